@@ -23,11 +23,14 @@ COMMON_SRC = \
             drivers/bus_spi_config.c \
             drivers/bus_spi_pinconfig.c \
             drivers/buttons.c \
+            drivers/crc.c \
             drivers/display.c \
             drivers/dma_reqmap.c \
             drivers/exti.c \
             drivers/io.c \
             drivers/light_led.c \
+            drivers/max7456_font.c \
+            drivers/max7456_transfer.c \
             drivers/mco.c \
             drivers/motor.c \
             drivers/pinio.c \
@@ -49,6 +52,7 @@ COMMON_SRC = \
             fc/board_info.c \
             fc/config.c \
             fc/dispatch.c \
+            fc/flight_stats.c \
             fc/hardfaults.c \
             fc/tasks.c \
             fc/runtime_config.c \
@@ -64,6 +68,7 @@ COMMON_SRC = \
             io/usb_msc.c \
             msp/msp.c \
             msp/msp_box.c \
+            msp/msp_dataflash.c \
             msp/msp_serial.c \
             scheduler/scheduler.c \
             sensors/adcinternal.c \
@@ -125,7 +130,9 @@ COMMON_SRC = \
             sensors/gyro.c \
             sensors/initialisation.c \
             blackbox/blackbox.c \
+            blackbox/blackbox_adaptive.c \
             blackbox/blackbox_encoding.c \
+            blackbox/blackbox_gyro_capture.c \
             blackbox/blackbox_io.c \
             cms/cms.c \
             cms/cms_menu_blackbox.c \
@@ -156,6 +163,7 @@ COMMON_SRC = \
             io/displayport_srxl.c \
             io/displayport_crsf.c \
             io/displayport_hott.c \
+            io/displayport_virtual.c \
             io/rcdevice_cam.c \
             io/rcdevice.c \
             io/gps.c \
@@ -348,6 +356,7 @@ SPEED_OPTIMISED_SRC := $(SPEED_OPTIMISED_SRC) \
             drivers/bus_i2c_hal.c \
             drivers/bus_spi_ll.c \
             drivers/max7456.c \
+            drivers/max7456_transfer.c \
             drivers/pwm_output_dshot.c \
             drivers/pwm_output_dshot_shared.c \
             drivers/pwm_output_dshot_hal.c
@@ -415,6 +424,14 @@ SRC += \
             $(MSC_SRC)
 endif
 
+ifneq ($(filter SDCARD_SIM,$(FEATURES)),)
+SRC += \
+            drivers/sdcard.c \
+            drivers/sdcard_sim.c \
+            io/asyncfatfs/asyncfatfs.c \
+            io/asyncfatfs/fat_standard.c
+endif
+
 ifneq ($(filter VCP,$(FEATURES)),)
 SRC += $(VCP_SRC)
 endif
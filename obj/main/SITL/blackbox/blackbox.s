@@ -0,0 +1,4549 @@
+	.file	"blackbox.c"
+	.section	.gnu.lto_.profile.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\013\n=#"
+	.string	"\026\351\232Hp\326Rc\32790\302\004\365\235\201\312s\344\202'\215G\341i\252\177\322\017\006\275Ye0\246\264+)/%.&4^}\300\302\016:\350\240C]Y\344V\236\230\223\t-\365!\211\267\331Zk\367\226M\344\336\222\310\016|"
+	.string	"\177"
+	.string	"\217"
+	.ascii	"F\260A)\033\310\267\355j\352\253f\177\303\31721\207\001\360\375"
+	.ascii	"\227\277\270|\303\327\007:~\365\320\262\302\274\374\354\316g"
+	.ascii	"\337\362\375\343\265\276\376\2160\213XX\234\213\220\b\273\r)"
+	.ascii	"\223\266\034\215\305\023O\324P+V\024c\221\030\303{\030?\206\277"
+	.ascii	"\207\177?\274>{\366\356\335\323h$Wx~\332}\331\370\210\344\265"
+	.ascii	"\031vN\353\250\355\333\347\347\237\275\360\354\215\361\325k\356"
+	.ascii	"\3116`\341\301\207)\002y\233\006ir?\364\375\241\255\340\306\241"
+	.ascii	"S\252KkI)\311\275\233s\313\376\310`\377\240\342c\202t\304j\300"
+	.ascii	"\264\2577\243\037\037\241\013\005\235\315AO\260\037t\004\007"
+	.ascii	"r\016\320\367\r|\377\347\373\005\366\t\344\236\001\3379\347\354"
+	.ascii	"s\001\337\357\371>\317\365\316\333\034\363\034\340['\347\031"
+	.ascii	"\347837\337\311\177\316\b\305\353\333\272I\376\351'\026\265\321"
+	.ascii	"\310\215\274\r\3623\037\326\274\206\3463\314K\330\bX\365\223"
+	.ascii	"\373\300\336\351\272\351\311\342X\022<'\036Z\241\335]\024\254"
+	.ascii	"\003\207g9\253\232\224\r\361c\227\n\024\032f\0322`\270\020?\306"
+	.ascii	"\321N\037Xy\026\224W\236\351LW2E\275\t\267\247\244\302a\273\265"
+	.ascii	"\270,\n\305\023\265\206Z\331Q\235 A\346efUi\204\327\215\322I"
+	.ascii	"\255 <\320\372\025\244\336\360r\260\364V\351l\322\223HGF:O\362"
+	.ascii	",xR9\254b\253\202c\022\021\337?,\\B\226NE/r_tv\237\350:,\354"
+	.ascii	"\234\326Qg\274F_\0259\031\307)\327'\\\f\366\254\017\334l\202"
+	.ascii	"\305\275\020\n\206A\227\2708\261M\307\224_\213\227G\324\031\310"
+	.ascii	"BK\221\255\245\255h\317\2469\236D\265O4\252\236\212vj\004\207"
+	.ascii	"U\212\241\265\013\017\rE\374\030\352PP\327\371\371\351O0t\021"
+	.ascii	"\350\265zB\0076\221\002\232h\177\205jo\256D{\334\272\322\251"
+	.ascii	"\2218<w\344\3516\202}\377\232gz\"2,\363\222q\215\335\205`\236"
+	.ascii	"\371\3701\323(\314\342;\253\002\261\374\362\001\201\016\250\261"
+	.ascii	"5A\"b\222\024$Y\346\341\004\020B\306\330U\007\022\340\343!\230"
+	.ascii	")\rB3#\022\210(HRPT\312t\023\200\242\330N\013\305\275PC\013\305"
+	.ascii	"\363\037`\367\0242\n\244\210_\213\227\356\354K\233\360\255C\016"
+	.ascii	"J\356\356f\327)\301\374\272}\241\231\344#\324\256Vg\251\2737"
+	.ascii	"5\376\311\221\215\300\237\330\374\315h\262Se[\r\274\0361c\235"
+	.ascii	"\007\324\223:3}\303_GE\212z{\034\316\023\323\203\376\363eJ\375"
+	.ascii	"\211\245\322\277F\230{\236\325N\300V@\214]\"y\217\330\211\336"
+	.ascii	"\345S\267\234\022\202:u\372\220t\325>}Y\276\227\257\373\232S"
+	.ascii	"\235\005\336Z\254T\363dK\237h \211\366[\342F\351\030q}\242\364"
+	.ascii	"\262m\354\035|^\222w ;\344A\344\223\331a\301u\251\f\003\n\243"
+	.ascii	"\372\266\256\331l\fC^O=\352\315O3\t\307$1bt\327s\367~A\2577x"
+	.ascii	"UY\367!^\274L\261a\033c[\332\220D\233\357\372\005\304\352\222"
+	.ascii	"\322\017\037'\271\006\302Q2F\270q\207\345?\355q~\342\006S*[\351"
+	.ascii	"\005\214\214CC\022y\356\262\357\220d<\343\376g\003\211\340\225"
+	.ascii	";N7\353\326kn]\262\362\360\225\313p\345lyM\007\365\377\345|\356"
+	.ascii	"\330\307A3\217/\344\335\277\306\001\357\227\304\005\224\017\325"
+	.ascii	"0\3409\206k\230S#\377\263\377\r\314e\013[\274[\025\035\322\375"
+	.ascii	"R\213\320\210\r\266\374\257\226Hy\305\315J\251\345F\275\370@"
+	.ascii	"\322\354\225L\033\274\212\263\306\2729\364\322\263\035\335\261"
+	.ascii	"\b|\354\222\3620\327\t*\340I|\026\272\317\214\355q\326\016UE"
+	.ascii	"\254cr\210\013\351k\223}\204\3449\241\306\325\323\\\303_\254"
+	.ascii	"\277\3423\313O\177\270\307\206\357s6\365ND\001\203\267)K\266"
+	.ascii	" \325\302\203@\321\037\246/\024\366\004\3751C`\213,\373&\333"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\362\002\215\b"
+	.string	"\202G\030!\220\3150\006\377\377\377\377\177\331.\305+\374-\274`\274\300\375\301\207C\267\300\306\030\241\267\331R\246\024\356.\351\034\231H\017\001\224*Y^\016\372\254\347\354p\334h2\024F/\226\312Jyb\366I\246>\002\331\207\247\243\301X\250\n\023+B\203\225\311<\253@p\260\013\366\372\265\300W\247\007\357\024X\250\300\330F\035P\002R\312j<\022`#!\204\346 434a\026\267v\3757\217\003\024\265\334&|\341\205'\330\035Oy\376z[o\331DV\003\235\377e\205\371\351]\232(\235F/$\026\345\007mF\3344\362\241f\017\026\355s\270dI\351\223BP\202\003\203I\231\007u=\252\321\307\340\tw\342\273\363\3631\315\005\270\357i\034"
+	.ascii	"\263\317\f\344R\263\031p\300\320;\236|\331i{\267\332\235\253"
+	.ascii	"\341\002\250\205s,\235.RA~\033&\030\2429\204j\276j\372a\242\022"
+	.ascii	"\271@Nr\001\f5\242TK\353\030k{\035\301H\315\375"
+	.text
+	.section	.gnu.lto_.inline.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\304\025\2456"
+	.string	"\366<\321I\200\332Q:] Yh\230\213)\240\223\220N{LEF\272U\031\367\n@\251\234\364O\266%\334\261\350\245?\212\355j\340C=\272\242\r\360;\336c\326\367\231\331\327\177\251\300#+\302\237\353\327@\254\332\027\001\371d\313\235\002\261"
+	.string	"\274"
+	.string	"\277"
+	.ascii	"*.[\253\264v\372p\322\003\030opY\2633\316\373\207\274\005\314"
+	.ascii	"\326\023\007E\267\207\026\026\020\006\007\360\347\210\370Iw\353"
+	.ascii	"<\275\257h\177+t\324\026\335\261\246\344\222\036\306\300\366"
+	.ascii	"|kt{p)\273\364\256\373\321\037\327?\216\177\023=\n\274WidE\316"
+	.ascii	"\247\352S\025h~\375j\373\266\2038\215\354Jy;\367\271\177,\205"
+	.ascii	"t\342\3017\373\302\002B\347\037t\227\313e\032\306\371\177\201"
+	.ascii	"\355\177\334\r\275A\361\337T\361\377Z%3\347\005N:z;\3443\256"
+	.ascii	"$9\020\374\344s\220\273\273\317_x\275\230E\205\351\341\337\016"
+	.ascii	"\361\021\265\344\031\336\237\340=\254,\300n\244C^2\032\303\314"
+	.ascii	"\240\371\334\355\0131\307`1\026J6\226\t\347\207\255\265\261="
+	.ascii	"3\260\245b\177x\005r\212\345\341\025\034N\036N\262)\2159\177"
+	.ascii	"8\311\342n\217.\222\262\035G\353\342\004l\356\032\3356\306 \303"
+	.ascii	"C\342\0264\244\210I\317\363\257\326\\\237\273\357\364\251z\365"
+	.ascii	"w~\265_m\237`\340\235\241\203\351kg\242}4\355\247\r\344!9\274"
+	.ascii	"Zw\265\2576\220\217YhEv_\373k\377r\315hUX:\275\331\rt\315\324"
+	.ascii	"\320\264y\264\033\3106`09\356\316C\026\226\234\277Rw\023\177"
+	.ascii	"\037\266\311/\353\303H^\326\207S\374\347\031 \240\307\333\001"
+	.ascii	"\220\352\350rr\266\374\324\335\r\016\342\267/\2144\211\302>\216"
+	.ascii	"X\253\205V\322\2069\370p_1"
+	.string	"x\207\304\334=\230\327\300\366\\\366\016=\374+\335\035\340>]\261\273o\347@\244\242\205\365\2037\274YQ`\230\354\\\303\0213eiJZ#\022/\211\341R\036\355\025\376\333s\352&\016@)\374\273\213\325\335\274\334\004\334/d\036\335\215\003\326\335\351%\374\276\342\215D-g\366\313\350&\331\214MY\250G\370\255\222\345r\355$[.\327r\376\340\274\261\267g{\333\231c\376G;\377\241\353\003kK\312I\305\377%\272h\314\250A\236\\\026\030\2706\325W\374Yx\317\272\246\304x\302K\244K\371e>}J\304c\002\377\377\233\035\3363\312\254 \026\310\252v\210)8\212\340E:\036\335\376\377\016\307H&\003\252\t\177qS\215\"\023\343@\203K\224\307\246\264\236n\027\262\326\005\016\252*B\b \235@A\021\360\240\333\2352\213\n\203\036(\344\376\001\021\233\244\230\216\353\223\025\330\027\b?\361\337\367j"
+	.string	"!\362\243\207\232\260\274fL\211\225\035\225\225\223\252\035\263\204]\327\024UM6\317&\220\r\302\235\3213\372\263\245\347\224\325\263\372c!;I!\227tB>\246\311\375\337\300v\271\340\200.\007\355\334\300I\277\371-\3426H'\035\017;\211\263\225YTZ\032U\306\353*\375\b\333E4\222\255\256+\251\026\265\344\031\235\207\270-\353\356\003F\001\201\265\250\3219\231!\031\221$%I\241\003\241\004\004R\2169\b\315\003\022"
+	.ascii	"#5\005\243(\345\0301hhDD\222$%\005%\205,kH \021\216\230\224\304"
+	.ascii	"G\266\035\331.4}\344\325\217\026\264\260\217l\026\305t\306\021"
+	.ascii	"\037 \214\314\345\013[\216#\253\013v\234\343\372\002+\265\227"
+	.ascii	"D\2512\n\013\362\315\217\026;d\001|PI\210\215\204\263\275\033"
+	.ascii	"\232\204\376j\337\035\361\2649\217\005\262\214\267\374(\246b"
+	.ascii	"\237\230\nO\223x\263'\373U>\b\274\271\345\224 1\354\375\030K"
+	.ascii	"ZH\232\322\233SNA\364\013\356\313\322\3678&\325\3062\233p\370"
+	.ascii	"Sb\353\237]s\375\031&\340\376\206\"\323\205\003\\y\363s\365\036"
+	.ascii	"\277\355\243~\t\021x\f'\355H\217i\007\343\031\001\331\225 T\367"
+	.ascii	"wTt\256\255s\033v}\313:Gz\2379\374\376\022\322\366=@\254\b\215"
+	.ascii	"\220\203\fB\017\001bv\221_&\234\262d\007\025,y6\326\365\005\351"
+	.ascii	"e\363\005aW,\031*1\022\212\272\345\206\264\320\233\351\033\f"
+	.ascii	"\224Q\177n]\242\226\223y\257\320\246\353\306s\267Y\023I\350\354"
+	.ascii	"y\223\005\205\304Y\201\035\343\024V\206-\013\371\354\330x\"\262"
+	.ascii	"A\212\n\366\201r\245\026'\324\256\023\f4\266F+\204\317\322F^"
+	.ascii	"j\002\224H\206\311\246\262\336q\375:\320y\017C\022\013b\201\375"
+	.ascii	"\324\353\004B\333\210\n-\274Y\320\272\352\177\005<\266Ew\251"
+	.ascii	"\355\267+Y\236@9\346\305\265<o\261\252\200\347~\355\216\247\006"
+	.ascii	"\303\250\377\242k\022\216$\030#\263C\3605U\222v\031\201\377O"
+	.ascii	"F\3458\344O@6\225\226\004\032\232<\351K\366\325\004L"
+	.string	"\251\370k\301\235\003\345\213}[5O\002\017~o\034\204\361\257\311\023-\321\376\2456\333\363~\277[\203\273\002\350\370\\\267@T\375 \310\240C\302\033\211\324_e\355|nP9\317$\236\305A'\235\217\276\035I\306\326\274=\216\331\026\036t\231M\242\335\351\205s%\372\275\212\334O\024K\370\221\316\274';O\252\3713]zR\362(b\037\305\251Y\003k\344\243\226rb8B\f3J\3629\224\333\266\017\n\364&C\224Fh\201\274\001\260_\253\321\027\25438\250\300\334\036\205\276\341n\260\242.XPh\266\372\"\332\264\241\325\f\260\005\223u`\363dJ\341\276\347L \270\305-\357\327\326\256\025\b\221\001\346\241\243g\033\326\326\266-\261\331ASJ\237)OZ\027\350\222\313\235U\032u\3711\3407\r\276\372}\375\355\312\336\325(KP\355~\016\230\212\330\"\223a\025Q\306\236l\201`\223\316\375p"
+	.ascii	"\307\233-\032\344\315)\n\333f\037\254\344hF@\005)\333v\243.\212"
+	.ascii	"\344\304\001\"\\\376\232\\k\313(fw\004\347T\242}\206Q\304\260"
+	.ascii	"VH\335\245\007\"'\346\\\274\020\324H\341p\\\317@j\216i\301\003"
+	.ascii	"\t\230\223P\203\200\013\033\007\n\206\034|\205\003\217q\204C"
+	.ascii	"\350y\2426%\0260\207a\n\331^\207\227al \036r72h\235}\213\215"
+	.ascii	"A\373\355\030\316^\177s\037C\356G\346\310\250FXH\302&\200\246"
+	.ascii	"\345I\024\320\027\251\260{\247 %,\376\347#Z{\330\351\212\323"
+	.ascii	"\321\240l@:%\211b'`\004\fQ\236Odl>\357r\3106d\200\334E0\223h"
+	.ascii	"\350\362\244\004\016\360jP\300\001\025\206\254X\300\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\3254\235d"
+	.ascii	"Zvh\031<P\3566\007\355l\243V\252%\313\227}\342\304\221\271Ik"
+	.ascii	"-\346\020\367/\377\377m/\330\256\fdm\264\255\f\037\227\202\266"
+	.ascii	"\241I\034\235\272cV\267\006\306ikk\353\355m[J\231\002\224\001"
+	.ascii	"\210\001\201\001jnbnUnDN}\272dKdr\022\220\036\223\333ltLn\263"
+	.ascii	"\245QS\312\2660Z\246\230\334fSbr\233m\210\311\311\032\252\232"
+	.ascii	"\247\232\244Z\240"
+	.string	"\332\234\032\230\032\224\232X\247\022RYI\207M)\227i\312-e\022\332\251L\210huhehWLN\322\3446\245Lr29I\211\024dr\333\034\322\fy\205lB\002yS\312\263Q\227f\207fe3:dLN\316\252\304)\345Y\2219\245<~2y9:\032\313LN\316\031\307\214Z\306&uJy\004\302A\331)e\316\210\3679\303\243\340)\345]j[*\244\247\224\367\330F\303g\262R\336Z\370\224\362~\342\247\224\267\021\223\223\237\306\221\022\217\367\247\224u\243@\245\254\003\231\274\034T\312Z\216\356\2425\241R\326K\364\374\232\234\334\315\263\241R\246a\362\222\3173\242RvarE\245|\301\344\345\307\213J\031\201\202\217\033\225\362\315\344d\326\033\212\367\243R\236\355t\037\255\371h\035k]\214Dn\375\361\036\307\2768\251\224\265\311G\235\245m6\003;6\260\343-\023%v\034\317\232v"
+	.string	"\001\003\003e9\216\272Xio]\254D\356M\""
+	.string	"\031\231\236wV\312,\251\261\244\306\312\037\215Er\275\233gMG\3539\032\213|\215En\315\3479E\325\377\236=\377"
+	.string	"\370<\377\020\003\242\337\020\271u\254\307\261\327\343\230\376\337[;\336\332\361N\353\255\033\261c\2565\371\377\016\236\344\364/aQH\274\310\364\235@z\253 \367\317f"
+	.string	"x\031\377S\2042R)J!\001\350\337\244\003\336\234\213\321[\307\371\350\275y*\266\326\257\323\331l<\216\326\217\376\307\3618z\330\032\305\3266\255\267\357\177\310\311\364\236\347\341\266Bn,\254\347\372\357\377:\376v\323EQ\347\027\261\354O\261\307\255u\216q\354\2619'\027,\300\201\351\306\236dr\316\363\350\255\365\350\361\260\037\205\r.\344\326bZ\254\306\377\317x\031\177u\245\213]\310\275\271\031\035\001'\241\344o\266\236\215Z\\K\307\316*~)\202y\r|\374\017\020\340_G\320{\270yl\030\374\214\336;.\307\035\2174\232\376\221'\317\177\237>Z\013\022\264w\204D\211\270.j\"7\371b\214\307\217\343q\334\332zk\357\023[C\320Zs\027\345\326\216O\264\370\377\025\377*\376\204\226\216"
+	.ascii	"b\377\"r\177\355\330\374\003!Bv\264\207\377\267\320\201\017\237"
+	.ascii	"=\356fT\363,&\266\347\371\347Y\307\233kiIz\307\321\032\216\336"
+	.ascii	":\016\325%,\224\227\337`\307\316\217\255\347\f{lL\277\241\334"
+	.ascii	"!\223\223\231\234\034\313\255\311}\311=19\356?\336\271$\270S"
+	.ascii	"&/\213#\356\222\311\311\t\\J\321\314\3532_<SL\2635\022=\3438"
+	.ascii	"J\211\312\306pm\306\340\262\230\234\f\244\305\376\367\0201\261"
+	.ascii	" \r\366\306Q\301%\271\245\342\363m\324-\223\311IH\201\370\315"
+	.ascii	"\317\355N\254o\001`\271\267\002\300\202\241g\200\253\n\357\333"
+	.ascii	"\207^\355Z\365>\202\272\017\372\340\226\265z\037\301\3637\\o"
+	.ascii	">_\317\265n\347\322}\352v/\324\355\301\023\330\205\271\027\272"
+	.ascii	"\375\204_W\375\235l{\256\003\276\352\327\336\365\256)\313\366"
+	.ascii	"\240\357d[\025\356k;tS\230UO\237{\340\323\025\206[7\b\237)\334"
+	.ascii	"]\265\037x7E\325\256/w\355\252\233\276V\217\246>\026\354e\211"
+	.ascii	"g\372\022\253~m}-\334\272\303\253O\341\356\236B\257\341\351\266"
+	.ascii	"p+\334}J\\{\327\231\256\250z\302m\360E\253>E[\341\355\337\236"
+	.ascii	"\376j\317\343\355\302\023MW\256\376\252\350\371\376\004\374\013"
+	.ascii	"w\370=\341 P]\177\271G{Yh\217\374\324%\302\303\356;[\027\f\230"
+	.ascii	"\263\372W\375\352'\220\310\225\242\002\336ma_\377\235-L\354\351"
+	.ascii	"\020\f>\335\024^\325\237\201G{\274,\264G\373\367\367ka"
+	.string	"\242\357L\273T\330\327\023|\n\354n\332\325\317/\367\004\262j\020n[\341{\372\334\002\317\341\355\361|=\036\272\246\352\026\257\304\356q\240=\033\263G{\374\205\377+\217\377\347\234s\321[\001\251\265\002r\201#-]\030)\316(+l\016+5a\202\2420Sas\030*R#\021\333\234\207\321[\227g\273AT\004B\244($l\217\234\004\206\264\212E8\241\342\221\021\203\223b\222Q\203\236q\332\032=\250\270dtRdB\352\017lW\336\257\345\241\354\210\033\333\3235\304\004\t\025$\\ \277\303)\210\333\203\267\207\305\323=\333\252\257\332\225\272V\377\366xo\217|\241\253n\245pGy\260\333\341\227\007lS\\\375\333\343\237\n;\313\203\177\335\ra\342\306kq{\227\327\242dU!\356\253\013q\377\325\373\2320\273=L\034\302D\026\270'A\201\366\351\332}\357y\373,b\257\006\257m\327\272\246>"
+	.ascii	"O\354\361\377\245n\371n\373\262)\f\230M]\227\350\323}*T\341a"
+	.ascii	"\333\2565a\313\246\350\371\276\251\257u\207V\217\252\302\322"
+	.ascii	"\r\302\265\257=\314\252\355\220GO]\256\263\017\341\335\277>\267"
+	.ascii	"\366\355\360+=}n\371/\371/nm\3352\350\203\325a\315\253\203\321"
+	.ascii	"\326\264+]k/\302D\013`\027\322\236\274}\352c{\027\332OV\025\236"
+	.ascii	"\250\256\n\025Pa\367>\202;\364\352\207D\224U\275r\217\253\372"
+	.ascii	"\352k\352\236B7\205\325+T\035\236p\347\352\322\305`U\025\360"
+	.ascii	"\007tm\203o\352\006a\002`\260\332\325]\340\251\302l\267zV\355"
+	.ascii	"\300sm]\230m}\347\313\325\253P\340\325\253/\333]\230@\355S\257"
+	.ascii	"\023u\273\227\333\376\320"
+	.string	"4\375]\375\360=S\036\352\360=\177\277\335W\027\236\277\237\325\303o\333r\235\277_M\367\266\317\275W\007;aU\250\256\247\220\370\242\352\260\252\366(\333\271\320\236\242\247W\017\202\336\250\222\002\243\202\320\b\215\210\210$I\222\016\022\n\020\206Fy\236\346\026y\022 \362p\b\3430\216\302 C\b!\206\030c\230!\201\210\210\310\210\210\310\264\003F\207*\263v\262\343\272\251\225\250\334+c\276\230\324\020\2214e\246\316\017\340BF\344\tACb \023\351\344\005\354\263\006#4\370\354\364\313K8x-y\301\3317\231L\364\337\b\210\r\212$\037\272\245\026\206\"\347v\234\350\031\340\203\217'h\207K\f:gg\004T#\336\231\312\370\220\370\345\300W\242\303d'\207\221|?w~\317\006Y\013-\016\341\241\231%L\355\366\324\346rdL0\f\202\fX\247\216\023y\276\377\271\362;y\220\3735l/~\326"
+	.ascii	"\323\270 \n\3566\323\200\205E\240\001^\303\320\215\007\037\270"
+	.ascii	"\032\021W\224\245\355\001\316\252c*\273\343\335SL\253;\257$m"
+	.ascii	"\027\300&\355R\271\330\217V\253\246\340\307\021\006\207\235\244"
+	.ascii	"\216u\240\212\351\232\b\232\232\222\322_\255\234\234d\002xO\\"
+	.ascii	"F\305\033\211\fT\211\303!:^~\316\224\252\337\351\207B\353\251"
+	.ascii	"\036!}\3041:0^]\246k.\260+z\370\r\255%-\362Z\321\001%9\275\303"
+	.ascii	"\016\372\n\027\007\333\330\367\256s\227\230\004\b\001\n\253k"
+	.ascii	"\365\330\326\240\210\020\030+\034k\302\030\2653"
+	.string	"a\342\005q \216\347\257\3740\200#L\375"
+	.ascii	"\3007v\345\004qbSk-\354&-\204\216<G,\017aL\312/\252AAu\022E\352"
+	.ascii	"\306>\330\263\351\325p:\250\337\244=\313e\342\202B\024\370\231"
+	.ascii	"\3747\336\227mJ\322\320\376j\256z\026.C\004\354\366\017\3348"
+	.ascii	"\016\207\002\265w!%#\177\307\245\212O\331\203 \225\002\bd\242"
+	.ascii	"\236sj\b\267\351\036$\033\224%\273\032f\007\370\361\3766T\200"
+	.ascii	"\266sLw5G/\246\275 \223\327\330\331<D\352\262\022\345\213=<\001"
+	.ascii	"\242MG\243\330(\002~\227~&\225\347R/D\256\033}a\221\374\220\263"
+	.ascii	"\377\364\374B\334T\310Y0\322\233\363M\276\305\201eZqu\201\030"
+	.ascii	"r\262`\314\210\273r\221+~\200\316\001w\256\017r\315\2334\227"
+	.ascii	"\001\013\324\260\025&pU\306UU\243CO\253\311\255\260\221_\273"
+	.ascii	"\177\223\245#&\"9\314^\350\004\365\013\321\225\016\t\377\024"
+	.ascii	"K\310\220"
+	.string	"U\316r\312\242\013\006\272\2344\276\237 \231\236\033M(\371\254\030\240\370q\027)\306K\267\367\321=\273TP\035\034\026\214<`\322\264\200\336|B\377\026\345\024\342\316\233\276\223\204dd\354{\351KtP\226r!\335\246\311\357\004\367\271*\277@x\372\206\216,\207\215\237\016\367\252|\354\354\234\004`\302Z)D\274\346\025\242_J\201t{r/\360;\327b\336/\307V\313\024\305#\0354\350\345y\226\254q\\V\260\317\205:\352\207\260\367|\214\006\030\202\220\363\336\237a\275h-\344H^\222\3439I+\317$\204\301\312N\276g\252=\001\347\241\023:\222\326\022,1\271:\222\3368Il \216P\261z\221\367\033\364\324\017Q\266\362\0267\006\324\177\031Q\355\2428t\317\270\374\204\207V\343\265f\342g\213\\\303\377\017\024x\275\342PW9\210\206\245\030\220D[\373\316B\035\025Vy\352\314\315\327\351\017"
+	.string	"\201\306\351?\177\3579&\205\022\332\004\017\034\375\310\036\tf\236\330\177\n\345\367(@\302\222\332\201~\324\241/\272\221:\266\317\b<\025U\273\367\004\005\200\342\200\304\204Y\252\357\343\"\2258\340D\236\373X\331\231\023x\224\344^\037\313\f\330\216\017\223"
+	.string	"\027G?V\361\022i\235\035\022t:\031\300x\363{\305$\304\005\370U\372\210\365\264\235S0^\254a"
+	.string	"\231\371\203s\222p\245G\0259\024\207\301\260\274PD\274n\3471]\3449O@E\200\036.B\363~j\302\027\177\313\2416\312\f\007\322\256@cC\247\324F\342B\016\243\022P7\254F\237\224Q\337\262\372\354j\324x\016!\363\340\235j\217\202\017\236\242k\250\022\374\331\335"
+	.string	"\232\267`\030~\316ArYf\2774\212\na\022\255X\030\007\002\350.\355\033"
+	.ascii	"k\005(\017\373&M\243\257\232\312\242Wx\350\304r7:D\3330"
+	.string	"\250\227\340\373\302\001\315\343Fk\025\244\255i}\274\026+\264\234JU\231\031\253V\372s+\b\321\334\314I\023\346\260J\335}\034\302\"!\005\360UF8t{#\025\335\343\260\001ex\365\337\257\366U\314NPYN\300\\'\334\227\234\t\214y!U%8u\320\020*\376qX\251\207\312\345\362\321}\312=\313p[\273\227\200U\026\313\177\004\337\213\026X\343\006\002%\030f\201#'\356'\006\335!\335\247y\265\236\243\r}\276\244\211\376;\277\003\311\375D[%'\013x\306\304V\362@\017e\177\240\333V\036\224A\246N\207\272\371x\234)j\222\374\026\317-\3153\304rmi \177cZ\335\177\214\005\265\323.\234\027\377 `\241\242\207\243C\364\262\300\341\261?n\245~FR\004eI[\201\361\332D'\"\332\264\327\002s\237=-,\025\375\351\236t\263\377#\314\303\330P\212\323\363\233\357`p\353u"
+	.string	"9\250\223\032\337\275\303\2318\222`\377\3162\234\232?\303\353\013bPB\272\036\214\344\341\224\372E\201S\025\355\320\364\303+b\356l\217\3704~C\r\364\365U"
+	.ascii	"\204q\201\336\214\327\b\263\032h\261\365\021\033\026\255\244"
+	.ascii	"\246\317jI\301i\262\244#\260\360e5\361\251\266V\345\231\364\352"
+	.ascii	":L\370\225\001v\2123\005\305J\310\3050#H\247_B'\275b\b\220b_"
+	.ascii	"-\013}p\275\253\333\220\222WL\002\254\001h\2348Z\203\247`7\240"
+	.ascii	"\007t@\3040g\203\322r\263\355x\231\203U\023\002\376\362e#jYj"
+	.ascii	"\271\2432[\351(j\\\030\345\354\222$\256l\326\260;\\\3046\367"
+	.ascii	"\017\243M*\264(\340\240D\245\005\264\037\204\333\237\371X"
+	.text
+	.section	.gnu.lto_.pureconst.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 w\035\003"
+	.string	"r\307\027\037`W\032\003!\bnI\016R\t\017xt(\351\351\360\351V\376\344\013\b\331E\013\223\360|\007N\262\032Y\211\264\220\203\374\343\036\253\216s|\343i<\243a\374\342\026\257x\024m\342\022\2178\304\037\356\360\032\036\303\027\236BK8B3x*h\"h\003M\340\001\r\340\224\325:\254\265J\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\362\004\005\022"
+	.string	"\206\022@;@m[9\3030\f\254c\270\001\216\252\202Uzvv\256zny\232\032\322\216i\314\233{e\277\271K\253\354\337t\272\024\204\320K94\254\301\232\310\362\201d\301o\"\"M\312\024,"
+	.string	"0"
+	.string	"0"
+	.ascii	"\025:\374\252T\361\234\025\005\20564\205J\301\224c&t^\355\344"
+	.ascii	"t]\243\215\326N$\307m\233\204Nj\345\214\320h\215)/\225\b\223"
+	.ascii	"\237Z\026;\221\340\245\353<\236Mk4;S\307\034\234"
+	.string	"\f2\3138\031\204\256\223\334\013\026\272\304\213\372\251O\372\250\217\372\002<\205\321'/\266\b%0\200\002\"\354_\002\200w\344#\221\347z\035\362\034\204\366\301\343\201\353\300a\203\206\f\030&@.\331\363\343\371)=\336\333\273\232l\314\253\211\025[0\013\226\251P[X\246\"i\332&y\260\203\237\031\225\265\001\203\314\002\005\317\004#X3b\023\035\250\001\021\235\232\020\255&{\223{V'\b\324\266@\200\262\250q]eC\251\024\332\f\200\002\031*2z\021\260\035\"\312\261RP\220T\n\315\001\357\305\022B\220\370\002\377;)x\327\347t\017\227\3519\021 \363\021i R_\356r\023J\371\003\031l\203\332\223\\&7F\327\2069\334\233&W\206M\370|7\0012\346^\025_\354w\225\002\254\2041EQ\322g~\032 \320\316`\310\243\362\330 \016\320\033\276\326\032(\003<\317Tw=\200\277\335\2731"
+	.ascii	"8\313V\247\335\024\315\334Q\312\005\376\n\330\303\211=p\026 "
+	.ascii	"\322\212\225B\372\2714\0068\2454+3\b\033]\031\360\270\204\210"
+	.ascii	"\302\227\265\270\261\021u=\005\372\016\203R\320\263(\037;|\355"
+	.ascii	"r\234$\226\352\367tt\250\2530\316+\261WY\020\3439\b\314\261E"
+	.ascii	"\270\231M\275\235\273%W\373\021\215\3241\0241\227?Q\006=($\236"
+	.ascii	"\323F\031/GlzK>\231\242\371\236b\261\026\2058;\177~\325\207T"
+	.ascii	"\366qxPQ\224\t\366\223\330\247\027\300-*M\\8\031\037\371\032"
+	.ascii	"\013\270\330\fd\362\266\317w\026\276\224\203|\357\225\271\"\246"
+	.ascii	"\006\373\277\0049\rN\377\317NQ\211\345R\374"
+	.text
+	.section	.gnu.lto_.lto.a7c5cc1330de509,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.98.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 \244\215\004"
+	.string	"\344\007k"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\205\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\006"
+	.string	"\310*\b\204#\236\262\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.100.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 F\365\001"
+	.string	"$\0039"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001(\035\001\001\003\005\001\006'\001 ?\202\210\2008\177}\277\001{\276\001y\275\001w\273\001u\274\001s\273\001q\273\001"
+	.string	"\004"
+	.string	"@\006\334M\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_blackboxHeader.101.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxHeaderAdaptive.102.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:3\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.103.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\250\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\370\304Ry\276\004\230\304\002}\301\003\330\377\001y\304\002\005\001'C\206\bw\377\001u\307'K\206\bs\330\376\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.104.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\254\f\205'"
+	.string	"F|\336A@\246N\007\307\005|\251\320\005\321x\272\204\224\362\247\241V\234\265\361g8\006y4\274c\366\231\262\304\334\337\006\245\024\341\203\374\240_\252\302C+O\220q\236\022 \364\366\201\037\312\311\330\242[\245\224v\313"
+	.string	"\324"
+	.string	"\305"
+	.string	"\356\303\337\037\306\337\203\217\351\013\2456\3324\301y\270V\376\275\230B `~>\270B\"D\371\371b\013\206\226\311f\036\352\313\337\007BmT\201Z\306\314\352\263=e\017\342\313\177\b>/\340\001R\266\240@\371\375\340\026b\250\353\243\354?~\362\373\305n\224\001LN\331ts\371\377\340\327"
+	.string	"\027+;\016O\376?"
+	.ascii	"\0016\330i\273\223\037\020>\342p\206\246l\265\264\374\200\261"
+	.ascii	"\020\351\211\254Yf\246\3549r\362\007\302\037\324F\215\320O\032"
+	.ascii	"6\323WU/\331f\266\275\314j\260d/kt\230\262\307p\344h1-\256\255"
+	.ascii	"\020b\371(\f/\316\t\240\226\326\333]\215\356H_W\033E\273I\330"
+	.ascii	"h\332\247\200v\0226z\252\235g\022[\315\254\352e\235\363\311\177"
+	.ascii	"\0267\025\265Q\24599\343\243\305Kqx\214\237\006\017xs3~ZL\300"
+	.ascii	"\327\230K;l\306Wk\257\002hgR\337\026\033\230#G\352\335\340\003"
+	.ascii	"M2\251w\213\231\232U\r\3066\323\307\304\244\376mE\372v\227\332"
+	.ascii	"(\202\257fV\3031\227,\036\256E\372\352P\033\035\220`M\0336.\036"
+	.ascii	".~\221\276Wj\243\004\232\320\234\231z9X\001\2311S/\027/\360\002"
+	.ascii	"\346\313\324\317\3010\322w\206\332\250\022\203,["
+	.string	"\264\020\237\016\206\332\350R\003\237R\325xl3\227NE\351V\274J\214\267[\323\327\205\332\350\016\003NP\236\020\377.v\320\204\t\361\363\340\007H\224x\022\342\347\025\3237\005\204\"D\214\257\007G\360\256 \306\327\213%\004\036\305\245\370\025\307\342\\\274\213\207q1^\306\315x\032W\343n\374\215\203y\230\303\3618^\346fN\307\353x\232\253\371\035os8\217=\217\353q:\337\343}\334\217\3379\236\013\362<\037\344\204\374\220\373\271\242\017\036\350\202\317\343\267\376\307\277\037\344\273\236\310\027y$\237\344\227xx\270C\224\020\216m\274&\317\304\204\007\242H\337\036S\033\355\245\257\275\327+\211\341\202\375u\304Hv\301\370\207\b\311>\b\003X>\327\003\311>\230\346}|\217\374d\261\360\265\006\3637a\243:\300E\371\233\261\230\277D\210\362\227\035h'/\324g(\177Y\314t\344z|{\371\315\340-H\201"
+	.ascii	"\3457\213\223\354\376\344?\203\005\004\347U{t"
+	.string	"Wd\321\215\302j[+\245\263\310\036]\364T\021E\242D\362xc\025\2362\256V\226m\241\210\310\243\323\275:\266Xn1\031\300]\251l \235n\262\350\256'\212\306\025Y\304b\327%\343\312\032\235\256\225\210\026\271\216H\317c2\211DO(\022\"Z$\016cz\322p\333\226eA$\256G\247\261\006UQ\206\360D\266n\313\nO\342\323\215\226\252\212\270ZQ\r\257\216+;$\"\223\303\247\007g\213UD\016\335\266E\016\221\316\326\006\262\230\024\236\r\247\3434\235\256\323k\315\326n\375\326yZO\357i>m\327w\235\327zM\250\013\265_\377\265\242^\324\202=\350[\336\303\2018\227\013\361!n\304\217\270\227/q\330\235\004\200\366\250\221dE\2305\232\224G!\313\0300#\021\231\232\016\021P0\206\020A\312\022+U\220c\215![~\251\367\222\242\326U=\323\273\330+\022XSL\325!\022t"
+	.string	"`\311\013\310R\201\304\265\233\3508\3239\223\316\362\f\020\351)\201\247\213\350f]S\2624\022\026!\322\241\243\237\005&\332\307\201\b\200\037\304\231a\376|\034\023Vh\213\205\262\321;\371\r\327\364\351\bD\020Wk\332\017N:\013#H\242c\374\004\376N\335\371w\217\207\236\223\365S\334\b\344>\202\213S\352c\236\001\242.\232\364\003uH\203,\327'c/\331\336\036 :\207\244w\301\004\223\3445l\002\367uC`@X.\352\334\327o;h\023\027a\262\377\242\nd\327\336QMF\217"
+	.string	"l?\220\243\210!\337\262\212:\242\f\342(m\330`\205\331V\301\356tR \264\224Vk\352\315^\352a\222\2339=\202\210\037t\325\243"
+	.ascii	"\345\270\204co\346\222\036\232\335\311\021=Y\204\037iw{\230\213"
+	.ascii	"\0214\336\275\345\232\\\221\027K\333\311\374\035c\350\221\005"
+	.ascii	"\017\b>\2404|\201\016\242\025\361\r9%D@\203ks\243\023\3200\236"
+	.ascii	"\001\270\250\255e0\336\001Xpm\257\031\264\301\b\200b\030x\\\364"
+	.ascii	"\005\300\270i\031D\214C\3679v]\fF'D\033aD\006\3745,\202=\362"
+	.ascii	"\024\227\017"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.105.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`<\001\025\013"
+	.string	"\204\021\272\001"
+	.string	""
+	.string	"v"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\255\222\311\311\n}\276?\202\210\2000{y\277\001w\275\001u\273\001s\273\001q\274\001o\273\025\001\006\005\001'A\206\bm\230\314\004k\302\303\005\005\001'L\206\bi\330\307\004g\306\307\004\007\001\005\001'Z\307\004k\314\315\001w\313\001u\274\001s\312\001q\273\003"
+	.string	"\330\306\004k\321\322\001w\320\002\005\001'e\206\be\230\306\004c\325\326\035\001\027\n\005\001'q\206\ba\330\305\004_\332\333\331\3308]3\334\0014\327\001\324\001\323\001\317\001\316\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\022GPS_ground_course"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\nspeed"
+	.string	"\raltitudecoord"
+	.string	"\013numSat"
+	.string	"\005time"
+	.ascii	"! \360\"\022\233\007 \030\376pC\030!\002A\2242qO\264\363\030"
+	.ascii	"\343\363u\221VpK\"\335F\207\3148Oh\250\247dlBP\376\033\222\303"
+	.ascii	"4\306\261\333\255\374\267\3212\376g\270yf\277m\255S\326\305\320"
+	.ascii	"\203)\002"
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.106.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\311\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\317\004}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.107.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"}\t"
+	.string	"\304\017!\001"
+	.string	""
+	.string	"\202"
+	.string	"\005\001\006\035\001\007\030\001\177\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\271\232\321\313\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\274\001q\273\001\005\001\006\025\001\004\005\001'E\206\bo\330\334\004m\302\303\003\005\001'W\206\bk\230\334\004i\306\307\002\001\005\001'f\206\bg\230\327\004e\313\314\312r\206\bc\330\326\004a\316\317_3\320\0014\315\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\026rxFlightChannelsValid"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\021rxSignalReceived"
+	.string	"\016failsafePhase"
+	.string	"\013stateFlags"
+	.string	"\020fModeFlags"
+	.string	"\025"
+	.ascii	"\022\007\001\013\253\016l.\003\207\001\363@\346S\226\001#\300"
+	.ascii	"\3506\222Q\246e\300\013`4\310\030xV\225y\302*IA\031\276\330J"
+	.ascii	"i\020\003p"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.129.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 \375\275\006"
+	.string	"\222L.4Pm\222\016$\217\202*\241\252wR5\201\257 \260}y\022|U\177\366\355\337-\ruTp\307"
+	.string	"X4\317\314,\242\210>\\\260\250\031s\250\321Z\333D\246[\227\211+\303`a\0322\317a\001\243y\026\006\361.\003_\017\n\330\213\270.\354Y\266\354\210\004\037\004\335n\252\"bC\037\240\206Tds7\226\340\270j\245.\247*U\f\250\370\270\322o\036\207\030\337)\361\342w\243sw\022\3608\321\220d\212J+iB\225t\374\235\267|\200\3209\353\246!*\007)4\242\222\271=\314hV\227\335\202tJA!i#O\035@Bf\356\264\021E\307\376\005\277\301o\021\n"
+	.ascii	"`\251'3 \f3\205\273\021\312\022\327\304\307\210\274\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.134.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\261\025UT"
+	.string	"z\215"
+	.string	"\037Q0\220\312I\007\024\013\"\324\376\253\355\334}\213\016{\375\360\206\0250\007\223|\341\244]\003s\021\367\270a;\324\230\242\222@\210*@\005\244*\020\302L\203\001\020"
+	.ascii	"\004b\313\006w\314\027\001\245\351\024=C\271\\\350\243,\335}"
+	.ascii	"\327\355\255\245\335\244\224)\360\001\240\001\333\001|\235 ?"
+	.ascii	"\007\310\027\236\217s~\360\307\007V>\212\362\353\217\377\253"
+	.ascii	"\374\256|\376\361\227\201\255b\204\371\305d\204\006\243\226v"
+	.ascii	"=\333\244tu\013\223\377\373\345\n\234\027\032\226p\3006\270."
+	.ascii	"U\311\205\313\212\033\342\314\2664\221\343{c\241\002^\033\216"
+	.ascii	"\0320fl9Jg\026*5{|X\252X\232\031\363\314\312~-\327\326P\346\362"
+	.ascii	"\212\331J\331)\037\254\332s\310\326t`\236\245i\232\363\301\237"
+	.ascii	"\263u\370\207\360\347\374g\376\367l\243\204\260h \374zR\255\""
+	.ascii	"\\oi\252\006\365\250\340\326\244\rB\267\376\026\b\335\372\377"
+	.ascii	"&P\204\360\344\252\205u\001\273v(\253\360\245\251\232T\037\331"
+	.ascii	"\344\236\24021UB*\n\352h|r*\222\030\321\304\264$B))\004\022\210"
+	.ascii	"\017GFEDCBAD\240\037\237\036\236\341\216N\216\020'\bD\353\257"
+	.ascii	"9\371\275\332\023B:2 g\250\310\254\t2<5F\f\227\320q\201\314\004"
+	.ascii	"\251\2709\216\232[\25089>\306}a#\207!#\341\314S\003w;\324\316"
+	.ascii	"\372\234p\330\"\034\016L\002\316\215G\224\331&`\325\0217'\223"
+	.ascii	"R\231\027\033/\261\255\2102/-\254\224e\006N\002\323E&D\332\""
+	.ascii	"\241\2451\b\264(\374\201I\334\021\2245z\002\205\213\2368a\"\007"
+	.ascii	"\272\332\206\230\254\020\023\016Z\242\204\211znY\200\222\354"
+	.ascii	"O\022\366A\"\306=i\272\242\360\b\331\241\020\336a\352\374\236"
+	.ascii	"\230_~\254\235\327\327/\250\256H\231-\363\002\343\234 \032\267"
+	.ascii	"'g\204\213\265\302\342\254\300A;/ \277\2442\257%\003\303P\260"
+	.ascii	"\312\263\002\331o\323\366\367\306\307w\326G\304G\231\355\034"
+	.ascii	"\274\204\265\321\200\345\314l,\210rK\004-a\217\2542h\327\345"
+	.ascii	"\361-\021\2570>\f\254J\323\364\314\325\303\307\036\305\376?\250"
+	.ascii	"\377*\376\037\253\fd\371\324\353e\227)\006\357\247\323\305%\236"
+	.ascii	"\362\r\326\004(S\353\364Y\231\302\026\321\244fj\024O\271\314"
+	.ascii	"\372r$\377\260\021LS\255\024g\037|\202\005\337\261\255\277\340"
+	.ascii	"\006/\327\rtkR\357\227\345(Mz`FA\303\342\347\327n_u\305n\220"
+	.ascii	"\272\224j\335u\366*Z2\217s\tD\273,\244d%\2700\302\231+\214\371"
+	.ascii	"5\304\"\360\026+\211Bl\370\316\314\030\353\234\005\024d }\362"
+	.ascii	"\235\231=\317\351\235\3004p>m\276n\356\004\356-{\372\276kxrH"
+	.ascii	"\363U3d\323\373\366p'Pn\271cf\363\366\314\235\301\252s\346J\273"
+	.ascii	"\220\270\220\262P\346\313\303\235@7\270\237\230\357\230;\201"
+	.ascii	"m\313\336\341\013\346N \033\034\337}u\270\263\205\331\322}\353"
+	.ascii	"\356l1\266 \240[W\356\277s\327\370\230_iz\265L's\245N[\221Z\356"
+	.ascii	"G\0273E\302o~\265\254\375\245\335\374\367\227\246i\3726\362W"
+	.ascii	">\215\312_\240\362gT\276\002\225/\243\362\023\250\374\030\225"
+	.ascii	"\217@\345\303\250\374\003*\377E\345\033P\371.*\277\200\312\267"
+	.ascii	"\252\374\252\312'\240\362\007\250|\001*\277\305\371,*?\200\363"
+	.ascii	"W\234\257\242\362S\234\217\242\362O\234Ou\376T\345\2278?\252"
+	.ascii	"\362\241\316?\236o\254\374\247\363\235\316/\236?\342\374\246"
+	.ascii	"\312g:\177\351|\245\312OZ\264]$!\377\203\220\177$\344\033\t\371"
+	.ascii	"EB>\221\220?$\344\013\t\371AB>Q\310\007:\377\347\307\367\371"
+	.ascii	"\361{\316\347\301\341\017\317\337\251\001\311&\274\\\311&\350"
+	.ascii	"V\241\223r\257\017\r\213\315\276\352\203\221q\271\350\270CC="
+	.ascii	"ud\364\202\214\232\244-\242\006\364\013\266#YK\026\003z\331\212"
+	.ascii	"\272\311S\026\247Y\206\037N\023\205@\341[\236kB$d\\\016:\256"
+	.ascii	"\220PS\r\t\271 \336\351\365l\021-\240]\264\035\311U\326\n\350"
+	.ascii	"m\013J\242\301\346\262%\016\356\004\350\237\204\222\214\302\313"
+	.ascii	"\025l\242\0200:\255\275\3459 t\304\037\343\262\317q\203\202z"
+	.ascii	"\004\320\217\325\227\036\032)(lU[\275\035\311ihU\275o>\335\274"
+	.ascii	"\025\n\354\341\023*c\222i\f\305j\347\302\376\347\340'.H\204\245"
+	.ascii	"i\n\300\013v\002#\230\246i\212\255g3\0351\230\302\214u\200n\005"
+	.ascii	"\366\316\211\225A\033\245a\213y\206\201c\350\340;v\0313f\240"
+	.ascii	"[k\343\250\200\347d\211\245\265,\367\244\353\031"
+	.string	"\032\227w\216K$\266\212 O\220\333\017\267!\001`T\314\f\321\273c\261\035\240\t\330r$\227\221\r\320\273\245{\236xw;E\215\006\224\227D\211N7\2775\320_\017\355\250\3744XI\215$<\346\300\003\020@@\002\214\\\037\232\234n\236q\214\313\301\343\0025\t?P\257@\205\335\374\256\220\226\346\033N\033\371\005\350M[\376\252\301)E\357NL\260E\013\300\345H\016;\322\242\227\013\217\222\n]\260\233\357\346\036\"\2412\247\305k\316\363|>\333l\021E\352\356#\036\266\230\315\275\3127@\374G A\023\345\366\350\262\372\352\353\334M\333\007\366X\350\313\003\006\320,\322-\242':\200.G2\221!'z\273\220A\273\031dS4\212\337\026\321\022\235\002\356Hf\202\225\350\205\013S\273\371\tP\250>6\021\236r\013o\021}j(/G\006\033\340\270\241\343F\005\033\340\260\201s\033Q\036\340\240"
+	.ascii	"\003\033\310\f(\220\332\340\006R\003)\0339:\220\212\nq\034\034"
+	.ascii	"X\220CJ\007\016\0349\244r\324\260\266\215\374\270u\002\223J\251"
+	.ascii	"\327\312V\017\247\324RCm\365@{jj\036#\333\241tsrj\240\2316W\334"
+	.ascii	"\232x\312\022\373\3348\231\214\255s\306\rZ\210\250\346\030\330"
+	.ascii	"\310\035M5\223\3659\207\250z\350\244o\t\320\210\036\326\251\221"
+	.ascii	"\343Q\321C15K\204+z\367\266P\026\275z]*\212^\275\026~\307\026"
+	.ascii	"vu)\335\272\b\303\f\217+n\274\233D\177\376\323\334Y\337\271~"
+	.ascii	">\237RN\2300.O\035\367\303\207V\2422\321Fh0\034\217\026\206\374"
+	.ascii	"\026h\032S\216\3444{\013\364N\231\352&\237\255O\263\035\243a"
+	.ascii	"=\253d\220$\030\030\272\325\247u,\331\372\226&l\321\216\214\356"
+	.ascii	"\212\335\224\2002.G\035\367\350\250\227\244\2729c\211\007\217"
+	.ascii	"\"\254@\317X;\222\3158\025\350]\003R\251\313\2132R\222\002\026"
+	.ascii	"\250\032hOs\231\020&ScLO\253\020s\344i\035\346\001\243\323\""
+	.ascii	"a\213vA\350\214\335L\026A\207\335\324\325\006%\227,~\016a\274"
+	.ascii	"d\021\035\206\325kY\245\217w<\025\215\313$\216kd\324NNE\031Z"
+	.ascii	"x\020\271\322\273\333\"\232@\313\260r$\327\321%\320k\205\304"
+	.ascii	"N\363\022(\376\223G\222b\274\\;\315jv=\370\352\231\327\2277\242"
+	.ascii	"\233q\333$\302\270\274t\334\242\2426\006\231\272\031CL\217\215"
+	.ascii	"\r\213@\307\300r$\307}A\240\027\013\016\037\n]\226\212|\264\261"
+	.ascii	"AD\033a\0354JJ\320\234&\256I\302pI%7\344\250q\362f_\225\204d"
+	.ascii	"\\\006q\\\"\242\216\n\201\004\003\310\335\232\272\340\026\321"
+	.ascii	"\003\032F\226#\231K\r\007\364f\001A\206\n[\007\r\023~K\222\265"
+	.ascii	"\261[\362\205d\f\001\201\254"
+	.ascii	"\250APB\225C2\"\"\"IR\220J\0071\006\204 Df\346\001\021\300(\204"
+	.ascii	"\264\202f4I\n\3319`D\031\t\223\355\322\377\301\3700\201R\001"
+	.ascii	"P]g\351\232N\210 \212\025\021\366\210\326\305H\233\t\221\256"
+	.ascii	"\217\2773\263\"\254\202l\332\205\260\210{Q\241\273\244\313\273"
+	.ascii	"\256\235M\020\356\024\267$\301\226A\305\304\323\2776k\230e\211"
+	.ascii	"<\264\261\247\327e\266Xp\222\260\252\230\263\213\0201\366\177"
+	.ascii	"\334\n\334\352\205\274"
+	.string	"\263\fM\344\366\325I&H\317_\336\020\f\023\323g\3068$v\266{\213\204\253f\225\201\217Q\002\270\335\252\003!\334\335/\2719\213\350\251\027!@\"=\352\033~:\372\336Kc\f\304,\231\t\220q\357\325h\363\357\237\320q\245\333B;/\221\034t\376\201q\234\330~3\022\007\271\322\214\311\363#\203'\361U\r\204%\366W\272\031)\356&\251\270\324\272\354\215\016#\226~\246\210h?B\310<\254\256\3142AuU\254\353|h\322\024Y8\252\260g\031\273\320\026\332\031\204\024\264\203N\021&6\375\016IZW\"\013V\254\367\005o\037\ndT_\030\r\324\256\270\374X\0369D\t\3348\027\244\255-\325\335\360\206B\204|m?\264\223\031:D\r\24624\300\275+\017R\r\021\035.a)\365KB\324\273\275\\\232%\204\345\024\314Z\204\030\003\222\020\346K\260\027\362\007M\220\345\356\233-\001L\311"
+	.ascii	"Dj\034\376\223I\247{\245I\224&a\200%\256g\333\227\223\322\270"
+	.ascii	"\021\301\3650b\3325\231*\217\370\261\300\304\375\217g6\266\236"
+	.ascii	"\343\342?\221-\342\225}\304"
+	.string	"\"p\223\302\232>\037b\f\021\301P\003\350y\351S\364L\002\303\037i\233#`HFw8\301o\202\200\001|\216\316\204\330\322B$\177\013A\303\177\203m\022\371\022\231\211\320-\202o\"\357\013\003\n\026\b\bBpK\026\202aY\210\312|V\365\272\3464\261<C\355\330AXj\251\030\211:\022\022\363\307\00733Kh\232cH\262\273&\204\226\260Z\007DcSE\b\243\211\236p\026+\270\231\273\214\301\251\350=\245w\0316t\213\275\242c\t:\363\203\344\377\327\226HG\234z\203\310H\300\266\231\374s\313\313? \277S\f\226\\\231\353\3145+\261\033Z\307E\321\356p\363\210=\336\201n\266\342,P\302g*\355\301\212\241\207\\\204\220\257\307\023\321\321[\025\332v\217'\242\243\267r=`\230\343:\370\t\367z\356(d \034\356\366\303pk\234\354\304\032\300f\002\215\305\375\2370\201\021 C\320"
+	.ascii	"\264\221\247\005\230\030<\363\013\251"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.135.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\255\001\r\020"
+	.string	"&]hF\360\222(\035\262\324$`\230\301\241\370u\270\344\203\n\314\300K\220!/\232r\367]\034Z\270\3139\240W\323\245\266\233\252=\ni\322\202[ok\023\331D\326\341@\371Bg\301\022\327\337\263\265\n\324\177\357-eJ\001S"
+	.string	"P"
+	.string	"W"
+	.string	"/\022\251\233\2359\247\266!,\265t\217\214p\265\344\327\034\256T8\235g\272\007*\313\004L\310K\301\0072np\374\273\252<N\245\310+\346\021\3460\344\271\300\2219\347\307;\351\376{\\u\262\316\213\271z\"\3149\255\235\367r\207\3346\312v\003\3736\002+\0273^\226\r:\354\226P\035\241\032B\365\256ZU\375P"
+	.string	"W\016\357\035\21599\314\200\314X|Q\342\260\333?\341\177\376\034\305S\224\016c\371|\231\357f^\256\035s~\013\036-\ny\034y\001\371\bO@>\376\343\222\255s\300e\232\034\004,\340*\020!\243\273\373T\020\271\f\256k`\245Z\201\002\302\351\354>t<\320\300\f\362K\262\271q\322\037\026Q\271\266\311\266\377.\240F\016N\354\264\246\3251\303\025c\267\205\"}\025\267A\361i\234\242\242\357\036}\025\371\270\"\003c\247G\213\316\354\317\244\333\262? \022N\266\021\364H\264\262\225T\030\221X(\321N(\220\230h#R\212&J\340\355\302\004\222\206a\333H\332\347\233_\226]\363o\310\221\305Z\226\363l\313\020\272\bZ"
+	.ascii	"#\324*\004 \016\347\234Sn\353,R.h5p\235\f\365\201\323\231\306"
+	.ascii	"\270-\336\361\200\273\033\367\251\016\001' @\002\243\220\252"
+	.ascii	"\033`\352\305\003\177O/\332\"&\325\257\217\271\264\0020\327\342"
+	.ascii	"\330\303\026K\260\240\344\022n\034\262\030\212\235\302\004\203"
+	.ascii	"-,!\020k\317\214>\253\232\r,k\305\213\235\202Z_\254\240\215\254"
+	.ascii	"\244\036\032\332B*\353\364\323Dw\f\205*R|\313\246eu\330\264o"
+	.ascii	"\022\314\023"
+	.text
+	.section	.gnu.lto_blackboxSetState.137.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`%\005\245\033"
+	.string	"Fm\243H\240\032U:\254\335P\023m0T\223\024o\366-\255\356\351\217,\216oJ\003V\254C+\316\300\377\177\370\355\304\326\316\241p\372T=\350f\314\320\220\3658\n\206\031/\316'\240H\026xal\023x22\261{\223\275\223\f\215"
+	.string	"\212"
+	.string	"\214"
+	.string	"\250\356~\355~\320}\234\027\312iS\316?T\212r\026.\350\225\371[\340)\374[>"
+	.string	"\376\355\263\373h\300N\2465\370\031iA\304\230sf\331\032?\1772\231%|K[\317\376\001\036\227\233\216\366S\271\003\3673\0310\313\004E&f\236%\327S\246p8n\327\221CkI\r>^\006_~\345\177\334\324\362\253B\346g\327s\313k\301bG\347\244\263a\323\256G\364\237\\O\251\226\034\344\234\273\336t\2737\352\335]\324\3356\3357@>c\221V\221M\264\353\r\331'}(\250\035<L\372MNH\237\222\376\022\023\215\317\310\217\034IY:\215\374\003\343+\322\037\262<\305!}\"\3659\370\227GJ\0200\347\356\007\351\356#3g\332g|\307\362\204A\300L##\3705-"
+	.ascii	"\036H2Z\327t\251v\2270Q\177\353"
+	.string	":\344\245\307\242\315\322\272\205\266j\201\272_f\333\353\276\320o\326\332eY\333\332\332\265\326\276\200\017@\334\013\335]\\\311\031\227T\223\323\333$GiJ\3051Hc\222\253\214\312\244x\365\356\n\027\323P\302\200y\016U\003\304r/\255.g\210\2562\212\222^\013d\273-\234\330\022\320\027\276\005\303\257\026\213\274!\245j\267\206\r\266\0342r\222\276\205\2739<m\245l\344\234m\372V~\245C\377\306o\273^/\374\273\002MR\360\376\224S\201\201\210\305\360\257\nt\214q\370:\364I\217\245\005\372\r\356G\271\224\233\376\215\026!\253\277\375\366e\370\367;\364\b\230T\253\311\276\220c\2370\034\027\016\206\023\260\021f\277V(d\036n^\256\020\036X#b.\021\254\327\254\004kE\240e$`3\026\216L6c\241\204\265\333^\233\304`Z\263\2666mWZ\255\345\234\301\263\307\331\003\377f\340%9\306"
+	.string	"r\025\361g\223\311\344\361T&\327 K[\016\021e\334\311UD\037\323\351\343]\2100\322\001\272\341\321|\200\255\235\t\371\242S\321\374\270\361\201\231\263\216M\337\314\317@\210 A\002\376\2656\005oHP\250\332\244\t\261\033\022\022\214B\254\332\353@\223A\264\350*\243t\250q@j\230r\204D\024$)(I\007\300\002\021)3\017\021 \265d\214FD\f\225\3663 \205\263\201Y\233\324\016\002\277\210\0273\244S8pX\2427\233H\372]C[v\032c\247i\331a'\360\242\332\370\355\017\f\357\222\370~\234\355\030\033>\270\356\023\320\013\267\270\231\3638\266\346\233_"
+	.string	"\316\225?\214\236O\006\002\217\332\277\357NN\2612\341\004\2514\232\340\363\332\316\007\364\207\030\364O\370\332\nvI\245H\323\251@&-\257\230\002\035\016\327$\264e\250\372uN2\236K\263\016\375a\372\311\253\376\260\243NvE\242"
+	.ascii	"i\355m\232\313t\263\001\265\274\247\316\321t\035\364\350~\375"
+	.ascii	"\224\311\246\254\251\211E\f[\221 \365nCN\201\251[?^\367?p\300"
+	.ascii	"\302ZE\264\2252\243FE \305\f\372\007"
+	.text
+	.section	.gnu.lto_writeAdaptiveSelectionFrame.138.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`W\001m\016"
+	.string	"\266\333`D"
+	.string	"\261&\035;\277\367)B\\\367\353O\0270vwp\2142\206\222\021\217\212\026\006\302p\036\202\317\355\332\2435#C\177\260\351h\f\262Qe\346.\375\277\253u7\304\n\253\3071\330\362\021g\255do)S\nL"
+	.string	"J"
+	.string	"N"
+	.string	"\236Q"
+	.ascii	"eI )\227\224\232\234\335\305\364\203\337\037w\277\034\035>\315"
+	.ascii	"\221?\363\207\332`D\215t\3708\272\324&@Cy\nN\253\356\334sE3\345"
+	.ascii	"\223i\271\236;Dm6"
+	.string	"Qky\002`\260\273\316\250\261\334\327m\233\330\306\354\307\0046GJ\205\351R\247\025\326\027\273s\325\3754\255\231\316\247\357\341\220\261A\373\251\265\313\241ecY\260\205\210\253n\177\204\317\331s\022\247\031]\345\233/\313^%'\005\202\306\356~\034\372\023\340\320\343\004\256\303\367\001\327\341=\0369W\221r\243\224-w\344\325\206\020\312\307T\007\036\236\"\003H\214\335}\264m\341(F\276\212\331\335\005'^C\342\2078tV\222\217\207~\211\236{\003\324\346\"v(eK\365\264\352d\324W\272\304}s\331\025.\344\243\021t,X'J\n\241\033\364\301\220\211\214\200B\"\210`\022B!$\030HD\001\373\034p6\341\201\b3\3112\021\346\341\366\3722\363\253t/X%5A\205qG\324\216*N~\374\351\312\323\323\230\3009\311\032\177\273\273/\301\237v\324\200i\263\321\340b\312\226\257T\365HU\r\034"
+	.ascii	"`\25173`\240c,\355@\323\266[\267\rlf\021\254\242b\202\023Fw\206"
+	.ascii	"\305\240\r\207\331\330\235{\246\200\025\224\262\316e\006Wq\216"
+	.ascii	"\022O\027gZ]yi\"p\214\3037\312^\261j<\240\210\230\256\371\004"
+	.text
+	.section	.gnu.lto_writeIntraframe.139.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\253\025}S"
+	.string	"\332\211 \036O0P\332\351\353\266\302\354\336n\r\\3\271\320o\327\3251\026\277nng\300\315q\025p\323;\236}\244A\372\023\271\006"
+	.string	"`\340\351y\235\3172\204\374}?\177>\222\037\307.r\3428\232%\244E')/;8\211\275\276>BV\266\224R\n\323\001\237\001\345\001C\325\371\255\263[\347\356+%\2258>'jh?\225^!\205`n\236\235Ck\277\356\276n\275n\267\03627s\373q\377\361q\204\031\246}7\206xHo\226\221\357\314\216MpDQ\013\037?\300\325'\270\307\215\327yk\3531]_\255\333>\216\250\245\320\345\336{@\261\355\320\260qT,xvw\311-v.$\301\324%\t\355\350\240\330\255@\305\316\n\235Y\364\253\n\236\034\fS\246Q"
+	.ascii	"\241\370p\331\272\367:\351'9Z\312]\247%\372\225\203\271\341\332"
+	.ascii	"\004\346#\357h)\177\326\025-Q\266{\357\261-\363\016\346c[d\277"
+	.ascii	"\361\221\233\255\333\326v\263B\336\275\333Y~jL\272\334+\005\321"
+	.ascii	"\226\233\212mY\332:j\333b\343\250mye\336\322\323\3436C"
+	.string	"\250\235a=\021\274\367.\237\214H\034\342\357\241\264\231\370k#\035\031\025\021\r\t\005\001\375(}\222=<;:9876\310\032\232\031\231\2431\246HT\355\360}\345&\216x\353\"/*qS)Y\315F\222\353#\271\024\334hJ\027M\221\342D\303\"\001\177o>\364\201\026\n-\364gylk\035h\241\320A\177M\2647$\212\233\003\265\365O\033\233+\233\264O\223\022<\271\326=kL\234\007\255w\320\316\\'I\347$1s\034\020\372\006\004$nS\326\310\262#^c\244i\214D}\006\254e\300\276\374\350\325F/\242\264!]\036C\324\201\026W\027\207\310![C'\036N4\206P\244U\"mi\262\236\307\254\036>\354\275\036\246q\3659\247R\262\212\364\017\225\272X\t\354\275!\\C\035!g\320~k\377\221\345t'\216\270\367\262C\263\264\232;4\263\3371s\tf\034\035\001kk\223"
+	.string	"8\350AH\003\312\274\266u\230\365\255\330\266x\357\375\367\341\373\202\002%\302\322\037\343'\225\305o\001\341\242\367\205/\006\036\216\003{'\251-\236\3057\326\226\323\013\007\0238\341\rm\333\342\033K\177\200{\002&\332\266\345L\242\003\237\\\004\267\rL\301\005\232\216\230Y\251m\375\223Y\\p\373\361~f\006\032\030j\032\332\313\023\267\031;p\342\204\332\266?\231\205kk\3079J3\235\312\234B\2057\224\223\372l\310\343\361Mf\346\245\006\2642\300\357\336K"
+	.ascii	"\267\f=\303\nn\263\266\034\201\004\336P\t\324\266$\236\030&\227"
+	.ascii	"\027m\233\273\362Bf\251\323\177\214\271\033N\320\310\223\337"
+	.ascii	"\003f\032\347n^\353\274Zg\246u\266\262\316\026X\347\035\326Y"
+	.ascii	"\207u\316a\235qX\347\033\326\331\206u\256a\235\253\2543\r\353"
+	.ascii	"Le\235gXg\031\326y\312:KY\347(\353\034\303:\3038:\277\200\352"
+	.ascii	"\276f\027\326\271\205ufA"
+	.string	"t^a\235UX\347\024\326\031\205u~2a\235K\264[3\211\366kvj\275\346e;7!\235\231\220\316K5\316 j\234\225j\234?\3248'\265\263\007\242s\007\2423\222\321\371\210\350lDt.2:\023\021\235\207\214\316B4\316A\326\031h\306\371g\306Y9\343\354ctN\3068\367\3108\363\3108\357Xg\235\243s\016\321\031G\306\371\206\350lc\235\221G\347\232\2433\315\321y&\306Y\306:\037\215\316\306\030\347\030\325\271Ht&\026\235U\242\263U\235\003u+Y\317+\305\222\340\375X\260\004\271\343-`a\307w\024%\217\225\036\256\002O!\224\210\217\0165\270\034\257C.\307\367\224\344\216\224\n\260<\312*d\347\225bfx=8\202\244\301!;I\275\3618N\270\361-\307\243\223\363:\253\017\217[7\310\371V\241\013o\320m\307\006\032\334P\215\267!\255\361]E\007\347\207\267\341<"
+	.ascii	"]-\254\271\345T!\321s\032_U\002\215o+87NB\005A|\311*\344\346"
+	.ascii	"\225be7@\211\334P\221"
+	.string	"\205\365\214\247R\233\361\275\202\215\315\232\345J\326\020d\374\2266\017@W\n\203nH\031A\304\364\212S/#\311\3247]\r\362\305#m\n\013\333\203Z\363/\236\035k\213\346g\276\346\223a\236J\234^\230\201\227\255\033\320|;\371s\363\017\234l\335`-\262r\255\\j\333\231W\335\272NX\333\242\221*\274\267\223\324\250\227\022\213\372\256\233q\362\241\214\021/\217\312\274R\314H\235L\f\302f\261\223T\030\037\303\013\306\267\013\307\037?\032\377\370-\327\344[+\230\001EV\262\020\306\357@\256\300\3019'g\352\230\260UL\203\2501\317`%\213y\245\030X\241\261\304\ra\303NR\237\276\204\017y\372\276\213)z\2202\007R\374~k\b\370\300\352\212?\3061]\252\211\267H\036D/\377\007S/\277\267\304\265\337{\233\304\037[\276\211\277\021\373\232\272\252\344\304$+\032\007\356c\r!\207W5\277`"
+	.ascii	"\342?\3005]\233C\340\f\032\265?\226C\243\370#@\276\204\251\370"
+	.ascii	"\024\217\302\237)\276C\331\326\212W\361\255\376R\257\370\326"
+	.ascii	"\3226m\013/nz\002\030\373\352\273\034\026a\316\362\355\367^\027"
+	.ascii	"c\210\373\342\362\214:{8\364\253\021\2749\254\002%r\344L\375"
+	.ascii	"\317\274\006UR5\246HPMUME\031qt\225\024\005TT5H\3240T\023\216"
+	.ascii	"\251\t`@\271\2101\301R\352\205\213\250%\024\025\215e\223\020"
+	.ascii	"O\311\240\200jY55E\265<J\257\372=(ni\222w\365N$\024wL,\215\302"
+	.ascii	"\026\022\216\032H\355f\237\t\314\304{\r\230z\305{y\210\340\327"
+	.ascii	"\372\f\230|00\247\323\346\267\t\355lK\004\243mnW\314?\225\037"
+	.ascii	"\203\027\302\374\223\201\t\b\250\266\325\341\005E\260\206\246"
+	.ascii	"\245\007\362?\230\236\337\307\005M\337O\021\356\324\245gJ\003"
+	.ascii	"\361K\257\364 >I\367\234\373\360J\337\003\370\2146\220\346+j"
+	.ascii	"\322\177\370~^q\376\025"
+	.string	"\363K\361\336\253\206\362\337o2\2710i`~\341f~Q\223\236\207\217\t\227\347\022\247\203q\3020N\343d\202\007\365\342\341\231\231\311q\260\33292\370O\240^n\260*z\240\207\3574/'\203sF\035\252<@\372\016\321\243G\362.\356e\005\023a\203\323\260\264m\217\276_\350\n38W\324\327-\214\245\353\367\005\\\277\237\020\375\030\037\221\bA\275E\022\264\324N.\336\351\312\360\336{\207\234\036\352w\342\316\246\317\250\222\033\025\375\320\033}\003>\225\020}\3217\026a\f+X\267\360\2676\273\n\321w\013\177sB?\364\275F}\272\202\025\320'\200\320\367_[/]\201\203\377\322{\233BA\357\342\035\013\026\241\002\316\314\034d\346\340\r\r\372\241T\206\272<\247\003\375<\320\267\3343\213\362}\376\347\373\251\304\251\347{\\\205\031\206\2510\025\265\255\362c\266\222\357\363D,\317.W^\350x+\330"
+	.ascii	"\314B\317\2626C$\277\247m\263t\325\2606\027\304$\241\223T\253"
+	.ascii	"g\336Y}C\001\362\260\356\261\213rz\201\244\250Q4f\225B32\"\""
+	.ascii	"\222$\005I\007!\006\204\030\205\n\253\003\021\320\240r\316\251"
+	.ascii	"\252\221$)\026\003\267\265\200V9\001\306\341\b\360\022\336\330"
+	.ascii	"#\032~_I\254\334\370"
+	.ascii	"=\220\236<z\205\246A\223\b\t\026\030R\214\214\327\212\b\253b"
+	.ascii	"v\367\320Z\235\0208<\261\023\214\300\"\355\207\207\340\2267\n"
+	.ascii	"\241\350\371\310\027\224\267\305\372\220\370ery\302\356E\307"
+	.ascii	"\267\336\352z\260\335X\275\360n\032~\245\332\357\351 \363Z\013"
+	.string	"\203\022d\227\241\375\354\025\360\230\034\351JC jF\004\2210\342\024\300|a\261\234\r\217\260V\267\245\344K\206\377U%8\316\215\262\344*\221\243\005\335\002\030)\347\f\016\0266!o\251\343\302\305r\340B\0173o\020#\237\230.,m\035\202\247\0256\005\213\223F}\323`q\257\277\373\247\337j\323\245zO\241\332\r R.\257\327H\007\200\313U\262\232\003/d\223e\270\367\017\212\034\207\2171\342\3606\247\032\3352\313p!7,S\312\177\037\257\236}\r\242\275\374\017\212>\316t(\003\257\344\321\007Dt\242\020V\377\211\034n[Yn|%\037u\246T\211\307a\265eV\2266\354r\337\360\236R\235\343\231\373\027\2350\261q\372O\344\260\332\244+K\331@\372\305\344\262\237<T\300\277_|\211\307BM\352\r\221\f^J^\n=\032\206\211\362\243\b\307\307\236\340\202\205q\273q\327\246)\241/"
+	.ascii	"\235=\246\201{[\276\212\003\336Yq\306\327\321\307W\001\226\020"
+	.ascii	"\f\327\364\206\337\002&>\2577\266p\326\223\367\211\346~z\240"
+	.ascii	"/\251W-,\200]X\251\315\212V%\217\315\rB\315\f\241\332\317v\036"
+	.ascii	"\215\360IA\312\330\251\364\325\006yiFo5\357|{\302\350\304\353"
+	.ascii	"_\033\3114@_=\3226\021dH\344\376~Nf\301i`6\017\325\322h\026\302"
+	.ascii	"\346\364\331\340Np\311\327/\233\232\240\\\216\2174)NJ\212\006"
+	.ascii	"\343\224\275\237\265\357d\237\242\363%\371^\310\003\006$\222"
+	.ascii	"0O7r\224\210\262\24499[\214W\367\250/0\346\236\224iq\302*\235"
+	.ascii	"\317\032\307\332\213\2634g\374\361\355\rm\003\315\244\300\252"
+	.ascii	"\256(\325[[*\213\003\226\213a P\037\"\345\370eo\262^\236\005"
+	.ascii	"\302)\004\303\020\264\013S\243\001%R<A\211\030L\202 J\3449\342"
+	.ascii	"\032\357-\257s\355'a\365dtD\332^\230\235\300\3525\365\032\262"
+	.ascii	"t\330\302\227\201Y\244\035\330\374\233YDs\310\254\324\312\317"
+	.ascii	"\264\300\330\337\325[\3472\254\325\004\331\017o\002\215SFqI\365"
+	.ascii	"nY\345E\242we\025W\251\376%\243\270\244z\277\246\254h\301\300"
+	.ascii	"\235 \032+\343V\371u\265X\006\211\216\235\260\341\267\002\377"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_blackboxWriteMainStateArrayUsingAveragePredictor.140.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`;\003U\027"
+	.string	"\026-\231I\300VQ:dc\3121\034n\037b\303J\245H>|\211\"\341\377)x\322\352\206\276\246\230\376\311\231\350\305\350s\213\374G0\213\3503\026\340\377-\344?\206\371Z\020\355\001\243\250\275M\253\211\251\372\352u#\204l\"wJ\001\202"
+	.string	"z"
+	.string	"\207"
+	.string	"\265\326\002\247^\020\236~d\333j\n\302S\177\332\177q\030\257\373x\347\231*\016M\226\243\326z\300/\341)\201\263|\247\336\001|\247~\331A\250X\205!\350\021\241a\306\222ZkjG\030,\313\262\274g\273\275\371:\365v\276\374\030\367h.\200\310f\260S\017\214u8Q\232\305<\230!!\335q\2379\263\233\351\251\370\360=\356\224V3\"\233}\370\004\023\324Z=e3\017\367w\333\027l\307\330\273\n:\233Y\3326\330\\\036\3730$\206\204\274;\266\313\177n\324m\177"
+	.ascii	"o\272\345>?"
+	.string	"\313o\367\351\323+\2376\201\323*\337t\351\323\244O\247\200\323\243o\032\345\323\"p:\374\246A:\375\321i\272\323\336N\2577=w\372\002HADf\257\345j\355P6\251A\250\016\305\177\376\233\375\031~\316\243\237\f\034vzP4\b/\303\307ytj\373\346\335\253\207\372\rKzL\b\005,\216\343\244E\355\004\"k)+Z\322zNH\235\321\246H\030y\213\2624I\270\242\375w5\254\260\204\337\372N\303}\016\210\226\335\005E$\213o\347\266\254'\2513o\037\037\335oO\256\270\231\245OK\367\271\307\b\251\225\2739\036\261\331>\307u:\346\275\373\004\354z\350\016\374\006\320\356\221\204\330\265\320\261\354\334YD\303\023\233Y\032\270\r\fa\255\025\306\247\361\032\023\374\022\247\256 \316\313\304\357\364\373#!v0\t\243\350R\261\036\254\306\032\021\353.\032\013\242\212b\030EW\213\305\200\246\201k\325\202"
+	.string	"\301\3018\312\234\254z\271 \316LP\311P\230I\321\260d*\244Tc+\3652\300b\315jL\271DqL\215l\365\273\023\343\337\020\244$\210\315\336\320\345\261\b\304\272\354\016\231\005~\332\234"
+	.ascii	"{\332\373\334~\340\314\241{\265\326\352-\317i]\366\270\307\320"
+	.ascii	"jFH\235\322\\Y{\025a^f\0028\0133jM\273\262\007\"S\250\254iF\345"
+	.ascii	"[\332\223\020\0278\3109 \200\002\231B\242\007\340\353\305\002"
+	.ascii	"\377\356@\353@\345[\253\247\221B\032\034c\357\037\311\006\326"
+	.ascii	"eD\371>Z$5\3575\224\035\315A2\263\331\020k\274\251\315\347'F"
+	.ascii	"[\267\367d.l\375\261\r=Z\254\260\245\372\005\353\213\202\357"
+	.ascii	"\244\350\366\030\331\315\360\325.\374\310\336?vL\351e\367R\351"
+	.ascii	"]\304\304\357\201\032\356\222\310\204\375\220j\224\306\365u\031"
+	.ascii	"1_\007\246\274\367\022Y\344\205\3056\0360\021\323\325\237"
+	.text
+	.section	.gnu.lto_blackboxWriteNoisyMainStateArray.141.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`N\001%\016"
+	.string	"\026\332]D"
+	.string	"\221(\0358\323\302\236u??\200\272B\007_\033Q&q\212{\350\277\330\"\207\035\2702\376\370\266\227\017[oc\r\026\3618V$\350\277\026\345a\360\017)\f\267\313q\350\245\320\346\177@>\221{\313\224\002H"
+	.string	"I"
+	.string	"H"
+	.ascii	"W\220#\300\256\361\007\260\253K6\216\004)k\022Y\261\312\360\""
+	.ascii	"\263\273\032,\361\3225\302,\371\232\221\017\225g\272\002\360"
+	.ascii	"T\0363\225\303\001"
+	.string	"^*\202\354\356[<5x\250L\315\310\356:U\236\207\033\273\355\t\266#\330'\021\307\376\375\032\323\361C\200\216\r\336Y\354\330\3550\323c]\032\003\205\355\373/o\221\356\302\fVhl\2566\311\336\\\277\261]f8\310\3172N\304\354n\210E\262\253\237\366[\276*\235\205!\026\330\224\210\225\230\335/\304\234,\n3h\177L\362*+4%\264\002,\302\017\034^5r\330\270\221J\036~\313'\207\301e\273\251\006>\314_X\360M\\\035\032\345U#\354\255g\213\n\231\020+\326)g\354\017\225p\204\375\270\273k\310b\237\365gwy\"\320\210\333\224\324q\242\320\347\001\b\202\310\023*)\221\320u\035\003(#\256\243\240\3368\0278\022\223\255S\201D\003}:'\332\326\2054\316\002s(\236N\023q\\\247m\276\323\343B\026g\257\024\256\023D)\201\304\240B{\363\034\346\005\302\225b\212\0012\037"
+	.string	"`\2517\023\372\232b\210\030\254\364\366\202FI\255\002\"N\224,\270\003c^\230h\230\021\244\255\225\237Y\013\260,p\227\331AcO,\022\035\356"
+	.string	"s 30\002\302\r\252\006\001u0\270\366"
+	.ascii	"\226\246\232\036\n\311\326\2262"
+	.text
+	.section	.gnu.lto_writeInterframe.142.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\214\035\345v"
+	.string	"*\301L*K P[\031\016:@\215\364\034\273P\365\222\344\251\022d!\241\025\237m(\200\211V\003"
+	.string	"\277kM\272\016\004\026\355i\264*\276\353XPU\200 \020\020\313d\373=t\032\333.I\356\377\250\347\336\375\377P\265hh\023\262\267\224I\006\215\002l\002\221\002\274EB\274DB\274\305\224w\210\310+D\344M\233\227H\344\035\022yQ\"\357\331\274M\344\345\346\375\265H\001\036\373\312x\201\323~nk\222A5\254|\250\235\226\027\376~~>\377\236?\317\337\366\223\371\315\374q\277\334\207v\277\373?{@[,\334\273\251#n+\331\320\033\336\037\230?I\302\r`"
+	.string	"\365~\272\246\276\334\326$\304)x|`\376\254\253\233\007i\237-\336\021\334b\236?ll\201z6\307\031]\013\200[\314#B\223\315\314+\235\001J\220\235\2752\2779m\350\340\351\003,\213\023\325\247\315\236\337\234<)3ep\360\270\301\363\207\r\225\273\265\345\331\272\256v\207A\310\351\366y\370\226gBv_\3675\273\305\375\340t\333d\200X\226`\326u-\036\335\375`\267xT\351b\376\3663W\363\271-\312\021aqD\022\303\013\336\332\272\272]\220\242y\032\365qD\220V9\353\311\376\274\344\005\256\253[\004\351\321uK\313\034N\275\231\"\347\212\346\364R\270v#=\312Sn\037\243\236\214\221\262>^"
+	.string	"\005\256\253\222\026\351\321\257H{0\017\243\276m\357\276.Y\217d\016\033]\340\272\256YG\267Dzt\352K\303\243\3477\f\217\252\273\200Na\353\227"
+	.string	"^\336$\341\376\254\353\312\325U\316\363\274\352n\246\363<\267\266\177\272}\211\250z\022#\260\256\254\262DT\205"
+	.ascii	"A5\365\301\203T\024T\207'\247&\246%-\016\033\224\222\220\216"
+	.ascii	"\214\212\210\266\206\212)q\210\236\315\352\236\310\002\204\022"
+	.ascii	"\360\350\027G\366u\022o>\342\r\241\033\306j\003\210\216\257\352"
+	.ascii	"nU\367,\3027pX\304\334\253\346\3448\204\232\203P\023\307Ti>\225"
+	.ascii	"\006\r\177\020s\017b\332X*\314\243\302\200a\250/\357\360\305"
+	.ascii	"\005~b\273\3239\305vN\315\265\300M'\222\211,\314\244\366\245"
+	.ascii	"\203\251]\253\317\251\344(\321\202\307\034\260|\003\226+\254"
+	.ascii	"d\345I\347\224\225sj]\3274Fj\376\250\t\205\215\226/Z*\231\350"
+	.ascii	"$\252\323\345\311\345(9;O8\221\253s\301SqQ\362\204\267\210,R"
+	.ascii	"X\222\367!\316{\221J\312\022\263\247'\222\034%e\247\211#L\034"
+	.ascii	"\332\202\302\207M\216\032\221!\213da|\036\360'\227\263\2717\277"
+	.ascii	"82\024\336'\211\300\027\374\\\216\022\263s)\211\232\330\347\316"
+	.ascii	"cdGf\"\213u]\227\305\310\226|K|\267\217\273\213d\267\203\220"
+	.ascii	"sIA\034b\364Q\037\360\351\235\2674~\310\345\221\316\232\222."
+	.ascii	"g\026W]Q\263\b\232\361\035)j\243+V\214\232Z\270\212ZQ\357\350"
+	.ascii	"C\343w\305[\267jvQW8\032=\201\370\302\372k\253x\353\305&\352"
+	.ascii	"\323\375\214\312\326\364\367E\rs\"J\262\277v\031-\312\032Q\243"
+	.ascii	"\203bM\300\226\033\210\355\252bX\331\342\3502\022\243Z\261w\364"
+	.ascii	"\211\321#\326\204\212\316\032Y7sm\f\347\316e$\f\372\342\323w"
+	.ascii	"\347\b\003Z>\326\020I?Yv\3442vbc\217e]\274\340\213\275\030\036"
+	.ascii	"\275X\177\206\217\030\003W\3032LY\024\017\365\256\214\031SB="
+	.ascii	"\324[IAi\017[\250\241\006\221K&\034\244\375\3014&c\023\226\360"
+	.ascii	"Qb_\217\035;\264\271\207M\f\204\\;\362\240\345\333\030\236\215"
+	.ascii	"\266S\036\222\313\261\204!g\237\215\235\021\306\272/C\232]\r"
+	.ascii	"\026\301F\272\256+\212e$!\340H\261\020\031"
+	.string	"\036\345V\221\326\306H\"i\330\373o\314\b\231x\327|\357\206\273\017D\300\027[,=b\370\216\364\327\026\177\021Q\321\3445\203\3662\003,\324\272 \"+\376\326u%`_\303\003I\260\307rt'\240\200/F\301\360(\006MD\323\013\\\206\261\003\343A\273nGnf\235.N\326lS\331-\342\275Z\026,W\254\2445\253\244\300\2442E\nZ\224CY*\317\314\276\347\373'g2\344\375\tbHR\336\207\035\214\310\373/\225\310k4R\204\310\013\302\020\"\257W\027\221\267\203\307}3\270\334\027\203\027~s\334\317\027\307\371|o\330p\240\006\215\267}g\274\355\333\300\367|e<\3177\306\367|\031\030\362\302@\342}\321\274\013\034\361\2728\342U\300\210\267\205\021/\013#\336\004\214x\021h\336\025\315\253\"\345= \3455\240\310[@\312K@\2217E\312\213\242\210w\200\224W\200\224\367\004\021o"
+	.string	")/"
+	.ascii	"D\274&R^\256\224\267D\312\273\225\362j\245\274YE^\022)\357\210"
+	.ascii	"\"/V\312{\225\362Z\245\274\"R\336\252\2247\004\021/\210\224\227"
+	.ascii	"\212\210w*\345\375\220\362z(\362J\245\274QE^\250\224\267C\312"
+	.ascii	"\373T\344uJy\233\212\274LB\274KB\274\034R\336\r)\257R\312\233"
+	.ascii	"4\304\213\224\362\036\t\361\032\t\005uNj\357\331T\243\035\230"
+	.ascii	"\322\36755\245\237\367\3045\247Do5W;\315\325h\225P\255D\277\316"
+	.ascii	"N\033\330\030\017\256m\241zg\201\330\234\232\271\313D\243\367"
+	.ascii	"\3440\243kHiCc)\375\275\246%#\275\224T\252ie\375F\217\275\317"
+	.ascii	"_%\251l[*\322{j\315h\0327\344\352t\211\302\324\314\033m\244\225"
+	.ascii	"\246\320\261A.\353,\241wY=\242\265\332)\020\215.\322\347 rI\242"
+	.ascii	"\263\366\250\312\353\005\252Id \321\327\263c\207\325#\364\030"
+	.ascii	"PU\036\216\004\316\243&Y\201\325\357s\030M\316\006\013\373N\344"
+	.ascii	"\352\264\260\244\325T\366s?3i\246\267aH\357\251\324@\317@s\001"
+	.ascii	"\355h\3758\034\256\372\216U\213\350\253~\202\323z\003=\244\317"
+	.ascii	";\344\362hGeZ\365\331\244\265\221\261\237\312\024\321\327;\003"
+	.ascii	"\334\320\314\025\2214[&i\235\350\214\023@\244\2547\320cQ\274"
+	.ascii	"\244Q\372}G\313\316\224\035\225\252\372\034\024\023\f\321T]\325"
+	.ascii	"O\203\3105\020\035\242\337\007\242\257\2276\325T\215\302\251"
+	.ascii	"&p\034\225I:\205\247\260\r\214\007\235p\"\367\227\264d\341k]"
+	.ascii	"\2175\\\352)\373t\220\336T\024\37009\372\031\027\264\364X\303"
+	.ascii	"377\353\373\0319\031\304w\244\277\212:(A\313\230\363XC\257\356"
+	.ascii	" \006\257\276\035\242f\356\005\177\365f\350Oz\317\"\003-\243"
+	.ascii	"\307vwO\031\375\266\377\\\327u\335\222\321\177\322GS\324\324"
+	.ascii	"!\227\037\336TfS{\350\250\376\320\304;\251\366\260FU\376\256"
+	.ascii	"N\256)\325\277\203\352\2509U\231\242i\306r%\240\372xgy\205v\035"
+	.ascii	"\372gT\346\021\347\211\t>uSw\350a\036r\315\251\237\322\250\312"
+	.ascii	"\3235\321\250he\234\372tivL\335\324O\n\302\303fT%\027\024\206"
+	.ascii	"S\321\254\232L\375\266\263<\266n'ru\266\f5s\231\263~\301?I\022"
+	.ascii	"\205e\232u\006zl_\274\343\013\343\320Kb\332\226\300L\341/\034"
+	.ascii	"\322\276\276\270\272\264\231+\364d\330\325\250\225\316z\214\036"
+	.ascii	"{\214>\340\333\237d\342V\206\330\314\030\335\325JS\322\354\361"
+	.ascii	"0\2127(uRoh\236C\256\035[P\231\337kz\371\335\237R\177/\315\b"
+	.ascii	"\310+\250\314\227Y\265\n\253\220\242\231\324\303%gt\205v.$\201"
+	.ascii	"\001m\346\232\035\004n\226P\345_ml\020"
+	.string	"\270\030\333*\255\354\253\217\324Z\177X?\360(\227\262\2757?35\0345Rs=~\001\017\f~\350\310\300\305\016\036>xt!\r\271\327\017\036A\202\bqq\344\325\245\203\006\321\005\303.\035^>x,\340\365\243\007\020\016\274xt\031y\375\020\002\304\305\005>x\364\200\341C\307\017 =\2748"
+	.ascii	"\242\264;J\f\001b\201\006;t\370\260\200\353G\017\035\033p\355"
+	.ascii	"\b\322\305U\342\303\002\341\200G\020./ @\202p\025\335\300\236"
+	.ascii	"\022\262\361\201\365q\215\220\371\003\311\360\240-r\256\253\224"
+	.ascii	"\004\346\236\024H\206\204\004u\306\027\b\237\364G\330\205\017"
+	.ascii	"I\260\215\b#\316+\034}(=6\367C\t1\006\260\357\r\253\231[\024"
+	.ascii	"gu&\275\224d\323\313\312z\216\036;\240\013\375\371B\227\254\263"
+	.ascii	"\202\321'|\332\347\213\\\262.k\3375\304\321cv\317\301\353\272"
+	.ascii	"~]\345\3503i\250#\236\036\344\362\204\306\3210\272\007\223'@"
+	.ascii	"\300/z\327xgdsBO\035i5\025T\375\275\3518\243\233\3435\217n\243"
+	.ascii	"\3514F8y\306\275\275\341\321\027}@G\227(\375\216~qM\312"
+	.string	"\254\262.5\274\232`\2345k\214\323p\306\276t]\217\240\330~\3532F:~F;v\206G\257\326_s\006\303\302\237e\2306\260\256\341\266\230v\3532\316`\314\223gx\024\004\345\234?}\026\3500`z\333\005\266\005\372H\025\340\f\025h\027\375\024\b\311\245E+\320,\272E?\335!\355\022h\026\355\224\007\271<\216\360\305\033\"\320\t\364\221x\307\356b\344\223\256+\330\305\266\2674\027\243\236]\343\036#\037#\237!\002\335\324\007g\020\222\205\025\255EM\253\261\\Y\261\307\246\242;\215\bS\263\233pb\202\235B3U\364\271(\365\nE\034`@\023\320\007\364\347\nh\003\244\250\312\3275\321\214\204g\376\n\350\327\245h\002Z\331PT%\212?\343`/\215\204\\(\232\242\377F\211W\225\005p\335\262<\301\322\207!\004\212\3366\215\354\257\035\240Q4\321\033\2353\202\\\360\256\221\006c \276\330"
+	.string	"\375:gVXS\030x\004\321\314\2752\303\261\206WL\260\322\277\243b\273\363\361|7\225v\007\r)\255\204f\237\315\207\270\213\361\320\314\255\3427\246\n\222\024\372n\244X\360\326\267\314\325\257\341\256zT\303\374\260\361!\243\232\271E\257\303\301z\317'\007\332F\2171\353\304A:\326\220\331`T\372pl\264\207\244\272\202\237-|a\375\005%@\3139\321"
+	.string	"\264"
+	.string	"\375\004\347@\037,\200>\321\017\024@\237\215\211\006@\004\246Ae\262f\242\001 \303\243\3022L\207f\0165\331"
+	.string	"%\003\202\\\250\242@-\022R\247\234\031\021\031\221&IZ\003\302\013\020\206\202QJ1\355\022\340\3630\314\303\3161d\"IA\223\266\003\316\003\303\nc\"_\264\320@*M\177_&\347rb\231N{\253Ti#h3#\271\337E\346\211\031I\027\243\263q\200\006\303\362\341\201c\371\016s\305\005\276\360\364\212\354\365\325\\\203\305\003\212\276\035\217-\006VK\201\207\264?\254\2570\364|`A\303\313&\\\356X \214[\023\030\fr%\\H\266#\032\244\026\321>wP\3179\325T!\026\206.\324\267R\341\377\276}Z\257b\234&EMc\205&FH\332\344\016t\023A\023\232\355\334\224"
+	.string	"\220\214\350\207<\306f\226m\007\216\373\311T\241%\016B\301\036\305\004\264\2636\320\374\252tPy\250h\004|tg\254t\206\362\017\336\367U8t\035\\6\246B\373\001\341\326\313\215\034\350^N\370\256\221\305\341\\\023\232)\343D\200\262\370\241\026\3351\303l\f\256\305\302\214\023\023B\376\331*\032\341\252\034\204,\305 \020\366\201,n\003Fo\274\207\033Z\304\344\253 \242W\207'\316\365\256V\013\317\037"
+	.string	"3\350\227\003\333\t\017@\360\313vu\002\263\036:\346\227\036=\301\200\252_\2779\346A\002\253Myx\031\025\027\210\363\277I\031\343\235)[`_\220\311\020!, \223\016\006\302\314UCL\300x\352j\307/45?C`\235\247\016\353\367\370b\343\202\364E\202\213\2470\341\201\354n\234\373\2652\343\304tX'\357\304\334\2701i\214\030y\353\343\001b=e\\\210-\244\001\220\344\210<O\022\026l\376\034E\2052S3"
+	.ascii	"\b$8O\354\221QT\301fZ\036\023\213\350\333\300\020\240^\320\231"
+	.ascii	"\r]0|\332\236.\217??\325d\\\2561\0363\017\273\203v\035\270$G"
+	.ascii	"\245\201\204\205\260E0\210\244h\267]4\001\352\315\237\310\016"
+	.ascii	"Z\352[\350\003\270\027\023\270\240\007( g\374\033\311\342\020"
+	.ascii	"<\033/\261\013\020w\026\255\021\201\3436R\016qpiS\371\371\302"
+	.ascii	"\223\037Z\271 Wn\264\351\317\347t\b\344M4\2275\"\323e\013R\231"
+	.ascii	"'\r\201\376\031\2444`\350\262\313\266c\b\337\f5\344\032U\355"
+	.ascii	"\300|\3171\235\241\342[\324_\310Bd2[+w\361\344\227\360\336b\306"
+	.ascii	"\363[\020\245Z\335\247z\376\270\307\3615\342\210\346\274\310"
+	.ascii	"\373P\027G\307\004C>~#<:\f\270\301fk\204\204h\325\203iP&\347"
+	.ascii	"\\_\262\323i\bs\302\244\275@q\bT\317d\373'\217\257\322\322\371"
+	.ascii	"\362\320\325_\274w\377O@G\332\003\025L\314\031\202\360\031\t"
+	.ascii	"\230\347NP6\001Y\201duW\265\346\005\370\256o\332C\362\217\346"
+	.ascii	"o(\267U+\354f*\254\020\261\237\236\234\261\007`X\376om\023\362"
+	.ascii	"\262\020\250\270\2553\201\2278xp\017\311\030\277\357\025?b\024"
+	.ascii	"\022f\362/\003\335\220\376\3110\233\2174H\036\020~\037\316\373"
+	.ascii	"\236E\202GN\271\200\332\311\2275\200\002\212)\222z\300N\215/"
+	.ascii	"\242\001\346\"\265t:6\333Q*\256\372f\266\264\264\025\2735\270"
+	.ascii	"\352)\353\263\242\212\200\324/\301\341%\3146\336q@\003\024L\317"
+	.ascii	"\350\334U\342\221;\267\210l\351b\016\344z\320\322\333\222;\324"
+	.ascii	"/\351\355\234\234\0139<\264\224_\265H\005[I\025L\217\2172G\207"
+	.ascii	"\031r~[<\326\356\0277\2351\257\327\230\367{\246!\311\236%\021"
+	.ascii	"lN\273\262SL\242D}3\212\001xk\237\367\030\217\020\342*\254\245"
+	.ascii	"\305\003P\221\003\340DI\326\225\233}?O&QR\016?[\344\245\233\366"
+	.ascii	"\257,QVY\230\314s\337\031\261\032Oh,\305\251f\366\017c\245\\"
+	.ascii	"K\202\365B\023\005~dP=$d\361j\246\327|Q\271\201\307\256\360\331"
+	.ascii	"\022s\f\364\001\241\032\345\016X\331\355\330,:\231H>\300x\326"
+	.ascii	"C~\201\304LP\272\3601c\"|yI\365E2\301\212\372\321\216\252yT\306"
+	.ascii	"\370\360\243\215\2705\341\314\034\260\032\303bz9\007\t5u\210"
+	.ascii	"o\361\2346"
+	.text
+	.section	.gnu.lto_writeSlowFrame.143.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\375\001\r\020"
+	.string	"\366\234fF\320TQ:\353\242i"
+	.string	"\354\302\030 \230."
+	.string	"\214\221O\372\rC\025.\323\002\316E\321VnR\201F!\326S\\\327\347x\026\346\031\352-\365`\256\331\305\240%\340P\342k\325\262\351\340\223\366\207\2154\262\267\224)\005N"
+	.string	"J"
+	.string	"W"
+	.string	"9^\034\366\333\177\314$>\214\307`\035\366\002w\007\342\004\261\331=Q\362\350\021\367\350\357\006\266G"
+	.ascii	"'\260=\232e\0139Pb['8=1:>\273\333i\213\263\236,\377\261\213<"
+	.ascii	"W\353\031\232\260\273N\317\205\342\326\333n`\373\304N\231y\357"
+	.ascii	"\321?m\217\327\0044\0250\230\254\231K\353\270g\233\rB\225\367"
+	.ascii	"\354\200\326\343#\241-[\326Jea\037\356\356Zil\230\026\3054\007"
+	.ascii	"\323\241\230\336`:j\032fZ5\235\231~\001\0013<\256\003\261\261"
+	.ascii	"k\242vd\277\030@\030>\333\301\351\352U\273\t\231l\032\322m\226"
+	.ascii	"\3418\\nl?\260\250\266\037<\226\022\240gw#\034\310#\0025\352"
+	.ascii	"5\274\006\017\324\325+\350FSUMb\202\354\r\247\301a'\3656/\332"
+	.ascii	"\317\200\274\332\244\022\003\233\256\323\201\333]\b\376\214\347"
+	.ascii	"\254\3705\217f9\005*\223K\013I\304\346\322h\205Ra)\221ZT:\017"
+	.ascii	"+\244SWJ\251\272\321\002\243>\230R]\b\024*\325\221\310\366p\225"
+	.ascii	"\2063\222\342\203\321\021~\201\2733\022\206\310\310\232K\356"
+	.ascii	"\373\370\217\024\277\306\024PPdV\344\370\024A\220\227=VA\201"
+	.ascii	"\013\317\266p\241\366\211\224G>r*\322-+ \320\002\221\031\\\007"
+	.ascii	"\340\326\033CG\030\330\221<\225Dl\210\\\naL3\314\016\024\261"
+	.ascii	"z\221\006\377-P\235\002\023Y\t3\001'%2\266\273,r\006\354iB/i"
+	.ascii	"\f\"\234a\\\3350Y\357\347\202\005B\326\356M\\L\203\025h\327/"
+	.ascii	"\215\200\260Q0$\3617\032\357\234\3762\246-@\231\027m&\003"
+	.text
+	.section	.gnu.lto_loadSlowState.144.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`H\001-\r"
+	.string	"\026YXC"
+	.string	"\2216\035\273\324\327/l\317\031E\021$f8\214=\020\372\221i\007\262<Bi\260\264\310\016\302\243%tP\204;\003+<\324\270D\222C\263\005"
+	.string	"\005\b\321"
+	.string	" \257\211\026\354\377\322\363Fdo)S\nD"
+	.string	"A"
+	.string	"G"
+	.string	"\376\211\223\264\243\210\\\263;zq\261\353!0\247z\264\367\r\365X}"
+	.string	"\365h\315\216A`\303n\nH%$*3v\327R\223kO\315?\212\003\340D\333s\203\301\356:9Q\207[o\333\200\355\004\366a\004\335=\354\302\201\021\273\241s\217>H\037\342\304\302\341C(cloK\025a\037\356\356ZGvLWG\371)\230\2160\r3\255\232\316L_#\300dE\364\323\212\335\222\030\032k\212-$2\266\237\016'\252\266\204\257\244\252j\211\244\206&m\n\235<\227\252._\t\323\210n\276\332\327[tT\273\273\300g\221q\004x\351D8\030\225\253\350\360;{|\362C=^'\200(\235T\352\247d ~\227'\017Oy\212\f~!\330\007\b\372\342h\300<\237\253\363\341\261*xt@\254+\003Y\234\002\306,pd\026\006\f\313\254\214\267\207\253#W\037\311\024\322\021G\265\033\274\005\226\034D\205.\237\t\250\366\203\263\204\350\013\016f\2236\204\by\016\252\312\370\002\033"
+	.string	"`\251'\023Z\373\002\303\005\013P\004\300"
+	.ascii	"\203@\210Ze\006\242\302\265E\370\260\204\342\370\032\205b\205"
+	.ascii	"\200\270A\005l\325\360[\rB\363>K{D\230\245\036 \270\330\320\254"
+	.ascii	"\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.145.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\342\002-\025"
+	.string	"\226\245\205J\320\320*\035`\004\334\230\325\350\025d\356\203=\252\005cc\205\215\204E\007\335$\332\350Uc\341Y\371\201\323K\2665\216\257\251\331;\301W\303z\235m\017\304RO;\242\341\362c\024\230\264\314\207F\224\205,k\204\020B\344N)r"
+	.string	"i"
+	.string	"p"
+	.string	"\027o\317\370:\237\236\203\215\230g\305\031{n\f\345J.\332\244\274\350\005\ff\f;@c\036\215\350>\330\b\355\250\365D\255\207\303n*\311Q\f\227\302|\362\004\202,\007\220f3o\332y\031\243\266C\002\242v\243\344H\302\223s\273X\323\243\241\341\207M\347\033b\233\205#\265\326\353Nol2J\311\223Z\253)\315\226s\177\334\366\006\333\017l\212\024;Y\211\026]\323\203.\204\301\377\361\013\f=\355\242\0173^\374\202\350H\222\301Aw\213\321%\3734\351\342\354\207u;\330\"!\265\351\271\233\\\352]j\272\324\027\200"
+	.string	"(+\n\322\001\355\214\263\342,\365\250?\221\b\350\274?wj\337\376\316\357\371\344\223\3709s\236\314kM\275\rI\2673\252\265\326\340|\201\361b\371\001c!5V\234E\214\377\243\300\247\326Ja\274hZ\262\007\007\360F\303\305\305\271\344\273.\237\215\031Ur"
+	.string	"Z\336.\306\373\256\202(\245\242\247\355\236FP\347W\263\246\357=VI\353\275\f\326B\020\372\335Q\260\312Zc&~B\306\377\271h\025\026k\274h\257\264\320\323\374!%\036\277\331\232\264\326j\356\342\326L\002\372`\314\250\222\351~\311}\n\233\253W\352\205\022\323bA\211Y\271"
+	.ascii	"X\275X\256\b\025X`Z\026^NV\231dh\245\254\250R,)(\027V\252\005"
+	.ascii	"\245r\275\240L\022\270ua\345B\275Z-\027\352t\326\227?ltH\376"
+	.ascii	"\305E\366\306\266\310\376\027\034\361\213\255,4\021\240\266\204"
+	.ascii	"\tA\021?\331Y\253Y.\316\260\221\334\033N\b\336Q\321\222\243L"
+	.ascii	"X+\217\203\363~\243\036]\262i[\250\260\f\370\324\032\013? \240"
+	.ascii	"\002\031A[\007\240\365>\003\316\260e\030\330\223\354\246\265"
+	.ascii	"\"L\342\226p\0242\344\242D\215\016\270\273%,\016\317\026\263"
+	.ascii	"i\r\\\002\200&\244\3056\224f`M\013\307ytc(\b\243\241m\334\273"
+	.ascii	"\034\210\257\312\305K]\020\013\205&Y\"\231\303@\305\311\333\242"
+	.ascii	"\016\336Z\003qM)\3552x\370\370x\356\341\016\024\304i\300\202"
+	.ascii	"\021\26760e\372c\0057\337\227\032\007z\031\354\030\017\244^\313"
+	.ascii	"-\0305\037\303\0167\362\336\326v="
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.146.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"]\n"
+	.string	"\346\222F?0\247*\035Xh\357\370\367.\017E~\236\350=\301\376l\377\203\\\372\236'G\n\215h\306a\316?\252XY\252g\242f\267p\253\227\222\002\256\223bV\203\361 >\340\255\370\033\331{\313\224\0024"
+	.string	"2"
+	.string	"3"
+	.string	"\245\001\262\335\335b\312E\227QE\376UG\360\276\221\313\204\317\364(\031@\003&\314G\222\020\260\023\005\n_\247j\231\330]\253\367\225\334\363\266)lG\330w\bQ\004d\320\2005\322\320nu\032Q\354\313\335]\307\223\255\352\251jy\365-\031\004\251\3571\002\273$\341\203}\315\002+\266\217\261\310\216\275\205\332\205U\202!m\306\253^\341:@R\007\316\204a8{H\223qF\r\3544\364\243\214\326\322\314\035\017\360\271\354\222$\374\325Y\037~\352\323  \275\367\351\203\264\317\007\356hB8\016Fg\223\301\3316.6\032[\307\363\3314\r\3468,<\233\007\307y6Lk\364x\362ef\362\032\305N\306s\232"
+	.string	"\356\001\265\273\256\003"
+	.string	"C\331\002U\361@X|\022"
+	.ascii	"`\251'3`\2363\360\300-\263\354k\3475,\003\341\252A\026\370\212"
+	.ascii	"cA4f\225\220Jlq\031\373e\bq\351b\266\023/L("
+	.text
+	.section	.gnu.lto_blackboxStart.148.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\265\001M\020"
+	.string	"\326\034iG"
+	.string	"\257(\035Cb9\n:r\372EF9\373\371o\021\353\033\013k\022l4\227\233\202c!\213\242#\213\301(\277m@q\372\354gw\354f\023\201\243\030\001\252"
+	.string	"\020\270Fl\2222q\017\023\377\304p#{\223-S\nW"
+	.string	"N"
+	.string	"V"
+	.string	"F\331/\004\230\324T\002\021\255\023\231[\255\325\223\034\216zG''\027\345\247\336yVN;Z6\263\0263\341\312'w\340\002\027\240\306b\373\353\213\022\232,\367\tU.\271\001\342\n\025P\270\342\f\324Xl\032!\270\333\205j\255^V\210\341\366\334\366g\033\201\275\031\001\364s\312\313\316\351\210890\325\216v\f\\\351\262\317U\331b\317u7\327\224[O\271~\006\352&\005%\274N\211ZS\306\030\2256Qx\260}?v\031\311a\374i\245\270\221\330\2179\254\3440\356h\331\204\250\265\202>\355\022\033\364\271\240\364r4s\241\2616\310\003\371\3277hvT\320@\231\342\344Kt\246T\240C\255\325\304A\210\343\355f_XbM~\204v\ff,V\253c"
+	.ascii	"\3438\356|\204R\331I*\202;zJ*\275';\2279\3442\"\236ZW\n\374\331"
+	.ascii	"G|\276\313\247'\234\366\254S&qT\370F!$\021\204\221\027\241$\022"
+	.ascii	"\361H\246\223\307A\300\237\004\020\223G\341\373L\036(\246\272"
+	.ascii	"lqH%\301\316\013^\017m\rNm\003\225.\017\352\323\274\306\303w"
+	.ascii	"q\203\217\217\017'lb\214\206\215\365a\016D{\226\017\373\207D"
+	.ascii	"\006Z\016\fP\246\376\302\022iS\272l!) @\002b\020c\017\340\324"
+	.ascii	"\223\004\254\0169x\311\364^\314\202\242\305\2131 \211\223p\365"
+	.ascii	"\274\374[\311\304\032\272vhh\360\254\250fsf/P#\354\305\274\356"
+	.ascii	"*Y\374\262]@\272$\222\366u_\347\226\325<rX\255A,\027DC\0132P"
+	.ascii	"\364\371\275\241\374xy8\034\202\274dt\253\361B\330\003"
+	.text
+	.section	.gnu.lto_blackboxFinish.149.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\007\002\325\020"
+	.string	"F^kF\360\220*\035\3324\034.\330\356k\326Y\237\336E\311\350\314\302\300\004o!'\343zq`\004gF\237w}Hm/\263:\376%\226\227KMd\361\2618\f(N\204#\263\302a\272\2655q\202\b=\366&[\246\024V"
+	.string	"W"
+	.string	"T"
+	.string	"\264\356\3226\261\273\313\355<\262o\007[t\300K\255 \233A)\375b\210\217>%\027w\344\377u\017T\212\364)\340\222\3039\216\300\254\203\354#u\302!(a{\035\374^H\2356\232Pf"
+	.string	"WM\304&u\212\313\301\241\224zQ\251\r7\307m\177l'\260\327\023\224\364\325I\246\330ZHP\017\024\304\300io\3307\361\230\310g\361\204\222=\252d^>.\bY+\027Ui\253\r\2326\202\260\037k\2555\216,;\256\347\256\345\256\277\361bb/B\026\026\"\f\220f\2505\250M\312\214\260}pC\232\325\312]\0163y\213\025\264\002\367\246\2143\036ee\332:#\343\301\037P\231\321t\353\177\346\353I\246\017\003E\330\243|\3309\247H\362an\016im\334Us\265\210\366c|\363f\252\356\242\251\342\264\257\360\315\243\251<6'\216\342)|\333\260\265Z\271\350\242y\271(\nr\231\355[\007\r\366\204P"
+	.ascii	"u>\036\021\007\235\357A\003\021\222\317\023\022}!\005\f\2020"
+	.ascii	"\022\372$\200@\241\257\003K\347hd\275\376\224\017/\266R4\371"
+	.ascii	"\263\233\303QJ\351\374X{\204A\f\377\32770*`M\214\255\271j,\262"
+	.ascii	"\333\313\334\003e$9\3240\203\201\2737g\354\304\\\234,\r\003\250"
+	.ascii	"\265\312\b. \200\002\031\302\253\003\340\353I\017\275\246\200"
+	.ascii	"\355\032\013*\360+<\273\246\254\037\225\217Wl\267\005\207\255"
+	.ascii	"\250\3779\020n\200\344\207\003\346{\227\327{\231\027\357\021"
+	.ascii	"R;d;\004vg4>\rTxEl#\326|\2644\210u\341`U\r\201\214\331\bb\211"
+	.ascii	"h5I\330\214\003\313\343vA\334\013\3129\276\243\177\031\232E\227"
+	.ascii	"\275'"
+	.text
+	.section	.gnu.lto_startInTestMode.151.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`g\001E\017"
+	.string	"\306\334gF\360\260(\035:\262\300\365C\3745{c\305{\260\253\263\320\206\213FSe?\323\367\345\033\3072\264\236Z\333'\023~-c\254\343\236\223o\374\006g\210|H\275-f\274b\251\275e)B\232\2542\023M6\221;\245V"
+	.string	"N"
+	.string	"S"
+	.string	" \252\r\033\320\310\254\314rv\327S\0207\235\233\233J\223\037@\f\317u\035>7\003+9d<D\325\226 '\254\351\210*r\333\026\270\330\264|Tm\037.^p:bJjGT\331\020\354\356_\227,\"J\312\216\317\356Z\256\304\326\335q\333#\266#\330\027\0214\227\031\017'Y\263G\224T\227\375m\025\306~\354\356TZ\245\364\001\374\245\205\305\322\372\252\266\313\252\341X\332\254\031\361\330\355\233\360\307\317\034fz,E\300\276\330\21384%f\354\216\f>\355\351>=\376\203\373\354N\200\373|\307&;F\253N?\276"
+	.string	"\215\0175h*\r\335B\305\"\261\251\313z\022\247\n\312`\244\344\215\253 u\273)\007>\212\247\370\374\230Oc(\225\270O\325\r!ll\300\344\356\206\252.\243p\327\220\354&%o\330?q\031\212\037\343\f'\362\253O\377D\377\272\202\326,&\3407\241\244$!\204\344\001\204\220\021\b\262P\002\261\310\243\341\013\215\210@\027B\036\211\b\210\344\211\300\222\3479\340\257d\004z&\337\007z\235\361t\205\361\347\244(n\200\264)\200\344W\376\353\037\224\206_\001\343\020\316\024\256\323y\232\311\220\335x\310\177\304}o\026\234]AD>\033"
+	.ascii	"5\263\007K=\231\001\353\034\242\365\022\336\3666C[ \212\304\n"
+	.ascii	"A\210xP8\016\267\357om\033\"{$\310\271`\3430L\b\256\211(\231"
+	.ascii	"\320\272\260\227U\226\227&\200\273W\205\320-a\\P\341\267\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_inMotorTestMode.153.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`y\001\215\017"
+	.string	"\326\\hF\340\262(\0352/M\214h\356\215k\022c\027\347\3013\027\351\311P0$\222ML\300\317M\336\353\270\350_\217\326n\034\370\342\204\211\034\300\35360\303\f\3630B!\032\234\021\224\217\351\347Sv\036\016\331{K\231RZ"
+	.string	"K"
+	.string	"U"
+	.string	"6\210\025,h1\252\300K\nG\002\232\215U\n\036s\302\270\005q\324e\204\253(?u\271R\363#\026\031\324\370x\311\230\2616\034\302\221\036\332\216\220\030\022\036\b\313E\027\206\354\274j\204X/p\304\325B\303m\2560\254Nu+\231sZ=V\206{\273m\024\333\b\354\353\0047\307\231\340\217\260\n\213\336{\364Y\344\343\3676\027\361\221\325\\7-\225~6,\245Kc\177\277\357\373\2743\266\325\242U\207\254\336\240ZBu\204j\b\325k\265\256\372\003DZ\260\023\327\2413g\314\0274k\221E\t\325\333-\001\262\006\025H$\371\250.<\237\003\027^\222\273p\367\307\202\253\323\317\002\324~p\242\367v\225\347\225\243\326m\312\276\201\342E\f\210\222\272*\"F#\200\332)&\275\247\373\0162\335\246\256\264\237\035\231]\032\177$C"
+	.string	"`\304x\\\024\310\377H~Ck]\265\272\007.\221P0\231\240\224H\020L\270\b'\244\024\256tR\341H\f\330$\301\301\211[1\231N\034l~g\374\0314\037\253\234(\n\242\001\311r\340\217\222\333\302\330\336\326%\252\355\340\234sJ\271qE\373\225\211\231\334Q\210\226*.\201\231\207\025=z\026\003\316\007\016\021\256\257\342\001\037"
+	.string	"\263\312\371\256\213\253Nz\260\256A+N\310\315!"
+	.ascii	"\202;\004W\262`\306\202\005\260\2220\315aa\2259\257\314\354\003"
+	.ascii	"\253P\245\334U\013\\\230\\\231\316\257Z\026\245VY\\\030!\306"
+	.ascii	"H\360\366\252\240\0034\222)\227VW\263\254\271\007"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.154.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`7\001\255\013"
+	.string	"\206\023I@0\213j8@\371s\261\351\340F\373\235vZQ\205\227u\036\036\021]\231\2206\315Q\241\027\323\2426_\300\311\362[L\357\241\232\267gDDe\b`\260\265\367G\241\253\2010\355\037d\367\2262\2454"
+	.string	"2"
+	.string	"9"
+	.ascii	"\273\001n\035\266\326\311\024\330\276\347\221\235a\302d\305\214"
+	.ascii	"\031\200\223\326\206\335\375\364\300G\317\221\377\325+\243I|"
+	.ascii	">p\354\256s4\235n\275\355\013\333\027\373\026\002\027Q\336]-"
+	.ascii	"\017*\310Hy3\227v\3354\212=B\222\037mI\021\250\225T\264Yb\252"
+	.ascii	"\001\373\334*\312~\232{Z\237\316\247\357I\330T\247\013\260\005"
+	.ascii	"\032\021\376\0027\034\016\345\235^\0305\220\362\006\301\245\372"
+	.ascii	"\002\t`\034\362\362\226\203T\313k\200\227W\273\343\261(\251\210"
+	.ascii	"\361\006!\304\356n\370\f\316\372\370\252w\016\211\362\343;\007"
+	.ascii	"\0061\"\241\246\003f<4\337GG\306\363\201\240\320\207\251p\b\262"
+	.ascii	"\001}!a\b\372<\326\236[E\271\222Z\325HZbNi\024f\023$p\261\005"
+	.ascii	"2\325XH\201\300\231\303>\021\030v7\" \260\002\031*\365 \325\033"
+	.ascii	"\021\372\273\030F\002s\3674\030\207\230p@\001\224qlL\021\254"
+	.ascii	"<\202/\374-\204\266\347\215%\037\330d\366\334\301\274\211\217"
+	.ascii	"\264\356e\216\341\333\221z\220\360cA\207\204\2021\023\265~\320"
+	.ascii	"\357C\200\323-\332\365\004"
+	.text
+	.section	.gnu.lto_writeGPSFrame.155.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`U\005\265\034"
+	.string	"V1\256G\240\230Q:\220\325t=\363\351\221ry\351]#\333\205{\026\325\244@\222\333\344\20220:\356\334!\366\217\235\305x\215rB_\227I\305u\340l\320z\354\240\276J#\351%\227N\314U3n\006\373\266\277\367\226R\246\217"
+	.string	"\214"
+	.string	"\237"
+	.string	"\247\222?'_J~K>7\177\207\200\274f\334X\035V\265\326(\276\251\\\023\313\310\367\311BY\261TW\020\344B\333\371\257\370i;\227\366\177\371_'\0335\256T\213\313j\3651\345\252V\252\333\211b;\t\254\215\356\224\373Cw~\374\321"
+	.string	"pQ\225\026d\361`\252rSk\305\365\323\216+\233\307\357N\255\f\330\244\264\022\307\266D\220\306\212\327N\323\222\264\325(\002\334\251e\031M?fX\204Z\353\031\330tc?\367?\205\377\017\376i\025D,\037\027W\310W\232\253\376\216\n\365N-;\341@\323\203\315\0272K\374ui\200\006\265P/\223\323\217\213\377FY\253\335\027\352!\220x\201;\277HtgP/\224=\360\244\352\315\216('\037\027?\343[\355\261\320?\211\307\013\374\201 Y\\K\255\364S\375\270\201\374+k\377\370%_H\362\203Vj7"
+	.string	"\345\333(\037h\362\177$\337\007\306\357\221|\036\030\277&\371;\224\257C\3719\224O\243\374\031\345\313(?F\3710\312\001H\266\353\213\027Y\227Pj\210c\375\217J\306%\260\246\035\353\333\023\354V\016\302\360\243p\273\214M\032\b\341\262Zc\3248%A\002\335\tk\bc\260|\023vKnhx\n\253\245(h\2703\013\355\325\021\334\"\332x\312\236}c\212\343\253\260X\214\262\366\212\205_\300\300\013\304@w\312\336\034\301-\241\264q\367\277\201\003\001\356"
+	.ascii	"\335\275T^\034\371u\330\253\035\203o\025\026\036bP*\350N\356"
+	.ascii	"\255\032#\345\343\342m\251\250\210\325Z\035|\245\354\224\017"
+	.ascii	"_\250\235?\322\351\350\316mj#\250\025&4\354\222\2202\234 \261"
+	.ascii	"\353\365P\350t\256#J\301\003!Bw4\002\004\216\004\322Q\022N\327"
+	.ascii	"3\201#\032p^\211]\017w\202\307\353\341hT\276\225\265\177\\\366"
+	.ascii	"\204\204\313\327\277\333nLc\206\f\216\001\203\231lD\240f\027"
+	.ascii	"9\001@xilR\033\362\357\314\004V\312%\340Z44,\002\365&\t\212\021"
+	.ascii	"J\375<-\034\243\332\360Mk\001\327|\031\021\177\302\370\364\264"
+	.ascii	"Op\275\332\364\020yj\3153d\327\214Dbjj`\204;:\2753\313i\235\236"
+	.ascii	"m^0\371\031\3313\271\002f\212\204\312\344\364\356\bv\021i\263"
+	.ascii	"\2265m(&\314l\fm\250aL\345\02036#\222\202\222\024$\035\260\002"
+	.ascii	"\021\031\263n\021p\251Q\f\t\215l\314\032`GC#\002\031\230Q\013"
+	.ascii	"\302\234B~eZ\354\226ch\t\360|\3429\363\325\361\234\323E#\204"
+	.ascii	"z\201AN\277\244\207\002N\316\351\235b\240~M\366\306>'\322\337"
+	.ascii	"\275\202\210\246\274]\277\370@\234|\031\244f\222\225{\210\334"
+	.ascii	"g\226\361\370d\t,(\216\275\371a\177\020i\037_\3711\371\315\303"
+	.ascii	"\247\374\354\350\250B6y\203\254\373F<h\013\334j \200\205\303"
+	.ascii	"m\351\324\200\226K>\251\362A\224\307\240\264\320\223\261\232"
+	.ascii	"\r\\\206`\200\377\024\260w\332pt\326>&\345\274\225\323\017F\337"
+	.ascii	"\223\350\326\347r\327\351\311\372\270\272@7\312\253\2661H\277"
+	.ascii	"\022\022\361\322/\2064\005\315)\244P\003"
+	.text
+	.section	.gnu.lto_loadMainState.156.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`p\r\305;"
+	.ascii	"\372fp\026@P\246N\007\227\372\306\025\376\204\275\310Gw\272\222"
+	.ascii	"0\217\324\237\326=}\232\023\035.\032\344\037\253Z\013k\2647\230"
+	.ascii	"@D\323DO\264\270\267\221.\365\230\311~\370~\344\204xBB\366\336"
+	.ascii	"2\245\224\002S\001=\001U\001^\204\250u\223\301u-2\310h\275\203"
+	.ascii	"\3421\333\331\315\246{Mw\232\356\272\356f\267\231V\231\373\356"
+	.ascii	"\255\215\233\235\0225vE\263\245w\226\245\317p\243ab\035\353%"
+	.ascii	"\312\003\224B\330(\332c\232\216\211d\272\314m3<\226\326\276\265"
+	.ascii	"\323\374\362\372\004\256k\323CS\330Mi\263G\257jk\003a\244\267"
+	.ascii	"\f\\\327\025\253Q\256 l\224\231\333\231;L\313\335\236\363\301"
+	.ascii	"\303u\215bw\267\256\315\006\354@\330\250T?\245\215\332nJ\033"
+	.ascii	"\275\314\201\004\220\255a\021\362\354\230\321%Z\3275\353\253"
+	.ascii	"0\013\205J\326Z\342\377\013\255\265)\177\333f\263Mo\027\225\222"
+	.ascii	"\220\210GC\241\272\224\242L\366\375r\323\265E^\341sL\013\353"
+	.ascii	"\242U\311\212`\351>4'v\202\242@\274\276k\342Jn\235t\327V\357"
+	.ascii	"\r.\212\232[#\265\265\351)-hK\2348EE\215I\037\251\031\332\264"
+	.ascii	"\325s\203\213\242\306\244\207l\366\201\235\231\013\325\fT\324"
+	.ascii	"\224\264\332bJz\311\"\355\331\262\244\373\320\222\026\002\233"
+	.ascii	"\335\236VC\346\351\021\034\222F\205H\232\311.\365\241)\355\003"
+	.ascii	"?K\373\341\026\316H\177\243i\024\351\006xL3\322\256fX\327\225"
+	.ascii	"\375\230\246\326\f\240\231\273\t3\253`F\362\n\202qx\302B\034"
+	.ascii	"\232\220\372B\017-(\020P}\246\200>\364\037\364S\020\375\327\307"
+	.ascii	"\017e\024g\367\210h=\377\226D\347\351\303\363\337p\224\210\236"
+	.ascii	"s\376|%\252\374\230M\264\035\024\302F\r\364qP\277\277\025,\263"
+	.ascii	"\223\242\351\260S\313\257K\317Y\021"
+	.string	"!\271\327rXp\013\027\336G\027i\243\375p\224\210\342\346\304|\360;\251(\360\356\371\3013\277\3508\\\302u]%p\303\271O\272\240\222Vx\244\215\352P\032z\266\211\371 \203~\303\303\202\337\272\256\023\270\361:/\006\267\225FY\306\f\357c\243\3343\322F\263\036LY\350\211'\346\203\314\3150\177$sOH*\n\344\237\302<\242\303\226\006\f\335l\326\352\271\356\007m\2469\253\235\315\013\232M\363U\257i\266\3524\315U]\327L\245:+\030:'@\235\247Pg\251\241s\224\352\214\300:\037\020:\033P\235\013\250\316\004R\347\001\326Y\200u\016\240:C\245\316O\326\331IunJ\235\001Xg&\325y\311:\027Ug\245\3249\311:#\251\316\304\324\371\310:\017Qg\241uVQ\347\324:\243\250\263\265\316\217:\273un\022O\001\212\330il]\305\024\004x\001Z.8\363%\273f\336\307"
+	.ascii	"\337t\375\264\267\214\273\363\343\303\206\217dU\216\272\365\377"
+	.ascii	"\267\204\325VVB\253\337\372\"RY\007\245\305\333.\263*\031\304"
+	.ascii	"\231\334\265\247\207zk\310\351\211\202[\r\271E\274\217N\337v"
+	.ascii	"\3754f\271\345\316\330\207\251Kh\207\377?&\254\256\3723\326K"
+	.ascii	"\253\234\315nO2\255\372\016_D&\371\232\036\311eV\371\245\371"
+	.ascii	"\221\273\006\340\233\336\n2\001\340\342j\354\024:\232\247\335"
+	.ascii	"#I.\033[\332(\323\267\232F\265,\317\304\341yA\037\311\315\364"
+	.ascii	"SX\225\363#\376\377\034\253\251\376\254AS}\317\225\371\033sE"
+	.ascii	"\215G\212\237\246}$\325\217\370\"\322\r\260\314\355\207\017\362"
+	.ascii	"\022\021&>\344n)\376\322[=g\354\214\320\304\217W\216\201\237"
+	.ascii	"\003\361 \327\t\224+EJ\332h\361\373N9\370T\362\262\313\244J\""
+	.ascii	"\235,\351\225\336\352AJr1v^%\253x\330\225\2130\350\353U\336\267"
+	.ascii	"{\305\373x\257\244\215\"}\267)\033\305\341\021_\3602\251\340"
+	.ascii	"\232\321\335r\364\304\267\200\314\032U\371\360\231\257\227\033"
+	.ascii	"\227\366\361\350\245\306>\214\237\354\274\272`:\321\225\323J"
+	.ascii	"\036jDW\f\263\206\r\336\307\ri\243\303o7e2\032\314F\327\327W"
+	.ascii	"\216\rE0\0339\2746|y\201y\3258\302\201\242\253\206\214\023`6"
+	.ascii	"\272\276\276rp%1\227\203\035^0fp\275\240\001#\313\206\214\027"
+	.ascii	"5\262\270\276pd9\210b\257\033]_Y`^^_Y\304\346\332?\205\207oq"
+	.ascii	"w\304\376\007+x4\227y\240\316\353\214\200P/\350d\234\256\214"
+	.ascii	"\2331\002\2461\256Y\2236\2126\252\340\273m\311\347\211\227\200"
+	.ascii	"\2157\277\2163\301\177\237\267$Sn\\\356\r\035\007\031\363\034"
+	.ascii	"L\t\217\363/F\2758\306\275\275\264\321\251o%"
+	.string	"\313:\3179\2519\356\245\004\240\022|F<\336G\251\267\317\245\240\250g6\346q.F=Pl\216\203B\3641\372\361>F9\355-\371\212\217\344\341_\022\206\377?$\254^\240\365\013\350X\245\005\217\341\233\350\226|\b\036\3562\243\214\200<\213\021\360\300#x[\247\314\016\026\307\302N+~\305(\210\220\321\220\321P\332\350\201\357;8q_\027\207,-\311\300k}\013\2325\332rf\343\323\270\310\373h\240\t\317R\017\351H\303\377\337\020\253\257\376\314\223\364\025\361\3525 *s+\360\312\313\214\3623\nz\362\256\331:Y\234\312eNq\344]3\016\336\260\260\264\321\002\337m\032\345\262t>\217\b8\360(\227\031\005\345\256A\rx\002o\365\004\fx\2511g\007\201\005\250A8\004\025s\206DdD$I\222B\007\361\005\204\030\307\\\231\007\021 \245t\016\315\204\231\024\224\244V\007!\246S\260F\002"
+	.string	"\320\233\356\200-,\217\210\257\003\013%\353\210\b\250\004ZA\"\361\353DmJ-\204\271\003L\227\207\314P\003\0331\311}\202{\345\375b\251\017?fFB[\220p\340\223\222\274\273WGSJ\263\362\326,\377\006x\2722\302/\331PyQ\220\364\277\215\340\344\352\347)\304\313\307\271\315\333[\255"
+	.string	"R[\202\320\033LV\034^\261\270\251\254\240\005\215O\013\200\271\306"
+	.ascii	"\275\215?F+\3710\213\020\255PN\301\326\234us\336,\242\bp\246"
+	.ascii	"\004e~!]\217\241\002<\214o\305#DY\357G8o\347@\252\245\310`\310"
+	.ascii	"\226\0360D\244\267\300w\324\030\213o^\355E*\232\217# \3031\370"
+	.ascii	" \324\"\007\236\216\003\024\256]\030\017B\216\3606\332\023F\004"
+	.ascii	"|\204ol\016\0274\023\310\204|*\362\362\031,~\213}\247\305\345"
+	.ascii	"jC\305\270\370\221\021>t\231\004\f\374G3\033\013\344\274\356"
+	.ascii	"1o\217\352\036B|\203\007zP\261\311n\316V\215r\227\250\330d7g"
+	.ascii	"\325/\337|P\261\311np\362)b\331pjr\2473N\2035\035\357\023\330"
+	.ascii	"~\315\336\207]z\004\003\3242\30200j\320\352\332F\233m7e\311\315"
+	.ascii	"`\340\353o\375o\257\242\305\t\302\002|\232\304\211\370$\360I"
+	.ascii	"\221/\347v\003\332\205B\203\314\205\370&h\024c\360d\234\240i"
+	.ascii	"\026\316\022\216\210\252A/\204\334\f\242,\207(\313!\256vY(\277"
+	.ascii	"\b\221^g\027!w\001'\231\312\002\361!\b\266q\0017$#\022\366\327"
+	.ascii	"\340$\243i bd\2155\244\001cb\342\026*"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.157.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\375\022M^"
+	.ascii	"\272\236 #N0\320\332\031\003[?\274\352\022\255\037/\034\242Z"
+	.ascii	"\304\322\023\r\237\007\254Bq\254r\377Fr6g\"\367X\363\216V{\314"
+	.ascii	"\305\230\3765\021Cy\230s!D\001\0020\304\203\271\226\274 r#\345"
+	.ascii	"y)\364\214\204M0\371\331DJ\231RJ\001(\002\346\001\"\002\257\027"
+	.ascii	"\326.\255\363\272\267t\327uWi\034o\273\356+=dnn\030\372\313\004"
+	.ascii	"\355\205Y\270>3\275\274\251b\224\372\366r!N\300\334X\270\271"
+	.ascii	"pq\013\025[\2269\"^ga.rUc\341!\\\036\032h\333\373\276\305*\346"
+	.ascii	"b\263\317\334\203\233J[\351\027\372\216\213W,@\276{o\213\251"
+	.ascii	"\341u`&\212]\210d\327\333\033v\003E\355\257-\260I\225+'.\037"
+	.ascii	"0\360\300N8\253\273Z\337\261\267Wl\350\265\366\3266\242Y\356"
+	.ascii	"\261)u\355\203\235\273\300H\217\216\322q=Z\n\337\261\315\373"
+	.ascii	"\226\375Y\021\233M\256\315\323>\34129\336\016S\001\317i&\202"
+	.ascii	"\325\231\373\255[\350\321p\\&\b\371vU\227Ty\3377\022,\343\255"
+	.ascii	"}\332f\211\315\323R\005\rx\3576\016\370\337\027JW\345}_\022\314"
+	.ascii	"Dl\326D\212\036\354\006yi\321P\002\357G\023J\340\373\276)\237"
+	.ascii	"\0046r\267\225\222\220\216>\030%\213<\020\ru\340 \024\004\364"
+	.ascii	"\343\323\303\263\243\203<\032sp\21276\304a\313\256\357.\267V"
+	.ascii	"+\r\235n\224hq\201\2062\261\272N\242k$\272)~\264\236\360\n\f"
+	.ascii	"\241\367\236t+\316`\223\257\247O\027\374C\357=\347\356\216\270"
+	.ascii	"\321\bbr\235,\032:\331\230iA\243\301\003\265\211\334\250>4}\266"
+	.string	"y\0076\347\340\244\211\013\355=\235\254y\220\224\006\332{J\351\3513\315\177\324\364Lp\237\236%\315\263\2120cEM\357=\245\253\017\230\t\316\236>\321|g5\300M\355\254\367\236%\254\017\027\207\247s\326\3103%~\324k\243\275\247\2245i\\\227\302\244P\244\367\236\320\225\207\310\2240}G\3469.\3278!t\321\350f\350T&f\244m\366\236E\2108\261\267\352z8V\fkz\273\026\231\221\t\032\303\230k\222\213\227fsi\243\351\263\316\331U\004\264K\220\336{\206\260\372|IB\306\313\327 \375\3060\2565\371\276o\337\265\177\205u\271\017\235\336\367ew\206\2115\203hfgc\356fF\246\b7oU\035\243\3446+\270,x;o>\351\342m~\030e+Sl\252\226\370.\336\357\230\320\341\023\177\bC\223\360\310\333gv\331\\7o\347\360\333\006\021\272^\013\2036\343:!\276o\327"
+	.string	"\3343t\031\026\353\223\213\266\235.\332f\333\027"
+	.ascii	"\016\0062P7;\233?\351\264\375(\233\370\365\255\252z/\232\f\025"
+	.ascii	"1\206\365\233K\257]\320\360\004\251[^\330\343,\023\201\375(\337"
+	.ascii	"\234\301\362k\207h\177\346\316P\275\355\020\255\211\377b\352"
+	.ascii	"\377\034U1\3141\332\217\357~\230et\230\031>J\336\367m\342\353"
+	.ascii	">\005\270\245\315\362\0024\274\2354\332f\377o\240\341\255Q\267"
+	.ascii	"\326\217\022U\375~\374\23317\007\355\323\377V\227\030\252c\272"
+	.ascii	"|\220\375[\260x\247\367\357\320\267\026\307\354?\340\273\257"
+	.ascii	"I\270\345\205\274\342U|\177\3375;\210\026W\365\213\302\204\313"
+	.ascii	"\013\231\337\270\374\243\314]@\263.\214\337\214y\307yit\2262"
+	.ascii	":G\2753\216\316k\276at\266\321W\232k\260\263\003-\245[\201w\226"
+	.ascii	"\361\3161\336\031F\267u\277\350-\315.\232\332\375\324u\315-z"
+	.ascii	"\256\233EO"
+	.string	"\351v\352*\315\0074\\\367\212~\322\255\342\235\233\3369\005;\243\350\274\346\023m\327l\302\350\034\200\321\271\204\321Y\371\316L\357LB\307y\351\235G\274\263\210w\006\340\235C\3548\2030:+\3558'\2753\222\217\363\321\321\371\203\321\331\210\235\223\357\\\364\316\036t\234\211z\234\207z\2349 \235\205\216\316AFg \036\347\237\035g\037\326\271\007\351\314\203t\336A:\353\2743\362\235\217\357l|\347\234\2433\216\321\271\250\343|\363\3166Fg\"\322yxtn\337\2315:\257\357\3749\316\236\343\334:\226\302p\201y\202\367\365~o/X\341\r\001\035\310I\257\327\342\243G\372bT\016\260I\250\f\204\n\001\372\250\333\356\217\366\350{\332\364\251\373\343\350+\220\326\t\022\340\037<p\301h\244}\370>AJ\367c\264Dj\364\3032>>\250\033\325\307m\3170\220F\tD\263\345\205\035\007\366E\256G"
+	.ascii	"_j\276k\231] .\b\336Nv\271\351\020\336\373\201\005\t\317G\331"
+	.string	"\301:\031M>\003R(kcEIN\274\207/B\342\341m\312\370D\200\272\215\235\021aa\314\316\0325\307\357\251\266\310\271\246\016y\343O\374\027\232&\372.;A\364.\227\006\350\245\353\265t\206\376\006\3336Z\016?\364-\364\034\376\323\004\t}\003q\207\270\221&\366\"Yv.\021\013\332f\203\276\231\240\251Y\353#dzG\220\016B\003}\227U\305\370\330\020\240o\275^\321\240\245\021\2446qBe;R\265R\277\006\002 \2223`\306D\275\215\227\372n\216\001\361 TF\334#G\332f\243^\351l\f\307\333\370\376\371\245\306\361\235\245\331\351\230^\325/\312\r>\377\363\037V\303%#J}\276\277\212\360<\213\357\371a_\213\327y\236\027J\303\234r\271]\026\037G\214}A\313\342\037.\017\260*f\347W|\215o\031\230*\034\360:\277\363C}\314\351\210\327ya\207&C\325/\216\360\301\304"
+	.ascii	"'%\207D\223'>p>\312~\003\343\221\346\004\24161>\305\177\265\354"
+	.ascii	"\036\370\007\256\004.\022$m\2635\320\302\250\241A\376\227;\375"
+	.ascii	"\307R\037\037\371\277\306\233\316t\257\343\337@\353\023\244\032"
+	.ascii	"\237\253\2355\310\370\2347~3O\360\327\265\246\270\245\354&q\243"
+	.ascii	"\356F\333fs\276\350ll\311q>\305w\227&t\317\210\357\313l\247\213"
+	.ascii	"Fd\366\037\bw\211\233\346\355\224\361I\346k\255\305\027\017\303"
+	.ascii	"o\236>\306w?t\312\227\3157U[|\037\241\232\327\345\203;zP\020"
+	.ascii	"\347\337\357\314n\313\013\001\325\024\277\307V\236\031\324\215"
+	.ascii	"\332\272\215\t!~\224{\254\024!3\374\250\213B\033,\225\364\214"
+	.ascii	"C*\t\002\226\t\270JJF%%\2230\216\313\252\006\256\226X\032\344"
+	.ascii	"\300\341\261\304\302\232\262\262\261lQ\325\300\225\025\324\216"
+	.ascii	"(\244\216\245\324[-\245\240\226;\212R\310\245\324\224\025\026"
+	.ascii	"\r\344\323\361\006\213\307\005UO7\tH\361\250\212Z^\371\\\361"
+	.ascii	"\250\232\302\232\3421\245c\211\200\024\005\313)\035H(,\n\226"
+	.ascii	"RF+\250\035OK*(\253\004r8\212)\203\252\034\023DAQ\220C\311c\n"
+	.ascii	"\212J\031eu\245d*\342\252\n\226VJ\254\252*+e\361m\253\337\214"
+	.ascii	"\233T\222\034x\033\324\270\270\241\227\320\315\245m\244xjqTX"
+	.ascii	"\007k\024(\236\235\266\236\013\210\322G\003x\007~\275k\252\225"
+	.ascii	"\241\"\316\020\300? \355\023L\372h\223\361\030\306\364S\312\247"
+	.ascii	"\206\246\304\377Q\371(\361\353\246j\225_\342?\r\037\025\021\214"
+	.ascii	"\362\033\220\352\tR\005\360\233\226\233\256az=\267\247Z\022\317"
+	.ascii	"\364\315\204v!\361\033H\363\004\307\266\314xi\"}\224\227\336"
+	.ascii	"\007\253b\226z\351Q\2700\344M\320L\327k\265\026(\204G\037\345"
+	.ascii	"n\303\333\322\244b4\342\331\377b?HH\232\326\0310C"
+	.string	"A\334\324>|\224\025\370\021\357&T\273t\371\240\026\276\003\372\3132\343\347\017o\304\003\211\241v\257\357\373\276F\"\356\370n\305\225\031*^"
+	.string	"\340E|\320\032\267\302w+\274\312\f\025T"
+	.ascii	"P\302\345\375A\335\250vP\330\002\223\037\345\020t >\304;\335"
+	.ascii	"\324\347\\2\245\334\022\210W"
+	.string	"\236\331\035\013\013\013\013\225>*:\007\310\204rQ\333\312H(\"*\262E\206p\232\376\253\351I\326\031\244\2544Df\023\256\036>\352\354\026A0\2427\343\265\251Z\243g\305\372\322\210/8)\033r\311\332\244\3670\356\304%kR\302Y\200N\315\022lV\371\227\364MgvBkh[\035\210\332\245\237\t)\241\277p\226\r\316\346\222\255y\223\2545Y\205\256\226V\333\354\362\373K{\033\223@\250\033\325D\rX\2708|\324\2066zW\323}}\322\246\320GY\2569h_<[C_\222\240%G\372\366\342L\\.%%^Df\201z\250\2014\345\224B\210HDD\222$Is1\005\304 \006\245\264n\021\3404\210\244\232\021!I\n\351\013NI\n1aH\037\340V\323\273\223B\351\0171A\246\034n\251\224T\016\351\356\037\310<8)>\321z9\250N\302Pw\360}\224e/\2612(V"
+	.string	"2\373Y4\007\\$\267\"\n8J\330\231f\202\340\230\217,K\026-n:{\002\031me\035\231\306\216\312'\307\021;\343\034\374y>\002\200\017z"
+	.string	"\024\343\363a\211'\330\t7q\217\203\n\243\370V$\242\337\216I\3466\b/R\206!\334"
+	.string	"<\204D\206\223\347\233\260\331\254\231\004!KXJ\021\261q\017\371\360#\364\374\200\275\001\230\216\236\277\346Zv\241\001[@sH\246\374\240\337](V\375\260\313\027\213\313\024\307j\177\345[\346z\201\342Kv+\026\324VMrXoa?\367\316\224I*\027G\005\204%f\025R\333f9\357\312u\263x\355\023\342+\b\272\254w\204\317yv\262\315L\343\"\367}\376\215P\301(z\\\315X\210\351\251\351R/^\253 \370\241\337\341\303\030\221\216\002\245\370\272\030F@B/\023\335:\303^y*\344en\327\374\262\262\234\0314\361d\317\322&QEe\b69\r\247\330\021B[\376\251rx\202\003u\372\020\261\327\203\275\362\260\335\177\331q5\337\266\203\324;\302*\377{\364w\3027 \2720\377v"
+	.string	"e\013\365\212\030\226}\235\3156\302\306\004"
+	.ascii	"&=\366j\3022\211\001\245r4LlW\246\302\006\276\350\276@\023\300"
+	.ascii	"\303\003H\3152(f\025\204\211\374\357\321\227%\247\357\217\270"
+	.ascii	"\027\355}\202\323\177G3Mo\026\rt\031\347j\336\307\207\235\f\263"
+	.ascii	"\221\326\357 \320\024@\n\331\021\365\327u\2420\235d\310\030|"
+	.ascii	"\006\332=\324\230&\221\034uv\005x*~\013\271\332_\214\300Y\333"
+	.ascii	"\214ZQ\237-\251\2774\r\3738\370\r\265\371\245\314\003\255\207"
+	.ascii	"\367\324\260\272yJ\233\n_\357\244\215\032\371\022\277\317\227"
+	.ascii	"\023\306\r\2107?\351+B\005v?\317\371\310d\022\016\200\260\346"
+	.ascii	"\t*\b\247N\350\177\223d\366\3335\225J\200(:\340\341\3561~\001"
+	.ascii	"'\310X&\351\261\t\035K~C\236\033S\323\326\244\264\206=\0226u"
+	.ascii	"im\203\027\032\032\006\210\316\023P\325j\233\246\017)\351\255"
+	.ascii	"\224\270\233\n\275\222U\036\223\233\222\025!]\006\303\230.\363"
+	.ascii	"\332\251\354]\032\357\003\r\3460\025\203^a\206_@\233\251\006"
+	.ascii	"-\013\341!E\037j\255\203\255\257\244p\235\003!\260\315\236,\365"
+	.ascii	"R\367\323\034\215\302k\001p!\3469\357\300\337\214\206&\0049D"
+	.ascii	"\274R\034\343@\220(\203S\254\013|X\365\026l\005z\224\207\254"
+	.ascii	"\326\332\273\310)\033\222>\306\t\2724\337\210.\177g\0066FE\330"
+	.ascii	"U\035\024$oC85"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.159.a7c5cc1330de509,"e",@progbits
+	.ascii	"(\265/\375`]w\275`\001\232IZ\201Q\020 fi\215\001\017>4\266\334"
+	.ascii	"\320\362d\364\310\260~\235;9\262\324s\\sm\001<\326\301\007b\217"
+	.ascii	"@\036Q\202c\177\361V+\301h\353\2103\316\270;\206\031\300\276"
+	.ascii	"\230\321\221p\352<\246m\272j7\251l+R\026}\357\213\220\355^IR"
+	.ascii	"J)u\007\305\007W\b\3549\\g\307\221t\366\033\256\263C%\235\335"
+	.ascii	"\206\353\3545Zg\177r\235\235F\353\3543\\gwj\235\275\311uv\031"
+	.ascii	"\255\263\307p\235\235\251uv\251\353\354K\255\263+\271\316\236"
+	.ascii	"\324:;\222\353\354G\255\263G]\347\036l\235[\320u\356\300\326"
+	.ascii	"\271\001]\347^\323:\267\032\327\271\377\214\316\235\306\350\334"
+	.ascii	"h\\\347>\223tn?\327\271\373\222\316m\306u\3562I\347&\343:\367"
+	.ascii	"\230\244s\363\271\316}M:\367\236\353\334b\222\316\035\306un0"
+	.ascii	"\255s\353\271\316mM:\367\027\327\271\275$\235;\317un\274\244"
+	.ascii	"swq\235\233K\353\334[\\\347\276k\235\333\316u\356\272\326\271"
+	.ascii	"\351\\\347\236k\235[\316un-I\347\316\242t\3568\327\271\341\222"
+	.ascii	"\316\375\246tn7\327\271\261$\235\273M\351\334W\\\347\266\222"
+	.ascii	"t\356*J\347fs\235{\255un5\245sSq\235;\255u\356\252\322\271\251"
+	.ascii	"\256sOi\235\033M\351\334R\\\347>k\235;\212\322\271\315\\\347"
+	.ascii	"\206\222t\356'\256s\227%\235\233\314un'I\347n\242tn&\256s/i\235"
+	.ascii	"[L\351\334a\256s\203\265\316\255D\351\334_\256s'i\235\033\211"
+	.ascii	"\322\271\217\270\316m$\351\334^J\347\356r\235\233+\351\334[J"
+	.ascii	"\347\326r\235;\253u\356\"J\347\306r\235{\332:7\021\245s\337\340"
+	.ascii	":\367U\353\334C\224\316-\304u\356 \255s\003Q:\267\225"
+	.string	"\353\334?Z\347\256R:7\225\353\334>Z\347\356\241tn\036\256sO\265\316-\245t\356\035\256s\353H:w\224\322\271s\270\316\215#\351\3347\224\316\r\345:\267\215\244s\327P:\367\223\353\3344\222\316=C\351\334N\256s7\265\316-C\351\3341\\\347fJ:\267\324u\356\245\244s+)\235;\311un\244\244s\037)\235;\352:\277\2553T\351\374t\235\215Z\347\"\245\263\r\2563\214\326\271\006\2453\221\353\374\242uv\341:;[\347!\327\271\331:_@\351,\344:\007\265\316@J\347\037\327\331\247u\246\301u\266@\353\334\343:\267h\235Y(\235y\\gf\353\274\343:\353\264\316+\\\347e\353\\\001\245s\216\353L\201\326y\002\256\263\004Z\347\b\270\316\020h\235\037\240tv\200\353\334\200\326\231\001\256\363\f\255\363\002\\g\031Zg\005(\235\023\340:\307\220t\206\301uF@\322\371"
+	.string	"\256\263\001\222\316\005p\235\t\320:\277\340:\017\240uv\301un\241u\026\200\353\314B\353\274\202\353\034\200\326\031"
+	.ascii	"\256\263\212\3269\205\353\254B\353\214\302uN\241uF\301u>\241"
+	.ascii	"u6\301u>\221t6\341:\227h\235Kp\235Ih\235Gp\235Eh\235Cp\235Ah"
+	.ascii	"\235q\\g\022\255\363\215\215\363\b\327\371\203\016\316\036\270"
+	.ascii	"\316\035tp\346\300\203\363\006"
+	.string	"\256\263\006Ig\021\256s\006Ig\f\\\347\013\222\316\026\270\316!\222\316\025\3308S\340:O\320:K\340:G\220t\206\300u~\300uv\300\306\271\001\327\231\201\2443\b\327\371C\322Y\351:{H:']\347\016\035\2349\270\3166\035\234]\016\316-\007g$\007\347#\007g\243\215s\321u&\266\316C\2443{t\026\032\235\377\350\354F\347~!'\362\222\272D\221\233\361_\312\2425\006\001\243w\354\225\256n\353\036\353\206\322-\245{J\263\314\315A]e\016P\366\274\270\257t\0337\026F2s[y^\340\306\036\336\005\270\2550r\255\331.\320U\206B \225E\217\216KjU\232\244aQl\226\253\034;\255\2510#\331EW\231-s\r\253j\022\215F\221\3152\273`F6\373\314On\2626k\264\2462r\n\2210:U!\367\3445C1J\237=[\nQ\b\244\262\250\r\344R\\\232"
+	.string	"\024\233\355\340e\375\344\331P`tT\032-Z\345\252\306D\2436T(6\333c(\340n\322N\236=V$\214J\225Eo\330\234i\231\322$M4Z\366A\263L\242\330,\2275\210a\263\305V\016\233e\021Jx\362\353\300\322\021\031\020\344\234\230\316\322D\243e8O\244\337\346+\357\261\030\016\303`X\217\255\374\205\275p\036\343q\027\346\302[\370\216\355\270\216\351x\216\345X\013g\3418\206\3437vc,\334\306W\330\nWa6^c5\246\302i\\e*Oa4\226\302g\034\205\315\030\n?\341\262\024*\240H\001\205\023L8a\242D\t$\214 B\b \340\220\270\031\361\201\007\035p\260\201\006\"2\300\340\002\013BT@\301\004\022D"
+	.string	"\301\003\0164\300"
+	.ascii	"\210\017J\017\311\016\034l\334\026y4\026\211CV\370\376r\0375"
+	.ascii	"_K\204\341u\371R\205\302\321\274\347\267\026%(F\314ST]\230\265"
+	.ascii	"\25010kQ\\zukQO\3263_lpx\361\202\203+\357m\r\307\023\236\337"
+	.ascii	"\023\224`\027\274'\250+\027\2655\250\272-kw^\326\240\306\354"
+	.ascii	"\326\240\270\352\304\254AU\321=A=\315\235I\033\024\224\033\364"
+	.ascii	"\242\345\214\323`]\226\301\2658?\247\3011\270\301\252\267\300"
+	.ascii	"\253[\340\030\026\nF\330\201abk\243sBSw\305\331\234\320\214Y"
+	.ascii	"A\303U\005M\025\233\337uM\315O\t\0251N~\\i~OU3\202\324\265)f"
+	.ascii	"\224\240\3459\231\341\222\"&\315L\325\031\031\301(ufd\326\240"
+	.ascii	"\220\031{\342\201Nv\202\\\206\306\311\356\232\302nM\005\273*"
+	.ascii	"\024}Nt\202)\240I\243\273\242\360v\002\335\r&\320U\235\0204!"
+	.ascii	"w-!WW\002\237\223\334\030\tr\\#\310\351\020A\356)\004A\020\262"
+	.ascii	"\\q\334.-\013\211\264,U7\327\264,O#\322\340\256\037\324y\200"
+	.ascii	"\227\006\307\325A\333\245\301=q\340V\267\301^\232\033\227\006"
+	.ascii	"~im\202\"\234/\255m-\203gsj\253\302\300\001\323\254\\\340\203"
+	.ascii	"NV\306,\3703'+O!\370\322\310\004+\270R\220\227FV7\001^\032\331"
+	.ascii	"\232\004idc\021xq\"\343\202 \351\226FV\365\200\003\302\021\226"
+	.ascii	"\322\370\220 H\022\235\260U\303\204\327Gl\204y\003N\252\030\360"
+	.ascii	"0\350\304\344\nB\370\341C\020!t\255\024z0\306\312\231\346bCK"
+	.ascii	"\b\242\006WS\037\261\221\345\036\326\234\304\306\222{NbU\035"
+	.ascii	"\352\322\304\2368\234\261\251s\002\273\272pi`u-\022L\n\322\315"
+	.ascii	"\tl\354\370\346\004\306e\374\342\004VUl\2724\260'\242\2739}\t"
+	.ascii	"\016\233\332\316#\0039.&\266\034A\204\3205;'\247%K\034\333\232"
+	.ascii	"\032\225\264*u\n\331\230\223&L\226\210\205uqmie\025\301\232\376"
+	.ascii	"\250\242\362\321\203\307\224T\215'\0323\234\232d\304\030\024"
+	.ascii	"\f\004\\\243\346/\r\337uOL\0300zV\273:\27299-Y\342\330\326\324"
+	.ascii	"\250\244U\251S\310\306\2344a\262D\254\213k\253\b\326\364G\025"
+	.ascii	"\225\217\036<\246\2061Lst\020\033RL\322a\f\323\034G\250\245a"
+	.ascii	"\f\323\034\037\202$\325\361\b;\b\251\353\027V0\344\307\237\r"
+	.ascii	"\224\2220\204\334\035SS\333\235\240\222\334\211*\242\321({\023"
+	.ascii	"\324\215\346"
+	.ascii	"\240f>\2221\023!\300\314s\"\0164\364h\270\301\367\0223=%W\303"
+	.ascii	"\314\317A6\t\364\b\311\006\254\217-\277\277\036\rh\360]e\215"
+	.ascii	"\274T&\246\\\330.(\333\215\365i\210x\r\262X-hW\022tii\330\254"
+	.ascii	"\210\007\201%%\325M\005k\273c \304_\360\031|WY,(S\212)TFQ\372"
+	.ascii	"I,\021\250\323\215\025J\243(\3652R\177\304\030|\0065\330!B0\370"
+	.ascii	"\236\323\263\340/\200b\201XY\360=\210U\301\207xw\303\301V\021"
+	.ascii	"\371`\251\240Q\274\003:55l\266\202oj\027\240j\213O,\252Y\005"
+	.ascii	"\b\n\236\371\305by\274Y\277fe\247\272\251L\231.>\005\217\202"
+	.ascii	"\233\264*\311\007\275\257|\301}\230\340\273\312\356x\251\032"
+	.ascii	"p\032\3652\365\336\324\213\004?\301C"
+	.string	"\240\006\355\301\336`m\260PP\252b4\032\375\001\005\"d\330\254\004\357W\2751$\037\344/V\304(\377JL\273\3317\265\235K\207\231'f\272\b\243\321\346`\350O\336\315\276\231\244\222\330\031,\2157\353\nJ\204\310\260Y\177\362M\245;xr\006X\345D\352\206\207\b\276\253l\023\0276\006\024\353\306\232U\224\272\026\b>\202w\267-v\t\332\325gS\206\032a\225\240HRL\243\321h\211f\231Eb\223\240_`P1\261a\263\020|\237a\215\325\350\246\202\355\270K:\360\017|W\331\350\233\204b\352m\202\357\324\215U\212{\375\003\337F\336\201w7&\301\031\335T0\034w\035\032X\003e\222\202\025\352\244(\365\262\277\227\351\306\232\244\002\316l\315\256\024\215\"a\300\f}\0025\363nj\340g\260R\372#v\031\335T0\250;\016\f\364\225!\002\342\0318\023\362]A\374Im>\210y\251R"
+	.string	"\363N\335L\235\207\362?\240\t\277\344\t\275@\251iP5\265a\263\312\260-;\261\244f\025\256\207./U\t\353\026(\033\324JQ\352P\311\367\360\256\006m\023\326\021\t\347\204tP78h\226,\303f\223\337\324nA\311V\235G\233U\264\035\264\304\371\022\207\357\340&\007\335\302!\360\017i\363]\025\266\275T)\370\221\025?\351\037\261\3736\337L\202j\3025(\035\267\026C\355\240[\034\272e\330\254\253\246\233\252\004\315\335\221\205i\320.\336M\f\202\260\n\315\203~\201\352y7My\251R\230Jy\231n\364\214J\372\356\244h\214\037\254B(/UG\231\226A\303@\367\212\322vkjw\21640\033\177c\244\177\304C\302h4H\212n\353\036\003\305\007y"
+	.ascii	"\n\360\222\246\252IW\333\fJ\306\f\324\017I\223\273\245?b\026"
+	.ascii	"\274\335\032\013\364\257\030\215F\273\211\273\r\272\006\032\350"
+	.ascii	"\335\304\215\245\217i=\252\374\215Q\372#\356\276f\025E\344\267"
+	.ascii	"\337U!\330\233\204\302\272\366\365\002\271\231\222\205`:\002"
+	.ascii	"\035l\275\216\220d\310\020\215\177\374\256\n\271\336\244\266"
+	.ascii	"[*J;L\353ej,2\212\322\326*\362\002Iam\252\351\353D\243(\355&"
+	.ascii	"at\352\217\256j\274Q\303nj\366\370F)a\020\241\220\027J\330Z\374"
+	.ascii	"\342x\243\206Q\303f\215\377AO\n\311\007\271\257\335T%vwC\022"
+	.ascii	"\274\253B\253w\252\243\364(J\237U/\025\n\353\217\242\024\306"
+	.ascii	"\006\315vU\350\343\005r3\215F\245\335\364\n)J-\260A\263\314\357"
+	.ascii	"\325K\304\273\211e\260\222\376\021w\230F~\335\245\031s\344\201"
+	.ascii	"\276\204\311\214\375+\241\024\013\247\360\272\242X\250\243\313"
+	.ascii	"\326\r\026\342\340\222U\203\2056\266\024\231\301B\032wS\031,"
+	.ascii	"l\262\373\341\025\265\222\262\220\251\256\312+j%Lb\241\022_O"
+	.ascii	"\250\321\t\243,<\232\223\362\212Z\005\362\013\362\365\004Z\234"
+	.ascii	"\234\032"
+	.string	"\3765|=\201&\245\005\r\177\232,dhxE\255\372\370\375\370zB\212T\034\031\3762qpW~>\276\2368\223z\013\303/&\316\315\312\257\307\327\023Q\244\260\344\361{\211k\343\302\337\205\2578\203RW\354\370\357\254\314\361\323\361\025G\260J\026~-|\305\t\214c{\343\207\343+\016\340Z\033?\026\276\342\240Q\253\302o\205\2578~qT\324\370\327\370\352\203\323*\037iU\3764\276\342\324U\321\370\247\304Q\243\360\237\361\025\207Nj\312\023~(|\305\231\213C\033\343'\343+\016\234\024&\374M\370\212\363&u\026\306/\026\027\345\213_\t_q\334\314\216\360#\341+\016\026)(]\374^|\305a\213{\362Z\374[e>\260\370\213\244\350q\003?\021\025x\b\341\037\202b\312\212\037H\n5\250\370\253P\240\301\203\277\307\t3v\360K\231`\347\224\203?\352\304 \024\377\r\023\202O\3745J"
+	.string	":\361\317(\341/\006\277\f\022\370\226\370\245#\\\037\211?I\204\275A\376h\b`"
+	.string	"\331\003A\320\373cW\203cw\206\035\r\211:3\354}7tc\330\311\214\220\333c\277~\240\005\f{\030\017\262|a\267v\020\207\307\236\307\001\333\026v.\033\254\325\261\333i\220&\307>'\202\032\307\236%\203)n\354o\030\214]ao\273\300\t\033{\025\013\226PaW\013\021Fe\257V\260%\205\035\215\202\"f\354Q&\370Q\306\376D\002\037N\330\307\"\230Z\302\316\004\202'0\366\260\007\234\222\260\1779@\027\303\b\373\221\006\006\271\330\273\030\020\364\212Ze\261k\201\b\364\212ZM\331\261>"
+	.string	"^\261\337\300\327\233@e\020v!|\275\t\224\362\360\203\335*\371\347\025\265\362\301N\305\327\033\277\270\016S\354<8\350yE\255t\260\357\340\353\r\237\r\016\366\034|\275\371\"\345\332`\207j\323\274\242VN\203\375\tI\365&v\247\343\024\257\250\025\023{\2148\243+\261/\361\365\306\256\350G\354H|\275\251#\nr\017\016\233\254\341\006d\231xE\255\322p\377\361\365\206NJ\350\307}\206\2577sq_\206\333\214\207\361q\217\351\266\212\312uyE\255\304p\357\361\265\330o\326\260\331^b\265\214i\022\026\215F;"
+	.string	"\303\314\327\307q&\246\252I4z\324U\374d\276zS4\032\215F;h\266\370\f\224%\261\271 V[\337\254b4\032-\301\355\245\277\274[]\257\021#\303f\213/\201\255\267\277\341\023\237\230\307$\210\344\203\314\374\"i\274\367\253\030\215*\225\340\346\322]^0n\255f\371\025{\231\274L\206\315\016\177\b\270\365&6\206\344\203l\2013\277d"
+	.ascii	"\360n\362$O\302\351\313\306\337\230\244?b.K\352V\003dp\212\360"
+	.ascii	"\257\230\271\373\003\317\322\334\360\177\305+\f\331_a\006F\311"
+	.ascii	"\325\360\004\316e\315nCf\027^\360nb\277\251J\276\356\224\376"
+	.ascii	"\210\205\357F\376\231aH\300\260\233\204\037B\351\217\230\033"
+	.ascii	"\256\345\230\215[\213\013\300k\336M\315\376\367\221-\264?)$\037"
+	.ascii	"d\177\367z\317c\022D\362A~\300\373\231aH\300\260\233\374C(\375"
+	.ascii	"\021s\303u\034\263qk\261\f\274\346\335\324,7\257\r\233\355oj"
+	.ascii	"\177\200$&\254\312\211\024\222\0172\227%\2650\032\215F\375\257"
+	.ascii	"\230[\030\215F\243\374C\230m\234\335\314\306\331\237\364X\263"
+	.ascii	"'i)\315n\244\2474\273\027;\273\226\215\263g\3318{\021\327\331"
+	.ascii	"\261\\g\237&\235\235\210\353\3547$\235\375\352\203\263\017\001"
+	.ascii	"\341\354B\\g\017\322:;\020\327\331\255Zg\377\341:{U\353\354T"
+	.ascii	"\256\263\373h\235\275\307\007g\347\341:\373T\353\354R6\316\276"
+	.ascii	"\303\306\331u\270\316\036\325z"
+	.string	"FiFi\303f[n\254\213\355o\214\253Y\305\013Z\276\253F;#\2351*\313\267\0265\243\026h\227\321Z\026c\\\3347\034\326guS\307\304\006"
+	.string	"\367]5\276\031\261\030\231\336\276\341\330\214V\240]FX\336\214ln\337nX\323n\352\030\230\013X\276\253F\265\227*\205\2511\315\310\212Q[QZ\004l\373\306\342f\234\002\3552\322\322f\224r\345\233M\357\257\272\251c_-X\371\256\032\243\030\241\024\367\252|[\2013\222A\273\356\2528a\373v\013\202D"
+	.string	"kL^*\023F\261b\027\265\357\265,F%^\324\222P\371f\373\361\203\205\264#^U\252\337iFr\306\255g\226\221\230\2521\213\372\r\247\367>\272\251c=V\230\362]5b\031\211\024\313\320\276\247\320\031\207\030\225A3\006\221\362\3756\325M\035\233\n\300\331w\325he\254*nE\371>\2633\366xf\031\245\211b\2342\323\321M\035\333\001"
+	.ascii	"'\337e\337P\276\253\306\035P\246\216b5F\025\247\372\3117\224"
+	.ascii	"\033\320\256\276ZG\030\241\236[\235g\243\355\236|_\365\310\276"
+	.ascii	"\313\236\240]\356f\244\361\334r4\353\214\263)\331\273\033V\223"
+	.ascii	"o'F[\214M\320.?c5\312xn\371uj\214\3614\362\214\361D\342_\254"
+	.ascii	"M\336\317\350\031\245L\336\277\340\030T\261\344\273jT2\"\025"
+	.ascii	"\217\304\276\227\030u)\016>\211\005\206}\327\275\215\300\024"
+	.ascii	"`k\376\210{J\276\301\362\212gr(\351\373\372\236\303\242\361\247"
+	.ascii	"B\2222c\344\220|'\371R\334{f\361@\022\346\3107\\\223\031\024"
+	.ascii	"F\364\276L\361\3726\242W\304\203vYyq\351\372\206\323{&\273\024"
+	.ascii	"\270\276\253\305\273\227\252\245\324\031\2051\332+J\211^[\337"
+	.ascii	"\\F|E\271\033\266\212Y\264\276\353^\211\016\205\254\357j\021"
+	.ascii	"\256\350F\244*\362\235E\246xE\253H\025\254o8\275?\222;a\272F"
+	.ascii	"\205\350D\344{j\246H=B\004\355\206o8,A7\023\256\276\253\305\263"
+	.ascii	"\242\331\020p\310\367\225\221_\261\354\231\0256\2448&\344\333"
+	.ascii	"mM\333\211 \337\325b\223\342\222\241\025\310w\020#4E\260g\326"
+	.ascii	"\030\220\342\227\325\367\\\0322\023?\276\253E$E#\303\267\252"
+	.ascii	"\357\037F\177E\256gV\224*-\252o8?'%|\024y\251PL\213\323!\265"
+	.ascii	"\307\267\017\2435\305\253gV\265\207\020\036\337X\364\3120)a\352"
+	.ascii	"\273Z\004\362R\241\260\026\177\030\005\032\r\026\245C&R\337S"
+	.ascii	"GE\037\317\254*RE\036;\276\335\260\370\300H\320\361]-J\025u\f"
+	.ascii	"\211D}\353H*\342x\213\202\312\361='\346k\004\0345h\354\270\361"
+	.ascii	"\215c\251\3304w\243\030\003J\017\211\b6\276\253EiQi\310T\343"
+	.ascii	"\333\006S\361\210K\215\301\247\3577,/FB\240\021\270\246o\306"
+	.ascii	"7\r\031\3044\320.\353\2143N\337pz]~\200\320\364]%\366\275T\035"
+	.ascii	"\205X\006\032\346\306\312\336\311\370nr\"\362=\263\2562\366b"
+	.ascii	"|\317\335Q\341,}3}W\211a\336\244>\263\352=i\324(J\331*\223\364"
+	.ascii	"\233\t\212\350%\215\364\273NoL\351{\t\007\021/\215\022\227\244"
+	.ascii	"w4,\247\353\2462\331A\002\351\356\245JQ\367\214z\356(J\331\260"
+	.ascii	">\372F\232\"\312A\273\236\202}\364Fb\226\216~\303aIi\351\246"
+	.ascii	"2\301q\363~W\211pD7\366\n\372o\017\342\025%h\225\3477\034\\7"
+	.ascii	"\225\t\324\b\243\265\227J\205)\225\027\310\215\225\325Q\364F"
+	.ascii	"TDjS\321\033\307\320l\370v\323\303\022\370\001\214\263\227*\005"
+	.ascii	"\263\227\351\306\3126\325\3600~\020\313\236Y\305!\034\324\306"
+	.ascii	"\023I\ro\034#\372\306\202%ee\215\007\315w\376\213\357*\261\t"
+	.ascii	"q\t\233\344\342_\214 \202=\263zN\t\026\027\337sXC\357$&yf5\340"
+	.ascii	"\024I\367\r}\003^\340\233D#\317,"
+	.string	"\237\263F\243\321\023\314O D\257\247\220\252'\022w\273\300\373\234\336\025\"\227\320\273\033\226\324Z7u\211\337]\007A\337U\242\326KU\302Zd\r\320\007\021yf5\035q\b\361\206\347Vc!^\ry\"\3515!\3207\0351\310\317\367Z\032\031\016Z\274\005\336\347\273J\264\"V\221\241\341}\210=xL\321\320\363\026 \356\320A\214:\322\303\342[\020q\220 \336 B\035aA\254\3013En\203\345\353<\363\273J\244\001e*a%:\t\365v\236yE\214\361\314j\274)\323s\253\341\254R\267\351\3167\036\326\212\327!BTzf\371\231\225\230\364\334\352\300)\021\251\317\254x?\253\300/\211\321g\226\177\031|ny\235`\331\023\211\317U\340\375\013`\316\373\034\326\231\233\006\020x\t<\005\324@\231LX\323@\231n\354&\360\024\360{f\265\227i\337s\253\347\254f\336\246\023\370\366\022\201\227"
+	.string	"\231g\226S\261\216yn\365\340\224\257\001#\360NE\357\001\017\201\275g\226\363\211yny\2365\314\332\023\211\333M\037\360\316\247\347\200w;,)(d\"d\370\031\276\001_\362\336\030\360\r\270\032ryfu\336\226\347V\317\335\2711\340;o\001?\003\221a\3353\313\321\350\236[-8\327h\026\360\216\246\200\227\001k\250\345\231\345{Y\236[\2167\345g\3270\356i\2448\204\203\316=\2218\235\265\0370lV\001\357{XcC,C\267\007pk\361\363\353\t\0066l6\001\357tzRdb\031\030\340\021\3601\\\2012\241\030V\021Ra\370\030\324\210z\317J\345\311\244\033(\323\207\227V\205\341{O\357"
+	.string	"\217\200)D>\207\366d\342J(}xR\316\016\360>W\2007\200\031\321\243M\305\206P\236L\274\202 }xO\312\n\360\217\206\325\004\t\006-\374"
+	.string	"\236"
+	.string	"cP\246\022M\336\244\033\253\020\312\013O"
+	.string	"\261\367\253\361\302n\364\205\201)y\341\033\017\313\205\037@\222\367\313\251L\221\334\350\013;b\304\205w*\002\370\026\272\336/\357\263:\031r\005\351\013\333\322\022\300{\237\236\030\325\005*>"
+	.string	"\317B\021(\223\211\351p*\024[\341Y\270z\277:\317:\344H\237\226\220 +|\347\001\340\003`\365~\371\332\017(}ZUT"
+	.string	"x_\303J\361*z\274_\216fJ6\344\3614\363\b\270\364iMI\245xG\203uEI7u\311\016\013N\370\024^\205\357\352P\007\224\311D\3270\307\025\212Wa\304\020\352\375j/6\236f\335"
+	.ascii	"\224\032O(\276\275\240\360)\334\fg\274_\316fuz\232y\222K\223"
+	.ascii	"\f\024\336\331\364L\370\023x\2304dz\277<p\032\215*\235`~>\031"
+	.ascii	"J\237f>\301\215>+v\2704T\362f\267a\263&\274\007b]A\322M]\002"
+	.ascii	"\025\342\304wux\364R\251`\035|\236=\321\212Ra\224\211?Ae\001"
+	.ascii	"\211\272\001(|\200k\324\230\370\256\363\032\254\240D\2323N%|"
+	.ascii	"\2114\326L\2322dJ\330\352\246\202\005\336Q@\002\337\236\360h"
+	.ascii	"\204'A\215\005\303\205\257O\317:\3027\034V\221n*\330\232\273"
+	.ascii	"\tD\360\362R\231\300K\023\302\213\300\306ny\277\032\304\025\276"
+	.ascii	"1UM\242Q\245\022\375\306,\304\336=\255\020\355\310\330\262\232"
+	.ascii	"D\243\321\023\3152[\307\332=\333\334\236pY\206\315\206\360\375"
+	.ascii	"\246G\344O\002\020\276\253\354\334K\325Q\264\274o\031\316\203"
+	.ascii	" \307\302\271\261oO:\273\347\226-\303fq\256l\005\376\r\211\200"
+	.ascii	"D\333K\225bj"
+	.ascii	"\345\273n\236\304\273[\027v\355\375b\251\260j\317\274\347\227"
+	.ascii	"\247\336So\330\354M\225\255@\2611 \315* \030\361]e\253/\225\t"
+	.ascii	"v\n\224\351\306z\305\374\f\303\236\261fl\224\347\036\337\223"
+	.ascii	"\314\223\314\260\331\021\017\002k\254\312\314\003\035\374\007"
+	.ascii	"\337U\366\311\233\324\202V"
+	.string	"\226\354\005\322\327\327\341\301\177`\206m\302\304\203\367:=\016\276\203\207\200\356\351\307\212=\321\200\261a\317?~\256y\006>\003\207\315r\360>\230b\212\221\314d\261l2_,sjh2%h\0069u\226<9AN\027\313\007xGD\210\021;\"\210<\004\202\207zjX:0\224\243\323\364\300\314\246\013\247\220\313C\316\245s(\307e\032\206\226?9;L\237\025\313\241\236\235\234\241\035\037f\017\017\b\036b6]8\227L\036#\013\027+\230;Hf\272\360Y\276\310a\372\354\364\3448\203Z\f\355$9\260O\220N\2203\250)\224\363C$\224\243\344\037\"\241\234\035\246\016\020\214! \0279\314!\027In2wz^\0045\205rjh\372,{\232\314!\0179L\347\362E\217Sg\231\303\334\t\372i\366,!\340!\037&\020\320\262\205N\016\004\f\024\324\243\323L\362Os\231\343\034j\366\360\344"
+	.string	"\005\345\370,u\030`\261\374qy\271\302\206ut\226.\333\320\"\207G\b\351\301\206mh\221\374\3006\264\350\300#\344\223\303l.\211v\232\313\026\036r\210\2260\\\336\001Z\256\330Y2w\214?.\206vz\204\\>\352\350,m\3309\024\024\264\"\207\207\307\31095,\177h\350\021\032\312\341\341\341\300BC9L\347\322'H\250\311\303\343\201I\244d\240\240\036g\317\020\320\262\351\314\331i.\211\232A<;L&O\003L\264\204\221\263\303t.\233,\230N\240\236\034\346\220\013e\316\320\212er\307'\250\305\020\263\331\302\331"
+	.string	"3w\202~r`8{^,\233,rz\234@K\017\013"
+	.string	"\3529\200\023"
+	.ascii	";=B\311\235\036!\233\036e\222kX\3720\233-\013\271\330\001\352"
+	.ascii	"!\352q\231\207'\310\351B\247\205\2163\b\210\003\321\022\006\007"
+	.ascii	"\266\241E\216\b\036DP\262\r-r\200`\354\200`\033Z\344\f\r-\205"
+	.ascii	"\210\202|\2229M\246\323\247\207'\347\247\311t\356x`\246\016\320"
+	.ascii	"\362\305\316\322\206\201z\226,r\220\f\324\363\223\2633d\261\374"
+	.ascii	"\361a\276`\372\020-a\020\231\205\027bh\241\343\354\02122\013"
+	.ascii	"/\304\340\343\023\324,\362\220\263\347\247\307\247\035\3524\213"
+	.ascii	"\274#b\204\221\207t\232Fv\002\365\004"
+	.string	"\t\321\260d6W\344,\205\234\034\230\351\\6s\226BN#\007\t\325\300\314i\266p\032y\247\347'\247\331\302Y\344\026$\230>=<AM\241\034\246s\331\364\tj:\201\202tptx2\030\032b\352\0045\205rvz\204<\360O\020\020s'G\007\bF\007\241\240 \037#7\203\206\200\23028\201\230\315\246\013\035\033\346a6\235\313\025/\212<\302\205\b#3Y,\235>A/||\230:\316\345\212\027\035\234\313\025/\220\354B\304\263\013!\344\350\350,\211\274#b\304\216\210!\267\\\203\210\032@`\231\351\263\324\031\312\tj\302`\201\254a\371\3232\323\307\351\fj\266p\002\365\374\264\034\324\343\\6C\304P\214\001\311;\"\236}\226/\232L'PO\210\027\220\314\374Y\002\205p\362,\233+ \231\371\323\343t6\227\316\241\020,\202\f\240\344!3\235\313\035\006\201\204\b$H\030.\235\314"
+	.ascii	" yHD\210\016\206Dp\020bHD\210!\0216\f\024\3243\324\363\202\331"
+	.ascii	"\364\300\316\026,z|x\200\226L\237\025Z\036\022\361\314\024\202"
+	.ascii	"\341\f\301l.\211~\232=-\3308w\334\t\364\002Q\220\001\222N\240"
+	.ascii	"\027Z\260\350\031\200\323\205\220\323\005\f\315 g\320\217\007"
+	.ascii	"\036\027+~\351\\\262\300\002\250\247\2053(\350G\006\235&\007"
+	.ascii	"\326!QC\320\n\032t\226>+p\200z\226?8:\315!\034\022\025p\220\020"
+	.ascii	"\263\211\343\f\nj\342 \231\231\313\220\372\207pk\221i\202\306"
+	.ascii	"&\354~\207M\355\"\240\\\0174\266\347~\207\256\365N\314\354Z\317"
+	.ascii	"*\220>\211a@\351\246v\262\365\232U\374\340\340\240\036\220g\375"
+	.ascii	"\2167\213\303\264\325\301\327^\344=\353\277\315\361f\025[\034"
+	.ascii	"^\344\277\313\031`\225\223F\363\005\315\336\017\326w\265\205"
+	.ascii	"\262\2665\212\316HLm\240\024m\2653\330\r\204\265\353\246X\017"
+	.ascii	"Bo\207\235\317\r\357\323&(V\253M\333\030E]EF\212R\233+\"\357"
+	.ascii	"S$\355\022\221\357<=\277z\277\341\253M\202v]\275\253\345\220"
+	.ascii	"\243A\310\373\220\357j{\004\305j\264A\033'&\300\"\265!`H5EbB"
+	.ascii	"\336\317\260\240\340,\020$\215\365L\021\223\"'E\251KF\n\344="
+	.ascii	"\b\031\322\f\020\341\223[O\325\273\325w\025I\006\212\325g\256"
+	.ascii	"\036\237\333\306\364\343\335\352\tR\314\017\252\367*3$\030\252"
+	.ascii	"\367(NVZ\370\260\276T\2156\365RtV\204V\224\272K\244=\336}P\221"
+	.ascii	"]\236Y\336\343\233.F7\225\013\331\035\013\036[\354\\"
+	.string	"\"i\310\271\"5\244\\\221\216\"\266\242a\263\316C\270\324M\345\342\204\247\331m\350S\337Ud\334\233\204\302\3726%\365>e\005\331\366~]\221\212\013S\023\023\"1\211B\272\253\310*\3105\327\351\007\273\251\\\214\334\355\354\370\256\"\323^\252>CR[\2776\244\224\"8\344\331\016\264?@\035\327\361]E\232!\237\264af\260\222\376\221\033r\254\b\016\331\004\351\244(\213\\\021\035\335\260Y\327\021\026\206&\366\267\302\243\276\253\310%\310\260\326.\307{\0242\t\362\353\231\305\255\305EvEE[\206\315z\216?\323M\345\322\343n\211\343\210\227\332\215w\034]\220[DZ~\003K\230\02413\315**\340P\337Ud\021\344\264ub\343\035*\017yE\324oC\212\366\032\213\020\267\241%\354\354oL\216\327\370\256\"\201 \177\264XO\3575\276 }\274_=\327\243h\257\337x<\225\t;\023\333\243"
+	.string	"\215\357*R\n\251\243\3351\343\235\206\036\022\307\373\325pV.\n\203\274Q\264\327nS\026\346!\241f\324\205E\371\0033\001\247\032/UGA\322h\225\232\336\235\370\220M2\232\252\204E\021\373\"\001\031\337U$\023rI/\306\273\f2H$\344Q\214?\274\b0\r\006\256I\337\231\314\034\325\374I\007\305\266@`\351\273zD\363R5\225\251_\221_\021\232\242\024\211D\351}\351\357X\206\214\222`\335\003<\211o\017\t\304\221\336\223\212\326\034\301\034\255G\275\242\300\242A\243\243\243a\263\216$(&\347"
+	.ascii	"?\372\256\036\275\274T-\005\317(\311h\251(E6y\364\375\210\351"
+	.ascii	"\270\305\356xg$\303\311\210\006\215a\263\036\035\323\025\370"
+	.ascii	"\027\327\200A:9@\301\357\301\032\307\270\267#\234\021\024\016"
+	.ascii	"\243\250\250a\263-\b\370\347\306\200@,/\225\n\323+{\200\337\201"
+	.ascii	";\216l\357\227\332q\315h\252\207\021\025\325\260\331\006Dse\206"
+	.ascii	"5\337\325c\332\221z\264S\363\275\346\335\355\307Q\312\373u\246"
+	.ascii	"\246\205\271.?\266\005\374}W\217f\307'\307\2664\337\177\357n"
+	.ascii	"\322:\266\236b\323h\276\323|K\217$\371 \367\231o4/A\240t\214"
+	.ascii	"\337\367\231o G'DG&\307&FB\256\214\210\020\0316\333~\337\324"
+	.ascii	"\026\202\005\031\234V9"
+	.string	"\241\"C\231\357>\2617\251\243\034\301\216ef\276\373\260\216I\220\230\371~#\363]&\353h\304\213\214\232\256\272?\252\002\256\337c\276\253G\2567I\205\243\326\321\b\337\367\230\255#\326\224\357\033\313\336\367\265\353x\303\325\236\013Z\272\350\244$@\314w\365(\344\b\344\370#\314\267\030#\307*\242#U\230+]tbf1\200\371\256\036{X\217SG'\275o0H\216:\336\257(\275\271\277\262f\0250x\371\266~W\2178\246G(\243/#\260\242\324x\346\313\267U\354\370D\343\3137\234^\336\267\027&G'\242cS\236\013}]pbN\232U "
+	.string	"\357\273z\214\361R\2458J\241\320\274.\337xN\216IDG\244.U\272\336\304\226\034\200\313w\365\030\025\274\262\345\233\013\231q\215\232-\177`\315*\fp\227\346\214\221\314\356\373\316\350\211\321\214\261\214\035\226.\267$\315*\nP7\346j\204\356\273\316\314\030\006L\323\275ua\0213\322\254\202"
+	.string	"sV/F\"r\337sFg\306.\306-F.FhF\324\210?\250\204\201\033\214\210\220\351[\2162dffFf\320\200\002s\033"
+	.string	""
+	.string	"\307\2214La\231\007\024"
+	.string	"\017:z\224f.8\234P\347y\212\344yL-\004$<\213\2718I\021\201\276\343.8H\344\351e\003\303\3011\373%F\306k\212V\370\330\253\204\373\234\362%(\226\305;\322\033|\261\321\035\246\001\234\030+6\247\221\233\247\231\232\272\b"
+	.string	"\323\346U\205\027\270[\206K\200(\261\330`\261\350\210vz7\230E\320\204\034*)\0278\337\347\034\227\301Er\2448\231\023\2051\370\347\322s\206jb\3758\341\230\235\036\037h\263\341\336\t"
+	.string	"\223\005\3403\363\267n;\002c\032\032\236\376\342\"`\004^\346<\335\242]\201\f`\350\220\242}\234\356&\030R4\233\222\340\317d\330U\004\336\0275/{c\031`\331\034\b\310\2415N\354+\336\313\002=\341~'\254\007\364\267\2262\3448\204Tl\275?y\001\351\312\216d\241\232L\323Ek\r\353\257}\013\t\207\205\fJ\212\305\362E\324L\036\326\377\376\243W\217\307\2467(&\240\214\275)p\323\270K\373\240\230A>Ep\377\032#\352\315P\260^\323\353\306\324\376Z'\351B\336$]\224]K\267M)G\377\326S\241\334Q\350rb\024\272\254\020\035~\375\"SB\027]\020"
+	.string	"\350@\236\346QMD\f\307\376\250\310\233\025*o \352\322\326[\376\364.I}A(<~\230\026z\272\351\356Am\240K\206\255o\334T\222\252\211R\300w\350[\245\250\250\340\260\323\326M\262\331W\240y\376m\321iA\033\334\252-\3232)\225mE;\3522D~>\320pQ4\331\237\310\223|\365\tP\310o\311X\031\006\002%\nn\360\004\031 \300\324\210\3148\232\003aL\210b`t\256_(\331\267--eK\216\314\235|\243^[~\032.\364\023\276\356S{G\2429L:\367\206 \342\372\345\362\337\3433eb\302\034\247\177G\374\206\250e\340\327\330\241\330\3460\251]"
+	.ascii	"\201\"\250a\200\271\234L\305c\224\330f\355\026\270\210&(2\323"
+	.ascii	"b\247\353w#\027\005\344^5\323g\312\377\033`\341/\001D\263uI\204"
+	.ascii	"-\001t\3764[Z\371\324.4\314\310\347\314\362;U\374\205\303+K\215"
+	.ascii	"\311)@|JV\n\267\365L\027\r\306v\007\320\244o\027Q\211\230\005"
+	.ascii	"l\231\177#\352\314\240\357\334\312\031\324\b\036\277p[^\222\354"
+	.ascii	"\223\365\020\240\326\332\314\214&)\252\263\356\201\247\300v\013"
+	.ascii	"\304\r\\\004\177\212\303l&\313f\230\2366\344gv\267B2a\313 \016"
+	.ascii	"\360\231T$B\356M\315\f$.U\351Q\336\033\233'\217\274\327G)\202"
+	.ascii	"\372pjP\312\355\201#\351%\n\236\227\034\323j\370\245\"}WdxDQ"
+	.ascii	">n\352\234\221\202\260\316j\342\300\342%\265l,\367z\031\363V"
+	.ascii	"\033\343\371\305\327\242/\350\3252b(\221\270\355\013\340\340"
+	.ascii	":\325\263\333\002+'\006\022\004\302\266\376\210]\337\313\207"
+	.ascii	"\344\220\340\001e\267H\336\310\035\262\013\272\331\275\311C\261"
+	.ascii	",\356\375@\355m\231N\340*\341\316Y\222rA\364!j\t12\376M2\317"
+	.ascii	"\0233jRV\300\267\244\303UE1\257\326\377y\364\240\323\254\354"
+	.ascii	"k\242\365)\f\2317b\335\303f\341u\30559\256\251\217\230\352=C"
+	.ascii	"I\233]p\306)\035\271=\215\303\333\013Ad5\3640\246\307\bB\340"
+	.ascii	" \020RO\304*\365\234\231m/K:T\252\200\3456|\r\343W\312So\n\314"
+	.ascii	"\221M\321\035\321L*\334r8\335d\314Y\326\262\264n\013\317\325"
+	.ascii	"~ *\256\314\221\031Z\375A\200%j\033\r\250\301luJ\260\356u\026"
+	.ascii	"\202tsh\243\001\221N+M\374\254\336\3214\024Zn\001F\227%E3\277"
+	.ascii	"\002\371\023U\320\274L\004\352v\016fQ\315\331\006;\2560\232\001"
+	.ascii	"\215x\263\240\225m\217\377\307\331N\336\327e\202\003\224s*\330"
+	.ascii	"~F\211;{@\036\231\t\274\250\342\310B\001B1\035\365\001\274j6"
+	.ascii	"\325HT\304\001\217P\340w\330\005&9\227h$S\244\\\322\235\177\202"
+	.ascii	"\034\263K\013\2255hu;\026\0066P\f0\350O%\345\343S\361\320d\265"
+	.ascii	"@\365<u\275\350\"\022\337^\022a\233\331\031zL`^<\320\252k$\313"
+	.ascii	"\250=E\313\360\017\300$\332\312\242\255\354\032\320\224?.\205"
+	.ascii	"\234$\300@\371\003,,\224\202\310\0346\346\331|\t\216\326\b\334"
+	.ascii	"?\333b\333\310\2169P\316/@\272\"\\m,\357\344\301\023\226*#\215"
+	.ascii	":"
+	.string	"\230r\354\200H\314\251q\3775-_\213W\255[\004k\033\315\256\353:\017EH\277\201C\232\200\375`$po\302H\272-\b\240U\3311\201h\375\f\264\002\272J\365\330e\325\016[A&\213\306\002S\254\331\313-\t2\254\311\361Jj7d\232h\332B\273\363\b\346\332=O4\037?a9\304j\213s\371\365%(\230B:v\373\301\2249\252\265\372\032\364\232\232\021\340\377\217\276$\333\247\252\200\375\340h\223y\266q6lp_\027\301\320[\362\261\367A\243\370S\357\300\310u^\232|&`\r\226r/\352\323A\364/\005\325m:q\216\333\330\027\r\037\006\344\360%Sk\243\353[@\316\244T\354\027\322\211,V^J\324@$\337\333\222\035=\370\306h5\222\276\0045\303M{\201\222\321fDv\241]7\320\"C\213\215}\377,\002\356\256j\220\374\207C\021v\224\332$\261\276\006\016\3515\031\214"
+	.string	"\002\257ST\301!\001p\336\032%~k\301\362$h\203\241\277U.]\3731BB\016\030\265fuc\016\257(4\200\301E9g\363UO\3243\310#Gg\220ZRb \336\311H\022t\313\202!Ry\002\214dh\nl\200\002\334\005{@\315J\035p\231\3705\355\207\276L\021\003#PI\260\204\272\270m\300+I\264\225\227K\341.6g\366g\001\272\312t\365Y\3611\342\003\002\322\224\375\031\037 -\003\252\270\314\254j\325?U\254PmH\035\177B\327'N2\345tG\343?2K\034\373\022\220VH\323\346\313$um\262\007\306\n\302\351E@\252~2\211u!\361V\306x\266\t\354\214xe>F2|E>\375\303!\355I\"gG\247\354\023\310\302\310"
+	.ascii	"f>\212sP\224+\031s4\355\021\354\026\030\226\023\006r\002"
+	.string	"\f=\222\232!\327\016\341$r)tKYP\005\273\341\210\\\350\264\f\036K\200\032\272\213[z!\177\216J\327\224k.\361GI\264\231\037).\224\357\211"
+	.string	"~F\360D\352\235\262\365"
+	.ascii	"0\335\021\231\221?\202\306u\310\025q\353\b-"
+	.string	"\205R3\256\253\355\206N\340\215\361\2533\007\340U\240GKQ\021\320\320\351\006\301\273\276\236\314\367+p\310A\027@`G\177\200y\024\004\017\221\300=&Do\315\004\305p\357\353<eF\337\001;+oA\273Mr\345\373Q\245\273\204\345]\210\2543>\003}`\302\313\316\242FNsj{\234\303y/\263\352\214c\301\017\237\233\265\024i\254\372\340H\200n\267\263\325\005\317\tpF0\320\254!\177x\334h\334hDe\f\032\205\324\317\362p\264\334>\306\342Y\016\3300\357\272l\035\313\314\372\r\357\007\013\301\276epMs$\307\244I\3554R\036B\021\215\320\360\016E\343\315h\213r\211\r\306\360\212\026l\263\006\320\262YF~\345I~\320S\025\275K\304%vm\360\364\354\344ZC\324\233D\240\0319o\366\b<2\264\245\007\352\274^g9<\270?W\277\256hX\020:Q\337\031X\035Hf\315"
+	.ascii	"]\007\304\252\322i\312\003\306\211\353\203'\320\263M\313\013"
+	.ascii	"9\30320\255\241\177N\213\244:YIT\360rd\237\333\245\314\"\361"
+	.ascii	"\356\237\r\354X\367gO\034\264d\373\263\341\365\370UeD\275\246"
+	.ascii	"D\325\261\020\373\274\0225\227\241\264\314\366\226\326\224\371"
+	.ascii	"|%\333\007\333\257\311"
+	.string	"o[\340\313U\2169\322\215u\325{,\r\356\306\373\304\b\205\330\t\\\322@cU\035\026\210\353\3558,\207\257\b\376\356\341\204\223\332\302*\265\342\261\312\306=\304Q0\033\377\370\036\213[\310C\230_\303\002W\334p\213\177\321\320\204,\351u\300^\037\017\253\007+zt$\227\206\036*\303\334S\212%\363\335\234:\023\313\032\253\350:\341DS\215\217d\240\256w\237\220\237uu\275j\317\366\374\2512BJ@\251K|\f\361\274\257o(\346oK\255\021e\204j3\365\332\300f\350u\325\273a\377\006\177et\234\027\330O|\335\177\350\213?\b\227\345V\276\312S\216\274p\243\317\252\2071\276\244D\216\356X\017M4k\034_\216\370'-4\036\327\375\031\221v\375{\031\356G\332g\335\205JM\325}*\365\356\270\006X\035v\024\226\244\233@- \375\234\332\025[\364\206w\357e\373\360w\223\226<&y"
+	.ascii	"\206\240\366\261\270u#\233\363\231\001"
+	.string	"\201\001\275i7k^NM\305\326\262\230e\337\004H\277\003\270\220\201\207Jt\026\311+9\301\231\301\350\227a\033\314$Mbq+\363\031\251\016\207\330\202\247/N\326q\211\214\370Npe\213\225\322I&6\246\376\236\"W\260,\310@\016\334a\313\231\370N\220\372\321\266\f\346L\246Z\221\031{z\202\274\207\244@\017w\311\236G\362\242[\206_O\3330\360%*\315\305\026\324\323\224D\253\261\013G\321\033\330j\033Z{\3478\207\276\372\207\346\255<\377s\005`\214M\346\b\244\330!\331\323\315\340e\333z\356\036;\327\2714X$\016c\247R1's\033M\363\306\374J\303}5\273;\306\302\273\016m\321\247\036~\303b\344$\302\324\233\336\371\341\275\322Q \332\225\317\237\325|0\252\333|\222\207\220\302U!\327+\210\217\373\323+d\2756\006\214\373\016\025T\234\311SY\354\025\tV\001\223\364\327'\272"
+	.string	"T3\272\203\274\366\341\370 d\334\"\332\022\035O}z/\034\377\241\204\362\246O\274\321n\317/-]H\332"
+	.string	"\264\302{\216t\306\030\377\241\027\211Y3Os\2168\243\210\035)*\271jN\0278T\002\207\3779p\245s\252\350m\270\313Z@\341\030a&\333EX\236"
+	.string	"2\350\337\325\037,p\021\211\356\2114\245B\360\337\267\300\247C\314\353J\337\337-\350&C\256glh\031|\343\376k\207B\364,s\340h\255\200bt,\243\002*\255\032B'-\335\203\256\264\321\222\203 \277\333\233\244\364 \256\232\337\327\247\204\204\370\344x>\327\340^\r\322\235#\t\204\310\267q\316\026"
+	.string	"\367\312\211D9V\305\037\214\237\r\320\017q\232>\254\031\351\354<\225\347\334|Q\005\361\301%\034\311\377\305u\3030\324*\353\204;\036\214\211c#ud\250\2535\334\254\344vx\370^P\032\221\364\203\255y\361\2025\341\241\004g4[\244\353\210\304\240\016=\"\343{\221\23004k\2745\034n\320c\261\027\264\226\320\002r?\201\370W\300\335\027\262v\215\230\377B\344?\002\261\323\200\335e\324< g?\013\331\237\002\352~"
+	.ascii	"y_\300\371+b\366\212\262\373\206\304\177@2\327\200\371)\300\020"
+	.ascii	"\356\346\311\244E\276\304\026\221x\345?"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.160.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"]\f"
+	.string	"v\227TA q\223\016\220\350\374\312\007\031d\300`\004\315\226|$U\217\224N\301\204#\307q\037\024\226+X\377\206,\274\320\262:\231\222\230Z\036\020\020\340\006\2458 \332\214\016\\>\353\035j\021O\366\2262\245A"
+	.string	"B"
+	.string	"@"
+	.string	"\357\005\252Ck\366\3129\222\315\260\314\350\220\332\261\273\227\236\320R\373\323\324\374\313V\372\263D\256\017A\n\211\224\200\315\364\030\230\250\260x\367\f\331N\231"
+	.string	"8\273\353Dm nx\333\021lC\260\217\005?\371\341K\247\246o%X)\tq\0170v?\304\226U\2015P\330>\306vr\177\241\035EC\206\300\236\272\220\007\326\2419\353i\277\305]h?\331\340"
+	.string	"\273%d\320\330\345\034xc\035.\370\201\35201R\264\220\250\216\370\327T\251\235\316\306)yx@\214Q\3075\3255\365\034F\230\236z\312\005\277\304\243\217<\352\243:\274\276\373S\261\002\207\211\b\220\2146WJ\035\261\377vw\255&\354\243\374U\030\t\223\360H\241\017\206\017\264g\223!\353P\360`\025:Wh\002\006\272<\242\321\265Q\340\314\302Gt\221\262Lta\270=\007DMN\003+\302r#\307r\333\340\331\343\032c\214\357\222\225B\265AY\036e\250\245\007\025"
+	.ascii	"`\251'3\340\324a\233\205\225\"h1k+0\230h\003Z\220(.\362\244\241"
+	.ascii	"0Lh\350\032P\f\243\201\360\233\232\002\367\202\251)\343.7\325"
+	.ascii	"\036\rL\355\001"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.161.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\375\001\005\022"
+	.string	"f\341vH\320\362&\035P\030\261\006\316\366!* \361\017\2042\035\355OJM\211\214u\324\367l\200@\346\031\331\240\177&\375\373\205z\022\022\017\212\273\333\002\272\320\rrM\177\310h/\r\261t\347\033v\260\246\214a\203\354-eJ\001`"
+	.string	"["
+	.string	"f"
+	.string	"\334e\374\twi\337\330\335\345;\273\354&\001;\023G\301\315\250\007\tj\316\351-\211\273\316\311\270\352\362/\373\310\007\342\234\003"
+	.string	"~\270\364\360\030\007$\t!\225\200:\321@\314&{mG7\256\320\260\365\224\200<QeH\350\307eW\r\340K5\304\301\234\323\372\201?w\310m\277\330f`+\2049\032:Dm\032\013\372\357{\245\033\241\355\2658\366\354\245Kd?\316\035\262WM\022\325\335\252w\325\272\352\233\020\270\3018<\210\307\234\033B \323&c\224\370\354\267\357\243x\355\346GN\020[\352n\344\323\236\342*\\\237\331|\376\314\177\260\233\222\323\234>\b.\335\"r\271\362\2246n@`q\211\316\302\221\254\252V\303$\fC\037g\341\272%\331\363\204xih\337\305_\254X..\334e\267\257=\2328\261#\006\344\227\323`R\212\346\234\013Jz@\314\370\236v[D\244\357i\367\264\243\300`\002\037%\"d\261Kd\335\257\252\226CG\243\354'}\005\214\017sLK\372-\356R\267"
+	.ascii	"\016\240\251\232\324\203\032\031\326\005\326\210W-\030Z*\230"
+	.ascii	"U\212\202\312\223yI\305x\253\031\032\257E\305\255\n\254\031\257"
+	.ascii	"\246\325\232\361\272Y\316e\177\006\246 [\316\2768\2338\347\210"
+	.ascii	"\006\237\375\264\007p:\322P\206H\321\364\261o\354&E\231\035z"
+	.ascii	"\350p\232\263y\340\362\032D\236\350\217N\213\300\031\305\226"
+	.ascii	"\240>_\002\347\327&\244\364\237\245\003( @\002c\030R\036\240"
+	.ascii	"\352I\002z\230\223a\345\002\322\261\267\2647\366\272\371u\202"
+	.ascii	"\027\313t1\340\255Z\022\354\204Jz\216P\235\230\350\003#\264\017"
+	.ascii	"\347zM\020\317\232\226x\340\210\3059\023\027\207b\274;\020o\242"
+	.ascii	"A\024[;\366\\0\276\370LX\001\342\340\323\030\240#\261\310\202"
+	.ascii	"\367\331,;\031\230="
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.162.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`y\002\245\024"
+	.string	"\226$\203I\260\324Q:\370\f\006\036=X\257L36&G\203'\350\277\226\220\251\375\317\337\234\227u\353\351\236:F`j\255>\244#\254hS\343\337\2769\347\320M(}{\262\362\317+\t\0010\377q\177F\215\312i\376\330\233\354\235Rk"
+	.string	"d"
+	.string	"t"
+	.ascii	"+\246vH\355\366\260\234\272\205uj\336S\352)\353\003\352\251\215"
+	.ascii	"c\213\247\027]\263\243\b\350\254m\301\324\r\017JFvw\234C\257"
+	.ascii	"\275\322p\312\232_\362b\222\323\331^[\272\021\247\"\036\206*"
+	.ascii	"K'\224Nt9a\202\035\360\350?\0359Ot;!\202\335\375\321%\217\016"
+	.ascii	"'e\311\313\356Z\346t>w\311m\307\330n`K\032\001\364H\2071c\355"
+	.ascii	"\336\236\363\227\376\"\306/:\265\314\214\372\263J\323 \237\373"
+	.ascii	"|\f(\026\300\235i\263y89\205\354\207\273\273\236)\354PZ\254\322"
+	.ascii	"-*]Ci9\245\177R\340\212)\304\203\232vA\004\217,\220:\2518\357"
+	.ascii	"\267\357\267\370\017\347>\273\354\250\214vW<\222\337{\322]\324"
+	.ascii	"\316\273\371\372\354}\002_\251\255)\316\357\230\300\341x\016"
+	.ascii	"\n\025`$L=mM#!$l\330\274'\263\313n\210U\235O1\031\n\200\037@"
+	.ascii	"N\257a"
+	.string	"\343\223\231\215D\2737\013\365\264\316:\024T\305SBN\373\302{\260\024\242\335e\360\\\221&\230_$\347{\017\257vQV@7\031\224\273k\233S\310,\377|\375\200\344\310+\007\220\341\255\243\036\351L2\031\237\001\213\311d\365\001\256\032\327\203\232\231\030\207\230\211a-\035h/\031\230\013\303k\234\211q\315F\030\315\206\261\345\200i\031b4c\r\215F3\212\274\333\217\376\017PO\300\333\304\325\233p\027\205\203\336\005H\371d\260\007\213h{\242$\312\376\020\t\"\265\274Upz\211\204\252\310\373\336\203P\223vTF9\003\217P\375\237\204\t\3629\323i\263\017\240$?\341\024\372J\025\347\353\307#\030\fV\0058 P\2021t\310\035`\352\311\003v\370\202\302J\t\370\316^\211]2l-\336\272u\304\tm\201Y\240\223\210\255\275#\354\324\222\254%G\301\2279\034\334\253\244;\253\327H\003\313\210\354"
+	.string	"1\254\037\204 \210\320!,c8"
+	.string	"q\200N\226!\360\305O\212\306\016\002D\016\3324R"
+	.ascii	";\016\264\343$;p\247\323\211\246\313l\203\340&nG\352\f\325F\230"
+	.ascii	"\340\016\036\215\2119\"\302\242\355\331R\233onk\203\036"
+	.text
+	.section	.gnu.lto_blackboxShouldLogGpsHomeFrame.165.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`^\002\275\022"
+	.string	"v\241uF\340.'\035\303\3103\314_.*\322\346\034D\317f\336p8\242&\306\300\230\351k\236\n>B\367\305.,\332\336\211\006\305\001{\307l\316@\020\303\f\213u\265\277\230a\353pe$\344\300\r\024\033!{o)S\ne"
+	.string	"V"
+	.string	"f"
+	.string	"<\2659mjPs)\036q\260\355bw>\200\300\305\255"
+	.string	"1.\030\035O5\260\0201\346\fZ\355\206\267\276\311\bW[\276\353[\203Y\221\216\013\242\017\303e\204\004rT\\\340\370`\020\300\n\235\027\335\027\243\020\246\373dt9\276\027\354\230s\376\347J\363\311\250n!sN\353\314wss\267\355\262\255\262u'\02729II\221\217\272\252&\003\367\340qs\316\005>\320;\250\370>\217fi\321\317<\372-\362\361\373\237{\340 -\345"
+	.ascii	"\035\275h\315\016r\351\312\354\303\271;\266\325\033\253\356V"
+	.ascii	"\255\241\352\024TsP\275\251Z\256:\252\032\252zU\255\252>\307"
+	.ascii	"\235f658\017\033a\250\211\333\224^\200\334\226\333\313\314^'"
+	.ascii	"\216\342\001\004\021\021\371\270\255\202\236X\\\271\207E\275"
+	.ascii	"\350&F|\037\263J\3643%\3621\356of%d\304\016Wf\270\273\032E\302"
+	.ascii	"{\022\017\221\312\213\230F\300}R\217\3524\021\273\fz\256sN\327"
+	.ascii	"\356\227d\310\tFg\200\360TL\226\360!\025\017\2369g\202\017\001"
+	.ascii	"f\201X\360HNX#($\253\t&#)+\326\n\313\nd\200=\n%+\253\n\236\267"
+	.ascii	"\262\352\202\346\341\334\035k\274\322Q\2364\320\214\240\337\222"
+	.ascii	"\3779\007\365\224\201f$\377\226\334X\032\333\033\353\220\227"
+	.ascii	"}m+\363\326\264\210b!?d\267\353\344\332?\244\306v{X\354\205\344"
+	.ascii	"@c\237\242)V@\210\246\024W\346\324\3127 \220\002\031);\017\240"
+	.ascii	"\365.\037\272\006\023\212z77\267B'\rVd\025\311\370KF\023~\261"
+	.ascii	"\nd`R3\032G\334\216\036\245\037qX\274<\t2\303\177\253e+\375\027"
+	.ascii	"\242%\256\nH\200\236\241\001\020mc\277\362\361\034aA@(\276mE"
+	.ascii	"\262@\363:@\221|\332\336Z\204\030\307$\343X(\021Zh\207\027\265"
+	.ascii	"\343\230Fd\201\373T\324\360\270P\007\236\025Bu\212~\323\233`"
+	.ascii	"\312"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.166.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\001\002\265\017"
+	.string	"v\232^C"
+	.string	"\221(\035\300\251\256I&uiV\227&\372\210{\021\353\341m\307NGj\323N\007\302\264\0048\217\266\227\373\236:\322\321\261n\254Hf\347\213T\325\237\266\027\f\361\357#\237\005\217-!m\334{K\231RJ"
+	.string	"B"
+	.string	"P"
+	.ascii	"\273\032jr\254\f|I\261}\315${F\200\013[BP\003\004\252\345\265"
+	.ascii	"\273\233~8\351\360i\222\374\016\020,\245*\035nL\3762\225\311"
+	.ascii	"\025\200\252\344\025\330\335\213xfP\2352;@v\327\231Rm\270\343"
+	.ascii	"m+\260m\300\316Q\251\307\340\341\364\021'!\342\243x\204$\237"
+	.ascii	":\364I\342\3415k\301\330X\231\262\306^)\245\262\354\277\325\023"
+	.ascii	"[\323\034MkOg/\215=\275\321t\3244\314\364\313\264>\235O\337C"
+	.ascii	"@\n\n\207\207p\005%UV\246\033\365\260\300(\311\033\3064\323\243"
+	.ascii	"hL+\316\342A\207\343\342!\246\003b\2546z\027\024MT\227\267|\""
+	.ascii	"\324\210\342)>\020@\240x\b\365@\313\245\362\364D(\252>\226\233"
+	.ascii	"\b\205t]<TM\340\242\303*\265\304S4~\221x\r\346>F\235'\304u\""
+	.ascii	"x6\t\240N\310\306\211F\266\017\002\356&|D\033\205\256\023m\332"
+	.ascii	"\312\376\255\236`2p\310\230\364\004=\322^\300 \237\262ji\237"
+	.ascii	"\262Z\374E\003\013\255\230\327\fG]*\256)\007\306\201\246\243"
+	.ascii	"V\214\312\352\023_*\264\\\257\231\334\3357 \300\002\0311\243"
+	.ascii	"\007\340\2527\"t\252\004>\3765q\356\345\262\366#M\t\204\206\030"
+	.ascii	"\263\211BQ\2632\304r\312\314\022\360\350\223\024\343|\331xl\304"
+	.ascii	"A\003&+\1777\244\270\321\263;{\341l\334\371\260<\ro\261\225\267"
+	.ascii	"\311\273y\026;H\324l\374b\325\265K\035\310\030n\220\243\266\370"
+	.ascii	"\225\251\331Q\033e)KL\023\rE\207\370\032,\224\211\006lO\036~"
+	.ascii	"zki\031"
+	.text
+	.section	.gnu.lto_blackboxLogIteration.167.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\300\006\305$"
+	.string	"\026\375\334IpXR:?\360\357?\253w\366i\263q\302Z\276j\032z\002 \373\341\344\310\324\331\025\321U\324\001\347\327\377\taa\3742\027\005\357\223Y\317\226u\240P,y\367\330\231\254\375g\363\275\365\264u\267Y\377\244\021B\366N2\306"
+	.string	"\275"
+	.string	"\315"
+	.string	"\274\356\376\355\376\330\231\355\2332z\227s\025\233Z\316\316\006\355\303^\r^g\275\232\036\300z\265\333\356\267"
+	.ascii	"I\271\370`\314\231\222Y\\\316Y\210\263\336\036\347w\343\353\331"
+	.ascii	"\360jv\254nUS|\333\276\016h\267\224,\036\347\247\274Iu\252Xq"
+	.ascii	"y\033\222*]0%\005\207/\r\262=\225\336\206\234J\201WTr\357Bj\335"
+	.ascii	"\236\016\310\246\r)\365.d\324\345)\241n\2152\rv!w\334]OU\323"
+	.ascii	"\323\331.\244\323\325\265!\237\322\240\231\322]O\366\236\252"
+	.ascii	"&\345\325\034O}\311$^\362xq\252\303\004d\311\227\234\221.\200"
+	.ascii	"sB\346d\2774\222\306{u@9\347\276K\311\246w\316\273_\241\273'"
+	.ascii	"t\257\024\002_#\321\337\272\332B\303\341z\365\207\177\366;\366"
+	.ascii	"\365\234b6o\224$&!\270\207\326\035|\262_'\251\256*a\254\270\035"
+	.ascii	"\357\\\367\231\274\311P\177\253M\020\335/\021\255Ww\360\227\034"
+	.ascii	"\201\2254.SL'\244\033\355v\032/\306\352>\216F\243\321\306W\335"
+	.ascii	"5\267\2035\267\201\273\333<\273\333;o\3769\273\333\277\335\355"
+	.ascii	"\036{\233eo\353\330\333+{[\325\335Nu\267\361z\373\256\267\337"
+	.ascii	"S@\313\326\215o\245\345\314\024=\223\237\352Z\220\276\222/9\272"
+	.ascii	"\263\035\210a\211;J\362\263\026\\\234Z \271\331\213;[\202\330"
+	.ascii	"\030\260\027\3357\3622\030w\366\307\304\322\360\256v\303\350"
+	.ascii	"\346]M\003\2758\250.6\277\362\213_\325\022\271\370\242A\321<"
+	.ascii	"y\030\253\337\026Y\203lRd=\302Xq\373\345'X\2018\210W,JN\306\033"
+	.ascii	"\355\227u\373u-\3552\013\020\277\354\227\371%f\212Yc\264\036"
+	.ascii	"\023\r\334\347\267\313\265\273e\266d\370\320\271\347qwA\f\024"
+	.ascii	"\f\331o\243\311\024898#.\262P\316\263\305\254E\234\312\024\036"
+	.ascii	"LA\331D\272Q(L0-\035\306J{\017_\257#l\030z\370fW`L\003\313\240"
+	.ascii	"\246\241\3714^k\016Nm\035p\2737\004A\305\002\334\034\334\315"
+	.ascii	"\241\003\0324\354y\304\305!\252\316\355\006\021\342~\251\357"
+	.ascii	"\006%\3624\342b\177\331Q\214JG\254\277()\257\342\317Z\304\237"
+	.ascii	"\214`s>\376\364\235\004F\037\206R\020y`\241b\210H<\032\366z\350"
+	.ascii	"\343\242\250\304\211\241\020\212\022B\025DB)\204C\242\221\320"
+	.ascii	"\007\330E+\206\210B\026EED!\317\211\3644\343\253\336\275-\237"
+	.ascii	"H\330X#H\301[X\232s\3168oP\317#.\nP\373\342\361c\261\256\301"
+	.ascii	"=^\343Eb\231n\216\246\321\311\245c\322\270nV\254\342{5\203\237"
+	.ascii	"iuX\210\320\335&o\246\275\3613\267b\013\312\265\034"
+	.string	"\217ku\034\320\352\366\351eZ(\240\326U2*>\216\245Y\230o\351&\304\207\261:\305\030\277)u1`\036\246\245\352\321ZYa\bnX\207k\263\330\234\363O\377\355^Ze\373\243\345j\271\326\253\030\307X\"\221#\340\303\231\325k\203\274!\007\f\t\272h\320\3503\200\224\250q0&\215clDDA\222\202\024\322\001\260\002\221)2n\020Hgj&I2\034`\307\241\272\3248\222WQ\230?\t\250\260\021\273I\201\317\371\r\323\006\033\266\225\372\263\025\202R\323\201\312\234\321W\2629.`\003\266I\342\322#6\370w\032@\371\b\325^\277\305\201\311\352\026\"*\"\360\351ZE\002\251\232j\177;\177*8\260,T\020\270\361\243+}fh\300\210\233V\317\230\371\312\355\303\213k\271\301D \035\231\244\211\252\b\235A 'n\304'\352n\230\025y\305+\347\243X\b\364\255\266\2444\322\235\204|"
+	.string	"\216\241\261{\003\337\3135\210\blB\210\211\235\020|\212P\213\246 <\267d\330GD\215\267\200\225\016\200\237\261\225f\212\036H-\034\204\250\253\324Q\303:\374\317\265\212\300\002\300\016\357\246"
+	.ascii	"\370\244\221x`\310}\207\022\007\272\312I\f\377\213~F*!\n\234"
+	.ascii	"L\030\372G\334\342\016\230\264\216K\334\034g\244\265A\352\310"
+	.ascii	"\263\300[Kv\t\236\206\0246\337\314\233\352UiW\003"
+	.text
+	.section	.gnu.lto_blackboxUpdate.168.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\036#\315\205"
+	.ascii	"Z\313X-M0\016\333\031\003C]D\202\346xe\324\345\217d>\373EX\372"
+	.ascii	"\024\177\236LOen\336\0207]\236\217;`\234!\225!\364x}\2060\200"
+	.ascii	"\b<#\\A7\335f3\206{\030(\373T\240E\004b\300\316\223.?-\257/\267"
+	.ascii	"L)\245\320\002\206\002\317\002\274\026\235\237\350\354C\347\356"
+	.ascii	".\027l\326\352\264\374\221}\f\316"
+	.string	"\027\253:\347\215\n\341\240\364\233\356:\3566=\265\321z\314\2029\007P\352\246\363\334~SCk\310\252-\232t\341\334\351 \326\0063\361.\0066k\030\352\316\216\271\216\241GT\3167\253\207\255\t\310|j!\267\330A\323t8:\312DV\232t\232\236c\276\321N&\240\257\314\rf\034\314r\031\240\371\231\225i3:\306\240U\001u0\307i\341\032#\334\262k\242d\302\265h\343z[\023\245\215\0053\215\227\376bB;\271\323\230}f&0?\363\356\330\244bJ\257\367}\265\364\026\024\332\311/\206\017\005\346\306\322YRh'\013\305\364EQ2\337\367%\266\2209\005fb\013}\210\314\334\316\334\314n\272\235\266\203y\336\027,\355\355}\235P\\b\247\205G-\304\266p\355 \266\205\3542K\333)\366r\370\033\263\332\002\370\276o\324\2079{u6\017\335m\316\302X\330\371\302E\001-\b`\261b"
+	.string	"\001T\004"
+	.string	"@\n\024'LD\225\200\"\361\344\324\304\2644BIDR\b\244#\020FED\037<t\3400\264AHCP\006\240\037\237\036c\2218\344\341\265\035\035V\270\276\273\334\236\306f\255\356\205\254\251\346,\214E\255W!`G\037\316\316\027Y\252\356b\025\242K\222\347\244<\003d\320\013h\261\246\250\002\364*\006Z\331uYr\216\023 (\307Y\254\300\n\005\262BcP2\r`G\344\257X\201\200%A\366"
+	.ascii	"D`G$\240\013@\325s\025l\001H\001\310{\343)\244n\034\005\f\200"
+	.ascii	"'L E\315u\211\2714\016u\207\306I<{M\322\025\305\353\2473r\356"
+	.ascii	"t\006\006o:c\306\231t`(\020V\346\216I]\322\201\001\246\345\326"
+	.ascii	"#\332Z\251M\n\306E|\351\244\265\003\027#[ZM\322\313:\342,\212"
+	.ascii	"\326\323/\036\242,\371\202#\271\255GjO?\002\241\346Fi^\324F"
+	.string	"\304\364\017o\036\256x\0078\016f>4\246;kC\\w\226\320\223\262\244\023\327\240&\371\244\211\007\225\251I\222y\006\035\030r\235\324\025e\236\0011\361\037\261\36612'\346=\353ga#\323\242i\306\244\355\272\334\370\325E\257\365\210\315\227\023\327\026\210\217V\223T\256/\246\334\374\265]\021\037\352\300X\242E\244y\232\007\221\346\265\243\367}7\200\035\257|\007\251,\311\345:l\017\027\"\201iI{]\235\246a\374ZMR\272\na=A\266Z\373U\026\225\177\2332]\232hgP\306\254\252\206YGV8\006%k\260\244\264\350:0\336\367eGfi5#\320\314B.fF\200\331HEC\343\237\271a-\2753\353\342\033\037\004\030,\257\342\206\355P)~K\361\322Ht\212\237\361RV\315*\361\313\032\031\307m7\213\035>\361\273\207\362\211Cq\263\334-7H\020\266\205\303\35724>*\027"
+	.string	"\316\363\314n\227[\344\210\352\247x\347y\336\337"
+	.ascii	"\375\316\267]k\300\226\306f5\310\303\253\234FH\324\f\317/\271"
+	.ascii	"[\247\n\353I\214W\342~\261:\337`kx&\234\235\315P\226\331E\342"
+	.ascii	"&\361F\352\274?\365\232Q\252\235_2\373\353K\255\245a\273v\303"
+	.ascii	"X\341\263/\354\353\241<zu\351an\230\022\263\313\304\227\270d"
+	.ascii	"\"\356\336\367U\321Bv%\276t\235p7i!\273P\\)\256\024\266\205\302"
+	.ascii	"W\302K\033Q\305\265\342\215\\\321\334\263\006\236z_s\272I\257"
+	.ascii	"\210N\bo\301fF\301m\352\005\211R\2614\330\177\251#g6 \2067\362"
+	.string	"\277\361\364\266\232\332MzYQa\002\322)\2213/\320\2007\222\033O:\027=\376T\017Ryf\375%\027\261*|\253\365N\234\2656T\036\310\335E\254\277\n\317n\305ut.\357z \202\t&`[\350\237\003\215\314Y\373uO\337\033\340t\312\005\235\240c\320\377%{\020v!D9'\323L\213}k(\347G\024,\366$\317\035\013\354-\354|q2\315\334\007;R\207j\346=\330\255\330' \323\354\310N%\244b\371\313>\265R\005\271\007\037L \267\034\357#\357_\227(\357\221?n@\226\356tSP\245s\345\216i\326\307\314\322\327\213N\265\322\221o\323\372~\371 s\307\351=\n\270\233\260\005\030x#1`[\330O\001\232(\312&\027\017\2572;\217\376K\346\376j\265j\206_\t3\321Y\205\242s\tFg\035C\347\034A\3168\214\316RF\347\033@\3164f\020\235; :C"
+	.ascii	"\344\314@\247u\307\350\272\346\024Cg\024C\347\023Cg\023E\347"
+	.ascii	"(\242s\211\2423T\321\231D\321\371\311\350\354dtn2:3\025\235\227"
+	.ascii	"|\234G\024\235\225|\234E\020\235\223\212\316!\212\316HE\347#"
+	.ascii	"\2423\b\243\263Q\321\271\250\350LTt\376Pt\366Pt\356Pt\346Pt\036"
+	.ascii	"*:o\310\340,\004\344\254\341\3079\310\350\234!\2033\020\220\363"
+	.ascii	"\317\217\263\217\321\271\307\350l4:\027}\234\211>\316C\037g\036"
+	.ascii	"\242\363N\217\263\216\321\2315:\013\215\036unyBc\3201\244\"\031"
+	.ascii	"\036\324mS\255\305\342\215,\202F\251~t\323^\230#\327z\356\235"
+	.ascii	"E\251V\2704n \210\276\301\326\210\336\237{V\242G\243\017\355"
+	.ascii	"\226\017\337x{E\242\307\275-\277r\353z\213X\370\267\26660ymm"
+	.ascii	"D\036^H\013\237\255\227.\\Z/Z~K\313\366l\275x\021\343\341\215"
+	.ascii	"\224O\346\354\2550\344\375\340C\355\255\371\306D{;3{{\363\320"
+	.ascii	"\341\253"
+	.string	"P\201\372)\255\033\353U\366QZ\274\026L(\230\207\362OZ\267\346bB\235\260c-\224IX\013]\376\2226\214\230\026\ne\353\360F\312\2610U[\035z\034\201S\302}y\301\021\351\202\203\343\300\341\2054w\213\307\372\003i\345~\353\205\330g\265r\217\365\311\226\214\231VN\216m\341Ss\027\016o\244\\r&\216\024\347\341\2265\035\362\201l\251\277\002\223\267\372\036c\330\305z\252?\216\0313\224C\007g\303\361\337\270\3018\3019\035\027H\215\213\373\037L7BbZ\352\347\276\252t{ux?o3\2617^\352\3315V\\G3\334\242\361\276\226\216\357\306\267\231\366\246\025>e\223\307\212\263\005\rC\337`\022x\277\335\322\325\265k\274\221C\325\240_\272\221\336\340\200\267\323\247z\256U\177\201ri\373\206\365z\343\246\305k\2016h\306\255\033o\343Z-\335\221p\274\366Ms\241\r\002\276/\325"
+	.ascii	"-\2743\321N_\323\356\371\210\325\271]k\371i~\343t\272vo\207}"
+	.ascii	"\316\243\255\336\332\302i\367\330v\357\355\331\366\265\177\336"
+	.ascii	"\310\ro\364U\365z\211\364U\273\325z\330VMR\247\031~\311\315\035"
+	.ascii	"\307\315\\\320\005\206\352U\242[\216[\252\223a\350\0061\2718"
+	.ascii	"\227LH\f\332I\2569f|-\007\347\206\t\211\205\321\201\303\306T"
+	.ascii	"2\371xx\265\345Z9r=\344\322\025\245N\217?\345L\240\204\001\371"
+	.ascii	"\364\334\\G\215\365\364\034\215\277Zk\241\357\2625\274\013\204"
+	.ascii	"\202\236\306kx\341"
+	.ascii	"\226\f\037\344\345\205\fPI\346\232(\233?>\035|\317\321ua\353"
+	.ascii	"\340\233\256\227\270\350\235\365\374\222}\306\212\315\246\025"
+	.ascii	"t\247\\\2105\233\216\032#6\233\266\352N5`\245I\217F2\360WG\026"
+	.ascii	"\310\263p\340\036w\232po\300\266\020\350\373\212\210\3173\360"
+	.ascii	"?\257\323\327\203J\317\373|[\r\362p\252\365\254S\216i\346\030"
+	.ascii	"\177y\242\215\2203\305W\302^\244!\370f\323\036h\005\312\035\273"
+	.ascii	"U\336t\255v\336\227J\005;\2323]\037Wn\013-\260-\204\340\373\256"
+	.ascii	"\235\351\002\240\262\231V7\306\211\025\342/y\005\222g\306\353"
+	.ascii	"\214\305x\352\024\1775\326)\336\325\364\232\"S"
+	.string	"\2533j\350\3001C\212\005\241qX0\243\006\b\025\344\030a\206\224\224\216\017\214\374A\211\023l\310\b\341\003\017D\220\0215\002\b\036\324\210\372@\nGT\t\020l\203\204\031RQ9l\330\220\212\":y\364\372\276\022\037r\212Dy\374\221\327\257f\030\353\001\317\300\277!\255)W\f@\361\r\026\005\305\253\220\206\346lE\322d\222\324)\214'[@\304\362\314\262\354\370Kb\244x\266G\366\242\204\227AV\302w\226N\322\342\242\224\346\245\342\342D\033&'\240\005\354\2406\200\027\030&J|v\241ia\342\273l]b\342\033H\232\033\225k\205\220!{\004D}\203\311\211z\177\0066W#\335\201fq\232@Y\303\342\227\274\202\361\232\244H\360l=\302^D\320+\312\252df\251\013;\256\024G\250x\207\340\352\265\026)\361<[|y\312f\232\223\251\302\"[\361\313\256-*il<\246i\0266"
+	.ascii	"\3247\330:\004Ji\213\317L\331\f\262eK\213\005N\333\004 \3612"
+	.ascii	"vTI4\013njo\324)_3\214)\027\244\252\370%\257Yll\355\324\337V"
+	.ascii	"\3648d#S\025\300\323\367\\yz\235)G\216?\005\300/\331\351\231"
+	.ascii	"\376\245\335\245\351\235\236h\313z\345\206u\334\212t\311\032"
+	.ascii	"z\267\372h\372\216c\372\256\0369\246Xj}DUk\345\215\\z\245\037"
+	.ascii	"\361\275V)=\213\246\335\031\220n\362\203\203\342\351\207\346"
+	.ascii	"D\373\225\211R\231\360\321\343V%I\235F\375\222\006[\275j\207"
+	.ascii	"xY\323\r\220\0179\350\246\304/\371\251E\240\200\325fy#E\274?"
+	.ascii	"\375\232\032\202\b\222\201z\323I\337O\326\332\314y9IMkyS&29N"
+	.ascii	"H\374\222\233*\224\362%O\331\364z>\237B\2741\315\217\306V;$\304"
+	.ascii	"7\032&\356\204\364_\366q\215\364\r\347\b\325Ou\323\321K\255\265"
+	.ascii	"\211\363{4\202\264C\206\260-<z\026\315/T\256\254n\362\373\212"
+	.ascii	"N\271 S\333\245\326@O\277\256\245\032\353\373\202\275\230f\361"
+	.ascii	"\352\b)\217\361\325\032\361\313R\372\245\025\013\202\271E\362"
+	.ascii	"y\256\325\273\001\361\r\2049H\225v\377p3r\204:e\376;fv\223\322"
+	.ascii	"\035\261\267\303~\224a\002\276N\027\0241\202\267^K\333e\017\035"
+	.ascii	"c\260S2\221=\335\206\261\334\323\226IK&DR\205$\351\227\334\315"
+	.ascii	"\304\352x\031ki|\252\325\352_3\2619^\007]\216\357i'mq\271S6\271"
+	.ascii	"b8I2\377\250^F\317\334Bi\251\033&t\207\214\363g\036\215\033&"
+	.ascii	"\245\2352\205m\241\321\267\264\205Z\314\277\263!t\f\032\242\333"
+	.ascii	"*,\2163\312+X\366\352\360\276\314\233i\253\264V\3323?c[\210\343"
+	.ascii	"\373K/\005\202\344\250\342()P\242\222132\"\222\024$I\007\222"
+	.ascii	"\013\020\204BY\022cx\007\022\340#1\310\204R93\"$-H\n\231\016"
+	.ascii	"\340&\20624\350\317NO\357=c\315\035\n\273\214\362'\323\315\022"
+	.ascii	"\312\005\345z"
+	.string	"\337\227\025jA0\0026\335\334\210\300\346\246\t\211)`\337\317Y\365\001\016*\302'\273]\276v\340wt\204\355};v/\300\003\272\023N\231?z\247\353[\323T[\314R\217\214\262i&6x\037\217q\t\022\233Fj\337\271Ce\247\032\370\375\022\275c\204\370\225\343\331YJ_)\230V\201\267q;Pl\267\016\023e\314\212\214\3370q\337&\204b\310\027\211\330\023E^x\356]z2W\243\376v\323{\314\340/B\243\3324k\312\0218j\364>\374\270\335\277\346\355\034\247\006\341f\025\027\242Bi@\t%g\331$\305\216w\242L0\336\325`\271\226\212\307E\023\007\243\257\005\016\352d\223\227\220t\270\262\032{?\351\357\341\"\223\346u\024\356  a\322\256l\256 K\001\347>\332\206\313H&4wax\317y\247\230X\220\301\213Kz\334\333\246\304\330@\210\301+\363\344$\013\236v\241\201\026"
+	.string	"\277\237\\\351\256n\330+UA\332\304p\214\031j\271\333\226-\031\206\213;Gu\253c\030\017#E\326\236\203\356!:\222\253s\033\250y\007\301\223\023z\356\200t\264(\261"
+	.string	"!\333\251\204n`|\200\016b\030\326;\344F\311]\321\021\b;\352JS/\027\336\273R\336\252\316V\247\nB>\240\006\323\221\221\002\261\314\276;\210\305E\233g\"5\204?\n\004\273{\216=\251\023\223\264\321dM\304\006\312\276\364N&\305\230\n)(L\217RJ\216\251!se.\200s\361!\326\353\270\004du?\256\231\333\333p,c\250\244\321\327`\333v\004\031\021\232Z\367h\372|\303\235\241\226g\027Vh\tk3[\346K\365\315\016 @\256\204,\254&\f\223\324\244\334\267\244\001\020\326D\030\210\3507\356\376\nav?a\217\273$"
+	.string	"\212\252\2535\t\212\r"
+	.string	"Jg"
+	.string	"\364Lzg\274Y\234\025i\031F\027Q\261\3273i\021\3115\326\003K\210zwL\251\030\004\371e\356\370\032\006\264?\b4\032K j\025\305\002\311j\335\273\213\223\201!\315\351\247\267\306T\322\232XD\002\217\312\261\243}\315\037(\263\317n:J\366e\210"
+	.string	"q\005|]Z\031\251\244\201\007\324\203\273_d(E\250\346j\324G\237_P\326\032V\300\026\326sw\\~\345\225\t\222\r_B%\203C\201\242p\325\273\371\177\251\212\331k\316\263\336\363e\300\230\377T\004,\b\362\357\376N\243_\344\007\265\310a2l\317V\242\035\305\272\302\201\031\233\023\r\330\321I\347BL!\024\227\210\205\324 \214V(M\272\226}0\213\005\227\223\323\003\330\255\016\027\033\236\271\273\030\355\3465\036\353f\007\340G\305m\376>\253\245I\363\017!@\311\216\305Q\210\202\247:\207\341:g\005\227\032K4\272\205\231\307t\256\232=\347\325\034\314\200\302\025\301\034;\310\03712\357\f\3375\221'\207T"
+	.ascii	"\375\303\211@\225!c\343Ubg\313r\032\033\245\202\265m\0074\031"
+	.ascii	"\217\215d\324a_K\027\341\020\356\321\240\303\300\263\030\223"
+	.ascii	"0\361U\206\200s\177\236|\320\0057{\354\033\2628\324\201F\032"
+	.ascii	"\025\326\020\374\322\021\202\321\026Z<\013\350\307b\324\265\215"
+	.ascii	"Qp\025gK(\362\013\r\246\252\204\235\220\316\271\236\2368\026"
+	.ascii	"\372\b\326\243\315\304\251\320#\366\261\005\351\215\323ed\313"
+	.ascii	"$\027\312\020\311\257\337\374'\323\"\354\3429\353+R\254\314U"
+	.ascii	"\313\211b\216\022\031e\354\327\246\303$\256\242\254})\017h\204"
+	.ascii	"PbD\024\016\036\341\272\377\025]P\210v\031\266\267oA\256\b\027"
+	.ascii	"\245\314\257\267\370\375\020\221\025\342\234\260C7`\311\246<"
+	.ascii	"\375%\353\327\300\330\264g\f\007\336\312\217\374\325\007M\024"
+	.ascii	"\003\035\304\265+\340\315!\237\264>\022\377\356\373Hjf\241*"
+	.string	";\034\030\204\320\204\327>Y\206\273\211mJ,^L\324:\316yw\304nP\376t"
+	.string	"K%\364\244U\017F\332\236\346\305\270\340\222\370S\216_:\347;\201W\315h\351\367\341\221\266\240\027\244\212\316\004E\310j&\314\213\230\225\tR\343\273#.\332\351\020\224D\246\254\265s.\240V\266\311\203N\332k\312\247\327\323x\234Im\200\007\205\271\320\261@\323r\322@X\333N\376\240\300\301eX\225zv\2330\311\236\367\210\3772oI\214++\330l\377v5\034]\370\233vV\2063\254\341p\243N\245\261\254fP\007\030C4\247le\346\"<G\364\331\251\216v\350#yaD\267,k\275"
+	.ascii	"U\323\272\330\214l\350\020\034\317w\223`c\321\207\340\221\007"
+	.ascii	" \214\244?\006.\f9\036\351.*\227'\352\331{\021\271V\377\024f"
+	.ascii	"\326%\006\361sJp\307\344\362\016L\345JO\310E\033\315\t\235\037"
+	.ascii	"p\317\347&\335*\b\320{v$\016WXwQ\371\316h\254\232\"\226\234\034"
+	.ascii	"\033\254#w\220\313\007\2443\f\274\247\005"
+	.text
+	.section	.gnu.lto_blackboxCalculatePDenom.169.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\315\t"
+	.string	"\246\222B:0\305*\035\236\267Oc\300\236Z\t\265\1773N\006\227W)\216vXfV\207\307]F\226\301\307n0\342q\273\350],d\221\262NU\241\214\200\222o\007\320>!\233H\231R2"
+	.string	"0"
+	.string	"."
+	.string	"\216i\341\006\213\200"
+	.string	"L\365\022\260\273\335\346\231\355Q\373\300\366\250\032\007\237\240\177\2223\250d\260\025\313\364\344\022v\327\271bU\334z\333\005\266\021\354g\002\361i}:3}\213\006$\305\342\262\223]\212\331\200\r\020W<l\2036\306\016\001\034<\357r\314\227]\f\024\225\33550\307\362h\333\027\371\b\350QSU\237\372@\345\314\327\324\253\n\274\344&$\277\303\022\245\374\252\264=^5\034\027\247\234\331\241)5\303\276\266\332\262\237\346\036\376\333]\177!O\004R\270\204H\013\240Q\347\343\374\341Lx\036\207O\347\301\323\211\032:\241\356\363Et\034\215=\b\320\327\215<\357\3530\341^[mq\2729)\312\233\252r\032_\251\220\021"
+	.ascii	"+!\201\245\236L\350\f\n\\\374b\201\031\314\320S\004\306.\327"
+	.ascii	"p\020Z\300&\204\003\346@f`DP\001\007\240\362\230\332I\006"
+	.text
+	.section	.gnu.lto_blackboxGetRateDenom.170.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"r\214.4@o\222\016\323\266cD\307\260:\240\023\r\244\r\036"
+	.string	"\352%\234\221/\"\364\333\246cG\024T(\277~\003\303\360x\016\315\003\333"
+	.string	"\200<\347\276L\333\337D\246S\235\213\352\343@y\036>/\242\301\003\361(k\342u8W\022\f\326\243\250*\353m\266,\222\020\tD\210q\021\261\231LMzRqE\266"
+	.string	"\271j\235.\b\240SQ\300C\344f~\303\034\202|5\211\244\337\215\316]\r\207D\243\243%\226\314\215\031\230\\\231RF\376\320oFH\b}\rd`-\0051*\031\312K\346\3660\244W\335u[\322\205\254\344\242\215\260\272"
+	.string	"\205\314\334i#\216\216\375\r\376\203\377#\n"
+	.ascii	"`\251'\0230\2013\3348T\204\272\3175<e\304[B\220p\347L\355|\002"
+	.text
+	.section	.gnu.lto_blackboxInit.171.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\226\005\355\036"
+	.string	"V\263\266J\260\224U:\257\231x\335\276\037N\245\t\nB\252\241\301\254\225\002\264\363\350\211\034\003\242>|21%\022\264\337/\354\006\345\f\363\364\201{F\336\034\325wT/\340+\357\332\301\345qX.W\242Q\225\362M#K6\331r'\031\245"
+	.string	"\231"
+	.string	"\242"
+	.string	"\300\025?\342\007A%\363$\363\nf\363d\233lc\346r\341\216K\300\n*\227\344x\357\225\265\216\333>#\023\003{\231\256\026\253\264dmj\343\007\233pX\226\354z>\003\374w2\302W\"\241\342\321\024\216\240\035\217\031\352Q\030\315\253\254y:y]L\032\324U\243\0360\002\232A[e\r\216 \033g]\001\022\252\007\356\275\367\235\306\b\210GK\031\267\344\217\271kAkYs\357u\355d\274\353\202\236\224\0301;\237*\300\n\321\323}\247.v8J\313\232{/S\335.\350\f\340\3147\300\314\r\230\311\t\001\367]A\020\251\250\336\217\307\340\374\2453}"
+	.ascii	"qs3c\210xT\302\211\021\317\344MtjCI\307\035\313W\362%;!xx\354"
+	.ascii	"\311X\022\3573\313Or\244\031\277\007\217\240\321\353h\366\344"
+	.ascii	"\207O\320\245JH\357\350\313\215\236\314B\034\355\"\346\367y\236"
+	.ascii	"'w\016fK\031f)\277*e\263\244\354\252\224[\2262\313R.+ek)\223"
+	.ascii	"$\345Z)wS\246M\371\bbND\030\347\"u\357\213\263\352\026I\246\037"
+	.ascii	"\314|>\222\017U\374\210]@)\025\314\302\bN\242\374\367\266\233"
+	.ascii	"\352wu\021\227M6\213!\025\333e?w\345d\273\001\017^m\262\003\344"
+	.ascii	"\216g\356\252\245\305B0\251\b\275\367\366\2600"
+	.string	"\330\312\027\236\005\003\353^\037\b\374+\307\222\201\337\343$k\330\260\301\236\254]\013\"M\001o\364\254\367\336[v\027{\212\316H\273\273\241rW}\252\373\231\245] \351\250\364s\004G\317W\301\375\232\330*\345d\243\221\210\211\214\320^\244\302\320%0VnT\326\275\215\345Cy\024\033\016\035:\330\223(\200W\307\373\320\365\212\335E\261\317\354;g\270\305\207R\361\223\231\007\332;\254\343 \005-g\246\203#\"GF\202\007g\204L\247fB\346 \306\264\022;5\331\t\032\255&3\205\267\327{\325T\2745\216a\315_\242\267\017Cn\250\225\316H\357\271\311\276\032\326\37712\373u\232\f\202X\345\350\375x3\\\005\004\312\330\210X\276\324\2176\"6#6\237\315gO\222@\210O\275_\r\032\312\027\332\202\022\350u|\341]HB\305\251(\\\367\304T\260\256\316\031:Q\270\227\nFW\327\202N\214"
+	.string	"+\254\325Q\327\031Y\335\352\236Bv\331\254\036\240e\n\312\317\021\334_\207\"\026a\341\275\327\264\261\001\200\207\250q@\346\030)5\"\"#I\n\n\351\320\002\021\"\2629\020P\207j\223\2445\340\240$?\252\022\241#\267\262\260w\317\306\267\036r\271\344\"\274\227E\230\005\370\247\2223\304\305V\374\307\315\374q\226ZU\347L\034\333\270b\320w\211\030\227\230\367\344\030dW\253Y\177@)z"
+	.ascii	"\025\206\177\020\006\340%\354w\374<\212\304#.\217G1\246\021\321"
+	.ascii	"LI\224\232\200\007\233\271\027\301x\005\337\217\t)WP\021*\342"
+	.ascii	"\036\035C*\r\241\302Q\002\n\221PFt\030\2364\301q\022\301=?el"
+	.ascii	"\256\3621\305\233\215HX/j\274\346D>\255\215C\241QP\005\267\004"
+	.ascii	"\267!\337\207\374pqO\303\254-\034M\225\203\375\364\365\341\177"
+	.ascii	"N\241\036\307\303K\245\024\202pIW\353\353\230 \277mA\033\007"
+	.ascii	"\222oB\311\301\321\215\262\301P%\367\225\333\n=\245EU0\367\312"
+	.ascii	"\235\003\\\374\276\233\3707Y\r"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.278.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\255\013"
+	.string	"\346\324J@ \213*\0358S(\221\004\004z\022\b\263#\204\260=I \004\220\310T,\025\024%\223\202\310\267\227\217!\340\330\354\030h\357\f\023`\324"
+	.string	"\026\202\303\344\031\356\347>\343\004\036\037\237\354-eJ\0017"
+	.string	"6"
+	.string	"9"
+	.string	";\272\270\260:\301f\273\313=\352\201\213\0165\243\310\227X&\3367:L\357\033p\205\370L\220bw\337z\002\370J\231\021\217\022\313\356\332\201\300\275\3356\206m\013\373\233(R\326RU\326x\270\232\2625\035a\032jZ3\235\231\376C\262\270\006\273\001j\032\326@\214\240\300~+dS(\217g`;d\313\356B\260\002,\262e\022\"\001\246\304`\250Q\177\242\221`\177\240\341t\335\366\b\265b\205RM\330\211\226\372\372\006\257\302\337\331\256\251\037)P\312\232}\007wu\374\004\376\200\362\336\243\017\332\036\257\031\254\330\202\316T>:\214&s\331`8\216\215\013\207\313x>\\e\302]\207\206\207\363\350:\017G\261\235\207\253)O(d\230@\322\022T\225;\033\004\020VlfA\237\273;RU9\252j\310KB\036"
+	.ascii	"g\325\253\333\030D\004\2634\"\005+\020\002\006\007?$X\2073\006"
+	.ascii	"\232\300\302Yp\347\005\213OC`\261\2458\003U\026\002\242`\230"
+	.ascii	"+\334\035&\b\316\210E\235\013Lw\032\030\256\275\242pijJp\353"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_blackboxWriteNoisyMainStateArray.part.0.349.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`r\0035\027"
+	.string	"\226\251\221J\260\022R:\362\350~\2100*:\27271\254\352\210V\250g\246\344\030\207\030\364\247Yk9\006\3104\\\233\207\354\372.\003k1\336r)\345\311\027p\256\354\234\265\233\230\246pR\342y\373&\361]\022+)s\322\310&r\247\024r"
+	.string	"\205"
+	.string	"x"
+	.ascii	"\b\306S\227w\336)\347=\341\251\020\301Z+\313x\3529_\346\312\332"
+	.ascii	"\033\362\234\366\231\336\244\273\t\naI\375!\362\005k-UN\2752"
+	.ascii	"\236\276.@<\r\177\"\236\332W\262\235\263\177\274<\252C\326\331"
+	.ascii	"?P*\324\035\013\022\023\320\017\253\326\n;\335\017\327}g\250"
+	.ascii	"\363y\275\335\367\300O^\017\303\247\311\303\026L\255\325c\206"
+	.ascii	"\233\336\266\213m\031{\243\002\377\213\313p\254%g\333kW\036\t"
+	.ascii	"\265\210\224\256\226\260\352O\231\022k\341\261\355\345\221\320"
+	.ascii	"\213\217\252%\254ZK\330\351S\370,\376\344C}\3521\354\242\202"
+	.ascii	"\001\003\330@**\n\007\343\023\024\203\3644\202\301x\372\"\367"
+	.ascii	" n\242\224\365\302P\213\273\320=\210+\2518\352{UH*\202\324Z*"
+	.ascii	"(\307\237}\025_a\273\314\363'\307|6\\<\323\377\345|\240]\266"
+	.ascii	"\237\"w\024\236z\215\324\352\201C\312)\212\032\001\367\224x\332"
+	.ascii	"\322\221DWT\371\215*\272b\320g%\004j\367\033\356\376,\224\360"
+	.ascii	"\231Y\236\273\273D\200\212\364\314,\002\257\001a\254\265\276"
+	.ascii	"\3703N\243\306\007qj\233\233y\336\215x\372}\214\037h\362Y%A\365"
+	.ascii	"\314\254\271F\336\360a\335\"{d\232\344\345?2\266\246[\227\272"
+	.ascii	"\305\3264=\325\035\216\323{\247\177\266\246\037`\372\\6\324*"
+	.ascii	"\2245\244v\240P\"N\365K\005$\211\233\205\005b\021h\344\016\275"
+	.ascii	"\351\340j3:\201\254\335l61:\tn4\033\r\315\002\222\224\231\354"
+	.ascii	"\340jd\r\365lEBm\346f&\303\231\201\351\330\310r`3\322\006[\031"
+	.ascii	"\340\332\016\215\204\335j5\0226\037\326-2\360\017\002B\242\252"
+	.ascii	"g}v\215l\237\314q\305\r\227dm\0072\363<\277\200vg\277G\016\200"
+	.ascii	"+\3338\347\361\300\300\325\216_\311f4\232xJ\262\"\321\322\016"
+	.ascii	"\236\206\326\2169\256\303j\006M\250q@\004\025\022\r\215\210\310"
+	.ascii	"\004\"C\315\001\300\002\231\242\352\006\021\260\265sES\255w\310"
+	.ascii	"\346?\027\327\227l{D\203~2\027\351\2449\255\354\263\013\336\003"
+	.ascii	"ii\033\375\360n\201\231{\250o\261\347\231\007\363\021\311\242"
+	.ascii	"\3061gz\212_\260o\230F@\205\202\334\212\034\274z>\013C\"\325"
+	.ascii	"VT\005T^\305O\375\023Y\023\364\240\334\"\006\307\320oGW\347\244"
+	.ascii	"\322\001+\275\250\373?h\220\314O\305\372C\352\177G}>`\300j\372"
+	.ascii	"psY-]\373\335\343\002]\311\224\0032^B\247"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.369.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`f\005\225\035"
+	.string	"\366\256\250F\220\\Q:\333Q(\bU3\025\001#j\250C\322\271\003]1"
+	.string	"\261}\311c\271\227\206\253\224E\007\334\250om\217\350\377\267\0040F\247$\200\b\"\2000\321>\365J{a\355\375E\320\032\344\356b\2757\3312\311\215"
+	.string	"\225"
+	.string	"\227"
+	.string	"\315\024@\363\330\323<ks\323\3467\030\235\362\b@\272WGq\353&\321/H\370\301c\201q \277|`\262`0[\231:\256$U\016%\343@\006\332\"#\203\357\364\247\031\007\362\207b\022\022\225{\357\214\221\377\243\301\354\343s\372)\314L\203\231\352OMw\007[f*\004D\3276\301\311\227\263\222u\357\215\235N\"\267\237=Z~\227:\333\347\241\336=.87Yt=\336\004>\366`\270\3672"
+	.ascii	"\037gzf\266\300\3140fz\025\304!q\370\311\237\372\034!\376\021"
+	.ascii	"\326\260\241_n\250\247\235\246\274R\320\314\034:\314\226\323"
+	.ascii	"\305%\304M\033\363\341H\275\021\276\r\233>\207\251q\324\244A"
+	.ascii	"\003\273\2312k\370cD,\020\343!\006\346a>\200\b\021\202#\374\213"
+	.ascii	"\210\003M\367\336\n\374.\3672\202D\211\022\365\364\007\2475\246"
+	.ascii	"\374q\353\"\017h\003\3473\025\302\017\374\226\331O\323\2757-"
+	.ascii	"\217\032\342\0379e\331\254_\316\352\t\024\375\222\377\373+\210"
+	.ascii	"\347\022\2076\246\255'\023\317\361\343\235K\314\257\346\032 "
+	.ascii	"X\267.r\347\370\016]\315\027\314\022\252\374\251.\022\352\001"
+	.ascii	"\024\344a\331]\345\276\321\245\335\001\261\275^=\375\323\035"
+	.ascii	"Xm5A\242\2025Nn\033\235\243\331 \366\350\250\236R\251\362JB\027"
+	.ascii	"\270\035R\231\255\222e\352\227\343\244\303\342OXc\316\003\373"
+	.ascii	"\026\324\266\276\fz\316\t\313uE(b\215\364\313\236\t\206E)B\334"
+	.ascii	"\b\274V\036\342\223;v\260\232<h\230\225E\322r\206V\t\005\252"
+	.ascii	"WY&\326\211\205r\013\245Z)v\212]\"$\2326n\320\314\326)C\007\003"
+	.ascii	",\013\212A3\221B6\244\302D\214\005\212\241\0251Y\315E,\b\210"
+	.ascii	"i-f\265\330\013\032\255\026\363\031\357\\b\f\267\211\3439'\023"
+	.ascii	"3\367\311\252\312\255\324Kd\025iE\326!\353(\211\242\203\364\023"
+	.ascii	"B\253I4\322\216=\352\363\340QE9\024\211'CC\375u\245W\347\021"
+	.ascii	"\321\366~z\212\327F\035$\005\220\324\"\271`d\261\236\326y\245"
+	.ascii	"\256\"\016#:yvg\263\275)U^] \262\271~I\347\177\277/\307%$\016"
+	.ascii	"!\234\333G\357\354\r\034\266\250\310\310\027\225\305CG\024/\200"
+	.ascii	"\210\250\201<\006\035SB\242 MR\031\016\260\002\021\261\252:\021"
+	.ascii	"`\271T'\3226\373s`\251e\205\201\211\316\\:\311\235\220\333\350"
+	.ascii	"K\223H\fnv\2022\237w\371\027l\222\033\021ID\372\r\232X8Ry_\220"
+	.ascii	"\274\233&\224\265\001\332\337\307\347\242_\234\fWQW\215\277\005"
+	.ascii	"\203x\340\300\306\306o\376\035\302\343\200\3304\257n\273\354"
+	.ascii	"\262g\3322:#\241\215\375j\021/|\226\332@\201?w\0168D\246h~\374"
+	.ascii	"\"\325\267\300X\370d\t\251\327\306-\362qB\352\305\337]\211\265"
+	.ascii	"[6\233z\222\251\314\245\202\223 \f\315*\036IK\306\237\3540\234"
+	.ascii	"If\244\036=\3148x\213+|\n!1\224\206\202\323e\232\223\232\370"
+	.ascii	"\307\221\005\203?\314rpM\326rp\034\003\200\rm\376\220lS\007p"
+	.ascii	"\241vzE\257@\\@\352\277\034\267\367b\215b\2401I\376x\0356\244"
+	.ascii	"\333\214C\227\256\303\267,q[\272\005\224\246\374\262(\375\353"
+	.ascii	"\372\037"
+	.text
+	.section	.gnu.lto_startInTestMode.part.0.371.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\"\001\345\f"
+	.string	"v\327UC O\225\016\240&\027\021\005.$\002\240E\236\020c\342\2150\272\214m\251E\236\215\341Z\2763\250\217\3266\214\265\203\267\030\300\240x~|\201\200\f\220>`\256G\272)\203\360\263\271@b\021\331d\357\224\002<"
+	.string	"B"
+	.string	"H"
+	.string	"\333I_f\262\273\356\364#l\233l\221\327\330\262,\332\"\024\325\236\022\320@T\b\251\355\256w:=\\\374\224\233\350\237>3Z\031.\005|\223\\v\327\223\327Mo\033\201m\007\366\305\035\f\260\340\240\240Q\333\255\336\251\264\357\203\274\303\017q\367a\272\007IR\352\272X\227\371\037\365%\304{\220\002\354\212}\313\005M\304\270[+\247\266LN]O\200;\235|"
+	.string	"w\352\322;|@E\212\335\334\351_\261\026!^\240\344\210%\322\016#\310\257|\331\177a\246a\2041\246\346IN\230\347\366m\347\206\275m\264\031"
+	.string	"\215]\f#1\226\003E\301q\220\233\360h\333\r5\346\222\300V#\211\332N\250\225\222G\323\202\n\025\356\210\300\257A(d\260\001)X\260\341\200\230NH\261\306\"\341\313x4\030\b\031\017\364"
+	.string	"\363\3614`\350Y\n\370\013q@O\364}\240\327\331\226\237\033\276\240fjN\330=\234?\373\t\217\377\301\237O~u\352\177\001\033"
+	.string	"\\\tT\323y\262\350\207s\006~u\0234\366g\002\004D\3010W\270.+\004\004A\211\0214\005\"J\2058\352p)\003.S'Z\350&\b,\352\006`\272\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.372.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\001\n\005."
+	.string	"\312L\270\020D`\236J:7\007\266\207#\345K\271\221\231\243L:6\324\017\036<^#\324\376:u\316O\034\3770\330h\373\243\"_\370\024AFy\343\025\372)\022\033\336\3474\005N\f\r\253[k\2445\322\b![&\031\356"
+	.string	"\337"
+	.ascii	"\006\001\367;\320\372\302\352\334{\027\374\344\2464\216Y\205"
+	.ascii	";\037\216\212YU\331\366\337\250\222\367h\265\334m\375\026\034"
+	.ascii	"F@\027\313\215\013B\372\223\223i\367\223To\2332\223\327\253\213"
+	.ascii	"\273\231\237\345l\353\333\2468xo\031\230\272{\223\r~\362R\372"
+	.ascii	"\363"
+	.string	"\350D\350O\363B\350O\346_af\252.^\231\367\236D\273F|tZoy\356\275L?m\0226o&\317j\257'\016Ua0\005\242\247i\273\270\362{\313\253\352\304'Cs\250\224\002v\274.1\363\001RN\371\271\037\210\322\005\326*\222c\330\205s7\373\302\322\312\216a\017\232}?\322\322\003@\264\350\245e\036\335{U\257\254>g\350I3\017\367\324\r\337\036_\331Q\354\266\b\022\353+\207\320\353\n\r\036\315\342^\326%\006\354\240\027\201\026\356\275|\253\261\363\317\231\237\304\314\034\230\203U\001Ji\370jx/\275\267\352c\374)\024\315\311.\237\034(\367^\245\237\341\2171\337L\232\274J?o\tX\221s\277\372\217\213m\355Q[k\017w\005>\334\264\376\254z\311_~\n\275m\313\255\365u\325K.6\277\235\311\240\314P,\372[|\270_I^\333\035\226\255j{\306\266h^k\306<"
+	.string	"m\026\2006\033\241\315\001\320\346\"`3\321\353\316Cj\263\320\345\316A\300f"
+	.ascii	"\300f \264\371\007m.\006\233\211\302\346!\332\254\006\233\205"
+	.ascii	"\301\346`\332\234\002\233\201\300f\024\330|\376\3557\321f{6\367"
+	.ascii	"\223\377\037\364\332\022\226{\177,\371\\\262S\314\223\313\375"
+	.ascii	"u\347{9\030~\030V\353\350l4\235\r\240\213w\177D\353+R\347\336"
+	.ascii	"$\205\307\275\013\177\216\325\313Q\361\021\326\027&\363{\f\035"
+	.ascii	"de\322@V'Hz@\326\301\032\027\274+)\221iR\377\244\255R\246t\327"
+	.ascii	"Z\345\207\223\002\275\037\333\264\305\256H\264E\036\\D\3732k"
+	.ascii	"[\326\200\bzh\231\327+k\226\265\255u0]\261\265\234\220\320\206"
+	.ascii	"v\302\022\311f\245Z\241U\355\347\334c@\203Vh\215\372d\2151_\350"
+	.ascii	"+\f\021\332\312\311@\320\276\214\332\237\237}\202\270\243\031"
+	.ascii	"j\317\330\210\2466\312\r\016V\353a\346\f_\032\2214\374\317i("
+	.ascii	"\265\007S\373cs\245<<'p\303\367\350\001\332\t|\354\212\032\355"
+	.ascii	"p<\036~\347\003j\035\250\361YS^)\257\215Y\324\247e\006!\202y"
+	.ascii	"\304\373J\f\231M\334\316\t$\275{\257\004\276\032O\374&8\320\237"
+	.ascii	"\247u\240v\307\217\r\315\237w\346\256\252\373\260=\307\035\315"
+	.ascii	"\272X{\306L\207Of\257I\034\276\234$8}_o\370z\005\224|t\362\370"
+	.ascii	"n\212x}<\332\360\357\210l\310\366@\271d7\314\302\370\342h\205"
+	.ascii	"\361H"
+	.string	"E\214\f*\r\251')\032g\213?I=\2510\245b@\325\200:9\305\322\r#\n\027)\236^\240`\212\321\342\t\006S\212(\032LK\006\330(\003*\212I\312h\214bR\231\271o\315\330\202\225\275\342\233\371\355r\271\364#\026{\301\343\224k\356*\364\273\364\2235G\001\275{\263\276\265j\245Y\027\024\254;V\2564{W\332\r\355\031\023\301\204\003\354\271$\270\340A\226+\310~oN\032*lT\006\017\262\003\354\347N\"\t\262M\326\330\225\200\036\275D\300\030\243\t=\344\265\002\351o\031\331+\353\356\222:\200\220>\013\340\227\324ED\272lE\026\331CY\243[#\262\024\310\302\332\310*\226\336\213%\201{,\304j\204\337\304\006\372\223\3106\201\261ccj\241#\353Y\177k\310\036\005Y!\3730\017\001\207|\243\365\327fq\307!B\363%\3208\345\224\273\303\271\2222-\b I\177\021Y\235"
+	.ascii	"\260MpH %\001\200\307\250\201"
+	.string	"8\344\034S#2\"\"I\222d8\260\002\021\232\252\325\001\021\3208\006\241\241!)L\222\3758d\377_pQ@V;\tLD\275\2275X\032\233R\266e$k\347|\005\312]\177m\217\004\210\025\2770\016gP\275v\204\353\337\374\\\273<K\234\336\021Q\202\264\343\357T\370\006`nF/E\306\b8\270\270\310\375\206h.\261\b\232t~%N\343\f\224\224`rMV\311\377\354\370\007\220k\332\267 \242\244\0365TZ\201\257\247\243D\242\373\210\263a\222\200t\031\267^\034\233\356~\370B\337G\351\260Q\037\230\204\234\357\337\256\n\223\324\313[\223\213-\351\250q\357\272\016\210\211s\33699(\2459\334\365;\232*\"b\247`d\260\343\351<\266\315\304;\341\220F\177\330\223\357G\273\243I\312\244o\2730\272\tY\376\255y\241\372RD\224\210\257qW\035\354\036\237\025\303\f1\211\23488\334\372"
+	.string	"\325Q\034_T4p\352A\335\236C4\315\224\305\221T\2062N\351!\303\201\201\242^`uCP\220\213_\300\212q\2628sij\251"
+	.ascii	"\331\3040X\251ns\330\362\260\200\0232E\021R\020?@\322:\373#}"
+	.ascii	"6B\252QE\274CJ/\223\330\300d[\274/g9K\225\311\333\r\202\0333"
+	.ascii	"\013Q\310\322\304+@X2\202\032\022\231\362\324e\0212\340\032\224"
+	.ascii	"\310\030\3533\210jg\023+\331\027)G3}\r\325\311\220N\005"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.375.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\215\t"
+	.string	"\342N78@o\323\001\320^\\\237\244\034d]}\304D\234\225\234F\252\265/+p\006\351\251\332\210=h3*\034\223\330\006\206\321\305\202E\317\r\201x\352dG&6\237l\271S\n\306:\026\031\250\001\3738\200&\004\303\347ab\232\304\354\0308\213X\320\346D\226i\363\262\035\377\375\034\036\030bh\206J\354\354Q5\331\326\304\353\024\032\273\342\"\276\363W<T\250\241\234jSZ\316-\216g\022rq&\252\311*/WGl\225-\"\003\244\335\216\225\314\226,\227\022\224\250z!\205\354\356\301\247B?1\302\211%\024\375Od_\327\255\243l\213<\274\3310O\235\266"
+	.ascii	"\\m\244\304\354\356\274\245$\337\256Qn\376\277\007t#\356*0\372"
+	.ascii	"x$\270\004\360\354\2567 \267u\333\t\266\017\354+\004% p\202\241"
+	.ascii	"Dv\244\3457\227J\004\"\201\213\243\212(\036`\001J\031\221\005"
+	.ascii	"\n\026ca\376\270X!j\006d\354\005\315\246\210\3160\033\316pq\217"
+	.ascii	"c\021\304\212\270d\020\321\260\245\200\345\356d\343e\031j(3o"
+	.ascii	"\305\002\250\275\220\234\376\364k\361\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`4\034\365R"
+	.string	"\312~\030\033G\200\324N:\253\002\277\002o"
+	.string	"\263\013\023\257\t\377\304\273\270E\370\353\377\342\277\346q\223\375\202\241\013\310\340\245:\266\270\326J\343Z"
+	.ascii	"\343\035\305v9G\261]J\263,:\335\275;\2065\b\214\256\026\277\307"
+	.ascii	"C\366\354\235d\223\001\235\001\251\001\033B\234\220\320?\203"
+	.ascii	"\250PgJ\203\036\ti\220\375\324i/Eg\330\027\241+Z\256E\177\211"
+	.ascii	"\321`^l/\306\356\"\244@\r'L\243E\373\250A\373!~\027\264\337\021"
+	.ascii	"h\237D\215E.@{\240?K\371h\323\036\212\372\331\037\373\354\233"
+	.ascii	"\350\311gi\336\236=\017\252w\245<K\361(\236\275\016\212\242\351"
+	.ascii	"\230='\274{\321\201\235\245w\264\316\276\210\322\331\343\230"
+	.ascii	"\263\224-L\343\t\345\354\237\300X\252\364\205\026y\371V\035\034"
+	.ascii	"\034\034|\234\375\022\205\2434\272\3203S\343\033\005Z^\220\313"
+	.ascii	"\003\205n\007l\263\007B\225\366H>\035\310foD\327\316'<q*j\366"
+	.ascii	"G[Z0\255\231\017\353\023B\343Z\354m\320\022m\327pYKdO\332\023"
+	.ascii	"\321,\277C{\035\226\323\235}\316\354a\312.G\366/W\276\034\273"
+	.ascii	"\027+\007S\345nT\0367\245\377\304\016'\345mQn\007\245\371D\274"
+	.ascii	"\313"
+	.string	"\223\263\341\2579\271\032\362[\204a\347\002\366\344\327\321\204^\366B\232\034\013\223\216\023^\020\032Cz\227}\020j\343T\026u.{!\272\344W\224\274l\353U\204Z'KbO\203\"93\253\357\204X\366?\350\225\275\217#=h!\252iw+\373\033\264\252\303\b\033\350F\272\215\252\375\246\272O\252\353\212\334HT7\241\354\207\350S\353\021\351\275\337\316\023\326\356\237E\022\r\350\340N\364\206\260\273\207E\243\261\270\244\333v\217\035=\246X,\026\177\264'B\273\033\207B5\030\b\247\326\334\033q*\315\f\345\022r\322\2038ux\377f\323\240\224\317\300\251\377\303\251\277\032N\234\372\223\177;7!\023\370\302\264'\202>\370\367br\204\n\201\017\340\354\353\330\341~B\037S\317\r$\326\234\363\275\034\312\322\324{\304zsO\271\276\274\272\210\347\037DH[\220\232\363\303&=\224\032\220Xg\376\210U\346|"
+	.ascii	"/TX-H\254\031^\347\326\252\322\0200\250?\330'\373!\250\r\210"
+	.ascii	"\267\017A\003#!\260n\"\250\004n\r\246\231\221\311\006\3520\363"
+	.ascii	"\031xT\323\216\254\371\f\030\250\277\036\364\n\354\025\250Q\222"
+	.ascii	"AH\255WSi0\315\371\005HP\374\032oX\207\347[,\351Ji\346\260\352"
+	.ascii	"<\246\2307\254N\354\225 \355\227\204\331s\201\331{}\331\177y"
+	.ascii	"\331\2075\261o\302\304\036\331e\357\204\313\236\311\022{0%\366"
+	.ascii	"I\266\354\221h\331c%\261\324\b\211=\316\262\237\202e/ve\037\345"
+	.ascii	"\210\375\023+K\205\252,\255a\304\322!*K\211\246,\265!e)\216\""
+	.ascii	"\366\203Q\226\026\241\354\241<Y:\203\210\245A\327~\317\311"
+	.string	"\376\357h\337\327d\3577\304\276)\304\036\217\311>/\210\275\036\020\373,?\354\265\370\260\177[\262\317=\354\225<\354\323\224\354\315v\330k\351\260?\313a\337\225d/\005\311~\354\310\336\212\221\375U\221\375\021\034\366Y7\354\251l\330[\275X,v\347\020\331W\235\016\265\233\260\333E\212\025*F\204\250\321Ka7\207\025\034<\254\370\240\342C\212>\372\254\322\374\350\263Zs\373\254^\013\371\002L-C\025\260\360_\005.\253\307uH]\275'\343\235p\363he \273\254\315*\f\274\243\315jO\216RN\200\017\234\177\300et\326z\327F\233\325\232\223\307\025j\263\007]\216 \235G\233U\031\254\327f\325C\233\325\033k\272\254\366\220uY\035\336\034MVg\226\247E+=V\217\274\232\226\272.L\t\327\314\236B\313\364\270\fyRO\251=8rQ#k\316\215\032Yo\272\331\310\252\340&\310G\367"
+	.ascii	"R#\317\305In\213f\346g#\253\f\362\224'\377\006\362\307\003a\350"
+	.string	"\260:c\203\247\036{\340\251:{<u\210_\003CLq\bCL\221\bC\265\313\n;\365\205\n\374\nV,\002\375ts\247\376\220\270>'\210\334\001\367\234\r\362\r&\336\0046\331\346\244\261Sk2O\025\021S\353\355T\231\333`B;\365\370'\337N\325\320{;\365\327\303\353R\025\270\253\007U\250:\275W\241\326\301<x\3765\371\360\036\336\311\254\273\231\356\224\003\023\007\367\266\374\362\352\342\332\322\312\302\262\272SX\352|r\252G<(\370\327\344\333;\231\271\016\323]\2713.\303\341\267\273<\2732\027\336\272Z'V\266\302Uw\352\204\312O\330\351\322\343)\230\377p\363\362\235x\231\211\351\262\034\006s\343\316\267\374\205\275.\327\231\225\255\360\024\324\235\256\2750\356\213\333\342\262\270*n\212\373sy\244\\\371\204\350p\276\343\312\302\344\334\006\367\346\336\234/\342T\242\202\004\007\260\r&\200\t\234\001M"
+	.ascii	"\027\363z\256~ky\005IY\\\002\226\340M\3652\353x\032\261%\266"
+	.ascii	"\336\202"
+	.string	"u|3\251\254\272\364\224\252\261\316\313NSg\347\345\317DI\006\375v\226\t2\252b>\345?-\221MG|\004;\002\223\207\352\\-\226\201\243\220c\235+\f\343+2J\262\225\235\353\213\343g\320\244\320Z,\037\323\024\324\324j\235\253\212\033\265|\214\231\362J\n\"K\234\316\365\007\2330A\302\307'\004\b\f\302\330!\367\340\317\374q\271\313\301\257EL\344\032\334\343\222\330\271\336\320\"VP\235\327\271\322\344\267R\311-\255\367:\327\231\374\227\233Y\244s\225\031v\216\200&\205v\251\316uh\354d\347\032\"\246\265Ou\256r\005\030\325j\375F\321\244\320\250\272\255\227uh|\343#,E\227B\223\312\322j\275\254\031\206\335V\0174\265\262\332,O$\333\032r4\320\312Zc\374\200\276\037s\005ZYi\220\367\330\312:c4[F`Z\323\321aG6\343\332r\247\225\311 \243\253F\266\262\357|"
+	.ascii	"\001\351\260V\326\341\362\r\327CPG\2535[\325"
+	.string	"\371\215f\3537<@\252V\353\265\372s\255\352\374<\207Y\346\322\2344\370LWG,\351\022\300\247\r\346;/\244\325\352\001\314w&\310\037r*\300\247W,I\251\365Z\255\022s`\253\325\233\275V;\231W\r\240\326\322[:\031dt\344AzK\205\220l-u\210\354\263NV\0211\271u^'\353\201t\262\352\364\270\321\222\301y\3610ws\251\317b\036\202-\250\242\320h\221\245jFf$I\222\306\002\f\020\224e-td\036\022 \303HJbLkD$\020\221@d\346\001`\203a\251\251\364\035ih\263\325~\001e\f\177\f\343q\"\026\376\241\331\302\004\254\207\206\\\204\356\0359\360G\353\"\314\323\t\261\351\024h\200\323\232y\204\336\005D\245*\347@1\\Y^\356^\323\034\f\017)=j\f\022\363\234p\372\306\003@\216\2741;&\223\246!P\3572v\251\372\202\222\026C\235\201o\201"
+	.string	"\020cH\023-\337\316\212>\363\017\275\313\317q\363\002\036(\270WU\037\376\fXd\304??\201r\243\033{ \245[\037*\260N\374"
+	.ascii	"ojza\241\3218\361\221\203G\313\255\367\261\375\236\261\255\301"
+	.ascii	"\357CC\211\350\264\245.U\322\333\023\300\335/\250_\005\246\364"
+	.ascii	"Z\360\003\260p!\031\001gy\2651\224\260\274gT\0062Ws\244\271Z"
+	.ascii	"\031\221"
+	.string	"Ve\270R\273\205(\240\255\033J\233\217!y|\020d\277\327\306G_\263O\337"
+	.string	"\211\305-W\275\f\263tP\325\226\t\301\277\276#A\033\003i\261\231\260\240#x\235V"
+	.string	"+\245<D\241{T\350\220\036=@{e\365\003\372\361/Z\236\275\2172\022r\371\024\007\215\031\025\177\341$\222\270\237\354\025\301\217\234Y7X^'\264\200q|\264\260@\314"
+	.ascii	"\003\274\177qm\325\330 \3519\245\023\334\005S\311Z\371\351\r"
+	.ascii	"\320\342S\036yG7\347a\322\347>\2405\243\2730\343s\3163\250$\365"
+	.ascii	"\032\347\265 \365:\f\310\317\230py\375or\374\360to,\277l\335"
+	.ascii	"\351wPv\344\257\240\215\"\274\357C\215}\264\026\314W2\031(\235"
+	.ascii	"V\177\026.x\234E3\314>\t\247\260\026\363\323\360(\200\030\261"
+	.ascii	"\037|xw\3569M\353&T\267\037Dj\315\363w\305\255\246?\337=guQ\337"
+	.ascii	"\266\3619^}s\315\303,?\273\272\342\275\333\303)O\276\276X\355"
+	.ascii	"\313\364\037\257\371\377\260\023\rs\265\020\307\252R\220{\241"
+	.ascii	"\274\ba\f\2457\347a.\005Z\305\033\367\342\204\tD\035nV\265\354"
+	.ascii	"\371\204f\327\247oR\020\310\f\263<\034!\332H\274\022\356\337"
+	.ascii	"k\274\274{\374\344QV(q\023j:\245\265\311k\214}|\264\036\3209"
+	.ascii	"\367f\365\202Dl|<\224\341\330\036\262K\354\0168+I\203\232\336"
+	.ascii	"F\221\275\252a\355\344S\034\377\313\343kw~\255\257\257\355\360"
+	.ascii	"\271\037?\253\333wu\376\255\256\217\345\375\271\234\376\326\323"
+	.ascii	"\367v\372-\216\377\345\361\265\313\031\210\013Vr\217r\2404\036"
+	.ascii	"\374\220\264\351\254\274\360\325\231\237\351\017c8[\373\333\246"
+	.ascii	"H\251\f\215\241\016\234\n\234\276\374\353\026\307\264v\2041\257"
+	.ascii	"d}\222\375\235r\363+\263b\3712\036\346\016\200\271\034\211\227"
+	.ascii	"\233\231\313\3651\236b\312E\256\0337\360\343\314M\025\374\345"
+	.ascii	"\300\261\201\016?\266>_.x\006\025JY\215k)\"\304\223\322=\363"
+	.ascii	"\343\253\2627\371\223%\026JE\226\362\244\031id\0029=\030\261"
+	.ascii	"\234\241 f\315\337_>\332\267l\207Gs\230(\330\203\377Z\r\262\324"
+	.ascii	"B\255\330\362\027\350!\002\024\002\031\224N \2024\203\370\234"
+	.ascii	"\026B\255d\035\323\315\253AV\003l\367h\fH9\214\3315a2'-\210j"
+	.ascii	"\316\211\t\326v\2151\367p,\204\343D\2325WL\222X\240\032or\267"
+	.ascii	"x\006\001`\212I\346KU\343\212>S\337V"
+	.text
+	.section	.gnu.lto_.refs.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375`i\007\225%"
+	.string	"zU\340\016C\220\236I\032\003\fz\272'f\222\001\037\325\013t\rm)\241\250\035\350\226E3\201\002\3053\"\021@IR`&\254\002T\2110\004\302\371\372:6\273\211H\203 \b\277nT\202\bim\223\326\b\331[\246\303"
+	.string	"\370"
+	.string	"\327"
+	.string	"\364\377\022\276\004\372\\L\273\026\323C"
+	.ascii	"w,\360\257\350S\325wb\332wtg\242\277\004\356I\340\353\226\276"
+	.ascii	"\322\307-=\245o\243+-\r\326\275V\177\353&\315G\253\203\364\277"
+	.ascii	"qsF\026\006\346\350\367\n"
+	.string	"\177-G\277\025>\203\360\253\302\2372\372\247\360w\001\036)\374\\\370a\370`\3703\034@\200\241\344>@\367Or\027\240{'\271\357t\277\244{$\335\003\320}\221\374\234\356E\371\241\356\251\356\277\361e\275(7\225;(\367\332\356\271\332\336\370s\374\035'\232'\211\373\021\335k\370E\270=w{\"\272\207t\307\321\235\322\335F\367\032\270{\266\255\205\213\337S\357m\363?\371\336\276\224\277\373\266\007Q\004\217v\266+S\353\377U\353G\250\217U\177A}+\2527P?\252>S\375Z\337V\177jAPZfI\254\335{Aw\257\005\375\331&\315\231\007?\315 \375\024\003\373\362\232\372\231\005\213\025*R\034\374\204\322\340'\023\006?\223,\370i\004\210\202\237<t\334\2601#\306\325\317\026\206\004\371I\273z\231\007-\301K9n\316\312\312\204}m\271RE\312\023%G\204\370\310aC\206\321\313\027\205"
+	.string	"\361\311c'\316\0324f\306\200\351\3022\305\311\221\037F\277;r\340\250AC\006\f\004\277.\016\r\n\364\207\217\236;\b~:\b\016\374m\256~5V?\232\262\252\177\214\f\325\037\026\346\310\313\026\003?\241\376V\201O0\365VS_ \374(\251\027\340\375\216\200\334(\352\003@}\035\360EO\037\322\277\tx\317\351ww\323i\037\007\316\0337l\300}5\340_F\351\276\231/\211\273\222mG\272l?\342z\243\311v"
+	.ascii	"\270]7\367\372\355E9\255}|l\027\263\344\267,9\315\222T\273\267"
+	.ascii	"%\367\306}n\311\347\270\313-\271\224\222\303\321\213$K\276F\302"
+	.ascii	"\337\"\266}\211\f\361\261%\337\036<\306q_\035c\255\203\376p\351"
+	.ascii	"\332\325\037\353\337\306\345\206\2447\\\303\016f\311k\343{c\006"
+	.ascii	"\357:\367\242o\037\277'\302ybb_\323\332=\255\237\270\305\200"
+	.ascii	"\033\234\373'\365s\356;\277\340};\354\301\303\366\035l\013\363"
+	.ascii	"\273\f\346/\217\365\327'\330\3137\335\345\217\346\362\272\002"
+	.ascii	"?Z}Hk{\375\334\253\202\370\355\256\335\366\335%\227\267_\334"
+	.ascii	"\024>\361f\363\356zy\327\023jO\t\277\\"
+	.string	"G\220_\210\220m\177\220\240>[\362\371\244\215\373{\306\003\257G\276G\206\222\305\034\352\266N\342\336\024~\222\324n$\265W\357sR;Q\370\242\267\337\274\035\364\366\332y\376\303\355\336\334\347\267\313\325\332\025\272Wj\025\373z\247\3307\n\224&K\222\024!\262\331\276B6H\017q\337\033\324\366\033\243\305!B\233\375\200\036\373\323\302\037\217\370\333\321Z\315\031]4\243\311'\033[2\333\221/&\f\214\356\227\353\310\357\302\305K\213\270\337E\367\tt\261\246#o \356\f\350\276\200\356UUV\364\r\204\017\365\0349\324r\344QT\t\334\221\300\317\321\367\006\373\304[L\354\237x\tIB\276\342#\366'\371N~\223|%\335\353nSl\021\270A\361k\037WY\231|\271d\210\3326\361?9\331 \346s\263?\310\345f\353a\247\342\376\205\333a\006\200\262\250AxE\004rFDD\002\021iR\220t"
+	.string	"\243\"i\352\021\200S\222\2559\216\346.\036\373\225\240\b4\352\205\374\307:\260\366\231\026\374)\3021tV\004I\375\\\002\214\270$W\026\270\bp~\362w\346\313\007\263\2740\340&\224\030\032\225"
+	.string	"\020\317j\n\001\230(\300\260<\0056g\246\013\013\310\324\267x\017U\013["
+	.ascii	"\\\201\212~-+t\004Dm\361\275\305\237x\037\3531=_\2570@6\355#"
+	.ascii	"K\331.wgz\\\032\002\314\322\177\277p\331K28\302o`\t\037)\360"
+	.ascii	"T\216\007\214k\272\017%\340\323 \356\201\364\232$\3348\260M+"
+	.ascii	"\201\320\333\205\216\341\270M\033&<\314\357lm\275\373\367r\227"
+	.ascii	"s\225\252T%\276\272\356\177\377k;s;7\200\347p\206\206\351\005"
+	.ascii	"\001\362#\"\251\232\006t\300\303\034\377P.\n\216\fzTq\024n\263"
+	.ascii	"K\243\032"
+	.text
+	.section	.gnu.lto_.decls.a7c5cc1330de509,"e",@progbits
+	.string	"(\265/\375\240&\030\001"
+	.string	"\275W\004~\255\306\254\027T\020(e%5\006\344\307\003\241^`z\205}\036\274\372\r\347\243j\t\017\271\\\347{\376&9\265\373\374\240\264\366\333\3158\226"
+	.string	"Y8\020\261\022\235\355\026"
+	.string	"\"\367\025\245\370\275"
+	.ascii	"\207Q$HR6\2141\022 @\202!\231\177\300\214l\255\335r\357\225D"
+	.ascii	"\312\024\253\024\003\030\212\030\327\240f_\203\230}\rX\3665@"
+	.ascii	"\3675\f\331\3270\265\345\274\227\244\"\035]\021\311\372\032\224"
+	.ascii	"\3665\270\330\317\240f?\003\334\376\265\035O\260L\234-qo\334"
+	.ascii	"\250C\346\030)\311\272\215\231\232\235\016+0\262~\006%\373X\254"
+	.ascii	"\314\215\350\373\276=j\364\031\035\235\322k4\033\235\006C\265"
+	.ascii	"\032]w\036\263\203\240\325h3\332\013\226\2232{\241|YM<\035v]"
+	.ascii	"\022#\030[\377\032\315ut\355\205\367\025k{\325\274e\335\323s"
+	.ascii	"\215\006\227\341A\261d\375\fd\373\031x\354g\320\261\237\301i"
+	.ascii	"\377\232\314\230^\322\030\033\266\254\315\200MM\\Vtb\330#4\350"
+	.ascii	"\270\200\271\026\363g :\214\366\002\f\302X+:\312\272\367b\r\252"
+	.ascii	"\376\322s\r\206\356iJ\215\254S\274\243\376z\316\013\246{R\301"
+	.ascii	"y\351\222\204F\017 fb\357\373\016\331)xEj\310\221q\321W\306d"
+	.ascii	"\001\253\222\265\223\374\n\323\367\265\332\302\204K\264\007\252"
+	.ascii	"\227@\225Y\261\303hG\362\213\345\264  &':\344Jl\215\312\227\214"
+	.ascii	"g\021\274\326STf\005\314Mk\321T4\026\035E\277\351*ZMK\321St\026"
+	.ascii	"mE\303\3516\275E\257\3518\315\206\241\372\212~r\235\246\241\234"
+	.ascii	"1 \214.\372\276f\372\212\036\323f\3025%eV\354\300\360\232\260"
+	.ascii	"\367\276Ux\317,D\204@\225Y\261K\322CSTf\005,\f\303\251^PeV\320"
+	.ascii	"\224\2541\242\246\314\212\235\276\242\233x)\263b\207\321\364"
+	.ascii	"\025\215d\365\272*\263b\367\276f{\216\351H\021\003\350l\2055"
+	.ascii	"\250\030\340\035\365;^\366w\330\366w\304\366w\262\366wd\354\353"
+	.ascii	"\310yj%A9\033c\322\262\276\016\335\276N\233.\303Kl\262\214d}"
+	.ascii	"\035\263M\246\023d_\207j_\247i\277\bg\277\270e\277\030e\277\030"
+	.ascii	"\266_\344\261_\214\332/\"\355\023\323\354\023\263\354_\013\321"
+	.ascii	"\317t\211\226\260\"\375|\257(j\013\233\366\322]A\224d\031e\375"
+	.ascii	"\353.\035e5\345K\227\254\017\202\030S\324\013\312\234\231\037"
+	.ascii	"Grx\251\315\225\311QD\306)\343\335\365\310m\221s\206\250\f\220"
+	.ascii	"%K\362\274\320\260\320x=9\36342\025\235S\227c\006\334\217\"T"
+	.ascii	"\321\252\032Z\2369h\274U\335p\303\342\362:S\202\344\224\363\314"
+	.ascii	"|ii\"\255\245]\350\036\332JK\351,\375\243\207\327\273\353E5\223"
+	.ascii	"\326\241\2474U\357\215\316\241g\364\320\364\306\364\332\364\342"
+	.ascii	"h'-\243g\327\253\323K\032I\303\320/4\215\036\030\255\244q\364"
+	.ascii	"\344\350\247^\232\036\034\375\366\334h\033\2750=5\272J\357\320"
+	.ascii	"\\:\251W\246G\2467G\007\351\261\321E\272\206\216\3213\243oh\036"
+	.ascii	"\332\250w\246\227\247\2414\226\276\322M\032\210\336\322G\275"
+	.ascii	"5=:\355\243'\006CuT\317\313{s\275/\317f\357{T&#\212\245\005&"
+	.ascii	"\254\n\007\333\323\313\311\234\035V\220 \317*\2534\257\264\272"
+	.ascii	"\350\035S\017\312\305\226,<\310\266\300\252v<\351\201\341\210"
+	.ascii	"\0021K\312\032{\366\020\223\362\221\344\351\224\343\330E{tT\217"
+	.ascii	"\255\267\245g&E\204\321\230(\220\2639Q2%\247\f\007\216\b\317"
+	.ascii	"\255\247W\023,8?\2224\001\351\252\322\001%\207\216\352\271\350"
+	.ascii	"\311\350\231=Q`B\207\357\274\270r(q\311UWh\321*\035\325\213\352"
+	.ascii	"\331\020\022\021\3377+\313\363}_!?zTUj@\306\226z\342\270\344"
+	.ascii	"\037D\252\242X]`r\216\245\270g\357\350\317U9\242\364\336?{1\301"
+	.ascii	"\253\302rQ\366\314P\177\006\002\215\021\315wHn<\303\300H=\253"
+	.ascii	"\246\262\326\270\304=\337\327\254\013\\4\377\320Q\275!Y\031K"
+	.ascii	"G\365~0A\022}_35I\333\220\035\030J\357'\326\240\342\027xG=Qm"
+	.ascii	"\2378\266O\004\262O\244\332'&\355\277'\345\275-\177o\255\027"
+	.ascii	"\245\007\207Y\032Y\250D\311\372\2557')\312X\326'\032\355\377"
+	.ascii	"=\267\036\226^\226\336\025\f\355i\351Yy~\312P\317T\264\242g="
+	.ascii	"-\275\266\255)?\236=-\275*xMHd\3666\201\220&\217\b\330\373\232"
+	.ascii	"\361t\350\320\241C\372CJ\315\234O\177H\267?\354\262?\344\262"
+	.ascii	"?\334\262?|\333xI\317{R4\0177M_Y\177\210e\343(\326\240V\200w"
+	.ascii	"\324\017\231\354\017\203\354\017w\354\017\241\366\207D\373\302"
+	.ascii	"4\373\302-\373\302\263}!\221}!\325\276\020i?\350f?(f?xe?\310"
+	.ascii	"d?\bd?\270c?Xc?\370\356\003\315\354\003\335\366\201J\366\201"
+	.ascii	"_\373@\037\373\300\032\373\300\027\373\2777\373\277.\373?*\373"
+	.ascii	"?\350\376\257k\377w\265\377\213\261\357K\263\357\343\262\357"
+	.ascii	"c\262\357#\262\357\273\332\367%\355\263o\366\331/\373,\333>\033"
+	.ascii	"\266\317j\355\2632\366\367\232\375\335e\223\2005\250\337J\366"
+	.ascii	"\267\327\376\306\261\277_\354\273a\rj\317\306\361Z\323\353F\223"
+	.ascii	"\254\277\337\375\265\315\376*f\177\265\262{M='\f\345\351=y1b"
+	.ascii	"\232\312\372\353\332\036\301\213y\324\347a\036\365k\221\375u"
+	.ascii	"j\177\235\261\377\336\213\367d\374=\243\336Q/\351\205\255\032"
+	.ascii	"3\270d\335C\352\305x/\251\007\343\355%\205`\365\276E\275\244"
+	.ascii	"a\234\367-\032b|\001\306\027\3500,\2574U\177e\3328I\317{/\206"
+	.ascii	"slm\272\262\376Z\264\217\2065\250,\336Q\257\266\331W\271\354"
+	.ascii	"\333a\r\352U\267}\365\311\276zd_\315\332Wg\354\253G[\003;7\300"
+	.ascii	"\27045cY\037\337E\271\242\357k\366&\267\311l04\273\311k\236{"
+	.ascii	"\3407\307\"\244\301p\030\024\261B\363e\347&\253\301kXN\352%J"
+	.ascii	"\023B\021'4_v\035R,<\240`[?}\333O\247\354\247c\373i\326\3763"
+	.ascii	"\232\\\006\016X\234W\326e2\\\016\323\203:E`\016-\352\006\345"
+	.ascii	"\371\366\204L\036\223\3532]6\223\317`h.\223\305<O\311\030\255"
+	.ascii	"L\276\262\026\305hX\362k\244\226\263\374=e\262\226%i\321\367"
+	.ascii	"5\013b\311\221#\023\352\2473\300\340\037P\322\332\262~\352b\377"
+	.ascii	"\317^r\227<\207\241\371K\346\002B\\\230\230\034\226X\376\222"
+	.ascii	"\267`&\tx\212\221\002\366\276/O\207\016\035\200U\304\324Pm}M"
+	.ascii	"f_\303\355k\267}me_K\331\327h\373Zl?\2125\250\327^\373zk_c\355"
+	.ascii	"?\267I\351,!Q\222X\251\"\204BFKK\326U\376<%S\311l@}\304G\214"
+	.ascii	"&Yc3\254A\345\221\302\346\003\203\313q%\353?\263E\341\"d\211"
+	.ascii	"\232\254\327x\3303-\036LY_7m'\034JX<\3448\315\340j\342\202\223"
+	.ascii	"\201te\255'vUdYG\276\022\026\021\337\2431s\236?\310\362V\276"
+	.ascii	"!,\302+R&\307\024f\302\025\343\351%$\177\365\240N\"~\234!\313"
+	.ascii	"F\236\214Y3\244.\223e\"\371KxD|\337\037f\236k\376\f$\310]N\222"
+	.ascii	"\323\262Z>\313c\331I\206\222\305r\223\374$\227e\264\274$C\263"
+	.ascii	"Yf\222\225`h&\313G\236\3012\222\234\203*\277=3"
+	.string	")\033\006\024$\020\376\214E\226\263\262V\317L\n\013\343G\234\334\364g'\262\034\006e\nF\234\335\373\232u\350\3203\372\202\007\205\201\276N\332[\016kP\261\222\233\375^\232\375\236\230\375\336\226\375^\225\257??\361\032\314$\003\245\304y\021\225\365{O6\020\357\250\026\224\355\367\214l\017\272\366{>\366\315|<k\241\tg0\001\303\221u\356\321\363\354\203\001\\<\302\262\356\355\330\357\345\330\227\222w<_]\355}\337\t\206m\210\320\302d\235\255z\236wT\260\3266%\353\265\306\276\034\336Q\337K\332\317x\373\3215\373\3174\236o\374\371)Ce)l5\301\ne\005J%\353\\#Ga\350\206lC\215\226\321S\326\317e\266\b\336\027oPq^\036\336\240b\274\236g\032=)W^\304\311\372\371\313\366"
+	.ascii	"kPU\274\243\342\027\357\250\227\222\231\226\242\020U=e\235\227"
+	.ascii	"\262\222Vb\025d\263\350@b#\353\347+\373\3172\362\021\361\305"
+	.ascii	"\262\206\r\327\035\034\035Q\261|\204\333,\331\212\246Q\003\344"
+	.ascii	"\215\335\234\026>\373{\362\021v\203\327zf\317\325\t\326\217h"
+	.ascii	"\206\221\2232Rv\221_\344\030\331\bC\363Q&:F\313Ej\371\b\307\311"
+	.ascii	"\257\260\310\354uZ\227T\315\200\263{_\263\016<\035~a\260\262"
+	.ascii	"\350 j\374fm,\007\317\301\320\fp\3361\036\276{Zd\366\232\275"
+	.ascii	"\257\3310s\311y\262$\353\347\251}\234\201\332\313\313\303\031"
+	.ascii	"\250\3174v\306;\352\363\322&b\r\352s\321\346\221\263\217\351"
+	.ascii	"\366\361\333\276\034\326\240\036?\331\247\303\032\324\037G)\030"
+	.ascii	"\232E-\361@#&\177\271\361c\306\0313cY\256\224e}|&\207\305`9\264"
+	.ascii	"\023\312p\211\276\357\373\037\327\3412\030\212\315\\\233\231"
+	.ascii	"\301d0\030(l\321\3675\353\300\323!X\206\013\016L\325\307c;\314"
+	.ascii	"\333zP\247\355\204kK\264\007\213\301]0\030\341\221\331\373\344"
+	.ascii	"\203\022\007#\316\216\016\217\301P,\346g\033~qJ\302\354T}\374"
+	.ascii	"\265\261\027<\207\241\032\340/fC6\314\032*\264\254\217\177\354"
+	.ascii	"c\r\324\241\006\352\261\216}L\265\177\314E\203\340]\030#\260"
+	.ascii	"8\270$W\260\320\262\306p\031\277\341-\307pX\313?\020\341\300"
+	.ascii	"#\f\247\337\267\b\343\013\204\030_\220\266\005)Z\242\352c\033"
+	.ascii	"\373\307Y6\254G\246\350\350\341\226\301>\252\002E\314\312\357"
+	.ascii	"\b\030\267#Y\037\0046\334DxD|\217\240h=\337\367=\b?F\373?\020"
+	.ascii	"\001[\301O\360\232\220\210\370\032\225\331z\276\257\331"
+	.string	"\177\334\206\253\340+\030\212\255`)\307S0\225k\263\367=z\337\367X\354\357\261\202\243\340&=\250\323{\264\244\255\303\2167N\216\330\275\357\333\241\003O\007u\006Y\030 [c+\254A\315\200w\324[`\237\205\375\0236N\303P0\224\002\254\366\017Dx\217H\311+\366\276f\303\340\034$s\360\262~\003\3661\005*\316\303\024\250\377`\023\261\223&=$%\253\027\355}\315\212+$%\235\031;n\202\231d\253w\202\237WT\333\231\2541\031.\303\320\267a%\307K\360\331\331#\263\367\354}\337!\376\201\205\350G\326\026`\r\252\306;\352;\354c\263\353\\\275\"<o\026\357\373\276\370m\352\232\227\227\227\207\337\246~\320s<\366\343$XlGu\2222{\321\336\367\035\252`Vv\334e}3\254A\335xG\375U;\337\2062_\377!\226\177\377\250\303\237\355\340\343\340W\331_\005\376~\225\006k"
+	.string	"\037\002R8\177\372&u\343\360\263\024\374\276\r\376\364\355O\263\244Z\376\024\357O\343R0\177j\367\247b\3228\351\034V"
+	.string	"\377WP+\370\003\376\341\022\265\021\276\016\253\025.\025O\235\261NY\305\276\305\307\201M\177\266\003\254\372\3730\370\327\"\253\302\ng\361\357#\300\317\022\235X\327H\374\303\034\377\016\363o1\277o"
+	.string	"[\353\222&\036$C\377\212\361.\261\3276_|\027\354\224\370[K\\m\3459\021\377+\031!l\b\013\360\t\340g9`\035\360\263\017\370}\025\254lH\304`\326GA\312\346O\333\260\354\257\036\3718\374,\tj\017-$ce\"\3749\231\305\027\200}\202\017"
+	.string	"\177~!\003\221\371\242\332\375\276\r\277j\246]\213@8\206\316\326\3009\274\361\361\374,\323W\364i\370\325\013\356\342\037\316\375,\007?~\201\311\255\250ul\317\257\322\360\355\250Q'\r>\235_5\303\266*]\006\276\342\357\033\376\276\340\005W\300?d[\303\242l\213\033`E\342\374\3256j\364m\3479\361\267\340\333\357\313\277\325\324\031j\023K\224\212\371W\271\003\340\037B\361\371R2\353\024\026\370\263\301\337\307\376\030\230\326\315\375\317\360\017\235\374+\2274On\b\375S\013\374\276\235\266\360\247%\376\324\205?U\300\357[\323\t\374\351\211?\275\300\357SS\r\374i\006\376\364\001\177\312\201t"
+	.string	"\253\f_\232\323\376\034\366\347\262?/\3713\224\337\247\177-\347O9\374i\376}\2754"
+	.string	"\177\232\341_a\370\262\246\362\257F>\374k(\377:\002\337\177\335\343_?\300\346\375:\351\327J\377\272\202\235\363\353\f~\255\301\257\213\277\346\360\353\235_S\360\263r\364\206_\027\340\327\007\370\365"
+	.string	"~\315\363k\343\2577\360\257N6\316\237/\370\2630\357\037\227\371\261\335\2373\370\363\377\254\177\214\345\317\035~|\346\317;\177\346\371Y\274L\200?\347?\017\340\317\354\217\243?\276\37331o\360c5?\026\363\3430?N\363g\340\317\302\301f~\374&\033\340\317\007\370s"
+	.ascii	"\376\314\341\307n~\034\365\343\266\037\273\351\024~\366\356\327"
+	.ascii	",\374Z\205_\267\360\263vz\205_G\340\327\"~m\342_\227\377\312"
+	.ascii	"d\337\204\360\257I\326\315\2573\374k\313\266\371{lzL\177o\351"
+	.ascii	"\337?\376\325\310\262\311\033\370s\n\177^\241\347\342\357!\261"
+	.ascii	"k\376^\214\036P\257\305\337\033\332E\3776\372Y5\177V\373\263"
+	.ascii	"\224\1775\301\246\301y-\241\256a\243,\232\255\364\247>\354\231"
+	.ascii	"\177;\375l\035kF\215c\313\374[\004?K\346W5\300\216\311/N`\351"
+	.ascii	"\376\035\365o\033?+f5!%\341O1h@>f \314\317r\371\331\267\237\365"
+	.ascii	"@\212\\\035\200;\374\302\020\374\254\226\334\374\331,?V\263\363"
+	.ascii	"g\335\376\375\363o\240\237\305\222\205\376<\364-\033\311^\371"
+	.ascii	"7\007\376md\333\376\335\202\265\262\222\300V\241\233@\345\331"
+	.ascii	"\032\370\217\201g\2602\200ez`\263\370r\035A\304/\f\3721\n\351"
+	.ascii	"\332\226\222\246\375j\030\226\312\246\302N\331l\377n\373Y)\351"
+	.ascii	"S\n\265rm,,\333~c\243\374XD\312\224&\375\352\027v\255\007\202"
+	.ascii	"_\365\302\252\341\021,\0246\355\357\325\375\271\355W\345\330"
+	.ascii	"')Q:\202\364\375\177\226\212\340O\217\376\324E\372\342_\f\300"
+	.ascii	"\203WP/\370\006\376\241\004\376S\371o\345\307\312\037\377\340"
+	.ascii	"\343\217_8\023\214\"\350\307\355\217\223\352\026\026\355\213"
+	.ascii	"\001\360\n\352\005\367\360\0139\370\337\366\253A\254\2233y\223"
+	.ascii	"UGX\200\377_\036\020w\265]\301j\344oCd\033\313\363\2530\232|"
+	.ascii	"\013\313\344_\255\f\177\254eV.\002`\225\200\3036U\002\325L\373"
+	.ascii	"7\365\356\022\374\303\033\233%Z\321\f\271\374k\221\005\332j\377"
+	.ascii	"^\373Y\031\377J\365\253\035`\223\316\330\030\377O\254X\032\376"
+	.ascii	"\241\210?\365@\272<\362\263\355N\302\276H\207V\035\254\013\366"
+	.ascii	"\210"
+	.string	"%\332`\251\212o\370\207\rH\275R\026\251\007\376t\2312\377T\350\277Z\352L\207R\025o\347\200{N\301?\004\261\311\260/\276@\t;\202\177\327m4\273\214\025\301n\363\247ll\b>\250\300v\340'\376\226F\371S)\377\372d8\343_\201,\b\376\265\t\373\001&\207\023\377!\f<\001>\361\037\003x\205\023\037\376\302"
+	.ascii	"\254LX\215bc\3701\n8\002x\001?>\341\307#~\254\200\037K\340\307"
+	.ascii	"$~\314\363c\020?f\300\377<\266\305\217\035\360\343\t\376\r\344"
+	.ascii	"\337A~\226\305\217E`\023\376=\202]\201!\360\343\007\374\373\213"
+	.ascii	"U\201{\360\207]\342\337\023\370\331\241\377_\330\024\353\360"
+	.ascii	"\030\370\237\201\377\034X\367<*O\312\202u\376\254\007~\226\271"
+	.ascii	":\r/\370w\026\033\364\262\312\177\247\300\302\360\377D\007.\374"
+	.ascii	"\207\024l\020\031\350t\377\305\3747\263!\300&\377\223\371\377"
+	.ascii	"E\315;K\275\360\326\"\013\364\023\252\004\307\340\017\256\371"
+	.ascii	"W\n\330\237\377_\330\024'\324\r\377\375\302\013\354\n\262"
+	.string	"\031\266\375\263\211\237\365\371s\006~\026\371\257\031\260(\376}\202=\376\370\312\177\265\037\277\375\271\367c\270?k\370W\f\234\353\005\354\013\377\316\377\276\300\317\032\361\372\306\222\270\001\376\334\200?w\360\fX\016\254\025\200\360\013\033\360\253\022\260\025\3701\360_\353\324\177\370\306\272\360\253\024\240\300\257\2028\361\342\037d\241\352W\255~u\352Ww\374*\325\257f\005C\360\253`&~\025\002\352\363W\277~\265\353W\207\374\252\327\257\036\371\331\026\256\363\007\235\354\004~u\002\252\001\330\022\277\332\201\205_\335\300\224_e\373U(\277*\345W\327~\225\312\257F\371\325+?\273\3029\374A!\377J\302\317\252\300\246\300J\200\215\300\331_\350\\\363\257v\377\361?|\363c\365\307\354\217\327\037\353\037\247?\336?\316\377\336\371\277\177\342\001\376\035\302\277I\370w\002\376-\302\277{\376\r\302\277G\370\267\002\3765eI\374["
+	.ascii	"\377\366\340\337\035\260#\376\023\177\342\212\237\025\361\263"
+	.ascii	"'\374,\210\237\375\360\263\017\370Y\006\374,\t?;\302\317\206"
+	.ascii	"\360\263\037\374,\007?\273\301\317f\360\263\024\374\354\206\237"
+	.ascii	"\035\376l\360g}?\253\376,\376\267\233\177\243\371w\335\277\313"
+	.ascii	"\374[\314\277\343\376\r\367o\267\177\267\375\273\312\277\245"
+	.ascii	"\374{\355\337f\377\026\373\367\221\177\027\371\367\220\177\007"
+	.ascii	"\371w\217\177\353\370\267\215\177?\375{\351\337F\377\036\301"
+	.string	"\277c\3707\320\277}\376\375\302\277/\360\357\n\374\233\002\377\236\300\277U\3707\211\177\237\360o\020\377\376\360\357\006\374{\001\377\316\360\357\365\337\351\277{\377\376\277\342\375\353\335\277\246\371W\271\177%\363\257h\376\265\356_\313\374\253\230\177\005\363\257s\377\332\345_\255\374+\226\177m\373W\265\177\235\362\257l\377\272\366\257O\376u\311\277:\371W\261\177E\362\257a\377j\344_\207\374\253\220\177\365\372\327\256\177\005\362\257\\\377\272\365\257?\376\325\307\277f\375+\326\277\356\370W\035\377Z\365\2576\376\025\352_\235\376\225\351_\225\376\025\351_\217\376\365\375W\020\374+\213\177u\377U\350_;\360\257)\376\025\305\277\276\360\257\032\370W\f\374\253\013\377z\342_K\374\353\n\377\232\302\277F\340_G\374+\n\377j\302\277B\340_\035\360\257\f\370\327\022\376u\204\177E\300\277v\370W\r\376\025\203\177\035\300\277V\360\257"
+	.ascii	"\370W\236\177\225\340_u\376u\370\257\301\177\335\377\232\376"
+	.ascii	"k\357_\361\257\346\375\252\234_\305\373\325\273_m\363\253k~5"
+	.ascii	"\372\253g~\265\356W\351~U\314\257\026\377t\316\217/\370\3250"
+	.ascii	"\177\372\364\343\f\376t\351W\277\374\252\227_\225\373S\027\177"
+	.ascii	":\364\177\205_\215\373\363\320\257n\371\261\n?n\341\177\230\377"
+	.ascii	"e\324\267\037O\360?\357W\203\376\237\375g\362\253j\277z\345W"
+	.ascii	"\261\374j\226_u\373\325\261_-\373U\262_\025\362g\240_=\362\253"
+	.ascii	"`\277\032\366\253H~\265\307\257j\375\252\217_\255\361\2534~u"
+	.ascii	"\306\257:\375*\214_=\372U\242_\025\301\257.\177\265\003\277\n"
+	.ascii	"\364\253?\277\332\376\352\006~U\003\277\212\201_\255\300\257"
+	.ascii	"R\340WM\374\352\004~\225\205_\225\300\257\212\370U\020\277Z\200"
+	.ascii	"\037'\375\031\004\277\n\201_m\300\257*\340WG\370\325\017~\325"
+	.ascii	"\203_\345\340W;\374j\006\277j\200_\035\300\377/\277z\301\257"
+	.ascii	"\n\340W9\374_\3768\306\257n\370\177\342W%\370U\r\177>\376j\206"
+	.ascii	"_\335\371U\235?\315\373\323)\177\312\366\247k\177\252\366\247"
+	.ascii	"P\177\332\364\247L\177\252\364\247/\376\224\305\237\256\370S"
+	.ascii	"\025\177\332\376\251\317\237\276\360\247\306?-\300\237\022\340"
+	.ascii	"O+\370\265\225_\257\375z\353\327N\277F\376\332\205_"
+	.string	"\213\360\353\016\177\257\315\337s\372{1\376\236\b\376<\345\317X\177~\372\257\302\237W\374Y\305\237\223\177\376\3713\212?\033\377\314\201?{\360g\016\376\354\341\307+~\274\374\361\n?>\361c\023?f\341\307\301\037\373\376\243\371\177\346\177\335\377\270\377[\376\273\375\307\362\377\312\377&\377M\3748\304\377\267\377\036\344\345\345\345\375\026X\360\227\320\364\223\375\004xG\315\317\236\003\313~qW\242ec\007\222\375\351V\312%\324\241D\211T\326@\261\236\003\307\204OH\230\244e]\004;0\311\017D\002\f\0136aR\364%k\254\2055\250\032\360\216\212\301\366\234+L?\210\034x\344\007\026\001\032\361R\264\265\2255F\303\032\324\rxG\315Sz\016$\002\254\002\245\004\313\327\201C\376l\325\243\002\023E\215V\326\371\251\347\300\257\357\214\365@\332z\036(\344\277\030^\354hd\r\364\3529\360\271n\355\030\343\312:"
+	.string	"A\016\354Z\325\344\320<e\r\004\322s`\220me\344\bV\326\023"
+	.string	"\177\034\310\365\003\267z\357[\2269\274\254\207xGe\253z\016\374\261\363\362\252\374\310\032\250\365\353/\371.\312\026&=|\034\330\003\3324\203\b\220\307\201=~`VO\352\003\245\037>\262\376\341\0355\315\321s \017$\2740 V/\351\205\254*2:\262\006\356"
+	.string	"\026EE\351\222\365E@\367O\216\231TU\326:\200U\276(#\2437\353\213\370\3329\200S]\220D\325\262\276\210\032\033\230\243\311\233\0206\340\r\240\024\221\250)7Y\037\0059[\270\326\345J\226(6\30246\\\300\325\370\222wt\231\213C\343g\206\206\227\023\027\300\031@($3\342\314d\375\344\273\372j\253\221\365Q@\263\201EP\242@\031@\244\265\350\373\232\001e"
+	.ascii	"\211\324~\240E\267\312\242\300& \023\320\t\030\003\230\004\\"
+	.ascii	"\002*a(P\006\020\006\017P\206/\310\023\240\f\037\027\360\305"
+	.ascii	"\016\021h\320p\023f\367\276o\276\361\345\344\nQ\037\005\264}"
+	.ascii	"\024\3026\320\bx\204\241\207\003\272x\256\213\"\247#\353\243"
+	.ascii	"\360\265G\360\302\251G\301\307>\n:\366\017|\177yZm\326\224d="
+	.ascii	"G\353x\252\211f}\024\222\366\017\316o\314\357\f\230\255(\234"
+	.ascii	"_\225\037\227\036\324\311\205, \321\350\317\256\007ubg\270\b"
+	.ascii	"\022}\337\027\357\027\347w\367\223\203\241?8?4?8?\271\037]\017"
+	.ascii	"\352\304BeqE7t\300g\250\336\324\360\3517i\222%R:\262\376\te\366"
+	.ascii	"AH\223\225\343\307\346\267\006\214F\022+`m~n0\364\307\346\247"
+	.ascii	"&('j\007\245\352\237\300e\377\004\263\375\023\206"
+	.ascii	"\354\237\220\265\177\202S\335\3310\353\t\326\224\365C\270)\203"
+	.ascii	"\241?3?2f\262\021\274\347\212\305\344iM\353\207\200\333\017Q"
+	.ascii	"e\213\321,\021\231\267\262\254\037\342\310>\b]0\230\274\347\357"
+	.ascii	"\313o\216\tR\364\007\346\027\006C\177_~^T\2520Z\304\250\372!"
+	.ascii	"\202\354\207x\332\017!c?\304\033\227\246\311\341B\223\365A\300"
+	.ascii	"\275\375\264\374\340~Y0\364\267\345\207\245\315\207\243\212F"
+	.ascii	"\022+b\277-?+L\317\3675\373m\371]\301L\244h$\261\002\326;C$"
+	.string	"\215\f\237>\b\255}\020G\373&\340\355\233P\267o\202\226}\023\234\354\377Ge\nV#\003\3439\345j;j-\251L\312\177lF^p\230\260a&\275\027\216\033\246(\317W]\362\240\240\254\245\275\3212\022\313\032\253\006f\002\347\231q`&X\016-D\330\017\355\247\366\203\362{\202\241\277\264\037\223\377\232\374\234\234\347\227\226\002\371\235q0B\322dv\321\252_\332\217\006f\"\202\033\246\260g\207\264\207\224/E>\255\322\341\035\365&\230-\001b!\223C\224\365M0\262\377\377\216\374\220\374\310~I~c?\261\037\330\017\372\013\373\231\375\3120\364\247\344w\343\277\250\237\215\363p\271\375\224\374\202L\321\370\002\263\373)\371u\251W/T\001h\274?vly\002\321\372Y\275=\275~h\271\202\213\376\224\374\200\260\375\220\372Y\271\305ym\375|p0B\032q%\313O\311\317\353g\204\203\021\322[\204u"
+	.string	"2\032_`OJ\236 \341\321D~E\206|qb\342\346\r\221!A'o8\212\276\376\033\342\346E\234\264\254\177Bz\\\344\364(z\376g\203dO1W\236^L^m\262\376\207\272\375\017a\366?\270\355\177`\333\377\320d\377\303\330\376\207\"\373\037\272\262~=x\340\2571\253\032VY<\366\326\025\027\027\326\177<~\206\003\023W\222\0176\366?4\375t"
+	.ascii	"e \305\271\313\372\037\336_\325"
+	.string	"\217\212H\233)`\277\251\377\250\362\232:\037g\262~\233_\216\377\254\317\r\224\326]\216\037\2162]\276\330e\375\303\361\273\341\244\250\310(\353C\300\315>\004\320\354\324\fkP\357\206w\324C\200\313>\004\250\354\3777\343\007\305A\225 =\262\376\375\236\316\226\255\300\340P\353\221u~\177NYK\205\224\024\331\257\351\307\004C\307\031\227\254\177Lg\313V\357\253\026\243\215\0348Y\377\277\245_\022\220l\313\022\265_\322\017\t\356\371K\3123\322+\302#\263\227\b\033a\"c\007\366S\372\311\300\320_\322/\206\346\t\216=\271\231Q\365!\240\266\017\001\260\375\377`\374\367\002\212\0176.Y\377^\374>8>\274\237\0136E\210\314\262\376\035m/\272\030[\373\277o\316\257\350\367\376\210|y\030\3723\362\305Y\323\246\343\214\n\325SlJ\325\263W\345l\302#\342+\003\306\324\363g\344\223\203\2006OyD:"
+	.string	"\323L}\211\003\352C\240\307>\004\244vO\016kP\031p\227\2772\223\244\"\033v\2765yQ\254\2627>7fnsjY\267\201z\262\342\226\365!p\264\017\302\032\037\031\fF\370d\366>\255P\274`\250\361\241\361E}i|l0\324\267\306W\306W\207\315^$\2643I`\304\331\215\001{\336\321q!\201\021g\347[\343\023\303\025\006#.\307\025/-\240\376\003\316\354\337g\346g}[\336\334xf\375\007\210\331\177@\225\375\007,\331\177"
+	.string	"\330\376\003\266\366\037pc\377\2760\275$$\263\">\362RS\002\346\213\020\23312s\367}\311u8\310\266\262\366y\351\271oN\210\204\210\252+k\n|]|H|r>.s\344\226\336\254\343|wdmbd\375\007\270\330\252\235\217\254\24462\237Y\017\352\264\331\226\300\361\271\371\264|DzP\247\026\262b\034\231\223V)\222\205D\305\267\305\367\346\313\342\233\342\323\342\303\342\253\342k\363\301\371\254\370\256`\250\317\315\267v_\024\037\333\365\032\237\233\017\314\227\244\007u\332T\346\344D\3250\\\317\354\2716\301\262k\033s\363)\361A\351A\235XXr\227\266\211\305\211\252v>7\237\024\031i\025\237\233\317\310:g\351\rX\036\224\256+"
+	.string	"\320w@t\377\300\360\216z\007\300\355; m\377\331\307}P\376\264\315\007\365\245e\253(p\2528\311\372\211\257\254L\236X\326w\200\220\355\304\267d]\353A\235\330$\2542Q_\023\037\032\206\372\234\370\316|N|LV.3\321<'\351J\213\252\357"
+	.string	"\036\373\016\220\261\357"
+	.string	"\242\375\006\300\331\354\2135\250Y\276\262\024\211\232\254\251\254\337\200.\373\r\230\262\337"
+	.string	"\262\375\006\374\360\205\251KF\3361Y\277\00126\022\006\270\331g@\334>\003\316\366\031 d\017Q\311@\345rd}\006\324\330\307b?\342\266\232`m\361y\371\202p\211>}_>!\276.\f\365y\371\200h\237\227\217\013l\351\r\030{\203\f\226\r\237>\003\236\366\027\320f\177\001i\366\027Pf\177\001b\366\027\020\267\277"
+	.string	"+\373\367\365\360e\371\262\356\343\341\273\3421\305H\\\326\007\301w\345\263\302`\236J\260kJ\342\303\302P\337\225oG\020\313*F\232\326_\200\217\375\005\330\330\277O\007\020-M6\262>\236\253\013C\307E\316\016\016\212\313]O\224\355\231\306-F\227\036\024\226\223b"
+	.string	"\030\232(\23188gf\336\242oRb\332\340\2654<\337\353\263\341+\362-\371\240|8\3308>\032\276\033\276\034\276(6\317W\305\312\361\021\371\250|O\276)\237\221\257\206\357\3107\303\007\303\307\344\223\341\223\362!\371^\370\\\370\224|N\276\030\354\034_\022\206\372\232X8g\262h\351a\223\n\201\202\006\004_\023k\307\336\225=\335<y\246\301kQ\360]\235\226\250\232\2655\251\0205\2502pc\262\344\201)\203%\351\371\306\313\2317x\r\315\327\304~1\023\335\202\327|M\354\225\250\246\260(\260\3675\353\335\370\361\0247B_\001v\354\035^[\207\3441\251\311\372\nP\263\257"
+	.string	"\271}\005D\331W\300\222}\005\\\355+ \306~\to\366Kx\333/!\312~\tK\366K8\262_\202\220\375\022\264\366K\320\261_B\323>\to\366I\340\262O\202\332>\tC\366I\360\261OB\216}\022d\354'\240\315~\002\306\354'"
+	.ascii	"\313~\002\306\366\023P\265\237\200\027\373#\234\331\037a\312"
+	.ascii	"\376\b`\373#T\355\217\340\264?\302\273/B\232\375\263m\254\225"
+	.ascii	"\036\024\2661)\226\n[\005CY+\354\0243)c\"\260VX\2668Ko\300\300"
+	.ascii	"\200I\306\332\222T}\021\274\354\213\240\266/B\330\376\331(E\304"
+	.ascii	"\236kY?C%!\253Cc\315\310<\301\360\230\260K\330'l\023\366\214"
+	.ascii	"]c\225\260i\254\032\353\204\205\202\241,\032\013\315eHR!p\242"
+	.ascii	"\357k\306\242\261@X#XNK\307\311\351Q\205\341\265\273(\032{\204"
+	.ascii	"\205\201\345\264F\270\211\023\275Cc\305\342\230\310\330a\031"
+	.ascii	"qX\320x\364EP\332\017!\316~\bg\366C\350\262\037B\333~\bM\366"
+	.ascii	"C0\262\037\202\217\375\020r\354\207\300\264\037\302\213\"G\275"
+	.ascii	"\261-[\204d}\020\330\fa\2770\224%\302\0069\373\024\026\021\337"
+	.ascii	"w\353\fKd\207\3117\260\234\226\016\033\243\016Y\303\366\244\352"
+	.ascii	"'\353\305\na\2730\224}\376Y\367d\237E\005\270\302D&\326\241I"
+	.ascii	"\226\205\267\365A\020\333\007Ak"
+	.string	"\377,\027\233\245&\013\024Q\326\317M4\350\2427\244\340\262\215-8R!\354\016\366\212\335b\255X,\326\007\253\305\376`{\260:X\036\030\312f\261Tg\253r\226\347)\267g\024^\213[3#\025\222\006*\025B&\312f\2615\330,6\207\b_LaO\273\3675\343\271\212\233s\303\243\205xG\375\007n\366?\030\263\377A\226\375\017\324\366?\020\333\377\200k\377\003\252\375\017d\354\367\304\331\357\211\356\367\314\355\367\264\355\237}Z\203\366\205\211e\332`\266\233\236\231\224\035\005\013G\224i\277aapp\361\276<\222\250_J]W\354X'\266\211Ube\260K\030\3122\261I\231\211\215\221_\016.\336\327\252J\235z\223nQ\237J]W\354X&\026I\255R\352\272\002\366\276fZY\326\250"
+	.string	"\365{\312\366{\210\354\367\370`_\240\245\275\260\n\313\372=O\373?k\304\036a(\353b\333\205\311ZXNkD\330[\224u\261\307\260EXNk\304\034\270\250.\322\246\254\215\252Y\242\fL\262\033\313\372\036\274\331\377w\336\226\263\347\3548\030\312\276\033\016\032\036\333\335\332\363.\312\223}\245\230z\250\261{\337w\030\343\252*\215O\337\203\263}\017\264\366=\340\261\357\001\323\276\007/\332l"
+	.ascii	"\276\205I{\263~\007j\366\232\255\006C7\233M7f\247\351\231I\331"
+	.ascii	"lX1\242\233\315\016\263\305`!=}j\266p\250:\312\023\364aUDG\326"
+	.ascii	"\357@\313>\2763\223\245\342<7\232]\207\241\373"
+	.string	"\314.sf\223\311RXN\353-\"\022\301\rO\207\336\335\331\226\250\252\337\201\225\375\016\314\366;H\262\337\001\221\375\016\254\266\230\263\031rcnd\375\016\246\366;\210\261\377\375e\317\375\230$\341\002\263\275\354.\233\313\226\333q\030\272\347\366\226\353/\371\356\330\315gd\351\r\230]\026\034\3177-s\033\316W\265\364\006\254\303\232fD\314\016\240\276\207,\373\036\244\354{X\262\357A\310\276\207\251}\0170\260\\Q\302cLW\326m?#.UVY\237\2035\373 ,1\353\331\020\366\336\267\250\3143\354\311N\333k\233\312v\262\3316\224-eG\331U\266\332F\333V0tO\331g\337Lv\023\262\272h\317\236\262\305\366\224]\326\263\201\345\244t\230\231=e\203m$XNK\213\301\211B\307\216\354)=\027=\031XNJ\023\211\023U\262\247\354$8\272tF\f,\230f\352\013\020\016:;a\r\352"
+	.string	"\360\216z\016\302\3669\370\332\347\340\307>\007U\373\034D\355s\320\264\317A\214}\004\344\355# \272\217"
+	.ascii	"\270}\0040\331H^<d\023\004\016"
+	.string	"\220\254\217\200\260}\004|\355\177\033\371\3762\262\n\303\313\372 x\371@\212~\355 N\222\242]bb\b\331D\366\220]\004C\367\327~\356\257\r$\215\220<\"v)\224\034/\223O\037\001=\366\021@c\177\203\273\375\r\334\3667 \262\377\315\265\243\346\234L\265e\235\024\343\351\242\351\331\263a,\255x]\030-\016\223 Jss\214n\354\242)\031yMp0\332~u\274\301hDT\321\027L\317\354\265\336\201\211\255yZr\200D\227\342\254s\266\242^+\034\257\347\326\261\237\366\324\266\261}\354\036\033\307\226\3329\266\325\256\332X\233\307\236\261\177l\252\255\265\2416\215\275\265\257v\326\276\261k\354\035\030\272\243\266\323\216\332L1\216\262T\226T\264g#)y\355\250\325\016\311\363}\315X\264,,K!\350o\340c\177\203\027\373\035\334\354w\370\262\337\341\312~\207\264\375\016a\373\035~\354w\240\261\177"
+	.string	"\274\375\003\204\331?\300\332\376\001\306\366\017\340\265\177"
+	.ascii	"\252\375\003$\355k`\267\257\001\230}\r\326\3665@\262\257A\326"
+	.ascii	"\276\0065\3663"
+	.string	"\220\263\237A\232\375\f\344\3663x\262\377\325\315\030+P\316\344\310\372 \310m\211\276\257\331\232Dl\r\2231V\206\004\004\313\231\025\252\006SZ\345\312]\220\256\025H\017\352$\001\243\245\225\2136B\027u[\303\326 ^k\030\t/\234X\031K\224\3261\262\025\210\360\210\370\276X1V3\350\n\004\313\241i\2679iV4\253\231\225\315Zf]\263\222Y\303\254_\326\350\252f\255[\301\254gV\272U\314\332\006C\3271k\227\257^\326\271uL\346J\257\b\331\367-\342\362\034\263*\305EW%K\3260\016FH#\340\344D\307\254Y\3268\016FH#\244\220\211\276\257\331\230\365lm\303rhZ\r\234h\326a\226\005\007\003\335\301\2135\250i\024\357\250\317@\311~\006C\3663\330\332\377\032\267nA3\233\202\2245\\\257\013\221\034X\262~\006V\373m\325\242\206\2411r\312\372\031D\355g\020c\337"
+	.string	"l\366\r\020f\337"
+	.string	"Rv\233\025\250\033M\264\262\256\242\312x\222CL\3267\200\330\376\277JY\247`\350Je\215\262RY\231\254kX\016m\004\025\267\350Jee[\271\240z\276\224\326@\331\275\357\273\241C\007\241\326\225\032)U\337"
+	.string	"M\373\005\300\333j\024\020Cf#\353\027"
+	.string	"\315>>C\033{>Y\233\210\255P\3264\f]\237\254NX$;\300^\250\372\005\250\333/@\227\375\002\274\355\027@m\277"
+	.string	"c\373\005\370\261\263\323\324\316VxG}\001\220\3661\300\333='\274\243\036\0030[\277xG]\221\034q\262\024fN\326\307\300\312>\206\256`\353\221\"k\326H\311z=r\266\240X\334\f\244\254\327\347Z\344?;,*#\247\306Zd%\342\346L*,\353!G\304\250\320\310\372\030@\331\353\327*\004\b\343\307\025#Y\037\003%\373m\316\366\237\305E\242 I\313\372\030p\355c0\265\265\023\336Q\327\031+\215\225\353\327\003\016\216T\326[{m\013\353H\326\307`i\347p\213J\345\220\"f\203,K\017\016\267\247\227\216\270,Q*#nQ\214\026\205\237W\262\3348\233\220}_\267$R\326\254\025k\365\261j\255Wk\217\365\307j\265\362\300\320u\307Z\265\356X\247\316\206\345\320^\027\320\006<\225\312\250\330IIA\242\313\240O\2003\373\004\340\262O"
+	.string	"\270}\002d\331'\300\225}\002T\331'\200\224}\002\254\355\023 m\237"
+	.string	"N\366\tpd\253f\360\216\232\276\353\323\352\364|\331\344\326\246\225\tCW\247u\351LF\226\302\361\\\235V\245,\365\245\024\246\006,\003of\356T}\002\274\373\003\200\263?\2005\373_\223\326\030.\304\324\320e\215dv$#\nON\326\037\200\226}\021\336\256'Q\220\347z\264\302X_`\350\352b-\352Y]\254Fx\215J\215S\032b\247<\353\332\261\365\007\340c\177"
+	.string	"L\373\0038\332\277\300\315\376\325<\025o\t\233\231\032Y\247mx)\026\f\006\313\241\205\020+\223\266]\305\313[\351\025,\207\366\276O\034\270)u]I\253\250x\251\025\fW"
+	.ascii	"-J]W\354\342\250r\3249*\034\fU\361\3247W\355\324;\025/\005\242"
+	.ascii	"\272\341`\204\364\276O%XQ\352\272b\367\276/\376J\373\301\345"
+	.ascii	"\323\277\027kP\361\023\357\250\277`m\2671\272\353\262\313\372"
+	.ascii	"\027\234m:5N\005\203d\215S\225rI\275\364\240N\033\212\321]\024"
+	.ascii	"\210*dI\231g:\227\246\341\020\343}y\204\255Q\245\2558vp\275$"
+	.ascii	"\034\253\235\322V\034;:\365\353l\034b\274\257[\216\325\212\322"
+	.ascii	"V\034\2738\f\307Fi+\016X\025]\272\005\303q0z\337"
+	.ascii	"\252\033\253\033\245\2558*]\312F\275\"\341\205S\004\260\352\350"
+	.ascii	"\324\"\352\226\242 \253\024-\351\033\007"
+	.string	"\243\367\265\242Z\341(m\305\261S\351\3225g\242*\033\225\214\032U\353\3243\352\0325\215\032F\035\243\232Q\305\250jT4j\031\fU\351T\036O\335\322,\347\241S\261T.\022^8\261LK\314\250t\251\232|\203\203\213\367-\242Z\343\224\266\342\330\t\227LI\021S\201\376\202\211\270(#\222\365/H\362\202\241\352\234\312E\235S\345\324.\034b\274oQ\216\025J\311\007\231\035\316\361f\304Ek\265\313\323+Y\312\030\250\"Y\337\202\272}\013\262\354[\220\266U\270\rC\036>\212\300d}\013\302\266\021\025I\317\354\211\202\021\223\233\372\246f\301PU\313\221\252E\rS\243\220\360\302\211\005\243\245\250\026\025\313\341zfB\336\227\307\224\252C\351\252J7\321\312\242c\353\013 o?C5\331\200\345\264 \360\005\345\f\n\222h\0245\211\312\204\203\021R\nnjQ\264\267\t\331\367\275BK\013\213>\321"
+	.string	"\313\241\205\220\"\026}_35\212\252\366\266.\26035\212\352d\203\372\203k\016\230\235\025\365\212\312\246VQ\247\250T\3246U\n\206\252Q\324\265\264\t\023;<\035}\001\204\355\013`\310\276"
+	.string	"\270\366\005\200\265/"
+	.string	"\034\373\002\230\261/"
+	.string	"\031\373\002 :S#B\343\245)\353W\020\205\252J0T]\242\216\211\251e<\352\236KT3\265L\247\256\314\0328\273^\2242l\230\250\372\025x\355_-#\373\315\031\243\232C\246\216\t\311\274\224xd\375\nl\354W\340\264_A\214\375\n\212\366\257\202\rQ\211\244Ob\274\301\310Z=\322s\025\314\205\226\022T\326\031\340\355S\340fg3\254A\325"
+	.string	"\357\250\247\240\214\227\372\354\332A\300LY\271\342\3255\207\366\322\005\271\332\3653*\031\242+p\330\324-\2558QS\274\262>\005a\373\030\252\376P\265\326\210\304P\313Z\325\202\003r"
+	.ascii	"\302\201\213\243\221\365\333\250=\376\263\3020dlU\262\376\325"
+	.ascii	"\036Y\302%/\357U\226\312\203uC''I\326\247@\310>\005[\352\216"
+	.ascii	"\\f\314F\223\254OAU\225\252\003CU\253\364\356yJ\246r\036\325"
+	.ascii	"*m\223\332\255c\326X\245p\324),'E|\217\316\310\211\342&W\346"
+	.ascii	"\250Q\265\272\244\3360\363\314\241\342P\2510T\235:\217:\225\342"
+	.ascii	"\251GB\242\342\373\366\210\363\234R]\2502\204Gf/\224\212\306"
+	.ascii	"hN\315\206\016\035~JYTD[\377W"
+	.string	"m\250R\030\252\336P\243\236\324\032B(Xsj\354n\250L\252\023\007#\244\021V\312Dw\225-+?T}\n\240\366\257\326\240\021\203m\210\230\254\325\031\276\032RrV\262>\005/\366\177\fU\241\216\231\204\270x\313\372\034\344\354c\350\353\324\246\237\341\202\213\032\313\372\034\354\3669\244\331\347P\267\017\202*\003\303Q\221\260\034Z\210\2703j\222\252\204\241\252\f5\206*#\215\243\005MT\3505$\311\230\252\317\241\313\326G\216\234lQa\250/\336`\360\fU\033\221\254\317\001\313>\207*\373\277Z\244\032a\250z\244\022\251G\251\034\365\345`\204D\242\n\216z\224\306\371y\r\231Sc\267\362\240R\266\245\352s\320\332\277\372\246y7\220\326\342\230\245X\244\276\004\311\372?\206\246s\322\273\227\347G&\351=\223\3659\354\330\347pc\237\203\323>\007\030\373\001\300\333n\3227N\256\310\300\322\270\t\300\230\375"
+	.string	"\200\331\017@\334~"
+	.string	"\260\354(\317p\006\225\023\244\254\037"
+	.string	"%\373 |I\305\364\240N;\315\007W]\212\006C\3233)\035Zz&\035\223\232\301rho\321\f\f\332,\t\213\332\245\331\341E\251\232LZf(#\b\f\256\254\037\200#2w\373"
+	.string	"\370\002&\r\223\241\230l\271\201\231\262\017"
+	.string	"\262\264\313\234\03381\262>"
+	.string	"\274R9"
+	.string	"\364\330\007\300\324>"
+	.ascii	"\232\366\001P\264\323\267\343\265\027\336\t\212Z\234td\375\r"
+	.ascii	"x\2335\303\032T,%f\247W\316\2263\2274UvYc\247\265\215\255R*Q"
+	.ascii	"~R\302\244\211\323\262{\366\200\023\215\222f\341\261\245R\322"
+	.ascii	"\265tJ\n%U\303\3204J\212\366\364I\232\226\241|\334\245QR \251"
+	.ascii	"\023,\247\245\341\322(\351\0174l\025\032D|\b5\226\303\032T\016"
+	.ascii	"xG\375\206\262\335D\250F\315\252I\326\337\320\265\017B\2201E"
+	.ascii	"\340\272\350\236\251X\352\225~\t{\357\313\203\313\363}\337\036"
+	.ascii	"#o\317#Z\356\210l\301had\236b\351\220\270(Y\312$]\222*I\307\322"
+	.ascii	"\262\364,\205\246fi\022\fM\305R$O\267R\256\347T,\005\233\261"
+	.ascii	"\025'\202H\2307\022\350ox\367y\320\354\363x\331\347\231\262\317"
+	.ascii	"S\266\317\363\334\347\271\332\347q\332\351\227\220\027\266\324"
+	.ascii	"\221RT\326\351SGm\311\352\312\372"
+	.string	"<H\373<D\373\023\220\331\237@\313\376\004W6v\302\032T\035\274\243~\202\262\375\t\206\354O\340c\177\202\251\375\t\226\366\237\362H\247\232\300\331\210\272\361\274\223Z\252\221#:CG\324FS4\235Jo\310\210\246S)\r*o\256\200Y\245T\351\216\024+\325\221^\245U\030\232N\2458\236\346\310M=7eT\242D\355\303;\352%\020\263/\201\227}\t\340\366%p\333\227\200\312\276\004i\373\022(\331\227 \311\376S\250TF\2345O\310\262>\bGf\240\346\3009{\355\262\316\273K\211\320\340\273\264\350\3143EJc\244I\351\213\324)eJ\233\322\245T)\205\221>ah*#u\201\323\340\305\201#\347\251\357\346<S\031\251Q]\264'\225\241\343h9B\"\263\227He\373Z\023e\367\276\357\257H\b\221\034\036}\th\354Kp\264\003jUt\034\301pIPU\252\322\300\300\202u\032\244"
+	.ascii	"\207$\021\242&\353\007\t1bD\b\265\301\2120H\223\246.Y?\210J\207"
+	.ascii	"\210\016\221`\035\033-ud\313\214\254\037\204\244\343\245\343"
+	.ascii	"\245\363\245\322hJ\022\007,\203\343eLG\310u\276t\236\3127:At"
+	.ascii	"\202\b\241\310j\340\031\311nwg~d}\345\234\316\017\235\037:\\"
+	.ascii	"\005 B\303MX/-\216\2136:[\327\341\202\266\241E\351\021\004o\013"
+	.ascii	"+\353+\253\350\350\320\321\241\343\243\212jN\213\332F\r\022 "
+	.ascii	"X\327\361\321C\235\203\003\323\321#\213%b\344\206\234'\266\306"
+	.ascii	"\233\305K\207\007\020F[T\335R\326o\243se#\n\226\254\254uv\b\271"
+	.ascii	"0\275LY_\251\245c\245\274\241\223C'\207\016\225T\357\213\n\233"
+	.ascii	"8:S\327\241:\223\305\316\276,]\371\342\351I\347\206\216U\214"
+	.ascii	"\252LLo\261\232\222\2443\343:7t\244\264\025#*^\244tl\2701\275"
+	.ascii	"qe\035\245q@\261\222%\353\303\320E\247\206\016\215\252,\034b"
+	.ascii	"\262>\fV\266\016T~\277\210\021\323BZ\353\322d-\353\303P\266u"
+	.ascii	"\232t\2324P\251\201gd\310f\016\f@t\224t\224t\226V\034Tani\f("
+	.ascii	"\2507:Kd\216\310ye\375\016\304\321A\322A\322I\362E\325\370\212"
+	.ascii	"\366\270\242\330\346tb\\'ihT\004H\320\005X\035\230\033Y\277\003"
+	.ascii	"o:F:F:/\222a\314\210t\\\\\347\205\220\314\324+%k\235#\235\246"
+	.ascii	"\351\b\324\356E8v:D\2750\330\354\225\262\"JS\002\036T\006\264"
+	.ascii	"\213\234\353\020]\347\375@\204\327\201\031\tS\224u1\2578\247"
+	.ascii	"\030\347u"
+	.string	"\231H\235R\232\254\213xo\003J\211\261\363q\307R\251\312\272\312\372kZ\230\034\317\254\337\201\2604i\212n|pJ>\310\300\202d\256bXi\363\242\2334*\306\325U\326E6\277g\030\272\"B\262.\256\371={Z[SF\262.\252\371=\335|\261\231\323\001 h\320\024\315\336;\222\322`\001ev\\\262~\007j\324\325\025\207l\240\221\301m\006\214\254\237\2343fL\261\f\217\025Q\033\365Y\303\207]\260M\325V\031\231\027\313\020\271b\027\005S\305\006\013\230\254\237\214+\312\025\345\212b\252j\370\260[\231\274\364\210\013\363\242\030%Y\236Q\262.\316\025\301"
+	.string	"\331\240\020\t\002\346\013\266\322\024C\316\234\031b\262.z\311JKGP\262.va\023\306G\232\"\027\217-p\276\262~rI1\256\030\027\254\313\200\304\n\315\227\335\213#\035Y?\371U\324R\324R\204{\202\346\021\001\363)\301\300\202\363\366\"\034[\332X\236[2\007\026,E7\254\344m\3420f\205\346\253'\345\305\210\221\333\331\244\270\234\262~\322\250\255\255(%\tT\231\025;36MK\262>P\231\"\225\"\225b\225$j\312\254\020\315"
+	.ascii	"\222\244\nf\342\202L\013I\226\"[\221\255(\005\307\317\315T\331"
+	.ascii	"\024\026kr'GJ~\271\240/vd}\240)E%/2)*)\256\r\221\246\324\247"
+	.ascii	"\037\0222F\254\240\275\270\366\242\332\007\"\274\r\253\321=\265"
+	.ascii	"\262.B9q\315\232&HY\277\230\306\n1\2436'\353\342\023\016\250"
+	.ascii	"\340\354\210\223u\321\311\321h\231b\227#\353b\223\243\t\252A"
+	.ascii	"\265\246\210w\2758\2549\243\254\213g\305%@iE\262\"Y\321\214g"
+	.ascii	"\316\324\2218v\371k\013\226\232b\331\213fgzQ\352\266\364(\n\261"
+	.ascii	"#\322\003-\353\003\r\361\321\371\350\212b?\326)\252\253!\023"
+	.ascii	"\017-Fb\305$pqpqY\027\303X\3702\002\344\242\210\244x\244x$L\337"
+	.ascii	"\025YrKS\244H\260\216\307\212\250\315Ol\252l\312.N\224\2453n"
+	.ascii	"^^\305!b\317u\355E\334\321\327\213C\200fl\244\241\312\272\370"
+	.ascii	",\n\301?\312lY\023\022\244\003\201\356\311s\254\250U\324*\006"
+	.ascii	"\341\201\223\3238\221\203\007\344\305 C\2550\271\261\254\213"
+	.ascii	"?\212\\I\320\270\241q\025\267\332\262\306d\274C!\234\271\246"
+	.ascii	"7V;\276\243\330\343\275\243\267\352\206\372U\303\207\235\007"
+	.ascii	")B\224\212Y/\366\370R\224\305\f\017&_\332x\360(b\315\271\301"
+	.ascii	"Df\016\020*g[\212W\3006]\260\370\230\221\365\177^\334x\221\352"
+	.ascii	"FQ\307j\205\347\307\016\336\224\0338\273\027iJ\203\237\036:\340"
+	.ascii	"\252^\324q85\217\211\224\253\342\324*\006\314\233\222\254\213"
+	.ascii	"9\322\0343\312\020\301\361\263@-\27085Y"
+	.string	"?\205\224\375\024O\2123\2123\2126x\254\210\324\224\0206\265F\013\233\327\214\253h\243\030\305\204G\206-\252X\343\256\t\364(n\243A\362\202S\244\341[\213\0015s\325\324T|\302J\336\246\022\256\336\\\001\353\271\240{[sz\361i\2030\250\263\0243\212.\212.\212KE\224\274\2712l;\"\323\244\250\364\342\022\021,LOY\027\223\2122\314\2001\021\311\372\030Z\224q\202\221\034e\262~\233b\214\377,\005\212\270Q\211QD\352\322f\n\215\254\2130~SoR\204d\375\024H\273\370\"\305\241uP\331p\313\372-\233\"Q\221\250h\304cE\224F\0035Sg\340\354V%Sb|\025\213^4\302`^\204\241\315\311\272U\022'\0161\217':u$\216\035{C\306\327\2209'\346\235\331^\222\260\241\312\232(\007\210\365d\315\251\375A\346\304(\031\"\234!\032~_\251\327\350\350\255\322\001"
+	.ascii	".Sd\254\330\275HR\032\004\327p \261Js\"\234\023\333| \002\361"
+	.ascii	"\216\251\355\312M\326D7\3047\030\3727\242\335\315\206B*0Z\031"
+	.ascii	"\373\370o\352\b\360\337T\"\233\013"
+	.string	"\245\266P\211f}\242\032\342\232\237\365\r\311:;\222\365[\243}\016\376\263[I\324\323\023\361\314\211h~\366G\326\366b.\353\373\340m\242\231\023\353~\026\367`\222\363\222\365}\334\354\237X\346g\201i\200Dme}\2374\373>d\302\204!\322\205\t\3318\251\021G\314\211tmo\210\260\331\322^\206G\360d\204\271\342\305\013\361\013V\3626e\210\233:\022\007\216V\333\034\342\334\211_\332\232\336\310\214e}\355%(\346%&\316\311\333\033Q\216\307\212hM\003\346\324\3003b\307&\035\031C\006w\242\034\221\313\017\027=\336\262&\306\255J]O\336\254\357\363\203\270\305\007\211\230\205\230\205h\204\001\222\027\315\227z\204\352\212\033\034,X\202u?8SeS\031T\2712\247\255J\025b\033\217\025Q\033\037\r\033\\pv\275\260\030atX9\261-\330\206\211\034\331\032\033\033q\nV\3626\271SG\342"
+	.string	"\363\240|\021\"\345\304)z\256,\f\035\0305\256)\016\234\"P\240\020\327\260\222\267\t\203\325\3003\222F1\002\323\245\206\241\304\2654\t\0253\033k)\226\0333lY\037\351\303\211\023\342\023\254\344mR1u$\016\330\373JiPB\026\2335h'>I{\245\200d\3756\230\311\177V\035Cd\007\f:&L\204P\230hf4\307\364\024\036\201\006q\"\205\270\204\270D\b\305cE\344F\30515$\312hJ\214)Y\037E\322\376\377tF:\203\b\345\261\"Js"
+	.ascii	"\247)/2\273\367\225\322@\373\2003F&k\"\224hvw\303J\016\261\314"
+	.ascii	"'\313\211\225\254\177\f\263\177\342\030q,\b\247\001\361=\232"
+	.ascii	"\263\223\362:Im\320\003#\232\213f\375#\225\250\023\251\210Q\304"
+	.ascii	"$=$\251wF\2079\261\335\345T\246%\353\260\253CT\"k\221\2300Y\262"
+	.ascii	"\376\221\311>\026\253\"Z\231\211\022w\224\211\362 \366\300rZ"
+	.ascii	"\0200\302%\232\306!\352\020#C\034B\324\">\243\330E\357\210C\210"
+	.ascii	"XE\210H\210`D#\304/\"\021\342\021\f%\016!\372\340!\016!^\215"
+	.ascii	"\211\276\257\331\220M\022'6\210\272\352u\034\214\220F\220\021"
+	.ascii	"\275\210B0\224\370D#>\211?\210]W%\304MqQ\331\320!\250\346\013"
+	.ascii	"]\016U\377\304.b\02053\037k\262&\002\221\262\361\346\"\353\037"
+	.ascii	"\263\366O\334\302P\"\327\317\3546`S\360^\207e\013\353j\3778\265"
+	.ascii	"\177l\"fm0Q\252\270\254\177\214\261\177t\261\377\302\234\375"
+	.ascii	"\027\356\366_`\263\177\242\025Q\307\231\0266qY\377D\035[\224"
+	.ascii	"\214\262\376\013\321M\304A\234\032\206I\351\001%\353\023W\330"
+	.ascii	"\342\002%k}#\277y=\227\262>QJH\327\365\004\232\365\211)\224<"
+	.ascii	"67\262\006B\367\213\027\274d\340\243\212\242#G\326\177!\215\030"
+	.ascii	"\343\304\031\304\030D\032\032j6ChD6\265A:\327EKR\326:\3504%\357"
+	.ascii	"-kb\023\361\211\b\365\263l\025\245\271\251\254\377\202\222}\242"
+	.ascii	"\223\226\227 E\262\316\370m*q\351D\246\237]\305\234\216\236d"
+	.ascii	"\375\027\306\366\2112\210J?\333\223\003W%F\326\177\241\310>q"
+	.ascii	"\004ev \311\032He\277x\241G\006,\031%u\\Y\377\005\030\373'\302"
+	.ascii	" \302\300`FX\025Aa\360\206(\217\210p\n\306\022^\033\027.\204"
+	.ascii	"P\371}\337\367\271\272\311\251\323U>\316\246\320\021\213\210"
+	.ascii	"ED\243l\365E\016\\\364\225\222\322\2005\263\305H"
+	.ascii	"\225\254\211Fkc\236\300\306\262\276\261\212\0349\3047\203\034"
+	.ascii	"\237\032?\254\344\235\370\266\r\305\236O\300d=\234cL\202\207"
+	.ascii	"7\274\033A|_\2542O#\220\341\032\f\035\256\031\336\371\346\354"
+	.ascii	"t\227\027\344\206\364\220z\363\241\335?d3l\323Kz\241\254\253"
+	.ascii	"\313\224\254\207nz>|\223\342\210\221G#\353G\301;\252f\303;\352"
+	.ascii	"\2155\206i\206i\204Q+\266`\304\201\t\337\260\245i\312\372\306"
+	.ascii	"\027h\320\b\2416\021\317\030\035\360\315\312\211\220\254\317"
+	.ascii	"\0014\273\256.X7\342\305Ar\0259sqY\237\003Y\306\f\313\214\021"
+	.ascii	"B\221!#\204*\313\323\022\307H+\353s m\237\003D\266\0301\302\250"
+	.ascii	"\375\016\241q@\007\0300k\334\236\034 \232\373\234\020\312\202"
+	.ascii	"\367}_\274,\330\254\021\213\316e\031v\3112\224\323\242e(\307"
+	.ascii	"\223\206MJ\203\337\0134$r\\>\224[\177\254\301\202\313z\030\007"
+	.ascii	"\264\362)\261}\201\033n\021\323\204\004\313\226!\\\220!fb\314"
+	.ascii	"\371\273akM=\211z\373\241\371\377\272\034;\312\262\376\006\250"
+	.ascii	"\354o \f\013\026\f\307\003d\003;\252\f\333\252X\2612\245k\003"
+	.ascii	"O\373\032\2003e\n\027\224\271!\333\220-M\003bP\206kP\206jC5!"
+	.ascii	"\324&z\200\016\030q`]\373\032\270\361\344\311\021-O\r\304 \033"
+	.ascii	"\236\221\r\235\f\233|\350\004#Q\212\222\312z\310\004H\225\305"
+	.ascii	"\310qJRV6\\\202_\247#cJ>\\\262S$k+\353!\024Hu\343\215\221+Y\017"
+	.ascii	"\3152@\267\237\001\263\375\017\305\206bL\031\350\002\033\206"
+	.ascii	"\201\t\241\324\367\305fVMN\257\224\223\006H\220\b\241\360\353"
+	.ascii	"\024B\233\037\031h\332\307\300\230\375\340\023\036\026\031~\r"
+	.ascii	"\215`0\372E{\213\240B\230r\006\003\\\3661Pe\377\303!\303!\027"
+	.ascii	"8\r\335\030\241\342r\"DH\260\316\203)u\0308\262\377\254CG\276"
+	.ascii	"J\217\336\036Z\276\247\215/7\031\2603\032"
+	.string	"\323u\f\035v\005\3054 N\360.,KH\326\307@\324\3763\217\314\343\0075\302\352}\"\341\310\023\315\327z\025\025'GV\316\312Z\032X\025]Y\020\215\032\022\026\024\022\306\304\250+w\375\230\264\222w\306\372\265\364\006\flMQ\232\034?\206?\202`FX\275O%\220\t{\324UI\312\372\030\200\332\377\320\007\206\016}\374^\214\260z\241Hh\303f\201\223\203K\326\307@\3220k\230%\214\212\213\263\207XC\254`\035\036\353\0023\3341\334\221\204\356\002W\366\357\033\343\033\203\327zGo\225\326\n\307\006\027\\\312\266\304\206\220\254o\334\030V\2155\301\210\263\033R}X\345\346cM\230\254\337f8\245\226v\247\225\365?\234\032\346\200\302\305\207T\033=\005$M\230\254q\370\312\370\352\376\027\n\353\f\227\254\177\001\255\375\017i`\350\220\306\320\306pilh\343\037\326\030F\345(yiN\032W\326"
+	.ascii	"\260\302\032\324\036\017\274\243\376\0024\366?\204\032B-]\240"
+	.ascii	"h\3504t\022B\r\351z\252\0312\r\231\204P!\f\251\262\300\225\375"
+	.ascii	"\017\223\206IC\245\021VE3.\230\323\224$NM\022,DY\017eh\025\310"
+	.ascii	"\220$`Y\337\002M\366- d\377\303\027\303\027C\244\364\350-\342"
+	.ascii	"R\247\232\302\242\202\264i\"\312z\bc\265\n\003\206.\353[\240"
+	.ascii	"\307\276\005\242\366?,\032\026\r\217zG\257\225\327\017\312W\206"
+	.ascii	"V\22574r\002$\t\230\254o\001\030\373\025X3g\316\360M\217\336"
+	.ascii	"\"0\325\211\211\214\235\021(\031\216\254"
+	.string	"\205yQVx]Y\277\002s\373\025\210\262\177!\034\f\025\302\021\3069\200\026\246\260\347\221\035MY\013\361\332\3140\211\313\372\025\020\333\257@\226\0337B\273\364\350\355A\246\206\375\336\360\236\274e-|\223\261\2337dSY\277\002M\373.\260\331\277P\3151T\250F\310\246w\364\026%\361\211-\275\001\323\321*a\257p\215\335\216*+Y\337\205.\373.<\331\277\320\f\206\n\315\b\243\032X\2753z\346,\235\021\263\013C\243\232\023F\177a\235\360\214\020\r\266\022\373\2122$I\027\223\267\254\201jxG\275\013?\366/\244;\206\n\351\204d4\260z\241<H\323%\217H\006\302\345\311$k\341\030([\226T\311\372.P\355\273\240\264\177\341\227c\250\360\2130L\t\374\276P\262\3066\321X\222Z\326B0\301.\"xiY\237\002y\373\024\250\333\277\320\313\277zY\3470T\350%\330\205G\311K\344"
+	.string	"\2455Pn\357+\265\301p.L\0228Y\237\002tqqB\271\364\350\275z\242\206)\205\251\361-\301\272J\022r\021R\261\302%M\326\247"
+	.string	"\333>\005\204\354_\b'\204\363\242"
+	.ascii	"\226\233\233PK\357\350-z\242\262Q\032b'\214:R\345$\013\265\\"
+	.ascii	"\230\345\2053\032dp\200\215]\241\313\372\024x\367/\274r\f\025"
+	.ascii	"^\t\316\365\220\254\336\247\022\242J]WT\034O\360\216\262\376"
+	.ascii	"\2118\373\027R9\206\n\251\b\255d%/\321\217mn+\316\216\252\206"
+	.ascii	"\r\030Y\013\253<\323\265i\301\222\365O\234\331?\361&\224\"\224"
+	.ascii	"\222\245\226\250N<\211\022%J0\355\t^Y\231\232Z\026\340\233\367"
+	.ascii	"M]\326?Q$--\310\005\027\217^\036P\236\357\013\267\201\217\314"
+	.ascii	"\032\327\233\365O\360@C\013r9\200S\224\227\247\335\373\302m\300"
+	.ascii	"Re\031Ie}\023r\366/<;\0236\341\261z\241\030 \004jM\324J&\007"
+	.ascii	"\233\226\254\205Lz\317\2602oY\337\304\231}\023Z\224(9\333\331"
+	.ascii	"\243\327\255J\312\373Jm\360\303\303\022\347%\353\233H\333\277"
+	.ascii	"\320\314\354l#\254\\,a\300\021)h\276zLZt<e}\023I\310\310\202"
+	.ascii	"u\036\274\3110\321c\037\303aa\222\377\003\021\204G\204b\030N"
+	.ascii	"\277R/\221\032\013\2600\231\230"
+	.string	"\3327\341\264\217\221`!\030\206\n\301\204HF\230\275D\302%qhl\020\344\002\264\202S\242\361\366\246\253Kh\304\003,1\212\\h\344\347B\r\232\252\254\205D.\240\345\b.k\341\220^\322p\314\0253\317\254\205_@/KjmY\013\205\034\215\357\f\024J\223\254\205\317\267\365\226\034!#'k\241\0270\314\024\231\266\254\337F\223\371\317\376\260\266|\331\222\365[\230\023\002\021\002\021B\341\367\345j\301\311\376\205[\302-\274\306cE\244\306\0025QC\302\264\0344a~d\375\026\260\366/\354q\f\025\366\020j\215\260zgX \304K\231\225\r/lhe-\364\241\341\334\260\321$\353\2670c\177\002s\366/\344!\344\241\273zHVEX!\bQ\342\266\301v\203\005\225\313\372\0230\263\177\241\025Th%\274\342\261z\241H(\"\207\346+\005\303\224\305K\326\302\035H\210`\205e\375\t\304\355O"
+	.ascii	"\312\324\224\260j\277\357\333\204$\244\272\260*}\302C\r\022\216"
+	.ascii	"\377,\013\375\342BK\326\237@\020\0348\202q#\254\336\031\032\264"
+	.ascii	"\2611\302\004Y\313\372\023\350\261\177\241\224\024\006\343\013"
+	.ascii	"\022c\002M[HCHC\030\205\031PE\307SX\343\302(\241X[\364\356\352"
+	.ascii	"?kl\333\262\313\372\023 zz\022BU\221!\204J\275\020\351J\313\372"
+	.ascii	"%\320\354_\330\204\241\302\246\\E\003\263\227h\030\004\255\004"
+	.ascii	"\027a\2220I\270\204\337\367\210\016\241\322\205K\276\264\037"
+	.ascii	"Y\360\262\026\312X\337\342\260t\274\255\306\224$[\262~\211\256"
+	.ascii	"}\341\013,DB\002\332\320f\357"
+	.string	"\323\017\312\223\022V\373\030hC\375\205.\240B\027A\270\024\351-\022\322\301HLj\203^\016\271\256\254_\"i\377B##\314D\023\337\243 :\236d\3667\300B\"!\021f\202\235v\332RU\324m\377\301\274<l\206\307\354\205\202\201\356\335\340,D\331\177P\216\034\314d\204U\021\324\005_5\360\214,"
+	.ascii	"\352U&\353\263\020\265\377 \336\377\201\b\030\032\304\303p\330"
+	.ascii	"\354mZ\227\264\346\3547o\202w\370uz_!iA\273\007\357\306\232\352"
+	.ascii	"\326\262~\033\240\215\377\254&\263\025-\223\365W\250\333\177"
+	.ascii	"\260M\233\374\226\330IA\244\242Y\366\203ipp\315\232,Ub'-\345"
+	.ascii	"\210\276N\357\006_\301\311>\316R\352\037\214\036C\203\321\374"
+	.ascii	"f\263\327\311\027\244\311l\203\2570d\377\230\r\263\341&#\254"
+	.ascii	"\212\256,\230b%F\212\320M\233,$Y?H&X\346A3\017\232\t\326\261"
+	.ascii	"\357\373\276R/\321\032\013\3320\301\210\263{\245\2344\370\337"
+	.ascii	"\346\301:V\310\020,\245\254\277B\215\375\343\347_}"
+	.string	"\213\234\336\367\205J\315^'#\240\372\343\343\024c\r\376 \356\341\001\374\327\275\277\002O^x_\256/\317\367}1\233=\204\255(\207\005\357\377\177\202\367}\237\220\216^\"\214tv\365\204tv\345TD\202\273zz\217\236\300\216\256\2540\322\321\225\223\323\321KT|\317\256\234\220\336\253'\342{\366\332@:+\"\302HG\357\323\373^\275\304\027\251\350\351=3s*\"\235]9!\235]=\025\221\316\212\236\220^\253\227\210d\306\303\3515\273\"*\3128+zz\317\254\236\212\357\331\325S\214.9\320\r\270\260\311J\342\346\b\013\031&B:z\231\226\246\212\234\210rHfV/\335\373b\264\027\257\323+\367\276\003x\337)+'\272\"\033X\212\221\034\223\221Z\221\0256{\337w\303\222\021\226\325{$G\204_9$\"V\357K\304\b\350]z\337\367\r\201\310L\356\375\201\345\210xL\275J/\336\027"
+	.string	"\257\331\373.\275/\021~\345\336\367%z\337wu\2322{_\034D\244\347\322\322\373J\361,\275SDS^\274oF##\345\t\351\f\313\252gJ\223\263\347\013\303\214\b#)Y\275\317\227\356\312i\237\021A_\245\367}\361\232\375|\232\241&k\263\237\224\252'4\310\244qi\223u0L\007vH\301\222\365U\030\263\203_\356\346\232\230e}\025\346v\320\313\321\324\225\233\254\257\302\226\035\224\203\362F\205+\333L\ni\215,\353\340\026MF\343\005Y\326W\341l\007\337t/\r\211\2152Y_\205!Z\334\200gv@\311A14\b\r\272\3518U \313\016\013"
+	.string	"v\320\230q\302QTT\326\177\220\311\203W\376\240\222\340\222`[\b]\234\242\262\266\3423\262$\215[\326W\201\006\024\267h\223'oN\266@a\303\021\204\313S\nJ\020\rn-H%(%\250\026\234\022\214\022\254\022d\303\320 \224`\232Z\343H\027$\035\375\024\332\354\247`f?\205/\373)\274\355\247Pe\007\317z\036d\342\001\036V?\262\356"
+	.string	"\357\250\036\274X\203\252\246`fF\326{\022\303\007\230\0304(\026$\323q\252\300\023\252\036@+5hp\b\311c\017\362"
+	.string	"Z\375\220\021\244J\326O!H\022$\252\325\23369\26604\270\025D\242\343\204\2011I`\371F\0203%%mj\321\340\221?\347\br\005\215"
+	.ascii	"\221h\331\b\223u\021\341\324S\223$Y?\005$\262\033A\272\322\272"
+	.ascii	"\306\272\2028\320\242_A!\301!A\257 \221\340\023C\203]A \\j\220"
+	.ascii	"\350\204\372\022\230\263/\201,{\225@\223\375\007\177\004}L\241"
+	.ascii	"\002\023$\353c$8h\003C\2036\202>t\234*\360\004H\364u\242\261"
+	.ascii	"A\217}\366\205\204\006P\314\023/\252`\326\237\261\202RA\036@"
+	.ascii	"_]\331\226\252\254\261\336\025\n\316\030\222\254/\201\036An\004"
+	.ascii	"u\004w\004\251\202W\301*\f\rZ\005s\360\364\244\246\254\264\031"
+	.ascii	"\355\205\204\027NlR\026\220h\320*\210c\315\362\202\021g\227g"
+	.ascii	"Dq\363\002\352K@\307~\004\362\366#\340f?\002gv\372b\r\352#\360"
+	.ascii	"\266\377`T\222%.\"Y\233e\220:\302\224\365\203O88\343\030\032"
+	.ascii	"\234\201\301`\247\235\306\245\026}\235\244l\360"
+	.string	"\b\224\355c\fF\375\2031\2021\202NZ\311\013\365\343*\223\332\240\027\245DW%\353&\3546\304\314\\\326\217\300\327\376\037\\\302\320 S0\t-\310\024\224\021T\342\341\246\302\325\370\212\016\321\330\360AC\007\225\300\344\245\036b\220\262~\004f\354G\340\305>\2114\373E\020\206\320\215\2146X\340^\004\217\254p,)\312\372$\254\354\240Q\360\305\320\340\033$\032a\366\022\351\310\300\013\022\001\363\330\244\350`\312\372$\306\366\234\264/vIY\237D\326>~\243\006)\352\006\230\246\007ub\235,I\362m\255\311{\306\001\276\001\312\001\302\001\332\001\3610\024x\007l\003\274\003\262\231\023=\003\336\001\243\300\036U*T\r\037vv\357\373n5s\214\244\b\365G\240\331\037\201e\177\304\332\376\210\263\375\021c\033\230\006\203Q\217\264\r\371\312\372#\274\366\0174s\f\005\232\001\236\3619\255P\207$\372:9m"
+	.ascii	"\254\033\236\215\265\211e\375\021S\373#\236\366\017$\003\005"
+	.ascii	"\222\361\271\3411{\241\206Ka0\342\354^'\247\r>\302\305\326]^"
+	.ascii	"x\337\243TG\033)3b\216\241@1@0<\373=\202\033\023}_\251\r\200"
+	.string	"d\230\216\364\310\372\"\324\354\037\030\006L\031\f\265\"Y\177\031Sk\233\222\365E|\321f\200g[\236\300.\3009\f\005z\001r\301@/@9\340\031\024/k\242\262\232[\031\027U_\204\333\276\210\264\r\214{AN\020\031\\\340\016\334\362\340\324\027\217\254\254\201Y=\007\302\2457\336vpe9\360\355\007\002\001j\351%\275\260E#\312\233\2541\030\326\240\002\243\364\034\230%\250\005\304\b\033\226\003\335\3764GnR\363\274\330(e\3353\3529\020\313\021\215\264.`\333\201W\324X\0354rx\311\032\270\325s`\233:\347N\006Z\225\003\255\\K\026\026\246\254\201Mz\016\254\362\203\362&\307k\312\201T\256\224C\nM\326@\263\236\003\247d/\264\267\267\265\003\245\374\300(@\266\037\224K\034$Y\343'\326\240J\200\244\347\300\265!U\027\221\324\223\003\325~`\032\020J\016\262\264\225\2265\226\2025\250"
+	.ascii	"\300;*\260H\317\201O\330\222p\341\301\344@\264\037\330\004\350"
+	.ascii	"\004\327x\257^d\215\245\260\006u\007\357\250\351V\317\201L\330"
+	.ascii	"'pz`Qr\340\331\017\024\003.\2213b$L\326\030\tkP1Z\317\201J|Q"
+	.ascii	"\242I\232\312\016\204\376@3\234&\206<9o\262\016\006?\311\024"
+	.ascii	"K&\b\267\025Q\024b\272N!\211\026\312%\013N\022M\021<I\237\013"
+	.ascii	"\304V\211\342xB\205\332\032\233L!_kd\301m2\205\202N\346\332\272"
+	.ascii	"\307\026|\206\216(v\033C\322D\033C\322\304vw\023\350slG(\223"
+	.ascii	"\307\023.\220\307wt\217!X4\205M\267\004\t\r0 \217(\224\312#\b"
+	.ascii	"w\231\354ip\2220J\340L\n\227\255\020\013?\314\024\226\311\237"
+	.ascii	"\326\004 gr\331*\205\332\026Np\201\304\t\020\037\214'\204`A\005"
+	.ascii	"#\210\026\214&H\024\2350 \231J\023Nh\221M&\n\255\223\251\004"
+	.ascii	"\241T\0169\223"
+	.ascii	"\031Np\222 \0029\207\224(,\217\255\nC$\320mE\b]\247\321\t4\341"
+	.ascii	"\3236\217@&|\226\311\024\031\226\255\020\013\007\362\320l\205"
+	.ascii	"\332\026E\007\314$\263\211L\252\320\006%O\264?\0238\223\026\270"
+	.ascii	"\311%\t\267u\272K\022(\206L\26486\233\307\340\b=&B0\301\005\023"
+	.ascii	"$\030I\3709\236\220\340g\231\\.\207Zp\266\315#\321\204s\210\231"
+	.ascii	"T\3216K\270\255\b\237\244\220\004n+b\002\027\334\366g\202\017"
+	.ascii	"n\373SL:\235-\270\355\317*\024\204\fj\203\324\017@0\001\202\361"
+	.ascii	"\203\237\343\211\003yh\215\303\237e\322I\202E\263m~`\321\344"
+	.ascii	"\001\200\t.\214\320\243<\"\201\334cP\007\256s\311"
+	.string	"D\246J\365@\036\216\3561D\013n\373\243\023\302mE \335\246\3205\372\224G$3\005\367\030\324d\242\260\343.I0O8[\267\205\t\356\221\211\334i\227\311\024\234\022\270\3066\206\244SU*\207\226K\346r]\301l\002\271\314\345\232\342\330*u\333\034\022\322\313V\331t\235\352\3172\331tM\354\244p\227\311f\t\243s\310=\272&Z\344Q\310D\263M\221b\310\204VE\263u\266-\204p\333\237 \213\246O\333\034J:\235-8\223\304\325\004\027\234K\n\034\310\203\t.\b1\021 \3025:Uh\203\222\356n!\304\004\341\036\310\303\217\020r9\204\302o\231\"\247N\343\217\020\3205.\177\204\322\345\217P\017\310\375Y\266J\265\215!\351\324-\204\230H\335t\205z\017\266h\272\316\344O\333\202\321\247]}Z\347\220v\256?\272G\037\343\217\220\007\241PP{\342G\250\002\237d\211\242\233\\\222"
+	.string	"\266\356\261\005\267\025\021\304\\\266!J$}NhqTA\b\344L.\223(\244\360\303L\301g\371\001\006d\013\004\"\005\237\226g\270$!\201P\333\232\340:\217)\2240@\320m\036]\023\031\232\255\005-\234I\346\n\0310\231)x\340\301m\036\205<8?\024\200\365\300C\033\224<\361\3739\333\023M\246\313Ta\231\034\036\310\203\263\003f\363\210B\377\034\203zG\367\030\302')\264\372\264>m\273B\n\022\022\b\215mP\322]\0165;@\246\36092\225\301\237e\262\205c\323]\222\030*[\023\001p3\270Cw\307\315\340J\340\002\300\235\300)"
+	.string	"\267\310l\266\370\321.\017\005-r\3316\333\024m\013\003@\"\217=W\247D\2106(y\202m\301M\212p\233L '\361@\036\332\240\343\n>w\007\350'9b\270\202\231\002\013\314\024\313\244\263\205\t\266\307\203O\333.\177\3166\350\270\002\217\317\262u\356$\207L8\220\207\237!\024\255O\007>\312\344\020\212\326\207\251\202\233\241D\321\325\361i\201\220G\344\222\002\256\263u)P[ \344\021D\320D\t\021\255\233l\256(\016K|\370Y&\235\024hql6?\264n\262Y\001\017\202\032\232mP\362\304\n\246\322\204"
+	.string	"L\024\223A,\330\003y`&\335\366\307g\310\204\021\031\234-\226\037|\332\237\037f\nnk\202H\202D\261D\020s\204SH\304\0173\005\037\345\020\023\310\004\005G&\233\355\262\375\331\017a\004\016F \201\305z\022\024\340\201\002<PO\202\002zz\0240B\317\376\b==\327u\217\256\262\rQ\001\t\022k\211]bu.\223G\025tF Y\345\021\003\021N!\021n\253\266J\241\240\244"
+	.string	"|\332\345O\322\2043\271W\347\n\246\322D\n\001p\221\315\016\220)\334$\n\035\344&M`\301D\001\204\301yTa\311L\"\233\031Zc\223Y\"Ck\364!\301\202\211buJ\340\036\310\203\006\256\223\t\002\3504N\300n\247\352:\221I\237\266)\024tu\234B?\276\026M\246\353L\216X\301T:\177A\255\353laB\307m\203\216+\2648*\205\234I\237\237\313T\272[\330\032\205\206\230M\021\0378\370,\231 P\230\300\275@\250u\235\332it\272G\327D\320\261m\272\316\240k\fa\004w\231\\[e\322\267\272mP\362\304\317i\254\240uI\3740\225\3006h\310\331\266\360\263L\376\3740\225\301\241\f\256\323\270A\250mM@.[8\267\353<*Y\2471"
+	.ascii	"\316\237\2432E\352s\017\344\301\231\242\3651\376\034\225(\270"
+	.ascii	"G\2462\005\3534\032\335e\253\342\204\037f\n\004X\321.\367\221"
+	.ascii	"\251DaE\273\f.\207P\320\371\260L\3528\215\252{ \017G\024\031"
+	.ascii	"Z\367\250\034B*\217HV\3659\266M\243O\273L\242\bb\"\203\356\320"
+	.ascii	"\026\032\332\256\353\016\031\335\366G\210\005\241!\243\333<\272"
+	.ascii	"\316-4\264\266\"\216(X\241!\243\333\376\250ms\310mO\264\315!"
+	.ascii	"\247\263m\226HC \223n\273\3749\006\355\270AC&z\316$"
+	.string	"\213\017>I\241\240\353\223T\036]@\201ES\203O\013\003\362(\244:W0\225&|\230*\f\235?G%\n\276\326y\004*\321\2468:\225\311c\212\240O\253\"\331\"\333\026\224\307\345O\322\004\213&\321E\301\351l\227Lw\350\230\301i\334\361icH*\217I7\271$Qt\201CF'\253\266F\022<C\235\f\2551\004\005\255P\213\f?\313\244\353\266&&h\201\\\266C\036h\233(\200\330\340\244@\320\261\211\202\212\243\216\313\342\030\324s\032O\230@6\003\0204\344\354\245\313dP\357g\231\334\316$\213\017\354\201<t\300!\305\320\3316\207\334c\213\302\262\035\036\310\003\213f\007?B;,\232>\241c\020\262\2316[\237\244\nfS\310\247e\321T\036\223\315\326Yd\321*\205\206B\244P\036\201|\255O\262\271LZ`\374\031R\n\3614}\226I\024F\367\3504\006\r5]\030Z!g"
+	.ascii	"\200\255\362\210\364\271\315V\3052\211l\372$\203\322e2h\2638"
+	.ascii	"\006\355\241\023\304\222\231$\201lN\340l\333\346O\033\"\350\b"
+	.ascii	"B\205P\n\235\017\311#\3172\211l\235C,\232?e\273\\\036\201\220"
+	.ascii	"F\026CG#\213c\320\320\251\341\327\n\265p"
+	.string	"\213\033*p\207\204\226\311\tZ\025I\367\250\"\331l}84\231.\362\230\302\370\263L\002\271Lf\220\323\210l\362\b\031\203\216\315\024Fd\323iL:\235\315\r>I\243\233\\\016\005?P\262h:\207CG\024F\347\020\n\247\360(\fj\036\215\256\263\231La\\2\215\312#RCP\363\350L\372\024\017\344\201\002\347Q(\210\211\034.\223Jd\353\343.\333\240\237cP\360\347\030\004\374\t\177\216AC\341\322\211\3749\006\375~\216'\\\241\241&\220\331l1\360s\fZ\335\003yp\227m\320\220\261\350.\333\240 \246\353\034B\032\177\216A;\007\362\220\024r\016\227N\2441)\344\034\032\221\037$\211\255R(\350\350,:\223\314\245P\331\2520\246@\376~\216\256\021\311l\201?G\327\330T\"Y\030\231\315#\212\240\206\030\200\214)\204\224\256kL\321\372l8\220\007\237\326m\225BAL\020\310\f\316"
+	.string	"\2548\266\3509\221\311\240\343\262E\b\r\314f\213\001$\362\270\272)Z\037\243;\001\020\322M\n\245N\245\222\331\324\316vHyT\241\016\031\201\220n\262\204\317\362\203R\311l\356\25486{\316\240d\363D\263u\333 \246\316\201<8\221M\016NdSg\2578\266"
+	.ascii	"\372,\217(|\216\255O\261\375Y\036\201\220F\327yLa\364Q2\201\214"
+	.ascii	"\256\362\230a\305\261E\006\367@\036"
+	.string	"\224\314\246\213A\353\036[\330!\301'\251B\023\310]I`\n\2618\241\t\344n\237\263u\217- \233+S\210\305\t\310\246\352l\335c3\rA\242D\023\350\304\262\205\017\f\307\266\211\302x\024r\205\255P\013W\002\025\216B\356\352\223\024\3729\235-\222\331\0242\372$\205\212Kf\322]\266*\332\246\020"
+	.string	",0\266\356\261\3651\246H\301la8\272\306\026\307\025\307\345P\223"
+	.string	"'\334e\033\324\252`\252`A\020s\331\372\030\221\313\026\316\024BJc\333<\256\360i\036\201\202\255s\310\310t\1771"
+	.string	"\rc"
+	.string	"\"\366\364|`\214\001(\303\007F7\005\323\311\263\342\330\3028\\\301T\246h\266*X\200\001\331\002!\203E\235\342\212c\013\035\024I\345\021\004\263\331\342g\202\235\235\366gyl\016\201\\\237\344\212\t<\360[\266\360!J\340T\333\240\244+\304d\246\340\266?\315\243+L\001\"\304\207\3552\233-~X\025m\210\025\307f\006eP\203{ \017\314f\213\237\342\2201\005f\263\305\317\216\013\003v\032\177\255{t\235i\217+$\024\366\364\354|"
+	.string	"\324\320tK\020]\247q\177\260D\241\205RH\350\203\004B\367@\036\002\360A\213\3544\372\034\207<\220D!\364"
+	.string	"E\356A\221?@\221{\216\371\203c\356a\221?`\221{Z\344\017\226-B\2400<\220\207\224\251\272\007\362\320l\223J\241\244\253\034\n\312"
+	.ascii	"\"\204\t\236VyD:\335#\n\025\254\362\250BE\322\307\3316\017\344"
+	.ascii	"a\311L\036\007\3404\"\221\307\324=\220\207\002\270\007\362\340"
+	.ascii	"\004r\217AA\330i\024J\261\303\"\331t\217*\b\335\241q=\220\007"
+	.ascii	"\0279\324t\235\0378\215,Zw(\250\b\003\222\2514\032\215k\263]"
+	.ascii	"\256`\032\215\253\263\331:\207\226F\343\366Y&a0\032U\3472)\344"
+	.ascii	"4\032Wek4\262\256\321u&\225\304\003yp\266B-\\\016|\332\346\021"
+	.ascii	"\310\311A\007N7\211\242\203\241\345\017\007,\206\226I%\007!\214"
+	.ascii	"`\034\201\004\026"
+	.string	"\035\264>CJ\3442\331A\3239\324A\t.\213v\251<.\233>\307\266\t\344\n\031\215\023\250h\233BF\243\352:\223J\243Q=\272G\037\243QmcH:\215F\025\006$S\251\221m\323\350s\223K\022K\024\334\3442\2516\335\022\310\345\020\n>\307\266\005$\362C\006\247QE\033\002\211<\356%\n>\307\266\251\272NcR\310D\2126D+\324\342\204\221D\t\023\277\026\271<\272\316er\273F\026H\350e\262\304\322\211T\223B\316\236\323\b\342\003\022?\020\037\220`\221\037${\007\362\340\034B\241\002\261\331\272\316c\220\352t\266M\037\237\343\332\2528*M\f\t\005\355!\243\212\326\3079\204b;\215!\234C(~\255\261\025jq\3029\204\202m\205Z\270\316!\024\253s\bEOD\217\021\211<\252+\216-\200\b\361Au\017\344aH(\310\310l\266\370A\"\217\0358\233\255\212d\323\347"
+	.ascii	"\255\261\005\017D\360`\204!\241\240\035g\333\3649\215\031Z\243"
+	.ascii	"\211!\241\240\237\352*\207\234m\013Kf\322E\266n\033bH(H\2475"
+	.ascii	".\177\222\312\243Q\270\374I*? \221\307\335\302\347\330\266pt"
+	.ascii	"\217>l\323\231\302\b\364\223\0042\"\221G`\353\303\004\261d&\235"
+	.ascii	"I\025m\023\330l\225\312d\nUyT\321l\335%\211\237eR)\024t4\201"
+	.ascii	"D\036wZ\344\222\005\327ylSp?\370\264\356\321G\210\002\316\344"
+	.ascii	"\206\240{ \017\035\374\bI\320l\203\222'|Z\tT\264!Z\367\330\002"
+	.ascii	"\220\270d&\235\315V\305\222D\320\212\022\305\240\025%|Z\344\262"
+	.ascii	"\205sI\201\3269"
+	.string	"$t\235\315!\023Z\347P\260E\323m\203Ze{\242\350\032W\347\317\361\0043\251*\231H\246\313l\226p\233L!\t~\226G\024n\322\004\227\t\344\f\321:\207\206*Z\237^;\244<\272\340\266\316\024)Xh\225>$\224G7\371\223\364\221`\231\f\372\2618\006\375\220\313d\220\257U2K\b\017\344\241\rJ\272\035,\231AAL\344\006\247\321=\372\030\177\315c\333B\003\271KfP\332\342\350\323s6\207\230@\251\263u\207\226\311\240\325\351\263d\"[\347\352L*\225\311 \365@\036:@N\020\324\272\316\026N\341PE\322E\036\213\255\0173\310\347D&]g\322=\272N#\f\316\243;\004B\272\311\025&\234\314\022#\264\356\261\251\001\006$S\211l\266*\230\306!!d\260\rJ\236h\221\307\246\210\237e2\250\371a\311B\263]\301\024\222\240\331&S$\335e\353C\302\247yd\242\030\306"
+	.ascii	"\244B\353\004R\221:\255{l\241\215!\031\224t\205Xh\266\312!\237"
+	.ascii	"\026\b\351\324\3406\233\307\236\323\270L\246hC\370(\333$\n\033"
+	.ascii	"\332\240\343R\267A\307\025|\224m\262\003g\223\351\\\266N\nX\034"
+	.ascii	"\227\311 \235\025\022\270\313\326\3316\205\\\346\322=\242P\261"
+	.ascii	"\001\251B\031l\215:\2551C\213l\0161M4[\267U\301]\266\315\346"
+	.ascii	"\020R\247\205\233D\036\205\216(\206\356\321\004\027Z\347P\320"
+	.ascii	"\3516[\345\007\020\255s(C\373s\\2\223\256P\320\220s\311Drp&\235"
+	.ascii	"m\263u\235-\200\334#\n\025\302\366\347\350*\231*\224\312\026"
+	.ascii	"\251T\016\245p\217(T\354\270\313!&\b\245\262\005\321\242\331"
+	.ascii	"\272\356\321\204\026\331d\246\320\240\"\350\303L6\333\022)\204"
+	.ascii	"Rp\217(\222\301\237er\331<V@\002\345\021\231t\223M\020M&\n\313"
+	.ascii	"\241\020\356\021\205\212\t\234\306\022>I!`\f@\306\025\307\026"
+	.ascii	"\302\030\200\214\304\030\200\200\220.s\351\036\310\203OR\210"
+	.ascii	"\007\005\3544\246\360I\n\251%0\t\034\002\373$\205z\3562\311,"
+	.ascii	"!4\344\263LV`\202\337\212"
+	.string	"\343\005\206L\370$\205\204\313\244\n\356\007\237\244\020\261U\321*\207.\262M\221b\247\365a\006\031\335f+\304\2425\272\312\244k\\2cH6\231@<\255\017S\205\026nR\305\261)\"\351.\217\303\023\022,\223G\021M\246{l\266\031ZXqlQT\266H\344\207\326=6\205>?D\037%\023\310\3316\201\\#O\033\224t}-\216\312\326\347\227a\307\271l\205\202\230 |\222%\334#\n\025;Kf\322=\341\323<\256h2Q\360i\333\024\032V\034[\030\207\276\030\200\214\0378\235G\241\025Le\261E\263U\301D\266M\243P\250\301e\n[\241\026.1\371\373Y\036y\234I\026G\343\004\313\344\361\247\350\f2\372\034[\240#\fL\246\322\330l\227\311c\32352\233\310\343\206e\362\370C,6\231\315f;A\212\024Lw\biD\032\235(\216:\255P\013\327\370A\263u\225\311\024:1"
+	.ascii	"\031\227\311\030\200\202\232\255\353cL!\2444.[\370dh}\230*\224"
+	.ascii	"8\301\301M\006%Sh\225?\313\017\023,\223G\021E\267u\266-4\333"
+	.ascii	"\237\237d\363\304\n\246R\371A\311l\272K&\b \344r\350\250\254"
+	.ascii	"\300\330:\207tX\034\225m\323\270\342\330\302\350\323\272\307"
+	.ascii	"\346O\353.\223\031bH6\217\3552\231\202\353\034j\002\271;\351"
+	.ascii	"2y\374\361\265\310\345Q\205\317\321'\350\016\t\271CL\035\325"
+	.ascii	"]\0161\221F\245\262E\032\215Lw\3508\201\322u\231M \327\350.\333"
+	.ascii	"\244syl\272<\256\223\311DaL\221b7\217@H\335\006\035Wh\225\311"
+	.ascii	"\024\314\246\320/H\250i"
+	.string	"\\&\203\200Fw\331\006\271\316\241\016\370\0345\250>I!a\353<\266M\3442\331*}\222E!%S\250\331\272\313\244{l\032Y\034\203\214)R\024\335dPRilaH\n9\215)R\b\017\344\241\003\027\350'\251L\001\200`\353\303T\241\331\262H\006\261>\255\263\331\252h\233F\347\212c\213\035w\331\"\233\255\220\321(\224T\246"
+	.ascii	"r\036\233\310\t\234\306\243{\f\261d&\335!%\323\204S\350\247\350"
+	.ascii	"\036\310\203S\350\247\003f2C\020\bWyL\235\306%3\351\036\221\314"
+	.ascii	"\024\234B?A\367\250\354-\231\312\036\220R\331\363\001\301\247"
+	.ascii	"m\205\234\253O\333\n\231\370\265\316\346\020\023\204\317r\210"
+	.ascii	"\331\374\001\n1}\200\264\352&\235\316\246v\032\227\311\243\n"
+	.ascii	";mP\322\325%H\204@\301\030\202D\tg\222\305\221\365Y\036\203\202"
+	.ascii	"\230 \220M\326]&\231Bn\353\334 B|`6[\374\254 B|@\"\217\352\317"
+	.ascii	"\020"
+	.string	"\212\326'm2]fP\312T\321l\235\251{D\241\302\347:[\367\230B\373sl\266BAG\241\253\374\300l\036MXW\020!>\374\034\203T\023\202\007r\032\177\222)\226L\020D\3278B\0173\351\036\233F\241\265E&U\264>*\022y4\3724\231\310\266\351k}\230A\032\006\3471\310\350\323*Q\034\235I\037\2433C\333\034r\205\216H#\263\331\342\007\370\263L\3720\221\313\326\330\252H\272BG\237c\261\331\372\034[\240\037\213\326gI\302G\331&S\f\3556(y\302m\036]';\204\225L\246\t\306\364\0028S\250mv\3402\231\315\016~Nc\353\036]\023N!\021:m\020\023\310h\242\204\210\355\323d2\221F\023%D\260\256\221\004w\231\034Z\335\243\211\240\241\245\321D\t\021>\327\370\001\b\3562\271\276\247\007\204\005\024XA\304Fz`\301D\001\003\362\250D\321\3012y\f\352"
+	.ascii	"\331tv\340\241\202\377\031\272\270t\217\367\005Q\020\037\303"
+	.ascii	"\245'jm@t\250\206<\244\360\236\364x\217\f[\330\311\351\035\300"
+	.ascii	"\234\327\f8\273W\212\306V\206\037T\250\336\256\037\031\264J\210"
+	.ascii	"qa\027|\363\271\310\303\233\312\340#\023A%1\223\225\365\235D"
+	.ascii	"\373\317\220\245\363\"}C\243\254,\003\017\035\"\241\\Y\336\217"
+	.ascii	"\fXE1ohA\310\262\336\261\243L\306\027+\261W\211\352H\207N\331"
+	.ascii	"\020\253k\214\255\312\016\207\315]UQ%\005\323\204\271\0012%4"
+	.ascii	"\302\256\311\021\346\225cx\007\034C\366F\006\216\340\335]\034"
+	.ascii	"\037XY\333\260\221A\352\2674&\203\224\366\322\246\024\305.\353"
+	.ascii	"7\251\354\f52\324\230\242\266d\377\031h\350|e\230!\214\232\243"
+	.ascii	"\206\311\224\254\237\236\356\270v\206\246\fM\301\2723\315\244"
+	.ascii	"\fK\031\226\202u\354\353\264\306\214\007\324\354"
+	.string	"?\203\322\217N\245BGu#\203\214\337\231.eSl\222t\226bT\235\301\213\001\024\022\214\303\306\356\016\txD[Y\351\020\003\003\330\225\317`Q\211\363b\250\224\244\266d#k\234\266\004\017\355\b\2506,\243\004&J\006\243!\322\024\224\253&\031\212\206GH\316\276\232d \032\276k>\260\2562\274\3028zF\223\033JyB\2735\rI\225\2729@+t8\210\260\221#dS\225F.\016\360\255\207\243\f\026\"x\300$6\332\320\262\016\216\301p\340\204\231\223\265\036\363\002\224$D\224\354\204\321\325\210TX\2267B2\275\031ZC\232\270\021\206\301J\320\242\2436B9!X\024'P6B-g~<}YS4\312cbL^5B+f\346\220\204I3\306\331\346\026%\nD{\n\362\345\013\232%<%g\352\316\354\300\345\257.\"9\352\212OA18$df\202\\\204a\242q\326\312"
+	.ascii	"\267\354(\027\320\033d\210y\372F\025+;\306\b\233\254\271Aw\350"
+	.ascii	"l\324\331p\312\261\323\345]v\302\\\247\350}\215\336\267\nH\t"
+	.ascii	"R44\370w\274|'\314\016\230\037q<\216\200\331\371\202\305\203"
+	.ascii	"\310\255\r3\205\221u\231\333g>2./!\036\210\333;[v\266\354p!!"
+	.ascii	"\013\333N\334w\270\024e\f\321\250!c+\312\260Ck\242\226\365=\300"
+	.ascii	"d\027a`0&a\242o@\254#P\036/\262\036\363\302\373\212\301\330\202"
+	.ascii	"W#km\244e\306\224\033\221n\030\265ks\206\205\370E\333\305!\343"
+	.ascii	"q\205(\027\345\356\tN\033\021\216*\245\251\254\211\025!\022\341"
+	.ascii	"\230\030Yi\252\210\001n\215I\261\241R\254\242Te\354\310\024)"
+	.ascii	"\006\200\241$EJ\321\rM\n\216\255\b\267\317T\t\371\022%\b\346"
+	.ascii	"\367\244\306\213&k\30197.\226\320\230\021q\002\026\006JQ\307"
+	.ascii	"\332\304.\nTZ\227\355\346\n\206\331\223`\234\220\n\311\006\027"
+	.ascii	"\032\360L\366\242d\n\033':7\3269*\272\033M\316\344\310\226\017"
+	.ascii	",YG\201=\231De\375\203\306\016\016\022^8\261MK\266\242gTU\317"
+	.ascii	")\035@rh]\345`\332\201\232\013\022\355\261\363\243\007u\332i"
+	.ascii	"sKYM=Av\204\220\360\302\211\235a\224\364c\306\353Hx\341\304\276"
+	.ascii	"\230\343\022\303\302QE\025\335)\262\243cg\307\334\324N\221\235"
+	.ascii	"!^;<n\354\034\331)\333I\262s\266\003\335Q\262\263d\007\311\016"
+	.ascii	"\330\216\331N\330\216\221\235\261\035\262\035\";b\030\272SD\207"
+	.ascii	"\306s\325\316\327y\304v\212`7;@8\304x\337+-U\252\212\353i\367"
+	.ascii	"\276fB%@\226\314\006\240\357\001\252\255\356\b\331y\242A\315"
+	.ascii	"\220\321_b\330v\274v\272\310\346<\240\264\357\001\027{k\207k"
+	.ascii	"\370f\211M\0308[;Z@\"PM]Y_\310\314\216\017\241/\373Bo\373BQ\366"
+	.ascii	"\205\240\373B`\373\337\331\261c\365\364RR\227\265\334\0208'\311"
+	.ascii	"\334\216\254/\344\265/t\265/Tc_\bi\237\211'\265s\303\206vQ\245"
+	.ascii	"\212\226\027\251\035\033^\306\336&Q\337\2611\f\022\245\013\217"
+	.ascii	"\254wj\3447/\n\\\033\023\313>\023m\347\311FVQ]\326g~\355c\350"
+	.ascii	"\216\323N\223ONW\234\335N\223\027\2501o\326gf\355\177gi(\247"
+	.ascii	"\272\201qq\332Q*\256y\341Q\324%cX\225aLii\313z\007i'\306\237"
+	.ascii	"\346\036H\231Y\245W\242R<\262>~\032u\004\370i\324\177\007FQ\254"
+	.ascii	"K\223\221\221\254\337;2\263:S3\n\303\261\343\"\350\244#\256\006"
+	.ascii	"U\326;E\275\021\344\345\345\345\305y\337\242\235\242\274s\264"
+	.ascii	"c\364\235\242\017W:0\244\"U\377;DeR% >\230v\336\341\2223U^v\344"
+	.ascii	"\231\365\324\302\264\021\233St\223>\351\342\342N\216pI\013\213"
+	.ascii	"\2168C'\233L\025\022\022\336\320\006p\306Y\233)p\362k\303\005"
+	.ascii	"\036\224\273b\220\215\204I\r8v\304'\2757X\250\274xS\034\202\217"
+	.ascii	"h\331\345\271!N\321gf\356\344\264\3117\232Tnv:k\204qb\302\320"
+	.ascii	"e}\346\216\235&\215\260\252g\214)C\007\215\016\232`\035\333\253"
+	.ascii	"\203[\332\355_\347L\261\207O\b\016\031LuA\"/%?\314\020\327\204"
+	.ascii	"vZ\300\304(\223\307\001!]\210\220!B{olE\216\214\021B\351'7\264"
+	.ascii	"\260\350\204U\251\032\034_X\304<9#'C'L\260\316\0045JYY\357#B"
+	.ascii	"|\340em\226\323p\300\371\230\023j\005\223\300\331z\341\205\330"
+	.ascii	"6\244\263\312R\352\"\274R\343\226d\341\222#\032u\231Qq\221\265"
+	.ascii	"N\026\235,:"
+	.ascii	"q#\210\226\360t\266\\'\016\356\247\005%H\021\034\230*\261\027"
+	.ascii	"\330d\004.\210"
+	.string	"\316\233\216\226'PRIY\177\331e\177Ie\377:n6\310\270Xy\202\345J\230\036dqW\200g^xPi\003J\031\206e\361\260\002\355\301$\255F\025 \231f\302D\210\023\025*\300W\256\207\227)\\@,\2471YR\342\214OB\300\260i9\3016d\260`D\321\372\211i\002\367dm\210n\363e\313\f5\240\233\013'8\027Pz2\240Hn\322\322\202p?8\202\304yB\244\361~%\311\332\211\023!\324\006#\330\310\325\232W\326_2a\302$Nm\"\002\345K\326_v-Y\"\204\332\020G\253\275\261\021\311\372K'(T'i\265\253\361\025\005\233\353\221$c\016\031\231N\031V\3626\251USC\242\300r\232\0223M\312\212\220\031\023\222\365\203\270\350\204\351\204\351\210Ek\340\031\001\373\001\231\201w\225\344:b\001\225\001\250\364\005\317\025\0064\302$G\002!G2\345\030\232*\332\004"
+	.string	"C\025"
+	.string	"0PD\036\217\210de\266\031\024"
+	.string	"\013Z\302\200|X\250,RT\"\206\314\b\200"
+	.string	""
+	.string	""
+	.string	"\020\200"
+	.string	"\004\001=#\370\207\245\244\r\221\201\352q@\371\241\r\333\246:\325\3049^e\374\346\344\345\202\217\313a\005\360\220\004\364\033n\217\232{p\376\333\340Vx\247\021v\210\367\"\240W\036\017N%\362\214\256\372\377Y\355\302\263\332\302'Z \327#\001\035q\003uVk\n\344\237\373\017\213g\337\302\fWA2$K\023\373\\4\232\241\236t\270]}\032\307\310\265\357\307EJ.;\033r\217\f\273K\r\354\341\347\254\034 \233\206W\203\250\223\271\363\006\3114\232\n\322\372\271\363\276\3645z\364\354\005\256\336=\230J\006w\217fGJ'\311\253\256\t\0208\200x.\267L,\301\210\201%\376\304\245\225\337\246)a\3631\335z\201u\0071\360y\233\237\202\207MN\237\317\333\177\b\351\024D8\261\323p9\016\314g\324\370\362\226y\242\036\265\233\331a^\306r\311\177\336\363\251M\f\335"
+	.string	"\006\022\351$\b\273\213\367\323o\26034c\231\267\034u \343\245H\374\244\ry\251\350\027\2714\267,?\024\301\313\376~}Lh\231\274\250\0263\n\354\212\370\t\360s\270o\276"
+	.string	"[\337\331{\207\227\003\030\321f\262\356y=J\240\037\200\343\230#\004\375\365qr}Q\020\267\007)\314\217\316B\244=\031\334\325|<0\200r\317\370\020\254\007\357\302\257\262\006{\225q&\252\374\3170\276\243\200#\311"
+	.string	"\351\350i<\361\367\016r+\315c\021\227\021N\275\231\024\216\271\321\214\210\027\016\361\023T\223r\bEx4\350\356\226#\024$\337\300_*N\025\324A"
+	.string	"\316\r\266O\002\366OV\346\312g\242A\340\367\022\375\274\343\276R\327%\007.!3g\226\257\007X\034Q\001\235St\263\274\220;\b\310\222Qy\314\340+T\341z\363\275\235\023\304\366\211os)Q\273\207\261\205\323Y\352\214B\001\030\216T\230\263\025\304.G!q\314\367\323I,\212\230\033\361\262\177E\260^\217\226\020,5\343P\225Dh\257\360\341\007\364\"*|\327\364PI\316\335\204|\313\300\372vM[\356\356\216c$\260\310\234\023*\370\037\305\363\243\367\237j\323\320\356L\030n\330\322?\2176Gj@@\346\3654>\346R\243~\300}\370\363\200p\235W\314\004R@n\242J\031\377%\250\340k\302\354\376\322\024@^v\336\\\236AMP\225\326\001\220\n\345\204\220|Q\034O\367\200\2771"
+	.string	"\033\036\257\3540\025\300\002<>{\031\304\330\377\336U\201\363\365\274\315e\376\020\024{\213\245\"\003\264W.(\230\330i<Kq\236\301\3701\343=\251\211\216C\372}*,\t\016<n\b\341\331?j\336\372\222G\343\377+\3546)\352Jc\2605\032>\326\326\211\271\241\006g\2248}\366\222\"\002A+6V\301,\n4\223$*\241\001e$\253\266>-$\306W\031W\372\346\002\341*=d~H \005 \bw\344PI}\212\330"
+	.string	"5;\016\237\266*\300\311.$\025A,\274\245?E\322d\033\330\304\314\205\345\274Z\221\222\345i!&m\377\331\354g\245\363\360\312\247t\234\226\236\230n\227\275\214\250\201\200\233\214N\273\375\250w\336%;f\223:\351\005\204b<\352\275\330\023\330\324\317;\353\203?\375\357%<Kzt#\200\226\210\271Fw\201\334\300`Xj\222D\363>\230\324?~s\371\346\013\341DZ-A\f\302\371bc\201\214\327\321H\271\220\2718\257N\315rS\271\211\250\031\254p\346,\340\303 j\020 C\3134c$E<h\301\210(8\001\220\022\245z\021\237\322\231\341\316t\231\223\017\357\273m\313\344F5\353\340-\034\334h"
+	.string	"F\364h\033\t\273\\\025]\341\2329\007iZ\346\336\307G\211\306\313]\326\232iz4a\206/F\216\322\020\264bd)+\210\307\177\006\330\242:9=\212\3579.\245\321G)\030U\243V&\001\244\245(\222,\377M\236S\027\035\255\356\317\254s\310\266n\0174$e!\257,Tr3].\243:\356Y\350\300\363Q\314\217\226N\342\026B\340(\263\201a\211\2057\021\371o\366E\275\021\211cz\250m\306\365<52\273t\307\256\210\326\327\r\225\327\r\307d\004\354\357n\373\307C\257\302H'\316\250\240\333\262\335%QEm\370\207\021\217\301\376\370\310O\254q-\246K\007"
+	.string	"WR\272\322\365*|\216\363\266\003\336\215H\036\341\023\314\365lO\201_~g\306\337\366\250\027\335\341\331D\2114@h\220;^n\022\024e\244\361\376\346\206\225 9\220$\025\207\211G$\f\016\023\310w\276l\"\302\207=\263\241\001o\035,%-\357\371\325w\035[\353\203Z..\241}\363\233\301\275c\220\b\200\353\206"
+	.ascii	"\250\251\035\356\024\337M\321a\356\200\362V\2763q\251\200\310"
+	.ascii	"\240\201\025\217\245)\304c3\031\016\260\213\340\247\301\360\360"
+	.ascii	"\374?N\f\354\256`\331\204\255\242\b\225\207\233#\253N\021v\335"
+	.ascii	"\001\005w\356\001\304\316Jr\334or\250y\372\231\0178KG6\366\r"
+	.ascii	"\355e\336qq\030\2460\323\344~\030$\343\260\373-\255\202/\274"
+	.ascii	"\254 \277\334V\206\250\235\342E\020\337pL\024q\206:\2428\207"
+	.ascii	";\270\305[\227\332}\274c\227\312iGj\331\023\227/H\034\273,\325"
+	.ascii	"~\305\222\277\252|\242\306\277D\331\210\324(VP\312\256\316e\201"
+	.ascii	"2\277U9\256q\027\223\225|WX\022\217\232\b \240\230~^\365EP\265"
+	.ascii	"G\324\003\3641\231\210\001\254J04\032WQY\243]\215\271\265\337"
+	.ascii	")\332C;\246\276/\377\273\255\347IJ\252>?Pm\354\316\034c\031T"
+	.ascii	"{\316\276z\377\022oXT[\367r\351\234*7\352'\245\264\b|[3'h\217"
+	.ascii	"f\226\340\273\320\256\273\200+!\243S\216\227\321AO\251\240\372"
+	.ascii	")\030H=\301%; \330\006\022\002\230y\031m\r\346\b\027\222at\301"
+	.ascii	"\214\236\314\254\346\001\f#\331F\247G\357\335\347\006\231@\340"
+	.ascii	"2\310\247\241\247\255\023\237\201%>5\335hD\357\363i\311\022\374"
+	.ascii	"^\315\244\310\2631\343\016\031\231\033\245QS\025U\270\251\355"
+	.ascii	"\024{V\267\032\342\340\206`,0X\365\271\016E\006{\214g\220\311"
+	.ascii	";\3002c[\360&_av\364<g\204{|\340`\353\222"
+	.ascii	"\310\251e\316\247\242\234\315\265\354h`=bD\r\245\371\340\260"
+	.ascii	"\375\251E\214\031\006\002[=\2363\314\001f\211u\273\rM+\373\250"
+	.ascii	"\211\222\016\233\252\365\272`\220P\213-&\236\310i\003\027\233"
+	.ascii	"\020\314\211 lB\350\215\360\273\230\351\023k\236\353\316\203"
+	.ascii	"\315\300\017\306#\034\003\360\207a\374K\303tQ\265\256\350\264"
+	.ascii	"\314\200 9\377\221\211\311Nm& \206\032\235\220\244\372\326\207"
+	.ascii	"3\007;\034:M\257\245\013\311\210\317\244LF\255'\032\3427\366"
+	.ascii	"\247P\n[B\315\371\351\311z*\020\277\"\236n\205\336\307\323s>"
+	.ascii	"\224\312\374\231q*\265\005\033\230\n1&a2!\t\2151\277\360\314"
+	.ascii	"U\333\323\266\321\277YL\200\320\322\2375\333\225=2t\333\307\237"
+	.ascii	"id\275"
+	.string	"\276[\327\255\250$\317c\372@\374g\327[H\313 \036\003^\3514ui\230\021\312:\351\234\031\202\377p\275,\260\240\n\323\224\b\313\231`D\371Q\202Pk/\251\246\013\360h\242\r\026\030\035\317\020\243\315\002\266(\347\370\335R\376Ol\205|\321\237\006\276\312\b\026]4\342\305\027df\241\321K\215\242\306\276X\301\321\231\013\311\334\0068\215\231V\223l\325\210}\217^\220\333\313C\310_?\317\332\325\314\0174\342\177I\323\367i\370.\024\n\tx\245~\303\030\232q\007\231\334\004\034,\022\0130&av4\261\223\363\305R\312\377\251\225\304\226_\313\366PY\352\344\027\201\256\232\f\304\362\264>\030\316\236\253\t\230'\243$7\271V\351k\254\203\002\217\334,+\204%\211\314\377x}\201\370}\232\371\262\003\033z1\361\033D\263\361\254\376\211&I\224d>\002\030\322\243et\321Ss\343\020\372\316\270/A"
+	.string	"\272\fE\027o[\242U\330 I\031~\330j\206]\334\375\320W}\033\"\304\310\3709\236DL\2310k0X\247CF\022\237T\356%\370\301\364,\220\304sh\021\342^\332\001L\020::\203m\3739<\267\225cvy\217!\306~T\n*\022\226|\206\036\244\300\037\266k\226v\032\307\203\232-S\346 \217\033 \352\353\260\031bt\353\031\264\362\274\2040\240\375Yq\370\360\037]\227\275\370E\216\310\273\322\210\206\037b\352\315\2620,\246U\323\224t\326\016\265\320S\222\270i\333uwT\211\037\304"
+	.ascii	"XS\240Z\254\360\365\216W\233\rf\246k\n4\330:\305\351\256\001"
+	.ascii	"\227l\351)\264\244\234V\361D\320\357\217\276\224\021D\200\334"
+	.ascii	"F\br\324\304\004\b\341\336\022\266Z\016\363\305\fH\\\f2\265\321"
+	.ascii	"\320\213^\312'2\240]\216|$\364\360\024\233x\231\177\254\210\371"
+	.ascii	"\245\363\200w\374t\353\216\310\332Z\n\031u\\uZ\3434\b?\317\252"
+	.ascii	"\321\026s\022\032H\262\373$}\313\217\2564\363a\244r\031\023\362"
+	.ascii	"L\024\035C|\016\301@\307v\205G\332XB\360\343\210r\302\355~Z\305"
+	.ascii	"\013\332\226\335\333\007r\275\0252\033\n\227\n\t}N\2173\247\374"
+	.ascii	"w\017R7\022\267\264\220rw\203x\bZ~AkI\234\371Wq(\307\275\344"
+	.ascii	"\n%[%\017\316vG"
+	.string	"\316\344\371\254G\225\365\024\037\271m$n\324c\022l{)\177W!\337\030\006j\233\211ds\216\"\325^\344W\262bE\367\344\323\203/\374,\177\370\265\323^\245\226\276\217P\367f\325\343,.\322\322\257\300!\216\325\n\023\013\2122\332\256\307\"\023w?;\355\200#\036\304\005\033\265\200\372\026\241\260\nT\323\261\312\314\224:\020\245\335\300\\\240\035\272\320\2774^\272\311\271\013C\300\020\340\322TV\272T\2579\257',\236\265\"i?~`\201D\327\236\356\324\177\243$??\007#\341\274\217\243\200\370\267\272#\315\307\260\364)\\\210,\210Ca\246\275>t\263\263\245LB\232\257\214\314S\325HS^S\376]\250o7\211\341\272\037\302\3307\335\323!\231\337\375\007\2213\275R\026\305\312\177\243\\\373\302\237\025\314q\331\217#\272\\j\361\364^\250\366>\342a\230\234\0332\367\t\017\320E\267\026S\374\322\325"
+	.ascii	"\274Re\004\bn\371E\324A\272`\334uKh/\366\341y/"
+	.string	"\272\236\271\350h\345\357\025\271X\201\037\245\215\333\355\355\327r\207@\213\320f\207\304f\355\234\"k\033\311\227G\207\2070\261\241\304\267-\242|\317OC\276Q\311\024\320\037\334E\303\035L\257}\242(d\235\3131Mb\\7M\231\271\3209\255\035\300\323\230U]kS8\320n\314l5;+\266=2\313mW\374\332\264\020\225x\350\232h\344kz]\206\250\370\245\027\0074\304\023\235\271\226/>A\377\320Y\tP\376/<c\264\273\025\337\222e\307b\316%\301\336\267)\251\350\246\265=\326\344L\2205\321~]\315\256Q\034[\023\0255\257n0\260\374\243j=.-E\t]\200J\032\n\221\332\217\225\361\272\363\203\2029\221o\030\370G:\373S<\203>\027\235\240\2520\370B\035@^\320\036\305E\253\277\2759\rf\013\350m\263<\360\266\323\246\321.\027\235e\255\300\203\201\357z~\335\3438\377\003\234"
+	.string	"q{\305\200Q\004\304>\342F\254\203\267}@\312\240\335\331\334]\272JJ\250\016\256\253\246\n\031c\274\273\247B\301k>T\262|x\273\b\212\342H\272o\251\023\351\316}\003"
+	.string	"\240\330\360\327\311\254[("
+	.ascii	"D\315\2110\2260(\344\244\311\314\272v\331\2265\006\372g\013\270"
+	.ascii	"\237\301\350\364)\372\313\207\346\220u\371\317\005\265\r\027"
+	.ascii	"\2637\310f\006\326<y\0202\236);\374\020\356\337=\033\202\205"
+	.ascii	"\314o\237e\004!f\026\3325\353!\330\022\032!]\2149\360\r\242\347"
+	.ascii	"\f\304\330\310\267\274\223\357\263\216\231\0034\216d\371\034"
+	.ascii	"\021\374kT\031]\007\233\234\0267\225R\220\177\351:\016\016g\302"
+	.string	"\025\340\271\270\270\230\\\215\244\374\305\200\340;\006m>Y\177\262A\315u\371\007\250\312]u:\314C\251\0135\325\276\321\256\036\344B H\r\362\201`lr\240\375\267VUL\261\205\317\202M\314\220X*3\035\"\316i\232;P\306Q\314\354\271\256\035\372\345\212)\3556\372\b\"\342c?\344od\210\366r\346\311t\177V\001\342\265\313<\234qZ\271\3562Y\355\254\217\035L\227#K\275Dk\035o\213e\251\222\256\360!oD\366;\367Q\233^\271\002\315\233\n0\330\225c\207\265\024\361W\261\263+m\351b\344\330\202\301\232W\350\002\340.\304\f\354\345n\346\356\300@\224tO\332\2373\035\336\2451\256\345\376\304,3cN\027\247\351\310\210\377\201V\344\n\267j\031,!29\302\341\316D\020\353K\305@B\263\367\n\314\204\003\007\201u\2419\272<C\306_\200\307\256\344\343\301\371Rm)AO\024"
+	.ascii	"\314\344\303\335\270\377\351\030|!\r\217\2555\002\030\351\354"
+	.ascii	"l \021\235{\350\021\\(\331&\234\270\237\227\270\314\016\310\230"
+	.ascii	"\374U\317\271b\277\345\030\333\033\216\376\005\032V\236zvb\003"
+	.ascii	"\021\270\261\370?\333yQ=\025\273\306^\027\274\323d!\215\240X"
+	.ascii	",Z@\347\357x\337\035\034\340Y\031\233\327\222\025\031\0213\304"
+	.ascii	"\374\300\240f\333\n5\316\307\274\350}{\371\310^T\034\305\241"
+	.ascii	"\216\272\016\334ezYn\213\001\315\264\214|\013\326\357\026\322"
+	.ascii	"`tD\333T\001\265e<2\027&\221\316\244\320\003\200\206\204\362"
+	.ascii	"\211\322\247SE\251\231'\231D\301\267'\203\020s\024\323-\027\231"
+	.ascii	"\205e2\264\020\314\355Q\bX?"
+	.ascii	"\247$\350\342\245{\231\200\327\251P\351\006\021\220\331W\217"
+	.ascii	"\261}J$\251[R\231\020_V\\\020\247V\363{\264\226\242\317\203\243"
+	.ascii	"\235\276}Bdu\242\220\240\005;\r*\202\336\351\231\02236\\\305"
+	.ascii	"&\327<\275\2548"
+	.string	"RT\371\245\310\337\2306\244j\224\376\260\023\252\241\214fX\202V\t\254\360cj\276\370\260B\272PB\"\b\253\334\262]\330\036\315\3567\263_\263\322\367A4zU2\240E\356\001\207\032\013\"\204\004\371\243x\273[\024\304\225R\364\0168\310~k\321 \376\024g_\276q\224D\336.\311qI\340\271G\265\256xsqs\263\235\225b\034\300w\265\244\033ji\223\243lJ\220\241\2703UW\251g_\334<\016:\017Rz\206\276\025\363\r\210\202m\022\002\343\330\3431m\"\201\315d\316\251]\201\312-\312\276>a\311Y\344\335\270-\nU\200\bGc\351*\267h\323S\274\342\022\224\026\347\213\235\032\257\337\252r\253<\343@\340hF\352\261@y\320@\367hhV\370\027`@3\231\313\304\230^>\340>\212/\211\030\377/\350H\206Lx\241\277\221\023\316\316\226T\270^\224\026\b\201\021\344\024y\026\262"
+	.string	"\310\213R7R\221\334\317\336V\220\266\t\305\032\0229\344\007\331\035\005\251d\310WE\247\340\334B\260m\326,\274X@j|\001\267\250\273\271\3119&\264\200\007-\366Z\031\034\021,2\005Ap\345\271Q\330\265~x\321mm\327\266C\007Dt \363\241\240\313a\326k\345\351B\rI\327\316\263\024\302K\340\323\"*\211\210p\352C\032W\336\216\276\217J\264\247\352\034\363\301\3052\"\272w\320A\260b\264\375\220DI|\324q\262\214\225\251\201\337\271\321\\}|<\036Q\244z'}X\357\242V\3337\240\216\247\226u\220\205I)\347h[_\341\\\316\222\025\035N\037\310\203`\313WHW?N\204\021=P\f3\304U0\313\357\3151'`4\225q\202\007y\252\307\0266\302\344\325`k_\257"
+	.string	"sLur%]\257\307\206\226\255\2127\3342PI\206_\331D\204\215\334\227\222)\227\3376\357\370[\377(\277\255\017\251\033\210>q\007\342\224\302\354JUD\312\223\"/\301>\365\016\213+\202\\\031\024\266\356\330\235\315\002\204oQ\352&\b\221\343\314vt\347\\0\310~\022Fp\340\0311\370)\314\352\376K\351\024\220}m\231\305\367\254\371\222^\313I \267(\301R\300I\344\322\2519~\367\377\013\347z\247\330\250a!\350[\264\221\207\034\267@\003v\376\302\236\354\016\036G@n\234\312\233\346A\313PG\"\025\325\315>\224e\363\322!\316\272a\034\305\207\305\250\335\274CZ\334s3,0\263\217\341\"\212D\200\217v\0051D \337\t<v\177\353\3439\304\255tf8O\204\305\341\273\377\034\223\3556\355_G\022\022\343\377\351R\227\360W\313E\030\253\316\347\r"
+	.string	"\363\257\363e\306\215\363\245\373\025\261$\317X\3200aP\261!\342l95\2123\3555\334\024l\246\265[\\\0227\275#"
+	.string	"\007\034\t\225\331\"\237\204\320I3\334\357\016\253=\030\217\307$\333\023A\364\373\327Y\013[\371^`$.L\352\304\024\215f1R2j^I\227\213I)%\332\005?\221\236\315\353;$\242\263\314\030$\273$Y\350\016\276\306\023Fo\265U\351\r/!{\312\246\2202\253A\3032\347\243Hl\351\374\347\323>6P\231\365\036\nh\n\352\022.s\023tzx\253.K6\272\306fh\343\355\246\003\326,r\214B"
+	.string	"\005\332yP\373\236\021\323\204<Cy<t\034\376mq8\322\231\b;\376\007oD\256\224]q\212#~=\205\3244\320\032\256\3244W\0067\021>K\321Z;&u\355.\021\304\332g\364\212\215B3\361]v\271Yg\224\002(w"
+	.ascii	"\352|\236E>\r\315V\036\344\344\254\350M\3414QrV\264\222\026\023"
+	.ascii	"\005T\267\3112{\020\300M\004\261\244\262\tp\361\322Z\004\365"
+	.ascii	"\n\226\345\235\341\345P\303/S|va\202\035\310N\016\232+\020\360"
+	.ascii	"\023\324\314\250\370!\273\260\332\017"
+	.string	"\334x6\n\027(}\355\2374k\364m\362;wf8\355\332C\215\3079\022\353\240\270M@\234}\263\246t1W[\032e%\251\234\372\362\304w\356\t\371n1\030\327\006\331\212\247E\321\262\215\347\352\343\325a_\300-\230\334\017\023\317\177h\002b\326\267\362\331:p$)\331q\222\246\264P\033\240\361\376Q9\205\324\203\031\325\247\370l+V\320\223\023\367\277\376\220}\265\342\267~V\361]!\021EH\304\036\354\207\306C4\333?\004;s\213{N\237E!\301$X(p\260\021Z\206g\265A\244(\324pAXe&g\342\267\313*R\374\264\003!2XX\004\364\354\327\3545\322Q\271\207`\345K\342f\3055\223\376\021\372`'\202\224\307\247\334nZ\220<B\220\"T\027\2227\016\364\241\340\2668&,\251\346\221^Rj\205r\245\374\003\243\251z\003\213HE\304!\332r\320(\201\030\303@T)"
+	.string	"*l\200D\366q\002\030\254\314\231\352\005u\rK\342A\233\2601\237\244\n&}\250\254t\357az\232\2644n\306\031\203\036\340r.\234@\bv\301#\342\344\371g}c&5\035\027\341M\335\222\027\324\001\016\363\356~\355\235S\f\036\002\034\224\240\264$\013\037\255\235.w#\254\013ftdA\013\3769\034\0317\217K\372\247D\203`\037\rU1Ka/\257.\024\024\301\207\201e\2760\220\242\001\030\221\302\013\200D\245\277s\t\227eU\003\177\002\251m\344u \265! \304\236\007Fl\b^\234\257\202\352\t\006\361^\205a8\211\374\fUaF\231\026\033\360\033,\241\360\3437\332\251\244\331\031h\342\243p\341y\232\344\361=v_\276V\226\273"
+	.string	"x#nd(\236#\230>_\273\366\035\211:\212\341\312W8\033\323>\177\372/\273g:ul \353\340\036&\003\n\351Z\360="
+	.ascii	"\032\265\007\224{\303\3373\2037\2202\374\036\265m\240\225\313"
+	.ascii	"\227\336Q\277\226\206n\321\232G7\322\250\351\312\321\272\032"
+	.ascii	"\"4Y\200Q\272g\371\220'\241\302\313\242\230\201\031,\310\321"
+	.ascii	"\353\275>\276\333%\245x\340\351\213\207\372\276B\004\025\356"
+	.ascii	"\210\235\356\367X3\017\251r\336J\256Bth\032\355\025Q\215)\242"
+	.ascii	"\272td\306o\3723,\rwH\rX\r3\006'\033\315\266\314\n\214\2541\204"
+	.ascii	"\006\023\b\334\233\231\301 \032\237oH(\256\337Z\n\276\316L\n"
+	.ascii	"\032\213\347\032Q\t\344\370?q<7j\005~\271\365\325M(6\354\317"
+	.ascii	"o\275\210\273\"\206\311\243l5\255!\017\2511\254\r\271;\333\210"
+	.ascii	";\336\033\fT5\320\204P]\234\245 \301\314\321\256\241\346\b\211"
+	.ascii	"|\244\302\037K]\357\f\347%\252\354\272\364\250\360\002\003\237"
+	.ascii	"\2505\027T\337\206\350b\330\b^u+\260\315+\355\216\006\362_\026"
+	.ascii	"C\032\207W\363o\356x\332\013Y$\223|S\232Mw\222\245+&\2750\330"
+	.ascii	"\211_%\037\265\376\004\311\252\324!\246\376!\2606\300\204\212"
+	.ascii	"\271Vv\361;\023\013f\206\016n\024Yn\360Pb\2675qO\251E\311l\365"
+	.ascii	"\302\252\302\362M\026\270U8q'2\306z'\026\314\213g@x\212\257&"
+	.ascii	"\231\033\031w\315:\351\222\326\260\200\347G\210\022<\317wH5{"
+	.ascii	"\214 \216\n\352\267\217\243\306L"
+	.string	"\245\343\324\307P3\307=~l\237\334\273u\321_.\003g\2776\006C\347\275\021\004\r4\203j\3351\337\213\211\255/H%\br\032\341\236j\252\263\215\225}^=\312n\312o\264\363]\032N9\217\230\306F\270H\365\244m\317\016\340\350\307CI~$\311|\216\324\276\204\371\002\351\335\315\212\226zE\264\332\237\253;\032\350C\343\341\037\206\b\247A\002\025\001 \301\023\033\004{0h\220\367\356:\035\272n\210m+\241\377\023~\235\007;%\300m\037\313F\224\301\240C\b$L\302\020\216\300\021Z\242`\357Uw]\210\377>rA<H"
+	.string	"\332+\213#lNPu\316\331\255\tg\371I\225H\017\235\215\244\213\230\377\f\367\017\340\017\r\356\bc\0175\250~\006\336\375\301\315\222\267\236\252\266.>\t\f\261\006\240\315\376\327\330X]E\364KA\260\261\325\314 \351\307H\370S\371\220\274\361L8\275\b\272\017\255!\264\305E\020Ui5\356aA9\377\001\243\033&\017a~\245o\3040\333X\232\241\247Ob^\347\341\0324\027\224T\311\354"
+	.ascii	"\250\2663\222\256\246b\006\203\320\017\270\222[\207m\233b\377"
+	.ascii	"^\363\277\310\215\035\b\223$+g\322\324\266\020\025\242\263\035"
+	.ascii	"G\246\256\243\372\004\021;\001%\177\024,/\312\254\0168\364Dr"
+	.ascii	"\321g\3048\347\203-\017\025\221-\206\2567\2052?c\265\341\037"
+	.ascii	"2\025\"\305N5\016\305@\025\031`F\334\372K\252\323\256\240L6\343"
+	.ascii	"@\\\310\313\013\303\230\027x\341\374\027\tPs3s_\2017\200\274"
+	.ascii	"O\301\267\021\245\331\375g\203\302\003\310\243'T\030\226\230"
+	.ascii	" Z\335\3279\261\213{\201\342\345\243@\355o\366i\003\002\315S"
+	.ascii	"\324\207\031\257\223N]\207\2739\\k`\021\342\314\273\266\331R"
+	.ascii	"\213\353\373\376_\313\365\356\242\333\267UXU4#\024\303\362"
+	.string	"\240@\311Z\264\206\316\215z\330\333\t'\266\330\322\263\210\340\311\302\276Dl\345K8U\272i8\202\274\b\235\265`\341>\003\230\375\034/\242h[\257\377\361<\265\345\227l\316\364hE\301\223\375\002%\262\342>D\205\33243\212\304\333\331\254\326\227s\360Rt\274`\035\236\315pS\001\344\3251i\312\373T\203(|\310\202\231b\340\206\306\227\003\341FQ\352b\023\351\300\r\255\245\027\036-43\321\377\373k\"O\243\f5\272\005q\200\246\036M\370\223\026V9x\362G\337\313\030\266\303\201\336\324\370\273\335\r_#\240b\305\227?&\350W\326\316z\374\2249\334\023\207\201\305X}I\200M\233\257\347\255\320d_BBO\216C\356\002s\307-s:\222\317\352\034\317t\220\0250\224v\"-\264\325\354\020In\363\311P\240\037\226\350\274\377Mur|W0$\357p\"~%\364\273\243\241M\345r\352\224"
+	.string	"\026f\006\274\247\025\240\373\376\002\343\021\252\271,=\237\326f*\017\276E\251\021\b|9\355\020\322\375q\353(\324X\\-\"m\376:\320rz\301\331\370W\235\f\235`k\246\205W\n0\206#\300\312\270\271\303\213\022\005\036,\377\205\031\272\213\230\312\260x\203"
+	.string	"\211\343\230\247\020\262\b*B\270\314\221\330%\346\n\3455\223\361\271pG<\243\252\331\201\305\326v\327\266\254\322/|\330:\264.\216):\362)\306\223\005\306\213\006B\217/\230\3218\177]\2515\003\n\177\216IX\371\364\035\0079\374\326)^t\364\376\025\316\347\004\311\024g^x9\230\0369z3\316!=\0071zLP\243\342m\r\201\240;\203\270\361 \263\377\343a\017d\003\211>\244*\262u6\255\033\205\241\036k{\275\317OMm\262m\272\213\321\272\261,\250\022-\3473f\314\270\325\205\274\021\235\301\322\304\260A\022~n\006\346\335\303+\007\\X\317C\270\217\242\214\312\3530`\276u~\231\317\225\262\236\022p\270g!\261\350k\006O\334\246\372\216\216\207)7\210"
+	.string	"\344\\\\\256\272\n\277\302\242\036\233\327\277"
+	.string	"\204A\226\f"
+	.string	"\244\256\364\321t\316?\217i\206\312\246+\377k\356<\311\025\201\232\301\022kn?\326\250\021\311\252\253\317\353j\016p\247\200\253\024!\035_\202"
+	.string	"\210L\314\007<VT\302G\334\212\3251^NEQ\371\351\305"
+	.ascii	"V\005\311PQN\376\232\330R,\225H\3438\tF]\234\330\351\"\250\330"
+	.ascii	"\264r\305\215n!|\036C%\273(<\226\214\217\204u5LcQ\261\2336/~"
+	.ascii	"\004\022\206\3659\225\267a\r\235\373\372\375\305xv\271\305\311"
+	.ascii	"[\013\251E\215\350\255\246s\325O\355\216\002h\346zi\324\272\227"
+	.ascii	"R\302\365\2657\312\365@\235r+\235\n\037\004R\325\272fM\267\316"
+	.ascii	"G\226!\373=8Pg_bt\252\335z\005\276\3075\267\375n\325\316O\241"
+	.ascii	"\036\340\253\240\301q\335\311\344ShG\b\026\264+\334\033\210\016"
+	.ascii	"\276\352\365\036F\325M\037\320\217\242\263Wl!\333n\fwiK\276,"
+	.ascii	"\276}\304\237Z\003%\214\370R\363\256tM\177\252Cg\334\345w\365"
+	.ascii	"|\323\033\243\037\022d\n\225\371\257\233\031\030\343\316\204"
+	.ascii	"\247<\037\033\004(\035Q\371`\0324\026e\2140\3675t\370\244\302"
+	.ascii	"\234C)]0\211\311\205\002Z\324\033\357MR6[^\323%\371\222\326\371"
+	.ascii	"\353~\343&,hy\272\235\344\342fu\355\307\226\377\254\331<\336"
+	.ascii	"-Pv\033\250\374\221\370\344l\210Z0 \332g\316\350\2748\215\206"
+	.ascii	"\374Ai0J;\022\322\022\241\232w\271q\237C\350w\\'\342\354;\"r"
+	.ascii	"\031V}\270\204jb\217\006q\245\353\030\340\230y\343\215]N\177"
+	.ascii	"5\353\252\227]\335\210\341\030\274\215\355\223\232\232\350\016"
+	.ascii	"X\310(\351;l\351\330\366\254\204\006'\263\233\277s%r\300f DQ"
+	.ascii	"\022\306\3678\310g\323~\201*y\344\336\r\313uGL\204g\324\270\017"
+	.ascii	"&\366b\3034B\353\211\362\220\305\347\331b3b\334\270v\377U\253"
+	.ascii	"\f\236\f[\033R\351\366+\007\337z\254\003\300\333-\r\375\237\277"
+	.ascii	"\204o\234c\035\261\204u\242\271$\031\271\365\324"
+	.string	">\025\360\205A;\203[\244\271\354Q\032\244\231\250:D\213\005e\320QFaC\333\203\246\374\300\311\033\flTs\277!\t\235\320f\274\004\351\253#5NN\020W\275Xj\322\357KZ\373K+\036\221cf\036\270\021v[\354\257-\275v\201\242D\313\305V\3234\307Co3\273\262\236\026,X\027K\201L<t)\007\261x\200(.K\251\317\306\333\266\314/\272\210>\346\311V\372\205\306\300\262\310\023\216\025\360\335\022\213-\367\276\356\237\254\321\307\322m;S\361\301&\r\021S\333*\217\232w\273\356ujb\205-3\2440,\"\310L:\365-p\262I[)J\235(@\262\021W\030\270\230\204B\337\201M\204.:y\317\300R|\315Sk;S\374l\004Hc|\275\267\023\207<o\221d\376\3413_x:\342\211\250\325fzYN\252}\313L/\236L\321\350M\250\306\367Nd\362\343\3412\031"
+	.ascii	"\260\273\320\275$\325\217\277/?\034\204))/M}\0355\364\314\236"
+	.ascii	"\261\242\276p\263\207&7\363\031\215\340x\3504\262'F\024e`\341"
+	.ascii	"M8\341z\316yI\317\217\243z\300\304\243\330\2062\211\251\226J"
+	.ascii	"\024\263i\277 \331P\355\364\265\271\022\260\211\001\005DQ\022"
+	.ascii	"\357\035\254\037\250\037\252\331\036\263hO\362o\002\241\2519"
+	.ascii	"\243\3607(\305Y\204\225+5\246\256\372\354\324\216\013\304H\b"
+	.ascii	"H"
+	.string	"\353\250v\n4z"
+	.ascii	"\265\256\241\266rQX\013"
+	.string	"\254\036\214\323p\356P.\273\3379\236\211\201\250\315r\204 -\027a\230\\\263sV/\035\303+\315\321-\303\036\263\207\2241!x\315\332\372\265\004\355\2146\334t\300\374\324Lr\3668\017\001`\240\300\245\274:[\306M\303A3:\210\b\245\275Xv\217XGt\344\242\"\0044mf\264z1`\275h\277\303C\321\315`Q\312\nS\017\317\207\310H\026\206\002\223e\355&\303\356\217\225\230\344\354Z\3057\337\225j\t\244\027\025\3252! \020Qm\n\036SG\031\333]\200\316\004u\267\020\362M\rh\353!\324\373f2&i*\032\346l(`5\027:\246e\f\t\265\326Q\255\017\372\240\343\350\223\320\022Z\225\253\237\017\"\007\022Yyz\302\005\377\2461\302\217\020\204\036\351\352}\352C\031=\206\302\366.\206\235\302\024\333\0361\315\376\355\351-61\022\254\356\240\215K!`\201\301\3377\316\351\2660R"
+	.string	"\tH\225\261r\025\"\310\346\302{\037\346\021\274\022e\022dN\231MT<0\262\317>\360\267\277N\250\344\324\245\024\275\2073\271\334L\3272\373\177E\357\365\333^\326\001%}\304So(\335\213\025\2354"
+	.string	"f\246\202o>T\006\317\0247\022\307-vJA\220n1\034f\261\233\005@'4\274\252\032\231\254\3255\002_qf\227\240\013\317]pz\353\272(\236\365J,0\260'\272\224T\356\022_\226\305]\3467<\311\013\373\352\222\236\254\b-U\0270~(\027\322\351\211\335@\251\037\366\262\202\335_o\233-Rv$\2440\353c.\221,\n\023n\2541\303\306V\025\210\241#g\235\267\307\243\003\0319T\200\326\0374\273c\243X\344<\323\364\265\215\263jO\365-E"
+	.string	"Mce2\354\230\3472t\001\234\356\f\271 `I\024\231\207\340\034\372~\335}.\223\016\200ot\207\223\251\275HQ\335\330r\331\350\033\013O\n\216\214\004N\326<\2155\377\tz\033\353\224$B\221\231\366\260F\326$\2459G!\026\344\264\200\337`\347\261\267qZ\354\003\207|ZX\377\257\003_,\312g-\005\200\177\002g\211F\022\371\324P8i\032\020T1\205$\234'\365\241\242\346\205\317\305\241&\226\360I`2\230\005B\271n4\210\3069\313\377B\247\301\247\373y\317\350\204\340\222s\377-\2461FT\322\265\24425\t\001\222\370H\343\346\252\233F.\206m-\001\037\352,\223yf#3;\357\215\243"
+	.ascii	"o\304\312\221Dud\250\207\313\235;\235\367\301D{?A"
+	.string	"\356\374J\215\354}\245\363\331\360\350\326z\242\251\322Q\177\363!\212\324\032\205\344\253\205J\366BfIB\222`;\303Ki\272\223U\220\021\356\304\266\3518'\0239z\226j`\376\201\302P'*D\374\275\271?\330Br_\226\377\242V\036\336!t\320\376\274\260\020\367\214\365\013\343\306\337\303x\335\356\227H\230h\177\270\345\034\214P\001NE\rD\025R#\257j\200,\276.\3625\375\206\316\020\330\340\036\267\361\006@\335\320~\327\326\f\036\021g\024\306p\265\336\364P\221}Z\340\376A\236\035k\235\3342\204\2523\260\027u\032\261Y\306\276\376\331\242\313\322\3558Pv\034~\350\206\033\270/z\271+QOfM\236\020\331h\231\264\275\301\335p\351\2357\345\202\004k)\003\274\367\003\fvP\033\217\371r\345bE\333\356\201+\\\243\004Nm\302\270k\b\323] \221\241\365\035\016\222\345\303\271\314#\026\350V"
+	.string	"\025\346\215\\aQ\336}\205\337\254\363W\301\002\261\327\226\340W\220\361Y\215\265\355k\220\314\237\361i\351\\\r6Q\001\033\361\024\3063_\321l\033\276\026\312!\"d\200\300\205\227\221rK.3\246;XY\330\270\213 J\337gO\252r\020\354\032\354L\025:\2722g\266\202?RW"
+	.string	"sQ\353\nB\316L&N\223\212\035\305iu\216\313\226=&\272\340+\261~\240\212\367k\203i\274\333\216\330\n\022i"
+	.string	"Ma\320\347W\036\312\355\023\237\302'\311~=\330u\226\177\216^\003\342\225\367\301-&J\023\227\236\213\277\340C\024_,Y\355w\3749\301\324s\203?K\236\t!\254\023(\356\363p\300\340\375d\206\202;!\214!$\270\373\214\356\365y\201}{\334.\223\224j\213\200\025\223=\363\016\3168\253\301\203\372\3243G\343\330{\363\007;\nJy\224\255\r\234\336\331k\257\366\265p\242\222$5\036\np\276\013,\310\215m\201\305X\307\347\022\271(.~\016@\241b\276"
+	.ascii	"\037\215c\334\351\007RD\224\0131\222\n\362\021j\240@\222\326"
+	.ascii	"\200_\037\244\341)2/\3352@\374\346"
+	.string	";\016r\276\023\\.*Y\3343\252g\345\203\207\375\214\360g\222\002-l\240\005\337\355\034\352\025\353,\235\031\317\263m\316\027HP\tCA\332\312q\016\247w\032%\004\036\227\345\312f\314V\304\n\235;<[\004\230\340\271\257g\375\345\370\032\352\020\244\223\270\205A\302\274u_xa\236\344\255y\220\"l6u\354\301|\303\017ih-\352G\316\320\375\241\252\306\222\205q\0363\251P]\025\347p% \021\314\023\3158w\343VD\026F\005\222\321umu\236\373\325\304\317~\371\023\276o;W~\207\200F\321\257\271\r)MU\2301\344\313p6\222\030;\3202`\261\341\246\222q\337S\2420\211\343mM\377\325KUT\225\334H\\\274\177\177*\304\252\363Z\016\266\234\253\360_\002p\207\t\346\235\340\215\350\207\337Vg\341j\221\251B\3070\251\005\302H\207\205AR1\004\002X\273F,v?\252\346\355"
+	.ascii	"\240# \223\021\351\361\033r$\223\311\034\3419\205\302>\025\347"
+	.ascii	"\006\356P\237s\227+oj\265\325\207\356n\300\265\202QI\300I;\303"
+	.ascii	"!\264\340\363\332\274\241~p\004\217\326H3,=\227\316\246<\245"
+	.ascii	"\213\335}\b\222+\367\346\366L,\334\263\022\nV ]\360\366C[e\315"
+	.ascii	"\264\354\371PY\324\214\375\232\220\336\211\2243\313\206\023\315"
+	.ascii	"\343nm\210\362/\374\2774\274\313\025\266\300\243\362\256\261"
+	.ascii	"=F\027\3063\232:\260%Th\206\377\260m+\367\2112gl\311\322\251"
+	.ascii	"\223\b\246A%\002\t\241\376\376F.\235\351\355\332\240u\306<~\320"
+	.ascii	"\316\367\t\276\314\323$\002\373\216L~S\362\233z\327\260"
+	.string	"M\177\315\320>\341\377#\353\300\364\202g\307@\337\277q=\3231H\346\210\215\361\034md\3512&-\032\334\257p3\032\204M\017\254\262\027\235\364\246u\225\0379\265&\215\346\323f\254\370\006\336\3737=\243\273'!p+j\355\345\317B.\363\272\002\253\017\n1\341\207\247\265\333\nys\232G\314\2377\022iE\020\"\230\022\004\360\244n\347Ap2\375.j<\252\373\336\251\310^6\324\316\332\214\250:\317k)D\260\273\037!y|\257\242\340\327\250@\245\036\030\b\337\310\022\354\016\263\345 z\031\033`p\304<e\247M$b\364\031\237\206\245\373( \330\334\026\306\3534\221\204/88\026\b\276\226\004sz|\200\"\374\255\206r\376m\372\235\345}\363\027|\266\222\3201\024\320\231\240\211.Rm\260\024\263\343\251\300\0030\233\177\256\255\\\331 \016\321\255B\356\234$\031\304P\016\306O\252\227\345\327\006"
+	.ascii	"(0\225\363\001\205{\246 \276s\360\272!+$\322m\357\316L\245;x"
+	.ascii	"\037\375"
+	.string	"#:(x\016\261\017\025t G\241F\f\305\33559\035c\204*\364\230\233\354p{\032\241\026\257e\374];\352l\3473\272\216\231\030\337 \370\0279\365\260\262\306\245\004\304>5\346\367@B\326\035\"s\027#a\245\213/\211n\0135!,\003\334H1\246\345\237\304oAh\205C\221\207\214\351\270\312\222\313\004V\223\252qm\321\351g%\370y'\210}\017\222\250\345\314\2464\210q[\271\315\250#\330\316ZTzv\336\260h\3008\036\205V\177\217\362i\253\372\0064Y\246\320=+\016\366\206\354\002p\207)\201 \203%K\002.\234\367\004\214\246V\310\324\377,\200\225\335\305\341\033\257\234\302`\301^\037\374\325\366,\bv\333j\376\303\031\371\017\357\377\002~\275>lc\220\337"
+	.ascii	"\007\037b\326\254\325\025\363\272\315P_\354\264\200\323\2724"
+	.ascii	"\367\277x\372#~\334*\230\275*WN\312\3501\2767j\362A\315\024'"
+	.ascii	"\307\303\340\311\201\007\256\364*\220Y\346\t\234/\210,>\201\355"
+	.ascii	"+p9\001\373vU\307\024\261-\013\217\243A\346\2659+\323\366\333"
+	.ascii	"6oS\361\f\343s\230\345\345GAc\335>.\214\3706\246oE\034\273\364"
+	.ascii	"\372\343\031\377\033\317\277O\240\275F&\334\236\277\353\305\254"
+	.ascii	"=>V\177(\330"
+	.string	"`F\002\270.lkp\214M\221\372&\363\243\255p%\271\016i?\\cgy\330\321H\222\267-~2 \300\334\272=\334u\373\374\013\345\222\247\037\237\025\207\310\300\301\350\037\306\376\225%\017\246kF?Hh\274\326\320>\347D~\224\261!\224\037\265\335\033\347\356\205[\321U\262\371*\304\327\270\301\267\304\220\301Z9[\026\311OY\221G[\035\303\354\32544\36003\r&\303Y:\300<E\317\223\\\277\222\344\213\201?(#Y8\247\207\265p\233\303\340\240\004\314\033\202\305\350\333^d\362/\246y5M\276N\277\313\212<X\244fi\367\255$\230\334\220\217H\330\3006\b \333\262zs\255\303n\364\b\317\177\344\347\201b\036L\366=\023kD\202\3604o'\324\204{\333\314\221p\336\245\270\357\"\375Z\343\376\221\355w,\210#\234d\200\344:\325U\215p\246W~W3\357\021\277\233\202\273\375K"
+	.ascii	"\234\020\377TOw\207\357\335\366_W\305\320H\357Bc\226l\315\260"
+	.ascii	"\231\374\026\300\362*Sv.3^gZF,\346yjs\307\375\273\302\031Y\367"
+	.ascii	"IA\336\300\326E\340O\220\370t\376\230!7\323\317_\210\202\356"
+	.ascii	"-,\006?\001\276\021\223\257]g-\230\317_\257%:^\344>#\352\351"
+	.ascii	"\223V\307m\353\203\203n\252\016\317Fc\336\277\301\251A\344\243"
+	.ascii	"\341\361\235q:\\\231\365\3431\321\177.\2414^}\240\373D\376\023"
+	.ascii	"\227\016\347!:\347]\265l~\330\255U\243w\373\246c\3317\272\347"
+	.ascii	"p\210\3566\366D\216\330x\031\273\3179\356Zr\177\266\235N+\311"
+	.ascii	"\313t\374UL7\241\344\224\313\361p\007\213GT\335J:\b\356\027v"
+	.ascii	"\331W\276\036\265\334\313!_\022f\327\304?o\007\261u\363\247\240"
+	.ascii	"v\274\323n\251b\253\026\217\240\315/\002\305\351\356\"\013N\\"
+	.ascii	"a]>o-\367\361\306b\b\302\272\001(\235\263\343@\026w%H\307\311"
+	.ascii	"\033\227s\017Y\3633\333\217 \324\201p\354\207\234\316\005\222"
+	.ascii	"\017@\032-\320\345\2327\3565\336\263J\275\036"
+	.string	"\305\023Z{\275\342\375\256\333q\267\237\017\364\3615\027\203\374\226\241\033\214\332\016\251\271\241\3661\260F]y\242&\267H.\005\321Qt\350\374\203\357\361D\307{+\017'\203\301Q\327\365x\357\3270+\271\267/\231\031{\264Py\351{c\315\347w\274\261\346S\244\333\242\310\242\361\306\272\206y\013NU\214g\007\216Vi\3355\3076\307\016+\235U\345t\016m\277\205\305\201V}\023\352\006\356\314,l\311\206\355\351\272\264\007c\206>\351\250\357\216\373\343\344\233\232\276\f\326\211\332\317\2128\247\322?|\374\260u\037\3726\202\021\264\007\222\n\227\344\235\223\234\266Yh\277\330\227O^\310\0371\260\306\246\317\261\236\363&\3750\243\237-\271|\356\227\211\017\340\244\360\0244\235f\373\227\360V\177:B\363\377\247\365Jzd1wR\350\n~\335pGG\317)\234\251\352WD\3658\330\233\370\212\355*\347\031\356@"
+	.string	"?<\303.\253\037\00531\320\033\242n#\307\345\3523ov\022\036X\345\370\220\210]\350:\325\330>\312%0\336\377g=_\244\372g`^hr\316\215Q"
+	.ascii	"\231\013\364\210v\277\330\375\2121/\204\326\223\251O\252\031"
+	.ascii	"W!|\016\371]j\355;\352\365\377\316\345\315\340R\240\023z;o\376"
+	.ascii	"\361F\036\372\217\262.k\324s\352\316W\371\337\362\260\346\310"
+	.ascii	"<\216_;\034\337;\225(\217g\235\237\301\2710\231\231q\034\313"
+	.ascii	":\026\257!\235I\017\357\013\032]\351o|\344\037a\220\354|y3\205"
+	.ascii	"0/\231\326\006|\203\207'\3047t_\241L\253#\235,p]7\273\351\273"
+	.ascii	"\261a[|j\362\213\001\303\227\257+o\355\347\253S\177\215\330\320"
+	.ascii	"\325\217j.Sb\356\203\035\355i\301\250\035\fF\026\201\217\b\337"
+	.ascii	"\233\277n\362\023\260\f#9c_c\244\267D\213h9\272\211;'\260\312"
+	.ascii	"\200\233\247\315\325\213\323\365\237\264\363\244A\347Kl9(_\334"
+	.ascii	"?\022|\np\016w\356\002\017\241\361\007\375\026V\276\353\330,"
+	.ascii	"\345T\363\236\272<=\356\333\322FNO\024v\220\371X\375\260\315"
+	.ascii	"S\217\203n{\367e\351\246\237\235\312*\022v\244\360\031\316Uv"
+	.ascii	"\375c\313\276\221\336\0216\324]\203\354\317h\330\305\221\256"
+	.ascii	"4lZ\307\357\206@/KG\351\205wi\225\356\330-\273\371\246\177V\232"
+	.ascii	"\336\241\345u\332\234!\264\213Yo\021\357\330#\322T\362\347|\204"
+	.ascii	"^\343\264=\320cL\362\301\245;@\262\307\354L\357!t\240n@\324\337"
+	.ascii	"\310\r.l\375\003"
+	.text
+	.section	.gnu.lto_.symtab.a7c5cc1330de509,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\007"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\007"
+	.string	""
+	.string	"blackboxValidateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\007"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\007"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\007"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\007"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\b"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\b"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\b"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\b"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\006"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\007"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\007"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\007"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\007"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\007"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\007"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\007"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\007"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\007"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\007"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\007"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\007"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\007"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\007"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\007"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\007"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\007"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\007"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\007"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\007"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\007"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\007"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\007"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\007"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\006"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\007"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\007"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\007"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\007"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\007"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\007"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\007"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\007"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\007"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\b"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\b"
+	.string	""
+	.string	"blackboxGyroCaptureStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\b"
+	.string	""
+	.string	"blackboxGyroCaptureStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\b"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\b"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\b"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\b"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\b"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\b"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\b"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\b"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\b"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\b"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\b"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\b"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\b"
+	.string	""
+	.string	"blackboxAdaptiveSelection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\b"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\b"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\b"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\b"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\b"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\b"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\b"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\b"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\b"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\b"
+	.string	""
+	.string	"mixerGetLoggingThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\b"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\b"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\b"
+	.string	""
+	.string	"blackboxAdaptiveWriteGroup"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\b"
+	.string	""
+	.string	"blackboxAdaptiveUpdateSelection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\b"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\b"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\b"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\b"
+	.string	""
+	.string	"blackboxAdaptiveGroupInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\t"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\t"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\t"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\t"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\t"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\t"
+	.string	""
+	.string	"flightStatsGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\t"
+	.string	""
+	.string	"streamStatsMean"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\t"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\t"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\t"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\t"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\t"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\t"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\t"
+	.string	""
+	.string	"blackboxGyroCaptureWriteBlocks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\t"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\t"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\t"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\t"
+	.string	""
+	.string	"blackboxOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\t"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a7c5cc1330de509,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
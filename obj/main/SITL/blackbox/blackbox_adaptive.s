@@ -0,0 +1,695 @@
+	.file	"blackbox_adaptive.c"
+	.section	.gnu.lto_.profile.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\r\004"
+	.string	"\324\005\374"
+	.string	"\t"
+	.string	"\215\350\363\267\001\b\002"
+	.string	"\001\333\361\252\253\f\002\002\001\002\001\002\311\306\235\331\006"
+	.string	"\003\347\255\312\307\007\n\002\002\002\003\004\316\373\276M\004\005\347\364\236\222\f$\002\004\005\002\005\005\002\005\006\274\332\274\306\001\034\002\006\007\002\007\007\375\255\245\350\b\002\b\204\220\264\367\r\b\002\002\002\b"
+	.string	"\016"
+	.ascii	"+\023\305f@@\300\013\003{\306a \260\231\006`\201\027=r\371\344"
+	.ascii	"$J;\304\345$\202\001\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\355\003"
+	.string	"r\205\r\022\260%\351\226\207\341,IR.'\304\222\335\366\226)\005N\255\374&\333"
+	.string	"\242$\370\251\313\3176\366\242@Xip),T\327\260\216\366\347\177o\233\376\217\343\360@\037"
+	.string	"\252\020F\254`tj\314\b\310P\354\006\004\306\224\001\002d\246\200\035\215\231\327\344:x)\0057z2\3101\321\253&\2000\240\016\034\223\252\005,"
+	.ascii	"+v\352\020\027\001\202\233\302\025\f&\2234`r\001\206"
+	.text
+	.section	.gnu.lto_.inline.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\356\004\225\025"
+	.string	"\366_hC\020\257&\215\001\2034\216Q\025J\037S9\273\207\223S\330G\206\210\216\210~\320\267.\240\305l\255a-\200\350\267\r7\264:\322\237\001@\001\250\026%\301Z*\220eNNo\303\314\246\355&\322\266\2242\005R"
+	.string	"T"
+	.string	"\\"
+	.ascii	"?G\372h$\275\335P\231b\3032\361v\273\367;i\315j\246\025z\264"
+	.ascii	"\351\215h\212\325L\211\320\225\377G\363\021Q\327'I\346\214\f"
+	.ascii	"\022\303\204\232\314\300\370\017\377\264C\362<Erw\367\372\224"
+	.ascii	"\252\354\242\fh\211\236\304\3241\245+\273(\242\357\314Y\021\372"
+	.ascii	"\2078\357\235\355v\202\240\266v#t\336\224+\0221*<\327\317\351"
+	.ascii	"\235\304u\034\321\031.-3\004\254\236\222\317\315\315\325K.\021"
+	.ascii	"\311\r\247\025\026\314\213\317\270\020v\327\3441U\003\020\037"
+	.ascii	"\320\003bcJoZ\324T\3608/e\2272\0045\367J\031>~\364\333\036\221"
+	.ascii	"\036\221P\252\302\202q!\032\311\023\033\326\211\221"
+	.string	"\350\24428\234\\\b\200\007\024d\201\375h\217\236\333\363\341&HV\n\013\r\376\332\376@\262\235\034M_\017%&(=\320\223\252\021\b\312\007\"\020\224*4]\240$\331\023\023\343E\302(\346d\253[\021\245q\211\002\250})\013\377\316\205\250\342\32354\022M\212\355.e\177\324-\222\255\335\345\234\316\244-\022\351\006:\2706Ru\216'\315\340\322r\323\031\303;d\360aw\310\340\0276\200\027\304\223\276\204p\321\300\361\251\264\300B\263\"\320\036\307\005\n\203E\207\024\004\267\256om[\033\221Z\200\211\250\361D\312\b\311\214$\005I\013\007\220\002)\2221z\021 %\204\214\221H\223\2242\255\001\226\305+\262\007\264\227\021\342\"\207<\t\356\255\275\262\340\001\246lN\024\313\002\344{GN\312\255\330\313\001\240=\217P\207\244\243\260G2\3376\215\357\337\273\324?h\345FT\347\324\353\376&\246\22255"
+	.string	"\003\013\017\305(\024@(\250\"h!\027D\273\\D\367\265\034Y\220@\340\nR\007\372Rj\263@Gg\263|\267,\307h_\340\300\377\337\202\024\333\353Oq+9\033f\311\b\306\271\220\366\330\236r\206A\332\306\304\256\215\360\303"
+	.ascii	"4e0\201\304b\265\256GV\223\332\324S_\020x\374vDRi\363G\236 \357"
+	.ascii	"\272\225\251L\\\342d\303=\201i\345\273\254sO)\017>.\367\362\264"
+	.ascii	"$\232J:\271V\275~\2174\205D\311=Ec3\245\307\324\022\336\331a"
+	.ascii	"\376\333\336\221P\300}\337\363x\ru\333k\346l\032\233\363\302"
+	.ascii	"\334&t\235"
+	.text
+	.section	.gnu.lto_.jmpfuncs.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\307\002\305\t"
+	.string	"b\315%(\200)I\0073\260\314\210\006\342\243#\b\"<\tzjB\200\f\252!#\274-\026Kj\207YAZ\236\240\335\366\226I\006<%\375\271*\r0q\202\325\256\256\256 \236YH|\304\364b3w\272!\366\020\353T\350\315\213\361\305\254Z\352\315P\226\224@\217\240\331\022\207\343\001C(Sz\324c|\353\207\331h\314\n+\371c\356\360\221_8v\363\270\337Tu\026\034\243\0365\\=\223\302\f\356\214\213W\336\305\360b&\253\364\356-VzJ\217\275\203\237\030@\212\004F\250\221\265s3\023D\005\251\026\003`\002\t\214)=\022`\2621\206\"z\2301\3102\225]\377m\226\002\346\327\303dU?\224?c#N\325a\216\362I\241\334\344L`c0\261\352\237\\H"
+	.ascii	"\2223\213x\245cR\322?\223\025\032\220\001\353\335FL!\367\246"
+	.ascii	"!E\332\300\203\243~\356r\003\342\270\312IaJN\200\033\376\254"
+	.ascii	"\2757\252dE\267\321S\316>M](\363\361\342\263\326\013\317\371"
+	.ascii	"\200\241\301\251.\264\r\215\216 \006gD-\225\240\317\361u@U)\016"
+	.ascii	"\231\016\262j\2715\007\234"
+	.text
+	.section	.gnu.lto_.pureconst.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\205\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\231\004\b\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"=\006"
+	.string	"\262\310\037'\220+\035x\023\332\310 \272i\224\335\241\215=\210K\274\305\016g\272]\327\210\031\027\241\335$j\036M\356\275\367\2262\0057\034\022\205F`S\371\377\337N\033\310\244T\204sqL\214\206\202\252G\246jH\244<s\244\220$\270\022?1\306f\356\177\203\330\327w\tV!\204\316r\327\030\245#\031\223\3567\277\262,\260\220\362Q3_\257\017B\327\367\203\325^\375\377\344\233m\256\003\356~\215\001\035"
+	.string	"x"
+	.string	"e\343\273\206\266\247+\220i\244\003\0013\r\3409\243u\244DC\304\254\233\224\300}\256\306D\331\335\350T/\253\326"
+	.string	"\215\340\r\356\221)\266\024\273B\211\201\243\211y\301n\214\312@\317\013\354F\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.11b8475b5cc66ab3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveGroupInit.5.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"u\013"
+	.string	"fVP@\020Q\225\016K\035\221'"
+	.string	"T\026\036,\254\021\213\223\005\246\\\371\203\004\020\370\373"
+	.string	"\001`k\261\226t?z\254\277\033\310$\t\004\002"
+	.string	"-6<!\004\245\006\001\311\177\371\275\364\263$\222M\344N)<"
+	.string	";"
+	.string	"@"
+	.string	"\240\207\354\2027V\273!\305\t\262K\207\017\200]f\237`\227\366l\031\0020x\260(\245\260\261\273\232\202\270\367\350\371W=\362\231B\217\035\013v\327\3613m\270\365\266\013\330f`\277A\277vw\255\240\375\350\354\251_\036\365\253F?\"\371"
+	.string	" \306\256\206\026\216eI\027\"l_b;\206G\341=\345\027\027\310^\350\220a\265\273\024+\310.\007\\\217\366M\374\204wT\232\257\230\331\356\"\360U|&|\2048\201\260\313\1774\244^%8\243\224C\024[\306\"\201\033\006v\340\231\332\036\013\361\237\257\272\003\016,\222\206\034?\301T3u$\215\030\305\226\035\206\242z\260\003\235\215gr\222\343\231]\004i\256r\251\200\351p6\b\333\203\317\264d\270M\202E\333`6\215\306u\024\264\212\001O\316\245\323:sv\232$\334_\253\240%\t\226HG\216\237\230\235y\213\312\251D\215\253\035\020"
+	.string	"`\251'\023\332\301\201\343\202e\024\021K\231\031v\357\316\254i\230\013\226\013\3031\214\016\304"
+	.ascii	"W\244\251)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveResiduals.6.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`F\013m3"
+	.string	"\372\\\220\023=`\350\312p\357\346p\3656\002\370v\375\337\2272\314\037'#\210X\237\214\321B\220|.2/]\0307\177]\351o\256YN\362Q\001\001\202\243\325\017DALi\311'd\357\275\223L26\001\375"
+	.string	"%\001Z\254g\307\261\341\330o\3546\252\326S\357\255\261+b(O\205&\343\340"
+	.string	"\256\271\001\335\360!B\006\304st\027EhN\315F\355\246\215\346\215'\032\2578\177\f\235\347IeRa"
+	.string	"M\216BU\035\325\350"
+	.string	"\263\002M\031''\314\370\225\370\030\333\251\231\f\217\247\341\031\304.\215\210:\340\326i\3368<\203\3045\271;\317\323J\267\200&\325\253j0\016\243f1=4x\236R\036\335\235g\235\225n"
+	.string	"\232\214\262Sir\264\200\322\244\252\251\372=\261)\331\021R\206\321y\236\304W\001\216\177\177\245\232\177\177\177\221<\326Y\225H5/)\t\223\202@\263$\30735\rWMmj\2551\203%y\332\216\254yi\257\311*9\261\320\214+rH\n\022'N\032\017\300\331I\342=K=\320\0237\310k,E\347\306d\203xB\026(E\005\311\233\315;\266-\267(19\232lF\262x\217\333\223\021\253\221!<\273\361\0169\002d\307\244-I\374}3\323"
+	.string	"7\021\360p\211\025(\345\360<OKq\203\033\327\324:\317S\267\355\b\022+"
+	.ascii	"\253:\211\252\232\251&e\005S&G\334)\f\037\333FR\255[\333\313"
+	.ascii	"\251\332z\342\004\325\351\247\250\262p\033\353\n\277\261\252"
+	.ascii	"\260\236\025\205\343XOX\215\035f4\266\t\233\261\301L\306\376"
+	.ascii	"r\235M\302b\354\021\326"
+	.string	"\263z\031\216\265\313o\254\\nc\335\332U\255q5D\271\nbW\263v\365\203\271\352\341\253\035v\225\203\271\212\365\325\r\345\252\206r5\303\256b\330\325\013\273jaW+\230\253\024v\225h\256^\355\252\225\271Z\265\253T\343\352\204rujW%\354j\204]\205`\256>\370\252\203]m`\2562\370\252\324\256F\231\253\013\276\252\240\\MP\256B\355*\202q\365@\271j`W\237v\265\200\271J\340\253N\273:`W\005\230\253\001\276\n`W\207\346j\323W\231\312\325\245rUiW\205\343jR\271\032\334U\240\271j~\265\334U\322\\\035\277\372ru\313U\267\270\320\305\251\320y\032\371{t\362\221x\001d\337\202Gq-H\360\257+\200z\202\256C\335x\236\022\342\307$U\234\2742\2442\027\327}Wr]\305\203z\205\020\214x\372\360\b\f<\354\007\374X\351\006\n|\300\237^\366\025\347\b\274"
+	.string	"\n\002&\356t\363N^)\340\003N\266)\322\005\270"
+	.ascii	"\027\001\300\016\340e\231\"\227\246\017a4-\375\353L\346c\245"
+	.ascii	"/q]\351\276\363Tq\021y9\r\322\371\212\223W\232\250\274\365!$"
+	.ascii	"\276\025\364\263\263\023d\033\251\307\261\312[_\361\240\336\231"
+	.ascii	"\"\234\360j@1h\024\260\242\2434\371\2746D\300\223\027~\354+\316"
+	.ascii	"\005\037\366\2441\370UT\2443\017D3\301^\236\2743\236\274U\335"
+	.ascii	"\267\343\f\210E\315\343\036\302\344\307\277\376\273\310e\255"
+	.ascii	"uJ\177\357\"\035\220\375\323\255\373v\343\251\342\033!\221~\354"
+	.ascii	"\337\177f\217\355\310\3450\321\261\233.w\307\252\265\266\220"
+	.ascii	"\324\306\262\322\310\320\360rj=\352=\352\007\374\360\356\374"
+	.ascii	"\233;\243\340Q\347Q?\ro\256\243\266\243~D9\356Q\232\234\243\252"
+	.ascii	"~Yo\347\271f\270m;\003bi3\312\310H3\337\230!\206\203\314\354"
+	.ascii	"F\031Z\320B\205\034eh6H44\034ccZ\r\034gc$\332Y\332\230\031Y\031"
+	.ascii	"\232\215\240\216]\225\3450K\263!F&\366b\307\031\f\031cb3`\020"
+	.ascii	"k\230\211\321 \216\241\335 ^I\3203\033eh\304\264\26334\242\260"
+	.ascii	"\356\364\032\003\315x\341\373q K\227S!\023!\212\223\201\222\252"
+	.ascii	"\354\345uG\332,m"
+	.string	"pz\224\274\216\342\246{+\244u\322H\240(\353\034\256u\262\f\210\207=D\206\203\370\363N\374\303\263\340<\374C\233\007\260wxY\006\353\034\334\2604\374\353\0332\\\203\3273\334{&\337\336\026-\221A\215\212\b\211\267\372\211\347x\363S\234\303\340\003\317\205[\035C\"[\370\205\n'\336\002\205W\340\243\360\022\322\325\211{\256N\366U\335\312G\2373`\325\235g\322\355\355\215\324\223)q\222.\247T&q(\"qvx\314g\257q\212?\276\265\205\0244Y\234\274\302D\345\256\256\033\017\330u\026\017\356\345\241R\273\"\341Q\247\202\233z\330'@}\312G\204K\270\331W\374\002\341\r\036\001\356\301!ty`\342\016^Bb\360\006j`\030\200]\352\001\200\323\250QH\004\221SC3\222\202\244 \205a\r\360\002\021\251\0317\022`TALC&\225\210\026T\352\264wO\266\037\314\177\261/\321X"
+	.string	",J\230\363\n\243j\344\305\306"
+	.string	"\315C\334"
+	.ascii	"\2010\033\216\272\006\216E\314\200O\330\027s\274\217\261A\254"
+	.ascii	"<\342\344\210;\211k\347\306\021\263\016\244\353\034\033Fc\f\360"
+	.ascii	"j3\f\004t\223\221w\351\241\025&Pa[\265r5\036&$\315\205\204\274"
+	.ascii	"\223}\240\240n\360\323\321/$M]\237&\343ZK\263\211@\323\027>\305"
+	.ascii	"\342mDH\204#mt\346z#\n\034\017+\017\254\247\326\240\254\001?"
+	.ascii	"\035\375PI\332F8\336\214x\013-\342\302\021\026b\004\313\\IN\031"
+	.ascii	"[\021\016\315?\360x\257\255\214\234\312o1\266\325\371\037O\245"
+	.ascii	"\375l\322\216F\217\376\006:\237V\276\001\207w\034)\260\347#e"
+	.ascii	"\021\262\302\262Y\231M\031\336\235\024~H0@K\f\374\367\251\332"
+	.ascii	"G\203s\204~\024\364\326\006@a\243\300\376_-\253\215R\306v\033"
+	.ascii	"\006\220}+8\2672\204&\316\023\331w\253'\270\2775$\207`\233\f"
+	.ascii	"`\3500\213\264\316qXvcr\250T\334U\013\227W\317\232\002\352\267"
+	.ascii	"\315\221\237+\b\305\361\226\261{\326(\203\253\303M\335&\356\320"
+	.ascii	"\343\242\343\341AxLL><0\224\370[G\216\022!(>\250\b_\322\366l"
+	.ascii	"\270\364\357(\233\261\314\332REo.\020\233\226\374\007"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveEncodedLength.7.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\201\007\355&"
+	.string	"\212F\354\016E\220\334\315p\005\274\323K\324\025\320\342\033H\254\026\240`\342%$, \034\242Ph\236\327\211\006\261\213\216\367\032Xe\314\023Ib\306\222!\"\204H\016\244\240\366\207\226\232[\220\3006M\220i\220\275\367\336I&\031\345"
+	.string	"\312"
+	.string	"\326"
+	.string	"Nl\246\2672\025\002Q\301\360A\201L\205fP\313$\233\021\206\346<\317\237G\235p&*\344rv\236g\221J\3301'\211\262\022\022"
+	.ascii	"v'\325\022$Hc\246z\215\244\204\270;\251f\2348;\317\261\"}`z\264"
+	.ascii	"\021\037\211R\025\212ca[\345\224\327U\0237\347y\036\001\271G"
+	.ascii	"z\024\335Cz\274\215\262\304\351p8\034\212\244\256\020\207\360"
+	.ascii	"\206\3051\2539FY\007g\273\231%9\212\317\351v\033\245\206\340"
+	.ascii	"\205\206\265\025\264\316\213  Z-\026W\"\325\340\362\262\315R"
+	.ascii	"^\276]\255\031T\203\213\205\313\252%\177\254\360(\226U)xX\214"
+	.ascii	"V\227\b\341\r\032+6\363fmM\255\230\363C\205\317s\316g\335\262"
+	.ascii	"\360.\f\306\027\271;\317\3232\264\272\304-\221\316\363\324\305"
+	.ascii	"\332\342\262\356X\325O\252jA\225\314\021V\244\340\306Q;\207\365"
+	.ascii	"\225\266;\230fQ\243\251\232\277h\371\0255\026Us\032\213=SWQ5"
+	.ascii	"\013\355\022\244GOQU5\227\321r\236A\177\251\332b\235C\036\005"
+	.ascii	"|\311\204`\252vMu,\270\007S5\204\2607h\3644T\0330X\240\340\253"
+	.ascii	"\t\214\212\210\276\372\373\352\220\241X\205\020\034\370\252\201"
+	.ascii	"\002\004\276\032d%\366\217\231\330\003\214\304\026\340\343\353"
+	.ascii	"\231\314\312\353\341qY\231u\367U\335\256\346\304U\234\270\252"
+	.ascii	"\363\325\333\256\346\210\2536q\325\374j\271\253\244\270:\212"
+	.ascii	"\253\342\256^\\]q\325\016\312!a\002\2649\317\024C8'\230\321J"
+	.string	"\017C\261\311\3542_\365\211:\n\024\025\372\344:mB\315\230\035\025L\217V\215R\007\252MA\266\377<\307\274\315w\363v\3235,\017\246\033F\344kD\240\373\271G\204\307x@\367\363N\371\b\333{\311\303\206,r\357\bn\025]T\f|\347\007r\226\274j\007\340\032\313\300\201\250\036\324\361?'\275\305\342\307\336\305;\255\013\355jMj<\230z\215\330\224\027}I\fE\356g\336\263\354C\354\313\211\276\024d-\367\363\356Y\003\316\263\341X\222F\265o\324\026\265\230\367\242\217pa\346\367\335\211\276e\254\276\312\035\372\257\372\001\304\032\353w\240\252\007u\377\363\177\343X\t\021\255]H\177o+ \276\315\354cs\265&\265C5\255BR\350C\377y\261Z3\265C\345}\300\205\356(\226\260\302\305\031+\037S;\\M\303&\f\215S\311Y\261u\007\023\006I\027V\003T\006'&\016d\223\241\234@"
+	.ascii	"\225\306\017L 8$\205 385-\001\225\234\230LU2b\n\321\004\345!"
+	.ascii	"i)\351\202\b \206\rJI\0340\03495%u8Rz\372pd$\244@\017LOGP@\340"
+	.ascii	"\323\321m\354\264\210\353\271\221\032=w%\006F\352S\252s0\005"
+	.ascii	"Sd\315\266\200\301}\236\025\303\b\n\233\202\253xk\360\036\237"
+	.ascii	"\217\260-\342\210\354\363\005\367\360b\230\340=W\360m\242[\335"
+	.ascii	"U\225\230\326X\t\324b0d0u\250I\220\036u_/Y.p\377y\356\3269\316"
+	.ascii	"\347:\367\231\227\223;A\253\332\262\231Y\024\263\352]E\336U4"
+	.ascii	"}g\360,\233\331$\023dm\177Vr\347*\356\256&\317\033X\212oje\201"
+	.ascii	"\335\317\276\265\222\300\356g\236\233\277\330\367\233\351{\201"
+	.ascii	"6A\3479\201\234\007\200\224\250AD\"\225C\204FdD$I\322\302\001"
+	.ascii	"\300\002\031\252!7\022@VE%\036\241QPZXV\353l\006\340\242\256"
+	.ascii	"\354\355[rq\260\001\003>\257d\006Lfk\252U\351!\036`?\210\177"
+	.ascii	"\023\2207\264\346(\233\276n\267\031U\275\r\355tlf\342\267\030"
+	.ascii	",\362y\031\205\b\023\r\241[\214\302\341\304\021\006\323\232\271"
+	.ascii	"\312\344\202;\r\212\205zY\036\021E\215\031\n|A\226\304\360c\004"
+	.ascii	"q\344\007\220m\340\201\221\t\030\204\314b\212\252\374\246\270"
+	.ascii	"\200\212<!J\313\245\201\367\030U\361=|<\031\354Q\037\024\352"
+	.ascii	"\213\236\354\367\266z\356\364v^\234\007B\203\003\0045J:R\351"
+	.ascii	"\"\213}s\346\242\305]\n\007\221xF\240\016\363\004;h\217\323\266"
+	.ascii	"\252\317`?\372MH\354\021\277\030\316\334FN\240\271\247\316\300"
+	.ascii	"2He\t&V]{\3571T\037_:\335=\370m\026\003n\256l~\016\320\202\235"
+	.ascii	"t\242\2446\2627\255\002C\354\302}\013\246<\377\252^\31476P2u"
+	.ascii	"o0\313\213\n"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveWriteEncoded.8.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\324\005]\037"
+	.string	"&8\277H\260\226Q:q\305\345_\307_\237\301Y4\033\027\271J\240Wz_\2015f#9\234/\006*\263T\371\242G\3133\001h\227>\255\207\355\007m\203Z\2123\266\370\247\276:\236\320S \246`/\367\326\366\244\021B\244L)\257"
+	.string	"\234"
+	.string	"\251"
+	.string	"=\206\240\277\3678\272\017\017\003jS\351\207\225O\371\321\277\362j_\307w\034\335\352\203X\233JS\"\260\346\374\365\230A\371\021\347\001\310\217\342i\310\217G\266\326\177U\36355\205)H\2309'n_x8\034\016E\322\032\214\021\204q\361w\227\342\321c\260\362E\216\342\312f4=\362\237x\217\261\200Bq\030\223\2269.\240\242\376:\261\244d\r\023\037\305\327\022\t\031\307\342\204Bl\320\265\225u\3405\304S\222\212\261\032%\276"
+	.ascii	".\023\360\231F\235\266BE\n\2626\347<\013\247\023\242\276|\346"
+	.ascii	"\234\326\246'\250[\346\366\027\330\236`\217\020\002\344\307\033"
+	.ascii	"q\220\2509y\367i\323D\360\221\300\036\370\030p\211\225%\025\332"
+	.ascii	"?\236.\225\375_\231\332\362\363\266\260wV\255\363!w\016\316\315"
+	.ascii	"}\3746\007\362\327\334\352'@s\263\375\352\256\251zFT\313\210"
+	.ascii	"j\332\252g\253\226\251:&\252a\242\272\\\365K\325\244\250\036"
+	.ascii	"E\265\250\352\025\325*\252o "
+	.string	"\346\273R\200kN\022C1\323\312\2305\343C\376+!>\221!\016~B\315\203\320J\342\"\241\374\370\003-\263}\345`\311s*\257\246\252l\3159y>:\202\275@\034\204\2025\347\fv\206\235\322\362<\256\315\222wrqG\333\212{\034RI\230\204H\343R\371_vX\355\316\376\344\020\312x^\333\0205[\203\305\370!EI\273|Ql\362\332\356l\007_\225\236\357\245:\273k\023\031\351\233\214\263\264<\353\332\354\356\273\364n\210w\024\362\253\373\236\215\007\230\302$D\322\241\313;H\346\254\316&\b\322\373\222\244C\327\266fs\366D\376`\313\247\245G#I\207\272@'KO{D\206\365\317\226j\311\355\303\3231\376\033Tum\321\226\312g\342\007\255ua\324*\361\263\254u\256'\212\304Ob\255\203\371?\0049\n\032\364\"!\243\235n$\0022\302\220\333@Z\020\n\372\331\351\204\200J\353\024"
+	.ascii	"m\b*\322\220\373\311Q\340\260\253pA\227\303P\001'\024\224\313"
+	.ascii	"\200\323\r\021\341\024\034\360N\003\320\020\256h\267\033\302"
+	.ascii	"\311~\363>H\233\364\030\360e\226\034B\345\271\313\333Z$mK\363"
+	.ascii	"\322\331\316\254\255\223Y\233\235\331\036\332\312\320V\034C\263"
+	.ascii	"5;KP\305\325\243\361\"\257\352\332\302\202Qy\335\320x~\223]\312"
+	.ascii	"o++o{\343\205\246\261\265-\004\301\326fc\345\302n[\356\263\244"
+	.ascii	"\270^Ke\255\3421b\304\231\361\334\366Z\007j\333\327\r\f\331s"
+	.ascii	"\333\342\354KH\001{\276\230\222\033q\250a8C\021S\206fd\224\264"
+	.ascii	"\005Ic\260\002\0312Y\007\022@FI\307\245\231QPZPV\353l\006 \371"
+	.ascii	"\20293.\256\0245\244#\357^\350\232H\375!0\276=\213\020\303[_"
+	.ascii	"B\266OV\037\020ld/`\321~d\212\323\316\033\230\023\002\222\033"
+	.ascii	"\363w\024\355;g\036\006\250tXC\263RH\2400\204\312w=\001x\n\254"
+	.ascii	"\341\304\316\243R\337\362\252\202D\254\001\"\232\257\214\233"
+	.ascii	"\021B'6@\215#\324\377\376\312q\266$\246\236*\262\314\033\222"
+	.ascii	"\257\021:\363\033\326\036&\315\326K\237\273l\rl\023\223\322\344"
+	.ascii	"5\201\334\321^h\2252`A\323\377\250h\277F\267k \006\203.\203T"
+	.ascii	"\036\020X\274\226g\0060\252\264\343\215\305*\266\377\nb_D\n\331"
+	.ascii	"}\375\200fu\340\rK\367;e]\202\037E%2\230\266\246\276\377\001"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveWriteGroup.9.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\020\007\325%"
+	.string	"jC\234\016G\200\234Q:_\326\273\005"
+	.string	"(M4:\207\ttr'.\235\245\244\345\242)\3710\200,\024\261\262#\360/\304\232\240\374\200xd\373L\3313\263\210+\307J\331\rXC\277r\252\037\016\r\3732\330/\371d\023\271\223\f\330"
+	.string	"\310"
+	.string	"\321"
+	.ascii	"$\322\333\363\036\207^\313\267\020\317\245FZ\214J\267\200\025"
+	.ascii	"!\273\367\356n\031Dzktj\351\341\220\265\225\241*m\f\020\272F"
+	.ascii	",V\026^\231o\345W\210\307\272"
+	.string	"\361\241{\221\230u\335\253D\342\t\351-+\217Co\323\023\241\267\314D\3469WZ\335g!\262#\013\236{/\257\225\330\370\374\251<\323\232\370\233\255\226\322P{v%\362\267\216\240\311\330\021Y\374m\210\327\017D\211\222\252\266\003I|L\275\346u\233\264B\247\312\307\324\323\363'L\312\324\327D\t9!H-\303\336\365\n\205|\2524\033\224 Gm\205+7G$\220\237'\003\2523?\202\2209N\234\232#qnHc\355w\235\301\025\231#2\310+\r\303\275\227\353\021\351\343\374sf\236\303\314Bf4IaP\272\223\235\353\363\331\321\207Y|\f0\275\367J\34079\270H\233\334@o\337\264,\256<X8\352\031\263\262X;\031&E\252\213\033\t3\022Zyw\204VNp\255\337\300\263~\335\225\177\201s9\347\216\365\0238\363\\t\2563\316V\026`+\023\325*\007\260\225\207\322\312Bhe"
+	.ascii	"\266rPZ\031(\255\374\223V\276\325*\333h\225k\266r\232V\246\245"
+	.ascii	"\225\321\264\262\245U>\321\312m+W[\371I\267)5\013\306\356\355"
+	.ascii	"q\266\347~Y\246\2233\177\256\237\313\277\374\311|/&7\215\214"
+	.ascii	"B\327\230\264\362\244Ez0\374.\276qq3\313\025\212\364\266\276"
+	.ascii	"\313\267\370\346\345_\210_\316H\213Q\033\222Td\367F\005V\037"
+	.ascii	"\036\347\326\272"
+	.string	"%bl\235\240\215\212\332\326\367\272\235\302d\254k`\300X\325\322\2565RX\332\337\372\202,4i'9\202\031\024\251\033N\335\035\327P|n\242\270\256XX\340\030\253\331\317{\357\24558\256\221\0325sE\246\242\264f\263\346\3072\264m\323\332n\351\240z\252g\274k\264-\030\223\370\227\222N\354\336K\2019\304\323\214\270\005`e[\367\206\211\253\271N\371%Pf\023'\352\217\273N:\246\371\322\321E\036\252\017\363\255\024_\212\035\r\264\256\013t\256\317f\356\371\352\217|^\251.2\256\317~pugG\237\312\203\311=\263\235\244\272]\365C\031\001\213rv\222q\335=\304\362\306X\315\270v\367\177/S\373]WP\326l\251e,\230\200KA\037\323/\035\006\233|\300\245\337PX\213\361\242\347\264\004\214\361\033\326\232\230\234\202>\373\300\201\214\337Ph\207C'\337)t\n\016YX\366%\375d"
+	.string	"\233\204\275\245^\n\032\301\025.|\275\027+xL\300\036\f\236o\030\203\227t\304A\341o\310k\n\006\207\274\233\362~\310\027\216~\342\031\347\275U\027\276\374\311\262\352\031\013hf\r\265\b\004\372\201(Q\013\350\332\324A\365\244\341}\210\272\253\302\n\324\\G\020\013\320\314\033:\030u"
+	.string	"\0177\033\352Z\031X\025,\241ff\025\307\243\224\273\003\004v,\263\243t-\261:\021\304\204\372Zo\230A\r\240_\026\244\240\254M\225\333T\355\250\033N\272{QCq\233\027u\245b+\352\243F\231L\334"
+	.ascii	"5\331\330O\337\032\250O>\t\372\247mS\304\345(\351\002\200\201"
+	.ascii	"\250Q@\247\214R\246f$\020\t#I\2335\240\002\021)*\363\021\020"
+	.ascii	"1U\250j\302h\221\245\335\305X\002\315/\315\255>I \r\227I\307"
+	.ascii	"\201\230@`p0\026\032O\377\262\032^\224\303G\007\265\323<h\365"
+	.ascii	"\342\033\0055\021\267Jxf\3136\232F\307\2155:\214]\220\267\030"
+	.ascii	"i`\261\211c\t\256\2305\260\375\032\030\"\262^\231\363I\362m\033"
+	.ascii	"g\345\271\356\331\241\2630\324\246'\263\221\005@\252U\203\312"
+	.ascii	"R\202\216\260\2614\002\221\202P\213` u\337\223\333 \"\006N8\277"
+	.ascii	">\3412_\201^\3338\005\002\362\205\325\037\232\264\253\370\362"
+	.ascii	"'3\301B\253\221^|\203\210S\036(k5\030\233\204\263\004\343\021"
+	.ascii	"\261\363\262\365S/\230B\261\260\3136\206\"5\232\273@\366\006"
+	.ascii	"\241\335E\310xd\312\352.d\331>1\300(\323$\337\345\033\234\251"
+	.ascii	"6\006^\025\212n\227<\030\302F\326G\360M\022\377\b\201\360_\233"
+	.ascii	"y\301\320[E\356\354\030\235\n"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveCheapest.10.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\271\003\265\031"
+	.string	"\3460\246F\320\324Mc\030\3705\017DG\353\013\276"
+	.string	"G\373\224,\n:\342\265^\262\203\005\345+3\220\343\023\b\232n"
+	.string	"\f\356"
+	.string	"\223\226;\243\020\360\245P9"
+	.string	"Z\t\305\006g\240D\037\250\023\035\024\030\021\242M\366\226I\246\024\230"
+	.string	"\206"
+	.string	"\213"
+	.ascii	"\033\3142\347\221\022\036s\352f\252 \364W]h\030\216\301\323\362"
+	.ascii	"\244\016\t\267\262\355\b\262A5\347\214\r\360\013\364'\355\002"
+	.ascii	"\375\035EW\275^\257g\251s\301\310cV\270\002?\371\310S\367\230"
+	.ascii	"e;\262\244\304\320\b\207\322\200\321\017\020\036\"4B\276\204"
+	.ascii	"\230H\342\235\t\260\020\022\021Wre\363\240\244\202\013\222\013"
+	.ascii	"\252\246\236\354\344x\303\371D\360d\005\221\277\020\226*8\233"
+	.ascii	"\0340\347l\341~\342\355d\003IP\035pD\216\253\006s\316\306\016"
+	.ascii	"\270!\367\304m]\264\215\320\376D1\366\305M.\354\345b&\327%c["
+	.ascii	"d,\213\214]q,\200\307\252<6E\306\2428\266\365\330\223\307\262"
+	.ascii	"dl\350\330\325c\301\307~2V:\366\217\215\217\265\200\226\017!"
+	.ascii	"3\2739=\364\230\314 \337\223\n7\331L\255o\324NM;\033> \204\376"
+	.ascii	"\334\362\324\273\266\3322\225\027\366\b\205L\271\036Ss\316\003"
+	.ascii	"\376\372 \254Q\236\\\231?&\212\034\304\350\245\362\312\232\263"
+	.ascii	"D\217\307\234s\246\f\034[\313\360\f\036\353\002F\021\346\257"
+	.ascii	"\337\002\034\366\030\021\022\3139\347\004\237\253\235\314B\212"
+	.ascii	"\322!a\257\374\353.\277\265\b\f\273\314=\224\004\005d\344\023"
+	.ascii	"{\361{\316D\220,\335\220?jxy\032\215\037?\261*'\004\037\363\225"
+	.ascii	"q\370;\370\372\367K\0055\251sh\330\tS\324\033\356[Q|"
+	.string	"\314\177\003\265\220n\024\350\307\033\210\205O\354\025v\337N\226OI@\202\232p\210\275\357\240l\270?\327\352z\342\002\244\252\251\376\250\225\261\316\216\361\222\035\3005l\2307\256\351\330\324\310\032\216\r\215\266#[\325pvf\262\257\2463\223\311\312\022\330d\270\251\345\320P\240\221\240aVcAFs\241&\206sC\203!&\243\351\304\022\024\350,\307\206\026\253\315f\264XK7\275r\261HH)\2050\177yy\274\017\353\271\272>\330\250B\t\276\356\372\255\345+\257\241!\305r\224\267<\032\0012\342\201+g\2714\002\324\304g\302\212\312c\016 \345*0O\371y\025PN\036\363\026\353'\256\263\344\013\245\035\253\347\312*\372dB\252(\245x\300\260\337*?\227{\347\260HTG\250Q,\344\024C\n\325\210H4Aa\243\016p\002\231A\243\007\020`8T\rc`\310\304\241\032\264\002\253]\226TL\230"
+	.ascii	"~\240\215\0248\203\316(\006\245c\"%\366\323\206\233:\245>\215"
+	.ascii	"\356\305\235\250C\272p\341\301\300\340\327\3251\242\301\364\257"
+	.ascii	"\330\211\300\351q\007>\354\242\204\r\214\262\373\005;\331\221"
+	.ascii	"\331q}\214\221\202o\316\"\257\275Xa\004R\033N\236\244[\333\021"
+	.ascii	"\302\336\332b\310\372\002U*\030\005t,i\200l%(olE\211\342\362"
+	.ascii	"\246\353V\\\270\305\246\003\r\025"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveUpdateSelection.11.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"m\013"
+	.string	"\246VQ@ Q\224\016P\r\245\030,\001E"
+	.string	"\375\240-\265\022\311B\360\276D&\374\033\270\2045\367\373\266\217m%\252\355d"
+	.string	",\251\033?"
+	.string	""
+	.string	"I\220\244\360\251\001R$"
+	.string	"\233<\027\366\200|\262\267\224)\005@"
+	.string	";"
+	.string	"?"
+	.string	"\266\235@\001\310\334\275\020\036G\341\330\200\202d\327\273\024\304\271CM\316\007\320\205\016\255\217+<pr\361\021\240\033\301\312\310\207\031\027y\232:R\346\344\262\273\316R\307\341\216\267\355\300v\003\373\005\002\237\025\304~\352\2378\035\235\206\232\276\305\361Hh\\2v=\276\034\013#\266\030a\033dSlg\332'\361\020\320S\237\017\330\005)Y\261\353!0\003\353\321\336+\325\243u\002\325c\023\265\263\013\371\022T\250\241dac\304\203*\312\002\356\251\256\230\023/Hy\3036\347&<\013\374\022Z\006kw/\342\321\377T\217\327\213<O\035j\234BR\242\374l/\224\212\262\257\337\367\005\232'\333$Dg,\032\f\233\216\206E\300 h\3100\0232\030\005\314ea\203U\2702\033\347\262\030p\246i\266\253\223e\333E\361\366p\241\302\0071JR\250H\237\253\242\232lG\365E\244#\270\273\013;2\016"
+	.ascii	"`\325\373\"4\217\b'\213\221\017\321\300\025C\333z\202p\270`o"
+	.ascii	"\t\257\\\003\022\304\304i\271\217\306\240\366"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveSelection.12.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\215\n"
+	.string	"\266\324JA \213*\035\247R\bY\022\006(\330\020\016\340!\013\004"
+	.string	"\210)'q\030!\031\325\372B[u\267\373@%\003yiw\250\345H"
+	.string	"H$\00371\202\217\234\030VP"
+	.string	"\271\376rM\b\331D\312\224\0027"
+	.string	"6"
+	.string	"7"
+	.string	"\006O\311\036\267Od\217\266\255\261\001r\350 \003T\246J`jy\330\0059U=\364\f\371g=\"\200`\341\224\022=5\220\335u\236R\006n\275\355\013\333\037\3663\002\232\336\234\326\276\3723McXZ\261tj\372\020\021.\r\036\341.*|m\206\350z`\033dOlg\332\217p\t\240\257>\025\022[\252p\272\260\013V\334\261=\006oaZ\341\200\335\030\262TU\355P\340E\312\320\327\324\233>X\300)p\266\335\022\207?\341\363l\016\036\375O\366x\2454X\2152\264AQ\352\002\373\330\356\256U\201\035\033\217\367\215Dc,\231\001\232\316\246\023\351B\bx\027\022LWr\341\002h:"
+	.string	"\034\346\343p\026\f{\233\314\307u<\357\343&\340\336\326\324b\244$o\212\251\246g\235b\203\351\200\352\246N/\r"
+	.ascii	"`\251'3 \fc\262\020A\b\020\b\007Df\214p\203\322\006qf]\300\205"
+	.ascii	"\001\325\301\216\251\235d"
+	.text
+	.section	.gnu.lto_blackboxAdaptiveUpdateSelection.part.0.22.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\267\003\215\031"
+	.string	"\026\260\245G\260XQ:\001\207"
+	.string	"\341\364&Z\201\244\211\344\221:\335\021\253.\207\234\2276\301\373=\343\025\030ra\203\264\024\255\232T/\250\372\351\333\013#\231?\037;(\f\254p#ES"
+	.string	"\373i\031\030\271\252\372\023B6\221;\245\215"
+	.string	"\214"
+	.string	"\221"
+	.string	"K:\247\2360\016\331+\357|)t!A\005\312\352\002\311;\355\0079o\350B\202\036\240V\235\017\252\326\222\301\251#\214\247.\237\023\236\216\037\020\236\332\007b\007\017\204\220l\333\301\203!\023\275\274qt\2453\267&2\265\226\256\323\265q\242\207\024\334)\022\371\023\227+z\370\336\301\335\217*\270\\\214S\030\007U\254r\266\271`\316T\r.\254\\\nPA\322\224\027\357}\266\310\331\346\024pQ\254Pk\365(\343\036o\233\264\255\301\336,\001s\225\274\342\367\367\373\375\274:\333\323\254p\372&\234\2669\323\275\022\247k\356t\253\306\351Q\234\026\303\351\360O7\035\247Aqz\303\351\371\362\177\016\202\031"
+	.ascii	"\222j=\372\241\2514(\023\035\177\372\235~\246\257}\373C\204\374"
+	.ascii	"\246#y\317\253\247$Ij-\033N\265\331`\261\003\303\350$\364#5\267"
+	.ascii	"le\315!\325Z\213\334\310\320\217\324Z\266\322\300\016jiWk\275"
+	.ascii	"0\236\266\300\017\b\317t\"@F:\021\240VQY\217(\354\236\004\353"
+	.ascii	"a\327\345\3463\232?\327\354j\237\346\346\003k\255\2252i\261\201"
+	.ascii	"\001W\247Zq-\354\237\003\227$\265\253Dw7,ce*\314\225-\266i\306"
+	.ascii	"8S\334G}Tm-J\207C\031Wl\nW\334\215\372p'\263p%\204i\372\301\303"
+	.ascii	"\231\273\340\035\025\202k\277`\3638\272@4Vl\221\375&\344\210"
+	.ascii	"\263cg\302s\n\256\330\303\305\230\273\273Tn>[v\250\331Xk\205"
+	.ascii	"\340/AA\302\307q\352\007\205\247s\337\373\201-3tIAxF\363\027"
+	.ascii	"4\362\007&\333\211\321|T<=\262\035\022\326\023\033wb<=/\0210"
+	.ascii	"\321\247F\322x\250a\rb&d?>\257\235\027\210\023d\210\031\3545"
+	.ascii	"\"\204\253G\366\"\341\202\321J\270\032$0\351\023\243\271~H\222"
+	.ascii	"\346\232_\235\337\373\350%\f\217\256\226e\326\272\202\321\246"
+	.ascii	"\bW\311\023\\\360]\372\302[\235\327l\013\233\300<\226\353|d\365"
+	.ascii	"\220\"0qn)\241\316\301\2653h\230\307y*\341!5\013\355\r\237\242"
+	.ascii	">\214\220\021s\263UT{\263\034vcn>\233\2452\273\271q\034\030\272"
+	.ascii	"6\001B\250A(\306\034c\312\314\004\023\210\004\3216\351p\2429"
+	.ascii	"g\335\021\200\271\204\265E\225\354\0343\220Y\r3\021\317\327\201"
+	.ascii	"\345dS'\334,\344;\002\341\205\307~\302\275%Q\2733\254\223\317"
+	.ascii	"\b\357\216\f\263\312_CR\007_v\331\312\350\351\207\0314\211\307"
+	.ascii	"\312\222\024#H\307\021\b\323\325\335\365t\344@O\340\256\330Q"
+	.ascii	")\241V\325\267Rxh\324 \0040\267\013\022\004B\002\342D_8h\005"
+	.ascii	"\027\002\177\023G\226\312?\264\235j\261+B\032,\352\241o'w\231"
+	.ascii	"\350y\001\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`\246\001}\t"
+	.ascii	"r\31656P"
+	.string	"\215\322\001\244t\241\223\0177\250\233\201,\303\003\204\270d\321cm@\225\265Maf6;3K,1\257\300\217h?\001v\023\377\255\221\326r\2555!-m)\003)\241o\004\265]\274r\316\333[\231~\024b\332\320=,\251\366\233\351>\n\215\356\252}\004\345\272Q\237?\324 \267\371;\234*)u*e\336/\356z\207\330\373j\336?\232\036\204d\302\342\242\3078\250\267D\226~5\315\023\324\226\201\321?p\306\2019\r\334a`\200\005\016P\340+\201\261\020k\264\2733A \336(\002c\016\330J\023\307\250d\300\227\002\336\330\036\224\356n\002\256B\035\243\350]\327u\003\354\321\r\303\344C\200-\037\256l\307\330\035\231\234)R\241\020\244\324\311\303\360e\346\313\002' \360\002!\"v\222\363\n\317\320\316\301c\341\220\310\303_\242\250\325\316\202\225\031\213Adb^\032\232\033\224z\004\007p\004\007p"
+	.ascii	"\216\200\303\013\210\217\245\231-\214\302\316\b\310\210\216_"
+	.ascii	"P~\214 \336\"\302\203\033\201\357@\274Aw\025\334\366\270u\314"
+	.ascii	"A\035\003"
+	.text
+	.section	.gnu.lto_.refs.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.11b8475b5cc66ab3,"e",@progbits
+	.string	"(\265/\375`=\025=_"
+	.ascii	":\235x\"P0R\322\031\016\257\031\032\3317\0311\n\"*\232\252\210"
+	.ascii	"\212\217F\003\305\221^\246\276\337\372\306\300\214D\232\220\274"
+	.ascii	"7\032\202\365P9$\301\211\327\320\3420\317p\323\335\232!\036E"
+	.ascii	"\224E@\004b\032W\t\375p\334\315\311\311\354:s\266\333\265\233"
+	.ascii	"\224)\301\001\f\002(\002po+\244\352\302\372\362\272\233\005\013"
+	.ascii	"\026,L\260`\241\232\341K*\333A\277@Tf\256O\212@\f\352\215\352"
+	.ascii	"WP\017T{\326']\264\325\262k\212M\373\213\030\377\035\271z\212"
+	.ascii	"\016_\017|{\214\276\004\365\233\"\335\276M\221\036\004\325\304"
+	.ascii	"\372\244\337\263\177\305\026\313\2321\263[\254\273K\244YhP\256"
+	.ascii	"\372F\356\f\222/F\227,\350[F\"uzZ\373\013\002'T>0\372\253@\335"
+	.ascii	"^\237\264gI\\I\301\263\016a\242b\364\33700\030s`MF\027\210\265"
+	.ascii	"\262\353\321\366\253yr\350\302\274\3401z\bT\0356GK\377\365\372"
+	.ascii	"Wk\247\254\363\247\\b\366W\367:B\347\252\313\2253F\227\312\376"
+	.ascii	"\260\353\317n}\271\266\3537\311uuv\257<\001<e\375`T\305\372\244"
+	.ascii	"(\f\365[\345\002pu\214\263\372\375Iy\366'\375\272>\251\272$R"
+	.ascii	"\271U7\006\030VG\211\237-\320\273\371Y\206\177U\274\200\242\200"
+	.ascii	"\032\316\364g\022\377\345\376\r\300\205\377p\377\301\270\375"
+	.ascii	"7\373wg\221\376\0052\236\210\377}h\376=\272\001?\023m\214\320"
+	.ascii	"\302\277\036\030\235\347\347\005\376\225\200X\301\360_\rr\200"
+	.ascii	"\275\347g\003n\342\277\t?\003\377\277\375\217\333\025\212\216"
+	.ascii	"\363s\007\377\262\360o\t\377\222\360\257\215\177?\370w\203\177"
+	.ascii	"/\370\327\202\177'\3707\202\177\017\370\367\201\177]\374\253"
+	.ascii	"\300\277+\376\365\371\227\347\337\233\377i\376\227\375\177\376"
+	.ascii	"\237\373\377\365\277\353?\212\377e\376\335\377|\377C\370\277"
+	.ascii	"\367?\355\277\336\377\274\377f\376\333\375\027\342\277\230\377"
+	.ascii	"a\377\301\376;\377\377\374g\373\017@___\337\377\373\377\303\372"
+	.ascii	"y`\bfZme\352\371O\033\351\324\335@j\326vJ\312\371\326\354\376"
+	.ascii	"\374:\373\333\025\377\321n\006\246tW\021q\247B!C\036\271\212"
+	.ascii	"\276\224\356\343\210^\333I\351\224:*\275\276,G\254\035U\242\235"
+	.ascii	"T\255\\\245\226(\263\271\327\336NJ-[P\256L'\345\312<\366t\222"
+	.ascii	"y\354^\227=\312/\344q\225N\251\245\322\311\\\216\350d\037\333"
+	.ascii	"\211\214R\223\314\245\222\013s\331\243t\"\227\312\244\324r\004"
+	.ascii	"\023\"\254\362|d}\301\262;(\223\375\203\t\n\351\324\343\246\\"
+	.ascii	"\231=\327\275_;\332iE7\024\323i\016Id\313\222\334~$\211!\231"
+	.ascii	"\273v"
+	.string	"\367\t\246\244)f'\335\224X\314n\254$\034\315\344\300quk\253u;RA\365\322\216\356\001z\355f\352>n\273u\367\261\273m\234\240\326n#=\312&\023S\367\223\t\246\206:\232\355\350\346/\272\262\245\3229\305\f2\003\302\331l\036\353q\233='\345\244:\217[\275tFm.\203\230a\224\217kC\224}1zn\342^\276\0335,N\324\356\324-\342(\027\263u~\310!md\214\2569MMN\230{z8@d\331R\265\376\220D5\221\222&\317\246\311\235\223\"\214~\363\376\035b\321\254]r'H\232.9F\321^\037\022\351\336\005}\361R\2764J_\214\362,\2113?i\344\222\244\230\261c\035~\350\200\267ViG\253\247\020\213\266\204\212\022\243;f\311\354zb\353\276ev\3555\310u]w\364\340\232\3200\312KF\235\241{O\244\333\327\267'\350\304\240\260\303\033\026\243s&"
+	.ascii	"\b\213\313\363\301\3507\b\365\233%\210U\373\255M\033+SJ\267\033"
+	.ascii	"+]>\2360\270\024\321\\\333\262j;\277\356$}\315\356Un\3376\314"
+	.ascii	"\306\355\227\005\263\353\302m\333\267\313z9\272v'\273\3731^\304"
+	.ascii	"X\270e[\265u{\202\300\007\276g\367\372\355\372\203\340vl\317"
+	.ascii	"~[N\235\fY\262\260\027\335\327\023\247o-\016\314\223\26116\333"
+	.ascii	"\2365\211\314\224\247\r\226\035]\222eg\26329d\210\330!a\224\311"
+	.ascii	"\322%\030\030\213mi\376\2748a\"\344\312Y,e{B\2751\312ai\254X"
+	.ascii	"Q[\036Q\340\264\336\272\272\330\353\277d'Yk\212\351\363\"\343"
+	.ascii	"<{\241;\326-+a<yXL\276\272T\256R\205\267\226\253\233\326\352"
+	.ascii	"Iw\227\327\375\364SC\344\250\305\265\236\267t\356\330\264\366"
+	.ascii	"\354R1XQ5I=\364\300T\322\252$D\256\362jx\230Z\317\246\234\251"
+	.ascii	"\254Z\034r\215\fk\251^qhTZ>\344\360\025\371\261\356\2233'*\346"
+	.ascii	"\352\212\263\300@5\313\2148m\211r\316\342Zk\2161\312<\360\221"
+	.ascii	"\034\262+X80\312X\274\304\224\274\302(C\271\223\253\262{\336"
+	.ascii	"P\265\351]\215YYqS\355n.Mt\017\215I\223\016\347&\016\030s\214"
+	.ascii	"\217Q\316\201\221<eA\232p1\3128\034Mmzv=\331\247\022\026\023"
+	.ascii	"\031\243\354d\2378bc[|0\3127\354\363\211\313\\\334\232\321\371"
+	.ascii	"\241\031F\013\026\325\251\270j\237\372G&Lgeb\307\203\311\271"
+	.ascii	"\252\f\035T\2271\312K\370\210]S\026j\204\bK\021\341\250\264{"
+	.ascii	"Wf\223\323\323\023G\251\307]\262\367\364\203sE\213K\026\250s"
+	.string	"\024+\271\301\322\222\367d\224\2250'a\346Y\t#\311I\256\254\004\355F\356\036\260\263{@\r\032\016\310\256\024=j\203z<>\222\344.\r\f\037a#A4\365\240\233K\213\340\013\022\206\321\"\333v\363\226V\025\344N\375\017\313r\311B\270\355i\303YH\031\025\311\226!a\030\345 @\232JJ\334\244\366t\022\034\222\346\217s\323\030\274'=F\231i\373n\232dIcb\224\2276l\255\306\264a\371\001Q\317I\234<\327\260r\r\334\003\203\265\233lj #r\225\327ON??+\317=\216\226\323=\245\273Q\354<\235Y\264\030e\036\353\205\204\333\353\301(\357\260a\3532\245\204\321\343\035\r\025\022\306\241\360w\034-n\f\205E\343\021P\220\b\251hh(\004*\036!\001\tPT\2044\034\022\2076F\241`\f\302\243\364\005b\021\207\2218\264Q\001\030,B\215\301\243\034\301\034\351\013\0300"
+	.string	"\213\305\tl\314\020\232\361\002F\211`Q\n@a\0218\202\r\030B/n"
+	.string	"C\300\321\202\202\021\210\202\303\033B\033\002\fpT\004D\"\022\036\005A0\n\207\031\234(\"\022)\020\2521\300E\013c\021h\324bH\024\032\207\202EA\033A#\220\310H\204\004\214\302\"\t(p\030o\f\203\033\020\005S|\310x\0244\002\006q\3240\361!a18\f\336P\357\200\214\006d\314\320a\363\0314\\\320p\221~\006\215\240 \0322\202\324\313\b\372\005\205<  (d\301"
+	.string	"F!\031A\307\361s\242Q\260\bd$\022\213@89GBFH\304\342\005\023\2240\016\221\210C577\206B\"\342\3200\250\032\205f\330\034\005s"
+	.ascii	"\213*\244\306#b\215\"\3218$$\n\026\215tl\214B/`\030\207B$\365"
+	.ascii	"AA5T\210\300\301\005\352P\213\240\013B\243\021\220\b(\244\203"
+	.ascii	"\230\002\013C\300\242\024\200\206B`\016\240\241\342\021P\013"
+	.ascii	"\005\366z\360\340\344\310\023\275=K\223P\305)\031]w\322(Ox\230"
+	.ascii	"\345E-=\251\372\201FH\315\2161{7\f\321\244ce\212\312\215"
+	.string	"\361\270y\202\322\022\030>\263\323%\214\334\334\016f\322~brxS\354\3146\253I^\337sK\345\322\342\233\022\302K\251\n\032\2522bh\221\272<\257\2721;nU\372\254\030e;{a\3431?\271\234>ru\223\r\231\232\336]^+\237~p\266\224\266\336\344\316c\316t/b\274NJ\0249$\243,\346;Omg\3170<\367\337"
+	.string	""
+	.string	"e\2113\013\210\372\006T\256!\313%\243\f\346uXuKv\214r\334\321\236\302\344U1\334\257\313\024\\\022\243\354\306o\273\236\215\277|\347\214\007\030\233\222z\032\366l)\267\235\273\234%Y\"\305\350m\222\324\237\271\204\311\035i\362\251O\321\254\255\261YX3"
+	.string	"\265 <\334\320\3208\255\312\223\257\332\246\314h9\247\225\371\215\325\2651\001\013\201\265\250\261(\206\0344\"3#\"\222$I\206\003q\005\204\030&%<\017\022\300d-S\"\250DfH\222\222r\222L\007\357\232@\361\016 q2\r\361\005|J\376\240X\256\372\3746Z\2413q-\324\300\366\336\315\321\334\023\205\\\3218\2606\201\364\2523\251\037\373\301\343B\022n\311\352y\243`\331\024\273S\021\035p\253\211\370Gr\b\336\312A\004\321r\020\267\343\262\350|\204)\031\207\303l\236\356\264\343\262h Q\200\3121i\356\t9\\$)\230\\\327Sl"
+	.string	"\035Z\267\312o\271\031\363K\007\344a7\305k>\220\001\037"
+	.string	"\270`c\302\013+@\252\203/\020K\326\200\233\005\001\236C\201F\200\001\b\300\002\260\021\002a\003u\216\246\202\376i<\263\031\267\217\037\312\334\356LWd\245\241eL\341U^\271\037\352\255bX5\206\324\027$\020z\211\325\307\3660\r\230.%\376_\317}b\207\030\364d\314\241\004\201\300\256z\253:S@\032\r4T\305\bt\206\353c\026o4\211-%R\352\216~3\344\325\247\371<\t\256!e$\031\244\246KJ(3 W\304^\345C\234\275\n\302\254\342\351\356\034^\b\203)\365\243j\261\275"
+	.ascii	"\214\031\265-\224\245 HV\200\300\\\210q\360\341\026\242\021 "
+	.ascii	"XK\245\312'\213=\rH\"dH\"\3400\251\273m\023\233Jp\0327t7=#\366"
+	.ascii	"0\025]\331\352\200V:)\325$V)\224QWE\240\211<D\2240\355q\221\342"
+	.ascii	".t\2458\177\344\305u\220\341\340\216A\301]J\315\351\273:\367"
+	.ascii	"\344td\251\331y\3342\263\201?\217\311lux\004\266W\215=\333\373"
+	.ascii	"\336\242IL%=\2733#\247\202\200\r\3278\243Gua\341^t\004[=6\023"
+	.ascii	"\250\222\024\205\230e^s\311\376:\276\004\301\234RiS%I\345\221"
+	.ascii	"\203\365\370Xrt_\024\374S\f;\236\304K\022Q\204\315\230M\004\272"
+	.ascii	"\272\024\245\246\351\316(\252z\203\332\207x\313#\325\363`\310"
+	.ascii	"\210\265#\367\206\3468I\r\005\354\217\t\355\\\3640\225\2272\324"
+	.ascii	"\334\n\021\244P\364aU\312N-\356\214\332\005\267)\363\331\342"
+	.ascii	"\320\331?A\365\246\267^\003\223`(I\003\310\375\230J2l\370i\373"
+	.ascii	"\3435\037\032m/\351\320\335\3463\232y\320Ou\t\222\037\201\304"
+	.ascii	"\374\201\237m;s\003\311\210\333'\243t\303P4\364\033p\177D\206"
+	.ascii	"\232\">\003\212\t7\213\0269\353\250a\367R8D~ab\215[\230Q\242"
+	.ascii	"rLq\330\337a\215\024:_\035\b\372\304Y\236Qr\326d:\305\237Q\267"
+	.ascii	"\267O\001\373\300\003\277U\336\302\314x\370\3070>\344A\273\273"
+	.ascii	"\374e\340EqO\337\036K:\337\007\034\020{0\255\210\236\227\217"
+	.ascii	"A\315\273ni<l\214c\215\346\255\322\277\255\332/\350\232\277\377"
+	.ascii	"\323O\314=\265\314\301\231\264\264\225\005\003|\337U\3039\337"
+	.ascii	"U\003\313\271\356\241\226\302\317\365.\374K\377\243n9\275\367"
+	.ascii	"\307\2641\343\335\310\342\310\367b\272\245q\265\227\305\314\203"
+	.ascii	"\263\361\311\320Of\220\355\266C\306H\016\204\203\363\256\002"
+	.text
+	.section	.gnu.lto_.symtab.11b8475b5cc66ab3,"e",@progbits
+	.string	"blackboxAdaptiveGroupInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"blackboxAdaptiveResiduals"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"blackboxAdaptiveWriteGroup"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"blackboxAdaptiveUpdateSelection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"blackboxAdaptiveSelection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"blackboxSignedVBLength"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"blackboxTag2_3SVariableLength"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"blackboxTag2_3S32Length"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"blackboxTag8_8SVBLength"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.11b8475b5cc66ab3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1194 @@
+	.file	"blackbox_encoding.c"
+	.section	.gnu.lto_.profile.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\265\006"
+	.string	"\204\n\310\001"
+	.string	"\026"
+	.string	"\342\203\351\365\f"
+	.string	"\001\331\273\323\365\007\006\002"
+	.string	"\264\312\240\261\002\002\003\357\350\332\204\n\002\002\001\002\001\004\346\371\265\305\006\006\002\001\002\001\006\363\323\275\211\n"
+	.string	"\007\216\243\313\354\001\b\252\212\212\215\003"
+	.string	"\t\242\247\237\212\013\n\213\215\316\230\r\002\002\003\002\003\013\353\206\240\252\016"
+	.string	"\f\340\253\276\213\016*\r\245\277\256\207\b.\016\311\305\223\252\f\026\017\253\356\273\246\004\004\020\205\211\241\325\r"
+	.string	"\021\360\341\230\372\b"
+	.string	"\022\250\337\222\233\b\023\344\252\216\214\003\n\024\232\360\250\262\003\025\324\230\357\263\006"
+	.string	"\026\274\320\320\213\f"
+	.string	""
+	.string	"\021"
+	.ascii	"I\t\225\343`)\031.\3532\242\b\0036\340\351\031x\340\250\200\032"
+	.ascii	"\346\b\024\007\035k\266o*\261\342(\310\fp\316\200\002\270\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"-\005"
+	.string	"\342\204\017\031\2605\215\001\f\303\024\207a\030\346@k\267\331^j\"\"BK\232\2242\245\016^P)P\006\2701\321z\204b\226M\345OF\016\215/\366C\3309\364i]}\231\352\352\240\226\311\013\0013 \360\002\241\271:Z\013|/e"
+	.string	"\353\020\216\021\232a\2119\210\345n`9\314\\\271\231\200\021j\205S\303b\027\020\372\320\033\030\330^fl\217\212\b\211\301\026"
+	.ascii	"\332q5\244\305\336\231\001\263\317Y\322\300|/|a\200x\006%\326"
+	.ascii	"\200\323\341BFx\303<\234\2223\331\n'\222\367F\237\320\263\255"
+	.ascii	"/\336\020"
+	.text
+	.section	.gnu.lto_.inline.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375``\t\255\037"
+	.string	"\226m\235J\240\230Q:\n,RQn\037\321\272M\325\372\020\270\321\372:;\203i\317\357k\306\330\027_\330*<\266\004\217$\306S$\035\315\177\271-!\254\260\201\261\340\313\361r\274\034\027\312\301!\"\202\217\321d\035T\377.\031{K\231\002z"
+	.string	"\211"
+	.string	"\213"
+	.string	"0\266\001q\275J\367\013\233G@\\\217uZ\313\323\352\2324%5n\342iy\352\232\302\337\016*\342\313\367\314]w\253\316\345\231ggw\013\325\377\3055a\017\0209\342?OyO[5tp\3569\334^\231x\025\033Pq\004\376\334\341\312D\221\203N\277\257\271bi\n\210\363\275Nm\377\263\370\347\036\356\356\026\177\b\335=\373\371\177\013\357\356\367g&uw\313Os\227\003\001RO\260\340\234\353\271\266\330\312\024\206,\342\271\271\177\265\356\035z\221\301\343\351\024c\311\225\21170v\267\252\331\356Gpq\177\371\256\205\2303=\2678\247\341\251\312|b\222+1\006gR\214\326GlR \302K\261\034>R\256,\227q\336u\272\260y\001'\3437\212@3\352\006\\\202\371\252\366\372Z]\265@\\\213\232"
+	.string	"\204uQ\247\346Sc|\244\273mj(\357\257S\373\367\364\177\214\270\337\327\324\321\335c\315\034\347i@\\\317\34520\276\001q=\325\311JI>%O\311\030\333\212\234\232\340\234\222\345)\331\232\276\037\212&f\334\221\207#\224\212\017\366\317Y\221e\373\027X\221\203\226~cS\267\301\206\n\002\217\371N\033\"\204\276\355\360\244\004\365{\222\303\224u\177\256\245\2029\342\004Nj\236\031\001s'\340 >\206Y\350\366\002\036B\204\004i\300kY2\230&rQt\343k\371Z\356\260\222\225\034Pn^\271_wX\t\220we|}\355a]\2374>s\\\301d.\340<|c\005\022*\233$\304\210\222Mp\210H\260\205}<\234\210\260y"
+	.string	"\262,]\fE\263E\021O\326>\351\232L9\335\f\221\366\0163\335"
+	.string	"\316\310\332\r&\217D\006\233\370\272\315\303I;*H\221\257\265_[\263\241\212\320\304\231#D\023!3s\t\022\255\005\277\366}\246\004\341\355\303\313\2716K\231\302\360\244\376?3jF\211\245\234q_\270hj\261L,6\350\253\"\026U\204\247q"
+	.ascii	"D\267&'\034\345\316h\212\217\3463S(\200\250\250\361LhD\204fD"
+	.ascii	"$\005IA\322\001p\002!\232!2\017\022@#5\b\322\230\202\n\231@\202"
+	.ascii	"\251H&\032%\245-*\344\345\3160_\031\231B\326\205\030?@\235U\177"
+	.ascii	"\332E\201)\202\313pM$\002\00328\320\267\2409\302\370\006\205"
+	.ascii	"\243w\t@t\242\365\373\303\222\036\347y7\3413@~z\203cj,\377\315"
+	.ascii	"|\375_\352zZ\r\276\313\314\201X\3416\216\242\240\222"
+	.string	"\354x\235\312\340\021\311\332\321[\032SN\202\341=@c\205\203\313R\210\033t\373\200\220\031E\246P|\024\302<m2\006\216\325-\370E\031YeBH`\323\2231\230\226\036\362t\037\307N5\275\221\004\261\007\316f\031\232^/\222n\326\2722\36170\026\331\263\235^\235\200\365\272'm\364\3506\203I\265&\307t\323\246\030\025\304\2146\271 Y0\360\006@\f\002 \022@\236\262\363\213\217\217h\215fe\321p0\350\261s\255\316\277\246)\220<\023\300\302]\312\237\303\277\213\031\303\262\f$\333\322;%\213\326\351\211e\276\371\024\321n91\326WV\370\331NI\250[0\372\346\367\n\266\302\207\002\240\343\364\346\257\002I\334C\273\324\251\304$\023\202`\252\315[\324\236\376\236(\331\2749\340F\354-Q6\376`\001\375\241fD\354\t}\031>\266\317H\221\323\3602Nx\267\2531\211\375u\252\215\362I"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`~\005\355\f"
+	.string	"\"\317-/`k\222\0160d\0306\007\202\356\203\250:\331\202 \b\202\034t\340?\f\325\013\004A"
+	.string	"\001ac\240\240\340$\021\337j\177km \2104\231d$IHd\201)\254\2033( \200:0A\346\255iC\340\214)\036\343\2135?*\023\367\312\246\332d*2[|E\007\177\244[\303P\324N\304c=\366\246/\304\033z8\265\326\002\236\272\265%\214K\332S\317yFj4\223\t\205\362\255%>\342(\232\032\254R\217\276\213\034\341\256!\376a\362\326mao\301<\352\220\f\t\367\271/\354/\254\323\241R\357;\274\322\371y{U|U\223\005\350E\245\343\313\bYC`\250QU\210h\246\260P\031v\003P\"Q\320\234m\022\200c9B\201(\005\021\"\b\221\004\022C\201DB\031&)=\356\302\376P:O\360\213\215\346)\206\356\304\005r\313\277sB\204V"
+	.string	"T\231g\240E\233\327|\261\2002\027$\037I\307\236\222\305\261\326\324\366Y\333\t&\305\261\030\311\202\262\200\201\321\327\3001\017\307\227\001\374\236x \374\203\326\2125\001\342\365\370!\3405\026\320\246\002\3012\366\276\235\233\246\2151\310\264\255\377\2235A\370\200\003\370\327\364n\016\023\325^\260.\021wd\321\253\030I\331\240\016R\345\245$\f\372\314y\004\310\b\347\367z\032\227r\271hB"
+	.ascii	"G\221\2120\3302-\021\002\212R\332)\007\343\223\225\374\210%\345"
+	.ascii	">_XV\007\t\f\232Q5u~\200b\002\204H\025\300\036"
+	.text
+	.section	.gnu.lto_.pureconst.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"r\304\016\030\220+\035\377\307\bc\316ff\346\220\273\023\241\341\272\256\353\272\332\202\326vsM\351F\037\364=\323\231j.s\227\253\334d\"\367\270\306,.q5\314\247p\203\017\230\266\314l\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"M\005"
+	.string	"\322\305\025\"\240)\303\001\377\240~\017\245*xuE\215k\031\030\316\202\2059\261m\345[+\277\355\266\367\336D\312\024\273\306C\221\3369\361\252\334\206\350\344y\221\307\303\r\203\206[ \f\230\005M@IZ\331\200\306\325\231GV\242\305\342\034\354\343\236\243\362O\024\362vg\365\204\004\" p\202Cc\267\001\224`,\004\3167k\244\254@\006.\002`\276\214\350\273f\336\301\203\2367=\024\013\036\3756\004\017\035\365\204\035v\017\246)\301\013 \237\212\270\213\225\216A`\311\354\230\333\266\005\"\251\3406\346"
+	.ascii	"\213\362\003\221\350\241\024\001"
+	.text
+	.section	.gnu.lto_.lto.3fe94acabfe122d4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto__putc.14.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\265\b"
+	.string	"v\321=70\345(\035\2363Fc\345e\f\2260\363\311r\243AT\022\034\365\f\364F\264\026P%\376-\217\331hG\276lA\241<\250\302M~\t\260\244\310\003m{\322\244L),"
+	.string	","
+	.string	","
+	.string	"\3168\036\3208k\327\302\370\205\034\264\262J\211\371\257%\210;cW\033\305\001\254V\312\270i\370_d\2658\334t\333\203\266\240\266.\001\207e-\"m\335i\233\330&(t~\030\315\277C\345\365\337S\006c\353\022\233t>\351\213\005~\027\311\353\177\236.p\234\365\271@\023(\0134\253\006\032\231\252\023\323\231N\007\226U"
+	.string	"\025\306\332\227\302\364h\235\371\377\246\253\365\2633\261\230\301Z\323\371 \210\375\0331"
+	.string	"\001\233M\356\366\211(\221 \270\2554z\270\340D\022[hB\244\225H!\nm;\241\264\017B9\323\350\244Up\334I\353\274;\363t5\033\201\2512\243\033\304l\003\n"
+	.ascii	"`\251'\023\372\374\002\213\013\316\313\250\340\032\373*\fVP\241"
+	.ascii	"\307\035^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxPrintf.16.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\315\f"
+	.string	"\366\330YC"
+	.string	"\2216\035\030\366p\265_\030\241\376?"
+	.string	"\276\244FH\335\362\027\020l\2752\276\313\034\357\034\023\241[k`\205=\004\207iMdae#\374\377\337\213\321\006\277\034)\323\214^&\007\237+N\2266\221;\245D"
+	.string	"E"
+	.string	"F"
+	.string	"\002vI\341\313\356\307\300\r\252O\177\225m\237\305K\233MC\302\311\204\342\006\n(\263\273\027\202\023\240>\247\017\240>\365\304\267\313\315?\370\004.:\274\024\356R\323\331]K/\205\304\255\267\255\300\366\003\373\036\0025p\250\215oG3=:\2309#\305Y~\373\276\313C\333r\311[\2542bTJ\273k\225\330\326\347\355\315\007m\331+\207\261\235\305\244#\3720\255\310!\356\216\330|\332A\365\371\002\227\366[\334\305\366\217\303\003"
+	.string	"\344\344\021\243RR}\214\020O\265\333\335\273\356\207\"\037y\217\322\207\217"
+	.string	"\002f\024Q\224s%7\177\313A\f\006Bx\366H\006y\317\027!3\212'\312\331\237H\252\t\373\323*\311\236\244\251\177\277V\007^\354\b\230\006I\362\251\240\3168! \017\005-\003\201L\330\240}\210d\230\205\217\013\344\301>W\026\032\2718\013\254]"
+	.string	"\t]$\232\026\272\254\257\373\264J\262mJ5\243\227Q\354Td\223i\267\004\004qE\3168\200\3042\360s\244b\024;(\347\022"
+	.ascii	"`\251'\023z\342\243\341L`@b\\\220\257\325\351_\355\222`\255\353"
+	.ascii	"\302\310m\263\235\r\006l\312b0\204O\221\203\273=\252\225\216"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.17.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\340\001\355\020"
+	.string	"\246\237oF\360\322f8`\312\035.\334e\331l\rY\376\300\307\307\313{\017\251=\240\251\005\207B\255%\333\240I\267\020\204\254T9^\312\370\357I\230\\\301&\037Ok]\032\001\327\327\226>s\253Y\020;ro\262\267\224)\005X"
+	.string	"U"
+	.string	"b"
+	.string	"[\203\243\302\203b\334\30519\347\024\323\271\037\020\213<x\332\017\372\215\327\205F|\300n\017\222\216]\361\304\fL\347,\276@\351\234\351$\245s~\331A.\302\330\023\335\330\304\206\354\356\247/\376z\276\374\307\016 \314\231yv)\273\353\fsT\334z\333\nlG\260\023\f\371\320%?K\033I\350\214-\322\244\272\260\277\355\356Z{\354-}\272\370{\027\372\273-\255[:\267\364\t\004\260\261\263\202\347\204\376\0207E\215\bl\306\355\220\361\242\337\276\217\3432\333s\314\215\334\340\206\310N\320\356z1\266w\356\217\331\363\207N\364z\221\314\003\246\260\222\017WJ\347\256\035\013\0364\035X\326\334\345H\t\220\217\201\264p\341\261W"
+	.string	"\322\241\215$\251\301\323\347\300\220\301\264\013{\370\335\227\261\240\362\341I/\273\212\211\031m\264\321\031\013H\223\337\3501\025\202\233\320vY\235~z\320\306\022\016j\214d\2476\013\244\221\2404c\326\245e\367Q\311~\001\021\250\020\t\303\342\240*\026\252\2659\205\342\322Zm"
+	.ascii	"S-\025\213\b\260\245C\n\345\241\345k\255P\254/\345z\371P\026"
+	.ascii	"\030\374\240r}0 \350\372<\021\366m\265\307\022\222f0\245\261"
+	.ascii	"\314\266\333\002\302\213\376q(kVMz($\365\252\252G5>'?i\352\006"
+	.ascii	"\244f\207&k\366}\034i\202\037#' p\202\021d\306\003 \352\215B"
+	.ascii	"\333\033\203\351\305(\020\327<\202\f\025i\216o\25401w\205\241"
+	.ascii	"Q\032\027\216/V\323\027!P\200_^\001\234\275\325 k\223\201\007"
+	.ascii	"\313\265\036\327X\356\n\235\007L\255k\306\230 b\027(H\024\334"
+	.ascii	"\343\230sh\216\2035\"\300\243\200\227\027\355#\003"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.18.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`3\001\235\r"
+	.string	"6\332\\C \217\223\016\345\331\362g"
+	.string	"t?\b(s\365\230\340]\366\324\204\001\3376\240\251j\232\304T.b\177\333\326Wa\360\262c\265\231n\240\305@\020\0304\220\363\017\261b ~d\031|\303TD\310\336R\246\024H"
+	.string	"G"
+	.string	"G"
+	.string	"\006\331/\236b\331\267\214\340L\310\330\335L;\030&\350\021j\202\3744\261\350\274\320#\274H)\0366<\022\374P\311\274\034\365D\361F\tA\224\256G\035\206P\211\321y\245\347\245`w\235\235\207\341\266n;\3046\002\373\\N\205\362\203E%c\345`o`Z\203\375\364_?\335Q\323P\323\232\351\314\3647\256\f-\006\270\330M\371f6&\276|\300l?\355\223x\t\320O&\006\260\273\001E\212\335\224\001\037\320x\344\270"
+	.string	"\353\021>\200\365\030j\230\227FE\361w\023+j\207\205\031-+NR\005ww\241\257[\205\025\025\323\004&\227\n\253+Um\222\222|g\216\023\r9U\365'\276'`]S\317\225F\3719\352\225\201\312\307\255D\371\251\013\f\311S]q\235\222\021\316\204h\315\303\201G$d\323<\235\006\0246\220\007\032g\004$\363\210p d\332\207$\363(\340-B\347\223I\330\266O\206\245\366\020F\335,\320\020#\322\221\257\204\032\205z\324;L0\334j\243\032uv0D\371E]\361Q\327\230\021qA\261\031"
+	.string	"`\251\2473\020\216\315\315\276,\206>0\222^\314\353\030mpV\241a/l\r\325\022"
+	.ascii	"\205\031f\243@D\313\035\026\323k\261r\261\226XM\t\356\305-U\252"
+	.ascii	"\226\201z\331$\314'"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.19.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\345\007"
+	.string	"\202\21777@s\322\001\030L\3023\242\360F11\020\371u='f\007\240\276\234\032\203\200\302\361Q>\203X\372\220'\200t\254~\364.l9\246\201\255\204\355\335\032\355&eJ\001\230D\311\232\200\276D\f\031iA\2732L\241B\0335\\Vi\0243\222\345\020\257\315\024E\004\326\036\260-Fh\332\026A\337^QN(Iah\206=y\265!Ly\317!\230\2526\205E\336\273f\313HJC;\373\353R?\354svw\255(\373(\277f\372U\207dF\340e\227\343\306fS0F\004d\373i\337\344'\334Q.\374\331\365p\201\331\335\002\033x\016C\017\250\0169\007\250\016\315\3314\377B\366+2\033,5\273\033\025\344\334\223\363\237\362\217w\352\236\035\204\335uz\247\216[o{\300\366\201m\225\n"
+	.ascii	"`\251'\0230\203g\304\005\003g\030\001\243.a\021\253\321\340."
+	.ascii	"/\332I\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.20.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\307\001\345\020"
+	.string	"VaqE\360\320&\035\362WXr\203;\237\024\327o\357\032\363W-\275~\312s\f\373\277\036\360\241\346{3!\306\r\225\254\337hfG:[\021-\3013\360\f*o\026\344\253\326\031J\222\027._B\255\251\265\275\245L)\\"
+	.string	"\\"
+	.string	"Z"
+	.string	"N\220=\272\373\200\320cv\001\241G\263l\031\357j\366\261\026-84v\267\244\032,\372\276\357;\354n\230\254G\250\311\362c/"
+	.string	"s\361\342R\036\241h\345\205\003\007\267\002C\202\200x\356=]8WB\0171\327{?"
+	.ascii	"\363^\\\314S\264`w\235/\016\346\016\335\266\005\333\r\354|V\230"
+	.ascii	"N\230>\207H\305\013\002\337\356\313gc\177\"O\207\347\374\366"
+	.ascii	"}\234\353\254n\302\312\315x\t\337\263\346\034\367d)\0272/\006"
+	.ascii	"\003hw=\036\315\300+[{\274f;\273\223`\375\306=\036\355f\250\261"
+	.ascii	"\263\273\037V\220=v\300\247}\021\037\301\272\r\312\003\354\316"
+	.ascii	"\300\330\331\355>\002\t\325\327\331(\344_\232^\347$/\304\217"
+	.ascii	"\212\246\330?qR\222m\360QBG\341\"\323\312\317\251#U=\013\bx\257"
+	.ascii	"\b]S\317\362\301\225\237\243^\357=b\200\245h\271\321\312O\325"
+	.ascii	"\363Y\341Ti\354\316\225\017\251\t\002\262\316\3301\255\221n\363"
+	.ascii	"\217~\363g\317\271c\246\3413\250\233\244*l\247\2702\251T\246"
+	.ascii	"\350\023\b\204\024\352\301vJ\21588\331DHN\246\b\"\245\024\312"
+	.ascii	"$\241tR\225\224@\fx\2330\242*\231l\233\252\244u\255\353\214\037"
+	.ascii	"{\346\371\374\264\324\025\225\306#\031%\251\306H\217Gu\3114\352"
+	.ascii	"mb,T2\350pw\027\032\301\243\222``\036\013\f@j(\222\374\313\035"
+	.ascii	"\243# `\002!\310\214\007`\365\304\300\276#\353\026}\266\226\313"
+	.ascii	"\"9J\306Qn\234\266\266Q\232\231gnrM\007\314Vf{@\313\366UW\261"
+	.ascii	"|a\2635W\0270\304\b\302]Ia;\342\250{\3310M\244\025\313\322.\343"
+	.ascii	"D\246\031j\343}\211t.\361\004"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.21.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\326\001E\021"
+	.string	"\366\341sF\360\320&\035\332\207\261\300\243p\205\276\223\222z\"\321\253\226^w\222\305\220\177\352\353{\346\302Z3!\306\r\225\354\347\212\325\361\312^\205\221\262\211lB\356\017S\241,x\016\242r\030{\2706\265&\215l\"eJ\001_"
+	.string	"^"
+	.string	"["
+	.string	"\337\207\031l\217\376n@{\334^@{t\313\216\361\017g\037\203\341\262ccwO\332\301\2430\f\303g\337\235e\3531\323l\371\261#\250\t\202y*\217\331\210\005\346C"
+	.ascii	"\217%\013)\"\3729\370|\361^\231\205\220\271\036\274\002\232\020"
+	.ascii	"\346\311<G\016v\327\t\363bn\355\2663\330\206`\347\200\326,\235"
+	.ascii	"Y\372\002F3^\034\250\261\013\023\336X\241\370\003\342<\277}\177"
+	.ascii	"\347=(Wa\365n\224\330\335\247\360As\3461\320\246\242a\003c2\210"
+	.ascii	"v\327\343\321\017\214bs\217\347l\347w\024\255\353\030\310\244"
+	.ascii	"]\0168|v\367\303\r\266\307\216\354i\337\304O\264\236\223r\002"
+	.ascii	"\2736C>\273\001\357)\351\3620\223\276\347%\220\204\320\212\252"
+	.ascii	"8\323\250ga\177\305\211\205\315\203\237\242\375e\306\245%U}\313"
+	.ascii	"\210\274[h\327\324\267\210xehM\257\007\0377\324\200.9\\\031\252"
+	.ascii	"\202A,\236\352\215\375\275\362!8EDV\033[K\233\270\347\374\245"
+	.ascii	"\353\374\244\363\334Z\246cLg\317\252\233\2540t\251\210\202b\261"
+	.ascii	"P\321)\020\222\225JB\227Z\215D8\351D&\244P\024DN+\025\252\344"
+	.ascii	"\224b]8\201$pWa\204u2\351:\326\211\373\\W\033?\366\r\244!\344"
+	.ascii	"\322W\324\033\223f\224S\035J\217k\372BRM\237\023s\261\222E\317"
+	.ascii	"vw3/\270\246\\\fM\330B\003 M$\252<\314\035\245\214\352$ `\002"
+	.ascii	"!\310\214\007`\365\304\300\276#\353\026\325\266V\317\"9\n\311"
+	.ascii	"\242\b8\035\336Fif\326\334\362m,\263zpK\300\345\031\367\301V"
+	.ascii	"B\256\032\n\310\3034\213i\335\222-[MvK\304\021\367\302\360\233"
+	.ascii	"H#\226\240]\306\211L3\324\306\373\022\351\\\342\t"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.22.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"E\t"
+	.string	"v\022A90\305*\035"
+	.string	"\231\323i\026i,\243\215\310\n\355p\306\320\341M\213R\006\273&ZC\263%\026f@\303L\013\341\322P\302\031d\225N\034Fs\240b\256]C{\023)S\n."
+	.string	"/"
+	.string	"."
+	.string	"/\200\177y\002\370\347\316^\371+d_\022K\231"
+	.string	"\330\335\250 \357\236\235\177\327\003T+\323\363\302\260\273N\325\212\343\326\333>\260\275`_ 0\323O\323\232\226\326L\247\246\237\311l\250lXv5f\261\205=\024\021\333\327\330\316\264?r\222\356\255\013\277]\017\327\311\356&X\001\3637\020w\n\204\252\272\t\220!C\345\314\227L\265I\245\274\312\006\030j\3625\365P\257\231\216\226\224\354\2243\373eJ\375\260\257\355\356ZY\366[\177\237R\250S\361\274q D\240\007n\023}\034,8O\304\326\ty\242\b\324\221\210\333\210\0249\b\346&>\243H\301q\243\250y\355\225\345\206\025\354\244(_\362i\372T5L\f"
+	.ascii	"`\251'\0230\217g\340\002\277\225\034.o\034\252\367\300\304\253"
+	.ascii	"]\006$VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.23.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`y\022\245Q"
+	.ascii	"\352\213\330\035L \324RI\007\201\374K\342;\274\340\202\034C\007"
+	.ascii	"\335\254\017\206\237\322|\274+\217\324SE|\363a\b\337\017cJY\356"
+	.ascii	"s\2168eq\003\316c\311n\035c\316\277\363~\371^\034=\020\343\n"
+	.ascii	"\312M\374\214R\256Gk\215\020\222d\222\001\316\001\224\001\321"
+	.ascii	"\001\344\252\022\271\232\364U$r\365\210\\5\"W\213\276\n\374*"
+	.ascii	"\021\271:D\256\262 W\205\276\032\364U\240q\3657\256\372l\306"
+	.ascii	"\332\033W\313q\225\374\352\350\325\357\352\356\252\255\002T\036"
+	.ascii	"\265-D\025\216\0077W\310\3633\351\220F\200\261\032[\b{\3166c"
+	.ascii	"\237Y\003\234c\\\326\204\031\202\310\0306j4\3524sj\0275\0067"
+	.ascii	"\315v\260\325q\263B\210\317\344\035g9\r:\243vQ\2779\327\264\260"
+	.ascii	"\221\300\007\347 \300lF\355|ae\276:*my\346\234R&\225\001\237"
+	.ascii	"\311\250\321\253j7\227\001\363\233\227\213\346\244!\016\2339"
+	.ascii	"\341\250\024\207\317\244\3029\2514\351\363QiR\025L\365\216\341"
+	.ascii	"\272L\313a\021\312Y1\347\264:\227\247$\275G8\353o\004\363\213"
+	.ascii	"'\247&\027LK-\224\222\220\216\214\212\200DC,\204\202\240\200"
+	.ascii	"~\276^I\216_0u\f \360\310\314\302\374\342m\r\230}*c'<MN\270\210"
+	.ascii	"\223\003\323\017.m\364\254\235\271yi\314\017%\260\254\255\004"
+	.ascii	"\3169\311\214-\326x\335\350\270\375\260vV\306J#\360\313hCm\223"
+	.ascii	"zW5\234y1\322\221\021\0167lQ\357j\355\214\315@\033\304\224uY"
+	.ascii	"\242\030\306\250!\fCL\031\333\016\365\256\260 \363r\020\352]"
+	.ascii	"\311\271\007\361\n=kgo\016\362b( `\330\342\265\262\027J\241&"
+	.ascii	"tHS\030keo$\320\bL\033m\354\320Ll\1770j8\323b_o\214R\242,\213"
+	.ascii	"p\313\315br\310,8F\3159\203\314\250\3548\356(\323f\303\220\331"
+	.ascii	"\330x3sw\026S\226\266w\032\327`\253\343\306g\355L\213\267w5\347"
+	.ascii	"\324%3;\263FYu\247\252\016Q\005\276\020P\300)\222\026\274\203"
+	.ascii	"\017\221\234\311\275\205m}S.\362\037\017\362\345.X\205\276\211"
+	.ascii	"\203V\246w\242\336]\345\357\376\262\277\273\205/uA\265r\255v"
+	.ascii	"e\221[\360!^\366\004\2530\017m]\256 \211\334U\372|\276K\361\202"
+	.ascii	"'\250&\266v\362\024Q\305x\242\362pWY>J\\\022c\333G\243\334U\222"
+	.ascii	"/\357\240\332\311?\na"
+	.string	"Q]'\205\004\037\233\332\353\036\246\355\265\376;\270\303h\205S\372{\007\305\210m\236\"\271\3574\226!\006/\016o\2568e\363>\347\f\373\211\252pak\263\260\302\227*z\032T\261\\\031\222Y\371\252\2538\314\023\354\313+\005\024\276\n\345\253O\276\352d\\m\302d\\\035\341\253K\374fk}U\204\257fY\215\025\313BX\223x\316\212\344\210\221\017<\360\031k\021\237\261v\360U\016\276\272\301W5\370j\006_%\362U\f\274:dW\205\354j\220\257\002\371\352\005_\265\340\253\025|\225\202\257\376\370\352\004^\225`W}\354j\217\257F\360U\b\276\372\200W\035\330\325\006v\365\352\253<\274\312\300\256.\260\253;\276\252\343\2539\312U\005\310\325\004\310U\034\343*\002\343\352\001\343\252\001\343j\001_\275\341U\002v\325\306\256Z}\265\352\253T_\235*W\245\310\325\032\344*\rru\306W\007\370\252"
+	.string	"\345\252\fr5"
+	.string	"r\025"
+	.string	"r5\306Wa\220\253Q_\205\372\352\213\257>\221\253N\344j\023\271\352\342\253L_]\"W[\004\007\334;\214\311\013\252M%\221V\004\321\211]\245\001\367Z\234\234\261\355\323U\026p\003n\274\200\217tu`[n\330\270\326\t0\235\255n#\311\255\236\343\t#\367\272\207\260\214)\354\342\360\320\370q\343\306\303\fCX\366\270\352\306R\247j\216\257X\316\243\01628\217\352\276r]a\026\252{K\333\335\224\324\247j\\\352\006\233\346*i\274\006\017s\2253Nc\200\317\030\340f\323V'\307K\204\031\013\001d\\\200"
+	.string	".\003\200G="
+	.string	"41(\034\343"
+	.ascii	"\300x"
+	.string	"\214\227u`\274\244\203z\324I9aQ\t\2778\324\035\364#\306\304\213\033\r\314\236a\032\320>9\375\311\\e\323\235>\022\231\253t\361&\246\273x\311t\263\001\203g\230\006\307\253\206\217\020\320.]\325\311\326\232L\243\306\036\246-\276t\323\t\213J?z\2137\375\021\242\335\\e\322\225\220\236\364'&\204\305)u|H\177\2223\372\320\217\276$G\210&d\256\262\350F\300\027\031\t\023\035\370&:&\276\302\214Dg\212b\230\306\342C\037\377\220Ia\303\\\245\320Y\334\302,A\027\272\205\305)@\017z/\212\240\037\261\2570@\267\021`\356\206iv\343)\350\204\355\237\240\023\347\330\373G\355''\334z\200\032\177E\336\006G\205S\331\203\017\351h\225\3369\2326K6g\022j;a\2258J\345'\314\224\341\215N\351\035\337\234a\272d\223\n\2370sN\032m\324j\276.\263l\302M\032&="
+	.ascii	"R\243\207Np\213C\240\023\365g\307\307\304\207\034\035\222\017"
+	.ascii	"u\364u\3606a\335J\271\310\207TFr\253\026|\210\2633\266}<\316"
+	.ascii	"9\347\357Du\032\377\352\310y\353\375\270\216e\221;R\354\273\021"
+	.ascii	"e\313\004%YM\262J\370\225\220\305\325\004\353\204R\225Ti=Y\022"
+	.ascii	"\302\226\222'YH\244l\201\300D\tV\023\020\254\236,\301rb\245$"
+	.ascii	"J\tVU3t\013JV\024+\023\266\266\242X\005\301M\237\006\005\302"
+	.ascii	"\207\316\224\213\251\357\312^\334\340\204\302\311\033\224\244"
+	.ascii	"\214\365\241\327\330\212\314)\205\353\250\324\373\021\254\373"
+	.ascii	"\316\323\221\247\360\236\\\2608e\254\243p\357\340\206\027T\243"
+	.ascii	"\313\263\177\326\311I\223;yoi\2047yY\344\340#\024\247p\260g\311"
+	.ascii	"\006_\242\305\032|\2037\032\340\021!\203\213@\344\031\274!\202"
+	.ascii	"\227\205\301\263\276\336` \344Z\037\022\344B\202\314\031z\250"
+	.ascii	"\316\256\251\n\220\273\n\360\202\003\271\340N{\233\203R\301\241"
+	.ascii	"\354\231)x\005w(\310{2\301\237\334\231\300\307\265.A\217\373"
+	.ascii	"\350\261\307\212\207\352\310\270 \213\340&\363A\360\bN\322\005"
+	.ascii	"\213\020\314\261\362\300m\345\253\317\003\r\\\353\016\\\275\201"
+	.ascii	"\253;\255\314\235\320Cu:0\r\217\340q\017\247\360X\340Zg`\307"
+	.ascii	"\027\300\372\216;\315-OX\244b\242-KW\264\312\016\231\332NN\025"
+	.ascii	"\245r\263AE\232B.D\344\231S\307\311-*\225\217\\\307\275\306c"
+	.ascii	"\321\r\2170K\213$#\357}\230C\201\347H\340\n\\\231\253\304\361"
+	.ascii	"\004n!Z\3578H5\267:\245\0235\250\017\222\303~]\250\370\002e$"
+	.ascii	"\234\004\351\203[\316?\266)\212PR6\262m`\300!\316\216^\205\355"
+	.ascii	"\037\357!\352q\223t\242v\2419\372zW\rF`\357\n\002=o(\250\270"
+	.ascii	"3\344\365\017\252\234\344\016\273\337\306\334!\235\350\365\257"
+	.ascii	"\353X\342\310\353`?\201\314]\220\013h\2200:Q{y\b\214\023\201"
+	.ascii	"\273\215L]P\255\310\353\236?\201\314\234\020M\t\f\026\033\200"
+	.ascii	"'\352\363\016\270\337\342\344\314\201m\250a4%\021S\246HFR\220"
+	.ascii	"\024$\315\001\201\005\304 \b\231\325\r\021@\245b\222\215\310"
+	.ascii	"H\n\n\322\006\026\221\002\321\037k4\241\303M!\252$9\177\353\267"
+	.ascii	"\306\231\226\357t\270\212B\\\021\037sOy\3643\3644\2661\207\n"
+	.string	"\313\253\261\"N\250\031\370Q\261\211x\226\030P\342\200R@\3449+\340\347V\365\347\316gV\307V\365\033\363\037\270\275\354\317\324\314\n:\256\"gd\254\376\225\227\361\276I6\030\035E\247\247zMaE/\370Y\370N\177]\360G\026i\375U\336\343\305\033-R\220\031\024\264\350\345\276\340\316_9\204\307\214\036&\201\002"
+	.string	"\270\346\221( G\370\270\214\023\233e\215\251x\375$\033U\224~\364'\212f\324v\374_\345JIsW\240\346X\364\361\177\245\004\326>?/({$\353\236\340\225\345\022\324O\036\244w\2663+\364Ga"
+	.string	"\001\243,"
+	.string	"]8\373\322\255:`\3244F-\203\264\0022_\003F\353\0237b\375<\2262\245i\233\013\244\031H\354\360\213\277\335\321jme\220\341,(\366\261\353\344\260Q \266\250\n|\017\022\3232\362\363\241\nP\367P%\311\335ylv\231\336n\262Iv\324\311\f\260\363i=a\252\303\017x1\344\355P\254A\376\364\260\032@v\372>\"\212\237}6\236\344\"\304\n\227\253\265I\316\235\203\362_\013e6z \351\230\t\372Z'\025\325j!\373\301"
+	.string	"\320\350\233\374\217d3\234z\013\006a\244\251\"F\342B\223n\212\\F\322\221\361\224\342\210\177\026\0316\0068\325\314\222\344\2200d\177<\203\213Y2\3259q"
+	.string	"\271\340\340\363\033L,\b\267\223\023\017\320(Y\211\370qu\304\016N\215#\260P\347\341S\263\267TEZ`9#\202\177%\"\336\005\271q\312\336\312\025\320\330-'\207*d\243\2222\376\3052DQ\352J\\\020d\253\244\242\206&%m\302^0\200\211\f\377\002-\031\013$k\235\016\327\001\255M\301K\373\236I\375\340\035\024v\257\316y\007\334\345\b;\033\005\373\313\fe\201\366\370\\"
+	.string	"l\361_\307\216Jr,\271\007_y\211N\3455\261D\234\256B\341f(\214<s\003\300\005\\w\257*.\274\264*'\277\363b\372\256\001P\"\032\035\304\245\276~\241\004H\006 \374n\t\345p\177"
+	.ascii	"JD\336~|E\217\3212\364Np\245\3746[p[qQ\f\371\274\320xT\252/%"
+	.ascii	">@G\246\034\305\331\370\370\021)J\356\213\300\275g\236\313^o"
+	.ascii	"\372\t\204\003\356b\f\372\260\251\377%'\177"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3SVariable.24.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\023\024\345U"
+	.string	"\372\223\\\037J \324RI\007\201\377\355\275\247\212w\2037\337\266\360\034\323?r\254D\2546\275I3\376Z\036\310\257Q\327\260\205(\223E\205WN\3178rN\375\330\177\316\272x?\374\226X\f\303\365\034\207\374\034jq(\216\326\b\331)I\031\354\001\236\001\367\001U\323J5\255.\246u\312V)[\243\246\025jZ\237\246\325\311\326&[\231\226\246UiZ\223\246\025\311\326\243i5\232\326\242i%\262u\310V\241i\r\232V [\177n\005\336\372[\272U\322\326\321\326y\353o\265\255\273*x\311\301\255"
+	.string	"\206\355w\346\312\266>>e\235q\210\033V\315n\232]\272\3353;U\367.M\2302b6\b];\rJ\343\343\210:<\200;ZU\212n\335\242\321\2403F\245\032\2302br,\235\356U\251\315\225X\276\326d!\267\265\243\336"
+	.ascii	"\356h\325-\263f\244\354\034\n{T\22604\321\246,\347\270\324\006"
+	.ascii	"pG\235\003\356\017+'Euo\316\311\200e\301P\021\242\311\242,K\257"
+	.ascii	"\252]\"w\234\233D\356\370\030\260\364;\347V\263.e_`]YUQ\271\230"
+	.ascii	"\222\312\202zrjbZRJB:2*\"\032\022\n\002\372\001\376\242\310q"
+	.ascii	"\336Rt\177`\223\2079z\330\260\234\355\013\274; \214\365\305m"
+	.ascii	"\315^5a\305W\025\304\006\007*\035a\356\250\360\342v\267.\354"
+	.ascii	"\314\220F\3042\244\021Q\315\234\272[\363\341\221\353\301\213"
+	.ascii	"\333\232\225\232Fr\223\006\r\316\372\201}q\313[(\253'\247\036"
+	.ascii	"xp\323\017\314\213\233\017\313t\203\r^\252\301\316\007+\365%"
+	.ascii	"\375h\201\003\322\027\233:rZxq\303\333#;D0F2\024\331!\266@4\241"
+	.ascii	"\340\342dY;D\270\231\205\304\013P\fM\031x\204\300b\355\020Y\230"
+	.ascii	"Km6\260m\016\304\031,\264B\220\n@o?S\013\217\t\035\326\016\221"
+	.ascii	"\313d\322\201K\336\002\347\327\335\036\271\265C\3342\207\310"
+	.ascii	"L9\023\306\277E\313\333(!\2716N\231j'\302\2226\253\312\262\\"
+	.ascii	"4k\225\003\361\007\373\007V\226\245\232\r\213\333*\214U5\025"
+	.ascii	"\252\332C\365\350Lf\336e\016\033\340\343\224j\313\310\337\315"
+	.ascii	"\214~_4;\022\361\364L\"]\n?\217\363\273\267\272GV}\250\336Z\035"
+	.ascii	"\267V\277\265:\311\255]\372Pww\313\262,\243\206\330\021\330E"
+	.ascii	"\r\013)\304\216n\200\343\203\340\321\031\032\321\245\320e\224"
+	.ascii	"R\372K]\0345\357Y+5\"\335\324\276eB\316C\321m3\027\205\007\301"
+	.ascii	"{3T\272\024\272\250\375q}[F\376D\352\346\250y\217\272\3342\322"
+	.ascii	"\377w\r.\315}\272\367\277',.\236\031\221\t\220\006]\024\310\035"
+	.ascii	"\367\267B\211\272;k\336\320\334\247:w\346\307\251\356\252\021"
+	.ascii	"\351\250\350aP}\343\262E\313\022\367\314\352\266]\261Re\270l"
+	.ascii	"K\305V3[O\260\325\204[K\270\265\314\326(;\267\033\264\365\211"
+	.ascii	"\255NV\315\352\022\2621%IlEb\353\b\266\036\261U\004[\215\330"
+	.ascii	"\032\302Z\305Hk\021\322\032f+\021[\207\330\n\202\255Bl\375`\255"
+	.ascii	"\036\220\326 \244\265\003[\201\330\372\303V\016\326\272\001i"
+	.ascii	"\325\200\264f`\253\217\265b@Z{\220V\036\266^`\253\005\243\265"
+	.ascii	"\202i\3351\255"
+	.string	"\024\334:\301\255:n\225\340\326\034\266F\260V\bH\353\003\244\325\001[\033\030\255\fL\353\002\323\n6\2558l\2751\255\n\330\232\200\255\b\330z\300h5`Z\013\230V\033\323J\200\255\003\330*\300\264\006`\353\227\2555l\2451Z\275\246\265kZ\271\246u\206\255[\266\312\030\255Z\323\032cZ\001\230V\030\266fM\353\013[\261l\275\262\325j\323\254\006kpM3\366\312\241\300y#\314\222V\247,K&\035\3372urt|\307\300\321[\203K\233+\313\263\245\307\351\366m\031)\301\327K\235\234\315q\t\"x\216\317\274*\"\370>\360\340!\370\256\215I\343#\035\370\003\337\265\034\310\356\300\177l\241\344;\374\332m\326\025l\352\356\004\301\347eY\242)5\300\300\033X\340\f\200]\201/\240}\033$q\034\354\306q\270\271\361\337^\002W\340\207\300\023h\203\300\315\364\364\034`\300\017(\340\006\330x"
+	.ascii	"/ KZ\236%\3406\0068\001\002|\200;\365Y+\246\265\021\340?9_\017"
+	.ascii	"\340d\036Y\343_x5n\2467\005\r\257\323\350\272W\220\344z\327g"
+	.ascii	"\037\034\033$g\234k\3533\366[\337=zw\326\212W\034\215\026,$\311"
+	.ascii	"\320\272\214\030\327\372\002\360\027\217q2\257h\203$\214\003"
+	.ascii	"\220u\030\377]!,\242\271\311\372o\017\353/N\346]\035\353\243"
+	.ascii	"\2345>W7\323K3|\003\262\025\325\255\\\034\352T\273Ar\352.\244"
+	.ascii	">\205\304F]\252\030\365\247(6H>\035\352\263\317\215\r\222N\177"
+	.ascii	"j\272\323\214\3357\365\271\300\247j\264\374\200\004d\246\253"
+	.ascii	"*!\363\262i\225\332\317T\351L\337<a1\351FWzT\037a\226o\220Dz"
+	.ascii	"\322\321\221>\265\204\260\210\346\346\350Sh\212\036t\243;\311"
+	.ascii	"\021f\021\332 I\364\242\241\023\355\336\n}\350QyB\177\212b\370"
+	.ascii	"Fc\203$\320\203\276\302-?\007\372\n\213s\377\363\335\303\206"
+	.ascii	"\316\032\2374\367\251\024@\031JbY\226Z&b\257\316\231\373\350"
+	.ascii	"\342 \346\210\316\216\223\313\234\321\234\325\003\004W,2\333"
+	.ascii	"\242\022\020|\2106O\215-\246\f}\313H\240\201\337\301wg\367\204"
+	.ascii	"P\224-j\025qn\b\372-\023r\374\324\227$V\214\2310@\217\323%^\334"
+	.ascii	"V\227\347\347qZ4\365%Q\026\370\325\204\314I\230X\0221\022~H\020"
+	.ascii	"{\222d\b\024R\303\272\214\214\035)B\0266&&$\n\031\021$aC\222"
+	.ascii	"\020\361\032;2D\211WX\023\022\274\272b(\331\022\261&^N\310\310"
+	.ascii	"\232x\005\315\225\233\2044c\365\b\213k\267\355\303\2663\001\242"
+	.ascii	"\216\026x\320\236\266S\200\330\330\311e\201f\301\316\334\347"
+	.ascii	"\305\3434\310\207\253\245\362q\006\251\255]\362\341\336\255\327"
+	.ascii	"\333\325\262]\247\024\371\261\017\271\244\250s\002k\354\313\366"
+	.ascii	"\337\222/\225\357\016|z\326\340\314\340)\347J\255u\237+\023J"
+	.ascii	"\270\t\3779\225\275\204\223E$/+\242!\371\276\315I\023e\204G\201"
+	.ascii	"\333#\037\341H\337\023\021\376\304\310E\030cD\217\223\020\356"
+	.ascii	"dL\bE\036\274X\330\213\204M\321\266Doz\260\322B\344\253\305h"
+	.ascii	"\310\211\fyc\006\302\315\254e\205\034\004!z'|\360\023\316|\020"
+	.ascii	"\344\301{\320\301\203t\360}\223\223\306\312\022\275i\241\212"
+	.ascii	"\013\220/\027\340\217\003\371\230\267V\3741\305\026\273-\007"
+	.ascii	"\337-m8\320\340\301o\220\3015\310\340\316p\211\336h\241\332\267"
+	.ascii	"\275\333I\204\013\333\347\343\373v\265pK\232\021>z<x\fx\274\307"
+	.ascii	"\222\363\370\276\305\321\023\026Me\233\210.\036\247&jW\234+\272"
+	.ascii	"E\350UQ.5[9\\#\246t\241\3242\233\226\345\331\302Y\251\024\206"
+	.ascii	"\261\303\263\343\005\037]T\256\035\373\005\337\273\235E\276>"
+	.ascii	"\341\226\251\231\245\344\344\207\026Tp\013v\274\202\r\222\024"
+	.ascii	"|\307W\230%\355\024\300\361\321\021\026\321\244\354\226\213\r"
+	.ascii	"j\211\327\250\252\223}\250PI\2563j\351J~\320\220\247\316\t5\357"
+	.ascii	"\331\335\231\3658]2L<m\225/\231 \234\326\312\227\314\027\246"
+	.ascii	"\275\362\215\202\314\025\245\035>\311\207\252]K\366%~\333\034"
+	.ascii	"q\307P\\U\016$\317\323"
+	.string	"\343\366\254\034\n\234;N\217\323_\337\004\263\234\340\313\003\034:\001\201\230\250a4$\221ChFDDD\222$Ic\261\005\304\030\007\235\225\007\021"
+	.ascii	"\245c\220\231\210&\005)\244\0036\321\007\223\024\b\345ps\325"
+	.ascii	"\177\264b]Z\306;V\"\316\200.\216\302\245\350\220\314-\371\326"
+	.ascii	"\n\026Wb\236\323\004E+0\377\007\2551\240\007\341he\271&"
+	.string	"\313W\303\034#\244\\<3I\241\265\026\202\353\177\003:/\336\236\377\370\035\177[s\177_\366\302\t&\366\324\324\342\363\372p\324\0308\027\361\370\331Y;\3509\001m\023=\024\342\003\376\271\354\207;\020 Rj1\247\310\\7\365Y\255\311\360\032\005Y\365}\377\200p\002)^\rC\013\2015\024\256L(!\271\2555\365sC}\214:N\203\366\213*\207\033S/9\347\025/g'\276\030\003\227R\003\036\205\316\322\032.9\264\030\322+\342h&\370\251r\356\251\240\204R9\255!\253\376\315\301b\006\210\310X\265\266E\"\031\332\346|\006\350\321\036_k\336\377\326\205\251\037\356\242\021\022\353\270\2652\337\205\216.fI\021\353\222\021/\364\331\306!\261\355\374\263\313j\316$f+\032\354\313\013\032\276\366\202\325\370\245\0359u\341\341\321H\374\033_;\277F#\234-\0252\037\366\343\303\230\350p;\244@2\200"
+	.string	"\033\225 i\332\330\250\266ed\037\027\212\275\002\036\254*gz;D\340x\021`\2032\350\246\206\0374\220\305\021\265\331\210\211Q\2254V\271\237v\300\310\262\363\352'\224rh\215\0069q\273\021\026!@\315\265q\257\266i\364\020\373;\221\2079\375\331\276\200\377\001\2379\230\267\233\004l\221\307\005\356\254 \032\022\n;\243H\270\334h\216\t\2327\255!\004\250\320\025\236f\r' W\n(\037.q\355\366'\374\363\225\227wDQ\345KA\217\275\352\221EE\361\257\001\276\001C6"
+	.ascii	"\224\006\232\0233\\?Z\\\236{\317\200\201\312\210@\nP\257D\274"
+	.ascii	"d\274\037\257\3754d\007\331\231\311\222\2014\331\360\210\303"
+	.ascii	"\211\017\276\253\340_\215\334\333\230\266\261\305 ?\027\210\237"
+	.ascii	"\336M\244\360\246\355\232\3626\037\222(\233\331\275P\246\317"
+	.ascii	"\303H\034b\214.\330\264\317\234<\203\260\321\r\206\300\205\021"
+	.ascii	".\2550\246\262\201B(=\334\255\236\\\263\215@!\210\223\344\214"
+	.ascii	"\2120E\031\333\032\025\003\311y0\r4Y+\207\346f\025\035\217k\220"
+	.ascii	"\373\375\214D\016.\037E\301\002\346\364\240\355T\236\016\274"
+	.ascii	"\265\007\305\204o\221\016H\n\223\304\363\236\341\310\261\270"
+	.ascii	"\232|\314\272x\341sB\2251Y\007\022\222\335K\333\341\257\b\260"
+	.ascii	"\022\257\\\331\212P,z\201\035)\247\363\272\374\332\315\202\177"
+	.ascii	"\007\274\234\332\251@t\340\211o8\375\356\r\266:S\222*\327\266"
+	.ascii	"%T"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.25.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`!\r\315>"
+	.ascii	"zm\204\027<@\350I:\201\250\030w\234o9\343\013W\377\256%}_K\376"
+	.ascii	"h\205\216j\233\237e^\013S\241\217FB#\266d\371_\304n\337~\307"
+	.ascii	"\n\354aM\364\345\217\372\237\020Bv\222R\006t\001;\001j\001\275"
+	.ascii	"\177o\277\227_\f\310C\304\"0M\225\frJ\017\225|\276\260\035f:"
+	.ascii	"\314If8\314r\370\274\344\210\251\\\0275y<g\271\316\n\351\354"
+	.ascii	"\335\261C\201r\331\354\206\343\360\336\n\345(QC\337\260\036\034"
+	.ascii	"\303\331>4\356\210\312\351\202fR\232\246i(\227^\365A\0048N\376"
+	.ascii	"@\323\274s\257K\232Ii\232\f\343r5\240\334\273\274\206\331\300"
+	.ascii	"q\233 L\225\246U\006\351I\323\344\330N@\271\334$c\231\\\242l"
+	.ascii	"er\271\013\267+\211\223XR\266\303\211.N\2464M\213\277\262\265"
+	.ascii	"\225k\222\027\352p\334\305\005`K+\013\353\312\252\212\2128%\025"
+	.ascii	"5\024B=\241\247Y\3267\334"
+	.string	"\362\036\027\320\264gdI\034w\251a\256ZF$\023\024NtTS\207\233\350\026\361^\232\006\200\006Jo\235a\255,,/]\372\312\252j\213\226\246\352/L\304\302S_X\252b)\361b\204\023\035\245T\006\223\366\\b>\376\ns\304\353\250,QL\342\221\213I<~\251C>\036S\003\206\n\2233,\254\303?1w\234\350\370\244\226\331\361\375q\035\356#K\2064\324if\205\311\035?}\241g\365Jt\254\243k\3634\243\302\304\216\3139\341\022\"]\245\226\310U\2570G\273>\327\341\262\213\035%*L\356\270O\2634M\267\215,a\302\033\200w\033jwS\354\n\363\002\203|\345\221;\305;L\363\354E\217\020\312;\314\362\346y\016\357\345\271\t &:A!\314\367'\246\256\262\233Y\377\246\007(\327\233vYO\0177\224\313r\220\363\221\273\253\375\347\2711\225W\220\311\357\363\\\030\263\363K"
+	.string	"6\242\023\024\322\203\333\ffjx\213s\035\256~"
+	.string	"\377\314q\032\322\203\267\343\373\003\363#w\223q\375*\177b\354\364\354\253\354\326^\243\2136\266\265\026,V\244\250\275'L\324\336\022$\270\r\263\232\331;\302\354\025Q{C\230\275\037\314^\017l\2077\r\255\303\031\007\246\303k\266AC\206\332\213\301\354\275P{-\324\336\n\265\227B\355\235`\366J8{#\234\275\020joY\355}\300\275\016\336\333\340\275\305\332KV{\307j\257\030\367\206\275\227\301{\027\230\275`\265W\001'y\0230\034^\004,\207\367@\3555`\366\0268{\277\316^\257\332K\240\366\016\340^\001\357\r\360\336\256\332\313\305\275"
+	.ascii	"\336\273\365^\255\332\233e\366b\235\275Wg\257U\355\255\342^\252"
+	.ascii	"\367\022\337;e\366J\325\336(\356\035\276W\370^\250\332\213\226"
+	.ascii	"\275g\331k\226\275e\355\255\034\254'\322\240\325\221\033\202"
+	.ascii	"\371\270\366\231\"\367\270\3553\271\036\242n\b\b\256\255\253"
+	.ascii	"\035\200\326\267\264\316w\221\032\321\t\n\251\n\324\003<\304"
+	.ascii	"CAd\250\270H\035\235A\304#7\013"
+	.string	"\353Y\357;\"\216v\254+KtM\256.\342\333S\214\303\264\372\325\231\256\256\352V7\t\251\250\"^\355TS'N\235\333@\302\364\305(\3578u$\230)u\023\177\2349NQ\227ze\364\"Jx\265\017\031\017C]\230v\250\363\021\222\241\205s\007p\215\324\221\033\306g\007+sE\017\260\020w\035\017\305u\247(E\313~\220\020-\003\ndh\271o%\241i\032\267m$M2'/\235\222. \264\214\207bI\217i2]\300\245\2073\0373\222@\232\016\021i\301=\37707\334\303\317:0\303\n\245\341\007\204\215~wF\215f#\353%\367\270=p\224\201\243A\341\221{:zr\201j\352\203\327cl\366#[\2372\234\367\030\265\264G\260\227\177\230\032\212c\032\3519\222\353M\\\3234M\241\216\\\356+\203\256\235\373\234\234l\347>\227\312\2663\232>\205\336\342\031~d\227\214\315\356\342@"
+	.string	"\363t\230\247\257]\206 \264\331\256\302Q\2362;\276\277\363\310\345A\336a\236\234\236\347:G{sx\346\221,\300l\361\266\253"
+	.ascii	"\034\244k2\244\003=\370\315MG\233\221\2061\007\332\303\350\302"
+	.ascii	"\206\007#\r6\266\0306\204o\306\027/v\260\2319\214;h\254\3610"
+	.ascii	"\267\215\f\206\215\030.\334\332l\030Y\364pc\233\321\266F\203"
+	.ascii	"\255h#\306Z\215b\333[\216\"\031\330\272\3350\276\025u\270\271"
+	.ascii	"\275\025\205\311\224_eW\2009$\344C\2720$8\206\032&\023\246\253"
+	.ascii	"A\225\"qm\241=\301\326\331\021\2101\202\256[c\006\300\221{\006"
+	.ascii	"\322Z\201j\372\323F\030\306iZ\035\376x\021\262\037\243iq`\364"
+	.ascii	"\007O\030\306gaZ\264X|\253\360\3007\244\275H&p\313\257\214\224"
+	.ascii	"\211\023rbE\342[\211h\210\f\tf\245@{\207\037a>.\375\344H\211"
+	.ascii	"\361V\253\263'K~\202\3040\336\254\263o\035\236\235Co8\213\227"
+	.ascii	"}s\202b\234\366\025\367\361\310\320\034\336 \346\356\244u\341"
+	.ascii	"),\374\002\024\013\347c\340`\211\n/\301\221\230\302+@\241\020"
+	.ascii	"8A\302'\2148\332%D\370\b\b\217Pv\b?\t\r\037\274\f\312\203\006"
+	.ascii	"W\273\203\342\033\024\317z\002\re\035\271F\262\033\311\316w\201"
+	.ascii	"{'\034\361\330"
+	.string	"O\240b\037{y\007\016\213\030\203\253=l\301\031,8\337I\032\3042c&\021\017\005\371]\035\311\210\301NB\301\301\024\234\217\222\362\264\201\0027\360\341h/\360\365\017\334\210\275\376E\340^?\373\350\004\205\f8\201\233\214\346\004\321\006\004\270\332\005t=@\327\003\201\b\250q,$\025d\204FD$H\222$i\r\201\005\004\031H\021\332\001\021P%cN\331H\223\322p J\223\0026\220F\212\264lh;2\246Jf\225\264d\367\033\366 \325G6\362\203\265h\265\337\335`U\236\033\235\3229\326\264G\t\340\035\270\356(\367\3550mG\367/\240\005]\021\245\213\324\265\035K\214\244\214^|7,\032\305\035\031\372\036t~,R\330q\251b\374\352\334c#c\t\352|\2226\033\335\216H\2414\307W\243\300\200\352\320rGi\027\005\177<\244\376\223\212\312~H\2133\370P\304)\323\020xa\276P"
+	.string	"C1\362\213~\376o\234Ek\247\310F\013\027\224.\023\020>d\341\265g\037\255\261 \020m\223\001\203\302p\027\325\2767\264S\327\020\t\004\260\371&1\310p\215\220@\354\266B\344`\242{\236\001\261Q\2233\261\220\361\252g\033|H\340\252#\377\220\027\302\302\265|\"\226\315Le32+\234I\032T\224\241p\343\227{_v\347k@I\271I\320^\276\006\376l\346\324m\312\2460I,\321\271bd\002\263\034\257HD\033\222\3225\273\004\366\201"
+	.string	"\360@\301\263\214d\336\314\223\211l+a\245\312\253|\251C4\304,\262}X[\355~7-\331-\372"
+	.ascii	"\020\205\372-N\250`\332\354g\250(E\231\202L\354\270\321\303W"
+	.ascii	"\371G\275S`\036[\2548/\033\025\270|\267\360\346\036\003p\353"
+	.ascii	"\240\322]\177\240\013\r\242\031\300\354,Y}\360\025\225\346\347"
+	.ascii	"\312\211\351\217\315\360ne\357nr\323\236\177\374\302&\025\255"
+	.ascii	"\366\030S\rao\213\252t\0045yP\336\2078\310\301\212]\303\002\350"
+	.ascii	"\361KY\njS\253\242\035R.\253h,\r\275\246\335\032P\311\324c\t"
+	.ascii	"\306\0250"
+	.ascii	"\276\341\027\013\004\334\241\200(:\026\3019x\3326y4\025"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.26.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\016\005\225!"
+	.string	"\226|\325K\240\024R:\243\330\326\006\023\035@\246\036fC\327-W\375\243\217\034\326\316\341\230\340\034\202\236\241\317WI\270cw\370\275\f^\221\3621\366\013A\236\312}yR\3348I\362\262Nk"
+	.string	"\370\213\303\207\363\376\273oI,![\356$\003\307"
+	.string	"\261"
+	.string	"\277"
+	.ascii	"J\367J\245 \222\312\275\227\3277pL[.\227\313\333\3439m\337s\270"
+	.ascii	"\033\213\255\226\242\264\323\264]}|\344]\302~M\252\206?\317!"
+	.ascii	"9\teT\234\r\342\321oW'`\304\365T%\211ht\026{@\314\310\330\275"
+	.ascii	"\204F\266\245hi\350N\302\031\325fu\236rG\022\361\3505K\013*Z"
+	.string	"\272\2270\206uP&\226u*\241\232\322 \330 \3028: \211\370\3424K\343%|ai\356\275\266a\260\236\247\272\004&\343\224$\"\214\233\007B\272\265\013\202\250\314\300\r\203,KY\320\t\260\266\2159\332bq\253\017\360\022\"\331\002]4\242\034\371J4\374\325J\203p\357\345:4$\236ug~\005f\256\300l7\004B~\227\226C\375\273W%\3179\334\355R\347Z\255\234\2762jV\246\231\225\317Z\331\254\225\355+\267Y\271\232\225/@\300S\227\n\345\275EK\263\313ef1\275\352O\376Ro\346\363\253~\305lc\024'\302\246V\024+\032\240\356\002\231\224M(\230m\237\342S%\031\t\372#D\255\224F\261{/\005\364f=\222m\n\030\370.\225\002\275M\264$\023\016\261{\21757y\002s=~\210\357P\214\204\323{\223\250`\335{\023\360\003\364&\215}e\376\323\215\276\013Yq"
+	.ascii	"\367\326\330\302\272\367\230\200\033\2407\371"
+	.string	"\370\226\363&\372\335y\323\307,\345\307K&?\305\211\303`$\273\275\367\336\264\213\374)U\216h1\375.2)'L\337\232(\3272\375$\025\355\342\003\2340\035\323>f\312 \2137\201\002EE\353\"\177\347\264}\247(\260g\371\354\2409\370+\372D1j\273t\367\205z\330\263\222\363]\373BN\271~\2370K\006\317\200\352\222\177\003'\256aZ\204\0252!\263_]vR+hx\332|\327-}\252\333-+aBG\277\272t\240T&f\246\325\245\231{#\352\207\330\366\017\256\250\303\207E\360]\317\030\203D=\231*\242t\243\273\3105\337\365\213\221G\324\022`-c>\376j\027\311\264\\0\341\256\301|V\236\221\211\201yy:\357\311\351p\223\363\341,\301c\242\027\241F\"\307\004\210\233\023'\343\330x\340\321\351\320\303\341\311\321\340\323\343\260\203s\003\202\003\217G\347&\004\017\247\207\004\317\306"
+	.ascii	"\367D\344\364\360J\364z=<\333\021\350\310\243L\214\\@\375\313"
+	.ascii	"u\221m`\267\2276\301j5\3275\021\267\256\177\026\265\205\353\242"
+	.ascii	"\256_j\276\276\242\276\246n\274\2533\0272\350j\332\374\253\033"
+	.ascii	"\234\372\241\231\376\325-\004i\252\"\006\354\037\027Lc-X\272"
+	.ascii	"x\344)OJk\227F\261~6M\327g\337\352v\354J2xf\263)\256k\267j6\263"
+	.ascii	"\007\035\032`\377p\255M\013\304,,x\006T\353\"\337\200\2402\351"
+	.ascii	"\017\262%fK\347\232\210-z\353#\237\356 \013d\250q \302\024D\206"
+	.ascii	"\241@fDd$N:`\002\031\272\262\016\021\340\255Dd\222\264\337\001"
+	.ascii	"\024:\301D\311u\350\313\022^\373\030HE\036P\260\235\276\002\311"
+	.ascii	"\352l\200\304\203\206\023\216r_\243k\266\354\263\003 \271\260"
+	.ascii	"\307\204f\0365\3646S\bs\370^\223\354\217\013a\2623\026\0178\270"
+	.ascii	"K\025\210L\356t\352n\003Tn\340E\266\031~f\216\307S\324\2742g"
+	.ascii	"(\267\204G\244@}\253\200#\201x\337\257\007\300`\0025\372\bs\215"
+	.ascii	"C\352\245\027\340\316$\377^\205@\341B;W'\347'/$\260\301\364\024"
+	.ascii	"L+\270\032\207Z\037L\234\373\205Y\305a\335\264\346g\375\217\253"
+	.ascii	"\314\272\351\375\033\222\2168\262q\350\363~H$\251\244\277\207"
+	.ascii	"\236\236\0353W\236Ex\"\177M\0325"
+	.text
+	.section	.gnu.lto_blackboxUnsignedVBLength.27.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375` \001}\r"
+	.string	"6\331ZB\020q\224\016)\035&M\t\210\305\320\300\315*@*\350\225\t\n\370@`\226\0268($\035>\257\372\321$\343\337\266P\224\325\030\343\231\224\001"
+	.string	"\200r\\>\002\023\272\"\232\320\n\204\305\023B\366\226;\245D"
+	.string	"I"
+	.string	"C"
+	.ascii	"\017`=*\t_s\316\325\241\274\341\343\036\241>\316\307L\031\243"
+	.ascii	"\016\364\b/\221H\t\216N\0041\252T\312"
+	.string	"O\177\244.\364\240\211\221\353O\207'Vs\324\215\374]\rv\327o\324\201\270\255\333\366\330v`\377A\003Xfh\250\261+2o\254JL)]\3766\347\237|\261-\215\302@\0370\026\245\225\324\356\036x\364\002\354\361\335\3641\200]\021.^\354\312\004V\200=\036\305Sp6\nJ\223\356%\032\035V\260\354nF\340\002\254G\030\360\251^I\236\377XW\003''*bpx*\270\273\013\215\340O/\345Z\204\220\\7\312\272Z\312`\242\204\254Bo*\n\fQ\247ZbK\320\303\230\250R\326\021\366\345}\335t\323\257\227\367\273\351>\026\022<\037\034mci\0276\031\f\321\232\216\017\016H\204M\303\321 d\330<&h2\033\217\214\003\222\241\220i:\026\262\216\002\336*h\235\314\263m\235\354\"\367\020>\205P9B\330P\331\240\241\250%\376L\022\275TkYy\244\237\216\265L\017j\251\003\032"
+	.ascii	"`\325\253B \034[\031{]\233\f0\252t5\346dL\201.R\255_s-\230\222"
+	.ascii	"\340\256V\257\304.\250\315\366\241\315:\214\372\036j\335?=\220"
+	.ascii	"\251EpNdQ\246T\315\001\365\210I\230O"
+	.text
+	.section	.gnu.lto_blackboxSignedVBLength.28.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\274\001e\020"
+	.string	"&_mE"
+	.string	"\257(\0355!\237/P\353\n\022\363\210\352uv_\003\333\252\027pc.\022\256\335\2040\313\355\261X\007B;\020(x\263w\n\301C\237\376\377\177\2473\016\005L\370\360\206P_\374\302\365|B\310\336r\247\024X"
+	.string	"X"
+	.string	"U"
+	.string	"\362\203\361\276\212Y\230\201\261\273\\\306\td\237\362\003\262O\345`-\f\303\330\345w\313\330}J\215\235\337\272\203\324\005P\345\221|J\355D\245C"
+	.ascii	"\357D~p`4\007\037S\274T\224\036Z\256\007/"
+	.string	"?\304B\225\327\362\250-\330]G\225\307rg\267\035b\233\201\375\027\001\256G\373\276\314_>hOL'\362\317\237\371dp\201\330]\317\247\013%\227D\203UL#\013\365\225\r\205\213\026\260\335OC\304\217\261\347\323\"\037\341\232\215de{\255n`\273{\340\323\n\266\317\333\235\355\211g\215\270\263\253\301\304\211\335\325p\202\355\363!.\242\263k\002&\021G\356\356J\004\327t\323\256\004\212\213v\327dS3=x\311\nA\224X*\206\n\2468\361T_\242\252\355\001\022\257\272f\230(\211\375\245\242\276\330\377\300\340\300\254\033\354\316\366\327\255\335\345\272\347Y\277\312\350\003\b\261\254\350\302]\2250\306\332L\232\325_\177\021>8J#R6\002!\201*L\21368J\035\020L\242\322\350A\210)$A\004\"\205\270R\007h\002':yp\033\005l\2420:q\037&\323\211\363|%\227R\323NG\337\272"
+	.ascii	"\033\026\236M\211\246\246\276x$t\321MG971\345\340\267\234\020"
+	.ascii	"\203fj\031\257SS\034\036\225M5\320j\311\250\b# P\202Q*o\003`"
+	.ascii	"\365\260\004\372\261#\366\006\326>\314\252\366\264\020Z\275A"
+	.ascii	"[\351\223`\244\216\263\2221}\327\256@,\017\304\026\342\027C\020"
+	.ascii	"\336\344\252\204\273\212\254\033`(`\207\364k8'\222\217\204\373"
+	.ascii	"\313@\346\226\300,\222\302b\033\017\204\210\351\352O"
+	.text
+	.section	.gnu.lto_blackboxTag2_3S32Length.30.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\025\003e\027"
+	.string	"\226\254\230F\300\330*\035\300=\3420(0\215\001b\004j\326\nC\270\357w=\341\242Z\236`\203i1AA\203\355\226\365\253\331\324=\024\223\347{\b\002\"(\313\203\030\233\025\300\361\351\202\310\026\027\357\353\363#B\b\331R\246\024\206"
+	.string	"x"
+	.string	"\207"
+	.ascii	"3\367b\006\342?\347\304\353\370\016\227\375#s0n\003zV\314vV\346"
+	.ascii	"\234'\323\t\200\377\344\005\200\377\366\205\3672w\203\324\365"
+	.ascii	"\020H\f\301O\256\272\374\232\207$IG.\320\332\r\246 \003.lR\\"
+	.ascii	"\324\234\207NN\344\214\267\231\202\3224\347\034\335d\322d\300"
+	.ascii	"\306\211\034\375\376\322\271\224\rx\344\2101\272\215\220\253"
+	.ascii	"\003rd\274\305t\317;\205\036\031TX\330\244\270\2060sN+\355fs"
+	.ascii	"\217\267\235\263\035\301\336\r/\355\355\234\263f\027g\347`\372"
+	.ascii	"\033\033"
+	.string	"\017\t\357\216]z\356'\255z\264j\227\357n\321u\272;$\325 \251\026W\035J5(\325\337\252\345\325\253jU\365\003\210j\b\271\235\006dN[/\313l\362\031\251\361\335\257\263\377\303\347\355\254\364\310\200 \376\273\355\362}<\372:\377|\332\314\223\200\322\023c\312\234\023\301?;\020\377\251\375\036\367\341zN\304Ks\356(!2\003\264#*\352\375\003\216;ZP\213\254\nL{7\022%(x\204\213\363\276\005\202\366<\nZ\001\260\332\220\343\310\001\003\013\b\340-P\024\305\t0ZO\243L)R\345\023\225\264\266\207\031=-\334\373\034&\2665\004l<4\2718?x\013\004\227\345\263$\246Wlz\013\374\026\334\313T\354\267+e\266\305\017B\003B\244\341\213\330\327ttI\273{\331\ry'\001\277\272\227\331\200i\317\242\375\236w\tOhLf[\0024\317\360\001\203*%\003\316\244@\310\304\204"
+	.ascii	"\215R\200A\245\341\302\n\245JU\240YY\330\200\212\221\261pRi\210"
+	.ascii	"\341pB\261fN\n\016x\325!\305:}X\255X\247\321\257\357\216M\310"
+	.ascii	"p\226\200\306\265\f\327\305e\r\363ZX-\2648\207H\304\322m\262"
+	.ascii	"\033\036Ep\321\326,\305\320K\360nTh\202\217\366\313E\373Q\331"
+	.ascii	"\315\360\211\022\323+r\3169A\213\363y\217\200\343\"\034\255%"
+	.ascii	"8n\001\031\216\211\357\345\241\255\331\t.\332\322\002h\021; "
+	.ascii	"p\002\031J\243\007a\2507^\270mC\212#\005q\r-\353 [T}!kD\255\306"
+	.ascii	"\3517\201\336\007{\321\356a\261\310&\rZB\210{~\222M\356\311A"
+	.ascii	"\023\007\316\2550\0236\370\343\bb\303\276w\177K\352.)cI\374\036"
+	.ascii	"\314\327\203\212\254\271\316\241uc?;\203#\255\361\334\310\360"
+	.ascii	"&\252\310\032\301D\356$\335\200\354\254G\335\205\210&\261\350"
+	.ascii	"\3271\030%\310\024\t\227x\317Pnu\r8\346\b\323e\310"
+	.text
+	.section	.gnu.lto_blackboxTag2_3SVariableLength.31.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\230\b\r("
+	.string	"ZC\350\016H\220ZU:\205\3504\252)\332\222"
+	.string	"P\001 @\344U\204.\367HA]h%\213b"
+	.string	"\026\241\013\036D\007yf\226Qd\004I\243\251\223\340\245\336\023\344\223\300\\\232\364xq\364\377\377\377\377\377\177}~\220F\310\226;\311\345"
+	.string	"\277"
+	.string	"\334"
+	.ascii	"'/Sf\346\033\371\021!\346\252\273tB\342\200P\021-y\263\256+\021"
+	.ascii	"\300s\350\317\373\033\372\263q\\\350;\302 \360\347\353\361v\272"
+	.ascii	"\034\356f\253\321f2\235\230\n{\245.\364\274m\205\370%\276\303"
+	.ascii	"E\b\025D\002<\362\273\303\2532M\31722rm5^\\\371\212$\261=\"\274"
+	.ascii	"!;\037\272\0369\036P\026\027\365\263\370\001\304\t\233\246#\250"
+	.ascii	"\337\236n{\322ak9hNTOvVk:\232q\331\f&\253##\026cj\206UO\003\210"
+	.ascii	"\022\233\246\243\245\303\226\202\030)\331\3275p\304\242|\226"
+	.ascii	"\021\214\253\243uC\313\323$\251\007\bb\264d]\3172\332\201\032"
+	.ascii	"\317\023wHE\022\331\276\004\230\266\270\220!\2137\207e\343\314"
+	.ascii	"\243n\213\220D\326\272\024\254\353\312V\005\362\350\f\340\314"
+	.ascii	"\366\0023#`F\305\004Ahw\017\363j\310\306a\273>\b\265\335}#S\321"
+	.ascii	"6\371m\273\253\210\266\316\244\007(\335\301\037\201\376|?\352"
+	.ascii	"\013\276\034\255\024)\231\260M\346e\321\266\222\371\335l6\233"
+	.ascii	"\334I\346\266\034\274\226\201\327\362\357Z\366\265\345\336\265"
+	.ascii	"\314\273\226w\327\262\356Z\316\265e\334\265|k\313\266k\271v-"
+	.ascii	"\323\256\345\331\227\277\254-\307\256e\365Z\206\265\345W[N\333"
+	.ascii	"\262\253-\243m\371l\313\367Z\356k\331\266\345\013cE\216\310\037"
+	.ascii	"\241\254k\213\246\234\325\3139\305\007\325\3078M% s\346\245D"
+	.ascii	"\\"
+	.string	"\tCH\022\243\212`V\1776\263\020\263j\231\237\344PB_\216xm]\223f\242\254\353r\310\007\322\007\247\242\311t\256\345(\2221\366,\377\224\312\363\036\255\326\264W\327\372TS^\rl\323k\264\323\b_f\262N^9\317\312s\315\323\261\372\356U\317\365\316A\254\225\2143\"\365\200\r/3\"=y]\024\311\230\332s\025z\251\337\205\021\231\306UT\345:*\317\265\316\325\271\376\224\253]hx\036l\224\001\363\230Cm%?\261\372Q\005\326Iv5\201w\005\266\255\230\002\212\221\251\3701A\260\264^\277&\301\344\362\353\031\023E\323\310T\304\321\004\316\225\364\276\356ar\271\257/\365\0066P\250i\2505Z\234\\Q~2\026R2\t\205\362sJz\216A\202\361\244t\n\255\366\006s\313\220\215\363w)\"qr\271y \3646\b\376\223\373\021\2552\217]\254\2246X4\272\225\334\315\007\036*"
+	.string	"e\230"
+	.string	"\002e\237\002\0266\\\240\360\343\263\241\202\204\020?=\030|&d\350!n\2700A\003\321\247\203\007b\201\001\374\303\241B\007\342\207\237\237\016Dui\342\235d\253\033\336\356\206\267\274!ni+\310st\311J\370,\307\031\227\230r\303?\35251F\030W7[\307b\315\nLt\361\256\353\272\356\264\222e2td\t;)\346\347\251u$\022\fs\255\224\206\222- \211o\301\226X\r\375\256F\346\205\310\t_?\bU\255\332\275\202\212\355\214\220\033\275\020\337\342\245"
+	.string	"\023\207\347:\020z~\021zY\223d\327J\346\320$@)\343\204\256\225<k)SP\006\222\252\314\311\265r\347A(\254I0\257h\260\007\305\243\033^\266HZ\301\331j4\252\031\317q]\304\214\353\264m\251V\361f\273\325\372V\233\325z\326\001\200\302\250aT\005\215C##IA\222\202\244\320\001"
+	.string	"#\031\"v\021\340,\3114:I\241\320\030`B\354\340EQ\021\024\336\"\244\246\202b\267\321\n\374\nq`\313\223\017A\b\2330\362Bi\331\275\n\314\336\021\004\021\377\333\004\b-Y\013\212T"
+	.ascii	"\302;\226\363\274\210}\023\213\037\301<Y>\271K\340v\301&\261"
+	.ascii	"\031[W~\370l\376\272ROny:\261~\356\375\034y3\017\357#\367\346"
+	.ascii	"\255\371\277gC\252H\350\201\3157\304Fm\316]G\203\246\036\023"
+	.ascii	"\230\r\257\275\203A^\336\377\212\261\361\032\301\215\246F9\337"
+	.ascii	"\r\352\005:\300[\020$.\373\313\302AA\342\006~\260\266.\025\211"
+	.ascii	"\006h\266!\314\002\311\340\270\272\230\320\214\315\202\300\213"
+	.ascii	"\325_d:\254\350%\031\276\361I\367\327\264\315\237\366\331S\232"
+	.ascii	"v\243\034u<J\002\177\342\244\260\222\2303\323\360.\351c\241\212"
+	.ascii	"6\004_\237A\347#Lr\225\016\231\201</\341\300\350\025]m\243\365"
+	.ascii	"\254kZ\346\273_]\327u\177IxQ\351X\262\245\267\265`\274\003\315"
+	.ascii	"\237\250\004L\345\210\330h-0\007\273Y\332\245G'\0067s\267\t@"
+	.ascii	"vV\320U\035\347\017"
+	.text
+	.section	.gnu.lto_blackboxTag8_8SVBLength.32.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\333\004\025!"
+	.string	"\326\374\324L\240RR:\2579S\230\244?adB\222h!~\234q\372\343}\220\223\346/\224\356\361\356\216\304\326\346\216\317\263\231\337Xk\235\3557\314\017\300\277\200\261\337a\016*\2344\001\353H\304\200\263O\266\377\277\354\007!$\226\220\275w\222\001\300"
+	.string	"\263"
+	.string	"\300"
+	.ascii	"@g\311\271I\210V\316\305\232fp\276\354\342\371\034\327\241\353"
+	.ascii	"\346\302\305\030\301\027b\030\321\224Y\316\3316\3400\346K|\027"
+	.ascii	"\363\345\205\221\226v\352\272\266\256\353z\\|\253X\367\0245E"
+	.ascii	"\317\232Yb\225ku\375\240\247$!\207\254\372B\330\342)\223\020"
+	.ascii	"\351(\256\r\375h\034\f\310\002\333\234\221%\277EdO\002/\204G"
+	.ascii	"\257}\353\021\306\306\2300\t\217n\342\005A,\034\007\003\"aT\214"
+	.ascii	"Xu\344\255/\330\263\245M:\276P\213\253`\233\253\234u0\240\013"
+	.ascii	"\\{Z\211j\220g/\266\001\221N+\301\035\0060v\003\310\247N\340"
+	.ascii	"\t\230dm\315A\316\271mQP\370^y\367\005t7\206n\234!\377\212\265"
+	.ascii	"\255\336\352\235\242\227z\237\326\266\371\344\273\264\266\361"
+	.ascii	"m_\323\2665m?@\n\330\217\340\215\210\344\374[\243\344\2572\351"
+	.ascii	"t\255?\371[\375R\307\335\357W=\331\337j\365x\006\001O*'\261\237"
+	.ascii	"c\365\201\330\034Iie\345p\256\202\340\224F\226s\261\264Y\271"
+	.ascii	"\003\317\2551%d/\333\202\217_5\211\377h\rG+\216\234\263z\252"
+	.ascii	">\322\312\214\030\245\302I\242[\375\351\037[}\3713\200\007 \363"
+	.ascii	"\234\304j\274[\327\237j\265\273\245\232\353Y\230o\302\b\021\n"
+	.ascii	"Y\316\231\346eK8\255}\217\346j4g&3\255\234sM7\270\355>\324\243"
+	.ascii	"t/\006F/\234s\316\347\035\312\334\231\253C\366\224jo.\023\346"
+	.ascii	"\306\334o\035C\255\307^\332\316\256\367\3305\024\254\255X|\373"
+	.ascii	"W\267\034\373\242\227\373\253\237`\300/\336\r\262\211qFf\352"
+	.ascii	"\230\370\366\030\303\336UB\347\224\321\0072_\342{\037\222\275"
+	.ascii	",\367\336\367n\340w\020\363\327\336\367\236vv\355\364\376\036"
+	.ascii	"\371\tE~cDiBv\265Kv\364x\224\251e\271\335 p\366E\346\3057\250"
+	.ascii	",\373:\202\357\260\377\032\025N\274Tn\023\202\343\016c\022\005"
+	.ascii	"'\272\244\356\0356\315W\356\247^ \350h\3038\204g\317\272\213"
+	.ascii	";{\207S3\232\224\365m\352\236\221\211\271\326\033\246f\373"
+	.string	"\305\245\345\305\237\345=\002\267\334\316\315\210R\347\036|rxn;\246\017O\016\367 \025q\313\355\334\2140\033'A\016\217N\007\034\016\317mC\t\034\207\01787;\034l<:7 l8=\"l\t\f4.\304\255\307\346\203\303\365\330\324\242\320oS\033\365\210J*z\033c3E\317\205\227\245\271\252\336v tw)w\330hX\352r\177\275%,\025\232\247\327\3278=\217\202j\tJ\005\301\321\353\353\233\336\222\311\261\314(\204g\317\216\224DSR\221\377\212\336\222\030\332r\033\227\350=\257/\275.\027\214?$6\305\247\314-\321[\336\026\n\273\337\023\364\016\033hU\252\315\334\033\232\230\351\373\326O\264\325\250\026s\033\233/\027\346\372z}\316\204\271\007\242\242\002_\250A8\244\0303F!\021\022\tF$\3115P\0021$\241y\020h9\343t\244\"\240|\207\3379\275h>\264\340P\206\320\343"
+	.string	"\2157\241\371[k\b\022\304A~L\r\245.H\350\251X@\240\031\352\254O\214N\211\367~\005h\367\3373\3202\033\2539\352@\272\300\227\342\254\2555\033\342\2221I\207/\311\307\312\307\004\"\022i\233r\350\211\207F\210"
+	.string	"f18\317\006\322\002\027\3674\032\313\020pX\020)"
+	.ascii	"\351^!\207\355;\343\027btv J\235\272\020\005\334\3350u\205\321"
+	.ascii	"\216\346\253&\004\37549\254(/h\371HhL6\217\314\004\204\017+\033"
+	.ascii	"\327Y,S\023\024\345w\2316&W\340\300\357\226*\200$\310\035\257"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.33.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\235\013"
+	.string	"\206\325L= O\225\016p\f4p\n\t\003+X\016k\354\t\310j\356\024F>\242-2\237\037}l+\217\312\346\275\020\376\210\256\020\200H\204\001\203\350\036\244\266\352\nb\2109\026\305\275\211\224)\0059"
+	.string	"5"
+	.string	"<"
+	.string	"\253\022\273;\261\201\306\241\344\002\342a\366"
+	.string	"\361\320\237\255\342\254\324F<T\020\211`\261\273\234r\370\367\374\374\257\356\030\225<\317\013\004\273\353\034\225,\334z\333\003l\037\260O\n\331\356\256\025egz\3134$\323\332U\177\3144\324t\246i\315tf\372\030\332+E\351\246\025\273\244X\213uA\023\035\036\266\237\366A<\304wU\307\216\335\f\001\032N(D\260\317\326z\352\226\221$ \0050\\!\215\373D\214z\335Z\247\021!XLMm\216\204\374\310_\375\251\327\005\027\005\365\370\261wbTM\235\"\023(c6\313\223\272\301~\027N\246\022\001\272\243,\320`\024x\235\346\222`\202ga\320U2\026N\203\2514\340\272\315\003\216B\300\236\203\313\206\203\340y\033\356\301\332+\312\215\327\007\327GA\216\t%\231B\235DT3}\b\006RU"
+	.string	"\001\031"
+	.ascii	"`\251'\0230\374\315\300C\272\254.\036\202\006\035\346\206\210"
+	.ascii	"1\243\301\305\264J\017\024\001s 0@\210\256\034\2010\201f\030"
+	.ascii	"\276\252J\246\202>\300\204K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.34.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"\346\320=90\345(\035\2363\tf\364*\304X\020\031\263G\225qJ#\301S\264\003\216c\3372\300d|\206=K\232\006\222;\030\030\320"
+	.string	"\322\254=D:\3014\255\371-!D\312\224\002+"
+	.string	"."
+	.string	"*"
+	.string	"\027\320\236\331\263[\316\362X\202\220\215\023\311\313\356B\355\270\367\364\374\257\276}\250\322\023\223\260\273\316\017\225q\353m\027\330F\260\255\022\3074\235\231>&\200\345\003u\215\327.\306\013\300\2662\024\020\215\355\247}\221\217xW\271\304\333\356\312\312dw9>\310<\333|@{\206\005[\246\332\021\"\377ysM\345\234\002\230\362e-1\265I\024\371\357\232.\256\223\326\205\226lV)\225\303>\266\273kM\331W=\037R\210\233\310\334u\030D\240\205\330\211>\n\025\321\323\320q!\017\024\2018\007\330\215\"`\307\300\361\3413\202\0221\216\240\206\265\307VS\316\270RZ&\265p\n"
+	.ascii	"`\251'\023Z\373\002\303E#Q\341\035L\271\004\333\254\246\200\273"
+	.ascii	"\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.part.0.50.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`8\002\375\021"
+	.string	"\206_oH\340\320(\035\360s\b\030\200L\331\316\2219\007\376\272\237\334\bF\202 \344\316\r[iSu`\246\247\261\2675\213\224T\032\223Ca\321\016}\352%\240\261\200u\373\245<+\2268b\300%\256D\217\210h\223O6\331;\245T"
+	.string	"W"
+	.string	"\\"
+	.string	"\217\371\t\3622\251s\354\272\360\324vK\004\257\016\371^]\236\200\367\372}\200\367j\037\306\366\3302i\367\274t\355i\256\r4>\273\033\276R\022'OgG\372\261w\310P\235~v\216\036\025\030\261\026\017\237\002\336\201\030\354\256\277\017w\275\355\005\266!\330SD\237\331\240Q\227\031t\333\331]\020e\352\317\214\376\315c\006\355\017\220\3616\343t\260+\020\265\335\355\246}\232\253 _c\333[\237\013\026\027nwE\276\327P\367\024\006_\375\001B\036E\206oa\240\232W\t\334ny\340\325\n>\317\371r\274L\252@\271\035Z\236\323\016&\374\224\367:i\202\0319\016!V37\351\213i\367n\251\213\355M\323nz\276\374\017\352\b\341\331e\311\325\330\0215\347\365\233\037\347\267\3756\357\354\357\334\\o1|l,ttB\254"
+	.string	"\313z\321`8\227\3719\265\321!V\271-\255\031\277f\220f\333\247j}2Z\314\203\257\b\245\247\230Pb\203\215\023\211DD\232\340\241\220P&\242\013\236G\036%\246\022\21182\221$`\020G(\214D&#\241\251$:\tG'\224\320\303\200\305\n\244S\230\"\212\247\020|\354\"4^\374\340VT\205\322\027\333"
+	.string	"&-)\315\2578\2641'\365g'\342\374\n\245\237=\002\f\354\007\307\242*\373-4X\360\0039 \200\002\031\033\255\003\207\210\001\276\242\025\005sxGaC\f\250\"\2352\2144\001\222(\f\363\013\367%\205v\020\273N\351\n8Nb\260\255\260\003\366-\240pNY\250\262U7w\307R\332\252l\341\304V(\005\030\224PP"
+	.string	"\203\270\335E\300\211V?T9\230\366\006\262\032\"\254\tY*\304K\274O`6@\264-p\007\342\365r\"i\r\333\230\262\306"
+	.ascii	"\250\275\220\310\006IKOxc"
+	.text
+	.section	.gnu.lto_blackboxTag2_3S32Length.part.0.55.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`\013\006= "
+	.string	"\006y\304H\260\326M:4#O\260^\202'\201{(PD\303\001T<w\004\264d0\"\271p\005NA\203\024\313\261\017\n\342\027\220\350<\225\216\261\2633\223_J/?\270 j\363=c\262\017\177[[\333\246\326\244\221\275\345N)\263"
+	.string	"\252"
+	.string	"\247"
+	.ascii	"\300\004\247f \236\032(\332\337Q\344\263\355\347\270\016#\373"
+	.ascii	"k\002c\374h\260\250\224\264\304\324Zw\247\003^\023\236\316\317"
+	.ascii	"\204\247\013\343F\277\331j\264q&\023c!\235+qF\276l\372\035\375"
+	.ascii	"\366\255\177\304\024\254\032^\252\236\250"
+	.string	"n\233zmj\205\244\251\030SxM\311Y\256\352I\352\262W\361I\341\360\241\220\342\253\370\242\036S\352:\001\034>)\031\316xLL\232~'N{\343/\204\234s\201\210&W\266_\322\254}y\361d\374\365\344\316\003S`%l?\336\254\241\342B\313\271.\235~=)u\307\305\034\324Z}\244\030w\356\366\013\330\216`S\023\001T\232F\245G*=\233\322\262)-N\351\030\225\016\2514\245\322\223J\357\224\226\367\361?\200\214\332\201\325J\"H\246\262\240In\034\310o\344_\342\221\217fI\t\026UXM\252\b\206\354/\335\321\203\2450,\247\260S\257-1\272\376#\313\220s\331\243\207~\304\033\242\226\334\310\205\370[E\210\034\210_\204\210\030\254\031\020\304!\257\017\244\310\017\342Q\253\310\003\222\200\365\3473\362\265<\236\372?\374\365\372T\277t\005KFX\255\025\301\251\033\210\226\362>\212\336\203\b"
+	.string	"\260>\371,\245}\036\007\032\275\007\321s\265Z\201!\2515%z?.\322\351\311G'\237\355(\333\331\276\213\312\224-\200-')\234\307V\224\220\325\324\2457\305\233\265\326\032\272\211\030&!t\255\034\013\206\263\206\253\3431q-e\205"
+	.ascii	"\316\275\362\006\351\202\220\225\356-k)\270\227]`\250\260\330"
+	.ascii	"\275\262\203\027\n\347\352dAI\222c\374z\241pw\356{S<\031\264"
+	.ascii	"\334\335s]\202\213\245.Je\374&\037\202|\032>Qx*\367[\237\321"
+	.ascii	"r\222"
+	.string	"B\222A\271W^\3347\030\f\006\275V\366\224\276\231\3226S\272\206J\323P\351\031*\255\243\322\271)\215\233\322\267)m\243\322\265\036~\201\203\005\037\236\2360\210G\250'\247C\350\035\005\026|0T\370\331\361\341\241\340\341G'\303NN\217\316\316\007C\216\206\335\016P\320N\201\001\377l\340\001\332q\370\371\001\332\215\237u\255\374\255\347\264\364LD\261\331\354\315\315\332\001\322\362n5\332\3505\303y\315:\331SH\335*\327\354mm\3040<[\215&\2674\264\231\334\316\354\275F\231x+\017\241z\261W\371\273B\234\333t\271\325\3416\267\367\302\"\342V\300\227m\305\275Q\2602\033\"[+)\257E\371lk=\304\2752\224\323\026\004\330gK\233\320\"\266W\246\351A\331\240\tn\353A\035\2313\204\352\255\274\277\302s\375\001\200\200\250aD\346\020cFF\002\021),H\222\016\320\"!\252\252\003\022"
+	.ascii	"\225E\t\246\2420\241\302\326\377\r E\212RtmY\206\357\030\206"
+	.ascii	"\221\217\202\264\277xJ\321\274\217\212\361Jl\351\2000\347\253"
+	.ascii	"\037\344\223\343'\024G\311\3534T\261W\316\356\026\376\007\202"
+	.ascii	"~\271Ph\243r\250\bh#\244\2362\262.m\325\005\241!v\217\213w\237"
+	.ascii	"S-iz\2670-|$^\261\f\361\251\357\363\303!\214dA\177=\034V\320"
+	.ascii	"z\323\254\260B@\335\305-\256?\0038\272\221\237\277\300\"\217"
+	.ascii	";\344\326\336r\3664\273\025\"\234\275\nf\352\372C\2435\334\233"
+	.ascii	"\217P\236_\024\2771\372_0V\352\036`\203TX*\224\035\320\005\322"
+	.ascii	"\3368\355wF\013\350\021\334\343*\3359\233\022\225-X(f9\007\364"
+	.ascii	"\231\002\231u\303a\250Yp\330U\0269\017\367\234~\266\247i"
+	.text
+	.section	.gnu.lto_blackboxTag8_8SVBLength.part.0.60.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`/\0045\032"
+	.string	"\206\356\240H\240\230Q:5i\300\\#\034\336B*q\343-F\356\263(\001\250 n?\227\206\342\365\211N\266\230Y\217\177a]\256\246\374Q\225\270\267\217\220\343\302;\\\353\313\030\260I\327\272^<\035^\231x\366}B\b\331r\247\024\207"
+	.string	"\222"
+	.string	"\204"
+	.string	"-j\226\322>\320s\262\013\2619\201\335\033LH\273\271\007\377\034A\374\347\234h\037H\254v\037\377!\263w3\367c;\200sJ!tewW\377Z\216"
+	.string	"\3747o"
+	.ascii	"\374\2478\034\216\343\330\373\314\335S\312\016~Se(\363m7\007"
+	.ascii	"\213~\001g\207H\307\006\343\337\fsvt\b\260\345L\027(^\322w\227"
+	.ascii	"4\033\216\234R\007\347\342\372\335'\217\336\250csqY\340a8aw-"
+	.ascii	"\306\270\305\333^a[\203='\004F~\223%K\336\271e\226[[m\310_\262"
+	.ascii	"t\005\027\225\341\310\225\374\235\221\230xS\023\207nO5G"
+	.string	"\362\225\270\360\004%%y\315\325U\270\365x\2739P&y\275&*\261R\205\207\341H~\004\273\2211\360D\365\330]\025\314V\325\370FjZf\003vv{\332!\375\241\230_\344EV\t\305t1iaO\274@RI\344]\201=\255\t\347TA\224\371BV\375\363\203\274\373\266\330\253\230\202\303\302\333\335\006\377,A\264\224\037\022\273\020\233\004\271\rW\242\245\034\233\252\217m\225\224\352\037\205\020!\257\243\372\243\023h\222bk\232\351\215}*&\\~\016\337\006\374'\365EO\321f\234\220\243T\037k\350\362\003\305\263\336\260S*-\206W\272\301o\206\322\252\322\362C\376\007\2202\0240\355\356\214Q\333\363%\335^\344gr\245?\351RV\367\236 \234\323\216\235m\003\230\275\263\360\036\241[\217\367\357Q\376'\277\356)\373Q\374\246'>\024&'\336\3003\236\311\0031g\301d^H|4-\230\213\002"
+	.string	"\0204\037Z,\031\360\305\202\311\274\220"
+	.string	"\r\003\341C+\306\203\013\246\305\342P\302\325!\004\314\213L\207U+\346E\304\nf\346\265\202\260\300\256\021\254\231\025\215\3135\263R\375K\251(\252T\034pNPS/\272\374Y\021\204\206n\325\306\247>\216\21554TV\226'I\373\356b\226\221\205~\352)U\247\322<\376\005Ne"
+	.string	"\004D\004\312LBY?ww\247\203\203\032\252\314\bE\215\360\336\201S?\r2\022\241\350\341\310\321\032Z\250\221@C\234RDj\244\202\2244\005\327\200\002\031\262\262m\022`\227\245\327J\211\241\306\376q\207\025\007\377\177[\027\006\n\305\270\211\254\"\333W\021\rN[\364\2605\242G\223\316\223\007B9s.\372\360*\360'\203$\205\212\253Ak\200\254@\220\340.\tF\0266\304gE\221\322J\361\035\246r!\037X\017\257I\255\351\341\n\r\r\250\332OF\275\355\223d\\Q\"I\035\013["
+	.ascii	"\022\234\022t\223\315nQq-\343,\334\273A\236\343\326\204\\\031"
+	.ascii	"\317\203\024@5\2011\rr/\214\213z,\242\013\360\203\224\220FY*"
+	.ascii	"\373\300\205\023I[`\227\007\321r.\033Q\354\370(92\360\257\360"
+	.ascii	"\374"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`5\005\245\024"
+	.string	"\326\035qJ\360\260(\035\024\036\341\326\305\264\344\312\364|\214\234\017I\352\213Kt\315\343\3165\\\375,\312,\221^\315;y\200\r~\316\356\371\3236\221MdX\251\033g6\250\312\2628\242\225\260o\373dY{Z\313O\326\330\215\230\254\334\001b"
+	.string	"Y"
+	.string	"]"
+	.string	"%\335\2025+\207\217\214\214W\257&ng\006F\330*K\273a i0d\343\030\230\234\013\256\256\266V\177\254N\255\032eS\365\tl\003\266\332\246O\305#\325#\241Q\354\200j"
+	.ascii	"\tD\354\270qj\005/q\034-\212\347r\271\234\251\021\210\343\270"
+	.ascii	"\342\304\234=\347\013\032w\242(\212\244\366BsNZ \027\004\371"
+	.ascii	"\002\372\001~\\\006\212>\243\242\323\222\236\205\217\205\r\225"
+	.ascii	"\236r\331\235\311\356|\273\263mu\227\305j\367\026\325/[\3751"
+	.ascii	"\326/\003Co\251\363\004\232e@\247\260"
+	.string	"\264\211\200>\t\320\261\225^aQ\024\347\fU\032\205S\272\004\245a=8@A'\375\212uh\322$\0015\362\306\246\246\244\261\f\302\366\345\371\363b\231Iw!\037\330\367\350\360PI\017\357\252\344\331\202C\212J\372\251d&\241SI\347\233\322\246\206\206\344\017]\241|\241`%\\\376j\032FT\221G\260\f\356\214\fYe\275'\222]5T\360T\221s\031r\236AGg\022\034\235o\024\344\034s\226\372\\\337E\326\362\255\251\323\213\372\214=\202~p!\324\351\310)\230\234\flzl\344\336\215\226\356]f\231\032\216\030\260\364Q\3513\366B\340\230\020\225>\3412*\006\220\215\352\335\005B\351\3006\b\357\212\344\0033.p\325\373G2\214\206\016\255z\017!\253w\346)wJ\004s\250a,\353\255\322\246\244Rn\360\002!\032R\007\021P\020\214q\310F(ii\n\035\340\252)\313P\025I7\017"
+	.string	"\205\3213\250\235\f\371(e\204E8\t\302h\276Z\300]\306.\313\342\373\332\236\205\272\034\342\343\022X\031W\200N\3475\234S\335P\001&\226p\037\331\210\006\001<\\f!\311Y\274\217\235#`r\003\203\002\344\225\023\315\264\306O\223\f\330\345-\005\203\302\206\035\r\212\375\266:z\333\271\202\213\372U\343\227\262\327w\316]y\220\b\301\306"
+	.ascii	",'\342\022\255\035T\321=\213H\224/\305\373z\03197Fb\257f\354"
+	.ascii	"y\354J\005\016\2733wk\342E\262\0060L\241_\221\211QD\240?1\303"
+	.ascii	"l\353\355\f\321\373\362U"
+	.text
+	.section	.gnu.lto_.refs.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\003\002"
+	.string	"\002"
+	.string	"\003\004\002"
+	.string	"\006"
+	.string	""
+	.string	"\005\t"
+	.string	"\001\005\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3fe94acabfe122d4,"e",@progbits
+	.string	"(\265/\375`N\031\335k"
+	.string	"j\250T%O0\222\322\031\016\273^\212\233\242P\356\3600\226MQ\344\343'z\250\320\377*\003\027@[\321=\207*\016\200cH@\021klr!(\200v\310\310\236;\217*$\242\b\250j\305\335\035pm\305\343\263\377\375\225,\240Q\304h\355\336\264\211\224)\341\001:\002^\002\350\222\365jx>\237O<2^1\033\346K\366vv\257>\2774XH\245\024]0[\304wl\277\\F\003\357\031\271Zk\214\006\263[i\307|\360\272\225|v\013\330-"
+	.string	"\235Ru\365\225\242\257@,l\307|\330\022\302\350nY.\273\256\330._/\013v\237\322\272\256=p\322\240\3340\372\263(R~@\245\241{W\244\373|\356\212\364\337/-\276:\2736[Yv]-\377v\255\327\313\3540\273\227\272;\005\t/Dt"
+	.string	"\202\321U\261&R \360\233\305D\232\\\256\355\265U\356\254\204a,\377f\255\326:{\310!\314\366\352^K\314H\243\245\311\350n-\225]?\266V\276\\{\3459K\353\352\354n\237\235\266/3u\214\272X\024):C\375Vy"
+	.string	"\\\335\r\234U\030\272\273\177\373\261\364\353\242H\3255\221.\233\237yq\300\277'\226\351\337\025l8\211\237]\030\363\373\231h\267K\367\371\367m\217\351\317\303\377pk\\3c\204\347\237K\370\371\267\177\342\347\026W6\202\357\374\f\202\t\tt@\203\t\327\371y\003\025\024\200\251\b{\317\317\016\\1\341<?\007\375\373\373w\206\177+\220\3419?+\360bU.\021\303\356"
+	.ascii	"\"\300\317\276\177?\200\341_\024^\3707\307\217\365\361\377\354"
+	.ascii	"\356_\tX\024m\371\227\205\177\211\376\035\3727\205\177A\370\327"
+	.ascii	"\202\177'\370W\350_\032\377\333\374+\343\177\334\2771\376]\340"
+	.ascii	"\337\236\177\201\376M\340_\004\376u\361/\213\177S\374\213\342"
+	.ascii	"\337\022\377\252\377\242\377\362\3778\377\337\374\227\373"
+	.string	"\017\366\337\203\377m\377\327\376\253\375/S\364\177\314\1771\377\307\376\207\360\277\210\377W\376\207\375\307\361_\313\177\347\377\240\377d\376\247x>\237\317\337\027\302\217\366\374?f\001V\256\334\300\324\347\223\225\324^\367\312\220\246)\273\236\327\023T\0236\236\225\340T4Yt=0\312\275f;UZ\272$\207P\357\3566\216\332k\033W\002\334\232\246\260H\030Q\365\005\016\3367\016\024\231\266-3\036\255+\2662?\314\255\233\271}\223\332}\337\260\3316\333\311\356%\004O\332\232\277\"d^qu\3376)\0319\2513\214.\335b\331%ng]>\206\026\021\313:c\364\f\245~\345\3245+\267f\343\022\350\336\225\t\225|\3338\r\214\335\306\265\241N<9\3224e\327\313%\020\017\336\021.A\340\276qc(\323j\245\013\213\217]\224$b\324\257\024u\323\254\232]\201\266\315'g\215M\017^M\365\013\224\372"
+	.ascii	"\245lj\250\322\351\026\306\350\027m\317|\321\254\213f\325\376"
+	.ascii	"\323\335\307\356\251\036Lpuu\271\261\353e\322\210\257\332\341"
+	.ascii	"v\272\265\272\233\005\317\223\013.\216\321M\373\033\t7&;d1\372"
+	.ascii	"\272\035c83\262*F\357\343\233\266R\262\273q\360\255\235<\356"
+	.ascii	"|}\313\263\2755\340?\332=\271\356\247&\235\n\005L\211\207\273"
+	.ascii	"h\254nc\211^;\211tR\031\221X\320(K\254\215$E;\255\032\271R)Q"
+	.ascii	"fs\257\275\275D\245t\001\2712\223\310\225i\374\351%\246\261{"
+	.ascii	"U\376 \275\224\214\213tR)\221N\246\262D/\265\261\235JH\324%\246"
+	.ascii	"\022i\306T\376 \235JJ\344\022\225\262\204S\263j\013\351\246\264"
+	.ascii	"\303\032\221K\375\344$\245\224\374AC\256\314N\323\275^L\2354"
+	.ascii	"\240[\212\231L\243\024\265aG\264\247#\027"
+	.string	"%\346\256p:V1{\t\r\031\205\331\035\345\310\243\235h\030W\264^\262hF+\251\036\302\324-@\257\335N\335\306m\264\3566v\367/)\265v\357\360\203l:9u/U8\265\224Q\214\251\233\275\332\302\224Hg\025\023(\226\305\331\354 \253q\233\235\206*\251:\215Vz\b\033\265\251$2\307h\031\035\273.l\275g:F\216\224\2751z\r\314\310\370d\345\220\244\t\257Z9bwB\024Y\022\306\270\244\3279%G%\007T\254\3140\312h?*0`\370\354\304\326\nG*]s\274\241\031\346|v6\223\321\300\307\272\222g\226eL\206\351I\026\222\247\312bx\f\223\232+\254\364\315\213\0340F\336\236\315\273&N\030e\262\277-Q\2512\266l`\3124\235a\224\213X3uij\215J\n\247f9\177ea1\337V\3671\306zL\323\310%\320\257\r\335\017jag1\035\344\020Y\210"
+	.string	"\303\"F\246\r\030{\3319cC\336\023\243^x\013w\351V\241#\007\365Tr\371st\302\254\344\240\234\251O\301T\366:k\371sr\276L\371@\325\325\365\265\306C\223K}\372\204\213\213\235\313\325Pi\027s\216\314\316\006\333\0266W\316\316u\323!\242\325$N\312\244~\312\024^\227\213"
+	.string	"\263\250%V\367\022\310\347\345\250\346\244\312y\365e}Y\243\230\212\257\252\315\0320F9\213\265vm\301[<yR\362\356\362\324o\213t\237\333\"\275On\210!\030k\241LUAQ\023C\304\031\213\265\234F8\201\t\341E\312\327Y\224(\\\204\233?1P\234\344T%_kF\270\250\034\004\007\261q9\335^\315(=\2149q\342\204\233\2521.\257\231Z\315\205\351run\216\361\320\221\311\272\363E1a\302M\"\270Z#\327K)\240\036#R\250\222"
+	.ascii	"qn2\346\023R&%%O\211\022\266\332\202\3274e\347\033\242\306I\024"
+	.ascii	"\233\312I8\311\306\251\275Kn\250\202,"
+	.string	"#\342\213\212\212\255\324\234\232\334\324\241\355H\325\331\n\312\324\0243\361X\204Yz\03593\343\302~X\263cz\232tM\214TF\214\260\324[\263wD~\251\361p\226\362Q2\005m\213Q\336a\305~Yqb\274P\033\242\036\305O\352O\037\323\31249\n\311%D\233J\204\b\027I\023\3234\205\245\366C\225 9\234\213\354W/\233lY\252&\n\222 Ep\023Cq\023+9yV\302\365\274\274\235%a!,\204\237\272\027\247\244i\n\253g\271B\2219\235\237v\326D\0351\244\267\245\276w\204\231\230\211\221jwVN\016L\254\214\trF\246UYK\343\226\226\201\302\203\303\350{A\226\276+/m\031\312\325\312\017\306D-\355\272\227\n<\020I\303\"\220\033:\212\206D\f\006H\001x\002P\005\337\017\237\242\321\006G!$\r\213@n\024\223\204C&\210\214\210HE\034&\212H\302b\022"
+	.string	"\347\001\243\307"
+	.string	"II\303\241!a\232\002\360\204\031*\370\212\302\026\220\216v\004{\354(\222pA\314!\f\376H\002\222\364C$,\006\203</\034!\361(\036\031\375v\b\207E\250\016\243aP\370#hD,\026\021}\344\b\006\177\316#\310\350\250\205\026\216\206Z\f/ \022\306@D\214a\247\030\024\372\361\024\205GE\030"
+	.string	" c\206\b?-T\324"
+	.string	"\342\240\021\024\032\026\345\020\022\221\204#\324"
+	.string	"\376\324"
+	.string	"\262"
+	.string	"\"DB\242@"
+	.ascii	"\034(\002hqc\004\035C#\"b\222\221\b\303\"\021\211\204\024\347"
+	.ascii	"\001\343\210h@qH\244\303\307\215\023C#\"\007HC\035\302\241\006"
+	.ascii	"*v\024\215\210H\037\364\334\030\001\207P"
+	.string	"P(E\f\030E$a\017\030<\212DFC\016d\314\3001#(\203H\030\002\001>\324\003\375\250\307\020)\250xt\204\024\2443T\364\321#\350\373\020\021ih4$RO\243\006\0035\204`\370]\310F\f\0331\322\013\331"
+	.string	"\002m\324"
+	.string	"\252\257\001\354\025\223\210EA\341\217\037\222\220\307\020Z\f\326"
+	.ascii	"\026\2032f\024\215\210\277\003\201\025\270\020\301\203\f\324"
+	.ascii	"!\030DFD\035GCF\303 \fG9X\030\022\026\345\b2\"\n[\b\032BJ\n\202"
+	.ascii	"\361\"H\221\236\2330_\230\230\330\215\267\264\260\264\roz\307"
+	.ascii	"\336\221\233@!MSX\275\314\001\350?6\352\337S\3328TH\0257V=\243"
+	.ascii	"\262\307e\255"
+	.string	"N\213Q~r^\257\317\317\257\374\364\331\002\030\n\027\"yi\034$\352\\\363&\016\036;w\316t(\303\341n\313\370\352\351\252\016\016\233\217\234]\235\363\215\230\2326\005\305\b\273\263(: \322\334\244\245H\210\334ia\224\341\030\216\353Tc\013\2315M\331\311\235\353\316t2\032\370X\317\331\344\346\211\r\223y\262d\211\025F\371\b\236\373]\241Br\366{{\3213\006\371F+\356w\366\266\366\330\225\251\335\300\250\0325\354\226\234#\263\373q\211\335\020D\333\331m\231\246x\345\375\264\250\375j\314\266\\\004\234E-\261z\350\272\212\340\361\332\231m\335D\241cbF\304\235\2205!\314\234\317\230\3414\037\225\236\016Y\312\224\2419\247\365\264\315\031\217\214^\005\202\034\250\222\3314F\023!23$\"\222$I\241\003\302\n\020\204bi\244\370\370\022\200D=\321\"e\314\024\211\214\224$\005\205:\303\032=\t"
+	.string	"\211\234Ku\227\352\315'\006\231\236\321rl\322\227\262\233\216\220\f\206\274\251\022\200&TS\262?\300C\215r\261\265\376t\345\004^\302\223#\314^\321p\242J[\211\3504N6h\035\013t\225\327qf\307\020\246\202p\"/\255$`Y\322'\344\3070\0351\341]\013\336\263\217\021\032ELjnV]\266O,xQ\273^0|C\300\352y\340*\035j\307}\n\340&\372\004\272\002&\020\026\265\214X\204\221"
+	.string	",\035\266E\002g\f\221##Z9ji\335\031\277\272\f\332\334\224Y\030v\274\355\303\201\335\263\215\303\365Y\373\210\035/nY5\320\270\212\244\262\224`&M\"\3437F"
+	.string	"|\230\352#x\216\205\035F\241B\371\332\346\301\351\327A\243\227\244\263\340\251g\247\374\300R\325\311\024\262\013akO\234\324+\235NR\217\300\355h\003\221I\020\351\230c\n\311\365&\307\263[\247/aL\232\031\201\260\3634.\220\303\362<\037\350\365BA\274n\221D0]7\233\031$.AXv\254\257I\246\265Nr\335\336\301\246N\025F\265p\2553\356\377\322\320K\024\334\242\227\n-\226d\342\370\352\265,*\367\023\311\320Y\246\025n\315\273n\254*+UF\271B\236\324v%\321\372s\212\206\f\213@\340\3147\275\322V\251Q\037I\200\021\024J;'N-\001\311\347\023\326yA\274\031#\240"
+	.string	"Mfd}Wz\317\277\351\207$\0247\371L,\360P\336\r5\232\363f\366\016w\023\215\354\324<\371\305\276\265\355?c_o%\364\035\255\3547\t^c(2+zr\252#9\361\303\370@\273\004W\333_\222\020>\374\212\236\371<\3407\032\274\032k4\372\272c-\315C&~\215_uDG\\\224(\362Lm\034\207\023\227'j\362\004\nc\342w\021\324<\365I\f\fu=\226\304\360\021\255\352\360\361\005\245>'!]\301\370v\225\301\024\202D\030\236\024\316\211X\366\255|\265\326Ob7\001V\367\016B5\223\336\377\350x6V\221\257\307\252\311r\302\332c\233t\350h\303<,\335\327\314n[\341\271-\217!$\250\022\200\362\211r \374\251\334\256\246#\362\233\205\245\037\230\211\237*\341\fR"
+	.string	"\245\362{\023\337\034\r"
+	.ascii	"C\216\311\354\203\033\2667\263\242\345Q\021\214\245Pi\306\267"
+	.ascii	"\204\334^`\234.\231\347\2741\"p\275I q\370j\337f\211\322\230"
+	.ascii	"\265\327\222\310$\344\223%\025Ig\\\336\021\240\265%V\341\300"
+	.ascii	"\322\270\312\321\324k\002\346\350\200n\036\327\367,w\316\204"
+	.ascii	"v\227q\264\2646\234\263D\345\253w{\205\357\221\022\303\307\204"
+	.ascii	"\366 \363k\344\374\013\200j\025\216r\2020\362\324u\317\001v9"
+	.ascii	"\330|\315^\315D\206\027\353\370\250\374Q\306U0\267\334\277t\231"
+	.ascii	"\005\211\022Z\361\314\252\312\003\251/\204\302\004&\376\273\037"
+	.ascii	"\264[\303j\340\024\367\001\307\242\202a8\263\344[\3247 \362\207"
+	.ascii	"t\017\324\216WY\272^;/A\350z\344\314\022\367/\345\345f\351\306"
+	.ascii	"\344\3733\257\200_\272NC\370\225q\361\347\320^n\276]y\032\375"
+	.ascii	"\253i3\366\243\201\031pA\343\314~\365\215d\230\311\231\017\340"
+	.ascii	"\"s|fg\303e\217\341\227\026\375\353+\216uX4\243\001\003}M\312"
+	.ascii	"\213<\342\021\344\276/\232\372\307p\013\257\277\356\334\276J"
+	.ascii	"=\371\311K\374\223\007_\354x\332\272z\377\271/\320\005\367S\261"
+	.ascii	"C\030.\365c\347\371\200}\251\362\306O\346\0060\212\313\234\227"
+	.ascii	"\354\237\350Q\277\337y{\330\271\275\363\374\376\233C\377\\\334"
+	.ascii	"\213\033\n\\\237\352V[\277\r\367G\036\316>\007\277-4.\2716m\305"
+	.ascii	"\\Z\234-\367\377\237\332\302\315\357\235\rfGeR#\215\263\335*"
+	.ascii	"n\301\246\r"
+	.text
+	.section	.gnu.lto_.symtab.3fe94acabfe122d4,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"blackboxWriteTag2_3SVariable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"blackboxUnsignedVBLength"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"blackboxSignedVBLength"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"blackboxTag2_3S32Length"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357"
+	.string	""
+	.string	""
+	.string	"blackboxTag2_3SVariableLength"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"blackboxTag8_8SVBLength"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3fe94acabfe122d4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,349 @@
+	.file	"blackbox_gyro_capture.c"
+	.section	.gnu.lto_.profile.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375 \332\035\004"
+	.string	"$\005\316"
+	.string	"\b"
+	.string	"\317\264\350\221\r\n\002"
+	.string	"\002\001\002\002\003\002\003\001\240\342\234\212\n\002\003\004\366\203\237\353\r\034\004\002\004\002\005\002\006\002\003\002\007\006\002\006\007\002\007\005\262\220\215\221\n\016\002\b\006\214\223\343\365\005\002\007\204\246\223\177\026\b\002\002\001\002\002\002\001"
+	.string	"\024"
+	.string	" "
+	.string	"\326\274/\254"
+	.string	"\231\001-\\\\\326v\026\314\350\202\027\373(l"
+	.ascii	"\354@\201\300\314k\274\234G\352\f\264\233\"\370\022\200]V\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375 -\375"
+	.string	""
+	.string	"\250!"
+	.string	"\005"
+	.string	""
+	.string	"\001\004\005"
+	.string	"\001\006"
+	.string	"\001\007"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.string	"*C\344\b\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"\215\004"
+	.string	"\"\007\032&\200K\322\001\300\334\304(\004\375\3311$\247\"\002\002\316\364\360\177\374\0073\\\006u\344L\265\220\250\036\265F\266$)3\2119\250\231t,\323\343 \034\212\3470@AR\327\216\030\224\264\225\206^p\025\255\f\247\202\250\270\261\256k2\264OD\002|\366\337?h\377\234\024\3336\372\305a\332\022\370\254q\227\266\205\207\376\004\017"
+	.string	")\305"
+	.ascii	"h\216\006\247\013\210.\301\216F\233X\340\006\026f\t\260\200\262"
+	.ascii	"\255\t\270\223\n<\013\342Y\tp\003X"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375 \307\205\003"
+	.string	"\242\305\021\034\260%\351\f\263\205\271"
+	.string	"\250\213IRA\005]a\030\2464\020D\366ZIv\2232\005\377\003\276_\020\244\335\261\035\306] \235\351\223d#JAU\325\306\354D\371\033\214\206\031\335\214r\023H\347\321\331\001\026\375\313G\020"
+	.string	"`\b\214\003\302\004Sw<\033\353\224(\315"
+	.ascii	"\272\303PY\254s(4\223\006U\030\030A\363\036\354$o\003X"
+	.text
+	.section	.gnu.lto_.pureconst.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\231\004\005\230\004\006\230\004\007\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375 \342\215\003"
+	.string	"\202E\020\030\300\027\206\003\377\377\377[s\237\311\371Zw\267\335nr\005\331{o\231R\"\022\212CQ\255\005PW\233\345j\303\263\351ixa\233\346h\213\346\204\355\031!\006}\260u\301<\260y\266E\243.\002\023"
+	.string	"\200\013\344{\302\b@ \253\354V%\353+q``EY,\321\220\f\016z>\320\224N\315v[J\207P\366\356\f"
+	.string	"\333\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureStart.7.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`\001\001\325\n"
+	.string	"6\322D; \261\322\001\244\212\032J\353\231Bf;ur\350\332\017yN\021\255\031\032\336a\314\331\324\356\177B\325\026+\f\272\273\215$\n`"
+	.string	"`\016\005@\343\211\002\340\255v\304+\t\";\2451"
+	.string	"3"
+	.string	"4"
+	.string	"\025\301\234\225\021c:l\377c\230MS@\021\360\233\241"
+	.string	"w\267\206\033\207\235\302\374\203\334C\253\305N\001\032v\327\224V\273\270\303\3336\260\035\262o\013o\2156\353$-\001\216\335U\360E>\342\362q\027-\361\242\247]\364_\343Ej\223\201\021r#\243A{\027\243\241\206\375\316\2067\333\343\232\361\bfv\003\267o\364_\016c\237\217s\311=\367\306\213\t\037:\226\333\246\273\2640x\350P\243}\372\nJ%\224\003\376\344\266y^\312AN\247\032m\210\233\250J\350\357\026.A\244\223\265J\221\245\310<]%Q\2049:\225\244\303\250>\230HT-OU\005!\330L\221\316\2722\315\263~v\373\316\206\267j\201S#\013'|\322}\255\336\202m \033"
+	.string	"`\2517\023\232\223\002\323\321\035"
+	.string	"\332\b\340;\205\304\251\020!l9ba,0\230S\351\n\306E"
+	.ascii	"\213\246r4\214``0\247\244\003.\002X@%GY\365\240\0139V\260\343"
+	.ascii	"e\210p9\026\355$\003"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureStop.8.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\035\007"
+	.string	"\"\31516Po\322\001"
+	.string	"+\231\336\235U#\230a~\2747\205\305\037\212H\213\267\213[\023\345\2656\266\033\263 \320\204oRPU\025\203\240\312\342\252-Z\021:\310&{\247\024\236\226V3\230\r\233\027\255\233\205K\202f\r\023s\310$\004\003\366 g\215\220\326\201\351\246U\211\241\264\312J\264\237\026\206\344\250e\305\003+\354k(;s\022MA\307\356\"\370\"\037\331\370\036\217\236\340\274w\217>\207z\234JH\032!$\317+\331\242\316\203\033\366\247\205!\033R|N\006Rv/J/;\212(\037\266_\231\263U\b,\004\\>&,\273+!\307\271?\316?\310\003:P\347\017@aw\375:\020\306\ro\333\300v\202\355\214\t"
+	.ascii	"`\2517\023\372\363\201\375\016\027\272\206c\2050^\206\b\227c"
+	.ascii	"\321N2"
+	.text
+	.section	.gnu.lto_writeSyncFrame.9.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`Z\001\205\r"
+	.string	"F\231YD\020\221\223\016K\277I\006\212\223!\003[O\335\255\252S\251z\301\261o\307\376'\024\242\344@zcl\344\365\235\207b\215\324\037\236\005\311\221\235\204*(@T\n\b\321A\261\200'\266`SCdo\"eJ\001B"
+	.string	"?"
+	.string	"K"
+	.string	"0\323U\2465\323\371\364;1\204\f\0012\273\030jp\354\007]\200\260}\216G6\215{.kq\270\260\222\202fw/\365\360\321s\344\237\3047\035\013\367\264\022\354\256\263c\311p\353m\023\260\215\300~\2156\311K\241\216\335\224\003\276\211{\232\377r\350\t\242|w\350\213\342\341uS2\335\210!e\215a\032\306\235\212v\205\223|\3474i\370R\224\263=.\265\203\375jw\327\332b?m=\035\237\016\237\216\313.\351\235/\363\026\f\032|>\361\320v\360 \302|*\312\331\223\026g\203!|EH\205\245\233\322iD\214'\243\332X6"
+	.string	"\3525\252\201J\241~%\207jj\245q\206\n\f\n\350'\223\352_\210\034\305\310\211\324\237>\004\316>@\033\005\223\022,\003\321\266\023\021\020\013Z\bI\206E\b\271$\214`\241+\333D\327G\001k%\240\3552\321\264\355\342x\373j\265E\201\210\217\244(\366\270\217z\312)\377\305\013\2142*\036\302\031\02646\002$\200;F\364\370K|&\035"
+	.string	"`\2517\023\272\236\002W\246\267mM\364\036\354\200\321\360&\243M\333\275\026\326\233\253P\260\205\221\315\224\271g\313\200fm\0364!6\017\332"
+	.ascii	"\370\002I\300#\240\335\245\244*R\211\003\270\214x\031\f\\\346"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_writeBlock.10.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`\213\005\255 "
+	.string	"\266\272\311G\200ZN:5\252\277\376\366\305\2754\026\371\376\224Cm\242\373\353H\013x\027\212\274O\312\330\353\byrD-\034\276!\177>.\307\263\035/\3722\312>\345N?\004\246\177$%_\221\313\325\177\356\332\b!dK\231d\264"
+	.string	"\236"
+	.string	"\300"
+	.string	"U\270\216`8\267\366\304)\347Z:\225\032\347O\212\203\020\254\264Z\245&\234'?\034p]\371(\373\341\346N\356\245<k\351Zk<\177Rg\221\353*\255\326*tr%\234'\r\\@y\222^W\236|ni\027\315\207V\325\024\342\003\212\330Vk\335u\221\356&\327\300\351\360k\366\322O\263$i\363\322\336\264"
+	.ascii	"\345\007|`\001\006\177?\351\333z\234\271\030\251)J\001\312L\307"
+	.ascii	"\207Ml\362xIyj\255:\301'\352\200\243\202NL*\331q\352u\272D\310"
+	.ascii	"\006\f\356x\177\370\005\3021`\220\307\331\264Pk]\006\006s|q\337"
+	.ascii	"\335\255\335\325\260K\306\b?^A\371\376\351e\250\251&>\356\356"
+	.ascii	"\212_\351\235\265V\b{+\377b\261\307:\271.||\340\311\275\257O"
+	.ascii	"<eRft\313b\342\343k\255\265\327\344\345\372\032\313\335$\030"
+	.ascii	"|\340r\027\030\231S\377v\207?\356\252\335\367\321\355\307\366"
+	.ascii	"\220\335  \346\375y\361\253\273\326\327\247y{\232\227\207yw\230"
+	.ascii	"W\247ys\232\027@\363\346(/N\363\342(\357\331\274f\363\226\224"
+	.ascii	"\227l^Jy\273y\231y\177\300\314QF M\2558\216o\225\214\fC\362\342"
+	.ascii	"O\345\327z\357~\367]{\257\315\025\003W4\250\311\253\026\272\256"
+	.ascii	"\243v\227\211p\24191\233Sr\350\272\016\3527\021\262=Q\345\250"
+	.ascii	"X\3135\256s\272t\303\340\272\006\320\274\366D\205\32392 .6&\304"
+	.ascii	"\213gf8}\261\263qbJ<\260\362\360\262\023\270\262/N\310\302\200"
+	.ascii	"9;\347\367\345I\230\331\304\017\002\316\332\bT+\233\266\331\245"
+	.ascii	"\361)\t\331\245\027\020\377\352\022\342D\253-\347B$b\004\037"
+	.ascii	"8\242<I\366\277\214\204u\323>\211k)\301\340\254V\247\b\273&n"
+	.ascii	"<\201\0032\326V\253\023\204\245q1\242\027\255j\255\021x\317R"
+	.ascii	"\264\003fl\003{\230Qy\262\373^\027R2\346\026\306\304\307\356"
+	.ascii	"Z\353\217\3764\263\360\f\324\233I=\031<\232\304Sja\224\242\354"
+	.ascii	"}\213\032\030!\301P:\342\025\021\371\220f\254 \222\341C\301\242"
+	.ascii	"\210\327\002\305\356E\217\347bW\204\224\264k0\264\276##\244\235"
+	.ascii	"\222\317\207\264\313\r\353{\310f\320A\306\324M\333\323o\206\316"
+	.ascii	"\323=\375'\252\246\267\371\333\032/\254\330\212\225'y\372P\216"
+	.ascii	"`\313\354\311\024\023\037\317\256Z\023\255\004\352Fc\241\373"
+	.ascii	"t\224O?\353MG\267\037\246O\003\365\207\247o\302\261\032\264\326"
+	.ascii	" \025\322\246\360qw\232\255\027\300j\315\201j\357\225:\275\243"
+	.ascii	"FM\247\311\037\030\267\254"
+	.string	"\2644h\314\020\355\261\216z\224\211\022\026\340\362]'fHp\340\356\206\016'\3767\272\326\310l\364\217\313\256\332\\r\250q4\303\240bf\204d$H\222$\351\200\002\021*\243z\020hF2\232$\035 FE\274\032%\365\207\232Rd\275\b\351\301\f\030\331AY\177\370\216\"\312\305\205\205/\306\200\033VE\3755\205\f\245\211\267\2366P\343;\306\324\204\306\347v\350I\247\201X\260|\260\026p\353\253\226\213\3722\212\245\025\265K4\0216\n\232\230!!,\177\243\320\353?\3609\t\037\232\227\374;\026\bi\252\025Gb\262R\353\233\223/\273\207\276\210+r\235{m\247\323\241Y\1774\226\2710\207\036\330j0\n\f\003p\013~\232\361\273<\341\230\240Szs1\033\r\262\310\361\252\030\316jD\322rZ8\by\334\333\374\207L\366H\251\271p\312Ms\243\036\233\377Ca\251C\013\343\327\344\204\303"
+	.ascii	"&}v\004\256(\270\177\202\033M\335\275\263\f\025"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureWriteBlocks.11.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`\311\003u\030"
+	.string	"\026\353\231I\300VQ:D\303\270>\020H)\301\200\3439\341\372\336\224\352\nF\354\216\222I\347\0310 \3660\247\357k\252\3772)\332/W\200O[_\t\320t\025%\333\262\013\267\216Ay\226\211\216\276pZ\355\227|B\310\336R&\031\204"
+	.string	"y"
+	.string	"\214"
+	.string	"t%\214\247{\0347\262\355\006\347oh\367\026Br<\270\324Z[2'\020\236\316\013\bO\033\306\212eY\226\237\277/\311\266\243H1\244c\263mO\243\342\211nw;j\212<@Dg\022ab\322<5)\3610)Nx\021t\342b\211\207sAS\021'\326.7\t"
+	.string	"\021\351z\230\362\211\217\bX\004\t\275\231D\bM\231Z\353\221\316>;\034\2638\241\326\272\254\333\005}S\337\335\032\273Ka\267\177\001\357WR\225\020\374\264\273\263'\351\214\265\326\007\373\034\327\341a/\343tqr\370\272\323}Nx\372V\360C\205w\344\333\341r\367w\343\356\355\236f\350\251i\333\305n\fk\325\274\252\346M5/9yQ\367}G\346\025\2317l^\332\274\263y\233y\371\274/"
+	.ascii	"\323\304C\321bHO\371U\240\322K]\242J3\356\373wm{\244M\335\267"
+	.ascii	"A\231\020\277\272s\300#b4\363'1\303iD\b\203jZ\222\223&\250"
+	.string	"\026\2138\331\020j`\022\236\035\355\3362\317<\303\021Q\317\234\325>;.\200o0\334+\371\222\r\356e,l\217\354\221\3604\302\217\027\236\321w\034\211NP\\q\245(K\267\021\231\022\206\024W\304&r3`h\310uXv\270l\261g\220\036\036\216\313\245\035\366s_fw\323\236Rzh\340b\017\002d\366\201\032\376C\346\243\033B\214\2659\360\246\0077\275Y\261a`\304QQwO'\f\034b\265\232\214V\001\307\0066\333\360Z-\254A\214\226S\353\340\202\325\314h 4\324|\230\275l`\256\r\257\026\007\231\353\246\005\243\341\264\0320\330Y\207\030\255U\233\315h\255\324\257~\222\253\036\307f\345\266,\3554\016\325\275=\322QEH?bL\357\034Y\275j\237\003O\020\252\272o\244\232lU_J\224T\267\230d#\024\262E(Z\272\370>k\255\225d\360U\307\364\005\025@\013*\340\0231"
+	.string	"\357\326\270\370\272e\001\231,\341\372\026L\250A<\345\024SjF$\220@F\242B:\240\002\0319\233\007\020H\210f\210\252\003\240P\304=W\202\265\\^\221-g\334?q\264\206cQ\313\\\363\300z\260\271\370\272\271%\352\371I7\207\355%\302@\373\2565\331\324V\301<P\214?\312\271\025f\024\357\327\026\334I\316\234\033\257\226Cob\323\262\275\356\375\020\266z*#\246\225\254\270\017\276\326\231\026\242\324\t#-D\3622T\350\270\370S[\035\240\243-H\312!n\2163f\311\202\207\257,JB\351\303\245\025<+\nf\360\2554"
+	.ascii	"\314x\372\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\355\005"
+	.string	"\322H!)\200M:$lD\304\030\007\320)A_i\312\211N\274#\317\300b0\033t\270wZ"
+	.string	""
+	.string	"\372\307H6!{\357-\267L\001\227\031]\220hRqq\345T\275pJ\226\307\2654\252\226\333K\272\205#\352\013?\020\253\276\227\374:x\320`"
+	.string	"\203\003\332\335\377#[\260@!\233\023I\301V\202\2516\333\203\340\33063a\016,\233\001\276\355\352=LRp\357?\3549\273\363\363\037\242\250\353\356&p\325\376k$\026"
+	.string	"M\203\344\315\325`h\227\202[\203\324\3140@="
+	.ascii	"8|\2004x\351O\301p\371u\262e0\261\235\004\200\033i\004$\n\007"
+	.ascii	"\271jr\200\204\305\b\215\245\236"
+	.text
+	.section	.gnu.lto_.refs.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375 \237\345\002"
+	.string	"\002H\022\026\260\027\262\034\f\3030\f\003\215M\255\221h\333\233\340M6\331[\246\0274A\017\220\025\240\026\265Ts\210\232J\220\226:TRG\255\212\251@\232@F\250\007m0*0>m\306e8\003H\317\030\213\036\232\364h\342\013\001\005"
+	.ascii	"w\214\364\006\323\016*\212]\270\350a\222\001"
+	.text
+	.section	.gnu.lto_.decls.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"(\265/\375`\366\017\305O"
+	.string	"\352\210\364\035Q0\224:\032\016\225\214\007\311\232MW\245\276\004\357\200W\300\260\215\361\324h\350\002\365\225\025\217\327\344\013]\216\223@V\r\213\241"
+	.string	"5\317\302\021G\217i3y\034"
+	.string	""
+	.string	"\370\027\200\327\343\321\021\233o\177\357\201\217a\342\345\275\227\016i+n\333\334M\312\024\215\001\303\001\321\001=:dl\206hiQ\277Bi\317\n\245\337-u\201\005J\321\345\362\357\325\256\273%\315B\306l2\252%\310\346\004\003\225\306\350W\211\372ef\331.\234\255{\210&\252\273\223X\260mn\330z}\277\026\313y\375\213?\027\266S\266\353"
+	.string	"\033\272\207C\fP2yl9\353\356\025A+\322)a\340\230\245\350_P?\266@)\317\t\352\267\353\337#\226\271W6\331M\354n\002n8d\301\372bt\267\226\3126S,\327\027\211\265r\333p\355u\327 Y:2\352\263@\351i\250\337*W \253a<"
+	.string	"\225\206\356\347sS\244\213D\356\253U\353\n\333!\207Q\006@M\367'\225`\201\322\315\312}\245\374\244F\344\332=<=z0i\303\350>Y\335\265\027(\r\352\375I}\214\370\027\312Z\t\325\212?\222\255\325\275\2428\001\207l\251\212\321\257\013\224\252\373\223\376\354\tl\376\363\363\f\017L\370\037\366oz\205\204\377Y\376-A\315\377-A{c\030.F\020a\211B\300"
+	.string	"\204\377\016\374W\221\342\347\007~\276\340\377\232\263\371\337\306\354\377\231\033\032\307\375\\\301\277\037\374\233\301\277\024\374\373\342_\006\376M\340\337\003\376-\340\337\240\177\007\370W\200\377c\377\315\374\267\362_\313\177\264\377d\377Q\370\267\347_\334\277'\376\335\371W\347_\365\177\332\3779\377\345\374\257\361?\316\1778\377\255\376+\360_\354\177\372|>\237?C\360\327\322\177g*\315ar\327\356N\301\264\264L6q\2548\225\354\236Z\272\321L\023\b\327\261\206\3321\241\221\247\376\261\243\273"
+	.string	"\246n\341\366Xw\013\273\373f|Z\273y\360)F11u#\203\230\372I\350\265\243\233\265\312t\035\213\314e2\3475\205\031\325<V\341Fu\231\322\2502\205X\375\203\215\032u\314a\r\243\353\272\323Ed\313\211\321U"
+	.ascii	"$U\023\243\314\2647\3101C6\341\343\333d\037\273%hm\341\"\265"
+	.ascii	"\004q:k\243\221\305YJ\375\271\307:oP\302\226Z7pQ\247MS\361\213"
+	.ascii	"\321s\361\347!/1\017\346\361Rzab\224\211l\3036\017\306;\240\222"
+	.ascii	"\020B1zN\242\346\270\035,\335u\177R\356\334YXv\364\322\201Q\333"
+	.ascii	"3\fG\034\222\226&-\305\215\312\313\207#s\344\b9\016q\256*\223"
+	.ascii	"\252f\026\232\n\225\210\245\212\025\243\377\306Y\263\233\262"
+	.ascii	"\212U\022+eK&)G\2115\3330Kf\307\220h`5'M\367\272f\333\254\233"
+	.string	"=[8\373f\331ls\315\266\211o\232Us\024\006\023\353\3341\244\005M\320\322X\201\331/8\235neZ\324bY\263\355\262_p\304\265\217\026<]\300X\263E\263N\234pm .\342\254\217b\266X\313\0057\\[\030\300\262\330\303\270\"h\305\016\024\2610\243\017\272XF\035\324s\223\272N^3{\346\353\3342w\001\343<\304\266\352^\327\211v\017w\031\300\3552`\003S2\224\222\242\347\242zn\365\213\246\256\230\035\263M\025K\306I\346lIY\243~U\244\265\347sU\244\3373\352\367\213\272^v\211m\n\355\330Wl\225\270\016qmf\367\032\335H!\236g\0251L\2108S\241a\256\310\312\366K\352\005\210\2348kxy\006b\311R52\236\026f5\220\333\025-do\316\272\210\024\332\301\362\201\365e\311Y\352\334\304\005\214\237Q\253\210 \0332\312L\216Cv\371J3\004G\375:"
+	.string	"H\375\300\244\302\242>\0025+\310\361\310(+\371\031\236:\363C\r\243,\304\301x\220d\316\200`\364n8\311\177\235\232\227e\230%F\031\tCm\363b\034\304q_<\266\304\232\352k\330\213\245\374\303\371\310\257\243\363E\344\007%\323\310\257s\243B\326C\324\225z\264*\231\344\"\273\344$\226H%a\264\b\030\352\244\214\021Lv B$\001\264 NU<Q\342\034\361\302\350Q\341\323\023;-\262kN1$R\250\247\207\036\\B\312x\340\341\251\326\005\331d\344\301@\350\240jK\23266\213\327\270\202|\233\034\204\233@X[\310\202\025$\213\235(M\306p=Q\317G\306\341\234C\223s`'\265\273o\313b\020\247\263F\032\205\330\351hx\272\255\272\373"
+	.ascii	"\033\230\251%T\030}-\b\365\374\247=4v7\016\266\265\215"
+	.string	"K<_\333\256\320\177bk\333\300\177\264kDF\272\235\210i\243J]\031\366\360\005\372U\335B\024\275\266\261\310T\n\213G\2009\242X\273\b\001\3154\322\305UyD\223\315\275\3666Qy\204\241\270&\215\3055)\364ibR\330\275\036}\212ZC\341\026\231\312c\221\231<\242hb\013\2339,\242\022\223\307\242\022\311\243O\2219<\026\211\312#\212)1J\202\360qDY\266^Eb71=\r\215>c\3055\331e\335\253\265\243\215\rt?%\215eC!\333\2654\326\264\024:\214~\277\rj\024\360\033-|\274\006\202E1n'\216|\272\336N\210\003\025\216v=\033<`/\205\337ha\243\307\373\005\201C\273#%$]\2177\364\003*\r\r\200\204\244\324\353\371z\267`\321n\006\0360\225\301\367\273\021\364\365n.\030\355\220\320\340\016\210c\207#\005\256\220@\222\217\200\340\317(X#\210\003"
+	.ascii	"t=^\r\340\013:\037R\013=?;\034F\277\017t=\0355vA\336O\006\334"
+	.ascii	"u\274\337\256\267\263\241~\002\242\b\210b\344\270=\206\f\tdH"
+	.ascii	"\220>\206\214\\N\006QN=Q\256\026,\002\272\016\250\344\343\305"
+	.ascii	"\260\373%\341\200E@\273\030xA\235Q\212\344\363qPd\353)\375~\273"
+	.ascii	"\030|\267#\243\335\r\024\211g\024Ds\354\216z!\354\004\213\\\274"
+	.ascii	"\b\366xJ*\360h\227\224\344\373\035\341\202\277\001\301}I\273"
+	.ascii	"\337P\320\347\373\r\355\2700\243\203\rT`Q\215\031\276\237\016"
+	.ascii	"\032\006\004\213\210r\301\036\357\366\\n\306\002)\230@C\325\265"
+	.ascii	"\330\375\224\202IF\272\242\242\034\276\026^\320\031!\2650\324"
+	.ascii	"\343\031\341\030\322\375\200C-X\314\350`\003\337O\207\215\033"
+	.ascii	"p\207\224\204\303\bx\353b'tk\007$\313+S\226\n\311\331\223Q\346"
+	.ascii	"\252\241-\243\264\254\2708a\200\2305wK\355\215\020X\252\252H"
+	.ascii	"\215]=\241\250P1\235p\346l\361\325\031\22717h5\241ZG\232\340"
+	.ascii	"\302(\026\026O\tJ\326\310\254e\246\252n\\;\274\020\2178O\341"
+	.ascii	"q\nQ3\204Q\316b\346B\231\351\302\305d)/\312\266\242\312PY\302"
+	.ascii	"\315\301P\035\274\240tq>y\302WA\311\232\231\025M\223*\233\225"
+	.ascii	"\2451K\242\234\257lP\276V!l\204m\371\306y\205Q.\202\241l\023"
+	.ascii	"\001\266\252\t\263\332\352D\332\22344Fo\303R\277\b\244\373\\"
+	.ascii	"\004\322\333\244\234\374N\230j\263\032\310\"\221,3u\026\201-"
+	.ascii	"\250\221,g\0204FfHDd$I\222\016\001\005\204 \210\245<\017\022"
+	.ascii	"\340e9\016\032\206HDD\232\224T\n\373\034{\201\321s\304\002\233"
+	.ascii	"=\037\316\304\225vi?\272\023,\035{\211\262z\r\215x\016\322"
+	.string	"\003\343\261\227\030\324\362N\242\237\350Q\254\314m\253\350g\237\370\265\354\205\025m\"\342\372\342\346\034B\353\307\345\371\2631\032%\034\302\316\b\0015\022\310\211\013\225\254\317G\274\357\355c\373\245]!\025??{?>\205\303\235\303\324\213\027\232\352s\267\2078A\342\202\004\b\362\345\003H=\354\035\345sE\"\274\231Z\304\216 6\364\263\320\223y\253\037\231\306\334\037\367\307L(\354\002\342ki\235\245\207.\231a$\342\210\214I\244\233SY7\032\266,\225m\321\256`\336\340h\377\237\262+"
+	.string	"W\304\315\024\374\201d\\B\020\332G;"
+	.string	"\0163\300U6\314m\251\370'\035T\350\232\303.o\001p\034l\236\234v\023\224\034\242\023\253z\230\364G9(5\364\\"
+	.string	"<\005\2309&\317\325\331\206\2256\264\363v\270\004\340\206!\352\2143=W\346\366\372\332\214\274dS\2463j\340\240\262%\235+\254\227\267/$f\022\036I%\245\246\f#J"
+	.string	"\253K\354\033\313\375L>\351!\277V\377x\260\024\213\316#2\024\301\255\236\034|}8\032\327E\351\313i\020\2339\362}p\275\313"
+	.string	"Q<j\337uy\016I?\320]\256'J\020\213V\350\256\322H-iM/\2749\366H\221y\363\017\020\2766F'4\372\200\372\021\007\274S\365\325\251\033\264B\2247\374\023\315\315\017@GN\307\353\226\375\034\227\345\274\362\213\2049\030\200[`\357k\013qFI_/k\207I\343E\272\260@5\303\203T!e\323\016<?d\261|\202\215\204\323e\222\233\225T\205\021;\312\264\177\024<\251\312=I\016\235\275\232J\270yqS\304\001\346\003?\026)O\265\270\254\325\024\362e\330\307\361\353\366q\236=\274\276\277^h\344\260X\304}q\364\001o/\207\301\351\205\035=[\273-\257\342\251\374\273\362w\353\350\024n\331J\354\327sG\362\024\353;\374\217\354\202\3011\346~q\246\345-1\026\306\212/\232\270\317\036\024|\361\017\"=D#\003\236"
+	.ascii	"&\367A<\365\207m\245\267i\314sd^\025"
+	.text
+	.section	.gnu.lto_.symtab.c965ec6fb6cbbdb1,"e",@progbits
+	.string	"blackboxGyroCapture"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"blackboxGyroCaptureStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"blackboxGyroCaptureStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"blackboxGyroCaptureWriteBlocks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c965ec6fb6cbbdb1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1664 @@
+	.file	"blackbox_io.c"
+	.section	.gnu.lto_.profile.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`V\001\225\f"
+	.string	"\204\021J\002"
+	.string	"\""
+	.string	"\272\207\313\263\004\n\002"
+	.string	"\002\001\002\002\003\001\240\342\234\212\n\002\324\213\264\330\t\n\004\002\004\002\005\002\004\004\002\004\003\334\266\343\236\t \006\005\002\007\007\002\007"
+	.string	"\006\002\006\004\367\267\243\372\b\002\005\210\210\322\322\003\004\006\307\371\343\335\013\022\002\b\002\b\002\t\002\n\002\013\007\b\013\f\246\301\351\215\f\002\r\375\206\225\206\002\002\002\f\002\f\016\352\263\360\321\b\017\376\201\211\336\n\006\r\002\r\020\021\360\335\231z"
+	.string	"\022\240\375\260\243\r\006\002\b\002\016\002\002\017\024\311\231\247\372\017"
+	.string	"\025\375\310\312\261\n\032\f\002\f\026\027\213\306\222\331\t\004\020\002\020\030\274\205\242\255\006"
+	.string	"\031\354\274\251\243\005\032\354\242\353\256\006\024\r\002\r\002\b\002\021\002\002\002\022\002\023\002\021\b\002\b\034\036\214\371\233\377\006\002\037\321\266\274\351\r \256\262\262\264\r\n\003\002\001!\273\367\322\222\001\"\371\215\217\377\f\002\f#\306\321\247\216\t\001$\257\253\237\334\n\n\024%&\272\306\270\313\016\002\002\024\002\024"
+	.string	"7 P\0023f\347\001\372B\302\234\217\033Z\342e\302\251(ub\273\363"
+	.ascii	"E\001\020\306\276\202\231,\215\334\303A\013H%\225\3406\351\266"
+	.ascii	"x\305\220;\302\302\204@j\003\216\013\312\f\264\030\0247\220\262"
+	.ascii	"\267\n\310\362<\252\006Pv<X[\302\342\023\030\355`\217\177\201"
+	.ascii	"r\007<^\361F\266x\2560\372\006,|\267\361DO\312\273[\2206D \006"
+	.ascii	"\357~\203\235Y\025w\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\225\004"
+	.string	"b\006\022\031pM\322\001\374\377\377\377\377?\016"
+	.string	"\230c^\322oS\032\0045\262eJ\001N\375\212R\312\211$\242B\036\016\033\023-c\213\335\366\025\232\250\021\352\341\302,\t\0025\251\002u4\370"
+	.ascii	"\360\226\325\244\337\350e\355n\221\237! p\0021i\036\342\031\355"
+	.ascii	"\202p\334A\240H\236\317X\203\365\232u\372c\242\245\246H\020\207"
+	.ascii	"\361|\013\231\216c\340\201\037\004\340\306H\037\2650[\340\306"
+	.ascii	" \035\210\021\337\033\235s/-\021\344\200\307\001i\007nX\233C"
+	.text
+	.section	.gnu.lto_.inline.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\375\004\315\025"
+	.string	"\246[gI\340\262(\215\001\360\200\337\373s?\241?\376BU\270W\363\366\274\234*\245\375/\002[l\301\244?\020\316\346\266.\325?\031f\001\220l\315,\020\034\253\021\004q\234\030\025!\230\231\351\274\331\n(\037\355\223v\304H#[\356\024J"
+	.string	"Q"
+	.string	"Z"
+	.string	"O\377\221\367\267\226\207O\214Kj\177\266\350\r\237\030\227"
+	.string	"\243\365\366F\212S\353K488aM\310\334r{i\357}\307\255\265\326\357/\324Z]\017\372O;o\346iUf\204\357\264\026\246\317\025\365!s\313\021>\311\240\036\001\265\326\320\243U1\224\255\341\342\247,\006\230\214\207\001\235\001\223\361\230\374\245\200\203\274\017)\216f\003\206\307Z\333\013\210\037p/\334\027\351+\322G\336<\244\277$\320\252\330\234\257\212\211T4Q\350n\267\333\341\241\247e&\241\302\236\240\345\374\274C\242\0011t4\034\034\\2R\022\254$k\220&\371Gz\252\262\340tJ\024h\215\f\233\037\245Q,\252\003\003{5\030\331\331Z\024.X\216\202O\333\363\202\033\021.\240\205,\311\235\222\235,I\032\245M\256\357\307\325\325\350VD\333\207\331\212\310"
+	.string	"V+\302)\241\341&\\\204Es\001\263|36!\200\204\274\300\204D\255\257\221\023\214\024AI\2264\246\235\364\001\003\340\364N\366\005#\"\303w\351\223\305mHQ\363\350\214-\b\013\021j'm\242Ve\b\037J\207\254\266K]\340\205\212\362\006N\200\256hm\205\013\034\241\007|\3507\205\260\266C\213\334\354A~\250Q\255R\206\b\265\255Q\030\016P\0021\246\252\314\003\022"
+	.ascii	"Ua\207$\021\020\232\261QPPP\222\026\2465\320\001\3741\020\230"
+	.ascii	"c\321\300h\221[\210\013\215:\335kM)\364pH\351\310\237\030\265"
+	.ascii	"sw\251I\206dYR\362\265\n\332\205\"\037+\235\353\375[\277\202"
+	.ascii	"uG\001\017mM8\t)V~\331c\324\303\335\"\315F'G\244\325\336\241"
+	.ascii	"}\3472U\031\354@'\002\n\3104A\257A\260T\330\245\025\373\342\n"
+	.ascii	",\353\005a\0375\2433\334\241LF}\313\255\370V\347\301\033w\206"
+	.ascii	"\227\322\233\257\205\324\230\024BV\263\252\271,\220\215\363\330"
+	.ascii	"N\354Gy\n\263\\\226\225\270\305\024?)\277Q\313\226\314\034\341"
+	.ascii	"\270\301\022WN\232f.\363\202\351qA\222\035,O\332\001\003\"\330"
+	.ascii	"\214{_\365\2057\n\006z|>\306\214(\002V&\305[\371\330\320\013"
+	.ascii	"!\021\322\232\306)\246\246\324f\316;\356\205\307\212\346\225"
+	.ascii	"\376\253\375\361\240\326\303\302\250C\374(\202\212\225\252\216"
+	.ascii	"\373\304\203\300\035"
+	.text
+	.section	.gnu.lto_.jmpfuncs.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\335\003u\016"
+	.string	"f\323=60\305(\351\300\300\300\300BU7/,\276\270\225\342\340``"
+	.string	"\031\303\316\342\177x\024\245!T\307\227\221R#K\207\376\224\374\322\377\001\377!\377\2026\260\033![\246*"
+	.string	"4"
+	.string	"."
+	.string	"\370\242z\022\337\375\355\365\223\355\207\224\301\326S;\322\013\313\324\253\275\206\262\r%\366\207\016\273\016\353\347\243\005_k\307\\y\207\n?\347.I\213\"=`\013\261L\224\2539,\351\344j\267\366D,Su\265\252\352;%N&=@>T\366\245\262\235\r\266\035\030\3500\202%(*\216h\277\375x\003g0\217\320\254\232l5\211mV\316\245Y\017,\177\373@J%W\271\f.\230\"0\245s\020\261\r\370\263\031f\301\366\347\\u\003\217486\252=!\220\033d1\341\036e\024/\316;|\303\317\360/\210REw\331\374\n\177\002\200\"\266\223\267\223XD\354\363H\024!D`\250AI\306\210h\222\024\3327P\002!\346\254\270\001\021\260$G\fdHh\350\2500\215\001"
+	.ascii	"\334\221\374\370\222\3252\206\016Z\220\276)\242\262Oz1oU\322"
+	.ascii	"Y|\332\341\243!I\272\266\244%\242\313\203w6-\263\265\276\213"
+	.ascii	"\325\343ziLIT\204&p'\305\363d\fP\013\320e\214\020/\230V\300\301"
+	.ascii	"\323\005\212\232$\304rY9;\272`\317i\b\364$\366u\2448\002\352"
+	.ascii	" \324Z\277\020\227\230\355p#`a8\312%\004\352\332t\003^\b\210"
+	.ascii	"L\312\352A\367\347\321m~/3\237Z9i\250\272f\263\275\364\322\256"
+	.ascii	"\b\271\243s\307M\017\242\"\247P\241h`a(\260j\316\360\256\271"
+	.ascii	"\2025\024\225\336<M\243(\364\020\325\224\245\323\352\303\361"
+	.ascii	"\352.\037"
+	.text
+	.section	.gnu.lto_.pureconst.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375 P5\002"
+	.string	"\002\205\020\033\240E\215\001\253\246O\275\272\004"
+	.string	"p\002\300\177\177\262E\253\213jb\307\31626\313\266\200\003l\227[^9\345\223K\026\"g\016 \017\217;\336H`|q\305\023G\374p\303\325P8\341\307\356N\020"
+	.text
+	.section	.gnu.lto_.ipa_modref.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`L\001\315\b"
+	.string	"r\313$+pK3\034\374?:\375\377\251\0228"
+	.string	""
+	.string	"\264\003\177\364G9\375\024\341\246\321SYr^\377N"
+	.string	"\022\352S\025\0210m\244m)S;\225%)\273\312U\226\264\354\232\273\260\332r9:\236\306\217\021O\371\0031\364P\207\206~\320!\303\202\305\nL\350\037|\233\013\276b\272\262\177\2718\260"
+	.string	"\251r\252e\236)gz@d\343'\300\255\274uN\345S'E\271\324\344!UNH\360<0\256\367^F\3240\306\376\214:\2332B\345\023\345\b\033|%\002> \220\202\021\253\353%\006N\213Q\3505\202J`]\346\222+\334B1\002\343\n\330\020\207\320\250\003[\202\335\255\230\r\030l7\213\255\236\374\002 \333\267\373B\020\361 \356C \2751\260\022\200\224\\T\007f #\217\334z%q\002\037\034\253E\027\306\200\212b\230\341\006\"H[\206`\3300\255d\006\240\303\221L\024'\346\006z\313*\300\363\035+\256\237M\226\221Hs\270\245nbY]\207\027\360"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.72c9d2841057a0a4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.41.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\335\n"
+	.string	"\306\223KD\020\311*\035"
+	.string	"\2160W\021\030\036\223U\234\323\374\005\2173\001\206\225@V\3043\334HYd\r\353\2663X\303\370\312V\203\032T\223\247m\356\252\216\226\242\364\001\200J\274:\362\234\272\310l\332ZB\366\336)\0056"
+	.string	"8"
+	.string	"6"
+	.string	"\007\\\005(\354nG\001<|\2453\364?;G\034W\257.\2475\242\346@@\303\330\252\237\227L\202\317>QF\326\234\032\212\335\365\024\307\226{\273\355\013\333\030\366g\232\327\003\b\005\273+\027,l\271-\210]\366\333\377\314\035\177\300\t\204\227\251\276',\034\261\206`\302.)\361\315\023\233o&\377\300}\333\334\201\373\346\320\226p2\300\236\0260ek\216\020R\032P\n\263\212\253\324\243\022\243Eh\315\n\336\346\037\302}o\006\234=B2/V\332\271^J\023\272\262\311\325\2440\373uw\327t\306\276\354\256\\\251\317\323@\201\031\244S\205\005\251\364\2058@\217G \317\264!\342\211:F!\017Qw2\205>\272\321\007v\240\217=T\351\353R\236\367u\035r\037S\226PV\335\314Jm\020p^4\203\201\020"
+	.string	"8\263\002K=\231\001a\330`ay6\350\030\2265\332"
+	.ascii	"\020N6\016X\323e\364W\227\005l\021\227y\252&\247hj\017"
+	.text
+	.section	.gnu.lto_blackboxWrite.46.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`h\004\375\033"
+	.string	"\026r\256G\240\232M:\244\325\013\231\037\317\313\360Z\277e"
+	.string	"\201\3644\032%\030\246\260\026\377\263\347\372\341tT\320\035\266h\336kL\256v\347Oe\026\f9\215g\024\375\270\225\223\245\247V\3365e\353\037CF\266\021\2627\221R\246\233"
+	.string	"\211"
+	.string	"\240"
+	.string	"\377\002\177r\311\377\314\177\004\t\345Z%\275ku\262\262R+\326\203C\030w\276\374\315,\326T\335&]\272,6\265\326Z\373\330rg\244,6\212t\206\315\345W\306S\332\331\342t,\371\013\"\003.\207\337\023\032\250\236\216\215!\200\352\335\330q\277\230n\024a\362\261\030\036\220z\n\333/&\034\241\317\226\240N\307\324\306\316\031\013\\\246\301\223\301\341^\255\206(8h\240z9\266C"
+	.string	"^QdH^.t\340\304\245\211\306[b\026\205j\255\347\035\257\267\317\331\377[\377\203\3760D\001\232\204Y\3426\377\211\026J\321X\353R\320\367\311j\031}\251v\036\305\321\021\335\331-^Q\023\006\344v\262;\260qmt\233{g8\345\026k\227\330\276TWq\343\335\355\374\336\350\316\355\275Z\005K\322T\371p\034\347\307\312q\377\376\rkK\375k\265\333C\371<\314\337\021\371:\315\2475?G\344\317B>\331|Y\363c\315\037)_\234|\312\374\031\362\273\371\334\374\365!}^\006\264j\255\021\307M\r\316\255!\3777\265N\370vm\260\274*\225\\\270@{\326\002\276\354\301\300\242\270f\377^a\223(\331\333c\267,\227$\f\0312\320\235d\213L\264\302|2-\2746\032kY\226XO&ZU>\002,\366\277\241\003\357nl\237\245\335Z\256\026\036>|\240;\305^\3402"
+	.ascii	"\313\n\363\355\250?\034\205\307W\322x\361\b{x6\355\037\204\b"
+	.ascii	"\336\335}d\264\322\377\021K\205\304Xk\r\372J\331)%L\f\r\321\235"
+	.ascii	"\264c\300\236\236\035\341\351\214\016\3168U\231j\255?\"\233\240"
+	.ascii	"\022\277Y!;\247`o\001\332\035F/R\020\301\230/\002\272\035\r\305"
+	.ascii	"\270\235\260\025\021\2458Q[qD\244\242V\204\324\242\006\224\340"
+	.ascii	"7\026FH5\027\267\033R\215\304\302mX[\352B\270\316\315~\370/\207"
+	.ascii	"\224D\366j\205r\255\304\\;\262|\221\013x\247y\372/\215\224G\312"
+	.ascii	"\360t\314\267\323\024\200T\321\301\371\331@\202\223\305t:\314"
+	.ascii	"\216)\223l\226\030\336c\241\265N\017\310\242\320\205Lp\354_\227"
+	.ascii	"%\373A\323\032Z\203\331\265\321\234\246y\261\225U\267\234\236"
+	.ascii	"=*K\325\365\303I\354\337\267\001\035\273A\323\030\332\277\377"
+	.ascii	"\263\376\017\264^e\022\013S5X\250q \247\220SNQ0\023FAq\r\007"
+	.ascii	"p\002\021\261\263n\0210\275\204\244.Le\r`\200\202\021\"Q\222"
+	.ascii	"\247pX\223YV6+4\"\236\"\006\233<\261\256>f\266\215\037%\342\270"
+	.ascii	"c\277\266\250\210\2325\217l\325p8U8\226E\234\201\322\211Z\026"
+	.ascii	"P\314W++\364\337\346vb\f\251\305\"\022\202\273j\032\245\267x"
+	.ascii	"j\272\341\337\236\346J\235*\265\336{1C\270H4yb\341;\256\026\\"
+	.ascii	"\005\r\274=f?W\t \322\367\242\302[\341A(DO\216w\033;<\252\235"
+	.ascii	"{\342\310\360\335yi\fU\265\030#_+\261\304\017\360[\321\nsA+d"
+	.ascii	"\256\261l\201xE^\021R\242\211\273\032"
+	.text
+	.section	.gnu.lto_blackboxWriteString.47.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`M\002U\024"
+	.string	"F\247\211I\320\320*\035{=\006B;T\034ja\023j*9\224}5\0303\241j\331\344Z\217\374\027\333\034u\355\351\373\376V\026`\374\212\270]\363\201\276A\251G\340\033-eNn\254\376\303\247\024\324\316\025\r\314#B\366\336r'\031t"
+	.string	"r"
+	.string	"s"
+	.string	"\335\274\220\035\021O\227'\276\304M\264v\205&O7>\007D\353\001\273\033\005\362\217z:/\240\236\362\315R\331zX\351dQ\266\366%$|\265\321\3650\301\316Fm\324\360:C\031\315\007\3238\233%F\277\240\367.mcLR"
+	.string	"9\030>\t\234?.\316"
+	.ascii	"F4\031\035#l\222\310\200\035\036\343\266A\312\260Aw\257\254\215"
+	.ascii	"\027\276\244\357nlwMve\007\247{V=\225l\222\341WsB\347%\203\273"
+	.ascii	"<\230\344\234\317\217\356f\031\267{2\235\367\227H\"\225\033\262"
+	.ascii	"\334:\345\322\357|\347{\276\314r\245\007\353\006,\n\361u\323"
+	.ascii	"\004q\364\020\r\002\361\235\277\247\265\347yo;\366=+$\272n\242"
+	.ascii	"O\316\305\257\273\027\354\310\274g7\222M\366\342\327\315Cp\272"
+	.ascii	"$\342\251\334\275\316Q\264\316\263p\217n\334\n\026\001\227\251"
+	.ascii	"\247\225Q7l\034fw7\0359\211O\374`\0074\013\001\223\301=I\312"
+	.ascii	"\273')\371\332\202\304\330\265\225)3\330\371hG\354k!\033\347"
+	.ascii	"\226d\211wUV\344k\314"
+	.string	"\223]K$\352\372\326\335\007\"\f\001\177.\231\303\224\3630\2029\267\177\211\316\350'2n\345\013T\311\003xh\304\244\321\356\262\\\205J\354\216)\330\373\236b\265\3079]\n,\371Z\023bT\\RZ*k\365\302\254oJd\265\"\241\302\n\205%u\322\202\202rY9Q\241R0,\224\210\201]\275\244\300\240bV+\030T\007\357u\306\355{'\331\024\375T\023\357dfQ\344\367\376\231\231\234\241\027\303B\316\355NJ\342\031\262\211e\217v\364\222\301-\361\344\220!\354f\314D\300d\260\332\024\325\314\023\307\300 \022KLb\333\256\252VvP\343@-*\261\273\217\263\001) `\2021\244\312\003`\365\b\007lr\0301\356Or\221\2346\230)\327,\320\026\264jA\273\n\201`~\2566\301\024\n@acy\2536\275\001\272\214\203n\333\344\231\020\255\330n\244\r\260\261\200\022{\300\250*\bi"
+	.ascii	"\006jA\204w\227t\340\363\3650\260\202\0225r\271\321\336\"\016"
+	.ascii	"\374z{"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.48.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375 \310-\005"
+	.string	"\202\t#*pm:\240}C\021\3401\030\274\376BC\252$r\313jCr\344Uap\f}[\253j\002\031\333\311\224*.B\364\367\226)\246T\275\024\223j1h\325\260\346\343\252\034\223b\221I\025\\!\013lJj\305\346\004j+=\202&7\033\334\242\314\330\013\370\177K\317\216\224\207#\304\347\277\224H\017\005@\033\333;9\263E\013~_\317g\351\204\377\247\324l\2661\363.g\007\\W\331(H\374w\344:\314Z\256m\203\355\203\355+\b"
+	.ascii	"`\25173\340\234\031\002\276\274.\343_\306\005\227n\321\316'"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.49.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`D\001%\r"
+	.string	"vXVB \217\223\016c\265Y\327\225\270P\027\n\034\2525\261\352\3541`:G\362\311f \310\306pH\017#\210\340\355\217\032\322\3469\262\332\302Z"
+	.string	"\300L"
+	.string	"D2\247Zs!\261\350$\230E\322\310\336R\246\024D"
+	.string	"A"
+	.string	"B"
+	.ascii	"+D\330\366\2605V\260\300"
+	.string	"\303\331\273\017\242\223\234\200\230\264\354v\227\222<{\204\232\231\257=\336t\003[jSQ1\352p\270\271n\241jCB\001\221\031i\320\304tv\327\311\2158\334\325m;\260\235\300~)\025N\202\303\332\r1\360G\274\344\202\037\342\321\030:\362\334\243\337Q=\246\336\364\003,V\\J>\362\263\273-u\304\276~\337\347b\025\261\235\266\234\206Nk\246\023#\363ZX\032\234vE_j\275\030)\036\314\244\275\201\3459UU\31579\001-_NB!\265P\035\361S\370'uQ\332=\341\2430\312\312\017\250\036\235\334\202\254\2246\304~\t\333(}I\331\325\356\3016*\271E\240\t\t\345\013\333\001\366p\260\317\203\f\230F\004O\206\004\215k\302'c\343\362\2008.N\001c\024 \200.\013\030\006\2724\335\307\341\252\2101*\251\323I\372Yu\323\003@K\255\252P7\330\206\232\272\371\335\335\201\361c\251"
+	.string	"\021\213\267\2318\200\035"
+	.ascii	"`\325\343X\350\fo(U\220LM8P\354\251\330K\005\n\216Iz\002i-\333"
+	.ascii	"\260\036x\005\240\344)g\240\022E\251=\217\332\3000\343p\321\366"
+	.ascii	"\251\260\3115\273\017\221\201\3377\204\032j\336/\252\rp\267s"
+	.ascii	"\313\023"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.50.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\272\007\2050"
+	.string	"\272WX\023EP^N:\007\356U\013\032X\247y!\216\243%\343C4\237\210\333\211\032\245\313\347\031/\243\326\355[\002\210\3415\334\207\274\361%\323 \243q"
+	.ascii	"\210\273\201q\242\030X\301\361\301%\377\277\231\2315b\t!{'\031"
+	.ascii	"$\001\013\001!\001p\375*\217\273\\\377\312\261`=\313\325_.\246"
+	.ascii	"\360\213M\254C\264\275\020ke\006\216 \025\332\257\375)\247\202"
+	.ascii	"\365h\2156\311l\351\370\306\372\3367\252\340k;h\277\"}\210\375"
+	.ascii	"\252^\210\375\332m\243\233\370\365\335X\335\304~\020\001\253"
+	.ascii	"\335G\327z\234-G\027\026\300\367\215.e\265\273\027\n\002\372"
+	.ascii	"\3619\032\213\304\241\260\r\262\253\232\261\333O^\310\202\031"
+	.ascii	"<8i\320\332\244.mo\213\027\330\201\332~\324#\247\231\364z\314"
+	.ascii	"5\025\351L^\327}T%.\201X\256\3074S\0030\311\202\036\312\206\217"
+	.ascii	"Al\201t\320\276\334n\254\373R\034nq\341\302\223\242}\221\235"
+	.ascii	"(DE\032^\21796\367\002J\230dX\030l\222\273jG\007\b'E\373*{\253"
+	.ascii	"\204)\246\"\275\357{=f\020\034\f;\253&h\342\201\035\275\270\324"
+	.ascii	"!5ir\272\360\372,\267\253\352\002\26194G\257-Uh\317I\332\345"
+	.ascii	"\216sxi\341\254<\032\263\311\016\265\335\271\r\275\2642\0166"
+	.ascii	"\275\357\333x\351\365\365\006\360\356Su7U7K\027}[9\331v\344\004"
+	.ascii	"\001\\\363\223\356\335\364c7H\354\222j~\366\025K\224\223\234"
+	.ascii	"u\342\370\264p\236\036\302\177_\202\3556q\002\177I\224/\367#"
+	.ascii	"\371J\222\247\225\223\3750GJ\342\300\267\335\265\215\311\371"
+	.ascii	")\246\177\227\265\364\301\275\275/\230\276]\317i\361\215\330"
+	.ascii	"\257-\210\267L\036\334\333{\366*\325u\367\034\006oM\262\367M"
+	.ascii	"\2769\007/_%\342\231\026\336\323\335)\356EE\373\276ZL}.\357\342"
+	.ascii	"\324/\362\265\237\240\360\227_\373P\354\327\347C\217\2458\231"
+	.ascii	"4\245L\311\302\323\356\250\022\347g\367\363t:\225vvv7\356\002"
+	.ascii	"D\334G-n\243[y\027=\313\233\250q\003=\372\376i\334>E\334\307"
+	.ascii	"\"n#\213\273H\304Mlq\017[\334\302\026w;\304\035\024\342f[\334"
+	.ascii	"+\213[\r\342\316,\356#`\300\246I\306\246#\357E\337\036S=o\336"
+	.ascii	"j\207\344\321\337\312\237\345\271\373})\237\263q-=\245\306\246"
+	.ascii	"\t\367\276\357\003|\303L\314\254\235\256=Y\177\302<\314\003\260"
+	.ascii	"pEQ\3365c\333,\314\347R\242<\236\003\272fC\334\264\264\034\201"
+	.ascii	"\211\036\251\3301\f\235<a~F\237\201\355\373\275N\206\247\253"
+	.ascii	"\246\306~5^\301\363\366\327\256\275\314\2532\246\264/\211\003"
+	.ascii	")\334\321\241\247\315\317~\030\021\266_\203\275\2350\036+~\r"
+	.ascii	"\366'\347\310Ob\215\224h|\246\323\351\337\223\330\242l\224\033"
+	.ascii	"s5\225x\332\301\334\207\36380\\6\327\r\273n\354\327|\267\364"
+	.ascii	"S\302?\031\337E\302\256y\351}7\t{2gs\267\273\304m\202\277\ff"
+	.ascii	"\365\035\313\311\356v\237\274\215\013\205\300\032\323\0336\007"
+	.ascii	"\257\244\221\006\363\323\313\232\271'lv\366\361\306{\027\312"
+	.ascii	"\256\371h\034\256\347B'\364\363\256\306\225\242\272T.\260\027"
+	.ascii	"\330\257k\016:\357\244vj.\312\031M\327\236\306\3604\031\332\367"
+	.ascii	"}\231\372e@hh\213|U\263\360O\214tJ\316\3753\307\333\320/\322"
+	.ascii	"\035<x\360\262\364\313\302\323\026\200O\346D\271;\304\b\374e"
+	.ascii	"\036\032\371\361J\003\375\242\201\214\027VNRKSH))\344S\221\213"
+	.ascii	"\250\026SH\fC\032P,\2466@Y9\211`q\345\264\302(c\n\031eE\365\301"
+	.ascii	"\252\nIE\354\247\006\310(\0254\220+`<9\305X\2614\025\345$\265"
+	.ascii	"\364T%c\251\201\201FRAU-Y!\221UK\304\254\253ov\366\241\327\020"
+	.ascii	"\307M\256.\350w\331 \266\300\256:c\007\2762\271:\025o\035\250"
+	.ascii	"\2012\316\312\356&U(?\377\336\367\303](\2148\233p\177Yxz\200"
+	.ascii	"\r\330\215 .:@\350\200X\237\f\300/\016\216\004\037\356\017\374"
+	.ascii	"\245O\036R\301LB\276\360\375\344g\037s\021\3161\263\3203eN\276"
+	.ascii	"\347\330q\356\360\271\033\306\032sU\034\037\004\334\355\nq\313"
+	.ascii	"\360\227\306|\034\003\315S~\371\241'\261$*\355;\346g\303`\203"
+	.ascii	"\271\200\022\330\236\270=91Jc"
+	.string	"~\266\t'Db6\001d\330\321\367\035\373\271\013\317\310\364\305\251\023.\370Q1\007~\351w\224\213\f\256\350\211\333\223+\346\247\320\233\337\021b\022;\314F@\322\342\322h\341<\b\350\260\301\033\346g+81\177\356X\354\007\340X\2355\001\200\213\250a\034\345\230BF14\"\"\243 IZ\fP\002!\244\354\352\001\020`H\232$\311r\213\\\322\252\244\340\220\205\b\202\277B0\376\262\354]u\222\264\263{6\tk9S\301\246(\277\363\207\016\342S\375+\004\n\003\022\370\372\301\332\214\320m\225\223n\337+\356ti2j\352\036\356M(\017\263\327\351\357\257\"r\322\362.\f,5H\234\035Vv[N\367dl\017\246B$p\370\332\271(\204\025\314\021\220\240I\271\2240\250\3434\350\317\213CE\202\371\3233\031\032\217\343\030\245\366%\347\375\340%\031\033\"Y\276\022\364(+z\036K\365U$\354"
+	.string	"d\tG\237\307\227\216_\267&\310\033\030\226Cx\037R\027\235\337\252\303h\005\357\226\214g\261\0260\354\227\351\2633\327\3215\251\3477\372\200\345\227\f\020\035\211\210\205s\277>*\303\243Z\215\025OA\013/\271\206O\217\216\200\307\352p\347@\252\341\341\233\200"
+	.string	"\372\326D\036\035\222\240\313rr*\276o\224\374`\377Q\020C\022\024\t\305\254\272\033\033\031\200\264"
+	.ascii	"\223\253Qx\210\330\341\277\331H\335\202gR\001"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.51.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\355\t"
+	.string	"\366\321C: \261\322\001x$\216\213\013\001D\341PAW\342\021\021R\320\3122\3243\246(\242\271\375dc\344\202\321\314\352\204\373\025\020\002\340\b8\320\256\262\274T\344\205@\250\215\020\271S\n1"
+	.string	"2"
+	.string	"2"
+	.string	"\345\356~Jr\325;\235*\377(\377\210c\370\216\340\332\005\334\\2\240\221\325)x\224\"\002ckN"
+	.string	"\207\335\365\024G\220\333\273\355\006\333\t\366\007\002\251\316\275+\303Il\204V[\315\234mcM\225\331\357Vc\366\247\357=\346U\336H\260\354~\344r\226\364^Ll\037d\225]s\333l\337\222s\255\004\242UC\317l_\273\0332\b!\303\211\363\214K\r\246*\323\037t\256\005*4\255y\263\215z\212\206g\267\265\340\323^\333\360K\356\271#5/\336\363\003.\211@\023\004\007H\232(\215(H\237\205iT\361\225N\250O\204`\360\"\342\364e\200\340\351\003\331V\357Vc\0178\344JY\260\r\035\206,m\302\211\353>\323\0061\346\003\020"
+	.ascii	"`\2517\023\272\202\002\263\370*[\221\037\314\262Y\333g\262\250"
+	.ascii	"\242\020\006\376p\217k\242{\b\371e\bq\351b\266\363\026f\031"
+	.text
+	.section	.gnu.lto_blackboxLogDirCreated.52.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"E\013"
+	.string	"\366\324M@\020Q\225\016\030\343K\252kO>KP\030Q\302\360N\303\235Z\323\372\325L\307\262\222\0376\204\233\305\304<\376\342Y\367\225\177\0047"
+	.string	"E"
+	.string	"J\205\360\242\001\251 w\204\223>\267\237\354\275eJ\001:"
+	.string	";"
+	.string	";"
+	.string	"\036!\273\233A\020\347.#T\316\177\353\223\316\023]vx\246G\211\3510\"x\301B\005\300+\305J\207\017(\336\272f\360H\252\221\006\273k\355<\0167v\333\016l3\260o \206'\373\254_\261\003$Zln\354nx\345\330\017\251b\004\305\366\325\276\211\257\270\263B\017\260{\242\221b\367K`\005\222K\177\037\200]J."
+	.string	"\2734g\203\374KmD\304\nC'*\370!.\335\371\350\273K\377\203]F`\304\b\2611\322\327A<\324H\305\250\nm\320\005}\347\bE\352\271\320\260\002:\204),\240z\271f\224\024\207\375\211\024\242\354\307\335\335\240mz\264\314\246\2110\261f\231\032\b\026&f\243]$`\262\t\232\013'\323\266Nf\251xR\310l\231g\316-\243|\373\270\360\344\007%>F\220$!jb6\347\036\223\200\214\335]\340\273\036\022"
+	.string	"`\2517\023\032\204b\350\030\312\340w\274\f\255"
+	.ascii	"\201\205\272\n\032\016]A\bk\025\340\273X\320\254\246\214\273"
+	.ascii	"\034\263\311\246\304\2431\250="
+	.text
+	.section	.gnu.lto_blackboxLogFileCreated.53.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`Z\001m\r"
+	.string	"\266\027XD"
+	.string	"\223\223\016\370\352\252Rr\321\266\267\003\242vF,\2603\250\372\021\3449r\031C\"j3Rd\207\241\377#\233\231;\332\"J\301\b\335\307\277dU\325\2536\r\241D <\033\240\022\244\273[\333{o\231RB"
+	.string	">"
+	.string	"F"
+	.string	"\232\255\343\336\207\335\204\220aaE\315\356^\320\303\265\313\bU\363\337\362\316\306\235\\\256<z\270\225\303\b\352`>"
+	.string	"\\J4\360\261hx\313\365\002\227R\335,\330]\353\306e\270\347m3\260\235\300\376K\266w\242\260\203\375\270\273k\250\262\277\372\243\252U\325\367\020\230Q\003\273\261\213\241\025dg\244\214\210\217\355\253\375\023G\241}\205z\200]U\216\030\273\336\001#\340\\\332\273\200y\3119h^:7\315C\205\322\206\n\207\224\266lg\1771qX\034NV\267\212\320.\271\nT\210fw\025\370)\3562\301\007qi\n&\372\355\3227\231\227\035\225\035&6\240hK?\226.\006\0325#\034@\342\207\013\216\024\005\022\"$\245\007\321$QVrP!\013\031!\215HB.\b\245\021v\221N%\227\250\200\263\b\"\247KB\226\235\256\217\267\207*7\2401\203\002S2\312\304\370\250a\275\203\371FDyl\332#\207\201\275\330|=J\260\024\2720\205hZl<\036\037"
+	.string	"`\25173\340\235! \024*\205\356\201\306\200\023\020_\257\320"
+	.ascii	"*Ns\021l\267)\321K1\316j\021x/V\215oe\033\020\327))\237\212\025"
+	.ascii	" ph\bJ\b\253`\312%\330f5e\334\345\236M>\245\256F\253\366"
+	.text
+	.section	.gnu.lto_blackboxCreateLogFile.54.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\234\002\355\025"
+	.string	"\206*\224K\300\322Q:\257B\362\243\221\221m G)\260\207\004\211\375\257\370\303H6*@=f\210\372*\252\nM8G\261Q\037\274\230+\303!\341\275\366\205E\364\004$\240\003\221\200D\311\341u\002\304\375S@\211\b\327\216X\262\211\334I\006~"
+	.string	"v"
+	.string	"~"
+	.string	"\266\022\247S\032\r\201@u\367\022\224\257(\343\276\305]\334\316\253){\210e(\005\325\255C\340u\013\224\257\333t\023\362u\344%\344\353\336vu\274\367\323*\241(\234 \261\273]\354\263\365c\357;\322\333\353\310\364\266\377=\205X<u\270\327q\2454<\002\240\0031\032"
+	.ascii	"RAt\341i\216.GG\242\235\363\205\037\360T<u;\247\252\005\335\275"
+	.ascii	"\364\324\215\370\222\337]\332\356J\330\245F\001+\276\017s\227"
+	.ascii	"[\231\313\260\225\335}`\017\3431f\373\240\327\315P\243?_\367"
+	.ascii	"5\362\365,bJE\361lhq\267\207\243\334\243\024\204\203\270\314"
+	.ascii	"\263K\302Z=\370U\335\367%+\335:\322\035G\272\314t)\323}\200\223"
+	.ascii	"\335\215\031\215n\021\305 \315T\221R<\370\363~\337y\367\273\007"
+	.ascii	"\356\205\301UB\271a\365\215Pq\250\273\033\224\257\177\321\177"
+	.ascii	"+\262\357\375\305\355\276\225{V\345\304$\354ai\212\252r.|\210"
+	.ascii	"\320\216\035\263\370\277\227QK<\272b\222s\350W\211T\361y?\247"
+	.ascii	"\033\372\343cw\367\330\272\212I\370\303S\321\334\345\206'\231"
+	.ascii	"\305\021\210G&\213\312\273K\363\242\r\002\232\272\033\001\315"
+	.ascii	"q\362\030\271\362W\316\201d\036\371\224\231k\020gju\033I2\345"
+	.ascii	"\013_w"
+	.string	"\210F&R\216\026\231\201\222H\204\340\255)M\026\225\363\316(\246\242t~\033y\016[{\361\266\2600h\2558x\3202\";-f!F\013\211\311\274fb1\262\013\345\302Z3\231K\207\331\013\f\354\025\363\342\232\221\275d\\0Z\315\325J\331\031M\214\346\3220\233\321\\\"\275>\363l\005\023L6\234\333\232\261\373\204\002(\037-n\t=p\002\005\332\324m\363\363\300\327p9\371\3516\177\276J\023\202\312\353\201/\202\231\374\234\2731\f\364\347R\033%\230L\306\355\017C\356\312>\003\306\244)\351\277\253\370\bW\364\b, `\002)\205E\017\034\310J\b \212L\207V\351d\275\217\317{\022%O\t\031\204(\021\231S\341(\fgl\\T\007\034\374\321B6\323\232\365\355\363\rI11F\334\006,.\024\341\370!\037\2403\343Z\2348\016\t6\264 z\237r\f\275\"L\"\270\343\361\344\331"
+	.ascii	"_eq\227a\021\357\205\332\361\236D:\027}\002"
+	.text
+	.section	.gnu.lto_blackboxSDCardBeginLog.55.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`b\n]9"
+	.string	"\272d\034\026BP^N:\375\314\360p\236pF\270\214\340>o\213\200\337 {\325\314\307\203:\345\233\314\362v\354K\364\240s\367\236\3747\205\b"
+	.string	"1@\222\npv\002\226R\252\017XB\251\332\233Y#\226H\333;\311L\0017\001L\001\016\224\272\214rW\332\363.g)\024\013\346a\262nw\365\f$\237\007 07\1779K\237\330\253J\302\317\365\353\270\274K\326\275\340Pb\032\345\034\205L[\316P'\366\352\204\265\261\272\215W\337\235\325\327r\2716\366\343\276%\353R\035\317M(\361G\231\350_\316w\021\256v\006\351\003\254W\331'\255W\373o\317:\\\373\375Q\324\376r\316\017\2566\005\366jW\270\220\325\355\245Q\260!\230\231\263K`\316R&\334\244\213Z\210\333'!\035\031\025!\211\216\306\"\221\035\256*"
+	.string	"!\276m\237\371\244U\311\216>H8oJw$\274\022=t\033\336\210i\271\033\324\3115B\2069\313nQ\023\b\222#\207Mrg@\026\210\353N\230\260 'B\200\006\304\354G!\204?3\202\002\200Ay\336\rj\344\032\367\240fB\245\234\363\335\240En\321m\017J\344\022\205w\r\217\237\357A\217\b5\244\021\002v\271#p\203\016\271\354\332\207d_\205\026\274\002\215 \303\234\302c!'\337\345~\277\302\232W\275H\016@-\312v4\350\232\327Z\304S\303+\2069W!\005\261\343b\230\330\357\260)\347\334\367\031\006\344\035\340\335\377\352\356\257nbS~\364\274\276\\\363,\013\364\341!6\311\303\002\270u\247EC|r+Nk\374\024\353\305J:<]\267P\013\270\335+X\334?/F\306q\243\307\205\231\375\274_\356j i\340_K\271T\234\326\346\335\304\274\203\375c c\243\006"
+	.ascii	"\247\361\365"
+	.string	"\353\264\037\201\2725\352\234\376\236\360^x\307\0328,\371,N_\016\356\323\226\317\334\364\337\264\337\220\257\354\256\351\263i?6g\346\315\372\313\365j\337g\006ckS\323m\326~\367\231\263\361\314y\017uw\213\247Y\2629g\f\3753G\343\242\317v\265_<\335?\237\326\253\307Y\264\260\231i\211\333\272\323\376o\227\037eM!N\353^\343e\007\021\214\323\372\367\337\363\005LO\343%\335E\267% o/\270\335[\301\307\274\023\364\355\244\343m\244\276}t\274mDt\273\350x\033y\274Md\274}$\3366\026o\027\211\267\211\354m\366\336\036\366m\365\336\306\303\333w\275\375\tk\220\273@?X\323\234\301\246\202YO=\023\345v\377\230\337\313/\275\260\373}\272\337u\033\033\353e\372\342\365\345\234\215_\372bN\246\215c\0028\2049\243q\370\233\273\323^\200}\\1\350\353\361\272\037\016O\231\002\234"
+	.string	"/\300$\3704\005q\335iw\267d\367y\205\005\243\227\207\002\214\3558\211\223\200\023\340\223\371\215\3429\017Y\270\305~[d}\031u-n\217\031\334\357\332#-\222\373\247\004\374\273_\214\354\r\254\312_\0233\223\254\335}\267^\327&Y\212\346\2343\250o\274\365*\221sO \340\322U\217\370_^\327\246\031\2106i\235\340'\255C|\304\257\373\035\244k\273.\315\266\243\021\337\312\t\375s\027\264\321\340j\321\210\225\232\2309\304ElC\260O\223\n\327\371"
+	.ascii	"\203\254\031qZG8\021\337\215\016\017\204\213\337>Y?\367\3006"
+	.ascii	"\n\333Ja\2334\032\\e\247\264U\356\237D\354\342\254\211\231\335"
+	.ascii	"\017\224|v\267W\016\330\276\371\261\321fa\331\256\262\370O!["
+	.ascii	"w:\304\306+v\336\312\300\3641QSlW\025_\004\027\343\356vK\207"
+	.ascii	"\373\247\212?\344\254\0133\357\206\210\027AD\234\326\327\261"
+	.ascii	"b|4\272<\227\036\343:oe\230O\222\266@\026\357V\332\254`\031\032"
+	.ascii	"\270\237\003\341\204\354\313y\353\317\317\335OD\201h\316\315"
+	.ascii	"?I\260M\251\006&P\334?\033\031'=c\tj\212*\206\325\222I*\306\025"
+	.ascii	"UT\325\024\223ry\305$\240K\204\360 l'\024%\204"
+	.string	"\275\224\221\244Ra<]\250\247+\243jJi\245B)\005U\343\352\204TT\225\324\325\r)\0252\222T\003\260\224VU \260\224I\253()\345T\f\244\2242i\"\031c\355\250\245\344\324S\216$\024\215(\030TPLUS0j0E)\227LK\t:iCJ\311d\225L*\231\214\322\255\343%M%\305H]\231\341\377\260\202R\312\352\312\b\377vM\302_\335\235\204\273i\013s\265\016\351\321\337\034\235\357%\215\270\335Z|\264\372\334/{C\364\270\364\356`\217L\017\351z\246\202s\244,\333Fl\t4\203\033[\237\264c\005\372\330Zl\3713\203\003t\272}-@+R \255A^\321&H\030\347\r^\3501\030x\364\347GXI\227\347\3035\302\335Z\206\264\006\357\237GxI;\306*1\3028O\220P\034\234_9r\364\230w\320\350Z\323\265\b\027\251q\270\237\273\\\313u\221\264^"
+	.string	"\2429o9\257Y\313\343d\242G\276Z\037\367\317\"\254\324$2\004\351\344#\024\267u\247\027\026\345!q\232]\2417`2F\353\307yw\213;\266<p\305\356"
+	.string	"\006\002f\270DaN]\230\031\344\206\265c,\224\250\017\2418\005oO4\242\200\306\250\201$\304\030S\b\321\210\210\210&MZ\003p\002\221)+v\021PAC7#\211*i\317`\374Ci\001\335-2\035\215|\355\342\230\316N\214\243\025\023ZB"
+	.string	"\376>\275\346\333\352\322\244\3031t\377\265FNS#E\001X7\004\304B \275\006L\367\017\034\017}\236q\362"
+	.string	"8Mc\303B\3462\324Z\367\342-_\261|B\244\241\361D0\004\0313&\304\271''\334\256g\002\274\352BpWR<\351\371\033w\343\033\331\346\253\212iB\023\342\361\202\035u\222\364\226>"
+	.string	"\223uc\346eK\004,\001FM\b\2637f,\260`\020\r\020\345\362\273k\327y\203\023\022F\271\241\227\271\365\234\231\270\rk\271\336O*\240\007lbLM\311]_\360!\005\221\266\271\371\324\262:\311\322\021\320\fv\"\035\"\374\"\253\201\356\360}\266\034m\332\036\r\344\035\372 %n\360\255hv/\222\315?H\310\b\300\310H(\027[H1;|o\307\314\320\331\230\2610\316,\257\212\037\361\270\342N\211\361\026\256F\236\206S\352\262L\r\n\035%\026S\357\030Y\257[J9\321b\003f\376\335\3714\344\034\255z\363S\337\276oG\n\251\370^\034\345%\301G3\034T\340\024\351\366\324Cw)\b\222!\250\"\t'\243\225j\315\231!\252>3\302Q\364-\313q\321\344\334\313\025\231\331\257U\310\001;11Mu\354\337\t\336\203\2225~\030w 7f\2725\205H\002\227\003\214\201\275\005"
+	.ascii	"\303\310M\002\025"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.56.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\335\n"
+	.string	"\026\324J>\020Q\225\016|\360Y\301\201\217l\"\340\323Q>\201|\001\340\314\315c\0213?\327\302\224\n6\204\343\220\3643\240\210\314\203`\002"
+	.string	"P\004D.\364b\337\211\2027\006\025g\266\021\262\245L)9"
+	.string	"6"
+	.string	";"
+	.string	"%\022\237\024\253\3350S\021\347\03659\237\363x\323#J\364\342\244Z\361y\270\306\016\326'F\344\353\242\002\r\253\017"
+	.string	">O\346c\262\273N\357\013\335\327m7\260\215\300>\201\277\2567=\262D.L\200\235l\331a\227\032\302~\\\035\331NcNg\246\377\320B \016\337\275\326.\250ecSW\213\022\2667v\304\t\026l\314=$\201\004\004[\336\3034C\0305R\235rf@H\333aw\017Th\2448y\303*\024\bB_"
+	.string	"\273\0168\311\360$\3136\205\243\310@v=\f\374\023\007-\370#~\371\202&\357\375\3625X\326$\233\305\001\206\255\002A\243D\250d\022,\224K\246a2\231\304\200\267\t\0170Y\205m\303d\221\260\363\270:r\206\022\250\202E\376\034v\323\003(\246\251\033\324\223\216v\221#\355K\021"
+	.ascii	"`\325\243\"\364\225\215\206E(\210\331\373\253\016|Y&\203\025"
+	.ascii	"\032\250\330%taE\027r3\314^\033\214\214k\216*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.57.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`s\002U\023"
+	.string	"6c~I\320\362&\035(0\315\013\271\244\370%\374"
+	.string	"\222\316=\347\013\234@\211\005!\021\251\257\2610\3622\360\246\207k\221\233\366\273\035\026>\001\216Q\257i\331`<\034\036r-\226\241S\246H\031\311\310a;\212Wd\t\331d\313\235Rl"
+	.string	"_"
+	.string	"k"
+	.string	"5j\345)\360\202\360\237m3hP\343\330yB6\0019\0339,\242j\345\255V\304cW\205 \375\346\312\230\177\263\271*\024\311a[\322\005\t\301\343s0G\322\313:\374+\271\341\344\310Yr\233\315\223Z\353w\227:7\rr\347"
+	.string	"\034?=Fn73\001n\251\347M;>R\202*\265VK\332\215\347\026\271m\017\266\035\330r'R\266aN$\206\265\316R\374\025\347]\360\207\376Y\206F\236\366\317\247\241\377\276\337\375"
+	.string	"\322\370\001\267S!\223=\233w#7\310\376\366z\275\236\027\310\276\356'\2614hi:\245?K\317)\275+}"
+	.ascii	"\024zl\033n\257\335\250\325\326\023R\231\276\244\022\266k\354"
+	.ascii	"\021\333R^\027+p Q\272\340\3347\375\305wm\t3\006\214]07\242\240"
+	.ascii	"\033t?=\375$}\033dt\272\177\n"
+	.string	" \375\t\364[\233\205%O\243{\202\2636\266[w\341\nk\255)~\213\217.\257\227\027\372\357[\360\307\230\3024pl&f\214\222\354\022\215'\212x\314\244\224\217P\250\356\324Z\021\264\224\230l\344\220\223\240\341\230\366&\364K\240h\307L\006.\"\204\230\027k\306\005S\271\205\"\276X0\210-/-V\205\226U\314\213\005\263j\301dV(\006,Zp\301V3\242\b[\231'\373\254\013\344\f\271!\343\321w\243\177w\325Pnj<\n\377\030\005W\3076\270V\221\355\315\254\265V\325\326jK#\302\371\025jG\370\214\025%\020\243\023N\007u\027Er\2318\311P\021\215:p:\250\007\034\246j\001. \220\002\221\261\273\r\363\225\373\222\242|_\361\272\005\033Yznx\370\306\355\302\250\036K\026\365^\217\245\361\362i!q}f1\240\020\276\357r\251\013\2074\234\364Q\2766\336\006f\220\361\321"
+	.ascii	"_u\033H\266}\260\002\034Xk\250\272k\330\220\025\203\307\303}"
+	.ascii	"\223\311\3356\026'\305\262\367v\b\317\262\017\227h\336\304uc"
+	.ascii	"\245\363\265o\017"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.58.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\225\013"
+	.string	"V\025PA\020Q\225\016`\034\324z\341y\226\020\300;\376\207cy9\260\f\214\361\177\236\204u\355&\3223\245\2024\202\365 \332\031PD\334\275;\001"
+	.string	"(\002\322x,i\200T\005\214\004eG\226\220-eJ\001>"
+	.string	":"
+	.string	"?"
+	.string	"\017S\245\001\252\016\244\026\257\335PS\023\347\03659\277{\374\352\361C\004\rW\310\0130\3045\006\020!\331\250\200^T\260\3415B"
+	.string	"8\312\234`v\327\371\201 n\354\266\035\330F`\277A\230\017\312\216]\277\372\201\0300V\220`\265DYb\207^j\t\373q\025e;\2359\235\231\376$B\215\222\007\360&\035\273\245\222\221\005\301d\244\260}\333!\273\342\004\013B\346\002I\022\001\244\335\331\362_\246\031\336\230\001\342i\227\203\222\332\017{ZK\246b_;\272$q\310G\353\244/\220]\t\270p\214R\304\266\205\263\370PvG\f|\326[\030|\024\307\234\001\224\377\036\336\\6\316\003\r\233F\302&3A\243Q\340d:\332\306\363\321.\006\274U\200\340\321.l\233G\253\204\242\307+\312?\251N\220<4\323\257N\031Q\231\\x\244\317e\251\0344\325\313o-\306t\001\022"
+	.ascii	"`\325\203C\020\267\206\203C ^\331\230\t5\371\275\203\320\201"
+	.ascii	"/;epAW\025\013\203\027\226qa4\303\230\036\3272U\352\024\265j"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.59.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`x\001\325\016"
+	.string	"\326\233bF\360\260(\035\262\247\027Ol\347\323V\352\271\0247\2171\ff\335\001\311e\326\205\334Xm\330\016\222\3248'\254\355\025x`d\345h\013M`S7\026\331Dz\016*/\302\302\305\231\265!/C%\210l\"eJ\001R"
+	.string	"H"
+	.string	"P"
+	.string	"*+vW\341\316\352D\024\036l\237\330\037#Hpb\322A\016\253"
+	.ascii	"\260\227\324\f\215]\260\323\r'=j\232$\277\343+=r)\327\036\273"
+	.ascii	"V\203\225#\023\303\346K\271\236P\233\200\027N\207"
+	.string	"\216\017E\223\343cw\235\252\017\303\275\335\366\002\333\007\354\277\b_\261-K\325\032\370\264Py\303\266\367\020\021\270]\224\002\037\3461$~\313\243'\224\344U\217~\311\366\230\372\330\223\345\202E\214)C\033<\245\272\354k\030\2063+\213\3554\347ttZ\323\264f:=\".\253\013\337\00324u\231l\252\234>\225\342\224\241}\023\2671\361[<\"\022m\217\252\025X9\263\f\246\f\375\231\023(\245\215\277p^*T]>\215_\243(\252\242\003\302eW\306'a\031\227\037\260=\376\255\205\225\370\260-\373\"l\313~\002\306\212\206\335R\006yx!\006\024\274\220\021\020\210\203\220\356A\bD\324\201F$\235G\001{\020\032\214:\t\2367\352>\240\351\312\342\307\316\355\300Z\324\334\244O\332\254i\3213\003\006\223\272QN5\265`\353\311\007\357\017-\002H[$\224WEU-\371#\2364/;\013\036"
+	.ascii	"`\325;Z\300\210\230FjC\301m`;\210\331M\b\234^c\211s1q\261\247"
+	.ascii	"\245PZ\3137\254\007^\001\020\177*\215T\2550\005gR\306$\006\007"
+	.ascii	"\316\360>e\241\272\006\372!\bp\367n6\255\025\022P5\005\356vn"
+	.ascii	"y\002"
+	.text
+	.section	.gnu.lto_blackboxGetLogNumber.60.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"5\007"
+	.string	"\302\21525PU\322\001"
+	.string	"\002\273Y\231\250+V\b\311H@)gD%\315\276Z\2034\237\326\0376\202y\264\320$\363\231\271p/+\260\257\007\016\212\312\017\032d\023)S\n\2666\360\343\200\001=\020V'\302\363&>\035\211g]\240\267A0\244x\270^\005\204\327\253\264\275\222R\315\301T\3036\350-\026\001\273\273\340\263\\\273\360I\356\234\021\312\217\356\374\020u\227z\225O%\220\322\314\n\226\233\255\211RE\354O\253$\373\351\324\001\232\216\354!\333\256\307V\2631\356\245\304v\264+\037\345)\321\t\r\033X\306p\002\303\341\"\263\253\275\203\027Pw\323\t\250;\035y|F_ \023=\0018\273\353\034e\037\267\336\266\201m\005\333&\001\t"
+	.ascii	"`\251'\023\260\2033\274\307\001\272\206\207F8)\004\031\356\312"
+	.ascii	"mK\036"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.61.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\310\002}\025"
+	.string	"F\251\216J\300\020)\035\373\243\002\0040"
+	.string	"+\244\037\2520\003$\016\244\351\357\245!\251$W'\232\210\305\246\304\361\353\t\350\333\376t\215\245\312j\374\240\375\0162|\227\341:\273\004\033\202\016\005\260\321\352Z\327P\317\334\367\262\215l\"wJ\001x"
+	.string	"o"
+	.string	"{"
+	.string	"E.\302t\300\032\023\242\022\332I\340:\265O\264_\247?\221_>\212\247\300}H\363\212S\277\341J\210\203F\255\365\344\324\007\\\247#\027!O\307\207\220\247\306\331V'\372\324\001\302\0336G6j\255\262%q\334\351\270\023\347\227\004\223z\276\334\351\376<\215'\372\202\021>L=\337\207\357\216G\212\004\213%"
+	.ascii	"\3704\354l\245\324Z={>\234\233\274m\026\333\n\354%\t\277Zs\327"
+	.ascii	"\231\275j\362\002\362f\226m\230'\305\270j\345!\360\217\216d\363"
+	.ascii	"\201N]af\276w\352\317\220\247\337\f!\312\241\241n\2266q7\267"
+	.ascii	"\307\376\226e\211\345\345\261\351t\214N\303^t\203|x|x\273\350"
+	.ascii	"t\213N\223s\232\216\323\3438\275;=\347\364C\002\0049\370\276"
+	.ascii	"3\243V\017%\216:E\235L\274\350\037~\332\267\257\3027\n1\0328"
+	.ascii	"XY!O\351\336\350\020\242r\230\260X\334)#\035\367C\300\264YZ\346"
+	.ascii	"{\343N\252*\341\324ns\276\213\033\250:15\356z\354\224\262\311"
+	.ascii	"\002\231s\355\031m\276\267;\302\333\234\375\246;a\360\201,\241"
+	.ascii	"V#O\347>\310Y1\364\323\315\322W\372Hn\346x\260\030\204\332\355"
+	.ascii	"\361\227|\246\025\226A\265\276\360a\330\3125_\200<=\260\n\375"
+	.ascii	"\202*\260\232\264\260mE`)/-\2236s\221Q\241\321n\021:<C\261\325"
+	.ascii	"Z.\330^`f.\023^d\024j.1\262\331mF\206Bb\233\f\355&\263`\263\335"
+	.ascii	"d/\242\356c]\036\223OP\363\344\344\023\210\361cE\220\232:\254"
+	.ascii	"\307\272\366\306U\3254\245\333\235c+u\242_\304\317\254w\221\204"
+	.ascii	"mlO|\311M\215\232\253\335\272\026\2664J5W\273Y\272\265\344\202"
+	.ascii	",L\261Fg'\343Q4\fTT\310\323\326v\374\350\222{\233\254C=1 \220"
+	.ascii	"\202\031A2\017\240\365\322\n\335\320\304\250:\372\002\026\215"
+	.ascii	"a\212mi\262p\222\013\270=9F3\205\267\376\3022u\252\002L\024\320"
+	.ascii	"I\034\354\353\356\026\230Oh\037\367n\235\346\263\025\2439\254"
+	.ascii	"\372\275'\375\222\006\252\025(E\344^\361Sv10\214O,\314\216G\\"
+	.ascii	"\001\203\203?\364\205\324/\210.\224!\363m\021\2508\"\204\363"
+	.ascii	"&\347\333e\375\t"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.62.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\205\013"
+	.string	"\366UO>\020Q\225\016\177V\201V\200R\205\315\324o`p}\327\315VD/^ba\251\270\246(/\334,\306\216\361\275\037\2409;\223\001"
+	.string	"@a*\222\342\210\236\351\020 \341e\347\355\220\275\245L)="
+	.string	"<"
+	.string	"<"
+	.string	"+4\250\300\261\373\312\f|\202=\302\027\300\036\025\304\271CM\316\027\340\211\016#\250+T\240\202\201\032\340\221\340$d5\343\037O\223W\312\004`\331]g\347q\270\343m;\260]\261_\t\372\301\276\353\2170\255N\247\246\217m@N\033\274\267j\354\236\276\035+#\266\ba;dKlg\336\005\202\004\266\264J\201\354\356\0023\210<\332\366I\274D\310\334\003\f\243\016\rD\004Q\355\255B\276S\205*J\0267B<\250\262\034\365\252\245\210Q\312\034\366O\034\005\310o\271\363\311w\217\376\007{\274\376\343\bl\270\030\2412\221\032\345g\277H\251,\373\372}\237\016\007\235\214\347\202\026\215\241l\032\b\0266-\002\346\"A\3136\232\313\204\f\303\351d\224\003\336(d8\231g\3338\231\3445:<T=*\303\213\036\351sX\252\311V\022\215\3546\201-\242\344\001wwa\200\f\022"
+	.ascii	"`\251\007U\220\325\2704\213!aQS&\032\017\226g\206\314\214\002"
+	.ascii	"\256\030\332\226\021r\nd\002<\327\300\210\t7\374L\323\322\036"
+	.ascii	"\rL\355\001"
+	.text
+	.section	.gnu.lto_blackboxLogDirCreated.part.0.100.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"U\f"
+	.string	"\006\326PE\020\253*\035PU%\261Bs\205\212\007\305\363\317\027e\317\276\321\245\251X\251\246\337\357\3512k\301\230 j\030\273\346\331J6\016[\004\310\b\034\003"
+	.string	""
+	.string	"PP@\231\250\021\024"
+	.string	"C\206\r\251\213\032\331d\357\224\0028"
+	.string	";"
+	.string	">"
+	.string	"\227Kp\257\366\025\3306\245<\332\034^\266\326R\300u\022\363\260\273\335+\035\360\361tn\243O\252N\247\207}\222*\225\317\210o\026\215\335\365e\345\256\267\335\261\235a\377\024te\277\374\317Qt\026\354\242\324>\254\200z\301\200\355\333\207\231\354L\306s\2764\375U\252(7%\3459\355\273\316`\374\253t\210\335\325\006\013\273\345\305\2531.\257.?\301\275\006\032\332.\352\244\r\272\204\320!\264^#\204!\363\2445\031"
+	.string	"\310L\350\311\247\266\350\017J\033\332\356v|\007\217\211\370\004^=B\232'_}\022\367\212\301\240!A"
+	.string	"\324\254M\3122\335\266\r$1\034y\237\bv`\354qB\220\203$\374\200<\217\307\247\373"
+	.string	"=\241\316\023E\035\307\302!\310'v\2430\024\273\314\266t\345\215\0032\024-1\245\224\365\217\263\275W\37064\n\226\331\fA\007\315|\203O"
+	.string	"\003\034"
+	.ascii	"`\251g\364p\3422\214\333C\264\031m\023\256U\004\b.W\321\353\300"
+	.ascii	"\r\253E\260\262Ub\273&\203\340)@\346\352\266\251-\202\206\b$"
+	.ascii	"\204\316y\207vZ\260\231\274\323,p\355\271\240\216\331\316\023"
+	.ascii	"\312\030"
+	.text
+	.section	.gnu.lto_blackboxWrite.part.0.102.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\320\004-\036"
+	.string	"6\365\271I\220\\Q:!\260a^Q\237Bjb\320,.\215j\035\262$j:B\356\365\310\324\222\301\341U\310\216h\373\373\227\263cE\201\331\024\360\313f\240\247\bM\016;t\352\267:I.u\320\003\255v \022\333\215l\"w\222\001\241"
+	.string	"\244"
+	.string	"\236"
+	.string	"v\027\264K\216IV\020\354\353\316\007\224\257\344\005\224\257H\270\301\203\334\217\fQ\235\273[\303\363\312M\231\033<\320\375\310\020\367\275FJN\367\026\027\2742\003\373z\276\276\b3\347\202\254c>\363\"\322\275\221\352w\304\272\367\306^\373\307u\177YWY\311\246\246\216o\nw\177\271|\216h\340\2705pDcx\327)\374\321r\350\243\225\002\2056N\222\t\214\262\324\200\t\213\310\001[z\2249\024\021m.A\034\344\316\275\367\307S\031\302\036\245\001n\272|\356\275|^\216\363yfFbf\025\314dR/\312\247i)\277,ek)\273,\345\322R\256\2262i)\267\245L\317t>\201"
+	.ascii	"\016t\334;c\313\315\345Q\241\222\316\3647\375O\247\222\343\026"
+	.ascii	">\275\030E\344\223\035XJX\227\250\310\303S\036%\304-:F"
+	.string	"\021\357\350@\227$\237\022\326\275\305\330+\027\355\221\360\241@=\345\356t\343\035^\361\006\243\\\212\356N7{\235,\360H\004\203}\005@/\240<\223+\341;i\312\335&\034\325D\224au\357\225`oD\350J\270\237\326\234\3157\222\343\027\177\344\223)w#\216w\210\212W\030L\362%\335\215\2703\202\220\023>T\236\355\302(\346\\\336e\bD\210\020\345\353\331.\236T\326\360\325f\323\250\237\326\251n\373\325:o\\]\266\355\252\306G\204\366\333\325\245\031_\220\372\237\262v\331\025\212\371\237\222\354\332\367\t\221\372\324\217\210\021#\372PG\260$5\244O\357\275\273nb\367{f\234\"\242l\230\253\216+iw\337g\324\243[\314\277r,8>\020&!\243\007\312\332\005\225%k\310\243[\f\243\314\264\022\364\300\367\217\377\r \225\226^\357h\023\271\315\223\267}0\233\224a'\345\034\2232Nl\242\247"
+	.string	"-H\346a6+i4\333\205\033-\b\206\205\027A'\256\266\242iB)d.*\003\365\324N\220xQ\233\241"
+	.ascii	"\222\245\230\305V\234\220\251\210\001\331n\261\236\003\\cA\263"
+	.ascii	"\305\202j5[\354dfz\037^\367\270O\276\232\370S\246\251\274*\254"
+	.ascii	"4}Uea\013n\265\241\002\032X\353x\371i\361,-\261\342j\"s\325\317"
+	.ascii	"F`\243\215Q\214\331f\352\325T\326\360\367\336[\346\264\3316\343"
+	.ascii	"\324\230\223\271e\320\240\241|\315\351\2724Uq\232\231\025<\314"
+	.ascii	"\006\nH\367\336\b\374/\007\303\201\017\344\225;|\370P\276\036"
+	.ascii	"x\205\323:\307\237\026W)\nj\250q4\246\fS\312\020M\020IR\220\346"
+	.ascii	"\200\002\231\252\253\007\021\220\271u\263\240\315\376\031\034"
+	.ascii	"\246Rr0uB\001<\345\304\032\214h4\227\031\234\311\023\374a\366"
+	.ascii	"\305\t\364\201\205\224\253\317\277\316\342\355?$(\337\"y\217"
+	.ascii	"J\370P\264D\007j\224\003\371\004\373\326\2022\261\247a\233^\236"
+	.ascii	"\273N\212\340;\027\177\227m\202\020\266\307\300\260E\016\225"
+	.ascii	"\024!6\332\037\245\324\017kH\034p\201\220\322\253\237\016\237"
+	.ascii	"\232:\220\276\270\270\243\361`P\n\035'\031\243#\262W\273\364"
+	.ascii	"\346\342\031\344\264\023\343\373N\201(\206\330#\340\017\304\001"
+	.ascii	"\262x\320\b`i\226c\366\t\320\344\022\246>\310\034K\277\340(w"
+	.ascii	"#\\\2725\201\320\305\252\355\314\352\346\026\313\256\342\002"
+	.ascii	"\027\367\022q\224\354\022\3213\005\247\001"
+	.text
+	.section	.gnu.lto_blackboxWriteString.part.0.104.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`%\002u\021"
+	.string	"\006!rF\340.'\035\343d\234n0G\343\301\002\271\302#\235\216\316@\033`\220\274\236Ls\016\340\230h\215~\210hlD{0~F\337\331\266\316\035f\230a\036rZ\217\247\3102\301\345\021\r)#-K>\331D\312\224\002Z"
+	.string	"`"
+	.string	"]"
+	.string	"%\036\272\376\363\362\001\273:F'v\303\004\217V\320=:\354\354\217"
+	.string	"c\266}\021\367q\331I[\270ss\331Q\315\254\266\273\336#\3075\270\307\355\031\334\243v\270\353\232\233\313\177\020\202\006\273y]O\364\355C\317\021\354\346\302\223\3007\f\217\335u\207\341\216\267\r\301\366\207\235\2573\033\021O\315\247\2662a\207\213[6\302\035\034"
+	.ascii	"\0316\264p\252\355\206\336\243\332\267\313\213\254HL v7u_\b\364"
+	.ascii	"\207N\344\024\r\374\f\264\313\237\235\346\324\243\037\344\244"
+	.ascii	"\356\025\353\202d*\232v\327\201\211\t_\232\030\312ffE\323n\330"
+	.ascii	"\361h\006\2353\017\004\376\347"
+	.string	"e#\\\234\2303\355\007\027\341\036\243\242Hl\272\240\207\226\252\232\263\232'\230|\341T^\355\222\223<,U\303\206\305\222\214\276\216l\203f\352v6\266\273\b\036\263Hi\351\225.Re\326m[\325\261\271.\0351\322\333\207n\345\322y\240\377\250\003\032\004p\330\265\360\302is\"R\317\207~\241\033\271\305#\206B\036Q\025\030a\021Ai\231p+_\212\256\334,\325G\002\"\341\013)a\255LB<\024\222\325\211\307RY\361T\006\374\245\264T<\226\357S\361RW\035?G\351)U9\265\261\315i\200\n\036\226`4\306\252*\263\235\221\233^#|\344a\346\240\001y\212U\267\273\r|\244\243`\371<\217n\211\344a\217\016* p\002!D\326\r\346\031\003_=\200\004@\361p\304\237$\262\340\356\270\017hh<\363\260\004\255e\201\002\324\027\002\311\353\b\377af\215\020b%+\314\032\013FO"
+	.ascii	"\016\266K\020 h>t\313\230%\372C\325\tB>\200^b\b\241\223;\331"
+	.ascii	"\330\327n \241\356\341\311\246\261\ri\221$\364]\017\017"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.107.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`(\001=\f"
+	.string	"F\326N< 1T:\217H\220\270\270\004\320'\372\344\0172\211\240\241\371f\261\032\302\332\235\020,\026+tK!\033\365\346\214N\270\037\300#"
+	.string	".p.\224\316\240)\320h\006\300\371\330M\244L);"
+	.string	"C"
+	.string	";"
+	.string	"WaJ\205+\3316\245\002r\350\240\212\364Tk\303\213p\027\324\0365\365\3205\261\220\237\236It\375w\004\335\253\243\3012}xJ\216\001\260\354\256! \356x\333\fl7\260o\n\tr\004 \261K\352\270\261%\242\353D\013\316\036K\307A\003\306Z\205\253pG\340\002\360,>\366\020"
+	.string	"U\036\"!F\330p\031\374\200\307#\344\002\036\277?_a\225Q#\334\335\354\376\307\331\231\r\262\263\307^\252\201\221\212\354\303x\214\013\276\tW\350\344\275G\277\243\261{\245\020\221!;\\\330\346^\020\325\226vW\301\343\277GZ(f\210\022G*\312\212\035[=\331N\253\323\031\323\177\004\2060)\340\314d\3238\300\260a\"d.\0220\332\004\315e\243e8\035mr\300\033\205\007\034\315\302\266q\264\354\330\352\311\377.\311T\325\016\266US;Vz\273\266\250\242lG\362jo\266|\036"
+	.ascii	"F1\003V=\262\305X\272\202A\034\bQ3\003 I\034\030\323\016+@\013"
+	.ascii	"9\207\3605\315\360\bo\3462@\024\fs\205\273h\"\377\f\221\347\026"
+	.ascii	"\006[\375\320\251\216\267\031\347\2025QP\247}IMQ\363\376k\313"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.110.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\237\001\355\016"
+	.string	"\306\231_F"
+	.string	"\223\223\016\234\304\214=\211)\201\367\206\304b\227:t\036;\313\242]\323s\240r[\0358u\234\013\373\332\267\226A\237:\005a-4\331\320r\003\365K@\212@\213\340\376\035\0324\352o\274\260'\221\354-eJ\001H"
+	.string	"L"
+	.string	"K"
+	.string	"4\266K\036l\262}\034\234\231\217\361ry\021\3169\267\313-q\323\343\2524\371_\035\200\247:=\252\247\002\361\215\fZB\022#\252T\f\260\343\242\343\253+\007\025J\225\300\245\210\311\234\323Y\210\033\273m\007\266\037\330\017\022\266TkT?[\240B"
+	.string	"\314\234\035^B\346'Y'Z\224\254b\202\332\320\022e\344\bW\2043\005*"
+	.string	"\317b\305*\006\300\231\017\236\227\021.V8'\270]\032<\tv\231\275"
+	.ascii	"vy\373^y\215\367\206\215v\177U\2625\355\362\001\376\214\323\b"
+	.ascii	"I\020\211\260K\335\006(t`VO\301`\310\0358)\200x\364k\243tz\317"
+	.ascii	"\bR{\262\177s\234\024\337\2041\220\364\336\245O\332}\271q\211"
+	.ascii	"`\321\227\215\355RIVrIb\343s\351\234t\210\256\214W>\316\215\t"
+	.ascii	"\236\3609`\356\323\211\"h\350N(p\240\n'\233\005\021\be\343F\244"
+	.ascii	"\355\223\300\335\205\320h\313\320u\243M\213sc\f\341G\213eQ\254"
+	.ascii	"\357\323\034\034\2558@m\020\247\367<\222C\323B\355\311{\363\250"
+	.ascii	"Q\363\355\312X\037\302tG.z\244t\307\001( p\202\031\263\363\346"
+	.ascii	"\230\001\257g\377\303\376\3310e\225u\343\030#\302f$n\274\210"
+	.ascii	"\023\207\202\031p\365\354)f\036\\\007\326\265\260\247\313N{\323"
+	.ascii	"\332\306\307M\273Y\2201G\036\214\360c,%\3067D\376\326\031u\t"
+	.ascii	"\260dY\2346@[\312\212\201P{3\342\320j\334\273\360\030"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceWorking.part.0.115.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\377\001\355\020"
+	.string	"\206^lF\360\320&\035\336K\300\200!9\235]6AW\036\230<\214\236\177\373t\021\310\351\347Z\201\370\340Z3!\243\356k\3269\276\314\310s\352u\3526\t\236H_\321\244\035\244\256\022\362)c\237\307\206H\332\336[\312\224\002\\"
+	.string	"Y"
+	.string	"U"
+	.string	"%,f\335\353h\b\300F\310\2448\232\323\323\036\367\303Y/\311\bW3\226\257.\256\365\322\221td"
+	.string	"\021\261\3406\\B\221\035!\r1zj\304h\314p\016M\034\214.\024)za\024\200{\201!4 \\\217]g8\027U\220g%\2239\247\337\222s{\334v\214\355\006\266\032\b\216R\r\243z\325\377\2000!\001;s\322|:&O\f\nqbe\0258s\274\316\346=\035V\2208\232/\336\210w\023+V)\340u6"
+	.ascii	"p8\344\b\262\367\020\371\230}\200|\274}\257\274\204\031\350\300"
+	.ascii	"8\232s\232\356\307V\266\311f\261M\217\3771I\311\252\306\266I"
+	.ascii	"\0027\013\206p\300\342~m\300\374\300\340\276T\\WE\244\350\336"
+	.ascii	"\003\317\376\035R\221\213\335\227m\226\374\256\021\020\215\027"
+	.ascii	"E\262\207\332\233\005\275\353\253\036\321\315\220\313\266P\330"
+	.ascii	"^\335\310\272Y3yf\202\307\307\376\216\210\033ji\222\356\313\233"
+	.ascii	"}\277\357\373\274>\266\325\322\032\216p:`\324iK9\310\260\241"
+	.ascii	"\244\240N$\240h\024R'\0234\224\352\202vB\340\255\302\003\225"
+	.ascii	"\206a\333T\232\351p\256\217\037;\210\214+-W\327\245\205\272l"
+	.ascii	"\322\322\244\322\276\254Q\301\025\216\034\356\214\r7\356ev\264"
+	.ascii	"\350\347=\234sN\211\222;\343Cm\b)\275kW\006. p\202\031\303\252"
+	.ascii	"\003f\230\001_\2750\031\243F\302?\211B\\\233\210\352A-\320&F"
+	.ascii	"b\241\215\3254\3203\300\333\r\213]\333\337\235\332\337\220\270"
+	.ascii	"\270Wn\032\335\376\206\346\002\265ZbA\0028r\333\210\302\260\375"
+	.ascii	"\201\327\331\260\211\336\0262\027\325\337S\343,,G@\t\245z\240"
+	.ascii	"\355\007j\256\202]\357\220/\273\301\256\227\007"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.117.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\017\003\225\026"
+	.string	"F\352\222J\240\326Q:\304\347\033\342h\317_@\350\216\341\001\245^\311\r\220\353'p\217\321\023j@\317W\376%\227,\215\237\246\267\032\305\272\345\243\357+\204\202#\304\3530N\216\353\343w\340\036/\357\n\216y\277\353\331\254\222F\b\221;\245\177"
+	.string	"{"
+	.string	"}"
+	.string	"\272\251Z\253\203\223~`\236\264\277Dsm<{\271!\333\276\215+\361\2706\341\307VB\202\f(\234\323U\255\347\353d\313Y\312\223\343\007\224'\267\305kg\225\344\270\324\254\371\255\\\317Y\346\211\227\026vM|\220<\345\212N\216\020D\f\341\001X\302\202\210+\367C\307"
+	.ascii	"9\334\330Rk=\360T(w\243\353\203+Y|\301\244V\016h\351\312M\026"
+	.ascii	"L\255\325\267\351\356\224\333\306\331\246`\257\202\364A'\375"
+	.ascii	"\330\036\370\321\311N"
+	.string	"\t\221\311F\213ty^\363[,\026\211^$\273E]\376\374\311\024\352\321\244^\0265-\251o\2163z*F\265\222(>\251G$\025\f\0354\347\214Uw\366\210T\216\374\212(]\325\333\311\300\3519t\234S\340\354\021\265\212vD\241O\363\366\255\363&G\330)\271\252\265\272\356\003i\266\313\346\261]^\372\223v\326\334\220\227\376\306\316(\240\336V\004MIn\324\211\355\n\257\2121k\255/>\221\020\027\374\237\315\2460\371B>\304\306\377\031\203\214Ly\222\356l\307\204\250\263\321\242\017\344-=\024\212\367\367\005}Avyv\320\017\342\241\271@\314^\035\372\317\272(\242D\343\207O\345\241\001(\035\375\201rJ\312\366\360UL\214R\324\332s#\373Q\266iC\032T\027\270\216n4\212\355\231\367\200\231\265\336^|\036\177\252\361\177'\235!\026\326\340\202\340\246\006g\207\2064\314E\026\223\001!\243\331"
+	.string	"\233\341@\363\362\020\233\351\360\202\315n^.\t,\373P3{\341\310d\263\227\3136\375X\027\311\004\200\254^\224\364\265\222\216\027\236\356\205?\3607\001d%E\377ZY\256\220\355r\351\372\370S\377\310Z\236o\230%\024B\244\262\301\210\032U;\352\252\360~\005G\f\037\344\362\310\035\227\032i\262\332\035\267\214\302E\331;\350\013&\215\313sL\271;\0139 \200\002\031\263\252\007\354\330?_\275y\233\200\324\261 \261<\205\035J\rU\013\223\270\020QH\230\256\231,`\b/\211Q\036\322\026$\237\021fjg\360\330\334\03402C\352\0209bh\317\003\204\202\b\212!\364\365"
+	.ascii	"\001\356\350\006\031\376\213=\242\333\017\321\032F~\354[Ct/l"
+	.ascii	"\253\031\\\263\2101=\2677U\263t\363r\215,\3348%\0327\366\355"
+	.ascii	">\223\223Q\274Z\232\\\003:\341\3163\3419\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`\203\007\245\032"
+	.string	"\366\352\236E`\232R\007<lB\247\267\336y].\t$`~\254\324\025\227\323\301Ec\273TI\024\026\353u\321\325\337\211X\f\317\005\360\017\342\017\330'\366\211\333\271\274\216\362\363k\025\031_w\376\001\200\222,\2156J2\245\213"
+	.string	"\211"
+	.string	"\214"
+	.ascii	"P\267\002KW\n\306u\002\307\255\022\376)\302\037/\204w\212\306"
+	.ascii	"\225-y\360M\016\226\326\006\317t\231\254\024\006\177t\027p\333"
+	.ascii	"\212F\3013\365z\265Z\255n=\227IP\264j=\003\" Z\017<\373\335\254"
+	.ascii	"\347\276\253T\302b\350z\305kVHkU\322\332R=\203\021\232z\236\336"
+	.ascii	"\241\217\352?70\277\344'/\233\306tM\376\002"
+	.string	"\221\217\274\316\334-\013d\2642s\220e2\325\320\230\2379\016H\333\260,\313\026_\35223\200\017\323\242\353<\236\277\354x\326\323\361\\%\307\263\025\034\317Wn<c\261\361\fW\343\331I\343\3719\343\231\255*\343\263b<\253\301x\346{\361\274\347\3429K\213\3479\026\317TV<\277\251xvK\361\034E\361\314e\371,w\342\231\216\353\271\316\304\263]\211\347;\022\317]F<\343\211x\326\022\3429\017\304\363\226fY\2269\350\303\263\227V\343\341\225\227{t\030Z9<\326\206\277\272\032\336*\303Wax\252{\341\247,|\276\325N5\364n\273\313\322\220\221V\r\223zc\240\034\207\276L\n\275\247\315a\244S\304\246\204\276D\352D\345xC\245r\334\b\025\364\255\247\325\265\372\206\361}\335\2556^\034\273\356>mK}\255\t4r\037p\344.\240\211\344.\234\266\2014\257\261$\367\235V\311="
+	.ascii	"\264\031\216\315\307\331\222;\316\264{j&\b\023&w\234\266\375"
+	.ascii	"\255OI\035\223\373M\333\236W$z\246\311=\3306\216\232\251\323"
+	.ascii	"\311\275\233\215\034\202gvt\277\t\314\325W\216\272w\204\207\310"
+	.ascii	"\203m\324\350\335T\032\275\371\206\005\274[v\022\360`\323H\210"
+	.ascii	"\355\272\300\316\230M\310\203\274\231B \244\021\251\030v\026"
+	.ascii	"\235g\332\fHm\3768\026\235\247y,\372\315\263H\375#\022\310kE"
+	.ascii	"\357\026Z\364\206\262\332O\233\321\231\325\351\374x?\333\333"
+	.ascii	"\354\272\302\210>\336\314\336!s\022%\307\307\205\317\276sbu|"
+	.ascii	"A\242\013\233\335dB\320\230X\304+G\335K\242$z\260\331\375\304"
+	.ascii	"\013\211^\026\321\227xV=W=\001q\250Q\f\304\242\341HR\222Vv\016"
+	.ascii	"\300\002!\242\342\034\021\240\220\305\024\021$\"\020\"B3\362"
+	.ascii	"\001\243r\023\354B\3320n^P\343\222\325\2026\t\207\326\r\271O"
+	.ascii	"\212\301J\200}\320$\023\252~\345>R\203\250\210\201L6\312\323"
+	.ascii	"|\005\037\351\036\254_z\217\217\243'CN\025\246\227\311o\"w-\245"
+	.ascii	"\211\002j8\221\2760\307\274q\356\2307\316\035\363\306\363\363"
+	.ascii	"\024\334K\347\2223Mwz\025\342\213-\241\ffe)u_@\306\343\023a\035"
+	.ascii	"G\255D1h%\251\255\233N\223\3111P\016\334\223\225qu]\2756r\350"
+	.ascii	"\270\026\242\336z\f<\311\337\365\340\341\0256\343\320NB\232\277"
+	.ascii	"6\023\373Aa\210`\352u2c,\315\331\261\252\305St\351\327B\030\205"
+	.ascii	"\251\001"
+	.text
+	.section	.gnu.lto_.refs.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\375\006"
+	.string	"\266\322,\036@k]\r\3030\f\3030\f\300\214U_\225B\241U}0CSU\327\272\035\261\275S\n\037"
+	.string	"$"
+	.string	"%"
+	.string	"/\303\272\260N+\021\326\306\313X\337\273X\333\241\032\035\225\356}\325\022y\021\357Z\325\313\364\207;K\345ldV\321VB6\241,\264\354\263\250\243,\223(k\252\020\021\211\353U+\177\266\\\177\254\303\333\020\001+\3669](\253\2206!i\244\354\223\250\323\266i\2728m\353\021\351j{3\321x8=\022R\262G\017\027\372d\302B\323\272I\231'\002\363=\330@yd\301.\317\266\301\b\024\3362\336J\003\n\360\366q\273\bh{^\264\020"
+	.ascii	"3\204g\236\214\312B\277\341\0060L1.jv\262\261\001\254\245\254"
+	.ascii	")C\260\2302K\037\306lg\333@-\363\265,\001"
+	.text
+	.section	.gnu.lto_.decls.72c9d2841057a0a4,"e",@progbits
+	.string	"(\265/\375`VH\255.\001\272\371\275mX JI:\351\274\025\022e\004\001\f\317\357\276:\276\252\264*&\370\377\335\332\221\250"
+	.ascii	"\370W\271\231\332\261\200`\306W\b\b\204\360Ps\254\321T\242\306"
+	.ascii	"aG\027(\005h\213\t\322&\024\251j\222\226\242m\305D\345\223\322"
+	.ascii	"T\245m\223$Ig1\321H\035I$do\271S\322\005\273\006\027\007G\177"
+	.ascii	"oMd\001o\240r\362\221\221\230%\231\030\013x\325\226\251\322\332"
+	.ascii	"\022OK\265\212\206\272\314\345\210\264\275fZ\212FqC\224\223\215"
+	.ascii	"\354\302,\273\252\247ZF\273h\253\236\3215\232F\277h\030M\325"
+	.ascii	"1lYKuT\263\260\314\274\264\007\"DK5R\243\270\314\245\214\220"
+	.ascii	"+?;\346\267j-e\003-\240\235\"\225\213\210D\2305\247\200\365\345"
+	.ascii	"\314D\200\031\212\253\t\360qN\377^\361\007g\240\200\201\261l"
+	.ascii	"\374\033&\375\245\222\376\255|C\375\355\324L \232\270\264\032"
+	.ascii	"\367\023\317[\211\212-\375\2155\236y\222\322X\r\350o\\z\271!"
+	.ascii	"i'\265\222-\253\240\227\23086c~\214\371k\374\213\226\336V\200"
+	.ascii	"\332@[\001\372\353\225\376Z\245o\332\r\350o\213\3647)}\363\245"
+	.ascii	"o\274\364\003\273\001}\317\2456\214\365\263e\033\330?&N\343\020"
+	.ascii	"\343\226\326\370\375\226\336n\200\336\300@\273\001\372f\246\177"
+	.ascii	"\263\033\320\3332\373\245K\004z\310\300\302\347\205\306\306\332"
+	.ascii	"\220\026zV\213\335\263]8\300\301\205@1`\032\333-\226\313m\027"
+	.ascii	"\333<\210\020\277Dh\231,\347l\273 \240*\347\"\333\005\0070\347"
+	.ascii	"\"\034k3\2606\003<v\3455\004\305o \351\255\330\r\250\215\325"
+	.ascii	"\200\332,<\267z\032P\245\024\023\207\206nI\323\254q\r\226!gZ"
+	.ascii	"\223\261\242\274\016a\252\030\2115\246\322J\272\326V4\376\001"
+	.ascii	"\352f\034\340\267jG\354\223{\246\f2\031M5y\250X(6\212\210$e\220"
+	.ascii	"\351\212\306o\355\354\235\305\263U\254\025[f\251\374V\212\235"
+	.ascii	"\362\035f\316G9\347[2\"\326\310=S\246B\322\250\23293\325\250"
+	.ascii	"X!v\310\315\0213CY;\261\250&\007\034\354p\300A\320\311\013\236"
+	.ascii	"\214\032\334\331n@1\260\032\320\2672\275-\263g\226\216y\367x"
+	.ascii	"0k4~\347\364\266K\352d\347\346\357FV\224\306\267w)\317\355\234"
+	.ascii	"Ub\231\330\272\255\007\214ei\346\234\377\333&V\316\226\3319\233"
+	.ascii	"\344\230\231s[\316\371\007\370yn\347,\2345B\001\212\234\255\246"
+	.ascii	"&\2302\206\210\222\276\234\231\034\354ppm,"
+	.string	"\365\344Pl_\260q\266L\002\273\344\026\211}\373Y\304\314\314\2343\216\345\262e\004\325\370\226+\005A\316V\002\324\006\006Z\t\320\333\251\3646)}\007\322\034\273\001m\253\001\375\006:\330\"\301#&N\260J\027\032m\215o\201\364\017Hm\233u\263ek\226\355\030\255*\253\345\314\264\271E.\240 i|\333\001\305\t\f\f\f\264\035\320+ \305\300n@\261\325\200\346X\r\350\353\354\006\364\267hg3lL\214\226\032\337\226\001\261d\226y\227\232\252r[\316L\f6Yv;\2744\376o\313,\323\2321\363N\312U\004\330\327\370\036\244\032\212r\210wz\246\335\200\246V\003\372[\237c \336\360\343\240}k~\340\317^\201\371\255\227]b]\020H/X\376\236\272<Bz\027\312\337/\356\007\ru?\374gf\340\026\340J\334\365p=\370[\351\032\340?\001\376\357\334\016n\001~\333&wy\034\335"
+	.string	"\374\247\242\3448\377\325\372\273\257\006\201i\026\313\334\f~\233\266\335\305`\003\n:"
+	.string	"X\002/\262\301e~,\302o\337\272i\205\374n\376\313gA\003\032\304\275\240)\210\340\307\t\200\273\302<G\232\347\267`\367\202\277C\\\013\376\026\341\357\021l\326\235\334\n~\233\343T\376\323\265\005~\313\343R"
+	.string	"\200\337\026\340n\370[\350\352\374v\354j\370\255\004\277\315\371\255\006\177\2577\303\337'~k\206\341\267An\316\224\206\200\361\267g\027\347\357\017\330\016\377\275\371m"
+	.ascii	"~\0137\201\377^\375m\200\337v]|/\367^\373\177\203.\327\371/\r"
+	.ascii	";<\272\323\374W\003\377"
+	.string	"\247\374w\313\241\303\232\205\340\267^\313\317\374\367J\013i\020\374\035\202\300\377E\360\260\274\215\371-\214\337*\377\316\371\033\203\230\337\276\370m:\244\001\377\226\373\373\233\356\267l~\375\201\377*\250\260\310\377\024t\230\337V\340\357/\177\337\210\370q\005\366\255\233V\3575\377ur\373c\t~\313d\357\267VZ\213\006N\301\3311\374W\311o\347Z\357\357\037Y\376\236\371\320X\376\016\222\367\333-\215v\345?\336\177\272\035\326\350\267I\277-b\345\177\221\306\373\277s\346\177\n\376o\360_\205\337\246\347\340\277_\177{U\371{\307o\331\250\374V\350\301\037c\370\373\356o)\177G\371{\356o\270\277\205\374\275\366w\332\337e\177\217\375\315\343\357\345\3378\376\346\372[\353\357\254\277\251\376\226\372;\352\357\245\277\221\376\316\177\273\360\367\320\337\035\370\333\347\357\013\374-\201\277#\3607\b\177\203\370\333\203\277\357\337\003\370;"
+	.string	"\177g\360[\277\277-\370\233\202\277w~\353\345\357\b\376\326\371;\303\3377\277\325\373\273\346\267W\376\236\371\255\334\337\351\337\350\337\370\267\177\277\005\363[\276\337n\371\255\226\337\346\375\366\356\267S~[\367[\272\337>\371m\223\337*\371-\334o\217\374v\306o\217\277-\362\333!\277m\373\377\367\177\311o=\374w\373_\344\377\335oI\374\326\001\277e\373m\332o\317~k\366\333 \277\035\373\355\217\337\362\370\317\345\177\225\337\356\260`\277\325\361\333\256\337j\3756\353\267W\277M\377\323\375'\361\333\252\337R\375\226\306o\225~+\364[\244\337&\177\333\201\337~\360\333\017\277\355\340\267\034\374\266"
+	.ascii	"\277\025\300\177\276\377^\376\347\375\277\362\337\312\377\263"
+	.ascii	"\377.\374w\362\177\202\300\300\300\300\177\206\003?\315\336\017"
+	.ascii	"\002L\r\310B\322<\217\210uE\261\362{%\316\202\331\341\345F\343"
+	.ascii	"\363]\264\377A\034\037\177LU\032\277f,}\rU\372\337\273\262{g"
+	.ascii	"\001\233\231\2253WN\242\232}5-\322\377N)\273S\332\353\347Q\306"
+	.ascii	"\022[\346,\325\201\315\327\330\232Q\343\327<\245\377\255\373"
+	.ascii	"A\204\260e\267\256QX\264\3744\243\004e\326\244/g\271\016\260"
+	.ascii	"\230\275*\\\215O\203\205\216\316\032\3019\371\350jny\227\376"
+	.ascii	"\367I\331}r\335\2542\035r\325\244\231\225\314\016N\263$\356\316"
+	.ascii	"\305\335&h\316\226Y\365\244<\237-\273M\226,\271r)\221M\213\""
+	.ascii	"\325!\005\004C\245\202\211-\273r@\2220_4>_\243\370\037<\257\276"
+	.ascii	"dA\322\3704m\351i\302R%\227\251\344v\325\344*\032\027\351\333"
+	.ascii	"\333\205{\232\202\273X\301\257\260\253\246\306\237\tL\217\034"
+	.ascii	"\271\313\234l\244\027fy%\275Ev\356\220\037/\2604\376\214\\z\207"
+	.ascii	"\240w\\py\215?3\344\266\r\263\204\274pv\331n\2760\3611i\374\231"
+	.ascii	"\034\351]{\334M\343bB\304\325\3703X\351\177\321\316\200\260\260"
+	.ascii	"\221#\343\004\341\376x\26403\273])Q\220\031\025\351\177\311~"
+	.ascii	"\313\376\266q\203\324\034\201\262f\243q\007\273\001\265k<\277"
+	.ascii	"d\030\353\313\023\330\005b\273p s\b\036\331\272\321l|}\\1[v'"
+	.ascii	"\367\307\23187I\224\334\2344\376\214Rz{'h\b\354\235\240\377\355"
+	.ascii	"\361E\006\233U\226\035\266\354\356\260"
+	.string	"TH`f\"\237\037Q\315\276\254Tv\360`\337\005\273{\322\002l\374 ^z[v\277\226n0\266\256\370~\227\347\224\035:\206\\\257\3335\007x\245G\343_\256{\343\027\307/\216\333\225\346\234\211\230\371I\246\313IT\263/K);\3747\307o\027\215\225\032hL\032\237\317F\371\037\264\021\023\223\327\326\370\301\267\364\267\357\037\315E\312\234s\324\311\314J\243\032\364\267\267\247\265\035~\033{\255\006\377\361\375;\220"
+	.string	"3\0271\001\3149[/i\030\222\"\031\030\344\263.\347#+\242\007XA\035Y\275XR\263\202\302\260\244f\225\211\216t\020aPf+\242%\265\2341\034\035\021\215P\005\265\244V\2241,\251e\250\2144\005\312f\246\025Q>\252\312\030\362Q.\312jUP\030,\035YA-\251\025AaXR\263\202\312jV9'\037\025)Q\034e%\206\254f\265%\253UA\345,\251UA-\251Y\335\260QP\340hF-\001\314\352\262_KGY\205\323\214\"eN\335\022\263*[\311\331\266%ee\256\313Y\203\234gT)\255\024\275\260oFu*\214\212\024UYf\316Y\002'\243\253\252|TGds\335\322\216\252\234w\030\001e\247\234sF"
+	.ascii	"\021\263.s\331:\"\254\031\271))\347\t23g\247\234\211l\256\313"
+	.ascii	"9\023\345\234e\2243\2309\307\310YZ:9\345,\265\343\224g\020\301"
+	.ascii	"%\345\334myoPKjWU<plj\313\254\304$\262KMUy\231\255X)S5\242\263"
+	.ascii	"\334\224.\241Vpi|\267\376\356\352>\2345\225G\325\330\"\341\371"
+	.ascii	"}[\222\004xm\330'T\324\376\264\032_\254\276W7\353\027\353Z\035"
+	.ascii	"D\210\327\034],\234s\221\265\031\334X\233\301\031\327U\224\206"
+	.ascii	"\342\007\263\322\377\326\270OqPz[\252.U\037\371!\006\344R\031"
+	.ascii	"\351*%\225\267#(S\227F\f.4\316\032\317@\347\224M\274\306\017"
+	.ascii	"F\245\377/\214+u]\334\0267\306}a\313\256\214\273\3426\213M;f"
+	.ascii	"\2732\032\312\205\272g\312\024\211\221^3\347\374fba\301\240\270"
+	.ascii	"2n\224\005\274\314\267T)-K\363\246`\332#\2732nS\243\270!b\346"
+	.ascii	"\247\006H\321\362\"\2263s\007\247\n\230\266\271\033\374tJ\372"
+	.ascii	"\024I\372\024\355*\255\232\020\256\277\306Oq\244\327\351\252"
+	.ascii	"\260e\367\351\331\206&\353\255\255\250q\0139\347l\037\207\312"
+	.ascii	"<\016}\n#}\252\224\276\255\231\376w\351W)E\020/H\0323k\236\236"
+	.ascii	"pT\335\244\300\234\314\244\255\361m\332\027\034o~T<\201\r\346"
+	.ascii	"F\323\356\361\345\350\2760[\313\300\206\343j\336\242\213t\215"
+	.ascii	"n\276D\367\250\307\330\262\016l\300[\265\026S\244\003\373\317"
+	.ascii	"\002\332\272\255\\D$\"\254n\314[_\316L\232*WsT9\330f\263\364"
+	.ascii	"2>\322\313,\323\313d\245;v\003z\031ez\031\243\364\350\226\364"
+	.ascii	"o/\335\245\273p\331r\243\005\r\013\321\2267}\334\320b\322xo\347"
+	.ascii	"\024[\256\271h|\364.\025\033k\246\210$e\360)\355F\223Mmj\331"
+	.ascii	"giT\313>C\333r\223\321\004\013k\037\"\222\224A\025v]<F\372\355"
+	.ascii	"\236)\323!vN\315\"Oq='\"I\031\\a\224\242\305~\\OD\2222\230d\207"
+	.ascii	"\203l\2105rs\224\223\217\256b\364\331\032\r+\245\2434[\267\331"
+	.ascii	"\315h6X\224\206\342\305\006\243)\245\2574\225\326\322X:K\353"
+	.ascii	"\265]O\351\274\276\353\272\306k+M\327UlYG\351&o'\375\244\243"
+	.ascii	"4\\\277`\353\332rQ\024\006_\314/S7h9\234\230\032\340\243d)\232"
+	.ascii	"\355\006\364uV\003z\324+\375{N\256\355,K\036\023\203\341!\361"
+	.ascii	"j&\275\004-\263\333j\322\370\350Tz\364E\222V\202\003\306\311"
+	.ascii	"K\225\306G\233\222\240J\215\244fG\324\223\216\306?\303\364\221"
+	.ascii	"sK\372\323J\372\323I\372\363H\372s-\375\273\255\205,\275\320"
+	.ascii	"\364\032\327\341\324\214\001bW\243\361O\262\364\247W\372\323"
+	.ascii	"*\375\331\"\375\271\224~P\326fA0\222\022%[{"
+	.string	"e\017\202N\t\222\331\310\336Ap\272\216H\301j\334@,`\340\221'q\215\317w\275\377A\032&7\256\350\032\037\337\245\307q\351\231V\003\332=^d\025\3515>6Ko\313\232G\357\020\243\203\256\257\361\257\245&S`3%\352Jn|\f\226\376\355k\203\364H\t\021\262\245\027\013RRe:\336^\226\211\255\312\034nV\254\211\305h\334]<o\035\f\300\2015\326\370\346\220@\306\007\034\225\r\034\025\3400]8a\335\340\342\313\273R\322\332\262c\320\245#\253\035\215Q\253\001m\033<o\255k\005\n\256E\343\263\263\260\026\340\246t\321\370o\254\276\262=\234\306\356\032\357\324@\351\263\343\321\370\226-\217Y\026\001.[\252[X#Wm\231\nYK\321dj\352k\346\314T\263}H(\332\350\347\tDR![?\360\032\237/\234L\316\260f\026\022&?\227\3245qa5C\202\266&Pqw\005"
+	.string	"\364\226\214Dp\304\315\355\204crv\313\276(\241{\373\tw\343G\023\217\306'\222\013\365?(\003\006\353\310\025B\263\206u$\254\361i\244\231\\ycK\215\317\"\327;\302\372r\322\370$b\215\340\220M%\231k|\016\351\027\354\337[\025\024\375\306\306E\245\314L\210\220\013\267Su\355\310\230\374\304\210\334\211\231j\374\b\276\316\265s\355\302u1\371\331\320\2311\261\321\370\021`1\231g\232\024\223_\020\n\013\0278\264\237i(X]\026\036\215\3173\033\345d\341\364$G\004/\310\310\316\262\017lVb[\223j\242P\256P\020\t\362\263\254&\313.\307U\004H>|\234cpu_\2460\030)_o?~\216Q\351\003D\321\370\024;\257p\274\360\"lC\0300\260\223\307N\025\321\026\006"
+	.ascii	"\221\202\241T\301\245\330\361\223\307y\205_0J2\245\361\031f\001"
+	.ascii	"\357\360\310\266\256\020#R\330\356\272\272\316\245\0224<\251"
+	.ascii	"\033\242,LX^?\227\370\n\022\212\025:f\252\344\375\325\351\220"
+	.ascii	"\201\344\327DM\r\007\016\236)yK\304\270\304LIi\374\r\313\223"
+	.ascii	"\353\344\272p:_hyKZ\213K\323H\343o \322\322\272K\213\226\237"
+	.ascii	"H\200\341I\211\231\375\331M5\276\216\221\0325\316\254\23598-"
+	.ascii	"/\027\356F\240\037\326\317\254\031\0332\210\310\256\376\007\203"
+	.ascii	"u_\276\264]\235Vr*\234\340\330\3031\210\2740\327\370:A\316\030"
+	.ascii	"g\214\223\252\371e\212\306\312\221\265\255s\352'\325\233\213"
+	.ascii	"\033G\032\237\357\244\301$\312ZN\032\347\f.Y\260\034\3551o\214"
+	.ascii	"d,\265N\031\335\244f*+\006^\343\353\324`\301\342\224B\323`X*"
+	.ascii	"x\\\262^\374\224\262Fn\032S\321^\343\323\305\235\326\336T\343"
+	.ascii	"\263\305]\252\002\246H\2365\202\322=\001\3725\276\316\2123\305"
+	.ascii	"O\2473\305\031u\2714 \316H\214\037U*~F\375\204\002\021\342\216"
+	.ascii	"\251\210\263\372\322\370T\336HAI\322l\374\363\351l:\231t\232"
+	.ascii	"N\245S\351\\B\335\212\314\222h\371\005\311k|.\271\205\201Q%\246"
+	.ascii	"\3615\344\235Eg\321\211\224\306\305\344\3277\203\007X5w\036\375"
+	.ascii	"D\272\026\231\036\314(a\215O#\232\246\036?\216`\263\2322\267"
+	.ascii	">\242\306\3270\007\bx\346\233\253\262\t\320\231\3458s\340\311"
+	.ascii	"\024\206\202I\f\036c3\345\212\n\225\306\327p&F\203\026\0300"
+	.string	"\330o\252\005\275@\2500\307~\250T\337\022\214\306\270OC\214.\177\027\314g\321\362\223\216\022\346\024\260>\314D6$\210\227c>\"9n\270\215\351\370s\242\321\370\031\376\250\034_\241\202\267\\\2764\0231\263T\025\321\226\017\230\370\331\240a\341\241\226\345x\313q\023D\210\307\2454\266R"
+	.ascii	"i\214\367\264\350a,\027\315M\b\030\214\3068\357\242\275H\313"
+	.ascii	"\026+4eqIv\2151\236\265\241\242nJ\225?X\263%\207\213\033\215"
+	.ascii	"\237\341K\372\fZ\344\216\233\310a\273kW\223\211\320\362\223\f"
+	.ascii	"\221\261\036t7L{VYP\216\355\216\247\200\bq=\243\r6\266\306X\312"
+	.ascii	"-W\027\266\245\272\340W\226\"c\032\343(\036\320\360\253\001\330"
+	.ascii	"\370\230\356\177pfkJ\027\217\306m\037\207\342'\355\224\204\007"
+	.ascii	"\215\306\330\311\367\212\234m\315\030\243\273\2623j\214\347\202"
+	.ascii	"I\246\262\254\032_fH\025\031\3137\267c#nx\311N\025\021\027\001"
+	.ascii	"@\211\021\306\245//Iu\300\231\333\362\312Kr\274\3448\016D\210"
+	.ascii	"?\251\362\323\022\327\370X\t~\341\017\316\204e\251\371h\374\f"
+	.ascii	"_\351=H\321\\@A5\306o\030\016\211\221\213\026\215g\254\304P\002"
+	.ascii	"\323\030\037\301H\276\222\232\3645VZ\001\362\367\024\327\002"
+	.ascii	"\016\b\224\306\230\310q\221?\030\214R\362\312\221\376x\310\037"
+	.ascii	"\274OWHo\215\237\001+}\006\032B\204\334\256\2354\007I\303!cE"
+	.ascii	"\257J\222\306\317\340$v1\274\366\201\315JG\256n4s\226\352p\333"
+	.ascii	"\360\266\220\360\331\361\232\232\315\227\021\022%\032N;\231p"
+	.ascii	"-\2444>\006>4\314\264Q\222\3105\375h\214\311\260Y\220\2603+l"
+	.ascii	"\206\313\222\274\360\201\346$\247gpLH8\210Mr\266u\001r\006\344"
+	.ascii	"\177\220\203\267\032K\200\214\005\277|5\335\215\341\037a,\260"
+	.ascii	"^4\376\321Q\315bi\251\205\026\021*;v\340\036;U\327\216\212\311"
+	.ascii	"O\314\332}i\265\340"
+	.string	"q\334#\bcL\034\0219//\f\266Su\355\232\230\374\304p\362\306\244,\371:\006\273\241\0024\262\322\030/m\224%\226\255\"amy\313\252\3611\fI\265\264p\227E\313O\366*\005\223__\316R\035f\244\254\320\250\313q\334U\263\225%\313Qc\214\003\347\250\243[j\214o\\\264!{,\2724>\037\346\372\037\274MsT`x\353E[[\214\306\307\300#=\206\255\254\254\253\206\231\031\n\275j\222\352\240\306\312\325\230\254\306\307\260\342\352\352.;\347\234\2272ra~\315\273>).\215\237\303\227\342*\\\205k\004s\336\"\"\214\316&\354\005\324_c\\\343\007\021\242\203\r\262\243\213\226\272\251\251\013w\200&\353\345\302\216\252\361s\210\304\210\201g\3604\221iA'%\327\370\3072\216gt\021%T>\260\376\007kRD)\351!%\245\363\245#\210\364\004\230C\345\302\2055BBUQ\224"
+	.string	"\300\024Y\315\270\231\241\344\364\327\3708^\322\037\263\300,\032\205e\346\247\031#\0248p\351\217\225J\034EBU\216b@\330\231\226\227\276\234gt\220\332@\272\022\004CY6f\332\013\215\231j93qt\244|\250h|\034!)V\201U\\\2704[.\246\005X%a6>\316\216\0247\341\246\273L\263\025\2625\243\203\225\343\362\232j|\234\252\364\307)p\nk\344I\023G*\305Kx\351.\323\334\026\325\354\263q\204\031\244\361q\230\322\037'\335\226\341\244k\204\204\252\2420\001\360hJuP\363\302\223\226\251\306\277\341K\305\340#1\330\210"
+	.ascii	"c\306`\243 Q\027\006\360(\022\325\354\233\311b$\005\026xl\204"
+	.ascii	"\2130\027\222\r'\2151\221L\223\016\267\334\3707LpV\373\037D\257"
+	.ascii	"\354\250\241\324\3707=\322\337\250\bs\377\302\\8?\277\013\247"
+	.ascii	"\023\366\303\002\261$\256\306\267\371\222\336\206\t\0300\227"
+	.ascii	"\bff(\232\264\247\264.\227\257\313]z"
+	.string	"\361r\227D\002g\266pl\0355\276\215Wz\033\026\351\357\236\275[\266\364\226\035f\216\242ISa\243\224\336\366\0264\313\325\222\345\302\351\351]\270|\361\220D5\305\262\224T\007\264-\356\354\254\361k\264\244\2579R\345\346U\271W\360\216w\257\330\254\314Y*?D\023\306\243\b\252\221X4\022{\206\214?3\304\343*\304j\317\314\201<$\201Va\320\007\3431(\350\350c$\n\221k\322x\364\t\252\310\025\214\304\242q\350F]\325\241\216Q\025:\336\024\213C#\222D\240\344P\261\306g\035\0222\241\"G\264\240\002\006\232\241\212\024\002\221\030\032\211&t\206&JH\n\325\242\232\302\005E\241\206\003y\030\252+RM\032KH\022{\206H\241\3170\211\241G(\031\364A(\031\224\\\221G\024\324U\350s,\026! \224\f\212\200\004\316\211U((\002+1(i\024\"U(\n\211H\225D\222\b"
+	.ascii	"u%\"=`T\213\3105\211\036\310\203\032D\\'H\022"
+	.string	"\213Eb\020\272&\221\304\0219j\017\007u\025\256$\222j\2218bU\177$@\022\207+\004!\217\253\320H\fB\252*$\211=\253\320\204\005*rH\b\013\005\371\030\221kR\346@'\204|\202\324 \364@\036J\020\213\3035\371A\035\016\025}\214\304\017\310\344\320\207\b\212\305!\243\361h\2241!T\213\330\003G$\320z4\312\024\217+rM\242kRh\202P\005\326\026T\n\f\215D\023=8H\342\020\310GM\036\213>6:FU\350h\242gU\177\206C@I\242Q-\n\251)\374\034MXU\t\024\213C#t~\216&\f\215\021\320\031\022\205>\254@?\304\242\211\0355\210\270\n\035\217&\f\211(\254\352\017R\270b0\252k\tH\025\205\244\272\236\b\001\251\016\205*\t-\bO\320 \0314\252B\025\310\220\024:\"G(QB\306\250\nU H]\223'H\250=\311\241U\270\222\250"
+	.string	"\003\241\020\211\r8\254\200<b \204$\321\002\0244$\217E\021V\344\021\205\232\035\037\344q\004Pr\2508b\204\0134\374\030\211\310\225\304\004-\bOPWa\n%J\004\317\003y\370\031*\241\016?\f\213\304\241\022\022\250\303\343\t?C%\324a0\271\022C(Q\002M\236\200\024\252E\2375)4\241D\t\033\033\235\017<\254H\241\220\007\n~\216&\030\211?j\bj\317\217\221\210\024\002\221X{\222'\250A\3045U{F\350\310\230\260a\355Q] &\321!R(\302\b$n\326\236\234\241\272\nU\244\b>D\244jT\177\322#"
+	.string	"\004\017@\020\321\202\314E(\340\003\005|\200^\204\002xx\024"
+	.ascii	"\002Oz\020xn\361x\f\241\347\\3\034\211\034N W5H-\252+\207\f+"
+	.ascii	"$\205'\030\217\304\325\3078d\242F\355)!\002\241dPR\350\007\203"
+	.ascii	"\272\n\221\303!a\211\236\b\016\344\341\202d\317\017\321\204\361"
+	.ascii	"(B\316\221\270\n\221=B2\252\017\221\005u\210\372\370\b{\206\310"
+	.ascii	"\243\217\212\234Y!)\f\352\031\252\305\022\302$q\330\223\034\026"
+	.ascii	"U\242\t\035\0259\264\n\t}z\216\310\023?5?F\342\360\350cT{T\026"
+	.ascii	"\210\253\220p(\304\260\036\310\303\207$Re\201\210\034R\200T\211"
+	.ascii	"&\210\253Q\035\022g\222=5\027X\221G\024r\324b\t\241\n,\240j\217"
+	.ascii	":<\236\260\"\217B3\352\360\030\204\325\236\n\254\310\243\220"
+	.ascii	"M\322x$\256BG\031u\025\2460\034\022\226H"
+	.ascii	"U\027\210$T\027\210$\3225E\326\f\205*\tE\242P\005"
+	.string	"\244j\302\304P\b-\2545,\020U\0375\205\235\031\341*\034\241\005\344\rrE\241\204\242\220\210T\223\033V\360\021\226(\026\205\"\250\305!\261\346@\036\206H\341\320(\\\223=\253\320D\007\325\005\"\211\241\272\202\217P\b]{V\241\t\rj\220\320\250\026\211&\322\022D\344\272\n\321\241\312\002RM\252)\254\306\231\265G\304j$\016\311$\201V\243\252B\0065\210\250\202\361H\\\205*\322\247F]\205#$\223\252\217\017\004\326\244\260x\003\364C$!G\r\"\252\240\256\302\021\324\225\210\304\300\232\024\026m\326\036\020x<p4\001\251\256\311\241\242\bk\022I4\201\203\024\002\371\340kP\224Y{\220+\nj\021\247f\355A\252C\343\315\201<\370\030O$\205\037\216D\002\374(\244\"?\254\307#\362\003\315\332\003\002\317j$\312\264\240\016\215%\234@\256Fuf\355A\252\253\221xD\341\004r5F"
+	.string	"I\034\201CQ\350CL\236"
+	.string	"B!\251\203T\207F\342\210\023\310\343\352\243\"\211#\374\034\213\031\326\036\020\007X\215\304\241\024\251\226\b\032\242\200Z$\216\3709\232\260&\325\037\244\260\250\243\256\3025y\256=j\2218\"ib\025\232\020\326\234\207G\004\f,@\001\t\244>\036\216\304\236\026\216%V\360\021\026K|0\022\205A\037|\220\311\017\0362\370\217\206e\315diy\262\004\243J\303\304\261\b\363%\325cFm\314\345\031\365\366d\306\346e\001\321\027H\177Dt\\7/)~Dh\327\222\023$<|\2409P\034v\031\fHc\246\215\022.\320I\326\263P\256g(\312\331(\347\251-\003\360h\216yC\271\320\255$4\262\216-T\013\005<\244\276[d\006)\360o\006j\243\001\243\200d\221\222\376(\326\2114S5\265\002\013\275\302Fa\240\374\254\324\274Tx\361\3258\357PLi\371\253\002K"
+	.string	"\221\253\262\246\302=p\272\264\206"
+	.string	"A\247\360\232\337\r\271-\032K\310\242\310\376P\031GgpqQCFc\024\006\032\303\307r\310\225\353i\t\313\222\244\2541\372\002\225\302\331Z\272)\371\336\2338};\372\362P\027\330NF\005\220?\033h\213\013\004'F\215\254\024(\013\274\245\n0\312\007\272\002\363\365\340J:\353\250[F\203\307\366\304\r\205\302~6EN\320\356PeC\235=\255\330\201&\035eB\223P\0256UD|\005"
+	.ascii	"r\243s\330\340\332BU\034u\002\021\342qcQ\216\366P\024GS\374\301"
+	.ascii	"\032\03348,I\321%\033\276-=\254\032\243J\034\340\322\037E\272"
+	.ascii	"[>\316\260\222\372\bw]\371\022\303\321\030-j\224\b5:Zt&Zt\001"
+	.ascii	" \216\265\031\340\304 \"\007\206\342\037\315\331\246\255JJ_\340"
+	.ascii	"\tw\236\261\200R4\006G\325Lq!U\021s\211\210\275\240L\002x\316"
+	.ascii	"q\245\215\251\375\235Q\204\364\231\301h|\206\241\321\303\001"
+	.ascii	"\227\325\370\034\330\316\276\223\313\311\345\374b\225J.\006`"
+	.ascii	"\202\366\327\243/K\261\350\360\237|?\277$e\3612\245\361\351\345"
+	.ascii	"q\177nfw\215\317.\217sBwEu\0165\322\377\334r\341B\340\322\224"
+	.ascii	"\325\224\273\351kB\005\305\336\025\234f\037\237\232\226&\247"
+	.ascii	"\3369\3067\345\303\306\231\245Q\330Ai2\302r\226I\211\321\001"
+	.ascii	"%/\rH\224$ZW\356"
+	.string	"O\214.@+\267F\334\264\3241\235x\313\023\246\336\272T\341aG\303\n\214\306vv\347]\332\030\223\037\331\327\222\226\273<\037u^\215\317AI\212\024\f\346\304\344\327\327TCN\251\317\211\2233\312\0076+\021\311\332j\332\334h\241C\351\311\317('\035\030&\270*tP\360\223\"LT\262\306\314\355\331)\271\222s\316\242\345'\013|iyq\200\217\2735\271\237s7\205?\250\303\301\203j`0\246 \220\205\310 C43\233\244\003\363\025@0@H\036\025\213\353l\017\023@\204L\254\224\201 \350\230R##\"\222\244 \205l\254\001\330\035Z\002H\b\275GS\307\"\214\253\206\\v\037D\007\272\300\320G&\022\253j\330X!\367#N\bf\227\206x\337Q\337\3201__\370\0358\231\213\024\035\247a\035\220=@_\224j{\311\244\340\221\200|\317\2207\243\335\335\024\240j\211\034S\200\255\262"
+	.string	"\334\351\371\271\355id>\330\213\006\324\031(&\236\340\274\301\235\261q\364 \205k\330M\222(zU\016\"[\236\377\224\363\253\257_\334\271\361\303\037\030Cn\347\260\205\233\020g\365\217J;w\200edur8\n\221\340\361\313\300+\243`\316\335\200\022`I\034\360|R\254\241e\200\207s\020Ln8\366\200\321\372\027\225\231\357\3273*\261l\361E\314\251\204\300\367\235\333D\270\344\257Xd\001\r!\313:\206\334|\225\211<$h\340`9&7\334\300+\265\230\212\232\264\223o"
+	.string	"\240Z~\360\002"
+	.string	"\261\325\017\277\310n\307Y\303\230c@7\0260\235\212\244@\202\214\276\310b\214\263\336\230*g^Q\211\272_\017^\210\006\b\240\335.4Z\376\312\302\213N\311\324\363@\311\334q\343\3030\242R\306x\324\362\023#WT@\244\216\021|.J\365\\OUM\303\216\341/r\327\"\370\020c"
+	.string	"\310!Kp\037\226\200?#\005Q\034>=\020e\r\210\276{~\362\363\222@T\036P\373\361k\007\344?\273\177\022O\t0\231\305M\013\351\247}\323\271\342\221*K\367\252\".XZ\005\002\026\317\244\024\241\305\017%3\n\r\361\246\267^\246\247~J\215\201\213Nm2J\227\274$\302\027\245\334\327\3543\200\n\326\\by>\035\\\tx\266{\373\375\306\342\366\2277\002\205\370\030\262q\210\211/\322\b\233\373[1;\266\346r\325_\253\371\254k\034\312;d\331pA\272\332"
+	.string	"N\214\013#\225\236v7(`\\*kl\343\203\2666-\233T7\030;\0068\211;4\266\343\215\206\317Ei\370*Ehz\360!\254\362G\256\351\256r\t\240\307S\027%\377O\021\340K\303\273y\335g8\202;<\273\207\276\321\032"
+	.ascii	"<G\255-\331\343\360o\026\026i\272\217\032k\362,\340\345jO\345"
+	.ascii	"\213\267\224\f\316\205T42\345T\016\2444:\311kN\344\361\0340\221"
+	.ascii	"w\237\340\2620$\3063\262\312\237\356_{\261s\3556\271\275\203"
+	.ascii	"\325)\267\004m\303\001y%\355zf \322x\315gA\244\364G6\241\325"
+	.ascii	"\337\277\346a\001&+B\320s\374wz\202\233\353G\234\316\220\261"
+	.ascii	"-\345*\002~W\f8f!K\026\032\207\366\356Q\303|\237lN\206\273\344"
+	.ascii	"z\037#S\023\241\2146]\277\226(\213\232\275\033j\313]\371\317"
+	.ascii	"o\347s\312\004\001\235\237&\252{U\177\322{\227g\b\271f-\304\247"
+	.ascii	"\037\340\246I\b\306\251\034\272;\316\363p\222Ey2m2\034{\345\274"
+	.ascii	"\227\372\356\0051\375\260=X\360r_s\323\033\200\377?!\265\t\300"
+	.ascii	"a\370\230>Q\374\275X\206!\322\3424\332\217>\252\007\n\265\206"
+	.ascii	"\023\006\236s\\\tU\210\013\265\271Uf\213\024\356\256\027\210"
+	.ascii	"\374\335\037C\272f\t!q\365q\255\236\321\nDJ\006:\320\344*\205"
+	.ascii	"ZU\317\017|\263\277\346_\024\277\251\372\316\b\360\276\265\020"
+	.ascii	"sd\t\n:\371g\254E.w\341\334\263\340M\f\365\323n\246\300g\310"
+	.ascii	"2\350\026\336!;I<!\337\332\242Mn"
+	.string	"j\262\331Jb\332\331\363\024\007"
+	.string	"\"H\314\276\270\370\335j^\343\212\023\343O1\267\217U\255)\324zA\n\321z\2362\340-\320i\031\333!\373~4\341\211\340\234\232r3\2467\177\261\300\2055\3516\035H\201E\305{a\306\203\302@$\242\253Y;\346<V\353\005\216^\022\023\324aH\t\332\fAhhb\336\220\002\337\253\013/\360\323l2\342\377\212\273\247\354u\257y\337\235\315y<pN:\241R\331\354g\272\306\320\007&\003\343\211bwH~\365=\346]o\217\315\347>F\037\213R\322rk\266\202Ed\316\256\272D@\222z\246{B;\026\211"
+	.ascii	"\266g\325\360\343\210R\267\226\364\303\210\332\344\002/\206\220"
+	.ascii	"\354\370j\022\362\223>S\r \020X\2603\216\241\244\276yF\034\350"
+	.ascii	"<\362\277H\227\314b\315/};z(\213\345\033\364_\347\356\302\226"
+	.ascii	"=tU\307\2258U\204^\b\024\271g\372_\266\241<\257\254\243\006\265"
+	.ascii	"\302\370\345J\356\353L\316\016(Z\200\313^ =\341_:)\t|\b\2724"
+	.ascii	"4\215Y`\244\260\375\347]?rE\235\331\017\234\203\300\346\253\263"
+	.ascii	"Hfd\242\020\212\316LU\357\237I\201\036\214\3533\364l\266\326"
+	.ascii	"\325\271h\226T)(7\002\343\006\017\303\300\200Q.\013CLd\277\331"
+	.ascii	"<\204\263\204\004\364\t\345\320\250\274Af\314v\027\326\013\207"
+	.ascii	"\027F;\272\210XI~\035Q{r\251\360\247\rs\0314\324\214\212\233"
+	.ascii	"\206\033\247+X3\020\251\237A@\261\021LAM\216\203\236\232\"\274"
+	.ascii	"9\360\034\350\037E\370\336[\221\262\312\305L\214\301\025\030"
+	.ascii	"\360\002\246\300t\365f\016\024\311v\216?V\"\037\357$s\224`\262"
+	.ascii	"B\214\256\031\301\377\3063\354\370\030\207\031$\273\353+2}uQ"
+	.ascii	"\275\225\332\023y\3037d\036\207\022\251\237\305\321\022\177\256"
+	.ascii	"\004\027\2630lt%\005h\303N\002\242\354\007\321j)\177\n\031\326"
+	.ascii	"\002{\346J\227\256\252%\335Ej\305\276#c\016\326\214\216O[\341"
+	.ascii	"\002\245\255\240g\321\265\251\270\033\224\341\212*\020\017\322"
+	.ascii	"b\374\254\316\371(&\321\306kN+\261\332x_o\226'\267\003*\245s"
+	.ascii	"\272*\256\276\206\202\237\271\262|\221\225\2407Mv\361*\036d\227"
+	.ascii	"\333q\013\003\316\303\341\203O}9\255\217;Tan6:\266\274P\t\370"
+	.ascii	"\037\210p\203~\326c\270*NL\274\231\23573\353\"fa\245\322c\360"
+	.ascii	"~\210\366\351\315\3556J\336K\211\202\006\213\"\200\f\322\037"
+	.ascii	"=hs\301\342.|\017\243\320p\313W\337\3306($\024\271\221\252\b"
+	.ascii	"\261\031\031\275\341\246\007\"\020\200#\201\320\235HX\324\240"
+	.ascii	"\007\215\216\264\255\227aJj\346\331\316\251\207\275P/\2421\224"
+	.ascii	"\210'6\bj\267\004W(a\234\301\251\357;\323$\017\246\221\035\375"
+	.ascii	"\317\241\021J\333\356y\367/jqb\033o\227\373\21565\253\221\326"
+	.ascii	"[8S\373\263ux\347\004\330\370\263\226\340d\235.\234\314C\253"
+	.ascii	"T\267\242\275\331Gk\024\355\231$\033\311\031\"\033v\243R]Y\305"
+	.ascii	"\366\024GC\306\302\321~\375\0013\305Q^9\r\242i\223\024\"\364"
+	.ascii	"I.'\300\303\367O\007\360x\211M\250\033\324\255\301$\377Y/Y t"
+	.ascii	"\002_\026v-\244?\355\336\303N\366\327=<\344\016\222\013\311\235"
+	.ascii	"\022A?\353\246\335\241-\315\365\376D\013\357V\273\230\f\223f"
+	.ascii	"&\370\013\360\354c\326X\342v\355g\301B\247\300\344p\360=>\306"
+	.ascii	"\232J\316[[\002hXt@F)\210\333xsw\246vM\t\017e\245\310R\025#\340"
+	.ascii	".\004\b!y\345\250\243\313cQ;>\032\026\300\253\255\212\001\360"
+	.ascii	"rfA\026e\252'\2542\212;t\342\001a\311\236\007\327\034\321\026"
+	.ascii	"\251}$\262\303\305v\270T6g#[\001\215K\304\232\205\024\322\231"
+	.ascii	"\262\223\203\216\177\200\006\022G\030K w9G\031\345\222/\335\030"
+	.ascii	"\277P$\353x\336j\303\342\330\352\243\"p\b\200\343\300\256\b\320"
+	.ascii	"E\036\302\306\224\325\206\276\316\321\024\302Mj\255$%\372\373"
+	.ascii	"X\334nR\230\270v\b\007\225\212\236\310`\245\245b\177P\234\\\321"
+	.ascii	"~t\305\245\321\005\200\210i\373\276\205\255\220#\032\253\326"
+	.ascii	"\272W\305\255u\3728\262\231\233\311j=\270\330Sq\356T;i\024F%"
+	.ascii	"&\213ZD\312@U\2556p\370"
+	.string	",P\342\353\363Rb\022\376\277\2535`\250\003\003F\016\340\377\222\177[l\312\0030\261+\230\257\302\375N\353zF,h?\013\t\020\305\355[\353\327\025\033\314\0130\356\006\320PA\266n\200H<\376\0214\375\020\322\235S\226\265\233:\f-7\243\234\231\211b\232\330\032\353>\002\020\006$X\340\217\232\b\030\\\341\026R\216\037\3446R\315\263EhZ\210$\3163]\203Z\271\241\356\251\377\002\346{\271yg`\360\005\2267m\233\300\274!\374K\022\003`\300w\261\336w\357v\326\274\237\350\270S\331\376>\375\2003\257\353GP\202#J\217o\346\212\367\215\031\233;\346\212\274\363K\037\332\274/\367\200\234\361\343\221\027\275\340\316\231\035\257paQ\317t\351\361|\\\271\371\270\216\265\007w+7#e\267n\300\235\312\335\021_\256~\260`\316\345x\347M\311\335\306\363Q\221\247\273\316G\177\207\3228\275\361\313"
+	.string	"\327rk\337\355U\242\017\017\351@\320\027j?\031\3075>\330do\0010_v^\327C .\210Yg\302\205r\2374g$\336\351j\311\307\246\366h\177\342\312\032\341\034\016U\326\303H\222\303\233\313\346\033\267M\212e\214'd\371\264\025\247\250\364\222\024\016\372\366\210\320\300kc$\372T"
+	.string	"\034\341\202+\254p8^`}\216\205\345@\353\021\365{#3[\266'#\272d\227_\033\252f\001>]\343\333z\016\246|c\366\320\311"
+	.string	"\201]\310\t\302t\245\362!\204\377\240\200\027\366\243\3318abS\373\025\335\374\270~\340\351]\357\r\227*\267qz-\322bdW\241\343\b\347<\325\271/\253]\3512\256\361\231yj\374_:nW\313}\311\304\335\372\220aI\207x\315l \250\313"
+	.string	"\276\253j\235\365"
+	.ascii	"\n\371\243bGu\t;\247\377o/1gd=\302\352\\Ok\037\315>I\271\327"
+	.ascii	"\323\335^[h|S\263\2537\262\277\250?O\\2\037@\023\273\353\322"
+	.ascii	"\345\370\345\245t\003"
+	.text
+	.section	.gnu.lto_.symtab.72c9d2841057a0a4,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"blackboxWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"blackboxWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"afatfs_fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"afatfs_fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"afatfs_chdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"afatfs_findNext"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"afatfs_findLast"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"fat_isDirectoryEntryTerminator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"afatfs_mkdir"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"afatfs_findFirst"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"afatfs_fwrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"afatfs_fputc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"afatfs_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"afatfs_isFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"afatfs_funlink"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"afatfs_getFreeBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.72c9d2841057a0a4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,260 @@
+	.file	"debug.c"
+	.section	.gnu.lto_.profile.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 &\375"
+	.string	""
+	.string	"\270\032"
+	.string	"\004"
+	.string	"\354\214\352\346\007\001\240\342\234\212\n\002\003\240\342\234\212\n"
+	.string	"\002"
+	.string	")Bm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_debugModeNames.6.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375`\"\nU3"
+	.string	"\372]t\02440.5\007<\303c\214\306\030\326bmT\036\016\364B"
+	.ascii	"\020\365q\251\001\337\367\227&\222zS\351\261\206\233J_\233\231"
+	.ascii	"2*\313d\341\005\273]\223\206R\222\001;\001I\0017\001_\022\236"
+	.ascii	"\n\351vEH\332\363\204(\3039?\264H{\246\360N\202~\250\370\025"
+	.ascii	"H{\256\360\016\347\234\021\321\317\370~\365\321\236-$\031\322"
+	.ascii	"9\243@\343\373\025G{\276\360F"
+	.string	"PoD\034\243=\353]\2507*~Y\321\2361\340\"\335Q9\276_G\264\347\f\265Lw\3046\276\317J{\326 \013\365Gn\343\373\236\264\347\r\257~\376h\035\337\277\323\2369\260\"\342\224\336N{\356\220\212\205Sb\307\367\353h\317g\246\202^\351m|?\215\366\2146J\350\225^\214\357\213\321\236=\200\212\341\226\334\361\375\017\235\342\334R\361\227h\317 4\311\371\0351\226\366\034\342\222\234\337\025\375\223\366\234fI\206k\2421\276^\247=\253M\262\341\232p\214\257\273\321\236E@\312\341\233t\214\257S\321\236G4\202\363M\305\036\343\353N\264g\022\212~8'b\220\361\365\241=\2278\024\347\234\2127\264g\023uq\336\2118d|ah\317'\006\021\361NE7\355\031\005 \".\212Xd|Mh\317)\334@\3173v?ra`\022U\201\243\313\210\221\327\237x\036\216\357k\317\370\313\007\306"
+	.string	"\324\004\337\346\337<\234\227\363s\276\316\333y<\237\347\367<\237\357\363~\236\356\001\275\240\037\364\205\276\356\355\376\320'zE\317\350\033\375\243\207\364\222~\322WzK_\374K\237I\3557=\247\367\364\237>\324\213zR_\352O=\252W\365\253\276U\332\277\n1\274\003\300\225\221&HV\340w\005w\201\330K\305j\230\347B\361S\3754\261\367e*\206.\362F\305\340@\354eP?\016=:\332s\257\323\220\256\003\261wF{\006\240I\256C\261gEc\032\3469\353\275\3323\330]\360,\343\322\236\303(\r\363\240\355\031\337\334J{\026\213$D+fS\332s"
+	.string	"Gd\032\261\250=\217-\"\3232\"\355Y"
+	.string	"\242852C\3039\265b\236\323\236\313\b\305\211 \316\321\236\315\002\305\211(\346\001\177\320\021D.\3323\2019tD1\027\320\023\207\202\330K{6p'\006\212\"\317\225\366|\200\016\231\202\210 \016\231\202\227\300\215\234\n\036 \355Y\301\0328\025E\036\037\355y\001\032\341\n\"\217A\231!\335\n\036\032\355\271\301\213a\341uD\236\203\377\022\347u\274\007D\324\r\325\322\236!\274\026\"n\250\370EJ{\216\360W\340\334\216\030\346\336k\351\226\244"
+	.string	"\\\222`\330g\246d\311\272\353\026\262\271)\031\364\231av\257{\233\356\017\270\335vmc}f\030\030l\200\367\033\220\335\245\002\254\276\255>\227-\321\226E[\262e]7\025M\335\223\335\345\002\274nr-c\037\nt\315\264m\327\335\326\272f\260d\315\355\262@\266\004\330L}\250\253\n}`\270E\177h\352\236'\030\366\231-\231\256\300m\266*\352\236g\031n\203\3006\270\272.\3265\267\222L\327\3120\2153\034q3l\324@\253\261#G\334\f4\0369d\300\241\321"
+	.string	"\022\004\355L\001\356\341\303\006\0204!=z"
+	.string	"A\023\303\333<Y\225\334\255+B-m\204\013\362g\206\375\217\323y \027\344\204\274\220\033r;G\344\211|\2213rG\376\310#\271$\247\344\225\374\316\213\216\3113\371&\347\344\236\374\223\207rQN\312K\371)G\345\252|\225\267rW\016\313c\371,\247\345\266\374\226\347r]\316\313{\375\221G\362J~\3113\371&\377\344\241\274\224\237\362U\336\312c\371,\277\345\271|\227\367\362`>\314\217y2o\346\317|\232W\363l\002\330TW5\233i),\303\260p\233mK\256\215\330g\n0\177\3536S\263\004\256k\352C\201c\200r\233\231)\233J\206a1\274\3154\3503\333J6\f\273\225d\313\366\360\017\270\201\277\326-Y\223\f\233\276`\213\266)\t\206\333\363\344a\363\207\266,\314}\272\355y\202\t\335\330}\262l\3339\006\206\337\310-"
+	.string	"\237'\352#\303d\330\255\\\323\022\005\262lp\215\315\270\335+\360\354\341"
+	.string	")\031d\341n\323\247\242\247\311\246\222\273"
+	.string	">[w\223>4\005\303)\251\226\276s5\335\310\326\025\222o\244\032\334el\306{eU\223u[\325\334;X\222\34156\310\303+\352\013\222\355&\177\254\030nk7\017\273 Ss\273\277m\266h"
+	.string	"\274M\025]wI\216\3411\314\262k\352\246\244\312\206\222a\263%\267\313\246\242m\355\272\376X\267\334\003\260\260E[\220\233\315E[\225\034\303'0uU\241o\304(\220u\177\301\335\272\231@\326u\261\313\260p\267\346\317L\315\266"
+	.string	"\336f\233\242\247\030V\321\237\353\353auE\3332\200\257\250A(b\260\225dJ\202(((H\2224\006\240\")\0322\017\021\260\220b\025IIm\007j\243~\202\005B\232\006\245[\b\345Bf\bt\220LG\233\f\222\213\036\214?\2703\237\256\255\3330|\336\026\376\331\343\024a\317\"\302a\323\265\204Ut\364C8\322\257s\213\017\253\021\232MR\367w>\346F\346\r\017W\223S'p\231"
+	.string	"\024\365`\005\253\242n\002`\247\257\"\305\203\244>\032\036}\251=\330p\024\302r\347\210\371\023:\335%\264\326\343\037\304\343\363"
+	.string	"1\343,4\320\255\230{\212Fe}\033\340x\245\231P\347C\345L).\346\276-\231P\215}?\030m:\351\007u\325\222\313\003\275G\214\325|]'\257\037f\034\3714\033\003\030\332<\374DF\036N\013\234\310\351>N\334\215\0256\036h"
+	.ascii	"\300\220H\322\312\351\2134\323sH=\323\271\214\326\241\r\332\b"
+	.ascii	"\025\362\365\364f\316\213\335\227\300\216\306\316\272\200\004"
+	.ascii	"\030s\253\373\035\357\265\320\213=\315$\201\255w#\253\370\227"
+	.ascii	"\274\200\335\253\235F&\tXuv\372\235\353\337\356\353g\244l+\230"
+	.ascii	"\262\035\323\236Rn\027\001\323\357\335K\301\303r\237JC\234\272"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 *\025\001"
+	.string	"\300&"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	"\201\204\001\005\001\004\002\003\003\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	" c\220\230V\361\002"
+	.text
+	.section	.gnu.lto_.refs.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"(\265/\375`e\nE3"
+	.string	"\332^\320\023E`^N:w\207\237+c\022Cg\241F\037j\033\247\315\265W\252\r\323\017\212\346\363q\263\036\355\210\027\3338\330w\016/;\007\177\201\376E\362-\350`\360GHb"
+	.string	"\037vbGO\255}\366\332\3577\2222\005\375"
+	.ascii	"0\0010\001M\340\226\221\013Z\327s\333\317g|\205\265\f%\357\235"
+	.ascii	"\272\367\022\360q\375p\312\265\026~\376\030\217\311f\221p\231"
+	.ascii	"\005\306\244y\366\203\333#E\253+;9\313\231\215\327\276\304\364"
+	.ascii	"\237\033j\367\354\336\313l\024\222\367J1\233\220\317\275RBf\006"
+	.ascii	"\314\f\252\331\327X\233\255\237\340\343fz\306\362s\032\253\r"
+	.ascii	"-r\253y\237\367^\341\017\0175Rx]\337d\242\365\361\320j\340\241"
+	.ascii	"=\243}\200\332ez\221o\301e\242\375\201\362\320\276}\377\267\374"
+	.ascii	"\034\342g\020?\177\370\331\303\317\035~\346\360\363\206\2375"
+	.ascii	"\374\214\341\347\013?3\375L\341g\t?+\375\f\341\347\244\237\035"
+	.ascii	"\374\334\340\347\243\237\027\374|\340g\003?\023\177\026\360\263"
+	.ascii	"\360\347\340\317\300\237\205~\006\372\271\376\374\377z\376\353"
+	.ascii	"\375\307\373\177\367\277\316\177\350\377\007?s\375\227\363\177"
+	.ascii	"\315\177\271\377n\377\353\377\270\377\035\215F\243\377\233\377"
+	.ascii	"\261~\241\016U\317\256\302\263\235:Du\312/v]\317u~\246\303Pf"
+	.ascii	";q\357\024\335\224)l\272\262\221\211\266(Lz\236#\364\006]Z\331"
+	.ascii	"1\331\216\345p\321\275\312\345\023\2414p\312)9q8y\3573\210\345"
+	.ascii	"\254\"\244+\263\3416\3144b7\3477\f\347@R\315\333d;Jp\\u\005\300"
+	.ascii	"D\333|\364\331\270\227\215,G\243ld\3179\346\376%&f\362\034\257"
+	.ascii	")\220\201\354\fz\221e\222\254\335\030\336\262+\323\261\032f&"
+	.ascii	"\340:\242=+{{\272\336\206\357\234\300r\224\023\330\027}?\277"
+	.ascii	"1\371\215\345~\306Z\306\204^\344VR\t&\025\222\256g\271\237\273"
+	.ascii	"\260\027F\323\255wL\333\353zF\363s\030\026\303q\235\274\327\315"
+	.ascii	"R\021\023\205\254+\217a2\314D\3422g3|\346\277\251\346]\273\267"
+	.ascii	")\374\261\271S\344\331\365\210\211\266\266\360\235\221\254\220"
+	.ascii	"\221,\003\340\241\345/\351\031L\0061\245Y\327\037\036\332\245"
+	.ascii	"\364\fg\253\204\361\322\353\332G&|g+\314K&/\331\355g\274\367"
+	.ascii	"G\n\344\b\245N\336E\022Ib1\262\252\254-D]q\266\214\tI\272\276"
+	.ascii	"\f\023-\360H\372\376\262U\214{\314\272\ny%\361\340|\351\350\372"
+	.ascii	"N\376m\244\273\254q\352HYW\tL\264\026G\372.\342\346\nN\213\310"
+	.ascii	"\220\241K\007V\327\365=\344o\256\026r\034\262E\247\353\241L\264"
+	.ascii	"\301 \351{\253\307\236qq]\211\032Hk\361\271\313\323\353\372\326"
+	.ascii	"\372\033\253\263\200;\352\362\262\210\026\301U\372\376\021\024"
+	.ascii	"\346uE\254\353\001\244UM&\273\332t}[\375\255\243}\324I\205\205"
+	.ascii	"ue\336K\337=\206\300\374P#\323\307\256\212s\264{\353\372\256"
+	.ascii	"\372{G\363`\266\023Mz\204\265ue/L\264\006xh[G\3726\376\272,\347"
+	.ascii	"\224]\215:\007\025\260M\0264Z\272\276\251\376\306\321SorN\260"
+	.ascii	"\256HL\264@f\322\267TU\342\261\"\353\033}{\316\327\027>]\337"
+	.ascii	"\367\347=\216\006\271\321\321\271\352\312\005\370\244\347>\276"
+	.ascii	"\344\024*_]\t\354\321\003\224f\304\323\326\365\254\347\347<\326"
+	.ascii	"\033\n\323\302\232\353\372'\023\355/-=\347\021\256\351\202\347"
+	.ascii	"\004\017\036\0330\2644]\317xn\277\256\254!u]\371Nz\276\333\323"
+	.ascii	"\013\305\246\ni\021\006T\020P\261\311B\320\257\330\2644\241\b"
+	.ascii	"\003\212\206o\306\323\013(\0220\242\240\212NO3\206n\364\250\030"
+	.ascii	"O2\224\212QQ2\224\2002P\260p\252OS\017G%F\200\3609EPR\341\002"
+	.ascii	"\212F\n%\030P(^(9\311\230\241\024\241\300\214\247\027(F<\251"
+	.ascii	"\210\022\261\202F\212'\025A-O*$\032\252\256\357\347\337G\232"
+	.ascii	"\315F\307\356\216]\357%/}g\001Ne\2659q\256\t\361B\302\243\327"
+	.ascii	"\276\366\246$\f\212E\315\007\204*\215\253\353[\355o\262N#\"B"
+	.ascii	"\246\244S\246\357&\020W\234\227\030\023\355\013\371\246\321~"
+	.ascii	"\276\323W\342\314\254\311\343J\337g\321(\230%K3\247\023\n\262"
+	.ascii	"\353\333\354\357*m%\330\245\246\266\325\225\221L\264\001\350"
+	.ascii	"\244o*\301++\316\266)R\300\234m-\345\357 ]V#\332'O\327\273a\242"
+	.ascii	"m\262\364\035%\315\030(\263\353\020\224'MWP\372\t\333\211>M\252"
+	.ascii	"\346\272\266\223\364=\246\200\213\030\270\256AM\230\004\335\b"
+	.ascii	")\273\353\372f\362wX\213\005\317 !\343\243+'\231h\005(I\337K"
+	.string	"\200[\342\372\214u\035&\001K\263\302*\353\372\006\373[\331H\226\216K\002\200\265\2501$\205\214$\f\023\021\022\021I\232d8\200\002\t\304\214j\036\021`\241\222D\220et\353\006\205\333\260\006j\214SvM3L\024V\232\027\335@t\034\343\364(g\330pCn\3012\232x\005\367\320\037\260\211Y(!\002\013\347\301\007?\f\016^fQ\256kv\001j\026;p?\025\"\234=\240H\006/n\311\330\311\244\243\366ao\020+\270v\230\275U;\007g\024\227D9\342\377j\331x\242C\3210f\032g\027J\210X2\320\275\207\323\023+\030r\264p/QgI>\027\351\350\353\333\331\327A\224\313E:\371\226\376\374\215\274A\037V\032b\003\357\266\210\006\333\220\026gu2\351\324\217t-r1;r\r\205'T$\326\216@\004\007\272()h\366\231~c\3301\022U\003\220\351u\264\225\025\303\226#"
+	.ascii	"x\312)\304\006O\305\013h\245{\341\204\361\264K\020\333\031a\351"
+	.ascii	"!\206\271\275\336\276\311+4\234O\025\037(1$\013SP\277Y\301c%"
+	.ascii	"k\330 V\257;BL\351\226\241\001d\r4\017,\007=}\354C\242v\346\225"
+	.ascii	"\330$\240\323?\360\361&\206\242\242\265r\001\341(\370=\340\213"
+	.ascii	"\"\330\322\233\242\236A\247\207\b\320-r\345P@/\225#<?mI\366t"
+	.ascii	"P\303\254\310i\005\376kVF-N*d\225\fBV\003"
+	.text
+	.section	.gnu.lto_.symtab.3e3b2dafcdc5f47d,"e",@progbits
+	.string	"debugModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"sectionTimes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"debug"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3e3b2dafcdc5f47d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8748 @@
+	.file	"cli.c"
+	.section	.gnu.lto_.profile.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001K"
+	.text
+	.section	.gnu.lto_.icf.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\263\016\245?"
+	.ascii	"\n_\264\0259 \244Nc\377\344\"!\356\204\353\"\224\201\b\206\375"
+	.ascii	"\313"
+	.string	"\2333\035b0\201\210H\220\335tp\2079\240\256\031\204\237R\375\f\310c8x*\035\202v\273\321R\243M\366NR\006J\001P\001F\001~\222\340p\200\277T\206\001\263\241\351M\277kFKy\246a_\001z\334\222\201\351\004\316\364\001\177\005\\\363\262\027\264\024K\350\316\240\205\n\357\334x\315~Q\320\262\326\233\304F\023^\231\216\257\021Q\202l\271\227\226\026\341\363^`\035K\b\316;\367\257`\226\024g\230\350\201\363\365\233\343\302\222\232\341\227\005.\3029\330\237\177\370\n\021\032]\203gd\326\r%\203\005\324S\177f\031\242\230a\324Kg\362\360\n\312\032\235\224wg\206@\300\003|>,\345L\020\316\023\034\251n\314\321\001\275\365\354\024\322\251\352\270\f0\256\320\300g-\033\313\254\023\200\353;c\3136\305\312\002\362\237V\235\241&x\315^\237%\001&\350\241K\237^i\276\322\347/\301p\327E\260"
+	.string	""
+	.ascii	"\226\236c\177n\217S\371\362\337|s\244\375R\232e\347L6\2461\215"
+	.ascii	"4\216\204\306\006\033\225^\372K\325\370\036\023A\343\350\243"
+	.ascii	"\377\006K\3036\367\324\260\342\027-K\347\273\345\353\242\326"
+	.ascii	"\204\235\202\213\34282\241\177\037&\216-\360\215\037\377\207"
+	.ascii	"\344Z\203\343>\377\374\231zlm{\316&\314|\233\\\301-~\331\355"
+	.ascii	"\336\375\376\277\257\277\004\335\376)\312\351MF\317l\001\217"
+	.ascii	";\\\237\032\005K\030XD;\341.!\347\210\350Ys\370|\247-\246H\016"
+	.ascii	"\344\020\r\372\031\276\341\032\2563\034\303\237\244\203{\270"
+	.ascii	"\256B.\\\270\360\370\026\036\277\302\275\346h\321\001\342$\310"
+	.ascii	".\353\007\205O?\341\023\356\334e\225hX>$D8\2043\305\214\336\256"
+	.ascii	" \365\3200\2426\212\270\360x0\207m\265\206vHi)\251\317\227:\203"
+	.ascii	"G5\377\030\r\232\345h\360\331\301\253op\375\006gp\007R\355c\""
+	.ascii	"\030\252\250\005\361\243\016\365\247X\2166\256\217\215*\224\f"
+	.ascii	"\245\340\362\235\234\324\376\230\251a\275U\313V\353\265\374\004"
+	.ascii	"Op\353\255w`\005)9GCK\031\317\260\262fhw+\261\221\f\035\235\374"
+	.ascii	"\"+\024\003\276\314\002v\301\210\267\3100\226y\341\342\300\343"
+	.ascii	"\247#\370\323\247\007\036W\317\364\303AxwZ\350k\003\006n@\277"
+	.ascii	"\002\220KJ:+\234\376\306br\200})\n\304\327\263\254#\212wR\243"
+	.ascii	"\326\330Ts\214l\322\342\t\375N\032\272\245\231\320O;@\210\bK"
+	.ascii	"h\231.\254\221!\t\375\260\265\313\272\021:*)Y\210&BG\341\300"
+	.ascii	"\266\205!4\224\032\330%\210x2l\262\321\007\375F\236i\037=\350"
+	.ascii	"\346Z\233\303\304\016\372^\002\217\342\264\371\3550\035\327\021"
+	.ascii	"\344\372@\256\177|\307}\354\350q\252K\345q\006;\256O\245V\257"
+	.ascii	"\343\356\2150\001E\032\342\332^\373\317\361\034LR=\273\256\310"
+	.ascii	"\335\205\3438\240\307q\034T\277qM\365\3707~\343V\004\331E\302"
+	.ascii	"\r\206\311g\353\020\322\346\242a\243\006\215\273Wp\005\237\361"
+	.ascii	"i\211hd\0277\202\373\313\366\372\313\253\334^f4\\n\3506\027\031"
+	.ascii	"\227\361\030\217q\030\237\276x|\027w\361\026\017q\026\327_\361"
+	.ascii	"\251\212W\243Z\202g\314\266\226\024O\221b\252Z\235\372\364(\256"
+	.ascii	"?u\b\237:\364'\366\\\035\230\244,s\327\032\245$\226\371s\200"
+	.ascii	"}%\027\217\331v\354\212,\305c\230\347\220\025\023\237\036~\003"
+	.ascii	"\023\323\314\252\2248\211?\272\006ON\020\225\352\374\021\327"
+	.ascii	"\217\302\224^\256\200\246L\357t\275\272\022\021\241h\346\034"
+	.ascii	"<\3073O\366\247\177\376)\342\"\016\342!\016\342Z\217p\265\256"
+	.ascii	"\026\2714ij\266i\273\013d\005\303w\\\334\262L\334={\201\332\226"
+	.ascii	"hh\2405\354V\211n.\212Sy\230\344\375\240<DF$\007\036\177\370"
+	.ascii	"\207i\024\025o\033\347\b\364P\370\025\254\323\007kDV\343'\321"
+	.ascii	"e\225\207:\336\"\303Xf\3579\361\350\213-\363(n\373=\267\212\276"
+	.ascii	"\022\355\276\375\275\227:X\033\013\3216\337\322\247R86\223[{"
+	.ascii	"o\226\367\231H\220\222[/\236\035\035\267\fn=\360]c\237\327\316"
+	.ascii	"\323\367\263\206\345\333y\264{'FQ"
+	.string	"n\343i)\331U\226\342\276\333x\364\365\223'\177\222\001\312\230\345\250p\337q\025m\327\332\266\035-\275:\276\351m;\355\212\205\215]\356\272\004\227\255\266r\2766vV;\364fg\267\241\360\251\223W\037}\351\260\334\256\233\r\364P8\206\334\263Wh\2735\257cz\372v[\223&\217\251L@8x\200{\215\206\376a\375q\333lV\327V\327\217\347+\331d\230\235\206\311\231<\252t\bm\315>S\3435\226\034\302\235\262]$\241\236\275\246\341A,\241\355.\243a9\302H\331\255\246\344\325\303L\255\233\226\355N\333h\260<\030\t\327e\223\321\316-bp\210{L\222'\371\233/wj\373\252]-\243\236\240}\246\245ewW\177\266\030$G\"\037\016\361\346r\3216\323\316K\311:\\;L\325\365\021\375\252\317U7Ru\367E\236\214\032\r\035\332d\360\233\227AY{\214\352TD>D\310\205<"
+	.ascii	"4\201J\250\201-Qd\206DFD$M\222\306\001\005R2\207\306\352\006"
+	.ascii	"\022 \324%\215\203D\241\021\031\021\221\202\244\240\240\222a"
+	.ascii	"\016\030\217*x`\221>\307WY/\216\312DCE\275\234H\217l\342\215"
+	.ascii	"Ld\245g\321E\324\242xK\030\252[\243i\270\366\255J/aj\225gD\002"
+	.ascii	"\017|\376\372\"T\373\234\317\354\321\247\241\322\326\347(~\217"
+	.ascii	"\365j\241\372\177\375\221\342\365/\335\226O\250\340\273\3732"
+	.ascii	"\364\rO\223S\017\r\370\311"
+	.string	"o\257\253\037v\2479\320mpdD5=\210\244=\303zw\262\254\333'\037\024\033\243\33514\360R\317\316\207\227\376\314\207\2012\321F\242_\267\235.\200\370/G\206kY\255p\357\344)Sr\236\355\t]\33125\026\233\333\024\236\322WP\2011\301`~\b\325v\217\352\231r;\274\316\230 [\356-\024q\2009:uZ\317\266m\3552\256\017y\352 \267\\\205\356f(\337go\030:@\020\235G\343\253\273\206\b\325\317\234\205\335\006\2574\231\345\3125\036\033e\236\370\206\024I\016\216\276\363\177a\223t\357\341+\362\313\313f\262!oc\352\326\331,\334\020\335\357+\270}X\203\207P3 x\253\363\027f\024\302e\037\237\330\220\220\313m\312S5\255\223W\311\352 \355\307\353}\003\353\310}6\235\212\207\213f\324\001\252K\315\025\254\r\215\370\2056\346\016\310\334\320\f@Y\026/\223\245\3077\311"
+	.ascii	"\213\033\341\206\033\313\213D]6\\n+-\324;cL\005#\366T\n\005\235"
+	.ascii	"\027\314\362.\230\373\376\274\345+\024\350;\363\220V\244\304"
+	.ascii	"\r=\304\223\367\222\306\2679\006T*\304\341\206\021\356JR\006"
+	.ascii	"cO\3648\0338|\273,\361\210$-\266\302\265\030\260\225\363\376"
+	.ascii	"p9;T=\224g\352]\371\340GS\033\327\366\337n\325\230|\257\320A"
+	.ascii	"E\226.m\302\215\237\307\272\355\207\252\324\375\017\263\272m"
+	.ascii	"\317\301a5\232\037T;B\235X\354\017)r\252\350`{\374(d\t\307\211"
+	.ascii	"\325Q\022S \001\034\204\347\314\240}\331@\245\264\347L\355aN"
+	.ascii	"\037&>\277\253\324\354\034\177\320\305t\2128\237\203q\275\212"
+	.ascii	"+\fr\374\030Q~/\2260\235\235"
+	.ascii	"7\356\214\3613Z\020b\263\177t\210\211\217\306%bgb\332\225\"\177"
+	.ascii	"\330\033\216\322\030q\037\273\323\263x\202n\226\b\353\332\314"
+	.ascii	"/\344\231\341\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\260\025\235+"
+	.string	"\326\335V.\240\262$\215\001"
+	.string	""
+	.string	"\274\0260\344\034g=x\245<\240\3354X~\021\367\213}9\340=f\333\025>+\214\311\365f\355\336\3156\"eJ\001="
+	.string	"P"
+	.string	"O"
+	.string	"\266\333\202I\301\272%\360\020(\273\017(%\225\276;\003\003\004\230g\320\356\t`\3514\364H\245\221v\201\374\265N\245\355U\221:\033\355t\267\3352\0232\273w\322W\232\220}^\262"
+	.string	"\231\272X\267\330g\361\212u\373,\227J\305\264)P\2340\261.Ab\304.\"\004\210\017\036\326o\0358\354\2065d\300p\301\202W0\365D\024l\363\236`\336$AI\032Z\375h\021v\b\017\034,\322U\220R\004\f\211mS"
+	.string	";bw\003\006\0017\305\223\262{\351\t\224\317\311A\371DMv&\373\022%B\312\214lEH\023\031\"\344\226\006\031\210?|\364\230x"
+	.ascii	"\275\303\266\237u<M9\274\305qf+o\250\265l\370\324\370i\254g\350"
+	.ascii	"2\316\226(\206RR\224\357"
+	.string	"\200&\030{/\226\001\256S\351\335\243G\177,I\2365\036\265\335Qdg\325\231\216\316\321\345\2548\017\347\215\233\325\306f\243\256Q\223f4g\314\224\031\243\334\023\363y\030\322\002\343\227\367\322\205\313\226\265\234\005\213~\305\255\230\232?\332\316&\257bO\345\2027\250rL\325\224$\205\235\003\"\n0\022\205Y$\305\324\003\022\240\322(\206\364\240S\f!3$\"\"I\222\024\025%\035\232\351\376\274\250\215#\360\020;6*\332$\276bb\017Nx\232i\361\311\t\266\243\"Vu\246XF\317\201s\262\b5\255E\250&0\203\r|\232\243\205\341\226)\021\372k\234\235\241\024L\353\030\340.?m\207/D\362\214\273HE\351i\231\250W\355\220\204\221,q\250O\027-\036\315\302\340\026\275[\340\237\210\272M\200\204uC\367:\347\206\367e:\317\360\356t\304\333\373\311i\203\360\031-\243v[E\323|:\322"
+	.string	"\032\244\203\245\032\235\230\326\252\211\253\207\340E\337\230\007F\256K\342.{\226\274\363F\255\264_\225\351\332S*\360\005\f)\204\271\235qm\203\013-YS\311\330\224\274\347T\235\020\337ap\250,\032\306\266\264GT\322T\246\275\212\267\245\230!\240\242\254\230\345\241\202}\036\274)\325OQ\323%\034\324:\233\2566'^\230o\2703\314O\020\340\263\314x\332/\325.G\3130e0\374\\\337/\220\t$E\305\3165\260\211.\217\177uD\"\022\326\345\303\252d\313\350xF\270'`\221;\030Uny\030\301\f\"\037\032\332\331\366\021\244\210\372\t\205\350o\243\233"
+	.string	"!\024FO\354r\227I\035\372#\365\374\003\352\256WEt\332%\342\037KO\002H\252\027\246:\276\246\221\354\363zS\224\353`V\307>\273F\244_'\306\364\374d\343\323\321s\236\306\353\007\344\320J\t\240'\350,\304\265\265>\002\3005\317\203\203lt\245\311?c\360\276\340\365MM\331\301\214_\276\244E_\252 \317\335\305Q\204C\304\366\360\232\227\245m\232\332G\3049\334\213N\021\365\277\340\254G\0035\356\305#\301\3759\336\220\0011\262~\310\306\233?\311\371\371\326"
+	.ascii	"#2@\302=/(\304\034\013\200\253v\241-\256\237,\307\013V<\023@"
+	.ascii	"p\345\311\244\240\327\322\262J\263\366\3369\347\321\013\237\345"
+	.ascii	"T\375\322:\353\332\246\306\002\214+\0170\036\374i\347\302CV\224"
+	.ascii	"\341\354\306\260\356\356\346\350\275\276[i\354\021\"\013\210"
+	.ascii	"\375\251U\0211\355t\026d\231IH\247\300Q\025\206"
+	.string	"pt94\253\373\323`c\375%[\275jXmb\034B(\033\200T\202\301\216\224#T\255`\351\022\343\310\333\317\331\216\305t\246\f2\230\031\002\2535\305\242z3\246T\261\210\301\220\246\231\362\300\323\004\316\365\260\016\354\246e\211p\243QAI\007nu2\210,\221\252\222\333NK\350ilL\313!\232\373=v\177\271*\326l7,\262\200\035OsF\332\312\257\241\352,0\276`\226T\231js\243\324/'E<\254\271\3426\332\365\311\224\201 \247\002\266U\335\232\240\233\261\260\252[:\024\221\024\251\210x\235nA;\246\340\204\313\031\351*\316\254\343\322\230\231\360\023\364\n\230\226\005Af\020\353\003I\243\376\331`\352\274\314hk\270:\336?\366\214\233\210\3400vvCO\206Z\336\253\273p9V\246\006\233\026[\264\346A\311d\303\236\271\177\244Q\372\352\0269S=\236ma\331V\254L\350\023\016\256"
+	.string	"\253}\200WF\367\374D\276`\200)\214\022\025\255CD\3102"
+	.string	"\232\023\375\251\252 \016V\373\340\263h\333\261\031\307Y\272\365j.:\033\237\177'\212l;\215\267\001\251"
+	.ascii	"\036ex\245\250s\247xG\225\345\205 \240\327\322\336\226\001\207"
+	.ascii	"`\255\255\253\fm\306}\210\375\023\262\037\003r\243\247\006\345"
+	.ascii	"8\350J(\226Q\2244\240+\237\241(\035\352&\0265K\034t(\332\277"
+	.ascii	"Obg\376d/\310\262\247p,\262 azp*\307P\300\277j.E\227\271S\242"
+	.ascii	" \324\001\361A\334\004q\261G\344\256{\031/\363\237w{\364\320"
+	.ascii	"\033m\347p\253\235\232\244\034\320sgDHk\262[2"
+	.text
+	.section	.gnu.lto_.inline.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`6E-\271"
+	.ascii	"*\343p.L \326:I\007\027\234\240S\016\243"
+	.string	"x.#\225\317\310\3470!z\004\341\324(v\211'WJ\303\234X\302\355\304\237\266=f]Y\360\351s\274\b\202\031\2177`\346\237\344 \201\017\310\344\347)I\332\004J\334h\272\265?i{K\231\002\225\002\327\002\345\002TP\365\r\b\211\273\377M\247i\310\353*K\322\304R\204\022WZ\374\305\231\277\300\266\002p\272\033\230\346\020\235\234\337\017\330\223d\255gzzf\332\372\355y\034p(\347\027\212\303\272\333\367\362B\342\362\033\330\027<\365\006\320Z\236\222\2478\370\264<e\3428\204\342\302\350\311\361\177\020\336\375\317\003\357w\253\264\306\013\341\246\375\227\2011\bO\355\016<\244\007\036\302\177`y`\252\323\357\323\354sw\007E\212\027\340\304B\310u\201\202\305&G\004y\027{D\377KM4X\204\310\200\374/\017F#\022\245\020\360\004\374\246\023gy\331c\347\373\2418\n0O\370!\300k\212\332\234"
+	.string	"o\361\037Q\254\361\217\232B\230\245\025\372\361\277:X\211\023\261DG\037`\205\304\371;\023\017}s\371\013\305\305\356!\360\002\314#j\305e\374m\230\205\360\240\025=\270a\366\311\002\267\265\300\223\220\376\337\210\235\246\2333:l\365\244o\377\017\307\377\211\265\230\031\231\242\304\377BqW\031\024\206T\374\350\277\220H\377\003y\3734\273\322"
+	.string	"q\031\375w!q\3775\242;'N\030)\276\035\244\330H\235\031\033\337\215&\377\007\302\373\375>q\2402\2653\275\367.$^H\344\377\277\371\237\377\373\340\335\375>\315b\025\2533[\363q\2513[\253/\342\177\235x\247\377\243\030J\235\331Z\345\177\2438\210:\263\265\242\317\377\257\301\327\034\263\330\215\305;\327\340\271\342`\271._q\366\345\233(\357\237\377\301=\336\377\363[\225d\364\301S\377\367\314\366\230\352\377\267\307\330\343\251\363\276N3\253\313\227\233z\376s\374\327{\362\344\023[\325\231\035Iz\371\322ij1cwF>\370\340\366\267\235&\022t\312"
+	.ascii	"!\235\373\334O\374\344Lk\f\200"
+	.string	"\327\332\257L\214\325e\346d\236k\255}\246\265\317\364\006\277-!\243\266\247\375(\026\024\007\214\035\005\316\264s\314\273\273;\257\361\207\232U\314\322\222\214GSt]\214sj\317\026n\341\212\275\257\216\351\206\213\253\314\333|\377\237,O\226dy&K\262$K\3563Y\376\316\277\363\217iv\267\325\374o\373\374\333>\377ppw\017\367\3017\315bw\2478\007\317L{>7qw\367\370Wu\367\360\377\335\204y\035x\177\023\346\251x\377\340\374\024\357\230\r\26390\325W\314\362\272\030\237\0037mp~]\2149\360\324\213\276O\\\354\356\025\377f\235\206\003\001wt@\372\037\306\225\021\206\324L\263\244IK\360\030v\227\351\212K.\210.\035f\326\035\262A\027\364\203\241E\030P\255\367\237>\261\027\0231$\306.mC\266\005^\377\304mF\264\326@q\034\231\2307Gbb\200\334\"\340\375o \313\330"
+	.string	"\020|\016!\372\333_\330\336\377\025\2763iH\232\330\346\177w\260\023'CC\177\373\271@\205J\357\364\273\302\027\327\373w\205\257\305\223i\305;\025\022\377\001\230\242,\336\3539\305\330\203\355xyR&\343\365u\007'9#\003C\236|\024\367U[\236\332E\256\332\360\224\274\377K{\304.\361\224\021\343\022S\361\374\3260\263\2240\253\363@oa\002yHK\214N\277,~\275;F\377\262\370E\315(O\330\021B\351\365P<\364\222\347\215J\361V\242<fJ\372?\001^\376\277C\300\214\t0\025\363\227\007\007a\207.\313\327"
+	.ascii	"Y\240/\270O\311\034\214\350\316\316\016=\335>m\3420h\272\274"
+	.ascii	"\031\037|\023\323\3461\325\276Y\346\223\350\b\326\357+\314V\341"
+	.ascii	"Bb\n$=O\371\302\005GO\305\332\264E\361\203#;DGZM\031\263%\215"
+	.ascii	"\006\357\377\217r\253\222\214?\230\352\013\267B\354\306/\021"
+	.ascii	".a\211\360\020\376\223X!v\343\017\356af\313\226@g;\nF\377Y\374"
+	.ascii	"\206oV\322\216X\"\363\277\217\367T\330\326\250,\326\236\360\357"
+	.ascii	"\227,\232ov\022\301Y`\372\031\303r'\343%\024m\267\340\335\271"
+	.ascii	"h\326\307\3574\222\222\222\236\364D\213\2318\372\262\327\315"
+	.ascii	"\356\233%\227mwx\250\271E\r\317W\n%\022nT\367\264\37698\016\241"
+	.ascii	"8*\364\344\233\3468\334+\336!\257\020C\343^\361\324\226\373b"
+	.ascii	"\374Z\275\030wx(\036\332\365\351\242Bi\004\021\376?\004\020."
+	.ascii	"$\006?\360`\215\270\272A\362\246\245\367\016|J\034lp\rf\374B"
+	.ascii	"\"%\347\377mf\263\333+\344n\334f\252\317o\324\\\223\301~\317"
+	.ascii	"?TO\t\203\256\374?\212\307t7\360\027\210y\2055\3711\201\013T"
+	.ascii	"\006|\005\377\322Qp!\361\354m\311\331o\b\205\2419\243O\260\337"
+	.ascii	"0\t\366N\2340R\244X\312V\2342F\217\300\211/6>E\2171\2110K\233"
+	.ascii	"\253\323m+\016Z\357\020P\034\365\025\307\324j\303z\202t\362\304"
+	.ascii	"\037\034\262C\201|\377\023\213\371R6T\201\367\177\310\256\355"
+	.ascii	"\020\236\332\377[5\034\2070\325\316/\324\204\322e\306\365\264"
+	.ascii	"\303(v7\220>j\276**\351\017Tri\373KK\333\347\245\033\334\335"
+	.ascii	"L\344\366\311\033\333g\362F\360N\f\327\335\001\234\203=5\253"
+	.ascii	"fI5Ui]\214\343\367i\332\351n\245;pJ\351\201\314\007\007\362H"
+	.ascii	"\222<y&k\314Ctq\350rp\327\027\233\\\357\3655\307"
+	.string	"\220\302\351\036\376^\276\334r\247\371\245\273S\324m\263\313\373\352\230\304>mY3\336\303\372\366\312\244\363\323`\003\31439Y\260\0048\017K\310|)\363}y\315\311\2518\220\242\377*\352\016\315\020\262\003H\006\235 @\\/\376\307\237t7\322\247\232\241\346\226\356\366\375\006z#\336\356\311\377on\327\033q-\333\267?\242<\207\253\b\225\017\234X\t\"?l\346\353\257\177\256\277\266\301~\234\030\"Z\262\273\006\013:bk\bz\033\223\215\032\327\035\036m\032X\320\021[z\226\354\356\032\314\007P\242+4\3308f\0220b\220\370\275\322\246\215\203\276V&\036C\364\303\037\340k\355Z\373\306\234\273S\\\343\325\332\257d3\325S\262\354\346\265\r\346\3022\354}%\231$\231,\267\313r\273\254\301`0\270]n\271d\367\271r\327\230hj\352\364\331\327\332\375\352\304\211\226\220\321\022\343\265\273\373\314\304\033\345"
+	.string	"\276\t\363[\004\210V\220,\336\305\342\335\251e\252^\027\343Y\231-\327\305x\026\006\315\314\026\227\314\031\231U2\223\246n\233\324\032\240x\313\255L\235\237R\017' \035\017\256\363g\313\b\371%\214\226\\"
+	.ascii	"\337QD\352](\211'\b%]\007\\\232\037=*\036\265B\342w\3112Xn\227"
+	.ascii	"\301\227A&Nc\006\213\022\277\227\334/\231f\353\211\022\004=\367"
+	.ascii	"\235f\024+\3052\244>2\207\206\r\017<\373\343\356\355\367\343"
+	.ascii	"\316\376\240<\230k\214\235\227\307\035*\312\350O\024\313\374"
+	.ascii	"\301\215j\274\177S\214\377\275\354\330!\"\243\001\377\333\203"
+	.ascii	"\365\2109R\344jo*\003\bmM\212\347\240t\334f\026\323\372\270!"
+	.ascii	"`\346\311\262\246M\317\270,k\336\2243\220\2143j`%a\320\306\276"
+	.ascii	"v\246\"+\373\233>#|\247\337$\243\345\251\371\376M2"
+	.string	"\222b-o\366HYz}\024\027\223@\201\202\311\370\357`\267B\203\264\034\270\300k\274\240\307|B\213\037;\177;\216\256\271\247?\220'\354\272\260\253\211\345\276\230\201-_1S\026\247\"\354\252m\256:\315\276j\033T\364\353\340\260+BYX\360\376\313"
+	.string	"\033e0\335\030\256*1J\033\027\022\247\013*tj\200F\377\005\362~\177\252\247w\342&;\324\004\345BvI\250\031\201\371\273c\022q\273\342\346pN\303\205D\372e\021VO\277H\275\256\003\351\352\277H\275\377G\354\230\320)\341\\\231mQ\037\376PqR\007"
+	.string	"\375\037cl\2141y\314\256%\340\366\274\r\306\fC,hj\334\352\026\262C\203\002\270\fKg\306\323/Y\264\002\315\370/Y\3644\363l\325\321\002\276\336i\336\335\335\005\242y\356\002\277\220\350[6\211\016\321\311)\372\256\361\356\231xl\r\356\n\317\306\224\203\246K\333Z\261\215\311\332(\350\362Y\037L\345\300\037/|\0221\223\272j\274%\366\204\361\202\300\016\226\3332\247\312"
+	.ascii	"\3375\2759\357\332\177\301\224\274iS\001\233U\021\2054\370\252"
+	.ascii	"\371\026\020gU\212\226P\003D\024\026i\316p}!\360Ms!q\233\021"
+	.ascii	"\275\251%\002N!c\225F\351\233\346\306&\307\245\367E\363*r]\276"
+	.ascii	"\352\367\314\017\305^o\350t\351}\321\326\314\277G\352E\361\226"
+	.ascii	"\032!\270%\2361!\006\2105\262[\234j\226\244Ik2'\346\026\301\267"
+	.ascii	"\314\317\226\314?Oy\336\335\335\335\361\353\233(\330\234\234"
+	.ascii	"'\313e\371S\212\327p\355\201c\037\276fYVH\334\312\304\r\256C"
+	.ascii	"\"\207\210_\237\203\353\f\271T\341\341\340$m\b]\255\025\226+"
+	.ascii	"A\204h\214> \330*'\243\017\251\351Ud\013\211\317\371b\271\220"
+	.ascii	"\270<\b\013\230\342\322\017x\300\310E\360\r\342\257\343\034\351"
+	.ascii	"\021\335C\362[\266\273|5\345\254M\0214\304\246\034J\373\240\267"
+	.ascii	"d\337+\027\022WH\35499C|#\"\355\016\206\2213\203\342&\370\002"
+	.ascii	"A\277E\270\256\212\240\203A\317\234\036\260\033\372\216\205\255"
+	.ascii	"E\021H\f\007\034\006\346\305\356j\352R\351\251\004\316\327\035"
+	.ascii	"R\030\037\271\272\026\3370\036\032}\177\240c\245D\231\244AH\334"
+	.ascii	"\270\025\360\235\362!\217]\365\001[\242k\302,\215\005\337(z\030"
+	.ascii	"\314\267P\276*9\343\026\b\367\370\317\333\252\256\021\b\327\360"
+	.ascii	"\371}b1ne\352\324\357\223\3752\215\232O\272\233\004\256\023,"
+	.ascii	"8\201\264\254\230\261\3706\271\022]fD\017\330\312\304~8\333w"
+	.ascii	"\311\205\304\3453\375!\033\302\216I\007\367\311\023\005\317\363"
+	.ascii	"\314M\362\025\022_\264\274B\342\356~\217 \361\247\211.\274\305"
+	.ascii	"\214H\021g\330K\006\313\305[\374\217h%\273+\355\332dS\272E\336"
+	.ascii	"\"o\221)3\345\256\301I\212\240\321\262\247e\237\026Az}\205b4"
+	.ascii	":9\304\001^\233&\2329|\260\360\316u\311`\237\311`\237I\033\363"
+	.ascii	"\213M\256\314\276\354\262\267\222`\200A\314\2300ge\316\310\234"
+	.ascii	"%q\246\342\0335\23582'\345i\276HvbM\272%\234\310\"\234lU\334"
+	.ascii	"\334\276\347L\354\221\335\305\232?\003y\273\3345\376:&\".u\276"
+	.ascii	"\330\312\344\303\204\027$\373\204\004\353\303\n\211\373\335]"
+	.ascii	"#\266\205U\361?yp\034\270=Y\273\345\3056]\372\024\243\017R\244"
+	.ascii	"\324i\262K\370\237;\346\034\024V\206v\370b\225[]W\332\221\222"
+	.ascii	"\220\013\211\273\277\271U\200?5\212\265\262\276Xy\361\340\237"
+	.ascii	"8\317\024\260\272\361\364\324\211\351\304\2151A_\376\211\351"
+	.ascii	"\304\215\005\242:X\213X\035\021H\343\265\306 R\023\216!\"u3\036"
+	.ascii	"d\003\205?\250\0238c\026\003\241cL\315\210\310H\222\346s\023"
+	.ascii	"\250\001y0 \227\213\247i\017\023\300\202\210\310A\n9Ks \310\020"
+	.ascii	"2\310\220\021\021\221\021\021\021\2214I:\030\301\257\242\247"
+	.ascii	"\316\301QZ\004WM\023\300\245:-\\\353[\254\254\321\351Zt\261\237"
+	.ascii	"{5\322\366\315%\352!\326\347PQ(\202l\366\324\323t\310\346\340"
+	.ascii	"\213`vyx\3271~+<fN0\304\250\364M\006\177R\302\252\364\005`\367"
+	.ascii	"\345\304/\267\212B\274i\215\200A\006!\375\233m<\357@mM\276>%"
+	.ascii	"PW+\373\227\255\210\324\254\\\336\344F\n\3126b\273\242\366\213"
+	.ascii	"\240:5\b\004l\266\375\007\266\227 \216{\323H\361'\254>\317\n"
+	.ascii	"\276t\007\367\222D\231y\201\2076\256\327d\003<BA\237?\200eS+"
+	.ascii	"9\356\016\362\006\363\030\3058\267\333& \021+\250\002\373sl\016"
+	.ascii	"\033\264_\311~x\266*\305\352\346\242\205:\226\331b_\263dP\226"
+	.ascii	"\001\271\202n\177\235\216\302\317|.\265\346\326w\"y\211HZ\314"
+	.ascii	"\350C\026\341o\330=5\314|v\030\004F\266j]mu\207_\311*\341\002"
+	.ascii	"K\366E\022\305\025\02678\263t\300w\215\327\200V\366\310\344\317"
+	.ascii	"\300\373\n\265{\203\272\310]z\\tRg\374\363\333'\017l\236`\371"
+	.ascii	"\370\352\275\371\334\347\2058y\005\225\220\225>TV\034A\346P\361"
+	.ascii	"\201\362gd7\234\016\250\341\027\374x\337\235\246N\0052\276\213"
+	.ascii	"O_\367\nI-h\301oS\330\253\342\355\274\225x\230\266\240\243\026"
+	.ascii	"\335\353\b\271\007'y\266t\221\313A\261\r9a\353\202h~\255\215"
+	.ascii	"\315\312\354\340\210\350\005\006\353*Q\314\367Q\034\343\005\243"
+	.ascii	"\211\257\266y\260\324\237Y\001'\330QUG\263\357\247\016\261\207"
+	.ascii	">d\212Q2C\305\255\242j\266\231q!=\001\333\325\337\274\364\245"
+	.ascii	" \270\207;X\b\364K\340D\237"
+	.string	"\371\021=\225\323\021\213U\302\027\372Y\003\225Zn\301\226Fd\303N\263\330%\335\3044RU\303\002T\302\335/\354S\031a\270h/_\237nA\031\025\177e/\022\250\326Q\355\356/*\352i\206\326#\373EN\357O\360P\\W\203\030\020\367t\274\347^\226\0207n\212\373\362\212\325K\260\353\332\250\274\3559\361\250@\274\035J\353\035\266\327T\202-xro\256kf8\356\322 \314\243\023\347r\307\265\212B\242\257\276\270lW\\\240fQ\246c\337!+P9\3753\357\201\003\352\031\f#\233|\314K\177\250}\006Y\233,\025\266\36211\216\203V\035r\211\221mQy\323\334@\236\315\nS\035\365\275\352\2532\221\2424\367\030\325S\214ve\343\300S(\231\360\340\036\374K\257\225\216L<H\200f\237\013\246@RAB[\300\370\317\023P\261\261\276M\205\222p\207\256\207\001\300n\213\2072\275\363*"
+	.string	"\nu\303\307\254E\336\202\261\212\267aRR\370\004T\024p"
+	.ascii	"\362\222_W}\017a<=\244\211\034Rx+\021\307kk\264BI\315\002\276"
+	.ascii	"\321v\344C\336\3652b<\304\351\037\013Sr1\363%\001\211TJOS\024"
+	.ascii	"\232\t\313\225=\3521\020\342c'\230\231F\315Q\201\255{8\231\334"
+	.ascii	"\027v2q\360\003*\235\243w>\034\274\365xl\202k\274\233\220\275"
+	.ascii	"\210\206\246\236\n7\333Q\032\343\250<y\177\244Y}`\025\316(\\"
+	.ascii	"\362X\262\345\3430\317\225\251\324\301\376\025S\246\350i\217"
+	.ascii	"d\222\036(\374\r\204\327N!\243\347\016\324\361L>\037\317\301"
+	.ascii	"\016\232_41\265]A'H?\200\fOz,+\325\340\336\370<' \243>\271N\033"
+	.ascii	"\246\3165\231\244\267\303\315]\221\367\236\302f\030z\302\257"
+	.ascii	"*\372\264\b\341\256x\227\377X\243\375 \362\242\347\354w8MN;\b"
+	.ascii	"\375\270"
+	.string	"\027\032@\355h(\325j5\023T\247\223\304\323*j\331\361\234\310\255P \201\337S\\\377Ja\340H\321\242[O\311-0M\333)\212&y\213\251u\234\247\234\317v\016\226\223\322\031\370\216@\210BC\003\200i\346T\013\347"
+	.string	"\314\335.\023\321\306S\302\262\314;\314)\272e3\020\030\232\273\223;\001\344O\023\242\016R\207\be\275\227E\241o\003\312\304\001+\267\352y\034\252t\215\326\377\0025\345k\352vm\316o\375\211\271G\233j\035\244\270I\356\342\206\242F\264n(\\\335\237\354\274\274\205\033T\t\231FH\221\355fTmpE\rN\212\332\2056\313L\"\277\f\274Z\200\330\022\236\325\f\200!Gt\216\232\035\351\362\\\321\b\252\037\304\254\226b?5\370\317\205J\340\3059\201\371\364f\231`[g\274\317\256\374\037\265\261Q\306$\374\247\206\026:\3357/W\314vZ$\240ta\345 n@\\\355\326o6\250M\033\211\002\034\206\311l\240%+\205\270X~N*\240\216\252\004\341\254\341_"
+	.ascii	"Qho]8\276J\2134E\367\307\024\303\312E\346\274\266\020\255\363"
+	.ascii	"\372t\025\246\250\360\313\330z\177\236\352\324pbC\021\275]\370"
+	.ascii	"\352.\267\240\214\335s\203H\025\025\202\344\021\2361\332\345"
+	.ascii	"n\250\020X\002v\004L\367\351\013i-\351\t\320\202az\204|\223S"
+	.ascii	"\262J\343o\231\001\200\236\220\324\234a;\2012+\270k\226\252\253"
+	.ascii	"\227\211\326\227\237\213|\2733:\331\023\303\033\330\306F\316"
+	.ascii	"\344\315>f\304\2617\006\327\257a\273\204\262\374\236\b\226\201"
+	.ascii	".D\213\212\3167\026\001\033!F\302\fE\342\242\177\227\230\320"
+	.ascii	"\202\003\221*\313\273\027\355]\363\215A5\321$w\200q\224P\336"
+	.ascii	"\330c$\026\242c\246=\331Qy\200{\017\270\301\272\013\201j\035"
+	.ascii	"\212pW\177`D\376\231\266\320\241\375\224\033?b\256\346\255\313"
+	.ascii	"\245H\013;tJ\364Qc\234\322BR'4\206\202\372\206\031\237\271\037"
+	.ascii	"\204\356U\013B-]\322\334_\316\272y\322\273\360lI\310$\013\032"
+	.ascii	"\302\331C\311\340\316\336\305Q\022@\205[\255\270\206\275\270"
+	.ascii	"*\234k_\300L\002\367X\035\322\005y\231\374\210}9%\337y<\224\216"
+	.ascii	"\001yi\3039c\342\313l\275\231\200\246Q"
+	.string	"yLPA\262\241\214\340\n\376\234\212\216\327\261\352\354R\376\370m\360\342\311\2561|\335c\206p\275\242\240\024\027\343J(v\031\201nw`\204\354\230\250\346\335\253\366\302\017\306\377\021~\220A\335w\377x\203\006X'`\"\251\177\215\001\2212B\027\025\276\371n\267v\304\371\02704\240\224c\027>\313|^\266\003\251x\300`T\034HP2\f\215\037\306\026\302>\002\372\025\361\367\206\261X\213B\224\232\r\201\353jb_\005&A\263\236\336g,\366\301\371X\201\226\306B\237<Y\310\254\376\204\220\261\001\313\031>\326\254\275\0219\022\322D\220QW\350\006V\243\\\247\356Rs\021\310\3745\321_\346\263|\002\r\244\246\356\006\265\"\302{^\313\215\270G\235s\226\210D\377Z\021\353\230\003l\023Hu+\373E\202\300\314\356cgq\207\266\344\347\3209`\366\232\322\327l\235\250\355p\b\224\256\206\340\357\361\352"
+	.string	"9M\0245\342\225\261\321\336\372\356k+P[\027\374\177\372\t\320\341\261V\b\274\331<\360\200s\021\373\002\216\361\311\231\021\272\264\211\305\213p@&\f,6\035$\200\267\346\270uK"
+	.string	"\377S\305\225\214\245\n>\301\372\004\300Q\006V\006\340j\f<\231R\302n\231`\364\021\2306\2073$7\320R\331\350\3512\202di\352\343\317\222\221QD\373\032E<-\366\275a\347\337[\252\313\255\002'\342]\317\201W\212\330\246\251\315\3079\006\274\332P\316LUB\363\312 \345>\025\370\355I\247\325j\202\264\356\325\230X\t\340kj\321\224\315\236\325\372\\\313\344\332\224\222\236g\345\257Ub\227\304\0359\303\017\327D\247\356\20766\221\311\311k#\364\n\025\214?#*\227\343\277i\310\362K\315;\356V\3001\337p$\324w\341>\245\213\315h\")\350\203\215\020\341\226\020\333\304\353\252}\263\254\034@\r\242\311'\343:aO\347\220\035Bb^\022\034\t\232\237\366\375p+\030"
+	.string	"\250\007u\024\255l4`\223\235\340\226\231\341[\030\006Q\236\f\314\253\025=\346\317lI\262\271L\240\026q\344\021\340\321r\024\247\031\321\216\250C\312Z\330\007\001\001\236W\211\254q\362\277\2545\352\3603\302%-\311ub~\361\236\032\016\327\317\252\251\255\316aM\2079\f\331\343\321\256\356\324\347\312\"\021C\216\244\035=\313\360!3\230\315\027\253=\247\220\224\"'d\246-q\344\313\2237\240\204&\024\307G\321\023Q\376\225\314h\342\364\325\327\243\354\335\265v?\264\025[+kM\341\222\215\315>\210\335\312\216\365C\013Q\022\\\373A\206\362\017\202\212\316\241*\207\363\177\303\3641\250\304\273\225d#\337M\036\031y*\264"
+	.string	"RV\027\030\205\205\005\244]m\025\221\fze\0057\264\222Lr\272C!\321\324z\236].g\257-\233\006.H\241\376N\210\331\331\254g\013[\343DB\323IG\3452$\366\025"
+	.string	"N\344\300A\227\207\233\346\261\361s\334\341\364\360\351\370\371SB\3155_\245\264r\340P\202v<>\030s\226\324k\001QZ8\220@\031\371\324\310T[\262f\031pP\324\350?\263\302\036\344\030\007\325\316\330\213\210%\001A\241\233\260'\364\204\216{\216\221ut\001V\245\321\261\320\363\275\350\004\343\242ES\235\224\303\f*L\273O\344\273X\307E\266 \351\030x\241\314\360% \214\ta\027\001\224\30102\220}\035D\216F\fj!:p\177\227\210?j\275\257\\\364\270\325*gF\027l\264L\247\233^\345K\267\274\263\f\036\301\177s6\357g\273\360\265/D\271s\006D\301(\366,\347\265\024\227\032\354\253\216\2550`30\316v\321\376/5G{v\210=\265\257\027\206\271\243"
+	.ascii	"\"uL\222\332\273\b\270\"\013YY\244\\K\035\226\325&7\321\3234"
+	.ascii	"\323\277\267!K\216\216\260\325^\343\361\004<!\241\330\t\226\""
+	.ascii	"\354d\345a\002\362\2371\237\rvU\371\3242\013\306\207\336!\001"
+	.ascii	"\327\241\212\225\200>\035\302\200v\227\300\031/<Z\232\276V\247"
+	.ascii	"\346\177\310\371v\337\370\020E\322~\020u\236z\205\350\307\250"
+	.ascii	"\341[\231\237\t\347H\273\262e\303\354\343&\340\262\223\032&C"
+	.ascii	"\261j6K\304\317zB%\212\265\355\350\203\232\315k\211p\322\341"
+	.ascii	"$\250M\206\220\3503\344O\223F7\261(\355;j\235\277@\314?^\020"
+	.ascii	"\254\201\30603h\026R`6\234\262}\251\314\002\264\214R\213E=jA"
+	.ascii	"\346n\313m\252k\205\bZ\274\361e\030]$\013\257H\343\267\232]\023"
+	.ascii	"o\352H\317\273\360\375r\217\007\013\\L<\324\363\006\234\250`"
+	.ascii	"\241b\223\265\251AB\246%\177K\227\314\276\350tR\262\371\373x"
+	.ascii	"r8\332\207\274K\214\026w\233\230\200\361\262\210\005\202\031"
+	.ascii	"( &\315\212\001\n\227\350\300\223\325\020\\]\250\303\3639Y\331"
+	.ascii	"\304\250B\013\313\177E2\272.\005e$\032\314\006\026\2517{J"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\317y\035\375"
+	.ascii	"\2729\325@T\020X\251js\274:\243\356\312\221\316(\317\203O\220"
+	.ascii	"\207\216\343\tl?X\351L\313\204\263,\037\024\276\007\n\343y\321"
+	.ascii	"\254"
+	.string	"\275\206\277kK\246\306\366~\375\276\005\254\025u\302\242\307R}\231\244\223\271^'S\227\367\340\361\231&\032\353\366\373\3727\333\026\275SJ)\272\003\032\004\r\004L\035h\346\201YN\274hPf9\001Q=\210\316F\313\250\236#\002\334\r\303\334I\3137\277\335@\320\331\350\030\325{\301\250\316\355\020\252s\f\204\352\334\2364\213\352t\367\274\242:\255\242z\323)N\246&\250NY\207>\233\305\332\214\205\205\026!\202\316F-P\275e,lTo \260\367\0078\215T\023\226#@\300\231i\b\332`T/\242\263\261HQ\275o\264{c{2\023\325\355vc\226\031TG\241\232\005\005\325{Y\222\250\336\373\006G\t\202\236M\034%\b\332|\"\215\240\263q\267\243\356\245<\260\221\033\3738\242\263qi\324\323GO9\271\"\354\364\271CY\n\260\007$\230\2220b1\230\262\221\266\025\351\263H\237K(\245"
+	.ascii	"3g\305\f\252\031\206>a\350\363\213\022\004e\004\230\315\254\203"
+	.ascii	"\022\235\215\223\202H\237DzYJs9P:\001\366\216cA\225\302\034\022"
+	.ascii	"\035\252\371\354\363l\300\356\331\224k&:\033\267\201\3521\250"
+	.ascii	">W}\256\234\337`@\022\264\271)Q\232`R\301\312\340\336\3148p\034"
+	.ascii	"\215\002\257\237\\P\315:}\352, \311\t\334\004\355\245$\232\r"
+	.ascii	"\356\356d%kp\323\263\r>\315\310\201j\376\321\347\217\032f\264"
+	.ascii	"w\223Z\006\264\227t\230\\\300\004\203\225\301\231;"
+	.string	"\037>|\344H\021\271\270\260\032,\203\316\346>\2509\224\300\276\274*v\242\2639\024\325Y\207;\205jf\241O\026NC\353'w:\361^\241\024\r^\276\361\023\235\315\211\240A5\343\364\211\303\261\024\314\314\034L\001B\257?q\276\340\346\242\350l.\245z75\361^y@\033\321Nw\337\340\033\372{c'4\334\334L\321\331:\n\325\351\372\315ol\204o|\203\316\326@\250\316`p\323l*\305{\205\366\020N\300\217\003\341\256\242\2635\026\325\251\017\256\322\331\372\211\352n\320v\331\355\024\222\335\263s\320\331\272\211\352\313\252\333\355v\343\316\246O\226\342\323\302\301i\016\325\314:\364\311R\372\f\302\314\336\323\255\203\316\326>\360\260\260`\321\331X\215\352\334\356\021.B\365\336e\355\311'\267'\363\240\263\261\025\325\273'\315O\232S\315-0\263#\200\2350\262=\350l\034\202\003\374\240\263-\251\216\232\301"
+	.string	"\016(\200\222\235[\021+\235\215\206\352\275\313M2\354\262\013\334\033C\020:\233\221\352\315\355\236}r\\t\266\235\352\315<t\303p\245\263\265P\275\367\005/:\233\252z\357\356"
+	.string	"\206\35423}A\273w\205\360\215o(\363\rmF\005\331\335\325\356\t\344\354\223\233U\314\255\263~\273\361\3115w;\263\013\275\334\354\314-,\377h7\226\367\306k\205\236'\252;\325g\013s\347\354\236\251\336e\026"
+	.string	"[\301^\r"
+	.ascii	"~c(\270\331o7\236\351u\346\367\261|\272\335no\360Z\241\265\246"
+	.ascii	"\246\246&>y\251O(+\264\360\024\314T\030\214\316v\252\336\315"
+	.ascii	"|\263|\343\223\231\302\240\314La\320f\2461:\033W\247\\\217\335"
+	.ascii	"\263\271>e\372D\365i\263\313\034\225\177^+\264Q\315\315\314\203"
+	.ascii	"o\274W\350\362^\241\315|\343\246\250>k}\242\232\017\300\314\276"
+	.ascii	"cwfws\354n\314\356\356\313\356\311'w2\023\031\224\231\211\f\332"
+	.ascii	"\274Q.\320\276{v\307"
+	.string	"<4\243\232S\314\355\262|\343~\322\347K\013WC-\337xw\317\346\250,sTxyO\2163\373\204\322\f\303\334]\252\317T\237*\346>\355r)G\365\351\314\315S\372\344)\354}z\237\334k\204\231}\331\266*\036v\233\024\t\\\2733\263\025\224\336\364\340f\212\352}\263D\365\336*\226\212\275\301\356.\333\340\007\332S\310\310\2341|\343\246Tn\210\270\351\301\321\340\356T{\rXG\212(nv\350\341\006\033=\322\350!F\017\"\324\036V\252\367\200\242z\367PA\365f\242\263\365\260Uo\233-\270O$pipB\260\030\325\227m\266(\303\006\213\352Kdt6T\252\267M\013\252\237GP\242z\t\252\217a#Du1l\202XZrb\351\211%0:\233\036\252G)Bg\263C\365(_L\241\372\r\226\252X\031\274\213\366\232\032\036L\250Nk\340<\264\250\336\374\004\237x\234\240z\363"
+	.ascii	"\242z\363\310@\365\346\232\330}\340\034\352lp\263\327\200w\264"
+	.ascii	"Q\375\f\0358\005;\274hb\207\017v`Q\235\333\035T\252\2673\201"
+	.ascii	"\235\r\336\021\203\352\315\345P>\355h\202\t \230\241\340\035"
+	.ascii	"B\354\260U\357\256\343%j\226P\235c)J\270\031\354\302\355\274"
+	.ascii	"\322\316\r\241\375\004L\004\356\032/\252wI\324\370\240:\347a"
+	.ascii	"p\315\016\252\327P\251~\376\300\315Ht\301\315\265\301\034\005"
+	.ascii	"\363\255\227\300\334\021KX,\361\340t:\202Si\241\322\242\2142"
+	.ascii	"x\255\320\032'\252S\225\026\\\351\251\f\256\264YU\303DuZ#\202"
+	.ascii	"\352\334\216\240fJuN\205&\364\240\263\251\220Eu\216u\3503\305"
+	.ascii	"Fp\212\213\330u\025fP\335e\351\007\235M\005\0130\021\247\333"
+	.ascii	"\355&\245\n\256555M\200\206\215\352\335Eu\356\244\261\242\205"
+	.ascii	"\020A\327\321\365\020\320\320\240:\327|C\235\006\334\354 \340"
+	.ascii	"\017\370\004\270\351\236\270\306A\320,Q\235c\341\033\272'\017"
+	.ascii	",\315\017\325\233\346\002\325{u(\241z\353\020\243z\357\351\246"
+	.ascii	"\343Ju\252\203\n\035&\250\316\351 \242z[\351l:\200\250>\363\004"
+	.ascii	"\236\331\242:\227E\365\236\251R\275g\244\250\3363*\250\336@\244"
+	.ascii	"R\236\0043\016\230\253p\363\311\347\026\355\234\221[\267'S\034"
+	.ascii	"8x\255P\037f\216\250\276\\\327\32455\347\200g\206\2503;T\347"
+	.ascii	"Z&\t\325[&\b2WpA;\b\263\027\264\367\204\221i\242:'c\201\3524"
+	.ascii	"\207\031\325\351\027\235-G\024\325i\216 \252S0:\033\2165\252"
+	.ascii	"wKat6\034U\2527\0268\216x\202\231\006Qv\320KH\240\335\253\003"
+	.ascii	"\346+\270\227\314\240\275I\236\001n4hs\006p`\240:\247\204\316"
+	.ascii	"\026\303\204\352\324\b\325\233o1ZT\347bdP\275\271\007*TN\216"
+	.ascii	"\001\242:\035\202\306\304\360Z\241\275\003s\f\335S\325\306\377"
+	.ascii	"\3223\252\253\246\250NU,\250\336GT\3470\340\304\271\304\306\322"
+	.ascii	"\032]\004\267\032jX\321N9N5\204J\003\325\333\311\355\3265559"
+	.ascii	"\363\340\265B]\340f\037\252\035\252s\247\323\262\024\334\273"
+	.ascii	"\247J\n\303HA\005\303\204\352\334&\365\030\334t\027\306\214\352"
+	.ascii	"0eT_j\002m\332Fg\2039\002OY#7\206\271R\035\246Ju\2720$\250N\241"
+	.ascii	"\320\331^\332\250N\245\320\331^Pp\272\321\331\\\226P\235sI\303"
+	.ascii	"\205\214\352tOv1Bu\356\306.U\252sQ\\\\P\235[!p\367n\367\215\227"
+	.ascii	"n\235\255\345\214\352.\333BE\365\256\345\005IMhw\313\020\325"
+	.ascii	"\273\345\003\334$\245\263\245xP\275STTo\034pW\341f\037\234\005"
+	.ascii	"7\223\016\264)\320\331R+\250\2362Bu\253@gCI\241z\016\224\023"
+	.ascii	"PcT\2472\234C\227sh\263\017^r\024\025"
+	.ascii	"\325;Fu\240z*\n\223\217\233\217\033\237K}.1EMy\243\272\224>\271"
+	.ascii	"9\tl\033\325\271U\243"
+	.string	":\007eJg\353\306\250\336\235\225\352}\201\316\326YQ\353\241\263u.\250\336\035\b\252\367v\034\250\336\335\016\325\333\215\352}:\203\245\013n\326@g;EQ\035fOM\254\223S\022\325OFTgA\267\200\311\207e\024,\323\017\001\345'\025\361\330\222\350M1$I\032\317\353\310\354\220\022\330\013v\003\222\327\001c\346\2072\243'F\257\343y\240\267S$\304\343\263?\236\220\241i~K~\b\364r\276\206!BVB\276\205\007\275\337\t\221>S6\326\260S\222#I\266\236\207\310\217jwJ\244Ov\364\241l\311W\306\300G\022c3\222E\263\245\367\334\226\263 \262\317\034\315GR\372\036\374FY\355\233}I\013\202\244\364\375\227\264 \265o\366\017\205I\220\320\374\310O\262f\031\223}\223\362#J\355\377(\007\340\005)\207\310,HD\210\247Z\260\b\030\003\f\036\013\013\302\340q\013\302\340\375\217\222"
+	.ascii	"C\274\234\007\362\3771\013\306\340=Xd\210\367\342\0303\215D\232"
+	.ascii	"\31771\n\231\360\274\022\330\357\013\336{\0368\304[\201\004 "
+	.ascii	"\342\375\017 \326\017\254E\223\031\325\302\234\227}\346H\264"
+	.ascii	"\302iY3,S[z\017\344\351\226\036*\365B\367w@\3623\372\236\241"
+	.ascii	"\324\202!IC\212\035\211\243\021\030\232dX\212\261\017\305\321"
+	.ascii	"\005\263d\b~!\023\360[\362@>\307\226\342\0303c&\371%=\354H\320"
+	.ascii	"\023\261|~\024\037\310\357X\331g~>t\221\304\030\224\230\354\213"
+	.ascii	"\2311\361\347e\237\200_\b\243\373;\263\320,\237\224\241,\346"
+	.ascii	"\223z\2511[_\007\364V\240\247\364:\340\013B\274  \021!\336\353"
+	.ascii	"\034iB\363^\247\346\325\204<\031\2224\323\350;\242\211_\320j"
+	.ascii	"\301P\026\373\216>\211f\222\2379\244\332\001\274\260\032\302"
+	.ascii	"\262BVDV/\3205\231 \305dG\237\031\036i\371\021b\275\320P\320"
+	.ascii	"\217\322\313\371\322\373 _z\217\343\302\352\364\322<_\272\240"
+	.ascii	"\347{Z\327\313\327\307\347\305m\351\371\202\336\317\360\245\367"
+	.ascii	";H~|\\/\236"
+	.string	"\357i\021\t\025\301`/\036\036K\027\fi\026\fA1|&F\346\267\344A\361\233\315F\236\231\005\305\220\333\362\264\263\221\344\226\f\301o\224\231\343\270\344\203^\260\027c\217$\306L\3623\313\220\f\300\322\200\203\315\013\313&\031R\200!8\330$\200\b\0166-\333}\307\255Y\216\262/C$\361cb\364`\250\364\225\"\355uBp\234\375\017\020\317#\2111\245/\224\325\005\275\217Y#Y\354;\252\221/[\243};\266\364>\351\233\235\266\364\200\270l\351}H\322\314/<j\331r6\263fX\206$]\231\354\213\221ay\263\243\022\031\2265K\206%\031*\205\244\216\005\275\257\305f\345\315V!\240V\222\3727\300\210^\247\307\305\n\nz\361\274\313\206\227\213\006WQ\217U\322\352q\375\320\025\002\001\360\303Y\240\226\313\305J\302\323-\315\373\020I\374\310\032\211cK\357w\302\331'>N\352\345\305f\033"
+	.ascii	"z\253\225\020\034\336\347\365\255\236\237!\242\242\327\267\200"
+	.ascii	"~|^0\241o\021\261`\277\342\0303\223\306\007c\262OI\374Q-\350"
+	.ascii	"}\217\213\365\240\367\256V\313\006\242\326\221'z\271\276\364"
+	.ascii	"vlk\b\306\022r\331\332\252\2015T\337\325JB\364J~|VX$\256\237"
+	.ascii	"\"\327\017\221\353\305\363-\330\313\247u\344mh\375\324\320\202"
+	.ascii	"}k\210\325\002\022z \337\323\"\342i\021\265z\276\005k\331\360"
+	.ascii	"C1l\352\305\367qR/,\213$\306\314q\\\022\302R/.\373;\260\027\f"
+	.ascii	"\326\302\301\301iY\034\034\034nW`h\222cR\022\255|st\251v\265"
+	.ascii	"Z\221\241R,4\n\311'\002\244\0046\364Hb\f\024cGxl\215\364\255"
+	.ascii	"\231\2765\"B<\226\215\322.\004!\360Z\241i\264w\313\214Dg[a\213"
+	.ascii	"\352MM\274\224\304\002t\260\273|\305\nT\2527\3170\003\333\200"
+	.ascii	"{\227\336\340\034\332U\270N\371\022Q\270\240\255C\243\340\376"
+	.ascii	"\201\256\020E\365\245Jt\266\0250P\235[\241\351f\215\352,\316"
+	.ascii	"\3149\250\341`wwo\222P\205\213\352\001[\223d!\223\372\344\370"
+	.ascii	":\"I3C\362G\363\253\031\253\205\365\303\244'f\020\031\232b+\365"
+	.ascii	"\002\303\376\216\314\002\351\275\201H(\250\365\260\227\317W "
+	.ascii	"\365a\257\037\002= C\206\212\202\036\211\353\007F4$d\1774\337"
+	.ascii	"\f\313/=\230\245\373;=1'!\325\22649\364\300X\257#-\273z3\034"
+	.ascii	"\212\331n\313\320\374H\272!\3719\001\311\217\tje\262\217[\324"
+	.ascii	"\206\344\267\204e\3051V\222\241RW\263.[\216\346\347\214\342\227"
+	.ascii	"1K\267\364\0365K\275\250\226.\031\326b3\227M\275\230a\371\262"
+	.ascii	"\335&}3nO[\243}\334\242\266\333\323\222\241Y~\263\023\316\206"
+	.ascii	"\262\260|\331'\306\220b\344\370!9\232eH\326\217\244)}\245\314"
+	.ascii	"\206J_\311\262\240\030\322lj\366\2119\200\3447.\201\331\337I"
+	.ascii	"\355\227\036\267\"\315e\301\036\324\266\272\355\371\311\001\326"
+	.ascii	"\202\025\021\361\260|\212\\\254\240\230]\275\031\016\351\330"
+	.ascii	"r&\2635\031\204x\017\306r\240\031\315f\310\260\026\013J\261\354"
+	.ascii	"\016\253e\351\202/\3468{\231\354S\355\n\364\036\307\256J\223"
+	.ascii	"\226d\322\306\227\311\276G\022ce\221\314\256\300\026\022\027"
+	.ascii	"\013\366+X\353HP\221\353\211\212\204\210\212^\002X\260\210\f"
+	.ascii	"\336\203C\206x:L\2216\032\375\277\321\013\r\005\005\331\036W"
+	.ascii	"\321k\350\221\270~n`\001\t\375\314\202\0369\036\215.\032\320"
+	.ascii	"{P\244\215\345#\211\261'\237LHG\313\202\336\207\262\330\321H"
+	.ascii	"&\205\346G\252\210\036I\21411\307q6\364<\260\307\241YX\213\b"
+	.ascii	"\350\307\347\264\277\023\316>\362\350\225\300\036\fM\243\320"
+	.ascii	"\004\372\227+\265\345\254\373y\034\2325iIb\354&\347\224\203\332"
+	.ascii	"\337\t\223\236\230O\206\246,v\324\36386\233\363P\230\200\336"
+	.ascii	"\357\034\035\215&\315\350S\212\221!\370\241R\3144b=\016\316\376"
+	.ascii	"8:\032Y\366\307h\322>\272?d\037M\374f\335\272^?D,\240\227\020"
+	.ascii	"\254E\344\372\201Yr,\305\260\314\301\250\f[6\024G\221eA\357\311"
+	.ascii	"p\311\214&\376\353G\214\t\325l8\373\312\017\311\357\211\210\337"
+	.ascii	"\216\005\275\244\034\353\262\253p\311\233\243\370\240\2146\032"
+	.ascii	"\3650e\264\357(\004Y\330\324\013\030\212a\322\330\303\fK \373"
+	.ascii	"\222Z\201\336\317\240#\206I\343?\001\277\220\224}_\306R/+\320"
+	.ascii	"\373\321|\320\373\331H\036=\bz&9\ny\273\002C\331\222O\f\377\310"
+	.ascii	"P\321\223\241\322\370 \355[\362CLr\024\372\261+3V\013\1774K\217"
+	.ascii	"\f\235\214I\257\203$\306@\362sB\216>8K\363\036\310\013\241Y\320"
+	.ascii	"{ *,\016&&\222\030\312\376\311G\222,\034\353z\275\216\217\317"
+	.ascii	"\353w\312\220&\373\224\036\f\235\2142\031\253f\177\200\336\357"
+	.ascii	"\b)i\345$!B\342j\001\005`\215\274\337\351q\025\275|\036\326\""
+	.ascii	"\342a\301XIxzl\013VD\304r!\371\031Jm-\275\372;\255\" V\rO\344"
+	.ascii	"j\301`E<\277\352i!q\261\222\360\274\213\305\363\245\327\302\256"
+	.ascii	"\336\f\207T\"R\254|Y\360\033e,\333\nb\271\276\347\007\210U\203"
+	.ascii	"\353\347eK\357\301\020\374F\240\324\226\275\240\027C"
+	.ascii	"\261\354\177\351\241\350v\373\275\274\260\027\021\013\250(\350"
+	.ascii	"g(\265P\222\004\201\336\fM\214F\031\317\227\336\027\361\004"
+	.string	"\311\354NY\206$\b~M\214>s\210\005Y\354S\372\276\366\005A\211\265\260\265o\366:%\r\364~\307,?\331\353\224a\371\221\241\030\232f\214t\022\222:`\b\212aR\322\367\241\322W>O\002\366\ti\2261\244\220\374\220\211\371\342gT~\231Dk2\216\262\327)\221\b=\350=9\036\275L\366\315\312\037G\363k!(\306\036\211P\221}\035\337\322\233\241\364\350\032y+nKP\034\215\302\206\216\2503\027\233\030\005:\346\320\214\210\310h\222$\035\243\022@@\210P.\027K\206\313l\037\023\300@\013$\261\220H\030\f\007c \ba$\204\210\316\020D\2101CB$\232\244\351\210\3056_1)\331\355\0208\"\231\252\0055.\303x`\332P\273\177\251\233\365\0073\253\210%\261a/KG\327\352\365$x!\016\355\333k\316\230dZ\220AVB\030d\263\"\213\247\225I\323\274g\"\213\354R"
+	.string	"Db=\316\302\270du\bd\351q&\020\357\370\035\324\374I\237\275ez\332m\006\035\3067\023\335\374\210\005;OT\224\312j\002\037\316kI0\377\016\001\334\006\222\034_\273\325\300$\236>\342\232\257BC\250\206\334\f[\305S\327\311\215\027;\031|\003\027o<\342\255\021"
+	.string	"\310`X\274\t\322.\352\203\303\364h\267\232\035L4\001.\312\002\325\233\350=e\024;yD"
+	.string	"9#Z\"'l\"Z\013\346\2366H\222v\371\216\315=7\227\214q\241\201\257\356\374\376\300\371\205\253p\252W8d\276\022\333\315\312G\323s\005\373\376/{\322\205t\215\302o\322a\005\245\372\310\244\310"
+	.ascii	"\202p\271\252\333q!r@\3057\001g\355jq\372KU\230\364dO\032\247"
+	.ascii	"\354\344\222=]\032\202\3707\310k\027\253$\350\tc\263,C\224\231"
+	.ascii	"\034\323\213[w\033\344\220\246\275\217\201\026\2473\300 \252"
+	.ascii	"\365K\007l\340\013=Q\203I\271pkX\2447\303\004\257V\033V\032\030"
+	.ascii	"\275\265q\243\375\0239\tYu\004\035\"l\007\365\335\254\312\n\216"
+	.ascii	"^\246\br\242\020\364PP\031\257\004e\245@Rf\330\031]\021\340b"
+	.ascii	"\264 \265\357b#\220\260\331\256ck\304\r\200\300\006u\004\322"
+	.ascii	"\346\001,Bu\343R\347\"I\240\205\217\270BS\211\336\205\267\310"
+	.ascii	"\344d\307E\361D\030\373\245P~\377\025\201\251\241te\347\304@"
+	.ascii	"\346Ri\"8\371\353\320\177\022\204\265\200}\223{\337\335\025z"
+	.ascii	"M\351y\2258z|j\335\027\325\334\013\2526a\335\030"
+	.string	"\206\214x\213<\307\315\345*\213\315s\327\325,\337 S;\244\275\030\307-\006\304\254\271\214P\214\341\005\b\230\255\337O\027p\345\b}\351i\346u`\204\2535\224\013,\271\025\204\222\263\340 \331\266\214\215+U\261#\234\225\033\250\372+\207\3202x \373\314NR\367X\252\247:\265\230\017\021\2402\005\240\013p\272\016?\231z\316~\326\231\365\266\32376\273^]\033\007t\206\332Z\333\376E\262{$K\305\251\003Md!\024c;2\252\325\201\246\351\245\222\251H%\313K\n\t\2326\214\277\0348\032\243\237\354\353\241Z*\230\034}k\031\311\350\036v\367a\310\031\275\251A\263\030*\374\311\350\300\374\036B\331z1\301\223{\321\216\351\375!)D\343M\331<\361\277\210Q\333,\023\350\312\304\001B\367\243\023\235\264\366\374\020\207;v\215\214\215.p\034\313\013vSP\327\314b\332\324\025\342\372V}\021\212"
+	.string	"\213\356\031\365w\2637\244\364\344\243n#K\005\302\263\364+\\\337\342W\223\224\207\224\1779\342\312\216\234\034\271\341\247\332\237{\257\315z@\034X\200\244\366\322\206\276\334\207A\327\350m7\034D\t3\264B2~Pa\212X\266+Gr\350ID|\177\245\030\031\372\367"
+	.string	"\302,\241\371$Z\017\204\232\2221;\277\343\274)x\213\\\207 \354'\344sCG\300\330I\024\347\211S\202\213\307~D\250I\300>R@\266V\270;H\274\373\r\342[\205\301\f\321"
+	.ascii	" \235\247k\353\025ack7;\370C\307.\234ZYs\357\267k\250\001\301"
+	.ascii	"\260\341\241x\351\200\246\266\300/'l ~\371(B\003 \243(\006\254"
+	.ascii	"0(\271y\244|r\265\372\246\251K\330KR\\W\371:\231\177\022\022"
+	.ascii	"\232\230\304\315\001!4\276\033v--9\316\024\323\177M\316\rJ\360"
+	.ascii	"\004k9\315s5i\035\177\206\033\202k\330\204Z\225\253\337\274Y"
+	.ascii	"\350"
+	.string	"f\2620\037\001Hm\350\277%\317\017\205H\037\311\264\251>\366\306\321pj/\314\347\217h\230\036\215\314V\211\021\327,\206]L\314E\204s|\004\373\227\300\223\"\273\350\323\216'\340\236\355\017E\"\241\257\306DC\216\242d\207\276\312\265\313D\232\034:\250u\303h\276:\262\210\036,^\307u\241i\252\034\372:au\0270`5\0034\325H\005r\377\234\313\371\007x_6\247\322\n\"\370\017\346\323\257\261\341\310F\202\215\271\246\245\216\214\251\367\214h:\274>\311\214\006\364\345\220\2334\rs\233\374B\204\311\005\2030\372\340k\277\035\237Di\324\355\\ag\324EP\315\001Tm\362\274\026O\3412Tm\201|\001\f\302B\235\317k\302\213\265}*\305Qu7\2064\177X\305\2730\007C*\264\326\270\361F\201\347\247\230i\364\303\275\301o\2106\3223\177\270\022\276\261\227\217\372\344\224\374SaD7W\261"
+	.string	"\303f\323\305\003\233-\363\005\255\300N\fl\205\302\304\266\023w\361\017\272\275+\016\320c\350\265-\352\344\f0\016\367\004"
+	.string	"\234\002\3767-\350v;3\356\264\n\301\330\265>\351\360@\020\316\225q\313\237'\217iL\351\033\360%="
+	.string	"\004:\203\366\023\306\302\203\246\236g\243\256\202xE\035\377P\016qj3\037?\305Yl`\364\022K&\n\203$\225\264\313Z:\2451\034\035O\254\257$s\276E\001\321\321\340\302\013\216\344\251\fR.\341\024\350\354\311z\004\032\b\n\232\305z\206\004fe\331\302\372\034\376\376\237\031\274 A\233p\357B\212\212\347\235Z\277l\006\357\312\364\377\021\323|\313\331n\026I\252\353\020\262\220\237}&\323w\320\222B\237<O\326;|\247\272\031\033\313\025\3328\263#\343\254\243L,!\007bW0J\027\254h\344\220\212\254\267-{\272\347\3278|\b\204\355\215\376\370\325G]#\031\376\327\375;\374\n\232\263\305=\322\254\305xl\215\217\036\234]3\242{\227\266\333X\312\023\272e\311\bj\202\273\002\302\350+["
+	.string	"\323\034\302\224\240\253ma,\307S\020\367\300\322AJ\372\242\031\224\307\225\247\377\266\235\217G/\315\236i\372\266\260\213\033\312S?\004|\303\315\264F\"SI o?\261\315\007\310\312\251h\357\214!\301\222\024\225\022l\036Wd\212H\002Z\206\206\240D\"\366\004\211\t7\016K.\334D\213\222?K\246y\333\301\235\021`T\313\375\372#\232\356BO9\214\367"
+	.ascii	"\345\370<|\007mI\031\304\315\304\275\251n\204X\343\375\317.?"
+	.ascii	"\036\240\243\272\225}7v\327\220x<v\252|\261\341@\336\325\016"
+	.ascii	"6i\005\362\273\247\242\024\372\002p\b|\234\240\234\255cVBj\320"
+	.ascii	"IH\252V\006z\355\213\322\243\341\261&>\251\336\336qzI\006'\242"
+	.ascii	"\030\013\237J\033\246\276b\f\2460\314\005\017"
+	.ascii	"\230\033\342/w\340\022\007\360\005\257\305P\373'\372E\370\201"
+	.ascii	"\022\234>\r3\300\236\261\250\032d\320&\363Mg\210c6\177|\013!"
+	.ascii	"jrw<Kg\020\231x1\231`N\223\277\210 ~\304\237[\215\025\313\363"
+	.ascii	"\026\1770\352P\331V\261\353*\302\006s\331\365\261\2605\002\236"
+	.ascii	"U\241\246\212v\377\200/\323\263\005A\232\020\346\036\031\342"
+	.ascii	"\221\177\234\301\177\243mQ\354GU/\3116\265\023YH)/\370fR\264"
+	.ascii	"k\205\264\330/\013K\201\231\177N\350C\364\034X\274@\207\273\n"
+	.ascii	"\\\237\325\3235\316nL\210\202\004\210M\261Mza+@U<7\320\201\220"
+	.ascii	"\351,\016@*o\377\242Oq\257'n\252\\\216\031\035\372\240\260\213"
+	.ascii	"\243hh\273\221\265u,\271\257\305td\227\022\2324\036\003\270\312"
+	.ascii	"\350\264\"t\314\320o\240\326\333\214\001F\206\372:}\225\033-"
+	.ascii	"\267\347\357\004/\222\224\031!\006\272\311,\005E\236]\212\360"
+	.ascii	"Ne\004Ol\021J`Z\326\346\"'DP\3327 \263\031OTa\325\242+G+\325"
+	.ascii	"+\255\030\217\022{\027t\177\n\313QOj"
+	.string	"\021\207\227\266Z\327\221?\002\277\326\203h\031\254;\300bD\353\245k\365\335xm\221\f\326O\277\375\366\333\304\023e\315 ]9Ls<\340\300B\244\261tr\333\212\220\"\252\330\242\332\202\373\264\267\0055K@\364\256*]\241\320\211\2435]\253\201\335B\340B\f\242#\200\3566\323^\207F0\007\233!=\346\032`\224\331E\303czd\207\237mg\f\262\321F\263;\231C\253\215\004\245%\022\377\002\220\237g\033l\370\177\223\233\033\224\326c\205N\017\007\215[N\304\316\204|\216\321\016x\210\3117\221\277\004~\256\313!\234\357\223\324V\305\261\330\020~s\367\247@\206A\301\263F\261^t\277R\334\242L23\315R\363\205\212(\235\225;\007H\2611\276_p\002t\254\340dK\037\350\2230n\341\2745\245\031xT\316-\200\3772a>\021\b\20688(\216\263\304\310Z\275\036~Kn\020\334\305\232"
+	.string	"\265\274"
+	.ascii	"\023\247\226T\024L\362\230Og\203K\202\260G\266\352$\276\310\210"
+	.ascii	"l[\331N\333:\311JE\242\244\2705\013\311\023\316\007a\024\361"
+	.ascii	"\005\336\372\310\246\t\245\260T\302\350\256S\364\307F\"\"S&y"
+	.ascii	"\271\"s\353w\003t\355GE\356[f(\221\256\b\033\036D\204\250\004"
+	.ascii	"\357\247P\261\003\220\346\277g\334J\251R\027:\365\022\030\003"
+	.ascii	"P\317#\257\220\252AH\264\303ij=$\212\320\326\371\375\333\231"
+	.ascii	"\026\006J\256\2562A\364\331,\373\261\375h?\227,\034\373\225?"
+	.ascii	"\356\034*\020\235\t\357_\334<`\214\313!\220\357\0328Q\312\021"
+	.ascii	"\001VB\013\277&\317\260\032\245\324"
+	.string	"N\230\344\020\315\250\214\f\211p@Gu\3140\336\220\204d\264\330CT\f\030)\243!\005\240\362\306g\326\216\321\272E\326'=r\245|p\"\204\363+\363\216\333r\320\371\220b2\224pB\350\310\304r\336\263\020>Q\3006/o\324^O\201\326\362;o\"\034\301l\314j\334\321/\2344v\205\204\235#\2356\317=;\tm\305\352[\360N\315\006\202\242Q%\200\262\223%\372\365\242n8\312S\247\326~qex\217\305\310\177`0\016&\326,\355\357&\264\260\270\226\337\206\272'7\035'\363\2131\216y\257\312Qi\214\"\212\\\302\252\376\257\264\220`\334-S\3521\\\360\241\256\220\234\304\243&\301\355\273\022d\202\323\2211R\366\235\303\345\255\036<\340\005?\024qS2\026\325\371 \032\301E G\212\270vN!U\301\026\346\207\345X]\306>\254\251(l\320\311\277P\255/Q\020\022\224\246\003\361"
+	.string	"\3000\307\250\241I\242\311\001\373\240\315:\3563\301\252.\246\3331\002\177;ZQ\363O\342\350\307*I\2175\333\275\005"
+	.string	"\214K\253\\\235\245?\264M\232\304\325\263\310\343\371ssK\373.z\307\033bl\035\251\312\n\013x\t\302X\342\026b^{\341\261u\322\212\311\270\260"
+	.string	"AR\035\034b\356-\212Z\374\020*~\275\362\017%5|L\377\305\227\251\344@^%s\3743\017\266j\305\357\336&#Q\035}\222)Y\247\3705\355\034\013\246\363L\264s\"V\245[m\n|D\022y\206\250 3\255\242"
+	.string	"\211H\005t7\255N\036\333\301\252b\17764t\220\0317\207A\366kj+\363\354\201Ci\244*\252\034\340-\302\021\316e\321\200\306\031\025\332\315\310-X\b\211\207\027\213\276\202\231\303X(R\364O|\2713\027]i4\211\275\220\273@\246\250B&_\305\303M\bZ\013\200\203^\243\205)\353c4\337 \367\020\277;\321\021\337\243c\210\302\035s\227\354\340\202x\267\244\321R\370s\217\320R\035&\367\003\177S\362\316\001\224J\346\030\013\255T\">\304l\240$\357W\360\260\203v\036Q_I7Qu?JE\206\227]\206\326\352 \240\330v\336\344"
+	.ascii	":\036\331\251\362\362\307JZ\002\355\340h\034 S\b}\320\270r0\266"
+	.ascii	"~\001\301\020t\335\323\024\252\317\3055\372\3535\360\001\230"
+	.ascii	"9\\\256\021'\2473\013\313k\007\220J\377\351\f\225\"3+\302\205"
+	.ascii	"\362<\021\307\034a\033\277\202(Z\243p\326m\236\264W\231\030k"
+	.ascii	"\r\214u1\271y\332\333\3106\245C\251\021}jt@6\033\253\342&<\\"
+	.ascii	"=\003l#\315\257\241c\242\266\032^\224\326\001bZ\241;\025JG\307"
+	.ascii	"qf\371W\370\320\324-\\[[f\245\216\353S4I;/Z\234\370\017U\021"
+	.ascii	"\224\320e\221\277\312\302H\310q[%h\367fOcy\026@!\326\274\273"
+	.ascii	"\221Q\352V\253\241\2445\327tO5\345\016\215\223,\235\034hH\222"
+	.ascii	"\226:\212\025A\323\016\247\024\270\352\210\343\030\230\334\235"
+	.ascii	"}\022'\0360\245\246\374\355\360G\005|\317\234\353t\222\3763D"
+	.ascii	"\304w&:$\235\377\n\227\225r\355\377\250\2637\300/f\027\247\306"
+	.ascii	"\316\304\031\341\204GX\006\372\305\347\327\201\353\200]\226C"
+	.ascii	"\253\037\bL\031\307G\306\351S\005\r\220\273\357s*\236\207\316"
+	.ascii	"\341\314\276\224\316\250\007\221\022<4\213\231,\263\004\013\341"
+	.ascii	"\367\352k\b$\376\341\224L8{\022HP\b\246m\211\232\262\353f\362"
+	.ascii	"\333x\313\3613\346\307:_\322K\332&\r\345MT^\333\035B=\326\270"
+	.ascii	"\270\354\370\343r\375\240\274v\233[\020"
+	.string	"\033@Q\262/`\327\246w3\212\227.\216\311\357 phA\332S\016\224@_O\215\201\302P`\233\016v/aR\324~\235Q\250\335\214\007\"\2641*\342\330\220\313\026\3503O\236\03291\254@\273\345\333\270\247\n\021\312\314\316\313\272\264\326\002\\0\177LS7\b\t\367\254\311\240\210\203\214\nPMd\022\357\211\204\366\250l\245{\007{\202;B.\317\002\304\274\b\253+v\032\311\360F\351c\242\367\004\346|b\251\036\253\030\030\316\301p\246C\217\236\022\350\250\354\341\313t\016U;\214V\003\340h*jS\347\207\026\335\214]$\252\223(\270+\334v%|Hv \"\216s\324\212\275,\203BAC\374+\354\333J\213\205\362\337A(g\006\350\016\005\223\343\220V\252\036a\377\241\250\277\023\302\017P9\304\233\205@\374\225\n\273\230$>\242\343\004\301\034\245U\226\261\312F\261\301&0\006\0206\262\""
+	.ascii	"^y\323f\270\246\tu)l\006\321\n\233)\304\202\027\243o;\332\250"
+	.ascii	"\213-\005\336\262rPi"
+	.ascii	"\365o\206\207\334\231o\370\274\242\200\225\205\362\231\236\230"
+	.ascii	"\266\207I!\036\237\226\233v\273\270\030f^$\3200GRc\314u\204\324"
+	.ascii	"@\034o\376\375]Y3*\315\244<\366\3530\225$\364\270a\323FW\347"
+	.ascii	",\033\232\021\267\247y\261*\350\313\231|\007\311\r\002\237k\200"
+	.ascii	"\341\366\347$H\006N\301\003\3329\3707AP\242\223\363\034A\177"
+	.ascii	"\215#\320"
+	.text
+	.section	.gnu.lto_.pureconst.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"e\n"
+	.string	"\006\034R9\240\330I\322\001\300\265\276\302\253$i\002\231<\344\022d7^Y\272d\200y\237\274\311\374\200\235\317\355\342\331\371\304\023\r\2124\374 \231\247H \215\305,\251p\264zCK\033D"
+	.string	"C"
+	.string	"B"
+	.string	"m\272Lw\351L\351&]\244\333\321g\364\025}D8CW\350\013\272@\337\317\365\271=\307\340\371vn:_9_\254\261\233ksk.\315\235\371dn\314\205\271\365r\277\345\362\325\362\305\333\2122V+*\t\227\303\267\341\323\360e\3700|\027\256\205\257\302\245\360M\270I\370\"|\020\356\203\353\34068cp[pS\360%\270\b\356\201k\340\026\270\004\356\200+\340\006\270"
+	.string	"n\325\245\272SW\352F]\250\373t\235\016c\344q\271\343\262]\336e/u\\\346\370\210\343\306\0337\3328c\215\2174n\234qF\030c/\256\213\263\026,\026w\305U\361\245\270(\356\211\317\304-qI\334\021W\304\r1\006\342\354\303\365\360u\b\227Y.\261\334xe\214V\306X\345#\225\313)\227R.\243\\B\271|r\243\223\217M.\231\\.\371\230\344#\222\217G>\032\371X\344#\221\313!\227Bn\fr\t\344\362\307\245\2173\366\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\273\fU0"
+	.string	"\026|\314Ep\250M:!\247\016\245\233\001\300\204\304\311\242\233\355m\364\260\315~G"
+	.string	"$[\320\247\205\363\303o\344\204\321];\351\033\244S5+\203\364\230\302\313\226\005d-\265\356\200\006p\t\312\352\217&S\262\215\020\"e\n\247"
+	.string	"\302"
+	.string	"\277"
+	.string	"O\3155\370\302y\"\223-\027\025\355i\255\314\322\334{\273\302\277\324<A\302\323\024B\200\265{\366l\222>O\264\251\373\334\326\314\350\203;\330\021\257\024\331\360r5\370\3777\203\237&\003\352\226\201#~\\"
+	.ascii	"`U\260#v\005\213,\317\267\366%/\356\216\t:8\261\345\016\374\374"
+	.ascii	"\007\b\370m,\327\001\316\177\232\211\376\233,\216m\334\323\224"
+	.ascii	"\354\277\274<\376\314\335\353\361\331\347\324|\247\356\233f\371"
+	.ascii	"\277dK6i\344\277Q\364gn'\315G\317\243\235\375\264i\236=\237\377"
+	.ascii	">\2575\377\277\251\271\251\311\215\347\364\026\376\001\275\347"
+	.ascii	"\035\221c\344\216\030B\257\256\" \364\212#\364\262\272\377\321"
+	.ascii	"m\214\324\241\004\330\245\r\230\240o1\307xq\034Z\202\221t\241"
+	.ascii	"n\260\2275hu\357y\273\347\233\232K\326<{\356r\210\242gC=\236"
+	.ascii	"[\033\375\365u\026f`O\330\025\332\275R\226\364\371\335\377x."
+	.ascii	"D\203l\003\252lV\004:?6:?=\367\022\"\324\234\313\335\306H\245"
+	.ascii	"\026\033\376\270\216f\264\330\360r\311\210!\274\277\373#\336"
+	.ascii	"\235\265nXX\263\0130\260\026\203\232\337,V\214\355\305\265\270"
+	.ascii	"vT\361\024G\361\023O\272\211\2278\211#}\304E<\004\203\370\207"
+	.ascii	"\261\275\036\210}fA\201\216tm\304\2417h\310\360\306\220\244\371"
+	.ascii	"<\317'\253\200\341\275,\207\252\371\312\252\317KV\fUQ\365\355"
+	.ascii	"U\215v\246\002\260^;\367^\036\253i\312S\214`\235\032\362\300"
+	.ascii	"\\\337\372\003*\215\317\316\232\n\337\367T\225\356\247(d\033"
+	.ascii	"\320\212\3454\261;Rbw~\300sS\237\237z\034\235N\244\026\325u\273"
+	.ascii	"k\214P\236H5\277\25147\371\177\315L\220<\327G~\244\346#\365z"
+	.ascii	"H\215\242\246\331\343\355\271\321H\201\265\277\210\356^\",\212"
+	.ascii	"\354\r\256\377\020!f\037\342-\251\212\22775\274\367\034\244\017"
+	.ascii	"\344\007/M\214\303\231\2275\310\325S|\234\311\327\203B\330\225"
+	.ascii	"\331m\003\206P\213Bs\357\355uGu\332\343\033\252\233\344A\244"
+	.ascii	"\026ufd\315\327\355\230\214\312\243;#\335\216\311\b\367\362:"
+	.ascii	"%\035\252\204*1i\300\215\207\303o(\264\277<d\303\013\374\331"
+	.ascii	"\312\026\3276\243\221\305\262\244{\366 \2731k\003,c\2553\036"
+	.ascii	"<\335g\311\330\364\032\336Z\273XE\266\350\366L\f\257\230\342"
+	.ascii	"\345\205i\311^\367[%\324\347\362\177\263\2312\245z\311{\261<"
+	.ascii	"\375\240\262X2\251\232\246c\316b\212\316\013\225\326S\357\005"
+	.ascii	"\3430Ee"
+	.string	"[k\354\325\213{\243\212\300\033\\\267\220c\314_\314\252o\275sn\252\n\205^\327\222\205\273\336\314\025\201lx\275x\253\245`5\177i\356\242\305%K}\363\226\263\226\037\313\225\036\217\365N\253S\347\352\245\352\013\201j\250!E\252JF\223$\2056\003\261\004\3061\346\250t\036\022\240U)\3102\351\230\214\246 %\205\322\316\030a\347D\314\025=@\355\260\246\0073\344\324\205\274\023\033\255\336\370*\200\344pS_\314C\315jqP\300\021\323]\312\364*\231?\007<\023\024\354T\302^\345\233}\026\316p\362\316\303%\032g\344\001)\222<@\362;R\016\272\022\324\245\221\261\251T\341x\202.\246\332\003\361Y\033ZU\364\037F\376\250f\300C\201\\\r\034\350\2525d\260\325>\302:\336\242\243\220\305/\232\203\363\300\2774\325o\346\334\013[\003\276\035\352\007\232\272OMT\337\3749A\261\\\200?\321]"
+	.string	"u\t \247:N4~`{g\366\264\034z\020\246\313\311\031F\250x\316m\350\255 \346\226u2q\306\021\213\222\245\026\266\025\221M\201\006e/\331'\035\020j3\325\021S\017\266t\377\241\310\221\032I\f\321\247\013\300u\330(h\232\264"
+	.ascii	"7\227\r\330[\271\356\033Y\251R\242\361\005\240o\324J\271\313"
+	.ascii	"4\357\345_\271it"
+	.string	"]e@\344\373\312\241\005\202\022\3723\216\256\356\240\261\236\221\2242q\3469KAD*\207\342\273\234\233\354\226>t\bM\317\371\203\032\352C\3438\250\335\260\n\232\203\373\005\270\252\367@'A\267Z\031#z\025\234\205\003\351<\311\226C\262zt\243\345\344\213OR\277\215\333\032\364s\214\235\250'\346\003\201\204{\263\355\217\213>\224X\244GE'b\230\270\035\332\263\024\205\241\026\252\312\256u\253\2004p\b\017~\2645\333\255\224\237\fF\353=\223S\002`\324\221\004\332\013\265`\326\221\026K8 \n\037aV@o\26450qL6`9\0314N_Oi\244\207\267{\035\361\314\003\300\207\300\225(\316\335B\026\200\2044\002\253\"ns\241\363\201\023\363\201v\313lq\206\tE\277\275\261\023 \215\306\311^&.\024\346\307\371\201$\016\236$\340\364@B\340@\037\257\212a\313\275A\016c\306]\225Y\306"
+	.string	"\231\2250\201o\267j\216\361\225`\2664\302\326\347\262\021\270\013'\f+\365\377\001\300\216v\317\022\037\r\002XV\020$lz\312\261\254\021mb1\331\210\202\276XQd\311\376+9\005O>\250W$j\177+\001\227\316\314mv0~\335h\226bxgq\"\263T\201\004&Hc\302\037\201`\2435\020R\005\373\233+\365^{\317*\355HO\304&q\350\311\005c\327\245\002\261\bhH\223Y\270\210\001qQ(\216\244\305\001\331\002\330\027,\013\372\2044C\0063"
+	.ascii	"\221SE\3240Bn\002\200\207\357\b\307\253nK0\322l\244\343d\221"
+	.ascii	"\225aE\001"
+	.text
+	.section	.gnu.lto_.lto.a741ea90f9c9c8dc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerNames.205.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`6\003%\025"
+	.string	"\326\244\211K\240\230Q:\n\3479\024E\347\365\210\327;8\221\\\f?B\214\227\247\303x9Eh\342x\306\360s\325\2671B\205\253\243\202>\235\\?f\254\035\244\225+aG[\f\257H\037\342[\027~\035\036\375A\217\310mc[\345 $\355s"
+	.string	"s"
+	.string	"v"
+	.string	"EzB7\337\004~\327\f\361\335\241\233\277\204\337"
+	.string	"\206\300\321\212\351$\360;@\324\204Kt\363\221\360["
+	.string	"\217\337=\302\357\0019*\024\335L\001\277\t\334\370\215V\303\f7C\300o\222\006\016\277\013\304"
+	.string	"j\270\371\001~\033p\261\201\303\315\r\360\373\200S\360\306\360\033\301\212 \254\311\351\252\204\226P\230\257\364\356p\263\210\337\tN\336\203\353mOZ;\222\001\347\362-Q(\"\211Ib\b\231(B\3076\016\205#\220\034X1\247?7\213K\030\204\022~\213\342\0071\t\277\307.A#\325p\013\277_\266d\341w\237ta\301\302o\327I\227\225\334X\305\244\273\371T\370\375\272\232\302S\202.\357\346K\3417\fU\024~\303\240"
+	.ascii	"/\024~\3074\t\336'\374\226Q\022\034\253\206G"
+	.string	"\201\3373G\"H\270\371'\360\233&\250\212;\313\032{\342V[\272\346t3\230\365\331\020Y\360\305.\020\t\025\305|F\300\230\ri\177\030\206\214bG\277\237Q,\306\312trpv\264R\367\003\263Oq\025o:\213\267\370\323_\034\306e|\306k\334\306\241\216\343:\276\343=\356\343?\016\344A.\344R'r#\237:\222'\371\2223\271\223?y\224Ky\325\255NE\301\261^\345W\236\365,\327r\255\366\304\255/V\335\321J\335\217\313\236<\243EK\036\333Y{\331\035\336h\333\326ngP\257v;yh\217\214\225\361F\273[\260{Yu\267\226hO\272\316R\030\214\265\251\263Y\357&\007\207\306\326LZ\357\206A\357DM\037\031\240\227\365\331\331\231>.\233\002\341\314\\/]{6U\235AK\035-\306\342\314UMg&Z\273\235\271\031+C\317r-_\366e\315[\031@\250\021p$)"
+	.string	"\213\334Q\224\222\244\315\320\002\031+z\020(\2020\022\247\003e(\233\210E\275\262\027;|-Ay\252#\305\007j.\222\205\374\315\264\225\233\362\322H\020\346FMFn\022\377\206\362N\3631]\316s\317\246W\002{]9\355u\264\324\025\037rB\332\253u/\246"
+	.ascii	"v\"\372\274;K]\233*\326\254\333uW\246\247\352\005\201#S^\234"
+	.ascii	"\232\272\020}^\204\3431"
+	.text
+	.section	.gnu.lto_featureNames.206.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\272\003\005\027"
+	.string	"\366i\230I\240\232m\306\342z\022%O\021h\332\027"
+	.string	"\b\001\020v\313Sx\215W8\342\025>f\262\300\331\020g\305an\255\277\321\241#\206X5~\023\330]\267\021v\223\206\224\343\251\217,\r4\205g\275\365\224\024\261mi\310\3302\311\207"
+	.string	"\206"
+	.string	"\203"
+	.string	"_\241\217u\246\240\021\362\372\024\372x\007\312\320-\257\247\322\307<M\220\362\241\364q\200%E_o'!\257w\322\307=H\004\354T\243\274.\351\343\030\021\334Q^\215\364\361\200 H_\231\252\244\274\022\351c\002>\n\3600\220c\202R^O}|\300F\316B^K}\214`F\023\206\274:\320\307\tbd\310\032\362\n\244\217\025\300\330\360\272\332\365X\364t\272\365R\307\034\362z\365\361\202\307\336\241\346\330^[\373A\005Y\256\345\\\336\345_\016\346\274w}\314\311\274\f\203\237\271\272\353t\237.\210\273\336\250\033\342\212\270#\356\324-qM"
+	.ascii	"]\024?\342\327\245\213rj`\357\211\253BS\345\362\275$jc^\357\224"
+	.ascii	">\376\256\324}\322\3074PM\037\257\212\247\217\361\007.}\\s=|"
+	.ascii	"K\037\333<Vc\246(k\351^\356\343\355n\304<K\037\277\302`\351c"
+	.ascii	"\230\027\234-\017ly\275\225>\316\301b~\275*\by}\013}\f\300J'"
+	.ascii	"Z\202;\305\261bh\332\366\bf;\236\250J\264m\354\3556\321RD\325"
+	.ascii	"\031*\302\354-\035\205\300]S\307\264\004s,\316'\211\002N\266"
+	.ascii	"\224d\244$\30315\311|b6W\341\210Iv!\227c\222\301\354\026Sr\244"
+	.ascii	"\251\263\321\006\226\267P\307\336\305_\334\352W\227q\254\323"
+	.ascii	"x\215\3378\216\353\370\216g\275\307\177\034\310\205|\310\213"
+	.ascii	"\334\310\217\\\353I\256\344[gr'\177\362(\227r*\257r\256_y\326"
+	.ascii	"v\236$8Sg3PM\203j#I+G\236\227=\315\024U\267\231\2326\230M\311"
+	.ascii	"1UM\241-\2420K\202\343\026\321\224f\2420\213\2365\232\221&\326"
+	.ascii	"Jp\343\330\333NE\233H\212\351\313\206?\237\265\r\235*)\222$\270"
+	.ascii	"\301S%\332;\366Dm\263\020TG\024\3357\366\034w\212\252\241H\276"
+	.ascii	"\354\r$Ot\f\263\rQ\223\306\326\3121\334\340\3206i*)\226%\030"
+	.ascii	"4\353\261[\fK3B\250!<\353\004R\021\314\254\242j\341\020\003\021"
+	.ascii	"\232u\003\020 c\270\n\322d\f},\337L@6:\312\027\231\2321\304\352"
+	.ascii	"k\200\232m\207]\257mD4ek\233\007\036\230w\002\325wHu~\367\261"
+	.ascii	"\337\373A\320yy\036\037&\210\376\263zv\274:\320\001~\324\021"
+	.ascii	"cEj\34214\250\310y\330\034\351J\013\255\305&,\225\314\355W\356"
+	.ascii	"\322taE`\314z\nc\311\253y\311\003"
+	.text
+	.section	.gnu.lto_rxFailsafeModesTable.208.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375 [-\002"
+	.string	"D\003N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\002\005\001\006\025\177\001\001\003\005\001?\202\210\200\030}3\276\0014\275\001\274\001\273"
+	.string	"\300?\202\210\200\020{3\301\0014\277\001"
+	.string	"\006"
+	.ascii	"\200\b(\327\316\t\340\\J\353\030(\002"
+	.text
+	.section	.gnu.lto_sensorTypeNames.209.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"e\007"
+	.string	"T\f\331"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	"\005\001\006\177\001\025\001\007\005\001'\002\206\b}\005\001\212\001\206\200\200\374\233\336\310\311\n{\275\006\005\001'-\206\by\bw\300\005\005\001'2\206\bus\303\004\005\001'?\306\003\005\001'D\206\bqo\311\002\005\001'J\314'O\316\001"
+	.string	"?\202\210\200\300\001m3\317\0014\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\001\274\001\273\001"
+	.string	"\bGPS+MAG"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\004GPS"
+	.string	"\fRANGEFINDER"
+	.string	"\004\005BARO"
+	.string	"\004ACC"
+	.string	"\005GYRO"
+	.string	"\020"
+	.string	"\270\212nv\201y\212\033\260\004\340\032d\f\b\203\214U\305\037\310\r\220\3103;\220cA%N\261o"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_sensorHardwareNames.210.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375 \233\375\003"
+	.string	"\264\006l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\303\317\364\031\001\177}"
+	.string	"\005\001\006\025\001\004\350\317\001\177{\003\2507\177y\002\037\177w"
+	.string	"\002\177u"
+	.string	"?\202\210\200(s3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/cli/cli.c"
+	.string	"\007"
+	.ascii	"T\021\002\344\326\034\004\362\2659t\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_cliWriterFlush.211.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"e\b"
+	.string	"\242\01797@s\322\0010 S"
+	.string	"\276e\007\247\274D\033q\277d|\356AL}\341\242\232\262\266\255u{g\bP\024:&\271d\034\266Ww\321\372\232\033#[\302\022\262\245L)\326>\033H\213\033H\213\020\033\303C\324:\211\370!0\027\341\320\305\t\216\353\242g\265\207\253)/\274\270Jj\202Y^m\212\212\274\347"
+	.string	"\026\313uRR~2\0310jQvmH\2419%\216\375\223\243\210\374\021[\204\362\3361?\224\035\273*\312\306\204\243\224/{EJ\375\260\017WS\366\323\307\006\\b\024^\273\032\257\234ua-$\266\357\361\310\256\371*d;\"\255\013\225\233\335\215\n\362\321\241\346\310\277\352"
+	.string	"\336G:D]a\301L\253D\340;A\203\016\217\225\253\236\030\237)\263\203\260\273N\357\333\270\261\333N\260}`\233%\016"
+	.ascii	"3\241\257/F\327Pf\330\333\250\026@\340\020! \f\001\272\206\023"
+	.ascii	"0\301_\306\025\227n\252v\246h\n\n"
+	.text
+	.section	.gnu.lto_cliPrint.212.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\255\013"
+	.string	"\226UO@\020Q\225\016\003:\245\375\274\244:\002\225\254\361Uf\212\331\251\300\",\rC\305W\352a\2551\264IU\241~`0\034\221\035"
+	.string	"\004#@\204\002\234\310\033\037\001\354\326\260;i\221D\262\267\224)\005?"
+	.string	"="
+	.string	"<"
+	.string	"!>\375.\343\352\347G@\316e\246\3411J8\270X\201\200\237X`E\242\203\006zt#\001\0171D\032\330\211\023\325\007\0337]1\200\037U\017\004sN+\b\f\335\330m/\260=\300~\202^U\377\003@H\245\3405g\206\227k\312\2200Fh\266\257\366Q<\305\367\022\205\207\3149:\221\23234`\001\331\245\303O\260\313\354\022\354\322\237\315zH\232o\301\262\200\3121\347\3346rwE;R&N4\326\033\354\333`E\r\217\266\354\237\256b\343\213\360\204\214\036t\351g\260\313\357M\017 r\225\330PA_v\310\321\005\241\003\307\214\027\336\221\375\322\237\275t\313\325\035\306[W(\226\007\225\r\202\205\301e\253t\336F\231\230\213\340\240\3330\034\327mZ8\277#\335\216\214\233\255\334\013vD\263\265/\234\036\344\270\234\003\244\326\215\250\301\026u\026\032\t\236\207=\025"
+	.ascii	"\357b\314\f\r\347\270\257\327\261l\005i\330\020B{@;\260\031,"
+	.ascii	"\036B>`jD\260\221C\330.\3436U\250KX\315j4pG\276j\317\250\230"
+	.ascii	"\212\002"
+	.text
+	.section	.gnu.lto_cliPrintLinefeed.213.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"r\213+3PO\222\016 [\266\252w\230\253\256\371\200 \225,\252\001r\226\225s\357\301\332\036B\242\304\243\331\264N\303\230!b\017\255\344\f-h\326>$\232\335D\246\017\020\340\323\206\3630\271\bN\003\204\233\252\t\2671\230\222p\250\034\005EUN\302\262\bz!$\313@\215\243V\223\236T\024\2042;}\026\001\235\004M\243\277\300h}\267\225\217l\003\257\307\256\206\"\337L\"\350\361"
+	.string	"\204\205\241%\323\023\003\223Y\244B\362W\332z\227b\241lJ\007\007\312Kf:\034\251\325f\335\226T\340}\2566"
+	.string	"\205\314\274\275\217G\307\376\b\277\346\367\004\t"
+	.ascii	"\357b\310\204\006\340q\200\013\3335\221,\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliPrintLine.214.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"M\007"
+	.string	"b\31624Pm\323\001$\203\310\252`LAM\034\035\374\355\030D\020@4F\251\361\217\035!\024\177\363\0066H&\275\2522\252\332\370D\242\201g\334\352\377\377n[\246\024\025\310z\235<\237\205)6|\022\030\342TY\321\303)\345\240PE\020EUq\303\335\322\237\326\003\220n\342\205\212\311\326z\350xt\241\207U\312|-DD:k\242tt\024\017k9,_Fk\351\377\373\264\326\233\235\260\363\221\202P\362[\264\260\274\203'\034\233\266\316\326!\026\271\274I\030\340\327F&?W\320\201\214a9s.\206\031\007\\\f{\265*\3466n\022\214\212\221\225\377\361i\370r^\265G\326d\"\314\2111\370\337\314D\027\356s[\201\266\004m\267\n"
+	.string	"\357b\310\304\023\276hq\241\264\031\\\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_cliPrintHashLine.215.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\202\01775`o\032\003\024\022\002\273\036\362\003\3045\204\264\006?tkD2L\246\036c\017\005\035\022f\231zE\023\013 @"
+	.string	"\025\331\241\376\035\300\313"
+	.string	"d\273\255lR\246\024=\360\004\bDm$\202\305@!\bLJ\204\034\"$\246\211$\250\323l\342A\223\243,\323$g\336\232CS\031\\V\032p\243\326\203\260\245`\261\236\247Q*\006N?\311\235\305ERHpl/0\236\273\276\025\325\212\003r\355\344\036\004i\255\371\377BSk\224\r\243A\313K\203\352\367\230\221\371*\246H8m\375Z\227\330d3*\303\004\277\251E\345\237\237\"\\\216\235\356X\216\227\013,\307n-\214\347\351\233\021\221\216\224\230\377\022\206x\363\333j\237\030\240+q~\233\205\377}]\351\303\205n\353i\373i\233\n\013"
+	.ascii	"\357b\310\304\263\276hq\241\202\024@\252\225\002$\027k\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_cliPutp.216.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"u\b"
+	.string	"F\321;5@\217\322\001\233\301\3365\001S\024L\204=[\001)\226\315Q\037o\271a\023\333_\002\340\247\022PE8U/\003\302\207\031\202\362\345\366\216\227\326Q\362\t\2212\245+"
+	.string	"+"
+	.string	"*"
+	.string	"\033\017h\234\265k]\374>\256\201\210\234Nb\376o\351\341\316\330\32561"
+	.string	"*U2j\f\377\213\250\324\206\233nk\3206\241\255+*!m\315i\233\330*,t~\027\315\237\003\205\365\337S\004ck\022\227t^\325e\201_5\302\372\237\247\007\033g}\356h\234\005NLg:\003XVN3&|\265\257\204\331\321\032\373\377\246\252\365\312\316\374\354L,bXk\004/-\016)\277\306K\346\255,\021\034\212\\\356\003\222\3406\n\320\303\304\306\215H\333\247\323\220\bb\264U\204B\243\215\363n\354\251j\003L\313\224\030\325\0203\313\226d\201F\265 #K\r\n"
+	.string	"\357b\310\304\213\277h\300\005\002\346"
+	.ascii	"\346\032\373*\fVP\241\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintfva.217.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\265\013"
+	.string	"\006\026P@\020S\224\016\230\177\200[\340\355aEb\005\204:B:\230\n\315\363nA\240u\261\301J\316\332>\376\355\002Z\2042O\300\006\t)\005"
+	.string	"\n, \001\304\027\003Y\030\245\240\032\2374\262\267\224)\005>"
+	.string	"="
+	.string	"<"
+	.string	"6\217\177&vr\"\204D\342cw/-q\356P\223\363\217:\245\363@\207\245+4\220\243\206\n\001\336\b\"\0201\342\305Q\317\016\236(s\362`w\235\235\007\342\216\267\r\301v\003\373\016\002\376\244@\351\206\204\036\273\037J\202l*\312Ha\373\025\333\231>\213\221\r;\030\370\237My\264\202\247\375\025\017\341.\302\341\003vO0b\354~\013\234\300z\364wK\365h\235@\365h.\235\003\314\360R$\005\245\207\303\003\r\365\247\272N@\351\030%\020\373$w\361\361Q8\203'\337y\252\307\253\232l\374\b\021\312\022\373\003\245\222\260\017ww\255'\373#\177\274\310\0175\003\230\206\3140\033\316\201\n\033fu0\315\246Q\250\234]2\026\262\353B\006\323\\\331\306\271.\026k\033\314vu4m\273*\337\036\256\236\034\301\224\n\251\b\002\310\250P\337B\243Y\273\241wW\033\003'\037\024"
+	.ascii	"\357b\314\304+\242p\013\006H\343\025\241\252=\220\032\"\256k"
+	.ascii	"\304@0\301\212k\3542\f\t\246\201+N\315\215\031(@E\021wy\252&"
+	.ascii	"\247hj\017"
+	.text
+	.section	.gnu.lto_cliDumpPrintLinef.218.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\321\001\265\021"
+	.string	"f\242yH\340\360&\035\3304\021n\342OdH\315\310\021\"\t\3376\375 \\"
+	.string	"\233\364\337FH\305\330\033\307\265,\\\377\3265\340\214\037\276M\237\243k\252\245\n\361\200\222\355Pq\272\220A\252A\020Z\262N\006\215\222A\310\3362\245c"
+	.string	"`"
+	.string	"g"
+	.ascii	"\017\202](\203\001\354\352\270@\332\035O<\340{W\362\021\357\335"
+	.ascii	"\274\210\367\316\266\013\034\2009\366\261\347\246\303&\005\215"
+	.ascii	"\215iw\004e\210\307\336M\2511\337C\224\275\363\360\211\022gf"
+	.ascii	"\311\356\202\2104\225\323\300\f\323\007\020q6\0038\321\310\270"
+	.ascii	"\355j#\322T;Rv\327Z#v\270\275\333v`[\305\326Tr\307>\321\377}"
+	.ascii	"\374\273\013\375\323j\365\324\377x\3202\335\200`c\367\346)\207"
+	.ascii	"L\214n\205\317\215n\377\204\2173\312\277\275\bv\243\327W\003"
+	.ascii	"\016\003\021G\271]\234"
+	.string	"\324;+\370\336}$\271\r\263Q\266\347\320k\260\023a \tYZm\004\022\202\361\223\3721Fr\034E@-N\276wV\265\017\024\241*\374\351i\312\321\244\314\037\272\364I\233\002\313\352\007\307CS?\212\343X\0028\354\356k\354\326\213\276\306\307\375K\372\331\320\224\233\2212k\211%\020\342\214y\235\\\251\321\240\251\323=\312.s|L$I\311c\023\357RBm\006M\235\034r\023o\312\313\333N\200\205\322L\351\2263\323'{\224\251\344\261?ww\035\341\005\215\tY\256\326\212\027\323\362\nWV*0-\341\353e\365Q\001&l\340\302zM\370\254BaiQ\201\026XB\026\250r\301\200(#n\271\254\\`L\253\345\002Q\343~\256\334\361mO\301\270\335\344U\374\270/\250\361\342v4\377\230\247\322\306\266J\247\310\310\331\273\327\334\325I\220\033\322'\213\250\375 \002\211\246\334L\312\034\242\001\037"
+	.string	"\3571\270\026/,\013zm%nv\005c\255\037b8E\020L\024s\200\314\250\206D-W\244\220"
+	.ascii	"\013\tZ0\3710\b\273\314\326\205\024\027\031N\344\321\336\021"
+	.ascii	"\226\0029\245\202\301\025F\f.\302\035\004\264\231 \210wU\271"
+	.ascii	"\336U\366"
+	.text
+	.section	.gnu.lto_cliWrite.219.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\305\t"
+	.string	"\206RC:0%i8\336\363lp\343\005\302"
+	.string	"\t\313q\245\333\026C!\n\255aEM{\343\316hF\210\335\024\245@\354[\242\327q1\202\300\214la\025\247\350\207\026\224*\261{K\231R1"
+	.string	"3"
+	.string	"1"
+	.string	"\273\236\246\034<\247\t\372\227] \024W\347D\256\234\201\316\314e@tq\b%'4\227==\304V&\250aw\235\241\030rw\267\355`[\301\376\003\231NM\037T0\303\201\240\355\202\334\004l\255\263i\261}\221\355L\233\304"
+	.string	">\306a\3355\201\251\331\035\027\234\020zg\320\336\371\250\262\240\025\333k\006\300\006\257\001)\346|\334\250U\237\253\204\214\315\225\001\354\307|T\371,\336H\345\303w~\352\363\356\252#=/$\254\274\331\343*\025\305>\267\n\263\037\373\273\024_\372\033\225*>\357\242\024a\341}'\2247\"\260\tc\342\344i\230L'O4\356\271U\230\037h5\226\266\270P\246^\355\fT>\364A\207\256\334i*i\306\023\017"
+	.ascii	"\357b\314\304;\240p\t\006(\343\025H\325\034|\r\261\027\324\260"
+	.ascii	"\240\013yK\306>\225\032'\356\334T\355L\321\024\024"
+	.text
+	.section	.gnu.lto_cliDefaultPrintLinef.220.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\356\001\215\022"
+	.string	"\366\343\177J\300\224Q:\370L#\205\007\006\336l\2218nl{\324>\032\2630\252\024\333!\241$\201\240]J<\2126\373\243\277\236\023\305\017\272gxF\203TJ\002\244\037?K\030\016\037\226)\311m\367\023\364BM\265\337\030!{\313\224\002l"
+	.string	"d"
+	.string	"l"
+	.ascii	"EW!\273\321\006\243j\r\262\241T\353\330b\002\247\203)_\205\007"
+	.ascii	"\351O\302\203\266m\340\200\314\263\217%zHp\277\016\273\246ZG"
+	.ascii	"\326$\361\331A:w\346\003\310\321\016\2068\245+\244OH*\267CW="
+	.ascii	"'n\252\234m']\341\030\321C\225\333\241+\"j\200\370\356\213\313"
+	.ascii	"\325vI^j\255\336[\356\303\035\3366\004\3330\3662\b\237eY\226"
+	.ascii	"\236B\366\221~\324\307\037\274\321O\275\336p}\325}d\023\020\n"
+	.ascii	"K\265\366\224Et\230@\031DO\272\375\026~\317)\237w\027\262'\305"
+	.ascii	"^9\37040"
+	.string	"q\204\254\325\207\345\240\025\234\016~D\271-\263S\266\351\321u\262#i@1\2516\035\221\022\202\3614\367\343\f\345C\230\212h\264\234\016z\327~\023|??\322dw\240\246-\266\\\276Z\262,\377\213\367.\b\340\251\265\376f\313\314\210+\232~\344\316\244\031\265\003\356\031\241\375\272\331\337\374\336\317\263\364c\262M\232\375\203\305\215\034t\016\371\263\020\234\213\342\036i__\020\034@s\016Y%\374\254\240\343a[\"N\271JH\347\347w/\220\302\210N\007\357\247\266\245=\322v\016\331\001b\206\315\021k`\257\2300\207&&\306\270`ph\304\330\215\253d\006Gt`S\023\263pr\313E\206\246\305\302 #\326\260Z0\034\226\313\312/\033\027\214\225\363z\301X\251\261\236\326)\344\335\335[<\360x\3630\376\336\027\370\300\361b\320\177\026\356\304\331\336\351\027\235Y;\255\265V0Fk\rJ@\036m\351"
+	.string	"k?\210"
+	.ascii	"\364#k\223\346\223\225\020\" \200\202\031\301\365\237\030x\211"
+	.ascii	"\027\243x\265A\024\020\266\017\302d\347\300 \225\255@2H\300\207"
+	.ascii	"\231\034\304:\344\314\3456\2100d\267\205\233\"\217\370\261m\240"
+	.ascii	"\021G\n\357n\276\275\343K\221S\007\363\n\203\301\005w\020\240"
+	.ascii	"\231 \361\212[\320("
+	.text
+	.section	.gnu.lto_cliPrintf.221.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`B\001\275\r"
+	.string	"V\231[D\020\221\223\0168D\251@\304\n\b\007\007\377,Xh@pQS\235\230\307uW\325\362\235@\371\210\203\277\241m\310\037_\207\245\243\253qQ\344"
+	.string	"\"\200\210="
+	.string	"P\246`{\243T.'\364\2627D\366\2262\245E"
+	.string	"F"
+	.string	"J"
+	.ascii	"\346\376\271\0369'p=z\263s\234{\331\277`Y\241\261\331]LI|{\204"
+	.ascii	"\232\233Oz\274w\350\341\n\021"
+	.string	"\250ZX\235\224\t&\240Q\263r\357\271!\225\222\351\021\262\273\316S\252\303}\335v\003\333\037\366U\004kU\331\237\371\243\246\037\340+\0246:D3v9\264v\224j\242\214\023\357~\373\367\334\261\271\257\330\336\241|1\240\030\230h\371vQ\240G\2038\217/\360\264\037s\231\3553\027\356\331U\305\304\330\345>\254\200\363\030$\371\223=\253\f\254OEI\277\021\321r\001Q\340\356\210\005\357\256\037`\300|]\252\324X\030U\027\237\\W\007\336\rS\336\330\247y\213\023\277\204+\230\344O\217\276\311\365xeI\201#\204\f\210R\266l\216\224\352b\037\356n!\013Y\022\032\031i\017.g \242\b\031&A\024\032\301\262\021\t\006\362\2616Ad\204\225h\332\b\353p{\270\252rHIS\036\377u\331\362\200\314D^X\237II\026\220\006lD\265E\020>+\024\200\004\375,\356i\0074\234l\n\001\034"
+	.ascii	"\357b\310\304\3531\\\356\357C[!\004F\346 q\021\360\200\206\215"
+	.ascii	"\222\002\302 :\276\323\212\005\256 \332*\022N\362\017$\307\306"
+	.ascii	"~q\rD\303\225\235\262\003\f\221\247\250\214\273\271g\271\251"
+	.ascii	"\316\27541ESP"
+	.text
+	.section	.gnu.lto_cliPrintLinef.222.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`U\001\035\016"
+	.string	"6\332]D"
+	.string	"\223\223\016X\b\272\025i\201\t\376\021\370\203\354\374\nIG\373\223'{\327GAwe\n\213\003\372f-\201\017`w$\006\253\"\024\351A\201V\225 \217"
+	.string	"E8\"\260,\241H\b\372\204V\311&R\246\024G"
+	.string	"F"
+	.string	"N"
+	.ascii	"\233Gs\357\\\217\233\027\270\036\255\331="
+	.string	"\316\251\330\323h\301\022C\263\273\230\246\270\366hij\376\366x\357V\210\253\225 e\002\344\240J\226\002\034+\226{O\017(R&\200\221\335u\232P \356\353\266\035\330\016\261\257\n\276\265\273kM\331\207\371\243\246\317\371\314\211\306\307\204p\367C\370c\264\2126\\\274\373\355\3373\307\346\036C{\247\362\345pj\300\302\345\333=y\036\355\331<\336\300\323\276\313_\264\303l8\310nJUc\227\013\361\202\3672\004\035L6\006\223\274\311 27\300oE\267\327\234\bU\226\212\265\213\202\301\273\253\210\034\340\327\345\212\216\205\241\332\342\224\353\032\301\343Q\312\032\3731\237\221\342\257p\006\224\274\351\321G\271\036\257$^\254J\274\214\030ehs[j\213\003\037\ry\362)\021e\022.\203DB\025@\230\205\320\247\004\003\211L0\221\216\263\013$\"\354$\313D\030\207\333[\253)\217\214\224\364\370\257\313\320\004\322~"
+	.string	"af\301\217\244\233\007$\210\204\006\374J\272Y@\036\330\021\325\016Q\350\310\254\002\244\347\227\021\035"
+	.ascii	"\357b\310\304\203|8\246\335\267\267BTL\246!\b\b$.\002\036\320"
+	.ascii	"\260QR@\030D\307wZ\261\300\025D[E\302I\376\201\344\330\330/\256"
+	.ascii	"\201h\270\262Sv\200!\362\024\225q7\367,7\325\271\227&\246h\n"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_cliPrintErrorVa.223.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`P\001U\016"
+	.string	"\346\231^E"
+	.string	"\221(\03584\210\233\310\033\202\264\373!\363x\303\210xC\373:\244\327\310\367j\363\264\021\335X\375I>\322[\224^\363&\206\277\005\322\257 \360\353\243\240&\306d\027 U\272\355\021{R#mo\262eJ\001H"
+	.string	"D"
+	.string	"O"
+	.ascii	"\233R\275\354\206\004\034 \273t\370\315\274\314\016`^\232d\307"
+	.ascii	"<L\331\f\t\027\r+Z\273\313E\021'\035\213J\3623 \032\020\365\035"
+	.ascii	"\363\360\310\2012a\234\335}\313u\003\352D5\003\262\273V\020\325"
+	.ascii	"\341\226\267\002\373*\001\2407\252\027\027\313\024?;\3744\242"
+	.ascii	"\330\307vw\035S\366Y\376\371\225_F\365\265\257X-\032$1v9\274"
+	.ascii	"n,\214\204Q\302\3665\333\252~\n\226\013\256\002~hk.=\340j\377"
+	.ascii	"\304Q\220\276\202\341\036\033_\364h>>h\221aR\033\366[\334\305"
+	.ascii	"\310\037\341\006!z0d^>\306\0173\\ J\372rq\320e'\004\233\325r"
+	.ascii	"\350\214\366G\304C\325\322tF\031\355\b ]\205\200\311\020?gz\025"
+	.ascii	"g1\241#e\367tP\224\235\f\b\240`A\037\336\266\r3\347@gA\247\223"
+	.ascii	"`\3336\255\253\240\236O\211\210#\342u\231I\007\362B\020\246="
+	.ascii	"\037#$\036N\302H\007\342<\236\210\373\3308T\362\3618\223P\310"
+	.ascii	"\343\264p\217mLY\256X.V)\236`\021\345\243\371\202AF%\306D\215"
+	.ascii	"\222\276tw\003\" \240\202\031\302\362\357\030\263\342y'\\\222"
+	.ascii	"\020\317\256\233\232\333\304v7\310\325\245\353^\311\335\261\337"
+	.ascii	"Ra\214L\024\tb\007>\2740\376\203F\214\001\217`\311\035\273|\310"
+	.ascii	"\247y\305\325\3340P\300E\001^\302\200\345\312=\272\371\341\301"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_cliPrintError.224.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\325\t"
+	.string	"\246\222C;0\305*\035"
+	.string	">\177\340\316\230acHfF\031&\346\355"
+	.string	"\016\255\324p"
+	.string	"\235\264\220\364\032B}\300l\013\023\257H\355\036\035\030\261\354A\351\274z\263\007\235\023P[\343F{\247\024/"
+	.string	"1"
+	.string	"4"
+	.string	"\365\235\3553\363\200\355\323\236\315\362\352\261\030\227\312\005\tmw\251\354\270\367\350\371\207]\363\261R\217\030\203\335u\374X\032\267\274\355\001\333 \373\236*\331<\3718\370\333?\314\033\273^\304;\210\372Z\254\016\\+\263\335\325\347\323\237\314\347\005\036\355\203<\304\373k\342\234\335\226Il\267\202L\220\371tR\332\\C'\214m\361\363\217\034\366\340\301\370\354\b\211\370\317\234\260\004\300\254B\246\354\232\212\222\303\376ew\327\262e\377\365\313\355\241\214\326bB\331\315\250\005\b\"\210x\022\225:Na\363(DZ\030Q\023IT\242\243\316\201\206:\346\030\022:z\342\270\216n\352\376\262\262e\204P\246\222\024F]v7\n\016\37630\326\254\211)\001\020"
+	.ascii	"\357b\314\304\2030\034\237\0270\030a\324\025`\007\321\361\253"
+	.ascii	"&0\273\246\240\341\340NY\f\206\310ST\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_cliPrintErrorLinef.225.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"=\n"
+	.string	"F\223E: \261\322\001\374\024Td\221\2319\201\031\200\231\177~\030p\264\203\b\204~\206q\225>\"\310I\1774\f\206\304\364\212\004\202\024b"
+	.string	"^!\\*\202\200l\262ad\271\321\336)\0050"
+	.string	"4"
+	.string	"4"
+	.string	"\324\365!\356\264\363"
+	.string	"\356\324\240\375\362\032\262\034\230M\003\305\266\273\335\0049x\t\372\237\335#\272\302K\016\302\356Z\212\256\216{\3366\201\355\221}\203\313q\243Y\215tE\344\262\337\376g\376\330\365&\340e\252oF+\001&S\333m\211N-\352\234^\340\322>\311K\300\307.\016\332}\265\250\354\326\221\013:\0173\264G\272\314i{\021!Z\345\244\350?\371lb`C\264+,\344E\203h#15\214\031\3325\224\363\303\376fw\327\363e?\366O\316i\243\r\306K\331%\n\231*\241>\217\201\263\211tr0u\017\247\022\2523}\022\035)d\017b\341\353R\236\367u\237\272\337\354|Y\241f\\M\226U\233]\217\203\232L\336\f \355S\203d\231\031Y\001\022"
+	.ascii	"\357b\314\304\0231\334\330\307\207Xx\"\004\004s\215\272\002\354"
+	.ascii	" :~\325\004f\327\0244\034\334)\213\301\020y\212\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_getMinMax.226.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\023\003\025\023"
+	.string	"\226\340qG\340\262(\035'\037\t\345K\322\257\335\354:\326\231Ye\024A\265J(p pE\216\331*-lrq\213V\317\031f]\256\347\223\307\267\t"
+	.string	"\3630\3140c4\302\311E\022\232Y\336\327\300\374E#\204l\"eJ\001Z"
+	.string	"W"
+	.string	"_"
+	.ascii	"i\237\305[\264^[\371\200]\030\036:\273a\211\r|\217\016_\352\036"
+	.ascii	"\277\223\272G\267l\240\2071\353\311\204\210\335\020\331]Pio="
+	.ascii	"r\232-?oC\262\231\353\021\304\017w\233s*n9\262\031\211+\013W"
+	.ascii	"`w\001\314`\231^\203\335u\312f#\356\356\266\035\330\006m\205"
+	.ascii	"\0050\006\376\315\005\016_\212\225\356\361\032c74\265W\016\331"
+	.ascii	"\241+\025\205}nw\327\nck\232\364\232_\300\303?\300k\377HL\213"
+	.ascii	"\272\364\027\323^\227\356b:ri.\246\225K\247\246O\200\244\326"
+	.ascii	"\243bc\267e\250\310\332\342\216\214\355\217\354\232\240\005\031"
+	.ascii	"\232\347\007\301\0032!\251\252\217\t\275N\337A\225\304\030\345"
+	.ascii	"70\230|R\327\311\360X\362I\035\321pn\217q\222\0226W\006\345\356"
+	.ascii	"\272\3245\f\344\341\270\344M\235\f\177F\0241\263k\037\206m\240"
+	.ascii	"o\327\365\023N\331\266\230\230\331\227M\360H\322\333\\\301\013"
+	.ascii	",\205\354\335\324]I\352\214\271\260Xu\234\325\267\033*'\225\246"
+	.ascii	"\244T\312:}P\243LR\032P`J\352\244\002Q\254\016\240I\311\253\r"
+	.ascii	"(,\320\303j\305\002G\341\236[\2051\005\027\266\227\262D\321\247"
+	.ascii	"\242\007\017\322c\373n\336I\247\036\204\377\210p@\302}L\350\321"
+	.ascii	"\251\210F\203\346\305\023\310\n.Z\3404V\370\016\0359F\264\034"
+	.ascii	"\232\232\252\317sb\034#\276y\272\307\017\tH\250aT\004\225b2\023"
+	.ascii	"\244\240 %i\306\320\002\231\251\262\003\021 A\247L\025iR\250"
+	.ascii	"\214\001O|\362\250')nY\002\212\317\335\220\021r\"\252R\025\266"
+	.ascii	"c\373\223Ik\021\376=\321G\277\314\235\027\003\313o\334\0028C"
+	.ascii	"\221\215C\213\330\002\025A\370\261\354w\227^\003 @\301r\261\371"
+	.ascii	"\020\037\341-H\347\314\267\276\306\034\324=\3279+d;\215A'{c\324"
+	.ascii	"\217\325\264\bD\257w\332\254\265\036 \022\375b\241\027\n\013"
+	.ascii	"`\253C$H\367\327\004_S,;qQ\001"
+	.text
+	.section	.gnu.lto_printValuePointer.227.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\200\024\005Z"
+	.string	"\272\224\354 P0\320\312I\007\227\213\021\rk\210IhO\375\342\302(\223\243\231\247)\316\337\365\213\213G\277=x{\007\215\352\227\035\243"
+	.ascii	"UI\002{\240vU\302q\255\013P\312\346\347\305\271\346\001\n\310"
+	.ascii	"7\226\177YJ\363\037\013u\335\320\262\262\226\020\"e\222\001\366"
+	.ascii	"\001\313\001\b\002&/0\2107\350\307\373Cy}&/z\362\236>^\023\345"
+	.ascii	"\355\223\227O\336\343\370\030?Q\236\240U\351:l\025\311^\240\272"
+	.ascii	"<\325\240\035\356\217\373\337\37617w\277{3\3733G\263\301\270"
+	.ascii	"]cV\267\027YN\300Rk2\306\357'\334\256)r\261\325\260\340\030X"
+	.ascii	"\0335?\265&[\224\331\340\317\2671hv\004\354U\330\273m0\314\305"
+	.ascii	"\244\037\263k~\307\344\357-\356\312]\255U\304\317"
+	.string	"\025\340\367\263hrpwM\336=q\225>\005\r\316\346\324d\251\326\346\212\3316\217\022Q\345j\373\002q\336\275\332\277\244_\333\340E\265N\261\203\246V\266\021\033\365\373\271lOB\177\376~\204\376\334t\327\356le\325\207f\346\025\306O\255\325\252E\330\357\335d\373\n9=\210))c\324\007\017P\305''bS\007\246%%\016\033\222\220\216\214\212\210\206\206B\302 0\350\347CO\263\2518\335\373V\264\335\203ro\253\316[\330\361 \246\244\316\334\bw\206\243>x(\363\306P\305\2702n\374\344\344[Al\372\242\306\035\274\2541S\334\227N@\323\205\225\332\234C\0334\3360\227<3\213i\3118N2\241\314\b\214d\206\f\230+m\316\243'F\312\"#D&\210d\031*s\003\320\002\351\021Kb\345\303*fe \\,\031\005\005\256\251\262f\241\304\222VP!\323\327\205\344\354s\3116f"
+	.string	"\177\356\324\334\355\f\026\266\305B*I\236<\b%\226\304\311\201f\210\2734|>\227tb&!9\373zZ\262\t\007\315\371\271\361\231A\207\300d9\357vS\r 4jxbI\230\334\274XR\351\205\354B\205t\2644\001\206q\235\375!ONe\206\210\022\247\203\317%\241\230I.\214\335y\333\241\322\222n\230}+j\255\313_aI\276!\276\333#v\227\203\335\242.\001mt='\352\"\242\376\236\2741.|(\007\3057\304g\330C4\344H\301\354@\177\016\205\235\325B\374\205\203\006[\330G\246\005\373|\002\311\315\371PN\t\n\274\013j \036\037,~\240?\203|\235\325?_\177\006@}\340|8\007\357tb\264O\3462\300 \326\325\212\374\227\001?$\002S2\022\340\177m\261\253\217{6\332\f\347\2457\344uBf\354-@\177\236}\260&\335Ym\366\221$l\361\336^u\367\367"
+	.ascii	"\212\363\322\273\233;\305Y\0369o\341\204\221 \305l\262\303\260"
+	.ascii	"\247c\302\231\333\323\365\031\271\375\222\311"
+	.string	"\304\331\313\371\251\206\245J\251Tov\327\356W\353\361Q\226\277*\2223,\265V\252\2372L/R\220\254\267\276\023Qn\031l\270\357\366)\257\026\360z\f\233\256d7\331\376\001\224\375\231C\325S\226\355DTE\277\355\277\2716;\\\374g\277<\021}\253\350e/\345\326\322\370\n5~\265ra\355\325\244\\\r\374\256l\200\376|\023\277\\\211\362em\b\357\355\262\035\271\311v\17725u\177\266\247\354\332x\n\377\214\223W\306\311\013\343\205\213\026\177\373\262\370\333w\305\331\376\254\223W\305\327\376\002\222x\001\370\333\027\353c\276WG\274)\220xQ\230\274'L^\023&o\211\223\327\352\210\227\204\021\357\b o\025\220W\204\021o\b\223\227\352\344\005Q\304;e\362J\231\274F\"\336(\"\336\017D\274\036\206\274PB\336b\020\357\323\311\353d\362\022O\336&\223\267\203\311\313t\362.\021\361*\r\361r"
+	.string	"\362n"
+	.ascii	"\362&\231\274HC\336#!^# o\021\220\227\310\344\035\022\362\016"
+	.ascii	"\203\274B@^!\2207\030Gs#\2679\274%\262\217C.\3121\245\250-)\b"
+	.ascii	"Ou!\374\220\017p\335\234\334\262\253\217\207r,\201C\223\255\006"
+	.ascii	"\350\214\036\300\210\025\024h\240\213\201\213\377\300\201a\312"
+	.ascii	"\206&\333\250\376\320O\033\343,)\331\025\226\021Q}\026\224-t"
+	.ascii	"Ys\342\017}3|\206\325\037\0328\366%\347\245\347\343\362F&\351"
+	.ascii	"0\372<\206\261\322f\207C\270P\314\222$\336]\222\335\334\035\244"
+	.ascii	"&[T\t\025\243\025\215\206\321)b\321h\030\025\242\026\375=:C."
+	.ascii	"\372#\354\235\r_\264\017\315\316+NH\304\261\032\254\312\262\225"
+	.ascii	"zG\204\345\262\345\221:5\023\246,\223\025\273\332\310\235\232"
+	.ascii	"\tb\313afR\370\253V\025-\024\263\244\342\335\361\221\237\363"
+	.ascii	"\230\034y\350\025ziM\275x\350\340X\0216J-FP\315\302OZ\323/P}"
+	.ascii	"<pRT\354\026\315r\322\232\202)vp\214H\007\277\333\234\022\242"
+	.ascii	"\247v\201'\255,\236\032\202\275>I.\224\0034\324/\232\345\244"
+	.ascii	"u\306\317\251!\330c\003\326\204\221\374i\006\243'\"\270\0316"
+	.ascii	"\3312\223=\035&\037\354\351\216,\331//\245f)\302J\3628\271\034"
+	.ascii	"\266x\314\301\376\312j\262\262\301\350\227\371\215\310\351Yz"
+	.ascii	"\261\336\276\315\3370\360\230\331=\021j\262\035\372\n\332\350"
+	.ascii	"\263\n\225\210_5\030\261o\327\324D#5\254\300\322-U_QMme\2666"
+	.ascii	"\204\367n\326Z\253\360Wm\243\177\367\247\016\007\253\370d\230"
+	.ascii	"HjF,K\255\374\220\fL\215\220\242!\311\255Yr\365\361\036\240\361"
+	.ascii	"a\002\274\352\016}"
+	.string	"\261\2669$\316\324\035\372\254\001\031e\251\231\372Y\270\253\306T\331\246Z\230+\335\022U\226r\341\255\264\313\317\246\262\245\016\252\263GJ\220R\237\f\037\025\330\353-\220z\271\201\376Tj\206\333\320Y\315\301L\352\rI}>yy^\370P\216\313\017\t\320Q#\371\201 \375\242\003\375yT\324Y\001\233\303X,\240x\201\261(\200\0012b(@\303E\361\005\f\007\026x\200\001\006h\270`\332\021\274\027\030{c\304\240a\256\0024\2129\214E\337\0061\026K\024\321\255\342\rb\354\315al\037;zt\0067z\364\271\343<x\004\231\300\004\242\003\003\037;~,\240#\b\217\033B\204@n\b\351\305Ab\007\017\034V>v\334\350a\205\003\310\005V$\222\366G\005:\200Xa\360\343\007\020\253`}Oi\373\211\320\345-\207\364\3262\b\337\025G\316\263c\004D\n;\255:v~H\f\246\264dH`"
+	.ascii	")\310>\342a\031\264\362R\364\371(\363\360\326\016\340]-=Z4\340"
+	.ascii	"\330\263\334\"*\317\230L5\331\366\033\343r]j\3660u\026L\375\354"
+	.ascii	"7QY\r@\203\001@\007\006\207\036\246T\223\261\361Z5\240(ZH[\f"
+	.ascii	"<\227V\255\032l\240?Q\264\023\035\007y\300\232\230\375ntn\226"
+	.ascii	"QK\255>D-\274\037\222\202\025>\334\f\313\311\341F\007\006\330"
+	.ascii	"'K\t\036D\374D\fU7\321'\372^\312\022\215\325&\232\341\220zV]"
+	.ascii	"\242\017\210\337\324\250\252s\023e\325OS\346\351B\345B1N\320"
+	.ascii	"\340\335A\221\350\"\267\220N\321\312K\217\350O\022U\035\242G"
+	.ascii	"\374Dt\025V\213\350%\030\264\366x\205\364x1uj\322\256\251\262"
+	.ascii	"4!\032m\242\274\323emH\221\nDSmq\\\215\213)\303\302g\322.\251"
+	.ascii	"\272Z\271\0020\303p\251\227\271i\221\257\237\373\024\f\375\t"
+	.ascii	"\242/\306\354\b\277\245H\b"
+	.ascii	"\bc2\251\222\024unUuS\375;e\035\274\265\261\277\314\213\334\350"
+	.ascii	"\240,\237\234x\213\226%Q\252\215l\351\222\017~\310\b\350\226"
+	.ascii	",\221\3124\263\246&\343\264\247\205\320pt\212t\220j>k\213\003"
+	.ascii	"w\251&aG\311\004W\305\262\036\367\337\245\300{>'f\222,a\265\361"
+	.ascii	"q7v\006J9<%V?\r{\221 \020\n~\232\237y\232\243Y\026\276\n\350"
+	.ascii	"\335\324I\n%\201\220\250a"
+	.string	"@\002\225cdFDD$I\222\264\006\241\005\304\030\306\030\263;\022\200S=\211\224\016\"\032\222$%5\352t\347'\345>\323\237q\270kJ\032\244>\333\t\357\217G\2670\224Mj\rF\3057\347p\031\220\233\274|\\\277\n\351\023\322\240\264\205\270\247\315'\220\353\276\243&<`}\202\\\020y\354R\257\f\234\237\303\224'\2219\221\344Y\341\340\262\375-\315\354\246\327\025\254V\261gc\302\"\362\340\fT\217\027.\227\2752\311\310a\377p\317o\337\211\333\324r\240\230\027|\253\f\312\005\307\206\300\345o\374\321\226\312'7\035\033W\371\232eU\t6_~\325w3\356}^AK\357\213c]Z[f\274\345\230>b\2043n\340\206=y\233\3033\311xx\215]VV\246N\264\345s%\234O\3124s\336:iFb\017;\323<6xNV\023\262\214q\300uA\301\315\263\202o/\343q\342u"
+	.string	"a\303\362\240\202]in\357z\037&\023\351^^q\032\326\023\026\331\340O\032\245\276I\217\334\3007\037\222\313]8\230\301\2473\005Y\227\363a\003\376\255\002\360T\324\211Mtm\335\275\236l\320\305\211LI\304\031\275\t.@\005\031\245\177d5}\361\357\216\212\301\370\363.\324\205\030\300#\214!\317\237O\331\0137\242H\335w\245SA\260\373\n\203E\240\302?"
+	.ascii	"\030cYbN=M\376\005\225EJ\222\370\305\366\200f\022\301"
+	.string	"7-\2322\023\315\364\203\222\314wX\240\005m|\332F%D0\316\020\361\371;\236U'\206\277\207\260\211\301\306\005\257\254\035\326\200\247\207T\221\202\357\017\262\310\b>D\263b8\241\366*\234(2C\273\315\336\275\2016\246h$\271\246l\025\037c\322\212\036\316\265\201\021\314\335\2461AQ\362\204N>\276\320\344Z \344\361\320n\345\207i\217s\t\321\200\221\244\277\r!\001p\r#qc\204,\t\324\"\036'\255\225bbfnAr\211\376\234\213\2110\303\376\210\255Q$2[\216b'\nN\310\214\001\022e\231\361\024L;\275\366\376\234\235\247L.\210\246mX\247\026^\234X\274\332\351\315:#\033\221Dc\034\305\177\277i\360x\301T\t\224^b\357z0R\035\304v\302\225K|\317Q*.\245m0i\270\032\326\230b\276\\\325\374s~to\223\354'\0179\n\360\025\275\345#z\274\020\312\204"
+	.ascii	"\375g\016s.\306Q]2\271\231\276\316\013q\377w\232\034\003\321"
+	.ascii	"\202\231\261o\254\360\002\240\220[\003N\024\233^ W\272SIF\357"
+	.ascii	"\240\265\032h\234q6\243&y\274\231\341%\202\247\305\303bs\206"
+	.ascii	"~>\036-6\013\200A\245 \004\201'p\234\323\233 u\244\033G\032\316"
+	.ascii	"\220\342\301\266B\255\346;\037F\r\376\261\277\030\231\230shc"
+	.ascii	"\340e\273\025\224\255\006"
+	.text
+	.section	.gnu.lto_valuePtrEqualsDefault.228.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`I\f\2459"
+	.ascii	"\252d\004\026AP\244N\007\335\311\017}\005y\275b!\2030\312\321"
+	.ascii	"\227\252\361\255\rZ5r\354<\206\bMY\211\360\212\242^\202Q\025"
+	.ascii	"D\224\002\200\210L\327\317|\362\331\027\230af\232Y]\324D\204"
+	.ascii	"\310\275SJ)Z\001.\001J\001c\352e\273\037\207-\r\335\225{\247"
+	.ascii	"\033\362\270\257\257\332\355\033r\244:\002\357\275\021\212\275"
+	.ascii	"vi/b\215G\003\312lz\323\210wl\200tU\275\362\203b\257P*\227'\316"
+	.ascii	"\237\362\236%\242kv\267c\312\235\271\351\272N\254\355j\364\362"
+	.ascii	"^8<d\356\235\036\340\001\305^y\332H\266\327b\033\331^\0254\020"
+	.ascii	"\343\261\24532A\004R\034P/\200\356\235^}\022\356\303V\247\315"
+	.ascii	"M\037\353\247\246S\023\023sI)\t\351\310\250hI4\244\024J\"\217"
+	.ascii	"\306\"\321\256\352\373\0307qK\2575\224\rq\223#\215\254\237T\342"
+	.ascii	"Y\217'\r'j\247b\025\006\232i>\2507\221\250\325\265\323\226&-"
+	.ascii	"\315\224E\2133\263`\361%:%(\235\364\004\212#=q\342GX\214\230"
+	.ascii	"t\321\022&\276\\\242\304\211T\251\023)CEZ9\027-\342BnD<Y\354"
+	.ascii	"#U\"\370\246F\327H\216zS\023\322\307\271\250\0207\302\211\006"
+	.ascii	"Q\241\242\346\242m^\274\322DnH\277E\331\354\261oI\037G\275E\351"
+	.ascii	",\221\270u\357m\276\026!%\"\370\246V\327v\255\327\347\231\253"
+	.ascii	"?\372U\003nl~(\323\314T\2447G\360\264^;ZZ\231;q\353\336\313\236"
+	.ascii	"#M\255\031@3\373\nf\006\301||\006mb\260\030\3718\023\364\323"
+	.ascii	"nZ\006\337z]\204sW\307\314\013\271\375\272i\373\031<;\224\255"
+	.ascii	"\214It\231\022\305{\315\034p\223\031\213\232(6\351\225\273\206"
+	.ascii	"\355\265?\253\355\013\241\235\r?d\236\222\371\30717\226\\\241"
+	.ascii	"!?\034\263\205\n[\024&H\210\320\\\272\265z\332\235\005\001\253"
+	.ascii	"\355\272\037\254\316\rVg\006\326y\201uV`\235\023Xg\004\326\371"
+	.ascii	"\252\367\232\255\032\257\371@\3475;\253:L\263\001\2433\225\321"
+	.ascii	"y\312\350\\`\351L\300\350,\265t\036\220t\026\220t\016@\344\034"
+	.ascii	"5\344\fE\344\f`\310\371)\351\334L:;\031\235\233\214\316LJg\246"
+	.ascii	"\322yI\310YI\351\234$\344\214\224t>J:\033!\235\213\216\316K\244"
+	.ascii	"3\321\321y\210\350\2544:\013\031\235\223\2533ru>\026\235\215"
+	.ascii	"\253s\261\350L$:[\353\274Zguu\376\325\331W\347\276\300\374+\213"
+	.ascii	"\323E\232\343\351Lo\217C\303\353\267\232\201\322{\335x\335y\335"
+	.ascii	"aZen\346\026\303\315\307\310=\356k\003\244\003\364\241\330k3"
+	.ascii	"\213q\177i0\255\307H\3560\001\032\212\264~\371\3149\203)4\264"
+	.ascii	"\260\275\022)?\353\207\224\277\n\022\372\270=-\215\323\235\367"
+	.ascii	"\207&\371q\354\307\252&\2521:\373\352\352+\274\317\261\310\217"
+	.ascii	"S\261\n\003\313\034\037\216\206\025\372\366s\340\223/\364\re"
+	.ascii	"C~\362\033:\350\370\305G>1\017t\315\353\250\365\306o\362\362"
+	.ascii	"\234\322\20206\024\271\277l\257\305o\264 6\374\220\355"
+	.string	"g=\361\3739\305\352\355\333\275\2262\324C3\366\230\255zb\231\275#wvV\330\371\221\271 \326#\\[+~\034w\036n=j\235\035\356;\237\205\0167\240C\221\303=\247\231D\271F\336p\303a=\305{\311\332\215\273i\305\214\\i\221(\367^\252v\303\314z\272\335XOQ\356F\357\364R\365\332\340\233\257\227y\177u~P\037\304\304\006\377\005\315Y\032\361\343\330J\253\254\020\336J9\243\016\035\036\036\036\366\224=\360hl\327\207\360=\250\276\263\327\367\276\247a\231\037\362\277\372\315\241\327\224\030 \247\306I\356\277\243m{\204\353\307\261\322S\312\343\261>\211'\205\317\235\355|4\277'\023sG\365\307z\037\204\016\262\321\241\321\224p\002\262\207>\003B\n0D\367\215\350\265\t\350\337s\001,:\314KF\214.0\033\366B\306\327\205\260\027].\272\274\272\222-bp\271P\303\274dp\255\350\302"
+	.string	"\026\006\343\b\026\006\343\301\270f<\253\260b\341\245\342\352\005\013.\027W*\300b\\Y!\361\027\214.\260\253\260\257/\260+\344\rl\265Y\365\021\",\375\350"
+	.string	"\361\263\361e\201O\037\307\310\034N\026\036\220\224\bt\214\255j\253Gc\325\311\200\034)\032t\214m4\253w\376*(\346\317]\0333/l\365\336{\233V\376\232$\274\265REi\302[+O#\no\251\340\rm\365\332\223\n\017d\205g\225X\365\006\234m\365\026>\251\254m\317\323\255M\267\013\3623'&\246\263\027,x\tMLTSOU\340\245~j\216F\001\255'\340w\254\n\r\024\266W)\001\237\365\003\324"
+	.string	"/ "
+	.string	"3\020\236@KIH\316V\240\340'(%E="
+	.string	"\3031\273\013QZ\017\365\314AC\013\027\270l\257"
+	.ascii	"\232\237\365O\375\247\235\276\351\364\326\013\322\236:\203GE"
+	.ascii	"Kg'H\360\024\214\212\036\216O71}\023\363\231\226>\351\231O\034"
+	.ascii	"$\374\220aI\353\225\276\251\217PD\206.\333k\322\321g=\2227\257"
+	.ascii	"\261F\177\364\375\2343z\333\267\214\363\347\206H)\344l\004\b"
+	.ascii	"~k\350\343T\nf`\256(\037\216\213\236\350D\200\370\250QD#\031"
+	.ascii	"S##\"A$I\2224\006\360\002\021\031\252\315\001\021 %cZ\325\202"
+	.ascii	"\246\320\030/`\357\214\030S G\251\025\253K\365I%\373\365R\217"
+	.ascii	"\336\262\370#o\243\342.w\242|2O\344\323oC\324:\254#\234P \212"
+	.ascii	"\357\301sM\201{\177\353\3662\026\312\357a.\256N\366k\021\264"
+	.ascii	"\224\037\2102 \206\022@\025{\n\220\336-B\377\257\342\251Al\004"
+	.ascii	"\303\025\b\315\372\247\330\220\242\336\002\251\242\366\306\037"
+	.ascii	"\020%Em\227\214\203~I\2342\224f;E"
+	.string	"/)\350*8%j`\246\200eE\313\022oV}W\361\261\377\314e\373/\321\375`\337\377\337\035\376\345\372?@9\274b\2271\203)\200G\234(\334h/eI|\213r\340\256\273R#\206 \242\275\265\333da\b\335l\030\234\035&\262K9\r[c\357U\343o\326\330\373\251\026\317+\n\033\376\002!\030c\005\204\340\222\240:\236z\326\363B3s4\343\031\365@\347\343O\330\344Z\236\221\343`\200\276\201\033\274\207\370\006\300\371qW\t\200\021\332+o}8\346l\355\374\201\323:\b2\335.\3514\202\251\351[\2332(\220cL\265\266\230\207zE\276\336\353\266\t\212\251\353qU\314P\212\271+mPV\232\203\255-\332`%\023\301\"4\002\216\377\206\004Ql\223\377\317\257\365MRY\241\005\346\203B\222\037\306J\322\220\"I\357\fde\302\245\310\350Hda2 \033\001\207`\355\004UO\257"
+	.ascii	"\356\271\036t\220\312\314)\031I\023e\033\306T]Q\364\246\230G"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_cliPrintSectionHeading.229.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`e\001\325\017"
+	.string	"6]lH\320\322(\035bA\021!Gp\333:\211^\033\020I\n\374\302\261\n\0320C\r\nB\372\2673K\025\335T?\352\277\210\233\366\367\366\023f\235v\342\001\372\301@#\034\322A\252\344\023\324\300) &\220e\223\270\367\3362\245Y"
+	.string	"X"
+	.string	"S"
+	.string	"\341\347\360&\364\323{"
+	.string	"\372\031A<v:e\334\230/;e\300aGM\020\017\250\341S\222N\204(\002\260#\243&\345\202 7h\220\2004Ie\036nF`m\243\034\271\030\302\221\200\025$\002\0230/\256\363\225\001g\273!)\265Vo\f\210\341\016\271\355\224\355\006\366E\004\247\334\314\005\360\035v\265\316\354\200T\240\031c\204m\230=\262\355}NL@I\245\341\244\360Q \327>\220"
+	.string	"v\235\313\303\001\267\034\271\037\222\367\351]\373*\276\002\366\220\202Ej\245\341\341SkHr\001\357\223\200\264\355\243x\016\346X\204\251\275\320\030\300\301\260\351\374\2505-\202p@\264(\3633\360l\320M\027J\343\022\341\354\026\355\206~\344\t}|\t\034\241\222\237\320\031\037\245\r\333m\266\273\307\032\0229B\3211*\343\315\202\017Y\017\034:hKd\207\262\2157\366e\255\265:\332\330\327\375\364\341?\237\363K\257w\256/\022,\027\204S\n\245RZ\2110r*\2618p\275V\256\227jDB\253\364`\325\362R\361lBA\261\230\276\024\252\324\362\231X\255\017\305\304\252\325\n\353s\251T\254o\024\326G\033\357\312\370\017\270\032\266\036)\343u\356\001\301\315\330\351\231g\361\2152\321)/qF\275\225\321\236\320\332\307\370\001\034"
+	.ascii	"\3571\330\020Z\260\016\251[\200\033[\261\016\315\300*B\325\260"
+	.ascii	"`\027\330\"UqY\305\002QI\343v\021\304\320\n\252]\003\t6\2341"
+	.ascii	"$\202\276}\256%\240\344\301]R\332 \026:0\241\353Q\233C\255\363"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_backupPgConfig.230.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\225\t"
+	.string	"\266\022B7Pu\206\003#\n(\372k\204\331\323\310\301n\306\200\222Xg2\272\021^\201\260m\333\3361Z\333Z\333\340p33G8\002\355\277\210P\001\235\301c\333\275\267\224)\0051"
+	.string	"0"
+	.string	"3"
+	.string	"\343?\3335\356\006\3335\203\266\315\201\306\206\f&0\225\013\316\356v:r\360\t\372Wy\300\212\025>\001\036v\327\271bu\334z\333\t\266\027\354;\004-\373\342\277e\351,K\253\2463\323\347\004rjX\007\201\331\345\210\351\354K\223)\361\330~\332Gy\nx\021\365\202\335\026,fw\004Y\201\273\346\177\311\224\300%\226\336\342\251\"\270\256\251 \325\216+\316r\342v3\032\374\225\357\202#\271\346\243\266k\327\177x\334\234\210\251\214\331c\230*b?\333\335\265\006#SZ\024\"M\210:\n\022D\251\023}\247.\364\261g\212\370:\013\317\373:\317\270\317V[\346hf^)\305\360@\246\252fj\217H\371\225=!\033\032\332\226\b\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_restorePgConfig.231.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\225\t"
+	.string	"\266\022B7@\223\206\003\270\327L\201"
+	.string	"k9LQ\237\335\262dY&u\002~\027\222\325\177\262\255\327`,c!\033Y\315Q\024\003\034\231\357\342\022\244\370&\001g\327\275\267\224)\0051"
+	.string	"0"
+	.string	"3"
+	.string	"\343=\3335\356\006\3335\203v\315\201\306\206\f(4\251\227\233\335\355\224\344\340\023\364\277\362"
+	.string	"\325*|\002<\354\256S\265\362\270\365\266\023l/\330w\b,\373\342\277e\351,K\253\2463\323\347\004`\034\253\207\274v;b9\333\322dN:\266\237\366S\256\002^<\275`\227\345\212\331\035?V\340\2569\207\311\224\240D$\335\305SEp]S?)\230+\336b\342v3\032|\226\357\2023\271\346\237\266k\327\203|\274pDT\306\3541L\035\261\237\355\356Z\003\242R:\004\032M\204:\212\021\004\251\013}\246\016\344\261W\212\370:\013\317\373\272\316\270\317VY\346flZ(\305\360@\246\252fj\213Fy\225;\"\033\032\332\226\b\017"
+	.ascii	"\357b\310\304S\274h\304\005\204\250\364\300\220\237r\202U3\232"
+	.ascii	"\312\302f\30280\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_backupConfigs.232.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\206\001\235\017"
+	.string	"\266\034hG\360\260(\0352\322\302l\\\350\007>\237\254R\013pT<C\301\271\350E\275\337\3358`\241/\227\331ief-\372S\213\020\267"
+	.string	"\262\214\\[\236\201g\340)\220\025\357G\325)=\260\362\256v\275'\204\354-eJ\001S"
+	.string	"T"
+	.string	"R"
+	.string	"sv\033\302\332\253\205\346\306\253\205\006\307#xG-]\223q7-\371\237\351\332\206\313\270\245X$>\276T\034\tg6\007O\032\003\230h}\271\326\267\210\300\005\247\365\361\255DP\r\020:\016\273\262|*\325\215d\316i]}\031n\356\266[\266C\354\203\001&]\327\215\210\233\021\336\027\373\261\330\255\252>"
+	.ascii	"\b\036X\030\276\177\2401'\253\207g\346H\233\022\217\335~\n\037"
+	.ascii	"\364\307\227\271\212\322c\026\004L\033\363\037\017\212\013\263"
+	.ascii	"9\301\004\2276\300]\032<H\273\344\016\242]\376\343\222\275\203"
+	.ascii	"@j\232\024\274\302\025\026;3\321\007\016\242\351r[\"\203\251"
+	.ascii	"Q\2358i\2177\325\265Q(\350W>\370\0013:\032rPkZ\203\246\257\013"
+	.ascii	"\031\251o\327\345\177\004&\234m\373b\222\366m \323Aih\177\305"
+	.ascii	"e$?\306\025R\364\253K?e\017{\201\257f\346\"\303AE{l0\017N\324"
+	.ascii	"!\021Q\204P'A\304\300\244\013\215P:\021\220\275\023\007\243n"
+	.ascii	"\202\347\215\272\0178O\242\262'm]'i1\016{\234\321\241\305\016"
+	.ascii	"\017\271./\320Yn\267p\263\310\013\311\241\313\002\303\343\346"
+	.ascii	"T\315\374EI|\314\245M<\315\323.u\267\207\f\007\245\341\343\234"
+	.ascii	"s\006  P\0022U\324\003\257\030\362\320\364!\300D\210Cv,\266\331"
+	.ascii	"\272T\370u%\230Y[\224\030\204\230B\032\276\302G\035%,\b\346\202"
+	.ascii	"\311\030\033\2541\256fL)$\262\nI8\364q\305\313\214\262;\374\214"
+	.ascii	"\267\221=\256\360p\r\367\321\030\340\036"
+	.text
+	.section	.gnu.lto_restoreConfigs.233.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\325\n"
+	.string	"\266\024L?0O5\034 \344@=\242\333\036J\277\303\2441B\216u=\237\023\223\220@\300\371\233\0353?\331\226\033\203K\303\372\267\00772\"b \024J\032\253\242\013p\n\201By\254\266\355-eJ\001;"
+	.string	":"
+	.string	"9"
+	.string	"\032\020\026\024\220\"I\b\321bw;\265\360\345wM\363\363/D\360Zdt\325"
+	.string	"\230J\2148\361\243INTXq\3253$\2022!\225\335u\206\"\205{\273m\002\266;\354O\002>$\001\tQH<\006\327\256h&[\023\233\b\016g\335\276\007\1774\347\257\376\341;\353\001\306\242\330\213\262\224\t\266;\006\370f\216\3107\217\227<\276E\236\361\370v\316\237\315\"\n\336#\370\001\027b0U\224;\217\253\201\226\nP\306\354\203x\253\343o\260\003N>\374\346s\364\252o\210#R\230V$O\316\354\021LE\2752\2744XO\366Y\267f\006\b2i\013\345\242\300\322-\270\024\300t\026\315\246\243H\354e\016h:\006\236\247\351\270q\257'W<\372\321\024\345\217\237\304\322\030\357\245\222\253\303n\204\207\252\023lH\332\233\006\371\320\032\017"
+	.ascii	"\357b\314\fM\3478\374>\323c\357\0016\331\301\004\3532\016P\205"
+	.ascii	"\326\205$.\364\313\025\343\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_getPidProfileIndexToUse.236.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"]\n"
+	.string	"\246\323G< \345*\035\207\207Q\304"
+	.string	"\261D\024"
+	.string	"\022 3\177\0227\n\016De\001\357X\0220s}\373I\266)\337\233\027\362d\020\002\001\030\020a\021^WqK\004\033\262\361<\371{K)S6"
+	.string	"5"
+	.string	"8"
+	.string	"\373\355\224\315\337we\233Q\311\030[B\021\334\331Z\031 \266\266e\202\352\2061 \246\344\006\267ZY\3312KD1w\013\265\326s(Z\3541\373\237\341\177\301\277\034?\r\344\216\375+k\303\376\363\273\363\347\371\314\374\315\b\200\220\210;\326j\255\310\001\250(\323d\374o\3725GP0\375\343\250@\227N\307\313j\344V+\215\266F9n\327\030\222\"3\374K\214x\303\256\227\343\205jp_+\231\275\272c\337\2220\333\033\017\021[\212q\377~\354\214\364\3358E\2117\334\371-avn\033\330\\'\316\005\367<\037\220G? \217B|\032\036\250'\032Q\017\301C\021\016\":\021\n\211\250\206VW\326\206\375\340D\316\326\\t\327\334\254\377\334\235S\243\344\354X\317\346\260\254\002\2348\017"
+	.ascii	"s\2046a\303\360\243\\\313\304\004\001\021=+\204\305\340C\333"
+	.ascii	".\214\351\230\351=X\006\256=A\211\377T\215\032\227\202\002"
+	.text
+	.section	.gnu.lto_getRateProfileIndexToUse.237.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"u\n"
+	.string	"\326SI@0\211*\035\264\253\336\357\211F\205\371\0240\351\220*\2754V\020^\214\234\252Z\312\230\264@:\324\266F\262\n\341\367\230b\214\323\270Q\031\030`(\345[\2534\322gq\354\002z'\177o)S\n6"
+	.string	"7"
+	.string	"7"
+	.string	""
+	.string	"\356]\306U\317\277\353\023Y\254\305"
+	.string	"\f\277\313\323#Cx\372F\fi6\342\020\216b\205V\202p\327\325\024\212T7\2139\247\025\fEn\311m_\330\226\260\257\001\260Owe?\3169\247We[\275Y-\255VU\177\322\360`B\370V\2029Cj\026f\003\271\200e\033dSLQ\001\262\007A\372(X\n\200\224\020\314\346\204q\033\272(\326\001\007q\242vGG\017n{\002)\321~\267L\301+\265\273\362\356\221|+\264X\204\221\322\354\033\370\313\343\017\360\307G\017^\372\037\311\345w\""
+	.string	"*\2445;\356.\031M\307e4\035\267\221\301\320\340:N\207\273<x\303\221\301\341<6\033\016G\201\315\307\271*c$D\271\024\001\273\255\256\311\266\256%\264\242(\277r#*\224.\204\264\026\016"
+	.ascii	"s\2046a\303\360C\t\237\227\200\025D;\b\261b\360A\354r\315\336"
+	.ascii	"Cd\340\356\t\252\375\247t\324h\025\024"
+	.text
+	.section	.gnu.lto_getValueOffset.238.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\217\002u\022"
+	.string	"\306\342tE"
+	.string	"\317&\035\347>\210\311\n\242\226\004\255\0039\370\226\237\207w\315\341\377H \007\266\354\320v\355^Gx\320\006\251\023AN\356\376 2*hT\273\253B(\304\036\343&\201\361\324\023n\356\332\006\244\355\275\245L)b"
+	.string	"Y"
+	.string	"d"
+	.ascii	"9\007\261\362N\345\002vg\204\200v\273\004\336\330\016\335m\266"
+	.ascii	"\375\017\307Y1\213\303\205\205e\343\206\302\213\b\030\273]\n"
+	.ascii	"u\215x\230\037\020\017u\303Y\217\360i\262|\356\221\301\316\254"
+	.ascii	"\0067\230\277\353|\201\206Y\213\027\f\346\352\322\322\212\250"
+	.ascii	"\335%\301\\/G\037\273\353|\301,\334\243\333F\261\335a\347\213"
+	.ascii	"\352|\211i\031\302C\240l\273-\n\374\235\006)\033\207C_%\036^"
+	.ascii	"\257\363\267B\246g\226\303\2225\273\343Ri\354\277\325\031[\323"
+	.ascii	"'\247MN\227\336\375$\247\267\227\036\275t\3244|\351\367\322\251"
+	.ascii	"\351\243LB=\260{\250\355V\250\311\330 \230\242\203\355\025\033"
+	.ascii	"\200\355L\373\001\312\261x\n\"\363\203\342&8\260\224$\265G\034"
+	.ascii	"\344_\251O9\377\3049h\263\2474.\271\212\225IAd|b\234\304Ml\202"
+	.ascii	"\270\234q5\217i\005|bv\271\377\370@\250X\217\357\263a\250YY\t"
+	.ascii	"\337\204i\333.\367\230\241lo.\324|\204m\332\037\263M\313\327"
+	.ascii	"v\034\236\020\310\\Yd\0027\020\257\247\")$!\022\240U\036#$\252"
+	.ascii	"\224\311HHIJu\202\222\362\320\360\352\201\310I*\302ju\222r\267"
+	.ascii	"\177\2533>\271\210b\351\263\342u\376\f\256\241\"X\322\303\360"
+	.ascii	"\f\345\250I7\235`{\323\324\226\317s\177\2748\322\247%U\"W\354"
+	.ascii	"\300Y1\352HG.\\6\255\254\031j\324\277\024\005H[%\222\177A\375"
+	.ascii	"\fY+5 \240\002\221\271\252\016\37610e\300\0202\244I\302f|\030"
+	.ascii	"\223(\256\316\207\016\255\375hk{\233\264:#\312\333-\264\017!"
+	.ascii	"^,q\250\027\214\333-\247`\016\013\202\325\034\311A'\230T\004"
+	.ascii	"\311{A\211w\177\345\305e\235E\212\nE\310#$\\\206\\\r\222\033"
+	.ascii	"\001\\\200\023v\300\366DC\212\210\205\026\357]Ai\260S\217!\362"
+	.ascii	"\206\013h\210\375\246|8\263.3d"
+	.text
+	.section	.gnu.lto_cliGetValuePointer.239.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\025\002\265\021"
+	.string	"\226\242vG\320VM:dm\210\201p7#Xb\005cV\342\260\0040\016ar\230\327\007[\306mW\322\216\020\253\rMz\203K\210\346\263l;\f\317\304\337\f\\\305"
+	.string	"\366\266\023\310\365\001\234\277ic\267>\215\020\262\267\224)\005`"
+	.string	"["
+	.string	"g"
+	.string	"\b\036}\300{\314\013\341\\\265\353s\344c\367[\261\001\357\321\266\037\364\0310;\211z\350\020;\261"
+	.string	"\350g\347\206\322\356\307\362\367\024\356\321\373\212{\324\025\207=BM\230\237\363\250A? "
+	.ascii	"\024AD\264\332\210+\2526\203*\273\373\333\223\247&\313\354Zv"
+	.ascii	"\327I\253\211\270\271\333v\261\275b\347N\266\227^yi\225)\235"
+	.ascii	"\372w\243.\364\243xiS\227\366`\272\343\322\\\227\2160\r\271\264"
+	.ascii	"\306t\302\364\007\004@\372P\273\f\244\335\020KMvH,j\361\357\267"
+	.ascii	"\357\333\370\220}r\315k8\201\315HiwO5\366\351\3616\314\277\371"
+	.ascii	"d\373\273\021\260E\366\265#@,\224\354~\001\023\"\334\250\215"
+	.ascii	"-H\356n\216z\206Ke\017\210#\"K\214 \231%\023\3739\256c\306\377"
+	.ascii	"\261\204\227<\355\205{L\351\207^\340\006D\251\004\215\236T\246"
+	.ascii	"\332-W\236\206R\225\231\346\370\232\252Nv\236\270\302\211b\274"
+	.ascii	"\335\231\002\037\007\005\013\336\317\243\217\303=^\177{\204a"
+	.ascii	"3\212!\024\313%\373\223\245\246\260\017W}\002-\327K]\033d`8D"
+	.ascii	"\267XbdZ\254\013103\254\326+\003\213%\3054\030\\/\226\006\032"
+	.ascii	"\232\027\353\364\305\016W}\314%\251\200*\006I:\272R\223\362\330"
+	.ascii	"6\251[b*\213\236r\252\352\324\353\364.\032\274\210S\033\233\020"
+	.ascii	"\030Uu\245\271C\347\205,\227\f5\352\t$\212\332\016\\\3624\250"
+	.ascii	"'a\302~\360\036\020x\004$ \200\002\031*\253\003_\f\200\342\235"
+	.ascii	"-\342\372\203\375j\205M\257\215\023a6D\022]\263\350\233\265\002"
+	.ascii	"\202E\026>\273\213V\214f\211\2676\261+\204\215o\333\360\320\200"
+	.ascii	"\316\f\20368\253\027\366\030Y\235Ydc\303\023\022#\203\034o6\200"
+	.ascii	"\227\003\237\013\2328\320\316&\3402"
+	.text
+	.section	.gnu.lto_dumpPgValue.240.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\313\004\265\036"
+	.string	"Vx\306I\220\332M:\004H0\332\305q\324g\\7G\002$\230\367<\360~cb\306"
+	.string	"=\236\"(\363\362\314=\365os\023\006\326D:\300\215\213D\202\246\\\210sM\002g\334(\212\305y@\212\356\320\017=\331F\b!DJ\231\002\263"
+	.string	"\235"
+	.string	"\263"
+	.ascii	"6,/\242\207C\220\340\264b5p<b\2152\277\f\267x-X\362\026\302\322"
+	.ascii	"\237[\365\201uEh\3426qZ'6\306[\365a\351Pp.\211\033\317\274_7"
+	.ascii	"\226\247\326\2542+\265\022\033\234\300\271\344\377o\327z9=m\034"
+	.ascii	"PO?\036(\371\002>iS+1w\342\372\224K\236\013\240\\\262\201l\272"
+	.ascii	"\247Y\222cs\3725\2116\364\230@\t\ny{\232D?\246\250\326\344\261"
+	.ascii	"\345\250\300\314\2255\250\0208\372D\021\t\332\204?&\201\250\020"
+	.ascii	"\212\307#RT>n\233\2607\342j\255\033e9\207\320\307l\022\325Z\317"
+	.ascii	"A\341\324\236\266\377\245\376\357\376QJ\334\177\n\025\274\301"
+	.ascii	"\237\306\371\232\367m\356V\003\214s\335R):k\365M\370N\031\261"
+	.ascii	";\207,\371\275Q.\271\215^\221YU\r\277\236\370\354'\362\270\265"
+	.ascii	"\376\035kg\375\033\266\037\332\260]\241u\262\033\264"
+	.string	"b{\240\035\333\377\354\327n\200\032\277\347\344\363\234\177\253\361wN\276\355|\235\034~N\016\0375\3715\224O\253\361\317\223o\326\370%\215O\236\374\261\344\267\311\347\222\277\005\220\320D\355\020n\327Y\255Qgoj\221\304Rd\305v\307\226\177\247/\224\215r\364\377X\323X\251\210u*\247`\005\325\274\377\351p\271\244Ltz\223\370H\303u\201H\260\252l\255-\013\324\274d\211\265V\262\265\264lN+\201\225\341r\032\005\033\236\365X\243\004jN\002V\346c7\313\265V^#(\321^\0016\306\307n~[\004eP\243\215\366\206l\200T\002X\250k\035\324?\006\r\274\301\241.aE\353Z/0\016P\323z\261\206f\300\036B\\\366\331\034:\360\006\201\032\367k\336\3116\373\354\206\363\333\352}\330,f_\bB\366\330e\357o\253\307g\357&\273\341\204\330+\"\254\200 \321\324\022\274\220\221\361\341"
+	.ascii	"\375\2338\301\033\354n1fH\212=\034\265\343*\340\226\n\340\230"
+	.ascii	"vK\003P\027I\314t\324\244k\261\313\260t\244k\232\261\323Qb\""
+	.ascii	"\341B\206\021\013\335\356E\r\306\222\356CR\214&\026\347\256\351"
+	.ascii	"HG\203|\221\003\243\243\242\234\f#]\214\\\221\322R\316\201\317"
+	.ascii	"\221\222vJ9&$$\245\034J\254;\326\316\032\352"
+	.string	"-\232\235)>u\357,\366\360tOo\2251<Mk\322e\353\326\3370)\226yEV\324:\177(\"\200\271\365J\371X\303\325&\003\376\323 \251\220\022\216U\0333\275\346=\001/\330\235\264Hj\304\326;\275e~[\275\242\255u\256\272dU\r\277\f\260N\177\311R$4!\031\230*\257Z\177\033L\225\234\277\020\007R\256\264\2137\030V\250q,\242\220R\n\231\231\021\tf\264\226t\260\002\021\"\233\007\021\200\251\203\252LZ7\353\356\337\272\2549fBO\212\331\354@\373l\032\316S8g)\214X\376\235\263\303\244\301,\304c\322\307\205E\337@\r\022\232!M&\374Gq`\331V\302N\330\244z\255\254\005\020\266[|4\332\274\235c\222<):\004~\264\364\270\034\t\264\020\260<\033;\310@#\250Qc\207\316\003\217\220MD\306N\234\210^X\032qh3m\366.\214\001\336k\\\037\201"
+	.ascii	"Dr\356X\0027\332\331A>\2518\025{\363s\224\214\345\025\245\352"
+	.ascii	"\364\363\234s\337\005\262\r:\245\265\313\330\272N\005"
+	.text
+	.section	.gnu.lto_dumpAllValues.241.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`X\b\3052"
+	.string	"Z\\8\024C`\250Q\007\377u#\303 \365\033t H\314\025\222\037@\310Fs\305"
+	.string	"\250\256\375\030:(\264?\210\026\362\177G\202\\\037\270\372\337\316/\373\026\377x\373l\205\2726\304\227\254\033\341\356\032I\333[&\231R3\001$\0015\001\253\247\327\311x\231^\273\333l\n\347-g\316\362y\215\rJA\301B\353P\252a\321\231\211\250^P\347\227A9;\225<\355\017\335X\214\223\265>\206\307"
+	.string	"`6>\2774\350<m\247\356\235\016\246\3650>z\227sW\242\t:O\207\370\336n\377\342b\2557\177t\2323\223349;#\364\221\316S\240\013UO\257\027\251\236v\333\315g"
+	.string	"\220\\\254"
+	.string	"f\bI6(\347L|(\375\273\255\003\177>\266\267\362v\272\234\232\342\277m{\031\307^fkIe\321\2018\007\204H\025g\303\212\2023\024\212Ks4\253\373{\222\265\304}\t\330\334\206,aK?]Y\\\336[\257`-/\017\027\0359\273\003\341\016\026$~\005\013\311\335\261a%\321\341\npJ$\316\206\265\205W->w\374\n\326\221\233\303B\"U\222\316\206\245\004'\305\245\t\264*\221W]\225\307\233\342!\033\026\027\036\346\234W%\220\213q\022\327\233\">\245\021\013\351x\301y\232\337+\345\361\276\2439\2120!~\272\262\226\370\315m\3109\367M*\263\274\001x\267s\350\356\251\356\334VM\302\331J\250X\032/\3209\341_\226d\\\344\370\234'\325S\177\025K2BM\207\363\304"
+	.ascii	"O\316FOv\267\t\177s\202\030%gc\2066\356&\005\366"
+	.string	"/O{E\013\325\223-TO\207\357i\216\003-\311\254\334\314\214T\335\350\227\255\001Q~\007\257\201W\362\002\337\r#\306\365$\202\027\036\243h\b\305\035\277\330\355\264\272\317\354\366\fQ\n\305\365;\351Vbo'\261\267\037 9`o38bo+\360\246{\002O\343=\\o\033!\3601\356\006<\214{\001?\343-@\030\300\241\336EA73\363\006\376|\214\267\257w\233eo\367\356\355\365w\233\367\273\275\363\335\326\335\3339\366\266\312\336N{\267\361\275\375\367\366]o{\004\003jVu\304\200\035z7g&\022=\224\347\244iV<\215\373\031w\250\273\231\343nog\343k6\\M\367X\226\331h7\343k\272\327\316\341jZ\335\262<[\321\264\247\245y\002f\266\354J\270\260d\234\013\235\237\265\243\365\332g\240\206FgV\362\352@\241,rt\007CxG\337x\r\276\322_uc\256\374]\276"
+	.string	"\216\023c\217J\025\366y\2765\240\223T\263>\263\225|\375\373\366\314\343\340\352~\367\274\357n\261\264Z\256'\327w/L\216_\004sB\274\307\020\346\202Z/\272\234\363\356]\214\224\244\327\245]\226gO\267\262DUo\376\340\223\236\200\332\232n\305\034P;\326ny\360\276\306\027\\5\311\300|q\361\236\351\346G\2776is{\276\031\335\334ww\370p=y\364C\343\027[\375\334\277\332\037\021\\\374\304\251\357\313\345YX\235'c[;\005\237\276\337y\2765\b\347#\302\271,\313\366\300\245J`\332\276p\2115\243\376Ce\360\n~"
+	.ascii	" _\353\020\236G\204\316\361\270\030\321\f\336\327|A\020\261'"
+	.ascii	"T\254Yu\243\355'\252\345\217nJ\r~\n\246m\254\223H2zrH*~\357z"
+	.ascii	"\276\001\035I-\360\370}O\250\333\031d\023L}f\0357"
+	.string	"z\266y\335\210\225@E\322g\266\377P\023\374_\361\373%\007N\n~f\377\337\227z\3461\336B\235\340\377\261\035\243\277Ej\310D\003\374\200\352o\364}\221[V\001]CBS\024\261)\252(u\362\246\250\253\343\006\325\022\r&\017S7\226\250r|h\212\372I\3518\321\204\303i\306\022S\r\236\215\251\245\021QOT3t8\240\234t\310`:\301DuciG\257eHp\272!\203\210\303i\351\211(Cj\212(A\330PQLRD\035PPR\304\325Y\345\357\244\214{\220?js\252\336\n\370\314f\333\370\220v_aB\220h\267\003\350\332\302\202\030r!\2006\260(\022\355\272\233\007}\276\3672\276\213\002\206\b\211v\021\374\357\257\004<\373\035\342\364\236}G&\272\371\026\3331\354_\335Bi\245\264RTO{x\320R\f\241\255\252\033\3059\347\374\303\302\357\236;\225\332l\321w*\374"
+	.string	"\301\357\236\3227\013\374N\203\017\340\257\032\377\276q\357\367\211X\007\3378\375\275\317\035J\025\360H\357h\376\302\013\212v\344\262\272\321\253\345{f_\236\033\362'eZ\\\273\325\rycU\370E\177uyG \264\216\273\243\3575\370\215\325\340\003\223\356\357\013\374\220Jk\345z\322\301K5\347\034\2778e\n\222,\3543\333\323\334\225 \265\002\200\235\250Q$\343\214BN)$\"2#i\222\016\200\002\021\272\252:\021\320A\234!)Ha\031\003\325\0264/\352\323\307\371\357-\332\222\220G!\210\024\2570n\257\362\210%\307\233\f-\221\315\345r\263-A\346Jz\236\036\t#5\313\321@\336c\257\247\027\357\325\b\030\375\357\376+\001\364}}\204\206\330\n5L@~\322\025\345\t\300I\206\016\320*,Z\350yu\264\364n\264K\021s,2\215\235\2403\203"
+	.string	"\375\320\250#\331\003H\316\230\350\325_\340\324w\366\006\305\247oO\341\217\251\301\300\264\361\347w\213\003\006I\255\240\211\314\255\207E\252\333m\352\2408\254*\221\021\251\341\343?\245\221\273Cv\342\312\005\216\213q0\225\240~\"&\236[\340\353\017\207\314M@\320\033&3a*2\327.\314\241n\237TqN\220\200\033\226\3621\002+\276:\300c\024\235\310\231!\223\300\254/\t\355\2152\237\203\n.u\235J\375j\024\363\"\311\206B1!\270\003\3531U\254\206\327\013\003\223\177\241\373dh\002v.l\332\205\370O\\9\330|u8\007\223\003\212!\377?{\266\316"
+	.ascii	"\327>\335\332\033E=v(\223\375\250"
+	.text
+	.section	.gnu.lto_cliPrintVar.242.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"e\n"
+	.string	"V\224IA \2518\035\017"
+	.string	"\310\220\333@\007~\224Pb,\345\363\373'[\bav\250\001"
+	.string	"6eQ \311\237\360\006m\2664^E'\025\n\f"
+	.string	"\214\004\200\221\r\362q`\020\b\006K\270\r\232q[\271S\n5"
+	.string	"9"
+	.string	"5"
+	.string	"\032Kd\237\026\217\301>\263?`\237\356l\b\231\223\3650N%\222\001\327\356j:\340\335e\347\177u\313\007z\227\013\032\273k\371\201"
+	.string	"n\275\355\b\333\026\366'\002/\n;\316\005\004\256\372\355\177\345\213m\225Y\r\373`\017\206'S\204]\261\342\323\232L\245}\221\321]\034\311|\302\210b@qi\037\365\002\335S$w\330\r\033(\330\025\003\372"
+	.string	"\t\016\220*\214\344\313\230T\265E\"\362\337T\351j9\030M\324\263EO\252"
+	.string	"\373\225\335]kh_\374\261\253\356\371\324\257*\375\214\301T\002\217\200\265\233\022\\\b\244\237\217\210\243\302qB\324\235\215\347\323\321<<\234\016\255\303\201h\033\2147\320\006\247\205\266\215\323.\342\276\262\032:kI\030GZb\213\274N\335>\344?C\240\250gL\037\r"
+	.ascii	"\357b\314\304K\241p-/\224\b\025 \273\006\342q\r!\250I\302-\350"
+	.ascii	"\033\240V\001'yqM2"
+	.text
+	.section	.gnu.lto_cliPrintVarRange.243.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`W\n}5"
+	.string	"\352[L\024BP\346M:K\314\357\016\365\304\n\024X\350\252\234Uo'\320}\n)\240L\324\373\013\006*\326\037\331h\334<&\260\372\006"
+	.string	""
+	.ascii	"\020\024@P\337?\177%\315\315\003$n$\035\261\2735i\204\220\275"
+	.ascii	"\223\f/\001 \0018\001\027\337>\003)8\266?m\314&\276{\346\257"
+	.ascii	"H\2172T\225\343\345m\3765\266\276[\333\331\264oCU\334zf0\341"
+	.ascii	"\2378\250\004\366j1\275\323\372g\177M\013\257v\004\n\355\327"
+	.ascii	"\214\024\217\317\374\365C\213\243k\356\345\374dp\265\251\330"
+	.ascii	"\253\027v\367o\367\233O\323\336y\344\304\234\255D\347r~:h\004"
+	.ascii	"\354\325~\376"
+	.string	"i\275\312\336i\275\332m7^\0242\037'0\321p\261\331\3139Wa,\235t\333\023\231\226\224\222\206\302 \220\375\255j\212o\333?\200G\256\013\354x\242\206/&\r^K*\232\334^\223O)\375!\277\272\274NY\226^h\224'\347n/\020F\031\345&]\t\233\362\341Y\030\331\205\005\316\302\306\036L\027\344\305\321{\030\345X\372\364\325\245\353uJ)\027\230:\211\301\331\275NI\2266\b\243\024\273\254\333G\240\305A\247\374\247g\305@\007F\275\232\223@\203\243k\362\235\205\251=\335B\256OY\352h\t\202%1^R\341\n\202i\255C;1R~\246TS\357\317C\316\271o\027X\330\273\351\335g\321\335\313n\340\212R\321\234\223\357r\301&)L\275\200q\337\325\032\314\220\370\330\3351n'\243C\264g<\220\325U\013\321\213\337G\006\210\317\231\345\347\305\246\272\276\264\264\256\377'}\2036\236"
+	.string	";\272{\251\225O\177\016NOw\001\017\031\020\023O^6;\340\001y\373\372w\340q\377A\201\356\345\035/\244\013\313Fx\030\247\321\365\361@\321,\251\323\267\363Db\272g\323\214\234\376\234b\364K6\223\353\3175\036\233\363\361e})\263\314t~\3119+\200\323\335x\177\031\273\314\312\374\314\n\256\032\300Ws\006f\311\333\327\207^j=6\200\373rE\321\352\032\177s\305\346\274U\241\357\006\004\016v\313\325\376\221\365\352\261z\f\244\250,\2153\353F\352~\036/N\023\203\263+kl\245{\n\337>\200o\033\270\363\037\3606\357(\250\257\275\003\254\267\237\360m"
+	.ascii	"\351m'|\273Ix\233(\274\315\004\274\275\024\274\255\024\274\235"
+	.ascii	"\004\274=do\013\327\333\301\337m\340z\233\375\335\376\255\267"
+	.ascii	"W\365\266\272\336N\325\3338\275\0358\210&''|\273NZ'\004\236\260"
+	.ascii	"I!7\232\250O\013\252\302fQ\020\247\365\215\254PX]\273Cs\235\217"
+	.ascii	"\364\242@\234\326-\224\225\t\377\214m\320\326m\324}\233\320h"
+	.ascii	"\241\260\375vl\275\312\204\357%"
+	.string	"E\t\017\361\022~r\f\373\316\263&a%\374d\230(\234\204\323=b\327\253\035\3735;\307\355j\247,\305\271\263R\326\314y\353\302\325\276I\256\222\226J\332m\225\026m}W\233\266^\035\342\273}\n\314\335\030\354v\007\251d\033\334\263\335d\253\366\264l\265\260I\033S-\227\326\313\337\022\325\201n\341#\230\253\325\2129\235%\231\233\325\2269\\\364\036\333\204\370k>b\216L\021_\234S%\212\003\375\2618\030\t\210\203\314?j\323\334\315\321\207F@|\267\037f[4\337k\323\274O\253\346\214>\\\217\036\235\037^\373\310\f\345\021\263\246xU\024B\004\233<QL\342c\253x%qD&.\227\247\342m\2076,U|9AN\214S|C\\}Y%n\310\304\017\241x!\025\007\264$t=K\214\177N\262;\346\236\377-\221\030Tm\250{\361\237\027\324\"\235BE\261\301\210\021*\2422\344"
+	.string	"\202\203\307\025V\221\210\225\321\370\201\330?\022\340.6\300]\314\360\343*\b\226\225\020b\333\260\221"
+	.string	"\252\203$(:(B(f\270\302\301\303\312X\264q5\244\007\026\326\207"
+	.string	":N\304\b\204\207\b ?\214:n\004\215VBp\327x\240\003\253F\025\017\035V;\252j\030\177T=x\352\036>\256\214U@z\3640V\t\237\371\330J\263zb\240YX\253\017\367_HY\210\177^5$\221\240\242G6y\245\336\330\357\234JO\214\351\t\377y\257\264jPQ$"
+	.string	"\360\023>\034\255\213v\305\001y\317Z.\013\267J\025"
+	.string	"\374\275)m|\316\323\371\325\374K=\260%\r\267\273\365j\231\254\371\227\270Q\231\343\313\323\302\307<%\234\326Kg\206S\300&\263\020\227\334\257\275:\035\006\300_sV\021\223\020\227\334\357^Q\330\t\33736>M\330\t\377\353\222]\t\327\356\276\214Ii\3027C\246\307|?\217Os\3169\t\247\365\335\3762.*]\204W\371NY(\034"
+	.ascii	"{u\377Tk\024\236\302\003\376\304\335%\313\264n\244;$\342\277"
+	.ascii	"](\255\023\251h\0210$>\022\003\200\301\250Q,\246\030r\206\241"
+	.ascii	"\021\tD$i\222\016\240\002\221\031\252\363\021\3400"
+	.string	"\347\030\243\021\222$\311\260\033\260\360\203\311\304\366\245Q;\376?>4\035\2130i\216\352\363\026\031\030&\241\006\004b\222}\320\263\245\302\216(\260\333#:\205xT\201\250_\350\300\001\304\334^\244\273\322\206t(A\013\016\207j\202\t\237\300\363\245\365\234H\027\206e\0041F\322\036\322\321\030\026\215\003\322\230\321\245F\341A\032\206\360\264}TL\316\370\322\255L\206\316\356\nt\020\023\356\217\005;\226dw\354\005\322x\376\236i\254:[\235\221a'\312\231\311T\033VR\016*\271\322\251%\205\232\225C\027\2439\003d\217\212\255\307\r\004\302\206t\036A%\2021[\235\013\231\326\222\032\315\241\217k8\234\272&\352\021 [\305\007f\316Eu\357]6n\022Z\030\203=\364\203\333\373\221\204Bw\203\236\331\331\211O\211\372\311c\b\243\005PI^\327g\275\253\320^\225\375h\320\226\257\212\341\024\321g\311\026\332"
+	.ascii	"6\222V\007aFtb\007\356\316\021\031i\"\004bB\301\356\024\340\246"
+	.ascii	"5\205\347K\213\n\367\350fx\343\250\217<\227\207\243\013\353\233"
+	.ascii	"\352|\241/\212\333S\261\236[\345\203\361Y\035i\206/\033\216\001"
+	.ascii	"\356%\034\030og\213\022\241\323\246\314\002\322\346\373\017\325"
+	.ascii	"\341u\017NUM]\233\324/\"5c\233\276 \245\276\212\320M0\2062\356"
+	.ascii	"u\320\321\232C\367\003@\230\321h\030Fv\262\330k\376"
+	.text
+	.section	.gnu.lto_cliSetVar.244.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\206\n\2150"
+	.string	"\252Q\340\021Ep\234N\007\016((\213\031\006\212\240\017\206\357\345\004\242L3\245\030o\304\271\220\365X@\336\304QC\261\301\377\362<6;u\201\320\245Q\356\330\331\036`\243\376!\\\3136\030\025\325\r\210D\310\336[\356\224R\n\023\001\356"
+	.string	"\n\001\274d4\303Kw\273\353.)\246f\302[\013\364.)$\307\320\036\270\265\350\373u[\006\234\244\0175\367\2621h\313H\314\316\326Q\214-\305\005\373\356%\333\303r\257\333\021'X\333\022\241\355\314\375\244\241\030{\rF\023\357\r\342\005\313\275lG|`m\313l]L\333\256\335\223\266e#3^P\214k\265\224\344q\234\002\347\336\233\364C\332\330?E\237\036\036\342P\030\334\321\001\376|\253\232Z\364\335\310m\240\214r\313\313\252\177j\024'\314\360\331\353y\212\303\203\206\210\344\210\221\"M\326E$\3751\2130\323\341\2340\350\243w\306\304\\\007MZQ\002T\241~*\324\027\217\366\321u\205\241DK\272v\370\252B\255m\222\3115d_g\255\352\350T\205\322\3216\350\245\205\022\335{c8\332\243\311\272\300~^Y\351\260"
+	.string	"Y\327\031\372\350\202\26109\232\256\313\f-\216A\3365\225v./,w\025\352\336\313\276\345\365\325\f\324\314=\204\231\241\230}8\002\314f\fw\262\352\324g[c\315oz\272\2662Y\256\307\335l\241\264\277\351\331\217`X\376d\346\250\266\"\265\336\233\305\304]\305\350dj=\322\226\033F\332\266\337I\214K\234\265+\177\262\216\033xf\021#\274\267\020\274/\337$\233Yo\305\314f\345_\306\334\350\375 \314\326Y\202u~B\235\235P\347\b\250s\023\023\204%\007\r\224\220\216\332\255\331\250\245t\027\365\262\031A\257u\033 \"\320o\315C>g!\325y\300\352,"
+	.ascii	"u\016\220:\003H\235\203Rg \353\374c\235\213\250\263\217\352\334"
+	.ascii	"\223:\363\244\316D\325y\230:\013U\347\240u\336\261\316:\2503"
+	.ascii	"\020u\376\245\316\276\324yE\235\325\3249E\235\255uF\255\363\243"
+	.ascii	"\316\216:\367\004\241\020\032^\355\245\356\336\033\3179\267i"
+	.ascii	"\265$i\267\356\267\356e?s\367\224V6\025\0062\007\334\363\004"
+	.ascii	"\276\347\205ma\352\200<O\374\006J\317\363\351\224c\330\360\211"
+	.ascii	"\303\270\237\322\013\337A\360\205f\214i\0326\244m\203/D\206\361"
+	.ascii	"}\331\363\351\225\376\271\363O:o\324;\300\327\251#\003\234S["
+	.ascii	"\203\353^\276\221\263~\031\253M\264R\b/\244d\202g\231~\350\271"
+	.ascii	"\230\177\037\264\333b3\364\2778\325\367\353C\370\227[z\337\333"
+	.ascii	"\275\243\372\253\372B$\030e\272\364\3513\375\313\035s\330O\233"
+	.ascii	"\316\230\326a\345\366\220\266\265/D~\311\343\n\273\362gq\f\362"
+	.ascii	"\316\266\213\264\350\255\025\232&mf$\374\3227\225\346a\036\235"
+	.ascii	"\317ff\212\276\204\177\243F\337\367\264\346\370\377\367\321y"
+	.ascii	"\365\241\305H\025\3311\210\226\013\321v\310\316"
+	.string	"\277\303\304\340\324zK\257\200kZ\371\036\003)\312.\350\227q\177\341\006\203^\211\343\356\342P\320\356\017.\334L\306[\357\265\3521\266F\320\356\275\nZ\013\217u\377\270I3h\227\355*h\353D\\\276\tU)N\374\224\n\022Q\034FTQ\261\360\215@\021U\002\235RA\"j\205\255\212Z\361,\205$\202\204T\222\t\021Q%\222\244\252P$!\025\231\352\304TUR\n*\252\252$ \333\355\017\302\253\236\222\346\325cqg\351\376\347\363\231\367S4\366\246\326\243\227z:\212B\317\256eL\253`!m+\364B\244\235r\316\323g\300\017xa\333\\\235^^\217\200g\3072\246]\b\332aH\333\nx!\326\234\362\350\314\233\343\tP\364\001^\210\024Swt\272i\026pMfzx\304\313\r\006\n\327\036\267\363\237r\270\273\310\201\303\035\247\323\2749\023!\217\331<\272\223\033K\367G\360,n\306"
+	.string	"\031&\337\202G/\244L\236\355 =\021\321\007\355^\210\245Q\003\023\002\370\240?2z"
+	.ascii	"AuA\243\007z\2445\306\264\026\031\322\266@/D\312\305\355\340"
+	.ascii	"\325\375\274\321;\363\350"
+	.string	",\276Q\377\274\273\361\371b\032\251\"3<3\237o0\261;/\335\313<\037:jB~\r^H\251f\303\347\340\t<\027\007\200\336\250qH\345\230BR2\222\024$\205Jc\360\002\021\231Z7\021\320@\247\234\"\221\331\222\302t/\240\001\3670\027\253\213\340\374r=\217d\017g\313\266\323ka\206j\246\320%\230\037\315\312\004\327\370~\214\306\007\177lUl00\321\371\202\375\3676\370r\026\275\004\351\007\\\035\322\033~\260\024`\256\023\027\253\336!\207\257\022\034\2020\r\016\005\231\344\3307Iup\3361}SO@\0060\263G\007\224!\312\337\177'\302=\270\362\252.\035\263\270*\3152\323\2651]PW\022\315\257\220G\026$\211o?\277\374Q\222\025\3557\0229\004\bC$C1\311\017\353~s3\025\247wv\267\256_\301i\250\246\312!\252y\323\033y\b&\333(\001\305\234.\b\335E\326"
+	.string	"9\315\353\206\025+\234\342\216\313_\333\201P*R\022p\363\246{\305Y\tf\023\213n\326\tgNli0\317\036n\037\0317r\275\343b\216\013\301\261O\217\255\245\325\242\270\304\361;M\373=A\003`\271\035A\016"
+	.ascii	"\314\372\f2\005p\033\203n\202\300V+\250S\333\365/\300\315\357"
+	.ascii	"l\247\352\240\016\315h\b9\036\203\025\3342H*f\304)\351\335\202"
+	.ascii	"\205bP\345\200u^.S\002\033\033F\332\361\007\254\354\037+^@\337"
+	.ascii	"r\212B\344\303D\025\311\234K\002\023\373>G\377\020\035L^\350"
+	.ascii	"\324\177\001L1 \356H\240\216`vt\342MW\260*\251\236\\\f\300\003"
+	.ascii	"\340\314\360\322\346\314\345\325"
+	.text
+	.section	.gnu.lto_cliPrompt.245.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375 \353\215\006"
+	.string	"\322K-4@S\222\016\214\260\207&\017\013C\347\325\323\212\001\234#\013\243\3718ey\034m\372\263\252P\277\250\332;\206\341\262\276\023\232\346!\213AQ\367\377\250\261Md\n\037t\006\b\244)\317\347\201z\021\237\006\210GY\023\317\303\271\222p\260\036EUYo#\312b\350iF\3332Pc\3115\245+\025\034\222LP3\213\t\204\220P\351/0\\\263\333\"S\263m \366\"\314\241\310\027 1\364Xp\342\241\365e\224\3711\242\311Mr1\371\273\371z\030\003\216\304\026TJ:Xb2\363\341H\257\272\353\026\245\002\231\206\325\0050d\346.\323@:\366\357\374\n\177H\t"
+	.ascii	"\357b\310\204&\340q\202\013\3335\321-\004\3742\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_cliShowParseError.246.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375 \361\365\006"
+	.string	"4\f\222"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\312\2754\201\200\205\030\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\337\354\001\221\254\263\017\003"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\201\003\204\340\231\373("
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\005\001'$\206\by\212\001\206\200\200\250\034w\276\001\274\001\002\005"
+	.string	"\203\003\202\340\233\373\b"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\025./src/main/cli.c"
+	.string	"\fPARSE ERROR"
+	.string	"\t"
+	.ascii	"\357b\310\204\026\340q\201\013\3335\321-\004\3742\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_cliShowArgumentRangeError.247.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\315\n"
+	.string	"f\224LB \307*\035\200d!t\0066\262(4\225Ip\373\363cpD\032\301\335\255"
+	.string	"\030\032\030\022~*#\350\245_\352fa(\260\003Q\270\024r\270\005QbfRr\243\220"
+	.string	"\005\333HW\331\020!{\247\0246"
+	.string	";"
+	.string	"6"
+	.string	"!;\200\377|\336\243\371\007^A\363\317\244\235`\301d\313\211Y\001\330m\301\356\212\265\345\344)\351\377v\216\031+O7\024\273kj\306R\356z\333\r\2661\354\177\0022\004bG `\027\245\001\203\325}\006^l\277c\333\234\363\020\266d\345$D\317\003 _s\316\234]\025\005\270\335\r9\002\374\027z\247\366g>#O\023y\302\256\354"
+	.string	"n\367\f\225\304\033\352\325Zi}\200\017p1\270\354\276nz\200/\211\207\177\366G\b\275i\210\035\214\016VK\373,ie\261\357\355\356\272\312\354\333~\357\265\277\236\366S\315AF\201\302\013RE\210\002\205\244\321H\2434\262\bK\031\244\320\005\372\200\230\306\272R\21555\232V\236O\"\325\306I\\\251L\243xj\271D\221\307,\216TK\354`\261Zb\347\334W\231\301]\214n$\016"
+	.ascii	"\357b\310\204v\340q\207\013\273\\c\007\314p\300\310\240#J\210"
+	.ascii	"\033\210\001\256HSS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_nextArg.248.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`Y\001\325\016"
+	.string	"F\033cE"
+	.string	"\221(\035\340,#?\302C\022\350nL\242\215<&\250:\335G\373P\362\023/\313\f\357\205\366\027\0364`\263Y\036\373\0261\242\013\b'UUU\242QA:#\250E\376\316I\332\237\t\367\311\336[\312\224\002K"
+	.string	"O"
+	.string	"O"
+	.ascii	"\017\221\217\234\013\220\217\013bS\350\335P\267\313\bW7\037\343"
+	.ascii	"^3J\235\350\262\323q\032\341\276\254d>\272\024\270 \205\"\304"
+	.ascii	"UWSGRhb\345{\325\035\264\\_\251[\271b\f\346\234\326R\307"
+	.string	"\341\306n{d;\201\375\016\001?\274w\253\252\317\001i\311\320\335uc\316\r\337\216\311\212.J\334\373m\024_\345\216mo\0030k\346\273SJ\006\2169\275\002\217\316\364.\333\003\314y\232i1\247g\300\0048\217oy\n\024o\213\2014b9\220\202\241\022c3\247\227\331\013\037*14\254\334\001+\232\227\306\3255y\223\272Q\224\343\203\251qAu\3009\347\204\b\256+\027\343^\253\224\023\234~\273\342\303if\035U\344~!\341\332\024*\350Kq\325\346&\305\"\255\310\366D\272(\373\njhDxO6&\343]\002Z\350d!h\rB&$\2326\301\343a\317HI\004OfR\362@B\346\321@\331H\210?'$Z\026\372|\264\254\343\315\357i\r\341U\034\303\366\254\033\031\326h\271\021rQ\0269H~\317\002C\3431\026@\034\022_\217\226\3533y\030\351\367\226\215\027\026qQ\016\036"
+	.ascii	"\357bd\025M\3519\231Y$\243\365\231y\002\3133!\032\355\306\227"
+	.ascii	"\212\033\355\246} \205PW\233j8S+o\221\nBP\342\276\025\017o\302"
+	.ascii	"q\024a\241\362\3753C\235\262\204#V*C\021Zy\315\203\201\242l\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_processChannelRangeArgs.249.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\001\004\215\034"
+	.string	"\2064\271K\260\224U:q\201\360\264\252\221ee9\367\301`\230t\023\037\r:\341\335\251\217R\237\231\031\032l\022\374\200-Z\033\266|\333\341p\240\275\360u\363\201\377\035\265\256\037\257\374\341\031U\243\314\261\3674P\264\257\374-!\204l\271\223\f\245"
+	.string	"\231"
+	.string	"\246"
+	.string	"\365A\271\273\356\005B\006\2717m\300\b\320\227\327\361\0358\234\353\0239\272\037\007\304&\023>\220\367\2462N\0373_\242\207\231/\373\005\327\333\364\254\252\271\257T\350i\226\266k\216_\374\204\235\025\243\357W\342+\033\213Q\203\306\223\250\360\261\n\222\216\200\374\370\252\363\333U\225\013`\317\321\037 \317O\0267W?\026/m\202\250'!"
+	.ascii	"~=+ gG\006\353\227S\255\205\365\0301\335\350\007\222\250\340"
+	.ascii	"\261\f\230l\370\260~\274\332?\376\002\021\t\345\007\330\363z"
+	.ascii	"B\270\367r\365\375\200g\326\231Y\210\231i\230\273(-dNw\3651\206"
+	.ascii	"\2548\301\r\304\374r\241?\300\323\037\366z\321\331\3252+\273"
+	.ascii	"<\350oa9\321\031}\320\371<+\233g\345\362\254l\317\312mV\256f"
+	.ascii	"\345\017pa\032\376\336\224\274w'y\345.\225Bf\274\350'ze>\337"
+	.ascii	"\307\221B\374\2103\004\247p\334{Y?\370FE\234\004D\224z\272\367"
+	.ascii	"V@\337\203\177\344\241\033qNt\363\013\274G1$\"\237\356M\027\274"
+	.ascii	"\344\b\350K\003\36603\0043\353\345\231q\230Y\314\334B#\21005"
+	.ascii	"%\361\322\272\274b\213\004\001\266\2317\374\210m\330\016\t\204"
+	.ascii	"\247J\r'\263\205\315\314\341Ff\350\275\367\001\277\b\206\230"
+	.ascii	"\0020\206/\371$\314\227\367Eyu7\254\350\22441\245\253I&\2423"
+	.ascii	"B*oL\264K\036PRE&\003\336\257\256G\275\034\"\256\270\364\313"
+	.ascii	"\240\340\324n\311P\360\344\325vi\256\275*\255\033\347$\323\325"
+	.ascii	"\265\217t\233c\230\332X24eW\223\334R[\315<SS\357s\365\215\376"
+	.ascii	"BJA\275\t\231$\332\026r\316lu\363\200rRl\302\253Q\274\252g3\323"
+	.ascii	"l\365\276V\377x"
+	.string	"\027RJ\312\022\257K\324\244\341\023+\035L\003\363\201\0067\243\311j6\032\315F\300f\006\242E\310t\250Q\230\271\315P\\\355\306&\001W\223\241\335\314\334\"t\250\261\231\201x\311\314\324f\267\362\206\363\320\034\003Sc\023#\253\325\314h\262\230\333\007\031L\214m\036dn2\234\315v\223\261R\335\255\352l\026\226~\361\256\245)\032K\272\336\255Z\310-Q\350K\307\214J)\352\211\034m\235\037\377\035\243R\020m5\333\332\322g\353\324&\267\367\336\253j\341\213\006%N\306^\215B\315\216\301\270/\312?3\3136\333R\351\005\371H,\314P\376\b\363e\331\253\"RI\307GW\223gM\250A0\210\214BH\021\022\232h&H\352bp\002\241:b\007\020X\311\244I\2265\036\306\352\313\256\253\330,\"zb\026\234BFy{ \207uhq\260\343\256\037\277h}\2443\241\305\224\266Y+\325P\350"
+	.string	"V{W\026\316a\255@2\246\"\023\256a(B\346\266\364\005\007\240z%\277\253\325!\373)@\252\325\255\334Q\373\217\206`\036\344Cs;\017\020d\r\037\211\236B\\\335\232\261:\b\204\340f\206\2100\020I\336\354\314v\260T\246\201\221\002\257\361\333\225\235\202\374"
+	.ascii	"\250h}\362\345\214\226K/[\321\233:\365\003"
+	.text
+	.section	.gnu.lto_isEmpty.250.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"U\013"
+	.string	"\266\025O? Q\224\016OF\\b\201tH\200O\310\370\356\201\267@VM\306\3310\300\365&X\264"
+	.string	"\276\261\231\365\217\317Z\304\177\310Fd"
+	.string	"$@\004\250rN\371p\320>\320\244\3654\023\264\367\2262\245<"
+	.string	">"
+	.string	"="
+	.string	"\207OS\344_u\250\202\203\211\314\005\tmthi\370\233h\246g\331]\211VJ}\227\016\0052\321\262G9\215tW==\264R&\007\203\335u^\3202\334\361\266\035\3306`_@\373\261\262\261+`\212\017\266C\266\304v\246}\020\017\021z\nt"
+	.string	"\273\333\210\023\273\034\002\027\260\016\315\275\022\017\255S\342\241m+X\020\262(\200i\024#\201jC\207\210\031\273\334\245\035.\nO\267O\274\016\020\221\301\342\"\025>\226\207+\201\254E\t\020R\2562;\324\t\205\032\024U\033\274(e\r\233\033\245\206\330\177\273\273\326\315\360\251__:5\375h!\365\201A;\r\030\033\0216\032\314\323\211\316`4\0222\327F\363`\302\225\301:\027\246b\016\005\b\330\345\341p\260K\302\355us\352\201\347\273<\325\3036T\013I3\247B}\307\rR\256\"\324\020\3779\322\241N\001\020"
+	.ascii	"\3571\226\020\032\241\0162\fEe\225\271\325\321I\023\tD\001\215"
+	.ascii	"\313\t\341s\031U\252\361\023\313\302D\302UU\r\351]\005\n"
+	.text
+	.section	.gnu.lto_printRxFailsafe.251.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\242\007\345)"
+	.string	"\272Kt\020C`\246\316p\027a3\203}2\241\227\357\212ILB\27025\262\2046\346e\264\265\016\006\345\031\217\202\2376\220\202\246\2038.\334\267#\261\364\013\271z\013#\253??\364\314\360\267^\"d\357\275\267\224I\006\365"
+	.string	"\333"
+	.string	"\364"
+	.ascii	"o\373\333\376\334\266*t\331\320p\266\244\t\331.\333\226\271\206"
+	.ascii	"-\327\035Ehv\177\236|\020\341\370.Z\346\032\266v\334\335\222"
+	.ascii	"J\024\031\352\265\354\327\366\367sw\267\300\020z-W0_\234\235"
+	.ascii	"\034*\177\326u\351\364s]\250?\371\267\273\235&\003\020\025\226"
+	.ascii	",\312(^\336\312\361W\266\214\204V/\2642(\365\347.\325\363\356"
+	.ascii	"\251\274\312\361f3\266\267\256C\312\270\255\353\022j\023\250"
+	.ascii	"?\205\017\242?\315\023\241?\367\270{\307\250\306\312\005\341"
+	.ascii	"\fI2\313\237u]\207md\207n.\277)\037\257\246\350i6\037\367jG\240"
+	.ascii	"\244\343\272j\366\222=8\356FG\230I\341\r\007\237\257uq\352\304"
+	.ascii	"\307\321\036?}`=n\232Mbhx\004\201\3250\203m\306\352\374\355|"
+	.ascii	"\003\314\213\373koR\212A\223[\003\363qN+\254\353\272\374\005"
+	.ascii	"\266\343\333\373\356\222\355.\231\335\364(a\220P\370{\006}s\037"
+	.ascii	"\371\244\213\003\355R\277\377\366\250>\3121]rjy48P\303\261!'"
+	.ascii	"\244\027\310\n\332\351L\275\233\302\310\377b\320\301$\335\262"
+	.ascii	"\016\017\262\271v\227\\\334"
+	.string	"Dv\177\344'L\3156\331.\204\341\273|\241\316\366}:\226\337\351n\337\246_\371\0330x\332\257\340f?\323\267|\227\236\366\025\246\274J>\336\003)o\222\312\213\224\362\032\360\361\036\245\274\005T^\243\224\227\200\217\267(\345\r\252\274\003R^\242\224w(\345\025\240\362\n\245\274\001|\274A)/P\345\005\220\362\376R^_\312\333Sy\325\2247\355\361\242)\357\251\362\232)o\243\274\214\362>\202\022\035Z\034\226\263$-\267\\s\004\002\264\2629\341\230\274\313\317\366\273\375[n\356\036\356\\\366^\002q\244\230\321X\363\241&\352t\f\320\230\253\271\200\036\022j\001t\222\b\365\301(\343\324\231%\361\257\003\364R\357\345d8\017\245\232(\353\212\374\327\006\025\371)\013~\236\315\301\003\377k\315\365GsmP\007X\251\303\3710a\037\3677 \314\025A\002\375\327\317=\t\364gP?\315\201\003\320\300~\033"
+	.ascii	"\215\002Q\256\2513;\357\370\372\327\351\330\335\034R\254\300"
+	.ascii	"7\f\332k_w\032\344\023\265{\375\022OSD\355\303\375\324\243|#"
+	.ascii	"\305\354d}\302\366\230Md\371'P\263\333\n\336\034\332\034/\266"
+	.ascii	"[ \013;\355a\243\b\202v\332O\346\241\375$\030\250>\033\035\273"
+	.ascii	"\033\223\314\333"
+	.string	"5\3612'\324u\365\222\260'sL\202B-\333j`\036\2747bU\314\234\336\r\325\234&\t'\304\017\363\247n\352]b\221\377\325\255 \351g\345v\352\247n\273\273n\320M}\006\013\\)&a\221I\250\305$\2542\022\251b`\t\025\203H\030\262\252\210Z.\246\200\305\024\353\205\210\024VF)\342\224\n_\210\027UZD\252))\245\254\024F*\253\253\013USVVD\025\027\246\250\210YUFbT\f,\243\025YD\017-XhI\251[t`\254*\016\255\214D\026\303\"V\326\320Ap\257ZLa\r_\\]a\r\177\313\225\315\325\256\252\3415\251\303C\243\273\330\250Md\201f\320^\331\231\222d\033\357\215\277\275\027\345lJ\262\r\035\366\325\336;rV\226lc\006-\354\033\354\006\215\216\027\333\335\\\327uM\177\030\350RC\350\257\3754\223&\326\305\201\030U:\320Js\030\236\207w"
+	.string	"\251\223\356\220\346\f\324\035\317\316CY\307\202\212<\227\005?9\2045\327\036\265\201N\307\360\332:\274\017\335\221Q\027\330c\324\377\362( J;u\274\334\301\266\344Lb\242&p\241\250\t\214\370\334\235\242\001\035\2543\240\237\247\f\200\207\250aL\345\bB\244fD&H\222&\255\001\220\002\2219\2639\021P\251C\316\225\246\225j5\310P\247\037\321bI\001\032\357\304L>\214N\205\367\020\251\307\036=\334H\223-wxW\211\022\2339i\205\210m"
+	.string	"\340\203H\"\0079y\f\344\277!"
+	.string	"\344\336\230@\307\204K{\346\222\023\004\006\2074\"\305PDp\365\002\264\320\2508p\240s\024\022>(.9\b\303\023\326JG\305\002[tH\357\247\373\035t&\376\221\002\371v\204\322C>\370`\216w\372\301\371\325F\360;,@\366\240O\r\257\315`\334s(2\003\311\303\260\r\221'$\362}o\353\210\210S\271,\377\305\212dKA\236 \305\242\324\273^\323\243E\211gg[\372\242{4\345\267if\020T\177\215\330p\246\2653\221\236\202\005\262\007'\222&^\316i\022q\n"
+	.string	"\215+Q\334\3710M\020\317A8\020"
+	.ascii	"\300\213\304\340e\346\215\246\007\260\254\276\006l\031\314H\231"
+	.ascii	"\342w^+i-0\300\343\340\277\016\363\007"
+	.text
+	.section	.gnu.lto_cliRxFailsafe.252.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`8\f\325C"
+	.string	"\032wd\032@@\244N\007\257\007-(Z\271A[z\376} \b\2049\205WF\f\201j\n\025\307Ht\350PjI>"
+	.ascii	"\342M\226!\267\337\031}\336N?Df,cc\232\031f\330^\032\t\331{'"
+	.ascii	"\231R\227\001n\001\226\001m\344\363\362|\226\375\311g/\210\212"
+	.ascii	"3\216\346u\275\031Qc\323l\246\024\355A\030Gh\202\350l\324\352"
+	.ascii	"Jm\031\032aN\366\320<\020\235\315\253\021%6\315B\212T \204q\022"
+	.ascii	"\374\256]L\033\361l \345\277\354fX\366z@ :\373^\347\3246\366"
+	.ascii	"\202\006\257\333\205\335\0204\347G0\347i\002\242\207y\235.\207"
+	.ascii	"gg&\342\231#\024\314\031Z\345l[\021\235uz\307\335\036\347`^\227"
+	.ascii	"\323\341"
+	.string	"\310\234\235\214\321\313yz\325\006\210\316\366\324\223\255\263DWj\235\355\267;\320\211G\026c0\327\207\214J\230sV>\224N\362u\352\275\342\327\233\230\222KJIH\244#\243\243k,\026\021\207-\273\276\023~\333\315\304\274\211\211Z\305\223KJC\013kgT<\351\017*e\215J\023\005#\007\254\235\2659\322\233\243\025\202\231\214\306\377\240\322u\bW}s8\350\022l\264v&\365c\235=9\367\017\252\004N\022lT\203\203\"\301\305\241\005,{T\376\254\235\271y\321\272 \317\354\214\377A\217\254\307,\201p\016\007M\303\304\265e\333\203\342\177\320\2645\002\034\267>o\203\206\207\253RZ\231;\376\007m[\255\356\\9\342i\310p\273&\205\270=\375\017:e\245\022\334#\344b\234\230]\337-\320\017\377\203RY%\354\375\020\344T\307efM\274\026\337\210\370\023\211\270\223\221\031\2175*\347\354T\037"
+	.ascii	"\007\345\202\361\320B\316\271\361\323\354\314\373\311\273}\332"
+	.ascii	"\335x\335\305h\004\336\300\273\030\367`\247\007\032'\226&\256"
+	.ascii	"\262\037\355\343\363%<\253\307\251\313\260\233\2579\347\274~"
+	.ascii	"\324\303\332\247\227\360P\315*\240S\255\211\253\335\204\377\273"
+	.ascii	"_\022\330\237\035\225\304E\3575\255\337y\235\t\342\023\177\367"
+	.ascii	"\211\024\330\237\377Q\316\027\353\247\307?d\253\372!K\304\304"
+	.ascii	"\325O\020WH\345?\332\356P\203h~N\357\244i\264\376,\352\364\214"
+	.ascii	"\341B\215\304\004\276{E\026\366\247\277S\335\177\340U\231\024"
+	.ascii	"\n\216\275X\367\264\211?\332\355\r\002\337\246\375N\272%x\236"
+	.ascii	"\367\003\027\267\002%\226\353y_y\237\267\225\263\361\256\242"
+	.ascii	"B\340\342>\340|\336SR\216\347m\300\305]\300\345\334\tx\031o("
+	.ascii	"\267\363~rq;\271\270\233\\\334L.\356\244\213{\351\210[\311\305"
+	.ascii	"\235t\304\215<\342F:\342>rq\033\271\270\217.n\327\305m4\302]"
+	.ascii	"tq\027\261\270\211G\334\303\026w\353\342f]\334\253\343~\0277"
+	.ascii	"nq;\005\004wut\354\346\002\037p\232\205T\017e?\226\257\212\367"
+	.ascii	"\271\263q\317s/\343\256\347\316\347\216\347N\347n\347E\335\336"
+	.ascii	"\016\307\345t\033\233\313\343\364\016i\2356ru\033\335\264\277"
+	.ascii	"\351{\201c\312\236\232\226\232\3666ll\254\031m\232\317\216\242"
+	.ascii	">\374\342\b\263\272\\M\267P\351\035\227\234\263\261\333\307\264"
+	.ascii	"\223q3\276\347i\002g\007\376\310\022\222\326\251\003\274Sc\003"
+	.ascii	"\025\374\201"
+	.string	"o\354$\204\314[_\301\273\034_\275L\231\356\265\271\023\324\254\272\277*\335_\377\260\231\255I\274\2209\376\2305C\370\2316\346\3421\277z\207\343SLj\240\366I\0324F\345\263tT*\345\343\302\265AX\177D-\303#\343+\312n\322\342Gq\367\253\344]\202\375\3318\317Z\237_\363\305^\257\212\231\242\217\366\373\214\366J\212\216Z\245.\317\030.\264\205\305\336&\017\254\340\374\2621\220\346<\006!\221W\337(\224\267\255\255u\366\352\003\264\361Y\275\361\001P}T\213o\365k\234C\357\033\321P\325\027\337\337x\212\250\217A\247\026#\034t\020\361\243\201\274\352Y:\273A*\\\364\356\306\013\3377+i\316N\177\266\017:\341Ke}\253<\337\267\366\275\362f\301\376\254\372(\036/\326\304/\372\325\005\275Q\336-S\210\357m\234\370G\365\001Xv\204\351\352\305\0314\264\321R=\313\264\363S\247\247"
+	.ascii	"6\360\345\005\203\375I\365\270o-\213\037\366\260v\370\b~\204"
+	.ascii	"\264L\023\020\217\257\211\253s.\030\346\3103\27385\007\276\246"
+	.ascii	"\373\345\342~.\264Os\006\325\345\211\3139C\350\343\201\030\332"
+	.ascii	"\2478\333\0316\260\355\035Zg\207\337\236I\361\n\345\332\237z"
+	.ascii	"6\316\267\357i\234\030H\3551H\026\347U\3575-\373\005\2761\031"
+	.ascii	"Z\022\0174P\332\217\"=\254\225\372\247\263\223R\027\207}\251"
+	.ascii	"\307f\032\n\204\b\354O\366\025x\375!C\210\020\0278` \366\261"
+	.ascii	"[HEiIE\325\220\212\202\301\225\345\342\306\027Roa\321\330\002"
+	.ascii	"\313\352R\306\360\352\352\362\322\202\352-\254\033_\312\033_"
+	.ascii	"J\313\026^ Z,\301h,\2172|)#\fl]\2275`d\225X~q\325\230\261\374"
+	.ascii	"r\277\226`ZY_Y[\030\226-\274\272\216_`2\036\3062F\214\254-\255"
+	.ascii	"\241\213\032,~\031\203\013F\213.\255akaq\301\320R\306\340\312"
+	.ascii	"\352Rj}\321Pb%\333K\306\362K\t\346\345\365\2454N\231\376N\332"
+	.ascii	"\002\363\233\337\204B\312\246\260e\3321\231r\2549\257U\240:R"
+	.ascii	"\220\016W]\271\247\217\\\262\002FV\271\217\301mos\212\007\321"
+	.ascii	"\351sd\257\017,\306\221y\236\024\361s\276\030\361\317\230.KN"
+	.ascii	"O\3362 D\247\2779\235\276\030\025\002H\226H\t\002f\372\246/\360"
+	.ascii	"\256\006\263\275f\002\360\274C\210Ng2U\3445B\366b\375\340\233"
+	.ascii	"\360\323\223\317\364\305h\220A\247\032\376\341K\237\374G\344"
+	.ascii	"\204S\372%&a\307?\274:K\324\224X8\322C\205r\255\030\225/\251"
+	.ascii	"\215\373\222\247\221 HX\277\2247$H\213\340\241\276\314\317\241"
+	.ascii	"\236e\342m\251\323\203\002'y\267L\360A\214\344\301'\333\370\230"
+	.ascii	"\237\364N\226(-\314\223\314\273ChF\220\032\364\244~\334fY\024"
+	.ascii	"\2114\207\213\204\025\375\335\t\022\031r\365H\337\024\005\002"
+	.ascii	"H\226\210\331\236I\013\204\304ve\312\320\333\321\024\334\035"
+	.ascii	"\235\2767}FGi\030\032f\\\273\303Bp\020\177\0022\372\243\207\212"
+	.ascii	"\376\250\222%z:\276\321;\255qz\301\021\200\352\250q,\245\230"
+	.ascii	"S\250dDD\244)H\322\030\200\002\021\2422n\003\021\220\275C6\222"
+	.ascii	"$\2054\006!\243\324\275\327&T\354\344\371\253~\366\370\221\255"
+	.ascii	"\3537m\271;\356\301\204!J\026B\206\032\340x\227\352t\fF\271\261"
+	.ascii	"\372T\311\235i\221ed\220\334#\257\271\267\224\261`\036\213\374"
+	.ascii	"p\275q\022\311\277\303H\202\243Q\373\032\246\367';\267\362\036"
+	.ascii	"\372\007:y\246Ia(\262u\2235\211-\035\233|\235\0250\245\377\277"
+	.ascii	"\252'\3540`\037\032T\336\351\373\013\023\265\243\257,\224I\236"
+	.ascii	"\237\022\214\037\332O\340\006\f~K\306\2478*\016V\031\275\232"
+	.ascii	"H\325\035\215\377<\353mu\037\r\352\272v\261(\034\032Y]\370\021"
+	.ascii	"\377\277vI\275cGx\233\207\320\374\221Ksb\025\252\006 \211k\343"
+	.ascii	"\261\265\331\267\230\351K\206\321\0209\351\201\025\356n\270\375"
+	.ascii	"(\351\032\306y\310y\212\3769hIQ\005\320\230\247X_V!D[\340\227"
+	.ascii	"\026b|X}&\024e\331t\227\020\236\3039\371\250\312\221\"\262|v"
+	.ascii	"\2627\273\376;\\\227Gl1"
+	.string	"\315\013\247\256i+S'\271q\350\035M=\244J"
+	.ascii	"'\022#\262]\rpc\320\224\340\030\207\264v\321\324+)\340\373\300"
+	.ascii	"\243\376\242\323\265E\340\323\366\202(\304\333\257\305\373\222"
+	.ascii	"\303\334\256p\033\311=9\216\2574\210\270D\316\220D\227\026g\301"
+	.ascii	",\251\007\235k^\036\t\013N\357Q\f\302\031\223\226\247Z\302\307"
+	.ascii	"\024\370^\333\274\211z\202\244\211L\200t\360\214\362,\313s\377"
+	.ascii	"\222\021F\201@\221\025\020\026\370\320*\315\301\240Z\026\327"
+	.ascii	"\034\032\307\210\335r\232\246\007\220q!\"U\027\2677\322\313\335"
+	.ascii	"4\242S;\007\276h\3214\365\310/{\217{\365{#m\210\351\215\306\177"
+	.text
+	.section	.gnu.lto_printAux.253.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013\2358"
+	.string	"ze\030\026AP\244N\007\003\303%\2646\337\263Q#Nm*\006Ap\313\341\021\250\305\210\205\261\266\232\017@\f\251\251/\027r\020~X\243\224"
+	.ascii	"b\301\217\313\b\237\366\215n<\377\333x D\233\204\264\275SJ)S"
+	.ascii	"\001-\001U\001<\210\256\340m\265\302\350\023B5(T\222vme\270\315"
+	.ascii	"\364^\237\351(\037\373x\034\331\261\321"
+	.string	"\021\002a\302\262\371\274\226\302\240wH\321\311F\330W\017\214\303\030\220\021Q2Tz0\347\201\245w\rz\325\216vn|^\266\307p\343\361\261Uf&\223c\211\fz\323V9l\201s\205\367B\241Ze\033\266\325>2\363\213\331\201\007F\030\273\265\020\016\355/\313\006\303#\211\350\222\325\275E\331V\031j\333\231{\256\273,\233\316\007\033\357\215\303\343\273\027\032\305N\266\325\2456\"\266\232v\021\261U^2\347I*\273a\022\242C\230v\205\367\336\251w\302\002:\2056'}\331CI\244\320q5\332\"QM\337\227\334w\335\364\324S7\210\227\026\326C\351\227\025\272\265 Z\2224\003 f\234\306\033\363d\0235\270F2\305\251\275\265\220[\037\335\252\240!\361\365-\332LU\320\332\334h\244m\307\251\255u\261\005\321\326\372\217\351\304\026ck5-b\313\233\223L+K\037\314\261\322vL3\36345"
+	.ascii	"\007\020K\3775\223 \032[\332"
+	.string	"\344\266\244LG\333\317\322\310\374\033\257U'[\340\234a\234\032\\{\221\303\275\227\275\231\246\326L\324\314\315\200\231\2630\257G\001\005\212\f\276\351\003\247\016\231\003b\377\no\341U?\263+c~\270\206\330\357\337fU\306\374\220\241\276\277\243\035\242\312S\257n\360n\220\230\037\376 \037\335\222\347\244Kx\250\216\360\314Y1\274\233\024\336\250i\205\212!\241\331\2071C\303\374\235\314\2354\345\013 ?\023\346\022\326yD\3475\213h\275f\020\326\271C\243i\246j\277\346\r\032ZM3\206\016\323}\241\373\232-4\230\356\n\024ZL\267\204\246\353\216`\235\245\254sT\3635?h2\315P\016ZLs\003\353\314\300:?\255\316\013\254\263\202\325\331\311:'\260\316M\326\231iu^\262\316\b\254\363\001\353l`u.pt&\260:\0170:+\031\235\223\2543\322\352|d\235\215Vg\001\326\271\310:\007\260\316"
+	.ascii	"Vg\"\353<d\235\223\326\031\271:\013\035\235\217\253\363jt6\032"
+	.ascii	"\235\255u.\022\235\211\326Y%:\247Eg/:wU\003=up\302D\327~\020"
+	.ascii	"z\207\034\006\272\201j\337\224F\323\355\327\255\246;\257[\257"
+	.ascii	"\233\257\273\257\233L[f4\334~\235\246\377\370\250&r\222@\374"
+	.ascii	"\016C!-\222\324\271g\034C:\343;\331\211P\335L\242R\230{\305\016"
+	.ascii	"\037\365g\314O\036\365\307\037\372\2427z\244\207z\356?K+\305"
+	.ascii	"\270\2748ps\367\232us\211\305\232\365\333S\253\305_jY\312y79"
+	.ascii	"\275"
+	.string	"o\037\306G\217\344G\316\362Z\035}\215'\033\001o\304\245\371T\t\370\037O6\206tbx:\300\027\365\235\006\360\001\210\036@\227&\324C$GW$K\376\220\031\234R\263\037\021\371\311\177AB\217\374^zi;U\023\2360U\327\361\320j\024\035\241o4\3176\206t \232\216\210\343\377x\002\312\245v\375\016\277:\333\3760\0071\223\3509Ur~\004\262Z\277\251<\001\233\017\3378\211+\306i\252W\325\314p\251\353,_\362\024\022\337\251\202\0217\274*fFK\035\222\033\251\276\221\230hA\343w\240g\0329$\267\317|\"\205ws\303w\232\0222V\321nX\330{\311(p\263Y6[\330(\255\332o>O?C\272\244;x\3655\374\237i\342\027H\374\"\361\033\017\263-}\365\233\t\3001\274\205gv\241\364n\246\377{\232D\003\313>\214\375/<\206\357\277Va\327vgve\314\311"
+	.ascii	"\203\254\245\357\344\346A\274\360\001\f\246`I\007\230R\351J\271"
+	.ascii	"\265^)\267\376\203\027\r%\230\215,\244\216\256\027\337\205\002"
+	.ascii	"+k\006\227\026\r\253\3257\276N\304\340\322\302Rf\311X\255\276"
+	.ascii	"h\200)ada!\360\322\302\342\352\362\300\325\245\365\245\304\241"
+	.ascii	"\365uE\225\205\325\265\2254\303KiUc\013\f\313\362\225\224\026"
+	.ascii	"\215\253).-\345\326\324\325\r\257))#\356\252\221uc\352\253\253"
+	.ascii	"\353\306\324\021z\373\231\334\265\305\343BhH(\366c\201C\357d"
+	.ascii	"\343\026\2441J\324\215\271\347|\306)\262\301\367]\033\237D\221"
+	.ascii	"0\367\234\302;\370\263\346\323\351\275\367&s\020\241\276"
+	.string	"\304\037y\352\215\r\212\201\033\363CG\256P\375\025\315c\356\035G\274\224\324\023x\004\237\340\025\374\023\203)\017\236\3017s\320\202\177\362 ~\254\0268\275\002oV9\375\212\347\240a\323'`\372\246\245g\352\342@\230Kr\007\036\201\201?\360\337\246\300\033\360\262\252':N\346\364\244\3007\334\363\216\213\t!\360+\236x\204\006\374\210/:\335\006\375\022\016\370^{\342\351<\205M\346QD\202>=+\356\007\305\256m}'\367_\033\357D\237\314=\225\370\035m\353'\n\307\334{n/\342\203?\353\277\356\267&\026)\252\206\347\364\035|\203?\003\361\017Fo\212\222\210o\"\201\204(}\247y\006\200\302\250a,\b\021\202\204Df$HAA\223t\260\002\2211*\325\001\021\3200\251 T#II\322\030Z\272\254\244\206\316\3518\225`g\372\026b\006\220\320\235\016\370lA[\221D\353)\362}\234\320"
+	.string	"\233)/A\262\341Ti8K+1\035\246E\243h\334\252\273k\203+\273\340\032m=\211\306&\003b\264\215\210\001\022\261N\022|\372\034\3238Y\234\222I"
+	.ascii	"\3430\222\240\215\006\243\323\034\333\200\306c%\243(\201;\006"
+	.ascii	"\320\274\2676b\202\251s\032\343\007\005\336\233\006\343\233\n"
+	.ascii	"\031\253\224\264\254r*\001\3162\033\203\264\205\232\346\016\004"
+	.ascii	"\246\213\370V1\013\fN\310pz\224\375\020\"6\363s\036\017NOG\327"
+	.ascii	"fJ\243RQ\025\"\001\004\302\316\031\277k`\261\004\025w\241\203"
+	.ascii	"\020\314\023\201\221b\244\244\332\242\366e_K!C@\354\210l\200"
+	.ascii	"T\026\233)\3309\324\272\320O\325o\321\376E\336\235\374(e\260"
+	.ascii	"\225R(\240[d\202n\006\255\324x\267.B\004\236(k\353\264\264\373"
+	.ascii	"AQ\336\236\315|\247\266\247l\366\363\330#\"?\212\266jHVn\334"
+	.ascii	"\270I\201,\024,\003\245cj=\03616\355\267\334\030\301\373Q\007"
+	.ascii	"\026\217\216\310\3011i\342a\273\213\232\034\210\263v\337\216"
+	.ascii	"\374\"z\005\274nn\205\177\3018\265\260\030\314F\203`\240\373"
+	.ascii	"\003\324\013\364\nF\334\3353t1\363=}Fy\021s\rN\242\231\3770b"
+	.ascii	"Q\001"
+	.text
+	.section	.gnu.lto_cliAux.254.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\r\001\225\r"
+	.string	"\206Y]E"
+	.string	"\2216\035x*\031\001\364"
+	.string	"(>\204\362\211\270s\267 \002\261#6\354\253\017]E\317\336X\323G\263\377\356\203\360\003`+\017\272\330\342\200\020\350\265\272\025\224\306\034\331z\325v\376\306\351\037\370\355\336{\357\224\002I"
+	.string	"F"
+	.string	"K"
+	.string	"\027PO-\262q\020@\331\321\202\0306RT\360\330\335J\262\\t:e\024\371\217\371\007\347\215N;+\237 \336\312\345<"
+	.string	"\276\320\021\3003\315Og\202{\314\343\007\257\024#\247\301\356:r\236\312]o\033\202m\007\366C\001&9\262\277R\224\"\354\3130\fC\313\223}\230\237\312\350sN\202F\007B\345!jv\273\260\307\246(\f\224;\374\263\202\021;<\367\330~\264\357\362\027\321a<<d\367\204\202f\367K`\003\235S\177\377\324\323N3\226\314\321\262K:w\031\033\301[\\\037\250\356\204\f\227\335e\260\342,*\370%N\215\225P\277\244\236\376Y\2655\f\361\234?\303R#\225\362\226\033\220F\232C\275\234\220\342\206)\336\270F*m\r\033\342\271K"
+	.string	".^R6`\266"
+	.string	":\271H\264L\304\332*\213B\201\313\004\013\221d\026\307\026\b\013Y\225\t6\222U\326vR\201>\326.\\[\225A\323\266\312\363\221>W\236\374`\006h\003\222di\356\356\322\001\021$\304s\236\261\006\245C\315\220\350\213T\177\244^\346\001\027"
+	.ascii	"AYz\027C&\336\034\215\206\013\t\016\nm\"c\204\201,YC\027\233"
+	.ascii	"\245%xa\340\020\353\212~a\275\272`\331\261\350`k\315\252\351"
+	.ascii	"q\222w^\331\324\344\032\227\202\002"
+	.text
+	.section	.gnu.lto_printSerial.255.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\236\n]1"
+	.ascii	"\252U\340\022BP\346\316\030\023\222:i\022\314\373]\312\005\177"
+	.ascii	"\376%\320\243\255\322\264ck\373\347\227?v\224F\325\032\021\277"
+	.ascii	"\252\322\367H\032\023\210\"\223\340\351\"\276\230\204\375\333"
+	.ascii	"\277\241\253\006\373g\023\221[J\231RJ\001\030\001\001\001'\001"
+	.ascii	"\316]\301)Z\007h\367\247\347\003\241\257Y\341\236W\315\352\007"
+	.ascii	"\327{\335y\314\335\205\233\217\213,A*\331{`Ga\320\327l\370\254"
+	.ascii	"\302\345\3306\027n=.\366\312\314y3\216\224\320\327Il\003'\225"
+	.ascii	"#|_\250S\257l\325\366\332Ef\376;\032[\322B\330\221\241rhgI\266"
+	.ascii	"\226\032D\001^e\335\216\007m\257\fm\333\231[\256\347\222Mg\203"
+	.ascii	"\335\367m\343\363\362\276\320\007\234\324\366z\324F\266W\265"
+	.ascii	"\205\330^9\311<\207h\354\r\213\372\233.\267\020\276\357\013\365"
+	.ascii	"I\270m\025\332\354z\262\211n;dW\365=\311\215\327Ho\321\272@="
+	.ascii	"gX\023\325a\031\0177\275\206G\232:5H'\255\365\332\233N1w\221"
+	.ascii	"\234\t\351v\b\244Y\325\b\020\315\224 \347RER+\322\245\350$\363"
+	.ascii	"\365\353\257p\260\355,H\253j\223\340\027<E\347\230j4s\302l\276"
+	.string	"\3662\247\322\277\365z}\302I\345\246mgB\332\207\027\336\367eg:\317\232\213\315\314y\314L\306L\314\020\352\332\373m\335hA\234M\365\237\334`\254\177W\335\033\245\353\341!\357g\036A\302\233\351_\305\246\344\022\r\306\252\355\334\334\332\357XA\372\276\312\251\023\375%E\373\276\312\t^\222>\220QnLj\260\275\3667_\253PnD\t\327\346\350nx\341\343\225M\277<\007\271\204w\352\b\317\234\265\302\233\031\365Ff\032\350T\220\354\303\230\241a\376O\346\236\032${\302\177\204\271\212j\252\355\272)\264\226n\251\250\276\353\226\320t\335\021z\257\371\251\363\232\235\232\034\364]s\203\326\231\211u^j\235\225\212\316IDg\006\2553\222\353\274\200\350|\324:+p\235\023\020\235\215Zg\004\256\363\001\242sQ\353l\300u&b\235\207Z\347\002Eg#\321\231@\353,\344:\017 :\013h\235\003\270\316"
+	.string	"\210\316A\2553\220\353\374Ct.\266\316D\327\331m\235\333\325y\330:\263\255\363:tV\207\316\277:;\033\036\244\244\336<F\2719SI\372\276/\321\003E9\363dmn\330\344\305\017z\001O\340\013\374\320\263\343H6\031\266E\343\254\311\275/Y3\223p-\231\026S\257\354'\241$\245x3\331\350\007\240\334\253\346cVJ\027\0332~\001:S<,Ie\202\277\307\250\302%\343\367\2307\274\251\211\346\263\207\300\200\027\212k=S\302\001q(\032\317\035\001"
+	.string	">\300\225\266Sg\020\300\336\024\253\351\314\t\372y\240\344\\\307\201\363\346'\256EK\223XZn7\035\210A\345\f\033\330fn`{-\276\221\022?\367\211\337\313>\334\241\331x\260"
+	.ascii	"x\254Z\003\345~\357y\343\233\322\005y\323\267O\365`l\303o\277"
+	.ascii	"\207\337\3130S\317\376\360Y%p\331\307\251\327\237\372?\263\364"
+	.ascii	"\023\363B.\362\237\3462\354\277\372\314 Dx3\327\267\301F\326"
+	.ascii	"gd,I\315\034-\224\221R_\225\303Dk22\372\316\355}\225\315\034"
+	.ascii	"sl7Q\036\3106\363\1775V%\r\023\255\215\214\001\336\261\377\354"
+	.ascii	"k\no\\\223e\020\320\237\340\221\342\255\001\274\205\245td\344"
+	.ascii	"\265\205\004\223\221\005\244\325]_#V\300\320\302Bf\261 ~m\201"
+	.ascii	"!Udi\020Z\241\245\002\006W\206-\244VW\226\327\217\013/$\210\030"
+	.ascii	"/\300\260Z\276\202\240\265u\005\005C\013\371\002\352\252\313"
+	.ascii	"\013\n\202\221\271bduA}qquA\025\241o\377\021\274n\365\356\bN"
+	.ascii	"\005o\274\030\361\237\354.i\253\230\374\361Y\36697Ym\035|\343"
+	.ascii	"\265\353\366\267g\331\347Q\337\364\315\326k\267\216\372\276\357"
+	.ascii	"\353\016\033<\253j\323;\370&s\367\f\326\351\253\336\307\222>"
+	.ascii	"u\201wkb^\350`\332\177r\307\2116\227}\354\324\177Es,\373\326"
+	.ascii	"\376\353\247oFu,\361X\252gum\372\006\337,z\243?z\006\257\364"
+	.ascii	"KLJ\324W\355\303\370\351\231\230X\275-Y\352\233&\275\322\263"
+	.ascii	"\317\270<nI*OI\216LH\020H\223\276\243\274\205IZ\361#F\030,x\244"
+	.ascii	"8/\302FdA\230\351\005\037\242v\224\340\025\\\3614!A\022\304q"
+	.ascii	"p4\377a\364C\007\036\201\3678s\036\370\026\363\366\367\301\315"
+	.ascii	"\274\254\350\207\210\336\200\353\b\200\303\250QD&\rbdFFDJ\323"
+	.ascii	"\2445\320\002\221\241\241q\003\021 \255#\f\315M5d7SIr\362>\262"
+	.ascii	"\313J\202\310?\365H\020\034\377\322\262\232\006$R\372rq\330\364"
+	.ascii	"\311\353y\270\346\211z\274X\352f\312\337\232-\3715\277,\341"
+	.string	"\263?\013_#T\305XB\2420\303\033u0\361\222\303\177\314\320\336.\276\235\266m\273\301\331c\006\263\314\324\247\316\342*\022\343\377$\207\021|\213\354\371YJ\265\254\tk}\357(ckhRR8/\032\315b4\006\274\370`^+\334a$e\221\275\300\235V\241\220\275u\211Q\213[\347bC\030\367\306\214o\343!\035\206\255\b\321\3774N1\257G\261\315\227e\305~\310N\330\023i\027|\271\204$(\327\350\243\fl\031\321A\017\215\341xv\254\210\301t\211d[-\315\027\203\356@\274\232\016\360aZ\304\342bc\227\302\227\240\262\364\3035.\nT*\344\232;*\343?lX \336{EX\327Hrq$_\265\264\26031&\f:\274(\355\331w\001\314i\220\023/\221:j\305\006\003\333uf\320T\247\320y=\252\031( \336a\257\234:\344^\022\341\207w\261\211\2228'%\t\337\210 "
+	.ascii	"\216\231\334\270\270\006\306U\360\240?\206y\032\363\360\275a"
+	.ascii	"\210\360\374D\254\200~\256\024\354\020j"
+	.text
+	.section	.gnu.lto_cliSerial.256.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\205\r\355D"
+	.ascii	"\032v@\032=0\340N\007\207d\032p>\375\220y\024\017\211\233\b\311"
+	.ascii	"\f\336\230\245\021\2077\236,\244\2117\377k\024\307\312\247\324"
+	.ascii	"\254\360s\317x\320\210\310\n"
+	.string	",\324\370\213\331M]\023\021\241MvJ)\005\232\001z\001\225\001\201X\324\3502\374q\214}\350\372\356\275Q\357\300\026\3541M\330\207\034-l2\3256$\353\033w\237\217\212\203\223\367\276\225x\224vR;xC\216\"\031\r\f\034T[LY\337\265\213\243\217\342a\2030:\214.\344m\270;E3\223\367\002*p\002\366\227j\203a5Si\200\027\256\275\372\r\366!h&W9\2339\305\2663w_\373U\373oG\037\335{\347w\346^\300\004,\300\331L\006\354i\333Lg'\265\315\344*s\036&\265k\326@\221\217M0\320\275\367\352\2370\333,`\263\223W\233*\025\005\365\344\324\304\264\2444\005\220\204tdTD4$\215B\237\316f\313d\337\253\334P8\263\246J\331\305y\351(\256ECJ\250\206|\363\353\363'V\n\371\326\205\305B\224s''q\\\272\211\251o\211OI\217\212O\251"
+	.ascii	"\300K\312\303s$(GsFQ\366\336\240x\321\330\"\022J\273\270-M\324"
+	.ascii	"\314\272[t\243\264\213\343\353!\366\300$\342\237\206|\243c\247"
+	.ascii	"nT\254\235f\316\245R\352Z\243{o\333\275)i\215\336\246\260\321"
+	.ascii	"$P\226B\232\"n\235\246\251 \337\220\260\216W\207\262\021\233"
+	.ascii	"j\357\255\213?\235K;\251\354\342\216t\263!\337\216\260y["
+	.string	"\244\231l\222\234\241$\021\334\032[%y\005I\024N\315\331\366\332e\262\257\322.\356\257\237=@\367f\b\021\\\032;\205\323\344N\037\266\267\301\241\2717\263\356\275\354V\270\270\346\251fv\017\314|e\216\366\bg\216O\b\270U\226\252\026o+\326\367\242\036\342cZ\313\327\207\325.S:\367\336\007<\360\362\360\0359\363\3137wR\2240o\264\013\376\317\032\365P\371\3253W\275\\\360\266.x\257\243\227\345Q*\203\006o\353\325O-\350\252\267\372f\244\237\2315,h~\311O.mv\323\"\350.\323\2077\210\240X\231;|\360\302\312\267\312\311\265F\263\3638\31129\267\216\226[D\333f\372\315\t\237&\n\242\321\351\273\367\254M\273!\301\235w\202\311}\242mf7\212\2269\305\no+7!\225A\217l\034\350\207\215\311\377\225i\264\375-\002\355\244\271 6\362\252g\326\332\362\266\366\367as"
+	.string	"\004\030h2\355\315\230\001\321\374\257\314\335c\034\351\300\361\3371gYh4\315\023\"@x\320"
+	.string	"\253\007\233\0274\230\346+\253\376\353\256\202:\037\b@5E\225\3520\315QPC\316OQg'\247s\323\323\231)\352\274$uVz:O\243\316"
+	.string	"\244\316IOg\244\250\363\221\324\331\350\351\\\024u&\222:\017I\235\243Rg\250\324\371\331b\232\235O\347f\324\271\205:3\237\316l\237i~\247\2637\235[C\225\037\2648a\024\271\374\034\300\353vI\350>2\023\365\032M\367\231n0\335a\272\305t\017v\033v\223\271\231;\221;\rG\321\224\335)^\266\3502\334\210\034=\323\024\374\013\336D}\013O\024I\346\222*\353\312Y\3741y\001\257\201nK7isLr\177y\214KJC]\326F-\243\277\244Ff\214 \307i\2223yk"
+	.ascii	"$\375\225\231\314\263H<@h\220\346\314\034\031\261]\326B\t\365"
+	.ascii	"\204\207\276R$\341\034?\335\204{Z\212&\324\365a\331\022\226<"
+	.ascii	"\303J\013k\340\260\021\375\225\356\276]S\251\210a\034\372+G\273"
+	.ascii	"\254}~\333\0056\246\271\240\262v\302?_)r\020\320\032\035\032"
+	.ascii	"\237\356=$\217f^\210\035\325\236\310\221\016b+\275@\334\225\336"
+	.ascii	"\254\246mf\224?\234 I\225\273\344\032\350\303\314y\234\367\232"
+	.ascii	"5]\367\222\273\b\244\312\275\327@3\251\276\t\367\344\036\325"
+	.ascii	"\334\322\t\021\251{\213\376\225\233\317\276\230X\357\2512q\336"
+	.ascii	"\233\026\201{\262)\253M\330\352\265\372\244\255>i\233\331\374"
+	.ascii	"g\342\201o;\b\016\216\351\313\216\3212\377\300\263\263\035a\376"
+	.ascii	"\204\367C6K\004\316\342U\247x[\231?\025\341\331G\272z\271\204"
+	.ascii	"\020a\220\365\220O \350_\031\302?\030\3079\201u\246 |\247\351"
+	.ascii	"\243J=\312\2273\224\264\362\374+;b\267\233\265\220e\023A\377"
+	.ascii	"\267y\213\325@\n\013\005ib}\324\2671\333B\2757\037|\200o\343"
+	.ascii	"v\376\225NC\375\203'\212\374\233\263F\347z}X\265\322\326=\r\336"
+	.ascii	"\037\351\372\347\310f)\345X\r\276+\365\324<\246\275Y\363\257"
+	.ascii	"\034U8\250\221\331]\326\022\025V6\262\334e-\324\26756\326\177"
+	.ascii	"\374\3055`*\212aX}iy\211u\325\270\n\363Z\302\321\305\005\266"
+	.ascii	"\241kLk\004\027\231V\213!\257\026\013\233\001}\341\345\002LL"
+	.ascii	"\214lkh\f\214,\f\303\030X\227\f\262\027b\027\270\274\276\264"
+	.ascii	"l \211\215\315\370/-\033\337\005\346\365\305%c\253\311[V^_[W"
+	.ascii	"`^Z2\256\266\304j\\YM9lF\227\330\325XX\230\330U\024\360LHg\235"
+	.ascii	"=Z\013\241~\034c :\277\236l\354c#E\306\336kg\241\r\273'\301\370"
+	.ascii	"%W\360\242G\372\3513\275\323?=\373\222\252Z\323\216\361\316Z"
+	.ascii	"[\253l\316\265\356Q\240\231\b\232\253>\252m{ntW\311\233\361\323"
+	.ascii	"3\367$\351\320\371\3755\275\323C\363\356\004\316\031c\331\364"
+	.ascii	"&\362\360T\206p$rLJ\277T\247\304g\302\213\020\231&=\200\271\244"
+	.ascii	"\317\221\227\247R\205\307\301!\031\375Q\022\243\317\221\247\207"
+	.ascii	"\257\205\007"
+	.string	"q E?\215\2228\364D\337l\226\316\241o&J\022\242\363\373;\363K\226\340\r'\252\255\013\334\252p\336V6p\245\356qM\321\f\257K\324\003g\256\022\251\032\361\303>\"\274b\344\021\355\315\252\352d\321\002\345D}\206>\251\357\37467kg\2003I\274@\3064\027\264\347\351\257\\g-d\331\224\365O\365mn\205\227A\232 <;\243~\352\333\270I\352\231u\006x\352\267Q\r\330\343\350\245\273\331{\357uJ\242>+Q\237\331!j\317\2211b\311d\341\2315\242\276\324\2671W5\325g}#6\b\301\277\313\201\021\250QH\342\024S\204FDDD\222&i\f\201\005\004)\006\341\325\003\021P1S\322\324\244)\fsw\313\236\256\023\314%\367\261\337\031(\376\367\276\360\340\270\201\024\210\203*\fG\2713\253\2404\207\0260\245\370S\225W\320\324Rn\307\231\001\026\314#\024\nd\201\347"
+	.ascii	",\304=\377\264K)H\336\323Y\277\234\256n\277G]:\321\354\351@:"
+	.ascii	"\215.\304?4:\034Q\357\030\367\002\226\361\223-7\233\362\\D\t"
+	.ascii	"\360\315\321\201\244\213\020qM\201\361\205\253wP\323\353\376"
+	.ascii	"\260\004ua\200\221\347\275\367Qq\007\364{t\036\031\001\232'\032"
+	.ascii	"b\364\205!\016~&\023\013+ o\t\234?\364\247Q\201\214g+Z\341\270"
+	.ascii	"Yy\341\243\370\256Z\214\323O\0178W^T\237\224+\213\336+\336\342"
+	.ascii	"\335\316\033\f*\3338X\225\203\351\021U\374\310\017\2336aF\250"
+	.ascii	":\266\261[\316\3025\025Z\241\224O\2319\250\206\363A\004U\355"
+	.ascii	"\211\344q\276\271e\200\311X\004a/@\371\364\235\222\366\2014a"
+	.ascii	"\335\354\353\213\376\305\007\252\306f\231/\310z#\355\362\035"
+	.ascii	"\025 \241"
+	.ascii	"%2\3564/\353\253\222X\325\rv\213\232\315\013\242\034\027b\244"
+	.ascii	"\227\360\363\036\223\315C\022\031\305\202\200\377\013\327r\023"
+	.ascii	"\310\331o\345%d\022I\225\242\273\013'f\3346\324?\361\0032\227"
+	.ascii	"\340N\035}~\033F\3614\302\364\342\232\350\3125\202\344\320\246"
+	.ascii	"$\351\273K\026\276t4!\310j\263\340\364\034\306\220\233d\217\345"
+	.ascii	"\016K6O\240\335S\332\371\263\"D+\235\023\254\037\023=\277J\031"
+	.ascii	"\270\030\177\254\233\001\020\261\324v\233\310\213\177\003\243"
+	.ascii	"y\207\251/\024B\247\005#\241\304\272\211\2234\314V\t\306i\277"
+	.ascii	"x\207\277\330\321\232N<\013\366\311V\r\247\374\252)\006\351O"
+	.ascii	"\321\324\231\246K(!0\tGlm,]\313\f\212\276\335\271\323)\004MQ"
+	.ascii	"\245\337,\344Q\372M\263\255\006"
+	.text
+	.section	.gnu.lto_cbCtrlLine.257.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\266\0015\020"
+	.string	"&^jF\360\260(\035\373\271\367\3245\021\312\247D\323wZ`\001\b\375\352\b\022\276\272O\310Af\310\021\034W\257m\037D0\256.yIF\323@6'\033\225*\"3lbt\351\370t\322`\311\254\326O\b\331D\312\224\002T"
+	.string	"T"
+	.string	"T"
+	.string	"F\340=z\366\020\367\350\235"
+	.ascii	"\367h\320\246a\200\265\251\00603-\226\232\335\375\324\303\301"
+	.ascii	"sq\323\004\375\323\316q\205\251s(\217&\235\220\225\033\2000\303"
+	.ascii	"uK@\263\242\006(,\331B' \\\247=1\204\253\314\356\301\356:]\341"
+	.ascii	"\353\356n\233d\333\201\235^?\247i\325tn\351\007(\360\002\305"
+	.ascii	"\353*l\354\236\324nlLd\021\342-\277\375\323\334\361K\234\005"
+	.ascii	"|\213[|_\373\0130`jhv\327\343\321\f\274G\216Mg'\001^\205\304"
+	.ascii	"q\267C\f\005\336\243\200|\332\027\361\021\340e\236\371\200]\230"
+	.ascii	"\354ew\266  M=\355\020b..Z7\252\016\316\243 \355PVY\363O\302"
+	.ascii	"q\324\243\316\326\206\325?\330\320\274\250\306\354\361NU%#\263"
+	.ascii	"2\243$m|\355\364)8\275\202X.\264\326\215*k\366,\225\032\263\277"
+	.ascii	"\355\356ZavL\203b\372\023\323\236\253\374\234\267\310\002\244"
+	.ascii	"\n\245\217\b\236\322\t5\332P\026H(\021\323\250\363H\004R\032"
+	.ascii	"}\" \037!\337\3504\362\211B6M \235>\224\311t\372:\263\275\302"
+	.ascii	"8)\032bT\272\342:iK\b\371\211\2240f\245\251\2501wp\237\003*\231"
+	.ascii	"\332\212\f\023\347\350g\3632U\325\2460\222w\231\203\245)\213"
+	.ascii	"\364&\034\002% P\002\"\205\331\001\301\271~6\006\266\305\217"
+	.ascii	"\363\277\3132\214\206\\V\244\030\314\"\342\220d\345\261\246\307"
+	.ascii	"B#_\341\233A/!\276T\241\030|)Ej\357x\003\3141$9\tM\351e@\373"
+	.ascii	"\333e\177\226\271~;*\215\311\0355\270\221\027!\203\025\207\024"
+	.ascii	"o\3235\204\005\005"
+	.text
+	.section	.gnu.lto_cliParseSerialMode.258.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`v\001]\016"
+	.string	"V\233`E\020\221\223\016\030\002\360\343\027'\326\275\216\357\260\375\\\254\0350\023\257\357\300\301\023k:\344yx(U\230\301\276E6\266\275\367\212Dc#\031"
+	.string	""
+	.string	"\310\007E \035\362\003\345,"
+	.string	"\371\200\316\212!\204\354-eJ\001N"
+	.string	"I"
+	.string	"O"
+	.ascii	"*\007\241\025/\301\312\245\305D\216\335\325\n\034\344z\204\377"
+	.ascii	"\270\036\365\303\271_\021jr\376So\020\252\271\031y\237_\034\036"
+	.ascii	"E\241\2040W\370\021\323\242\025\300c\201\"\255"
+	.string	"S\207\247\236\235\007\312\304\030\354\256s\344\221n\354\266Ql/\260\237\"G\335\232\351\314\3643\0026.\244\313\270\261\373r\263cY1\006\210\243~\233\363S\366\360QV}I{\r5V\033p\354n\310\243\021d\217i\237\304i\270\177\031>`\267\264z\261\373\215\330@\366\350/\263\355\213\370\b\316\016j\262\200\356\344AE\016\200\205\214\215\f\271j\207\342\271BA\206\200j\312\326)\006\206\032\303u\205\220\262aI\035\306\362%~\"%\333\025}T!\023\215\034x\274\324\266p!?\272^\305\214\f+\244\037\373\373\244\232\354\303\325\222\215\375\373/\030V\361\250U:Z\022a;\201\0226\217\232Cb2\201\243\241\230<8\3218\235\024\215\004\304\033\205\222\216\346\331\266\216\346\361\355\341j\311O\375/\335\311E\304\324\020\252B\355lC\375\214\031\032\326\212\202.\347\255\272T1\21554Z`@y\023\003\035"
+	.ascii	"\3571\346\2107\350\025\b\254\240\207\r\315\260\027\264\016\034"
+	.ascii	"\001\333\001f`\t+\344HB\212\212\270F3\001\272\206\213\254 -Q"
+	.ascii	"\214\212\027\267`\212B\215\240\212\fNL\322\006\261 \022(\003"
+	.ascii	"\362\005fL)\024\024"
+	.text
+	.section	.gnu.lto_cliSerialPassthrough.259.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\246%\025\257"
+	.ascii	"\332\027\361>Q HYZc\023\354\301\3101\231=\325r\370\230\030y\r"
+	.ascii	"\037\375\345Y8:x'w\327l._\351\315\267^\3150\312\222~\354\367"
+	.ascii	"\341o04\256fW\n\f.\200!\337;\215\237?\225\005x\017\337u\355\030"
+	.ascii	"\210\344\246\325\361\242,\331\223M\246\224R\343\003\215\003\354"
+	.ascii	"\003Nt\\f\250P\221<\336\333\3735X\302k\025\212p\326\177\335"
+	.string	"k\272\371\272\365\272\361\272\317t\223\351.\323m\327-\246\273\256\373\255\233Jw\\\367\225n,\335Z\272\271tw\351\036\241\177\230\233\271I\340f\303\305?dX\036\t^e\324p\373qq\315\003\304\254$\360\360\373\222\206\273\217\213|X\3756_\035|d\006\375\346\364\270\367\216x\254\221\021\364\313\303;\332\2512\bg\206\373\216\213gv\244}yohc\270\255}\345b\031\236\366+\366\266\005m\252b\374\312\206-$\223cBW\037\030\350\260\312E1|V*\027\305\350T\331\003l!M\307\r\206\213u\024\\\270\263\353\260a\013\331\226\322U\332J\313u\226\336\322s\355\245\247\\\024\241\2770{\004\035Z\023\244\324+`\3555l\341\277#\332\247\355\322eMm\311\205\247\354{\345e\245T0\357\225\226\n\330w\354\375;\252uMm\001%N0\033K\005\256\326\333\373\325J\251y\017\\Q>qY\340"
+	.string	"\265m\311\373v\201\032\306))\274\327\267\301\370\250n~\357\373\346b8\245\341\230M\205\247\356\216\2677\254\225\332\275\275)\206-t\331\366i\337\224\354;\366\366\212\265w%"
+	.ascii	"\256\001\276\357[R\013Y\211\271\235\271\327\232\215\331m\312"
+	.ascii	"\256\360\276F\300ty\337\267%&\032\266\220\337\032\250m\341\260"
+	.ascii	"}\332\0262\231\325`\350z\265LP?pV\001|\337\267\351=\030\0169"
+	.ascii	"\356\204\273\006\326\031\034\034\034l\366\255\371G\310l\226\343"
+	.ascii	"+l\205\343\270\nSa8\236\302R\370\315\005\003-X\254P\221\302i"
+	.ascii	"\001\024'L(P\202\304\210&\246%\245$$\021GF!\212\210@|\360\340"
+	.ascii	"v\3400$\264AC\006\fA\027\030\013\320\217\217\205\n\024&\364\030"
+	.ascii	"y\212;\304\241N+d\337\231\334:OZ\315rWzD\213\2205[au\272\276"
+	.ascii	"\314\204\234\342\370\211\320{\0268\307]\213`\320\\\205\355A\345"
+	.ascii	"'Z\344\202f8\241(\327\004.D\271\274\234\247\370=\235\245\260"
+	.ascii	"\271\240\257\331\037Q.\036\316od\0041h\027{\315\n\211r}\r:\003"
+	.ascii	"\202\335B\020\rl\216\263\020D\003+\301W\004\312q\025r:E`\034"
+	.ascii	"w\002\354\005X$?/o\372\n\006\310\002}\231=\3278\n5U7?\321\201"
+	.ascii	"X_\233P\200/\215\227\330k\022\254K\265:;\030\031\022\330h`z>"
+	.ascii	"b/\317\233\230\310\364\322\230k\325\225\222t\236\220\250b\\\004"
+	.ascii	"Qu\216s\356(\f\0307\232\353\020s\\\274(*\266\245\211\266\260"
+	.ascii	"\356\235\026\007a\367\001\f\013\032X\026\367\240#\345\003\344"
+	.ascii	"k\227\365!\323\202\246\257`r\254\022\232&A\372z\305;\350<U[("
+	.ascii	"\345\263\256\005F\305\372\232C\233\017\265\265\320\032\353\262"
+	.ascii	"\371\006\026\350\0034&}\005\213\302\"M\267\314\235\271\006(\235"
+	.ascii	"\241'K\235\031\206'T5\017\252@TMr\241\267\2404ca\235\266\274"
+	.ascii	"sBQ\256 \254\016\332 \223F\0033s\240+\230\222.\377\361\320\201"
+	.ascii	"X\222\366\241Z\320\203\253\240\302,\216\202\233\240\316\231\300"
+	.ascii	"\262`S;\322W0$\354O\261R\327h`C\274\007j\274\202m\300\272h`H"
+	.ascii	"\234G8\346KQ\347i\332,\024%k\340\360\260\204\375\350\235\037"
+	.ascii	"M\324y\022C\322Cv\310\314\030'}\005#c?\b\341 KO\333\003\032\330"
+	.ascii	"\230\3538\222n?8R&D\203v\030\005\013\322\016\337\367\335\ts\266"
+	.ascii	"\303\346P\330\336\331uY\013\214\212%i\266\211\250f\316\271\036"
+	.ascii	"\321\"c\375,\022\324\256GO\330\016\026\250L\021\276\236\266{"
+	.ascii	"\205q\271\353<\275\357\313\376\f\023k~\240\231[fv\036\314\034"
+	.ascii	"*\004Wx\272\264\345\371W\341?\f\024 \033t\313A\361A\341\245L"
+	.ascii	"\224\305\315\254\247\307\376\350\275\230!\360\243*K\275\242\274"
+	.ascii	"4\303\246\277F\313\276\345\032\327K\013\264v\361\236\032\340"
+	.ascii	"\004\266\245Z\n\337hpcz\354)\274\317\035\0312=\366\254\\\232"
+	.ascii	"\033\353\216\t_f\317\236\t\337moK\022\330\f\233\035g\302\013"
+	.ascii	"y\261q\200\332\3710\276\224\223\272G/\206\033\277\351\234m\t"
+	.ascii	"g\031"
+	.string	"8l6\033\243\026.\345,\347x?{\336}r-&\227\367\323\030F\203:\036\236\177rT|\236\026N&\017\357g\361\313\230\227\342\316\207\020u\001\250\372$\376\016\361_/\215\315\272\343G\267\\Z\024\353\316\260\211\n\277\200\371\345\375\034\372\004\2469\261\n\211y\235!\276t\tO\205\362\336\367U\352)3,\250\354}_\247\026~\337\363o\313\0073p3\246\217\341\373\356@\301\256D9\205\t\204\202\266\205:\337hJ\370\236(\340\303\267\231\032\264\314\314\r\230C\240\337`\272\327\274\236\370\005\272H\222T\031\276\224[\331\266\337\321&o:/c\026\031J\207\315\3063j!\f\017\230G\274\237\355\273\\\232\006\326\256\036\375\344\r\320O\313\347\350\274T\254\371I\313\347p\367;\267\252\325\366\245F\330\245m\225l\t\007\354Q\241\337\232\032\224}\b\233\327eMM\b3\245YB\306\036\304\233\247m\013\363\226"
+	.string	"\341\245.a5oM\355%\342\203\225X\315\360}\265\032\312\314D^\252\226%\236\0013\253\351\206\372\363\025\321\302\030\337ri?\276\240/\231\013\276\2314S\260\b\221\274\351Z\216\251\344'\357\331t\016\306<+\312{\337f?\231L\206\315>c\324Bf\023\246\023\357\347\215\377\311\222\346\027\350\327|-\366g~\341\027T\365\363\317\275\216J\304p\036Q%\330g\236\341N\236\226\340"
+	.string	"w\207\345\357\237\375v\nn\371`\232w1\237\240`\327\212"
+	.string	"3\3120I\013\377\211m\276\345\\U\334I\230\311\306t\363~2\335\332\026\372\033\215@\225\214U\265\314/z\260\252\34543T\3179\342>j\231ct\234\250!S3\317h@\2362\nf&\321\323\007\330\251\205\021Pb\007\330f\313\007\205\004\337\230\261\031\2349"
+	.string	"\002\360~r\313\205@\265r\365\300\001\003\366\\A\333_\003no\207\307\341\013\216\200g\226\300"
+	.string	"\336\317\376\236\366\003N\336"
+	.ascii	"\375v\274\026\363\033\227\277\224\271\223\336pq\3437\302\334"
+	.ascii	"\321&\322u\315\r\355\261\376j2\315\375.u\364_sV\257iN6_\363U"
+	.ascii	"\3435#o\3548\037\273\255\033\001\255\327L\243\337\232g\364\231"
+	.ascii	"f\007\332\2569JFSi\216\321q\3150\240\032x\361\344\202\201\356"
+	.ascii	"\322\334\202\350\314\202\350\274b\3079E\213iv*:/\260\343\214"
+	.ascii	"\202\350|\302\307\331\204\005g\005\334\271\204;\223h,\315#ZK"
+	.ascii	"s\023\321\231\211\350\274T\301Y\211\202s\222\321\031\311\350"
+	.ascii	",\342\310\350l\324e\232C\020\235\213\214\316DFg\020F\347\017"
+	.ascii	"Fg\017Dg\267\350\334\201\350\314\241\2714\017\031\235\205\212"
+	.ascii	"\316\033\212\316\032\212\316\031\212\316\030\212\316AE\347\013"
+	.ascii	"Fg\240\242\363\217\321\331\247\350l\241\350\\a\2023\205\242\363"
+	.ascii	"\204\242sO\217\263\321\350\314St.\032\235w\212\316\304\242\363"
+	.ascii	"\220\307Y\247\235\333\242\263\260\350\314\3568?"
+	.string	"\321\331\335\271\273\203l\225\017\244\n\274\224\277\331J\337Q \257d)E\351\257\316\354J`9\222\006\313\r\302 }\322\007lsju6\0269z$\036\351[p\310{\260\344`\230\364Jz=\342\245\214$=B\372\344\331\b\201mM\"\212,\213H\207\315\267\246y\360D\242~\362\230m\314(]\227'\342\233\346\310\230\034\340F\357\"Y*yb\355z-\206\300\215\314\374\006\3133&\303\346\243\245Y\233\2575\004\032d\311(H\224\321\353\210\225\220\007eks\307\200\374\350k\323\270\003\204\323\266\255\201\240\324c\371d\350}"
+	.ascii	"Iz)\023\3752l\331d\310\311\260\351~im\031X\233cN\270\220^\312"
+	.ascii	"^\006\344\252\325.\331\353\022q\355a\233\252\030\347\234\321"
+	.ascii	"\362C\204\370F\363\030,\237t\2102l\372\027\271(MUz\034\025\375"
+	.ascii	"\021\220\2662l\314\024\275W\225\322?\231a\304\353\033\020\240"
+	.ascii	"k\317\303\253\317?)\347^\272\265 \236\350\233\232{)\245e\270"
+	.ascii	"e\025\357g\321\263o\220\030\317\025\265f\214\3029\003]#z\241"
+	.ascii	"\bp\254P6\250\327:\3528* \236\304\0248g\214\372\250\025<\322"
+	.ascii	"\371\203\003\002t-\304K\331\313\252z\3169\"\257\3536R\255:\347"
+	.ascii	"@\264\233v\340C\tGCey\037^'\ngI\321Oy;\252\r\\\232\265Qk\363"
+	.ascii	"K\200l!z\251\357\265\207\357(\234(\241<\017\337wm$\366\006\020"
+	.ascii	"\312\326Z\317\310@\270\337\327\245\025wS\325F)\270\224s?\304"
+	.ascii	"\221&F\231T?t\216\266_6\007\360\016[\226s\3577\023\022x\332#"
+	.ascii	"\2245\227\274\016\337v1\353\013lS\352\250_\276\n\263>.\2748#"
+	.ascii	"4\r\027\017/\205\276\037\355\277.!\270\034\376\247\274\211\002"
+	.ascii	"\267\267\246J\311\317\3250\303Z\210\031\032\300>\035\334I\246"
+	.ascii	"K/\314\341\373\332,\0243<.\274,A\224\302\326vtP\253\3129\347"
+	.ascii	"\206\274\256\247\250P\234sB\355\246[\274\027sx\351O\320\367\037"
+	.ascii	"\234^Q\2037kC\026\346\274D\021\352\250V\350k\350E\t\211`v\346"
+	.ascii	"\311\2054>\300\r/e\0351\0316\374\357\321Hj\031-\343\205\177n"
+	.ascii	"\334\340\032\256\314\t\006\032^\312\030~\003\336\362\313t\330"
+	.ascii	"\3648\031\277!J\232\006\317\221@\340\242\226!H\306;\275\027\212"
+	.ascii	",u\030\004ax\341{\t_\303\267\235\237Y\326\r\205\0316\275\211"
+	.ascii	"\353\364\032^G\232f\256\351Q\002\253\030^\312L\235\341\223\003"
+	.ascii	"p\f\325%\031\357g\206_A\304\312S\024\313\277\023\030\276\251"
+	.ascii	"-\024cf\247\344w\305G\020\004c"
+	.string	"\226e\202\314\f\233N&\007\245\316\372D\350\256\027^\312\335\030\330\240\241\243\361\003\365#\336\213\177^|\323\217\213\037z\257\240\277\3605\250<%*\343\220\027\364DG\332\302\360\364Gi\302\205\027\212\271)\203\262\265\365`S\003z)C\240\272\001\221\237\242^\211\361^\022\250B\235s>\035%\032\241\2729\347\330\033\017\243\0016\250'\226\272\346\264\302\266\233~\361^\314\3720\360S\324(\31696\251]\274\027\037i\030^\366\343O\n\0333\354\373Rf\326\b\265\243F\345\342\234\033z]3\017\324s\017\324s\013\365\r\274\027\033_<\263\303\027}\3169\236\356\nZ\356y\361\342\237\336\253\247\335C\262\270a`Lj\036\272xfy\\\354\030\241\306q\3161\333\272x\006\336K\002\320$S\346Y\267\201&Y\336\265\035\375\016\204\302fU\352\030\337D\236\205\031\0278\2748(\227\017\362\260\354m\245v`\326"
+	.string	"\337\267WD\373\034-\036S\037\240.G?\017\364\343\244H\023\013>[\226,\274\217\205\177=(C\2104O\026/\326\300\noc\251\232\300,N\255M\205\354\016\240"
+	.string	"0\334+dr\312M\"\215\334\314\224E\005\201\243\213\314\302*r\2178l\350\260\341&\217\024 \257\\\245\033VTSI)\n\222H\031 \230i\312m\200"
+	.string	"\022\270\311\343\004H7K*IB\0042\253\n\231d\200;u\274a%\325"
+	.string	"\033\356q\nYU\304\306\235\033VTYYG,WI\307\224\3241\211C\312\305\242Z\33212M\025\271-\334\251\034R5\334)W\211\210\231\246\216V\307+\244{\254\341f!\255\334)\0349\2206\334\251\"!v\247\212\\\025SE<SE\026\370X%\205\345\036\223Rn\tw\312J\312\215 \003O\025\271\311c\215\252\034Vn"
+	.string	"fXQE\340NQ\341\220\232\300j\006\006>Z!\255\204\3342\226\002l`\035\213\354:\222\312\217I)\n\246\222R\016$\217UTY\306\033RY\237e\225\003\t\205\225Df!\253\212Y8rH1\340\b\343\210%\001\026\025\205\031\022\020\251\372\006\025\003\254\220P;X\302\032PS9\244\0328\342\250!eu\344If\301@RYQE`Lf\301\260\n\300"
+	.string	"Hd%\221W\023\032p#\0072\331\200,,,\251\b\222H,\253#\001l`\035\177\222YW\307\t\244\260t\034\200\314z\b\034\247\254\250\204\307\033RXXG"
+	.string	"d\035\261\216I\236\243\025\025\216\251*\033:l\203\211\n\207\215&+*\251\252&\033I\254&& F^\035\223MYHd\262\251\370\266\325O[\317%e\006\361\305\372\324\240l@j:\260s\340\245W\330\367\215\272\350\021\272\375\2460\361\2776\267rH\273\342Yp\240,\342|-\253\022\2072\026O\034S\345KK+\336i\032\246M\211\007\312#G\256_\242^\312\306g\f\035/\214\343\242\3454\215\367B>\215\367(\234\335\030\234%2\372\250\245\361:\276\367\372"
+	.ascii	"]\203pb Q2A\203\361\322#~\246d\362r\327!B\262\016\326\240\206"
+	.ascii	"\332#\361\332Cm\212?>\273s\214K\331\344\351\224N\336\3132\210"
+	.ascii	"2-\305\267\0205+O\332\212xRGQ\262]\203X\273\210xR\177+\245\264"
+	.ascii	"Yp\312*W2kS\210\2342\213\3673\353\233M\373\004^\201\354\240i"
+	.ascii	"\tl\240\037\320&_\bG\005\t\334\036\231/0\247\364\342\375L\276"
+	.ascii	"{\365\013|\373u\002\234\026\314\371\250\275u\275x)c\265W/\344"
+	.ascii	"\242Rd\357\267`\265pbV~y-\312\351\211<e\335gQ\206i*{\337\035"
+	.ascii	"(Z\310/\367X\224TfeU\251$\323\266\360\352\337\234\r\006\212\260"
+	.ascii	"\345\203*\332\264i{B\361\310\367\251S\360\313\214\362\316\373"
+	.ascii	"\211\342Y)nr\254\\\257\305=\001\027\266R\257eV\246Q\366\271\001"
+	.ascii	"*\327\b \257+\310\271\301\261r\271\030\361\2775\210\007\307\300"
+	.ascii	"K\235n\342\233N\311F\351\346\3043+\341(\003\245\030\345\235x"
+	.ascii	"\342\233\370\336\342\024\034z\005\336\206T\020\317)\270\265F"
+	.ascii	"B\227\026/-\361\305\253\240\034\270=\022\337\364%\276\235=\222"
+	.ascii	"z\350I|+\025\264\342\034\201\313\007\373-\252\305\342\245,\334"
+	.ascii	"S\301\357\246\224su\306\007\250\2343l\262%\030\265\360\241\244"
+	.ascii	"\340gS\016f\235\341\001j\r\233l\034\243\026\316x/9pz\020\370"
+	.ascii	"\214o\272\217\262\344\002\352\0326Y:\021n+\322t\3207\232\035"
+	.ascii	"\031\374\251(\373q&\305\033i\372\337\0224\003\347$\001_\372\246"
+	.ascii	"[\"Y*\031\276\357V?\231x,\275B\250\342)bz\"\bU<qK_\342\f\315"
+	.ascii	"\023\035\336t\217\266\374\n*\013\0336\331$\031,}\270e`\335\241"
+	.ascii	"cd\353o\201\026c@\376\264\330\230\261\300\203;"
+	.string	"\024&\372\353\177\217CRG\265M!3\223w\242\277\276\253\315\3061C\303\205\027\227T\346\215\237\211\227\236-\245\b\225u\220\263j\203\023\250\002\341$\320\302\034c\b\221\214\310H\222$\035\242\n\020\006\243i\236\326\364\006\022\340tE\251\2352b#\222$Iv\306\321\351\332m_A\255Ic\352\r\236\340\310\270"
+	.string	"\n\346\230\345\03211\300\210\206\312\305\202\345\022\007\272\016x\273\333\317\240\210\245a\254jD\341\211\307B)R\013t\351\356\333f\321hY\361\240\"\211]x\027\rD\030\334\231\366\227\033g\251\206C\235\0204\215e\210!\330v\364\002\314C\373\352\326i%\2449H\276\354\002nN2\314ET\336|*\320\300=r\274\3453\267xH\352\377\375\374W\207:\200\"'\034\016\376\230\037\303\004\255\221AvQ!d\366\215.%\315lg\210\322\022\331aF\035\263\313K\373W\324\226F\027\nIL\317\203V\222\303\304x\333S2\320\206\330l~\214C\236\332\244?\252(\240Y\240)\263N\210\3552\330\336\226\371i685\347\006\232\202^1\301\r\351\205\343"
+	.ascii	"\204\034\343\222\275\033\237\251\273\237#\267\0267F\001\202\322"
+	.ascii	"\242\263\275O\207\242\206(\374`\366\213y\363\366\324\2560\024"
+	.ascii	"\035\242}\017\265A\333\240 \335\016\335\263}\306U\350p\306\231"
+	.ascii	"\302\315O\305\356'G\277\266\201\037H\3569\347\313\2422\022\030"
+	.ascii	"L\327\t\231\017\204'\220\3254\211\177^<3m\003A\234\275\303\272"
+	.ascii	"!\310\361\"\f\307\353K\316\207\241N\314\177Q\227\033\206\367"
+	.ascii	"2\274\222\305\367$\034\373\202\017=\f\251\030\363s\363y\376\346"
+	.ascii	"\235\001\350\363\037*22s /G\027|\b\362\342 \033\264>\241\032"
+	.ascii	"\326\017\002\017w\302\006\234\214\331\022\322\255b\274\376\200"
+	.ascii	"~\002\340\335\361\027\026cj\n\367[\302\217S\374V\343\212\026"
+	.ascii	"\221\023\376?MF\245\007\307\352\355\242\001\006\250\340\025\210"
+	.ascii	"\025\344\177\267\004\226#\370!\333U\304>\006O\313A\374\th\202"
+	.ascii	"\333\232an9\232\\\307\307\t\247\004\220i~*\243\202\236\342\227"
+	.ascii	"\0028\206\002\003\272\304\355\317\300\001\200\244\221\330-\216"
+	.ascii	"\273\2534\310T\304\317.Q\n\244\024\253X\376\256^\020%\230\035"
+	.ascii	"b\274\310\003j9;\255\352\025\303u\303\277n\246\031\277\217\230"
+	.ascii	"\365\030z\203\366k\220\310H\337\255\206\331\r\244"
+	.string	"+\306\331N\2466\343\177\005x\247\264\326\206\357\02332zq\007\250\214/\320\247\007\212v \202\364\3017\303>\"\360\334\206d\224\256\006HE\344\b\225C\363\246\365\177\206;\275\233l\007{\253l\027\227O\024\245]TNT$\267\244\3208\226\236\006\004\230\367\327\030\350\345K7\230:Q\301*\261t\311\366\314R\244\272j\334\330+\235\204y\\\017\327\203!K\2269\234!\007\372\030\023\367%\254\201\364<\226\260M7\035N1\245\233\376\016\024a1\356\033\005\024\214\024\357+\032\210\206\006\227\032\257\341\307]w\352\231`\013\364M}\034\274T\234}\216\376\360\361\225\341\222g\037\323\324\t\343\004\214\303j\2431\037\204l\205\311\234\r\2352Ci2\341\300N]Y\211t\b\211\202\341.7@\207\204z\222\276=\021\200\322\356?\032\017\245\022\036\224\035T& \314(O\374t]+\215M\351\315\253)\b\270\343"
+	.string	"\363\257O=\006a\304\004\330\270\037"
+	.string	"\221\r\342:\273\034\235\377\270\234\300=$xo\n\031\230h\004\252\331\376}\253j\216\360s!\331\351\b4\023\242h\0378\230}\222\335\341{;\302\313\227\367\240\265\372F\013\311\310\275Z\223\374\017\260\021\325 \304qI\265\365\252\261\013\2225\305\017\306\254\016\225\273&L\341:\260\204\004\224\211H}0\207\220\211\t\240\252w\013\256+\301\216\217t\355\034r\365\002]\022mSN\3610Z\007\033\345\347\243\232u\022\n\370uF\341\315\361Y\362\r\223k\377\013D\310"
+	.ascii	"\262\200\320\244\316\032\253\f\031\216\200\220\036\337\230K\031"
+	.ascii	"\252K5\034#\272\353\017\fU\266\275\355S\353`Rc\267J\205{.\006"
+	.ascii	"=\305\251\251\374\336i\025\301\265\035\361\006{\242\200\005\330"
+	.ascii	"\203\231\nh\341\331\361\313u\303X\361x(~%3\224\005\272\311\334"
+	.ascii	"\350\206?D\330\302!\020'|\246\020\261r\266\220\013;\203\207\025"
+	.ascii	"\321y\037\025\372\312\220a\202W\006\233@\327\205\332IP\"\274"
+	.ascii	"\326\237\375\b\264\370\033n&\fl#\234\337\0074\235\273\211\361"
+	.ascii	"GK\340P\177X\025jMA\250'\344\261|Y\320\302\r\262Pb\236\217\227"
+	.ascii	"\256\250\232QW\305\212\317\270\300L\304\035M\300\234\034\211"
+	.ascii	"\330\255\024\324\366EZ{\230\270q+Fs\352\245\\p\2649\300\211\""
+	.ascii	"F\333\277\b\002\027\312\314k\362\t\373x\204~\316\237\"\256\230"
+	.ascii	"\204.X\301\317\323\232\377V\032\375\206\030\210\321\033V8z\210"
+	.ascii	"\250\346x\2151\243\256\022\247:\374\005\215p\261\264R5\250P@"
+	.ascii	"\273\033\217\333\035F\344\254\0235(4\226\003jxS\226\301<\236"
+	.ascii	"|\001\273\314\213W3\217%\352O'\320\351\273\223`$\207\236\240"
+	.ascii	"\240\361\224^\214\335\217\243\327\267\240_\375e!\312\311\240"
+	.ascii	"\336\363\2301\362\350\310\274@\320td\323\342V\0049\351\334@o"
+	.ascii	"\301\254\320\036I\260D\n\204\202\300\330>JDw2\370\245\373\351"
+	.ascii	"E\324I\215\"\257T87/\f\214\033p\032\252\026\201\304\033q\234"
+	.ascii	"\320\017\357\3702\025-\236\t~@\321\033\221\033E:\311\207\366"
+	.ascii	"q\301\3409\324\b\031\256\362\346\030\351\210\256\3303\201wP\252"
+	.ascii	"j\016\207z\313\n+\334\177\f\276\007l\317\036\036\330 \335\316"
+	.ascii	"\373u\027n\337{dt\025H#\026\006GAM<\301\351\222\277\2000\007"
+	.ascii	"\0254\210\251\324W\375\00545 \230W\243\305\003\017\274\272\224"
+	.ascii	"\001\203\247Z\\*\376\362\234j\327\231_ \244a\227?\360\340\231"
+	.ascii	"\270\177\200f\333w\301\350t\325\274\270\202\023b\332v$|\307\254"
+	.ascii	"\005\351@\002\247\216!\n\3413\376\336\234++\251\363\020"
+	.text
+	.section	.gnu.lto_printAdjustmentRange.260.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\213\bm-"
+	.string	"JR\310\021B`\346\312p\365\342\316\320\036\0211\277\225\031\320q\374"
+	.string	"B"
+	.string	"\227\302i\322L&\217T\356\216\003\331\f\257\314\016\202z4^\271\323\261\341^\301\336\021\266\223\b\2736"
+	.string	"\362\315Vw\350\2757\331[\312$\003\b\001\355"
+	.ascii	"\023\001+\217>\203k\232s\017\356`\376.\177\336\177ws\367\273"
+	.ascii	"\377\262\337[ 0F\312\034I#\227\275\227\353-P\336\fs%\222\\}\024"
+	.ascii	")\331\376`4\200`\366.e\303\263\344\312\003}c\003\364J\277e\217"
+	.ascii	"\267@?w\367.\3060-\271\266\375\370\261\245\221\313\263\256I\252"
+	.ascii	"\237[L\177\036hw\333N\206\226;\021u\203[\234<\026\263g\231\221"
+	.ascii	"D\264\246\3219\251J\177n2=\357^\356W\314>Gc\325uM\302\367e]\223"
+	.ascii	"U\013\225\376\034\376H\370\323\274\221\360\347\232\355"
+	.string	"\312I\272\261\236=\b\204;j\311\263\256+\261\337\266\351f\362+d\263\243\302\323l6\333+\357\204\034\244\363\303k;;j2\016/gCmGS\013\217\224>\307Cc\341O\024!?\203\3344\231\372\370\250\f\265\3350\235\212 \341r\2753[[\032\367\361>\205\344C\363\303k\023rF\271\326u]^k\363\361M\277\273Dv\027\311n\212!\334\021\032\253M1jS~\276f\204o\356\253IA\343>k\325\357\353\375\004D\362\321\371)\371\330\340>=\307\312\220eo\020?h\252;\350\335\260\025\374\265\253>\3321\004\312\022P\255\317v\223g\334LvOT\367\207c{\311.\227V\326\301|'\274\356\227\360\274/\326\263\374\021\256n\367?\370\334\357\340]\276\304\337}\255\252n\367]\200\362R\241\274S*\257\002\2247\001\312+\205\362\"Py\243P^(\224\367\t\345uRy\017\240\274C\225\327"
+	.string	"\312\333\244\3622\241\274K)o\001\224\227@\312\253\204\362&\251\274H(\357"
+	.string	"\224\367\b\345\025\240\362\032\241\274E(o"
+	.ascii	"\224\227H\345\005\200\362\016\251\274B(o\220\312\013\204\362"
+	.ascii	"\376\244\274*\312\233\246\274(\312+<yO\224\327Dy[\310\313B\336"
+	.ascii	"S\300\032\244\353\253\013D\266_2K\200;\n\364\026\362\316R\251"
+	.ascii	"\t\264\360M\007\0369%v(=\325Q\"\335\256\3609\344\264\177:\250"
+	.ascii	"\207\272\250\007tR[\365\036\016\005T\211\0266nr\353\252\366\265"
+	.ascii	"\n\251Z\r\251\237f_\310\300_[su\353\263E\352$\rw\323\205\324"
+	.ascii	"Fd\233\345\234\r6?\352\001\357\273\200>2j\001\033\356\327\306"
+	.ascii	"(-@\027\251\271)}\305\b\211"
+	.string	":@\367\0315)M\324\347\3605]V\177\333\341j<\374\224j\002\240_\005\351\267\024\352!\020G#\024\007\324A!~\246\013\250\215H8K\265\177F\334\214\332Fd\234\2709\264S4G>\273$^\246D\272\256iW\3731fk&\322'?\321\306\212Sf.\210\253Z\330Z]v\344la\377\354\037\303d\265\331\350[\0162G\252wgu\2379\356\001\340\207\371\204\306\352]/0\376Zw\007\366\375H\303-\241'\364\367\016B\231C\2516\005\215q\334q\373b~\206PB/\025\201SS\247\357M\032\353\331\313`X\0265\034S\361U|\032+\252cE\266@\306\242X\006\003L(\354cF\020(\304\302\276\212`)~(\030Y\224\025O\200}!\221\201\241\020+~0\212\201\2650\222\225\251\370*\022\255 +rx\321\242\354+]/\2530\026^D\261\260b\013\242\327\030\031\321\352h]\274"
+	.string	"\033#\032]\270\030#\002%\327\367\022\345\323<#=\226\2006\032\rm&\253V9\271\324'\201rG=^\2665\317\005}\345\325&\201V\216z|\325U\315\306rE\340\316n\256\353\272\n\233\311\302\t\274;\352\231Y\251`\340\334Q\257\367eBb\263}\357\352_ \336Q\317\324\3525\273\252\0274\333\356\037Ch\325\\}\274\237B\220|h~vC&\320K\335\324\303\206\352\004=Eev\205\330T\375#\037\005=5\330\245\240\267\220\202qR\235"
+	.ascii	"AK5\357\211j\004z\226Q\202O\r\345\324O\315{\016\264\023\236\256"
+	.ascii	"\250&w\230\376\016\364\201 \355\304\031\350\241\240\201\336B"
+	.ascii	"\332Y2u\023\235.\246\270\002\035\200\231\250a,&\221rfDD$\030"
+	.ascii	"\3214Ic\260\002\2211\252y\021\0209\207\220S\243I"
+	.string	"A\2325\032\001\3756\263\006\243\350\004\354\275k\372\306\304*\0209\204JP@\213Yz.r}\1770\254\006mt{\322\356I\371\001\345\330\013I-bb\007\022V\240\201\024li\\$\240\002\211\375\016\227+q!\201c\370;\305\252Tm\376f\240\332\023\354\017\333\350@\202\215\0242o\257s8\020R\001\307k\016.y\3773\365\222\372\246\206\351t\240\006?x4\215\301\247Cm3(\020\371\260\024\246\244\342j\210V\252,5a3\357v'!\375@\306\371\256\025I\346\246rj+E\373\325\363\337\346\277h\276?(\261\356\211i\377c\264$Y\335\005\331q9&;u\263\003\204\360\306*\r\256o\313\257G\022\351\303\201\232\260\030\324\342\231\331\215\257\031lv\317\262\251\315\032\022\246]N\317\224\376\213@\037B\335\357\243\032:\231A\356\005\001\252\250\345`\213'\303u\260\311\033\316\205u\307\n\342Hf"
+	.ascii	"\355\336\266\361/\030\377E\212\331,\032\347k~\347m\333\365\375"
+	.ascii	"\327L\251"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.261.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\020\001u\r"
+	.string	"\246\031]D"
+	.string	"\221(\035\360\023[-\220\007hQ\360\217\340\001F\001\360\221&&\254&\313\374\377o[R\003\327\302\276\325}P\200\275\225-\025w%\021\033\204@\265\001\254\2300\306\334\326\372\233X\335\274\023|\2627\221;\245I"
+	.string	"G"
+	.string	"I"
+	.string	"\3409\3632s\001\363\322%{\006\201\2215-\240\201\203\304ecw5\025\361\322%\246\261\344\233.3\253c"
+	.string	"T\253+v\340\305\242F"
+	.string	"U\n\343|#\274\267\0369\250P1f\035\273\353\350\251>\334\363\266\035\330n`\277\013$<\334x\245\324d\203\250\250!\354k\030\206\241\225e_\345W\215~v\230\027_\t\210\1772v\2770\307\276\310\026(\326p\320\nL\270J\354\256\346\032\333\217\366S~\242t\225\r\337\354\262Z\\v\301\0046\220\271tg\331\324e\262{\272\367\025\033\301WpY\253\344\004F\312\3562Hq\025\023\374\223K\177@\244\0172/\377n\332\241\013\361\236\317\022c\365Br\223\230\227\213:\303\274F@\001\223\2121\236Q\325\026\301\020\357]\337\372;\264\004\246\320\031\221@\\G\032\211T\370\360xl\"m\223P\200\003}B>\272-\363\326\371\204l\032\350\343\351\264M4\322:\034\207,p\"\215\024\n\2114\rx\272\262\334qR\024\266\273+\007<\200\020\357\031\213.F>\024l\023}\217\351{\346W\002\026"
+	.ascii	"AYz\027cfh:\307\341\356\201\006\205\212\310\230k K\326\320\305"
+	.ascii	"fi\t^\0308\344\272\"cX\245.\250\3574\325\254Z\031'\362\315\354"
+	.ascii	"\232\232\\\343RP"
+	.text
+	.section	.gnu.lto_printMotorMix.262.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`M\t\3251"
+	.ascii	"*Y\240\023F`\330R\007\373\024c\237\255@\326\234Q\0233\374\250"
+	.ascii	"@\216\f\f"
+	.string	"\351\035\024ILTy\324\210\345L\001\r\262\342\b\317\021\316x\213\177>>\037\013\261\370\371\371\233\3576\3166\215\376\254\340[\035\334\306-\261;\311\224\002'\001\024\001)\001/\366Sr\215#\3149Sy]\373]\273vP\317]\331g\220]\241\020\346\\MrbC['\272\277y\234\3139]\273sN\246\252\234\251\200\243b\263\027{}bv\302\2478\225*w\243\362\034\315\255\340\025\2150\347\255$'v\023\317\355~).\330\306@\254\351M\300U\217R\345i/\2248\031K\215\006\202\326\211]m\035w\373\231?\251r4\030}\314\031Ln.\347*\202.j\235\270t\236\242\023Y\327):\261\253\272\305(ed\253\006W&R\266\302\2343\363\305\272u\266\352\215\304U\356\"\217\255\261Hd\037W\265\323\371\020u\215Z\240\033\227\225\273\254\261\306\326\016\026\002\2311_~w\205\221A\272\276\374h\254"
+	.ascii	"\326\245\303[!\260./7\"\331\362\302\305\033.)\273\264:\326\342"
+	.ascii	"\212b\"\253\243\003\316\352\\\266t\260\007\254I\276\\.\031\230"
+	.ascii	"e%<a\"\304\365\034\327\340\302b?\255\r\213#\331\332\201\337\357"
+	.ascii	"\234(F\244\360\314\020\254\353\313\261\261B\316\271q\026W\227"
+	.ascii	"w\322\273\373\257\273\261t\267\322\357z\316\242\241v\271\nl["
+	.ascii	"\023\003\037~[\rC\272\377iw\325\n\177\030\335u\306W\177X\267"
+	.ascii	"\003\003\216\346^\300\367\274\221\234\317\373\310\375\274\215"
+	.ascii	"\374\317\273\310\001\275\211|\315}\310\257x\0139\236\367\322"
+	.ascii	"\363\274\203<\315\035\310\245\270\377\270\270}\334\316[\331\343"
+	.ascii	"R\274\005$q\363$q\357$q\353$q\007H\342\316I\342\306I\342\006"
+	.ascii	"\220\304}\343\342\266A\342N\"q\273H\334H$\356#\022w\213\304m"
+	.ascii	"D\342.b\334\304#n\026\343\376\0267nq{\204\bk\324\376\326\256"
+	.ascii	"M>\260\232m\034\246\311}\304:#\276\347\316\347\356\347\376\347"
+	.ascii	"\016\350~\305\035\317=\317\335\316\335\315\035\316\275\212\373"
+	.ascii	"\234\333t{\267ki\337\342}\316\305\273\270\265]@<&\177Y\314\310"
+	.ascii	"Z\277<\037|\357\022\253\232\311n\304\312\360\316\no,pP\345{,"
+	.ascii	"\226V\325l\303\r,\353;+\314\271\032\265\322\216\305\263\270^"
+	.ascii	"\273yon\325\342\275l\236\342fW8\263\234\363\213\366J\337\355"
+	.ascii	"\341\003\366\254\233\367\301/P\372d\274U\357\340\236\267\371"
+	.ascii	"\002\337\035b\004\366,\003\017\375\021}\253N\276\315\273t\r\322"
+	.ascii	"'\337(VvF\372\345\363H\217\325H\2139\332\237\262~\200[\216\030"
+	.ascii	"?\f\215\273o\001\371\307w\237@\234\324\353\350\205\036\371@l"
+	.ascii	"\322:\243_\376\361\007\304I\335q\250\r\276\025\177\332*\212\355"
+	.ascii	"\337X\325\214_\374\366\215qR\257\242\017z\343+\343\244D\317~"
+	.ascii	"\361}\tU\314U`[\335\025>4|}m\302\321\231\327\331\306\214\336"
+	.ascii	"I\rs}}M\220B\321;\251`\f\321b\340\3032\257\257=\235&\020\375"
+	.ascii	"\317\340\320\023\337\255^B\254\254-\252\344\n\227I\355p\020\177"
+	.ascii	"\332.\350C\377\303#\211_\231?/$\234\314\313D dX\302\307\274\r"
+	.ascii	"\224\226/\202jm\322\335\3640/SPi,\350EP"
+	.string	"\001\r\321\212d\231\001d\177\332owc\"\366\235j\203X\030Mw3\271\227\267h,g\254\007\355\203-\234\200\004\311^|\221\0204\374@\377\357Q%8\336zE\177\374\036Er\205\017[\371\036\375\032-\233\214\226-\236\242\242v\234)\236n\222\252\351\002y\341\205jBY8\331@AI9\331\024L\317\247)\"U\323\305?y\002\005\013\030\234\200\232`\235O\017(V<55\235R -<\241\240\315\023NM=N\247\026OKN\251\247\324R\224\324\363\2052\341\250x\233KSQ\320\246\266\231\224\236\240\230\230+\236\232QL&\347\313T\342i\251)''\363)%\345d\272\325\354\037\326\033\370\346\f\tc\374\225\033\034\025\2333\030\005\237s\247\363\034\3024|\310\303\375i\037\207\034\215\250\270\265\372(\340\233\305?\337\363Zg<\214\2609\347\214\374i\273\325\217\202\327-R\271\326\3007\313\366\274"
+	.string	"whQ\371\016\336\357\274C\033\221\303h\017\0028\300\353\374\316\363$\271\005:\226G.h'n\251\243\305\337\204\002\344P\371\262\207\255\307\23766&\371M\227\253\026\251\\\361\200\373\274V7\001|\363"
+	.string	"\036\347s^\371\215\243\030\214@\254\b\3668\3139\352Y\031\332\250\253!9\321G\303\022\366\254f\363\016:\242\034\271\"\2348#"
+	.string	"\277Tb\017\3647\016m\326Q\200\263\250aP\204\220\"3E\"\"a\202\264 \351\300\002\021\252\252t\020PEe\222BZ\003\366-\347"
+	.string	"\\5Aw\216\233ye\324\337\341\200\346\351\025\246o\375(\310\215\001\245C\344\266E\260\244\t\302\022F:\242\0170\252\250h  \305\206-\037\244\247\352.\333\307\360\277\337Sg!JA!=\0020\024\r\023\005l\030\224\016}\355SZ\027\317\317\261\344\226\217\314"
+	.string	""
+	.string	"\202\nAkD\001\363\211?\016\231\345\207\030\206\020\253\262\023&f%\243V\246ef\211\001\017\206\262\344-\207wzoU\350d\215\247\031\305\212\""
+	.ascii	"\223\035f\243X\302\226\360S\232E\355\265\377\277\324oTfP>\233"
+	.ascii	"\304\\\037\022E\017\267\320\0067\356\341\034!\363\215\377\250"
+	.ascii	"w\035H\t%\225\362\201\351\220\032-\205E\306\224y\261\013F3TU"
+	.ascii	"\240\264\206\377y\265\253\035\201\215z\342\277\371V\225\335\n"
+	.ascii	"h\336]_N\260\221\353\017\032!\005\363 \204\201\340\240\215\264"
+	.ascii	"2J\b\376E\341\036e\331:b\212or\325\356\325\217\322lK\257\377"
+	.ascii	"\351(\262\252xpv\214Z\272\336\300\216z\037\035]\220\020V\247"
+	.ascii	"\f\330\211\227L-\312K\035\342L\314\306l\331\365\037F\005\025"
+	.text
+	.section	.gnu.lto_cliMotorMix.263.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\246\f=A"
+	.string	"\032p\030\031@@dN:\217\3321\213\244\264\221\t\005\220~B\330\312y \004 \223\002P\307M\377\222\036h[\210d:6\337!\350B\340\364+\375\353\351)\364 )* lh\357\343\215\335\032!D\356$\003}\001i\001\202\001~p\177MA\nC\036\2071\344\245\r\357\346u\\\344\2779]\362pX\357-Z\373#\204\244J\242m\333F\030~\265R\177d\347\210@\265}\355\317\326\244L\242m;\347\340+g1\3772\277y\271\344\331\024yT\333\256\265\251\323\266s\0178\301\360+\317\035\311~\035\376\310~M2\003\006 k\301$H\217\230\325\t\266m\253\325m|\276\314C\226\251\256\316\235\227\324\344\t\f\240\022\020"
+	.string	"\300\024R\352h\214\202zrjb*.\021\207Bv\255R\373\026H\362\353~\325\254\243\363\243s\006v\002\003\250\004\250HA[\024\275\217\271Fm\240\006\310\t\334\r\360v"
+	.ascii	"od\356\324\230#\307\210\271Ra~\f\363\004s\215_\036\245V\r\342"
+	.ascii	"K\363>\346\027\365\252J\226\273\2731\275\\(\025\311d\214\362"
+	.ascii	"}\3148\265A\324\016\244?\273\334'\2635\177\315)\027\264)w\022"
+	.ascii	"\306%R\232A{\223\232\033\323\312e*\266\255\021lN\213j\006\271"
+	.ascii	"7/\357cVQ\373\215\335\236\343Q\271KSN\304\373\201>f\323\215)"
+	.ascii	"\345\016\373\230W^\367\003n\314\264+T\205K\230\206\336\307l\252"
+	.ascii	"\025\026\005N\371\034\262\313.\231\201\362u\b\345UfnL\271\253"
+	.ascii	"^\013Z\363\255j\270\033\364\305\351lL=\232*z^\367\273<\023\273"
+	.ascii	"\327\370\002\302\rm\333\362\001-hl\316\006\316|I03\030\363\022"
+	.ascii	"^\275\324\226\206e\375Z4OU\257\261\203\3376Bw\250\300]\377\201"
+	.ascii	"}\234\023\0021\f1,K\241\340\253\b\022\367\312\333RK\032\225\231"
+	.ascii	"F\313.\304\211\343T\233\215\231\003\\>\021\226o\202\275\335\003"
+	.ascii	"\241\270\216\376\3326\354\312\3331g\235/\205P-I3R\263m\333\n"
+	.ascii	"\200\276\267\202\037\346+\267p\261\362]\260_\177\030,s\f\031"
+	.ascii	"\367J~\335\237\304\331\b\3134j\366.wh\032\357X~\232\236w>\\\304"
+	.ascii	"&{Q\265f\333\226]\3315,\253\240\340+\253\005$\264\201^\372`\337"
+	.ascii	"3\350\020\215\335H\314t\r4\263\027\216{\345\233\311\331\2109"
+	.ascii	"\215\2165\030\363\234\3301\004\242\201\335f\343\0278\200\305"
+	.ascii	"\321\022\3565\346\013\023\316\346\227\260\025\341A\026\203\005"
+	.ascii	"X\237;_\335y\266\372\360r\325\324\345\234\221RG\343\341\234\243"
+	.ascii	"\210\227\241\210\227\237\210\227\235\210\227\233\204\227\231"
+	.ascii	"~w.\n//\t/\023\357\345\341\275\314\016/\257\302\313\252\360r"
+	.ascii	"\013/_\366\3623d\250\243\033\004G\212\244\375\346Z&\203\223Z"
+	.ascii	"\350z\207\314\235\377\335/\347\237\373\341\334\217\017`\232#"
+	.ascii	">@^\2071H\323\206\274\016\237\210\253\364\366\354\"\275\313\343"
+	.ascii	"\025\317\336\237Z\023\017\211\"i\030 \247\303\027\342\236o\314"
+	.ascii	"\217\303\237\303\305\257r\202"
+	.string	"X\215\315\265g\305\254\210\214\fJ\370 \254U7\035\337\031\272\275\266\352\253g\341\032`\222<\273W2\365\237\177\224%\3232\323\350X\026,b\236\232M\321\247z\002\212\2665~ejs\254\254\3519\251LS]\354\345'I\305\230=\231\330\036\366r\330\317\273d\311&X\177O\206e=\242H\313L\243[\367\316\033\206B-\344d\316\272`\200n\273D%i\305\212\254\301\270\330K]l\213\333C\345\264\322\250\211\330w\253j\266\267\210\306C\200\215\240e\r\306\037<\377a\327\256j\276fib=(\321\0339L\021\356\363.)\231%\253\313\226a\331\f\005I\266d\333\224\363\021t\032\035#\340D\356\255\350\307iBW9\0379\211\007\374T/\331\276\333\211\013&\275\f\333v\254\002\037\322\245I0jRL\222\f\233$\303~e\373xW+\305\351\231\336\t\273\203j\253\340n\235I\246\271W\256}\373"
+	.ascii	"\356\201R\350\373\363\205(\350[\335t{`\022$\341\222q\367\312"
+	.ascii	"\255>\340\035h\2056\r\336\260\331TuQR.\331fX\366B\355\327\335"
+	.ascii	"\350\006\320\016\324B\026\275H\302fc\"\242\365B\257\221\252x"
+	.ascii	"y\265\274\210w\304\021\333l\017\302\"\373B\037\355\340\002\313"
+	.ascii	"\324\304\356 \363\023\0013\207#\342'\261\021 A5\n\277c\026\362"
+	.ascii	"C)\212G\374\376\207\202\375:"
+	.string	"\241\213`\330\035ddw\177\316A\264\301I\315*\205\335\301\314\342\203\207\022!X\366\201eE\243\213\206\f\036#\226\370\003\t\016%\254<\204\030\301AE\211\020MLC\006\217\034+\377\350\362\321\365\305\362\r\b_]B\274th\375\270a\303+G\r*\276\327qpu\335\340Z\277~\364\350\256\035^9h\350\340\0222\027\004\257\034\\Z;\274d\350\320\342\372\362\241\005\001\311<zt}i\375\340\301\343K\2538\027\366^c\256\373\2210\212\002\rk1&\004>\\\241\203\277\316\365\002B\301\037\021#R#\323{%;9\007\243\323\350\004*^\006\\\320\017\375\355\\.(\256#;l)\204jk\367\363@A\250Y\202\275(U\207\313l\204\222\221\301{%\3379\201\217\240bvmO\004T\002\020\241Y\235:\266T/\325\263\036+\345\027\340\330\021\006\241\300\356\225\267;jV\362\036@5\333'p\017"
+	.ascii	"\2451\310\254fU\312\330\307\007j\030<\3503e\354\254.\332\261"
+	.ascii	"\331\363$v\245\004Z\303\223\026e\217\301S\263\207\002\361 \233"
+	.ascii	"\215%\361\035\0274\253\306\2506\366\222A\257b\201\266`1h#\325"
+	.ascii	"l\034\325\013\272h'\347Dv\233D\363\240\235\351a95+(\020\356\370"
+	.ascii	"<\361M\312\307\354\031\225\365\327}HH\252\304\354\t\345\340Q"
+	.ascii	"\275\304\n\274\302Jcljf\016W\t?\213g\370\232z\3145n\022\277\273"
+	.ascii	"d\037)\031e\270WH\222\313{eS\013\335\004^\201\216\365\231\211"
+	.ascii	"\272\352U\214/\356\252o\237@*\320\261\006\013\200\374\250A<\003"
+	.ascii	"\025S"
+	.string	"fddFD\223$\351\320\002\021\241)n\003\021P\255s\216J\222$\303\034\276\223\377T\037\302}Y\t\241\337\211['\244\006*\"\215\007\350\215\300\305:\212\\\365B_\357O\234\204|\026\303\317\322\013*?\345m\355\221U\372b\n\"\365\315l0\375\334M\220\374`\200\214?\223\234D\214. K\256\347\264m|zw\354\211\321\217d'D\\\034&reG\036\241@\254\331\311\244E>\254\017@\013\003\034\377\363>\215\340)\227\377l\327<\332_\214\215\320\334\022\023\365T\224\226\314\243/\245[j>\003\227\"\346\232@@\f\262\316\2217\006\304x\215\260\267b\t\347\252\235\213\375\213\t\355\340\356\370\224\212\364\2679N\027R\351qQD5A\036\214\265\204FJh\274\\\013\255:tG\013=X\313\274%;\270gK\034\030\240QZ\004x\013\302\240P\235>R]+V\354t\272\206\306\310AU\246"
+	.string	"L\273\367k Pl;\033@A\340\027\033"
+	.string	"$\377\231{\351J\220\005/\004\364D\032\267fX\252\347f\264\240F\017~Hni\270\275\363f\260\025\r\026\rr\250L\224\312q\206\205\\\001\365"
+	.ascii	"?\237\320-M\225\301\341\213\252vK3\215\035\264\020^\327\006\302"
+	.ascii	"%vE+\003\363\031p\363\255\361\215\371\253\272N\254t\030\276\263"
+	.ascii	"\375C\3524\323\235\036\024kQ"
+	.string	"<\276\016\033\374\304S\243z\226\303r t\342\375\003\200\221c\247\240\205\301\377\004\207b\020\346\357\373-\025;\315\210\007C\345\314\366\033\234\352"
+	.ascii	"\314\271O\330\211!\361\220K\006n\205N\217G\210\250;\240\356\236"
+	.ascii	"\331\321\337\037B\032v*\304\223\260\246<\322|_\374W\367J\002"
+	.ascii	"\206\t\220\032rJ\333\274\322"
+	.text
+	.section	.gnu.lto_printRxRange.264.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\017\005e!"
+	.string	"6>\331K\220\026R:"
+	.string	"\353\001\363\002:4\323T\005\002\333\373u\203\216\277}\356\300\357Z\350*\203\302\201\247f\017*\315\333\355D-\364P\366\177u\027nJ`\216[\005\3607\030\241\251\352\303\024\375\262\003\f\336bA|k\204\020B\344N2\301"
+	.string	"\273"
+	.string	"\304"
+	.string	"\374#\327~2\263q\351\346T\274C\232\322h\204\270\345\336b\320O.R\177\276\306\314\315%\202\t\206\255\"'\032\330\342\207"
+	.string	"Od\204\316\314u\322\252\022R\177rQ\275e>\361B\200\317\"\301\263{k \371\272\267(\304>\352\317\333m\350O\3636\350O\0062W\321)q\203\b\226(\326\"[\356\275\271\276b\363f\361\214Z\340S\3644\333\002\371]\307\021\305\232\224\307a\360\251\tC\346#\206\314p5\017L!\311~l\262(\215\207\324O\0277\315\235\261&@d\206%L\034\025\215#\367\272\205\032:\331\376\361\004\210H-\345q(u\2332\270\367\262}\032\2568\253gf\030\314l\202\331\034\013\366\313\303\202J\266\230m\305\037\201\336\232\252\n\307\023,cR\234,\227\236B\222\361h\256\331\235\016\272\200f\366pd\377\304\323\266(\026wyE\330A\346b\320\266\025\231\217\251/\356\033\314@>\270\023\371{\276\365\337x\316\365\357<\353\027p\344Y\347\306s\016\316\271\316\266\324\362Mj\331F\265\\\223Z\246Q-\317X\313"
+	.string	"P\3132\250\345\230\3242\214j\271\226Z\246\251\226g\251e\365\264\234\246\226\321\324\362i-\233\326r\243\226-j\371\003\026\2105\215m-S\264\262x\243\276t\271N\316$;\216\374\215\314?\302\367\342\032\033H"
+	.ascii	"<\362w\013\026oTze\374\342\2517\022^j\332F\254\246/E\\2\3234"
+	.ascii	"\215^\035\225a\032~\3126\350|\260f\372'J\026S\3674\200\276\360"
+	.ascii	"\307\277\036\32321}\025\304%Z\312.{\346XZ\303tN\363\231LHm@!"
+	.ascii	"V\021\357\025\376\211\202*\\\002\372\211v\005\013\366Ol\336\251"
+	.ascii	"\016r\255a.\\I-H\326\254iZV/\314\031\016\246!\207u\257\223\002"
+	.ascii	"\376W\b\235P\231\216\237\263>\221\b\266\314\252Y\234V\333\247"
+	.ascii	"\177i\253\375\264\277\202\341\032\355\364\312h%\350g\343\272"
+	.ascii	"\305\326$2\366_\3576\233yWd\377t6\211\031\266{\332l\223\212\355"
+	.ascii	"[w\247Y\204?\314s\030\372\266}a\217&\373\205s\372\335\2732*W"
+	.ascii	"/L\001\374\373\271\375~n\277\237\233/\204\217\346A\222\221\356"
+	.ascii	"\007b\027\303\273OiBQ\217G\244\333u\2409P2\372\3518\354\210\002"
+	.ascii	"$\025\3618\364\220\034\354\212z:\tF\273^O\327a\310\306C\222\016"
+	.ascii	"\302\207\243\037\221\312C\005xFC\271\036Ow\224\033\362%\345\n"
+	.ascii	"\330\030\351\303\316\227SBB\362\345j\305\373\276\301\357\272"
+	.ascii	"\232|1cy\205\251\233\322\266\342Y\216\023h\246c9\265&-C\261y"
+	.ascii	"\332\372]\237a-a\254I\313\3238\re\211U8h\334\274\367^\264\255"
+	.ascii	"\370S\226Tk\322\304\265\3222\306\232l\376\017\325i\250{}V\266"
+	.ascii	"\224\261&M\237f\263q\332\326P\314\377\022\232\323@\375\343\317"
+	.ascii	"\026D\244\226\222\253\312\322\264\315M\004\235\276\351\257\001"
+	.ascii	"Y\250A \305\220RD\031dF\202\t\246\002m\213\001p\002\231:*n\021"
+	.ascii	"\22095R\245\240\345j\310\3348\034\343oz\3559/\370\203l\333\367"
+	.ascii	"\355\225\267\005<$\211\025\2250\r\b$\rd\313Z\375daE9\"tU\021"
+	.ascii	"\016!\225\224;\265\325\021 :j\226\276\016B\020\316\237\324y\344"
+	.ascii	"\030\022h+i\312\200\342\313\360\272\214Vs{Z!=9\300\356\253\260"
+	.ascii	"\236\032:C\274#\211d\333xltk\2729\215,\321\321\216\024\376\267"
+	.ascii	"e\234\312\r\204\271\353\"\374d\273_\304\312\211\346\242\037O"
+	.ascii	"\342\004\336\004\034' \354\252l\215^\214\005kojz\217\301<-7\372"
+	.ascii	",\242\362\005a\365&\354\202\347\245P?"
+	.text
+	.section	.gnu.lto_cliRxRange.265.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\333\001e\021"
+	.string	"\246\237sH\320\224M:\244\004\\X\023\240\336\016]\021!\026cV1\360\215\006>/\331\274%\"\220\037\b5\b\f9\210\332\314Z\375S\2419\207\265:\007P\022~\310\274\204Z: \226\2106G\377\333c \255\032\261d\223-S\nZ"
+	.string	"\\"
+	.string	"`"
+	.string	";2\360\201\356\323\343Y\334g\367\025\367i\230=\244D\266\261\006\264\241\233\031Gv\327\223,\016;\212\233\233T\230\377\242\247@1vT\247sn\332\250D\231n"
+	.string	"D\235\313-\301\f\307\323"
+	.ascii	"\261fc\205-\300\027]O\2104\252(\224\335\265\202\"\212\273\273"
+	.ascii	"m\027\333\020l5\tHAj\024\211;\335\244\r\002F\017^\006P\332YA"
+	.ascii	"\233\325\310\230=\322\250\374\261/k\265Z\315\322\307>\321\277"
+	.ascii	"M\265n\352\247\376\024#\304\311\371\r\"\273a-\3116M&\027\026"
+	.ascii	"\341\024\324\303\343\021\037-s\234`\364\f\355\256JU\266\257\366"
+	.ascii	"\207.\003v\"\022'\260\353C\264\264\001@J\364\343\225*t\2736\007"
+	.ascii	"-t6(\b>/`\320\203*\013\204;#m&\323\035\262Ph[\251\237\201\363"
+	.ascii	"5p?\272\215\024\331\003hw\346\340\217\354\005ORI\231\b\177\360"
+	.ascii	"p@\3435Z~\320\247]+\323_\341>\377\027g{h\321\203~\222\021\235"
+	.ascii	"\246\233\003!\231-I\207\340.7\004\216q\301\270>\316\035Nd>O\346"
+	.ascii	"[\271\\^,\034ZZ(\267N^,-\317\345\245\322\342\265>\030\357\204"
+	.ascii	"\345\227\017\256\317\213yy\371<\3258\363m\245\017\205\027B\264"
+	.ascii	"\331\214\244\331vwQ\006\364A\004=\350\355>\204\340\344p&z\243"
+	.ascii	"\353H\231NF9T\004\3400Y\302\004\025M.\222\"\3063\345\217\025"
+	.ascii	"\\e\t\244' \220\202\221\262\362\030\341,\375c\314\212G\242h\022"
+	.ascii	"/\272A\261\264Ka+KF;\375\266R\3625\321\007\314\214\313\023?8"
+	.ascii	"\331\203\001\021T\262p\275\177\210\275\266M%\254!\207\370+:\216"
+	.ascii	"\365\302\"\\6\0345Bj\253\271Z\t\020r{e\322H\013S\212_\3235\204"
+	.ascii	"\003\005"
+	.text
+	.section	.gnu.lto_printServo.266.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\203\rmB"
+	.string	"\212t\214\031=0dN:y[\303\036\272\344\241!\236\034\332I~\360HM\006\375\231]u\305R\001\245\230(\257\025\030\366\323\370;y\360\002\230\347Av\365\"\275\231z\363\236\2726i\204\020B\344N;\217\001j\001\202\001c\362"
+	.ascii	"9\276\204\357\233\224\232s\037\022\370\327\355\375\0210M\270"
+	.ascii	"Gu\360\0011\321N\224\\\324\251C\016\376\234\377a\"\035 \351\373"
+	.ascii	"\346|\335\236\344\240\207dxEH\273\037\032\226\322\371.a\345\240"
+	.ascii	"\217V\264\347\303\357\303\3048=\260\2108\337\246[\b\rdw\351}"
+	.ascii	"\235[W\261\212\366j\0231\306\r\347\207\036\033\210<9\024\262"
+	.ascii	"\363n\322\376\006\210\325\361%\202\307\354j\257bg\373\214\361"
+	.ascii	"\355\316&\355wA\360\360}\261\370\325y_g\027F\320^\305:r\275\232"
+	.ascii	"^j\275\212q\032\306\215\254\212\274J\260\350\340R\357\322\373"
+	.ascii	"\276\311\2263\032\215\306\250)\334>u\036\257j\332\221SRQP\307"
+	.ascii	"'c\321\211\350\016\333*\226jU\323\316i\370{\317\3423\204W\330"
+	.ascii	"\327T\036\t&p\231\247\266\270}\271\324`\225\034\325\345Ps?\316"
+	.ascii	"\rr\311Oi\212\245n\310\t\333\274\244\025\004\345@\241d\343\026"
+	.ascii	"7\270\027\251\334\211\212\340\224L4\200\305M\312\335\264\301"
+	.ascii	"#;\225N\330&%E.\t\303<][\224<\024<\2079f \273'\0267\270\267]"
+	.ascii	"^\225JA\361\023\223r\031*\023\345{n\200\256\355-\263\037\362"
+	.ascii	"\345T)\253\244\315\320\t\333\302\244\023 9\212\362>\265\274\272"
+	.ascii	"d\236\\u\3624\275\032\004\310\214"
+	.string	"\261Y$\315\232rE\316\377\236\331\232Dr\277\357\r\332TR+\354k>yf/\274\357\2133\263\351vlu\214\017\305\030\307\301\2308&U2\t\2224(\021\221\214\t\347\016k\021\335\214\326\352\234\216\375\254\357\334_\243S\313Q\374\240\337\377\273\332\247M%\274\302=\350\220\034}@\b0M\343b\276\320[\267\320\030\313(\313gfh\344\222Mc\236\217\326Z\211\261S\231;\016\343\257H\332\034\301\255\005c\024&H\334\316\361\210\3239\026\021\002\304\371\034{\350\360<\307\033\236\367\213]\317\261\206\277\371\3032\034\316\177\341w\277\205\003:\006\373\237\343\257\3379\366\272\3371\204\3079~\220<\234c\007n\306]n\306\\l\306[n\306\r\330\214\031\270\031/p3V\300f\234\300\315X\313\315\030\201\233\361\0016\343,7c\003n\306Xn\306\005\334\214\t\254\031_\255\031\017`3\026\300f\034`\2301"
+	.ascii	"6c\253a\306Ul\306T\303\214\221l\306Sm\306Rl\306Qm\306Pl\306\307"
+	.ascii	"a\306Ol\306\306a\306E6c\247a\306D6c\267\315x\310f\334"
+	.string	"\266\031\263l\306\253\232\261\312f\234\262\031\367\232q^3~\212\016\206\360\006\345E\017u\241\363]\022\325\364\006R\001\305\034\320\377\347\347\363\347\371\365\374w~;\277\337O\347\217s\027\343\017\246/\237X\363n\214\037|AL\374\303\250\371\205I\313\007\277\017&\272s\314=v\227\360\340\353\371\236\013jF<4\271\004\217\206\035\207\263\230Xik[\013\376\215v\350\274T\265\026|\302\213u\347\351y\301\303W-\326\033z\310\224\263V\327a\255\341\202>\240\257\274z@\177\317\325>|\201jkX\252\326\202\207]T\024\303/\321E\313\277\214\331p\252:\350\357}\310%\252h\371\2273t\262\331\332lW%\223\362\022 5\337\254\035\207\027E\237\313\277\224D;)\332h\371\327\370h+\204f;\340\207\207\242\230\226\177\251\211\306i'\333A\263a\374\367X\0374\212~\337\325&p\340\256rTO5U[u"
+	.ascii	"\001a\020Z@\177\t\005\320\0012\001HS\325V\317\252n\301\267\367"
+	.ascii	"D6\225%\024\3104R=EI\252[\360\371=\241:\252\3279#\205\222\b\241"
+	.ascii	"\264\b\345\035\202c\223\325\253\334\266\333Nm\354c?h|H\034\330"
+	.ascii	",Q.pv\357\273v\246\207v\355R\024\\M\373C\210|&N\337)\255\304"
+	.ascii	"O}\034\361FO\320g\261\215%\276\250\230\206\330N'\236\b\005\261"
+	.ascii	"\357\326&\372\034\266\253\342\207\206i\356\330n\007\227P\214"
+	.ascii	"W\334\020\213\366}\211H\300\037$$\220\213\366\313U\266\357\306"
+	.ascii	"\227\367\274+\346d\257m\242\321\254\250\275\366\325\3762\220"
+	.ascii	"D\247\315\312E\365,\267\336M\242[p\tx\314\027\364\021-\2421\036"
+	.ascii	"{\221\317\354nHQI\201r\213\365\210>\340M\310E\367\326\352\324"
+	.ascii	"\002\260)\321\244\007\262\212\365\200\330\214\354\314\214\214"
+	.ascii	"\007\231\031\226\2172\033gH\fC\013\013M\013\313\252\006\331\215"
+	.ascii	"\033c3^\260\307\0307p\204\r5\234\325\030C\323AV,\273\331\216"
+	.ascii	"\0232n\224\301\030#\233\341\236\330Q\003m,\006\031\214\2503\033"
+	.ascii	"cfc$p\3600#;#\3228\033\013\221\303\006\032\214\026\277pPV\343"
+	.ascii	"E\362F\331\230\215\344\013\263\263\244\003$\306\221\203\314,"
+	.ascii	"\271\003\007\016\263$\321\371~\357- \224:\317GCZ\r\331qx\330"
+	.ascii	"E*D\253j\250\262\362^\357\275\372\221\360\362\246\274:D?\360"
+	.ascii	"j\023\276?)\250\016\315\252\251\312\312\2035[\222\203\335\317"
+	.ascii	"\031Fx\242\300\272\303\240\027(0\256\207ui\241\233\202\361\372"
+	.ascii	"\320\3609vqu\203\356\352Uo\253\271\300\232\353[\2752Z\323\264"
+	.ascii	"\244A\177\360\251&\276\301\347\235_\2415]\236:\016\177\365)\202"
+	.ascii	"hVM\233\225\377j6\343{\254_\335X\360\322\367}_c\307\341\1775"
+	.ascii	"\210^\325\360\345\311E\006a\f\2328\307\246\307i\201\202>\320"
+	.ascii	"\013z\325[\2761+)\350T\217\020\034\025\342W{5\316F\322\326\260"
+	.ascii	"\204\3624\245\261i\327^\247\340j\202\267Vb\017\235\240\211s\314"
+	.ascii	"\350\022z*{\302@\335\216\323\352\323\035\350\002\255\325\002"
+	.ascii	"\0201--\337\262\362\b\332C\367\246e\340\2016\320\bz\200\340\362"
+	.ascii	"-\253\017|5\327\263\372JoM\023V\033\350t\3162J\201&\320X\315"
+	.ascii	"RZ>Q+\022\251@?p\256MV\303P\211@_\360[yzuplZp\321`\200\370\250"
+	.ascii	"q4\345\fR\306\314\320\210\210$I\323\030\240\002\2211*\316\001"
+	.ascii	"\0210-C\f\"\221\221\202\244\2259M\227\360\311\230\355wv'\227"
+	.ascii	":\303"
+	.string	"\036\321ma\002\355\261n\372\377\004\037\234\347^B\335\3662\216\304\313\245'G%\223C\334\331\022.?\335\017\234$\003\017\350b\2050K\3527#k\366/\007\317\361\212\202\335+O\234\330,\354}\351\306D(\2351\212<(\230\261kD\344h\366\230YZd\361F\031rG\256\007\251\216\356\002^Z\203\203B\356\227\027\237\243\362\027\250\377y\006\241:\372\344.\326\3556'\276\204\353\334\035xg\250\211/\031\332q\330\202_\322|\241\034C!)\222h\304\016k\020\376m\007_\375[p\214!\003\325\3444E\332\271\273\027\267\314\263pW\242|\032Xb\260\375\324#\211_\361\225\222\316]\226:Y\330?z\373\227\250\201\fI\210\222iDN\022\302\020\350b\244R\341T\\X\233\215/=\023a\177\347)\201\177\0076\322\370\n'\203\362\367U.\301\034\247'\235#e\251\bVD\020)\251\007\t\022\224\254"
+	.ascii	"c\271\210J~\352=\370nD\264<H\250\b\355dU\345\362\34065\205\276"
+	.ascii	"\236\035\3705<\273\377\023\253DPi/Y\347ZR8\374I\375"
+	.ascii	"\2349\016Y7\203\"\265\246\351q0\357\033N\3411a\"]\034\n@@*\""
+	.ascii	"\034\241J\347J\006\334\273\320\024[\206\225\213g\034r Dwe\001"
+	.ascii	"\207q<G\273\343\315\203&c8\2470N\244\251\003\307\203c\2755\036"
+	.ascii	"]\020\303\217\255\253\274\\\307\204\355z\336\217\301K)\001n!"
+	.ascii	"\332x\276\235\321\356Pl\016\323T\204{+\367\342\205Q\005\232P"
+	.ascii	"\223<FC\304A\223\2012y\027\214\257\035\371`\260{\235/\204R\001"
+	.text
+	.section	.gnu.lto_cliServo.267.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\330\013\245?"
+	.string	"\212n\214\030BP\346Q\007\0273\255*\331\267\006S\244k\327\036\347\324\356Z\307\006\300\316b\205\237\267\r\361\305\032}!G\211\262\f"
+	.string	"\b\bL"
+	.string	"\321\237\370k\337d\315\031\345\003\237\343\005bc\233\335{\357\235dJ\001v\001T\001{\001eZ\301\233\241D\330\303\370\030\227\266\217\214\273\035\375M\207\347e~\r5\345(\230\373\271\030\217\036\275\255\343<;\263\363\300\323\254S\227sF\360:[\\}\251\205\356H\312\324\354\314?M=u9C\215\316\266\201n\307\335\316\346^\216\376e\207\007s>cS\2233\364@W\275\3166\324\205\255\263\257/\265\316\366\261\033\220\323W\346b\320L\243\034\223(\347|\365L\372\355\243?\272T\024\324\323\320\251\t\200\220iI)\230\204\004<\372\371z<\342\353\266\354\372S\370\330\336kr\271T\224\027\207z\362 S\265\341J<Cb\347T&\227\265(gN\351\264\245i\n"
+	.ascii	")\302(LP\226\236(9Y\303A\033A\246$\255\005\310\344\2048\225\331"
+	.ascii	"d\025\3321\363\203\264.\370J4\346T&\222\365w\247\244\363*\314"
+	.ascii	"4\f$C\342\243\247\377\320\202\214\t\362\2259\307\274\347T\346"
+	.ascii	"\021#\230\227t\2129qu\277\200Hq*sl\305\272\253\203\363\251SU"
+	.ascii	"a\202\301/U\231S\314]_\0231(\233]\231\223\315\333UB\233!@\200"
+	.ascii	"M\345\212\237\354\021\344k&1\273Z\311\t\361\342Tf\2215h\326'"
+	.ascii	"\352\323/\274\272\324\251\312\234]\374\275\353\351Sk\201\272"
+	.ascii	"5\207\234\312\374\262\n\201HY\272\324qX\323\013c\267B\316\271"
+	.ascii	"\361\262\351\364.z7\326\320\335^\335\274j\217\277}W\n\341\371"
+	.ascii	"V\273>\373\256\344\342j|\253\375_\337\223d\277\377we\243.\\\355"
+	.ascii	"\003\036\243\375=~\237\372z\367\326(\232\307\r\316\013W\035\216"
+	.ascii	"\030\261,k\017q;\207\266\275C\353f\374\315\007\214'-\347._\272"
+	.ascii	"\231n\003\356\006\004&*Y\024E\302\226s\306j\343q!\332\2418\333"
+	.ascii	"\"F\260\355#Zg\335K\264\335&N`_\266\2271{3\247t\357\210$\377"
+	.ascii	"\321\332=)\310\021+S\177\3266Z\177\024Q>H|\327@\\\340\273W\264"
+	.ascii	"\300\276\364w\251{\017\270g\022\273:\344suC\275\360\243u\273"
+	.ascii	"\223\217*k\375g\335\020\260\0320\3606o\243\177q/P%\300\241\336"
+	.ascii	"\001\\\334T.\356\242\213\233\350\342\236rqK\371pG\371pC\275\270"
+	.ascii	"\237^\334C'?\343\335\364\342\026\276\270\231z\270\227z\270\225"
+	.ascii	"^\334A\026w\022\213\033\211\305"
+	.string	"\r|q\037\361p\377Z\334\276\026w\217\207\233\367\342~]\334.\213\273eq\263-\356\265\305\375,n\314\342\366\t\031\026y\335\031\323\204\363y\240\031HuQ\236c\341\246\370\031w\250{\233\373\233\257\335\3368\034M{\220\316\331\322\355e\332\247\355;\323qE$47\335&?\364\260%\212\220\303\003>9\177\321.\375\267M\t\365\3379\375E\253\364K\301W\3725\356@\360IH\351\330\255N\222p\005\235\317\2229?(\215]\322\243\265k\374\036K\274u\243\036B:\252z\247\017Kz\255(\322\003?\351\3351J!F7>\322\273\177\224[Z\247\007\276\022\230\221@\3126Go|\237c\340=z\022\322\2705\270.\\}\307\002\335\001\037\315\303\323\315\224\321{\3755}\325\207\375\200{6\232*\360\275\376 \274\200\017\353\013[~\032\300\200\344\231\253\303\203\312\321\332\253z+8\265/o\203o\3720"
+	.ascii	"N+d=\006\037\345T\003\364b=\204\017\353vw5f\3740\372\225Y\242"
+	.ascii	"\205\245\353R\347K\340\002\236\301\373\300\212\244I^\021+\033"
+	.ascii	"\344\243Wd\013\235\271\023\335\343d\312(\214x\357\366\346\213"
+	.ascii	"I\374\263\366\251\373\230S\r\020\021\353{u\005|\200\017\223s"
+	.ascii	"\337_\230\343r\274\367>\336\367~5\244l\324N=\376\210\361Bi\337"
+	.ascii	"\321:\313{\240T\254\032f$\201\007x\254\007\202\211!J^\361\302"
+	.ascii	"U_s\316\371}?\213K\217`\244\322\226\203\334\177\277\235\032\360"
+	.ascii	"\252o\360\354\237$\031\021\013\370\356\013\030\260/\335o\343"
+	.ascii	",!2\207\304J\273\253s\243pw\206\r\230\217Yu\316\353\271p3\220"
+	.ascii	"\264}\264f\275\343\332\252g\333\334\024E\351 \361\335\003.|\326"
+	.ascii	"\330Gk\337\313\330\255b@\321\306\200\242S\273\260\332\232qCk"
+	.ascii	"\305\326U\r\027-\262`\260\200\252!\303\306\214\013\026Td\301"
+	.ascii	"8qCi\253\206\214\0251l\264\320:\301\313r\255\0324~\205\214,\030"
+	.ascii	"*b\244p;\205U\026\214\024W2\262N\304\270J\241\265ue%\354\031"
+	.ascii	"4Vh]\325\2301C\353\312\007\355\362\n]\357\345Rl\2333I\310\274"
+	.ascii	"x\022W\224%Q:\326\234\313(\370\233\273\324\203ubp\365\355\361"
+	.ascii	"\025\004\312\210\245~\352\211_|\2527~c\347\361\211{F\206\216"
+	.ascii	"\214-\347\244/\217Q\336\344\013\002\316\032\275\217S\216j\330"
+	.ascii	"\227\275\346\261\347\352\340S\025\337\211\303\237z\227\372\266"
+	.ascii	"\311\023Q\224\025\374\243\316G\217\247\217z\245=\317<PX\360\362"
+	.ascii	"\250\345\351\320\370\001\343\341\303\207z_\223g\035e#\341\032"
+	.ascii	"N\352\371B\356y\276a"
+	.string	"\352\202\273\3500\027\210u\250\b\3474\313A]\335G/\336\350\b\346\351\320\314\2215\3604\335\3074g\004b\035*\362E\037Zg}`O\267\345\240  \037OL\212\254bj\205\206\217\026|z\2446t\236\236\204\024\317ZU\333\"\247\246\343\265\241a\022\245\343@JZ\323ql\370\f\220h\314\242r\205\326\341\223\220\322\261\251\363\003\200\351\217\220\323jT\256\253av\302Gk\341\007\037\351\212\225\320\316\035\372f\205)X\206w6UdF\345\261\364\307\217`Z\246G\2722E\024\235\203\304w\201\260\263LOBZ\207\013\217DJ\001\200\356\250q0\244\230b\206dDDf$I\2321\260\002\221\251*n\0210A\247\034\2154IZ\003\232\256\255q\204\013#\241\246o'\266\344\232\032>\301\362\223w)\340\017\034e\276\006\334\376\2678\315\214\246\321\341x\251\257\356\372\340k\263wOA\025\273\016\357\234"
+	.ascii	"\325\312\236?\363}}\032\r\252\230_\207=D\331\365\242\327,5\210"
+	.ascii	"\"\366\026\350\254@\201\251O\025\376\316r\352L\356$b\321xO\027"
+	.ascii	"\267(\201\\\2122`M\324Db\342\367\213F\304\013\355d\272\344\256"
+	.ascii	"\030nc\233M\213\353\257\243\bX\177\316\212\256\230-\032\346\334"
+	.ascii	"\trs_\372\372\006\315\034\\\n{:D'4\317\250\245\240\232]\207\371"
+	.ascii	"\332\253\311\213\032pB\213\306Q$\237\251\272{\352\343\350,jy"
+	.ascii	"I\020\0325Vl\217&.\216\250)\261\244\004-\365V\262\261\377.\277"
+	.ascii	"\337\2460\300\216F\374\221N\330\020\300\007\305\317D\032\205"
+	.ascii	"\230\247\373\304\255Tk\350\260'H0\217\036\022o\375\257\202\374"
+	.ascii	"\340\0172\202X0\221\206\276\274\257\240\217\346\261\324 \204"
+	.ascii	"}\261z\357Y\330\344>\271\213\007\203\2743\304q#\037\f\234\303"
+	.ascii	"Z.\244>\\\246\300d;[K\245\214\312\244\376\244\250\221y#\323\366"
+	.ascii	"B\367v\034\2451\3112V\211:\240\252\237\227\277\342>\372\023\256"
+	.ascii	"\024}r\034\263\315\340\022\222q\244Y\037#\200\250\244 \227\203"
+	.ascii	"\372\004\377\367\216\217a\314\f\243\2417b`\366\232\250F\031["
+	.ascii	"L3\306\346\327\311\002\343\371\345\363\013\247\277"
+	.ascii	"\334\2473\362\b*\315\237\033\220w\\\364N\0256ce\r\370\262\020"
+	.ascii	"\310\246\033\nB\023\310p&\313\261y\335\262\241<\336\312\363\315"
+	.ascii	"\255\334B\r"
+	.text
+	.section	.gnu.lto_printServoMix.268.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\335\007\325,"
+	.string	"*R\344\021E`\246N\007sz(J\271\037\274\245\025\245>\301\037\376\255\273N\361\246d0\013\213T\213\264\242\013\024\266\224\266Z\250\265\320\366i\2500\\\223\353\004_\222z{{c~\311U\260\231b(\357\275\273\355\275SJ)\013\001\361"
+	.ascii	"\016\001\311\366\322\302\315\245\343\272\3642\330p@\241O\016"
+	.ascii	"\263,=\200j\243Q=\007\020\202\275e\013I\230\274<zG\263\273\237"
+	.ascii	"\332Y\270\225\3346\312\314o1\220\274\222\327\310\332\231%\317"
+	.ascii	"\350\334\233\\\320(S\251\215v\313\314\3376\203M\211\210\2651"
+	.ascii	"\023<\331W\202\255F\243\350\347za\321\301@m\224\223j;s\2375Z"
+	.ascii	"\260\323j\360z/\331\022\356\336$\003^R\033E\352\241\264\321\263"
+	.ascii	"\203\322F9\310\374\246\350\306\025B\360a\207\310F\347\336\353"
+	.ascii	"\373$\374\323g\262Y\365`\257j/E\317\367 \267[+)\327t\325)\215"
+	.ascii	"\302^\317G\003\206\254\323\364\020;#\214%)\323"
+	.string	"\312\366/c\227\253d`b\335C\002\006\244\323\037\215\236Gj\312L\3511\016O\245!E\264\264\306\033~\236\021\320\250\034;\256}\207\321\353|5\267/\354_F\242\177+\033=\232%\317\232d`@\332{\024\356\275\354E#X3\333\314L\205\231\221\314\275\023\001\377=\224\322k\026\223\366\373\367\020J\227\347\261\323\367w\\g\350\241\\\303R\347\206g\303\363\036M\03448\317=\356\373\005\375\364\314\277\024\336\305\006?\004f\345\256y7|!sR\350_\306\334Q]\206l\370\2170K\210\202\352\265\356\007\255\326\355\240A\267u\373:\255\373\251\2674+\350\267f\247\246nkN\300:3\261\316K\2553\002\326Y\251uNb\235\221X\347\003\255\263\001\326\371hu.\300:\023X\235\215X\347\001\255s\021\353L\324:\013`\235\207Zg!\3269hu\016\300:\003\265\316?\254\263\317\352\334\303:\363\254\316"
+	.string	"X\347\266ufY\347\025uVY\347\036\353\234\2723\272:\237\356\374\252\263\253\316=\201\303\232.5l>\356|]\362\362\310\263s\317\240rMz\256{K7\\\367[\237\314\315\334r\334Ln\347^\364\274\035\003\351\213\363^\262\t=\327}\247\346y\234\344\355\363\274\317\003}\320\017=\321;=\267]\320J\357\310\222\316\330\331\275\303.VP\207=\244\251\321\336[\300\340]\344\363\216\275\220\005<\221\006\001H\241\037\332\320\314\020B\313f\200\017b~\b\200\374y\240\016\315\f\361\303l\366\274\217T\017\022\300\363xh\346\007"
+	.string	"tM\366\333:\"\036\203hf\b\365\336\013\305~;QzA\246\365x\323\257\037\365[D\324_\277\325o\"\023\352{\337;\036\315\020\361\026t\372P\377d\210rB\336^\272\351\2329B-6]\307\321\350\"3\211\022\336\305\364?\216\222(g\206/\324\002v\227\236\353\247{\360\3507\263\325\272\034G\267\241\224\256\226c%N\b\372e_\372\3013\031A\003GM\033/\257\343\366\244)v~\031O\245\347ga\261\363\362:\314l\242\343\246\324{\275\240\316\347R\262!\323\270\301\310"
+	.ascii	"\366\232\331\022n\032i\243\r\327\277\346+\210\277\203\017\\\305"
+	.ascii	"\204$\303\352\nxD\364s\001\310bj\353\305\217\307\252\263\264"
+	.ascii	"@\244haU5\365S\301Z\320b\2615\205\342WU\004\314\372\311\260\222"
+	.ascii	"\302\202\221\365\003q\205\245\005\334\242\002Z\001\234\222rq"
+	.ascii	"\265U\2452\325\223\025\013*_\013\253\251+\037U\026\320\3674\304"
+	.ascii	"X.~Y>-,\254,_\233\274\375G\334Z\225\013C\244yg\343\273\352\326"
+	.ascii	"/\343\266\230\256L\302p\020\227\316_|\246\t\276\335z=\372\310"
+	.ascii	"#.\275\3017\375\327Y\031\231PN\237\367\336\253\3065\320\235\232"
+	.ascii	"Qr\355K\357\313\330M\230\030q\211B\251s\302v\020\227'\367V\252"
+	.ascii	"\340\277\232\331\253]\230\020\342\022\215z>\317\246O\360_\314"
+	.ascii	"\3351R\247\227\360N\224k]umc@\270\001O\340\217\376\300#\275\322"
+	.ascii	"/1\005\221\n\236\t\301/i@\360\\\3121\315\244W\332\220\364\\J"
+	.ascii	"2\310\264\363\221\276\211x\006\376@\007\003\310\002\177$U\340"
+	.ascii	"\271\224e\232FO\300\350\271\224f\220E?\340\323\243\222\274\270"
+	.ascii	"`\225\242&&\235\2351\264\016\200\222\250Q@\346\220R\206DDD&h"
+	.ascii	"A\322\214\001\320\002\2211\3426\021@Ih\252F\241\n\313\030\262"
+	.ascii	">c\022\322\177\222\037\0373\350Y\234>=\221\007\320\274\021\022"
+	.ascii	"C49\247\336+ (q0\\\013\243\377Ul\353\322\302:}++\002\330A7\362"
+	.ascii	"\247\234\254\314O2\335m\"\271\212@Ri\252\265\205\035\320z\243"
+	.ascii	"\006\331\356\252f\366\n7\255\301F\235t<\320@\326\006\202\254"
+	.ascii	"\341S\031I\027Q\245\226\004\210\222\020\2115\265\2538\023\217"
+	.ascii	"9\007\375\003P\"\325\013ifE\323\021Up\235B\022\372\007\210\242"
+	.ascii	"GW\220\220(\002(\t\254\246\244\206\365t\371\\Z\273\334\232\320"
+	.ascii	"\002\361b\304\257\201\211M\240\360\322\363!@S@?\235\243\017\356"
+	.ascii	"Q\270\243\t\352\232\310\006\357\031\313w\020\036\317\206P\303"
+	.ascii	"\234\241Gd\213.\002\352\314\340\230\360rL/,\263\f\032r\361\310"
+	.ascii	"y\2667\371\207#y2i\204U?\260l\263\246\031\b\206?H\205\"bG\307"
+	.ascii	"\316\322\273 \224C\231\351\303\024\361\007"
+	.text
+	.section	.gnu.lto_cliServoMix.269.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`t\037\025\222"
+	.string	"\272\356\2345I \316\332\032\003C\232\270z\253\210\313A\203\302\340\235*+\310\266\303G;l\263\233]\325Z?\244\366\326i\\\302)Tb\356\275\263\003\004TD\347\336\213\253\25539\361\301\305s\357P\320\264\032<\005\276\265\007\331\232L)\245U\003"
+	.string	"\003F\003/\227\032dF\240\274\257\234\002\202\334\205\314$|\226q\223\233Z6R\200m\331U\0132RLL\326\f\016\260\003\203\304\230v\275.\326J\026\316\n\230 \356[&\367\206)\313\274u\221\352/\334~\314<3v\246\217\231^6\340y\017\337\006\2432\246\270\350\342\252\371x\305]\0327\334w\334{\314\324\003\002\325\222{\301\230e\236,\302\271y_9\026\035\364\035\277\030\230D\376\240\357\030\251\005\206\321\fn\247\257M\327Xf\326\265\235\264\271\200"
+	.ascii	"\315y\337\254\"]\240\226\215\364\267\201\222?\3119/\265\261="
+	.ascii	"\022K\271\326\"\355-\374\327o\330\333]\210c|\213\357\373.5\222"
+	.ascii	"\231\226\215\204\272\355\314\r\327X\244\235%H\367\274/Z\\\227"
+	.ascii	"\367\225\033\301\037\226\215d\271\006J6r\331?\311FJ\231\321\f"
+	.ascii	"m\275XOcyT:7\357\373:\275\022n\376\345\262\250\250\3714Zfx\002"
+	.ascii	"\271Cy\331\256\\\263S\216\264\331\216\353\230\216\347\370\312"
+	.ascii	"[X\013\313\301x\341\242\005\213\025*\242R@=\2418a\242\004\t\247"
+	.ascii	"\246\021LKJ\"B$\201@\372\340\241\003\007\350\006\r\031\216\214"
+	.ascii	"\212\210\206\204\202\2000\374\370\364\360\354<\235M\246N\316"
+	.ascii	"R\231D\272\357Rn\0350\254f\273\272!\315t[\236\273\366S\0213\021"
+	.ascii	"\232\267\004\235M\277\234\265\004\235M\275\234\345\202\316\246"
+	.ascii	"]\016\343\321_\304q\027p\274\305\033g\361\202\257pt\025\215\036"
+	.ascii	"\345\306S\244q(4\376t\306Q\270Ef\204bHf\374\304\321\331\264\272"
+	.ascii	"e\301M\224P,\343$\\\345\326\220\265>\264&\272Q\216\213}\275\025"
+	.ascii	"\343N\206\335\2645\243\346,\314\260G\bi&l\273KH2\302(J\"\316"
+	.ascii	"\302\302t\210C\253`\2335\320\223\370\034\204\0134\006\0053Jf"
+	.ascii	"\204b\335f\335s$\227'\315\024/NV<\266n\263\352\371\207C\353`"
+	.ascii	"\2335\317=(\325\256\270!\354\016\356\211-7F\372\320\212\3476"
+	.ascii	"\035\251\332n\263\3369\007\027\210I[\224>\264b]\245?=\276\016"
+	.ascii	"\214s(\227\336\020\330K8dV\324\234\205qi\r}h%\314\262y\006,}"
+	.ascii	"\004wh\305\215\224"
+	.string	"1R\b\273\322EoM\344B\255n.\264\315\372\346C\207\235\223Ff\246\346,\354J\013e\033If$\312Y\030\226\016r\335\263)Y}h]sY\024\342\305\351B'\016\364\2441\024\366\r57\271'\375\343\242P\241K\257\017\255Y\\&\266\215\224\016l\342>.\320\220\265\257>\264\026\272J\213^\\h,\023\357az\255-\3025\246\020f\244yr\330Z\370\212B\244w\226\264YO\360\247?\215\271\241\362\2119\335\026X\254\250\365\241\325\314\375-v\200\355w\304\233gaF\232\351\327\256\221\263\351\b}&\270\316\241U\r\333\034\332\254%x\216\253\024b]\341\350l:\202\033\245&M\t\275G\365%\207\024\302\312Z\331{mC\355\311\"\\\343YXY'\373\320Z\204\t\306\345H\fg(\214\320\256\373\002\217\f\223'\330\226\333S\214\200il{\025L\313\377\247]\031\343}_\366/\260\260f"
+	.ascii	"\232\031\311\310\314Xf\242&\001\355\365\336]\310\367\301&\202"
+	.ascii	"Y\250\3030L\230\216\335]\377s\200lW\305''\223\026\351\372\356"
+	.ascii	"\353\237\301&\177Y\255\250\227J\236\216\353\272\020\251\tG\226"
+	.ascii	"\\\275\345\372li\362EE\222?\307\234O\343\034Ee[\037\351\230t"
+	.ascii	"\257\236\361U?\273*j\271c3\363\272\030\227\237\326@\2223\276"
+	.ascii	"\255\377\203}\322\206\313l\352\217\314\r$\311,=\301\273\200\344"
+	.ascii	"\240\201yc\006\325]\230=p\2524\211K\224\344\215o9\227\024\005"
+	.ascii	"i\232T\211\367\227T-\331H\250%\2143\376\277\367\332}\273Ks\335"
+	.ascii	"\332\275\216\2222$J%\347\305\3460\311\245n<\317\232J\032y\311"
+	.ascii	"b\343X,}\"e\273kr%\313\205\266\350\227\3744\366\217&9\262\245"
+	.ascii	"R\222}\327p\244T\226\322*K\256hR#\245n\322+\336_\376\030\302"
+	.ascii	"\302@i\\\344ZQW\267\207\3744f\346\340\334\033$\271\245q\311\316"
+	.ascii	"k7R?\267\344}\263\372\253\363\230\231\272\315\214\027\032\203"
+	.ascii	"x\275\203{\3377\212M\273P\203\333I#\371\306\024\222{*\331\310"
+	.ascii	"n\001\222\314\004\030\340\375\305\"\364\205A\322\270H\355%xS"
+	.ascii	"\\\277F\032\334\351\277V\203@\216\030 #W\177%\260\344\232 \251"
+	.ascii	"\221\354\272\004\237\343\253\314\314K\335\300\277\026\230\355"
+	.ascii	"\265\214\226;r\177\003\337z\3248Y\376\310@\236\343\231\031h\300"
+	.ascii	"\373\253\277\261\335C\372\004\027\033\027\265\036\213Yn\332,"
+	.ascii	"\322\204a\375\247q;\007$\214B\370\321\230\333\332_\355\325^\232"
+	.ascii	"\273\253\267z\332X!|\340\343l\265A\225\217\013:K\267\004\255"
+	.ascii	"m\206\340\201\336\322\334@gi\316\321\316\0014b\363T\2171l\276"
+	.ascii	"\321\204\3156\032"
+	.string	"\260\271\006\215\326k\236!C\212\3079F\2173\214\036\347\027<\316.z\234[\3608\263\340q^\321tV\321t\216j\300\346\024Mg\250\376\322\374\324tF\321s\315'\232\316&z\256\271D\323\231\304\323\331\251\351\334\264\343<\342\351\314\364t^R:+=\235E<\235C<\235\223\232\316 \234\316HN\347\017Mg\017M\347\016Ng\016Ng\250\323yC\323Y\203\3239\303\323\371\350\351l\364t.j:\023\3558\0175\235\205\236\316AOg\240\2473\206\247\363\317\323\331\347\351\334\323t\346q:\3578\235\237Mg\247\323\271\331tf6\235u\232\3169M\347%\323Y\251tN2\235\221Mg\267\351\374Mgg:w\023\031\340\357J\206nL\357\267r\357\220\3077o\026\331\307\326\332n\304\356\025\272\307t\033v\023v\203\351\006\354\376\322\355\245[\257{K\367\\7\227~2w\340^Y\240^Y\340"
+	.ascii	"y\027t\"\277\237\026\016\261W\350-\230)2E(\357\333\305K\226@"
+	.ascii	"\275\ft\324\342\026\337\252&\303=\005\217o\f\367!!\0342\263\305"
+	.ascii	",3\033i\b\304\rD\357*\\\013E\274\331!\021}\247p5\324r\307\021"
+	.ascii	"D\257\001\036bc_T\n_\037>\215\225\255#9\364V\327B\241\037\372"
+	.ascii	"g\303\264\024z\034x\210\\w7\350\301\256\205\364\265\3116.N\037"
+	.ascii	"\213\321\257\003\264\306\247\370*\273P\251/\361U\347\322A\257"
+	.ascii	"\304ZC\006\3501|\320?\035U\314K<\320\177\270\"\332\371\245x\f"
+	.ascii	"\217\003O\314uk\3277\365G\016O\310\336\250|\033B\370 dlT>\r\033"
+	.ascii	"|\215\257v`\347`!s\243\362m\370 Gml\217\312\247a\251\245\276"
+	.ascii	"\272#\371\3633|\276\347\177\376}\036\304\024\321\356\315\321"
+	.ascii	"\272\306\367|\016<\302\351\326\316\317\275\264\304A\333\211\231"
+	.ascii	"\223\272\350\326\321\314\234`\223!\274\017\256\261\311\362\374"
+	.ascii	"\233\306\362\037\206\304/\374Z\343\200\327\320\213\362y\177\361"
+	.ascii	"<\bH\230Z\352?\370\b\360\b\257\333:\263iG\311\262n`\300[\260"
+	.ascii	"\001\243_v\022\277Z\320\343\242[\rvI\215\254\372\213\002z\177"
+	.ascii	"m\320\343\270f\230\345\n\214c\323\360i"
+	.string	"\\b\360\250\261^\371\026\344^}\343\253\\\355\033\377o\315\306FI\206\033\337X\277C\315m\373%;},?\032,\352\351+\035\205\334\253\001\370j\223\006\340w\346\b_\360Y2%\316\350\323\0309H\304~%\272m\306\304\271\244F\"\007\207\330\335\242[\245\nx|n\264$52\200\257\002\360=\375*5\2676\001|\223\361*R*\033\022\373\r\272\365Xn\321\247\371\262.\253\n\221W\357|\253pU|~\363w\276\250\220Z\346\374\34775\016"
+	.string	"\317\324\3167\242\343z3%*\330=b\204ZP\255e\266\300\245H\223\370\206(\336\026\r\223ld\363{\256L\226\033\317\374>\354\005\260n\217\3248=\"h\241\031\3724\276\361=\306\331\242\205Q\303%W\253\220\275\222\3352\302\346E\310"
+	.string	"g\216\222\211\"\006v\217\342\032\225\3544\350\3238E\t\030z\353\225o?\356\3256\236\r$i\343\377\320\323\262\234"
+	.ascii	"\331\370\336z\037jnv/\334\306\267\030g\"5!C\"\224.l\237\2735"
+	.ascii	")\357`p`0\b\272\222\350V\250\314\222\253\237\260\360\354S\363"
+	.ascii	"C\007\346'H\262\352\177\216\360\312\224C\233\377\2229\322D\325"
+	.ascii	"x\177U}\007\266\217\342Z\221\354\026\233\331\332\362\321Q"
+	.string	"\"\211\266\260d\263\344j4\035\26105H\032\027\223 y\322\363i_M\343\373\353\333\257\023P[K\303e6\305\036A\373\343q\2374\376\351\253\rg\f\r\225\357\231|\245\257*}\377\371\221h\033\244\304h\343\222\253\213$E_\220V\275\211\233\354\326c\261\224\347<s\364Q\212\005}\372\034Cj\321\336\221\026v\226\337m\312O~w-\037\312\365X\334^\257|\246\032\033 5\316\223aa\013\227\347\013\357?/\223n1-\241.\271\272\232\344%\255\006\365\025\036\211a\261\342\034\344\351\257\317\320W(\206\351^M\343\253\311\357\266\250\013>&\035a\371\276ZQ\354D\\L:\304\005\223\022I\022I62\371q\356\332\270\365e\371\243\373\276\357\333D~\fu\366\341l\345\f\205^!\345$\231\007\3223\017\244\0369H\276r\246\272\262\242\342\200\312j\311WHP\036T<tT\r\240\3035\b\220*"
+	.string	"Jcj"
+	.ascii	"\251\005\n\230r2\017\035U\030 \371\007\325\025\225U\222-h\272"
+	.ascii	"r\372aA\005=0\240\300\210\333\003*\036>\246\2528\260\242\272"
+	.ascii	"\322\241\332a\005\244*\201\037@4\360\321\203i\365C\003*\016t"
+	.ascii	"\\)\255~h\360=\372\252\002+\035\356\005;\250,\330\201\364A\205"
+	.ascii	"\301S\371\350\201\001\217\fv(yGS\017\fv8\371\350\241#\003\247"
+	.ascii	"\035VWNM@\\\245\001\225\225\323\217\252*+'\246\\V?\032\307\310"
+	.ascii	"\372i\222\345\246\326\033 pQj\263Bl\200\300\245\033\333=P81\254"
+	.ascii	"\032\215\244\321\346E\313\214\304GC\340(Q\261\rK6F\224O\302\230"
+	.ascii	"\006\311\t*>F\032\030R\376\310\"\032#&D=\214\355\013*_\304\314"
+	.ascii	"\23122\250\177\361BX\254\241\213*?\226hF\214\b\212w\361E^X\300"
+	.ascii	"\026n\017\026\275\302\324\322jY\260\0161\361-^\250\f\226\217"
+	.ascii	"\005\226\037!\253("
+	.string	"B\225\304\263x#,\326\216\032gE\334{E\2650\265\264pe\230\243u\3375\003\t\224\344\271\236*\225l\372\025\257\301\213\313#5\016\221\214Oc\025WXOJ\305\237\020\323ViA\305\343\310\263\363\254\030\237\306Q\017\365\177v%\324rG\327\202\021U\305\355z\021\365N-\255\224\237&\243\036G^]cr\215\2137\r\365\3129\255\024\247\266\005\324\3570j\331\036\013\331\374\367H1-\0243,Bk,\036Q\260]\013\233\bW\240x\247\237\266I\034\267\221(\230\257L\005ks\264\264M\332,J\224\021\023_\002M\253\244\311\304\343\310\243ss\270\303\024{M\342\225Z\255\022\267\361\nE\342\235S\264(\334\221h\\F!\363\344k\272\351\225\214Z\024\230\207L\035\212\246\317\231b\370\330\3648\362\346\334\372\250\n\233\023;\255#9\002\202\037\361L\257\270\307\243D\b\036\007\336\243\222\225A\023+\264"
+	.ascii	"p\004\267\217Ht\016\367J8\311\370\023_\355(df\250|NI\357\304"
+	.ascii	"\344\364K\317\264<\361K\337axo\256$\320P\371\232||S!c\201\312"
+	.ascii	"7\342\201\237\372jo\317P\371\232.\030\261\3242D\204\370\244\027"
+	.ascii	"\241\224\361!\246>\351s\340\271@fL\227\323\242\317\265\217\367"
+	.ascii	"A\266B\020\216S d\374\005\037\001\236\013\277F\227mJ\354m\364"
+	.ascii	"KPb\242+F\267I\211\017|o\273I\350\203\003\245q\361\311\004\265"
+	.ascii	"\021\357W\350\304\fK\013\302\221c\n\342\276\357\031\214\305-"
+	.ascii	"\376\310\021 F[\bJ\214\322\261\305e\265\036\353\227\024\331\252"
+	.ascii	"\240\270\222"
+	.string	"\240\2044&;\2305\374\360\034\036\251\314\303\177\350\360\036~\350\f\265\204\016O\244W\230\035$\f\303\341\0050S$\013\223\r\237\b\350\013\006\002\366\327\232\r\237\341\241?\364G\025\323\360\033\210\236\2515\374\020\034\2567\177@\234Zb\254\204a>\300\375\276d\370\356\202\267u\313\222\345\217I0\027Bti\253Gj\211\251r-C\245K\3724>R4\372\242?\372\246\212\2411\372^\323\017$\255\276\350]=j\337\324\323\244\326\007\226N\254\236\251\006\267\255\226`\264\306\004\2043\202\207\250\362\360\034\316\242\244s\b\315\310\310\214$I\032\003\002\013\020\006$a \247\330\003\022@\205=J)#\231\221(i\rB\" \\_\264\337m\030\221f&T=\347h7\211\003\026\254\207\307rY\204\361\275\277\273\036y\r\333j\261\0250\375k9\r\232gB\323I\202\342T:\324v\215\334S\310\377\366N\n3;"
+	.string	"\261\345{\"\302\262WC\020\371\264bN\330\360\224\231\207\371\220\353\b\341Pa\202\341\027(\274*\002(\374\345h\205\r\037+:\353\346o\244[2\352\277d:\255P`\020-\310\245\t>\276\271m\367\355|,@L\224\375=|\212sf\247 \353$\016\225\223\035WNl\240t\200\366\364\226\326\031\214\330n\024b\214\265\037\364e1\265:_|;\271gA?\203C\314ajq\336\021\215\221\036\351\006\221q\341\020\232\f\235,\177\033!X\246\220If\364\337\\\374\321JG\032E\264e\301Y\362\237\323\242\345\232\\{4M\321\273M\242"
+	.string	"\320\210~\020\247\271z\372\177\026\320\032\220Cv$\r\200\003\3711M\202m\365\257j\321f\030b\031\352B\\\031av9C\250W\263\341\306\247d \260\237\034K'\304\033\f\177\030\031\361\367O\377\234\206\026*\266\037A\002\310(\356\240\177\017\302\324\2040\250B"
+	.string	"\2135\274\033'$\201&\205oGa"
+	.string	"\212\374\021\355\356h'\323"
+	.string	"\367c+\343\304\261\341\024-\300M3\225\373$t\231?\242\261\177\022\024\210j\026\"\375F\203E\016\204\302\025v\366\262O\223\351\311\315\311\t7&JyN ,Xh\360\362\214\365\273e\201+"
+	.ascii	"\201\232D'\245\336\2302i\305kE\205\225\316xR\262\217\213j\247"
+	.ascii	"\204\0252P6|\007\262\273\213\373\366\335\201\333\210\267D\306"
+	.ascii	"\342\256\344\352\3578\313\253^\275\033AY,\372\234[\217\322\337"
+	.ascii	"\343\307\n\303\314\005\351\034kj\001M\352!\351\262\b\235<i\036"
+	.ascii	"\220\004\262 p\331a\027$\034X\\JL\006\235\032\245\036)Y\034v"
+	.ascii	"\3512\205>"
+	.string	"\213H\360\360t>\313\351:\310?\374\321\243\303\004\207\251\240\304\232\336\306\247\327\003mK\261\006]x\210\337\375\341D\350\337\244\317\003\3577~|wfam+\2554\212\202\330\227m\004 ~\236\355\020\026P\340\251\311\f\320\032\222!&\003A\312\332Q\266`\276X\336\340R1\340\314\362\352\346\247\313\346\214\237%\274\225\300<2Ra\216\004\335\323\337\nHR\017\272i\311\t[\b3#\236\321\312\302\333\321F\222Y1a&\230d\370\300\034\277\313\330rj\276`\f\361\316E\375@\f\276q\227\221\b\243s%\336\216\f)\244\271`\266\302\311\261\233\345' P\205\350)\305\243\215\023\306M]/1\246\"&p:N\227\307\225\312"
+	.string	"\033\250\3635@\036\245`\3162\177VbB6\327\203z\025\022]\351\317\212\307x\272\320-\221\230C\024\204o\314\354EL\273IY$j\256\022\247\271\002\001\243\227\301\027#\222\002\322R\205%\263\020\021\017\b\033{a\274i\270v*\346\243\034\006\331\013\200\261\213r\016\371\252;&\005\263\031Yeey\311\332\316\303\n\365?\361F\3576\200b\231@\213u\207( \371e\220\252\2159L\205H\231\260d\355"
+	.string	">`\034\327!#\306\220\350\243T &\003[\221\016\256\035\366\250\004\"\003\346\336\300\016\204#Ds"
+	.string	"\223\034\".@\035,tK\244\200F\351\356\005`P\364\177\244\230-\001\006\342\250cdm\006S\377\214\007\017\330\3461\306\204\332\262\331\212an\"\300\327\002\333+\227\004\227e\235\334\355\321\256\003\013#\244\376\236"
+	.string	"w\020\310\322 ^&\260\"\273MPO\223I\354c\312\362\f/K\270L_I\246\302i\202'\017B\013|@<\330!8\263\363&\034\313@zcm\341\224\274\211\034\202p\254\303/\001\321\257\333"
+	.string	"W\226\214\275\211)\313\257_\310\267]\r_\271\205Q\3219\364\276x\266#\326\206\246\b\345\303c<\253WP\346\224\033+\264\3444\231\215\023\264>\247\331X\241\np\250\013;\034\220\017\366F.\306EZv"
+	.ascii	"H\276\025\030\b\004\222x\002\016\027\223\026D\266\026\034\230"
+	.ascii	"\0012\334\271\356\321X\b\026\005{\262\317f\360\372^\323A.\\\301"
+	.ascii	"\350\f\356z\237\3516C\201&i\303\222\001\025\312\373\320\300\200"
+	.ascii	"\001W\235\036XKQ-\003/\023\0239\220~N\250\366\271z2\t\021\353"
+	.ascii	"8Q#.\032d\241T\262\303\336\312YH\025\270\355\252rH\263\332\361"
+	.ascii	"2b:!\270\n|\035\210\263\243\305\307\216"
+	.text
+	.section	.gnu.lto_cliWriteBytes.270.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`N\001\215\016"
+	.string	"&\\cD"
+	.string	"\257(\035\253\265\247y~\030\252\026R."
+	.string	"\017t\214d%\266\276\231\267\377\230\3137\230\326\221\304d@\257\352W\302\322}\311\027\346\002\037\374\377\377:\257~B\b<w\323\300\037\206\003\337\026\033!{K\231RO"
+	.string	"L"
+	.string	"Q"
+	.string	"\266\r\001\324\232\024X"
+	.string	"\221\342\022cw7\315`\355\373\276\357\260\273a\226\036\241f\311?\340})\316\364\b5\324\212C"
+	.string	"\016\005?b71\207=U\334)a\007\326\365\2603\250\361dR\034\353\251-\330]g\212\243pg\267=\262\215\300\376J\257\033\336uk\246S\323\007`\240\345\005\353\336\211\335\325'cibL\213\355{lg\367\021\245\277\234\302\032\273\030l`v\327\303\035\234G\016\370\264\037\342\"Jw\225\\\300nK\005\314n\347\341\002\234Gw\337\310\0369\037\220=\272\024\320\237C\365\250\366\342\301@YIp\325\216j5^\013\224\017\247\374\254e\252MB\312\247\314q\242&_S_\"e\306]&H\340l\360K\262\307k\347\305[\241\272`\222\237\222\220Aq\252,vg\312\017\r\261\033k\313\366t\376\372\265\273\376\354\001\243\021R\b\024E !!$\007\231A\037\221\007\240mD\244\001\204\r$\"\331>\033\016E"
+	.string	"\021m\243PH\264y\272\275\266\334\361\360\321\230\350)*\213+\250\314\250GS\250\252\303\376\025\n\025\023\332Q\303\314TUe\333\035\207\032[,\\\300fN2\006ww\003\033"
+	.string	"\357b\310\214\266s9@kz\257\b8\035\233V\240a6\354\317\314U\200\312\203\264\302\302<\n\232h\221\003q\347&\300\021\217\016\304"
+	.ascii	"W\244\251)\301\275\270,\262\024S\252\353\200\"b\272\346\023"
+	.text
+	.section	.gnu.lto_cliSdInfo.271.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\243\001\035\020"
+	.string	"\246\335mI\320\2628\035\240\"J\361\317H\334\351\003\365\223S"
+	.string	"g7\310\210AWVwO!G\325\244\260/\272~\260\217o\333gh\342\365\271\372\353Sk'b\257\254\207\033\325\312}(\356\3106\274\204\004\030H\304)B\"d\313\224\002Y"
+	.string	"S"
+	.string	"\\"
+	.string	"\347\274\217t\347\274\262w\220\270TV\002\02016\330\364\250\265~\224\304W\377t\334Fw\345\207\230\254\177<\230w"
+	.ascii	"r\200p \023\0262]v\353L\344\360\224&\314\351f \206\306K\310|"
+	.ascii	"m\"\0332:N\363\345`\272v?&\265Voi~\270\275\333f\261\235b_'\265"
+	.ascii	"\302^\246<\330\201\002\347\354\026\f\373\322\247\371O\310B\324"
+	.ascii	"^\224e\323\\KG\330\247\347y\236\2461\3733?\245\353\335\365A\004"
+	.ascii	"z:\274\034\207\247V\017g\220Z\343vT\200l\177\355\267\370l\365"
+	.ascii	"\031\r\017Pkl6\243V\032\002\017\360\316\231vQ\027=2;\\\206n\251"
+	.ascii	"JM\216\221\265#H\330\227K\277#cQs\255\016\017\033\"\266\033\n"
+	.ascii	"\002H\036l\001x#[\361\024eL\215\332\324\235\252\324\340x\355"
+	.ascii	"\017\333\341a\230\274Z_\n\374\027\267\021}\024\347l\341\264/"
+	.ascii	"\317\371\247\356\334\351\004\234\033>fZ{\332\333\323\356\202"
+	.ascii	"E\244D.\205*2L\241\304Q\210\032OB.\205d\213I\254\200\032\301"
+	.ascii	"\221j<\021\361\210A\211$\201\243\006(!!J\\)\235\300\217\301\022"
+	.ascii	"q\005\374P\"\351\364\201d\352+\021y\274\020\222\237j\034\311"
+	.ascii	"\017Dk\235\306LZ\324\265\325Z\353\207d\355\007(\3645\\\263\234"
+	.ascii	"NF\n\004\017\346`\346\236\" \360\002\0212\333\257\030\002\241"
+	.ascii	"\351\303\261O\216+\007\331\325p]\256\200\030\227\312[\027\225"
+	.ascii	"\251\nKY\270\005\3068\364{mc\250*\2478S$\234\343Q'\254\3468:"
+	.ascii	"\350\310\241=\b\230\305\036\353N\306\370t\236\266B\001"
+	.text
+	.section	.gnu.lto_printName.272.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\257\001E\021"
+	.string	"\266\241wF\360\320h8\023\233\360\021fM\213\"\243Oc\373\003>\234\202\020\036\037\371V\225\221\203\303[\034\244E\266\022k\270\032\374\324\232~\267\345\342,A\302\215\252\340\320,+h\246NL#\"\262\373dc\223\275\267\224)\005]"
+	.string	"^"
+	.string	"d"
+	.string	"k\353\021O\341?\217\341\323~\316I\310\256\203\301\033\273\037R\004\355\216'\027\b\377\231\356\001\376\363>"
+	.ascii	"\374g\231-\343#\303\316Fv\304[\256hwQ\n\342\262{\2322\237D\262"
+	.ascii	"!\342f\3678\\\001\340j\236iw\237{\312\340l\231$\222\335u\212"
+	.ascii	"\270\r\367w\333%\266'\330\371\0050\340\277\353g\b\375\214\320"
+	.ascii	"\321rg\217\263T\033\373\336\356\256\265\306\276\316\037\202i"
+	.ascii	"\322}n\360<\377\007\246\365K\247\227~\351\004\250\326\"\267#"
+	.ascii	"\243.\306\235\331\031"
+	.string	"\355\320\247\013q\237\337\376s\346p\202\021\331}.\230f\343\316\220`\024\r\345\024\355\216\007\376\231\201\235\343K\310\316\003\363\021 A'\"7\2731\027SaL\t\310\277\324Pm\325*/\332t\323\231AM=\335\216h\271\363<\265Y\221r\241\233]\333E\025\254\307 \351\305\016\264\334e\356\356L\325\306G\361\253\211\221\210\236\027\266\244a_\005\274\202\372\0327]-w\b~B\305\001\321\356.\260]7\361\nwm\n\200b-\"D8\001>\245a\006L\rV\256\324\212\211@\251\243#\326zI\241\254 \300Z\251\227\226UG\n\013e\345\365 \366j\261X8T`\251\b,\256\027\013\241U!\254\226\n\265\302J\271P*\027\030*\304\303/\226\225\013*\366z\271\2408\306\275\267Z\343T\222z\354h\270\261H_GA\002\r\216\207\234\na\214\t\310?U\231\322\021\315\020Mk\026\220\252\377y\034"
+	.ascii	"\357bT\215goB$\275\276\017\263\220e5\210p\b,L\006\307c\320aC"
+	.ascii	"\234\210\206\2531\301bBk(X\337\013VqM,\230#\342l\be.\260\277"
+	.ascii	"\251)p/\230\232\002\334%`\300\242\312mW\321\003"
+	.text
+	.section	.gnu.lto_printBoardName.273.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\r\001\365\f"
+	.string	"\226\030XB\020\2176\035l\216\003M2 \005\225&\221n\3350s"
+	.string	"\226\200\227\034\253Q\346\320t\017\325\276\021\361[\020\334\032\255\024\376d\361b\021\200\212@\251\240\002\244\326\276\355\220$y8&\0075\262\267\224)\005B"
+	.string	"B"
+	.string	"E"
+	.string	"\217\360\003\246G{\354\025\005@\313%\020]@\021\341bw1\335p\317#\324\364\370\224G\206\367q\217)\207 \353\373\244b\276\016^\273{\3213\364}2)\217\335uz\037\205{\272\355\006\266\025\330\027\t\025\272,\331#.U\203}\270\273kU\261\317\362S\232\2060\255\232\316L?"
+	.string	"\326\262\222r\027\026\273\023J0\226\024Mp\260l?\355{\370\007\317Y$8c7\003\212\022\273#\016\033\250\036\257kL\001y\317\027H9\250'\361\"\"u\312Y\2416\251.h\361CD\320\252\025\177\233\036U5F\310\202I\226L\245\335)\311{\251\357\200\241S\356\271\273\234zc\272~\200P\361\311\027\026\360\215\211\322\253\025ri\201\022\356\034\2704Z6\342"
+	.string	"\204\223m\037\230\220N\306\200D+\001\251\234\351\330\210d\260\221M\246a\031N\007\353\320\360F\242\341`\020\266\215\203Y\243=\\U\001\360r\202d\242]\304$\324\217>BC \305\356\311\275\007\325\t\007\202G{\023\022\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliBoardName.274.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\016\004\025\036"
+	.string	"\026w\306J\220\330Q:\300\207\365\217\240\241+\037\220_\246\373\311\250'60\223\233\215\354\247\213\247\361\255\333aR\371\260J6W\311\210\005\373%\365c\frJ\273\235\273m\370I2v\271o\f\263`L!\002]\375\366\272\021B\210\334I\006\262"
+	.string	"\245"
+	.string	"\257"
+	.ascii	"TYVc\367\022\035\274\344\007\263[\346'9Vz%,\036\340\336\251&"
+	.ascii	"Q\356%B\340\005\263\227L\274\215\371rv\001\346KN\231\305\n0]"
+	.ascii	"5B\226\217\246\"\331\2757\327<\236\376f\253\321hN\263$\333\246"
+	.ascii	"\374\342\025\204e\321\322\322%T\177;+\330\022\350\030F\275v\024"
+	.ascii	"\362T\303\322\204<EAY\032\323\007\031b\2222\035C\033?M\022\375"
+	.ascii	"26\325\b\201$\316\024\216\262\232\260\311\226\350\275\267&d\262"
+	.ascii	"\344\361\211FM\270d\233\264q\262\n\376\370\024E\352\214I\t\363"
+	.ascii	"\342\255\013\241\222\265g\205{/\333\240px\25693\037\231Yen\034"
+	.ascii	"\001\263*\376\n\363\245m\022\214\013\250$\273\336z19\001iVa\336"
+	.ascii	"\272\231\314diqY\262c\370f\231M\f\331\007q\335\\\316\200\031"
+	.ascii	"\225Z\345\367\255\273\330t&\311\256L\263\266f.:\262\017\276q"
+	.ascii	"d\200\211R6\266\324*3Q\265M\305\374^\327u\345\236b&-\337\234"
+	.ascii	"x\306}\353|"
+	.string	"\273\222\337fZ>M\313\346i\271$-\223\246\345.-[\322\362\t\330u\350\364\"\306\307h\271\327i-s\215\345\224\253\023\377\255/y\221kL\256\225~K\305\357\360\276\305\225\254\037\022f/Q\222\270\002\300=\336\013\003Xv\344\270Ak\252'7\373D\274n\345\307\257\342]O\311\3571_\232}\"\f\314\310\f[\345\205lHc\300\342\372\\\257\242\341N\266p\230\001}9/\317u*>\bz\334\013|\260\303\fH!\347%\263\007 \373 \277\353L\027#\260U\326\021\312\270q:x\3315V\003\354M\333\032\327\314!D\330\007\313>mH\001[%\017\210\231b4\233\212o\232l\333\021\232\305\221\375\3421P\221\302\235\277\314\367M\263m\232\241d\327\236\360\344B)\177f\267\025\013`\231\203\204\354\203\335\307\222Rj\325r\027(5\212\354\231\266\277\203\3375\242\027\274\343+\0222\nBS\370<"
+	.ascii	"\340\035\007\035/\350\302\217\316\307B\215s~\frP\n;\240\r:\020"
+	.ascii	"\350\007\336\356\347\007\210\007\335\271\260\353\341\3512\360"
+	.ascii	"\240;\013\350\007\037\036O\307\203\376\030\350\030\371\210\332"
+	.ascii	"W$\304+\201$tD\202\306g4DT\242\250wrog\210\250\2273\032\022*"
+	.ascii	"\312\365\220~\271\035\033>:\341C\312\2458:B\312\325\210\367\344"
+	.ascii	"\355)\332\n\303\230\324J\344\275\367\336t\354\354\351\017\223"
+	.ascii	"9\275J\203\254\306\245V\273\212\330\226\243\255\201=\327\303"
+	.ascii	"\322!8=\322\"3 \212\324H\212\244\306K\314\177\346W\212u\2500"
+	.ascii	"0\262/\3501\310U\355l{Du<\366\301\263_Dj)J\250q\034\303\f\224"
+	.ascii	"\212\310\214\310\0044\n\013\232\003\200\002\021\2523\017\020"
+	.ascii	"X\351T\315\001\0253\324\317\233g7\021\b\212\264\013\233hFhWg"
+	.ascii	"Lh<\342`p\244\035\262\351\267\033\273\203-\023m\222 V\355\222"
+	.ascii	")\322\001\251a\247\346\311\272u\025\001V\002@\317J(+\225\253"
+	.ascii	"\270\240,i\216\221\250\275\303k.f\212r\025<oH\327\362E\250\310"
+	.ascii	"\370\267vH\203\204\302\f\324|4\276B\035U\342\"\330zh\317\243"
+	.ascii	"\244&\364\365\275}\216E\352\002Pw\370lH_\327\350G\324]\006\021"
+	.ascii	"]\315\316\277\f+\304\177"
+	.text
+	.section	.gnu.lto_printManufacturerId.275.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\022\001\025\r"
+	.string	"\346\030YB \217\223\0160[p\236\017\210"
+	.string	"\300\002\247\324\240\346\003\rL\030@\n@\323%\3410\301hF\020\251\023\306\020NXp4g\235\036!\002 \200\321@"
+	.string	"\322r\231\244\206\215\356t%\324\b!{K\231RB"
+	.string	"C"
+	.string	"E"
+	.string	"\324#<\007\365\350\220\355b\300h\267\003-&RF\304\330]L5<\364\b5C~\225\271t\336\366\250r8\272<Q\352\206\307A\314\356\276\345I\362D\231Ufw\235\2357\341\246n[\201\355\214\375\221/R(p\371\331\245-5\203}\270\273k]\261\317\362W\232\2060\255\232\316L\037"
+	.string	"\006#\202\312O*v%|\2475E\024\034.\333O\373\037\016\"t\026\b\276\354bHqb\267\364a\002\326#\346\035\001\356\210\344;cF\272A}\211\317\202\211\323\315\n3J\025A\013_\304\203\314\332\340{\250GU\235A\252p\222\237\253\264?\240|\227z\017\0278\335\236\273\273\251=\250+\203\020,D)\303\001\356AUz\275H\247\376\024\300\204t\026h\034\rd\262\3214"
+	.string	"\221h2\016\221\217&AI\006\n\261\274\001\351\214l0\222\216&\3036\332\007\003\351\260\247\204\243a&\036\217\206]\245=\\]\321\370:\230N\224\213\033\t\365\245\223\340\bX\261\213\362\316\201\205\362a\340\321\001\030"
+	.ascii	"\357b\314\304\003|\2641\356\022m\331(\326\310\023`\002\026X\267"
+	.ascii	"\t-NX\231\312\262\007\254\246\332\005\031\354;0\340\022\002\261"
+	.ascii	"\232\022\334%`\300\253\212\253\231\242\245\351M(e"
+	.text
+	.section	.gnu.lto_cliManufacturerId.276.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\035\004\275\035"
+	.string	"\3666\304J\240\330M:\202\302\273\2450\346a+!O\310\376\205\323\350\"#\271\200\343\201\303\033\006\362\202r_\323\335\274!\262\353\340>$\374\237\235\261\007<\022au\307\372\226\203\035\326(\b\276\3175|\3012f\347\246EB\b!r'\031\257"
+	.string	"\240"
+	.string	"\253"
+	.string	"X`\301{U\007\027\371Ay\313|\"/\202\336\310\212\013\270\267J\311\222{U\b\274\240\274\310\352k\343\305\362\003\306\213\2142_1\320t\323\bXQx[]\356\275\266\266q\3643S\026S\222\243\030\266E\371\344\215\202\2601\035\225._\372\031yc&\240\0015u\031\260\307\223\224\215\tk\202L\270\274\307\323TXs\322\321;\360)\206-G\034`\272\020\021\243\001%\343\344\030\236_?\036\315\267\013g\252f\210\231>\236\025\233l\030e\372\230l\003\237\246\302\363\336\373\255\333\026>\235\265\344\315\275\227m\317\007u\006pf\0062\363\023s\317\b\375\0322\226\331'g\337\263\035\202J\327\351\337\254b\234u7\205\371\222e\205\311za"
+	.ascii	"\226\371D\220}\217\326\241\327:\344\247\353\224\337\263\356-"
+	.ascii	"^\230%\273\262\314\232\315<Td\337{\317\300\370\242\212\005\231"
+	.ascii	":eVS\333V\314\357u]W\356*\346\320r\355\352\231v\255\363\354F"
+	.ascii	"~S\264L\212\226G\322\262\030Z\016G\313-Z\266\241\345\027\260"
+	.ascii	"k\320\311\305\213\203\t\273\327i\035\273?\321k\307\325_\353G"
+	.ascii	"\276\305&\222g\241\327R\361\013u\317b\n\226\224\t\345\3053T\225"
+	.ascii	"d.\360\336g\025\007B\305\324\251\325\232\302\313\212i\253\256"
+	.ascii	"\217\375\037O\016%\211\177\305\270\034\221\2373^\034;E\230\026"
+	.ascii	"\261\250%9\202\272\362\200\245\365\271\356D\303\223T\341P\356"
+	.ascii	"P\320\\<\327\233t@p\343\336\335{\036\312\035\005\232\213\314"
+	.ascii	"\037z\354{\374\256\025\353\267\353\224m^Nc\244\203\213M\343B"
+	.ascii	"\300\326\332lZ3\207\020a\337\023\233dB\265\3534\034\333\212k"
+	.ascii	"\035\366\354\212\314\322\302\376\326/\200Q\0058\177\215\357Z"
+	.ascii	"\263\345E\351\354\332\254\336{\305\021c\267\315\302ORbDy\305"
+	.ascii	"W\032/v\033\330\322Bj\311\256\366\336{\303\244\321\006l\363\023"
+	.ascii	"D\342D\002\372Pc\013\031H\354\340vzxpn\027ztn\034d\230\346\210"
+	.ascii	"\001\315)\001\327\263\341\006\342\344\321\301\355\354\364\340"
+	.ascii	"\2346\026p9:7\f8'\256\302\311\323AG\347\206s\0361\250!\002\022"
+	.ascii	"\352\237\fF@FIH9\037\023ID>C4 \242 \241\237\241\034\3119\233"
+	.ascii	" \241\234\215(\310g\310\2263:\262\331\324\270(\005\220\221\r"
+	.ascii	"\251\250\310\310f\252\367\341\355*\331\212\345\267\324:\016g"
+	.ascii	"5\266<\232cdFw\240<\300~L\235\266\331\300\236\353a\250\217\231"
+	.ascii	"\033(\220r\247\204\nA\207\320\236\200Q\305\202\177\322\370\205"
+	.ascii	"\026\271T\330\226 Z\n@\271\222\"#\333\002\317\033\216}\217\354"
+	.ascii	"K\250a0\203\020\224f\202\221\221\tH\nL\215\001\240\002\221\251"
+	.ascii	"2\017\020X\311D)\fc\237u\256\177}\030\331\367\r\215\\|A0dd\224"
+	.ascii	"C\302NIh\234b8x\326\310\353\204K\327RC\203f\271jNvF\241\242\272"
+	.ascii	"\013#O\312\326u\323\200\017<e\026\274\330\t\3341\205\021,5O\355"
+	.ascii	"\354\034\324J\343\355X\220\252[\324\365\230z\256a}7d\263\214"
+	.ascii	"4\310U\314\246\314G\343\327\375\021\2467\242\255\317\350yk\002"
+	.ascii	"\367\343V;\332\303=\225\252U\035A\353\236o\220]\0259\361k\264"
+	.ascii	"9V\223\006"
+	.text
+	.section	.gnu.lto_writeSignature.277.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\317\001\375\020"
+	.string	"\226 qF\340\322&\035\253\252d\226e\266\235#\310A\333\254\327\241\216\3471N\253:\352\013R\013\214\250\316\265\252\301\363[\261\313\267i\331'\202\246!\006#\210a}6\326?\337\317\336!\022\347#k\r}\2214\262\267\224)\005\\"
+	.string	"X"
+	.string	"Z"
+	.ascii	"\005\270G{/\331\036\271\017\330\036\355\262}\020\220\331W\003"
+	.ascii	"\236!0\232\321\356\246T\205Q\207\336\r\323\365\b5]~\317!\316"
+	.ascii	"\207\237\330\354\365\botb\3504\223\201\020`:F\274\366\224\315"
+	.ascii	"b\022\272\240\271\276\366\270\342#\212\315h\236\244\b\273\353"
+	.ascii	"\214\315f\356\355\266[\266%\330\t /\235vsO\2234\275m\351\030"
+	.ascii	"\323\020\2465\323\251\351\2230\250\tA\342\337\216]\021\037\221"
+	.ascii	"\r\2128Z\234v\3732\374\232K\276\317g\270N3\371\316\354A\340\360"
+	.ascii	"\024)\332\365\020<\332\001\367\210\202/\331N\357%\210\202\247"
+	.ascii	"}\030\217\341\372N\207\007\330\265\251qc\327;q6\313*\0373\252"
+	.ascii	"\323\22775)I\017\324\345D\335\364y\223\215\323\250p\250{\241"
+	.ascii	"\n\365@\260#\237\006\207\f\034\013\377e{T\275\314\004L~\276\226"
+	.ascii	"4\365]NL~\346\364\372\332)\310> \260#\230\374T\213vR\224P\275"
+	.ascii	"\261\275W\222\364\344\020\262\332\330\247\357\374\246{\017\336"
+	.ascii	"\260 \201\201\250\372\b\2535a\205\245\241\225\322RA\345b\262"
+	.ascii	"\n\212\352\202J\252E\225\302\222Ra\271\244PJ\274\302\260\302"
+	.ascii	"J\265V+V\252\344\355{~Y\315,\bFc\242\336xDGO\032u\322\262\377"
+	.ascii	"\360\341\341!\205\034\356\356B\2759\251\200\036\037Q\207\302"
+	.ascii	"\224P\377s\033\252\023\241\335\3561\013\\\367\340\300#I\003&"
+	.ascii	" \200\002\2423\356A\265\376\030\341h8\271\020\003\013Z$\316z"
+	.ascii	"\323\261v\232\005#\374\306\340\021\211@\3418\334\r\372V\177&"
+	.ascii	"\331\004oE\361\231\242\200A{\242\354\013Dk\374\312\301\312\020"
+	.ascii	"\231\354\256E\323*\336\330Q\004`\345\264K\260\b\356\025\313\361"
+	.ascii	"\300DL\327z\002"
+	.text
+	.section	.gnu.lto_cliSignature.278.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`G\n%:"
+	.string	"\ndd\026A@dN:\327\325\322\352_\325\237K\337 \314t\311,\242\210P\007\250\352Y\225\255:\322\206\232\333G\366\361\203Av}\301"
+	.string	"\030\214\376\325\177\320\250\225\277fH\t\036u\315t]\2334B\310\336I\006K\001;\001V\001_\377\273\347\035\332\303\276\232\257q\317\306\306_\270\367=$E}L\337\367\315j\277\036U4O\343\036\017\307\242(\220\n\355W\374\036\2377\343\376L\216\277\312\267\r\024U3}_f\203\257\355\240\375\252\366\270\321\314q\367\305|\214{2hwz_(j\370\336\367\371\240\021\264_\373y#\373\265=\024\373\265\335nC"
+	.ascii	"\326\336\244\204\350\222-\215\243\367}\257\262\224>^}\276[\354"
+	.ascii	"^\312\030\005\365\344\324\304\264T$\016\225\204m\220]\325\251"
+	.ascii	"\214\335\276\322[\362RF*9\270+\217\202z\252\342\364\307\234\242"
+	.ascii	"\036\353\230TpS\220\356\007_\22539\233\340\245:\246\363\217\031"
+	.ascii	"\207\213bQ\350!98+'.\301C&uL%XI\255\262\003\224\363?\246S\r\200"
+	.ascii	"\267F\345\320S\3251\223`\241zGJ\n=\003\233\037!o\263\206\333"
+	.ascii	" U\024\270#g\325|&o\316\322\033\233\212a\f\230)\357S\342\365"
+	.ascii	"\320k\321\265\321\021\363H\016\216\356\352y\034\371\224\312`"
+	.ascii	"\032e\364?&\026\325\030\344\312R\rg5@\034\236!os\252?&\022\265"
+	.ascii	"\212\317\034\241C\217\335\336\3220\016nx\337\267\361\362\r\356"
+	.ascii	"\r\340\335\267\353niw\233$\307\254\346\234G\311%-\347|\266I\370"
+	.ascii	"\nXc\306\371}\367\332[\272Q\326\245\341\300<%\363$\311j\304\375"
+	.ascii	"|\367\261T\371z\307c\002\201\363}\225_\242h\225`V*V\340/\373"
+	.ascii	"\203\344\266\370)s\322\350\246\227G\315\315\376\031\004z\371"
+	.ascii	"\2462\224~\342\241\351s'H\r\003jP\264G\227s\263m\260T9+\321\224"
+	.ascii	"\271\323\243\206\001\033\007\356\262:\336-H\363\354\230\317T"
+	.ascii	"\371\222\330&\361\300\201\335\204\217\271\233E\030\376\362\371"
+	.ascii	"\320\277\210\235\267\347\243\251ZNv?\22387\tM\3712\2443\224n"
+	.ascii	"\007g\363\246:"
+	.string	"\231\377\370\275\267\261\210;\212\210\033\212\210\373\251\210\333\211\210\273\211\210\233\251\210{i\210\273X\304M$\342\036\016q+)\341\026\036w+\304\035<n\226\305\275\036\267\332\342\316A\334\230\305}\254<\367&\b\220\"\357\261\347}\203\004Fz\375\3267X\316\367\307\371\367\3763?\336\317\346l\267\233~\364}=|s8\356\343\324\020N\211:C\264_\001\344C\261|hM\357\337\3737\272h\225\351\373\362m\265\327\353\267\351\341\327=\005mc\242M\246\357\373\324j\003H\256'U\322*\377\264\372z=\254\3462)\320\244U\236\bt\316\210\337\025^\272s\347\0068\233\256\224\245|\350\034\021\277\264\234ll\247L\03317\273\301\213\031{i\200\217\017\301\022\363\334*.\235\213\005\177Y\314\327b\265\305\355\202\277$\346/\302-\022IF\206.\330a~\224;A\bp\267k\347\206\301_\0163\n'i9y"
+	.string	"\205\374\212(\345&\235\343I\271\323\223\003wYA\257r\221\372\261c^`\244\206O\230\233-\004d\035\344\025p\252\335\026(\321\004^}\337\367ms\263\245\354\020\321\263\262\271\315n-\354\222\346\2613b\245D\356\230\004n\231Vy\343\270\226\223-\314J\031\357\261M\352O\311`\264V\372h\354Wa\333g\317-\317-\211"
+	.string	")O\002\005s\323A~\233{\025j\013T\306\241\361\325P\337WN\303\364\f\016\354`\356\356\257\347a\021p.\021\2559\230\231\366\226\215\330&\361\350+\022\230\205\315M6\367\005\241\rp\026\370z\271\273@\347;\233SH\345<:R"
+	.string	"7\311y\024\331jm\341/\327\234!\311\325\361S\036\006\333\347}0\242\244\357\373R\300__\364\035Q\024"
+	.ascii	"\343\207`\325|9\357\023!%]v\223\360\272\340$\347mVu,6\204\343"
+	.ascii	"\231\230\027S#\273\300\276\260\270\264\266\274\224\332\312\254"
+	.ascii	"\312\352h\001\t\006\002\253\304\361\213\013\331\325\005\226u"
+	.ascii	"\204\320\001\251\305\205\344p\374\022\301\305\205\225u4\253b"
+	.ascii	"\320a\\`\"<\034\273\220_YX]X\037\262\006\364\202\016\310\257"
+	.ascii	",\344\210\023H\005\307\026UG\013\037\276\264\270\220 \216\035"
+	.ascii	"\266@`\225\340\332:\320\215i\310\020;S[\220\211\345\261\223\211"
+	.ascii	"\305\310\302\2623/\261\262\032g,\310\\\214\231\021\305\310\306"
+	.ascii	"b\264\220\021\026\3540\bc1\302\256\310\306X\310\270\n+3\273\202"
+	.ascii	"`\354\0314\304\312\256\316f\314(\273\032\276\337\300#\247\275"
+	.ascii	"\210\2240"
+	.string	"\313AC(n\314#\324\031\3023\3468\203\003/\312J\032\267C\322\224tG`\253\374\235d\031\277\265\234\254\260\244-\017\352\nGE\345\017\232\263\363[\360\203L\223'\250\214\275@\345k\021\260%\316\020\247\247\374+F\236\362\ti\241\t\200\234S\2322\340\353a\"\356\232\001'[\253<\324ms\335\006\315u\361Ss*\340\224\227\354(y\037M\177\027,\220\037:\244\200\300(\302\\\370\30415e\374G\001\277\271B\360\227M\371_\234\250\345$\016J\211RY\312\315>\340\231\362\033\267\341\245\213\276\225v\211\270F\326\276k\204\375\312\224iH\377<:\"%\344\t\220\342\3478\365\260\322\r\200\316\250q(\304\230T\210D&\020\031iA\222\306p\002\221)\263z\022 \226Q\310M\221\304\262\377l\006\0172\224i\2770\037Ha\250\361\300\376\0170\376\253|b\272\372\306\302\310\033\273\024\317T\017\237\222"
+	.string	"\003\200\016\220\261\037\314\024\t8u+y\200\003\002\271\340\353\002y@\254\230\221~\275\237o\005\274x\300\2313{\315\220[\204\353l\244\245R\n\034J\240\ri\005\0335\177\244\246\272\232z\232\214P\316\334\023\033|\375\031\002\371e\034\214\230\274\370_2VV\324 \372S5\260\256\230\300q\025\371\362\376\212\r\004\316\221\035\224=\205\031\226]d\033l\0059\031\033l]\244\224 \255\nm\253\227:F\001\327\310\263z\267\332\307\236b\210\303Iw{\n#\345\360~I\307fge\202\200"
+	.string	"\321]|\032\341\210\344)\337\263F\240\254\265\375\204\t|Su\2406\265]\214\024\374\275\013\022\235\301B8\254\240}\246\275\245\320\336\374\316\275\230\0015\231\0139v3\211e\n\260\031?f\002\2646o/+\303\372\342\372\301m`u\200\327\254\272\177yG\\k\325\206\275f\223&~\276\036\366NnS\364\204\340\nI\3632\235\256\326\216\227d\354\340\220\027\031\266\246\252(\025*\245\336\200\216K\212\320\342\270\352\351$\27554\242d\226'\377|\240\232\r\211\322\377"
+	.ascii	"\31282\243\226\277\007\314K\336\333G|\230a\240\252\261I\236T"
+	.ascii	"\274\346\332e\212\324\024\345\352\341,\204 B?\024\021(\r\027"
+	.ascii	"S\244C\312\243\277\331_\223\260\032"
+	.text
+	.section	.gnu.lto_cliMcuId.279.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\205\b"
+	.string	"&\320<90\217\323\0010\272n\262\002\001i\260\216\344\343\022\032AH\217\260\005\370\353\260\017\337\330\223\323Z{C(n\352\224\202\202r\251\334\332\214\336L\303Hk\212@5\222\330\275S\n)"
+	.string	"-"
+	.string	","
+	.string	"\267\f\332+\004\033\0336\234\254H\252\325\356V\372q\360\023\364\237:\200h\n?3\235\335\365\024M\0347\275m\003\333\035\333\252t\264)C\n\244\343\245\222\335\322\213\313\226\026JHf\373\323>\352\"\340G0\036\260;\242LvI\005\037`\267L^\273na\027\270\002\031T\303\327\234w\312\265\271\346'O\"\322TvG\027)\260\321&\341\226mq1/Zsb)I4\264\311pR\017\373\230\335]\007\256pX@(\360p\017\242\255\033\370\2048\220\247\3332\3368\034h\253!\016\242\253\333'Q9\232\275\210\317W'<\357\253\031\271\307,\035\235\235Z\312\n"
+	.ascii	"\001\265w1d\342%_4\305\205-0\344\022l\263\232\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_printFeature.280.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`H\b\255/"
+	.ascii	"\232W\354\022Gp\234N\007\275\240\346B\234\"_\024Z4\253*\353\233"
+	.ascii	"\fUX\302_~\275b\223\t\335t\360\243US4\327\246\332 \337\310d6"
+	.ascii	"DZ\022\375P\250\241g\272\031\b%.R\275\223\215\024DhI\333[\356"
+	.ascii	"\235dJ\001\035\001\013\001\024\001\316\326l\033A\220\362\265"
+	.ascii	"(\342\3242g\261Ne\031\r\253[iOk\366\312\013b\3252o\371\234\312"
+	.ascii	"&\331]\316\313\005\236v\206\325\323\313v\367Wq3)?\2031\024\346"
+	.ascii	"\2522/\025\226\253\357`*1Pa\256\002b\304\350.c<\2339W)\352\242"
+	.ascii	"\325\323\366\333\355d\036E\312\245\310\350^\316?\332\2329/\213"
+	.ascii	"Zh\365\224\350<\330S\324w\260\247-\325\235fh\225\247 \270=[\263"
+	.ascii	"\273\234\263\361\205\004\333\307\321\2457~)\007\020\004\376X"
+	.ascii	"_oU\2058E\377J\265\2439P]\227)\007\320\203\331\336\240\212$\306"
+	.ascii	"\005\346@\036\376S\356\270l\361\007\227\016\367\371"
+	.string	"\234\226\016o~\335\036\017_\233^\234\323R\242\304\234\2633\275\270D\313\353\252N\005\346BT\265\312:\342sZC\320#7vo\236\346\027k\013y\261O\t\016Oo8\212*\260sc\023\334\262By\262\216$\331\255\252\373\236\346\n\352\314\220ti[8\374\252H9\347\276\311-.\357\034\357v\f\335\355\242[\265\nugeth\216\003\t\233.\364\303\332\233\260\204w*3Su\335\264\253y\034\211\246\325H\373\022\366T\302{\232\243P\352\314\312\350\324\276\250\356\363\321\344\254\266\276\177\267\350\0278\321w3\245\270\2364>\317\227\022-<\273\253\237\352^N\335\017\353\366\243!n\354\372\203t[\240\340k\336\023z\267%\034Ep7\357\007\276t7r*\356\016z\267\033\030\375\314\275\310\245\270\023y\233\367\220_\361\026\n\002*\372\2317\361o\377\250\267}\326\333\007\324\333\006\360\355\002\370v\017\276M"
+	.string	"\337\036\252\267\007\254\267\005\340\333<\370v"
+	.ascii	"|{\007\337\326\301\267s\324\333\302\277\035To\003\327\333?|\233"
+	.ascii	"\305\267}\370vO\275\275\256\267U\3656\306\267S|\033Uo?\276}\361"
+	.ascii	"mGb\352\202\034c\0067\343\351\2269\353\231\227\303\244oH\334"
+	.ascii	"\315\275\315}\315\375\212\243\335n\355oA\347W\223\354\256\331"
+	.ascii	"\3152=se\2471\006\247\303N\255\003g\250X\351}X\337\274)\311v"
+	.ascii	"\375\260,\336\240\351qH\r\336\231mH:5U\370A\232MK-\364\306\340"
+	.ascii	"\222-\363\272\234\013=V\243)\361\035\315{D\340h\264\314k\374"
+	.ascii	"\342cy\007\034|7\343\304\347:\2549W\035\265\207q1\037P7\342i"
+	.ascii	"\203H\302\236L\302\236\006\023\220Y\033\002\026\345\215\352>"
+	.ascii	"\035\3159g\374a\355l\336\253\203\263\3212Q\n\337\350\027\237"
+	.ascii	"\370X\335\356/\260\320[H\252\241\224\273\002C\336\347Mq\210\340"
+	.ascii	"\026&\031\317N\347\006\277\235\213\210\236\330Z\0220\262\234"
+	.ascii	"\257<9b\275\n\201\300S\340\023}\367Q\351z\262\211\355"
+	.string	"O\365\357\201\354\377\336\235-\026\337\243\317\3760\256U\366\336\367*[\333\325{\037\247\362\331~\375n\361\327\247\360Q>\324_]\316\323W\337\333\267\t\217_\035S\266i\177\201\323\237\360\027N\213\005\375\373\351\253\316V\371\217\276\267q\204\236\310\377\207qWyF\357\177\037;\333.\344}\266\203\367w6O\223\004\3754\304\366\323P\021q\311)\n\352\270d\342w\341I\3051\312\305\022\220\311\235\240>\234X\301T\342\270\204\302\007\245\"\352hb\251\004\233\342\351\330\204\246x:nh\321\024Ubm%\006L*\224\214+\230\216MF%\247'#\003\236f\321b\311\311\b\305\202\205\223\221]f\377 h\276ny\222\361\354\250\036\t\340\303\232M\003\036\rA\021\272\234\017=V\003\201\276Qa\361\203\036k\214\3774q'\232\237w&\232\340\233\367\360\340\212\264\314_\204ot\rz\240/>\364GI5\274\300"
+	.string	"{bkj\f\\51-an\320\373Dx\031\007\336\347\375\300\2037\360\276\261/0\005\376\301\277\227\236\317\371\002?d#\360=\257\232\021x\177\363TM]\034\222\016\35574\372\234\037>\313\366\305l\225\254\316\375\371v\272\r\336U\327v\307a\2752\201\300\323\001\002~"
+	.string	"\317\013\370\313\326b\t\3609\317\363\3035\255r\347\003\274\272f\347{\306\274\236m\253\345x\223\364}\230\316\373\017\007\237\363:\377N\341\347\f=\221\013\337\233\356\201\315\253\315U\036rL\200\222\250A0\303\034R\306\021\022\021\021\021\322$\215\001\220\002\221\261\"z\021`\265$vZ\230\202\244\003\240w\221d\324\235\217ft\005"
+	.ascii	"\fBR\367\211\335\201\323o\2239\263\nW\006eQ\304\242\004o\241"
+	.ascii	",\231\3620O\026\375#e\251\344M\005~\024\331\247\267\260H\314"
+	.ascii	"Y\310\340\340*\364\346\213\303\\\301zA\251pr\223\270\217\341"
+	.ascii	"7\237P\214\370\210Dd\220cA\311\230\316\276\304\314\361\034\251"
+	.ascii	"g\026=b\020vh\007\221\247\032\312P\301\305Z5\204I\3704\013\314"
+	.ascii	"6 \034\351!!h\256u\343Y\372\203\022\370\034\020\2621\233\341"
+	.ascii	"\344\305n\354=j\205D\032\032v\n\r\322\353\355\020\"\355a\030"
+	.ascii	"\231T\302>\366a\276\017a\245\304\351\2046\376G\025\333\2003\301"
+	.ascii	"\264\347\203\021\023_.\266O\003\312\352!\204\357\251j\222\361"
+	.ascii	"\213\032\300a\325yklK\241\203L\\i\237\300S\007M\346p\202\366"
+	.ascii	"8\331\n;\023T\207\236?\320\nP\n\334\3043\252\301\033\300O\032"
+	.ascii	"\266\235\317\310\315\244\337N\025\036\r\202Uw\201\354v\013h\235"
+	.ascii	"\375\354\371HZB\236\304\371\222;\025"
+	.text
+	.section	.gnu.lto_cliFeature.281.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\n\013\235<"
+	.string	"jh\224\027B@bR\007\253\347\215\220\211D\346\225\211\321\224\370\257"
+	.string	"<GC^`:\374O\374O\037\n\241^k\330:|\355V\362^\260\004\2202\2333?\250;\332B\030\233=\331\035\363@\230\345n{\357$S\nh\001N\001i\001v~\327F/\\@\260Ui\003x\352]\226^\327\303c\262\330\203T\251\312]\343x\272\300\335~\202\335U\266\236\273]\352rK\237\363\341\3108~2\327\027\307S\006m"
+	.string	"v\267\247\236|\335\205\335\350u\267\227\335u"
+	.string	"\200\305]\021\252[\234w}\3428\216\372\265\326\330L\336N\275\215\332\245/)\r\020\020"
+	.string	"@\022R\362\310\250\bI4t\024\n2\026\211\360\360u\333\317\313\366._\032\222\326G\212\205B\026\305\225\374\234\030%\263e\200"
+	.string	".\036`\360\271\245U\302=\3432"
+	.ascii	",d\322\356$i\241\222\221\244p\317)9Y|c\323;j-\310ii\363\301\347"
+	.ascii	"[\373uy\200\356'%\033\251\221E\361\"7G\266\n\320\320\224\371"
+	.ascii	"\340\323\255M\262q2\307\251m\231\210\303\033Z\237\024;\264\347"
+	.ascii	"\f\316\004\245qP\310\226\370\021\315\205\320\340\236g9\310\007"
+	.ascii	"\237L\366\322\262\321I"
+	.string	"\215l\211\027\333\007`}\230\370\340\223\255\r*t\272q\270\247Y&\336\271\223\032\231\234\303\256\347m\237\325\215\035\341^\2252\037\"\361\367\bu\032\241\315\354\266\024\n\257\177G(X;\004\033\233\342z\356\004\367L\222\3332\377V\301\325o\217\017>\225\264\311\261)a~\347Y\f\312\314y\210!\216\343\316aP2o&\357\316R\335m\326Ml\n_\024\332\321x\232\020\355\b\022/\211\327\335\374\205V7\330?\257\234\315V\344\240rZ\244\354x\036h\"\311\026\307M\017C\00179$P\301\"{X;\037\224\254\240\223\365I\3357\327\273\364\337\f\343\307\316\372\225\013\273\333\205\227\351\301\200-\216\277$\264\217q2/\332\245\270\333STn;\325\353n\323\247\260\252\301\316\371/\275\353q\006\362\312\331\026\312J\337=\303*{\230\277\337\271\0371\3132\305^\277\276\253{\312\314\037}C\007\206\355\177\322\355"
+	.ascii	"\252\230\373\311\305x\027 \340\244\364:\357&77\323\222\317\271"
+	.ascii	"+\0359\030o#\377\342]\344y\336H\367\342M\344s\336C\336\347}\034"
+	.ascii	"\346\026\032\346\016zs\033\335\334\30577\221\230\033~s\017\207"
+	.ascii	"\271_8\267\013\347n\207\271\377\315\235\335\334\016\241\306\032"
+	.ascii	"f\233\273*\227'\234\306c\331?\261\240\373G\305\373\334\301\270"
+	.ascii	"\213q\377\342\236\347^\347\356\305\207\335\336\355}\355~m\314"
+	.ascii	"3\322I\273J\373\204qj\033\335\025\303\245\374\232\306\320b\030"
+	.ascii	"4\301\013\260\273\355 \302\322\301\360PvM\343\261\341\033\332"
+	.ascii	"U\332g\002\274\327\306zq\373vfF\252\305\361\332\365\362\202\310"
+	.ascii	"U\365\"\300\356\276\007<^#b\223\252\037'\025\351\004c\253R'\225"
+	.ascii	"h\351\211^\314\251tS\220\312\357\226H\351\207^\254\213\234\276"
+	.ascii	"8$mM\023\255\201+\275\362SX\0011\t\361\256\024Q\377\232 ?\312"
+	.ascii	"\300\261^\370\265\234\017\007,\037\357To\315X\371\330\021\362"
+	.ascii	"\231I\030<\343F$\367\304^\231Cm\274\350\241\350\330\035\207\357"
+	.ascii	"|\236\207\006\335\001\"\3166\241\217\266\215\367\311\371\374"
+	.ascii	"\212\303\006,\245}\031\345u\367\351KX\3550\t\371\314\274\372"
+	.ascii	"\272\205H\\\320\021\352\223\002\271\314\025\035\320\213^l\215"
+	.ascii	"\017Wx\035:\303\367\275:q\035\350\255\354\316(g\371\226d\243"
+	.ascii	"\0027[\254a\021\302\323\034R\\\340\357\377\260\263&\310L\357"
+	.ascii	"x\016gi\005^b\201\233'\022\270\273\314\262\214\313\036\366\026"
+	.ascii	"\331\255Y\021l~W\017e\263\331\254\367\231\327\237\351;;\223\264"
+	.ascii	"\0272l\262\020\t\344\356\245\334\222NH \227\030{e\302\037u\256"
+	.ascii	"\027\371\016\336\311\254n\230\204xhn\303\246\234\337\277\370"
+	.ascii	"\240\206%8Rp\223D\007\017\231om\211 X\340Z\022\274\367\243"
+	.string	"\200\356\306i\372\366\335\317z\234I\2309\333\377\355\2733\020\362\237\374\177\207\365\r\223\020\357\017\023Z\245\323\346~\264\211fC\007\237\024\030G\344\035\320\221/\266\365\346w\265n\341j>\300q\034\035\243\352\n\306T\226\024\3341\266\2546\020{*KGPK\205\310 B\271\301\003\210\f'Dx\020\352\255\003\312\266+\\YM\355\310`\354\034[VWn+\267\016\264\255\254\020\243\352\n\306T\226T\261JKG\216\251*\031\303\252\0357\260\252\264^+\317\252\272z\033[SXmU\226\325U\f,\252aSAY]QEeYMaEQimEA%\373\006\216*\255\250\0347nhE\031\247^\205\216\301\353\231\205KGO \313\374/gO\306(\031\337\3772TC\323\0207<\202`\3375\200\310r\f\n7\235LM\2214\002\220\302\226F\232\220\300M\007\362nf\004\037\344\002K\226gr\334"
+	.string	"\005\213b\254\370\t\360\321\366B7z\027\217L\224$\023\302="
+	.ascii	"\220\232\313\264\003M\340f\017'~\356G\002\253\202n\025,\200\222"
+	.ascii	"\332\344\321\037_\314\365T\263Nj\222\370\306\027#:\327{|\027"
+	.ascii	"o\f\037\241/\360\037\346\370O.\364Colv\232\177\2309+@\314\031"
+	.ascii	"\036\244\240w\265\342\023\177(\350\225D_\374\342\033\033\241"
+	.ascii	"3\220\327\267\221S\247\227\364\277\334\265\214\"X\203\233X\313"
+	.ascii	"6\017G\201~1\366\252T&\247\345H\211\300'\005\322\325)r@?\"\236"
+	.ascii	"\360@\200\210\357~\236\240\f\365\017\232\334_\033\307ql\364\321"
+	.ascii	"\366*U\254\223\212t\347\361\352\250\326qR\211\332\003\200\321"
+	.ascii	"\250A \005\231c\b\311\214\310\210\2460\205t\220\002\021)+v\021"
+	.ascii	"@\255T\220\315&\231\346MH\021\361\024\260\241\036\357\242?\272"
+	.ascii	"w#\026\376\244Yq\t\315\207\234;\322\366\230\023\204v\027\236"
+	.ascii	"\206?\316e\232\256LAF &\361\301&\274\302\324\267\347[\013\222"
+	.ascii	"\220)\3530\271\031\003\005\353\241\177]\244l$\335\n\277,\314"
+	.ascii	"\377\373\362\367\337M\333\003g\217\350\255g\036\263\nv\315p\253"
+	.ascii	"k\366\312\226=\035|\b\372o\263<\364+\200\037?\234\330\271\t\315"
+	.ascii	"\214L\356\216E\037\023\310\345>\367Y\226\201\n\211\367q\026\261"
+	.ascii	"}\325V\n\264\025D}\330M\nq|\310\326\252X\200\331\2363\331\206"
+	.ascii	"\347=\246\375$\t\013\341\255\321\204\346\212\265\202/\314\341"
+	.ascii	"\311'\n\303%f\007\262\237\003p\234o\374\310\263\024iM\017B\217"
+	.ascii	"\177\206\357\314\0338\306\303\312f1\216\347\0248Y\026h\257\354"
+	.ascii	"\272z\3458\270Z\\\005\316\004\313\002\335\235\301\304]\321\300"
+	.ascii	"\356\n08P&0^\355;}\377W\275j\007\007\210a\332\004\221\376N\237"
+	.ascii	"\315Hy\374\320\345\213\006\004\365\203\235\b\262\242\347\264"
+	.ascii	"\253\307\013\250\255\004\273\231P4\036q\332\217\2777\007\"a\004"
+	.ascii	"65\3246~\304\302\250\203\225\216\330\352\255\024\342\004A\355"
+	.ascii	"\031-\370m\360f\341\261\017\342C\267\336\211\213\306\276\016"
+	.ascii	"`\035\037\345W\341\315\026\002\013\375\214\350\310.\276\307\255"
+	.ascii	"\177B\244\324\005\350\303\366G\323\341\201\205\240\341\315x\345"
+	.ascii	"\312Y\035\360\207\273\031\237\360\270\025&\341\326e\\Ld\370\376"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cliRxBind.282.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\362\001\235\020"
+	.string	"\006\236oI\320TQ:\330\302k9\031`\344\263\217\202\242\2328\3272H\353R\347\354\362J.\\?\352\005f\220\323\231\255Cffz\230YxJa\243o\363p\006\371\324\242\031\272\325\331l\357\245\2514wJ\230WAB\b!{\247\024]"
+	.string	"S"
+	.string	"X"
+	.string	"\270\035M\214\237\335\035\253\211\263\036\202\237W)\313_\240C\322z(\306\016N@A\003\007+c\377<\021\220\022\272P\371\362\034\310z\324\230z(g\250w\027\367L\235\f\233\220\032e\354\3253\341\221\243\t\225.O\301l\004\220\200R\206\322P\302\356\232\302\312\020\267x\333k;\202MQ\002\377^\303\026Af2\236Z\f\335\331g\213V\034\373\336\356\256\353\314~\355\007+5\245\324\007\220r\343g\347F\216\354~\330%\331\334\247CE\310\366\251\375\235\363\260^\343p\002\273\263\0248v\317\0243\020\377\371\274\b\374'\336"
+	.string	"\370\317,\273\310O\332&\b{\202b\332\320\031\037\253\343\005\240?\337\303\"\242\355\276\0163\211\257\007\r\376\331\030N\3640\377f\306r\256\332\262H[\020\273{R\315\232\\\213*y\020\211]O\2558\256\337"
+	.string	"\276\036\260\rq\321 \333\344m\031\304\335\205\340\2778\f\225\237\363\317/0\364\260\177>\f\030\036\255\224V)\022\205zQ\231\254H\n\003J.\246\226\225\023)4idj!\215.&\225\323HJ\251\306\221\310$\252\224\032W$\231\032C\347\336\333:s\005\033\037 \237\230*\023\026\240\266\205\013\365F\307;\226\340D\2009X\020\0201Y\374f\256x\316\217\023\262\357\032@Z\253\312m\220n\264v\320\315"
+	.string	"\272\t# \300\202\021\231\264\003Oc\214\210G#\341H$\304D\255X\324\345\260\036\316\246M\254\213mX\0313\225\2545f \314\226\231\\\334\031R\273Y"
+	.ascii	"\025\252X\362}\266n\225\252\243@+^ay\255m\206)\241K\b\311\025"
+	.ascii	"\006w9rJN\321\005\241"
+	.text
+	.section	.gnu.lto_printMap.283.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\256\005\025%"
+	.string	"jB\314\016FphQ:#|\230iO-\271P\fL\267\003\304\013\244\337\304\345\322\003\206\214\200\037\255\033\226*\352nA\375\335\303\246\244\212\026 j\005\312\374\"\203\34487\201\020\2662\314H\227mlT~K\b!{\357$\003\327"
+	.string	"\313"
+	.string	"\333"
+	.ascii	"4\212\004d`\227*\024,\362[|\347B\343\003r>B\006A\375\331H\365"
+	.ascii	"\266\373W\216\305\367,5z\2263\226\230\256\234\221\020z\201\372"
+	.ascii	"\323\3506\364'>\021\372\263}\335z\212l\344\337\004\246 \341\227"
+	.ascii	"\261\234\363\355&i\365\030\371\236Y\337k+m\246\246\350\211\257"
+	.ascii	"\365\365q\326\2324\303\342\357\265#\254* _1\2029o\246\\\016\021"
+	.ascii	"\bF\002Rd\314\243\020\177X\032Nq\020\257\260\222\330\236\253"
+	.ascii	"/o\251\212Sv\206\244\312\307U\254*\253\247=\216b\007B\332\354"
+	.ascii	"\260\3051\322\\\213B{\002(\006\261Q\316y-\332\260\030\023\371"
+	.ascii	"\340\252s9D+\374\240\216\224\253\265\b\264\367\313\207`3\024"
+	.ascii	"\303\252\362q\233Z\3109\267\035\026\253\336C\357n\260\356\206"
+	.ascii	"\321}^\bR\266\354\202\301\021hy\273f\211n\322\t\334n\035\013"
+	.ascii	"\373\241\355\332~@!\006\342\023\274\277"
+	.string	"n\344\317^c\367\225\304\202M\372\036\351F::\227?\301\275\374E\327z\333\256\365\023=\313O@\265=\364\255wm\245\275\353=Sm\253\250\355T\265\215\252\266\317\3246\236\331\276\252m\233\332\276\202\335\231\2519_\230\203\256\035d\316QF(\177\235^N\276\365s\375d\376\256\343\356?\314\223W~\331\253\204\t\276w\361\214~\310\234\003\315R~\241 \323\303\331j\211Y\350\211\t\365g_\314\307\370\316\325{\016\346[\2011\311\370\344L\004\241\376|\026p\"t\013\206\021\020\231\213iR9ve,gd\322\317\366\320}\265d\354\321\340%T\215U\332\3151\t\t\225\366T\347\261\271\244\013\036\234s\316\263k\354/\377 l\240\350I\217n\343\273^\332\017\003\255]\244\013 KM\232\240\220)[f\325kl\213&}\255r>\370\320\245\352\036\272G\367\272A\323k\304\366\306\221\250\003\275G\360\375\305"
+	.string	"\006\264\202\376!\306 t\316\363\320\365\256\307\246\225\250'w\006\356\240n\206}\360=\337\234\270\271\341\220k\200\357\257\204i\005\262Y\304X\331\302\327X\346E\027mB\351\202\007h\005\365\275\335=\343\312\035"
+	.string	"%9g%\234\034\366Y#B\275\2323G`\022%\320\017K\240?\357\235"
+	.string	"\346\365k\357\205dR\266\254\351hN$P\2223P\251\033\3673Lj\316@\nf.\344\n\334aB\003\375\371\233j5\231\b\301\342\025\315c`\364\204\333\245\274\026\270\336\213\334PS\017\305\315\320\324CA\323\035*\n\204\n\027\272\024\270\334\n\332\207\250\026=\\S.E"
+	.ascii	"\025\272&\027N\030b@\251,x\270\245\247]/\205\332L\021t-\230n"
+	.ascii	".t\270\335\215\t\212w\213`k\247\247\034\324-\312\311\t\352\266"
+	.ascii	"\"\363\327\343\231/\251;\305\325\3039cU\340\303\305\226)\227"
+	.ascii	"\376'\314\314\206\244c\231\332\001{\257'\227\320\035a\312<\035"
+	.ascii	"f\204\221\241\222s\360C\017j\360\251\301O\024D\210\2179j\371"
+	.ascii	"\022\336_\277\316\223;\333\235/\217\337\204)\251\370I0\205\007"
+	.ascii	"s\305\263\365\316.\325\r6"
+	.string	"\001\325\254\355\252\267C\020I\257\232\336\013\257f\027\275\317b\302\021\222}\207\316\271rWS\242\024\3065\346G\312\226=\241]c\247W*\322\375\362\252\030\233\241Pi;n\250a$\303\224r\006)#\"\301\310\214\266\031\003`\002\031\272\252n\021\240\2754uRh3%\236A/:F\372\201\304\177\375\315\376TxC\254\022.H\233\r\227<\025\357bXYg\261\337w)Vd\356o\310(\312`\202\301d.\321\246\313K.\321\246\210\300\262\213\376\007\013\024\030\271\231>\177@~g\320N +\033\021\271\206\252o\030`\377&\bE\346\374\"\\$\312k\302\177\342H\300\304\306\024\347'\200\377\232\216TL\262\320\222\030`\177\342\323\036\177\343yWs\"\037\350\342Y\223\\\272\2355W3 US\341\366\346\201\253 T\033J\206o\351\233\030\211U\227tP\317\2765q\263_\031x?0^\364\317)\211"
+	.ascii	"\354\205\253a\365\001\214\253\205gr\f\224\2039I3\201\327u:\321"
+	.ascii	"=\257\303\3655,S\223\367\250"
+	.text
+	.section	.gnu.lto_cliMap.284.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\252\007\235-"
+	.string	"JP\250\021C`\\N:Yh\003{\024\210n\023\237\213\372\312\036\301S\204\245\367Z\222T\356y\236Z\020Uk\212\002P\030\223\257\"\347\te\036\0200^\037\274f\241*8\304\233 R\375733k\t!\204\310\235d\b\001\362"
+	.ascii	"\007\001p8~\307\356w\374af\301s\357\033\202\243\034\265\036m"
+	.ascii	":o\231\277\345\\\222\357\242\343B\367&\311r\346\336\267\004\374"
+	.ascii	"\264\036\345\267\033\245G\327\023\245G\231\223\314}H^W\313\001"
+	.ascii	"\223\355\013\214\237{\257T/a\346\240!\257?\337\316\347\231<\321"
+	.ascii	"\220P\020\362h,\022\207\302UM\321\263\213l\222/\246u\242\241"
+	.ascii	"\265\0131)b\203\324\216|s<\031x\371\031\362\274\260!g1\360k\316"
+	.ascii	"\2315~K\355E\264\261!'>/L\bQLi\207\247\373\n\310d\363\2076\326"
+	.ascii	"\344\302\001J\306\314\276\236\t\332\332\364\206\306\214\001\362"
+	.ascii	")a@\254z\332\265\275\277\347\205\0059#\244)\373A\024\373\262"
+	.ascii	"\251\025\263\356\017m\314\354\350\251\372\b\253s\024\363:\251"
+	.ascii	"\376\374\314Nw\013&\306e\317\241\024\262\367J\366\242\363\300"
+	.ascii	"\331\035\331\363\302\210\234Fq\220\360\235\356\003\246\2049\261"
+	.ascii	"V\245p\357e\273\024\033;\033\235\371b\314\f\2029\335\022g\243"
+	.ascii	"\335\200_\202\37426\260V'|\035}03\333N\335}%\025.;\310Im{\251"
+	.ascii	"\007\263O[\036jtj\335i\374\017\370\"\346IQ'\301\221>u+\233~q"
+	.ascii	"{]6\220\337O}\300/\301-;\310F\353\324\314*\256\354\227\357\323"
+	.ascii	"}H\216\025@\274\256\326b~\343\262\235\226\207\346H\033w\022\346"
+	.ascii	"\251(\250\303\235\237\336\345wbZR\372\3349I\265\214$\264\f`\265"
+	.ascii	"|t\313FC\313E\251e\242[\036\022Z\026R-#\205\226\217B\313\306"
+	.ascii	"\325rQ\265L\274\345ajY\250Z^\205\226U\241\345t\265\214\252\226"
+	.ascii	"\317[\356\324\262E-\237\301\003@|eo\323\347\336\037\203\201."
+	.ascii	"\036j\007\345p\177\230\177\356\315|\256\361:\316\321l\022\377"
+	.ascii	"\270\313\235\216\211sP\032\254_\016&\37107~\225w\335c^\301so"
+	.ascii	"\330\2029\341\333\275$\037\255u\006\356\001C\\\241\032]\242\267"
+	.ascii	"\273\222R\243|\372\326\242\354\342\b\016\225,s\007\017\366\216"
+	.ascii	"\233\024<\256\326\n@\247fO\330ih\256\324P\215d\273[\243<\343"
+	.ascii	":\273\215f\211>\312\316\254F\335M\342\366\212\332\250\357\306"
+	.ascii	"\bQ\363\345@H\320[\026u\n8ua\0235R\363\005\210\364YS\207\372"
+	.ascii	"hqv\216\254P\277\356w#\326{\225_\362\333\234\031\342\274\223"
+	.ascii	"\243,bD\372\345Q\376\210\224D\t\373\345P7y\265\026#[\250\207"
+	.ascii	"lw~_\202\310\r\307F\032\217\3056\022\273\310\202(l\247\036*\265"
+	.ascii	"\260\227z\334\301\371\0224\260\246\211%\3554\306J\311\\"
+	.string	"\016\353\370\2419\347\312\236-;\210v\032\253m:\252\321e\021\203\361\230'\365\273\304\331\351\262\201gk\222\2519;\3558\322\244\216j$\033\323Oy\26663s\270\034V\221\332\275\227\352\313<j\257m\351\004\331\264\231MT\331/\325nB;m\033,\203@S\f\023.T^\241\300F\226\224\212\030DWOA\343D\277\260j\321V/\256Z\240pQ\245r\225\202\253\026UR/\256L\270\220\252\312\222!\245\300\210a\304\260\312\222\232\001\003F\226\024\361m\213\312)l5\327\251\020Ah\362\375\201\302\023\3025t\343\274\027m\002\0368;\310P\226\351u\317\223\204b\244\227\224\262*7\030H\266%\253\330/\031\201\233\233\247y\221\252\311\307\317\036!\272\0330CN5\237E\246^Z\352?\371\317{\357\rZ\352\251>\262\2751\203\364\341t\263\314\323L\272\255|H\375`\317\356\250\001\3643\334N\022\213"
+	.string	"\265{\273\250\230\223Z\276\227\344\002@\357\336\256\007G\365\216:G\023\020\213]\313\371\370\203\006\251\305X\366\305\354\330il\367\247n>}z\330\013\0175^\306NcK\274\335\261\230{_f\214\267;S\2031\325\2372J\261\311^\314\351\\P\315x\\\351\333r\357\226\234\317\251\300\026.\330\013\351\321\327]\016D"
+	.ascii	"f\f\032\304\270\271\341y\005\200\237\250\201,\244\224D\250DD"
+	.ascii	"F$I\2224\006\200\002\231\251\262n\020P\250\206&\031\306\226`"
+	.ascii	"\372\340E\230\262\224\302\365\343\376\240\240\030s\300\302\253"
+	.ascii	"hC$\226\231"
+	.string	"\300\333\345[\022\203l\203\3517\271\016\232^\016V\233V[!j\212\2653\266\33658\300\353j\346\233\345\315\300Yp\245 \322h\211\331\300\2563@E!8\314\020!1\2316#\2714\355\3721\375m\006\226\375\306\301\030uD\036Q\\{\332V\250-\245\255\250\206\350\260\215\346\302!\020\317\2370C\313\333u\375\201\375\221\030\304W\263\352\227\372\006B\206\242\311{\2127\271\023-\350S'\214S\335\247\026\372tJ\353\205b)\t\266\215\212z\207<\301\345\241\366\370m\227tC\377\210\355\364cLH\004\261\333\177n\203\351iT\266\310\252As\314\324\350\315\333\246\306]\r\032\335\004W\360\242M\340\227t\243W\310$\032Mf1\257\235\251\314B\372\356\316&ca{\333\177\315\2413\025\3433\214\2201\334\032\2268\030\360\222\177\220(\350\333G\017\303>(\341\336\376\026\340V\340\001\321\372\025aE\212\032\255"
+	.ascii	"\251M\262\206\272\236~r\\H\027\251Y\r"
+	.text
+	.section	.gnu.lto_skipSpace.285.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\265\013"
+	.string	"\326\225O@0Q\223\016 \232\302\341\367R\275\340\367\360/\212\036\020\001(\243C\322\253\337\272\253+\332x\347\256\023vkh\027\005\212R\371o\333d)(\004\307\235h\b\211\301\200Z\321\277\246\221\275\267\224)\005<"
+	.string	"?"
+	.string	"="
+	.string	"PC\370\245u\3704-\177\342\340:\021\3669|\323E\"\001"
+	.string	"\273\336\245T\002r\3559\302B\371Lt\\\257\235\001\t\307\211\260\216\347\264`w\235\"\214\303\035o;c\273\200}\004\001\231\351O\t@l\350p.d\227\324\335\330\021\bR\302\266\307\246\330v>\263\036`\327#\213\261\273\0310\201\311\341U|\205\307\226j\270@\037\024\210\330\310\340\242\306\356Fy{%\036N. >\361\372\024-h\\\310\222}\026\026:\223\021\276\025\017\257\023\007\307\215<\200\336\356\356\363\201\247F\235H\270\031\030N\204\262\323\027!\027\246\372ao\237\274\210(\225X=\354\b\237\375\372\354\016UF\243\251\340 \032c\331<\300P\0216\r P\230j\002e\251\230#!SQ\0248\234\212\242l\373\367R!\324\313@\321\215\2004\004\365\303\327~\222\210\006C\243\372\245j\352\310\266\007\274\023\025"
+	.ascii	"\3571\216\020\rN\244\214i\250\r\275\017-D\226\005 !\241\f\300"
+	.ascii	"l\024\210h\271C\261\313\226\275\233\261\347\317\f\205\312\022"
+	.ascii	"\334\322\247j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_checkCommand.286.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\266\001\365\020"
+	.string	"vatG\340\322&\035\"iD\220[\024Q\271\242\337\301\207\324\035Ux\223:\013\021\312R\373\367',\223\t/\352Q\367=\303\351\354\372\344\375x\275 \304\030c\f\347\240\303\"\\\"\337@\350\221pc\203~#\204\354-eJ\001f"
+	.string	"X"
+	.string	"_"
+	.string	"/1c\325N`\321l80\364\335\300\214\346\004=\203/\311.\267\223d\227\353s\3253\031WU\376\352\031HN\254\350s\355\\\306\221\023.X(\":\364\210Q\205e\204!\304e\023\273\243\033\032\234\213\245\0339\235\031\257\020W+\026\340\221\301\304_W\034W\215\252\2662\347\264~.\n\267v\333(\333*\266\202\004\027\021\032a\201\310fW6\270\322\355\261\277a\030\206^\036\227\376\363w\007\177\316j\222\325[\246\326\242:\213j)\325\321\352\215j]\365C\fpH\261\363X\2149uB\037\223H\266\370`{\306\346l+(A\307"
+	.string	"\375\217\352\"s\362\240X1'\210\342"
+	.string	"\333\245m\237D\2735\256,@\300\220\021\263]"
+	.string	"t\003\200\312\265M.\372/\333\223\270r\237\343\346\207\017\213 \263\3159\357\301We\227q\217s\201FC\177\273\335%Q\021\333\321\nQ\243\241\317\nG\321n\217\005\\W\001\220\r\033=r\247_n\273\265O\f\364\237\356IkW&)\267v\312\201\376\373\376\025-0,(T\312\244\271\300\234^ZP&\315\246\224\323\213\311\2039\261\240<S\314\003/\245\304\251\006.1\036\204T*\306\343\300\3718\227\307\252\017\272\211P+>\350\177}D\226\226\2648\266I\353\025\232\255\211s\316\231\215\350\2666\202\004\372\257\244m\267\333*\214\300\277\332\232\344\304\212Z\032\024V\341\305\220\224\311b\036"
+	.ascii	"\3571\376\210\267\244\t\002\007\205h\324\r\034-fP 0\330\255\217"
+	.ascii	"580-\300*\240\332\031\246\b\306xzlq\360l\307\005\3105\225\220"
+	.ascii	"#\"\327\004\016\n\301e`\004\250{\307O>\027\226\273\340SG\031"
+	.ascii	"\reM3"
+	.text
+	.section	.gnu.lto_cliRebootEx.287.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`F\001m\016"
+	.string	"&\232`F\360\262&\035\200\277\017\253\306\373kg\265\356:\207\027b\230\224v\177t\030\214\273\254\377\345\242F\213`7MJ\b\036M\3000\\\242u\035.DZZ8\n3\242\207\230?\242\003\251J[v@\214md\357-S\nL"
+	.string	"I"
+	.string	"L"
+	.string	"S\236\300\365\351\223\375\243\300\207\365\030\364H\001\002'\310\356j\321\305O\2372\352\3117i\371\370@\357\3637\207\240j\355\370@\023\227\331\243\314vZ\2640\020%\023\300\360(!"
+	.string	"L\251\202\036\354\256\365\003I\334\327mG\260\355\300\276*!\227\005\007>m\016\035\364\237\025\254j\302T\364l\226\247Q\306\276\334\335u\214\261o\363\203T}\254\201\214\020'\316\003dW\304\217\317\2063'\006f\373j\177\306kN\267a1\200]\026:8vY&6\020\372,yv=\241\247C\016\343\203\tc\224\261\317r\201\342\325\243\252\301\223R!\036\240\366\005\224\270\312!\321G[4*9\316mx\360_\230\264\351\277O\177\273>\037K:^P\264\350\217E\324V\341nBT\364\f\322\263Nc\205df\327\345\337\206&\2256\t\"\001FL#R\227B\301\304q\030F\335\210E'[\006\221V\332RT4Q\267\242\235d\3464\214:\315\304q\235\206\261\366rc\2141\232\227\260%\242\346\004\224\337\240\001C\224\n\037\315\321\263\263BfjW\260\020=\207fv\304\356\"\210+\235\035"
+	.ascii	"d\n{\027c&^0\205s|\330\210]\266\303\354\301\032o\314Z\300\017"
+	.ascii	"X\006\nj=\270DsE\026V\217IG4\301 \306\021\216\247\032\363\026"
+	.ascii	"\0321RX\017\214\272\204E\254F\217\273\f\263E\232B\337\327\324"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_cliReboot.288.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375 \325\315\005"
+	.string	"2\212'1`e\323\001@5n\030$(\260FV\006!\342\3010k@j\205%CC\253\210\341h\243\330K\033\3020\020`c\230k\264+\244 \0245\271e\n\247\326\205\321yatF.\007dRm2\255\3033\311C\233\224,\323f\025\366\362W\201$\021\303\334)\371\255\020~\313Enw\0058\0223\\\377\260J\376\374K5\177?3J!\317\n\214\335\234\261\240\305\001\200\350\377V\337\376\001\204\246\353\"\340\2641\021t\367d\320n+\267\357\202k\350\274\272\262\320\350\356\313\316\353\354y\023\377\271\t"
+	.ascii	"3\003\226:#\\\270\3175\334-\204\3612\004\270tc\266\266\353\264"
+	.text
+	.section	.gnu.lto_cliBootloader.289.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`M\001%\017"
+	.string	"\026\034hG\360\222(\035 !\312\216\205\334o\277\237\347\201\362\016\305\230\232=\036\227S\313\232h|\317\304\212\242\370\246\254F\216\327\0178\232k\030\240\266\2302&IN\326\245;K0\354\217m(uwo\006\322i?!{\313\224\002T"
+	.string	"M"
+	.string	"Y"
+	.string	"\002\266k^\331@J\\\313bp\343\306eFgw9i\342\253o\332\224\272\362\003\210\254o\003\256\275|\316\221\035\227\034$\242k.p\351\214"
+	.string	"\211-\225\363@\020\233\034\022\261e\212`)\302\307\\?\210-UO\312\356ZC\021\304\355\271\355\025\333*\366a\001\322\326\260A\037^>\346\241\032\231\rNK\262\354\221\245\022\306\376\334\335\265\214\331\237\375S\252U\325\007\320"
+	.string	"\207\217\227\377\330\261\013+Bdq\264\031*@\266\257\366]\374\305\352\263\016\017\355\306b\310\330\035\023\330\300\347\232\307\213\266k\237\007\023(\234\314B\204\364\343iV\b\234 }^\nL\256\331\245N\037\3725\262\033\331\202F\007\215)a|r\225\236\022BH\310\360\030Qyo\373x\030\027>\273\257\207\250\317\013\201\311\265/\203>T\371\032Y\r\234\227\332p\301VHs\330.\345+g\210L\217\226\356x\323\031\356L\037j\004v&\322wR}_\205\221\203\007\021F)od!\345\251@\222\212\245\003\013\030\365\201\263Ky'\023\252\344q\t\305;\225\270\224GBq%\220\205C\021\371\303\320\201\234\352\373@\0164\356e\314)\036d\313V\2426\004\025\351\031\026\"Ph\"\375%lv\032"
+	.ascii	"\357b\310\fMgr\340/\301\315^\240\272\210Z\027\\\311\030AHc\270"
+	.ascii	"\354\316%Z@\030\215`\023(\030\256\225\375 \253\253]\231\301\226"
+	.ascii	"\203Q\227\260\232\325h\340\216\264\264\367\225p\305-T\024"
+	.text
+	.section	.gnu.lto_cliExit.290.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"M\r"
+	.string	"\026Y]F\360\2226\035P\013\241\\{\\4\362|\366\351\204nO$\326w\276\032d\3213\230\032\342h!\247\241&i*E\304)j\203\2216V\307\021\037\340\026>Gp\035\270B`\361\376\242q,-\325\350?\332\215\366N)F"
+	.string	"J"
+	.string	"I"
+	.string	">\213\267(\035\354p"
+	.string	"\273\247\0254vC\0046\320\371tx\021\372\331y"
+	.string	"\372\351\222\255\203\300\207\365\024\340\b\001\202f\265\273\227<\361\322c\311\277\213{\276\030\3571\244\301\356:~1$ny\333\005lS\260\337\0059\366D\233\313p"
+	.string	"T\2212I\3174>\374\013\226\001(v_\376i\350\274\220\214|\332\0338\304\177\2167v\214\300\271\361 =;\364\2424a\037dw\327\362d{$X\003FD\211\257|\354\302\344\374\330\324\264I\361\261\375\350\002\242]\301\244\307\342\334\230~B}\324kN,\240\240\320O\006\252\232\231\024\352\313\370\214\024_\306X\226\321\317\t*\324\312\257\324v\202\307\2501\307\356.\360i\016#\344\313|ZS\211\377>}\025\372\031A\205\232\341\341\022\003^\3518\221\325\325\320\206]\310,Pm\301\272\215\305\"\251 nd=\200\340\300\nmZ\013VE#u\323D\240Q\026\342\254D\023e\327\246a\243+#uW\211\2109\f\225t\255p\034\351\372\204{\220\225'\177@\033)\027i\222`\"A\233\024"
+	.ascii	"\357b\310\304\273\243\321p\021k^\003s$\323 \340\273\031\223\300"
+	.ascii	"6\220\343\243\262\002\311\323\252\206\202\324\202\004\370.\026"
+	.ascii	"4\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_cliGpsPassthrough.291.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\355\007"
+	.string	"\342\217870q\323\001\200\306\rp\251p4\207\370B\204\222\177\310\321 Td\225\243A\343\266\221u\203\252/z\277\260I3\"\"\b\350\024\366\026\330\b\376e\322\372\326\233l\231R\236\220\366q"
+	.string	"e\227\263\216\366\311fHk"
+	.string	"\315\214\023\315\016\307\333\203\207\233\020\333\306M,\334W\033Ac&\230\023)V\370\322G[\024\241\377\\`\021=\373%7\231\360?,1\322\177\227\376\310\272|\fxi\231\341 i\312\016=\215\035\366\253\335]G\320V\365\253\005\024\312\306ibv3R5{\222,!\230\355\253}\221\217t7Q\\`\027LY\331\r\023|\260\271tx\216u\271\371\200u\351\316F\021\\\254\247\340\002\202q\"\263\2733z\274\273v\376I\016\360\225\274\353\305\260\273\326\257\244q\307\3336\260\215`[%\t"
+	.ascii	"\357b\310\304\223\276h\217\013\333`\310%\330f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_parseOutputIndex.292.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\345\002\035\030"
+	.string	"&-\243H\240\232M:\270GCh\314\024\271U\310# \314\323\233\006\265\342q\275\036\203\273I7\371&\254-\305[\367\317\234\214J\341\324\203\245\215S"
+	.string	"\025!u\354\b\035x\350\311\257\023\227;\211p\240\203Z\033\007!\204\020\271S\n\215"
+	.string	"\200"
+	.string	"\222"
+	.ascii	"\265\372\034\030Ay\321\276\322\266o\344GpvV\206\246\245\023\202"
+	.ascii	"\226\032'\240\232Z\253\314\274\316x1<\201\361\342\3628\3567%"
+	.ascii	"9\212\341R\234\237\373\315\201\277\301A\346\005\231\034OR/\277"
+	.ascii	"$u\022\347\204\372\030\316\244\242\276eFTH\241\252\313"
+	.string	"\227\327\271\243\342\350#\250\305;\241\036\206\f\306LA\243#\343\007\357u2\321\ry\212p]\201\235M\241\001\254\246\252\003Oa\234:J\311\n\265VS\336\371t\343\3346\224\355\0306\035\022\224\313$\r\260\366M\211\236\007\333\003?\240\313\312\314\026\323\346l_\216n\317~X\227\312\276\222?\347\277\033v\337\037`\251\313\245&\227z\f\251EJ\035R\352]j\032R_g\347G$\312\216\007\227\324*#\310\246n\211T\200\374\367\3338\037\350\227\377s\326\353S\275\013.Zk\306\324Z\033\\\264\204r\251\035A\002\356JV\024\370\231\255#X\026\234\332Or+\334},\236S+U\023)\001a\254\202[:':~\345\366\276]B\262 !\217\365(%L\224\273\017]Cz\224\3011n\317_1\206\333\342\nL\316\356\206\273b\234\242\036\274\263F\330\356\356\304\bzq\242\242\243\301-r\246\006\027Q"
+	.ascii	"\205\355\261\316\204\266\363\245\326\335yC\345\256G\001Q\021"
+	.ascii	"=\317ob\225f\253is6\026\017\214\215p{\206\225\271\322\302D\271"
+	.ascii	"\374\245{\2476K4h\034j\243\260\321\363\276GrC\267\271\337J\220"
+	.ascii	"*)\273=78lw\027\fs\245\305\024\216\t\361\230\016\314\007\346"
+	.ascii	"\004\037\f@=\036\314\230\007\037\013\033f@&\210Y\007\0203\016"
+	.ascii	"\346\205\037\r=!\200~\0228v\253\325\202\b8&\304c\232DFE\267Y"
+	.ascii	"\216\212!!\243\237$\245\243$%\333\353F\273\371\324j=)l\265Z\020"
+	.ascii	"\200\023\264\2435-VT\243\311\214\212\202P\310hH7YL\307\266\243"
+	.ascii	"!$Y\222\315\206${\371\352\303\272T\206M\235P\310\323\230:\247"
+	.ascii	"\312\330\313\205a\273\\WXZ\335\rYE\304\201\036#\312\035\021\t"
+	.ascii	"3\366q\311\375\223\335\224\270\243\270\005\0021 \200\002\021"
+	.ascii	"\262+\017i\036\032\345\325\347}b\204Q<f\211X\263\3676\266\345"
+	.ascii	"\274\033a#\310\221q\f\035\353\017[\343\356\311[\364\005y\031"
+	.ascii	"\034\247\347\222>96,\fBN\363\234\213^W@`\315\273\265d\265\317"
+	.ascii	"$\027&x\330\333\320\370\b\266\030\023\031\216E\244Y0\327\253"
+	.ascii	"I\272e_\001\313/\327\322\027\372\252\001\340~p\243\377\257\311"
+	.ascii	"j\225\265>("
+	.text
+	.section	.gnu.lto_cliMixer.293.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\006\355&"
+	.string	"\372F\274\017C`\350M\007\027Q\245\002\236]%\320\b\3409\201`\350\241KA\026w\305\205\257S\344\006\233p\017\342\006\3167\235\300\341C3\342p1\"\256\251\031\345\204B\034\022\254N\324\214\232\210\260\355\336[\312$S\n\347"
+	.string	"\331"
+	.string	"\355"
+	.string	"\036\004\217\034W3\347\334\300q;H\035']\267\335\376\345`\253\207\375\360\242\234\273\276\322\344\254|\320\tR\307\255\364\340\3518\365"
+	.string	"\247\343\265\273\217"
+	.string	"\252L\254 \347\244jY(\347,|*\355\375h\023\360\253\364V\357\352?_\217\267S\211R\364\004\342\373vm'\372\317\314C\\\251\231}\305M\321b\342\276,F\274\307\245\005k\313\362\320\244\032\234\335\325"
+	.ascii	"\346\305\212\267a9\271/\306|\343fM\254\352c\016\")\347\215\350"
+	.ascii	"J\016\363\230%\211\247\367\202\241&\232\267a)\271(\325\025\026"
+	.ascii	"/\363\003Z\260\226XT\315J\342\247K1q\240\267aU\331e\031->\223"
+	.ascii	"il_qQ\264\236\370\275\033\330 \271\362eQ]\353\225\347\217\217"
+	.ascii	"\271\265\312\232\262\037\300-\332!\347\334\366\230\245\345]\344"
+	.ascii	"\335>\242\273\231\2721\210pW\270\300\302\244l\235=\002&\316}"
+	.ascii	"d\247\365\234\314\313\f\337\255\017\037\256\257\234\215~\264"
+	.ascii	"\221\032%"
+	.string	",p\334\327\362>\370V\r\334\350\277\n\316k,\317\2245\324\376F\357f\252\350\244l]\023\331\340w?\351\260~\364\3671w\"k\\r\\s\352\211\335\312\242g \2169\373G\266\333\244-R\332\364wu#\035\271\230\267\221\207y\007\235\271\364\006^\333\277k\333\207m\367<\314\235\347L\357\335i[=m\247\3306\372\266\317\3236\306\266/\266\375\327\266}\333n\340G\237\242\235\245\334\326\273)\363U\335\241\314\206\321\222\316t_\272\213\371w\273Y\322\2242g\251~\324\224_\205\234\254\275l\351C\b\230\\\262\231\2632B\352\330\372X\357\272\225>fu\261n\343Y+\007\217Dz\327\232{3\346V6\300\246\357L\277\263n9z\343\222\032QtQ\341[\353\002%\256I\365D\240\036Bg\351#\233\210I\212\364Gk\\\350\316v\037'\260=\352L\337\243\304\3605:\351{\231\337Asj_\320"
+	.ascii	"\b\222R\004E`\235\314\325\3260\301*+Xj\374\260\212Q\262~l/3h"
+	.ascii	"\016\233=z-O\013mr\274\200\337\325\350\003)`\3178\037\322\020"
+	.ascii	"\251\221\303\002\307\"FX?\242\237d|b\033\375\371\352U\232\237"
+	.ascii	"*\272\013p\306&~dw\017\260\370\235\314\335\2348zC\221\032)t\n"
+	.ascii	"\025\326\217=\001\n\325\023y\370\032\026\027\332\3258Z\213\353"
+	.ascii	"\002\306\t\343t\214_h\005\r\202\377\337\037\2604r\025m]\333\377"
+	.ascii	"\367*\272\226\341h\226\322\234\247,\264\233\3613L\355W\034wS"
+	.ascii	"\r\334^\343tl\377\307\f\375\241\204\222\211$\017\"H(\2550!\242"
+	.ascii	"w\033C\223\323\214%\247\341\022\017\245]\357\210\032:\341\216"
+	.ascii	"R\220\204\001\252\251\307\260\204\332>t\034MN\337\204c\350D\343"
+	.ascii	"\006\023\332L\020\206NLB\034\303\245\033B&\250(!\204`?\345h\202"
+	.ascii	"\022\356xz\202\022\356\224R\376]\335A\352\213o~\217\304\343E"
+	.ascii	"\177dh\356N\321\255\214\253\370g[]n|\227W\364\273\267\352\376"
+	.ascii	"}\267\f\377\263\"\023\274\345\234\233\030\356\bH\312\326\265"
+	.ascii	"\373\212<}\377{\337\275\357\t$\325\bU\321\0218\263\025\250\367"
+	.ascii	"\310\336C\251\337{\337C\250\t\233\361\355\354\021#\303\3633\347"
+	.ascii	"\263RIP\305Jj\\\341\365\005\n\322\0210/\273G6\232\346;\372\340"
+	.ascii	"\332\227\"@\257\343Eo\325l\256>\324\013\317\363\246\276\233\371"
+	.ascii	"\2453w'\016\355\346\234\263\312\300v\257\3115\313\220\265.\312"
+	.ascii	"\270f\221(k\250A,\344\2343\206\031\231\221HD\333\244\003p\002"
+	.ascii	"\221\2712\017\021 M\253lS\320\314\001\241\217z\035\305\333\274"
+	.ascii	"e\307y\b\242\353\032\324bA\305\266UR\246\230vr\236\225\346-1"
+	.ascii	"\2760x\321\303\323\216S#?\231s.T}:kzt\007!\367d\327I\237-[FT"
+	.ascii	"\027L\311\313\362\344\362\256l\363\342\337\220[c0\t\2776\342"
+	.ascii	"\225\2605\220\240\347\213\225Ix\324\301\004\357_\\\203\"\350"
+	.ascii	"%w\205\305:\271:\340\276K^ \231D\013\204\2443\311I\346?\320\206"
+	.ascii	"\226\235[_\314=M\t1UnhH~\203\374\346\327'\365MPZ\322\202\211"
+	.ascii	"\342\235\275\371U\240\032+\2247X\236\377uA\3638\\\242\310 \224"
+	.ascii	"\367\310\350J\303\302\374}T\352\275-'\340\246\017\266;\262\\"
+	.ascii	"\213\036\b\306Q\026L\312h\263C\032"
+	.text
+	.section	.gnu.lto_cliMotor.294.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\365\b-6"
+	.string	"j_<\025DPdR\007\017\331\0371\240\217\016Xh\307\034l\336\032\305P\240\334\r\211\003\026<\266b,\017k3+\026\353`\210dp\275\022\207\020\002\200\210:oPt?^\305\332\bo\344edk\226\354\275\367\2262\245B\0010\001C\001\035\310\346,\230\241\302\220\334\321\301Z\305\262\367\231\0042T\303\275\266\277\271\307j\245\356\r\205"
+	.string	"C\177L\374a\216\366[k\377\216;\326:\352\336\333\370\255\037\341o\213\354g\367\367\372\257\370\305P}\320\336O\274\316\366\206:p\005\360\267\016}\242\373-\374B\356\267\261;\037\242\253\215\214`U[\226\231\333{'i.\030\036\372{\275^\257\317B\337y:~b"
+	.string	"!"
+	.string	"ACap\b\370\363\365x\360\353\266\254\316\261\177/\013\371\304"
+	.string	"\321*/\004 \210}\257\200X\371\265\246\024vB\225\272\346\325,\311\303(/\f~U\224\037ZkZ1sf\340\213aK\213\312\377\326\232J\330\342\336\373\2654\223d\037[\364d\t\335\2575\247\260E9\323\345ki\"\311\275\265\346\221\253\314C"
+	.string	"E\313\310\303\357\0257\262\"\377\262\025\276\276H\371\265f\021V\207\215\271\371\350#\320\322\354\312\356\262\227\245t\211S\320\2508\202\255f\021\335BY\355\372li\031y\326\275\2226\365\242\333\322\352z\3156p\316\t\022\314\262b\211u\234\350\371\350g\254\254d\316/\206\275\267gf\226\326\273\200w\177.\356\376\303\375\345\n\356\340J\330F\365\372\262\231\314\361\243\363\201\367F\276\223\t\322z=\212\343\356|\376\235p\224\335\334\320}\364\255P\377\324\300\246tT\253|\247\331\340\302\316\264B\371\323\374\330\211"
+	.ascii	"m\314O\363nP\030\265\355\255|\246\nX\311b\301\267D\332]i)?\323"
+	.ascii	"\200\316Q9\271\251\322(\351\247\212\005fw\026N\371\231\376Q9"
+	.ascii	"\264iR\210G\0352Z?\375\206\373z\205\330\233U\256z/\023iw\250"
+	.ascii	"\250\374\314\327\037\375\357\241\366\325\244\243Zi\244;\024\231"
+	.ascii	"\365\323\375'\370`c\306\365\023w\244\243\361H\301\227\275\027"
+	.ascii	"\017\030 \360f\037\360b\376\211\376\354}\370a\357\302'\363\036"
+	.ascii	"\004>\331\373\317\327{\263\363\334\354p\233\375m\263\273m\366"
+	.ascii	"\366\321\274\263lv\315f\317:\373?\320\201'\311V\306\332\246\363"
+	.ascii	"@7\220k\335\236\266k\256\374\331\177\331\177\330?\231\1773\377"
+	.ascii	"d\377h\376u\227\372\253q\337\031\0177\2730M\237\306\337\314}"
+	.ascii	"\337\226\341(ZAw\226O\372\366\306kn\004\374\355\277\330\227\371"
+	.ascii	"\261?\363Q\367\241q4v\223m\260\306a\331{\007\332=\376\212\301"
+	.ascii	"\3623[\375fO\214V\335\020\320\003\264g\246\237\252|\005\026e"
+	.ascii	"\341\331\333\366i^\217\206\005\033`\245\213\005\034:\300U\331"
+	.ascii	"\274F\270\226?\375l\373\032\256\326Rbi\302\353u\256\310\327p"
+	.ascii	"\263\326\372\t\350\f\"\356mlyW\225\257A-f>|<\241>\240\261\234"
+	.ascii	"\007\324\004x>\315\346w4\367"
+	.string	"\200&\002\343\252\363\207\315\315@\220\257/=\375\364\033vH\226R\370\250\233\254uK)k|\241\306\242\262K\262\224\302H\037D\rL\fk@\007\341\237\n0%k| \334\323?\265\257;\326\370>\215E\345\0065\0031\327&\177\330\330\275\367\346\351\247\177\364[; \313\261\367H\273\013\324\336\002\365Oc9\373\372xnv;\226R\327\250\235m}\272\247\261r8\273\354\240x@\316.\177\017.\222~k\025\314T\251\221~|\241>\352W\352\246\246t&\363\325\037\316\277\216S\367\003\t\017\310 B\344g\036-\231Z\321\371\217V\225L_\375t\2447j\006`[M\376\260\271\r\345\343\007\265;\t\023\371\231F\255\331T\263\246W\032\351/\347\213\300\250sTd\266\373&N\340\312\270\372\231\026\316dT\244 \243\370\364\244$t&\243\"\005&\243\"\3207\220\370\220\241\204\353\305\354\364S3`L\315"
+	.string	"1\354\3204\343I\251\204T\324T\024TOj\nF\023\r%\031o\213%\030\332F\023\323\013\247\266\351\205\323\023\023\324\322\353KHNOKI/\234\224\240\222\226\244d$!\021=\nF\223T\322TT\224T\222\017\272\313\036C\225Nf\207\"\313\210o\034\026\247\222\002tC\204\004\240b\367\336\272@\r\313\327\027\372\240\250U\3104\251\221\016\254\023G\005\300]\334\304\t\254\214\337\354\001D\253vA\372\351\300\252P\201~\247\f\031\177\250\261\206\232\247\263\025\2614X\363\364/\357\034d\367\230+\226\222\237\t\353G\302$\251\221\217"
+	.string	"\314\030\221\341\361\207Z\201.\020\007\347\346M\361U\227\032\321\275\372\325\274\210885%\265*_\365\20154q\302\006\271\250Y\375\322\227\213\253\024\305W`e\2148K\274%G\253}\\\355\3564\036\220K\213\332\366\336\023\374\375\374\237\270\213\177\327\267\036{\211\301\344g\306`\334o\237\351\247\250]-"
+	.ascii	"\310\233\234\222\252\303\246\250\005_\267\251\2132\244\237\\"
+	.ascii	"Y\335.\003y\021{kuQ\347@\312\264\004y@\200\261\250q \244\224"
+	.ascii	"SF\231\031\031\231\t\222D\035P\0021\350\252\352\001\021\260\265"
+	.ascii	"T4\232$\303\030U\020\f\360\3302,\213\001V\374\317PD\201b,3\221"
+	.ascii	"\021ve\224\204\201c\034\223\243\330\013\376\323\346s5\321\205"
+	.ascii	"\223\2071\001\2214/\003-)\261\366\213_\210\027(n\023Kv~h>\032"
+	.ascii	"1Q%\366\377\2260\002&x\256\363\204\346\275\332\362\021\bK\002"
+	.ascii	"*\222^\222#\017=r\031\302\212)\301P\272\237\243r\300\373\326"
+	.ascii	"v\366)1\200E\340\002\221R\333\265g\021\005\237\022'\251\362)"
+	.ascii	"\370\"\2705\231\301\237\340\341\226l\265\225Z\016T\266\017\312"
+	.ascii	"]P0\033\254\230D\246\362\037\314u\211\255\363\225u\227\277\372"
+	.ascii	"\316\267T\024\027\030\004q\274n\334\257\005f/\354\211@]\264\""
+	.ascii	"w+\300\370\0045\271f3\231\261\202\236e\374\350G\001\335D\312"
+	.ascii	"\274\215;\340\370\257mB\263\031y\363\274t\\\201\334\312`\rH+"
+	.ascii	"1\252\215\264\303\020\2760\r\261q?\356\2460\214\330\221z\224"
+	.ascii	"\036\250)7?\037 \203\030\255*\024\326\3520~y\2000\355\216\345"
+	.ascii	"\211\277~\326al\316?\013\274\323\234{&\201\217\007\235\313Y'"
+	.ascii	"4\035@ \365\375AH\360\301dJ\033zxO\022^@\026 \262GT\\\351\353"
+	.ascii	"\332\302\035\030\266BY\352\007\250\2332\001\340\233\022\243\006"
+	.text
+	.section	.gnu.lto_cliMspStats.295.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"]\013"
+	.string	"v\224M?"
+	.string	"S\234\016\214u$\306B\004\005\"\221\251L\333#j\006\2277\274'\005\354.\343\260t\323\300\263\2065\343&\204\342\001/\232\001\200\002"
+	.string	"R\200\252&\274,*EMa\037b\332\2046\3312\245:"
+	.string	"<"
+	.string	";"
+	.string	"\273\231\034\361\351\367YI\375\374\210\b~b\237W\226\bu#\024?\227\025\202\0205>"
+	.string	"\0209\325\304\206\210\034/]9\210\033\325\253\262\273\326P\364p[\267\r\3016\003\373\005\002\352_\017F0@\034\345b\267\303\217\036{\2323D\022\333W\373)\256\342;)\303\003\354\202J2v\307\0056\200}z\374\304\372\304.\300\372\364g\353\030\320Y\260\201\217\030\033Z\360\330\004@\032#)CN\360K\t,pp4\345K?~E\006\333\365<\264\200y\024\034\370\234\322\276\200A\037^\276tI\310\211SG\202\366\b\252\f\231J\230LX\202\354\223\376\251\001\326l\231\315\2636\fg\231p\321.k\024\316\242e\030.\302%\323\274LF\231\270\253\260y\231\246\353\274L2\356+\032\344f\202\250M\201\223\016H\244vT\021\265/\235>\364_\204\2408m\002\024"
+	.string	"\357b\310\f\rFP\026\240\212@\006\263\027t\375\\\0278\215\250XHH\2238\013]f\220\251x\227"
+	.ascii	"\232\325\024\340\216\334l/*\314yZ\005\005"
+	.text
+	.section	.gnu.lto_cliPlaySound.296.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\354\004\315!"
+	.string	"\366\273\331Hp\032R:\217\333\341\r6"
+	.string	"\300\331"
+	.string	"b\321\204\340\352h\335\375v\313p$\254D@h\006Xi^\305oMlm\256\267\024G1\203\354}\253D\215D!\360O\341\013\037u>c\037\024\376m\245\032\215\020B\b\331;\311\302"
+	.string	"\266"
+	.string	"\313"
+	.string	"O\333\250\373\267\373N\3565\374\223\026\007\220\363\326\224\263\234\231\007\272"
+	.string	"\373\264\231\007R\237\262\377Q\237\366\260{M"
+	.ascii	"\253L\\\020\007w\024\223\223s\376\341 \215\336\341wtr-\253[\325"
+	.ascii	"\024\345\301w\330\317]\021\2773\244\263r\301\345\320\006b\216"
+	.ascii	"|Q\201\\\t\362.\245\216\333\256G\027\270\336\316\234\274\375"
+	.ascii	"\300\342qv\207\204\306u_Sju)q\334\025}\340\305d\210\356\352\210"
+	.ascii	"\342/)].\366\241.\345\216\253\332"
+	.string	"x\252\2732Z]\224\245q\036\324\250L\022\035_S\356@\177r\224\225y\2272\353\3425e\016\324\227s\276\330o\362\252x\357z\224s\356\213\274\302z\367\274\373jwOu\243$\002\316\032M\243_\314\303G3j\025Ov*\275\245_\244\251ZK\332o-\352\323\213\247\236ao8\\\334\347\225\220Y\221\301x\331*\324\343\021`i\252.\\\267\267\007w\013Q\334#\217/\366\307Ps\313omU\230\330\315$^\274T\203\225\254\322x\253[\250\027\304\363\331\375\311\337s\346;\327\262\017{\257\352m5\275\235\246\267\321\3646No_\364\366\207\260\263\315\f\0317\316F-\347\031\3179\271\231b\341\302\367\314?\354\270\373\217r\261\326\351\177\035l\370\260\336\362\214\225\377\202L\334\234\266\234s\002\366\251\017\375\217\312d\261\313k\371W\313\270\270\266\234\231E\001\027\004\234\311\300\032+$\351\324\340(\337\332\254"
+	.string	"\274a*\311\341e\373\354|\256\3646t\270G\356\360\331\234PZ\336\375\330\263|0\022\222\263\361H\020\254Q\201\201\020\"\356\221}\331\234I\232U\230(d%\313\r\213\311\262\266\272\350\360V\2638Ect\024\247\370g(n\343\314ijy\3411l_TV\274\354\236\232[ZZ\364\001nch\017\2638Yv\2414\254P\226\232[S\305\313\233s&\246\250\216\305PO\030G3\036\036^q\262\2071~\027\030Z\317\355fr\272GbL\345\243\270\342\036\366\360\034+\232\031\323*\2429\347\214\342e\377\f\326\302\020\341\301[,\324 \034\005\206f\347\362p7\320\304=2\b\3370\001-E\344s\320DT\"\b\244Zz\322"
+	.string	"\324MD\276\025NMA\240/JH\302\327\024L!\224\362\t\221\202Z\002R\207\244\r>\nH\026>@\300\240\301\247\224\244\2444\201\007\274\023\324R\020u\n\002\237\232\240\230\326fB"
+	.ascii	"|b\372\005\201KP?\246(\251\037\002\240\026\236p\212\372M\t\205"
+	.ascii	"Q?\035f\376\221\013\\,\333y\"\217Rp\020\276\221\247\220\243Y"
+	.ascii	"\353\203\257\346)\343h\246\n\341\034Nb\036\013\347\331\343h\326"
+	.ascii	"\356p\243*\213[\234\354&\272\352\222a\023\037\201\333\342\356"
+	.ascii	"\241\327\020\312=R\305EN7\336\315\3416\r\002P\004\326(\002;\323"
+	.ascii	"\232FLl\001\267\233\202\205\"'Z\263\210\211\335b0\034\236\\."
+	.ascii	"\323\314\b\020\235\035\376\330\275\004c\250A4\003\0252\310 B"
+	.ascii	"\"#\001\215\250\230\003\200\002\221\2423\017\020hY\223f\r\306"
+	.ascii	"\033\365\331\213\003\365!%\023%=\231\314\002\301F\252\020a\340"
+	.ascii	"\325\366\002\206\264r\243E,:\245\b]6\250 \220ND[/\030@;;\003"
+	.ascii	"Y\013\b\276\034>\231\266p\231\365\254W\306:\345\212\222|S\227"
+	.ascii	"\253h\277\364\320\314\304p\007\212%.cAa\b\033k,\302v\236P\355"
+	.ascii	"\363Rz\365\001\267o\323Ji\1774o\366Rg^\356\240\320\200\033|\303"
+	.ascii	"\021\"\276\301\270\"\212/ZP\312]\007$\034H9t\301zt\215\b\226"
+	.ascii	"\254\326\221r\342h'2A\322\323\300\207\336\030\300\225\203\013"
+	.ascii	"\371)\026\321\246\236\203\233\032\032\022`\350\352\300+h\214"
+	.ascii	"\370\017"
+	.text
+	.section	.gnu.lto_cliProfile.297.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\r\002\275\022"
+	.string	"\246#}G\260\226Q:\253\212\315@7N\025\232\355\357[\206>\366\321\300_\370\003\257\004\320k\013\3301\3064\237N\356\233\205\322y><\251\fO=q\302\332G\336\017@\373K\2412\357\224\374S\021\234\030D\355\223F6\2212\245h"
+	.string	"_"
+	.string	"k"
+	.string	"9vs\r\214"
+	.string	"|t\356+\337#x\225\357\3212\333\b\201\234\235=\b\207t\220\232\354.K[\370\326\224\035D}\321\323\224\371\267\331\301\323~\216R\315H\361\017\345\246\363]-\243+LJ\302\242\347\347\236'\201H\310\005\312-\307\323\243\032;n\364\334\271\341\244\252<Q/\273\353\264\335z\356\324m\237\260\035\301\316\t\001:\263s\263{\273\273\252A~B\b\342\343\205\025g_w\253b:\365\242\033|\321\037\277\264\027\323\352\245S\323\007@\201\311\222\212?9\262\313\023:-S\324!\343\272\333\317\371;\032?\222]W\342\333\263G\021#TB\262\273\013\036\315"
+	.string	"|l\361\276\262\375\264?t\"\331\213L<e\027W\024_\205>*\244\351H)j\220m\225T}\356K\033\006\020\341"
+	.string	"\326\034\270\003L\336\346\226\034\2359U\3657t\236h\031\032%m\027\210\274-\0034=\205L7,>DB\336\356\007z|Gz\322\253&\034\322d\267v[\b\260\346\242\340\321^F\005u\307&\361]=\350\212\340\244\023\247\022T\033&\"o\273\336\350\253''&\234\216I\320\342\222y}\200\305jV\376\353.\232\227L\314L\013\345\226\313K\246\305\242y\301\314\260Z1\033\226\313\212a5\256\030k\004\f\026c\255r{\305\371\205\24670@\226\264+X0\372\213\001\034@KP\0052\245\366\005\f\337=\245)\\\241\322\224:mJh\031\332"
+	.ascii	"\302\361\3704\310y\233\317\323\230\356\207J=]\3618\001\021\220"
+	.ascii	"AC\336\246\322\357\002* \200\202\031\272\353\237\030B\321r\317"
+	.ascii	"Q\177\255\225j\341\021)\345w<!\255\347x\303\314\004\250\371c"
+	.ascii	"\344\265\363\303\262\326\260\277_\314j<\"\r{\234l\331HMN\366"
+	.ascii	"\3028\003h,\250I\2640L\200\016\347\235\275\261\346D\347+\202"
+	.ascii	"\244\342#k\032=>\375\252\215_\2601>~\256\265\317\t"
+	.text
+	.section	.gnu.lto_cliRateProfile.298.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\021\002\345\022"
+	.string	"\346c~H\260\226Q:5\204\277H\376\031A(\316\277\213\300\323\361\350\233\364\211\r\3451\300\257-R+\214)\271Un\326N\235\022\366\323\223\312\360\324\023'\254}\344\375"
+	.string	"\350O\030.\302J\241\271T\343\001\320\245\366I#\233H\231Ri"
+	.string	"b"
+	.string	"j"
+	.string	"H9\346\31450\002\360\322\271\253|\227\340S\276K\313l#\004t\346\354\301\030d\347\310i\316\031\356\n\337\253\262\203\250Oz\2532\3376;x\332\317Q\252\030'\376\261l;\337\325T\272\306\245$*|~\356y\021\210\204X\260l:\336\032\315\340q\334\225\307\226\243\233rE\275\3149\255\242\315\347N\335v\t\333.\266J\bJ9;\263s\263{s\316\271\033\344+\004\"@Zxo\366u\267J\252S/\272\301\027\375\362S{R\275\236ZW\375"
+	.string	".OI)\376\344\310\234=\243\223\251$u\300\270\356\366s\376N\306\215d\327\215\370\364\2317\361bdB2\347\\pi\006\340%\213\367\225\355\253\375\241\023\311^D\342(s\336\002\373\335W\343\216-\322d\204$7\310v\212\356>\367\244\f\003\2264\2005\007\336"
+	.string	"\243\027\315\242\2633\353\356\376\306\316\023MG\263\324vy\320\213\252bc\304)\341\254\240 \022\362v?\360\343\373\321i\274B\214L\234\346\254]\374"
+	.string	"\326Z\024\\\332S\271\340\362\330\"\276/\007\035S\2166qJ\301\265a \364\342\367\270\257\306\241\216I\300\342\222yu\200\305j\\701"
+	.string	"\376\353.\232\227L\314L\013\345V\313K\246\025\322\274`f\302V\314&lQ1\254\306\025\013o`\260X\270\312\315\357\315/\264\305q\001\256\250=\201\002\356/\006p"
+	.ascii	"-A\025\320\324\332\025,|w\224\246\321\207jSk\025\225\320t\254"
+	.ascii	"\001t\353\361m\220\345m>oc:!\252\365v\325\3634D\300\005\fzQ\025"
+	.ascii	"* \200\202\031\272\353\237\030B\321r\317Q\177\255\225j\341\021"
+	.ascii	")\345w<!\255\347x\303\314\004\250\371c\344\265\363\303\262\326"
+	.ascii	"\260\277_\314j<\"\r{\234l\331HMN\366\3028\003h,\250I\2640L\200"
+	.ascii	"\016\347\235\275\261\346D\347+\202\244\342#k\032=>\375\252\215"
+	.ascii	"_\2601>~\256\265\317\t"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.299.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"\026UM?0O\224\016\003\024\2543\007\025\001\270j\215g\335\324(|(\240\244\220}\2413\035\\\262\265}\202\035\247\257\323\030\353\243\341\266^\003ir\325\031\344\216\261\023\254\335T<\335\364\267do)S\n;"
+	.string	";"
+	.string	"8"
+	.string	"\005N\273]\276\020\016\005\214\335\265\224\343\332#\324\324|"
+	.string	"\335\366H9\334p\205\006P\036b\004\350L\260\322\342\203{\352y\241+eF0\273\353\324\3504\334\325m;\260\315\300~%/v3|!\373\021Y\210\260\375\211mM\373$^B\273g\001\016X\023\b\f\013$\217\225S\252Gx\002\325\2433m\005\027\355\035#\353n\007\025+v\275\004F y\264f\273\b\276Bur3H\371\035\344\303\227\002\352F\236<v\204*\312\371Qu}\352\007\270O\206\t\017S\202\330\336\226\272a\037\256\242\354L\303{\277\276\343\177\344'8Bp\370\027\022B\231\007 \217h#\251\300\331|\032p:W\004,\203\260\271@\002\254\261\\\035\215\365\2712\036K\223\205,\013\305\030\210\223Y\0230,\263&\336\036C\322\322\243\253T\213(\3445\374\3241'\335\002\023"
+	.string	"\357b\310\fMg\004\303"
+	.ascii	"\026\016\n\305\312\020\331\2331`^<\252c\334\022.\214\271\232"
+	.ascii	"\325\2460\304\224\032=\356rK{M\t7\245P{"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.300.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"m\013"
+	.string	"FUN@ m\225\016\027\005\200 \001\201MP\250\373\031\374\200\216UbX1e\241\210\360\301h\200\366m[\303\2461\375\251\300\342\260\2301\020\020k\202\300\313D\003\270\3444Q\253\253\200\211\375do)S\n;"
+	.string	":"
+	.string	";"
+	.string	"\353\261\0270\017c\325\201bw3\335x\367\b5;\337\3023=V\016-\\\341\200\026F\n"
+	.string	"^\nZL\200\254\356zJ\360P\231\221\314\356:Y^\205\033\273m\005\266\021\330'\020\273\024^*\026$\222\320`\373\023\333\232\366;\334C\367/\002\244l*\303\004\214\344\321\362\n\366\b\037"
+	.string	"{t\246}"
+	.string	"\323\235\243d\335\305P\302c\3673\340\002\222Gw\366\t\r\n\325\271Zq\312\327C2^#\240j\244\352c9\250\266\034_\302\256w\035n\270\350\330"
+	.string	"\361\221\312\020\3733\245j\330\207\253-;\323\360\337\257\347\370\037\021\020\"\343\303\305Y\"\002\016D\232\005\241\017\211#\201\240q@\t4O\247\301\3061\320F\032\216\342\315\245\343\331d\240\216\346\223m8Qv\251x\013i\\6\3326.\233|\373\314IQ\217\306RMz\220g\371\256gTj\362\003\023"
+	.string	"\357b\310\fMg\004\303"
+	.ascii	"\026\016\n\305\314\020\331\2331`^D\252#\270\205]\030\2035\253"
+	.ascii	"Ma\210)5\032\270#-\3555%\334\224B\355\001"
+	.text
+	.section	.gnu.lto_cliPrintCommandBatchWarning.301.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"-\f"
+	.string	"6VVD"
+	.string	"S\234\016\370Wm\325\366(\2642T8fS\364V\035\260\275\362\032\205\230\250\027!HY\206!\030\"G\001\006s\324\314\276\357'\227&\301\0206\202\005\260\207t\253Gf\203\255\213\302B\3730ld\357\235R@"
+	.string	">"
+	.string	"F"
+	.string	"\366\217\271+\213\"\023UB\324"
+	.string	"\262\273\333d\361\357t\312\317\377\311E@quZ\342\223\036\320\201\003F"
+	.string	"\221E\021\234P\241\362\223K\021\342\210\224\026\007\273k\t\212$n\354\266=\266;\373"
+	.string	"\002\343J\316\025\366\351\356\256\247\313\276\311O3\002);PJ\036\362\330\0351D\310\2760\033.0\266/\355\313\370\214\357&\252\013\330u\371X\331\0355Np9\346\361\231\354\330\345\003\262c\376\002\034P(o\303\214{\272\323\025\266^\274@\314\021\232I:\013\204\255\024R\314\021\336\230Vet2(I\211A\243\007K\006q&?\036\245\203\201\026\273$\007S\027\222\005\n\216\331\036>\310\203\306\302\226\211\027k\256\354\366\200>\024@\237\021(\304\321*\027\212P!h\244\372\251P9\255\212\036T\t\0234\215\326\251#N\035\325\216V\271J\322D\\\210\343j\203\013'\323\311+\245,\3566&\f\335v2\2252l\235\267a\333d\214\322`\301\333\002\020"
+	.ascii	"\357b\310\304\203\240\320\004\034\353\342eG\265\f\036\001-%\354"
+	.ascii	"\036\033,\004\230r\t\266YM\031wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_resetCommandBatch.302.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"\375\006"
+	.string	"\022\314.4@O\324\001x\211.\375:pE\3414z\b\320\214\331\203*y\326\330\024%@`3\224f\217|)\270\320\032\033\206\321E\215\243\205\305\265\331\021O\322\366N)\256\322DU:Q\225&L\006\b\264^\nT\022pe\035\\t\241\252.\032\205\373\t\002\214\023\030\026\f7\035|\220\2070\024|\242\346\030\344{\374\003\3631\334\220\311w\177\374\f\372c}b\246\242#\303\311\215\035nrZ\330wv\202\266s\021\r\224\225\361;D\312n\304\246eO\236\222\f\333\217\254\331*sI\226\002\362L\036F4\273K\347\305\265K\315?\307\003:o\273\274\020\354\256e\347I\334\363\003\2667\002\r"
+	.ascii	"3\001\2178\003\344\335\003c\240\211\2410AR\244\270&\366\205\220"
+	.ascii	"_\206\b\227n\314\326v\235\026"
+	.text
+	.section	.gnu.lto_cliBatch.303.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\241\001\345\017"
+	.string	"&\035iF"
+	.string	"\221(\0358\254\340\026\236IVy\215(uU\210\356H\"\232x#\177q{/\\\271\310\024\344\341\356\255\325\217\330aD\234\375\007ocK\020\256\375\277k\241\364\377\206\230#\273\322\301"
+	.string	"\315\371\200\b\331\233\354\235RP"
+	.string	"R"
+	.string	"X"
+	.ascii	"\342A\352\251v\001\365\324&\373\306\\\230E\251aL\206\226\034"
+	.ascii	"\273\273M\0217=\253\024\233\322\344g\035\0170<=\323N^\263\016"
+	.ascii	"\030\236\234z8\266\t1\250\344\004\020\2560\316\356^\305\245\206"
+	.ascii	"0%e\326\331]K0\354pk\267\375\331f`\177F\007I\332\nA\310i\235"
+	.ascii	"6\205\n\362\340\347_^()52\253y\262\305\224\234.\373s\034\307"
+	.ascii	"\321\263e\177\345\257SZJ\351o\316\342U\003\307\213\365\r2v9\214"
+	.ascii	";\226\006\215Qbc\373\322\276\312S\230\276b\341\037\273-\025\230"
+	.ascii	"]1\201\rh\247\016v\367\221\007\375\227\027\210\255\221Q\315\023"
+	.ascii	"\235.\227\277\200p\201\345r\342\203\312\314_\252.\002\244Lhr"
+	.ascii	"\314\354\356b/U9=\026\033~\313[\224|\022\006\221P\237\244\236"
+	.ascii	"\312\231\2050\241A\301B\311\361s\272|\340\237#,1*\251\303\036"
+	.ascii	"\222~T/~\305\004mw\025\366|>\217\373H\234\b\335\307\215p<\"."
+	.ascii	"\024\032- \340\317\343>R\375\210@%\236P\227\271\023\001\225t"
+	.ascii	"\233\b\304\205\266\316#m\" \036I\370x\3337\032y\333FD\035\373"
+	.ascii	"li/\023)52\250\231\302\262\001\262\201\003y\320\330<\311\372"
+	.ascii	"!/\036\306\203\002#8m\245 \3444' \260\202!\261\365obL\221\035"
+	.ascii	"#\370\235}-&\2524\205B\342\344 \273\232\355\204]1\"\254\233\262"
+	.ascii	"\326d\355\016\320\214\032\311\272</,%F8\270\360H\250#4\234\300"
+	.ascii	"\302F\223\205\362\0013\204f\236B\\\302\001\237\003>\277\313r"
+	.ascii	"\243\353\252t[\273\364"
+	.text
+	.section	.gnu.lto_prepareSave.304.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\250\001\315\016"
+	.string	"\206Y^E"
+	.string	"\257(\035\260G\271nVP\375^\255M\251\"\377 \373\013\356\273\212\022\177pf\326\006\312o\343\200P\212S\325\037\355\300\024\322m\306\211\334\341\377\377\377\035\375\265\250\250\272}\300\337\375\341(z\322\b\331R\246\024L"
+	.string	"E"
+	.string	"M"
+	.string	"\327\370J\367\244\352\034\201\f-\340;\267a\001Sr\273p-v\334\234\220\301\361M\210 \224\207\323\347\223\2201v\254j,\200Xhp\361\030\026U*\307\207\022\007\354\356[O\225\317\224\331\001\331]\347\351k\2715n[e\273\200\375Y'\031\332\257R*\313\276\206a\030Z]l\2475\247\243\323\232\376\306G\300(\275\260\001\017\206\273\2500gg\032\212\017\266M\354\217?\f\230\330\323\245Ya\330R\025RH\314\330}u\372r\357\036\256\263iQ\323sn@\222?9\300\312\206\0253\223\226\276\262zQ\241\251\206\300`\017T?@\023 `pndQY\256\247\036\020\001!U"
+	.ascii	"\207_\355m\327\020X\013\224\304\261/\363\020\236\337\301\021"
+	.ascii	"J\362\247k~\311v\355\372\326c\fX\"g%\003\006\016y\210DB\235H"
+	.ascii	"$\324-\020!\030\351B$\222\316\003\344\021\203\004\244\316\301"
+	.ascii	"hD\352>\257}\\u1\200X\3125#\343\336\372Q\261\024\314\214L\357"
+	.ascii	"\272\246*\26655\310\211\232\342\356\256GY\234\202\030\235\030"
+	.ascii	"\033\211\252\024jR\320l\\:+ \300\202!1\253\003\0132\264\226\024"
+	.ascii	"\336\027\211\321\340\305#\273\f\261\034\202)\005|2\243\tOX\001"
+	.ascii	"\3550\213\013k\320\207\271\262\232\350\306\312on\364\241\027"
+	.ascii	"\353\212\355\2208\202)$A\\\343\021 \316q\3277~d\271P{\225h\276"
+	.ascii	"\204S\f\217\312\006\216\207\n\252a\020}\273D\031"
+	.text
+	.section	.gnu.lto_tryPrepareSave.305.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"U\n"
+	.string	"\206RF? \345*\035\340\034\013\t1\bf\f+\250|l\351`B+\332\004\b\030\270\007\303v\213u\366\262n\203d\252\262\2253\361\214\205$"
+	.string	"$\200\r\030o\034i,p|\2362\266\250\221-wJ\0012"
+	.string	"8"
+	.string	"3"
+	.string	"(\266Z\313nA\016\236\356\004\375\0011<\355t|)\303\312\006\363\210*Jpc\315\234\374\324\020SsrD\265V\317\226\310qs\267\355`\033d\277 \346\246\337Q\360P\031Gf.\226\255\225u\243"
+	.string	"\201J\343`B>\3766\312'\355\371\b\322\372\252a\200\217\b\2146\202\316\371\3239\347\205\006\224A\204U(`\343Za\005\233\242\247\357\272\366b\362\261+\363\301\r\267\t\257\226\222\223\032\325\274\231N\273\302b\276\305\355\311\033\304\310\220\224\003"
+	.string	"\2446\264\313p\256\314>\255\033\263?>\3377\362\274\323\307\261\027\"Ax\235\004\351!\242\363L_\027:pibd\352(J%S\347)\3537\346\223\177\306\314E\223\3422\177p\343\375\316\305\260=\327\242\213\022"
+	.string	"\3571\276\b\215\t3\b\254l\301"
+	.ascii	"\364\235j\215\256\034'N\024\327\304\207\ti~Ya,l\024\251\241\202"
+	.ascii	"\217;\327T\32340\005\005"
+	.text
+	.section	.gnu.lto_cliSave.306.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"\245\t"
+	.string	"&\022C;0\345(\035"
+	.string	"\027\205\370\240\022\260R\tfA\243y3\215\210\366\312\223\244\325\214n\f\273\352\2179`\226u\265O\307\302\034\f\f8\r\025\220m[\321\017\367\\\006!\204\354-S\n0"
+	.string	"3"
+	.string	"0"
+	.string	"\236l\035\374\224\n\372\177= \024M\237\035\307\345D\220\251\314\b\210\250\311Q\205\204\177]3\304\223*\267\260\273\326P\324\270\265\333f\260\235`;&\253\n"
+	.string	"`c\332\212\310\306\366\325>\311K\300\273,>\260\273\032\201\355\216\n>\350\256y<g\273\326\235`\273f\320\206\221\013[\217m\343\005\003\205fw\003,\333\025\333\245\303\211\013Jg\326\324\236\240\320\207\227\006\251\026K\354$M\366hR\311\262?ww-W\366]\377T\365\271\202\024\031\223\216\177\264l\036\321\007\364\020\3728\177\235\017\350\363D\237\206\220\367\221J^\207\343\021\204\207\344I\214F$o3\356\347\312U\252U\023\273\220\247\331\251\035Q\322\207\226\007\231\311`R\006\016"
+	.string	"\357b\310\304\303\277\320\266\216\225\3022\240\332\254\352S[X\204"
+	.ascii	"\325\305\256f5z\334\345\230M\322\300\324\036"
+	.text
+	.section	.gnu.lto_cliDefaults.307.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`'\002\205\024"
+	.string	"f\346\214J\300\324QcTJr\032\311\245\t\255\217\330r\360\016T#6@\200\270_k\377\335-s\270P\006\377d\212\205\243\n\345\343k\216\314<\306I;[\355v\007\022\001!\225\223\346d\215HE`h\n\254\263\324\302n{o)S\nu"
+	.string	"o"
+	.string	"}"
+	.string	"&\367\006\3350\336\233\"\360\312\371\322\351O\314\227\347\005\230/\315\263\207\330k\274,\314\241Q\220\351\352\336\013\263.\316{\313,I[y>"
+	.ascii	"\264\367\326\tt3\350B\201\2654[\b\263|TN(\320I\362\205\025\374"
+	.ascii	"Q\202\356\220\013~W+\\\350\257Z\322\200U\324\221\022\324G\236"
+	.ascii	"\370\020\t\257\364\312\203\376jm\275\334{]\205\350\317}\336\366"
+	.ascii	"\b\3335vu\020u\307\317\247\310zg\336v V\355T,\233\325\264v\216"
+	.ascii	"\210z\341\355\225~J\361H\257\254vl\317N{\325\n\331'\357\275\327"
+	.ascii	"6\310~\322o>\275\255\255\256\265\372\257\0045R$\243\342\220\206"
+	.ascii	"\245J\257OV\222{,s\310x\372\333\277\222]V\300\200\367tG^\024"
+	.ascii	"\267Gd\245h\310\210tuo\332\362\322\007\316W\373H\267\301{\022"
+	.ascii	"\211\007U>\212LU\235x\337\370\250\235\017\3031\230\322\2071_"
+	.ascii	"\272\246x\236\214\214\350\324,\017\250\266L\005\240\243\317\366"
+	.ascii	"\214\362t!\345E\206\0238\243aC\331Ct\342h\217\232\200\350(M\352"
+	.ascii	"\227\356\304!%\210\354\004\276\260\274\264g\264z\241\337$\325"
+	.ascii	"#Eb\246\031)b\220V\310-\257\266\004Q\310\253\232\257\231_z\321"
+	.ascii	"\303y/\360B\234\023\330\200\345\345\rD\275\260\332\002=C*\216"
+	.ascii	"\300\316\351nrd54\032\225\233N\305\306V\323\351h9\032\016\305"
+	.ascii	"121\01332*\021b\024\036`\210\211\005\360\315\326\312\331\324"
+	.ascii	"jl7\b\264\020\262\234\213f\253\335\320\340\314Z\236\271\324n"
+	.ascii	"f0[M\206\003\233\341r0\227\023\337>\320p0\335\355\206\203\271"
+	.ascii	"\322\373\027\035\353k\021\250\266\204\t\326\366\376\037\240\211"
+	.ascii	"\240i\205\214R\034\342\bB\331\023\377*\016\217\202P\365\337\231"
+	.ascii	"\326\362\330\266\326\366\230\002& \200\002\222\301\272\001\006"
+	.ascii	"\305\370\b,\204\306#\220\n\340D 7\355\275\321\245\342%\214\322"
+	.ascii	">\342\"3\266\266\273D\262o\026I\210\2071VOE\373NE\215\rPn\343"
+	.ascii	"4\330x\263\237Y[\273\3604[\334\236\335\3552l.\257Z\021\tI\277"
+	.ascii	"\357zd\311\356\3555[\200Q"
+	.text
+	.section	.gnu.lto_cliPrintVarDefault.308.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\313\002\245\026"
+	.string	"\026k\230G\260\332*\035\2706^\307\261F\f\244j\2479\205\310LR\332\220\354\310\255H\025\304\214\333\257\273;\003\266\267I3\220\032Q\274\005\367{\214G\316Cly_\343\250\r3%y?3T\005\265X\215%\215\354-\245L\001\202"
+	.string	"y"
+	.string	"\210"
+	.ascii	"\365V"
+	.string	"TS;\220\206v\301Z\313\236\245\347\031\227\377\335-\217\334\243\031\233S\253Q\227*\265\226>O0.}\271:\342\322q\005\210KO\376d\006\320jM\034RR\303\211\260\326\272\352\037K.\235\315\344w{k\262\341bKu\354\234<A+hN8\332\324\3011\304\206\203\233qO\003_\200F\266\311\362\r\034m\036\330\321C\312\366\226m\340d\314\245\n\265\326\263\r\227c/\356\177\022\3779\374\275\023&R\214B\226~g\210K\267W\227\373\005\211xG4x\370\2271n\037\377\316Zk}\033\375\353\333\247\266\334\243\366h\027g\344\237D\376\215\211o\032\371\243\310/\215|\261\304\247\"\177N~S>O\376\3568\330\twH\220\206\226t\230\262\342\030\262\251I\364\n\221\365\355\226\3772\3716\371\351\017 \220\353\2131k\256\306\3120(\262+wB\237q\351n\357\247\377\245\f\016{\205\203\251w\276\330"
+	.string	"\223\344\\\202\224\3511c\210\251\226\220\003\376 \300b\217\335\301\003\257-\325\252Z\307N\273\324c\317_M'\373\260TJ\275N\200\320\236-\366\326t2\036\276\233\366\374\201\330)!\242\220\020!\232\311\001\213R\214\323\377\210\022\274\266n(\267!\303\244Y\307\030\347\345\266\245/CDu\203\334/\215O\314\214\327<"
+	.ascii	"s\377-\027\257\r\325\252Y\307\276\315\335gj\2649\212}\0024\326"
+	.ascii	":\213\360E\nWMp\301^,\030*\324\213\027\214u\302\205\301\305\213"
+	.ascii	"\005k\341\002\200\202\005\273`/\026\f\372\326\017\320\253\265"
+	.ascii	"Z\001\304R\261j\t\271X\375\350<\210\205Kh\365\"(Hhu*\353\316"
+	.ascii	"\332F\275\315\271\021\341\221D\243eT\001\377\244\021\362\210"
+	.ascii	"\t5\2450(\353\330\021p\317\236\310%$\357\246O\275cj:\231\226"
+	.ascii	"\233^,9\240\020\"\236\212M\375\315ba\026\310\375\204D\273Zkk"
+	.ascii	"\2730\326(,X\372g\320\300k;\205\"Z\307\376o\b. p\002\021\251"
+	.ascii	"\263\007/\344xeX\260g\276m\235\217V\177\331\337\356\330\261\024"
+	.ascii	"/B\237\001\354\232\217|\366\232 I\347\320\267L\332\226\215\314"
+	.ascii	"e\001\272e\205\0179%\341h\276\206?u\3017D\362\362\b\030\240\332"
+	.ascii	"\240!\316o\214\361u\271\356E\nW\361\024\240\016\n\270t\023\305"
+	.ascii	"\357\274\r\217\371<\331\r\231Z\236\2712\266\234D\310d\027=\n"
+	.text
+	.section	.gnu.lto_cliGet.309.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`<\007\225,"
+	.string	"\232Nt\021F`\034R:\253\351\036\223\212\024\345\370\201\275\317\307/\206]\216\346+U?\374\201\324\363\365\237\372\032\253\366\377q\276f\245\0315\t\346\225\021\364i\305b\357a\271Nb\270\\\355\376^\0264`o\355\377F\b\331;\311\002\001\362"
+	.string	"\f\001\255\345\306\315\311\256,`\t]\236\221\346\374\264\300{\036K\373,\275\006`\330\225\003$\241K4\322\234\363\321\327F\342}%R\177\273?v+\355\311p<@\316_T\300\344\374t\320E\274\257\375|\020\373\225w \366k\267\335o8\203\311[\354\262L\225\231\\\3169\t\033\351\337m\357\023\004\376|=\336\216]U|\333\276\3319\210\245m9*\205\367\341zPm \r\023\367\266+.5\310\252\311\361fG\340\274\332\272@uGe\325\344mWAT\nsR\265\247\375\"\225\304\373+\202\005\344>\004^XZ\357\261\314\244\030\357=\240\314\034p^X\314\357\262|\312*6(\311\232\222{]11\373\343\253\232`\312\234\030\037\245Q5"
+	.ascii	"\245J\362SR]U\005bvi\363\266+-\025\251\215\023\255\237\262x\361"
+	.ascii	"\323\356\203.\343\300ya\001\371\335a\3109\367=*\261\336?\357"
+	.ascii	"\376Ow\243\350f\271\004\355t2K\t\216\344\\\244 \346cD\250_\362"
+	.ascii	"\265I\224`K\260_W\374\264\257ZYla\\V\310\206w\212\267\214\241"
+	.ascii	"\302\302&\\\214\r\270\375\263\024*\356\217\375\263\373\240g\302"
+	.ascii	"\362HU\265\0258\r\306*\013\214/$\301\256D/\356{\371\027\246\376"
+	.ascii	"\222nz\272?>\261_\361\332\261\316\361\305\257\252\033\336i\003"
+	.ascii	"o7\224\213\373\3431\216\266\351\211\346\221\022\261\260\373I"
+	.ascii	"\274\270\331}\nG\346\334\032\177u/0\272\226\367\320\311~\241"
+	.ascii	"\3656\320\321\336A\340\257w\333\307\273\335[o\363\236\345\275"
+	.ascii	"\373mvw{eo\253\353m\314\336\276\353\355\037EH{\216I\201.\315"
+	.ascii	"`7\317l5\335\223\243\253\032\330\321\376,\277\226\343\356w\247"
+	.ascii	"\365\017\255\206\232\317\362\020\013I\214\214\314\230\034\206"
+	.ascii	"o\371Y\367\257m\034\332'\202\274\363\263\321\375\373z_v\263\376"
+	.ascii	"u\007i\277[I\247\0239o\f\302K\367\326\313\3236\213\2068}\300"
+	.ascii	"](\351\344\301{p\337\345qms\350\210\021\236Q\tI\253\204.Z\304"
+	.ascii	"\302\376\333\201`sQ\341\245k7$j\315\035n\326\351\333\001\300"
+	.string	"\324\021\226\273\350\364\245\375\306\343]\210\375: \033\227ta\237\323I(\231\234\205\347\272\307\314\340+\220Z\245\253x\353\272\300\205X\036\006\302}\253\262\210w\312\344n-\230\0248K?e\310897\177s\003\373\020\221uS\200`qF\367\350C\270\273u\322B\301StW\374._\323N!\360&g\343\217m\025\236Q\203Qk\245\275\"\224\004\263\023\245\302B\26630H\202\261E\211X\370\242\2218c+n\366\321\201xD\026[\22525}\266\033A?\252Y:\220f\b\377K\214\214\316\361\307%\333\023\007G\305\315\306\301\262x\252\314\255x\347z\350\n\341\025ww\360p\177dq\205.\252Vz\231\017\n\336\344\\\234\320\035\335a)C\b\"\016J 2\234\b\241\024\3547\321\005\"\031\tX\250\277`\242\201e8\301`\212\212\222\332\340\364\324\242i\006S\324\317\023\f\250\027NQM\273nz"
+	.ascii	"\365\242)\t\006\024STR\323\224\214\244\007A-\025\343i*i\206\224"
+	.ascii	"\324T\322\3579<\376J:\341\242CL\364)"
+	.string	"\272\207^\035-r\007\317\370\301\252\275r\231Ig\032\001hscA\365\007\304;\214\334a\bYl\242\224\301\271\305\033W\254I\256\311\265gb\373^.\321\247,\271&\345\316\360N[\245\n\263\007%\235a\242R nv\320\214o\001\366\001]\306\251\372r\033\331\252\357\207o\366W}\271G\007v\007\261\017o\350a_\277\356\323\226\207\372%\335\372h\227\355\222\375\332\303\030\211\247L\326\360N\257f\334\004\212\256\341\341\245g\204[\305@\374\303\310\356\277\006\033\304\0130~\"F\306v\227>\244\003\261\021\276T\214\213\033#\027\361N\231\255\020\347\023\tw\253\025\022\200\213\250A(\347\020BL\241\021\021\021\n\223$\035p\002\221\251\253z\021\200AD6\233B\2411\257<\376\362\315bF\226\323\321\364\330\005\300\322\357\251gF\317\224l\013\2674\235QL\3056\205\231}\216D\377\206\377\372\332@\222\352g\304"
+	.string	"\246f+\022\363\243F\374\320 \020\026L\336\370\313L\264\337\230\321\006\220\024\022\315(o\310\366\226\250h\273 \334E\361\306i\344\036\035\032\003\021\217:Np\304\177\272\312X\272\363\302f\nc\013\210\302\365o\3328\004\326*\232\206R\260\337\214\331\t\205~@kZ/\346\226\\\272\254P\221\360\234\035\320t\210tsj\021H\370\3740\322)\314\360\005+\016\004\240w\026\234q\375\255/\013h\247\357\342\311\367\002\331\t\236\322\237\276\375\033\210w\034\323\0331\253\002Z5l\300\276\356\227\027I\033\320.D\320#\221\016QM\034a\037 b\016\235\342K\\g\034\335\363Y\276\206\263\345\307%.,\303O\022 \244\201ay\372\233s\306F\235\2642\220K!/\037\003\304"
+	.ascii	"\206\r\306\203\322\343Z\335\204\001\376\257\016S\001"
+	.text
+	.section	.gnu.lto_getWordLength.310.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\033\001]\r"
+	.string	"\306XZD\020\257&\035cU\230>nd\253#\002t\356\311\r\007\317."
+	.string	"B\347\366{\333?\037\2251x\213\330\270i\264N$\366\016\315vC|\355"
+	.string	""
+	.string	""
+	.string	"\300\021\326\265P\226p\005\tB\340\347\214F\310\336[\312\224\002F"
+	.string	"E"
+	.string	"F"
+	.string	",\361\002\b\024\0235\273]\246\032\374R;|\232\232\277\201{q9m&\207\3572\245p\020\260\231\236\007\213&\346\252'j+\345\343T\256W\035\233\341V2\247M\345y!\330]\347i\243p\307\333\026\261m\300\276(\335\017\337K\253\246\363\335}"
+	.string	"\003X\244FX\370*\305nJ\013\306\252\2001\035l\217\354"
+	.string	"v7\303\221i?\304E\214\336Rr\316\356\312\013\314n\307a\002\330\241\273k\304C\354\031\361\260\300\201\2215]\230\f\001/\241>Em\234$\246\336\005\211\026\023\222e\277D\004\022L{I<L\035\341V2(\f\244\267\273\373\254=#>\335\250\004n\365\342\304C)[\352r\302\264\251\246\354\316$=XX4\326\025{\3434\366\226\377z\f>\nBD\037\361\343\021\001I\020\"\372\300\334\351\3604\350d\037\317\002\007Y'\364 \353\3200h\004$\224A"
+	.string	"\201B\231\273\375{O\217\351\006IKV\305\364(1H\331\362\245W\325\223\017\245lAM\371\252sjVT@\241\033u\032"
+	.ascii	"\3561,V8814\323 \321\206\330\212\367\017%@\334\035\353V\220\020"
+	.ascii	"Qfa6\nD\264\334a\323*a\214P\237\205\300\b\030\007\206\005\250"
+	.ascii	"\320\202\n\002\267\351T\215\034\024\345\3275\237"
+	.text
+	.section	.gnu.lto_sortValueTableNameOrder.312.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\b\006E%"
+	.string	"\352C\260\016G\220\232Q:\001\361E\024\3137\002\211@\241\360\222\226\006\271C/\006\305X\r\273\311@\227]\032\264\f\354g\213\317\222t\216\207\205K7y\311[7\362r\254\340F\316u\313N|\324\234\257\366m\317f\244\221M\244L2\326"
+	.string	"\307"
+	.string	"\335"
+	.string	"\273\217\262\037\356\271\227\362*\243[1\320\361\242\352nGV\020\213\233Z\207\016NW\201y\352s\001\345)y"
+	.ascii	"\345)\237F\273l\272f\251Oe\220+\t\253N\255\365\247\211\354\256"
+	.ascii	"\331\307\262\223\303\357\271\267%\251\321q\271\233\355\254\321"
+	.ascii	"\314YI\311f\243=\224\223B~wzF+\300\243\343\316\363\361\034\024"
+	.ascii	"\021\b\337\236n{\030\323\017,\037\237>^;\201IL#\373J\353\313"
+	.ascii	"\303\230z\220\025\2448)\362\342\0210a\n\262\211`H\223\323g\305"
+	.ascii	"\037GVp\354M\220&\247\227\304g\b\216\241\n\322\364tJ\316j\344"
+	.ascii	"H\202\003\326 )\220\271\351\372\360\274\004\3541I\245\343\375"
+	.ascii	"\341\251\220\237\221h\264\002\324q\236]\250\265.+\001\233\276"
+	.ascii	"\272\357~\303\356F\330\2453\002>\250\036\037\367\275\273%\236"
+	.ascii	"e\250g\252\326Ja\177\345X\210\366HN\367\005\f\276\322\351\036"
+	.ascii	"Fyz%8<>n\256\337\037\236C\357\247\246g\324*\343\361\261\313\260"
+	.ascii	"\252c\267pwx\304-\225\346wc[j\327\247\347[_\003\005\006\360|"
+	.ascii	"\312w"
+	.string	"\367+\253o\356Z_\\\363\336H^\033\345=I\336\032\363\322\232\327\244\2743\222\267d^\312\274d\3636\3632\363\036\301\263\252\216\336\2049\275H\247\326\034\307;\025\214v)\271\326\277\365O\371\257~\253\335g\355\251\274X\345V\214\276ECw\024UuP\276\340\327\003\363T\307Z<|A2\r\314){,\036YA/\342\236\247W\f\314#&3+8f\311\002\3634m6\2012\276%\275\035q0\022_3V+\222\204\335-:\031\240\233\231\252\025\211\202\327\277\202H\024)R\224\247\263\376\2323U\006\272l\022+\211\305\322\\Q\241\265p\017P\021{\30213\233\335\210\371(+w\315\323K<\255\353\031NF!D/$&;Yk\255&\r\304\305\f-\230\n\303`TW\260(\301\351*OR^f\"\016fh\302\330\027\003\375\342\023\374\332\004\273$\204\2111R\266p\231\354\276\365\322\207\007"
+	.ascii	"&\026,#\271I\332\003\232\275\036\234l\332'\276V\207\212\313\350"
+	.ascii	"+\353\361\221\266poa\332\247\351\023\336\245\\wc\370Bb\262\345"
+	.ascii	"\356~R\331~\313\271\320 \217d\205V\224+\312S\356\236\"N<>~\306"
+	.ascii	"\265\365#[x\006e\256}\272\233P\025\217\0012P\234h!DU\334\005"
+	.ascii	"P\212\026\372\006A\020b\021\364\323B\bh\350'\250\b\306\017\004"
+	.ascii	"\001K\344\002E\321O\f\"\242\242\237sX\337Rb@\252\0357\274\356"
+	.ascii	"\355\277\241\334\2579\233\r{$\333\301\203\007(\327@\374\321\251"
+	.ascii	"\023\207\207\003\327\302}R\256\2456\202\222\255@\323't@\353\336"
+	.ascii	"\345\272\356*\"\032$&\333q{p]\027\370/\212\255l\330Z\270\271"
+	.ascii	"'\265\236\246d9]\357zi\327\267\232\021\342\227\005\254\036LN"
+	.ascii	"\032O/i\3624\356Z\276\353\236>\326O5T\\m|P=\023O3\244`\n\r\200"
+	.ascii	"\336O\216\035\247#\265\026\256\203\333\372s\210\001x\326g\357"
+	.ascii	"~\b"
+	.string	"\301W\262\365\201Q5\372\310H\342]T\334\f\220\204\2612g\277\313\231*Z\327v[\\l\310\f\243\365\213g\272t\315\023r\250a(\304\224\202\210\314\210\220\0043\022\2451`\002\031*\263n\020`Vb\222j9?&4\024^\233]9\006\232\\\001C\266*\203\207n\215N\257\026\0229R\342\354s\224S\372\262G\220h\034\3373\347\353\b\307!\355\234C\242\037?\206O\315\263\340~\357t\034\337Hn\375\347\234\020Qq\211R\322%\372\253W\323\314\2232C)\310:)\352-\307\225v\330\245_\245\004\303\277\336\235\316\223\225\t\331\376\3445$\271\261f\003\004\366\322s\2140\242\037\271 fkW\005L\274\251b\263\272\362V\254\t,\272l\215\034y\342P\034\0246*\215qH\034N\276\224g\"w \2072\313bOS\020\034ub$\304Q\2401\350\n\0226f\320\374#(\346\267iXQ\007"
+	.ascii	"\377\265\021\210\302s\b74\003\260\002\377\004\316m\006\346\230"
+	.ascii	"\270\201\331P\254\374B\231a\353\251\001"
+	.text
+	.section	.gnu.lto_compareSettingName.313.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\210\001\r\020"
+	.string	"\266\236lF\340\222*\035\312\004\001\362\376\317\223H\343[8\331\034(\177\330\203\364\311>\205\343W^\242ds\356\334\023\320\032F\323\241\363\334\353\013\365\374\0049G\004qX\0138\023\017\277\213gx\276\346\007\261\236\004\021\262\345N)X"
+	.string	"Z"
+	.string	"U"
+	.ascii	"\343g\333?q\024\242\r\003\334\031\017\033\274\231\r\313\n\036"
+	.ascii	"\273\033z>\342\275\233\037\340\275\323\017\027\337M\225\242\277"
+	.ascii	"z\307\001\271\324b\340^\261\f\237s\001\210\0326\034\314d\235"
+	.ascii	"\230Kj\200\230\205\351\331\335\343.a\261\226\224\034\320\356"
+	.ascii	"Z\276b\030n\357\266\037\330f`?\027\236\236\264^Zv\322\007@\222"
+	.ascii	"C\204Mv"
+	.string	"\231\232\335\226\233\037\233\353\\\220\370\355\267E\037\347\216\177S\ta\271\254H\313m\006d\307\356\032xg\005_\214\212$d]0\034JT\332\b\022\210\267U\260\356v\350Q\340\322~\212\253\020?\252.\262K\2231\263;\0360\201\357\235\00308\374\026\024P\276\020\276J\017\323 u\316X)\321\2227\227\273\273R\025\017\324\022Y\215\r\314\r\227\364aP^?\345\250m\222 \377\002\325\263\242+wz=\356`\256&\243\203%\bK\336\330\343J\352\213\375\271J\263\177\273\301\307\374\337\307\237s\333\337\251\f)\322\004\224\350\324\340\2444J\245D\250\016\204\324IID\362D)&\245\351\320gD\n\205\245\221IJ\030:\241\302\317\210M\021D\2470e2\235\302\216m\217\373\271J\263\224\240>GS\033\241g\361\343.`\244\251]\230\237O\205\331\236j\020K[\235\276\370\005\215\334T\032\212\247z\023\001\036"
+	.string	"\330\214\301=\b\302\b\372c\233\223hE\t\347Ll\251\334%p\273\244\205\005T-\202-&\026H\222%\240k8x\3328\025\0336\204U\237!\200\255\f\203a|\006"
+	.ascii	"F\bT8\270;J\033,\202jK\231\242i|kK\031"
+	.text
+	.section	.gnu.lto_cliGetSettingIndex.314.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\303\004\305 "
+	.string	"\306<\326I\200ZR\007mE\202cz\361y\316\021\341\023\240\032b\036\234\375\370#&i\034C:$\177\365\343J\316\253\212\034\331y\020\f\253F\343\344iR\365\214\371\272\232*\335C_\005N\025\273\240\230\263\272\336Z\333DJ\231dJ\001\300"
+	.string	"\273"
+	.string	"\301"
+	.string	"~\273A\352\267\200\265\265\333\001\316\221{\245\350\317\231J\355@\255\335>\304\211\034\371R\205\367r\276\032{\346\274\\\320\006R\277\275L=\210\0139j\244\233\237URX\311\264\004\266%\347%\220\347?\354\267z\f\366\3736:\327\270Gr]\016\227\356n\370\332\257H\355C\327)\233+j\316\n)\345\270\032\310(O\213H)\337QyJz\217\247\251z\223)*\263\260X!\225\216m\004%/\234\002@-\331\232\245\206\305\237^\217P\305z\275\351\316\304TRa\261BF\271m\341o\021D\221d\321A\021\355\317I\207\321\233^\233\240\224j\275\351\344\234\273\032\241\220\336"
+	.ascii	"\274\273\255tw\205nK\f\236D\330\256\325\301\236\352F\277\355"
+	.ascii	"=\330\257\2777}\002\r\2460.\311\244\332\326\275\034\326\307\352"
+	.ascii	"v\003U\200\030\373\257\272mjhf|\314[\346\347Kw\001\356\345\036"
+	.ascii	"\343d\336>wz\367x0]\033\347L\357\324\305\274o\2666\326\325\276"
+	.ascii	"\266\266\315\325~\\\355\232\326\366\0014kk^Io\242%g\247\266/"
+	.ascii	"\031\355\232\355\3601w2w\247;\323]\314\273\335H\373\021/\363"
+	.ascii	"\247\263\204\214\tNF\304\033Ve\336TQy#\2523f\344\202\251\304"
+	.ascii	"\021\3159CH\375z\367Q{\2307['v\223\016\237R\246r\212\007N\021"
+	.ascii	"\007;r\346\r/\251*\367\234\212\312\030\321\234\227\t\002\327"
+	.ascii	"\3676\177l_\321J\0226\3022\237\223\\\313\372R#P\357\343\027\360"
+	.ascii	"\335\022(T7\312|\201\342\017;\346\361\177\225\n>\305\202;o\344"
+	.ascii	"L|\320\335&\034\355\202\207\245\345L\314\211\342R0\330\f\032"
+	.ascii	"\260\006\354\367\276;q\f\361\275}\217n\2359A8\024$\234\264\234"
+	.ascii	"sN\373\231?\331\320\256\345\267;x\250\036\260_\337?\223\222("
+	.ascii	"3\005\376\337\373\007+\262\245\177\373\177\177zNk\313I[\221J"
+	.ascii	"\251\266\375\332\f\036[n}\230\367%6g\342M\210\254k\365\207\020"
+	.ascii	"8\004\366[\377\366\305Tfy\265{\207\247\272\261kX\370\330BS\372"
+	.ascii	"\341\016\331\324"
+	.string	"\366\217\325B\354/\342\313\n\261v\351v\263#~\202\036Ep\204\320\317-\0022\"\n\016\341\023B\240\367\351\371\361\261>E=BA \034\f\332\021\262\315\303\340\007\210\007(\364\263\023\004\344\031\"\0022\370\265\220Dp\bX$\024\016\001u\313\354\177\325h\320\037:r5\205v\025\261\315\343p\337:I\257\244\333\365\276q4\237\376\261w\267o\213\343\375\315>\223W\274\270\333\234s\316\331\264&\212\205y\232?\372\323}b\320.\266t\246\027\205r\225\331\366\033\314\373c?\200\341$\007\356\3511K(\027\333\255\367\277?\266\275\245_\343~\203\177?\363~\265u\326\353QU\225>V\273\1773\255\306\222\335_A]\3469$\327\270\276\240\020k\227'R\314,\267\307\352_B\273\232\002U\250a \244\bC\006\021Eff\246&l\213\r`\002\031B\244\007\020X\311\264\311p?\364iB\212\370\260y\016"
+	.string	"\257$\rY\301o\2214l\342\352\205\237\027\266\351;? \202@\300\372\243F\325V\266\330U'@H\367\212$\206\0201\223\b\032@-\241dD\007sV\360\364\341\024\243i\317x\210\351\223_\221M\246y\272C\334\030PQ\335\252j\272`\301\203<&\373gd/\206\260u>\233\2229\2202"
+	.string	"\230\337\354x\364 *\007\377\221\315b\347\020\350\216\3130\205"
+	.ascii	"\261\340G0\t \\\021'\237\241\245\264\001\210\177<~\035{b|+\355"
+	.ascii	"\022k\367@O1F\246\264\374\007"
+	.text
+	.section	.gnu.lto_cliSet.315.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\324!}\234"
+	.string	"\372\001\2219Q HY:\303\001\203v\214\340\234Y\177\315\374\304\1779Z\361\300\370\314'x\017\302\240X)s}\245<c\247H\033\030.m 8F\265"
+	.ascii	"\373\305\230\247>\223\332\337*w\2531!\227\210\214\361\007gC\202"
+	.ascii	"\234BmO\253,,\260\007m\"e\222\001\215\0036\003\206\003A\274\315"
+	.ascii	"\201\227\221\274\377\025\026\\n\320\304\270\201\2515\036\333"
+	.ascii	"\352d\332g\245S\337x9\341_\370\363\371"
+	.string	"\373\374\206\277\340\257\347\317\363K\177\277\037\357\327\373\371~;?\335_\367\317\371\353\374q\177\234\177\315\317\346\177\363\253\360\253\371\337~\266\337\204{\330}\341\371\274\317\r\177\270\3071?)\324\225\346\030\241\264N\225q\375\362\3436V\370eN\025 \214\350T\016a\024 StJ\2076\270\305\270GJM\240\217\346\330\030\300),ncfx\366\350\267\301\025\2671'\322\337\331\377\355\321/\210\225\027\321?\351\225\274\357\275\217\257j\314-L.\212\361\252\236\325\023\267\2609\351\007\306\205\373z\212\372\241A\033la\177\267G;H`D\371\006\237\305\302\355\366X\267pJ-\266\325K\305\336 \232\230u];0\322\345y\212\362I\3318\240\363\270\313\3551\216\223/\353\272.\325Y8\343U\227\321-\f\312\227u\355\002b\274:g\341\224\242zn\272~\300\331\313\211\203\204\270\242Y\261>x\021\315cC\033t"
+	.ascii	"\233\267\371\004\016\267G\025 \200\\\351V\240\b\270\201\311\355"
+	.ascii	"0^u\363\024\230\1773\004yE\266\"\2454\301\372n\030\257\"YF\226"
+	.ascii	"\222\025\253\nSt\016\315\256h\301\374\232\"\304\025\272^\341"
+	.ascii	"y\212\316\311A\033\204\221f\177\302\036\325\034\031s\003c\363"
+	.ascii	"\302x\267=\232=^}C\362\304\rl\215\013\343U\f/\341g\366\270k\346"
+	.ascii	"m\314\233\340\001\022\213l\345\020B\023lm\205\361\252\222\370"
+	.ascii	"d\221\315\212\327'\331\032\304\304\r\f\215t]\331\226\256.\223"
+	.ascii	"\361*\357\036\355i\314\253Y\235\303\272Z!\343f]\331\232V\311"
+	.ascii	"xu\331>T\274j|\262xu\231\273~\275\272Y\303\212`i[g\006\327uu"
+	.ascii	"j,\373\263\035\366\323\023\331\276#\210\314\273h\361\304b\205"
+	.ascii	"\212\024N(\232\230\226N\230X\240\004\211\021J\"\024\b\241\004"
+	.ascii	"\361!\311C\007\244#\243\"\242!\241d\020\007$\320\006\r\031\216"
+	.ascii	"\030.\030\177\212*\261\231\271\307\340uu\027-~dpP\002\343\314"
+	.ascii	"{b\321\367\025|p{\254\"\205\323\336\034\243\330;\353\222\343"
+	.ascii	"\246\2748f\312\253\303KtN\034\213\316M\314Y\240\256K\316\341"
+	.ascii	"\n\\\242\356\254K\215I\364\261\341\021W\276\326\\IE\237A\264"
+	.ascii	"1\"\324\024\340\022\2428&%\252L*E\007\345\240p\020'\250I\203"
+	.ascii	"fM\375\320\367 \030Q?7k\236tV\327\345\205=\020\333\314[\234\327"
+	.ascii	"u\351\021a\244\211\311\362;4\356p\345\253\314\221\310\374\210"
+	.ascii	"\314\0306\"Cd:\353\022\303Ew\017R\212\362\2259Q\227\017q\261"
+	.ascii	"\353\302B\311\037\031T\276\370\036\304A\313YW\026F\326um!*\345"
+	.ascii	"\314\030(\004\225\257\275o\340\223#\306\032\306\3028C\2334\021"
+	.ascii	"\212\031\250tI)f\270\003\023eCP\351\342S\217OQ\271A4B*_~\307"
+	.ascii	"\360\272.0\270(|\201\230\204\202\302\335\353\272\356\020\231"
+	.ascii	"\356\300D\371\231\2078\353\202\302F\342O\022']^\327\345G|Q(}"
+	.ascii	"s4M\376\211>y\361h>A\025&wmxj\274\236\\M\302D\342\t\261:\021"
+	.ascii	"x]\027\2248\304B\225\276\243\227\0267\361\2044\005\301\r^Y\304"
+	.ascii	"!']\234?s\346\362J\302\374#c]\327e\247\327\327\227\201\357\022"
+	.ascii	"y\354\236i7\311F\215\241Y\032\235kCb\004=y\216N|8le\t\250d\266"
+	.ascii	"\f46"
+	.string	"\357f\271\207\231%\351\031&\216N+(\220\0059\030\242\372B\013i\213\323\342\302)\027\032\203\035\023AB(\r6\366\222\317\322\220\357\214je\006ml&\213\312\341\311\340\006\\1\263\370N\2506\361\f\003\247\342\030t\003\272\203\250\\\233\346\b1\030\203\336b.\341;3\350\303]HjW\206\216P\332\200\0268j.t\3312\3261\350e\333\236\003\034\343\013W\264\200\t\323\t\337\211A\217y\206\tC\227\002\240\336\231\261\313\026(J\361c\255\026\252\3135A\3774\r\271b\377@\031\312\020\342EX\246\027\363\203\017\212W\213\255\224\005\212\305\323\023\327u]\177\272\fIq\202\376X\037\315\217-D\353\3745\305Z\360.\363\t\023J\2060gtY}\265+X\355\203\365.3\2149\246$\266\332\337:\344\365\0274\261\211D\343\336\266T\310\342\351:q\367Q\340\017\230U\212\362\312\214\315\247\301\302\314\362"
+	.ascii	"Y\222\276\332\302]L.(\\8azij\322]T\205\t\036\241\332\362\363"
+	.ascii	"\b\211\274u\325\272sw\227y\230\213\351\345\311l]\265^\\]^\302"
+	.ascii	"Nf\224x\021\256.\023\214\223IB\361\352\301\372'\374B\237h\235"
+	.ascii	"=\316\020\260x\332"
+	.string	"\375\026'\211WQ\211\357\306[\3141Ef\353\332\274\223Y\306\330<\t%\230i\3145\276s\217\236a\236\320\2750+\224\252]\266'\276\200\"\367\017\227\263\226j\026`\024ao\325\352\032\256(X<e\020j$L!\376Z\276u\330\200\300\244\273l=(^\320)\240~[\332\364\264\270p\337\0274\333\331:\304\342\351\202`\013z\227F\r\276\363\3753O\272\261\013#%\224j\365\325.\333\025w\331\356\357\224\322\002\225m+\273/\373\333\367cW\363=\330\343|\377\365\270\357\231\374y\347\227\\\311\375\276o^\372}\326\363|\277^\317\327\352\202_$G\210x\215\234\357[\344\204\337*$/\325\013\277\033\234\317W\203\367\371N\335\360\373\003\311\353\203\210\367\001D\274Rg\363\355\3617\337(\250\006\\\205o\006g\373bp\023\276\027\\\355\267 \311\273\343x_\035\327\373\346\270\235/\216\323}\005\360\272o"
+	.string	"n|\315\327\306\327|)\370\333w\202 \336\032I^\t\216xi$y#\030\342\235q\304+\003\311\013\301\020/"
+	.ascii	"T\336\030*/\f\"\336\007\222\274\016\034\3616\300\201\367\305"
+	.ascii	"\021/\003D\274.\220\274-\222\274O\347e1\304\273\002\311\253\002"
+	.ascii	"\311\233\002\311\353t\304\213\302\003oS\222\227\t\311\273\204"
+	.ascii	"\344=q\304kB\210w\201$o\t$/\t$\357\210#^\245\016\274\"\222\274"
+	.ascii	"\n \361\2068\342U\022\361\202H\362~@\342M:\342\3650\304\333\201"
+	.ascii	"\210\027i\210\367(\311k\024\304[d\304K\204\344\035B\362\n\031"
+	.ascii	"\361&\213x\203\206x9$y\221I^\240!\336\rH^\rD\274\307$/\006!\336"
+	.ascii	"\013I^\343\020\357\217\020o1\311\253\252\274\304M4\344\021Mb"
+	.ascii	"D#\301)\365\001\317\205O\265\024\006\313\204\020\321\333[V\203"
+	.ascii	"\313\262\r\024h\021\n\364\002\236j`B\264\262\237\325\304;!\372"
+	.ascii	"(P\331\307s\366{\252\215\005\376}g.O5(J\020\275\235e\225\007"
+	.ascii	"\002\037\362\202\3049\363|h\020M\274\303\203\217|h\006<\325\274"
+	.ascii	"\222\332C\277\331\304@\035\235\324Hg\266\016\201p\226\345\026"
+	.ascii	"\276\323C\377\357<\370,cH\307\200\317PF\017\335\025\033f\320"
+	.ascii	"\273\223\005\242\313\266\204\265>\313\206\335\205p\271\220\303"
+	.ascii	"\276\b.\357\371\330\363\213\236]b\004\210\334\302\n\245\017"
+	.string	"\310h\362\341\362\332\217\375@\216#\335R\2738\266)\317\017\\\030O\025\004^X\272\214\3020\373[\342\025\221P\301A\277;E\372}\337a\327\344o\214\032V\030:n\b\223\272l5\bv\333_\2229\017]\266\020DA\372\363cnakQ\216\343e\017\301-LM"
+	.string	"H\024\364\341\376&n`|\266\332\0201\336m4\027\216\356\320\032\004\333\344\220\272C\037\f\363U!!\241\201}\366\364\220Z\203\254&s\204j\373\226\227\302\236\016]\266\\\304x\347#\276\373\357\236\314\263[\241\211\321\276H\361e\315\265\304\"\033\375\273\025\374\216\376\"\305%\032\331h\n8\204\343\350?\033\250\205(\337\224\221\216p\364Q\337\2373\317\206\274-Y\216\226n\324\031\272H1T\027\205Y\216\341;\215\272\030v\246<ihF]\266gr)\026u\206.m{u\0250\271,\323\212W\213\372\\Q\206:\331D\375\346\b\306/\235\242P\017\365\233g8Z\250\213k\312\360\3342M\r\202\n\222-\367Xn\271f\204\004\r\324S\207\343\226%,\333\226g\226o\305\253\311\376\335\3253\250 \231X\232\032\233\027\031aQ\227mT\034\t\f\335\331QqB\020Zz"
+	.string	"\232k\211\202\372\316&\236I\303s\226'\2700[\303+,\333\240\310\223\023\330\027\007NPw\310j\022G\250\206\305\323!2\227\352\333\005\332\265\351\361\bGc\007\347\206P(\371\025$`&h\016\034q]\251@ 5\303\323%"
+	.string	"s\340\320o!\252\267g\353p\371\270\322p@6\223i\233\233sd;\351\261\tf\270\220L\032(\256\316\201\032\310\256\t\033B(\002\370s\247\363\271\307\255\n\316\t,\341\232\236d\302\3205\373jy0\324\nK:L\372r\027Bc\227\202\272D\013\004 \002\360\277\272\307\334\222\205\006\236d\236\320\255\237\026\302\r_\275\241_\3276\247\305\205v\214\306\203\245\035~[\342\021\221\240z\314\256\272\235\331\320'\003\325c&\226\246\246\241\377\325\035\270u("
+	.string	"\306\360\205+\356\227|E\250;\313?\276SC_\316\231\315\223\214\027]\223\331\210\220\247\241\313\226\370\244\242\0219\320\277i\233\336\217\221\350\243\326\350\006\245Wl\370\023\347\213a\206\264e\265\257\207e\326\317(P\214\230\0241\313c\330\356\220\260,\001\245\321lU\261\227\207&f%;[\006\263~\306u\275\272\330>\251xUhm\202\035~\341/\273\353\367\213\261s5qU\212\b\206l\213\017\367tO*\036[\252\227\267\240Y<\305\303\\\252\330\bM\004\246\027\325\b\372\327\202\030\232\026\336r\244x\365\330\t\200\376\351\021K3;\242\244\001cazAq\245Gw\2343\204\250[\303"
+	.string	"8f\034`\303*\253\210(\207\2148\256\002x\f G\re\005;&P\226h*\241\254`\207\262"
+	.string	"\025\324\340AcF\0053l\320P\366\030\321\244BY#\002%\217\002\030 \207\222\002\0357*\340Q\200\024\333\304[#\307\f\035J\tn\340\230q"
+	.string	"\03574\2542\206r\310\210\342*\035\030\342\203j\212\b\021\251!J\"TRB\204\024\241\221\224\002\342"
+	.string	"\016\212\\\200\"\002\325\203\210\004J\210\020\250\243\020\"\003"
+	.string	"\002e\244x"
+	.string	"\240\033D0\364\220\372\021E\004*\310\017\325T\220\356"
+	.string	"*H\253?\210\370\240\222\302!\025\004J\207\024\020\007@M\t\2012\022\324\201T\017\252)\265\207\224\017*\250\0374\244\212"
+	.string	"\2012\222\001\b\224\221\236:\225\024\220\026B\204\003\bH\251RTS@z\004\211\372\331(\024S@\242\234\250\246\240\2028E\t\031\342\204bh\2538\220\022\342D\244\252J\210\323\221m}[Y\031X\235\205\305\205\023\266\300\316\312\016\224g\035\036\2434_y-\004\237\236l\245g\305\007\327i\254\356(\375\031\233,\366\254{\343\345\333A\013\034@\026\274\364\036uktN\\\243\017\247\317X\341\261\00246\371\253\3150\271\250H\264u\325rQ\002[\r\365\013\024\023\006\305\322\324\216N\261\254\025\304\0166\232G\360\335\303\232c{[mH\360\335\227\350\301F\337\270\321]\002\nX\246"
+	.string	"\332=\311z\245\024\235\313C\033\\\331V\023\207\273\214+6\004\352\302\202\241\n\t\322\254\002\231\254\366\030\233gA\202>V\201\276\265\341\275\035\252\206\205eRtY\026S\365\217\246\321\273V|\254\f\207\220\321h\005<\353DH\265\234\"h>k\333\243\352O[\214\325\324xel^\256\304\325\b\324\261\376\362\026M\365\355\2433\005\305\f\rzF_\017\030%q\226\fA/]F\222\345\226RF+7h\b\372#\200Q\322\324e;\325"
+	.string	"h\336k\233\333\240\001\320m\345P\375\362\003d:\261t$\251\335T\316\004\323w4W\214\376Y\333^U\303\350\030\335\206[\320\254C\025\247\032F\263\0300J\336\266T\330\321U\375\276\350\024o\311\201.z\300>\272\201\376\301\265d\302w:\320\007C\326\354\253\006D,y\256\031\002M\247\323i\213\366\321'~\246\360A1\261tR|\321E8\320)`\233^wav-\235\\P\274\372\242\221\326pEa\240\217\207L\253\257x\201\263?`\202:\320\351\036\301\273\350\007x\365\226\252\030Z\226P\\dY\342\031M\245bR\314\260\270\350\013B\247R\261\264\017\272\314J\225>*S6 \004\241\307\252\030\310{\322bK(O\035\266\304S\221\320i^Ki0\r\032\310\316\211\341\0305\254\236j\342\217\026m\301s\rP\006C\375\350\037\236\311<\327\346\320\fK\344\350\343\325\033\231\022"
+	.string	"\355\016H\242\313\266\2509\026\267\244\211\334\302\364\266\332$-]Gs}h\216\321\331j\243t%\315\203vt\016\223\240:\207\216~j\256+\322O\275\241\255I`\026\336\333\341\233\347\b\246\353\350/\351\213\211\032\236E_I\267\035!\314t$l9\306w\262h\251\035\237/\204\322$M\224V\3646\b\313'\022)\025\275\242\211w\270\355l\346GTt\006\3175()\032E#!:u\n'\024\375=k \034NE4\365v\327Rk9\305\007S71\355Yj\023m\325K~\242\227N\230\350\007\252\001\362\211S`\201\336~Z\035.\253L\225\350\005Jt\006O58\022\255\324_\003\202\223\250\322"
+	.string	"!N\322\244bN\315\210\210$I\222\306\222\n\020\bcq\036\307\222\017\022\3004A\007\224\212\021\022\021\022%\331\237\003Q!\306M\2575\200\016z\233\362c&{\356f\260B!\241\320>n\245g\0241\032\307\364\310`\212\265\n\336\274\314\262}N\243k\2212.\246N\272\210J\020vx\027\021\271K\\e\331\022_\347=O\365\201"
+	.ascii	"\n#\252\337\272\243\025*\362\226b\036cU\322\323\353}\227\273"
+	.ascii	"\236\271d\251\302\246j\365\343\020\252\363\206\233\210\221*\356"
+	.ascii	"\200\254%\275\210\027K>O[\021\247Ak)\002\3657|\202\032`'\216"
+	.ascii	"\210\336\006\336as\031\245\343\233\232\340A\270K\347\tTA7\032"
+	.ascii	"\262\020\001\241\032\232O\006\023{\343\206.\273\031l\267g\322"
+	.ascii	"\367\203\013&\374\362&\364\277\237 :@\361\227]h^\022T%Y\022\212"
+	.ascii	"\231\245\344T\264\200\266\364l\351\322W\344A?\221\rg\004EA\306"
+	.ascii	"\236\205~\336\266\371\n4\326\225 \016J\274\356$5\004fC.5\342"
+	.ascii	"\257(F\244\250Q\305m\356B\353l\256B\345\271\332\257d"
+	.ascii	"\266D\240={\037\365\342L\326\321<\022] \302x\001\210\003\336"
+	.ascii	"\325X:\301\005:/\343s\210\310\273\272\203\025\211\345p\243-g"
+	.ascii	"[X\372K\256\020\212\236\265\020\260\311x\323\013\320\252\270"
+	.ascii	"a\201\274_\034\004\264\177\214dS\207\215$\203\215Vk\017I\302"
+	.ascii	"QC\374X#\361/J\316\273\374d\210\323\033\254\332\342\223#s\341"
+	.ascii	"\034\222\177q \253\374\250nc\002\327L\350\372vT\017g\022G@`R"
+	.ascii	"\260Y6:\245\300Z\263q\323\302\232\317`-\f\226f\304\034"
+	.string	">\303~\324)y?\3175\327\264\345\001XG\b%\304\365SV\26362W7p>\217\340+&\372{\272dy\344\330r\3229AJ\347\036\037\243=gZ7 \253a\254j\331u2\035D\f\225\330\227W\371\260Q\235I\276m\372\303I\202%\247\023G\357\324\364 5d\344\234t|\261WpSV\274\230\317\001z\316E\233\016\013O\277\006\273(\277\3044\345\306_\2457\215%\376\306pp\343\300\327i\017k\373\025\315\327\337_\002\270\351\243\361\020\271vry|\220\217\231\275\227;i\370M\022\367%\272\213y\027\364\371@\267\027_\346\230]\306\2162\027\273\302\221\201\301\266V\210\302\024M\363\222\001\003K\270\260x\303;\330\220\262\343\333\331\305\353T\313\004g\021\321\331\364#\027J\325\0330_\303\031W\266\336\272ZG5\305\313e\345\037\004<\304\256\370;K\005P\332\230[XC\023\320\262uo\311"
+	.string	"\365\221F\303MD\360\273x7\366m!\232\210\311\345\350\330,\307\300\224[\301LY\264\335\243R\330\254\253Y\252\016\223!\021\225\233P\331\250\325>\\\200E\203\333\356\220\212\250v!\224\270\3627\021\371\017e\303\222\311\305\255\024\222\275\273\263\264Y6\360\2701\365\016\337\351\214\037\001\342\\=a)\025\305\311\177\035\272Y\370\035A6\321\302zS \037\251\0223\202\200Bow\345\227)M1r\371\263\200\214u#\035\271N\260\330\371\365\016\273\262\251\202]\001\200\347n\211\320\034\307\222\345G\217\346\232\002\215\300\340E\276\202J"
+	.ascii	"\032D9\037{\326\036\253m\2275\230<\340Y\3215\365Te\016\034\242"
+	.ascii	"\276i\304Q\326kg\234\031_\242\033\263\022\302>\t\201~\342]JE"
+	.ascii	"\213\312\300\004\316\020\352\nA\002\215"
+	.string	"\241\001::\r\fQ\261J\203\326w\331h\376NacO\275\tPBd\306\201\310)Q\205\274\267\\\027\250+\244\003\233\267G^\022\032(\027\034\276g\231\035\275\362\005\024\362;8vn\3454\247H\304g\350\f_\367\215\377\326\261\313\301\030\332\236\177\377\377ta\365\365\021]\007\214\242R\005\350\225\272\026\364\346\224\352;\372A\345G\022\375/\300.K\351l\244\256\304\345\001$l\030P\035\211\324\026\034C#)'\275\234\341kzE\322X\320V\255\373\305\364\275\005\350~\246'\003\344F3\363\347\b2\245\341\031\221C\360\023\232\201z`\254\320\303\312g\317\002g\352\3012\344\271\276V\027\263\331\017l\344\301v\037\303\3500\202\f<H_\037\3635h\333\001\314I\303\313\271%~\206W\004\235\035\316O\323\24230%\360 \207xkwy\240=\220\356\020\026\303\2040\334F\225)l\001)#\210\245bn"
+	.ascii	"Z#t?\331\236\340\335\270\334J\261\317\305zo\336x\327\252\254"
+	.ascii	"\026\\!\237\\\336\237tZK*<Z\340\020\206:\337b\260Q\265\270\272"
+	.ascii	"\260G\310\323\330Az\363\374Q\200\2130<\255\271\035\204o-\002"
+	.ascii	"\373\226B^\020\025\213\335+\317\177\367\nb\3104\261;\367\204"
+	.ascii	"\225T\213\035N;)\343\343\220\233,\267\2579\250\177\\6\3779\336"
+	.ascii	"9\325\204\306\225\23366\031\212\233\364\224\2257~%YJ\032f\207"
+	.ascii	"h\003"
+	.text
+	.section	.gnu.lto_cliStatus.316.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`-\023Mf"
+	.string	":\262\270'N \224\322\032\003E\323xM\005)\267*\253p!u\2378\2016\227p\003z\331S\376\213\276!\321:\221V\317\265J\312\230;O\363#\203A\002\304\006^U\254<\347\b\203\205\303 \236\244d$\3071\361i\2111\363\020\300\220\224[\246\224RV\002N\002r\002*|\316)|\316F=\316"
+	.ascii	"\364\234Q\364\234O\370\234\213\200\234\211|\316C?\316&v\234\205"
+	.ascii	"v\234\203~\234\177=g \237\363\317\352\354\343\343\334\343\343"
+	.ascii	"\354\353q\346\3519\357\364\234{=g\235\236sN\317y\3659\343\360"
+	.ascii	"8\253;\316\274\236s\332s\376\236\263\367\234\333\b\001cf\260"
+	.ascii	"\224\251\221\231=\335\331\253\344\316\315\013\345\275U\3511\335"
+	.ascii	"q\335`\272\277t\273ug\351V\353\346\322\335\245[\207\326an9\356"
+	.ascii	"\215\t\022|\216\235a\351\252\035\270y\3500\334\343\0314\222\r"
+	.ascii	"F\252\307K\355IEjm^\\\321\211\332\263J\324\003/\334p\334\373"
+	.ascii	"\262\204}vA3X\273\215\373\215{n\037\370XEy\177\230\250=\303."
+	.ascii	"X\233\347\215\326[:\207^k6\3561\263\016\255\277\315(/\020\224"
+	.ascii	"\3453Iti\3552dK\306\323\311\346\306zC\343\220l.D|^\350\333I\226"
+	.ascii	"O1Q\032k\363:\232BK\247%[\255H\372\206\275\357\026\373\364\202"
+	.ascii	"f\315h\3239k\033\222\235%\204\364\275\341\265Zr\364\024\213b"
+	.ascii	"a\363\276gH\315\343\340\332<6mgn,m\226l\032\220\375\363\276R"
+	.ascii	"\314\332\336\367,\211[\254\315\343\263\026R\233\267\366Om\036"
+	.ascii	"'\231\211\370\267\355\365R\311\260`\245\261y\337W\351U`\"\346"
+	.ascii	"\341tz\326\314\373d\027\021\r\231\020\n\372\001\375\370\364\370"
+	.ascii	"xvz:9+\216\312K\337\223\334\351s,\rS\253\252\213R\234#J\2504"
+	.ascii	"\231\254+\251\2156\321\267f\253\342D)l\225\365P\360)\306\006"
+	.ascii	"\213\035\n[em\202J\013Qa\301\203\246\364\217L\326"
+	.string	"\224\224\265\222\265\202\003\241\2605\326?cb\356\023\326=aP\334\207\243\300[3}9\277(\351\270\2201i\036\257\336\361r\342\275\024\306\2231%\264\320\017_Ct\230&\256\263\002\205\255\256\316i2Y]V\262\234\2766\034\227\343t\230^A&\313+e\337\367\355ia\271\232\322\030\263B\326p\355$h-S\035\2705\266~\353\025V\262\2368OG\213I\247%\364\2470\242nI\370\264\256R!%T\230\315\326\216DK\351\216\243\300\373\276\354L\255\255\346\023\315\334E0\273\023s\217\230hu;\236\351\201\336\303\236]i\260\270\224~\307?\277\343?\215\306\007\373\207\t\315\271\203\222N\315\215\322\251eI\025\365\301\030'\f\217\006\337o\r\304\303\334\013$\244\334\037\2504\036IQ\365y#\332\231\022|\211\233\306\006\273\226o\271E\270G\270j\\5j\363|\276\341Z\207\322\371\305\356\315\312\335\320\220"
+	.string	"\205\347\256a\252\001\252\374\252\324\310{Hp\355\206\\%\326\245ga\217|\025\0375\217Q}\337\363\275\266\034\243tfR\331t#\270o\034+\251\354\035\302\330\217\370\322\275K9Y\305L*\325\346\371\336W\366t\262-aP\002qi\203\345\037\214\205*\317\367@\253\273\3626\214"
+	.ascii	"Vr\004o&\317\0275\347\310\326\317y\235\357\375\316w\233W%\221"
+	.ascii	"$Y\227\275\306\202.e\306\274\316\257R\322K\354\274\220\230V\273"
+	.ascii	"\351}\222\330\222n\243\363\235v\206I\263\311\371\226\023\243"
+	.ascii	"\301\212\223&t\022C\326\367\275\252\301\255\306\005\"\351\\\247"
+	.ascii	"\264j\363\3267\362\345\334bG\303\f\257$\024o\346\322k\320\234"
+	.ascii	"k\302{\034#\222'\b}\255\313\356\222\004S\037\347\223\260\226"
+	.ascii	"\b\212%W\360f\252\257jEyQ%I\346\315\344\375\316\034\027\2579"
+	.ascii	"\307\004\372\237\016\221|\366$_X\227\255B\f\351\263,\23499C\322"
+	.ascii	"\314\233\371\277S\306\r\224u\346\005r\034\315A\311\262\213*\277"
+	.ascii	"\212\215\334\277\333z\316\001\001 X\227\355\304E\363\272\255"
+	.ascii	"\201\220\240\307\314\373.\233\271\264.[\004\027:,\360f2\273\374"
+	.ascii	"*F\340\352\254?P\373\375{)\203\262}h\350\007\334S\270\311\311"
+	.ascii	"\233\351\2446\257_\307\251\026\366\304\214\313\312\357\230\317"
+	.ascii	"\224\376`\314m#\254"
+	.string	"M\224_\n3U\217i&\322Y\232[\2373\020\2373\321\347<l\267f\r:\256\231G\203iv\352/\315;|\316M\335\245\231\251uh^\3629\337\3609\333\3609\033\320Y\232k\264[3\215\325\271\200\2363\001>\347\031>\347\001|\3162|\316J<\3161|\316IA\316\301\325\031\311\347\f\203\307\371\205\317\371\350\347\354\342\347,\200\317\031\350sn\361sf\361s\016\200\307y\305\317\231\3759\007n\325\272L\255\260\276\212c\274\222\253\214\361\255D\360\223\220Xn\360U\270(F\222\270J\274\231Hon\274\2157\340\217^F\234\253\345.Y\227?C\013 `\274\214g_\"\361\342a|{a\3426\361\027\237\303u\364\274&\335\021&\\<\220'\222\023\300\305\237P\003|\001\036\305\232\016\r\374\277A\b\b\251\325\350\234\331\022?\342\333x$i\335\342w\250p\213?\240IWD\020\213'\276\252&"
+	.string	"\026_\264\266\342\003\370\235\350\363\311\3352\n@\tfe\277\007c\367Aj\242\26693\"~\206o\300#1A]\361/\003\016\316\3055\301u\272M\232\250\315[\361C_\3165v\\V~\227\002\261?|\"\270e\017*\236\331\032\211->\272z_+\026\354\237@\263\f\223\342U<\212\264e\324\312\357\264t\212W\357\242\\}U\377\270^\252\321\357\214\tqo\367\004\225\331\375r\301\274\231F\217\243I'\007\275\242\203\203\372\004\375L\002\241Wa\207\216\206\250\0353\335\3269\270b)\314\254\340\262P\324\2443\203\036\371\252\236\007se\003"
+	.ascii	"\304\273\255\267\270dLf\367\351\276\340\315\004\340\213\232t"
+	.ascii	"3@\257P\224\2711\364\\Y\227\337\3041\323\356\f\352\211G\361I"
+	.ascii	"K\031\2045\2706x3O<\007M:\262f\353\016\233\273\322\202]\324\367"
+	.ascii	"`:\324\236\264\300SD\346\242\031\245\255\313\307\"\372\242o)"
+	.ascii	"\317&k\260\226\3001\302\214s\2477P\211\336\255\240\325\271[\234"
+	.ascii	"\205\r\224\230]\034|\212\233CR\2151_\301]cs\335\334\324\346\021"
+	.ascii	"\275R\257\031a\254\267\006\355\214\221\363x\237o1\256\202\353"
+	.ascii	"e\310\205[\227\377\0325\347\326@\227_\245\263\303[\214Kq\301"
+	.ascii	"\030\205\271b\326\245\273q\345\\\037^4\347\216\200^}\325\220"
+	.ascii	"\2237?\344\320\370\n\234ke\320\352\374\004&7Mk\t\343\356@m\036"
+	.ascii	"\217\3775$]B\377{\023\337K\027\326f1j\320\013}/\2558}\320\023"
+	.ascii	"\245a-\361\244\203\325\211{\271?p\0317\b\017Bm\336\357U|9\343"
+	.ascii	"\272\\\272\326\022\366\276\257\rv.w\272gX\b\027\215\243Q\233"
+	.ascii	"\347\364\035\246)(\343\214\273\302jdWC\254\017\306H\335\244S"
+	.ascii	"\247\242\031N\375\371\246g\357n\222\031!\016\347\301\234I\003"
+	.ascii	"\2751\334\002\331\224q\264PC\366\307\024\224\224q\001\023\334"
+	.ascii	"\032\213F#\003l\216\031\020\364\360\213\026\310&\261E\214\304"
+	.ascii	"\343Q\330\203m\032\002\217X\036\003\310\210!\203\205\301\376"
+	.ascii	"\020\036\243\212<\\0\006Llpx\024\032Y\035L\0318\300\006Yb\324"
+	.ascii	"S\221'6\b\004\016\2018"
+	.string	"\234*\310\321"
+	.ascii	"\267;\330\343\024\321h\034\222\203\r\376\270\035N\025\237\210"
+	.ascii	"-+\005u\024\342\304J\021\217m\221\246\023\374\004\214\221r\013"
+	.ascii	"D\240\005\252\314\006\237\213\030\217-\324\017\242\221%\0029"
+	.ascii	"\262S\302\247\226m\205\f\tR,:P\201\261\350\203\215\212\022J\265"
+	.ascii	"l\261xd\241X\007*\270\301TB)6\330\0169\266\302(6\330\022[\241"
+	.ascii	"\2218E<\036\241\214D\210Fv\bd\203C\342p\212(D\210\220m\211 \b"
+	.ascii	"#\340'\226\030\325C\030\005%\004A\310R\t\227~@\371\230*\346\200"
+	.ascii	"\301T@*\031,\216\266%\032\207C!\033\034\002Y\034D#P-\033\344"
+	.ascii	"Ixlj\301L:v,0\201\323\022\004M:l\344\201\245!\020\201 O\305\250"
+	.ascii	"\034l\013d\235r,\375\332\242\220#T\017\225\2128\234\202\340G"
+	.ascii	"4\n\211\f\215\302\007Z_\220V(\225Bu{\024\036\233\210 \b\333\234"
+	.ascii	" \255p\2515\026\333)b\323\220x|\"\036\211\303\237\217!=\376"
+	.string	"8\364\366\2070\312\007\2178\005\0255\224z\302\341\247\030PQOJSPB)\245'c\253\024C\210\213B\210F\245c\261hT\352\235Y\365Ki\326\211\201Z\275\222\213\250\245\357\213B\002\321,~'\324\254\003S\364`\334r\375\303f\016\356\311\020\325\247ms^\2100\321~\215\020\324\032\337l\235\2269\277\334\245D\005|\367\340D\270hB\251[\226\013Q\\\317x\035\322\007\344\017\3102\3102j\363\nx\365\253\013\356\312[\215'\340\251\276\337`q\315x\002\006\370\031\357pX]D>\330\003|\227=\307\330\226n\206\236\310\273\034\323\210N\3425\236\031I\207<\2436s\350[\256\177\3209\270\327.\372[\342\216h\r\005!u\247\251=\331`\261\t\001\371\033\217\204\271\231\316\214D\203L\343\315l?\202f\235Y\233\007\201,\242\007y\304\272Le\360\341\245\215M\264\21787ReF\256A\332\275"
+	.string	"\275\352ns(R\t\344\233u\231\216\325A\201\036A\372\244W\222C\336\005\201a\250q\030\346\230c\206FfF$I\222\264\006\021\005\304 \t\2454\017\021`\251t\220&I\322\034 4\b\013\350<9\004\022)hh\f\207f\3503'\372O\242\266^\315\277P\222\233\204\301C<\177\037\361\251\033\016\375@"
+	.ascii	"\021\372\234\022(\017\327J\222\374\301\254\372\220\307\027h\211"
+	.ascii	"'\313\ta<\037E\263\265\016n\224z\230B\356A\313W^\236\247\320"
+	.ascii	"\336\377 \246\322\274\357B\272\243+$d1y\246&\347\211\303z\366"
+	.ascii	"u\300\304f\341~\330\374\3004$\204A\335a\023\243\\i\256b\177\222"
+	.ascii	"\300\347\311\315\233\360\360M`Z\002\321\312\2106_\200\225$\205"
+	.ascii	"\210\356/H\351\013\032\273\372\337&Aw6a\034\246{\262h\246\242"
+	.ascii	"\273\363<\242\245!Q\023\235<]V\225\244\030\364\251\234\235\252"
+	.ascii	"\341\025\rsA\213\362!\375\344\302P\b_\021\n\023\205\347}\304"
+	.ascii	"\341\224\f\300\236\354\351\270\252\001\"\212Be9\\iL\331i=\001"
+	.ascii	"\020\024;\217\204\260\022\374\306K\b\360\300\252\035\263b\345"
+	.ascii	"F\331>\001\247\207\263\323\320#\306E\r\365\013\255{\030\030t"
+	.ascii	"m\363\035\360O\272\023+\311r\024m(\b\360\211\374\246\220\343"
+	.ascii	"\2074$\351h+\333zd\024$\206\032\320\331\346l\r\254\023@\223\021"
+	.ascii	"u\240J\030\302\273\346P%\245"
+	.string	"\225UG\023\311T\243\210\220^#\350\376\336\215\357\"\366\024\373MS\026\021\213\244/\276\202\367Q$)\311\003i\272,\346\3149'\bB:K\220E\001M;T\254\357\227\037{\275\021\267\362\332`\2157\203\013\267P\004\223\371\r.w\216\230\307is\312w\026\364\"7\315yv\016\3279\357_\324@E7\277\035\330\211\206\307k\250\f\347\301-u\001\321\330\247\327Gx\360._I\342\035\276\036!\355\006\017\311H\335If$V\302Qm+c\324\363\265);O3\"\314\335\256T\216\240\221\273\210A\206\f\322\227D%\203\217$\036\032>TT\236\271byz\224\021!q\031h\257(\336*P\341\034(`\246\247B\273\347\2635\0029\035\025\330Z\231`\316\302\245\f\222\365\335x\346]\334\210q\271_\004K\324c\374\302\250\177:\357\265\320\374iU\273\256\030\030b\360J\034\347\025:\n\2221\362i\020"
+	.ascii	"u\300\311\365\260\244\213m\364\026\2423\332p\353\332\353f\242"
+	.ascii	"\201\037\256\326\316N\267*\353\320dGJ\3568\334 (\n\372\303mz"
+	.ascii	"\002p\354)\017y\370g\037@\004\242\025\003\025\262\237\337\026"
+	.ascii	"\375\364\225\200\226\266\246\267H\034MeO\310\002\321\f\255\003"
+	.ascii	"\344\360\252\307\216\206\376\034\313\007(\326$\315\216Y\332\275"
+	.ascii	"\217\315\212\232\376\364\031\273\371\017\257L\341\0235"
+	.text
+	.section	.gnu.lto_cliTasks.317.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\022\020\325R"
+	.string	"\332\2134\037P0\024j\215\001\344\302\3435\250\342\2670mn\377\365\357\260\232\"^\0250\035mX\205\247\203\322)\275c\370\200F5\354\320\364\fJ(s\232\377\177 \3605\310L\337\203_\b\037w\034\034\305\227\t\316\237U\025\255vF\324\240\254,!2\245\224\002\333\001\274\001\345\001\316?\240\263\257\333\232S\240\363\377\234\335\347\334\024\030\261\220\265}5\fr\256\373co\t\327\3167W\326T\272\345\272\245t?\351\206\353n\353n\322@\346\246c\341\016=\245m*\035\020\207\274%\031r\245\266\257i\240pG\3519)<\350\220\013\362\206f%\207\212\003\367\263\235t\016m?\361\300\335.\"n\243\360\242A\211\272n\223\206\332\276wU4\361\327o\334q,l\037\034\b'\274\241=\243\256\313f\200\332>o&\355\306\302&<E\305j\252oh5\310"
+	.ascii	"Ce\353\033\332n\343)4YD\334\232\2567\264%Q\327u\217\332\307("
+	.ascii	"\324\366\261i;s/i\265\266\327B\350\032\327-\262$\212\353\262"
+	.ascii	"\245`\023j\373\230\255\213\277\366\251M\374\265\217[\346\274"
+	.ascii	"w\243\270C~h4l\271)\341\272.\362]`!o;\210\005\022\362\351\341"
+	.ascii	"\3311\352\344\340\024o\2106543C\231\030\341\032"
+	.string	"T\201\277\364\347\275\345\006\316\bryau\020\016\315\246'\242R\220\350\273&\016i\361\007\022\256v\213s\240\024\250\365\003I\3375mH\233\274D\347:\356u\241\026\2008i\037\265\356Y\322<\3511\315\013\225\2357-#m\326\254\301w\226(q\243NZ\347\320P\3468H\272x\327Db\326\214\301o\2164\361\b\fnc\244k\214\2209\315\214X\017\305\302\\&(\346\205\026\246;a=\004\351\273\246\n\351\321\207\261!\332\254)\304W\260\016\202\2315\277\\M\223\344\210\200\351\273\346\220t(C\335\262\347:\310\254\231\202\003S\366\256\251\366\334\362_\332YN\372\0078\203\005 k\375C/\037)\353\272n\273\2653\275\226\356\300\031\256\353\262sy\001i\036jf\037\200\271\265\230ef\004y\255\r\003\020@\300\003\341\201\345\351\245+\360k|\277Y~\017\374t\312\033\365\375\357w\270\274Y\376Y\256\215"
+	.ascii	"\302E>\\7k\310\367=G\274V\226\276\327\306'muA\271\241\1777R@"
+	.ascii	"?Y\356?g\t\226\227\246\364\245\265\246\276\323\033\204\037\323"
+	.ascii	"\367\\\247Q\276\250ta\022\204\017\367\322x[\332\342\200U?\177"
+	.ascii	"\252"
+	.string	"\003\372Y\245\272\256\273\344/\034\003\033\"\215\307\033J?\025P\271\230\236\231F\215\247\230\235\326\303\321iy\375\360\030\270\241\276\375\344\253k\213\t\351;\331\277\355\272\343\332F\013\224\207,)7\b\277\233\013\350\336\322\243^\237\351\177\324\035\007\245[K\217:\200gr\377\024\275\337\272\356\201\234\027\\\367m\256\b\324\267\227D\022P\340\315\305\306\256-^v>\036\253'\210Z\222\177''\177\375\0260\021\302\207{a\346\n\372JRu]\037K\334<\264\025'\356#\355\343'\035\336\\\355\343\326\361k_\277\020\017\254No-\313\367\230\331\226\376N\346nz\301K\036\177\021\346\tr8 t\306!t\276aCu\256\241:\323\b@\350,C\350\034Cu\206\241:\277h\271f\027-\245\271\211i\251\005\013\245\025I\252\263\n\325\031\251:#\251\316)Vg\024\253\363\321\352|bu6\3629\027\005\235\211|\316"
+	.string	"\250\316G\325\331\204\352<\244:\013\255\316A\2533\353s\006Z\235\177Vg\237\325\271gu\346Y\235\215\253\263\316\352\234\263:\343\254\316\305\206k\276Y\235\211Ag\033\240s\r\320\231\246\2334\317\254\316\303\240\263L\3209&\350,\\U\347\240\317Y\005:\003\325\217\245\363N\016z\241\037z\023\177|\343\023\277\211\204V\310\020\365\355/b\251\253\302c\035\277_%1\336\004\263e\374\320\367\332<\345'\343\205\276\337\271%\373A\337E\316\312\366V`_jLH\023\275\234wr\317\365\r\033\264\016J1\307\322\263xf\3175\321\016Z\267Vt\3409\275Q\372\244gv\017\r\364\315\202\217\340\""
+	.ascii	"\375\f\036\330^\032\343\310\370\245\317\361N\344\254\f\2107,"
+	.ascii	"\306+\275\003\337\321\263\262\2727lY\264q\2556\332A\353\302\210"
+	.ascii	"8^\3063\1776\276\350\266\334\374<\2167.\333\347\177\276\210\213"
+	.ascii	"gu\317\373<\020\027\2367~\017\317\017\2158+\223#\322pC\375t\354"
+	.ascii	"\240u$\324\334\370\030\306\217)b\314\3709c`K\350\331\350\374"
+	.ascii	"\215\327\371a+\fPK\316\353<\220\333\253\204H\004\234\317\371"
+	.string	"\037\2677\254\370\304\307\371~\315\232\276\370C\"gep[a\2108\302\207\"5\357d\341\213\3678\350\025$31/\336\3053/\270BEh\343_\t(\226,30>\255\002\305\022\026\363\342\233\236\371\245\211N\342\022i42G\255c\007\305\222eH\343a<\323\346\231\276up\267=\363\261\371u\f,\211\264t\246\346i\274\316\01745\277\003\346\2652|\232\347\341*dan\303\226\3547\374\030\263\326\205~\266d\303\307\031\003CB\257e\230S\343\222\211y\031\275\026\206\030\324\267\201\330*\353g\224\314\007c\216H\343\2330uUb\210\\\370\255\245[\2076\242=\003\322\322\242\251o\323\265I\3324\366}\254\032\372\031%\354\362\003\346\204\n\325\243N\243@\257@\t\326\370\027\317\354N\376\324\207\340\213\312\027&Y\202\377\342m\374\203y\225,}\217\325\017~o\205\311\362=\265\356\302\245\003l\264\300"
+	.ascii	"\t4P\300\rV\207\024\224\362j\207\023\217\247\"\026\007\022+["
+	.ascii	"\254p\221td\245\246\240\254X\002X\b\032`Y\226\206\225K\307\224"
+	.ascii	"\225.\216Ge\322\021I\311\202\351\310*\227\216&\224\216\310\252"
+	.ascii	"$\"\263FU-\222\216El\nV\271B\305q\206W\256\212B\356HZMY\261\312"
+	.ascii	"\344\324\016\036\311(\035\034$Y\266\352\n\311#\031\305\262\037"
+	.ascii	"`\200|\262JR\261VUP;X\004\234\244\256\f\310\300\351\t\003'+\031"
+	.ascii	"\017\234\244\236\2566x\2422 \203\252$\016\013\256\252h\246.\220"
+	.ascii	"R\225\tdP\225\264\372\361HF\255QW7\224\311\251\005\236t$\251"
+	.ascii	"\2368H\016\237\244\240v(\243\234\200\354\204\004\265\303\t)\005"
+	.ascii	"\225\214B:QU!\221\212<\245\301\023\025\322jj\212\n"
+	.string	")d\313\352/\302n]\323\2257\305.\353\227A\357d\346\016\242m)\036\351\221\257\302H\217$rz\350\251\257\323\245\360X*f\036\371\375\316!\245\237\342\225gJ\340\3369?\361G\217\342\273\212\273\320\343KN\0170\352\3533\210\365\330C\201u\364\301\265,\243?\361\375\\6]Kf\364\335\002\236\0209\031\336U\232\256\335bnGh\231tyj6N\274,a\205\226>}&\247BJ?S\364\026\210\205\025}\273\265\002xB\240\244E\201\342\032\351\304g\202\347\237\233gj\361\374\263\376\3223\331g\305s\372\023\300+=\223\270\336uw*\324\303\342\371\267\364-\236\311=I\317\351O\351W\364\004\337q-\214\236\035\351\362\206y\220\272.\013\002<\273&\332\346{\356\343\302\333\037\255\227OW\336Y\217\213'J\241-\301\004\365u\247\330K\364\353\230\020\270\264b\330\027\021<\321\006\340\375\316\203x\t"
+	.ascii	"<\023\331\316;YK\367\220\204I\020F\257\026\205"
+	.string	"/\365u\"F]y(\330i\005\201E\250a(\345\224S\f\215\210\210H\222\244\220\016Q\005\004)\350 ,\017\022`u9\2505\243\241\315\306\376\033-\007\212\323\230\302\333\360#G\307\344i \3604\261\333\361\347\361\222\026\203\356\031Y\312\004o\254S\020r#3T]\n\304\2501\327\262\351s\2174<\230\267D\200h\272\277\307g\353\327=\315\036\202O\227\036\215A\227\332\3529\022\b\022\307\220<\235\305\273$\237\212,\321\314\305\261\2245\307\313\346\216\021\ncC\373\003\b\006I\017*5\026\375\013\221lYS\341E\305\230M\016\230\242h\\\220f_\234\037\361\005MW/\250 i\0248p\004\361\306\246}\366\ti\361R?\306\241$\243\340\035*"
+	.string	"\275\245;t'\002\336\375/\242|.\204\023H\242\026\223\033\326\226T)\245\331\235\2001L\355\002\244\223H,\275\370\205\225~\2659\361/\027\2117\256\034hy\223\272\303\325T\304\017\377X\350c\006T(D\206\303\305\216\017,\n\314c\273-j\343W\355\320\351t\005\256\350\345\222x\246M\340Kg\002\025\247:$J\201T\223I\036\221\206w\025&\322F,\016s.hz%u\247\202\337\205\252\251\360R\211\fY\317\320\267\205\371\215\241\274\377\313q\220\361\022\311\2475\2628\006\\O\306W\235_>f\356\241\366\301;\314\351\f\003\310d\271\237\205\301V\022\227ad\262\b\037\263\225\235\341A\343Ls\332\226n{"
+	.string	"\257>\360\377\236\364%i\032\0227\224h\306=\f\330\211\177r\265\342;|\233"
+	.ascii	"\177\327\210v\003\364\315\253\300 u\232`\345\r{B.\275\346@\030"
+	.ascii	"k\222A\334\314\260\346~\325\241\343\272\270'\304\t\332\034\034"
+	.ascii	"\324\"\001\213\210\231H\270\254\367a\304VG\201\225\355\234\353"
+	.ascii	"c\356\275\257\2230r\301j\341\217FAp\210~\334V\360W\334h_\304"
+	.ascii	"\321^\024\245\277\225%+\0014\255|\r\024qI\324\225\304\226\026"
+	.ascii	"\0133\322\371B\b\316kP\023\317\267v\3075u\265:|Xo\272\0217\347"
+	.ascii	"9\305\202\225\225:\337\337F!C\312\256\021\220\337\022\202@X\036"
+	.ascii	"R\260=\t\002\331_\303\223\372\240\013\341\267\370\301\276\324"
+	.ascii	"\357\347\032\356B\370*\226\346\206\242_\234\"\371\236\335x,*"
+	.ascii	"\254~\247\270\363\31267F\210\200;~\311\232\206\341\276a\3050"
+	.ascii	"H\215+\311,\222ps_/3\241\177\237-\005\267vG\005"
+	.text
+	.section	.gnu.lto_cliVersion.318.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`Z\001\335\016"
+	.string	"\346\232dF\320\026Q:d4A\243\234@,\032f\352\220Iq$DJ\0042l\352\230\323pW\007r~\270\355M\306|\274\246\026?B\003\032\356\241g\325\333.~I\242\0358\225\342\262\315\366d/\027\2001\220O6\3312\245H"
+	.string	"O"
+	.string	"T"
+	.string	"\266\257\366m\\\207\365\035\021\027\260;\333\241\355\216\013l\240\373\364\370\025\356\263\373"
+	.string	"\356\323,{\211\\\332\246\340d\274\030\261\003\312\356~\322\305YW\226\377\033W\211\335\264\256\240\b\273k\215\335\230\270\345m\263\330\256\261_#\333\242\220\255\036\251\215\307\007\251CT\251r\034\317\001b{\216C\330p\217}\3726\334\347%"
+	.ascii	"\034\237#*tN\270\264f\217/\225-\354o\273\273\2263[\325\233\252"
+	.ascii	"\245\252U\325\357\3163\245\210\023#8\247\361d\267DM\312\376\314"
+	.ascii	" 0B\001\266K\205I\202\311\212\237\227l\231\200~\374\020\030)"
+	.ascii	";\322c\241\203\315\220TJ!\027\244\214HO\206\016\026s \032\376"
+	.ascii	"\343\264\r~\316\2479\224\024t+\341>\236\007\344X\310|f\230:\030"
+	.ascii	"\006\322\347\307\373\220\t\220d\027\366X\330\301\024\220>\355"
+	.ascii	"\031\224>\346~\320\3425\230f\3409\360Z8\257<\310\204\247\016"
+	.ascii	"\245\225iB\310\342H\004\201\302\213\004\321\013\214\013\002q"
+	.ascii	"t\340\023\211#\021K\002\023Mx\212A\201 \203^x\002?\232\260\204"
+	.ascii	"\372@\225\370y+N\325\230T\337*\225R}\241\321\365m\345\314\035"
+	.ascii	"\222Z\214(M\\\362\345\002\032  \320\002\242\242n\263\003\203"
+	.ascii	" \360\b\277\300\302\342\375&Z\030\200\341\270\227\335\323\256"
+	.ascii	"\271\315\340\235\263\303C\253\fZ\335x\241[\362\3574\006\226v"
+	.ascii	"/k\b\273]\3065\234\217A\352f\375\260\232ct\350\362\242\035d"
+	.text
+	.section	.gnu.lto_cliRcSmoothing.319.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\210\t\3251"
+	.string	"*T"
+	.string	"\023GP^R\0073S\363\221v\300\315G\001~\261\373\316\034(\023\004\006\367\317\335~X\335p\300\006 \364\336\240Sj\235\273n\2501\330X\t\256F\035+/\f\302"
+	.ascii	"\372l+>\353\263f\306jJ\266\266\367\336[\312\224\002\020\001\016"
+	.ascii	"\001\036\001\277W\373\313jw]\355-\253\235u\265\257\255\366\315"
+	.ascii	"j\327\253\366g\020$\306\b\033\3303\351\223\345\256\2768r\035"
+	.ascii	"k\005\310\273\375W\331\374\337\332\276I\374nW\305,\034r\221\306"
+	.ascii	"\234\006#\302\373lQ\377\257y\320\335\253,\264,\305!\363\210\315"
+	.ascii	"i.\322\310r\025\301\263\236\340}\355\376J~I\374j-~G\226\315\240"
+	.ascii	"P\221"
+	.string	"\345\252\002/z\237\365\352\033\333g\337\357i\237\365\330\035\315\226\251\310b\355\2219\\nndYN\332;>\376\"q\250#\f\002\177\257\333\262\353\326\261\277+a\355\177\321i\326\027\211C\235\261\025\036\342%\246\205h\037|;/j\230\006\022\370\271\022r\304\270\361\257\235\027\330\277=\201!^6\264\373\365-p\372\365\354p:\257\260,\313\301\351\226^W\2444U\330\f\247\\\253\261\353G\364\337\240z\257Hcs3\336\316\213l5z\321a\346\327^\277\230>\265v%\310\262\354::\215\361\276\363\356/t\377\t\356\257\202\363C\231\216\244yD\004\3149\331c\257\332\242\255\001\f\314\027-q\032P\234\344\235O\fI\363\310\036\244M\361\326}\346U\355\336\31562\004\264{\314DI\177t\357!i\236\230\336E[\313q\315q\237\360r.\327\300\377J\254V\341\225e\371{\260\330BO\352\033\334[\271"
+	.string	"\264\364\316$\230\376\3555\2304\017\254\016\372?\242cu{\237\275S\373\273D\033\036T\277q\367\f/\305\351\225eh\003\377(\037\267\301\277\307\263\316\241\203\376\350\263\376\0356\360\013\325\215OMK\367\271\217~\266\207\362\201\210&\313\363GA\274\363\222\201g\335E\214\320\037uV\232G\243\016\272\263\234\250\335\221I\375Qx\207\220\346\311\250{\356,\367\352S\3573\367_\345m\346\376n\357E_}\207W\355BB\355A\254v"
+	.ascii	"\256v\240\240\366\237W\273\021\250\335\007\250\275G\250\235\347"
+	.ascii	"\325\276\263j/\262\332\211\256\366aP\273\316\253]\b\324\036\004"
+	.ascii	"j\007\376\264\007Y\357\374p\2006\200\247\206\001\264\225O\352"
+	.ascii	"\334\017\324\217\317\336\331\306G\363=\333g\007\355\361\354\236"
+	.ascii	"-\355\"\346\342\331O\307Cs\305e\017w\247\241z\326[D;\033\371"
+	.ascii	"\205\212Ek\305i\306\247\343\002\354\213]\f\241\275x\347\227\313"
+	.ascii	"\362\213sa\350\343\230\344\034\313VW\220w\237y\334\325\026w3"
+	.ascii	"\206\361n\342\256\342&>\251W\370\210l\342\251Q\306;?\020\032"
+	.ascii	"[;\313\207\233\270?\356\353\365\256\206W\322\324\220\264\316"
+	.ascii	"\206~\032e\f\346\037\227\265\317\352\354\217{q#\270\337-\334"
+	.ascii	"?\027y\337\267\264\300\035\334Aq\363\220\337\006\356\217\303"
+	.ascii	"\376L,\366\333?\207G\366e\342\262wC\033\363db\035Fw\262\fup\367"
+	.ascii	"x\361\331\032\357\210\306<\332g\013\274\313\355\022m\324)a>\030"
+	.ascii	"\337F\2204o\211\213\244\331\355\356\207{\273\330\307\200; \357"
+	.ascii	"\374]\261\220\230\b<\357,o\267\373t_\264\333\3753\222u\263\373"
+	.ascii	"\335\2737\320\026\355u\277\031\221't\263\225\247\356k\273\304"
+	.ascii	"F\006\034y\003\336\344\264\004\245\204\301I\303S\005\250\246"
+	.ascii	"\245\341\333\372\221R\311d\375@\024\3211\305\262y$u\264\242:"
+	.ascii	"N\035\370\371\021\323iu<\340:\274\342D\224\021\fA\251d:\255\220"
+	.ascii	"K8\231b\351D*\301DCN\270\231tJ-\225\260\323\n\005\325\022L\364"
+	.ascii	"\343USQF\013\242\214^\307\240\324ta\211\003\354\324\004t\036"
+	.ascii	"\233\260\022\366\360\004G%\235\310\2443I\001&\n\340O\025\240"
+	.ascii	"0,Yp\035\206\220Dq\005\005\303\023\236`\242\237\252\f\311\251"
+	.ascii	"c\323\202\212'\023)\216\302\243\363H\301\004\325\362\204\223"
+	.ascii	"\311\234\342\200l\022\223TK\251\250)\244\353\310\005K)d\022\325"
+	.ascii	"\3628\225\204"
+	.string	"lV%-0:\023E\262\231\344d2\233I\301\252\326\257\3626\223\352\205\325i\355g\221M\227a\251\001\322{gmdM\357KW\331\363RF\034\213}\f@\323=\372\206:\fk\017\253\315;\35338\020\320\336\222\350\360\275\320\376\034X|\332F\334%\264y\236\324.i\276\246\212\264\215P\327\300\2023\204\206%\347\2355\031\323^\220\253\r\212\021s\005\315\001\330\017\247\275\260\372\002\200\263\250a(\304\034e\210F$\210\202\024$I:\240\002\021)\243z\021\360\250T\016\242\221\230$\017\331\024\232\023\240 \030\326v|\016\\\327\255\267~\340\243J$\317@\200\267\324cM\375s\322\331\005\023%j\035a\333\256e\267\334M\376\245*_W\013h\037\021eB\323C\270\025\263d\2453\301\244@\026!\242\rg\016\376E\330\227\231\224\0344\377\221\370=z\253\347\360\201\242jH\272\234\276\367&$\237{\f"
+	.string	"\250\325o\220\327\235\\0\222\004\210\231\200\360\006\210\316m>\2154\034X\377N`\001z\b\374\271g\304\033\031\240(\022$\0361 \355\250\300\"{#\\\224d\037\001\0013\301\034\203P\321\311\251\267\0170\362\026\306\002<b\354\324\263?\2213\302\232\3137Y@8\253\f*\020\261Ev\372"
+	.ascii	"Y\364\244\021\202\356\304\n\237\330\377\244\364\361\"b\004\275"
+	.ascii	"\017\033\007\376\246m\354\341f\221\374R\367j\325\202\032}\231"
+	.ascii	"A\022\357\316\013W]U*k\031\320\271P\274\324\227\320\201\331\244"
+	.ascii	"\035\353\323\310\261qw\325<\270\327\353lw1\213\371)\fF!(\r\312"
+	.ascii	"\346q\004\203r?ra\353\t\330.m\031\345\206\235\3079\320\202\346"
+	.ascii	"-Q\345\323\\#\2555\004\233\r\026\032B\025m[\364\203\313yy\213"
+	.ascii	"\203\006\373\31163\032\373X\300z\031\226\315\214|R\240\377\001"
+	.text
+	.section	.gnu.lto_printConfig.320.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\006 \025\220"
+	.string	":\346\2444L \316\332\351\323\345\001\345\367`\227\202o\023\022\270\033\342\212\"\252\006\032\350\006\213\3152\217\360B\203\254x\233\274\250@\213\323\310s\212\3553\250\342"
+	.string	"\224\023=\217\225\373\347=O\021*\301\264)\233\232\002\223\"\251E\227;\356\275\223L)\025\003&\003G\003)\334\2137\n\357\342}\302\257x\007\340S\250x\233pjr9o\246\317]\342\230{\311\230[\351s\2238\346\036a\314\235\364\271\221\216\271E|\356\243cn#\237\334!\216\271A|\356\017>\271\221\307\334E\237\333\20317\2211w\007c\356!\237\334B\306\334A\237\033(\347\376\331\220\233C\233\333\347so\370\334\307cnc\233[\303\347\356\371\334<\307\334\031>\367N\316\255\363\271s\216\2711\034s\343\030s\273\306\3347\306\334\25517k\314\375\236;{n\367\032\005\3640\234F\201[\364\361c\332\342\256*\233\230\312bQ\342^\334\273\270_q\277s\307\342>\305\235\212\273\234\273\335\016\350\205\003\027\313\313\215\303\321eI\n\256\263\177]8Xc\2718\353\353"
+	.string	"\264\023\332\034\352\301\230d\233%R1\250\267\251TLye\357\205\\\335\236\224k\351\016T\300H\305Bp-\375l\325=*\327\322CU4R\261\245ki\027\nk\303F:\355\266s<\317\3229X\024\367F\270\023\241'\246\306<;\340\252S\030\356\225\346\230\321\331\242\334\005tn\245;\247ex\225\366\261\265\301(q\034\347\310\350\316qV\307\335\374\315\347:\307\341<\316\351r$\364d\001\2115\240"
+	.string	"\267(5\214\300u\026\271\372\261\245\362\246x\332\210\263\202,\235\t\256Y1\245\2045\346\021c\035\032\235\021\356M\327\304q\233\222\263\035\200\353l\356\006"
+	.string	"\205\323\333J"
+	.ascii	"r"
+	.string	"D\352to\311s\267O]\315\351k\257k\210\343!lwq\334V\242\215\\g\273\315}Zg]?\266\316:\273\313||\027\373h\027\305\242ok\3428n\372\"m\333\036\365\373\332\346\215|\247;51\225XR\"1\"\tI\304\221Q\b\020\037\220E&<\020u\030\022\n\002\372\341\340\263\341h\324\320\303\223aG'\007\003\216{\323\262\353gg\373:6\247\367\034S\005\007\226;5\375e\246\022\201~yI\251\205\276LbDR\240#\355\331e\021+N\016<)\016\350ue\025\2000\t\233\003Z\311GDr\324\271\321M\n7\032\241q\031N\023\205\344\250\363\020t\016\202\256J\376\260\366\314\255N\177l\031I$\207\234\027\311\271\t@/\276&^\202\331C\027'ZS\313\035\246>\224\346Bi+2\b-\013\013\031h\032%\377(q\016J\222d\037$\276\001\311\221|4s\243g\031q\rk"
+	.string	"5\326\2109\240\227\331\252\363B\024\2147\361R!\367\030i\342U\226yV\022\206xi\034\320\213\313\352\323\225D\353G\316\260#\365\221unR\b\311!\365\034\007\364\022\013\313\030z8\016\240W\217\025\031\3071Xv?\b\311\301\303o\326#\230\0251\031pD\327%1NZ([c\245\361k\316W\0311\031p<\327\023\2038z\370\234\177h\342\305#\347\233\024q\034w\326\302\221\303\033"
+	.ascii	"\357~&\335\371L\267\020\006\001\316\356\274\027\370Kv\255\016"
+	.ascii	"\336\t\004\372X\255\363;\357:\357Q-\033|\316[\235)\026F\333`"
+	.ascii	"x\234\337\340\363b\024\313\023\t\034\306\215c\032G`\3021\360"
+	.ascii	"!\206\367<\263\206\005\263\n0\0317\216c\001:\227e3\230\260\020"
+	.ascii	"><l\235\305y\317\342l\227\260EC\251\332ZV\256\002\275\224\277"
+	.ascii	"2A\316|\371a\200\b\234h\024\030\307Y\256\325yH&\203\021\333\217"
+	.ascii	"8\333\260\03281\273\026\234\330:\013+\302\213m\320\2505\236p"
+	.ascii	"p=v\337\251g\211\177x>L@\340*\021\226\013\315mOg\221\345\241"
+	.ascii	"\341\232\032\316\"\201\205\207w\211\206 \300\306\316lx\262.\202"
+	.ascii	".\022F\3554\270\227\320\352\300-\366E\355x\374\214\003\360[\256"
+	.ascii	"'\2657\317t\3136n>\0379[3&\032\315a@v\372n\347\226\223k\247\215"
+	.ascii	"\027\225F;\273\234P\252\324\3471\005'\216\242/\027\232\225 ~"
+	.ascii	"9u\034\355p\241\031:\202K\361L\316\2206\025\214O\246\341\311"
+	.ascii	":{y\373.\304M\020\250\375\f_\326\330<\273\234`Da.\324\023}\360"
+	.ascii	"\235\340\374QT\026\304\205:\225\210KQ\217J\343\261\006\240\026"
+	.ascii	":\351\251\341\377/\345\217\205 g\276\b2e\027\343\335N2g\221 "
+	.ascii	".E6\252\222\215\026DezHN#N$r\205}\324DC\032\217\345e/\030\336"
+	.ascii	"\361\270\205|[v\"\370^u\232\336\007\272H\027\265\313yz\247\337"
+	.ascii	"JjY\034Oj\235\236}\237\363\n\334\326\312\270\215\211S\022\302"
+	.ascii	"\224\212\224\333\2558\2358\241d\327j\267\342\030\340\372\226"
+	.ascii	"$\032>\037\2533\226;\375\177~rF\030\027"
+	.string	"\345\361\314\325\f9\216`\260\020\201)\324\306\316\223u~8\307\3163\027\315\205:^\376$.E0\035\244'\265M\377\364\003\f\366=\021/&\330\345<Y\373\234\033\357\n\365\332\340@\360\275\272L\337\364[\376\037\260q\262\271qH\316\232\360\017\342R\324\201\241\307\223Z\246\207\340\275\354\214L5\212\3023W\035\347\311:\313\025\352\255\335,\360K=h\333\342\227ybX\006~\231\007\267\262\370\337+\314K\362+nd\025o\342\267\262\\a\22627\216\306\227z)\264n\032\326\261\266\254\253\223\320.\363V\370\354$\264\371\2560O\232\335Ih\231~\253\204\366\201w\nCTt\237\314\230\343\357\346\207\2640\343L;\021\350Ts\241>\245\305\341\001k\323\226\201\207\013\235l\n\270P\217\302\200_\356\243\221\204e1\250\202\205\013u&,\370x\342\262\236\353\223\211\361\025\017\013\2668\021\350\200\013\365\262\025o"
+	.string	"\327\013y\324\346\223\246Y\362O\326o\253\342?ps\201F~\241\205\262W\3610O%\312\342\030\352Z\022\270P\007\202\344\354\002\337M\201\005\331\265T|\246\026\346\305\211\2065\036\253\273\355\231\237\254\333\277Z\255V\373\207t{\f;\026\357\016\374\316{\203\247\b \3606\367\007\214\271\033h\301"
+	.string	"\213\025*|\315}\001c\356u\261\235\211\037B\344B\016s\247'z\017D\333\252\276=\241PrE\017O\246\226\275\312Oy\022 \020\310;\257\355~\243\257\tj\250P-jQ\314\210BH\001\223D\312\231/\035\236\254Wj\241b\027\241\366f{\323#\210\355\020\326\006\214t\032\200\2630}\"\352\021{\233\256`\372\236\205\227\253\017\355\355z\300\203t\317IW\224\367\013\307\273c\205w\007R\340\223\207\362~\351xw\354"
+	.string	"{\303t\030&\0322a\322b\310\203\030\0254\322\351\332\307\345\225\274?\376\217K\2227H\003=?\356\234t!y\311\306^3#\257\231\b\263W\341%+\362\232\231\031y\221\244Q\313\2108\331\206\204\304\250\fJ\247\253\032\337\017y\231\374\033\337\330\353\304"
+	.ascii	"\017b{L\324\204\274gP\3364 o\032S\231\364\177\274ghoZ\232\332"
+	.ascii	"\313vC\310\331\2170gZ\007\243\030\0250+\217\275\007{\335\036"
+	.ascii	"q\257{\351y\274o\253\317a\232\256\035\357\334\033\367\326\275"
+	.ascii	"\216\267\316\250\354\277\036\205w\356\245{\353\336\272\327\356"
+	.ascii	"\3053\363\345\225h\230\202\327\023\220\207\260*\033\351\364\323"
+	.string	"\350\375\215\267/\373`y\353Z\233r\275zo\336\333\367[o\337\321\233\360Z\257\336\313\367\366\275}\257\337\373W\245ve\327\362Pg\332\rPX\025\215t\372|[\236\306+\350Exq]\\\323\347\033\346\375\362\n>\326+hT\375\370\r\363\216y\005_\301\227\314KX\275K4t\033lZ8\341O\221:\274\207\357\231\350c%r\260\006\261\303g\020\\\313z\325\3444o\"\232\214\370*\276\213o\365\255\266\316\016}\333%\254zD\252\266\346\314\001\274\347e3\360\363\251\344\035\3025\376\307K\030C8\332e\3400\021\201\203\231\020\216\232"
+	.ascii	"\207\205m\301\\\212CJ\202pWQ\031\214\303\205~\022\037h\235\305"
+	.ascii	"8\301~\334\330\006\327|\020#\3253\352"
+	.string	"\221V\326\023!XG+\364y\355+\003\302:\250\331\013\274\003\f\016\363\321:+\364\t\230\035!\341\022\007\005\275\013It\247\017z7<[\324\213\362\210\321EE\2201\254\315\364{ 9\353~\271\0058H\016S\346\327\007\217\345\242 l\350\332p\201\213\220\301F\366`#Ge[\262\036\\\304\f6b\004\t\254$\3210\321\360E\356\340\275\205\234\005v\222\321x\013\335K\031\013\f\345\217^\342\350\350\246q\034\023\340,\036|\326\256%\333\301t\"\352\362\025\370\f\r\246\243K\203\325\252`\324\f\262k\311U`6\327R\006Kq\2419\013\222\263@v\310\237\007\202\337Bp\370\237wB\267\f\007\277Q\311op\334\034LW\327:\313\341\213\236la|\3540\310ml>\357v\202\307\337\360D~\306?\252M\013\215\317|\262\201A[\313 k\370\316,8\331\216_\330\376\242\3449$gs\262\300y\006"
+	.string	"\211>V\007\371\f\326#\2403\224\274\002\314\267\366\301~\255_\353\254\006,L\316\363=O\024\006*\315\360<\357\3216YN\232d\370\033\257\260E6R\265\265\tr\347%*X\016a\213\203\322i\236\202\024\035U\245\304\020U\245\344\320l\037\221\032J9\245l\"\221S\311*\251\027R\314%R\311\\Z5\225\314\020=%\225t1\203y3\203\351\316`\276\250J2A\210J\342XU)\251\254\2322@\210J\026\365\f\031\311U\031\265\244\362"
+	.ascii	"\212\331\004\345\"\250o\032\006\323TRj)\365\3231\222Tk\303`\232"
+	.ascii	"\301lz\021\343\330J\246\f\253\244\322\205\333\334i\244N\267\r"
+	.ascii	"\203\2519\3240\230\232\254`\274\220\232r!\324\030v\2203\244\250"
+	.ascii	"\2500\354\360t\363\b\211\323m{+GH6\227U\310\236n\276\250\222"
+	.ascii	"\262\262R6\221\310\245\0252\311\224\361B\312E\325\022\ni\245"
+	.ascii	"l*\231I\215\324idTU\222\212j\t\205T\302\260BZ1\223VM\240\256"
+	.ascii	"ZJ5\231\312\021\334\017\330nF\341\364\324Trm%3IB\0243\t\003\247"
+	.ascii	"\233m\307p\233\251\264j&\251n\254\222L\234\031\312\250*\007\224"
+	.ascii	"SR.\226\314\t\242\244b\3600\2253\244\250x\254\246d$](W4\247\222"
+	.ascii	"2DP\3560\255,xQ%\025\225T60C\352i9\002S\3314\206\320L>\305\240"
+	.ascii	"\222\021\3456\253\226RV1\2267Q\312\251\017\222U,\224Q\313'\030"
+	.ascii	"PV\311\017z\\\270\220Z\261\214j\225URSQTP7\r\305$5\005\325T%"
+	.ascii	"\225\244j\202b6\233\230|z\031C\311l\262Z.\231M9mY\276\306?\344"
+	.ascii	"\006\021?j\326?\033)w_\3319\241\2607\210\364Q\237k\034\307\261"
+	.ascii	"\223\215+\274\237,.\224\025\364\201\267\326\270\312#*\273\322"
+	.ascii	"s\241,\226\240\033D\330L\320\035\222iz\262v\022\263\242\350)"
+	.ascii	"\fy\3421\225X\372\022cV\2545^\372\237\261\271:\272\301\"b%\224"
+	.ascii	"V%0;\017C\346\306\327\022\211\021O\342\235\215\342\210\377y\316"
+	.ascii	"YA[\353\303\036XbJI\017'\275\203A\343Q\215\362\310z5\272\226"
+	.ascii	"\220@\022\361H\237\353\324\244\021\361CcsphkYGF\177\364\271\356"
+	.ascii	"\214\031\243\037z\316\275\241\255\r\031\236q\031a\350\242I\363"
+	.ascii	"e\227\304\347e\\*f\005\210t\212Fi\320yVT\306Z\341s\"A\024\274"
+	.ascii	"\352\363s\241l\2243b\340\252\210\277\277/W^\276\270P\326\253"
+	.ascii	"\017)\316I\bj\230+\304u\021\304\207\030\363"
+	.string	"]\374@\270\311!\242\255\211x\2626\341\202\021\3747/\204\3709G\361[\034\264(\376\001\377\204-A\270\243'\213s\024\017\277N\0244.5\037\276\373J0\305\177x\007\344\252\242\370\0249\313Z\340\032\243'\363\253\303v\357\350&W&\n\232\020\277\005\256\032]\221q\026q\362Y\256\b\221\256\n]\350:X\342\306\330\017\343\026\302\030\204\006bpin\202\310\357\267\373\273\253\303\366#}u\346\n\021\021Q\313L\321#\257\324|\335\323\275\225\253\304+\305\253\305\253\305\326\331\242\016\306\344\304\240}x\262\036@\253\310\343\277y\301Do\265N\023\007|\222\225\206\344\240=\361\036\377\016\025\355\2048\250\264-;\275\007\254\367\331\300{x\377s\234'h'\330E\333\234\370\006\276\263\226\231\254\\}\2631X\203EN@\202\246\250\322\330(\322\362\034S\210fDDF\222$\035b\013\020\210ba\242\206\346\001\022"
+	.string	"DA\320\223\316\021I\232\016\020l>\332\347\344\323\222\002C^k\177\376\025>\203\340\335\001\261Y\003\373\340\372\202 Q\312!\326\026\370\342\370\026\253\373SGd\352\2662\003\256^m\265\022{q}\374_\234\316\017\006`q\305\245\004R\226gt\255\232\313\352U\251A\230\b\211D\204!c\202\345\256\357kI"
+	.string	"'\250\\e\013\307\265\377\2328\204\276\276\224\005\\8z\3219\331\017g\357x\264T\355Y\\\001\270\021\037\fu\206B\013`rI\315\221j\006\267^\")z\252\267*a`\354<\272\311&B\364\t\370\0178\306\027\316+\331\203\316\037\020\333\243\254w\332\214\216\265\244F\231v9\221Q\360\030\262quj\254\313%\004G\004&y.\257\250\346\336\303\352i\200\323\023\352N=\203\337\207\205\366_\223,\2513#\024\bB8\313\206\244\306E\350B\366\"J\263f|\027H\251n\202\020\345\205\331\322y:\326\212H}\351p(H\223\024\352a\372\223Y+\352\265\211\307\230\252o8"
+	.string	"|\203\372\223\335W\244;\251Y\240\030k\003}\221\001\n$\212\232\201\021\027\352#x\314\242\220~\212|hE\200I\n\263"
+	.string	"\245\241&\002r\001r\235j\214\n\321Y|\363\005\026\261\257\316\276\035\020\353\336\216S\231\325\2057\211\371\211\002\320\375\302\017\r\242\353\311R>\035\263\316-\302\270\360\375x\276\242\013ft\206%4\237\334\241adj%\372\276&\302\361\250\227R:\341\254"
+	.string	"3\341\002\274Y\031`\035\247\205\205\301\257\331q$?\016\266\311\337\350\355*=\0213\311\022\310\340\263\314G(~s\232l\223_\363\263X\262\271.4\201|\240\247\t=\234\235\271\013S\016\244\027\2746\016\370\205\206\346\"\247\223\020\220\232\265I\030/\006\214@c\031\271(\250g\321\034\002\320X\215\367KB\356\346V\263\222z\200"
+	.ascii	"}\320\217\nJ-3\226C\213u\240\346t\2006\344\rg\017\350\2065\311"
+	.ascii	"\207\304\226\254\326\242\203\365M\312\336\013D'\355\257\2118"
+	.ascii	"\370%\204\352\315\345\363\233\252\227(\344'\207\221z\237\372"
+	.ascii	"*\325\023\331&\355x']\006!\372\242Q\240\026\243?"
+	.string	"\023\356J2&\252MId\341f\f\227-\2520\305T\031\337\317\224F\301\\0 \013"
+	.string	"\033\212(\f\215@2'\037T\021\276\002-\2640\"\221\216\342\257D\263DbZ\232\037/b\035\306o\263u@\247\356|\267V\202\364\303\237\226C\213\351l\331\236\247\255\211%\204\353\t\377[\006\353#\027\374\231\367v3\t/F$\2005S8\331\325\243\210\237n1\232\036\r\325\262=y\251\bX\355\260\023\003;H \217)\312AxWi@P\212\316\272\356E9\033\330\205\377\322\025/|\361\301C\344\207\201U\357t\276J\220 AURB\203\022\330\204\207\373?#\016"
+	.ascii	"wOh@\216\200\311\221\236! \267\241\374q\334'\313\344f\036\260"
+	.ascii	"3\323&\227\037V\307\206M\303X"
+	.string	"_\202'\332\027Ed\216\231#\223$e\301\006\337v\205M\356a\n*\032~\366D;:\266\2351\202M\213\262\230\273F\362\355\006\372\341)\333\235`\337\377\213\246\026\317\335\374\017\377-\035\262\370WJ\"\003%F\027\320\254}8\267\320\026b\321\314C\242Z\334\246?8\236\033\213\210S\222\020\373.\025?sF\374\003\210p\"dT!'h\037o\024!\204\373J\224\210\337W\3355\237\243\003\316E\363\326Y\351\333\303b$\342\307\037\020\024c\r\227\244\274\032\362\224D\017-7y<\223\351X\227\0214\336eU\311}`\300\227s1\303\326\266#\242^j\025D\353\345\260\366\236q\030\032\226S\326Z\214\031\255\266.R\253\357\202.\271%m\312Gm\361.\003;C\337oc\277`_\306\016>K!\312\0052z\355\001\274\177\033cjC^]\260\212\264\203\001\307R\247n2\213\372\325\376\343\200\207\211\312"
+	.string	"\326\025\220\251\243v"
+	.string	"u\340\007L\320\372\344\005\360n\310\3602\333h\216\005C\004\357\277\224hN\234\244"
+	.ascii	"\231\363\350\tB\313`\214\210i6\264[;~\343\312\007l4\220&^)\364"
+	.ascii	"\333\251\247\273}\023ow/m\253\006\333\026\240\216\213\0274\321"
+	.ascii	"/s\027k\301^\212!\017\035\200\257\304P\232>T@\356\303\233\260"
+	.ascii	"\321\025\3058\212J6\036#\337\336\262\227H\2076\211\203g/\310"
+	.ascii	"f\264_QH1\022\211\371\"\b\262\0231\260\r\3470\r\273b\256ud\227"
+	.ascii	"~\b"
+	.text
+	.section	.gnu.lto_cliDump.321.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"}\007"
+	.string	"\242\01655Po3\006 y5C\251B\250\330\312\004\351x\206YP\252m\201\030\214j\034GJL?`\254\261\2636\300\314\f\021+\2209\235S\373<\216!\"B\244L)\234\217\326I\360dW\263\215\326\311\346GC\360\314\214[\230\233L7\005\0167\031\266\215\233\230\360\246.\301b\246\220\307\251\004!#JE\215\243l\033\034\242\277\026\230B\032\247\222\204\364\332\320\213r\2435\365\377\225`k\221\035)\257\220RXT0|a\362S\274\270\034\245:\351\300\264ul-\342\221\316\242\007\007\374`\310\350\017\rJ\200\271j\350\214\345\n\263\200\345\252]K\222\037=\343\262\370\230(i\371?%\207;\307\2566\211\001>\220\347x\035\374o\374@\025\256t\333\201\266\232\266 \001\t"
+	.ascii	"\357b\310\304\363\275h\306\005\"0\352\022V\263\032\035\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_cliDiff.322.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"e\007"
+	.string	"\242N44Po3\006 \315\271\027\205'\226\326\254\222\246~\020\243\024b*\252\035\330LF\224\230~\300Xcgm\200\231\031\"V \0172\247\366y\034CD\204H\231R\033\017\306Y\350\\U/\r\306\271\246\007S\350\314Kk\230\232L3\206\2156\035\262L\233\230\357\226.\275Z!\310G\240\204\234\250\024\017\034e\373"
+	.string	"\021\335\265 \374"
+	.string	"G \205\344\332\217\213\222\243\265\364\377\225^\353\220\035%\247\204\334\n\212\2063X~\213\027\227\237L&\036\230\266\216\255G\f\332\034\212p\300\357\211\210\376\017\241\004\226\247~\316P\236,\013P\236\272\265*\362\242oT\030\240\212\222\226\377Svxs\334j\223\030\240\373p\216U\302\377\306\356s\341J\267\035hk\3206$\t"
+	.ascii	"\357b\310\304\363\275h\306\005\"0\352\022V\263\032\035\356\362"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_cmdTable.323.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\017\025%Z"
+	.string	"J\213\250\037R0\326*\352\262g\264\251\226\316\f)\022\017\031\254\025/\312\361s\345\334\351\276\212\3111\346\225\215?\356\203\005\364\374G`d/\216\354\025$\362\204\310\310\373\213\220c:\246\303}\217\373\036\264\003\303\374\221\343\325\260\307\354\b\326\0177\022\325\224\3226\231\244\f\002\002\003\002\320\001\030\366\005\t\024\b\206\r1;\242\374\240\223<\250\221\023\020\013\224"
+	.string	"P\373\213\330Y)\376RQ\247\236\241\337\323I\005NaMUl\274\017\247\025\350\317\0220\313"
+	.string	"P\366G\331\275\024\376S\206\200\ry!`i\020\347\025h\214%\240\226-\002\226\354\367a\367?\360\177r\202\003\277\3644A]\300K8}i\315\230\330\370\340\313\214\017\364"
+	.ascii	"' \360E\023\022\376N\337\303+\013\017\350\013?p\372\372\311\300"
+	.ascii	"\005\252\200\327\341w\340\317\364F^C\212\2404\330\200SW\036\034"
+	.ascii	"\274\300\300\001\b\177!A\346\314r@\201\f\375\236\204\340\324"
+	.ascii	"\365\205\bT\214\030f\340_\303\323\340\262z\031\\E\024\271\332"
+	.ascii	"\222\361K\357\203\377\013\237\272\242|\017\034C\277'W\022#b\f"
+	.ascii	"\250b\017\177\245+\\LV\240G\232p\352\352\201d\314\326\f)\266"
+	.string	"\275\263\263y\270\325\263\205:)\301\351\255\203\007e\322\004\247\227\212\035\324\311\007\237\340\364\337@A-\025' \232\003\236\230\303-\024t^\215\0344j\350\367\324%\nV\316\332\266\315\316\276\341\026N\020\2252\005\247\277\305\rJ\005W\301\351W\231i\241Q\250\025\234>\023t\n\215\221\005\324B\200\211m\321\354l\023\334\252\301\262\201\225\224\322\fp\372L\2634\032l\200S\273u\006\307\007\343p\200\352\226\200m\022\370\262m\230\235\025\303-\2311\035|\200S\333\346\n\007\266ef`@\370\240\b8=\272\201Z)N@7[\nT\001\271\355\302\205\004\023p\232\202\025\016\033No\334\344,@\205\205[-Y\212B\234z\220\004N\343\324\002\035j\251\200s\240\224\224x0`\005\200\331\227\215\332Vjg\215\340\366\bR\205\254\004\003\017\f\246J\354\303i\r+;\206~OJJ\351\n8]`f_\325\262"
+	.ascii	"\263\257\332\002\n\273@;Tl\252PR\342ac\260\257\032#\252U\350"
+	.ascii	"*b\2120\320\2320g\023F\202S\240\251/8>\b$\204\023\372B\006\323"
+	.ascii	"\230$?\251{\267X\361\313\005\b\324\244\352T2\364{b\202S\240\245"
+	.ascii	"\263\tj\251\252\346@\271\356\021\373\"\261\273I\360\233\005\313"
+	.ascii	"\351\344|\202\323\237+\250\320#\370\347\315\354J\321\007\177"
+	.ascii	"\324@AadU\331\331zQ\331\267\312\356F\361kE\352\324\203\177"
+	.string	"\256fE\234Q\244\340\364\347\311\fj\307\007\177\232\246\2409\234\252\360\300.\020\373\006\261\273B\360;\304\225rR9\253\340\364G\310\215rFY\301\251O\236\013\305'8\205\342\262\252\366\304\224\354\313dw\233\360\353\344\0076>\234W\250p\352Se\t\026t\306\013&2[\367\310\276M\273\213\204_\247\036:\300>Rx\360i\232\375N-\037\334\202S\231\023V(\231eu%\273:\334\035n\021\231\026\2271[>6\354\213\303\356\002\341WH\220\022\313\316\344\240ev\003\032\365A\331\024/\350\013\030Li\240~R?7\335\027\206\335\215\201\337\031\256\f\262 ~\234q\260\214i\366\002\t\037\224\005\371\202\302p\262j\003t\305u\201\337\245\313C\326\343*a8a\334\004M\261\255T\025Tt0\364{\302Yb\236\020\252\263_\212\335\337\341\237\007\017\006c\347$c\006\247xI\024\030\310y\006\355KVt"
+	.string	"\370\340~'v\377\004\3779/\007\327\020\347Lsb\3414\026\005\234\030\2345vX\254\311\342\337F+\266\206\315\231\325\006\247\261,o\354\004Pf?\023\273G\303\277\2114\261\25138\034\003\302\314Y\347\203\261\246\023\016:\203\312\352\316V\213/a\370\213\271\212\025\231\2019\343\f\375\236N98\215\371\240\203Z*+<[.^\211\375U\273\007\362\357\362\\`{\254\316:X\n\234\302\350\314\266\240N\037\204\241\271\203\306Z0ai\375\244\206\246\366_\331=\025\177,I\330\b9\204\fJ\310\244\231id\263\223\275\314\311\236\013\315P\314\274pw]\346#\235\217\354GfY\206\275\n\352\255V\243F\rq'\325\310=\356^\356\246HK\322#9\332\362\215FM\213$\247\331\362\255FC\364\205F4[\256\321\0207\r\204\n\253%\251\243w\237n\347F\022\027@5u\351\252\272q\233Z7\206G8"
+	.string	"\352\255\246}\274P\007\355\202\232\346\341H\263\005\340S\263\356\255`f\261\207\244Q\326Gf6u\231\211\262\251u\n\324\233\356>3\034u\273\264\001U\244\315\313W\315@uL\352\272k$1$y2\237 S\227\272\313|\202jH\244\021-\327\220\302qsZ\256\211Z\367J3\354\270\356#I\035]\227\264\\\323<_\247\221\261Z\372\200j\t\253\245\031\232e\336\225\241\311\002\327\221\334e\327:\362\016\362\250\f\252\270\b6\017G4\356\220\023\341zI\024\201"
+	.ascii	"\225\354\351Nd\222d'\372\251\366\212E\302*a\267X/v\t[\306\232"
+	.ascii	"\261k,\033\353\204\215c\353\330(\354\024\226\212w\341y<\f\377"
+	.ascii	"\343m\370\033~\310\023\371#\377\373$\257\344\237<\020O\304Sy"
+	.ascii	"+o\304gy-\357\345\227\3701O\346\261^\315\273\3717O\347\241\370"
+	.ascii	"\255\327\363V\374\236\333\343\372\2704\334\032\356\220K\344\032"
+	.ascii	"\271L7\t\005\367\351>\271S.\021\327\210;u\265\\%n\227\353\345"
+	.ascii	"\222\271e\256\232\tnP\202S\210\013\212\273f\337\254\335m\303"
+	.ascii	"\357\0337BK\256\226\320\0176'\221\017\026\301i\320\017FP\353"
+	.ascii	"\204\252\n\013\312\314\276gv7\r"
+	.string	"\277XM\004)A\023\024d\306\304I\346\203@\301#h\016\252*\254_b_0\273{\305\357\230U\353\306\260\347\020C\2319jn\226\276\034bx\253i^\210\353\332\0345\216f3q\232\247q\243/W\372F\037\n\025\311\027\272j\251E\022\267u$o\324\264\\C\362\205\264\374@\205\325\362\bg\206F9\314\235D\240\212\243\316I\331\354\241Y\002U\244^\204k\r\017N\030\341F\356d\346 \204\033\371\204\021r's\342\270\215\2626\303m\356q3PyF\267v\235Is\334\231\200z\343d\267\301j\321O\345i\221l\300\026Te\006\324[\0229\332\204j.\267\305W-\265\316\201\372\252\271\307}\242\213\332\202\356\241QRi\362|aN\213,\344\033\217\027&\351\036\356\020{x\224T&%um\226!\267MP\315\215\244_\025\327R\347j\020\350\\5k\236Q\270{\250\303E\275\331b\265\354\351"
+	.ascii	"({\272\f\243\366x\372\350\305\242>Po\342\316\035\027\346|c\310"
+	.ascii	"m-j/\344\256\332\265\330I\\\217Qo\265^\310i\273\310\207\343\261"
+	.ascii	"\3325\217Gvs$qd\307m\236\365\221\231sd\0267\f\030\213Zn\236\020"
+	.ascii	"\347\244Y\372p.`\265\223&\311M\255\023\262\345\026\265,\352\225"
+	.ascii	"\334\247\226\270m\226\233s\022\227C\270\361\201\214z\263\341"
+	.ascii	"*\216>\262,Z!\344\365~0P\325\274\235#{/g\255\033\252\267\032"
+	.ascii	"\222\026\307M\263\371\264\340\205#\271\315\260\353\036\231u\343"
+	.ascii	">2I\222\227E\270\236g\025\251\307j\231\013K\336\016s\031\251"
+	.ascii	"\023\315\250H\035"
+	.string	"\327\262g\236\0363R\227Q_\325$I#\335\2638\206Y\353\bK\026Eb\211+\231\0337N,\201*\001\265E\255A\024\201\341\250q(\354\034S#2RP\220\024$\255\001\241\005\3040$\225\255\007\021\320<\246\2341#M\322\001\300\261\213\236\364\3076\2130\030,\320\202\310\017c'?A\356\213\357K\221\356\322\311\376\357\303'\227\b\311f\237\017\017E\232\240:\236\203K\271x\333\2006\005\301\177\266\327\237\242Ec\317\3513\2007:b\214"
+	.string	"5\306\305,\013\305~\356\204\022\224P\323\313\364|\017\"\234@\377\360\211\221\342k\\\030|\032*\036\267\232\303\347\225\335#Z\006\215\023\270i}\307\305\346\314\037"
+	.string	"[4\2672\203\305jE\302\027Z~\347\255\360\203\305\215\021\302\t"
+	.string	"u\274\352s\bp8'\274\363A<mc\266!-e\230\024\336\016\327\236\340\333\225\357n\027\300\242\f\004\331\237\236\243[\023\026\225\240\222\320\2378\3079\n\3657G\350\262kA\264\031\2520\352/=zD@\263\030\200\025\217\333d\225DE\242\3623\333Y34j\034\313\216'\223\201\251'P\257o^@\243\300\016\371\002\325&z&\002\315y\377\345\356\237p\2325w\234\241#1\342\231O>\350\211\016\333\35462a\340y\231\316\311\257\236*\032\307I\016\243\260\340\220X\242\026J\r\215\025LC\226\323\244N1\024C\022\275L+\276 \372\256T\315\200IS\355\251J\265\217\2106\257We\277[e\247\2479R\205=\265,o\374\361\247\365\336\350!.\320\215\355\345\300W^\226\031\327\220\210\200\227\261\241\371\236\033\033u`\324\260\2047\\\315\332\274\017\201\233y\013\317"
+	.string	"oP~\235W\272\013\276\037c\320\302\215S\\7\003\321\224\365\030GB\203\2417p\2656\334Z\270rt\255\235E\203C\362\253\250Ba\036/\303\020\334\252\003-P\005|\2569x\320(\027]\304\211y\270\244\f\022\351\334\256}\346;<\213a\263\013\016\210%35:\303]g\314-\033\033\2276n\335DoS'!\227Wc\372a\235\350v/\307M\257x\003\210.rg\316\023\034\252\2136\353E\264\020\217\262k\364\320^\361\2554\335\017\037h"
+	.string	".E$u\267\246\203\353\216Y\027\242\b\3721r\337*mE\f\r>\3046\025\226\277\257\217\347b\247k\211q\247\212\361G\210\353[\305Q\255]\260\307\340L+\007\331\324\335\361P\243\3235\317(Z>l\n\353\306\302AVD\0219\202#\230\303\013n\b\305\260\321\246\023\253\375\002\306\2500\177\260\344\252s\356\202X\013\215b\366Xm\013\362\301\260\272\260\f\3356z\224\372\366O\202\002\215\3663\253\371\b\240S\312\271Zt?C\255m\f\022\321;ZE\025\223_\r\320)\006\370W\256\fLI\026\234\216\241!\035\007h\n9LS\314\337\343\021\216:\b\361\r\034\\V\266\326\323KS\021\036\220RD\347x1+\021\234\2460\256\303\220;\016y\263\\\001Kx\377]~\2175,\220\213Ib\005N\314\370h%\301T\304\363\210[h\311E\366\265\"\204j\004\032X\232\205_\3340\247F\355||n3"
+	.ascii	"\234\320\006\216Q\2416\204\032<\006\337B\241\306\200\022\361"
+	.ascii	"\3705\255\b\017\221\262\033B\273\f\n"
+	.text
+	.section	.gnu.lto_cliHelp.324.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\313\002\375\024"
+	.string	"&\245\207J\240\024R:\004^#KX\031\310sB\232\245\374\241\303z[\214\373\373\253\034]^}MihG\217\305\314G\373\377^\006|\356\344\236_?\361k\360\016\254\303\3734j\001z\320\372t,\257\347\225\237\213\271/\371\204\020\271S\nt"
+	.string	"l"
+	.string	"s"
+	.string	"9\033\310V\254J\004\013:\262\023E\244\326:[\024Fprx\2374\367\330\t3Kri\316\177\272\004\341\326\220\037P\367\030\371,\034R\357!\"\210\204\220t\304\304\243\347\t\037\240\303F\334\334y\361\224\007\350\243\345\317I\222\305\207\016\026'@\035\322\300P\t\252\022`\217\356\213'\231\022\372\t1\341\003t\n\213Pk5\375\001}n\222\333\026\332~`S\252;z\\//\243\254\335\240=\324Q\031\210\034I\336#[v\342M.\365.5]\352\237\254t}A\r\375\352Xk\210\243\221j,\265T\234x\373C\277\370\342P\271\023s"
+	.string	"\354\212*\312\317\224\320/H\255C\005/\275\340|\331B\276\304\366\251}\027o\312\335\351\303Qj=j\201U\353\360\305\007\316\227\036>\305|y^\200\371\322\001\001(\335G]\353\302"
+	.ascii	"\256Z}\377a8}0\t^\33224\226\236%\"\243\316\352\350\217\307n\007"
+	.ascii	"\271A\3336\223\356\215\370\243G\213\330\236\271\f\333\n\222\325"
+	.ascii	"\215\nW\025\335\023\236\225\224\t\375\3325\r\364?\307"
+	.string	"\024\365Vg\273\3461l\005\270j\3555\260\355\3410nX\220j\3559\220\372\024\216|\212\227\356\200c\376\367\322\307\331\027?\301\310*\352\313)\306\271\304Hd\246q.-/-f\355365\232\f54\230i05\032\332\314\246&S3\243\335p3\230\024\3336\314\334f\034l\266\333\254dX\225\376t\224\236\245&\343nyJ\261\r:\206\t&\333\222\211\232\347^'k\255\365\334\340sLrek\322%\274a\303G\202G\217V\2416\205\n\004z\226\204F\336\352(l\267\030\25407x\365\265\360\0324fl\225\260\f9 \320\002\2311\352\006O1\242h%ZA\302.\032\020\362%\365\272\303\224\026\300\bn\350X\337,\0020\303\310\255T\344<\2261\004\362\215,\007<\336\006w\016\006\021\222\263x\276dk\n\206\025\021\3667\317l\355\222\337\330\243\022\016C\324\fvw\314>\324\262\344V\356"
+	.ascii	"\302\212\264\305-\2649\355l\2055?m6\001a\021\333\254\365\030"
+	.ascii	"\260\206s\214wq\245(m\347<e\257\026>\001"
+	.text
+	.section	.gnu.lto_processCharacter.325.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`N\t56"
+	.string	"\032]\300\024AP\246N\007\255\252?\357I\305\365y\nxQ\225C\325\f\233\237\020\233\373\232#\367X\374\300\230\"Z\343\177\377\002Q\240\b\210U\237\246\002);L\033g\234\217\215\377\322\377DF\2156\331{\247\224R<\001!\001>\001vyn\205\356\205k\320*'\200k\343\332*\333Jk\253-dfwf\t\024\332v\363\301\177/\331\2333\367&\037p\024\333j\313\334\347\357\231\273\344'f\326\025\246\320\275w\352\245$\350\024\256\231\310\354\267- "
+	.string	""
+	.ascii	"\246%cQ)\t\351\310\2108,\022\006\201\354oU\323\367\226;\350\245"
+	.ascii	"\325\002\002\244\022\310x\231\031j\351\243\326j\3136\007\320"
+	.ascii	"ds&+\276\324V\305\215?\252"
+	.string	"\245\005M8g\334\372\312\276\332\272\230\026\200\302\244\257\325\226i\351\223\035^\027t\331\346Jh\235\204T\3665\245\217\032\272<S[\232\271Q\332h\354\346\032\272d\222j\250\002\245\255\235cN4\020\345\213\254\207\r].Q[2\361\242\037\225\263\233\210SL\316\237\262/\262\026\242\245OjK1\017\n\275\272\034\230~\234\263MC\227J\322\f]\330\316:\256\r\250-\2238\373\243\212\362\025\326?\017\353\025\254\325T)I\231;D/\256\324\301\035,J:\356\207\247)\003?h\006\031\213TQ\n\275\222\376\320%\225\364\351\336\333]\332\205x!\335\177T\367^v\245\327W\363\200fnD\314l\202\3717(\026\306\370D\231\034\252y\315\312\255\306*X\347)\247\320\275[u\235\006\005wZ\253\254\302\312je\321\302[\351\364\235\027h\013^\237\237\037\257\305H\316\354\342\205\267\222\223\020Y{\203\207|-\256"
+	.ascii	"\265\233\222>\223;kM\277\327\376\375\323O\357\272\216\f\377\325"
+	.ascii	"0\034l\037k\323\373\377]W\035\322\243\335LDtA\376\231|\265\366"
+	.ascii	"\303\220\313\223tC\314=\246\311\\q\247\261\214\031\336\312V\271"
+	.ascii	"g|w\351\036\242\027\266\345Qf8-\177&s;]\037\230\021~(\314QP\007"
+	.ascii	"\372K"
+	.string	"\263S\273u75\230fc\321\235\225T\347$\2413\222\320\371hu&\006\235\207@\347\"\326Y\250:\007Ug\240\352\314\366\\\363Ou^\177\316\352\352\234\256\316\277:\273\352\334\017.\350\211qcs\212\235=\036\270[$\212\350\342\251uV\032L\367\\\367\227~f9\3560\355d\341\334\016\277C\232\334$2\247X\034?\020X0e\016\232w\013\330~\343\216ca\253\334^\032\256\355/<\250\220@\356\226\223\f\315\317E\305\377\275\020N\211\315\246\263\270\f*\202zc_U\224Y\241\245\274\337\233\030\333\263\322\306\350\231|a\3120\352\325<B\336P\325dV|!bZP\325\204\274{\271\0025_\353%\335P\305\336\313\005\204k\346\263\266Z|o\223\213\223tC\375&\017\311F|\246\322Z\374\250'\2325\357\bqeAz\324\375mm\r\235!\233\206\372V#\340E\337b\332\217\225T\336\036{"
+	.ascii	"\341\255\204\372\366j\362\203C\364\236\021\354\275\311\n\334"
+	.ascii	"zV\224`\323v\254\255\026\275S\235\347^\337\333\031C{@\212\236"
+	.ascii	"y\\\231\271F\347\035\231\314\360\264\263Q \237|\330\370\006\\"
+	.ascii	"\241\302F\370Lv \373\217\027\250i\206\345^\260\002_\b\360-\214"
+	.ascii	"\365\301\203\026|&?\365q\025\352%\335\020\215\256sd\357\275\026"
+	.ascii	"\240\302\227:\2533\212F\243\321\276Z\331\017\376\357\311E\366"
+	.ascii	"u\364\304\221\001>\223\256\331\367\2629\354\033!\237w\232a\335"
+	.ascii	"\351\275\367\262\301\273\306k\306\331\3731K\240\260\371\255\353"
+	.ascii	"\333\375S\tH\3755Q\277\261b\3358\275\372K\310\247\035$\236\271"
+	.ascii	"5\244G\023\240y!\2446\217\325\351\003\254\300\204\210\016\037"
+	.ascii	"\024<\2618\221\342\311\001\007\022\033F\214(Q\365D\302\252\004"
+	.ascii	"\211\020$T4\305\260q\365Y7\216X:p\034\1778\372\252\371J\n\253"
+	.ascii	"\306\325\324\r\254\0276\246\256rdMI\031\371\210CF\216)\035\307"
+	.ascii	"c\216)!\334\005k\252\255G\202\t\210\340J\317\3342i\235<5\275"
+	.ascii	"\322\307h\346E\273\022m1s\0177r4\372\027\202\263\261$_*\001%"
+	.ascii	"}\027j\346\021\302\340dk\023\240\363\310\351I\255\325\201\001"
+	.ascii	"\350\2670\306\207EN\217\3030\315\300a\222\323X+\322W5^c\255G"
+	.ascii	"\217\364\315E\326\364G\377\353V\322-\311\262\024\355\2535}\033"
+	.ascii	"\343\263\"w\207\004\254M\317\330>y\021\200H\033\022\001P=D\212"
+	.ascii	"\3174\323\304\317\341]\016$\253e\266R\274\225\255\224\265U\342"
+	.ascii	"\377\236<\243\315\260\006\356\267\331nm\320-\347I\253\242\231"
+	.ascii	"#[\264\226\312\026Bx\\\257\225\246\364L\3561~\211O\236\210\330"
+	.ascii	"\370\266<\232\264\300[L'j\257\024h\261\260\\\023\024\264Z\332"
+	.ascii	"-\304-q\360\222\257\005LB\237 A\271\361y\370\214\242I\362\265"
+	.ascii	"\270\364\241\266\013\216\341\267\263C \237\203\232o[\036MJ\243"
+	.ascii	"\313rD,\006\200\271\250q\034\205\030d\n\221\210\214\310H\322"
+	.ascii	"4\006`\002\221\241\253\342\001\020H\210\204&I\322\001?\270\200"
+	.ascii	"\267rtq\307\201\331L\205I\320\021}`\300\013q\364\033T\232L\006"
+	.ascii	"9\200\366!\325\212`\310\255u\367l\273&L\230\020\007q\374\372"
+	.ascii	"\202\241\305\251\263\306]\034\320!\343\035\262#\300\2440S\243"
+	.ascii	"\302?\201\342\247\230U\222\234&\007&\323\363\001Ts\004\326\003"
+	.ascii	"\314\027|\035\232\ry\013\026\305\206\325'=?\315\226\331\322h"
+	.ascii	"\213\\\003\342 \273\266\315\326\252\357X\260\314`\206(\024\340"
+	.ascii	"%\306\r\372k\304D\275vuT@G\351\006l}\364\251\204\025\202\360"
+	.ascii	"\244\213\275#\360\241\200\004\202PfA\013&:t\304\0260\271\365"
+	.ascii	"\017\207U\324P\300jH\017\222\315\313\274\227\343B\005)\t\252"
+	.ascii	";\311\260\027\344<\237\264\364\031Va\355\300\270\237\013\370"
+	.ascii	",v\337 '\354m\264\177rR\315\202x\017\313Q\\\304\2017\224W\257"
+	.ascii	"~#\242\332\335\002;\370t&\257'}\266\203\327,\324\002jnrt\212"
+	.ascii	"yF\351\234x\352\024\3437O\246\212t8\213\013\255\016b\372\223"
+	.ascii	"V\372\212\231\001\256\364\367\334?\325\345\220\206\327\246\271"
+	.ascii	"\250D\315V\275\323\036\200\027\006(\303\204\311W\017\025\274"
+	.ascii	"3\271\034\244\3460\270\356\025xM\330%\372\b\017\272QQW\034\331"
+	.ascii	"\2622\036o'g6D\353L\375:^#T3\234Q\370\306\006\222\026d\3161\332"
+	.ascii	"\341Q\275\275n\201\310\361(5"
+	.text
+	.section	.gnu.lto_processCharacterInteractive.326.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\372\f]F"
+	.ascii	"\332u\\\032B@bR\007\243\373\261d\315\356\027>\247\025\345\314"
+	.ascii	"\f\324\002\353\377\240|\312\017\200a\301\327\357\032\251\332"
+	.ascii	"\320/0\356\375!\375\242_\324\225[\335n\\i\312\343E\001b&\355"
+	.ascii	"\356\225lm\357\275w\222I\006\227\001|\001\225\001\257\016 \373"
+	.ascii	"\233t#\354\257\353E\330_\037n\255\0274X:\032\020\375\363\034"
+	.ascii	"\306'n\236\273\020h*\331\337\245\326|?\307\315\323x\352\304Y"
+	.ascii	"F;\317s\325S\331\233I\236\215\232\250\003\270\313\346Z\370.}"
+	.ascii	"JJ\231\214\202B>951-\035\225\214IE\244#\243\"\242!\"\325P\030"
+	.ascii	"\224c\370u\177/\265\013\275\266|JJ\371\206f'\335\250\261'\200"
+	.ascii	"^\027us\223r\350\234^\215\236\331QP\256\225\020-\230\327E\327"
+	.ascii	"\\b\240\023\217W\243j\033I\304N\367\372\304\244o\376\344^\251"
+	.ascii	"\231\341\342\352v\213W\243h\333)\355l7\275\205\331LV_\332V?f"
+	.ascii	"q%7\026\202\304\314\353\242f\356U\240\037\271+\3338E\212\305"
+	.ascii	"\223b,\3544N\237\230\024\213\027\263 y]\264\212W\243V\366\221"
+	.ascii	"s\212\326"
+	.string	"7E\n\346FJ\330\251[\237\230\264\314\213\310\252\321'\233\210\314MV\243a{\310\215\220\026\246\314\353\242S\367\307`\335\270\233+\253\321\262Mt&\230S\325E\313\252\3214{\350\372\0329f\274.\352\304\235`6&\306\335\272\266p\212\264\211\007\225bR&.\273\007\364pi\342uQ&n\221I\032=^\215~\3558\t;\265\322'&e\342\260[\300\317\232@F$f\317\241Ws\277D^\316\241\227\220\355\306Xn\356E\260\323\262>1i\023\377\272\250\03079\317\263\247\371\206zq\355\035c\315\363\254\367\323K\352\032\200k\275\355\264\326\"\264\026\246\005\357\373\233\303I!\3173\323\237\332\335\370\233\023\032E\212\355\317\024*Vl\177\302\357I\2404\177Kk\315\302\347\\\310\363\334\345@;\033\fY\362\225\037\260\277\357K\310Sc\356\255\266z\367]5\316B\314\275u\007\264z\341\275Z\260\325\223"
+	.ascii	"\373\263\362\177\376HY\343>\025\316\343\264\264_\3211dl\177\372"
+	.ascii	"\253]\006\354\257\325\273\233\273s`\177P\302\322\276\230CF\346"
+	.ascii	"h\371\247j\037\360\377\213\253^\327\016\324\373\375\3777\035"
+	.ascii	"\247\022\n\373\277\2143\350@\340\002\357\357i\256\301.\233\275"
+	.ascii	"\336a\345\270\366Vk\266\255\375T\255\275\311I\030:\375cZcQ\220"
+	.ascii	"`\345h\356\005\250\246\244\224Ios\035\005\345h\\#\367\326O^\306"
+	.ascii	"\265\223\274u\223c]3\311[/\311[\037\345\255\225\366\326\306\341"
+	.ascii	"\326I\302\255\213\361\326H\362\326G"
+	.string	"\362\326F\362\326E\302\255\211\342\255\207\342\255\211\302\255\207\361\326\302\340\326Ayk9\336:\336[\303\361\326/\274\265\373n\375\357\326\373\335\332-\370]\335\235\276:0\317\273\233g$\333A3\335+\227\305\333\334\313\270c\335\321\270\253\265k\355j\332\307\270\031?\343nz\210\346Gr\353h\236\307\254q\f\260[\212\026\355\r\002\371\352d\226^\346\007\026\327\220\231I\275\262\346i\007\260\311\332\327\234m\351mZ\356|ffJ\007X\365\330\320\264\363\314f\300\003\037\266?5\362\310\031\027\272\256\337\022\242\255\005\026\237\252\235\236\351]\357\252'\343!\342\005i\215\037\375\216AG\037K\311\336\001\036\031\005\356q\371\215~\217Y\367\330\031\276\326\032\207kk \005m:+\237\273\347\037\274#sx\214\236\252\3353~n\262D\362/\265p@~G\256,\036m\322k\300Zk\021\356\247F\024\331<\317W}\252\310"
+	.ascii	"\025\375\236?\377\270k\301K_\364\033\317\312\007\333\f\333Z>"
+	.ascii	"X\212\236J\310\265`\371_\354J\247\301\225\356\f\021\020x\370"
+	.ascii	"O\177\200{"
+	.string	"\234m^CO%\372\341{\365\n\003\b\021\361\207>\316\323\354\302u\307\201\370\017\312\324\230\236\207\006\020\355.`\177\207\357\320&\314\217_\370\336\354\"\177\360\335N~\252\274/\346\336\336\001\021\213\260\313\326\261\252\351>\352\0206\304\247j\367\340\022.|T\302\251w\022*\237\351\241LSmwfm~vC7(\365u\234oS\301\344Ga\247O\234p\017}\240\027\304\372\267\312\353\021%\224\310\220\017}\363:%\022\340\315ss\216\323\t\341\216(!\317s3\310\346z\017\366\027\371\256\004\354\217\312uN\327\016t\347\247\352\035#\221\342\374\334\034\201\247^\352\241\332\215\225E6\2776|2\362\265\013+?\371P\255\223^\204\221\217\365CZ\253\036\\\263\013\327\336\356\340S\365\240Aky\362\217\311\271\022\3145\357\241\240\231\273\213\335\260\371\305\266\226#\313\352\301\006\034~\017\244\264\335\017ZN\312\256\346\240"
+	.ascii	"\202\002\025N\036\026\250p\032\352\017*\234\206^\0307\262\276"
+	.ascii	"\307\016\027=x\350\200a\340\210\241\303\235\341Y\256\263\022"
+	.ascii	"\314\260\221U\205c\206\213\033UY;xT%0\352\034:b\354\250\352\221"
+	.ascii	"#\307\216\252!\333\354?\246\261\230\3175\225`?\275\326K\352\222"
+	.ascii	"J\201\177z\030V-\234\2137FD*\312\262\354hEnz D\347\177\256\265"
+	.ascii	"\366\260\303j\034\2472\240\246w\342\376=\377\024m\267\333\255"
+	.ascii	"k\301\307ozG\263\366\351\343so\336(\257\300\004\371]\365\336"
+	.ascii	"\256\2533\371T\275\335\023\344s\347\025\345G\307\265d\211\305"
+	.ascii	"\270\314\"7'\364\3555m\036(\342\0040Ag\304+v\002!\005lW\333\322"
+	.ascii	"\024Ix\333K/\271,\2750\0359\203\243\351\006\211yr\363`3|_N\307"
+	.ascii	"\017r\3153r\364\300\225\375\003\374j\"Pe\211\302k\367\030\365"
+	.ascii	"T\017\325\257\364\027\352l\250\322\033\313\276\334\265 %[[&\252"
+	.ascii	"\247\360\233\314\312\007\327\f3~2\351\215\357{\305O\372\262\207"
+	.ascii	"\324\220\267\263\370Ev\331?\253\034so\267^\223\232]\322\372\311"
+	.ascii	")\244\344k|\307\371\2659\202d\365Q\017\325~\244\332Z/\255\313"
+	.ascii	"\2634:.%7G\360L\222\360\332-2=\324C\365;\375\256^\355h;M\314"
+	.ascii	"\244\306\247\306q\250\227\360\017\305\272\347\246\331E\271\203"
+	.ascii	"\256\333\300Z/\327*\020\235\205\241\203\332Ho\002J\327o\355-"
+	.ascii	"\013H_$%\273\007\370st\370\276\222\240\266\277\3716\303q\203"
+	.ascii	"\334\274\022\320!\201\024\250\2010\244\024T\210dDD\264 I\322"
+	.ascii	"\030\321\004\3040\t\255\\\017\021`9df\322\244\315O>@\313)\357"
+	.ascii	"\025g\210R\243k\231\201\2277\3174\334f\224\320L3\317\271=\247"
+	.ascii	"AZ%.\263\264\342GO*\254\326\363\303P\265\326s\340\240]L\202\263"
+	.ascii	"\034\327\375\340ZyI\032v%?\262r\034\251o\204\274\001E\332\245"
+	.ascii	"u\016` K\341\326\002\271G\2715\346\257@\317^\032z_\rJ\212\261"
+	.ascii	"+h\254\023,#\201\350\215j\001\304\314\271\342\361\373\013\325"
+	.ascii	"\351\203\320\277\366:\325\2756\356\322\226=n:\375C\313\221\263"
+	.ascii	"\326\273\326:r\306R+\241E\031;\355!\350\223\206\r\213\270\207"
+	.ascii	"h\242\n\320\256\246@)\223\002\354M\r7\031\n\351d/\312\204\307"
+	.ascii	":\003\316\277\202\367\346\304\337bCR\225\221;\345S\244w\222\245"
+	.ascii	")\211\377\254=\331\rU\032\211\030\376H\2737\b\013\306G\313\230"
+	.ascii	"\020\372\241\333\212\243mo\307\026\277\307OG!\217\034KTn\260"
+	.ascii	"\240\355\202h\275%X2\206\274\364}\304\350\b\305\036\030Q<\355"
+	.ascii	"\201m"
+	.string	"\336'&\032\032e\355{\311\177\300\247\303'\347\335\341\244\377~\260\261q\345P\343\202\222\001p;r0X\374\324*\343[\252\224\032\342\226G\211U\221\321\232\242\272\211\261v\321\0074\025>\367+\200\n4\021|t\\\320\3110\2456x\214\342778C$y\036F\271\375\213\2107,\372\274\023\311\325\304_O4#\2679Tqy\334\215\335\001\026u\372\315{\210\301\363T\303\005C*\374A\207p\031\026\fj\207\234\373\216\344\036\314c\245\374$Io\276\201\326\274\202,\340\353\367\"\022\006T;\342\220\354\301F\202~\366\364B 8\006P\b{X\030\261\303\355\036*l\300\273\371[\rG?\342\334\324\032_u\350\177\313\325\036\204(\367\372\351A##\005\3119f\3605Ya\272_"
+	.ascii	"\262\242\261\347\226\240e\362\002\\\313V\257\203M\f\361\232\303"
+	.ascii	"\310\271\306\205\336\260\n\005\350>X\316\332\324i\231\270c\245"
+	.ascii	"\321\210k\177"
+	.text
+	.section	.gnu.lto_cliProcess.327.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"}\b"
+	.string	"\022O99@s\322\001 \267\223\317\370\377\213\360\316\350\340\225K)S)\312\022\352\005\023\351g\2725\222\364z\257\bP\024:&\271\243|\201@\032\233\357~\004\317\321xk\204\020)S\n\346D\035\211\223\035\211\223\017\335\202\203\344\276\b)\032\260\007\321\360I\t\317\373d\2505?:-*\333\324\236\240\320\213\336\r\021H`:k\323\366e`\301I)\314~\312UL~\211+Jz\361\232_\332\256}\317\272\302*\306\345\245:i\314n\205\272\"3/\036/o\210}\365\265\202\036\224\225\217\273v\346\334\210\361L\033\215\306\304\366C\006\355\034\002\213y\361\001\321\300hq\3159\345\216\200\n>[\005}\2001|\006\352\370f\007*\230\232\200\021\225\t\334\234\254\316\272f\214)\325\317h\316i\025G\216[\273\355\004\333\006\266e\002\017"
+	.ascii	"2\003\302p\301\204\245\032h\f{\375\264o\240\350\201\301\b\305"
+	.ascii	"a\273\214#R\201\274\f1.]SM\323\300\024\024"
+	.text
+	.section	.gnu.lto_cliEnter.328.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\324\001\035\022"
+	.string	"\206\342{I\320\224M:\250\341\1778\365fy\333\325\023X\232D8"
+	.string	"\237\002<\006A\201`\214\376eP/\350{\265m\023\013@8\022\353\361j\201\250\336\233\245i\330\017\374%c\344\302\004\031\313\261\n4\251\213\357\373\273\265\264\333\336)\005_"
+	.string	"c"
+	.string	"j"
+	.string	"\224N\3179\375\223\003i\361C\210\315\347\267\333\356\210\333\221\255U\246!\023\333\237\366\211^4\336(\347'\273AEK\273\345\212\025\250^]\036\205{U\235"
+	.string	"\367\352\321\016b@\304\356\244N$\241%\025\331]\217\252\370\3709\372?:"
+	.ascii	"\262'\366\231r\331]O\262\207\304Mo;\305\366gO\227\244\217\343"
+	.ascii	"9.\370B\257\306\300b\265>\272\200\307f\242F\2431\007\230)j\273"
+	.ascii	"8\314\223\256<\266\0225\035\032s\212\372IW\312\261\001A\356\025"
+	.ascii	"\001R\020\320\217\317\217\303\3715n\003\307\027r\007\330<\371"
+	.ascii	"\352\303\270\327\006?H(\200\210\210\310\346"
+	.string	"\315.g\223\246\260\217\332\3355\r\262o\364\247\3524\n5\035)\363\345}\2144PV\354\356\234\034\213T;\336\352\325\036\217\034\f\260\275\250%\230(j\277@\230'\335Q\212\242\247%\221=\206\233\224\322\025Z\323\3140w\212Q\355\352\264\370<\336$#af\206{\235\364\300\215'%#F\324_\372\216\020\276\220)\320\320p\257GB\016)0S\364e\005\013O\267\023\367\362:X\252]\331\003^\335\324|\033V]\bv*\257\320\203\370\205\035(v+\321\365\341[u\337\r\b\261S\3712\2002\035L\204\007\235\206\227+\374\304\327K\211\200\0261\004'\324\260\\\341\007+q\213\305U\323\362^.\226\215\327\na\036\013\212\301\233/\364D\020\f=\223Rv\036[\217\232\214\316X01\230\366\350b\034\"\252\315h\314\253\351r?\302\340\3541\306(cF! `\002\021df\007\177\fAh\036\301\335"
+	.ascii	"\342\t\306\270\211]o|\304\270\006I\301\262\335\271\004m\177\223"
+	.ascii	"\345\262\365\370\254\205\nc\204LLh\177\330y\301\305\245:\037"
+	.ascii	"\342n\033\202\237\035\357\001\243\023%\331\026u\263VX\315b4|"
+	.ascii	"y\321b2"
+	.text
+	.section	.gnu.lto_getValueOffset.part.0.510.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`C\001\245\r"
+	.string	"V\032ZB\020\221\223\016_\225\024u\001\270\204 \363\364\fj\004\320\t\001s\301\357WZ\201\336\b\262\212\224\226Y\213nh<\034\301\350QZ4\020GP\004\240\024\b`p\234@\204\034!\303\004\tB\366\336R\246\024H"
+	.string	"D"
+	.string	"I"
+	.string	"\376\b\314Yr\244m\263\355\207\270\210\2163\002\024>\037\020\020\026TN\334\330\345\254C"
+	.string	"\377\210\207y\001\361P9<\273\346\313\374\324V<\327wO`\302\245\206\266\222\341\231\371\233Fv\327\224\206\033\3366\002\333!\366_\004\351\351\245\343K\303\227~0\255/\235\207\371\357\221,\005`\354^(\345X\021t\341\301~\207\331\225\335\261+k\036\006\373\013g"
+	.string	"\267\0306k\332/q\256\363\027\316\003\354\216f\264\330\345\f\034\032\204:4G9Y\262\352\323\253\354\250\322^\200\222\327T\037C\004R\217\355\353*\034P\273\023\016\370)$\244\370\035\016}N<LU\300\302\002\007\211O\226P\330\306b(\322n+\332\220\303w?)\306E\206'u\244\266X\337\337\352\310~\001%\020NH\"@kDLN4\026\003\023\022\024K\263I\261D>|5(\331X\017\256kcU\266\363ou\344w\317d\324I+\330\2364\025\264\3026\226\232GT[lCM\215\2526B\033\036z\026\237B\2154B\037@\001\036"
+	.ascii	"\332\343E\337`\037\023Z\363\002,\3601\214\270\205\217Y\254dl"
+	.ascii	"A3\306m\215]0\341k\232\341\021\344\3416@\024\fs\205\203\254\305"
+	.ascii	".G($\204\316y';\355A\273_\t\271y\\xZ\210\324\024\232\227^[\306"
+	.text
+	.section	.gnu.lto_restoreConfigs.part.0.512.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`_\001\255\016"
+	.string	"\326\033bE\360\260(\035\262\304\361\2361\021\313x\262\272\021\223\250\3331R\003\261'\203y\375\216[!-\177\256y\303\335\264\325S\b_\325\242\240\327\247\222g\340\031x\nd\305\373\021:\225\003[[\321\340\306\266\275\267\224)\005P"
+	.string	"L"
+	.string	"L"
+	.string	"6\016\bkS\006^\025\036\214\270\261\273\333\241fp\224q\261\211!\343b#\343\257\2735Q\207O3\242|.u\230-n\302\337\353\260X8"
+	.string	"\340Vo\2046\273\271\354\271\302\251R;<Hxz<vHv\327\036\nw\347\266Ol\207\330\237\t\313R\313\331\013\360\246\303c\277}?\366\020\276\314\237\232\323iP\022\244\333\b-\207\3715\276\210w\250\323\240\bX\030{.\347\3652\333\355\n\034z\200\347\320\335?\342\241\347\036\361\360>\354d\177>\207\007a\373d\343\274\203\331\026\243\002f`\212o\035\372\246xx\325\034\261\027\253\244Y\377vwU]\266\th\352(\246\301\206\312LJ\326\f\363j;8\311\267|\331\017\201\304\212\031\216\331JS\326k\211\026,.\325e\215#0\264\231\025\203\235\217\335\357\274\327\206"
+	.string	"/\033!\2234HD\244"
+	.ascii	"\264-\020!(\331@%\323&\362a\222I\202\322\326\200D*m\037\333y"
+	.ascii	"\022\225\246@u\205\242\237\342*B~\214E\243\034\301\376\\X`\361"
+	.ascii	"\241\206*kO]\356\320\242KL!3\016\320\310\324\353\212\215\302"
+	.ascii	"\344\331U1\361\023\244\367\230\303  `\202a(\355\257p\334\245"
+	.ascii	"\261\360m\311u\016NZ\r\205u\353/\233)\325\310\306\226C\3372\310"
+	.ascii	"\255m\021\355\316\201\275\322\356\261qi\201\277*\340\206\301"
+	.ascii	"\005\013e@\350.@\270\215\262+p\306kd\256\306\365\247_\033\306"
+	.text
+	.section	.gnu.lto_cliPrint.part.0.513.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\037\001%\r"
+	.string	"\006ZXA\020\221\223\016"
+	.string	"\342\344\221G"
+	.string	""
+	.string	"\264s\tVx;"
+	.string	"\202\265\343\314\3200\026d\322[\315\337\033\212\337\020\272\035TT>,\032n$"
+	.string	"\025\212"
+	.string	",\242\3200Mx#\304\267T\n\316,\331rK\231RE"
+	.string	"C"
+	.string	"F"
+	.string	"\366Ul{L\254\331\247o){\026\247\220\211\306\356^\327\374\340D\355.Q5\037E$\221;W\201JB\b \2218\016\224K\313K\307\021\351\203\031`\004\206c\346Z-\330]c2\334\357\266\035\330F`_CO\321\352\320.\321\211\337\356[\032\003&vKR5\326\203\266\210\260}\373%\217mYF\374\346\371J\207\300\266\027L\214h\377\304Qh_\351|\300\356\211J\213\335-\301\325\0070Wo\327\274+\346\231w\r\027\271"
+	.string	"(E\354\247\270\211\343\2030\006\202\027]}\220w}\t`\203K\315\303\b\275|\322\245\232B/\037LY\301\237\230/]K\260\314\260@b\004S\316\247\n\027 \022&\212S9RP.\316\023\373\333_=tY\b'\275\331\360\220\260\271&x<\370\2706\031\347\332\320\030\243"
+	.string	"!\273B0,\273\254\347\210sZ%\312\350pB\314\347\310\356x\231\f^\220 \312\376\212\n\035\357\274kf\003\226\030#\016w\273\273\231(\266-\324|iG\370\300\032"
+	.ascii	"\357bb\206\301\261\325\314^\254E\235%c\204\201ac\265\253QuB\357"
+	.ascii	"\235+%\324\322@\204-\347\200\262G\243/\022\226\316)\207v\006"
+	.ascii	"\260\231\274\323l\320\032\016&\256B\327\322\364\023\312\030"
+	.text
+	.section	.gnu.lto_cliRxBind.part.0.514.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"M\f"
+	.string	"\226\225QC"
+	.string	"Q5\035,\301~\206\263N\275\276\341\300(\03337K\3252\256\375\220\214\340\3100Bm\374\2040\341u"
+	.string	"\\6Z\353\304\345\344a\005i\245j\355\210\265\0345\202\240\223\0374\035P\275\242(v\333;\245<"
+	.string	";"
+	.string	"B"
+	.string	"\365)\333\036\016\036m\033/O[\022#\226aE\216\335\345^\251\210\217\2473\033\375\351\302A\236~\365\254\204\313\005\213F\213\016\243O\221g\225\003\273k\315\303]o\333\200\355\004\366\033\004\273\033b:\226Ta\220\270\352\366Ox\374\225-\266\257\362\274\354`\250\206\375\204\020\360\3529\355\243x\212\361e\347!\273\245\021/vK\002\257>\321^]\376By\325>By\265<\366\230g\235\305\206\344\264\033\272(\324B\003"
+	.string	"\274\332\0238\024e\242\205\201\222\256\323\266pa^\344\327@\245Z J\252\320H\033\340\365c\306\250\204\275\310\271cR\223i\366li\311\316\252\214\033  \002\336\266M\364*|^\347\211\230\002\n\034,`\200\211"
+	.string	"~\031\360C`\342\201\237&\263\351*\356\266O\323q\340\007a\303u\"\207\333.\016%x\"G!\fEn>[Z\362\203\017/\330\353CA\224\232\354\033"
+	.string	"\3561\256\026ym\005\306\3039\017\344\254\031\003B\220&@\215\201\344\357u3V\001\242`\230+\\\261\tQ\027\025\\\177O+E\265\323\271\240M\227\235\013"
+	.ascii	"'O\346\r`\203\315\246\236P\306"
+	.text
+	.section	.gnu.lto_cliRebootEx.part.0.515.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"}\n"
+	.string	"vRD< \005)\035`\222P\303\344q\220')\244\242\211M^\030a\321\262\202j\323\317\342\3408\b\222e\003\033\007\2417f\227\020\024\300&\237\206\002\266U\005\006\361J-\024[\311\336{\247\0243"
+	.string	"0"
+	.string	"4"
+	.string	"\006\034+*\324\260:\\rv\267{\235&\017?%\r}\021\216\215j%~^\366\006\224\233\232j\005rIp\032\300\260\273\356\204\334\365\266\027l#\330\037\005\340\307\324g$\364j)\355\257\234%\374\230\262\300n\211\f\314\356(z\365A\347\365s\317\366J_\260\275r\257\207\331\006m\332\307\223\375ph\323\002\276\300\220W\371//\232\331\306\024[l\203\240\016\3505\364\232\231\2112\200\234.Oz\272\263eOIK`\355z\324"
+	.string	",I\215Iy\354\366U@_f.\026(\023\304Gr@y\336\203\351\033pit\212(u\023'\222DW\372*\272\221\307\036\205\351\353P\236\367u\234my\272\263e\016&2\313\230\032s\272lo\322\267\330\034\031"
+	.string	"\332\343\r\255\300x\340XA\256\016\2415C\300\270\242m63\243\003\242`\230+\034\256\t\241GK!\030\270\007L\270\247\225\242\332\005\253;\027"
+	.ascii	"N\036\314\343<[zB\031\003"
+	.text
+	.section	.gnu.lto_cliRxRange.part.0.521.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\013\b]-"
+	.string	"ZP\260\021Ip\032R:\253\256\273HF\217\372C-\320\215\334\214i$\323>\"W\212J\305\036;\004\n\334\237s:\0347\363!\360&\315\225\315\262\240\203\356\006ar\241\332\246HnT\243\351\243\354\032\261\251}\331b3\322\b!{'\031\377"
+	.string	"\377"
+	.string	"\t\001\277r<\226\036{\236\312\247\001\215vAs\316\016\330\253=\351\203\353\2514c\\\237f\214\234\254\226\277\274\212b\201\346\314\364\271\332?\354\325\266\357=s\351]3\0020\363\224\262\357\355\276\224s\035\3375\343:9_q=sf2\270\332\007\330\253\315<\317z\225}p\275\332\375(\335\275\324\375v\246VV\366\261\373-"
+	.ascii	"Tfz\020\335BV\231\3139\013\257\342\254\037\357\273i{<v\267\252"
+	.ascii	")\276\277c\377y\003R\302\232nY\226L\367\335\024h{YN\262\255h"
+	.ascii	"\257\212\247\246\244Z\242\354q\331\013\231\372\361]\312\2236"
+	.ascii	"\344\314\325\224<\322\005Vap\264K\344]\323\366\306[\333o\211"
+	.ascii	"L\037\234YF]\365&\2279\236\246A*\260\266\337\022*\375ic\322\343"
+	.ascii	"gO\027\247<RH\222WS\372H\027@\305\342\376\374\255\261t\272\027"
+	.ascii	"\370\337\216B\316\271\337d\365\306yw\307u7\220\356\035\213i\306"
+	.ascii	"W\335\275\333;\275\333\301\336m`\357\266\016\357v\016\3576\016"
+	.ascii	"{\373\307\336\366\261\267o\330\333m\217w\2577\373\262\367n\275"
+	.ascii	"\331[=\225w\312\336\306\007{\3373\377\017H\325T\341X\345,U\267"
+	.ascii	"&\007Q\267$\271\363\007\373\275~*\277\331_\366\253\335\214\213"
+	.ascii	"\244v!D\302\332\r\300\324\232R\272\365Q\232y0\265\246vY_h[s\371"
+	.ascii	"\211\351\003\243\2170\r\250\246+\tM:\344\226\271\234\231\302"
+	.ascii	"\253\275\356\263\215\351\tZ_\216\326_\353V-\355(\355hjL\224\r"
+	.ascii	"\n\226\354b\3750?\353\326L\214\230\"\317\234\363\21020`z\f\230"
+	.ascii	"\025\366\334\232\343\300\222u\267S\306\336%\251\315\210\225\217"
+	.ascii	"\244\356o9\227\356\266a\\\254\361\215\266&V[9\347\026\006\356"
+	.ascii	"OY\352Wy\226\207\375\331\255S\213\026.\013`__=\326\303\313Y\b"
+	.ascii	"\325\023\210\275\352\265\324=O\314\274T\346\234\255\004$\262"
+	.ascii	"\234r<X\\l\255\034\232\023f\372b\212"
+	.string	"\022\327\303Xr\377a\240\307\335\207\177;\354\303\002\330\230Md\033\036\306j\303\274\270\336\340s5\315p\352\352\350\246^\\[|\203\037e\345t\353\272\207[\034tsz\301o4\"te\354\316\355.a\342>\331\327\013\016\016\315)\316\f\307\330\016cu\232\363\326\232f~\336?\304\023\255\304\303\327\261\025\027\245{Zw\370pdU@\322\216\254\030\253\tHU\275\245*\336qV!\301\352\333{l\355\341\032?{\317H\364\f\351L\177\376\347Yh\264\013\351\304>gq\215\267\257XurK\222\256\370~\201\033S}7U1N\203\223r\250R\311\2164\306\232b\325\251M\256i&'H\350>\231\342\237\035\370\005\016\n\332\365\002%\245\004c\254\306/\256\030\033\233b\236.]_\214q\213\fs\"\3334\335\272\366\335\343n\242\341}\362\342\237\263*G\241O\230\351b\254\306\277\007\315\301\202\007\017\0250"
+	.string	"\261\235\204\240G\311\250\323+\032(\031\205J\306 \321P\005\261\b\024\242h\210H\fZ!\004$\016\225\202:\f\021\021\203\214,R\220\221\261\250b\035\036\211\230T\004B\"\016\031%\021\031+\244\030\026\005\275"
+	.string	"\032\221Z\340!\342\260(\205\221\320\256\205\032\f\213\204\204\304a\220\221P\310x$l\300\323\305\026CF!R\261h\024\336\247\031_5/\356\tZ\023v\362%\270\f\356\363\213]\032G'\n\310\034\237\260Q\337\241"
+	.string	"\3121\312\237\277\r'\223\034\205Fi\321A\2377\005.\020\357\340\213\373B\035\273vC\330\242\236\254\300F\035J\301U\237\367\201\326n\013\027\356\223\235f*\314\324A\274\303\013\342\276:\030\250!\213\354\212\016\356\233D\223\203\2733\\\24657\327\345`"
+	.string	"Y\316:d\033\034\334\275\341l:\360\230\270\315YA8[\267\214\257\371\260\352\244\261q*\023\201\356j@\364\215\\m\021#\356\223G\353\325'\3214\341\340\257=\200\235\250a8\343\224R\206dFDd$Mr\220\002\021\"\254:\021p=t'Ij\324h\f\"\307\353\025\363\305\320\327\304W9\316\345K\211\357\21007\n\253\031!\232d \256\326a E\315"
+	.string	"\332\312\013\027\322\366\n\261\373\3308Ax\255\331kJ\324\244}1\022\260\034\025\275\233\241HB\263N\204\0258F\245\345\263,\257^\201\250\025\330\261\001\363W\270\"\3656\245\307\332\316\364s\254c\332\177\rC\354\244>\200\005\t\250\242\260)\243\227\033Q\236\372\215\271\375\343\314\275d^%X`\343\004\301\306\002\327\315\374\375\036t \237;\202G\361N\302\364&!f:jJ\005P\250\020\236\221,\361\266r\f\377\037,\307\360QF\036\b}\357\361\327\260\260\274-\217RS6\220\304\210\t\006\301\373\017^\246.\033\243\017}2A\013\034\026\004A#\273\35095tFR\024F\276\377}\001*(\2409\002\231\361\332\351b"
+	.string	"\332\235H\006\310\207\355"
+	.string	"\r\006*\004\331J2\363\254k\b\004\366\223;H\303\235tZ\331\002\273\252\035"
+	.ascii	"\273\242\366fr\227\3024KTNLW)>\263_\032"
+	.text
+	.section	.gnu.lto_cliAdjustmentRange.part.0.523.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`^\017eC"
+	.ascii	"Zp\314\030?@\246N\007\314\263\302\225\\\024U\350\301\035PU\334"
+	.ascii	"\350\276\207"
+	.string	"d\370?\230:.\304`\022|\254\2527\326A\350\003\356\005\370\375\202;\205\370\216\332\364\321\355\005Kg\206\"MK\215\354n)\245\024s\001a\001~\001U\025|t\036\223\313\252*\264\235\307T~A/Y\021.\r*\006\360^<\rC2\314E/\346~\323p\230\213\254\243\335p\225\234\231/\367\336\242\016\347&\343\203\333L\253i6\215\307\3056ww\220,\330\255Y\303r\224\304{\335\322\360(\f[M\343\203\225a\320kVv\357=\323\321\266\321\260\234\276g\267\201\364!\212\324w\357\2250lU\031l\344\332e\352x\370T\035\217\245\313\347\266\231\023D\323\276{\241S\2552\204a\253Evo\250\217\036\323#\nz\317\312\330\235\271\347\232\256\3551=\232\351^'wx\367B#\264\312\n\206\2552\264\223k\253\303F\256\2552w\030f\366\301l\250\241q\267\214[fCQ?\356\027\005D\216\306\314"
+	.string	"\336{\227\255>\\\267\375\224tB61-\035\225\214IE\2268\024\256j\360\035\252\345f\315\276\372))\344\200\327NS\0329E\2127Ei\246(P|\251J\037\371\224\305-q\245g\033\237l\236\364\\\363\242Z\263jY\312\2248Q\355@\226\2624\037\036p;Ck\241\362\336[4\033\363\265\371\224\241\211\271\352N\263#\035\f\"\323\354"
+	.string	")\231\375\bB"
+	.string	"\244EI\337\t\363\017&\311\2528\233O\031\225\340\203>7\213\032\257]\210Y\323\275\251\241\204\034\356\275\334`V\232\243\232\271\325\230\231\215Y)@\355T\337\351"
+	.string	"\342\262\307\315\\[\257\373N/\200c\267\367\024\363\327y:\320V\360\021\237sG\363\251P\363\342\356\275\030"
+	.ascii	"\265\224\005\367\224V\271\205\013o\247\213\357<\215\"\321\232"
+	.ascii	"\036\027/j\220\200\371\224\277=\357\007\331\225\3777&\320,g\375"
+	.ascii	"\377:\2730ux\302\274\021/y?\263\325\225\267\363_\031\366_<\241"
+	.ascii	"\373\375\033\257\203`\344\316\324I\317li\372\324\377\215\037"
+	.ascii	"\252\177:\235N\371\2350\033\235\253X\347\tFg\tF\347\245\321\231"
+	.ascii	"\212u\216`t\206`t\2362:?`\235\035\030\235\033\260\316RFg\006"
+	.ascii	"\254\363\002\243\263\202$\347\004Fg\004I\316\007\222\234\225"
+	.ascii	"\006\n$9\023\030 \200u\016\300:\003`\235\243Xg(\242\363S\322"
+	.ascii	"\211uF\262\316M\2543\023\321y\351\250d,:'\261\316E\326\231e\235"
+	.ascii	"\211D\347a\247i\026\256\252\3209\330v\315\337e\232\275\241\335"
+	.ascii	"m\"\250\210\312\361y/\331\364\321mS\337X\3516\335v\335i\272\313"
+	.ascii	"t\333\351\326k>Z:X\313m\271\307[\301\213\006\215;\023\302\221"
+	.ascii	"\351\211\001\274a\320)/\336z ?\300\234H5\327\210\315\001\274"
+	.ascii	"\027\272lu\310\334\334r:\217W\343a\006|\367\3369\355\206\233"
+	.ascii	"N\337\261Sg\253\316\326Y\233\037\331\t=\016G\316\344\026\001"
+	.ascii	"\376q\267XV\346\326\212\237\265X\336\257\315\025\2632#r\213\276"
+	.ascii	"\374\375\031D\244\310\0223x\257\333\206\326kb\037\031\237\362"
+	.ascii	"\200FC\320\334wc\006\316\334ri\275\264\224n\257\371_\234\300"
+	.ascii	"\331f;\353T\007\303\264s\336N\3664\322\271=\261\377B\244\344"
+	.ascii	"k\355\370o\2746s\r\360\355\026\340\033M\316P \232\022\200\250"
+	.ascii	"\007\020E(\020\r\352\231\3331\036d\017\310X\362\241\036J\312"
+	.ascii	"\0265\366\365S\362\237\376\030]sJ\276\007J\331\222\234^m\336"
+	.ascii	"yQrz\247#M+\"\233\036\331\344'\220\351\231;x\223\251\372\335"
+	.ascii	"\2659\230\177\035\237\351\237\242kQ\026Ag\255K\307_\372cTm\252"
+	.ascii	"t\204DTbdT\372\006\004X\300\033O\323\0011L\372\365\231C\210\360"
+	.ascii	"v\032_)\326\b+\311<\242\003I\030\265\260\341S\001\031%=+U\313"
+	.ascii	"s\016"
+	.string	"\213\337z]\250\331/~\213=\233z\315~?\345\362\344\320\210\317l\242\0251U?6[\236b\356\275\026\376T\250\311=\177\352\244\210I\324~[k\253\355L$|\342?\301)94\026\211\001\201\240\255\021\376\033\033;k\035~g\251\303#\374\341\037\243J\244c\221\226|\025\276\007\002\312[\377\215P\257\2576\331HQW8{a\377\245\376[\2234m\352L\324}eX\220\004y\254\352\253M\273Cu\202\240\334\237\031E\n\017\274\002\304\207\022\"V\226\240\364Z\240\2141\343\206\025W\r\030V\t\230\006\025\263\213\351U\003\206\325\213+\256\345\225\f\003\\V\336u\303K\313C\327\215\030Y^3\270:\300\300\262a\225\243\251\313*\213KK\306\212\3256\254r<W\027\216\217q\003\313\006\214\254+!_Qa\331\270Z\336\300\262\312Z^q1\227TI\326\302\021\203k\331\245\245\305\265,v\360\276\023\346"
+	.string	"\366M\376\016\336{\357\323\005o?=\325\355\306\355\332\"R|G\206b\235D\252M\322\246\341u\023\271\223\323\026\330'\366_q\215\372\360\222]\345\b^\3013\370\006\017\341%|\325\377\263\243i\331\204M\242\177b\355l\227\f\305\230R\255N5w\313\244I\373\026\274\317\2572\341e\230ud&\354\205\351\345Kp0M\365\313\bO\005\347\3201~\350\346\"\370y\316\321\205M=\2043O"
+	.string	"\017~\352\037\217X\026\007\377\340{\f\212\3131\245\342\230G\370\027\022B\2778^\2728xb\2378|R\337`\013!-Y\244\b-x\006W\230V\252,\350K\360\n\246\374I\211\222\340\3579Gw\340\021|\0060\321\2464\032)\256\305\002\367\344\300\253Z\342"
+	.string	">\347\350\300|*%\220\2404'\3457\211\323\346\306\304\300+\037\t\027\027-``\212,\340H@\201oi\243\246\177{\266\026\213\252\245\r\337\232\332\200'\360\310\350\222<\001\003\374\332\020]\211c\022\360j\263M\037'\001z\274H3\267T<\311\026$\001\201?\250qT\004\rBB3\"\005I\222,\007\341\005\204(\345\234\331\006\021 \245B\022\311\224\220$\226Bc~"
+	.string	"\240M\207\345\034\204\\\375\017S[\001\325\324\325\256i\245\262\334.\342:\363\225\031\2249\342\276\274@\nj\242_\304\361\261m~\312\226z\236+\342=\207|\023\0070\007\217\325\026\033hs\367b\344\007\2438D\3613\177:\263\020x\246Z\b\206\212?D1t\272\033\033\220\361\331d`\356\352\257\001\361\034\300\366\020\235\253\206\rb4\341;\b\360&\003\037+(\331\255\310"
+	.string	"H62R\262\342\306%w\301`\370\266b\354\376\r\3244\344\250\021\017j\364Z\202|\227\367T\204l\250\256\310\331\312z\213\376\235\030\322\221\301\b\311\037\r74\301\341\214\320\202\207\337J\362`\271\224hB\306\342\t\032"
+	.ascii	"\372\020\200K\033\360\025\317\274\037\340\223N\365\035E\022+"
+	.ascii	"{\fNA\376\335\261\221\231!\300Xp\210N\376\333\342\270&\335]\350"
+	.ascii	"\315\262\r\370\362!\233{\353\227\203\003U\271\370\304Hz\217\255"
+	.ascii	"\341\346B\202\257\243SsT\334y=K\033r\224\344\2129\375s,\201\254"
+	.ascii	"Oe\225o\274\200%m\203\375\003\315\212\rD\355P\360tC\214H\324"
+	.ascii	"\"\212\177\3024\310\006Y8\022\346\006\345\217\3171\3175k\355"
+	.ascii	"\220}#\257.\230\271Ik\204\263_\204q\211\314\035W\376\375\345"
+	.ascii	"\"\026<\225\250hq%E\315\031h\336\300\016P\334\202\007uH^"
+	.string	"\221\333\362e\207MLd\f6\345\366\206a\200\016\033\030\2016X\244\247\002TKsH\b3\022\247\264\345o)7\006]\240\247\371\271\323z\271\357\354\365/\272Q_\013\372\235==*\312\324\217\212"
+	.ascii	"G\003\001|TU\0323\\\233\017\377\253(x\002\232e\237E\031\302;"
+	.ascii	"ic|\271\267N\250!m7\306j\220C\033\"4\221\2653\250\273\020\030"
+	.ascii	"\336\252-\246#\376F\210\n\3235\230\310\f\237\365?J\315\323_\\"
+	.ascii	"\005\320\361\2608\013\257\332\232\243\242\331v62CSsm\003\rG\026"
+	.ascii	"\322\227\240}\265\036\305:\345\017"
+	.text
+	.section	.gnu.lto_cliBootloader.part.0.524.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\275\f"
+	.string	"f\327UC\020Q\234\016 +"
+	.string	"\347\001\250]\001Vp\036-\004'\022\275\005lU>\377\353\004\354\214v%\034s\220P\266\214jC\260\366^\317\rY\325\253\206\027\320tJ\03008.!\245\221D^\343\267\335\366N)?"
+	.string	"C"
+	.string	"C"
+	.string	"\327\353Al\207v\311\313\217\355\260h\227\020\330\260c\003\324\f\016&\033\273\233\275\322\022\027Og%\372\223$\215\247?\035\202\t\223\023\222\004\342s\300\253Jfwm\205\270\353m?\260\035\301>'\341M!c\243rI\035nq\027\342M\241\357\207}\007\024(T\215\005\326+V\335B\271H\370R\204\215\"\024\274zN\373+\036\"\276\024]\300n\351E\214\335\222\301\253\021X\257.\177\241\274Z\267P^\003KI\330\232'9\214\n\006>v9N\202,\016\007\t^m\013\030\346I\377\364\013\344\006\215\021\035'\3650\255^--\331t\232\034H\355z8I\355\210*\343\304G~\221O\373\366U\204>\213\237|\215\004\356<\016\374x\330\206\353h.t\022\002\200\033\347\323L"
+	.string	"=\217\302\366\001\330:\256\263\361h\025k\030\256\243e\035\247\361d\332\007\3120\027{\237\355\313@\317\373\262\313\366|\265\264\344L\006\252\201R\017\333\005R\204\244H\002\031"
+	.string	"\332\343\355\255\300\370\325\026\004\002\001Q0\314\025.\006+4P!z^\007*\331\247,\200\232o\211\226\247 \330\347\025\260\373\236V\212j\027\254\356\\"
+	.ascii	"8\361\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_cliBatch.part.0.527.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\311\002\265\027"
+	.string	"\026\353\236M\220RV:(/\0020\263>\2103"
+	.string	"\210\b\023\323E\t\007\343\331\265\nU\00433\260F~hf\332\214;\353\275v\347\207d\255\341\361\356y\317$\365\322\322\365\374\034\267\002@"
+	.string	"\004\343\n8`t\367kw>3H\032!d\357$\003\204"
+	.string	"\200"
+	.string	"\216"
+	.string	",\353\323V>E}\272\036E}\332\375\026\335-\324-ve2\033[\330-\206\2633\223P\217`H\315 9\347\332S|u\341E\326\231\232\242\370\216\b\373+\036\232\303\213\254\313#0\321\004\365\331-\036\237\256\276\371\225\2440&\017\032\307\247\247%G\"\355xt\321\222#\221v4\272\030MaBQ\274\227\021\211&\030\303\001\344\313_\245c\321\275"
+	.ascii	">2s\220s\356\023\211x\323\336\335X\335\375\241\373\"\005F\267"
+	.ascii	"\254i\027\177\203z\346g\370\326\234\211/\002W\342\202\226\247"
+	.ascii	"\307\335\034z\356\213\027_\245\227\224\221l\214\210\207\027W"
+	.ascii	"5\0369~>\237\317\306T\335\351m4\275\215\321\333\367\312\377$"
+	.ascii	"1NJ&Q93=\205\344\022)W\212\356~\037\306\233@g\366\007 e\204E"
+	.ascii	"e\345\234\201\336_\nu\323h}\357\225B\327\nRQ\346&c\337\333}\027"
+	.ascii	"\177!\274V\320Or\246\312r\346\254ty\332\001]O\226\2159W\002\267"
+	.ascii	";\302\004\001KS\317\256\"<\\1S\271g>G\005\0035+\261\327r\203"
+	.ascii	"\263\374\311\227\227\324UB~\205PQ\356c\234\353B\201$\206\225"
+	.ascii	"\310\240\245\231\223\273/\366\233\177\322\013\312I6f\204\207"
+	.ascii	"\215\337[aW#R\\e\343(\266\335\320\241\230\005\353=~\200pB\377"
+	.ascii	"\243b\034d\372\350o\275\306O\377D\363t\356\213O\373:\352S\214"
+	.ascii	"gSICX \211\356\263\361\257\216#&\025\030W\265\202_<\304\004\013"
+	.ascii	"\375\003\366|x\200\354\256\267\223\353\360\273\231\364\216\267"
+	.ascii	"\373\361X\r:\237\\\006v\367\313\371|@[\200\226\231\271\335\314"
+	.ascii	"\334lfhll\213\243\211i!\2608\355\315B\213c\333\232\007\255\004"
+	.ascii	"\n\254\013\013\323\332\330Z\233\026\206mq-\016[\203\243\301\341"
+	.ascii	"\332\006\275\373\361P\336\257\267\263\363\351f\255{\351\355\350"
+	.ascii	"j\277^\316W\323\005{j/)\r\344\341\005k>@`\260F;\2321\325\222"
+	.ascii	"\325S\027\021.j|4\347\234EPv\264\007dV\342PN\216\304\252)6 \220"
+	.ascii	"\002\231\263\233\003\217cTH\341*eh\274\f\350\004v0\244\312a\261"
+	.ascii	"%M\331r\305\236\345g\022\327\370\256\250\3354\354V\370Z\340h"
+	.ascii	"\3477\321\357\r\016?\224b\\\221\033dY\002\0062^\300ZI\260{\362"
+	.ascii	"fD\371\001\225C\027w\307\306h\204!\304\313\234\344\335\226\263"
+	.ascii	"\255\203F\002\337\355\227\203\026h\254\305\221\314\300\020\367"
+	.ascii	";\333\350\242\2537\260m\216\t\306\t"
+	.text
+	.section	.gnu.lto_cliSdInfo.part.0.529.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`I\b\365,"
+	.string	"\332N\234\021F`\250Q\007K2@\200\200U\320\375\337\207\352!\230\254\263T\022\235\002\321\240\0272\246\262\365Ps\3038\272\0178d\306\022\016_v\253\316\277\024\267\277\306\333u\300\231t\177p3\027\346\302\332\022\262\367\336[\312\224\002\002\001\375"
+	.string	"\006\001_X\025v\340I\263\266\367\263\367\352Wy\355\376\336\342\263\270\00338\356\373K\211\341o\345\311\334\305r\205*\017xn\254\253+T\274\355f\377R-\313\316\035\244\366\325*1\376\t\343-n1x\325sv\377)O%\376'\214\027\332\273K\n\230\275\237I\257:\202\366U\177>\321\372j\373"
+	.ascii	"\326W\335W\177\314\335c\270\247\375\363k_y\354\2366\340\270\213"
+	.ascii	"\021\262\270$\311\326\366\336\275Wu\221\217?\347\342n-\273\252"
+	.ascii	"\251\316\272\330\237]*~\216]r\225\340Z5&\022<\267\254\347\272"
+	.ascii	"\372\261\022\031)sD\267L-\226]\"{\225\231\305\204\013\213\371"
+	.ascii	"+\022\267L>\327\225\217\225w\200\353\212\231\252\300,:x\270\260"
+	.ascii	"\264>M\rt\005as\227\307\364U\003M\006-\215Y\247G@\326\350p\227"
+	.ascii	"V)\321\331\020:O\366\371\306\322\230\363\320\353\330\245\275"
+	.ascii	"\267\177\325\326{\320\273\273\232\273\277qg}\001\030Z\335d\326"
+	.ascii	"\306\266j6\303\223Y\305\246\244Z\325\017\366\345K\262\315}\303"
+	.ascii	"\213aj\3676J\360\017\343\202\203?\222W\375\251\326WS\335d\026"
+	.ascii	"e\233R\225\243N \273{\370\220_\251\265j%\254\r\364\275x@\251"
+	.ascii	"R\t\020\031\323\332\2625\227\007\310\237\345\275\210\020\360"
+	.ascii	"\2657\362\225#Zd\007#\022%\362+\375\313\302\316@\215i\344hiK"
+	.ascii	"\277\354\263\316\\&\262\376\254f\016\243v\326\324\332\313\335"
+	.ascii	"\245\326\327'\256\240\031\263\037\347ew\330\227_\371\372\311"
+	.ascii	"^HLX\031\250\225.f\355\345Z\367:\032\215F]w\271\353\262\017\345"
+	.ascii	"\262\013\271\331ym\366\035\233=\b\227]\207\313\236k\263\273l"
+	.ascii	"v\\\233\375v\313\336\266\331Y6\373\332fW\331\354\251^\263\347"
+	.ascii	"5\373'\310]\034h\355\215#\nh7U1J\036\313o\361\251t\373x~a\261"
+	.ascii	"`f[\242\254m\343\223A\013\237\032\360\f{H\247\271\315)\320\210"
+	.ascii	"m\344W\016\351\\\346\034\223\213M\250\324\371#\347X\333\026\343"
+	.ascii	"X\266\310\357z\222\347\217\234N\240\354\2378\007\321\216\026"
+	.ascii	"\371[N&\317\347\337b\016\344\372\027xy\331k\037\3775\315g\343"
+	.ascii	"X\262\267\036\377=9\317\217\264\267\363w<\255\335\273\370@\374"
+	.ascii	"?\356\261\326\361f\221\271\265d7\367\202\237\343\017\304\375"
+	.ascii	"\321\332\347^\360\252\220v\233\307\334\346\017\262{\314\214\267"
+	.ascii	"\362+\205\364\2439\267\340\304Av_BZ\344\327\030R\";}@\215\272"
+	.ascii	"\350IY}"
+	.string	"/\263\362\264{\\$\006s\233G]t\1777\301\002q\3666\276\322=>\362gq\222\004q^\345\351\035\030\2323J\036\n\262\252Y}\323\256\326\351\235\376,\337&f\262\213\023\207\265H\023FN\342'\371\225\236\356\037\272\350Az'\366k\230\202\220>\247u\3106\253\261O\023K\311\351&\263@l8\355\306T\036\r\023N\254\3257\013o&>\004\376`\240\212\037|\342Mz\207\\J\b\025$\006\211C8\352m\272\320\341\raA\303\013%|\223^\002\356\004\023a\r\253\247\020\006_\004\235\340 1(d\3229\325\017\0066\255\376Nx\002\022\245\250\244\200NA\r8\235\021\317\215^\244_\221\322\257\210\305\213\364\203\320\240\250\367s\320\240\350E\272\260b\252\350ErQ\344\242\301;\004\016\247\210>\030\305\224\020\356\240\344?\240S\020F\361FM\021\2070\021\304\316U(\375\206\260\357'\325K\021%"
+	.ascii	"&\302?\230\b|j\201\302\240\323\357\311\307\272O)\350\344\353"
+	.ascii	"\t\203\360S\3177\224\352)\0219T\024p\330#BA\r{\356\247{\251"
+	.string	"J[\271\376t\357\275s\030\262\273\214?2\002\0359\243P+\264\377\034\310]\312\210\026[\344\217a3\343\277\314\251\006w#\266\022pl\221/\206\346<\223\217\237\235d\240\2723;GnY\351\231F2\317h&Y\262\233\031\3519\231\314\307}`i\277a\032\271\263\003\200\233\250\2014\305\224T\"\"\"\"\"I\222\244\003\320\002\221\241\"\035\0210\265dLh4\321\262\337\001\031\227\251*x\377\364H1\024O\325]\n\202\307l\265\013\220\260\366\340#Y\001\017\262\205\352\beq\030K\t\272\363\273\320\002\007\316\344R\246\273\302-\207dR6\243\343\222<;n\220\371B\023\337\025|\303\037\315\020\252\006\272\311^W?\"\314\3126]c0\362l\364\267^\250\244\267R1\327\250\007\252\3656z\321\336s\246\217;3\2520G\317\242P\265\254\035\203\330\b\362v\331)\202D\b\201\344z\326\230g'\bs"
+	.string	"=\272F?g\246\372\270\021\367(K\234#\340x\216>\322am\005\006\250;l^;\211SG\b\330\b\307H\343\344\270/\302p\0179Ti\t>\314i\247_\270C7\314i\361Z,\b%\0072\352\017\207w\365g\277eyI\301\2644i\337\206\377O\325\225 \250ZrKM\345\320oo\235\n\021 +\264\006G\277h\001:\271\330g\006\325\357:\371r\352\301\225\020\bIG"
+	.ascii	"\200z\313\344\362\2069\221}?\243\227\037"
+	.text
+	.section	.gnu.lto_cliRateProfile.part.0.548.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\002\001\375\f"
+	.string	"\206\227VE\020q\224\016(\204@>\002\366\206\2165\200\210\b\200\016U\002`U\235q.\222\357\300R\346\204\326\004\311\266\377\324\274\332{\3046\031\b\372\327\370\033\263\366\006P0\017t\255w\007D\361\247\002\022\255\335d\357\224\002>"
+	.string	"@"
+	.string	"E"
+	.string	"\232\313i\366"
+	.ascii	"\227S\355\364'l\177v\313\305"
+	.string	"\221\0051h\267\b\350\3300\301\310\302\301\304\306\356r\247\223\304\301O\211\201~\370\311\021\002\342\022\3001Lgw\235\205\270\351m#\260\355\300>+\342\206\200\354.\347$>\n\213\233\200?i}?\354;\224\030g\324\330\335\002\331i\305\356\223|\276\nk%\337EW\rEpN-\245}\024O\001^t=\263\373Zq\261+\0328\365&;\265\3707\214\313W\336\302\302fd\327\343\037\253\314c#\200\201%\377\341\253<Cc\214!\243c\206r\212xb\307v\276\354)G\005,\273\036\306\033;\202\2760\361\224\277\344\322\276\237\362\025\276\2125\224\357'-\327\r\001\236@\032\260m\007$\324O\250z\030\200 \214\"\204\252\247\001\350\023\022=\250\236\321\002Q\365^By&\322\251\303\270\333<S\307\241<\n'\256S\255\270M\343T\205\222\212\273\220J\2518\315\266\374|\271\223aj\230S\304v&i\034"
+	.string	"\357\202\3039\003w\265^\311\275CX\200(\030\346\n\367\232\025d\251\020\220\272\352\262\2770ce\025L\253P8VE7\025\026\363)\020\204x\317(E\235\013Lw\032"
+	.ascii	"\256=\340F\213\350w\2251"
+	.text
+	.section	.gnu.lto_cliDumpRateProfile.part.0.549.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\016\002m\022"
+	.string	"\026\"xH\320\362&\035\202\2166\207$\242\263\254\031\305\022\3101\\\002\023\307#\251\257\026\0343-}\223g\025#3\263&\311\330U<\230>\217\306]K\202m2\241\342\213\024\027\316\027\300\264G\230\345\301"
+	.string	"K\275\276\022A6\221;\245Z"
+	.string	"b"
+	.string	"g"
+	.ascii	"V\371!\243\244\310.d\363\333\362\324\254\322FI\021/dc"
+	.string	"\335-ACi\367\326\340\323%\337\247\375 \3332\273\351\267\237\255Y\264\233t\225\226\204g3\241c\004\265\273\340\247\252\270x\225\235\350\313\3216\273\036w9\332B\\\026x\007@ew\375\211\270\347m?\260\215\301\226\257kMa\277\350\357TZ=i\371\241\377\002\024\354\240\214\330\345\211\362\261'\346\f\026G\272}#\231\2173\b\222\354G1\253f\267\235\325|\027\177!\376(\226\332\334\376\003\315\026\344\264[c\360i\bN\" \356\344\213d\267\265u\322\376\355-\304\023m\350R\233\203\002D\312\367\251:\211\367\331\335\200\367\031\024>\032\213\311\347\223\216\2530\3024\332\026.\250h:\363Uu\004\250\003\016\235\037\004\344\223.#\303\201\237]\332\307\325G[1a\265Bz\236r9:s\210\264]/\362\243\247\207\036\0359\034\235Y\252\017\3431^\376\n\303f\344\307O\177\306\373\374\370t\225z\334\003\344"
+	.ascii	"\032y\350\374\270\221QR}\254]\267\273\001vY\240\222\031\340\207"
+	.ascii	"5-\"/4\253\025\231W\314\345\343\320r\211\221\320\202qi\200\205"
+	.ascii	"\023Z5\2530e\326\211\013\206\005\306\270V/\220\025\322\200'$"
+	.ascii	"\206\311\264B\260\006\006\013A\020\333\362*7\212cU\365\261\035"
+	.ascii	"\353v{\"8\021\311(\213\177y5Dn\354\330\200\332\221@:\3504u/y"
+	.ascii	"\366\nK\217\034\002\251\372\244/\265\2240\005. `\002\"\247\216"
+	.ascii	"\007\214\240C\261\311\334\027\374s7\212@\250PD4\211Gq\r.\317"
+	.ascii	"\\\316\r\337\230\017\2369\262M\330\374\323*~\253\025l\275\325"
+	.ascii	"\332c\267\035\273\327\026\340\275\213\302\306.f\033\274X_\f\200"
+	.ascii	"Y\223\300\016\207t\367D\213Lrs\205z,k\235\201a\023\224H\323P"
+	.ascii	"^\254\260KJ\006\2069\371Z\214\007"
+	.text
+	.section	.gnu.lto_cliProfile.part.0.550.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\375"
+	.string	"\275\f"
+	.string	"6\227TB\020Q\225\016(\204\240,\242@\220w\030\2101&\345q\016\030\240\320\274\3510 \331\177\362\362]\017A2vW\336;\356\221P2\020\234j\331d\360\r\342d\0250\254/`VD{\020O\2136\331;\245="
+	.string	"?"
+	.string	"B"
+	.string	"\222\327\355\001$\257\224\327\253\260\035\332#'_\273\262h\217\b@\355\270\240\\\341a\206cw\275Wz\342\342\351\324D\177<\355`\211\370\004pm\202\331]o#\356z\333\nlo\354\227\002\254\325a\376\307\213\317\304{\230\276!\366\037P\224\"7v\367\300\366\312i\367a\241\337\302\024\333\227\205'O\334H\302\300\253\347\264\037;\013\361\344\351\225\335V,\306.\211\340\325\227\355\325\344-\00100\\^\273\251\253H[\252+\360jk(\315\253\374\220Wl\224%j\240\3508\251\313T\273\266\264e\323Y2\240\261\013\242\314\261&\252\214\024\007\371e\237\366}\220\273\360CL\371\b\357a2\327\201\334\256\320!\320u\t(p\032\016\227i\260\211 a\002\207\3138\330h8\020\036\f"
+	.string	"\357\t\201\237\016\350\233\370\353\300\317\347\205@\013 \357\033\221\274\316b\321\005\317\310\313 \022\215\274y\3322f\003\345@\251\313\3666\347=Cr\221\007\034"
+	.string	"\3561\362&\b\2343pW\217W\004\002\242`\230+\334kV\220\245B u\276\224\005\227\325\205\231 \253`Z\205\302\261Uh\325\247@\020\342=\243\024u.0\335i"
+	.ascii	"\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_cliDumpPidProfile.part.0.551.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\004\002m\022"
+	.string	"\246\341wI\320\362&\035\002\354[\216\342\247\316j\340\3273\361\033\372\271\203Q\200\207\fl\270\235\223w\362drd>\030\221d\354*n\350>\217\306\365\230k\363\234\302\205\004\344\037\230\311\b\240\001\370"
+	.string	"\035|-.\nA(\331D\356\224\002Z"
+	.string	"a"
+	.string	"e"
+	.string	"*/d\224\024\332\203j\216[\036\233U\332()\341\203j\254\273)\222\224vq\020>\335"
+	.string	"\374\264/\3036\315n:\356gm\016\355\246\004!VL\331=\345\024\001\331]\325\247\266xx\225^\350\313\361&^\237\273\034o$.\r\334\003\240\262\273\006K\334\363\266%\330n\261%L,\354\023\375\236J\353'-/\364_"
+	.string	"\003\035\223\031\273<\273\247U1w\274\370\321\355\027\321\374\234QG\264\033\315\234\022q+\332\374\032\267\021\336h6\262\272\375\210\332\315\204\323\256\355\301\247'(\205\240\354\311\023\321p{\363\244}\334i\204\037\372\340\215,\316\212\235\b\340g\352%\337\247\367\003\337\247\003`\355\202\311\347\221\236\323@\3024\332\0338\244j*\372\252J\002$\")'H\001y\244\353\350@\362\263[\373\350\002\326*\230\254Z\"=(t8*ZD\332\256\027\371\321s\247\347\204\356FEK\365o\034\307\313wa\230\214\374\370\351\313|\237\037}\\\245>\367"
+	.string	"L@:=r\202\330\310\235T\037\253\347\255\006f9H\241|\031\rK,\344e\306e%\366\232\261@\020-V\214\205\026\214\313\003L\226\201\345\212\021\360\352\304\005\263R\305\270\\^\252\225lFuRbX\254%S\321\300`2\025\312\266\274\212\215\336\250\372\330\236y\273=\024\234\206\344\316\341_\037\217\001D:9b\374P O~<\005\357\245\317^\301"
+	.string	"C\207@\252\036\351K,\013\230Z\002. p\002\"V\307\003`.&\215\373\202{\356&\021\b\023\bC(\361\024w\301\345\305\345\224\3416\354\027>O\342\031\363\276[\301o\265\202\255\267Z{l\333q\367z\201\277\007P\370\215\001\224-b\033x\261\236\030"
+	.ascii	"\263&\201\035\016\341\356a\213\314\345\346\204\376Xj\235!\303"
+	.ascii	"&\230H\223\241\353X@\227\024\f\fs\362\265\017\017"
+	.text
+	.section	.gnu.lto_cliMspStats.part.0.552.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`o\003\265\031"
+	.string	"\366/\247H\260XQ:\223\"\254\275\252=o\343\217\200\270\232C\335\361f\276\275\217\242\024~\205\325\361*\364 \\w\323\375\255\350|\365\232R\316\211\372\t\256\223\221\017\225\205\227\334V\304xr\342C+\260YV\366\217\204\220\275\245L2\216"
+	.string	"\216"
+	.string	"\225"
+	.string	"\314\273O\372\021\334}0.\240\326\035G\240\324\352{p\272\n\304\323\365\335\005\236\212\257\001O[\247/\262\273\267\335\251\373\216*\215\305\355N\031"
+	.string	"\2529\tUPAK\304\324Z\311\323\346\261 \343\036\202t6\213\270}\356\341\f\201\204\202\320\364\202\346\213\352'\345M:\006YB\210N\271\354\331\370\234\f~Q\302\320\364\200\246K(H\371\247\263\214\336\216\373M\247HSKe\217\350<\340bx\241\326\272\377\271\361\235\371\356\316\330]\237\3356\021-2IZv\235\3436\332\026\377:\242\372m\357\330\235\274-\026\310;Cy\305\311\033N^p\362\322\311;'o\337\351\313g\372\236"
+	.string	"[Y\300R\253\320U\231ZD\245 \235\351w\372\221\274w\277_r'\373'\247'>l\300W\207\236\370\004\250[\352\207zTq\301\271\222+\355\233\230nor\263\343\316W{4\230|\t\367&7\257C\3651\200TI\375\034\210\247\343|\r\250\344F\2767r\333'\331\026\222\333}0\306\\\216\006\247\033Y4 \220\332 \362d\034:\360\313\235\025G\347V\354\231\276\227 \253\002\037B\360K\261\037U\264+\342W\302~\024\227\236\r\366C\251\217"
+	.ascii	"g\323\276\027\036\021\035_\355n\211[\231\315\272a\005fL\377D"
+	.ascii	"Haj\314\023`w\217R\227\035S\355\256\211W9!\326\272\233\260\247"
+	.ascii	"\362\002\266\377\341\003\236v\203\260\0023$\351\207\257\226\206"
+	.ascii	"sP\360K\356?\3355\205\314\224^\212\002\352u\033\355n\213\257"
+	.ascii	"\364()\\G\265\362^"
+	.string	"\316D^\204\005\264\025\374r\237\344\001+\253@\301f\224\275lF\031\004\b6\256\255\315\310\035\230\215fC\321\0026\2165\026\244\013\330l\034m<,h\261q\034G\031\017l6\243\305F\017\0378\2205\033\314V\243:\317\341\321\331\221\315b\341\306ptvb$\217\016lF\306zj$\216ki*rzH\033\215\326C\362/\374\264n\373\257#\252_\330F\013\300\007e5%\302+\243\325\357\177Q\302\222\200w1d\340\227\255\276\025\351f\255\265\202m\364\033\360\315\3527\235\004\324\324\022O\207\216\257\350\001\246\rv\330\r\365C\250\201,b\fC\b\021c$(\241\221YC\007p\002\031*,\017\020pk\233v\003W\371Z\250\\Q\031\321c\261\004T\004\230\"\232\002\3158\274\202\241\261\250a\027\031\361G\007\006r\350\233\013O\332\200\023\205\341G#\001\252\0266o\211B<%hi\370\024OO\032"
+	.ascii	"\304\177\003\271$\241\306\201\305\002\262d4\030\320\227\3123"
+	.ascii	"\200\334\3320%\350\305\205/F\366s\236\211k\356\356(\252(\367"
+	.ascii	"\007\342m\277XXn\201\305K(\265o0\236\312\361\212\242?\314\207"
+	.ascii	"4"
+	.text
+	.section	.gnu.lto_cliAux.part.0.568.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\345\017\255I"
+	.string	"\252zT\033A@dR\007/\216\005(\004\261\213\016\347"
+	.ascii	"\255\230r \3503\253\212\003d\201\024\367l\371\210v\240\373\031"
+	.ascii	"Ih\016;\340\364\261\351\203L\377\207\340{FY\240\027\245\020W"
+	.ascii	"\365\037\334\322\266\275\267\224)\005\226\001\214\001\252\001"
+	.ascii	"\3222\2777\301\275\355*\f\343\334_.\367g\363v\356\257\357\370"
+	.ascii	"5\276\300\320\233\275\367\273\203\365\217\373\341"
+	.string	"?\367h\276\316_5i\322xUI\334\333\254\211\335\204\341\267t?\\\371E\335\320\347\336\273\314\233\201\377\214W\177\213\355\017\002x\327\007p\357\375`\370\255\222}\244\373d\344z\344)\271\036I\273o?\364\354\356\017po\352\324\267\336`\370\355\3539?\365\307\303\371p\242n\261\247\347\354\376a^\f\374p>^i\357\263/v{S\035|\353\b\206\337:\365\223\356\267\303G\272\337\272?\030w\377\341\376\347\251i\373\351\260\373\037'\260\3355\341nO\330\234\340\336{\371\255F{\370\233\230\222K\310\243R\022\322\221\221\361-\022\207B\267euv\202\375\211Nh\32771\325=\224\231\330\225O.\261\3128\326\260\357{\262\261\005\316\312\006\177\372\254\222\221\307\265\3513\316J\302\ffbl\237\3042\350{\252\261\311:S\376\3222R\331\037\225M\237\321lt\347\241\372\236eP\262\221\354_6\252\316\224?"
+	.string	"Q9I~\372|\222\213dP\323\247\223L\2042\023k\362C\345\336\373\247\317\261,\374\276g\223\260\354f't\311\267,\262\211\232<G\320&\333 O\233\223\027\n\226Yv\200\035:[\336\372\331\b\264\311\032 \223\222\346\367\276\262f\223G\2548\277\357i\205e"
+	.ascii	"\330\246\320\327}\036\002\365\312\371\370N\302\f{o\177\246\227"
+	.ascii	"\367\247w\377\251\273\017q?\"\013[\356\336G\271a\023\030}\013"
+	.ascii	"\3748\017(\313%\343\347\344\361\177L\270z,\374\275\237\023\376"
+	.ascii	"U\276u\024*\362;U\350\217\363+\304\242\326-L\320,a\346\253\353"
+	.ascii	"\317z`G\260h-u\344{\325\325Z\307\261\001$7\347+\037\362c~\355"
+	.ascii	"\316\242E~\247\326\312/\335\345\020\376u\326Bi\231^S\213W\276"
+	.ascii	"f-u\355\364\372z\275^]\237\271\027\263Kx\263G\030f\207`\314\376"
+	.ascii	"\240\230}\371f\247*fwP\314\336\240\230}\352\315\316\240\230}"
+	.ascii	"A1\273\202bv\2517{\002\244\354Q\305\354\b\336\354\007\206\331"
+	.ascii	"\r\030\263C\275\331\225o\366\002ov\002\306\354\003\336\354\002"
+	.ascii	"\002\024\263\003xrz\2637\275\331\231\214\262'\227\220\307\243"
+	.ascii	"\354Jo\366\2447;\322\233\375\310(\273\221\3615f/\276\331\211"
+	.ascii	"\317\367>,f\027>\335\273\333\n\263\263\257\346]?\231\367\374"
+	.ascii	"\324\377'\301V\001!E\367>rM\264\243\264n\256\274\232\177\272"
+	.ascii	"\1772\377o\376\253\377|\377v\336\357j\207_M9\220\307\263\330"
+	.ascii	"=FM\023\023J\243g\336\004\367\027u\212\313\263t\0200\246T\312"
+	.ascii	"\353\257\351Fpo\352\362[\242\373\373\367\335\261\223\301+\210"
+	.ascii	"\207*\030,s\036\216\277\325_>:Xt\260\240\202U!!\356\334|\034"
+	.ascii	"\256\207\343\313\264\275\367\335\257\361\317\373=\177\337\350"
+	.ascii	"e\351e\211Y\357\022}\250z\004\n?\036o\313\237\021(\300\217\267"
+	.ascii	"\245\354\242\356#o\317\030\217\227@\017"
+	.string	"lC\244P\022\373[\256R\277\231\334\236\257|H\331\216\305w\006\221\n\020\320\005\b\360\271\215\rP\313d\325\300'N\3309\002\364\200<\346A\200~,1\235#--\364\001t\033W\035\004 \200\376;\206\002\377I\003pz\322\177\207\220\221\223\036\244\223\316{q c\023\223nb\312\033\034K\256e$0\233\220Y\305\"\006E\202\305z\234\202\372\334\buy\255\334\344\222Nj&i\314\207\\\252\026\221\272eV\321\216H\375\261\235\202\374p>\017\3162T\322o\033\274%\277\363\250\225\315\354\254J\272\303]\262\020\330\315(\016/Q\033$LI\027\361\250]\235\304$\375\325_\364H:I\1773\352U}$\375\321x\215\333\330\021\230\f\266%d\342\375\345\257C\331\353\235\202\214\372H3\315\251\361\205-r\301 ci\206Z\352Fo\345\032\351\237\312\3151j#\2154\247\246\027\266\210\371\032u\036\214\333"
+	.string	"\237Y\226\b\265T\320\277\272e\342\331i_\375{\177\334\213\313\254_\272\313\325R$\2364=E\355\016\207yE0\234\220\211W%\372\266\367\256\220\310\204\373T\247\220\227\332\333\241G\224U\347\024D\324E\375a\213\3345\274\340\206\341\336_\025\374\r\335\350@\324O\026\317\r\212a\346\353\236\362\241\265X\356P\267qxk\002\262P\273\177"
+	.ascii	"\221\3379\\\252\023#\371\253\253\205\332s\330\3301\267\256~\353"
+	.ascii	"\037\007c\250\376\357\302\305I\027\266\207\333\352\226\311\346"
+	.ascii	"*\307\347)g\355>\202D~g\253\363\036\232\"\253\177\236\242\003"
+	.ascii	"\007\021\037\\\347\212R\362\340r\361\3443\250\266\254``]\265"
+	.ascii	"\250\322ZV\305x\342\201\365BW\271\270\3229"
+	.string	"npam\310q\303\352\212K\206\226\006\0304l\270\320q\244\3616\\\350\320Z9ph\253\0334l\300\270\252\022z\025\025\r\033U\313\0334\\\\-\253\264\266\226TI\307\302a\245\265\314\201\205\245\265|_\2379q\215\317\312\324^\256\237\335{\357&-\315\317\347\247\376\327\344= W)\277\256a\363\301\274`\260\272W\332\263\266gm~\332!@;\246-vo3\f\200q\371\352\0272\002\035\245\027h\007z\251%h\255\037N\256\302B\b\244\355\335|'<d\330\254!\005\027\201\217\260\373\211\356\362\bZ\202\033\262\b\232\352\001\2040\231M\036\340\232\272\007\272D\374\207J/\323l\265qy\201\32174tT:E\374gP\f3\356\033h\007y\314O\351\006\f\364\0244\233)#8G\206\201\233\360K\201^\320\214>Ii\005Z\317iN\023h)\375H2uK\312\017\016v#2\363\304\204I"
+	.ascii	"h\020\214^\224/nQ:E\034\350v@#\320B)\233\036\254$w\201\277\034"
+	.ascii	"\320K\265\t\031\252\t\374$\277\323\200Vj\201\341Z1\275\263\266"
+	.ascii	")\224.\021\007\016\212\201\220\335\3412X\312\357Yk\263zeIR\345"
+	.ascii	"\244\3678\356\324\263R\030-\277\3233\335Z\231\265\251\273\350"
+	.ascii	"\300\230\344Yr\301\310\361Q\302\305o#\265\024\355\253hY\213\363"
+	.ascii	"\b\252Q\344\304\355\330\266\202\362\332"
+	.string	"\372\2640\335\224\340\\*0\\\033\227WEz\006$\306#\030\3700\233+\005fk\343\362\322\242\224\005\201I\250q4\345\224R\246fDD\222$)t\261\005\204(\345$\273\r\021@-D\316\310\214\220\024\326\310\260gu\232\302\300W\337fp\037hUP\246@\301Q\334v\t\255E\213\325\001OD3\260\371\347\235\330\365W\254Ni\326vPb\307\004:\"R\022,\300\247\370\021\262\214*\232\007\004\340\377\200%j\b\203P<\200\016>\234\370\323\033\021\331k}\364qM\235\343?ZbW9+n\304.\244N\331\351D\304Q\353\310q\271~\302\021J\244pq\334\375S\032\212\342W;\361\025\327}\341\324\307\006\342\030\355\361\r\234\320H\016\226\024\233\370\017B\257#\033P'\275\276\2316\205\201\2351\247\177\033\207!\004h\312\367\272\032\004\240\031,\275\261?\023\355\204\013\023(\242\323s\022L\356\347\322"
+	.ascii	"Z\021KP\333\024\350~Y\037\356\323\333"
+	.string	"\201\207)g\016\277\021\361\224<t\240\335\327\264\322\306\260\323h\365\002\034_\006\022\243\215Lt\315x\236\216\304L\340\220\377\260\013\215\2238\313I\203\302\351\325\2118\020\240\203\372G\357\203E\250\262\256\\\020\330E*p\362\024"
+	.string	"h\373.\365\226F\275.\217\001v\024e\b\3200\201 \336 j\270\001J\247]\022\250\026\231\016\001\270\0172<\370\ff\004x .F,F\307\351)\310\210\2311\244\017>\221\354\323\334\347\207\250\033\2646\316\3239\216\314}y\343\242\2254\211\304;t\3162\274\355\235U\341\220*\025\260:\020\013B\tLmC\227K\316\371\013\026\021\253\331\254V\007\265koR\371\346\032\343\022V\207\372\004Z\310\303"
+	.ascii	"?\244l\310x\333\237\237\021}\277\341\261\035\034!\230\210\016"
+	.ascii	"=\006\322\373\202\0256\315\b \301\273\334\227\346Zy\356\222`"
+	.ascii	"\244\267L\301\214\321J\2644WO\3379\233^Z\335o\313\032^>(\245"
+	.ascii	"\371\360f1\016\\\034\331\"\376\241@`\016\001F\374\030\312\340"
+	.ascii	"\343\f04\324\325\221\364BF\265 \266A\215\016\205pVR2\256\373"
+	.ascii	"\035 \374\332\237\274\251\004\025\241\206\223\271\006\254z\035"
+	.ascii	"b\017\321a\272\0316]u\006\204\233r)\211\374\326\366\273\210\356"
+	.ascii	"\243\350\245\302,8\005\314\356e\313{A\246M\277J'eHB\005"
+	.text
+	.section	.gnu.lto_tryPrepareSave.part.0.569.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"e\f"
+	.string	"\266\025TD"
+	.string	"S\225\016\230+\305\316\0379\024\001\004B\324\373\016\022k\003!u_\005\202\003\221PC\365\373\016\252\004a\240\330\241@\324L\303U\266\007\201\016\325i`}\216\007g\316\250F\326\365b\327\201\221\335d\357\224\002>"
+	.string	">"
+	.string	"B"
+	.string	"\245\n\322e\333\234N\312\342"
+	.string	"\020\343\016\n\254$\204\f\036\273e\367Ji\027O\347&\372\223\365\032O_\236A\r\0219R\330(y\301>1\337*\236\335\265\205\304]o{\201\355\007\366\025\0042\333\323\257 \030\016"
+	.string	"\261]\362\207\217=Qg\254\370\310\355\217\240\374\322\027\221\207\210\346\306rIW\312\027\361\345\325\017\021\267-\261\243\216L\315\204\311\013\004\257\316X^\357\302\234\016\312\342\003\036\250\212\322\231m\003-\032\0132F\262\024\205A\246]\002\t\264h5\023\025\035]\231\207\361\030\341\201\033\273\253\263N\226U\002\315\253\315\241\303<\313/\037\200\204F\213\223\036'\037\3508\351\314t\373\2664\326x\025>\"\r\027\301k@\201\023\205$\204B\036g\301\001\210\363D\037\017\302\204\002a8\372\276SX\361\267!a\370\272\f\244\013\245\3563\205\335F\200A\r#S\267\001\004M\335\345\333R\031f\372\"\345t\004\265'\027"
+	.ascii	"\3571<\026Ni\243\211\0212n\001\316\002\211I*l@\036\030\341\212"
+	.ascii	"1\314\304\320EC\260$D+\025\241%\034Y\245\262\3128\234\366\251"
+	.ascii	"\323>\245\246\260y\352\265e\f"
+	.text
+	.section	.gnu.lto_cliSave.part.0.570.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\275\n"
+	.string	"\026SF= \345*\035"
+	.string	",\034\316O"
+	.string	"\032\244\242\323\301,\250\034@B\002\313VC\257\221\347\363\246y\2021V\264\360\342-Q\330$!\004 M\302\022"
+	.string	"\257P3\016y:\264\371\342G\233\354\235R2"
+	.string	"1"
+	.string	"8"
+	.string	"\261\025\261h\337\350\326\326\225i\271|\254"
+	.string	"\330]\357\225\222\027O''\372\247]@\305\032O7\254\326g\3019\r\305\356\272\033\271\353mG\330\206\260/\021\247\231c\373\263\323KS\302\350jx\365\234\366Q\236\"\2764\235`\367%\253\355\226\017\257^\350^]\276\223y\355n\220y\345\274^f\373d\337^\006\251\253\302.\345\300\360jc\224\006H\030\233\007\035]\247\275\3011\257\362\301\212|\261\241\3508)\314\224;\267\364eW\005\220\t\223\335\220\001\002\226\244\266\224|v\373''\007\266\030\201\032\237\222\0064\002C\025\242O\343\317\003\206>o\004~D\336G*y\236\216\303\013\020\311\313\bC\2227\277\"\003\330:(\312\224R\230\r\306l\346U\316\"B\210\355\006\031"
+	.ascii	"\3561p&\b\314\371\021!e\341\304a\024\\\006H\264\325\rkZ\f\310"
+	.ascii	"\003#\\1dM4\272\250>\017\002\023\357i\245\250vu\256\362\\ 8y"
+	.ascii	"1\357\2644\375\2042\006"
+	.text
+	.section	.gnu.lto_cliDefaults.part.0.571.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375` \001U\r"
+	.string	"\366VVD"
+	.string	"q\234\016\270Q\227\fT\200\022\361\243F\325[\240\2246Hl\021W=\223eX\341\022\256\003\233\235\361\277\0216\220\363\b^\374A\374\325\375\377\377o\006\020\321b8\260\021\3305#\276q\272#\242M\366N)@"
+	.string	"B"
+	.string	"C"
+	.string	"\266\t\335r=2V\253\303\013ew\265W\212\342\3371:\353\347\007\020\301c3\024E\234b\nNb\344\030 \2460\314j\f\377\372\374 \242\3464\360Z\351\354\256-\254;\273m\t\266\035\330\017\021\036%\235\366\311\303\370NR\242\036\366t\342\301\210\b\311\340\325\r\310c\262W\313\017d\257w\341\313\2537\234\357-L\330\222X\020GfD\244d\201\262K.xu\306\362\372\025\266=\333\344d\310\202\360\027\256\033\251\231\342l\332\0328\314\207\247-\3258\303\006\212\202\223\202\230\326cK?\3549\375J\204\021-\002%vW;t\254\211*#\305K~\327\355\277\360\374\222\277|\2617\034\317\345\235\244\224"
+	.string	",\260\373\021\037\021\007\232\020\332*\244\n\034\005Q\007\341\263\301C\272x\323p\240M\023q\236\220\266\215H\232\006\343\356\302g\244e\350\272\2216\3379Q\024fA\300X\003\300\264;\f\363\241\021\250F\032\017I9))\005\261m\312N\257\"! `\202AV\273\001\2561\234\004\3419\305\021\220\002\251\241\253\211\360\335\262\rF\241p\351\337eMJ\226G\224\2079\302IQ\344\017\241\\\202\261y\340a\327\265T\273c\026\315\211\224t\024Q8j(S"
+	.ascii	"1\367\232\246iG\367\3327\006"
+	.text
+	.section	.gnu.lto_cliProcess.part.0.572.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\226\001\365\016"
+	.string	"\346\234cD"
+	.string	"\221(\035{\314(Y P\264\241G\236\267DV<\007\220y\317\364\252\3011\337\027FB\356\251`\365Q\275\226\264_\372oH\t\217>\367\252\365\367\2549ST\264&o\305\024\237\324\322\362\215\220\275\245L)R"
+	.string	"N"
+	.string	"M"
+	.string	"\313b\222]s\340\264\0352\325\007\225\230\032\273\253=j\t\303$\035\213P3#\371\001\270\3221\016\304#\314N\250\023\036\356\004E^\256\231wO\017\234)an)R\327w\347\310X\331\320\330\270\324\263\300\263ldw\315\tqsn{\203m\005\366g\004\020\246\365\255;5}\017\202\317\003\306.\352\306\306\216\2103(\336\372\355\373+\316\362a\334i\031$dt\357\304\035%oQ,\006\t!\335;\031\2604+ %\243R\271v=\217G'\340<\332\357\356w#\273\323y\274\n\333#\273\346\336Ky\265K&\344\267\324\216\024-\331\2179\013\016\276\t\203L\362\333\243o\202=^\017\363\006$\276\317F\004J\336X\2572.N\234\252\213m"
+	.ascii	"i\2070\3447\277;\307\nkEc\322R\252\2135\273\310\313\313em\261"
+	.ascii	"\2614\246\351\030\323\001\237\373\363\001\242\360\321,\200H*"
+	.ascii	"h\037Q\006\355\203\303\241\013%\"MC($\322:\266\363\332b\217\240"
+	.ascii	"\250\t\213+\254\027\321\001\206\351\202\030)\371\262\201\214"
+	.ascii	"j?\200\220\337\260\026Q\337\235\201\351\373Vpw\027\022H\250v"
+	.ascii	"\004\022U\250OU\225\260z}*7<\001! p\202\231K\333_\270\3734\305"
+	.ascii	"\222\200\354z\267SxvP\273\240%\333\337.\013G\317\"\243\031f\005"
+	.ascii	"\267\320\301\240\266\033\f\371\274e\350\327\264X\345\204\013"
+	.ascii	"hdj\261H\334B\227\001\302mh\325\276i\313o\244\021\256m\377\t"
+	.ascii	"o\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`\351D-\352"
+	.string	"\312\232\351SZ`\b\241J:\376\256\252\377\347\232\255\205\226\273;*\253\314\260\335F\004\272\273\334\301v5\234\331k\321\256\273\247.8SU\334&\250\233\013\031\270\001\031\220\001\t^^\364\027i\303_\244\r\1771\347?L\001\240|\355\2062\032\016)<?\035z\373q\372\306||\263\030K;\311;\005$\0050\005\006\322\3009"
+	.ascii	"\001\300\177\324\313]\325\317\371\250\177B\254\257\353QObX\277"
+	.ascii	"\304\252\336\211\260\276\211Y\317\204G=XY\277VU\037FU/6U/dG}"
+	.ascii	"\t\035\365_9\352\275p\324\003\271Q\037\304F=\226T}V\215\372\037"
+	.ascii	"4\352{\314\250\277\222Q\357#F=\021F\275\031U\317\343E\275\320"
+	.ascii	"E\275U\260~\330\242\276\212E=\025T\275\216\247\372\035N\3658"
+	.ascii	"\232\352M0\325\223\260\242\036h\251\376\004\260^H\251~\210\254"
+	.ascii	"'J\252/B\252G\241\242\336\350\250>E\212\372#\243z\025(\352\221"
+	.ascii	"\212\352\223\210\352\311\241z%\241z\235\240\372\235\023\365="
+	.ascii	"@\365#H\250\3471Q?\376\324\377JTZ$Q)\231O\245e=\225\232\361T"
+	.ascii	"z6\242R\264\235J\223\350T\332&\242R\267\020\225*\001Q\351\222"
+	.ascii	"\017\225:\371U\372\346\241R\270\261\322\270\234\2322\224\342"
+	.ascii	"\253\324H\224J\217@\251t\254\256>\370\244>\006]=\214\271\372"
+	.ascii	"(\271\372\027q\365.\340\352g\274\325\3079\251\207kR_\204I}\333"
+	.ascii	"\222z7%\365[n\3656\332\352\233\330\352\235\326\352[$\251\017"
+	.ascii	"\241V\377\226V\237\203VO\343\254\276\206Y\245>\312*\275\"\253"
+	.ascii	"\024\253X/\205\244\322\255\263\3367V\237\344H\375\020#\365PE"
+	.ascii	"\352\231\210\324\003\305\352\227\302\352\177\300\352}\206\324"
+	.ascii	"\177\370\252\367 \244\322!^\225~\005\251\024HW\245\\@*\315\342"
+	.ascii	"\252Tk\253\322\037.q\255J\211\316\242Q\260(\224\022h\235\312"
+	.ascii	"\017\372D\345\212\322\265\325\323\231\315U>*\355\321\203H\356"
+	.ascii	"\304J\207;FE\362=*\305\201\201\314\306\316\207\225\336"
+	.string	"H\273U\2453\204\225\3120+\215q\201GM\301\361\262R\030U\225FQUC\231\252)R;*5\241\243\322\222\346\250\264\212\036\307\325\304\236f\344hG~\206\344lc7s\361ed'\373\215\027\313\216\304f?\317>\246b\343GT\320nDE\252R\252\032\225\376\3208\021\225\251\017r\237Q)\021\225Q)P\214JI\330s+)\306aTj\024U\251\320\213s]\210\241\024\344.*]\242C\256\025\2544D\213\227\240\262\241\007\210\325YT\272\002\252R \375S\245LN5\245\251\351\245\312\232\211\021Wg\252\264iE\245PK5\205\tX\251\023U\252\224\005YS\226\350\223*}\242`\237RA\252tJ\205\265\212<\207\n\004\330\242\250~T\375\204\246\370\n\237\226o\327B\024\227P\037d\roXS7\252\324\003%\372Qvt\024\325Lh\022\247\032@/\2524\210\022\271\004\025\253\203P\221"
+	.string	"\251\211\317\207*\355\241Bt.\21069A\231"
+	.ascii	"Q6\022\314e\202\256\375\307[*%(\022\025\022\225\346\360\241\247"
+	.ascii	"\n\333{*\325\301S]\344#\252\225\354T\273\321\007z\304\202\327"
+	.ascii	"\251\324\244\".C\345!*%q\0205\345\207\232\006-\362\201\022\371"
+	.ascii	"Q1\0174\354#\005S\311\251t\007\275\257zI\024\332\245\262\304"
+	.ascii	"u6G\241T#\241Eu\325D\236T\352\202\256\246\220\240s5\345\206\\"
+	.ascii	"\245Iq5%\007E!u\204\302Uj\365V)I\273\234"
+	.string	"\245\322\203\033*B\235T\3235\251\364\003\004\346\231\b\312\244\322\237\213\252\"tIu\235\303\336\025\244J*E\341f,\225\266J\207\266\234\350\024Q\266JA\320\265Ju\312b\020i\321$\225\212`:\013\017\215\234\375P\265J}i\177RQ\002\342\005E\253\216\262\342\"\006\320\003\303\006=\253t\304\216gJ\207\232U\272\203\005\242\214\226U\312CVMf\243X-\004I\265\327Iy\250\030\311\345\230y\354\350\225\\\020\t\364H\245\302\026Wb\244\246\214\260\323o\250\354\356\205\"5E\207H\245%\304\252\301\210\302\252\305\300j\312\212!5\005x\341\253\246\360\b\251\206\363\252~\013RSltU\332\002H\365\030\345\252\016\262U\355D\253R$\033Y\225\252 \302\252>BK\2506B\177\320\022\264n\\UZ\004\344\243\246\214tw\375\253\242\304\006Tv\227\216%n\254\034\0233,\332\243\272\353\302\260\246x"
+	.ascii	"\262\252)9TX\215v\301\254)>\036\325M\312\352\266]U5\033\335\335"
+	.ascii	"\013T\365P\350T\245G;<\245\242\243R\245\034\325f\024\007U\273"
+	.ascii	"A\323l\330T\331 OA\240\250T\365Y\215\3522J\243\032\310\217Js"
+	.ascii	"\350\214JG\227\252\"gTF\245'\374\004\204\004\0214F\265\034\265"
+	.ascii	"\340\f{\2420\252\343hT\2456^\320\032.\250\220 \r\242\262\273"
+	.ascii	"\024\240-\250\327\252\361\364P\026\225JA\331\352\251z\315\311"
+	.ascii	"B\225\246\352$L\366\261\302D\225G\211\022%\n]\252\364\005\005"
+	.ascii	"V\017Q\252\324\2074\225JRu\030\325\222\362\210\352/\244JiP\025"
+	.ascii	"\356\241\362]\377\250\350\221\207*)*\r\272Q\243JS\240\250\236"
+	.ascii	"\333\3204\367\204\026U\027\351\356\356|\343X\302\306n\335\305"
+	.ascii	"*\341\024\237\317\347\243D\325'\335\335\t\220\005\"\224^\201"
+	.ascii	"\213\242\001\302i\036\212\037&h\226\355\036\224\366\020\f\247"
+	.ascii	"\262\003\351\226\032CJ\273l\3570\332)rht0\232W\303\0071\206\210"
+	.ascii	"f\331\016S\276\214-\344J\311\033\275a?2\220vm\331n\023\215t`"
+	.ascii	"\327\356\237\323vMm\223lV\222cX\265\253$LF6\253\366\335h:b\350"
+	.ascii	"\fh\263V\355;2*e\325\276+mVmn\323\256A\332q\322\356\323+\254"
+	.ascii	"Q\324b\253\312\r\213v\223\376\215\036d]\253\265h\347`\260E\243"
+	.ascii	"\213\366\031\016q{v\227k\266g\337\375\344\366\354\273\322\302"
+	.ascii	"\236\275\303\350\2243\240\316^\255\331;(\355\256\257/\2325;\007"
+	.ascii	"c\006kv\234\323t*\216\214f\315\216Cz\217<\271\261ek\366\n\244"
+	.ascii	"7\r\304\022V\003kv\2311\2035{ol`\315>\341\364v\021a\033\242Y"
+	.ascii	"\263O \275\222cj\216f\315\344l\374\234\031l\3150\330\262\333"
+	.ascii	"\204\333\262-[\255-{\f\t3\232R\231\300\n\272\234\302-\236\245"
+	.ascii	"\264\201oCL\326\334\342y\243\351\223\2110Kr\333\026?\263[[\274"
+	.ascii	"G\027K\\$\347\"Ar\031\322o\303!$\267\302=\357r\232{\2367\356"
+	.ascii	"\326\236\"\336\216\264\334\266\347gvk\317[\030M\203@\t\213V\270"
+	.ascii	"c\217\371\301\230\276\231\326\216\244\227\322\246Q\305\026\267"
+	.ascii	"f\221\007\264\223\035\373\356t\321\364W\204g\310o;\366\231\335"
+	.ascii	"\332\261\273\b\327\310[NW\230\0214d\3155\362\226\361\305\314"
+	.ascii	"n\255\221\367\310\336\270WBt;,\243p\211|\3454\227\310y\244\035"
+	.ascii	"\344\342\rhf\267\226\310a\312\025\002a~E\323\017\356\274\225"
+	.ascii	"\275\214k\026M\240\313\317MV\354-\247i\213\020@\204vk\305\356"
+	.ascii	"s\270a\267\311d\303\356\237\207l\330q\3006\3543t\303\356\262"
+	.ascii	"\302\005\373\ni.\330y\343n-XX\216W\234\333\026\3543\273\265`"
+	.ascii	"\357@\256\020\350\025\222\003\205\303\347~\335\302\350\n\320"
+	.ascii	"f\324\270\331\257\267\374\224\354\327N\tL\342XF\237\350GY"
+	.ascii	"To\277\316\003z\305\200OF\273\263W\\b\212\355\327\375\263=\244"
+	.ascii	"\035q\363\332~\035\307\313\303I\210\244\365\332\257\317\354\327"
+	.ascii	"{\244\351\213\267\263\341\n\327\353.\346z\235W\356\200\266\322"
+	.ascii	"\007$Vn[\257s\360\207>r[v[\257\317\354\326z\235\203\321\001`"
+	.ascii	"\353Y\341v]\346t\312PT\223\233\355:\314\351/\311\222\273\331"
+	.ascii	"\256\267\214V)\342p\273\331\256\363~\026\333\256\357N\323\237"
+	.ascii	"6\342\315v\035\307\2749!\020\013d\273>\263]\357`\364\362\360"
+	.ascii	"!5\304\302Y\241\264S|\005\241\300\220n@\221\313\306\n\027\310"
+	.ascii	"YNs\201\2347\272\350\336\210\034)\267-\220\317\354\326\002y\217"
+	.ascii	"\364\207QrD+\\\256\273\234\346r}e\334\025m&S[(\334\266\\\237"
+	.ascii	"\331\255\345\272I\373\204\017\241r\265vk\263VK\353\032\324l\326"
+	.ascii	"f\375\345\204_X\\\311\330\253\224\036\351\232\241\224\220\006"
+	.ascii	"\366\3520\245{\247\232O\006{\365\227\242-8\303Xxm\257\376B\272"
+	.ascii	"\201\337\251t\301^\235\3454\325\232k\023\221a\257\276\373\355"
+	.ascii	"\325}\326\354\225\313\035\313(\263\304\263\220,E\227\363Eo\211"
+	.ascii	"\177\001\006\305\024\275\266\304O\030\275J\212r\214n\226\370"
+	.ascii	"\036\331+\312\224\275\237\215\244\344E\223\305\226\370\nE\263"
+	.ascii	"-\361\035J\233L\315\207\204\025.\361\025\030\211\036m\332n%\242"
+	.ascii	"\204v\244\251\220\017$\242z;\374\256h\212B"
+	.string	"\305X\013\213\355\360\274\322~+\002\024\344f\207g!\275W98\336nvx\227\322\021,\355 [\341\016\357r.\325\016\357s\205ku\2375&\032\351\300\nc\234\251\370q\332\n\277\033k\212h\245\003@\247\255y\217\336\266\252\"e\r\254\311\243\254Z\252\233\317D@\002)\0228\216M\004>c\023\201\343\324\330\330\330\324|\206&\203\r\030|g\232n9\031K\262\221\r\337\215vp\347\350H\0036\250m\270\177I6X\330\260\301\202\013\322.\270G\016h\026\\\003\007,\240\261\340\273\323\373\005EH\221\003\036\360\035i\2630\342tD\363\200{\264\347\222\242\364\240y\300\231\003h\034p\227\f\2401k\300\r4\020\006\334\243\002\026\360\231\t\024\360\031\r\025|\347\323\324\347\363\345P\240\241L\303w\345\013\005\367i\373|>_\002(8\016\004\t8o4\025\236\370\"\362\fw\321g\312Q\203s1\3037"
+	.ascii	"\313p\f>Y\006$\007\230\340\202\0047\360\2740f\341\273\242\221"
+	.ascii	"\n\337\375\354\24697-\037\251p\3770\024)\300w?\337mG\022\221"
+	.ascii	"\211P8\007\233-.\212\016\213\311|\3064\b\213$r=\231cpX\357\033"
+	.ascii	"\200\021"
+	.string	"\340,\246\217D\255\354\341!\002\370z9\007\257\231\326\016$\013\201\340;3\310\003w\321\3469b\n\263\327\003\347\320\345\300q\374\241\220\017?\r\260\334?\323\237\223gH\224*\253\205\022\215a\243\263\220\016@\023*\032[g\243\257\024WL\213\331\350+\244\215\215\316\373\355\2006\272\2016\r\342\0072*\303F\237\2416*2\212\"\"\027\025\025\3610\321\013\023\021\021A`\"\242\343\by\35085\026r\220\205\210X\350\211\205\316\033K\007}W\364\211)\200_\324\205\203\356\242\017\213\225[\347\240{4\005 \035R/\016\242\016z\357,{\2443h\262\3021!\346\214\031_\310\227\361\364\n\371@\342\205\313\270f\240\267\220+%\215\201\276B\326\031\350\274\321\024\304z8\331\225\306\300\306\017\032\215\201\276\373\321\026\006\272I\003\321\030\210\006\rt\013\243\001\240\204hc\251\316\n\244w9B\256\255\363\317'\214F"
+	.string	"]\324\215\177\376Rt\212\321\215+\213\371g\207\350w\343\237\273\234n\300\027l\352\371\347.\244\257\345\242\204\033\377\234\305\264\003ZD\2348\314?_)\375\362!\213\251\347\237\357L\367\340\206\216X\214\364\217\177\356\237\033\220C\256\005e\341\237\317P\377\3347\200\024E\215\322\202iD\003h\025\242\0259h\n\340Q\214\237\212\242W`\374\220\243H0\200\206\221\242\372@\223\\\374\310\242R\320\004\006\177\2469\224h\321\245\247\3211\"\230\310\266\216\351GW\254 \315\003\216K6\013H\231\354s\223\243\355\203\016\355\3345\240I\330\347\031\030}\025GE#\214\247?4\303\303\256\331\347\030 \315"
+	.string	"!\220\b@\357\216\270 \242M\366\371\005~~\340H\r\213:\331\347\036\214\246@\006\226T\005JS\034rD:"
+	.string	"]\201[\217\023\364\311>\357\340\364\221\274N\013\246\217$G'\210L\3313\323\244\342\266\316>\217\371\331\205Dp\307b\246+\034\211\235\200\371\201\331\347/d\366\271\313Y\200\226\237)\230\030Q\264\230}\316\002\364\005(\026B\ne\237\257\024m\243C\312\311E\354s^\321\024\240\274\005)\220}\216\343\026\270\257\0227\366\371\2145\274aMQ\373\2747N(cz\376R\232\356x\362v\266k\356\371\313\350EK\022:\241q\317[Foh\232c\243q\317YH\336\271#\375rBY\332:\367\\f4\006F:\303\255;{\246\023\320\263CE\357g\231\030]@T\210\\-\363|\302\030S4\2251v\024\3633\217i\353\211\016\2216\3469\314H\241h\n6\245C\203\200n3\317_~\006"
+	.string	"Q\235\020\r2\317]L\017`\355H\020\0252\317YN\3130%\241\331\230\347\274\037\221y\2763\213h\221y\356\322\021\214\370A\304\306<\307`2\363\3340JS Uuc\235\033\006i\002d`\364\312\211uc\235\213\360\013\301\364\203\302#!\374\f\001\024N \220~\t!\264\216u\016\302\350\007\360\b\272\261\316;\214\016@\223\256\233\242\005\240\0355\226\260\230u^\241\350\375\232rA\201\254s\231\032\353\274w:"
+	.string	"<?\266\3236r\261\025S\032F\350Uc\235\303\224\246?9`H\303\b\275v\255\350M\362\341\203\303\254\363\027\240\235\204\324\302`\347\326Y\347.\246{X)\230\320\023\326y\013\220\3454\005 \035R6\326\371\212\2712z\203o\306\217\236u\3163\215AR\2209\203Y\007\350\326\3455\353\334\2463\260\262\3022\230u\232\256d,\227u\276\201k\332L\344\230\314:\017a\004\201\374\300\374\331\367\017\200\037\354\373\007#\315\031WZ\200,\202\260\357\036"
+	.string	"C\330w\017D\330\367\nt(v`v\360\263"
+	.string	"\324\261\357\025*\220\025~;\366]\306\034a\337e\310^\221\307\276\367\312\336h\336\2223\242\323k\025\365K\022Sz\202Q\335\030\215}o\351\261\357-,?\037\373\276r\362\200$\354;o\254\263\357\273\022\366}\367c\337w>M\023\366\335@\022\354\253\261\3578k\366\375\002\344\007\243\007E\277\370\230\313AsL\033\211Z\331\203\216\013\345\035\220\216\340\210H\t\007#\316\351U\342d\f\270u\013\345/\247\375\202K\307\316i\001@1\362\3252\272B\321R\331\256-\224\357~\324\003\216)"
+	.ascii	"\351\250\261Y\013\345>k\266\256\256\256\356/\244\375\364T$c\351"
+	.ascii	"\366\311[L\257\260\212\305\221\333\366\311W\212^$+\246\206\\"
+	.ascii	"\266O\236\334\345\254Y\272\273\224-\247\357\363\371rZj\226\356"
+	.ascii	"-#\333\322\235\205\364Mp\347h\327\226\356<rk\351\276+\227\356"
+	.ascii	"\036)X\272\245\373\216\254\331\031\033\215\354\332\316]\003\177"
+	.ascii	"\311\022\245-\232\2353\342AG\t\013\267qK\226(q\031H}\033wo\326"
+	.ascii	"\306}\206f\343\350\026\356\034\220\374d\341n"
+	.string	"\322\024\fm\be\263\026\356.\326\215\273V\262,\334Y\316\226\237\241,\334[N\322\345\244Y\270\277\374\234\200%,\237\243,\334_N\322\017\214\265A\321,\334aN{)Hj\254Y\270\273Tr\223k\253d\331\326m\335>\302y\301\262}\004\322\005\030\n\022\325,\333G\030\035\001\333\231\344\f\233\342\253\363\306\f|\365]\361\207\257\276+}\365\035\320W\024\313W\347\340\2533\373\270o\220\036"
+	.string	"\321\304\231\2077F\367\234\226y\362bbC\272\306h\226\235#\017\273vZ\245n\016\207\215\211\006p\373\321\"\023\357\030\243\r\340\366\323"
+	.ascii	"\303\364&\tK\242U\246]\220\366\020\032\245\206\"\2552\361~\322"
+	.ascii	"`\"5\313\021\032\212V*\315\023\362\242\356&\276\002}\034f\342"
+	.ascii	"30\002\006D\b\001\204\362\002\346\007g\321\002\243\035@[\363"
+	.ascii	"\240\301\304{0z\251~\222x~\272\345\f\312\251\002\023\317\301"
+	.ascii	"\317\025,\321\221\303CL|\257\364\252\215 V`\342'\214[\264\212"
+	.ascii	"\316\357\204\305L|L\351e{\222\253\300\304\303\230\246X,\316("
+	.ascii	"\221\211w!\375\342d\354\313\246t\017\023\3372\336\304\263\224"
+	.ascii	"\306\340\311\313\007\317\304\263\374\274[L\320`\320+\023\317"
+	.ascii	"+kL<\217t3\361\273\222x\237\304c0\231\211\347\215\376Z\322\213"
+	.ascii	"8\002\270\307q\354\200\t\237(\002p\217\307\220~\3611\227\303"
+	.ascii	"\306\303\303\220\0138\255"
+	.string	"<|K\311\346\036\017\3372\006yx\226\322\233\346\304\265d\"\017\277B\326x\370\225\321\315\303\363N\264]\363\217I-G\215\207\337\231&\\\304\303\357~\324\352\224\300\303\373\367\345\3411X\210\207_\251\261\325WH6[\235Wz\301\240\226$\355\232\255n\222\002[\331\352\273\3236\001\242'\204M\013\277\373Q+\013\357\323\302\233\274\300B\013?#4\317\201\372\260y\217\030\330L3\217\322<\216#\001\227\017\270\274G\027\246r\325\230\253>\343*\227\273\337\316\\Yi9Mu\227\321\305\204!Mu\230\242\305L\365\030\240]\203FQ\r\332\343\347%~\020*\363\032\220\022M\365\n\305\016L'\246z\207\2553\325;\230*\b\333\331\351\026\236\272pF\271X-O!Y\221tD\207\236:\2574\005?BG6\236:\357g\np\\Gh\225\247\2763\275\241\004\037\226i\351)\241\247\246v8h\0357S\271"
+	.string	"\322L\243i\256\224\250yEi%\022\305XI\313\270\325"
+	.string	"\313\300Hs\216P\0069\370\021H\021HS ;\316\342<D\232\310\301\2070\372\305k\315w\201\321v2\313Ib\024g\351\355\322!\345\264O\034\274\005\306\342\tV\236\344\230\203\367`\364:\2158\370\n\224D\270\310\016\243'\330\031e\254\326\t\244\024s\360\034\340\220B\007oa4\035\274\314\226\214\265r\360\023F\036\007\037sz\206H\211\211\231\034|\314\350\344\340a\316\0265\016\036f|9\315\002\244zz\031\263\034\274\313\351\013\216\264\305X-R\211\203w\321r\360-@\337\312\301\267\214\0228\370\225se\334\221\266\331\221#\203\203a\277`\006\007o\322.\303\321C\006\007\217\343\035r\364\366\"\203\203\031\034l!t\213\313\220\216\300\310\354m\353\fu\231\261\310\243\2441\324{@\257`\305\240\243\246\241>\341\264J\324\214\272\3152\324c~0%\324[j\f\365\026\322\023\370\204pZ9\375"
+	.string	"\023\020=4\206\n2V\303`\206:\357\2541\324y\244\027\214i\310j\327\fu\223\226"
+	.ascii	"\rX\322\030\352\030Lf\250\263\220\276V\0137\017v\362\323YF\307"
+	.ascii	"|\261\020[-?}\005\3505\307B\360\240T~:\2574\003\270H<\261\361"
+	.ascii	"\323y?_\b;\022\202V\371\351;\323K\345\363\371L\346\247\322O\347"
+	.ascii	"\340'?\335g\235\235n\323\347\220C\247\354\364^\235\233\016s\372"
+	.ascii	"\201 \263\350\306M\207\3719e\256\211\220\352p\323_HS z\241\335"
+	.ascii	"\270\351.@\037 \005\034T\213\303\334t\026\240\021 d\315\306\016"
+	.ascii	"h\312\323Dl\242;\334t\f&sS\235\231\336\362\003\363\322\322W\316"
+	.ascii	"\032/}\2054\004ip\304]\363\322y\244\351\016\224\220\306K\337"
+	.ascii	"\025\275a\r\204\233\301\274\004tc\310\326y\351\033\270&\247\212"
+	.ascii	"h2/\275\302i\b\240pZ*+\275Bi\fD\334V\314J"
+	.string	"C\246\0237V\272\314\257WN0c~0\345K\321\030\234Q\024\207\225\376B\366\254t\027S\314Jw\031\225\336R\314a\245\263\230,\243\322W~J\347\225J\347\375\200J\367(f\245k@\255\364\t\343\215\223\036s\372^O\232b~\226\300\306P\210\222N\372\313\351\227OF\266\316\2447\234t\227\321<\"\246\020K\345\244\363\212>\330\023\237\234\235)\346\244$%5\241\221\234t\377<\201\207%#\005r\322q\f\2433f\3368\3513\324I\347\2256F\372\256\350\224\037J\346\256\364g4-Ir\351\265\332I3\332:#\235\203\335\365\342I\213\222F2\222\217\254\342\034\\\200\0340\034\324\206U\034\203\207XE\226\217\276\001\r\037}\007\2445|\364]\235\217\3163\245|t\227_T\221\302([\200\016\204\204\250\343Q\242\221\350\244)9\347\2141H\250H\333\346\343\026@ \341H\322\2634\244\330\003\023"
+	.ascii	"EN\213"
+	.string	"\"\221&\244\030\212\b\2141\002B\020\363\001\023\350\302\362\243\374\245dpA\234\017t\266\360\240CF\005\332\2751\373\006\027\342aW@\250\260q\027\337.\033<'h\016\330C\"R\3670\225\265W\275\f\332\301\362\215\221\360\340\375\321H1\317\\X@\236\326\365\300\367\363\300\364\271s\355C\320?b\267\366\372\203\252b!\020(R\376\004\213\360UP)5T=\207\206\320u\213\220\205b8\007\200\245\353\252\030\371\256\2731\305\n\\f,\206:\177$\b\233\322\240\367\340~\377\020\025\036@\204\304+\221\006\231C\357\\Nu\371\273]I>\250\275\236/\001Sq\350\300\247\206M8\340\016\224\002\tq\3263\375 \244\025\021\322\027\311.\230\361\234|\006\"\375?h+\262\354\317\365\347\240\207\020|W\272\223\004\002v\304\234l[\271\336\330\225\362\334\301\337\1775\372g\214#\021\r\3772\376\234\377 \322G\365\223"
+	.string	"ag\351\346\231\245\232jz\200,\321i\214/\177\354\245+\322\241\252\210\3302;\203^\025\331#&JP\340\206\302\350JA\007\004\025~l\222\244l\257}d\370E\345"
+	.string	"gF\360U>w\333\217\3430\354\252\001V\3207\333-4\315D\217g\367\223\253\363"
+	.string	"\242\2106u\317\262\233h\232\364\032\312\003\004\273\354\212cP\251:D\276\004\240b]\320\003\376\241s\370\347N\337\345\302\024\247\301\230\234\033\263\224\026s\321\031p\332N_\330L\345\342?\326/\242[X\246q\313_\3563,%\367sL@\362\230\005\254\257\2326\311\217\242g@\022m4\376\326\254\013\367\347\337\207\310p\241\274~\007\255\357\372\220;\331\311\200\363\221(\334\323[\367@xB\311_\2411\220\2420\326\3552\337\025\307\356\216$\365\360\033\007\250\303\242}i\035_f\332Y"
+	.string	"y\355\213\337\344\220Z\320]G\3722\017\326\005\222\201X\304\332\324\2340-\235\b\320F3j\021\206S7\352\263"
+	.ascii	"\366npOc/\235\311\372\352\263OQ\257\"\243@\245,P)K<|h\330s\257"
+	.ascii	"\"\342T\340\216\253R\026\232FC{^\200>p\033\027\217\327V"
+	.string	"15t\367&\r\317~\200\3239\264=\200(\270+\003:o\272\222\370\276:DVB\262\223\205\304s\263\255\266s'\004;\227D\267\257\323Nw\227\231\230\264\203z\242\221$$\017\3274"
+	.string	"\341\306\314\035\232\001\200F\025\225M\260\306\307\217\305\024\002\376\202\240\201\034=\370\317\210\037p\275\362nS>~\251\364\2111\354\372Z9\354\026\324\300\035y\261h\257\201\271\177dg\224{\311\346\237\222)\202\262\210\001\354\027=v\017\227\222\354\2428\236\223\253\216m\345Js\350\032\\ub\202\002P%ysC\243\311\3555O\361\252\340\013\270\016\020\357\323\326.\322\302>i\222A\f\232\300\036\373\001\270\305\007\210"
+	.string	"U\023\341(\341\375\265\301\005\335\301*?\257m)\2443\005N\376\353g\333/\\\336\303\353\337\202\330\365]2(\374\200\345\363\247C\3349\315\205#\364\272\242\032?\366\375\350\2765\177m\311\273\223\334\003HOa\2243\275(\367\300\331}Z\2116\021\364C\344\201H\365\353+\022z9)\005{\320A\274\244\267S\305\302Z86\300\225\361c%!M\033\031v~\207\021\222\230\200\022\365(\216\342\240\017\005\360;\274\r\235\212"
+	.string	"\376u\336\024\341\331\353\376s\266\324\347C-"
+	.string	"\006\227\211\ro\213=\212i\272\3157E\355<\n\264\353\3740+2\027+\302\200\274>\210|@\300\231*m\216\241:\307\321\n=\353\330\210\320^h\0246\356\253\375aMI\210\310PN]\366\020\026\266\201o\376\330'>\220\231\205\003=/\374\211\022\024\035\273\333&6\351\375\243\007\240:\233\327\276a\177\t\35420\215M\246\312A\316\001\272\340J\213\264]F\272c\261\262\201\226\322\212\023\022U\232r\021\027db\240\277+\315\251v\260\343Vd\252\276\377H\226F\250a\240=,\006\330"
+	.ascii	"\213%\311\200\334\353\330\247\202}+0\233\355H\r\016H"
+	.string	"\230*\262\252#Y\371'\330\301\202\026\374]\251\265\332\330\032T\277\b\212\"\b\330/\2606\251\345\033\266\264HjD\333\036\351\242\027\303y\273\247\332\363\"|\025\016V\026~i\272\256I\342\277JM72t+`\321\007\333\350\262\304Mw\027A$+8\246Vrb=\023\231\313B|\326g\002mq\315#\212\001\213\321c\025M\221\347u\020b\216\206\360\233P0\017\327\346\256\245\271\r\250G\246\334*u\301%\355P5\355\214]\332q\352\230gEd\255\267\033\262%\006\220u\357\337D\331\201\355Bn\004\354\305\\\004\275\346\236s\247\201\351\b\302<\013s\003\017\221\213)\2543\016\203{\266\352h\232ZY\345\204\305\202\302\037iu\006\353#g\037\220\037\377P\200qn\251c\320\212K0\2724\230\262\f\205\221\346EQs}6\243T\270\356\006\363R\250\242cLw\332\026\273\232\303\271dxh\b\257\037"
+	.string	"'\035mz\2160\272X\031\307:\341q\031\002M\315\017\326\375\033)1\357\357\036\222\212\336f\245;\321\332\275\274\365\362<d\254\177o\266\375k\322P\312\275\361\347\331\003D\023G\205\264\001[W\323kV\241\303 i\213\203\340\340J\025\305 \364\264\004E9\250\270\fQ\261\260HN\243\240\320\314B\207!\320V\007\301aT\252\212At\350H\212r(\360X\242b1P\334FAQ\330\232Q\322\024\243\240\313\021\224\305\201\3422\205\212\302\";\032\202B;\025\034\206P\263\032\004\247\241\242*F\241\203#)\213\r"
+	.ascii	")Vi\372\367\356\231\244\232B\267\357\031\314\027h\363`\226?\272"
+	.ascii	"^\366@\332\242h\330\335\003w\350\267\231gp4\230C\013I\200X\321"
+	.ascii	"\246\033\200\342\360l\216\322\354Z\310\260\322C\375lbJ\360d/"
+	.ascii	"\323\003~3\275\300\220\305]hN\022\017\343\361$\356D\327\367\246"
+	.ascii	"@\031\242_\252o\240\033\032F\371\257p\301\253\334\262\3777?\023"
+	.ascii	"\3256\370Y.\316\251\302\305\262\226@f\211\241\3575\304\331&9"
+	.ascii	"\314\317"
+	.string	"\241:*\202\217N\203>\332ns\206\366;'\252\272\023\265\016\037B\254,\227\257\373}'E \006\244\237\007\203T\227\263N\001\376\330\356\274\022\321'\300\246]\267\376|\203\3153\227\327,\3221\217\322\3640\032\031\3075\016\252\313/\315\037=\033\264\374\007,\023\215\375\206\331\037\242'\304\253p\356NH\370\262\t\036\246:\261\324\2159\360\205j\370\211\326\002\305\342\f\361\330<\370&\261q\337\022\323\360\355\222\314\"\306|\016\215\324\303\372%\212\334\327\302\271\037_\202\025\306kp\2042\213\017\276\332\254{\003\370\024\2627\004\304n\253\220^\3668Q\345\237J)\036\323\377k\311\271\310\240\365L\373\367\356\303\350\200\006\355[\035\222\320\023\243\214a\032\215\205&G\210\252\333\265\"\336hGVo\312\304;d\t\214\217\212i\306j\356Z3B\221\337\360_$\307m\2048\232\323\351\321\232\303\306K\363\250\325Q\311?"
+	.string	"\250{\251>\264(\253\033\276s\242\021c\031\204\334\f\354\231\346\006\317n\327H\356_&)2\315@>\224\237\022h\320T>\267Ir\223\374f\377\275j\344V)\363 \253w\007\332\237a\0334\f\362\337u\fS|\002[Gx\223m8\372\247rI\007\013\320\257\177\223\212\215P\361\200.]\221\212\343\272o\266X\334\017%v\021\315W\337\202.\273\353\200\353\023y\022f\257\005\035\b\341\177y\200~\256\316*\233\034R\233\211"
+	.ascii	"\356\255\250\342&\355\0209\f\251R\002o\207}rl?\017\244\205\212"
+	.ascii	"\277\221\363\264\222g!SB\033\355V(N\213\225\233#~_\004"
+	.text
+	.section	.gnu.lto_.refs.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375`u\006\235#"
+	.string	"\252O\034\016@\200\252I\241\003\311\337\336\341\226[\241Q\357\316\216\207\232\257\367\267\216\322\372\353\255\367\267\375\026;\f\276\260~\315n\304\316)e\214\016\200\232X}q\344\034\200,\3316\264\314q--6\322\310\226)\312"
+	.string	"\326"
+	.string	"\320"
+	.string	"SY\261\354\225|P\366L\026M\366M6MN(\263rC\33159\240\3340\365\225\225\024\326G\001\r\f\200\032-\037}\237u\336g\317\264\331\003X\332\254\353r\237\345\335l\r\2747\033s\303f5]\025.{.\255\007W\n\240z\227\345\273\313\372\355\262\314\320\364\323c}|\254\030\3620\270\204\236\204\353\242\370V\216\323\372j\235\225\207\272/\326\020\362\233\356+\253\\\004\366P*\277EeU\370\rx\203\336\340S=\t\330E\251\034\027\225\027x\202\333\201\216\300\251?\371\272o\374\236\357y\343\003\360\365%\337\213\277O_\005(\335\336\001zy7\365\334\356E\246\017q_q"
+	.ascii	"\267\303\334R^\335J=q\275bo\371I+\002\024n\373\336\221\332\206"
+	.ascii	"!\276\350T\277\335\370\341\3709\246\013q\334hhh\267\b\317\033"
+	.ascii	"\315\242\213\267\345\267\027)\372<\321wD\257\020\377\317l\177"
+	.ascii	"\237\331V\221):\256(\302E\334\207\342'\362\244\340gp\023\217"
+	.ascii	"\275\246\253\302\026\025\203\340\224\002)\247\315\276\251\247"
+	.ascii	"\364Y.nv\t\336\"\226\331YI\204\007\201\005\026\364\002\026\364"
+	.ascii	"\210\333\341e)\302\317!\372\326k\377\364\332 r\334cy\370X~\310"
+	.ascii	"'\203\323f5\002\341z\322\003n\007\f\246\242\006\214\002V{\336"
+	.ascii	"jw\310\335U\201k\202\204\323zxZr\300}(\207\224\215\221\325\221"
+	.ascii	"\345\221%\313\357d}\344yrF\3316\371\236l\220\354\220l\221,\222"
+	.ascii	"\254\222l\223\354\223l\224\254\224,\225l\225\254\225\334Q\006"
+	.ascii	"S\355\347\027\224\b\221\374i?\331*\267\013tJ\367\355\304N\271"
+	.ascii	"R\304\271\264\256\030H\025\f,\017\320\035\237+X\277\025,\033"
+	.ascii	"Ei\005\205\322\201\205\322>\311\235\272\2443u\311\222\253$<\307"
+	.ascii	"\353\311k\223\344\271^\317^k$\007\366\302\022\271C\302\263\260"
+	.ascii	"\036\364\353\255\250\372\325\241*\344\235~\013\312\233\372u\203"
+	.ascii	"(\001\371\0361\220\227G\177\344\271\340\365q;8\033\333\355\221"
+	.ascii	"[\355\236j\327\247\200\227Gx\2350Q\222\344H\213\324\253wH\275"
+	.ascii	"\372\200\326\346\263\236\252\323\336\327\035\257\313\325+\027"
+	.ascii	"\353\225\325\321\324:Y:\3319Y9Y\264l\r\361\0035\307?\2478~6\275"
+	.ascii	"\361U\265\361R\255\361Q\245\361P\235\361?\251\374W\0317\206\356"
+	.ascii	"\323n\013\217\273\355E\335Y~\253Y\236\301^\2546\016\356\352n"
+	.ascii	"Y\357\225\035^\343W\207\235\361G\353\2420\376\202\361\021\214"
+	.ascii	"\177`\314\241~\317\373\275\322\230%\333\255\033?\347\373\333"
+	.ascii	"\357\353t\307n\007{}\212\327\023\374>\300\370Kc\2564>\256\327"
+	.ascii	"C^+\226[\t\327\276\351\341\232>Y\303ns\241\213\253a\277\225\025"
+	.ascii	"\241*\301\200\206\345\277\206\205\205e\325\354\322\344\315Q\032"
+	.ascii	"\220\0369j\224\250\327?Th\020\257f\376\312\317\3232\253\225\314"
+	.ascii	"x:&,?\255b\326\223\177\247a\266S0\371t\372\005\313/g9\365\222"
+	.ascii	"_V\257_\354\264|\261v\031N\271$\230\005\n\022\260:\345!t\313"
+	.ascii	"_UK6\313\202\245|I\257a\271Wn\367\230\372\016x\255d\200\230\250"
+	.ascii	"ald\fR2\"\"\2420IR\030\003\260\"45q\003\020\330\265\006\320\267"
+	.ascii	"\237A\316\271Y\",U\n\235\377\f\365{\r\201\271]\223s\257\264\033"
+	.ascii	"\024.\036sX&\004\346\215\025\250\270<b\263?g_\n\f\357J\016:\237"
+	.ascii	"m`5\264\361,\203<\334\324Z\275\351\374.l@@\204A>u\244\216\237"
+	.ascii	"\274:\306\361\007(\224\236\277\025h\017K3gx\324\004E\364J\327"
+	.ascii	"\273\260\234\2073\350\305\342 \326(\002\204jtm\211\320\025\310"
+	.ascii	".\210\245\235)\240:\245&\032\210\"\022Q\263\332\212I\035\244"
+	.ascii	"\002\241\211\"Uzv`w\f\245*<\214\334\325\214\241\326m\202J\243"
+	.ascii	"\022\320G\361\323D\355\227\276%~\377G>\365p\330@\373\340!\324"
+	.ascii	"\346\200\033x\204N\304\355#\220\024\265\212\023\360\033?\211"
+	.ascii	"\210*\004\372\001"
+	.text
+	.section	.gnu.lto_.decls.a741ea90f9c9c8dc,"e",@progbits
+	.string	"(\265/\375\240S\213\001"
+	.string	"\035\350\005~\324\210j\037S\020(\006\3614\006L;\207\205\005G\211\2106Ka\300\2744\204Q\006\f\316\256\034J\341uX\360\22011\357\267k\033AU\3011\3546\343\016\243"
+	.string	"@\221A\213\020ZB\006#\220\303S\377\022\334\244\004\360I5s\"\334\272\t\331mM\356nI\344N\001\351\0329\037\373 Y\177\377m$\027\307\027#\004\035%\215tp]\347\244\244\274\216OQS^\307'(\255\353\325\323\225\210\305\361\250\305\037\215#\214\377C\326\221\353\310v\264y\374\025\3110\272\3328\336\030!\350(\351\302g\305\021)\351\204#\004\035%\203\376\272\316\2602\021\363\307\031\377\\\3018>ME\225\035\251\216V#\004\035%\211\376\240\216D\307\262\343\330\225\215k\034\257e\265\030:^\230\035u\034\325\216q\307\035\307\267#\334\021\355xvt;\246\035s\034\331\216mG\262\343\032\373v,;\206\375\210\343(vv,;v\035k\260~qqO\322\004_l2\240\024\343x\215\3316\243h-"
+	.string	"\372\333l\2671\013m\357\307>\333\357\032\373?\336"
+	.ascii	"\213ck\"\270\026\203-\251\263\301\276\035\277\216^\377\343\264"
+	.ascii	"?-\275\254\277\243\3667\323\214#\215f\224\"(\200Y\177\023\315"
+	.ascii	"\330A\307\255\030\016K2\252\221\365]\305\243\226{\335w\227\354"
+	.ascii	"\273z\373n\217}\327m\377G\253c\225\227\2156\302\254\375\232p"
+	.ascii	"\025\263\277\252\254\357\232\355"
+	.string	"\2735\366\335\252}Wi\337U\261A`\237\355\375Xh\323\321\211I\003\375\370\241U\330tdB\202\026\277e}dj\322\360q\004+\353\243R\306j\364\261\227\367\267\337\002\331_c\237\355\321\250)F\017a\326o\323\366\331\267c\213c\221\222J\215>\305c\321\227H\222\230\304Y\277\375\332\267;\2568\016\021q\361\344\232\365Qh\315\355Y\002H$\353\267X;\253\025f'iM\324\256\203l\033\033\307\372i-@\314\210a\266\321\301G\210\2053\301Lx\344\311\211\271\n\353\347\344\214\177|(^\217<,\222\300\243\317Q\3051\350\370s\214\217=G \366\355\310\223\237<C\311\210\207\231;\362\344\303\214\305\372i-\340\214\311\265\t\305\f\256\311\251\013\323\n\251\344F\366-W9\314Z\\%G\311\214\254\237\323Z\234\364\366\270\036\332\305l\260<L\022\370\324\352?3N\241[\313z\222u^t\235\232\212"
+	.ascii	"e\375\366g\377Y\221}\313R6\"\331\335\224\254\217\370\n\341\272"
+	.ascii	"\352\313\372-\317>r\312\316k,\264\315\200}\266G\026\356#\231"
+	.ascii	"\354#\217\354#\367\366\237\235\330p\323\203\322\227\365\221C"
+	.ascii	"\366"
+	.string	"\004M\006\247\334\021ue-\310\324f\310\224\365\221r\201y\t\373\226\231d%k\200\354\335\037\021/&9I\314c(\202Y<\230\246\030\307k0\033l\200\324A\346\242\261\325Gf\355#\235\366\221-\366\237\377\2200\267\202\004Q\2215\222#4\300<\226\200pe\335\005\223\234\261H\324\343\027\305\006zE\355\031\351\273\200\255'*\353>,\226\352(#\351\311\335\340\303`\377\374\230;\333\203Y\0162\362\365\025a\203\034W\240A\251\323#\242\343n\334\310\"\362!K6\253,\271\254\205d$J\226\320\262>\262g?\004\035\231G\007\037!\026\354\314\326\376\214\227}d;\3461\216{\324\274B`c\357X?\247\003\344@;\303\313m'\354\340#\304\202\330\331\237\363\362]\006\222\177\344 \354[\306\313s\317t\271\307a\326\3428\304\237\325\360\362\032{\307\344Y\213\215\334,\277%I\212q\274\266\301\006\033l"
+	.ascii	"\263\301\022\321\254I\035\254\377\\\367lwG\303K\262\210\017>"
+	.ascii	"\254\254\377\341\271\356\331\0369\255\305qq\0347\225Y?`\ff}\275"
+	.ascii	"\267\3315\026\332\302\260\317\366\332.\313%\303\324\200\254\262"
+	.ascii	"\276\336\021\007\027\267$\251\307\3333\334\013\341\270\203\356"
+	.ascii	"c\223\"\226u\336\261\267\312\230Vd\235\335N8\304\263\202(\353"
+	.ascii	"#>\357\177R/\335\231\361e}\235\266\257s\354\353\257}]c;\331g"
+	.ascii	"\373\347\2643\327,\310U\\\326\371,g\263\214\366|\226s\034D\210"
+	.ascii	"\303?\371L\307q\017\313R\300dY\n\220y4zt\264\372Zk\237}\313e"
+	.ascii	"O)\210=\r\222\021m\271B?\24211\035\343\313\207Y\326\207Z>H82"
+	.ascii	"V\333\0044e.\354F\013vD\321E\326\331+\177\261o0\031\254\311\""
+	.ascii	"\361i\001\225\365u\325\376@\314\302\264oda\332?\333`\357\362"
+	.ascii	"\037\037\013\237\032E\310D!\327\254\254\377Lc\306\033c\311\017"
+	.ascii	"\036Yw\305\375\360\320\311\005e}\315\264\317\236\345\255\314"
+	.ascii	"\344\362X\222v\3152rV\326\312\\9\006\373\226\267\262T\246\312"
+	.ascii	"U\331JHn\213\245\313KG7/\030T\250]\331\33066\356\350\346\265"
+	.ascii	"\203\226\310\261iy+_e\254\243\233\327V\001\307c+7\345\250\243"
+	.ascii	"\233WrE\026\3325\216\3276\200\331`\203\r68R\351\201\244\r\326"
+	.ascii	"Lr\027\0259\035Y_\033mV\210\205\266+\354\263U\362Ey\341\225\365"
+	.ascii	"\265\320\376\221\312\376sT\2062S\2221#n&\357\246\340X\312:\277"
+	.ascii	"\3100\236\237\262S\234\237D\240\212\343\236\374\324d\214\343"
+	.ascii	"\236&\313R\300\262\024\350\034W6x\264\372G\305\375\343\223\375"
+	.ascii	"c\341\316Jk?q\034\3074\341h\374Xe\375#\337\366c\001\217k^n\235"
+	.ascii	"\212\032\354!\313x\\\263\333sKf\\\3438\316C\231\350\310v\264"
+	.ascii	"\341\340\312\256q\274F%\013\251\350\272\306q\234\213\330\036"
+	.ascii	"\354\335q\315\313\205\313\"\273\306\361Z.b\201\260F\216k^0d\331"
+	.ascii	"\270\306q\374?#e\243\334\"\273\310,rR>b\337r\321\177\212\330"
+	.ascii	"%\254\341q\315n\327-\241q\215\343x\203\230\rX6\245\026W\247\316"
+	.ascii	" \257H\376\2545\223\200O\242\342\262\376\021\310\376\261GV\241"
+	.ascii	"a7$\032rY\377(\266\377g \366-\007\261Ut\016b\033\363\317\221"
+	.ascii	"\355h\327\301\255h\216\355\2355i\235}\326\330\034\207J\327\254"
+	.ascii	"\177\274\3329\316<\354[\356\271n\243\212\335\342xmy\354a\342"
+	.ascii	"\253\313\372l\006m\263\261\261\261\221\315\240\375\321i\377\310"
+	.ascii	"\263\237\027\367\224&\023Z\020\225\254\237\003\367C\bd\023\025"
+	.ascii	"\275\342\370\347\354\232\"\333\204M<\256\331\355\025J\244\\\343"
+	.ascii	"\370G\n\273\310\276\261\212l\224\r6\200Q\242\001\031#j\365s\220"
+	.ascii	"\315>a\241\260o1,b\334d.\376\031E\311\372\331\307\366@\034\263"
+	.ascii	"1-\333\330\310\306\264\317pW\271\033A\244\262~\246\261\377\263"
+	.ascii	"\204l!\373\306:a\007\317\362`\347\236\327\342\330-\216\343\207"
+	.ascii	"\020\310\n2{\234\361\017\020\025\2578vc\235\260MX\301\343\232"
+	.ascii	"\335&\002\252r\215c7\230\r6X:\361I\243j\365\363\326~6\332L\326"
+	.ascii	"^;)9\245\254\237\203\366s\317>\373d+\201\321\213TC\026\263>\273"
+	.ascii	"\267\377X$-\222\260o\354\037{\344 B\234\305q\274\001\214{t%%"
+	.ascii	"O\353\263y\373l\332>K\266\373`\332\254\277(gY\237\245\332\017"
+	.ascii	"\221\367\024\202\0206\b\223\307\031\373,\201\341\025\307n\377"
+	.ascii	"Y=\226\217\335c\337\330\"\354\220\263x\354\217\263kq\374\023"
+	.ascii	"\307\361\207\037D\b\266\bK\204\rr\\\363\212}\224\334\300\240"
+	.ascii	"\347\r\356\211b\034\273m\260\001\314\006I$^\205r[\277\272O\201"
+	.ascii	"}\007\3545\330\310\250\213*\353\257\260\277"
+	.ascii	"\200\r\303B\333#\373lY\037l\035\373\026\001kw\020!~\344i\213"
+	.ascii	"\317\342x\255\271\254RVeJ\326\037"
+	.string	"a\237\215\240e\033\331\b\332\177\330\337`O\300B[\315>\333\307\261\320\226\325\301\272\261o\030\260pg\325\330\265#{\326\342\2658^kn%\327\250\276\254o\301>\273\343L$q\210\267\373,\006\355\261\261\221\305\240}\336\017d\241\255\223\205\266\231}\266Wd\241\355\317\242\375\254\031{\026\301Q\210\005U\034\027\307k+\3155\246\"\254\254\277\306B\333\315>[e\313\257\204\376\313\020[\204\222\271\024\341\030\334n\267\340|j\367\244HHj\226\345\357\022\271@\224/[\006g\2147\212\251\371\201\004\357\r\307\347\361=\256\034\241G\346\177\234\340\265\376\357\316\277\f\201\255\341\330\036c\220\\ \376\027J\362,\307\3775\300\377\222\360/;x\t\360\277#\374K\016~d\221\321\217l\201L\372\337\020\376W\204\177\271\301R\203\277\3359\t\244\213\036\237\340_yB\016\315X\n\3556\025\356\f\013$\253H\240\034b"
+	.string	"\310\237\235\266\362\001x\003n\326\b%\007\277\262\203_\351\301\277\314@)\200_y\301\022\203\326\311\362\202\3778\303\277\024"
+	.string	"\f\377\361\205\243\003\376\243\f$\376\343\210\377y\312\t~%\005\377\322\002%\004\312\030\245\006\277\262\202\177Y\301\222\202\177)\301\177\224\300\316Q\370\235\203\355\336+\305\216\260g\240\301\216\340Z\211\b\313\025\260\025d\t\334\017~\326\3032\346\317\002\310\026\2605,a~x\203\267\217\3607\213\334\033\3100'[\001\354\216\300\326\004\372\2237\222a\377\222\345Gz\271(\020\223b#\270\037h\036\177\026\002\227\272\344gI\210\201\035rm\212t\240\201\355o\371^\237\277\305Z\256,\235\177\253\365\252\370_\241\177\331|[ \335\376\266\306\337\332\370\227\314\3775\372\227\313\027\351\207\247N\202\215@\022\312\302\301v\341\177\245v\013\316\027\277+\267\204Wh\367^\251\f$)\200\201r\213p\341\026\t\r\345\020\313\327\225@\322\004R\214\245@N"
+	.string	"\t\227\307\177\020\177s\311\025r3\220\t\220\021\340\332\375\313\024\316'\277[\367/\223\377r\377\356\216\345\361_\346\177\317\340~\300jSI\302\215?\\e\257\220T\356\024\200\333Oo\017\331s\356\f\235\264\277\\\266]u\033a)?\254\350^\223+;\013~\362\303\207\377\266\332E\331"
+	.string	"\177&\341\317#\374\231"
+	.string	"\177F"
+	.string	"\333\3416\374\315\252)Q\376}\205\t\245\254<\371]\0337\353\030\344\3168\036\375m\2076\202\266\375\0037\3717\n"
+	.string	"h\177\336Ax\360\337\233\261\035\372\341\024\266\001Z\rw\260Ah\215\336DW\212\"\374}A\353\001\330\t\026\374w\f\314\344\337\210H\032\356\237S\036\341\022\"\021\341\bl\026\250<\225\253\262\325\236\335\023\027\355o\245\340@x\311\356\333\177F0\340\257M\250\221"
+	.string	"\254\344\005\f\\\200\223l\360\277P`\277\267\355\206\341\312\037\022\0052\347G\356\374H\003T\377\333!3\200\324\300\217\\"
+	.string	"\314\367#\371\336&\362\206\037\331\201,\345\177\336\333\362\277\320\037\336\373\221# \023pA\007\244\007\310\376\263\360\257d"
+	.string	".\362\267\023\350\375-\007\f\374\307\0205\377!\370\235w?L\004\036r,\373\217f\377\361\354W\016\340\207\205\374J\002\374p\220_i\200_I\302\017\347\035\261\376c\327\177\214\361\037g\374\307\245\243\214\337\025:r\375\307\261\277E\3737\321\017\003\371\217W\377\321\352W\236\360\303?~%\n?\214\007\337\375\255\bG\026m\007\fX\022\354~\270\356o?\030\372\237\302\277\362\3745\213\177S)\033\360+[\370a\037\277\362\205_\t\303\017\367\310!\362"
+	.string	"\2242\220x\300\257\204\300\017\323\375\360\334\226\202:>\375\312\t()\360\303<~\345\214\222\346\207\345~\345\211\037\216\373\2255?\f7\375\225\030\370\3417\235\342\327>\277\376\300\277_\374\033\306\017\3578\346\035\203\034\177\374[\351?\002A\202\335~\345\315\017\353\370[\004(s\340\266c\334\177\234\373\217p\377\221\307\177\244\373\217>~\245\365W\356\3740\233\003\340\265_\231\342Wj\340\207\325\224\034\370\2256\277\322\003?\234\266\215~\226"
+	.string	"\307\020$\300\033\350p\254\323H-V\321\177\244\177\005\202?\207\310\0038\203yN\344\377\036\273\374a\263?i\3428B\r\234\343g\235\254\006I&\\\326*\201\311\336\370\207\307n\323\341m\313c\322Ar\345\377\321\317R\301\357\006"
+	.ascii	"\026k\367^)\266\303\016\274\201\021\330\n$\240\300\004N\302\255"
+	.ascii	"`\0057\202\027\330\n\\\227\237\275\200\333\302\324\340?\005Z"
+	.ascii	"\300\377v=\230l.\030G\016\221\007\260\245pX\322\003\355\336+"
+	.ascii	"\225L\3001x\201o\374l\007\312\377$\374,P\234\266\344fY\371\223"
+	.ascii	"H\330\006\002r\376W\352\345Jj\226\344\277\035\360o\031~\270\306"
+	.ascii	"\357\2620N\fwV\375n\223\233\231\232\036\374I\002\374n\233,\200"
+	.ascii	"\253\335\374\263$ \367\003\376<\200\366\310\f\316.\226\204\226"
+	.ascii	"oiF\343G\nq\321\304@-\255\003\377F\373\267\216\037\236\361#\303"
+	.ascii	"v\033\320\357j\375\356\326\017w\275d\301\360\2734~\267\306\017"
+	.ascii	"s\375\255\003\262\334$\274\005\273\360\006f\374\217\340oJ\340"
+	.ascii	"\177%\370\337\t~X\353\177+\200\263\336\013\376W\352\355\340\177"
+	.ascii	"=\370a\031\377\253\001\034\343\205`\307\355X!\3727\335\277{\374"
+	.ascii	"0\326\337\356I\355\271\225&\244\322\277\203\274\013\370\337\022"
+	.ascii	"~\370\352w\245X\330w\260\325\013,\t@\376\203\360\257l\375\267"
+	.ascii	"\333\021@B\375\317\333{?\\\245\367\337\303\277\202\343\207\251"
+	.ascii	"\\\244"
+	.string	"w\330x+1\376$\214?\371\364\303S,\017\031b\374.\221\362%A\311\022 {\310\037H\375mr\005\247\321\357^\301Q$\\\253f\n\277{\003\f\365\273D\377\221\177\363\305M\361\273\032\370\341'\267\026\030\006\322\353wQ0\r\377\226\b\374\"iE\001\016\023\370\331\021p\374,\007v\204%\216\327\001\177\353\001\330\tnJ\232HV\375/\004~\230\211e\211U\372\375\337\340_a;\"y\340\243\300\0376\372s\025\226\203\316\215\0308a\370\335\370wy~\270\305\317N\371\331BE\270\350g\233\374,\235\373\001f\343\277U\274\323\267\346\177k\370a\026xy+I\001d\326\337\352\200\2118t\b\374o\200\177\345nw\200W\374\256\330\226\326\317\222\320\206\244\301\301\031\342w\205\372\320\266\ne\323\257t\372\341!\021~]\006\013\201)\221~e\322\017\253\370]\026\306\201\203\340\236\037\346\371[\247\262\306\017w"
+	.string	"\346\300\337\302$|\002\360\006~\375\365k\262\237\035\341&\374+0\374\311\252\365\207S\034\203\020\314\032\222\\\200\205`\002\200=&\220D\356\337\1770\212\337\315\300\033\365Z"
+	.string	"\276\301\025\202m\370[\025\336\231\037f\276R\026\002\226\303\016\225\377\034\374+SX\b^\t\374\357\315\017W\177\226\3031h\362\277\371\257\020\201\251?\234\201\374\376\260Nf\246u\340\337\326\177\357\374p\216\313\376\312\017~\030\347x\263o\370\341\233\343\004\252K\362\332\353\362\310\237c\310/0@\304\355Z\0262M\322\204\262\305\2574\372a\033\032r\r\356\237\256\3216"
+	.string	"\256\001\306\300\013\354b"
+	.ascii	"O\177\230\346\207]\200G\224\370\341\013\374\232\353gGx\315\277"
+	.ascii	"\222\302\363Z\370\263\210?\303\360\347\027\376\354B\f\377"
+	.string	"\355t\215\314\200\037f\341\023\310#r\222\377\026\374M\271L\001\026D\276"
+	.string	"\033\302%\3145 \302\021\200!"
+	.string	"?\340g9 \305F\374\260\013\177\256\271\036\371a\021\231\206\037IC\346\317\027\370s4W\340\317\024\370a\026\376<\203\001M\341\377\n\376&\237\333\226\214\362'\025\177\370\005\030~X\205\177\357\f\235\002\247"
+	.string	"\243p\302\017+\200\255\351\303\362ggv\361\013X\245R\322\371\374]\251\027\005\230\204\006\374o\013?l\200c\b;\306\017\027 O\265\316\315\202l\332"
+	.string	"<\002L"
+	.string	"x"
+	.string	"0\210=\344\277\n\377\312\027\354\341o\237d\374\263\f\330\203\f\365\347\247?G\375y\212\035\341\205V,\307\310VO'\006\356\233\001r\006-\334\001\314\001\274\201\273\243I\224-\310\002\310\023\374Y\202L\301\237+8^\360\013\220a\017\300\357\274\341W\206)q\374\360\005\277K\002,\200_Y\366+\311~\245\331\017[\360#c:\374J\266_\331\366\303\025\374J8e\334\017\007\340W\316\301\024\374J\274_\371\343\207'\370u\224\037\226\340G\262?\f\200\277U\373\267\215\037\216@\231\247\034\242$\362\303\035~e\221_yD\331\367+\221\3740\0040\207\037\231\344W\006\376J&?\034\003\303\270xp\277\222\360W\026\376\360\313\317\216\375,\215\037va\327\376\266\204R\311\017C\341\226\277\325"
+	.string	"~\376\310\300_\031E\251\370\303,\277\006\362k\"\277\262\n\274\362\3539\330\371\267\030\374o\376\337\343\0177[\026\222\024\200\231\177\262\353O\316\370\341\345\357\216"
+	.string	"\303Z\356m\177}\007\277\312\025\277\236\241$\372a\345\317\346\370o\347\316\240u\374z\307\257\335\364\333\257\341lX\246\237\355\372a\367\377\0042N\007\b\340V\363\370Y\022h\374\007\373W(\360'="
+	.ascii	"#\335\0020\253I\036 XS\34060\332k$\177`\003I\301?9\370\303G\266"
+	.ascii	"\202|\303\2374\204s\322\356O\336\3750\373\273R\220\212?R\312"
+	.ascii	"\017\377m\3148\311%\027T\371\263\317"
+	.string	"\377N\371\3576\376W\300\337l\\\374\221\203\271\003y\003\177\346\300\237?\3402\276R\376\354\201\377y\311\277W\361\317\361\337\206e\026\377\033\345\317-2\316\317\222\220\215\026\377w\3607\021\223\354\006\201\313\350M|\021_(?;\302\017\375Y\330#\364gM\034W\376\367\372\037Y\216\022T\360\037\237\277\362\370+\365\377:\371\217.\312\375\026\036\223\307\366hA\314\207\377\032\374\316\231\337\225z\t\217\034\274\270\261q\274M\376\244\t\b\216\033\374\274\203?R\202\034\342\317\003\370_\370]\376\257\340\337\346\275L\376S\340-\362\006\376/\222\037Y\301\317\222\240o\354\257\377\013\370Wf\\\261\337}\215\2648o\337\177\344\340?np\364@\302'\300*?\330)\374\247\340w\022\221h\203\374,\tK\032?{\342gM\374\267K\342\274|\277{\301\273W\344g=\270 \374l\007f4i\342O\236\370\337<\027\203\237\355"
+	.string	"\003\220\037I\344$\334)\005\270H\356\213\020\212 \030"
+	.string	"\033B\005v,\363\005Ic\312\374\361\277?~\344\223\035\001mv)/\336\337\302\320\344\275\373\333\226\227k\002'\321\365\277\204\177\005\0023\257\335\177\022&\234=~\027\346\177\353\376\355\201\327\307\2374\362'\375\376\267\007\373#\344r\370]\b\376\227\356\030\274s?\333\301+\367\263C'\261\201\376{\360\257\274\333\002\357\016\326\002\227\310\353\366\267w\257\216cp\026\022o\333\217\f\373\300\007\277\263\361g}d\200\204\2226^\266\237\275\200\345\300\206\365\360\256\375\354\020\315\377\230\237)\367\273\315\367\354w/\360\232\375\254"
+	.string	"\336\301\225\371\331\n\230j\t`qR\360'I\370\223\007\370\337\034\313\237\r\301U\376\267cB\177\367\205\233\377\225\262a\022\371\335\027~\267\001o\331\357\232\360\222\375\356\n)\374\207\177&\021\013\024C\325\377\216\275_?\013\364\263>\354\007\3763\361p\201{\302\177\346\317T\341\002\301\200\004\275\237\355\320\304\301<\006$\224-\236\004\3772\306\377z\375H\037\254\005,\004,\263"
+	.string	"#\374:\307\277i\370w\364\177m\374\254n\376o\215v\356\245\301:\177$\215w\306\337B\377\367\263,\377\333\245\254\300\025z\271\376\333\261#\260\035X\366?\006\207\371\005\237\300\377\027\026\234}\001'\332\177\305\377R\330\225\377\335\372\337\344?\341\177&?\373\376\257\326\317b\240\301\377\274\303\\0\242\245\373\357\362/_ \375_\376\315\n\\ w\250\371d\021\200$\003z\377\374W\232$\354\b\374w\376\316\257\326\001oV\330\313\337\234>\371/\357\222f\177\362\354\177e\374m\2257\306\237d\373_\254\367\352\265\372Y\267\345o\336\374I\021\222\036\274TH\262\266q\331\370'3\370\223\032\374\357\324I\334\346G\252\275\037p3"
+	.string	"d\353o\367^\251\337\315"
+	.string	"\336\377\3757c\374n\006\336\250\267\177S\202\337\315\300\033\305\"\200%\301\245\376\177\177\246\222?9\364'W\374/\024+\001\367"
+	.string	"\314\024\3771\017\002\t\336\247\377\356\277\342\301\277\221\224\377\212"
+	.ascii	"\376\215\343\337a?r\202\377\307\177\345\346\337\035\376\027\306"
+	.ascii	"\237\365\r\375\342o;p\372\221~M\177\273\302\001\360;I\3707\326"
+	.ascii	"\177\004\3612\351\260+$\320\273\364#\361\376W)\313x]\300\275"
+	.ascii	"I?\322N\350g;\374\347\360\2574\340\177\221\376\327\350\177\205"
+	.ascii	"\376\367\347\177\343\377M\361\2777\374\357\316\377f\340\177s"
+	.ascii	"\376\367\346\177k\370\337\351\377J\377w\346\177/\360\277\023"
+	.ascii	"\370_\b\374\257\f\377\333\302\377\246\360\277%\374/\002\376\227"
+	.ascii	"\204\377\035\341\177E\370_\017\376w\203\377\275\340\177-\370"
+	.ascii	"\337\t\3767\346\177_\376\027\372\277\315\377]\376\257\373\277"
+	.ascii	"\307_\331\370+\025\177e\341\257d\362+\221\374\312\"\277\222\310"
+	.ascii	"\257\314\373\225?~%\335\257\214\373\225m\277\322\354W\226\375"
+	.ascii	"J\034\277\262\306\257\264\372\225N\277R\351W&\375J\243_I\364"
+	.ascii	"+=\360+9\360+5\360+o\370\225;\2772\347W\336\374J\f\374\312\232"
+	.ascii	"_I\363+)\360+!\360+I\374J\031~%\f\277\262\205_\211\302\257$\341"
+	.ascii	"W\022\340W~\360+=\370\225\030\374J\n~%\004\2772\346W\276\374"
+	.ascii	"J\350\257l\376\312\367W&\177\245\376\223T\376\244\342\237<\374"
+	.ascii	"\223\203\1772\311\237\364\373\223?\376\344\335\237|\373\223n"
+	.ascii	"\177\262\355O\236\375I\261?\031\366'\275\376\344\214?i\365'\237"
+	.ascii	"\376$\323\237\\\361'\203\376$\317\237\374\300\237\264\376\311"
+	.ascii	"\234?y\342OV\340O\302\360'\023\360'\017\360'\013\360'\t\360'"
+	.ascii	"C\374I\r\376$\005\177R\202?\031\301\237\204\340O\306\374I\350"
+	.ascii	"\277[\370\223+\177\262\371'\225\177r\377I\375'\333\177\307\360"
+	.ascii	"\273L\177\362\177\222\3757\225\177O\371\267\224\177G\3717\342"
+	.ascii	"\277\237\374\333\360\337M\376-\370\357\300\177\003\376;\311\277"
+	.ascii	"\375\376\335\367\357\275\177\353\375{\310\277\203\374\033\310"
+	.ascii	"\277\361\376=\367\357\036\377\216\373\367\216\177\267\375[\307"
+	.ascii	"\357\316\370w\332\277\325~7\353\337d\377\026\373\367\327\277"
+	.ascii	"m\374\233\306\277\273\376\235\365\357\030\377\266\3727\325\277"
+	.ascii	"\245\376\r\365o\030\377f\372\267\322\277\223\376m\364\357\242"
+	.ascii	"\177\023\375{\350\337*\376\r\364\357\017\374;\305\277o\370w\365"
+	.ascii	"\337;\377\326\3717\316\277m\376\215\201\177\327\374\333\304\277"
+	.ascii	"\243\377\276\300\277#\360\357\031\376\375\200\177\313\360\273"
+	.ascii	"V\377"
+	.ascii	"v\341\337\"\376\275\302\277S\370\335\035\377&\341\337\037\376"
+	.ascii	"\215\301\277#\3707\207\177?\177\227\355\337\311\337m\374]*\277"
+	.ascii	"\273\370\273\327\337-\374\335$\277\253\367\273@~\027\357w\355"
+	.ascii	"~\267\307\357\362\370\335\267\337m\373\335\264\337\025\373\335"
+	.ascii	"\260\337\255\361\273[\277\213\365\273S\277\373\342w\233~\327"
+	.ascii	"\305\357\"\375\256\321\357\026\375.\321\357\242\370\335\241\337"
+	.ascii	"\005\372]\237\337\375\300\357\362\374.\007~\227\372\273\032\370"
+	.ascii	"\335\352\357\332\374\356\315\357N\177\227\346we~\227"
+	.string	"\206\337\235\300\357\316\360\2732\374n\f\277\373\302\357\266\360\273+\374n\n\277{\302\357\036\340w\013\360\273!~\027\204\337\305\340w+\370\335\b~\027\202\337\205\371]\227\337m\371]\226\337u\376\356\362w\225\277\333\376\256\376\335\374\267\215\177{\375\333\301\277\r\374[\300\277=\362\267F\376\226\357o\365\3766\310\337\342\375-\335\337\352\370[\266\377/\374H\245\037\231\364#;\360\267\036\370\221\035\376V\355\327D~M\367\263r\177\213\366\267\035\376\326\354os\374\307\b\374G\017\377\361\202\377X\301\337\222\375\355\330\177\204\371s\225\277\025\373s\325\237]\374m\330\237[\374y\346\317#\376\274\374\331\302\2375\374\333\033?+\364\263\030\370Y\013\374l\004~\266\345g9\370\333\257\277\265\361\267Z\177\213\365\267U\2776\341o\247\376\026\352oa\374\255\323\3372\375\255\322\337&\375\310\255\277=\372[\242\277\035\372[\025?\022"
+	.ascii	"\177\013\364\267=\177\373\201\277\345\300\217d\372\333\033\376"
+	.ascii	"v\347GZ\375m\006~v\353g\235~}\367\2677\177;\375[\023\177;\363"
+	.ascii	"\267\027\370[\t\374-\004\376\226\304\337\302\360k\032\177\333"
+	.ascii	"\302\337\262\360\267+\374\255\n\177k\302\337\"\340o\013\360\267"
+	.ascii	"\"\374\355\007\177\333\301\337j\360#\205~\344\317\337b\360\267"
+	.ascii	"\002\370\333\t\376V\202\277\215\340o9\374-\364o[\376\326\371"
+	.ascii	"\267\360\337&\377\243\376[\344\2371\370\221o\177\373\037\311"
+	.ascii	"\370\347\226\037)\345G&\376\031\003?\362\311\217\274\376\310"
+	.ascii	"\301\037\031\370#\001\377#\007~d\222\037\351\367g\375#\215\374"
+	.string	"H\276\037\251\367#\211\374\032\351G\n\371\221x\177\216\361\037?\374H\273\037\351\343G\362\370\365\215\037\t\367\037W\370\221n?R\355G\222\375\307\371\331\343\317\202\370\331\020?\253\374\221b?K\302\177\f~d\330\217\364\372\2214~\344\214\377\027\374l\005\377)\360\337\346?\211\377v?\013\301\177\304\377\035~\226\303\217\354\372\317\344\177\336\217\344\372\221Z?\362\352GR\375\310\246\037\271\364#]\374\310\241\037\t\364#\343\037\371\201\037\351\201\037\211\301\217\274\340GR\360#%\370\221\021\374H\367\327{\277.\362k\275_\367\370Y\036\277\236\373\265\331\257\313~\035\366k\260_\327\370\365\214_w\375z\353\327W\277N\372u\321\257\205\376c\210\377\030\344?\002\371\217x\377\261\356?\246\375G\262\377H\343?\"\375G\033\376c\316\177\244\300\177\224\300\177\\\300\177T\300\177L\300\177\f\341?\202\370\217\037\374G\f\376\243"
+	.string	"\376\243\005\3771\346?\272\377\021\371\037\331?7\376\331\306\237\267\376,\343\317V\377]\370\263\322\237\223\376\214\364g\243?\347\374\271\206?O\377,\3753\315\237I\374\331\001\177V\300\237\023\360\347\017\376\254\301\2373\3703\364\317\314?\347\237m\374\331*?\333\343g\347~\026\347g\207~\266\206\237-\361\2632?{\201\237\255\300\317R\340g'\360\263\022\370Y\004\374\354\b?\333\341g\t\360\263\003\370Y\021~6\204\237\365\360\177\304\317z\360\263\035\374?\373\263\013\377\213\374/jlll\374_\240\341'"
+	.string	"\004g\221q\001fxkM>\336C\270\016\311\245\344#J\326\254\213\017\207}h\315\020\253\343\301\276\301<`:\030\2528I\204\262\257BF\345\226\0177!?.\022x.YC\313M\257.k7f\241\355\007P\245\354(\373\235\325\320:\034\227\237hxA\361\343\323\2305\f\367\303M\360[\321V\323\217\254\263\035\013ma\267\017\207w\254\240\222\203\313Z\2035\230\rn\203\021E\306\225\265\346\301>[X\355\303\341\265k\024\224\241\254/\307>[8\355\207\317`4D\036[@Y\037\343Xh["
+	.string	"\366\331\036\237|8l\266\270v4d\f&\203\313\216\254\220\202\312Z{\261\320\366o\354\263\205\305>\034\036ka\243IO\326\337\001v\030\307\017\337\200\303\016[$\231e\255\327Xh\3738\366\331\302_\037\016\203\345\320Q\305H\326\207c\237-l\343\206C\256'p\r\270\353\255\002\317\310O4,\305VAY\263N,\264Mv\311-\312\020\2225\314\365%$\211\212Y\277\177\037\016o\251\020Z<\312\032\326\232jks\312:W}8\234\305D*\333\301\343\n\306\202c@iQ\231\312:_Yh\353\201}\266\260\325\207\303W7\004\211\334\262\366\200}\266P4\304\361O\216r\304(i\n\236\202\243`\276\220\306\026\005\237\352\364\262\376"
+	.ascii	"\214\354\037\226\202\243\270z\fa\313\032\206b\275"
+	.string	"r\f\332\355\037v:\374\364\303/`\030. \243\030\214\254\363\020\026\332r\300>[\270\351\303a'\253 \272\261\2547`\237-\314\224\237h\210\34356\032yp\322\341\245\037v\001+\261\031a,\313\232\365b\241\255\013\373l_'\037\016'E\325\340q\312\032n\001\033\261o/\002\037}\255\311\304S!W$\353\017@n\237}\221\366\003\354\213\264p\321\363\023\rufg.\262\206\211>\034f!(\370\344/k\n\330g\013\257\3707\033<\204\347\306\246\"\353L\306B[X\305\207\303B\31041\265\246\254/\200{\3307\270\007\006\312\200*v\221A\331\027`Rk\024\030F\004\003\375\260\017\374\243\265X\252A?\252\254\254Y\374Xh\233g\260\317\366\003\230\261\377\267\3610\317\377\022\302q~\242A/\206\220\026Y\263T,\264}\253|\370\333\370\316\025\241b#\353\347\024\366\355\235\3622f@\325s\343"
+	.ascii	"jUbiG%2\256\030Y\277\214\327K,\325\313\002\346\260ld\375\001"
+	.ascii	"\254\330\377\253x\366\355U|\245\034\340\256\252\261\317\215\302"
+	.ascii	"v\304\220"
+	.string	"\251\317j1\353\207H\334\377\213\310\276\275\210o\"\013Tq\222\bjH\205\214\212q\354\304\001\322)\257\356/\3537Q\017\262{J\222\366\262~\210\276\375\277O\376By~\242\201\316\317\tR\326\357\341\207\277O\250\304\306\256\262~a\237\355k\370\277N\336\353\362mGO\222\254Y-\026\332B\t?\374-\334U\202\264\330\312\272E\320\350\035\204\021\330\242*k6\220\205\266\311\306\017\177\005\305\230^\320\310\372e\362w\b\211\242R\326\357\336\207\277\201\\Uh]\200\354\333\013\250m\260\260\026\363\310\034\021\004#\213\217\2168x\b \373U\362\277\177o\022\236/!gYg'\026\332V\300>[\255\342\303_$\356\016C\276\370\b\223\n\r\"#\257\221\277~\377\333\303\262i\240\221J\224\254\265\336\207\277F\372\202\\\325\336\276\377\335{\371\362\023\rUvk=\262f\207\260\320\026\002\366\331\276E\362\023\r\214K"
+	.ascii	"\257^\275\377\245{\211\344'\032z\270\270\262f\343Xh\373\016\371"
+	.ascii	"\337 \257\220\374D\003\333\332OP\326G2\026\332\022\200}\266/"
+	.ascii	"\220\017\177\363\264\030Y\217\251\254\007\200\367\367\307\227"
+	.ascii	"P`X1\262F\306\370\360\027\017\371\242HU\227"
+	.ascii	"\235\017\233V\204\310\337\224\254\337\237\017\177\355vc\343\217"
+	.ascii	"\255\0361^\0374\212\270xd\315\332\261\320\366\245\373\360\267"
+	.ascii	"G\235\231\021\254\254c\330g+\367\362h\017\343&\250\254\037\342"
+	.ascii	"L.\016N#&\341s\361\366\027\356\327qZ\211\217C\255\254\333)\037"
+	.ascii	"\376\276\241\311\020\342\332\361\272u\205%\276e\375\272\271;"
+	.ascii	"\212\250(e\375\266\301V*\242T\311\372e\313E\226\215\213\215n"
+	.ascii	"\257\331\337\263\277g\257\232S\314c\030b\214G\020L1v:\312\340"
+	.ascii	"\177\323\376\252-\033\333\n\235d\375\242)\007\271`\230=\375O"
+	.ascii	"\346\302\275 WY?D\330\376\317>\377m\334s\024\307q\022r->\362"
+	.ascii	"\201\333\237=\213d\331\f\376%{d\003\360_\037O\002\215\b\304q"
+	.ascii	"T\220\031q\034\263P\366\215\272\236\247\254\377O\020\377\177"
+	.ascii	"\006q\314\303\306q|$\344f\305\263\"\344\326\023\013\355\360C"
+	.ascii	"Z\021r\263B\022Z\213\253^b7\254Xh\215\212GS\361\304q\314\223"
+	.ascii	"\343\265\370\307\n)\376\241\342\321\021Z\213\217\3425*\036g\374"
+	.ascii	"\203\344\024Z\353\341\021r\263Bb\205\334\250\220\204\334\250"
+	.ascii	"\220V\342\237\230'\376\351\251\332?THB{THN!\267\036$\241\037"
+	.ascii	"+$v\215*f\217\374X\263\342\t\212\335z\226q\034\263X\363\342\201"
+	.ascii	"\343\270\347(\346A\222\213b\253kQ,\025\263~ekXq\034\363\304\005"
+	.ascii	"^Q%\327|b?\2410\252\232\2408\016\214\213D\340ay\326\3428V\021"
+	.ascii	"\373\360\260q\034\264v\024\307>T48\305q\034S\261IT\034\305\313"
+	.ascii	"\370\247\207\205\317\025\025\034\344C\245\"\016\253b\3438\216"
+	.ascii	"\221\204\334\256\250>\334\275\271y\305>k<\254\020\013\252\330"
+	.ascii	"+\016\264:\332n<\354\223\245[\227\023\213\267\354}U\276pTe\375"
+	.ascii	"\216\345W\354%\373;\366\265\370,\216\327\3361\t\030\233,KA\023"
+	.ascii	"\306\334\020\260V\207m\263\302\030qM7^0\226\006\222\245\236\254"
+	.ascii	"\037\202\350\365J2\241\305\371e}\021\030_\033k-Nc-\262\206C\322"
+	.ascii	"\270j\214b\243\355\343\332\343{\273^.\"*\200:\262vj\001\025\311"
+	.ascii	"\334\336\2557\013\353N\254/\3537\353\215\221\211\n\240\330\002"
+	.ascii	"\260\212\242\026\373\366f\27524\314\362\212j\210\207\326\027"
+	.ascii	"\241n_\004\265\375\277X\357\025\233P\"\217\254\337\253\377U\301"
+	.ascii	"\312\345'\032\270\226\\\030\311\2325\373\360\327\252\371W\207"
+	.ascii	"X\243j\252\217\307!Z\326g\327^\274T\257\324\033\305\276\275S"
+	.ascii	"/T\b\030\026\340\260\312\332S|\247\336'\034IY{H!Xld[_\204\257"
+	.ascii	"}\021\262\366Ep\261\037\302\224\375\277NoS\022\220PI\205>\346"
+	.ascii	"=\201\223\302\264\344\301\017\0322\336\245\272L\025\303\240\223"
+	.ascii	"\241\344\342\214\354\007\\\326II\302>\262\026Y?\004&\373\377"
+	.ascii	"\333\342=z\215\330\267\027\351e\361\022Ey)\273\240\274^\244\267"
+	.ascii	"(\023I\265g-\322\202@@\212O\217\255\037B\217\375\020\314\366"
+	.ascii	"C\270\261\377w\305\320\013t\264\007$\364w\350\327RG&\2156\240"
+	.ascii	"\260\310\372U\361\341\257\320\373\243\304\243F\326\311\240\027"
+	.ascii	"(\366\223\201$\353\027\350\177\177\220_,\236\234\234d\315d\237"
+	.ascii	"\355\333\363\341\257O\266\021W\244H\326\313\227GY\366*\325\224"
+	.ascii	"\215\312*U\374\212\342\254\251(\245\244!\016e\375\020\246v\262"
+	.ascii	"g+\306\n\2754%\233\216\305!Q\224\\\312\260#\333\221\f1\206\334"
+	.ascii	"!cU\334!8b\b\031*\031\225\213JE\345U)E\231\250<TBQNQ>Q\"\262"
+	.ascii	"o\312(\312&W\022*\013\243(\311\224"
+	.string	"fG\266\243\215\367Ge0\237\035\327\274\334\267+E\264)\327(J\035J\301#\333\021\f:\244\270zg\214\327d\2172\212\322\t{\027\203\350\352\016\211\242\024\313X\035\200\342\230J\312\255R\264\270\3106\316\325\b\302A?\204\025\373%c\237\355A$\356\203H\262\225\202\277\253\247lS2\311T>\026\177\300e\035\250T\033l<\313\372 \3466\240\322MIwd;J\256P*Q.a\337\224\200\312\036J@\245\017e\222\031\356\220\242\305\305\\e\205\225^\253\377zp]\215e}\020g\373\354\031\220 wOvviD>\374\030\342E8\244\217\3105\210X]\020\"xfv}\312=\245\237\362\210\262\210\322\210\022\211\222\210\222\217}S\352)\205\374(\365\224yiC\256q\034\277NvB\201-\372 \312\366Ap\355\203\310\332\007\201\265\017\242j\037\204\324>\210\247}\020N\373 \226\366A$\355\203"
+	.ascii	"\332\377\320d\317\315\260$\255)\353\177\360\333g\347\340^7\004"
+	.ascii	"-\004e\234r\207b\213\032N\212J\036J9\366M\031\247|K\226U\221"
+	.ascii	"\005\265\372\037\332\366?\210\355\177\360\332\377 c\377\303\324"
+	.ascii	"N\306,\264US\256!\313\016c@e\375\017Aj\211\373 \374\355\203\340"
+	.ascii	"c\227)s\264Eb1\223\254\017\202\327.\003\341i\037"
+	.string	"\004\237\375\017\230\354\177\020d\337\020d\363{\312\372\037\344\330g\317\002\373\256]W|W\245\r\266\211\021/%\230\362KY\203}S\332P\322P\332P\316 +Z\\L\276\020\274jR\352\177\300\263\357\201\312\276\207(\373\036\n\367=$\331\277Rk\206\236Q\2232K)\243O\210\213O)C\031#+!e\311)c\\\211\225\251\342(yT\224WK\256%F\236\262\276\007\272\375+\255\224U\312*%\225r\352\210\243\305\241\340\013\024\303\r\211RJ\031\3253H\266$k(\302)TQ\262\276\207\263}V\256\310\210\327\022\223\253\222I9\244d\241#P\311\2444R\272\030!\350(\271B\007\337U\311\244l\201\264s\317\212\236\034)\302P\276P>)\233\224N\354\233\222I\251\004\223,ru\004\021\326\367\360b\337\303\320\376\225.\224IujJyY+\221^\026_?\220\262\276\007T\224G\036H\331\367"
+	.string	"q\337\003B%Q.;\253Q$\353{\260\247\\\341\301\335\376\225B\312\237\327\016\320\260\357\210\242\227\221\305\253\362'\3317\345\252\004R\006)}\224*\224<\312\036\366M\371\223\254\362d\2432~\366\223\242\374q\217$\251\260~ZzO\371\223D\342\344\232\374\241\024\226\305\324\254\037\013m;\260\317\366\036\350\330\214\314C:\252\267\254\357\001\330V\302dnp\017\3600\271$\031\310<\3061\226\021\257\037\377\207&E\b\365\332\004C\\\331;A\257\344a\222I\216\276+\224\344\224\244\224\244b\362I\0221\271\230\214\222LL\032\262o\311\303\244\223'\377\222I\236\223\207\311\302\002\200\025\t&*\306\361\332\na\200Q\\\364=\370\331\357\340\311~\007\200\373\035\344\355w\240c\277\203\260\375\016d\354w\240\224\fD\332m\247\037\026LY\277\203\242}\016\022\3679"
+	.ascii	"\334\354\021\013mY\330g{\016\352\3669\320\261\317\301\330>\007"
+	.ascii	"3\3669\210\332\177\222\357\330$e\007\324\215\344\336qF\262HR"
+	.ascii	"O\312\031\222!Y\023y\347\020\215\270\262>\007D\373G\030E\256"
+	.ascii	"\311!\311 \311<\366-)$\t\004\346LH\262.\211wd;\332>t\350\tI\376"
+	.ascii	"\350\300\f\251\261O\261\031\264\367\006e\353o e\177\203\302\344"
+	.ascii	"\0353\221\bQH\326\337\200H\322n\003\273\375'}<\331#>\362\273"
+	.ascii	"\301\356\360\232\222\203nn,\213\bS\326\311\271$\017\370\250F"
+	.ascii	"\004\224\225\265\\\221A\245\263\254\277\001\331\376\237tK\276"
+	.ascii	"%w$\341"
+	.ascii	"\330\267d\\R-\355yG\266\243\375\2665\344z\354\312`K/\031\227"
+	.ascii	"D\313DrD\256\311\270\344ZR\207\225\007O_\202`\357\212\257\035"
+	.ascii	"G\224\372O\352H\266\riQ\244KN\303\230\003B$\311v\f\203\245b\300"
+	.ascii	"X\222\3657\270\261\277"
+	.string	"\301\323\376\006N\373\033\270\330\177\362,i\266\204\024\344\t\006I\245\361\0131\231#Y&\004\366\026g\235,\373\223cI\262\374D$.k\221\265\026b\241\355\331\330g{D\372\360\244X2\315\017q\016G2l\214\r+('\303\236t\f)\301\251\033I0\2763\273\302\257'\301\316\336-\351\270\322\260\262Nz}x\362k9$\353\232\265\0046\2225v]\217\037\335\321\t\223\230\021\215\\\366\364f\325$9#\331\265\257\002\343\030\311\256\347e*$U\302\224pm\241\3018\222(\343\311\255?\231\225\324\"\243\3521\226\365r\b\373l\2231><)\003~\022\350V\2265\007\254$\324\215\267\275\246\254\317\3165\275\360Z{Q\304\364tU\232\272:\031%\241\2220\210\256I\250\344\022{\027\325\346(\262qH\225\214JV%\257\222SI\253\244\024\373\226\204J>\035\023\325\360\256N}\r\b\3675\b\334\327"
+	.string	"\311\276\006}\373\032\f\331\327\300n_\203\270}\r\330\366\237t\221\244\003\005M0y\364d\322\217\354J\"\345\247L\b#\215+k\366\312B\333\244\321\207'\217\230e<Q5\262\216 \331\242\250\203\034c\\\326\311\242?I\224d\221\243\340\275\364\226%$k8\216}\266\231\356\303\223+~$\265\t\031J\002\351\250k\262\224\265^\022\310\355\033\274\272zO\002\271E\\>\326/.\216\221<\030R\304\305\350\016I\002\271D\362\231"
+	.string	"\364\212\270\030\025\223AI\025I\241\344\017\373\226\004J\362<\331\223\364I\002\271G\222q\007\037\2418F*"
+	.string	"\220\".F\026\214\307V\227R\2771\013mY/\366\331^\003\247\335\350#\245\206b\326\327\300h\273H\016w\340vR\3462\036q\270\203n\341\221\355h\317\371H\271\222m4\035\203^8\\'.\025\254\034\356\025\371\025\230\237`\270\212EY`\212\204\207;\355u\035\206\342x\310\223\013\244(\013LQ0\237A)\312\002#c\333\207.\223|\326\301'\216\245^\270\211EY\373p\363\354\032#\004\0351\340\212\360p\253\355%=4\\\273#\016W\211\273\244\203O\034SE\271\213EY`\212D\373p\307\273\312\206\262\027w\224\255\270\251\354)\373\272\237\354\304m\270\031\267\224\215\310\276\355\303\355u\327\210\353\267\017\267\215=\246\243\311\365H\264\017\335*nc\007\2408\356\211r\373\212\262\300\024\231:\240\354\226"
+	.string	"@\027\262a@jaY?\203\274&\354\333&\334L\2567\341\026\334\203\035\206\342\270\347\311M*\272\202\242\310>\025\3611\242\365\036\374\335?7\211\313\227\355\230$\341\310\372\031\220\355g\200\265\237\301\322\336\2001M\254\254\036%Y?\003\240\275\266u\034\327\274T\360i\201d+\331\177\354\333N\362\263\223l\267=d\204\240#\030|\212\256I\366\221\357\035\327\276\342\030\013\252\235bQ\005\210~\323\"2\265\3651\340\261\257\233\354bX?\255\005\200\315]\363\312\206\354\035\273\256\203\217P\013C\350\360\236\007$\307\365G\006\254_\034\nvg\327=d\007y^\r\262k\034\307{\310\276\213\021\300\022\213\305>\305\276\355\267\211l\276]d\357m#[\217}\333C\266\020\344\333\016\305),\372\030"
+	.string	"\355_Pe\377\202\304\375\013\n\367/P\262\177A\337\376\005A\366/\240\363A\307\343\004\211Q\326\277\300ln\323\261o\273\307\206{\333rX\204^=6\217-\207\345\001\037\213\303$\305\243\217A(;Z}\001,\356\177\313\305\275U\320\242\252\304m8f\232\r\026XY_"
+	.string	"H\366\005Pd_"
+	.string	"@\366\005\320co\035\371\211\006\244\334P\021\025Yo\266\017\337m@Z,\222\262\306\200}\266\027\300\333\276"
+	.string	"\330\366\005 f\266\317rl\032J\240\200T\231\355\034qq\340.\373\316\321\n\362\004Y\204\261\305\230\214Lw6\262\276"
+	.ascii	"\2006\216\035\226{\204\r\321\355\033\337a\360\342^\237R\326G"
+	.ascii	"\334`\377\223L\300\264\272\037Y\377\033\354\213Y\204$\266\372"
+	.ascii	"\332^\311\304@*fY\337\002\306}\013\020i\f\2425\275e}\013\230"
+	.ascii	"p\355.\366m\317\330A3v\317\006BB\200\324\214\255bk\025R\271\306"
+	.ascii	"q\f\263\301\006\354[\220*\207\255~\261c4\361\312\3322\366\026"
+	.ascii	"\373\266\265\276\265\266\320>b\362\254\304\261\fF/\255\215\264"
+	.ascii	"\233\252<\270\262@\342\024\263\301\006/\213\030Q<[_m,\366m\307"
+	.ascii	"\330VQ\273\252\203\217P\334s\245A\030\013$N\21216\214\r\325\301"
+	.ascii	"G\210\005 \203\327\375\203\013\310V\253o\001\337\376w\025\325"
+	.ascii	"P\335\215%R{J\271\344\344\007$\353[p\267\245\336\342\013\250"
+	.ascii	"H\326\267 n\237};\341~za"
+	.string	"\327\036\023Z\326\267@\307\276\005g\373\026\220\355\207\260\233\332$[\211\365\213C\241\257p3m'\366m7\355\245\335\224\r\365\234\\\2316n\230\241\265\372\026\314\330z\354\007\216/\353\355b'-\013\243\362\302\262\276\005V\373\026H\355\377\273\3056b\337\366\321.\332G{h\263\350\340#$Bj\361\272\217\262\341a\210D\026H\234\\,<5\256V\277\202'\373\337,6\321\013\241\036\214H!NIh\354\025;\350\025\\\021\027f\375\n\232\354W\360\267_\201\336~\005>\366\017\234U\032Y\326\257\300m\373Tp\266_\001\331~\005_\215b\254\233\004\204\r/\353W\300\265\031]D\301\te\375\n\226\366C\270\272O\262\\)\356\024\366\315]t\241\304-\272\210\256b\207\2418\266*c\016a1&\266\344\2418\205\251\325\211n\224&\021\r\025]B\022\351\366\0030f\350\036\346\244\035\\]\206\001\300\332\017"
+	.string	"\222K\310\376%.\016e\375"
+	.string	"\364l\267\t\005R\366)p\262O\001\222}\n\362\366\357\002\336]r\366\216\206\227\025\275\243\251\254A|\270\013\b\244JJ\326\247\300\307\316T,\264\265\200}\266\277\362\330I'\261\375\273{w\371^\227\263\021C)\305\254Y\265\017w\367\354\202\0041f}\nll\366\210}\266\247`i\263T\256\220 \033-m\021-\310[1\230\212y\325DU\227\347\002\021\214\341\003(k\027\b{\307&\t\261\262\341\376p\361\314"
+	.string	"\005\325\236 \271w9\n\2462[R\321\223\265\216];\267\356\020\310\031_\326>\330\262\036>\252d}\n|\366\232\234\2164\266L\024\007\347\276e,&2\216\251xx\271\301\271m\231\310\003,\262\216\310x\270=\33497\316\245s\345\3307\027\316\335\001\303\344\021\343\353\210\251?\201\335\376\004i\373\023\200\355O\020c\177\002\030\373\023\030\355O"
+	.ascii	"\264\177\327]C\202\313\341\232\271g.\232\233\203}s\323\356T\304"
+	.ascii	"\253i/\215/\315}1w\225H\246\b\2475FYS\352\337-\273\213\303\207"
+	.ascii	"*\307\224\254\037\002\230\320\325\305\341ze,\270\025\327\257"
+	.ascii	"%Ca\356\230+\346\222\261o.\016\367\206\213\303\265ax\243\221"
+	.ascii	"\f9\367\024\267P\352K\340\267/\201\217}\tn\354K\220\264\017\200"
+	.ascii	"\302\375\2735\204\250xk\313\232Pi\221\260\311er\353\\$\222)V"
+	.ascii	"\271H$S\304ri\2703\334\030\256\fw\313\265r"
+	.string	"\265\334+7\313\355b\337\\\256\303p\241X\2778\024\360\nCH\321\320\221H\246\030\307k.\227K\325\343*\221L\361\205\313\344\304\311eR\274\272`\275\304\246\\\3438\346r\247\362\331\240\227\313\345F\271P\314\237\265\030II\343G\"\031L2\217\b\355\n\243\017"
+	.string	"\035\373"
+	.string	"\030\333\007"
+	.string	"\215}"
+	.string	"H\355\003\340\350y\356S\334l\nA\234\262\313\372"
+	.string	"\370\331\217"
+	.ascii	"\312~\004\177\373\021\330\355G`\266\335%\270\207\311\307\221"
+	.ascii	"\254\037\001\330~\004U\373\021\254\330\277\233\344\0221>\221"
+	.ascii	"K\313\372!\3744i\252\2628\0277\272<N\326\334\036W\310\035rW\270"
+	.ascii	"A\356\221\333\3025r\213\\\026\256\n\027\211}s\211\\ \226m\221"
+	.ascii	"Q\n\225V\321%r}\b]\242\226\261\245R\3675\266\250\370\366|\361"
+	.ascii	"P\201\321\3570e\277\303\340~\007\"\373\035|\354wH\333\357\240"
+	.ascii	"\265\337\001\306~\007\237\375\353\300\267T\376v\212n\312O4\b"
+	.ascii	"\375X\205e}\b\236\354\226}\266\207\240\311>\004D\366!\320\261"
+	.ascii	"\3776J\233\b#0\257=|\233\370\267OZ(-\",$\206\265\267\241\270"
+	.ascii	"|\336\262>]\314B\333\344\032\373l[\303\017o\0173_\215\236\251"
+	.ascii	"\254\005pm\007\2454\201\262#\353\263?\220 \355\006\217]m\037"
+	.ascii	"\353\027\207\002\220\"W#G|\024\266\204m`\333\244u\322\n\266L"
+	.ascii	"\332%\354[;\330\002\376\205H2w\365k\007[%[Wfb\356\023\306?>\026"
+	.ascii	"}\b\240\366!X\332\207\240\305>\004\361>\207\303}\016F\3669\334"
+	.ascii	"\355sx\333-\037lX\230\350\223\3659\224\355\025)\242G\304EU\023"
+	.ascii	"\301\254\207H\265\210\302\221\3659h\355\037a\354\310D\254_\034"
+	.ascii	"\ngs\327\017\355]\373\326\306\261~N:L\216.\204\216\036kmu\327"
+	.ascii	"\036x\355\217\026H\233\327\ni\203\264v\255\217\266\216}k\357"
+	.ascii	"Z:\335\336\265rj\3278^\273k\3472\0213\031\307Vhw-\217\214\305"
+	.ascii	"\354Y\213\217\\\270?0\261\021\260\220\202Z\364c\246\354\307\b"
+	.ascii	"\356\307\370\355\307\350\355\307\314\355\277\205{\033\367\353"
+	.ascii	"%\272\355\007\366\301\267CF\326,\217\017o\3414V\242\021X\326"
+	.ascii	"\217Q\333\217\371\332\217\201\332\217Q\261\017\243\250\024\324"
+	.ascii	"\352\212\322\256\265bJ\036|\261Z\253\326\246\271\177uG\332\332"
+	.ascii	"\264\026\rV\356\270\363\222\222\365\331\021(\210GMIY\233\203"
+	.ascii	"}k\315\3321\272\326\254\305\321\212u][\263\226\214\r\242T2c\005"
+	.ascii	"\f\305\344R\224\017\242V\037Fo\037F,\f\360\312\330#\353\303\254"
+	.ascii	"\2559\t\365H\273\001\006\243*\306\212\254[\260\273\371\320\342"
+	.ascii	"\272f\315\342}x\373u\200.\254\034-\231_\317\223\254k\254-m\\"
+	.ascii	"\215\264\262>\214\214vF\333\305\276\2654\332\255\226+\260\245"
+	.ascii	"q\3542\024kV\201)Yj\365a\252\366aT\354\277\325j\263\220G^C[$"
+	.ascii	"\236 ake\264+\332\030-\226[\0233\270\254\257\226zT\224\234\262"
+	.ascii	">\f\317\376\337R\265Sm\025\373\326Z\265QPl\220\034^q\354\366"
+	.ascii	"\020Z\253V\212\r\302\3729\035 \310\031{\326Z\265O9J\231\005\326"
+	.ascii	"(\245\270\364{a\366\264\365_\212\354\277\344\355\277\324\355"
+	.ascii	"\277\300\355\277\205\361b\212\365U\226\265\223\262\t\221\034"
+	.ascii	"6\262\376\013\215\375\020\212Z#>\257\017\355\222\206\352k\225"
+	.ascii	"Z\027mR\313\3246\261o\355R{\204\324\032]1i\227\332\241\226\305"
+	.ascii	"U\340\265]\322Oy\260\247\007\004\263k\334\352x\372\353\001\353"
+	.ascii	"\277`\355\277\254P\321\266HR\301\320\321\223\365_z\366]\246\264"
+	.ascii	"D\231\321\310\222\257\254\357\342d\257pQ\262\377V\250U\321\252"
+	.ascii	"h\203Z @\031i}Y\267@\317O4\3041\335\224\322\023\222\254[\237"
+	.ascii	"\017o\177\332*R\210\342\262n\266=-\0172P\312\213\243\226\347"
+	.ascii	"i\373\001v}e\375\267q#\325\335\020\031YW\361\341dDG\326w\321"
+	.ascii	"\333\204i\204jlL\274\324t\030\321mf\212^\204c\214^9\244|\230"
+	.ascii	"\253\363b\2731t\226o\260~N\007 sr\215\343x\007\237\334\237\t"
+	.ascii	"\313\026\347\340\212\\3\241\030\025\265\266@<\366\216\007R\017"
+	.ascii	"i\004\231\210<\202l\2024DJA\026A>A*\"\027\221\210\310>$\025\344"
+	.ascii	"\036\322\017\311\210\274\"\247 \221 \241 \377\220\207H@$!R\020"
+	.ascii	"\031\005\271\004\251\004\231\0049\210t\202\fD\362!\231\260o\310"
+	.ascii	"B\244\220\037\237\220C\236\345\210dB\034\354]\025\035\344\377"
+	.ascii	"p\207\264\233\363\3421\304\013Y\210\314C\006a\036\343"
+	.string	"\030K\315\353\207\234\027\035{\347#N\217\355\377\320\243\207\227\017\244\035\235n\372\263\332\333^Vs\353\313\204a\215jk\203\310/\260\025^?\320\n\201\304!\013\221jM\256gd\354\035\363\030\307RS\2742!\262\020I\344\013,\361\370b\013\251\217\005}\227\261}t\231\021\204\206\370\305\275\321\330\3420\353\273\310\330wQ\332w\351\331\207F\331\207\006\331\310:\315\304\027\243F\326\207\372\330\207\342\330\207^\355CU\354\267,\356\2678\331o\371\333o\341\333o\001\262\3372\267\337b\266\337r\265\337B\264\377T\334\177\032\331\177\376\330\177\302\355?\307\366\237U\373\317\245\375\247\317>\013\223}\026\036\373,`\373,0\366W\250\354\257$\331_\341\261\277r\266\2772c\377\212\364B\332h\024L\002\314\032i\343G\322@\326\310Qp[5\004J\217\254\233k,\264e\025\331g\213\354\372p\344\214\227\n\335aO\326"
+	.ascii	"@rm\t\255\255\274ymN\b\263Fjm\037D\327\254\277\"\265\2212\214"
+	.ascii	"\\\204!\261\216\224\361#c\350  Xlee\375\262\317VK}8\022\253%"
+	.ascii	"\023\232\222\343\ni\0256\207(\226u\325\032]\034\3070.\336\217"
+	.ascii	"kQ\326_A\332\017\301i\310+\n\t\205\224BR\261o\310)\344\213g5"
+	.ascii	"$]\323\212#\214\247\3271\177\2341\221\017\013\257\263)$\323\353"
+	.ascii	"X\277\270\030\210\255\203/"
+	.string	"\260\254=\3058\216\371`\364\261P\352;\0177\353T\262\357\334\333w\n\331w\336\355\037\271\204Tzu$\252A\255e@\243\006\241\013d\317\n\251k^\022\222\217223$\022Qn\225\330\375\360\035!\215\020i\300\025\311\272E\263\347\352\347+\353;\333X\350C$\320\221\355\350\005\037*W\344\n$\021\262\210}C\262@\006\035\251\002)t}\304\301B\033V9\342`\201\034jT\n\376-\312\330\372\316\257\335R\261\320\366I\330g{\247\325\376\365\223#\201\216\374\311\002\210A%J\326H\037\"G\327%Y\337i\264\377#c\335\250\251hF$\217\256\302\276!{\364\"\262\3478\246\025}\b\257S\244x\035\231@QD\366h)M\256r\210N\274\220=:\021\001G\032\373\310\232\200Q\342\2100\365\233F\366\233t\373M\265\255\243\260np[S\262~Sk\277\311\264\337\374\331g\022n\035\367\341\372\t"
+	.ascii	"z\344\335e}\346\221}\346\334\376\365\325I\036\022\241a\326\232"
+	.ascii	"P\027\262o\332\311\343\345\033\303.\256'k\024q\034\307\354\363"
+	.ascii	"Z\367y\355\257\233\f^\231\222\030\346\355\200\021$\310d\253\341"
+	.ascii	"e}\005^3y\026c\251~\216\232\240\262\326K>\\\007\036\003\221\356"
+	.ascii	"\226\262F\002\306\270cwS2\224$)a\026\363\310\372OI\344/H)\353"
+	.ascii	"3\323\366\3313-\244\211\356\323C\230\004f1A\257>\266I\026\273"
+	.ascii	"\032\274\356"
+	.ascii	"i>\215D\033\321~\372\b\373\246\3734\221k\275#\214#\0237\302 "
+	.ascii	"}\272H\3415\216c7\r\t\312\021\246>\263k\303\354\263=Sj\237\331"
+	.ascii	"b\237\251b\177H\236\006b\327\243\005\224\365\0178\t\f(wY\177"
+	.ascii	"\271\270\177\215Gw\244*\221+\353\353&\2668/\035h\327\300|#\315"
+	.ascii	"K\267\261M\324\336r\334i\037\272N\333\3519\315C\367`\3374\235"
+	.ascii	"\206\273\216\323rn\371\206\317\331U\323\351\035c_\205\214\311"
+	.ascii	"\026;z|\234z\004\026\332\272\354\263\375\362n\177\251c\1779\266"
+	.ascii	"\277\004\333_\316\330\031\260\320\366K\255\375\3535=\346\344"
+	.ascii	"\307FPVKk\314\273>e\255\321\266Z\225\274#Y\1779\265\037\302W"
+	.ascii	"\216R\202[*R\013\323c:,\250b\226\026*\226\214\256f\372L\227i"
+	.ascii	"2\366M\347\3703\241\276\241\301r\324\022\013\2578^\3239rS\216"
+	.ascii	"\032!\350(\376\331\201\004\342\256J\020L\021f\203\r\362\024Y"
+	.ascii	"\023C\245\376\365\230\026\3237\210\336\216h\034\327beR\316\346"
+	.ascii	"\262>b.\373\237\204\025\343\336\350\262\376\362ggXq\037~\262"
+	.ascii	"\177\355\245m\200\371\315A\311Z\333\3705\r]\243y\224\304\311"
+	.ascii	"\214\254"
+	.string	"\2351\013ms\314>[\335\365\341z\006\274b\305\027\224\254\331F\315\225\201\024@\037\262--\366\211\355\007P\326Y;I1\236\313\372\360\221\375\020Oy\360\270\346\265\211|\312\256PdSqX\332JS\351*-C\307`\337\364\225\216\272\226:2y\326M\372J;\351P\273\376\200q\3465\247\257\364\213\261;\300\034\024\205\205\033S\037\376\332J\366\331\036\236\332\207\215\366\341\241\375Wq\377E\262\377\336m\0204\223^j\261\245\347$k\245\374\246M1\t\312\372o\216\375\020\0023\226O\241\227F\322.\3307\235\244\217\326t\022\333$\356\341\031\001\315P,M\021f\342!5\245\325\177\257\366\257\215t\213)\246\303\263\254\213\220O\264\006od\375wi\347&\r\304\347\245Wh\026\354\233&\322A\327*\264\320YM\244\2074\020\223g-\346i\347\216\214-*n\220\351\206\250\031i\365\225\206;\037\261\3206"
+	.string	"\354\263\275\362o\377\372\347\032\350\317U\331*?1\375\304\304"
+	.string	"\263\316j\037\256\177|\\\315\214|t\017\242b\"\032\017\373\246{\336\007S)}\270`\352\312\372\303\207k\036Vm\n\233\220\254\177\035\0236~\221h\307\023Z\326?2Y<\nf\254\343\232\335V\261C\352\356\250\327\"\306V\223\243\023\250k\235\222\256)\307(G*G\305c\342\261\312\021\361\310x\224\302\276\035\027\217x?>9B\ta\361x=\036\356x*r<\242\225\t\3552\216\021\202\216\222*\224p-\036\221\034\003["
+	.ascii	"M\035\027\217\203?\356\304\322\224{\205~?Z\364q\215\205\266#"
+	.ascii	"\260\317\266\307\321\220\331\345UH\225\365\225m\373\3121\302"
+	.ascii	"c"
+	.string	"a\241\224\f\275\254\257\344\332\204\312\027\373J\026\373\311*\373v,\264\005<.Q\242\375X\300\r\002*\201\353\212$q\221\344G%\031\353\225\362\204hF\326\307\277c\036\024\335\212\240\254\217\310\336\375O\"\257\022\233\324\0311r\364\353\203\331\374\2464\322\031\351S\016Y\221'\304\367c\037{\307\254B\005\267\367?\311\326\351\365l\355\375`\342\027\244E\326O\236\355!G\"B\224\206YV3\262~Rk\210\020\2449\301\272\254\217B\362Y\\\\a\321\361HwGH\226\007\004\252\244\350\332\232}E\021\373q\304c\017\177\004\211\263~\262i?\031\264\277\027\367\367\325G\017\035z9z\262>\366\240;\316\025\266\r\362d\315c\214+KH\326rH2\257\035L\001Y\273\020=/_%Aye\355\262\"\227\355:1/*\247\251r\001r\001rQ\221\307\323\330\247\270\344Z\252\241\"\350.*\236\206Q\210\356"
+	.string	"\223xp\217#o=\262>\r\013\027\036\027\036\027\037\230\035\243\305 \273\266\r\r\241\271\364\334\305\347\210\222$\241&\213_\2046\202\300\306*\346\200l\\\223wmAW\350\224C\033\241U\330\303\264E#\320*P*n/\252\310\021\2113\234\337\213\027P\306$\020:\037R9f\350\240W\350\025\252\bC\305cx"
+	.ascii	"!\307\264\304\037}Q\016UL\352Hr\225\261\300\22154Q+F\3012r#k"
+	.ascii	"(b\022o\007\226\217\033YC\241\034_4\267\004s\be\r}r\302\037\254"
+	.ascii	"\257\"YC\0173\321\231\024\036\221\254\241\206\307\032\354\024"
+	.ascii	";\300!\256\343\333\226\2224\264\301Ah!\224\027r\213G\231\035"
+	.ascii	"\341\241\205<@|T\262\2066I\352\030,\362zq\254\341&\t\261C\262"
+	.ascii	"\221$\t\224\t\353\\\363Q\"\345%\367\326\"\360P&WsN\274\262\206"
+	.ascii	".I\352p\001Y\f\251\312\032\252\004\n\370JQ\"\332\203\002\302"
+	.ascii	"\177`?N@3O||P$l[l4\342N\006\024YS\211\216&?\216\034\212$\350"
+	.ascii	"H\027\220\254\241~I\035\312\035:V4f\r\355\203\032y\237\270pB"
+	.ascii	"\0055\002\367\301\350J$2\323S\244\310\222\257\355k\312b,\354"
+	.ascii	"\303\213\021\205\b\201\022\201Qlj\024Sd2)\354\2031\344P\"\202"
+	.ascii	"@rqzzlHI\262~\t'\320<"
+	.string	"h^YO\326\336XT\220!G|\334\007\364\307\217?\261\024\331\323\251\350\311Q\013eF\221$\320\272C\177@\361\376\022\327\360\240x\320;\277\0359\306\240\202\350\001)\2225\324N\251\304\307\210\207\344\007\017\036P:(2\246\020A\347\016\245\333PJG3\230d}D\244\335\222\303\031XY\277D\334\206\272A\335\240q{P`b\314@<E9(\334\241qI\306\255\036\035YC\3376\224\362\257\311H\2345t\007<$\260\211\215\221\r\r\r\332\246\370\316i5v\261\035\332\266\004\221\355*k\350\332\206\302AEMK\255\b\254\315E\326\320\264&a\220\245'Y\277\204\330~\211-\250\031\324\fZ6\350\325d*\356)\353\227\300\332\3201\350\030\264\f\b\024\230XY\025\021\262C\313\352\256\264\2006TR\305\212F\253\254_\"\310\353\367\202\342`\333b#\230\"\206\215}\212K%\0355\264\240a\207\342"
+	.ascii	"\222\261&\2255\364FR\207\r\255\272k\326P\260\244\016d\r>'SYC"
+	.ascii	"\277\340\274\237\277\035D\362~\360Y\225A\301:T\006\026\264Fs"
+	.ascii	"\b\214\224\362n\031\345\3075\t\272uh\215Ci\200\b\221\313\232"
+	.ascii	"jeP\220\262\206\316\200vA\271\240Z\271\fyd\352\352'kh\0264F\023"
+	.ascii	"\030\207B\301\200Z\345x\213(\001\241j\310\230:\324\352\320*\020"
+	.ascii	"!^\244\b(\307\213\254\017\245\202JA\201\352|\230\226\262\206"
+	.ascii	"FA}\276\202\364\024\241OI\240LP&\250\023 \036\253\344\307\360"
+	.ascii	"\b\332t\250\023\032Y\242RT\bT\t\252\004Ub\002\304S\334d6\340"
+	.ascii	"\240\262~4\016\212\004E\202&\301P\361\030z\220\304\004\210\027"
+	.ascii	"%\346e\005M\3126\334\332\216\034e\375\250\031\264\bZ\0045\372"
+	.ascii	"\301V\310\330\3641dV\005mq\250\321\224D\0368\242[;>\264\347g"
+	.ascii	"\337\2401\224\350\307\0274\366\232\265\325\003\252\342P\242C"
+	.ascii	"W4\031\017\353\026\263>t\350\030\007\244\320G\326P!\026\271\036"
+	.ascii	"\026[nY\337\003LE\213\316E\326\320 X\256Ko\310(k\350\017\024"
+	.ascii	"\310u\272\022\234\312QP\312@\030*\242@}ltQYq\024h6\305(k("
+	.ascii	"O\224\252J\225\026\3023//%\250\300\254\037u\301\310\330B\bC\305"
+	.ascii	"c\230A\"T\226\007*\252\320\220H\221\322\262\b\263\3433\257\275"
+	.ascii	"\253X\217\323\"\022S\335VQ\217"
+	.string	"(QZ\360`v|\026\246w\255jtq\227\365i(\333\2067lA\204\241\342y\242\201\030\213\254#\366G\326\225\005b\013\024\250\275C\035P\236D\021\2721\350#\211D\317IR\313\241\273coG\220\254O\203\f'N\f\275\016\355\016m`\275\310\3724$\355&MZ\b\331\266\330H\tci\020\217l\t\3450\315\213\220Hp\314\317F\326\247!(\251\224Tj\021\204\241\3421\324\340\250\251Q,k\021MP\020\326\223\362\202\212J\326-\200-\200-\201JE6\016\311\216@\201Ez\264,yK\340\031\0079\222\334d\366\370\370Z\222\300P\361 \266C\212l\0346\363~\004\337\376\336\222\004\031&\244\005R\326-HrY\023\262\026aGf\3001\004\357\210_{\004\361N\251\257\305\bT\021\273\257\254/s\267\373\222Oz*\252iH\326\227A#B\244\245\b\f\025\217\241\bF\256\022\311\024\245\366"
+	.ascii	"\227\350\275\245\210\013\365J\375\3258\233\021$H\213\020\251"
+	.ascii	"vQk\031F\035\n\311c\341C1\353\3130\001\001\302rv\245w\355\341"
+	.ascii	"\243\262\225\365ez\356\356Z\360`\270RMQ\234\222Q<^\334\341)\273"
+	.ascii	"\330\202\252\360|\374>Z\352~\374\211\245j\2649\226\006\361X,"
+	.ascii	"\001\t\253\373A\204X\306(\3543\242\227\365/p\326\362\366\026"
+	.ascii	"\036-o-t\372\bT\006\272\214\352\305\213\271\267\320%Q\271\305"
+	.ascii	"Y\0371\203\346\212\267D\237\254[\344\334%J\212\264e\335\022\207"
+	.ascii	"|r1\030\006\367'a\255\275\276\303\254\177\001\261\375\013h\241"
+	.ascii	"\241\265\270Y\340I\223i\021\021N\307[\334\230B\220\200!\311\272"
+	.ascii	"\245\r\366r\341\002\256I\013[\223\335\0166\266\267\254A\261\033"
+	.ascii	"LkQc\306Q\361y\222\365/\360\224v\001\243\262\227\265\230\261"
+	.ascii	"m\261\221\314\217D2\262l(\330\345\226\343-fP\222j\364\360\372"
+	.ascii	"\237|i\354R\221\365-\320\344\353\253e\214\357/\221L\021\336\361"
+	.ascii	"\226\306B\354-c\031\221\np\212\203S\226\020\034aM06\256\027`"
+	.ascii	"-7\216\206QD\374\262\276\005\364Z\300, g\303\206\01601\305\254"
+	.ascii	"\303k\217\261\255\255\026\032 \260\261\n\270?\265\253\016'\200"
+	.ascii	"{4f\264Ex=C\270Z\272\3322#A\250\262\276\005\266\270,\260\324"
+	.ascii	"r\325r\325\222\305\330\264\344\254\001}j3\262d\020\335\030\""
+	.ascii	"\312\272%\306\022\311\225\022%Y\277\002AZ\260*p\326\022\325\022"
+	.ascii	"\325R\005C\305\363\304\202\033.\300\304\216\2034\004[\264TQ\345"
+	.ascii	"&;|\312\250\246\\\360P\3721Dy\246cM\250E\252\245+\224B\207\230"
+	.ascii	"\365+\260\325\362\324\362\304\354\371\360\003L\214y\245\224g"
+	.ascii	"#\353W@\251\345E\313\013fO\313\327\037\230\330\026\025\251#Y"
+	.ascii	"\277\002qKSK\323\222\017\346\006\322\330\"\020!\261((HH-K \260"
+	.ascii	"\261\212\267\035F\327dQ\025\033\214\026\245\267,e\242\030\177"
+	.ascii	"3\256\262>b\213\013x\215'.lq\321\222t\330d\360G\216\351\363\344"
+	.ascii	"\225\225\365)`\244\245\250\245\250\305\350G\225\f\250c\242QX"
+	.ascii	"SK\213\267\030)\021i\223\001\204\210h\311\007cf\225\265W\243"
+	.ascii	"G\235\217\254O\001\263\226\240\226\240\226\241;\277\3014V\360"
+	.ascii	"\350\206Y\213\320[\206\244,RQ\313\272E\205\213\304*3\2344\026"
+	.ascii	"\233\222\272\262>\005\232\032\033[~\330\266\330\310\225Kj\224"
+	.ascii	"\232S\304\301\323\022\277\345\247\305Gn\212\341\215\026\237\226"
+	.ascii	"\236$E\"\034W9\350\313(\253\205\247\215\252\232\"\230\365\021"
+	.ascii	"[#2B%/\262>\005\204\236\213\317\305'\025\266-6\352\300\3304\346"
+	.ascii	"&\346\204\215\361O*\307\275\270\240\306\254\237S^WuM\2021\001"
+	.ascii	"#P\240<\025\237 \211\245-}8\241\"\025\345OE&\336\223*\267\304"
+	.ascii	"\243\022\244 \\\317\304'b\363(I\231^P\222\247\254?\201\034\204"
+	.ascii	"\204\317\303\037G\032\3734a\233!b"
+	.string	"\341\237\207OC/,E\025\206\317\353\036\035\221\022\244\017\034\243\n\021'O'z\021\002B\241\036\023\220\002\004|\016\302P\361\030\202P\004\251\355\001\345\206\327\222?\007\237\202t2\030ad\375d\362\022v\335\305\310\372\023p\361\f\224@#\022$\317$l[l\324\362\203\255\261/\277\360\361#\370\367g\022\267$4x\262>\242V\374\237\\\001\342\261\221\365%\300$\357\317!yO\277\246\020T\213\364\226\t\212\001)\362\247\337\237F@\204x\036]\240\227V\326\317>\276=\275;\201\365\356\024\237\262~\022\021\022D\002H\366\363\307\363\307\222\017\215\r0IqIT\223\250\254/\001\270\270?y\304=\357\216\200S^6\"\266#=\376\274\373\323\016D\210\023n21\300\236\254\237u>\236ta\204,\f\263~\316=\017vZ\242\230%'\201\265\267\377\215e\211m\213\215$`\330\330\267a\3540\362\226\365%"
+	.string	"\303\315\255Ul\312bL\341\204\210wM\373s-\355\331\206L;2\275\365\351\261\375\331&x\310\343\223\365\227Q^\033iXF\262~\252\361\221\375\231\203\354y\206D\213c\037\020\326|\002\023\241d)1\373\363LH\354m\354Y\026\001:11\031\232\256\364\342\022qd\375\bt=\301\236`\3170\030*\236\304\366\210)\212\024\2620\007\221\341\215?\303\n\351\356\326\364\346\376'- \003\307]\326\217\200\213g\215g\215\247\027\f\025\317\241\b\206T\207v<\306\374\236\330\370\323\213\311\246\247\240\242\264\342\026\325\226\314\262~\004X<\261\376\314zb=g4\343\2468\030Y\366\200QF\365\324\372s\306\237] B\300H\313\026yV\211Y?\271\236[O\031\317\030\021"
+	.string	"zF\375I\365\214zZi\253\266\330\bz\306\324\210\267\024\357\220\253\372\323\352\177\212\201\364\363\234zJA\200\311\323\351\351\364|\202\241\342I|a0U\031\002o\321E\205=a\374\371T\310\004h\310E\326G|\276"
+	.ascii	"\024\234\342\367\"\311\346\002-\352\271\251\261\370\263\005\213"
+	.ascii	"'\323\361\217]\213\235\250x\f\0130\306$rb\025\003\351O\246?\227"
+	.ascii	"@\2048!\216\214\267"
+	.string	"\267\254\237JO\027\317\244\347\321\ts\021\036\216\250\254\237Fw\262\244c\323\202z\026%\361\244bXe}\227\007\340\223\027\231\220\320s\005\f\325q\360hI\222\022\006X\217\326\320\237+^\256\027C\300\262>\"K\326\336\242OW\326\207\300\326\323\347\351\363\frbZ\314A\366\367D\320\350\t\364g\020\224\217\304\254\237?\317cq\334q5\201\300\317\223\347\311\263\344c\333b\243\230*LQ\244\024}\364\030\307\212$\236EJ\"K\243\324\213\024\246C\274\267\210T\326\341\224\2634\236\245\n\210\020\271,\214F\243\037\025\306E\305(v\206\206,P\2020\3759\035\343\226\254\032\237\234\005\312\257\207\310\360\340\262f9\314edD<\236\27019K\023&,N\316\306q|\203\351I\016\230\305\220_Y\326,N\316R\b\"\304\363r\030\371qB8\270D4\024\263\312\232E0\231\244\302\206\335\216+ \273\254\377"
+	.string	"\255\276\263\034\351cY\322\364\222j\3621\035\342\271nS\240\274\370;\313\222\263"
+	.ascii	"\202\b\221\313\262\222\314\245e\315\242\344L'>\274k\326g"
+	.ascii	"I\242"
+	.string	"\274\021\303m,\353{\260\333\230\220\220\262fA\222\243Z%m|t,~F\036\260\342\356,@\356X\366\216O\026\020\263\210y\234k>\177\212^\312\036=n<B\316\262w\226\";Jk\205Y\326,zDX\206\260\004\311Qrp`/\262f\311;\032\365\024\032\302H\307\276\253?\237\254Y~\260\340UY;\313\333\032K]S\213\215c\247\330\347'\226\202r\21109\201R\214\205\2342`\222\341-1\305\235\245\356,>@\204x\236\034\223\025M\262f\351qv\353\311\233P\326g\231c\241\373\223\311\257&tU\262\376\f}\233\205\207\007Q\213U\214Y\237EN\013\t\r\034Yg\366y-\013\\\216z\267v\374pbq;\313\216?\371\246\345\005\375e\375\031\202l\226\266\263\350\370\223\254\214\026~H\262\376\fw\373ga\233\301\304\225\365g\240\333\237\201--\215\345\214u\256\371\374\345\360z\325\352"
+	.string	"\251\262\376\fSff,g0T<\206\026\340`\033[T\034\f2d$k\2263&HdhY\177\006\240\2622\017\260X_IJ\b\307\306\230=0\230"
+	.ascii	"\361\310\342\330)\203W/O\210\340ZW\027\013\016\030*\036Dw\b\323"
+	.ascii	"\237S\333\304g\310\313\353,8\316\022\006\"\304\363\232pGG\234"
+	.ascii	"\262>\313\r6\350\313\254*k\226/\026\260\035\304\304\006\031\t"
+	.ascii	")\f\222?^\0206\262\3308\341O\232ZT\326,4Xj\374\350[q$\353\263"
+	.ascii	"o,5^5"
+	.string	"$\267A\273\254Yf\220p\261\257~\305\262\305\266\305F\354\\\354\224AR-\211\016%Zg\331b\023\024B\2255\013\026K\026\330\222\267\027,Y,2\302\226x~\204\304\313+A\243\026,1\362\234\212\256%6\022>UU\212\356\030T\032]\222\251)B&X\022 QzDE\t\262Su1d\340xzby\001\343\\\213\263\214x\3051\024\007.[\227\023\225\254?Bj\377,M,M,/\230K\370\222\\R\327\2416,\310X\335\n\026\247\034\005S\021\f2%\353\217\b\332,.X\\\260,\335\0317\036\211\377\224|(\235eI\306\023\317YRG\322/11\216\n\022\222\026\323q\034\307~q\263\305\333\023\3325\221\005\013\026\243\252\n\276\364\325\212G\220\254\177\226\026g1B\006\236\031y\2215KQ.\223\322\204\004E\206?\226\025,+\0020\005I\206\275\315\"\304\"\264\322ug|$"
+	.string	"Q\340?\255\263\026Y_\0069\026\037\026 \026\037\226 \226 \226\037\226\037-&\204\007m_\006\256F\026\236F-\306\022\263\304Zl\363(\321\220\256\366eX\242BE\213!~\tM\231\242\305@\214\335\311\020K\221\002b\214Gq\377+QV\242\300Q\307\237\270\307)\203\257c\216\"\211K\262\276\003"
+	.string	"\021\021\227n\311\237\330\312)D\023)\211\032W\326w\300\217'O\232\016\300\234\021\243\311Z\326w@\333J\341J\341\212\341\007?\330\004\301\310\256_1,d\307\242H%\311z\305\211\003\304\2324YI\362\362\204\315\001Y\202\202K7\026\250z\\PP\245\005`\225C3!<Y\337\001I\201\201\034\306\252\034\240b\005p\005P\213!@M\317\013\021\t\222\225$/R\276\004\301\310\376\276\222\2440\310\021 \326\021??\bp\334\351\365\365q\230\342\211a\217}[\331[\266\301P\305I#\340@\222\265\247\244\005\021$Y?\2064=\275\033l1\340\0302\204i\310\263\265\377\225 o+A\336%\026\250b\244\021\306\332\262\366\340\254'uHY?\006\030@\200H`f(\b\246\030\003\322J\335J\335\n\036\024\004\215<+w_\301\313\203\017u<\331e\275b\227\313\002\275\234"
+	.string	"\306\020\257\360X\241[\341\261\322c\245\307\312\334\312\234\026\233\340\007\221J\335\025\312>\fG\366=\260+p+o+q\317c\343\244\230\035\252\242R\345\n\003\220}\030v\354\330\241\305$0R\005\003\331\n\333\212\216\025\266\225\264\225\266\225\266\2254F/\030d\354\303P\264\222cEm%\307J\332\212\331\212\331J\232\213\225\264\227HG\025\220\254W\316\330; uI\246\340\310[3\234\313\372/,\356\277\340GF\326x\344\205\273\033\354\333\312\215\0251\244P\034+\025"
+	.ascii	"\ti\005G\346\223\302#\312J\330>\323\301f\3266A\331\341\225\365"
+	.ascii	"_8\373\372r\251\334\275Pc\377+6\316\276\255\330X\256e@\025'\025"
+	.ascii	"\200\261H0\361\215ZjR\221\365_xZ\241\261B\343\305Q\365B\320\312"
+	.ascii	"\326\312\326JW\323\227 \030\031\327W\272j\254\315@\314\312\342"
+	.ascii	"\200T\025\210\305\276\255`\255\304\230R\205fD\004$\353\273\300"
+	.ascii	"\267b\265b\245\305\210\270p\267\377\025*\366m\205*Y\364\341'"
+	.ascii	"\356\231\321z"
+	.string	"-\r\342q\031\231\021\201!%\225\261r[|d\001\035\211ddq<\204\003\215\004pHS\326w\201g\377+P+P\031+\003\252\236\036\001$--\311\241D3\322\324\230\365[\030\262\377\025\247\263o+N+0\216BT1R\001\256E\\\2140\344\246\374d\275\362B\371\003e\225\230\365[\300\333o\301\007\323\331\267\025&7\210\213\017.\216\264\220c\377+Jo+J.\020\030\2528\211\202\244%$\212B\016\277\372\262~\013,V\220\330\267\025\244\225$\017\\\360\264a0\325\r%h,\262~\003\030\367\277b\264b\224\211\222?\261\325\226\362\272\224\226\250\030\307C8x\255XD\t\233+*jbc\333\377\n\021\373\266B\264L\313\200*N\002\301\360\257\221l\206\021\257\035Y\277\001^+C+C\027\b\341\021\004Sl@\326\312J\336\236\261\002lE\326o\300\213\025\236\025\236\025\240\306\257\225\237\257"
+	.string	"%\247b\b\371\313z\305'c%g\300(b\222\365JO\003\210\234S\234S\234\215Q\234U\356l\204\031g\324-f\355\244\262\344\321\264\333a\003I\326N\306\027\207a\f\253!\fhtJqJ\321b!L\035\211\262\177g\224\263o\316(K3\335\026\363\274\203\177fb\313)-\030\365\262>\003\376\016\235P\016\235\210\210\316'\316'Z\354\316\236\027H\f \262\317\200\270\3535.\031\025\303\307\t\255\260\320\307\222\207\334\024\265\033M\232\264a\354\312O\214E\304+\216\3678\200\243\304Q\b\263>\003\266\366\357\024t\n\266aG!\252\236+\r\230\226\300r(\306\361\036\007J\301\036]q\326\027\301\270\003\003\343\013\020\357\f\235\177\316?'\340\022\233 \230\242\222;\001\255\216p\345e\355L\262\344\241\341\246\264IQ\262\177\247\237\237\363\bL[\314\303\222\345c\005\f\3058\206\342\340"
+	.ascii	"kTkI3x\271Di\312R\326\0271\304\251\347\324s\366!\362\335\331"
+	.ascii	"\267\265\004\212`\326\316\275%\0175'\210\213Y;\213\334\211\013"
+	.ascii	"\240%Ng+\222~He}\021o\316!\316!\315\241\230\037H\357\f\267\242"
+	.ascii	"\270\254/\342\314\t\304\031\304\t\304\231\347\314\323bQH\"n\354"
+	.ascii	"\213\270r\3269\357\234uN<'\236\335\355\264\030;A\034{\241}\211"
+	.ascii	"x\332\027\301\3029\347\354\341\234[\3629\351\234tK\276#!\030"
+	.ascii	"\3365\213\032\367bd}\021<\373,8\331N9\247\334\217\257\037ppZ"
+	.ascii	"\f\002\303;\026\346\234hN4\347\016D$A02\247\333\235;\230yC\262"
+	.ascii	"nd\355\324\361\342H\004\322\230\265\263\315\311\006\033\026\201"
+	.ascii	"\tf"
+	.ascii	"\355Ls\262\271*\324\262\204\234l\316\2656\026U9jl\355=\231Sk"
+	.ascii	"\267\242\364\360kd\301\354\306\r\247\331\222\241 \030Y\216;\315"
+	.ascii	"\n\251 Ne\355,kw\364\370\221\221\265\223\3149\266\326u\026\225"
+	.ascii	"\2653\3149\226\334j\372\033\034\023\013\002G\265\227U\327\223"
+	.ascii	"5\205CG\035\025\201(\351bA\306\326\226\363K\371e\350u\347\327"
+	.ascii	"{\rR\322\224\265\323FRJ\241\334O\326\316\032N\032\314\305\241"
+	.ascii	"\264\037Y;\271\2344\226~?a\2134\2343`\300\211\361p\212!DERW{"
+	.ascii	"\304\036Eq\241$j;\247\234S\316\254;\343\251*A0E\031wf\035\371"
+	.ascii	"\372\342\200\262v\306\320@\222\250\200\313\332\211\345\274b\233"
+	.ascii	"\334\3115\311\332I\345\274j\372\234\365 \274\262j\307\306\216"
+	.ascii	"\374U\201i\273!\345\254B\n\241\n\204\022\310\202\222\023\212"
+	.ascii	"}sB9\243\222Bq\354\242\003*wm\030L\325g8\367\225\365YP\261\264"
+	.ascii	"\344\204\301a\312\360\305\2350p\224\361\224e\355tzq\260Ax`-f"
+	.ascii	"\355l\312D\\HH=\262v2e\242\300(\266%\213DDN\027L!<\202`d\316"
+	.ascii	"\244;]8\305\310C\314\332\211\364\342\340Z\262\342\221\265\363"
+	.ascii	"\310i\264\254a\304F\216\254\235,\234FX\211m?N#g\013\274*\207"
+	.ascii	"\206Um\230\326\341\017g\021\362Ev\301d\253\260\211\223\307\311"
+	.ascii	"\343\034B\272\023\004#s\n\3359\204DrbZ\221\265S\305\213\343\217"
+	.ascii	"\250\307/kg\220\023\210\306KE\217\254\235=N\240e\213\032phN "
+	.ascii	"\347O\222Ob\254\324\374+d\342\302\351\243\217\224O\270\016\225"
+	.ascii	"\21446j\261(e\024\244\025\362\366\337d<c\223\312\r\266\306\276"
+	.ascii	"-\003\210\t\332[#\263ok:\200d\375\025\346\016\017\233\213J#H"
+	.ascii	"R\336\\\334Ib@\177Y7\025\217eyc\177Y7\2434\023\365\237\r\032"
+	.ascii	"rY7\2374\023\325\214\210\345h&6\021\223\030\211:k\261\265\302"
+	.ascii	"\214^@A\006-\231\202r\300\251]\257Z\214\345\205\241 \030\331"
+	.ascii	"\nb\200\200\315\302\346\024CA02\3027\013\227\226|\264\262n6y"
+	.ascii	"qH\311`r\226us\260)\b/&\025\t\222usIS\2609\324\363\002\261)\330"
+	.ascii	"d\3023ED\361o\206]\220\272f\240&\222\303\206\r\240\256\275\275"
+	.ascii	"f\022\02656A0\305\2777\223\024\001\035ye\335D\362\3428^E\211"
+	.ascii	"\302\230u\363\b;\304s\r\313\272\311\327\364K\366\3649q\3715\215"
+	.ascii	"0F\255 \373\221\224!cI\334\354\323p>\214\342\255\250 A\232zw"
+	.ascii	"\266eG\232D\336\324s\275\264\266\346\262n\016\211\241\220\n-"
+	.ascii	"\353\246\220|\306$\307cq\205\240\r\004\b\3630\307q\034{\271p"
+	.ascii	"][W\025\020\361\360\230\2077x"
+	.string	"\334&\266E\237\254\257B\340>[\3066\353\330\267f]\323\216\345(\216c\360\200\020r\007\305\301\353\207G\b\250\323`\023Jp2\262\276\nF\366\233sl\263G\263G&b!\356I\262\300\210\241\n?\366\331L\3246\343\232qM\036!\340\340\221c\337\232<\256\220\3108S\241\315\255\371\346\266c\007s\352\313\306\276\nKk\315\2665-\306\306\326lRa\305~\n\212M\262&Y3\315\260\n\355\315\264 \033Q\262n\236\315|)\0015\315\340!ih<\232f\315\034AW\031]E,\024\271\025B\262.\323Ag\222\204\007\213\254\237B\241\230X3\254\214-\205=/\257f\330\0075\244\346\r\366\255\031&\026dFV\326M\260\027\307U\254\356E\326\315\257|\206\350\304\311\214\024\340\232]M\032\315\256f\215\032\315\031\315\031\bh<\363:\333O\201KFSKFsk++K\202)l)<\355\247"
+	.string	"\324\254j^5\253\232XXM\253\246\225\026\203\240\b\nQ\366Q@\322|j>5\247\352\274\244\336\234j\002\204lH\326\315\250\\&\205\205\016\276\254\233P\317s\213\364]M\241\020\327|\321|\261\344#R\205\202Xs\251\331\324\\b\3664\231\232L\314\236\273"
+	.string	"\224U!\365fd\375e}\024\262\366Q@\332M\027M\027\314C\303"
+	.ascii	"\274\370BDBj\016\031\341A\262\233FM\243%_\314\327\327\022\314"
+	.ascii	"h\305W\326?\341\256\250\310\315\203#\"Z\362\3558\206\200\310"
+	.ascii	"\221\023\320\232*\232*\232C;^\343C\022\004#k\n\2759t\204\212"
+	.ascii	"\311\220\254\237\243\316l,\351\313\372'\330h\0025\201\226\215"
+	.ascii	"l,D\344\353\204\251\3757}\316\2765}\226a\026\024A\022K\313mG"
+	.ascii	"\314\226\262\376\tGU\232q\225&O\223\247\261Q\213\261\361Q\"\207"
+	.ascii	"F\303\326\307\212\302\277\254\177B\320\276\t\210\214\214\354"
+	.ascii	"\026\322\020\016\336 rPkY\337\004BD\246\024D\346\342bb\"S\361"
+	.ascii	"\316\036\b~\260E9S\021\311D\326\305\363~)\257i\206}G\366M\360"
+	.ascii	"\341\204\371\304\t\363\360ze\036n\236\230(\247\f\362\221>-\241"
+	.ascii	"\254\231\207U\230L%\232\260c\337\004\034\203L\302\301%_\223&"
+	.string	"K\276\315\323\376\3401A\306\276\tG\200\200L&\356\215\257\3003\231\034{,J\241\2225s\311\222\207\232O\027\020\023\202\220\034\t3\311\004q\034\007\305(\024\307f\\\377\316Lr\302W\307\0235\264'{L\277=\246\2216\216\3315*\243\243\330\351(\003>>\246\221;{\266Z\303#\202`\212}g\032\311X\214=N1\217\275\251\252\257\254_B\222\375\022|0\2050\2050\357\252\230\312#l>B\262f\016I\306q\332a\tl\373\314\037,3\217\231w\234\033\201\257\204\262}\3668\327\342\341i1\b\020\357J\310\262\263c\352h\321\356Jh\362\341\203I\007\343\\\213\257\236\274V\004\255\350\312\372%\370\354\237)'\307\244;\nQ\305.:\270\261\006\305\001\2144\004F\321q(\251\250\364\207\306\234c\362h\357\226d\200\325\301\255\340\311\372\0130d\3021\341\f\221\026\200d\307\216%\337\215E\257\005"
+	.ascii	"a\2461\323\230:Z4\036A0\262\2663u\024\326\005\272E\311\372\210"
+	.ascii	"L6\"TELL6\346\332\320\326\341\365(\2248\204\354\207Z~\302D\204"
+	.ascii	"\033\234\312\372\013\330\261\231fL3\346\331\323\021\252\273k"
+	.ascii	"\326_\200\330\330\030\263\f\352\375\";\263\214\215\022\006\205"
+	.ascii	"k\001WL0&\030\023\307K\343\227 \230b\330\2318\nW\310\325\240"
+	.ascii	"\2215\363F.K\372C\"[\200\322fn1\267\230^\007@+\364\262q\246W"
+	.ascii	"\013\023*\277\254\2315r\324\241\241\224\253\254\231\\L\032Rj"
+	.ascii	"\260`\322`\3160\374\001\003\023\274\300T#`\326]Y\311\343\247"
+	.ascii	"\304\330\306\261\355\fQ\2151F\ff\326\331\243\031n\0216\246\214"
+	.ascii	"3\263r\324\321\223!\037P6s\2129\305\274JV0\365\305\264:\363*"
+	.ascii	"\217MH\023\035Y3\253rT\023_Sc\326L*\366\316LInL\001G\242\242"
+	.ascii	"\362Y\005/\024\020\007\003\006\363\t\0046\216}d\021\271\3061"
+	.ascii	"\024\007-\215\302\240\245\031MJjHY_\001h\373g:\2751\235X\301"
+	.ascii	"\030\330X\210hI\3355\216\3678`\277\310n\024e}\005h\355\237\311"
+	.ascii	"\304\224\373r[\314\243\314\322[\001C\261)J\243a\326W\200\022"
+	.ascii	"S\211\251T\301\213\273\0040&%\335\001n##\346\221!O\002z\3543"
+	.ascii	"\211Xf\021\263(\3378\200![\314\301\023@\266?\300\346\033-S\210"
+	.ascii	")\304\\\241\325\032I"
+	.string	"\022\030\203\2159te\245\242,\353'\200\212\031\304\f2L\200\021\363\207\371s'\bF\206\200(L\036&\017\263\207-"
+	.ascii	"_G\316\354I~\335\270b\221\365\0210xx\270l\334\354\330\235\224"
+	.ascii	"/\033\277\254\002\"\304\013\217\250\240!\224\365\227\214K*\177"
+	.string	"2\177mm\261e}\004$\331\313\305\345\024\035VU|Y?#\240\017\003&\021!)J\257)3jd\275T\314Q\373G\n0m\031e\307]\221\304e\224e\342\021\240*-\262N\\>Y\"^\215\032\221\240\374\311\327\016\353z#\353#\240\307>\002\324\366\021pcI\270$\\^\237MK'_^\225~\212\360\310zY\210\200\030\373K&\354r\220}[\016f\"G\241\270\307J\004#_\bx\332g3\22160\020\306C\253B@\322\337\337\0220\006\204\330G\tO\005MU\202`\212J\276\004d\357v_\\W#\353e\222\\\206\005\004H\n\001?G\216\3443v-6\252\"\t\202\221\035\356\3473vi\344mi$\237\301\304<\206 <\341Y\343\340\0070\262\267\267\344cA\210}\376\356\002\360\364uD\366m\311\207$\254\006\217\036C\206,\365X)\b\324\210|\251\227\313\232N\016\323\352t"
+	.string	"\001\262\f\302B\034\307O\330\004\301\310\362\276\f\222\204\307`T\216j\216M!2\363\341c\211w\366\b\252\375BZ\342\301nYx|Y/\355\216<A\250"
+	.string	"\263^\326\335I\023F\233\231\022's^E\200Y\377"
+	.string	"1\366r\307r\307\222\316p9\367%\335\241\222\022S\326K\270%\217\036gQ2\226<\226r\205R\2440\351\212\213\355\230\314\r\311:.Ke\252?\276\272\212\001e\275|;\020\272!:\272\200`Q\021z\313\372\007x\332K\0353n\230\221e\375\003\020\355%[Y\330U\216\254O\002\225\275T\013\314\323\023\222\365Ip\262\227h\3139>\035?\262>\t\177J\025PD\230\262^\346x\202\322$-\353\223"
+	.string	"\344,\t\317b\326L\032-\266\242\262\376\331\267\327-\305\330\274\3428v\302\202Pz\304e}\022|\254\271lN\354\200d\275\274\221$\342\013\033\312\372$\240\355\345\327\362\353u\313c{\025\017\245\352\262>\t\\\373_r\275-\271\2266\222Bq\2344\201\0216A0\305/k|i\343_v-g\260w4\b\245Ie\275\244\361\341\313\032V:\022\033\263\276\020\366\331\"\207\260\317\366$<\355\177\231\365\345\326\377\002Yj\345'\032\210\200$\021\314\372\350\305B\333\245\214\017_f\345\020bX%\353\020\354\263]b\355?)1\212d}\022\202\226W\313\252/\255\360\206Z\fe\rC\371\360eU\006\260\250\266\262\376\227Rg\337\226R\313)\266-\346\221\200p\257m\t\022\201\321\350\362\020\367\277\204ZB\301\214\311\237\270\347E\006n`\036T\220\254o"
+	.string	"\275\375/a,a\274\211,B\373\357J\312\025\2211\360.\353\033\300m\377K\247\245\023Lw\374\211{`XP\366\365e\207\330\223\365\r\240\265\377%\323\222\211i\204\343\035\037\337\214\254o"
+	.string	"\030\373_*-\225^)\311\237\270\307)\003\346\017\304:\302\254o"
+	.string	"\241\244\244\345\321\223M\262\"{\327\254_\200\277\375/\213\330\267e\321\362(\371\023\367D\211\200\2666\230\246X\247\230h#\353\345\321\277l\2614z\2712U\323\022\032D\262n\211Yh\233\327\330g\373\002\254\355\177I\264$\202\201\220?q\017\f\021\022\220TV#\353\027 \306\376\227C\313\241\227Q)\304:\035\376-^_<Q\222\222\365\013"
+	.string	"\244B\305\022\350\307\237\270\207\207\035\233\"\224P\326\037\301o\377\313\037\366m\371\263\004j\205v\224\253\301k\034;q\240{t!IZ\002M9Q\341\005\230\365G@\333\377\222g\311\263\354a\333b\236\020wbidq\f\305\301\361\207\r)IP\257\231\236\020\221\254?\302\214\315\276\301U\340\306\f\250\342\244\016\276\220$B\321@4\342q\251"
+	.string	"\225\004f\375\021\244\260o\260\024\230\361\3530k\217\355\373\342\031\202\031\177x\021\236\3626e\252B4%vY\357\230}\266'@\343\206\025\177X\005\034%?\321"
+	.string	"\367\210\342e#\353\354\005?9\234\370\303P`\304 Wx|YgE\026\332~\300>[\030\353\303\341'qV]oY\037v\302\302\206\354\033l\b;\201\211{\222:h4\024\004S\214\217\22488\001"
+	.ascii	"7\354d\007\021\340\b\0069\b\310X\023\250e\034\224>\274\254\341"
+	.ascii	"\302\037\266\202\tO\270\021\365\"\353\0348\370\341p\023\327\251"
+	.ascii	"J\210-\353\016\002[C\230\311\016[Zc\326Y\213\205\266\356\337"
+	.ascii	"\207\303\201J\241\025B3\224\034^\362\303n0\240\024\034@\306\262"
+	.ascii	"\316q,\264\315P>\034V\"V\227d\354\260\237\037\374\307\266\305"
+	.ascii	"F0?\276d@)\306\261S\006\360\220\273\265\036H\016"
+	.string	"\377\271\327\037rgY\303G\222:\334\272>\275&D\377\223m\237\021\343b\326'@\335\206\213\300E\340\276;\3438~\243\356`\276\303}9*&\372\311\032\336Cn%\361<\301R\273\341$#\353\023\300\r&B\023\003\016H\326'\200\331\016\002\013Q\356\t}\325\310\372\004\350\n\222\007\204\310\265\205a\326\360\0179 \037B\262>\001\240\366\017\337\261o0\0362R\233\022Q\353\216\013\022\274\354\252\f48%Xq\246G+\316\024\206qW^X^h\207\027g\025\206\331q\241*\001\3164JM\276pB\347\250\323\246\320\3119\201\n\201\352\024\352\312\230\220V\237\326)\216\210\345\210\032\252Q\0226\321\023\254\322\0214\325\025g\016\211\251\211)M\316\r\316\f\021T\245\032Ha\023\305\211J\020CK\025~\255\322\02305*\2659\201\305*\035\341\204\352\334T\245'V\250R\035\235\235\034\253[\225\241\t\253"
+	.ascii	"\242\004k5j\302E\221\302M\016U\005+Uj\003\214\f:\325\233\226"
+	.ascii	"&\215\bx\005\235\352\r\013\364&\372\202t\006Gj3\035\261$A\315"
+	.ascii	"Q\341\3455\036>\310\231\302T\251\216TZ\242u\276\306\203\216M"
+	.ascii	"\016\325j\201\364\004N\264f\006&j\215\242 \203U"
+	.string	"z\202Ej\215\332\354\314\330DO\310\261\356\224\020\315\261NuK\n\023hp\246&$\300\221\352\344,K\234\360,q\002\fRzby\"J\"\205\tV\351\n0\210PZ\2478\"`\020\321\346L\2250\210\210a\005\030D\3009-\300 B\277\306C\316t\312\002\f\"t\n\035\327f\307\255\302V\351\210\252\b\246\364\004\214b\352\002M4\247\205\025\252L\r9V\252\265\272o\244.\324\234\230\262P\303L\324*\243\201\351\b\233\2505\207D\r3Qk\225)\325\300t\204\364D\224\232c\035\321\"\325\300t\204Uz\342)=\301R\305\211\316\214x\326P\215\272P}Q\260JW\230\261R\231V\031\245Mt&\247\005\025\236N\250\215\364\204\022\322\023Q\253M\316\003RP\245Vk\324\004\253\364\304J\265\004\253\364\004\324Z\305\311\231Aj\300:\263\264\312\344\230\300\201sL\340\2108\361\272PC5J\""
+	.ascii	"V\031\0233+9&pD\314\340\354\250P\303\214\324Y]\221\312,\253\321"
+	.ascii	"\026\236\257\3610\203\223\242\032\375 gz\201T\346Ej3U\301*=!"
+	.ascii	"S5a\215\232\210\306X\245'XZl\242\325\251\214\0130\310\020C\n"
+	.ascii	")\274'p\246\326i\024\002(d\240\211*"
+	.string	"\253(\300\320H\251;\325i\0054\"P\344\230\220\302\004\0249&\320\340LM0_\343!gF\252\223\242\202h\216\325\204\256\312`cS\202\0051\320\340LU\200@*\363\224\332\224\210\332L\2436\224`\245\346\304P\325\271\341`\225Vo\2447\355\364\246\246:\305\231\252\220Cb\0045G\005\3534z\203"
+	.string	"pn\310\241\261\356\324\214`\241\301\221\312Dm\220\301\231Zm\246;%dd>@A\245\301\231\232\220\314!\361B\2033U\341\204N\213#\265\241Z\253\355k<HuRXgf\242:\325\352\324}\215\207\252\316\211\017r\246:'ZR\350\314\334HoZ\346k<HG\344Lq\246:\3735\036^\252\265Z\225\3211a}_\343\241\304\324\206f\232c\215\352\327xp\241\326\314P\255\325\026\207j\255\276\257\361P}\261\261\331\301\301\311\301qo\310\241\326Xsp\\\023Q\251\215\226Rwt\264\316\315\214\264\032\235\241Z\253\312\023(8\301*=\021c\302\313k<\344\230\300\231\312|0c\302Z\235V\251R\035\347k<\230\200\300\002\037(\020\302\005\2202:&\254\312\022\23248S\023"
+	.ascii	"8\021u!j\302\313\314L\t.9\324\024+\274P\245V\234\024\24663\333"
+	.ascii	"\332\262\264\324\350\003^\226v\247\204\251\315\314\0226ab\352"
+	.ascii	"\246\320\3119\201%\205N\316\tN\351M\364\005\032j4\307\004f\313"
+	.ascii	"\324fFI\343\302S'\352\302\324f\246\245\021\2613\303B\225\242"
+	.ascii	"\230\2720\265\231\331(\246.\2744\322\033j\264:\245\221\231\332"
+	.ascii	"\300 \255R\243:N\235\252\013S\233\031\026\030\004\017(hD\320"
+	.ascii	"\340\354\3440ipvrF\244\210\332\300\260\304T\24549.\264,YZ\250"
+	.ascii	"\316\251\315\f\254D1u\341\225q\211\201&\232\323\002\314k<\310"
+	.ascii	"`\305\221R\251;"
+	.string	"3-\326\231\231\350\361\371\032\017\021TG\320Hi\232:)H4_\343\241\005\022\"F|P\303L\216\315\tRj\316\tMg\265\206j\224\304\324ffWmlJ\320\271\331\241Y\236\210A\347f\207\346\325\261\221\2620\265\231q\2379&pD\320\214\270\211\276`UJ\255Q\024\2447S\022\311\327x\370\200\306f\272Sb\272\202\225\232SS}\300\003\340\025\023\311\251\315L\323\235\332\3140!\260NQ\2440\265\231qeh\266\240\330)A'\352\302\256Jo\242/\300\260MtJ\255&m\242\3237\307\006\352V.O\340Li\242R\026\244#p\246-\324T\243,Hq\246-\300473\273\304\353d)aj3\023\203B\206\233\350\013V\234)U'\251s\263\203\302\324ffej3\323\242\234\332\314@\227&LmfZvNPK\210\271!\247f\304\324ff%\206\024T+\364\004\316\024\207\032\205"
+	.string	"\004,4R\251\t)\316\264\005\235\233\234dr\031}"
+	.string	"3I\20335\001\205\fS\233\031\247\224&\307\205\251\315\214\373\242HA\206\251\315\f\313nV\241\324\350\003\254\322\021S\233\231dN\f+LmfX\230 x\260R\243:\036\244'\240\260\225\232S\325Yaj3\263\"\245\346X\253Rj\363I\203#\245\312\234\320\221\221YI\241\223s\002\216\210\252\bfuy\"\006\235\235\032f\242%\2305\325\035\033\025\25049.\214\220V\251\321\030\24663,#\244\326)\365\006f\365\004\265\204\227\023\324\022\254(\2448\256\364&\372\202\224\312B3\265\211>"
+	.ascii	"F\331b\303\223*\245\241\302 \275\211\276@\315\251\276X\245'`"
+	.ascii	"Z\244\325\031rH\304`\225\236x\30191\255:o\2509&p^\2446DGH\251"
+	.ascii	"Q\035)U\347\255V\24533\321\326\002\037(\360\341\002\310\t\246"
+	.ascii	"%\24226TST\235'\242Q\033dd\226Q\033LXq\246\324\030\24663oUjM"
+	.ascii	"a\302\222\232\334"
+	.string	"4\324\034\bX\245'\226\324\034*5\205\025\351\fK\315\2145j\302\212t&\2523BgZC5\231\302\252s\223Bu\352Zmv\242&\244(Tm\242;\031H\201j\215\001j\225\236HZ\255V\2535\232cc\002i\275\231\326\214\230\332\3140\24526%\242\325)\n\321\226\024:9'89@!H\241\223s\302\362\304\324\304\212\005\001\340 \201\005)trN\220\251\006\240J\225Z\255\322\026f\250\316\246\013\035\252'Hir\\\200y\265&\252M\260JGHq\246-\330P\255'\224\230QZe\252.\310P\24587\300P\225R\233T\351\315Nu\304M\216\265\2723\023\201T\206FD\r\325(\t\0233\312\247\325*#\325\300\264\332v\240\340y#\265VS\214\220\251\276Lmf\222\326\252t'\003R\031\250R\232h\216\2155'\247\304\213\216u'\206\251\315\214\373\231)U\212#=\261/\302"
+	.ascii	"<\030\300\b(\\\253\316\315\016\315+\225!\301|\215\007\023\315"
+	.ascii	"\252\224\272c\215JU\2206\227R\232\034\027\2222\325\033\242)\236"
+	.ascii	"V\034\351\fU\252##\2433\2651QS\215Rg^\254\257\361P\235\001E\364"
+	.ascii	"\006y\202N\365f\245:\203kU\241Z\225\342\344Xw\242-U\231'\215"
+	.ascii	"T\003S\233\350\324:\305\021\261b\005\221\"We\230 \224\310\037"
+	.ascii	"Jd\020%\362\207h\006\021\315\037Pd\020(\362\207\024\231&\272"
+	.ascii	"\223\201i\txG\246j}\215\207\032\330\252\314+\265F\255U\344\007"
+	.ascii	"\253N\322D+\225\021\001\323di\221\312\240\020\201T'E\313\210"
+	.ascii	"\227\02438\322\235\fH\251*\234\020S\235\341&JU\201\305\372\032"
+	.ascii	"\017U\233\034\252\025'g\246*C\202*\265\332LU\0301C\205\340f\247"
+	.ascii	"zD\236\300\231\342L\243T\353\256NQ\224\220|\261\276\306\203u"
+	.ascii	"G\307\272\223\323Ve\244\324\350\r4\324(\013M\027D\220xo\246\326"
+	.ascii	"\343\211\250\365\350J"
+	.string	"ef\240Jo\246Vg\365D\324F\005\351\211huG\271\264\276\306\303\007't\\\250\322\233)\t\032\251\rR\024\244\326\250\f\260\023'gZ\275\271!\206\225\233\033b\240\221\316\340\244\250\342\314 \255\3560\255U\352\216\t\322\352\316\222\304J\265\265\311\231\311\261\346Pc\260Rst\2528Q*\t\227\0238\321\022\326\251\t\326\234\232*\n\322\352N\023\006\353\364\304\224\306\005gz\363\242\210\336\27448\321\233\233\234\031\234\351\215\322&'\006\246\265*#=\021\255\316\260\242\224\312\250\320\262\255Vj\216\216\226\312X\25191\324\234\330\311\241\326X\253\325h\f/4\323L\263\023-\241_\343Az3\265Z\24342/5*M\241k\254897\310\024Q\232c\225\272\223S\203\254J\255;8\323\033\267J\203\2233#\255\272\325\251\215\315\364\246}\215\007\251\215tf&\372A\265*33\023EZ_\343A"
+	.string	"\326\327x\250\326X\2437\037\340\344\334\334\344\314\334\260U\031\031\035\023O\024S\2525\352\2025\207\312\2646e\334\327x\260\316\354P\255U\020U\031\024R\353\316\315J\r39622\255\025g'gFF\306\245Jqn\310\221\221q\253Tiu\007GFf\323\340Lk\220\221i\2538S\235\252\214\214k#\225\221IZe\254\325\251\215S'\205\325\003\032)5ZS\365\340\203\252uZ\342\203\035\234\023\036\240\330\301\231\332x \302"
+	.ascii	"d\0060\002\212\017\2444;638\323\017\250\325\235\017\n`E!\305"
+	.ascii	"\261\211\342P\245V\234\251\fMTJ\255\261\352"
+	.string	"\310\310\274\310\264\326\352\324FF\246\215Z\243422\255T\003\323\252\214L[\303L\216\215\236\221Re\224\326)\216\b\034\025\254S\234iK\265\3060\203\263\243\302L\t-U\031\033\244(\314\314D7\216\n4Q)\265\265Ve\246:#LHQ\220\352\244 !#\"\206\021\257t\006'j\255\342L\267U\006\006\021\032g\032\003Nu\246\235\352T\217U\231\023@\210xO"
+	.string	"!\"9\003bz|\215\207\352N\211\252\214\013N\252\324Z\215\336\264R\033\2426#vtn\366\216\214\rR\232\352N\211]\225A\241\272S\342\225\312HuR\220\250\356\224HJuRX\253;%\334\352N\211\343\n\037dff\242\355\rQ\031N@\241\204\326\372\032\017;:729\324\024'ff\242\032Hed"
+	.string	"!\004\b\003\330\321\271y\332\344T\245TeU\246E:bG\347\346m\2556;U\251\f89\323\035\235\033\026\251\f\316\211\251MT\206\232S\305\221V\2318'\2466%\314\314Dw\n\232\250T\206\2505J\223\244VM\310\324\234\230\326\310\314\314Da)M\316\tT\230*\265\261\231\232hm\220\322\034O\340Lmtn\242#ff\242\317\023P(af&\332Jgp`\260V\243\322\026\254%\320\314`#\235\231)\241:\215\261\276\306\303M\016UG*\225\t"
+	.ascii	"5gF*\203\265\032\265iVe\2526DG\254\320\340Hut\242\257u&\252s"
+	.ascii	"\2233\003W\243T\251\265\032\265QVg\220\332\020\035\201\"z\223"
+	.ascii	"|\215\007\232\251\016\f\315T\347\275\311\301\221\322\310\350"
+	.ascii	"\310\320LuVpr\246V\034\251\rR\252\016\207\024Q\033)\315\0042"
+	.ascii	"RkTJ#c\302D\216\264\206\250U&E\364\206(\316\016\265\202\327x"
+	.ascii	"\240\300\272\2457\321\027j\250FI\224\330\251\2764R\233\022Q\234"
+	.ascii	"\024\252\323d\n\353\224\2323\245\3060\303\214\201FJ\235V\245"
+	.ascii	"4K\253\314k\255J\255Q\233&\212\350\215\323&j\315\261\262Ho\246"
+	.ascii	"$pr\246\326\235\031)\212\024Z\2542\325\031\2447S\353\216Zm\244"
+	.ascii	"(D\23563)N\220\236\210R\2456\224p\002gjC\316\215\313\215\324"
+	.ascii	"ZMQe\322Lu\2326L\2553\321\025)M\316\215\262:3\265V\247\326\250"
+	.ascii	"\265*SC5jmVsb\030\200\324fj\"\207\032\203\324\032\245Bk\230\311"
+	.ascii	"\261\231\331\321\231YJo\246$\2443Q\352\n'p\2467\324\022p`\240"
+	.ascii	"Jo\310\321q\241\241FsJ45P\343\202\264Z\323RwX\244\326\250\fR"
+	.ascii	"\rLo\246V\035\030\250R\233\035\032i\315L\025zB\207\031\275AA"
+	.ascii	"Z\335i\2453S\033\2444\355\211(\211\345\211(\t\353\214\324F:B"
+	.ascii	"gZ3\263\024a\235\221Z\245(\320P\2433,\321\033\232e\364\206F\t"
+	.ascii	"[_\343\241\306\212\223\343B\263*\023\265Fi\242V\251\013"
+	.string	"4\324\350\fM\325Y\255a&\307\306\204\233\035\234$\n\"n\2449H\024DP\245\324\035\353L\324\304\016N\364\206)\275\211\276\360.\2519\030\210\346\340L]\300\311\231V\2476Heh\241F\245\022\330\241\311\241\3520\255J\234\024\252\255UGj\255\352\023\244&\242U\233iT\005\024\324\030\353k<\240\310\371@\247zC#\302\212#\305\211\336P\245:oU\006EN\t$Rz\023}\001EN\t\327\232C\202FZ\003\316\324fWepr\246\326)\rN\316\t89\323\233\030\251\f\215\b\0249%\\\032\021R\232\234\233V*\363\316LO\344\264 \245\311\271IZO\350TwJT\231(\250J\235\350\315\f\025\251C#]A!\265\321\331A\301\204M\264F)\245\231R\251R\033rdp\246\023Xe\334\023Q\0229S\231\023;6:0+48\323\0222\326hU\346f\207j\255A\252S\205"
+	.string	"\226\332Dg\224V\252\324\006\234\351\f\225fz\203\304\231\336\354\032f\24453(\2427\273Y\265\211\332\200\2233\265Fmrt\250R+\216\210\031\352KU*\245\236\220\242 \2659\201S\302M\364\004\033tL\260\320\330\344\324T\245\324\032\022Rk\324\206\251u\246\004)M\216\013\324i\024\006g:#\255\356\310\240\210\336\310\240\240\2762(v\2422(\2427\315*5\207J\225B_\251N\n\353J\214\t\0239\326\235\031"
+	.ascii	"T\247(\2422'vJHi^\244:)\2542R\033\246\326\250\rS\252\224\246"
+	.ascii	"\0035\307:\0235!\223c\335\211\312\234\300\231\326Xsrn\25223T"
+	.ascii	"\030\232\234)U\252#cB\307FFf\206Z\225\231V\253\324\030\232\251"
+	.ascii	"\214u\212\263\263\264V\243&d@\330\240\240V\233\324h\315\314\004"
+	.ascii	";K\353k<P\245(\2467\034n\210\2468V\2519\326\234\033Xjc\265\346"
+	.ascii	"Pk\254\333\306&\207\252kf\254S\035\244\225*\265\316D\251\321"
+	.ascii	"\232\031\031kNN\t)\325\311d\311\231\246\240Z\2457R\033\251\365"
+	.ascii	"\205\245\206j\324\005\234\234\251u\006g\307\004,\225\021\341"
+	.ascii	"\242S\275\251\352\234X\261F\2514;\321\0222(rJ\3240\023\265)\341"
+	.ascii	"R\245\346\350\274\032\250\221\221Z\243T\031\2515J\243\263#c\275"
+	.ascii	"\311\241\252@C\215\336@\3151\301R\225\271\211R\2431Ti\244U\252"
+	.ascii	"\324\006)\265)\265\241\241\231\336\264\326\352\007\326\232\023"
+	.ascii	"S\033\023\020Te\250R\024S\027rl\240J\253\260Uz\202\032\265.\245"
+	.ascii	"3\324\235\234\021\326\035\035\234\351+\265F\251\232F*\325\251"
+	.ascii	"\"Q\344\2248Zehnf\24663\373\320\031\234\035\023zJ\235\251Ji\336"
+	.ascii	"\352\tjT[_\343\241*3C\225@j\023\235\031\321\\\331\2116\245'p"
+	.ascii	"\242Td\315\214uz\303\b\024;Q(Uj\305\221\236`\305\221\336X\253"
+	.ascii	";\030\240\211:\255'\240\240\272X?\2301\361\"\275\211\276\220"
+	.ascii	"\"j\243S\235\322\274\326\034\233\251\316\3625\036PP?@A\265\312"
+	.ascii	"(\245:)HD@\206\0210UJ3\265!\207\032\003\n\252\025g'\347\004X"
+	.ascii	"j\215\312PS\225RMHe@A]R\2551\340\250\020\265FQ\270!*\003MT*\303"
+	.ascii	"\f\365\245Zc`\301Q\241\272c\215ZG\314P\233Tk\f\317\252\214\324"
+	.ascii	"\032\265\216\220\336L\2558;2\240\240:qT\220\336D\251*T\253\322"
+	.ascii	"\231\034j\f3Tg\324\032E\341\215Z\243(Ho\242T\023I\353k<t\240"
+	.ascii	"J\247&\246V\034)\315TY\225\201\037`\245\346\304\340\264\241\225"
+	.ascii	"\312Hir\\\260Rst\224R\232\234\033-\225\201\301J\315\321YVqr\246"
+	.ascii	"V\235\034Wj\215\312@\263\023-\261\245\032\230\216\220j`:b[7\025"
+	.ascii	"\246\211JY\260\231FIP\245&L\354\230\200\302\n\3330\225\316He"
+	.ascii	"\200QF\255Q\024PP\231Tk\f\"l\242S\252\264\n\255a&Z\302\306&z"
+	.ascii	"\202\324\206f\n[_\343\341\204\316\007't\23638;*X\245U\251\f'"
+	.ascii	"t^\034\023\331*\255J\251\310\252L\n\252\265:=!\225\341\204\016"
+	.ascii	",\325\300\264\252\253U)\225\206&\352\246\320\311\231\321T\253"
+	.ascii	"\316\321\372\032\017U)M\316\215\314\f\365\203\031\0231:R\353"
+	.ascii	"\b\032\034\251[\225\221\236\300\211\312`#\305\301\211\326\314"
+	.ascii	"0u\244\326\021Vj\324ZMZ_\343A\306\304N\211\017\252T\251\rS*\315"
+	.ascii	"\004Qk\224FWe\250\257UFj\235R!`b"
+	.string	"\247\204\222*\265N\2517\264'\250\321c\n\353t&\252\023\235\331\326h\266\311\3111A\006\331Z\255\322\252\t\0239-\215\264\206\231\250N[\225\221\356\330Dm\230\332\314(\251\321\232\031-\275\211\342h\251N\n\253\266\356\330D\0370\265\231qZe@\204\200\"\352\002\210\020vZ\253T\306\206\005\205\224\006G\204\324\246D\324\252\224\332\224\210\222haj3\343\242\263SCN\216Mk]q[+\212\350\315\321\005\234\251\013S\233\231\030\253\314"
+	.string	">Xq\246;\033gzs\244\221\342\234\230Vqf@\021\275\301\231\3360\255m\212(\225Z\302\324f\306%E\224J\215\"\255\257\361P=\2013\265Z\245U\016\317\321\221R?\260\346\344P?x\253'\2426&\220U\231\023Z\0301\265\231y\301\231\336$k\254'p\2446(\2427\311\0238S\252\265\332ZeF\260\342Lw\334j\216\216uZ\242=15\201\2233\323ZepN\350 \377\341\303\t\023\314\360\302\n{\306\303\324f\346\203\251\315\314\0078\323\350\315\0073\324\352\007\036ZpN\350\034\377s\020kYR:Q\251\301\207\243\305\b\004\240W\021\2070\027DV\210\332\213B\01658\324\340"
+	.ascii	"\306\301\3069\200q\370\212\332\221\303\t\207/\016^K\265\032w"
+	.ascii	"E\216\177|Zq\214\373\347@\303\305,\211\006\346e\310a\206\013"
+	.ascii	"Y\022&\200<\034\272\\\302\334\200\004r\301\211N\200"
+	.string	"O\030\267Zh4\256\350\013\323\312Z\306Q\035Q\314Z^\225\203Cx@\2163\274\312\352b\264T%_H)\253\302\342p5\205\216\306\221\254\241j qEYq\250\242\002EmH\351%\203\310R\326\034\2368<q\230b\217\216\022\320\365g&\306aJJ\271\370\306\242H\212CT\213\034Yu\313\034\307\270\357\007\b\007\250\026\360\t\"T\217\254\177\343d\377\034`0\275`)\\H\3328(qP\342\340$\307a\351\034\23484\251\330\021\204F\023\007&\242\304+\232\240Y\233\220\375sp\361\f{[D\311CJ\372a\316\005\361\200\202\264\305\204\362\224\366t$\224g4\021N\031-m,\177\024\005\3338\264x1\2127\240\f\266\270\250\311cH\232\021\026Y\213\2555\317z,\335\0215\3554\330\023C#+\206\224jY1\322\202\316a\350\347\240\202\203\220b\213\032J\262F^Yh\373>\366\331r"
+	.string	"\372p\016AsQ\370\226\262>\037\207\037\016>,\232\320\001\361\234\203\317\017\023q\350\311O4"
+	.string	")^\033\263\316B,\264\315\204\037\316\201\207m\357\007\207\270\361\330\"\rP\t\343c\032\377\030*1U|xd\360e}\244b\241\255\b\354\263\215\231\362\3411\2141Z@\311:\204E)\311\306\030dU\211\217\221\362\307D\211Qd\325j\034\271\313Z\327!~xL\"\214\241F\245\254\357\003J\314\023\226\306\026U\223\353c\236\3741\2061\207\215S,\310\262n\025Yh{'\354\263\215q\362\3411W/\253'\037Y\2770\246p\305\360\035\313\321\303H\f\341\n\220\n\031P\232\354`F\001\255)\031\314R\226\225\001\371\020t\302\020\222\003\314\301d9\325TSA\207#\260\231\266\263\342\262\200,\331:\002\375\262b"
+	.ascii	"\231zL!rECb\220\304 \211IB\026\363\367\230$lnVCDn\322\266\021"
+	.ascii	"#1~P\"\3709\257\316f<=e\375\033\034\373\217\351{\3732\220\223"
+	.ascii	"\306\034|.KG\302\246\243\247\275\252\246\2216*\206E\236\226W"
+	.ascii	"$l=z\260\214\227\312\207\306\022\"o\021v\316\357\0327$\346\256"
+	.ascii	"\265\212\215x\t\031\333OIx\034\t\322b\306\224Z\374\343\313K;"
+	.ascii	"\272\320\272\361\026\003$\306N\017)\361\024\306\374hq+R\030\210"
+	.ascii	"\007\343\200\352\251\342\243\345\206~\021\005\217/\353\0265\034"
+	.ascii	"Z0\312\352\350\254\210\200=|\264\324\271{Kk`=Z\204\204\305Pt"
+	.ascii	"p\2167\243\272\230\271\226\"Rh\205<Z\222\270S\332\n\t\345b\322"
+	.ascii	"2X\215\260\247\270\226\300\345\331^Y\032\\\213\340\261H\035\216"
+	.ascii	"\261\267\025\030m\"P\221\223\035+IVR\202\232\334\340\264\242"
+	.ascii	"5\257%1:`\035]s<1m-\210d{Klx\027\250`a\267\326\262\230\235\340"
+	.ascii	"\302v\250\265\020\016I\025N\311\272\305\b\331\016\300+\332\322"
+	.ascii	"\n\221E\216\260\254\373p(\221\t\2311\231\300p9\204\024\305\344"
+	.ascii	"`1\332\212R*[\002n:\0362h\220\275\304LB7\302\300\261+m\310\004"
+	.ascii	"\204\212\330J\327\320\013$Lp8\001s@\361@\222u\314W\314W\314\215"
+	.ascii	";{\212 \305\200=\346\306\315\324\376c\274X\202l8\361j\274C\226"
+	.ascii	"iXL\006i\254\2441\201\236\310\370f4\267\272jp\255\330\242R\276"
+	.ascii	"\215\r\306ia%}\374\274Me\321\270\252\201V'\303\205"
+	.string	"\253iH\2431)\306J\017,\0276}\207$h\350j\005/Y\007W8\027c\265l\353\323A\244+\246\nVd\231j\374M\305P=\237\\\220\262{\0223\005\257X\241\244H\252\211\025\023\305T\264k\022\265\006\305\\|bYR\306(\334\363\202\261\324\333E\340\260n\274\200\033]\2509+'\027<&j\215Qb\232\254\316\332\022\245\262\216I\212I\212Y\242\021\263\024\243t#\t#\221\030\245\030\027G\247$v`^yc|Y\377\306h\3771H\313\236f\025\2151\253 *<\271\370\021c\324\344\211i\261\f#\313*+\213)ra\242\335\232H\241\022\303b\351\266\202\256\250)\206\310\031\245\270F#f\205S\222\223\267\230!&\016e\221k\243Q\214\0204iJ\217\250\230\240\307\250x\263\333k\313:\006(G\271\020\033\n\314:\346'I\303\211\326Q\222\030\037\250\025\037\021F\301\030\236\307\364(\247"
+	.ascii	"\371K\222uL\f\313]\321\371\371e\r\323\b\005z\263\032\262\253"
+	.ascii	"\002\255\201\004B\265(D\005.\n\"\345\251-\353)q\223\331\267\004"
+	.ascii	"00\353\337\020\355\037f\221\005\312q\311X\240\027\214\224$\307"
+	.ascii	"\274\242\262)0\212.}[I\322\021 \230(0\234\026\025\225\037\f\342"
+	.ascii	"6\233\303\021\227\365m\252\354\037\006\212\213\336\225\234\226"
+	.ascii	"\330\023\030\303j\336\020\037Y\257Q)\256\240\313\032\212\206"
+	.ascii	")D\247&W'\"\214\023f\217\t\207,b\024.\315\336\2536\236&B\243"
+	.ascii	"\245\r\270)#M`\227\316\315\311\222\301f\222\0311\324\212d\r\b"
+	.ascii	"\b\303\204I\213%\207a\002\023h\003\326\317\213@\230\"5\024\231"
+	.ascii	"r(\201I\262%\204g+\353\333\360m??\030$J\312\216\034\006I\323"
+	.ascii	"o\210\234\215\271\255\247\007\323g\301O\034\007\305\032h\364"
+	.ascii	"\231\273\302\364\301\360\r\261\221\325\303\007\2637H'\244\017"
+	.ascii	"f\357\377a\212\320P\027w\267\002\207\"\216\254osc\3770D\336\304"
+	.ascii	".\033]?C\232\205XUSY\303\344\301\0049\214\220\303\b\3110B\216"
+	.ascii	"\215\215-Z\022\270\266\256\016\346\007\017;\273\303\374\200\301"
+	.ascii	"\353\222!\203\021\017\346\2560\257'\312\220\334\024\022\325\236"
+	.ascii	"\233\203\351\241e\201\032R!#\335az4\005\311\314\254l\224\366"
+	.ascii	"\017\303\3435d\2225\345\305i\037=\027PqOE\330\t(\216\r\216\245"
+	.ascii	"\256\351Vc\353\305\333\313\030\303\031\217\237\035C\357\223F"
+	.ascii	"\304;66\030\035J\006\355\332\016\243\303\t\224\253T\311\363\252"
+	.ascii	"\262a\320`\320`\324|d\220v\030\265g\342R\006[\334\216#\373\207"
+	.ascii	"9s"
+	.ascii	"\331\3616\241\301p2s\2413$\203\001\b\223c%\006\322X\031\343&"
+	.ascii	"R\004\312\216\314\3056D\034\214\n\013\203\021K\362\304q\241\035"
+	.ascii	"\216\303\210\271\310i\032cL\236\310m//\030\260\255\016\276\016"
+	.ascii	"\263\366\276\016\003f\324\376]\243V\220\355\037\306\006\0173"
+	.ascii	"\020F\030\224\032O*<\211@04`\240\354C$J\ff\206Y\336R\215\035"
+	.ascii	"0Z0Z0\\] \224}\001&\301l\035\206kl\211\025HU\226\265\177\230"
+	.ascii	",\034\260\320\016\250+\031\314\2631\255\261\304\030\3202e]\022"
+	.ascii	" YX\3206= %?`\256\240qp\221\r\025@0VP\272\3067\301*\350\217\037"
+	.ascii	"9\210\254%\003aT\270b+\332\342\262\346\241cJ\234\324r\355\330"
+	.ascii	"\344\257\f0\nJd\271V\245l\020\n\212\344eCbq\367\364*\321NkRj"
+	.ascii	"\300\2002Y\n\032!Ny\001/\251\021\347\304\tZ\270\364!\005\226"
+	.ascii	"\325$\b\367\310\365Qa*LN!AY[\202\271\232d1\330\304\224^&KF(\212"
+	.ascii	"R\\(\"\331\224\370z\222\240\215N\336|\344@\202\265\364\216\035"
+	.ascii	"_GG.>.1\f\025\215X\366\222T\214Ic-\2363\354\214\324\336`\212"
+	.ascii	"\230e\315\253\"\242\033\f\013\027\025L8E\265\0270DP\"\032\206"
+	.ascii	"fZY\303\b\035?\320\330\330\330\310\030\307=0B\031f\005\314\320"
+	.ascii	"a\204\316\262\024\260,\005M7\220L\250\247\325kl\321\020\016-"
+	.ascii	"\230 \226\3064\037:\030\240gPs\311\025\361\016\346\3479\250\234"
+	.ascii	"R\226\243\021\306\347y8\245\266\325\003\246\347\251\326\270\005"
+	.ascii	"\303#\205\252\215\021\b&n.j:%\240;*T^\252LYpW\325\330\367R\345"
+	.ascii	"\007\021\242\231X\304l-J\326\257\001\306\376_\030\221?0\016\243"
+	.ascii	"\330\246\274M\266\214\277\251\262\305&\025\251- @)\317$wY\203"
+	.ascii	"L\262N\366\310\206RktQ\226Goc\027\024\035\211\316/\227\207\r"
+	.ascii	"#?\016\017_\240\220\201\200\2666\370\344/P\2344\220\324\016\201"
+	.ascii	"\324\300#\270v\306\303U\343\332\362\263\207x$\313I\313\320\322"
+	.ascii	"*OiGasj\371\026f\310G\270\"f\007c\007\331K\223%\220O\332\336"
+	.ascii	"\240KQO\215<\026\202\313 \255\222\330\221V\222$/\201D@@\373\022"
+	.ascii	"KS\362\227\300\227%I\236\204\230\275,y\001d\215\214\324\311\271"
+	.ascii	"\320\023t;\362\202dm\031$D\006\230\3651 \367r\304\257\031\346"
+	.ascii	"\007D\t\210\021\330\211 \334\036Z\037\213\223\032\230H\t\342"
+	.ascii	"cf\361\2459\021\"\344\245\310Y\272\224\212NJ\031\374/z\177)\222"
+	.ascii	"\207\fj\002\005I\326/D\236\267\247\310\251%\311\372e\210Z\020"
+	.ascii	"\226%.\026]\220\221\274W\217jj\311\013\220\027\312\025\036\343"
+	.ascii	"\017\330\016\306\240\220\260\027<x\251\231#\006\226\212\227;"
+	.ascii	"f\222\275\037qv\254\240\227Q\217 u\316\306\001X\251\371\371x"
+	.ascii	"\372!\301\352\251\321\203\37145\324\330\227\365\334\334\213\234"
+	.ascii	"\b\2368\306\200\331~\201{\201{\221\023adwh\247\370\022\367\027"
+	.ascii	"\271#\021\030*\3000\020\266\377\2277g\237\232\236O\224\227\035"
+	.ascii	"M\2754\254\033enK\274\020?E<\262f\266b3T\334\265=\275\372\216"
+	.ascii	"\200vd\375\222\366\222\366\262v\366\250G\210\"\222\337\023\265"
+	.ascii	"\263\304 R\214Y\037\003R\373\177Ac\036\265a+r\024\235\031\321"
+	.ascii	"TY|pf,go\2155<\240\034L\272\264\3002\246\216$\026Y\030\225\227"
+	.ascii	"\261\277\220\0352U=e\375\202\343El\314\213\007\223\254\013o4"
+	.ascii	"\301K\313\372\345\306KXS\313K\356\307\235\374\332T\fS\024|\001"
+	.ascii	"{2\2650\233\"\343\353\255k\016\262P\342\303\313y\244\016\n\225"
+	.ascii	"\254u\263\005\022\266\242\032K:&\26363\0320\023\334\017\035^"
+	.ascii	"Y\237\035\311\361\366\326\325\034\372\003\022\"\225u~\202\230"
+	.ascii	"\245$kd\343\030Z"
+	.string	"\220\026\214\307T\324S2\224\365<\333\177R7\222\310X6.\341\f\005\247b\274\\)\366X\022\277`=\333\332*\027S\344^\254^L\351\021f}\f0\355\377\245\nG\333\004\245\353\217\212e\253\311Q\330\215\227\251%\237\334\013\255\253\027)\346\241\224\035`\324s\005\340\331\220\"\024\313\013\370E#\230\213'\r\264D\202\205\247\004\006L\243E\242\221$\311\213\367\210\f\322\227\022'\270\2314'X\243\251\215{\227\274\355\3111\275?6\023\020\333\213\245\226\312\022Q\360J\305\213\322\353'c\007\217\245\027\027\357\335\325\021\223\030Y\277 \275 =\237\016\243l\004\331K\354l\314\310\372S#/+^V\274\030]\227$5{@Q\322\364\322\342/F,Y;\256xxe\375R\224m\274W`HzY\277\260x^\032\334\222`\326/D\231\307\225\023Q\322]P\320\213\020\333\026\033\311\334H$#K\"^\225"
+	.string	"_T\374Eh\253\311\322\340\264\306~\351y\351y\371a\333"
+	.string	"\2604\210\347\204\024K\272\333\361\342\363\227\037\266\361\310\216\275e\214\033V@O\262\376\024\312\205\212K\225\227\370\330\344\210\225\222\2275\370\022\337\245\021D\210\\vG\307#\353?\313\361!\242e\375)\321va\234\"EJ\bUc\213dnD\256>\262~\ra\224(K\276\273\353`\232b\221F\034G\262~M\017\227'.O\\\020\255\362Q\236S\225\013\224\273 \016\036\242!\326\220\271\030\272\030\272\364-2\001\342%s\364eUe\375\232.\027'.N\312t\024\037J\207Y\277f\212\220\360\220\t\020O1\231\306b\205Z\326\257I\032\034tab\344\345\002\365\340\263\313\372'\032\227,qa\002\325\002\260\212\242\362\032D\345\320%\360.L\n\377\324"
+	.string	"\003\013\225(a\366$\266\203`\202YY\377\304\020\027\277\273\374\271\370\261\3545\201(\033\231\016\227m\2038\334\262vAr\304\316e\317e\317\245\257\205\221\t\020O\221\251\206\026%\311\205\357.}h[G^'\322\\\210\270\020q\321\203\302\004\210\247\350\372\270\016Y\241\327\324\247\230\365O\314p\001r\027!.@\236V:\013H\363\212\tIJ\326.A\\\362N`\371\360\341b\201/\2614\262e\2202\025_ww\301\313\212Tj\\Y\273\330\345(\267hjFR\235O\223\2421\227:g\225O\337\"T\326?\241\344\002\347\002\347BW\326\226\265\247\370\332Q\211\271\346\356BWH\005\205(%k\027\036\317s\"V\304C\356\177\362)6&\344\"\347\022\347\302\270\261\347\204\007\213\250H\326?\241\302E\207\213\016\227\035McNd\354\231T\322\242\333]v"
+	.string	":y\021\325\250\246\346\302\006C\305\023\245\265k\312bTl>\245M)[\273\013\333\353\210\020\251\243a\002\020\rm\306U\250\212\212\034Y\337\304\235K\016\227\034.f[^\354\224=9\304\fX\264\260'\205Y\337\004\233\213\230\213\230\013\231\016\256\353Q\310G_\r\227\261\273\220\271\321\305O\302\\l\270\330p\t\313\321\006i\221\026D\t$\354\372\304\305\353.a.7\2321l\334Q\271\334p\001kqF%/\351U;\233Q\347\362\365\262\310z\263Z\272\211\252\0313\\h\300\354\030\355\212\3105\031\263"
+	.ascii	"\273\242\221\207C\020\355+\353\233 \322\322r\341\272\032rEV\005"
+	.ascii	">\001s\331\272\013\227\222\256\263'2d,\371`v\214\246C\356\252"
+	.ascii	"\337\246\004\021\313\372R%.V.V.X:|\\\337CB\0338\\\256\356"
+	.string	"\202\345\"\305\244\rK\250\307\323\223\013\025\333\026\033\271GP\203z0\236\364q\271L\335\205JY%\310\320E\352\177\022\004\301\256\032Y\273D\345&\"\260\244\254/\325r\201\252z\361\002\306c\333b\243\020wc\213dAW8\234\262\276\364\310\245\311\245\t\306s\202Z\"\246X\327\366\303.\353\323\340\271 \271 \271,\301P\361\034\026 \307\322\222\034-\224x\255\313e\311E\251m1E\260\316E\311\305\205\2247\266\037*\333\211\220\215E\227$e\023)ClM\324\214\214\230=\354\322\222\034\212?6\212\204d}\032\031.C.C.E\021(\305"
+	.string	"E\ttaq\227\"\021\320rt\005\236\247\250\204\245L\231f\225\302 \3072)\307\034bhh\266\001\t\003\026"
+	.string	" 80\030\216\307D]\330\263\003\024\200\021S\302\204t:\251\315\224,\252\024D\" \""
+	.string	""
+	.string	"\002\002"
+	.string	"$"
+	.string	"~\325>\006\312i\3116\263]\204Z\345\266jL\242\316\ba\227M&\241\260\354t\243\343m\2613+\335\260\213t\267Y\306!\353\3019\244NX\036xWM\243\035U\002\024._\211\350(\302\"\023\tC&\212\007\265\354\023\301J$\031\210\321\344\346\323\037\007\r\330\201 u\214"
+	.string	"\334\231\f\322\037\317\233\256\273\337\3540dEVh\245$\255\312`\001\027n\304|\n\331\262\2221oh:\346\220\341\3424d,\362\216\311fV\266%x\314\327\204\304gM\032\370\3727\rq\331\254'`\363\006\275\240\213\365\r\353\374\242\314{\354\026\215\335\0249\2258'\353\257\020\327L;\nw\025\227\353\204\333\366\237C\227F\260\337\211{\326\367+\024\367r\342\024\3749%'\245\201\t61<\233Tt\230\364H1\235\272\203_\024M\024U\227\247CC\341\245Zg\247jW\001\303\006\226\222\257\231\312Z3\236\351;vb';\301|\2374\336\210]f\22027x\\\315\320\031\373\240\361\253\303%\270\033I\\14\257\343\\\224\366\305c\330\267G.\274\331V_\374\344\224\330\242\305\241\2536\334\332\365\302\203\235=\242\254I$m5\366\253:\214!\022(WS0\333&O|\177G\201\324\203\2317"
+	.string	"\255g\263\367\355\024\017g\272b\376\203\212\202\204h\243\241\004E\361BW\202aDJ\356/\004\200\205\200i+L\340\3649D\354U\316C\"\243\335$\225R\302}*\303Ci\2352/\030\016\352\200\3223\233\342\326\263\026P\205\332\204\222Y\320\322p)\035\233\240\342\302\234\371\267: lb\346\001(\341Dt\307\257u=/\f\3204\255 \354\233\310\254x\234\013\306\313\343\301\211\244\356\021\036[\332\260\305\244\311\036R\033\2600\035\227k\024Z\216n\332\022?\344\360NE\340\002\005\260\214w\252\347\377\022\261\2074U\210\267\024\250\361\236\213\302\017[|\314-!\364z\325\035\311\2349\331n\350&J\317=\215Q\300@\203wMV/\376\224\313$+\302\275\224VU\006\205\2116B\026u\327d[\013s?e\306\215"
+	.string	"\213\241\251\3249\335\265~(\343\202\257\027\341]\320\023a\253\037\367`\221K\377o\267F\327Y\034\344F\033\276\251\216\275\243_r\230\202G/\347y\331\246%\357\266\333"
+	.string	"H%\344\315\205\204#\216\304O%b\347B\204\367B\242\343\341MbJZ\264\246\346\237H\270\215 \bo\253\024)\363\305\325\350\304\033\323k\177A\264\016\314\333\256\230\341\202\200k\302!\216\326\246\207\360\350\361\265WR\355Xt\237\355\342\342\330\255\356,$\341\251\307\273\330\311\033\264\270](\377\255\0335\344\316\001\253\302!\026\3339\346\243M\022F\377\2507\033\206\324\350\222j\023_\013\320\300\rf\376\036F/\036c\321}J\333\236u\335\r4\024\233\206\207\271\276\254\247:\030*`I\237\263\304EY\236\302I\232\035AD\312.\304\211\037\317\345\027\317\316\373G\223"
+	.string	"~\"\245\367\365\003\024n\023\270\253\305\305\336\241\274\r\231\245\322]\211\237_\231y\2717b\212\b\362\3176\223\206rC_"
+	.string	"L\213\357\327V.\016\330C2\301-\310\\\334b\177\334\267N\323+\226\303\r\021x\277$T\231\231\321\304\266\243r\215\264\254V\273\031\235\376Jrx\034\343'\344J\021\276\362\034\350\321\364%\027\301\251\310!@\215]\335\346\264\037V\331B,Y(\332\033\326{\214Z\363\024\346\276o\315\007\006\275\b\223\354f\226\025\355\276o\250U\304!\336\232\325\213\350\0336\323c\2020\336;\234&w@\017P\373\350\355\221$"
+	.string	" \364\340\335!\005\222\347\b\201\207u\017X\257\347\253\346\246]\240)\245\366\337L\324 \3630XU\017\276\027e\324\230\242\035\346\254z\031\307\313\234o\030@\343\032\r\2452\004&\356\270\264\306~,\277 \275\300\353TZ:\231.)\216\034\237P*8\026\341\300\033\373\004\226\314\314M\274I\351&\277\217@r\240\226\301\360K\032\337\363/\231\007l\226\213\343,\004\344l\231D\213s\241p:p\354T*\273\313\301\253Z?\327\374\r\260f \351\362\350!#x\322\316\303J0\3015'G4\377Zp"
+	.string	"\030E\223S\312\254\322\004\004\204b\331\346\224y\273\377r'\025G6\246\204`\035\326}B\f?V\201lN\252\006\226\222\243'(\245,aq-?\226\\\276ep\363\bJH\337\367\217\330\233\354\367\27783Y\352}+W\353\016\243\211\267\f\302\0033\340\007\217-\221'I\341\243\020\335\231\314\026)\365B\300\347\277\260\316\326\341\303\234\370\257kS\211\273\323P\233\225 \270,\3778\345n\2711p\366\255\274\215\304\346\271\037\207 \215\374d4\253\330\223Y\b\001\320\006\n\376\353\230["
+	.string	"S\337\007\370}\343\227\250\323\235d\272\202?86\377z*7\013\330\016\214f\234$"
+	.ascii	"A\001B\316\221\016(\240\207z\341\005\200\206\257\276\013\343"
+	.ascii	"\020\233Gi\330\315\312\332\3251z\020\313h\264\024\tN\002\265"
+	.ascii	"o`\013}\243\211\334\231f\f\020\211\225\031\214^\202+7;f\234C"
+	.ascii	"\341C\373\356o\035\373|\325_F\315\300\025T;\240\"\246\244c\013"
+	.ascii	"\245gA=cj\3266\t,\327\374]\302\n\264\231\236\216\275v'\315\226"
+	.ascii	"\246g\262X\324\332c\300\016\213\345y\353\202\201e@\317\340\250"
+	.ascii	"\026Q\336\034\016\360M\213Lk\362\243\017\353\326\310`\255M\242"
+	.ascii	"s\240W\325\220"
+	.string	"P\222\325\230\246\030\3604 \340n\"\020\272\373\235\204\335\311/\372\003h\036\331:C\245\237\236R\357\232\022j\031\3777\322:\331nIN\017\233g1\210\2323\001v\031\263\230*<\343\334\336\n\262\311h\247\303\223/\305\265\\&\244\263\326{\to~\341)\324I\024,B\005\004\332b\344\017\371\025\033Ll{\334{\270\rD\203jb\022\350\225\024E\001p\343\025\357\225\366\246I\0260\031\222 }s\301YL\273R@\n3w\270s!\322m \306\276\2139f\b\177\235\271\376\345\245\037lS\242\3358\247<\247\0023\223z\364\264\005\254x\t\350\263u\366\200\307\305\b\315FG\252\034\224\307\346\314\343q^\334\246\004\017)\342\316\244\364\rW:\331y\226<rpq\236:\236\340X)\340\354,\367O#\003\001\3563B(D\2710e\343\240=P\323\323\005\311\265\bTA\241\360\025\246\307Q\215c\314"
+	.string	"\255\331\037\244\002\267\257x+"
+	.ascii	"cC`\237\325\323\277\220\341\3444"
+	.ascii	"\022.Z\212\263r\300\277 .\002\311\006\262\266\361\266Lh\222\225"
+	.ascii	"\263g\200&\316cL\225\"t\275\027G\243\317\025\203\357\264\263"
+	.ascii	"\\*Aw\307\305\021N{\002Y-\224\205\211\271\001\375\341\320MB\n"
+	.ascii	"\305\207-\246,\251\177m?O\274\356\202P\255\005\035\026p\027\232"
+	.ascii	"\036$a\037\247p>\236NU!\251\243\200\b\250\323"
+	.string	"\274&\026\036\353\3730\306\320U\371\3022rG\241\231\376{\220\300\205\266\016\n\366\020\020\350\025\322\n\035\301G\020bt~\ni\3173dG\3313\223\025m\212\243\375U\022\316~ \2127Q\025\320\020ce\304>\254\207\"\301^{\224N\017\007\036\256\214\026G\315\231H\376\200\247HL\2166\366\257\004AcU\257\330\224\006\001HT\243nP\213\357OSd\200\270#4U\223\336\325\240S5\334\304\351\335K\336N\215N\272\314\217k\032J\217\310\300\234k\207\031\243Q\231*\265\357Kh\221\332\227+\354\357mP=\026\035[\200\231j\215O\017\2667\026\263\267\202F\203$\305\030*\006\374\205\224\217{\324\272p\b\261%\272\215\253@\340>\347\304\352D.)\200\237\023\325(h\222G/\267\001\337\310=\231e&\b\334\017cdi\"\260\3039\023\332<\221\036\374\340J\326#\343(C\031hn\216#\327r"
+	.string	"\003&Y\376\204/\2210\024\377\264\235f+\026L\237jxH\357\260\t\305|\330!\302\233y\001\306\020\225h'\017\013m\331J\343]\272\n\033\320\366+\232Q\323\017\331\215</!\264\377m\263\3225\311%\366N\013k\330\020\034\361\364\252\251\274\236\265\347Pz/d5\203a\275s\205\227$\312`3{\360\316\370O\203\376&fe\330}\213\274\023e\213\353jO9n\233\363\231;\372\313\256\304Q\241\330\376\337\331\2509`\177\001\347<(\317\357f\020\252I\bLA\243~i\177\275o\3769\301\340\264\333\250\350C\212\025\322\331\342\2156!\275\276o\037\240\007\022\035\212\366\303\241\236^\215\220\266/\355\246 \302t\262\211"
+	.string	"$B\340\310Pl\026\376\037Z\334\273?2eM\240\2268\370\302\366&\f\013\326\320\333\2608HB\354\327bU\023\307\372\330=\207\2461\263\001\025fg> \264V\245p\204\342\026I\344\021e/\223\225\337>\325\352<Y\236\326\221\326q\327.!k\314\275\370\373\376\267\377"
+	.ascii	"\"*\364\307\373\277BI}^'w3\362\005v\227\013D8\316\357\215\376"
+	.ascii	"\001!\347\022\033\032!\233\323\200\344@\346/ \300\270\3779\013"
+	.ascii	"\357\226\256\327}\245B^m}O5,\257 \033\375\031@qnJ@\311<\376\224"
+	.ascii	"P\335\242\300\253\262S?C\2763\221\0357Z\207\373\027\316\325g"
+	.ascii	"\277\023\355'\303\360#\366\020\201\350$\346\260}\243\032G\370"
+	.ascii	"\373G\311\275\312\316\016Pro"
+	.string	"\362+\020\r\003y\2049\225J\347\340 y\177\013\3563\210\330\306\t\n\016\203\265m0e\237\031}\232\306\261\262O\222\f\212R\001I\013\177}cI\353\213\323\362\331%\233\363\343\232\203{M\031\266\006\252\312\031\0252\026F\314\333\034\334\305p\302\310\316\013\256\330\354\327M\326\2439ua\3569\273\363\320d\322\356r\366'\254\n\233<*\253\342(\314P\355\013\204\317q6M\313w9\326\3632Pt\317\200\274\232\3740\226\004Z\357\345w\263&=\020\363N\260\"\300\021\005\023\267\374\371\031$\253/9\377{]^\224\021D\266\t\236\001y-\221A\370\366H\033\255\370M7s\327JI\263\225g\0249\325\240i\213\021\301\325\361\350&\315\272\210\345y\243\371\343?\206\362\330\b\201\036\324j\241\223I\352\362aZ\342S\006}TLs3\016\217u\020/\2041\323$\016\366 \352|-^\243e\332\204\350\360\322"
+	.string	"r\355l\224\314"
+	.ascii	"\b\264\"\227EE\360\257r\342\\\263\003\3072i\373|]\001\030\222"
+	.ascii	"f\3456\325\024\372W[~)\372D\201\r\013\034\205yr\030\306."
+	.string	"t\"Z\020\310\0244\220\273QP\314\370H\201\306\337^\365\244l\364\303t\311\274\247[\262\363\374\340\351L\023\031\2173\350-\001\200\256VY\nL\247\013^T'O\325U\3171\303n\300\fu\374\204\004\2217X\376\332\320\306\3010\231\306\334\210t\320 \246\370J3\214*.E\023\0271\030p\363\243\0053Y\036X\317\357aSi\260\305\310\317IID\354\0168\215\311(\224 \327\271\226X\257\360X\335\035\216q]\304_\331\305!@\244\2342\261v\t5\370+\247\377\321\273\246\361@^\345W\222\216\302*)v\241#\347\030&\235<[\035z\227\225\311\221\030\272f<\266\327h\257\016\3310\001\343\231!\007lU\027hT\365\n\027\375c\357\256\351\254\t*\215|\342\274\226>\341\251\314\322C)\321\224\r<Y\317\355\367\224\316\311>E10:\224\2445\365\332\177\025X\353\237\255\352?\260\304\224\265:"
+	.string	"H\254?U\024g\245\245\375\367\265\227P\237\r\024\3038\205:\326\314\245\007\340\355\022\236K\273V\001\371x\004.%u.\206\222\024\t\230V\211\354C\31265U\370\233*np\256\323_X\325L\201\256\301Yi\336\375\321\245\272\301)*\304*\234\r<\332"
+	.ascii	"\275\\\006\341\361\265\035\244\263\212\022\3006\265\242W\324"
+	.ascii	"\216>$\362\267\311\334\210\322\333\237\211\301\002V\257^w\252"
+	.ascii	"\036]?\316T"
+	.string	"\240!\247\215\242\211\3009\235\202P\261\323m\033Mb\364\256\361\270\026\354\264=_\210.\314\263\031,!@u\317\217J\253S\027\277q\276#_nqe\273\224\025\344\206\372d;\n\310\344\242\210\031{\206b\026'1\033\332\244\256\023JG\254Y\264\205\271&x\333\207\366\250\375\251d\022\204\346\362BS\374^\020\373\270\016{\300\326\345\360a\023\244\013<\247\352\204C\310\022Iol\313\276\201\f\311\306\367'\r\032G\270\364\r\357l\377\013xi\245\305\216\237\207\332X\260f\276\245\252\fD\216\373\023\362\255AG_D\262t\024\020\335\305>-a\3010=M\344\023\235\254$\311\242;\343\261o[\024v\002~\357\026\252\022a\242U\031\222\002X\r\262\036\224\271ca\003\355\361\320\243\305\341\021iHE\360\177\220\310Y>/\312\2414\354\277\374\261hm2\233\260\210^`\334\303\030\371A\206k\257\335\347\263\242"
+	.ascii	"\251\256ESCF\022\024"
+	.string	"H\233/9\002\273(KD>@s0\234\271\203\274\323\025\330?&c\334\024#T\0356\326\276\f5Ap\273c\326d\023\036+\217s\2324\013%\353\314}\246?\"jn\f2SFeI\231a\317\302\330\017~\361\230\bte\216c\271\356\020f\"\224\217\326\315\317)\372d?\310\3068h:RtV\021\\$\341\314\277\">]\232\n\324x\2104\177\227k6\340a\223w\2366\342\244\243\203\030@Av]\375\212*>D\253~c\330\355\210\211\331Q\n\034\270\264\370\251\345\202\257\304\035\364\361\336H\262\032\212\321\302\316J\363\216\202YY\177&\n\021:\";\256\311)\316s\314\354\n>\315\202!\362\252A\230\207\177\276\232\213\312\235\373\370.\032v\223\256\327l^\264\235\003\274\271\273\234e\332t6\252IUI\303\006h\027/\214\275\200\255\b\035P\257\016`\201n\201\024\206\337\327\002M\230\354\314\243"
+	.ascii	"\360\251\222\023\367\356\377R\036:\251\f\371\030\222\315|\371"
+	.ascii	"\214\037\244\261C\222"
+	.string	"\013A\300\252\244\223e\243A\007\330\201J\013\270\034H\004I\031\r\232\220\326\254\356\334\236\261\246-\242\030M\211\272\342\222i\236\036\376\305M\200\"eS\b\330\213\002\267\237\373\341:\201\370\277\272\b]&\037\253\317\210@\363$\"1\214\261\037\217\317j\341\f\310\263\215\"H2\362\033;\264]\213e\007\022\275`r\234\260At\235\001!\2565\207\300\344\f\264\036]\320\223\245\254\256:1\270\030's\240\341\262\204\302\227\357m\224\362\365\212p\354\272`\367{\255\273\337\327l\212$%yOZ$x\270W|\256\232\356\330\333\303"
+	.string	"\272\215\312\355\344Y\274tm\342\fV%Y\312TjeA\242\221\265\324m"
+	.ascii	"$b\b\342q\365\364\027\034\263\252YJ\006^\242Yx\353\f\213\n\026"
+	.ascii	"\206F\003\347\2447\025;\265\203\326\347_Nr\226\273\236\360\271"
+	.ascii	"K\037\252_\276\325\355C\327%\203\030<\001\332\027g\215\366\332"
+	.ascii	"l*/\235\265\327\377\366\271\211\220J\221&\340\321\362`\211\031"
+	.ascii	"Q\256\206Q\376[A\023u\374g\342\315\356\256\315\315<F\277\251"
+	.ascii	"\374\f\2143\337\005\331\210\035d\344*\236\304\007S)\205\235\321"
+	.ascii	"@\304\300\352\002\365\261;w\275\240\024\264+\351\207\3566\006"
+	.ascii	"\004x6I \275\226\201\2444\355\220T&c\007\007IiD\233\362)\315"
+	.ascii	"\331:>\027\022}Ql\363\317z\300Y\304\"\025\206\233\307\335\245"
+	.ascii	"\344\250\334T\246\016\207:4\223e\023\035\315\366V\333\326\275"
+	.ascii	"\2152\201\341\\A~\320\236\330\210\243\251-+\210\225\203zT4 2"
+	.ascii	"\310\346\030nZ^\311\307`\322\217\265\001\234z\216]\006\223i\032"
+	.ascii	"\346\3552P\013\272\373.\374a\004ZC\336\214\013\217\303\033\323"
+	.ascii	"oa\263\312\177\205\254=\341\007\220yy3\371H\301Y4\320\277\267"
+	.ascii	"\020\357o\236x4\212o\367\340\\\302*\326\346\303\247\271{\241"
+	.ascii	"\316\325\235\371C^DP\242\017@\025=\020\263\353f\354\256|\321"
+	.ascii	"\260\203-Z\372i\177d\312\030\324\024\213j\212\006\202`\375\336"
+	.ascii	"\023\376\363\020Vh\246\332\202\210\353+\204\036Q\270u7\246\225"
+	.ascii	"\303\233T\013\nP\354\221\214\376\236\033\222\024\320\"\275J8"
+	.ascii	"\314g\357S(WQh\317\214a\r\036xi\027\263\321,U"
+	.string	"\320\337\252\272\305$*w\302\220`P\305\223(\264\234\035>\023p\265I$\345\337vIA^\250UG\325\030n\257\335\317\351\357\007\002\234\355\367E\335\244\337l\367\345$\037a\013\f`\360\223\262\220$\336 }\365\023\201\227\312\341-\327ct_\336o}2\304\334\035@\363@\366\365\002\016\327\311\231\242\326\337\031\223\301*%5\036\235\330\263_\353pdY\267\032\n\224\250\214\256_u\312r\300\342\273'\333\204\254\326]8\2055\320\366\353\204\320\231@\333\300(L\202\005}\210L\266g\236N\300$w\f\305T\202\031c\256`\016\231\316\367(\307\240\033\\a\300\223\213G\265\340q(/P\206\352\231Z\337\021\177\253\235\332du\020\312\303\212\262c\352\205\232\320s\244Zm\025\376@\344\333\352\036\021\357.5/\303\344\024\373,\277^\002\361zj(\236\bI\300&\331\323N\006\250\270\336o\324\335\360h\206\177"
+	.string	"P%[\006\034\264\034ZC\243\220L\304$\313q\311\334\265\212\364qd\356\367\205n\0058\004]j\270\303R~\320#\347:_d\004\236(\307\232^S\035\002C\261z\006\013\343\341\004d\344\275\273 `2\034\205\352t\335\267\232\003\320\032\370[\271\365J\243\352o\0074\317K\0023\376"
+	.string	""
+	.ascii	"\276\204\025v^\036\246\223\305\004\032\314]5\022\030\354\"k\205"
+	.ascii	"{r\013\231n\003O\027\341\367O%M\230\0240\211\006\367\236u!\334"
+	.ascii	"\252m\305\272U\322\023\201\225,\343p\013\251]G\342Q\216\352\322"
+	.ascii	"7u\255C\371\023\r|\377*sn\324\245K\335:\202\030\020\2017-\310"
+	.ascii	"\002\363,\217\372YA\324#\235\030#V"
+	.string	"\347\003\363\205u\335\253\020\214.\360Z\247\376\017\365\245v.\217\211\223W\323\252\355j\021:\300\263\330\247\337*\f2G\221\210\017/\376\277\261FO\260XOs\234\226\333FlV\351\"\334\017\347-\266id\222\004\320\2276I\006?A,aj\201\376\372=5<n.O\311\302\256\002\244D\210\377\f\346\233\356B\356xo\005\007\367mJ\236\261{r\003\265I\362\037\220\005\236\270\317Og\230\236\221yG\370\350,39\371\202\266\222\273\030\271\201m\004\352#\372\362\346>\277\371\204\302\237\201\221\323\332\024O4K[\252\336\003\325q\032\004mP\373n&\220\314\n/{-\b\314\033\251\322\226\b\362l\212#\r\020\353\341\370#!\016\227\217\364\355^\333m\331\263\200:\\\013s\243f\324{\005\037\221\264v=\353\326\312S\344\217\372y\321\263y\232H\277\323\305\202\347\375\310\371B\017V$t\304\032T\321\005"
+	.ascii	"`\207b\251A\212h\326A>\357.N\313%\f\214\0350k\306\205\232\356"
+	.ascii	"u\302+\370\3652\005\353\215\t\271;Q\3115K!\274u=\315)^%mT\366"
+	.ascii	"EC\013\377\302\231\322\311\234e;\353\246\277#G \253\333}\200"
+	.ascii	"T\365\372F\367\303\352\233\320g\265\332\316\225\330\\a\273\344"
+	.ascii	"\027*K\241w\205\200\334\3303\272\315\b\037\306\372\"\263,;=@"
+	.ascii	"\002\332\231F\023g}\336\345\313\372\214\361\232\335g\366\b\261"
+	.ascii	"m&\036\223\3024\365|\250\353\017\252:\030\361BB%o\342\212\347"
+	.ascii	"\337\200\357\361.P,?8r\301\350%<.6\177j\230\322\343\253\337w"
+	.ascii	"\276\242\221p\362AeP\200\352\250\233\017\027\302\024\2540\240"
+	.ascii	"\272\034\210a\354\266h\030\327,\n\021s\243\303\332\272c\302\324"
+	.ascii	"Q\206\226\007/\332[\262_;"
+	.string	"e\346\"\255\343\203\333\004\2553y|<6\261\303O\\?\377cMz\345\2018\377\327\031\2318v\201-\0223(&\036@\005w\204s\004\030\001cfn\0340>P\003\227\200\242\310\026P\365\037\004\324\025\016\246\246tq\335\253?\013E\3366\f\333$\241H>1m\205\350M\337v\021\304\261\005%\302_\017Ne\233\262\243g\361\274\f\261\373\251(\203(#\373\345mA\r\005\200p\352\023a\020\200\353\225\3205\240V\365mj\336c\3775\360\372\320\033\356\236\323F\327LRI\210\256r\274\310\326Po\312\1771oK\225\344\236\336\253\266\223\\\001\347\363\371\302\030\210\333\323\245\323U\337\345\373\370\332\001q\242\200O\304\310\214b\373\230\325\275L\206#\305Xg6p\3432\2465\315\377\370Q\251\226t\210'\2105\316\236N\361\fJ\013\0179\303PDs:\360\005\265\202\"\275\334S}o\202\262\2311\032"
+	.string	"~y:\353\274yL\017\251QM\347.\366\0018g\240\203~\304\032\323\247\230\005\263\277c\223\275\350\323\301\002\230;\213\t\357\001\365\\:h\273,\2458\001X\031\351\222\306^d7\324:\\\013q}T\021\223\212n^%\203\327\027z\267\370\211#o1_\331?\025\246oP\365\270>oD\377\030\275B;G\034\222}\025\275d\254\327\355\321\343;\026T\264\202z\264\002nm!\372\247:\331\210i\221s\225\023(\304\353m\344\267\"\225\035\255\2622<3h\334\002l\346!O\320\302\334\353\250'o\203\265\001\320\342\352\3644\n\373\366\035\220\377r\356`\3165\312\376\342u\367\004no\361\271"
+	.ascii	"\210\274.b#\261\362\337E\003v\275~\320"
+	.string	"\354\240\213|\327tA\356\340\373\266,B\356\340\2059+\205\276J\355B\250\031\271^N\213;_\321h\230\336&\365\210\004\222*\373\304\364y\243\035\225\246t\372\274\b\\/=\251\276\245U\345N#\351qB\313\265+K_\370\362\331XN:\177\350\207IWm\030{\366\362@\036\\K\202+\024|y\355g\\&\245vN\217Bg\226X\276\004,*\242a\333\310W\007\322\006\376|\366\223\373\013Q\306\314\033U\267\006\"\275~\207\336R\213\277\016\264\265O8\272\027\304\265\313\313\203\266\"\016\375\254M\"S\240\246\351\314x~\323H\332 \244#\207\021P1\212\353\311\016\331\233F\t*\001c\335\207\2116\365\025q[\365\b\017|\244\365\343/\f\037\347\032\324\256\371\275\316xerS\255\240'g\033\252\211\\g\025l\323\237\263"
+	.string	"\200m\211\004\355\343BY\3450\222j\271)J\221~AVX0V\237\352\300\217\360\212]u"
+	.string	"V\300C\300\373\004\177\023{i\206\220?\n\270\237\023\243h\0072H\354\352FX!\342x\301\274\2143C\032\252\217}\246\217\025\344\333\203u)W\360\363&\241H\177\244\376i\267\206<\330\033!g"
+	.ascii	"4XI\343>K<@\242\267\251\351\326_\001I\207\221\314\274:\220\207"
+	.ascii	"m\037\253\347\230\356\266\026\240\273\005\375\265\311\361\236"
+	.ascii	"\020Y\331\341P\351g_c\031\316Qr\354\207\340M\355@\254\256*\\"
+	.ascii	"\r\374\307$vL\024b8\224\222\026\215\3579%\327\352\251K\033\313"
+	.ascii	"c_c\315\205\245\254Mj8E\374v\373\362\362\037\234c\247\350T\366"
+	.ascii	"'\202(\177\331\332\310{Goi\270f\372Y\366\317#\006\352\035\212"
+	.ascii	"I\016\301\241Rns\213A\314\005\244&\033i\337\360\3700\223\315"
+	.ascii	"7*\207\006J\312\034C\2279\202\3327\323\224\264\325\224\206\214"
+	.ascii	"\366\341`?%|Q\347w`\254\376\026_/%eI;\2042*\352b\211\250v\264"
+	.ascii	"z\370\276G9\226\bn\373\2238\0040/A\326\256ZQ\364om\212\275Ho"
+	.ascii	"O\234<HQ\205\356Y\251U\323\362<`\t/\375\270\233\325k\217\354"
+	.ascii	"\020\252E\357\204H\274/^\240k\366\210+\n\013\242z\035%m\003\263"
+	.ascii	"'U\360\212\330t\242q"
+	.string	"\331u\035\343\257qZ\344?\021U\036Z\355\272\324\307\342\241\256.\300\2116\321\261\361r;\023\242\1777\302\244\350'i=\223E\022\207*\033=S\037\263\365\204QH\017`\325\031\364lN\032o'\2740\363\002\337\326\356\353\334\b-1\321W\266\310|\2532\200\361RW:\262\3409\001\022yw\261\343\266\215Gv\205\271c\245\304b\227\356\263\273\253\206\231l\347!!\274\360_2\232\301\030\277\344\213U\326%\275\206\201}$=Lf&\005E\262\370\211\211\212\344o\352\302I\261\220\247O\354\031\0076\2655\312\373\3558\301\357\354\345=\265\037\253\202(\310:y3iw\026\231\211\252\221vP\273+\032\bQ\370.\274\367\311\342`\f\034h\217!\207Z)\372\024l\306\223\272\324\242\332\330\354io\322\021\304\202\320\306\023!\362=*\f\02733\205\201\243\031\265\314r\007n\353)\035Uv\026@\030H=\261"
+	.string	"ln\242\302\251\231\341\335t\333\330\3061\202\253\005\312\304\331\200\201"
+	.string	"\372\263\2463P\026o\375\365\037\202"
+	.string	"\006\247\33463\265\203]\340 \201c@\207Z\305aNjk\333[\261\266\214\314\312a\316=\271\326\214I\373N\317}`m\213\343\013:\320@N\216\252VB\223R~\230\200\250\277{\227\347\276T\323\312\266\237\030\323\252\206\314\357MN\036d\203tCB\255R\255\256\020\356r\223&\233\232\357\223\224}\034\322\002\257\372O\003\237\262C\366 \374\"GU\377\340\2338\251\371\020v\373\006\275"
+	.ascii	"\370M\352E\325@\363C\244\347>.\2724\311bd\330\304]\245\363*t"
+	.ascii	" \023/\326\315\274)W\316\341?I\201\254kw{\340\314\001\265\266"
+	.ascii	"\310\232\370\025\260\302\334\341:\275\211\031\254$UX4K\020\321"
+	.ascii	"G\352[\224h\233\322\r\006\004\332\030\2051\013\032:\341\360&"
+	.ascii	"T@\362@\300h\205\2532\346$\312$H\361\262\t\214~g\202c$\336\303"
+	.ascii	"l\356\032\260D\f\232k\030\212G\343\214\fb\241`\247\030\343\365"
+	.ascii	"\bB\257G-s\357(j\2472\235:s<\264f\237\265-\374ef\250\331\245"
+	.ascii	"]!^Y0\230\341>\231\354\006G.e\245\245\205\033.9%\217\004r\270"
+	.ascii	"k:\376\021\376\251\026\032p{\220\020j5\241%\263\005\231\030\177"
+	.ascii	"hDT\016\001tD\335Gt\006\004\225#\321Q\n\tI\247\367\330+\313\025"
+	.ascii	"\027{\327+\254+[mC\234\306q\242e.)\006]\244\006\204\320;\002"
+	.ascii	"L~\200\022\357\312\354B\274n\232\210(\216\364\246\002\360K\324"
+	.ascii	"\334^\226\362\320\334\236\2646\022\350\003\004\301\326\260\234"
+	.ascii	"\356\252Wtm^\2236\331\023\336\332\250@^\337TjC\360\216\371\344"
+	.ascii	"V\016\002%\262 BT\330iW\266\232z%\324\253\237\363\242e\315\f"
+	.ascii	"\216\371\220\230\341b\256\362m-\227\306q\033s\003\314J?t\026"
+	.ascii	"{\355)\006\374FK\025[\355\215\367\r\305\177=\204\222T\353Q\351"
+	.ascii	"\033l\331\340\324\n\364$ \006\333\301\030\262\374\b7LgB\372\317"
+	.ascii	"\234\267T(\233\002\366\205$\304\211=\312}\217\322>\001<\336\335"
+	.ascii	"3\321\276\205[l\243\224R\317\334\261rb"
+	.string	"\343\177h~ PD\337\b\261\272f\366\341\230\377N\230wE\336\031uJ1\315`(\266\271\020\255\360\026\304\335\271\323\027`Rg\202\330>#2P\340\317\260\342=\233\366X\327\236\246\260dx\346\334\314c\265\226.\332$C\220\007Z\020\341\362\304\304J\0030Wl@\023\366\361bL\035G\b\n\207\321^\331wnt\027\356\251G\374\0067-\216\332WSN\264\212s\274\352\027\313w\253\3729\317\003\254\2675z\370E;Kuz~\222i\024\311F9\b\00262K^qx\242=\0251\2170\361\240\2644\276\031\373\031\373\344BA\327\236v\034\352s\332\"\026\376\r\331\203C)^?'\374>\367\006w\213G\036\326x\326(\2003\273\355W\235%\376\262\264\370\205\230\334\333\037>\236\334\021\357z\337#\374&e\241\270xQ5z\027L\271\272OZ\250\016U\355\325\f}|\272)\233w\276\244\230r"
+	.string	"s\210\254\330\240\344\r6\f:cJ@\315\317$\215\272j\3537\332\004\271\302\322\355\022h\033\\;\257\343i72\347\006w\250\377\033\207\236\355\364z\"\375[\232\366\030\205\256\336h\345;\373\033\264,y(\201\233\321\325\356\005\026\2260*\355\302^Ss\313\317\372\320\b\037JD@\352\347\033\025+9B\373r\272\261\017\210[-\357\306\026\206;\032>\207\232\364'!\343\33289\b\320q\262\315\221?|7{I/\310\343\002\350\213MD\234\313\250\207\327\222\274x\315D"
+	.ascii	"\265LaT\276\272\026\024%_\254\266 \033\321\002I\340\2336\315"
+	.ascii	"$\332[9I\342\262\235\312r\272K\343^/K\3352\037\252~\001\367y"
+	.ascii	"\337\022b\250\214\314\222E!c\fE\f\203\236\270wi\346<\265(\017"
+	.ascii	"z\335{\257\313\023\267\336\t\331)\306\277\367\216\003S\273\212"
+	.ascii	"\350-h\355\242*\334~\374\301S\t\201\224\027\032;\345\347;\311"
+	.ascii	"\214h\335\321>0jxh\211\262\t\263\022\036!\247\262gw#\037<\341"
+	.ascii	"k\331&4"
+	.string	"\231\373\230R\033\252\337\357\255\306\376\026\267\334\026jA\337\310Z\343<&\342"
+	.string	"\312\\\244{\337L\f\r~r\332Q\t\030T\b\021\323\213\341$\323\364\323\347\002\007-\005\214\240\317\246\021\"\335\251dt\323\001v\344\305W\032J\237\007\361V\344\265?H\266\210\254dW_\331\032\315\245+\247\365\345\230\351\251\364@\366\315T\373\215\212\353u\013%t!X\255\212\235?K\363n\372Zi\224\245\321\034\234\225\324\234\225o\246\bP\205\314\301\320\205\312\t\\>\005\362\325\347\222\233\222n\222)\331g\262'\222\310\270\032\210\264\320 2\351\334\307T0\2710\212F\267\246\022\211\003M\006j\255t\235D\366}7\313\231 \274\226.TF\026J\357\247\317\344q+u`\261|\021\002jo\317\236_\275\034\035h\216m4|9\003\023\2555\331\232\211T8|\362\346\322\344\026\340\032\234\321\f\230i\025\321\006|\233\n\027\242\371\r"
+	.string	"7\304\341\0053\376e\322\314\035\002Zi\207)9\201\356\351RZ)\327|\315\276i\3257\207\242\257\220\322\237\276 \347$\342R$,\353\362=\257\225CQTf;7\362\355\3667\357\266\030\304\351X&\341\260\313\245\n\261K\305\341\314\235$\246\231\320\207\3329\200\255\255F\210\373\316\240fD\302Tp\317\254\205x\304,3\271\345Zn\324@\361\242\272K\371Lg\312\267\327\370\n\335\345\307\311T\364\212\2157\320P\0341\374(\201OG\f"
+	.string	"\007\r6\272P\374\222\221\277y\303\306\003\023.C\374\232b\226\224Y["
+	.string	"\212P\270O\303\301\243\330AHJo=J\242\346_Q\373\033\361\026\251B\327hxS\366\303\036\300\362\252F\305\352 \351\343\256Y\215\001\033zS\036.\027\312\3427V\374\005\312\304\017H\211\020\231\255\242\213i\205Fq(\253\361\234\217?DW\r\272\351\024\363\354\262+`\034\265\r\334\3139\277\306\226u\356>\213\265r\352\304\265\316\023\024\237\221\364q:\024\354\214\301\255\373o\235\202f\374\251@)\266\313\362\363\035\272c$\021\263]\033\240#\226\037q\220{EM\366\241\350\220\310\340\222\260F\236\310=\242\210=G\367\353VB\351"
+	.string	"\204\321,\022\234\022\255\204\325\t\017\340\004\203Y\311JV\212~)\2165\374\213Rbg}\231%\244q\270\036\rS\202\007#`\255\324L\027\263h \370\324#\032Z\210"
+	.string	"\274\027\007\365\271@x\312\334\255\253\242\346G\213'\022\360\200\\h\032\325\341\315\231\231\241Y\006}T\216\232\250\210\222\343z\177\261\363}\244\220.\221+\377\274\242\246\343\030\013kE"
+	.string	"\021\234\272r&\205Pg`\364X7\205\324\t9\025/ZV\177\220s5\017\242a\256\3467\340\371\361\371CPwI~\250%R,\256v\355'\215\032\276\t\022\200x(\211\2152\b\214\030\227\232\310]\263\210\210\223\00144P0\367A\311\007\036\244\3002\303\023\033UqK\234q\241\212\371#\251\255tf&'0\272dC\342\030(\352\t#\236\275\325#\342\323\277\202d\345+z\207\352k\2574\226\232\377\221\351.r\363\217\n2!\242\r}\332\2239\340\016?L\203\0379F\346y\361`\037\367N\021\023\025\0134\225\364\377\320av\255\006\271\263\241\207\212\354\206/>\360s\bKo\330>\364\331GK\301\023\346\321\246\217\251\274\020\226g\204\024\251\253\021\350H\235OP,\313-n\\f9\321KW\232.\026h\350\213\310\223\272\217\032\0174\004\330"
+	.string	"\r\205\236p\213\335\322\227?h\215\270\026\367fz\257W\205\001\365\024\342\326\205\245I\371\332\374\277&X\323\210)p^-(Y.\261\302.t\314?\331\027\242\200Ska<}\t\233NvA}\301\373\343_\003\001\246z\311\022yA\207\254\177\250\007\b\233QM\033\302\325HPv\260\346\fXI\216\233N\227\222\f\032d\n\004\354\235\310y\257(-\376\363\247o!eO\241nA\201\244E\244:\316D\267\177H\357"
+	.string	"\245\311\bd,E\326g\264\223J\037\374\204\267f\\\351c\337~\222\217dz\252\n\355\322\353\004&\260\351\361i\247\353\007\"\205I\356\236\361>\307S\3027?D\021\252\022\341\037\231\026a\237,*\254A\335\347HFP\231\2374P$\375]f#\311[X\2762\233\206\032\r\"\027>\312"
+	.string	"\374\203\036\377"
+	.string	"\307r\314"
+	.ascii	"n5\023\352\317\0079\245{K\247\346\200\250&\254\023~"
+	.string	"\273,\355\364Y;\002\021\203\361\033\003\204<\002\337\350\262l<\232\017\302)s\320\222\r_\026V\031\022S\272\372\023B\366\337\271\336\366\345\236\311\265\"\251}\212\366u\340\361\207Y\035\335\007\306\257\323\004f\220XJ\342G\261w\241\264\206T\366\365fb\232\314\252G\301\354G\033\213\334\216.^\214\232l\001\343A\343&y<\034\374);\247\235\375\016\310n-\362\333#\377\342U\270\360Vr\232\241\232\310O=\347\236-\317'\037&\013\036\227\223\034.\224'&\273\224\017\330\217\316\r\323\013\250\354\211\377\0049\nkB\212\312\207{\307\220\232>\275\276\204Q\222z\0352o\311\301\017\256\007.W\344A]u\315\241\023\246Tid\345\370\223\247\324\377\200\316X\321pur\271\364;\260K\270\240\221\t\364\221\237>B\373q\302\363G\347\321\017\304\335\314;\360\350Y\251\235\214\377\206\272\345\367\266\323M\276\365\346~"
+	.string	"\371\b\0310B\354\231\267\017\275<.\333:\224\267\240\301v\031 \220p\316T`\264\t0*{\306\204\323!\\D\177\217\030\265\225\332\0246'vE\240\301\323\321\233\233\033mELf\255a%>\\\354\257G\022T\245\361\240+\324\273{\212\235\210j\035\364\236]\227\374y\237\310\301\345E\026\200\324\212\241\301uW"
+	.string	")\032\361T7\214s\216Q\033\2029J\026%\007y\304\036\374\2627\013\350\033\366\220\264\327\345Y\221\217t\nq\250\312\031\346BzP\237\021h\016\275X\340\017\322{\231\022\227\363\321\212\203\233\262\006[e\325)+E\220;\2758\321\bu\315\033\303\205\335\223\244\001\240\306\376\370\276Z\305\222\037h\320\375\336\323\262f\307\204\200\276f>7\306\0328U\312\036s\276\003\245\026"
+	.string	"\357\323\207W\225aj\230@\026\337\0021[\004\005K\210\210\f\216\024[\371\311\022\304j\352\302\310\213"
+	.string	"\216'{\201\177\312\222\240\333\037\021\350\344(\037\316\031\372\212\0217x\232\342uT\265\2039\274;\373\340M\2469U`\013\374\377\210\335\370:\216\303\023\220 \304\214\233\020\257/b\326\r\236\261Y"
+	.ascii	"[^\206\2313\b\314\037\341\251\342\340\216[\013\371\216\r_\r\353"
+	.ascii	"\330\362\177K\nM\323\360\252Qz\273\325\301\342*ob,\2770\233`"
+	.ascii	"_\213\263\264\374\313v\320\214\r\232\366?+X\262V\203c\320fq\250"
+	.ascii	"\032)c\343\025\231\\\201[\216{^~;\232\205$\232\236H\211-\347"
+	.ascii	"l\331F\235p\231\232z\217\022\355\313\275b\005\244\245\225\005"
+	.ascii	"\265P-b8gt\221A.\035xE\222\235v\177\003\275\272o\023\016-\251"
+	.ascii	"\"\363c\"\300\032|\357W:\t\227\373H\351x+i\314\025q\203[d\215"
+	.ascii	"\352>\005\325W%\321\241\020>\177\200W\334\t\030!q\354\224\230"
+	.ascii	"\332\026\341\353[O\250\301\365\377a\367\373f\246\340BE\205SV"
+	.ascii	"\230\371\207\324JD8\215\227\312\231\024\bJ\366g\212\317**\355"
+	.ascii	"d\216\375"
+	.string	".\215R\210H7F+\220~4s9w\023\216\234\030\372\r\267\377#n/;l\340\221-\357T\021\242\305,?\305O\272B#\316\232\221\n\343\261\331\243\021\333\331\343\317\346U*\240\361\336K\241B5\013"
+	.string	"\026a\274\0200Ic\032k\017]\030\022\327\033m\370\326\034\013\3236\243\020\203\340#\203\215S\267\342\021D)\217\232\026\026s|\241\020\374\273C92\"\365\347]@\255\210\255C\262bU\t\331\354%W%\013\367\311\327\301\227\300A\223\340\260;V\327\213\317\036\301iJg\327E\215\331 \261\333c@\331\346X\262\fZ\205\241\276l\f\247N\224\316~\354\321\311\271b\202\226;\013[\024\266\326\035\314\212y|\026\227\250`\277\0027\267>U\225\265I,=!Q\344Y\330\n\3736\233\252@*\275;.\264\210\216\223\r\035\204\214\246\320\255\227\374\245\nx\242Lau\330\256M\251\\\303Iw\017&\024d\377Z\016\260H\221\214\301Y\332\362(\204?9\"#\262\356\306\230\006\3043\201a\266\241\240\035\266c\332\r\230\213g\232\2577\331\364n\030.\215\215\215\217\357\316\331\260:\225\233t"
+	.string	"\272\2037\261E\255\312\317\232x \267\321_\205=o`\350j\266\003\002h<\277\346\245\354\273\204o\254.\333\331rmK\332\237\247"
+	.string	"\250WR\n`/\232{\025\203\372\206`\222\276\3179S9OY\214"
+	.string	"!\034F3\241\262\263@q\006\035\250!\225\343\303\343\275\363\346n\226\327\257\257\363+ Q\276L\343\273\306\355\254\361\364\231W\256y\030]\271\275\031\240\2713\371\257\336\242V\353[\241\352\311\030\362\355p\370X\327P\343a\242\334\245\230\335\003\342\355\316\300xhhL\276\364=Z\017\247\330\347\375&\n\255\306/\375\254\366\215\265E\265\370I>"
+	.string	"#}\022\257a\007\216\021\270\006\376m\366\366\223r>\307\263\030\262\307s|zy:\307\366&QB\303&M\314\304\271\274\021\233w\b\215Y\356\006.\264\251\213\273\247`\242f\205\235V\375\227|9]\260O\007&\315\332|;\376t\334\254\0174\317zz>#\353\307\231\236l\335?}\341z!z\324\"\315\006vqcq\313\026\251\225\272\024\247\001\177v^2-\245\226fk\350Lf\3205ey\263-1b\276v\001pg\205\225\nR\261#U\375@\020\235\016\021\305\363\216Ug\367\177U\257y\330\r\275\265\262(\331e\315"
+	.string	"+r\313\032\"\316\212y\336\025\343y\226\\\357\207\270l;\235\3615}\221l\321s9\336\036\n\0376\002\237\373!\216\377\026\313\350\203\317\351\326T'P(O\266|u\233\022\312gf\234\277>.\255\271\274\217\322|\245r\327\367\204\336\360/\366\223\345p\270=\031\370#j\232\227\204\3463l\213\332*G$\024\307\303\017<\311\335\310\340\0039rd<F!\375l\360"
+	.ascii	"G=\303\260\t\232\031\\\003\033\374\250\024j\232\304|MA\220jN"
+	.ascii	"\362AQ\230\303d`A\243j-\230\346\336\177\032\235\3427M\2010!\022"
+	.ascii	"I\021%\275\356\230'\236V0ew\\\342S\023\013\320\3516\261\201\345"
+	.ascii	"]$\275\251\316\3667\262H\315tb3\271\233*0\342G\241\001\017\326"
+	.ascii	"\332H\3133\352\340u\270\356s\236\317\023\357B5\036\2338\254\222"
+	.ascii	"\343"
+	.string	"\024\241#\335g\t0\217Y\331Rw\336\345\353WF\320\240\222\250&\366k75\321\241#\034\033\276DJ\325\301.#\352\236\305\027\276J\320\341=\322;5\375M\202\265\267nx\214\031\3204\003\020(\324\251J$B\023\327\376>\214p\230\022\343\001\022\373K4\215d\316G=:\177R\257\244\372\336(\271\016\354\323?\253E\200%\303\265R\013\242\236\257\035\252\350\370i6\365\026\276\233\371\3522\330\362CQ\243\331\032\210\021\2553;\031\333\030\315\366_I\204c\302\021s*\246\200\317;\222sW\375\253\\\316M\016y\234\241\234\366\222\302n\nF\247x\353\021\370K\252\206\226<\272\004\020\341mA\327W\233.\366\245\035\024\233\354\026\273\236p\320\351\274\"\237L\304\"\234\203z\251X\264eb\006tU\232\033\363\240\n{\024\177\207\263\274~\207\337\bxX\243\005A\306\2416\370\331k?\274\316\030\211\203\367\242"
+	.string	"\326~\306\035UA\006\325\220cI\214L\210\211\217}\342\242\246G\017\213{\n\323\305c\333\370\247\252\330\336\020\256\302g{\362\226\251y\352%\330\336Z?\217\357\210\227f+\217\027r\315\034\274\374\257\200\002\232%\355S){\311\022'\3567\346!\230\262u\354w\3765\322q4\362\364\301\302\203\353}\327\351,\242\266\320P\r/% \210D|\352)\322D\034\212J\025oB\177\225]mu\354\035K\342`\310\001\206\"p\362iS\226d\2300\250b\033\001\367P\226$\2307\324*-\237(\226\337\225^\307H%\230\241\307\242\276K\025\204\324\363t\001\b\312\307Lh\236f9S\372\301~\025\3041\022<\\\035<8\313\2205Xb\t@\226{\365W\026\372W\275+"
+	.string	"\300i\177\252\003?\220\320\2124\006`\310G\t\241p\214H!\250\0221,3_N_3\206\311\344\335\373-\032\n\256>E\0259+\350Z\346bzLO\002\227\0363{\315"
+	.string	"|\220\024Dd\334z\316\331\027\0306\b\243\313\366\361O\006x>L\357\201\0038|: \202\037\341&p\240\225\356\303\216\016\255\362\3775\371\242&\b\342\353n\036\177C\257\027\206\263?F\333\213\b\317\273w}x\214\272p\322\267uF \317\351\257?t\263"
+	.string	"\335\234\006B\257\361*\206kZ_m@\315\016\267V\350\367!\374\371\330\036\360\f \220\235\367\253Z\315\251\331\252\273\316J=\272\324c\351/o\001\321V\3372\035\023=_\313>\n\355\020\361u\344\023"
+	.string	"l\266\333N\340\301]+\303\314\3200\341\254\342\210\025\304_0O\366-^\b\342t\023\226\370"
+	.ascii	"\242H\321\263\\`\265\322\331\361\037\257,\tbm\363\321\307j\006"
+	.ascii	"=&\344:\223\266\322\233\327\212v\312\004\3503\322K\232\013\221"
+	.ascii	"\336\300_\036\361_\207\005\234\017\240\203\252\265\356O\361l"
+	.ascii	"\344\303\311\331q\026\3473X\373_~\332}\251\0348\377\2136\203"
+	.ascii	"cr@\034Wz\024\327\335'\212\002\004\353)\333R\373L\367\375\332"
+	.ascii	"\362V\340\221\034\233\267\242\262\376/pj+\310847\3244\340\357"
+	.ascii	"\236\377\016\274p\341Y\310W\023Xmkh\235c\376\366\2469KZ\265P"
+	.ascii	"\337\353\245\310\262]3<\"\322-G)z\361\025\302?\024i\200\217 "
+	.ascii	"=\035\322\024:m\220\220\nw4\307\r5-\227l\224\356\t\362P\2036"
+	.ascii	"\022\f\231\267\007\017\266ae\032\333]\357\221\372,*n\266\177"
+	.ascii	"\267\262C\027 ha\271Qdff\327A\330\031\006_\310V\262\315Vo\340"
+	.ascii	"\260\005t\tJM}3\231U7\257\277\245\337\254\017X\222\243\370\n"
+	.ascii	"j\332atE5D\253UJ\006\212\230\351\236\f\177\241\204f\033\364\327"
+	.ascii	".\324X;\036|\013y\007\020\003\026\3651\262\257Z\370\274\273\376"
+	.ascii	"\360\245\321\024m0\375\362\033\226K\276h\252>\177\216!jRR\371"
+	.ascii	"w\246\374$\334\211\310\366\007i\237\310f~\\\035 9\361\356^\341"
+	.ascii	"elpH\016vi\221\315\261\211F\227\362\3712U\001O\271\027H\255g"
+	.ascii	"5\333\206\031\204N\242Em\231hr\204\314\320\263\307g\002\225\177"
+	.ascii	"\223mr\313Ev"
+	.string	"\005\002]3T\317\307\224A@\226\n~\016\311u\013M\213#\017\205\265\215\r\214\274\366\332:\347\354\317A-\361/0\375*\220E\271\351\346\272\226k\371r>\033U*\002C\300TtA\205\346\2022\r5\337\024W\305\237\310\320\203\342\205\351\335V\300\371\030\312\033\020\267{\267->\275\023|\256m[[\270\354\325\002\361z/.\374\013\033\210\217\305s\022\023\364\207\364\026\220\033A\302\370'\nJ\236\270\345\021H\342\355\232\213^\235&j\276`\016\341\362\345\007\220\260j\361\356\244\200u\336\351(\346N\277\3208\023\303\363\236\032\005\022P|\275\346\303\210s9\275Bv(\340(_w$\303\344\264\372T\220h\251\300\373\344\307\217s\313\203=\235#\267\372\213\312\366Hw?\036"
+	.string	"\022EJ\321\027\025\032\302\304,\355y>\270\222^y\264\2265\373\304\274\310\f#\320\022\271H\346q\315\327\211\020\013Y\317\2757]\342`j:\201c\361\223k\256\016\255\246\353%\214v\323\361,\277\307\237\037\217\232\201Oho\320\365 8\256R\031\341\370\003)\317\177q\370\203\210\211m\374(\214\373B\035.~\033\364\240\360zQHg\ty\370@\235H\232e\256\352{\371=`\321\257MU\272\037\305h\264\261H$(\261\243\341\264\303\371d\224@\347N\277}\251\t\270\206\254K!\213\tU\255blug\232z\357a\262(\360\007\352\342\360\352)#g?"
+	.string	"\023\232\001\2110\204\242^4\203sz\244\241\365\242\034\300\350\006\235\007\361h5\352\252\264\310\333/Y\233\361\357\251\2770\350\221\274\241\372\243]\242\2347h\200\205\274r\310\207\223\324\021\021/NES\212\235\255Xy\200Aa\364\206\2374\235\227\332p\332\334\r\314\331/\221\321\366\276^s\211H\351\274x\332`\250<b\327?\270\321D\325\005\032\370\230i\336R3)\340\\\314\370\327\341I\237U/\323,,/d\253\366\221\004\016\na[M\307\347y\274Q[\276\302\3016_\3468\032\250\\\337L\016W\320I\005\236~\253\370\203\345\273\002\375[)o\2618Sk\366\0173\306\335B\370s\036\030\227\224\n\2732\315\271H\223K\022f\234\272,1\326\221\016\3326\264\200%\360-\250\332\322\232\247G\217\345\227\200\3012\021\242\270\306\325\373\237T"
+	.string	"$\245V\007\242w4\2068\277GJ\031vj\207\212\214\364\333\260\033t"
+	.ascii	"\372Y_\367\241p\333\316z\213\342\006F\305\226\2271\003J\302@"
+	.ascii	"\\\005\270\004n\254\331\"\267\261z\227\224 \242\3541;\371\337"
+	.ascii	"\302J\370\374Y\3259\377\361\332\227a\355$\312\375\007|x\206\n"
+	.ascii	"'Q\364\211\220\376\377\354>\020\353g\202\240\313J\367k\023cE"
+	.ascii	"s\371nt\303\365\265<t\353\365Q\321\223k\304{!\356\306\272\357"
+	.ascii	"\260\322\t\304\327\253\032\365\\\210\375a\3100\256\301Z\377+"
+	.ascii	"\217\322\340~\351\316\350\216\022\361G\363h\370I\027\1774\250"
+	.ascii	"m\321\213\371c\231\016O\360\275T~\213\346\036\265b[\356\374\344"
+	.ascii	"\262\371;\376o\004\320\325\254\207\0312\324lp\025\363qox\341"
+	.ascii	"6\364\013`\323_4mT\362\331b\220\237 \270\346\2361\366\r?H\035"
+	.ascii	"\277K5\352\316!\316\276\277\236\252G\357lJ ,\005\332\027I\377"
+	.ascii	"`\356u9\315\032.\306\262>\326\261v\026\023\366\\\350\354\317"
+	.ascii	"s\302t\317(\363\030|\366t\365\003\021\306\200+<\306\340sItI\300"
+	.ascii	"\352\017\277_\266k\243\030\310\376.\026W\336\352\207\b\300\253"
+	.ascii	"K\224o\013uGF\224\334s\350\377Q\327\256\344\b\247X\177\303\355"
+	.ascii	"^&\377@\366&nx\327\202<\275\311\207\213\302V$\021\336^K\243\206"
+	.ascii	"\366\334\244S\346\344\320\347\260y\255\255\267\206~\303\352W"
+	.ascii	"\353\316(\306\263\337\303Z\240y5jX\330\035\200E^\003\036\337"
+	.ascii	"\250Y\023i\336\376\213\340@y\357\221\354?\220\0130\374\020o\351"
+	.ascii	"\354c\246\3373\302\315MRa\276)8\001n\223\336};\2668\301\026o"
+	.ascii	"\343\316?\201\377l\214\2723Sd\177\215\372\232\224\361w\032\377"
+	.ascii	"1_\256|\352\206\321f\311\344\345\343\240\343p\340\341\215\353"
+	.ascii	"\211s\202hF\311\337\304\031\375S\2644`6\177#9\357k\333\326\366"
+	.ascii	"\233\371\251+\337\247\320\317\347wy\367\374w<\3326\0167Y\341"
+	.ascii	"\177\252\306\207\236\244OU\370\223\326\235\236)\215\356\3046"
+	.ascii	"F\351\306\306\252\3261p\370\234\203\263\247I\255s\250\016\277"
+	.ascii	"\242\301j\336@"
+	.string	"r \030?zv\\\243\354#\021\247\224\362\033\r\326\230\363\207)$\323\376\352\306\207\363V\332\374\312\342H\347~\016?\215\367\004\330\221\245\357$\360Fi\237\342\317\335*\253\241\247P\365\221\255\235\326\370\314\251\320OR\273\307\276\350\323\\\332;j\330\005<F\2466\n5=W\377'\bWr\234\031\276\337\205\331\304\2677\226\374\215\301\021\002<\004\316|n\315\003n\331W|p\240\273s-7c\235\237\364\322\373\200\"u~\027\224\227/\024o\035\033\005>\252\n\236\314\264\0162rK\331\337\362\330^\360=\261\b\223\275G\227\033\211\367\273;rL\006\016s<\005\355\343Qx\330\360\031\325\261\231\262\026\216\226d\366}\270\306V\3616\325\376\177\333\331\314z\350\031\257\333\362\335\242\266\237\220n\336,p\333\352-\327v\007\305\221\266w%\375{\3772('%|;z`E\325\243\267C\b\363\232x\357\371?"
+	.string	"?n\257\202oW[\270\352\371\007\235\201c[\031\030\362\364\2154'\036\367P\314N\27682\237\323\352\363\006\330p\033\360\346\033\250wz\265g\324\024c\317\277\257\317;\366\305\316\206:\267aj\234\313t6\f\320\265\273\374\264g\247\305\307\2760\311\225}0\231\027\016\314\361\214\356\223\236\243\346a\274\006\374]\216|\277\213\376\327\301\363\277\256r\325\327+\374\273F\277\264f\246\rp\276[_\332(__\200\333\367;Z\213'"
+	.ascii	"\350\361C\217\307\256\343\257\016\326\300\374\361\221\231\320"
+	.ascii	"M\313\226W <\264\207\034%\301\345t\315\332\354"
+	.string	"\3573c\375D\364\253\273#\004h|]@\257O\330\300\312\310r\302\234a1gex\272\374\320\334\224a\366C\376=*\2076\201o\347\317\246\354\323%ZhWG\210\337\242\346\274\323\n\257U\201\323\032xk\373\217l\333\221\370\344\n\354\374\b/\350\204GJz\204\262\347AW\316\"\265\244\263\362\331\356\316nY7\360\333\374\217s\203\005/\237\b\036\214\017\020\300ox\032\230*\243\335\334\367\300\364\333K\237\312a\266\372q\372z+\005\365\034\350\231\342?\262^\376\202|8\340\331R\326\001\3707'x\274\263\323\244\377,R\237\225\317G\327\177UI\364\347\327\016\310\363n\001?\346\202\366\260\373Z;\217#\362\272]\272\274t\371\2232\321t\326k\355\233\333B\177m7?\265\333\335Xs\277z\273\334<;?0\245\275\274\211\324P\366\327\264\352\376A\333\227;Z\350\243Ny\376\212k+\003\373\235\022~"
+	.string	"\314\0218KN\247!\374F\271\306{\233E\275\332\320\257@|\244\354\324R\364\262\253\034\253,|\361\345\375=\261\377\375l\277#t\266jG[\306\310\231\365hS\272V\335\221\217\377!\301\0177\250\236[[\303\n6;/\n\004.\b\303;\235\337"
+	.ascii	"S6\362\200?\352\030\367!\006\316\260\344E\202\341\f\232\372\303"
+	.ascii	"\020\367\243q\35332hW\303\363\2636:\260"
+	.string	"\2136\3444\350\341W\346\3668\274\343\310\301>\206\360\242\374\r,\301\n\337\1770\232\033\021\375\204L\350\027\317\337!\035\250a\\\036\344f\243\242\377\253t65\312k\321\300\031#\247\016Ah\237V\2703\350\302\252\237\246\240\301\3102\301V\235\327\217\243\231BnGi\253\301^\302\335\324Q\242\315\0242Cy\336\235\032\327*\034"
+	.string	"E\027WNI\323m!^`\266\221\347\316\242wu\230\316\266\214|=\312\352\234\337x\340\333\324\346\036z\346\352\267\376z\267~\346\242\277O\024z\206\264\260\027\326\346\004\274\204\224\307\007=\360\350\f(\216?o&T\263\177\007\371\253`,g\364\036qs\342\nc\201\340#\322\355\221<\377\274\350\323\350\230\233\2612\341g\353\261\007\027+\337\2145\237d\t\177\005\333\327\265\260~5\372\373v\301v<"
+	.ascii	"q\205\311n2\365W7}\247\304\274l\363q\277\355\315\361\201\330"
+	.ascii	"\374\263\017\374CJ\004A\362#\251OP\367\360KJ\273w\236\204/\231"
+	.ascii	"\031x\"/\234\037|\377,\336\t\231f\236\334\223\307\032<0wS-\317"
+	.ascii	"*\230\354c\036\270\342\021\301\016\223V~\311\332\241\242\232"
+	.ascii	"^=;\035@\207\316C\374\240?\377\350\307(~\257\201\303Y=\265\207"
+	.ascii	"\377\nDH\374K3\210\314\362\tT\266\"\262O\306\323\037\362\032"
+	.ascii	"2\031\275\340q]\262\336u\370?\224\363X\214\347\b\272\342\251"
+	.ascii	"\016\204\303\320\207\341\002\r>\217\255?`\342\305\345\001\235"
+	.ascii	"\2006\266\344\320)\322\374z\342!\325\255\276y\027Z\177U\213\355"
+	.ascii	"_\201\315\"\033yp\304\337\306\372\223\177\340\263\2549\247\207"
+	.ascii	"\005\365\230E\357\n\336\277|\235\250\216\227j\266\007[2$\302"
+	.ascii	"**Y\206\206\313oHN\202\266\344\274\026\341\366\324\316\310G\263"
+	.ascii	"k\375\323\375/)\375\343\312u\036\347\031S,\274y\305\003K\313"
+	.ascii	"\235\357\347\255\025\373}\270\340\032\026\272\226i\247\324OJ"
+	.ascii	"c\225\355F\366\225\210\353\362\345\272\345\252^\004\r;(\325\234"
+	.ascii	"N/+l\257I\204"
+	.string	"\032&\016@a|\257&P\350pL\323\265N\353#\220\235\265\360\203\203,\351xY\370\274\007\035\217\354h\277\262\375\0076\346z<\256\024\2306\"\351\343^X{c\261M^\233\nLV\223|\251\256\035f\364\241\251s\316\276\241\344\030g\035E\331M\222\r\237\355\003\302\367\200\235|\367;/\217\240>\242\364\203\341Kw\003\276\016\242=\240\354\245U\342\267\371>U\376Q\256\232yJ\350^\027\377jr\235i\206\327\352\220,\306\217\253\370'\300\336B;s\306yE\247n\037\215a\3015m\364b\0072od\371\262\\\035\026n\271E\373b\274\232\004\215\276\311\301\253n\013@\234\251~S\303k\322\346x[\326\177\316n\036\374qXxQ\355$u~2\032bs\310=\353k\206p\223\255cJU\027r6bx\267Q\317Go\267\213\276hJ\224{R\240\256\315~\364\366\206\307\332\344\002L\277g\317\201"
+	.ascii	"=\235\361\257c\263t3\355\351T`\237\021&\226\330\036\355\241'"
+	.ascii	"\240\317\235\245\345\266\236\266@\264\367\001~\030\337\316\r"
+	.ascii	" \347{\335F\005\354\366\377\006\204]\030i\f\304"
+	.string	"\031\222\356)\367\347\313[\275\r\341\270<\314\027O\030\345\325\377\352{\035\267\017\355\034p\032\356P\270\237\346\331\373t?\332;\357\2565\374\n[6G\327\237i3\351\206\370\337\343\356\\\344\274\341\315\004\211#\342\326h+O\222\361\376\325\337<\364\306\251\020\216\201\335~\025\374J\245\245,\376\362\230\317\032\271s:u:Z{\223\327\277\317o\255\357\267\370\022\337\266O'\2279oy\247C\243#\365u*\351k-\350\013\013\307\001\013\357\256\301\013\325\317\233\240yu\241\0217\177R\246#\235r\005\303\210~\304\344k\222\225\003\205\357\223\251\207\001\035[Y%\366Wzc\370\323\2172\353\3502\217\313\3074\272\030\350\374~\3161z\2367\273N]\006I\002\246\364/\354\375w\260\033\273b\273N*\264A\366\246F\317\035\350[\220\313\237\333\006\372|\255\177\b\267z\201Y\344W\366\265\337g\237\373\367\370\347\346\243"
+	.ascii	"\360\021\343\212\277xt8\271\273\362M\261\336\022\250\377\361"
+	.ascii	"=3{\374c\376\370\254x\341j\375\314\330\377\030[\220Kjw\332\372"
+	.ascii	"\361\241\017\200Y\253??\032\303/\347\212N3\036NC\200\021o\263"
+	.ascii	"\037\3646v\031\210\356\346\276\316\366e\333p\301\263\fN\212n"
+	.ascii	"\377\275?B\037\3346F\264\035o8\275\233o\024"
+	.string	"\364*f\322\373\035z@\227\356\370\353\250\303\265o\376O\240\236;\"\023\336h\275\362(\325\rV{\0207\211O'\335\272\347G\\\376\234\213\365\263\270\273\"\371a\305Ru\374{\377x\367\312o\251cs6\312\357\225\375L\306\325r\247\247\326\350\342\303\027\374\305\242Sl\370Q\267{~_\246\214\207)\267+\006\242\370\334\307ie\367\256z\376\201\361\261H\037\005\025\177\030;gW\031\267w\351\304*\333\241:B\365\300\005\003\234y\306j\206|P\367\212\216J\333v\236<\031{\224\r\fC\351\347\364\303\317\327\350;8?\332\226\027\324\336\261\372!\216f\373\356\257\247\376t\212\327Hy\332'\310\347+:\263=\025\236\222\023\372\032\325g.=gx\271\331/4\232\t\370\314\316\0173\025\337\2333}\245q\336\217x\344\333\320\313w\251\177v\310\037\273\016K\350F\303\3275\331qt\202p\035\016\237\252~\232"
+	.ascii	"+\017\031\207K\365\362\313\236\277[\316\324\272iR\352s\220\312"
+	.ascii	"?D<or\277K\270\214\245\363\254:NE>\247\245\360\302FS\032N\247"
+	.ascii	"\206q\325>\375fm\336\264\347F\305\351G,/p\363Td\017\272\360\266"
+	.ascii	"<.\327\023\240m\325.b@$\367\331#4^\253\363\376\354\242\260]\267"
+	.ascii	"9\354/1\f\034\306\237\336\035E\337\236\243\223\327\021\350b\353"
+	.ascii	"d\027j:\233|\362\022\360{\212x\354\274\263\021\204\217\262U\241"
+	.ascii	"\233\bO\375=\226\027\006g\035\032\254\022:\235~\374\320W\221"
+	.ascii	"\247\312\336O\376X\334\177t3\t\027\312>M\025\177=0$\370\031\t"
+	.ascii	"\236\336\006sD\245{\220\237\315\203'\350\331\364wPYa\364r\353"
+	.ascii	"\265\235w\250\275\227\324\262G\355\344/\3615\253\016+\306LX\340"
+	.ascii	"+"
+	.string	"W\253\2530&\367\200:\332\237p\315\f\230\016\r\272\246\313\221\276\275\365\032\303\325\363\353K?{S\274\327\\\362\026\321\276\355\335\233\024\207\3221\261X[]\326\027\374\215\375\006\340\351\023|\026\367E\232\264\327\343\177\266\356k2\353\263k>R\254\216\337\274+\374V\320\007|;(07\257[\332\240\300\027\352d\025\035\324\313zO{\231\326\357 \305\217\222\005-\352\300\241g\336[\354\024\366c\277_\367N\230\330\350+\305\027\t\215\273\320W5W\026fY0\326\371\360\273\312\275p\334\227\346\257\330\365Xn\t\007u\336dg_\312\362}]\021\377\304\265\036\221\340w7\267\2462\322\257?\200\360\230\331w\206\267\f\274\353\200OP\333\f\305\201I\017 6\373wy\277T\354\231w\312\310\2109g\2177\232\360;\372\223\3279\307\222_\200N\204\255\267\020\364l\352\373.\376\007 \316%5H\244\265\277\376\035"
+	.ascii	"\365\353\255\227\220}\250r\306\372\376\355\234\237\306\366y\003"
+	.ascii	"X#\320\261\246\363\r:\200\246Dw\021\267=\177\3266\250\256\005"
+	.ascii	"\030\372K\335\035\306_\007n\037\350"
+	.string	"c\\\273\313\t\342\375]\\R\273\231m\3570%`U\"\217\246o\364?\310\350.\204Q\3577{\331\350\234{\306\005^\273!b\005\244\304\0039b\266p\017k\037\310!\243N\366\310:\323v1"
+	.ascii	"Q3\300\356\230^\206\263k\030Lp93K+\326\271\007\264\227\207\370"
+	.ascii	"E6ut\354\354\357\034\222\373\335\304\017M\326\031\t\367'\356"
+	.ascii	"\261\353\375\310;\267\315\216\371\346\221\2527\026\317\212\207"
+	.ascii	"\275\255C\276\334\256\345x\365\231\272\303,\177\373\244/j\360"
+	.ascii	"\347\367)C\367\252\373\347\226{\326\350\316U\2779\334\302\302"
+	.ascii	"fx\031\337\277\332E\327;\266}&\275/\225\377\267`\024b\003>\374"
+	.ascii	"\343\013y\231\n!\325\232C/\271\253v<\204\334\313Q\353\277\233"
+	.ascii	"/Z\336\337dG\333\317\255\031\233\017\023\350\305\223!K\210\354"
+	.ascii	"z\244xy\325\372\037\373\016u6\001\373AJ\374\035\372j7\346\207"
+	.ascii	"\3037\322\303\307\231.\337zv\"\374\200\370r*|\361~\323>\257y"
+	.ascii	"\376\213\202/\3709\006\026\257\361\244m\346\376/\223>9p\344\271"
+	.ascii	"\236\310\272\313{[\325\343!\270\366\255%\376\242\234\306\361"
+	.ascii	"q\346\257\330\325\270~\261\327\304\244\r\177\246\025\3749qk\343"
+	.ascii	"\245\377b'\210O\355\317\327oU~1x\275\030\376\305\317O\364?P\265"
+	.ascii	"\273H7\331\236]b\300\257\215\177]\267h1'O\377\377\032\340\351"
+	.ascii	"\345/Rc\322_\336EN\274\376]j\237\372S\321\225\321YC\360\017"
+	.text
+	.section	.gnu.lto_.symtab.a741ea90f9c9c8dc,"e",@progbits
+	.string	"cliPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\007"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\007"
+	.string	""
+	.string	"cliRxBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\007"
+	.string	""
+	.string	"cliPrintLinefeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\007"
+	.string	""
+	.string	"cmdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\007"
+	.string	""
+	.string	"cliPrintLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\007"
+	.string	""
+	.string	"cliPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"cliPrintLinef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\b"
+	.string	""
+	.string	"tryPrepareSave"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\007"
+	.string	""
+	.string	"cliPrintVarDefault"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\t"
+	.string	""
+	.string	"cliGetSettingIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\t"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\b"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\t"
+	.string	""
+	.string	"valueTableNameOrder"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\007"
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\007"
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\007"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\007"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\007"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\007"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\005"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\005"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\007"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\005"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"sdcardConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\b"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\b"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\b"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\b"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\b"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\b"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\b"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\b"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\006"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\006"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\b"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\006"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\006"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\b"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\006"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\b"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\006"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\b"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\006"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\006"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\006"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\b"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\006"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\006"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\006"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\006"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\006"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\006"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\006"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\b"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\t"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\t"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\t"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\t"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\t"
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\t"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\t"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\t"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\t"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\t"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\t"
+	.string	""
+	.string	"atoi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\t"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\t"
+	.string	""
+	.string	"strcasestr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\t"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\t"
+	.string	""
+	.string	"pinioSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\t"
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\t"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\t"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\t"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\t"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\t"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\t"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\t"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\t"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\t"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\t"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\t"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\n"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\n"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\n"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\n"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\n"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\n"
+	.string	""
+	.string	"sdcard_isInitialized"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\n"
+	.string	""
+	.string	"sdcard_getMetadata"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\n"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\n"
+	.string	""
+	.string	"afatfs_getLastError"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\n"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\n"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\n"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\n"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\n"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\n"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\n"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\n"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\n"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\n"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\n"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\n"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\n"
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\n"
+	.string	""
+	.string	"pgFindScansRegistry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\n"
+	.string	""
+	.string	"getConfigSaveStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\n"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\n"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\n"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\n"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\n"
+	.string	""
+	.string	"strtok_r"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\n"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\n"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\n"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\n"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\n"
+	.string	""
+	.string	"strtoul"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\n"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\n"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\n"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\n"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\n"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\n"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\n"
+	.string	""
+	.string	"timerGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\n"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\n"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\n"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\n"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\n"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\n"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\n"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\n"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\n"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\013"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\013"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\013"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\013"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\013"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\013"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\013"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \013"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\013"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\013"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\013"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\013"
+	.string	""
+	.string	"mspGetCommandStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\013"
+	.string	""
+	.string	"mspCommandId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\013"
+	.string	""
+	.string	"mspCommandCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\013"
+	.string	""
+	.string	"mspResetCommandStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\013"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\013"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\013"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\013"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\013"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\013"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\013"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\013"
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\013"
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\013"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\013"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\013"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\013"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\013"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\013"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\013"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\013"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\013"
+	.string	""
+	.string	"bufWriterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\013"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a741ea90f9c9c8dc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
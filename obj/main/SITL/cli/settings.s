@@ -0,0 +1,1982 @@
+	.file	"settings.c"
+	.section	.gnu.lto_.profile.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"\301\t"
+	.string	",\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\233\364\343\336\006"
+	.ascii	"\001\240\342\234\212\n\002\270\357\320\330\006\003\306\246\203"
+	.ascii	"\271\b\004\336\316\324\210\n\005\376\367\260\205\006\006\323"
+	.ascii	"\347\261\306"
+	.string	"\003\007\337\251\351\317\004\b\263\320\357\247\001\t\261\372\215\340\017\n\367\316\327\257\017\013\243\224\377\222\t\016\216\307\310\264\005\017\307\355\347\305\n\020\336\337\356!\021\312\220\377\301\r\022\206\345\347\303\n\024\355\316\316\363\b\025\327\222\361\365\013\026\342\263\312\237\001\027\302\223\266\246\003\030\302\223\266\246\003\031\257\267\254\261\f\032\214\266\217\340\001\033\320\205\256\202\b\034\344\352\246\263\007\035\345\220\314\235\r\036\375\275\346\323\005\037\355\262\347= \322\204\221\306\001!\206\255\214\227\017\"\317\234\246\263\t#\342\335\275\264\003$\363\225\213\300\006%\223\244\353\233\b&\234\260\325\254\r'\302\223\266\246\003(\211\301\261\026)\373\344\335\202\007*\200\273\337\371\006+\264\264\266\260\r,\235\202\211\317\002-\347\205\360\261\n.\246\210\320\217\006/\253\364\204\210\0010\236\364\324\235\0071\224\222\204\337\0052\301\211\302\237\0133\201\304\320\300\0164\220\207\307\322\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.719d435e15107495,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lookupTableAccHardware.188.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`\274\001]\016"
+	.string	"$\027\361\001"
+	.string	""
+	.string	"\277"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\250\002}\273\001"
+	.string	"\005\001\006\025\001\020\005\001'/\206\b{\270\304Ry\276\017\005\001'7\206\bw\330\377\001u\301\016\005\001'A\bu\304\r\005\001'K\206\bs\bq\307\f\005\001'V\bu\312\013\005\001'`\315\n\005\001'j\206\bom\320\t\005\001's\323'|\325\007\005\001'\205\001\206\bk\230\377\001i\330\006\005\001'\221\001\by\333\005\005\001'\231\001\336\004\005\001'\242\341\003\005\001'\253\344\002\005\001'\264\001\b}\347'\272\351\001"
+	.string	"?\202\210\200\310\002g3\352\0014\350\001\346\001\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\0015\324\001\322\001\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM2068949"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\013LSM303DLHCA28MA8452ADXL345"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"* \020\2431r\003["
+	.ascii	"\316\222\302\206\222\255\222\216\327z\327\030\221\321\203(\n"
+	.ascii	"B\036\017\2576\214\302\273d\367Q3\326\316\313LL\304\313E\362"
+	.ascii	"\370\337%\263\036\317\227\331}\030Y,\177rK\242L\3005k\036\020"
+	.ascii	"[\263<:\363+\017[\317\332\314]\263n\220\337`\212"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardware.189.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`\223\001\235\r"
+	.string	"\024\026\323\001"
+	.string	""
+	.string	"\264"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\251\002}\273\001"
+	.string	"\005\001\006\025\001\017\005\001'/\206\b{\370\307Ry\276\016\005\001'7\206\bw\230\307\002u\301\r\005\001'A\bu\304\f\005\001'K\206\bs\bq\307\013\005\001'V\bu\312\n\005\001'`\315\t\005\001'j\206\bom\320's\322\006\025\001\007\005\001'|\325\006\005\001'\205\001\330\306\002y\330\005\005\001'\215\001\333\004\005\001'\226\001\336\003\005\001'\240\341\002\005\001'\251\001\b}\344'\257\346\001"
+	.string	"?\202\210\200\300\002k3\347\0014\345\001\343\001\342\001\340\001\337\001\335\001\334\001\332\001\331\001\327\001\326\001\324\001\323\0015\321\001\317\001\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007BMI160"
+	.string	"\tICM2068949"
+	.string	"\n08G021"
+	.string	"\bMPU9250650000"
+	.string	"\007L3GD23050"
+	.string	"\tL3G4200D50"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.ascii	"& \360\"B\312\003\207\254\372@\227\203j\250h\214\222\201A\f\205"
+	.ascii	"\220\247\207\313$\214\265\273\234\335\373\321d,\206C\314D\306"
+	.ascii	"\213\263\036\277\213\354r\346-f\271\265-\022g\"\256\231\345\001"
+	.ascii	"\2655\317\2033\277\362\260\265\254\231\271/\353\006\371\r\275"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_lookupTableBaroHardware.190.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\035\b"
+	.string	"\264\r\350"
+	.string	""
+	.string	""
+	.string	"b"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\251\002}\273\001"
+	.string	"\005\001\006\025\001\007\005\001'1\206\b{\370\316Ry\276\006\005\001':\206\bw\bu\301\005\005\001'?\b}\304\004\005\001'G\307\003\005\001'O\312\002\005\001'W\206\bsq\315']\317\001"
+	.string	"?\202\210\200\300\001o3\320\0014\316\001\314\001\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007BMP388"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMP6988"
+	.string	"\004LPS280"
+	.string	"\007MS5611085"
+	.string	"\005NONE"
+	.string	"\005AUTO"
+	.string	"\020"
+	.string	"3\342%\200\257c\223\033\260\r\220\b2\001\270\202\214\001\376x\262\253\360~<\263\0039\372\314\257Ae2"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_lookupTableMagHardware.191.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"U\007"
+	.string	"d\f\312"
+	.string	""
+	.string	""
+	.string	"_"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\340\252\002}\273\001"
+	.string	"\005\001\006\025\001\006\005\001'2\370\325R}\276\005\005\001';\206\b{\by\301\004\005\001'C\304\003\005\001'K\b}\307\002\005\001'T\206\bwu\312'Z\314\001"
+	.string	"?\202\210\2008s3\315\0014\313\001\311\001\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bLIS3MDL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\bQMC5883"
+	.string	"\007AK89675"
+	.string	"\bH\005NONE"
+	.string	"\005AUTO"
+	.string	"\016"
+	.string	"<\263\216+\331\261\311\r\330\006H\254\232\035\024\366\003\231"
+	.string	"\\\363\314\003d\3563k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableRangefinderHardware.192.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \303U\005"
+	.string	"t\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\253\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\206\b{\270\334Ry\276\002\005\001'7\by\301'?\b}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005TF02"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007TFMINI"
+	.string	"\007HCSR04"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"OX\314\323\016\260\265\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_lookupTableOffOn.193.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"D\0068"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\205\337\022}\273\001-\206\b{\370\336Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableCrashRecovery.194.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \276]\005"
+	.string	"\204\ts"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\254\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\370\344Ry\276\002\005\001'7\206\bw\bu\301';\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007DISARM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005BEEP"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableUnit.195.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \177\315\003"
+	.string	"\344\0069"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\254\002}\273\0011\206\b{\370\346Ry\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007METRIC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\tIMPERIAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAlignment.196.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"u\n"
+	.string	"D\021+\001"
+	.string	""
+	.string	"{"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\256\n}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'1\206\b{\330\364\002y\276'<\230\364\002y\300\006\025\001\007\005\001'G\206\bw\357\002u\303\006\025\001\006\005\001'Q\206\bs\230\357\002q\306\005\005\001'Z\206\bo\330\356\002m\311\004\005\001'a\230\356\002m\314\003\005\001'h\206\bk\330\355\002i\317\002\005\001'n\206\bg\230\355\002e\322's\330\354\002q\324\001"
+	.string	"?\202\210\200\320\001c3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\007CUSTOM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nCW270FLIP18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\031"
+	.ascii	"D\205\252D0u/\313\0308\007\001\203\255+\034\202\331\006\354\003"
+	.ascii	"9\202\374@\216 ?\260\037\310\017\344\b\362\363\231\023\330<\025"
+	.ascii	"y\0204\316\305>\255nP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableGyro.197.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bV"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\257\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\367Ry\276'7\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005BOTH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SECOND"
+	.string	"\006FIRST"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSProvider.198.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\377\022}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\376Ry\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006UBLOX"
+	.string	"\005NMEA"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableGPSSBASMode.199.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \344\375\005"
+	.string	"t\n\220"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\320\270\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'0\206\b{\370\304Sy\276\003\005\001'6\by\301\002\005\001'<\b}\304'C\by\306\001"
+	.string	"?\202\210\200(w3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006GAGAN"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\b"
+	.ascii	"JX\314cG\205\267\346\231\007\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableGimbalMode.200.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 ~\305\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\300\271\002}\273\0012\206\b{\370\307Sy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bMIXTILT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007NORMAL"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxDevice.201.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \307\205\005"
+	.string	"\344\ts"
+	.string	""
+	.string	""
+	.string	"H"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\271\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\370\316S}\276\002\005\001'9\206\b{\by\301\001C\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007SERIAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SDCARD"
+	.string	"\tSPIFLASH"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"\220\344\t\226\200\314}f\255\240\366\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableBlackboxMode.202.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \246\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\272\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\324Sy\276'=\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007ALWAYS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013MOTOR_TEST"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableGyroHardwareLpf.203.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \261=\005"
+	.string	"\224\tX"
+	.string	""
+	.string	""
+	.string	"M"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\340\310\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'7\206\b{\270\304Ty\276'F\206\bw\330\377\003u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\rEXPERIMENTAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\0161KHZ_SAMPLING"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePwmProtocol.204.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \362=\006"
+	.string	"\304\n\216"
+	.string	""
+	.string	""
+	.string	"X"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\370\311\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'=\301\002\005\001'H\206\bwu\304'T\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bBRUSHED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nMULTISHOT"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\004OFF"
+	.string	"\n"
+	.string	".I\034\313\032$\320\003\241\001\022A&"
+	.ascii	"\327<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolation.205.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \302e\005"
+	.string	"\224\ts"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\312\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'1\206\b{\270\327Ty\276\002\005\001'7\b}\301'?\206\bw\bu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\007MANUAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005AUTO"
+	.string	"\007PRESET"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"Q\245\346i\007W[\373\314\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableRcInterpolationChannels.206.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \330\255\005"
+	.string	"\264\t\215"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\335T}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'.\206\b{\by\276\003\005\001'1\206\bwu\301\002\005\001'7\b}\304'<\206\bsq\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004RPT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\002T"
+	.string	"\005RPYTY"
+	.string	"\003RP"
+	.string	"\t"
+	.string	"\021\326\020\221@\272j\030R\330\032d\f\b\347\231\007\201\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableLowpassType.207.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\313\n}\273\0011\206\b{\230\337\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableDtermLowpassType.208.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\340\314\n}\273\0011\206\b{\330\345\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAntiGravityMode.209.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 {\255\003"
+	.string	"\244\0069"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\315\n}\273\001/\206\b{\230\354\004y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005STEP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007SMOOTH"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableFailsafe.210.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \247\355\004"
+	.string	"\364\bV"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\360\315\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'5\206\b{\370\356Ty\276';\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\013GPS-RESCUE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005DROP"
+	.string	"\nAUTO-LAND"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableFailsafeSwitchMode.211.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \240\205\004"
+	.string	"\344\007V"
+	.string	""
+	.string	""
+	.string	">"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\316\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\370\364Ty\276'7\b}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007STAGE2"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005KILL1"
+	.string	"\005"
+	.ascii	"\nV9Z\265\330\247\325\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableBusType.212.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \274\025\005"
+	.string	"\004\tq"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\350\316\n}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'0\206\b{\by\276\002\005\001'5\301':\206\bwu\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006SLAVE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004SPI"
+	.string	"\004I2C"
+	.string	"\005NONE"
+	.string	"\006"
+	.string	"O\221\202\200\001\376xf\327\2402\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_lookupTableGyroOverflowCheck.213.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \230E\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\315\025}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\370\314U}\276'3\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ALL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264:@\3557\200\""
+	.text
+	.section	.gnu.lto_lookupTableRatesType.214.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\324\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\331\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\270\317Uy\276';\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\005KISS"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\013RACEFLIGHT"
+	.string	"\013BETAFLIGHT"
+	.string	"\004"
+	.ascii	"8\027\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableThrottleLimitType.215.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\334\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\346Uy\276'6\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005CLIP"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006SCALE"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableItermRelax.216.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \343\365\005"
+	.string	"D\n\220"
+	.string	""
+	.string	""
+	.string	"G"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\330\337\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\270\375Uy\276\003\005\001':\206\bw\bu\301\002\005\001'?\206\bsq\304'C\306\001"
+	.string	"?\202\210\200(o3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bRPY_INC"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\007RP\004RPY"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\t"
+	.ascii	"\217TB|\2121\260\030\020\3163\017\220\271\317\254\033T~\003("
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_lookupTableItermRelaxType.217.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 }\275\003"
+	.string	"\304\0069"
+	.string	""
+	.string	""
+	.string	"8"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\360\337\002}\273\0013\206\b{\370\376Uy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableAcroTrainerDebug.218.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 z\265\003"
+	.string	"\324\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\340\350\002}\273\001"
+	.string	"\005\001'0\206\b{\370\305Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\006PITCH"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005ROLL"
+	.string	"\002"
+	.string	"\357\314n"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingType.219.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"4\0079"
+	.string	""
+	.string	""
+	.string	"?"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\320\351\002}\273\0011\206\b{\370\314Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007FILTER"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\016INTERPOLATION"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDebug.220.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \303\205\005"
+	.string	"\324\ts"
+	.string	""
+	.string	""
+	.string	"D"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\350\351\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'3\206\b{\270\316Vy\276\002\005\001'8\206\bw\bu\301'?\206\bs\bq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tTHROTTLE"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\006"
+	.ascii	"Q\245\346i\007\310\334g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingInputType.221.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 z\245\003"
+	.string	"\224\0069"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\300\352\002}\273\0011\206\b{\370\317Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableRcSmoothingDerivativeType.222.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\330\352\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\206\b{\270\325Vy\276'6\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004PT1"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8\027\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableSdcardMode.223.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \273\005\005"
+	.string	"\324\br"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\347V}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'.\206\b{\230\346\006y\276\002\005\001'4\b}\301'9\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004SIM"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\005SDIO"
+	.string	"\004SPI"
+	.string	"\004OFF"
+	.string	"\006"
+	.ascii	"6\031\363\264c\253\255}fM\240\362\033@\021"
+	.text
+	.section	.gnu.lto_lookupTableLaunchControlMode.224.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \243\315\004"
+	.string	"\264\bV"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\355\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\356Vy\276':\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableTpaMode.225.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 sm\003"
+	.string	"$\0068"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\225\205\366\026}\273\001,\206\b{\370\365Vy\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\002D"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003PD"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_lookupTableLedstripColors.226.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`[\001\365\r"
+	.string	"V\230^F\360r\234\016\344\201\3030\314\3142\331\004\251\201w.\335\231)\333\200\317\t6\2353\246Vg\201H\360\343\2218\274\323cK\343\303\n\271\363\366\r~:\271E]r\360\326\232L\2358y-\255$\320cwKh\224dM"
+	.string	"K"
+	.string	"M"
+	.string	"\013\352\212\226\311RP\337"
+	.ascii	"R\240\311*E\364z\352[\344D\313l\235H\364\036\250o\214\204\313"
+	.ascii	"l\225\017\350-P\337#! |b:D\240"
+	.string	"\327\244\276\003\234\344z\363=H\310\370\200\351\361\362\303d\272\307\360\236@o\246\276y\003\3639\0049L\276c@x\036&\013\025\f\360u\220\023uz\2518\310\211*\257\241\27635Vf\352$\322\373\f\365\rR\2163U^\250\357\020\030\343T\235X\350=\205\372n\027\240\251r\251\357\353$W\213\234+\006\364\206\352{\252@s\025b\t\211%D\226J#)#\033\210Y\210\\\001e\342\210\224\225\b`\221\203q\224\225D\242Q\206\361\306\343<\241\307Z\215\b\377\303A\\\304G\274\304M\034\305QOq\025gA\340\253\263\016\363\026\177\361\230\307\270\214\3178\215\333\370\215\007\274A\321\272\223\213-\310\245|.\326\330/\204\355\346i_g\362\247\323uVeZ\016\327a\027{\326~[\bz\034\007cOSA\351\020L\331\270\016c\213\240;i\006m\327\341\022\204\233O\323\214\260\006zv\3238\224\003\035"
+	.string	"6\263\2562!\363rQNk\020\236\303l\b\362\003Y\202\374~\232\007\371YM\226 \347\254\214\203@"
+	.ascii	"\341 \223\251\f\203@\2622\032d\r2\007Y\203\314A\326 s\237Y7\250"
+	.ascii	"\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTableGyroFilterDebug.227.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \233\215\004"
+	.string	"4\bU"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\327\027}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'.\206\b{\370\326Wy\276'5\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\004"
+	.ascii	"8S\373\264\232@\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTablePositionAltSource.228.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \250\335\004"
+	.string	"\244\bV"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\373\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'3\206\b{\370\334Wy\276'>\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tGPS_ONLY"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\nBARO\bDEFAULT"
+	.string	"\005"
+	.string	"LU#\342L\355\323\352\006\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOffOnAuto.229.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \231}\004"
+	.string	"\024\bV"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\373\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\206\b{\370\336Wy\276'3\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableInterpolatedSetpoint.230.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \235\235\004"
+	.string	"T\bV"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\374\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'3\206\b{\370\344Wy\276'7\206\bw\bu\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tAVERAGED"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_lookupTableDshotBitbangedTimer.231.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \234U\004"
+	.string	"\224\007V"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\374\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'/\370\346W}\276'5\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\005TIM8"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c1"
+	.string	"\005AUTO"
+	.string	"\005"
+	.string	"\002T\"\342\\\354\323j\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_lookupTableOsdDisplayPortDevice.232.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \347\r\006"
+	.string	"\244\n\220"
+	.string	""
+	.string	""
+	.string	"K"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\330\375\n}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\330\354\007y\276\003\005\001'7\b}\301\002\005\001'@\206\bwu\304'F\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\bVIRTUAL"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/cli/settings.c"
+	.string	"\004MSP"
+	.string	"\bMAX7456"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"6\031\003\213\001\341<\363\340jk\237Y7\250\374\006P\004"
+	.text
+	.section	.gnu.lto_lookupTables.233.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`)\006\205\030"
+	.string	"6\346\224F`\330N:\267\004\276B\375\016*2\303\315\342*\230\302_(#m\244\211q!3\001d\314\016\253\260 c\310\213\215(\276d4\374b\307W\346\364\305\216\357Hg\306\027?\376\247\373\216\207A/\2212m\346\244l\001\211"
+	.string	"\207"
+	.string	"|"
+	.string	"*\326\324\371\200\313\2125}B\020d\241\246P7\202\226\026k\n}%\374\271\310\351\235;\341\n\333X^\300H\365v(\360\261\335'\244\246{"
+	.ascii	"*T\031\312)\237\205<\266\245\020\255i\364@w1r\nx\201\256(\247"
+	.ascii	"\202/\206\3472\247\203n\2068\0329\035|5\264\261\355\306\314)"
+	.ascii	"\241{\263\241{\220}\3544\266\325j\330\330i.%\201\350\243\361"
+	.ascii	"F\253SE\030\027\250\330l*uS\037\217\375\203\354\243\021\310h"
+	.ascii	"D\036\006<\003\272\330\037\361j\301\260\236\033\200\300\026\373"
+	.ascii	"\"a\255\030\336K\352\034\213}\326XK\206\371\336\017\005\206\224"
+	.ascii	"\265\270\317\335\2412Sq\037\317\203\234\2658\352\032\210B[q\364"
+	.ascii	"=\340#m\305~\b\356\264\266b\277\267g\251m\313\370\317M\360\035"
+	.ascii	"!2\376{\025<I\204\212\001]\2748B\355\347W\326U\252H\"\343B\237"
+	.ascii	"4%26|\027 \232\3108\221\201\231\023\031+\376\214A\321\342E\267"
+	.ascii	"\201\230\024+^|\035|\t\237\272\220\273\257\272\325\257\256u\""
+	.ascii	"\347\272\221{\375\353aOr%\037;\331\231\274\211\207;\371\331\321"
+	.ascii	"\016\345j_{\333\335\016\367\270?\017=]\207\333qh\231\216c\352"
+	.ascii	"\234\326\344\341;\367\264&\021\345\330;\241\332\250$\"\316\315"
+	.ascii	"\233TN&\276lSmR\361\230F\245&"
+	.string	"\027\221O\2522\226s\315\254Z\354t\313\2602v\276\002\226h\255\370\211#\266\2251^\016\030{$\\m\027\316\013F5\210Id\264\"!\r1\225\253\fUi\264\n\025)\325#\2462\310\307\270\2341t\244DZ.\217\2249\306^k\266~k\270\226kgC{\256\353\332\256\2434^Oi*\255\327{\375\266\225\216\266_\003v\226\016\354-=\330\204\335\245\2754\230\016\323\205m\330d\272L\237\351\303Nl4\255\246\3274\233n\363\346q<\307u\\\351<\316\364\246\367\370\323\241\376\343@.\025\200\222\2501\214#`<\373wP\243\f7\007\020\020d\030;;#&\360\230\210\221\267JHf\007\325PZpJ%\326\264STSI\323\250\375x\027\325\026Z^\337O\2513q\304\035\271\025<\256*\351\200\332\370A\222\252\3706fp\336A;w\311\002':\361@\273\024\006n<\005(\264\344\207p"
+	.ascii	"(:\017\0134Q#\034\313\016\347\267$\332K\213\023R\312.\244\241"
+	.ascii	"\"!\300\2746\f\217\263\022\232\213C\333\n58\016\027\001\316\256"
+	.ascii	"X-\001i\2155N4\340T\254\321a\275D\255:\240\254\273\274SQd\203"
+	.ascii	"q\371+\331J\353Q\n\222\245\323\260U\005\032Q\343u>*"
+	.text
+	.section	.gnu.lto_valueTable.234.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`\037\276\3657\002\372\372\316\260Y0\n9\\\007\267\024\344\340\341U\r\n\033\205\313Q\no\030\224Q\251\026HX\253#\341\034@\272b\025wU\310vw)\223\322l-\333}\244-K\020\f\006\202B\321\n\001\213@`\b\332V\262m\3336\"\256\004d\270\304\261\214\b+\340s\034\307q\034\307\221e\267\224d\033\013-\013[\013C2\013\336\212\256\202\"\261\021^=\276|\344@\336\312\016\205\227\267\3411\334\032j\345@\376j[A\r\334\377p\207p\352&\250\352jh\225\273\370\253\264\n\\\250\240\246\275l=\224\032F\335\376\212K\301\033\334\377\360\251\004\216\034LHZ&\222n\330H\242"
+	.ascii	"\t\347\210\006\022\031O\016\f\243\030[\n^t\\\f\275H\343\356\004"
+	.ascii	"\265`\301\335q\302G\305\317\033\022\317\211\036\036\254\233\327"
+	.ascii	"\352Np\242\256\307\3040g\210\223+y-\272\t\\P\fG\fo\2066y\216"
+	.ascii	"\327\262\223@\315-\305L\rM\017\225\232O\207\017C\017X7\277\365"
+	.ascii	"#\001\214\262\237\241\313\220\303\360%H\002\2330\025C\226\251"
+	.ascii	"\357D=\3140l\301\242\371-!\n\335\025uwB;\354\232\337\"\242\320"
+	.ascii	"\225\005$G7gt\244#H\b\334\020$\n$Xp\333\204ly\216\337J\032\251"
+	.ascii	"[j\201\246&L\313y\374\026\331HWVHF\013\201\b\267\3022\354\230"
+	.ascii	"\337\332b\177\004_F\216\340\376\205?\230\026\b\221}\205\201\345"
+	.ascii	"1\236\213n\204\007\356_\350\303\205p\007-\334\232z\234Z\330%"
+	.ascii	"\344\302\336y.\273\221\020p\377B-!\017\rz\376b\252j\332\313\326"
+	.ascii	"\302+\241U^\343\301zF8\300\375\013\251\204:\372K\327a'\250\247"
+	.ascii	"\\\311\203\031A\333\210\226\230p q\025im$a\341<X\022T\t\306\f"
+	.ascii	"\244#2\240\030E1`\3441\036l\013\2351\022z!tq{\260\264g\021\270"
+	.ascii	"\377\317A\006\020\013aP~\344\301\270O\264\031)~|z\236XqG;<\302"
+	.ascii	"\023$>,\350\231\344\206T\002Gh\"W\362aDO\0375\032\"l\204#\220"
+	.ascii	"\236\036\312j\200\240\021\316\3442>\314\311\026\246\215\361 "
+	.ascii	"\354\220g}\030\231X\222P\203p\303\324w\242\026\276\b]\260p>,"
+	.ascii	"\315\t\305b\303\016O\310\222\227\003\371\260\256\363\350\016"
+	.ascii	"\b$w\243;G$H\227\307\3700;'\217\\0N\250\303J\\7!oD4ml]\247g\310"
+	.ascii	"\322\026M--\317z1#g\013\334\177\360,hF\323\305\0216\366\203\214"
+	.ascii	"\304\213!\261\301\375\007\305\264\230\202ZA\257i\227\252\203"
+	.ascii	">"
+	.string	"\202=H\274XR\263\007\334\177\260+\270eB\220\213\345\375\220\243\352*+\210\225\037y1\262\346\223\025\210\246\240S0j\332\351\352\340TP\n\013\347\305\266\315!\270\377 \324\004\236L\350\025Q\240\0024N7\226\230p\320\361\300\375\007\225\306\372\206\247\340Q\220\306\264C\325Am\260F\016\344\305\354\2323Hc\335\005*H\004c\332\313\326A\243\030=M\026\270\377`Q\027\021\305\"\353B(H\256\205\235T\020\305\317\212\240\nl\231\037\0232\013\2760\271p\377A\237`\n\274\251\356\3249\261c\301\217\031\211\345\350\270)\021$a\301\217!1\261l\250\202 \2024\301\020\301\032\354\234\037#c\326\200\373\017\316\200U\305x\350\320\315\302X\0055\004]\202\033\362\254\037\243c\352\300\375\0073\\\325\335\345\341a\321\374\230\235Z\360eYg7\205\005\354\312\321\315\365,\203\304\301lnB\336~\226Zm;v"
+	.string	"\317\322\202\250\005-s\240iy\036?\312\200\344Z\277\025Z\026\221i\001{"
+	.string	"\277\200a@\260\333o\227:>\232[Z\\[$~k\264\204\341\301e\205u\2054\007\367\017\254\362]QS@\251\334\305o\223\224kP^LM9\310\224>p\364H\272ac\253\204\322\372"
+	.string	"\032\315@:\"\361\333\264\0302\270\374\027p\bX\004$\"\361[%\317\0130 \020\220\0050\013l\201\235\363\3337e\f\334?0h\353\303R\374\370\344G~\333\225\203\373\007\242\020\303\3219\261Cg\006\367\017\314\371`\f(\002h\003$\001\274\311[\374\326.\2515\302"
+	.string	"d\037@\320\314\3640\301\375\003e(\370\001t\001r"
+	.string	"\306"
+	.string	"a~\222Dp\377\300\027\007"
+	.string	"\301\003\262"
+	.string	"3"
+	.ascii	"[\202\222;y$\224\315\021\251+r{3\241$\f\235\330\366mH\367\007"
+	.ascii	"w{3\"$\234\220\267\251\303\275\25256\256\321\217 gefhgH\310\253"
+	.ascii	"\355\005h`bd\277\261\374\310\233%!\223\302\002\220\266\325\325"
+	.ascii	"\303\213\f\231\345\022\200\232\025\326\216\254\255\316U\bA\240"
+	.ascii	"\244t\374\246\362\2547KC\312D\r`m\211\251\351\227#W\362f\334"
+	.ascii	"c\027\307\006\035\246\241\265\221\224k\275\331\333\021H\r\016"
+	.ascii	"\330~0~F\277\031?\031X7o\326=F\305\350\240-\353b\350\005\335"
+	.ascii	"\221\320\bn?+\202\200\362\026ofw\\\241\002\001o=\351\307\363"
+	.ascii	"C\361\353\3519\316\300\375\377N\b!a\"\007\347\347\256\004\003"
+	.ascii	"\206\320\204\030q\026d\\\253Y\202\213\361 \363\373\220\003\371"
+	.ascii	"3\"\343W\007\246\356/\303o\303\357\345\347\2024\005\367\377\323"
+	.ascii	"\360\024Ww\227\367\361\362\026\177\226d\244a\027\345\345\272"
+	.ascii	"rts\3309\177Ff\364\211;\233cs\023\362\337\260p\376lk\374\320"
+	.ascii	"FEw\226\026D\r\353\346\317\322\212C\320\254\210\214\375(\003"
+	.ascii	"B\342\317\270bd>|\021/\037`_$\036\255\2478\325\343\365\252\313"
+	.ascii	"\342\261\365\265\362\034\217FT|\261\203\314\333MQYUa\327<\232"
+	.ascii	"\021[\360\245X\243\003\210\277\313\3414\355P\365\207\372O\271"
+	.ascii	"\214GK\"\302\301\375\377&\317\3556\036/\351\306\322W\312}<\032"
+	.ascii	"\227\350e#\315\347\3118\242\201\204u\363hoB\202/\304\0333\202"
+	.ascii	"\260\274 \202\361\213\260s\236\333C\f\032z\271-\177\305g1\365"
+	.ascii	"s\365\317\376\026$\236+D\034\001\367\377\203>P\336[\2073|\024"
+	.ascii	"\337\347\247\310c<7ih\007\245A\347\304\016\031\027\356\277Km"
+	.ascii	"\370$\276\211_\"\007\362\334\355\020\f\356\337\317\271\204\030"
+	.ascii	"!\"m\212\356Ef\006\004\367\350\213\303\207\371\035~\314\333\360"
+	.ascii	"\207\303\207\371\031\376\206\257\241\033\002\356\377\267\374"
+	.ascii	"b\354\360\356r\255\347\322\rY\352\200\035\344\350\346\362#\317"
+	.ascii	"\265c\213\013zx\033\"\244\307\207\233\360C\020\356Z~\344\331"
+	.ascii	"~\204PjC\231\355\231\317,\327z\266 \241\2142\"\b12\337X\236\365"
+	.ascii	"lB\302\025a\305\031/\037\276\0369\220g#\022\336t\031ivh\3610"
+	.ascii	"\022fa\353V\250\254\252\260p\236\r\t\033\027|\t\252\351@\206"
+	.ascii	"x\212\202J\342\001\367\337\243D\340\310\341c\312}<\033Y\020i"
+	.ascii	"I9Bk#\t;\347\331\210\004_\202)j,md\034\315\310c<\033]\260\203"
+	.ascii	"Q\363f\250\210\350\366lvq/\234$Xd}-n\337\326\003$\203\373\367"
+	.ascii	"\005=K\370\250\360\375\344G\276\315\bX\005\367\357}\260u&\272"
+	.ascii	"\323\2673\365\235\250}=>\036$\240\f\270\377w\333+\300\326Q\200"
+	.ascii	"\301\361\215\270\231v\250\332W\302G\002{\347\333\260y\301\027"
+	.ascii	"`\020\334\277\317\246\307\223\027y\356\210\034\231\231\032\032"
+	.ascii	"\022\337\2266\002\304\215\216\357\005\246C\f\211o\343\002Y\340"
+	.ascii	"\376}\034\200vzy'\2754\332\3272\355T\265O\203/\003\211o{\373"
+	.ascii	"q\341\376},H'\350"
+	.ascii	"\212\330\325\321i\021\251\342y\203\213\353\3461\276\315\356\227"
+	.ascii	"4D\210\007}GO\017\355\244\227F\367\202L{ku\217\255\307\315\201"
+	.ascii	"\274[\320O\b\207Z\\\267B\001d[\226\267x\267\255\206\340\313/"
+	.ascii	"\347G\n0\261\260\334\305\273q9\004_~3_>\216>[\323\276T\367\272"
+	.ascii	"\270r\255w{\273\203\373\357i\375t\347UV\017+\327\372n\317_\263"
+	.ascii	"\352U\001@\205\017\242{QS=\251\\\311w\177\376\016\270\377\036"
+	.ascii	"T\357\211\203\236\257\300\221\203i;cI\351\004 n\215$m\236\343"
+	.ascii	"\345\322>\016\r\177gB\017i\004\275\240\030\323.U\367d\030\345"
+	.ascii	"1^\216\353!\370\3623\300\375\367`\364\210L\350\025\345\026t\n"
+	.ascii	",z@'\275 \272\327b\332\313\326=\027B\271\214\227{\233\t\276\370"
+	.ascii	"\266p\377\027\260`\371\265\350\361\234\364z\350^\212\336O\317"
+	.ascii	"'\317z;$\337\026\212,\"\331^\t\272\207\243\323\313\261\340\357"
+	.ascii	"\272>(\270\377\236\211\032\241\036\r\335\0131\355\211\250{6#"
+	.ascii	"\362\032\177g'\"\370\342K\202\373\177\227z5\271\315\312WN\"7"
+	.ascii	"\341\013\321a\027\332\236\007\231\017y\216\317\353\331\t\276"
+	.ascii	"\370z\340\376{\035\232^\220\365\\\246\375\253\356qx\311y|\336"
+	.ascii	"\017\212\340K\317\016\356\277\267a\0030L\337`h-o\332\241\352"
+	.ascii	"^K\217%\367\361yA*\202/\275\037p\377\036o\002v&\370;\nT\240w"
+	.ascii	"\nD\036\216\366rS?W{\"tB\275+\270\177\037\347\273yy\276\234\""
+	.ascii	"n\333\233[\016\344\363\222zJl\035\2067CSK##:\3631\310\200\374"
+	.ascii	"\310\263>o\333C1f\344\345\003\354\213\304\347\245\365d\340\376"
+	.ascii	"}\217/#\213\307\226\326\355\363\270:t\350\340\376\375\016\340"
+	.ascii	"\f*\253\252\374\310\347\275y3\035GMOQP$>\257\353\263\234\206"
+	.ascii	"HkJ8\226r\255\317\243\363J7z4f\320\320\326\310\201zM=,\202/~"
+	.ascii	"\b\356\337#\035\215 k\f\025\305\200\361\323C\224\324\006\265"
+	.ascii	"\020\312\346\331^S\220\213\340\213\257\201\373\367,:\3312\211"
+	.ascii	"'\305\324\373\324^\305\017I\257I\350\016\356\177\004E>\324\223"
+	.ascii	"\027um\036#\227\221\234c\332\3607&\246\036\247\366:>\347\356"
+	.ascii	"5\021\3654\270\177\005\224\360$\274\363\206\237\251\021\021\""
+	.ascii	"?\3525\031\321\b\276\364-\232\247\222\207\351\360\301{ \3515"
+	.ascii	"!u\034p\377>fd\351\356\244\343\321>\303\324k\250\275\213\337"
+	.ascii	"\220k{MI\271\215\340K\037\202\373\237\300\267\344\231\340Y\242"
+	.ascii	"o\024\320\350H\200\003\216"
+	.string	"\356s\323NW\367\"Dr\245\336\023R\004\202/\375\006\356\277'7\201\256\t=\216\002\025H\256t\177\037:\205_\377>\020Lkmon\026\350Am1\020|\3513p\377\235\215\373\026sh\317\322\320\356\036T\232\016\235\023zMd?\312\200\220\364\240\336L`\237S\327I\367\242\273\217i\377\252{\030\030I\017\252\233\201\340\213\006\340\376}=6\200\314\313\313\313\353\033\374\372\367\371\004\237\264;\264xp\240\007e\327\201\340\313\005\340\376{V\017\312\351\244?\321]\307\264S\325\335\252\312B\217\352G\207\216\007\202/$\300\375w\226\251\017@\305=J\356R\321y$\371\202\240\354Eu\347\257\377\256=\351ItW\232\366\245\2723YC\260\301\333q\334\037XB\355f\310\216\205\345\245w\350?%\370\342\341\3761\350\025\374\372\3577TV\272\r\021\214 \310\002\223\241\204\376\t\320\363_\377\n\350\360\257\3777"
+	.ascii	"\310\367\335\361\005*J\"\030A^#\211\251\305\256u4\262\003\330"
+	.ascii	"\300\3753i\030\315`\312 \351h\333\003\264\304\200\341Ts1\304"
+	.ascii	"|\221+u\264\264\021\322\340\376\231B\236K3\201\246\035\252f\262"
+	.ascii	"`\006a\335:\032w\004+\270\177\346\212\256]\323\242\360a\246\310"
+	.ascii	"\265\035\215n\204\244\036.Y\316\016S'?\352hv#\260\3001\243\231"
+	.ascii	"6\323NW3I0ozF(\001\367\317\034\301\fa\002S\004U\247\320\326\343"
+	.ascii	"\241\2312\323^\266f\3160A`\357:\227h\004\017p\377\314\017L\017"
+	.ascii	"B\267\027\030&\007\013\235K&\302\035\334?\323\345\215\311\302"
+	.ascii	"\314\300l\331\236\345\t)b\267\254\313c:7M\004+\"\357\220\356"
+	.ascii	"R"
+	.string	"n\031\207\205\353\\\256\bGp/\\\333\233[\356\323\271o\"\350\300\375/\331\200@o7-\210Z\336\322\271]\021<\300\375/\321\200l\313\350\354~\220\001\345\276\246\036\247^\206-\301\362l\347\206\300\006\367\277\364\261\354\021\234[rm\365\204\300\003\356\177\311\243k_:+\254\253\037&\270\377e\025\221\247\250i/[/\247\244\202B(\202\373_B\275Ep\344X2\221t6\241\020v\226\336:\255\215e\322\335\331\210B\200\201\373_\326\220\261<Z\316\300\272u6\243\nmp\377K#\017\263t1TD\204\024\366\242\202\240\026,\222*P\301\375/\201\336<!Y\212\237\245O\356\323\331\310*\024\241H.\321K\235\023\313\235<\247\263m+\330\300\375/s\2268\024ZlH,or\227\316V!\006\356\1779\"\003w\246fIc\241\263u\353@hXr\240\2271\323\016U/=,;\344-\235\215\316"
+	.string	"A\340\376\2270\033\350\350\345r\303R\303O\030\334\377\262\305\205\216V\332\341\335Y\350mAWuDLP\026\301\276\260t\n?\n/p\323NW+\343\224]\354]o32"
+	.string	"\023\334\277r\210\362\315\004\245\220\\\003K\247\360\343\240L\243\225kl\\\013\275\r\311"
+	.string	"Fp\377\312 J\265;\226\016\377`n\231\231r{w7$\003\360"
+	.ascii	"\211\351A+\303\306\224b\271RwK2\300\013\334\277\022\254CW\017"
+	.ascii	"\245W\336\322\335\322@\210\343\362\220\305cG\256\355n\3342\254"
+	.ascii	"\017:\252\224T\271Kw{\003\241kJ\306\tJ\371\204\235\353n]\020"
+	.ascii	"p\300\375+A(\341P.Y\350nt \304\200\373W\336P\036\345E\311\030"
+	.ascii	"34\264\312\032y\266\273\331\201\360\203\244<\002\243\271\243"
+	.ascii	"\225J\243\030= \204(\252\021z\241tA\322\273D\037\340\301\375"
+	.ascii	"+\263!V\004)\201r\240\3365\372\240M\305O^\364\263\032\"\202g"
+	.ascii	"\352\347j%\212\036$0\270\177\345\t\345N^\324\265=\232\021%\246"
+	.ascii	"}\251V\342(M\344G\275\233\364\201\024\334\277\222\304/K+CL;T"
+	.ascii	"\255\034\241\024\201u"
+	.string	"\353]\262\017\206\340\376\2255\371P^\324\311n\212E\224\036\246\312\017\265\022\204R&\327\366n\367\203\035\032e\007\022J\027\016\312\027lW\357\332}0\002\356_\271\241D\236\262E\311\322\363A\007<\023fD\352\212\374\340\321\315I\200\323\235C\272I8\013=.\310\2037!9\334\266$[\236\355qB\036\374X\323\361:KC#\322\202\373O\232qw\310\200\3740\222\032;\321\235>\300\276\220l\364\340\351\322\342\332J\212\301\243\307\n+y\225\273\36482\017\200\252PDM%\245\260w=n\353\001\016\334\177\022\252kS$\227\230\232\2229\362\232\036\227\346\301\f\334\177\022\307\020\366Y\323\332H\342z\340\002\367\237\254\361\003\354\3128\232\221\003\365\270\2678\270\377\244Q\022F^\224\214\3216\325a\0250.\206\222/\260e=\256\2035\270\377\244P\026^\241b\232\\Q'\203\222@w\227\353\351\200\013\356\337"
+	.ascii	"?I\037\n\200NL{T\235\354I\362\3441]\356\247\203\033p\377\311"
+	.ascii	"\235b\221\240\022"
+	.string	"8I\023yK\227\013\352\300\005\t\026!F\210\020\352 \247\246\305\032\235\3740\365\325\250\223 \22229P\227#\352\300\003\334\177\322C\262C^D\244\261\312\"\357\350\244\313\264C\325I\016\311\227\\\333\345\222\n@\004\356?\271!\210\"/\002\212\020B\336\321\310\274\251\237\253\223-I\026,\\\227#\003\002\367\217\3043v\272\"D\270\\so/\206t\221p\271K\227{+\300\024\334?R\b\362\215eh\206F\256\261!\271\330\273.\327-\200\r\270\177d\020\244Z7\"\332\236\231\345G}\256\247"
+	.string	"-\312\200.yQ\327\026\r\321H1\262\261\237\002\210\b\203\241\365\362\321\303B\237C*\200K\027W/\006Y\026\217\035Irp\377H,\344\225\317\250k\212\n\251#o\351sd\034\230I\311h\232\366\2625\362\t\351\224g\373\334\226\003\256\0343n,!\225\260p}.\215\003%\033G\335\t\251\006\222F\256\324\347\270\034\2548\252\242\2210\214\2201rm\237{\343`D\021\r\241\027H\027\330\262~G\307A\207\354\257\254\306\212  \013\375\316\216"
+	.string	"v*\264\305\"4\262g\332\227jd\n$\212\036\002\234\301\375#y\222\2648:\310\234\374\250\343\t\021\200\007\334?\322\204\037\262\301\0351\355ek\344\r\322&\317\351xF\0048\202\373G\212\270\201\244\231\301^u<\244\254\340\013\001l\340\376\2212J\310\027\032\t3\355P5\262\0032\006\313\243\343%a\267\202/\033\244\301\375#9\364\350\226\216xH\226)\262\245Fj@f\260\320\361\3366\360\001s\314\363\305\275q8\262\210\324\025\301\316u<\273&:\246?\005\027w\354b\347z^\317\006/\340\376\217Cr@\261\271\265\221\364\274\240\rp\270Mhji\271\266\347\tm"
+	.string	"s\3464\367\243\f\310\335\363\210\340\310T\306D0\202\374\263\371\230\372\312\352#\330\227\021\031\334\377\261\307\321\013\252\223\361\330:j\345@=\017\t\306\332Quu\264\"\351yIp\022\325QG^\324\265\026\364Hex\212\202\"\203]8M-1\035q\334=o\013\227\200\373?*\351\2501\035\326\325\307$m\032\354\002\367\177\244qDjRY\305\220a\304e\203\373?\302\350\221u1t|\221\037\365\274\267\001\370\200\373?\n\035\263y\221\221\005\221\325\361\347\270\342\030t\004\312cz^w"
+	.string	"Lp\377G\025P\375\212\007\305\261'\317\366<\272\001\3048\201e\"\347\210\223\327\364<\273\001\004\301\375\037K\364,\0216#znB\370\246\035@\027\231\231#\210\237\001l\370"
+	.string	"\004\342\201\307!\346\b\203u\363MA\032\004\201\373?\276\374\254\216-S\237Z}\324p\314\220\273\370&!\r\304\340\376\217,\306\274\274\b\b\324\267\212\330\325\021i\220E$\005\227\261k\2243\306a\347|\223\221\006Z\270\177#\234\367\3522r\215m\3067\243\333\355\233\2204X\001\367od\373Y9y}45cZ\336\342\233\2224\2609\353\332\036?\312\200\220i\340Bf\034\203\366\334\207\321\313\007\330W\016\344\233\322\004\020\007\367o\354\221\325\341\2573\036[Z\330;\337\364\226\266#\253\00206*\253\252\\\353\233\272\\:\246"
+	.string	"\020f\314at2B\031\237H|\023\235"
+	.string	"\230\340\376\215M/\017\261\244\033KJ\026\274S\217\221\215^\025<vD\303\210\204\275\363N?\002"
+	.string	"\232A\266T\024\303\b\303\202w\n\022\200\t\242\037?\032Y\027F\241\\\353\235\204\004\300\241\005\213\274\b\b\004L\003\362\263B\005\321\034\334\277\321\307\230\242\333\313\2149\306\035#\217\361D\016\344\235\2222@\203\3737\352"
+	.ascii	"\257\266D\0227%\214$\260p\336\211,\003,\270\177\243\215\3672"
+	.ascii	"3\2020\322L}q\2651\204\261\006\353\346\235\3362\230\001\367o"
+	.ascii	"\234\361M[\375,f\352S\253\215\036\214\035r\037\357\324\315 \007"
+	.ascii	"\356\337\b\343\233\320\200FF\r\323a]mt1n\310\225\274\023]\006"
+	.ascii	"\031\340\376\215\031\214-\026\244\025\211\024\355\360\212w\371"
+	.ascii	"\221w\262\013\200\033\334\177\261\256X\204BWW\353\312\305\005"
+	.ascii	"\235\301\005\231\321\366\346&\024\306\2666\224\026D\215H\013"
+	.ascii	"\r\310\266\f\333\345\237\214z\004_\002\240\343Gg\003\023\013"
+	.ascii	"C\312\361\325V\324\342\362\352J\322n\t\335\232\256\262\260\310"
+	.ascii	"bX\3657)\035\305)\354\227\177\n\013\276\004 \033\325\205\344"
+	.ascii	"pj\262\200\177J\373a\032rcC\351\206\005\374\023w'\t\256;\217"
+	.ascii	"h Y\300?\275\335\314\350\316\242\251O\255.\306(\302\260\200\177"
+	.ascii	"\352\006`\206\2508\204\304\212\353\316b\213\242P1\213\235\363"
+	.ascii	"Ov\030\020a!WL\361\263\242\250\"\217\361P=\030\374\360\231`\016"
+	.ascii	"\370\241\270S\344)\236 \361P?\030T\301\375\027u:\235[\221D\321"
+	.ascii	"D\261\004\366\316C\ta\260\004\367_\274\361MD\20085\"\212!n\017"
+	.ascii	"e\204A\026\356\277HS\234\351Ez\221\376T\3540\035\326\325\305"
+	.ascii	"\017E\017X7\017\205\204A\r\334\1771\246\256\270\241\370Rt\311"
+	.ascii	"\265\036j{A\036\334\177Q\003\260G^\324\265vD;"
+	.string	"\"\336\324\027W\027Y\210y\371\221\207J\273\200{\347\233\276:<G\204.W\362P\334\013x\310\341\021\333\204\300\r!\361PoJoD\267\274\310s=\b\353yD4\265\265 $\236\252\347\202,\334?1M\215E\006\220-\261\f;\347\251~.\260\201\373'\376h\371/\300\304\210a\271\213\2472\272 \346+\203\026\227\027\261\013{\347\251\220,\260\333b\323Pu\225E\304\312k<U\222\005B\254\3326\020\237\242\246\210R\271\326S\221Y0\006\367O\204\002\272y\027\0349\230\362\254\247\332Z\200\265\364B\244\241\265\221D\342\251\336,H\202\373'\326\360\\!\034\214\246>\267\2328\203(#W\362T]\013|\340\376\2111\2100(\270\030zq\373\252\036\013@\300\375\023\205T\262\"\030A0\217\001vi\342\212\351\260\256&\006\021\201\362\034_\365\003\200!p\377D\025\035\210'zR\020Q`\321|U\020"
+	.string	"\262\340\376\211<cf\036L\344\020qH|\225\020"
+	.string	"l\224 \222\300\372@\2349\001vib\210\251/\256&\216 \212\270}\025\021"
+	.string	"\202\340\376\2115D\232(4\031\230\016\037\210\036\362\254\257\002\200\t\270\177b\314\032\b\"\313\t\260K\0235L;TMt!n\300\272\371*n\005yp\377\304\f\304\026\270\231\341\\\221\351\260\256\036\336\331\345G\276\212\216\013\367\277\301\220\310\220\256"
+	.string	"\032h\216\206t\341r _\005\006\367?\0242|\253\271\261\3066\344\346G\336\252\247\002\251 >\231\020\300.=4\233\372\342\352!\332\360\f[\346\255*P\202\373\037n\177V\"\306~\0044\2005\200J\300%\240\023\360\t\250\003H\005\314\002\356"
+	.ascii	"v\001\275\200b\3001\340\026h\006\\\003r\201C\200p@\"\300\"A\226"
+	.ascii	"`K\360%\310!\370!(\023\024\021\034\0214\021\304\t\362\004{\202"
+	.ascii	"@\301\240\340\213\340PPFpF0)h#\230#\330\024\324\021\244\n\356"
+	.ascii	"\b\362\b~\005\301\202@\202e\301 \301\265\340\220 \\\260H\260"
+	.ascii	"N\330\"\314 \344 \204\021~\020\312\bk\204!\2047B\022\302\034"
+	.ascii	"\241\216\260G\210B\250B\270B\330B\230\025\016\t\211\204FB\031"
+	.ascii	"B\032\302\032\302\033B%a\016a\2230J(%\304\022f\t\275\204=\204"
+	.ascii	"b\3021\241\231\360L\030D"
+	.ascii	"\270&t\023\276\t\273\3028!\021a\021!\2360o\250a\270a\b3\214\031"
+	.ascii	"\312\fA\fC\fE\fI\fK\fu\206;C\024\303\024\303\025C\240av(4$\032"
+	.ascii	"\026\re\fg\fk\f\265C\245\341\322\260i\3504\234\032\352\030b\r"
+	.ascii	"\263\206\\\303\256!\3300l\bdX6L\033\252\r\333\206n\303\270\241"
+	.ascii	"\334\020o\230G|!r \312\020A\020m\2107D\035\342\016\321\207\370"
+	.ascii	"CdAlA$\"\026\021\217\210H\304\033D%b\023\321\211\250\203HE\334"
+	.ascii	"A\344A\354A\364A\034#\222\021\315\210gD.\221\215\330%\306\021"
+	.ascii	"\213\020\353\212-\305\fE\016E\230\242L\021DqD\321\246\210S\314"
+	.ascii	")\366\024Q\024\201\212AE\027\305\027E\243\242\214b\215\242\266"
+	.ascii	"\270T\304Q|*B\025\251\212U\305\035E\036\305\036E\037\305\261"
+	.ascii	"\"Y\321\254xV\\+r\213B\212C\212sE\272b\236\221\305\370b\344`"
+	.ascii	"\374`\2241\2120\2160\2320\342\030{\214(\214@\306 \343\013\343"
+	.ascii	"\220\321\310(\303X\303\2505\34202\031\243\214R\306+#\226\221"
+	.ascii	"\313\330e\f3\212\031\267F3c\020\343\232Q\210q\210q\316Hg\274"
+	.ascii	"3\342\0357\034]\216\035\216\036\2164\307\232\343\315\221\304"
+	.ascii	"Q\347\270sLq\3649\2628\2668\022\035\213\2163\216GG\033\307\033"
+	.ascii	"\307\034\307\246\243\324q\352\210u\314:r\035\273\216aG\261\343"
+	.ascii	"\366hv\fr\\;\276\035\205\034\345\216sG\273\343\035r\003\322\005"
+	.ascii	"\351\001\371\001Y\203\f\201$\201,\201\334A\236@\372 \177\220"
+	.ascii	",\220-\220CH\"\244\f\344\f\244\026\231\204\304\201dBB!\243\220"
+	.ascii	"UH+\244\026r\013\371\205\004C\376@\002A\242!\323\220mH7d\034"
+	.ascii	"R\016Y\207\264KfHjH\302$c\2223I\232\244M\362&\231\223\324I\242"
+	.ascii	"H\246H\262H\266H\022%\213\222HI\032\311\033I\245\244S\362)\251"
+	.ascii	"#I\225\314J\356Hv%\275\222aI\261dYr\233TK\006I\272%\337\222q"
+	.ascii	"I\271\244]\362N\231A\251A\t\243\214Q\316(i\2246\312\033e\216"
+	.ascii	"RG\231B\351\243d\241l\241\034R\022)e(g(\223\2246\224L\312\034"
+	.ascii	"\312(\245\224\322Jy\245\324Rn)}(\277\224d\312\037\3123%\232\262"
+	.ascii	"M\351\246\224S\316)\363\226,K\227\345\313\362\303Rf\031b)bYb"
+	.ascii	"ib\311\263\354Y\252X\256Xf\227BK\030\313\030K\244%\215\345\215"
+	.ascii	"\245\322\262i\351\264\324\261\244Zf-w,\273\226^K\261\345\330"
+	.ascii	"\322ly\266\\[r\227B\226C\226sK\272\345\335\022\217\251\201\271"
+	.ascii	"\201\031\303\354\300\244a\3260K0M0O0y\230?L\025\314\026\314,"
+	.ascii	"\223\210Y\304<b\"1m0o0\233\230N\314)\246\016&\0263\213\311\305"
+	.ascii	"\354b\2061\305\230e\314-S\215\031\204\351\306|c\3061\345\230"
+	.ascii	"v\314\273f\206\246\206&L3\246\t\2429\323\034\321\264i\3424s\232"
+	.ascii	"<\315\236\346OSE\223E\263E\363Es\250\031\243i\324Dj\322h\332"
+	.ascii	"h\336h25s4\241\232QM\252fU3\253\271\243\311\325\354j\2025\303"
+	.ascii	"\232e\315mS\255\031\244\371\326\024\322\224k\3165\355\232w\316"
+	.ascii	"\fN\rN\030g\214\023\204s\3069\302i\343\314q\3528Q8S8\201\234"
+	.ascii	"A\316\027\316!\247\f\347\f\247\r\347\rg\223\323\3119\345\324"
+	.ascii	"\341\304rf9\275\234=\234b\3161\247\231\363\314\311u\2629\207"
+	.ascii	"8\341\234tN\"O\226g\313\363\345\311\341)\363\004\361\034\361"
+	.ascii	"\264y\342<s\236=O\024\317\240'\213\347\213\347\320\323\350)\343"
+	.ascii	"Y\343\251}\342x2=\241\236Q\317\252\247\325\223\307S\353\331\343"
+	.ascii	"\351\343I\366\374\361L{\252=\335\236o\317\270\247\334\263\356"
+	.ascii	"i\007m\201f\200r\200\302@e\240 \240\"\240#\240&\2408P\036h\017"
+	.ascii	"T\005t\005\324\005\364\0054\006\324\bJ\003Z\003\272\004\305\001"
+	.ascii	"\205\202FA\253\240VP\036P-\250\017\350\027\364\007\024\b\024"
+	.ascii	"\r\232\006m\203\272A\345\240sP;\350\335\210\206\221\r#1#\035"
+	.ascii	"Ff\01602b\304f\004g$g\244g\004\305\b\320H\320\210\213\221\027"
+	.ascii	"#1F\214Fh\2140\242$\002\266j%\212\005&C\t\336,\351\206\215\374"
+	.ascii	"\250[\275\335ik\210`\004=\2371\355P\365\b\322Q\017\027\356\177"
+	.ascii	"D\206\277\031!\032\2011R\224\037\365\253\240\t\364\030\352\265"
+	.ascii	"\020\032\311\nM \212\205o\346g\332\313\326#+T\220\364+\243\t"
+	.string	"\030\301\375\217\370\214\244X\376\256\035\236\221\023\271\266_!M \205\316\217\204\211\022d\023\bq\003\254\0211\022\202\244_m%\200\007\367?B\363\001\304\210L\016\324\257\322$\320\346A84\3622\0023\302\201\244_q%\340\003\356\177\304e\204e$\303H\313\335\257\272\022p\312\303\313\213~VP$\"\221i\207\252\241uE\362\230~E'\001\027p\377P\272\"\\\\7o\351Wv\022\320\031\362f\002T\b\206\022\3004\343\032\033\224\213\235\353Z?\022x\t\242F\341\270\205\236A\315\362\243\256E\024\0018\270\177h\031R\214\f:F\322\265\"0\006\367\017\r\203\202\345E\306\024\310\023\311\256\036^\330\273\256\265\215\300\016\256\255\t\224X;\262\356\276\025d\343j\212\n\252\343\356[B\021\b\202\373\207J1\233hh\323\023\324)\217\351[F\021\240\201\373\207\346\2002m\320\264\001U\202\336\260\320\267\266\021\310"
+	.string	"\367\017M\202j\211\332\031S?WC\221\240G\271K\337\352B@\016\356\037*\203\bFQ\016\324\267\350\316\206\240k-\246\235\256\206\ne\363l\337\262\353\202\373\207\262\200\002\231"
+	.string	"\r\322\352\024F\236044\305\364\031VC\177|\202\236\340\376\241((\350\234\200\356\3445\235+\t\002Z\270\177h\216\0047%\240$\310 \220\265\241\t\001\255\311[:\327\026\00283\024t\230z\r5\364\003\324C\236\355\\\020\360"
+	.string	"\367\017\255`\211\206n\230z\234\032\372\002u\301\336u.n\txp\377P\r"
+	.string	"\360\302\203\262\344\275\265\335\321\025!\222\267t\256n\tas=\027\f\351\302\345@\235\213\256\204*!\030p\333\330,t.;%\270\377\347\3323\2101"
+	.ascii	"fO\264\347Y\336\322\273Jx\001\367\377\334>\201\230\360,\203#"
+	.ascii	"\302\312`\211~\202M\237a\365sL\354\247\204\235\034\317/:\001"
+	.ascii	"h\271\246\036\247~zuY\350]H%\314\300\375?\267T\260vd%\341]MQ"
+	.ascii	"=u\344-\275\213\0046\270\377\247T^\324\265MS\357S?\237\236N\271"
+	.ascii	"\266w\221\360\005\367\377\314\221\017\335\230\366\262\365sI)"
+	.ascii	"\215\n\356\377i\343\231T<z\322x\"\345\331\336\305%\301\306\f"
+	.ascii	"\240\b\016\212\2361\2360r\240\336\365F\202\013\270\377'\321\017"
+	.ascii	"\212~f]<\205\260w\275\253KB\017\334\377\263E\007A*\200\236+\260"
+	.ascii	"_\035\354\207\204\022p\377\317\237g\212\274\350\351Cd\374\361"
+	.ascii	"`\207\347D\220\214\316\0073O\022S?W?M<K\b\221\220\001\356\377"
+	.ascii	"y\003\202\237\361\254\231v\251\372)\342\031\302B\007#\352\302"
+	.ascii	"\375?i\2363\006x\302<;L\373R\375\374\360\364\200\205\353`F\017"
+	.ascii	"\b\203\373\177\306T\3600\364S\303\323\345\271!w\351`H\017\310"
+	.ascii	"\202\373\177f\370m\335M\273T\355\314s\342a\357:X\322\003\232"
+	.ascii	"\340\376\235v\316\"&8\353t\266\"\304"
+	.string	"M\373R\355\234\223\303\336u0\262\007\034uG\200\341&\304\371\226\373t\260\007\350\300\375;\333\016\240\266\346\f\222\327t\260\264\007\324\244\241%\021"
+	.string	"d\353,\263\320\301\270\017\320\360\203L\231\200\2570\260<\333\301\336\034\320\205\373w\372\340*`\307V\227\223+?\352`v\016\370\241\305\343\002\r\026Pu\345\264\302\302\365\260\036\007LQAI9\243\362\234\036\366\343\200\027p\377\316\247\006\340\310\301\024\344"
+	.string	"\233%%\f\034\340<\252\221\344\324\346J=L\250\001v4\220\002@\200\007\3000\212A$\006\367\357,r\022e@\202\223E\326\205S(\227\351aF\rX\202\373w\266(@\t?+T\344-=\214\254\001Cp\377N\237\245\023=N\236\\\333\303\266\r\330\201\373w\356"
+	.string	"\273/\216\0228N\023y\266\213\t5"
+	.string	"\004\334\277\223\204\363\206\t\247f\332\313\326N\021\316\020yK\027#\272\203\373w\322\344p\3128?`\307\272\330\226\001ap\377\316\016MN\027\016/iXp\377\316\rN\277\262<g\213\223\005{\327\305\030\220\003\357\t\206n\022\251+rw\2617\006\274\240\203\213\353\346\332\276\rb\200\016\334\177sH\024\333\324\343\324M\267f[\336\322\267B\f\360\300]\373Rgihw\337\022\311\301\3757\315\246\310\2004\177\344\331\2765Z"
+	.ascii	"\032\334\177s\254)\366\323\201\274\353\361\325\364\221\347\364"
+	.ascii	"-\322\002t\300\3757\275\250xli%-\300\b\252\312\n\253yu\367-\331"
+	.ascii	"\002x\254\244t4\247r\237\276\335.`\303U\323\223SZ\033\226\022"
+	.ascii	"\216%\256WV\215$\355\233\002\230v\3108\232\321\315\362 \202Q"
+	.ascii	"\204\205\353[:\005\214\250\323\312\272\020\302"
+	.string	"\316\365\255\035^\334\326\212\240&P\036\323\315z\022p\346\306\205\302\247\231\"W\352f?\t\250R\353\352j\236h\356`\347\272YP\002\216\274\350&\t\023\315\022X\270nF\224\200\036\270\377\346M\217\032\021!,t\263m\b\032\0373\036\2322\315\017\026\272YZ\0026th\272L\375\\\335\344\320|\301\336u3\356\034\334\177sC\336\264\227\255\233-M\226\\\333\317\266\b0\303\013#RW\204\244\237\245! \213n\016)6\244\013\227\003\3653.\016\270\177\246\020\"\315\030\267\215\311v\367\2637\004\b\301\3753\327\200h\346Y\032\032\366\256\237u\021\300\003\367\3174#\373A\006\344G\017\002f\340\376\231c@\214I4\323\007\330\327O\036\334?\263\007\323+/\362\334\re<\266\230Z9PG#:\200\333\216\255W\325\225\025IG3\372\2422\203\222\212B:@\024\334?\363\tG\016&\023v\256\243%\035"
+	.string	"\306R\257\311\225\032G\253+wRY\241\302\t(!4U\344\2258\371\342\321\0317\261\347\013V\347\273\254\322W\346;\337)\261\025/6\2338\2256\201F\243\262\361=\001%6\271\022\2215m\343\321\250\234|O\344zx<\221\353\"\362D\256\221\306*M\215\316\322j\tM\225\243\361\211\\'\215\364\365N*\337\331\226U\244\266\2142\237@\337q\211\214\037\337\233\266V\221/u\276\020\233Dc\253-\227\024\337\250\035K\351\0328|\247\321\031e\370\032\337\373I\304\213s-\333&q\324\276%x\207/J\324x\265\243\366q\371\236\200\362|O@\231"
+	.ascii	"O\271V\351\021\371\002m\317\322{\256V\360\336\363l\237\314\322"
+	.ascii	"\030\003]\307\027\256&\311\367NQ\276R:\306\351j\312\361\305o"
+	.ascii	"\331$\016\201\212\301\276mZ\266\240JG\347;\005\203]\304`7\337"
+	.ascii	"\370\252|\223R\333\032\235\355\343{R\245\245\326hu\216\347\013"
+	.ascii	"4~\225\245\362\004\357-\245\257v\363\225\340\305\345\222\023"
+	.ascii	"\271\306\251V{\345$\032\225\241\357=\362\336\327\223\330y\225"
+	.ascii	"\243\326\222iT\246\226<\215\030\344\332\370J\253r][\213o\255"
+	.ascii	"r\215\245s\264\272rWS\342\371NQ\276Ld\255\322|\357\231j-\276"
+	.ascii	"s\nU\276`\333\326hl\243\340H\344\273\"S\227N\025+5\246\340\235"
+	.ascii	"\355\024)sd6\221o*-\233PP\276K[\266\226$\251rIM\237\024\337\025"
+	.ascii	"\234\216\312W9\032\343r\211\361I\245\246\230@\253t\375|o\372"
+	.ascii	"\236\355\031\277WP\216\257=\343s}\244p\341\216\347;%\211\333"
+	.ascii	"3U\216q\271$\312lR\220Zi{\276\342r\t\235\224\300\266\232\304"
+	.ascii	"v\212t\002\"-5\276\366LS\2574NM\251\223\262<S\345\350]|/\340"
+	.ascii	"r\t}\253\310+#\257\212\225\232\244\3126\2362Wc\251\b\304W*\202"
+	.ascii	"\363U\261R\215/\312\t\215\"\025\3418KEP\276\363MM\271\306\366"
+	.ascii	"\214W\347(\263V\271\"\225\257\365\202=\337\325\224\230\266\361"
+	.ascii	"\345\213\333U\232\202\224\256c\033\005\017\332(\367\214\3136"
+	.ascii	"\321x\214\026\207\304\327z\3050\307*\362\212\220X\274c\025ye"
+	.ascii	"8\225g\273$\226\2578R\276\342\302&\224J\265\332I\245=\343Q\331"
+	.ascii	"\226Q\2421n\265\226\314\266\362=\001\345\232\022?\337+=\215\353"
+	.ascii	"\2504N\251i\342;S\251r}\027c\374\266i\223\270j\215\251r\364\371"
+	.ascii	"\332\263\224\276`\265\257\361}=1\336rI\362\225\246\310%\361}"
+	.ascii	"=9\276\326\231JS\345\023\fVj\311\363\235\243U+>\217\210\020\317"
+	.ascii	"wJ|_O\224\302WZ\225K\244\362,\215U\344\025\343+\235o{\2760\333"
+	.ascii	"*\362\212\363\255\255\325Y\032\337\367\034\265\332\313\352|a"
+	.ascii	"\266\257\023`p\201\306\243\362,\215ML\254\363T\306\343\025YE"
+	.ascii	"\256\246\330\035\030\253\364\t(1\006\271\216M\256\324\270\272"
+	.ascii	"\"u2\245\312\346{\002J\034\302\362=\001E\212D\211\342\326\252"
+	.ascii	"\224)\245\217\257\034K\351k\023\272\224\332\262\212m5\221\316"
+	.ascii	"\263\t4\032\225\207\322\023\345+\245ZQ\356\231\266^\361\371\246"
+	.ascii	"@|Wd\352,-\276\316\267\231|W\354\371\2025:\333H\031\267\"\337"
+	.ascii	"\242\222\371^S\244UZ\305\370\3323N\027_c\235rK\351\253\362=\001"
+	.ascii	"E\305J\215U\344\025\344\213|Rx\357:\226\3123\212<\265Z\251\022"
+	.ascii	"\2747\215A\036\261\347*-\333xl\265\243\362\362J\007\203&\301"
+	.ascii	"+\r|\201&\300+\375{\177&?\347\213\202\237Tg\033\277\241o\325"
+	.ascii	"J\343\314\371\302L-\276xt61i\342\366|\3050\3078\225\306\343\252"
+	.ascii	"\365\004\332\266\242PP\332V\333\236G^\023\023+\236\022\215\357"
+	.ascii	"\022\231\371\306\363\235\302|1\310\324\331\236q\331>\231\361"
+	.ascii	"*\355$\026_\025ye\250|\347hU\276 \225\245x\312\025O\2612_\274"
+	.ascii	"\232b\215Z\361\024\031\237\357\331\216U\254T\252<\301\213W\347"
+	.ascii	"\250=_\355\371\344\204\266\361\013N\2522\363\255\322\362I\334"
+	.ascii	"|my\256\322\324\030\277Sl\024\374\210Wg\372\256\3126N\341\275"
+	.ascii	"\336\361\214\313T\353\325\304d9\245\257wlb\202|q\272\246\251"
+	.ascii	"\361\214\313&&\313\027\277\255\326\222\330\304DXSq\343\213a\246"
+	.ascii	"^S\244&T\031%\256\2518\362\305\253t\214[Q\220oM\305\343*\035"
+	.ascii	"K\351+\361\235\355\346\004\3249\305\004\303\312\tq4*\217\274"
+	.ascii	"\024\336\223\252\225\032\3432UZM\261\332'\027\274\024\274\321"
+	.ascii	"{\256\257\366\004\321{\316\300\236\245+6>\3273u\306-x\2453\036"
+	.ascii	"\235\361Y\n\225\332rTz\027\337\033\247\253)\261\364\266\016\337"
+	.ascii	"\223*]\3332\225\232b\022\343\326*U\216\3228mGc\034\227K\354\371"
+	.ascii	":\317%"
+	.ascii	"1UN\271\351\013(\267lG\243\367|R\245Qp\253\265\276\343\250=\233"
+	.ascii	"\310wL\245e\023\252\325\306\253\326h\214\022\255\246\310TkU:"
+	.ascii	"SK\344\224\350=\333\361}=\251\340h\313*O$T\216\036\251\362q\216"
+	.ascii	"Ve\374\246\245\327z\306\231\265-S\345\350=\343\364\225j\265Q"
+	.ascii	"d\034E\256\020BM\343\302\222\013\364}\333Fg\205\270\246q\\\256"
+	.ascii	"i\374\236\343\223*]\245\345z\266/\220Z\353\025\252\311\nN_\220"
+	.ascii	"\355\223\230\306\253\262\223\212\343V\033\005W\306\030\360\013"
+	.ascii	"\267M\313(\367m\265\243\314;F\221Qd\"^\235m;%ZU\221mi\214\"/"
+	.ascii	"OdZ\032\333V\334Z\343&\262\035e:\347\353\262j\245\306\367\365"
+	.ascii	"\004\227\251I{\256\255(K[.\211\357[\276\326\326hS\232\202\323"
+	.ascii	"8UVJ\351+J\024\247\227\362J,\245\257I{V\261^o\353UJ_GN\252t\325"
+	.ascii	"\226U\2248\325z!\246R\347h|rA\246\200\323\327\244\034S\255I\371"
+	.ascii	"N\211\237\322\271\266\345\233\226\236Ti\251<\243T\225V\332\226"
+	.ascii	"/T\221\327\032O\206`\266M\342\347IU\266c\274:\327\024T\254\266"
+	.ascii	"-\307W\232jr\247\234X\251L\223\231:\301{[\257\024Xi\251l\307"
+	.ascii	"+2\325\236/X\343i\224\306\357\n$\240)\314\265\\\275\255\327\230"
+	.ascii	"9\343\2624\216\342v\205\020\342\232\306\245\327;\306 +1\310q"
+	.ascii	"\225\256q\271DZ\235W\354\031\307\345\022\372\276\355\270Jc\220"
+	.ascii	"k\024\271\216\245\363\235\202S\345\030\203\\+_\f\326\343k\255"
+	.ascii	"\306%%s\324\266\232\304'\327z\306\237o}\265\343\350=\307\030"
+	.ascii	"\344z\005\247\251rJ\b\342i\225\246\306U\272\226\300Y\323x\363"
+	.ascii	"\265\355\224h|\200\005\\\2271\006\271\216q\031\277\213\025B\230"
+	.ascii	"k\271\032\213\020\317T\332\304j_\231\357\325*E\211U\254(w|\343"
+	.ascii	"\362\035\337\327\223Xz[\241\357M\235\253U\031%\032\265c\351m"
+	.ascii	"E\276w\224\306o\032\227\361;\236\3362\236|g\251\265\216ORJf)"
+	.ascii	"Q\345\216o\353\025\001\361\214\313\266\362\235\243\262}\022\327"
+	.ascii	"\266\034W\255\261\255rU\2763.\333\361|\002]\323\370\325\032\333"
+	.ascii	"35E:\243D\357\021\2525\212\337) \220\312\261\212\325\236\340"
+	.ascii	"\245\312\264=\337\320\367\236q\332V\211Q\242\270\\\022_\357:"
+	.ascii	"\306m\353uE\246^oZZA\225\216\2453\365\370\236\320&Uk\324\370"
+	.ascii	"b\260\226\304V\272J_\207\357=\301K\225/\3303^\245c\374Z\3178"
+	.ascii	".\307\027fi\214\323U:\203\267j\245o{\276\020S\255Q+n\265\257"
+	.ascii	"\022\274\263\235\202\313\263I<G\351\013\2634jW\250P\241B\205"
+	.ascii	"\n\025*\314\327\025\374N)A\276wJ\t}\275S$\020\r\201>\276\367"
+	.ascii	"=\333R\251\034GC\240m\353]\235\357\346K\245Z\355\345\213\022"
+	.ascii	"\305\351+\363U\221W\342\352\tM\225\343\020b\253\275r\242|\357"
+	.ascii	"\031O\251\322u\214\317\267\211\2115\236\253\326\023\346\232\306"
+	.ascii	"G\336\033\227\361\373\367\3368\312\tM5i\276w<\3274\036Se\334"
+	.ascii	"\212\3077.\3437\363\255c\374\246\2451U\306\255x|\3432~3\337\271"
+	.ascii	"\226\253\377\235k\271\032\257\310\324\353MK\215o\364\203\373"
+	.ascii	"\244J\343\370|\203@S\243 Ti\271\006!j\337 | \301k\275\3166\b"
+	.ascii	"\270\325j\203@|\347\250\235b\275c\234*\307U+\215\323\267\365"
+	.ascii	"\332|{\216\336\324\257:V\337\352\\]\254\217\365m7\353j=H\027"
+	.ascii	"\322\207\364\272n\347_<\007/\343A\370\021\336\306\357\370\023"
+	.ascii	"~\205\007\362.\374\013o\344e\370$o\3033\371\034^\312O\371+\217"
+	.ascii	"\345\271|\227\017\363b\276\314o}\020\277\346\205\370!\276\210"
+	.ascii	"\257\353e\350i\350\301\364bz z3\275\233\036\211\336N\357DOEo"
+	.ascii	"E\357Eo\2507\243w"
+	.string	"\324\263\321\273\321k\3529\365t\364\250z;z<z^\275\036\275\261\036Y\317\254w\326k\353\271\365\344zs\275\273\036\236o\203\317\305\347\301\367\301\027\302'\302g\302\207\343C\341K\341[\341\003\362\t\371\\\370`\370b\370\220|4|7|J\276&\237\223O\3127\345\273\362a\371\266|\\\276/\037\230\357\207\017\210\017\315\227\346c\363\265\371\340|]\037\021_\021_\336g\371.\377\345{\370\037>\315\257\3716\377\346\343\374\234\317\363{\376\317W\361\205\276\213\037\343\033\375\032_\373q|\246\037\365\245\376\325\307\372\\\277\353\207}\261\277\375f\177\355s\377\220\017\367\211\374\"?\226_\313\217\303\017\346\007\3427\363\263\371\335\374t~;\277\024?\237\037\213_\213\037\321\257\350w\364C\372\335\370)\375\234~O?\252_\325\217\307O\353\347\343\367\365\373\361\003\362K\373\251\375\332~n\277\270\237\334\317\356w\007\324"
+	.string	"\334"
+	.string	"\354"
+	.string	"\364"
+	.string	"\254\001\206"
+	.string	"\226"
+	.string	"\232"
+	.string	"\362"
+	.string	"{\200*\200+\200B@\027@\030\300\030\300\220\232\2504%\236P\002i6\326P\021\214"
+	.string	""
+	.string	"@\320"
+	.string	"\223\0304(\212\n\3638PSg\024"
+	.string	"\036\177l<\",1*\0209\025E02\001"
+	.ascii	"\360\177\013@\247Q9=t1h\332\336z.\316UB\250\243\263\007e\022"
+	.ascii	"\027\b.\303\374\021\305)\035Z\343\031\273\245` \336r1\340\022"
+	.ascii	"\2570HH O\tS\202BT\307\216%\215\317\246\220\2560\034\265\374"
+	.ascii	"B\036\362-\346SJ\005\335\367h8\226\"7\037\331=x?c\250\f\342L"
+	.ascii	"u$U\306 \243\256\323c\354e*o\030\373\244\336\023\2546}\273\306"
+	.ascii	"\016\r9\331\301\00161\273\305\224\343\033\313\032%\225\"`\006"
+	.ascii	"\241!\252\313\272^j\023\344,H>\242\373~\335\234)\2042D\256\003"
+	.ascii	"<\267\\\311\213e\322\241m\310\024\031\b \343\226y[\215\206t\005"
+	.ascii	"t\224<\244!\201 \272d$\314\377\316h`P\342J\017\227\351\316\036"
+	.ascii	"\362\231$\210\231\205p\371\001\340\222\251;\350M\217\214\026"
+	.ascii	"\230?\364\364\320\312!K\2067"
+	.string	"\230\003\376\323P~\003\207\256\351\341\033y\242\200\035\252\206R\223c&\244\274G\034\347\230\206z\202\377<\301/s\254&\212p\3719H\335`\371\275\306\276\322\230?]\272#\023\177\342m\264\312Lz\002\265fU%3\274\004^\t\0355wJAP\3039\374\215Q\216\025\272[\375\210\216\025\363\253\323\266\247}\037)\024\035k*\321\201m\0055K\344\204\020\2066\264\213\263\023\006L\375\324\330o\321\357[\240\307\027\260\321e\243i\244\013\021\264\b8f~\bG\211\244\231\323\222A\230\274\244\366\306\021\235S~\235\223ly\231\2511%\210\301\221r\237\332\261wzmC\030k\363\030\034\247oI\007\336\\{\005c4n\020\257\266\003\257\252L\215\354!\262\227%Ie\323\036\246*/\024\301\200,gQ\365d\207f.\231}\030\226\346f\201D\224rf\220>6\357\266u\t\276\246\276\260!\247@j\225u\336"
+	.ascii	"\225\325\024sY\3671O\031`\362\350A=\360SD\331\235+J\006\363\371"
+	.ascii	"T\365\360\215z\262\202\210\374\026\216+\332\316\207\005A\324"
+	.ascii	"\2011\217Vs\213\3079\312\363\364\357$8\354\274\230\243\273B\372"
+	.ascii	"\254\301\242\202b\255A\305\023-\214<\205\361M#\3301O%z\202\261"
+	.ascii	">\021W#Q$\0355\247\341\300\222\"Q-\241\242=\226\023\230\233\207"
+	.ascii	"\323\244\037\230\203q\240L\264\036\241\243\r#\261\350\024GS\305"
+	.ascii	"\241\244\251C\250"
+	.string	"\260\231m\345=\005\207'4<\366\313\036S8/\260\226\274\241XL\331V\265\023\266\234\317\017D\374\327\332\304\030z\004\305Sk\034\301Nu\271-C\n\275\374\312\005\342F\326Ye\320nO\215%6\277vL\307i\302\240c\2757\275[g\223\351\245\016\242\017_m\352\370$c0\305\222\255\333\304My\305q3\344\\\375\254\2772\211\036\005*\266\024\335\231\277*Y\026}D\024u*\214\344v\201\241\254L\262P\237\204c\340;\235a`\241\226P\224\344$\333\034yO\\\252\336Z\020T\214:\342\330\330\356f\341Q\377\362{M\237\277\253\276H\0369'\036#\334\307/J\361\223\026\356\001\231]\033\374\255B\201\270H\344\003\237\205F6&\320l\200O\013\356\3231=\237\f\307{\334\265\203\345\363\204\n1"
+	.string	"Z\313\315\355\023qAN\331\323U0\035\235\002\227BP)\300\022\004\037\271\030"
+	.string	">\321\206\026P\203"
+	.string	"X\344P\n\340!\360L`\345@\370\325P.\327\361>\322\234\327\bb\247\303\2414\007]>\345\314*\226\276>=\271\027\352;9%*\245\t\021\226\262Bp\360\033\355=\251\216\305\231\340O\\}e\037\350\201g\353\262\362v\022\261\322\003 -X\273Z\304@\212\321'\237C\016FF\316\376l\242\311\362\266\243\303a\235\236\352\020\032*d\f\343/E\271A\230"
+	.string	"\226\t\025U \221\356\027\b\247\362\030\351\226\247\332C0\332R\007\032K\370\3270\273# \373W#\024|\374\227Z\310\267\350\272\304\235\233/\3177@\376\\\n\364\266(P\376\020(W\345\330R\240g\346\305\203-"
+	.string	"\223J\221\316\017r\240\007\253\362\004\037v\376C\017\377\211l\341\333\332^\311r\311\312\371m}\224$\211\363__w\001t.\232Q\232e\245\300\357\223d\210"
+	.string	"b\311\207\244\302\370\366|U\022\007s\207\253l?G\261k\227\316gi\374d\236\306\354\245\363\214f\235\342\b\320\f\031!\032\016\260`uZ"
+	.string	"\244\370\325 \245E\331\217\336v\351@<\225,\265\260\025\223\246r>\267\222\350\371g4\347\231Qs\246{n\331\252F\370\030\250\370\342_\274\205\027F+|4T\333\263v\264\345;P\251\267\240\266\031\2647\227\253\257\320f\3076\234\351\352\210\267\2007M4\005\221\201\\\307sd\275s\302\333d\361\246P\261o\260\003\317\250\021\302\025/5\241\225D<\346\253\373\313\342\366\201\236J\370\225\374\203A\017\202\251\273\005\266\027\244\200\340\246\211\247\261t\341B\231g\r\\\022 \377V"
+	.ascii	"7\177\265&\036\022Kn\377@u#\322\227\352K{\344\037\0231Hp<\243"
+	.ascii	"\313\342v\243\264\300\345P\377x\362\004\021<H\2012L\306\340K"
+	.ascii	"\234W\371\003\\\314\263\251\200\375(\351u\345\334T\247\327\212"
+	.ascii	"\346\204g0\250S\177Y(G\3716\260c\240\332\231"
+	.string	"\326\006Ja>\253\024I&\271k@Pu\351\331\001%h\372\363\317\001q\242QB^+\350\215\355bj\367)\220\037TlA^}\321`\370\266>\037\200\026\271\255\342\372p\326\236\037yL\177\350\354\225\363\327\204\244\273Q\234:\244g\323\237I\315\360\212~W\246\307\301\262U+\234\230\204\201\020\230\333\321\351\333Z\b)\016\316\3666T\303@n\310\245\314r\003\375=dT\265\310\023\262\225\345\345`\300J\244\330\020\312\270\024F\314m[\246S\206H$\323\267\353\314\252.\275L\332\236\270%\036\21448\373\330\243\264\261\252\371\303\037\275\2012\361\220\033\377\352K/\357\224{}8\317\317[\362W\312\325\204o+q\343\237\314\3341\221dGH~\344\275\177\206\rX\261\035\352\240\377\336\n\316~\351k\365\232|I\031\030\033\n`H9\272u\275\326wD\022'\207ow\3558\301z\374\376\370\355\327\203\025y"
+	.ascii	"\212\b\213Q\203\2627\357\300h\245\206\225\3419'\262\337}\202"
+	.ascii	"MVA\205\3750\373\206I\024\025\027\370\206J~\033\355Q\266\017"
+	.ascii	"N\246=M\273\t9\343\036\035\204Yh~u\264'')S\025o\002s\005\300"
+	.ascii	"z\360\023\300\233\202\357h\rk+\344d\374:\260o\362\310\riY\246"
+	.ascii	"3{]A\223T\027o\264R\314N\305\212\241u\310\365\224(h\231I\273"
+	.ascii	"\232\336}\322\205\335'=H\341%o\225!\237[\275\374\317UXJV\370"
+	.ascii	"D\237#\334\251z\017\312\332\326#\037\342XV\034W\032\220\0223"
+	.ascii	"\023\254\3155\344[F\244(\001\317\321\026\220\230\334\350yG\006"
+	.ascii	"\334\247\324\277\323j\370M\313\3528\303\376\f\212\n<\337\375"
+	.ascii	"8\"\242\241\344\005o\037\230C\216k\313\256,\004u\352P\365\361"
+	.ascii	"2S\031\365N\260.\026\210\275c\246\310\"\325\345\t\231\205*\t"
+	.ascii	"g\276\310\323\337\340TK\026\277n\214\002<=\262\220S\003\fS\307"
+	.ascii	"a(\275*=\303\233aZ\236\340\257\335L\267`\301\fH\347%{pb\231\343"
+	.ascii	"\237<jG=\240vXJ\224b\213kXz\322\356\363\223K\250\037\220\202"
+	.ascii	"`\323s\346A\256\310\336c\023a\342v\"\237j\017\340+|\212\\\030"
+	.ascii	"\353\231A\377\223\330u\372\035\325E\246"
+	.string	"%+# \204\355\342e\263\316a\332\212[,\266B\212\355\302\232\222\256^\370{\230\226\351\237\214n\363.\231?\005<k\352\r\"s\351\267\345\243j\223\362Ki|\324\027\006\346\302S\021\256;\033\317\201\310\314\347[\325\327V\230\356\340\304\002\031'|\232^b\262f\347\034\276^!\332\251+\272\214\226\270[\354\252N\254\223+\367.\322;\026)\227c\277C=\"r\211\274\036V\240\023\234\244x\006\215\275 \215\343\224\270yUW`\342\2370,eQ\367\3719\355Z\272t[Sk\326\365m#P\365\202\317\364\227\025^\224S(\023<^n\312p\354\262\270?\334\b\316\320d,\233R\225\224\371x]%\007\324\345}|\304\026\344b\256\370\377m?\264\177!\204\223\022\342\320\256\306\361\260\n\357z*\351j\304:\243\304\206\346j\3767Vg\256*\2243\244\374\372A!\003\177\b\216o\304\324@\237\222\334"
+	.ascii	"\201\t\327S\252$\206e:RB^f\214\3149/\306\345{\330T\326\020]\335"
+	.ascii	"\005\327\023\366\231\360\311\311\026-5j\033a\366P\276z\222PQ"
+	.ascii	"\037bO/H'=\244\270\017~\351\242\301z\320@fhR\263Bm\177q\354\206"
+	.ascii	"*\005\226\254\3729[P\315\335%eskEVO\024\025;\207\225\305XY\322"
+	.ascii	"h|Gi\221V5\n\326\331\"W\272\361g\274i\275\330\364\363ew$k\267"
+	.ascii	"\250\206b52>D\n\365\347Z\260\331+\340\r\355\263\377]*1\205\315"
+	.ascii	"\363\020\337\033x\261p\2500{V\326n\305\016u\311Xn\350\237M&\326"
+	.ascii	"\356\210\3640&\322\212\313BJ^\317Yh\340\tb\037m\034Alv\371nX"
+	.ascii	"\217\217\001\346\216u3\027\311\341\230O2\202\213\026\205\273"
+	.ascii	"\275\350\262\026\246\236\271V\020\350I\2666\030-i\364x\324r\272"
+	.ascii	"3\222\035\276\230\374al\006\357\316G\351\\1\321!V\321\321Hb\021"
+	.ascii	"z\330\250\263\212ypQ\236\313\022C\016\264\345\377\357RU\357\364"
+	.ascii	"\315\360\004t\017\363\007\254R\314\213\026Z\351\204\220\3224"
+	.ascii	"\246C\244\357\216\363\004Q\271@R\307E\213\364\367i\364R._\177"
+	.ascii	"\210\336\375\232\bM\353\300\343F\r_\nS\235\252z\003\342\263\354"
+	.ascii	"\367\371%\203\337&\034\3771OD\236\347rf\351\214\246\302n"
+	.ascii	"\t*Q\263l\210@\352\025\021\307\202\223\007\331\020\3061\345E"
+	.ascii	"\216\376\267r \327G\332\207\217\230\315\2367\020G\026\206\036"
+	.ascii	"\253\034\033\376\036Z8V\204\325\351EO\351\275\363\246\337\365"
+	.ascii	"\240\221!?`\032)\2158\305J\230\201v<*\2663\266\274\"5\332tl\350"
+	.ascii	"p\"`\367k`\270\317dwJ\334#\220\037D\334y\203\017\225\372\fNk"
+	.ascii	"\370Z\002\272K\356bL\006a\221\n\243'\233\211[\231\356r\224\t"
+	.ascii	"\221\035\215U\"\023\261\237\343:\271\"\332\273\335\226\262\312"
+	.ascii	"S:\301\002\006[4\254\007\263:EM\274yeY\247\n\221N\013;\246GN"
+	.ascii	"\212\312\240\345D\020\214\340S\320w\372F\005\023\r\303\271\025"
+	.ascii	"\253\220\250\273\222\307\256\260\200\030\003\240\275\257^\354"
+	.ascii	"\236\223\354r'\330\036\300\035R\337D\351\262R\276\224\013R\017"
+	.ascii	"\034\230\217"
+	.string	"\305T\317\345w\273\353\277\213\001Ub\334i\r\337\374\307g\221\206\223M|\361\027)Z!\203,G\005D(#\303\233\344\225\r\310\036HolK3Z%\323w\372\035\215\037\027\372\377\\\034\205(\b\275\362\375/\345\236{\216\006>\003\210\232\023\340\362\007\340\351\272\256B\024\337r\377Hp\007\313\302\330\215\376Q l\302\210\007\241,RU\007\350\312\033\235\276\031j\245r\270\016k@\271]\037\271TPI\225ux\330E\037\217\024\377O\374HdZpzD\255U:\020b\316\024Q\336M\217\255\031W?R\363w8\364\302\376\373\314-\016\"R\267\262\234X\022\303\302\022\307\032-\263DL\332\022\226\321\217\2224+\327\255l\002\016n0\314\211%4\324\253J\033]\337\337k\375\276\267|\264\245\360\276+wT%u\220\t2\305\256\267\225\252\222\007v\365\244A\321\367\275Z\035F\030\027\r\016?C\315m"
+	.string	"1\216rk\237\340\326\"uS&(\372\313\016\362\211\247A\214]?T\364\016\r"
+	.string	"\320\205\357\026K\241\345$\321D\200P\233\f\355\271E8\231\306;\274\210\027\265\263\334\226\310\256\013BF\347%~\220\013\264;\224Pg\363\346:\344\241\357\355_\376W8\037}\257(\004\027\212\204)\\\024\372rO\331j\252\230Z\\\243\203\031\343\375TU\214\016\n\016\"P}\032\245\213\361^.\224M\336\236h\304\275\035\260\033<9\362\300\201\3211\022\331\276\034\026*K\0213\264\214\"\fp\020\217\305\247\352z0N\351\315s\214\236\267\217\222rk2:.\321\240\002\034n)\244\323sO^\200\262\225\376\251\201R\013\317BV\347\363\312\227\216\320\n3\255\031@$\021e\233}\204\300\243J\260<6DE\324\305\302.\005\226E\022ZSy\220\367P\361\211Y9?^\377\233i\013Acu\252YnN#"
+	.string	"\314\357\203\035\314\035\344E\260PY\f\206\366\273\025B\006T\311\205\263\024\3031\302\334c\353\260Qu\301\217 \327\260n\374\355\"y\022\025\"\372\254\276\206)J7\324\201\"\233\032\312\304\265\214\265\334uw@\340\233\327\002\373\237\376Va9\007P\371X\021\325\022\224G\263\274\351\332\306TI"
+	.string	"\235s\271b\346b`\272\245{\373TAO\304T*>f\261\037\364C\033\344\002\245}\337&\270j\340\363Z\210\nL|K\375\035\205U\331\030]q\263/ak,\266;\237\271(\312!\313\230%^\022\244\214\374\033\315\007F\027q\315\233\371\006\276\003\355\254z\034w1\214\021j\220m\363\036\253\203\n\212\304\254GN\204\264>J\325$\022\202N|M\035D\337\210BPjS\2457\213\275\354H"
+	.ascii	"\237\0173\"\020~?V\226c\216@},&\354U8\235\036V\032\236\003H\352"
+	.ascii	"\024\362H\252\273a%7\274\260dk\364Z\033+l\305\3270\237\267Hi"
+	.ascii	":\033\323Ux\025L[o\033\352v\254\233?wdOa\246\027"
+	.string	"\2420b\177\031\246\346\273\304\007\307`\033g<\247\353Dt$\264y\r\2064\034\355\2423M\030\270\323\346\241\323\225\227Ft9\002\352*\2202\272\375\364o\204\233_Z\031f\251\340\203\274\271\220Un\333\250.\316hC@_\232{X\004\031>\025\255\200\214\306\211\260\256z\254Ar\216R\025\313\300>\b\262_\257\232\033\360\344\0309\235Dk\313\205EE\373\rIV\273N\272a\240H\370\212=\263\301\334\216\227E?\b\260\331!\304\266\"7\215\374\005\303\314\037\321\274\303\201\214\247_\303\316\306L\354\243\032\230V\b\326G\342\376e\036-_0@R}\216\323U>\327\226kX\301c\225E\354\247*u\257P\232\354aGQ\324\343\3575\366jh\262\216I\237\364\365O\212\351\b^\334G\212c\323\007\265\272\261\177\t\314JF\260\245\005 .\360\353\274\210\371\327\256g\031\351A\226\035\212\331\263\220&\324\327"
+	.string	"\243\2726N\036uk\033\352\325\3617:\250\226\363\b\340"
+	.string	"\367\310\035\323Wz6\220d,\347*0\343S\337\341\311\337\031F\020\213\020'\246'x\344\371\333\302\"\215y}\374c0\236Q\323X\022\017\313\363\002m\314\333\364:\204\2751\005C\345\n\312VH\223\362G\375%\2504)t\302\231J\001\357E\231\252D_c\013\264lFQ\240\306u\324|\272V\302\371\317\005\242pi\310~\b\272c\305\327\224\026\323\333\250aK\363"
+	.string	")\217\321\351\372\334\321\031\251\016N\245y\177&\340\345\367\331P\237\2617 \310\373\200\374Y\327nj[\216S\330\367l\n\037\241gH\252\272@\262\327\223\036\302\212\231!\377\355\252p\244\221x\335\020\002\312l\341\236\360@\230\204$\301\004gY\300\217\253\313\273`N\265K\200\203\037\277Qy\232\246\006\243`\n\021\r\276\364Ow\354I\336a\365\360\247\326\366\300\350\317\017\344\214\006\246\234\004\242\200\337\234\254s<.\266\366y\030\333jtM\005\215\345YW AG|\035\345y\025\331\372mSV&\341{\3764X\271t\354l\016Y=\303\206Z\247Q\2221YROI,T\330\273\336h%\265Da\311(`8\373o\300|\243\021\017l\026\030\235q3&\324\270\375\032\037F\23381\036\362\213\230\203\207x\272"
+	.ascii	"#g\265h\311\007]\022~\323\373\034c@\226\347\345\016J\022Y\001"
+	.ascii	"6\374\306\301B\271\270\230\361P\031\007%\0232\206\326\235\034"
+	.ascii	"\202/\241\341\266\255\271"
+	.string	"P\003\376}f.%\353\352\351\0206\265^a\230\017\275g_\213\341\241\341/:\231\031\003v\221\267\260\251=\213\371\241\227\013\375D^m\331s_\241\321\314eRDV\003\262\363\362\303\254&^\327r\362\373T\311.\361f\344\035s\266\342\333\311s<p\207\361\301d,\226\033\375\240-< \005\201\313\026\320\373\313\013\332x\030\0356?X\277\222r\246Q=\030\333\376\020\3150\034\214\215@\226\365EY\236\223\300\210\315\341\267\b\240}\376\3141\242Dh\310_\230|\302\377\341\234\365\336\013\332\223\374\353~\340x\211\337\004\242Q0\b\361a\267\205\033\037\r\221&Vn\366m}\265W\232M\261\0269\013g\370nv\245\031\323\366\330\02120\367a\235;\fh\024K\300\264\261f\365.\007\264\201-\013t\205\004[}\250<\362\373*;\236\331\273\246\316\270\210!\363\005\315f\220Y\033=>3\275S\f\r\272"
+	.ascii	"l\343O\261\234\007\254\2305\377\262\276-\335\250\334\301\021"
+	.ascii	"R()?\335\261[\005\337\274\366\374\217\266?7@\234Hb!\254"
+	.ascii	"L\177`\321\237`)\311\035\234\370\271\347UmP\027m\211n\235\322"
+	.ascii	"\3278\314n\276\371\356\377\263\306V\266g\263\001w\3775\032+!"
+	.ascii	"\366\326\344x\034\340Qp\276b\004\005\021di\351?\261\224h\231"
+	.ascii	"\332s\367c\331\021b\313m\303\322M\250\210\263X\361\350N\223\246"
+	.ascii	"\342X\314D\345\230\367[\"&\223\346\013\360\272G\232\255\030\356"
+	.ascii	"\322\261\3732\263\225\236\365\013h\372B\324,\201\276\013\253"
+	.ascii	"\243\023\017-FpqJ\235\273>\324\255\335\"\335\231g\363\007q\334"
+	.ascii	"%\205\304\301C\263\217\353\276W\306\321!8M\345\305\273\b\t\336"
+	.ascii	"\330aL\237\271\365\232\202\031\301\003\035\266\315]\234\213\237"
+	.ascii	"\277\004b\323\224\365\r\"B\322>\277\273O}\"\2510R5K\344\272}"
+	.ascii	"\214\330\002\030\361ZL\344\022\242\207\243\352B\345\327\244>"
+	.ascii	"\227m\266\341.\370C\321\257#\223\005\262\274\022||\004uV\007"
+	.ascii	"\027*\244\205$\335\004\022\272Tif\331\2400\365\275*\220)\222"
+	.ascii	"E\334\002\320\323\325W\253|d\030a\375K\264\256\253so}3\354\271"
+	.ascii	"\0069\301\026\362\244\310\371n\273\022\342\004\260\016\001j "
+	.ascii	"\307\005\273\350\204\007\357\036\330E\351c\274\377{\213\2204"
+	.ascii	"\r\210\303\245\205\236j]\360/\330\261s{:\340\003\024zt<xt\013"
+	.ascii	"\373\200\266\0200A\205\222}\243@\353o\024\025\326\252N\367\266"
+	.ascii	"\330\013\203\276\375xh\0136g\037\024\365\t\2311\344u4\232\376"
+	.ascii	"x\004\200uBS\024\261\334r?Jm\215\r\304\027f4\332\024\n\260"
+	.string	"h\201\336\364S:\2575\235J\321\022ak\245\375\374>*\024\220\3738\f\237\373\3443\013\315\252\306\270\2158\206\376\277\263j\254G][\316q\244\251\fi0\020:_\352mg\263\236\261\020Lm\017\337\314g\365RQKy\370\260\021\246\262:\231u\037\003+\243q\033\216\025_B\302\320lA\302\251b\2147:>\204x\311\341=\177c'>\202\313z\217\240Y\013\354\223\324q`w\024h\327\220u\326\330iq\233&p\244Z\337\243\243\314\212~\207\177\346\334\267\223\371\304}\fd\037\311S\226M)|\206_,\"\336x\310\023\246n\237\3355\017a\032\362[\356zY\210?\364\377\373)wn';G\313>\235\245\267\037\361y\227R\331\327\241\246\023\026\225\030Zh`?u\220\323}@\224%\250\021\217>\220\337\230'\256\262\306$_/\265\025\312\352+\337~\303#\305\340$\221\211\253\260\300\371\035\243"
+	.ascii	"U\025\203\215^\240\372H\364\361\321\202o\331#\t{cR\324\331\361"
+	.ascii	"Q\365\257r!\324Q6\376\260\260\376\316\001\327\021S\207E,\324"
+	.ascii	"\275\333\244d\315*c\245\023\306\350\204\027x\314\023\004\355"
+	.ascii	"4\301\311\207\347w_\273gv\365\361\242^m\267\350d\246\027v\261"
+	.ascii	"\013@i\035k\036e\345\033@a\001\331\344\001\360t8dRHAT\262\324"
+	.ascii	"\304\001+\327\201\376\215\214\243\334Ph\022\340\320\320\226\362"
+	.ascii	"\200\307\337iR\317*\035\207\216\326\2612\332pu\210\353\022F\272"
+	.ascii	"\007\250*k\206\312~\277\037+\374G\250j\375HFHDq]\210r\307\325"
+	.ascii	"\273\267M\216\216\376|\261M\257\003\b;\205o\235A\307\035\001"
+	.ascii	"m\f\354!\234{\230}\341\267\256\366 C\035bh\365\243\376\024!\246"
+	.ascii	"\326\241U\203_fg\355\333\325wY\324Z?k\013\2069\301\217\326m="
+	.ascii	"\347x\360\252\217\204\344\317\302A\207\335*0Z\224F\373\006\340"
+	.ascii	"E\253;q\\\027\353\236+\f\200B\2004\371\272\235n6\260r\266\204"
+	.ascii	"\364\223\033n\314o#~a\233n\005\324\204\3415\334\312\352\217\251"
+	.ascii	".\276Y\274s\303:q\316vF\342\026\270@\204\272\312\257.8\232-\037"
+	.ascii	"Qo7\302\376\271\177\0252\033\030\342\277,X\253h\205\033\307\305"
+	.ascii	"\262a\232\341\325\001NDVE\260\3436\234!\002\020c\234\314\003"
+	.ascii	"\227T\2650\203\305\244\003`\346B\251\253e\224S\363\2158\266\334"
+	.ascii	",\027\314@+\243\2370\266y(B\352*%\262@#\200!t\025\361\326\341"
+	.ascii	"*\204\021>\300Tc\345\267v4}e\253\270\250>\006\n\231\2140U\337"
+	.ascii	"\205v\355\375\376\214\217\t\016\315\343\205nH\350\236%\225\304"
+	.ascii	"\016?\315\235R'\"\361\034\314\375[\215\372\245\313\253:\202g"
+	.ascii	"D\362\277\336(\312\335\276m\375\223\201\3331+\026\375\f\024g"
+	.ascii	"g\341\315l\356ZL\231\331\341\006v[\223V\303\251iw\202\204j\020"
+	.ascii	"\3716\2507H\221?KX9\375\303\252\342\313\347\355\3279>\t\342\007"
+	.ascii	"C\343QT\251\357\255\\\341\255\376\233\356S\022C\215M\237\261"
+	.ascii	"f$\206j\375x\236\211\226\340w\030\304a\326q\205\367\232\226#"
+	.ascii	"\"\306CWed\r\220\356\022\223\361\233\213\022\213\277# \366\357"
+	.ascii	"(\255\316\031n 6\304S}\307^\330\214i\370{1x~;\240\221\377\250"
+	.ascii	"\3776\301\357\254\332\005\367V\251!\236\352;\346\316\r\"\235"
+	.string	"j\276\033\362#\225fk*\214\036\302hk\344\332_\nEavGW\022\377\302l_GTR\261\313yj\253\302~\273\262f\f\360\013]\322\251\2250\350)\307\334K\b{\272\313\326\205A\206\210XH\307\324\025\224\336\335\371B\002\033\361\212\201\022\302c\230\271(\272\032!\346\\\341q\271\217J@ \375\225\356\316I\273\177\314\020\021M\263\342C\020\321\272\260\277%\355\276\222s\321\365l\244\006\257\230\030\371\037\202\324\313Y$t\007P\267&\255])\221\217\355-\274u\b\020%\347\372\021yql\327\264[\265\364\237\205$t\374\nuU\375|u\223\360/{\177\354\026(\246\001\234p\231Mfe\347\275\206'\356\331\022\"c{l>\241\021v\035\210\270\207\2333l\223\f\222\270f\013a\335\034\227\b b7\317\rCK\352\001h\224\033\215ud\372q\311?\230\203\253\233R3R\242\234\351&\306=\b"
+	.ascii	"\235\023\371\252\305\241\215\251\232\225\222\241S\326~MX\231"
+	.ascii	"\303\257\t\331\025\227\335\334\020\200e?\212\022e\201p\313\322"
+	.ascii	"\317\035\221\204\332\324\0168\212\037\344Z\016)\355p\237\374"
+	.ascii	"\243\220uR\336\006\023\206\277Z\034<\020\201\202TZ\217\b/i\205"
+	.ascii	"\230\266E\033\035\200\275\r\341\017!#\tQ\305\021\373s\277f\230"
+	.ascii	"y\354\275\353\277\357\300\321\231_\345k:\031\203\250\330\365"
+	.ascii	"\013\033\2174<\337\003\n5@|\n\006i\tw\332\370\271\226\330\022"
+	.ascii	"\302b\211\025<\374\326_?H\033rK\241\304\333\361R\177!C/\275:"
+	.ascii	"\022\352\245G\375\355\277\213\327\271\246ok\3244\204\233\363"
+	.ascii	"\3214\300\357\225\246\253\205\026\206\322m \035\316=\220W\312"
+	.ascii	"\235\205\331M\360:\312\177Gh<\205'\232E\225tG\223T\266j\017\235"
+	.ascii	"y!h:\325\2439\263\020|\240i\252q\024\302;L\362\240k\333\2359"
+	.ascii	"\342\250\355X\0037\006\001)0\346\255\247\030\341R;\r\347\032"
+	.ascii	"\205`0=\354\327\032\360\314\004\b\266f\341\23345_\215\213\343"
+	.ascii	"\352\265\331\261lA\201\023\202\335\326T\024A\265\340r4zC\fr\033"
+	.ascii	"%\317\203\326\244XpU~\n\f\"\345\221\370] \247w}z\204q\204\240"
+	.ascii	"\231\275[\344{\022e\303\377KTEv\252\346\230\026hx+Cz\213$=\344"
+	.ascii	"{\315B+\255+\340\253\312\375+\2567\211TKavA\321\375\244\205a"
+	.ascii	"\250\325\230#\013\373\227\324\3045\017\ngn\215\236\3324\347\332"
+	.ascii	"\030E\350\207\273K\006\244\206\025\311\372\364\313\311"
+	.ascii	"\2732{\304\251xO\337\245\236@i\352!\252\215\335k\346\246\023"
+	.ascii	"\211\031\245X\201\261\305\032\234<$]:\214\204\366\300P.&\013"
+	.ascii	"\336\320`\027\013i\360\320\223o\222\307\276\242\003\030\376\332"
+	.ascii	"\227\366\213\3041z2l>/\360\365\250f\\\346\327\356\271\257$\027"
+	.ascii	"N\245A#CL(\205/#\013\324oT~.\231\314\272h\034\020\206\027h\016"
+	.ascii	"\356%\334\226;\030@P\217\304\013o\374\277\366\350@)qJ=\341\367"
+	.ascii	"\324\276Y}\252\006*\376\344\226u\240J\366\357\274['5M\276]\211"
+	.ascii	"\344y\216\234\375\356!\321}\232\236d\3010.I\201&\315\277\366"
+	.ascii	"\305\373\214\001\037G\364\236\361"
+	.text
+	.section	.gnu.lto_settingsBuildCheck.237.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 \3005\005"
+	.string	"RI#,pU\323\001"
+	.string	"\035\300\327\335\337\367\327-6Nz\366\267T \033\266\371\024% \231\3575\005"
+	.string	"\020\364\004\3730\200\200\032\026K\366N)\246\246laMM\2532\235\fJ\255\251h(\205e:\025|9*L\265\353\302T\002\367\3623<$\304\006\271(-\366\243\225\237\035\243\260\362OgW\022"
+	.string	"\260\236"
+	.string	"'c\373\2227\033t\020\263\204\220\022\331\204vW\345\345\333\343\346_\363A\347q\217\202\304\356:v\336\344\226\267}\260\215\260=\003\b"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`!\001-\t"
+	.string	"\242\01654\360\232$\035"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001@@\n\236l\"\233\310&\207\236\217\214\320h\006\236\2013\260\211l\"\233\bf\035\001@\240"
+	.string	""
+	.string	""
+	.ascii	" \204\335\226\264$\003m{-\262\f\263q\345)\225\263R\306B\371\352"
+	.ascii	"d+\223\253J\246\"Yj\344\250|Pd\250l\f9\006\344\247\217\235<n"
+	.ascii	"\352\230)\037\344xic\245l\3248)c$\214o.>\262\330hvQ\3054\024"
+	.ascii	"\023M<$\261P>\030qP>\b1P>\370\360\315\341\237\206}\030\016\313"
+	.ascii	"\306\205g\262Qa\231lL\030\006\341\236\203u\f\006k)\370\213`\236"
+	.ascii	"\201w\004\316\t\030\007`\033\3315\371`\036ck\275\267\270\271"
+	.ascii	"\262\355\265\370]\351b{ii\355\315v\254\353\272\256\264\275\270"
+	.ascii	"\266\334,3 \300\323t\201\344\221\307<\362\310#\217y\244\266b"
+	.ascii	"\311<\362\310#uKR[\222\307<\362\310#\217y\344ay4\265\025+,\311"
+	.ascii	"\203\345\350\255m\331\262\310t#K7Fd\274\201\344!\217<\362\310"
+	.ascii	"cjK\362\370<\224\244\222\255=\006"
+	.text
+	.section	.gnu.lto_.refs.719d435e15107495,"e",@progbits
+	.string	"(\265/\375 cu\002"
+	.string	"2\206\022\027\360\334\264\006\314\3003\360\f<\353\270\231\231\231\231\231\231\334D\210\364d\207zjZ\332\222\216\212\206\202~zvrnjfb^ZVRNJFB>:62.*&\"\036\032\026\022\016\n\006\002f\261Wk\325\356.\025"
+	.text
+	.section	.gnu.lto_.decls.719d435e15107495,"e",@progbits
+	.string	"(\265/\375`t3\345\315"
+	.ascii	"\352?}EW JII\351\256\277\252\243bb3cr'2\"sr\323\371mU\331\216"
+	.ascii	".\210\340\346\330D\204\204x5w\276 X\347\b\206\253U\177^\371\305"
+	.ascii	"\272M\027\005\313B0\234C\224\244M\322b\334\266m\233&I,s\374_"
+	.ascii	"\327gY\226c\244\024v3\"\221\272\211\224)\245\003;\004\200\004"
+	.ascii	"g'_\341*;\227\221L\273\251\350]\272}\350i\003FcH\333\363\214"
+	.ascii	"5=c\256\242>5L\361q&\325\326\311NxJW\335\225\316nG\364.\247>"
+	.ascii	"\254W\230,\211j{\236\3623\224\311X\215\231\267C\312\245\f\224"
+	.ascii	"\231\266\f\205\243\260\263\003F;\247\261\224\343(=\357\363\336"
+	.ascii	"\347Og\351\2359i\273\201\203\324f\246\365\334\201\232\356\355"
+	.ascii	"q\007*?\361\235\317\330\fH]N\375\2445\246\316l\264\375\223\203"
+	.ascii	"\324\225\201\324\324\214\201\324\004,9H\315\211b \365I\3539\214"
+	.ascii	"\227\234\305\234,\306c|\200\273T\007\326\001\025\226'G\356\356"
+	.ascii	"\024\217\241\035\265&Xl8aL*\321\266\317\377\003\021n\206\347"
+	.ascii	"\336%\367\336\nz\276D\211\271L\216B\351\212\360\001\254\007Z"
+	.ascii	"\177\365\336(\234\347].\361\250\214\303<\364\367pz{\357C\270"
+	.ascii	"W\231f=\242\246\264#\203;t/r\251\204V!9(\241JWI\006\007\305A"
+	.ascii	"\371\274T\035.\024\310U>\231H\313D\366}^\246*\250\313\304D&)"
+	.ascii	"\237wy\237L\344\206\313\004\265A\371TB*\241UP\254\204"
+	.string	"2\2418\\\246\213\274LJT+\023\023J\351\306\204\332\240\204*A)\231\252\240\370\311\274\354\305\312\263\n\231\274P\245\236{\257\214g\023\311s\257\322\362\"\277\364\214[\025\235q}\\\206\003{\002\271B\367^\244\031\235\025S\347\271t\341\224H\230*\222\367\322\335\031! \031\371\274\3676\335%$\337\233|.\357]b\236\230b2\230\246\345\355\271LJ2\226\254\230<\311%f\323EB\305\367\336\013\245\204Z1}T\236@\233w\351\211d\245\f\346m^\272\252\345\nE>\257\331\275\227\355z\240YS2\3322\004\376F\376}\377\376\300\337\036`\361\367\212\346\300\337I\177#\375-\374;\370\267\212\277\215\376\376\375}\342g\r4\360w\006.\360\367\013\177\227\340\340\377\335\377\274\277G\374\315\302\337\023\370;\205\277M\370[\304\337\016\370\273\001\027\374O\377^\300\337\n\370\033\001\177\217\360\267\b\177\207\360\263"
+	.string	"~\326\3603\317\317>\276\277\017\360s"
+	.string	"8\203\377f\376\243\371\037\375o\3673\t?'\340\347\005\374<\302\317\017\370\273"
+	.string	"\177\177\370y\203\237)\370Y\202\377\030\370{\351\347\027z"
+	.ascii	"\315A\013\240\003\320\033\264\006\235Ac\320\027\374\314\302\317"
+	.ascii	"#~.\321\026\374g\300\337[jQ\312\2348S3\025\374\r\200s\370\323"
+	.ascii	".^G\212\354\300Q\343\311\251i)\0041\244\177j$\036\025\231\310"
+	.ascii	"@j\001\241\277;\220HGP\240'\370;\350\357\b\376\346\240\203\247"
+	.ascii	"&\305\371\2718w\030<\360\263Q\373\374\335\363\363w\2240\030~"
+	.ascii	"\306\300\316\337:\377]\340\374\251\216\347\374)\002~\216\352"
+	.ascii	"\365\357\234\353\374i\007?_\321\360\2471\376V\377\306\371\233"
+	.ascii	"\377\376\317{?\277\371\271\315\317y?\337\375\314\346g5?\247\371"
+	.ascii	"\337\363\247\035~F\363\363\231\237\347~\226\3739\356g/?w\371"
+	.ascii	"\371\355\347\266\237\267\374\234\345\347\265\237\323~\216\362"
+	.ascii	"\363\331\317e?\223\375\354\344\347\261\237\235?\213\375\034\366"
+	.ascii	"3\330\317^?\313\360\363\221\237\273~.\362\363\326\317Y?\023\371"
+	.ascii	"\371\352\347 ?[\375\274\343\347\032?;\375\314\364\263\322\317"
+	.ascii	"\367g\020\374\374\201\237;\360\263\361g\341\317\300\2377\360"
+	.ascii	"s\006~\256\300\317!\376_\371?\345\377\330\177\021\376\267\375"
+	.ascii	"\367\355\355\355\355\375:S\177\316\230\177\203/\001s\276\367"
+	.ascii	"\035\003\262\200(i\333\03141\303\3166\323vW\3123\2363\\p]\332"
+	.ascii	"\276g\370\373LGq\322\300\230q\327\226\273\370\336h,\2205OF\332"
+	.ascii	"\366P\326\034;{\256\353\206\334\234\3610s\264\336<5\231\277\351"
+	.ascii	"ZL7\211\320\344\320\322\226\323|\3571S\260$\335\264e!U\252\013"
+	.ascii	";\273K\313\241\260\341\336 Z\232g?0W\212\264}\203\371\033\256"
+	.ascii	"\275t\223\207IgCY\246m\177\361\275\34340IA\341j\253\303@*\316"
+	.ascii	"\235\262\367\366\326mC\033.\223\034Z\023\347\214\026v\266\226"
+	.ascii	"n\033z\336\032>rK\244>\234\251P\314\232\236\264}\263\275\233"
+	.ascii	"h\226y&\245\327\366\003\337{\213\372u\205\n\217K;ag;i,(</\322"
+	.ascii	"GmL\016\214\250\031xki\230d\220m\253<\205p\364\366\272\324\264"
+	.ascii	"}_\371\033\332dm\205\307\347\207\031\027,m\253\b\245/\222Hg\224"
+	.ascii	"U\255\247\260\263\251t\2247Z\247]\350y/\332\275\227J\2335\024"
+	.ascii	"\022\222K\035\032A\262\314\232JK\221\323\212\342q\247c\243\207"
+	.ascii	"\024'\325\036\347\271\362\206-(g>a\242n\322\332>5L)\323\230\b"
+	.ascii	"Y\373\211\357]\326sd\214\023\264\255\001\030H\365\340r\220\212"
+	.ascii	"\003\207\223c=\2031ca'c\3511\035\345\275QCG\330\222lww\311\343"
+	.ascii	"\003\233\251A\343\236"
+	.string	"\032\354\316\244\202\264\0253cB\242\235%\333\311Z\232\311\211\0063\005\f\216\266bB:ZyNJ4\326\263YX\023a2P\346\230|5X+\351%\355\305\316\016\353\256>\322HZ\006%\2270\366\322CRhsD\2233\312\306m\374\226\234;\343-a\235\204\325Rhsm*\203\022\326X\335L\241M\235\030WbDBDDDD\251^\332\227&<\3668M++9H\345\300@F~\235\235769\232m\217s\327[5\315.\222*e0\237\034~\302\244\204h\351Pi#\203\215\266\255\325[o\256\316\272\315\025\002\363^\245\346\372qs\257\322\017\263\006\314\032X%VE\240\250\3666\272\336\222Yo\303\254}\365\364\360S\266\305T\265\266\252\3416jM\\\321~\321OQ\346\264x\264\217\26220f/{GSV3\371\013\207I\237\315\234\262\253\257\350\275\317f\262\030N\223>\233#\256\212"
+	.ascii	"\351\252\246j!\375\243\203\264\025;\233y&&\273i&\265\271\255"
+	.ascii	"\350\275\227\310\003\021\217I\321\210n\030\352\036:L\317\013"
+	.ascii	"\325\tc\327\303\fm\275%\323\301\003\205\332:\343\232bg\347h("
+	.ascii	"\3339:\252q\244c\313U\255,\306\217\227\333\022\034\326\366\215"
+	.ascii	"'+\231A\312\356X\273FK\261\263m\3346a>{R\245\033ojC\352\017\017"
+	.ascii	"\251\267\313\365)\336\372t\206\225\306\317\r\261\244\036\334"
+	.ascii	"z\020\364\032\306]\363^&'\336k\0301\344\360\242\3672\311\350"
+	.ascii	"\031\354l\247\216AD$\264#v\305\313I\312\332\311nb\247\207V>\237"
+	.ascii	">yqOl\236\254 \270\227=\250\274\267\307\036\324\247\316^:;\202"
+	.ascii	"\305G\333\247A\3267\222\235\255\304o\316]\030\356\375\274\027"
+	.ascii	"\n\202\036W\361Q\332p\231^\350\265\022\357q\225\3649euz\361&"
+	.ascii	"z/T\210\210\250\347\314\022\023\246j\237R\255O\233\326\247K\353"
+	.ascii	";\315\232\367\017DXb\363\230Z\362\336\326;fC\003\217\235|\307"
+	.ascii	"k\370I$\224\263\264\302[\263\366\215e};\3277\330j'\244^\305\261"
+	.ascii	"Y\322\366M\265^\2041;@\250\333p\227\346t4\357\205\236g`4\354"
+	.ascii	"\344(\2279"
+	.ascii	"\3171\335\371y\226\362\3738\312f\230\214\017\362y\237v\346xD"
+	.ascii	"\361\270\273\027JD$D\244\363\245i\346l\265\357\273\236\351\326"
+	.ascii	"3\227\365\311\363\364\224\305\274\262\236\323V!\006R9\216\301"
+	.ascii	"\260\323\002\226K\221M\356\222\2367`o\332\220\255g\013T\336c"
+	.ascii	"\013\3243\223\365\354\265f\300A\252u[\345\242=\270t\255\347\255"
+	.ascii	"\365t\034\244\376\216\203\324T\316\214\203T\006l\251Z\317U\230"
+	.ascii	"\257\004`>P`dP\276\254\327\027 U\344\254\327\017\227$I\230$V"
+	.ascii	"\0063VU\334\264\275\225\241\271N\240\301\235\201jk\217\370n\221"
+	.ascii	"\254\314$^Vm;\030\261]P[`\300\264\275\355\372\355\020\333d\033"
+	.ascii	"\267*\331\226\247\270|\267Et\316\362\204di\033\301\226\325\242"
+	.ascii	"\323\201$M\333[\255\337b\331\254\346:\301\026$\013\215\266\314"
+	.ascii	"\344 U\002\006R\355\020\337-\221(mzE\332\002]\265\034\023Qb\343"
+	.ascii	"J\210SN\322\315IZ\220\0329UxI\034@v\370\340}5\261Y\245V>S\252"
+	.ascii	"txU\245k=P\035krTy\335%\344\316\300l\333\321\302\204%\357G\327"
+	.ascii	"\251hool>\332N\306\227\033\\\017\036\353\215\027c9\332\336\362"
+	.ascii	"\370\355\322\356h\256\036\036F\200\3001\371nu\340\344h\243\312"
+	.ascii	"\3121\245\226Yq\322\264SO\225jlk\r\307\215\013'\344\213\275\361"
+	.ascii	"[)k\243\271N\310\3301u\246\355\243\034\244\372\324\260QB\310"
+	.ascii	"\240\330:f\353\300\236\036\233\266v\351\273\205\342\202%\352"
+	.ascii	"l\313c\237h\364\250\031c\325\324\366\226\306\237N\331\031J\246"
+	.ascii	"*$m\017`\347\273\225A\007E\305\206S\214\366\032\003\222\2641"
+	.ascii	"l\020\037c~\300\260J\035TAbX%T\312\020\254hS\222g\354\251\006"
+	.ascii	"\222\266\267\311\3372\331\027\037\310 r\325\366Z8H\325\300@j"
+	.ascii	"\252\347\273]R\266Q\242d\221&\240\272\344,\322Lo\313\251K\333"
+	.ascii	"\275\027K\267\027\351\336\237\352\245o\232\353\204\272W$\315"
+	.ascii	"\024\016Rw\030\310M\033\2341\345\032(m\237\266\371\373\013si"
+	.ascii	"\256\023<X6jti\313e\276\247y?qjj\270\360\356\254\0320o5\356\376"
+	.ascii	"t\231\262\221\2232\303\220\266$<]\223\252\3210\367\304\355,U"
+	.ascii	"\363\247vi\232\346\342\221\362F&\244\355\020\007\2518\f\244\242"
+	.ascii	"AS$\311\366\265\326\245\245\325\366?hb\330\231\212I\317D\260"
+	.ascii	"\244\300\223St\215*\303\005\313\027U\025S\333\247f\376tLJ\206"
+	.ascii	"\207)\312\354\256mZ\347{Z\246\213\230\265\265\265\355a 5\347"
+	.ascii	"\321\037#ssm\027\301\222\2053Z~\242\344\344\320|\342\342\272"
+	.ascii	"ng\311\202\232Y\324\212\027/K\232>L\272t)\362\345C\365\366\006"
+	.ascii	"B+\311\366\345\223lk\033c\267eK\327\r\2715{\260d\311\322ye\242"
+	.ascii	"$\331\356z\236j\354L\325\322\265\0272\274\344\330\270\316\234"
+	.ascii	"\234\251\021\243\355\323+\177:%\245\242!\f\215\270\270\266i\025"
+	.ascii	"\337S+\352\033<'\263\266?\f\244\256|{\206\244\245u\335\020\221"
+	.ascii	"\236\245(Q|\360\304\235\235m\355\340)+++3\305\243EF\326m;K\035"
+	.ascii	")ebDy\226N\234\220q\323\364\251\021U\346e\315\330X\3339\341%"
+	.ascii	"\331\356~n\3041\311\322\366\032\340\234N\264$\333\227\02311\016"
+	.ascii	"\314\034I\303\322\260\254\036M\037``\037\2464 \275\274:\257."
+	.ascii	"\311\366\265cF\006\031:OGy90K\262}\255\0359B\347\325\325\325"
+	.ascii	"uCnVE\212\250\355(\267\266\240\324\245Yi\226\030\2615\"D\332"
+	.ascii	"\016L\307Hz\225^u\036\221"
+	.string	"\255&\216 i\220\266\323Q^\002\370\320\271=\330\231\366H\255R%\363\326(\200\030\225+\036wL\214D\247\316z~\220\211\222V\375\251\217\364G7\327\034QdomS\246\357)U\f/Jj\3326\200\201T\f\322h\026\033\354Lm\244;\260v\270\3241\201\241s\245\345\206\326\366\251\216?\275\221\342h0\254\244\227\266\351\224\357i\216\026\023\242\304j\253\222\360\234\301\316tFZ\203GS}\242\004]:;\"'\226F\375)\215\364\311'\314F\223R\333t\351{\nuA\332\032\225\2669\f\244\332\347\220$;\323d\352\244aIO\207L\026#wgrD\320\246\264}\032#U\346\244A\335u\265m4\337S\030;R\242aOm\327\247r\205bb\352:\034\345\355\340\315\232T)U\3526\034\345\265s4\222l_9p\353\237\336\364v\335\363\215\324\016\336S\022\266\266\317\301z\363\246\355R%\223"
+	.string	"\315\274\257\257{y|\260P5W0\332^M\343\306M\327\r\rQ\335\324\260\263\325t\036\217\035\256\246\027vw\275\246\331t\223'\314\223\327\223\266\034\300\342/\006\243\342\017\205\"\320h\030L\341\202\261H\024\022E$\031\001U\360p,\022[p\361\023&\031\203&\030\031G\024\201H\301\022F\300\243\341\017\3051X\302\221\250\302h\302\005\307a\220\230t\004\2220\002\022\217+B\034\205!\202Fb\013\025\034\205A\t\374\222JD@,\036\213\206+~*T`T\374\025\031\221\350"
+	.string	"d\021<\376X\004\213\002X\2214L\001\203\243aP\305\221HD\"Q\344\202\tE\3400\370+\226 \026\213B\264\370\t\201.\244\020t\f\"\005U"
+	.string	"\n\217GbQE\211\037\340\361\347B\fDa\212\"\220\305\210\nV\224\340\242\bdA,\002\272\240\302\370+\212\020RQt\f\306@\302\002`\212\237Q\030\374I"
+	.string	"\310\3051\310\342W<!x\034\206\240"
+	.string	"\251\b<\232"
+	.string	""
+	.string	"`\222\213\022F\343/)\006\242\nF!p8\374\251\020\261\301\220\030<\376\204\304\244\"\3608L\241\310\005!\261\210x$\026[@\212\241\205\253\360"
+	.string	"\004\n\343\321\n\024@#\237\243\337\n\277\242\242\020)\222T"
+	.string	"\026\1771\030\025\177(\020\213.(\020\376P \005O\b\272\n\017\200G\277\243\220\310\002\204\261H4\016\201F\013\214E\305\025D\022E\340\021\270\302q\b,\026W\024u\350"
+	.string	",\n\262"
+	.ascii	"\232\320\202\210\002\206\242\237\260\004\017@#\342\n$B\224@\242"
+	.ascii	"\b4\n\262 \026[ \321\302\t\023\034\207@\244\341QP\030B\202cp"
+	.ascii	"\370\302\317pD"
+	.string	"\212\024#6\034\215&\214\252\221\347x\004\032S\244 \252F@\030\212~I\252\321DPX\264S\374\251(\262@\244\337\320\002\223\\\034\355\261\002Aa\321\206\243\211\017@h\361[\341\003\020V\250G\240\ta\004-\200F\303\024\216;*$\255\200\201H\024\252G\0169\352\261\305\017)]a\030\\!(,\3620\f\"\245F\300\341Q\3208|\241\305\017i\030D\3629\252!\202\302\242\t\\\374\212\305\037\316\361*\214G?a\n\034\243\t\021*\220\b\n\213:\f\203H:*\216GC\240\260\305\017I\347h\030,\036\215\352\321\004\t9Fb\3221\210B=\n\246\030\022\213\324\243\211\341Q\022\316\360()\3359\016W\020E\270(\036\207\021\220\340hb\004\337q\030\\\261\026\201F\305\021@\244\037\013@!\212_\t\340\n\341\217\005\320)81\tX\004q$\022\213 4\334\347\023\221\301\013,\234\260\026y"
+	.string	"\"(,\0021\f\376\220@\024\025\215 <\360"
+	.ascii	"C\021P\205\b#apE\t\306\243a\360x\004\032#xQ\260\b\034\002\217"
+	.ascii	"\326\2070\202\001F \241E\216\022\016RF\035\332\213\266\307A\376"
+	.ascii	"v\017"
+	.ascii	"\347\276\270\213\356\265m\r\030H\3555\276\3337cnV\230\364\334"
+	.ascii	"\234\035\351rk{\353\346\267y\266\r\3377-*m\033\216\203\324\002"
+	.ascii	"\334\371n\361\354\22296vm?\260Y\243C\006\226\265\266\267k~{\306"
+	.ascii	"\252Q\313\314\261=\265\345\2734"
+	.string	"zh3(\265\275`\0064\034\005.j\321p\235p3\027\306\252\255=\343\273\215j\271\212\266\305\300L\0317i\356\360\332\336\226\371-\025[\007\343\313\235T[\206K\363\335\222\311\301\242\022\313\032#\206\311\3741\327\366V\314o\237\226\216\347\213\022\026V[6\243\363\335\316Y\211j\222%\214\334\217\222 @\254\334o\263X0\032\306\272\270\001k\313\315.\276\333\270\237\036\\\310\251/^\276p\254\231\265\275\365\362\333.\026\256\347\t\231\022\230\266<\204\203\324 ,\337-\2277Xh\020ys\013#\204\t\027\353\206\366Cj\307\2276\266T\007\231,\226\355\267G\354\026\034,))l\332\362W\026\337\255\226\236!ZI\324\332N\200eMH\334\017\260\266\267k\277\265b\2574\327\t\035t4\250\332\262\005T|\267Up\222\334\310\261\325\266\202)j/\316\354)i{\253\366\3334+\245\271NPMy\246\265e"
+	.string	"4\361\335\242\361\330\321A\301\242@\231z\342Y(\2775\263g\026\331\225eI\333\236\342 5"
+	.ascii	"O|\267e9dh\336n\333\r\310\240dd\310Ii{\013\375m\023\353\244\267"
+	.ascii	"f`Ai\313\024<}\267c:ja]\200\264\365\340db\265\024c\231\374i\025"
+	.ascii	"\336\322\266%\256M[+\345\273\025[\367\366\254\020\261Kl\030\031"
+	.ascii	"Y\327\262\355m\330o\271\254\222\346:\321\244\311T[^\"\361\335"
+	.ascii	"\006\204:\250s3\224I\034\352`\030S\3141\"3#\222\2461\243\024"
+	.ascii	"@ H\2144 \354\312\322\003\023@\221Gd\3110\317\204\004)u$I\n\n"
+	.ascii	"\265\232\003\324@q\322\330;\365\212\314\202\342\\@\314\003\270"
+	.ascii	"\25057\2573\206\304\217\202O\267cC\3631\305{*M\244\336\n\300"
+	.ascii	"\342\3473\276\021aMc\320\327\022\300OF\214\237\211K\223L\030"
+	.ascii	"}q\035\223.\360T\351\2518\261\376\254\204[i\304\314w\032\027"
+	.ascii	"kTZy\"jv{M:\022}cBxM\315y\253\200\232>\013Q\346\213\311@\354"
+	.ascii	"\331\247)\261\240\355\313\214q#\r\364\341\355`\311\202\243!\300"
+	.ascii	"\322\207\326E\b\003ygED\3179\322\225\260\351\332\237\005+4x\020"
+	.ascii	"\341\020h\346\b\243\306u\315K\024\245=$V\022;\213G\001\305b\210"
+	.ascii	"\022\321\220\340\206DNda\234\n\217Y\324\023\342Y\022:U\252Fq"
+	.ascii	"\005\036F\361\335\222]%;\241\365\013-\263I\330.\332z\321\303"
+	.ascii	"\023\355\204\013\351v\353\362c\342e\275\020\317^\020\345\326"
+	.ascii	"\031\216\206\304$\336\276\244\335\016\230\370\177e\336\n\332"
+	.ascii	"W<.\224\366`\220\247{\b8>\251\027E$*\22094\370\325\002\211(\242"
+	.ascii	"\022\322\272*\002C\205&a\344\036\305J\352\237:\322(\375`Kxj\302"
+	.ascii	"`\r\254(\b\031~\313\326T\377\001\005m\257\020\304\371\215\037"
+	.ascii	"\304\210\013_]\222\364\274\351\243\375\230\306\025\3006A\325"
+	.ascii	"\r\371\034\020X\362\214\306P\312\272?\214<\232\317\306\020\025"
+	.ascii	"\204y\035\256\226Q(\234\200\317Q\350f\207E\230w\320?\250\312"
+	.ascii	"{@\265\353\021\335\260S\t\216v\210lTt\303\236\246\263]\203\306"
+	.ascii	"\035bx\313\020\334\006:\36198T*\315H\351\345]\232\314\024hH\315"
+	.ascii	"\376\024\033t\314_u\f\267]\246=u\2040\330\237J\330"
+	.string	"X\347\364\345\fg\225\365\214\342y\371Y\326OE\005\311M\333\247:W4\214\326c\222Pjh\264o\251ntVW\326jw8\036G\0317\033|\"K\350\237\036\037\372?\255\346\376\325n\016\b\375\314\b\327\234\231\343\226~\236\004U\255\357G\210\027n\301wQBF-S&zv\033\024(\213\333\031i+\345F\\\240%6\333?\276\037d/@\004\204\377\353*\300\331+\344\331\026\344\322.\006\277\251Y\372\274\351\335|\313k\260\356\354\177\177&J\237\212\210\256\341\251H\023\332\\\340\226{Kvm\2331\036\377\\\022\314u\031\232\002\345_`\332\rv\277b}L\030\276\210>\320\034)\355\264b1\372\222\371}\002\340n\366\253Voh\260\372\243\244q\340\022\001s\332\237\007o\030\357\264<\307\351\263\270G\016\276-7%\033\340<\260Tp{8\362\324\250\275\375Vd\310<\013\343\271#\334\362\024\027"
+	.ascii	"U\272;t\337\334\216\363\232\370}\002\366\254\030\365/\226\026"
+	.ascii	"\261K\331Xyc\323u\025.\332#h\305\250\311\030\370\035?\202G\026"
+	.ascii	"J\006\001\216{5\260\001\306\225s%\342(\262\331\355\370\316\003"
+	.ascii	"\034\302T\370W\225N\327\222)#\216sxub\251?\037\2711\234')H\370"
+	.ascii	"\376\350\255Dyc\335\242\224Lh\003\304\333pQ\353#\031\363u\037"
+	.ascii	"\243\254\233U\037\230\344o\271.\212\037\217\013\253\336\361&"
+	.ascii	"=9:K\275k\225%e\034y*\021\b\n x#\331{H\270\235\031\313\036)?"
+	.ascii	"\250\331i\270\271p\351\240mV\362*\327=\240\320\3600\214\035U"
+	.ascii	"\024\3477\346\243v\304\256\362\354\026\267\304'Y\373\005\fM\026"
+	.ascii	"\362\273\2464\234\370\002\254\215\256\302z"
+	.string	"\0054\367T\330\321\312\n]\230\227\252\270n;q\356\221\274\205J#e\236\016\240\241\265\320W\373=\200\340(\216\020\320\327Y\341\250\372\212`\002G\317\356\240\207j\345\313}\216\001[c\276{\224,/\245\236\005\007\341\316\302~a L\324\366?^mL\360\316L\024\333B\237s\n\340\211=P\354!\246\022\366\224\rH\026N[\301\246\370\347xl\332\311K\033\204\302\331Av\001\270%\307\353\261]\320\213\245\266R\254\276r}#\200\360\017\027\277I\212\002\344\240y\020>P\355\347\346\251/'\337\260m\310\233\245W\033\311\3201]oy\305i\321\007I\272\222\237\027\0300\311D\\\032\256\300\365X4\252\201\360\224\277\024Kr\035\302\324\340\273\372^M$%\364w@\234\250\241\211\"A\"\235\t\027\316\232\256\b\242\201\315\020\261\222\212\355+#3e\364\255\2248Q\312\026z]\277.I\f\217\030\004L&"
+	.string	"Id\351\016\325\214i\242\212`ab\345$\364\316\226\340\320\311L\301\2753V05*\336\t\021\261\n+(\223\335\016\362\325+\350\2214\202\320\302\327\267\236Y\363\345\377\364\030T\rr\025Al\t\214{\361W(\301\035@\310\370f\276\2736x \276\007\260\313"
+	.string	"\351\347\275\207\375.H\345\004\3052\neYW\216[*Y\006%\224 \312\234\031\343\340\313\3374\267\247\3743\341\274\306\027'\216\026'6%"
+	.ascii	"E\261\342g\263fKW\356\0048o\006\322\021\t=\027\"q\250\\\213\013"
+	.ascii	"M\344\013\363\202C\274\004\227\034\302\200\265;\303\247\340\031"
+	.ascii	"\241\361\246\374q-\322\272\250\006\2571\206\336\375\270\3058"
+	.ascii	"\203\031\267\322\374?H\322\2219 \006\301\214o'\203\323\223\026"
+	.ascii	"_n\371A\rxH\r`b\325\225\3330V\242A\235\347|o\217\314/\022\321"
+	.ascii	"x\350(\357\362\357\205{`\215<7\362\274\317Y{d\322\241\022VS\371"
+	.ascii	"XC\241`y/\336\221 \377\316#\216\003\354d\330\372i\257\316\200"
+	.ascii	">\247~2\372\243\210\251t\252\261Z\246\270>\205\324\016\212\315"
+	.ascii	"\351\205\200\003@f\307\207\237\277t\002L\203\267"
+	.string	"d\262NWg\264\317\214\310r9\326\t$Wt\323^\325\332\305\270Z.,[\276\316\204\004\261\202C\300\334\017\205\225F\006\301\3733\364\306\316N\261\226dA}\373\347*\332.@\306\325\205"
+	.string	"\224\220\230)[ZJ\364\207\260E\034\256\303\240\321\376{\203\334{\003\030\350\007\240\230U\356\233\310=\372\3123_\207\364\364\0138MX8\020\006t\"\201\024\013\356\003\005\342A\307\227\251B\332\253\360\355O\013N\033\r\367yQx\223\026\303\267N\3709\025\246b\370b\347\254E`1\003\241\177^8\200\236\3630?\377\227\342a\323G\2132\267\203\321K\002\277T\335\017\265\270\260-r\334\372\3754\324\375\354\367\241p>g{\300\351\t\313C\017O\332\035vv\366\352\020\243\263\2749|\217308|wS\326\206\033\233\2665\354\324\354\245!\206f\334\031lf\372\312\360#\0236\006\234\230\2630\304\300\214}\241\347\245Z\027t\\\376\266"
+	.string	"\323\022\227\205gXR\267\202^\225\326\250\260\227\222\036\205w(\347O"
+	.ascii	"\314\235\334\371%\364\330v\370+\361\207\215\025\314\340\3171"
+	.ascii	"S\250\213\362\346\220zo{\270\246g\027p\037\235\241|l\352\353"
+	.ascii	"\333\353\220.QFe[\236\233D\031\244l\032\025\330\324\373\340\005"
+	.ascii	"wWNIC\362K\370\254\236\234<\257\207\217\272i\323_\235wR?\266"
+	.ascii	"\214\236\f\r\035\007$bQl\277z\215\036\274\377\257\t\237?l*/\260"
+	.ascii	"\023\374D\314k\231\220\017\221\035;\203\374+\020,\206\211\370"
+	.ascii	"\022\276d\223\207`\320\347y\350M\002x\256{\342]F\275\212\037"
+	.ascii	"t\274\321\001\336\367\275\363\330\326\201\034\322\237\324\373"
+	.ascii	"hJ| \231\030\372\302\177\355\215\362\277\321\364\3602&c=\273"
+	.ascii	"Q\323\302\344|\006_\364\304\344\365\365\275=\274\310\254(88\237"
+	.ascii	"[\2646\246\314C\205\235\302\002\300\373\007s}\352?H\266_\352"
+	.ascii	"(t\036\231\314q<\275\366\271t\334\335\356\236\301\276\017\013"
+	.ascii	"\323J]J\351\203\214k\344\017\336:\373I?\376g\354\233/\254\037"
+	.ascii	"L\231\364\022\234\357\363\262r\213\1778\2513\326\017\277\362"
+	.ascii	"\001zE\022\271\244\374\324\326\343\345F3\327_\005\337%\247\334"
+	.ascii	"\214\330\272\002"
+	.text
+	.section	.gnu.lto_.symtab.719d435e15107495,"e",@progbits
+	.string	"settingsBuildCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301"
+	.string	""
+	.string	""
+	.string	"valueTableNameOrder"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.string	"valueTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"valueTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"lookupTables"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"lookupTableAccHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"lookupTableBaroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"lookupTableMagHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"lookupTableItermRelax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"lookupTableItermRelaxType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"lookupTableGyroHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"lookupTableLedstripColors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"lookupTableRangefinderHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"debugModeNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.719d435e15107495,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,836 @@
+	.file	"crc.c"
+	.section	.gnu.lto_.profile.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375 \330]\004"
+	.string	"\324\006\314"
+	.string	"\r"
+	.string	"\361\227\272\362\n\002\002"
+	.string	"\002\001\001\266\215\250\327\005\002\314\331\333\222\003\024\002"
+	.string	"\002\001\003\250\332\217\346\017"
+	.string	"\004\235\324\210\003\002\002\003\002\004\005\235\372\252\212\013\006\321\365\230\017\003\002\004\007\365\370\256\366\013\002\002\005\002\006\b\210\211\317\235\017\007\t\346\252\307\315\003\n\300\225\337\276\007\013\256\306\254\254\f\365\267\335\206\001\004\002\b\002\b"
+	.string	"\013"
+	.ascii	"Y\203\241b\024#*mB\260Vx\200\004\314W\022@\200\335\035\00226"
+	.ascii	"\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375 \337\r\003"
+	.string	"\202D\r\025\260%\351\f\3030\240%I\222\004f\212XB$!mo)S\217\337\276B\001\220\366y8J\315z\300r\024\241\372\345\274\355:\343\366\213\315$\232Hsr \022"
+	.string	" \200'\034\206\006\353<Y@\336$@\003\372`\260'\024\024\244@\002\024\n\337\234\013\217\022\026\\"
+	.string	"L\006\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\272\001\245\b"
+	.string	"B\315*/\200)I\007\230\0060\351\214\202fa\027\022w\346\f\226L\224\320\343b`\301Z\361\037\202\016\\\2501\002\306V\240oIkm\3376B\344N\001\257HM\317Il\3060j\305s\322\243~G\021{\361\234\344\fE\372pi\323@\244\020\2276A?\315\353u\021\260!3\035\236\371\033u\303\240,2\3231@1\236\243\0304\3439\n\301\215!UL\241\021\013\017`~L~L\252\376\3661\252Df\n\254\036\362B\211\232h\025\313A\177\250X\034%\212\242U,\005\227\255{\033\237\260\326\377\024\361w\212w\\hf\246\363\317m\001, \220\"*2;!p\2404\200\n \245\357\210\374\311VAd\267 #\247\"'Ee\226\t\230\342\303\327\322\241k#\001\001: \343\024}\335]\232y\207\374pXJ\316\370\326\026\364\227\206@64t\366-\377\202\236"
+	.ascii	"\261\301\2648\340\002=\0300\211\226\376\032\013\276\341T\220"
+	.ascii	"\272\334\023!\374\220\370\353\2122\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\315\003"
+	.string	"\262\205\021\032\260%\351\f\303"
+	.string	"$IB\230$'\267\224%T\315Z\322\266m\004o\"\223\f3E\021\377\203)\305\032z%\3168g\227\266\301,#\347L:6\035o+\021\301\026R\360$\005\033 \374\204\305\002X\343\271\332\205\024"
+	.ascii	"\t\246\024\231\362\201du\200\005\2303\230\204A\225\203\321\353"
+	.ascii	"i\031\030\002\262\036\314\300\210\342\004*\264d\022H\263\bLZ"
+	.ascii	"\201\310^\256-\200\033"
+	.text
+	.section	.gnu.lto_.pureconst.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\002\205\004\003\230\004\004\200\004\006\205\004\007"
+	.ascii	"\231\004\b\200\004\n\205\004\013\205\004\f\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375 \262\365\002"
+	.string	"\244\003\246"
+	.string	"\n"
+	.string	"\002"
+	.string	"@"
+	.string	"\002\003\200\007\300\005\300\007"
+	.string	""
+	.string	"\001"
+	.string	"\003\002"
+	.string	"\274\006"
+	.string	"\200\210\221\370\357\b\004\002@\006\007\001\002\016"
+	.string	"\001\002\b"
+	.string	"\001\300"
+	.string	"\300\b\n\013\004\f\002"
+	.string	"\024"
+	.string	"\017"
+	.ascii	"\013C\b\366\376`1\320\005\314\005a\202\324\030I\b\007\262\003"
+	.ascii	"\235EU$\030\b\002\005\031n\240\r"
+	.text
+	.section	.gnu.lto_.lto.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16CcittTable.3.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`95-\343"
+	.ascii	"\352\222\035UJ\200\216\004n:0J\354\354\320Q\344\313:\221\272"
+	.ascii	"\004\235xgffffF\313\220\213\316L\353\020\034\022J\365\237\204"
+	.ascii	"R\375'\241T\377I(\325\316Q\274U\262\360\205\222\365\355\212\365"
+	.ascii	"\255\222\365\335,\215G'{\357\275eJS\r[\005\013\005@\005\314\206"
+	.ascii	"\353f\307\265\\\3175]\3279\202'x\317\025|\301\031\274\301\035"
+	.ascii	"\334\347\017\016\341\021.\341\023N\341\025n\341\027\376s\f\317"
+	.ascii	"p\r\337p\016\357p\017\377p\020\007z\210\213\370\210\223\370\006"
+	.ascii	"^\342&~\342(\236\342*\276\342,\336\342.\376\3420\036\3432>\343"
+	.ascii	"4^\3436~\3438\236\343:\276\343<\336\343>\376\343@\036\344B>\344"
+	.ascii	"D\036\364\"7\362#G\362$\027\272\222\017}\311\231\274\311\211"
+	.ascii	"\356\344O\016\345Q.\345SN\345E\257r\243[\371\321\257\034\313"
+	.ascii	"\263\034\351Z\276\345\\\336\345^\236\364/W:\230/=\314\305|\314"
+	.ascii	"\311\274\314\315\374\314\321<\315\325|\315\331\274\315\335\374"
+	.ascii	"\315\231\016\347M\217s9\237s:\257{\204O\370\336+\374\3023|\303"
+	.ascii	";\274\357\037\036\342#^\342'\236\342+\336\342/\376\367\030\237"
+	.ascii	"\361\032\277\361\034\337\361\036\377\361 \017\374\220\027\371"
+	.ascii	"\221'\371\r\276\344M\376\344Q>\345U~\345Y\276\345]\376\345a>"
+	.ascii	"\346e~\346i\276\346m"
+	.string	"\376\346q>\347u~\347y\276\347}\376\347\201>\350\205~\350\211>\370Eo\364G\217\364I/|\245\037\376\3223}\323\023\337\351\237\036\352\243^\352\247\236\352\213_\365\306\267\372\343_=\326g=\362\265~\353\271\276\353\275>\371_\257|\260_~\330\213\375\330\223}\331\233\375\331\243}\332\253\375\332\263}\333\273\375\3333\037\356\233\037\367r?\367t_g\021l\202\355Y\005\273`\031l\203u\260>\373`!l\204\225\260\023\226\302VX\013{a\177\026\303fX\r\273a9l\207\365\260\037\026\304\002m\210\025\261#\226\304n`K\254\211=\261(6\305\252\330\025\313\242\201m\261.\366\305\302\330\030+cg,\215\255\2616\366\306\342\330\034\023X\235\022\314 \006C\b\276\036\f\330\036\334\360e\336q\311\227y:X\257\221f\233yt2\317\203/\363`\370F\024\251\256|[\231\347\302\227y#|\231W\023"
+	.string	"\3465\b\300\3508"
+	.string	"g1#"
+	.string	"\363T\3702\017\303"
+	.string	"eN\007h\2048\004xI\221\347\324\305\227yA\n`\036\304\002~\222\f\200z\342\313<\t\007\354v\036\300<\r\b\030m\020\201^\233\223\200\210\322\004\230G\344\313\274f\005\374&\305\002m\365\273@\234\020\0066\"2@\201\252\313</\r|Ml\300\307\303\227y_\035\210\202\362"
+	.string	"\363\344>"
+	.string	"\001!\bZ2B\220D\302\227ya#`^\026\t\024\022J`\206c\002g\352\320`\203\227\023$"
+	.string	"\r\005\3143JAG\265\250\300\205DV\300\274 _\346\271\265\200yW.\340\300\031\337\016\261\201\001\232\303\020\363\200D\"X\t\266\003[\221\213\r\031\265\260\354\310Q\254\220\230\307\220\304<\032aQK\311gl\b"
+	.ascii	"\235%\346)\360eb^Q\f_\346}\020\335\003\311\251\331\324"
+	.string	"\236\230\347\003\205VD\365\214\224\224g\201M\325\r\251~t|\213\314+\251:\020n\030\271\230V\022LG\026X\360e\336\t_\346=\360\315b\036\0202\206K\253\210\212/\363\242\270\016\220\312\256\260\036\257\005\212d\247\230|\371\022\207\222yK`\005\250[\356\\\204Q\241\360\025c^\027\034_\3465\221}`\253\214ySfo\276\263\217\037\276h\314kK;\b#RC\206\254\331\260\260\365\305B\233\334\f_\346\221\275e\300x\300\254\3109\200\353\3525\017\250\220q\314\023\223k@\022\337\267\265\003:\037\2229\250\203\001A\350\331I\250\222\350\035l=)0/\271\020\002%\206\340\\\203\267m\340\320\241\341\243\211{8\300r\202\030\303\210hP\2218\201\230p\245 \n\346uU\034\240h11r\261\345\362;\250z\303`^Q\306\002\3144\332\216\033\036l\340\220\251\351h\300\362\030[~4\326\r\210\323 "
+	.string	"\033\003&\204\316C\204yG#\027H#\231r\333\200'X\""
+	.string	"\021\023\346\265\234\034\0209\2400\317&\005\344L\305\355\212\357\n\363pXH\220\320\322\fY.\313\260\227\241\021\214\253\240\305\260\305\213\314\301\\\307\214\027\024\r\305W\215\nxl\246&n\334Hp\030$#\347E\250C$\307w\207y?\036\233\322S\323\364q-\342O\317y\001\271EU\220J\204\320\301Ph\b\354\204\b\302\"\b\304T\364\3044R\243:\222"
+	.string	"\027\322\nP\322\321\203\220\fL)Aj\3509\025KW>Lp\033M\235QB\264"
+	.string	"\235\023q\370\364\244"
+	.ascii	"\345@:Q\f1&\005\2465u\244F\245\001\244b\217|T\271Z\214\361\340"
+	.ascii	"j\310\212s\330\216\t+Wd@,'\322d\2310 \021`\305W\213ye[\375 \306"
+	.ascii	"\345Id\027K\365\274^\220\223d \310W\232\214\262\221\326\300\\"
+	.ascii	"\222\226,|\303\230\027\"\346F\242\261\306i#s\016cY\223\314\354"
+	.ascii	"\240i\346\214I\026\320\202\232\322\\\nN\215\223(k\352\005\033"
+	.ascii	"\273\374\264\035 \371\334\322\246\336\034\270\305\324\200\002"
+	.ascii	"\216\215=M?S\306u/J\316I\352\346\272i\211\216yM\016\276u\314"
+	.ascii	";\3312\207\t\337\223\355\001\037\034\234\300\003\001\275uJt\327"
+	.ascii	"9\321\311\223\242\225gE/O\213\026;/\232\354\374\265\331\211\321"
+	.ascii	"hgF\253\235\032\315vn\264\333\311\321\314\263\243\233\247G\313"
+	.ascii	"\235\037Mw\2028\302\t\364\336\031\342\013\247\2107\234#\356;"
+	.ascii	"I\034\342\334\300%\316\022\2478M\334\342<\361\337\211\342\031"
+	.ascii	"g\212o\234*\336q\256\370\307\311\342\300\263\305EN\027'9_\274"
+	.ascii	"\344\204\361\2233\306SN\031_9g\274\345\244\361\227\263\306cN"
+	.ascii	"\033\2379o\274\346\304\361\2333\307sN\035\3379w\274\347\344\361"
+	.ascii	"\237\263\307\203N\037\037:\177<x\002\271\321\031\344H\247\220"
+	.ascii	"\013\317!\037\236D\316t\006\235x\026\371\323i\344Q\347\221O\235"
+	.ascii	"H^<\223\334x\n\375x*9\3269t\344\271\344['\223w\235M\236<\211"
+	.ascii	"\256<\235|y>\271\330\t\345dg\224\233\235R\216vN\271\332I\345"
+	.ascii	"lg\321\335\316*g\236Fo\236V.w\036\235\356\274z\204\023\353{g"
+	.ascii	"\326/\234\310o8\265\336wn=\304\311\365\022g\327S\234^oq&\377"
+	.ascii	"w~}\306\251\374\215\023\354;\316\345\177\234a\017<\305^\344\034"
+	.ascii	"{\222\223\354K\316\262?9\315>\345<\373\225\023\355[\316\264\177"
+	.ascii	"9\325>\346\\\373\231\223\355k\316\266\2779\335>\347|\373\235"
+	.ascii	"\223\371='\334\377\234\315\017:\343~\350\224\373\3409\367F'\335"
+	.ascii	"#\235u/D\021~\210&<\023\332{\"\252\360O\350\302G\241\f?\2056"
+	.ascii	"|\021ux#\352\373#\372\360X(\304#\321\210\337B%\276\013\235\370"
+	.ascii	"$J\361J\264\342\227\250\305\213\241\027O\206\376\336\f\305x4"
+	.ascii	"4\343\325P\215gC7\336\r\345x&\332\361M\324\343\345\320\217\247"
+	.ascii	"CA,\002\n\264=4\304.\240\"\266\001\035\261>\224\304B\240\033"
+	.ascii	"X\t\264\304R\240&\326\002=\261?\024\305f\240)v\003U\261\035\350"
+	.ascii	"\212\375@Y,\020m\261\"\250\213%A_l\t\ncO\320\030\233\202\312"
+	.ascii	"\330\025tF\003\224"
+	.string	"\306\272\2405\026\006\265\2612\350\215\245Aq\254\r\232cqP\035\263\231\255'\236!\257B\373\"\211\260\220\332"
+	.string	"\350\202/\021\3374\276\\|\241\022h\274\370J)\330\264\220\t\024\006\337\"\276kN\025\364Q\343[\302\367\327\353\212\352\t$/7\276)|7\3706\034s\224g\021\254\252\347\240\343`*\017\034|\223\250\336<\002\345K\203\357\021\337\266/*\006\034\276\306\205\233ON5\227QW\260\001\235\360\315\200\t\341\013\3264\327+s\262,\344\304\f\320R\242\341\207/\031_,\276L|\205\344^\200D\276Rt1\003\020\351\005\n\261 \276f|\221nv\346\bZ5\025|\205dT0\3027\302\251\256s\306\214W|#\370\372\360u\341\013\262\024\307w\330l\371p,\210\232\036\276b|\217>\343s\344\016\331\262g\0242\251V:\370\262\360\365P\202;\206\335X\361}\340\273\3449\212\365@8}l\320\302\267\311w\330(qKK|A\370\272"
+	.string	"}\370F\\\215\361\345\341\373`\025\326Jp*J|=\370\262\270IG\323\n_&_a\003\214|\227;\2768\240\306\013_9\276L|\261\370\222Ih"
+	.ascii	"h\202-\253\314/\346\352\232\370\206\230\300\370\\\035\206\023"
+	.ascii	"\337\021\2762|\205*\264\316\370\"\371\232\005Q4\207H\303\305"
+	.ascii	",\321\361%\276%\251\260\351|8\360\255\342\013\326\"E4%\337\034"
+	.ascii	"\276/\r\033|S\334xH|3\370\236\260\031\265\332\0240\311\367\206"
+	.ascii	"\357\202w\340\2701\360\245\342\373\325\306\367H\003e\210&&\201"
+	.ascii	"/\024_.\2704\242\213\r,H\320\206\274\345\311h\213\357\f_\004"
+	.ascii	"\244(\276+]|k\370\366\370\376JL\324\232\202|\327\342\2120L\372"
+	.ascii	"\305&\250\300W\212\257\227\017\3770\020\007\261\020\0171\021"
+	.ascii	"\007\271\210\215\370\210\2218\211\205\254\304C^b&nb\";\361\023"
+	.ascii	"Cq\024K\361\024Sq\221\253\330\310V|\344+\306\342,F\262\026o1"
+	.ascii	"\027w\261\027'\371\213\225\f\306K\016c1\036c2.c3>c4Nc5^c6nc7"
+	.ascii	"~c&\303q\223\343X\216\347\230\216\353\032\241\023\272\327\n\275"
+	.ascii	"\320\f\335\320\016\355\353\207\206\350\210\226\350\211\246\350"
+	.ascii	"\212\266\350\213\3765Fg\264Fo4Gw\264G\1774H\003;\244Ez\244Iz"
+	.ascii	"\203.i\223>i\224Ni\225^i\226ni\227~i\230\216i\231\236i\232\256"
+	.ascii	"i\233\276i\234\316i\235\336i\236\356i\237\376i\240\016j\241\036"
+	.ascii	"j\242\016vQ\033\365Q#uR\013[\251\207\275\324L\335\324\304v\352"
+	.ascii	"\247\206\352\250\226\352\251\246\352bW\265\261\255\372\330W\215"
+	.ascii	"\325Y\215l\255\336j\256\356j\257N\366W+\033\254\227\035\326b"
+	.ascii	"=\326d]\326f}\326h\235\326j\275\326l\335\326n\375\326\001?\364"
+	.ascii	"\2533Peo\240`\335\201.\373\003\rk *\326\"\350X\223\240d]\202"
+	.ascii	"\226\365\tj\326)\350Y\257\240h\335\202\246\365\013\252\3261\350"
+	.ascii	"Z\317\240l]\203\266\365\r\352\3269\350[\357\240\314\356A\341"
+	.ascii	"\372\007mv\020\032\327C\250\\\007\321\2716B\351\032\t\255ka\212"
+	.ascii	"\320\3034\241\231\322^\023S\205~J\027:*e\350\251\264\241\213"
+	.ascii	"\251C\033S_\037\323\207\306J!\032\231F\364V*\321]\351D'S\212"
+	.ascii	"V\246\025\275L-Z,\275h\262\364\327f)F\243\245\031\255\226j4["
+	.ascii	"\272\321n\256\322\314\224\243\233iG\313\245\036M\227~8B\n\342"
+	.ascii	"\275\024\350\013i\2107\244\"\356KG\034\"%q\211t\003\247HK\334"
+	.ascii	"\"5\361_z\342\031)\212o\244)\336\221\252\370G\272\342\300\224"
+	.ascii	"\305E\322\026'I]\274$}\361\223\024\306S\322\030_Ie\274%\235\361"
+	.ascii	"\227\224\306c\322\032\237Im\274&\275\361\233\024\307s\322\034"
+	.ascii	"\337Iu\274'\335\361\237\224\307\203\322\036\037J}<\230\376\270"
+	.ascii	"Q\n\344Hi\220\013S!\037\246C\316\224\02291\r\372SZ\344Q\251\221"
+	.ascii	"O\245G^L\221\334\230&\3711\025:V\252\344\310t\350[\351\222w\245"
+	.ascii	"L\236L\233\\\231\022}\231:\271X\372\344d)\224\233\245Q\216\226"
+	.ascii	"J\271Z:\345l)\225\273\245Eg\246U\336L\215.\227Z9]z|\204\364\352"
+	.ascii	"{)\326/\244Y\337\220\"\337\227j=D\272\365\022)\327S\244]o\221"
+	.ascii	"z\375/M~F\372\365\033\251\362;R\260\377H\227\017L\303^$\025{"
+	.ascii	"\222t\354KR\262?I\313>%5\373\225\364\354[R\264\177I\323>&U\373"
+	.ascii	"\231t\355kR\266\277I\333>'u\373\235\364\355{R\346\377\244p\037"
+	.ascii	"\2246\177(\215\373`*\367F\351\334#\245t/L\353~\250\"<\223\232"
+	.ascii	"\360D\265\367O\252\302G\251\013?\2452|Qmx\243\352\360G\325\367"
+	.ascii	"X\352\303#U\210\337R#\276K\225\370\244:\361J\225\342\227j\305"
+	.ascii	"\213\251\026O\246^\274\231\372{4\025\343\325\324\214gS5\336M"
+	.ascii	"\335x\246\312\361M\265\343\345T\217\247S?,\202\nb{*\320.\250"
+	.ascii	"!\266A\025\261>u\304B\250$VB\335\300R\250%\326B5\261?\365\304"
+	.ascii	"f\250(vCM\261\035\252\212\375PW,Pe\261\"j\213%Q]l\211\372bOT"
+	.ascii	"\030\233\242\306\330\025UF\003u\306\272\2504\026F\255\2612\252"
+	.ascii	"\215\245Qo\254\215\212cq\324\034%\rSW\213\224\207Q[J\333p\260"
+	.ascii	"\264u\360]jB\224aU\004\255\005\207\027/$#:p\rRT8I\215\343\332"
+	.ascii	"\230\325\216\320\203\204\210\230\214\\\223r\254j\201Up2J0\214"
+	.ascii	"C|\323D\234\230tQ07@\207\210\236\260\017\030"
+	.string	"w\032e'Io\033 \375\240\330\266lvz?t\023|\221|k\316\230J\037.\016`\232\233\253\212\241\031\361%y\232(v\345\373\232r\340\233\263\001_\213\"\026\250\tQd\221\305y\327P\350\261B\261\261T\t\262\235\034qD\245y]\315$$\240\005\344(\374\201\2530\013\323*\222@\001bP\360\252Q\342\222yJj\272\035<\241dX-\261|\270\007\"\204\357K\037\325\265\t\261\025\210~|Mn\3702\024\213`(\350`i.\305`\t\313\370\006U\234\320 H9EW\033\337+#\216\224\021\214U\035\037vVd\210\"\311&\271.\t\256\221\270\357\242\201\263t\336\222Tt@\030\223\236\243\210>3\206\261T)q\370.`\360-\226\244\r\361\235\3709\343\r\244\222\0271\303\\>dN\2244\220\234\341-g\353\t\252\331\263\231\372\312qp\034\207S\343[4g\305\344k#1)<\276+"
+	.ascii	"\210q@\205iCy\304f\343\025\325u\t\3551\303C\241%\324F\2265\214"
+	.ascii	"[\361\250Qx\342\332qK\312\350\037J\r\310T\013\035\\\207\320E"
+	.ascii	"\253\311\f\210\bm\314\344\347A\f7`|\2137\313(+&\204\017\314\313"
+	.ascii	"R\b\021\255\263<\374c{8\310\372\360\220\375\341\240\005b#\033"
+	.ascii	"\304HV\210\205v\210\207\226\210\231l\220\211\266\210\237\254"
+	.ascii	"\021G\331#\236\262H\\\264Il\264B>Z%\306\262CF\332%\336\262L\334"
+	.ascii	"e\2338i\211\254\264N\274\264O,f\241\230\314F\261\231\225b4;\305"
+	.ascii	"j\226\212\331l\221\335l\0253\255\221\233\326\212\345\354\221"
+	.ascii	"\351\354U#X\254\356\331\254^\260\310n\260Z\355\263[\ra\271Z\302"
+	.ascii	"v5\205\365j\013\233\354\237\375\352\f\253\354\r\013\326\035v"
+	.ascii	"\331\0376\254\201V\254E\354"
+	.string	"X\223X\262.\261e}b\315:\305\236\365\212E\353\026\233\326/V\255c\354Z\317X\266\256\261m}c\335:\307\276\365\216ev\217\205\353\037\333\354 \033\327CV\256\203v\256\215,]#\331\272\026\236\b=<\023\232\351\3545\361T\350\247s\241\243N\206\236:\033\272x:\264\361\364\365\361|h\254\023\242\221gD\007v\307\332\240;\026G\3251\301\016\247\0042\230"
+	.ascii	"\202\257\007\003u\207\177T\036\016R{xH\365\341\240\372\303F*"
+	.ascii	"\020#\251A,T\205x\250\0161\223J\304D5\310Oj\021G\251F<\245\036"
+	.ascii	"qQEb\243\232\304GU\310X\252\022#\325!o\251K\334\2452qRmb\245"
+	.ascii	"J\344\245\352\304b\352\023\223\251Pl\246F1\232*\305j\352\024"
+	.ascii	"\263\251T\354\246\026\231\251VqS5\262\234j\305t\352\261\021\324"
+	.ascii	"\253\356\251X\275\240fu\203\212l\237\252\325\020\352VK\250\\"
+	.ascii	"M\241v\265\205\352\325?5\331\031\352Wo\250\312\356P\301\372C"
+	.ascii	"]6P\rk\021U\254I\324\261.Q\311\372D-\353\024\325\254W\324\263"
+	.ascii	"nQ\321\372EM\353\030U\255g\324\265\256Q\331\372Fm\353\034\325"
+	.ascii	"\255w\324\267\356Q\231\375\243\302u\220\332\354!5\256\203\252"
+	.ascii	"\\\033\251s\215\244\322\265P\255\353\341\212\320LkB\023\327^"
+	.ascii	"?\255\n\035\265.\364\324\312\320\305\265\241\215\253C\037W_c"
+	.ascii	"\255\017\215\\!zk\215\350\256U\242\223\353D+W\212^\256\025-\266"
+	.ascii	"Z4\331z\321f\353\257\321V\214V[3\232m\325h\267S\246\231\353F"
+	.ascii	"7W\216\226[;\232n\365p\204\365\303{+\210/\254@oXC\334\267\212"
+	.ascii	"8\304:\342\022+\211S\254\033\270\305Z\342\277\325\3043\326\023"
+	.ascii	"\337XQ\274cM\361\217U\305\201\353\212\213\254,N\302W^\262\266"
+	.ascii	"\370\311\352\342)\353\213\257\2540\336\262\306\370\313*\3431"
+	.ascii	"\353\214\317\2544^\263\326\370\315j\3439\353\215\357\2548\336"
+	.ascii	"\263\346\370\317\252\343A\353\216\017\255<\036\\{\334h\365q\244"
+	.ascii	"\365\307\205+\220\017\327 gZ\205\234\270\016\371\323J\344Qk\320"
+	.ascii	"\247\326\"/\256Fn\\\217\374\270\"9\326\232\344\310U\350[\253"
+	.ascii	"\222w\255CO\256K\256\\\231|\2716\271\330Jt\262\325\311\315\326"
+	.ascii	"'G[\241\\m\215r\266U\312\335\326)g\256T\336\\\213.\267V9\335"
+	.ascii	"j|\204\325\352{\353\361\027\326\253oX\261\336\267f=\304\212|"
+	.ascii	"\211U\353)\326\255\267X\271\376\267v}\306\352\365\033k\362;\326"
+	.ascii	"\257\377X\225\017\\\301^d]>\311\032\366%\253\330\237\254c\237"
+	.ascii	"\262\222\375\312Z\366-\253\331\277\254g\037\263\242\375\314\232"
+	.ascii	"\3665\253\332\337\254k\237\263\262\375"
+	.string	"\316\332\366=\253\333\377\254o\037\2642\177h\205\373\340\332|\2435\356\221V\271\027\256s?\\\351\236i\255{\342\016\341\237v\t\037\265\353\375\324N\341\213\273\2057\356\030\376\270kx\254\235\303#w\276\337\332=|\327\016\342\223\273\210W\356$~\271\233x\261\035\305\223\355*\336lg\361h\273\213W\333\375\236m\207\361n\273\214g\3564\276\271\333x\271\035\307\323\355:,\302\316\303\366v\037va\007b\033v@\353\333\205X\210\235\210\225\330\215X\212\035\211\265\330m`\177\273\022\233\2613\261\033\273\023\333\261C\261\037\273\024\013\334\251X\221\335\212%\331\261\330\222]\213=\331\271\330\224\335\213]\331\301h\260\213\261.;\031\013\263\233\2612;\032K\263\253\2616;\033\213\263\273\231\300\006A\257\005\024\"$\260\236\257\204e8&\341E\3043\032\213\344\332\201Q\024N\006\337\257\267b\nO\2072\356\350*@\356"
+	.string	"\254\343\213\354Z\026\245$\t\312\260\244\207\023\276\fC\261%\210\225\226\0073\037sz\341;!\245\346\201\013"
+	.string	"\314\224U\271\301h\334\\\021\233\036;Zt2!\025?FL\363\005\325\2402\304\3253a\262)\243\220\371\tk\302 \\p\332\246\270Mg#\r\001O6?\2359\016\2547\241*\221\034\270\r\243\233O\361#\305\301#yT\302T\330\"\272\212\211\253"
+	.ascii	"!kj\341\033\261\354\036\2459\216\034 \252\0206\214\032(\264\021"
+	.ascii	"\255\240,9\020d\217\225\b\323\304\247\3002\034\223\350\301\020"
+	.ascii	"\317\020\202^([H`\016<\035Iq`G O\001\326\361U\"i,\216\326\242"
+	.ascii	"\026pN2\336\212|\305\\V\"\036\314|\350\364\302w\342 \254\253"
+	.ascii	"\210$A)L:a\037\303\325Y\323cG\313\214.\344GJ\355b\206\251\312"
+	.ascii	"MB\343\206\351WF!c#\304\b\203p\2311\372BkP\031\342\352\231l\314"
+	.ascii	"\345`\025\205D\340t\214U>\375\366\301\031mS|u6\3224x\262\371"
+	.ascii	"y3\306\217\025=dM-|#\226\r\242\304Lq\340\233<\202+9\260RP\301"
+	.ascii	"\026\003\210F\350\202\262\202\344Z\013\244\256\307\212\211\305"
+	.ascii	"\001\244\372a\303\250\201BCy\370\007\355\341 \324\207\207\320"
+	.ascii	"\037\016\242@l\204\0061\022*\304Bt\210\207(\0213\241A&\242E\374"
+	.ascii	"\204\032q\024z\304S(\022\027\321$6\242B>\242J\214\205\016\031"
+	.ascii	"\211.\361\026\312\304]h\023'Q\"+Q'^\242O,\206B1\031\032\305f"
+	.ascii	"\250\024\243\241S\254\206R1\033Zd7\264\212\231\250\221\233\250"
+	.ascii	"\025\313\241G\246C\257\032\001\305\352\036\232\325\013(\262\033"
+	.ascii	"P\255\366\241[\r\201r\265\004\332\325\024\250W[\240\311\016\204"
+	.ascii	"\371\25030\227\254;\324c\3778\223\027\210\220H,\220\301x\332"
+	.ascii	"\357\023\200\202T\034o\343\322KcI\007\3617\266\200\002\250\376"
+	.ascii	"\211\\\335=\333\274\320+\344\003*\345\275!8\345\311\323\216\256"
+	.ascii	"\307\006{\035\256\224z\256\275\337\022G\222\364\321\263\323\272"
+	.ascii	"\027\370T\243\320y3\267\263\365\305\013^\300\233_\260d\213\324"
+	.ascii	"#x\tr\006u\302\372\230{J{^\265$\222Z\bSk\322u\021\317d\b\262"
+	.ascii	"x\306\335r\232\354\230\255\2554\206\246\353O\"\226N\316\246\037"
+	.ascii	"\372>I\216\202\342'\017\316\376!\322\020\303v\200\212\231\001"
+	.ascii	"\311\213\247\251\325\333\354\034\030W\"=\206\255;\200,9\243b"
+	.ascii	"\027\304\341\253\3573\026\n\202>\334\324\032\207\023&\251\341"
+	.ascii	"\t&qmU\356\316\254[\352-\232l\f\266\224d\215\200c\022dr\216\356"
+	.ascii	"\024\300pZ-\211XE\032\246\265\253\216P\326Oj\336d\374l\337,a"
+	.ascii	"\273>\264\273\221\337e\273\255|\350s\202\006\316Q\325\351j\r"
+	.ascii	"y\007B\315+\fb\346G\200\344\266\301}\256{2\343\343\215\255\350"
+	.ascii	"\363\235C\314R\304m\224P\"x\bf\325K\374\207N\020G\267=\004pm"
+	.ascii	"\027\331\036\305\236\324\207`Q\354\005\311\004\345\3015\317c"
+	.ascii	"_\352\260\274\265\032\226k\031\022\342Q\2077\255n\225|k{\b\032"
+	.ascii	"<\225\326S\356E\224\307\350\267\357\233\236{\255'rf\340\2605"
+	.ascii	"\206H]l\222K\315\236\001\332M\231\215(\264\nN\240\343A$D\215"
+	.ascii	"D\266\242\361X\230\333!\0209q\355\301\235\037B\344L\3343\255"
+	.ascii	"\356E\240\252\372\241\277\013o\206V\354%5\371sH\251\332\233\r"
+	.ascii	"gA\374\035\rI\367\345yv\024\020\222\350\244-f\241\023\ny\324"
+	.ascii	"\2204\370X5~\325\2503\251\203\351\022\031\251\250<\217\031\230"
+	.ascii	"\031N\267\263q\317\314\227\031bS\334\367d\177\025c\031\333\306"
+	.ascii	"S\252X<\303^\340\226\216\357}\225\230\350\027\200\241\354\013"
+	.ascii	"\021xc\221\264\307\006I\370s\025T"
+	.string	"\266\033Z\236\021\364\316a\261E\233\272BL\266\203\366;\353r\202\217E1\n\232\001.\251\316sfPG\002F\254\006\356\377.X\363\221\364\006\224Q$\212`\245V\343)LTX\333\021\n/\n\r]*Zj\234\230Hi\242\305\352Z\302\233\r9\311\234\207.\305\221$\376\265\347\301\241Z\200\244\353\317\224\323\373\016\306xR\337t$\375\352\226\265\253\244c\n[\261\026\377\214\233\027G$\017Z\021W&\343\336\306\220\223\202\332\245r\017N\341xJ\3144;\352b\366_x-\324\347P?2\004]\037k#\352\366\302\273x\262\247\253O\320-aZC\337K\2701w.\226,( \361D4\201\255[B\255\202\265\270\370\022:\241+\376\245\376\374y\342\263O=t,dx\276*\331oCay\304\242\320'\321\025\202$\210\335(\n\370W\017\206\034J\323\343=\021\234\243\277Nk\371\315[/U"
+	.ascii	"?5_\372\303\340\004\314\237BJ\212O\003\205\316"
+	.string	"\353\002\371hc\216\310\206G\262\034\003(\371\017\334\370*\257z\3006\\|\344\352\r\001J\030\277H\013U*3\232' \230\016\3651\370b\003D\302\211\361\0039\031\022\2171t]\256P\374.G\353b\332\324\301Fr\242\317Z*\256eL\377\264\243u\304\231W\246)\221d\020\263a\362\244\232\236\005\037\300\252\250,\242QU!\336/\005\362zr\275\211\350\360\241\017\217\276h*s\310\320\317(m\343\271\246B\310\036\217\250\227n\204\r\ny\263.\240\270\200\213\003i}+\315\016\275\214\206c~\356\316\341\207_\240:\211h\037\253\224u\203mq\323\023\225\315\337\342^O\223\220b\210\312\324\003\264f`\234\315\f\210\313\210\t\206\324\257~\314\217\262\264d\021\003\277\376\3468H9\253a\242_-\005]Vb\271\213\341\274l\2223\216Ghb\362\275\2205\344Le\250\242\272\005U\321\277k\265\307\035\235\307"
+	.string	"\261\233\254\271\332C\032\220ol%\343#\230$x\311\262\262 \204\345\035\021\353\340\311\255\374Zu\005p\331\333%[\037\2603-d\251\236\265\364\250\323\241\346\367\321\331\277\213\262'_\266\246*\241\210\366\355$\237.\302I\233\032\210\302mrA\324\373\350e^(\241k\367\233\344D[\346\321\316`BC\243Qp\306p\020m[\262\027\262D\207\325G\003?}v\3138\323N0\270\210\371T\027\302V\222\006\360\023\225bm>F4\275\204\316?\333^\322\252\324\315V\324iC\3055\036\030\353\217\250a2\250\222\210\205\255\021\350\246\274.\267\006\340\266\360cw\365\337\265\301\200\314w\236$\353)\243.\344\016\270\233H\272C\325\213S\0349\202]\307\232\326\013\373v\253\313\366\020\fx\340\365VJ\234/\034[\311\035\211\371\320KT\335\332\017\262\030"
+	.string	"\200\301\247\033bI\326|5h;\307\317R\035\210\013\031\301q\313p\373d\013\203\f\254\032\372\311\r\3217\364\374Q'\202# \2666\276,\f\216"
+	.string	"\233\214L\242Z\347l\331\304\016\006\301\324\266.`\302l\037\332;9\263\f\222|X\310\274\354\353\374\361bM\006Eb\357\305\306\350`M\273\b\364\bi8\004b\3327A\033\275)\341\207\373\372\023s\353D\361\367\302\274\240\261`\273\001"
+	.string	"\032t\265\267\206\266?\310\037\311V\372N\232\341\f0\240\333\323\275\371g\212\"\350\025.\340\310M\215?\262\324"
+	.string	"\205\013\340\214d\357\331\363,\200\234\361\006`y\323B\305\t\275\212\303\262\b>\203\323s\316\221;\274\346\345BD4dP\005\224\227I0g/\204\333\016\242\303\351W\"\037P\201\243\330\265\031\301y+kI\207"
+	.string	"\001pg\234E\347\t\022\025\f\370S\026l\030\021>\307\361\004BlQ\252\266L\024\020x\f\301\305g\020?\2043A\031\215\th\332\337\303\227\302\022\341`\264\316\016\323\005\026\242}\232h\370$\036v\332B\233\223\307\251\327I\033"
+	.string	"\230?}\211\230oL\354\201\t\273Y\376\022\221|>l\331\020\373|\322\320#\230!>\225\375A`\342F%\034\370\2453S>\2666bB\bex\3660\350\270\b\206\253\235\030\020v\265QE\200\\2\213\353\207\362\245\301Hp\211\201\001E\200!8\031t\262\3243\3426.P\002\350\004\023\330F\nx<0f0\266e\353w\002\226K\033\301\235\316\"P"
+	.string	"$"
+	.ascii	"*\210\235I\210o\300\3110\203\211\001\306\00630\n\\\2045(\310"
+	.ascii	"\2144\t|\266\335e#$\214\324\372e\227\002\004.&\277\275LY\003"
+	.ascii	"\202g\340{\002\210!t<\326\223Y\026g0\342\337B\356\210(j*\366"
+	.ascii	"\324\333\347\037\031\025\035\212\255\334\220\b\013u\337\013m"
+	.ascii	"\257t\311\245.\2205\350\002"
+	.text
+	.section	.gnu.lto_crc8DvbS2Table.4.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`P\003\201\""
+	.string	";"
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001\006\025\001\003\005\001'\204\002\002\177\005\001\006\025\001\002\005\001'\206\004\002\177\005\001'\210\006\002\177?\202\210\200 }3\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\200\002"
+	.ascii	"E"
+	.string	"\212\317\301\204K\016W\022\335\230\226\323\034Y\256\353$ao*\345\240\371\274s68}\262\367\211\314\003FH\r\302\207\336\233T\021\037Z\225\320'b\255\350\346\243l)p5\372\277\261\364;~\307\202M\b\006C\214\311\220\325\032_Q\024\333\236i,\343\246\250\355\"g>{\264\361\377\272u0N\013\304\201\217\312\005@\031\\\223\326\330\235R\027\340\245j/!d\253\356\267\362=xv3\374\271[\036\321\224\232\337\020U\fI\206\303\315\210G\002\365\260\177:4q\276\373\242\347(mc&\351\254\322\227X\035\023V\231\334\205\300\017JD\001\316\213|9\366\263\275\3707r+n\241\344\352\257`%\234\331\026S]\030\327\222\313\216A\004\nO\200\3052w\270\375\363\266y<e \357\252\244\341.k\025P\237\332\324\221^\033B\007\310\215\203\306\tL\273\3761tz?\360\265\354\251f#-h\247\342\200\002"
+	.ascii	"\203"
+	.string	"\323Ps\360\240#\346e5\266\225\026F\305\031\232\312Ij\351\271:\377|,\257\214\017_\3342\261\341bA\302\222\021\324W\007\204\247$t\367+\250\370{X\333\213\b\315N\036\235\276=m\356d\347\2674\027\224\304G\202\001Q\322\361r\"\241}\376\256-\016\215\335^\233\030H\313\350k;\270V\325\205\006%\246\366u\2603c\340\303@\020\223O\314\234\037<\277\357l\251*z\371\332Y\t\212\310K\033\230\2738h\353.\255\375~]\336\216\r\321R\002\201\242!q\3627\264\344gD\307\227\024\372y)\252\211\nZ\331\034\237\317Lo\354\274?\343`0\263\220\023C\300\005\206\326Uv\365\245&\254/\177\374\337\\\f\217J\311\231\0329\272\352i\2656f\345\306E\025\226S\320\200\003 \243\363p\236\035M\316\355n>\275x\373\253(\013\210\330[\207\004T\327\364w'\244a\342\2621\022\221\301B\200\002"
+	.ascii	"\013"
+	.string	"\026\035,':1XSNEt\177bi\260\273\246\255\234\227\212\201\350\343\376\365\304\317\322\331\265\276\243\250\231\222\217\204\355\346\373\360\301\312\327\334\005\016\023\030)\"?4]VK@qzgl\277\264\251\242\223\230\205\216\347\354\361\372\313\300\335\326\017\004\031\022#(5>W\\AJ{pmf\n\001\034\027&-0;RYDO~uhc\272\261\254\247\226\235\200\213\342\351\364\377\316\305\330\323\253\240\275\266\207\214\221\232\363\370\345\356\337\324\311\302\033\020\r\0067<!*CHU^odyr\036\025\b\00329$/FMP[ja|w\256\245\270\263\202\211\224\237\366\375\340\353\332\321\314\307\024\037\002\t83.%LGZQ`kv}\244\257\262\271\210\203\236\225\374\367\352\341\320\333\306\315\241\252\267\274\215\206\233\220\371\362\357\344\325\336\303\310\021\032\007\f=6+ IB_Tensx\200\002"
+	.ascii	"\325\177\252\376+\201T)\374V\203\327\002\250}R\207-\370\254y"
+	.ascii	"\323\006{\256\004\321\205P\372/\244q\333\016Z\217%\360\215X\362"
+	.ascii	"'s\246\f\331\366#\211\\\b\335w\242\337\n\240u!\364^\213\235H"
+	.ascii	"\3427c\266\034\311\264a\313\036J\2375\340\317\032\260e1\344N"
+	.ascii	"\233\3463\231L\030\315g\2629\354F\223\307\022\270m\020\305o\272"
+	.ascii	"\356;\221Dk\276\024\301\225@\352?B\227=\350\274i\303\026\357"
+	.ascii	":\220E\021\304n\273\306\023\271l8\355G\222\275h\302\027C\226"
+	.ascii	"<\351\224A\353>j\277\025\300K\2364\341\265`\312\037b\267\035"
+	.ascii	"\310\234I\3436\031\314f\263\3472\230M0\345O\232\316\033\261d"
+	.ascii	"r\247\r\330\214Y\363&[\216$\361\245p\332\017 \365_\212\336\013"
+	.ascii	"\241t\t\334v\243\367\"\210]\326\003\251|(\375W\202\377*\200U"
+	.ascii	"\001\324~\253\204Q\373.z\257\005\320\255x\322\007S\206,\371"
+	.text
+	.section	.gnu.lto_crc8Poly07Table.5.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\231\b"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"\200\002"
+	.ascii	"\007\016\t\034\033\022\0258?61$#*-pw~ylkbeHOFATSZ]\340\347\356"
+	.ascii	"\351\374\373\362\365\330\337\326\321\304\303\312\315\220\227"
+	.ascii	"\236\231\214\213\202\205\250\257\246\241\264\263\272\275\307"
+	.ascii	"\300\311\316\333\334\325\322\377\370\361\366\343\344\355\352"
+	.ascii	"\267\260\271\276\253\254\245\242\217\210\201\206\223\224\235"
+	.ascii	"\232' ).;<52\037\030\021\026\003\004\r\nWPY^KLEBohafst}z\211"
+	.ascii	"\216\207\200\225\222\233\234\261\266\277\270\255\252\243\244"
+	.ascii	"\371\376\367\360\345\342\353\354\301\306\317\310\335\332\323"
+	.ascii	"\324ing`ur{|QV_XMJCD\031\036\027\020\005\002\013\f!&/(=:34NI"
+	.ascii	"@GRU\\[vqx\177jmdc>907\"%,+\006\001\b\017\032\035\024\023\256"
+	.ascii	"\251\240\247\262\265\274\273\226\221\230\237\212\215\204\203"
+	.ascii	"\336\331\320\327\302\305\314\313\346\341\350\357\372\375\364"
+	.ascii	"\363"
+	.text
+	.section	.gnu.lto_crc16_ccitt.6.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\344"
+	.string	"\375\013"
+	.string	"\226XS?0\217\222\016\360\226\003\267c,(\275\207\260\327\212\246\253\250\330I\345L\0236\236\352\214\342\r!\344\302\3300\243\210J>\255\241@\n\221\221\024\023[\336\344\326I)\272(1\215\220\275I\222)\005C"
+	.string	"="
+	.string	"@"
+	.string	".\363\302\207\023\231\033\247\007&\273\266u\007{\3604\303\355\204\302#\301AS\211\221\271U"
+	.string	",\340\331\241\003<\273gpf\314j\2478RQ\"\005\210\004\304(-\310\314\"\210\244\202{\2675\320v\323\372\023\231\231\275I{l\246X\312\233\2151\212=\035+!\366!\326!6:\366\210E\304:C\003\203\005\003\023\231\023B-\271\302\261lh\353i\2516\201\002\2177\002}\246\205\027\b\020\215\22259\262\021\302*\036\2215\330U\302\3073\310\256\376xv\3229.X\334\243\277[+\301\334\375\271\374\321m\020\236\376\277\225\317\213\213\342\371x\177ZD0\324\351>\256h/!\030j7\020<\206\326Q\034\2660\353\2654,\314\252:\256N\347\262\252\016\007\034\235\312\302<*\215\001\275\0364\300\252\b\327\205U\324\226\276\t\365\002!\027i\346\322\251;\305\032\027\255\004\237y\261\305<\342\342\264\310\034\331h\273\261\b\b\233\223\f\022"
+	.ascii	"2\001?\337\fJ\005\203P\202\230\034\330\264\314\323dV\026\272"
+	.ascii	"\214\347\324Lg\336\034\271&FL\024\2377\301\\\240\002\006?\363"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.7.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`-\006\335$"
+	.string	"\232D|\016F\240\332I:\017?\004\244\332\264\3525"
+	.string	"\345\255\350Yt,yL\301^j<GU\312\377\241u\333o;\353\321%\275]\030\332H\341\025\232\034\257\361\244\264\344\320\227O\222\370\275\373\374\351qQ[$\204\020B\244L)\320"
+	.string	"\274"
+	.string	"\334"
+	.string	"gb\327\374\341J\fT\343L\013\310\234\263\366\301\256=\274\035\345\373\\\263\235$\304'\225U\2713!\304l\316\036\322C7"
+	.string	"\215\374H\324\273D\2007\223\304\214\023L\344\303 p\325~\357C\242N\304e\307\231s\253\f\251GZ\365\\R\016\347\214\321\304\311\234=%\027\221\017\377\343@\242,\245=\236\225\350\013\242;rf\316\236\355\346:\342C\375"
+	.string	"\361\341\332\030\275\277\337\357w\260w\203+ur\024KpU\312wj\362Uu5\342$x\363\305\252\005\3104\347\244\322\261f\007\213\213$\213\227\340X\002E\216\177\261r\001:\2451\003\273\357\272\273\312)\270\003\353{\337\217\274\220T]a]\307\007sNk\325U\212\273\346\266{\330v\262E\006\001\273`\310[\212\250\273\253f\250\316r\372\363W\367\272\264)\375\331o\022A\003\211\303\017!>\374J\360\372\332\275\230\322\237.\022*%\256vi\330\275\234\336\211\227\306\314\273e\227\352\005\245\272\251T3\251\332\266\244j\245R\235\244j\244R}d\244\240\210hH\350]\177\202s\375\bJu\320\211\374@\007\236\344\3761\360\256\333\247\347\\7\217\252\013\250zgT\353\224j\002\252\0360\252sJ5N\251\276Q\265\200QmS\252\003\224j"
+	.string	"\252\256\225\352\032U\227\245\232$\325#\251\026GuH\252AU\257\252uT\237A\021O\013\306\r\256\025\353M\024\277\263\331%\004\323\361$\277}\177I\240\"X\236\335=G\221-$4\315\3019\347\004\375\"\377Y\243\r\217P\361\020\360\373\375\316.B\364Y\005{+/$TZ\004\026g\213&|\354\3664^\322\305p?\033\013C`\237v#g\007\204m\316\002\231\271\331"
+	.string	"\213C\341_n\017\033S\272\027\334\271\360\272\334\354\303\304\200\331\254\200-j\263?Zv/"
+	.ascii	"l\315\006\330\223\351V`x\226\333\215\360\254\034\013\316\301"
+	.ascii	"\330\025}\b`o\344\006\330\321\326\266\005\331\357R\"\321\036"
+	.ascii	"\265\310\331\033>\345&4f{\351Rp@\2749I8Ay\024\013\340q<\364\205"
+	.ascii	"\f\342\253\036\372\031\304\2075+$\006l\313\177\235h\311=\f/*"
+	.ascii	"TiA\313\263D{\337q\310t+\306\rZ\253.M\\pG\254p\305'\017w\321"
+	.ascii	"v/v\301\036\216\001\304\205\016\0266\2107\020\267\n \016\n\267"
+	.ascii	"\306-\341\240p\266\016O\0348<\341l\0352\3348\330pP"
+	.string	"\037lK<~\362`\001\312\006\342\351\t\312V\353M}\267lp\354\331\245\245\265Q\001\245\313\324\346H\337\215|\210C?{\240D\223UF\024\362Y\003hYi\342\2025X\362l\317\356<\346^f\220\351\215M?\260C\013j\371]\204h`\205\366\276\027\205\225\345\304\272\264\232\226i\027\344\240!m\223T\214\227\335\224\306\316\244\f.\211\214i\225\304\200)\355\316\332VD\323\255HZ\245\236MZ\321\213*-W`\221\366L>\204\245%'\326u\326\263\005tvg\217\006A\347w^\0323'\342\322\360\313\335\362\216\211*\272\2575\332\232\t!\272/\005\332\237\032\031Y'VA\202\365\331\335}'\315d\345\330\242u~\250Q4\304\214r\n\t\0052\022HI\323r\220\002\231\262\332<\020pG\233\2461\347\030\311$\244K\027\262i\365A\005\b\333J\250\353j\r\210\f\206;\265\253\323y\265\244\274\023"
+	.ascii	"\224\365@\031B\030\005\331\244\336\2721\267}a\355\365.\320n."
+	.ascii	"\207\332\013J)#\237\001\215\344\202p\325\226\3475\200\241,\341"
+	.ascii	"\364\221\304\374\244RG\224\244\314\252\241\345\324\333\250R\212"
+	.ascii	"\0060\211\214D\030\005M\362-5\335\037\366\341\300\224x3\271\f"
+	.ascii	"0\221B\210\344<6\306\0334\263\256\254S\326\225\235<\206\332\261"
+	.ascii	"\202x=\330\270M\275A\345\267\253Hq\233\342\306\244;A/\357\212"
+	.ascii	"\356\001:\205=i\261\202'\207\234\275\245\006\212(\322\241\004"
+	.ascii	"*\325\177\037\201\266\225\003\256\320\376\335cj\235\353E\226"
+	.ascii	"?\2375\360?z\227\372t\013\306\001\357t\316S\215sYW~\002NOf'\323"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.8.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"u\013"
+	.string	"6\227P?0o\223\016'N\0051,\317\0339\345\217;\234\277\274d\003\006\303\037\006\302\201\005\034V\364\t\366\201E\302\027\255\367\267mzd.(\265`5X\234\2531%/\247\2511\332\210l\"eJ\001="
+	.string	"@"
+	.string	";"
+	.string	"\026N`\327\023\"\262\033\021\370\300\273s|\001\351\356\235\"\335\031\263I\036?\354M\214x\200^\354.\245\036\216=1\377\240O\332G\366\314`\260\273N\355\203\303\255\267m\300\266\002\373\020\002 \277$\245#\227\326(\235\231\376\204R\262\242A\213\335\r\033\214\r\271\023 \376\371\355\037\344\211O\342%\260\177(\274\025y\0322\220\224\354\306\313\235\023\274\273\001\231\261\302\310\345i_\304G`\007\t\227\333\233\bymRK\207fNU\325\024\03616r\363\323kj\205EG\b\216\334<\245\244v5!\257]\027\240P\021\272\240\231\035\263\324\016\366\243\335]\253\307\376\347\236\036\377\367\320\202zY\231\253\343\256\316\0035\304@\013R\032\025\207SAJc\223\341P\320\352P\230\212+\t\032\213\272\252\312\242&q\257\036;p\021\332P\016\013\310H\241&\257\331\202A3O\032)\200\220-@\252>\r\020"
+	.ascii	"3\001\003~\310\322\302\213B\bHQ#\f\327\034\202\271\034\316\034"
+	.ascii	"\3321\3411\240\r4\001x\003\224\025p-/\204I\006"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.9.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"U\t"
+	.string	"\326\321?7@\217\322\001\363a\274O\213y\251\365*\201\312M8\r\300\026\365\307\323|\261\353[C\304\366\220\031\301\004\016\026\303c|\246$\337\231\336v\027\037\361\247\321\b\331R\246\024/"
+	.string	"/"
+	.string	"0"
+	.string	"\317l;AAd\357\337\n\245m\300L$-\273_T\215{O\317\377\307!\254d\345\224\032=1\f\273\353<\245,n\275m\002\333\007\3663\001\266\323\332[?<\353\327L\247\246\217\t\200\2514\240\354\242b.\233\222\271:l\213\354\214\335\322\274\f2\317\362\254\273\030\036&\273\037\202\013"
+	.string	"\002\232\325n\305\002\310C@\360\034\317<\021\322~z\346\207\264g\232nX\\\327\324\233^H\0313T\325+<1]\2242f\177\243\324\f\373pU\025\235o\335\246\3368[\267\305\017\347\361p[\374<t<q\353@\221#`\016\302\241\213\022\034\327\305\314\267\207\253*M\007HZ\262m\212\217p\233\327E\"\002\020"
+	.string	"2\241\037h`-\2610\001$h\034l\206\003\004\347\032\336\223E\t\230"
+	.ascii	"A5p\005\314\365\031xz\0364\265\363\t"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.10.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\034\005u\037"
+	.string	"6:\310J\240VN:\204\344\2049z3\336k\2535yP\244\370$\262\267\006\237\247L\355r\2030\005\036\004\333<\214\371q\320T\371D:\272\252\265\340\325x\035^\207W\021\327\"\3641\301C\344\303\202\233\216\354?\326,\331\204\020\271\223\f\263"
+	.string	"\245"
+	.string	"\262"
+	.string	"\034~\225\234h\347\031\302\354^\024\301Gv \3668V\321\263\210\304\333Mj!BA\3711G\354\312|\035\337Qt\224\247\034w\257\224\024\004\350u\344\307\3629\362#\327\372+#\356{\243\202t\335\213\366p\201\362#\203\006Elt4\330D\276H\227|\\\271\027\345\265\013\313\235\246iz\021=\213m\364\322\2224\261\253\021\277\0276dz\362\360R\274\2219\241\020\025\334{\225\252\255\3218q\262<q\232h?4U\235\314)\205\330;3\363\272\360\365|B\252\"\215\022\357\013\177"
+	.string	"l\310\364T\342\325B\270\367rez\"q\256\235\231o0s\217y\334\t\017\"\301,\357\275\247\342s ?\276?\003,\311\tuT\323\332\302\341\207\247\356)f\024\251\276\027<3\343\226b\266\225yj\345\001\266\362\216N\016\316\356\306\346Y\177\200_\375"
+	.string	"\216\37654\327:\353f\236u\316\311\374\352\214\263\225o\266rL\255\fc+\277\330\312.\266\262\255V\256\331\3124[\271\264\225m\255L\332\312\243\255,\326\312m+W[\371\004z\250\242T\300"
+	.string	"\321e\350mJ\263\334\261\321K\306\265~\346\363\201|\213\331\306B\377\30181VD]\335{mB\314\266\217g.\342\013\331\306\314Z\001:\032\247Y\254"
+	.string	"\032\327\347\253\260\220$\325\263\213\367\336+\366\024\217\353Z\247G\037J5\3224\315r\"2\3279}'\260\241RTL\2734\316\20431o%\301\227\374N\205,\246o\345\245a\306\372\245wUl]\266\013\206#1/\326s\261\337\207Gl}1Z\327\302*\255\00549\241l\213]\366\2017b>\353_\037\376\036\024\251\347/\362\243\355g\215M\022\371\3305_'\324\021s\207\0171y\202\314\354\363\256\337\316\311\275I=!\347\272 \236\352#g"
+	.ascii	"\"\317\364\221\017\324</\274jw\177i\313QM\031\327\357\332\242"
+	.ascii	"\224%\023H5e\016\033na\350\027TA\003\3713\364CA\364\001}\315"
+	.ascii	">\037\037\320\307\0132\201\200L\037/\350\302\017\020\317\007"
+	.ascii	"\024\342\371\324\260\271\241\002\2207d\232@\236\r=\272he\332"
+	.ascii	"\306\246aL|\215\0355\022\367\202gf\245\360\006r\220;]\323\320"
+	.ascii	"\260"
+	.string	"Xm!or=\243\305\306\b\222\247Y\244\341Z\246O\206r%-\242\240v\301iz\327\242\030\0219\3237}\341\0134\341\302*\3232\302\361(\346\316\311\267\240\374n\202Oxz\367d\247\007\310\364\255w\372[7 \265\005\251L\030\341\326w\n\023>xf\326E\366\024\237\326RLsB-q\265N\333\316\020K\\\265\246u5\026VU\235\023\240s}^\370\262\212Ui\250a@\242\224\222\206\202\021\021\031mR\030\016\240\002\031\253\0227\020hX\242\2441g\340zx\177HW\375\037\376\313\255E\311\335B\023\347$h\006v\241\220\030l\001\227\344\020,\310r\264HL\201\021D\t\313\013\320\027\261\376f\221h\277,\372\232\367\300\327\222\276u\314J\376\311+i\345Tq\r?\t${\217\313\310\220v\252U\bb\333\344\222\262\023\310\\\327d\341\307UeU\364v\234\026\0208\201>x\265\030\232<"
+	.ascii	"\206\r7\264\264\271U\240S\202*\t\013\336d{-P\013\031\033\256"
+	.ascii	"\2527\372\314\245\227\300\036\253\016\277;\307\273U\371\036\375"
+	.ascii	"\033\374\230\355\340\205\237\217\003t\364\034\205\316\273\177"
+	.ascii	"\372W&\217>z\035\017\377"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.11.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\325\013"
+	.string	"vWR? Q\233\016\217G\216I\200\225\254 \343\256'\022\366\366Q\b\303|\302\037\020\"\301\215B\324\333F\355\005Lg\230\004\343\274\356\237B\020\200\352+\027\244\236!P\013\372W\301~\\\322\233H\231R>"
+	.string	"@"
+	.string	"?"
+	.string	"\"\317\005\354\206X\264\330\215\t\214"
+	.string	"\3769\236\300\364\007?`\372\363f\323x\004\261W!\"\244$\307\356V\372\341\333s\363O\362\217N\204{R\017v\327\331\211p\270\365\266\017\330f`\337B\206\217?u\321?Mi\351\245UJg\246O)`#F\004\034\273\033Nv\254\311s1\362\321o\377$\256xA\203\355\243\fpGP)d\214\324\330\215\227?+\200\031;3.O\373%nb{\251J\351\345v\205+\337A\265\200(\347TU]\021\322\203\322k*\305\003\204\004\310\330Ot\340\356:\360K2\f0\204g\372\273\006\350\360B\207\350\223'v\344R=\330\227vw\255!\373\243\007Vf\251\226e4\316\3238\022\324\026\306\312\254j\203]\027fU\033\n\231\253\2622N\2051`\354\202&\2534\f\313\252J\334K\253!C\270a\362Q\220\001\244\244\223\332\232\t\371\316\026\r\312\031\252\244\024\030(*\001\022"
+	.ascii	"2\241m\034X\270\360,j\234V\3411\215\355[\\)\023\202\341\232h"
+	.ascii	"\207#\3406\230\320\004P\004\215\001\024\001\312\n\270\226\027"
+	.ascii	"\302$\003"
+	.text
+	.section	.gnu.lto_crc8_poly_07.12.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\375\b"
+	.string	"VQ>8@\305(\035\005\256Lz\007\307\304ms\373G\310:\263\003\223\2021\032\314\200\264j\255!\352\006\3610e\206\331\236\205Uq\361383\0210\013\243\271\337o\t\331R\246\024."
+	.string	"."
+	.string	"-"
+	.string	"\266\235\240"
+	.string	"2\367n\303\224q|\220V+\273\035T\215sO\316?\310\237JIJ\351\024zZ\030v\327Y:Y\334z\333\004\266\017l\003\b\316\256\372\337S\277f:5}K\200\353\244\001e\327\364r\255\t\306\362\260\r\2621\266*\3232\310|\212\263\356b\250Hv;\004\027\\\216\005!\027\361\274w\034\363\304'{\351\230\377\311\216e\232i\261\256\251'\005\020\345\313OU\257oE\272\030\345\313\356B\251\031\366\337*\312v\006\233\307-\252\243&n\021v4\016G\213\260\363\260\341\300\270y\240F\300\032\204\303\006%4m\203\230n\377VQ\231\016\210tD\361\221\210\313n\305\202\037\016"
+	.ascii	"2\241\377/p+\312\233&\036 8\327\360\236,J\300\004\b\252\201+"
+	.ascii	"`\256\317\300\323\363\240\251\235O"
+	.text
+	.section	.gnu.lto_crc8_poly_07_update.13.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\030\002\005\023"
+	.string	"\206e\200G\340\320(\035\n+\001(\212\001\370\347 \003\344n\375\b\357\214\332\256\n@6\023\006i\306\272c\352o\363"
+	.string	"\273\325\266\203\210X\375U#F\357+b\2141F3\262\321\036\316\307\bP\200\037\312h\307\204\266F\366\2262\245l"
+	.string	"f"
+	.string	"l"
+	.string	"1@\300\013\360.I\017\340]Z\365\267\227wN\231\024?s\202\t|\200t\311\240\201\313\257\2035.\336\007\236\026\023Ds\202\247\365`S\030\206\341#xG}]\306\325\227\217\312\r\311h\030.\343h\305\245V\242\255D\324N\007t\334uF\213i\274\211\371\036w\004\271 \031-\346:z0\347\264\312h0\267w\333&\266Q\266\246\002?\351\267\177t\360\367\276s\307\353\334\373\333\255#\365?\006\334Z@\360\231\323%,\232B\022(\304w~\373\376\211\367\330\237M\316\343\225\001\203h\316\371]~\227\267]>\316\237\355\035\224O\226\227\215\331\254G7'\bri\007\261\304s\\\327I\211\037S\245C\006\005\244K\003q\325>\316I\270\016z\350"
+	.string	"\346\234\t\033s,\"R\274\335o\217{,\312\005\261\310D\370\217\n\312Wq\237\221x\233KWXy\227]\372+\357\322\264\005\\"
+	.ascii	"yli\337R\003\246\241u\277\036\373\236\313\227\025C-\032b\032"
+	.ascii	"\332Gq\201E\262\361Q\274\313\357ar,f\034`\032\352\342\202Vh\273"
+	.ascii	"46\030\323\243jv:\357\214=R\233T]\032\251=:>\216\353\004%\247"
+	.ascii	"p2\201D\304\202\227:II\210\252\226j\255\nQ\265T'\022\326j\305"
+	.ascii	"R\235HFR\253\223\252er\n!`V\211H\353t\302b\265N\037\b\373\316"
+	.ascii	"\3301\352rpli\203M\b\2661\243jv:\2714V\020\266\332v\354oF\324"
+	.ascii	"\324\333\2701\303V\333\217\264\273\263\343N\242a\303Y\323:\352"
+	.ascii	"hug~-\347\205\212\356\036\347\2343z\301\343v\004' p\002!;\343"
+	.ascii	"\001\351\201\t\016Eh\324\356\325\220BQ\fUae\216\327\312\250\346"
+	.ascii	",\033\210k\nB,\264\303\241A\020\032\203\344MX0\250O(\254\263"
+	.ascii	"\233\261(\334\242\031\265\372\301\263\364(0\330_1\372\313\272"
+	.ascii	"\207\335\b\353\250wv\033{Q\026\211bJ^\367\022\351\\\364\t"
+	.text
+	.section	.gnu.lto_crc8_xor_update.14.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\306\001\375\020"
+	.string	"\306\340rF\360\320&\035\372\205\006s>}L\2256\337}\207\305\257E\314\267'\221\246}\027u\241\366\265\267\267\342\223\242\321\244\300\365\314\030\331K\247\343[\213\217\305a\250\013B\013\221l\203\344i|~\2229K\b\331[\312\224\002^"
+	.string	"a"
+	.string	"["
+	.string	"\316|\316\312\272+\342\365b\367K\340\003\333#\203\006*\257\376\331\310d%f\300\264\330\261\373qJb\225\360\273a\256\036\241\346\312'\021\362\211q\255<B\315E\346\006\304\345\002I\216\214\202\376z\266\\\254\20483\327\277\216"
+	.string	"V\024\343\232yj\021v\327\031\343\352pg\267m\262\r\301\316\220\206\317\271UKg\226>"
+	.string	"\0028bLp\261+\023\343\261C1\350\304{\376\237\247\255\362}\376r\351'\005.\210\220m\001\"B\361\240'\345\373\302\201\324j\3210\332\375D\036\355"
+	.string	"\262\370\216\352<\032`\310\266\214\330\240`{4"
+	.ascii	"5\355\253\370\n\325?\027=\300.\r\221\310\367\001\331\343v\001"
+	.ascii	"\331c-yt\270\273\013\027\034\352\207\242`E\252\251%}\r\030\017"
+	.ascii	"\254\003e\3606\023~J\366\230*\001\246\243\025\202%c\251>0\\\\"
+	.ascii	"\352kTMS\306K\nV\306\234\351U\005&\004\323\203%c\366\267\222"
+	.ascii	"Zc\237\304\346\310\310Jc\177\224H\317\371\267\367\334\332y\376"
+	.ascii	"\354\337\037\377\363\250\233\234NP\260\002\n\205\323\311\205"
+	.ascii	"\254\004\245\304\004v\251N\335\215t\251\216;y&\223\327q'\013"
+	.ascii	"%&\256Ka\340F\n\330C\235\2448\024\317Kq\245o\25746\204\252$\222"
+	.ascii	"\202|\2701\304\242\254\2505~\f\035\230~\350qtn2*\324\326_\337"
+	.ascii	"r\350\330\320\222\032\346\246\252-\333\326\024\252\312\016Q\""
+	.ascii	" `\002!\265\316\001\226\300\304C\237\265c\263)\324\312\362v\024"
+	.ascii	"\320'fZ\264\026Z\2033\267\274\273\232Z\301= \324\236#\255X\234"
+	.ascii	"8!\300\340\003\tt#\260\303\2572\372\262N\303:\302Z\324\355\263"
+	.ascii	"\335\330c\310\232\t\224m\371\371rG\240O"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.15.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\002\335\021"
+	.string	"V\342vF\360\320&\035\373\267\371\313\336\305@T.\033D\272\331n\"\371i\207\340Ce\377\n\2233\255\275\375\033\322(\032e\264\002\333\351\224\246\216\032\016z\221\315\314\312\0245\325\037\350\345\211c$>G\206{b\311\336r\247\024b"
+	.string	"a"
+	.string	"d"
+	.ascii	"\2735=>\273\340\002+\320>\r\236@\366\251}@\366i\224\215\343\340"
+	.ascii	"\315\276gG\214K\307\356r\352\001\025%x\313\210\372\224\032Q\276"
+	.ascii	"\353\tbA\253\226\313\247\034\251dD\004h\251\244\t\321\320\317"
+	.ascii	"a\217\254V*\312\0223\327\303\036\022\024\256Z3\217#\b\273\353"
+	.ascii	"\270jm\270\263\333.\331~`\307\b\001\327\271\265\343\374\243\371"
+	.ascii	"\327-\317sk\026\035g\364\001\030\240\2311\201\306\256L\310c\205"
+	.ascii	"\346\317\210\277~\235\237\347j\337~\013\037\346\355uZ\331\b\035"
+	.ascii	"h\237\377\316]\336\314\240\004u\036\026mI\214^\037z\224\350`"
+	.ascii	"\370\302h\370`\261\212\206vA\221O\223\330\021<\325\020y\264\277"
+	.ascii	"\342,P\307i\271\200,\231*KS\251\321\304N"
+	.string	"\214\f\221\350rwW\222\\*\210\036EP\bs\"\025C\253^7\375\215\030\232\324_\\`\321\374S\366y=\354\322'\366bux\211\241\352\013H\325R\265\261\367\236\223\266\273\r|\027%\013\007b Zt\272\302\0248/1\264A\227\2506\366Mn\210\206\25456\310v\360\377\b\237\251\244\335\327)\212J\212\232\276\023\323\3124\255\240\250\273\221\356\3538\025\217D\362:N\205\302\t\211\353\276\025n\244\200\275R\312\307\231<\357\3436p/\245\352\224\300A\350ES\336b\324\221\332\025H\361+#P\251\213\247\306\220\030PL\321T\033o*B\344\024\305\017\225\312:\354\023\006\214nz\327\265\03492\242\037( \220\202\231\301\333\001z`\217a\310\276\310'\317\013\036\023\206Ql\204\335(\006\207\322\230{\275~\271\234#\346\001\3606d!q\245l|\355\325 &\334\332\312ja\206\271\243\t\322\231\302"
+	.string	"\205\2370\311\260\007(\b\202\263\232W\232\033@\224z\217'k\314"
+	.ascii	"\225\007\371\245\334\271\326\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"m\005"
+	.string	"\"\310\035&\2209\035\333\254\273\375N\251\241\217c\3374!\271\273\273S'{{\340\037\370\007>5Z*\337\020\221\335MJ\231\002v\027RV\206=G\361z\215b\345\032\305\353Q\305*U#\220\352\343\223\343\021\356\256\r\2714.!\343oqH\361'\321\020w\016\037\030.(0\215\360@N\007$ee\230\364&\325F\311F\332lg\265\025\373\266e\202\314\356\356\273K\333H\t\025"
+	.string	"`h0\264\313\320\255A\022\3260@=|\2000\320\322\366\023\f\227=\235\304\351\036\355"
+	.ascii	"u\300m\340s\340s@\335\024\\\267\223\316[\321\304\243Se"
+	.text
+	.section	.gnu.lto_.refs.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375 I\225\001"
+	.string	"\222\204\013\021\200K\013c3\300\331\244\360o4\231\230\354\335d\n\023S\240\303\f\350a\237=\330e\223\005\354X\242\bm\320\005}4A\213-ZO\004"
+	.text
+	.section	.gnu.lto_.decls.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"(\265/\375`\036\017\235H"
+	.string	"\nz\254\032CP^N:7]8\317\3239\355pxFW\305z m\361:\025\344\003 by1\246\231Z<\356\326\365\260\006X\261T\361\310)\200"
+	.string	"\260\200\271p\260\txv\203\271\003\206q"
+	.string	"WU1\335\236\330-SQ\001\235\001\244\001\354;A\261\253\235\200L\333\021\335,\2525\274\276\355\376~\333K\2179:\234\003\354\303\353{\314\337\323\006\323u\355\346<\225s.`\374\253*l\361\332q\035\246\251\022Z\314{\256\351\036\324|\363\233\363k\304d\207\324/x=6\201\"~\300\376\227\373\021\\\356p\314\276%\024\211\325jK(2X\341\220\357/EUUf\203x\355j\316M\240x\314-\240\330n\310\367\233\200\"T\372f\243\b\262\261.x%\266\375\275\326l\022\210\355\225\233\345r~\221\330\251\27396\274\376m\002E\266\005\024\333Dp\021"
+	.ascii	"B\013\005\016\212~\254\242\204\002\366\307#\376\336@\342o\003"
+	.ascii	"#\376\313\2713\376\370\303\335\001\243\037\213\300\r\376\246"
+	.ascii	"\020\342o\334 \376\306\360\341\022\376\327(p\367\237\351\370"
+	.ascii	"c\241\377\205\335\341\177\204\3772\206\376\316\323?6\361\267"
+	.ascii	"\200\277\003\340\t\377\001\3757\374\217\3776\374\233\303\337"
+	.ascii	"K\177W\370;\302\337\020\376v\3607\203\277\025\374\215\340\357"
+	.ascii	"\003\177\017\370\373\3707\321\337\304\377\207\377\t\377\377\375"
+	.ascii	"\207\372\337\346\177\236\377\b\376\323\375\327\373_\347?\340"
+	.ascii	"\377\275\377n\376\243\371\177\346\277\335\177\266\377\013\376"
+	.ascii	"\343\375?\252V\253\325\037\363\375\375\366\023E\005@\332\327"
+	.ascii	"\205\266\257\313<\346)\227\231\363\033=\266rMf\267S\261h;u\243"
+	.ascii	"Hy*3\363\264\351\204\235r\243m\236\033=\266\323f\264\235\022"
+	.ascii	"\213\"%\221\002\205\t\225\030\\\223~\323Ne\254\347W\023z\344"
+	.ascii	"k_7\373\345\334rG2\324A\316_.\324\257\331\325d\234|XN\272\246"
+	.ascii	"\333o\316\331\300\323\371\304\315S|\355\231\233\363\231\223G"
+	.ascii	"~r`\276|yJ\3631\307\276\362\325\221\234\017<sfv\346\31393s\316"
+	.ascii	"B\320\2577g\257c[\366|\346,Mz\346/f\231#9c9@"
+	.string	"2\321v\372\304E\226\211\233\226e$/\263\313\262\237\030\224\2352\275\344\253\234s\357a\313\242[z\360\332v\372NS\225\032\317[\260\363|h\352\315\323\2419{\300\344\360\312@\b\373V*\032[)0oE\343\243\213\253\003hdE\013\234\023\257\177I\215\325ww\210\327C\261tzNS\333\257\373\336p:\316\223\336\234\351r\316o69\275w\304D\312y\254\255,\347\367\033~\244_\277\351=\342k\226\363X\230\221i\027\327E\230\363\233D\201\302\352\374\362\227W\\_\202\355&\366\034\330\277\371\366\202\246m\006\365\366\3600\0347WN=7Gv\272\250\234\270\371[M\257\351<\033\306-)\030\237\274\277\331t\233\306\263\261\332\331r\205*\033\005R\013d\210\327#~sN\223\300\370r=\307\320\234\251j\033\264\303k\227i3MM\320w\327\320\341D&\334\313V\224\225E\346\342\365\026\002adk"
+	.ascii	"\332<UX\324\257/l\305\366\234\025\243\266\265\260l\206\2710\027"
+	.ascii	"\366b\221\247T\255\334\b\205\244jd\177K\216\275\214\266@\343"
+	.ascii	"\264\341\025K)\224\225\335\341\025w\3410\254E\305Z8\t\21373\211"
+	.ascii	"\300\020Z\271\021\342-#1$n\206g\206\272\002\245f\262\360\023"
+	.ascii	"?1\024gwJ\241`1\fP0/\353\030\332xl\036\2232\200x\305X\215\307"
+	.ascii	"\024\347\231\006;\261\021l\004[\261\271\251\201Vn\204Ax}m`\325"
+	.ascii	"\261\325\357\020\253[{\016\361\212\217`\252?W\215J\205[\2422"
+	.ascii	"\257=\207\177B\\\316B5x\305H\272\017L\253\312\333\036\021\216"
+	.ascii	"\215\317[\235j\025;\003\224\t\305Q\333\004\263T\252D\\\223c5"
+	.ascii	"\207\233\307\316!3C0*\274bf\327\005M\233\264)\304+\316\307\263"
+	.ascii	"\234JSk=E\275,@\205k\330\267Zw!\265\013\373p\250]\365\360\004"
+	.ascii	"34I\005@x\211\237<K\fW\255%}f\336\227\210L\0305\211\034\373\336"
+	.ascii	"\323\203o>\324\346\323\204,3g\346\233\263\212\3244+7\302,\375"
+	.ascii	"R2r\211q\323\374\274\t\177\r\035\272\256(g\266\2343\202\316\252"
+	.ascii	"\362s\007\257\335\247\353\216\300\314\356\376\360z>\t\214\352"
+	.ascii	"\214\211\263\207\327\367\023\366\357bnBs\316ZAo\206:\213\212"
+	.ascii	"\035\324\255\364\0335\261\035\374_3\221\200_\316J\244\f\262Z"
+	.ascii	"\354\232L\316 ?-g&R~3\264\235\2121[0}Q\2447;)\220\247c\271}\305"
+	.ascii	"\242\253\233q~s\347)\261hMD\312%\f!&\344\214\247e\017%\215\001"
+	.ascii	"\312(\"F\001\0362\024\361\021\005\243\311C\006\247\">\242\244"
+	.ascii	"\2124\304\3001$\305\221\206 N8\206\344pjJ*\223RR7\n<-o\344\220"
+	.ascii	"\022\342\024"
+	.string	"\340\311\007\216\0332P\030\237\264\\\366H&\235\230\220Ie\222\350\311\036\312'\250\247\035\35490]`j\"\"\364&\020\031@d(\276\t\004\022\t\202\t\311\236\tI\\:i\330\260<\017\f:\204\340\370q\343I\271\f\242\340QRO\312\245eT\224r\211(\007\324\0231\210\223\016!8\202\024\225K)\342\322\251Ih\351\304\204\\B\365\020\302\036\211D\301`\306\213\025l\022CR\231\\\202\212\372\361#*\271\004\325\343\306\217\245\2442\310\022\206\002\357\026Z\0325\206og}\300\260\270y\255d|\177\256\332\222\264\224-\315@6LF\304B\303\203\004\257a\347\231\251\335\333\005c\261B\345\033\304+F\353j\025\020\232\261\235\27297\261\032N;F{7\350n`\264q\365\344\252\310\245\017\207\272\306\346\270\360jf\206\317\372\370:\003\305\b\266\03615*-\307gBdzP\264\360\212\263\254F\264"
+	.string	"r\361\236\364\t\264;\263b\005cIb3\333\031\240\340\220\2338tmW\216\261\364\236\020\334\240\037S\206\034\300\275*,\226\"\005\2235\234\202\271#ni9K\225\210\306\346\246}\250\034\223\005]\371S\307\207W<\005S\rq\371\213\363\252[\337\264H\2434\211\022\005[\265t\304\234\241\240\221\211\2343\204x=\261jl\f{\2618fg\035\277\262\226k~i\013\305\304\260\027\213\"\231\334\t5t\300\346\270T\354\342-\352\023\247\t\013\201B\250\2618F\2304\"3\"\022$\005I\222\016a\005\304 \005-4\017\0210)\263H\210F\222$Y6\003\210(\360\372:\263x\356w\006\235\230\b\003\22302\222\200b\323\366c\006>N\2225\363\216\206\226B\335-\303\363p\346I\027%`\351\2616.\257\240\215\374$\032\252\371\243@4\f\226\366\3201[\230b\370\260\001?m\025"
+	.ascii	"\337(\3205\005m[T\264\340kR\344\364_\204\262\b:%\260\335\333"
+	.ascii	"$\264#\036h\3319\214|\273\375YA \200\001|\t,:\351\246\352\324"
+	.ascii	"\2636]9\306\350D\273\345\350\343\253\232\f\206\f\226\371\001"
+	.ascii	"3a\360\264H\272\250X\332\032\"sK*\024j\251\312\345\327R\024\200"
+	.ascii	"\261\300\273u\3273\037<9D\\\3014\027\f\026\300\025\245zN=~\265"
+	.ascii	"\273]}WHe\353V\337\337\331\347w\333\321\337\273\211\230\\\231"
+	.ascii	"\350\246~\276\016\036D\236\004n\210\313w!j0\350\257q\320\223"
+	.ascii	"\364\310\321\316\254R@\007,Mx\274\002\224"
+	.string	"\025\224\203R\337\200D-z\256\201\217\320\323\fp\237hy\232I:\252\320\3117\214w\234)\210\205[Z\323\352\033@\362@\003\263^>?U\037\316\362\317D\270\353e\207\034\374"
+	.string	"z>\220\335L\245\354\2302P\376\316\004S\032%r\002\006\332-q\366\204z\333<R\352$s\311d\312\332\f/J\240\324\245\3327j?3I\251\017\377\227\025Q\237\354]\271\r\213\bA\252\323\027\020|\330\315f\234@\362\224\2232=\341\331\364\301~\034(\013\300\030Z\255\026\007\272\0066\201\252O\333\001\203\013.B\\n\032\307c\270\367m\335A\274*\266\363WI`\376\267/I\232$\352\335"
+	.ascii	"T\357\317\036\361/H\344\307o\274oa\2634\037\342\260d\021\223"
+	.ascii	":\307\022\203H\350B\321\034\343C\342\207cO\273OL\267\365\347"
+	.ascii	"\037\233\2070\371xEc\266Z\211>o\317[G\006\252\223\213\255\302"
+	.ascii	"\355j\tz\206\355\025\202\207h7\340\376S~\r\303\"\336\005\336"
+	.ascii	"T3\343\001\335~\237<\374\214\341G\372\375h\017\322ioo\330\321"
+	.ascii	"\366\001?\341\360M\267\277\\.#\323\363\200Y\037\206\322\215A"
+	.ascii	"}\020\374\310.\333\001\304\207\203\035\303#\314C^5\037R\005"
+	.text
+	.section	.gnu.lto_.symtab.1b5e7ba8e5138e2f,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"crc8_poly_07"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"crc8_poly_07_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b5e7ba8e5138e2f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,779 @@
+	.file	"filter.c"
+	.section	.gnu.lto_.profile.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"-\006"
+	.string	"\324\b\271\001"
+	.string	"\020"
+	.string	"\203\255\266\373\b"
+	.string	"\001\356\361\330\337\f"
+	.string	"\002\321\307\201\370\r\004\002"
+	.string	"\002\001\003\353\220\276\200\006\002\004\263\311\277\326\001\006\005\211\337\230\303\002\006\217\364\362\333\n\020\007\225\326\304\223\t"
+	.string	"\b\206\223\232\231\013\022\002"
+	.string	"\002\003\t\311\276\204\302\004"
+	.string	"\n\245\233\254\343\013\020\013\344\247\274\230\005\f\302\265\230\372\n\032\r\243\352\335\360\007\016\222\355\333\035\b\002\004\002\005\006\002\005\002\007\002\005\017\332\256\355\220\007\034\002"
+	.string	""
+	.string	"\005\007\002\004\002\005"
+	.string	"\027"
+	.string	"^\215\200"
+	.string	"Z\025\267\302\221\353\023j\0056\335\332\005\304gO)\201\006"
+	.string	"7J\215EU\270\002\360"
+	.ascii	"\264\265\311mG\327\346U@\001\204q\t\343.\214\002\270\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\355\003"
+	.string	"\302\304\r\024\240'\351\376\377\377\237\253\304\221\331\247oI#m\023\271S\n\022\336@0\363\002\353Xw\001\212\2521\\\023\217+\343@\257WAF\304\253\215\2674z\245\222\307\013\001! \340\002\252\252\007\275E\332@\202]\033\213,\330\210@ep\356\320\024\230"
+	.string	"\32128\npCK\262\370\324\364X\030\331\222\007\314`\235\243\205\320\214\355\306i\004"
+	.ascii	"\031\013V8\030BK\221\023\303.\302\020"
+	.text
+	.section	.gnu.lto_.inline.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`R\007\365\024"
+	.string	"&\031L8@k\223t\022$F\206\374c\030^I:<Aa\320"
+	.string	"\020\354\032'u\005\006\034\363\366\237\337\263~x\370\324\001\234\237\214S\204\003d\032\246\306a\377\237|\373dK\222\0023"
+	.string	">"
+	.string	"?"
+	.string	"\214\315\365\232L\272\3734\204\274\036\177\241\272\336\261ol\3061'k\250\321v\275\326pj\313\245\250\346\267\341\006\365\204\036B[\316\363\017\303\266\275\217f\t\002-\001\bU\204T\277j"
+	.string	"A\350`A\237\305y\332N\314^\347x\034\270=|YG3\232\013\370d\314\261\331\215s\013C\333\310_\016Cb9\315Eh9\003\206\246\333\335\344\250\214\341\303\001S}&UU\213\005\301\304\344F\211\331\212#\021O$\222\024]T\206\215\314jL\ncs\001\216\250\177\212\216\343\247@\035\bEG\335\257\306\211\315.\321QS=\023]!\335\230\241\274\005%4\377C`8]\260PA\003\3457\314\220\341\331\220\200H\226\030\220B\206g\2432\345\347\253\314\025"
+	.ascii	"t\261.&\334\370@\201\001I\252\334\030\261\352$)\366m\004\354"
+	.ascii	"P\340\003\321\250m\347\343\003\265\235l\200\256\250\001U'\325"
+	.ascii	"HA\n*\205\341p\002\241\2411\353\022@#\035\307$93\"\"\022\b%i"
+	.ascii	"A\371\026\2469m\270\304'\214\330#)\374\214\022c\257\\\303\022"
+	.ascii	"\245\273\210\344\033\266D\345<\2551r\313,E\341\270\025u\273M"
+	.ascii	"\316\351.\341el\330\0344\023m\373\207\333q9\204\007\023\004Q"
+	.ascii	"y\343\321\232\322\231\321\317U\037x\315I\314v\023\253\201\316"
+	.ascii	"\304\2173o\213\323\276\357DCH\2723X 0\310v\220\342\034B\330Y"
+	.ascii	"\367\022\315\311;\230\006\200\221\354y\205\036\301\266\241N\321"
+	.ascii	"\233q\335\266\222\236\212Q\255\322\004\377\216\236\215.V\224"
+	.ascii	"\267fB\327\002\260\302\335\361\254\326\306FZ\333,\2637\332\032"
+	.ascii	"[Pu\335F\244\034\262\025\001\371\211g\270\326X\324\324\242\352"
+	.ascii	"\032\336\226Oy\305\211X\364\020\272\251\260\0220\213\006&\226"
+	.ascii	"\331\250B\321V\341@&,\013\2315\b\274\276j\352\366\210`\206\304"
+	.ascii	"]#\222\034\030\002\201q\230\2165/Ny\266\266P\321\375z\032\275"
+	.ascii	"\350\362\241\262\304(Vn\231;\202\342\252!D\325\020\206\032\211"
+	.ascii	"K\326\236\306;\203f#\211\223-QU\331\247\206\374\343\347\307\357"
+	.ascii	"ifv2\355\023\351\0028+K\001\2726R\312\312\266\340|\315\036I\013"
+	.ascii	"F\226\223\223$\257\342\365 \002p\323\306\032\013\256,\257@\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"%\006"
+	.string	"\202\211\034 \260'\035\f%\300\354\262\"\020Kr\004l\245aG'\021\356\251\246\326\b\331{\023\262\345N)\005T~Z\350'~\362\231"
+	.ascii	"@!\233\350\013\311\241\337z:0\262\206\203Q\204\243h4\3445\215"
+	.ascii	"30\227\326Z+\375\373\221\367=\354=e\371c\254\310%,\222\364b\310"
+	.ascii	"GZ\223B\016\373L[\224\016)\277V\276\362\227\326U\276b*\255)`"
+	.ascii	"\027\001! p\2021Cg\007\355x\236\300\374\225\237\265\300)\203"
+	.ascii	"\b\254\300\030b\360+\013\211\303\207\241\245\271(\302Y2\f\030"
+	.ascii	"\303eG\306]\020k\251\217xY\230\200PE\301\300\203y\023+Ec\230"
+	.ascii	"D\367b\0337\356|\334\366ek\2141\212\342\006"
+	.text
+	.section	.gnu.lto_.pureconst.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\200\004\001\200\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\200\004\b\232\004\t\230\004\n\232\004"
+	.ascii	"\013\232\004\f\232\004\r\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\242\001\225\007"
+	.string	"2\212\035!\240%I\007\363*\326{\257\373\254\306\276\325\251\377\367\253*0\322\b\354&\315~\362\223\323Z#r\247\177w\3576\304\212\301\264\304G\236?|hY\212!\003W\263gH>\332\344\260d\253\300t\004\216\230\r\031\262d\250\226\316\025\001\003\t\n\245\215\003\002\360L\247(_\002\201\306\257\327:h\223\342v\002\022\267mK^\255T\337\266\013\355\002m\303\200\344\307,\b9 \260\"!\274\035 \022 "
+	.ascii	"$\003\371<\267+\262~\024d\3311[\\.\033\361\353\n;\276\254]\235"
+	.ascii	"\342=,d\032hJ~\201Z\020c\007/\341T\271\210\332\020 8\315n\267"
+	.ascii	"9\n\310\336e\305Qxpt\360\206\025\032\024[0<z\205\t*2\211\233"
+	.ascii	"\204\004 Q\250\245\213\022\002\3035.\036C\246\251\344\027X\356"
+	.ascii	"@1\0317;\016\373\305L\345\373\342\355\n\340\006"
+	.text
+	.section	.gnu.lto_.lto.3ece9d4763afba77,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.5.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\265\007"
+	.string	"2O56Pm\222\016$\243\210\"YZ\257\315\203/%\247\264\024\231b\262\026T\230\231\335\220\311ja}\326\227\03573S$=Bb\025X\343\026\306\251mck\215\020\231\002 \211\217\207c]k2\332\006\004\301y\200\236\254\323\3114\320\303q\350@\215\026\0013\006g\237\215\006AY\246A\354?f\253|\244\337\205\342U|\f\271\227\361\255\362\221\276\245\266\017\323 He^\244V\022\3052\361\370\267\307~\347Z\372t@\346I\n*31/\324}C*\2625NT \223D\202\312\214\230\023,\265\216\226\377~\024d\373S\0259:\024J,L*\231\t/-\270jU\035\270j\275\215nu\333\355H\017L'\321(T\007\320\220\231;\321\b\243\277\376\b?\303_\n\013"
+	.string	"\322\032h41\264\n\3075|\232\305"
+	.ascii	"Y\220\225\220@\240,\203&\214\224\224\3165\311"
+	.text
+	.section	.gnu.lto_pt1FilterGain.6.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"=\n"
+	.string	"F\223E< \345*\035H9\002H\005\355\030V\002A\201\230\177\002\274\266&u#"
+	.string	"Q\220\357\331\\Q\343 Fq\245-\366\b*@\233(\\\306(\t\310Z\346\023\205\213\250\346\210\332&r\247\0244"
+	.string	"3"
+	.string	"1"
+	.string	"\255\247\200\2668\341\261\001\201\371P\021\260\273\034\347\006\231\317\355\005\231O59x\t\372\207\275\023 \226R\225.5\021\273k\231R\211\334z\333\t\266\037\354{\002\254\203\225\335\220\261\266\264\351r\362\327o\203>\314\033\333/\213\333\262\034\205\025\003`w\027>\355\020\312\032.\357\262\350\201]Y\253ew\031\254 \360i\333\017\252z\235/1\324\210T\213'\251\321hk\210q\254u\354\232:\252\312\022Q\263\223\034\355\260$\265\304\376\266\272\262/=\037\376\333_\256_^\372\032\202\022\024\262\002C\2228:\013\320t\347\371>\244\214\020\210\033y\"\221\327q\243\320\205\210\353\276\r\316\203`O\343\363q$\317\373\270M\270\337\256\253\251\034\223\236|\335t\352\007\240f[\022"
+	.ascii	"2\203l\215\321cb\311\f\177T \232\272\3035\361\327\242F\265\310"
+	.ascii	"6\0132\021dA\270\013\030\001\371\300\260\240B\013\200\312\330"
+	.ascii	"i\347\023"
+	.text
+	.section	.gnu.lto_pt1FilterInit.7.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\245\t"
+	.string	"V\022C;0\345\2521\200C\336\346\307\257?\004\346\201\216\210\323\326k\372\324HX\210\026\b#\025\220vyC}\023X\037\306\210\030\030\0300l\311\274W\022f\330QS@{[\357\275\245L)0"
+	.string	"1"
+	.string	"2"
+	.string	"\\G't\346<#t\346*\266\002\030>\b\002\200\274h\377\277ib\321R\254\335\342LJu\262\034\250\370_\231R\211\270\323m7m'Z/\004\n\004\376\220Z\201\317\270\027\224\266\326\264\225\243YD\273\032k\346\207\211\221\375\347T\3023\367\260Y\266fyEt\313\344\203\177\005\223\375#\247\020\236\003\016,\025\222X[\271i7\354\322\230\367\237\242~up\024"
+	.string	"81u\346\"Rh4\224\254\265\343I\316\222\326\333\377w\256Z\273\354\315-[v\006#\001\027\016?%Q\b\324\325\323\t?%Q\b\364\221\300\321\b\364|\244\220\305\350\363\204\031_\247\241 \306'\374J \030~\232\361\336>W\345\006\314P\323\243\333l5\f\013\016"
+	.ascii	"2\241'\034\030.\250L}Nj\217\245\255\240\207U\353\302z\f\363\002"
+	.ascii	"\201\301\025ijJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterUpdateCutoff.8.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\b"
+	.string	"fQ?9@\345\2501\240\256\327_\317\341\036\341\341\303qo6~\300\341\005P\0312,N \366\242\200 \343X#Ns\363*\212\216\203\300*{f{\227\341Q\261\264\377J\"eJ\001-"
+	.string	"-"
+	.string	"/"
+	.string	"\b\232\345\346\003\315\262^+S\340\030\b\320\341\212\371?\243\210=C\2576\2125)\325\311P`\342\177aJ\365\341F\267uh\033\321V\0261\251B\322\326\233\266\360\363\211\347V_\325\374+0\260\377\234Bl\226\r\031\303\326%6\361\3142\331\340_\261\300\376\217\323\207\315\262\237\003\030N\351k\373/Q\27342\b^FL\232%\003\013"
+	.string	"\b\n\316\332\357\004cH\353\314\3777\256Z\267\354h\226\reAK\202\313\3571\023\360\025\356>%Q\b\244\325\323\351>%Q\b4I\334h\304y&)D1\232\236\356bv\026\312Y|\272Y\342\270nn\276;\363\270\252\034\020C\305\215\306\330\006\f"
+	.ascii	"2C+\025\003\b_Z\\z\b\265\256\241\3070/\020\030\\\221\246\246"
+	.ascii	"\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.9.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"}\013"
+	.string	"\266\326N= O\234\016$\232\002\027\\\364\346`\306\313V\b\032\372\204"
+	.string	"\037 \003,hm\373"
+	.string	"\324E\374\246\037\257\001\361\254\224\255\rT\003"
+	.string	"C"
+	.string	"\260k=\023*0\356W*\342\240F\366\2262\245<"
+	.string	";"
+	.string	";"
+	.string	"\325\243\271\312\266\017\342!2\333\203\234\206\321\244M\220\320\305\330]\313\300!\323#\374\200\351Q3<{f\376G\034\246\b\255\370\200:OJ\301\356:?\240\n\267\336\366\001\333\023\373\021\002T\246c\246a\2465\323\231\351\003\230B,\bx\273\024>\031\333\021Ql\260\235\331\017\333\231/\331\263\306\256\212\027\033\273\033q\202\247}\322Ed\3478\027\260+:\261\261\313E\214 q\306\346A\313\317\327JU\251n\343\240m^\"5\342\302\017N\302\336\304\3572\020\252\335\375\350\321\347L\217W\252C\367\201\344\311\317\346:\251\030\354\303\335]\253\310~\351\257\316\375\001\232M\006c\211\223)\022\254\242i`a`a\256\313\345\242X\030\313\202\213E\301\034X\222\002\2762\025\314\322\\\027f=\270\275\035\025\262Y\350\360\250\346\250&\002\264\340\370\300\360\344g\250\327\250\220c\273\240\232\n5\023"
+	.ascii	"i\231\"34\030AhB!\270qp\334\t\264\212\031\003\\\256(\232\233"
+	.ascii	"\302\242\026\373\201k\214\310\202\254\204\004\002e\0314\361\244"
+	.ascii	"\244\230\256I\006"
+	.text
+	.section	.gnu.lto_slewFilterInit.10.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\013"
+	.string	"\346TMC \2138\035H\261\3302\bq*\242Z\220\341\276l\305\204\333vX\"I\257l\020\264[p\030\032\350\365\245\265\231\306\b\202\221\020\312\026@\202\303&\247n\251\361\236\303\322\300dj\3135>)\322&{\247\0246"
+	.string	"<"
+	.string	":"
+	.string	"KZ\234\221\275\232|\005\366\232\235\002{\365hs8\211`?\201"
+	.string	"\200\023kw7z\340\343\347\350\377t-$\362|Bt\354\256gH4\340\246\267]\261\355a\237\013\244\177f\230\203\f\026\345\256\200\326\207]\325\013\nl\237b\233\\^\022\033"
+	.string	"\024\342\230\344%\214/\271\264\266\213a\203jw-\326\310^1\256O\373\020\036a<\251\363\211\335\021J\265\001)\013\r.j\227\034U;\244<\024(m\317\212\315y\005\227\331\356n\370\024NL\"4$\350`\257uA\212\001\3533[6\351\231\324\200\375kw\327td\337\364c/\375\327\003\"\232/\023r`F\324\304\316\353@8\234&\3240c. 'j\272\221m\363y\336\207\3316]\210\267a\300p\273\\\370#\341\300M\374>p\243\220\373k\351\310\037\017V\037\n2F\355\360\001\024"
+	.ascii	"i\231\"\023/\307\321\342\202\njCJ\330M\275nj\217\271\255\360"
+	.ascii	"1k\215\013\303\200\031\003\230\013:\247\204`\201\300\340\212"
+	.ascii	"45\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_slewFilterApply.11.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\274\002U\021"
+	.string	"\026\036jF\360\260(\035x\337?\350\316u\263\030jn\261NF1V\004\271\376\b+C}\314e\037\234\022\325\365\031C\032\337\206\343\353K0\312\255\023Wl\"\233\310\336\213\217U\322\370%\353\240V\271\351\346\260d\357\275\245\224)X"
+	.string	"N"
+	.string	"X"
+	.string	"\360\003\301\"Q\033R^pt7\367Q\017\251\021\352"
+	.string	"\251\221?\250I;\332\224\021\362\232\256\023\004g\030f\250\250N\332\231 m\246\254\264\220\332h\240\303jEa\214\n+\233\ne\031\200J\002\374t\267\302t'\250P\273\023\324\335_\025\325J\337\241\377=\374\017\371w&\372\251v\354~\356^\356>\356\036\356\236w\277\273\327"
+	.string	"\022\007\006\201\024\335\024rr\364\213\030#\342\277\351\337\376\357\252\313c\357t\267\250!\353\356\217'\320\375\365\245'L\372\231\250\200n\026\214\254\373\3738\002M\343?\355\377\265\204\2320\375\261\221[,<hL\02227\031\024n\f\331\203\3210+C\2062R#P$\272\202yk\221qmw\237\230[_V^"
+	.string	"\253AY\234\377%\252b\371@\210?P\024\217i\335\035r}i"
+	.string	"Ac1\221\032\225\331fv\363:\331\234\377;-\267~\205\315,\217\272\250n\001\245\222\021\222(\312\207@<\221\222\003\021\003\216\324\215F]\210#\211\024\214\270\220G\302\201\024x7\"\342q\245\256\363\270\355k\205\312,\017\177N\0305\363p\344\340\302\325\211\361D\033\032\227&\233\371\327\335s\262\007\253\221\254<5\300H\336Zf\\/\031Y9\302rd]]\260\221\272\021: \300\002\0311\363\351\232\"\"?\006\235\242\216s\335\034\321\325\\\0361\303\305\t\032'O\314\254\002,\252f\252e\020\3425m\316}\326!\006T\340&{ \353\312\340\3701\253\304r\007\2414\321\346\313\264c"
+	.ascii	"-\353P\236Z\253\224\222\r\270\373\332%!\033\274\023I\022M\227"
+	.ascii	"\271\375\021++'\020d\331&0Y@\236\343\355\210\302p\032,\0339\023"
+	.ascii	"\021\231\201\375(.3\272\247\267v\225\001"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.12.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\345\t"
+	.string	"\006SD=0\307(\0350\237\206ZZ\365\305\255W\375\272\2573S\250\003\330\247\033\031O\032A%m\375\216\317\020\234\004MY\237n\002k`\240;\204\036\025\275\216e\006\027B\320\376A\310\336R\246\0242"
+	.string	"1"
+	.string	"/"
+	.string	"6\n~!\"W\260\242\241\302`w\261\314\023\254Gx\004\353QA\356==\377)\217\035\036\004H\245\320\363\232\330]'\251\304q\353m;\330\226\260\257\020\361i\370\264>\235O\337\322"
+	.string	"\340\013\016\354n\254\032l\202(`\304\266gc\354\017A\304\363'\243l\331-\200\022`w!\374p\360h\3337\371\211\027P\257\227\302\324\310\200j*\324K5\"\261Tu!\0255j\2525\300\322\250\327T\215JD\271\262\277P\352\207}\270j\262\237\276\376\375\326O\177 \215\333p8[\207\221]@\032\267\341\264\356\243e\027g\032N\353*:\034\354\263y<[\206}:\024\036,\343.0\r\2037\013\215\303\272m\3430\314\267\207\253\246K3\031*r\020"
+	.string	"2\2417(p\362\213\005\002\3729\n\030|\314\261\\\303\213h\001-&\0240\0072\003#\202\n8"
+	.ascii	"\225\307\324N2"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.13.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"=\n"
+	.string	"\246\323F<@\305\2521\340i.\273\272\370\\W\254\355\271\267\326v{\326i8B\344t2@\310\033j\377\250\020#LsM\242\273\313\017\247\013\0260\352O\373y\346\324\200\330\226\277\335{K\231R2"
+	.string	"6"
+	.string	"3"
+	.string	"\030s\035\235\320\231\303\030\2413W\261=\340\021\345\016 \340\003F\373\357\315\023\213\226bm\2303)\325\311\362\"\361\2772\245\nq\247\333n\332zZ+\004\007\251%\370\214\033\220\322\326\232\266\363\265\261\031\334\243\204$B\216\006 \332\325X3?\001\232\354?\247\020\030s\r\233ek\226[D\2678|\360\257\n\310\376\221\323\207\245\2561\263\240X\263w\373Q\233m\316)g\233\241!\235\252\003\202\221\213\314S;\236\3444i\275\375\177\347\252\365\313\336\354\262\247[\266\354.*\006\030j\017\237\351CQQ\372\302\320\027j0\276p\242\240+\250\023~&\013Q\310#\201\243\021\b\362H\242\317\310\003\205%\257\263P\360\342\013=\023\b\206\236f\274\267\317U=+3\324\354\350E\326\001\020"
+	.string	"*C\244e\212L\274\016\032\r.\304T\335<\256\261\001f<\240J\204\021%\304\r\304"
+	.ascii	"W\244\251)\340./\332I\006"
+	.text
+	.section	.gnu.lto_biquadFilterInit.14.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\305\be'"
+	.string	"\352D\334\016F\200\334M:\0177N\tP\374k\020\260qt\364\026\342\234\263;\202\374\331I\256^\311\377\347U\202D\377L\254\205\246\021\324+\233#(\300\201\223\250\354\234\255\365\341\336\260\231#_\034j\350\037\335\330\232%D\356\224\002\335"
+	.string	"\303"
+	.string	"\336"
+	.string	"\376\267\274\313\217\367\362/\017s1\037s\263\223\361\317Y\031\25123\305\037\231\f\245 \233\"\324\230\fa\2216rT\200\t\202BLI\017\031\245D\330\226\021\\|T2C\206\260\301|\314Q\361("
+	.ascii	"$mMN\255\025\302M\203\260K-3\326:|\371X\n\325\241\325\024"
+	.string	"\016{\245F)T\203E\200`\240\306S\231z\025\037\355S+\031\034d\2555\202)\344n*\225\247\366\245|\312\324\273l\\@\255YGd\255\306\b~\220\273i\343\207n7s'p\273\351)\233\355F\255z+f7\260\264\325Zw\213\344S\277\231\345\322)\237*Q\023bQ\375\306d:\300S\236\314K\256!I!\226\217\357U\320\352&Tk\325a\235%\305i\250\265\232\n\261z\334\270\333\206a\233\206\235C\006eV4Y\016\355.\r\342\021\212hq\310\034\035\2606\f)z\341\320\022\335\360B\013.\225}\274\230\233\034h\325\031\222\3112\301Z\253\226\350\016X\332E\300~\351\376\344\262\242I\013\355\367\006DH\235SN\025M\332F\252\227u\215\330/\353f\331\357\372\0330X\260\244 \201R\022\002\244#\243k\371\017|\354.\372\327o\340d7\321\313\356\241\237\335\003^\345\027\360+\277\320\301\356"
+	.ascii	"\347r\003x\330\035t\344\rt\261\373\347`n\035\245\366\241\324"
+	.ascii	"9J\215\243\3247JmR\352\222R/\245\246\224\372\023tmg\220\324j"
+	.ascii	"\335\221\314S\321L\261&\007\373\271\374a?\362\027\373\301\374"
+	.ascii	"c?\331_\366\237]\347[\311\334\332O\264\002\330\334:m\325\301"
+	.ascii	"\255\355\373\036\240\305\255\323V\234\333"
+	.string	"\332*\236\347go\353\264\245v\226\231k\263\370\035\037s\265V\013\276\235)\256\026Al\226\330\270\335\244X\204A\253[s\235\266\314\234eh\376\362\206`\231\350\234E\244eZ;\271\216\226)\355$\026\255\321^Hb\346\234S\345\346\024\314\211\231`\035\3209\213J\353 \355$&\355\005-1'\227\332)\030VY\264\f6\211\316Y\314\"\332\005\233\264V\264K\233\224v\022\025\354\325\234\\DK\203\345z\030r<\213Os\334\031\032\025\325\263k\304_\363\337\320\037l\3746\277\302Q\254D\324\370k\314\226\253\225\352D\177\306\355\246\251\260Z\261\025\237\346\023sZ\225G5V\246\233\007\226f1C\273\242{l`w\213\002=\025>\250(\363\205\024\225z\242\275\025?\027=s\302\tJ\341\004\255p\202N\350Q\n=Z\241G}\277\032\037x\367\305\350yX!\345\003\246\360\001\177`\370\200\033t7?I"
+	.string	"\372b\270`\221b\367\"\n\n*\352i\367\202E\017j\367\004\224\332I0r\324\317\007\334\305\210\212\002\356~\214\365e\335,7\2551\021,oM\231`\177^l\313`wI\200\0356\215\231H\313\033+\263\013\226\002\330a\323\227y\264\274\257Ri\177^a\273\2644h\207MOL\243\345=\351z\003\264\303\246#&\357H\231\264?/&[\356\227\374\354\260\311\207Y\264<\037\345\317\213\270\n\326\305\224.\252\333a\007;hUke*\274-\202\352\030As\264\321\253\333$\350\r\037m\323%\333\004\r\036i\341\304\310@i\363Y\273G\253\002\254\317:\005\200\235\250aLf\020R\314\314\210(H\222$\255\001\320\002\021)\2536\022"
+	.string	"\0251S\032f\210\244\230\271\244 \246b\315X\024\255\313\322Q\365~\371Gr\212\330\334\351\027\223l2#\026a\275j\307\227Q\345s\036\210\372\274y tbg\222\326\302\241\246~\336h|u\336\215hFu\204\303\3471u\032s\375\016\335Cf\277\201\246\235\300h\254\264\305"
+	.ascii	"\274\033Q\274,\210\320*;V9+g\340\255|\305\r\346\342\371\026/"
+	.ascii	"\031=\347X<p\017\346\032b\"\205nF\260Q/\bV^\311g\354\320\365"
+	.ascii	"\346\356m@\305\303\022\003\223\264\005\002b\256\345\b=\f,\351"
+	.ascii	"\330_C\273\375\276\327\"\305\236\351M\311r\346\037\352\207\363"
+	.ascii	"\374;\021%\224\224\244r\037\220\376\243$l\267@\324\211\312\266"
+	.ascii	"\035j\272X\036\n\267\316\367V \334;f\013FF\364_,U#\366q\207\035"
+	.ascii	"\211\0014\275\203\003`\271\245\252\017\244\276\003\007\004\036"
+	.ascii	"0B\221\336\260\240\316F<~Kx~l0\240\037\025\201\233\336,\rR\005"
+	.ascii	"4\237E\251G\277\202\004\301&K@\255\263\254?"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.15.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\264\002\355\021"
+	.string	"F\337pI\340\262(\035`I\2157d|\361\302\204\262\347(\370_\020\001\212hJ\370\034\007^{Lp\314W\340!,F=\313\235\352\227h\\\345]\354\212m\\\005\034\340\020\207P\250\215\307\252\031\"-\t\372UmO\032!D\356\224\002U"
+	.string	"a"
+	.string	"U"
+	.ascii	"9.]\332\0052\262\355n\211S\337\273\021\356\323~\214\313\200}"
+	.ascii	"\346r\001\2736A\266]\262\304\013\276w&O\300{\367}\200\367\316"
+	.ascii	"0\273\350\344\315\236h6\202\206\321\356\202\252\342\260O\230"
+	.ascii	"\377\237\227dhb\237$\007\273\353)Cc\342\326\333F`[\203\255\t"
+	.ascii	"\002\367\271\271\333f\377D\235^\f\221\034\355\2228*\262B\335"
+	.ascii	"\r\026\247\375\265\337\347\267\235\263\377\236\333x\371\037\237"
+	.ascii	"l52\370\3200\324\\\216\304\240v&DO\213\0136\315\345\027+Q@\004"
+	.ascii	"Q\215\310\356\222\274\263\005\233\343\371P\024a\307%\207\332"
+	.ascii	"\031\030\036\b\252\363\342P\033\203\342D\203I~\006\354\001j\257"
+	.ascii	"8\314\313X\201\213\035[\2431\333\254\007y\2528@d\342\201\272"
+	.ascii	"\033\313up\2528D2\267\236\303\345\267\273\f|\034 <\030\270Y\341"
+	.ascii	"\342\275SU\234\037\267\331\313<\262\311\330\324\024\366\271\335"
+	.ascii	"]\253\215}\236\337\364\235\277t\235\377{\316O:\355\366^\273\273"
+	.ascii	"\251\226y\3222S\257y\362\232\341\312\253\302\204\207.\024\n\033"
+	.ascii	"Z\341\230\022\216'\226p|`\362\2542\031CW\207U\n\250\"\262X\242"
+	.ascii	"\nTY\241\260@\325\330\002M\016X\\\tG\320%\212#x\"\367\334\252"
+	.ascii	"\215%\300\020zQ\030{\352\243H\326\351\320\215\323\036Cd\252<"
+	.ascii	"\002\004y\021r\253\0010MZ\322OI:\0038 \360\002\031\261\321\003"
+	.ascii	"\370r\020\f\221\346)\363xG2\034\214\204\214\035\210*F*\030\033"
+	.ascii	"\260\001\201(\030;`\325\206TZl \206\3433\210\3041x\177!\033\177"
+	.ascii	"-S\346\320\037r:\266\234!DJ\b\345\234\315R\0069r\033\303\020"
+	.ascii	"I\034\311>\361^J'\235\361j\303x\333]\256\266\232\304n\362\274"
+	.ascii	"xY\006,\021F\024q\023\203W\244\261) ./\332C\006"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.16.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\007\003\355\022"
+	.string	"\206avH\340\3604\035\360l\360\264?\017Zs,/\036\261\211Gd?\237&\304\205`G\266\261=\004\303\361\017\201k\360\004\3218*\031\376&Y"
+	.string	"s\250\021\375#\344\f\346Q\246C\345\361\301U<`\203]\236\212mi\223\275S\n\\"
+	.string	"d"
+	.string	"\\"
+	.ascii	"!v\030\314\361*\302\377\230\364\307\356\213\035\345\356\216\230"
+	.ascii	"d{\025\311>\355\367<Ex\037\231\013\330\325Y*w\307\021'\330^="
+	.ascii	"\236\200\366\272}\200\366\352\320\216\372"
+	.string	"\270\263w\232\301!H\307\356vt\304\303\317\320\177\320?npf>S\rv\327\363\006\007\304Mo[e{\202Mm\002\0018%\032+\241]\017=x,S\205\225x\322\017\373\221\376\362\231}\237|\351#\035\366\244+\231;2\"*z\271\\\341\207\302\227\257\260I\016\356\305\037\272\353E?2gD$\341\345\212@dR\244&d;\330\274L@\260_.dr\233\371P`\203S\021\216\335U\360\352\007\333\3539\333\024(&\013\331\232\324/U,\314\337\030\301\t\031\233CgX_\332(\345yj}\217\221\212\261\034\206F)\217S\353\245[\356\302\244\201\235\335]\340\267\320\220\301'\361\352\313h\257\225^\351*\236\246\230\2178{\330#\315\244\"\354gKu\354\227\367v\244;u\330\255=\351\256\007\372\263\377\374\364>\377\f$0\263\004f\222\304\314\222\230\351\271\234\230Th\361\300\024\017\344X<\320\001"
+	.string	"\315(+\320s\271\240\222\322\255|,\326\207\322\255\250\234\260:\024\260\245[\035\360\207\301\003;\227\357\003;n\024\037\364\355\305\202I\2444\336(TT+E\237b\032m\272\321\252\264\206I\020\250*\332\210\345\200L\237\202f\362(\304\036\246u\266+\2522J\351\f> \360\002\021\261\235\003\312C\244y\212\b\355\216\354\311"
+	.ascii	"\b\212\354}](6\025\354\271\230^\230\033\366\nl\264\231\245\365"
+	.ascii	"|=\r\362r\314\024J\342\004\243/\210\301\257e\021\316\330\341"
+	.ascii	"\037k\332\031\343\365\241\005\313d\201\\\303f\0219\320\230\227"
+	.ascii	"p\214 \344\320\226\201v\302\025\ta\033\244s\tCHy\036\343\025"
+	.ascii	"I'\345L\321j5\020\003\336\036\240\343\214(\306M\214\256H\363"
+	.ascii	"S@\\^\264\220\f"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.17.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\374\002\r\023"
+	.string	"\246\243zF\340\322h8\212t\b\202\005\n\244\n\220\367\302 A2|6\352\035\006\023=s\230y\314\217.\310I\256{\332\232\345\312\001\236\254\225\343\204\031\3470\306\235\261\327\301\006\212\203J)\n\237\304\303/\261M\366\336R\246\024a"
+	.string	"Y"
+	.string	"m"
+	.string	"\273\t\356y\001\230\371\035\343L\332\375\341\301\263\273&V\360\264_\373\211\330G\230\247vgf\360\354\216&F"
+	.string	"\336\363\b\332\366K\334D\314\306u\343\b\233\317\202\320\205[\321\356\206\005\256\372\356u\037\371\356\251\210\307\2361\377\267w990h21\317Q\203\335u\322d8\334z\333\006l3\260\025C\231\263\307\230T\032\373\335\352\214}\333\255\372\316O\362\361\037\311t*\323\"\231\016\3114*\323\247L\203d\332\224\351R\246I\231\0063=\312\364\227i/\323]\2465\323\231\351\227\240<\3248!\332\325\220\353\261A^\317\315m\277\035\363o6\331\266U"
+	.string	"c6"
+	.string	"\240\321\024\351\3303\022 j\322\223\022\330\301\272\017\210\236h\302{L\372\034$\375\264\244\001|\200:R\222\226\330\230\341\310Z\347\001\365@55\321\365\026#=\316\323\324O=\241Y\bY\346\334\251\252\247#\0273\034Y\313Wt\372[MMt\271\nU\024\034$zM\355\204f82\277<\205q\340\356\242\370(\036P"
+	.ascii	"m`\276{W\222\330C\247&\0060\225\027\227\325\353\203\275\260\254"
+	.ascii	"\260\274\317)'\257\025L\205\025!\\q\265Z\256\224p\205\005\241"
+	.ascii	"\025\246\274\\\302\023\001v\261\254^!\314\345z\205\246q\337\255"
+	.ascii	"\316\250\024\225\241C\220\2502\2534Hf\323\371 \002\345hC$j\267"
+	.ascii	"\\\206'\376\320\001!\3068\335ppC\2036\224R\224\2524E4DSz\340"
+	.ascii	"\266\372\217\210\246\217\204\277\b\321\274\235\264\244(\035\300"
+	.ascii	"\"4 \340\"\021+z\351\232\"\"\236\224\024\r^\202N4\020\rU\305"
+	.ascii	"\177\301\200u\0335\316\032\204/.5\030h\275\273\342\270@\352\254"
+	.ascii	"\2319b@\311w\240$\",O\f\224|\007\224\004\363\362x]\303\244\346"
+	.ascii	"\302\020HI$\034o\235A7\2051K\311\206\370\r\261B\022\027\030\205"
+	.ascii	"\340MlU\032\221\370p\226Rhr[%\t\004,\263\211\247*\305t\t2"
+	.text
+	.section	.gnu.lto_biquadFilterApply.18.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`b\002\315\020"
+	.string	"\266_lD\020\257h8\300\\[&5\211\336\366\206\322s,>1\272\3475\254h\327\244KJD.4\211\320d?\365\367O\351\216X\002H\332*\002"
+	.string	""
+	.string	"(\231\\\032\236\3771\005\244*\2146\262\265v\357\275\267\224)\005V"
+	.string	"Q"
+	.string	"Z"
+	.string	"\27303.\273\273a\003O\373(\357\300\372\370q\214\335W\t\227\335q\303\004\274o\036=\333\376\206s`\331-\332x\301\204\013\021\t\221\315\354\356'\340"
+	.ascii	"\270o\332C\3347-9\353\311\362/\273v\022;\341\032i=;\005\273\353"
+	.ascii	"t\215P\270\365\266\007\330N`g\213)\177\306\307\037#\323\240L"
+	.ascii	"\1772\355\311t'\323\234Lo2\255\311\264\227\351.\323\\\246\267"
+	.ascii	"Lk\231\326Lg\246\257\3619A\201`\266+a\366bc\266\027\fW\371m\226"
+	.ascii	"/3\307\266J\004\2575A\303URa\305\356\026\370\346\003^\346S\334"
+	.ascii	"bM\233z\252\311\210\031\302\2349\244\234v\312\215\020a\340Cp"
+	.ascii	"*\322tS\225\021a\017\276\242i\027\256\270PM\ri\262\210$\251\203"
+	.ascii	"P\345P\221\241\327TMF\204\205^\375\203[\274\335\345\360=,\200"
+	.ascii	"\340\231|p\337\256\232p%\206\002\2223{l\245Z\260\257\255\276"
+	.ascii	"\354\253\334\241\007\252\216U\212\204\342T+\217Si\343<\022\241"
+	.ascii	"H\252\216R\203\357\004\232L\340\350;\225\030\230\276\021*\365"
+	.ascii	"\211\002\030\364 \241>\025\b\242>\316\270\327V_!\375\210h\210"
+	.ascii	"\001\321\320 \205\371hGA\036\375\224N\302\303\321\216\203\213"
+	.ascii	"\340h\027\262\3046\372\342I\2212\027\013\215z\272\321\316\204"
+	.ascii	"Hb\272\213F/\3534, \260\"\231\263z\251M\021\212\007L\242YI\320"
+	.ascii	"c\003\271\264`\320\233\321\030\3505\034d\0024\214\254\264`\024"
+	.ascii	"\2446`\004\343M\316\214E\037\206<%\004\341\341\340\240\256\354"
+	.ascii	"E1W\243P\321\033\306\234\222\035\361\333cu\024\027\326\206`O"
+	.ascii	",E\024\221\350p\026)4\275\255B\002\201\226o\342\311\245\230\256"
+	.ascii	"N\006"
+	.text
+	.section	.gnu.lto_laggedMovingAverageInit.19.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\315\013"
+	.string	"v\025O@\020O&\035\300\270Wo\"\250\bI{\037\027\341\304c.\325u$\361\246\237\220\341\242\373\n\204\360\373! \250 \001F\343c"
+	.string	"T\004@\342\237\004\023\230\210\240fx\232\313E\227\240M\310\336)\0058"
+	.string	"="
+	.string	"="
+	.string	"'v\253\001\027\350\316\271>"
+	.string	"=\327\035"
+	.string	"=\347\321n\361\352a\3772Qp\315v\327\233\035>^\216\376]\177\214H\237K\307\202\335\265\034\2210\334\363\266\t\330\236\330\257\020\247_\375\333U\277|h\352\354E\202\332\356\205Z\214U\301\241"
+	.string	"a\373\020\333[\3130\001\221\025\261P\nf\275\210\361\253\216\214\254(d\341@w.\"/\355\247\036b\274\312\363\215\335\023\2133\031\235v\370\022\206q\031b\250\3226\355\t'\341\b\245\240\225\336\2416\346#:\335\356\"\360_\034\215\306\212\017\036zn\242a\203)%\003\311\232]?rr\260\277\355\356z\236\354\267\036\026\215\203Y\341|\f6\341\203\313\267\311\240\246H\304J&\302g\361.!\b\206\024\357\3625"
+	.string	"=\212\210\361$\003\034J\250\210^&\fE\017R\367\333\316\2237\030\225\346\0024C\366AjC\270\t\220\025\013\027"
+	.ascii	"i\231\"\023\217\363\242\301\005\027PF\212=GSS!0IQ\035\2520\335"
+	.ascii	"\342\006\231\260\3105 \300\206VB9\230KB\260 |\246F\301eij4\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_laggedMovingAverageUpdate.20.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\206\003\355\026"
+	.string	"\026i\215I\340\316*\035\252\034(N\322e\207R\271?\326\030\205|\270\311\006\273;bM\223\250U\033\210\310,W\021\372l\021m\243%9\375c\233\2005\321\020\034f\260a9\206\303\256SM\242\\\276\2306\206\266mk\204l\262\245\224)w"
+	.string	"n"
+	.string	"\177"
+	.string	"9\265\326\217\017X\376\367\267\034j\013<Y"
+	.string	"\265\372\210rj\005~\334\203\\\361@\362\377\227fkj\277p\002[^h\016&w3Tk-;vEW\234\253AWl\013[[*\316\346\332w\024\231E5;:\036\312\322\b+\242x\017fG\255\025\307se{z\364zVP\274\224\271\002\252\300b\203\313;\336\215y\024\251\265\236u<\b\373q\377\307\376\207\374=\"W\260\035.$k\255!\337\233\0030\362\345\204\256\270\315\242\360\323\333\360\263\361\360\007\242p\263\374;k\3738H>kmvW\013\334\325 \371*\346\247F>\212\362O\223o\232\374\022\363I\314\0371\237d\376\330|*\362E\221?'\277\233\317\314\337"
+	.ascii	"\rb\206^\024\030\326\2522,\252?\242\316\205\377\265\277\364\237"
+	.ascii	"ym.\234\252\272\273\251\0043>CB\013\243\353\375t\263\334\324"
+	.ascii	"\245F\020T\221\3021\376\267\226\204\313\324\245\313\257\324;"
+	.ascii	"\256\215\233]\027\355.5\001\232\024\270\036I\304\250I\275\233"
+	.ascii	"\316\205\243\356\031\023\032"
+	.string	"~\253\336h)\005{\210&\220-<\005\255\016\306\330\333d\263\f\\\314mC\314.\374\036\207\2568\366\356$\210\315M{q\030\346\236\207\316\026{\266\300\311\334x\370\356\331\233\233A\262\037\\\335 \257\365p\034n\001.\001&\fJb/\221\276\0052#1Y\360JP\306d0\230\254U\306^#\260\2625\243\225 \254\313JHf\245\211L6+K\300\272\263\266\357,\262zc\210z\323\324\252\336\375\347\350\016[\337\236jRs\364\342J\240:\325\213s\241jT;\250\331\311\315\260\361pR\024\013\242\205\325#\346Z+\212H\243\247^\231\340\n \332\251\r\364|\263Y\226F\377\221\365\241\215\267\023\031\204l.\312\343J\005\005G\250Q(*\0213C\025\210L\"%I\332`\"\221d\327\001\021\240\245TT#E\005\333\f\351\022\207\013\315]\3322\234\033y\007\246`\341\205.\020jpH\321:\2240"
+	.ascii	"\225\265\262\207}\203H\006R\201N\226pX\244\307\006;\361\210\327"
+	.ascii	"\342\356'\n\247P\032\bc7^J\233\334\212\022\032\272\257+\027\206"
+	.ascii	"\036\377 +\263\325\244\354\203MQ\013\335;\027\232\2337\265C\272"
+	.ascii	"\306\250\022\222\307\330\3124>\224\257\235\271\b\257\274h\344"
+	.ascii	"u\223U\2144\226z\200J\365\002\324\206UZ\217d\025\001\272\331"
+	.ascii	"E\232b\n5"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"5\005"
+	.string	"\264\006\356\001"
+	.string	""
+	.string	""
+	.string	"\002\005\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\006\177\023\007\177\024\b\177\025\t\177\026\n\177\027\013\177\030\f\177\031\016\177\032\r\177\033\017\177\034\020\177\035\021\177\036\022\177\037\023\177 \024\177!\001\026\177\"\377\037"
+	.string	""
+	.string	"\200\200\200\001\025\177#\003\b\021\204\001\003\b\020\244\001\003\t\b\"\003\n\242\001\003\013"
+	.string	"\031"
+	.ascii	".\205\264\344\001\206v\r\215\273\206\341S\304\220\230\036R\301"
+	.ascii	"p\331\003\264\003\237\003\237\003\237\003\237\003\237\003\237"
+	.ascii	"\003\237\003\237\003\237\003\237\003\237\003\237\003\237\003"
+	.ascii	"\357\\k\342\001"
+	.text
+	.section	.gnu.lto_.refs.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3ece9d4763afba77,"e",@progbits
+	.string	"(\265/\375`\037\025\345]"
+	.ascii	"*\230\\!R@PJ\032\016\272\272\251P5\333?;\2041\230S!\030\232\004"
+	.ascii	"\310\321\355Z7\367\276\256;T\324\324\254\352nTU=\241\030\313"
+	.ascii	"\025\307\tU!h{)\304\261\330g\016\246\226\367X\344\r\nuq\244{"
+	.ascii	"\203w\231\004\266`\217\374\363\216\357d\273I\231\002\244\001"
+	.ascii	"\001\002\024\002j\311:\016\351\267L\345\345\376\374\020X/\365"
+	.ascii	"\333\245~\217\250\337-\365;D\375j\251_,\365\353C\375^\251=\033"
+	.ascii	"\252PY\253\273\254\031\234\262\001\371\230i\366\320p\372\245"
+	.ascii	"\212\022\245\311\331\206=7M\nSme\330\265m\356s\245|\247,\332"
+	.ascii	"\323\007\240\2335ri\276\324\364\013C=t\177~\300&\365Ig_3_2j\271"
+	.ascii	"\372\350pQ\261\302\343\024\n\320\t\2721\034\234\036\205\372\025"
+	.ascii	"+\3733\210\323\335&\306t\340\027\376;\266b\353\334&\177.\324"
+	.ascii	"\254a4\027\310\213\372*\223\327\335O\326\3116\327\271d_\260\r"
+	.ascii	"{\272v\233u\367\207\017@8_?\226@\375\322\217P\277\200\372]\017"
+	.ascii	"\200\226~\340\252zV\323\335\360\353\260?\277\257\373\363Sw\303"
+	.ascii	"/\335\027'\341\277\002\357\371\031\356_\237\372\357\357\337\233"
+	.ascii	"\020\256\3633\333\201?7M\020{\360g$]\276\3633\327\377\271\377"
+	.ascii	"u\377\275\374\357\362_\356\277\335\377/\377\267\374\247K\241"
+	.ascii	"\351_\027\347\360\263\217\177M\264\270\372\363\226\0052(\200"
+	.ascii	"\361\377\371\177\355\277\332o~f!\004\3616?\023\375w\362\337\371"
+	.ascii	"\337\317%\234\177\326\340\276\237'\370\327\370\357\322\277I\377"
+	.ascii	"\022\377=\341_\023\376\035\341_\021\376=\361o\007\377Z\360/\005"
+	.ascii	"\377F\360o\210\177\205\376e\340\337\004\376\355\360\357\376\233"
+	.ascii	"\363\377\356?\333\177(\377\n\360\377\314\277\034\376\005\340"
+	.ascii	"\277\211\177w\376\005\376\253\363?\372?\314\177*\377\315\376"
+	.ascii	"s\360\037\201\377o\377}\366\366\366\366~\237\321\357\013\376"
+	.ascii	"<<\002jf\244A\306\3551\371\324SRW\310\252\036hr]v]\367\232Au"
+	.ascii	"\325\001\335W\313\252:$\216Us\202N9MA.\005\220r\312Z\366\023"
+	.ascii	"4\351\265\354\366rb\321R!\216+\264\211,\364\b\344\252\243\240"
+	.ascii	"\272\007\220\352>nC\273\373\330\3357UWk\267\216\236$SJ\252\333"
+	.ascii	"\nH\252\257\216kP\335l\326EM\231tf-\205kO\234\314\216\261\036"
+	.ascii	"\227\331uXU\252\363\330\354\250\356\3361*SI\003OG\016\234\032"
+	.ascii	"\234VL8\265\322Q\022&C\r:\265\3118\370Fw\003c\020\261\222$.\210"
+	.ascii	"k\340<\255<8scx\230Ua\027\304x\311\221E\2462\025Wm\223\225O\311"
+	.ascii	"\226\355\354^w|\310\033p\317\240\037\317\006M1\362\006\314J\226"
+	.ascii	"\231\324\323~Tbys\034\325\302\217\311\232*M8\345\031\277\257"
+	.ascii	".\037f8=\027a\250\305{Z\001NI\f\226\324E\035H\263h\2026\335K"
+	.ascii	"8\346\222a\250\255a\321,t\210\004aq\321\356\365\211e0\f\216\301"
+	.ascii	"\311m2\324\352}\325\354\232\0031\324\216\3713\370\264v\021\021"
+	.ascii	"Y\240\256\362\206\036`\250\335cd\360\2706\325\220\035\324U^\367"
+	.ascii	"\372\001h\006\216\251\004\246\214d>\262\323\031\311\375\241\007"
+	.ascii	"\016|\352\260\356\225\221i7r\327\200\340\256\0016U\214 \313~"
+	.ascii	"\3519\210z\366\241.\020\313P\277f\3245\263y\333\364\260g\276"
+	.ascii	"e\226\314m\220k\257\335+\017o\2519+\273S\277\036~\276\275\275"
+	.ascii	"\365\360\373nQy7\374z\326M\375V\021\343A}b\223\022\306\351\277"
+	.ascii	"\3210\351\0315W\222pz\247\242\275\220\245\344\211\n\327\026\025"
+	.ascii	"\233a\207Z\230\333\230\233\020K\033\323\312\2268\267h\226$mQ"
+	.ascii	"\2646+n\321\275\362\006\246f\267t\353e\277\354\334vY0\313e\353"
+	.ascii	"\266\271r\013\375\322\260Z\304\3446n\231cm\321\356\376\240c\025"
+	.ascii	"V\326\326\270\312\2264&\317\232\307\205\b\225s\225;\036\262\250"
+	.ascii	"\031\316p\312l\214vEF\0235\234\262\f\177\246mdhQ\266\361\213"
+	.ascii	"\243\322CC\366\344\t?\337R:=;-i\347\347\335\016\217\036\316("
+	.ascii	"\214\006\301\323\233\034\332\2245 C\220wz;\360\350\244,\324\347"
+	.ascii	"\205\305\004\312)\237\375\271\003]oHq\312fl#XDk\354\006\247\f"
+	.ascii	"\345\317\033\037Q\364\3120\rvj\001\203v9\235\254\265\345l\273"
+	.ascii	"\270\264\310~4i\302d>|P\224cIN\231\314\327\002\016+98\345\225"
+	.ascii	"\301\200k\315(!\312$IXl\255\"(\263\372\275\225u!\t;\213\351L"
+	.ascii	"\315\231iNy\t\203\275\231\271\262\002c\302\343v\306#\212\355"
+	.ascii	"&\314\206\232\257\257\225\262k\306\312\3128e%)\262\253\213\275"
+	.ascii	"\230y\363\304)\031\r\246Y\273\346\220\234\275r\234\350i}\341"
+	.ascii	"\224a\030\303\305\305F|\335=\3220q\222T\3718\002'D\b\033\371"
+	.ascii	"\002&\332VVA;zPX\212\234\215\334\361,Y#\305\006\247<\204\267"
+	.ascii	"\2004~\344=\267^\360u\031\231\302\001\245\f\330\235"
+	.string	"\023\221%c0Sa\364\236XX\254\325\323NwY\242jSI\026\035@\316Z\351\217\272\034B8\345\254?\323\232u[M\365\274\203\257\316<\316\203\227jw\203H\333\241#\257\255\256\202p\362\270\274p\312\313?\201\335a\335]\300NX\034\215$\247\334\203u\360 \275\250\261\301\351\313\340l\fi_Q8\275\317\206\372_#\253\272\333\005\233\265\253\234\200_\233\335\240\177g}{\300\377\264;D\264\333\213IFE\362D\356x\207\376\222\356\243O\257]\225tb\035\223N\264(}\326\376\021@;\201tr\305R\246\313\346^{\373\tK\231Br]V%\327\345\261\247\237\226\307\356U\331\2234C\0367\351\304R&\235K\245O?\365\261\235\310\037\352\323R\231\304\262T\366$\235He\362\tK\351\303\305\334\n\306\242\342\221\n\233$\"S\316Y4\300\304\302X\204\324T\\RR*\"b*\246\310\021 "
+	.string	"\037a\t\0138\224\360`\203\237\022\036l\260\241\347\003\026)\214E\023\306\341\005<<\301\240\n\025Ec\213\n\206\306\"#\245\023?FbR\006I\304\242\013v\236\342\305\221\222\322\004GG-\222x\236\202\2704L\032\256P\037B\004\003\"F4\335|\004\t\020$@\374>\202\204PHB\204P\275\b\241\317\310D\244\032\211\206\034 \032*\275\b\001"
+	.string	"\343Q\261H\001\221\215\321\020\211\270\244\364c\"\032\256(Z\032\2520\001\007F\303\025+\212\216~\232\206FI\031\210\340c$\022!4&\021[\250\303\025\210 \270(\032%\021]\344 \265"
+	.ascii	"aE\022Q\205\"\022\216\212\026(|\306\241\027lT\324\"\005\"\212"
+	.ascii	" \b\024,D\301C(XX\304CE,l\342\241&\026\276`\243\321Q\221\005"
+	.ascii	"\323p\211\205\021\007h$\"\0217p1<b\3021\262 \340E\245\341\222"
+	.ascii	"\220\261X\\\022\322Aa\231\210J\b\215J:\027\n+\350p\302\304\005"
+	.ascii	"j\212\006\226\206\306#\242\n\241\244\"\022R1\205P\022\261\bI"
+	.ascii	"(\305\022\223P\003\003\f\215EF&\233\257\253\216Z\217\263\032"
+	.ascii	"g\360r\316\366\304|\341\364O6\323\354\001v!\203\366\223Q\303"
+	.ascii	"3\230\205\005\235\343\224\314\3110\336\366\254Nr-0G ;\202\267"
+	.ascii	"F}4\312xK\326T\005\254\255an\344u[\005\251\307f\r/1g\274\347"
+	.ascii	"B\351B\003\233M\233\027/|\367\213qd\207\216\274\233\037K\032"
+	.ascii	"s`"
+	.string	"\316wA8&=\312p\312_\230\016\007\256\t\0216\2331-Z\330\016J\017\337\013TO\250\352\316vPR=\2708e.Lg\203\206\210\0164:\236\333\262\232Q\3053x\270\030\231\032\"\267zM\320\250\034\247\274e\321lr\f\215\2674\265\313\212\214$A\240P\216\243\233b\346\320u\325\020\204\323\333\324x{\3438\030`X\353+\207\rN9\016\230D\226\021\343\224\2610Z\326\231\335\215=77\271,\\\272L\261\273r\205\237\333Urc\321\233c\020\034e\001\201\277\250\261<\245\0243\"2\"\"\"I\222\244\003a\005\204 \007\241\264m\021\360(\223\316\220\214\214$)((d8)\312\356\315\007\362\"l\367\327u\337\231\002Q\317"
+	.string	"Z\342\216\025\377+\231\213cJ0\3647\310\t\031\021\020ZJ\341m\313n/\270\262\236\235\211wDV\271\304\360\370\304c\211\302\034m\243:$?@\036\023\243\371a\017\303\f\212\262\032\032\201\270I\261\202\300\256\212]\026T\f"
+	.string	"O@d<\365\024\323\235\333Iv\200,\350|\255uz\276\334>y\242\371\231K\024"
+	.string	"\016*<\021;\233V]\332.`\013\365\t\0213\375\205\210\r\201)\366\027e#\272\355\201.\376\022\301do9\214lU\364z\257>\357?\304?z\201\344\0162>F1`\305\366[VC\306\023C\333~\355\376\3339l\325\021u\236\2142\255\3139B\200\321\022\253\225\337\023aff\253'_\004z4x\361\345\361\251\002\\\213\021\315\234\020\202q`\251\r\203)N&\237M1\032s\001H\024\241\321m\002\256OO\226\001}\251\\\201\3364\030\b\311\202\020\036\230\017\307O^\246\024\017\256\f\255:\203IF\003\221\221S>\247\033t\341\304\333\351\302\0131=_\006\224ZU\300|I>\320Z\2142\304|\212\237\267-\0208\203j\037++|\ne&N\252\212\002~\210\025\235\241$8\362\025"
+	.string	"H\210\\[\232'\210\002\f\335P\255\246m/hM\311\254\254\357\345@\fP\345@7\234\274<\202\177\363\252\275G\364\202|\350\2431Nx"
+	.string	"%&\246ot\277\244\226\364\013\027\243\322A_\232\313 \357\246dL\006'?S\300\342@B\tH*i\221\254\237\264\257\357\220g\016\233\376\367\302J\252\207\203\017\307\022{\2534\261\347\313m42\003\304\336(\262:g\375q\356\246\004\262\236N\022x\266P\277\370\017\367D\035\024\202\n[\247fu\253\310\236(\3418\231\354\006\314\276\235\325\204!>\035\200\f}<\276\300\362\034\237R\316\001\365d\323y\275\332s\215\361\327\245\202\005T\3721\365\306\323\274$\377A\031 \r\033\263O\360>\204\313\033\030\306}\bZb\266\0270\317\216~#\214wt\r\243\303\206\357\363Cst\351\037\373\006Z\265\005OS\n8\242\255\3744|\027Hg\227\300\242\031\204\3679\263\365m\352 G\340\367\022\337\035\250\235"
+	.string	"C\200\343\372\305\261\370\017w\361\241\377\351@?\204'\\\207\240r\030\004\217\f\301u\\\2668\244\253O<\316!\370P#o4\016\364\307\367\037C\272\036\343\332B0A|\306\206d\215\343\226\275\303vr\270Z\343F\341\222\273<\206\274k\330=\241\206\t\276&\002g\244\237\3562\037`\354\334\300\001\257a\213\301\033f\370|\224.\357\267\213\343\355p1\274\r.\360;=_\274\r\027\276\226\371_<\272\266x\027y\331v\203|\231\276/w\300\305f\t48xHrCy\205\377\020\361:\200\031\323\263\323\217\353\325\331\346_\233\360\0016\360Fu\205\306/Zw\274\337\334\317\342b?\374&z\374\311~A\243"
+	.ascii	"[\224\\\036\256\343G\205\327\352`\333\2106@|7L6y`\025"
+	.text
+	.section	.gnu.lto_.symtab.3ece9d4763afba77,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"slewFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"slewFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"laggedMovingAverageInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"laggedMovingAverageUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3ece9d4763afba77,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1439 @@
+	.file	"maths.c"
+	.section	.gnu.lto_.profile.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\341\005\355\n"
+	.string	"D\020\325\006"
+	.string	" "
+	.string	"\341\333\245\345\002"
+	.string	"\001\337\352\303g"
+	.string	"\002\203\270\227\357\001"
+	.string	"\003\264\245\347\210\r"
+	.string	"\004\346\353\250\236\002"
+	.string	"\005\246\240\335\225\r"
+	.string	"\006\347\231\311\265\t"
+	.string	"\007\267\332\206\371\013"
+	.string	"\b\271\225\217\236\002"
+	.string	"\t\352\222\314\276\016\002\002"
+	.string	"\002\001\n\223\242\326\261\005\026\002\013\326\331\347\361\r\004\f\350\355\231\037\r\231\274\327\315\004"
+	.string	"\016\202\362\202\320\006"
+	.string	"\017\326\360\230_"
+	.string	"\020\244\330\372\372\n\f\002\002\002\003\021\277\337\362\237\002\030\002\004\002\002\005\022\343\267\372\377\002\036\003\003\023\207\330\371\361\002\002\002\006\002\006\024\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\025\242\333\255\257\0038\t\t\002\t\026\333\332\376\205\007d\n\n\002\n\027\234\341\340\262\001\220\001\013\013\002\013\030\f\002\f\031\r\r\002\r\032\016\016\002\016\033\017\017\002\017\034\244\246\246\251\f\006\035\275\305\343\240\f"
+	.string	"\036\354\261\352\343\013"
+	.string	"\037\364\207\213\233\001"
+	.string	""
+	.string	"$ P\202'BT8$\270\256E\211SG8\300B\220\356\350\321\b\260d$.\035\341"
+	.string	"KF\017"
+	.string	"\327\026\330"
+	.ascii	"\260f$\361Sw\312u\335M\231.k\361\023\023v\273.s\006\331j1t\242"
+	.ascii	"\311\201\352\316\f\217\306\347\027uQZ\313\021\306os\021\331\326"
+	.ascii	"\024\327\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\265\006"
+	.ascii	"\342G\031 \260'\035\f\3030\f\231\206a\030\026\241nM\335\232\272"
+	.ascii	"5\265F\322\266\267\331\275\311&2\245\224\002|\334\216F\315a,"
+	.ascii	"\024\315\233x\021\357\201Q\344\202\324Ux\264\241\217\3230>\373"
+	.ascii	"T\241\226\314l!\213\326\325\222\325x\037\341\311\340\002\257"
+	.ascii	"\243t\265\243\027\327\226}v\003\005\264*)F\211i\367\355\236\017"
+	.ascii	"\033\t7 \300\002\242\242z\266\270\005X,c\300r\300\242\301\030"
+	.ascii	"\242q\325`1\216\321\200\325\032\002Z\350\027\026v\317`\036B\031"
+	.ascii	"\314\374%\037\t\310\360W\334f\3262\225DVT\304Y\300\007\313\210"
+	.ascii	"\022Gd[\237\253\304\230\036\fu\005\313\003i\024\177\230a\033"
+	.ascii	"\342i\003)n\321\233\271\025\r\276\360\025\216-DZ\240\205\301"
+	.ascii	"9\226\f\303\213\213;\004"
+	.text
+	.section	.gnu.lto_.inline.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`'\f\325%"
+	.string	"v\264\250G\300VQ:\264\020\326\240\253"
+	.string	"\234\374\226\017\316\346\346\354uBz\273\006%1O*\222f\f\247\020;\206\224q\024\213gs\335[\373\005\261\004!Y\001|\335\256\272j\210\370\217\212C\261\372\241\333u\363\265E\364\336I\246\222"
+	.string	"\224"
+	.string	"\222"
+	.string	"+Q:J\323\316\212\306\201(\210\216>\3008\312\350\370\202-\234\344\330\335-\327\356\263kc\340oZ\006Y\264(\301\274\216F\303\332\203\020\035\205\370\fw\273{R\032\352\"\355\021B\n\322\332\357\331\335I\340y\233h\235\241G\206\204\246"
+	.string	"\360\035\341\246\2166\nJ\317d\207\335\265\331\320\366\274\372\323\t\236an\003s\0171\227"
+	.string	"\355\235N\360\346-\370\2064hcHh\351d\275/\373\356\256g\347\334\226\"\267\244\3406\314\271\210\024\271%\031\373\263\013\201\227\276\214\345\242e\006K\332M\020\035\361H\313yc\t\273\345\347\313\317\227\257\033)%a\241\237\376\264\013N]\350\324u\203\033\250S\267Q]\330@S\327`\317\020\347M\214\224\224\314\370\304b\303\2562\330\262Z\341\320\325\n\312\226\343\013\222@\022C\351\226-\313\327O"
+	.string	"\375\374\220=^\210)\212\221g\363T\327\235\252\256\243\022<\32518Zg\360\206\221 \033'\263\330\261G\255\335D\222\316\207\274\355\324U5\227\244\363\301b\017\002\335\326\034\030\244\333\001\305sqM\273\220\335]\371\337\031\304\355n"
+	.string	"{v\034\312\345\372>\255\241\260\3050\007\272\370YQ\304A\234\2421\316q\273;(\317\211\222\260\030D\332\265\265\330\260\035x\262\353\203\206:vwX\236s\3169a"
+	.string	"\0167\017Z(\307\376\253\241\035W\2548\277\355n\213_X\206\263\257\313\217\221\240\235\213Q3\216\263O\001\302D\306c\321q\372q\372\361u\335\317\212$\262\257\370ro.\030\236\030\022j:\031\200\375\350G\330?\224\320\335\240\245F\321\325\365\245\003\266m\224i\337\371\270\003(\275\001\031-\360d\027\004\353\232\264\013\342\3054\004\340"
+	.string	"("
+	.ascii	"\316T\370\217\246&&eR\341EMML\226R#\263dw5\367dw=\204\206\365"
+	.ascii	"\027TF\360Px\f*#x\034\250V\266y\354\256\203\332\211\354.\rJ\245"
+	.ascii	"v\204\333i^ML\006\025\267]\277\005\344\263\3333\347\213\ny\223"
+	.ascii	"\322\003\362\211=\327*7]\035\b.W\315\367M\330\025v\205\273\005"
+	.ascii	"\376\342\220\366\323\335\rTXC`\230(\347\347\322\365^\326\264"
+	.ascii	"i\324\236V\302\330\335\030_\306\201\003\250\341X\207hDDDR\320"
+	.ascii	"\202\024\032\003A\205L1\306 z\022\240\3630F#\245SFFF\202\021"
+	.ascii	"IA\222:\331\032\003\362\022v\034\340gS\336\340\356\227\371\177"
+	.ascii	"\316\002\374\237V\352IX@\\\244\216\347\271\223\232\001\016E\\"
+	.ascii	"e\364A\365Is\322\026\331c\232\030\275\2501\240\231h\221\247\214"
+	.ascii	"\0324\031U\3236\344\226\332\234\217\024\272\324\340\337\034v"
+	.ascii	"\"\377~\372\345\206\2018\272eK\272\262\234\221\224v\321\217\f"
+	.ascii	"=nt\220Y[\234\262\2743\020\225-\3044\362\t0K'y\244r\377!)\315"
+	.ascii	"\r\024\225\256\252o\t\341m\277\203\370\214\357#e\033m\236\236"
+	.ascii	",wN\033^;\264\257\201\347mGn\023\022\220\302\371\202lJ\001'\350"
+	.ascii	"\331\302I5\255\377\001\327\235\254\263P\224G/\371\306\247\214"
+	.ascii	"\f\362\222Kis4\273}2\314\3441\"\244\275\fo\244\336\207\233\302"
+	.ascii	"\237\372,t\365p{\2175\254\330L\037upf\341\235 \350\304\223N\""
+	.ascii	"\222N\3257\265\037:\2100\274\232\340\353\254\326I\372fKQb\355"
+	.ascii	"#\035\034_\246,\262\272t\231\262\321\034I\264\252x\370\037\343"
+	.ascii	"\227g\220\311;A\306\207 \346\265:`\222\300F\374\346\351:E\360"
+	.ascii	"\"+Bt\322\375P<Q\265\026\363\205&\001e\205[\245\032\373\f>\360"
+	.ascii	"\205\373\217e`e\320\252\177\247\261.\310\356\035\300o[G\003\004"
+	.ascii	"w\304m2\305\300`v[0\253\261_\016\"Lp\220\234\"?\244\307\250^"
+	.ascii	"B\304\337\343\260\273\363\354Q\322\033\036\205\313\261\335\001"
+	.ascii	"\377\317\021C\270\334\344'\243G.\252\364\365&G\224\343L\333\336"
+	.ascii	"T\221 B\223U\232\036\276jIV\314q\025\226\365\204u\312Z\016\366"
+	.ascii	"\375\376v\230hL\351QV\220\016\004:\016\\\234\207\324P\333$\340"
+	.ascii	"\342z+\315\"j;\333XH\217\006\222\022\007\257\224Rz\301L\035\025"
+	.ascii	"x\356\304\227\251\001\376F}t!\3052\323A\253\260\250\340\231\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"m\007"
+	.ascii	"\"\213$*\2207\351\327\367}9\352\351~w\227\037B\005\346\373\377"
+	.ascii	"\207\357NB\341\343\243\265md\023\265\266\227\254\255m#\233l\271"
+	.ascii	"S\222\001\370\3747\360\374G\340\tp\314\357\324\266\t0\221D\f"
+	.ascii	"y\236\303\232\027RZHq\361\340N\t\233R\261}f\272\312\270\264~"
+	.ascii	",\243}\307\362\323)_\031[c\330\324\325x\214E\215\252U4\277\211"
+	.ascii	"\"\034\337Y\032\277aNq\276[\331\374\3463\255\0256\224A\341\301"
+	.ascii	"!BtB\024!\024\030\370\3516_\265H\200]\b* \220\202*\263\016\226"
+	.ascii	"\241'\031\214\364b'\356`\r\321 \2271\004\343J\006\203\345>L\001"
+	.ascii	"\3053\005\2076\374\322p\256\322+\254\326y\316\366[t\001\037\007"
+	.ascii	"c\020\372\035\265\026\024\234@\006o\256\356\320v\340\242\242"
+	.ascii	"\212\341e\260\360L0\203\026\305t\033w\210q\2129\004"
+	.text
+	.section	.gnu.lto_.pureconst.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375 e\315\002"
+	.string	"RF\025 pk\322\001\374\337\235\365P\355\377\337UUU\325\016$\322\377\377\377\377\377\337\314\314\254\2455\273\003s2%3\362A\356\343:n\3432\356\342*n\342\"\266\034>\303W\370\bs0\0053p\001\267\372\250o\232\322\214&4\237\371t^\315\213\371b\0243\253\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`c\001\025\006"
+	.string	"\242\007\027\036\2405\351\377\207\370\256\306\252\336\377\243U\021\200q\361f\326\376\267m\337\262\376w\250])SlJ\334%\25004\314bJ\201\220\214\\\213\374z\335\377\254\203/\242a\216\271\370R^\315\241\340_E\304"
+	.string	"\037Fs\245\236wk\255\200\225\3423\347G\271R&\210\306\316M\263'\367\020/ \360\202\021\261\252\003>\"\200F\030\336\0343\232\245\005\275\213\030\235O\306\322\242\350\303\243\f\021\262\306-[f`*\270\013CN\024\260\206"
+	.ascii	"LO\346h\307\031\327-\3103\243\033\361\242\264o\327\240r\240\266"
+	.ascii	"\226\3428#\bS\004R\330\213KuK\232>\336\301\0361o\025\272\231"
+	.ascii	"\306\r #\301E\031\002"
+	.text
+	.section	.gnu.lto_.lto.95ae23817bf42876,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.5.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\025\f"
+	.string	"6\327RA\020q\224\016; \034-\264\364Rb-4\245\337\347\260\333\213T<lX\020)8vI{\020(\374\364\307\336^\267H%w\273\250"
+	.string	""
+	.string	"(\267I\021`\266\214\345%\326+jm\315\222\275\267\224)\005A"
+	.string	"?"
+	.string	"A"
+	.string	"\027.\030fx\240\250\261\2731s\f\374s\037"
+	.string	"\377\324C\226iv\247\231\371"
+	.string	"4\323]%\344\352\016\210\270\b\t\240\235\034&\006\207\223\247\236 \032G\246\245`w\235\037\232\206\373\335\366\002\333\321\276\203\252\351\324\364-\002H\b\274\330\315\260\262\2610\336\n\021\337~;\363S\276\330\336*\270M\301\200\304\t\312\356n\376\274\251\374\345QV\331\262\333b\204\212\335E`\003\225?\333~\211\233\310lU\203jz\202\017)(\272\275\004S\037\2340\341\310\024g^\202\327\324w\210\234re\250\327GB\303\343\306S\250O]\303BF\207\211\205\\\331\233)\265C\t\210\222\020\326\021\353\333\r\217\372\337\323\356\250;#\320\207\344H\267\207#\2120\352\\\021\204]\027\346\211\240O\347\212\236\220(r\n\030\223"
+	.string	"!\024G\030\026\212\227\275\216X\233\ri\225\355\3248;M=9\227OUAl\230O\355\t\024\340?,u\001\024"
+	.string	"f\020\302\251\031\235\270\202\027>h\250:\354U\251\215&\354\2350\333\213\261w\246\r\256qB\304\2161\016\322\214="
+	.ascii	"1Q\341\n\240\362\264\264G\003S{"
+	.text
+	.section	.gnu.lto_cos_approx.6.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`=\001\305\r"
+	.string	"\346\232]C\020\217(\035\250\001\323\253T\360\037j\254\375Y\2317\"\264\344`AVBv\030\002\023\227\370\233]\375\227h\232\363p\331\226\263\247\002\266\001\020\240*,"
+	.string	"\300!\200\030\322\t\2720\220\326}B\310\336R\246\024K"
+	.string	"I"
+	.string	"J"
+	.ascii	"\366=\374\003g\253\022H\310\220\274\224R/vW\333\270\306\365\b"
+	.ascii	"\017\340zT\r\347\01659\377)\207'\013!L\236\310a\311\025\0220"
+	.ascii	"I"
+	.string	"Q\222\341\211\240F\013\006\227\247\236#\336(\023;\260\273N\223G\341\216\267\255\300\266f\377\024(\177>}\214\201\n\001Z\273\023Z1\226\025Mp\370\367\333\367Y\376\371\251\025.t\224U\345;\355n\310_q\346\321\241\253D\200+\002A\007\027\026\273\313\361h\216\354\234\235\311\243Xe\314.\212\023\211\335-\340\001\331\243\035%Z\264\\P\324A\256K\031\260\254F\t\303\033\007\271\242^P\243F\020+J/]\266|\205\372\3245'T\220V\235\352#J.X\353\034\355v\232\324\353I&\242l\331(Qj\006\373p\365${\032\203\351\013\246\343\277\033>\240\316G\b\f\2717\035\037\007 \017\216\326\3318\234m\243u><8\332\306\363\321:\004x{\320\300\243\201\266\315\243e\272\303\325\023\033*\266`\303*\255\262\235\232LGlg\372\224\237\204\344\261:\025A,\257\376\367\201p\335\204)T\221\f\030"
+	.string	"i\b\361\3350\026,\270\303\354MT[ \325F"
+	.string	"0+0\277\242!T\354J]\346\032~\262\201\323c\027\2720\f\\\302\252\351[\342D\202X\306\004\021\025n"
+	.ascii	"*\217U\215N\321\324\036"
+	.text
+	.section	.gnu.lto_atan2_approx.7.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\254\004\375\033"
+	.string	"\346\361\255I\240\330M:\300W\235>\360xE\003s\212\332s)V\244\211\214\265\263O\246\005\345B\310<\247\306{\220(\377\347\0244\241\352\333"
+	.string	"\237\002\354\361\024^\345\325\326\342\245\231\323;@l\300d<~P\263\267F,!d\313\235R\233"
+	.string	"\207"
+	.string	"\235"
+	.string	"7\0228\371w\203\353U\025\023tS1\016\0344\202\036\215\003\237\227\341\237\307Z{\274\270QkE`\003\255\203\266}\030\217\361c\377hOI\305\211\200\020\362e\325Zk7\227\205\007\351c\302\203\233\342?w\215-1\004\351\316\037_|@]\030\005\361\220\003\272K\367Q7\200\027\242\304l\r8!\242\350\"- \004\205\222\017\tQDi\273\037#\204fH\342 \371\312u\230\324\225\033\361\215\345p\364\246\326z\251\317\241\334mN\361A\255\325\323CN\304\375\272m\236\355\0066m\0210+\333O\035\302N\207EJ\271\315\3221+\2634\037/\013\263\nt<\310\254\240Y\332=\240\271I\366i]$\333\206V3\243\371\364\314\247ew\272e.\343\2179\324\r\363\336\377\342\322\022{\324\r\3734\313\247_\237v}z\374t\353\323\342\247\303O\203\237\246\237\336O\317O?"
+	.ascii	"\314\311\316\004\212\242\305\352U\020e\225z\005\346`q\247\037"
+	.ascii	"\352\217\372\332\267?e\277\246\375\343?\335w)\277\242\214\026"
+	.ascii	"@\371w\243\024U\023\367Z\226m\260\304\265\257e`\005\207\356"
+	.string	"h\\\327\326|\344\016\311J\221qq\250H\236R\223#W;p\342\266\366V\341\212+\300\212\344\225e\216\202\033.\200(t\301\005\340#y$\254\234\250Uv\351\326\370\310\035l\347\356\316\250H\336\327\277\357\252\262\256\256\314\005\255\310\245\333\3576p6\216\252\035\224e\026\256\326 \002\260\375^\247+I\336\215\312vfi\366R\207\241\"\253n\263\234\331\317\370\334\371H(\267Y~\326Z\201v\223\374\263=\t\310\266\210\250\351\t\tnR\261\314\006=\026x6\202\204\036\n9t\3039\334:8=\027|rvj\031l;;6\235Z\006\f9;5\035\236\236\032\016\3156\r\026xj>6\033O\355\325\253\247u\221V\2146k\332jY\027\227\215\221S\256\202\366\346jY\233\265\321A>\t\032\245>.5\355D\332\232\206\261m\211\331\031Q\222V\214\3226\202\321\217\\:\216(B\216\304M\362\2154}"
+	.string	"k\266\002\323\025:\333\330\016\275\354\214\b+\234\315\020\222rU\263>FR\344\022\270I\336\300\304d^\211\t\310\322,l\207l\317\210\210<\375`\331\326\316\3665\310a\250a<\244\020S\210\321\004\"\222\302\202$\035\300\002\221)c\035\020H\206\2144\311p"
+	.ascii	"Bo\b\013L\340\312j*z`\264\371\024\003j\020\333\345\327T&\273"
+	.ascii	"\030\b\251\035\202\372&\006\314n/\262)\037\333\230\215\275\005"
+	.ascii	"\027\356?\226l\036\272E\3221l\370,F\22283\005\f+\001!kfp@\177"
+	.ascii	"\025\2047\201\024\311\027\034l{\223\320\275V\324H>n\231\332\032"
+	.ascii	"\314\210\203\251n\317\315YqO\277T\033\021\005V\266\311\321\214"
+	.ascii	"\006%A\242\310A\331\001[\240T\242\276|\023:\n\236\2338\270\314"
+	.ascii	"[\r\031b\256\200\207\302\213)<\256\001\367R(46\025\2231d\233"
+	.ascii	"r\007\205~\337S5\016\353\355\321?"
+	.text
+	.section	.gnu.lto_acos_approx.8.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\374\001u\021"
+	.string	"\366 tG\340\322&\035\220"
+	.string	"\002\n4\333_\310\025$\017\374\346\306\236\207\022Y\272\030=\347\304-\310\343o\337\\\205L\350\367\257\027i\306\264\205\212\31109\306\030\215\326\211aF\334(\037\013&x\024Y\332\3106B\b\331R\246\024]"
+	.string	"X"
+	.string	"f"
+	.string	"\317\3649\026=\232\263\306\212\030s\316\006f\300=\263\355\343\234E\312\026%\254\204\211\007\275\210\331\031\232sz#/\240=\223'\240=[\022O]\256\246|\325\345_\255Q\2065\363\225\013\200F\354"
+	.ascii	"\300\002\245\210\253g\346\261\353\212\365\251n'sN\253\f\313\303"
+	.ascii	"\235\335v\004\333\017lu\t\243\rS\351\332\330\227sk@\016\273K"
+	.ascii	"\327\271\273\347\374\244\253GWsWoWkWgW\313\253\367j\275\372\001"
+	.ascii	"6\024@\tn\314\311a,\232?\331\214\023\207\375:W;\345\267x\314"
+	.ascii	"\235\216\305\021P\300\\}0^\016`\0269U\007\003a\020O\2179g\311"
+	.ascii	"3\227p\001>.B\035\333r\253\371\204.m\267\335v\302\033\033!D\024"
+	.ascii	"\201\331j\033\362#|u+7\333\0038\302\233\017\253\f?D\340\256\\"
+	.ascii	"\0044B\327'\036\204\n\r\020\306Q\250\246\333]\005<\341\215\324"
+	.ascii	"\257}\001\203v\031\335\021pU\356\326\342\255\340\2340$_\t-\036"
+	.ascii	"\341\353\323\321\244\355\366\261\313\024\255\034\341\020\214"
+	.ascii	"\006(/\332R\301\205E\005\245\275\334)&,\023ZPL\336\312\311d:"
+	.ascii	"\245x+\024PL^\n\212\3053\021\361\311\202\n\312k9\235P^\007\233"
+	.ascii	"\227sk|\032\034\227\226\006,\310\216ve{\264>\201\331O\2266F\350"
+	.ascii	"G\202\354_\2551|}\227\341\003\210f\327\306\242m%!m\310\006\234"
+	.ascii	"X\017\250D\346V\267\264\017' \200\202\221\200Q=\355\b}(qZmX'"
+	.ascii	"{i5\246\266\306\nwm\025\247c\223\013m\304i\347U\366\313\251\203"
+	.ascii	"\233\207\206'\370u@eb\261q;j\2535\244\357\340mF\303\001\357\325"
+	.ascii	"\236\217\234e\206\r\351}\276_\2218s\002\003FjB\270\002\310gR"
+	.ascii	".\317u\366"
+	.text
+	.section	.gnu.lto_gcd.9.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"-\013"
+	.string	"\246UK:0/T:\2041\266\204\201&\032\232\256\002\257\020H\3237\242\375\233&\203\fG\325g\306\3322\204\334w\020@\262\253\256\241\240\202\244\255\315\220\230\362ni\013\244!B\366\2262\2459"
+	.string	"="
+	.string	"6"
+	.string	"\177T\217\272\301\267\346\366\b57\377\337\241\007\f)<\035,<j\016\241\004u*\001\340:\320\352\200H\377\236\037\216\223\372xZ\223\335uz\270\nwu\333\013l+\260\237 \336\235O\337\262N\254(\320b\027\224z\261*b\211\203\355\315v\330\036\t\362|g\223\033\273\031.\224\330]\210\0170\036\377\341 6\333\004\275\021w\r(&\214p\261\273\227\201\013\250\036a\033\250\"\377{\200\370JS?\377\3168\205\350b\252aFU\375 x\352"
+	.string	"\n)\021,8\211\262=\315\341\356\256\252\310O\311\bu\262\206\354{\177\365\356\217\357n}\230\226Y\030D\fB\246\256D0\r2\024\354\3124\f\323*W\346\200\202]\225\013\346\212\020\260\366\300r\2712\232v\271\034\336^C\266SU\257\377\336\220P\332dJI\230\350pQE\352I\004\r\025"
+	.string	"i\004.0\307v\032\177 \251"
+	.ascii	"\003X\370\320\032k\237\236\r\320\004\265\004>M(`\016d\006F\004"
+	.ascii	"\0250\240\222\371)\373p\224\254\272\251\246j\264\253\344\001"
+	.text
+	.section	.gnu.lto_powerf.10.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`t\001\265\016"
+	.string	"\366\233bC"
+	.string	"\217*\035\240_\210dB\2303gZL\0265\361\2377\bN&\002\317=wC\251%f\235\361\004j\301e\2251\367\252J<Zzw.\375\377\277\270\354864k\231k\023\3145\030=\362\367\226;\245N"
+	.string	"N"
+	.string	"L"
+	.string	"\273\031\270\200\313e|\200\313\245r\260\366}\337\354\321\273#\024]F\205\"\237\365X\222B9u\243\313\250\225>:"
+	.string	"\350JQC\0263\271\353\020\325\221`\374\020r\275\353\bR\257S\027r\250=\330]\303S\207\341\276\3346\005\333\016\354\207\b\036\336\372W\207\366\355\237\360]-\237\314\021\310|\261X\032\314\313\333\"\237e\214\355\225as\0042\300\264\362\"\266\273\t.\315"
+	.ascii	"z>\321\240\312\034^e\2303vU\220\244\330\335\005>0/?\342$D6,z"
+	.ascii	"#$_q\321\321b\331\r\n\3653V\312\005({\334\335\215Vp\250S\345"
+	.ascii	"\nS\006\022\374\254z\325\364\256\313\224\324\313\004\202\004"
+	.ascii	"?\325\027J\251S\025\261\275\021\324\030\221\305\254\033\354\251"
+	.ascii	"\311{\177\274\352\327\267n\370\325\375\2149kAQ \306\356\307\327"
+	.ascii	"\262*\322$!\017\007\267\221\241\t\034 \316\347\262Q\201\243\034"
+	.ascii	"\220\006B\364&\003\212\020\322t6\017\327\351p\233\315#A\323\331"
+	.ascii	"6\037\320\226!`n\203\363\331B\034\367\3310\336>\306\253\224\367"
+	.ascii	"\350\200\241bAIRE\214\021\241S\225\005D\335uL\211\t\017\326g"
+	.ascii	"\213\0223\210\262\355\030  \200\002!\333\016\033\201z\354\025"
+	.ascii	"{D-\344-\016H\223\237\361\201\231\325\266X\321\254=\330\322\355"
+	.ascii	"\026rLq0\330]\203\355t\255d%LB\340\020\254A\300\303\202\241\001"
+	.ascii	"\345%C\226\220,\362\302b\037\357K\244s\321'"
+	.text
+	.section	.gnu.lto_applyDeadband.11.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\031\001%\r"
+	.string	"\006\031YA \215(\035\254\022_\226\215\242\207\223\272N@]\241\261\033Be\316dJ\351\310\201\034d\302\354\217\276\206\217t\n\360K\236i\301\334\222"
+	.string	"\001,\234\022 \006O\024\b\026\214\220\241HI\333{K\231RE"
+	.string	"C"
+	.string	"G"
+	.string	"\273\327\200c\300?\367"
+	.ascii	"\360O1\034t\370\234&\310\0179<\371\273\320N\356\\\306\210#"
+	.string	"\240*\271d4Q\2523@j1\001\240\205\034\206\252\344r\225g\2116\312\304l\354\256\223D\243pcn\033\263\215\300\276GN\277o\277sZ\217\372\323\351[\027\025T\002R\354N\210*\266\304\023q\262\277bgn\203\330\031{[]\231G}\330b\367\002\210\020\273\242\003.`\375\331\3667\234\003\210An\313\240\301\322\212\b\035^6\241\214I\342a\304\364\324\224\n\365#\r\241\214\377\207\323\210\225\373\200\251\nLN,$D\271\312\024\n\025\212\252\311N\345\226\t\226\026Q\256\234\252\372\225' Y\210\243\027\221\214\366\026\222j\262\2571\306hM\261\235\206\001\033\017\266`\203q6\026\307\303\001\006\341Y\243\301\301\240\003\353\\\236\254\323\3114\227\247\001\326\2714\037\216K#\303\331\003\316\347\352\310\262\317\225\331\366\232\342tP\363D\n\365\236\005JJB\372 x-\2617D4d\267\273\013\237~D\n\031"
+	.ascii	"|\bX\325Q\024\026_d\242\200P@\235\2373\001n\017V\r\025\2000\221"
+	.ascii	"\250\336\341\214]eZ\247\256\201\244\020\026\230\003\203\201\021"
+	.ascii	"@\005,~\346\223\223]\200\313Uu{\253\235P"
+	.text
+	.section	.gnu.lto_fapplyDeadband.12.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\025\001%\r"
+	.string	"\326XYB\020\257&\035`\225 \372S\226\325jF\3349\350?D\306:"
+	.string	"\355l\360\354\"wr\220\370\377\335_G\345o\214\230\206\023k\354v[)\002"
+	.string	""
+	.string	"*\200P\244>=&\252E)\264\037\326\356\275\245L)F"
+	.string	"D"
+	.string	"F"
+	.string	"\273U\200o\300?w"
+	.string	"\360O-|t\370\234\346\310\0279D\371\313\310P\356\034\007\211\033\200R\241\351d\245Tg\3404s\242\221\221\334\006J\205\346.O\223\314\224\271\361\330]gIV\341\336\334\266e\033\201}\007\001v\246a\246\337\267\337\275\345\327Lg\246\317\311\340\200\"\020w)\304\027\233\342\225`\261=\262;\366\306\242z\276%\2021vM\204\030\261[:\340\002\234?\333~\207{\030\3311n\273\220\341*&H\370P\263\001\031\263\004\004\211\366TS\205z\223\006R\306\037\206\345D\312\251\346\030\333)@5\301I\213\027\024\245L%\t\027\250\024U\315N\257\037/3\245LY\365z\227\273\r\030`L5#\031\355M$U\263\2571\306h]\t\237\220\365\361\261@\037\016\350\001\003\013\302\263\247\003DA\210uU!\354\2720O\025Z`]\225G\004Rup\030k"
+	.string	"\022U!\030&\252:\333^W\234\016j\256\220\021\361\036F\212\314)SM\324\036#J\262\333\335\205Oo:\221\002\030"
+	.ascii	"\177\b\030\326Q\033\013:\214\034Y0\003l\001u~\316\020\270\275"
+	.ascii	"Q\353(J\026\324;\267\214u\355\032\3704\241\20090\030\030\001"
+	.ascii	"T@\343g>9\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_devClear.13.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\265\007"
+	.string	"R\31766`o\032\003T\276\021"
+	.string	"\207+Z"
+	.string	"\315\307\233\276\220\233\t\322\016E8\326\206\220\325\377\367\266\213{\354!w\0254&&x\305\316\003c\001\207@\336c\313-eJ\001\025\234\210\330L\343\221\370l\264\331\3314m\313fgb\243\315\214\363L\315A7\n\0167?\333\306\315\314w[\217^!R*Q\314\350\202[\013\2374\205\375w\250M.0\006J \2265\350\262\214-\250\325\213\b\306\264_\bF\217\326\326\3777z\255M6\264\004P,\n)\377F\f\314Ur%$\323\326\260\365\210I:\233@&\370=\021\225\377kh\002f\331\317\006\227%\346\202\313\262]\353\342\257t\237:4N\253\3773~\2703\354j\2278`D\n\031\002<\374/\034\2218\334\350\266\bm\031\332\242\004\t"
+	.ascii	"3C+\0258\b7d\002+\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_devPush.14.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\302\002e\022"
+	.string	"\006\241rF\360\320&\035X2\356}\036\267\375\376\353\277\347\020\373\253\273g\257\345\227\177\232\237R:vi.R\373\303\207n\250\244\241A\347\266\r\177\002\315\254\204\334\300rD)\222\321~\260\313\204T\255R\304\022B\310\336R\246\024]"
+	.string	"P"
+	.string	"f"
+	.string	"$~\223:l\345\001vahvvc!F\300=:v\017\355\221\273"
+	.string	"\355\321){\306c2{\331\314\005\331\321\356~\n\342\251G\250\231\362\237\363\256\345byt9$\271\\\256\360\343\005\304\241\344j\201\036C\037d<\347\211\301\265\312\334\022\354\256\263\345\332pk\267\275\300\266\210\255#\001\271\303\216\261\244\306\330\207\273\273V\030\3738\277\351\260\277\224i/\323\244Lw\231\3462\275eZ\313t\3144\314\264j:5\375\001\236\206\241\217\242\335\f;r\254P\354\241\261}\317v\306^\"u\034\317\334\355\256\320\331\331\335\020\207p\217\006\340\323~:X4TM\n5\312X#x<S\335^\202n\300\222\247\306\220\0078;`\243\236\"\366"
+	.string	"\035\035I8\212R\022\231\324N\271\216g\005\272\032 \233\016\027\321z\t\251\306\030\344\251\036791Z\022\207SO"
+	.string	"\220y\313\b\344\327\324\023\261^+O\270\t\373p\273;\342\313\032T\340fV\264\307\253\252~l`\252\026N\301\304\201\272D$\345\201\n\311\351;A\235N\250\222\357\004\002\311\351+AI\371D\b\030\025\301\004\345SA\241P>/\266\207\2530V\340\022R\351*z\352\302F\313H\305\202A\210\242\226\221\247\366\351?$\345\324\353\024*\251fe\322N7\030>\234n//l`\233\nMU7\205A\254WT\250\232\236\325\"5\252\0267 \220\002\221\271:\017cB\377H\f\261\035\252H\366.\2551\323\312Pj\242\226\2107\270+\277\3362\273\272\256j"
+	.string	"\206+\255\206\240\303\272"
+	.ascii	"\311\316\256\213\300rz\035\232O\267\234E.\020\275\216{\336H\252"
+	.ascii	"\240s\255\b\n\342k\211\221\337C\202\321\306m\337\242D\357\225"
+	.ascii	"8\210\372@H9\216\347\3304\277\3116@v\251\220\r\232?\342\310\350"
+	.ascii	"\214\321\025ip\312\340\345n\223ou5Z\270\007"
+	.text
+	.section	.gnu.lto_devVariance.15.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\035\f"
+	.string	"\006\230S? Q\224\016\f\301\260]\022\320\376\300\370\240\325\030n\004\232\205\251\326\314\034M\231\323 <\372\240\374\026\333v\267UO2\322\246\013\t"
+	.string	"\025\f\020\020\251N\342\206\331\031N4\r\362\311\336R\246\024D"
+	.string	"="
+	.string	"A"
+	.ascii	"\251\267 QAD\215\335\305"
+	.string	"(/`=\302\017\260\036U\303\267C\315\315?\215\224\013R\007:\004\320\231\256prBa\n\320\211 \202U\006\030\007\361,u\\f\204\301\356:I\335\205;\336v\003\333\025\373\021\002\336\037\321t\3244\314\264j:3}\016\t\206Ue\305\256\205\357\306\262\210&:\330\336l\211\355\247\375\217\177\330\356}.`\027\345Qb\327S\340\004\327\243\275\313\266\357\341\036\233\255\202\336\206\237-j\315\030\2358w>\302\252\324\003O\016\244\323J\265\303\225_5\006\210\nQ\332\260-\341!\034r\355\356\002\037dC\341J=\372\037\353\361J\340\305G(?\333\003\245v\330\207\253([\323\327\003\0232\016\324\030K\347\201\347\222a\032-\3134\f\246\201p\3110\f\247\203Y&\3266\031\016\346\3214\016&\361\366\212r\246U\266\323@\324\222\355\250\224\220r\020BM\2754\222bt\202\313\317\252Pc\310HF(\003\023"
+	.ascii	"\022\0230\245\346+\032>d\305\346\3420\021\006\325\260\240\020"
+	.ascii	"\334A\013$,\037_7i\026s!'\250\031\354\310\330\203v#)\2011\357"
+	.ascii	"\324h\025\024"
+	.text
+	.section	.gnu.lto_devStandardDeviation.16.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`/\001\335\r"
+	.string	"F[_D"
+	.string	"\2216\03587\264C\350NGn\214\001!\25680\2408O\371N\310\322\005d'e\004\304Gx\223\347\217M\221\023\364\237Q\203F?\250\252\252\365\277\344Z\243\265y\230\270"
+	.string	"\306\215\326f\335\310\336R\246\024M"
+	.string	"G"
+	.string	"O"
+	.string	"\036\376\201\263\303\b^Hy\213PB\210\031s\316l\343\003\252\313x\001\325\345Z8\367\270\312\371gy\344\200!\364\276\222G\315w\362\215\033\222\212\023"
+	.string	"_(r\234*\240n\272\216\276N\325B0\347\264z\237\311-o;\201\355\016\373*\001%;\2523Q}E\265\265\352*\252eT\307U\357\301_5\330\206\223\307\313\234\024R5f\214<\241\342\273\3344\362\026o\013\n\033\261\261s6\246\366W\016\202;H\362"
+	.string	"s\226H\230\230\023\364\260\201\353\322\340e\333\017{\255\265B\224\242Zk%\214(\006\347\273\325V2D\244NS\016>\302\241\334\002/4\203G:\355\242\270\343\273\013\303\205EHi\370&\177\376b\230k\316y\300\027\021\341\201\237r\351\223\354M\3470q\321a\005\244)\033\354tQ\354\307\271\001\020@\024\254;\234\317\002\221\017-\013\3314m\353d!\f>\264\254\343\371d\234\215\267\006 \236Ld\333<\031f\333 \350[\262\356\205\241P\224P\207\266\225@fG\266\343n\200\266\263F3kk[u/\356Y\376\t#\r1\241-\211\326\312\027"
+	.ascii	"I\214\211\245\005\020\3312-t\357Y.\307\373a\325@t\262\204\342"
+	.ascii	"\307\343\271\232\260\\\303\313n\0026\025:h\230\026\342z\r]2A"
+	.ascii	"\202*\034\334\215\244\032\244)\251\306\245\240"
+	.text
+	.section	.gnu.lto_degreesToRadians.17.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"u\b"
+	.string	"\306\020<6Po\322\001\240\374.\212\352\\\277\370l~\022\355j\335\007\360[\325op\3037k\321\334lD\020\023\264\004\375\252\252\206\251\001\267\273\256=\030]L\265v\023)S\n,"
+	.string	"+"
+	.string	"*"
+	.string	")\022#1\273\0339\037\320\034Z\027\320\034j\306\273g\347_\344\326\t\007\314\t5zn\024v\327yBY\334z\333\006\266\021l\243\004[\361\311\254\n4\351\260\335\331\227\355L\373\252\207t\367 \fwS$%\273\333\361\001\300a@\332\366?\016\322\331+\313\323\3308KN\370\276\227\210]R\301U\365&\217R~N\275\336\344B\312\317\366F\251\030\366\255\325\013[\323z\357OM\037^\252\225N\313\006\241,\343\030\262\205\2151O\250A\364\321\"h\323\264\r\213 \207\217\0261.\024=\004\336\0362.\212\266\215\213\227\267\267U9$-\331\253S\314L\2446\n"
+	.ascii	"2\003\302\260R\b0\254.qM$\310\202p`\202\200\023O\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_scaleRange.18.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\357\001%\020"
+	.string	"f\036jF\360\260(\035\352^\222\365\317\316\371\275\277<\326'u\2141\257q\3403\rq\347\f\256\367\276>\360O\321!\021G\355\b\022\205n\233\003\013\026R\236Y'\301y\211\f\270\037\241\177\250\217\002\300\377F\b![\312\224\002W"
+	.string	"T"
+	.string	"R"
+	.ascii	"\241]\361P\001ALN\001\230\032\002\241K\311\363/\246\261g\267"
+	.ascii	"\203\210\026\273;\300\002\272k\266}\227\237X\33141\f\341z\213"
+	.string	"\214V\314\306\356z$\027\331\256\305\217\266k\n\342\253\347\312\377\314c\315\013\207\305\205\362\344\016\354\256\223\305\205\341\326\333\016`\233\201\235\023\002\232\376h\332\223\351.\323\\\246\267Lk\231\216\231\326Lg\246/\362\f%Pl \261\330\265\260scch.F\\\366\317\236\366\312_\361\031\203f\266\211\253!\264+\261\031\260\005)\256bu\231m\276\254\013\236V,\247\306\356\226\\\263\202\260\373h\2231M\f/\030\233\252\206\364:,\022\232F\335t\344\006D5\035\321\371\320\250\\\352U5\322`\301Tr\307\036\232\032qt\350\265\301\353E+GJ\356\330!Jj\213\375\270\273k\375\340\321e\267\3500\177\310gw\350\341\017\362\227\377\3431\277\307e\376\016M\203\002\246;\370W\332T)\223\007\335W:\201)\r\365\201\tN`\212\243p\237H)\b*\023\312;\371P\250\357\344\235D0\241\274\023\230\362H"
+	.ascii	"\374I0\001=\325\367\201\036(\334\333#%IQ\025\203t\364Q\217\202"
+	.ascii	"\364,\016\037}\247\036\315\033\221\206\264S\003/\034\226\tNE"
+	.ascii	"\260\020\345\264\024* \340\2421\013\036\024\202\025P\006\374"
+	.ascii	"\260,\201\256\2114\330p\337\200\3551\331q\f\341\rfaP\034x\322"
+	.ascii	"Q\276\241\365\231\001\037\213w\352\232\224\021\213\006\336d\363"
+	.ascii	"\n-\224\244\207\342K\004-\264\031\300\346\fG\262N\300\256d\234"
+	.ascii	"\304\016\311:\021o\220\305\0010\217\251=d"
+	.text
+	.section	.gnu.lto_scaleRangef.19.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`b\001M\r"
+	.string	"\366\330XB\020q\233\016K\225\205R\026\327\031\370\225S\330\367O\020bC%*\376\027}\363\020G\206\257hP|}o\244\276D\355\327\007M\365\035\352\336\273 D\251\302;\201\013\320\250\013\242)2\353F\233\310\235RD"
+	.string	"M"
+	.string	"?"
+	.ascii	"\227\335\225\023-v\367\200\rX\217\266}\024O\301\331\337\344\215"
+	.ascii	" q\022\313\006\224\226\335\225\231\013\240\036\247\007\240\036"
+	.ascii	"U\304\271C\316\377\350\323\312G%d\244sX-\330]\303\220\021\017"
+	.ascii	"\267\336v\001\333\020\354\313\b\207\206\207>\200\177`QQBS\332"
+	.ascii	"\345P\262\2611\242\213"
+	.string	"\317C\277\350\320\346|\026\037\371\022\371\313d\340X\021\r-\240\007!\177V\247\303\200\216T\203\306\356v<\332A\212\277\211cE<$\fNn$0\231\201\300\023u\034\276\304\237\003/.\212Q9\352@P\257\226\036Fg\242RJ\241F\224\250\223^#|Vt \017,\331^\007j\b\373\323\356\256\025\204\257\207n\314M\376\313E\267u\357\257^\362S?\371\343S\376\351\320\032\233K\370\364\2408\333\307\004kz`\332\026\263\2515\300\264\255\272pc\232\215\002g\223I\220\231e\023\223 \0256\231\304\264Mj\bxZ\370\320$gNM^\336\336\2764\203A=\216\252z)$u$\030\265TU\301G\245\013   #9j\003\034\202\r(\003\272a\367\302\212\303|\023\215\036\n\234\260\021\372\246.\032\031\321f\340\215'3\261a{\226b\363\332\346\016W\262N`G2'\260#\031'\2007\300\342"
+	.ascii	"\236\307\32422"
+	.text
+	.section	.gnu.lto_normalizeV.20.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`:\002\305\020"
+	.string	"6\340mD\360t\224\016\250\307)\035R1045\305\347\310\272\215\201\300\215\"\352u\316\314Xl\223\267>\273.z\r\036\2373\0170\333\224\375\265<\221\312\227\001\202\031q \230\017\366\b\342\2065\335\366\t!{K\231RW"
+	.string	"Q"
+	.string	"]"
+	.string	"\3603R\362\264\337\342.P\177Yy\200\335\327\214\231\335\257\304\t\266G\177'\220=n\027\220=\032e\373\370wb\017K\302\001Vdw95q\324\241&\312\327N8-W\352P\304\365\343Z\301\320\356\036\366\364\340Rej'\273\353l\271B\334\361\266!\330v`gK\366\341\356\256\365e\377\373\001<\346\006\375\345\377d\332\223\351N\2469\231\3362\255e:\313t\3144\314\264f:3\375\001\237\0248\270\330\356\207\330\221\265\2114-\217\371\355\037f\217\377\3420\250\307XfK\201(\300\272\351"
+	.ascii	"dw\025<\232\301\366\030\nj`D\013\f\217U\0321'7\265\273\f\331"
+	.ascii	"[ \r\2554eM\243n\372!\231f\252\251\206\344t\032\231>\200\232"
+	.ascii	"\032\025\346`\221Pe\314\252\252Pc\017\r\227\241\272`\307\365"
+	.ascii	"\232\2527X+T\336\360\030\226\331v\267\201\017c\202\312\206b%"
+	.ascii	"{\274F!0\026/,\031\263\277Tj\211)^\205\322\350B\346\235F\024"
+	.ascii	"\240\310tR\213LN)\036\n\211+u$R'\342J\026PH\234\310t\342L\016"
+	.ascii	"\270\30302q^\327\2318\317\267\207\253/GPa\303\242*\350Q\033\231"
+	.ascii	"z\324s!\322Q\032\325\216z.?X5\034\235\221\240\362\321\2215ZA"
+	.ascii	"@z\345\250\347r\303\252Q\345\356\246T\306v\"\330\002) \240\202"
+	.ascii	"\031\261\341\003\263\320\216\307\020j(\312\366\256h\\\263\262"
+	.ascii	"\332\266\r\332\0250K\313[\321\fb\316&B\222\024\260\251,\366\f"
+	.ascii	"LJ[\0341\341\220:AX\230pS\232w\304o\020\313T\\T\fA4\023\013v"
+	.ascii	"D6\257v\f.\212\0073\214\b\200(\340K\032\260x\271\355\352z"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.21.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\342\013\375/"
+	.string	":T\320\021D`\236J:303[\177<\230\367%gpB\026uf\270\326w\004S#\2259\204\370N\264N\342\205\357\347\241\021\255\fwI,\237i\243\360j\236\255\253\242\355\360\322\331\377\336\336\257\325\326\310&D\312$\003\023\001\347"
+	.string	"\n\001{{>28\037J\272\345\261\354\263,\221\n\231\004$hP\374\312\372\370P\276U\271\225\023\227\262Jov\224ti\232\236\330%\376\334E\261\247\262D\024\237\242\302L\365R3\310\336\027:9\032\204?\353\233\334\311\237<\312\022\241\270U\320+2!o\227\004\206i\272eI\025-\341\231\374\216\354x\273\024\276P+\3221\004n0M\323\247\237[%\374I\300d;\026FA\251\331]\232\361\274{\272+!{\235\213\013\245i\334\262J\232\332Em\223\360\347\332\235\250\376\024\036@\375\271d\273jn'\227\336I\333Y\0239i\232\032{\310\311^\374\361!\366\f\205h=\315f\262\375\243|\210\266\366\342E\345\177\340\004\225\354\363v\242\233\2307\356i\373\360a\324x\374\265\261\260"
+	.string	"\020\033lG\317\372^`N\215\215\253\216\2370\370\222l\342x\233N\312>\034\3055\244I\004&\b\232g9\247\255\2311\243Yi\232.\243\255\331\370\002}w\361\354n\207]b\212\335w\3139ue\234g\327\016\311-d\367f\332q\273\225w\253\362j\241\274Y(/\204c\371>\250\274X\225\327A\345\275By\255P\336\006\337\373VU^\252\312\313"
+	.string	"\345]\200\362*\270\227o\202\312;Uy\021T\336\003(\257\021\345\225\272\3377\252\362BU\336'\224\327\t\345m:\340\327@\345e\272\335/\340x_\245\347}\223\256\367E:\224\357\321\003\277F(o"
+	.string	"\224\267\250\362\022U\336\241\327\375"
+	.ascii	"*\257P\345\r\252\274@\225\267Xy\177*\257O\345%V\336\236\312;"
+	.ascii	"\254\274\302\312\213V\336Zy\317\312kV\336\256\274\\y\037\241"
+	.ascii	"\003\331\206\270\265\240]Z#\217\235\364\313y\305\310\261\374"
+	.ascii	"{\277\227\337\357\007\374\003\177\274?\357\327\373\241\274g\367"
+	.ascii	"\201{\301#\200{1a\300\020\361\333\377\311y\331\367u\341\022\027"
+	.ascii	"D}\301\037\342S[\317\007\017U\024\240\213\214:@\267Q_\320\207"
+	.ascii	"\251\367\200O}1\304\341S\233\360\203G\340\324\324N\006\272\211"
+	.string	"\251\r\364\305t3\365\301p\370\0349MD\251\244\256\207{\357w\240\3777D\237\332\352\007Oe\224jcTKqG\365\377\204S\275\367\302\240\337\207\236Om\346\007\357`\201\202^\220\240\025Lu\202~\337\321\234{\252\317\205\353n\332p?\312\371\r.N\251\244\256\276\367{WYf\247\331ZOm\274\313\245\255N[5\267z\2327h\253\252n\360\256\352\363\231E\306\352=\026\020!\352\321\264\332\354\027l\345\r\230\037\335B\326\356&jV{\270\3633c:K\340&*\204\316\352'\0374\204>\363\326\234\341\301\352\007\375,_\332\023L\372\225-\377\344\f\316\227t\331,M\313\226\336X}+\027\302C\002\346)\221\353\3653\273,\312\355\216\270\231/a\232\246\f\312\\8\016\220#\362s\357\242\376|c`^)L\261c\227\330\261K\230\002\314Kl\005\230\227\230\020\354\3505\3065v\f\023r\215\221"
+	.ascii	"\361\341\334.)1\021c\\_F\260\343\327\327\261\313\b\346\305\365"
+	.ascii	"e"
+	.string	"\354\n\0233J!\355\261\004\2100\343\330\361\030f$\226\335\3749\347\322\234-}>\370\241N\243\300\343KY#W\250\177\370\350\261\325T-\324-\350\376\202\032\356\315-\251\201:H\211\324@|E\036l;~Z\251\213m\216I\0369\352\237~\025\272\245O\016\0347\210\355\323}\207\330atN\222=\275\246Vc\330G\335sD\251\207y\222s\302\2461#\r\251\321\026\266\251%\251Lj\264O\227$\016\202N\262\214\030g_-\365\347\331\306o\016[\215b3Fr\331P\237]\273\357$\347\220g\207%\021L\232\315\351.\211\310\354.\324\363X\030\222K\323\264\n\303\361d\270#aC\221\f\213\372\223\357\240\261\241j\2506\273E\222\277\241V\352\253(\016\032\252\223\372\352n\250\221\332\252Nrn\253\241\372h\t\220\017)\2307\207,v\357\003\003\200\334\250Q@$\225R\246FD\244\240 I!\215\001"
+	.ascii	"\003\021\231\352\034\022`SE\n\203JAl*\243\240<\r\233\001\200"
+	.ascii	" \32690\020\306q;\2453<}\250\226\347\276\246M\036j\303\325\033"
+	.ascii	"\027t\260\240QIK/\217\213q\322&_.Biu\254\f\215\023#\204\022\310"
+	.ascii	"\325\221\257\321\2323\225ts\243\204\216\035\304\236N\371`\344"
+	.ascii	"9\221\360\256\272@\177\307\301\325b\363\025\017\332\033(@\033"
+	.ascii	"\3240\001\n+}m\022\371;P\0330\345\300\224X\364/\216\r\034\017"
+	.ascii	"\344\fJX\n\t\355\233\327\361\222\306Y\361J\335$(/eX\276\300C"
+	.ascii	"Nn\326\2007c\275\2049s\356\354k\"d\326e\035x\363\366\265\255"
+	.ascii	"\2447-ik\235;\373\002\b9\271\254\003o\376\372\ts\346\334\331"
+	.ascii	"\327D\310\254k\353h\300\315\337\255\007\341TF\315\211\031\244"
+	.ascii	"\241\200\215\343\021\350J\205\272\013\031\253$\354X<\356\301"
+	.ascii	"N\f\276\321MC\233\370f\375\350\020\372B\356\261v\220\233O\025"
+	.ascii	"\344\276\245!\021\307\260\013ic(\222D\234\025\330v5Z\027Q\350"
+	.ascii	"O\273\032\255\033R\"\340\363\257\273\034\007b\001\330A\244\322"
+	.ascii	"\353\317\036\001b[\\\243\277O` @\366\204\037\214D\007D\316\341"
+	.ascii	"\032\324\301\2049-F\341\216bC\314\243\\k\304h\317\001l@\005\005"
+	.ascii	"\002\325E\204\304M\360;n\002l\272\253\377\225pRC\035\332\212"
+	.ascii	"\021\310\024K\375\003"
+	.text
+	.section	.gnu.lto_applyRotation.22.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\251\005]\032"
+	.string	"\206m\236I\240\230Q:B\354\005\036\236Z\307\345\334\361\202\n\305\221d\250\013\037\306\211I\365\301\223&O\373$|\243\366\337C\370\327n\245\0326\371uRI\203\017\276\234\002\275\201\307\232\034\013]\252\237y\364\217\366_\366\311&\261r\247\024\203"
+	.string	"y"
+	.string	"\220"
+	.ascii	">\376\303\367!\227\256\265\b\276\240\241\242\376\352\215%\220"
+	.ascii	"\027k\251\307F\021\347\341\322\r.\372:\276\303w!\022\344OE\205"
+	.ascii	"\036B\242\324Zo.\372\201\022k\355\257l\317`\t\247\233O\373@\307"
+	.ascii	"\341{\220\201\034V\353\017\220Q\255A\005F@^t\360\262\361\"\371"
+	.ascii	"\330x\321>\373\351A`}\023 (\204\256\324Zm+\343\276O\237\377\034"
+	.ascii	"W"
+	.string	"\371\254\370}\322\t\265VO\237\025,\356\275m\002\2663\330\343\201v\36077\206\375T\335\037\373F\277\315\213~\002\037\372\007\334\350\256y\321]{\360\007\360\241\233\366\240\177F\247g\350\264\f\235\216\241\3232:\rC\247ct\372\205N\303\350\264\013\235~\321i\027\235n\321i\026\235^\321\351\026:\255\242\323$\235\246tz\244\323\"\235N\321\351\245\323\223N\277\300\013\b\t\204a\255)\206Y\252\222xT\2434\272\300#*\242@\206x\017\373\001d\353U|\246\320\025\227\\\232\260f\307\245K\023\265\344\362\302'\371\222\234;\001\2250\231w\322xq\334\013\233R;&\235pQ\333\335\324\316\226\224\\\236\b\250\340Gr\316\203\311\310\205\200\273'\232A\333\357\\\261\350\204\215\2369t\021\227\006\230l'8\221\234\002\300Z\253\003\334\207\200 \205P\310\t(1^\374\032h:\n\3422\002RM\210'\271d"
+	.string	"\243\206\344rEE\330\300?\262@\""
+	.ascii	"\023\215\213\276n\274H[Q\211\023T\220\2119\f\035lvr\032xF\016"
+	.ascii	"\033l\306\235\234\006\236\324\b\334\256w\273\240\243\303\365"
+	.ascii	"n=\335\316\305s\343,\340}\350\335r6\035].\247\303\261\351\340"
+	.ascii	"n9\033\316\216g[@\263n\307\303\316\326\323\351v\266U\260~\177"
+	.ascii	"\214\001\207\222\211\355\361\314\332\274\331#\263\262\235\211"
+	.ascii	"Y\231\245\211\232\277Y\20710\373\262\262\330\302\354l)*\013\226"
+	.ascii	"\030l_\240\256X\201A\271l\225\327\266\326\305\265\257\245\211"
+	.ascii	"\2422E\212\213\265-\333Z-kgKP\236\204+\325\266<q\322\244Z\025"
+	.ascii	"\322\323\rr\233\270\fh\250Q`e\024TRJ\2222\222\2441\300\002\221"
+	.ascii	"\031#;\021\360\244\"J!h\b\225Q\220\273\001\242$\016Bg\315?\021"
+	.ascii	"\030\002\004\326\364\351\324\214tpH\005\3273\354\205\226<\221"
+	.ascii	"{\200\207\305\322,tGl\335! \345\352z;\233%x\313\347\016\342p"
+	.ascii	"BE\255\275\303Kn\300\345\027\006~Y\250\021\n\325C`R2/\177})\206"
+	.ascii	"B\230uA\237\007ge\310;\tIo~\222\025[;z\245\323u\324PMu\203\235"
+	.ascii	"\020b\016\326\262[\0070\bs\371\373\205\245\026\346\007\326\255"
+	.ascii	"\364\036\203\221Y\312/\373~\222cfr\304;\307\007\344<\3178$\212"
+	.ascii	"\250!\371@\tM9!%\254`,\273\006\033\260-GP\200\374\241\233.\212"
+	.ascii	"E\005"
+	.text
+	.section	.gnu.lto_rotateV.23.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"E\n"
+	.string	"vSG=\020\0059\035"
+	.string	"\017>\241\247!\205\301b\034\353\024\370\365\017\240"
+	.string	"\245m\005\200\177?9\254\330\310\0325J0\322U^\360\013"
+	.string	"\264\006\020\303\b\034\203\276\361\f\344\331t8\212~\243\275S\n1"
+	.string	"6"
+	.string	"5"
+	.string	"\257&o\320y\325^\320yuh\327\234$\331\253\314x\224"
+	.string	"vw\243\255\207\237\241\377\362\001\343J\374\3644\354\256\347\270\002\271\351m\037\330\036\331\007\005\033\253.%\207\375v\350\227\376\370\257\243\204\207\2454Q\365\320\242\221\355\252B\257^\320^g\b\302$3dB\237\366M~\022\336\245q\202]\326J\313.\251\340\004-)\316\256\310H\366\2323{\346S^\242\264\221R\273\342b~\364d\201\211uP\321&\305IG\354svwMY\366\311\237\336\365\317\316\200M\f\303\313\356\307,@\030\246\017\344\034N\236\t\344@\357\023\340\300\211RD\265\270I\"\224\004\310u\333\311\353:\217\264\235L\\\267\221>\324&\002\331\243(}\033\350y\337\366!\367\234\245,C\334\3046(\207\003\020"
+	.ascii	"3C3\215\341\217\370\274\210\257nB\003\327@\237\211\022.\034\356"
+	.ascii	"1\2010P\r\\\001s\003T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.24.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\312\003\245\027"
+	.string	"\306i\216I\3200'\035Z \323\r\356C\313!~\204k\347<u:\024\237D\206/C\025\322N\006\216\373\254o8\277\210\255m\t\353\261z/\271\370B=\214RO\213F\351\201\210\311g}`\244\230-k\353Bj\215\020\262\267\224I\006{"
+	.string	"s"
+	.string	"y"
+	.string	"\237:\206\367\360\0173\245\311\321\002\356\323I\250\331\321\350n\230\353\254\357S\376\343\373\344\n\312\227\343U.\355\342J\025\202\337\224\2744=h\"; \255\270\341j\027}\276\362\351Y\225\310O\016\317C'\034\036\021!\234\235\005'\374\223\256\032\351\332\321\354\224\002\272;"
+	.ascii	".\202<\26068\231\225\032t\316?\272\\B\342\335p:_\320\244\273"
+	.ascii	"uo\270\234+\307U\325IUKT\031C\265}3\220*\310\307\277\245\253"
+	.ascii	"\254\363\256\342\\]\315U\325\\\r\347*8W\277\271:\347\252\334"
+	.ascii	"U\226\253+W\037\3421\304\202\301\214\356\233\236\215n\232J\031"
+	.ascii	"\316\373\215~\021\372#\025\365<ZX\303\tyP;\257\360S\252\316\364"
+	.ascii	";\025\225\350E\263\033\301\2045\234\005\272\233\250\356\036\371"
+	.ascii	"\324\221&\216]\325\203x\210\331\307\230wt\003%\235\350\036_j"
+	.ascii	" \f9\375x\262\203\"\0253;\365\372x\200\216\344;Z\310\337\235"
+	.ascii	"\300\222\t\016J\266\355M\316\251*\210A\030\274\355\310E\266\271"
+	.ascii	"T\221\213\231\235\272\354\356\226\234;\355\023\031\204"
+	.string	"%\023\r\005V\325\224\357h\005\236\272;\301d\272\305\320'A\240\205\027\3641|\233\036\333\366t\271\305\314\247\331 \257)\276\363\362i\204d\266\247\"\237\177\3649\204\304\253\271a\333\036sw\327\230s\252c*g\371\203+J\211K\312\313I\f\266\"\213\305d(\260\025\225\223\030\f\245\305\005V\022\2422\226\006-\260\027\231\254\005&\216\3757\003\261\330ec\031\205\221\335?\nn\364G\021\275X5TT1\f\022\377\220\002W\234\323\025\253\270\025\264\342\275A\242\362\220\372T\341\226\030\361\325\311\220!\3474d\220\001L\241\330+\323\367\031\362_\200\374\335;Z@18\371\274$\335\316\307\b\236\216\364\226\216\335\375q[\250qP\247\234\251\200DDR\220\202\244\325\200\002\231\252\253\007\021p\2714y3\354\006b\330D|[a\270PB\351\345\3434\312\213\352\226\364\211\222t\020\263\237j\001\267\370\022\205\275"
+	.string	"u\t\323\330\363\342\373\255\026`v\370\213|+=8\bY=\314\353\200#\033\206\334~\b\203@\327\246\311\200\241\213v\240\250\234u\363\254C\360z"
+	.ascii	"\210%\360\241\034\340\005}\232\020,g\316\t\312\220\037\300\f"
+	.ascii	"\214\237\220\361&\244~\001+\f\004\224\203/Z\251\247\201\333g"
+	.ascii	"\370\200C\204\354\024\274\004\303\302L\031\333@\325\327x\360"
+	.ascii	"\002I\300JXc<\323m\311H3\004 3\331T\r"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.25.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\252\006\025\037"
+	.string	"\3663\262H\260XQ:\360\270\357\021S}\2325\354\n\277h\232\330\331FO\355\206\326\232\177\223\240\271:\321&\332b\251\250W\033{0aa\376ll\254\375\240\262\361\360w\360\363n'\334F\306\027\267Y\373\337\376o\204\220M\244L)\243"
+	.string	"\215"
+	.string	"\234"
+	.string	"\322\274\3617.D\343\033\310\373\311\205\273\236\234\036\2259\247\215\345\001\302K\360\262\360r[X\036\344\335\240\336.\213\301^\256\026k\245J\241F1\224\340\352\315\027\031\2006\216\246\340r5\227\271x\314\005\220\302v\177\355~\324\245\342-\025=\312J\361U\n\024\252:\361\324\t\023\212*\300\"D\211\217JvJ\024\b\332\341Q\221\304\303V.\007d\351\341\250\004S\276\037I\255\234\007\020\001PP\214\033]ur7\n\306\030\361\275\321A!GI\270\334\210\253\310`\316i\305\345B\334"
+	.string	"n?\203\355\232-\237\002\272>\276\027N\250x}\354\331y\277\213\325-/\272eR\035\223j\230T\277\244\332%\325-\251fI\365J\252UR\235\222j\224T\217R-Ju(\325R\252AU/\250VP\375\227\330R\022\007\2779A\374\254L$R\t\306\213~\242\177\207od\225_t\033kv\306\"&;\332x9\3324~\317*\353\370\020\315\2116\2145;\rv?P\346\234\263K\317\306\313\257"
+	.ascii	"\240j\037\307s\320\234\307\341\2609}\220\200\314\311\243\331"
+	.ascii	"e|\227\343\336IM\334\367\016[\302d\305\325\355\213\220v<\341"
+	.ascii	"&h:\217\01780d\206P\270:\207+\227\302\320"
+	.string	"R\007}\242\205+`\367\362\336m\334\367n@\210\257\212\222\215\376\344\352\214\002\332\331\2128\235]\266:\362NCM:\350\323\3019\347\004W\367[(\333\331\202>\234\236\265\375\340\275[K\323\234S\201\364\341\242\370J\032n\343\013\237\303^\307\204\215\376\254\353\262\273\307\221\001\336E\302\257\356q\202n\364g\331~otI\343()\347\212\215\376v\201\202\210\370\260\253\263y5\001\023n\341\031n\230\332\005\t\030 \304\330*\310\304\304\310\300\330*L\200\020c\203\231\271`\253\021\260\214\205\b36\f2236\025o~}Z\226\305fo\274\001\234\223\305\202\023\375Pt\350\317-Dj\310`\233t\030\322\216'\026[\030S\fV\305\260\325-!]\205|\270(\257\327\272^.\027\213\251E\373\321j-\213I[4\326\262VG\363\261Z\235W\253Z\n+\232jH\r\253P\373\244\307eNb*\265\250\035"
+	.string	"TK\255^yA\305\234B\224\270G\232t\311\216g\\\365qt\335I\001\307\325y\\qYOF\300\333\027\006\200\233\250\221PF\221\220\214\210\024\024\244 i5\320\002\221\251\252\007\022`\204=\007\305\350HJZh\375\357\"D\207.X\371][\035\013\222\263c8\037l9\367\001\211\257\374\244\341\252GB\b\226\207\032\372\026\032\360@\202KH\032E\310\025\033IVj7\031\333g\225\242\237\226~\006\201[\354\336\306\031u\325\346w\241\bv\264\201XM\r\333q\355\206F\240\266\246\236}\t0\223\235\262\374\370\032 \264\365\022o+\023\032\223-t-u"
+	.string	"9\360\3429\273\005\3567\027\340o\310y\301\327\002G\251S\230\303N\325\322L\265\354Z\177\277\220\220\223i\b\270\243\234\326-~\344:U\252\003\"\227\f\214\t\274{\0359\005\323\264\320\364\242\363\225F\031\361\0071y1\202&jCV\2036B+\300\311\034\224\374\202\372\265\n\315|c)\352`\252Vh\310\301\256bS"
+	.string	"\372\341\242"
+	.ascii	"\271~\227d\334`\303P3\236\3604\316y\013\246X\024\334f\202X\231"
+	.ascii	"%\340:\2234\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.26.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\027\013\315("
+	.string	"\212@\270\rJ\260\224U:\370\236=O\021@c!\016jNe\302\3300/\030\235\203\317\br\210\300FS$\\\f\306p\212e\313\367\252H\206\305G\351Ni\377\t\242\326\3027\366\364jY\322O\304\006\264m\333\266m\333\266\222F6\2212\311\320"
+	.string	"\262"
+	.string	"\303"
+	.string	"\346\351\032\315\037\035\tg\211\244\021EPY4\3529R\251\265\016]\216+O\311\333\312\323>\261\253\223\306/\311\304\003[X~\276\036o\247\313\341n\266\032m&\213\301^\256\026\313\\\225\224l&\356W0d\f\034E|\202r\016LzK\322\ff\221\361\237\f$\366\035\275w\024\203yF\337\031\301`]\321sE,\030\267\342\267\025*\330\226\342\265\024DL+~VD\301\262\022\217\225 \301\260\021\177\215\020\301\256\020o\205"
+	.string	"\301,"
+	.string	"&8|\270\211\004\350\003"
+	.ascii	"\027@B\274\362\360\222t\351!]\216<LI\263\326\032\013\312@\032"
+	.ascii	"\340\237\240\035&[tx\277\351$\020')\237\240\016\347\025L\255"
+	.ascii	"u\331'\210\303\327\345\273\274`w\205\273,\r\0019\335\347\256"
+	.ascii	"1\207{\310\330C\27327\376\b"
+	.string	"\2267\346L_ \345m\241\274,\224\367Gy}\224\267Gyy\224wGyu\2247Gyq\224\367Fym\224\267Fyi\224wFye\2247Fya\224\367Ey]\224\267EyY\224\327\244\274+\312[R^JyI\346m\222\227I\336'\260\t\035Q\020\244\326\rUV\252\021\352\243\350L\377\322_c\337\264\256=\023\321\314\0012\231\226 \005\315\323\330.\316\376\270\256\245q%\234/Y0s\200d\212GQj\255/\247\373b\236\336\310\217y\3673\236\204s\343\205\323j\035\322\301\243Vcp\007\004Pz\252\325\r\345tFzZ\265\372\334V\263ZG$U\266\232\257\004Y\265\251\222\325\247\220\bG\231\214\343\306\2718\2054\373\\\263W\r\243\022\232}'\253\376\361\264\250%\275\242}&\035E\241\262\013\334\306ue\237[6m\032%(\fL\265P\337\247\362\264\354\\\221\300\217D\263\177|"
+	.string	" E\214|\350p\025\355sYD-\323+\037~9\260\177>\245\304\004\003S\235\254\265V\262\317\023K`\3134\371\304C\242w\027\346G\242"
+	.ascii	"%\265V\003\364\311G\312^H\005\242\251b\177\241\377\003B\207\253"
+	.ascii	"\226\033Aw\237\347\005\371\035R\276\271\317\343b\207\253\026"
+	.ascii	"\330\3577\235\302p\222\352\271\242\303U\335\306Z\003\017\036"
+	.ascii	"\341\024\2763B\t\016&0\250\031B\260\251\251\261\231\031Bx\300"
+	.ascii	"\240f8s#a(\354\255M\204\0067\303\t667C\227\261~\215=\024\323"
+	.ascii	".:\275\263\026\310ZM\034\370\322\037\205FL\225\005\366\371t\335"
+	.ascii	"\323[\372\334\226fi\232\226\316"
+	.string	"\261$1Z\026\037\220\333\246V\277_\373ZG\364\363\225>^\367\202?\310^\237\333k^\303\250zA^\363\372\364q\335w}\356\256uM\263\353\334\023]T\225\325\365\331#\227k\234T\016\207\263\ty\334nm\273\365\235\330l4\251Z\357\250\325\232&UkB\2132\242\311\240fB\035\263>w\326\262\326\021\315\204\262R\006\013\022\311\361ZTQ(\026kX0\006\203\271\236\274\032\307\353\325\256'\344\253\t\273\252\254\213\325\001\201\003\250\241XE\221P \"\222\024\244$i\r1\006\204 tv\035\022\200\203-\210\305\214\"\221$\226\373\377\031\302\320\265{\235}\323\205[W\347;u+0\225X\037\177:\330\230\003\301\025\376\365\305\013\205\374\244\260\200J;\311\307\264'\326\326\213\"\254\241\332\027\250\3325\301%\365\334~y/\013{^Y\007\304\375\212\343</\rs^l\327h\n!5b\317\007\301\221"
+	.string	"\201\020\034\310qj\236\264\td\340N\354\025\251^3\213\341\034\371\341L\230zmbB\255\tH\002\030q\221\362W\372K\271&!S\324\r\260\3061I\274'N\366\325;?\353\311Y^_\352|\215c\tuxI\365Y\343\272W\370\356=\361}3\007\353\356\310\336\363\213=\243\272\354P&\363\362>\361\231\320\205\354y_\006\025\212\226\224a\321\314E9\324\313)\023\333L\363i?\263\344\243AHF\2047\232x_\373/\203\204Y\353kYH\345\037\217\266v\312\212%\256\372\353x\211\235\310\340y\204\nQ\231\231\252\246\213\342\rt"
+	.string	"\032\330TI\207,\377\216\027c3+\210\\_\235\245:\336\332P\002\200\233\001\303|\326NA\3067\003Z\322\371\004\224)s\371\20199*\013#\343\337\323\t\272D^\221)\214e\2749\b\370\205A\327R\t\361\205\374\b\313N5>vrE\224\252\352\251\234Z\225%\224,2\301\251U,\201\304*\027\016\215\302\026J\026\231\340\324*a\315(\366\034\201\301]\332\022;\331EK1\275\031"
+	.ascii	"F\271\251\307\374\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.27.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\210\017\2452"
+	.string	"zO"
+	.string	"\021J\240\226\231\016*H5\256#\"=\274=\303\036[\211\332\f-\254\264\322\214C\022\177\305<\322\023Ps\315c\354\270\235\206\374\206\271\204.\343\345x9:H\033\362\256;\271$\277\005\\-\337\005\337\005\374-\374w\223-wJ)\005\t\001\340"
+	.string	"\371"
+	.string	"k_n\256m\243o\350\2602m\252X\252\314$\rDXX\226M\002\373\246\366M\273\246\366\375\024\274\352\264\331\234\272\262\2211G\030c\2218\024\276\004\201?\027_\217\267\323\265\344p7[\2156\223\305`/W\213\265ZU\352M\337\225\334*\003i\215$$>\313\235F2u\f\223\022?.5\314R\0227*uQ)\311\211H=D:ra\220~\t\002\304\203?\032\370\303\310\177:\332EG\016\367\341\350\036\216\033\316\263\321;\0335\\7\324-C4<\367\242q/\\\370\255E\333Z\260\360\332\212\246\255\020\362\031\263eL\025\036+\321\260\022$\3745\242]#Dx+D\263B\200\360U\360D\207\240^\237\374\004\005c\374"
+	.ascii	"\271\352C\253\260\245\206\024H\324\3437Ue\004!\301\226\031R\002"
+	.ascii	"GPd\264Q\373\206\345\005Oax\350o\243N\215 )\371,=\264\253\f\260"
+	.ascii	",\313\356\263\354\320,\323\314\017\200\231i\230_\275\032\262"
+	.ascii	"\360\370\324\377\021\024\031A\377-ss\307\003\004\035A\371Q0\333"
+	.ascii	"t\263\273\206\235\023tQ3\362:\307\\\347\343u\206\271\316\306"
+	.ascii	"\353\\\274\316\304\353<\274\316\302\353\374r\235\203\327\031"
+	.ascii	"x\235\177\327\331\345:\373\256s\357:\363\256\363\356:\353\256"
+	.ascii	"s\313u\316]g"
+	.string	"\334u\276]g\333u\256]g\332u\236]g\331u\216]g\330u~]g\327un]g\326u^]\347\365:\253\256\263z\235\357uN\335\371SgO\235[A\355\210\023\004S,\313aJ\212mr\211\274\350\242\356\036\335>\270\215\270\305]\244\\w~\326\242(K3k_\033\263\0167\021\267xG\363\320\351\036\025\326\235\237\003\314$N,\313\"\3732r\355\353&\206\356\314\235\243u\350t\323B\317X\026E\222\020\226m\316\3601I*\231\354c\237\023\212\312\244\324X\354\005\205=\022\f\366/(\214\346\365\257\326\273d\216:\347l\327\267\354\372\326\337\314\270dZ\321!n}\353D\345\237X\377L\202\264\337p\252X\254_}N\310ie\275g\211\252V\264'u\245jZ\002}2\201\326\367# \355\314+\351\372-\257\257\372WTS\263\363[\n4U}\023\365\354\031\345U\367\273(\211\t\244\276"
+	.string	"h\377\350\234\356\b\312\f\365[V\377\376\r\017&\030<\212\237\336\354T\373\252\217c\3164\221r\375&j\241\221)PDx|\352~\313+\241\267y\225\217#\033\371\033\372\211G\023\006\217\352\224eY6\375\266\225*\362m>u\366\220xfV\252h\"\245\021\312\262\354\200\353\364\251\302\315\204\202re\301m\341{\003\b\036\237b\377\232\377\357\236\031i3\223\332\357\337=1.\370\024#\277\277\215\372\322@R\n\r\372AOh\266\241\211\300@B\rN\322A\016\016N\216M\322A\203\032\234\244\r\204\bI\232\035\347<X"
+	.ascii	"!)!'\007B\262\325d\373Q$x \317_\340\n)\313\236(\320=\272\235"
+	.ascii	"v$\2702\304\310"
+	.string	"o\231:\347\354\230o9\346\217\177\363\214y\334\321\n\324\321\bU\322\265'&\020\f\314\033?'\004\205y\317\"e4\022\237\305\245\264\370-\027\237\370\257\250g\361[\n\361\211\337&\031~\313\303\027\376Mt\3708\241\225!\026~\373D\362\362\362\301\246\227gP\r\376\226\034i\3323\005~\313\300\377\375+\n\370-\345\367\363\275\323\305\345}R.4>(\037/\332\203\032\351\365\236\027\355Ay*\357\333\246\"\273\335\353\234v:]\356\211\364,\211\t\324\362-\267|\356ohZdrT\206r7'\\t\210\n\207\373\333\347\204\234p\357Y\242\267[\255\311\366Bl\266\2575\331\240\265\332\214\246D\243\375\21463\203\232\305\2422\251\201d\250\201`e\221P \")(HI2\214\001\201\006\"CV\266\001\022`\262I\016N\031&&\222\032K\373\177\007a\034\266\370\226BJ\326\353\370\200\210\272W\315\366"
+	.string	"\2368S\270+\304\0332*\022\021\303\316&\361~\317w\305\247\264\322\346\001\251\242\201yUhM=\200\274\350\216\246d~,\315]7\300\303w~\033\243\261\230\247pm\271\263f\340\333\207\254\213\2735\230\313o\202\357\215\314\354\211\337\367\026^+\240 l<\n\376\253\313\310K4P=\203)\373&"
+	.string	"t\254%\373@\254\241KM\246@_\341\006\n\260.U\342\332\222\224G9\233\212\337\311\273\277w\314\372\2330v\352\326\256Yx\333\302\363\260\317`\366\210i{[J\020\313\257\373\002E1\206\332b\311'\224l\351k3\337\353\220{\307\276\313\370\231\032\200)Z\360\207\022nZ\321Atz.\346\355\264M\310[\251\264\337\254rE\277\002\206X\354\275\230i?\332wL?\313\032c\201\324\360\223\372\3568H\212/o\313;\221>\207y\340]\215eeo\bh\200\312\221\3012\312\314\006\303T\220\221\304\226\331\304?\324\310|\320\274\343%\224Mp%\212\025\206\353\312\216e\323&,kt\356\272(\006\021\273e\007E\203"
+	.string	"\003\001\023L^\237\220\310<\321\327\311\247-\351\016$\027\rX\326\226\360\bH\037\230\252\207\325\226\232\214\325>\375\026\023"
+	.string	"\302\310%bC\370\007\352\021\013\317\267\\\255}\335\321\214},\360\211\004\321\021\nR*@\372v\001_\024}\030\312)\343\372\003\003\224\025\3137cV\367\3114@x-bD\003\336\271\036\272\366\236\206\257\234@\231\300\324\323\323\220,\201M\345\263\371G\376D\310e\341\247\216\235$\376v\340K\204\\\026~\352\330I\342o\007\276D\310e\341\247\216\235$\376v\340KC\f\311\365J"
+	.ascii	"1\\.\306\366\235\3415\037\212\322O\200\364\230\226\343\037"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.28.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\332\003\265\027"
+	.string	"\366\251\216H\340\322&\035R]"
+	.string	"<{\007\271K\210\261\255V\226\026\007\216\331}\240\243:\227\303\241\246\205M}p\207\207\323\372\017\0079M\214\003\3254\030\3068\207\033\214\031\247v\277\307\310b\003\252\320\301\352R\262\215\020\262\267\224)\005{"
+	.string	"r"
+	.string	"y"
+	.ascii	"\227\016\277\223x\t\227\215\213\241\006\016G\342\301cS\232s\256"
+	.ascii	"RGu\227\361%\335\345f\360>\206wT\327\301\223\351\363:\031W]\276"
+	.ascii	"\347\022G\340h\310h\257\203\026~\262PAM*\030|(\374\2731\243\240"
+	.ascii	"\362a\006\244\336\204w1\305\023S\266\230\312(`\316\031\200\026"
+	.ascii	"!\036\320\036\232\216F\017?\337\027=\302\300\335d\264\237\253"
+	.ascii	"\3472\347\264\312h>\367\310m\337\260\335b\257\211/\375\334 \033"
+	.ascii	"\345\341\177\"\325\250\337nP\252ORm\222\352O\252=\251\356\244"
+	.ascii	"ZJu\274z\243Z\243\372)%J6\030\004\231SBn\310\254!_t\370\355'"
+	.ascii	"z\n\277\310\240\177\303\371^\263\357\206\244\244\372.\243\355"
+	.ascii	"\362m\006m\024\037r\235(\347{\315\026 \365\3601\347\\\271\364"
+	.ascii	"J\215\221\253}\023?\341zh\243\223\314\031\304\302\305\234\241"
+	.ascii	"\312\006\276[s\267r\035\f\315\330\321%U\267&B,\337\336v\0020"
+	.ascii	"\210\210x\001\323\234\334\232M\033\026e=\231\256\034\334"
+	.string	"\236\003\031\322\261\243K\217s\316\031\267v\234\016\\\224\215G\261\013k;\3466\343\n\344\230s&\220G\262$\337\b\202q\037\007\337F\373\236\n0\315Y\367dw\037\003\021o\031\335W\367\261\017:\2323\270\337\027]\206\300\335x\212\3004\267;\347|\355\326\35402\247\371\203\033\246\305&\346\346\205\265\232i\261X-\230\325\214\314\013k\005Sc\263jIq\213\246A\315\352\246\325\252Y\201\341\374\347\006\2416\005[\035\347\30491(8\321\357\003\205\n%\304\240iw\260xI\017\357\2645\237\326\264&K\247\325!,\246\001?:\323\247+\256BG\361\333\232\277\365\026@R\f\275\217\3668\274\275\355$4\220\326\223\252\247h!\004\324-\202\034W\361\023\233,\t\2469\207s\316.]\250aX\246\230!!\031\221\202\244 i5\240\002\231*\243\007\021\2009$\305\263l\006\"\314\214T\276!|\374\216\304"
+	.ascii	"\323\332\360\343\275\217=8\215*\224\370\350\306\336\356AgG\205"
+	.ascii	"r-\307\205\357\315\207\200C8.Ol\222#\306\243\275\211o A\226~"
+	.ascii	"\035\240\204\034\244\0274y\330\207J\316\025\237\035\347\225\r"
+	.ascii	"\354\346\271gAn\022\340\026\202\201x\230O\250\351\363\233\345"
+	.ascii	"q\235@\031\376\201\354\333\356\r\205a\202\226\2173d\027}H\260"
+	.ascii	"D\253\364Z\024;\303p\001\225\356\342:\230oZ\220)\243\366P$\032"
+	.ascii	"<\360\220N\373\226'\230\304)\260\034\244\327\tp0}\364\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.29.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\310\006=\037"
+	.string	"6\364\262H\260XQ:\360(\327\031P\r*\304W\no\245H"
+	.string	"g\033s\271\227\305\251\\2\204b4\262O\371H+\255\347\f=^h\002\357w\n\357^\341C9N+\216\255\277\002,\023\347\315\\\377\333\377\366?id\023)S\n\244"
+	.string	"\216"
+	.string	"\235"
+	.string	"\322\275\3617\216\003g\377\302\236\213\2407\311\242\343\2632\347\274\271<\200x\031~&^n\013\313\207\275;T\334g\262\030\354\345j\261V\252\324\210\022e\270\212\363Q\013B\033KUr:\233\317^\\\366\002Hc\274\303x.\364\245\342.\025>\332JqV\n\024\272:q\325\t\023\232*\300\"D\211\217KxJ\024\020\342\351Q\024\211\213.\235N\350\342\313Q\031\252\200H?\227\256C\210"
+	.string	"H(\306\217\256;:\034\rc\214\370\376\350\241\220\245_N7\342\212Z0\347\264\346t!n"
+	.string	"\267\217\301\266\315\026\007\004\272?\300 (V\274?6\355\275\037F\252_nt\317\244Z&\3251\251\206I\365K\252]R\335\222j\226T\257\244Z%\325)\251\036\245\032%\325\242TK\251\016\257\336P\255\241\3721->J\032\004\347\004\021\3042\223H%\0307\372\211^\344\037y\345\033i\030mxF\243'\037j\343\345h\343|\237W\366\216\017\341N\264a\264\341a\360\304\203\2249'\355\322\264\361\362+"
+	.string	"\\\355\347\270\016\334{Nzl\316\037\037@\346\354\325\f3>L6\324\336\367\030\222&\213\332]\355EH\274\036q\0214\235\307\005\370rN7\032<0d\006\016qw\026W\356\204\241#\034\364\251&n\013/f\334\373n"
+	.ascii	"\350\273\242t\243A\271;\247\200\226\266\250\234\322>\333\035"
+	.ascii	"y*CN8\350\323\3039\347\fww\r\342li\033\002s|\326\266\203\373"
+	.ascii	"\374{i\232s&\220\300\234\223\257\224\301\2771\310w\322~\307\304"
+	.ascii	"\215\006\255\013\263\273\317\221\021\336E\304\257\356s\204p4"
+	.ascii	"\350\331~\177tIc\351\247\223\345F\203\273@AD|\330\335\331=\233"
+	.ascii	"\022^\341\030n\031\233\205\b\027\036\314\334(\320\314\314\320"
+	.ascii	"\310\334(Hx0s\223\251\261p\263\0210M\005\b5\267\013445\267Uo"
+	.ascii	"~\177^\326\345fq\274!\234\223\205\202\023\375Rv\274\030\325\230"
+	.ascii	"\305\366\367\030\022\257G&\333\030\223,v\305\261\335\021I\272"
+	.ascii	"\336`\222s\202\301\366\005{\275ZL\256\032\222\313\265-&u\325"
+	.ascii	"Z\333\332]\355\307\005\370\316\332\235Y\273\332\t\254\332\252"
+	.ascii	"\250\206W\251\205\342\343\263("
+	.string	"(\225jS\333\362dS\255b\211I\311\246\210)\324\022i\322#\274\236\321\246=\256<`8\356\316\343\242\266\345d$\274\201\373\200\237\250\201`E\221\214\214HJ\222\222\264\032\340\002\221)\252\007\022\240\2045\006c\315\225\024\245\230\375\337\002\310g29s\3741\252\035\367\374\\>\326\306\035j\325{\0351\271\220\330a\006]\274'\005<\322\217\013\354\n\375\254\0357\204a|I)\267\t\016\320B\371\261\203\243\366c\250Q\031\222\267\035\034[S\347\201\303\270\004\036@`s\275\364\336\346~Ko\345M\276A\316\260\230wqU\256\200{\336\200_QsaX\245\301V\244s \330\005n$\303\325\340\007V\013^\322\n\211\364\333\354\251]R\024\372\3138[\233\3633h\223\025[\235}\231\247\277+!=\235=\353\322\261I\372=\223\222\203\340\030\0020\361v)1\372\017\357\367\244\217\225f&S!G-\266"
+	.ascii	"\343\331@\253\261\036#\221\245\210\b\250s\021\364\246\356\306"
+	.ascii	"0A\221>\340:\223%\233@T\261\3040\225\323\200\273\202}\bF)E\""
+	.ascii	"\243\346\023^\374R\013\345*\026\r'\234\027V\242\022(\237I\232"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.30.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`K\013\325("
+	.string	"\032A\314\rK\240\226U:\204\236"
+	.string	";\321\007f<bn&u\032\361\372,\350\264\302\fay\016\304\270\254\005\256\245\262O\022\371\221c\274\226h\006`\025~\205\265\340\2659\033\274Z\274\325j\361-\324d\333\256h\333\266m\333J\032\331D\312$\003\322"
+	.string	"\264"
+	.string	"\305"
+	.string	";\300<]\242\371\244\303\270\331\205\"\211&\214>%\304S\204Rk\035\266<W\236\222\277\225\247]bY'\211_\222o\016dY\371\371z<\225\235.\207\273\331j\264\231,\006{\271Z&\253\244d\363\315\236\365B\276\b2\244\007\b\347\300\245\263,\305\340\025\245\377\224`\260/\351\275\244\027\314C\272\n\222\013\336\035]w\244\202s)\216Ka\3047\024\267\2418\301\265\242\323\212L\360l\304e#Dp,\304a!@\360k\350\256\241\017\334\002@\202\203\320M#?B"
+	.ascii	"X\374\0041\313\303K\262\205\207l)\3560%\315Z\253\fH\003i\200"
+	.ascii	"}\200t\230\\\321\341\375\247\223>\200\034{\200:\234Y/\265\326"
+	.ascii	"\345\036 \016\337\226\357\362\202\335\025\356\266\224\002M\254"
+	.ascii	"\025\247\373\334%\342p\023\021\233h7\346\304\037\001\345\205"
+	.ascii	"\271"
+	.string	"\323\027HyY(\357\n\345\375Q^\037\345\355Q^\036\345U\241\274;\312\253\243\2749\312\213\243\2747\312k\243\2745\312K\243\2743\312+\243\2741\312\013\243\274/\312\353\242\274-\312kR^\026\345-)/\245\274\344y\233\344e\222\367\nt?\2120\210\252u\303\225\224J\204\3628\272\323\337\364\031\373\247}\355\235.\2308?\246\323\024\210\240y*\333\275\331\027\367\265+\343L7o\302`\342\374$\230\032jRku9]\027\363\364D~\347\335\307\370\322\315\211\233\343\265Z\211l\350\250\225\030\fK\232\211+\330Q6\316IGX\256>\327\325\255\326Y\035KW\263\224`\313\346\244l\365\331\034\305Rfs\215s\221\2214\373\\\263Y\035\253\022\232\375#\253_|mH\222f\321\376\f\034EA%\201\002\247\361]\261\247*\207\257\312>\267l\3323LR\031\330j\245\276\306\362\264l]\021\001\263_|"
+	.ascii	"#\024\022\217\034\276\242}n\353D\3074\253\207]\016l\237?aR\222"
+	.ascii	"\201\255N\326Z+\331\347/\224\300\216i\322\270#\242w\367\345\305"
+	.ascii	"\205\022\200\244\326j\200\032{\252\366?,,\224i\264\337\034}\237"
+	.ascii	"\0179|\265\334\b\272\373;-\310\257\220\362\315\375\035\026:|"
+	.ascii	"\265\300~\377\351\324\005\220#\317\224\034\276\352\020.\341\025"
+	.ascii	"\2762\302\t\017(4"
+	.string	"\240\031F\250\241\241\251\221\031F\200\320\200f(c3a(\354m\215\004\0076C\n556\303\027\261~\211M\004\323-9\255\263\030\310ZI\034x\323\337D\006L\224\005\366i\374\256x\226>\227\245Wz\206E\270bD\332\025\237\217\337\230\260~\277\366\265\316\352\347+}\274\356\005{\220\275>\267\327\274\216U\365\202\274\346\365I\305CE\245wR*T\273(\273\353s\207N\327\271\243.\227\273\tu\340p}\303\365\217\267[\355hk\250\357\212\267\365\271\266\256\365\314\3216U\363\201T\233I\321\2049h}.\255g\255\263\242\tg\345,\326\034u\233TQ\220L\326\261\240,\026{Q\301\372\006\f\326/*\0226\305\257(\373ju\007\201\006\250\221\\E\221\214\210\210\244 )IZ\003A\006\204 eV\035\022\340\203%\310b\re\"A\323\302\326\377;\322P\316\313\272\233\"\237\372\347\224G\354\2468"
+	.string	"\320\260\354\352\020l\320\007\361~\001\365\007P\242\253O2/\\\230\365~Z\002\356\301\2137\314\376\022\314\221\254(F\207Y\331\215\261Q\001y\213"
+	.string	"\035\025DD\271\251K\276\266\207\215\022\353\3741\007\b\022\221\235\350\024`3\025\321'\004\335\307\360\fpG1\207\n\\\\\312Y\242SI\n\231\232k\321\331\236w\274e~/\217\235~cx\264\007\251\314\022\bh\037\"\327\202A\237`A6\253-?\t\200\371\271\333\363\220\341\220\224\023\030\212\222\306\020\r\bv\034^\314\024-\312J\343\327\363\346\224Mh3\320 6\"\207\3475\314p\324c\315\246q)s&;\311\260D\322[0\354\211\217+\261<C\247\301\265Z-\247\".m\375\230NJr\327\311:P-r\r\027\3642c\023s\343-\322\302%\254\255.M\316\257\027s\020\321\276\251\2377N\003e\200\021\275\215\004e\375\037\253\277\264w\234\034O"
+	.string	"\271I8\231\322\310\231"
+	.string	"\375\277\366.\277~\301g\312t\177\020A\246e\354s\374y8\321K\344\27121\001\244M\002\237_9z\353\272\216\241\264\226P\226+\217\tC\255\340TU\0253\036\372|\200\353\001~\376\220\347\013\270\017\260\373\007=\037\340\365\200\235\177\310\213\317\030\261\247\177\311\030\212+1\222t\260\274\322\273\261"
+	.ascii	"\3571\351\304?"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.31.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\322\017\0052"
+	.string	"\252N\354\020J\240\230U\007\n\356x\300v\354\263e\326\tL\037+\324\324/\210RC\316|\177Kt$\3503\376\210\030\315\217\007\356\230\251\244g\201'\360:\274\016\353\240\303\312\227B\364\205`9B\361<\311\262,\313\262ld\357-wJ)\005\b\001\335"
+	.string	"\366"
+	.string	"\313\265\223:\307\017s\023]\262x\321Vbl`naY6G\330\271\264/\332\267\264\357\257\340V\243\313f\324\177\032YC3s\2241\026\2111Ca\020\006\370\363\365x/;]\016w\263\325h3Y\f\366r\265V5\275\350\373\017\267j"
+	.ascii	"\305\301$j\250\b\250\221R]#\265\304i\224\364\214\222$~l\266L"
+	.ascii	"\363\311\215N]tjr\"S\3070\t\361a\220\026\006Y\362 \217\206\341"
+	.ascii	"\261\303\201:\372\247#\207\373\222\272\227\204\303yH\375\202"
+	.ascii	"t\303w2Z'#\206\347`4\016\306\013\277\271h\233\213\026^S6M\311"
+	.ascii	"\302g'Zv\302\204\307J4\254\004\t\177\215h\327\b\021\336\032\246"
+	.ascii	"\360p\324k\024\242\243!\r\"#WCt*+\332\200\n\231B~\321\264\306"
+	.ascii	"\221\223\254H\003J\240iJ\215^j\347P\204\301\321\031\037\372{"
+	.ascii	"\251\321#R\315\241\242\017\355\252\001\226e\331\207\212<4\333"
+	.ascii	"4\363\003`f\034\346\030\203Sj\034\375'\231\227@\036\340\250\251"
+	.ascii	"\345W\301\274\323\313n\235\353\234\240\225\232\221\327\271\346"
+	.ascii	":\323\\\347\231\353|\274\3162\327\331x\235\213\327\231x\235c"
+	.ascii	"\256\363\360:\013\257s\360:\303\\g\340u\376]g\337u\356]g\336"
+	.ascii	"u~\271\316\273\353\254\273\316\271\353\214\273\316\267\353l\273"
+	.ascii	"\316\265\353L\273\316\263\353,\273\316\261\353\f\273\316\257"
+	.ascii	"\353\354\272\316\255\353\274^g\365:\247\327\371^g\264\235\037"
+	.ascii	"uv\324\271\025\354@@A\220\305\262\035\262\260\330'\267\210\214"
+	.ascii	"V\352\376\321@\270\227\370\305\255da\005\"Z\225\254 \335\254"
+	.ascii	"}q\314?\334L~1\367h\037?\375\343\302\nDt\300\312\215*\226e\221"
+	.ascii	"}\031\271\366u\024\305v\346\336\321<~z\311O]cY\025LCXvy\3034"
+	.ascii	"k_\016\261V\366N2\331\307Z\031N,\366z\230MS\357\230\r\373$\303"
+	.ascii	"\376\365<70\233\327\024\022\277ZU\177\345\261\270\236\037\305"
+	.ascii	"\324\236$Eu\271\276\365\272\253\252\325\365\216\365T[\266,iK"
+	.ascii	"\245\212j\247\224Fk\353B\332\225P\350\372I^_\375\230\025U3\324"
+	.ascii	"7\225\026U\277\231]sR\345\325\373\r\304Ii\224\276\200\266\203"
+	.ascii	"\364\2169d\025\344Y\274\246)6\322Or\372\367y|Le\360+vz3T\332"
+	.ascii	"7}\235\362f\375f6\021\252\t\227\"A\236u?\311\255\026\277\363"
+	.ascii	"\352\220#\033\371\034Z\213\017\252\f~\325(\313\262,\372\311\266"
+	.ascii	"\220\"\177\347Q(!\023\317\314?,\232\311\315c\313\262\354\200"
+	.ascii	"\0135d\305=U\201\233\353\013n~\372\346 \"\310\263\330_\347\377"
+	.ascii	"[\310\006\332,\225\366\373\267\020\r\f\236\305\310\357\357\245"
+	.ascii	"\2767\244\232\033\272\004y\326\177S\016\032BSh\336\301\221\320"
+	.ascii	"`\202NO\316\003\237\236\036\237\235\234\007\016tzrv\"H\310\301"
+	.ascii	"\351\261\017\204\005\021r&\370\370D\310y-\331~\025\t^\030\364"
+	.ascii	"\030\370\002\312\262)\n\364\217\356\252\036\t\244 1\262F\252"
+	.ascii	"\346\223\\\3634\317\343\254y\035\215\223\013\315\261]\3227,J"
+	.ascii	"\243\231\231?\2663X\307\243\321)\323*\221\221y\243S\2465\276"
+	.ascii	"\361\223I\212\237\344\342\023\237\347Y|\035\321\211\304\304O"
+	.ascii	":\243bb~H\025\343\034\246\303`\024\222\266M\241\302O\262\360"
+	.ascii	"\203\037\263\022~S\t\006\201\017\005\003\363@,\030\034 \027\240"
+	.ascii	"\357\371k\217\374~\357{\376Z_\352\373$\225\221^\357yU=\036o\367"
+	.ascii	"E\272\346\2444z\371$\277\374\356yp^lvN\220v\271*\335\223\210"
+	.ascii	"\252\323}\356uWU\272w\254g.w\243\302\375\020\034\356oT\270\366"
+	.ascii	"v\253\331\2326\333\327l75.\265\331\223\206\365\244\322h?{\335"
+	.ascii	"\325\223\206\225\316f\001\201a\250qhd\215\214\210\210\224$)H"
+	.ascii	"\2061q\006\"CU\306\r\022@\222I\216\307*\312\\ 2c\033\373\377"
+	.ascii	"\0061\274<\304\277\276\302/\340+\235\275/\212~\247\365'\356\251"
+	.ascii	"H\343\004\177^\360ga\376\037\214"
+	.string	"\357\261\250\341\334\376f\037\325.!\341\230\002[tq\217\323\307'I\005\003\201\375\275G\312\263\230\334M\035\367\266fj\361Q+`\227\363m\rF Y\"\375q\013F1\220\342\023\017/\361Op\225\025l\353\003\352\335\340\264\"\327\311X\322\215\222\030]\224+\227\277(\252\321o\034\n?9\026\345o\226\217Sh\313\250\231(\003\016\031h|\320\305\215\306\026\232B\363\350\351\234\177z\261\tm\016\300dqS\265KA/0\002K\240\234\341\0254\230\006\310\367V\310\332c\357\027c\220\346Lz\304\347\246\241\330\202\275\274\f37\b\251?C+\371\203\363,\323m\030\243e\324\361\t\004\016\345\220\326\316\303\353g\374m\352w|\236\024\362\024\260\214<E\247y.&\372?\327\375+t\203\230\240\232`\367Xq\252M,q:\326~\"xUW\237\016\350\004\330\227\364O\266\254\313\bJ\274*`\233\272\b\365"
+	.string	"\371\036\307\236\256\2021Eg\264O\nQ8\377\314\263Kd\210j\25568\3054Q5 \210`\200\307a\261~)@\245\275\\\227\027\304\315\227{\326\025\200\333\3718>\224+\250\261 i\317\214\313("
+	.string	"\310\315\002\227\271\202x*\340\374\037\331\203\221\364c<h\006\353\007\364\375\265)b\306\264\356}\260"
+	.string	"5\005\330\233\204"
+	.ascii	"~\345\3657\026\032\206\212\353D\002p97bG\022}*\237&\030\266o"
+	.ascii	"\317+\247\353E\325\214\323\217Q\265\262\3505\363o\211Z^\357\213"
+	.ascii	"\365\211$\035\253\266\345\3703\244\336\026\333\3207\364\327+"
+	.ascii	"\273\354\272B\005V\302\254\341$;J\334\004\234I\323f\374\003"
+	.text
+	.section	.gnu.lto_arraySubInt32.32.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\032\002\275\021"
+	.string	"6\342uF\340\356(\035Z\td\350@@\304\373i^\3307\225C\211\202P\004\350\007\324\f:&\226\034\354\272)\326c\252\234\273\327t\252\3279\374\r\r6\314\260\002*\312\301\207(\376 \217e|\303]f\251\222O\310\2262\245`"
+	.string	"`"
+	.string	"^"
+	.string	"\013\202\370\200w\316\340\005t\347\274{t\347\374\262]\034\254\331\367\330Zt`\354\356\247\035L\n\3030|\004\357\230\257sQ\363\345\323n@(H6K9\027I,/\037L3\226\030rT\364\363\332\323e\006\313(\"\346\372\332\021\334B\331,\346Ir\260\273N\331\f\346\356n\333\202m\bvF\bO\2232\335=\315e:>\255\232NM?\300"
+	.string	"\233\025\022^\354\276\2041v\210\373\001q\236\333G\341\327x\f\344\245d\360h=)\212v\367\343\234\037x\347\256a;O\\\347\365\035\003E"
+	.ascii	"\273\302A\203\317\356\202\270\201w\256@\274G\227#\203\001xC="
+	.ascii	"\355\227\370\315\3538(?\355\316\334\370lF\235F\365T\211b!`\035"
+	.ascii	"J\322\273:\223r\032\211|\333\205\023\317\203\217\322\335EF%C"
+	.ascii	"\247r\250\352c6\361V\321]S\037\033\001\313\320%\275\276\366h"
+	.ascii	"$Dk\231\241\222\241*-\210e\246Jc\203)\031RsTd\235\261O\307\371"
+	.ascii	";\236\363\233\016\376\034\337\3717\316s\2272\355\005#w\221T`"
+	.ascii	"\251\270\005\n0\244Z\255T\3472\021\231\020\255B\231Pp\245V\037"
+	.ascii	"\tk\265b\251>\222\221\324\352S\265L>\024\001\263JDZ\237\213\305"
+	.ascii	"j}\032\340^g|\332\275 \022C*\n\343\224\306%\031=\251\266\310"
+	.ascii	"\217\227\324eCKz\034\023\267\225<z\334\335\215N\360\222\236\364"
+	.ascii	"0\2670\266\301S\337Vrbb\2216Y* \240\202\031\313m#\016\224\003"
+	.ascii	"{G\226[\224\276\265\240\214\244Q\370(\376U\034\331\221\231y\233"
+	.ascii	"\006Y\301\211\005,*\260\004\213i\256\262\225\331\036d9\355\266"
+	.ascii	"r\ro\030\215]\334\2601\265\016\247\003\033gmv\230!\f\267dbin"
+	.ascii	"\300(\371^>\213\2440T\215\367#\322\271\304\023"
+	.text
+	.section	.gnu.lto_qPercent.33.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"U\b"
+	.string	"FP:6Po\322\0015\341f-s\343\035l\003&\310\267{\205\001\b\203\235\217\257+\335\032B\356k\343\0071\001K\357\314L\272\252\032\026\327\355I\b*\317\320&[\312\224\002)"
+	.string	"+"
+	.string	")"
+	.string	"$0\273\033\tn"
+	.string	"o\345\013\340-\3158\367\344\374\217\374\241R.\246S\350\t\320\260\273N\323\251\342\326\333F\260\255`;\0251\253b\235p\330\336\354\214\355L\373!\027\331\336\201,\260k\341a\262\273\fN\b\270\245y\266\375\217\203l\346\262\323\240\200\033\250RF\201\327\324|!\251X\016\202\252\327,!u\214rew\241T\f\373o\365\302\357\335\257\232NM\037.\244|\245ewb\025\022\367\265\361<|8X\354d\030\226]\261\003\301\301\342\245y\342\346\300Y\204\203\026?Y\246\305L\267\367S\215HGN}\372\222J\224+\017<\013"
+	.ascii	"2\003\3020H\341H\232\315\2720\216\2145E5B\2011\002\2320RRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_qMultiply.34.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"5\t"
+	.string	"f\322?6@\217\322\001\t\254n\\D\235\024\260\335\266D\202\230\300\314{c1\236\222'j\373\310\235g\356x\262]\241\263*\212\206\003\227\013O\272\r\220\036\375-\333\233H\231R1"
+	.string	"0"
+	.string	"-"
+	.string	"\\v\031\022PCE\365r\331\3358\360\002\370\227'\200\177\212q\356\311\371\007y\326r\"\262b\231\236"
+	.string	"\013\273\353\\\261&n\275\355\003\333\n\3663\001\021\261\227Ey$\033\266Kv\306\266\346]\234\337.E\310\006\363\347L\373\036\377(\275\203p\300nEkdw\023\214\200\371\323d\266\375\326;J\016\372J\301\236>\305\201\312\2303\275\246\211\nv\312\230\335\231R/\354g\253\026\266\323\360\335\377\356\3723M\253\246S\323\307lV\236\302\262\033\244\207\020\350\363\034n\017g\324@\352h\021\264i\332\346\211\240OG\213\036\321(r\f\274\205\030D\221\264m\242\230\351\366\206\2529)\312\252P/p\227\300T\325\016"
+	.ascii	"2\003\302\260Z\270_S\363 X\230A\270&F\322b\177,H$d)\240\206\200"
+	.ascii	"\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_qConstruct.35.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\005\t"
+	.string	"\306\021>6@\217\322\001St\200\340\205\362\267\234\351\247\205\250Z\365\037R\264\234\360A\272o\353\245;lE\223\235\3204;\206\201`~u'\310\261\001\322\243k\365\336[\312\224\002/"
+	.string	"/"
+	.string	")"
+	.string	"\027*\210q\202j\261\354n\314\234"
+	.string	"\376\271\017\300?\265\370\3509\362\357q\247B\222\222R\221\236"
+	.string	"\n\273\353L\251$n\275m\003\333\t\3661\001&+\273\021/\327\226\274\220\f\333\"\033c\263F4\227?k\332\347x\207\350\033\204\337\356\304\ndw5>\270\374\t\244m\177\343+\221Gn\013\026\201\327\324\237\\\246|\331\3515?P-\245|\331\033)\265\302\276[\245\260\235\206g\375\357\333\3574\255\232NM\377\202\200\362\231gA\261\207L\335\331\200\030B\034,f\032\206i\235\2305p\260\330\371\200\342\246\300\232\203\347\023C\232\366\211\230mo\250\231\222\232\024\352O\032OU\265\025\360\017"
+	.ascii	"2\003\3020-n\213\301\n\260\345\237\303\271\206G\322\002~L(`\016"
+	.ascii	"\f&\240\206\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.37.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`F\004\345\030"
+	.string	"\366\352\226J\300\020)\035\214\337\356y\216]\227\375\236\241\251oS\373\2557ng\253f\232\200uC:\035\345L\364"
+	.string	"\377e\355\2776\215\377\302\320\004\n\004\211\240I\020$>\273\3655\025\2405M \0334\237\335\212\376'\215\020B\310\226R\246\204"
+	.string	"w"
+	.string	"\200"
+	.ascii	"E9\373a\231l\177\320\201\356\274\221A\363\304\243\326\032[\261"
+	.ascii	"d\003\214+\322\035\031W\354\241\367\307\266\255\353l\231%9\212"
+	.ascii	"\264\371e\373r\215\016\205u\2212\340R\246\0366\202v~\366<\320"
+	.ascii	"\362\311\300&)\013\332\361\331\222E\016\006ZRk]\244\234\036&"
+	.ascii	"it<\362\254X\362,\245\244\016\207\003L'GU\204WR\013\\\266\321"
+	.ascii	"\271q\267:XX\036\331\027)\253\265~o\032\366\260\375\377\342\177"
+	.ascii	"\312OM\002\314\017a>\b\363?\230\017c\376\213\371.\346\237\314"
+	.ascii	"o-\324\336,\311Q\244\315\353\333/\2005\360S+\316\020\253\002"
+	.ascii	"\211RF\033\265\013\265\374\357\277#j\337\250\005\376\374\325"
+	.ascii	"\240j/\311==H+p\217\222\204\nl\337\337O\021\023h\0052X\242qU"
+	.ascii	"k=Y\361'g^\337:\325\242\2343\257\323\2037kM\241t\242\326\232"
+	.ascii	"`\305#(W\374\267\251\366\007\251\217(f\267\207\251\035\022\216"
+	.ascii	"\207'\331c\026\254\206G\325\352\336\205f\300\370Q\345Xh^\354"
+	.ascii	"Q\200\211\002\027\232\224J:v\213\234\023{\177-\310\356\275\204"
+	.ascii	"H\373\224nw\333\234\n\315\374\250\306n\n5\334\361DJ_\"}.1\367"
+	.ascii	"\266\315\351\314OE\216\205\357\245\335\275\340\222\240\321aU"
+	.ascii	"\3771W\353\315d\233{\201{\222\264cw\204\343\341{;jJ\247\303\335"
+	.ascii	"{\277T\210\204Wo\241\177}\273\"\001)2\034\343\322\"Ce\366,(0"
+	.ascii	"\021bVf1\027\332lFc\211\271\264\254\314b,/01\024\222\323$@x\211"
+	.string	"\305\320h/\261s[\250A\020\304\t\322!\017\351\313n\215s=\250\301k\221}j\212MbtS\216]~t\331 \2759v<X\267\372\2439k\003\n\035\020\326\253a-V\355\216\\m\366\253\307\247\035R\205\236\236\025\216\334\331\256\036P\265\343\341x\030\342\206\013\337\202\3410\206\331g\023x2\273\354V\213C+\312.;a\250aL\345\0303BB\nR\220\024$\035\260\002\231\301\342\006\021\200\255\223JhAI\n\255\031\257\003\360\221\377\343\3051\224\3424\236{\301xJ\027\nb\357#&g\320\317\356\243r\227]d\335\310\316\251\013\224j?L@\342\344c\362\354u\277\221\03106D\023\002\035\370U\306\030\337\230\246\206\230m\254\242\244%*\334\315\300\033(\260P;\214d\022\221\310B\263\335i\373\366G\372M\240\372\t\236I\270N\247\354\372)\004R\261\\\223%,I\230\202\374a\377\256\031\271"
+	.ascii	"\257D\fKq\355\212E\030\236\237\031\312\003\204R\275h\030\002"
+	.ascii	"\021\227\230\344\2604\361\232\266\202V&Ku\230\327\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\236\002\365\t"
+	.string	"\004\r\232\003"
+	.string	""
+	.string	""
+	.string	"\002%\177\034\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \005\177\035\253\325\252\325"
+	.string	"\272\200\202\002\006\177\036\200\200\200\200\004\007\177\037\b\177 \t\177!\n\177\"\013\177#\377\377\377\377\003\f\177$\r\177%\016\177&\017\177'\020\177(\021\177)\022\177*\023\177+\024\177,\025\177-\026\177.\027\177/\030\1770\001\031\1771\370\354\254\032\1772\200\200\200\300"
+	.string	"\033\1773\350\314\2313\034\1774\035\1775\036\1776\037\1777 \1778!\1779\"\177:#\177;\001$\177<\037"
+	.string	""
+	.string	"\200\200\200\003\001"
+	.string	"\302\001\003\002"
+	.string	"\241\341\365\321\002\004d\003\f\204\006\003\020\244\006\003\021\342\001\242\007\013\342\016\022\242\026\003\023\021\200\200\200\200\004\001\""
+	.string	"2 "
+	.ascii	"\003!\022\247\003\212\270qa\331\315\2604\2479\373\231\024\362"
+	.ascii	"4K^\273!\036=\322\355\322\256\025&\303\002\031\020\364X\337\300"
+	.ascii	"\3447 \240\007z\374\006~CD\337\220\020\323\021\036\316\253x\007"
+	.ascii	"\3437~\3437~\3437~\243\337X~\3437\350\033)\373\306\3167\"E\270"
+	.ascii	"\026\035\021/\340\347\206o\374F\220/\003\351\">\007c\f"
+	.text
+	.section	.gnu.lto_.refs.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.95ae23817bf42876,"e",@progbits
+	.string	"(\265/\375`\265\035\r\200"
+	.string	"Z\314d-R0RBJ\007\253\212\303\323\026\321\213+\246\304%\3750\330\f\026=S\330\342R\3037\230\225\366\237\256\365jj\3266\253\342?0C\244\3735\305\241\356\263\023\357\356\3146\210\254\252\212  \2422K)\201u\251J\242\210\314\214\206\303u\324zB\244L\001N\002\274\002\350\002g\221e\2070-^S;\306\202\205\307w\274\205\317\330\216\3538\320\013\227\260\226=#i\317\322\366\234C{\016\322\236\235\355\331\312\253\035%\321U\370\244\376\232\345*>g:\236\240\023J\275:\353\332\033\222\231f;\211\312\024v\256k\312\230f\317L\334\204L\337\236\246A\260\034\307\361\031Oa \316pL\235\302?\274\032\202\271s{\034AM\357\275:K\252$V-\213\303\313\366|\333\333\320\236\206\366\347\266\237\3018\214\245\254\315\244\350E\273\227*BH7\327\346\327,\333"
+	.string	"6f\216\300(i\366\311\366,\312\240\326\2304\021\200\007\226\036,~^\222v\267u\314\331\236Q%\355\205\221\275\032\242\346^8\260\265{\257\032\373\300Q\270\312k|\306P\330\311\031\215\237\234\245\336\313\274\367\372\374,\306L\030\n\217\275\272\2169o\217\035J\022\260\"w\006\366w\357E\201\002\005\212\001P\b\245\256\300\255\341\260\007\241\345(\217\b\006\220A\373\337\354\007,\257\004?\240=\211\366;\355k\332w{:\036\021D\200G\004Y\346\t\356PyD\260e\236\240\n]\307,\342\352\302\nc\204\224\003\236h\006,\342\002\nB@}n\234R\320"
+	.ascii	"q\240\205\237;\370\257\f\374|D\266\032 W\3469\377\312\363\237"
+	.ascii	"\356\277\230\377a\356\376\333\341\375\327\373\317\345\037\361"
+	.ascii	"\2575pS\376\007\001\246\316\0057\023f\277\371{\311\013_\377\323"
+	.ascii	"\376C\371_\375\257v\233\277\225\374\217\302\354\337E\236z|\375"
+	.ascii	"\273\206\242\237\307N\363w\361\3757\021\305\333\277]\370\331"
+	.ascii	"\001\246^\3707\n?3\371\271\353\347\254\237\223\374l\365\263\364"
+	.ascii	"\347\350\317R?G\375\f\375\331\351g ?3\375\354\343\347\035?3\177"
+	.ascii	"\316\3613\362\347\030~\216\3613\f?\277\360\363\n?\303\370y\204"
+	.ascii	"\2379\370\031\203\237)\3709\202\237W\374\234\342g\024??\360\237"
+	.ascii	"\314\377\275\377A\374g\373Y\201\237M\374\\\300\317\004\374L\342"
+	.ascii	"\377\t\377I\370Y\200\237\003\370\031\200\237w~\326\371\031\347"
+	.ascii	"\347\340\317\353\317\374\337\314\3772\377\371\376\313\375\177"
+	.ascii	"\361_\312\177\030\377/\370\037\367\337D```\340O\263\363\257-"
+	.ascii	"\374\002X\020V\357\253\177\205\004\257\342\334\033v\357-\200"
+	.ascii	"\235l\261\322\326\354\375jxK\355+\355I\373\356\342\340]:\357"
+	.ascii	"\275L4\324\353<\302\t2\r\363\211?\207WN\340\256\r\374\335K\304"
+	.ascii	"\253\257\345\241\272\204:\002\367^\367*E\\\352u6\313\244\312"
+	.ascii	"\246\331\225\247\b\352\235\"q\313\252n\223*}\262\321\333\227"
+	.ascii	"z\3712\245\317\032Mj\324\331\244F\225;\227\031U\336K}\3564\321"
+	.ascii	"\226Jn\226I\237\315\262\350S\304e^\345-[N\265\314\350\263)\027"
+	.ascii	"}\3564\313\226\317&S\372\0241"
+	.string	"\304\313\212\t\217#di<\325d^\037JQK\347\016]\223\032\275w\3672\032\322u&poT\324y\267\f\302kGt>\216\240,\243LU:\242\212^&]S+z\257\326\321\214\253\024\201\222Jw\255\230NY\025u\223\220\356%\340R\357U\272W\311\227\356\336\253\274\367\n\235Q\324{\205\3544\247JJ\367B\007P\272QJ6\244{\033m\313\332\263YF\025\365a;+\233^\035T%O\357\235\324\331\226)\307n\022\230v\372\374\361\205j\255k\002\302C\263o\036mK\265\016|V\242\243\347*=u\232%\365R\277\0309z6\273\303#\202\357ek\303\275\\\"\310\201\201\\\342\354\325\216b\311\242c;8[\372\242\240\231i\251e8[\322\252\3705\333\320\365\0063\367.\033\332-\244\237\336\320S\231M0\233\320\021\336y5\227\301 NA\261\253\306\303)8f\326\244\322\004\244\203$\361"
+	.ascii	"R\315\342\n\374\301T#e\251\253\213\351\325\0348\"^`O+bJOM\347"
+	.ascii	"\222\r4j\252I\263\357\245\363a\265ei\226\301|\336>t\260T\375"
+	.ascii	"vPJ\302\211\333zv\322\337<\272\207NT\265\017\332,\027\300<\301"
+	.ascii	"n\372\274w\364\022\"\315\253f\203\255\003)\347I\034\027\020\315"
+	.ascii	"\276\221\336\312V\331\204Cj\226\305|\3368\260Ua\226\262\230G"
+	.ascii	"f<\226A\232\355\243V\342\254\231Ar\352e+\261|`\3715\313\200\034"
+	.ascii	"\310gw\353\373\032&\365\226\261\025\020J\253\276\026\2070000"
+	.ascii	"\220\357vf\214\223j\263\331\237\315\224i\261\036\302\250\315"
+	.ascii	"\222\031\200\265p`\242E\327\376\361\031\217a?\2371\034\206\305"
+	.ascii	"\254c\316\016\260<\331C\301PqGUXV\314\317`\270\217\255t\224D"
+	.ascii	"\315\032\036\323\326\\{Nk{\001\346\371\302wS\227\007]j\226\367"
+	.ascii	"J\3440\355\226\306\304\332+\334e\035s\206\200e\311\036\347\361"
+	.ascii	"\034[\271Ta^X\217\3178\357%Z&`\236\321 \313E\330&\206\007\345"
+	.ascii	"\264\r{+\220\025\310\312\204'5\255\361\233r\002E"
+	.string	"\305\351\\\231>\270\367*\251w)h\245\344\004\367\347\202\227%V\353\363+\223\bgI\224\313\034\261\251\335[\332\332c\355\261\372(\341\004o/\304\327\222\2772\245\257>V3\273\263\243f\327\244\016\303$\323;\362\262\222\236\221\255H+\322\272\303N\355\214\b\333\331\332\374\272\343f\013\f\033\265\331U\307\325p\250\274\001Ji\225)\2632[;!g\346\334\304\326\243\257L\275'`\031\244f;p]\262Id9HY\227\253\222\347OI\215\367J\204\200\0322\204\307z\257\205\317\fP\370\027\007\305\005x\246\315\243\363\332\"S\363V\365\3033\303~lY\017iv\321\276\276\036\003\210\306Fm\372{\217\321\313\301\341\013\016K\232m1\035\246f\355\n\022\2270\353\036\322\017f\030\277\265J\217\2476?\006\002J`\335^S\227.\375\245\316K?M\365\001\362\275\277Tm\316\336\242\214i\266\367^m\355\320\204"
+	.string	"6\333^^\365\302\223\236i\266\365^\035\033\302v\245\331\316cwd\311\322[\206\340\321h\235I\323\303{oq\023f\341)\2234\333wk\364\254\372\324l\333\335\b)\362\303\207f[\313\335\3322O\230di\266\353"
+	.string	"\351\350\372\212\034\017d\220 \261\362\276\302My9 ICL\373\220(\363\346\346Z\356\203jGq\312\253\202\2332\245\345j\256\263.\355\306\256\bSV\334[\256Z\343ek\272\003\0247\267\206\253C2\245\241\366"
+	.ascii	"\003\005\342\r\247\247s\367\352\376\232\355\267fk0/\270\2462"
+	.ascii	"5\265n3\323a\357B\241'8\b\231&&)\3576\275\262\037\324\232\260"
+	.ascii	"\365\03033Nlkd\322&66\034\272\251\327X\263Uvb\343\2475\245\017"
+	.ascii	"\314\211\223\206R\347\003\201\255#Q|xC\251\376%=\335f\373I\247"
+	.ascii	"\321h\341\233rA\313\"\215^5\253\244Y\322\"\006\016\t\225\332"
+	.ascii	"f=\025\236Q\235\301\3713\013\242\354m\326\312fn=\363\232m\262"
+	.ascii	"n\262D\375\262\347\327cA<\255)\035R``-\206EooE\"\223\027\330"
+	.ascii	"l\213UC\240\021!\303\326l\207\275\272>\251\223\212\n\302\305"
+	.ascii	"\325_\027PQ\331k'\273\2502\257\367\227"
+	.ascii	"\233N\330\364I]\263\335%"
+	.string	"\214\233\243\322\301\215mb\003\243\362\243\325\322\352+\276\027K\232\023\234\027\353\360\247\244\253\331\257:\260\260:\253\335\271GX\226\202b\246\334zh\266\263\330\251\273\247\"\315\366TGm\354\356\b\231$O\322W\334T\336\273\336+\0058\r\221C\023\255#/m\221>R\244\257:\270\227\251\321%\347\205\0029\361\036\322D\336F\3766\322W\"\256\363^\350]\365\2668\301\375]h\324\t\234%/W_\001\237\241\242hhh\bT\224,\306\35012\312H\201\303\310X\034J\021A\213\237\026.p\364\020\203\214\206\200\214\305\036d\221QO\317\215#rF\362h\024\n\r\211C,\020\215P\022Y\243\210&\td\204L\026\031\217\032\324\260\3111DTL\016\031\275\250Q\2234\022\201\220\304\022j\264 \3040\202\221c\210D\016s\204(\230@\002!\026<\024L \001\013$19T\354\200\370B\006\240\242Q\r"
+	.ascii	"R \nM\b\032*\032\305\340I\2018CqhH\003y4\332\b\335\020e\030\207"
+	.ascii	"&\020\207\206@E6E\306a1hh\302\361\204\"\"\021)\203\030\264S\264"
+	.ascii	"A"
+	.string	"\334 \b9\f2\016\2230l\020\203\002 \002\031\207E\3440\005\033\304\240\233\031EF%\330 \006\t\221C\342\220\0066\210A\255P\210 \3430F\320\220\270A\216!\"\242a\216\020\222x\343H\024\f\002\222\261\016oV\030\207\311!N\321\021\310\346@6\020\250H\"\207D*p\034\221DD\303\037c\261H\304\201\212H\242\221(\243}\004-R\264p\201Cx\027\025@P\001\004\301\273\250\300\307\247\202\026>\355[\370\254\311\237\025>8\212B\302\344O\013\237\341qH\210&\371\263\202E\322X\024&ip\321\017\216\"29|a<\026\223\303\344\021\371C$\304\223\274\021\"\006\375\344\334\030\346X\207\206\216Hv\006P\262HDSD\034\222a\034\006o\f\221+\362\230\004\"\332\370!\022\252Y\201Y\340\02689\203\200\037\211\210\310\236\344\361\210\354\2711\376\320X\213~l\020\203\222E\302\373\370h\200"
+	.ascii	"\n$x\320\002\251(\232\221\034\322\3501\036i\3208\002\365\030"
+	.ascii	"\213C\032=@\310\242\036\025%^\274\270A4\006\r\035\177h\004a\334"
+	.ascii	" \032\177h\004\233\254L(\247\271&\324><,\253u\354\352I _\227"
+	.ascii	"f\327\257\257L\276\372\252\367\230z\241Q%\237\213\266?0\\\177"
+	.ascii	"\267\031u\202\346\310\024\261\246f\327%_\305\354\352\342\310"
+	.ascii	"\250\332\025\354k\030\324\017.ZR=\030\221\233\373\002m\037d\322"
+	.ascii	"\322Z\273\272\340 \215\261\272\343\372\332U%\304\362\243\336"
+	.ascii	"5\273n\265\264f\254\312\023XP\007\026\326\232\325\336Ms\354\250"
+	.ascii	"v\\\224|\315\272\341\302\007\206\245\331u\332UU\246\342\220\234"
+	.ascii	"Y\217\254G\326$G\344\374\226\310\252H\276&i)N\225\020\254\267"
+	.ascii	"*\033\270<\256\267\276\252\252\325\212}\210\222\303\264j:1\362"
+	.ascii	"\325J\217\306i\207T\332\354Z\244\227:Z\356\266\2244\273\022\351"
+	.ascii	"\345j\344*\212\253\331uH/k\302d\365\001j\221Jw\230*\223|\351"
+	.ascii	"I\211F\327(.O\302+a\272\220\211II\255Q\2004NmHF\256\204\bY\243"
+	.ascii	"j\360\362\266\304YQ\262B}\215ju\240\245\001QS\362\266\203\313"
+	.ascii	"\t\nU\033"
+	.string	"\363\372\341L\263\2479rr\372j\245\312\330\371\005\202\213\250b\021-G\363\314\230\231\022\021\221$I\322\001b\013\020\004cQ\034\347\314\003\022\240D5\222#\305\214\314\2104EIiX\003\020\222\034<u\270\037s\324\214\336\021\256\267\b9!a\353\317a\300\023xkf\336\306\334\302ua\026\035\3258D\332\022\372r\240B|nF\355\357\020!jS\033\216HN\b\031\233@\031#\353\007\235\265-\267=\360\003\265L\302\3559\245^:\264\325(i\350yA)Y7_\357\375\007 \361\252\351\346\214\206\\\322J-'\255\252\334\\+<\260\266\322\320J\333\333\213\032)\344\234\226\365\240\016=Y\350\323{\337\020w\305%\212\0326*n\250\276\b\255\261\304>j\310\020,\036\001\017x\273\375\004\202BA\210+\007$X!\363\301\227\237F\332\261w\260>\026\261c\202\335eP\013\206\216\\\230jLoa\347"
+	.string	"o\251\007-a\223\362\267\351Y\251\261<{\275Q\301\006c\260\217u2\267\t\317M=\017\214*\241\210a\261\336T\356\003\325]\200\177\353M\363.\247\007\234n#\222\374\364\327#\023\324'\234z\353\265\301\007]a#\251b\352\345+\002\307\n,\356\2753\334I\277\300\\\363\200\022\345\030\270\330Tkd\024\201\351\217<\022\004\033\341\021\021\202\006\f\320R\264 \017\r6\242\246\241\016r\366\222\260\347\302\333&\216\204\005C\352L$|\025ay\221\250\230\336{(i\004Q\243\350\300,\024\310\221\203=\365_\342\226\354\252-"
+	.string	"\377\307|%Zp\305t\222\230\241\336\227j\214N\233\205\335\334b\020\361\177_>\374\351{\036\004\250\246D\325\331'|\260P5l\344\364\265)Mb?\216\373\026%\001\t\251\244\310\376T\200\3765\006\207a\022\023\202F\304Y5\244DI\030\232\247\355\265T\330p{\362\236 =\340\006\006\016\222\021R\207?m^\033\340\341\325\344\007o`f-=\226'"
+	.string	"\312\030(\227\022\314 \207\326\260\351\004\006\255'rE\257\224\236l\335\001D0\027O\377\304\342\264\275-\367\364\206A\b\222\022\213\254.\232g[L\235\350\245\276E\003\233@\221\354\312#DF\201\336Y\204\330-1\275\343\250gX\342\211\034x\320\001?\320\003G2\307z\271\232\357\363\\\331\240f\251b\312\206]G\330A9\223\334L\376(\236\364p\206& \264\244{\025\315\222\332$8\246\343ZQ{\215\022\234\360L\261\343(\036\331\274\200~\365Z\2609\277\336\364M+\204!\264\324\2379n\026\020\247\232\020\325\317\277-|R\362H\256\302\374\377B.O\007\336\214\263>\347\266/\321\251\314\361\276\256.F\022[\236\223T\027\252\231\372"
+	.ascii	"\336\371\352\032\224\330\273Y\340D\024OK\212D\250#nT\371\352"
+	.ascii	"|$\307\306\312t\264\321\352y0\311\371\to\322\234'\205D\270\232"
+	.ascii	"R\367f\371\rh\315\207\337t!\na\026UO\3419\267Qi\222\311\374\357"
+	.ascii	"BWG\036\347X\217\337E\246\311&\331\\\246\037\361\271\270q\240"
+	.ascii	"\nRC\312\336\031\204oV\027=Q\310\243\300\016P\017\335 \307\030"
+	.ascii	"\206\355\353;\265L\341\242A\200\224h\310\275\200\325\026\247"
+	.ascii	"\201\004\333\366e\233Ap_\241\005\266\024\226#\001t\022gI\326"
+	.ascii	"\314\021\344P\"\3722\365A,\013+\261\344w{\207=Z\357\356Qd\216"
+	.ascii	"\341\t\3146y?\242\254\023uB\230\201B\362=\243\261\211\252\203"
+	.ascii	"\017G\340h\241\004\234\366J\214c:\350\307\315\0052\030\316\013"
+	.ascii	"\207\002\266/\357\373\226\267\376\303zP\362\"6\304\263>Cs\013"
+	.ascii	"\214\317\227\227(zw\365p\314?\304\376a\263\231\2753\212\351\224"
+	.ascii	"k\266\347\3549\366_\223\203\345\337\350\201\365a\267_\237\223"
+	.ascii	"\206\346\360w\005\f\310#\002\3123\024\216\315\374\333x\215Ok"
+	.ascii	"r?\212\313<\027R\031\273\375\nBK8\365\277\217\032z@\255\344\370"
+	.ascii	"\356\004Z\325\331=\314<\330\213\300\235\213\017m\337\f:\006\013"
+	.ascii	"?P\353\353\371/\370\207\270\351\360\274v\351\033\254\235O"
+	.ascii	"\376@\376\001~hNk[\367M\345\257\327(\255\274\241\372\262\177"
+	.ascii	"\2546\036\363\016\341\363\370\312n\312-+\344\003\371#\215m\275"
+	.ascii	"M/\206D\326\346\363\207\203G\356\013\377\321\344AM\321\230\220"
+	.ascii	"/\316]>KM\374\201\335\240\317\231{\343\273\371\272=.\271e\007"
+	.ascii	"\361t\340E\3241\300+\034G\257\275\0234\004\337X\213\3362)\200"
+	.ascii	"\256\r"
+	.text
+	.section	.gnu.lto_.symtab.95ae23817bf42876,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"applyRotation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.95ae23817bf42876,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
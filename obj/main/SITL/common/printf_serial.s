@@ -0,0 +1,393 @@
+	.file	"printf_serial.c"
+	.section	.gnu.lto_.profile.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"D\003;"
+	.string	"\005"
+	.string	"\254\277\363\246\017\002\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\226\266\306,\003\376\220\273\353\017\b\002\001\002\001\002"
+	.string	"\002"
+	.string	"\002\003\002\003\006\361\201\277\304\t"
+	.string	""
+	.string	"\003"
+	.ascii	"\270Hg\336\266\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\350#"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\002\001\001\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	"D\005o\ti\003X"
+	.text
+	.section	.gnu.lto_.inline.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 \347\375\003"
+	.string	"2\306\024\037\220)\351\017\211\020\227\210BC\375WP\201\342\355\254\2554\035\273\273\213\232\374]7E\266\224)\237h\253x\376\232j\354\374\203eo\224\366;\024\204\341\250\004\020|L\026\021BaL\2359J\243$(Nfy\003\333\226\374\017\267\275\246(m\001\177\226\004\020"
+	.ascii	"Q3`\n\327\211i\340# \307s:!\240x\016~\231+\270\321\312\342S\305"
+	.ascii	"\370\271\007\250\305T-2\213p\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 \364\275\003"
+	.string	"\002F\022\034\260%\351\f\3400\005/\017\303J\205\212\034{I\222\005\226\024\027\254m\273I\"\223\f\253\013}9\004H\266\002\t\263\033m\017fO<\342*\2406\364\206\370\f<8\237\020\213<\367\342b\317\356ykY\006'x\256S\004\021"
+	.string	"\020\023\204\314bj\022\224\223\0308d\004f"
+	.ascii	"`0S\020\206\215\bs@\347\376\230\026L\005\360g\t\230i!\312\216"
+	.ascii	"\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\230\004\003\270\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 g%\002"
+	.string	"\244\002U"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004"
+	.string	"\002\002\001\002\006\001"
+	.string	"\003\003\002\013"
+	.string	"\001\002\013\001"
+	.string	"\002\005"
+	.string	"\001\002\005\001"
+	.string	"\202\f\006\005.cO "
+	.string	"\n"
+	.ascii	"8\001\340\216W\331\322\f\356\346E\315\273\027c;s,6\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.a04fd8d5743cf560,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.23.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\265\007"
+	.string	"B\21766Pm\323\001$\203\310\312\352V\251\226#\242\201T\3218\250\204\2011J\227Bk\332<\277v\347o\013\347k\006U]\263\221b\257\257E\303\223:\031\265\337\233\354\235R[\245\f\001\276\254\007\fV3\233\006\207M\303\252fj4\313\35055\f\223\315\253n\246e`\252\311\324\271QZg\365\355\247\215\236%\007\351\023#\f\243\037r\221\216\237a\b\016|w\351s\250KK\243\303\342\003K\366\347\201\361\302\376\264\273\353\350\331\027\375p\252B\027\222]\212R\312\222\244\311Fe\373\320\276\307?\270\213:\037\330\365F%\273\037\202\023,\227\376~\241.-'\240.\315\331'\005\022\002\243\211\021\224\335\235\021\343\334!\347\037\344"
+	.string	"\035\310sXY\330]\303\016Tq\307\333>\260\255`;\024\t"
+	.ascii	"\3202P&\264\356\005&.\024\202!\227`\233\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_tfp_printf.24.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375`\337\001e\021"
+	.string	"\326 tG\360\262&\035P\341'T\025\355\367\261\273A_\315\272\205m\222V-\353\3403\247\236\324\252\320\264\201Fk#\332j\261\254\006\017R\315`\356\275\312t\272\304\233\235\315{\177\342\\)\375\3317\255\253\352\264\023D\366\2262\245a"
+	.string	"]"
+	.string	"`"
+	.ascii	"\0270\347\213\007\307\2340\005^\300]\032\306\375\305yT6\020\204"
+	.ascii	"VL\321\303\306\207\310\234\263;\271\311v\031O`\273\\\024^U=\312"
+	.ascii	"U\225/\033\022\272V\217\001X\340\\\306\221\326\215\n\022\027"
+	.ascii	"+\256\020\325~J\\-\335\317\216\342BH\350\302\271\216\264\314"
+	.ascii	"9\255\241K\304\275\3356\3116\213\255\f\002\255]\331\260\225n"
+	.ascii	"\216\375\025\035\242\232\367e?v\217\016\373\271M\035\245z\243"
+	.ascii	"ZW\375\222\317fV`6\347MQ\021\032!\371\263\342\261_\246\362{>"
+	.ascii	"3\211=\343>\252\313fZj<L\224 Z\b\007\334\345\r<f\2408i3\236\030"
+	.ascii	"\241\203'\345\322\r\270K\265\037\3432T\207u\b',\240\007i\230"
+	.ascii	"\340\342\262]\356\036H\213\3079\347\\\233(\205\n\264\241\032"
+	.ascii	"kW\036\240\017|p\373\325\265-\274\350\303\321\236\330\334\306"
+	.ascii	"o8\b\251T\332.u\001\3704^\303\344\357\370\202\247\017/}o\273"
+	.ascii	"\374\352\216\235\0220H\320h\221G\232\362\323>;!\370\020\332_"
+	.ascii	"\006}\350\203\320\031\252\005\244\r\2122\245R\036\310a$u\202"
+	.ascii	"Y\227T0\220<\320$\363\002\223By`L\207\372N\247\257\324\241<\322"
+	.ascii	"\251+\2012\235J\002\1771&\260K}\037\330\221\300\346\3675\332"
+	.ascii	"\363\020\242\331\032\317\3049M\260\\\366\327bZ\0247\307\377\316"
+	.ascii	"r\264\\r_\226\331\342\202=?XJ\344\003\272kG\220\240\017\343\006"
+	.ascii	"& \240\002\021\301\344\001\321\300\312\033\355mC!\245:\325`\273"
+	.ascii	"\313Z\234|\226\316\275Y\024\033\301\200\304\211\360\324p\025"
+	.ascii	"YgQ\fX\220\306\306\273\274J\353z\225=\031Kb\321IC\031w\n\312"
+	.ascii	"\301\322\303\212\250\357\024<X\370w'\035\324\304z\fS\332\204"
+	.ascii	"kZ\347\352O"
+	.text
+	.section	.gnu.lto__putc.25.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"m\t"
+	.string	"v\023C70\221\322\001\003\023\222\237\252\026\304Z\206:\306\371\"\204mS\301\232\256\313\260fI\b\243Af$\301\367\321\364`D0\260)\376\230\213\245\207\310\t\266\332o\233H\231R1"
+	.string	"4"
+	.string	"0"
+	.string	"\235G\207'\330<v>\260y\364g\303<\374X\007\031UJ\314\356f\352\361\357\371\3717\271\007\\\241\236\234\207\335u\202+\215[o\033\3016\203\375NN,}N"
+	.string	"KA\313n\306\213f]q%\304\366?\2665m\205\206\357\241\205u\227C\245\265\273 /<\355\217\234\344{\211_.\260\313\022i\355\206 '\004\007m\200\241(\373'G\251\360AL\341\345Ao\363\250\352\331\270\246\036\323+\204\213\252&\225/;D\245v\330\307vw\255,\373\341\217\305\264j\006\332M\267\026\232\020\221\272\221\027!q*\221:SV\342\266\215\323\262\022I\264eZ\347e\241\003s\246Q\227\2358\256\313>\341\036[e9\316\270Rza\200LU\2657.\003\013"
+	.ascii	"2\241\031h`\341Q\022&\242Kx_F%\327\330Wa\260\202\n=\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_printfSerialInit.26.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 \353}\006"
+	.string	"R\f.3`m\322\001"
+	.string	"VX\013(`V\310\345\033~\275\234?\310\221\377\233\025D\226\340\003W\315*\273y{,\352\203 \020\330\177\366lYM\351\327g\211\334)\005\235,\f\027\nb4\n\013\033\213\202\031g\275\252z\223\263\250K\345&\250q\226\202\276\f\006\272\315{\320U\262;=\225@\237Q\210\223\021\2454{48\004\374\034G\347\366\001\2429v"
+	.string	"\2041\nI$\326fX\313\214\326\322\3777=m\"|D%\004!\277\305\211\311G(\"\034m]\351\325\2228\333\270?(&@D\377]j\370r\273jwX v07\200\204\377m\261s\341\246\333\032\264=h[\021\007"
+	.ascii	"2\003\346j\006q\241\324e\220\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"e\005"
+	.string	"\302\207\035'\200k:\034\216*\003\320v"
+	.string	"\001#\321t\210\300\207\031@\2140\346\266\201e\340\330\254Ml\333\346Zj\321\215\310-S\335P\372\177\213J\004\0052QS\t2\267A&v\200&f\312e\b\303\223\2053\2055\374\337f\243\204+\210\360\343\035$\232!2e,\033Q\250\340\306\343\336!\030{\331bw\353\232\332R\3478\017\247u\373\301\240\364\377\225\035\257-^\002\025"
+	.string	"K\215\202c\233fY\215\260Mh\236\031\006\250\007"
+	.string	"\007"
+	.string	"\007"
+	.ascii	"\207\017\020\002\227\026X0<{@\240\254b,\204E:\361\355\212\214"
+	.ascii	"W\001\2419T\031"
+	.text
+	.section	.gnu.lto_.refs.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002\001\001\001"
+	.string	"\003\003"
+	.string	"\004\002"
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"\001\006"
+	.string	"\001\006\002"
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a04fd8d5743cf560,"e",@progbits
+	.string	"(\265/\375`\232\022\005["
+	.string	"Z\230\364!Q@\220\322\031\016J\203\034\316\201\036\205n\233\020\001C`8\214\310\213\242b\202\361hh\353\025\251*\344F$%Bi\b\"\234\334\032[\322\b\037R\021\211 \375\237\224\266\207f#7\342B\035,\231\232\346"
+	.ascii	"\2235Ai\364D2w}\277\365&R\246\320\001\b\002\021\002bZLk\t\236"
+	.ascii	"69\264Y\203\226\376zC\374\336\306O\2744earp+j\344m\312\326\335"
+	.ascii	"\332\255\r\364\003s\013\222\345Hz\3262\263u>i\230\320\204\271"
+	.ascii	"2S\265dv\270p8\025i\332\271\243bM\236\036\362i\313"
+	.string	"\024F\317K\351\227M\372\245K\277n\351O\226\364\3370`|\316-\2619F\327\313\272\355Z\300~\351\035\305\332|v\332,q\273\242\222~\013\370m\336\026\360\373>IG\254W\372\335J\277X\351b\331,\273\006\355\332w\207U;Nr\355'N\2303;\312\030\375J\245\337\240\237\317\006\375\2767\322\021\033\342\207.\210_\212\266\r\201\266T\316\320\032U\252\004a\364F\264\237\375\274|5\031\243\377N\371\236\371\0201\353\322\203\321-[\263<3-i\214\356\223\205\262\253\211\215\362\225\262:\334\207\\{\355^}x\b\233'c\214\376l\210\037\257\220~M\374zyyk\342w\273\317\375\307\321Q\023\222\305\306\350\201\351]\244_\027\304o\307R(\037\3109F\337\"\375\256+\366\357\222\365\332\260\236\362F\263\313\272\327\0179l\212\260\3411\032\3667\360\300\311\354t{u7\001<^p\214iF\277L>"
+	.ascii	"V?p\237\364\234\376l\335\020\277tA\374\376m\341\205\377~\216"
+	.ascii	"\341\337\nh\234\200\377/\256\363s\b\377v\340B\t3\376-\222\241"
+	.ascii	"\376k"
+	.string	"d\374w\203\003.\342\347\026\216\376<\374\267\370\357\321\277*\374k\302\277\036\374k\301\277\023\374\033\301\277-\376e\361\257\212\177\031\370w\201\177\005\3707\201\177\021\370\267\304\277?\377\215\376\r\361\357\210\177E\374;\300\277\037\376\003\375_\373\357\313\313\313\313\373\227\203\277\207\363\373<\020\375D^\245\311&S\251\245\311\374Q>\221Le\022\213\371\001\211\026\021-4\030\361\022\267f\224\311nb\252B.\177\332\224k\263\305to\331R/KtW5\227b\220P{\246\324\326\244$\005\331\\\001\230\224\262\232\235lSr5\273\271\224b4\223\212\343\332\3266l\333\261GU\337X\352\036\200\251\373\270\335\326\335\307\356\276YV\255\335S?J'\023Sw\024\020SW\035\321\226\272\271\f\356\214\251|f5\205\320\310\236\316\226a=\256\263\305`-\323\3471\254ot\367\236I\235\314\034u?|\350\340\351\360\326\334#"
+	.string	"\035)\036Y\346\240\262\260|\226\350\370\241\265z\341\240\255\301\241\206\253\246\035\336\335\327\216]\271\371\263\025\3638\333N3\200\034\263\034OC\030]\240\005\361\023\022:\357"
+	.string	"\361[F\255\355\263L\326\204\251U}\216\217aI\260P\361T\327\220\205j\345))\224\371\214;\213:K\345\211\221)\303(C}.'N\310\324\022Fo\307OLF\313\016Y\214\262\016\256\341\374\3049\232\237T4\273\221\374\344\323C7\322g\227\304.\tTI\326\026\224\037\372\036\216\364g\034\314\0362bqGf\236\227I\204"
+	.string	"Qc\224\235\200|]\316&O\214\276W#m\342d\2538\215\t\241Sc\263r\246m\341\341\274\022\344\215\212\356\013l\237MnD\326\312/$\267e\240\2701\321\3059\321\t\241Y\274\034J6\232\220}n\311m\310\230\325\322\223\374\351d\326\224\323\201\177\323\270\354h\313\333.\033\206\305\322\022\207\006\267\252\375\332\274\355a\331\364V\347\215\223\254\255U\373W\f\334j\351\205-S'cRt\335\353\177>\362\f\\\203\233\230\006\276\301L\254\304H\266\301In\226\201\225\333\206\227v\335\274U\363\345a\327\034h\355Nv\367\327\353\027\332\274\245\3333\275\260e'}\034\r\250!\367\244\006\257{U"
+	.ascii	"H\201\236<\225S\205\315F\027F\231-MZ\205\001\253\222\236\235"
+	.ascii	"\255\234\361\232\357\253[)\305\252$\246\225QA7wh\200\200\311"
+	.ascii	"r^\323Q\"!K\202\305\327\004m\355\016\313\225\235.5\33241z\205"
+	.ascii	"\323XM\207\316)\217\271\303Y\017\272#b\351}\\)S9W\241b\345\003"
+	.ascii	"K\013\355\307\271\201\022\206\312\311\350}@\322\373\236\310\310"
+	.ascii	"\330l\305\332i}\360\200r\342\351\2101k\022\344\311\331\214\245"
+	.ascii	"\234=\t1c\224\2450Ga\035\316R\030\312Nre)h7r\227D\317.\t_\032"
+	.ascii	"\021\344\330\017\275o\231\336\216\313v\326c\223)s\202S'\027\227"
+	.ascii	"\354Q\242r\002A\223>\354a\374\004j\366\3004A9\273\272\243\202"
+	.ascii	"\3204]n\030;?S0x=\314\300(\213\261\021\036b\005\352\310\262\361"
+	.ascii	"e\335\311M\021\003\006\306LvLi\305\205\307_H\2128\335\356\314"
+	.ascii	"\204\214\317\013W\021(j^^\237\003\372Y\223c\\\234:Il\234\375"
+	.ascii	"\210\242D\tk\365\224M\344\025\213%mn`x\335W\026\330\344"
+	.string	"Y\223\260,$H\270+\355\025\216\013\217\323L\026T\222sW\332\317i\r\356+\213\307k\353\215-jk\213\271~ZI\356\n]GE\005\351\220\261I\341:r\346\312\371Au\3642\202\323vwWf\3447\364\2564\255\ra\247\236\212b\005\013;W\315\216\225\217\2517F\217&\211|W&\302L\240\265q\234`\266\\\027x\357L\312C\244\356rP\301\315\245g \034\344l\303\177\033X*]\333\251\205\032+.\274\216Z\006\275\367L\317\377\257\221\313\356\306\341[{\251\264\363\365\355\006\375<\333\333\022\335\203@\256;\211\026\232\364\310\024$\325\210~W\367\361C\257\275T>\261\216\312&^\230\037\326\276\n\240\237=Z\271b1\321fs\257\275\235\304b\266\240\\\233K\345\332<\376t\262y\354^\231?\3122\344q\225O,\246\362\331d~\350d\037\003E*\322\260\230\004T\207HC\035\265\030T\215"
+	.ascii	"\030\215\302\241\241\340\017\005!\023\034H\301\247\006\217\212"
+	.ascii	"\304\242\021C\030A\340\f\343\013\306\037\025\202*\020\310\343"
+	.ascii	"\002\261\030C%\"\335\024\005\205F(\021\222\020\030\234\001D\032"
+	.ascii	"\252FC\0310\200\300\037#\"\221\002\240\357\0055\351\350\002u"
+	.ascii	"xdD\n\026_\030\207\"\204\352\260H\202\216:D\322 \3511N\210(R"
+	.ascii	"e\020\211T\243\0160\251H\315q\241\n\215 B\370)\362\275\304\220"
+	.ascii	"*#\t\350\373\320\260(D\022\252\220^\305\n\006V\260\240qs\026"
+	.ascii	"-R\264H\361;\213\026BB-V\b\245_!\324S\215C#`p\306M1\030c\bU\037"
+	.ascii	"\343\004\ncQ8cX$\"\340\304$a\021\205J$\026Q\350\024\205\303\242"
+	.ascii	"\241\212$$\032\346\030\201;#\250E\242\213\037\241\021\214\340"
+	.ascii	"\213\031?!PHD\354 GHD<B\205\300\017\324\"1\211\307\210D\034\252"
+	.ascii	"I\304\033\241\032\004\201HF\020F*\204a\030B\252\002Y\334\250"
+	.ascii	"iq\207((\314@\0056\340\200\3210\370\242(,*\222A\001\rug\306P"
+	.ascii	"8$\004\001H\005\256\020R\221\2062\322\234\240\032\264\200F\261"
+	.ascii	"\247\250\272\320 \304\205\204*\030!\202\007\030\244C'\214\202"
+	.ascii	"\303\242\320\b,R\221\206\305$\024H\304\243#\342\020\n\244a\360"
+	.ascii	"\b\305P\321\210\342\004\t\026\206\2020\214\214\202\025\b"
+	.ascii	"\215\210\206;<\324\355<\327\"N\324<{\354\254\222\374\3003K\325"
+	.ascii	"\244\351P\223f-u\263:\362\345\356\r\n\315\0207;\255\2724\037"
+	.ascii	"8\320\360\334U\2165O\030-\363\227\341:\240\264\277\306\306\320"
+	.ascii	"\201i&J3\347\272\036\264\234a\224\351>\227\323E\305LNa\271\242"
+	.ascii	"CI\2331\347\2701<\347\003\353=\221\261ea\271\363\\\017\\\335"
+	.ascii	"Q\211\321-\260\036\\\030e\270\270-[\370M\202\325\r\254\353'\247"
+	.ascii	"4\203\263\313\371\355\034\306\311\262K\324\027\006\363\343\354"
+	.ascii	"\322\rK\256\276\244\354\205\335\226\306lu\371\330L\340T\221\232"
+	.ascii	"\313\313q\256\321*\302(\267}n'\t\306d\007\243\314%\201|\250\201"
+	.ascii	"0\246\230D\"2\"\"\"I\222\244\003a\005\204 g\2413\017\022@u5\315"
+	.ascii	"A\350df\222\0242\354"
+	.string	"w\260\245}8p\263FDZ\313IjU#\0014\3023\345\224D+\001TF!ai\376*\2769X}{e\020\276?@\313bO`\363\"\237\224+\r=\301\305!\214l\026\362%\200fj\021\220\n\305\365\342\355\236\030\300\205\371\233\034)R6\363?\307\353W`\3419\032\204\270Y\350P\nw\276\253\337\256\367W\357\365\333\365\346\333\r\t\313\313\260\262\204\221h\006\273:\217K\017)\227\305S\\f4`\013?\240\333\321+!_\230ir\334\027\346\315\237\003\300\213H\300M\216\020\326\326\026q#Q\tK\326$\2326\374Xt!\260\006\230\364'\322\262\326uh\201dvuiyA}B\300\342w\231\315\370\207\360\333\346\026\336\372p\310\361\336f\223\232D\275\325\211N\370\223\252@\313\2326z\201\305\276\034T\230\254:U\211\\3B\270\351\037\246egn\306\372E[r\003|M\371\366\tf\342"
+	.string	"\253\221UL?x\307\206\3466C#\347f\277\356\222l[\345\240nc\f2\260\206\303\006\267\332l\324\313\204\332\034\363\013\312C\352\300t>\274\017\351\t\207\343\323GU\217\300\027\300\230\354K(\225[U\221`8\223\2759\246\277\302\376\225h4\201\324\240!%G\374\022\255\023qR\243\332\234\351\030\3728:H\024\274\264u"
+	.string	"\tD\277\377M\321I\202\223\311\025!8\220(\001\245\226\002\222LD\032]O\023u\346\274\337_dX\217\272\312\376\255\370\001\376\310\003g{\340\365\362\253\020\n\376\210\031W\260m0\350\004\305\223M<\2262\327\312\364\002*\021\333{\335\202?\210B\240 c\020\340Q\022\365\035-e\016\331\212\356\254\267\235\240\002\372\304)\257\032\273\220`me\177\231\221\334:\345[\247\006#"
+	.string	"3k7\261U\260i"
+	.string	"\335\241i\231\234\264\255\241\214\357\355\214\233a:\250\231\220\224\212S7\340b\207d\337\001r3&\005|\202\377\361\274\001\025\302\033]\277]\200>\343\272\231\t\255\263\\7*\034iE9\347P\226 \303\302\366N\004\003H3\246b\b\240\221z71\342Y\306\206g&\177Q`\361\"\304\024\371\r\007\220\017\303\322E"
+	.string	"\251\262c1@g\212q\354\021'7\340sG|\262\354T*\235\306\235\266\037\364y\235X\330\346R\264\003\220\214MY\035YJp\200h\024pH\270\343PR\354\021\343!\352\312\321\347l\247\346\351\003{\223\255-6E\265!gmo"
+	.ascii	">o\377\2033\343\002\311{t\200o\271\365\277;C\327\034\013\334"
+	.ascii	"!6\227\027&+\270+\245\n"
+	.text
+	.section	.gnu.lto_.symtab.a04fd8d5743cf560,"e",@progbits
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"stdout_putf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"stdout_putp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a04fd8d5743cf560,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,250 @@
+	.file	"stream_stats.c"
+	.section	.gnu.lto_.profile.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 ~5\002"
+	.string	"\004\003r"
+	.string	"\003"
+	.string	"\266\346\200\271\006\004\002"
+	.string	"\002\001\002\002\002\001\001\364\317\246\251\n&\002\003\002\001\002\004\002\002\005\312\327\317w\004\002\003\002\006\002\005\002\006"
+	.string	"\b"
+	.string	"K\b\260\313\007\f\003&C\005H\025\200v\301\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 ?m\001"
+	.string	"4\0023"
+	.string	"\003"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001\001\002"
+	.string	"\001\002\001\002\002\007\002\003"
+	.string	"\004\001\002\b\002\005\020\b\001"
+	.string	""
+	.string	"\004\003"
+	.string	"\003\020"
+	.ascii	"\271\030\262a\001"
+	.text
+	.section	.gnu.lto_.inline.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375`\277\001\355\n"
+	.string	"V\2201.`E\223t0h\3601\330#\003_^\021K\\\232\b\017"
+	.string	"\026\032\242\265~\205@\300\n\360\bx[\267\326\231\030\206\257{[C\233H\222\002%"
+	.string	"&"
+	.string	"%"
+	.string	"\251\3224\222Erx9A4\016-7(\242\226!}CF\375\016\233\024u?a\333\222\237*\314\264u^\315\212\366=\346=\346I0\351g\212\212\3322\3463!&\205S\325\005\001\324\004\221\3321\300\364\217\364\243v0\t\020\200:\252\255\204\372V\202\344\t\004\203\210\275V!\312 \313\351\267\240[\221\263F-&`\236\251\262\354\274y_\212\276I\377\333\301\346\300mm\266\246Q\332|\3043\216ai\034^\036x\321bn.\364\247COm\3324(E\250\3418\253\030\023\333B\215\326@\002\202\0343z\021\2401R.'i7b\304\376&\001\2241>~&\333T\362\r\307+\343\277M\343\251\364ZJ\350\217\b\017\216(\265\017\317\\\354\003\344\301\273Rl0\343\354\337\017\360\345\342\031"
+	.string	"NE\316\210\"\373\265(\r}\200\352b\f5\n\262$\374\352\374\005+\233\375\203p\272\241\f\335"
+	.ascii	"\262:\214r\305\325\003\372m5\372\267\030\304\244\211\316\343"
+	.ascii	"R\225s#\021\326\2430\272cBC\205\307H.;P\251\3636\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 _\025\002"
+	.string	"2\304\f\025\300%\035?\350\377\007\376\367~\375\366\373\226\326"
+	.string	"\333\355-\223\f+n\236\001;;<'\344\035\305mbn%\225M\345\275R\t,\300\316\026\377lf\004\004"
+	.ascii	"@\004\315{(\223\274\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 \360\365\003"
+	.string	"\022\205\022\036\240'\351g][5\316\230_U\375\251\277\375[um\365\350\346\367?\033\3447B\210\224)\037\020\t\303A\200\366\2029\366\313\325\217\211`\306;\263\0055;\320c\030\221\244X\264\212\220A\021\342c\316\357U6\312\345\344w\004\024"
+	.ascii	"8\001R\231\013\245\375\270e\206\r\220:@WN\2302\242\332\336*\224"
+	.ascii	"4!FTQ\236\272\223U\002\251l\311\314\300f\352.m\275<\202\201\""
+	.text
+	.section	.gnu.lto_.lto.c777e807aca9604f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_streamStatsInit.3.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"M\013"
+	.string	"F\025NC \2518\035X02\276$B:@\tZ\032"
+	.string	"\346\222,-Y#\327%h\341)\217\025\355LSC\210m\224-(\325\bo@\310&"
+	.string	"4 \tu\0272%fB\221\377\254\261v\350\017\375i\223\275S\n8"
+	.string	";"
+	.string	";"
+	.string	"d\003\007\273%\2063\264W\227\207\310^\265s\262W\217\266\204\b\023\006\025J\213\302\356nT\300\307\317\321\177\353\031T\252\364\211\351\330]OTj\345\246\267Ma\333\303\376G\345\217}\365O-\323\302\231\260\253\362\262\260\256\372\240\200\355klS\004O0\236%\232\233-9\245ph\257\233I\247\255\2611\276\034\231\356\276D\360|\332W\375\300\370\025\351\016\273\001\0060j{_0\322v\327\343+ \371\032\006\020 e\257\027"
+	.string	"*\270\230\346\313\230)qC\310,>\251\035\216\314\243\374p\301uBKvY\2324\200}lw\327\224\264\317\372\263\007\241N\f1\021\324q`\027\302Ts\235P\374\210!\210\367\351@1\334@\237\347}\334\006\n\371x\033\007\206[g\302_\250\0037\361\373\300MS\356\261\245\244+\213\313DO\316\250-r\006\242\n2\022"
+	.string	"g\221\"\023\217\301\321\340\002`T:L\357\022\254\211\314\214-\342\032\273\017\363B\370G\030\205\313 a"
+	.ascii	"0\"@E\twx\321N2"
+	.text
+	.section	.gnu.lto_streamStatsAdd.4.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375`\326\005\365\033"
+	.string	"\026\256\241H\260\030U:\200\246\316\224\262D\037f\013\033\t\310\"&\025>8\213\013\nm8\327\250\350\313\324\321_\037Y/\367\327FD\r?\3501\223\376\223\362\312fK\bOQpy\261I\022\227aE+)i\204\020\262\267\2242\005\216"
+	.string	"|"
+	.string	"\224"
+	.ascii	"\374\257\216\335A\333\235\2105\325\232#\244H\255<\004W .=o\001"
+	.ascii	"\200K\305=\201KO\373\253\b(!\nr\353\271RkU5\214\245-iT\212\310"
+	.ascii	"\320(\206 \235\315\264o\0303\316\340d\2264\272\261\341\322\005"
+	.ascii	"\213\310\233\026\034\312\361\320\260\340\361\006\206\207f\005"
+	.ascii	"\213085*6\234/MhT\334\030D\261\324F\342J\360\fcpjn\266G8\022"
+	.ascii	"\363\245\326\272\275e\023\270\032s\030Sk=\317\340j\366\245\375"
+	.ascii	"\027\365\037\302O"
+	.string	"g\001\034\366\207K\254\2656\370\366Lx\2113D\200K\267\013\274\360\355F\360\357\347\311p\353\374;k\347\374\353c7\265\273\335\001\315G\205\374S\310w\t\371\246\311/M>i\362G \277\234|\321\344\223\223\037\232\374q\362E\220\037N>8\371\224\362\347\344\367\344s\363\327\300\002\033\nJ\255'~Z*\020=\262\363\177\311\377\314\333\036\264\3651\373X+\316\224\"\265V\004o .}\231\033\375\023`g\254\214M;\324\223\211\315Fl\260\307\006\251\330xj\374{\330b\357m\313/\254\017\206\260#\310\330\315\006\233\304\241\344\266\345\274Zk\210\366\342\364|\226\314hG\270\341\333\215\313\002g\303zRV\253\2045\233\301\n1\311\216.\354\206\365|\220t?\250\341\333\201\255c\004\200\003\032\276\334\322\326y\252\271a\275\037\"3\356\0074t\273\331\332!\020f\3504l\020_.\325\377\206\0052#\3058"
+	.ascii	"C\227\343Z\253L\337\005ng\350E!\301X\376\007-\020\035V!(=+A"
+	.string	"L\266\222\3050\270V-\230,\246\362\360r\271^,\225\207\r+\227\212\005\213\251\022\300\374\365\241\005S\311^/\230\212\344\325\235\265s$\340\200Ft\355\250\256\342ZT\323\024\277SO\261P\272\264\251O\2756\233\232KsO\205\215b\301\324)\036:\022\024\035\276R\2519(\250\347SzBj\332%\033\243\0265\251\303\262GAe\357\017\031;\262\357d\237\004\0245eb\263Q#\273|\361\273m)9K\016\021\020\001\n8t\241\346\240\235\336O(y\250q@'\021cDRF\n\nR,\006\300\002\021!\263:\0210\241BP\231\222\031%J2\035'\245\263\260\031\221'\275S\020)\264Y@ADdrnwr+\335\352\240%'\242\247\247\333=\2274\225G\356\261\301\b\341C\327\255\263\n\354\234\227\017\314D\346\310H/\316\327K4$\021}\302zo\243\333\215!$f\030\264\027\244\242\303\362"
+	.string	"\223\305\337\217Eo\242\023\3478\303A \037i\205\251\352\3640\232\254Z\304\366\360\222\345P9'@\340\247?\376$I\r\233\351\263\206\355\246"
+	.ascii	"t0\026\223\362\377\017\363\360\314\336\351C\357\334\270\231\302"
+	.ascii	"(\203\235\235\261\340\214\001\n \251-\274\210#f\227?\307$\037"
+	.ascii	"GR%z\r\f\372\271\264\234\017\302W\246{\360m\226\312\2619\304"
+	.ascii	"\271\211nYM\2641>|\271\217Q\004\020\312\001\342\214\253\265U"
+	.ascii	"\261\035\364\017"
+	.text
+	.section	.gnu.lto_streamStatsMean.5.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"E\f"
+	.string	"fXS>0o\223\016\210@\033p\213\337F\311`\355_A\270\3042\263\2768\211\267\212\035\024\227Y\377\206v\b\031!P\021\354\376,&#\"\251\202\331\307\2717t\244\314\335\362nM\332\336R\312\224\002C"
+	.string	">"
+	.string	"C"
+	.string	"\032g\272m\320\036\206\217'\344\305\356J\227\023xwz\001\357.5<\273&f\376$\203\304\002\213\217\266\271V\264\nO"
+	.string	"ZG/\273\373\021G\017\215\2038\311\330]\343G\243p\273\333f`[\201\375\b\001\t2\345\333\037\031\375\024\355\024\255\016\235\212\306D\277\362.\254(\220bwB\210dU\270\023\036lkl\213mD\373\037\027\241\371\306\361"
+	.string	"\273 \024&v7\004N\020\335y\213l\373 \036\"*\"\341\003\007C\316\324\274\247\344\231\351B<%~\360\022\024\346\001\016\307\335\335\2447\3363G@\\tp\304vu\022\033\321ng\201\017\222\271\242\016w>\307\273{\016h\361\321\201!{\333`f\260\257\033\0276a\2273\006\343\302&\354j@M\032\026vI\231\212\242*\214\224q0Q\022\306\272$\f\003\256 hX\022VU\226d\331\366\272\t2\242\237=LJ\276\364\260\375\362\322\221\034U\227\224\234\210hb\272\f\026"
+	.ascii	"\027\013\255\314\302PY\t2\334\222g\230\215\301U\274\364\200\235"
+	.ascii	"\200]\260J\302n\0043\227m,s\r\237Z`\t\"`E&\036\334\025\244\032"
+	.ascii	"\202\305\207\022\275]\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 sE\002"
+	.string	"d\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\023\005\177\024\001\006\177\025\377\037"
+	.string	""
+	.string	"\200\200\200\003"
+	.string	"\003\200\200\200\200\004\001$"
+	.string	"\006"
+	.string	"N\204>\3412\\\366"
+	.ascii	"\355\300;\327\232x"
+	.text
+	.section	.gnu.lto_.refs.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c777e807aca9604f,"e",@progbits
+	.string	"(\265/\375`\275\te7"
+	.ascii	"\372d\320\025G`\236U:\267\213\305\266\371\n\336\253\224\233_"
+	.ascii	"\230p\224\274\fG\003C/\334p\203\233\371\033\242\3204\263\r\033"
+	.ascii	"\030\371oo^/wy\005\223\026\365\223J\253\013\033\270\272#9\205"
+	.ascii	"\365I\306[H>\rR2\202\266L\001\033\001U\001P\001\357\314\342\334"
+	.ascii	"H\253R\220m3}\246\237L}\226K\313\243\005\305\352\177\354\233"
+	.ascii	"i5bZ\337c\357\304\336\004\333`:L?\217\326b\276\036\223o\206\342"
+	.ascii	"\265.\321 X\375\b6FF[/\202m.\335\245\2377k/o-M\366\\\361\315"
+	.ascii	"\316\234\263Qw\221\031va\365\036X\027\270\351t:\355\233\255\317"
+	.ascii	"\300*5\322\252\266\200\265\235\235\245\237I\r\375\004\013\277"
+	.ascii	"\r\303r3\347\327\210\250MJ\333\037\254\276\002\373\026;\0016"
+	.ascii	"\331\302\205\330w\322\332\323NZ\217\331G\033i\3255\322\212[\300"
+	.ascii	"\252\2236\322\372w\225\277\251t3\351\346\336Pfh\316\357\221\321"
+	.ascii	"ke\024\202\325\277\215\264\262-`-\360\337M\2349\377\337\374\207"
+	.ascii	"\363_\315\304\177\007$>"
+	.string	"\340\307C\377\345\374\217\323\t\024\220\030\372q\377\235\364\367\320\337A\177\377?\236\377k\377\305\374o\363\337\313\177\350\377\004K\377\367\374\327\363?\317\377;\377G\374\227\376\267\363\277\316\377\346\177\002\377\317\376\253\323\351t\372w\203\277_\374\254.97tF>2\3109Ky\204C\364\321eTQ\034T[\210\312~s\316\007\214T\\\312\\\214\272^\312\234\275\250Tdc\205\341\033\315]\035\035\n\311\3127f\344\214\300\230\363\260s4\347<\3149\343\216Yo\316X:\227i4\346\2344`\314Y\303/3r\306P9eH\327\311\245\344}\021s2s\325;lf\206\263<\262\316!X\276\221\207e\"w\340\301\352\033\344\003k\353\013\253\257s@2\n\016=y\214\244\354HC\347\025Z61\353\201\347h*\231'`\303;LD}\322\250\276\244Kl1\fY\023\253\177\333\351:EU\312\260|`u\315"
+	.ascii	";G\214\221d\223}7\267\220I\255\264ZG\333MG\215hhr\221\206M"
+	.string	"\260\320j\215\245\307\212n9\003\331\302l22]6\005*-\323h\035\205vh^\221\346\374\316i9M\247\337tZ\307i8\375l\265F\363N\323jn\340\315\271\330\315\237\367V\3531]V\224\313y9\306\3149\237\302\337W\336j\375\245\315n/\223\234\205h\005\bCS\243\n[\316\371\201\201\007\017\360U\223\347\030\235\332k\232M?\227\272\315\373m\260\007\021\337\374b$\201\306\260`\365-\203}/\255\267\351\264\227\326\270\n\333\b\300\304\211q\325\220\256\307'\025\033\256ql\243\313\032\314\f\332\005\253\337\203i\250I\376\034\341\3024\260\233\363\202r\025h\355\315\365\310f\22601\361\230\210e\2609g2fo\021\321\330\300\305c\031DK,g\025\254b\252n\033R\3228\022\246l\215\343\265U\205\325\343-\366\315\247\331\336}\336\007\347N\346\033\235f\2166\266\234L2\335\\5\261\256\351q~\035"
+	.string	"97s\316\trc\304\352"
+	.string	"\301j\377\351\266\234\213u\005\250-\220\320\2251\312dMH\311\0170)V\237\r\250\321\254fVkF\254\266\237\036\273\345(\373\343\205\325\357i7\377s\352\025'I\"v\330\343\177\315\304c\316YG\320\233\217T"
+	.ascii	"\326\016\352f\372\211\372\326\f\376\253\371v\005_9k\261\351a"
+	.ascii	"\235x!\376\300\352\177\245\374\257\234\207G\371\315G\327\271"
+	.ascii	"\034\272Y\330 \217\336\274U ;\205d\367]\"Ue\306\371\315\235\213"
+	.ascii	"K$\013\367U\036\335W9\324\345\242r\230\363\213\324\271P\342\260"
+	.ascii	"]\347\022\351:\225\310\243\\\314\303\354$n\261E%\322ES\"u\256"
+	.ascii	"\223\210t\213K\344Q\026[\221%4\324\302\244\364\226[\314"
+	.string	"8\214Y\304\243.\352\276\312\f'W\021!\005\360\027l\205;\337\211)\250\036\360\267\013\n\247v\004\240\240\246\200@) \256u\362\301\370\t\327\026RA\025\255\024\020\207\342\311\007\245\266>a\224/j\005>\371@\2348\261\241\350\275\366\007\374`\364\336/\350\003\372R\260\257\320\004\241\351\202\013\334/`\220\200A\302\372\013\030x<\fM<\366M\274[{\025\013.\265\302\027\334\265RR\301\335P\353\324\304[\341k\205\252\320i\004\021\333\002\247\244zA\300_\324\315\305S\324\255u\252\320\0245%\274\265N\023(\264\300\037\316\007\365\023j\235.\264\300\337\024\356<\036\007\245\022!<\260\275\b\302\366\251\025:E=\371\202\255p\007\224\212\212\222\352\355\200\277\247\250]/(\334EPj\201\276^\320\267\002\027\004kE\257L\273\260\212\215\307H#\326\272\245\001\310\303\260\234#C 2Vl\331M2\r\201\331"
+	.ascii	"[\223<\326:\316\232`\341k\354\027\2244\"V\361\217\027%\321\200"
+	.ascii	"\221^a\254?'\344d\2103\312\031{\bl\230\025\022\211U\354\343k"
+	.ascii	"\330k\355"
+	.string	"\306\035\254b\253\233\001H\252\261\025\351\221\206\253\r\025V\261\016\274\243\237?\303<\212\300T\215\235\211a\037\243\177\266\342\034\307G0@\206,\267\260?\306\361\347pZ\322~0\261z\374d\217_\\\025\200\264\250\301,f\2144#\201\224\210\310H\322\244\003\200\002\221\251\263y\021\2605s\"$IQA\241>\215\001\304}RJh\324\357\266\0225D\317\311\374\274\2005\227}F\261X \035\211\266\227D%\201x\250J\265,K\376?|]\310E\027vr-\032\n\255@\\\365\256Uc \227W\231b}\025\350\022\340\214f\323k\340\204[y\324\366m\f\027.\264\360\367\2071\024a\0046\203\316\304\375\033\206\316=\300\326K<\372\032\016\353\t\322s\206\310\310[Xi\032\036\251\245S\f\317C@A\341\271\275\310\236\021\232$\336\217I_\027\220f\031\275\274Y6\204q\251\232\375\266\220\260IxL\376\025"
+	.string	"\2167J"
+	.ascii	"\353\022\245mr\233;\237\227HE\213\022\033\226J\f\265\n&\241\235"
+	.ascii	"\201\375G}\242\226D/`\034\035\206A\216\244\2509\204\277P\260"
+	.ascii	"\240N\333\210\023\347D\031\340,I\335w\247\345\345\277$\227!\241"
+	.ascii	"<\230\233\255rB\2278Pr\353\353\267\022\327\366\261\3737\304\n"
+	.ascii	"\005j5\242\251\037\200]\302\200\374Y\273\023\035\344\035K,2&"
+	.ascii	"b\013\003$\256l}\201,\"\252\200b\302O\023\277r\256\236\310\367"
+	.ascii	"?\024\177\360\2617\356\357\034\311\023\355\307u$O\340+\342\203"
+	.ascii	"\033.\337(\227\377\257\355\313\270\313cC\315\241\300\332\305"
+	.ascii	"\310}\305\372j0KQ\005"
+	.text
+	.section	.gnu.lto_.symtab.c777e807aca9604f,"e",@progbits
+	.string	"streamStatsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"streamStatsAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"streamStatsMean"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c777e807aca9604f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
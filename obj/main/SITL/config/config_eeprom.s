@@ -0,0 +1,1339 @@
+	.file	"config_eeprom.c"
+	.section	.gnu.lto_.profile.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\261\001m\f"
+	.string	"\326\020@9@\217\322\030\347P\rb\222b\322\300%\227C\212\274^\36714A*!\243[\374\356\367+\333\201\3532\f\3030\f\317\365\024\335\305O^\rmB\b\341\266\233lBH\"20"
+	.string	"0"
+	.string	"-"
+	.string	"\322{;\036(%\344\222\024\003%\343\323i\332\262{\337\336\026A\320\213)\306qos\\I4\234\266\025c/\030\324\332\373\222\005\223i\255g\277\b\317\245\3137\357\b\013+*&\341f\371\341\006*\246\005\374V\253\031M\310h\367\244\253\\Jf\233\325@\243\212\320\344^\356\355JI`/\226\347\005\373yp\200\204t\306\307\272\241\302\214}\030\\\001\234z\275\276\275\242\330Z\261J"
+	.string	"TDqbQ\277\351\364\361q\\<\034|\337\277\267\013\353\355\335=\347\263S\307\347`^\022\245L\006]\370\341 \033\361\204\203[\277\007\r\022DA\275J\215\003\212T,)\202\345^\021\"3\003\233@C\"\t\004A\250\341\251\300\004\023\324\220\026$Ic@\002\245\224\225\035\0208\251\210\030\244\320\032:"
+	.string	"\355gW\314~\210i\307\363\264\027\244\234\221\2768\334\226F*Peer\221\215A\3279\361\253\002\226\3024-\f3T\037"
+	.ascii	"\244\361\3256\n\344~\222\304\3741H\020\336\343\007\036Xz~\361"
+	.ascii	"3\272_\306\211\021\266\f[4\327\240J<\3269\312X\342\260\030\370"
+	.ascii	";@\322~\373\030\373n\353b\030S{\343\330\3554\304q/XK\331\333"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\205\005"
+	.string	"\262\210\026\031\2009\351`\\#2\"#2\246\021\210\376\303*\017\302\326[\373\211\2242\005\377\376$\356\213\221\332*\376DG\374\207\246\033z\241\023\230\373\262\347]\320Q`o\345\265UE\206e\222<J[\332\266\352\220\036\247\3063\007\344\016\345\321b?r\035\300\367<\027\256\247\354\315k\004$ @\002\302\324\262\003G\312\330N\n\t\201\261G\320\326\240\347\016\031\341\006l4,\030\b\005y"
+	.string	"\317t?\212\206\006\367\032\237\3061k\2002\343 Q\360\202\3043\t\262\b\227%\256O\330%\320"
+	.ascii	"g\307\302U\216X?\342\271\345&\024\304\340\20657\004"
+	.text
+	.section	.gnu.lto_.inline.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\313\007\265\037"
+	.string	"6\351\220I\260\0226t\210,2-%\003v)\003\037\330\277\264y_\230\fm\210\177\022\270E\371\304\026\317\375\001\301\037\262\221)\375+\330jq\321VI>?\3240\246\2355\265\2025\260k\217\200!L\f\202i\357|v\267\335[\312\024n"
+	.string	"\177"
+	.string	"z"
+	.string	"s)D\361\202@Mi\356>\343t\025\226\221\321\200S\236\315\343\200\263\371^\263P\016\221'\375sN7)\207\310\224\317\357\354_k>\223\274\351\355\224\236\322\234\346\346\275\267\247\376v]\037\357\275\260\367\355m\303\357\267\256\357\275\267\376\032\356\275\276\277\376\347f"
+	.ascii	"\3150\035V\342\225\336\371?\317\022\352J\363\034v\336\315\343"
+	.ascii	"\275>\331\337rk\f\226f\376\300\372A\361\355-\257[Dy(\2029\355"
+	.ascii	"\272y\244\275m\33073\357\322\374\232\221\231t^Y\245\276\326\016"
+	.ascii	"x\351As\007\031\020\"\\\206a\315\2432\214\373\302\351\271\327"
+	.ascii	"\034\214D7`Nb)\335\315\352\215y\023eVq\300\023\030o\372\f\237"
+	.ascii	"\206\314]\367(\207H\234&2%\244!\200\342\314%\261\030d;\354\272"
+	.ascii	"\371CB\251\230o\373\316\365\006*\"\020>=\365Em\021I\376\233'"
+	.ascii	"\216\247\2121\321\315]\037g\262\330\2151\r=\235\320\311\030."
+	.ascii	"`\360m\003ok\350mM\007\261\261C\250)\314\036I\301%\337\362\361"
+	.ascii	"6Gos\r\244\205D\304\367mg>\363\2665\255\205\024$\305\264\347"
+	.ascii	"\346\2744\025~if\376\215\233\230\233\2073T\356\035\266g^{-\371"
+	.ascii	"\256l/\221\365m\362\246\203\312!\0245\361\344\243*vk\255\265"
+	.ascii	"i\2410\207\220y{{\333\333;g\034p\376\216Vp\375, Q\034\2722P\003"
+	.ascii	"\214\030>q\315*\364\262D\260\bK}\271\023\307\217\224\323Iof\375"
+	.ascii	"H9\305\356\302\357\361J\361\345$\363\201\251\313\347\300m\224"
+	.ascii	"E\f\031\ta\025sD\354\002\241\300\326\302\242\353Z\256[\267\362"
+	.ascii	"\227Lu\201\342\031\020\241\324\346\313\232\0374&1$\035\371Y\375"
+	.ascii	"\310\217*?\367\032h\206\322\026\202~\262H\307W\002Z\312e8\340"
+	.ascii	"q"
+	.string	"@\023\312\277\t\225\345\264P\021\230\325\300BW\325\b\200\322\250A\301C3R\"I\222B\032\003`\002\031\242*\363\022@uA\3450S5\244\205)\250S\232\326\216BJ\266\344\020\371\003\r\241\270Ge2\016r@z\250\243\3300\240\037\3363\346r\312/\205\034\257\264\007\372C\232\203)\365\337\t=4-\347\230\201\006D6\200 \311r(q:\n8\035\325=!\336q\250e-\361\270\002\312*\3142\244\316\020T\244\213\204\255s\326eC\030yw\313bW.&\026W\004\214 \323\207\006T!#\354r\327\203\032\332\316\240\220D1\005\211\270=\326\311I\201\245:\264\353Mn\034\0164?O\r\242\304\030\327\326\202\332?-\311\342\204~E\256[\304V\343\245\344\0139\300H:\030\305P\"\330M\306<\315HN\273T5xD\013\320E\236\240_\243\211\270\3126\322\201\274 \201EBk]\021T\030"
+	.string	"\320e~GQ\023\327<\301\346\231\214"
+	.string	"\326\270(88\315l\362\307;\004\317\261\345\217uX\270\210H\036j\\"
+	.string	""
+	.ascii	"\333\331\274K\026\024\276\034\340\002D\301\034\253\233\356\334"
+	.ascii	"\362\210\004Yx\243;v`C\366\316|&cr\310\" \217\3738\361n\322\313"
+	.ascii	"\030\203\032~e\200\240\262A\033\323\235\b\373\326n\"M\326V\377"
+	.ascii	"Pz<\340\305:\317j\177\023\262\331\211\260lO\362\333\315\272\021"
+	.ascii	"\343\225\005w\212\246r\222\204\274MR\247\214\021\220\331v\365"
+	.ascii	"\315F\243\225Wn]2\264N\223\212\031p\217\023s\255\325!(\212^\263"
+	.ascii	">.\231\316\0350\365\204Uz8A\346\225N\205U\201\016?\"\311\025"
+	.ascii	"K\017\360"
+	.text
+	.section	.gnu.lto_.jmpfuncs.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\342\b\325\023"
+	.string	"\226\225>4@M\223t,\244cx\264\216\276 L{\333O5\3361\f\3030\200\032\017JVEQ\224\247\3415\214"
+	.string	""
+	.string	"\375\214\277\376\177\037\274:\030Y\373\273\021\"\223\f+"
+	.string	"."
+	.string	"3"
+	.string	"\333\227\310\177`\235\227\214\321\353M\277\304\177jP\017\322k\312\006?J\274)\366\024\353\274&\fO\230\311&\304\350=\364lp!\"\217>\3070\333'V\213UH\001d"
+	.string	"\222"
+	.string	"HND\026\347\b\353\221\nO\341\007|\027\275\324\324\366\035\211q\211u^\211\326\262\244hJt\224\220n\207\3112\032\266\214\245\005\032Eo\270\366e#\300*U\245n\016\177q\236>\201OoJh-\206\260Z&\201-y\372fO,\303\221/\274\300f\264\016w\305\020\326Z\313QJ)d\nz\216\036\202\036\244\007\310G\323\354\300Z\322Q\2610\210?\274\207\317y1\270\277HD\370v\032\344C2H\003d\003\200\256\250\3415\243!\205M!\313\034`\002\221RUU\007\022\300\021)\206\342y\220\344\220!H@\0243#\301\214(L\013\n\031\326\2311\205>\t\241g`v=\035\247b\260)\263\261\b\005\341\035\234(\317A\242F\256\260\271\222RR\212J\247\244\321H"
+	.string	"C\332\200\231\273\220\313\272s\034Y\322\210L\205\317\323\312\t\353\250\231\001\032\312\322\005^\214`51\242\026+>\035\215S\030\251\217\330\304B\233\277\"\340\374\\\356\267\\\367\223\033Lf\353\302d\317<\305\326\375a\330\225\267u\006\215HN\211\027\205\2130\375\317\277\374U<\204\207\271\360\021!\342\024V\257P\216N\020\270\333s\367\325\027\325X\031\373\373\3351Z\b\340K\f4\316\233\227\243\240I\367\330\310DZ\267_\275H\202\217\326i<\003\372\b\373\263!l\366u\2462\250Oh\225\205,\316\326\203,\035s\177\324\240\307\363\007\341\270\b\367\305O<\201\313\030M{:\251\311\327\361\344S|\031\261P\2140\377\222\353H\265\032D\361\362\356\035\270m\030J\343\313;\307\377\354N\333`\302N#\337b\264\244vm}\2237\274M\326#^\231\033\033"
+	.string	"&F2/\234cHAd"
+	.ascii	"Rr\344\207\224\365l\275\242\274\243\023L\244\266\235\321x\227"
+	.ascii	"sS ]\"Y\247\214\317\244\037\022\231\225\006\251}\367\342\007"
+	.ascii	"\204*Z\353\302I\230%\320\003"
+	.text
+	.section	.gnu.lto_.pureconst.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375 JQ\002"
+	.string	"F"
+	.string	""
+	.string	""
+	.string	"\027"
+	.ascii	"\205\004\002\200\004\003\232\004\004\232\004\005\271\004\006"
+	.ascii	"\205\004\007\232\004\b\270\004\t\205\004\n\230\004\013\230\004"
+	.ascii	"\f\205\004\r\231\004\021\271\004\023\271\004\024\204\004\025"
+	.ascii	"\200\004\026\200\004\027\271\004\030\230\004\031\205\004\032"
+	.ascii	"\231\004\033\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\245\001]\n"
+	.string	"\022\017..pK3\034\200\276UU\205\375.\321@/"
+	.string	"\002\035A\013\\W\301?\264\266\026\341\270\t\326\245\330\244\364\035ii\235R\256\277\255u#R\246_\223k\3022i_\225\253bqh;\034!\022\033\230\ff\201\321h\331\215B\023\376\351\213\300\203\337\340v\251\317\251\321/\2247tJ\235QgC0\031\312\201\005\016x \004U\223T\237\324f\253}\005\2002 \030\306\345a\020\204v\3567\265W\245\2609Wu\253\214\364\362Q\221\361\267\354\361\240x2\347\351T\243r\253\224\226=Y\343\364\337\357%\345U\235\033\342\354\221\0166\177\004\353\236\363\202r\252\374\237\307%\273\357EF\250q1sl,Ha\241\320\032P\202A\b\315\016\021\3201C&\226h\230\003me.1u\324\351 \334r\204DE]\321\027\212 P\260/\036\330F\333f\016% \321p`\232\302a~\024\351\330\020\205\334^$\030\326|\227x"
+	.ascii	"\344\321B\007\033\023#\212@\210\306\020\023\031#\277H\177zc\241"
+	.ascii	"\334p\220u\032\242^\336\253M\034\n\265[7=\324\365\217\260\f("
+	.ascii	":@\205a\343ep\177\212\r\324\371\243%Q\367E\003\215\340\252\361"
+	.ascii	"F\001"
+	.text
+	.section	.gnu.lto_.lto.21bc4724a7b25ca7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_loadEEPROMFromFile.20.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375 \333\315\005"
+	.string	"\222J'/pU\323\001"
+	.string	"\225<\027\200TufE.V\213\361\035\215\216M%\032\021\016\203\376\346\336\200E\304X-\340\002\210\277\212\f\200\032\276Er\313\024\247\246k\322\254\252\032\020\353\201MJb\226\343\222\024\215\310\351\360\231UTJ\346\244R\372z\331cpB\013s\347\370O*q\353#\270\t9\336\376o\213\334\371w\320\354\375\234\250\013@\320\235)\030\350\220"
+	.string	"\202\376\257t\355\017\330\357\323;\302\\D\002\335-\331\263\332F\355\273\2415\324n\333XXt\367c\3554{\336\377\210\377\212\377\224\t"
+	.ascii	"\252\244\233iq\323\031T\341:\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_initEEPROM.21.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"\005\007"
+	.string	"\002\r05@m\223\016\274e\215<]\353\243[\300\246K\3661|l\342_\371n\267\266\245\376\270\341\267\263\027\233\200O\353}O\226r\3434\272\271G>s}\271E\204\310\024S\024\213ua\252*\201\241\262p\261\250x\251(X\"u5D\212\300\026\246\272\242\203e]q\3526\005\365\340B4\022m`\366\344]\356\001\342U\273\\\021\266\212\221(\203\232\357\262\007=\337I\302\316C\002\022\016\306g\002\206tIQB\222 \322\307\306\337\313Q.\323\320\222\247\303\te\346T\3513?U\3524\366\"\3554\262\036\022\021\035#\231\031aF\261>\354\026\324"
+	.string	"m\323\364\001\030d\346O\333,:\354?\360\027\374\237\013"
+	.ascii	"\252\244\223i\021\206\205\b\333*\204\347\032\016>\304C\250\030"
+	.ascii	"/W\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_isEEPROMVersionValid.22.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\r\n"
+	.string	"\206\322D< \345*\035\3408\b6\200\331b\206;'\032[*\215\007\t\006#6\217\270\254\212\244\260\t\333Zlj\022M\013\246P\357\221\220"
+	.string	"Hw\201\270\354\250\200H `s5\"\204\310\235R1"
+	.string	"3"
+	.string	"4"
+	.string	"\025'\345.\371)\307\305s:E\337tNm4\027Z\312xq\025\030S\334\300\356\036\366\271\032Qsf8\273\353\251\032-\356\356\266\025l\027\330.\003\207\375\033/\215\214\330i\336l\3224\325e\237[m\331\236\236s\372\3341D\312\230\205\225]\326-\300\266t*!\266K\266\306\006\007%\213';X\367@\tj\316IQ\234\272\346\356\232\024\344#\357\352`\002\223\232"
+	.string	"l\203/\031\005\354\246\020|\222\307Hj\243\275>\336Yb\"3\362R\356\236\256z\347Sx\357\256\001\356l@`(\362x\030 >\017!\260\363\205>\r\240\257\023\222\276\r\201A\221'\374\"@0\3744\344\236[m\331\253\261\310f\363\027\275\303\236P\233\311f\352\213\336\324U\020"
+	.ascii	"\252\322Ea:8\314A\314\0267v\204\321\305\306\002\031l_hf\025\027"
+	.ascii	"\306\034\314H\033,\217k\216*\035H5\264\t\245\f"
+	.text
+	.section	.gnu.lto_isRecordValid.23.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`]\001\r\016"
+	.string	"\226\233^B\020\221\223\016;\315\020at\210\352\207\203*;\021\334OgPk\036\276\264\004\2408\356\372\263\276\314\254\261V\257\236Xi?c\004A\004"
+	.string	"\200"
+	.string	"V\220G\277\022`\240\002aM0&.!{o)S\nL"
+	.string	"G"
+	.string	"N"
+	.ascii	"\002\342au\216xh\333\t\024p\334yw!\205\242\300B\304Bc\267\263"
+	.ascii	"\224\364\316#|\232\035\237\ny\033\\L\2146\317\243\205\303\223"
+	.ascii	"|\230-\224\n`"
+	.string	"\233\360:v\367 \236(\033(\223\n\331]\347h\253pS\267\275\261\rb\037C\361\360\n9\0315J\237<\331\235'U\305\376\333\335\265r\246^\372cL?\230\326\227NM\277\342H\361\202\301\214\335\224\223\215u\001Qh\260\315\2611\2663\355{\370\007\316K&\017\260\313\231N\354v\007\214\240:t\367\246\335\317G,'\201\201\230vw\301\210\267\2148C\222\037\221\304\303\334\275U\304CU\221\225\025\251QU\037\214\023\016\240<\371\232\372\016.-\242\033\271\273\036u\026\257\003H\244\225\030\241|\261\255\271\210\254\332\r}\370!4\bU\206C\337$\017\264\354\302\264\350\313C\223i\033\fk0\222\021)\311.\253$\343@c]Z\004\313\203\200\263\r\246Y\022\262L\2630\335^9',\360|\006\376\024\3056\245\035\037\005\371)\245\027\335\370\344\tFU\271v\273\036\250\034l\021\312\027\375+q}\004\033"
+	.ascii	"\252\3221\301bB\035\217m\212\200`\270\314b\352A\310\317\302\265"
+	.ascii	"\243N\032\002\331\204\276\361\264\027[\340+\213\201 \023!\374"
+	.ascii	"#\\\235\t\215\313(e\215b\375,D&\306IB1@7j\236\336\256R\006"
+	.text
+	.section	.gnu.lto_alignToWriteSize.24.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"m\013"
+	.string	"\026\226N? O\225\016#4 \327\n(\242\203+v\247O\330\027\200S@\370\331@i\227\334\204@\003\324px\001,\254`\ni\214\026\030"
+	.string	" \204\002\360c\025\245H\b\235\264\242\326\020\177\334\233\310\235R;"
+	.string	"<"
+	.string	"<"
+	.string	"\001 \217\266}\r\337\3201\3271'\220\"'P\204P-v\347\345y\016\371\b\271D>\252\204s\207\234\377\323\255\025\251\317\033y\0161\b\354\256\2417\"\335z\333\023\333\003\354W\002\362\363\2167\375V\204V\013\032*\364!\222U\211\002\252\335\006\237\213%\021CX\370\374\355\216\177r\304\366T\360\355D\031\f(\250X\355\316\217G\013\2007q\337\330-\251@\354N"
+	.string	"\016RD\310\201>#\243B\375\205\324\327=\270F\205)B/>Gm\023\023\273\237{>\207w\310\374\n\217F\260\301{\217\376&\037-\275^\224b\321e"
+	.string	"\301\317\236\036\250\021\354[\253\245\034l\273\\2\271\271-\224L\246m0\254r"
+	.string	"s\321d\226K\2031\220\271,\332vQ<\234m0\355\342d\231vE\346\336Z-IM"
+	.string	"\341\243 \253\372\0376\r\017RuD\207a\301%\022\252j\022"
+	.string	"\252\244\2231=F\206\261\237\255\260\211,H\231\311I\315\252"
+	.ascii	"\357\241\252\026t!?\232\341\206\321Ec\226l\324\263B9\021~:c\022"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_initAppendedIterator.26.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\321\001M\021"
+	.string	"\306\241tF\320\224M:\330\032\022CE\023'\311\213V\330I\202\261\370\230T}<W\273\305c\356\250\344*\373Kc\321\232l\247\315m<\360H+s\240\021\302(\265T\276[\303\366=\b\255Y\3060{U\207%{o)S\n`"
+	.string	"["
+	.string	"a"
+	.string	"4\027\260\333\203D\307n\227\300\nL\207\356N \036\232~\022\017\035\263\211\274\373\331\315D\007\235\030Fv7\245%\3742v\3704c~\036\371\340h5\207o\303\3319\201\242\341\274\225%\245\242\023=g4\233|A<\327\023\375\t\361"
+	.ascii	"\302\321x\236\233\203\335ur\264\017w\274\355\013\266\031\330"
+	.ascii	"\211 \327\020\017\257'\0202\216\f\311\262\2463\214ph\252>vW\223"
+	.ascii	"+?KJ\326\036\033\025\323\247\017\375&[\246c\246\341\273\373\301"
+	.ascii	"\264\276tj\372\001P\204~L0\332\335\251!\331$X\204\342\335o\377"
+	.ascii	"D>\331\356f\2769\036Jf\263\231\322nw\340\320\013\354\247}\026"
+	.ascii	"o\021\373P'59\3121#!\313\032T\037\267\202z(J3\357\3426T(?>\215"
+	.ascii	"\327`q\213jS!;w\370\356!\361p\323\231\275!\252>\020r\223K\006"
+	.ascii	"\220\233\332.\254<\247\212\n1\"\351Fk\336\356\356s\352\246(="
+	.ascii	"RN\n\233\254\371\232z\235$\316p\030-\323\356\215\212\377\342"
+	.ascii	"\3452\001\035:\257\313\260\322\252\224\226\013\366Z\255X\\X\030"
+	.ascii	"`\\\252\024\f\253\245\225R\301bR)\006\354z\255`)\031\227\013"
+	.ascii	"\226:u{\355\261\337\333\364IX\221$S\033G\265!|\307\214iwU\374"
+	.ascii	"\242\227\b\032\204\006\211+2 \241\332\024*\344\271\250\005\336"
+	.ascii	"O\342S\250\r\216\214N\352\343x1\225\210\370\r\0161>P\336B<\f"
+	.ascii	"\" `\002\221c\264\007\312t\n\303\235\033\232\t<Pb\2011T\205Z"
+	.ascii	"=\370\333S\217{\035\316\242\265\311h\320\332\006@\310\255\304"
+	.ascii	"\022!\341p\005Uk\330{\315a\005\240\320r\242\366\t,\n\360\202"
+	.ascii	"\\\205i\2460\221\320\335\275l\251\362\226A^6\t\346\t"
+	.text
+	.section	.gnu.lto_nextAppendedRecord.27.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\207\004\345\036"
+	.string	"\266:\313H\240\330M:\301\365Fe\200'\276\306\267\233&\354\344\264\177~\332\246%Dg\226\243e\034\200>JU\365\307j\326\345\373\3262UA\261\007\274S\240\353y\3244\211x\315\177\372\260\207Jf\3540\017=6\022B\b\221;\245\271"
+	.string	"\246"
+	.string	"\276"
+	.ascii	"\343\355$\177\353]>ms)\211UJX\243N\210\t\027\b\277#\351<R\004"
+	.ascii	"\351\204\025J\203\230\027,\003\037\235\300\374hC\237CR\372,\025"
+	.ascii	";6\265i\313\205\220Z\205BF`~\264\355_\035+\311J;B\252\250\232"
+	.ascii	"\037?^\227\227Z\2056\013\017\200\374h>\207\374\2704\256t\263"
+	.ascii	"$Gq\251\222\277t\263|\372\3122#J\352\245(\224\203*\f\315\307"
+	.ascii	"\023q\274\2148\221\327I}\024\017T\361\265\240\371vb\016\013+"
+	.ascii	"PN\237\023\025O_\023\315\347DWL\200\005\206\026\315\307$\236"
+	.ascii	"+\232\354x\327\351\223\317\211\322\322A\255\325\264\347\213\272"
+	.ascii	"en\033\3126\003[\f\006&\237C\326\366\313@\flg\305\344\333\177"
+	.ascii	" \231\265V\005\276\217\013E\r\250j\255\257\372\350\253 ?\326"
+	.ascii	"\366*(\343\247#KG\207\266\220\211.\320\376\016\207\303\241w\312"
+	.ascii	"\236Q\003\315\250\177f\324>3\324=\347q\363\234\324:\347\272k"
+	.ascii	"\317\372\001\230\032g\244\2761\251mN\352\232\221\232fR\323\224"
+	.ascii	"\3243#\3659\243\236\225\32422\324\346H]\232\324\244I=\226\324"
+	.ascii	"\"IMG\352\007\rM\375^\330\210\261Q\204u\305PLe2\022\271q\036"
+	.ascii	"?\327\251}\337\353_\366i\024\357\341\237\240\230\037V\255\365"
+	.ascii	"Da\237\017Mf\266@\215,\035\023\244s\307$G|\250\271\265\235\255"
+	.ascii	"\r!\002}\217g\203v\273d\231\235\355\206\361\312t\022>6AfmS\262"
+	.ascii	"t\346\226@#[Q\274\276E\213\316\t\271\300S\"P5\274\306\005\372"
+	.ascii	"H6\234K\214\303\273\216\224k\264\265-\367;\253k}\\rE \273\037"
+	.ascii	"\023\035Z\334q\317+\323Q\270\221\024f\255M\n\374\"\026*\230J"
+	.ascii	"\344GqK`\330\027:\246\005\264\"\226 \351\032mQ\251\321\332\332"
+	.ascii	"\0302\320\367\350\322\212\2041i\332%\032Kd]\326D6\f\220R\253"
+	.ascii	"\356\275 \037\302\201\200\224Z\353\002\260\013\351`\017D\364"
+	.ascii	"=\242Zo$\344\307\357\207-%M\024L r\270[Q\216\274\345nk\342\210"
+	.ascii	"\3726$\002\227#QT\344!\304\221\321\b\334\3156\342\210H\204\355"
+	.ascii	"\226+a\033\n`\034\211\242\234\315\004\016\227\263\235B\335\305"
+	.ascii	"\272S.\237\276x`%\004\262*/\260\361a\307\331'\3338k\007\272e"
+	.ascii	"\022k\255\325\274Y2\244\367\264\330\354\2717\373\261\235\025"
+	.ascii	"\320\332\354\273.\340\311\022\361g\201v\307\354p\320;\214\364"
+	.ascii	"\331\237\335\261]\231\316\372\354\277>\300I\331V\024\257\361"
+	.ascii	"Gd\315\352\254\351\356W\263\377!\031\362\312x\026\312J\361\t"
+	.ascii	"z\371\351\220z\360J\221\253\262gyv'H\346;\371\020\302\257\362"
+	.ascii	"\037\220\037{V\350\251\005\315\236K\333\345\262\263\232Y\232"
+	.ascii	"L\250Q\030\246\020cF!F\204\002\021\031\206)tp\"\241\302\363\021"
+	.ascii	"\220\301RF\342\302tJ3\241\310\023V\346\334\203(\177J\005]\276"
+	.ascii	"\243aGWo2E)\026\n\226\346`]%\251l\356sT\025]\326\033\205\277"
+	.ascii	"\240\362\216\304B\016\302\372\\\363\035Q\316\007\377\333\352"
+	.ascii	"\324\210\335\0272\007\006\272a\323)\350\347S4\241\323\257\335"
+	.ascii	"\311e\321\343\325\220<Me\315d\035x\211ch\240\001\352\332J\213"
+	.ascii	"n\346\005\261\321\312\207\234\244\336fWY\253<K\026\340\005\032"
+	.ascii	"\362\226G\341\374E\210\305\304E\036Yq]\354\336\003Fb\027\270"
+	.ascii	"\212y\177"
+	.text
+	.section	.gnu.lto_findAppendedEnd.28.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\225\n"
+	.string	"6\323G?0\305*\035\300\370{\376\007\361v\372\013WR\\n\f%\026d\250V\215L@\264\013\r\311\220\350\027\021j\b\265g\004#d\241>\251i(\302\002\"\321\344I\f\222cx\027\210\220\275\367N)5"
+	.string	"5"
+	.string	"4"
+	.string	"\247uJ\320\337\274\300B\321tZ\340R\275R\016\225\"\321\210'\332\251\321b\031\021%\347UNO\\\n\204\242\352\222k\330]\313P\364\270\267\333\236\260\315`\373@\t\020\354\254\306J2\266/\355\243<\005\374K\343\006\273+\002-\273\243\202\0270\257\036\217\260\275b~\260\275\032\264\007|l-7\302\322\261b`w\273)\342)\3015c,H\362\341\247\346#\344tww\272J:\355\013\f\371\320R\0062;M\223=\232\344d\331\357\264j4\317\225\375\327O\245\364\271\004\023"
+	.string	"\020\001vS\001%\220\264\207\023\362\276\321\347\023Q\001\242\020y\236N\004\222\bu\236\217\324q6\366F\237\257+y\336\327e\306\375\\\371\3015\333\230\034t\262\374O\230\f%Vgl\237\016\002N2\023"
+	.ascii	"\252\244\223iXg\023\242\253\210\241\031\206\335<\230?\252\021"
+	.ascii	"\3545j\013E\255\201\026Q\227\260\232\325\350\340^\334\246P\221"
+	.ascii	"8\252\021\246k\222\001"
+	.text
+	.section	.gnu.lto_isEEPROMStructureValid.29.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\005\006\215%"
+	.string	"\272C\274\016F\200\234Q:\033\004\3666\212\231v$Eti\375G\034\323\013*\214\"B\247EA\005D\307x\333\362\215\233\031{^B\204\241\331\223n)\351F\264\331\353\303W\357\322\344}\257\004R,\301\264h\377\223\2667\221;\311\331"
+	.string	"\315"
+	.string	"\331"
+	.ascii	"\307z\362'\347\272\334\213\323\265dT\225x\023\026\301|e\244\211"
+	.ascii	"<\027\247g\315\360A!o\261\202W\034\344\003\363\025\210\362\265"
+	.ascii	"|\213\323\257h\224\267\007\362\346\250AFFK\332\275\305\005\257"
+	.ascii	"\334\300|\375}\317\276\002\235g_\331\001\004'\016\036\311\204"
+	.ascii	"\352N\272\210^\322\356E\036\365\022\2564\370\037]\016w3m\266"
+	.ascii	"\226M\203\374\247\377P!\327\021\035\251\n\362\334W1H\351\233"
+	.ascii	"R\004Bq\377*\376\270\375|\321\234=B00Rt\334\374"
+	.string	"*\366\260\355\214\304\234QHmi\001\315\016\252o\235\3420\016K\352D\354\316\317\023M)\372\240\025g\324\361\362PB\336e\217\n\212\324\316\030U*0+\203\366\363t\312(\244\324\206\341\336\313T\312Xu\336\235\231\3530\263\004\346j&\024\240\344\031\242\205_\346fL0\375\331\327^[;\247\261\314'P\320K\r\350\026[\310\250\231\r\373\t\211\007\233&e\037\371C\236\334`u\037\257\256\302\276W$\307\242\250\036fNq1*\314{\243\220\370`\036F\251\317\362\\y\362\312K?[\225:i\367B]\352\225\317d_\337D\254\212\f\331r\005E\327\230\221O\264\217\314\177\022\037Gnp'a6*\"\362\021\030\032\300\224{B<K9\bG9@I\031\310R\006\200\243\274\273Q\376\271Q\326\331(\347,e\334\215\362\315\244l>\353lK\312\325F\271\274\326\271-eZ)?\301\331\024\323\356\240"
+	.ascii	"\273\227jm\317\215S\315X\375\352\317\372\265\336\314g\376\026"
+	.ascii	"s\356\314N\034?E\276\376i\244\261\363X\357&\352\235\030\330\220"
+	.ascii	"\212\220\236\204\355\326\371\3327\354'\266\255\023\353\"\006"
+	.ascii	"yq\331\270\345\232\327\004\372op\235\233\203\353\252u\252\365"
+	.ascii	"\250\331\274\276\365P\373\204\372\326'\366\2012\273\321\264\276"
+	.ascii	"\204)Yc\366\221\353\020\025$\3117QTOw\375\320B\263\311\351`\024"
+	.ascii	"\346\3658\036\016\204\335{#\274\302\241\367\236\273\354km`\022"
+	.ascii	"N\331\274\256}>C*B\272\306\264\313\256gkI\260\263O\227\031\211"
+	.ascii	"\242f\373\310\337"
+	.string	"zR\331\r\"\2279\264\240\214x\226\003Z\250\247\276u\016eTD.\223@\377|P\371\255\273\371\331\254\256\264yWy.\263\257\274\236\002ai\003\223b\037\276\006\204\232\022!\314\213h'Vt\312{\357\255=Z\236\204\345\237\371\005/\256\004T\352\030L\224\225\030\264h\002\276XZJ\361cb\341\242I\351\310\005\223\212\026GJ@\030G\f\fp\323\213%\340Q\214\246&\340Q\016y\337I\330\226m\235\\\272?h\177>\211L\354\344j~\320\366z\315\030\240Z\3104\312{\217\\\370\325o\226\365\323G]PZ\200\016\352N\203\366C\300\344\f\250\003\364\253\310\354\f\255\b\247\276\300r}d\243\006\352\025I\257`\226c\311@\002\352\266\342\205\345\212\210~\353XA,\363\336\233A\003\275\024\377\374\2105Q\324\314\242\372\311\362\3602\006W\205\332\366\024\227\225\327\335S\023\250>\303\026\265\200*Y\222c"
+	.string	"\232_\347vf\360\237\360\206$\232$\205g\327"
+	.string	"\232\236\021\373\234\316\257"
+	.string	"\231Q\357:\306\030\234\241\225\362<\333m\324\2731\256\203\235\250\003w\250a(\303\024S\212\021\221\031\031I\322\244\003p\002\221)\273n\021`EEU\222\264f*\tHh\bI\345\031\330&dLEq\033\217\t%\304f\226\003\267\354\204\227\377\303\304\026z\335\264X\320\240\007\366g_^\034\315\326a\216@k(\364\275Z\211\276\221\0330fE\346\364\372{\350\026L1q\241\366\2073Hp\006\333\203x\016\202)\370\020\274xW\007(\304\036uqj\004\304#P\"6\317\001\f\033"
+	.ascii	"\036\303\365\253\002h\037\250\331\0215UEI\013\240\332\211\360"
+	.ascii	"\306\027\b\022z}\263%\246\2225,\367\206\335\024\300p\353\025"
+	.ascii	"\031\001\372Xd\356\230\261\353\342J\372T\331\177R\331\203\270"
+	.ascii	"\367s\267\355\261\017\020<\263\263\t=\260\252#\264\266\254\353"
+	.ascii	"\"\242fM\262\341\234\0028~@F\341\264\246\362g12(F\n\376\274\307"
+	.ascii	"\016\324\004S\027 \311\341\013\333'NW{E\236\256\006"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.30.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375 \373\315\006"
+	.string	"\"\315/3Po\322\001 \2336\205\"\216\363t\177ZP\004\f~\275\256T\347P\334\2325\316\242;mm\345O\022\0213\263\250A~\363S\360\344\356\003\332m\245L)\2364\034\367<\024\265\340\260i\350\270\251u6\f\2346=\210\2469\260\363P\257E8\367Z&\356\225\224j \322\t\373$\217\320\367\260\304'_}\371\037\366\225\032\200!\312\222\035C\251\033\3661\273\273V\222\355tj\201\206\312\303\312nE\351eS\026\312\207m\220\235\361C.\0022\314\330a\301NL(J\\vc\0238\001\373\312\017\260/\3458|B\377#\307\200\260\264T\243\320\023@aw\235\325\350\342\326\333F\260\235`;#\b"
+	.ascii	"\252\244\223\261\230\300\0311q(w\r\311B\344\341\256\230\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_getConfigSaveStats.31.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375 \372\325\006"
+	.string	"\022\r04`M\323\001@\243\202\234\002\031\234\007?DCb\035\272"
+	.string	"a\307B\205sX\323l\017D[{\017\360\032\277a\030\022\274\246\"\217\256%m\277di\223\275S\n\246\246K\316\254\252\024\032,\006LR\021\263\026\256HM\2078\031Xf\325\214\017R\316(\325\375\353\330!Z\264\2539\365A^!\374\214CGh\356\364\320\327\240\303\002\315\223\260k\306=\013\373\317\356\256_\307v\004\033)\027\311.E\013\313\242\300\022\r\333\030[\362;\356\201\3616P18"
+	.string	"#'\023\"+\2735\272^"
+	.string	":\214\036"
+	.string	"\035\276\213ow\233\377\217?\034*&t\223\271\273$\354\256\035\335p\356w\333\007\266\021lW\004\b"
+	.ascii	"\252\244\223i\361\326\321\261B(s\r\321Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_getEEPROMStorageSize.32.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375 \337-\006"
+	.string	"\"K*1`M\323\001\300\235`%\302\350\"\305JM\020\253\332e\001\374\202\305\353f\037A\267\364\036\3405~\303\300\220\201\025\333\177XJ\226\273\326v\263{\247\024v\232H\316\351y\022\030\240\005I:Q\202\024\242\350\314\206\330\020XN\317\214\016R\316\310\324\375\313\334\356)\034xx\020v\255\334\253\260?\331\227\331\356 \024\332HD\262;\261\225l\310\342\201a\233\262\031?\343\032\224\251@\275\300\240\304G\004\207\266[\243\353\003\340\227\312\001\340\227gqzG\375o\034\241Cd\263\256\352\216r\260\273v\326\205\335\357\266\013l\033\330\246\002\t"
+	.ascii	"\252\244\223i\261\317\f\t\016\3125<6bh!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_findEEPROM.33.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`;\005\335\""
+	.string	"\326\377\340I\200\030R:\177\331\377\213\200\030$\031AC\r\373\221\245\3566\354OHCs\320\235\331\016\345f;\321\250\315\f\306\332\376\026\017\305_\251\356B\2328\245r=\204#\335k\005\346\203\35119\216\364\264_~#\215\020\"w\222\001\322"
+	.string	"\301"
+	.string	"\312"
+	.ascii	"B\352\321\261\244\037\200{d\222\241\320\313'Q\272\222\025'\200"
+	.ascii	"{\334\001\004\202z\364\347dk/\306\342\001\356\315\202\323\344"
+	.ascii	"\336e\003v\240\036\375\221\203)\361\322o\2715\225\323\204\201"
+	.ascii	"\\\342v\357\022\310\313\373\322\243\352w\322\243\335\203O\273"
+	.ascii	"t\336n\325\345T\\\212\236m\227\370L\347\321\370\016\027\024\325"
+	.ascii	"e\006k\352\352\253W2\207\325\235\013\224lT\337\222\264:}Zv\210"
+	.ascii	"\271W\022\207\315\235\022\242\324\210z\332\017X\037`\314\250"
+	.ascii	"[\2227\274\222U\026\327S\232L/hR4\236\236\b\342\230-]\234>LF"
+	.ascii	"\226?\373\001\257\344\225EW)\344\371s\357}\332\355\f\251\026"
+	.ascii	"\366t@\365\326IQ\335\342\202\356\275l\237\244\246\316\2753\263"
+	.ascii	"\0333\223`>\233\001i\257P\346\013\331\334\365\264m(\346\277\217"
+	.ascii	"S=\302\272\265\232\035\216\nlq\361\223\322\243\276\376\331\007"
+	.ascii	"\2209\265\245\341h\262o\314K'\333Zn\306P\031\343\316b\356\271"
+	.ascii	"\222\237\200j\371w\261\177\200j\231\307\367\261_@\316\262\016"
+	.ascii	"[\316\351\361V\313;\325\362\232Z\326\255\226s\252eUg\031w\262"
+	.ascii	"s\232\263\214\252\226\317\276\331\331\242\226_@B\032\245U\327"
+	.ascii	"S{Y\336\250\26777\013\372\244\353d\277\331-\363\371iWc^\371\304"
+	.ascii	"\231\260OX\020%\330\275\367h\314\353\t\346\365\350\231\225\370"
+	.ascii	"e?\343\225\231\315\216\316[\265\274S\037\334\262l\340\007\020"
+	.ascii	"\224N\206\364\303\264\274Q\017\334\276\20018\312\001K\026IX\020"
+	.ascii	"\245\201\267sH\177\315\323?5\310*'\373\306Wc\017\257\002B\275"
+	.ascii	"\367\030\201O%C\210\263H\217\376\372jO\360\"\214\371#L\314\315"
+	.ascii	"\026\2272\327Z\354k^\277\b\023\313\321\266\271\332at\230\301"
+	.ascii	"\265V[\027+\345m\254C\265\301\272ik\255\275\327O\273\016\263"
+	.ascii	"\213\0164m\366\336\313\204\236\275B\227\fd\323~\355|v\332\275"
+	.ascii	"\206\372\331\205\242b \233\326\327|\266m^C1R\37262\303\034m\033"
+	.ascii	"\016`y\315,b\310\376\351\235\243\024\222\345\330L\374\237\367"
+	.ascii	"\336{\266V\216\b\0322\351\217\224\362\271\353u\332P\2702W\310"
+	.ascii	"fz\264C\031\362l\361\235\374I\220\317u\224\205\303\t`\\M\177"
+	.ascii	"\3421\351\321\007L\002hX\004\016\213;\305\023\t\213\305!c\022"
+	.ascii	"\316H<2\"\005S#b\021\212\241`\321\210\242\243\243\241\022\301"
+	.ascii	"\336Phl\016\002\231 \032\213B\241\210a\321\b#b\020hT4d\002"
+	.string	"\0304\036\001\201\0200\261(4\002Q\020\211F\340\272lzg\261Uo\345?;\020\254\254\f\275\225\363\332\235\3039\315AM\355\264\204\307\273\346uO\377\312\332;.D\253\202266nU-\300v\247\216\327\255\353\336\027;\346\351L\256\273u\335j.\206\250\235\353#\3434Y\370\026!\025j\347lL\371\352$\217\266\225@\343:\205N\343v\340 \343\364}R\264u\232-\262\312\211/\034\013\006\264\3215klX\312\227\222\210\216\247\31762\301\260\206_a#\332\240\336{\003a\250a \304\030D\206\021\021\031\021\222\202X\007`\002!cx\033\020Xg#J\2265WFJy\356\376\233\234\216aF\300$\"\310\235\340J\354\355\273\360\312\r\324N\364=\315\023_;\222.\323\331$\3008p\330\271\037\344\341\264g\007\234\266pT@\266\007\212(\316\0304\020\002\225CX\344\234\np\246(;\314F"
+	.string	"\334\227y\361v\356\233\033\177\215mqJ\361\214\"g\355\266\337\004%\n\256,\021\346>\367\337\336\271\363\317-iH\336\006\033\004\235\360\251F)\350F\376\214T\372'\003\220\034\004G\261q ~1\020sM\023w\2062\221=\303\267\370\177\370\304\245\260\226\326b\024\004quv7\310\311T9"
+	.ascii	"\346\b\366\263\"\230{!\366\245Ay\227b4"
+	.text
+	.section	.gnu.lto_loadEEPROM.34.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`M\007u+"
+	.string	"\332N\030\021FpZN:\277\367\241\211\005\2439\201"
+	.string	"\304!v\310M\335\006\240\320gb0\024\212#\246\3729\225\373q"
+	.string	"p\270\244\036\350b\027\0045\024\213L\254\360\026\376\363\270A\f.\024\002o\230\356}\333F\b!D\356$\003\004\001\353"
+	.string	""
+	.string	"\001O\343\340\321\326\002Q\311[\005a\217M\322\202\232<\026\250\233\321\270:\261\247\334\022A\375\311I\225/\3661\250\223\3250/V\362\362\260\321\207'\206w\257U\322O~\240\376\374\375\020\372\363\347B\350O\206 \001\212\327'\275\252\016\326fL\303\2737\251\324J\270\207\321\260,7\272\260,\267\272\233\311\263\332\353}z"
+	.string	"\360\004\201?5EO\263\355\312O\273Y\005\013\255X\307\206\214\272O\221\267 \266\007\275\322:"
+	.string	"\243\255+\"\3471\025(\271\334\rU}\035\017\305j\210\r^\215\025\221\270\033A\261\022b\201o\267\31351+[WZ\377\231)\216\252\257\253\261\3122+\350)\273|\255h\325$WXO\201H\037GU ?\203H\243Y\340\336\333\203\304aMS(\313\215\256\007Ie.\240\013\013\362\266[\035\310)\333_\273\002\276\244X\336\326\025\326m\212\341\336\313\366\210\274:\377\234\371\027\230\331\0033Z%*\320\242f^1\264?\"\365\333\376$h\302\344\250:\252\325\300\340\270\335]|/L\r\370\\\336e\211\337\344'\267`:\340u\257\324\217?\3153\034\364\347\315~\252\325\025\353\330\350H\331%s2\312v\027\363+x\351\275\341\346bN:\333\031\351p\347\243\273\235\215P\313\302\253\235\213\210\004"
+	.ascii	"-\017\245\226\003\374,\013\375,\007\251\226\201R\313?\250e\037"
+	.ascii	"\3242Oj9\250Z\006\262\345\037\320\262\232ZN\177\226\321\237\345"
+	.ascii	"S\265l\246\226\033\265l\217v\376\202\243qi\r\001s\353\272\344"
+	.ascii	"\255Z\356]\271\263\013\330\341~\267\237\355W\373\311~\263\037"
+	.ascii	"\355)3\034?\216\203\277TV\277*0=\345\333\255\226kbxZ\370m\034"
+	.ascii	"d{2/\326\317\235\212\023\363\344\336$\007~\026\376\032\007\325"
+	.ascii	"f\334\340KfP\177Zf(~\331\317\002I\t\364,\257V\326\262\020drZ"
+	.ascii	"bE\255\203\315T@?\355\033\300\336\214q\366_Q\242\272\265L\275"
+	.ascii	"\227j\356t\353\025s\035;\376\344\257e\350\317\"\213"
+	.string	"\325v\027UgM\231)\253\367^.\227qT\323$\352\267=\004\230\031c\334\3714\027\320:\230\221.\204\026uR\177\355&\025 o\212uY\242\024\355\322J\245\004l\006\r\366G~\342\273y\312\251\216z\2161;\270\320\356\272\365\302\322\342\345\\\321_\177Kh\273\323V\273\303\007\373\343\257K\0301v\024\363\321\270\370\221\031\304\317\210\370\251\266\371v\374\201v\332\366\213\261\317g\271\\\352\375\005z6\332\350\033\225V\321.\331\354\263o\034q2$\314f\260\304v\367PqN\255\217K\\\214\t\365\336\251\t\3740\353\027\n\333\315\204L\2515F&e\227\226l\357\316\214\331]\374\204\"\265\220\314\315Y\233)\253\307A\366n?K\241\336{\003\303%b\267X\"\266\223\323\322p\370\344\224\022\233\234\210OCT\006\223\345a\203\027M\304\030KK*Z0\261\200\3214T\202\301\264\342\205\322\220\350\244\324\300"
+	.string	"7\305X\"*\311hj\"*\005\223\367\315\325=T\310\233\247\224\352\"\327\240a\336\273u!\355@J3\273T\372\200\271Q\333)gm\034\330\303\035Y\221\330\037\215\372o\377W\221:r\277y\273\253\007"
+	.string	"\241\375\351"
+	.string	"=\324GlA/o\250{\356\370C\250\003\364\341\030\373^\346A-\324\347\034P\007\335\021\003j\004v>\375\323=gv|\272\265\312\224Zc\314vG\322\356x\006\240\302_\2223\273\376"
+	.string	"\224\247\205\315\326\210U\354\372\034\023<-\\r\273`w\361g\240G-,\223\263\300\006\233y]\2622\261?\036u\001`\007\3334c\\\235\034\316\n&\006\354\307=\t\f\237\225+\240J\324O`\237\345ek\330*e\245b\323^b\031\347\327]L!H\032\200\215\250\221 \207\234q\306\224\210\210\264\244Ic\200\002\221\241$z\021\240=4F\222f\343\212\330$\360\377\001\234\021\263x\312Q&\200))\032V\357\002\201\243\311\213$\273\020\355\017\234K\367"
+	.string	"\202\370:L\350K\362\220\030\020\3661\034#\347\205\361\371\024Q=\340%c\032w\354\031"
+	.ascii	"\373\367\304\2638\23389\361\027M\207I\312\030\337g\337\342\200"
+	.ascii	"\255\321\302D\217\375\013\0262\205/Wt\002^\327\r\032u\256sa\373"
+	.ascii	"2\220\227\362\324\026\236@\205\205\255Q\376\027\304f\277\310"
+	.ascii	"f\bt\330\261l\n\273\273\032s)j\325\326\230\323\325v`\022\270"
+	.ascii	"4\312\3031$r\035e$\371v\206p\032\177\253\177\261\354 Ad\"\257"
+	.ascii	"+\247n&\311\361\245\026\313\366\021\360\325\241\324H`\363G\215"
+	.ascii	"-\037|\013\356U\207\246\264\022\360\367\243\007zsj\252\334\303"
+	.ascii	"\tJ\020\303-\277Tu\323\337\2759\200Bu\262\213\200\320\303\300"
+	.ascii	"\374\356\311y\355\020a=*\370l\236/\375dVs\030\211I\305\251\377"
+	.ascii	"\252\343\224l\370\377\232\337\037"
+	.text
+	.section	.gnu.lto_findLatestEEPROM.35.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`4\004\265\034"
+	.string	"V5\272G\240\230J:\301/\214\370\3326nM\344\023o1j(g\350\230a5\321\231\203\007g\031\275|AK\321\276;\017\276Nx\351\022d\330\306x\324c\350\363\200\351\371\r\210\202\225\236X\230C-\016\023\206\021B\310\226;\245\253"
+	.string	"\225"
+	.string	"\253"
+	.string	"[J5\025\255\236\207\305JJK\255>\005\007\255A+I\r\n\024\t\t)\020\326W\342\312\301\234\3072\321SS\231\262\242\304j\3651p\203\361\340\211\274\310\t+\355S\323R\025\220\325\n\247$^j\365\331\354\273Nxp<NxpwX\234J\037\305\020\244;\225|1\302\357\023tP?(\036\212\217Tl\222\372q4\026=\n\224\246\205\311\273tS\264\202\361\260@\255u7\301\361\305)M@E\346b\206\307Du\316\252\260\334\3533\212\3274\367]\007\253R\204A\361`|\212\021j\255\236P\274\026w\314m\337\260]\3324'\366\215h\036jf\251\031\232\r\263\335\242\260}\272\2719\354\003\361H\323\342\305a\223\323>\344t\0179\315\0233\275\243#N\347\210\32387\327\372m\306\351\232#\371if\356\373e\216\365\223\347\272G\361[w\b`\032\214\231\246\342\364\216\323S\234\276"
+	.string	"\231\036>x\177\352R\253\324\032\230j\0062\001r\256\177\353\323\276/\366\261\243\177\271\354}y9\262\277\344`6\351\244\177\031B/\354\252\326\352e\223W\342wq\221\240b\025\303C\222M\036\234\366\t\377g\322vn\022\362l\317n\331Nmgy\366`G@E-\253\312O\r|QHwg=wT\273t\357\244\266T\341f\026v\337\353\205\r\t\007\2045"
+	.ascii	"zd\355\007\204sk\326\323\251\247\273p2\fs\027\\\371et\351Y\001"
+	.ascii	"7\207\377\2316\343\252\214.\016\343\354\227\206\n\035g[\246\\"
+	.ascii	"a\232i&\260\366\fa\316\342l\017\027\247\236n\256\371c\336\360"
+	.ascii	"(PBp\260\211\360`\316~\354\007\236\214d\0351\342\016w\342a\254"
+	.ascii	"\225\351\201\337\304\350\303\350C)<\370\275\327\251X\357\353"
+	.ascii	"\013\326\322\\\333\337\223&\336\232f\312\254/\024\222\033\016"
+	.ascii	"\361C\224\263\021\345prG:\272!\005\215\b\207\214$\220He\020\022"
+	.ascii	"\206\241\333\220\321-\227\013\nP\342\216\312$\241\220\350V\256"
+	.ascii	"\205~\212pe\356v\373@$\002\204\021N\310f$\"\250\310&T\036\331"
+	.ascii	"~\f\030\227\273\2256$\034\256\264\221\276\245SQ\334\233\033\033"
+	.ascii	"3\2641\263\245\325\215+\266\246\262\204:\247\2615E5iv\334(\323"
+	.ascii	"0\334\377~\035;\236\332\234Yq\243lv\334w]\301\231V\225,2\246"
+	.ascii	"\231Fk\255U\364\372_\354\246\300\300qM\251\270\341F\331\340\216"
+	.ascii	"\253\263/\333\t\361Y\260H/LG{\326g7\314.\310|R\250A4\306\234"
+	.ascii	"1\004\221HF\206Jat\f\220\002\031J\342\006\020hX\233d\231\003"
+	.ascii	"\024\326\031\375\244\236\2172\312Nq/C\223\257\250C:DZY\216l\013"
+	.ascii	"\352\225\201\361\f \343\276{\230\021\235R\362\200\005\027\213"
+	.ascii	"Z_f\312\031\357\306l\345\227\177\037\211+\0161\347\311i#\bDM"
+	.ascii	"T\307SD\017\202\305!\303\275\243\203E\343\350\332\227\273\031"
+	.ascii	"y\267\312\205TuBr\245\030\237 @\243\303AJ\177V\262\363\303\223"
+	.ascii	"\343i\227\"8'!d\202\bp:\240\250\217(\2547\005\360_)\331\267\360"
+	.ascii	">m\316\220R*\332D\351\037"
+	.text
+	.section	.gnu.lto_isPgChanged.36.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\016\003=\027"
+	.string	"&k\230J\260\226Q:\024F\365r\213\013\3155\236d6\"\301^.S\373\306\223~\207\\\215\256\227\033z'Bl\350?\337\200\023\021\273\366#\376\365\3457\243|\003\226\375G\277\211n\030L\274{\213\t\346\036\375\033\227~B6!R\312\024\206"
+	.string	"x"
+	.string	"\213"
+	.string	"\325\027\245\204\303\374/\215}*Z(\242\235\325j\264\362Q\353\361\300\023\234[\376\2702t\313sit\313\377W\200St\243\031\244#,\004/X"
+	.string	"\247\264j=\326Z\305\032\255IK\262\331\350KS$%\t\n\217\326\214\t\201$M\255\225\376\312\223iIRfI\n)1!\022i\240he\342%\364q\2236W0N\304\204=\222F\334q\2655\226\223\204>f\323A\255\365\034\024\226\330\237\373\237\367?\302\337\013\002[\306z\251\226\207F\256dy\202\342\361\326\177\354q;\375K\3266\376\224\037c\362g&_v>\214\311\217\355q\367\305\344\303\026j\367\365\342\273^\374\023"
+	.ascii	"\337t\361\351\311/O>y\362\333\3443\345/m\203\226\022\t\341\006"
+	.ascii	"\261\324\252\264\305\245*)\201\270\370\277\337\033K"
+	.string	"\025\2646.b8$\350\033\265RBk\343 \206VZB\377kK\376\213\376\327\377>\016\315\310\002\235\323sB\025bo\204v\223\315Y\277\"w[\330 7\356\006\303#3\236e\n\016$e;}\267\243\030cd\221m|Lo\223\025&Pf\035\323\013\354\002\333WQY\317z\246\352\327E\352\027\326\007\006Y\257\3242q\013\225g\330\036\032xp\3209k\255\333\2155\325\244\310W0\210?\372C\364\245\211#Z,\261\302\344\211\217\265|\300\326\356\320X\303:@\025p\330\343\255/\325m\253\343v\326\352\313\371\346\350\301}W\020\321\357\271\301\351j8\035\315v\3335\356\266\353\333n~r;\335\355\246\203\363\341\001\312\331j@>;?5\333\316C\355\206\300s\272\333\256\366!\227\333\325^G\336\266\361Lk\226I\233uu\322\177\230\246\341u\357\256\206\351\005\226f\315\236\315\023%\200\313\246m\366\377"
+	.ascii	"\002o\360l\006(~}\364o\221\016\033\374%,\221\t[\232\315Y\301"
+	.ascii	"%\n+\244\002m\023kJJ\361\211\013\310Xb\242\355T6\331\264\251"
+	.ascii	"\n\254\3139 p\242\t\f\352\001\235\231\240\312\fl\333\260\223"
+	.ascii	"g\007Y\267\\\204\262\254\270\307\243V4\2114\t\327\226\222\"\320"
+	.ascii	"A_l\340N|0\326\261q\257\361\037\356\373|l@-p \027}\231y\205B"
+	.ascii	"\236\bDa\b\217\357U\n\366\2638\321\240i\272\255y\313\214\335"
+	.ascii	"\344F\340Z\203]j\2335lN\021ga)&p/`\341\271\255\233\026X\"G\034"
+	.ascii	"@\230\325ON\035\253K\346n,\202\344\214:\3203"
+	.text
+	.section	.gnu.lto_appendSettingsToEEPROM.37.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`U\020\245T"
+	.string	"\252\217\330\037Q0T\312I\007\027\216\t\207jQ<m\355\177\224\273\270W\201\255\263o\254F\022\375\242\271m\202)\021\275Z\303\006\355;\376b\254\003\262\220\221\234\357V<X\217E>^\016\020\267g"
+	.ascii	"\325\026\305O\212\346t\274\333-\246T\313\247~b\t!R&\031\356\001"
+	.ascii	"\271\001\356\001_XR\350M\003\316\265\021^\211\365UV\276d \202"
+	.ascii	"\256)\2531Y\231\364\332\214b\304\344\320<\r\221\233\331\024n"
+	.ascii	"\210\354\323~f\227\267$\334\314^\314(\207w2{\265\345\225y\272"
+	.ascii	"\203T\0237\004%a\227w\323\334\235\332ky\017\347\362\037\376\345"
+	.ascii	"a\216\266<1\017b\352c\242\216r\310/!\2407__t\372N0Gr\b\223P\200"
+	.ascii	"\fcC\255\311\037\250\227\0031\365\263#\317\262\001\211&\256V"
+	.ascii	"1\030$\321\262\233M\275\313\246\375\254\2225\353\344Z\262&&W"
+	.ascii	"k\325\201\336\374\225>\234l\352[J\b\252l\225G\f\251D\\\255E\007"
+	.ascii	"\320\233\\\177\037;\017SOJ\375\252\222\265\270#3v\251\201\336"
+	.ascii	"\fz\321y\223\357;o^\354\204\037U\262b\355\332\264\222b0n\356"
+	.ascii	"\f\364\346\001\tLm\212\204\204\312\b\003\220<\\q\221\2535)\243"
+	.ascii	"c0:\277\216go_\3073\270\227\311\257\317\356\312\364HGFED\276"
+	.ascii	"!\241\240\036\320\217\017\257\207\007M\332\235f\331\234\356\251"
+	.ascii	"\2164\201P\313\f\330\217\256\254\231\201\215\2500\251\341E\273"
+	.ascii	"\034D4\334g\245\374\271]\211\255X\205\207\326\334\3442\212\021"
+	.ascii	"\233\223\302\244\206\013\335\t\302R\224\201\255\350\305\275\263"
+	.ascii	"\025\243`)z1P9\300V\032\026\316V\334*\213\330p\021q40\376qA\355"
+	.ascii	"JX\212G\366\331\345\240\302\004\312yJR\230h\275\207\255\250U"
+	.ascii	"\376\260\024\2370\217\332y \325\030!\205\t\224\243AH'O*wH\260"
+	.ascii	"j8[\321X.`'n\314\261\024\303xw\264\227Y\214D\b\341\274d9\371"
+	.ascii	"\371*\260\2337\214n\\p^\262\232\274\034\002eYq\227+\246D\231"
+	.ascii	"\343e\t\313\037\232\265\253\243\235U\310\262b\336\345\250\265"
+	.ascii	".\023\263\230|M|\227O\354\356\n\273@Z\001\375\273j*\364\354\253"
+	.ascii	"\275\324\301(',\213\247\273\310\334N\032\026c/\367\271\024\207"
+	.ascii	"\275\225\233\233\346\220\206\271\360\252\265\352\304\215s\336"
+	.ascii	"\374\331y\302%B\020\347Tq\035\332]\373\267\231\032\222bRO\331"
+	.ascii	"\246\263\354\bX\244ZR\036\370\304\262\277\326\206\\\263*k\255"
+	.ascii	"u\327]\373\300\321\216\274\360\252\265\322\230\321?\214pscU\\"
+	.ascii	"\267*\370d\216&\001J\334\235`\007\237\270\\v\\\233\213\263Z\300"
+	.ascii	"\313N\334\331]\3730f\200(\302\374\327\327\016_\312\313y7S\251"
+	.ascii	"\240\373Z/\b\233\352{\004\224)H\272\2736=\337\037\220\301\261"
+	.ascii	"b;\233\304\273\027`\300'\276\217\366/\031\036\213sq\302\246\332"
+	.ascii	"M\n\271\273v\377!\322d\321\262=e\267\307\313\324\343\365\240"
+	.ascii	"\307\033\244\307\013\304\210\267\203\036/\007?|\370x7\350\361"
+	.ascii	"\366\350\361\362\310`\207\016\037/\016\037\357\215\213}m\324"
+	.ascii	"8\230\357\214\345\005\340j\276K.\236\374\266x\231/\013\245\037"
+	.ascii	"\021\357\n\"^\025>\336\024D\274(|\274'z\274&z\274I>^"
+	.string	"\244\"\336\243\"^#\"\336\"\037/Q\217\327\267\274C@\274B>\336\240!\336\336\362\002\t\361\376\274\313\327\307\344\345\005\361\366\230\274<\313\213\002\361\356L\336\263\307k\002\361\226\313\333\313\373\017\222\326\b\333\266 \2734\\\262b\325\335\251k\346\230+_\373\333\374j\3762\277\330\237\374\267\374]\376\263\037\314?\346\274\335\357\211x\034\247\277-\324\361\213\323.\357\315\341\b\371\333\3768\236\311\t\201{\333\263p4\003\023b\317\346n\313c{\333\324\333\fy\035V\036\271}8\242\021\326\3163\244\254U\n\216\2679\003\307\262\2608\037\266jKy\213$\334\260\361\r\t\365\322\020\317\333\222P\337\355BqoN\326\256\326,N\020dC\301\271\243I\035y\325\350\006\216[\346\306\252\3100W\032\246\302\rK!\332\t\215f\3049\020pP\377tp\211`\335o\330T\333\353\240.\200\247\227\267z(\340B\212\325"
+	.ascii	"\224^\007\333\260\352\f\263\340\340\222\n\221\244WQ\222h\\\033"
+	.ascii	"5!\024]\305\027\202\200\032\210\212\r\366\351\037%\351\022>\021"
+	.ascii	"\210\247\177\032E\234\0175I#\353\261\223\036*\334\254\300-\244"
+	.ascii	"X+\334\324Z\027\270\271\314\0027\t;or\255_4\347M^\177@\266\246"
+	.ascii	"\247y\232\327_\237\356\351\323\271\242\253\342:\236\026H3\261"
+	.ascii	"\255\245&H\310\001\225>J\355\323J`\334\247\233\312\354\n\331"
+	.ascii	"\233\275\324\271\233f1\226\224\221\327\362\022V!]"
+	.string	"a\233\244N\330\t\332\315'F:`H\374t\327*\360\204\367\343\205\035t\323c\032\345P\214E\310\325:T\262%\357\227B\231\026\030\024\306\225Z\t\023\323(h\255\303$\214B\252U\272@L\243\2347Y\364\214\254\262:di\254\330\216\217\332\017e\250E\327\343\243\267\344Q\352_+\331\r\340\276\223E\377\350\"\\K\344\fo\020r\035\3636h\245\366\021g\224C\006W\266U\336\350\r\272\227\030b\341o\332\211\243ot\253\031\322\231\215\243\237\346Km\350\310\340\314\350x\177q\362h\263\227\207[+\352.u\366h\036\235\224ve\024r\335\376\314\24600U\312\205\326jEc\271\246:\244]{+O\347\315\036\3753o\241d\214K\022-mC\370\320\245\007m \031\001\274k\031\322*|\"\332?$M\265\002\360\3313\372f\376%\275\302\242wSd\372\305'\356\002+B\f!P2\204@\371@"
+	.string	">59\001\317&`\004<!N\30062\204\215"
+	.string	"\231\214h"
+	.string	"\202\323\017\360)\nx\244\351t2a\210\006 \024q\202\202b\352\001:\021ar\002\032\211B\233\200M\035\025\345\324\324t$j\267M1\210<\001\241\234\234\202\b\031\022B\221\247&\031E\2060\021\221\321\004\214\222\021\203\305>A9\001e\030yz\002\312\340U\275\247,\324\327\016Wa\216l\364\2148ff?G;z\007\351\305,\214y9\007"
+	.ascii	"\200\336\034U-\334\022\266\0349\213\032\363\217!\255h5A7\243"
+	.ascii	"4*\032E\257\3502E\253\350\003q.\233\206\246\350\002\336|\341"
+	.ascii	"3A73(\372\3071\r\214\237h\033c\204d\302\004\323\370\304\023P"
+	.ascii	"\312r\250GE\031\274\260#t\344\002\266T\324\002k\210\334\022\252"
+	.ascii	"\321.\320\306,\225\310\254\263*b\326dyb\344sq\2542\034T \332"
+	.ascii	"\321-x\370\245\316\240\277\346h\021\\F\265\242\337D\203\221B"
+	.ascii	"\341\365\345\3049\227:\223\332D\233\\\206[^\244\320\037\222\032"
+	.ascii	"\352Xfn\314\007\243\005\323\324\326\254\232j-`f\023TK[\333\321"
+	.ascii	"-\034\311\314\031\213\372\250\221v\364OG#\365\227H\036\365o8"
+	.ascii	"\222\t\033+j\243F\340\205aS\235a\261 \032\243\216\361f\214\251"
+	.ascii	"\213\372\344:\326a\300\f\366\004\274\210\204\b\262\341\023u\264"
+	.ascii	"\213&\352]\333\261\316\025\235\005|>\350v\376\355nM4\334\324"
+	.ascii	"ju\342\337\340\202o\270\313\333\016k\303\2478w\203C\240Ht\020"
+	.ascii	"\347n)\026\007\335A\377\212\316\007Hs\320\217\363\022\031\303"
+	.ascii	"Z\020WetA\344\334-h\304\322\270\333\313;G328/s\252\200t\220F"
+	.ascii	"\242\003"
+	.ascii	"g\203G\360\225 \035 }8o\221D\213\257w\203u\356&\2654zd\306:\342"
+	.ascii	"\234\363/N\246\366\231`\3073!\\\331V\325=h&\270*7\244]\353A\201"
+	.ascii	">\250a(\245\024DJ\215\210\210\314H\222\2441\361\004\304((%L\017"
+	.ascii	"\022@6M(\031\233\232Ik\024\366X\003\265jA;/eLU=pz\230\324\276"
+	.ascii	"\327Se\267\216$\275\316d9\314\356\t\205K\245\342\002\302j7\350"
+	.ascii	"pd\271G\314\343A\006n4C\3133\344:\303'"
+	.string	"\361\312n\365\367Wh\264\310\025\223O\325\004.ee\315\250\212iX\275[m\232\013zM\317\372,7=S\217>fL\243\273\257\261T\254\231E\347JN\005\205*\355\273\325e\300,\0341\326\316J/c\244Z\237OR\034\315\013\233\216\024\220\261\210\277 \302,\324R\207:\244\026\311\313_u\331\030\266WgxsbB\244\261L\212\260\363\275\013\354\376\360\376\n\233\024$\231\305\177*8\227\251O~!\b$\256%\031n\312\305\344{\236\n\320\337\220\323\bi3\274\352\216\255\217\313]Te\032\035\355\216\276\361A\365\r`\"\362\3120\2204^\267\240]\202\274b\260\346\3019\216'\375}p\363\373b\357\026v\342\342\034s\262\217\344\345\351\231\321\367#\030\241\235\017\357\300\256\212\004\361T\223\345\231\f}\0025<\253\265\271p\317\030\345kU\315\336+\363)N\3504p\213A\345n\223\004[\330C\267u"
+	.string	"\013\345]*f\351\330\356\246{\206\023'\370\376f\252\266\275A\233F\246\263\336\202\363l\016\347\204\233\007\022;\355\317\351iq\261\246w6\302\232\345#\213\323\245\3708]\326\024c\264\016\250{\245\005sh\366b&\005A!\366; \246\217\367\337l72\331uN\277\305\271\257_\277\322]\231\266\201k\243\266\fY\367\3230;\220\210A)\322\264B\261\304\t~\232L\342\217~\216\013\367\204\306\350\025\251\305\304\247\243\347\321d\024\214\007\255$kIQbe\314\n?\026}\341(U\"\321\302 \033\220\265M\340Y\342\223`<\001\363\363d\"\244bq\264\220\372"
+	.string	"\276\242"
+	.string	"x \006 FG]H<\335\007{\232/\b\003\227h\361~:\273\210=_\230\260\351m\342\300\222\2255Q'}\310\2560\263\r\332o\"\306\321\347\330,\211\2534y\300\374Y\342\216\220\027N\003\033\017\236"
+	.ascii	"\f\216\200<y\032\257G\242j\0209\2160\324z\355\322 \362\035L\221"
+	.ascii	"O\326[\330\316.\2174\314\321\360\333\364\253#\275\023\025\346"
+	.ascii	"J\204T5\224\364 ,\311}2\361\262\232\371!w\261\322\272\024\321"
+	.ascii	"V\321\r5"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.38.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`F\n\3659"
+	.string	"\352f\200\026APdN:\243\274&3\215\272R\221\033\323_k\273\341\325\004\374\3034a:\r\025,\276Q\307"
+	.ascii	"`\233\2234G\271*\016\nB0D0N\257\210&c\325$\"\320W+\232\362E5"
+	.ascii	"K\244\311\235dT\001?\001V\001MEs[t^\207\353rxE3\021 \027\363"
+	.ascii	"\327|\0163\221\277.\207\037\244\211h\356\336Kt\303\1772\361\315"
+	.ascii	"\341\214=\016\r$\250\334\237\256\341S\t\352\325\360\371\330\274"
+	.ascii	"\315\330\367\272\336\346H\316\217\3139|\223\372\305L|\332\314"
+	.ascii	"c\374\272\207\371\335\311\374\314\365\230\210\346i\306\236g\303"
+	.ascii	"x\361\\\244/ri\\\f\237\332{'\265I\305{\231\261\233\001\373]\336"
+	.ascii	"\253]\221{\376\335\353\203\305\360\351T\360M\352\230\260_\346"
+	.ascii	"\375\005\224\263\363w\2573\205\230\034\301[\344j\213\332\225"
+	.ascii	"{}\220\270\335\301\214\335)6e\346\274>\210\312(f\330d\030>5\336"
+	.ascii	"I}j\337\244>\375\027\035Se\316\313&\314\023\345\357\013\204\247"
+	.ascii	"<a\370\224)\\\030\343\025\n\255\214\220\0049\27342\200\367:\253"
+	.ascii	"\032\n\253r\315<>r\315\274\276\007\235g\241]?\024\252i\260\355"
+	.ascii	"\312\027^\005\347\334\334\224}\030\024\242\261U9\036\037E\202"
+	.ascii	"V\214\376\366\316\267\264B,D\256\n\257\370\2366y[\303l#\362t"
+	.ascii	"ES\317]\037\2326!\017\006\037\274\321\t\342t\247\t b\333\231"
+	.string	"\355b\033Zp\352\336{\275\333\2656\245\265\302\253{/[f\333\2173\322\231\271\216\231\323\230\221\022\005j\260W\272\325\013Q\311\362\204N\034\343\370\203\376\267\326\261=\321}\304PZ\240\231\215\362\224\275\232\353q\0302\231\261\262\354\231\334\240\257\t=\35325m\270\213\251\335Rm\367,\337\2246\312\314 \356G\314o\004\013\347\272/(J#\235\021\343(\330p\"T\333\215\347\316\2179\304\371\210\030\336{v\344\353\371\236\021\254fi\352\001\234\362\224K\234P\337\232z\346\3565;\023E?\317\317\316\314F\037\025\244n\256\033\216W\365\375,w~\316,#v\262\314*X\3303\337\n\360\350|,\372Sv\031\263Si\033\216\371Vq\214\376\270\2350\027-g\025-{(Z\306\352p\245\301\252h\371\250d\331\302\277\234\251\034,h\313RE\313QE\313\005\3322\324\367\316\003>\346\374\264d\331i\311\262"
+	.string	"\243\345\246%\313LF\313KE\313\306\242\345"
+	.string	"E\313E\243e%\243\345$\243e\242\3212"
+	.string	"&\313HL\226\207K\226\205F\313j\321r\032\300r\260h\271\225,\377\303\f7l=\332n$z/[\324\321\205\246{V\036\347\337\373\277\374\316_\314?\3467\363\347}\310|\276\235C\267.\207k\004\253\232\372t@'=\271\243sf\031=x\357\275\302\006oR\007t\207>\337\207\202\232\274\255Yj\241\021\274\227\311\206\307\371\377\304\b\033\251\001\\ih"
+	.ascii	"\375GnH}-\315(\235\235\260\207]A\t\257kv\310\312cx\357\0356\225"
+	.ascii	"\237]V\013[m\222d\020\225\265?~!Nm\r=\365\324j\013\363$\351K"
+	.ascii	"\013\204`U9\177\256lG"
+	.string	"97\323\247\b*\325\366\247\005 \177\256[\216m\241\237\026\230\024\325\307>\364A,P\240ue\360\002\261\204\374\271\022\341\343\237\017\3765\021\335\365\241)d\321\036\325X\r\205\250\016\257M\253\266\032\211\352\327y\202\035u+\222?\303\370XT\276\331a\026R\317@\315\352\264\377|:\327L\244\354\303;\020}\230\352\241\263\232\300\233\264\"\3129\274&\261gbVib]\302\237\322\245>\365\320\237\363\004kvw\200\352\270\313\304AkS\033\216m\333\262[\313\027S\237\226toA\251\206\3525f*\373G\257\212\353h\364\374\006n\205b\317\\\320\177\366\265\201`\203_\245\250W\3633+\025\013}\254\254X\352\240\313.c\250>\023\306G\244\"v!\206\247r)\225y\225\373\231u\013\037W4\001\315\035R`\355\275\3477\001,\203j\253F\325V\215&\030\311/-dR\335B&;\211\354z\201L\336"
+	.string	"\033&\2210^ e\250ZI\255N\"o|}\305P\265\222X^/\270`xemqu\200\201\274\221D\342\360\342\022"
+	.string	"\006\206\324\322\n\003\023\262\026U\327W\262\006\022\331b\213+\206\327\227V\225\027\327\213\256*\255$X\025\025\002\376\252\201LV\335\370\372JV\021\235f\017\n\237\332\212\252\017\365\303\0075k%\2139s\210\0013c#\317\251\273\254R\236\342\350\316,$\240\231\332\251\203d\226oM-\340\317\365\370MSG\360\2633#\013d\271\254R\216l\265\330-d\203\230\214\020\231!KfH}\312\324+\334\326,\262\373RS\355)m\024\021Y#{\346RG\341\361A\027\375\235u\031{\260d\213\310\032\321A\317\302\220=:\333\00256\263P\2006\266\335\223\346V\240\213\035"
+	.string	")-\210R\027h\266i\201R\356\240\213\r\245\267\f\034&\265R\177\351\310A'\265\201<Q\326\304\275\212\350\300\252\211\255\346\211Sd\357\310\242~\2140(\373]\030\037\237nc"
+	.ascii	"\017\231\331(\017\033\2161\270\251\f\030\245\274*W\265\037i\036"
+	.ascii	"\002\034\320k\177\376lx`\004\251W}\275\237\007^]\217tA?\365\232"
+	.ascii	"]\262\252\r\357]\236\3116\211U\262\242\005yMc\006\200\306\250"
+	.ascii	"A0\305\020C\210\031\221\021\031\231I\222\016\200\002\221)\253"
+	.ascii	"z\021\260\255d%)HA\n\205i\016Nz\272R()\241\251Y9\377|\346\"\006"
+	.ascii	"\350\024&\223\211\231\340\004\3329O\024.\305\2403\235d\314\364"
+	.ascii	"Lc\020Z\256[\273a\212\r\351m\033C\020\353\212)* \305\362\203"
+	.ascii	"\f"
+	.string	"\023f2\035c\225Z\245h\322\303\371\335\357\301~od\013\347\305\320\306\312-Q\376w\273\030\221\"\277r\301y\242+\005\245\345\006\274\237\316\3627& @\270~\302F\272\b;q&B\221DV\345\245c\206k\b\317S\264\"\3501\307q\301\033\221\274-\271f\002\332=\207\tKqL\275\352\352\316.h\307\244\235\222=\003\206dY\376\276\302T-\245\341\270\017\220-\221\bK\020\216\205\317&2E9(\\\270\020\240\207\204\262#E\242}\345H]\230\243\036B\023\r\021\225\265\306]S\306\310Xpb!\213\341L\237\274\357h\300Vhf\370\241\322\016\230\306\276#\3242\2544\0163\231t4\341\363y-\033r*\213\004}i!\217b\317O\3122\276\341\2456\2665N\374/u\241}\017\036h\250\367\200.\264\237\352\212\266re!&3\226s\035\332\322\2260[\241p\330\260\313\327r\205\215\323\224"
+	.ascii	"\201\334`B\327N\363\261\214l \022\276\032\205\\\344t\256\322"
+	.ascii	"\013D\300\211\026n\212k\251\244\013\254\361\245`t\r\360\023\217"
+	.ascii	"+\2104{\324\250\360\354j\260sO\223X\017\316\246\340?"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.39.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\035\006\305#"
+	.string	"\nB(\016H\220\\Q:\004\253O\007"
+	.string	"\3254Q\246\240\214;#\225\356\211\307\220\332\200s\366E"
+	.string	"\220<\034\227\364\257\231n\226\272n#U\244\336\256"
+	.string	"Ep\r\021z6\221\377u\307c\361\327)I8\004\201\377\366\177B\b\331r'\031\321"
+	.string	"\275"
+	.string	"\314"
+	.string	"E\260px\024~T\222\253\316\3441\275\027\320\227\365N\216\344\330\237\034\n\322\323\027BI\351-\306~C\264$\240/\205\016d\276\264\3671_\262\003\bH\207\202!\344K\357\f\263i\b\027\024\327\275i\355%7@_2\0223\233\247NW\300\3231(\205\353\336kk!\334\267\351\031\255H\237\311b\260\027z\232\245\355\212\304\207\025}\237\025\370A\203\307e6\001\323\225\r0Mj\216\204\310\243\306\220\020uT\230\005\232QD\3700\304\0356\201V\226\255#_"
+	.ascii	"\tq\251\276,O\030b\016\313@FEO\nAh(\375\304q3\030\005\254eU\272"
+	.ascii	"\265\361\246\025\223\254\320\275\367\310\327a\361W\353I\341\336"
+	.ascii	"\313UX\244q\246\235\231\271\230\271\003s9\025d\200L?.\361+=\364"
+	.ascii	"\336\033\201_\345V\212\370\307\227|\303\225|\234\371\262\366"
+	.ascii	"\351\253\322br\362$F\355\342\364\336\333md\030\346\333D\022M"
+	.ascii	"R\225\303\262\312l\244\242^\370\226Iu\361\361\252\314\271\026"
+	.ascii	"\365\302\240>\3627\002\253\262\342h\375\332\307\234\372\376\333"
+	.ascii	"F\346\3776\020\346ZW>`\340R\347\241\247"
+	.string	"\347 \240\037\237C\235{\236<\003xe\236W\336\261\225i\266\362\354\225e\257\034{e\230Y\371UVF\313\312\247\255l\332\312\345+[[\271m\345\372\312W0\200\316OL\324\023\221.\223\336\031]snV\251\305\310\245\376\344\017\365\247\267\314\237\"\325\263\227\312\215Q\\\320\024\226NP\311\247c]V\005\227\352\271\312\374iX\367\2109N\t2\371\325\256\377\026m#?\352\277!eU\304\374\226\263-?\365\236\0362+\370O\327\372[Kc~e\244\230~\265\253\236\257f\356p2\036\306\240\375\352rM\260\016\202\363\225y6\332\007^\035\f\321\245d}\370B\364\300\351^\340\205\374\253c\205\260\"\210L\"\363\345\331&\222\3072@%f{\351\021\260\242z\331f\227VF\274K\017\345R\366\211\344r\274\331\306\251\333\326\221\260}3ijd\365\275\327W\266\221k\255\375QG\271\236\250\004\251\272v"
+	.ascii	"=<\361d$HU?\365\003yj\022\244\352\037\206\t\324C\276mck\351\005"
+	.ascii	"9e\271\320\315\3373kw\333E%*\217\305\021\216\307+:w!pGF x\272"
+	.ascii	"\"\336.\266\333\341n7\027\273\223o\013\216r:\0268\\\211\024F"
+	.string	"(V\344n\266\025FEG\266\233ng[0\3049\0268\235\215\227\313\351l\261\364\276\2010\205\030\375\363\315X\250\226\257`2[\270P/d\004i\336d%\265\217y\353\310\321J\306\323\225M\006\236\276\223\032\024$\025\022\333\351\007\321\260\323G\336Z\371\370\265\357\\\005\246I\r\314\242>m\300@\267\257K\222\344\201\326\352\005h\323\343\214\322P\323\372@O\300\002nm\370\232\336\333\250\031\352O9\0067Kp\226<\24153\207\243\351\005p:c\245\b\335\004\365\254i]b\001\217\374j\327\f\213\370\26219k\315\026@\377\364\220\317\236fk\201\332\247\207\262\266\020kX\313:r\25018\004\031Dfdf$\215\244-t\220\002\221\301\251\036\021\220%D\204\246\240\266\016\352\223\030A\255\357\250\347\232\335*\212f\326\205\223\f\253\252qr\233\225\260\204,1^\276\236\335\3211g7\262o9\205\253\351"
+	.string	"\374\317\027\325n\242\260\232\356\013\266\346=5O7\260\331w\f\224\275#\264r4\371\360\340\b"
+	.ascii	"\264\247\345q\212\021\227T\217-\350*\227\201\326\245\2110\237"
+	.ascii	"G#\334z\305x\227\326\213\362\227L\035U\247G\225\347\271\3015"
+	.ascii	"O\306\002 u\234\372!\345rgaw\020\025\241>\375r\351\241\210U\r"
+	.ascii	"?\333\324CqT\007\036\030\277t\203\027/\031\rq\375/HLb\333\254"
+	.ascii	"\bv\354\242\364p\320<:\rp\301\035\341\031\007\001=Dy\232\200"
+	.ascii	"e\235\351\322/*\r\256j\b\005\302+\326n\247,#\333\367\376"
+	.text
+	.section	.gnu.lto_configSnapshotRecord.40.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\004\002\035\022"
+	.string	"\266\"zH\340\360&\035\353/s\344s\323\022\032\310\267\006mgk\306t\273\1775:Fi\023c\\\370\223Z=\214BG\212\nt\320\344\277\221\331\330 \336\212\253\030\307\275\2415\365\342\225O\306\002\352i\301\326\006*!\233\020\271S\nb"
+	.string	"a"
+	.string	"i"
+	.string	"6\371\264\226o\315\002\260\321s\203\333\335\220{n"
+	.string	"Ji\377\347,^>s\001\361\330\231\361\206hw\246\300\f\300{\236\201\266\375\024W\361b\030\020\232\325ypb\311\306\246\264\273\341\202\007\230\367\346?\346=\035q\230K\030\377\343#\274|p\300rb.?\222\335\265\204\345\350\334z\333\blK\260\345+\366\273\335]\353\216\375Iw|\322\251O\032\365I\237>\351\tJw\237\375\372I\337\003U\343(\347<\271]\234\\\216\245\341\311\3409\355\376\326\304\220\334\340z>\340\226fC\374\027\027Ry\315\025d6%\225\026\017Zy\315\023d6\237\025\337\366\233m2\313k\276\tY\315\304b\233\356\251\375\342\217\0016\206\217%\036\371\370.IV{\031\271@\212\361\223\242\024\344F\220M^\244:\351\203.c\343\221\332\253\217,\217\244F\037 \030\322|\202\331\241\327\217\367J\310j\243\321\r\004\201\334Y3\245\035*\240\310&\366\2229\377\346\223\023q"
+	.string	"wgF|\030\036P|\022.\363^J\177\273\214\315H\312\261\342GF\346\354\331K\252\210\336 \302r\205,\327G\006\261\245Z\211\223\265\022\325*\021\224\226\350Z\255JX'\032RZ\2520\345\304\004%T\211*\241\210\001\267\\+1\354\320j\211\241\311\266g2\327\235\241\027\220\321\227[\272\335\020\020p4\332?t\0072 \024\261\017\2306\0050\251S\333\302\307\013S;\275\315\322\351.\232'\235z\241\037\200\375\340"
+	.ascii	"\335\226P\032$ `\"B)\271\001\242L\2434\277#9C\224\334\347\206"
+	.ascii	"q5d\260\255\214\202\317\001\367\217\311\303\341b]L\021\313`I"
+	.ascii	"\313\232\255?V_3[\272\221D\263\342pFD\255\251\211C\027\230\204"
+	.ascii	"\231N\300\306H\034\337\362\330\025f\327\347b>\237\333\256\021"
+	.ascii	"H1]\206\f"
+	.text
+	.section	.gnu.lto_getConfigSnapshotSize.41.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\023\002\255\022"
+	.string	"\226\343|H\340\320(\035:\3075\232\230\r.\365c\365\255bE\277PY\255[)?'\364\374\240\356\341\203\t\211\033\025\355n\305\241\017&\231\352\360\324\257f\021\306\270\202N h9\340\030\266\245\027*4.|\310\3246\262\267\334)\005h"
+	.string	"a"
+	.string	"j"
+	.string	"\323\013H\237~\212\357\264\270\025\001\346\nGth^rE\273\270\322\201\023\370>\345E\276O\025\341\017\207\306\007\007\016\215\317\356\022w\313\330\372\224\032[\376\355\020^\265\236,\334\360)G0\230\022\001B\2304\341\r\001=\3678\013_Q\236\220\271>\367iS\333\311B\231\307\221\203\335u\224\2051\367w\333k[\202\035\033\004V\020\366\214\006A>f4i4\243\347{n\275\355\2162\372!"
+	.ascii	"rt\b_\013\332\205\351\361X\241\td\342=\277\355\321\276\277\342"
+	.ascii	":\0334\313[\3709\264\237\242\335\005\217\363s,\316\323\362\236"
+	.ascii	"\025\001{c\037\362\320\251)\301\221l\026\033\374\274\335\342"
+	.ascii	"\337\f\336\326\372\306\3549\024\351\320\206vq\n\036\251\357\262"
+	.ascii	"\224\206\204\340\261\341\022y\227\273\273\322#\027\371TA4\305"
+	.ascii	"\246\266\213\345D\275~\350\247^\237\273\334\241\375\360\354t"
+	.ascii	"=\276'\370@\235\352\030\373`\240w\224\217\244\240\026\230\361"
+	.ascii	"2\363\212=_g\325_\\ \355\272\224\370.2\250\370$>\375\025\275"
+	.ascii	"\356q\246\306\016\236\n\233+\366T\027\004\013Uol\334+\336d\004"
+	.ascii	"o(\266@rZ\225N+\221\223\211\245&\r(\025\351\023\022\024\025k"
+	.ascii	"e2M8\241*\244\250NJ)(\n(\245\023\226J\211\004\201U+\023\253\204"
+	.ascii	"A\245b\225@\234\353RF\035\351\314\366h\200\220\216\233\220K_"
+	.ascii	"So\314\300\203\202\350\210\027mJ\275\206\366\203Bu\366\334\037"
+	.ascii	"\020\321\270\37501\"[\364[_\324\231\214\024i7v\231\017\3431N"
+	.ascii	"\022\025( \200\002\231\273\342\001\336\030\246\236\016\315\360"
+	.ascii	"\232\305\264\223\327\212\030\322\333\332\362\252\253\216\r\326"
+	.ascii	"\211\365[p\005\254{n\213\b[\201k3\303\naT\224\246#1\005\264d"
+	.ascii	"\271\212P\265\270<\264\210\306\351\307k\202\365X\322\r\017\206"
+	.ascii	"\023;\332\302\004\007\271 \224\211\3403b;\b\230\262\351ZO"
+	.text
+	.section	.gnu.lto_getConfigSnapshotCrc.42.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\353\002U\027"
+	.string	"\246,\233H\260\032Q:pUM\233\256\363n\233\2113\310~\231\276)[5R\206Z\311Go,\306"
+	.string	"\216\006\t\264\320o\365'g\"\332\357,S6\0369}\224\356\360\307\t|K\211\311<\334\307\346\006\250\256\257J\376\336[\356$\003\202"
+	.string	"\204"
+	.string	"\211"
+	.string	"\340n\212]\323\351wc\373\2375\035'{\213\375\366\365\354\350u\347\022\234.\003\360t?\344Db+\243\301\241\315hzt\344\350|\3359U\314\005\324S\371T=\345\033[\201\300\340]\001\002\203\207\3453\367\235Rv:Y\312\366?\247P\033\002E\034g\247\223\204\243\323\003\300\2103!\034\365\206\256\273\274\21559\177\2708_wJ\303G\2138\272\270$M\350\356\225\342\330\342[\277\273\275\273\253]>\005\027w\017\3403\232Rt\3033f!(8#3\317n\256&\017\001\307Qo\271\306.(wF\006\006\224\213:\225\036\364\255\307})\225;Ir\271\312\225T\356S(\243,\343}\250t\353\374\272t\021\035\362q%\177\320\217;\357~o\344\274]\323\246\370\222}\224\035\"!\335mB\262\337\t=I\354JN\274m]\362\365\364\350u\263\210"
+	.string	"\236.\250\317\355uG\016\024{\020\212\230\256\322\037\273\364\360h\220\013O\325\3122|\335A#\032>ZlAN\314\356\031\022zG$3O\230\023O\276\227\234/\273\030\376$\003\330\335\314\nr\340fX\362w\237\270\035\242\032\026\241/\004~\227U\024\317\360"
+	.string	"'9/j\362\267\347\255\2067\331"
+	.string	"v\3378\330\017\205\034\366;N\367(\352)\212\317\373\201\033\016HE\021\\\214\254\367P\277\344;V\003\034\3357\027[.y\361\304\005l<[\312g\222\025\237_\316\027\232\374\255IV\336\035a#\003\033\242\306\005S\271`\251\017\341\213\325\n\253\253\0252+d\361\262jl^!\254\325\352\340\022\001\202\304\213\245\"!\302\203\215\212\025\226P\325\030\330\027\254\025\252L\274^\241\312\224\243\235k\354\316I\271\304\267\335-\311\024\031m)\242q\2152\317>\210\201\340Hn\205\325e\354<\361U\276}\367\353 \341\262\202a\370?\277\216m\013\023\311?\312\267)+\260\333vq/\345D\026\346\205U\275\270\342\223\r \242\033y\364\331\335=\231gwi\0024 `\002!t\330\003V\231\241\314\374\306\032d\203"
+	.string	"+ZNC\377\231\305\0356\326\272\341\233\312\374=\342\233\b\217\235(f.\237\025-\r[h\312\307D\307H\2660a\263Q\246\231V\023\300\266\031\263}\335\210?\233p\243h\241Z\335\336\313\254B\313\240bE\005\271\263\201\337\336\233\350\272\352\255"
+	.ascii	"\274\323\r\016\346\211]\333\302\b\007\257 L&\002\317\210\305"
+	.ascii	" @\224M\327{\002"
+	.text
+	.section	.gnu.lto_readConfigSnapshot.43.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`P\b\3652"
+	.string	"\232]P\024DP\236N\007?\260.b\336V\351\365r\016\337\377\267[d\210\230A\fEVBK\035*\277\324\232\322\013\007\277\242e(\365\232\203-ZQ\00701Q~k"
+	.ascii	"x\265\201\345\203\305\335\250m\275\311\336;\311\224\0025\001"
+	.ascii	"&\0010\001\371\315F Q.\2049\2271[_\241X\276\030o\321.'\262\304"
+	.ascii	"h\213N\263Z+\256\327\355\266\n\307\322^#\307\340\333\225\366"
+	.ascii	"<\274\256\030\177Q\274\021\255Wi\277k\267\355R\370d\300\354\320"
+	.ascii	":\321* Tt\273\276~7X\373\024\257k\227\312W\234(\025\302\234\343"
+	.ascii	"0\320\365\236g\263\3540\004\243u\2049\347&_\273\302G\351=\303"
+	.ascii	"\274\234\363SG\300q\016\005\314\345Z\370O\316md\034\304\265\355"
+	.ascii	"\330\245_]\314y\255./\347\270\247N\320\372\352M\334\tX\367\236"
+	.ascii	"\032\007\004\032\024\225\222I\211\223sN\032\271\020\353\253\352"
+	.ascii	"G\326\327\377\321\354\0224\2730K\320\354\006"
+	.string	"]\215\363.b07\026[\"\273\252\217\301\332\353\334B\363\t\236\023\032\346F\300\262\264\273&.\3720C\363\226(a\315\354\314\2118\234U\231\b\261\274\351\201\222\251B4\2148}\352\370\t}\361\252\032\001\226\235\251F9g\027\372\002\253*\004\270\267 \236\347x\006tL}\271)Z\\IY\032~\277\363\016\321*j\326\314\320\034\023%\344\234\033;\241f\336\256w\267\227\356\336\321M\264\022\207\355z=\345b\250\332\234\307\242\332\0073T\265\023I\301\372J\340]\317\013<\245R\322\340\244b\370\260nG\333\026\365\335\332\350\221\357y\376\343Wdn\314\030\236\363\201e\344\252\374\273u\3075\261G\001N\205\364\267u\363\340f\260@\001T\322\345\334\237\034\320\333\311\210\273\311\005\275\231\226\224\212\270\223\274\317\373\200\177\3616\200\344x\336G<\270\tx\024w#\227\272\013\360,\336E\316\347M\344v\336C\310"
+	.ascii	"BN\305;\350\350Ro \214\373g\007\267\217\213\033\300\016\356\236"
+	.ascii	"\035\334<\030\367\216\021\267\213q\033wp\027]\334\255\323y\023"
+	.ascii	"\215\270Y#\356\325\210[}\334_\304\215\213\270=\212\307\320\016"
+	.ascii	"\352M\016s\246qX'\377\255zG\\\320\035\320\275\317\375\213{\026"
+	.ascii	"w>\367.\356x\356v\356t\356T\334\355\366n\027l\007\323n_O\325"
+	.ascii	"|\346\223\307\244\360\310\013\004\\\232\211\372\201yi\367\363"
+	.ascii	"\277/JFc>y\214MH\236\213\266\357\313G\254G\376\261\361\026\235"
+	.ascii	"\256h\367\\\213O\2678\0270\357\202\302\003\3576\245i\334\007"
+	.ascii	"\360?\017|\376\351\177\376\373\204\336\347\275\347w\036\300\373"
+	.ascii	"\231\227\t\013?\262<\337C\364<O\274#3\354\276\340j0\2649\347"
+	.ascii	"\235w\n"
+	.string	"\"-z\327\002\233t\220\350\364J\017\365\356\234\024\357E\342\364\310O~OS:\345U\033\302\354\267o\374\356\r\034\260;\233C\217\367\303\272\370Oo\374/|\2314\213\217\357\332\247\036\242\200\344<\346\316\366\375e\322d\337\310\006w\350\\\323\364N\357\201~\354c\372\365\233\336\3376\353'\367\324g\275\247,\323/\025\276H\220^}\007\343\305%M88m\345\215\357eW\377b\221~\r\363\2033\327\227\364\307_z\267\t7\370\252%\275\322\373\324\201\356\016\274\201O\372\244\233\267\315\361\217\376\3003\271\3717\360E{d\3107\372\177\377\363\366\315\034\334\227\027\311\361\221\336\235\203\323\362\"\301C\337\375!\004v\347\324\205\266\244Y\3627\366a.xE\217\310z\364\307\177(~\201s^X\357b\361\037\375K\tz\177\374\376\2521x\3079\006\347\002\247\030\0168t\021,\201g\360D{dgM\034\235\205"
+	.string	"\213+\211\305uT\226\240\352\300TZQ)\263\214TS\230\304\024f\271\264Jt\251\312\022T^\252\325\026\205\"\226\222\371\032\254\230\313*%s\307J\251\305\265\254b\263\274\260\266\224&X\246\362\352*\005\t\326K\331uu\265d\273\n\301\211%\223K\251\234\302\322\272\332ZV%\267\264\250N$\253\230]I\004G\275\344R2\223^\313%3\351\306\211\r\361\"\362[}\344\023\233\370\363\227\206\315\237\3307\207\030\337\255\033\244\265\013\222\346\340\236 \345:r\200y\033\372g\253m"
+	.ascii	"\031tr\324p\223#\377\351y\206\355\321{\235;\215W\316\f\334\376"
+	.ascii	"\305\006\375\263[\240o\025\013\370\343?\347H\2659\277\356l\217"
+	.ascii	"\343r(\250mA\212u\247\257\355R\254\257C"
+	.string	"j\022\250\337\020Ws\316\2718\365\n\205|D\005\310\017\360\317\033/\235+\304\245oU=>\220\222\037\331\241_\360~\347-\0326'Zp\373n\355\201\205j,\324\327\240\243#]\225\276\250B\241\017\226\365/\326\247\3568^:FV\244'\372\247\007\272\353x\013g\260\311ouE\276\320?\273Q\2509\257E \224\023z\005\001\200\240\250a(\205\220BH\031\032\022\231\221\202D\215\001`\002\221\202\3279\020pg\232d8\376M\272d)f\227\343\177%\003i\005\351\033\262\273)\312#s\240\033\257\210C,\333\202\033\032\275+\307&\004S\031n\"y\246\224m\376\fj\3715\315\337?\323\311c\356`S\027\210\313\260D\326\214x73\202L\206\304m<3Y\345\023Hb@&=6A\315\213\273\341\242\367\003J\216\"3 ?:\007^\301\005c1\322\303\020\030_\207h]4\005\177j\001T\254\366"
+	.string	"y(\300\0039\247:\303\3064:\363;\016C>\007\320\306y\214Z`\240\016\362Brp\237\006\220\273B=R\323\032\005\b\337kEsi\006\304{\210\373\260\262\200\232Zc\305\013\303v\026\003\013\335~D\215k\240\322\2774\211E\004/\223f\263\225s\3008F\026O(\032\260\2708\343\320!~\236\250\272I@\264\342b\037\372\f\333\024\370\252|\303\007\004\242l\024\330\355(\341J\335\315\220\213\203\277(s\254\021^\365\330\226d\312\022\\\240\341\033uA\243'\376\0232:\315P+\254\271H\022\277\\\275\2351\033@"
+	.ascii	"o\360\210\355'\223\b~"
+	.text
+	.section	.gnu.lto_.symbol_nodes.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\267\005]\030"
+	.string	"V&\217M\260\020r:\240\t\336\374>\002\003W\205\324}\210<\353\032\365_0\227\363\332a\357$\2464yH\300t|kv5\372\017\372\217\365\345\312\317\316\216\215.\007DN\353\333P\362?y\373a\017\272.K\301\227,0h\327A\322Zjr\007\203"
+	.string	"y"
+	.string	"w"
+	.string	"-\275\023\276(\022\220Ut\262.'\2474N>\221\272\3116\233\\\302\313\264\232L\"F\301"
+	.ascii	"Qb\227s4&\253W\r@\n3yD\374\275\355;\222\3011.,\230\030\326K6"
+	.ascii	"q\311\261\226\034@T\177$X2\200\225\214S\311\350\253\252\252\252"
+	.ascii	"ty&\246d"
+	.string	"\024\224|\273:\246Z\260'\271&\362\210rP\231d\0211\227e\021N\026V\252\252\277\021\367\346{\227~\275J\3234\305\345S\274\367\216\037\002\255\351\013Y\321\362\257\266\257\324\364c\241V\236l\321\362d\255\374\310\332\312\217\276[\tR\272\216#\371\370\207\257SBd\b\032\361x\217l\335\366\326I\266\373F\r\265E\311\267\332\037\362\211\302q\311\333V\254wp\365Q(\376\r\274?\204\254\363 \3178\3104\r2\f\203,\263 \277(\310\273\004\271\006A\346\035\3106\006\362M/\343\024\310+\004rN\247\277\364^\332\200\034<l\t>\317\272\323\356\370h+\212O\322\366m\b\365T\303\217\t=\360c\301\276JS*\220X\370\270\265\341c_\267\250\332\246\033\276\311\266\211\201\t\t\207O\252\036\370\243\220\205\337B\374\006\342\357\364\265\261a\375\201\341\333@\360C\202=\006%-\265`\177\371\\k\2332R"
+	.ascii	"\241\260\237\200\022jBa\357\351]\220S\021\n\373\254\245\225\237"
+	.ascii	"\261%\345g\353\271\306Z3\027\267\272\331_l_\024\"XL\320\315>"
+	.ascii	"\252\335\355\322\n\243q\366q\355\021\271m\0249f\373\016=\030"
+	.ascii	"9\241\240BGC0\331\315`_\246\247\016R \262\277\332\021\330O\323"
+	.ascii	"\324\247\224\275\327\215e\307u\313\216\325\363f\333w\006\207"
+	.ascii	"\244a\356\274\253\275`r\336\2456\217(\007\215\237'\327n \027"
+	.ascii	"\025\326\223\363c\333\242\211\035\303\030\271\363\275tu^\302"
+	.ascii	"J\303\017d\250a\fG\205\220\210L\022i\223b1\300\002!\242\251:"
+	.ascii	"\021p4\310 \023\210H \"\022\021\351\001\347\255\272\033|o\240"
+	.ascii	"P<a@\211\032\311\234P\321\202\326\033\365m\264B\304\373y\202"
+	.ascii	"OZ~\340\250\204x\371\n|\355\030>\205\035;\201\370x\226\367j\346"
+	.ascii	"\253\203\325\363\261\004}\310\035\2219\307\342sx]IzR:\245\036"
+	.ascii	"w\3202\2027\277o\004\013M\340\021\032W\217\363:\236\353q^\307"
+	.ascii	"\303\305\341W\307F\027\341h\306/\200\231\203\236\301G\202T)\007"
+	.ascii	"\350\212\313-\353kB\300\206\255\342\303Z \345\035\225\025\371"
+	.ascii	"(m\2342\313\302,/\212\020\320\b\250&\273\003IB\003\025\340\254"
+	.ascii	"K\263\017\231\275reR+n\340\374\001"
+	.text
+	.section	.gnu.lto_.refs.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"\255\005"
+	.string	"\022\016&'pi\222\0160\032"
+	.string	"\201\252\252\252\252\252\252\252J\ni\004@\303\230\240\372\377A\325\330\354&\354\260\377\177\204Z\223)\005\352\220\346\003Ze:\224\331H\323\2016\231\226\332\204R\204\332H-J\023\241\351\324BJ\003j\233R\3620\222\346\203\f\030\257\025\354\217\004\353\205E\251\024iZ\201\246\023\265J\224^\236\fO\313\263R+Is2\340\270\360\254\302\363\340Y\312k\"\r#j!J\033\322\274\240\351X\231u\030\276\002\373x2\2171\367\232m\036\363\333\004x\256C\002\t"
+	.ascii	"}t\340\230\271\325\233\266\330jlVW\252\032\360\250`\233*<\035"
+	.ascii	"\212\022"
+	.text
+	.section	.gnu.lto_.decls.21bc4724a7b25ca7,"e",@progbits
+	.string	"(\265/\375`'7m\341"
+	.string	"jH\325HT \214\271\235\016K\177\004\243\244\211\006\214'M\320\004yqT\236,q%H\r\210\376;\2456\205\017\263\247D9\315A\264\212\2205\0041e\363q\211\033\037\255\"\247\301f\303\247\204J\023\354\232\211\351\t\252g\200\257C\241\335\346\203#I\321W[\2232\245\024\b\004\\\004\235\004Gm.\352@`Q\321\210"
+	.string	"\214X\031\324\343K:\342\327aQk\245\216<\376\034\223#\027t;\205l\367g\267~\264\001Ur\026\301\026v\365(\354\277\224\037TOv\203l\273\037\3730A\330\3668\266\235\007\333\236\226\004\211\321:Gh\207\204\354\363\352~t\312\330\f\374\303q\360j\315\205\322c\027\274\204utBf\260-Bw\t@/\342|%\360\f\235\250\320\361r/@\377\363\266\333\362`{\306\276\2569\267\201~u\253\003v\273\021\367\353\2276g\265\027\224\235\253\037Q*\326\263\2078\272\370\024\333\355}|G\305\027ac|Dn\212/B\266\307\255\227\212\220P\025\365\367\206L\333\016.\305R\023{\354y\256\327>\304\361\262\017I"
+	.string	"5\347\034\037\322\202\230sN\213\273\006\356\032\340\033OXhG\334\376\304\372]\312\037\325\022\342c\017b\366b2\346C\306\324\343v\026l{\216\326\311n[5){z!\002\017o\273\326*\3333\366s-\013a\004\227s3'c\211\272d\235\274\240j\316m\t9\367\341q\267\255J\340)\351\232sn?\353.\321.\347i\316v\255\325,\325\311\342\240\211\260,\3110\347\266\335\316\201\370\234\327\271\325\345\332\337\034\316\301\332\333<\035\361r\234\301\007\006\246\202\333\343\310@\220\2634\347\f\200\023\272\265:\250\307]\242\375\307\207\343\320Q\233[P\244\334\220\214<n\032\330\243\1778\236\240\324%yQ}\3343\364\370\252\304\263\261\307\r\003\333.\260\256\346;\334\352\201\257\265\243\371Y\033s\332\334\262C\256Kv\217[\002l\273\007\307\273\270\350\036\034\333\004\373\376\341\350\322"
+	.string	"6\003\017q\3640\027s\353\005\256\243C\030\241oT,{\345\334\266\254(\332P<|\334\"\260\355c]\201X\036\241Y\266\375\202\243/\372\005\307~\026\306C\034\021\340!\216\335\376\325\3558\334\313\203;\375\241f\263\234\333\016\254\324-\315\353q\267\036\342\310\372\207c\n\351R'\0051p\275x\024\004\201\253\352\240Y\272\257\224\210 \035\242\373\216\320\375\035\340\320\200n_"
+	.string	"\003\024"
+	.string	"\366\037t\377\tL\320\032t\337\246\033\272\235\203\267\241\006\267"
+	.string	"\003\016\210\360\243'\301\343P\240\373\316\320\355$ \376\263\373\235\217\177\004\275\366(\315\356g\351~\346\262\373?\334\224\340Po\323\355,^\004\201V\037\202W\322<\212\213C\267\017~\322SL~\246\373i\270\240\373R\240\316\305\202\356\373\301\017\340\003Z\357\201\356\337\240\003\335o\301\f\335=\327\375\034\240s\240\337\300k`\255D\367]\252\223s\025\021\217\201{\001Zw\177\367}\3610\374\005\204t\276\002\036\200\031Dp\320}q\272}\351_\350v\351\273"
+	.string	"\001\277\373\026\272\033\360Yh\017~\005\f\272o\240\343\360(\370\ro\342#\320"
+	.string	"\350\276)\335~\202\003\335=C\367?"
+	.string	"\245\373\023\275\246\201\274\003\272\333\203"
+	.ascii	"\236\001\"N\350\356\223\356;C\033\273\257\f\335.\365\013h\334"
+	.ascii	"}/\320\375%t\277\001\272\337\203\356\347\240\3731\350~\001t?"
+	.ascii	"\210\356o\351\376\224\3567v\373b\267'v\373\221n\027\322\355t"
+	.ascii	"\335\016\327\355n\335\316\243\333\327\272]\255\333\313\272=\254"
+	.ascii	"\333\301\272\335\253\333ot{W\267\327\350\366\255n\307\352\366"
+	.ascii	"\253n\247\352\366\251n\217\352vj\2673u;R\267\267\350\366\240"
+	.ascii	"n\337\351v\024t{\t\272}\004\335>\200nw\351n\301\356\016\322\335"
+	.ascii	"1t;\263\333\r\320\3556\335\275\327\335=\272\273\260\333\225\335"
+	.ascii	"\255\243\273\211t7\r\335\216\354v\020t{L\267\177\240\273Ot\273"
+	.ascii	"\t\335\336A\267\027\240\3333\350v\f\272\033I"
+	.string	"\267\177\350v\017\335\336\241\273\007\273\233\257\273\207t\367]w{u\367\013\335M\327\335/\213\213\213\213\335(\206\335G\270\356\016&\020,\205eF`<\276\323\377\223\336\355\324\360>\237\301\245cn\351\346\233\357NY\225\317\365J\373\356\264\n\017\"\251\036\217\273\360\352t\f\250\236\270\2779B\360\302Z\027\304Q[X<7\332AY;\307)\"\342+~\325$\255\317\357\232\217X\300\274\242\363\265\214u\001\2559\337S\235^]\022\266\377\310\023\026\376\222\025r\316&>uGC0\335\257\244\177\311\207\231\b\n\202\351\274\341\265#<d3\374$(JAgT\036\304\214\305n\212\f\311c\353#i\177\353\316F\"\262,\037}lw\267\037s.2\266yHG\245\335\350\016\323\275\342\3277\270\335-\200\231\234\243uw\204\254\026[NRg\220ar\216\016M\255N\321\016SkN\236\352\270#\3520ms\023"
+	.string	"\262\025*O[j\024S\243\237\333,u\"\312Rj\2649m\363Pn\251Q\227,%r\231\2669\321\251\325\211\310\247V*Q\207,\315\321,\315ib\245T\242)\020*\221\313\324\232C4\225:\021yn\251\331\205\270\265NQ\236l\315Y\3119\377\264\325\250J\3169C9\212\367@\331\351\n\224\231\262\337\331h\241r\3169G\315\370\236\250'\255N\276\233nQkxr\346\313@\t\210z\264'\353D=g\236v(g\035*\b\216\250\256\3273\224W\2624\347G\347\211\252\302\243C\355\311[MN4\265>QK\364 \263V\263N\033\365j\346s\032b\255\3216\233\035Y\261V\035\375<\026\364\243.\275%2\026\360\003Q\320\210\260"
+	.string	"\353\002|?\025 F\226\366\036\267\021\212}#b\324v\345\346\030\325\261\351Y_\357\373^\250\271H\003\256k\021#\303\234\217>PI\243\023\374\276\356\037\362{R\226\034\224xU\037?\221\022\375|'Sl>x\217}q1\347\234\rY\262\326\216\nH]\217\024\036Lg,\036\267\255\361\352i1\311\337\001\262}\211\301\370 K\242~ =\236s%\377f\362\227\363\354\f\347\036\354\303\374\356(\337\300\241<\273\2561\303\252\016\300\272\007\362rO\367?>\356\355\334\372s\017\327N\370>\254\r\027Xu/\347\321p~g\206B\016}\327\2371\367d\277\306\"u\311\322\031\177\327/\264!#\312\005\177\343=\366{|\233[\233\356\335\032\253HB\003\b\020\266S\340Mw,\3733\2773K\341\206\337u\355\321~\007\021\312U5\317\3160\347\314\343\331\334\372k\326"
+	.string	"\260\350\330\001\306v\304\375;\254+\200o\355\325\343O+\321\257fB\025\324\215\307\027\323`\315R\340|"
+	.ascii	"\351\0367&b\033\013\261\215\247l\343\035\266q\224\355\273\204"
+	.ascii	"\375\260\377\366\305\372\303>\207\212\364\303\260k\300\342\256"
+	.ascii	"\201\021\356*g\354\210\373\022\262}\215|\325Pi\373z!\225q\226"
+	.ascii	"\005\3663\260\314\2525~\312\333X\2149S\321\2529\374\025\313I"
+	.ascii	"\316N_\325\257\361\325\277b\221\266\033\344`\252v\345\334\332"
+	.ascii	"x\257\277\361\\\217\343\273\334\3725^\253\177\353i4ns\036\361"
+	.ascii	"\302\202\026\2255\304\202\375\345\326`\373R\261}\227\330\276"
+	.ascii	"El\337\036\266\357<\304\361\251\276\312\2550o\325'\3226[O\366"
+	.ascii	"\216,\231)\262\3550\307"
+	.string	"\026\2079\366\023\262\375zR0+J\366t\272bDa\256\257\277\272\307Pn\375\250\376\2476\347\374Q\3574u]Q\002\222\n\304X\256\351\227Z\232xt\350P\037\206\217\273\243\300\307\317d=6\365\374\320@c\223\036\351\225\334\372K\375.\376\310\313\254F\210gK\377\302\333\034\357\350\004/\305\021~\351[\264Y\210\001\211=m/#F\214P!z\341G\204\305\3759X\374Ul\277\023\0139L\224\265d\267\342\202\226\326\b\b\352\213\210L\344V\034\271>\376\2416\207\310\236\334\343\376\026l\273W\241'\001\3633bh\244F\020%\216\304\253\210\023\372\270\342\363\370\335\221K\226\256\031\276\217/q2\277;2\341\006\237\212\027\372\240\377\371\351\247x \267\276\217\037\266#z\242\264\354}\374n\352\004\257\276\353\210\026B\034e.\\pa\377\211\320\231\256"
+	.string	"\006\270\363=n}\236\347\361\305\227\372]*9*\226\205L\322l\260\250\bt\212\322j\334\325\230+\204\021\372o\031\203\214\3541\256\201i\340-\234C\377=P\033\215\245\3078\013c\365\345kc\212r\332C\333K\252\016b\031X\006\266\022\262gg\310\272\320\262\341\203\255p\225\237\217E\304\307\230J%\307hM\310\032\333*eQQX\352\205z\003\303\362\266,\370\251\232\305h,\225\362C\207\220\330_/\021\"+\034LMM\370\311\313Z\244\332t\b\235\032?\261\361Y\223\030--a\030)R)\212\212\f\217h\\wG\230\032\303\270?0\224\226\246\234\355\270$G\013\034BFF8\351\205z\211"
+	.ascii	"\025\025u\235\320\023v\210\3248\211\032X\245{\214_\334\237+\302"
+	.ascii	"\352\327c|\324\201\2357\007\205\364\030\273h8\023:\273'\030*"
+	.ascii	"SL\204\2110\013\036yv\206\207=AvxEc\026)ajQ:\036\343\242?  ,"
+	.ascii	"\204X5Ya4t\210\203\032\013\001\242(\211K1\215\303=\270\007\253"
+	.ascii	"\360S\274\272\322\365i\t\247h\254\002\020\363\350\315P|\214}"
+	.ascii	"\356\341-{\263\322x\214\247\377\306&!\365\b\211\341(\216\342"
+	.ascii	"\235\276\322\314\264X=\022f+1,m\274\323\275\302\207v\205\361"
+	.ascii	"\030\353\334\303\240\276*\300\3078'\211Z\221\024\253\305^\274"
+	.ascii	"\211\356\322\352\344M\253A_=A\214\222$\271\211 \262\250yv-D\242"
+	.ascii	"B\b\021\373&\302\261dW?\244\207\357V\247\002\350p\311\035Qt\306"
+	.ascii	"\343\253dE\354\360)?\356\024)k\370p\354\033\326\214\025\177\205"
+	.ascii	"\205w\352e1\253F\327\t\325U\016\2119\362\372\366\345\335#\027"
+	.ascii	"\217=\242\372hU\r\363\364\b&\305F\221\032o~}\217\364\035t5\276"
+	.ascii	"\352\324\343+\330\367*\343\b\331"
+	.string	"4\360^\273ON\262\374\324\024\251\354\005<\300/-i\272\177SxW4\036\2777\334\361\032\351@\225\271\036\206I\217o\221\016T\013\233R\272iOy:\217/\221\276|`p<yG\354\035\322w/F\320\035\336\n=A+#\252\307\215\022\3046J\017[\327uW\210\213e\241cY\023\226\027\214\321p1/\306\275\353+\344p\311\347\361\r\342mF+\214\271%\217\257]\007B\245]6\376\352h'\204\270\204\356\307\217K\367\306\005v=\006\276\030\2625\327\227\016N\350\260\007\355\361\225\373+\274\205\343\306\331\343\033\347HV\200\262r\312\340p\213\0368\352\314\340\340n\230\233\300EU\235!\330'\325jk\273n'0\\/V\356l\200\001q\373\253[\204\353\016k\211\007\217;\365B\303\2125\n\023d\361\270O|\326\326\260\322.b\321\216:\305\263\263\253F\006T\207\262\004\364V\250v\323\214\330d"
+	.ascii	"=\276h,m=gtI\330f\361\306\306n\331\332\216\270k>R\202\361\300"
+	.ascii	"\303? e\227L\t\310\340\330\223]\035I\246ZF\004O\360\346\002\213"
+	.ascii	"\254\257\365+\200\350\360\301\326\2667\354\270#\355\204o\211"
+	.ascii	"\\W\230\267U\205\3614=n\026\007\030XV\016\026\312\313z\275\274"
+	.ascii	"\355\333<\004\203\335P\373A\263+n\334\270Wl\025\335I\333\316"
+	.ascii	"\227\024bW\273\365v\375 L\233\243\320 CC\037\264\211_\215\032"
+	.ascii	"w\353\305\245\315OI\325c\n\236\024Uql\367\315\312\272[/b9\312"
+	.ascii	"\222\247TTd\230\263\322\007*DqH@Otb\310\"\357\353\261V\347\240"
+	.ascii	"B\035\312\322c\217\0261rx\266\262\024Q2,\254{\345Z`&\325ku\255"
+	.ascii	"\356\225\3138\353i3lIrA\204\353\361\275\312\322z\372I"
+	.string	"\242\242\272Sl\316\271\017\250\212\262\242o*\355q\233\f]\251+u\247\330\250\237M\217`\214Gq+\026\037\273\365N\341m\315@Ktr\272Q\202\b\310\272\272P}\243X\242r\264P\217\357\323\375\301\341.IP\360R/\365\356\260UiG!JJ\227)\215\3512\031\t\251-\327\232\013\027\027\351\344(G\007M\240\241x\324\027\351\276\b\314\352\022{A)\223j\325\356\217\211\034\025\310\310\306\320\320mQ\002\250\247\255\213E\337\026(E\354\270\262\036\337\025\367\207%E\023Z\373\370\026y_\013\017\337O\337\343K\344|*{JE\340\216S\267\347\366\334 \266\205\315\247\247\315\020\250o\320\033\236\330\265\210\323z|}\356O\322Jn\354GE\212\217\214\301k\212\037j\037I\\\227[\n?\f\320\245\362B\231L\025\24012N\023\037\232\307\346\311\0134\315\213\364\220\301LrI\243|.qVnhZ"
+	.ascii	"\215y\312\220\274QB\331'\323)\243\274IB\2377<I(\2353\"RLf\226"
+	.ascii	"J\025\220\314\026h\232\307\230%R\306\002\0205O\034\033\024!\240"
+	.ascii	"5"
+	.string	"O\345R\211\242\202\256\001\241\205\030X8!C\314\n' \320\202\nK\245\023\372$\221\234\301\261\221Y*I8\2378$*\260\261\301Y.\231K\223\032\230\316\032(si\202\002\231\264\301I'N\0237odn\2227\307\256\001A\306)C\342%\tE\3164qb\240P\245\214L\f\t%d\2342\036f\220I\247\007\031\247\t\020!>\034i\220N&\364\004\b\023\320$\215\207$\315\207\n\\\222N\034\250\f\216\023z\242\202\026\250\023\t}~\230Y&\23514\315\230\230\016\314\030\2364K%\024\232\254!\304S\211\222\264Q\252p\303t\252\200d\332x\230I\322,\2215&h,\360T\246\314,Sh\261!\271\364\300\254y6\221\313\023 \240\317$\024\331\202\213\013\025\200\301\002)\2440\263T\242@\201*\227J\020\311\022(O$\241Jg\006\2301\270\314(m\220\030x*WZF\311v\002H8"
+	.ascii	"\t%\330`\002M\306$g\230.$\23586J$\212\225d\214\n\037\272\006"
+	.ascii	"\004\350\223\331\214Y2on\2302$\240I\032'\022\232\001\022\212"
+	.ascii	"D\001\345\031\343\2046O\272\006\004\002\320\340\320\230d\363"
+	.ascii	"\006\245\r2&\306\231\274A&\235\320g\f\0075\2703\211\002\005\016"
+	.ascii	"\rG(\362\235\316\344}\036m\230\314\b\304\030\2316K\034\266k\236"
+	.ascii	"1O(\022z\242\0032\005*\203l\3360eT\222O\2443\211\202\002\215"
+	.ascii	"\tA\204\247\fI\022 O\330\200\2749\201.q\230&\240O\244M\313Ry"
+	.ascii	"\343LBQ\2401\316\344\f2\271\302\222\251\\&iP0`\342C\222\206\030"
+	.ascii	"\031%\r\362\206\205v\r\b4M\0224\315\0172K\034\025\240\311g\312"
+	.ascii	"\022\305C\223\317\244\323\370\214\271\301\t}*i\2220\3204"
+	.string	"Uj\2404\313\244\315\361\371L:gf\220&74\2312\330\tm^h\214\223\tE:\223P\026f\2223\313d\263\t\201\027\031\247\314m\272\023Y#\203\24113N\246L\022\006\226\336\240\231\315\244\223\004\224\311t\222H\241i\376LR\0042\310\346\021\032CB\t6Y\002\345\023Cc\2264M\343\222\246y\227L\345\323\231$\201\t4\246\004\350R\211c\322%J\230\310@\206\027$\300\312\200p\303t6\223\311\030\032%\212%S\206\304R\211\274!!\343|\222"
+	.ascii	"A\203'\r\322\006\2051E\033U\264\f\0325%=6N\215>\\U\264>k\377"
+	.ascii	"\001j\371\265\201=6\362\030{\246\252gn\217\373:d\270eX\304\270"
+	.ascii	"\203\273\202p\034\306xl\214\032s\334\332pF\035\026;\"{|m\254"
+	.ascii	"\r&\r\007\342\210+h\021\251\017\353K\021K\031\215\340\341\310"
+	.ascii	"J\264r>(\033*Z!/\270\240\303\307;\251\n\355\360\261\004#a\333"
+	.ascii	"\346X@)\271/\216wn}?\330\020'a\361\301\342S2\265\226q\3058\202"
+	.ascii	"\013_T\274\224\210\3441\302\233\210\245\210N;G\212d\t\275\271"
+	.ascii	"\r\356\240\304\020RE%\250\"\361P\354\353\312\307\026\021M\217"
+	.ascii	"\002\261\320\211\223\037\330\022 \013\226\0249\364\376\376\242"
+	.ascii	"\272\310\236Z\354w[\300\331h\265\214\\E`\360'\n\367\335B6\266"
+	.ascii	"\034,\366*\301Jx\\a=f9\326\260\352\351\261w\217\264\340A\345"
+	.ascii	"\314x\254\247\207}\\\023\257+S\370\016\337a\274\223\241!;\304"
+	.ascii	"\253\220\306xd+Y9S\201LA0\f\243\335\320\216\016\273\273\225\242"
+	.ascii	"\304\017\214\257\016?Aum%\002"
+	.string	"\301ItrW\267oM\332~\b\316\335 \024\004\221\202\344p\234[\0178\247'r\347x\370`\375\333\033\366\301B\363\260\250\b\256\261\217+\207\324\223\003\222\333\017\232\024\332\250\302j\303=\006\337\274\352\036\013\272\215\035k\212<\274\355\350b\3470\215\215\351\275\264\210z\254\335\035\025\241.\032_x\307\025\362fek\037c\264\233\002\214\366X\r\2475F\353\026\023\276\256i\316\021c2L\206\315\330\350\222\2366C\\\326\330,)\212H\272\322\243C\361\204\t\017\312\017[\337J\321j\354\346\264\324V\017I\253\305a\215\305\032\213=\026\273\213\213\307/\275\262#n\315\206(&\252a0\374\305\316\261\345\254\300^\354\232\212\253\022\266\033\343\350K\221\272I]\340\033w\352\354\305\324\323\343\031\215\2533p\327\315\013\205\n\250\323S;)\323\266 B\314\231\221\031I\222\244\003\323\024@0@<&!\222g5\037\023"
+	.string	"\225'\004\252\216F\035BF\"\"\005I\222\302p\300\371\312g\002\271\214\301NlQ\365T\013\347,\304{\350V\3743\306\016\302<$\025"
+	.string	"\305\t\253\220\326\017\222\204q\355"
+	.ascii	"\017I\242\264e\370\205\372\235B\351l\220\020\346\267\\\236\233"
+	.ascii	"\220\261H\341'\330J83\"\354\252:o\013\337g\310mp\003Q\004=\233"
+	.ascii	"NOr5\362\243\233Z\254\237!\027\224\004\222\276\242\026\344\223"
+	.ascii	"\363GU\265\246_\347f\261(\255\214\211\273\364\241\177\264o]\315"
+	.ascii	"6\313@\032Y\212\365[\261\243\035\321Y\362\325\232\361\n\275\231"
+	.ascii	"\024~\227\343^x\206\216\f5\310x\230\314\031\t\217\213sc\002\f"
+	.ascii	"eQY\235\302\226"
+	.string	"\355K\337c(\007\244\025f\231\030b\331\\5\201\007>\336\241\232\300\356\231El`jKgZ\3664o\017y\230\310\363\211\025\312\312^/-+j\262\200\332?\232_\310\200\225Xq7\253\031\177/\273\243\211\025\345\226Kw\b\363\017\322\020G\303Z\376\314AMp\255 3\350\352\273\0041n\230\325\026E\200x\201\016\256\370\353\265\002 l\035+\377$\005\221d\037\277\313\264M.\203QM\322Jc\003*\005*\364\325s\316\037\334\267\n\313\314h[\205qPAT\325n\353g\261\365H<i3\322BDZ\024\376c\245\254q\344\251?\f\257V\224\025\326lQ\03380S\310\310C\266\364uU=u\315D3S\00733\245\202\250\317]\204C\254x\013\236\212\275\366\213c\t\232\004g\261^\033N\225qE\271\"\330\315\341\336\363\262\257\005\001\265F\320\331\311\345\345[5\340\021\374n\025\334\227K\264"
+	.ascii	"\247\245OM\370-\255\361\200\362Z\254aD\220]\362\217\322\257A"
+	.ascii	"'\302ecp\323\346[\307\251\361\371\311\207\1779\244r\003\275\306"
+	.ascii	"\252\\d\363\031\247\036j\221z@B\006\350P\261),N\203-\304`!D\310"
+	.ascii	"\243\\4\334b\353\311\342\013\227n\222:\373i}\255\220\372\274"
+	.ascii	"\312\250\322\377\264%\332. e\244\227\002\231\241\361\265\013"
+	.ascii	"\336\324\326\276M*l\371\242\217B\241\207\240s\032\320\276\235"
+	.ascii	"fA\003\305\352\363\007:\361E \322\223\272n\321\r\353\331{\322"
+	.ascii	"\337(\207{C\004#Gus\031\225G\225\320\323\276\341\362,\314m\f"
+	.ascii	"#X\263\005}=\217\375]\232_\253\315\342(\235\f\2357\224\303\254"
+	.ascii	"\342\020K\335\023.\2426\244H\0052ihj\204\235V\242\037\246\321"
+	.ascii	"OB,\373\321\252!m\036\320\203\177 \022\236\331\364L\372\261\361"
+	.ascii	"\212\030\377\244\370<\003\333\315My\315\356\003\001\346\224\230"
+	.ascii	".P0\345\257\346\366/\305j\223\b#\004\206\030\b\266\347\025\230"
+	.ascii	"DSl\23307w\224\036\260H8|\232RM\002\033\364\273l\240E\nR@\246"
+	.ascii	"\215l\205\356\336\327\241\2561\351\311\337\026\312d|!\354O^\360"
+	.ascii	"\226\274d\310F\246\251?\026\230\023\233\217\3063\202\217\341"
+	.ascii	"\314(#A9\032\305\001j\372\270y\353\216\b8\275a+\333q\354\353"
+	.ascii	"\364\2320\337?\3276\020kn\262\002T\245\357\307>\2138\371\210"
+	.ascii	"@\337\252\363\333\022\257\264\030\005T(\316\223Ye\360\255\206"
+	.ascii	"Q\211\207$\322\020\016\24390\246\310\334l\2103\306\3322\310B"
+	.ascii	"\376\275}\314\217\265@T\367\265\306\207I"
+	.string	" \357\n\235U\362\310$hq(G6\006\274g\200\030\016(qm]\207\233}k\027A\r\335a\322\220\337\246\3465\227\253\313\265\311\2052,$\371 \035;@ r\016\206\00615z-u\234\201H\251#\315\360\247Alnm'L\203\231e\305\037Z\b\212\006\276M\223\331\325\207\2038\2578hJk\31094\205\263H\244\200C@dc\037\264vD\3629H\bZ0\373q\271\2560\235\334zS\364T\247~c\367xt\026\"\226g\031\331\343\221\221\025A[\361OJ\205\345\261\004\341E\220\352\374\237:7\244\226\314\227\254 \f\253\342\271\254\021\344(\220\211\336\215?\"\322E\020\026HpO\037\220\020:\325Y\340z\303\002\215\250\223v\032LPJ\363\031(\233b\342\216\310h\013z\027\240\340\006\2533\253)\330\323Z\020\027S{V\201\027\301\303\331&D\303\276\031<q>\225\243\227\027\222\315Y"
+	.string	"\0254<\273;\335_kQ\375\021c\031`\332\034d\\\213\002\025\357\274\201\267\032\227\327r\030\034\024\361"
+	.ascii	"\330\267qbG\335{\215@\021\257X\017\221)\325r\253\342+\375\020"
+	.ascii	"S\021\016\366\221\352\003\337w\017\337#7\361\2347\316\244T\370"
+	.ascii	"z\017\250t\037\241\257\247\003\264CgZ\350\207dK?1e\373\020<\364"
+	.ascii	"\344\331\201\252\265\r]\212\211H*\202\206\206q\256\302 \230\t"
+	.ascii	"\354\036L\377\031\244-\221\0131\201\006\323\021W\3261\354\231"
+	.ascii	"*\222\033\013\0228,*\325z?\312\007$"
+	.string	"\020\273\220e\371\266\350\324\241p\356{\341\236\317,\210\303\016\360I\345(^J*0\211\256dt\177\320\302\200\302\377\316\243\357\371\345\270b\252ea\344~\235\331m\341W\365\\\\\332\255\3627\240|\032F\263\307\"\363\223z\234\230;4.|!\354`\f\306\226T\225\201\002\205\330-\346\277z9\363l \274\265\335\302\326\230]\324\371\357u\315\006\013<\207g\\n\325\0330\256O.\025\225gK\361Q\376\022\357\037xq#\356z\330\324\210Y\240\231\342\254\241}\272\366\361\354\275C\375'2\036?\t!C\233N>\310\314\237h\251\355\017j\023-\227\242S\306a\\\356\312\300^"
+	.string	"~R\263\365\2500z\034\320\23202X\216\207\370\b\333\205\034!+\016\023\027\323\f\013\221\021z'\243\035h{\232\"\322\377\r\035\0231\354W\262\375\331\236\337^E\244\033\303]O\362\312hu\031\337\335\204\231\321\316\3777\356]\334\265\302 \013K\220-\bp\246\272\002\202;\275\"\035\352\351\343/\342X\250\306\n7\362\201\260\354|\033ch\035\ro\222\3362*\246\301\354\237Iu\341\303\2469C\263\254\243oY#\311-}\331\217!W|7\331\360\366\207\3436\026\347Za4*\364_\251\334,\366\007\250y\027!\201\364\306\033\204\342\257\235\346Y\211p\241xs\237OZ\t\222ZH\200H\264\211f"
+	.ascii	"\244\030\3363.\217\2363\341\211\267u)0X\315k\206\241s\334\372"
+	.ascii	"\243)\266\254\317\247\261\331\264e\311\224k872\035\224c]2e\\"
+	.ascii	"\033\377\326\371\024\367\320\243\216\236r\261\272\251`[\002\337"
+	.ascii	"\351\030A\006\324\241m\325\237w\316\336\312\007\214d\264\247"
+	.ascii	"wM\b \312\027\247'l\355g\315)\343\227DN\2722\377sd<\200b\214"
+	.ascii	"\315\377\302G\004g\226\273\367\376t\005\200\355N\"V\217\330\324"
+	.ascii	"\302\233y\231\213H\225\342\304\342%\232y\022\213\200;\220\231"
+	.ascii	"\r \313?\254\215\365\255\347\032\334oV\250\360\360\266dl\026"
+	.ascii	"\221\235\001W\211~Y\350('&\bGh\001b\247\024ww\214\203\177\267"
+	.ascii	"\020\355\253\035\264\242\371\232\213'\036\303\n\347P\370'=n\306"
+	.ascii	"\361(\361\302~\246\374\\\305\330S\374G\332gX\325\033\370\367"
+	.ascii	"A\333j/\227\366\227\340\313E\037\253\356N\377\321\261\205\035"
+	.ascii	"F\343ygF\237\017\276'\204_Xy$h'\361\232\354"
+	.string	"\001\255kDr\374r\275\233\336f\370\337i\343$|u}\245\373#\3231x~\363v\034\001\234\240\375\341\257\237\237_\334\366\325\316\013\344\276\320\354IW\377\216\316\273m\201\275\243\267f`S\177\245\236\367\257o(\372+-V\226\237\031\321h&\023\342w\205\260\207\374#j\353\324\347\324Uu\253\264\3627\272\0055\355\257V\221\372g\003oC\331\0315\326\240\"\316I\354\335\030\f\n/;w\315u\355\235\037\374\265\352E\371\360\347\311[g\177!\007P\274\277cJ\312.\266\b\364\361\203\243\265s\363\0278\315\2104<\370\355\277e?qr\022f\367\337r\340\373/B\007'z\221\353\rH\030\264\342K\367\345\274\273n\372\r^\322\235\316'\344\031\2368\fl\324\034\254mS\377\364\222x\2106\322\354&\276\256\375\325\342\303\215\177\240:\322'?,\303\t3_\336\262\232)\340\247{\366\350J\232\243\237\323"
+	.string	"\320\370\316\232\304\360F\271\320\266?\312G\327\337G\302\347R\207o\035\037\337/{\002m\210\233f\232\346\206\246c\322*u\237\201\372\341\3162\335"
+	.string	"\225a\373I\326\016&\314\030"
+	.ascii	"\360\207v\354\200\321r\363?N\023k\273shh\326\013\366\fR\337\305"
+	.ascii	"\375\342\200\361^\350}\036\200A\342\335\004f\312\376\f9\373\201"
+	.ascii	"\207&#\306\005\334\307\371t\247\201\033 \363\373xs\330\034`>"
+	.ascii	"Z\276\217]{\036\244\036f\344Dg+\273\213\334\357\233\371\003\337"
+	.ascii	"s\237+\026\021\377\220\216(\237\220Uz\023n\031\363\364z\246\226"
+	.ascii	"Iz!\371\224\340E\340\272\266(<\322~Mm\302\201\360\213\034,\202"
+	.ascii	"`\016\222=\343\272\r\206S\214\027\351\255\263\344\373\274\307"
+	.ascii	"x!\031\245\274H\376\016\340z\366\361\366\017\260^\340\035\\5"
+	.ascii	"f\276\207q}^\033\271c\364\213[\237\376\314\236b\201\247\017\267"
+	.ascii	"/\356\311\356\347\005\341\306u3\227\345\0138\357o\00470/\224"
+	.ascii	"\253a'\225{\223\177\264>\302{N3\364}\235\247\321\013vop0^\\+"
+	.ascii	"\303\201\306\313\370/\332\367\223\016\317\355#\220\216g'\037"
+	.ascii	"\350\002v\312]\351x\244\324\r"
+	.text
+	.section	.gnu.lto_.symtab.21bc4724a7b25ca7,"e",@progbits
+	.string	"loadEEPROMFromFile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"getConfigSaveStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"getEEPROMStorageSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"getConfigSnapshotSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"getConfigSnapshotCrc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"readConfigSnapshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"config_streamer_can_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.21bc4724a7b25ca7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,593 @@
+	.file	"config_streamer.c"
+	.section	.gnu.lto_.profile.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375 \316u\004"
+	.string	"\324\006\302"
+	.string	"\013"
+	.string	"\330\355\273\207\006\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\336\267\256\334\002\b\002\003\272\365\222\215\006\002\002\004\002\004\003\367\346\266\265\005"
+	.string	"\004\237\260\233\312\016\n\005\003\002\002\005\372\203\243\344\n\016\004\002\004\002\006\003\002\002\006\265\234\352\241\r\002\002\003\002\002\007\235\220\277\362\b\b\b\214\317\340\302\002"
+	.string	"\t\307\325\247\335\013\006\n\240\342\234\212\n"
+	.string	"\f"
+	.ascii	"b`\325i\201A9{\202\321_\025\334\345\013R5/a+7\310\034\307\216"
+	.ascii	"\254\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375 \300%\003"
+	.string	"\302\004\r\023\300%\035\377\017"
+	.string	"\377\377\377\257\246\231F\366&dK)S\357\026\376V\233J\204\262\270\221\357\330\353\224\017\206uk\311\372\207`\351z\245\251\315\2238\016\\\004\023"
+	.string	" t\217\314\276@\256\023\266\304\030:\016<\315#\020\200\013\3217I\033\r\343\bDZ\216\314l\345\"\200\022.\315I/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`)\003\335\020"
+	.string	"FZV@ m\224t/\024V"
+	.string	"\020\373\033/|\257G)m\002\3271\366x2\004\3368L@\240\360\214\n\317\"\f\f[r\217\200\256\370\220\200H\002T\241\b\020\021$\207\325\354\033j\215\264\375M\344N\001@"
+	.string	"C"
+	.string	"B"
+	.string	"\267q\203\272\312y\f5\002\350\312\231\022\202d\244\301e\034\363\031\363\351oI\347n\236\367@\337{\017\357\315\232\342\303\343\344>k'\023$\223\243\254\342\337\256\212\330\021\243#<\017D"
+	.ascii	"\376:\007\004\037\034ky\323eJ\002*\225\364t\247\323\364\303\b"
+	.ascii	"\202\006w^\234Y'\224<\016\252\233\02773%\235 \021\001\2678\253"
+	.ascii	"\310{\217r"
+	.string	"-\250G\360\336\343x\267+\216\033\020A\360j\347j\005nP_\3150\036\035\227)_x\032\b\341\3165\3535\255Q\025\2236jP\225r65\201B>*\347\343c>\355\365q\323L\336{\325\3555c8\226g\351\241>\243Q\020\215N\260|\253\230\321D\210F'\226;&#r\300J;\030@!\031\254\255\254Q\tZC\020\264,x(q\\;\304|2\025\020\352\316\211\270\335\353\334P\224\270\320\021\340*3\307\254Q\005@X27\225`\022\215\024\243\n*08a\257\321\016\217\264\340\322Z\304\212m*J\002V\250\341H\250\324\310\310Hia*i\fp\002\241\221\261=\022\200\025-\313\211.\032bf\375\263\030\034\200\247\001\272\037)\376\324\020%\"\032_\202\352\321v\254e\356\256\252kTV\26564\307\304r\343\003%\017\354\323z\037\222\225\263`\251\241\221\024\022}\310yBaR\272\361"
+	.ascii	"\206V/\210\b\020\005\316\204\250\177\2203O\346iC8\205V\211\217"
+	.ascii	"B\270{\207\356\270\"$h\001\203\322\264\245\017e\273\372\020\254"
+	.ascii	"\002\263\244\306C\305\202\376$\017\254e\263\363\331w\305\235"
+	.ascii	"L\305\b\250\2515\021\305D\035\b\306\017\n~\361n\266\332O\026"
+	.ascii	"\026\311L[S\277K\250\310\323^\275\353\217\377\326\210\352\304"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"E\005"
+	.string	"\342I\032 \240%I\007\217\256x\025\030\371\363\377\302\277\374\027\375\017\374\353\342\022,[k\t\261\304n\"\223\f\033\331\362h\375pt\006\270^b\312+g^\274b\262\345\005\344\312\233\376\002\f\037\342\024\330\n\214\354\341/u\034/1\3346\374Z\206\234_\016\213x\253U\343d\t\317g\244\224\322e!\273\220\267\032G\326xn\260\023\001\030"
+	.ascii	"p\211\234\205\365E\034\316\310\300\301\200\204e\243+\257(\301"
+	.ascii	"\006nL\314$3\020'\030\017\264KS\034\231\004f\364\254\031\006"
+	.ascii	"\210)\337\2317O\005P\250\3150\0230\224\035\005p\003"
+	.text
+	.section	.gnu.lto_.pureconst.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\205\004\003\230\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\204\004\t\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"M\006"
+	.string	"\242\311\035%\240%I\007\340j\324\233\343\\>l/\034\231j\021\240bo\362\265JXj\354pYk\255m\273\265F\310\226)'\024\013\304\361\327\236*\346,\002g\251TI\331\025\324\322\344\233KY\344\361^\007U\300,\350\370\365\032\021\317\273}\206\356\272\b\326\223"
+	.string	"J)\340Q\f\200\201\242\223<\022\261y'\2669\263~\236\337\273b\335`\210\337\366\304\354g\026{0\362m\004# p\202\t\f\361\001\257\t\350"
+	.string	"TrH1\3673rD`\036X\221 \340\002m\253m\215\025\202w!wn\371\205[\332\306\265B\310\346\376\017\016\302\214\275\345\305\330&\2361!"
+	.ascii	"I\326\215\334\336\234\324\335\331\0168\003@\375\214\307>\346"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.a6292b21320c1220,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.12.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"e\007"
+	.string	"\242N45@o\323\001\230NL7\\c\246{\266%\233\371\265\344\270\212DOuA\303(q\300m\244\035o\007\021k\035U\037\025=\270xB\264?\360\330\306\254\033\3312\245\226km\262\313\303\271\262\020\310\001\242\363\360\301\254\370\351p<\321\312@qsP,\342\312b\b\303\262\250\361\356\351\260kC\307W\001-:e\201\233R!8a+1\221\346\232\245\215\357\002n\255\267%\364h=\375\177a\327zd\347\204\341X!(\375\031/.\377(\224\020M[g\353\021\223h\036Q8\340\357TN~/\241\n\031S\365<P\231\312X\2402U\255e\261\007r\227\2200LZ\376G\370a\315\251\325&\031\200\023mN\f\303\377&'\322p\241\333\032\264]h+\022\t"
+	.ascii	"\252\244\2231\215{\206\215\263\257`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_config_streamer_start.13.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`~\001\205\016"
+	.string	"f\232_E"
+	.string	"\221(\035\020\241\234N\030\202 (\240\233?\230\274r\031b\354\315\373\305X!\271\220p\t\033\371\223\261\242\217b\212\177D`$sM\247m\033\240\253\0244\277y\004\314=\344\255[\331\264~\247\223F\366\226;\245H"
+	.string	"J"
+	.string	"M"
+	.string	"\332\247\303sd\237\332\td\237\006m\030\017S{\226\313\206\226\314\356n\n\342\340\245F\320\177\353"
+	.ascii	"J'\321%\312U\"\200y\321\340\234H\222\343DD\351\255G\323i\024"
+	.ascii	"\343\346\301\356:\226N\034\356y\333\020l;\260\377\"V\224}\226"
+	.ascii	"\177\363\360\237_\375RF\177C\202\007\031\031\0351vOjh66U\214"
+	.ascii	"\260}\216m=q\026x\026\303\244\200%}0\271v\327\303\r\264\317\002"
+	.ascii	"2\206$4\013\036\355\253\276\002~U\362\001\273(\026\256\335\320"
+	.ascii	"\303\n\002\240\370\2227Z^\261\221\212\236\232\201q\251C\331\025"
+	.ascii	"\204\345\202\024glww\tiW%\361Rc\265Q\373\302S\030\246\257\027"
+	.ascii	"\023S\355\357(H\264\335e\340\267d\300\240\251\020%\331\347\001"
+	.ascii	"\223*e\245\203I\254\261CQT\025\373rw7\234\206\317'\271\257\003"
+	.ascii	"\"=\267\347\303\343@\035\316\033\371&\204|(\210t\236M\344\323"
+	.ascii	"\001m\036\357\333>\f\270\263\300y\333H\327y\033'\334\313U\224"
+	.ascii	"#\224\210\231\350\310\tn\207|\205a\332\201\322\"E\025#U\345\241"
+	.ascii	"\314\025\n0_3db8\321\256\020\" \240\002\021\301{\312\244\233"
+	.ascii	"\232\346c\303!\273\355\233'\312V7\232cT\004l\263=\364Z\003\360"
+	.ascii	" \005\023\205\331m\264\2572\r\332:\347$\034\307\372\331M\"v\241"
+	.ascii	"\035\020\320\350\212\301\025\205q+t\031F\004\210(\362\345I\223"
+	.ascii	"S4\277\007"
+	.text
+	.section	.gnu.lto_write_word.14.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`^\002\275\023"
+	.string	"\266\345\203H\3200'\035\030\324B/\236\001\304\354\037\210\325\214\305\324Fd\210Q*\003\277\320\257\033\271} \236\326*\254\257\266\337\362\3736\307\257\0014-\013Wx\021am\033\264\245\215bJ\353@\374\341\235\372\324\017\226\020\262\245L)m"
+	.string	"h"
+	.string	"s"
+	.string	"sL`\005\253\177\036W\266\375\024\017\262\331Jr\344\021\303\231\247\034\217j\316\351\032\271\b\370O>"
+	.string	"\370oG\334\366\020\374\344\252\315\357\020o\017\005\034\374\360O:X\242\021\362\020c\344q\240v7\222\036\242\214\034\231s\262D\234\256<p\263D\343!\302H\221&\234\250\357\2563bN54\231sZu\242\207{u\333\031lC\260\265&\376\366z\275\2367\307~\321\377q\336\335\372\370wHu(\325\240T\177R-?\365~j\225\352\207<\360\271\261\351\201Z\247qv\350\345\230L\037\214\237\363n_\205od\226\317k\031\301\215S\324\0205\025D5\347H\362\317\rV\377n\333l\226m-\3320"
+	.string	"d\342v$\026\\\355\017\235\310\366\321\345!s\346\314@\232\001\261'Y\351\333\335\221B\241\323\242\307\351\223o\001[["
+	.string	"\210h\367\324R];\305\202^\327\332\033\375;4B0\341\366v\236\252)$y\031\270{\262\263\021\366.\003uw\265F\016\004\214U\356B\246K"
+	.string	"\310\204&\341h\022\261\253c\222\177OvO8\255\262\215\341,\254\304\300_Q\201\266\232s\336\307\005\374\367\255\371)q#4\364\242={\274\351\35284\226\332\253F\003g1\024\024\226\023\020v\303Jf1\225WlV\243M\240\220\202\262\"\203\271VR^*.\330\214\346*1`\331\205\330\314U\223\311f.\3268/\247\004\245\004\0162rG\262\344\337=B\217T\356H\277\341\316\330\016\327&/\013#\347\2343\004\321\217\355X\373\005\323\353\344~w\223\230\275\351\013\236\315\t\020\334\030"
+	.string	"x\256\273\201\340\337\202\253J27\001+ p\202\241"
+	.ascii	"\321\003\312t\3237\275\023\013\245\262\001o\366\330\212\2444"
+	.ascii	"\257\2345\312\256\314/o\261\351\252\266?6h\207\275\264Y\300\241"
+	.ascii	"\271\351\321\333\270\301\322\2566\246X%\267j\302^;c<\211\320"
+	.ascii	"\007ER\300q\t\037\031\347h\350\243S\036\205\035&`dNPz\203]t\325"
+	.ascii	"\035\032\227\2604\242w=("
+	.text
+	.section	.gnu.lto_config_streamer_write.15.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`2\003]\027"
+	.string	"\326\252\225I\300VQ:Ec:w\226\257\315\200h\bN\f\201i \344\202\231\224a\264U\336\273\376\213\363n\300n\377\333\360\360\034h[y\006\363l\033\300\206\004"
+	.string	""
+	.string	"\240|\267\005dH_\252ev\3211\361\225\330!\204\354-e\222\001\200"
+	.string	"|"
+	.string	"\203"
+	.string	"\244\211\017\2505\347\304H\255d\203\205\020\236.\031\236\307{\310v{\223\324\215\027\302\202\333u\251\265\252h\236\372N\347\t|\247-C\306\223\374~,;\370\321\331,\333\357>w\224\2458\362\034\234\240\315\207\306i\304M\033%$\243\027\235{F\032\177\001j"
+	.ascii	"\235\262\370\234\020l]\\\234F\333\024\240\204\223b\032k\334/"
+	.ascii	"\372\202\245R\034\201\316\240\205Z\353\2628\252\370\206\337]"
+	.ascii	"\237\335\255\260\333\031\002T\276\350\030\232q\331\274#\333\330"
+	.ascii	"\035\264K\362\260\215N\ti;\267\233\232\274\250\223\377\351@~"
+	.ascii	"\230\377\370M\347}\303\220\027\004y\277\311K?\336Iy{\362\362"
+	.ascii	"\344\275\314\207\237('\270\324\352S~\251P\250\221\320y\337}\220"
+	.ascii	"}\021o\347\365\366\003 \205P\026\244Z\311\232\323\245\020\236"
+	.ascii	"~W\266k\332\335\346\003\0311cj-\206\213\t\374c\247@L\255\021"
+	.ascii	"\241\210p\336\375\320}\310\036(\236\"&\245x\366\251w1h\340\213"
+	.ascii	"\264il\315\263{%\261\031\235\270\273\341G\035TI\024\314\346P"
+	.ascii	">\021\201\226\311\013\033\271\331A;\277\275\217\333\200\217+"
+	.ascii	"DUj\254\264\335\273[\342H<\310\350j\2556\273\253\033\261R\272"
+	.ascii	"\326\217\2048\205\351-b\322\354Ep\\\341~\247\347\256\247\005"
+	.ascii	"7\221\031\335\305$\006\177sw\357\006\203\306\345\356\212\370"
+	.ascii	"\220\355\205\265V\t{!\037n\302\031&\276\323\367\213\236 :\253"
+	.ascii	"\234n\221p\305f\316Y_\226\003X\353f\325\202\351\304<\204p\201"
+	.ascii	"\300y\261T8\256\325\215\212\005\213\251\034 \330WN\013\246\322"
+	.ascii	"y\275`*\023Y\3379T\323\314\232\266OP\375\335\017\034\225^\206"
+	.ascii	"f\\\202\035\264\017D\232j\260\005\233:\354\236\260\301\346\035"
+	.ascii	"DV\27665\330\277\335\200\351\257?,\270\245\031\227\237\265\326"
+	.ascii	"\372=x\330\251\376~\226\312\333\r\032\227\274\202\326\274\t\305"
+	.ascii	"\261\224C\013\355\335\013_\262\2750@\250a<\207\f#\b\225\004#"
+	.ascii	"\021IA\272\032p\002\021B\253\003\021\320A\"d\220l\035*0\316\001"
+	.ascii	"wG\036\274,\214W\355\366\214\201\305\203\312\206(?\020\251 \266"
+	.ascii	"p%J\255F\254O(\352\231\362d>\245\337\367/*}\237's\335\3147%\001"
+	.ascii	"\006\252\345\363\313\225\260z4h\032N\233\t2,'\2168\360A]g|\310"
+	.ascii	"A\232z\203D\366-\375\026b\235\344n\016\261)\024\372\255 \023"
+	.ascii	"\237\0366\330D\365`\202\213\244\314R\225\361\250S??"
+	.text
+	.section	.gnu.lto_config_streamer_status.16.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\035\b"
+	.string	"\362\01787@\215\222\016<\214s*y\202r\273+d\317\237\375*3\316\317\017\240P\\|\264Nt\266\032V\021\260v\377\206\341\001\377\315\227\nQ\033\252\025\312\301o\375\255\021\"S[\3374\035\307\263\341t!\320CD\007\342\303m\332\247\263\361h[\007\3224\007s\022\234N\013q\\\247a\276\354\307\230!E\213\177\242$\263\262\314d\270#\025\024\231\252\330\025\305\200\025\t\266\3747\202Q\343{eL=\204\307~-\274\004P\252SK\255L\214\026\226L\301N:~\3571\177\341w\325\020\257\237\250\003\231\251\226I\346\227\260BV\354/\373\357GA\274g]\037\307\251\300\303tQ\262\222\231Z\246\006\227bW\t.\305\342F\275B\357V\244\016\250\222\212\3514*\004h\310\314\241\351\224\321c\177\204\177\341G\t\f"
+	.ascii	"\252\244\223i\021\206\315D`\232\005\344\230\320]\303\365\261"
+	.ascii	"x%\230xp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_config_streamer_flush.17.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`\350\001\265\020"
+	.string	"\226^lG\340\222*\035R\267E\243\370\004\022\005\345\305Us\300\205}\262\"\024Y"
+	.string	"\207\201Y\004\21652c0_)Fo-\363$\253\223\213:o\026"
+	.string	"e\030\235C\243x\330`\016*\3065!\006~\004\241c\021\331[\312\224\002V"
+	.string	"R"
+	.string	"Z"
+	.string	"3$\361\202\317\245\303\217m\177\305Y\260\354\\\fk\240\350D\354\345\366c\316\351\221>\352.\343\013t\227\033s\326\343*\313\377\314!\300\300||`\3531\3047*\320\301\351!"
+	.string	"t\211\243\030\211\3573\327\017\240K\325\363`\316i\375@\020\267\274\355\b\266Ml\265\020\f|[\006\016\237\021\227>Kw\3715\221\325"
+	.string	"\221i\321\035;l\351\322\354\307\2713[\325\241\207?H\325\236N\335I\265\214\352\270\352]\265\252\372\003"
+	.string	"\304\350"
+	.string	"\017\243\2313\266#d\342\2202J\330f\331\"j_\346-X\017YN`\316\231\215\233\0315\tj\335\202l\260\033!\335\035\271\\\273d\322\177&\275\266\265r\217{\241p\035F\007Q\355\263S\376\342d G\303iP\227\242\234\270z\373D\350\306\273F\267{\334\313\204Kw\374\325="
+	.ascii	"\003\243\3612\344\265 :7\2734\217\374{\301\226\303E\203\330N"
+	.ascii	"\335\205s\2379g\245\273T\2422\241PL\252\225\325I\312\t\203J\252"
+	.ascii	"\344\251\234PP^I\265\362J\0208\265\301\244\362VR)\225'\022\316"
+	.ascii	"\307\271\263\320\222Z\326\345\\h\033\310b\250\210K\233\341@f"
+	.ascii	"\223\202\207gm\t\307q\356\023@o\337\016\221v\013Z{\002\005\375"
+	.ascii	"\347Y\222\207m\331\267Y\215*\034wBR\013( P\002!c\322\016j\322"
+	.ascii	"\211\246\033lX\r\263n\353\276\211.u\310\211\221\200\016\301E"
+	.ascii	"}}hx\202A\355N?\351\372\032x\020\260\340`\323\\\220\016{\fnR"
+	.ascii	"hD\304\201\001(\fBvX\254\3410/\243\255\221\324\217\302\315\253"
+	.ascii	"q\t\017\243\177a\033\265\345 \314\337n\244\013\264\3364\245\350"
+	.ascii	"P"
+	.text
+	.section	.gnu.lto_config_streamer_can_append.18.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\375\013"
+	.string	"vWTB\020q\233\016\003\340\b\n\026\376X+\017\037!F\"\364\246\004\007\300q\nY\00508\332\243\237\251\327\257\323<zl\213j\3247Q\023"
+	.string	""
+	.string	"@\326\253\214g\237\270\363}w\374\273$;}\262\267\224)\005B"
+	.string	"B"
+	.string	">"
+	.string	"\217\266\235`\301f\356\336\207Q\001\222\020\030Nf\354z\225z\340\222;\324\344\374"
+	.string	"\035\350\220\n\271B\004\033V\204\b\350B0\343\242\303\312\277'H\367\221y\341\354\256S\324i\270\343mC\260\355\300\376\203\326\210Q\206\356\"\031\273\243\026\226m\021UD\330\336l\214m\365^b\273\211Q\030\300.\207\225\224\335\325\270\001\365h"
+	.string	"f\332/9\211\355\245\317\007\354\222R\244\354z\032+\240\036\355=3=R'0\005PUm\255B^\0245*\210\301\013\025 \324\237\351\272\361\305\370H\032\326\177&\325\353\277\303\022\021\026\037\f\024\221P\266\330\036(uD\245\306\310\211\225d;\035o\362\303\227~u:a\372\227\227\005\217\006/\255\263\001mm\262\213\243se\036Z\204\t\036\t\035\230Uux:\034\225\225i\325\346\2001\nWVy`XVa\274\275\222\374\357\024\013I\t\345D\372\334d\215\232\nb;\325\234\013\0322\001/\031\020"
+	.ascii	"\252\322\201\301\342A\035/\013\205\021u\341\252~XWt\r\353\271"
+	.ascii	"\340(\255\006w\306x\300\006h\3024\205\246\245=\032\230\332\003"
+	.text
+	.section	.gnu.lto_config_streamer_finish.19.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`\362"
+	.string	"-\f"
+	.string	"fVRA"
+	.string	"Q5\0358\351\262,\334\035/\241\200\375$&\343\260K\2631\205\263\323\300HG7[\n\225/\361\370*\001\337\021\200\375\320\376\351\204\364\377o\200"
+	.string	"a\035\fk\375\335\331\250\037W\"B\266\334)\005>"
+	.string	">"
+	.string	"@"
+	.string	"\273\313Q>\311\216\315\023\310\216)\211\203\237*A\377\2527\030\321\341F(\202>9\\\347\201\227G\016\001\342hNJ&\302\253.5\210\")5\006\273k\031\212\033n\354\266\035\330V`\177B\343?\245\3647\314\207\022I<\251\265[\032\331\26150\032'l\203\266\304\366\245\375\324]\200\037?\037\260k\002q\355\216\b\234`;\346q\263\355\2578\013\320\376\230#J,\220\002$\003+$\362\241\001\300\b\201B\307K\244\240\243D^.\265'\273FX\331\030I\021\333\026\376\302\263\355\356\002\177u\001\303V\342\230\377\311\216]UD\313\004\242E*$G\354\021$\365d\177\256\232l\225\326\036\335\335U\276\213\306r\371:\034\b\0222\230\215\327q\233\214E\303u\037\207\253\030\260G\341\362q\035\317\3738\311\270\2675\245\204Td[s\031\376\320T=f\250\230zb=F"
+	.string	"\324\003\017\254\020\034\233\264+p\002\026"
+	.string	"\252\244\223i\021\206\341Z"
+	.ascii	"\034\346A\212\241sB4\b\342\n\203\255H\035\f\026\240!\023+\260"
+	.ascii	"c]@\263\206\013\343\221f\244(c\0044\021I\t\264\352\246)\205\202"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_write_word.part.0.25.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`v\002m\023"
+	.string	"fd~H\340.'\035XnIn\027\326\265\017\023\364~\037\247*\f\343\031l\006\n\3706o\336>\271\224\326\177x\351\331\257\371M\366\332\006uo\340\266\272\301\fs\031\034\332A\037!P]\034G\363\315#^\313\236\220\275\267\334)\005g"
+	.string	"k"
+	.string	"e"
+	.ascii	"\365\246tTk\270\340\323\f\276O\207\237\375\035\026\232m\237\304"
+	.ascii	"ubv\222\fqj\236L\023L\016\252\326\n~n\034\001\375\224?@?\367"
+	.ascii	"\303c\237r#\215\3711\246\326\362\271@Or\276\270\2201\355j\032"
+	.ascii	"\276\022\302R\206\035\215\332L\336\306\t\367\335\243LM\026\243"
+	.ascii	"\201S\317\243\326\352\257\346\366n\373\303v\004;\352\002;\243"
+	.ascii	"\343s\377\005\200N\003l\265\322D\315\250\035&R\210\353~\242\373"
+	.ascii	"D\027\362\213\206\200\374!\247\276\026\332g4S\364\342>\020\213"
+	.ascii	"\277s\312\366u\017J1\355A)\033\263\260\326NX\244\320\201\252"
+	.ascii	"5\344\370\364\203/f\247\274\361\271\037\225\375QQ\021\2503\034"
+	.ascii	"\210\0061\336\207\345=+\252\260b\2409F\373<\017c\357Yy\201\032"
+	.ascii	"#\226\202\352z\360>\200mi\303\356\215\345S\350\\\225\210\030"
+	.ascii	"\270\246Y\224a\215\030W\256\315\022\211\217\231\273qa[l\217\334"
+	.ascii	"\004\311Wku\340#Q(\361s>\375\025\n\240\204\177T\241\345\347\370"
+	.ascii	"*\3643\356wWP\323B\306$\304\301%F\305\275\361\322\313\2727\333"
+	.ascii	"\213\376h\264G\243\351u\367\244\321\362>\177/\024\030\b\354E"
+	.ascii	"]\254\220\020\224\ttu\257:\\\254\022\020\226\013\366\372\020"
+	.ascii	"\031\t1i\255@\223\021\220\022p\345z\201\035\t\334:a\271@X\253"
+	.ascii	"\345\002S\337\233=\232&\030#\311\361\357.a\006\005\214\321Z\270"
+	.ascii	"\223\350\2672\266\277\265\207\313\312\274\227\325[%\222\305y"
+	.ascii	"\f\fy\022J\327\333\230{\261\311b\324\t\272\224\347f\333\331\357"
+	.ascii	"\223\n\233\0252\342\0021 \200\002\031\263\253\003\352\351\234"
+	.ascii	"Z@y\246~\025\026\324a\314,\362*\003\205\325\013b\035M\313\343"
+	.ascii	"Pth\302npm+\260\362\3571\nc\033\234*\203r-s`\007h\351\021\346"
+	.ascii	"\\eH\347\212\215*d\222{\0314[=\2536\004\361\t\332\214ov\211$"
+	.ascii	"\221\033$\275\223\255=\355\006\b\355\036\232\254\272v/\f\364"
+	.ascii	"u\342\b\240\274\367Z<\006"
+	.text
+	.section	.gnu.lto_config_streamer_can_append.part.0.26.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`p\003\355\030"
+	.string	"6n\241H\300XM:pI\230\t\241\201o\244\251\332\240\220x\320\216\375\324.\313\267\257\315\007\304\347\354 \034\321Ey\310\257M\267\336\250\214G\027C\005\356~\263\242(\"\3534\031pBQ\3020@pl7\247\3376\331{\313\235d\211"
+	.string	"\221"
+	.string	"\202"
+	.string	"\222\371D^\304\347Fb\027p\357\321\223\333\275\243\203S\226`Oy|\201zj?\240\2362_\bG\230 +\2120\301\207g\037q\020\021\020{\004-}\271wd\235\366\215\231\234\343\271\312\331\273JgK;\343\203'\336\321\200A\267]\n\201\237\254R\205\350\342\224C\250\305\006\316\t|\3619-\020\t\222\203\006D1;\251\326\304\003\201d\337\366\006!\356\3039\201..kn\273\233{/\377'<\257\316\314F\314\274\201\271\277\"\024"
+	.ascii	"3\356%\312\205\2714\350\022\037\177\372\233~\251?\352\223\371"
+	.ascii	"|\250+\341/\371\024{R2&\\5o\030\340\002)\305\270i\260\247Q\267"
+	.ascii	"\330-&\357\020\215[\323\342\212\370\304%\203\255\235_\223\361"
+	.ascii	"\235nc\357)I\222\236\233/\305\006\221\351\007\006\373&\246\036"
+	.ascii	"i\303\3243o8^\026\3367$e\210\315)_\260>\314\036O\371%\331\034"
+	.ascii	"/X\3043\351J>?\302S\274\272\267\206\226\333\275\267\202=U0[~"
+	.ascii	"\224\335H\f\301xY\024q\007@\022\f\363\235\210x\361y\360{\352"
+	.ascii	"\251Lw6\206rB0~\336T\262$9u#1s\327\262m\215\025\032\220\332\263"
+	.ascii	"\273f-\321\274\320\266\367\261Z\233\301\024\355G\227{\254\276"
+	.ascii	"i\333\210\t\n?"
+	.string	"\231\343\356\331\237\272\305}C\270\240\267\354\333>\251\302*\037\2566\346G\346d#q\333S\230R\245\203\373\210\231%\317x\235d\231\325\233\316\266J\356\036u\256U2\275\324y~\351\357?\235\345\307\37743-\034\351\001G\222\370\207\035W\273L\350\360L\027O\313\303\344\234\0070\327\210\226\013V\202\007'\204\016\210\235W\016kG\2475\202\225\003\343a=X\300/\022.\030\253\304\353\005cy\357#\026!V\325\240\352?\253\267\335\206\021\213\324\240&\177Vgf\232o~\372\333\3215\022\037\240\031m\241^\033\240\031\255\220\262W-\264j\333&\224\242\364\347\275\367V\b_\265\327\035B\334\207C\002\344k\222qDE\033\211\212\212H4\203\351v\r\356'P\"\243\313\314\375Ue\032\246\204%C\250q(f\0303\210\020\t\246&\230\321B\r\007`\002\031\203\327\001\021\320I\303\366\337\006*\207\200m~J"
+	.string	"\f\203\240hL\005\027\027v4\354\025\321k%I\376H\215\242N\300\244\244\232\030\305yF\252\201\231L\344\272\204\311\233\004\276e"
+	.string	"\215\351eU\353\021\027\220\254\035\315\304%\307\335\n\217\206\366c\274c\376\323\001\203\276\"\335r\030x\2422\3616\343\256"
+	.string	"b2\270Lmh\033\025\215\216\005\265\232Y \236\024B<\0373\204\002"
+	.ascii	"iYO1&\244\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\275\007"
+	.string	"b\013,2`\213\322\001UBL5\004\306\360JAfm\302D\236:O\251Y\350\033d\203@\005"
+	.string	""
+	.string	"|\004\020\032"
+	.string	"\200\377\366\277\375_\362\354\204\355\376D\356\224\002\005\331\026v\221*\200Th\221t\017\206\2447(H:\350j8H\204\374H\207(S\036P\231\256\3446\0225L\324\351\013\333\302.\322\304\t\2224\t\336\031\270F\340\231\200o\334\266\275\370\332\202\3179^\260\360H\036\235c\212\321\001!\342\374\262\271E\363J\202\205]\231W\230S\r\306\212\313'\f\b\245\214\b\313?.\263,\313*\247\030<\b#E\373v\024=\275\367^uOkk\216\034"
+	.string	"\250Kh\227\241e5\026\030\304\241ch\315\340@\355"
+	.string	"\350"
+	.string	"\350\372\200\007\2600\036\326lA"
+	.string	"V\240\201\036K \\\t\337"
+	.ascii	"\177\244\022\300\004\302\354\374p\320\"\020>\003\310\265\252"
+	.ascii	"\f\004\027\034\247\203\351\004"
+	.text
+	.section	.gnu.lto_.refs.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a6292b21320c1220,"e",@progbits
+	.string	"(\265/\375`z\021\245T"
+	.ascii	"\352\2160\037Q0RJ\032\016\246\272\252\371\256\273\257\253\336"
+	.ascii	"u\021\375\211\001L\325]y\f\334Cd'\355\330\216\217\320\r1\245"
+	.ascii	"!0O\026\274\373\177P%\2411\n1@U?\256\273=3333D#\002,\323\333"
+	.ascii	"\2129\242\322\262\3122\373\3351X\b\267\2252\005\226\001\330\001"
+	.ascii	"\357\001E,\301\350w+}\016{5\336WH\372\315J\241ls\237c\036\034"
+	.ascii	"\3512\327\275\036\306\037\224\266Q\326y\300R\367U\220\002\330"
+	.ascii	"\232MV\350\272\273\312R\331u\323\216\256??\004\350\210AIb\306"
+	.ascii	"C\277\316/\232\f\335\003\370\274\240\255D\030\335$v\312\256+"
+	.ascii	"\366\354/b|\247\202\365\227/\r\022i\3160z\244\364u\273\202\267"
+	.ascii	"fA_)(xT\312\265w.\030\362\343\b\243;\032\322\033\245\377\245"
+	.ascii	"\217!=\f\351g\244<\317M\301\373\227\311\325\320-\347\321\212"
+	.ascii	"\321\177\305\376\365\332\257m\356\220Q\313\036\353^{r\276\354"
+	.ascii	"@\2432\272H6\311\256>\273\344\013\266a\357\035\327nv\257;8N'"
+	.ascii	"/j\214\262\330\024<\024(\375*9\n\260\216qN\277>\274\235\365\341"
+	.ascii	"}\335\024\274tQ\360z\275\237a\274 \347\300\316\3175&\320\370"
+	.ascii	"\315\317\034\374k\343B\372s\017\322\277-\b\360s\006+,X*g\377"
+	.ascii	"\323\376\243\375w\373\362\037nY\370\017\300\001\037\340g\030"
+	.ascii	"\377~W\370\317\345\337\nT\200aSx\317\317\273\377o\377\216\200"
+	.ascii	"\302\377.\377\265\374\217\243q\337\317\016\374\013\302\t\257"
+	.ascii	"\371\331\200\177M\370\227\204\177C\370W\306\277\023\374\013\301"
+	.ascii	"\277-\376M\377M\340\337\025\377\022\360/\212\177}\377\366\376"
+	.ascii	"\335\177\371\277\363\277\334\3771\377\263\374\207\341\377\332"
+	.ascii	"\177\032\377\303\376\207\371\017\346\277\023\377g\374\237\373"
+	.ascii	"/\366\277\371?\201\377j\377q\352\352\352\352~F\373\331\354\317"
+	.ascii	"i\022L\254\235\242\025\321\312\301\350\305\254\230\217Y\345l"
+	.ascii	"\212\321sUzvJ\177\376y\3358j\326\246Z\312\341m\315\256\317\357"
+	.ascii	"\333\335*\360\037\3351\260\354\366\361\f\223\03213V\235E\373"
+	.ascii	"t\253T\310\346\225\332\203l\032\033)\366L\366 \327\266\032\240"
+	.ascii	"\233?\032\271.Ut\251r\257}\274J\366q\251&!\327\246\352u\251\362"
+	.ascii	"\3641\311\203\\\215*\262y\225\\ds\231\354\351c\253}4Z\245\307"
+	.ascii	"e\022\271\3042\311\203l\032\223\310\343Ur{]\3666q\266^\251L\335"
+	.ascii	"4\372\272;je\2529\335F\252V\331X\252\257\346\244\032\210\336"
+	.ascii	"'\022\353\217\356\356V\307\336\260\226\275u\251\237H\256\245"
+	.ascii	"\021S\367[KM\240\256\272vwS/\251\333\315\264Ru/-eP.7K\023U\373"
+	.ascii	"\372h\214Z\302Z\3460--\233\232\313j\223\310&\3262(\t&Mf/\255"
+	.ascii	"\3522\373\355\212*m\252\013\306\327\034\242\214\032\323s\003"
+	.ascii	"\323cL.\375WL\032\016\222&\227\2620m6^iXc`\234\330=!\tc\266\356"
+	.ascii	"\344LM\rY\362\227\235Kq$\221JF\345T\240e\244\020)\262\226\302"
+	.ascii	"\255\022{e\237\312\265q`\360\366DE\327\344E\214\205[\266m\323"
+	.ascii	"QW\004\312<Qu\355\227\023:\030e^\230q\333e\267,\227\325\262o"
+	.ascii	"\353e\327\205[&\276\317m\342*\326\356c\330\277cdw\352\364\272"
+	.ascii	"\257\344\230_V\356\334\347X\007[[\346\266\t\334>\3314\235#O\037"
+	.ascii	"\265\342\346~~T\374\374\374\260\030$\202d\361\240\333\306\233"
+	.ascii	"e\335\276m\213%\347\270mh\267q\267\205\316n\213\032'\021c\030"
+	.ascii	"\017\375RI\277QR\356M\301c\261_\351\252\355\022\273^m\327\216"
+	.ascii	"B\221\tMN\324\030}\3151\345\2573\222\277\327\233\002D\326\025"
+	.ascii	"\032\257\277gC\346V\305$\223\036\2353\302\b\356Z\236uI\313\023"
+	.ascii	"L\023vhq\342\210sW\252|\243\313\272\362.c8\254<YK\213\271T,\325"
+	.ascii	"/2\352\236X\322\320u+}x+2\t\023\363\314\305Ft\220-Q2\312[<\345"
+	.ascii	"\017@\310l\245L\304Q\260\245og\334\261f\306(\027\331+\254e\244"
+	.ascii	"J\r]b\235\205X\031\213\207"
+	.string	"P\001\271\256\352\213(T\312\007r\224p\032\"\n\243\347!~\006\302A\216:[e\276\230\214\262\220\240\363\220\036\0203'6F\267\256nQ\360x\232\2739\213\203\370{5@8\361`\306\350Qez\3761\304\313\252\214\321\264\367N\336Q)++\356\021\304D\016\036]7tacx\214\361\341\203{\354\024s\241\354\320a\317\252*\356\321S^@\304\023\263\307\344\344e\344q\356\341L\231\020\241rt\242C\007\373P$n\347\306\205\255My\366\301\351{#\233\363\301(\367\260u;;l\031\342\205Q\336\261`r\334\310<\201#\303\2732\205\306\214\221\251Oq\216\224\247\227\260<a\356\330\300\230\341\001\3079\007\312\224E+\r\243\234\3345Ak\026\301(S\355z\244PP,\225\366\206)\301q\362ZsF\235\245\356\345\246L\225'$\237\255AI1\372\035\222\217\354\304GF6\300:\260\016\214\f!"
+	.string	"\"\210(}n\204\250iI\341\2463r\333p\226<\311\022c\224\231\366J\325\017MSw\242:\222\360Z\213K\317e\251\0316\232a\225\327\275\353r\212j\351\266\314\367\314\317\260\232\252\335\352\332S6Pp9x\320\265\222\312\347\347>\253w\346t\037pC\227\232\221\321E\263u\251\327\2263_uin\236IUK\316\007v\006\253\031\335'6\303\237\321\020\013bP\311W\303\220\260\204\033\026n\344\242(x4,\022\201\200DJHC\301#\240!Q\tH"
+	.string	"$$\245`P\030\264)\n\361n\b\207FEa\320\246\306\017\210\204\026\201D\033@\033<`\321/\005\017vn\344\242\004\032\"\314"
+	.ascii	"*\002\213\206\277\"\213\0319DC\241\0136~\303\"\3410\005\241\020"
+	.ascii	"fhP\302\007=D@\233_\361\327\201\r\3410\t\b\2741\"\036\005\217"
+	.ascii	"j\030\021\225\220j\020\225\212\277\"Q\200\341\257HLQ<\n\036\005"
+	.ascii	"P@\020\230\224\364\023\n\376\206Z|\350F\002\027\305\341/\311"
+	.ascii	"\005\321PxC\bX<\032\336\350\371\320\321\020\030\004\026\245\237"
+	.ascii	"\200\202\b(\220a\203MQ\350\005\214\264\210$\024n TC\004\254a"
+	.ascii	"H\210\024TJ\211=E\241a1\251G$\002\207DD?\033 \016GD\364F\f\\"
+	.ascii	"\230\004\034\002\025\205\302!\020NQHF1x\244d3\303\336X^\361\307"
+	.ascii	"\303!pG\004\022\177C \257(\004L\272\241(\024,:B\372\t\r\2015"
+	.ascii	"j(\315 \264\300\203\2028`\301\302\t \244C.\206@\033?\340\260"
+	.ascii	"H\024*:\252\021\024\016\001\005\217~6\200\206\206D \027\013X"
+	.ascii	"\341\362\351 \365\303Y\025F\352<)\311\022\307T\234\373\354\362"
+	.ascii	"\301\3444v\246J\230\031s0Z\032\005j\016\354L\265\332\001,\313"
+	.ascii	"\224\256\0353[O\3145\247\212X\324Q\n\2279\361\001\b\026\243<"
+	.ascii	"\246\363TR\027\204Q(P\270\f\r\323\267\234\213\002w\004\331O\306"
+	.ascii	"e\013\326S*\352\230X\322\320\365\204\020\331zB\314\256\\V\303"
+	.ascii	"\306\245E&\344\3109\311\021\036\333\271\355\332\312\345N\256"
+	.ascii	"\n\\ZW#\225>8K\240\2264\021v\036;7y\021\343q]F\270\031\031e&"
+	.ascii	"\327Q\256M\231k\262\330\337\2731\222\325<\002*}\004`;\222IF\031"
+	.ascii	"\354q\314\025\027\365\205Q^r\247R\013\235\020\274"
+	.string	"^\301\302\262\304(+\321\231\022\201e\250\2210\207\2304\"2#\"\222$I\206\003q\005\204 &%\355\006\022\240E=\323\031\207DDf\n\222Re\343.\213\032\247\034\324\262w*qh\013\264\030\223\324\013\303!]l\024\313CU\203\372\025\206Z-M\256\210"
+	.string	"\211(\321\337\373\274-'\255\302\374q\336\226*m\241\340\003\024\021\244\225\204\204#\371Y*\220\362W\336O\3659(\265N\031\247\365\001\263\245;@\232\001\317\220%"
+	.string	"\311\r\322\034Hv\207\334\247{\2721\001\340\"R\311\264tN\370\244\323*\333\364<\344\030\300\223\3074_\030\030l]\242\022%\304\306\250\322\375\360\215S\232\363j\356\020\240$G\274\371\222]\255\275 X+\032DA%\250\302\253 !\345\200\025\206\331\216v\334\200=\200_\n\301M[-\001\365\227eq}n\303D\321\306\225\"\310Fo\246x\275_\304'\315\232\026\204\274\363\215\3718\033\267$\367\234B\025z%\203t\336\307\221Cd\240\n\"!T\317\314j2\346?\212G|R\250e\rT\201\272\224\013u'2\032\215:\315:\207W\235\311L\211J\251\243\366\222\216\002O\340\016\024C\n\243c"
+	.string	"K\r\236~JU\036\214\252e\317\016\306\227\333\261\266l\024:T<\274\231\303"
+	.ascii	"\234\026\355B\347\213y\017\217\254XF\b\020\016\"\233\20377\304"
+	.ascii	"#\205\020:\r\231 K\t|\023\004\216\323\321\262,\034J`A\200o\331"
+	.ascii	"\016^\346\300\300\320\3054\205K\225\230\252_\035\270Jc\245\035"
+	.ascii	"i9\030:0\364\"\251Fk_\236\210 \216\242T\"\375*\354XR\225\377"
+	.ascii	"\177\225\374\3730uw'a/R"
+	.string	"\244\234\213!/\013\3059\301\262\017c`\346K\254Sl0fs\333)!\342XF%\026\2041*\332l\353\344\336b\307\347\243\257\236\t\013+\316\256\260\372-\205\226\3751\205s\354\027i\360\233\ns\217R\021\345-\247\227\210\352\215*\3206\357\372:{2\321\221\210\317\275\304\243\021<Si0`\334\034x\320y\322s\243\227\006\342^=\322\365)#\305\003\001D\341=A\034\262<\347=7?\\:)\026\2672\222\312\217\346\024\327^\370\374\270\262\221\036\326\341Y,~z\202\316\335!\221\340\301\346B\270\2463}\007\316v\257\241f\003|G\271\277\347\031\006L\005\212\273\340\022\213\275\305\340\355x\244\343\365\330\343<\214\017\240\262p\267\210\254\214\3130\005f$l[\341\020\366\323;\300\033\211=\205\265}\365\367\323\347\261P_\244\025y3,\235\237\277\264~\022\177\235\f\202\236\303\330\017\213\213\351h\016\262"
+	.ascii	"\317g|U"
+	.text
+	.section	.gnu.lto_.symtab.a6292b21320c1220,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"config_streamer_can_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a6292b21320c1220,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,507 @@
+	.file	"feature.c"
+	.section	.gnu.lto_.profile.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 \250\265\003"
+	.string	"\264\005\234"
+	.string	"\r"
+	.string	"\227\247\344\313\017\004\002"
+	.string	"\002\001\002"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\203\313\255\261\f\002\004\312\251\326\231\r\001\005\335\374\335\212\013\b\002"
+	.string	"\006\364\327\362\364\r\007\347\364\313\323\006\004\b\306\272\236\261\001\t\222\200\241\200\n\217\204\314\271\002\013\255\363\313\362\b\f\240\342\234\212\n"
+	.string	"\n"
+	.ascii	"Z\030Zf)\2000:g\345\360\305\321q\211\2423\314\224\3336\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 BE\001"
+	.string	"\2706"
+	.string	"\b"
+	.string	""
+	.string	"\001\003\001\003\004\005\001\006\007\b\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\007"
+	.ascii	"`\b\030\027\f\202\313T\246\311\fp\003m"
+	.text
+	.section	.gnu.lto_.inline.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"\305\003"
+	.string	"\002\005\017\027\260%\351\fE\223\202QJ#j \222$l\264\021B6![\356\024\377\374B\366A\227\254l\312\377\230\240\261.@\333\340KBq&\303.`\377\234\367h\360+\261m\311\233k\b\030"
+	.string	"Q9\260\203\212\305\272\020X\006Bp\301\260\325` \031\341&\b\354\224\254\300\260>j5\200\007\307\2260\261\205v"
+	.ascii	"\362\3000\300\344(\2743\033gA\302\245U\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 BM\001"
+	.string	"\3206"
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\003\001\001\003\177\002\003\004\005\006\007\b\t\001\001\003\177\002\003"
+	.string	"\006"
+	.ascii	"`\b\030\007\006\003C\250\214\264\001,"
+	.text
+	.section	.gnu.lto_.pureconst.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\003\204\004\004\204\004\005\232\004\006\232\004\007"
+	.ascii	"\232\004\b\232\004\t\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 \312]\002"
+	.string	"\224\002\276"
+	.string	"\b"
+	.string	"\001\002\004"
+	.string	"\001\002\003\001"
+	.string	""
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\003\001\300\007"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\006\007\b\t\004"
+	.string	""
+	.string	"\016"
+	.ascii	"\2202\005\003`\035X\030X\244\347:`\204\244\216NE\302Mb\324\274"
+	.ascii	"c\027\037\004\274\001,"
+	.text
+	.section	.gnu.lto_.lto.1781eabc6436692c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.18.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 \236\255\004"
+	.string	"t\bh"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\244\354\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\023?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/config/feature.c"
+	.string	"\004"
+	.string	"\237\n\013&q\020u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.20.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\211\201\202\003?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_featureInit.22.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"E\007"
+	.string	"\022\01635`m\322\001@\337\r\024\260u\234\367\262\200)\306\220<@\r\325\212\224P\227\f\3271\320\266\327b\241\205\201\240\362\b\002Aq\321\227\360\354\360\244\377H6\221;\245\306\256Lr6\224\254\002\031,\025L\304 \306B\271@Lj\340e\340\330\220I\270\211QB\213\264\235Z\005\275\r\323\246\036_\375\217\203\\\374\220c&S\375ii\226Xs\017N\300nD\202\337\361\221\203\037\372\363C\307}\376\371\235\352\357\272\200!\032m\356d\223<N-\354S\273\273V\220}\347S\226\006A\310.\305\351dMO$\303\366-k6I\201\304\300\310D\311dw\241^\\\273\323\374s\\`~ \356"
+	.string	"\024v\327n~*n\275\355\003\333\b\266E\001\t"
+	.ascii	"3\241{\037x\305\\\366Tr\210\252\301\273\340\177\0317\\\216E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_featureIsEnabled.25.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\235\b"
+	.string	"FQ>90\345(\035\3003\004\027\f\232\0275i\250.vx\244FB\037\360h\003\177\344m\375,\017\255\001\004\333\234#A\204\202\202\002\210\"x\270\212t\033\004iKH\223M\244L)-"
+	.string	"/"
+	.string	"*"
+	.string	"\207\266\335\340\360yt@\241-"
+	.string	"N#/\273\254\250\032\037=G\376?\256\340\302\202J\221\236\001\017\273\353D\245,n\275\355\004\333\321vJNM\037\033@1P\331\255h\005\330\025h\302a\373\2633\2663\355w\334\343\373j\302\230\335\013\222\222]\021\006/\b\034j^\200\035^'\300\002\331\362\245\327\324\237T\246\203<\304\3637\034\022\345Q\207\276\b;\274bT\245l\331,Rj\206\375kw\327\212a\370\325\177i\006\021^\346\271\254m\266.\004\3126N\204\350p>\234\026?\235\314\023\265\316\213\033\004s\022[\027A\034\327\305\fko\250\232\222\232\354{X*\324\237NL\001\b"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313\250@\215o\342\020\246"
+	.ascii	"sM2"
+	.text
+	.section	.gnu.lto_featureIsConfigured.26.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\r\t"
+	.string	"v\322A:0\345(\035\200\213\0073\177\025(\027jhe\re\203E\232X\t\236\255o@\206\001?\364o\006m\007\005\333\234kz\035\f\f\bai/JY\235\207\256\334-#\233H\231R0"
+	.string	"1"
+	.string	"/"
+	.string	"\004\332\241m34\244\254\372\327\321z\206\307B\021\260\373E\345\270\352\251\362?r\b\362\202\361\\\024O\201\207\335uz.\213[o;\301v\264\r \260?\323tj\372\232v\361b\320\262\333\212\rX\027\250\362a;eklg\332\017\271H\3520\224\007v1XRvO\026\254\2209\334\274@;\314\036zM\205\001X\257\316\0237Aev+\034|\222\227\220|\217C\233Ny\357\320?i\207W\204\030\330*c\366\327\245n\330\317vw\255\032\206\017\021\244\216(\263\207\363\341L\245\316\007\024!B\240\321\346\211\243PG\024=\034)r\016\274I|\270X\3326.j\276\325\ru\263\322\316\376\246\245B=k\245\313\230\263\b"
+	.ascii	"2\003\3020\275\341\310\241\262\272\313(E\215\177\350\020\306"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_featureEnable.27.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"-\013"
+	.string	"\366\323H@0\247*\035\260\373\274\3528\354A>\r\375\003{\235\327~k\036XQ\275v8\321 \300\3133\2272`\031^\002\324\226l\004*\251\273R`\244\330\320\260V\\\265\362\373TI`0\262\211\334)\0053"
+	.string	"7"
+	.string	"5"
+	.string	"\206P\270t\370e\273\324\276\260]\372\263\027<,\331\273@N\001\034\354\356T\222\177\217\237\177\326- J\3431Abw\035AT\307\255\267\375`{\332\027\005\326\276\372U\243\243eKI\300p`\227c\006a\021H\003\252\327\013|\034\300[\244\207\246\210q\2276\311\346.#g\373\321\276\312W\276\2572l\331\r\201\311v_\021\001\251M\t\034l Uu\323G8y\230.\340\0030|\023\203D\361\340h\273\224\372\326/*\227\002X\252\024gvh\212:b_\333\335\265\212\330\032\275i\264\324\030\026\240\214G\263\006\263\361D\241\314\2063+:\234O\247\231\237N\30635\036hb\032\334]l\274\031\352:ora\351\254O\240\310\0360(\251\311\232\306T\243j\260n\024\365\257\377d#\033"
+	.ascii	"2\003\302\360\317\302\"\233x\0208\251\314\002\327$T\200\270\340"
+	.ascii	"\360P}z.\202\225%\305\356*\233\223\232\002\007\333\3125 \204"
+	.ascii	"\b\020. #g\022\240V\256`\211X\265\002N\362\342\232d"
+	.text
+	.section	.gnu.lto_featureDisable.28.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"}\013"
+	.string	"\266\024K?0O\224\016\254x\201#C\023\245\256\267\306S.\337\231\235\317\372\n\337\032\330\004\343\201\216\007Z\305\332\f\332\016+\2669\327\364:\344\"Y5`\207\376\240\020\020\303\"\232\211,\"d\023)S\n6"
+	.string	"8"
+	.string	"7"
+	.string	"{\n`"
+	.string	"\031\207\036\217\\\207\3267\256Cs\366\212\177\023\366\035(\200<\270\330\335\250\022\316=9\377\245C\274\220\202'&`w\235^\310\301\255\267\375a;\332_\020\232\206\232\266N\372U\323\251q\235H\301ab\267\301\n\306\242\200$.\234^Bt\0167y\376\231\200*;\264=vv\230\231\355\247}\r\337\300\235\224\300\220\335\007\"R\033^\213K\241b\372\030 Q\227+\253^\232*\320?\034\004\002\277\2025\234\274\327\271\016\241\336\364H\206N\005j\364\311\225\375u\251\021\354[\273\273V\b\266\2461M_\001\0064\023\214e\212\244\262q6\223\212%\026\270X2\032%f.\023L\244l\232(\351\260v\240\262\305\215\246m1\373>/}"
+	.string	"\206\324\013\026\037\355l\351\210T\013\245uR\177\372-0\030a\032\342\001\033"
+	.string	"2\003\302\360\322\302\242\233x\0208\251\314\202\234$("
+	.string	"\273\240\341\241\344\364\f\004\001\253\312\356\020\354\235t\024:\204\226\256\001!D\200p\001\0319\223"
+	.ascii	"\265r\005K\304\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_featureConfigSet.29.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\245\t"
+	.string	"\206RC<0\345(\035\200\277\236\277fl2\035.\235R\271\377\006\336\206,\005\006\216\025_,]\345\360\2060V@\333A\3016\347\232^\207\226d\243\241\302p\207\032\346\txb6\310&r\247\024."
+	.string	"3"
+	.string	"/"
+	.string	"\327l\227\332\r\266K\1776\314\303\217\375k$\025\013\260\273S=\376=~\376[\317\200*\213\307\201\206\335u\004U\030\267\336\266\202\355i\277 \003\\\016Xv/f\004\266E\252\254|\223\273L\017\375\260\"\262\273\334\245m\262\271\313s\266\037\355\223\274\344;\253\302\231\335\215\024\331.\214\301\013\004\227\t\001\251\f\324a\217M\370 \036\225\342\301K\237b\273\214z\3275\253\327\013\212\306)\316\354\020\025\265\303\276\266\273k\345\2605Z;\353W\215\216\333\026\021#NHsg\343\361J$\216\3473!@\037Q\327\231\"\020'4;\336hn\020\334Ix\274I\352:or\341\351\255;\204\310\004\304\234\024eMO\016\002P\215\252\351\013\004\016"
+	.ascii	"2\003\302p\036aYL<\bXR\354\256\262\211\244\254\256\313h\246\342"
+	.ascii	"\001*\004\261:\r\256\345\2050\311"
+	.text
+	.section	.gnu.lto_featureConfigClear.30.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\375\t"
+	.string	"f\323E=@\305(\035\340\265^\254\253\273T\007\230\200\373$\246\375\007kL`%\344\246\334e3\324O\305\327\240W]{\230\262\341\304_\371a\r\005\2149\017\261la\314\365!\026\255m\"wJ\0012"
+	.string	"4"
+	.string	"1"
+	.string	"\004\227\006\337`.\265\027`.\355\331\001\036r\354KNT1\002\273;u\343\336\243\347\337u\r\270\242x\314,\354\256#\270\262\270\365\266\021lO\373\007\001W\215\216\231\f\313\205\303\262[13\260-2\305\303'\371\013\365\320\r/ \273\273]\332({\273\374f\373\321\276\310G\274\267&\254\331\305X\221\355\302\024\234\020_\234YU\323\250\242:\354\261\b\277\303\245S<x\351K`.\243\376\365\315\307\007"
+	.string	"\205\225\2123;\374\242j\330\327vw\255\031\266FK\215\326\336z\017%\317H\363\247\003\352N&\017(4\035D!\022\367\231$\221g4?]iv8\346 @\3354q\\7\2670u\327\031Bd\005\004\244\364\263T\223\203\0034\215*\365\007T\027\001\016"
+	.ascii	"2\003\302p\301\3022\231x\020\260\252\354\016\301^$5t\270\314"
+	.ascii	"f*\036\240B\020\253\323\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_featureConfigReplace.31.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"=\b"
+	.string	"\006\220;9@o\323\001x\255\301\216\223\371bl \306zc )\020\177\214u\004\206\266%\267\201x\226\275\255\224\332\264\fB\216c@\364\213\035\f:\030\337\006\006df\277\355\275wJ\001("
+	.string	"-"
+	.string	")"
+	.string	"\324\236\355\362\020c\237J\211\030y\331\335*/\356=z\376?\276\001M\020\217\031\204\335u\004M\023\267\274m\002\333\3256IG\375qf6V8(\273\022\253\230U\321\023\215\313\366\243\375\216{xG=x\263[\241R\262+b\340\002\315\351\300\003\254\323y"
+	.string	"\353\001\356\236\032qXv\367\300\007yH\203\237qj\007R<x\352\223\254\323\313\244\005\206\342\213+;,Eia\177\356\356Z\236\354\013\035\006\232\316:\0327\022a\232\247*|<\241-\253\241\017\006\252\031\327\325\216\2007\006\215\253\242m\343\352\025~\237+ON\340P}\262\344(\035\b"
+	.ascii	"2\241\231/\360\342\002,\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"%\004"
+	.string	"\224\006\b\001"
+	.string	""
+	.string	""
+	.string	"\002\026\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\301\204\005\025\b\300\003\002\031\177\t\002\032\177\n\033\177\013\034\177\f\035\177\r\036\177\016\037\177\017\005\024\020\305\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\022\021gistry"
+	.string	""
+	.string	"\005\020\022\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\345\334\006\240\035\370\034\370\034\370\034\370\334\316/7E\232"
+	.ascii	"\205\211\310\252\236"
+	.text
+	.section	.gnu.lto_.refs.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375 a\345\001"
+	.string	"R\304\n\020\260'\215\001\f\3030\221\231YK\366\2262\245\024\t&\354\003I\r\b8\031n\330\3045c\032\333\\\242b\306<\2617\255\253B\005"
+	.ascii	"?\t\001#\2519*%\260\tf\023"
+	.text
+	.section	.gnu.lto_.decls.1781eabc6436692c,"e",@progbits
+	.string	"(\265/\375`P\016\375H"
+	.string	"\232\177\270\033BPdN:\203\207F\321gm\226\215G7\034\313\017\326\023\037N\316h\227\\\230\220g[\233Z\343A\240c\253et\236\021x;\273\005\260\320\005\200?=&x\363|\217&\005}\364\207+\252=\261R\246y\001\257\001\263\001t\032\354\216\375\201]\261\313\323/m\331\275\367^e\\\037Yt\330r\335i\023-Z\243\353\336\276\013fA\311\312\366\336\333\343r)\371\336\256\326y/WT\0064\312{=\2347\3512\227_\\dQ\244.\256h\217\213\326\204\237M)YT\312\016Nzv\271Z%\237\335\2761\347*U\266\227\377$I\315\240_\255\226q\022R\321\002f\253\035"
+	.string	"\355\002\204\016n\225\3333\365j\365\3479\216+\263\343\222\327\352+\374R\3478n\031.\201\217{\307\304\026(\363\272\354\b\335\333\236\245\034\307c\324\366\336\007NIdQ\037s\252\372\020+\263q\033K\241\370\355\274\306b>d\266Wzo\2734\344\373\263$\256\325gX\317n7\320v/\\\300z\206\022.1\224\360\2752`\002B\225\233\204\f\206\325\240\202\315\257\350\215\273\267\r\220T\210\217\313K\253o\231\200p\345&\341\033\235\233\023~kJ\254?\333\235\340+\303%\344\246\303\237\331\236\214~\016\363'"
+	.ascii	"?;\371\037\3673\377\357\277\213~\276\360\363\206\2375\374\214"
+	.ascii	"\341g\n?[\3709\303\317\034B\374|\340g\251\237'0\210\377L\177"
+	.ascii	"o\375\374\341\347\016?\367\377<\377\375\376\367\375\347\373\277"
+	.ascii	"\367\177\372?\357\377\335\1775\377\321\374\177\373_\346?\335"
+	.ascii	"\377\271\377r\377\325\3767\375\207\363\377(000\360gD\177\353"
+	.ascii	"\370\001\214\tK\026\264\204\350\336\345\022s\003\346\006j\032"
+	.ascii	"\331\2259\241\372\340\217\365\177L@\250\304MB\346#u\376k\022"
+	.ascii	":\241K}%\016\016\234V\223:O\236<nx\312\240\270/6~~sJ\312\250"
+	.ascii	"\036/i__\2320\310\224\317\024-||\274\267\336{\225L\227KO\312"
+	.ascii	"\231\352e\344\356P\031\035:\274\347\301\r\311\237Q\230=\037A"
+	.ascii	"X\357\274\247\352\211\341\353k\325\310t\252\367\303K\211\027"
+	.ascii	"\245*\\\374\324i\365\275l\323\206\363\206~\206\206dzi\004\265"
+	.ascii	"\312y\214\227\024\350m\272\326*\3435\303\3418g<~\203\304l\031"
+	.ascii	"O\275w\311\334@\211\271A\321\232*K7\241zF\264>\020\303\t\363"
+	.ascii	"\202 2\204\347\356\216\341P\220@S\367w\235g \234\333\250\221"
+	.ascii	"\262\032\256c\347\n\227\026\367w\235P\b\301\245\236;@\267\365"
+	.ascii	"l\206\317\234\355\244l\307h\030z\203y\332x)!t\241P\250\245\266"
+	.ascii	"0\271i\2403\232\237\302\205\357A\272W\355\336\233\240\210\016"
+	.ascii	"\232\225\271V\317I\326\377g\341\275B\212\332\353\344B\022\376"
+	.ascii	"|.b\206\372\2238\310\016\376\253\367\376\017\022(\273\227\310"
+	.ascii	"\036\240U\213\231eX\253\377\031\\\250{\225\316\246tL\031\240"
+	.ascii	")]\336\346\333\364\031\240\331\336&\006\256\264\3546\333\250"
+	.ascii	"R\215*\373\266\2279\366\274\314\250\322\330l\257\363\266Q%\323"
+	.ascii	"e>\231\232\355R\331\224\216=\271)\215>\003\\\346U^\346\262\311"
+	.ascii	"\312\214>\233x\321"
+	.string	"'SS\272|6\231cO\276m\364\362\2344\355\230\262\353J\227I\367\336\257\366L\211t\357\322y\225\001\335\245\265\364\226\366\302\322F\353(og?\357\324\236\3054Z3i2\236F\t\241v\347\201\323\203%@`\306\034aR\211\\O\002\256&\212\265=\177\367\266g\235\205\245\215\345N\355\305\322S\372\nO\241\355\025rT\346OO\315\203\003\017\222\374\354\365\205\t\257XQ\"\323B\371\323jW1\202\036\201\303\343\211\031K\233\312\032\310\213\335\241V\037\350z\216\330L!#[\257.Y\257:\237\254u\376\226\250?\326\253]\353\203\201kG\273\tK\237z\354\275\244\305^\264lo\333f\200rn\202\326\363\2230\030\030\310O\302\007\373\254Lw\326\007\367\326\277\223 )\222\276\001\224\327H\032\332zq\276\270Z\355\"m\204\245\n\372HR\242/\211\016\341\255g\005B\016d\005\302\007\333\254L\334$d"
+	.string	"\305M\302\376j Kig\236\320\201\255\230\"\207\256U\265\275\032\316\2253\260\037J}V\344\330|\024\321\005\002B\322j7\327\256\340\334\023\200%uL\302Z}7\177\346\323=r\004\002\016j\365}L@\330<\244\336]Gyw\177bZE\njY\317_\230\367\274\225{z\251\262\265\317\030sN%\020\214\322\272\340\374\264C#Q"
+	.string	"\315Ze@\016\354\373\017\207i\276\364\224\230\255\347D"
+	.string	"\242\320\251\262\245\325\346\257\021\362\241\241\221\232\223)\367d=\027bC\3770\b\210\227\306G\253\017\212\255gB;\3604\371\322*\017Z\273\202A\236\206~mz\314Z=\017\372\271\017\373aA2\256\201\376\n\203\362i\225\001q\240\263 \376\023T\266]5A\026\242\367\006G\"\213\205\224d["
+	.ascii	"\3302f\215\230z\r\tV\306(+c\023UQ\313D\222E\036\025it\021r\n"
+	.ascii	")9U\2642\026\025\255\214\301\032I\253\"\213%LNa\220bs\\!U$\222"
+	.ascii	"=VU\021\215\266\214YTjrJ\203\3211i\f>i\353\230D^Y\261,\246\n"
+	.ascii	"T\261E\253+,\242"
+	.string	"Q\025\213\324R\213YWI*\026itb\222Xu\234\2622JP:\022kP\251Sl\222\210e\274\301\272H\262H\226\205\225Q\001KE\3042\262,\216D\026k\204\200$\333\202\tyEB)\251\212=j5aee\211\230**\201d\262\201$\252`o\\%\213ZG\0017\330$r\253\305\200S%\257\212)\216Nuud\213\254\325z\013\030\"`\320\200\303(\371\032\t\236ed\217Q\311\254\254c\324\021rj\304Rr\212B\205d\361Jk\275\224\324\b\006/V\234X\251$\320\210\262\272\242Q\314\242\212*^\021oDQ\035\221Q\022\020 \331\243V\222\310\232\250b\261f\020\213\354\322\307\214\351\267Uyo\360^1\2773\265O\267u[\277\361u\336\013\355\220\026\347\357B\235P\177K\337o\037&\242k\231\264\332n\f\307M(Q%\323\301\33033\304\307\306u\352\0172`G\272]\006\315"
+	.string	"\026\232\353\265^\343:\225\3512\311\360\234Y:B\346\t$M3\337AX\332\314Vsbk\225J^\342\032H\237\030\242V\301\264L\243\245\035>7p\353Y\215H'Y\3133$\f\217\223\206\302E\016\253\375RJ\032\211\232_\013Ak)\215\205\247P\246\313\254#\364\327b\277T\243uYCy\n\355\220\326\307\245\323\372K\201\027\250\221@f\0204#2\"\"2\222$\3511\005\204(\t)4\017\021\260\035\243hF\222\024\024T\262\034\001(8\223\310teI\344\243$\311Q\215\353\007\264\234\266\251\360B\250\360"
+	.string	"\262y\333\372\332\374\026\020\b\275_\212\256\263\r\031\006Y.\307i\f\351\2739\252\275\252u\275`(c\311\346\304\243\337\244\365\316Ns\232\272f\312\226\031\376\025\25570\223\3301\251\316\212\246\266\377\006\2034*\003\025\036)`\021\020\220\307\363\266g\316\2468\tre\334\211\263C\234\340\033\331\215\001\035\367l\332W&\360sX\364\231\365\376\311\223\006\264xL\304\326\366\375M\007\036\0244\364\236\302\""
+	.ascii	"\2415l\373n\200\237J\002l\314[\373\326\260\247c\004\023\235\""
+	.ascii	"\003\021"
+	.ascii	"\352@\202\003,\247\264:=`\377(fs\227@C\322\036\3724\b\303\034"
+	.ascii	"\200\004\250\361\307<\347\340\255bo>o\260\276$8=\003\236\355"
+	.ascii	"\266\220#\031Ek\310A\31682\201\361\332-\315\267\230r2\261\322"
+	.ascii	"\263\"\020_\231\0019C\236\316-\271?:#Y\023\355\356\246\347\346"
+	.ascii	"\004B\2677\002\274\271?&\377FL\366+I4<\357a\343\344\274mq)?\007"
+	.ascii	"\nE\373\2709\347\250\356\\\374N\352\273\256\362\235r\3675y\336"
+	.ascii	"U\341\327q\207\216\273!/\265\372\306\255\n\007\205K\347\252E"
+	.ascii	"-Q\302\"\225\272\244h:/\231\334\315C:i\273\246\3535D\t\336h\r"
+	.ascii	"b \264\353\033\336\t\324\234\350X\201S0N\314K\244e\0015\250&"
+	.ascii	"\021[\370\215:\301`\030\305\317\034a\307Q\225\212\263\2774\b"
+	.ascii	"\033U\t\376W\372\337o\002\t>\307\277Q\320\"\177\316\r\002\232"
+	.ascii	"\021T\374\342\025\300\001\263/\210\254\267C9\305\274\241\364"
+	.ascii	"\r\370@aL\267\321\030\r\304R\363Jb\323d\377\203ooA\3464N\221"
+	.ascii	"O\215{\236\301s\205m\006\356\204yl\006P\236rB\330L\300\267\204"
+	.ascii	"3\221\374\0212\316\312\037\312\0130D\234\302\255\3435X\314x\026"
+	.ascii	"\257.\245\013Y\317\223)/\303U\001"
+	.text
+	.section	.gnu.lto_.symtab.1781eabc6436692c,"e",@progbits
+	.string	"featureInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"featureEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"featureDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"featureConfigSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"featureConfigClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1781eabc6436692c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,553 @@
+	.file	"accgyro_fake.c"
+	.section	.gnu.lto_.profile.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375 \367\035\005"
+	.string	"B\210\037*pU\323\030\200\2169\207\rb\317\357~v\326W\347\313\304X\352\302\270E\340\377\377\377\377\377\377\317a\321\2156m\332$I\2222\271[\357\325;\365\213\221L\203\005\026\240\2630,=\256O\353p]\032n\200\303\243\250\364\204\340+p0\017*\276\337\224\017\222\350>P\212\216~\312h\327\366\022J\270\312\025\355\356\356\345\260\241@\321\260\330\032\017\275\236\017`\206q\235\246\245\021\020\223\024d'\017"
+	.ascii	"G5\035\304\305B\032\320\bp\374N\t\3406\220\005\344\003\023\273"
+	.ascii	"\273P\265h%\365\335\r\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375 \307\205\002"
+	.string	"4\002\273"
+	.string	"\013"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\001\001\001\003\005"
+	.string	"\001"
+	.string	"\001\006\002\b\t\013\004\f\r\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\023"
+	.string	"I\t\001\354\326p\"G@Q\004\356\274"
+	.string	"w2\215qf\240\231e\355Tk\361$"
+	.ascii	"\354\245pV\031\2533\306.\230\r`\001"
+	.text
+	.section	.gnu.lto_.inline.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`P\001}\006"
+	.string	"\022\211\036)\200EI\007C\\\005\fx\260\200\001!\252`)\207\n\001W\030V\241\3375\0274\t\232"
+	.ascii	"\nk\r\221\366\377\326\310\336;\005;\257\310\304\312\260 \351"
+	.ascii	"\371\206\013\377\244l\341\333\240j\313f\313!\334G\023\264\376"
+	.ascii	"\237\226H\271D(v\363\213|\264efVF\023\303\004(\b\230\260\227"
+	.ascii	"P\200\222X\016\370\037\336\3671\222`\240\002A|\217\3157\332:"
+	.ascii	"\036\377\032\266m>\033\023\001! p\242RU\347\001\366,p\206.\030"
+	.ascii	"Y\2575\250\025o\036Y\3112\234\340E[\301\345\027[\2117EV`n\312"
+	.ascii	"\355\375\322aa\236e\306\212A\357\327mnb\367B\330\305\021\361"
+	.ascii	"\001\314\no</\261\314\210l3\241\325\205\2105\b\256c\024\305\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\r\006"
+	.string	"\242\211!,\200\265I\00730\003+{b\234\031(3\003 q\021\t\017\376 \314\232\261\037\024\214\211TU|Y\324\030\253}[\311\222\336m'\031\323$)\332p\225s\224\0230U\002N\345\n"
+	.string	"\034\212@\242\\d\321l\022\361\001\023\370\306\367\302\1772+\234\206\023\036\341+\352#i\026\243\265\003OXv\366\206\330C\f\177|\020\365\221\232\265\343E\301vI\345\366a^=\257\333\266\341\370\224\277\301\216\355c\231B\332\r\002\027"
+	.string	";\317\200g:h\0170\f\b\332\240\025\214E@a\346\245c\212\n\334@\336*\\\006<\277B&\260\r4\3468C\360\336 \007\200#]\t\0078F\232\237\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_.pureconst.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\232\004\003\232\004\005\230\005\006\230\004\b\230"
+	.ascii	"\005\t\230\004\013\232\004\f\232\004\r\232\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"-\006"
+	.string	"b\007\030!\220)\351\363\223\031\237\370n\336\377\353\273\273\273\233{F\337\200\377D\026\203\036\241\377\t\"\255\021)So4\312\216F\321\253\360\"|\274\366\361H\306\270\0052E\277\257\227\350\002\250pp\233\245<\260byb\030\311J\223\325\242\207\030\3249\375)\237N9\242J\tl\316\017\345O{\333\233\031\t0 \320\202\021\023\362\0014M\244\035\324d\227\2601D\201s"
+	.ascii	"B\367qq,4\bk!\305\355\2030A\004}\350\313\216\364.\324\260q\341"
+	.ascii	"\336\020\233\201F\323\241o\354\336\201\204\334\207\377\302>\b"
+	.ascii	".z\304\221\017;1\342\220\035\354\275\360\030\274\301\332\005"
+	.ascii	"\007{\326(t\230\275\256\034\366\255\201\256hj\b"
+	.text
+	.section	.gnu.lto_.lto.f1084c8a7531cb84,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.24.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"U\f"
+	.string	"v\027UC\020\221\223\0168\221\354tx\201B P\224~\020C\211\032\200\270\235\3576+\210\\n0\005\001\350\023\264\025s\006F\205\005\\\376\311\244\001"
+	.string	"\020A\245d7"
+	.string	"\332/\261"
+	.string	"D6\275\364\215T\262\267\224)\005A"
+	.string	">"
+	.string	"C"
+	.string	"\004\246Ckv\214w)\253\240E\211K\314\356V\n\342\332\237\246\346\277\345\232\310m\177T\207\353\363\224V\314\b\300\221\274\216I\210\370\226\347\006n$\023"
+	.string	"\203\335uF\216\303\ro\273\201\355\005\366\035\004\036Dr\306\356\266T\024\373ow\327J\262\317\362?Mg\246\257\231P\362\322\221\261k2Sc]@\026\"6\266\237\366G|E;\313\350\003vI*`v\273\217\023P\207\356\336\231\016\251\007\n\301\004\f\222\2241'\375\320t\265;<\3621\265\200\006\335\354\243\310\300\2116v\027\013\324\356\"8\361!2\360Be4\035^\365\344%\236<\365I\274\304\310W1\006\220|<\364A\246\303L\021\363a%X\026\302\361lm\\\035 \t\017\260,\204\303\262@\225(\273>BY\204\212B\b\344QY\231\250\332\360\030\253pe\325\005\f\313\252M\267\177\253$\177:\032%\021\035y\002\322\266\256|\264\352\366\024\231\022\214*\212\017<\003\024"
+	.string	"_\2417\023z\3051\260\n\203"
+	.ascii	"73\027\320\373\017\323\374\270\365xJ\212\t}\276`G\305\264Q\201"
+	.ascii	"\024\214\272\204\325\254F\207\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeGyroSet.25.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\005\002\315\020"
+	.string	"\206\235jH\340\224(\035\350\302\325\252\001\323\264"
+	.string	".-\033*&c\244P\004\353\341ral\322\""
+	.string	"e\2309\304\340\3057\204E\233\216\352\343\240\026~Ed&\207\020c\214\3610\201\204\t\315\322\035 \030i\310\031\345\325,w\334;\245P"
+	.string	"S"
+	.string	"V"
+	.string	"uw\206\247\266\273%?\b\275\226\314O\3736\217\215\227\265\\\300.M\254\266K\226\354 \364j\362\006\270\327\320\tp\257\036\355\333\201\017\243\033\210\030Ev\327\243)>~\216\376g\007\360\202q\371\004\235\354\256\347\013\246\304Mo[\201\355\224=U\001kJcs\323\242\347\374\240\343\374\3657?\275\354\237\001(\234\030\362C\b\rB\356\210\037#\353\243\332ha\373\376\214\323R\256\343\321\214LL\212\335\311x\251r\035W\233\232\335\355^m\025\273{\235\235\235\303\232%\373\342\n\001\001\347vB\311\303\030\177\303r>\224\332&\035\007\253\200\212\335m\340\337\370\016\352\003\347_ \367\372\331\007"
+	.string	"\261\311\304bFSD\3752\2052\377r\202\027\352\342\227\257\261\232\266\327K\253^\013\021\330v\227\001\r\226\r>\213\026\356UD_\336dE\017lV\232h\315\037\233tM\212\302>\311\356\006\306`Z\300\362\225{8\211?\023\210\202\262p\n\305\225\013\337\207\362V\"\330!%V\3602\244P*\357\023W\236\311\304\241\006P\3648\204\241\350ud\353\263G\200\221\360\351iQ\027M\302i\027\225GD\300z~\342\354\t\357q\n\215J/j\210\200(\317y\354\360\016\367J\222\271\250\245\353\310A\212\005/ \220\002\2319\263\003Y\334 \205\363==!\340\f#%\354t@$\236\272\235%\004\253\004\\\177\247\254\205"
+	.string	"F>5,\222\235\214\243\300\0015\343\232\265\034\261h\313\021G\260*\243\r\214\037\264\030\343$T\037\345?\241\007;F \304 \345\206c"
+	.ascii	"F\343x\307\206\035\230R\302\0070,!\004\314\030\274\"\355L\t<"
+	.ascii	"\274h;\031"
+	.text
+	.section	.gnu.lto_fakeGyroRead.26.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\032\003\225\024"
+	.string	"f\343~I\300\224Q:\344dw\204\233\213\307\022\307\356\270\336\366\034\244\316\247\003c?wD\245\222\037\326\0238O\257_\346\366o\303\317"
+	.string	"\320\366|\005\265\247?\361)\036\266\013\246\241\177\203\t-\023\037\212\214q\377\016\003{\310&R\246\024h"
+	.string	"d"
+	.string	"m"
+	.string	"V\265\237\373\020\317\211v\2562\247\020p\307\234\272\0267P]Z\367\025\361Ru\001\342\245m+x\341q\354\272\024?\001f>\035jH\315\251\033\027\305c\227\341j\314\357\271|\241\364\0137*G\320\023\322M\3047d\3015\205X\335h\341\212/\350\310\213\256\037n3U"
+	.ascii	"0sNk\355\006\342\026o[\202\355\226\275\020\002H/\003\3009\347"
+	.ascii	"\202\0337\032\374\025;\342e\312~w\3551\375<!\215\220i\320\326"
+	.ascii	"\315tO\330\017\347\n\331\242:\345D\277\312j)\325\241T\257T_\345"
+	.ascii	"\005H*\212\300\323\234?\301"
+	.string	"&\323I\366\\\330\276o\343\273\034\033\214\034\373\250\200-\367\0317\322\271\316\322\003\020.7\347\\\351\330\253\313\265y\354\225\035:jHd\032L\360\0361\f|\245/\311\3303,}\215%^\352>\260A\341\206z\347\275\207\002da\003\342rJd\032T\036K|&\302\243\326\217\036\201)\311\024\024m{\336\242\206sZ\307\304/\005\032Fh\312\304\266\353I1\225j\316\371}\321\265\204-\006n\210\bES\326\337\321\324\350k>@\333\036\177w\0348\372\332w\266y\306\340\202 t\313\305U\303\2620\363\202\351\\h\265X#\016\314\305\201\006Va\274\241a\331\214-\030\316\350\302\342W\006\027l\334\360z\301\306\225N\366p\256\220\305\237\212\035/|\321\035\374H\354x{\336\345\372\330\226k\030\331\316\244\221Q\270E\210\334\367\337\020\275\227\304\023\037O\306\256\220 -o\002\262{\342K\232\352\351\376\210\031"
+	.ascii	"\364\204\373\220QmA\250Q<\347\234afFd\024\024\024D\031\016\200"
+	.ascii	"\002\231\271\253\007\021\320\251R3V\211\375\357\006S\n4\r}\377"
+	.ascii	"\243\366\275\317\033h\331\323(r\236Y\036&\312\371\316\241\017"
+	.ascii	"O3\231+\225\366\211\315\025%\250\315\334oT\227'\tR\352\017j\200"
+	.ascii	"-M\200j\3459\260\366\270=\357\260$^\256\330-\370\232!9\3217\320"
+	.ascii	"\002\030g{q\267\201R,\200\270\037VzMN/\362\327\266\354S\205\310"
+	.ascii	"\313fc>\350Y/\002N\316;;TsO\232K\321w\324"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.27.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"\r\b"
+	.string	"2\31777@s\322\001\033\262w\335\337\257f?\3568\355j)<m\341\260\002\210\2736\004\374U&\267HS\365\263\223K\026\302\345A$\016\217\036\355F\314\223q\263\204\220\275S\nR\223\021\223fh\222NQhj\001\225\261\317\274\220\025\023\031%Y`\230\214#:5@\224\"b\200d(bt\024?\t\316D\223F-\313ht\335W\013;\237\273\f8\240\311\256\245\007E\354W\273\273\206\235\375\032>R6\0055\273\247\234\233\235\261`Llo6\200mXI8\017\357\331O\271\312\366\225\215\013\354v2/\273U\301\016\236[\256'\270ny>p\335\262\355\005\206\315\334+\311\251c*\351hI\355\326\bG\316\375q\376Y~p\022\023B\343\202*\375u v\327\317\003\005r\303\333F\260-a\033%\f"
+	.string	"8\303\361\212\036\025Ql&FV\301\3235ob\002\007\205\34020\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.28.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"-\013"
+	.string	"\266\024NC m\225\016$<\n\202\214\223\205\020\312B\206i\316\314\203\017f'\314\255\233\210\353\220\251\302\237 \214u\271=\336!\307\252\333\b\222&\026\001!\236\274\351\3562\255\256-&\020\206\326\336\3455\313\215\310N)8"
+	.string	"7"
+	.string	"@"
+	.string	"\3433\266S\3121\266S\333\006\t\0219\374\230*}\202\206\007,rw\344\264\n\017?C\377\253[0\2340\021k\231F\237\223"
+	.string	"\273\353I2A\270\265\333\356\260=b_\023\263\264\307\321\324(\330\227\354\356ZC\331W\375s\202y\221)6b\273\245r\305\276\350\210\013\266Ev\305\366\234\3667\234\203\350\252\320/vQ+\021\273\343\2071\224S\007\244\203]\321bg\036\302.j\202\221d\347q\310\276\203\330\324S\311\351x\316\002\005\234T\220\016|4R\273\342Iv\202{X@\331]\021\277\003\003\220\205\314\302\251\037\332N\251\204\022\037b\255\bb`\005m$\366._\247\033\220\001+h\343y\035\367\251\237\002N\325p\0058\235\207\363\352\207\273x\0304\360U\016\001\bV\2562\356\355?\334\bd 1C!j\rl\327g/\330\256\001\224e\021"
+	.ascii	"_\241'3 \f\033\267\020\243\346\002 \037\270\031d\004\244\001"
+	.ascii	"2\006\005y*\221\257\31682A\3045\032\262C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.31.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"e\f"
+	.string	"\246\227UB\020\221\232\0168\221\314\223\203"
+	.string	"\036"
+	.string	"\277\240\256\254\031c\\5l\217v\343\003R\214\333\f\354\361\210\337H\373&4\230W\037\221~OH"
+	.string	" B\021\266\222\n!\177\245 @"
+	.string	"Qd4jK\366\2262\245B"
+	.string	"?"
+	.string	"E"
+	.string	"\002\244Ckv\215s\242\335\220\220\361"
+	.string	"3\263\273\224\226\270\366\247\251\371\177yG\004m\177S\210\353\023\351`\334"
+	.string	"\001\251\274\220\217\211\370\227\347\007PJ\346\306\301\356:#\b\304\ro\373\201m\006\366!\004#P\262\306\346\266T\026\373ow\327\032\262\357\362?Mg\246\337\321\240\233\2611\300\305\356\247&\307\312\2001Nx\330~\332G\361\221v\027\317\003\354\206^\304\354r\b\274`:4\367\020\351pz*a\005\r\225\244\361G\372\034\351j\223\224\344c*\201\016\272\331o\301\341cF\264\261\303`\230vW\001\013\223N\001Q\213G:\274&X\221\211\"\236\372)\256\302\343\267X\303I>\036\372'\322\241\201Ohe\024\226U\251\255\221\213\244\242\020\001\3136T\260\254\212\352d\227\t'\233@Y\340T%\224\225u\250\021\021c\027\256\214\312\200a\031\345\301\355\337j\310o\324\341\350P4\345\001H\333\272\362\321\252\333E4]\214*\213\017<\003\024"
+	.ascii	"_\2417\023\232\3051\262\n\206\02073\027\320\373\017\323\034\270"
+	.ascii	"-<\227\306\354\213\276\025G\255\267Q\353\031`\271X\333\254\246"
+	.ascii	"\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_fakeAccSet.32.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\013\002\235\020"
+	.string	"\026\335hH\320\024q:\350:\257\nAE\335\036\332\026 |\260R\207\021e\013\206\\\021\024=\222\034\206K\267\351 \245\002\215\024\232\301 \006\016\r\033\203\035%\241\304\223\\-z\330m3\352\207\021\024\361R#\2704\354\177{\355\235RO"
+	.string	"R"
+	.string	"V"
+	.string	";\262\335%\031B\350u\300\374\264\037\3434\342k\\N`w\006\206l\227$\371A\350\325\344\rh\257\241\027\320^-\332CN\262\3662f!f\370\354.GQ\\\374\024\375\303\036`\224y\371\004I\330]\317Qf\304Mo;\201\355\022{\242\004"
+	.string	"vwMglmZ\364\233\037\364\327_\357\372\351k\376)`\264b\2452A\204\002!7\346\247\310\376\2507T\330\276_\343\261\224\343x\324Z\251R\354\215\306K\225\343\270\202\221\355\325V\261\267\327\271\3317G&\274\204D\240\344m\304\273Z\\wK\004\244\353\330\2516?.(\265\315\3409ZF\016|\034\327\351\274o~\374\264\327\303>[1=+\032\025\311\024Q\277<\231\314\217F"
+	.string	"\202\276\370\345sP3\310\370\322'\227\201\007X\273\333\300\006K\007\277\345\242\275\212\350\313\237\305\242EI\"5\177l\022f\322\023\366\003.))`\371\312?\334\363:j\257\364\231t\031L`\270\242\301\363:\016\025~\036N!\006n\303\251;\341\274\020\305\225\026\030\344\360\205\034\n\b\206\334F\246\016;\205\034r\306\223\24201\013\217]T\276\020\221\202\347&\315\276p\037\246\020Iu\275|z@t\307{\360\230\267\2166\253\0011 \240\002\031\271\363\261\270\360\031\"Bh>\262T"
+	.ascii	"\252\200\234\370J;\317\013f\035\260\355\216\227\005\202M\207"
+	.ascii	"c\270$;\031\267.\2650NlG\343\272H\222\027T%\030\353\321\bB\365"
+	.ascii	"h\214t\022\252\215\342\307\320\204\035#\020b\220rc1\300Qv\217"
+	.ascii	"\304\361\216\346\032\314 \310\033f\300\221\204\2700c\374\212"
+	.ascii	"41\005\336\345EK\311"
+	.text
+	.section	.gnu.lto_fakeAccRead.33.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\027\003u\024"
+	.string	"&\244\200I\300\322Q:P!\020pT\020\346"
+	.string	"\227\271a\272\017\347\2642\314\207\371\357\204<Pb\347G\006'hw\260\216\345\353\321\3549\255Q\r\231\326'\022\031\326\207\313u\335\234|\236}\310|8y\273\322\004\340"
+	.string	"R\311&R\246\024i"
+	.string	"f"
+	.string	"o"
+	.string	"*\333\252\366\203.\204\363\241\233\233\314\t\324;\232s\227b\006\343\245w?\021/\307\003\020/m\033A\002\034\307\276\303\361\210p\330\351\300bj\316\335jI<v\031\256\306\374\234K\024K?\341F\275x\332\321\253\371|C\224\033\223MU\233\205'N?=\256\273\356\324tTEV\346\234VZ\255\347\026o[\202\355\027{\037\004\264\363,\363\336k"
+	.ascii	"n\316\251\240\305L\006?w#^\226\354y\327\237\021\217\214\336\007"
+	.ascii	"\231\006\355\235\216\356\b\373\341\\ [T\227|\350\037\255\226"
+	.ascii	"R\035J\365J\365M\"\034M\3750\020\234\223'8d6"
+	.string	"\311\237\t\333\367\215\316\253\2615\325\330E\002lPWq\"\233\357,}r\267\2409\247\312\306V]\256\215c\007@Z\224L\203\007\276\3042\3169\027\370IWj\261]Xz\032K\274\324u`\033r\023\372\335\367\037\tN\367\221\023\267\034\020\231\0065\206\224\223\210\260\250\365\242C@B\222\3621\333\234\227\240\335\232\3261\361\373\262\202\307L\205\330v\035Fl\034s\227\337\353\256!l9nBC$Z\262>\017&FO3\201\331\346\370\274\273\240Q\2509\347\003\276\240R\240\325b\255[*\256\030V\005\227\027\314\306B\253\305Z\321\300\\\033``\024V30,\231U\013F\263RA\361\013\203\013\266\322\360z\301V\252\235\354\341\\ \213\300\034\317\027^\367\006@\020<\337\336w\271\036l\313\365\212lu$\021Q\270:\200w\372\023\016\275\225\304\3130\310\356\r\033)g\252\261;\322\223\224\342\247K\203%"
+	.string	"\316\023>\243e\324= \220\002\031\271\253\007R\334\377L/JB\3473\020\3162\f\031m\311\\2\273\323n\324!0\356\220A\301\327Lx\214}K\233_\311\270\215\001\276_\304T\031\236\013\221t\253\201\001`\025#b^#o\301z\323r\207u\335D\334\376\020R\353"
+	.ascii	"J,\326\374\244,\216\313\351\210\345\260&\307N\255\016\n\323\275"
+	.ascii	"\301\234\266\302\236h\213\f\\D>\304\002\336\356!_@\306\266\b"
+	.ascii	"q<\347\021\316pq`\234\364\204\242\366@\001"
+	.text
+	.section	.gnu.lto_fakeAccDetect.34.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\025\n"
+	.string	"f\323G>\020\005+\035"
+	.string	"p/\265\200m\037\243\302\212\316\013\033\342\320\250"
+	.string	"\351S\033\200\n\335\005\235\216\020\306U\332\347\f\030t\331&I\030*\212"
+	.string	"P\270\364\234\340\210}"
+	.string	"\200\020\334\320\341Fd\247\0244"
+	.string	"2"
+	.string	":"
+	.string	"\265\363\202\357\325\266\031\032N6\177\302V\177\305Bh\272\335\023\364Hn\236\232\376Snp\0223\222\263\261P\247\001\021\273k\252b\265n\357\266\021lC\330?\b\273k\317e\177\366\323o\342\246\253Qh\331]\355\002\254Lu\211\331\276\355\223-`\233R\373(\227\235>3\235`\327%\273\355\236\013~\350\274\372\274\347{\036_\003U\033\030\335MH4:\215\224(\301\2514H\236\231\335\324U6\307W<:\273\353\340\253|\224\006`&\257\276\351{\255\255\027\226\234M$Ew\366\211\242\336\313>g\003\242\030z\026?\243(\264\240 \313\022H\024C\220T\216\035\241\262\002\304\b\205#P,I\340'\301d\306X\202\033$Y\202>\367\234\365\\\276\371]\340j"
+	.string	"hR\036\210}\320\347\f"
+	.ascii	"^\321\033[\024\204\305\2004A\003\251\301\305\240 O%\362\325\031"
+	.ascii	"G&\210\336e\342\353\232O"
+	.text
+	.section	.gnu.lto_fakeGyroInit.part.0.45.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\255\n"
+	.string	"&\023F<\020%)\035"
+	.string	"#\020 \002\026\005\033\005D\327\202d@\020/|\017\300\242$\035rd\261\3557\2745\023\317\006\223 Q\004\001"
+	.string	"\244\bk\001\244\251\245*!\307~\266\306j7\331;\2452"
+	.string	"2"
+	.string	"7"
+	.string	"\266U)\026m\237\2170+\301s\"\373\331\335\356t\276\\\374\224\232\350?v\001Vk\3659\320R\271\024]\013\240\330]o+7\275\355\007\333\026\366E\001\207\335\376\214\312\2179d\3730\325\307\024\267ba8\265\224\366i^#~L\275`\327u\203\263;:\234:b;\365\370\003\320\351v\003\320i\350\3642\001tg62I\346|\331\336\244o\363a7\\f2\304)\310f2\241pj\213\240\344Y\006uf%s%\347\313S\273\266\323eO\331C\320\262\213\022"
+	.string	"\300\272\320\234\230N\250a\255 W\372\302\r\216\003O\036X+\0204\177#\260\344e\\\204\025\245\361}^g\252`\b\251bt\035$\217\243\373\252\251\033-8\364"
+	.string	"kw\n\303\332\311k;]\016\030"
+	.ascii	"/\301q\206\343\025\275\212\005\321X\201q\301hEi\236\301\001\242"
+	.ascii	"`\230+\234\253\tQ\027\325\347A`\342=\255\024\325N\347\2026]t"
+	.ascii	".0N\\\314;-M?\241\214\001"
+	.text
+	.section	.gnu.lto_fakeAccInit.part.0.46.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\365\n"
+	.string	"\246\223IB \347(\035\220\b\026\023\310\366\224\2003K\360\344\264\246{\002\210\021\350j\207!\001\354\271\rj\214\206m]X\277ih\354\211 7L\220\204\205M\346\262)\234\003*Hh\260\240\220\206\262\331M\366N)4"
+	.string	"4"
+	.string	":"
+	.string	"\005l\237j\f\332\017\036\016XO"
+	.string	"\330\314+\302\356r\237R\300\301\313\230\201\376]WH\251P\227\013*\233\307\207g\236\217\335\265vs\317\333\336\260-b?\"\263\001\201\267n\337\300\311w\371c\373\255\323C\323\206\302\301\370t\214\366\017\034\001\370\320t\207\335\325\002\006\273\241\306\247;\264O\207\227\350|j\207\350|~>\037+W\016\201\305^$\214\224,\333Z\364\023\254\330\031\177\215\314\361\311\242\311xX|\332.\245\370\224\031\0248\210\305HT\224,\313\354\331\312\225-+ 4\344\354\322L\220\260"
+	.string	"\002\246\250_\255\336&\242\337\311Fi\267y\244\316\253 \023\224v\322\024\344\211\272\222\221\257\226L(\355\270Q\365ZB\225\204K\tu(\034\255#\016t\341O\305\253\034\351\373*\027\237\005\026"
+	.ascii	"^\321\263X\020\216\025\030\027\314V\224\3003<@\024\fs\205\203"
+	.ascii	"5!\352\242\372<\bL\274\247\225\242\332\351\\\320\246\313\316"
+	.ascii	"\005\200\223\027\363NK\323O(c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`T\001\335\007"
+	.string	"\324\nP\002"
+	.string	""
+	.string	""
+	.string	"\002\033\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\032\177 \005\026!\200\204\001"
+	.string	""
+	.string	"\003\002!\177\"\005\035#-\177$\271\200\202\202\200 \030\177%\027&\201"
+	.string	"\002.\177'\037\177(\036)\031\177*\272\200\202\034\177+ \177,\"\177-\001$\177.\377\037"
+	.string	""
+	.string	"\200\200\200\001#\177/&\1770%\1771\003\001\020D\003\001\017\340\236\212\256\001\001\244\001\003\001\017\241\341\365\321\002\001\244\007\003\003\003\003\005\021$\003\006\022d\003\006\005\320\360\372\250\001\001\242\001\003\b\t\t\b\013\020D\003\013\017\344\001\003\r\r"
+	.ascii	"%  \003\t\212\352(\002\0272\210\201\025\244\302\n\024\325\034"
+	.ascii	"\304@\233i\213F\224\261fpk7\3209!\233\2754(\t\306\354\241\035"
+	.ascii	"\276o\302\202\033\365\327x\306\f\277\016\020\006N\013\206j\214"
+	.ascii	"\330\2223L\262\001\240\374\351\240\203\352\004"
+	.text
+	.section	.gnu.lto_.refs.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375 a\335\001"
+	.string	"\022\306\r\020\260%\351\f\303\260R\326ZB0idK\231R\252\311\211\004R\314\316\354\346\300\234R\313\005\001\246\320\216v\272\314\207\311>\026\266\214\222\3211n\026)\221\016\371\324A"
+	.text
+	.section	.gnu.lto_.decls.f1084c8a7531cb84,"e",@progbits
+	.string	"(\265/\375`k.\315\306"
+	.string	"\3325\001EV \nIK\035S\021\323\217\235D\203of \314\334\327\355\201\267\0051\023\215\27378\220\3564\201\032\204~SB\365\026M\216\331j*\331`\212\205lw\200\003\245h+5H\333VK\233s\tE[{\3473\246\252\264QU\335\236s1[\202\274\253\264\275\224I\246\336\0037\004J\004\017\366>\262\276\353\312)E\367Q\214\220&\273#U\260\347\361X\024\370<C0\202G\325Ep\030\271\201\325\345\317\005\003\244\326\343\211\326oYh\241$gdJk\371%\272\372\211\243\241\375N]\357{\370^\316\221\304\005\330gg\211\241\235\005I;K\221v\021_\3657^\307\225C+\261d\217\272\367\246z\253;\375\252\337Qu\345\224\030"
+	.ascii	"'\205\032S\325\303\013l\315\316\342\243\363\226\363L\311\347"
+	.ascii	"x\034\033\006f\217\251\r\013P{\356\323\236\367\264\273\177\324"
+	.ascii	"\333\270\323\227\372\032\376.\376\205\327D\367\236\212p\307\221"
+	.ascii	"\372\246\207\242\300\347ibF\225\373\025B\203\227z\032\267-\206"
+	.ascii	"\031\335E.UVvGj8p\020\326 \"\206c\315\236\313\264\373C\375\023"
+	.ascii	"\206\361L\263\022eySr\262\343\363\364\235~\311]\242\250\260\367"
+	.ascii	"\276\264g,\3559\207\366\374\244=\273\370\0302gOa\\B\017#;\365"
+	.ascii	"\3357\303:\223\267\2765Q\\E;\346\323.wiV\"W{&|3\252P\264\220"
+	.ascii	"\373\257\270d\037\364/kVV\270\370\374\317\007\272So{\025Z\234"
+	.ascii	"\321-\2757\336\2307\232h\025Bo[\035\017\321/\357t\177\346]\373"
+	.ascii	"}\233\366v\356\275'\020\036\031\031#\362\371\006\342\370\373"
+	.ascii	"8\315\nU\212n4\274\346\266\302J\231^\257\\"
+	.string	"\301;\265\271\203~\003\257\022giFwt\357-s\373\246|\214\274\264\b\366\2766\353\035\034\2746\253\343*\375\233z3\254Tjd\220\230\316\236\237\035\307\320.\002\357\356\3411\250\016\"\225\203\272wt\312\375\273\323\353w\245x\216\356\355\367\314\035\347\372]\352]\001\217A\267S\n\t\001?S^\300\250\356\035\345P\303\001&H5\320\305\232\371n\237L\320\016\0269\326\370~h\177\253\274\253\367G?p|\215\274g\322\376*<\271w\227\356\257\nP\340\023\276\353$:\004\311\034\035\335\233\276\320\233\246\375\212i\277<\364\f\r]s\213\364\221\354BI\024\325g\277,\264\247\240o\210\334\"wZ\3015\202\231d20\202]\202\201\237\335\003\332o\005\353\035\274\025\254\236\001\r\342fX\357\020\0319*\267!\237=\004}\201\334 wz\323\334\257\331=\363L\326\264\245{Gap\323\205\022\265\317~\205\370"
+	.string	"\346\266\006\236A\373\275Ye\356\315\352Zk\270\031\326|i\326o\272\031\326\013.\315z\233\344n\206\365z\335\257+\206\237BM\033m\357\350\005\241\227\033\024\332\347+\3667\354F\375\212]0\017\241\201\2778\367\327\336\321+\226\367n\336kA\314\275\026\260\264\355h\226\255\331_{\364fX\365\245Yg\376\216\356\317\356\026\367\314\001\367+\305\375\2420\002\367k'\002\367\313\027\343\236_\270\337\272\rzQ\374@ \001\275\rQ\374B\340\376 \370Cr\377\021)D\371;\301\375v\275\n\367\333\003\005\367K\225\302\375^=\340\202{\376\261\311\356Y\204\373\345\3415.\201{^\200\373c=\006\226\257t\177\244\323\270g\246\373w\350q\377\235\243\373\325\341~\227\274\004\3677\372\214{\326\200\373\363\270\177\007\334\177\003\356\237\001\367\227\200\373\233p\377\007\270?\007\356\257"
+	.string	"\367\327\300\375\023\340\376 \334\037\003\367\367\340\376\033\334\337"
+	.string	"\356?"
+	.ascii	"\367\257\300\375m\334o\022\367\333\304\335+\340~;\340~Q\270_"
+	.ascii	"\036\367\353\347~\261\273\207\271\3371w\037t\377\031\367\177"
+	.ascii	"q\177\354\376\327\375\337\375f\300\375\n\272\337+\356\327\212"
+	.ascii	"\273S\300\375\006\272\337*\356\027\320\375V\335/\025\367\373"
+	.ascii	"\347~\245\356\267\314\375\222\271{\324\335C\270{\234\273\277"
+	.ascii	"\f\016\016\016\272c.w\241\022\367\002\230\005\3562\245\375"
+	.string	"nX\361\340\340\335\260\272\213\223v\227\030\332\327\\\214\264\2738\265\337Y\240\242\035\003\271m\035\330;z\001\016J\343s\b\034\307h+\227\021'@\252\366*\376\341N\246#U\251\215p\213\215\206\r\\\346\230,\246\232$U\373\214\307\\~\276\232tv\332/\031\213\027\302cP\020\240\300\212\240O\264u\245\005\275\302:\260\026\356\302^x\013\203a.\234\205q\340/|\003[\341\0368\212\251\260\030\366\201\247p\016\214\205\2530\017\274\343Nq\330\3039\236\201ix\215\222%l\321&v\027J\327\031\\\027\237\026\264Z\364F\256\3663\206\301\226\223\333\333Er\006u\204\252\001\223+\206\243VB3\250)5.\311\314\366\241\033b\265\306v\3332\360*\303aW\356\212]9\245\315\344\273\240\353\352\353\355\233\024\321U\341\260o\276\023G\327@\200\n\273\203\362{P\030d\261iA\253da\270\tKm\244\013\274"
+	.ascii	"\303\256\225\3378\272\246Y@\211\271\315\375\023\":*\352\017\016"
+	.ascii	"\373\241'\302c\320\017\350\276\302\236\0173e\220u\245\005\255"
+	.ascii	"\3362\264\253\326<\002\341\345\244\005\255\376\331\267\221X\001"
+	.ascii	"m\t\242\343\302aw\356\326\321\005\021\021v\243\334*\036\203\266"
+	.ascii	"\020\225\241Q\377\310q\330\267x\263}t\301\226\221\026\264Z\223"
+	.ascii	"\261\220\222\234\204\3106\260~\304\260t\350\032w\212\243\260"
+	.ascii	"\223g\034\205\2370\324\225C\333\333\b\203.#\036D\252WF\234\017"
+	.ascii	"\223\2341\224\373\225\336\037O\324\262\006\345(\353\263[(\322"
+	.ascii	"\336\022\250\275%O\303\354\265K\263\342%\033\231\032R\315"
+	.string	"\272\317\336\222D\367= \216Z}\340CDU\30220\214;\3051\2348\306W\301D$V@-\3403D\215\201_x\022\n|\236\273\351\004\342\n0\007\217l6\205\204\206\316\336\342\244\375\256\255\260\271rS\034\360\020r\026\324E\305D\037\210\177(\360yN\340\310\224\372\364\266\230\226\275\237\320\254\276T\360A%\003\272Y\373\302DX\310\333b\2343\333I\305EuL\204Y\330\3044\243\033\272\336\270!\365\225\204]\340\"\214\204\215\360\021n\201\241w\212\211\360\020\207\032\026\263\037\325@\f\331u\022\355\272M\273N\323\256\177h\327_\332u\226v\275C\273\206\302\316)S\312\\\321g\327G\230\211\233w\212}\376\312[\371\301\032zV\330\007\357\037\304\240w'H\255\342!xS~\260\r\n\272\b\2021\t\n\376\225\230\260*\241\032\237]\330\245]\310C\2730\207va\r\355\017\350\376R\236\372\325\016\260"
+	.string	"\001\212c\361\371\377\236\212\177\365\375\366W3h\332\273\371U\031+{7e\356\265\340^\013\262\017\250\252 kv!\r\375+\340\370O\371\231\022:\372\274A\250\244]\210\244\377\346\322\254y\257\207\207\314\332s\272\222\207\207qP\241XE\361\307c\342\ty\362\2475\\\232\265\356\355\234\264d\265"
+	.ascii	"\222'W\347\244\305\356k\310\037\235\277\023\3547\303\306\216"
+	.ascii	"$WL\251\205\032\222\227[\202\025\270\302\232\230f\362K\234\200"
+	.ascii	"dK\224\370/\271b\327k\217\216\312\347G\362I\264U\021\363'I\234"
+	.ascii	"\314\2218\301\030\237\343\036n\365!\305\007\232\245\335\357\217"
+	.ascii	"\264\360\3251\231:\262\243\256\206x}\366UJ\203\2704\253\220\032"
+	.ascii	"|\346\354\372\\\344N\337\310\243\241\031y O\004\310"
+	.ascii	"Z\037\327\313\006\002d\313D\330.\021\021\365\371\371\327Z\222"
+	.ascii	"$\265@R\035r\247\257\346{/{\177\355\275)\270q\352q\364\331\375"
+	.ascii	">\355\245\352\244T\3714\377)t\237\301\370,D\270g4Gf\247\203<"
+	.ascii	"\232S\323\211\021\235v\0266\355,\323\037\217\007\366\302,\252"
+	.ascii	"\311\276\354N_\372K\376H\237\3445Q\351+\275\f#!\024\252\364\231"
+	.ascii	">z\345\224f\266s\357\n\225\003\207k\346&\330\267\346\253\007"
+	.ascii	"\313\263\022\373\260\037\273\323\217\372G\177\306K\3050/\354"
+	.ascii	"m\303\212U\364\247\276*\306\031\335G\253\224\2759\330p\340\340"
+	.ascii	"\"\024\305\304\324\331\353\277\3564?\264\307X\t\021\222\243\332"
+	.ascii	"\370b\204`\374A=I\245\031H\215\230\321\235\212Z\nB\363\fd\rb"
+	.string	"\352[\373\234\3172\024\214\224\242\026J>g\263\037/\310\3102\223\004[W0YV\002\347>{\314S{y\345\250\3367\255\211\322\r\213\232\325\024\r1\317\321i\023n\353s\016\313/\\\212\352\354\252>g0,m\241\204\351s\376\372=\306\004\206\327o\253):\230V\272\2720\225\025\332\262\202N\t\213\033\324\021$>\036Y\213G\336\332\352\341=r\326\335\320\275\371\260<ge&U\0217\230:\3550D\254\246\331\n\227\341g\b\\p\324\r=\202\200\226\034yoQ\314n\344\03572\325\272\367\2156\025A\335\3173\025\313\034\026U\220\3178pd\035\232\271\2670\307X\016\317:,(\r\231\201\301ti\207\211\222\222z\347\315\336G\032\274\306`89\345(\266&5<G}\020\322\236\222\241\310\206\004\247d\250\374t\357\250\200S~yqu0C\332=\323\270\323L\343\235\037\335L\013AF\320\215"
+	.string	"\207a\312\220\221\231V\320pu\005]\362\3144\200\251\213%\371\205F\212\306H\232\242=\037e$\317I\236\2232\214\013\"k\314\216Gu+%\335\270g%\3170\206\374p\302\342sn\341-\031P\017+\356sv\201\321\242lO<\206\233`\311x\373\374r\245\335\337}\335M\350\336\373\210%\272\241>/\253\373\365\313r\357\215;\314\305\227"
+	.string	"\276\335I\354\354\355c\3264E\367Pk\312x\r\333Y\344\366v>19x2r>\275xJ\2376\323I\305\274"
+	.string	"\335O\314\247t\357\013\333\351d\226h\332\027\236\322m\264\177\346\214\356\216>1\267\263i_\330\316\335\324\360t>\031=\245M\243\013O\351\223\321\226>\355\231\355lB\201\234\033zaK\237\370\266\264\311h\346)m2zJ\237\270\356\024\320\\\037\322\217&)\240;\366tn\242\241\245&tF\356\031m\332w{_\264\025\033J\200\275\227\232\240w\315\027w\315G\216\310g\332l\272\321!\037\250\246\355\224{b5\355\215\345\243\263\2072`F\345\366\215+\307\254\261\264\205V\354\035\200\241\275\231w\313\355\275\231{o!t)\272w\214\231\247\325\320\320\336J5C{\211\311\266b\357G\213\262f\364\224B5\341\260\231I\2556\213(\363>\205\232\266\325\276{\202j)sl\013\255\240\255\214\220\372>{6r\317;Cs\363D\032\220\347\347\313E\204\343\271\bfJ\207\226\332g"
+	.string	"\f\t\255in5\242>\347\240\250\364\3561\005\266U5~!D\205\374\274\323\f\024\315@\337\227Y\3040\243\333h\005\272\361\022d\006\013\026k\366\314B:d\n\007\365s\376\301\361\274\202\0019j\370\370\214\26337\275\222l\350\370\354\331'7\363\225+B\332\242_-l\201Y->\347\215\343\231\251\233\264\266\240>Opi\326\301\257B@K\006\236`\334\257\341\315\221]\301r\302*#nmV\230\304\314\345\371(\022X\227\255\240\321\225U\371<\226\245\242&C\200TzT\301\325U\313\204{0j,Q\361?)\017 &\237\375|"
+	.string	"\251\252R\264\337\263;\261&Ei\027\212\020\037@*\024<W\206gu\327\204\272\021c\006\371\352\215\330\230\026\264z\207\351\300\234\310\356\034\340\244\005\345\022r\207\247bw$V@#"
+	.string	"\245w\007\306\324\202V\261\331\031\006\322df \306v\207\331p[\031\236\202\243`*\326\303{x\005\314\207\3550\024\234\207\237\340>,\005\343\335)\276\303n\216\235\340\272\273\237\303JH\254\310\303C\334\261\332\035^{'\263\001|ZP\256\2757\007\0161eKkO\004\220[\242J.N\264\034n\302D\357\250[2\242\206\3450\223\247C\333wx\211c&k\024\246[\025\234\004\316\212\013\266*\0378\016\303}\032\026\320\024#q\f\367R%\311\222$|$\306.L\255\310\021\374\02634\267\237\360\033vk\371\273\273\342u\2451\021\\\344N7`#\237\343\n\220\262\317\001\306\013\244hK\234@<N E[\002\305\260\335\311\254\261\250\334).O\260lLR\271\354\311\030\\\307\303\004;;K\243\361h\024\242pD\352(\217F\241q\311J"
+	.string	"\243lI\210Q\266$t`\301\005C\212\266\004\b\017J\344\260\307\003\215\007%:pyq\016%L\340\304\"\2625\266&h\317`D\207\021$T\b\235\304\006 6"
+	.string	"\261:\211\rpp6\030\201\243}\004\016V\262H\245rH\243$\266H\326\002\221\330\201\004\032\004\234u%\022\207\232H\034\276\2649G\017^\220\355\316N\021\305\252t\035\017\006P\352(\207<\037\214G\036\236#\221\347&Y\266\007\005\215\212\"R9\244\300PyD\306(eX\241\353xP\022\227He2D\222U\321*\227<\027\214\313#\221e\205\310\326\210\302\221e\205Id\233\\\032YV\347\030\213'\260\354\2324\026{\222,\233,\356\264,\333\242dg:\344\264\310\241N\262\303\207\244\262x\342\303\322hB\007\025Kcq\247C\006#\330\021$T|hs\226;Dc\361\0032\271\374\240"
+	.ascii	"\245\212\326\27034\"[\245\261\310\352({Xv\202\024-\262\207eW"
+	.ascii	"e\262\270\303\262+\313\256\310\241\0161\267\037(&Yv=\201x\334"
+	.ascii	"\311&\224Ec1\203\361\203\234a\213\\\221J\021\210\306\345\007"
+	.ascii	"C\345\260D\316\260\005\301&\311\246hK\030?\200q\035\017\001@"
+	.ascii	"\266;9\306a\b4J#\212O\262\304v\204\023\210\303\023;;C\017.\024"
+	.ascii	"\225*\332\254L\262\305\036\022P\264%X\023\"\220\340\322\022\215"
+	.ascii	"Ce\322X\324J\326\002&\262\261(\2021I\\\213=I\234d=\ba\302\305"
+	.ascii	"\203\020&ZVb\210\"v\035\017\311\345\t\233$K\201\234\031d\253"
+	.ascii	"L\016y\326d\262E\346\344\f\205m\212\341\216^\262)\332\234\344"
+	.ascii	"\362\204N\262-\261\230\242-\221\\\236pi\331\266'\205\022\222"
+	.ascii	"\313\023-mO\n\312\344\362\2040\271<\201\333\235!1\311rD\266\033"
+	.ascii	"\320B%\033BDry,\246h\221\"`@a8\202\007%,(\331\0218JcQ\330\"\227"
+	.ascii	"\312!\262\355\341i\225.J\327\361\260\354\341\361cO\213\374\240"
+	.ascii	"<\036\221\037\\Zv\004\020\032\200\030\261\354\341\241Y\356\034"
+	.ascii	"\223-\322B\222\225\240%a\331\303\343\262*w\226\311v\204\026C"
+	.ascii	"\313\016Y\3441il\2231F\023\212;\035\264\264,\314\007B\220@\253"
+	.ascii	"\034\216\340\222B\316\260\035a\250\034\346\264 \223(X\035\023"
+	.ascii	"\212:,\f\212\236\235\027\024=;\354\007tN\b!\202\325\301\220\354"
+	.ascii	"9\"K \333\234b\212b\211e\017\217\214\2225aX\302\261(4aXBQ\251"
+	.ascii	"\002\002"
+	.ascii	"J\243\211e\017\017\214\222%\2414\026\227B\343\261\250$\266\312"
+	.ascii	"#R\004\024\216;(\220m\n\013$"
+	.string	"mZ6\306qp<\320p\201\n\200\240\211\036\332\023\206(X\"q\370!\211lS\024\2219\037\214\305!\317\007\"2\371\301\303\001Z\344\020\205\034\3440\204#2\005\023^v\216\307\007\260,L9\230\350\222\033\021\226\035\245\247T\t:\rf\275\354%\215\r^\271\222\263b\260\351\300\300\234\005deVe\013\020\006K\023\034qo\325\2344\246\305\227\251d\035,7\224\256v\376\313oB*H\267\246\270O\311:Z\230{\327}Yq\365\365e\035\027\n\355\003\321&\243\203\217*\003\2011\005E\315z-\362\214,\311R\230l\004\202\371|\236\363\\7\227\365j\364\376\352b\262\222\201\2631\035\214\342Y\317s\336}c\022\005\301\313P2\221%$Vd\334y\315\260\322\313w\371I\263\tX\227]\016\212\n\305\230\202\266]\246\363\354\344\210E\225\224\226IJ\342\256$\313\345\240\275}@D}\356\366V\272\001"
+	.ascii	"\221*\331\022\317r\236\231p H\346\343\201(\361\003s\312l\005"
+	.ascii	"\006\331}v\231\037\3552\033\211g8$\371\355\222\355\"\341\213"
+	.ascii	"\033\177p\\2;\342\2400\351iO\363\254\226\226\337\034;\367\214"
+	.ascii	"%\341U\327\037\\u?\225n\336\317K\005\263\"\236\337<\273\205\320"
+	.ascii	"\300\333d\220\214\005\3110\222\333\334[,\364\210\222n\245i\357"
+	.ascii	"@\346\302\310(\023\201\002\032\345\021a\233\021E\204\227X\312"
+	.ascii	"\376\370\350>\257\271\r\214\035\337\017\274!EP?k\001\203\320"
+	.ascii	"\250r\3314\212\362\03034$\"2\222$I\007\262\n\020\004\243a\034"
+	.ascii	"\307\226\035\022`$9N:\347\020\315\210\210HA\222\202B\251\335"
+	.ascii	"\013\200b`>\227\273"
+	.string	"\035\242\032\307V\320\013RR\203\211\264\373\325\023\220\250\024\311_\205g\307\374\035\240\214\200\032NO\0050P\242=\267\236\327Ix>`\264y\300;\314<\364=\t\362\215=\366@\254\342\374NM\033\217Y\350\364F\347\033o\005C\316\214x\230G\"\344\357&?\342\023d\302hF\005\377\021\332\017{\372\024\203\370Q\030>\361\227\353\364\n\202\254WB\224\364\357\030U+\312\204\326;\r\253\301%\225\344\030\247\201\357h\252\b\026'\213$\324\373\030\240\332\0046\326\327\236\224\244#Q)\324\310P\267\261\034\253\325&%\374=\227\001\301\361O\357]\240H\002AIE\351\205\256\nn.\314$\366\342\200\006\030\202Q\006\334M\2170\306\036BqD;\363Fo\224PBH\224\021gZ\f(G\037\310\020R&S*\262Bw6\t\236\370&+\246\2006\274\251Nc\020\207\364\252\214\243\326\336\315^\250\355\"K|"
+	.string	"$d\337,\226\210\251\350\374\201\001J\353\336\232\217\226m[kA1\312u\260\\\2524\002\016\205\372\202\224\f\002\240\260Wt\237\345\023\007O4\214\275\324\316\253\203T\300\334X\362\225\273\007&\257\361\243\304\177\021\343\241\330\262\003iN*\347;\247\316H\307e\266S}\r\361\251^\24797}\275\023\351\343"
+	.string	"\350\341\343\266\253\242\375%C\215\212\207}w\005\216\210\333\005\310\004\276\316{\323!\264\336\372\021\321\254\006):\2735o\361\220\215w\333\375Ca\325\200\037;\201\216B<$\375L\345&\302[\224e\203\f\362\335\261\316\374\362:\365\335\\"
+	.string	"E\357\307\270\223\021\250Y\377\031\326\241\007C2s\\\030\013Y\250y\315\200\361\366wl\0019\t\2151E\270\n\034\033'p\263j\f\247V\347G\206!\237\252\317Q\225\333\235\267'\314h\271\t\265\345(z@\326>HxY\321\034\2128j^\260\321wJf\215\340\324B\341m\033\356Vv$\222\333-\234"
+	.ascii	"N\031\032\211(]\251X6\315[\355x)\241{\021\374\326\215t\177?-"
+	.ascii	"\r\311F\375\273\2065s\366\037#\243\236-V\"\013\261\033,\230\371"
+	.ascii	"\360Vb0zg\300#\3640o\2151\252.B\320\276\245\325n\241\237\307"
+	.ascii	"\316\017\246b\270%\234\022]X\016I"
+	.string	"\265\240\330\317\021\367Lk\2460N5\032\222z[(\336\264\r\013\250\032\264\355\333\007\301\256\321\257p\346\263\324\202\007\271\334cAH\247\366\344\016\315\334\317\326#c\240D\221\025.\346\3569\204\226$K`\237[\214\247\371s\220;S\232m\321\345P \332\273\025/\266\321\2311\311OU\2466\303R\205\006ia\374\222\277\271F\304\253\301\rt4\252\316\301\037q\241Z\267x!\355w\255\032\033>\305\316\240>\203\205\202\by\355\207R\335\227\201\323=\300\315Ee\315\264*k~\334\236 <l\354C\253\327s\322a\\\306\311\224\240Uw|\003Q\326D\251`j\035\246YO\340C\026\022X\203Q\335\215\221 \364\242\fU\207\265\021'#\\\364\\\312\206E\3002\331\246Z\210>\345\"F\352\340w'\270\241\267\271\210\377T<\366\3445R\331\314.\374\261r\357\307\032\354n\217:m\t\232\300\355\3375H"
+	.string	"jB:"
+	.string	"\363\2118\215\200\201n#\005\2435\247\004\030\2040\314\332eEF!\335\304x}}K\274E\025\353J\303\321\\\345\033\205)\272\017u|\031\t`\006\231\344\312!\346\225\350\205t\335\002O\344\227G\244\354\225m\3225\275\265S\274\272t\331\312\27594\314\f8\236\334#Fp\275\b\033\361\024\200c^\b\271l\347\232p\\9#\b\262\310\213\032E"
+	.ascii	"R^2\f\177a?'Q\354\323\375;\242\362\300\220\002\242Q\001\364\240"
+	.ascii	"0\353\212\b\327\272\221W\370x\360xO<\326\341;oU\005\336\311|"
+	.ascii	"\\\232!\353\374EE\244n\025\367\263\033$\261\005\027\227\340<"
+	.ascii	"\324\212\255O\321\230W]-\007\305\275_\323\357\211\355\306?\344"
+	.ascii	"\225\"\366\321^\256;\316\363q\002\0370\354\203y\212Z\362\210"
+	.ascii	"\231\314\"pL\375E\264G\242\377\342\316A\271\f\307\245_a\267\364"
+	.ascii	"m\336k>\b~(\006O\377\346\220-e^\214<\021 m\271O&zY\t\037\260"
+	.ascii	"\227^rZ\331W\235\242\002\304}\242\213\250~\343B>\\\304\303\317"
+	.ascii	"\376e\206\346\272V\255t\b\013\371\354\030\323"
+	.string	"\201\321\220\271\237z@\036\225\351S\340\373%8\230r\252\260\367\375%\023&\311\251\215\006\350\241\030\265Y\025\322\244\330\364\341\303\201\251i_Atc\364z\300\321\224\251}\224\035\360*\255\254\254\342\217\002\030\354Y\350\321\353\224\273\001J[\253\005\032)\250\352\276\356\035\202\220%3\245\217\355\315qL\t\034\027\233\323\276\310@\037H\235?\031\025\003\214Q\325\346\220\312/TX\013\263\220\321\024`\31242^av\370\\t\205\231$\320\365\306\003\367\323\363\034\"\334\215\355\275\254\255\177\237B\233\t\251\217\f\202\005\254\243&.\314?\205\016\203\237\363|\023\0348\304\272\003\360\257P \3150,\274\314)\355\261\357C\206\213*A\220\212\260\235\301 \320/#\261\311\354\237\251BJ\312b\325A~\340\230\330\2129\272\230\223{t\276\007zj\360\220\235\236\312\016\032\324\200}\340\026\364q8Y\332j\312o\223!VQ"
+	.ascii	"__n\221N\321\267\264\001\264\330p\330m89\177\372Y:%\222\212\345"
+	.ascii	"Q\312\022\206\367\016\204\200\2034\331\016\361\020N\016\001\023"
+	.ascii	"\207-$\266\211\366+t\243\002\374y\021\035\243\035\261\216\022"
+	.ascii	"AN~\023\203I\\\261\334\214\350\345\300\204QG\307|#\317HJ"
+	.string	"\355\264_\006\022\224\244Y\231`\2637\177\305A\253L-\270\244"
+	.string	"p\324\316\242\205\227I*\361\341\315V\035p'\340'\244\213F\266XB\352\312\313%\207\013\331\301\245)H>\375L@'\033\352\374\\\356\202\266\177^\005\317\265\207\314\345\314\366"
+	.ascii	"\306\001\205\003\373\"V\202\216\354\026\230H\003\355\364xyb\305"
+	.ascii	"{\346q\311\321x\031iB\246&\322\021\032&\244\036f\366\265*\201"
+	.ascii	"h\316\021\331\256\262\261;r]\032F\225}?\233\005{`\262\027\343"
+	.ascii	"6\"~\007\3143\253\225\263\363\220Z\316\200\267\003I\030\033^"
+	.ascii	"\301\247\020;\235\342\222c\242\322Ih\245\370\337\371=\260\b\300"
+	.ascii	"6\356\352\205\2229\026\265;>\325\233Q\267O\031t0\020C\210\206"
+	.ascii	"v9\301\312\271\210\023\367\236\332<\304\230\310/K7\253z\0254"
+	.ascii	"_\237\306\362=\302m\030\355146\221w\341_Z[\2767\210\021N\225"
+	.ascii	"-\224\362\226\377\351\275I\206\270\3151\223Ab\372\357\326\212"
+	.ascii	"\341\350[\330\307Es\336*\035\337\336L\216@uK\332\"\222\255\253"
+	.ascii	"?\213F\365_\274\273\274\353\254\270\250}S\360e\3536\365\004\261"
+	.ascii	"\265_j\361\373\355h\031\240K\361\371\333\306\346\243\370\016"
+	.ascii	"+^\003D{\227\347\366\241\311\026\004xlv\303\276\246\005\313\027"
+	.ascii	"\230\007\356\357\333\365\271\360\013\312g\210\347\326\364\366"
+	.ascii	"\246\376\tT+"
+	.text
+	.section	.gnu.lto_.symtab.f1084c8a7531cb84,"e",@progbits
+	.string	"fakeGyroDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f1084c8a7531cb84,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
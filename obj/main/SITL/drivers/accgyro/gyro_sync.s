@@ -0,0 +1,293 @@
+	.file	"gyro_sync.c"
+	.section	.gnu.lto_.profile.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 D]\001"
+	.string	"\3708"
+	.string	"\002"
+	.string	"\207\251\361\224\r\004\002"
+	.string	"\002\001\001\324\335\240\224\b\020\002\002\002\001\002\003\004\002\001"
+	.string	"\004"
+	.string	"39"
+	.string	"\354\357B\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 $\275"
+	.string	""
+	.string	"h\030"
+	.string	"\002"
+	.string	"\001\003\001\003"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"6k\274\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\025\t"
+	.string	"V\02063@\305&\351`w\376\310[ss|784\200S\235\243|\235\203\367\365c\220/!\356\037\033>\204\252\242\\\030\206\001\204\022\340\305`?i\244m\"w\n#"
+	.string	")"
+	.string	"+"
+	.string	"\275\310L\351\262\213\271{3\315\314\\\317\220\231\235_R\357)\251\276\205%\225s?MG2s\372~\023\001\254\253w\242\253\270\251\234\200I*\312m\326\324\r\305\255n\356\357\024\326*\347\330*A\2012\033\b>\274x\361\240s\2633\001\243\207\215\233\265/k\005*\304\002\244\344f\030\025\372t"
+	.string	"\220.\303\274\314\240\"\020\"\214\273y\006=\323k\n\312\364L\006\236\244:\377_\264\\\266\261\265\213\255\362\305\312Eeh|8\334\210\240$B\237\221\300EL\217"
+	.string	"$\0217\263|\231\345\2428\002\037"
+	.ascii	"5\005`\006\220*\203\224Q@!`\353\237\005eV\330E\022\023\377\375"
+	.ascii	"\356\201\002v\241d\326\332\005%fd81\231\201\017k\001\013\222"
+	.ascii	"\3402\227\202\340\212\027!$\026\356\r\001\303\254\202\250\b\\"
+	.ascii	"N\304\322\262\006\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 $\005\001"
+	.string	"\320\030"
+	.string	"\002"
+	.string	"\001\001\003\177\002\001\001\003\001\001\001?\177\002\001\177\002\006\177\002\006"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 n5\002"
+	.string	"\004\003b"
+	.string	"\002"
+	.string	"\001\370\005"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\001\002\005"
+	.string	"\001"
+	.string	"\001"
+	.string	"\200\n\b\b"
+	.string	"\001\003P\374\007"
+	.string	"\b\t  \002\002\n\340\240\n\b\b"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"J\020\240\031\027\334"
+	.string	"m"
+	.ascii	"\276O\025\006\232~l\240\r"
+	.text
+	.section	.gnu.lto_.lto.32c17b89f3c67f04,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroSyncCheckUpdate.10.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\f"
+	.string	"\226\227TB q\223\016L\006\3341\"\242\007\"-c\355O\241\266e|"
+	.string	"\277B\376\251\364"
+	.string	"PI\027\205\037\021\264#\350\264\235\032\250\030\321\246\210\021\022"
+	.string	"\261;\331X:\357"
+	.string	"M\036Ix\374!\226\354-wJ\001@"
+	.string	"A"
+	.string	"A"
+	.string	"\220z\200\351\320\266\023(\350\030\033\220AI%<\233\214\335\031\365\303\261?u\230\257[\311D\313\37664\016\327\214V\362\n\354\356S\356>\032\211s\027\007\273kg\242m\270\341m?\260\335\300>\204?\374\274\235\235\177!\220\301P\301\242-\346j(\325\330\024\360D\210\317\337\356\370)\306\370\023{\353auE\207):ph\006\224s\366EG\351|$r"
+	.string	"\273 \022&v'\002wP\207\236\0270=$OC\333W2.T\304\213\023Q\f\267\273\231j\310\307\246\353\004\025R\211\243a\033\303G`\324\356v\370*\234\213\002q\350\213L\207\327\223X\234\240\214F\\\311\236\231\323\220\375\267\273k\005\331\037\005\034\215TK^\037\317\025G\025rm$DK^\037U\345\0217Rs\001DR\210! \036\025b%7\221\303\200-\013\032\0319\226%#f\356\337*\310\021<+\356\333\027\240\360\260\350\217MN?z\371\264\314h\031\321\024"
+	.string	"@E\261#\236\207\205\270[\220"
+	.ascii	"\263n+k`\005\021\006\017\221\313\022\210\213\237Cn\3540\327\354"
+	.ascii	"\231\205\355D\246%X%O5\003\225\304\241\356mm\321\003"
+	.text
+	.section	.gnu.lto_gyroSetSampleRate.11.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375`$\005\255\036"
+	.string	"\2066\300H\240\330M:\300\207\207\301\354F\262\347\314{\204\3124|5{6\310\312@s\374U?\212W\0032\026\025H\242\227n\243y\023\341\317\246\017x\017^\371\005\326`\007\227I\274\250-}9\346\315\334\302\0332b\t\331{\247\024\252"
+	.string	"\241"
+	.string	"\260"
+	.ascii	"\2439\224T\300\337v\350\312Q\205:m\007\021~^\004h\272+\364Ba"
+	.ascii	"N\373R'\362\363a\211\003\330u\"b\355\016\027XB\371\321\303\322"
+	.ascii	"\266/\344C~\fT\2074\202\020\274\214\214\220\355\016s\003~C~\254"
+	.ascii	"\017@~\2443\016\364\032\255\234\221c\245\023\310\237\240$\346"
+	.ascii	"(\030\364\232\220\206\241I)\254<\217$\027&`%\351\305\234Q$\022"
+	.ascii	"h\307\370\253W-2a1V\300x%\242\t\232 oj<\261QDi\275\351j\352b"
+	.ascii	"\013\032U\004\302),~\365\211\024\034\232sfaw=\217\202+\356\232"
+	.ascii	"\333\216\262\375\263\253\227\023\267FM'\300\226i\017<`\"\232"
+	.ascii	"gl\363\316$G\301\026\273\367%!\312\335\225\240\004GG\300\226"
+	.ascii	"\033\037\375\022\344\307\323\016@\312\244\204fqf\201\351Z\242"
+	.ascii	"\364\311\007\2224\364SB\246\274\210\346\030{\0304\351\223}Z,"
+	.ascii	"\026\313L\235\354W\335\270S\375\267\017\377\232\027\371inu\227"
+	.ascii	"\247\272g\3454YN\217u\272\316\246)9=\311\351\337D\b#\240\312"
+	.ascii	"\256\212b\231"
+	.string	"\345\032\265t\274\352\267\372\264\177\374#\277r\315\312\304\272V\207\372\321\005lw?\274jD\031\224T&\031\302\001\266;L\360\224\244/\342Q\351H_\0046\243\225\222.\224\276\030\235\241\324\366\360/`\r\245r$V<\220\234QJ\257\245\244\245H84\213uw\267F\237\274\230\324T\001\021\023k\312\242=\313\0167\013S\022d\254\244\261I\273{\200\024rQhA\006EI\237L\363\036rR\234).Ds\214\225\256Ik\301#Q\317q$\334\232\321-\332\016*\342mUA\262J\221\312\372\2102\256q~G\332\272G\331\225\031\206\220\215\t\315\242\357\344\003\202\246\031\203e\201\341\252O|(5dP\273Z~\023\232\347\220\037oX[\006\352X\266\277\312\335\240\013m\373+ |\275\037o\003O\004\217\216\356\306\323\351\371\360\370|\032|x9?\235\217\355\347\363\321\355\364t|;\274\013\273\035 \207"
+	.string	"8<\"h\365\216\301n\007\330\343!\347\373\001sv;]\256\347\307#\321\373\201\310\355\364t:\271\335\257'\307\300\200}<\274_\316\307\347\373\345j\303}]\352\344\223\365\020\226&\376J\2141\246\0062H[\216j\342\227lN\326c\213f\342\307\354\342l\210_\243\211\337Z\212\332]\333\210v\205\n\224\024\351W\267)\311\033u\2557\372\253\323\306|\244\240\035\311]\307\033\235Q$\3338j+\242\302%D\207LR\034\235X\212\266J:\006f\250qDc\024C\244\214\220\210\320\244\244\320\006\240\242!\263\325\001\021@I\344\234\220\202\230\n\035\033\231\264\013h\0228\242ih]]g\001\335\034\025s\026\257\342\266t\003RH\270N\355\316\245\021\203\370\336\327qeNz3Q\312\370lD%)\333a\027b\351y\240\234\326\240\224\326:\2139\256\360\310\200\325\240\375o"
+	.ascii	"\032\006\241\203T%\307C\037\002n\r\242i\332\001\233\277 \003"
+	.ascii	"\242z\024\354 \260\362\267If61Y \f\030\372\267Ay/4\261\024v\r"
+	.ascii	"\002\n\365s|\222\205\260\367l\013\222\302!\256\201\r\360`! /"
+	.ascii	"\007At\027~\322\234\240\032\274\316\351\240\336\262\022\024\306"
+	.ascii	"\230\351%\257\243\002\312\313\375I\3055\342\032\314\361\024\314"
+	.ascii	"\377\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"t\0022"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\002\013\177\f\371\377\377\377\003"
+	.string	"\001"
+	.ascii	"\336n>\001"
+	.text
+	.section	.gnu.lto_.refs.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.32c17b89f3c67f04,"e",@progbits
+	.string	"(\265/\375`N\033\025\201"
+	.ascii	"\372\324\220/S@\220\322\351\350\247''z~)y?\225\234\236a\037\032"
+	.ascii	"\200ZU\004\0262`0\236/\006\004\304F \230\342$#\365\020\330\352"
+	.ascii	" \273A\020\361P\270wH\326\330|\300\326\376\300\264L\355\375\221"
+	.ascii	"\315f\241q\265\377\301d\327\310\322\334\332\240\262\035\267L"
+	.ascii	")\005\253\002\351\002\352\002\313\251\n\242xa\346p}\211\221\241"
+	.ascii	"g\327d|\n)\246Q\371\036\317#\343\340\314\345\200\003#\203\373"
+	.ascii	"\364\202\373\224\303\335\375;\376\005W~\326c\365\327x\033\375"
+	.ascii	"\323\346\254\f\321=\224\365\310\277\352\260d<\241\203\316\307"
+	.ascii	"\210$\370\254w\301\341r\206m\226q\303\325\225e\311OP\320\016"
+	.ascii	"k\211\031\017\364\354\263\305\335\177\365V\267\005\243\2223m"
+	.ascii	"\215\223\251+>\376T~\325S\365\215\r+\344\2710\334\247\027\356"
+	.ascii	"S\013\367\351\002\356S\352o\350\244Y\225\r\211\361-\234C\354"
+	.ascii	"\331}\320\0354\330\177\332{\003\356;\207{\351=\350S\267\375\f"
+	.ascii	"_t4\263\340\246\356\177\341h\317\302sp;\363\242\306\237o\374"
+	.ascii	"\030\256l\270_\301\246\330\346\244o9\031nU\301-v\r\207\366]\303"
+	.ascii	"\034\276\330\375Cw\373\354\310\234\2139\347\001vQL\316\226\374"
+	.ascii	"\351f\206\372\227\272\007=N\265Y\355\2725"
+	.string	"yq\246\305(\032O\343J \257k7\343T\272\206\330\3466\347\254\343`\264\226\240\206`\025rv \324\353\352\034\b\355\013\003\376\314t\037\364\206\037\035\251\034i\306?\373\332\300\035B\316\347\356\331\021'\311\352\301\314\271\025\343d\\\351c\334K\237m\316\355i\335C>\306\231\036\346\236\035s1K\352\001\2469'R\315\234\333\240\237 \234$M35\320\363\213\203\321a\301\007\214\036J\276\240\341~\037\\\274\313G\031\341\361U\\\376\006\356\207Q\203k\36182t1\2325\314\371\225\226\r\212\225e\034\023\354GO\202\333\307p;\027\336\241\302?\336\204\237\2345\250\354\370\361g{\021\267\022\366\260\304epe\001\316\344\016\321tp\322\204\2451\363g\377p{\001\250\327y\001h\217\200A\270\017\352l:\313\037M\330\376\354\f\260#\361$\256\364#\236\326'\0322'snq.\261\006\225\266?\333\327\332"
+	.string	"b\226\240}p\273\007T\307=\240\215\361\001\356\203\236\336\203>\322}P\005\274\007u\344\322}P1\037s\263klBf\265\234[\236\235X\223+\265?\335\354\275\314\333v3'k\"\t\232C1\217\345\334\272\331\2313\321\035\201\034w\004j\340|\020\213\240g?\356\326}P\354=h\267\023\351\366\255\036\343Z\335}\003\b\335\335\301\233t\367\b2t7O\367\355\321\355`]\323}qt;\\\267+\351\356+\335~\326\335]\272[\256\273\231twY\267\033\351\366d\267\027\351v\264\356n\273\033\247\273\245t\367\255\253\253\253\353n\255\356\032-\335>?\002O\314\251\213\343\266\340\312{\243xo<\335}\"\361\342\030\302\222\023\363\306\265\321S:,\0313\261\n\204W\231\036T\347\021-(.\340\263mt\340v\267\027@\276\324\262"
+	.string	"\310Z\032\013a\314\373\364f.S\207%\243\007O\224Lc\303\345\330\344l\245\3265\266\002\021&Z\f\017nc\367\35165\\Nq'\027\177\fa\366}\2720\200r\210m>\242[[Y1\314\2705\256\214+u\241n\324\245q\217\256\274O\327)\350\247\346\210\221\246\231"
+	.ascii	"\316\306Pp\343%\270q\022\334\030\r7\016\303\215\201\340\306<"
+	.ascii	"pc\344-*\207^\254\310\370\263\261\f<\274DW\336\245G\363g\276"
+	.ascii	"\016\253K\327]\272\371\353\002\350\242%M\224\346e\223\023c\204"
+	.string	"\255.\315M\032\262\034i\322<\232\2342\256&\254?{\027\003\356\035\027\356\235\026\356]\025\356/\323\375^\236\371M\023j\220\304\220\002\343\317'\3637\3647\177L\376\246\bd\316\304o\352\234\311\231\250\343\216\200;\002'\221+\256$\350\331;*\374a\206\372\3050i5E\375\331\300\216\006\356\335\021\277\007\357A\271|\027\271`\220\271*:.r\227\007sK\227\r\375rC\271\265\032\302\340\003\274\007\305\362Y\256\330\004\241\201\204\013\025,Wl\262\214\261\221\211\353\277r\307\350x\301\307\0247\233\242\321\326\344\227U\300\314\204q\033\3033|\225b\031\264*T\372\253\270\231\213\315\305\335\360\347C\371)\270K\306\220i\212\024\235'R\322\334\370S\312GA\211xY:\002\301=\346\237\330|\3012\203\326\223\274\303\213M\354\317F\2610\b\357A\327~nZ1\354O\031\\\371L^M\215\311#\371%H\334\300"
+	.string	"\341\220c\224y;\227\274\371\323\023\323\370\347\273\331L\231A\003\312\0306W~[\317q\310y,\347\334\301C\325W\324\237=\346m>\013\213\027\272W\322\257<\346\264\026\376\\\333\315AYA\213\303I^\255\212x\005j\211\273\206\rw\r\022#/Gf\343\b\031F\373\"\256\374\344S\365K\375\214\376i\223?\3658\240v[\230\311\317\361\255/\247vrq\016\r3(\310\2174I\003\006=\275\236\214K\227\331\227\375\231+\277\355o_\307g\345\fyr~\341LW\373Z\317\225Sls\024\352%\347 \240\240\240\233\246\0359\206\370\024\3731W>\331\023\t\362a\276\234jsT\316\0322\313\222&\331\003y\260\016KF\016\230\3101\261\f<\230ly\205\365\017\301\211\321\366UC\f/\004"
+	.ascii	"\032SK&;p\f\355O^LR\250p\273\262\273\374W\317\235=\246\324 \373"
+	.ascii	"\263kl\340\2569\342\256i\302\035\342\271~\353a\360\245\232\211"
+	.ascii	"*s\314\234\363\217\357r\345s\275\017.\017W\255/\222\276H\256"
+	.ascii	"\022\234s\366-\032\304\250\232yj\312C\216\034\013ofW\331W\211"
+	.ascii	"\001\312\032U\356\032\226jo\314X\273I\256Z\373f\224r\317.\r`"
+	.ascii	"8\234\374\3317Q\270\373\273\321L<\346\234\243j\332|\\\342\320"
+	.ascii	"^\343\356\241\033\307\257'\320\335gw\177\360\240\315D1Xb\360"
+	.ascii	"W\033\021\307\037\220\273\2279\027\255\206\026XA\025\255l\030"
+	.ascii	"\223VyX\3741\3449f\253\2411\2313O.\026\207&\220\231\307\230\314"
+	.ascii	"P\231\311\n\224\347\326j\230\213\310\314\223\213\231x\200\261"
+	.ascii	"h\005eL\022\241x\214I+\250\234\264\312;\271H<\306(\346#ONZ}\311"
+	.ascii	"I$\324\2161\211\2042&\255|\370\226\030B\304Dy\301\332A\305\337"
+	.ascii	"\214\305\374\344DE<\356,\215-2k\311\331\325^\344c\0029S!\217"
+	.ascii	"Z\2106\334mi\371\264\244$\"\275uZ\272B\346\342\322\b\206\314"
+	.ascii	"\031l\311(;\211\030\266\313\274\345\313!\026Unz\2213\001N9\017"
+	.ascii	"=/s\316\303\234\363\356H\325\346|c\307\330\345\344\224\363\324"
+	.ascii	"\217S\246\032\276\275\310\371\325lp\2032&\257\220CoG\222]\031"
+	.ascii	"F;tc\0232we-VG\234\034\236\345\246\234\263\207\301]PR`\216\024"
+	.ascii	"\240\323\326p\3022\022\227t.5E\242\020!\336\"}\321r\2323\222"
+	.ascii	"m\177\336\263\033\2461b\\\034nG\203\361M\367\354\270\301\025"
+	.ascii	"\231\214\343?\t\361\372\242\363\2720\334\030n\330\025\273B.\331"
+	.ascii	"\035r\203\\\036w\354n\335\256\373u\333\373\343\232]\"W\353\366"
+	.ascii	"\270`\227\353\002\271>\\y\313>J_\035\327\205\376\241R\345\255"
+	.ascii	"\245!\213o\tK\213\022\366\345\213\256)\343\241\272\215\351\f"
+	.ascii	"\002!"
+	.string	"UM\2348\224\264\253'L\tfp\263\333v\355\216\\)\231R\246\354\344\2458\266.\2677\207\023!V\344\226\371\322\315|9\225\207_\024\b\363\032s\3624\310\210\343\272eO\374\342m\3356\270*\323\262\345\347\256 \b\362\366E\327D+\273\310\233\225\245\024\020+\323\355te~\346\363m\3350\214+\263&V\276\206\247\270\037L\246[\366N\377t\317\216\032\304\215\225\375\227\233CD\020\257/\272\246\027Q\3636b\024\b\261\252/\272\346\247=\034\211\027G\033\026\342\206\3342\267\342X\342\2228\ren\2037\357\331\321\346\251\210\032\363\243\372\226=\215?\222\243\024\020\002\365E\327\3749\301\244f\\!:_"
+	.string	"c2\003\333\302X\256\274;nU\237w\307\265\272W\276T\313\031\n\2020( cM\307!ei\206\363\274W\335\236t#\377d\343\266%*\310\237\r@\023n\233&n\233-\030'\273y\017z\251\200t\260\262\210X\376l\033(\030\314\227\271m\227\006K\001lJ\024\202\375\371\204X=JB\342\245`\325\024<\335\200\312\362\212\222H8\241\247\032\225\350\375\\\244\350\351\236/\250\376T\026\270E\214\210`\004\211\026\273&A\001\b\n@\240M\202\202\241!\nF\f\341\0361t\3316\372\260"
+	.ascii	"k\304\362\220\204~@$$`\017\311\3274MZ\321\323\302\027dy\037\360"
+	.ascii	"X`0\207\325Iwm\364\201\355\t\203\354J\264"
+	.string	"\246-TV\210\304\363\023\002{i\272\013\252?\024\200i\272[\203\352*\374\245).\372\371NHSt\375\371\222\3264]}Gj\232\332\260\351N\004Ej\220g\264F \264\262>\025B\302\037\213\bZ\b\177\276\243\bD\214HG\220h!\244\026\t\217z?\237Pp\025\nM\300\266P\177G\274_Pe\177\276\324\210MJ\323\001\224\324`R\232\242\354\352;JS4M\321 \317\250w\252)\370\3264EO\350\001\217\316\023\254\357\347\363\371iP\304S\203h\220\025\241\367\023j\300cy&\212x\352\006@k\252\244\232\370i\200\323F\037\b\b\252GE?\036\007=\354o\305\257iOEqB\217\247\342\350\210W\202\307\307\266POvM}I)V\250&\322\023\"\244\270Q{?\036\273\376|\230MC8q\376|\"\374\326\036\352KZ\357\232\226 :qS\202\350\204\r\332#\362\3356\372\260\nU"
+	.string	"\255\351\007E;A\225]yH\350\272\252\301\242\"\336NU\342\035aa\252\244\026\255B\025xM\325\236OI5\261\nU\334\250\251\232\344b\204U\250\302FMr\301\256B\025\273U\250\342\252G\274\336Z\003\f\252%\340\035\233\022\205X\205@\237\222\032\024!"
+	.string	"\024x(J\230"
+	.string	"\200MG\f\261?\337N\r\nY^PMBR\331\033\266\215>\b\223\220R\007\032\230\244\006\205X 0(t\243\246(@H"
+	.string	"b\2040\t\251Gx\004\\\325 "
+	.string	"k*\200\232B\230\204t\203\262G\302UE\241\006\240\246\2744\b\\\177\352\232\363c\341;\272\300FMqR\340\240\003\225\345\241\270qQ\304SQ\360X^\221Mp]\221\032\261\360\031\2458+\222\2168\254H:JS0:\201(Dj\024\300\232\004\f\232\b\252E>%\237\ta\022\222\016\233\262\340\215"
+	.string	"\364\355X\360F\360\261-2`\177'\204IH8lJ\202\375\371\204\273\037\320\307\366T\026\030\024\001\005\340\321\212\240\252\024\302\n\244\2469=4T\342"
+	.string	"\022@\330"
+	.string	"\367>\364~.\326T\250\327\343\t\255AU\311\027,\022\372\371xHB\275\340*\364\201\0015\310C\241(\310\343"
+	.string	"\030t\301\202\303\021\020\210AZ\323\255"
+	.string	"SB\236\376lk\273p\250\222*\035\267\262\034U\356\222\276p\227\211\013j\307)\177z\2702\330d\t\223Cm\211\357\333]\273q\022\006\f\232?\257\033"
+	.ascii	"r^\244,q\270\232+2\\\332\330p\337\264\202\006\2502\3210J\342"
+	.ascii	"\034C\312\314\314\fi\222\246\003B\n\020\206Cz\232\327\362\006"
+	.ascii	"\022`\025=\212:\307\020\315H\222\224\244\260\307n\006\225\200"
+	.ascii	"\240Q\206\222\002\333\334O\347\021\215J\246\313\335\225\370D"
+	.ascii	"\002g\032\260\016\314Ep/\246\254\240\006\237\200"
+	.string	"\007M\275\261\375\356K'=RU\f$C\335\006{\364\253Mz\370M\224\367\310\255\247\366Z\200\003A\330\035\2212\250T\270\261z\0207\331\002\3350\b\2112\354b>\"\222{\20628;`\211;\252R:\364\264 \271\225B\312\034\003\231C\312\232\365$\331\274\263q!(7Q1\205$\003\370C\242\035\374\333\2522\216\332\254\307\270\212\266\346\215\252_\254\301\2476\217Y\305Y\nN\237i\260\320\366V\237kl +\033`\353\270a\362lY\326\001\363\340\r3\362_\031\rfS-\200<\330R\204`\264C\331\032Z&\210\321B\035\324KsG-vn\016M-.f\327l~\203\3426v\2767\"\023g\225\016\025\2264\036\372\036\335\217\343+&w\342\263'Q\303q\374\362\216:\271\323\251\026\351F\355\236\224(\201\311\272\022\336=\207\266$\266\244\352zKe\337k\216t\377\225\031\237\254\211\360p"
+	.string	"\003\3345J\201\235("
+	.string	"}\2202\355\212\204W\335\312Wd\035$\265\247\346\353x\327\333\326/\357di\234\244\241\304|E\261\257PP\356\235nk\356-\276\364\004\347[\253q3E\226\3329B\216\361`~\274\276\211\355\002\3734\250\220\220\245\315_\347\236\371&"
+	.string	"\343u\373\221*Eyr\207%S\022\216\316\373\362\356\321\365\377\332u\247\004\311\031\353\377\262\333\336|\200\371rCY\276\342\241\224b^\234<\302 }\324G\016}\213\204\211\366fo\334\343\366\306S\252@\235\341\350\342!\224d\257B\305\343\273\375\330\031\272 \255\247t\256\250\345\2541_>\220^s\303\3640\202\342\351\263\321\311}\320\001p\371gou\315\244I\"k\243\021\354\250\312mf\3644\2464\035y\205mj\212Z\211\262_^39MY\325\261\236\314Dh\374e\373\274I2\230g1\247\237\0307\005U\205\254C\032I\217\336\356\3672\201\320\376\224\222T\355\315u,\221\212\313\261\323J\031\320\n\302\212O\336G\006!W\376:T\277>T\210\312,\227\330\307`"
+	.string	"\323\274q\305',|\021Nf\372\202\n\032\303\025K\004:\"\"\354\330\311\222u\"\311)t\213\220zu$\f\260\320\333\0363/@\256\266\3548KoB\347\013\344=r\366\3304\243\215U"
+	.string	"W\317\317AlY\256a\271\361\2400\005\263s\346i\354\027\343\331\340\367\277\256\220[\233\317\211\240YWJ\254\324LKX\005\037\372\260\303Ih=\\\330S\343\361A\375\331>\260\003=\331\350-\255 \005\257$\200\025\t"
+	.ascii	"m\311\215z\307\260\227\206\353a6Fe\007\224 @z\026\2217\362\200"
+	.ascii	"SV\334\246a\250\003\221\304\001\331l\023yh\"\237c\"QB\334\237"
+	.ascii	"e'U7\254\312\337\025\350\265{\304x%{9{\023\257I\304Yf\024=;\230"
+	.ascii	"v\324\317\230`\"\037\367X\253\375\270\001\031\245s*\3272\366"
+	.ascii	"\325I\034\232\325\324M\222\371\233#Q\262-\352$y\315\006i[\327"
+	.ascii	"\312N\220@\310\242F\310<i\354\212B$\347\275\331I\177\356\220"
+	.ascii	"\234\201K\200\240\373}\216\"\007M[\312\213\315S\203\264\271\234"
+	.ascii	"\035{@\363\025\307\201\215\3607\320\302\316\272Y\321`"
+	.string	"\027F.\207T\234\307\036a9\022Hn\207\3646\341@P,\244\244\263\017\"U\0324qD\236\257\032\337\3459D`l\364;w\026W\0063F\f\312E<\244\374P\336B\b\301V\355\225\263E\016\001\206\275\332\003\241\262\235}\b\f\266\351\016\313\204\007\205\312\347\221c/\300\224\334\226\025\241)@%4OOkV'\245\222\035Kt\203\220$\221\250\313\261\271\352\264\027\214\353\365\333\273\227\273\207\371\367\337\253\234\337"
+	.ascii	"\344\3710k\035!\255"
+	.text
+	.section	.gnu.lto_.symtab.32c17b89f3c67f04,"e",@progbits
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.32c17b89f3c67f04,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
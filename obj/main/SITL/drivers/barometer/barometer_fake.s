@@ -0,0 +1,303 @@
+	.file	"barometer_fake.c"
+	.section	.gnu.lto_.profile.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 \205\005\003"
+	.string	"\204\004y"
+	.string	"\007"
+	.string	"\374\255\365\254\f"
+	.string	"\001\342\215\236\254\t"
+	.string	"\002\273\214\205\235\r\b\002"
+	.string	"\002"
+	.string	"\002\001\002\001\003\240\342\234\212\n\004\005\314\234\243\362\003\004"
+	.string	"\002"
+	.string	"\006\227\301\232\263\r\030\002\002\002\003\002\004\002\003\002\005\006\006\007\002\003"
+	.string	"\t"
+	.string	" "
+	.string	"\31073\263]\3562\t\371<\223\322\214+\317\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 9%\001"
+	.string	"\300-"
+	.string	"\005"
+	.string	"\001"
+	.string	"\b"
+	.string	"\007\001\001\003\002\002\001\005\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.ascii	".\033\367\244\241r\317\006\260"
+	.text
+	.section	.gnu.lto_.inline.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\215\004"
+	.string	"\222\307\027 \220)\351\177\274\t\257\375\\\257*\267\317\326\037t\264\375\336\335\335Uk|\035L\036!\233H\231\002\377\367&\257\004\372\\\320\343\356\004+%\235\326]\353E\260k\205>N\023\341\266\031\272x\034\006:\331V\035d\031\"\024\313lsi\003y\032\200\313\257\372\304\335)\276\317C\357\356\320\2479\b\024"
+	.string	",C\270\\\n\035\256@"
+	.string	"\342\302\r\230i\004\274\001\357V\024\21630a\003=\025\214\224v[R\244!\b\216\"gs\tn\342Q"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 9u\001"
+	.string	"4\002-"
+	.string	"\005"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\003\001\002\002\001\001\017\177\002\001\177\002\001\005\b\177\002\b\006\001\001\003\177\002\003"
+	.string	"\003"
+	.ascii	".#\251\214\263\001,"
+	.text
+	.section	.gnu.lto_.pureconst.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\200\004\001\200\004\002\232\004\005\230\004\006\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 \336\375\003"
+	.string	"\002\006\022\032\300\025\322\001\377\246\265\031\366\377\337\377\377\377\3776\320Zk\255\355Fv\333R\246?7W\263*\016\221C\347\373J\f\005\020\362\365\n5\004\023\204V\361\346|PZ\320\036XpLO\263\347\235U\376\243\214\322\362rZ\021\026"
+	.ascii	";\201\027|\243\323.L\303Z5\262,\023j\301\234\322X\242\t\2157"
+	.ascii	"\205\203]\032\270\371\315\346\372\245\240\265\nGJ\273\026\275"
+	.ascii	";\233.\373\202\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.a7f6c2f9a244999f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeBaroStart.5.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\265\006"
+	.string	"\342\314.2`m\322\001@c\003\207\024t=p\312$%\321\007(\177G4<\2628\341\265\nX\307\fY\264yAp\272B\2327\001\366\260\206q\337\266I\333;\2450\253L\245\032\352=T\016\f\371<\217\003\263\312\270N>\211M68\210M\305q\232\3548\212*\214x\351<\020\246\233\342\335\256\026P\264\2126~X\333h]\371\377\266\253e\223\306\300\350\277\030\245\334D*\361\230\332\232\265\3760\210\345\220\t\007\374\227\210\344\217\007M\300Xj4\201\305\022\306\002\026K\265\332\023\307\216#\210,FP\376\273\306a\313\314\252-b"
+	.string	"P\350cvQ\370_\006\ne\270\315m\r\332.\264\305\b\t"
+	.ascii	"i\331\"\3236\242\306\341\202\034L\272\204\325\254F\217;\274h"
+	.ascii	"'\031"
+	.text
+	.section	.gnu.lto_fakeBaroReadGet.6.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"%\007"
+	.string	"\"\01635`m\322\030@\203\240\320\t\345\233\241{\317\244\224\276O\340@\355\332R\265Ex\224\254\251P\217\037\264aa\004\301\373\231\021\227\r\301\264:Eqk\204\220\275e\n\230\2744\323\033+B\\\016\f2~b\007\223\227\006zd\234\340\310\006\030\301\271:p#=\320\262\306$\242\204\037\f\223\360\271:\355\333V\255\032\250x\026?A\356m\274N\273\273\277\355\335Ch$S\332\025\265\260l\nuB\372\263\007\370\235{\365\320\217LA(4`w+1\331\235\005'`\224zj\246R\n\243\002\225R\377\006\007\331\232\316\016\021\002JHdew\302\307\241\232:m\325\020u\032$\225\022\311\b\244\356\242\260\273\273\213\021\206\376\364'\370\027\376\214\007"
+	.ascii	"hm\231\302\340\305\230\303\312\316\271\206<u\210\370\272\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_fakeBaroCalculate.7.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375`F\001\305\f"
+	.string	"\266\226SB\020q\233\016\360\030\244\013"
+	.string	"\305\036\n\260S\272\233\030\tF[\2256\217\274\362~\344\310\354\033:\006\n\233s\304<\271\373\324\276\366\326\277\001"
+	.string	"\002(\345.\002"
+	.string	"\030"
+	.string	"\200\360\267+\333\004}\332d\313\224\002B"
+	.string	"="
+	.string	"A"
+	.string	" V\201\312\205\0245v\327\202\037\276}\212\022\324\315?\312;\270\016\344\023\207G\022\013*m8\2240%+F\002\272\021\t\301H\344\341(W\f\235\210\252\205\301\356Z\271N\303m\271\355\215m\007\366+\004\367~\352'\177T\265\252\372"
+	.string	"\006\220\030\200\261\233a%\307\246D\027!l\377b{8\032\\\355\227\270\211\355'\237\023\330\005\275`\261\353%\360\002\352\321\336\013L\217\3241\323\2437[\306\275\325\210\bC'N\301\177$$\030\202\376\247}\004\210ar\216\306\277\243\370\360ML\341\243\347\036\017\017\210\260\321!DWt$*i\001\375\231\"\374'\372TF\364\206\355\201(\f\331\227vw\rAvrz\264k\312\016Gj\0279=Y&g\207r\246\222\233K\302\203)5\311\301\346\005\301\312\246\234\240\231\021,\017\315\305\26123\263\252\312XGNK\303\260i]\274\275\264\020\024g\244\204@\221I=Tx\024\006\037"
+	.ascii	"i\3312co\361\326\264\320 \200\002\344@\300@\n\270\027\006\022"
+	.ascii	"\206>`0b\364(\302\270\337\030\311g\033@\340\320\020\234\020V"
+	.ascii	"\271\006\264\302\030`\016\f\006F\004\250(\343\227\253\320$\320"
+	.ascii	"\016d\001\314\230R(("
+	.text
+	.section	.gnu.lto_fakeBaroSet.8.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"]\t"
+	.string	"f\021@:@\345&\035`\037m\220\230\323\234`\316xABj}32\273|\317tqB\333\220\356\307\337\310vS>\235\026\013\037\bv\007J\371\026\345CN\250\2726e?\331d\357\224\002."
+	.string	"."
+	.string	"0"
+	.string	"\005\330\345u\002\354\322\235\035s\220!P\243\2412\263\2733\202\274;\354\374\237\234\223R\235\016\003\030v\3270\245\342\270\343m'\330v\260-\023\376\367_\367~\210\r\300\030\274\354n\264"
+	.string	",K\266\210\330~\307\376\\\0326\227>\264_r\223\356\236\311\234]\017\022\226\335\365xas\211\360\263\363\355\257\215+\313"
+	.string	",T\304\360\265b\341\361h`\364Q\236b\362C|Q\202O\225\260K\005o\244\003\005[\366w\202\361\303\376\265\273\353\270r\264\222\270\254\322\221\210r\035ZI\333F\353hc\320\207Nd\022\017\225rT\244\325\fbn\225V\204j\304\244\be\242\t\252\333\374|\254\215h\235\234\246\325\020"
+	.ascii	"i\331\"c\317\376\254\341L\202&@\\\2373\022\275\245\r\266\326"
+	.ascii	"5t\025\206\003F\300\270\005jJ\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_fakeBaroDetect.9.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375`\007\002\325\016"
+	.string	"\266YaH\360\262&\035\220\3358\265\323I@\250\302\f\334x\220\3757\304\321W\275'\303\031h\300\265\343@k\240\270\367\r!*UI\3555\022C\305&5\204Y\325n\313\202\257\267\210\202\032\205g7\020\361\271\233\261\215{\023\262S\nH"
+	.string	"H"
+	.string	"R"
+	.string	"\277y\271\200\335\025\216\216\335Q\201\033\204>=~"
+	.string	"\375\f\275\204~\332\366\202\023\223\303\217,\231\273H\201\302%\333\0359\r\306\303\313\320?\316\r\310\210\375"
+	.string	"\321A\301\\\2168\330]K\021\265\342\326n\373\200\355\007\266d\021;\\2\332b\347\216Q?\3475J\37056\341\"/~\372.\364\023A\f\213\246\025t\2223{\204\221\332\013\373\333\356\256\265\225\375\233\177\013p2\312\204\024\200\355\312\314\212\254\317\354\211a\333d\223\330\226\322~\3534L\001;\2671\274\3077sxdA\0328\230\260:<\226\222A\305\003\250{\317\005\025l\344\021`\355\236.\332 \016#\241\250^b\212G\305?j\257<\307\227 \246E\323\372Cj\203\307\021\206v\227\201\177\243\205\004"
+	.ascii	"\240\232\027\3729\202z\331\224\330p\225f`\355T6\217D\336J\367"
+	.ascii	"!\245z,\336\007\326N\205+U\257\205T=p\"H\335\307\215j\211\023"
+	.ascii	"\211\f\216\360*\307\002\202\225\363\270\337V[Y\347!f\330\020"
+	.ascii	"\tr\322N\330\020\"\230H\370\317\204\r3\024\356CB\231yU\370\217"
+	.ascii	"\231\230\262p\037C\304T$ \340\"\221\243n\350n\221\222\006c\311"
+	.ascii	"\334\033mM\344NH\260\t\t\"\031\367\006\2532\016\031\324tT]|\352"
+	.ascii	".\231\021i\330w6\244\303\253[\327\363\201\270\246J>\217'\322"
+	.ascii	"5\241\310\370\320\360\307\020\202`\310\326\271%\336h\310\326"
+	.ascii	"\021_\227x\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 \226\225\002"
+	.string	"\022D\017\031\300\2471U`\373\007\362A\344\345\377\377\177\272\233\210\310\273\221-\367\226;\005\377\267\254%)\334\262\206dp\207\302\364Hi\214\204E\002D\256\245\273\017\363\371\016CJUuH\274\377%\007"
+	.ascii	"p#\214\200\214\341\020\226!\001e\200\0324;\235"
+	.text
+	.section	.gnu.lto_.refs.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375 ?\371\001"
+	.string	";"
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	"\003\002"
+	.string	""
+	.string	"\004\005"
+	.string	"\002\005\001\003\001"
+	.string	"\001\004\002"
+	.string	"\t\006\001\003\001"
+	.string	"\001\004\002"
+	.string	"\002\001\005"
+	.string	"\002\001\006"
+	.string	"\002"
+	.string	"\007"
+	.string	"\002"
+	.string	"\t"
+	.string	"\002\001\n"
+	.string	"\002\001\013"
+	.string	"\002\002\f"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a7f6c2f9a244999f,"e",@progbits
+	.string	"(\265/\375`\253\017\255M"
+	.ascii	"\312\202\254\034UPR\336\244\003nF0\373\341\006\216P\315e\025"
+	.ascii	"\340\201\356\222\324^\375,\211\273$\262\277g\022Iy\353$PB#\214"
+	.ascii	"_k\226\202QH \232Z\017\206PI\201\301\313i9`\357\237\377\301\273"
+	.ascii	"3\314\340\232\266\242\373\327O\033\020\251\312\360q\310\026A"
+	.ascii	"\322\244L\001\177\001\264\001\276\001{\304\232\331\352b\221\370"
+	.ascii	"\226\331\"~\263\253]\273k\017W\231iQa\361\233\003\375\272\030"
+	.ascii	"igg\353b\374JQ\237]1\362\0020\372\fw\305\370\205\242\337\036"
+	.ascii	"\264\3052\205-\030\260m\002\345\204b\361,\204\201Q$SUUB|\301"
+	.ascii	".\306\302G\025P\211:\220\302z\331y\301\307f\004\312\025\304\025"
+	.ascii	"Y\027\037\272|\203\370\211`\254p\247\233\005\247A\223\203\030"
+	.ascii	"\213'[.\377sR\250\001b\004\n\026\377\345\262\265g\310\224)cq"
+	.ascii	"\267vK\355\237\315\332\355x,\276\003z\032\364\225\313\367\212"
+	.ascii	"\020\007\350UD\310\342\ny\263V\353+\\+'\202\361\235^cu\327\025"
+	.ascii	"\212\335\273]\004xv\021\270\351R\262\2432\212\307\200\376[\345"
+	.ascii	"_\340bm\220\346s:[\330]U\360\022\037K\310X\\(\033e\353\273\026"
+	.ascii	"\210\357\224\245\362\234^\355`w\367\354\221/\363\b\213-v\305"
+	.ascii	"(J@\277R^\300\256\033\306\231\262\320\335\215\263\357\032_w\305"
+	.ascii	"H\027\200\221\201\177\205v\350\337\030\377>\360\257\004&\374"
+	.ascii	"\353\300BP\302\2770\226h# \201\305\317;\374\346g&\017\341g\033"
+	.ascii	"N\373\231\206\363\317A\376%\341\337\021\376-\372\367\203\177"
+	.ascii	"=\370\227\203\177k\374\373\342?\230\377^\376#\361?\353T\376\305"
+	.ascii	"\340\337\013\376\265\340\337\n\376\245\340\277\326\377\340\377"
+	.ascii	"\242\377\002\374\017\373?\236\235\235\235\375;\301\317T\377\016"
+	.ascii	"0l\256\260\310Hhc\314p\330U\251E\261:\302\013\t\275\251_\026"
+	.ascii	"\200\221o\3403Pb\260\"5\305E\2662\325\226}\305v\211^wSm\023\373"
+	.ascii	"\304\257\202-\252\205\202\317\035F\371tO\314l,(h\255x\265ib\024"
+	.ascii	"\371\307C\224\260b)&\262\225\317\363\271k\270\211\307T\321\215"
+	.ascii	"\003\033\253\223}\374\203\247W\033H\214\262\016\" (H\307\351"
+	.ascii	"\206!&\025i\340\032\266\362\020\236\001\212e\330aTm %X\020/e"
+	.ascii	"C\030\b\303\300\202\347\333\300\313\2311\312\205\304\313\221"
+	.ascii	"Q<\r\210\f\347\250\232\013[N\216\020\3021\244\200\212\032za\361"
+	.ascii	"4&*\344>\230\354\b3;\032\016r1\261\n\214\020(e\364\314\004=\243"
+	.ascii	"\241\374\203]`\247\035\ng\210\021\033\353n\037\374\264\225\177"
+	.ascii	"p\217\213\265[\270T~\3540j\002\260%\202~\202x\2268\001B!C\305"
+	.ascii	"\036zYa\370\005\346\321\265\232\330\220\256\253/z\346B\317Y\350"
+	.ascii	"\016f\332\312M\334\373\022\261L\374\247vg\351\356?\360\0175q"
+	.ascii	"3\217\005\317WCj\315Xw\375b\375C\334\264Q\354\031\013^\267\224"
+	.ascii	"\222\003\312\220\005\031R\326]\177\202\202p\250\202\220\202d"
+	.ascii	"\024\317P\364g\336yG\223\301\247\205M\275\371\212*\243\204\315"
+	.ascii	"-\323I\202G\213\371\240\313f\315\266\032\260mh\346\224\306\252"
+	.ascii	"\265y\322&\n\026\317L\364k\300\270gk\300\370mC\277d\364\253\004"
+	.ascii	"\375\016WMO\326T\024\037\274\350\246Y'\266.\331\305)g\255\321"
+	.ascii	"vB\302l\001\215=@\343w\013\335\316\242\373\363\204~\255\350\271"
+	.ascii	"\354\2121Z:PG~Q\234E\333\341\004\354\344,\266\222\242K\226\035"
+	.ascii	"\230`\254Z\021gz\370X\274\350\343;v\003\271\251\375\304\333\371"
+	.string	"\336\354\002\375\265\245m\002\377\305\356\031W\335R\234p\202:\331\332\321\360\026\r\324m>\371\202S\246\n_p\327\276*\303\237\n_m\"\003t\220\252}\3654\305\323\344\256\335\233\372u\3574\227|\265\237\272\236\246O\367~>\276\2723}\301\251\337\372\202\347OE\367\332\354\336\216\b\355\235?\037\230\363\347\343\013\356~\276\336\324o\273\236\275d\270\352\224\311\324\301]\255\273\235\252\225\271\323\275{js\b\356\321Sc=Z\252w\370\244Ruw\267)4S\344\314\251\274\036\372\256N\025\230\272\315t\017\b\3145\233\232gn7S}\352\346\235'D\235[\246\351\251k\335\3339\361\212\234;L\274\263\251\257\210\354\317\027,r\016u\261\022\264j^5\327\252\315L=\321\240Y[\230\246\026\254\212r\232\302J\266\314\210\";\200\b\353\371A\212\031\024\225k\245\232\220\235IqA{\\X\260\242\034J\212\"\302"
+	.ascii	"O\026\031\353g\347+\212\231\231\206Zq\023\356\201\257\230\007"
+	.ascii	"\336\201\231\360\017\354\204\237\260\017[\031\270[\3169\260\221"
+	.ascii	"!\214\370B\004p\321\254\220\307\254\375\203h\213T\023\006\356"
+	.ascii	"\030\343`\202pE\252I\026\2570V_b\266\213*\314j\314\020\354\353"
+	.ascii	"\013\2303g\340*\261I\354\320\310\005X[c\233E\313v}\0213\006\270"
+	.ascii	"d6\214\227\020cX\200|\204\227\214\221j\022D\373M\321z\362#\262"
+	.ascii	"\016e\236\252\250\271b%\234\244\226\0256\303\216\253\316Iv\324"
+	.ascii	"0\005\245\021Y\2223xJ\262H\207\304\351\312\033\216\\\312A\206"
+	.ascii	"@\342t6vT\224$\215\243\033\tB\317_\024)\341n\031\324n\204\204"
+	.ascii	"#\223\310\024\350!\210\321@\214\bX\300)\257\302\013\005d\004"
+	.ascii	"@\2267\034:#\0347\243\2342gCZ*B\201\234a\253a\243H\2074J\272"
+	.ascii	"\225\271$$Z\332<"
+	.string	"\250!&!\331H\312\031\215HK9Z\316&\203\250\206\216\f\242\0329\243\021\021\022\355*\274\310\351\b\270\322\022\211\023*\225\224pB:9\033\007G>8\262\314\335r\214\245-\002\234\\\216\304\035\035\335pH\0357\034E\272\245\034Tg\2439\033i\204\244\203\234\221\323\335\320!m\344R\013!\344t7r\310\245\026\312\234\356\006\216\016\362(\247\2731\332\216\310$\244\0339\224\214j\245\216\226\266\030Ce\022\222\216\266p\303A\036\331\226t\264,\313%\017j\270[\231\243K:\333\321\215\304\341\340J\033FI:\rJ\222\006O\316\246\203\234\221\263\244\263\225d\n#\016%\245\fl7\245\215\350\2012\t\t\347CC2Z\210\320\001\rj\364\202\\\341\206\202\rG\226d\016%\334\355\206P\016G\352@\302\035\t%!\335r\b\031\341rB/\032\b\243U3\023\302\311\f\030-8\24701,\202\201\261\226"
+	.string	"\2304\007I\322\204%\244\253\213\277\354V\024\020]\003\344\262\341\353\374\245\007\252\3620c\221\27568\376\250M\214\005G$\256\2104\261\370\033\036\\\\\033|N\367\024\026\2535]\266r\227\r\212\265\177)\\8\237z\201\213h\266\2668\211\222\363\t\350b\030\026,\254\345\005\253,g-)\304\b1rE\304B\317T8x\256\362\277\nk\321\356\30692\034\242\254\254\243`"
+	.ascii	"\372Yx\016\201@\250\221,\251\0244\"3\"\"\222$I:Q\005\204\030"
+	.ascii	")!\254\016\022\240%=\217:jd&I\241\306\264\035^\024\317\344|:"
+	.ascii	"\230\252\264\013\347:\n\001\233v\350\303\255;U\320D\2676\352"
+	.ascii	"\316\354\201\300iNC\302h\253C\fi\370\035\244\035}z4,\222ztWy"
+	.ascii	"\232@3\340\223T\324d\022)\324(\250\307\bRu\233\023>\201\262\030"
+	.ascii	"\376n7\3371W\236\252W\334 \360\2551\261\260g\375\267\0167)$\001"
+	.ascii	"V\203\346\351\220km\306\325\273Q>#\020"
+	.string	"\262\252\273\b\034%y^\372\326w\214&a\003\236\273\370>"
+	.string	"0\315b5\024E5C\305\255\215\347\203\346MNQX\242\332\277=\367\016k\331\253S\020\340\020\252\344\332\266\342\324\204\2768\312\312LU\230\325\\\206\031\235\370AT\027\277\234\b\022\307\274T\222\376~\354\230\251J\377\237s}bz\244.\246N~g3\324\033\"2\324h[\024"
+	.string	"\342\232O\315\032\004\265\246x\233\263=l\301\262\357\240\20169\234j\355\320\201\237\376`\027\250\232\237\350\341\313\024\273\304e&\247\302\262>\017\031\372 @\nM\202\343\247S(\277\0020CeM\204\376\262;\333\340\274\342\332\350r\344\021,"
+	.ascii	"\225m\177\345\201\0324?\f;6\320\231\367\235\220Q\261\3204v\213"
+	.ascii	"\247FN\374\363C\030\021\243\b\343P\251tF@\212\230*\n\005\245"
+	.ascii	"2^\t\327 \200\025\214g\241\232u\334I\212\330\026\250\304A\002"
+	.ascii	"\264\354\206b+LJ\367I\037l\315\215\342\217\300D\302P$\315\354"
+	.ascii	"\332\241\320\262\326\352\r\223\2329\333\340\270\231muz\374Wy"
+	.ascii	"\305\304\306\232))\365\t\236s\255\225\005\322\0260w)\311<$\335"
+	.ascii	"\022{p-?N&e1t\324\215o\317\265\022\316IR\262\2079\255\\\024>"
+	.ascii	"\322E#}\214\006\200\262\303\362\200C2\026\b0\213Qyfc\204F\326"
+	.ascii	"\241k`FrZ\013J\237\274\023\234(<aE\032\\ \232\276-VI\321\321"
+	.ascii	"\342n\004\024O\331\322\227\346\202P\037\253\325\0055\2011\305"
+	.ascii	"U\023\214&\2075\366\263gy\267\3147\022\316L\276\350{;\256\226"
+	.ascii	"\006\001\310\260x\032T\016\"\256\337<\035\370L}\347\366\367\317"
+	.ascii	"\275\273` `\004\346&\205\327\304\363\355\n\353\302=\351w\242"
+	.ascii	"%}H\030nx\270\272\226\353\202\005\274\205\002;\257\352{\342\251"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symtab.a7f6c2f9a244999f,"e",@progbits
+	.string	"fakeBaroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"fakeBaroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a7f6c2f9a244999f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
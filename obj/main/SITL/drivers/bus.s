@@ -0,0 +1,334 @@
+	.file	"bus.c"
+	.section	.gnu.lto_.profile.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 8m\001"
+	.string	"$\002,"
+	.string	"\006"
+	.string	"\265\230\240\355\006"
+	.string	"\001\002\374\337\303\241\005"
+	.string	"\003\004\267\335\335\337\n"
+	.string	"\005\267\335\335\337\n"
+	.string	""
+	.string	"\003"
+	.ascii	"`p\225q6\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 h\225\001"
+	.string	"\350\\"
+	.string	"\006"
+	.string	"\003"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\004\003\003\004\002\020"
+	.string	"\007\003\005\002\003"
+	.string	"\b"
+	.string	"AQ\001\027\266\351q%\007P`\231\202w\314\303"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 \346\315\001"
+	.string	"4\002\332"
+	.string	"\006"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005"
+	.string	"\b"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.ascii	"R8\212\306\346\272\334\304c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 h\245\001"
+	.string	"\024\002\\"
+	.string	"\006"
+	.string	"\003\001\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\002\001"
+	.string	"\002\001\001\002\004\001\002"
+	.string	"\002\001\003\004\002\003\005\001"
+	.string	"\006"
+	.ascii	".\005\037E`\233\236\236\311\2152\345\202\001\026"
+	.text
+	.section	.gnu.lto_.pureconst.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 \\-\001"
+	.string	"\210P"
+	.string	"\006"
+	.string	"\003\002\002\002"
+	.string	"\001\002\004\002\003"
+	.string	"\005"
+	.string	"\b"
+	.string	"I\031\001y\300\npnLc`\362\013\262\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.488b7a92bca30fc8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busWriteRegister.7.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\025\b"
+	.string	"B\31777Po\322\001\240\230\206\bJR\250\033\031Z\032J\305\0022L-\024\356s\353\206 \272\355\326\226!K>$jWf\246\034\307\346\257\023JQ\301\345\203\226\021B\266L)\031(\323\254\207MB\321\246u!\016\346\316\246\013qb'7\221Gj\021\302\223}bGvqS`.b\223\021\304q2f\346\376\303\f&`\311\236$\205\033\366\255\335]C\224\375\324\257\360c\"\321\254v/V/\253r\241t\330\366\354\214\0352z\300\226T\026\013\226~\216\fw3\\\242\252\375\217\203xOI\\`\027\225r\262;\023\214\200\371\345\371\001\354\027\346\032\354\227m+0x\376\b( K\3124\322\262;#\344\370w\375\374\213\\5<T+%'\322\025\300aw\255\025'\214\033\336\366\201\355\006\333&\001\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busWriteRegisterStart.8.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"%\b"
+	.string	"RO88@\217\322\001\233\376"
+	.string	"\"W*\250%\372\033\353`\235\251\030\206\230b\221\016\374\321\220\327\375\277\255\303\357\343\221\226\252\212\342\t\324\004X\0061\234\032\"\270\372\221\020\"wJ\001\032H\333.\tN\252\210\333\274P'\263\207\343\205:\321\223\234\350#\267H\361\321&\242Gz\221s\340\256\202\223\021\324u2n\346\376\313\020.\324d\317\022T\017\373\327\356\256Ue\177\365C\325\324\211U\300\332\325\230\211Y\025\f\005\3046\311\336\330#\243\007\254i\205\303\341\202\237#\353nJ&Bh?\344\"\244\257,.\260\253J9\331\235\f^\320\034\363<AvL\363\201\354\230m7<\220\374\031`h\213\313\251\004fwF\375\370w\370\371'y\302K\253\203\305\004U:\004\210\330]\303\f\324\306\255\267\255`\033\302v+\r"
+	.ascii	"2\003\202\341\243\302v\025P\\ST&@P\"\030\341\023\370\300\367"
+	.ascii	"\300\334\001T\234\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegisterBuffer.9.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"%\t"
+	.string	"\206\320>:0\345(\035F8\034\257s\231\205\354\341\305\270W\024n(V;\245q\2356\361\272a\037|\3777\300\327\3267\244eRP\320B\346\311\364\022\241\220`\2611\035m$\204\354\235R,"
+	.string	"."
+	.string	"-"
+	.string	"\017'\207\257.\325Y\256\r\330l\267N\031\362\3601\364\017{\202,\306\212\245\254P\217\001\023\273\353\310\261\352\270\345m+\330\226\260\r\023\244\202\315j\234x8h\361\325d\271\373\001`\306h\237\344%\247\2770.\260\333jY\331\255\f^\310|s=\001\367-\363\001\356\233m7\004\b\0312eWT\224 \366\265\335]\313\226\375\327\037e\304\316d\007*\273\252"
+	.string	"1\353\262\261\210\330>\331\032\033\305\364\315\246^F 6\223\024\243O\350\253\340\272Q\347i\237\217\312\322\347\201\244\016g\017\007$u&H\277\022\210z3\004\352,\246\207\202\223c`\321\305G\347H$\242SS\367!\027\020"
+	.ascii	"2\003\202\341\243\302v\025P\\S\222&@P\"\030\001\341nU\030\f\363"
+	.ascii	"\211v\340+\301H\002T\230\3275\311"
+	.text
+	.section	.gnu.lto_busReadRegisterBufferStart.10.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"%\t"
+	.string	"&P>;0\345(\035\200\223\001S\333\320\300\241\217\3725\\\342\007L\206\305\244\001\365Q\024V\033\366\241k\277\001\360\344k\206\264L\n\240TM8\231^\"\024BvmM\337jB\310\336)\005,"
+	.string	"-"
+	.string	"-"
+	.string	"&\207\257#\251\203\270p\264b\273uJ\221\207\217\241\377\326\023fZ/\030\213\352\364\030 \261\273\216\035\252\217[\336\266\202\355\b\3331\001\234\335P!q\310\342+\3069\213zy\314\030\355\233\374\304tV\306\005vW0\256\335\312\340\005\3155\327\023l\3274\037\330\256\331v\303C\0177\004\r\211\262\353)\312\020\373\331\356\256\345\312>\353\217r\302\025\2239\200\355\246\002"
+	.string	"\330\027\255\245\304\266\311\336\330+(\020Z\n\251 \024#\220\310\253\330\270\021\327e \217\312\222\327\201$\317\346O\007$y&H\275R\210vS\024\342,\346\207\202\263c\340\357\302\243s\364}tn\352\006\021"
+	.string	"2\003\202\341\243\302v\025P\\S\222&@P\004\214\003\303@\020[\025\006\303|\242\035\370J0\222"
+	.ascii	"\025\346uM2"
+	.text
+	.section	.gnu.lto_busBusy.11.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\215\007"
+	.string	"\262\01654`o\032\003\024B\026r\b\317i+9\241\257L\330\250]C\222\2348\355\267mA\034\371\305\336v\200\245\216\021\006\206g\241\264\373PB\001\202\337\306$\2222\245\362\222\322\202#\013\204\211<U?\035L\344\211\230\264F!\t\212\023\241\b\211\370\221X\354\024\364\242\260d\254\270.\0319\363\326*\003\214\227\321N\222{[k\200\377\357;\265N\331\356A\314\231\030\205\224\277TCs\027\270\"\3226k9m\337\264x\033n\203A\261D\347Z\243L\2229ua\201\377t\242\362\317\205&l\f;MP\031n<P\031\266-\203CV\3153\244\344\315C\303d\346\237\361\201X\263\323j\227\370@\246\345\343\005\305D\262\013x\370_\307a\352p\237\333\"\264mh;\022\n"
+	.ascii	"2\003\202\341\243\302v\025P\\S&&DP\022\234$@\231y\265\223\f"
+	.text
+	.section	.gnu.lto_busReadRegister.12.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"]\007"
+	.string	"\022\31623`o\032\003\340\232\213x*\250\235\250BL\273\0277\275IB\372\301`\243I\233<\362\213\275\255\037\226:c\030\030F\241\365K\321D\001\202\337\206\366\2202\245\021Vt \253\203}6\257\034\r\366\331@,Z O\354\300\t\017\204\004\344D\fj\nzQX\021V\\W\204\231y\313gp\3410\332\031j\256\324\032\340\377\353Hm{\3308\275(\244~Q\n\365\225*\005\244m\326f\332\272\346)\353\376\016\024l\255\365\210I2\233,,\360\223TP\376\271\320\004\214\253N\023<W\030\017<Wm\310*=?D\257d\31209\375\023:\017K7Y\273\304\007\"-,.'\243\220[\200\303\3776\215\021\207\353\334\026\241-C\333\220\013"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\"\026\347\b\367\300\\\001"
+	.ascii	"\215\262\021\002\277\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 \226\335\001"
+	.string	"\244\002\222"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006\n\177\007\013\177\b\f\177\t"
+	.string	"\006"
+	.ascii	"\200\036\340\033\340\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.488b7a92bca30fc8,"e",@progbits
+	.string	"(\265/\375`H\n\3357"
+	.ascii	"\212b\310\025E`^R\007w\307\242\222\f\007\264\363z\363\205w\235"
+	.ascii	">\263\373UO\301\302"
+	.string	"\306\032\223\210\270R\037Kk\235\340\245B\343\225K\251\034\007\231\344\205x\241\341\226\230\3446\250\017\320Q(f\013\331\361\216\227\334\335V\246\024.\001K\001B\001Xm\347\3128|]fmW\222\333\241\371\214\243q\251\243\271\231v0\277\322E\357\277\330\377\367\205\356#4'\343g\n\222\256\322\021=q\377o\273\225\356\243n\244\f\216\346b\274LA\362\377\b\027\2035\261\035ut\377oQ0\350\323*\303\322dU{F\356\366\263n\257\342V\274\f\317\255z~\330\377K\304#\342\206\341\363\366\3148\331\270\260*u3\367\362~\321\317\215\352\341\260\332N\331\307|\214K\0278Y#eh\336Q\313[\371\177\001\b\331Q\261\333\203\325~\221\333\027\254~\347\013\326f\221\273Dn\020\331\213\222\274\013\200.\320+_X\355\t\331\265\370\026\227:\227n\307\342o\253Z\236\037\375\177\205xH!i\306\260\332\036\355"
+	.string	"k\237\241\201r{\204\025\200GX\033\347\006N`U]\300\352\357\004V\340\353\004\326\354\002\326\017\t\324n\254\241"
+	.ascii	"\205\001k7\226 \224\240\273Yt\257\033\033\350\366\006\335\236"
+	.ascii	"\240\333\013t\373\200n\027\352\366_\267{w\363\351n\262\356\336"
+	.ascii	"\323\335@\335\235\326\335\276\273\273\273\273\356V\353v\257\356"
+	.ascii	"\274$\377\316\242\345_\035\311\244\376q\230\333\230\246\033\315"
+	.ascii	"z\036\221q\211v\375\216\367\350]\337\006e\346\3501\313W\331\311"
+	.ascii	"]M+9\214\304\357\253r\226\025\206U\374\330\357\360\261\361\273"
+	.ascii	"]\220\022\277\372\217tw0\344\356\240W\206\013\271eU\033\177\237"
+	.ascii	"\2626i\252\222\316g\0176\202\034\203\202U=\257\022\177a\305\361"
+	.ascii	"r'\217\323\271\324\353\334K\373\027\007\243\374\377:\317\342"
+	.ascii	"aM\017cu.\346s>u\002_\t\327'.\030t.gvr\253\372\306\345\344t\335"
+	.ascii	"q;\216\307\245>\327>\347a\034m\350H\364\257\204O\327\234\247"
+	.ascii	"9\333\220\362\375\037It\037<\020\f\376\252\266\260\216Y\215\363"
+	.ascii	":.u9\247\343\346p>u\276\377\243\210F\325E'\347p<\216\202\244"
+	.ascii	"K\302\354-.\223ib\306\244\r\256}\216\320\324\230\0248o.\007("
+	.ascii	"\210sj\246\226\337\332{D\321\221F&\267K{\216\2675\234\352DM\b"
+	.ascii	"\230\230\334\336%\267o\311\316\346j\316\306\247a\"\324\300\305"
+	.ascii	"\375\177\033w\343Rg\363\265V\337\3770\177\331|\352\354\200F'"
+	.ascii	"X\024\034\202\"\245\n\330\252\266O\311\352\024e\2274X\3654\256"
+	.ascii	"\306\245>\3655/$\004\207U\306+A\314v\274\311Y.1\217\3742\240"
+	.ascii	"cE\367\365\233\342\265\206\314Yn\234\304\312\306:\032\353\300"
+	.ascii	"<\334\371<\267+Vtt\357\274\212\320\023C\326\254B\325\230\007"
+	.ascii	"\376\240\177+\377\257 (\214\231\032\024\253x"
+	.string	"\007\236\312M\250\027\037S\330\rZ\233\263\346\213\036)I4ZX\305R@ot\322\312\260\332s^\326\335?\275,<r\260\223\334\270{}$\363\377\177\364\336g&\203\326no\357\271G\350\026r\236?x^CX\362\277\325v'K\031C\032\301\r\276\277\376\217D\377>\323\215B\217\256t\255I\364~\022\003\037\325z\367\2056\325\347\343\177\337_\tm\332p\337'\323}\237G\340+\237\307\377\267\tt\303\220Gw\243\320\246\033}6\211^\371\307\217\"\223d\345\263\351\252=\233@7\212l\272Jh\223H\253\215\211\023*%Z\302\234\215\253\374\036\313+$\0238u\337\347\267\375{\230\3243\037\374_=\231m\310!>&9\355\221\024C>\375\3002\231\365|\345\324\365z\376{%e\374\022\303\361\235>\023\237\036\265\256\276J\352\037\301\277\377\313\377\243\377\364\377\217\377\357c^\275\377E\200n\327r\031"
+	.ascii	"r\264F\020\b\210,\f\030F\020NK\254\212\"q\251\270\202@7\rc\260"
+	.ascii	"*\330\342\220\350\24252\001\273iHd\237\330\030\2711$QH\332\200"
+	.ascii	"\303\327\0338X\340`a\355\r\034\216\2168$\035\345N:\342\321\200"
+	.ascii	"\202\002!\354\025[\3410j\005\fV\204P)\305\212\037\333\364\264"
+	.ascii	"Tl\237\206\271(D\241\244>\rS<\265M\3530\252\345\265\302\020H"
+	.ascii	"J\277\020HJ?k\023\322\220\3272\0164T\024K4*BA\021\215~\255\320"
+	.ascii	"\204\023\220\310\026\333\245\032kQ\270\241\37044\372\332\226"
+	.ascii	"%:9-\371\330\033K4V\030\243jd\243\360\006\353\324\032\231r+d"
+	.ascii	"\233\2067X\021\255\221\351\307\n\331\250\034,Z#\323O\037\035"
+	.ascii	"\205h\320\342\304\210\334T\24152\031\265D\366\306\220\350d\364"
+	.ascii	"4\\\252a\324Dl\215*\024\261Q9\212\255\221\311\327XX\370\371>"
+	.ascii	"\326-\237\225S\r\027\222\306O/\363\275tp\336`\025\037\301S?m"
+	.ascii	"\334)\331\226\323\211\215\270q\366t\334\301\311*\322\330\310"
+	.ascii	"\317\231c\335\026V1\021<\225\337\356\236\364\301H\256\227\n\017"
+	.ascii	"\226\020!i\031,N\032\006\253\315C\372\360\201\201\264YbE\367"
+	.ascii	"\365\223Z\"\346f\325\030\b\020\024;\260\037xj\311\343M\026\254"
+	.ascii	"\342\246\227\r\2615\261\364`\0253\275O/\200\272\250\2010\207"
+	.ascii	"\2304#2#\301H\222"
+	.string	"\202$\007\220\002\221)2\333\021`\255rJhD4\005I\n\035F\363tD\251\013\331\344\341nz\260N\024\267*$\225\345\301\331\245BF+\017uU\277Q\257\235\007\372O\214\260\025\352B\013\020\251f\0370.\226\263\016\275~\230\247\234\221\235\225\214\344g\032SJ\260Q\013.\024\330\2426\340bB\f\200@V\255\256\325\026$\265\230r\006\007\036\204\220{\246R\026\221.\215mO\304}v\305e\311g\022\030\253\373\204Z\006\b:\321X\036YL\375`\376\313_\312~\212\314\314\342\006\270\245\306\255I\357\315\226\341\301\023\177\311\260\224\313\f\363$\360U\311\3237\021\244\355\332i$U\360u\257\334\310\256\017\340>\240\247/\216\324\327\246\351\n\005;\251\025\033\357D \023\271\262\371Am#V\264\356\263\r:\303\020\327\013\361\"\240\211\347y\247$[7\312@\001\370P\321\3412\221\233\255g5*\006#\250"
+	.ascii	"\026#\340\325\023uR\225\261\250\021e\217!Q8\314\232\032\324)"
+	.ascii	"\260\315yX\245\007ZA\265\024\3007J$\375\371sH\254b\3776J\345"
+	.ascii	"\370\203\225\334\0019\216\344\203i\274\363Qy+9TV\200\350~\344"
+	.ascii	"l\347\236~\003Mo`&\217KI\364>\200\272\201&\312\343c7i\216(\177"
+	.ascii	"\023\256u\345:4\003{\306\336-\036\201k\356\370.vr'-\311p\235"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_.symtab.488b7a92bca30fc8,"e",@progbits
+	.string	"busWriteRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"busWriteRegisterStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"busReadRegisterBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"busReadRegisterBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"busBusy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"busReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.488b7a92bca30fc8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
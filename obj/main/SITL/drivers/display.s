@@ -0,0 +1,664 @@
+	.file	"display.c"
+	.section	.gnu.lto_.profile.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\004"
+	.string	"\005"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.text
+	.section	.gnu.lto_.icf.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\335\006"
+	.string	"d\n9\001"
+	.string	"\020"
+	.string	"\365\212\240\317\007\f\002"
+	.string	"\002\001\002\002\002\003\002\004\002\001\005\002\001\002\006\002\001\001\312\337\356\336\007\004\252\343\367\225\007\002\b\002\003\003\350\323\206\206\f\006\004\260\272\342N\b\005\266\302\343\367\n\006\006\222\362\332\376\004\002\002\006\002\007\007\340\337\203\343\005\004\002\t\002\001\b\231\337\216\304\r\b\n\002\003\t\256\332\234\316\013\002\003\n\301\343\227\272\003\007\002\f\002\003\013\336\365\267\361\r\f\002\003\f\366\332\246\320\b\004\r\212\251\337\324\017\r\002\003\016\322\317\311\210\n\007\002\016\002\003\017\251\353\254\255\016\f\005\002\006\002\001"
+	.string	"\025"
+	.ascii	"\027\273E\312T\002\341\310\034\005\020\004\343c&8:\233\261jA"
+	.ascii	"\346\033\273\265\351\344\2263\203\240\245\2000nE\002\020\326"
+	.ascii	"\313l\204P\252\354\032\323\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\275\003"
+	.string	"\362E\017\024\240'\351\340\377\377\177\253\352\207\336~\277\375\273\221\266\267L)\256\372\204\201!\bL\347g\005L\351X7\225\032\307Oa\221\352)\206\020\264\263)\354\267\322\341'U.\335\354\337-n\b\027"
+	.string	"\370"
+	.ascii	"\301\006 \004\372ph\346}\264\340\320\367\363\250\006\016+\205"
+	.ascii	"\221\250\304\201\205+\b\t0\341\026\224\201\006\334c!\314\205"
+	.ascii	"8\253H\003C\204\223\034\314\213\0130\004"
+	.text
+	.section	.gnu.lto_.inline.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\025\004\335\013"
+	.string	"\346\2203-pi\222\016\274\253\223\341\241\341"
+	.string	"<Lw\240\367\363:E\240\350\016\221h-Jx\376\255\377\337e\250\375\337m\255\277m\2445B\366\336)\""
+	.string	"+"
+	.string	"'"
+	.ascii	"\315O\210\230\266\317\367\244r\277\264\326k$\270q\\|\205m\333"
+	.ascii	"\326\347\211\367}\005Yi\353xi\366\004\007\020\347 \345(\215\203"
+	.ascii	"\b\263\257J\206\213%\242\3358?%\313\366T6Y\321\026:1\rm\2374"
+	.ascii	"\300L[\310\371`\221\004R\001m\344\366g\303\277\212\355H^\323"
+	.ascii	"\002\033\227d\\\003Hq\261L\334\001S+\241\255\302\263\007\236"
+	.ascii	"\203\367\227\311O\240\22103\236B\314\372\232G\360\356\032G\216"
+	.ascii	"\006\304\300h\321\3066\256'd\271\034\332J?O*\353\007hPB\3600"
+	.ascii	"\037\032K\250\321\\\245X\2154)J\232\003\260\002!\t\214\354\022"
+	.ascii	"\340\303Y\220f\215\300 \024M\374N\334X\230\245\007\275S\301y"
+	.ascii	"\036Ab\267\3379\215|\344\211s\262N\362\366s\272\305\022\222\237"
+	.ascii	"\224a8\016\256\r\335s\022\247\377\234N\005\355\233\361\037\037"
+	.ascii	"\352\266\333\246\346\303\0045yG\330d\276P\210Z\206@\200\030Q"
+	.ascii	"\372\\\345-\360 d\200x\334\244q\210\252UF \276\314\022\363h\375"
+	.ascii	"zT\232)\200\332\\\316\r\246\267N\225\350\320\315\225Y&)\344\267"
+	.ascii	"\245\246\025\277v\340=\352\013\320,\356\f)\316\361\365\356\200"
+	.ascii	"\300\275N@\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`%\001\355\004"
+	.string	"\202\206\024\036\240'\351\377\377\017\300\252\252\242HUU\201\363\277_7l/\353\267\377\377\233\254\335[&\031\333\301\230\212\344\231\0346\024\bg\260\264\021,\275\031\031\265\230 \177\374\027\242\260\n;\333\370\351\234\300\200\032\035N\377\322\255,f\027\363^\213\263\364C\214\213! \340B*\355\033A\f\335\245\353\205I\241\353$-\254E*\257W7n,\250\n@\035 \337@x\313\b\343C"
+	.ascii	"\344\3004\300,r\253\344\034Z\215\353\022\344\205\331\335 \033"
+	.ascii	"+&\226d\021X\346\365\305\320>)\224\033"
+	.text
+	.section	.gnu.lto_.pureconst.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\001\231\004\002\231\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\231\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\025\002\325\007"
+	.string	"2\311\034$\200\265I\007\273\037\214"
+	.string	"#\025\0010\001gtd\204\311JS\364\343\267\341\265p\355\337\376\377\276\331\277\267L\001+\201\201"
+	.string	"\344\225\252t\267\304\256\304J\315\025\272\355]Tb"
+	.ascii	"\304_\3459<\206\037-(\220\243xf\243\304F\323\021\034\353jRdp"
+	.ascii	"\013\256\261Xw\254\206\3305b\247\346f\254_\205u\206e\226`a\257"
+	.ascii	"\327\367~f3f\347\311\337\005A\250qaU4\332;\240\"\232\252\352"
+	.ascii	"\022\240r\251\212h\214\362\316LL\345\272\177\007e\322\004\326"
+	.ascii	"JD\226cjq\266\302\031\266ag\201\310EFA\241W\321=-\322\254\300"
+	.ascii	"\300\245\342{|c\212\300\3035?\371\rOB\204\034\356\272\302Y\310"
+	.ascii	"1\"\215\236\357n\3361N\204u\t\312\270\317\035\225\022\242\352"
+	.ascii	"t\363`\n\005\251\"\033\004,\264@\340ey\\,\313\016\217\201|g\377"
+	.ascii	"nVLV/j\245\207\251"
+	.text
+	.section	.gnu.lto_.lto.29ecbe4fdcfa021f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.3.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\b\001\035\f"
+	.string	"v\326P@ o\233\016\240(\360\002\020\020)e#\216~\321\275\303\226\0011q\2362|H\"\001\227\0314\373z\363\351\260\321e}G\316\235\"\f\200\b\200"
+	.string	"\026\345}\200"
+	.string	"v_V\365\341\"qw\223;\245="
+	.string	":"
+	.string	"B"
+	.string	"\234\023\330\355V\244\330\375\030x\301\364\350\357\007\344\343\364\002\362\321\234\375\"\001\006\001\037\033 $\273;\325\303\271C\316\377\307\001\2008:\207\031\016v\327\020\304\261\341\326\333V`\273\201}/\321\347\310\307\353]t!\017\221\007\226\330_\007\252g_\332\335\265v\366E\277\224\240%\tZ\025\032B\350S\0176F\006F\273\032Jb\254HT\001\202\262}h\277\343\036\334E\001\323#\031\2214d"
+	.string	"\213\203`\374\230T\225TOd\b}\"|\204\251N<\021\001\240TC5\325AC;\266/\007\311\246]\215\212_\342\302\204\215|\204\212\240\205\267\223\330L\273[\361Gh\024\246\017\017\227\205\2514\033\006\233lQ,T\0222\033f\231\233vU\3004\313\304`\325eZ\3326)\023g\231K\233\232,\323&\365\355\245\325\316\221\203\210G?\346^I\033\302QT!!B\035#\227\264\255\233\270\002\030"
+	.string	"2\241\367/0<\210&\270\345\203h%\f\334\250$E\005\202\300\2462M\252t\253\262\017\215\264"
+	.ascii	"\301\324\247\025\203pJm\256\351,b&\214\002\263.a5\253\321\341"
+	.ascii	"\016/\332I\006"
+	.text
+	.section	.gnu.lto_displayDrawScreen.4.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"E\t"
+	.string	"6\022B;@\305(\035\240\336\372?\217\257\271d\200\341\204D\232\224\345|\257Nv\233\362^\036\355\243\254\236\024}\250\215\202\266\372\255\035\303\314\220cpE\326\361@\365\n\362\230 \262\311\226)\005/"
+	.string	"."
+	.string	"2"
+	.string	"\016o\311.\265\027d\227\006\355\224\203\212\201\226\005\013\300\356\316\310q\360\n\372\017y\345\204\"]\005\030v\327zBa\334\361\266\021l/\330\026\020\366\261\335]\307\224\375\325\217E\265\252\372\331\266a)\331\275x\rX\227<\351\330l_\355\177\034\004\374jt\202\335T\313d7Tp\202v\031\321[\206)\222lwg=h\273\246\214O2\361\211\262K\215\006(\206\370\210(\343\213\204\"\264\335\275\352\322\037e\227\217\027U\200UI_vH\322\250\021\235\215G\003\372<\234\346\rFB\323\360\3718\316\374\274N\210\3638\323\303i\034\346\306\373&\346\342\356\323\361&\250\353\274\271\205{lc\312\322\303U\212\024\256(\026\255\001\013"
+	.ascii	"2\2417\034\330\270\360\224\332|\251\321i\t\217`\312%\330f5%\334"
+	.ascii	"\341E;\311"
+	.text
+	.section	.gnu.lto_displayScreenSize.5.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\225\t"
+	.string	"\246RC<@\305(\035\340\345\352\347w\200M;\230\335\305\020f\017\353\366\342\250\223\335\246\274\227G\373(\303\260\354Cm\254\221\255~k\307\314\304\246D \305\210,HT\257\340i\322\366&[\246\0242"
+	.string	"/"
+	.string	"2"
+	.string	"&\240\375\022\241\201\211\2706Z\004vw\323<3/\261\027\314\313\br\360\n\372GyBk@Je\272b v\327\232Ru\334\361\266\025l7\330\037\b\341\217E\265\252\372\030M@&\300.\307\253\300\002\220.$\266A[\263}\265\317\372\t\370\260t\202\335\225\253e7d\360Bv\3510\263\355\227<\036\250h\262-q\026\320\nFw1/5\"\230\342*_\266\213r\360SH\025\331\310\245_\232\227\217\006!\254\223\276\354\320\244\361\303>\266qec\352\371\237N\2103\372B\\\346\316\306\2023!\3728\317\366y\037\022\347y\266\020\307\001m\035\357\3336\007\356D\037o\033u\235\267i\341\336\236Qs\212\031\326\024\213\3268\343C\r"
+	.ascii	"2\003\3020\005&d\220\035\330\233\322\\q\3062\327\360\207,^\003"
+	.ascii	"&\036\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.6.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`/\001\225\f"
+	.string	"v\327SA\020q\233\016"
+	.string	"KX\005\3144\234\213#\\"
+	.string	"\377E\266\346\2328\212\\+\002^\006\370}\002\243\351\021\361W\030\025\266\030\266\240\021\273\252\252*\337!}\336r\215\032\344\231\377qM\266v\333\335\244L)@"
+	.string	":"
+	.string	"E"
+	.string	"%\270\213D^`7\224\342b\267\323xA\374s\367\003\360/\336"
+	.string	"\3743g\323@\200!\300\312\007\305\306\356V\372\341\334\223\363o\342"
+	.string	"@&\236\347\324`w\235 \223\r\267\336\266\002\333\f\354\263\b\177\327\214\b\026\321H\216\354\316\223\352\301\276\264\273k\r\331\027\375\027)\035_zzi(\245\237\246\245L\253\2463\323\037 @\006\006\306\256\206\321\215Uy/BP\266\237\366I<$9\362S\250\232O\213\365\025\327\323\004',\222\203\247T\310$\025\252\231\223\021T^\324\251\246:\224\250\3076\204\243x\304\335\022\016?\305\205,\004\376\245bV,\341(B\342\356r\370'\036l\021\304\237/\002\003\227\325\341\200l\035,\332\332X\340D\370\330\260\216j\323.\n\230\326Qu0\216Gei[\265\3118\373\270\264\n$\313\264\212\352\366\322j\310/\206\312\210\2228j\213\213\300\214\203jL\032\365\237\226\177\002\204:\3513p\b\032"
+	.string	"2\241+h`<\020\022\001gl\343;\344p\231\0011\266\201\201"
+	.ascii	"\257`3\330\216\n\245\021E\b\360\323\202\tSI\013\206\353\224\332"
+	.ascii	"\334\322Y|&4\001\306\\\202mVS\302\035^\264\223\f"
+	.text
+	.section	.gnu.lto_displayRelease.7.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"u\013"
+	.string	"&VN>@O\223\016w\303\374\027\001\335]1\363\217\236l\342\312'\020\020,Q\234C\274i\375\377[d/\301\243A\261\021\325\211GZ\3221L\3149f\310\311\277p\217\241\354\262\262\307\336D\312\224\002<"
+	.string	"8"
+	.string	">"
+	.string	"\037\260\033J\261b\227\233xA\3743\367\002\360/\236"
+	.string	"\374\363f\277@`A\300\307\247\343cw)\355\360\355\271\371\027\361"
+	.string	" \016\317\023@\203\335u\20282\334z\333\nl3\260\277\tW\211\b\304(#;\233\363\244r\260/\355\356ZC\366G\177\224\322\360\245\337KKRZ5\235\231\376\0241q@\305.\206.\306z<\026\037&\333O\373!.\332>\352\004\372\364\0274hdgUI'\237\220\352'\034\250&\020\201L\031\325\251\2366l\250\307\366\203wd\342\356F\305/Q\001\343\300\277T\003.\034\341$8qw+\376\210K\213\036\376\374\016\374\013\325\345\262l\264\313\212\276P(X h4\013CiY5\301\3120\324eY2\324%\323(\212\304\230\246\312\250\r\206e\324\304\355\245\325\220\037\210G\206j\030*\212H\213\203`<\205\372O\310\273K\200R\024"
+	.ascii	"2\241\213/0.\020\302M\302`$\344p\231\t\004\333`\220\0266\230"
+	.ascii	"JZ0\\\247\324\346\226\316b3\2411\030p\t\241YM\twx\321N2"
+	.text
+	.section	.gnu.lto_displayReleaseAll.8.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\005\n"
+	.string	"V\023F;0\345(\035\236\223\223\324\fth;\254iG\2709F\220|\330\032`\327Z\347\2535\334F\307j\203\321(\264\242\246\177F\004!\302N\221\027UA\"\240\234\334z\311'\233\354\235R2"
+	.string	"3"
+	.string	"8"
+	.string	"f\350N=\276\200;\355N\300\235Z\264e\0204\002\002l\310h\273[\247\310\305K\321?\3127-\227\352R\003\261\273\226-W\307=o{\301\366\203}\205+Y\263G\225\234 \366\267\335]\317\227}\330\277Mi)\245\257q\b9\250\355r\324"
+	.string	"\354\214\276\220pl_\3327\371\211xX\352\003\273/\226\226\335\261!#\001\030\215+F\233\331\310mZNs>XSe\373\273\214\242\333ey\374\030F\210\342N\3454\210q\305UP\335\356z\374\224\223E7r\352\247\270\323\317\351\022+\201\005\"\020\351c\nI^gP\347\342#Q\n\275P\rA\321\311\003C\225\344}&*\b\fk'\301_I\004V\323\367\201\2253\356\267\235/Gx\314V3\303\376\210\263\275\257\004\016"
+	.ascii	"2\241\003/0<\004-\354&5\237a\260Y\251\0351\035\360d\202 \030"
+	.ascii	"u\t\253Y\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.9.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\365\013"
+	.string	"\006\027TB\020q\224\016\033\002"
+	.string	"\\I\235M\030y\024q\bT&/(_\020\276.\256\030\307B\301\006C\301\242\325\357_\355XH{\007\210lW\005"
+	.string	""
+	.string	"h\006\251\027\3018h\037i{\302\274\230\300\275\267\224)\005C"
+	.string	"@"
+	.string	"@"
+	.string	"\313]:\342\244\303\247I\362o\362\227\002\242\373\330J\207\037\376^\001\021)\036\024\250\214\324\260l\033R\337E\244\305*\300vz\230UI\210\233<A\266\216L"
+	.string	"\021v\327\371\261u\270\343mO\260\355\300>\202\251\351\307hB\205\300\312nH\207ce\300\027%l\217l\213\355L\373(\236bt\225\350\002vQ0Pv9\006\306X\207\346> \036Z\277\304C\333n\360`d\3229\022!\037\341\340qbc\003\232z$'(+\357Z\274\376\004\213\030\266\360\025\232\265{\202\340\253\310p\301\"9\274&\230\2412e\367\\\225\210\270PM\371\242\250*\201\306)o\330\\)5e\377\355\356ZQ\206W\375\372\322\001\235\215G\023\322<\230\345MF\203\206\002H\3038\227\226u0`\031\347\362`\232\n\327&\323\256\214\001\177@\235\354\n}>\331e\341\366o\025\345|\013\236\212y*\210m\250\007L\332\341T\250\367\310a\312.\302\020"
+	.string	"M\204\336\031\341\265Qd\210\3235X"
+	.ascii	";\202\350e4\233\200Z\034N\324.\243\0245~bY\030$\\zU\305\254`"
+	.ascii	"\356\001"
+	.text
+	.section	.gnu.lto_displaySetXY.10.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\305\t"
+	.string	"VRB9@\217\322\001x\255\225DJr\242\t\205q\315B\317/0rh\016\351SNh\326\"\263\\\240~\266\025\320F}\216\243\270\020d\232\3533H6%9\271\216\222\306m\367N)/"
+	.string	"3"
+	.string	"0"
+	.string	"'\330>\271\017l\237\016m\230\327\220\275\214#c\026\263\273T\202<|\f\375\313\016\260b\245\0367\017\273\353\270bm\334\362\266\017l;\330G\bq\263\271Z\nXv5j3K\233+#\266\317\261c\265\006\031\355\005O\370z\262\334\365x\361<\332w\375\025\036\206\272\300n\013Ee\267*8\201\373t\r\322\006\177\"#\245=q\223\023\267\273\f\376\354\242\"\300E\004\265}\316\222\024\222\016U\254\3315\025\345\207}\315\356\256e\313~\354\237\257\277<\354\017\246[<\364\021u%P\344q\376tL]\004\t\364@\024\374B\024\336\007\242\"\257\223\240\237\017\244\035\003\217H\241\217\226F\243\217r\352^\263\262e\210\027M%1<\003\022"
+	.ascii	"2\241\033\034\030.\250\243|\201&4\025\016[\\\r\023\326\270\006"
+	.ascii	"|\303\030P\016\f\006F\360\031\026\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_displayWrite.11.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\204\001\035\017"
+	.string	"F\035fE\360\260(\035\031\211Y\0379\303\272\313\323\377g\264$\351\331\245:3\266\341\366\266#\242/\372;\322!\213\314\2321\374\252\215\300\224\373\265\006Od\023\031\207\257\347\n;\033)\3357\277\277\315f\033!{\023)S\nN"
+	.string	"N"
+	.string	"W"
+	.string	"\"O\373\260\223\360\376\261\274c\367ub\305\356g\300\005\270C\177\234m_\304GxvL\373b\\\327\020\303\252\251\261\273]\350\001\342\241v\217x\250\034\356==\377&\256\201\270\020\243\345R=\267\005\273\353l\271,\334z\333\004l+\260\363#\033\354k\273\273\326\227A\247\3719\376\375\237\317\374\236\333\374\035Mo\232\216\\\032ni-\2465\246\023\246\337\021]\274\020p\263[avcs \316\007\333\236\375\261\255\331L\370"
+	.string	"\355\252D\206\00442\004\232\366\001\021\3573+\326]\230\031\001>\213\024\007\334I<\204:\240\003\314\026\375\346\204\323\024\312\264\b\001\343P{t\025P&f\003\203\252Mz\212\025nwG|\024\020\036"
+	.string	"\220\341\201%\036&\214\026\r\217\376\005\306%g\276\246j\rK\326\2223\177\262\243v\204\222|\353\n\362\022\313Y\251\312\376T\251\001\251\253\234\302I#\223\b%e*q\036\205\250\210$\230\244J$]\nEJ)\241H:SIT\322\215P\251.\004\304'\023\022\252C9\235P\335\347\333k\253/\333\006i\250E]\354\221\035\215\272\351G\r\025\244!\226\252\354\321M\317\222E=\f\226\214\301q\032p\273\253\221\035"
+	.string	"2\241\021\374P\2620`\245\243\322QR\211"
+	.string	"\231\260ERi\200e\216\"\215)\263\327\356\345\233e\236\313\bs\351.\254D\303,^\315r+\024\006\003\003\\\30080\214\317"
+	.ascii	"\300\b\201\n\007w\237T+&a\222\001"
+	.text
+	.section	.gnu.lto_displayWriteChar.12.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`l\001U\016"
+	.string	"\366\332^D\020\257&\035\b\031t\002\226\305\201\204\253\365\326\221\342\027-\350#\200\306\t\203\177\031\241Ty\275\261f1\256\347\216o\232ns\004\330Z\252\252\252\252\235\177\251\271\023\007R\311K0\357\035\315\225\330\275\267\224)\005H"
+	.string	"G"
+	.string	"Q"
+	.ascii	"\334\273\223\003\330U\211A\261\333!\360\001\354\320\035f\333"
+	.ascii	"\027\361\021\234\255\342u\035Z\327\260\262*a\263\273\331\347"
+	.ascii	"\002\342\341{\200x\250\034\316=9\3770"
+	.string	"\177 PV\260Z\250'\247\301\356:Y\255\013\267\336\266\001\333\f\354t\366\374\345\337\270\313\337y\367k\274\345\347h:j\032j\372\305\264\302t\276\364;\242M\213\0010\273\026^3\226\005\234Y\261\315\331\035\373%\303\002\227\323;V\345\202\245@\323N\360\301\275\345d\335M\201\361\361\264\357:\211\242\3178\300v)\200\370)&hX\211\026\360\340J\371\301eJ\260T\310B#\303\325Q{\3441\220\205&\004\006\265I?q\302v\027\3047!\002\201\343\305\207\223x\2305\254\030\251|\371?E\216^K(2\025RT\371\262;T\352\006\373oU%\241\233\\\302E\241\021\210\3044\3220\207<L@\"%\223\026\222\2316Q\004m\013\311F\032h$\013m\246\314\203\200I%\321\226\221\220H[\326\351\366\266G?)U\231#\237B\215\252\241V\365\350g\245(s4\352W7P\277\241O_\263\272\t\037"
+	.string	"2\003\3020\016l d\030\356e\304JG\245\243\004\345\206&XP&l\226Tn`\231\243\250\316T\302\316\206@\326\204\347\032^\2611\372`\001\031&\034(\007\006\003\203"
+	.string	"\234\3010>\003"
+	.ascii	"#\004*\034\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.13.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"M\t"
+	.string	"\206RB8@\217\322\001\230NL\267U \221\026\321\004\364\253\316\324\3210\225\275"
+	.string	"\231\206\366\352\357\242\215\006\2431\0336\352%\035\303\304:\206\tT/\270\211Q\234\271\304\356M\266L)0"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032L>=\354`]\003\274\200\271\354\206[\344\370\351z\362O\362,\004\003e\325B]1\020\273k]\265\\w\274m\004\333\f\366\035\177\226\2515\252\217\301\270X\bb\273\254\330\313\256H\025\020\333&;c[\325\276\310GL\007K\007\330}\265\244\354\206\nN\320.\035^`^j\017\021e;\342\260\317IEG\232\227\032\r<q\223O\333U9\370%#\n\355\343\322/\315\313\307\001\0170\2451;Di\334\260\237\355\356:\276<\017\006\036\016h#\372@\234f\216\206\264\221\b}\\g\373<\317\210\363:\033\210\333|6\216\367m\232\002w!\217\267\211\272\316\3332\341\3363\036\244\242\2053\232Ek\234\361!C\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayIsSynced.14.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"M\t"
+	.string	"\206RB8@\217\322\001\230.\f|,\253<\223T\303\215h"
+	.string	"b?\002\326\335N\351,\376\253\277\2136\032\214\306l\330\250\227t\f\023\353\030&P\275\340\"\324\311\337\022\2737\3312\2450"
+	.string	"0"
+	.string	"1"
+	.string	"\001\363\322\266\027\032NF=\354h]\003\345B\006\263\033r\221\343\250+\312?\311\265\220\327\013\313\225\272f v\327\312ra\334\361\266\021l3\330w\277\246\2515\252\237\311\274Z\b\\v[\263\230e\221* \266O\266\306\266\252}\221\217\234\0363\035`\027\266\222\262\033*8a\273tx\201y\271=1e;\3422\320I\205W\232\227\032\r<q\023p\333]9\370%$\212\355\343\3227\315\313\307\001\217\230Jgv\230\322\270a_\333\335u\204y>\026\237N\2103\002C\335\346\316\246\304\221\020\201\235\207\003\277\017\251\373<\\\250\343\200\270\316\007r\233\002{\242\317\307\215<\357\3434\341\3363\036\250\242\2055\252Ek\234\361!c\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_displayHeartbeat.15.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:0\345(\035\200\213\027\250`\2552\260 0\t\301\272a\2135\361~8(\322\031\255Z\303mt\2546\030\215REM\377\214H\261)\206j; o\355q\204\251\222O6\3312\245/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006\355\227\207\031{\222\225\211\027\200\335\235\021\343\340\025\364\037\362\314\212\205\272b\022v\327\272bU\334\361\266\013l#\330\216\005\317vw\035[\366]\177\026\325\252\352k\030\016\226\315\311.E,\300\302\244\312\206\306\366\325\376\307A\300\273N\017\330m\231\240\354\206\0076\330.\035\006\032\013UD\331\356\376j\330vU\035\277$\3423i\227\032\tZ\354\360\021\323\266\273\035_\244\364\260i\\\372'\355\3621\246\270x\270R\032\263C\224\306\013;\241\217\310C\372D\334\346\017\007\302\2630\3728\320\374\274P\211\363@S\304y\030\346\307\373&g\343n\024\362&\251\353\274\251\t\367\331\306\226\025:`\251(\341\214f\321\032\035\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayResync.16.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"e\t"
+	.string	"\206\322B:@\305(\035\340]\311\355\304\201\220J%\274\016\320\214a\236\361n\235\3546\345\215\317\366QVO\212>\324FA[\375\326\216\021;Q\003\340\212\254c&\274h\257\344\223M\266L)/"
+	.string	"0"
+	.string	"3"
+	.string	"\037\320.\267\013h\227\006m\224\207\031\373\220\222\211\326\312\356\316\210q\360\n\372\367\370%\2452]-\t\273kM\251*\356x\333\005\266\021l\307\002\317vw\035W\366Y\177\026\325\252\352k\026\227IFe\227\"\026`a\222d\003c\373j\237\343\035\340Y\245\007\354\256F\\\273\341\201\r\266K\207\001\030\013T4\331\356\336j\330vQ\033_$\342#i\227\032\tN\354p\020\322\266\273\033\377c\364\260i\\\372%\355\3621\276R"
+	.string	"\260N\032\263C\223\306\013;\237\016\210#\372@\334\346\216\006\202\263\020\3728\317\374\274\317\210\363<\023\304q\030f\307\373\246&\343.\364\361\246\250\353\274\211\t\367\331\306\225\025^\260S\224\360E\263h\215\016\013"
+	.ascii	"2\2417\034\330\270\360\224\332\034\323YW&\264\202)\227`\233\325"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.17.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\375\t"
+	.string	"\366\222D;0\345(\035\236\213'\030\360\220$U\b\221Jh%3<6\227~\030\241\231.\331\264\325\337\357\"4\030\215\331(j\372gDD2\200\301\343\246h\345\013\024\362\312\020\302m\345N)3"
+	.string	"1"
+	.string	"3"
+	.string	"'\243\342\354\270\320b2\326I\200\335\331\r\334@\273\214/\320.\225\343\250G\224\377\222cB2"
+	.string	"\264\\\251\307\355aw\035[.\214[o;\3016\203}M\321\212\211\216\032}ncy\331\264\354Z\314\004\254\213\\\001\261}\2623\266c\264\017;\311\351\323t\202\335\227Lew.X\201\273\364\344l\373\"\037\t\252\352\240\261\322\224m\357)\020(\024\241\222n\374\335D\202\333]5\3701R\310}\\\372&\355\362z\340\001S\305\231=SQ7\354cV_\336>\177)\003 \217\250C\nE\036g\017\247\324\211\030\205\336\247\013A\320\204\007~:\221\327\tu\0360\3548\032\177#\020\330\221\276\017\3542s\357M\021TZa\325M\317\032 \020\245:\006\020"
+	.ascii	"2\003\302\260\r\273\032\f\366\202\354\224\2568\032\213)\315\325"
+	.ascii	"g,s\rG\231\300\256\032\257\003\023\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_displayInit.18.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`&\001]\f"
+	.string	"\326\026S?"
+	.string	"Q5\035\230\251\233Kz\353Z\377\234\234"
+	.string	"t\334S\320\r\343\244\266\236\277\352\207\361\317m\373\252\301;0(\207F\001\203 \304\222\253Z\221\362\335\207?\213z\363I[\370\343\354\240F\366N)>"
+	.string	"?"
+	.string	"D"
+	.string	"'\260\033:\275\330%\031xA\366\313\344\r`\277\262\027\300~Y\264e\234$\261/\315\350\260b\265\273\225\216\270\370)\372Oq"
+	.string	"\236\317\346\363\021aw==\237\0177\275m\005\266\037\330\027\005\277 #\f\320\b\004g\2266\271\231T\204}kw\3274d\237\374\255\223~J\247\257A\340X\321H`\332\035\313\032\273q\245L\330\276f{\222\033\016\f\330N\311C\203O\373\242\217\304\2234\001\016F\325\273\267\250#\007H\244\272\207\331\026~\362\036\250\216\225*\300\244\324\247\326Bt\350\3066\345\246/\333\355D|\026\231\013\031\006\373uz\241:P\220,j\207W\201\311v7\342\2272`\020\020\243\204\006\013\335\244\3026!\203u\\e\273\204\025/3\007\321\260M,\241'\251!\330e<PR+\336F\251\034\030V\b\002\177\226\016\254\227\357\003\253F\356\255\245!K(78\224\203E\nOq\237\362\004\207\331\333]p\001\030"
+	.ascii	"2\241\365/0.N\322\213\334AG\024\\\016\322\200\274\240\035JiY"
+	.ascii	"\230p\274\220z\255\202{\252<\247\301I\213\273\016a\215k@+\f\r"
+	.ascii	"\n\203a\001*4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`5\001\205\005"
+	.ascii	"B\307\033&\2209\035\377\377\260\304\323\366\377Pk\227|333n\232"
+	.ascii	"\001\377\300?\202\017\021a\210DDD\2046m\222\366\336)\255\250"
+	.ascii	"Ir\004\031Z\036\303,\372\262\342k\354\226=\327<iNgf;\310`\027"
+	.ascii	"4\311\003\221\003 \267\036\257\034\247\032\237\030\227\026\217"
+	.ascii	"\024\207\022\177\020\217\207;\327\241\341M\341\246\344\245}\213"
+	.ascii	"\2514gf\022\376\\[\207\005\" \200\203\304\325Y\3105aE\232g1\023"
+	.ascii	"2\310\215ac<\337\230\240~\t+\004\211!\f3\3640]\306\354\321\316"
+	.ascii	"\347>\367\271\237\373\234\317}\356\347>\347s\237\363\271\317"
+	.ascii	"\371]\333~<"
+	.text
+	.section	.gnu.lto_.refs.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.29ecbe4fdcfa021f,"e",@progbits
+	.string	"(\265/\375`[\031\345m"
+	.string	"\232\262X'Q0\220\312I\007\0268\035\367@\317f\377\340.\032\027\365\307\323\034\365z\370gU]\244XE\367\007\251\252B\270\373[\227\327Q\3257a5F\334g\342\201\200a\231.\"\016e\2720[\230\352B\324p\355\007b\0133\331\227pU\375\023\211&D\312\024\002\002b\002\210\002\215\262\227\23584\\\226n9\\k\344\2524\312\\\270\013\267&\270\355,\"\321\376|\342$\211\303J\352\331D\312M6\221\276\206\372#u\202,XR3)E\340\260\235\261\260q\240\314\221F\203\372\363\332r\207\210\273\037yV\316\313\237\351%s\311X\243\277c5\336\001\245\307\017\265*?\257!\300T5J\346[\033c#G\243\207\241\276\345"
+	.string	"\322\320\3245m\332;(g\264?\205\n>\353\271\027\001\376\342\346IS\243|\326l\306R\316g\034\345)T\274g\351\216\335\333\362\031z\257\221\231\001\0373\0039lA\214d)\372\024\324\337]\307\367\345\211\b\217F\177~\362\263\030\217q\331y|R^\263{[\240\336\027%A\3364J\326\036\001\242\305\246\321s\2402\022\354\244\275A=\247\034sE\032\375\220zn\362\001\214W\305y\324\267z\265\226K\244*\007\2202\006=\003\274p<\201~N\177\3769\361s\317\347?\317\377V~\016`\371\303\033"
+	.string	"|`\243\326\260\373/\345g\0354\032h\376\203\371y\207\231\024\367\237\356g\001x\207\326\3774G\340?\r\027\340o2?o\360s\006\357\375\315$\340\352\337Yx\200k<\367\375]\345g\013~\214\365\337\337h\377\325\374\f\364\302\205\377w\357\371;\212\317w\376&\373Y\203\237M\374\254\342\202\263\375\334\303\342\017\374\307\362w\223\237\257~>\376\\\374\371\207\237}\370\271\306\3174~N\372y\370\263\016?\337\3603\360g\031?\257?\033\375\\\3643\321\3175\374L\303\3173\374,\303\3171\374\f\303\317#\3747\373\271\304\317(~\366\340\347\027\376\307\375\334\302\377\266\237Y\370O\300\317/~^\341g\025~N\341g\024~>\341g\023~.\341g\022~\026\341\347\020~\006\341\347\001~v\361\363\007?\023\360?\305\177.\377\201\232\315f\363G\227\376\323\201\037"
+	.ascii	"\256SH\274\253)SH\274.#\230\370\330\342\263\024hSH\274\260f\322"
+	.ascii	"Hz\254\225t\223^\322N\032\254\333N\302m\213\261\223\263\2306"
+	.ascii	"\322L-\326B4\020~\373\321\301\230\031\235X\177u\021\326R\262"
+	.ascii	"\343Hk\261\2402\205\304\243@\b\273\371\212\355\225j16\205\304"
+	.ascii	"\353\036b\255\3443~\263\312\200H\032\035\233\025W\027\204\276"
+	.ascii	"\337\250}\213\020\321i\352\3322\372\252D-\271\351#\030\216O\034"
+	.ascii	"#`\260\324\250\3579\365]F}3\325\267\233\372NB\r\362\352!\270"
+	.ascii	"=\321?\336\\\335\365\034c{\333.\"\357\214LM=\237H\317f\223O\244"
+	.ascii	"\357'\352O\203\251\023\364\020\225\005\227H\233Gcq\033\324Y?"
+	.ascii	"\006\243\024\205\325\350\373\207\n\304mrP\372\326Ro\366\266\252"
+	.ascii	"\342y\342F\013YW5\325\fius\215\266K<qZI(\307\306p\235\231)Tx"
+	.ascii	"\r\001\245#\tastS\256p\026\271)d\230\030;^\263\242\314\024\022"
+	.ascii	"oI\263\217w\352\005\232)$\336\320\233._\177';\210\316\3218\332"
+	.ascii	"F\337h\035=\325Q\r\325O\215\344\266\245\030\3169\217\343<\250"
+	.ascii	"\275w\351\336{\036\303\363\362\305\246\215\333\327\220\033\316"
+	.ascii	"\342+\002\335\333\325\366\265\205\303\300\361\330\317Z\222\340"
+	.ascii	"4~\263j\035\210\233B\206\335\333\236\202\237\227H1\023N;\333"
+	.ascii	"#\356\355\342q@Y\231T\022x\367\266\020\004A\260\303\004\246\245"
+	.ascii	"\305\200c;\245QrrZ}\337N\335\224Z\3512\304S\243]l#\267(Z\351"
+	.ascii	"\275\324L\327Yjo\231\316\030\273,\263F\027\340\022)\032\247\236"
+	.ascii	"Q\244\277f\263\331d\024\251\0275\275\\\"\375\033\243\251g(\352"
+	.ascii	"\231\211z&\242\236\207P\177\326\334\241\\\360\226\260Qs\276\363"
+	.ascii	"A%\331\022D\243\214\245\376\\\227f\247\215\031&\f\3359\315O\352"
+	.ascii	"\b\326(\243\341\231\342e%\252Q>\343\213\262%\314G\243<\307#\226"
+	.ascii	"\343\fL\356\007\366\346\306\030\2718\261\034^F\264?\035+o\216"
+	.ascii	"\350h\224\313\260\2313\034\223\271\fW\201\022\356\007\347^\343"
+	.ascii	"\217\231\001f\006P%\\C\244\244\350\271J=\337P\027\b\303\364-"
+	.ascii	"\325\216B\300\234\231<e\250\304|a\265\337\016%\016'\215\362["
+	.ascii	"o\352\210\253\253\214\306d\242\265\f\273\340\255\007\0278ww\314"
+	.ascii	"d\016\371\202q\345\t*\316\316\216\271~\320\375\260\303\250\344"
+	.ascii	"67\327i4 \273\242\013\222\205\326t\3574g\340\346\244\2164\332"
+	.ascii	"hX\355\327#\255\351\254\321>c%.\216\321H\270\3672\327\223\326"
+	.ascii	"\022/\245\273\022\244Ik\306L\234/\264\207\231\233\234\020"
+	.string	"2d\316{\265\360\276|dTf\306z\210\021\303K93?\250\272;%8\230L\276\373\271Jp]\350\256\310a\241\305/_x\251\266\tT\321Z\206\375\212\355\333\0244\352\273\255\335\336^\356\205\227luO\271&ZK\274ke\205b\307\306\231\257*&\352\373O\257\021y\357\235\312i/R\251\347\234\303>|r\003\377\321{Z`\344^$j\324\250E\252\030y|\201\373\260{\213@\267\275\310c\331V\361\370\004L\022\250\275>\b\270e]\367\330n%Q\345\355\333^\276K[I\035\216\255\022yl\225\305\237\273\244,\336\333&\177\216f\306\"\037\313\266\222\3072e\022\350.\335\342-3\372P\227\224\311c\027e\362\347XfL\036\227\266\222@G\324\004\241rc\310V\034'\217K7\n\n\313\210\374y;\266\312[\346^6k\272\310\006\356\305R\"\313\030\253XM\351-J)\315\250\344\366\336["
+	.ascii	"\224\022\227\362.\275\035\215(\3575\2424\343BUPl\337.\020~+v"
+	.ascii	"a\335\247\246{\r\200\272\267\310\367\355\336[\274\367\366\220"
+	.ascii	"X\355\275W?\307/(\250{\255\202\240.V\321J\323\275m\006\247"
+	.string	"\226<\226q)\207\254@)\373\272Nm\221\277n\231-\244ZVtr\237\354\324\257$\216\272\336\211\002;\202\311\332\322WD\207\327Z\032ZOS\210\224%\2152\355\216D\222\215\246\331\351\"D\020y\215\266?8&\0173X\232-\316Tq\255\321\2762\204\313\220!\215\376dR\261\264G6_\224\032E\225\266\340\300\252\242j\3235\312\344\030\265>\356\344I\331\241UYK\257\254\332\334\240\222\366\333\322$\211\220)azG\212H\253J\253\353\021\302D\006\t\232\211_K\005\325%e\r\2325\305t\343\314\f\255*\n\321\324\323f\261E\t\362\211\203\323\346\006\345\254'\206\205\313\354\311\tui\rm\254\214\263\3448\261\213\023\326(\022\\qm<\032%\013\022\307\204\244\321\253\b\302nJ\226\320\r\371\034\0221:\"\212h\022\237!\201\214 \220%\016\205\326\243$$\243 P\210\035&\t\r@$Z{"
+	.ascii	"\016S$\244\244`P\030\354\321\020\2623\210\302`\317\206\242\025"
+	.ascii	"\t]\331\244\034\320\340\212\304\022\207)\021\030,\301\205\026"
+	.ascii	"H\370\035\020C\f3\310@\\{\216\326\030\303\022~\220\220<h\301"
+	.ascii	"\027\243\210\035\201\007\006\b@7r\001\300\215\200\354\032\\e"
+	.ascii	"\250\257`E\004+X\360\320;\213\026\023\264\230 =\213\026CC"
+	.string	"-V\f\251_1t\022uvHW#\340\016\353Q:\244!d\321!\222\320\b\225a\206\2410\007\224H\264b\210\030L\022\272\330ABJ\022a\035&\371\034\255\275\224\206\260\005V8d\223\214t>\303\304\2059\254\254\020Q(d\205x\210D)(P\327\225\025a\270\022k|\300\003\221gH\264\"\305(r\001\206"
+	.string	"b\024\2612\320uX\264\"\255l\217-Z\221\214x`\320(b\217v\326\036\2000\202\353\312\032\rw\330\242\031F\250\214 \220%\302\340!\022\261 \006\201I=\266h\206\213\225\bdi\350\f\207++C\310\276\b\226\300\2566\f\203E\254\013C\240"
+	.string	"\304\2425\006\221-Zg\350\030\005k\fW6E\022\n? \312!\016\211\210\254\360\205\317\207\206\\,\360\202\n#\250F\022\324(B\312a\b<\022\032\262\353\016@\366H(\b,\302A\310\210\035\nI\200\300\321j\024\254\001c\bT{\234WjRM\2404zf\365\211uj\375\314z{f)"
+	.ascii	"\347w\205\246\205H\212\336\306O\244\215\363\352\254So\261\275"
+	.ascii	"V\312b\032\r\330\360"
+	.string	"\352\306\360\356\321\n\205\317\224\253$\312\344\317\253\237:R\2508w\370D\261m\255i\364\244:\253\270=\227\323\352)\322\252\275f\276\245\323Y\352\244\036\b>\227\364\314q\237U\333\222n\352\304\361\353\354\024\021\242\f\254\251>\002\025\t\252d\362\214\372)\305\204\255\211\311F=\237~ByE\275\201\251S\377\363\306\257\323\223\306\b*\"\346\324\347\2149\225N\245\363\210F\325\221\207G\346t\372y\354\031sS\364\321\350\331\304j-r\007X\243\277;\231\264\276\200\034a:\227|[\202hU\365\025\365\314\f3kK\263y\026\373\253\007\205\f\216\256\233\222\230!9\357\317b\003\371\361\302\301l4'J^\036/\333\276\216\272\344q%y\363\206\227Z\350zB\3068\035\177\264i\203\326\343E&\204J\243\317\261b\303&\202\022\250B)!\210\002\035\"D322\222$\205\016\"\013\020\006\243Y\244\306\312\003\022"
+	.string	"41\323S\222\231\021\021\2212\n\222\202\224\032\003\312\004\371\350\f\\\341\250\351\323\206E\n`\036\250\276\371\353-\242\237\037\235\33717}\377#\220;!W\256A\216(\340\260\313\265\314>\375"
+	.ascii	"\346m\271\252DJ:\364f\250\365-\250\347\355+\260\327\n\023q=+"
+	.ascii	"\004\213\3024\224`\352\277\004\003\310\356\023\271c\374,\274"
+	.ascii	".\240\217n\366\351\023R\027\006\ny:\004 \260\242\003\343\312"
+	.ascii	"\260\312\240\030\331\020ZJ\344h\f\260O\021f\252Bw4\204\207\353"
+	.ascii	"\033\366%\017\225\037\013\332B\375\216\274\244\262\302\017\225"
+	.ascii	"\316\373q\256\247\"\332e/9\tZX\211\231P\030\376228\n\033\366"
+	.ascii	"\333\371\250\355\312\267&\337\253?e\336\326\017\324\2004\332"
+	.ascii	"2\360\001"
+	.string	"\256\032\303\331\305\304\355\256\3778S\212\312\026\201v(\221\3468\364\356\364\252\377\325\300\037'\311\324\237\n\300\032\323\253\223\276\361\231\"\377\320M[\"\353\354\224\355(\267?\034K\356\343\266,w'0\205\177\002\345\250\301\357\324\024\033Xn\374\334?\202\257\275\r\367\333+\037\245\267\365rG_\266;\202\271<\"\303\243\365\274\255\022\215\357W<\232\224_\250\027\227j\235\210\347\017M\214#\032\323\246\031\224\262\306\260\224\007\315\374\021\271\337\031\235\222\313\311v\225\025b\b\355\b\004\355\322\037\266)q,\2270Ks\037\322;*\314\234\232\333\353\236d\347\035\276\362\200\026\260t\344#C\034\013\023\242V\316\237\367\013\234\323\217\243\317\026gh\013\355F\017k\255\370\346\f\016Lh\030\273\261\016T\361\356\332{\232\244t\020>\034\324M\334\034\334\016\351=\213\336\260\2627\006V\223L\033\253\361\372\276\236\252[\304\313)?"
+	.string	"\016S!"
+	.string	"\342(u\300\357}q\022s\356\271\253\210qX\236^]\325'"
+	.string	"8\035z\202\345\236]\237\360\335\274E9fX>\b\243u\347\356b\001\307\275\031\3453v\017\301J\324EZk\242=\264\377E\030\260\364\244d\b\315H\221\366\3241\323\212\001\352\310\342\253\230k\022\004\017\345.\023s\020\256\265~\331\305\271\334l\253\022\327\341\277\327\027~\006!\277\255\r\203\\\321\\\201\300\306\035\347\226l8\177\371 O\r\374\006\016\300\343\335\004\316\302\344!%\031l\r\316'\361XF\377\212\031\3431-\353A\346\030\250\242@\004\236\351\003p\001*\336\307\365I\001\367\032\273\"v\031\207\024\375\032ti`"
+	.ascii	"\200\314\273\024[\250Q\215\223\201\201\240\033\354x\261\260\022"
+	.ascii	"\343\267ae\\\256g#\266\\i\306\277%\277\373\244\301A\337-\334"
+	.ascii	"P\001d\255\0130\025\244\252\346\224\335\247\225z\310\226.\313"
+	.ascii	"\323\337,\245\331\211\317\277\344\037\317\3234\016\254\2732#"
+	.ascii	"4\355\217\033\037F\247\003\261\326\345\243\215\253]\226\210\004"
+	.ascii	"\300b\377-\335\2761ai\347\301\216\223\320\024\324\203e\031\376"
+	.ascii	"\3418\202\265\230y\r\354\0060\342\245\341Y\256\013i<\226qG\003"
+	.ascii	"\2543R=\3476\3429+1\232\251,\315\342\036\372\304\374S[\233u\253"
+	.ascii	"\345\231\236\310\344\017z\242\336\263\215\257)\310w\335\003\330"
+	.ascii	"X'\371H\370(\212\007\224.\3322-\374\033\266\214\025\217\021s"
+	.ascii	"\274\020~\350:\277\355\017\fO\330}r\326\372\3441\344\206\362"
+	.ascii	"\212\271j\227!F\376\013\035\357\241\373\r\253B\370y\274\367*"
+	.ascii	"\364v\362\235\373\237\337C\304_\217\225)x\323\371E>|\337\226"
+	.ascii	"9\306\225j\327\037y\227|\020\3036\3363\374I\334\0300\314\232"
+	.ascii	"\364\005\023\037\035\331e\312l\324|\322q\375H~\256O\033\236m"
+	.ascii	"EoE\235V"
+	.text
+	.section	.gnu.lto_.symtab.29ecbe4fdcfa021f,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"displayIsSynced"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.29ecbe4fdcfa021f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,794 @@
+	.file	"io.c"
+	.section	.gnu.lto_.profile.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\325\005"
+	.string	"\264\b\016\001"
+	.string	"\026"
+	.string	"\370\216\225\261\004"
+	.string	"\001\276\237\344\233\016\002\002"
+	.string	"\002\001\002\303\365\340\332\r\002\002\002\002\001\003\377\223\325\230\004\004\005\006\224\364\237\314\007\b\t\317\253\250\341\002"
+	.string	"\n\271\225\361\330\017\006\003\002\004\013\247\204\361k\006\f\277\225\306\207\003\r\356\242\353\274\n\016\233\204\330\275\n\b\017\302\311\343\254\r\004\002\005\002\006\002\007\002\006\020\311\256\332\347\002\002\021\324\314\220\352\001\022\202\371\271\222\f\023\234\253\215\342\007"
+	.string	"\024\025\240\342\234\212\n"
+	.string	"\023"
+	.string	"#3\034\234qiMf\333\302+"
+	.ascii	"\234\001G\261y*'\201\226(Sc\020\303U\260\317e\263\247\306\003"
+	.ascii	"[\\\3662g{\032\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 \273%\003"
+	.string	"D\003\257"
+	.string	"\025"
+	.string	"\001\003\001\002\003\004\005\006\001\002\007\b\t\005\003\n"
+	.string	"\003\013\002\001\f\001\r"
+	.string	"\001\016\017\003\001\020\021\001\003\022\001\003\023"
+	.string	"\001\024\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\026"
+	.string	" \006\b8\347\300\034\005\020p\314\031 \260\325\213\335@\004\304\200\340"
+	.ascii	"\307`r\003V\30080\030\030\002\306\201\301T\246\275\004\267\201"
+	.ascii	"6"
+	.text
+	.section	.gnu.lto_.inline.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\343\006\345\016"
+	.string	"\026\022?7@\305(\035\347\332\301\005X\fIK\216Z\244\303\217\002\313\275.\031\321Y\003\f\227h\304z\013\262.\337\206\237\322\030Q\024\005\br\0046\241\255\221\330n\233H)S\n)"
+	.string	"2"
+	.string	"5"
+	.ascii	"X:X}\220\222\210J\243g\335\250/\353\364\344\327V\277\274\357"
+	.ascii	"o\272\276\235\316~\200\020B\330i\177K\b!T\373\300\026U\353+\244"
+	.ascii	"DEF\tf\354\362,N\300\370\377\311\026i%\242\034\317\356:}W\363"
+	.ascii	"n9b\242\232\270\234\2539\267\243\001R,:\356\347m/,\177\006\027"
+	.ascii	"\240\244\270\370\210\300<\212:Q!e\034\220\321\366\3553\346\360"
+	.ascii	"\220\343\365\244w\343\375\254\206e\371/\270,\033\356F$\rV\346"
+	.ascii	"L\243\331\023*\004\305y\200\240X/6\3304\306\330\332t\2141^.@"
+	.ascii	"\360\246\016\200)\224\272\230\300\3669jL\336:\320y\347%S(\345"
+	.ascii	"\254\345:\323\007\345jE\264a\261@b\2501Ud\214\304\202\024\024"
+	.ascii	"*\313\001\300\"\231)\232\007\022\300\203\025\304\241\220b\004"
+	.ascii	")&xB\211H\242\222H\242\250\202\344\001Z\311d@\236\316\b\224\026"
+	.ascii	"|\333\226\315\0327\356\377\f~\352;9\301\222oX5$[\316\306\321"
+	.ascii	"\223\001\t\200\246\233\241\236\304\321\002\322\376>\373v+\246"
+	.ascii	"\205\t4\020\336\364\300(\321\220\243T\227\364\205y\330\031\302"
+	.ascii	"\261\331jw\366\\\236\032v\307%\226\224x\321\352\322\321w4O|\004"
+	.ascii	"\273\276\3621\177X\300\261\r\032\302\"K2\003\nj&\247B<g\241z"
+	.ascii	"\033\232\022\324\032\272)\nM\230\036k\332\003N D\203\006v@B\210"
+	.ascii	"\035\376\306\326\267dS2\252\3538f,\255\346\344t?zW\300\273J\226"
+	.ascii	"\345\336\242\222\033/\243!7\272\037\307+F\031\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 \357\355\003"
+	.string	"\"\206\024\037\240'\351\377\340\377`\031\376\377_\373\377\277\371\357\265l\366\377?\351f{\355\177\322\310\226I\006L%\037A\036\f\005\202\322K\024\177%%\031 =\353\245/bV\362\005\201\031\277\030\260 \276\240^M\363a\370a&\213\216S\265\262~\353\3253\301F\021"
+	.ascii	"1\207\200q\201\032M\324-0Ne\260\232\203\0365D\240\230%J\231\227"
+	.ascii	" \300\0200Ne0\234CP\031k\003X"
+	.text
+	.section	.gnu.lto_.pureconst.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 D\335\001"
+	.string	"B\304\r\026\240\2531?\360Os\377\377\273\376\257M\3234M\3234q\334\254\f.\311*r\310\037\317\361\032\217\361\026O\361\022G\\\207\033^8\341\203\353\202\007\016\270l23*"
+	.text
+	.section	.gnu.lto_.ipa_modref.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`p\001\375\005"
+	.ascii	"\"\307\025\035\240'\351\377\347J\374\377\277\253\316\377\327"
+	.ascii	"\377\2738Ik\275\3667YK\333\266\326\232\224)\2476\b92\217\026"
+	.ascii	"\322\276\212\210\013\205\027J{S&\fB\007J\"\342M\024\251\202g"
+	.ascii	"\312\227v+\217\001\236\002\034\003\023\244\2162\314\276\323\357"
+	.ascii	"{\316\253\334\312\37782\335C/ \320\002\0212\362\201\271\261."
+	.ascii	"\204=\262\272,2\005\002g\325%\343\271\3731:X\345\223wM\367\210"
+	.ascii	"\030\f@l\230\n\006\026\027 \334\002\023S\020kF\035F/\017\233"
+	.ascii	";'M\272\2554\0068\227\211\024K\324\027\350\2055,\211\021\374"
+	.ascii	"\336\306b8\334\323\320^9ke|1\307\202Q\267\367\230\305\342\242"
+	.ascii	"\273\001"
+	.text
+	.section	.gnu.lto_.lto.a65981cc4498458a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_IO_Rec.3.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 \364\245\006"
+	.string	"\002\r/4Pm\222\016$\243\252B\304\022\212\242C-,\312\021_\016\200\323\316U\230\231\335\r@\007\226\340]\262\327UU\325U\025\375\356a\246\371z\035\373\273YBd\n\257bw8\257r\037\350\201\250\340\202k\250\024\030\\\007~\034g\363s\360@\367\360\036t\232\230m\327\215@\242M|\f\261\226\361\275d\273\276\245\266\rc\2412p\222Y\321\302\222)\223I\307\337\037\364\232\237\261\226\"\n\220yq\224dF\204\r2\235\376\373Q\020\320\326&n\220(\021\022\212\221\225\314\350\216\025\240:e\032@uj\032\265\312\254\333\220^<0PD\243P\031&!3g\242\021\251\267\376\005\377\301\177\021\007"
+	.ascii	"u\bX\347\220\255\302q\r\017\303\204\"\374\314hj\347\023"
+	.text
+	.section	.gnu.lto_IO_GPIO.4.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\302N56Po\322\001 ;\023\035a\373\205\351\203\235V\023\004\211\220Rh\256\350\214E>\312\007\002}r\006\2204\206\230\231F\024\243\213\334\331\354\363\036\013\226H\333D\356\224\002\322z\356p\244\025\261\313#a]\f\321\301Zh\210\235\013\213\234\215\345\203\347\212\020R^Q3\265O\253\233*\201\246 \333\330K\"\252]\214\004\237\244b\242\3728\364)4\303i\257\263'\350)\207\375iu\263\236\373\337D\205\260\ft\273\032\335\313\256\300\022\210\355\217\255\261\375\3369\213\003\354n$\225\335\211`\203\352\320\266/r\322\307\331fz\214\250\026\224\214\023\227\335\031=/\2009\254\036\2009\324\216g\177\231\377\221O\245\215\224\220\350\342\217R\330]\277\220ht\353m\027\330>\260m\022\013"
+	.ascii	"2C\027\r\f\304b\224,`\303\204\356\032\0161\201M\032\343\016A"
+	.ascii	"\n?3\232\332\371\004"
+	.text
+	.section	.gnu.lto_IO_Pin.5.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\335\007"
+	.string	"\"\01766Po\322\001 \233\256\025`h?\033\306/\213\251\001\tdO{st\306\"\037\3011\360\3772#\2200\003TUD\024\243\213\334\271 q^\303!\215l\262eJ\001\361Rw8\361\202\230\364T\\\362\001F\\\016\020\260#1\310)p\224\360H8\021\243\204\233\271\335\316\035l\356c\033\373\n\205\265\273\301\340\2230,,\222?\377\302\001\2146=\331\363\243.\304>\265Nd\367\371+\245)\301\030\304\354v\234f\366\345\231Llg\366\306\266\252\375\321S\262\317\214\013\354\212JJ\273s\301\t\326\237\247e\333?9JfM\347\210GEr\341`\221\331\2350\340\004\325\237~\240\372s\"\327\256\232\177\225S&\220\023(\244q\3254\354\256\025\024\372\270\335m#\330V\260\335\022\f"
+	.ascii	"2\003\302\260\2268\0343\203\031c\273k8\307\0046i\214\016L\020"
+	.ascii	"p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_IO_GPIOPortIdx.6.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\b\001-\r"
+	.string	"\306\031ZB\020\221\223\016\370~\036\235G\020\264B\342\332w\255\320W\360\261\305\021\034t\217\313\032\007\220D\233\2630\313V\034u\025\024\025\3565\036\t"
+	.string	""
+	.string	"P\301\003\005J\360\324\255\225r\214\264\024\033!dK)S\nH"
+	.string	"C"
+	.string	"I"
+	.string	"(\256\262\331&\355Bp\367 \303\344\305\306\356b\006>\200\372\323\013\240\376\022\304\267k\342\346W\270\236FJ\351\204\313\360\324\0060\034\t"
+	.string	"\034H\017\314\260x\313Q\304\205\020+\217\3355\236p\030\356w\333\016l+\260o!\326CW\357\376\247hMt&\032\023\375MUC\246"
+	.string	"\214]\224\023\315\306<\027#|\227\223F\256\302O\206\306\304\356^#\366\365\315\276\320\376\312Y\266w$\017\260;:\321b\267[\340\004\326\237;\313\266\037\211\251\246\222\r <\271\312\347[\256*)%\223\232\223\034\362\025\231\265\033b\340\227D&\370\"\376|\017\365W\345IG\300\315\270\261\362\301S\346x!\352\220&\241^j@)\341\022#\2048\354\016\204\371\301\276n\216lE\007Y\007\375\301\311:\230G\003\241\320\321 `\021:\017B\260\017\315\203q\b8\223"
+	.string	"\242a\"Y\246a\227mw\237\353\346\310\031\303r!\255\r\207\0243\310\271\246\310\266\246=>\t\322L+\337q\233(\314\314\352\245\244f\273a\250\007\026"
+	.ascii	"\237\033\307\026\201=\266W\017M\263\n\2774\315\245)+\240\341"
+	.ascii	"\321\025^,\031X+\271\220\007\334\030l\312tP\226\274\232\036\031"
+	.ascii	"#Ae\016\332\215\244\004\224\252\006\232KA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_PortSourceGPIO.7.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`4\001E\016"
+	.string	"\306\332^C\020\221\223\016\275\212Alq$lN\377[9t\303\204\243|\254\353+\\\256\374\217\006e\205\373\273\275\270]\2538\2069\037\301\250\212#~\001"
+	.string	"\240\b<\243\200\240\203\354,\304!\245XD\204\354\275\245L)K"
+	.string	"I"
+	.string	"L"
+	.string	"v\352u#\270\203\230\t\235p\354nf\340\003\342\341\273\200x\250\"\276\375in\276\351o\205dC\304e\370\373\r\022J\304m\270\276\0060\234\n"
+	.ascii	"\356\363"
+	.string	"\016\310\274\370\3519\342@\231\227\203\335u\2128\r7\274\355\007\266\025\330W\t\351\367\322\372\356O\217k\025S`\306nJk\265*\030\243\204\377rT\311W\030\306\254Vv\367*~\"y\n\253\211EbkJl\3157[\223\366[\356\262\2753y\200\335\022\013\030\273\335\002'\300\016\335a\266\375\023g\331\002\372R'\035>\331\262\352\323\237\376XH\250\020\353(K\270\013\021l\027\304\300o\201A\363IT\320\243\216\200\253\221\243\305\223-\335!c\364Am\022S9\244\230x\241\001J\035v\367I\ra\377\255\226\354\230\306b\372\202\351\b\323\020\006\032'\r\262\3218\331H'\344\002\247\023!\233\300\201 \222\201tF\262\r\001k\024B:\231\005M\353d\232\316\363\267Z\262\252\\P\364\362\360\200B&7\307td\033\323\233~\224\320\214\312\243\237\027\365\322\177\334\251\b5\352u:am7L|\n\003\035"
+	.ascii	";\013\255\273q\f#\f\217\255\320C\323\254\302/Ms\232\032s\314"
+	.ascii	".\306\262\004\272\216\356\365bI\312Z\311\205<,\326\240\023\246"
+	.ascii	"\205`\276\305\022\2351\021\007X9\342\3254\312\030\t*s\320n$%"
+	.ascii	" \315\361h.\005\005"
+	.text
+	.section	.gnu.lto_IO_GPIO_PortSource.8.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`4\001%\016"
+	.string	"\346\032_C"
+	.string	"\261&\035\213\f\344\300\330\271\210\374\316\353)\320&\021C\341Ok,{U\353\"\373hJ\240:\267\216i=\302\021\r\006\020&"
+	.string	"\370\013"
+	.string	""
+	.string	"\005P\370\277\307@\326N\320z\220\321F\232\220\275\267\224)\005L"
+	.string	"J"
+	.string	"L"
+	.ascii	"\232}z\034\313\366\025\r']\215\335\275\n|@<|\027\020\017u\304"
+	.ascii	"\265?M\315\237\371sa\2011\3322\374\235\206\212i\264q\270\276"
+	.ascii	"\0066[\013\200-\364"
+	.string	"\f\340\260x\367$m\242\314\312\301\356:G\333\206\033\336\366\003\333\n\354\267\004\020\246\337K\353\271?;<<\334$h\261\233\222\312Y\024|Q\302\257\271\211\344)\for\216\342\335\310i\2544\235\313\356\216\330\035\022\273s\315\356\244\375\230\313h\347J\036`\267\004\343b\227[`\004\326\2419\313\266\177\342/\001\357d\002\"\224)\253>}\367\367\242b:\311q\223%|E\210\265+b\340\253\300\200\371$*\350M?\260\315\260\021\003\312\224\342\210A\022\241.\211\251\037RL\324\310\020\345\r\233\013\245\256\330\177\273\273\326\222\035\323VLW0\035a:\330'\375\341\301>\227H\006r\341\223E\270&| \204\\\037\231\310\345!`\214\002HvY\300\260\354\352p\240k\311\212\222A\321\252#\004\fNzn)\311\266\245\237\371QF\035P \r\275\250\225\336\343>E\250Q\253\316$\207v\333\304\247P\003\033"
+	.ascii	";\023p\325A\206\021\206\307V\350\241iV\341\227\2469M\2159f\027"
+	.ascii	"cY\002]G\367z\261$e\255\324.\204N\230\026\2025<\t\3219~\345\210"
+	.ascii	"W\323(c$\250\314A\273\221\224\2004\307\243\271\024\024"
+	.text
+	.section	.gnu.lto_IO_GPIOPinIdx.9.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\f"
+	.string	"v\031YB\020s\223\016\333\037\323\2430?\200\205\330z>&\204\221\346\243\262\366\310\245'\213\007\300\325\276c\323\324\020\272\313#,\340\224\214\002&\001"
+	.string	""
+	.string	"\"\bCD)\317}\327G\2705"
+	.string	"\342!d\357-eJ\001H"
+	.string	"A"
+	.string	"G"
+	.string	")\256B\263_^G\202\273\n\007\224\026=v\327\312\334@<|/\020\017u\304\265?M\315?\371\203\260R\343\303\245\\_\004\030\016\305"
+	.string	"n{\tt\300\370\350\t\342<\231S\310\356:?\234\207\033\336\266\004\333\r\354s\0020\035\337\375\357\245\365\245S\323\247\002\260\334`P\332\355P\002\2626\340\f\023\266\357\267\234dr\026\236x\304\250L\354\352\232]\331~\332\027}\205\366\216s\002\273!\026\031\273\235\003/\240\016\335Q\266\375\361\237\324\214GO\034\365\372\321s\005\006%\310I&\371\013\214\332\365<\360]\224`\360K\034\372\233x\030\365\244+\340v\370\020u\262\24414@\"\324\234\370\364C\n\216\226\034\236\374aw[\252\212\375\267\032\262_z\n\330\225\026\321`\227\265\311FJ\256\214\202e\341\232@b\211d\033Ks\300\330\205\221\314\312\200a\231Uu\235k\310\032\\D:\351G\007\020\302\005Dj\256\n\262\255\352\220\216n/\025\301\375\022'}\314\206\023[\226, \257\366U!\023"
+	.ascii	")\023p\234\216\237\330\336\277\241K\232Z\032\b<\032B\213 ~\023"
+	.ascii	"\222k\270\255M\300\240aZ\210\3535tE&\036\334\215\244\032\214"
+	.ascii	"J\307\225VA\001"
+	.text
+	.section	.gnu.lto_IO_EXTI_PinSource.10.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`$\001\005\016"
+	.string	"f\032^C"
+	.string	"\223\223\016\333\245\257!`}i\007|\204\263\334\242\006\202\324ao\nc\026\210 \274~\0206\221\373\240\333>\022\3011>\352\234\n7\002\252\252z\3257*\b\306\274\035\203"
+	.string	"\265\325c\3477\262\311\2262\245J"
+	.string	"J"
+	.string	"K"
+	.string	"\266\201\036\211\356\246\226\225\257\307\356^\237\027\210\257\340\t\304W:\342\333\241\346\346?\346\360\245\004\212\353T\016\033\270\330\340:\226+tp\323\245\020\320\211 \002\0350\376=I\335(\323z\260\273N\256\373pW\267\r\301\266\210}S\020\246\365\336\237\035"
+	.string	"47DR\273\036R@\026\247\2429\341\317\034\205\362\026\266x\3048\213\177'\227\261\312\320x\331\335\023\333\203b{\276\331\236\264\177\372\212\355^\312\007\354\226`d\354z\013\254\240\363\312^\307\266\257\3420\233\003\352\177\023\260x\256\322\317HU\254\n]nV\202\034e\n\177Q\322\331\0351\360]h\310|\023\027\364\250'\350v\3708\2052\24595H\"\324)1\025\004\013\216\231\034\243\374a{\242T\223}\270Z\262c\332\212\351\030\323U\225\016\031\226\036\001e\330e\242\221d\3004\tW\005,B\3115\242\231\\ \003\316,\220h\027\206,\323.\217\027:\\-yC\315I\243\376{H\210\232\226\004\335R\222mK\037\363w\340f\340\204T\004+=p\333\304\250\317\341\200B\224)\007H\030\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023\"v\017\021Z\002\3219~\345"
+	.ascii	"\210W\323'c$\250\314A\273\221\224@\232\227\256\264\n\n"
+	.text
+	.section	.gnu.lto_IO_GPIO_PinSource.11.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`$\001\365\r"
+	.string	"&\232]C\360\224\223\016hg2B8x\264\375\376\222\350`c\005\202\326e\005C\rs\235\006\013\243\030\233\215\306\273\355#\021|\312\202\241e\241#'\213\303B\033\340\250L\225\226R\034\310@\374s\3477\262\311\2262\245J"
+	.string	"I"
+	.string	"K"
+	.ascii	"6\320;\321\275\224\302\345\033\262\273W\311\013\304W\360\004"
+	.ascii	"\342+5\361\355Ps\363/s\350\002\005\016\327\265\034>\200\341\301"
+	.ascii	"u/W\b\001\325"
+	.string	"\265\020\320\205 \202 5\376=G\235(\323\212\260\273N\256\013qW\267-\301\366\002\373\245i\b\323z\357\317\016\200\035=\030\374\330\005\2212\2627\025\216\025>\315O+\227aK\210\215\307\370\247\362\031\353L\016\025\333\263b{\276\331\236\264o:\214\355\036\313\007\354\222bn\354z\r\254\240\363\312^\307\266\377\3421\233\035P\375\257\002\026\317UZ\"\322\026\253B\030\224\313\221\237l\3414P:\273\"\007\376\f\016\231\257\"\203\376\364\004\035\016\021\023(S\232\243cTB\315\022SE\274\370\240\001\"\312\"\266\027J-\331\207\253$;\246\255\230\2161]U\001\031\2266\371d\330\225\242\235l\3004\n\327\005l\002\312e\242\245\\\037\003\3160\234h\227\206,\323.\217\007:\\%\271C\215I\243\376;\t\211\232\021\371\271\245#\333\226^\346\377\300\241n@\032\202\225\036\270mb\324\347x`\021\312\224\003d\033"
+	.ascii	"0\013\355\325\rO\261\275\207\243=(\b\3214\030cq)V$pu\324\256"
+	.ascii	"\026FH\226M\256\341\215\330(N\304\023B\330<\t\321\031\023q\200"
+	.ascii	"\225#^M\237\214\221\2402\007\355FR\002i^\272\322*("
+	.text
+	.section	.gnu.lto_IO_EXTI_Line.12.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 \372\235\006"
+	.string	"\362\f.3`M\222\016@\203"
+	.string	"'`.\b\007>\ry\361\210\002\024\267\216\027:\242M\367<B\235\237\003\226\255 \b\250\024\342\002\215\343H\346\372\203\265\2555Bd\n\217bg0\217r\033\250\221\240`\203{\240\030\034\\\006n\034\206\340\007\241\201.\342=\350\246XQKb\215\363\221\303\332\306\027\312\326\371\306\266m\322@I0\311\304XQ\311\223\250\344\343\357_\375\3643\366\025\351H\3258\321\200\314\216\207$3*|pit\274\3747\244\236j\013\212\036\227\364\001\261\370\244dFg\320\001\251\021T\001\251Q\353\250Uf]\200\213\242\314\262\220\231\263\213+\243\267\376\005?\302\317\021\t"
+	.ascii	"2\003\202a\243\302n\025\216k\270\210\2308\340\204\221j\345\n"
+	.ascii	"%\017"
+	.text
+	.section	.gnu.lto_IORead.13.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`j\0015\017"
+	.string	"f\335gF\340\262(\035\222#\b\005\235\227\033\210@CVAT\201\037\204M\256i\023\215K^v)\017\3225\234\325}\215\276\212\020\007\177e\027\027\355\325\030c\214\353\201cX\035\b;(\305y\270\344\321_K>\331[\312\224\002U"
+	.string	"N"
+	.string	"U"
+	.string	"\257\030\026\273\237\002'\340\036\375\235\300\366\310}\300\366h\333\013\032\234\214\372\007\343r\330\013\026\215\307\356\327\351\207\243\0165Q\376\205C\013 d\260\2646\\!\003\031\f*\002\264T0\224\263c\304k\236-\255U\346\207dw\235,-\rw\274m\007\266C\354\347\b\3722\350\223\346\266\364\347\262?:\rcZc:c\372"
+	.string	"\n\220pu\200\301\320\235o]j>vFl\021\302\366\375\233\323R\376\031\001L\212o\363\231\312?\037x\211\271fv7\244b\207\036\323>\331!\333\231\366gNs\272l\345 \273\001\020\276\242\204\323\323|X\364\024\243\021\037\305\211\004nw\037{\364M\333\343\265\304K\3543\223\2363\201\333]\215\370'PL\374\230\267=~\364\263gL\006\033.\032Y*k\352A\304\r\217ze\213\372\232\203\330\310\320\320Q\203g\225=\354O\225\n\263\017ww\035\036)-\022\361H\235\2514\252@*E\350(\220JL:Q\311\324\211\030\260w2*u(\236W\352B_\352p\365e\0014\034,\035\005=\270\021\003G'}\324\006\265\3056T\223\244T\005\0256\332TAz\226\213\324\253\252\366\2608\250\262fN3$\325cb\007\347\007\315\001\033"
+	.string	""
+	.ascii	"\033Zd\201\316-4\263\355\030\232>c\356\002\313\200P\256\320\004"
+	.ascii	"\366v\201\264V\264\265\025\206\247\311\262\214\005\320\020\351"
+	.ascii	"\212fX\214\013\325\006\214A\240l\001\272C\235&\224\375\346\225"
+	.ascii	"=R\225Cs\251="
+	.text
+	.section	.gnu.lto_IOWrite.14.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\304\001\265\020"
+	.string	"\366\337oF\340\322&\035\222\240\244\245\t|\031\220GT\251\230P\231v$\365\006\252\307EVZ\205\032\224\210\364\304c\220\2618L\2342\241\306-\3315\b#\306\030\343\r\342sA\274\353\301@\323\330\260P\226v\022\367\336R\246\024["
+	.string	"V"
+	.string	"_"
+	.ascii	"&\202v\273\0046\321\016\335\235@<\324. \036Ze\353x\307\263\007"
+	.ascii	"\332\221\001\biw9%q\325#|\232*\377\302\243\211\005\342\360\303"
+	.ascii	"\237\b\313\346\025\330\335\215\205!\365-`\241!\206\bk\365"
+	.string	"6\027=T\334\347\231\303\272\311\004Q\331]'\016\253\303\rr\333+\266\021\330y\022\335\037\002\222\326\016\373\243\246_L\253\246S\323\007PB\324\322q!iQ\267\034\226\224\266\006\234\201\302\366\375\026\237\305\374\307%8b\354-v\231\314\177\fu^\255\327\241-co\207\271\331\326\264\0250P\275\233!\371\321\320k\350\300\323\376\353=\252\303h>\262\273\023\251\357\306\215\322*\227\036TW^hH\304\212\247;31D\363G,\207Io\342a\026+\232\375\370\314\020\016\343\244\355\332\244\370/R\022\374\023.\361\320\244\237=KlPj\365\300jrIG\244\220\031\251ib\324\373|\304\007\026\342\310\206\221M&\331\335*\325e\377\355\356Zwl-mz\247\b\211:\245YPP'\016&\325b\341\224z\300\275\234V\\8\226\024\f\207Bb\324\204\226\024W\001\205Jq[W\363\267*5\272\212\352r\276"
+	.ascii	"7\215\270%\351\311\237\346\330\252v\203\0139\320v7\305\017zY"
+	.ascii	"\031\300\263\273\024\342a\372\300\341\221\252\006b2\263\\F\213"
+	.ascii	"\246\227\021\265z`O\257\001# `\002!r\354\001r\250\261\020h\204"
+	.ascii	"\020~d\227U\233X\017Gho\260\326y\327\210\007\253\332\213\020"
+	.ascii	"8Hr\263\rJf<\033\333\302\002\033\"+\236\272\330qh\300\026\216"
+	.ascii	"(\033\304\020\215\323:\274\211\307\364\rX\253\200\021\244\323"
+	.ascii	"\005i\357J]\257U{"
+	.text
+	.section	.gnu.lto_IOHi.15.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\025\001\035\r"
+	.string	"6\030WC\020\221\223\016[\341\241\205\373%\034\003pd\024\370M\254)\241\003\234\335\326\271?\371\312\342#\036m\222i=\216\270\316G<\034\rL\353\002"
+	.string	""
+	.string	"\240\234\362\225\001\303C\377\177\327gX\315\027\322\366&R\246\024C"
+	.string	"A"
+	.string	"E"
+	.string	"\027\020\017\255\003\210\207\346\354\031\367N{\225\r\023>\032\273\213)\210s\25749\237\243\223\360*\303\2652`\202\002\313\246+U\327JL\211\237<+t\246L\rhw\235\"\035\206\033\3366\002\333\004\354w\b\360\250_\253\364\255\r\f\214\003.\273\027fd\366\005l1\302O\371\367q\317\031\343\303>\212\247@\356Y3\322r\035\332 \366u\230\227\355\247\375\0237\341\216\n9g\227\344\304b\327+\340\216uh/\n\256\"\213\372\357\034\031.\236\362\202\257xX\273\246\217\237\"\202\346\213p\020\017\241>\365\faA\306\203\t\212\2243\372\201D\312\213:$\252j\340\020\203\362b\312\032\266WJ-\261_\355\356ZI\354\230\2160\035Z\226\016y\264\f\033m\"\b\331\226"
+	.string	"c\220ux`\241m\204y\006Xk \332\260\007\232\266a\227G:\210\244\245JK\324\356\370\212\220\265\273\037\237e\023\0058\355\356(\036\246\r\021\030\250\327\237\2743\322\202\342\242r\343s\033"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 A\303`!R\263\272\"\256\345\247\304\233R\250="
+	.text
+	.section	.gnu.lto_IOLo.16.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\025\001\035\r"
+	.string	"6\030WC"
+	.string	"\2216\035\323dJ\346\034\346\035\024\204d2T7\364\353\020\231+<\005\024\202\023\321|\241^\346\300\363\031E\300\r,N\353"
+	.string	"\306>\250\252\252\032\357\f\323A\214\353\375\3379\346\206\203E\354\356&eJ\001C"
+	.string	"A"
+	.string	"E"
+	.string	"'\020\017\251\013\210\207\326l\032\357F\373\226\023\025\274\033\273k\351\207k\23745\277\203\243\360i\303uB`\302\302\013"
+	.string	"n\233*\227\230\022Wy^\340D\231\232\217\335u\226p\032nx\333\nl\033\260o\022\360\244_\247\364\251"
+	.string	"$b$\370v3\314\310,\f\350B\204\317rO\344\235S\206\210\375\024/\215\274\263f\373\252C{\304\256\016\263\262\375\264\217\342)\332I$\337\354\236\214Z\354v\007\314\241\016\335\005\f\276\342\212z\357\233\031/^r\203\273\204P\273\"\017_\305\004\314\017\001!\036B}\351\t\002\203L\207\024R(g\324\303\b\026\0305IT\345`\022\263\002#J\034v\267\245\242\330\237vw\255'vLG\230\016\330\225\366t\260\313\002e\037\tW\266\300rp\201\204X\236\fdu\n\030{\360\311\254\b\030\226YU\027\372GH\267IQ\324\0069\013\017\265\273\036\376K\366\0310\332]P<L\033%5\240^\257r\316\366\255|-9<\007\033"
+	.ascii	"2\003\302\260\330\302\306,\020\240\355\3601\333\2700\\\315P\340"
+	.ascii	"*F5\367\264Y\214Y\001\b<\032B\212 \003+\244p\rTBh\240B\021\212"
+	.ascii	"\206\316 A\303`!R\263\272\"\256\345\247\304\233R\250="
+	.text
+	.section	.gnu.lto_IOToggle.17.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\f\0025\022"
+	.string	"\346\341wH\340\360&\035\302\326\232[[yMT\221>\017\311\320\202\002\335\222\366S[\3140\243\317\302(\270\200;&g\343\233\215z\b\034\037\013\323\214\362<@\030c\214\3615\004C\220\023\202\212\021J#\302\373\024\033!d\023\271S\na"
+	.string	"]"
+	.string	"f"
+	.ascii	"\217\301\034d\367\245\303bWl`\005\336\247\305\023\340>\275\013"
+	.ascii	"\340>\255\262i\\\314\331\217/X?8v\027T\234\253\316\315M\245\312"
+	.ascii	"\2179\347\321\n\361\t\342\333G\013\303\026\262\273_kF\352\346"
+	.ascii	"@E\006\241\217\326j\373hK(>\273\254i\321H\331\221\354\256\245"
+	.ascii	"\206\326\207\273\273\355\022\333\"\266T\t\036'N\332\273,\366"
+	.ascii	"\317\313n\235\322rJ\037@"
+	.string	"\002$\227\b\034\030\232$n\207&\246\2151\213N\\\366\333\367\203Nk\271\217\017\274v\\<-\366\177\016d\177v\271\217\013\310\370\264]\354\357S~\346\317\026\337\243\272\354\305\213\361\340\215c\315\306\256\310\340\323\013\274\317\220\355\322>\317a\252+\331\364\242\227\021\237\210\202\211\267\273*\334\347\245\316k\307\005\213\321|\362\241\t\036z\032\222\013\026\363\264Cp\2444K\032w\034\310\250\013\241x\2733#\376\n\226\024_'\324\003]\232\340\300\344\202\305dd\223\226\330\361\251\251\336\030\206\233\372\331Az\226F\3348\252\315H\035\266\270\222zc\177\333\335\265\276\354N:(+%)[\210\2226\021\tQ\340J\352\344\002*%\001\254\200*I\001MR+\240\210\001\207\026NR K\030\246\300O\224\371\266\3722\211\214\2568\275\361i\003k\334N\332\2155\326\220v\252Zc\253\332\020\336b@\316T\032s\330\314"
+	.ascii	"\267\021\327\351I\037\004\325\240aZ\235\310\005\211\024\333\013"
+	.ascii	"'5\302lF\247W\251j\304\262\t) P\002Q\006\3176b\350\333c\374|"
+	.ascii	"\311L\332N\336\3408\231\372X1o%\303\240kC\242\370+\022\243\006"
+	.ascii	"tj\364\303x\225\315&\301\030)mP\231\361j\\k\273N4\205\322N\\"
+	.ascii	"1c\r\243\206\201#\003\216\204\003\204\0064T\360\341O\242\334"
+	.ascii	"\030\303+\362(\025\300K\212t\001\355]\252\353\265s\017"
+	.text
+	.section	.gnu.lto_IOInit.18.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"-\f"
+	.string	"\306UQF\020\255(\035\320\222\317h\246 \031\322\273\330\2467\265\177\254\371\332eL\227\257a\201\246\330!\265O\273\376\021\333\232G\321X\242\321!\217c/"
+	.string	""
+	.string	"\f\252\026\020\242\272\312\027\234( \016;\271x\204D\262\367\336)\005<"
+	.string	";"
+	.string	"?"
+	.string	"\325\240-\342\243j\377J\325\270J\354\3566\027\034<\235\022\364/B\232\323\002\237\264$\002\200\f\031\341\211n^$ \334u) DIY\341\331]\313"
+	.string	"!\201\273\336\366\211\355\216}\225\034\034\330\376\3066\2256I\007|k\344\271{ \304\210\034_\001<\213d\213]\004\032B\264\327\017zi\177\302)\200_\225\256\261+2\330\260;\212\030D{\365\370\216\354U;G\366\030\252\335}\203\227\354\265\212\035$\244L26\023<h\301\246K\231\234\006D\024\026`(y\302\036Or*\260Oww=E\373\255?;\353\247_\375R\333\360"
+	.string	"\002e\304\356\200X\212\375P\0032\034(\324\325\217\013\305x\325\353\244?\034\257\333D\037\007\323}\240-\324\245\254l\237O\264q<\354\261p\337\346\342y\337\266\031M\367\230\346\211f\323\366\216ad\202N\273\345/\222\266\273&\376\205\031Q\031"
+	.ascii	"2\003\302\260\311\302\326\021\210`{\301\320\362Q3\200\334\232"
+	.ascii	"\336\370\031\243\240\341\321\025P,IX+\215\013C}\030\fsI\b\026"
+	.ascii	"\204\317\324(\270,M\215\026w\371\251\366\246hj\017"
+	.text
+	.section	.gnu.lto_IORelease.19.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\265\t"
+	.string	"\246\221B< \005)\035\340,.\2128\202R"
+	.string	"\t)\t\0352\231\367I\361\350\352\220U\030\221r\200\325*v\237\346>\n\242\030MB"
+	.string	"!3\\"
+	.string	"f\266\003\031\200\230GX\0262\310\336{\247\0240"
+	.string	"1"
+	.string	"1"
+	.string	"\273[\245\311\277O\031?_"
+	.string	"\344\370\034\271\234\r-\0365\004 j~^1\226\307<\202\200\251\030\003B\273\353\370\001\212\334\364\266\037l/\330\216\005\263\335\220Y\200\315\2417*\037\333\217\366_\016\363\275ez\301\256\n\305f7d\260\302v\352\360\b\332\351\366\003\355\324\237\315\363\220\265\177\245t\320"
+	.string	"\b\254\335\375\311\251\277\241\235R\025\216K\317)\316d\311\312\fL\332\244EI\262\332q\301RQf\207\250(W\366\347\356\256\245\312~\353\217\324@\246\003\021\035\027-\002u\\%y#\f\316\223\250\024\\\304D\025y\244\nJpW1\362\252E\327y\365\023\236\036:I\324\224\253\222f_\334U\332v\327\301\227\321\310\030\b\020"
+	.ascii	"2\003\3020\301\302N\021\210\030;\002\204V\200\300\243!\214\b"
+	.ascii	"\2623!\025\314\273\004\320\254\246\210\273\374T{S4\265\007"
+	.text
+	.section	.gnu.lto_IOGetOwner.20.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\005\013"
+	.string	"f\024LC0m\224\016\b-\214<\\\363-`\352\350\305\370~W\263\351RR\335\372\"\323u39\277\371\276m`\253\276X#\306\024\021\3226\201!x\n9\f!\252D\211\"\375\202\3208\226FH\020\331[\356\224\0028"
+	.string	"8"
+	.string	":"
+	.string	"\226o`\227\361\025\354RO\367\036\025z>\202G\022\017&B\337\350\032A2(\370\220\361}\"\245u\002\303U\207\242\017\004\241\005fw\rC\037\203[\336\266\210m\017\373\226#\035v\027\274V\354\b\031\302\202\355\333\356\330\024\333\020\332G=\325\371\344\\c\267\324\002\261;?\334\221]zf\266}\r\337\320\261\027\247\204\017cB*\001\013\305\356\324\002\233\263\006d\273\240\020\177u\240@\266\273\247p\351\033P9*\221\002\345\201/\205pa\345Rs0\250\r\"\2348\270@P\205=?PM\366\343j\311\361\363\207\206\276\2548 \021\334\006\235\271p\233\266\3514\004\266\316D\003\260\225\234h\231n\243]8\314\005\320t\232"
+	.string	"\216\3534\312\364<\256\226|\023I\204F\275\352\027\017H\025\240\357aW\221\032\343\321OT\223\003\021"
+	.ascii	"A\204n\211\030U\004\370\205\315i\265\3413&A\303\243+\234X25+"
+	.ascii	"\271\220\003\215\341\321\224\035\320\004 %\240T5\320\\\n\n"
+	.text
+	.section	.gnu.lto_IOIsFreeOrPreinit.21.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\305\f"
+	.string	"\026YYC\020\221\223\016\030\236Nt-\242U\242rAa\314"
+	.string	"\365\026\242\256\305v\371\t\225\363\335f\270o\030\262\242i\254\367\267\312(*\334\203\b$"
+	.string	"@iE\024H<\017:\020\005\204CK\343\202\220\275\267\224)\005H"
+	.string	"C"
+	.string	"H"
+	.string	"\325\003\304C\333F\240\240c\317\273\020'\027\021\203c\251\331\355.E\271\347O\323\343[\370\203\242\230\025\031\227\220\350\372\022\234\270\340\302#\264=\253\005\016\0237=MB\240L\352cw\235\031B\033nx\333\fl\033\260\257\005\351\370\322\017\235\326\364\253{\320PS\303\301\313\356\311i\307\316\2000$l\337W\271\211\344\235)\0304(v\327\"\261\255wl\313v\246\375\224\247\350\274Tr"
+	.string	"\273\243\224\027\273\335\001\027\250\016\335]@<\f\224^\257\342\004l\320\330dZ`\266<=%\231\234\235\305\204j\027\264\300g\031\341\370#\016}\n\3610*\024\305\344(}\362\244\037J\254\230Q\227D\250\034@\240\254\314\200R\207\335m\251$\373ow\327:\262_\232z\001\031\226\006\331d\330\305\321B*`\032\204+\002\366@\344\002\3218\327f\2003\t!\3325\222e\332eu\237\353\310'u\220\241Qoz\003\f.\334K\276\345\224\232\330V\365\307G7\247^U\225\206\023\251\244\276\033\334Eb\022"
+	.ascii	"+\013\370f\230B\363\304\314\246\345`\326\341\035\345\312\036"
+	.ascii	"\350:\272\227\213%t\263R\\\360\231k\027\324&\257\253\222\305"
+	.ascii	"\254C\225:E\255\332\003"
+	.text
+	.section	.gnu.lto_IOInitGlobal.25.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"U\n"
+	.string	"\306\022E<@\305(\035\260K@\272\236\252\332\016\355\226\213\300!\243\032Y\206\211\356\300\017\\3\005\260\032\361\277q_\332,\006h[\247t\f\263f\tn\250\026\347\303\016\254\234D\032\331{\357\224\0022"
+	.string	"3"
+	.string	"3"
+	.string	"\376\245\243\372\001\354\365\201\243\323\231\331]\0010bf\242\t,\305\311z\3746N\227\017\237\360J\371\300\323\343\245\263\273\216\037Xqg\267\275\331\336\330\237\001\324\3778\210\367\225F\033Qh-\226\030\200\335psj\004\3554s\202\354t~ ;=\306\236\335\3620cO\002\223\030\201\355n\225\030\236\247\364N\247\214^\322\244\311.[\034\001DT \242\200\271\273;/e\312\016K1\356\356\310\022e\177u\237\032X\240p%\273\023\003b\353\242&\032_\335>\353\036~h\314\003\242\216\003M{8\334VC\335\347a\353\030\252\303\266\320P=]\250r\n\314\201>]\025q\\W1!\351\022\245\272vr\341\"\311\222\251LYaE\376\232\214v\304\207\374\001\025"
+	.string	"2\003\3769\006\324\201\030QX\037C\354&8\270\222i/\314b`\256\\\356\351F\202\320'\270U^\204"
+	.ascii	"r\203[e\247e?G\2119\274s\315'"
+	.text
+	.section	.gnu.lto_IOGetByTag.26.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 \357\205\006"
+	.string	"\242\314-3Pm\222\016\244d\210\312\250,\316\366\304\022\236\013"
+	.string	"\016\016\254\335\254#\374m\027\3306S\205\367d\377\314\3144w\272H+b\326\r\251\361\354h\033\233\310\024\r\032\017\276\311TT\3538N\004\345\030\332\003\245qh\033\327i\031\314\025\004\3075OU\271vy\331kbH\361\357\303P\343\013\220\230\361\035\265\305\242d\312\211\204H&hE%M\244\222\216\337\372\313\217\354\023\024\254\216&\306L\f\017\222\314\207\260\201\245\322\177?\nb}a\036\207\250#\240\212\220\224\314\327~%\230*Y:0U\302\215^e\327\025\b}\312\002\0262sf\021\022u\354_\360\037\374\027\001\b"
+	.ascii	"2\003\202a\243\302v\025\216k\270\005\013\207\334\020\346^%\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`C\001\265\005"
+	.string	"\322G\036)\200k\206\003&2K\200l0\216\3304(G\362`\006f"
+	.string	"r\205\304\266ms\035\326MB\"\201\304\266m\326M\2046\3312\275,\031\303(E!\216G\253d\333\366\033e\366b\333\030\202\230\215\272\334IsN\3202W9\243\214MVHNDF@><6|\027\034\023\032\017\030\013\274\003\335"
+	.string	"\356k\333Z\\iS\331\323f~\332[P'Ns\316\211-\245\266\222&\032"
+	.ascii	"\240\b\256]K0D \032\213\273j|\321\003 \034|\003|\003|\003|\003"
+	.ascii	"|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003|\003"
+	.ascii	"|\003\374h\3339\006"
+	.text
+	.section	.gnu.lto_.refs.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a65981cc4498458a,"e",@progbits
+	.string	"(\265/\375`\337\023\265Y"
+	.ascii	"j\223\214 S0RBJ\007.\215\213\233\032\371@\207\256x\006Z\234r"
+	.ascii	"(\324\025R\272\t+\322\264\n\007\336\207\345\375\364l\016s>\332"
+	.ascii	"\3021\003\347_\346\377\335\245\216\201q\3231\343\001\237=b]\023"
+	.ascii	"D\303LRo\211\f\021\344\220D\212\324\246\244G OJ\376\226)\237"
+	.ascii	"\001\366\001\021\002p\317\"XW\375\013\374\344\252\227\364\346"
+	.ascii	"\327\3441\005\355\252_\201\375\231\0076\266\231W$\310U\177f\373"
+	.ascii	"y\tk\361\332\357\271$\355\261\356v\007'L\031\251\255\253\262"
+	.ascii	"\032\017r\314\226\333U_\002{\346\022\203s\302g\234\306f<e\264"
+	.ascii	"\237\311\270\354j\333m\326\335g\255v\no5\3410\034\247N;\201P"
+	.ascii	"\311\352n\377\300/<\243\361\030\207\211\300\321=\025U\243\303"
+	.ascii	"\322\225=\275\356\366\004\317\211\023'\33070\263(\215z\tXn\016"
+	.ascii	"\261\352\374\260\027\262\334\305^<\355a\2603\023\346\372\214"
+	.ascii	"\263\355iw\23333\367\345\307\330U\337\303\376\377z\216\225\376"
+	.ascii	"y\220=\367\2549\334\263\376\262$8\304\252\306q\210\365-\207X"
+	.ascii	"Y\006`U\377+\303\371\277\3216\245\013n\220\371\372_\030\376\337"
+	.ascii	"\375\327\362\231\377\272\200\006\226\374o\366cB\002\327\371o"
+	.ascii	"\321\177'B\007\361\337b\223\265\235\377v\240A\t\f\216\363_\013"
+	.ascii	"~\026!\204\004L\374\346\277\024\210\220\3405\377\375\021\372"
+	.ascii	"\017\302i\376+\374o"
+	.string	"w*\n\374\347\022\374\357\001\277\377\022\3603\b?\303\370\371\305\317@?c\360\363\005?W\3603\005?G\360\363\317\317\017\374\354\363\363\211\237\023\370\271\304\317$~6\340g\021?\027\3603\317\317\001\374\254\363\263\315\3770\377\301\376\253\375\357\362\363\357\177\226\377P~\346\377}\377\311\374\377\341\377\230\377z\377\305\374\007\363\177\355\177\336\377/\377\275\374g\373\277\300\177)\377\005\350\353\353\353\373U$\377\035\3767g\001(<[)\364\331J\231:\355\2242\273\333\250\316s\254\311\344\347t*\372\234J\243;\355lfO\2334\260Ni\364\t'\215\352<\247\315\350\3239\025\335\231\301*\310\036\216\037\274\266\270\207\247\263\233\230\242\232P\235\270g+\355\272n\036\263\321\320\022\335QRh]\263\007\247!\3055!\2315\245\0040!QI\333\031\367<\"\355>\202$\243\231 `\266q-\204\343\230UQ\275d\243\273"
+	.string	"\246n&w\\w3\273;\b\215j\273}\350<\263\230\230\272\237x\230:\212\251f\243\373\216eI\213>\247TR\241Z\3304\253o\264L\316\352\272)(;ev\365Rw\363\0276+\252\303\313\275H*\217)@\260\346\330\366F\314\r\256\270\253\336\276\334w\231\277\315el\234\267\325\356&\363\0018\314\007"
+	.string	"\333\256\232_\253z\216c\317\323oa2\277So\200\343\261%\245mk\322\244\310v\264L\267\004G5fDN\313\203\251JO\214M\225%\263\261\253v\341\001\266\231\r\031\013\363\004\370\365\246\244\t\246\347f\314\034\022\222<\023N\266&Z_\274\004\225\324\020Dz\325.\255\323\306\t\263\310\0176\366\216\343XN\004\322\023\350\t\031\336\357\300\017\3371\035\333q\334\323\004J\314\270\360\026\326\302x<\345;\366\341|\205\347\316\323v;\273\373\216\3338\n\307\215\265xk\202\327\335\362\035K\341*8\315\266\241\023\224)\275\345\310"
+	.string	"\245\303\027\215\312u\214\205\247#8\313\035\370\371\217\351\325Z7e\222\224\331\273b\317#V\356\343\021\3539\b\313<<\203\234\225\037\032\231\037J\254V3f\232%u\325)\367\360\267\335\315MEjH\361\3012\034O\341\251\t\246rv\343\267\003\233m\267\367\006>\262\257\253\236\243\354\331\304\372\353\353c\023\353\231\211\325\341\020\353e"
+	.string	"V\206B\023W\275\232\004\006&$\n\224I\017\\\364\272\272\356\027\210\226\226\t\341\302\003F\331\215E\275~\2778\212\002M\244L\266pqa\301R\251\240\361a\311%Ir\267\260D9\345!\261\261Rs\253\322\372\335\232!#\244\371u\325\273\204\371h\344zT\351\253^%\034\345W\327\243\213\214\035\220*\214\0264\270\035v\220BS\266w\305\215-\207\034\256\021\226nI\316\325\325\fRgE\212\\#\374\324?:(\247<$\353\224\246\352\302\341\327H\r\032\225U\r\262!C.\021\026\214\213S\236\036G\321\201O\f\353\227\310\357\242Z\315#W\275W9{nD\206\334\266Irb\223\352\262\262\2726"
+	.string	"5\003qs\312\323\013n\301AiN\310\257\r\267i\222\344\304\230~J\252\252n\r\267;\f,\t\336\205z[\203\002\344\267\206\260\037\033\2249\037WSS7\004\303\340\224\202@I\245R\254\345\231\027\303U\377\303!%u\237\200\230M\300h\231\030\326\366\242\242\256<k\220\332\302z\324\371\360q\237\200t\032In/\353\206\354\210\322\226\032\017\036\367i\246\241\335O\024P\331\335\267*|Dz\374>\275\215\351\366\312\274y99\335\035a_p\277&\"TZ\307\357\216*9]\262Ti.ij\272P\020-\355\316\n\212\311\235\341\365\323S\017\260K\f`\222r\374BY\256\306K-\272\304\b\373[\343\332\270q\227Xf7\263\355\034\353\027\231S\236^?E\365\340 \301\362\203\351>\177\227\256\222M\267Vw\213"
+	.string	"\306\215ISr\325\233\304\204\365\203V\227 \230$Wr\\\034\354\003\360\r\307\231\325U\017\206\371fn$\365M]\365W\007\373\373\257\335\204v\267\023\260m(\222\315\372\363\031\310\334\363\337\360\217Kt#P\327]e\225\307\032AkB\235D\037I7s\247\333\206>\247S\314'\230\225\350N\3334\f\320\323\252~\266SQU\332\267\333\346vNE\003+$\2252\226Id\220\204!\243\221\272<B&\211\200-\030\021\025\221\307\245\3211\205\021\212\305\233\243\265hH\210\005\026FC#$\215\\\330,\217\310\243Q\tCI4\032\225\031\034\r\211\303\235\245\321\005qHc<\0322\032\315,\217\310\241QQQR\2108d\223/\210C\365\bD\034\252\306\345Q\351\001q\030\2141d\f\"\016W#\362\370\302f\007y\334\241\021c\210<\336\200\340\2408\024\372"
+	.string	"\203\"q("
+	.ascii	"\215\030\303\2452\t\003\007y\204Q$\016\203'B\301Cd\f*\022\207"
+	.ascii	"\353\211\216J#\322X\304\036\202\024\f\244PA#x\025+\032X\321\300"
+	.ascii	"z\025+\204\302\025)\204\354S\b\177\313b\321\220P\362\0304J&Y"
+	.ascii	"\024\201\313\"q\250./\003\205\321\214\023\216\305\021\313\242"
+	.ascii	"\212 \rc\f\344\021xT$2\006%\217\301\344qF\221\272,\246\020\""
+	.ascii	"\2173~\306\"\321H\244L!ydT\346(\215\310\025\222@\022\214-\214"
+	.ascii	"3X\020*\022\2070\\\330\\\006\212\027BC\016|\226\306\"\345\320"
+	.ascii	"\222\304\2233\214J\237e2\251\364\251\t\nb\361\013j1\374\005\265"
+	.ascii	" \376\226E\007\036X\"\217)\260\027\n/ \321\301\006.X\"\024\311"
+	.ascii	"\243\317\221\322\250\302Q\031\303\007y\034:\301\207Hy\344\203"
+	.ascii	"b\200\240 \016X\250o\177IY|^\340\336\226`\346\234\\\365\256\375"
+	.ascii	"FY\273o*\\7R\003-R]?\243zn\304\364\364\370\334~\337T'\351\264"
+	.ascii	"{\222\302\302 ]\365>\371\205\362\317\004\351\256H\361\362b/\017"
+	.ascii	"\277mP:\354\216l\261Y\301Q\361\262\003{U\b\373\337\263\351=\273"
+	.ascii	"i"
+	.string	"4\320\f\256\354\360\032\372\264"
+	.string	"\220\027i\335U\177\323\316bl\244\003\254PV\230\030\271\252P\370\213v"
+	.string	"V\350S\3339\314\265\327\005e\252\254\354\232q\311\221\365\233\332\262\201\3546\3715c>\234\035\320!X\234+\235\227!U=\304\304\356\030?\235\3509\345\351\2555\340\230\224]\365\216Y9\202U\026\201\236\250\341\250\"\214\"\021\021\021\021\221$I\322\001a\005\204 \007!\323:\022\200%!R\034\205d\204&hRV\245\036\303\001\206\020o\244\343(Hp+\2300-_N\365\005~\366\277\272\314\336b\370\213\327\201$\001\357\302d\330 '\335U[\317\032\310"
+	.string	"\005\2537\345\330\327\275(\001\201\017\273\345\210n\351eAI1O \333\367\024%\036\233\272b\372\322H\033\376b\361\214\017\022,\253\215;$[D\244Sae\007\323\363\235\246\222\221\350\370v\006\2511Y\220\272PA\315TAP{:\007\3549\333\334V\206'-\022\026Z\343\321\277&\177\350\211\261\234\233N\277P\240f"
+	.string	"\202\220\246\322c+v\221G\202Q\032\316\245\242\n\343\340\320\253\013`\250\275\203\266\3118\262\224\2359^\263\b\204 \323\374\202\310A\200\253\201\027y\265\342%{\243qR\250\240\273F\177p<s\273\330\346w8\212c%\254\256\367\n83\t;\325\267`\353j\227%A\351\226a\331\316HIr\314q}\017\333\334\200\343:Q\322w;\022\366\022\257\375\f>"
+	.string	"#\346nMQ`\276&\274\205\355S\342\325[i\302\315\206\326\001\203=\323\377\316J\363\370\274\266jV\263QQ\024\327"
+	.string	"U=t\314\026\332\007\365\264\373~\231\220\351\344\001\337A\263\016\255\234\022y\227\201B!?E\022Hj~WPP\"\271fJMR\213;D\244c\251\255\001\326Fyl\n\234d9y]\0017\003\201\022\220T\322$\315\325O\243\362\317vfZ\377\t\327\230Fj.q\315\027\313\275\230bb\354>\261\372\220\267Oz\246l\206V\203\025\272<+\200<\307z\340Uv\360\306?%\367V\276\021\f|\210<\324\231:'\025\375\372\016-\004\203\034!J$\247#\357\305\356_E\"\241\325\214\314\315\026\214\230=\345\356m4a\020\361\033\024\212;5\240P\006f\232f\334\370Q\260\276Gy\312lI\022\220\277\374\035R\006\f+3^\030\211\346r\235FY.G7\336\326\333AB|\t\2043\201]F\204\372\013\2751\221\357\331\377\356\002\357u~\336\213\030\224. \313n\302Yn\223B\201]}\257\221`"
+	.string	"\362w\\\356}\265\364\351s,\312s\0047PL\2359t#\260\370\356\304\254\335\355pD\367\340\321\200\037\327~;\357\235\315\330\034\247ks\266\006\026\341R\237\034\037\245\274H\003\364&\275$\334\002\374K\333\002<3\365\341\022\216\266\273\327\0253\201\030\005\217%|\354UzFV\300\301v\334O\371"
+	.ascii	"\372\023\376C\351~\376\340|V,Hd\364A\343\204\345\230\354c\221"
+	.ascii	"\370\303F\354\025\373\322\270D\034\330\206>D\260i\210f\260\354"
+	.ascii	"\177\351l\311\320\342+\314k\032s\3722\366\233\036\240#\006\334"
+	.ascii	"~\337\024\377`\223\304Q\377\216\233k\372\355\232]~\207\376R\255"
+	.ascii	"\340\320\374`\361*"
+	.text
+	.section	.gnu.lto_.symtab.a65981cc4498458a,"e",@progbits
+	.string	"IO_Rec"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"IO_GPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"IO_Pin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"IO_GPIOPortIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"IO_EXTI_PortSourceGPIO"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"IO_GPIO_PortSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"IO_GPIOPinIdx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"IO_EXTI_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"IO_GPIO_PinSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"IO_EXTI_Line"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"IOHi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"IOLo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"IORelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"IOGetOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"IOIsFreeOrPreinit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"ioRecs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a65981cc4498458a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,487 @@
+	.file	"light_led.c"
+	.section	.gnu.lto_.profile.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 |\375\002"
+	.string	"\244\004p"
+	.string	"\t"
+	.string	"\366\254\342\276\002\b\002"
+	.string	"\002\001\001\251\245\204\311\n\f\002"
+	.string	"\002\002\002"
+	.string	"\002\002\003\002\004\352\263\360\321\b\003\240\342\234\212\n\004\275\375\215\235\005\005\237\326\324\323\t\004\002"
+	.string	"\002"
+	.string	"\006\365\341\253\351\n\007\b\240\342\234\212\n"
+	.string	"\007"
+	.ascii	"I\211i*|\241\356\332\225\226\273\376\216\247\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 O\315\001"
+	.string	"D\002C"
+	.string	"\004"
+	.string	"\001\001\001\001\001\002\005\002"
+	.string	"\003\001\001"
+	.string	""
+	.string	"\004\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001\005\002"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"4\205\230*5)\013`\007:l\331\360\262\034\f\332"
+	.text
+	.section	.gnu.lto_.inline.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"]\006"
+	.string	"rJ!)\200)I\007s)<\\\366`\346\2224e\n\252\253"
+	.string	"\200\213`Qk"
+	.string	"\273\213\313\2202$\362_h\355j\244\265\275\245L\001\237\236\231Z^\032\221^0pc\316\222\374\250d\003Q!\204(\250\t\264\371(\305\335\t\234\fPG\225wT9\250\t;=L\317\365\f0~z\372d\352\3556\330\224\303]\004\375\243*\036 $\0306A\235\224s\"t\201A!\2021\377{\235\3057\265>\235\272\273Co\323 \034"
+	.ascii	"G\233\001\207  \220\226\032\270n\213cR\234P\241\255\226@g\013"
+	.ascii	"6\210\341\2640\002wfh\201%$\205;\254\226\2351na\356\3439\256"
+	.ascii	"+\254\fa\275Tju\254O\231f\351\327eU\r\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 \274\005\003"
+	.string	"2\205\016\026\300%\035\377\277\013\370\375\177\377\365\377\277\006\255\031\327\366\336[&\031\344\023\320\263^\360-\243Kq\277t\036\366\303\372\\\365`4r\341\222W\"\234\310$\265\234\377\336<\211D\016"
+	.string	"0\013\300sI\341"
+	.ascii	"A\367\336\241\007XEN\370@i\200v\203\022\372y\001L\242!\223\274"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\231\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 ou\002"
+	.string	"D\003c"
+	.string	"\004"
+	.string	"\001\270\006"
+	.string	"\001\002\t"
+	.string	"\001"
+	.string	""
+	.string	"\001\b   "
+	.string	"\001\001\024"
+	.string	""
+	.string	""
+	.string	"\002\002\n\002\013"
+	.string	"\001\002\f"
+	.string	"\004\001\274\001\005\002\274\006\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\203p\001n\350\n8HQ\267\374\264\244r\030\3058\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.6bf95e386e65b511,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.12.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\237\235\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\317\007us\350\345\006uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\371\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/drivers/light_led.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.15.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\315\n"
+	.string	"\226\223IB\020\3478\035 \264\307w\302&"
+	.string	"\317@x\306\355m\017\373\315W\3453\354V;\021"
+	.string	"y\312\345\221\177\304\336\323\302:\274\202\335\345\265\036\031"
+	.string	"\240\0210SBP}\003\261\f\2104`c\372\330D\310N)4"
+	.string	"6"
+	.string	"6"
+	.string	"!\213<\367\234~\341\273\347\271\302w\317\247}\200a\344\200\200\253\306\266\273 \227\362\363\365\364\037s\203\027\214\365\332\241\330]\327\027\314\344\346n\373\301\366\204\375S\367:\032z\"K\320\2527;eU\016\305~\267\273k\016\265?\373k\207#q\325@\265\335\222\333\202-\340\tX\371\330~\265/;\314\371\331\352\t\273\250\201"
+	.string	"\273i\366\313\317\3468\200\322\3457\317\301\251\367\200\317v\232\333\016\275fc\321\362r\325g\033\3424UClw%l\217\317|xv7\342\236/\003\022\002\212\251\334\363W_&1#5V\224\302\213Re\216\314\022\301$Q)Da\230'\223\210\002K2\354\020\311\022\230\022G\032 \211,A\221\203\307\215\220\004\315q$\301O\272\357\226C\335\261\254\002\004-N$\023"
+	.ascii	"2\241\237/0<xd\027\304\241\273^q\002\306\355J\325j09\\\t\fq\225"
+	.ascii	"\032\374:\017\310\204f0\357\022@\263\232\022\356\360\242\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_ledInit.16.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375`\360\002\205\026"
+	.string	"\306\351\220H\300XM:$\210&\206Y\005\356\213\223\366\\Y\\\215\246\276y\203\377\020\005\"W\312'\344\362\240\261\326dg\016\301.Q\221\264\321q\262\324QU\b\274(LC\207\350Dh\267hCx\216\n,\276'\204\220\275\245L2|"
+	.string	"r"
+	.string	"|"
+	.ascii	"\261\327\204N\240;\351\007\220n\033\215\326|\237j\373K\367\371"
+	.ascii	"\275@\367\2511\325(\267-\365o\343\221\216+\335\035\262\013\345"
+	.ascii	"K\333\325\333\330?\257\233\2227\246\367nn<\201\212!\343L\374"
+	.ascii	"']\230\220\240\311\006\2134#ZO\006\212w'>\001\314N\\J\231)NV"
+	.ascii	"\004\314\212\344\313\b\030c\313L\266|\246\313\320\244\2143\024"
+	.ascii	"_\357\246\273"
+	.string	"u\307Y\211+xU]\241\252\020T\031\fs\237F*\372\341\270\327\327-s\240oR\005}/>\365B\f\312h\242Q\033\332(U\233\270\254\244\372ww+'\251\246^\373\003\374v\005\345\352\307\253\336\256v\273:\345\252\344U\336\325\335\325\277tB\226\300$\351\036\021\225\245\225\314\\\214\337\256z\233\236\t\307s\304~\323\247O$\361\341n\"\246t\367\314\247>\370>c\344[T\365\253\372\032\267\021\222U-\\\330\217\032c\304\242v\354\361\241\374=\335\344\216o\304\202h\243\024\344\311\237\221\002w\004%9\bN\252Iw\333\350\235\236\303\240\031rr\240\270,\263\252\316\316~\224\034#cQ\227\2315\320\242\216\240\024\352\210\211\032r\325-\273nNd\213\305\347>V\n\226\272e6\252<\357\301\372<\260\264|\246/\300\201\243\221\343\356\026\231\225X\277\343<z\364/\364\247\265\037[\335\003\254\363\2608"
+	.string	"\265\"\250V\023^A0\035\330k\200\356\324\250V>\033`\035xX>\341\313\265\002\301r\251B \226\316O\270\343z\2055\b\264\345a\345\na\255\226+l\261\3659\351\306\277\246'%CL\364\261\222zF\272\024\263\223\2359\310H4\007\371\265\313\356n\217\301ANq\b\232\224\355\302#\301I592\235|\\\251\262b\213':\246\201\235\371\307\252\022(\024\261\250Ep>\"\037\277G\221\034\314z<_\241\013< `\002\031:\254\007\342\200\377c\360\355q2\310.XM\251o\253\004\312\351\354\336\032\305:\327\034\267\364eM\345\353\203]\244\017\035q\325\306woi\220\240K\206\313\005\3041\261\326U\253\324\213\346\024\330\273\tc@p}\213\242u\373lq5\254Y\340\354\214\270\023\247#VJpl\267Hf\305\350\355g\235\345\r\001]\3305"
+	.ascii	"\025\341\335Y6\326\254\350\367^f\b\320\266AK\324\352!FI\007\331"
+	.ascii	"T\343\373Z\247}O"
+	.text
+	.section	.gnu.lto_ledToggle.17.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\225\b"
+	.string	"v\021>6P\217\032\003 [\374J\206\n\200\322\200w\361\001\324\"AeNF\2613\202\220\253\351\200\365\006SH>6\231\250\323\270M0\242\312\004kyNj\004m\271\245L),"
+	.string	"-"
+	.string	"-"
+	.string	"\022s@fY\257\205\361\n\344f\2454Pd\376\317\370a\317\320\253]b\355;\225\f\001\022\376\027~'\0167\272mA\333\203\266,\001\177#\252\265\312\216\020\3262ky\031\210\3717^3w\311V\310\246\255a\353\021\223xVU\245\332\337\221J\371o\320\216\306\222c\201\314\001\334\004\364WNF,\265\355\205Y\"\315\177\204\332\304'\024u\312\262\026$\350\317\262&e\226\216\013+\"-\023|\265\253\022\214\036\255\261?\237-\024\353\351|\266\020\303\350\301\001\024\232\242n\253"
+	.string	"u\237\031\001j\200\230\236N4;\004\345$\266n\2168\256\233\233\325\215=\242\252\340\3422E\214j\320\261\r\b"
+	.ascii	"3\241\303/F\361\031L\300\250KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_ledSet.18.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375`\250\001m\020"
+	.string	"f\341pE"
+	.string	"\261&\035\177\352\234X\330\272\345\273\027\"<=\f!1\017\376\t\356\241k\332&\324j\342`-5k\3007@b\024\035i\356h\fN\377_\332u2h\302\022\303l\212\246u\354\351\215\272\021ido)S\nY"
+	.string	"Y"
+	.string	"^"
+	.string	"\217~\332\267\271\t\324o\334\302\332.\207\020:\273\033b\221\354q\364\001\330#|"
+	.string	"\354\321([\306=\020\373\027\tV\316\317\356n\372\341\250G\250\211\362A%Z\313\225z\2149\f\271b\256"
+	.string	"\\.p\264\273\177=_\\\253LP\311\356:[\256\f7v\333\fl'\260S\024pw\327Jc\337\373E\307\271=~\363\207\236\326b:{\032\224i\354\351\3704|Za:\237\376\207h\306\006\r\035J\350\013oa\276\033\333\023wD\034\347\267\377\227;l\343P\030\245\274\205Q0\303c\363\263\353\201<\232\304#$\250{-\004\356\243c\303\263\353\205x$\0131SmG\225\037\214\230\202\364\230\206\260vV\371%\364\320\250\220\306swS\372\026L\244\021\203\317+\206K\3260\310\241z\350q\260X\250^\241\236%\263\312\317\251\252g\345P=\347'L~\215'\234\362\255\023\366\230j"
+	.string	"\206\214*?\207\364\300\257\025f\\\\\270\261\312\317\366R\251\036\354\007$n\245\343XTJ\231\212)I\034\212\332D\204\304\2414XypRB\331N\035\307R\352H\233J\311A\312f\322\2356\221\0026I\340\272m\305d\352\266\016o\017Wi\234\020\244\002F\254\320\250\232\276,\260\321\243\322\225?R\323Lm\023.\337\362\310\202\246 \\\305I\266\273\b|\024OQ\362k\036\035!%\005{\034"
+	.ascii	"@\205\006D\304\nh\214\177\004\241\262Lu\246\204R\247K[X\2028"
+	.ascii	"P\327\347*\301}a\013\217\005d\315\2160\367\226\272j\246Y\336"
+	.ascii	"\271\320\324\241mE!\377\264\373=\033\fN<0\312S5\206:\275\265"
+	.ascii	"\245\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\315\005"
+	.string	"\202\310 )p\213:\251\372c\235\373\231\351\364\\1\327\265\212\215sEc\300\350n\225\256\372\353\002\327'[3\262\265)\331ts\267\224\002\216\306)\017\024$#\212t\t\330L\227\307\334\034\315\304\022\270$\3507PO\240\333\247\334w\327.t<\355n\261\233\246EN\232\366#t4\026\240\"L\200\f\203?F6\n\322T\333L\263\007\253\246\264?\356e\315\275\245\330\003\271Tl\2653\222C\273\273\225^\217\355#\002\026"
+	.string	"M\233G\300\032\032\f\315eP\240\036"
+	.string	"\034"
+	.ascii	"\034>@:\\\nz\202\341\022\202=\264`a\200\002\204\201\341\026A"
+	.ascii	"\022\026L\320\016(\003\346\\k\342\001"
+	.text
+	.section	.gnu.lto_.refs.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\004\001\001\002\002"
+	.string	"\001\003\007"
+	.string	""
+	.string	"\003\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\001"
+	.string	"\002\005"
+	.string	"\002\002"
+	.string	""
+	.string	"\003\013"
+	.string	"\003\006\002\007\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6bf95e386e65b511,"e",@progbits
+	.string	"(\265/\375`)\021-W"
+	.string	"*\230L!Q@\320\322\031\016\r\202\351\313\nF8\374\343\030\302\363\301\006)\313=\342\324,vP\340s\225O\300\244\322f\006\261i\024\343t \210b8\2060\2354\036'\334\245\335\3726\030\264\030\242J\335\274\352\272\205\027\240\273j\311\213`\020r|\277q\023)S\276\001"
+	.ascii	"\002\005\002\353\366%\263m?NK\346\354>\356\222\b\332%\241\343"
+	.ascii	"\245\206\343\027z~\227\351\372#%\225d\311\2666\267\346\253\371"
+	.ascii	"D\333\264U\373Y\362\310\340\332\262\230\217\3330g\223D\315\307"
+	.ascii	"\024 \351\022\355\020\37286z\341\200\366\345l\177\b\3711\267"
+	.ascii	"n\0213n\312\360\371\257\227\355rJQ\303Z\303'\027\242\237\250"
+	.ascii	" hN\370\374\332H\317\300\3373\333u\257\004\355\272\217]Y\335"
+	.ascii	"\255e\267,s\315\026\313wl\263|\327o\327\337\373\027`\261f\233"
+	.ascii	"\303\226\205h\352\026\022\2047\006\216Y\027\247{=At\302\005r"
+	.ascii	"\211\024\224\f\250\207\255\036\352\370\274\b\3517HG,\b\364t "
+	.ascii	"\375^\371\227\312v\255X\n\335N\335-\300N\316\2324f\370\334\257"
+	.ascii	"\005[\246\210\r\373\002,\2763Vi\256\356\225w\372X\243a\t\237"
+	.ascii	"\357\245_+\017\340\330,\316\223\276\271\"\320\365\352}\253\f"
+	.ascii	"\241I\252\265y;-gOr\370dNw;\204\022-\210)\377JY.\021;$\216e\213"
+	.ascii	"u\257\037x\253\217(\"|~]\020h\272C\350\277((-\375x\376-a\205"
+	.ascii	"\236\1777P\377\375 \251nE@\372\367hUX\003\226B\374\033\367\277"
+	.ascii	"\354?\331\377\260\377f\377\305\236\376;\346\337\027\377J\360"
+	.ascii	"o\004\377>\360o\003\377:\360/\004\377R\260\007\374\273\342_\026"
+	.ascii	"\233\302\177\241\237\233\376\365\375k\302\277#\374\013\302\277"
+	.ascii	"\034\374{\301\2770\376\255\340\337\363\177\363\177\335\177\272"
+	.ascii	"\377p\376\313\251\375\367\362\237\313\1774\377\307\374\217\361"
+	.ascii	"\237\355\377\332\377/\377\317\376w\371\317\365\277\200\377a\376"
+	.ascii	"\243\315f\263\371/\230\237\211?\020Y?P:\270\b\331\2323g\233\351"
+	.ascii	"\332R\373\245D\202)&q=|\233\\\007\007\313\223{9{\230IYc\222\376"
+	.ascii	"[\307\334\272]\323A\236Q\304\344:\231DqF\222~w\330\245c.\335"
+	.ascii	"\226\355\332R\036\\\221J\213\323\311\025\3059H\372\3352\264M"
+	.ascii	"\233\205\343\006%\225\246\265\203z\"[{\363\205\343S%\246Cs\016"
+	.ascii	"(\216+\207\346\234\033\336\231r\335\262\362\350\030\022\004\t"
+	.ascii	"\237\347\036\3517\315\252\371\256\371\232\225[\252\336\301\211"
+	.ascii	"\221J\213\323TT&\322\272:(:\035\276rg\363\323\315\325\335!P#"
+	.ascii	"P~(\341\363o\226\315\177\036\024G\2243S\330\304\371$\331\241"
+	.ascii	"\004\303\205\007\244\306\224-|2\027n\261\364\360@\323b\206I\317"
+	.ascii	"?\332\307dw\353\320Y;\331\364\363\325\3315\361\003\355n\021\370"
+	.ascii	"\177\366N\004Vw\325\333\\zC\331\021\b\217\350ku\033?\364\332"
+	.ascii	"I$\230\225\021i\205\214\362\303\3323\b\320`D\032\271Z)\317es"
+	.ascii	"\257\275\355d\245l\001\271.\223\310ui\024j\247\245\261{U\n!\305"
+	.ascii	"\216\306E\202Y)\221`K\345\207vjc\203\035gH\235\226J\244\332R"
+	.ascii	")\204\004;*\221NV\312\017SoFn\330\350\252\262d\307 \235:GT\325"
+	.ascii	"1)\324\206\\\227\375\326\275bO\235D\240\273j\231|;N\255\226\246"
+	.ascii	"\266\034MY\216\313]\273{\200\250\246\253e;\265!\235,\273\235"
+	.ascii	"4)u\324\n\343\332\326G\266\315H\244\252q<u\023\320kwT\267q\273"
+	.ascii	"\255\273\215\335\275\223\254Z\273e\020BfEEuS\021Eu\225\321\354"
+	.ascii	"\251\233\305\324hQ\"\301\256\226=3&XV\327X\215\233\325oV\311"
+	.ascii	"\024\314\350\3258\272{\335\244Y\312\035m\370\\4=j\310&K\212\244"
+	.ascii	"[f\315,s\317\374\254\262l\260\356\025hw\364\261Vf\002\3455\233"
+	.ascii	"\315\346\232@\227\f\357\230<v\316\202\242y\343u\305'cY\265's"
+	.ascii	"\250`\361\225(\033\252\354`\026\343\305\235\365pSC\372si\305"
+	.ascii	"\n\035\317\030\024\035\017|\376\274\361\365e\362\327vY\241\356"
+	.ascii	"\253!Z:I\205\"\255\223\002\223\234K\277[\313O\347\037\313\344"
+	.ascii	"'\366\"\362Z\215Aj]U(v\306|ij\361\271\356\034\321\234AC\223~"
+	.ascii	"\271\204\360\262\013.\310\fk\220\260\022(b\226\353\357Y\361\020"
+	.ascii	".5\\\265\305K\030\312\266Q\t\265\023Y\0349\276\342->\262e\333"
+	.ascii	"F\005A\2247)L\205\273\230\213\2658\nOY&oq\rg\031\030\310\211"
+	.ascii	"\262\360\026\023a\254m\303\242\200+\315\t\242\023\2749)aSB\247"
+	.ascii	"\220\307\205hBj\320\305F\256{\375\317O\030\207e2\224\023\255"
+	.ascii	"\r\205\231\260\223m\243Z[\307\t:\b9\033\340\004P\2332o@P'7\004"
+	.ascii	"eY\215\270\341\223"
+	.string	"m\330\241\232\nC#,k\231\334$}\243eV\027\347\363\005\311\025X\372]W\372]\223$\251\031\271 lI\322\357\214\244\337-S\246\201\213,\263\004\033\371z\361\325u\216k\257\234d\316\225\257\251\364[\002\3355\233[\002\375NG*\264\203J\277\243\221\376\274\344!:`islC\266\314m\rG\023\237\337\031S\241\035BG\230\350\301SL\365\363\360\242h)2F\227\236}t\200D\314\030\237\347\336\013\312;\316<~\036\016\303$+j.=+Y\307\317\023\364\266\344\212\027\\zN\352\2145\347~\360\311R\351\023\263\225\350\tB6\204\245~\266\301P\234#\206\346\234\035\370d\034\034u\316\3017\232s\254Xv\0379\007ON\367\221\267Kb\227\304\031\345\212\t\026\364<\243\245\177[\020(\320\016\241\\\243wF\372\260\235\311Q\341\363ge#\033\331I\250\233\334\266\262z\346x|\375\340\223\235"
+	.string	"\250\"\203\303'\037\357e\237\230!\201[2\001j\0218$\301\250h\307\250(\375\035\305\230aAQ\315\300\250\250\307\250\b\275R\n!\220\250\350\023\002{\214\212<\310\300\250\350g\006\223\020\006"
+	.ascii	",\250E\342\214\020\002(^)\305\217I\305\217i\b)(\303'"
+	.string	"\270\002\017u\210\276\237\242/\370c\322\t\376\230vJ\305_P]B\213\276\026\275T\215\001H<\211Du\230\224t\2643\203I\210t\016\213L\273$5\370\003.\035\355$\251D\031gP\b,\"\251\304\235\017}?\246\024@\303#%\244s\306\260H\004\376T\020|DE5\204$u\tU\227~?a\214$u\211\207\230\244.\235?E`\260(I]\3329\222/\210AQ%\252 \374\230\0068\022p\250\006\325_\372\025-\022h\341\002\206\235\273x\241\300\013\005\320\273x\321\353\275h\321K\337\242\267S}C5\370\202\221\2124\224!$\252C\336\222Ph\201O\247\3503*:\213W:\340B&u\250\242(\024\016U\370\024}.\212A\240\214\235\240\020\030\004\362\020}?\340\nA!\214$\225\003\242\214\342Q\221\370\241\350\333y\257\007c\204\b\035d\220\"\245HR\227|E\245\037pI\005q\250\272"
+	.string	"\034&\251\b\002\217XP\2014$\252Ha"
+	.ascii	"\361w\024C\bD\323\210\001\203\032\363\342s\rB\241(\251a\206&"
+	.ascii	"\255\247\254L\027#g\262\360\322h\230\341bf\313O\024\223\0324"
+	.ascii	"\312\360\031\220U\223\251\206O&\343\003\316\2320|\206m\224\215"
+	.ascii	"'XcV\256I\223m\b\237jj,&\311aGh\240c"
+	.ascii	";\213\341)\271\216N\370\344\265U\343\325\2411Q\002\007\006\f"
+	.ascii	"\247\255nrZg\030\333\323\022\355\234v6>eWX4\324xj@5\255\334\272"
+	.ascii	"t\341\263\t\226nrZE\352nx9\237\255Z\020\217\244\2224b(\2326J"
+	.ascii	"\210\200!#\343-\021\264"
+	.string	"\271\311i\005\275m\211s\305\354\274\205G\316\221\343\027\237\254e\325z\334\246\3044\237\\\266o\273\267)/9eWp\340\312\314\322\207\205q\226\255\322RDTV7\2718\335T&|\306\260\232I\002\201G\250\201$\207\2245#2#\"\"\322&\351a\005\204\030&\251\263\016\021@1\223hfD\223\244T\33086`\372,\264\214?ACt\250\3068\267\261v\302\333'#\223{\230\006\337\032\311\002\314$d%\264Ep\277\002#{\003\260\315\330\204\350\203\025\300|A;\305\207\214\241\237\335\036d\220\240\322\f\355\237L\0254\312\262H\357G\353\241\356\033\r\0017\232V{\003M;\305\216\352\226\007S\365\305\203\277-\366\350\006ZU~\305(\241\342&\035\203\024\202\330\324T\243\3224\3028:]u\356\262\251U!\340\250\317\212\221e\210Aq\301\353\254Z\232\246\035\324%\177\226\207*\026\177>u\340\345"
+	.string	"\351t,\337$\301.\201\017\253\323\233\020z8"
+	.ascii	"d\031\252\333\002N\224EN\336/H\270\311t\304\221\256\251{('\t"
+	.ascii	"\317}\316X\224cn\373\234\260\323\261(\256"
+	.string	".V\007\0319\346m\234}TS\005\277D \372MA{(2!\206\272\225L\013\212\352\202\251h\236-O/<2\f\2772\343\002\342\235\201B$\322?\374\377|\fq\356)\3774B\327#\217\272{\227f\021\032\310?\312/\237\316Mt\361\335\n\236\375\247\251\004\241\235\343\016\n\377|Ca\346.f\344\241\300N\370\206\343e\n\262\360\214{\201,d\244\220\b\230\252\332\222V\216\345\tEm\r\214\374~\212ft\361\270\\v1\3303\245\257\262\266\314 \222\231v\206\253\026)\352~\363{#\\\337^Z\360\273s\242\336Y\205^2\226D\0220)_\030\370\206\321\351\224Zk$\360\001e\360\275J\334Z'\274\1777\375\305\277\030\301\304x8\320\233\004\361\357s\324\226\200\321Z~\020\234\204\224\233\304#I\247\204vt\367\004t\265dR{HG\235\\\217\023\301\223\214\251\306\246\213\222qA\372?`"
+	.ascii	"\340X\214\303\033\244\303@\330\272g\205\261az;\342\234\307\024"
+	.ascii	"\t[\270\275\343\350f\212\032({twg\356\006\265r\2312[\240\201"
+	.ascii	"k\013\227\217\220hM\312\377Mq%\346\321\207PG\206\255\332\004"
+	.ascii	"G\002\"\rs\341\231Dn\364\361\213\f\226O\037\021\370\311\310\036"
+	.ascii	"\376\3210\250\r6\034>\231-\261\021p6q\307j$\305\330l\007\026"
+	.ascii	"\333\2006t\267Ln\346\237\004\226\301\372\310\264m\333\314U\306"
+	.ascii	"|\350%7\022\336^\313\007r\b\274\215\366p=\3021W\311\276\351*"
+	.text
+	.section	.gnu.lto_.symtab.6bf95e386e65b511,"e",@progbits
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"ledToggle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"ledSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"statusLedConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"IOToggle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"IOWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6bf95e386e65b511,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1035 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\016"
+	.string	""
+	.string	"\023"
+	.string	"\027"
+	.string	"\030"
+	.string	"\031"
+	.string	"\034"
+	.string	"\035"
+	.string	"\037"
+	.text
+	.section	.gnu.lto_.icf.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\325\n"
+	.string	"\224\020\362\001"
+	.string	"\037"
+	.string	"\274\205\242\255\006"
+	.string	"\001\222\252\354\340\007"
+	.string	"\002\003\317\253\250\341\002"
+	.string	"\004\307\276\344\257\003"
+	.string	"\005\232\372\246\216\007"
+	.string	"\006\007\b\t\354\301\314\336\005"
+	.string	"\n\013\355\226\302\343\005 \002"
+	.string	"\002\001"
+	.string	"\002\003\003\003\016\272\215\354\310\n\n\002\004\002\005\002\006\002\006\002\007\002\005\002\b\002\005\017\240\342\234\212\n\020\314\215\357\272\001\030\002\b\002\t\002\n\002\t\002\013\002\t\002\f\002\t\r\004\002\t\002\016\006\002\006\021\372\364\363\351\002\022\335\316\371\202\b\006\002\017\002\005\002\020\002\005\023\364\330\366\355\b\f\024\250\257\256\333\005\004\025\255\313\264\227\017\007\002\005\026\361\342\207\357\007"
+	.string	"\027\212\333\334\276\b\n\002\005\030\317\262\324\372\013\013\002\005\031\247\250C\004\032\223\277\363\352\001\f\002\007\002\021\034\333\354\351\313\n\n\035\211\244\373\255\f\f\002\005\036\305\217\201\375\006\004\017\002\005\037\346\341\231\311\r\002\005 \350\300\306\254\005\002\002\017\002\017!\352\263\360\321\b"
+	.string	"$ \200\202)\264\036\212\222\273\241\337\302%\022\262\235Ac\017 \177~\374\343\">\362\261\344Q\024d\206"
+	.ascii	"\034\f\250\r8\260\345\252\325\332\256{~7\005\346..}\311\356\322"
+	.ascii	"\r\017-\354\256@pp\305\323\f\026\0073\030\202\036M4V\301\207"
+	.text
+	.section	.gnu.lto_.ipa_sra.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\355\004"
+	.string	"\202\307\024\032\200M\206\003"
+	.string	"\030f`\006\346\002\3566\360\244\005\020~i'\221l\262\345N)N\310c:\264\021\255\232Q\307\330](\322K8\372\\,\025\312\372L\326\210yX\225\344o\204\334\260\005\302B\273\017\364%\330\2019\013\330f\255&f\252\275M\3635\362H\037"
+	.ascii	"J\340B\261\333\323NN\002\246\001\334a\020u\001aZ\017\223\261"
+	.ascii	"\212a\241\272\300\036X\206Z0\nB\357\320p.\230\2601L\273/\306"
+	.ascii	"2\026\005\266{TK9\002K\240\001b\354\274\306eq\314F9\227\327\300"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_.inline.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\321\003\345\013"
+	.ascii	"\322N22`k\323\030P\302\214\025\020B4v\242(9 \201\334P@^\032A"
+	.ascii	"p\302\372)-\326\020pYIX\246\033s\323\357\267~\366\030\265Q\023"
+	.ascii	"\262\245\334)cr\323\0172\217A\301\361\363\260\371:\327\004\234"
+	.ascii	"\317\356V_^\177\200\030#\nJ\030\337\305\006\226%\314\264\330"
+	.ascii	"|\235\312\003\022\002\026\fz\342\251D\177D\322.!v\227: #\007"
+	.ascii	"MY\363 \227Sr\354\356"
+	.string	"\343l\310A4\326\223*7\355rZ\222QKF9\273{\035\271t\315[\3630H!)\":&\262|]P\217\206C\006ek\210\216\211\\Z\337%\350/I8\\5\351\355.\302\025\365\230\244\b\212\232\3603z\206\335m\370|\270\345\356\256\376\345X\021V\250\301`\215df\233z\026\003\240\"\231\"\362\001\022\200u5%PF\200\004\317 \321\b&\030\212\357\003\213\305\004X,*\367\277\230p\375^\236\007e\373\372E\343\260O\3202\016\372\305\235\025i5[?<\003\213Y\205\373m\364\016\3322Se6\002\246)\352f\223\302\326\264n\030\317\226\227\336.\353\252\304\301V\375\005\233;\024\232yN\213\220x\346\031\323\017P\037\200\020\203]\344m4\313\246\"\360\207Ho\001w`'\031\246_m\362\026\2447-s\252\264\265\034\213\257e\210\236\375^n\022\304\303\356p\f\034\"rDfkp\316\262"
+	.ascii	"="
+	.text
+	.section	.gnu.lto_.jmpfuncs.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`,\0015\b"
+	.string	"B\317)(\200)I\007&1)I\0341\226\031\230\276\272\320\204DL"
+	.string	"5\207\f\322\006\374\021\354\267\215\034p_\364\026\021\273\211\224)\377Z7\225\3073\274\254+S\206O\240>\033\330#\004\221\020T\036QG\017\232$c\245\247z\006\245\003\311\243\220\260.!\254\3734U\216\205\235\236\361\354\263\201\226\251lH\034|\343\257\374\254-K*\tEB\301\007\324\276\372\323\027\254{\335?+\270\240\271\240\222\r\215yk\357\220\004OcV\204\306\360\025!\004j\333K\275GC\224$\001\025\360\214\007P(\365.\336\024\236\357\363_\270+) `\002B\311\346\001\260 Z#2B\370\035\320\r\327\r\331\337\372=[\303\013\211\261 "
+	.ascii	"V`\200\201C\267\202\322C\013_WUQ0\324\372b\035\302\356\354\330"
+	.ascii	"\240s\232/\233\b\206\343\274\322\231;\2404\007\300\r\274\311"
+	.ascii	"\025\020\332l8\242\226\205\340\351\345.\3048e\206T\360!"
+	.text
+	.section	.gnu.lto_.pureconst.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 Ym\002"
+	.string	"\222E\022\033pW\351M_\241\374\377\177\271\372\377\177\"B#\215\220\376\2777\333\266\255ik;'\016\243aV\030\t\347:\007\243`\f\214\200[5\243\306\351\224\316\350\006\215\317\351\334\3462w\271\312M.r\277\3075nqo\335\035\""
+	.text
+	.section	.gnu.lto_.ipa_modref.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\205\001u\b"
+	.string	"\322\314',\200K2\034L$d\002\020\034\234\214N\200\206m+\200\232\360\314A\306\215\224\217\305\3376i\334\250\214 !\b\027\240\020\2737\331R\246CDH<\254_\351&\323\223Tj\212By6\215\233\323\241\214H\321\224\300\021\230\212\345\311\270\b\251\260"
+	.ascii	"\271P\264\212\005c\343\342\361\241\361\263\216\031t\360\357\341"
+	.ascii	"\2555\370\331\320\371\332[I\207\f\235\013\235\223N\3279uJ:\245"
+	.ascii	"\002\334\n\376\362\325\347lU\377C\202_L\351\334S-\247\\\2413"
+	.ascii	"R\036\265?\343\230\r\b\004\260v]*h\366\235\b4 \320\002\"\252"
+	.ascii	"n\357\016{\r\314^\272\303\035\346\2140Kk\261u\201p]\211\345\314"
+	.ascii	"3\337\315\006\247\315\366\016\214\027\034\256\351\f\231\245\316"
+	.ascii	"\302\t\337C\2646\"\232\034\302\320\236\240u\3648\tmv \323\025"
+	.ascii	"\026vZ7\023\2307\226\246\305\302#\227\005\316\316\327X\"\276"
+	.ascii	"\033h|\tb0T\"jlf\332\002sO\031\262\036T\021"
+	.text
+	.section	.gnu.lto_.lto.54cdc557a31bbb6a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorShutdown.23.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"%\013"
+	.string	"\226\023JA \345*\035 \027\023\336H<\200`\n\r\016\204\215\004\036\303q/R0\311\263\244(\004\017\202\227l\215\361vnftX\031Ue7\006\b@\250\n\b\200\330\304!Lj\t)4_\223\240-S\n7"
+	.string	"4"
+	.string	":"
+	.string	"\261\234B\200ZEz\t\252\356\003\240b\373\241]v\201\205\220\003\0021\233\003\265V\221\236\334\365u\371\207\371\307\224\225\337\202\211Z\253\327\224\215\334\364\266\035lC\330\357\b\021\347\207FB\315\326\002\377-\005\241\340~;\256\345\333\314\301\332\233\377|\026\370\357til\263\033\311k{\366Y.5\261\337\251\224f\177Mw\275_\337`\025\245\237\273=z\316I\242\305\245\004\332\244\343\224:\003Vf1\274\023h\233~s\362\374\\5\324x5\224>\260\274|\326K\035\226\300hi{\374\214\007\250fg\\&\345\251\265\006\036\205\310Q5\242\304\024I\3320\221\026\342\205I\204\022GdJ\f1x\304 \221\242j\034I1<\353;\225\322>\003\272\027\205\031aC\001\247"
+	.string	"\355\n\321\336\364Sv\bv 4\026"
+	.string	"3\241\307\037\030V\353*H%\007\262\2504A\202\215\\\342:,l\007\204"
+	.ascii	"\203544sY\037\263\352y\313\206Z\262F\t\342\232H1\004\3622D\270"
+	.ascii	"\034\213v\222\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.24.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\255\f"
+	.string	"F\330VB\020\221\232\0168X\311\211*"
+	.string	"r\365\261W\376?\003\260\317\216\f\245\2067\374\277\377\243Q\362\326>P\263D\340\003\237\362\311\336\334l8"
+	.string	""
+	.string	" \262\202\226\355\306\371#(\265C\320<\036\262\2667\2212\245A"
+	.string	"C"
+	.string	"D"
+	.string	"\320\336\013L\207\361\004\246Cg\366\214\003\030\002\2142\244\250\261\273\225\202\3102\273\244\231\371\032\020j\343\264K\261\303U"
+	.string	"\307\"u\354\356_\236\036n%S\003\262\273\316\215\343p\303\333\216`\273\201\375\221\206\232\316L\237r\340\301@\214]\r376\004_\204\370w\373\236\017s\342(\262\177\206\021\265\rQ\346\363\210v\327\343\320\f\342a\207t\016\333O\373%n\"{g\026\037\260\373!\321b\327[\340\004\361\001\207\3202\022\251\202\2142\245J\370d\260\344\310\266\205\313\240<\360W\\\300\342\356\336%e:L\245\272\307\\E\212\357\342\222\223\374v\350\237\250\202\316\306\007\225\234\261=-\025$rA#d\375\330\357\376\370\357\001\234c\233\022\n!&\223E>.\213\304\352T\330\2651\341\\\023\252\n\234\220N%ra\325\007\002[#\233\253\"\261\254\253\342\360\366\372yy\214\031\021R\321\025IA>\314\251\026\021]z\034\252\307\006\220Q\355\216\225\337,\251\026\026"
+	.ascii	"2\003\376\031c\301q6\371}gX\276df\265D\022*x\242\027\b\306R\227"
+	.ascii	"q\255*\264.\026D\240\252ppwUc\326J\264\270\233\301\200CM\336"
+	.ascii	"\256R\006"
+	.text
+	.section	.gnu.lto_motorCount.25.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\355\007"
+	.string	"\202\21765@\217\322\001\233.\f|\023Dd\316\232\020M\246\307\305\234\304:\205\017*\265\rUk\216\317\"\373\352_\264(\212\206\217W\363\326\005\210\013\255\377\021\331[\312\224\002\346l\"\004\301\317\273b\347\301\023\025\336\202'\341\3638\361z\033\002C\206N| \b\343\313d\373\266\212j\252!i\204S\233\276\324b\370\220\206\313\356\036\370 \020\327%%\262\356R1\036\377x&\362Sv\b\345Mw~\310\272\273b(H\271\262\263Q*\206\375\266\212\2625\3352\235O\337Y*\224\201\224]\211\025\313\236\270\221\r\333\230\235\3619\256\302\354\222\226i\234~aQ\022Y\331\335\247\271\200u\327\036`\335i\306\261'\346\277\343\315\244B\305t\032=\001\020v\327i:M\334z\333\005\266\rl\223\004\f"
+	.ascii	"2CC\r\354cBIz\2532v\201\361\b\325\236\013\371\354\260\247\005"
+	.ascii	"#\304\265b\022&\031"
+	.text
+	.section	.gnu.lto_analogInitEndpoints.26.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\310\005\375\036"
+	.string	"\006\271\302H\240VN:\226\233\271\005\035[\362\236R\\\360\320n\200ad\374-\264\303a'\304)\247\021\021\365\322\372\367\235\302o\223\310^S\246\034\\\031\347\204/X\013\307\213\271\253\227\036\007\354\302\256\207\222\036\254\265m#\204H\231R\255"
+	.string	"\217"
+	.string	"\263"
+	.ascii	":|\274\346,\321e\313\034#\205\3248\327\355\003\361\273\270\354"
+	.ascii	"U\013\232\320yJB\2438\347$:i\021\265\223\277\331>\262T(m!\201"
+	.ascii	"\240\265\265\240\207\273xh\246\023\017\026Fzu,\340w\270\3535"
+	.ascii	"sFi\t2\347U\221\021\324N\372\252v\265\217\3439\200\267\262\227"
+	.ascii	"ms\202y\005\231s\026\231@\355d\3569\345\311\3617\345I\003\355"
+	.ascii	"(\277\2221i/f<ea"
+	.string	"\231s\3526\306\201'\307U\240O3\262\021\241\202'Q||\201B\361\225\201r\032ss\316\377\270\216\200\022\252\322\214\346\234V\"\324\211\273\274m\b\266\21169\026s\316\340^D\371\305\300\303\211\223f\261Ms\363\275\322\366\300\244'~a\264\276\306\2346h_\tua\330\037\347\234\323\033e\337\307o\340[\277\356\\7\321{\374\003n\365\017}\307/\340Z\177\200\253sW\013]\035t5\020\251\306\221\352\237\253}Hu\317\250\346\271zgT\353\\\2353\252q\256\276\031\3256W\327\214j\232\253g\256\226\271:\346j\230\253o\243\372\345j\333\325\265\253i\244\272$\325\344\250\036I\365\216j]\365\017\234\204\226\2546{\233\022VU\343\202fkv\255X\270\222$4\033\0234bf5#U&\2633\373\341\324\256\314>,\305\225\030*%#R!Z\230\215\331\017[\ba\366`)\244\f\213\267\365\221"
+	.ascii	"o\330\013\206\211\224\357\256\362\344\211T^\366\266\3125,^\270"
+	.ascii	"X\330\313\332l\024\251\262\032mK\264?\253-mm\213#\033R\r\255"
+	.ascii	"\275nu\232\263\t@m\201\270\312\245-\216lX$w\267\\\036\261\341"
+	.ascii	"\224P\273x\\\362\350`F\306}\221&V\272\273\177\342b\244\177%\325"
+	.ascii	"\346tB\340\0179\221\f\276\324I\3636\350\211\033\312\223\272\357"
+	.ascii	"z\021\326\227\231U\223v\321\277$&%%\0075!z\flv\007\032\3548\034"
+	.ascii	"a\330\035%\355n\226|GL\274]\251!\003O\301K\210\236\355\307[\342"
+	.ascii	"1\370}\350\360\373\320\273\031\251\200\257\367\353-\351\230|"
+	.ascii	"I x\276\235\216\003\357hI\207\344c\322\025\370q\257C\222O\367"
+	.ascii	"\353\365|\272\333U\323\307\271QNp6\326\264B2'\264>\233k\021\264"
+	.ascii	"@+D5\264A\033D\206[\240\005:\033\026\177\266gq\353\3035\234\022"
+	.ascii	"\376,.\353\211K\317\372l\3715,\362l\217\203[\251\302\2636\254"
+	.ascii	"#U;T:\273\263J\366\340S\212:k\263!f\226s\003gs\"\274\354\311"
+	.ascii	"\241H\230@\201By\022g\377\343\003\202bU\343\315\n\233\275\331"
+	.ascii	"-\253p&K\002t\250qP\003\t\202\210D&()H\ni\f\020\003\221\261\315"
+	.ascii	"\001\02109ED\246d\262\034\222I\236\263\335\275\234y=\341\253"
+	.ascii	"\237j*/I\333-\251v\331\266\365\240\200\030\313\323\370.|\217"
+	.ascii	"\275\017\341\\;\f\330\225\314\337\260\016\331\245\t\267\274\241"
+	.ascii	"*\361\367\017\227'\251\204\317g\013\226b\333\357\017-0s\350t"
+	.ascii	"@\016\376\376,S\215\372\263\240\033e\223\274\034B'\255\005\327"
+	.ascii	"\271v\262\275\346\275\016\303\224\177\263\340\331\r\034=\324"
+	.ascii	"9\343\022s\216NT>\320\004r\323\275t\275'.F\214Y6\361>W]\032?"
+	.ascii	"H\231\231\340\t\273\024\322\247\022\352\302\017B)\316\205\244"
+	.ascii	"\230\233|\336\342\363\226q4dW\207\024\226\246\377\003\362\275"
+	.ascii	"wtD2\333q\376"
+	.text
+	.section	.gnu.lto_motorInitEndpoints.27.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\034\001%\f"
+	.string	"&\226P?\020O5\035`\301\024r\003\200\204\2655\377\3469\266]\302+P!\314\001*\006k\372\344\215\314\273n6\341\305~\3058c\016\200({k\202Fp!6\023\\:<r\322\231\372\2617\331;\245;"
+	.string	"C"
+	.string	"8"
+	.string	"\273-L\270vW\342\004\217\323\003\037\220\235b\217d\247\026\355\027\037E\354M(4\2406vw\233!.^\212\376S\\\003\205:\227\016\312\356Z\202B\036\356y\333\bl_\260\277\t\227\032\203\335\200a\200\305n\207\0312\366EW\214\260}\210\275Bm\230\240jEH\221xp2\213"
+	.string	"\200\315`\342@\221\343O\210/\231\365"
+	.string	"\273\"\027\256\335Q\342\005\217S\217\217K\373\243\227\020Or\313Z;En\240\342\345\231\037S\351\230\331\244\023\233s\312is0\310\203|U\214\321~\230\035{\374\310\t\302>\266\273\353)\262\277\372\035W\375\331S?\375\351\307^\372\347I\017\234Z\021\320)\200\320a8\t\035w\351\"\037\310i\274.\253@\301s\240\301\251Z\350}^%\334d\302M\205\3302\001kX\277M\003^,x`\267a<\356\333,\240f\233\024p\315\\\300-\254\025\334 \243\347X\033"
+	.string	"7[\3704\234+\313Z\306\250\227\2042\246\363\250a\341l\031\\#r\315\030`.\030\b\006\006\244"
+	.string	"w"
+	.ascii	"c@\np\0070\006\244\004(A\331\325)\033\240\2114\205\005\\\313"
+	.ascii	"\013a\222\001"
+	.text
+	.section	.gnu.lto_motorConvertFromExternal.28.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\265\n"
+	.string	"\226\024KB \253(\035O\202"
+	.string	"\224WU\0358\220a\300\272nhr\302\340\020\246\307\f\024\245\371\276\343\"Z\303\207zY\264\344\030\315CJl\001F\022\204D\346\304\246\313\340\214\027\313\222\354\330\371\023\262\211\224)\0058"
+	.string	"5"
+	.string	"9"
+	.string	"\366\013\334"
+	.string	"h?\300B\001\253_\320\200Z\260aw7\316'\262G\354\022\331\243\0068\370\004\375#8F\240%CJezj\034\273\353L\251Vn\275\355\013\333\033\366-\002\372b\307\264\366\360\217\231V,\235\232>F\233`\241\202\302\256\312\213\303V\210\021\006\330\006\355\214\355L\373\254\037"
+	.string	"\037\2368\356\272H\200\260\033f\030\003\363\030\221vQU\217\001\325\301\240; \331\264\354\2177\020avW\203\201I\247i\255J\331c\352\306\305z\202+(\371+\207|\371\324\243\377e\217W\215\213\345\224/;4\245\002\260\217m\234H\310\323\021\362\214<\216T\302A\370\323\361:R'\332>\217\033\001y\036\333\b\344\021m\037\357\333:\024\356@8o#u\235\267e\302\275\255)\347\244(~HU\247j\312IQ\223\003\017"
+	.ascii	"2\003\302\260+&rV\267]\314G5\365\032c\300\244\206j\304\205\221"
+	.ascii	"(3\315\2011\002\232xRRL\327$\003"
+	.text
+	.section	.gnu.lto_motorConvertToExternal.29.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\375\t"
+	.string	"&\323D9 \261\322\001\244\224cL}\022\210\r+\224\0023\254\020\224 \227c\261\313\306ok\315;\352\336\236\001C2\314\375("
+	.string	"\211\002\360[\200\240\f\213"
+	.string	"\203;\275\310\356M\266L)4"
+	.string	"1"
+	.string	"4"
+	.string	"(,\2674$\341\2304\032\r\026\233\335\320\0238\301\274\324\017\314\3138\362\326\265\345_\345\235\311\207\r\026s]9\r\273k\205\305:\356x\333\007\266\025\354\027\004\017\377\256SkT\237\303\251\231\001\325v7r7+#aJl\263l\217mU\373\263\247\260\036\332f\200\335\030\333\313\356&\030\241s\031\352l\373'\017w\261"
+	.string	"\335\354\323k_gw\027Z.(>7\331j^j\004\341f\247}e\345\313\214R\351a\227\276j^>~p\036/\315\331\241K\243\210\375nc\210g%U\304\310!\300$\021\370\245\276\223\207\002K\025&\360\301\2230\215N\036\tDy\"\003\177\023%\320K}\037\350y\302\275g\f\275\"\206=\332Ek\234\221\001$#\272lC\004\020"
+	.ascii	"a\221\"34\030\261\302\234s1\037\325Tk\214\001\223\032\252\021"
+	.ascii	"\027F\222\261\246\250F:0F@\023FJ\212\351\232d"
+	.text
+	.section	.gnu.lto_motorPostInit.31.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\345\007"
+	.string	"\002\31756P\215\322\001'\203\310\312XX\r\001\006\201_%\265\304L\005Ax\327\205\245\021\202\033>\352hLs\023\343k\305,\302\\k\340uy\241W\002I[\263\335\266L)\346l\246\004\311O\264f\007\3023\027\"\203G\341\0239\323\212\233\001\313\206\316\214 )g\254\270\275e\237)\301\"\225\275\2213j}\2560F\017\263-\037\"\241\331l\207\203X"
+	.string	"\273{\300M<\bl'\321\345P\237f\003\365\217\243D\376\311\021!\275v\350\207.\207\1770\033\351\270\310\264\2639L_\206}\313>\223\255j\275\3720\240tB\320\355Vt*\233\202%\034\266_\371\262Q\316m{\221\025\n\222\224\335\215O\343\327\365\362\357\361\214F\302\256\030\204\335\265j\244\322\375n\273\300\266\201m\223\r"
+	.ascii	"3\241\003\f\374\353\335p\261\031c\217\363L\fe\207E\265\347B\216"
+	.ascii	"0\330\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_motorPostInitNull.32.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \300E\005"
+	.string	"R\311#.pU\323\001"
+	.string	"\345\276\003:\f\267\236\253\027\253\305x\017K\361TEK<\253v\340;"
+	.string	"\245S\252\352\001\007\234=\332\002|\323\267h\357\224\002\236\244)1i\3515\251I5\037\032\251\034\226N\363R\ta)\241\246bRN\215\274}\354\022\224X\261=\r\306\215\375\301\306\316\206\007\r\300\"`\027S@\260!\002\310c\373\2213[\340^g\377],\337\300\356j\344<;\314\374\177n\3308\355\260\320\330]\303\215\313\334\361\266\025\266\031\266!\001\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorEnableNull.33.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \307\275\005"
+	.string	"\324\tk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\314\262#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\217\205\007\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307)\361\370\240S\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001\200\300\013/root/repo"
+	.string	"\033./src/main/drivers/motor.c"
+	.string	"\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8]\304`B\344p\347^\355|\002"
+	.text
+	.section	.gnu.lto_motorDisableNull.34.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \300%\005"
+	.string	"R\311\"*\200k:\300\\\202\037\332\004g"
+	.string	"B\333VO\322\006\020\377\330\316\340\266\371\355\354\353d\024)\246\316_\265\020"
+	.string	"B\022Y\271e\n\257\250)5\211q6\255\3065\023\274\270\020\030W3c\212p\311\260&kRN\226\302\326\375\n\216}\374!\027\027\374\025\320\373\375q\200\341L\236\356H\b\324\233\200\306\362_\245o\177G\303JG\340\004\222\371t7/E7\215\333U/*\350<Nct\350\356\307\316\223\350W\377\033\376O\377\025\001\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorIsEnabledNull.35.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \350}\006"
+	.string	"\"\214-4Pm\222\016d\254\210\332c>\345\265\030\n\226\232\021w\216\240}e\320F\374\332\fF-\226RWb\272#\215\3146\2518\201\255^\210P\030\023\355\026\t\331)\017UfcMc.\360u\236\306q`\345`\301\214\333X\f\032\207\201\034w\031\3705T\320u\336\203\256\022\233W"
+	.string	"AD\223\370\370am\343\023\240mo\032\317\026H\245\023\313\250\005\245\240\264d\032\351\370=_\371\033\313\017\210[\2131\"\265\361`\213@N\377\b\t\236\257\214\"\0205!\252\b)\265\3215\216\274\222]g\202d\201\007I\206\211H\350\223\214Rh;\263\b]\344-\177\203\337\375\024\001\b"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\316\020gz\036|\265\363\t"
+	.text
+	.section	.gnu.lto_motorUpdateStartNull.36.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \307\315\005"
+	.string	"\024\nk"
+	.string	""
+	.string	""
+	.string	")"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\334\262#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\257\245\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\307+\361\370\240W\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\203\003\202 \006\177\001"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\033./src/main/drivers/motor.c"
+	.string	"\b"
+	.ascii	"U\b\230\347\220\254\202w\r\247\213\030L\210\034\356\334\253\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_motorWriteNull.37.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"U\007"
+	.string	"\262\01643`\215\032\003@\203\007r>\242\033F\353)&\371@z\022$qd%4\221\245R\233.\304\327\325\346\037E!!3!\320\311!\242Yv\330'rK\231R\030\203\002\207\364\0320O\350\363\332\321\3108\212 (\222\030\351#=0\364\341\200`G\212\240f\240q\001\223p\024\243\204Wv[w\250b\036\034D\233\225\232\263hm\335\241\332vM\220\030\230\374\022)(\037y \032m}\265u\2555\207;\246\263~\364\362\207\210\254\376gz`\361\303X\240\342g9\240\342\327\326Z\204\315t\312\241\356\257\330X\375Y\246\005\026\277\316\266\304\031\306\255JE\250N\376Cw\341\3516k{\370b:\225\334"
+	.string	"\022\376\267\231N\024\256s[\202\266\233\266\031\001\b"
+	.ascii	"2\241c/0.\034\327p<\026\006B\205\211\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_motorWriteIntNull.38.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"E\007"
+	.string	"\362\21523P\217\032\003 [\374*\302\"\366\242A\317\235`B\213C\262>\216r\330\002)d\2435i\316\276\\\315\314\020\t'L\035H\330\215Pn0K\331\244L)\327C\203\307\344 .\320(\344\372\341DX\202\242G\212\227)\024Ao\024\362\210\336'\222\036\207\240\320\341\212\257\004a|\326\2741o\252\026L4\212v\236X[\265\306\274\251Zfa\250 \240\374\026/.Oq'\036mm\265\006q\210\364\214\250\3735X\0246v\001\036\310\3301\013d\354\312X\273\320\221\376\220h\3733JL\376\231\320\203\215]e\273\342\311q\315\212\244b\244\345\377k\033\226f\262\266\210\001P\251\223\231\206\341\177\031*u\3416\2675h\333i\333\021\n"
+	.ascii	"2\241a/0.\034\327p:\026\306\024\306e\352\252)5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_motorUpdateCompleteNull.39.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \3005\005"
+	.string	"\222\311#-pU\323\001"
+	.string	"\345\276s\f\002\244\353\370\212n<\307\377S\201l\330FF\265\003\337\001(\235RU\0178\240\354\177\b=Bd\321\3362\005\236\244)1i\3555\251H5\033\373\250\030\326N\363Z\311`\t\241\346bR\316\215\274k\354\016\2228\261=\r\306\213\255\202\377w\354l\030mB\212\316_\031\0208h\340\321\330\326\310\231\r\240^\346\372}(_\300\377\215\030\315\024fV\345ha\3434\205\204\305\177\303\215\263\250\243\332F\330N\330v\004\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_motorShutdownNull.40.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \300=\005"
+	.string	"R\211#-pU\323\001"
+	.string	"m`\375Z. \207\261X;r\376#\025\310\206m\236U;\360\035\200\322)U\365\200\003\312\376\207\320\263WE$\267L\001\237\244)1i\3615\251G5\027\334\250\024\026O\363b\211p\351\240&cRN\216_\353v\005\310F\376O\203\353\375\032\350\355~\0303\036\004\250{\022"
+	.string	"\320\035\301\346\362_\343\263\377\243\237\245#\217#\321\204\272\233\267\242\231\302\354\252\030\035l\234\2460Jt\367\341\306Q\364\253\377\r\377\017\377\031\001\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_motorConvertFromExternalNull.41.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"\025\007"
+	.string	"\322\21514`m\322\030@CR03w7\001\341q\356p\267\305\277\334\241g\204\030\324\354`=\355B\026\364@\332mQD\f\274\366:\020\323\016\314\035\332\266\367\3362\005\225\303B\346\363\326P2z\"\007vd\365\331H\005\310\260\311p\240Fv Epl\250$\364\304(\341d\255\272m\243\257\002\fD\213x\013\304\032\351\325\355\356\336F\317\246\021\023\352\332\235XQ\331\222'\242\361\317\237~\306^=\364c\252\365\360\333\255@\t\331\265\020>"
+	.string	"\320\027\300\376\225C;\346_\316\272\300\270\224N$J)\273\0131:`\321\347T\300\242\257Y\350T6W\005Q\267\221A\022\022\201\224]\022vw\026\022Q\350M\177\203\037\376\244\t"
+	.ascii	"2\241S/0\0368\b\341\3145\217\003\023\017\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_motorConvertToExternalNull.42.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\005\007"
+	.string	"B\31505Pm\222\016$\217\203n\n\"\252\030\364\324\254i\2071RL\225C/\314\314\356\202>~,5-V\315\216\231\031+\346\r\271X\251\245\324r?\306\326\032!2\005\030D\303\245C\215\271b\306\3114p\023\261N&2@\207\314E\0031q\003\257\203\263\007,BN\226EhmY\255\262D<\211\337>\356\211\276S>\214wV\212\311U\312\244(\255d\t52\372=o\375\316}=\372\341\3516i\201L\222\023\221\314T8!\240\224e\372/G;<kn\323\250\030\020\241L\204\250dn\220\240\006U)\327\202\252\324\313\250V\247\335\202t\332\030\221@\241O\035\300Bf\356@!\213\376\372#\374\360\277\b\n"
+	.ascii	"2\003\202\341\243\302^\025\220k\370\211E\353\300\304\203\273"
+	.ascii	"F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_motorNullDevice.44.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\020}{\273\001y\273\001"
+	.text
+	.section	.gnu.lto_motorDevInit.45.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\234\002\225\025"
+	.string	"\346\250\220J\260\022R:\212G4z\035&\275"
+	.string	",r\341\252\350K\f\222)@1\001\237A5\207\347Z\243\\\007;\246\372\277\376\250\301G\257\325\273\334o?\246&N"
+	.string	"\350\213\332\253\376\240$\bk\376\243\355<\233\224\271\333\232%\204\354\235Rw"
+	.string	"r"
+	.string	"\201"
+	.string	"&\373\233\"\272\324\363H\274'm\240&\013\374uhy\2354\241\247\366\213n\304\373Q\317\001\354\016E=\355\236\bl\340u\322\347\003\224'_?)O\232g\367\3709\3343\t\005Y\024wWVK\234wr\254\224\347\237\351\"\246\260w\362\365\363\021&\374y\035O\200\234\250J\204\300\361"
+	.string	"\025\021\2103\235z\020\376(u\271\354\256\251)\374p\227\267\035c[\202M\253\0027%\303]\337M\277\305]\330\370\304\223\256\335\320\2337\245\rGo\032\345\307fYq\250=\373\354\321J\302\376\270\273\353:d?\351'\271\322?\362\245;\366\243\037\346\242vU\352\262R\223\225z,\251\217B\233\316\242\342UP\250V\235\353\263\245\265R\244\f\023_\372\355\237\3111\333K\273\224\336\271>,)\236\212\212\273\247\312I\277\230%\001\357J<\017\247\221\003A\300\320\265B\013E\b\037\335\242TD@1\352uJW=R\220\034>\246v"
+	.string	")\020\273\252\017\365\031:>\32123\364\346\f\017\363\352\204\216\225\254e\205U{\002\005z\323US\202\265g\222Z\216T\262>8$V\307ZA\005\216\340\020\337\t\224\257\261\372\027A\250\037\335\262m\341O4\257]`\213\017\003\303\354E\354)O\276\302\210\030\006\031\035\371\350\226I(=\357\250R\345o\272S6\236\230\032\332\354\246Aw\223\241\351v%;\267\035\214\246\303\331\305\320pjj\"6\265\0137\234\202\230g+9\334\016\316&\323\345h\031j\271\032\331\255Fc\223\315r:\331\312"
+	.ascii	"\343rh9\331\016\016\227\223\305\316\375\270u\310\244p\263\254"
+	.ascii	"|\365G\026\240\366\002\006\364\246k\355\035\310\211\352\304\330"
+	.ascii	"\340R\273)!E\037\246\264_~\003&\202\220\216\240\"\254\177W\332"
+	.ascii	"\016nc'2B\253\210e?x\r\236\327\356\2668- P\0021(\325\0353r\205"
+	.ascii	"\3522\330\227\367\272\234\025}\007\005c\345w+\345\001P/B\227"
+	.ascii	"\016\005\244\226\245!@\347\24454\202\254\031k\330{W\246\264\204"
+	.ascii	"\356\nCwl`\r\357\267R\2130\331\307c\357y\027\232\275\230\006"
+	.ascii	"W\240,\306\217\315(!\203\264\353i\t\274d\306b?\323(\227\245\211"
+	.ascii	"\321\303\227\267&\233\230k\264\002\n"
+	.text
+	.section	.gnu.lto_motorDisable.46.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\355\t"
+	.string	"\346\321A90\257\322\001\204dQ\f\007ua\320\221\222\341\261\225\346\351\325 \224\374\254q\3500\333\252\307\373\304\366\260\022\253z\307gX\222W\030\030\360\235]C\2641"
+	.string	"YO\202\266L)-"
+	.string	"/"
+	.string	"5"
+	.string	"4nE\304\3669N\331-\037\305\375\f\314P\261\355\356\224 O]S\376K\276\001[\252+"
+	.string	"\302\356Z\301\326\306-o\233\300\266\201\375\2041\224\3772\305I\017\236\363O\335\271\313\202p\304\005\343X\351\315\036U*?\354gV\206\366\325R\325z\3655o\271\330^\024Xv5n1\033\265Qg\213.\033i>V\f\210\265\024)9\f\031\314F\255\322\034\017\226T\331\366\216b\321\021\355\210\237\2244\273{0^H\004\210/TwNe'$v\330\003\376x>\317\344\221f\351\003M\210>\207\371 j \315\317W\232\036\001{\020\240o\232<\357\233\234q\237Y\031\232\241\203\266\222,\373\241\316\006}\026Z\bI\\&\001\024"
+	.string	"2\241Q/0\\\020\224&X\260\221L\\\227\205\355\200\020ap\201\206f.\353cVGo\331PK\326(A\\\023}\206@^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_motorEnable.47.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\035\f"
+	.string	"\306\325N? Q\224\016L\226`\005!T\b\235\002\002\340\016r:\2118\342G2-\034eK\306\354^\355'\273oZ\336\242\302r-\313\207F\027\f@rp\230U\r\212\306\021\216\321f\033\331[\312\224\002<"
+	.string	":"
+	.string	">"
+	.string	"\037 \273{i\210\207\036\241f\310\217\\&\033\247=J4\034\302\001_\013\033\035%\022\233\305\221R)\234\005\030`w\177\342\211\201\033eF.\273\353\334\270\fwu\333\bl\013\260\237 \217\276\247z\274\0228\315\360\220\332 \312\020\333\323RA\330\207\253';\323Q\3230\323\371\364'7} 5\016\300\330-\205\344\330\030\321E\t\333\267\034\262i\334\353\366,8\\\bQ\337\341\303H5\333\016\376A\301\322y\363\025\330c\201\316\"\342\271\273\232\372S\245.P!\203\2248lG8\212\217dw\r\370^\005\216\004\005\252\036S'\036O\335\003\344\243,\301\223\337\002\306T2\254\203m.N\226\231\240\311\030\\\0174\n6\027&\343\\\025"
+	.string	"\306 d\262\253\203a\331ey{=9\232\276\033\237HG\221\222v\246A~\263\252f\277H\231\350\340S<j\216\260\322P\003\034"
+	.ascii	"3\003\3569$k\340\261-\313\207V`\025p\306\027\330\240h\272\b\301"
+	.ascii	"C\034\n\321!k\213GX\006\013\325X\201\305\326\267f\257P\213\327"
+	.ascii	"(\361\\\303\345\206P^\206\b.?0JUsj\306\331\256R\006"
+	.text
+	.section	.gnu.lto_motorIsEnabled.48.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"U\007"
+	.string	"2\01635P\215\322\001$\243\252Bx$(r\276\310:.\355\323\024\255f\257\013\245\375\270\351G\035m\231\233\030_+f\021\3462+\3778\247\270\"\306m\203\220-eJ\001\316`\340\353<\216\273\240\006b\003\031\\\303f\201\3432\360r\030\001?\007\rt\235\367\240\273\304}[-\251\016\210t\302\366u\017\254\262\273\b~\224x\250\234>\326+U\013\352\035G}\374\223#<\371\354\225\357\261^]-\026\242L\3311\224za\277\355\356ZK\266\323\232\351\267\200\221\023\005\221\335Q*eM\252\020\r\333 \373b\203\003\220\261\307\214\321M&\212\017\224\335\350\024\343\330\023\363\317\361F\002R\222\221BO\200\204\335uf\244\212[o\233\300v\201\355\215\n"
+	.ascii	"2C\027\r\f\304b\\L\b\020<B\3357\327\224%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_motorIsMotorEnabled.49.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\245\t"
+	.string	"6\023D:0\345(\035\2363\205\236\273\304L\f(\025]\210\271\211\360\347\226B\021\250\363\323\324_\1779\n\372C\f\266!\300\306\025\02400F\247^W\344dG\232\264\272$v\023\271S\n3"
+	.string	"/"
+	.string	"5"
+	.string	"\241\201\013\270K\333>@0\371\364\220\203\365\016\017\325I\314n8u\343\247\307\223\377\220k *(\253\026\352qS\330]\307U\353\342\326\333&\260=\355s\001Q5\354k\253.\333\321\333a\277\324h\225\321Q\213>'"
+	.string	"\343\2620\333e\315"
+	.string	"l\213d\371\260}\333&[c[\343a\023\326\335\214\224\225\335\252\177Q\005pw\023\bN\314nx\211\210\333\335\204K\237\204\302\333\304^\245\314eT\216L\344#\017K\376\313\017`\374\352\322\0073\227\327\215\f#\025gv\210\n\022!\320\250\223\376x>\217\344\211&\370\205\"\272\0174G\035\203h~>pz\006\3549\204\276I\362\274oj\302\275\266\352\332\264\223\322\n\007DUG\335\264c\241(K\r\f"
+	.ascii	"2\241\035\f\034\371\205\313\352\f\227q\320\330\005v4T{.\344\271"
+	.ascii	"0\006\247g\203&a>\001"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.50.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \346m\006"
+	.string	"\002\314,3Pm\222\016\300H\032$\200)J\205\273\301%\241\360\326\232\013\376-\331U\373w;\300\263\231\"\266\233\275\256\232\323\234i\301\3338\304Dp\304@\255\221-S[*\317m\\\246i\336\005\002\363\032\232\003\206!\323,O\323*\004\273\207\313k\033\347^\243\\Y&BV\360a\022_\217~Tw\343\b\016\326*u9"
+	.string	"\245\220\tX|\260\364\227\007\331\305wJ&\372qd\003$\222\205\222LP\211\224#\224\b\307\337y\312\b\t\235\253^\031\240j\214&@N2\257\3060Z\025\253\333Q\247\216\020\023+\344)\006(d\346h\205*:\353o\360\037\374\024\001\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_motorWriteAll.part.0.70.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\227\002\025\025"
+	.string	"V\350\207I\300\222U:\222(t6\332u\211C\367!\372\335\213\224\221s\272\360\236\231\214$\357\377\034\004L\202\334\001\215\351\341\255\333\222\223\003\030\345\325\226\277+\b\202 \b0\330d\337#\006C\256\206\364\250\016@\353fb\311&R\246\024p"
+	.string	"l"
+	.string	"t"
+	.ascii	";\331Wx\350!s\346\370\020\315\311[pi\005\343\245y\017 ^\216\027"
+	.ascii	"\021/\355\373\330\216\331H\347\351L\234e6\322H-\005\254\001\352"
+	.ascii	"1\347\\]n\b?\370\220w\257\312.\303UQ\346\277w\223-7\273T[\256"
+	.ascii	"\303\303\260T\263\031\241"
+	.string	"\312\315\204)\300\244\242\377\256\267\234\214\356\251\207\303U\344b\351\301\234\323\243\207\273t\333/\333\rl\325\021I\336\034\333\244V\255\032\244\244N\215j\324\251\2446\211\352Q\325\245\363~Q\252\245T\207\027\2727T\353\252/\022r \305\2346A\037\023G\026\221\270\320o\337\027\372\217\3773\312\0273\311\fo\346p=\337\327\342@\262\007\331h\234\341F\027?\267\2449g\311\245\031\214\227$\341\375^\314F\241\254z^l\20477\340\254j_\305\003\267\261\326D\304M8\347\234\273:\333&\337=\355i\334\340\240\001\241\322q\215S\333\231wMk\265\3618Q\213e\370<\276\207\366;n\037\344\212[\332\323\234\240i\320\341mC\fW\356iJ\3206\\\021\250\346\207\335z\214\f\006l\n\207\341\"\2403\347Dy\241\241\202\317s\351\307\210\227\272\377=\301,\b\305NF\203\336\257\357\250\226\323\325y\305\247\350"
+	.string	"\003\256\273\2640X`\301\210V9\201\275^^,+\027X\013\306\005[Y]p\261XV*0\227\325\311"
+	.ascii	"\277ZZ\260\325\313\353\005[\241\2769v\357c\220\211\0342K\223"
+	.ascii	"\253\363\177?\345\350\331\355\027\004\200\035\340\320vf\033\302"
+	.ascii	"k\260\0248r\tXQ\355{G\300\302\027\256\316rG,9\310\216\236v\367"
+	.ascii	"\226\332\335#\375\334\230Q\240Q\233\332G\270\221\204q\316\211"
+	.ascii	"\202Z\323\256\3503b&\26046 `\002!cX\036z\n0\303\323\bb\017\262"
+	.ascii	"j7\341\020\253Xfd\373b\033N\341\ri\230\353,\355\372\201\034g"
+	.ascii	"6i\310\307\320Z\202E*\344:\247%\036\203\336a-\262o\240S\243V"
+	.ascii	"\313\336q`\367\3362\207$8\nNX\3310\202\026,\306\334\"\271\246"
+	.ascii	"\262\200\344B\300\002\340\206q\356j7V\021\2464^\235P3\335l\006"
+	.ascii	"\250\005\2741\343\356\204a\246I.an\332{\202\302\003"
+	.text
+	.section	.gnu.lto_motorDevInit.part.0.71.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`i\004\275\026"
+	.string	"\206\344\212K\240TN:K\243\037q~\343\204\017\372&>\367\016\305g2\373\307\275_\253\331\2607F\021F\361\270\013Q\3318\235\007\210E\266\247\352lId\347\t\370\354\351\3630\235\252\361\205\301\215j\324S$Q%\257=\253\032\264\233\354\235dl"
+	.string	"p"
+	.string	"\201"
+	.ascii	"\305\313P\217%\304R\314!\356B\352\330\340\270\035\024O\240vl"
+	.ascii	"\373\200\332\361\255\372v\33401\352\253:\264\f\025\363\021L\f"
+	.ascii	"#\3251\347\342\202\343V`;\376Tw\003\221Z\355&{\361)\177\253D"
+	.ascii	"\221\3261\347\\\036\337\023W\177-\251\366\017v\224a\322\320o"
+	.ascii	"J\222\210[\001'\001<\3109\267m\304\033\277\273c\272[\247\233"
+	.ascii	"\f\013\303\343\276\257v|\244\253\262!\211\240M\263\327\251/y"
+	.ascii	"2\337\246n\025\234Q\200\245\234\217\322\3162\023\026\213\372"
+	.ascii	"\327\237\365s\375^'\273\337\375+`\177\306k\374\353`}\263\362"
+	.ascii	"j\230\030\340\273R\313\222\207\230t\245_\311B D\034\033\027\320"
+	.ascii	"%\007=`\255\323P\277\025dW2\221\360\203\321\306v\274b\263\200"
+	.ascii	"\307\022j\271F9h\302xm\367\003O^\250S\270\225(u'\352T\223\243"
+	.ascii	"ZE\203`}R\257"
+	.string	"\276\204\306LIM\216\301\332d\363$\27122\b7\345\312\024\341Hn\216\030\221p\272(\235\341|\310)$\310\204\\\002\245c\205\377\310\215\371\260\2603\263\302\320y\217\035\036;.\360\314\254,0\\\007O\016\034(B\264,\"]\255;qJfKT9\007?\3546/v\266L\367\35664\034x\3129\313\204\335\310\353\023\217\033\365\331\007?=\240\0243\365\001\3121}zv(\347.C\017\255\271\361\202rzL]O(\355\345\314\024H\245u/?\364\007\345\225\351\317\344\260\373\365\224\275\035\017\257\324\375\322\362\305@\243\033\314_\371\203\242\277\362v2\337\246\246\2204\026\274\302\276\367:Y\020\276\002E\206\266\310\032\371\372\304VQ\250P\366C\025\252v\214o\244\t\243N\334J\245\302\022Y\241\r\2568\3135E\213\247\235h\001W\250QH\243\034F2\023DRPPX,\006\340\002\221\"\323\034\021"
+	.string	"%6\306\241@N\n\312\347\001\363A\270G\017\313\257\t\035!`\250\244_\344\226\202\200_\200\311\223\"\035&\230\221\371X6\256\346\360LcD^\037j\315\230\231)\265\254L\304\227\340\2063-N\304\227\340\2063-N\304\227\340\2063-N\210\216\260t\222\374a\211'sZ\354\023\252\234=l\201]"
+	.string	"\270T\364`\3105A^F\016\013\326\331C\362WFG\262Qq\033\356@\336\245G\270\246\347\201\312\242yM\333,\255?"
+	.ascii	"\003\r\230*\202_,\374"
+	.text
+	.section	.gnu.lto_motorEnable.part.0.72.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\315\t"
+	.string	"\326\221@:0\305*\035"
+	.string	"\276\274=\016\ru\005dh6\251\377F\200\217\334.\337\227-\213JBmu\335\004\327@\023\303b\300\032\032Y\030q0\013\342F\273\032\033b\314\352\267\233H\231R."
+	.string	"/"
+	.string	"2"
+	.string	"%\233\3452\327\376\304#c\026`w\343\241\206\274t\315\255\344\037\366\201/e\272\022\244TO\203o\030\207\335\265"
+	.string	"\307\ro\233\301v\306\276B\276\350rx]`\321V\260\216S\326R[\326\355\333*\313\326tf\372\230\314G\301jW\2436`A`\212\210}\030\311\346\270\303\217\330&m8\263\257\205K{\302\223\377RsE\205\"\200\206R\223\377\317\305\356^\3629p\355n\203O\202\001\362_\243\313a\202\013\200\037\273l\344\277l!\312\177\207\001\336h\274.\324y\"\310\343\\t\274\210H\321\201\360\304\215\007\212\032\004w\025\034/\206\272\316\213\334\267U\226\037b*'EYU[\266Sm\316M$`\025"
+	.ascii	"Fc\254\254\300x8JfPZ!\351WQ\202\212-\243\302\003D\3010W\270'"
+	.ascii	"&0\316\210E\235\323i\241\315\224\235\006\200k/\246\234\226\323"
+	.ascii	"\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`(\003\255\f"
+	.string	"D\021$\004"
+	.string	""
+	.string	""
+	.string	"\002 \177'\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002!\177(\270\300\202\202\200\006\"\177)#\177*$\177+%\177,&\177-'\177.(\177/)\1770*\1771\032\1772\271\200\00563 "
+	.string	""
+	.string	""
+	.string	"\00544\002\306"
+	.string	"\1775\360\372\2508\271\204\202\202\200\005\0266\200\204\001"
+	.string	""
+	.string	"\003\002\307"
+	.string	"\1777,8\310"
+	.string	"\1779\002\027\177:\272\200\030\177;\340\365\321\360"
+	.string	"\031\177<\033\177=\034\177>\035\177?\037\177@-\177A\0058\027\002.\177B/\177C0\177D1\177E2\177F\036G\0015\177H\377\037"
+	.string	""
+	.string	"\200\200\200\001:\177I3\177J9\177K7\177L\003\013\"$\004\016\225\n\004\016\221\205\327\307\003\001\365\001\003\022#d\003\023$\204\006\004\023u\003\024\242\001\003\026\013\"\004\027\225\001\004\030u\004\031\003\032&$\003\032%\344\001\003\032\020\260\346\314\231\001\001\302\007\004\034\035\022\250\270\275\324"
+	.string	"\001\342\001\004\035\201\001\265\001\004\037"
+	.ascii	"B\250\221\210\362\245R\220\224\2445\003\340\002\241\242\315\003"
+	.ascii	"\021\200\f\247\240@\211T\254\250z\035\022a\254\022\353\325MO"
+	.ascii	")\005Pk\210\325O\267\271\001\343\274#P\330M\324\377:+\270\213"
+	.ascii	"\225b7\"K\024\277\256\027\266\002+\t+\312\036\357~gv[.\020\347"
+	.ascii	"\375\004\306Fk\311\231\2552\221\272&\005\261&\001\007\332\354"
+	.ascii	"\363\275\307\354=\327\247\277\300y\267\031|)\373\033%\336\335"
+	.ascii	"m\270\002\253\002"
+	.text
+	.section	.gnu.lto_.refs.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375 \351\265\004"
+	.string	"\342\013 #\220'I\007\377\377\377\377\377\377\377\377\377\277\322\376\333\177\373\377\271\037\375\376\304\266\335H#\255\021B\244L\001\317\304\n\t\b\204\203\236\026\347\241\006-X\b\024\316\365"
+	.string	"?\353\271\026\350\\\007p\273n\213#\251#\307\225\321\325\361\243\350\307\361\204z:n\234n\034/L/\216\243vt\374\260\237\343Fus\274G\357q\336y\004XVk\003O$\217H\376\220\374b\257\330\233=\26276\222\376\205\b"
+	.ascii	"@\004\334\201\306\252R\nL@; \314\224\253\240\001"
+	.text
+	.section	.gnu.lto_.decls.54cdc557a31bbb6a,"e",@progbits
+	.string	"(\265/\375`K*\355\265"
+	.string	"\212\024\035=Y L9\245t\372%N1\026\266\267\366\2441U\315\326D\020\031y5\335\315\211\226!\377\367\337q\311\246\253\234\235\314<"
+	.ascii	"\254+\023\200\347\375\264\206\333\373c\232N\006\272\341\216/"
+	.ascii	"\365\252\366L\271\205\371\231\227\356\240\322D\317\333\373\355"
+	.ascii	"\312X\377\261\261\253\025\035p[\367\3362\005-\003\317\003\347"
+	.ascii	"\003}\327y;\240h\351y\231;\373\322\204'\006'\036\210i\263\340"
+	.ascii	"\315\031\207\025\255\266\275\336\322f\r\205j@\330\023\245E\262"
+	.ascii	".l\013\233-\221=\262F\266\250\307\264\263\367:\314\373\205\266"
+	.ascii	"\353\331k0M\017r9b|U\200\253\256\013\007\374\233\226\376\202"
+	.ascii	"\245\277>\322_\251\3647)\325\371\222\336^Iw\232\244\357<-\"\310"
+	.ascii	"\026\244PFK5,\306\3035\234X\001\261\370VI\332Yx\336\321\f>'\250"
+	.ascii	"f\276\021\300\032\234\233\305?$\351\b\256\364zvGz\313L\333\251"
+	.ascii	"7\370*\260I\351[L\372\306K\337u\351\233I\212\323\031\240-\007"
+	.ascii	"\304\002\203Ri\361{ZP\301MI\226V[\222\364\310\314G\224\b\007"
+	.ascii	"\036\264\\\223\265\331mj\375\216X\255\0205\202\006\244\305\330"
+	.ascii	"z-H\204\223\215Z\374\320\312\271I\327s\335\244\235\364\223\216"
+	.ascii	"k(\355l\271\206{/i&\267\315\234\215r\316\357\263\237\347-\327"
+	.ascii	"o\275v\233I\262Q\221\224\017E\304(\215\351\345\334\374\240\363"
+	.ascii	"\341\367\274Sr\303\301\217\366\006_\260o\244o\030\351Q\220~M"
+	.ascii	"=\210 \025\201\"\355\264F\322N\rZ\355}\244\317.C\324\314M\233"
+	.ascii	"%\006\315i\361/\220\2765\360\335\275\275\326\300\367\007\244"
+	.ascii	"8\275\301g\223\364\006_7\273\254\235\030\364\363\034x\360\253"
+	.ascii	",\222\305rn\336\330\214\001\033\003\306\342\177\220Z@\225=x\005"
+	.ascii	"\351\033\003_\3575\006\276\333\364\320\336\340\373{\354\357!"
+	.ascii	"-\246\301EZb\346\263\234\2339\251\321\033\0221\213\337\354\r"
+	.ascii	"\276\2643\370,\b\r\234^#X\340\312I\006\033\374\227\005\rX\360"
+	.ascii	"7\t\037\356\201\r\377\225\032\361w\t\f\340\002C\336\357\277/"
+	.ascii	"\364\374]B\330\301o\376[V\201\007\377\333\304.@hq\024\360\267"
+	.ascii	"\357\267\033X\002\374-\225\301\177\205\f\031\372\375o\t\202\210"
+	.ascii	"A\264\204 \300\377\355\300\t\366\277\031x\377\327\004\006N\363"
+	.ascii	"_(\177?\340o\023\020x\315\177C\370"
+	.string	"\373\002$\334\346\277p\177\027\261\t\270\357\277n\177\337\374\235\341\357\n\354\316\377'\377\231\374w\362_\356\177\023\253\301\337b,\002\020\360\013\376{\364w\b\216\342\177\207\317\374\027\211=@\006\r\374o\324o\261\001\376\026\376\215\202O\002\376>\361\267\b\376F\361\f\377=\362\333\002\3746\347\2672\277\355\277\307\374\355\345\357.\177s\371;\357o\350\337x\177\313\375\235\345\357+\177[\371\333\356\357\272\277\325\376\236\362w\224\277\235\374=\367w\333\337k\177\037\371\333\354o\347\337a\177\177\375\355\3657\327\337A\376\326\372\033\310\337>\376\306\372\373\352o\036\177\227\340\357\017\374\235\301\337!\376\326\371\233\001\177w\3607\004\376&\361\367\207\277\207\177S\375\315\374;\307\3377\376\236\372{\305\337\353\377\347\177\265\377$\374\215\374[\350\357\343\337\306\277\203\376.\376M\202\277G\3607\361o\240\277U\374\235\342o\365\357\013\376\326"
+	.string	"\345\277\330\177\023\377\347\376\013`ooo\357\367\251\375\277\006\374\030\364\004\277S\277\365b\277\\\251\032f\316F\355T#\217\313\342k\303K4IK\222\364=b\336\326\320\263\326\362\202!\232s\276Ov\3572\311"
+	.string	"21k\\\032W\306\235q\243.T;\357\323\177a\334&\257\373t\235n\f\256,\321\033\367\311\206y[\320\250\231}\370\2604\277D\305\356\223\005c\231Ae37\371~$\371\022\375\240\323P\264\320\320\022\304X\356\362wYt5\306\220\244\377\235\245v\2473\370\356\222\205\313\342\243\016,M\272/\332y\225\376\216b\307\\\247\231\263Z\276EQ'W\351\032]$\032$\320/Q\235\017\037h\2764\231s\363!\335\2436\262\031p\026_\027\300\245\255\267\345R\372\333\342o\346\234al\265\230\263\370?\244\364\277E\227\b\tT\030%\213\257\022z#ce\246Co/\275\017Lz_^\332>\273\364>\272\364>\266T\203m\372\216\2441\324\020\325`\213B$\335\322\324"
+	.ascii	"\305\002\214\256<-4[\306\202\354\260\270\331iN0gx;6^\352\212"
+	.ascii	"\276\242\314\337\220%UgY\264j\322bpr\336\205\371\232\306b`\303"
+	.ascii	"\322\025\334R\266\344\350J\323wD\007\030\025`x\376\324\264\312"
+	.ascii	"\242\254<\271Q\342\022\346E\025\233\325sEh\\\331ap\323\254\301"
+	.ascii	"\264\343\205\272\2162\237\226u.\330(\001\"%g1\025\354\2046\325"
+	.ascii	"\325#}\023\261O\254\234u\322\320\263L\264\034\261e\251\252\354"
+	.ascii	"\023\333\303\302)i\262D\357\342\364\214\334\260\314\206Be\245"
+	.ascii	"\226\235-\246\224}bwT!M\261P+\305B\261Q\332i\237\330%\267Ll\234"
+	.ascii	"\216L\025+Qb\250\301\266\211\235k\347\216\245\273\235j\267\317"
+	.ascii	"\0305\363shu\244\005\213\357\303\221\276w|7\275\343\273o)\365"
+	.ascii	"e\250\314\230\264\205\2330K?\352\242\351[L\005\233\025T\346\344"
+	.ascii	"\274#\213\226\233}\263h\266\315\"\261I\354\231M\263lV\315\256"
+	.ascii	"\265\323*\261Fn\255,\217\353X\251#6\353\327\224\275X\260aZwq"
+	.ascii	"zAlT\222"
+	.string	"\2738\2751\333Lbgf\263:\024!\215\360\365$\312Sf\237\277\254\350\226\020\333\325\274\213\373\022\023\263]>,NwqzW>\254V\207\"\244\214\327\240wq_\326K\211\035b\263\032\n\325\3141~L\314\2738=\235\0172Cl\224Y\351\340\313 I/3\226^\206\353\351t\223\342\"\251\310\255\363m@9\271\266\03727\232d\031H\ty#rK\326ko\320+Pd\\\244\307{\351q\22700'u\3214\373u\013f\003\027\345%e&S\025\303\2256\273\324C\027W\bZ\226\254\270,sfKH\325\022]z\274$\025\241\265B\226$1\030@nW\240\261\322c\371\305b\373\3436%\001\303\325k\230L\b\024\217\265\364\267YX\030-\352\252\352\\n\261d\244p\001I\263\370\230H\372&\013\251L3n+=\266J\177\306\2646\207\325q\313\2648\316\201\007\2571\262L\2343Q\367"
+	.ascii	"\202\335\003\220\201\373A\344\364\341\343\034\351\361S\2123\330"
+	.ascii	"\210\302B\365\364\212\202\262]{\315\245\247[\250\337\325\344"
+	.ascii	"\334\241\271\270\020k\263\330\326h3\033\325L\212Z|.o\353.6\260"
+	.ascii	"4K\303.\223\324\341=\261\370\355\346B\257\005erf\352M\371b\227"
+	.ascii	"-\005L\f+\303:\331\031\026\206mj\247]Z\245\333%\313\324F\305"
+	.ascii	"K\264\307.\273\212}\321\320+Lw\027\265\313\256\353\265\206^E"
+	.ascii	"@,\313\207\0173o3\270z\004qw\300I\251M\322\tjQc\032\261\370W"
+	.ascii	"/}\217\225*n]\350\032\206\237\347\212\035\226\237g/EE\270E\343"
+	.ascii	"4\213\256\f\211\332\261-e\030lt\334\"(\006\027\365b\273\370\300"
+	.ascii	"a\351EI\2173V\372\320\224wS\270\307\2271+Xi\235x\211b\212!K\017"
+	.ascii	"\346`\356\230.\222\2334l\351\200a\306N\r\331\027)cW\314\357\030"
+	.ascii	".fP\"7\214\357IS\230/\026o\231\251\313\273qf\361m\226}\2758"
+	.ascii	"\257\027\313\324!+\263I\352\322\245\237\266\252\350\276l\204"
+	.ascii	"\344A\273\266p\341b\301hD\001\276e\262\027\240yy\226k\204\r4"
+	.ascii	"\256v\350A\335\360\360,V/uT\321}\321h5\305\245=\323\273\273\233"
+	.ascii	"%\315dQ\214\302\240cRbT\311^W\256\030qf\211\002\225\324\\\210"
+	.ascii	"\311\221Z\261b\235i\3560\026\004S\305.\214\305\257qagw\235N\264"
+	.ascii	"h\320\005\224\221\"y\251\013.\334\272\021\262\006![?&+at\026"
+	.ascii	"\327\301\341.+c[vS\246\344\213eYE\3675#\003\310Q\221&Pn\024("
+	.ascii	"\026\013\n\265X\027\310X\246KoDY\330\322\003\207\244o\260\276"
+	.ascii	"N\336\316\353\304\2720\203\224s\214\021y:\234680\313\3556q\273"
+	.ascii	"swN\211\222+\247\223\207'\343\324\0232%\356WN\r\372\334\263\370"
+	.ascii	"\266p\231\264"
+	.string	"\331hn1\271KZP\362Ud\223\232\371\006\236\0202\270\0163\323\244%\245g\361}\353\265\340\r\264/\032@\034\351\201/\332\234\267\315\326\3514s\f \fN\315\rN3\006\355\256\241]5_\316\335d69\245\245]\265T\331m:\240v\200KGlS.\222_5(Hlh\321\3644sG\336\316{\344V}`L\216\030\300\0334\236\216\316\314\336\316kv\231\326*Li\213\214\227#*\260 bb\327\331\265t\332\371o\221_\347\333\323\262\312\342[\3666\240\\\013 u\026\337f+\245\335qY|\311\200L,W<,\276D\316F#\307\306\205\206\305w\354l`E\272L\235-\335Z\222\344e\361ip\204\205Y\2624\253;\232\242\257/\3534\263\253\363\362\262Xt\321\231\026\270\270,\226\003\314\342\242\270K-\006\032bA\202\330\025lZt\006KK\313B\3510)\353\033W\222\266\244\200"
+	.string	"\261\\\032\340\360~6\236SY\026\177\306\205\017\037\026L\004\2342\017\013\313bu\360V&\345\352\312r5TV\342\211p\303\233\261\363TI\372\273\343Z\375\3628\017\213\225\346\234u\334\266\252\350\3642\324\324NP\216j/\335\221\376\355\313DN9\347\0302\315\354TT\343k\231\356\235\337\246o\023 \347\035\02043\221\231\217-\251\2206\")\017\3712\320\234\215\250\224\021\240Z\032Q=!=\251\262\322\b\2102\307)S)\221\2369\347d##\245\b\314\234\203\364\314\313\334B\312\262s\223J\231\215\2309'\033e\"\017HFTK\244'\3212\007\351I\265\314O\252\214\223\215\210\234\222\214\262SN~R\341\345's\211\203\364d.\221\236TW\255\224D\365\025\343\351\243j\257\361\220\2142\f\246)\"'\034(R\223\231\355r\3563\027\331\211"
+	.ascii	"9O1\235\354\210\236:I\021\024F"
+	.string	"\221\032\021\363\002\246\242*f6\202\"q1s\346*\002\312L\035(\233\320\254BC\225;\246\362\222\213\234\001\300\224\263\26234\347\254\3149\377\234\246\2329\333\300A\322bb\312\031J\207)O)\335\\\344l\317\254$Y\"=\253\230<nF\236Z\371\250\251l\255lG\345\224>\225ey)\347\334y\251\326R\206\026\213/\225\265\203k\302\004\257\331\004&\301\2016\303\342\233\343\367cmI\024\212c\212\206K\026\227\235^;\255\336\235\322)\222\225\301&&\324\006\035\266G\305JG\003\007\002\241\302HD\256\311\020\352p\250\370c$\206@&\207Bp(\026\207\214\306\243\361\267\372\250' &},\216\306_\n\241Z\304\253\232\fR\203|7\311\241\361\370\243&\217\310\037\242\211\024\204Eu\230s \020Ib\261H\f\362\035\bD\210\037\0259\264\n\325\0248I\342OC\211\032\033\016:4\300\nj2"
+	.string	"E\200X\221B!\020\305\242\0044T\020\244\256\311\024L\330\220\\\215\304\243\320\3208\001\025\307\242\320(\314"
+	.string	"\200\240#\222\002$:\230p\202\005\306\0229\034\b\236\240a\230,Q\301\315\177\212\305!\022N\374\207\210T\215\252\212\364\035|\260\200\017F\230\340\367\021 \210"
+	.string	"A\204\357#@\340\341\001\341\003\236\364\037\360\334u\365Y\221\307\023%\004\261\020\272Y}J(\201\217D\273\372\220@\256CB\353\320\321'\210\205\220\207\024\252\b\252P\n(|L\224@\001\f\"\256w\365\321"
+	.string	"\t\022\310\237\237[T\215F!\320\317O-\n\177L\240I\026\207\204\200,\216\305\024HuE\t\352\017\362\230\302&\351[}\222'\254>\034\364\254k\2324\221\364Q\177\210+T\021\016\024"
+	.ascii	"#\213\343p\035\002J\246I\237\r\020\215%\326\344Q(=\242(\n\215"
+	.ascii	"Hu5\301\004\216(\326\343\017\007_\2228\374M\300D\222\030\\\221"
+	.ascii	"\302\325\004\240\314j,\241\256D$\213T]\325\242P\320\221\204\272"
+	.ascii	"\n\207BCA\024+|?2C\365\004\304\242\220\270\022\215D`\361x\f\301"
+	.ascii	"Gf\250\026Q\020\032\325\237\315z \025B\034\220j\020\021\305P"
+	.ascii	"\345\260B\025A]\205\032\250\3011\036\211\306\022A,N\344\004\261"
+	.ascii	"81T\177\214"
+	.string	")$\215'\250\311\241\340\232D\016\205\240&\207lR@\256j\220ZTQ\344\254>\277\244\n!\212#\321W<\376\034\327#\362\304\212<\n%\215B$\n\016*\214B\024Vb\b\353\021()\202\232\034\272Y\241\016\257:T\024n`U\223)R\224\240\026\207%\212\302\225\250\2028\344`$\006\001M \f\002\016\215\302\240\240\343\217\221\030D\263\032\207\216$\324\342\361D\360@ \222\305#r5\036\177|~\220!~Rt\370QHE\206X\217Gd\b`\322G\0051\205\361HB\204\236\025H\005\261\230\002\207\305\261\030\274\031\366\024\205\310uH5\316\250\305u=\"\201V\237a\317\320(Da(T\207\031X\034\213\300\325\347\003\236\024H\005\021\310g\330\263\022\203\210\305\232\325g\304j$\016\375\316\303C\302\303\t$T \375\001\201<\256\307\240\020I\244\272\202\210\034\2060\022\205A!~\220\311\020 "
+	.ascii	"0\354Q\207\307 \237\241\n\364\263\022Y$oV\300\312;\327\326\305"
+	.ascii	"\002\220;\367\003/\235L1\245\305M\261\246\246,f\026\256\nB\311"
+	.ascii	"\366T\300r\332\020\005\211\362\242B\325\2752\005\254\356\212"
+	.ascii	"\371k\202=\263p\217;\346\306\216i\265\204y\\\265\233\032tT\336"
+	.ascii	"\260\025n1F\213\231\233\3052\216\237d\340\252[\327\315\f\305"
+	.ascii	"\274S\252\344M\305e$\250\035`\231RY\024\034\307U\307T\034xp,"
+	.ascii	"\351\227W\035\221\305X\3071\023\312\211\222\250\305L!VO\026p"
+	.ascii	"\244_@\221\032\313\245\305\370\306\261paY\302\263\030O\035\256"
+	.ascii	"\006\352\005\275\036X\352I\325\224\"\2131\024\216j\347\347\260"
+	.ascii	"\215\007\225\034\241\315=\245OA\177\316\207i\034\327P\202\303"
+	.ascii	"\212\252)\375\361\214\177\346\227V'\245e\361\203/\322\007\213"
+	.ascii	"\360\021>\302K\232&\0313\2500O\230\216\227\330)\277\271=95])"
+	.ascii	"ZdbT\362\215\220\025\250La\030v\311\315\034\027\2620\213\361"
+	.ascii	"\013\2744\003\375\252rd\t+\205\315`\303\373\331\275\260#\214"
+	.ascii	"\3058\251\327,\024#vT,\306Hm6\006F\224\021\263\346E\2147\034"
+	.ascii	"y\001\203\326\250\322\3614Ij\205\310\320\210\210\214$I\322\030"
+	.ascii	"\202\n\020\206Bi\232\bn\017\022\200D=\022+\306fd\024$)(I:\024"
+	.ascii	"\226\266~kJ]\214\234\315\2705\221\371\267`{\3273%/P\340\026%"
+	.ascii	"\032d\233\332\017\030)"
+	.string	""
+	.string	"\271\262\005\206\307\346\306\264<\375\025\006\377\201\360\370*G\376\007sr\365q3\200H$\354IH\326\206\310\325"
+	.string	"\315Ae1\323\032\321L\343:\375\0248q(\016\311G?\350.d?\223n\303#\037\306\003h\261\377U\355z\363\327-\004\204\324\f\fU\205{\224'\341\032!\370\r\022\206\016\006\t\270\373\342\260\002\030\203\317\312xxYp\006\360.\331\317[\264Iy\262\223j\226\2502F<\242\344\r\356\263N;0\352\317\034/\035\n\317\024\345\020\274:zh\002\365\337\004\240\214Bk\240\267K(&\260\264\377\231\264\324}\f\003\b \307~t1X\223\335\203c\036\337^\020\373\033\357\250\247\214\352\274\352J6\201\277uU\0356$\214\307u\307\225A\365\b\231\004&k\202\257f}\247\212\214\024\373\354\232\017\311\207\256\220W\262\036\213\325\216j`\3337\b!9a4\255w\004'\323w\2070\372NMQ\230\325\215M\200\2012\242\220\"\362~(\370%:\235*\036\270\320"
+	.string	"\301\355!\346\033\317\306\251[\f\035\237G\004\034]>\203*tF\fF\005\333\201~\001\266T\336\205\036Ht \330/\320\247\377\272\307\347\366=\\\205O\341J\016\342\353\203x\240\212\262r\b\0229\2226\256I(\016=\ry\020\312\b\240*@\202\270\036.\217\256\273\252t\r\331n/\263\237\204v\022\022i\013 \376\272*\362\275\220n\265\003\002\336L\007\323\036\302\374\242\224\342\352\323*\003\222P\342!.\223\357\201\205\033\177\242\351s\303\0079\207\376\225\234\001\210Lop3w\025\244\266D\352\315\023\354\034\002C\306\375\226M\344\037\273K\"z\033\242\202\332\364ea\220&&\313\3274\221uh\216z\251WG\006\363\2537a\b\b/\001c\215\356K\225\247\374\215\302\252q"
+	.string	"\177\255X@\217'\245\377w@h z\202\264\324Z\260\272#\177z1\234\314\211\334o\372*\260(\005\016\345\224\343\254l\b\237[\340\270\230G\333\205\230\264\277\346\250=N\001\326m!%\322\321\302\0206\275Q\345\304\026\350\373\360\031\252|A\001\234\353o\255]$\326U\001\256t"
+	.string	"z\213\366j\366.\346\206\321\261\nz\374\007[6\214\366&\200\355\222\"\330\302\253\221\375\345I\221\207p\031N\355\206\360\214\274\031\275F\301K\247;\243\231J\372U\366\340\314\235\312Jf\367{[R\343\330_V\252"
+	.string	"\330TzMF&Z,$v\364#|D\235\327\016|\2632~Kx\201\2476\253_\311\345\316LB\204E\266\255\\\266\267P\361\363\027\234\310d\232\036\016d\362/\365*\r6c\222QN\361_\t0#\203\234d\255k\254\226\335\036\353\003\206\224\304\265I\203\341,{3\365[P\002\213!\231J\260\3138\344\257N\257\3608&\265\351\004-u\360-\335\006\354\342$6u\303\376\016B\022\342\231\004\2205M\356\335s\240\226d\013\007\037\270\371\225\351\367\235\t\320<D\202\202\330*\343\020\233c\242C\270\257pTC\211\255\265\007\312\001\022\021\335\301\240G\254\304E\214\231Q\246\264,"
+	.string	"\024\025z\323\256}\032D\201\003\277\273\307\347;\003\2652\344\026_\300\334\026(&\332\262b[\206]*\250b\3570\367\253q\254\020R\271\322[\257\302\360\201\301X$\310;e\307\214\261\020Q\262\312,\020|\325\362a\354\252\276&\335y\210\f\f\020\355\026l\277\375\212\300w\202\r\262\032\214\363\314o\230\231C\244\315\344H\245\2072RC\227/\f\340\003\3064\204\271\300\370l\370\033Y\305\223`\314\312\206\365\3261R\252\033oCF\326\316\231\205f\375\220\247\254\022V\202\317z\275)C\347=\317Tr;\036\260\333\212r\035\024QvJ\032\216\006v\372\023wCBk\300"
+	.string	"D\270}\360D\200r'\211\375\203G\321\tW\352N\262 \301\306\263\nN"
+	.string	"tm\264G\276\017\200'm\266\3370\314 K-~V\263tdA\206\003"
+	.string	"\275@\207|%\264~Nq!8\006\357'\220 \032/\261\221\263\253i\343\005\263}\017Z\002\2155\027*i\322\016'\365\212)\315\313n0\342\243\347\354\370&\017\316\225\276\033\231\237\240;\232\205\316 \2604\264;\213\306\261\rB\300Ov\355\312\370A\356\203A0\203\\\233\321\220?=@#\245R\345\272\310\207=*N\305T\224\007\277\330J\206\t\341\265\346v\301\231\034\372\222\177\245\344\227\266\257LU\007\342\0378\035\250!\242G\362L\312\357O<\034\264\335\315?(\024\n\324"
+	.string	"\340(\300\332\204\310yO\204x\247\245\301\t\277\026\300I.}q\252\277\002\337}w\372:wf\247)\337\355~E\320;\nI6\nwM\370\"G\321\276\274Y\241\355\n\ty\021|s9\0247\346\312=\3219^\312\361]?\371\t\247<\344q\331`LX\017\021A\260\354\b\320@\002\213\335\004\315lb\275\033\016\244\350\274$\f\231\003Y\021\022\212\270\264\235\031\021{T\270#\265.u\216\303\332f\244mE\032\242B\252UHStSk\277\221\003\304s\266\234D^\274\366\376^\357~\302?\232\202$\320<X\372{\3179O7\330\"\270\270\226\2625\"\004\330\205\354\226\037\377_\244=\r\265\006\r\234\325R\223i\243\204\336>H\212t\320\354Xlvtw\232\255M\024\345m\231\233\220\037bA\323\263\203\363G\004K*\315-\305O\365'\232p\245\3711\020\003\334\365"
+	.string	"\361\350\3619{\336~P\277#\375\242\322\263\334)\316l\372\247+\255\313\256\242\226\244\321~\366\r\316\307\007\367\177\361\233\016K\217\261\342\nfh\346\352\365\030\367\333\302\341\343\235a_\3555\317\233\325\2177\317\333o\026\277\357\3268\364}\234v$\230\242|\3611D\300\357u\240\253\337\317\017g\0306\232\342\367K\322O\f\330\020c\013\206V\001a6\272\323\356\366\007\t\253\034f\205\307AwO\343\335\337e\341\007L\333#\365\342_\017p\266\262\260\263\031r\350\370f \013\217x\335\225=\216:\031\261;\232G3gH\375\201\201\213L\277y\270\\><\346\035\304H\347\b\354\327\300\0341\273\003?\233\206"
+	.string	"w\034\227\032n\351\334M\360\020\314\370r/~^\260O6/\023\237\255\273{\312\1773\330[\313_<\217\341\202\333\225\207\253\232j\347\234\2470\366\236M"
+	.string	"\277a\022\2123e8D\233\222\333\2748\037\215\017\243\177<\273\fW\257\330y\275\365\324\207a\340\202\327\220x\313\334\360\360!)\377\216/\250\260v\334.t\315\021\3221%\373U\341\275\345\215\216\367\347\344\365aV"
+	.ascii	"\223\300\354\2536\013\270:\327s\034\277\016\256\237\033\256\315"
+	.ascii	"k\034\325W\354\357\362\276\255)W\361\370xcg~\247\320\227\315"
+	.ascii	"\307\345\322\336\312y\313p"
+	.text
+	.section	.gnu.lto_.symtab.54cdc557a31bbb6a,"e",@progbits
+	.string	"motorPostInitNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"motorWriteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"motorUpdateCompleteNull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"motorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"motorDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"motors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.54cdc557a31bbb6a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
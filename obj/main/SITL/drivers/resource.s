@@ -0,0 +1,213 @@
+	.file	"resource.c"
+	.section	.gnu.lto_.profile.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\001"
+	.string	"\315\212\315\215\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.da6a7d5d588ef124,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.3.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375`,\r\035;"
+	.string	"*g\344\02670lM\007\0030\314\315\377\001'\377\017\3030\334 e\232t"
+	.string	"\366i\007\n\200\360\346\316\355\241j{\373{)\211\371\265\271\230\372j8W"
+	.ascii	"\214\035i\266\255%\221)\311b\001l\001\\\001F\217\343=\331\256"
+	.ascii	"?\2749z\334\313[n\327]l\224.\347\302\332\256\275\322\250\271"
+	.ascii	"\\\251\355\372\313L\322\3472\246\355\032l\214\232\317\205\201"
+	.ascii	"as:7#\332\256A|\027\245\323\2759\304k9z\235\233\373l\327b\357"
+	.ascii	"\242y\335\233E|\225\324\355\\\230\313<f\273\036\361R\324\334"
+	.ascii	".\223x2\364E\256j.s\222\355\272\004\2232_\364\346!\333\265\211"
+	.ascii	"$I\277sSm\327'~\311\346w\357\207\332\256Q<\2212g\304\232\313"
+	.ascii	"\327\264]\247\370\266\2443R\021\313\350\220`\230\313\267\333"
+	.ascii	"\256W\270J:\244\367\343\376\254B\363H\356\353\001\204\352\350"
+	.ascii	"\221\336\030\346\362\343\004*\225tI\356\223\021$J\206Kz\221\346"
+	.ascii	"\362\241\270}\232\341\223\\\032\346\322]\275q:\363I\257\rs\351"
+	.ascii	"\227\3402)\035\223\353\215\342,%\035\323+7"
+	.string	"hR\3223\271~\bAJz\2467N\241FI\327D\306\320\035\232kz\035\213\234\242\244or\235\311\334\241\244oz\203\320\315%\035\224\273VW(\351\240\336\033\346\362\354P\034\232\207r\323\314\345\021\221\233\232\207zu\230Kb\"@l.\312\355a.Y(\352\243tQ\257\017s\211\302\316\021\364\\c\327\003\344\307\205\224+4\260\332\332\226\256\304u\020s\371\3335\316c0\376\375\bZ2\227\334%\177\021\313a\262\230L&\227\311g2\232\254&\257\311m\262\233\f'\307\311sB\344: \316\006\234\332\220\fY\2013\035\024\002\231\271\364y\331r\214\020\336,\333\365\2771Fp\253l\327\231MY\204\327\311v\315KS&\301\365i3F\t\257\2577\306x\301\355\371\034A\017\214\362\302{j{Qb\320\312[\216\030\336\336/cQfp{w\333\365\226\025\265\f\257\241\355\232+OQ\333\275?\3335"
+	.ascii	"(e\373\305\263]\007hR\346\241' +\001\342\241'f\273\036p\004\355"
+	.ascii	"C\357\312vM \027a\373\320+\220\205\034\273\334\236\001Y\312\256"
+	.ascii	"W\037x\245\364\322\246\266k\004\254\216^\272\323v\235 \3251\204"
+	.ascii	"\246\264]+0\305\026B/\030u\024\253\333\256\031\200R\212\275\272"
+	.ascii	"A\247\243\bw\317v\355@\323Q\304+g\273~p\3518\302M\263]C\240t"
+	.ascii	"\034\241\301l\327\021\"\251\241\320V\266k\t\216\200\240x\365"
+	.ascii	"\221\355z\002#e\n7\326vM\301\356\230\342E\265]W@tT\341~\332\256"
+	.ascii	"-\320\261\251\270`Hm\305\273]c\030\304\266\342\320v\235\341M"
+	.ascii	"\315\335\\\336\333v\275\003)\335\355\345i\360\223\372\033\217"
+	.ascii	"\315v\275a\217\321\337\3363\3335\007<h\016\347\362\266l\327\035"
+	.ascii	"\352\2609\334\313\243\262]{x9\001\247\026\030\030\030\030\330"
+	.ascii	"\027X\030\b5\345\302\354\031\346b\f\231\026\331\262-\274\nO3"
+	.ascii	"\244\272\002\307~\270h\024\n\215E\037&\302P\203B\241\261\250"
+	.ascii	"\205it\235\321XcK\323q\266\346\245c\355\214Gr\255\206\027\216"
+	.ascii	"\344\f4/\032k:\274\272\"\340\264\034gk^;\322\322\326\274\266"
+	.ascii	"0\031\0218\326\246c\310Vm\301\006\003`\337\343|\334\217\377\361"
+	.ascii	"@.\310\337\034\316\0079!7\344rN\347u\216\310\023\271\235/rF\376"
+	.ascii	"\272#\177\344\221\\\222S\362J~\3111\271&\337\344\235"
+	.string	"\334\223\203\362P>\312I\271)?\345\251\\\225\263\362V\376\312a\271,\237\365B~\310\027y#\177\344\221\274\222_\362M\336\311C\371(?\345\251\274\225\277\362X>\313oy.\357\345\277|\230\027\363d\276\314\237y4\257\346\327|\233w\363p>\316\317y:o\347\357|\236\327\363|\276\317\377y@/\350\335\036\356\343\236\320\027z\271\237\373\272?\364\211^\321/\372\273\177\277\321?zH/\351'}\245\267\364\230>\323ozN\357\351?}\250\027\365\244\276\324\237zT\257\352W}\253w\365\260>\326\317\312myH&\222\215\344eF\222\223\344%\231Iv\222\237\344(YJ\246\222\253\344+\331\315Yr\030EW\026\032\017a\024yxX,\362\360\252\266\352\260\207\325\027+\312\366x\370\f\002y\270m\201c\353j<[3\324\304)\313\256\3103\b\324\302f\255\331\212\374a2\343\030\032$#K\3276"
+	.string	"V[\234(r\005\022Uv\013\017\321\226=\262&V\3314e\325\241\026\026\236\300 \213<\303R\023\373\260\21338<\265\360\027X\030\210 RM\203\354/\270\002\317 \033\240\005\013\024\262\320\302\354ib\3664\203\254\352\303\354\017\263>u=\222\375\360\251\242Z"
+	.string	"\360\030k\344\341\366D[4\270\205W\264\210\242c>\034dU\0366\361\212\266+\372\202\230j\341b\272\266,2\210\n\177j\221%\002\327\226\013\257(\f\265\370\303\354\351\303\300\026\030\3242k_\230\230=\221,\013,\016\325s\013\223\031\205E\244\331\n"
+	.string	"\013\201\351\212\262'\213\376\260P][\242z\"\201+:\004\236\002p\3218L\333\036^\321 1e\201\222\021\201+\027\366a5%\246\305\036&\246E\344\311\016\221c\254\221\013\253\347\220\207\203\304t,\210\n\267p\233\022St-\2328m\315P.\263\366"
+	.string	"&\242H Q\210"
+	.string	"\013Q\026\331\022\201\310\257/\261\260\363D\232\255\t\260\013a\201\013\25010\303(x\"\023\024$I\241\260\254\001\021\206\2101d\353\001\021\340\020C\221\240:\006C\b\252\001,\020wY4\3228\355\030\215g\217\333?\213\356\362u]\342P\256\263(\202\326U\0358\017h\033HM\332\207\270\300tB\236\252Dg%@K\030\346y1\006\036\276K0\210\002\276\2427\032\223\362'%\227\260\245\005\214#\313\231+5\334_=\345\366\205\332\334f\032\362z\363\252\210\316\237y\303hi\332\370\007\351\377\377A\377B\370\240W\323K\325\203(\251\340\325\r\256\340"
+	.ascii	"\326\212r\036\232\306\312\034\355\311&\331\325,x\234.\226,\304"
+	.ascii	"\001Y\261w\f\230\271c'\264\237>\006T\\\204\364T\002\206\230<"
+	.ascii	"\263\027x\243\306\b\327,E\215{<3\032\311=?\"\222\224c\032\016"
+	.ascii	"\333R\2704x\344B\fI\345\r:\002\002\306\210\316\325K\303N\032"
+	.ascii	"\342-4Z\002\351\f\250]\261\354*$\bz\210<HS$\334\231\300o\352"
+	.ascii	"\234\232Nh\264l\025 \372#j\217\006\200\021r\026\237\267\213\031"
+	.ascii	"\350\006\245uD\320\276\357\245:\"j\017\306\321\r<\262Q\004\321"
+	.ascii	"\212aJG\360G\247\253\007\352\024\377\247q\r\237p\242U\334{!\035"
+	.ascii	"MG\347G\353rW\207\375k\310\371\225@\255\036\356\252\275`\320"
+	.ascii	"I\"\030\367\212\343k\tA\215\273b\271N\234sWp\300\221NJd\275("
+	.ascii	"/\273\252\361N\343\035f\0368m\276.\300K\210\374\236\262\260\250"
+	.ascii	"\365\r\343\031\306yb\230\306y\300\230f\357\354C!~M6\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.da6a7d5d588ef124,"e",@progbits
+	.string	"(\265/\375`\372\006\245\""
+	.string	"ZA\260\rH\220\322N:j\001\254D\264\211\306\3124\312D\371b\244s\005\322\315#\002 \323H\273\035<\003\211\273\277\017\025\bJ\354ym\247\201\023\001 "
+	.string	"\b"
+	.string	"\002\002\200\200\240@2e3"
+	.string	"T\005 \"\352\217\257\356\206\274\243L)\246"
+	.string	"\321"
+	.string	"\316"
+	.ascii	"\017\342\007\021\234R\363#\245J\323\364X\020\216\322\324\346"
+	.ascii	"XB\2764\265\021\376\t\376\004U\n\tj\313\254\206\360;\022\365"
+	.ascii	"\201\330\257\372\217\241\371S\204L\263\3224\025\246\300@\362"
+	.ascii	"(\267\372G\304\356\341\027\2654\202[~\013\220?M\025\246\017M"
+	.ascii	"\357\3176\227}\002\366_\354\017\355\013\260/\264\357b\237\305"
+	.ascii	"\376\212}"
+	.string	"\025\373\325v\024\333|\266\367l\347\331\306\263Mg{\316v\234\355%\266\335l'\261\255f\033\211m\245\3553\333e\266\311l\213\331\016\263}\300\276\221\355.\333\267\235\264\275\313\345ri[\310v\214m\326\005H\314%\224\335q\253\301~\232,c\250\217\006\304\021\332z:\242\254wl\312\240\255\276\322~\362gm^tL[%\3744\001\230\241\276\021\036KF\247\255\346\213\224\251T\031\361\266\266\372e\366\307N\026t\032\nB\333\352\254\237\346J\025\352\023\021\256}\335=\r\021\013\246iKj[}1\373`\017;V\206=\256(r\262\325r?M\227\017\315{\241\376\327Be%\223[[\276\343\237\362\361\251w\255\030\323\024\205\003\272#\216:\275\364\207\005\003\026\276\032.rp\265\314})o\220\300\"\243\220\036[\375-\373T\347q\255\340Q\232\342\244iJ\200\345\330\365U\264\325\276\326\263R\214\307#d"
+	.string	"\341\224\320\322\f$\325J\330\036\216\241\255\267\372\225\217\025^\233\t2\222\244\266\246l\272\304"
+	.ascii	"d\243m\253\277\314r\351\243\301\203\266\365I\324\217b@\310XX"
+	.ascii	"\037\337\233\212(\273\255>\237}\273\357\271\030Q*\353\331\372"
+	.ascii	"\243'\250\017\005\310\225\354\203\332:\324\313s\321A4\226\265"
+	.ascii	"\325\317\263\337\344xWV6l[\317\364\323\274\035\352\337\375\242"
+	.ascii	"\220\3654m\035PG'\245\224\244\263\325\247\263/\3679`\025\032"
+	.ascii	"\337\216\255\257\361\323|i\202\372N\204-\236j\212\266\236L\342"
+	.ascii	"~)r\252\214\266\372q\366\341\276\244\205\305\215$\245\255N\373"
+	.ascii	"i\006\333P_\211\212Q\362\205\2147\267*\237\240\250\255\276\233"
+	.ascii	"\375\266'ypl\212\261\325E~\232\3004\324g3u\030\367\244\326\324"
+	.ascii	"\2009?g9[}5\373i\0176\340\231\0172E\"\210\231\231\"\021X\204"
+	.ascii	"\331\020S\215\242\024\020\\\260P\341\027\323@&\246\030b\206F"
+	.ascii	"\246H\244)\312\210\340P\324@\364\300\001\246\0031\246HClP\200"
+	.ascii	"F\246\003\214\205\242\214\207\0213,\266\267\210\310\355\352L"
+	.ascii	"k\253\227\310^\235M\021\364RZ-mUp\203z\207j\022\236\317\215\025"
+	.ascii	"\332\240%\253\255\241\255\336 \373^\213\202\304\262/o\253\337"
+	.ascii	"\340P/\020\360\b\231\234\217\375Y\037\244\037%\353c\357\211\355"
+	.ascii	"\t&\315\326\366\266Z\357\247)\004C\275\307\345rH\023\317\356"
+	.ascii	"\264\334\301!\355\216}\2635a\304\201\021\265\325\301OsuP\257"
+	.ascii	"1\345\r(lh\253\312\226\330\034\025/\224v\266zs\354\275Y\234 "
+	.ascii	"+^LNr[\021\3744\353\207\346\326\240\001z\25018G\f%L\223 \242"
+	.ascii	"\244 \311\034\300\002\221\340l\334\021P!\203\002I\226\021\257"
+	.ascii	"\237\001\311\326\036\n\036'\314\372!\260\b:\305r\251#M\210\034"
+	.ascii	"\304p%\b\0247\024O\262\205\345\270\350\222\344\364m\005L\377"
+	.ascii	"\002\372x9\316#\206g\300\307\375\025\f\226P\336\346v\257\\x?"
+	.ascii	"\321\264s\034|w,}\364P\024M@\275\260<\243x\020\021\222\234\250"
+	.ascii	"LC\322\346\322\016AZ\016\240Oe&\370% \266\254\261\f(\033\231"
+	.ascii	"\366 \256\324-\332\350X\302$\363\341\345nY\236\330\ne}\214\\"
+	.ascii	"\2005\025\232\266l\2036+\317\022\022t\247f\251a\003\327\262\322"
+	.ascii	"`|\213\375#\273\340\305\260X\030\336 H\250\fN\335L\1778W\362"
+	.ascii	"\373\347\234\214;\340\215V\305\214 8\013QT\250=\240\327x\275"
+	.ascii	"b\025"
+	.text
+	.section	.gnu.lto_.symtab.da6a7d5d588ef124,"e",@progbits
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.da6a7d5d588ef124,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,630 @@
+	.file	"sdcard.c"
+	.section	.gnu.lto_.profile.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375 \026\261"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.text
+	.section	.gnu.lto_.icf.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375 \327\325\004"
+	.string	"\204\007\313"
+	.string	"\r"
+	.string	"\337\310\357\222\006\020\002"
+	.string	"\002\001\002\002\002\003\004\002\003\002\002\003\001\240\342\234\212\n\002\205\202\223\224\r\004\003\354\301\314\336\005"
+	.string	"\004\235\312\243\244\002\b\002\005\002\001\002\006\007\002\b\005\007\266\335\207\245\005\004\t\002\b\b\276\356\274\271\007\n\002\b\t\226\237\371\262\t\013\002\b\n\324\274\303\350\007\f\002\b\013\246\376\330\233\013\f\272\313\311\210\006\r\352\374\247\204\b\r\002\b"
+	.string	"\016"
+	.ascii	"`\024P\n(\007\214\003\306\2219\007\347\031\253\032\221s\fPo\301"
+	.ascii	"\003/2\254\334\265\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375 \274\335\002"
+	.string	"b\004\f\024\260'\035\f\003\300\3030\fCu\266m\352\026\217\275eJ\001\316\221\030\212\020L\337\200)\362\254\365V:\336\351\322\360\231\343t\322\237+\366\026\223\021"
+	.ascii	" \004\025\2270\001\343\325?pEP\2453#0u\370\251F+\002G\035`1\304"
+	.ascii	"YPi\216\347.\271\265`\200\005"
+	.text
+	.section	.gnu.lto_.inline.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`w\0015\t"
+	.string	"\"\01733`m\322\030\300\240\320rD\r&\035b\247\237\374\0348r\236\321\316\370\221\363\256\302\376\236\023\033\037\3112\030\206ari\366\023iR\032m\023irK\231\002S\2271\223\245\316DD%\343A`H\220L\003\\\2766M\224'\273;\375\2766\375\005\336\237J-\005X\276\266I\372\215\253\b\0019T\371\212\306\361h\326\205\335e\370|\314\334n\223\032)\241O&\037\r\234\305DC\207:\2776\\\361)\305\277\266\3741NO%\310\222\020\n\005\256+\226\035\220\366 \375~X\2024\216G\267\316\322cw-\247u\026\340yf\271\273\033}\346@6>\"\236\224ID\016\2542\341-7bQ\225\n\273\361\300}.:F\006~:\021\002$ `\002)d\325\003\200\362"
+	.ascii	"sUp\001\027\271F\023n\t\013s\026cF)\017A\351\342,\030w\212\\"
+	.ascii	"\220\234\317x\013\355\267\035#J\021\004W\n\233\026\002\317Ip"
+	.ascii	"\005\006\216\t\322\033(\013\311\004P\300\033\313p?\254)~\020"
+	.ascii	"~\220\261[y\307m9\355\016\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"m\005"
+	.string	"\262\b\031!\240%I\007\377\377\243A\200\005"
+	.string	"/\036\337m\377\377\353\273\232\034[\302jk[\263\r\021\233\310$\003LF\2220@x\b\210\216\257\221\214\246\266\025\013ww\033\250\037\272\241\243>\300\177\005\222\221\213\023\247\244UM\253\336\232\2577\375N\316'\247\177WQV\034\036r\304%\255\265\360Z&\353\322<\021\036\020\035"
+	.string	"@$u\367n\026&\305L\276\252\030\020\276b\263\207\035\353\302]\253r"
+	.string	"\004\236\351\360\207e\344V|\200-\323d\025\312\206\256\224\326\210QB"
+	.ascii	"\370\344\025\024\362\224\004 7\250\243\237\r\300|:\231oh\300"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.pureconst.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\231\004\002\230\004\003\200\004\004\231\004\007\231\004\b\231"
+	.ascii	"\004\t\231\004\n\231\004\013\231\004\f\231\004\r\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\365\003"
+	.string	"rF\022\032\240\031\322\001\377\377\377\377\377\343\252\203\375\366\277\375O\205\372\306f\233-I2\005\252\272*\020Ld"
+	.string	"\021<H\035\007\264\361d\354\350IW9q\316\305\005\360\212\256x\317\323%\236g\242r\022\031\234\353D\274z\230\306I\002\026"
+	.string	"\300\023\260\034X\f\f\002\374\201\201\001/`\270=>-\266\256\250cT\005\257I[\206=*\274\262Z\367\n\257\336\354"
+	.ascii	"v\2732\234\026[\n\340\006"
+	.text
+	.section	.gnu.lto_.lto.b00191cc014740b7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sdcardInsertionDetectInit.16.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`z\002\375\022"
+	.string	"\366\241zH\300\324M:xh\017\255m\223\223E\207\243\203'T0\227\206c=\022\023\332\005\354\314\371\215\352:\272y\216\177\237\227Y\335\016\373A\n\322\373\257&\221((\220\246IZ\n\210\020:\361D\311N\246\\\007!\233l)S\nd"
+	.string	"]"
+	.string	"i"
+	.ascii	"\013\274\362\275s\356'\362\335w\023\371\3163;\310sD\323;\001"
+	.ascii	"\302F\343j\316\t.\212\317\356\311.\256\316\374\033\235$"
+	.string	"\274\321\356\215\270\214(>\244Z\224\334l1\001\211\240\033;\332\371<\002\270\371|\243\002*&\"%\267Z<\351Q\021\336\350\372\341\226\243\3529\230sZ\303\233\210\373\273m\033\333\flE\n\212e\033v\0314\337\234\265\026?\306\006\331\227\342\235\177#\337}Sx\246\200\212p8\232e\347h\272C\366\343\234sz\205\354\343\376VT{Q-;u\247\352\030\325\273jU\365M\032\344\256\204\030\310\232\263'\253\310\234\352r\254h\331\276\332\207\361\242\331q7'0\247\220\221\2459s\001M$AJWV\340\231\\K\036\017%\027V\n\245\323\303\"vkW\270RMR|\n\253p\216\"\343v{\233S\216-\334\306\205\270\255\240\244\027\270]\033\303k\270\006\374\230s\266\370GGz\371\005F\037\302\310w;$\254j\251\256\315AF\037\356\252\324\226\346\257\356C\374\340\260\0359\021\026\325\322\232F~3\314"
+	.string	"R\01301\032f`/\351\027\213K\314\365r\221\201\262\330\213ML\314\005\234\211q\311\200\257\230\fdA`X\207\227\030\350\001\006\213\201\255\334|\234+\364 j\ngs\274\003\272rom\b\021Tt\226&\345\372v\354\237~\n\350\312S.A\312\265'P\320\207\016p\3244\265\2634\275\365\340\211\222.)u\270>(\271\002L"
+	.ascii	"\225\350v\250F:\325\0041 \220\002\021\261;\017cB7(0\300[\337"
+	.ascii	"\353\242\221\320E\306\305@\\e4i\2066\022\020\305\321D6=\f\304"
+	.ascii	"\005(\227\264\225c\004\301&\001\275\261\246<\270]Z\315\260\340"
+	.ascii	"J\315+\274\004\2731\317\313\023y\366\274\276\t|\227\032{i}z9"
+	.ascii	"\353\313\365\265\260\227\303\327al\rAa\37064\213)\001G>\233T"
+	.ascii	"\326\240\341^\313\325\270\350\036"
+	.text
+	.section	.gnu.lto_sdcard_isInserted.17.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`#\001]\r"
+	.string	"\346\231\\C"
+	.string	"\221(\035s\024\323\032\322\364\341c4\376\204\211\231\323\373Dtm\230\376M\307t\260'\342\021:\340\177k\350\001a(\002\203u\354\274\225^UUUB\350'&Z;'\017\254\323\361\330\217do)S\nJ"
+	.string	"E"
+	.string	"K"
+	.string	"\0161pb\356\337\206\322O-\235\313\214\335\017S\r\347\036\241&\347\177u\030\302\264\202\344\201\036U\016=vW\343\215R\341"
+	.string	"\0300\0376\236\004H\300\224!\305W\317\024O\224\311\221`w\235$\317\302}\335\266\002\333\005\354S\b\276\311\365x\325\030\230\026\022\241l\331\037(\025e\037\256\262\330W\335\321i\350\264:\235\231>\200M\n\203\351$Bc|[j\331XVT\301\341\252\337>\361W\326\\\305y\200\276-\205\254\260P}<\372#\363\030\251P\021\254\264\272\013\241l}B\fJ\nr\227\252\3669\n\316E5zp\321\221W{$\313\223R\003\240\324`\215\024\224\336\213\n-TQ\376v]\027\234\2201J\032\266\037\334\304\226\331\335\003~\211\177%~\352\321\021L\362\244\307$\fJ6\217v\231\003\322\321D8\235\r\3334\017\204\217\326\301\032|DF0\216\266a \002\2349\360h\030I\226i\230\346\333\303U\026\277\003\210\033\020j\207h\325\275h\352u\032\321\275\344\317]QSlG\335t*\254\220\212\242\242l\007\025"
+	.string	"f\204\036\344\206\002i\326\202\006\201~\200$\024\354\013\371\224\201\027\212&\235f\304vM\224\247\305&\231"
+	.ascii	"\211\":TD\340G\220\320\350U\352+m\263\326\t\005"
+	.text
+	.section	.gnu.lto_sdcard_preInit.19.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375 \362\205\006"
+	.string	"\242\314-1pm\032\003\240{\375 e\313\372|J\261.J\312\3230T-\231n\022\002\242R\241\205e\272\225\321\377_\243O1ki\335\202\"62i\245L)\016S\003\007\276\250/#E\315\223(G\305\215\304\024%\307\2314\017\356E\312e\n\n!6\321E@\030\035f\336\254\352\001\005\253hgg1\214\326"
+	.string	"\377_V\265\313\022:1(\371/VTn\322B\033\230\266^\2559\334!\3551a\201\277\"\021\371\247B\023.n\235&\210\334.\036\210\334*[\024O\215\033d\304\"$\345\277c\031\226^\262\366\207\003<\237\216\227\205\341\177\227\347\003r\231\333\"\264]h\013\n\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sdcard_init.20.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\230\001U\020"
+	.string	"\026_oG"
+	.string	"\261&\035\\\330\303\313\375\354x_h\220\240\344_\\\327\241K\364VN\215\016\035!#\006c\211\b]Y\375\315\230\036\243\235\025cj\264\\CD\031\367\252*\001F\254#R\221\350`\203\001\002.G\b\331D\312\224\002]"
+	.string	"U"
+	.string	"]"
+	.string	"\017\331\036\215\262\201\376r\355a74\240\020\332]OA\034\365-j\232(?Y=.\262X\230\372\026\363\250\205\310\350\374|\204\031\264\003?7\036D\341Kj7\361\001\254\0240Y,\204\271j\"4>\340\020\205.Z\201\231\0310\037\341*\223[\260\273N0d\335\334m\253\330N`\037(\327HB\307,G\225C\346\222S\333D!\017\032"
+	.ascii	"\316\316"
+	.string	",h\245)\373\225Jm\331\327vw\2555\366s~NK\253\2463\323\0275\240\021\312!@\266\273a\210\307\372D\036\021\"\333O\373%\216\203zN\313Avkd\354\354\276\020\330@\367\350\327E\266\307.;\374\"UY.f\035T9\244i\313:\247\021\327\256\352\240\037{\213\317(\247<x\332T|\305\311\267q\312(\017\216\266G\007.\031\030\323\271\226\303\356\022`0B((\225=\036\002\234\361QmY\217a\273\006\200\325X\345\016\333\022\016S\351vW%\376\t\026Rg\363\350\267l\217\001)\243\b+\244o\363GrR2\371NL\236\251\204RaT:\361VF&*\336W2y$#&\261\240\224\274\t$R\311\023\275\366\332j\215\265\036\232Y\220J]6\220\364\037l\234Z\325\nh^4e\333\344;\026\272\335-\361c\027>\325\310\003#\177ndbDm\231\305S!\300l\2542\035"
+	.ascii	"3\241a(\006\210\003\3032\001\254\021\265\275\207\233\330\224"
+	.ascii	"\271\263U;\254L\n\336\231\266\204\336l\005L\353\224\305h\366"
+	.ascii	"\213\270G\342\002\326\017\353\027$\216Gf\322\004-`\326%\254f"
+	.ascii	"5\032\270K\246\222\276\b\305\362\\\n\n"
+	.text
+	.section	.gnu.lto_sdcard_readBlock.21.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\265\f"
+	.string	"FXXD\020q\233\016(\034i\030\3007\201\341\204,\034\3075\262\n\n\304>\001H@\3411\"\351\f\216\346o\204\365\036\233\020\t\221}\375\335DW\215\200\274\203\205\316y\223.%8U\332\320\305\355\273\331\335M\356\224\002D"
+	.string	"H"
+	.string	"?"
+	.string	"\327\356\206\224\026\273!\002\037\260.9\0370/\253\013\230\227\266\235@\001\350\322C\017%GA\221\234\260\261\033b\332\341\245\307\222\177\024\257D\200\250q21=^\032\354\256\343\311\004\303\255\267]\300v\004\373\036\001\363*\277|\352\257ft\224\321\307`^\3040@c\267\244\345\306\302\220.B\330\006\355\214\315\022Riv\204\203\214\007\325\312\004\002\232\0351\221\302@\303\227"
+	.string	"\257R\341\001vOfx\254K\207V\214\366G\234\004\370T\210\003\227.\320@\242&\333\242\263\370\254\335\365\370+,pX(\322\274\214z\245\236\342*H>\312\335G\374\351\322\377\230\227\327\315\207\f\"\261\305\016MQQ\354W\273\273\326\023\333\321\327Y\376\313W\376\031H\346"
+	.string	"\200H\313>\243Q\246Y\036\007\002\221>\223\002\267u@\020i\335\350\203\261\326\331\274L\333>\354\3638\t!o\303:B\031\007\246y\037\326\331\270\363\340<\f\244\353<,\023\356})GD/8\023/:Uj\245\216\032\024"
+	.ascii	"\005\013E\231\001a\230\001v\272g\231\020\312\270\206j?\270\320"
+	.ascii	"`\315\3023\230\bF@\270\2400\030\006T\b \374\246\246\300=\204"
+	.ascii	"\2519\246k\222\001"
+	.text
+	.section	.gnu.lto_sdcard_beginWriteBlocks.22.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\245\n"
+	.string	"\026TJA \307*\035p\216\f\b"
+	.string	"\236"
+	.string	"\002\307\020\277\273'\022\302\265\236B\243\035N\006\306\020A\f\3115\350\273\264#j\240\3055\234\261\220\037\020`,\210A\001\200~\302\215w;;\3246B\310\336{\247\0247"
+	.string	"6"
+	.string	"7"
+	.string	">\200\007@9EG\224\026\302\253\345\243\200lw\3546_\320^\351\025\264\327y\362\324e\312\277\200S\026\225\005\254\226\352r\373\354\256%\253\025r\317\333n\260\375\261\317\020\266\364\366\361\257\217\375\224J\313)}\016#k\300Q\260\0132{\260\fj\202\025\333(;c\217'\232\260\035&#\036)\037;\371\262[\342"
+	.string	"\301\356\350`\016\367j;rn\363\201\304c\252l\203?\220\301\355\256\3077\260q\301\301L\332\253\234\227\330\007\234\200\311\207Y,\311\263^\375\222\366\372\251I\021Y\311\231=\252\344|\331\247;]\016\244Q\t\204\320\b}\243\210\t\017\244\220\300\330\353|!\310\373\304N\fC\030\242\360\353F\"PE\347\205b\327\321\030\264\b\205\035\t\004\303.3\356\351N\32767\253\311\341\213\254\223N\007\017"
+	.ascii	"\3442Pfh\253\201\263\266(n\023B\250\340\032\352>\327\360\346"
+	.ascii	",\312\304\004\bL\004#\200\n\030\374\314cj'\031"
+	.text
+	.section	.gnu.lto_sdcard_writeBlock.23.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\225\f"
+	.string	"fWUB0\215\223\0160\030\362R\246\225ix\366\321'\242\245j\n\361\234\016[e\367\375\373F1\250\365\372\266\314\366\271X\304hDDB$\302\240\003[\341\236\361\200N\320\276H}%\303\023D\244\355\275\345N)@"
+	.string	"E"
+	.string	">"
+	.string	"&v\273\002\336\230\036m\373\035\356\241c\017\3542\204"
+	.string	"\210H'!T\354v\226\306\005\310G\370"
+	.string	"\362Q1\334\363\347\361\357r\310a\344\002\n}\3760\bv\327\017\024J\271\365\266\t\330f`\177\006?\346,\277\374\312\037O\372\241|~\361\371\026UJ\212\215\322.Ji\305\242\210'6\330\356\330\225\335B\0021\326D\204\242"
+	.string	"\262<x9\240\335?t\276\022a"
+	.string	"\306\232\200\250\320\321M~\357$\022S\273\027^\002\032\025\252\237Rj\300\302\211~lk^\202\233v\267\303'!\001d\032q\344\343S\212t\021\037\301\361G\336D\336A\217\276\210|\274fh\240P\362Jv\367y*\262\017WUl?So\t\327\310\225\340B\203]\231\315\346\302\246\251yxp2\022\202\226\205,\320`\333&ca\214#\233\027\226q\02675\007\0373\263B>.\020\013\233\234\305\221\341\255\2016\255\221m\233V\325\355\341\252\n\245\032%:\301\325\303\250\f\030"
+	.ascii	"\005\013E\231\241\265\006.\320F\371Y!\204\n\256\241\356s\r?\205"
+	.ascii	"\r\250\265P\316`\030\f\003A\200Bp\031\030\001*.\020\036\fk*\004"
+	.ascii	"\356\026\241M\360\323\031\2230\311"
+	.text
+	.section	.gnu.lto_sdcard_poll.24.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\235\n"
+	.string	"&\224JA0\247*\035Ph\3776\310'\273\rVoqW\\\357\177\340\304\242E\335\235\232GebN\024\365\355\333\317a\261\035\033\344\006\r\035\250\244t\022\216MP\"\030\nZj\341g\021\205\211%D\312\224\0029"
+	.string	"6"
+	.string	"8"
+	.string	"\257\001\037"
+	.string	"ls\222\337\222\\<\267*\372\245s\235\251\244\225\002F\220/\267\320\"PC\030Q\\\246\026\023\271\354\252\032O\252\336f\316iM\215\254\273\273m\t\333\016\366\023\002\335\367\2627\260J\224\020\223\336l\262\244\373\262\317\315u\331V{V\357\252U\325\277P\234\330\030d\3129W\267\0073Aw\300\3046\311\306\370\001\202d\361d\311\352\001\334E\255\353\355\304\310iK\2663\256\322\021\341\223\036\341e\316y\330;]o\245l0\323Z\254e`=\262|+h\013P\352\300~\312g#\037\346\r\221>\365\316\027Y\036\356h< \247\343\t\277\020\374p\200@\317w\001\342X|\0350\3744\f\016a|\300O#\024\002?\f9\317\315u\331S\200 @\001\365E\313eWXowU\266w\2751\355)\016"
+	.ascii	"}\204\216\025\341\013\266\267\020:lY\027\036\032\261b\342\260"
+	.ascii	"\240\0139\034f\245\r\226\3075G\225\016E\255\202\002"
+	.text
+	.section	.gnu.lto_sdcard_isFunctional.25.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\245\n"
+	.string	"&\324JB \251*\035(\376\265\216\314E\335\302\032\300\272P\331\213\177\022\026b\324%\220.\340m0\201\265v\002\323\242<\026W2FnH\022\353N\001\210\356\001\005\036\302\210M@\t,\206\331\265\002i\204H\231R9"
+	.string	"6"
+	.string	"8"
+	.string	"\256\004#\002ls\226\337\242\\<\267*\372\245s\235\2516. @\222|\271\006V\001\232\002y\342\"h0\223\307\256)rT\3656sN+\212\\\335\335m[\330\206\260\277\020\335\367\261?\254\036D(1\351\315.K\272.\373\334\334\226m\265g\365\256ZU}\f\306\314\346@\002\302\234\252\333\2049\353\020\250\330&\331\031OP\220,\276LQ=\034F\255\353\355\305\311\270%\333\035o\t\251\360K\221\0203\347\374\353\235\256\007\240\266\"S\032\214u`=\272|3\00208\251\004\373,\227\215\374\227?Dz\324;_ty\356h< \247\343\t\277\020\374\200\200@\317\267\001\342h|\0350\3744\016\016q|\300\317#\024\002\277L9\317\315m\331S\320`\200\001\365\305\313cgXowS\266w\2751\355\030\016"
+	.ascii	"}\204\216\025\341\013\266\267\020:lY\027\036\032\261b\342\260"
+	.ascii	"\240\0139\034f\245\r\226\3075G\225\016E\255\202\002"
+	.text
+	.section	.gnu.lto_sdcard_isInitialized.26.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"\305\007"
+	.string	"bO65P\215\322\001d\026UMi\004\320\265\342}\253\367\2133\027e\245\347V\263\337p\323\313B\214i\302\035\336\23023\203$\244\373\017\\\2243\206*\302\310&R\246\024\306*Y\264`\331\006\267x\201\300\304\f.`,\n\020\213\033\254P\2541\\\"t\320\264\b\257nO\255\212\236\nt\324c+\235\372\024\301\302\243\034\333\r\357\210\260v\367\300\357$6\213\244\251\376R\003L\347\270I\343\223\374\220\311\177\376\374L\365w\245dTt\362\304\3568\251#\373\324\356\256Ud;\3754\235\231~u\225\220@\220]\320\211\311\216\274\220\222\355\215}\271\300`c\356\035\006\350\243\323\204\307i\267\203zq\356\311\371\3378\245Q\022\371\2048O\200\204\335u~B\024\267\336\366\200m\002\333\037\001\n"
+	.ascii	"2CK\r\\\221\305sL\\\241\202k\250\373\356\232\262\204\310\341"
+	.ascii	"\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_sdcard_getMetadata.27.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"u\b"
+	.string	"\026P;8@\305(\035\340\263U\005k\2475\324\241&\222D.6\307\n\303a\037\224\204\254\325\253\307\035l0e\361*\213\240(\212\216\350\273[!`\341C\224\334\220\f\262\211\224)\005)"
+	.string	","
+	.string	","
+	.string	"+\273\3619\236"
+	.string	"\273\313>\200\335\251\306EO\221\177\220_\035\254\226\3514z\006,\354\256\323tB\335z\333\007\266\021l\237\004\243T\225\375k5e;\3554\235\231>v\271Hy*\273\026-"
+	.string	"\213\342LX\266C\266\305\367\370G\310\242\202\270\201\272\250\002T\224\004\n\031%\035\331~8\311D\266\273\t\376\b\305\226\255@\330]\252@\310E\036A\376\312\021\237\274\351\316\377`wW\f\007\006)[v\f\3262\033\250\3216\333\333 G\242\0037\257\241\243ax\032\334^\006c\217\003\007>\b\217\007>K\334_\253)\247\006$-9K\247:\r\013"
+	.ascii	"2CK\r\\\221\305\257L\\\241\202k\250\373\\\303gG<-\004!\356\212"
+	.ascii	"\251\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`\025\001]\007"
+	.string	"\024\n\021\002"
+	.string	""
+	.string	""
+	.string	"\002\020\177!\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\017\"\201\204\001\021\177#\272\200\202\023\177$\024\177%\005\022&\005\035' \025\177(\026\177)\027\177*\002\030\177+\031\177,\002\032\177-\033\177.\001 \177/\377\037"
+	.string	""
+	.string	"\200\200\200\001\037\1770\036\1771\034\1772\003"
+	.string	"\020\320\360\372\250\001\001\204\001\003"
+	.string	"\017\331\214\342\221\002\001\244\007\003"
+	.string	"\016\344\007\003\002\021d\003\004\200\004\001\"\004\004\321\231\263\346\002\001\265\006\004\007u\004\b\t\n\225\001\004\013\f\r"
+	.ascii	"  \340\002\241\261udIEn-\204\032\007\302\b\342p= ap\030/\033"
+	.ascii	"0\265+\320\371A6\310\245*I0f\217\264\233\276|:\013\277\300\350"
+	.ascii	"A\320\3037\376\307\206\226P\2061t\326\027t\303{\215n\324\004"
+	.ascii	"\365\t"
+	.text
+	.section	.gnu.lto_.refs.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375 a\335\001"
+	.ascii	"\202D\013\020\2407\035\377\377\3773\377\337M\304\256\264\277"
+	.ascii	"S\n\372\034\204c\n\331g\2605]\221\333\003p\254/\221\304zV\363"
+	.ascii	"\226\227\274{K-\002\005\004\002@\300\001\006\204\247@\001"
+	.text
+	.section	.gnu.lto_.decls.b00191cc014740b7,"e",@progbits
+	.string	"(\265/\375`+!\005\223"
+	.string	"\352\351\3303Q@PJ\352\272\277\353\262v\001~\234\207\307\371U\340\f=1\214$\365\353#zJ\377\273\241\370fx\021i\031\315o\210\270O\2245G\001\276iXhe\007U\177"
+	.ascii	"dk\217\030*\365Hd\217\366\213\222\317\242\317P\354\017\021\242"
+	.ascii	"\246\225\277\311\226)\245\321\002\032\003A\003O\005\177\032v"
+	.ascii	"\035\007\301J\340 X\235\373\242)\354\307\257J\247>\221\223i\227"
+	.ascii	">\221\227\371\344MR\312\300\220%%[$\330\033Yn1\326\265?\331\355"
+	.ascii	"w>\306\305V\3109I\3169\200\253\224$\f\353W\317\343\351\317\r"
+	.ascii	"\202m2I\363\030[\306N\306\330\2578U\270\337\006\334\357\204="
+	.ascii	"\273\b6G\372K\330\351\336\303\270\230v:\007\343[:\335\232\263"
+	.ascii	"\322\035\201\033w\004zO|(\303\330\265\377\b\267\217\301\255\004"
+	.ascii	"\316E\260\\<\207.k\325Z\r/:\334\016\007\202m.\237\004\323R\373"
+	.ascii	"\325\345.\0310_0~\215\223\352\324Dw\250\321P\303\355eI\314\252"
+	.ascii	"]\335<~\305\2438\025o\033C\341DJU\n\246\346_H\316\242\236\305"
+	.ascii	"\2538\026\207s7\267\342mN\365+\216C;\024W\353U\232\363\022M\211"
+	.ascii	"\237\rIR\265`\211?\3616\246\f\266\312\2529\347\36612\027\273"
+	.ascii	"\2719\347\200\022\315Y\312\323=\201\005~\305\323\\l\004Q\316"
+	.ascii	"9p|\b\233\226I\251\313Y\252C\202\004\t\0223sxnl\037V\237\342"
+	.ascii	"\363\322\205\216h\n\273\024_sj\021\377\352\325\3103Os\226\332"
+	.ascii	"\\e\r6\264\035\026\307w\330\366(\334m.\202\365\371\f\334~\204"
+	.ascii	"\235\2117q\252\216;\3118n\205\b\351\351\327v\027\270\206\234"
+	.ascii	"\347:l\327\200\333\005\234c\266\326`\223\262\372\265\207\270"
+	.ascii	"U\300:.\202m\020pc\200w\\\004\353F<\314\251\005\370\221\236\300"
+	.ascii	"\202\276I#\271+g)\216M\031\2562c~\355\tp\373\264\001\200f\013"
+	.ascii	"\332\006\267\027\300z\236\027\300\366c\t\\\004{\200\213`W\257"
+	.ascii	"n'\342]\005\\\246\3213\217\345,\365\200#\255q\244\343"
+	.string	"\327\226\272\b\026;\b\266\333ot\273\rMs>\242\236T=\235\370t\373\323\017M\367=v;\024\311D\252\333c\350v'\031\214\335]\323}\243\272\275\206n\207R\002\325\355F9:K\323\331k\375\241\373\332\350\357\2764\\\316K\367]\352\366\265j\267[\271\322\355]\272=\005.\335\236eKw[\001\352\356\025\335=\242\t\350\2762\272]K\267\277u\273[\267\263u{Z\267?\351v'\335\336\244\333\231t\373\222nW\322\355h\335n\326\355e\335\216\244\333\311\272]\254\333\251\335\336\324\355?\335\216\354v\031\272=w\373Q\267\357\350v\260\356\016\323\3359t\273\264\273\343\272\375\203n\327\240\333?t\373W\267_u\367\210n\377\321\355V\335\356\243\333{t{U\267Su\373\r\335\316\243\333\247\272\275\355va\267\007\273[Kw\313uwWwS\320\335R\272\333\227\227\227\227\327}+\350\356\311\320-"
+	.string	"18\370\346\302<\231\335\027\035\2240\201|\271/\256\213\034UFd\374Z$\355\251\341A\221\304\340\276\313K\324\335\231j\312\225\026\034\356\2315\334}\2237wX\246\225\211\371\274\2769\306\025\274\246_\277\f\031\274\262;;v\rk\312\222\272~\273\016wKz$\177}1\277D\343\326$\367\026$L?\230';2/\276\332\017\346\347l\224\222\320)\275\374\227\033\271%xG\234\274\344\360K5NZTE\277~\227/B#6\326\224\367\353s\371\261\233e(\277f`\340f\311\340f\343\342\032\256\203/FR\277>\234\323\321"
+	.ascii	"\t\022e\364k\263N\262\260\365\302\242\fQbq\272\031\"iQcW\376"
+	.ascii	"-\013^\326\330g\005y\326qq0\256j\220 W\257\345b\025\004\311s"
+	.ascii	"Wu\217\025$:wU\367i?\344\317\222#\200H\213\254\036\210\322\003"
+	.ascii	"X\231K\232w\361\352\b\"fVB\355h\271]\232\343\375\362J\2434H\242"
+	.ascii	"\252\252B~\351\2025\261X\030\216/\352"
+	.string	"O{\346\373\310J&\260\236sWui\277\225\225N\023@\332\346\256\352\252\274\224\177\362V>\312C\371\265o{\265\237\362nO\345qx6\247~\3323\351o\362N\276\244\371\234\323y\033SNzQ@\253y\203\205\245\314\210\001\353L\225-\303MA\327\217\215 b\366l\225\351\"\342$\357\354\311\230\340U\225\374\222G{\263O\342\324?\353\376\253\347j\235\256\263G2\346\354\313\276\210\2671I\263R\r\332sn'\00769\337\332,\0247k\0037k\364b>\226\2654\215\303\355\324?\362\324\033'EO\256\246\375\324\356\342\313#nr\360:\222\345\327\227~\230\030./'\277\276\221\227\242A\2250\001\373\257_\262\311\273C\242\374\365\275\276\210\017L\024\231\374E\\\314\215\315\210\350\327\016\363K\354\224$\274\273_\273G\206\273\327\205\273W\205?\367\230p\367d\340\356\021\341^\351p\257Vp\257e\370"
+	.ascii	"\007\301~\3247\007e2y\375\217U\013\367\320\301a\266\230\271\375"
+	.ascii	"\332\353\016\334\256\346\374\245\256\262\237\321\315#\3655\376"
+	.ascii	"\311\333\230V!d\325f\222h\222\213\241\305x$o\233\342\240\013"
+	.ascii	"\255\n\265\343o\370\251\347\361UO\365:\036\372QN}\251\177\366"
+	.ascii	"\273\370\027\322\227z\034.\366"
+	.string	"U}\251\267\341\227nhr\206z\275\324\347x\244\033\24547g\304\332\254\\\231\320\341t\021b\355k\207\373\302\341\276Sp_(\270/\031\356\177\352~\032>\366N+\344\274\364\235\261Qw\374\3727\276\251\337\351\231\336\251\202g\316\312w\302\301\313Y\211\343\216\200;\002\353\220\250\037H\330\265\357\024{\021\236~\033\253\016\272\244\253-\334s\020\254\t\027\301\356\274\022\315R\232\2474Y\346p\214\375\332\367\007\356\013\205\373\032\341~1\370e\274\221S\033\370\243~\030\216\326=\2454K\277\212\fY\330\257\375]p{\003\354\315\313\363\006\330\016@\254\356\352\210D\234q\277\376\226\337\362`\260\024!\213\322q\204\216\356\355>:s&\305Uu\001\207\034\331\217\37117?\001\263\272\253\233a\222\347\336\320\332\251\027\355\336p\231\317\254\224\301\022&\007j\252\\Q\351\236f\324kv\247\330&M\214((\325\334\204\342"
+	.ascii	"\256\003\323EkI\251\314\311DnZ\242\275\244\265\033eII\327\251"
+	.ascii	"C\004\352i\247g\004K\306\331\257dd\017\027B\313iuW\227\231\230"
+	.ascii	"v\356\324\224\n\313\257]\223\024k\247^\261\013\366\241\351AX"
+	.ascii	"\214jn290\023\215\332Bs\207\373\206\335i_jS\257\023\347\234y"
+	.ascii	"\252X\335me\246\346N\323\204\265\263Y\331\3149+\365\244\271I"
+	.ascii	"\344k\357\271\357t\333\370\365\004\272{\355&AC\316J\034\246\300"
+	.ascii	"\340 hJ\247\003r\367\332r^B\223\034@\235K\250\r\346\024\232\223"
+	.ascii	"K\253\244\207f\206&\231\323\234=\344\3452\211\342\231=0\247\331"
+	.ascii	"\231\213\2548=K\241\311\274|f\017y\231\225\0070\227P's\252tz"
+	.ascii	"`N\241\316<\205\346\234\274T6a,s\323C\236B\275\344\351\323\231"
+	.ascii	"\303\234>\235\314)\224\312\221\300\250\312RJ\233\222\252\362"
+	.ascii	"*\314eF:zR6s\332\230\322g\206\313\331\307\\\344f\0029?=\233p"
+	.ascii	"J\033\256\204\250\r\211(\211\362)\300\021Q\3243/\333\230B\236"
+	.ascii	"9\013!\372\311G\025$\245m"
+	.string	"\231\207\267%u<e#\0279\017p\224s\322s[\3169\231s\236i>Isn\312aF\217\216rf\3229\312O\311%.r\37619%N\3464\352\311\263\344\3104\232_H\223\036\315p\320&\236&\301\262Q\316\331\347p\324\271\364\345\245/\236\324j\374\232\202\024*)Wz\277t\340"
+	.ascii	"\266\374\265\250g\026\245\213\002-?+\262\345O\266\220T\261\374"
+	.ascii	"l,\313\317x\270\256\020\177r\223\224\346\244\031\030N\252\246"
+	.ascii	"\272\234\263\327\035r\273.\221[\304\251\227\353\022\265\223 "
+	.ascii	"\341\333\302\221\345\364\255\215\361p\3439\3348\0167\246\202"
+	.ascii	"\033\247\335\253\2325&\020\253#\027\210\231\264\313\217``M\375"
+	.ascii	"\270N\276!3jlY\305\335\200\001K{\341#\214\r\027\331\rg\217\277"
+	.ascii	"\273\331\321\304\310\263*\211\303$\213\2300*\244\031$\036I3\036"
+	.ascii	"S5rM\033|L\335"
+	.string	"0\205\312{\373u\207\rU\216\255\030Z\367yu\\\250\213\343F\335\247\013\2756\334\034N\275Rw\251\357\214K\343\355k\313\2071\341\242I\223\344\306\245z7\346&5\210\316]m\345,\225\253\336\032\327\351Ky\221\274\215)'/\303\344\2427\351*I\340\325\324\362q\017x]\251\247\373\273\250\f\274\244:+\326\031[Q\b\247&\232\033v\\P\267\351\336\370-T\"\256\033Lx\t\311\214&=j\272\302\244L\033\377\274\351b\227$\214\016\274J\3070\r\245\353\\\303\2026\373:i #\222%C+\206\027\266_\033\273@\272G\253\235\017\255\033\327\250\357\321\361F\225*\277^\346\225\321\274\202\362\372\365\306@\032r\003Z\2344OY:\371\025\206\007B`KB\212\036\031:@\266\037\244\350\251I\321\303\366O\004\305\341\2578\254I\3213\302\007)z|AC\0258>a\313v\02094\266Gb\217"
+	.string	"\035\034\032[b\353\203\273\202\013 \270\300D\f3m\002\003\t0\220\200m\023\030\360\360`p\001\017\356\013xn\377D0\024:\376\216C,J\370\b\351\030q\013A\025\270x\034\016\217\305\020h\220BE`\020\212\030\220\270\375\031[\"\f)\332\240q\250xl\2158Hd\353\363\373p\374\2550\2415\336 \211\303\021\206B\307\033\344\2208\004\266\306\037q\350\323\262\370\265\277\343P"
+	.string	"0x"
+	.string	"\002*\n\375\200\200\304!\017@\b\333\031\206@\300!rH\3549\016C \201\204\202\206?\004\214m\213\026C,X\02651\264BbO\013\304\241\237`M\360w\242E\266@BA\305\023\277\004\332\037"
+	.string	"\030\210\004\242h!\bd\001\004\004\f\372R\370\020\207Bb+\224\323\006\rW \215@\244\n\240\261\025*~@\022\207\212'Z\343\020\320\020\330\302G,\016gd@\016\203@!\340\211\037\237\341\217\017\031C+\002\210\226\204\02694\2360D\002\r\005\001\320\376T\330\264H \362\330C\366O\004#~\220\304b\b8\307_\b9\307\026\202E\240\016\202\206\2104(z\202\332b\017E\217\2615\016!\203\300\026CD`\320\215\021\370\023\\\333 \240\b\035\220\277\t("
+	.string	"\002\016\215\255\n\033c\221\005\240\261H\034\206@,\016\217\303\027Z\022B \177\027\360`#\260EaHX4\n\335"
+	.string	"\221m\020\356\037!\021\210<\376\026"
+	.string	"\"\201\302\025\371C\241\342D\007\3411x\205-\020\013 \261\235\001*\026;\370\365\210\305\241\320\003\362\227\242g%\016G\350\037\037\241"
+	.ascii	"\272(\324\032K \213Ec\211\016\355\257\025\026C\360\265\302b\320"
+	.ascii	"z\374\371\f[\020\213'n\200A(\332\343\020\313\266\301\341\013"
+	.ascii	"\255\220"
+	.string	"\365\001\256\260A\376|\200+\212\303\031\037\340\nd\260\005jU\b\r\177\2026\302\026il_ \366 \203-\262E\361\301\330\016[\f\221\304V\330\003\f\022\332 \177&\220\304\341\320L\363\360\2348\240\004\021>\300\301\b\204F`Px,q4\266/\f\215\302\022\304!0\250D\320x,\021\001\001@-\221\b\3749\001\f\022\326\200\271sKP[\344~\355\201s \341\300\372r\265\\\256:\030M\274\260E)\302\322\244\352v\364\343E\321\021_RR\325\263\313\005\253\251\022B\204\205\313}\203\346\035\221\3735.\356j\t\341\225\354\035IIB%\327W\013]M\f7\261\243*\315\213\030y\3209,X\356\333\006PY\321\255\035cd\334,}\337\2523\232=\342\316\330\267/=t\300Q\241r\3354\250\222\025\335\272\201cRGf\245\257\033\036\017e\330\257\267\212Wk\334lP\311\277\336\266\033\344\302\331"
+	.ascii	"\303s\261^\024\335\026\264*\270\241@\271ln$'\351|\201eEw:\224"
+	.ascii	"M\345U\255\365ec\337\302\200E\375z\245x\025\213\314\327T\224"
+	.ascii	"\365\350\312\310\322\257W\r\207K"
+	.string	"\032\2159/\3345Q|k\334\032\267\211L\325\256(\352\342\355\355\227\274y\026q\272\311\311\251\260\304\352n\213\0253f\207C\213\226\207S\013\202\266\250b\331<\n\362\234Afffd$M\222\016\222\n\020\006\203i\036\327\230\007\022\340#IQJ\311\314\314H\222\222$\355o\367\224le\375\006\375h4\260\020\267\243;#\016\204\207\364\235!laQ\333{?\033\257\205\226HM\032\327cD8\376J\232\024G\214z\376\371\255D\311\300\0204\030\b\026\356)\252m\r3z\260\204aW\003\021\217\t\230\201\372\317\345\316`\217\324\214\037\025\252J\207$;\320\206\361\206\302\376\201\252\3005K\372\370\037(#\r\363X\347\250m$\331\355\233\264\003\247{\225\307D@\240\033T\337\267\035_\255\361\036\357\256>hr\t7\255_I\0305\031\344\315\\\320u\374o\034]\230\237\236\"l\232d\241\222\226\354g.\320"
+	.string	"\312\331\274\200\314\344\266\220?\336\372\360k\353!S\026:U!\231\310Pmo\236\367h\320\315fVr\254L\205\217\344\nC\364\322 \364\030\255[>Z,\366\207\177\321\256H\263B\220\241nY\354\t\227~\267\210\335F\337\302PR>\373\357\354\244Q\3253,\324\214\034\031{*\261\307"
+	.ascii	"\327 im-\022\250\211\252\3205\273\377jN\306\223\033\036\030\221"
+	.ascii	"\037\363b\340\324^r%\b\241\372\233Ta\316\006Ll\006a.\026c;l2"
+	.ascii	"'\227)\367.q\255\227\350\245\251\032z=\200K5m<\307\214c!~\224"
+	.ascii	"\304u\263#fM,aS\231\312?\265\313_\326\030\245\334\337\263\270"
+	.ascii	"\355\265\001\373Uo\350U\237\030X\241\205\221\267ATC2/\2155;\315"
+	.ascii	")\213.5.A\314\226\\*>\002\177\277K\312|6\306\037H\222\213\367"
+	.ascii	"\3551\215\361\026\251\bi\276\3000NzV\023\230is#M]r\303*):\372"
+	.ascii	"9RK\022\276\260\266\254\025\313\213\206\234T\372\321\301\300"
+	.ascii	"\264\267\342\210\250(\355\320\233{\256\361\2217\255\333J\277"
+	.ascii	"\204\\a\335\344\n\250]\323\277\232d\216\372%\221=\352\253\013"
+	.ascii	"\024\352w\2405\270\200\337\024C\256\211\370\231N\202\234^z\253"
+	.ascii	"\367\026\016XA\367T\212C\333C\273#\244\347\005p\351!\351\347"
+	.ascii	"q\370\313\0344V(\310\361Lu\231\261\276\317P\\.\255\335\346\225"
+	.ascii	"\027\263\253\373c\002\311u\032pS\tw\177\354b\316Z\032z\310\n"
+	.ascii	"'\246\262_\265\203\241\250\257O\347 \256\002\260\021\020 \345"
+	.ascii	"\016\344uz\366\t\007\021O\212@\325<\027\f\006`\310 w\261\220"
+	.ascii	"7\233\027\n\310\316\312l\202I\200\323\r"
+	.string	"\245\266\254\001\326\217\237\324/\306\f\333\034\237\347ei\021\245Nj\205\263l>\360\217!+\336\317\n\356\003;Z\321\3417H\216.\343\262\034\0324\373\301\366\235\340\f\240\2314\3444\235ho\312\275\374\313\374\251\035\006\200\357|\305\003\207k\203\3274J\275\203=\315+\305\363\371\373\004\325\342\374g\271\022\261\353\026l\235\353\311\234\346\333\314\204K\3077\242\001!x\224\377\\T\331\353,\300_\301\343\204\307\210\bi\272\037\343\3014\355\306B\334"
+	.string	"q\2721\300\311\023\302PPq\363\361\341\363\032,o\314iw\333;\234'#r\331_\004>sO\013U\257\304\237\364z\234\302J\212c\207\303#s;es\371Z\331)\346\035?\0034@\222#|\304\306Wo\345\303-\234{\334\270eC7hu\nP_\033\001\262+\202_\3437\214[FRI'\327\211*_X\357\365\325\272s"
+	.string	"\001\344i\240\357\306L\034\274\354\246=\272\245"
+	.string	"\365J\347\002X\243\035\fyuTwET\272@3\215,+\361\"\233I|RU\243\350\214;"
+	.string	"\024\262\346\366bh,\212\366\337\3603\264\264z\020\177\343\356\205fi\362zq\007\330\007:\254\276\217\027GK\026Qu\363\023\3363\002\302\r[\363^\271\212\022\017\352\2551\204\327\206\262(7&\334\\\213'KA\263\203$\266J\030>\342\\\217\226\236G\357\337i|\\<z\370B\227o\236\353\004\375\331\033\360\215*\201\247\202\321\317\323\271_\033O\002\201\211\001\267\257\222q&\r\270W\0341\td\235\243\274\234\227\325\025A\315\3066\235v\2543\242\302\300\261v\250\342CD\034\237\333;c\304\244\244\375\033\356,\320\3427\375\304a\313\322a\335\377\352\360\362\nB4\266\214\261\t\001nF\364\221\351\013`\221\2371Vk\302V\250SAa\3245j\303r\361\250\353\310\251\271\320"
+	.ascii	"\356\236\336\355\004\234:f6\376\t\310g\306T\013\205\347<\362"
+	.ascii	"7\260\211\024=\266\222\312\233.\021\025\003a\324\036\243SV\260"
+	.ascii	"Hg}\302q\244z\211\340\216M\2365\022g`\266\201\367\003\362XA\364"
+	.ascii	"|\031\222\030\335\006\362{\215\245\367\0249\005\265\023\232C"
+	.ascii	"o7eT$Z\037\374\234u<\007\213 M?g\266}\330\244\271\245K\2119\003"
+	.ascii	"0]}f\232\327m\372t/\347\333\031\272-\"\3302<*\254M\315#\360X"
+	.ascii	"\027+\232\235\036\246\356~\325\235\350\273\271\367w`\356\376"
+	.ascii	"\037\275\3442\007\346\2129\215R\023\367\r\033\302\327\276<\365"
+	.ascii	"\346\317\373F\274\256.W4\330z\253;\350n\363w\2767\326\267\030"
+	.ascii	"^\025]\367\204b\264\002"
+	.text
+	.section	.gnu.lto_.symtab.b00191cc014740b7,"e",@progbits
+	.string	"sdcard"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"sdcard_preInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"sdcard_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"sdcardVTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"sdcard_readBlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"sdcard_beginWriteBlocks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"sdcard_writeBlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"sdcard_poll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"sdcard_isInitialized"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"sdcard_getMetadata"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"sdcardSimVTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"IOConfigGPIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"IOInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"IOGetByTag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"IORead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b00191cc014740b7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1112 @@
+	.file	"sdcard_sim.c"
+	.section	.gnu.lto_.profile.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\013"
+	.text
+	.section	.gnu.lto_.icf.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`n\001\305\n"
+	.string	"\364\016b\002"
+	.string	"\031"
+	.string	"\271\350\271\244\t\f\002"
+	.string	"\002\001\002\002\002\001\003\001\354\301\314\336\005"
+	.string	"\002\321\330\260\315\b\n\002\004\002\005\002\006\003\240\342\234\212\n\004\307\200\351\335\r\002\005\006\276\230\363\302\002"
+	.string	"\007\237\352\330\215\016\024\007\007\002\b"
+	.string	"\002\005\007\002\007\b\365\271\231\351\003$\002\t\002\n\002\013\002\005\013\f\002\f\t\375\210\262\325\003\013\216\300\371\370\005\020\002\r\002\005\002\016\002\005\017\004\002\005\f\333\233\257\210\n\004\r\210\264\347\201\006\004\016\366\350\256\233\001\n\013\002\005\017\371\214\336\375\t2\n\005\r\016\017\020\020\344\377\315\355\001\006\021\232\300\316\360\001\034\022\257\240\267\310\006\023\237\261\301\201\003\004\002\n\002\n\002\021\002\021\024\313\322\375\213\007"
+	.string	"\025\312\217\203\332\r"
+	.string	"\026\357\277\370\231\007"
+	.string	"\027\267\305\270\341\n\002\030\231\253\344\314\001\006\004\002\005\031\234\223\266\351\004"
+	.ascii	". P\202\222\246\314\003ZRf\002\tJ\007\250N\233z\265\250\013f"
+	.ascii	"\230\0038\225\330\232\333\034bo\016\231/\034\366V0\216\\\004"
+	.ascii	"07\331\301_\020H\002\350\305\370\"\206=\202\\\273\357q\244\331"
+	.ascii	"\036\0338n\001#\035\034\020<\301\271\327\220a6\027\356\353\262"
+	.ascii	"\300\216\035sj\302E\312~Or\343\035\013\206\266\264;\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\325\004"
+	.string	"\022G\023\030\200K\322\001&1\0214A\0230#\261\265\255\f\034\265\204\026m\271S\n\256n<\324\230\361T\314\304\245;Th\241G,+%\321]\373\243\207GJkE\246\315\220\024\344\032\025\224\234\204\301\024lf`\002f\215h\343\361\347\302\037\001! p\202\251\263s\202\225A \207\025\311b"
+	.ascii	"\177\013L\266\026cN@\275\221\265\220\223\2470Vh[\364{\337\266"
+	.ascii	"V\366\263!@\240eb\034\3260)'\002\3658\177\270:G$\330>\240\266"
+	.ascii	"I{\217\305\263\204\340\213\213;\004"
+	.text
+	.section	.gnu.lto_.inline.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`>\005\275\026"
+	.string	"\246\240mD"
+	.string	"\217*\035\350\310\361H0\357gs\3565x\0346\032/\305\336NjJ\347\022\232C\364\202\255\235\366\334CWu\341/}\337\353.1\003\307-}\353Z\353.\220\315\2404\260\250\326~\234#l\220\266w\222)Q"
+	.string	"]"
+	.string	"]"
+	.string	"\245\253\200\220\224\250\343\372\364\222]\017\343\307\365MW\177\235\372\312\356n\374\257\317\241\276\217\372\356\256f7\330]\317\346\230c\371ch\356\252\353R\020\nz\313fA\253\001\r\244\037\324s\227\215"
+	.ascii	"\306\325\003\232\347-k\254\252\247x\263\025#\233\2636 \030O\263"
+	.ascii	"W\377\300\340\341`\203\001\334 \202r\302'q\245\325jh\233\263"
+	.ascii	"\031[\365\022\273\013b\335\303\356r3\243aP1\205q\264\235\202"
+	.ascii	"#,\262\327\347\206\311^$8\276\255(h\215\223T\372\205\021+\"\032"
+	.ascii	"R\002\230b\"[\271\343\234\2459\247\2029M\322\321\004e\257\023"
+	.ascii	"\027\271~\f3Nt5\211\212\3562\001M\364\226\357\272\006a\302\214"
+	.ascii	"E\2001\244\243\243\264<=zbl\207\256j\353\210\206\336\322\002"
+	.ascii	"Z\350.\205\326\225\0072GB\312\fEC\005]dp\201Mo\236\214\n\206"
+	.ascii	"\260\310(\214V0\304\353D\205\310\233\273\373\264\243\271\373"
+	.ascii	"\272os\265v\237n\332}\306\b\266m\215n\"vw\263\b\376\205\207J"
+	.ascii	"ls\310\346@\237\224\204\353)1\361\222b\373\013\025\220\221\216"
+	.ascii	"5tu\013\273\033\200\365\226\335\0359#\365\231\341\311\272\206"
+	.ascii	"\b0\024\013\356=\370\210m\270#\001\250\265\373\272ON\313yz\214"
+	.ascii	"C\310\313\264\324\2654\261\210&\231\003\232\264t\264\210^G\207"
+	.ascii	"\n\001\200\210\250\001A\250H\r\tIJ\222\302pP\002Q\250\250\314"
+	.ascii	"\003\022\240\3055\0051\tf$8)0(\277\007\b)\300\3676\237\034\333"
+	.ascii	"\212mLova\344\312\001\267\340\246q\205\300\004U\225\325&\342"
+	.ascii	"\336#\035\335BKon/.\274(\005C\016\024\326c\020\272\235G#\265"
+	.ascii	"\035\206\366\233\342\355\307\236\3747~\205$.(\274\262\367\037"
+	.ascii	"\224\351\353q@\022\315\371\027|\303o\tQ\025\337\326<\037\316"
+	.ascii	"6j\354*\225\235\004\253\225\203\036\224\"\031\343\343OR;\244"
+	.ascii	"\227\252cI\260\305<(\340\211Mw\252w\312?\333JQ\230[?\357\321"
+	.ascii	"?#t\355\366+@\255f\330j\224\237\233\252\240$Yq\212\244e!\n\342"
+	.ascii	"O\241\356\341\020r\357.zR7\374\230\244V\001\314E\243\205#^o,"
+	.ascii	"\243\213\356\2324\314\324Y\265Z\375\202\275\230\273 \325\333"
+	.ascii	"5\205\312G\262\224@\214-2\340\367X\f\356\274in(z\275\345x\363"
+	.ascii	".j\227)FO\302\033c\363z-r`xXi\310G\343\365\003b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`s\005\245\022"
+	.string	"F\331T?0\215\223\0160\27000\260W\r\260^\323\n\276fV3#\"\002\235\312\222\213\223\346i\001Wd\300/oQ\343p7'\240\036c"
+	.string	"\034s\231\231\326\356\211L\035F1\263\271}[\271SJ\0019"
+	.string	"A"
+	.string	"?"
+	.string	"+v\007\337\215p4U\224\201\347\323\016k\316\271%\032\307O\1774\373\243\335\315\243\251F\223\333F=\331\013\240m\255\245E\352I=3\366\237\361\3266{\231\335\213Z\255\345\024\2661%\217\025U2\270\322\347\261\337%\341\232h\277SC\273\333\340J\013\036k\217\210\311\301\2254\217ar\305 \322C;m~\360p\264c\013km>s]\327\345\252t\270\222\037s\255+\222\220\344\355\\\264\006\332\002\026\004\006\224cQ\366D;\352\336\334\357\246n[\250\320\360q\343\313\031l\036\341{\343\272\256\023$\247\023q\203B\204\357\020\276\233\3500\236\357\247\260/ @\225\336\264z\323\036\r\341L\300^D!\024\253J\261D\"\220H\202^*\244\240\234\204\252\021I\025\222"
+	.string	":!A\320\006\037\020\354e\244\031\225\210X&!\025\005M\245\361F\232W\215\204F@\226I\005\301\303\001G\207\007\310\003\005m9o\306O\265y:\0358\006E]\360$\206r\250\221M\242\231\221\222\024$\245a\fp\302be\365\022`\322A\214\3051f\031#J\2430\005\245\372\323\030N\240\202\317%\"a\355\n\223\275\274=\033\377$\360Rb\374\016\266b\022\0329\233\341\241#\216\b4\316?\222\262*\n\367\236t6\227v\373K\227\363\334\263I\212\224\027\244\200\035\033\327&\231K\302\3742\337p\202\025,?\t\002\231\361\004lf\225T\202X\024<a^nps\3423\313\240\275]v\227\246\002\256\325 \204\0364\277\213\031\222G\004"
+	.string	"\002%\362\3612\313E\275\031"
+	.string	"h\017\273\221P\216\320\341\203\232c\224\372\275\nJMT6Fo\rk\232\311;K\003C"
+	.ascii	"\200\345Q\242X\006\b,\263Z\240p$@-\023\225;I\232\345k\b\267]"
+	.ascii	"pB\374\207R\376\n\205\362\347\003tH\326\301\275\177\305\216\252"
+	.ascii	"\344\177?\351\365|\340\232\224\036\023X\200\375T\236\240 \227"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_.pureconst.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375 G\375\001"
+	.string	"r\304\016\027\220+\035\232\232\320\273\273;\326\335y\250,\332\266-\371\377\3074\262\003\027\272\317]\247s6O\314]\256r\223\213\334\016\254q\213K`\207\233p\0063\234}\201S-\335\272\273("
+	.text
+	.section	.gnu.lto_.ipa_modref.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\200\001\275\b"
+	.string	"\322\314$'\240'\031\016\376\255\347\277\362\342U\325\270\337Q\300\204\b>\273m\322\204,\267E\220u\204\210\355\377\177\316]v\333R\246\273\346\030\215\246v\214FK\227-\363,\217\201\202\367\365!\n\023\244\340Y\366\013GM\327\311\224"
+	.string	"\275w\363\032\262)\210+\360\2136\300A\350<\350\\\232"
+	.ascii	"^x\3176[y\353|\312\025E\213\017\307\2231:\330P\225\230\230d:"
+	.ascii	"\235v\205\262$[\243\b\316\031\333a\316\225\256\305\3670_\353"
+	.ascii	"9\372\236\320\376\351\301\223\007\276\f\001: \220\202\031\251"
+	.ascii	"Z\017_\bt\035\034\035\003\220\220\024#A5\202\352B\354\201\020"
+	.ascii	"\302\256\274fa\314\025]\363\373\352Kf\3662\024\336\0133\231\306"
+	.ascii	"8\206\214\021\237\301\262\203dU:s\254\357\320r{\213y\225\237"
+	.ascii	"-<\256\352en\007\022\030$\004w\304a\303='\226\275\367\367\002"
+	.ascii	"\276L\362G\371~\220\256\240\2260Es\300\361u\003<l\027,h\210}"
+	.ascii	"\013\232Um\0206n\244]\2521\006\016\007"
+	.text
+	.section	.gnu.lto_.lto.e207d4150d7ce97b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sdcardSimConfig.27.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375 \242\215\004"
+	.string	"\304\007\\"
+	.string	""
+	.string	""
+	.string	":"
+	.string	"\005\001\006(\001\001\240\215\006\254\002\350\007\220\003\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\330\231\n}\301\001"
+	.string	"?\202\210\2008{y\302\001w\300\001u\277\001s\276\001q\275\001o\274\001m\273\001"
+	.string	"\013sdcard.img"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/_sim.c"
+	.string	"\007"
+	.ascii	"\242S\023U\016\303lx\023\303J\033)\242\f\240\b"
+	.text
+	.section	.gnu.lto_sdcardSim_setConfig.29.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"u\b"
+	.string	"\026\020<8@s\322\001\2306\302;\017o\335X\177\374H\265\373e\276rL\302\376\276)\267\206\264\2513\342\372\320\005\360o\264\325T<5\276\313\226T&D\212\361\336\332\275\311\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\227\356\354\231\177 \373\023\031\214\024\233\335\245\361\343\335a\347\237\344"
+	.string	"\036\312t\310Q\330]C\017\265q\307\333>\260\235`[%\376\352\207\027\247\345\245\200fW\243u\263,\311\022\342\261}h_\344#\335W\245\007\354\246bVv?\004\323\316\245\277\017\314\313\316\005f\254S\274\260\217b!A"
+	.string	"\243\362K\263\344&\024\276\312\025$x\357\322'\315K\206\216\232\f\216\023l\331\237\tF\017\373\327\356\256c\312\001\017\232\303h\303\246\261\217H\343\032\262\n\3022\216r54\241\325\214\2164\220\210b\225\243\037\003o\020\241J#\266\255R\317\267\2776\246\274\340\022\n"
+	.ascii	"2C\363\f\f\217j3\361B3\220\202!\227`\233\325\024p\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_sdcardSim_getConfig.30.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375 \370\335\006"
+	.string	"\"M04`M\323\001"
+	.string	"\023\b\\Fp\003Xh\210\016\331\017U\027\302\216\205\n\347\260\246\331\036b\3618Du\3116_\020\004\001\204T4\020\322\327-G\2156\331;\245\266*\0136\017.I\261\256\031\247\254,`\362\212\b\030\305\022-9cE9K\250\310\250\220e2Nu\3778v\207&\355fN}\216W\006\337\342\320\r\232;=\3645\350\220\312<\007\273b\334\233\260\377\354\343\330.\352\220\020\204\354B\234\230\354\b\004\271\260}\261'?\343\032\027o\003\265b\003\340Q\362\360\321\331\255\321\365\002\320\241\364"
+	.string	"\350\360Q|\273\333\374o\374\301\220\020\241\032\314]d\260\273vT\263\271\337m\027\330\256lG\004\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_sdcardSim_getStats.31.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"-\007"
+	.string	"\322\21525`m\322\001C\203"
+	.string	"'4!hLp\265xo\227K\345\340\002\2053\266\241\336#\305\270\305\320\301QK+\004\301\204\345\274\242A\2728\356D\032\033\355\266wJ\001\246&\216%\025\252\250\241*\te\334@X\261\202\013\226\206\003\251(\341\224\361\305\260\211\320\341\272\"\274\324}H\003\206\356\202>my\220\007\002\272\273\b\177\376\307k\204\237\361g\211N\373\374\363;\322_\006\344&\354\372i\016\303~e\335\205\335\0022\023\203\321n\305\beK\036\211\206m\217}\3619\336\3411VPi\206\261H\241\0209\331\255\320\365\003\322\037\300\005\244?':\366\206\371\367xe\203\216\314\320\347\315\222\260\273n3\224\335\356\266\017lO\266E\001\t"
+	.ascii	"2\003\302p\025a\261\f\001\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_sdcardSim_resetStats.32.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"e\007"
+	.string	"B\01646PO\323\001 [\266\352W\\\3040+\007N\t(\231j\200\234A\311:\331\022b\364\207\215\r!\\\031l\363D5\203H\202\372\275\031\254"
+	.string	"\b\3130\204\330-S\n\256(\317%\031\254\310\251,\te\354H\\\321\202\r\027\307\003\253(!U`\314\241\023!\004\206E\270\341\366O\264\340\321\201\236\2055Jp\257L\b\177\311Q0\201m\027\364i?\234\223\003\333\356&\230\374$\302\017\271\344\211\217~^\362?\323%\233\242B?\255)\034\335\305\323lN\323\367a?\263Od\277\200\016\226\203\226]\215\030\230\355$\025\021\333\3378\263]\316m\373Q\006\306\350ew\341\003yv\315\374\223\\3C\332\025@aw\2553\264q\277\3336\260M\331\036\t\t"
+	.ascii	"3\001\2378\003\217wE6\255vM$\013\001\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_sdcardSim_close.33.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"]\n"
+	.string	"\206\223G;0\221\322\001 d\340Jb\004\217\216\201\377\271\266\332\326\007\257ss\316\210\022\226!\340\267\215l\177pD@~j\247\325\26744\f\226\t\247`\032\364\243\022\334\262\236\220\275wJ\0015"
+	.string	"3"
+	.string	"8"
+	.string	"\0326\334\356~\264\344\253W:W\376c\017\030I\361\365\343\264\026\334\320\240\200HW=\b\021qy\354s\203l\315\t\260\260\273\236#\351qw\267\315`;d\237 \363\343;?\345\275;\355F^Th\254\231\263k\342\244$\366\353\356\256\351\313\376\364=\001Y\r\002\314nGng\313.\346\304\366?^\3319\257\301\3666\220\313\372\330b\210\323\274\305\312\f*V\317<\265'\302\371\321\003\267\224\322E\305I\332p\310P\253\274\323\007\026\034\327\324\261]\361\025\225gw\025\374\331i\027\276\311;c\244\002\036\205N\246\320\201\004\212F\244\360\013\301\222\205\t$}\021&\321\351\033\201\341\02720J\242\004~\024(\024\370}j\373\272\364\345\206Y\311\242-\177f\305\3353^\302/\273-\005\202m\020"
+	.ascii	"3\241;(F6\016\207\340\312\241\207Qks\330\333\250\026@ \024!\332"
+	.ascii	"\r\001\302e\224\227!\304\245\233\252\235)\232\202\002"
+	.text
+	.section	.gnu.lto_sdcardSim_isFatVolume.35.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\373\002-\025"
+	.string	"\206'\211J\320\360(\035\333\245\346\254\033)\237\023E\354\016\341\025\230\276,\207\211\316f\206(\373\3069C\004*^\001\215\237\355\257j\257z\264\031H8\355\2030\374\360\"s\363*\266\245\"\373\036\002"
+	.string	"f\"@\240A\b!do\"\245L\001v"
+	.string	"h"
+	.string	"x"
+	.string	"F>\265\336\f|\374v\376\266 t\347\267\001\350\316\377?@\322\362\325\336rf\274\027\016\257\036\032\265\336\306\266\260\253\r\301\317\243\263k^}\275\222IS+\212\201\2616$ \253\211-\030\343ouhn\330{1\205\341)\302^\270\353\n\340\250\260\001\031\252"
+	.string	"C\204\271\270Y\320P\350Bj\255\273\263,\003sa\366Jj\255\347\030X\315^\334\377=\377I~\226\021\325\225\340WY\236\324W\253\013\301\207\223\b .j;\277*\272s\333\343\021B\372iq\356\277\261\270i\377v\265\326\372\236\335cm\273"
+	.ascii	"&\277\243\371\034\315\027\233\037N>8\371\337\344{\315\247\035"
+	.ascii	"\177\236\337\235\337\347s\363\367C\214\r\225\212j\235\311\331"
+	.ascii	"\250+\346\017\206\377-\277\370\237\371\337\016\353\241em,\373"
+	.ascii	"Q\353,#64m\t2\354)#B\262\321\322\202_{\rvw\343u3\262^\177-\200"
+	.ascii	"\b\006\207\266\327\fj@\257\244\022\017\210\024\223\244\264Sp"
+	.ascii	"G\247\025AR\244\003\275\314d\350\232\366\256.\212\316N\301\031"
+	.ascii	"\271\270\306\177\007\033\002\365\315\236\262\026\033l\\ke\365"
+	.ascii	"W\264k\005\0234\340\216\\\\\343\335\334]\357\313\306\250{\367"
+	.ascii	"\305\222t\233{\366\274~\\~\221\305\221\003rjej\305tR\321\233"
+	.ascii	"FTP\252\006(\245\211\tE5\252\312\223\004T\2112>@\231\250\214"
+	.ascii	"\246R5\216\204<\005\341T\216+\251T9\212\267\272=;\203\245\345"
+	.ascii	"Od;Z\346\277G\207\264\332\345\035\355\321\373Jjq\316\013\233"
+	.ascii	"6\223\204X:`\317\276\027\226\244\034\315\262\0239\216\236$\270"
+	.ascii	"\203v\202\276\243X\222\212\353sBv\322\262\320\235b/\250\025\311"
+	.ascii	"\304Z\234\3530\206\211\031^\323\0027 \240\"\251\262v\314\002"
+	.ascii	"&\024\343MH\221\377q\366 \267b\235K5\363\257\007\034\024\220"
+	.ascii	"\316\016N\020\206\315\231\003\0010\220$\336\002\001\223\204{"
+	.ascii	"\234\307\002\204\342@\277\2043@\264\301b\034(?,+T\022Q\\\340"
+	.ascii	"\267\0064A\310\231\276\024\355\025v\265\345\316\356@\033\225"
+	.ascii	"?Z\030\272\270\205\306\037u\272\021F\2430\304\316\306\321p(\347"
+	.ascii	"< \345rd\030\221\221 \221Qq\306\341\225\001"
+	.text
+	.section	.gnu.lto_sdcardSim_buildMbr.36.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\321\002\255\025"
+	.string	"\206\247\213J\260\324Q:xF\365\206\337\342\311i\361\371\361\235R\350\335v\231P/\b\315o\331\365n\301\233\342<\262\276\372\353\003\2264O\222Qjt\375\347\354\200\256\267\360}\212\336\177\224 \206\316=\241?\221\243\276{\303H#\204\354\235Rp"
+	.string	"o"
+	.string	"{"
+	.string	"\253\201\345\243\023\224\037\277-\372;\n\333\201<bks\037~\n\224\037W\304S\373&~\302v#\013O\331\3455\305\330\375\265\330,?\372w\025\362cy"
+	.ascii	"\344G\333\354 \377\371V\325\203\201\341hjw\315\n\342\266\213"
+	.ascii	"\225\332|\025\314J\267\273]\344\360z\262\353\021Wv\367\301S\237"
+	.ascii	"]\216R\025\314\356\232\352v\033\356\361\266\021\330v`\327\001"
+	.ascii	"\001A\t'>]\211\026\025\367\306A\262\374+\356\302U\356\342\256"
+	.ascii	"\263_o\001\013\360\264\273/,\236T\343\013}t\314\206^g#\233\321"
+	.ascii	"\353L\223\212\204\027\352\315\376\335h\355\331\027ww]y\266\212"
+	.ascii	"\232u\340_r\243_$\251\353HME\352\247\23009\265\004w3\f\221\254"
+	.ascii	"p\2241\342H\277\375\007m\342\253\370\221\355H;\345\016-\350\335"
+	.ascii	"\210\332\344G\025\216\310\224\024\253\372\302;\325\027\024\n"
+	.ascii	"\310_:\023\005_H\300\223.\206\374\310\252%\"z\370t(\251\266\002"
+	.ascii	"U\320\220"
+	.string	"\"\017\264\332\f\036\344A\361\325#\235\020\273\301m\360\2245h]\021I\031\251\325\226y\360D\361\255\200pt(\212\265G\351\356\336j\345y\206|=Q\n\250\034=b\373\301i\314\224\273\271\027\177\206\016\204R(\002\371\361U\005\224*2\302\321\241[\264\f8\263X-V\243\271rV\247\315kvs\2006\253\275`20Y\205\233\231\016\313/\027Y\354\234@Cs\275hN\363\244\301tb4\032\023'\346\222\231/\332i\272\254x\226\003\243\231\265\331\214f\232\374\366\342V\236i=\371I~h\351\207\262~\222\265\372\3044\tq\265\307;\342n\220\201#\375Q@:\364C@\035\310\017\037\303\"$\244\224~\2229\316\343T\361\355.\201\0350\024\237\216\032'\271\225\002: \240\002\221\271\262\003\nLXd:,\215A\207\035\262\303\220\217Sg\b\311\245\274,\221\241Xr\307\235\t,8\25046L\030"
+	.ascii	"\301\204\217\033\264\243\256Q\313\204\354\214\365\224\364e[\267"
+	.ascii	"\032a\233=\fd])da)\210\204P\222(\302C8\t4\276\022\027\247\020"
+	.ascii	"\322+\377\b\f+\362L?\306\255\303.Q\202\304\006v\f\344_\216\315"
+	.ascii	"\333\016\373,\327g\243\322X\332B\rn$\f\013,\267]F\017"
+	.text
+	.section	.gnu.lto_sdcardSim_openImage.37.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`,\b\215."
+	.string	"\332P"
+	.string	"\022F`^R\007\201=\314qn0\006\035\345s^\323Q\345\276\"\343\214)\210a\236\266\275}\356J\376Add\007\222\005\367.\277\367W\206\024|\005\0378\301\022\007\272\301Rr\277L8\f\037\262f\271\333\336[\246\224\002\006\001\375"
+	.string	"\031\001\355[\277{\3537\217\375n\331\357\335\372\315\256\337\253\372\255\256\337\257~\373\203\032]\350\340\206br\246\232\342\311l\253\027/\027s'\363\357vj\257\342e\355\033s+NNf\303U\216e%\006\2571U\031rv0\017sr\261\033.\216\261\354T\361\305\006\346\300\327\036\266\276\272.\304\372\252:\020\353kK\240\340\324\257\217E\251vQR\346\025\272\234\307\206\270\210\277\016\354\371\371z\274v\307\256*\376\267]\351\300\035\221\n\205\212\0320\351\020\253\247\367p\371oKu\313\374@\223*\256\367\035\350\355\210\206Xi9Om\360\246f\307\333\252~\250BTJ\232\336\244\312\307\267hi\322\354\274\255\252\207\352\346\234}N\346\263j\203g\031,\240s\251\n\241\351\202\303\374\325\237\236\256\3428\263.7-N,\307\252\006<e\262"
+	.ascii	"\235Q*\356\212\342e\376RN\250\377\035Q\316\271\277\351\264\362"
+	.ascii	"\016zw\313u7Y\367\016F\270\305;\264\345\024\250\2376\202gq\367"
+	.ascii	"K\345\r{o\356\260\213\003+\373\f\2625\303b\021[K\236ab\356\277"
+	.ascii	"\367\032\333\336e\330\r\035\202\340"
+	.string	"\226H\337\226X\211\247k\324\234\255\030\352/f\252-\214:\364*v3\037\363\301\331\236HB\264\313\017\302\356\021$\336\233\355.\035\214\257!\333\221t\t\023&X_W\314\353\361\364S/j*\306VS)\001\255/\214\241\215d\037\017\310\252+k\203\343\357\364\343\356\"\347\202\fF\2678\032\212\024+V\260\276~\234&\235\237w3\327\322\242\315y\351M\027\355\222\203\260\333\b\351\275\371\330\215\302\312\356&\372Y\2156\347\\\241\375\212cy\321\216\304\327V\212\361\336\364\265=\006\353\253c\257,\271g\230\330\323O\273\307\224\217\241\335\216\247\323\351\2641\221n\027\363\036\342}\007\3657\220\372\375\323~\003h\277}\372;\270~\003\327\357\036\365\373\267\373uZ?|_\304\320\311mx\325\233\f\353f\237\325\002B\324s\b}u\263\347\221\234\2669?)\037\353\2052p\365N\005`c\325o\324\313|.f\330"
+	.string	"\350x\2527K"
+	.string	"\233~\245~\307;\025\214\372:\245\2565\351`\037\f"
+	.ascii	"\357\352,\237Ro\3267}\260\357K\030\251\017C\231\313\265/\271"
+	.ascii	"\206\303\322:\322\273\360C\270@\324\371^\375\270\250\261Ee\177"
+	.ascii	"\263\330\356\227\307+\337,\241\350g'itr\026\316(\247\274\227"
+	.ascii	"\r\342\243\t\257\365r\2757\2038)\216M\372\346Q:\\FZ\fM\363:\244"
+	.ascii	"P\364\316\356\n\355K.\302\003\205\274]s\310\326\016P:\364?\271"
+	.ascii	"\027\372\026i\227JB_{\340z\346\310\371a|\265E\312\207\211;{\356"
+	.ascii	"\340\270\017\273\23327\016\276\207]\315\376\036a\335\314\313"
+	.ascii	"\336$m\263\373\365z\231\2747}\330e\262q\353\341\002m\374\325"
+	.ascii	"\324LYco\260Cx\300V\025\005\317{\362FI\323\306\303EX\244b-\036"
+	.ascii	"\302\277\206\231G\315\273\355\315\200\270\204\224Q\244\341\022"
+	.ascii	"\215FG\013\334`\367\216\t\216\\d\002\367A\0221\311\250(\003A"
+	.ascii	"\223\bQ\244v\317F\323\214%\242{Tr\013tOxL t]&\342\214\242\333"
+	.ascii	"T"
+	.string	"db2Br[x8\261\241\203\207\"\026\007\372\310\201Q5\026\233\220\210G\366\030\003\251(\203\003\361\205\321\222\222\257\221 ,)\035]$\031\215\220\222\216\303\243\221HC\311\2304dR2Z\032\"\031\217C\bn\027g\020\215\303\246b\3218\364u\253\031\023i\326\r\354,\255\307\375e\275\314?\270\3458KS=\217\0035\020n\242'\f\3256\324\234\207hp2\367725\347\234\201\030\332As\317_\177\221\244[\020\252M\273t+sO_?4\371\206\367\305\314W\234v\351L\204\276\006a\251n\020\037\204\207\360\017v\263\357J\302\001\243\311\270v\351S\302d\235\344\034\023+?\310\003\371\301<\265\007C\037\214\224\035k?L\244?\207\373\340\225\313\315=Y\307v'\245\277\225\f\200\236\250a(\006\025S\306DDF$I\222tp\002\021)\263\333\020PF24)Lc\265d\357f\0363\222"
+	.string	"JEv\260_\231\266\205\031\204\177\024\214R\244C\320\342\360\236\351\244z\033\373\025\205Z\357v\246\r\007\2028\205\371\303\034\0068\320\373V\034\f7\3272\036\305\373RO\303K\260\317\272\310\211\311E\326\363\234\277\242X\266kNHh\032\251\027\345\223HF\232mw\251\333T\263z\211\024\3033\036\220\024\3060Ks\301\231\017yB\223\020\357\207~=\277\356\307\334icOn\225\fJ\002\215\f\207xF\025\322\331\315\027\223k#\325g\007vBV~V\225\2134`\033\257Ft8\240\317T\352s,x\214\257~2_<&1\037\305\327'\233`\302\025&W#v\202\025\beA\306u\f\220\323\020)\216\037zw\220\347\023\200\221=\361\326V\314;\262\320\026H\272\b?t\2064\f`m\267\227d%\317"
+	.ascii	"\312\037\357\t\357\250\002U\305w\241\0318\242\023&m\327\323\025"
+	.ascii	"u\037\307\334\235\332\213\035z|?iK&62\311\243B\203\374\326\021"
+	.ascii	"\\N\030\247S.\032^\271\272s\027T^\244\215\265w6w^\336:\017}j"
+	.text
+	.section	.gnu.lto_sdcardSimPreInit.38.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375 \366\255\006"
+	.string	"\342\f/3`m\322\001@\343Id&\237\210\330\327\f$J\373\300\214\357\226\347\177\213\023\316\330\rR"
+	.string	"\217,\255\020\004S\021\201EhW\016\f/\214F\330\177\357\224\002\r\025\303\306\232\242N\027Mu-P\0203QW^0\003QA*7\025F\223\023\274\362b\251\345\220\201\371`Y0+\361vY-\022n\242\215\234\346.Z\003\374\177]\3266\001\013\221\004\217\277\342\304\344!\017$\243\322\326\255\265\20670sDx\340\317F>\376x\320\244\3705\272 \362\243\230 \362+\326\2228b\\\002\205(:J\376\247\003\031s\303j\207\034\320\361p\334$\205\377m\035\317\307unk\320\026\241\355'\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_sdcardSimInit.39.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`>\001\315\r"
+	.string	"FZ]C"
+	.string	"\221(\0358\306b[\206\177\347R\375"
+	.string	"\277&\366b{\212Pm\030\344\360\352Nm\263q\271\366\353\236\344z\260\004\313\337W\177l\001q:\355\335\342\017\340\205\003\376\327\332\247\020\220\374\201>\331\204H\231RG"
+	.string	"G"
+	.string	"K"
+	.string	"\373\025\260\2269\346\357 \360X\346\037\360\230Cv\214\177+\233\251\254\270\360Bcw5Uy\350\227f\310\317H8L'\321/\016\327"
+	.string	"\247\322\025\262\273wyb8\22123\222\335u\232N\032n\354\266\023\330>`\237%-gi{\021\362&\247*\004\213\244\"\373\023\245\246\330\277vw\255([\323\360J\247\246\337\341\261ra f7C\353\306\262\260\026 l_c;?\n\004\004l)\365a\344i\237\304K\204\336R\341\003vQ0\253\r\023`\252\203\324\213R\332\360G\332\f\032\344M\251"
+	.string	"T#\240\332&W\021=VP<\305f\353t\\~\0170\035\376\b\257P\235\026f\220\262e\333\363\0231\263\273#\276\211\277<\360Y\216\371\303\345M\034<v\325\244`\324h\031e\236x\002\342\020D\024\217\303\023O@\334\006\275\211|\242g\302\3516\033\307\323\274\256#!v\034\r\0247\037m\353<M$\304\034J\247\323 p\\\247i\276\375\265\212\262\002\026\254\221\222.My\t\264\027|U\002\242\3126\304\210\2201\312V\356\256H\035\033"
+	.ascii	"3\241\251)F\205\241\310\177G\020,B9/*t\314q\350\272\331\336\272"
+	.ascii	"\266\206\301\210\016\006\001\003A20H!L\263`,\001\327\330V\030"
+	.ascii	"\017\224\bF\004\250(\300]\002\006,\252\334v\025="
+	.text
+	.section	.gnu.lto_sdcardSim_transferBlock.40.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\244\003\025\033"
+	.string	"\2662\264I\240\330M:\220\243y\017\364\232\310g\367T\022\235\356\037\001\362\264\006\034\371D\303\316\022\031\017\013\257\324\213\330\372\276\306\032X\353S,\351\310k\003\217\314\232|\321\301\267\306\245\003\374\t%%\270\334;7\265&m\223-e\222\001\235"
+	.string	"\223"
+	.string	"\252"
+	.ascii	"\314\273\267\272\220\242_\021-\255V)*Jj-\037ln\274Xs\032zq~\206"
+	.ascii	"^\334\335\215 \241h{/s,\315\222\270$e\221\325Z\346\232\352\275"
+	.ascii	"\333\310\032m\234Qq6\367\366\265\240\3576\362a/h\324\204\237"
+	.ascii	"WF\306\254\306H1=\235"
+	.string	"\226`\274\024S\323g3\310`\022\323[\020i\326\324Z\311\240\021\213\223f\211\007\360a/\234f\003/K\302\264\340\371\337\323{6\200\372\202q\013\036M\032+7\306.<+\005\215\230g7\265\326e`\220\351\013\340\273\233dw5\354vQ\265N\330\372\221\237}\325\305\005\n\342\003/\356\203\350\305w\224(0(!W?\036\356\226>\356\251\335\367p8\034n\343\330]\336\231\311\213;\221?\300\213\374\267k}m\277\372\311\345\035'\357l\344\2453^\221\362N\312\313\224\367\003\026TA=Qui\261\262.\r\311T0\221I\217k\375\273E{\341\222\273\253\205b\326\031ee\342\260UZ\221\325Zm..\3168\371Ez/\0214\221YA\261\320\345\207\024\235\b\213\002\270z\204\005\2440^\334r\fmk\316B\3721[\354\356J*\303M\366l\022\b\227\221\230\226\017#\036v\031R\005K\255\006\215"
+	.string	"\317\372\016\324\346\001z\327\303\007>p\005\304"
+	.ascii	"Cj\337\202\035R\352\330SN\376\004\004P\b\334sh\223\021\"\366"
+	.ascii	"U\373\034z\221\202\021/%\247\037\017\221\214Q\325\230\021Q\262"
+	.ascii	"Y\312\367\345\212\226#.\333/N\276'\332\243\267>\020%\006k\313"
+	.ascii	"\021\227=\f\310/\210\310\275\203UE\347^Dc\022\356\nQ^x\t\030"
+	.ascii	"+6\346\317YM:dtO-\331\357\035,*G\\\266\273<\347\"r\220eWw$$\024"
+	.ascii	"\344\250\001C:!\037\237\035\325\r\375\360T\210<\235\217\017\212"
+	.ascii	"\035\272B\327c\002\003\020\317\256\304Nmy \004\375\b\345\364"
+	.ascii	"\360txz\204rB<]\212\037^O\316\304\217NP\216\207'\224\203P\263"
+	.ascii	"\273\023:^nh\267\343\345\310\262\276q\354\205g\340B(\244\375"
+	.ascii	"=\272\223\304\021\033#\364\352+\371\330J\273;\366\336\374\332"
+	.ascii	"h\326Z\253\r\001\343\372\002\016\0378\323\027\376\246E\373\366"
+	.ascii	"\326\270^N*\263\305\345\244\213\264\371\254w\260\266\030`\233"
+	.ascii	"\333\232\366n\006\r|\340\254kv\303\277vSh7\214\256 W\277\372"
+	.ascii	"\375\242bB\250Q,D\224t\306\210\310X$$2\035\200\242\231C;\020"
+	.ascii	"P\314\244i\r\375\324:6\306\252\356xJL\244\007\354\314 \177\302"
+	.ascii	"]d\260l\255oPD\210\316\030\362\013\212H@[\311\377\237\020\305"
+	.ascii	"\374\265A\003\371\210hB_\244\306\232K\311\"\211\225yiP,O\362"
+	.ascii	"\262\013\250O\276s$g\237\320W/4\256\f\343\330\2203+\f\337\032"
+	.ascii	"\300&\320\246\212%\326\252l\332sx3$R\317B\300\272:X\371\251F"
+	.ascii	"Y>\204\202[\221\001\377"
+	.text
+	.section	.gnu.lto_sdcardSimPoll.42.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\334\001%\022"
+	.string	"\346c\177I\320\362&\035B\214\312d\345s\356\261\214v`ad\202\207~0\301\265\003iD\265!\242pj\243\361\204%P\3547d\210\374\245\371\264\3142\003\260\203[B\256\305 v^\fJ^\354\253J\216r\030\352nm\357-wJ\001n"
+	.string	"^"
+	.string	"m"
+	.ascii	"3L9j\325-\370\364\247\372\024y\001\372)?\200~\232A\203\026\327"
+	.ascii	"\256\323\251I\315\300\220)\202\252U\367\355\210\327N\247\334"
+	.ascii	"X\363Y7\227S\025\316\247\374l\216vZ\267\r2\300\323\t\027\336"
+	.ascii	"-&\312\025\214\023\221\r\0267\234\257\f1\nQ\324\272\301H\005"
+	.ascii	"?M(\036\364Hs\013cL\225\324Z\035m\267\016w\352\266_\266\037\330"
+	.ascii	"Q$\tr\234~r/qg\353\302\2708\373\262\326Z\27596\215\006q\2647"
+	.ascii	"\243Y\317\335+GSG\317\031-gt\224\321o\275\207"
+	.string	"\007J\007\004\245ZkvQ\265i.\355<\367\333\367\205>d{f\271\316{\363\004Uk\365>m\026\333\373\274\335\342\007\331\363S\034\250\3459\r*\027\033\325Q?\344\256\226\265\037:\202\022;\034|\214xL\236t\202$wo\236z\264\242\r\253\020o[\355\001\017@M\341\272\034\251'JG.\016\205~\275\275M\322\f\231\2450\232h\021\306\330\305}\204\306\245@\304\004\023}\030\300n\267\373\361\021\372\215K\235b@\204\216\335\bEUku\340\253x\221\314'\361iP%\336\366\351\253\320\317\357\203\036\266@\002\223\305V\276\024P&\003]!\031\300\224\265\213D\026\243\231\274f'\256\027\355\243\315`\030b\263\327\227\022;\221}\256\031\355#\0211x\0016\373V@p\366y\272\227\31397\205\343\306\n%\351\327\350\203\316\022\361!\267\336\322\245\261M\327%/\033R\002\321\216 !\3366wq\204^"
+	.string	"\315\305y\002\005\0210\344CcG\r\031\254\005Y\003<d\002\032"
+	.string	"\202\324`\031\002\302\260\232m '\273Bd-\021\354q\222\3410\233\031\217\031\007\004\273\300 (\256\304d\2611\022\210\272\330h\373g8\236\326\240\243\252,\330.s"
+	.ascii	"B\007w$i{\210\200BQ\253\366"
+	.text
+	.section	.gnu.lto_sdcardSimReadBlock.43.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\355\0015\021"
+	.string	"\026\241uI\320\322(\035\250\b\241\200\264o9\245\231\335O\204\337\336\200\002\001\362\006%\2001\"\213\262>jF\301\316~\360\337\247\332Y\331\026<\t\332J\206\327v\250\322\237a\251\f\322>\374\004\326\362\241\023\321\212o\215\020\262\267\334)\005a"
+	.string	"\\"
+	.string	"b"
+	.string	"\327iyT+\007\241[\255#\001\177\336i\311I\270\323y"
+	.string	"\334\251m\0270\340\362\353cm\326\315d\300p\202\250\326\361\333\017\177\235\316\225/\237D\2039\365h>7\007\220\f\032?4\232\357$\231\205\220\205\320bs\300\320\n\035\267]\316\320`Rv(\265VK\031M\303\315\335v\003\333\016ly\022\366g\255\265zm\354\373\374 \357\371K\337\371I\327\371G\226\356,=9\351\345\244%\225~\310I\334\210n<\330Q\353\354G\217\032\203\262\020a\373\266]v\311\366iM\221\032\353\300\203\301\354\241\020@\244\306x\204\020\354x\023\256\357X\370H\2556>N\274S\217\236\224\366q\236\343\n\227\315\355\026\346\265\242\241\333\334}\341\242\305e8\376\026'ww\316\270P\003s\370[K@\315\250\007A \251\235\252\220\333\311"
+	.string	"\225\2200df#\366*\356k\342\251\021\223E\266SO\241\362j\255\007|\024\377a\361oN\275r\221\227\235\372.\334\351\367\266K\0207859:1\362\207=\302\344z\b\340\013\230"
+	.ascii	"D\025\202\246\225\0250\364D\224\212\212\004\023W\001ujY\240\n"
+	.ascii	"W+&\222C\023\226\024+\345$\202\341\211\365\261D\324\204\224x"
+	.ascii	"\372ZR \313\027\212\254\317\244\304\253\b(\361{Y\255\304\257"
+	.ascii	"4\306|m\3549\347\336v\00566\330\202\326\177q\335\316\330\356"
+	.ascii	"\326(1\013\243#\022dKK\332\321\332)\240\f\" \300\"\021<\017\t"
+	.ascii	"KQn\300\203y<B{%ZK\n\304\303\226mH\307=(C\007\376\215-\203!\206"
+	.ascii	"1\320\200)I\230BE[\203\206\330\270\334qN&2\"\334\0137\f\f\201"
+	.ascii	"\3417S\337[X\235s\334'=Y\321%\240"
+	.text
+	.section	.gnu.lto_sdcardSimBeginWriteBlocks.44.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`*\002\215\021"
+	.string	"\306\237qH\360\262&\035\260\0222\266\244k\264\200\353@"
+	.string	"\364Z\344\007T\201C\310^_\r\222\005kA3\\\352\007\351\377\177\3025\340\265\321#\030]d\266*$\213\223u\0340\r\206\"\305\323\017KR\327\306kn\215\354-eJ\001^"
+	.string	"T"
+	.string	"^"
+	.ascii	")^\374\305\020\007$\360\312\311\320\023d\316\220;}d\273\214/"
+	.ascii	"\260]\356\210\177\037m2\256~>\314G\r\200~\266\323\036\001\210"
+	.ascii	"\215 \027\370\341\322\303\243\b8\023OsN\023H\243\033\r\310`>"
+	.ascii	"\"`MTP\033\222\235v}\2012\252\243\2229\247\325\005r\270I\267"
+	.ascii	"\355b\033\202\255'\001-z\327\245\337\262]~O{\202\030\020\321"
+	.ascii	",F\213\354\020F"
+	.string	"7f?\316\275\261\037\376\245\317~\222\325\322\352\030\325\033\325\272\352\0078\320!\307\204\025sn(\0322q\310\0309\266_l\223\035\242p\240\372Y+\016\2303!^0\346\f\027\230#]\332\366w\036 d\260\232\216mc\326\370\177\3776\271/G\2711\275\b\031\254\026\367\306\273S\302\007\317\216\335\237\027>w\375\370[\233\356n\024\252\261\221q\205\273h!\300\361\352-PFp.Y\350\216hn\350hmH\006\333w\333\367\204\207\307\214\n\261\235\362\236\2164\347d\340\363\\\305\212O\342\322\254,*-\335\003\027UJE\002\n\252\263pR2\212$e\305\242\220\362LP)\026\307\362T\030V^\212SY\231\244p(\217\305\221\234\334]Py\034K\327y\234)\234\217so\274\242c\263\351\277\355\264_C\217\0233)7\356\313v\\\227\304\254\314\250\2646\3525h\b\005\021\221\326V}FK\200\f"
+	.string	"&\202t\002. \260\"\2312\336h\007:[\350\021\312\360\200\262\027\346f\3067=\232v\013\030\334C\242\005\261\300E\276M\340/\213\030\3141\021\r?m\273\204\370|\260cq7\360_d\031l1\214\201\017\230R\302+L\333\n\030\315F\333\360\2320`\331P\232;\330F"
+	.ascii	"\bh|\363iY\016\372\034\325\004\302\226\356\322\321k\r\024"
+	.text
+	.section	.gnu.lto_sdcardSimWriteBlock.45.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`L\0025\022"
+	.string	"V\241tG\360\262&\035P\021P\304\035\037\263h\221\006\261\002x\320\231/\201\313[|\353Hy\305\r[\375\240jk\335\264v\247\b=C\277\255\267F0\252\313\303\020\337v\025Z\235\353\363\364(\333@\002\264,#d\223-eJ\001^"
+	.string	"_"
+	.string	"`"
+	.ascii	"s\206\007\314m\317l\37367\361\342U\fc\240\310k\305\005\024@s"
+	.ascii	"\206"
+	.string	"\034\311G\344\263\370\001\362\331z\370\352\232\314\342\352\312\017\2010\3276\232K\315$\222\030\201\203\365\323\003\322<\323\360\330\022\2012\272\001\300\231H2\347<\317\365\005\262T5\2239\247\325\005f\270\267\333v\261\355\300V\2271\372\303\016Y\2720\373qn\215\375\235\037\344:\377\3508\277\3507\177\310\352\315jMSK\251^\251\326L}\001w\301\001H\307\203\034sb\370\341c\316\310^\210\260\375b\213\354\035U\f\231-X\254A\324\241\020\244`\303\237x9\216\005\002!\263\225\363!A\270Y\3657*\003\230\263C\220O\377\352+\271\355\3131[\230>n\215\327&\004\215\034\033\2732b\300\270k\307\257\222\272\273\261\306\314\006\226\273\373\250\n\304\354\275\205i$\366\214\205\256&\363\303C\347\2340\373\223\374\222rn\264\264\207\355\bWq\332\346\234\b\374\024\357I\361A<\363\nJ\357z\346\243\344\263\357yn"
+	.ascii	"\366S\342&]K\267`\224\342u$\025\225\316\333>\023\n\212\013IV"
+	.ascii	"0\225X\030\244x(\025R\310^\311\312)uR\372:\257\224\342R\237i"
+	.ascii	"\302\351+q,\247n\205\363\276\024WBb\224\004\323\307\265\240P"
+	.ascii	"\037'\nc\036\245\024\311\266\325\366e[[\233\304,K\023Q\220\035"
+	.ascii	"\255hCkC8\321\273\344j\013\343)\027f\215\0013 \300\242\021\272"
+	.ascii	";\tIQ!\340\f\253K\270L\033\300P+\316\255\265\340#\233\305_+i"
+	.ascii	"W\256M\355\212\"\345#\360\300\032\342q\017\313\260\201\377\302"
+	.ascii	"\313`\213a\b$`\n\022\2420a+\340\274\215\356\341\302\"qR\026\340"
+	.ascii	"\331\304G\206{\341\313<\002\212K\370\033\326\204|\267\360m\214"
+	.ascii	"\337\031O\342Q\037\220\303\230W\024W\233\242\324\364&\3642"
+	.text
+	.section	.gnu.lto_sdcardSimIsFunctional.46.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"]\007"
+	.string	"R\31635`m\322\001\300=o\264\032K\f\243\230>\333\336GJ\200B\315\210}\001\335\032:\226\245\343\026C\007_\265\264B\020LX\025zE\243\331\030\254\350\326\b\2212\245\276\254M\026\0170\230\271\260\370\"\3248d\020{\tYf\363.\030\237\205\261\246\240\201\217A\323\340\273t{j\225\244\212\371(\310~\244\\UU$\364\001\362\3029\242ew\013\374\215\227\032\374\213W~\340\344\271W>\207\362\352\n@R\372\344\311\356<\251\024\366\251U\222\355\264f\372T\300D\bB\311\256\350t\262 \225G\206\355\216}\361"
+	.string	"A\307\333;\013Q%\002\"\324a\332\355\236V|{n\3765N\231FL\270\221\347Y1\330]'7\222\270\365\266\005l[\2661\002\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_sdcardSimIsInitialized.47.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"U\007"
+	.string	"R\21635`m\322\001\300mk$\303e\004\202\2104+\373\037)a\007Y\023}\001\335\032:\226\245\343\026C\007G-\255\020\004\023V\205^\321h6\006\213\337\b!R\246\024\276,L\026\0210h\271\260\370\"\2748d\020{\t\231\005\363.\030\237U\261\246p\201\217A\323\340\243t\373i5\244Z\341h\307~\254\256\252J\342\371\350x\341\034\021`w\r\374\215\213\032|\213S~\310\344\271S~\246:u\r\030\2118Y\262\273M\352\204\375i5d;\255\231\376$\2201\222\201\354~J%+By`\330\326\330\024\023\024h\274\275\253\370L $<\035\244\335\356)\305\267\347\346_\343\023i\024\302\2016\317\311\301\356:9P\304\255\267=`\333\262}\021\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_sdcardSimGetMetadata.48.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"-\007"
+	.string	"\322\21525`m\322\001@\003\007\2340\001Iu\202\253\305{\333o\202\370\23618c\033\352=R\214[\f\035d\332h\205 \230\260\234W4\032\354\372\333\357k\262\311\336)\005\256(M\234\f\226\304T\326\204Sf$\242\264`C\304h`%'\244.\276\0342\022B\\\227\204\226\272'y\020\310v=\247\366\374H\204A\266\273\n\177\276\310\353\204\317\361g\212M;\375\3637\323\337\305\343*\354\332in\303\276\264N\303n\b\"\2248\332\305\030\255\354\311\023u\330\346\330\026\377\343 \034c\0075\003\r\\dX\224\250\354V\350\372\202\351/\340\004\323\237\013\035{\303\374\207\\\362H1\241\237\316\033\300\302\356\272\321\017\350v\267\235`\233\262\035\n\t"
+	.ascii	"2\003\302p\025a\261\f\001\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_sdcardSimVTable.49.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375 \323%\005"
+	.string	"\324\b\231"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\346V\177}\230\346\006{y\330\345\006{w\230\345\006{u\330\344\006sq\230\344\006om\330\337\006ki\230\337\006ge\330\336\006ca"
+	.string	"?\202\210\200\310\001_]\303\001[\302\001Y\301\001W\300\001U\277\001S\276\001Q\275\001O\274\001M\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/sdcard_sim.c"
+	.string	"\t"
+	.ascii	"\200h@4 \032\020\r\210\006D\303$\232L\242\006P\004"
+	.text
+	.section	.gnu.lto_sdcardSimPoll.part.0.63.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`6\004-\033"
+	.string	"\006q\253H\300VQ:4\314\004\322G\327\200\021p\001\332I \246\223a\033\327\326 \336elf\225tP\337\031\003\033\024\027\246\366\002}Z\205\246\337\202\013\334\311+$\213\0010\004\004\265\274\324\356l\375\037\320\372\277\344\223\275\345N)\224"
+	.string	"\221"
+	.string	"\227"
+	.string	"cU1a\b\224\243`\003\361\324\243\370\231\260\307\037\315:\265\216\377z\276\243\204\3503$\006A\341dK\255#\315\251_\342\251\353\005\302\323\371\231\360\3649\314\340\001\317\220m3x\320\343\334G_\212\024\n\247\0350X\353\370:\335\031\317=\025\322\271R\314\371>O\245lf\320II\020\217\305\303\025\247s\246\205\220\247"
+	.string	"\274\023s\301\223\r\027&\344\224A<\242o"
+	.string	"\036\320t\325Z\277t)\304\323II\340b\312\246\326\352\377\024\335\252\333\006\262\335\301\236\024\002\266\245[\226f\211\322\253)\255ZI\213+\351\224J:\234\322\324\322\363I\367ZZ\212\322\037@#$"
+	.string	"F\255)\242\306\324\030\264\251\306\225\376\244\037x\"\036\341\322\215>^\004\246\361(Xu\225\346\346\021s\364\361H89Q\364:\235\366}!g\262Y\276=\210\227\b*Xke\335|\237\007\217\377\343J_2k\334QB\003\323\226\243`\022\317\201\354\330\245\033+\017\310N\223\022\026\t\342)\220\347H8i`\254*\206z\334G\317\221p\263\026\005>.T\255P\2060\\\017>0\234J\006\005S`\005\244\204\253\272\021e\364\307B(1\001\276Z+\204'G\300\340\3602\267\347\ro\202{\023&\2603-\241\253\372\355e\255\325g\267g;\027\316E\020\245\213\224+:)\3066\207;\345\034Tq\207+\201%\360\235&\231\013\200\350\213\321ow'\222]\031\371X\370\225\213"
+	.ascii	"\270;\002$\243l\337\334HL\254\265B\360\213\274I\346\32385\210"
+	.ascii	"\231|\320\251?\013O\277P3h"
+	.string	"\300\320\361\373\221Qr{^\361\263\256\214\016Q#\243\315t^95\032\255\026;\220S\233\351\334\330d\"j*\233\354\303\207\035\017!\256\226\263\216\325\320f7\030\216\355&\206s{\335l2\0223\033\316+gvC{\305l\267W\215\3135\0212\333K\247V\263\275X\237ue\370K'\020\262\266\265B\266[k\233\237\005Jm/\312W\313\332\245\262k\352\302e\265\024\t\320\350\027\036\220\251U\255\270\273\016\327\256\335\372\330\256p\250\013--\260#U\311\"Z8\226\013\255+\260{\261\222\332%\212\n\363d\243E\021\272=\313\245\273d^\f\221\001R\250a0\304\034cHf$\020\tF\322&\035p\242!;\333\006\020PVC\323B\033C\226\212\222\354(F\242\317\240\253\337\026\027@\017 \211d\345\241\b;C\362\362\005A[Av\332\343k\235\020\3015\303c\244\2249:\211\3740>\316\375\013\247"
+	.string	"\2160\247M1Zw\215\331\262,]\236\373E\022\013`e\265\022q\341\273cGU.\206\324\036j\345h\"\350\360s\320y\276\001qK\267\f\23713!^A\313-}%\021\263\372+\316\202\337\304\217\t\266\302p\201\2769m\233\363_\365\330\t\302\233\302[\250\360\002"
+	.ascii	"\224\2170\270\370n\221-F\266B\032"
+	.text
+	.section	.gnu.lto_sdcardSim_transferBlock.part.0.64.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`~\002\215\023"
+	.string	"\206\346\201G\340\320(\035\372;\201\362\n\313(,E\314\f\361\231>\217\005\005C\373\300S\321 \346\315c\256\235\343\006\032\253\257me/\333\343[f\355\223d\214Kp\234\324\f\371<\271\035\f\313j\325\276\241\211F\310\336[\356\224\002k"
+	.string	"p"
+	.string	"c"
+	.ascii	"\n\355\343<'v\022\027\bt\354\354V;\261\373!\270t\311\273\364"
+	.ascii	"\367\001\363\322\273\307\274\264?\302 !\260\027\333\006\t\211"
+	.ascii	"Y\366\317\203KG\203A\323\301\355~\245K\355p\331eT8e>\254\331"
+	.ascii	"T.[\370\b\305n$"
+	.string	"FO\256f\213\271r\330f\221\264\273\017:l\261\261@(\340\263\033\331]{\031\356\356\266Il3\260!O\036t\374\367k\007\r\177\373\317a\340C\200\231]\227\\\215\345 \207B\034\350\377\271}\0230\037\350A\036\355\300\376\003\273\317\213$\332\245\3310\241}\236\367\304\356\363\212\337\332.\"'\306\rN\201wI\212\367\2301\177\307#\235\224\2702\337\3024\350\371np\273{\340\322\t<G\370\333\272D\370\022\262\177\0054\340nX\210(\374\007\373\026\346\305\001Q\245v:\264!\026\230s\007\204\372\233f\334\233\246\252}J\301\327\242\222h\252b\033\302\207&x\273+\342\2378\212\225\017\342\322&,\370\332\245\317\232\227P\345LHF\316\n\314Y\017wWE\325\306\266l^\037t(SC\343\366b\006g@\265\261\316\307\335]k\215mh\221\241=\017\272\353\240\247\241e\026R\250\223\005&\247V\204\022"
+	.string	"(\251\227J\325\232)\224\225\253\202t\245T\252\224\222\351\323\007k\365z\200r\231N\250W\351\345JQX\271P\245\223\225\211U:\271^\245\017\222[\022R\256\022J\253\345*\215l\303\307\325\032+N\314L\364F.0\334P\251\"m\261-R\217\254(\213Uv\352\351\264\341\001\247^\305\237\342\016H\340k\035\213\025S\345,E\214<\2534\276\212\007. \260\"1\322:\354R\034\0032\264\203\303M\026\024Dl\275\257\215\255\310\217\0237\336\031\205,H\336\0341l\230\007A\205!_G\347\301j\303=\301\341\001d\032\232\211\251Om\002}\225Y"
+	.ascii	"1\324tB\357D\270]|\035\\\177\361y\263F\357\233.\241\315\202\""
+	.ascii	"2\353\226$\f\330\270H\270$bu\340\265\006\017"
+	.text
+	.section	.gnu.lto_sdcardSimWriteBlock.part.0.66.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`G\nu1"
+	.string	"\332RX\022D`\246\326\030\245\213\002\317\214\277\374\267\301H8\021\020k>\237\261`\315\341\001p\203\211\361wk\2304\031{,\212\320F3\231\t;\217\"\177\347\330\245\345\257\f\315\261D\361z\016\r\261I\243lR\312\224R\n\016\001\374"
+	.ascii	"\026\001b\270u\321n\356\204\25772\274a\203\3516\346\226\247\372"
+	.ascii	"\013\253ayK\262\367}\333)\347\356R\305\315\306\355\232\027\227"
+	.ascii	"\203G/.k\265\305\242\251\225\251\363\276\316\005\255r\bv\006"
+	.ascii	"s\253\226\226\346\246A\357\221\331\334\240zoA\243R\321\250\364"
+	.ascii	"XH\275\317\252\234/W\212\245\2373:K\f\244\240\367\370\374\222"
+	.ascii	"\340d\371\275\235}\305M\235\257r\213\337\373\212\313\276\367"
+	.ascii	"-\242\207\355}\235\rZe!\333*s\227Um13\267\225&\233\301\305\324"
+	.ascii	"\331T\016iq\311:\303{_\247\260\325"
+	.string	"`\033\255\255\246M\264\266\372H\272\330\355\317\307\366V5}\367)r[u\333\253\220R\241\333B\006-\302\025\244\177KE\270\200\264\357\207\263@\272\227\265\364d\253\313WO*{\264\252\212\331\031\347\322\224=:M\025,\341v\030\2411\022\247U\036\375\201\224Xi\360}\337fk\327R\032\335\207\332\247W\341}_\356+\257\346\237ff5fnb\376\001\005\300h4\032U\277\237\304E\323\237s\215\232m:Y\327\355\256\376\351\267W\334\035ri\3441X9\232\244\317\374\367w<O7&ZM\032\377\346\222\304\337\367\265\372g2\263\273\3667=\337\034\035\0173\017\373\214\313\276\357\373\200;\256\315\020\271\227\264\312O(\274\223(\326V\373\277\230\330-\313\314\256<\352\317\344\367\351\364\375#\314\255\363\201\237\263\201\237\363\322\3179\310:+\025`\235\223Z\255\233@o\351\036\300:\013`\235\003\370\234\221|\316"
+	.ascii	"\372\254\373\210u6b\235\213\210\206Xg!\3269\b\310:\003\375\260"
+	.ascii	"\316>-\353\374\353\267f\037\353\314\366V\326Ye\235\323vv?\353"
+	.ascii	"\354\254sGh\220\004.\3377G4\357\035\242\202\t\353\265.\343\006"
+	.ascii	"\217\316\246\262\267\340\344\310\360\336\243s\001\273\275UD#"
+	.ascii	"\215\231\244N\277\36537\367\230~\343&#\246\312E\177\341\021a"
+	.ascii	"d.\270\003\f\302\220\236\271X\346\312\025Jt\305+\276e\001\230"
+	.ascii	"#\301\223MZ\035\200G\372\206{\262A\003R\300\031\364\321\3773"
+	.ascii	"c\310\340\235\004\360\r|@\345\220o\3653z\033Z\3115]\364F\237"
+	.ascii	"\262\321\3404\\\002\314\301\263\230\214\232\255\"\213\276\207"
+	.ascii	"\225\0075\033z\241'z\217C.\231;\370\321\215B\357s\313\033k\337"
+	.ascii	"39\350\335\354\351\206}\340\007}\263\265\320\355\3569\247\005"
+	.ascii	"\214\361\335\312\0056\375\355=\031\003\355\272\362(\003\375\317"
+	.ascii	"\003\325\237\007z\b_w\310<\237o\377G\250}\237\207\360E\007\271"
+	.ascii	"\347\367\276o\237BV\217\237f\267\325\367\277\207\3605\207\314"
+	.ascii	"3\276\261\207\316\343&\321\341\361}\223i_\362X\262,c{\317\344"
+	.ascii	".\223\242\366\276\301\312p\244\353\017\275\0263\263\037\032\317"
+	.ascii	"e\357\330\357a\335AW\020}\307\256\367\252\330\035\250\231\\\327"
+	.ascii	"\331i\231w\250\330]}\023O\235/\35239D\323q\0214\345\364\034\021"
+	.ascii	"$J\224X[]"
+	.string	"_\025\263\0333S\037\316\2332z\n\204Kd\361\364b\b\345\033\276\030^\360QA\0346AA\r\211\254\324\323\211\023TM\253\214''\026\032T\020\243\240\232~Lt\260\"\305\224\t'\251!\321iJ8%\365\004#\205\224\223\220E\212\341\n!QjJ\350 \310Q-\236\244\204/\242\242\244\204-3{\377\221\f7jd\255\375\270\213\353\201\003\317\025\256\336\330\262\365\0068xYk>\242\347\2647\364\005^\213\331\300\223Ya\002VY\372\340\033\370F.\215K\237\236e\355\021\342T\212D\216\232\034|\n\023PJ\360\325,k\306\314\224\214x\024(r\222u\237\364J\277v\251E\223\230\356\244\210\004\330l\222\272%\353\0268w[QI\021\314;\231\364\b\270\364\310\031\337\212\t\2049\230\273DI\0303c\003\234x\022\252&\222\035q\320\207\342L\367\210\2216J\334\330\321\2139\221\030JtmC,"
+	.ascii	"\205\370\354\340\240^\305\261\265\333\2708\305\275\212c@\017"
+	.ascii	"\322\326\016\306\224[\226y\t\370\037\356Q\027\023\320G\200\027"
+	.ascii	"\360\251[\321\212\363p\217v0\351\b\360\001\200\323\250A<\305"
+	.ascii	"\024cfh&\020\221$I\322\001\320\"\021\262\342\006\0210\251c\314"
+	.ascii	"\b\315\230\242\2441\ri\205\223\240\215Dy\330\224\013\330\351"
+	.ascii	"O\221\312\037\210|\334"
+	.string	"\341f\374\243\355\311\2213\333\210g-K\370\332^\202\275\037,\205l\fK\335<\ft!\035\252&\233:\2457\361\300\035\346g\200\207n8?\303\f8}H\304\352\325\267\\\025/\332\277\272\260\t\300W\277\324\201\030\207\336\220A\\\t\\\255\337\023]\002\374\211A\266=\263\331\237\365dh\025\033\302\024s\203\235\260\302E\013\006\363\344\231\324\311\331\252\020\220\344\246\013\0270*\241\212\222M>\366\315D<Be\036\330\216\203_K#q\223\262d\353\022Y\002\373\f\332\2634\323\212&\272\276\336\0315\344\036k,~\375EQ\367X\235\307V\333\003\205RR\023M\324\220\001\240\244\200\373\337\206#\032\210\td\027\006k+h\201_\241\217\350\312V\260\341\252#\330\036Ce\316\3538\037\3555=\363\023\225\f-\367\336\251\177\324\244\214\306\355s\n\017J(\344\365lR\004-\200\331\223\242\300\036+MOH\236\372"
+	.ascii	"\036\007\265\024\036\375P\357Gf\033^\364\006\372\240\252!\326"
+	.ascii	"\357p\353q\363\261V\006H0{\224\252M\377\314\220\365\362\230\263"
+	.ascii	"\374i\036\3534\223@\316\202\212\333\303\230\226\326\263\3020"
+	.ascii	"\357v\3166\027{\353AyE\313i-\025+\002K\220\363v;6\226:\236[\013"
+	.ascii	"\247\342\211-1\204\246\001"
+	.text
+	.section	.gnu.lto_sdcardSimReadBlock.part.0.67.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\002\005\345\033"
+	.string	"\2661\257G\220\234M:\"\001(jvw\366\351w\260*\322\236\314\334\2139Z5\313\341\333$\004\200\234\001&\323q\033{<\332\024t\300\027\365l\323M\3249E\356\352\r\276_\305\262\365_y\362N\273\237\024\rB\310&r\247\024\226"
+	.string	"\211"
+	.string	"\246"
+	.string	"D\336|\240\363O\260\212(V\221\001"
+	.ascii	"u\251\212\013\2038\177ut+#\003\301\272Ct\362*\244[\031=@\255"
+	.ascii	"Nb\025\312S\007\313\235\017\036\235J'\006k\223\016\357\264/\365"
+	.ascii	")\244S\351\234S\353\020.a\255A\b\247\246\225\247\tN`<\025?`<"
+	.ascii	"\265\317\304\022&\034\351\260m\t\023\220\274{\360\227\203\274"
+	.ascii	"\201\203\306U\233Z\203\264\323-\362\335w\212;\177\366\232\222"
+	.ascii	"\276\337\372\002%V\210\200\311j\342\361)\340\"y\241\326\352\262"
+	.ascii	"\307Mo\333\202m\0236\275\005\013\301\007\225\027\323&\331\327"
+	.ascii	"\215v\213S\321\315~\265V\n\276\224O\001\362\241N\03544\337;\365"
+	.ascii	"\207\306\323o}B\201\002\3635\001\343\315\261\271O^\361b]'\333"
+	.ascii	"\323\263r\272\247\234\346)\247w\310i\0319\255s\255?\347O\376"
+	.ascii	"\222\234&\311\351\221\234\246\236\026=\275\277\372\347\203\377"
+	.ascii	"\0178\210\232\371j\3151\006\247\n\241R\214\330\276\037\345\302"
+	.ascii	"\334\241\230F\375|Mj\255\271\373[G\266\314F\262eZYY:\021@]\n"
+	.ascii	"=\235e\260C\314Ki\223\234\203\341otn\302\250h\001\226\031\316"
+	.ascii	"\246h\215\232\036]a\337\3604\272!\032Y\222.\340^\350\016?c\204"
+	.ascii	" \214\320*n\246L\016X\226\260y\020\343\205\366\3601 \304\b?\243"
+	.ascii	"\236\274|RAx!\016FW~\375\213\210\021$H\214\247\344\226\250\002"
+	.ascii	"\234\032\267\013\227-\357\r\177\335Hw\334\025c\362)\3151\333"
+	.ascii	"%\256EW\340w\342](\262\320}\020%\304'5%\256\235\342Xv\b\302X"
+	.ascii	"\305\257\2548\345jP\365\2255\334\025\367]J_X@f\323\301\347~m"
+	.ascii	"\333m\276\267\0015\0305\r;A\266\232\217\220P\315V\342n,X\024"
+	.ascii	"\371\2142n?.<\004\331\210\204|tl\2130\004\224[\361\203\253\331"
+	.ascii	"~r\264\034\356\026\003\b\367Cs\001T\033\242\331p9Z\204\004&z"
+	.ascii	"q\303\321`\020\021\341h\262\213u\235\374\255s \003\205\025e\376"
+	.ascii	"\273q\2667l\317\326\027x\253\344\335}\262\335\263=\033\263\006"
+	.ascii	"\317\356l\317\236\\\236\025\257h\30492\231vH\n\374N\314\031("
+	.ascii	"\226v\226Zy\001N\311\224L\336L*\323\033\362\310\225\355\370C"
+	.ascii	"kLg\267\344c;`\034\261Jo\250`\372\302\235\324\216j>d\250QL\245"
+	.ascii	"$2cB\222\224\221d8\360\"\241\252\315\001\021`\251E$BB\346n\t"
+	.ascii	"\305\032.\367\316+I\220u\200\324\322\207HR\221\346\201j\266\337"
+	.ascii	"\030#\326T_$\341\tS\007\364\373aNL\023d\336\273\2776KZ=\340,"
+	.ascii	"n \367Q\230\267\362~\317d+\357j\037\305\t\035\250\301\205\201"
+	.ascii	"\034X\031Y\367\316\271z\334\013q\305\223\202G>\373\356\262Gz"
+	.ascii	"0&\300\032\354\367\367rH\274\261y\213\245\210\370\350\231p\t"
+	.ascii	"4\266\3748]^\215\325\302\332\271\307\336+\342*S\327\242\306Q"
+	.ascii	"\252\226\231\353\225\335\330\0332\376\377B\313\3447gA\353fT\374"
+	.ascii	"Si\254S\364%\"\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\377\003\025\021"
+	.string	"\344\030\373\004"
+	.string	""
+	.string	""
+	.string	"\002#\1774\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006&\1775\270\300,\1776\005\034\034\200\204\001"
+	.string	""
+	.string	"\003\002.\1777/\1778\0020\1779$\177:%\177;\377\377\377\377\003\005\033<\0059= ?\177>*\177?\300"
+	.string	"\177@(\177A\002\302"
+	.string	"\177B-\177C\303"
+	.string	"\177D+\177E\035\177F\272\200\202\002\036\177G\037\177H \177I!\177J'\177K\0051L\201"
+	.string	"\0012\177M\037"
+	.string	""
+	.string	"\200\200\200\001>\177N=\177O3\177P:\177Q7\177R<\177S;\177T5\177U8\177V4\177W6\177X\003\007\032$D\003\b#\003\036\270\233\032\001\344\001\003\b\"\307\344\345\377\003\001\204\006\003\b!\304\006\003\b \007\003\b\037\325\272\344\321\002\001\244\n\003\b\036\236\307\363\326\002\001\244\013\003\b\035\344\013\003\b"
+	.string	"\252\235\362\250\001\001\242\016\003\b\007\377\201\3367\001\202\017\003\b\034\244\022\003\b\033\304\023\004\013\321\231\263\346\002\001\265\007\003\f$\250\374\261\314\001\001\244\001\003\f\013\275\326\301\226\001\001\302\006\003\r\037\201\r%d\003\016\032\200\332\255%\016\"\346\336\301\357"
+	.string	"\001\244\007\003\016\r\315\325\314\311"
+	.string	"\001\202\n\003\017$\304\026\003\017\016\342\017\003\020\017\002\001\202\006\003\021$\004\001\304\007\003\021\016B\003\022\021\320\360\372\250\001\001\302\001\003\026\027\035\331\214\342\221\002\001d\003\027\204\001\003\030\027\"\003\030\b\242\001"
+	.ascii	"J\250\261\220q!\ff\222\202\024\025\352\300\002\241\242\331\006"
+	.ascii	"\021\340\0205H)Q\212\207\250\036\025\213E\222\227\323\267\334"
+	.ascii	"\2518S\352E\303&JzJ\2136\306\300\353K\255\024q\311\321\327O\017"
+	.ascii	"_\222p\351\335\025\256\255-\305Vl\305V\334;r\b%\361\222\016\315"
+	.ascii	"D\366; \223\222\332-\b\241\261\343\232\033\337\360\341\262?\265"
+	.ascii	"\261N4\236.\037\001>\264x\362\342\300n/\267r+\245;\316\264\333"
+	.ascii	"\364G\211\031\337\374\017\200H\2539\020iZ\024\264p\324"
+	.text
+	.section	.gnu.lto_.refs.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"e\b"
+	.string	"F\2230'p5M:\374\377\377\377\377\377\377\377\377\177(\024\343!\"\214\330\017\216\bm\310\376\377\366\377\233\231\2655k\t\221[\246!"
+	.string	"%"
+	.string	"&"
+	.string	"\375\353#\313\257\373\226\363V\240\235\362\246\234)Oz\262f\rYT\374\312\225\362U\336>\273\255g\200\335\261\221\306~\372M\237A\372\2523\312\217{Gy\243vA9A\177\240\\\240\\*\217\372\213\345\025\367\210\276\023\r}\206\362\205r\205\362\204r\204\362\203\362G\271A\271\243\337(\177\272\217\312\017}\347\236\271_\312\357x\230\036e\001#\266LYc\b3\203L2\332t'\245\335RW=\300\"2l\301yT\220Q\016\365\023\\z\237\274*\023\317\013@y\034"
+	.ascii	"m\020\236\022\003\002\363V\260T\220%\330R\205\374\343\0223{\360"
+	.ascii	"\322&9\332\036\t\273*\r\005\007\233-T,\347%\020Q\223\260iD\307"
+	.ascii	"\002\b\032\302K]Std\023\003\026v\306\275\301\f\260\235\322\230"
+	.ascii	"\\\247\023"
+	.text
+	.section	.gnu.lto_.decls.e207d4150d7ce97b,"e",@progbits
+	.string	"(\265/\375`NS\235a\001\272SZ\201W \fQ:\215\001\034\364\274\240\264\343P>\212Z\260\207H,o\354\213\347\030vx>\343\252\214\037,\353\241\217\246rd\256\254j[\300\320P@t\366."
+	.string	"\262\333M\342\246\\.\274\233h\305\301o\033\221\255\b_\206\212\354\034>N\025\342,\266K7\271\345\226R\312\024\035\007\364\007<\bXaXhY|\223\2136\253N\276)E\337\\\3237\207\350\2338\364M\032\032+\253N\236\343\3010\262\336nX|s\205~\375Br%\331F\347\3046\261r6\316B\251f\366\211u\273M\263j\347yb\225X&8D\030\366\306\302\013KR\321p~{[EI{b\331*Z\255;\333\230\007\223\025/\256\275\225\0336\360l\330\260\341\2729\335%\331`\273\304\276U\263C\261pW\346\320`=y\373b\361\361\235~=\224\234\202z(\371\330\211>>\323\307`\372\330\207>\276\322\3071\364q\223\256\312\272\223y\252N\306u\366\314\314${\342Ud\2615;.Bus\213`\314%9b\344\246"
+	.ascii	"\003\223\304b\245\r\013\026:\250\312:\320GK\324\276,\376-Y\021"
+	.ascii	"3)\316\314\260\370,g\205\220\245.\026\333!\251jpr\313*\246U\307"
+	.ascii	"\330d\255{2\355\262h\325+jL\232@\221\222$\356\257jN\236\324\305"
+	.ascii	"\255\321\321E\251oFN\252\374=V\326\226V\253v\251_\322\252\230"
+	.ascii	"V%\213\222\254lZ\265mN\253Ra\023\263Bl\227\rb\225\026\314\022"
+	.ascii	"\261\\\326\313~\3311\013\304\016\261av\253\232Y\255\n\246\206"
+	.ascii	"\251b\352\336\206\r\033\314-\266'\274\r\360A\260U\326\312&\355"
+	.ascii	"\225\355\201Cta\357+,\311\275\367\177\353\303\376\250f6\371+"
+	.ascii	"\353\230MV2\226\352*\223\030\260\303[\356\2757`\260\001;I\241"
+	.ascii	"\246\225\261\215\231\026oV\026\337b\375=8H \233\001\302\021\324"
+	.ascii	"ro\245\032\216\251e\017\016)\017FQI\035\226\207\315ao\330,\273"
+	.ascii	"\243\232Y\034\266\206\265a\253\254U\017\016[$#\271\267\262\003"
+	.ascii	"HZa8\270O\203\250;\371w\214\256mu'gPu2\017N\023\032Pr\026\277"
+	.ascii	"N)\"b\367_\325\210\276\226wFu\016\207\350\3026\262\363\352\340"
+	.ascii	"\301:\331\243:w\225\311\323\354\252k\311D\251\276\335\262\244"
+	.ascii	"N\"\333\261\254j\326\311\"Y\344U&)p\305U\305\254\223m\252\\\256"
+	.ascii	"2\371C\"\013[\356\275_\247\240\360\361\245\242\242]\361\b[\322"
+	.ascii	"Q\323\376\236['\233\242\276\3414]\330GF=\222{+\017\302\337s\353"
+	.ascii	"dWT\264[\226\324fd9\226{+\377[(\333\302NY\032v\206\225\262Q\366"
+	.ascii	"\311\276\2601\254\f\013\303\272\250f\326\311\262\260LUY\307^"
+	.ascii	"\225\033y\264\367\026\263N\225\257\366]er\357\253*\0167\336\246"
+	.ascii	"\240\366\366\336\033x6`/v\313:\r\360\257\020}\257\364/\224\376"
+	.ascii	"e\322\277)\364\355\031}+F\337V\321\277M\272E\376\366DM\263J\250"
+	.ascii	"@\241\260\270\226\351\271M2\241\240T\351\260\370vN\333\270\351"
+	.ascii	"[3}\333\245o\223\372{u'\377\365\314k\337_\313\324*5\257\203R"
+	.ascii	"\326\r\213\253\231\236\3273\231\013Y\306\313b\032,]Su\362\355"
+	.ascii	"\224\276e\322\346\023\275\377G3'\006*i\361-\n\375ZF\377\325\313"
+	.ascii	"\353\227\277.+]\235\023\301\336G{\357\fF\037PG,\256Hz^\275\334"
+	.ascii	"6&H|\026\277~\321\267\352\344\277\342\275r\251y\"\330\031p\314"
+	.ascii	"\360P\021\305\342\252\245ny\315\253Yv\315\013\201j\357\242\232"
+	.ascii	"\227\303\267wQN\255\034\324\312\001\366\272\362\221\226\361k"
+	.ascii	"\236\256Xz^\361t2\323\223r\237\355\275s\004\300\006\347f\361"
+	.ascii	"Yu\362k\025\375\332D?\316\210\376\225\037\372\313\272\223_\263"
+	.ascii	"\364k\224~U\241y\352N\256O*\224j\026\200*\367\016\036~\211\212"
+	.ascii	"\354\257\275\22597g\272\316\224\261\370\325H\277\006 \327\276"
+	.ascii	"\032\200\374\023h\ru'\377\250?\250;\371>\272\272U%\325\254\203"
+	.ascii	"\272\344\025IMr\263H\271\225{+s\254\0163hd\026\377\003\372\265"
+	.ascii	"\203|\373\372j\007\371\031\320\027\352N\266U'\277\255\356\344"
+	.ascii	"\213\240/T\235\374\272\272\223kY5R\3154\324\263\327\"5\354\277"
+	.ascii	"#\345.\333[\231\363\253\362e\306\231\305o\200~=\362\f\254\266"
+	.ascii	"\207c\320\257\032rN____\325\220o5\256:\371&\353N\376\240\223"
+	.ascii	"7\250;\231H\375\n\300E*Q\355\263\275\225\030r\2240\226\260,\276"
+	.ascii	"\262\356d]u\362\335\007\204\274\203)\032~\323\310_;\360\327\024"
+	.ascii	"\266\352\024\024\007\254\332\315\362W\020L\231\023\362\201\213"
+	.ascii	"\367_+Nz~\023\310\177Q`\365\327-t\177\345\372\300\231m\263\340"
+	.ascii	"7\253\376\352\364\327\250\277\316\230\202\372\253\324_\277\376"
+	.ascii	"*\303\005\223\271\277*\031\251I\246\212\377\362\374W\203\377"
+	.ascii	"b\360\337\235\377\002"
+	.string	"\340\277\026\3747\203\377f\370\357\005\377\035\300\275pq\256\315\245\271\272\307\305:\3773\370\263\004\376+w\241\004%\203\225\204\232\024\202\3376\271\372F\234\316o\376\370\253\220\277j\375,\213\003\277\255\2736\177\335@\205!\245\202\337$3r\231\374u\310_\241\234|D%\341\277q\377M\362\333\262\235\337D\361\333$\027I\345\252[\330\356\332_\335\210\007\301U\253Jk\003\370M\250\277\022\261<.\376\353\217\237\201\271h\035\330\343/\370\315\276\337\036o\177\223\002\377=\373\355\371_\263\377\036\371o\221\377*\177{\002\261\277\246W\204\377\206\201\375\225\350u\277\376\032\304\312\270D\256\327EA\t]\377-\342\372/\322\220\377*m\375w\205\377\n\371-R\220\337\216q\301\030\002\362\327:\236\017\374\007\301\325\372-X\t\277i\002\265\277&\371k\220\277\262\375\365\001\277M\341\376\260%T\254\344\177\271\377\035\334\035#\034"
+	.ascii	"\277I\202\277:\340\257\035\376\372\341\267)T\017\377\325\361"
+	.ascii	"W\t\214\270\006V\3529\277\311\200\377*\340\216 \307_\271,p\233"
+	.ascii	"\337\344\362_\005d\375V/\313\177q\200\205\335\033\377\365oR\321"
+	.ascii	"r\3637\235\300\2705~;\342\3717\227\374\225\356\257R\376:\345"
+	.ascii	"\257s\177\215\362\327\273\277\326]\254\377g\376\323\374f\n\376"
+	.ascii	"{\365\337\250\377\306\370\357\322\177\223\376k\364\337\024\374"
+	.ascii	"\227\004\377U\341\277!\376\333\200\377z\360\337\r~\333\367[1"
+	.ascii	"\277\325\373\255\227\337j\371-\226\337J\371\355\224\337\306\375"
+	.ascii	"\326\311o\327~\333\366\333\262\337\032\371\355\330o\305~\013"
+	.ascii	"\366[\"\277\335\372m\362\267=~\253\343\267W\277\225\372k\n\177"
+	.ascii	"M\301o-\360\327%\277\205\361W\034\177\005\373\253\004~\373\342"
+	.ascii	"\257@\376\032\202\277\302\370\253\322o\221\376\272\345\267E\277"
+	.ascii	"\035\372\353\320_K\374\325\353\257,\374\366\004\177\355\372-"
+	.ascii	"\013\177\305\372\355\n\277=\376?\373k\322_C\374\327\340\267)"
+	.ascii	"\374?\300oQ\370\355\210\337f\340\267'\374\326\204\337b\340\267"
+	.ascii	"%\374\366\002\177\245\362\327\267\277\272\375\265\355\257b\177"
+	.ascii	"\r\373+\005\376:\302_E\370\353\004\376\177\375\367\300\177(\377"
+	.ascii	"1\350\353\353\353\373\177_\277\r\227\037\002N\001\311}\305\212"
+	.ascii	"I\227\021\215m\245\275w\375\242\223MN^\244\206\340\2303a\230"
+	.ascii	"/\260\232\214\035Y\354\302d{\362\005f\361/\244\351\203\240\""
+	.ascii	"l\271\224\266D\201\345\316\222)\260\234\271\302D\342)(Z\\)\331"
+	.ascii	"3[\230,"
+	.string	"\314&\223\311t\252f\346\nSi\363\330p\315\330j\262\301\277\200C\377\002\224\376\005&\375\013H\3729|\3729_\364o\036\335L\372\315\023&\322ybo\331g\261E\326\235\314A\325\311U\254\347\346\221\036\223[rd\361o\356\233F\277Id\026\331-Qa9,\256\313\272\223\005\320\327ss\343t\021\315\350aq"
+	.string	"\312\034\237\3711\0376S\3630\321\217&_\026\333\247\272\223\013Pu2&\323s\\\3464\322en[L\200\275j\206\367nX\005\224\233\310\006\214\211\t\001\317\301\242\177,\006\207\211\252\252\221B\3578L\331\017\t\216\034K\213\353\262\347X\357\001:\260\274\300\340/f\300\210\241\260\330\013M\322\206\223\027\026?\347\211~\245{\202\345\266`*\370J\255;\013\361\006e\311\244\211\223\244\023$I\274\304\\0\036\316\303]\260\026\234\005c\251fx\013\276;N2\207\345\326\350\360\224Z\367\364"
+	.ascii	".\265e\\\\\317\026lW\347p\210\224\233\305\231Uu\306\305\336\336"
+	.ascii	"\312\r\347\027>\273\271\n0\266b\323%/\214\221\305\317\021\202"
+	.ascii	"\253<'\251\237S\245\237\023\245q\024\\W\315x\260\224)F+\244,"
+	.ascii	"~\216\223N\301\256<\371}\225'?GI\037\347\214\306P0\214\271\032"
+	.ascii	"=,>N\030}\234+\3728p\3728f\3728_\312\232\266)4\027p\370\315\306"
+	.ascii	"\351\356\007\013\213\361\022\345\021\022.7\213\217\223C\377X"
+	.ascii	"\311\241`-\270\243*\267\027Y\351F\206\255m\311,{\002\206\016"
+	.ascii	"'A\022aru\206\344\326\330\200\f-V\330\326\214\210\212\242,\376"
+	.ascii	"\361\232Z\214:> \026\363\240i\232\262db\361\362\313\r\003\002"
+	.ascii	"\211\351\267\342\352ki\345\342\035\356\254\307\306\341\262$\231"
+	.ascii	"\236\226O)\260\n\254\204W\330E\341)\2522W\314\335\273e\354\210"
+	.ascii	",\253\230\325\030\254\002+1\213\303\325\272\263\021\354\240\226"
+	.ascii	"\230\007F\303A\360\027\356\302i\230\foa.\234\304Cp\0306\202\307"
+	.ascii	"\260\031&\202\201\340#\370\007\006\303=\260\027.\303b\270\b\326"
+	.ascii	"\302>\260\020|V\315\260\362\3528\276\201q\234G\271\367Q\025\253"
+	.ascii	"\"\263$\302J\234\242\203\253l\323)\310f\310\220\302P\310\233"
+	.ascii	"\345r\371\2260\334\204[\254\230\242\301\267\274]\256\027#0LT"
+	.ascii	"\204O\324\272\247\013\373\210,+\231\004\005\317U&O3\273\251\245"
+	.ascii	"\030>\274A 1\375\222\256\272\2265\362n\226\253\345\346\221\211"
+	.ascii	"-\233\2340\f\020HL?\025d"
+	.string	"J\313\253\275\344\336J\034#\nC\201@b\372!]\241Xb\242\277\203\007\254\304H\030y\225\311\363\210\021\215%\026\206\342\202e(\361\f\f\245\201\021\262\002Zf\226\327\nV\342,\274\243\326=\355\335\264AW\026\227\267\275\275\267y\267\203\314\222\007\340\037\3538\336\361\337+\027K\315\303yR\243\311\n\213q\216\236c\035jP\314\370\260X\007\213\276Q\326\235\\\343\252N\376\315\024\375\0338\375\2333\375\033/\375\033\035\37273\364oX\350\337\024\351\017\302\350\333\\\321W\306\351W3\f5\302\226\214,\026\337FM\277\r\303\300/t\021\333[\024\374\002\273\250\0213zj\262\3706J}\233!\3726I\375:\034\3726T\032/=g\316F\226\023\026\337\346I\337FI\177Yu\362m\266~M\027\375\343\244cd\315\023A\006\026\216\214\372,\356\3519N\272N\025+3\326\304\342\327X\321?>\201\217\224"
+	.ascii	"\211\313\262\370\257f\317\303F\377o\003\200\2332\0300\310,~\215"
+	.ascii	"\234~\r\023]w\325\311\327\314=S\315.w\373\276\246\346ud\361k"
+	.ascii	"\326t\n\366\345\362k\312\364\177\313\220\311\t\023\205\212\222"
+	.ascii	"\314\035s\267d\343\322\257\361\241+S\230\253\267\004\303\212"
+	.ascii	"\336\005\203\223d\n\216\211\305\257\251\322\257\201\241\377\353"
+	.ascii	"eG\315\332T\225\024\026\277\006\251+U\031}\267\340(IB\203b\361"
+	.ascii	"i\300\350\323l\321\225\306\212\256Tu'[PurUV\271\323wX\300\216"
+	.ascii	"\240\260%\243\334)\327\356\322\335\272K\345J\251f\367\356\316"
+	.ascii	"\305\305}5q\262\274\273r\367M\003#d\005\224\254-\237 a\362$y"
+	.ascii	"\357\256\223\254%\217y\2657uw\001\237\006N\237fM\237&L\237\306"
+	.ascii	"\207>\215\f}\232%\375\237"
+	.string	"\031\375\337\236\376/\334[\275\222\234!w\337\356\022\".l\354\3309?\2672B^(A*1\324#\037kE\334\330\360\331\021)U\026\277~\025Q2R\277\240H\206\225\245X\256\335\266\233v\221\334$W\255\232]\266kv\317\252\332EK\273lwl\351\262\335#\310\313v\311\352\027\034\"\345&:\257TL\265\311\261P\262\205\203\353\256;\371w\247\377\203\242\377S\242\377c\323\377\035\321\377\201\351\377\264\364\177\225\032n\306T1\342\022\013;u\340\370\242\305\342\3777\310%r\265\356\326\005r\271\356\220\013v\275\256\220\373u\273\252\331\r\373o\362\376\270E7\354\036]\251Z\367\244\334D\032tU\331x\333\353\2717n\226\007)6\336\270\242\324\3311\265\356l\357\026 \210\214\331x\333S\273a\327\352\326\360Z\356\275\303n\216\353\243*\001B\334l\274\355\3313l\3112Dw\257\361U4\234#\345nr"
+	.ascii	"\221\2157\256kcH\223\215\267=\264\3370\273f\351@ 1Y\200lni\313"
+	.ascii	"\230Ib\243\204Y2M \210T\361h)E\212\3062\300\035(\353N\306{\327"
+	.ascii	"\307\355\341\206\245\342\316b\036g\023\345\f3\026\377\307C\377"
+	.ascii	"\257fw\307\325\361\177\357\035uO\270,\376\017K\3777\245/\016"
+	.ascii	"=27\226,\376oI\377\227\244\257\305\350\377b]\252[U\347\314\257"
+	.ascii	"\256\261&\026\337\253\236_\254\232\024r>\264X|\373\252N\276\376"
+	.ascii	"\2427\330U'\253\2701@ 1\375b\030\211-S\024\265\320\320Ed\343"
+	.ascii	"m\357J\335\023\027Y\353\2366Q\227\020\272\232l\274\355\335\031"
+	.ascii	"w\352\322\2702nT5\273R\177\025\273F\347\371\272R\367\251\242"
+	.ascii	"\341\034]\330GWa\311+u\241\356\222\006F\310]d\245a\210\233\215"
+	.ascii	"\267\275\275\225\033n\264\252`\264\260\301\327j\372Zya\324\263"
+	.ascii	"-\2472\213\257g\350W\263\373\342\272\300y;\001\247\345\364\353"
+	.ascii	"\342y6[\003\034.`G\252X|Y\334\026b\272\300\336,\276MV\231\304"
+	.ascii	"\252\315\342k$}\231\356\212\233>2iE\026_\245\273\364\377g\003"
+	.ascii	"\346\312\314\266\370\277Ku\316\332\315)\031Y|\275\212\366\377"
+	.ascii	"\227\351X\360\221\261\370\247\031\375s\251/\322\336\244\213\342"
+	.ascii	"\027y\221\336\301\303m\216.\022\357]T+\0078\265r`\302\361(\""
+	.ascii	"\313\370'\236\376i\247\177*\321v\327\235\214\231\252N\376)\246"
+	.ascii	"m\237M\021\f$R,\376\271\245\177R\351\237J\372YO\343d\325\311"
+	.ascii	"\317X\364\036\326zZ\330\354,~\216\323\257iw!\276\324\226{+m\027"
+	.ascii	"[\305^\251uO8\b\332\322n-9\205MJ\004\276\222,\253\332\226:\207"
+	.ascii	"s\367\236\212\363b\277X0V\317\212\261a\354\322\346Y.\325\314"
+	.ascii	"v\261Z\260r\357\243.\026K\235\253uO\017\360\022[v\261Y\300\272"
+	.ascii	"X\274\372V\353pl\234T\367%\314\206\r \260\232\220,\300\317:\364"
+	.ascii	"s\224~f\322\317)\364\3152Vn\257\374\226J\215\253y6H\346\214\330"
+	.ascii	"\260\270\026\351\271\265\202\003\370l\221\265\210\221\361=\261"
+	.ascii	"\370d\252!S+\212\301\342\377\335lum3s(P\234K\031\311\302r\b\324"
+	.string	"\362WT\345\by*\375\\\302G\322\240\344Y|\2520i"
+	.ascii	"y\322\263\370Lq\2714\271\024X\207\303/\334\210\31459q\342L\312"
+	.ascii	"\310\026\260\206L-i\254\244\350V\234H?\223.\307\202\\\n-\267"
+	.ascii	"\223\350$:\215fd=\257-\272\275\037\223\223\213}\026\3754\312"
+	.ascii	"\243\351\313\343\363J\0333&\367\375\036\355)\032\331\211\327"
+	.ascii	"\026\335\336-sW\006\311\231\347\276<(Q`s\026g\276l\006F\021\262"
+	.ascii	"\212\305\257f\337\362\274\034 Z\224\204Y\234\313\334<.mD\216"
+	.ascii	",\316dn\336\226\263\036R\026_//k\242HiQ\306\342\363\224m\371"
+	.ascii	"\267d1\227\317\246\016\301\303\211s\201t\326\345Y\314s\230\016"
+	.ascii	"\036\016w\245\004\343\2638\353\345 \346\016)\276\023`n\316X "
+	.ascii	"Qaq\376\222\2230\312\356\316X\234\275d\255\"\245\2542\213\357"
+	.ascii	"\201\031\034kN\026g.yi\353\252\366N\370\350Q\343\346#I\026\213"
+	.ascii	"\237\363\252v\370h\301Ds%*I\214\305\347\371:\362\214\345H\316"
+	.ascii	"\022\201\020\344\330\242\343\332\373ICN\223R\0249\274\347,pu"
+	.ascii	"|d|\324P-\361\321Y\234\251\344+4dm^\304,\316U\262\025\0342]/"
+	.ascii	"\312xH\311w6YYl}\026\347)\331\016g\212\212G\032\326\\\256\373"
+	.ascii	"\341\253Bfq\246\313Q\354\330\022\2550ON\262\234\215\030\261."
+	.ascii	"h\026\347'\031\312O\254h\351\325\004\227\343r\356\266\332\264"
+	.ascii	"X\234\231\344&4*\260\222t\241p\313o\247\223 FH\026g%y\t\316B"
+	.ascii	"\203\ri\361y\214\330r[5\323\004\312\016\2133\222\234\344\377"
+	.ascii	"\257\236%\223\320\306\250=\257\375\277\234\034H;*\213\237a\251"
+	.ascii	"\237\321r\332\377\313sw'\266\305\317`Eg\263|\226o\250e\210\242"
+	.ascii	"\343\276\236\303\304r\331\265\333\333\350\003\245\321\225\215"
+	.ascii	"|\322\200\237\224\2019*\362\\\366L\326\301\303\267\254\031)O"
+	.ascii	"X\374[\2649=0\213\363\330\267\334\205E)-\316\312s\271\003\022"
+	.ascii	"\306\355P\302\316v`Y\374\ff:\203)\223\1772{\341\244\252\334O"
+	.ascii	"TD]z\272\322\2364X\025iZ^\374x\366z\356\352\340\341p4s8\230\264"
+	.ascii	"X\234\207d.\355f\305\013\211\305\317B\362\326\377\253`Qj',~\206"
+	.ascii	".\235\203\344$V\231\270*\2133\020\005\314 S\305g\361\263\026"
+	.ascii	"\216)<\204Xl\353\341\362\357\333\315\227\017+t\026?\203V\266"
+	.ascii	"z\266\361W\263"
+	.string	"l\225{\334*6\233\250\310fq&yB&\314\336F>i\250\031S1&\305\342?g=\367x\346\321\301\303\267h\256\255*E\026\347\035\307y\232S\262\264\3709G\326\361\377h\200\324(\033b\36138\351+\340\377O\027\201\321\324dq\306\361-6\310\026\245.\026\347\033\207\263y\262\262w#\217\356\312\316\310\342\214\365\\\343\377\375\224L\325\260\262\370\031T\350?_\375\2773\255\212\214\244\305\317\200\244\177A_&z5\313D\231\352\207\334\273\005\007M\306\236\020`\2229M\301\263\230\306sQ\276\3111\305\225\302\342_\260\324\3773T\236\221\2432\214,\225_d\031\371)\307\250fy*\267x.\312GbEa\276\366\304\220\031\005\b$\246\037\013\273-K\245\274\324\002\002Za\276\270\246\220\274\204\371\332s\312.\304zVd\026xL\271\351\003\260\026bI\371\004\330\2240_{y*\247\310*\256\036"
+	.ascii	"V$\314\027\026\202d\356\204\005\370\317.\266\240\306tUY\374\013"
+	.ascii	"\210\350_\260C\377\271\311\274\222\023be\361/\230\301\242o\f"
+	.ascii	"\217!P\026\377\202&\375\347%S\312\021\02351\026\377\202\255\377"
+	.ascii	"\254\302\324!'\204n\347\212\3763\n3Nj\214\231$\213\277\303D\177"
+	.ascii	"'M\177gK\377\371D\217\txQ\252a\361w\2524V\326\235\374\263\252"
+	.ascii	"\223\277\3234f\214\331WC\0303v\346f\337\021J\212\024\213M3f\025"
+	.ascii	"\223V\025\230\311\327\206\374\341\305\3443\313L\351(\242\302"
+	.ascii	"\205\351\204\317j\005\031S\351\346\240\323\032b\361w\214\304"
+	.ascii	"\\\214\251\247\367\336D\027\266\021\225\247\344~z\322\220s\005"
+	.ascii	"\356\007\017\213o\301\0270`L\275\n\001#*\226\373\351IC=\303%"
+	.ascii	"\006\304b=sJ\220\036ityy\246\227\25339\205\214\2531/]j\030;\035"
+	.ascii	"e\272,\177VB\226\3139{e\327\025\306\305\272\035\231B\306\316"
+	.ascii	"\342[\240\226%\213\251\005\t\331\230\345~\222\322@\303\244\247"
+	.ascii	"e\304b-V\364\364\242\274\260\370\026\f\321ww&\026\275y\300\306"
+	.ascii	"\2364\340\314!\351{\272r\023K\216\226\037YQV\314\314\226\320"
+	.ascii	"\254T\361p\304J\216\n^\342\343n\310\034\225;W\255\242\334\264"
+	.ascii	",\276\005WP\314)PL)rr\246\224\037n6\336\366\352nJ\301Iq\307\027"
+	.ascii	"e\261\031\205n\316\002&}\2350JL'J\314\270%K\314\270\272\231\272"
+	.ascii	"\306\232\334\214k\261\026\246\310b\223IE\373\377\243\2211$\307"
+	.ascii	"\t\213M\270\273dv\026\325g\261\371vc\334\255\242Hl\212\276\216"
+	.ascii	"\231\231\311ff\266%\271\331f\203Uf"
+	.string	".\315b\023\311\331\231\271\246\211N \305\306\033\227\251vs\355\006\314fa\304b3\355\224b\303\210\322b\023\rG+\352\314\234\305\327\273\310\024-\226LY|\035\037\372:Ld\246\0212\263G\336\273*\251X0\355'&\reeL=2\210t\212\364+\330\242\177s\314\314\034\303k\027IUT\005\002.j\213no\3578\004\3208\201r:c\361+h\323\257]\325\024{53\305\314\030?\344\336N\032\200T\240\004\0033{|\020\245\251\202\035\\\\&\021'L^7\211\344\024Njy\026\233]\366\210M\0251kxPZ\3272\267\354\336{'O%KS\313\375\344b\313\024b\265\0301\352\022b\006qJs\261d\217\346\213L\211\004b\265\340\344\215Y\323\263\370\025\034%\2374{T`\357M\244\334,\352\222&\033o\\\030\266\360\340a\366\350q\033\273\336\315\036\277\037@\256\224\232\324\250a\352"
+	.ascii	"\303\201\020\246\0337u\2309j\310\270\355 \262\330\314\302\301"
+	.ascii	"s\343;b\3611\210\2318L\033\025\315.\n\317J\215\251)\363\252\206"
+	.ascii	" \246\213\013\r\277iu\363\352\004hD\266,\276\236Y\365\377\367"
+	.ascii	"\033\222\242K\225I\265\302\353F\022/<w\323\035\275\2314\360\235"
+	.ascii	"\315\027=)6\213\217\301\205\276\371dB\335\214\272\031eJ\375\366"
+	.ascii	"\336\373i\023u\371\240\311\017\033o{\373\211I\303o\312\270)u"
+	.ascii	"\221\347\0130<9\213\257g\217\374\377\325\\\315\335\315Y\374\013"
+	.ascii	"g\364_o\377\274\213\230\366\336-L\345f2\262\311\177}5k\325\360"
+	.ascii	"\337\324[\t\360\037\337_\304\n\312}\204\004\314\336\273\202\321"
+	.ascii	"@\222\024\311\330`\233u{\037Y\021E\300\252\351\310*\006\262\314"
+	.ascii	"\252\t\003\262\314j\023\035\365 \302\300\264\255\210\220e{c8"
+	.ascii	":\"\nA\325\204,+\332\030\220e\273i\237\230\322T\267\322\212h"
+	.ascii	"\037Qm\f\373h\027\3552\252\246\r\220GVM\310\262\242&\f\3102\253"
+	.ascii	"\246]f\265/\354\243\"&\024G\233\t\303.\263\352\262\313\250\232"
+	.ascii	". \313\250\232\220eVh\025,\305\r)\027l`\262d\324&\344\321^\261"
+	.ascii	"$U\304t\241\016\251\244\332W\366\256gH\233i\327\355M\200\275"
+	.ascii	"\245\250\230\256\024\305\250mFu+\214\326\212\2500X2\272\242\332"
+	.ascii	"GuDu\327!\203P\355\035\304\310\304^\332"
+	.ascii	"{\357\020\210\224u;\253\326\021aIm%\244\2753\330\312\275\227"
+	.ascii	"\366&\252\273n\357M\264\367>\231\244\224{G"
+	.string	"]@&\227\226\366~\342Y\332RDnH{\3333\274\266&d\331\025U\217\333\221\262\344NR\022U\244\022\325\016A\305\037b\320\bL\215\301\364\b\344!\026\203\202\212>\030\244\300`:DC\240A\302\264F(\310\347\227\022\205\033\224 \026\207\032(\337\204\007h\2200\315\340X4\372\b\203rPV\001E\217@\346p\210\246@\346\017QH\002\324\230\177\202\250\021\310\004:\203\202\2501=\242BE\034\"*T\fB\203\2004*T\241X\364\001\252!\242B\305\037\240\034\302\207\223\210\n\025\201\314\020>\374P\242pH\024\026\211\332\2478\034\006\321\237\r\032\035\n\201\204\202\322\023(\003\211\302\024x\241\005!\237`\220\261\b\224\201R\242\320(\224o\302\203\022D\241\361\202\341p\210H,\022O\022\024\215&\322\"\361\004\n\242C\234\242\307 4(\247C\241 !\007%\200G \216\0200\025\022\2055\027H"
+	.string	"\207\303\242\020\260F\b\324\021\002\321!\211\340\210\r\344\244B\242\b\364X\034\372\344\034Q#\260\202\022)z\004V\360\023D5\240\223A\006#\nt$\006\215)P"
+	.string	"\303a\361\204\233\017<H\215A!\017\206\303\342\t7\341AQ\370\223\036w\214F\364'=\346\034\264D0H\004\021\025*\352\030I\224\3603\024\016\221"
+	.string	"V\220\242\024\260\340\007-\201p\030\024\246B\242\210\013\206A\342\020\tG\021(\3608\224\006S\0242`\220\n\211\"P\343\t$\034\205\300\235\373\b\215(\021-\241\037\302\007\005|"
+	.ascii	"\301\302y\020\r\370\240\001\037\344\203h@OO\003>\364\350\177"
+	.ascii	"\350\271\251P\350\b<\016\221\3401j\242\360\004\241\320\021G\005"
+	.ascii	"\037\024t\361(\024"
+	.string	"\036\213%\374R\241b0(\004\013\251\376\2457\341A\t\241\f(\020\375)\226`\203\376\024\2030N0(\004z\034\312\031\365\021\256\200\376\344\022\301\0217)\260DpDQx\226\b\216H}\320!\212\202\220\320\204\317\315\017\232\032\321\025\210\"R\0374EC\374\030\203>\025\030Q!\2200%\242?\"\202A?7C\224H\f\232\020!\030\364C\223\336\204\007\251\317\2201=r8\242B-\244\034\216\251\220\004\207!b\t\005\2600D\024\016\025\020\302\007\340\007\020,p@\177\206\206>D!\007\343q\210\303\002:\374\240\307!\342\020Pgc*d\363\023D\2158\306T\350\207\210\002m~\210(\020h\210\004z\f\222\270A\217A\022@\240\t\"\2009?D\024\210\256\020<\002M\020\001\2649\032Q\025\214\301 \240&\n\203&|\200\271\b<;\034K\004\207@\3003\005\236?\303\"\260\206\03044,\372"
+	.string	"\215C>\300\032tH\"\230\256"
+	.string	"\304\001\032\"\221\032\213&\216\300_\n4A\004\220F\005\237\342\020h\246\300\020>"
+	.string	"\001\025\201\300_\212\036\201\200\212\300\323\004\021\300\232t\005\037\364\247\350\003\324&\210"
+	.string	"\336\004\323\340\017\020\375\021\222"
+	.string	"H\223\036\205\303\033\240!\022\300#jDQ#\020\320&\005\242%\020\036\263\207\237\240\020\020\230\321\237b\020\320<\002K\b\201\210E\0210\240AA\":\024\002\351\237 j\274\3019\246\320\202\017\021M\203\027\030\006W0\242)Q\304\3151\205\241\020\303a0=\346\374\240\350\021\247@bQ\230\nSc\360\004#\211 \235b\221\204>\232\360\321\250P\013)\376!\216p4\341\223\211\302\022\350\004\202$\206ACD\232\021. \202\004<\302\005D\220"
+	.string	"4A\004P\233(\020E\321\022\301 a\216\221D\320\275\217\021\005\002\032\"\221Y@\177\210\"|\200\""
+	.string	"\t\200\002/\320\3014\030B\005\237 \211\3410\350c3,\026'"
+	.string	"4\177\320\2410\b\224M(A\024\376\020Q\241\013h\220pDj\f\246(T\220\002S\215\006\tG\240):\024\n*\212@,\n\323\240\021\025*\356\244,\240\030\320!\n\203A\250\006\320Th\344\2000\035\016\005]\200\026\177\210AcM\252\201\211\224X,!\347\b,a\002AC\304_\b\021Ah\321\f!\302\210\032\207R\237 \320\0201\030\204\203\006\0051P3\f\n\215(\n7\306\342\b\202E\242\260\004bQx\024\256\200j\300\002c\020\365"
+	.string	"\261(L}\206~\212F!\234`\032\374\t\246h\220Nob\203\024\030\302\207\024\320 \341\210\026\216C$h\216\300c\032LQ\b\022\242p\341'\210j\200\206\210\246\251\320\310\201\243\n>\305!\211\233\343p\030LQ@S\241\221\0045\307\324\007\035\001\252\201\026\216C$j\216i0=\232\030>\364\244A \363&<\3701\006\177\210\301\364\bL\203@\034\216@i\020\310\207\330\3021\310\241(\324\360\242\020j\344\220\026\213F\0165\250P\013#\202\320\364\330\002\n\350P\b\204\223\0021t"
+	.ascii	"\341X\"8$!e\001\325Ft\003G 3-\026"
+	.string	"\2155E \242\210#P\036R\301'H\342\2026\242$\202\2060P\323\363C\215Ci\220XB\210BZ,\222\270\t!B\017Q\022\301\013\254P\323\001\2044\bd\032\213\251\220\320\350sDC\244A\240\233\037T\005\237\240PN\201!D\240AC\303\342\006\322 \320MZ,N@(h\004\2471h\302\007\243AA\f\004\241\305\323\210\236pD\323\026H\340\030\321\36484\024\001\303\017\272\202\021=\242F\235\343\b\t\220\0204D<S\342PQ\204\026\214)q\204\264X4\342|\350I\201 R\242p\350\f\n\177\320 \363C\017Z\002!\n#$@\302O\005\237\240q\204\021=\341\230\223\002?\364\034\177\202h\005\202\206\210\232\210\376\374\bM\334\244\300\016 \244D\341\220~O\217\b\033\244\200\001\nh\037\017\202\204G\340\2171\350\363s\344p4\242+\b\215?\034\210\302`\020\007\037\343\221\203\007\003\350"
+	.string	"\302\321XL}P\024\206\301\264\230\342\374?\265\230k\\\322t\210\261\370\304rb9\361\352f\362b"
+	.ascii	"\270\246\023\257\242]\274!u>,>\006Q\316\272\263\356\264R7\223"
+	.ascii	"\207\027ng\225\237V\362~B\362l,->\251\334\254\257#'\276,>\357"
+	.ascii	"*\032\021\036\023\032\026\237vw\311\206LWV\226\305\347\224\033"
+	.ascii	"c\006\235X\235\305\247\024\f\216\350\377\214r^\275\235\r\341"
+	.ascii	"S~\275\271h;\347\354\230\033\031_R[\247\334\t\305\251J\013\236"
+	.ascii	"\305XO\255\230!\344\311\031\205\325\245\302\342\323\355t;\343"
+	.ascii	"~D8Y\354tp\235K~\306\235M\360n\300=\261\370|;\341\252\331\341"
+	.ascii	"N&;'\247\211\036\2156\213\217\001\225fa\357\275\341\362\251\344"
+	.ascii	"\356)gx\210\331\377\177@\270\034{\026\037\003\030_p+\222\230"
+	.ascii	"mQzcU\026Pm\252 S3j`\375d\013@\216\220\256\035O\026\237jW\226"
+	.ascii	"\251y)\263\370\030,\351\377L3\365\320\240p\\\241adN\0135\274"
+	.ascii	"\036g\247\231\315\025\023\226\032F~\232\375\347\021\273\2418"
+	.ascii	"\261+cqN\325\311gY\317O#}}K\262,\3069\213\374$\303B\204\3642"
+	.ascii	"\206\317<)\307\364Pf\257\234\265/\251\035b\366J\215\225#rha\271"
+	.ascii	"\354\0034\222\244\300L\":\f+\214\321\227)\365\273\002d.\005\021"
+	.ascii	"\323H\b\f\030\236W_\r\026\276\"\310\256\323(\347\213\314\335"
+	.ascii	"\026\2563\251.q\241"
+	.ascii	"A4d)\253\t\323\226-3)+iY;!DL\220\2652\\g\2203\206\215#jJ\213"
+	.ascii	"\225e{+s,x\032\262B\353\344A\363\226\224\243\312\342\017p(\251"
+	.ascii	"\326\366V\346\374x\\\261@\263\370\364a\317\036g\362\247\217\237"
+	.ascii	"\206\t\207r\257\355\255<}\\\271\234[9\310)b\313B\227q\316\025"
+	.ascii	"!J\300,\266F~jD\202(\351\310b\343\344JQW\216\334\243N\254/\353"
+	.ascii	"\314\262tbxYk8\316\033Q\2004yY<w\335\236\234\231\261\021C\315"
+	.ascii	"\314\313\325Y\243\366\215\261p\nb\261\224\324yu\301\005\3176"
+	.ascii	"\202\022\265EW\277P\321ruV\375\274\372i\325\301\303\315\263\221"
+	.ascii	"q4e\311I\343\244\362R\004G\033\227\345^\220=<\213\317\251s\006"
+	.ascii	"\006HP'\324\031U\213l\026\331\314\356\306\226\216\001\244\013"
+	.ascii	"\305\031u\267\026&}|wK~\272Xr\306\250\310\315\200\246\034x\356"
+	.ascii	"NK\013\030?c\\\037U\250\030\325\260\370|\221qZ\224'^\362jl=\351"
+	.ascii	"a\361\331t:\351\0258\244D\261\001\205\306\250\363\021T\202D*"
+	.ascii	"\305(\212\004\025C\206hhf\224\016\203\025@0P8(\031\353\253\342"
+	.ascii	"\036\023\300\303\212\213\344\241\246\306\234bdFDDD\222$\265\322"
+	.ascii	"\030N,0\301c#B0\034*\210H\373\221hHoJ\036\210\366\376\206s\016"
+	.ascii	"\232&\245\001\t\037\314\376V\345\253\tdg*\247\212H\323\362\310"
+	.ascii	"M\307t3\203\0049\206\003Y%\016\317\363\322\233h\271\"\321\214"
+	.ascii	"\376\t\261\3241\b\205O\304d\236\307C+\177\230\347\265}L\360"
+	.string	"3\002\265\002j\214\004g\002%U#\266\364 \024 \362\237\177\347L\3552\302\366[K\247\310\252Q\261\2723To\223\003IZk8\301\b,\224'\222\254\326\224m\371f\345^4\327\264|\305\323\256\214J\264\360\332\224I\005\212\022qGW\205\203\342-\202\365\223yb\200{D\240\020)\360M\311\367\245c\336V\032\221\331Td\260\361r\355z<\257\"<\021I\370g\345J\257\033\271\271\202\375\3463!~O`\222\370j\026\301r=\354A\222}jT$\223\203\266\356\003\024\216r}\271\211X\301\021\316\222A)*\034\220`F\001}$\237,s\260{\2327p\351\231'\357\270\337UH\001\021\372\217\005\032:\204\200\".\233;\264U\370}H\035\226\254\346\334\273\025\260V\001\332\323\t;\330\314yc#\365~\001\316\3628\306\363\372v21:\023\003\307\021@\207SQ\240\253Ev\3675N\260\321c"
+	.string	"\317i0\022\2474\\\006v\300\224\242\300;\305!D\b\260h\236\233\217\366\321\020\233\300\362\021\030=\377\211\206\306\345>\272S\224#f2\177|A\037H~h\340{\242.\334h\357O\347\030\203/*\274-L\273\210\3141\305\224mQ(\004\313\215\256$\002\307\rg2\341\0177@\276$_J\375=\342i\036\215\006C\212\276)=\216\332\246\330\323\322&&\375\tw\316\026\225q\322\352\336\235\353"
+	.string	"\310F\302\007\350\013\001>\267\323\016\250\\\313\004\366\242\223S;\342\215cT\303\036\301C6j\007\353\231"
+	.string	"\f\275\031u\206@\247r\336Wc\347\b\214\252\243=s\214t\255\301\023&\213\223\177\221\366th\262@\234\207M\017\211\204\006\314\t\315\311\360@i'\237\356t\371R\027I\316\375."
+	.string	"\365*\031l\215\333U\255\017\215\036\252\222:\210<GD~\240\t\013\366S\203\206\306\231Y@\331N\327\376\300\353\321\346\326\244\356\001l\234\276&>\006QP\321\006^c;\342\236W\373S\n\235~\246\031P8<\022\033\205\205\233\262\241r\301Ml\325\035\326\362\224s\005\265k\214b\302\305Y\016\240\345\235\331\314\263\177\370\"\241\206\246Z\267\003\211\377~\n\034\254n\214\365JW!7vh\246\265\243?P\354T\035\016\302u\275W\207\354\004/\261\262\211d\013z\013\025\266l\315\016G\260\210\200\300aR\312q\235\346o\364\267\324\265%\275\316\302N\205\035\005[\306\360\2423l#Q\020\f\372}\325\033\327\263\320D\003\026\007\256\234\330Z\332\201\337\324\254\034\231_\361\314\365\230\370\241p\361F\002"
+	.string	"\263\224\013\374@\r\311=3\203V\356^\022p\362\245\220\276\376\301\251T\270\303\304\341\3566\357\211\2760 \177u\235\212\3527\272,:\200\300n&X\276t\013\006\244[fL\f\013\300\270\336@\341\253*\370&\210\211 G\303\216l\252\364\326\337~\002C6\034\221"
+	.string	"<\246\365\213&\361\025\314\\\260o$\034\"I\214\276u\364\026\035\024\236\366\363\223U\330H3w\344\2764\345\004!\257\322\210\252y[\203X-\001V\340Y:\353UXh\035R\240\200\234\250\273.\223\013\225\006%\344D\352\335\244^\n\312H|<\224\230U\303\204\r=\237\226\320RR\266\203Le\023+\347A\334$\rb\024\030d\022\3604\204\271\303\363\300\244\036Q\305\262\343r\361H\266\013\013\350dA\022\357\255\314>\301\312j\025\212\241\235\016\006\300\223$\232\027f;\210\265\2669_\200`\377DRq\330XX\005+j\226\312\341\007\272\344P`\274A\352\r4\253\312_\203\305\256\310]\210\204\271Z,\345\321\013\315\004V'"
+	.string	"J;\345\337\373\037\256\363\304\254`J\303\177E\342RBE\202?\237\316\002~Ia \2749\374\367[R\357\226\231\203\246n\204\205\352\210 \024\375\243\341\372\265\250^\\E>\350G\265\335q\205\227\262\272p\342S\301$`3\001"
+	.string	"\323\241\003\270\322\030\204U\b\026A\351\342dg \356r\207n7Y\243a\013t\3476xbF\266\023\235\217\243\362\t\006#\003c\0023\332R\325\2147`\035S\200\201\301T\215\312do\206\321"
+	.string	"\304\031F\005\356b2k\340\316\240\036\254\0135\301\303.OY\335\360P\333\227$\006\023'\006?\225\372@\016\271\323\221\271W\323\335!s\222\177\024X\342\350\253\346\332\257\351q\337wp\267\206\240\373\347\245\300%\372\025\251\341fc\321\r\f[\352\301>\263\307\346\276>J]%b\244\314\n\263\323\254\375\310B;\245] T\272\206A\307\213\032\307\022\313\t\353^\257\021\004(\322\351\007\\W}7|\2362\373\242\350\270\004\356\370\256S\313\t\300\342\305\247*"
+	.ascii	"\243\236y\224\331f\276\272\314\3630\025\216\364\216\352\234\254"
+	.ascii	"P\224;tj\252C'_o5w5ZN\"|\243\352\236\235\260\216\326l/\314\n"
+	.ascii	"\264\244\364<u\336ky\203#y\220\317r\020\371x=\315\234\267\224"
+	.ascii	"o\250u\337\266\212\304\tP\25083\\\017\202\365\004z\274\"t\252"
+	.ascii	"\344\216K1>\274n\300PxZ\337\320\307\300\035\327o^\200\370\214"
+	.ascii	"\2276\032n\236\335\236\001\272+u\210\266\3763\207\231\247`S\034"
+	.ascii	"\213\314\274\2556\363\243\\\360\303\277!\345\246\031,\321\246"
+	.ascii	"B5\373\262\262yFmi\0219\332o\030\333\3632\0051a\336\036$`@D-"
+	.ascii	"\250/\35708\267\254\265yv/\214\337\t\264\030\006:\307j\275/G"
+	.ascii	"\032U\034\007\232l\027\247?A\\(\326\332\365\003\340j.\300Z+\002"
+	.ascii	"\202&Tn\310\323\205\364\236F\247\320\346\340q\334\r}\370\356"
+	.ascii	"Y\023\321\340\201\326:\003\231\037xR\207\f\247\021\r\267\304"
+	.ascii	"\340\247\323Ba\251\030\376\231\365[3\006\302M@\365\205^q\360"
+	.ascii	"\\{\371\362\247\241\212\266?\360\201f\346\366\362"
+	.string	":\350\220\261\201\3248d\257\270\3510+q\372@\303\371\226(d\202\256;6\367\317*\276\005\237j\rwP \235\315\\\257\346\363!\344\324\210C\315\031\256\245\34263\003\255Lv\320\330\350\345\344\375\232\220\211?\317\311/H\362\037\364\202T\030\371g\373\310\027\220\230ZK\354 F\331\006>\221\025\260\206\212\n\276\323^\314{\003V\321\020=\344\037\237\236\376\244\204\360\032\343\302\336$\223\310\0265\347\337Mp\372\223\366^\374s\362\342I\342\274q3\227\177\001D\355\027e\244\213\006\217fQ\002\330\260"
+	.string	"\275\310E\254\007\265\330\3603\253Y^\371-\202p\261U\2643;X\025\230N\300\3574\272\\p$\256\316~\004\320~\323U\026\031\334\207\353R\367-\007\351b\351uP\f9\254\017\3322\333Fa\237\272\334\347\213\035h\3345\213\2312\207S\2474z\024\206\332\3749}\\\320\274\272\257\374Y\035 \325]L\3004X\212\230\250:\320l \201\255q\017\020@MV\246%\226\257\217\031\3045\235gN\247F\030\222W\013q\027(\272\213\026m\333\363\360*U\220h)\022?`&\364\023\331\037G;\252a\256s\215\n\350\247\030\333\234\2256\331YX\336"
+	.string	"b)S\367K,\343\033\333\033Iz\322\373\216\352\252\021\213:\017\316\2640\336\243vV\376K\371q'\034Mj\313\223\204E\327z\310\244<\23264+\353\325\326\202\006\264\023~K%\337\223Xt\347Uaxe>\356\\x\313\301\250\307\312C+\314\302\271g\207\003!\304\335O\263\223u\223$\231\253G\327\f|\205\032\004,o@\373\263^\017<N\225\005\300\362V\352\270\325\373\256\336O"
+	.string	"\023\031/X\266}4\356\2721z\302q\363\313JN/\034\311\264\376\341v?\201\007n1\240\266!\034\210\241\001\335`Y\013(C\245\375\236jd\3710\031P\311P\377J\021\177\306\260\212\325R\210;4\322J#\026\312\254$\206\230\277\232J\261\201X\253\037\203\371\366\rJT)\353\270kK\004\325\206(d*z\314\030\020\234\333iw\317R\335\005\035\254\034\\\305\320\226\326N\272\375c\340\370X"
+	.string	"-C\223O\b\256,\332\304S\347\233,\211\323\2321[\363\303`\030\367\313\330\3562\353\013!\2416|P'\0326\336E~a\332\221\260\307\\\327\304}L\353\001:\200\230)\302s\"\027\335\247\217\374\324]m\366\rz\342\371\0315\342z\324\307yU\2410T\177\270\303\003K_\327+_@R\b\256\210\003\310\366\025\016\205\260\337\207\340-T(.\210/\306\300'\361\315\242<\007\037\210|\336\310\375\365\205\200MG\220\007!Z\324\377\200\220MU\036\002nM<~qC\377a\313\344\216S\214\325\020^d\254\364\231\263\222I\324\216\203\255\021\004\006\210\230\365\224{\2017\0351\254\235\224\332\351Q:\271H\273\265\246\203\311S\252\341x\207,\3163\227w\300\004\253o\331N\314\201>\360V,&\322}\3557`\323\303\260\310\343\274\360\320\221\221\210\324dV\334n^\267"
+	.string	"\332\304EW\205\316\265\300\312"
+	.string	"A\313\023Zq8*\021\027)<q\376d\313\032\021\231-\007\365\254\">\212\362\345\232\226\231}\242V\300\030\2020s;x\026T\252.\270\365\360\2309\030\254\213$"
+	.string	"\371\377\027\230\033\326\341\277\231@\b\353\351L\347\023_G\267\\C\277-N]\nE\252#\213`\016soMf\\\034h\374\200j\006n\271n\217\260\213\277\234|\030\313#\350=\334RVq\321-H\246 V\3251Vs\273\035&-\372$\025{\266\363\263\360o\341\347\265e?\264\r\304s\006\366\007\311\\/\345\r,\337\37336\326\325\347\322\\I\353\027\322\363\036\361O\305\300\001\327\275c\274\307\316\357T\342\343Z4\342\221\032Fz\255/\027Q\321\020u?\202\330\221;#n\024\350\232'\277\013\274\226\266\250\340\226\310\347\002'\376\267\343P\254J\377\273\347$\352\201\2708O\265\304\266\203\213\3372\361\013\303_g\272\241\367\0367+\210\366(\232M\250\035\207"
+	.ascii	"}\031\266\322\203\227+\373\215\002;\321>\037\203G\243\215+~\022"
+	.ascii	"\006\254\241IV`\370O\030\317Kq\320\262\207\020Ch\307\346\215"
+	.ascii	"\037\021MIuN\351\0018\006\371\221\273\344?\235\037\343\350\334"
+	.ascii	"\323\223\001\007@x\362{nr\0173\375\210\373\212\333/\027\313\277"
+	.ascii	"\037z\302\265\370\254\177\336\237\231\273\374\347\266_\026\337"
+	.ascii	"{\252\375\344\203\215\2777\3517\024\342&\216{\032[c`K3/\021\351"
+	.ascii	"\021\314\324\310o$\3769<P\231\303~\006o\347\220\3770\024;!\374"
+	.ascii	"\336\211n\344\311\2339\204\260d\007\357\013\207\305\025:\355"
+	.ascii	"x\316\035\036\177\032\276\020s\006\002\017\002M4=\020\341\006"
+	.ascii	"J\013\177\340\007\31255\227\212K\353\356\354\371K\344\020\370"
+	.ascii	"\036\331\265\206w\311\202\016\025\335q7\231\326\025"
+	.text
+	.section	.gnu.lto_.symtab.e207d4150d7ce97b,"e",@progbits
+	.string	"sdcardSim_setConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"sdcardSim_getConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"sdcardSim_getStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"sdcardSim_resetStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"sdcardSim_close"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"sdcardSimVTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e207d4150d7ce97b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
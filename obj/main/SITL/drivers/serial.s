@@ -0,0 +1,763 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.string	"\021"
+	.text
+	.section	.gnu.lto_.icf.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\005\007"
+	.string	"\242K-4`m\322\030(\272r\021\262]\017\346$\001\\\265\367Hp\330N\247A\305\316\325bL\365\337 \b\202\200\b\202 Dg\245I\333d\023B6\331{o\231\366\016m\247\206\007\037\023\035\327n\271\276\226*h\241\202\244\002\200!\302P\367\312@B\003\202\325\244\002(sB\367z\206uD\325nM\b\212\017\b\265\323!\335\3400\311L{\265\253>\034\315f\356T\024\030e#\322>\r\337&%DBV\214\307\303\211\357e`4Bp\237\017\212\034\b\n^\200\301E\311\302\245_M\007CY.\2174\013Y\214\334\036\207\267\337\357\375\335\355ib\017\021\036\315\322\334%\021"
+	.ascii	"'#\372%\206\315\353c\026.g\256`H0\023\304\004A\202\231 @\231"
+	.ascii	"\0023L\035\\\343\251\302&\223\274\002\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\001\001}\005"
+	.ascii	"\242\306\023\034\260%\351\f\3030\f9[L\222$IH\255\265\226Xk\233"
+	.ascii	"\265\2154B\310\226)\005\026\246%\251\245\t?8\024I\312\b\f\023"
+	.ascii	"\2420\201\001\216\241\215\263B\354\215\256\252xP\032\351j\257"
+	.ascii	"\352\224tIh\207\375v\257\277\304\257\026\2654\370\") \240\"\261"
+	.ascii	"\243\036\224\034 \264\227\235\362\242\265A\006\021\t\230\371"
+	.ascii	"p\243f\022&\303\bi\234.\346\f6g \234'e\356=\313\316I\321\311"
+	.ascii	"\325Q\200\201Jh\236\210\254\006KB\030\003\243)b\200\031%\342"
+	.ascii	"\311\310\265B\320\002pG\327\r\340\233\313FL\2303].\030\004\271"
+	.ascii	"\250pC"
+	.text
+	.section	.gnu.lto_.inline.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`M\004-\013"
+	.string	"\026\22074Po\322\030 \250(<\035\343\235\032\303\342\354\350\027\346qa4\206\200\203\036Q\221\265B\363\3243\363\023\213\230\231\031\226\323\243\327\330\255\2515B\b\331R\312\024("
+	.string	"'"
+	.string	"&"
+	.ascii	"\3258\201\237\257"
+	.string	"\372\203\334\335\335\341y\212\262\244$\321\201\375B\202<\234R\237\374\005\022\023G\006\3758\245H\004\357\271*\b\bJ\353\033vw\364n\\=`\004\251;?\244\016,\036\245\353E\n\261\033\221)\350Vd\274p\306\265m\fI>\276\030L/\314O\345\261\3266\3757\016\244\016SvGo\247m\257J\367\017$\342\353\232\230\220#\273\233Y\337\235\006\001\257mk[\352K\027\223\020\024\366\241\\Am\264hT\343\002C\344\335\001\350PX\230T\2629\bz\262\273\327\033\215\245\034&\024\322\346,\0238 \240\"\221A\333\001\344\224*\312Sd7[\313Fu\3609C\f\024\256\b\300I\366\252\036p\205@\345\261\327\224\350qP\027WTp\035\202\215,\207,&\364\356\034\210%wmF\031\224$\371\316\031\243\303\272\030B\f\002/\027\\\227\360\270`\270\2611\361<\0068\372\033\362\225\350b\207Y*p\236"
+	.string	"3%\001\f_G\263\304\350Z\177\232\376f\234\266\005]\320\273y\272uL\016#|\254d\006S"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`Q\002\365\006"
+	.string	"\"\212\036%\220'I\007\377\377\377@wwwnf\306\246\207s!\333\027\340\330\210\250\332\267\337\254\265\315Z\333\b\331D&\031T\222\2054\225>\023"
+	.string	"d\261\365\245\037(P7H\274\364\002\204\203"
+	.string	"qPGd\255\265>3\245\243~|\r\310H\352z?\217\324\361z\366Yz\340\240\362|\325\275f\3223\251\033#\337\325\361\265\251#\257\326pk&yV\201\236\365P\233\360\037\006\360(\004) \240\302\2612\017y\"\266\342\276\331l\207\025\370\32020RH\1779.\026\266\360\021\267\004|\250"
+	.string	"x\007\304!\342v\200\020@r>\006\254\2378(.\332u\\\330F\200$yw\261\376\342\270Ho&b\026\267!\340\0309\344XK(bA\270\026\373\243]\307\023DY\216\325"
+	.ascii	"M\364\n0\004"
+	.text
+	.section	.gnu.lto_.pureconst.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\230\004\016\231\004\017\231\004\020"
+	.ascii	"\232\004\021\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`K\001\205\005"
+	.string	"r\006\026 pM\322\001p\372\377\377\277\252\252\252\272"
+	.ascii	"\300n\020\3210\030\023\300\217\223$I\f\211dK\231\002\377Ogq\367"
+	.ascii	"\344\304\230\342I<\210\303\305`)T\b\224\201#\230\004\322\251"
+	.ascii	"r\t \202\206\224?\372zm\265;j\346\274Q\356(\177\264XuY~\332\250"
+	.ascii	"m\306\315\004- 0\203\031\332\034)\255h<\030\bb\301g\352\n -\301"
+	.ascii	"\224\372kY\r\022\241\200\017\007\366#V 0\334\201S\303\354 \354"
+	.ascii	")\306)j\230\031\204=\030k\005`\267H#v\007\213\211\256\006\203"
+	.ascii	"A\224\267\030(\356c\034-\340\275\227\255v\276.\013is\b"
+	.text
+	.section	.gnu.lto_.lto.5176cb9364a5d930,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.9.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\256\001\235\020"
+	.string	"\006\340oF\360\262&\035\222\312\231\377\r\016\2311\361\330<\002\n\320Q\025:\243R\030b\r\255Ur\263\246\236\332\356\257\214\274\277\002\225L8G\nc\3253\360\f\274\336\314V4\216#L\270\365;\376\035\220n\204\220M\244L)Z"
+	.string	"W"
+	.string	"^"
+	.ascii	"\273\241\002\217p\217\016?@{\344.\242=:e\013\025X\001\320\231"
+	.ascii	"\341\341\261\273\236\212p\226\251\307L3\345g3X \314c\266\255"
+	.ascii	"jJ\204\200\253l\004\033\002\372\353I\003\2522\353y\336\330`\235"
+	.ascii	"\260\271\376u\004(b,\320\346\271E\330]'\013\344pk\267=\301\366"
+	.ascii	"\003;3\277\350;7\267=\374\343\303[\265t\306\364\003\210B\210"
+	.ascii	"\344\330\255\211\371\330\240\bd\342;\277}\237\347=vg\226\267"
+	.ascii	"\260\201\226\212\335\355X\354\356\361\177\2713\003\007\251\357"
+	.ascii	"\264d\333\001\302\n\327\320n8\362\350\221\235\241\213P\203\247"
+	.ascii	"}\235\263H\335\365r\001\273\255\037\031\001\272\351_O\260#\266"
+	.ascii	"!\205*[\207\344U\244\356\324\035\210\225\302\230\016\203\002"
+	.ascii	"\267+S\342\277\260pR\321\036;%p\303\365\036_\270\013\025nwK\374"
+	.ascii	"\037\223\023?\347E{\004\321\017$z\2708\275\252\215\317\314\217"
+	.ascii	"\230\214\251O\215\025\250\212c\207\252\374h\004l\310\332\262"
+	.ascii	"\271t\267\245A\356\n\025J\371\255\240\324TB!\255\240PN\234K$"
+	.ascii	"&\244\323gBy\250\317\224\341\364I\360PN\244\023\257\364\241<"
+	.ascii	"\222\003N\301`\372\274\225\224\224\317\353\302\230k+\336\004"
+	.ascii	"\305\250**\216a\272\251\263\214\252J\343\267h\234^\307\013\207"
+	.ascii	"L\302\234\312i\362\314\374\360ch =\307w\321\036S\223\006\215"
+	.ascii	"\207\005\327# \240\202\221:\333\001\242\300\352\215\305\255\310"
+	.ascii	"QBz\373\245b\314g\232\rS2\330\352#\373rf\371\332\242U\310y\350"
+	.ascii	"3\246\246\0250\215\310\022\334\262\\p\270n\003\306\303\324\037"
+	.ascii	"\004G\023\206q\241\2275\"\200(\364Z\\Z\241ea\357\264\353\t"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.10.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\r\b"
+	.string	"\222\21777Po\322\001\2408\211Y<\207\366]XZ\006\323\202D2U\203j\304bk\b9\007\203\266\214`3\203\020\202\252\212\210\224\240\026\257\365j\343!f\274\303n\262wJ\001V\205Q\035\r\273\244+N\003uQK\233\032\265 .\3120\261\213r\230\025\325&\247\300\331\203Eg'\313\350\314\324\275!\324\200 \205\355\210\2238\271\273\n~\310\204\204\334x\364=\0203\002\275\222]?\017b\330\237\026\212\f_\3777aT\006Rv-J-\213\022M8lov\306\366{\366G\377\330^=\017\330\025\235\224\354\326\003\033\310GWi\333\357\270\307fn\252\032]\302H\205\b\313n\235\232\023\\\036\247\013\\\036a\306\271?\316?\3107\244\225P\367\371\003X\330]\277Pwq\303\333\336\330F\260M\022\f"
+	.ascii	"2\003\302\260\2268\3742\203\027c\273kx\306\004\016i\214\006L"
+	.ascii	"\020p\242G\265\322\021&\031"
+	.text
+	.section	.gnu.lto_serialWrite.11.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"U\n"
+	.string	"V\224H= \3458\035'\027\003,\341\006D\356\002\217\262\3008\315\021m\242T\254D\202\332\006\343;\321\353\247xi\345^\216o@\311\n@\b\024\240\241F\375"
+	.string	"\212\313\344\036\224\224n\306m\345N)5"
+	.string	"5"
+	.string	"9"
+	.string	"\273#\307\020\331\247\307o\260\317\354\b\330\247E{\200\302\311"
+	.string	""
+	.string	"\312\205\300\356nJr\361R\364\277\362\202\224\252tI@\261\273\226)U\310\255\267\355`\333c\377!\376\370cg\375S\245uJK\215\3643\255\265\231\331\005y\031X\327\2249\261}\315\266J;bB\374\310a\335\025\021 qi?\345*\342Y\244\037\354\256`b\002'-\031SU\016\352\300\305_@\331\356\207\307ou|#\354SjB"
+	.string	"k\274e\224\355\256\307g\021\205Y\t\t\373\2742\230\024`\231\344\313\036KRG\354kvw\255+\007\026\234\354\270\320G\024\206\274\314\\\007\343\343\201]\270\205`\267\341\201\025[\310\373\2006\016\f\267\316\202\277\214\016\334D\337\007n\332\270\327\254\256<Q\\&\365\260&U\247Z\252\033\002\016"
+	.ascii	"2\241O\034X\\p\300PJmn\351\254\322\342\316CX\351\032\020\025"
+	.ascii	"\006\203\271\001*J\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.12.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\204\001\275\017"
+	.string	"\366\335jF"
+	.string	"\221(\035\277:8\210[\212\204\377\016 \375\237(\376\007n\223\230e\340\337\221\215\246\365W \374n\326\032\022\242\364Y\351\321~\345\231\230\271\264W\004v\307\317\004"
+	.string	"\026\201\235\330\227\223t\f\341[\244\222\275\345N)U"
+	.string	"U"
+	.string	"W"
+	.string	"13\273\341\210E\270O\207/\260}r\007\331>\r\3325\020l\b\020\243\003\r\307\356vZ\002\004\025\374\224\032A\377\264wZ\257\324'\267r\351y\255\\%\b\213\013\033\217\027K.\260A!\342\264G\327k\025#"
+	.ascii	"\320\356:\266^!\356\355\266%\330\006\331\267\t?\367\332=?\273"
+	.ascii	"\345\214\2162"
+	.string	"\372\002\006\274\030\250\355\202\310\311\2615\023\206\313k\267\377\342\303\324R@+\017\020ph\330\330\rE>\355\200\373\374\307\266\262\270\f\374\3144\362cY$>\314\354\356\210\033p\237\td\fSr0x\264\257\342+\300\307TN`\027\026\237\350\321\216r\352\250\366hj8h\352c\304\016\231\236\264E\235 \233\301\2128\266+\\\206\304\355\262J\374\027\032L(\333g\324\020\031\276\360\030\024nwK\374\026\245\023gBe\373\274*Hq\023S\305\034;\\Em\261\177\200E\307\r+\314\376\354\367<\374;\217\005'G\2250\230D3\204\n\231HOT\n\241N\245\021g\021\211\205\320\350\363N\335\351\3632\214>\223\2564\n\221:\321w\352HBl:\361\276\016e2}\335'T]a\264?\270\251Q\351jj\213\017\363\b'dbG\247\272,\243G\245\272l\017{\024\342[\3364\365\r'\307E\006\036"
+	.ascii	"1\003\367\334Q\343\340\033_\031E\321\004\361\020u\026\372\337"
+	.ascii	"XK\316,\247\024\344\226\342\276\254\335Yc+\264\264\321\255M*"
+	.ascii	"B9\210\001\314\351\200\rh\242\004|A!\270\f\214\bPQ\304]\336\331"
+	.ascii	"dS\230k\264\n\n"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.13.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\215\t"
+	.string	"V\222B:0\345(\035\236\213\247\302C)\301\244\034\326\275\322\031X\364\310?\022\005\233Jfk\246\377\370l4\210\301l\024\304f\302\300@\023\b\217}\2702\354 \324B\364\223\277\367\336;\2452"
+	.string	"0"
+	.string	"2"
+	.string	"6\305J\262z\030\300\361\022`\267R\316\013\346e<\301\274\204#7\375\231\374\263<\242\200\270T\253\323\237Fbw\375T+\217\033\336\266\202m\007\373\002\0011>?\370|M\303\307\301k\267\343%`g\244\314\211\355\222\275\261\375\236\375\326WJ\257\244\017\354\262"
+	.string	"\304\354V\006/`\227\256\230m?\345*\245!)x\262Mq\027\bFc\313\230\227\017&\370\342.\035\266\233\202\360[F\030\230\311\245O\232\227\207\006%-\324{\331\365\364\240\210\375\270\220\345\371\372\007\331'\344\021u!\r\363\247S\341\321\270\254\243\035\227\2154n\202\2064\017\210~\270\216v\020\274Yd\034\025m\033G7u\357\t9(\270\341\315\213\320\017N\030\021\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\q\3062\327p\221\t"
+	.ascii	"\034\250\361*0\361\340n\217j\305$L2"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.14.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\255\t"
+	.string	"v\222C<0\345(\035\200\213\307V\035\376\266\213:x3\367W:\003\213\036\371\027a`M%Z\264\372\373\\c\rb0\033\005\261\23100\320\004\242N\213R\026%\340\324\263\034i{\357\275S\n2"
+	.string	"1"
+	.string	"1"
+	.string	"\246XIV\323\305\261\341B`\267R\316\r\346e|\301\274\204#7\375\231\374\263<\242|\fP\255N\177\232\210\335\365S\255<nx\333\013\266\035\354\017\004\317\017>_3A"
+	.string	" \004\330\355x\025\330\031)sb\273dol\277g\277\365\225\322+\351\004\273,\0011\273\265\301\f\330\245+f\333O\271J\311\001\360d{\3420\240\227\214\rc^>\250`\213\267t\330n\352\301w\215.0\223K\2374/\017\017JZ\250\367\262\353\351A\021\373q!\313\363\365\2171\331'\344\021u!\r\363\247C\341\321\270\254\243\035\227\2154N\202\2064\017\210~\270\216v\022\274Ud\034\025m\033G7u\357\t9(\250\341\315\213\320\017N\b\021\222\n\016"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\u\3062\327p\222\t"
+	.ascii	"\254\250\361:0\361\340\256\221j\305$L2"
+	.text
+	.section	.gnu.lto_serialRead.15.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\346\322C:0\345(\035\200\213'\205hR\300.O\036\"\256\231\016\033\033\356I\312u\364\327\252\325\337\357\265\330 \006\343\025\304f\302\300@\023\330\270\023\363e9\232\204\271\352\311\337\233l\231R2"
+	.string	"1"
+	.string	"2"
+	.string	"\332\007\346\245m7<\230|z\030\302\232\036\033\0310"
+	.string	"\273\341\026A~\272\236\374\247<3\341\210Y\265PWM\304\356ZW-\215;\336\266\202m\007\373\016\236\177\375Y\246\326\250\276f\226\314\030\270\354\262b\001VF\302\220\3306\331\033\333\252\366O\216b\372\253t\201]W\313\313n\310\340\005\355\322\341\t\346e(\333\240\303<mW\325\361Y.*H\363R#\202\301\257\220\264\335\355\370*#\013m\344\322/\315\313\307\002\221WJcv\210\322\370a?\333\335ut\005\334'\344\021\201\241N\363\2073\341\351>\016\334\300\217\033u\237\304\026\352<\240\355\363\201\033\347\300\036\005\367m\"\317\373\266M\270\367\214\t\251\210\341"
+	.string	"\315\2425\316\b\321\241\212\001\n"
+	.ascii	"2\003\302\260\013\314%`oJse\031\313\270\214R\324x\250\016aL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.16.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\265\n"
+	.string	"\266\024KA0\251(\035\210.\177\006)\245g"
+	.string	"\355!Y\366\256\3053\030:\354\250S.\\\305\306r\036\304o8\213\354\332O\216\321>\002\3206A%\025fB.\024\257\270j\345W\022\332\177t\177\262\311\336)\0055"
+	.string	"8"
+	.string	"9"
+	.string	"a\205)\350\247\303;d\237\364\r\331\247A[\302C\002\373\324\t\211\212\302\356V9\340\340#\350?\365\n\251$z\244`\354\256#\251dr\313\333\236\260}a\277\006G\375\363\247\037\303\242\243\214>%[A\200\230\260[\362\252\260\255\371\300\200\355[l\307\360\t\300\243>\\\331\r\340\262\240\237\022\330\243\375\003G"
+	.string	"\376\024:\303\256\251\301j7\322\026"
+	.string	"#Rd{s\006\035\335\025\301\370\013@<@\331g\224\017\021\374]\001\210\356.\306W}<\264@(\373\274\224,\007\256\323(\276\354P\024\245"
+	.string	"\373\330\356\256\245\311\016[G\323\320x\264\r\272e8Z\347\343p\324\231\013\207\306y\333W?o\373p\236\246r8mS3\336W/\021\356:6\257v\272\316\253\226p\217\25549\203\325\032\311\020/\304)1\351\030\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.17.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"vRC<0\345(\035\200\213\007\323\253\007\315\321\245\024\213:\334T\310\245c\303\375\2502\345\020\215\355\365\037\237\215\0061\230\215\202\330L\030\030h\002\2059\017W\006J\302\351\t\217\264\275\311\226)\0051"
+	.string	"1"
+	.string	"1"
+	.string	"\004\362\321\266\035 H.\375#Q=\304\244\303E`\367\233p\344\245k\311?\313\261\224\017\001\251\225\351\252\231\330]kj\345q\303\333^\260\375`\337\001?\206\251\025\252\257\2212\001\016fvU\257\002\013 \306\240\330&\331\033\333\252\366U\276Bzk\364\201]\326"
+	.string	"\230\335\257\301\f\331\243\277\027\310\307\354\001\320d\273\342\256\317\313\006\247!\037\025&\030\343.^\266\213\212\360[D\031\331\311\243?\222\217\207\006%\255\223\276\354\317\244P\304>\266\273k\310\262|+\232\007\324\ty\240-\263\207c\321\331:\315\233^\247\211\266\216b\202\266\316gz:or\020\314]h\335\fq\\77\337\336\022*\234 \2077\212A+\224P\002\004\025\013"
+	.ascii	"2\003\302\260\004\346f\220\035\330\233\322\\Y\3062.\243\0245"
+	.ascii	"\036\252C\030\3235\311"
+	.text
+	.section	.gnu.lto_serialSetMode.18.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"u\n"
+	.string	"v\024I=0\345(\035"
+	.string	"\276\334{z\271\224S\200\234p\251oQSj\270A\374\022\2066\260&\2525\334\3077\335 \006\343\025\224\354\206\201\001\f\264\026\322\242E\232\314\350\b\035O\032\331d\357\224\0024"
+	.string	"7"
+	.string	"8"
+	.string	"\f^\340N=\276`;\345N\260\235Z\264c>\206\354a-\215X\200\335\255\023\344\342\245\350\037\366\215j\205\272\324<\354\256\245j\305q\317\333V\260\355`\277\006?\275\353\3274i9\245\257\331f^\016Nv7f\003VF[Z\266\317\261-\307\227\210\177Ux\263\353!\323\300\235&h\227\366GN\"\336u\372\300.Keew\f\035\031\023e[\364\224\217\333\305\360\370(\026\023\246\355TN\003\030\20771q\273\353\361c%\nN\344\264\235~N\026\027\001\256\224\234\331#J\316\017\373\332\356\256'\313\376+]\350\023i\035h\364!\205#\2173\250\023\361\361\300.\254!\330\225<0TG\336GTA`X;\b\376$:\260\222\276\017\254\234q\257\355d\031\002\200,5/, \351\324\246\3454'\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialSetCtrlLineStateCb.19.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\n\001\265\f"
+	.string	"F\327TA\020q\233\016\030\0020}_\354I\200\374\301\3030\205\316.)\200\003\356'B\340\257\215@\251\321\210L\017\371\335Q\0247\362\265]T\"\240"
+	.string	"\n-\310\0330\347"
+	.string	"\200/\036E\361\177O\2156\2212\245?"
+	.string	"B"
+	.string	"@"
+	.string	"\323\243;;\307A\023\3730E\303\312\216\335\265\264\304\273K\232\235\377\360\227\222\017t\t\304U\312\230\300\030\t\370<i\301\be\304\303'\207\217$\223\342\354\256\263\344\363p\307\333v`\233c\377\023\237\036\372cL\247\224\376\205\nQ\343\200\216\335\016-=V\024g\240\260}\214mU1\016\226\006\t^00`\275p\303\346i?\345+\272\207DN`\367\204F\214]\220\201\025T\217\006_`z\254\236\tS*H\310\342%\017\333\021\376\302S\355z\033\337\005\206\3543=\246&\270a\ng\361\251vw\343\257p[uBdz\274\306\0246T\204F\262\305\006A\251$\354K\273\273\326\023\373*?u\360\001\234\005\214\013\311.\n\344JN\313\036"
+	.string	"\360\245\221\360\321\321\260\315\3324\254BG\203`\205t><\326\245m\226\006\201\263\t\230fqY\246Y\030p/B4\242$\022&)\2354\252S\035\240\305\007Q\006\005\345\b\305D\206\332\023\032"
+	.ascii	"j\231\"34\030\271Y\200\330\rJ1\313\032\325,\b\214#\304\"\023"
+	.ascii	"\206R;b:@n!pL\b\353\032\233\016\343yU\016\\\001s 0P\"\030\021"
+	.ascii	"\240\242\210\273<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_serialSetBaudRateCb.20.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\t\001\255\f"
+	.string	"\366VTB\020q\233\016\3600"
+	.string	"\027\344\222\037Tp\315\223\212\036[\271\323E\262\360\222H\313\013\262\262\231(\320\353\3459cQ\0247X\316.*\021P"
+	.string	"\205\026\364\034\2160"
+	.string	"\240+\017qf|\373n\264\211\224)\005?"
+	.string	"B"
+	.string	"?"
+	.string	"\217\356\354\031\007;\354\303\025\025Zj\354\256\245\034\336]\322\354\374\207\307\240|\240K\031\256\322&E\305\b\300\347I\007F+\032\036>-|'\231\324\307\356:Q>\fw\274m\005\266?\354\223\004\007\377\351\241?J\351\324\3641\224\b\030\034\032\273\027^r\254(\272\370\240\261}\226\017\201"
+	.string	"\353\205.\t\022\224\200\243\363\264O\342%\272\207>\027\260\253\362\202\305.\210\300\006\252G\203\0370=V\337L\001\316\246\324\220P\206\2277l\213<EV\355z\035\037\305\204\007%\323cj\201\030\336n\242\244\332\335\216\337\302A\250<|\246\307k\004\341b#d\222/6\bJ\335`_\332\335\265\252\330g\371\251\\\004\214\033\311.*\344JN\313\026d|y4"
+	.string	"\361h\330fm\032F\342\321\030X#\036\020\021\353\3226\313\203\343\314\001\246Y\\\226i\226\006\334\217\020\231\350\211\224IJ'\215\352Tw\234\b!\242\240\240\034\255\244\264\320\033"
+	.string	"j\231\"34\030\271Y"
+	.ascii	"\330\rJ1\313\032\325,\b\214#\304\"\023\206R;b: n!lL\b\007f]a"
+	.ascii	"\315a<P\"\030\001\341\202Bp\031\030\021\240\242\210\273<U\223"
+	.ascii	"S4\265\007"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.21.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"}\t"
+	.string	"v\022B:@\3056\035\340\005]\363\317@\327\022\3202\307\277#\t&}D\277\200\321\215y/9GS\3428F)\245\300\245\2048\216\202\373\312\235\0175}\031\340\027\214?n#m\313\235R."
+	.string	"2"
+	.string	"/"
+	.string	"7\250NY/\250N9\264\005|\f\331\203V6D\246\335\275\024\344\341e\350_t\001\261\303\271\264<\354\256\245\330\351\270\365\266\025l;\330\327\024I\304\366/\266\325\344\240\360!\253\314\201\315\360\020G\273\213q\203u*a\312\321\302\304pi\177\344$\341?\016p\202]O\311hw\304x\301:\3451\212\341JNU\225jo*\344E\313\023\224\222\206r\354\221#\365\303\376\334\335\265z\354\207\376\371\361\327\177~YYH"
+	.string	"\020N\273\034\247\001[\n \267\3512\n\0031\315\3242\016\003?n\263\234e\"\260\315\323\276\353\3634\212\315\323\\\334\206I\\\231\367]\231\003w\023\232w\201]\347]\227q?W=\206H)]\004\016"
+	.ascii	"2\241\017h\340\341\302\033\327\200\001\033\235\022b\300\225%"
+	.ascii	"\214\013T!\270\f\214PPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serialBeginWrite.22.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"E\013"
+	.string	"6\025NB\020mj:(<\202\360|\211\005\370\f4\316\345\241a2p\224.c:\257~\273\247K6?\203L\027^\374!Asz\353\034<"
+	.string	""
+	.string	"p\005\024"
+	.string	"p\210p\036"
+	.string	"\f\004\213\302AD\310\322&[\246\024:"
+	.string	"8"
+	.string	";"
+	.string	"\037\035\354S#\016\250L\354\256&\033\034\374%\025\364\217\272D$~~-\270\274(\243\013,\0131\2746X&\006G]\021\210!\325\210\307\356ZE\242\202{\336\366\207\355\016\373\226kI\262\177\372\247T\253\252\037\211t\370\220\001b7A+\305\256\346\006\b\023\333W\373\021.\001\374\311\363\213]\022\206\f\273#\2075\262O\217\307\300>\263S\260O\2036\211\336`*AR\"BEa\273\273j\223\355\206\027\277\202\201\257\203}\252\254\204\360\200S\350d\273{\361'p\nd\017>}\017\366y9\305\022'N m\331\343Ge\311\376\265\273\001[F\203\341|\032.s\306\002"
+	.string	"\303y\333\247}\336F\200\363B4\r\207\t\240e\274O\263T\334\t\330<\215\323u\2366\031\367\036V \031\272$:\245U\272\302\002\207U(?\3122\2154HY\262\003\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialEndWrite.23.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"-\013"
+	.string	"6UM@ M5\035\334\332\006\210\001MZ\004O\020\\4w\002\0031'L\344\022\314[\007\302/\002\205>\215\323\243\215\025\003\001\022\023\020\220\310\302\265\234\347\2064\377\f\350\253|`=>\267\245M\266L):"
+	.string	"8"
+	.string	":"
+	.string	"\037#\354O+\005(\022\273\253I\b\007\177I\005\375\233\016\001\211\235_\016./Ih\203\252B\f/\r\025\351\301M\327\005\342G\365\321\261\273V\220\330\340\236\267\r\3006\207}Jk)\262_\372\247T\253\252\377x\260@`|\330e\3202\261\251\351aB\304\366\325>\205W"
+	.string	"_\342\334bW\244\201\303\356\270\341\214\354\323\343/\260\317\354\022\354\323\240=\"\316`*\003\234D\204\312\262\335\035\225\311v\303\212\217!\301\267\301>UNB\330\300/l\262\335\255\370\0264\b2\t\237>\007\373\274\234\342\211U\311\243-{\354\250\034\331\277v7\333\005c\321|\030.\363\2052\300\302y\333\247}\336v\200\363\004h\030\316B@\273x\237F\231\270+\260y\232\246\353<-2\356K\244<\362sAtJ\2534E\206U*\224\035U\221B\035\244\034\331\001\021"
+	.ascii	"2\003\302\360\314\302\242mP\210YVh\253q\310\034c\002VjGL\007"
+	.ascii	"l\231 \nF]\302jV\243\305]\236\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_serialReserveTxBuffer.24.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\243\001\245\020"
+	.string	"F\237pG\340\322&\035\240\3314\234O\342H\002\304T\256\231c\3276\274\202\244\307\221f*9"
+	.string	"\217T\213\374\272\253\031\250\255F\270\243\314\265/\304/\371\260p\f34\177\271\317!\020?\006\346=ZD\210\352\001\361{o\271S\n["
+	.string	"V"
+	.string	"_"
+	.ascii	"'\332\245m?\305a8f\231|E@s\246\241g\026d\367\333\374\375\300"
+	.ascii	"\274\324^`^j\211\263.\243B\226\237s\031\t$\321\340)q\355D\224"
+	.ascii	"\243\242!<0j\036\256\221A\215X\216\022W+\312\227\212\241\313"
+	.ascii	"\016\177\\;\020\002X\331]C\037\027\320=o;\202\355\007\366\235"
+	.ascii	"\002P_\366\343\356\256\225\310~\354F\035\351\027\371\367k\206"
+	.ascii	"\216\023Z%4\214\320'"
+	.string	"1\3004\024\342\265Aw|\313\341\311iqH\030'\036\373m\034_\346\021\3331V\334\240o\201\034\030-\301N.\335@?\033\023\001\333\222\371(\200\360H7\037\260Kdci\367Cq\232\212\250\241\242\364\260\030#\232\230x4Gg\310\370\340\212\372\372Q\314bB\332M\250-\262\036-(\3046\314_t\332nK\305w\221\241B\315\274\204\232\300\3102oQ\243\342\263\240\240\322.\375\033\225$\222\232\220>3\375Yj\006\362\330\335\233\360m\346\245\210\016GC\260\037:\360\311\376r\002\036\367\362r\241eN\240\201Iq1\223sI\261\320\254R\235f\227\224\030\226\316\343V\333\312\3430t\236\204-\325\261\310l.\336jKA`\225\005\316\333hT*o\033\371\366q\225\310\001^ z\224\"J/;\004\035AIJ\352\263f\324\037\333Q\275\242\243;\362+\256z 2\037\252\013\214n\374\b\221\300\037"
+	.ascii	"B\204.\337\302\257\315\276\220\227\205A\313\032X\030\032\023"
+	.ascii	"3&2\315g\326*\277\300AK\f\245vdj^Kl\243N\023e\345\321fl\326z"
+	.ascii	"\304\205\247mV\026A\364\013\341}5\004(\f\206\001\025Z\361\223"
+	.ascii	"\243\002\227\005\306\2401(("
+	.text
+	.section	.gnu.lto_serialCommitTxBuffer.25.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\215\n"
+	.string	"\226\324I>@\305(\035\320\351\236\357\313(\371N\324\366\017\271|\313\rH\263D\312\360\016\301\004\267Q\264\2172\034\026}\320\232\304\031M\262\350Ua'P\307\340r\315T\030\201\216\373\2374\262\311\336)\0055"
+	.string	"7"
+	.string	"9"
+	.string	"c\203\031\266S\2177\320N\267\027h\247\026m\003\037K\366-\220\216\326\201\335\255\223\344\342\245\350\237\345\031T\312t\211\201\330]KT\352\343\236\267\255`\373\301~\rg\375\364\253?\313\244\345\224>F\343\"\260\020\333\365\210\301\366E]'\266\277\261-\307\257\210ga8\263+\002s\330N\023\262K\373)W\021\277*\235`W5"
+	.string	"\300n\323\233\020\216i\262\035\372\313\267\355nt|\227\f\013\222v*\347A\001\207o!m\273\333\361[\243\213\315\244\244\235~N\227"
+	.string	"\224\325I\306\354\321$\347\210\375lw\327Se\007\024\242\t\217\003i\334\307\363\210B\257\333\374\341\200<\035\310\2055\004\271Q\007JT\257\363\204\352\007\f+\007\301_\005\007V\321\367\201u3\356\263\235*G\004x\235\246\2065\222\316lZ\006\017"
+	.ascii	"2\241;\034\030\270P\224\332\021\323\001Y\013\241`B0\327\330b"
+	.ascii	"\230\027\204\317\324(\270,M\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.29.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`\345\003=\033"
+	.string	"\2462\256H\260XQ:\320\001\030O!0$2\305U$%;@\002\305Z>\034\371\207\332\242,\024Q\343\023v[Z\\OI|\365\301\016\230\217\352Xh]h\275qc(R\271\013\374\203\303\370\364\214\003\330[k\204\220M\344N)\223"
+	.string	"\237"
+	.string	"\224"
+	.ascii	"Hl\213\304f\306\301\234\367\335n\004\350\306W_\020yN\373E\236"
+	.ascii	"\204\273\021\240\003\250\325hI\260V_\316\251[\345\251}'0\236"
+	.ascii	"\226\0270\236\332\037b\373f\207\271OG%2\316\016s\263cA\r%!Sk"
+	.ascii	"u\235n\016\257\311\341p8\274\350\273\307\305\235\034\251\270"
+	.ascii	"\263\304\371\007>\305\242\027tr(7G\325\217\030\2476?`\\\024\311"
+	.ascii	"\235\213\0365\275\235\030A\030\325\364\340'\257\247\233+\340"
+	.ascii	"\263\300K\262B\255\325\317\311\270S\267}\303\366\005{\305\004"
+	.ascii	"\363\276\377\003\256\200F\255.\206fj\021m\362q\246S\261\fGg\303"
+	.ascii	"B\207\004\025Uu\276\226\355c\331\211\006\254P\372\361\\\247\207"
+	.ascii	"\362\265\357K\371\223\317\2378'\210\020\037{\305\344N?\177\342"
+	.ascii	"GA@\344P\334\340\301\355M4\234 \233*\364\005\252\301\203\237"
+	.ascii	"7\321n&D\231b\241<\365\231\276\304\017\336I\023\333l\001}'Ml"
+	.ascii	"\025\204Vd\020~\211\252\325\327:5\205\362g\372\300\233\275ZY"
+	.ascii	"\234_\272\371j\217\310b\222+\341\256\304N\242M\325\341h\021\254"
+	.ascii	"\265J(Oq\304\235\377\005<\246$\215K\356\301\f\235\361\263\324"
+	.ascii	":\370H\276m<\0357\025\204\2117#7\207t\225H\331\365D\313Fq\037"
+	.ascii	"|\200,C~^tSh\002\363\353]q%\024\3516\310\303\261|\200B\001\242"
+	.ascii	"g<\335M\260\343O\016q+\"\312Zu\020\374*)^>\022l<\235\373\247"
+	.ascii	"/8\242T&)7\207\336\213\265\326\272{\344}\004\035\302\250\271"
+	.ascii	"F\336r\024\016}x\215\354\377\376\232/\3754\254\325\227n\025\315"
+	.ascii	"t*5]\212\323$kz\244\253iQ5\275\251\351$`\323\304k\261\037\031"
+	.ascii	"\214\276"
+	.string	"j\257\021\342\016,\366\252\321b<\245a:%^<\263\035\232\2136\3339\3013\033\341\212\361\274z\\\260\031\315\245s\3002\023;3WM&\233\271V\266\347\327\bx\fe\260\344V\210\334#\223T\312\032\027\220\262\226.\317bI\2634B\272Z\325\362ZW\355\034\363\273\262\247\200Chc\334#\333\fN\227\265\244\026\025@t\256\332U\316\030.*j\b\315\241\rLr\277N\255WE\273\r\322\360.\033b R[\300\213\223C|KOYk\205\340kI\301\001h\357\364\007Q\250Q4\246\034\"\304\231\t$\222\231\031\247\003p\002\231\272\272\r\020hH6\035k\372\201P\002\207]\364A\311\\M\212TV\234\300\217\n(0\nF\267\210\265_\222\007\303\002\22784\320\240 \276\231c\220\240mZ<\201F\335cA\3420H\2773.\323\202\t#\326\003k\031\326\030\220P\037E\211\242l\201\220N"
+	.string	"\225\237"
+	.string	"\224.E\203KA\264D\b4\322\342\322,\357\327\214\304W\204\210/%\316d\360\025{Q\210\374t\221\224\330\234"
+	.string	"\317;\345qx\277p\003\302+\032\215\016\266y\326ku\206v"
+	.ascii	"\323<5b+P\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`i\001\265\007"
+	.string	"\204\ne\002"
+	.string	""
+	.string	""
+	.string	"\002\035\177)\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \t\177*\360\372\2508\272\200\202\n\177+\200\200\200\200\004\013\177,\f\177-\362\375\231\027\r\177.\016\177/\017\1770\020\1771\021\1772\022\1773\023\1774\024\1775\025\1776\026\1777\027\1778\030\1779\031\177:\004"
+	.string	"\265\006\004"
+	.string	"u\004\001\221\205\327\307\003\001\225\001\004\003\225\001\003\004"
+	.string	"\342\001\004\004\303\376\236\020\005u\004\006\007\b\t\n\013\321\231\263\346\002\f\003\r\004\"\004\016\004\017\020\221\226\324\325\003\001\265\001\004\021\200\200\200\200\004\001u"
+	.string	"$ "
+	.ascii	"\243\251\233\003E\301W2\370\214)\320\035\206B.aO\204 \227'\343"
+	.ascii	"\\\020\301\257u5\253\343\353w\310\245\013\243\307o\370\006\337"
+	.ascii	"\360\215\337\370\215\337\350\033\3637\346\033\342o\370\r9b\360"
+	.ascii	"g'\200\232\370|\207\310\314\301\031\003"
+	.text
+	.section	.gnu.lto_.refs.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.5176cb9364a5d930,"e",@progbits
+	.string	"(\265/\375`Q\036\255}"
+	.string	"\252\307\244+R0\322)\245\003\337\np\246\325\326\033%"
+	.string	"\344<&!vg\b4\273\027\355O\2735E\263\315\bA\202\271]2\216\302j\277E\204\226\354\257\352\335\215]\366\3448\206[\236\231\006T\325\016\n\025q\205\212Z]0\214=3q\326y+Lm\335D\312\024>\002\242\002\274\002\f\004Y\333\227\2720`\233\322\0325:\274\211\271\251\273:\372r;\213\341!c\367l\322\226\303\360\230\315\224 \307\266\334v3!\360\374\234zG\263NeR\330\332>\307\372\250\f\353\317_\324r\212\224Y\203\246\235\325^&\347\n\210\221\253\355\361p\334\322\244\021k{\031\353\271\234\321\316X\315\036Y\337\226\363\331\257\342\0026\013\336\213\200m\322l[3\353\322plI\310\266L\306\\\330+\001.\273\212\013\256\032\275.\227\216_\024?\276\266wa\375\037'"
+	.string	"d1\036\273A3\203b2\246EM\373\001\006\253m\026;\225\345L\255\355KX\275\030\013_\211^\021\301 E\246\344\332\276\203\365x\307a\341\007,5m\177\266\302\\\034\246*\223\234W\354\336\250\317z\245\214\033R[\246\302Q\366*\301_g)\203\035'\031\275\322{\243<8qh\252\304\332\216\340\037\240\305`=W9\001^\367\202\003\260\236K"
+	.string	"y\270\004\360\275\336-\312?\300\225\003"
+	.ascii	"\016\001\t\035\201\253\003~\025(\0029\260.\033\376\233\375<\301"
+	.ascii	"\317?H\374?{\227\377;\277\252\203"
+	.string	"\202(E\377\323~6q\265\347\374*\021\324o~U\206\377d~\226\340tZ1\376\363\375\374\300\327\314\360\302\317\352\317$\330b\265\360\363\316\317%x\202/\376\307\375\354@\n?\013\360s\212\237\020\277z\002\320U\t?\213\370\031\202\002F\370\371i\312\177\267\237O\\\314y~\025E\360W?\370y\306m~\325\305\317:~V\340g\0252x\201\034\357\371U\r~\356\372Y\312\317Q~~\362\363\326\317Z?g\375\214\3653\222\237\217\374l\344\347\253\237\211\374\f\365\363\363\347!?W\375\034\365\363\217\237\227?'\375\214\364\263\217\237{\374\254\374\231\307\317G?\313\360\263\321\317\311\237+\370\371\306\177\271\377B\377\365~\376\377\262\3770~F\376\007\373\371\370?\354g\343\317\367g\035~\316\341g\034~\276\341g\033~\256\341g\032~\336\3613\361\347\031~&\372\331\202\237m\374,\364\363\005\3775\370\017\346\177"
+	.string	"\177\177\177\177\277\275\373U%\377"
+	.string	"C\002\267Y\353\255s\275eZo}di,6P-/;7\236\240\237\024\270!mo\215\353\325\273\365\252\334z\365\313zu\354\007X\245\275\242\326\310\314\354\210\223*\035\005\276u\335\260\246\362\216fm\021C\244mOa\274\277-khm\221\254W\247\272\207\025\252\310\321\256\355\325\344z\366\352(P\372\226\264Ay[\032s\363x\330\352-N?\263-'a\366\216\370\265\215&\241YIh[ \252v\"\331\246KP=\345\0039\267\324L\375\004G\346\351N\357\357$\235\325K\032\253\265ZI_\365\221F\322Ez\207f\322F\272\t{5\264\207\274\237mu\021\321{\223\367\3363\027\033\277\365\371\300^\370\213\222\2470\232\017#\037\32358\256\343\203\372"
+	.ascii	"\206\277\260[T\317M~\375A\273\210\360\034\017#\244)\217f\262"
+	.ascii	"8b\342\034\301\231\231\262_\033\335 \367\200\200\364\024\273"
+	.ascii	"EE\357R\0162\314\323\235\036s\375l\307e\270\017\001\244\362\332"
+	.ascii	"/5OwP\356\215\276\202\277\217\240\335\3449\026G\314\233\374\252"
+	.ascii	"\242A\021\266\247.\275{\243&L\230\020a\302Fo\214\223\223\002"
+	.ascii	"\366Me\275\271\374\003\374\264\2278[\310\016^\220'W\035\344-"
+	.ascii	"d\005BoM\217\266]\305c\215u\006\325\244\213U\232:\262\266\357"
+	.ascii	"\347\372^N\265TT\337\022\266\250\267TX\260\b\234\022\253\266"
+	.ascii	"\314\367\324N*\342\240\313nz;q\227&5\257+\236\256=m\353\337L"
+	.ascii	"\245u\017\255i\317\307[\251\227:\\\236\222li\333\313\356\244"
+	.ascii	"\376\361^6R0\031\355\245\275\367\310\314\300\0163\0036hY\307"
+	.ascii	"/\240=\247"
+	.string	"\255\307\353\036\301\250\361\226\351\036\255\3049SG\227\214\356 \201@\215p\255#\336F\235\324\331\022\204\211\221F\276\223F#\266\276\266}\3441\036\272%T\252\215K^\2704\333\366\345\311[\336\305\355\260\362\337\255\227SG=>\261\221!\351[\023\242J3\251\214\357\274\306\036\211\301:k\313jr\300\276|\374\265e3\274\207\206\311\214sO/8\205\225F-\357\254\327U\027)\331\226\323\334\316\006\311\222\021\r\343Qi\022u\325\226\247\034\004{\221\3403g4|w\233c\364F\033\253\357\312W\333\036\376\0016;\3273\t\240\372\367\307$\200\307\273]\b/I\254\332\332\236\227k\212::\0352Jx|d\316t;VY\314@\333\362\230\270\244\264!m\371\007\236\333kBZ\233\223S\231$\243\214\342\316r7S\263+\\m\003\375\003\357\221y\357]\262\211^&2\bd\033\326a\225\033\370o\257\372\337"
+	.ascii	"\020\3565\222M\357\326&dG #\356\357vo\362i\354\340\331L>\241"
+	.ascii	"\224\322\3475&\227\030}\230\367iTJ\357\365\271\311\244\321\003"
+	.ascii	"\347\365QJo\363\032\2755\371F\237\306\233t^\237\233\274\307\021"
+	.ascii	"\312\344\263\251\224\036\233>J\351\263y\245\317\333s\223Gf\217"
+	.ascii	"\344e\372\\\3513\210+u6{\224RgS)}J\361\232R\356Ks\313\324\252"
+	.ascii	"\212\215\312\344\375\261\244:2{\334\224Q\347\235\273\227\305"
+	.ascii	"\216.\263\201{\251\234\314\271#\024sA\272\375@j9:\013X\"\255"
+	.ascii	"\2347\351\246t\342\274\327\t2\206\273\264\300\030u\273H\330\315"
+	.ascii	"H\204\352&\035\335k\300\362^#_\267{\257\361\336{\303\244\212"
+	.ascii	"\336;\325\243\204.\227\367F\211X^*c\331\321\275-F\206KS)\265"
+	.ascii	"r\002\225\205I\241\227G\324\310\320;\367d\256Rc\225\233t\357"
+	.ascii	"e4+\264\311t\006\355\214\355\254\300\306\264U\231`S\242mW!Xo"
+	.ascii	"[}k\202yxE\352\214\222B\250q\tS\351F*uudN\016\230\314b*\362\344"
+	.ascii	"\304t\213kkk\237Z\306\374\265\275\301\213\016Q\266\025\022\305"
+	.ascii	"\231\212m\245Ey\250HF\353\343\031$0\365\370\245\004[\025\232"
+	.ascii	"j\344\272&B\207\227F\275\334\227\363\003\323i\364\327F<WS\274"
+	.ascii	"+~\314u\231\244\302\352\3439)3\271\2745OE\376\256\220\370\370"
+	.ascii	"\r\270\245\245\211\232\022:{qH({z<R\232\256\224\\\036\2342\276"
+	.ascii	"-\247\266\215\327i\336y}w;\317\002\347\275\307\316\343Ys\357"
+	.ascii	"\221\207\231\001f\006l\017VZX\200\366\026\016\2153\247\313)\005"
+	.ascii	"\352L\020\366I\022#^D\330@\201\202=M\315\250>\272\356\310\242"
+	.ascii	"\\A%%,g\231\251:&iMm\327uU\321+dm\263\204\270S\304\330\272\372"
+	.ascii	"K\351+\311\024\314J\020h\230\020(\330\021-@\246OZ\312\017\270"
+	.ascii	"\254\226\376@\\\332\f\013\334\222L\t\b\255\323\230\220>\326\270"
+	.ascii	"n\2075\306a;\311\236\233\264\232\202\212U\255\365\225\316\202"
+	.ascii	"\004G5]\353/\334E\215Bo\254Xi1\330\026\016S\2530W+_Rm\035\327"
+	.ascii	"oM\327s=\246\311\264[\207i\271\026\323l\375C\003\321`\032\216"
+	.ascii	"\275z\215\257\234\273Z\r\250\327\372\254\215;\311\350m\346 \223"
+	.string	"\236\356v\274\224,\243\r\330\333\264\025x\371'\315\213X\225:2\226\211\034\231V\373\320C.p\n\334\221/e\353\255\226\356\022t\262\244\264dJ\227Y\036\326.~>hac\030\303\213"
+	.string	"D\274\320\201\341S$,\322\320b\207"
+	.string	"!\370\024\207\206D\024>c'\305\211\"1\350\306\211\0328Z\374|\306\220(\034\022\302\260\336\202\025\024\254`\261\343\346,2H\221A\n\340Yd"
+	.string	"\004\224\301\n\240\365+\200TbP\f3,Q8\2541,\016\ti\fsr"
+	.string	"\2054\210lXa\214\023t\212\206\210\206\305\033D72Va\r\303\027kq%\006i\004\tE\020\032\006\301(\006s\f\2053D\344\004\025\203<\330A\334!\026Q\030\341G\206\031A2\204\204\202\\\b\205h\f\203\217\001\201\023\335\020\022Q\024\211\210\210(B\024\2076l\020\315\330\021\n\311\b\202\301BO\b\030\206\206\305aP\013;T\020@($\202\260\003\206PP\221\b\006\215 \241\n9/|\204\210\210Z\304\260\241\241x\303\306\007\305\241\215\242\241 \"\214\027E\303\003\2041\210D7r\2044\210J(\n\213n\2121V"
+	.string	"\025_\b\207\206$\b\021\213.\212\302\""
+	.ascii	"d\270\020\026\203T\240\201#\250EQX\244S\003G\013\035\353\320"
+	.ascii	"\020\006\241\214\034aqHl\201\306\220p-\306`qS,\212Q$\022\241"
+	.ascii	"\020,\306PQAqh\210c=\020\220\213\021+\230\020\302:\343\204P\320"
+	.ascii	"\220(,BQD\024\346\030\022i\240\030\032\006\331@1\203X\204\342"
+	.ascii	"\304\001Da\215\0328Z\354\200!\314A\024\026\t\211<TT(1-Nym\325"
+	.ascii	".\265\213\345D\230\271\321\235\351\255\371P\327\024\265\252R"
+	.ascii	"T)|\006\2264\325q\254\2729F\211\302j{Ia^Wh\236<a5:\350R\020H"
+	.ascii	"\336v\330A\335j\203\006\247oqdN\256n\335\200-\373\232\332\252"
+	.ascii	"Mn\027|\362\310\363k\2532!\323\322b\2721k7UF'e\315\312\3425\353"
+	.ascii	"\345\202\252ti\370\234\236\253\212\245buRkj\263t\225\244\326"
+	.ascii	"\2646\217\346\321J\353\025`\313Iw\246"
+	.string	"\367\304J\017J\332v\263\233,\307\301W\225\205[B\263\322L\315\324N\r\275\t\263\212\232\332\340\2211\222\266U\257\324\253\226\202C\202\002\307\244Q\031k{\340q%B\244\245\330\217\207\210\237\224\236\335\332TM\325Bz.\262Nm\265jB\362\322V\210\020u\bN\324\006N\264Ls\274\344\326\030\251\316\253Cp\214\304-\223\300L}J\255Z\357\275\352\275A\270\240:\300\220\220\250TW\253\230OQ,mU <\026\314b\345\357\255\367x\236\360!\305\221\255Kj\324\222\n\005\274\227\243N%\346\215b\226\270\312T\233W\231\274T&\025j5\336k\214^%\3162\245;\323\273QQ%jd\t\363\245>]\205\322\271\332\353R\325Vu\312Q\302\213k\322Vm\352\251\316\237\232?\251\215\325z\233\345\372\007\202\226\250\202\331@\307\002\231!efDDF\222$\215\001R\013\020\204\202q\032k\327\001\022"
+	.string	"\004ARB\252\214\320\210\210\242\024$%\245\302pb\210\256\373O|\304h|\215W\246\360\003L\276a\267_v\305\022\033=\2247\200\247\215G\256\320\331\304\024\370\205\255\343\215\363\n\007\320\035\033\330\034\331b{\315\355Ws\373\036\016\t\376\313 u\270\376\r\270>\300'\222\236\225&\317\376\212\271A\340\261\025o\027\035+Wp\216\320\236\355\2022B8K\203\243\237\347\344,v\217R\213\376\276"
+	.string	"\334]%\241\035#tA\211\024\241\013\237\343\r\213k\335*\246\3525>2\224\251\260\rz\337\256D\351\025\357\026-\200\211j\325\366\324G'g\233nh"
+	.string	"\264\0301\305Z(1\007\372,\244\376I'L\3246#\2414\235\323\212+w<\353q.\307aX8\344\300y\252\"W\352\334\321\301,\305\225\235AR\276(\247V\215\005\370\034\301\241\374\223<-#T\301XD\275a\245\215\214{A&[\225\236\241r\022*\025\002\274\250\2221\263\351\222S2D\216\361;[>\304\2207\246\263u\242c\024SCG&\341\\H\346\031\326\013\352;\274\350\357\337ghyt\316+>\261\f\215j \370\311]\301FZ\314\037)4\332\350\025s2`_9\"\345\325\"\346)#A\311\342\t\267{N\243\221\372o\213%\251M\204\342\np2\304\207\207\2440\255p."
+	.string	"~Z\374!j\353|r\0138I\312Hb\352\f\204\244\032\241\211\301\351H\321\024)\026=&"
+	.ascii	"\234\374\355C\354\300\237\314\020\207yR\342\355\242\237[xK\307"
+	.ascii	"q\035\023\321\335xl>\324\b\321\254v\223Q~\r\306)\271%\bvC\244"
+	.ascii	"U\210\240\324\344\312W\n\250\232xK\212\rR\nkZ\3368\303K\005\315"
+	.ascii	"\257\236\362\035?\263]\277\356\260\364d\242\234\302y\220\035"
+	.ascii	"\205\006y\021`E\301\021TQS\302\036\372W\244)\021\272p\246\244"
+	.ascii	"N\342\341\250\002\337\375j.\320\376\271\t\331\"\345\334R\241"
+	.ascii	"3\212\220\333\365\0304\2560\367 \247\224\201_\304;T\342\301\024"
+	.ascii	"\3175\363Fw\213\034\355g\220\360\005\360A\306\002\007d\373\257"
+	.ascii	"v\030\020\302\2330|\024\353\021\215\220V\361\350\273*\247\365"
+	.ascii	"MI\3343s\373\254\334\2254\336\203\343\211t\341tb\342\300`\020"
+	.ascii	"\033\260$\345\245v]\"\267\347\"\350D\250\316\264\211\006\365"
+	.ascii	"aS\367\005(\fB\030\204\017\f^\375\231\352\320\242C4\030\355Z"
+	.ascii	"\223\302R\277E!\213\325\214\302\324$\343\020\2722"
+	.string	"\030\220\217\026\020n\305\013\005\372\331~\323\276q4Cj\204DEr\346p8\003=\337\261^\016\037NI\227\312\253\314\004\f2\314J\021\333R\227\271\367\332\b\240\334t\202\030\354\255\350\352\262\004\031\234>A\327m\200X\rB\206\020Q\200\370\002\331\362\237Q\005\013]d\250&\2064\326\240\302B\267\370a\017/_T1\032\207\307<*\242W\3113(\372\323\220\203G\320\205\245\225N\037\217^\255\370A:\3419*\020\366 \264\243\221\314\330h\biM;/\023YZM\022\275\207j<e~\375\005\005h\354\002t/\247p(\017\354\222W\3041jp\360\377k\372p\256\263\355P^\250\205\345\335\373r\253\314\227\223\2349\266`}^\004\321\245\253\367\021\034\0329Wc\360\004\333N*\253E+)d&\311\264\035.VX\351\344T4\373v\017\330\207\t\024\304+\367\254zE\221\362\264\203\273\345\276\302\374"
+	.string	"\3064/3\241\003\3015\342\311\360\315\372><d{ad/RU\341\351\005bM\327\355\210\0165\200\260\027b\274f.\216!\241\te\376M\332\326\300\211=\344@\302\217\273\275\\\303w<\340\\\246M=z\271@\033\226\323\007K7';\257f\336\314\367<\357D\357\323Y\007\336\311e\017\371\211I\327\331\371\031\247\307\236\036l\345\342\030f\315\340\225\221\2302\306]\317\300\240\327I\3579\236\244>\257`o{\275?\232^\177\275\252Wq!\331\r7\214\262\004\360\336\356;0\034\264I\256"
+	.ascii	"\275\315GX\361\203\274n\367\243\364\004fQFl\356\221Wn\302\273"
+	.ascii	"\215\305\2651\016\206u\342\\\275\343Z\324\371\0366\032\322\271"
+	.ascii	"I\354\035\271\246|\342\362\246\337\207m\347FXnn\375\2427\242"
+	.ascii	"\377\t\373\231\272\250{g\360\315q\267\352\027\343\2573\252\331"
+	.ascii	"R"
+	.ascii	"\276j'\3769}\261#\363>g\242x=\036\264\336\262\257\331j\345\030"
+	.ascii	"y6|\016O\017\333\n"
+	.text
+	.section	.gnu.lto_.symtab.5176cb9364a5d930,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"serialSetCtrlLineStateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"serialSetBaudRateCb"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"serialReserveTxBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"serialCommitTxBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5176cb9364a5d930,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1055 @@
+	.file	"serial_tcp.c"
+	.section	.gnu.lto_.profile.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`Z\001\005\n"
+	.string	"\362M46@o\323\030`+\020\300\244j\350b\222\230\032\273\237\373J\3723\316y\352\247\n~4IC>\3030\f\b\253\242(\002\270\275\243\247\247&\264i\223\335\326\233$\271\003p\207ss\2325\362ZB\034&?\006\213PF\222\330\200>\2663\016\206\307\005f\217\343\343h\331\236\331\336\251w\214v"
+	.string	"e0\262\360\202=;,\025\016W\0050A|(\032\252<[\216Q\261d\003\244\263d\245\231V\024>\037\235\"\025OJE7\017'\021\263^\253\213bc\327t\315\206\0204>\271\323z}\267\336\351{\265\317\345\324\333\"\235\003\223iz:^\255\202\201\020\224\030\251G\340uHqi\351\341\224v\236\021h\316\204\211\317ew8E;\022Q\006\344\340\002\001/ @\002\204 \263\016\330A\303\\\206}"
+	.ascii	"b\0054\333\232\002`\366\335\026\3441\257\330\202J\b\250\350S"
+	.ascii	"\325\262\353\006,\214\3319\344\n\354\261Rj\266\"\334\212\323"
+	.ascii	"\230\230\003X\366U\314\002\013\271\bPX\265\024\001\\\237p\013"
+	.ascii	"\213\006\307u\261\300\326\271\352)\267V\317R+,\227d\3318\355"
+	.ascii	"\304\\\243\357\"\005\210\211yH*\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\275\005"
+	.string	"\002\207\025\035\240\251\320\001\377\217UUPUU-\027C\234\222g\355\333\377\254\375\306m\t\331R&\031{\357*\022D0\316\204a\203\177\030\2734\035\341\007]y4|x9\nd\260\013\336\244-0\225\200\367Ru\325B\207\257P#_\332&\310\364\214\013\222\374\275\316\260%\001) P\202\201\250\314\003\b"
+	.string	"\004\322\020S3\013a\212r"
+	.string	"\215\f\344\201\300\330\303\317*\r\001XN\370|C\3004\262\ri:W|\031\032\003 \256\226Qp\301\003\004\310\203\252\\\242\200s \352v\f\026%\r\357"
+	.ascii	"\305\202\236`\352$\330[\334{)#\026+\202E\316\026X\303Z\031\002"
+	.text
+	.section	.gnu.lto_.inline.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\361\004=\024"
+	.string	"\226ZYB"
+	.string	"q\224t8\025~\374\375Nf\247C}\006\f\273\031\246\367<\244\340uN\334\035\272zR8\036\nO\252\336\365R\007z\013P\025%\370\256Z\001\004\302\212\232\032*\326C\274\002\177\275\332Gd\313\235\002<"
+	.string	"I"
+	.string	"K"
+	.string	"m\267\333\240\231\231\227a\230e\346f3~\031.\240w\277S?\367\343K\250\342A/df\350#\245\356\347\264\027CUf\002\370RW2\323\323\277\244\367}'|\311L\220\007\235\201\t\031\2541-B\320\370 \212\033.(O\013\217\031/\020\340\177=Q\357\372\231\264\203\t\035+f\361\206\224\372I\251\314\017\242i\r\323\274\25182S\324V\200\217\300\310\314\2213\245r\262\206\334\256\307\332\nv\260\263\203~]\007\017h\205{s\0134\242F\330\261\241\0055\372\363\367\017\303==V'*\241\325\311\007\002\227\203\225\322:p\007t\257\213BfZ\370\353f8\t&\216*\316\030Z1,\317\233p\305JIa\200\204J\f\224\004\177\\=\355\266\377\023\177\335\2515\\X<t\336\004U%l\300\224\264\020*BF\006\027$\213t\276\204/62S\344"
+	.string	"\231\252'2\023t\250a\315\334hD\206\037\003\315\250\023L\310\001\205\222]\207LJ\265\233\251\255\030\r \n\f\032k\037\313\211*!\200\204\250a\305aD\206D&L\213\331\r`\002!\"v\346\001\022\340t=D\251\202\206df\226\024\247\2459,\214\210b\332\266\340s\230\276]\365\025\352\002D&\n=c\267\321S\262\023\324|\220\210\301\241\224\310D1\017\t\216\373\210\207\321\031\325\213\344Q\310\"\r&\336P\350!qr\210\021)b\374tY\224\274\260\013\222D\302\3567\025\241\365\351\203te\005%g\366\204Z\0161\004i\242\250\347"
+	.string	"`\201\310K\222\013\270s\367\022\361/\325\210\346I\327\205\216\222\350\241\313\323\252\030\033\024p\360\013A\bd\347\376\bM{\267\377\230tN|\331\356i8 \031\320K\363\326\334q\221\026#\241\363s?'\347\236\023B\305rmi\020\347^\365\376\323n\213K:\007R\250\bZ\001E=3\372w\216\334\376.]\236\024L~\357"
+	.string	"\277\300//\203\222\335g\214\3741\212\f\026\344|\215\2757\361\031v\"\3630\212v_\376"
+	.string	"b\353P\351E\353@36Zu%"
+	.ascii	"I\236\212\bS\227\2307\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\341\006\205\024"
+	.string	"\206\331ZB \217\223\016@\340"
+	.string	"\340\330\210D\320\304\354\361\223\204\002\020\0200\302\354Cc<zZk\376\320\020\207H\"\263\265\341X\006a\177\270H"
+	.string	"\006\254\017\004\251\343\r\245\0320m\376y\334\220\320n{\313\224\002<"
+	.string	"H"
+	.string	"J"
+	.string	"SF\367\272\222_\327\375\257\373\310\304\275z\226\222\372\375\027\205\317\013\365\351\252~\343\327\237\330~\226\177\305\277\347\304\237\023\365^\205#\037\216n\373)F\223\"\320}\277\0078\206\035g\004!\026\300J\222\266\305\317\342\f.\227I\256\211\211\373\210\352\271\270\206\"B{\275*&\316\244z\321\336\\\341\302\375\227\345\203j\364\251J)\211\266\255\204~\017\002\342\206\0219\320^\371\266D\r\231\270\b\033]\327\211L\\G\322\2426\0265%\204\250\223\222\220\n\030L(\210\240`\234\321\305L\370\3770\020\f(\207\256\026\270\376\375\004\274\027=\320u\240\313\241\333\241\333@7\243\233\240\373\243\206-\300\373"
+	.string	"\336G"
+	.string	"-\325#a\277\270\214\315\326\020\261m\001\226\02657\23163\r\003\245\\Y\246\245L\016\027\311\207\205\021\022\024\214\245\306\272<`\236\016\326\301\352\\\037Ogn\300>N<&\310\004a\0316E\027(\244a^(\361\260<`\251\321X\227\007\353\250\314\371\321Tf\210\232\240\217\2662\255\f\313\240\300\001{\250!A\245\230\231\031IR\220\024\226\003`\002\221RE\326\001\022\340\241Q\n\004!\n\322\224bF\231\022\221 \023\225\024$\345\034ZK\212E\372\002pN\260\217\007\316@d\233HM\023\005\351\276\362\236\354\260\022\013i?\035\352\270\br@\337\032\253\225\024h\273\361-I(\202\345kv\375]\230\007\305\357'Lpdi\201\025\303\300\355\244V'\035\tq\b"
+	.string	"_\033\306\336\334\243\263\031\375\335"
+	.string	"\225\001a\356\242b\t\234\373\r\321\257\334ym\324\205B\322\372\017\2037\250\230\263j@\327\246\216J]:\264\301\312\362*\214\251J\002\300.\323g\023\206q&h\2127\316\355\220`&\020:`\340\235\372\356\b\026@\310\262"
+	.string	"!\321%\321\037\356\021B\3133\223F\331]HB\n\021\357\t\214\257\232\247\210\335(\332\234\274\345\272s\316\251\255Q"
+	.ascii	"\346\356\204;\266\340~\270\023\243\246\357\b2\3745'\016K\236"
+	.ascii	".H\203`O\333.\274\227t\300\313\310k\377b\254\037\356Sd\035\220"
+	.ascii	"\013\3702c>V\365\\\031"
+	.text
+	.section	.gnu.lto_.pureconst.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\231\004\001\231\004\002\232\004\003\231\004\004\232\004\005"
+	.ascii	"\232\005\007\232\005\n\232\005\013\231\004\f\232\004\r\204\004"
+	.ascii	"\016\232\004\021\231\004\022\232\004\023\232\004\024\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\377\001\365\t"
+	.ascii	"\002\316'*\220'I\007\373\205\315|\200\310\177\027\3646Afff6\375"
+	.ascii	"\337\254\331\255\270[\021\272!\333\215\250\013\037\265\312Z\322"
+	.ascii	"\332\2262\005\253\025\004\2631\352\331!\203u\005\377\"P\350L"
+	.ascii	"\350lt\"t*\235MgC\025\017\b\034\261,\340?\220\034\333Q\002\374"
+	.ascii	"\214V\031\3223\315ea\304\001\322\305\202\221d(\252\315\007\351"
+	.ascii	"\231N\271S\316\320\344\250\363\351\204\324\036\345\217N\250\215"
+	.ascii	"rG\355g\250\250\357lJ~\332wO6}\225+\275\276\240\230\270]\213"
+	.ascii	"w\234\346\2573i\336\233r\250|\271\022\001M\250a\311\202\210\030"
+	.ascii	"\024\244\316\032p\002\0312+\017\0210\265\242\254D$\206\306\235"
+	.ascii	"(\375\250\nOw\363(\364\301$\226)\314y\351\354\262\226%\367\001"
+	.ascii	"\257\373\272DY\001\232\343j\347\255\370o\034/\037\325U\023\276"
+	.ascii	"s]Q+h4\327A\233\r\214TlTI\370\220)2\253\246k\211~)\2062z\362"
+	.ascii	"\f!\217\016\315\371\335\220\036\362\264I\026\315 \330fN\317u"
+	.ascii	"\262\347\2414D)\213W\372\277\354\306\035\204N\261\202\315J\333"
+	.ascii	"\234\035\034\325Ko\004Y\007\261!\034\001\246\236\212@\036"
+	.text
+	.section	.gnu.lto_.lto.fd059c05d3928b1b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpVTable.19.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375 \366%\006"
+	.string	"T\n\274"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\355\264\007\177}\270\355\304\007{y"
+	.string	"\005\001\006w\001usqo\274\236\254\246Xmk\177\244\246/ig\270\344\344\007ec\370\337\224\tea\270\337\204\007_]"
+	.string	"?\202\210\200\360\001[Y\307\001W\306\001U\305\001S\304\001Q\303\001O\302\001M\301\001K\300\001I\277\001G\276\001E\275\001C\275\001A\274\001\277\177\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/drivers/serial_tcp.c"
+	.string	"\r"
+	.string	"\200\224\230\244\310$\n\214\341\214\375\352\002\330\201\306\200\b\270\233b\223\231\244\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_tcpIsStart.23.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"\"\314,2`m\322\030@\214\304\366\260\263\241\031\340\f\316\trN\373N\377"
+	.string	"Lk\326:\325\331\275\006\337K\222j\b\002\"\311\360\252\036\021\222R\253\225X)e\nO\022f\312$,\\*G]\355r\224C\345\024ZCuah\223\273\232d\331\302P\256e,\313\265J\266\250\237TKG!\0369\260\343\215\031?h\0221\214F\r"
+	.string	"F\251\002\026\235\f}\306I\275x\244\254~\376<5A8R\262K\021:Y\221(D\343\337|e\203\203\315o BA$\022\036&\273YS\f|\230o\304\r$\370"
+	.string	"\301<\034\314"
+	.string	"\204\335=1O\005\256\370\027\374\322?\021\b"
+	.ascii	"2\003\316:#f\b\3055q.\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_onData.24.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\355\n"
+	.string	"\026\325KA0\307(\035\020\335\036\225\356\374x\275X*\251uSk\013\342\276\234\f\001\005\377\221T\233`\202\332Z\303NL\321\207\332\204\261k\33223<ti\016\021i\371\345\265'Y\310\001\225\315n\262wJ\0017"
+	.string	"9"
+	.string	";"
+	.string	"\260\335:a\272}\272~!\363\271]!\363\351\320^\360\272\332\013\004$"
+	.string	"\032\354.\225*\017\037C\377\256#\240R\245G\rgw\035Q\251\223[\336\266\203\355\n\373\031\001\365\236o\375\232\026\035e\36453V\340,\002\273&\263\007+\233\002X^\177;\364]\346lW\021\316\251\004\003\226\200\301n\225\3704\305\366h\337\345/\341[\244'\354\252^\001#\262d\333\373+d\213\222\341\300\307\003x@4"
+	.string	"q9Y\016\f>\306\n\266\335\265\360aF \017\253\225O\237\224\371\2342\202\325\3222\305\231]KQ\246\330\327vw-U\366\003\340\273\333\263\tyD\032\035\235\317\327\201\024\374\272\321\347\333\240\036\237\016\210z>\220n\032\354\205\272\217\212<\357\243\\\335k+U\2361\231I\236\314\305\313(\247\2649@\361(s(\001\020"
+	.ascii	"3\241\t\037c`\013\257\204}\217\312\004\251l\240\334\243\210\326"
+	.ascii	"t\202\251\t\"]\263'&HD\221\315S\247\3075\274\020&\031"
+	.text
+	.section	.gnu.lto_onClose.25.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`n\002\365\022"
+	.string	"6c{H\340\320(\035\333\271\274\240\276p\234\330T\367c\335\343\034gd\350yP\377\210\313\2419&\246\245\224\306\271\361\265\007\252E\255\373\017\230\337\365\204\233\365\215x\204x\303x\036<\037,\"\247\314, \346\255\031i{o)\223\fd"
+	.string	"\\"
+	.string	"j"
+	.string	"\372\241\252a\214I\214\303\003\240\241[wx\340R\023t_\325\363\274\366:(s"
+	.ascii	"\3358*\200\272C\004\352u\227\032^\300\274\354\0362/\365\245\232"
+	.ascii	"\343\241N\227\350\260I1\324\335\036\207\370\353\221\367\245\037"
+	.ascii	"\231\220d3\330#\210\263iF\023E\272\373=\337\016\263\330\356\310"
+	.ascii	"\244\273ue\263\017Wyu\240\272A\001\362<y\210\324\345(\024G\327"
+	.ascii	"\335\013\364\266\324\352\244\263s\251\227\231\227&^\233\020\255"
+	.ascii	"\006\316lN5\204-\347\250>vw+\343\250>\274\232\016\376 \274Z\032"
+	.ascii	"\255\222\342j\027WGsu\306U)Wc\\e^]^}\210w#\302\335'\327\355!"
+	.ascii	"\327\243\205\344\213\021\017\177\325\277']s\331IW\243\300\200"
+	.ascii	"*\n\205"
+	.string	"\275Lc\3370L\3650\036\244A\277\243\025R\366\262\224yIb\322\315\310G\334\371L\036\361mT\356be\362\342\"K^[\215\237\242\031\226\267pEf!\232\b\220Y\326l6~\212\256\232\252\250\263P\025\250\225\300-\257\340\313vp.\367o\236\227\227F\r-f\341?\237O\313\205.f>ZJ\235FR'\221\022\327i\202\004\006(*'\020\032\244\004h]uE\221\274\240`V0\260|,U\313k\261T\033>V\312\313\360\261\270x(V\313#\021\321\325\213\212\345\301\254V,\357#\354\307f\034\365nD\267\031\216E\316q\315\031.\020\022p\b\267\335\rc\375f\211[l7h\226\207\214\257\304\004@\023\340\200e\226\334\361O<F\204\223\240\355t. `\002\021aU\036\223\320\345\214\361,\230u;2\032\353\277\320\220\275\364e|\335\222\2754\262PQ\005\274\213\227\237l\244n\271\017\213"
+	.ascii	"\366\274L \321\n.\331\223y\"\266\244\2617\366\303\t]\307HR\022"
+	.ascii	"h`UFx\243!\035uq3\233I\253\034o\023\320h\001o\326D\215k\020\024"
+	.ascii	"\362\350\351Y\3131,\270\334S7?L8"
+	.text
+	.section	.gnu.lto_onAccept.26.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\251\004M\034"
+	.string	"\3461\261H\220\\Q:\200u\3561\034\212\305\270\030M@\307\022\025\373\277\234\322\307\203\001\366\251\027\210\027\027U\325\326\377Hu\330\342\0037\374V\004"
+	.string	"HE\335\241\233\374&s\365\270\346-IIt2\227\305\021m\237\020\262\211\2242\005\226"
+	.string	"\214"
+	.string	"\246"
+	.ascii	"o\222\317\315\337\003\027\252\320\030N\031`\254\225\306\226\234"
+	.ascii	"\232E\255\b\331\342\356\277\273\344\260\377E\027[\233j\270\202"
+	.ascii	"K2\324\324ZT\260\364\r\316\345\177\223,\225o\211/\326\247V(("
+	.ascii	"Uj-.x\355\\\372\342\002\225K\317\005P.\275\357G\263\305\250j"
+	.ascii	"\362\210\341\344\344M\255\265\326>\326\267\224l\366}_\302\337"
+	.ascii	"R\034K\266\320XE\006\212\020\307694\344r#&d\"\201\276\3608\263"
+	.ascii	"K\226g\b\227\230\315\t\265\326sPhc_\356\177\017\377M\374d\230"
+	.ascii	"R/2\342\r\032\225K\313v\345\240-\331\324j\270\304[\357&{\235"
+	.ascii	"\216\366\211\255\273\223\f\201\020\267\271\271J\214q\316m\215"
+	.ascii	"IVD\270\323E\271t\273\203OQ?\261M\256u\326Z\037|\253>\244\230"
+	.ascii	"E\325ZWj\351\367E\2714\250\243\236\240\206TD o\375\305\037w\217"
+	.ascii	"\177\311\332P\377\026\367AK\334\0052\371?'\337\307\344\367\234"
+	.ascii	"|\036\223\0373\371;%_\207\344\303H\376\213\362]&\377l\276Y\362"
+	.ascii	"K\222OI>I9\b\230\266>*\237\022\266\232\312\202\321\277\357\364"
+	.ascii	"Oa\307\354V+\270\006\310[av\347N\323\337\0248D\332\322\026\006"
+	.ascii	"\246\202\205\263\211Hh\251\016Ysx\321y5\314\325\257.6W\027=\035"
+	.ascii	"\205\312-I!t\\\005\3270V\233/;\310\002|\366\217!\003\3235l\226"
+	.ascii	"\235\3161\350xv\013\215S\033$8\314\352M*\315.Qe\206\211\343\\"
+	.ascii	"I2\233\300\223\221!\325v(\177\016\213\325\241\351\016+$l\202"
+	.ascii	"\230\233\3662\331+\020;d(Uk\323\006E\234M\016\204\376\021$x\203"
+	.ascii	"\2279\365\357\337(+\245\367\r\177!\315hH3\031\204\"\021\0266"
+	.ascii	"\220\b\360\027\322LF[1\373@D\001\204,\247\223\345t8%\333-\227"
+	.ascii	"\323\331d-n\033\f\364\366\266\2671PaS2Bq\204\343\335z\265\036"
+	.ascii	"\357\306\002\307C\252\345pG)j6^\257\306@v\235\212\033\257\246"
+	.ascii	"\244\323\361j\260b]\2626\324?\001\330Kt\210}~\320\0377?l$\370"
+	.ascii	"\364^i\031b\236^&> >!g\255\300\r\232{,e\017\021_\021\2474;\026"
+	.ascii	"\320\323.\255kE8\362\364^\351\230\361\261V\315cL\265\002\023"
+	.ascii	"\304\216\370\246`\364\257\314\216\217\002b\275T\264\020\003W"
+	.ascii	"\2501(&\235S\252FD\224\024$M:\200\002\2211\253\036\02101RN\242"
+	.ascii	"\2312\233\003V\231\025+\347R2%\257}\271\037\241\365~K\252\245"
+	.ascii	">I\327\276\002>\304\0064\002T\326\333\333\334\2649\025s\374K"
+	.ascii	"\260\367T\371\250\201\225\"\314\220F\340\353\333\337\323\360"
+	.ascii	";y\356\203\217=>\202\031\262\2658l\331\307\352\337\362\2258\363"
+	.ascii	"\020\271\013D\031`\270\b,\301xs\207,)\326\001\350TO\342\265f"
+	.ascii	"Y\r`\267\001\006\"\030\222{A\201\203\211\f\300\230OR\313\031"
+	.ascii	"\025@\212\367\271\220\263up\006\247\316\313\022\310\233\231\233"
+	.ascii	"\njvF\345\333\362\025\007\217\314\324\347\211\377\204=\365h="
+	.ascii	"\024\311T\r"
+	.text
+	.section	.gnu.lto_tcpReconfigure.27.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\254\007\375)"
+	.string	"\032J\\\020D`\346M:\201h\016;\373c\333\275\265\371\246\204wG\340k\277Y%\220\274#\235\005\007<\206,8\261R\200\013\215\324\206\220\201\2579\236.~\317\002\372s\275o\036~>\004\202\202\334\255\021i\204\220-e\n\346"
+	.string	"\340"
+	.string	""
+	.ascii	"\001W\317~j\366w\335G\321\376\331}\363\354_\263\337\267\317\022"
+	.ascii	"4(\t\3215\265i[ u\210Z\267\223\355\312\177\035\177\357\177\367"
+	.ascii	"\317J\016\243\203\305\274\355j\3336\331\223\246m[\251?H\371\\"
+	.ascii	"MFB\233\321X>j\333'q\322\264\255R\352\277\224\317\377g3>\323"
+	.ascii	"qvI\031%\b\017N\n\327\030Bm\253\374]\311I(\237)#\241|^(\314r"
+	.ascii	"\221\257\307S\323\035z\232\267\3313\221\213\300\330\307C\202"
+	.ascii	"q\357\355+\211\271j\371B\322<\256\343\004N=\002\245\345\313H"
+	.ascii	"\247\273K\027\007.n\rY\204QS\302"
+	.string	"\234\030\030~\373\n3{@\336\302\030\373\344-16O\"\233e\334\032\022\214\257\251 \t\007\314\b\311\303L\242\343d\017/\271\273\220\305\356\335\206\266m\337Gd\020\276\021\377\177\363_\355G\353\002s\305K\274\020G\331\005\275c_\300fS\237C\240\367\376\"F4\037\315\313\226\345\223;\376%X\315\t\ni\3303\024\006\242\264m\313d\354\205\200D\355H\244\325\b\242\303\344\274c|\301\346\244-M\244\356\313i|F\005\273%\311\332\326\310\307\025\251QB\024\213\251\346\343W\036\227\370\363\032\233\261q&;\025\020\210\362\331\367\"\331x\tc+\307\244\333\275\026\312\267\3052\317\2166\304\242\261\232V\332\266\255\205\363\030&\363\342L\306\347\2031\232\217|\236c\240|\3625\373A\226\374\302\266\325u\277\222\330w\354g\263\275O~Fc\206b1\314\353\373Of\337I\3557\251}&\265\277d\366\225\324\376"
+	.string	"\265\237\244\366\005t\037)\355\007\350\376Q\332\007\220\366\215v\375\"\263\357\353~\017\355\363\272\003\353=\272\020\304\006\031\223\305\256{\205\206\272\234\306\na\207\244m\273\305\307\346\267\241"
+	.ascii	"\212\260F\270.\361\211\204-\247$\007"
+	.string	"\340r\037#h\020\232\001\213\261JZ\255\314\315\210\t\037\022\362i\320?;\306Bi>\032\335\034fK\n\315\025\205Rx\220\360\252\331C\250\350\376,\025\026\304V\341\343\237\365\026]\nbj\\\211\330,\350\317^\341?l\026\006^ge\370g\267\360\234\326U\340\325E\017\367\321R\222\343\223\301\013K\362,\020\263\026z\306\303y\264X.l\031[\206\362Y\300\213,y\026\350N\333\330\033\257\027'\214\342\323W\307\007\243\307\223s \346\220QUy\r\247\352\034\326\013\313I\357E\312Y\306\255\025\t[\202'\275\236%fh\273\003\215\302a\277\260`Rc\211\250\237C\007\243\233\335U\303\270\r\326\333\322\363\327\240|\242\327\267\264c\346\b\201\376=|@\371x\336[\247,\254P\347AA\0358/\013\201\t\022\034N\254C\241\2135\013\301Z5#\330\202\211\204\323yU\bV\251\265\nh\025\234r\261\336"
+	.ascii	"be"
+	.string	"\311XS\230p:\017\252\n\210#h5\025\304\n\316\b\256ZUS\300\241\325\324z\025\\\261\206B\032\005\252\202}\305\247j@\203\n\213\205\325Tp\b\274\372]\r\2015\202\303\252\337\214\340\224\214\037\325\360\352\327`\275\220\006p\370\303\022\n\207\277\236\262e\263\275O\276\2033SC\263c4\314K\006Q\254\302\205\306\204\272O\267\353\377\323\375\206\255[,b\272MBXb15\362X\024\237N_N>x\3516u\017^\272LKw\002] _RZ{\261<\270R#wE\361\251\304\325]JW\r\033p\331\230,&@\005\334$2\311\242\200\033\201\216\237e\234Z\242\003\232\302F\327C\272-\226x04\357\350\236\331.4\300\017\026H\363\021\351\366\016\241O\356)\300U\245\210\001\200\212\250!<\003%ddF&\210\202$),t\220\"!\262\242\007\0210-c\020Y\230 \005I2\254\001X"
+	.string	"}\311\367\244\361\257\244m'i\022\227\364$\255\266\300-\301\260\203\007k\205\215\370x\300\245\244\021\034\033\3670\207X\314\2265|(\246\320\223\t\271\020B\331\341\266\343\036\200\341\356C%\035\r\324!\234\202|\263?\214\213\277\254Lz\302\317\212\007\330\033\372?"
+	.string	"\247\316\272\rs\216m:\363\354[M\240\254\204<"
+	.string	"\240d\202\261`b\300\203\376\351\200|m\220\213\200j9\337\023%\265\305\ti\265X\263hv\304\254^\027\251,\025,\024\374\\\210\363GIP\200P\352\367\300\320\355\307#\375z\002\330p\376i\367g\307\253\230\033\375\356W\246\001\204\247\034\be\317\300wz\325\347J{h\323\344{\276\0067\335.>*\"k\340\264\013\235\322\026\325\225\027Z\333uA)\374'7\242;Xqm\325\241Q\t\244V\363\237\262Wf\272\203\030\022\003\243=E :\004\210"
+	.ascii	"\335^\362\034\030E\b\375\003"
+	.text
+	.section	.gnu.lto_serTcpOpen.28.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\226\005-\035"
+	.string	"\266\262\266G\220\234Qc \316\237\320\020I\335\214\244\367\277\303\371;\220\007 \024@\255\253\360\272\214'\273j"
+	.string	"\327!D\233u}\263\264\262\256\252cb\305\233\236\255^\225\373}\013\3118\371\233\347\376o\320\306y\013B\366\336R\246\024\235"
+	.string	"\224"
+	.string	"\251"
+	.ascii	"7\270\344\344C\371d\256\231\200\0334\342\260`\353\213/>\340^"
+	.ascii	"&5U\367\246\020,!v\323\265\332G\362$CO}\345\233{\225\220T\335"
+	.ascii	"{!\230\026\273\271S\332\366\213\334\310\220\177\263\224\230\004"
+	.ascii	"\353\"\346h\t\362\336\224\346\364\006\316\233\261\0238o\332\035"
+	.ascii	"\377\3754K[\177>\321\317\342\225\321\264]OKZR\302\341\313\262"
+	.ascii	"B\225\"V\216\320\2504\233\216\344\300"
+	.string	"\021\006\253-\t\324\020\223\225#\f\226\017\302\bm|\352\025IXT+\354\302\275\327\025\025&\335\260\333\006\262m\263M#\001U\177r\363{\334t\n\\=z\323\307\2357\253\225\240C\013\035\326,.2\236\330\013\235\267>F,\301\232\3060{\373\2513\020\2621jE\265\001\326\244\235\022U\333d\277\274\226\311\276\324\257s\250?\301\231\374\263?\375\007^\374\013\374x\313\236\3760W\233\262\352RVmc\325\365\246\372\013xRd\031\005\311{g$\327\334-\246\225\217\037\177{\310\2372\216\355c\356\027\006\215\033\264\bI\346\336\324\301M\373\304`R,\232t\2308\231\360xL(_) \277$g\352\0313@:D\f\357\312\240\263eu<\250\320!\327\355\r'3\346(Crx\03000\245(d\207\177\331\362\360,/QD\274\276\3456\210w\361a\331+\264\313w\332!\256\305\307`+\213\202\255"
+	.ascii	"IPH\257_\351A@\274\027\306Q\277\312\255\210(I\364\234G{xN\245"
+	.ascii	"'\207h\227\370\224\023\261{\357\004)*l\226x\3575\213K\212\264"
+	.ascii	"\244\206\300\232\254M\220\200\244\346\205x\035\225\224\317\235"
+	.ascii	"2;\233\2214~\031Pa\266Z\033E\255\036\225\331\035#Kd\037J\016"
+	.ascii	"\300Q\333\272[\331\032l\335{)\004\274\363V\344p"
+	.string	"=]\016v\373\311\t\225\267^m\304\217\257\346\023\253\365j\032r\200l5\237\240\240Z\006\027;\331\017\256\332\026Ag\353\241\b\252\341v7\036\215\267\273\265\300\355~h+p5!\232m\307\243E\330qNw\333\321z\271\334\216\206\223\336\227\3272\371\\ZsDe\3128x\211\021EU\372\277\323\264H\266M\353\013@[t\352\370\250H,P\253(_\t~\324\030\276#\254(N3 \325\210\0274\225\250\276\016\004\251@sU\242\"\225\323\215\002C\236|\321\006\350\344\353F\351\3645j\276~E\216,\255\216\307\024th\255\375;r4\001g\250QP\306 \"\231!E)H\222\341\340\"\021+n\003\021P\255BH\031\211\202\262\244a7\354\255fK\316w\177\026!\305\n\262\2205\271\341\f\356T\236\340l-\270r\345\236\271\307\256\323\346\246\240\277B\021\310\217*\252gN\241mN\231\215g\350\n"
+	.ascii	"\306\232wA\313\241S\213\300\376\356\240\356\274\335\205\f\273"
+	.ascii	"\004G\207\256\260a\022m\372\252\246\346\2570\206\013D\263\036"
+	.ascii	"\277\006\274\002\211VN\001\213\215=\351\2259\007\233\374\372"
+	.ascii	"\342\240T\313.\337\034\247!\3565B2\347\255\271Y\376^J)\231T?"
+	.ascii	"2S\277\016J\223K\307k@\220k\306\274\035\220\344\002\237\030\364"
+	.ascii	"!\222D\022\233\324\326\352<\0071\231\321s\256\002"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.29.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\361\001\315\020"
+	.string	"6\237mE\360\260(\035X\234*#\035\007L\351p\331\255\3602\216\251\371\366$\023\307i1\236<\035\304\322US\373\r\261y\020\355\253=@\353\3666\271\344F\342\360\304E\367\221\320\320\376\344\027\310\212\303\254\310'{K\231RU"
+	.string	"T"
+	.string	"^"
+	.string	"2nv?\004\346\264G\177\232m\277\304M\230\270\203_\213\227\305Dl\210\325\330\3758\320?\262G\370"
+	.ascii	"\331\243\202x\367\b5;\337#\002I\274\340\274\274\325c\312\341"
+	.ascii	"\307K\271zx.\b\332\335\317<Q\274V\246Gdw\235/\317\303\235\335"
+	.ascii	"\266\003\333\013\354l\020\361\372q\301y\251\260r\307\376V\251"
+	.ascii	",\366\341\352\212\275}\376\375\236\313\334\031LG\230\2060\255"
+	.ascii	"0\235\232~\307\246\342\302\300\316.\207\035\034\253\023Y\214"
+	.ascii	"\270\314o\233\3703\336|\231N[u\320hb13v\277\003\217V\240e\332"
+	.ascii	"\207\375\204\311\277\f\007\260\273\022+\272\0017\037\036VN\f"
+	.ascii	"\214\005\225eS\006.0N`Z\271\273+U\026\253\246F\230\311q\345\r"
+	.ascii	"\333\241\333t *\n\250\202\204\200Y\364\232N@\213=z\212\t\035"
+	.ascii	"\251\221\325\302\006l\313\253M\201$\3772\310\245+\3734\0302\306"
+	.ascii	"\3136\035\205\005mw\023\304N)\002-/\217~I\366\252R\211I\024G"
+	.ascii	"\242RH\225*\2214\213BN\"\325H\205\020\t5Jq)\324\350\002\t%\201"
+	.ascii	"+\221B$\234\b\225\342B@6\235F(Ne2\241\270\355\333\303\325\025"
+	.ascii	"?x\001?\252\001\307F7\315\024\305v\246\036():,mA\310\032O\307"
+	.ascii	"\245\253\030\365\243\317q\002\00355*\244q\362\2415\362( \200"
+	.ascii	"\002\241\271\343\001\311\206.\251\340\316\013\221fD\301\013\226"
+	.ascii	"\363\350\345?\t\275`?\362n\2002A\t\340c(\363\244M\236l\250\020"
+	.ascii	"\317\235!\335s\006\312*\362[@\346R\321\270#E\207\276oh\306\360"
+	.ascii	"\207\r\202\343V\037\220\372`8\024\363\345\234v\007-\240\3148"
+	.ascii	"\357\032\003No\255)\003"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.30.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\206\002u\023"
+	.string	"\006\244\177I\340\320(\035\330\007S\215\031{Q\f\235\002\272!\300 Ocj\256\001\3269\217\\\206\034\265\304R\344n\377\337\032R\005%\263~\2637\037e\3726@\020\b\321\032\247#>\363\301\310\360*/\005\343\265\033G,\331[J\231\002e"
+	.string	"e"
+	.string	"n"
+	.ascii	"\n\276\335_sJ\002FG\013\032\240\233F\206O\367\210\340\340\247"
+	.ascii	"\363\343\367\377*BG\300\\\224c\215\315\323\365\\\320\341\350"
+	.ascii	"\036A\224\022\360tJ\025\340\351\344\016*\352\224\274\342\225"
+	.ascii	"d\"C| \252\331`:eT~\330d\224O\266\231Du\267\352tcl\262]\222I"
+	.ascii	"w\177k6\rzO\377\237\374o\360/\213\006jlt^)x:\225?n\204j\033b"
+	.ascii	"\273\373G\330\362\355W\331L\363k\216\376d\002\321Q\325Cw\364"
+	.ascii	"\237\334\223\344\336\223\373)\367R\356Y\356\227\367\032R\032"
+	.ascii	"zAr\243\033\303nG\027\315\037\020\232\243\272\243\373\303\\u"
+	.ascii	"T\367\322\216\210\232\205\364\3546\204[\2409\342\007\313\360"
+	.ascii	"\361\350\214ht\217\007t>\036\034j\340\344\346d\020^\0274\234"
+	.ascii	"\344\345\3113\2106#CQ Q\344\247\200dR\316\f\234\\L\362\315\304"
+	.ascii	"\016nb\320p\262\355n\030\363\355\314\313):D\263\325\361?\245"
+	.ascii	">\"\211\212\021f\022\017\271\253\264G\034P\363\207\212\"\202"
+	.ascii	"iy\306\216r\344J\253\374K`Y\255\0355c\330\257&^\326\250\366\263"
+	.ascii	"\264\304\204\257\273\023\360\254\270\002*\241\353$l1p\205\257"
+	.ascii	"\227\024\217P\325\222z\271ZV\337U%.\252\027\312Jj\325\n]\240"
+	.ascii	"\253\025VX\265T\300\226U\212\005T\265\\`\t\352,\227\260\005\276"
+	.ascii	"X\254\026X\032[e3\315\037\300\220 \2546-R\260\211?\216\371\177"
+	.ascii	"\342S\214PQ\214e\020\366\004P\321\214a\007\260\333\355v*z$>\261"
+	.ascii	"\332\240\315|\3541\211\275#\032n\2058\022$\342q0 \240\002\241"
+	.ascii	"9\333\001_'\364\240i=\261\216\274\220\321\303\352\274Y;\035\006"
+	.ascii	"\216X\"\016\003?c\254\315O\355\245\t\347\276\"x\200\217\341\231"
+	.ascii	"'m\362lC\205p\356\004\351\036g\240V\221\337\"d.\030\215%R(\364"
+	.ascii	"\026\206f\016\017\22288\016(\305\261\033\242\246K\036\265\226"
+	.ascii	"C1_\347kw\320\002\312\216\363\2561\352\364\326\2322"
+	.text
+	.section	.gnu.lto_isTcpTransmitBufferEmpty.31.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\022\001\375\f"
+	.string	"VXXC\020\217(\035\220\241K\273\n\256\376\177\321\263\203S\300\262Yd\023\320wv\265\343\300U5M\351\nT\277\336\b\370!X\273\023\220$\033\006"
+	.string	"\001\250\2224d\307=\367\025\360\347\217C\372\n\221XB\244L)B"
+	.string	"@"
+	.string	"J"
+	.ascii	"\001vER\244\354F\004\206\3321\307\017\270\034\323.\340r\314\266"
+	.ascii	"38#"
+	.string	"\223\036S\247\243T|\234\270\330\215P?\234\364$\371/\371%B\3252\201\224\236Y\203\335u\232@4\334z\333\006l3\260\357!\366\257\335]\253\210\375xg_\375\327\225\326+\235\232>F\001\026!\035P+\264\025\367\324\302\262,LE\365\370\333#\277\304\030?\2224\245\270\247\fU\312\310\201cV\240e\332\0379\311\350\253\013\017\033\007e\243\312\001\261r\347%\266L\312\346NB\002\201\324\005\034VBHV\230\274\332\023<y\2235\030\264d\377\204#WL6\350#*h\273\233\300d\343\313\244B\034\363-\\\216]\037\260\230\264Ll\350\310\026;\226RQ\001\034\242\220\307\301\327e\334\366\351\210\276O\247y\333\2046\221\006\205N\347q\037\374<n\243\363\"\300O\327\361\300\315\373\340FcP\210\363\240\b\004\362 &\356\355L\001dx\301\352P\017\b\211\322\202\245\232\232\351Q|\250xh\374D\030"
+	.ascii	"2\003\3020\273\t\023R \254I\301,\017\204\202\202\201#\246\222"
+	.ascii	"\376\343L\024\254\002~\215 \236\t\321xF\212\t\r\367\205\361\256"
+	.ascii	"\331\027\013\333\211LM\260J\236j\306$L2"
+	.text
+	.section	.gnu.lto_tcpRead.32.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`M\002-\022"
+	.string	"v!wH\340\322&\035Rw\305"
+	.string	"\240\343\034 \350Zi7WF@\367\323i&\302\301SE\322\367RIz/F{\264\266j^t\345\253\013\311\265i\017\005\311\020\306X\236\311\241\224p\235LF\001R\243t\304l\226l\"eJ\001^"
+	.string	"Z"
+	.string	"e"
+	.string	"\027\272\212\231\3434\\\300\256\316\n\032\273a\002\177\250G\207'\340=\242>\300{\264m\005\013f,{\330\203\343\355\344l\212\232v\303Oy.{\3544e\376i\245\003\n\332a\273\315\036s\336\211\334r\256&\267Z\207\262\273\037z\336\334h\231\247\225\335u\332n\036n\357\266Yl7\260\323D.\256\002=?\217\276\005\357\361*\002\244d\003A\2239;\234\245\356\330\357vw\255:\366\303\233\344\270\037@L\237b\332\353\322\321Kw1\255]:5\375"
+	.string	"&B9T\214vqrBv)\"\221x\370\3333\376\220G\374P\206\332\022'#\036\016<vC\004\217VAe\332\001'M\371\374*O\325\323\r@?jD\320~\024{0\342?\276\214\367H\242/\272\t\301\"s\35645\252&\325\234\240e\316\252\235\336f\b\204\313P\245\364\304"
+	.ascii	"\r\250\246\370\340\334r\0302'L\366\352/\300\022\246\324\370\301"
+	.ascii	"\005\020\\I^\355\t\255\274\315(5\235\331/\302\220L6\273\302["
+	.ascii	"\274\240v\227\001Q\024\300d\2010\253\030\f\246\2052\230\212\001"
+	.ascii	"c-.\253\326\213\005\373`/\326\205\326K\302\007\323Z\275|\340"
+	.ascii	"\013\366\245P\354\212a\275\276\230\313\365\372F\302}\267\252"
+	.ascii	"C\242&\035R,\321(\215%\217P,\325t\026=\305q#C\320\f[\217\356"
+	.ascii	"*/Iub\243D\207Q\223\217\334\335\231\352\216O\352i\004\"\245Z"
+	.ascii	"\006\261\355\340H\252T\215\003\001, \220\002\231\251\354\001"
+	.ascii	"B\241u\013,\023\256y\037\245\331p\360\022\b\026X\206@Q\01636"
+	.ascii	"\256Hp\025\302\271\317\n\371\221\304C\b\027\362\271y\210X\371"
+	.ascii	"\024\206\021\f\265e\003N\210&\0275\244{\316@XE\216\013\322\\"
+	.ascii	"\320\032\223\245\250\351\351\267\315\370c\210\205\215a\262\363"
+	.ascii	"\326\214\034\226o\345\306\336\333Z\243\007"
+	.text
+	.section	.gnu.lto_tcpWrite.33.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\210\002\235\022"
+	.string	"\366\341wH\320TQ:2\367\265\2438C\314\251d\270\301h@\213\2409\003\301\252\274\314\367Z\314\351\267\311\231>\374\327uI\207\372\223\327\370\004\264\247q\240\226\300\341\213'P\236\\!A'Hc\357\327l7\327\030!{\023)e\n^"
+	.string	"["
+	.string	"h"
+	.string	"\3355A\ft\177u\241:/\255\205\320"
+	.string	"\3356:?\335#\202\177\236\312\217*`\252\364\364d\252\374\353\037\242#\255U\006m\206g\250\273?F\241/\225\034\357\353\332\255"
+	.ascii	"\020g0\2254\312\215f4\312\245\231\2143u\267\276\320\0251\213"
+	.ascii	"\355v+\335\375\025g$\364S\377C\370\257\362/\221W\036\017k\023"
+	.ascii	"\377\225\306\330\340u\367\202\035\r-\006h9\254\251Ry\304\"H,"
+	.ascii	"\021\263\267\177\204"
+	.string	"-\337\374\312uw\237m~\035UIZS\035\315\2757\367\335\334O\271\227\335\236\233{\226\373\345\366zR*\372\241\342\323=\342V\324B\022G\212\377j\362\237\367O\240\340\245#\210s\227\240:\300S\216\003\036\237pT\3019\271c>\"S\023\273\001\242\374\220&\313\030\320\n\022_{\\\023\006\330\272Oh\316\025f\252<\341\230\200\261\267s\274,y\205\310\250\210\355\355\314\034\353\314\022\nj\003L\261\325 `cN\tR{\005\245\001S\242\375,:\003\305\313\274\263#I\255\264\312\277\n\303\252x\223\214a\017\031R\253J\271\240\\-\227\225\367\324\351%\345b\341\200Z\205\252\326\327\nU\035V\341\205\317e\205j\371Ra\353;\231\316zQ\205\237\213\305\n?\223\261\225m\336@\211P\f\307^`G\374;xP\"\212\260=H\204d\f\223\035\373\350\361\241\205\217X\204\343\233\203\223\007\210\002D\352\200"
+	.string	"\r\031\331\356\2061\337\334\343\216-\354\004\311\226\350\0173 \300\002\021\242\344\001c\300\002\206(ZTS\364\r\306\311~\323v~\220\021\245\035\204qU\264QG\360\023\370a\230\305}\330\243\344\275%\212)X\205\360\271Y\210(\270?-\317\342>,\004!\323\335\006\224\0208x\222\272W\033\350Z\363[D\346\362\321X\221b\241\022\033\314\203\004\353\230\021Q\017\326\334"
+	.ascii	"\037%t\211\006|^n\234{[K\365"
+	.text
+	.section	.gnu.lto_tcpReserveTxBuffer.34.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\261\001\355\017"
+	.string	"\026\037mF\360\222(\035\222\3632\347m\312h\013\007)u\027\340\307\220\230\264\216\035\336e\372\320\305\221\3407\372O\355\327S\032\376Xlk5\251j}\365\303\342\260\370k\327\217\361q\362\235oq_\322\202\344\217\326n\"eJ\001V"
+	.string	"V"
+	.string	"Y"
+	.ascii	"\266\313\366lkx\"\022\2623\031\025\006\231\267\241|\300n\313"
+	.ascii	"\215\233\3350\201\277\356\321\266\377r\030\227_\"\241\b\026\220"
+	.ascii	"KM\355\306c7\374\034\276\200\347\261;\001\317\243\272\374\365"
+	.ascii	"|\371\2179\227\002&G\312\n\354\371\211\260\273\316\224\025\226"
+	.ascii	"[o\373\200\355\tv6\b\016=\374\003pi\357\267\033t\232\273\273"
+	.ascii	"\355\377|\3221"
+	.string	"\2469OZc:c\372  \035f8x\261\273a\307\307\312\2108%~\373i\236\366\355\257\360g^c\217\246%\232\205\354\f\204\212\033\t2g\341\372\255\365e\331k\240Q\263\321\261\033\"x4\204\356Q\304=\277\261\320J\033\376\211\347\3611\277\212\016\007\220v\352\351\203\030\264\035\002\362\2436\311)\237\002\322\220\207\0173\2059\365\332\251\001\0344\0232\fw\221\2323#lr\233V\267\273\013\374\026\252TG\342\321G\321\327\234{9\221\323\303\026\313\035;\204\245\206\260\317\355\356Z[lg\244QR\030\345\005\026\t\312T\3421\225P$\326\nu\352\\\032Q\225X\243\022\322\t4\255\276\025h\312p\002+|\250\023\311\344+\201\253oD\344\224\312\004~\254T\n\374\274p\357\220\212b*sT\325\220>\207\206B\226;\3464\352k?b0Z\234*\320\261\305J\307Y\251\002\220\325\350a\363\324\001\034"
+	.ascii	"2\003\3020A\366f\213\311\032Q\016\241\315up#\324\016-\372\013"
+	.ascii	"\314\242\301r@\030E%\r\352\254\247\215\322i\302\226.\303\fe\272"
+	.ascii	"h\362\025f\233Cs\220\313\206\353Aa0\f\250\320\204\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_tcpCommitTxBuffer.35.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\362\001\035\020"
+	.string	"\246\034gF"
+	.string	"\221(\0358vv=h\374\271\334\353\347e\204\263\250&\342H\\\215\361\r\\(P;\362O`\271\246\353L\031\277\225\036\255\254\026\311M\351\267\246\364\177\366\304\220\005\360\031"
+	.string	"\t\032\3131\331EO\032![\312\224\002O"
+	.string	"M"
+	.string	"V"
+	.string	"\256\0305\273\341\210;\356\232\303\023\330\256q\027\331\2569e\347<\204m\307\345F\203L\216\335\355\324\345\251kQ3\345wL<`Ku\255\345\361\243\325r\005i\261\"hw\037\363\344\320ZevLv\327\t\266<\334\333m/\260\235\300N\006\001\372\361\202\003~`\311\036v\250J}\331\217\273\273V\227}\230\337\363\330\277\305t\214i\215\351\324\364AB^\310@@\263\333\241\007\217\225i-F\330\376\307v\2067\221:\f*\006XV\210\r\007\270k\240\370\264_\342/\251\3070\\\300n3j\220\270\221\273\253R}9\252\352\203\030\034V\356\260\035\372\nT\311L\305\310\254\204\206GSU\025G\006\020+\213\236\0025"
+	.string	"f{G\201\002 U[\345\350\210}\362jKP\311\203\006\261Te\177\306B\316@\273\364\023\023\270\3355 \363\231\n\300DP\330\256=\021N($/e\363D\244\320\311D\032q\026\221\254\210N')\241\321\347\231:\323\347U\030}\020:\322(\244\322\211>SG\002ri\305\373\272S\251\364u\237p\037W]V"
+	.ascii	"C\306\242+\213\344\246v\003\007!7'Ic#c\251JS\265qq!6\003\332"
+	.ascii	"\210\3722jcQ\323\t, \240\202\031\242\343\001\243\320c\214\241"
+	.ascii	"hQM\321w\260$;a\333- #\222f\220\306\205\242\r\034\201*p`h\210"
+	.ascii	"F\225\276>q\0348\342r\030\360BU\206\207\266\357_\003\261V\374"
+	.ascii	"\026!sY4^\244H(\304\006\323\350`\335\034[</\207\317\036\305e"
+	.ascii	"i0:|I\007|Pn\334\275\255\245z"
+	.text
+	.section	.gnu.lto_tcpDataOut.36.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\235\n"
+	.string	"\266\323IB0\251(\035(\324\261\"y\321d\363\251#.\275\350\316H\267\311\330\341r\362ud\364\032\242\235\373\372o\r\333\002Q\364\021\346\246"
+	.string	"$a[PP \365\233q\336\371\001\017B)\267\032\344\023\262\367N)7"
+	.string	"6"
+	.string	"6"
+	.string	"{\227\204\217\003\260\335\255s\345\341\351\224\241\317 \222N\267\222O\032a\202\200A\203h\242\231\007\001T.\340\022D<Iy\331\354\256%J\034\271\263\333\266\260Ma\177!\255\237J\351k'\021\201M\250p\355\206\304*l\203l\001"
+	.string	"\214\355K\373\253\263\302\267Fw\330M\255\024\354\216\022\256\3333\217\177\320\236m\317h\317\034\332\021>\262\004\016\f$x\315\251\262-\322>1\n@8I\n\266;N@4\341\017\byl\273\373\226g\376H{\366y\222\362Ba\265J2f\217$9U\366\351\356\256g\312~\035\327\341\200\300\216\267\231\323|8\320\205\006\307\373:\260\202_\027\362\276\214\332\3618\033\225\373\300\252\201\260\347\323}\025\344\361|\0253\3567\245i\242\027I\247\rr\310\243L'I\006\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\tm\365\t\231\351\020@+D\240"
+	.ascii	"\t\177`\312%\330f5E\334\345\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_tcpDataIn.37.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\271\003\r\031"
+	.string	"\006.\240H\300VQ:$\277\213\303\234\037\235\203`\346Q\351\234SE\270\220I"
+	.string	"d\254\352e\231\030\253\007\215n\247\353\300c\2402N\247R^\323\241\334+\350\177#\331Xn\236R\001\257\221\020\204\273\327\240\006\263\215\020B\266\224)\005\207"
+	.string	"\201"
+	.string	"\224"
+	.string	"Mp\256\366}\374\007\355\273\023\0270'Q\217\2449G\033\267\304\177\036\317\002\377\211\227\001\377\231f[\371\250\233G\222\201\342\250\313\234\263\2655\034\366z\275\336\345x\243\224v\021\025~r\225\346\353\020'6\\\317E\031\002\251\300q(+^H\234/W\224~t\275\341j\212\002\205`<t\361/\205sq\271\302\001\311\2329\247\n\367\243\373\243C\230\242\303BC\b\3065|0\347\264\332pBw\352\266\207l;\2607)?\333c\037\211\204:\331\354\330\203x\020\347\234\f\200d"
+	.string	"q@w\343\004\370\357\233Bz\262\265\360\321\236=\366\350\346\354\343\350\276\\\361\022\3314\347\335\254\363\376\231\217\277\314w\177\200U\314\307[u\336\235\002\325(P-\202\352PT\203\237\372\013\325\022T\357\247V\251~\201\001\\\236D\2202\247\212\036\230\331\364)\345\260}\225\355-\272\021\355</\0315'\r+IsN\0337\020\377\325H\035M\004L"
+	.string	"\020!\331\261\305\347Q\252\024\005\221\2333j\305\225\0319\371\321/\266)\\\211kA\022\033\324.\260\361\273\300p\305\225KAC5&\027\001$"
+	.ascii	"\302\375xK^v\340\372Gx*\030p\232s\206\210#[\226\242+m\260 \372"
+	.ascii	"&\300\177\340\202K\267\030ru\277\335\"\273r\217\"\314\205'\271"
+	.ascii	"\0208\0319\340\264\213`\312\316\030^D\304\214\316\326p\"91\272"
+	.ascii	"36v\n\036\2634\373%B\230\202t\324\026\b\023\020n7g{\245_\033"
+	.ascii	"\306AosM\260\022\261\231\354\360R\330K'\207g\246\023\023\375"
+	.ascii	"\272\t\361\342\321\360!'&\203\315Z3\031lDL\266\241\245\023\313"
+	.ascii	"\001\321z\311f\255\233\032\357\204\200\311Z<;;\262\226j\234_"
+	.ascii	"\242\tOM>[\223\360\243\247\224\2644\375l\217\2503\3530\265\253"
+	.ascii	"\275Ye\3262Tm\314\336\022|\2652#*7_-k\0374T\223s\316\211\332"
+	.ascii	"\234\365c\355g\260H!Y\233\332\233~4\273<X\340\2204\253\332\233"
+	.ascii	"\375P\\(O.$\344\311\226\345\333\234]`\023\027\201I\250\021\360"
+	.ascii	"\224BP)\"\023\020\005\022\314h\332b\220\002\031\252\353\006\021"
+	.ascii	"`Ac\205Ar\3372*\036\326\201\216\0201y'\205\205U-/\266d\354\033"
+	.ascii	"\267\006Q\264\327\235\344p\255\301\265\225\324G\\<\351\251V\242"
+	.ascii	"\366!\222\243\222)\203\324\005\277\205\030\231\276\3240\353!"
+	.ascii	"\033S\\\344\321t>\214\376=\320,\340;\265j\210[\207\357\024_\325"
+	.ascii	"`\2216\211\351\307\222\225/`\214\257\233A,\244\035\360-\240?"
+	.ascii	"=ZI8\365\351\034\360j\360A7x\321\317\365d%\207\374\233\316\024"
+	.ascii	"SH\323"
+	.text
+	.section	.gnu.lto_tcpDataOut.part.0.52.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`*\005-\035"
+	.string	"\226r\260J\260\324Q:\271\234G\017\222\261;\007)h+P\024\005\n 4\370\255\202\306\335T\347\264\3010+s\324\251\341\324s\002\333\200\252\r\264 \314+I~\372\331\231\313\337\276\303\330t<&\261\334\347Ci\325\243F\b\331D\356\224\002\223"
+	.string	"\217"
+	.string	"\237"
+	.ascii	"\2072\326M\357W\215\022L\005Y\31295\003\362\364&|y\316\377\202"
+	.ascii	"\336\244\233\375\252\212\"\317i?\307\231vo\322]\246\326\243%"
+	.ascii	"\253Z\177\bNM#O\375{\215xJ\236F<\265\217\303vP\221w6\224\377"
+	.ascii	"\222\352\245\242\020A\005k\255\264\323\205\361\335G\221\206;"
+	.ascii	"\311\235o\342\343\270Sku1jq\221\305\351\320\211\031N\237\321"
+	.ascii	"\212oh@\312\217+1\243^X\223B\206\357T\237(\214xs\316\234\034"
+	.ascii	"wj\255\276"
+	.string	"\220\213\333u\333$l?\260\251-\247sOu\003MG|,\204\346\226\271H^\362a\335#;\234\226\215\3234tzF\234\226\241\3231\217\272a\302\351X8\r\013\247_\306\351\027\235v\021\247]t\232|\325=\206\323b8M\303\3510\234\336\235\236\377\375\267\221\025X\2525\305\026-\365\005\275\232\361\035\177\324_\365\265\357\3678\017\337\207_U\r\232\202K\301\353\270\257#\310\227:\225_;\246t3gJ\027V\027\277\252\"B\323\324R\260\326\237\003\3624*\310E\276\323\237v\001.\373Z[\302\204!Sx\222\020\344k_\262\\K\256\313\322\"CJ<\327\316\226\020m\tU\370\021 \005@#\245\016\220\\\230\322\323\r&q\307\375\023\242\255p\351\212K\261\206h\360,\234H\315&iH\t \211\356}\034\307i\213\326\376IY\244X\355\"9\334\335\fNDz3\213\355\013\027R\303\001\006)\007"
+	.string	"\303\305\311\2621\034HMf\363\034\253\204\355R\336\226\026\023l\316\2657\334\346}\276\351\255\t\373W#&\260\326z\237\335\341?>\bH\252\265.\260*\341\343\3078\365ub\271w\350\001\342PR[\331\303\363\223\353\271\221.u@\224?5\017<7\234-G\313\341l\"n8\r\264\236\033\317\007Z\211\313\321tn\354\003\302\206\243\375\370\370\340h\257\207u\217\274#\264\274\021\302m^\325@\"\333`-\206\245\\,\037\025+5\002\300*\245\rP\266.%\251\033\342l\302\354\314\322L\241\221\331\230\235Q\342\311\354\254H\024 \005PJ\235\230\205\035E\321\234\303\354\354\310\206\023\223\330\302\354\253`\373\262\261\r\2558\251\321\232\224\007`K\313\252\005"
+	.string	"\2265/8=(-\246p\221\\\023\227()a\243\222\247`\225\331\0347h\250q4D\241B%\024FJR\222\244\003\200\002\231\231\243\333\022`\325\031J;\247D\242\253\373\177\006\364\244\207\n\362\300\264>-\231\303ij\274\013%\033\271\350|2\235<\260\264\231\241\312B\2000\324\316\235/\0258}\n4{\"\305V?+\332\305\254g7\347\245\203\260\351=<\bwA\n\205\033n\3463\266\036\033.5\220\340\343\307\274\037\220\325m\207j=\277\375\357\025"
+	.ascii	"\030c\205\350i\0263\347\363\205\203;\374\261\224\237d\224\341"
+	.ascii	"\347\206\235\003\322K2u\324*\200\216E\372\357\366)\356\214h\236"
+	.ascii	"\303\b\033\377\2407\366\215\317\b\200\2672J\001\310=\002\222"
+	.ascii	"\t\262;\034~n\274\215,\254\255\304<`s!\025EG\0047MDk+\263\267"
+	.ascii	"\006\213\004R\275\273\351\006\205.M\243S\006\304i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375`\375\003\305\020"
+	.string	"\346\330_F\360r\234\016\250\344+\373\272A#j\257/\277\263\317VbU\264v\016\220\243\267\363\274q\034\330I\201\304aq8\031\330eFDdqU\305\020\317\00453\311$H\340\007\"\036\225\265oao\364\001\204\032I[\356Q"
+	.string	"M"
+	.string	"L"
+	.string	"3\203\206a\370`\341\205\036\205.\026\2323y\337\367\242\245B\253\2404\311<\265hR\330\260K\271\340\313\004P\330\262\322%*$\020\300N:\204jS\204.e\336\367\251X 4\200\007m2?\225\213\224-e\216p/\317\363<\225&M)\3455$,r\330Y\274\336m\327\367\377~;\317u\367\331\b\222\3576\371\024\355"
+	.string	"E38\321\rLt\201\022m\200D\037\030\321\tD\264\202\020\275"
+	.string	"D\247|h\004\036\372\304\013=)KE:4\312\206\250T\213\305\241\007t}\332\320\0014\264\200\034=\007j\343\312 6t"
+	.ascii	"\341\370\036\221\204\337\251!~\007\024\3619uwfG\r\231\022>\255"
+	.ascii	"\034\237\307M\201!\302b4a\304\230\361\203\304\317F\216\237\201"
+	.ascii	"\273\302\343\205e\304\337\2723F\310\212\006\211\277\340\356\r"
+	.ascii	"\0272z\230\360\003RS\027\225j\261@\237w\333\347,\243\235\253"
+	.ascii	"\246=\203\031\361<\363\274\333<_\261sUq\370\330\214\314\231U"
+	.ascii	"\213\030\346l\316\342\246Z,\325is\316\b\332|4\357\3241D\317\001"
+	.ascii	"K\364\032\021=\0359z\026M\364\031\030T\250a\030\243Zj&mR\231"
+	.ascii	"\306\020\003\241\331\346\001\021`\030\2201h\"\224\354\204=EK"
+	.ascii	"\203\365\217\377\336\250\\>Eq?\021\254\017\230^\177\275\261U"
+	.ascii	"G\344\273H\347\306L\307\334 C\\;\354\376=\3648\324\267i\355F"
+	.ascii	"\365\250zdAN\343X\213\302\016\304\326t\245\351J\323\025T|d?p"
+	.ascii	"D\337;\272(*@\364\257\246\375\027h\344x:\024.\261\257\202!13"
+	.ascii	"\001\244G\006\241\254\254\026\235\223\250\362ROk\242_\266\207"
+	.ascii	"oV!\024\357p\003\246\006"
+	.text
+	.section	.gnu.lto_.refs.fd059c05d3928b1b,"e",@progbits
+	.string	"(\265/\375 cM\002"
+	.string	"2F\021\026`I\325\0010\f\303p\350n,\267R\271\210\003K\252\332&w\n/\222\203\204\307\311\250\314U|\f(\340\207\016\334\255pC\301W\337\364DF\364\017\375\226x\341\334\f\335\204~\352\217\376\235\r\032\320\313\375\211"
+	.text
+	.section	.gnu.lto_.decls.fd059c05d3928b1b,"e",@progbits
+	.ascii	"(\265/\375`\020B5\032\001\212\343\345hX LI9\351\377\273\376r"
+	.ascii	"\3762\206\270\270\357\370\252\274\270\210]\252gZ\354\364\314"
+	.ascii	"\317\354\336\317\334\335\336Q]U\037\3335z\335\006\246V\221\223"
+	.ascii	"\322Td\267\321Y\340\036/7\225\300\303-I*r\323$\006!\253\370v"
+	.ascii	"\344\"\201\315oq9\247\3773z7B\366\226;\005\267\005\201\006\241"
+	.ascii	"\006\370f\023\276\331\002\377\312!9\202u\325\305\226\326\243"
+	.ascii	"c\307\204\314T\337\r\252\317\371\313\206\177\323\360o\026\334"
+	.ascii	"BzH\005\003j\"\357\035)\363W\316\312\236\336\232\033TX\337\337"
+	.ascii	")\370\025\350\354\271\273\273\273\253@\347\357\026\006\341G\003"
+	.ascii	"\361qYd\311\002\244\357/\217\037\367q\216\331\312`}\377\356\361"
+	.ascii	"\366\3213\304\212\030\036}\233G\r\273\263\342\245\254\357\341"
+	.ascii	"\316\366\277\227\303\305\212\nL\337_\033\3707\t_Y}\316\326\001"
+	.ascii	"\205k\3648\262\365\275}\303\257`\035\325P8uD\300\304\275\241"
+	.ascii	"\256F'k\2603F\306\r\271\357\255\r\370dc\360\231\353\317y{\206"
+	.ascii	"\337L0:F\323\270i>\262$\373\266\214\236Q\301\004\320M\312\236"
+	.ascii	"\035;%vs}o\257\340W\001\234\365\256\n\340\354d\320\233\251g\214"
+	.ascii	"\013\313G_\0347a\370\\\224\365\347\304\211\253>g\216\027\376"
+	.ascii	";\251]\230MOgbxt$o\240kd\267h\245R\224 }o\223\340[#\370\002\262"
+	.ascii	"\352s\336\006\301\027\244U\237\263\215\031\364\360\370q,\323"
+	.ascii	"\367\026\007\306R\317\254\022+\005\243\030\313\272\316\325\256"
+	.ascii	"\202\325\273\337\325.\325M\004R\222\204\021\214\345]\245\273"
+	.ascii	"\027\236\321\022\027\254\270\234\263\007\031x\340\301\005\003"
+	.ascii	"r\246\003\337w\032~5sC\0065\r\b\005\214"
+	.string	"P\341Z*YV\267\372\245\332\240\201\021r\0053\261eEK\3632\236^\316;\302\260\232\254Y\302\246\006\250\246\205\235@\326d\231\263\362!\374A\177ES\271\252[m{\031\317\021\207|DDk\231s~\345\372+\332\253[=\223\001\317Q\231\223!\246dY\022\227s\376_\337\324\271\372V\343j\233\352\246\312U\270\nV\335*\233{Pz\340\301\004\203\0227W\301}\343\300\357&\374V\302\357#\374:\207\237V\177\316\3277|\253\317\371\232\006\277\216\301 \324\237s\315C\033\327\214Y\352\373z\005\377\257d\252Z\005\253ej\230W\264\352\345\036\2249\213\345\234\037\002\230*\206\307\330!g\036lX9+_\233\374Ae\352\230*\246\246=)\263\214\352\244f\n\230\270\234\225\036<\360\300ZA\363\006\345\274\257I\374W15-\307n\013\312\256\357\377\nV\323j\030e\366\300\303u\245\304\243\357W\340\217"
+	.string	"\037\006\\s\37599T\237\363@\374W-\257g\177\035\253d\325\314\205\234\217r\316\030\230R\\\240\265\350[\267T.\257f\265\354!F\2705v\345&9\347j&\202T\316\307j\326C\227\363\261\247V\016j\345\340.\241\272\232r\336\213"
+	.string	"\327,A\257Z|\316\344\2232\207\345\234{,\013 J2\372vP}\316{"
+	.string	"_\003\270\225\365\347\004\252>'\006\271\372\234U\254+\225Z\345U\254Ny\210\021\256s\224\233\344\254\254b7\347c\255\034\360\324\312\201Y6\344\350u\336_"
+	.ascii	"\237\002\270z\325\257\n\326A\215\362\372\244*o\036\225Y\231\263"
+	.ascii	"\262\247\203\324I\361\352\373\006\340W(\307\240+\217p\036\374"
+	.ascii	"\332\301i\357\356j\007\347\033w\36599\324\237\023\003\254\352"
+	.ascii	"snP\177\316\277n\375\225Im\002d\221JR9,ge\207\2357kFZ}\257\254"
+	.ascii	"?'\256>\247%@\0030\360\301\205\036\fP\021X\241\304\357\032T\030"
+	.ascii	"\356\3417g\370;\207%!\b\303\361o>\240\005\027b\270\005\277\371"
+	.ascii	"B\007\325\026>PE\370\320H\357\371\315\235\277sX\022Xh\001\003"
+	.ascii	".\334D\f\007\300o\306\020\302_;P\342\035t\013\235\364\013~\363"
+	.ascii	"\247\205\017\247\322\201\205\026\\8\352\325\021u\0050;\302_\177"
+	.ascii	"\025\206n\241\217\257\3407\315\277n\340\257\032\370\253\005\376"
+	.ascii	"\232\201\277z\340\257\030\370+\360\257%B"
+	.string	"\360\327\237\277\262\360\327\021\177m\341\257&\376\272\302_;\360\367\005*\211\027z\206\025\241\211\330\020~\033\242\302\360\001\310\352\n\370\315\026~\033dA \363\327\242\005\221B\004\177\277\331\017\177\365\t\325\337\007\177\013-\003\354\002~\213\377\236\301z\360W\027\376Z-\007\005\324\266vz\007\177\355\225\250\313n\242\300o* M\320\002\375\366\247\203\277\333l\002\376\352\263\031 \340\257%8\225\003\374m\202\336\031\360\337+\177{\371\255\001\376:f\013\360\267\322\t\241\277\372*\212\3405\370O\345\tx\006\377\255\373{\211\345\340\257&\370\353\t\376z\374\353\221\211\312\342:\277Y\377~\352\251\373\233&\374M\201\277M\370\373\204\277+\3607\n\177\227\3607\004\376\226\300\337\023\370\373\001\177[\340o\025\376\216\300\337#\376\276\200\210\277\217!>(\340o\003\374=\200\277-\370\033\347o[\3578\374\347\3407\201\277\335\340\267"
+	.ascii	"\370\355\005\277\355\360\333\336\337u\177\303\375\315\346o\266"
+	.ascii	"\277\325\376\376\362\367\224\277\243\374\315\344o$\177g\375\r"
+	.ascii	"\365w\221\277\257\376\266\372{\352\357\250\277\237\376v\372\273"
+	.ascii	"\351o\245\277\223\376F\376\215\364\367\321\337\307\2771\360\327"
+	.ascii	"\267\377T\376G\371\353\362\257G\177\375\300_\203\177\265\340"
+	.ascii	"\257\017\370\353\004\376\n\364w\376\033\005\177\233\340\357\031"
+	.ascii	"\376\026\376\035\374;\305_\213\177\373\376\006\301_\307\376n"
+	.ascii	"\341o\016\374\275\201\277\366\376\233\370+\321\377\241\277~\370"
+	.ascii	"k\335\337$\376\316\300\337,\374\275\302_\333T\270\277\266\375"
+	.ascii	"\325\305_\221\177m\361W\244\277\262\370\253\360\257\"\374U\305"
+	.ascii	"_\207\376\032\303_a\370\337\344\177\211\377h\377+\270\273\273"
+	.ascii	"\273\373q\212\037\243\371\203\206\0049j\370\277V\267\352MY\323"
+	.ascii	"\033 \277UU\214\314\311\312J\337\303\335\037:JcVs\177\\\037="
+	.ascii	"6i\320\034\361\030\341\300\372\021\306\203j\307J\224\221\037"
+	.ascii	";~\251\214,\276\324\365\275S\226\256\007\r\f,\033\255\344\311"
+	.ascii	"\340B\306\244\324\021\225\363\204I\351\n\324o\324E\022\023DK"
+	.ascii	"\337\233\003\007\212W\322]\337[\343\342p\233\261F\n\307\r\235"
+	.ascii	"\033A\332\234\331\370\275\321P\371\305Q\337\373t\266*\031F\267"
+	.ascii	"\276\207\273N\262\236|\344\f\301\377\245\321\264sf\tnn\306o\023"
+	.ascii	"\017\025\2255X}\257\2145%\263\251\276\027\306ez\323\364\302\013"
+	.ascii	"S\322\0329zb\261\364\233\344-\263Hi\322\367\306\030\003\323%"
+	.ascii	"\315\325\377\336\tf\211NN\307\213$^\032\037H^.~\223z\316\260"
+	.ascii	"\355\310\352{\221&W\324\261\357m\3615pvRq}\017\367\262\377\275"
+	.ascii	"K\343\n\223/}\237\343\204\237\363\002\377\367\350\032\365P\343"
+	.ascii	"\005\253\357\177\217\277F8>p\030\233\364=\\/\255M\233\260\276"
+	.ascii	"\3179\342\377f{W\345\336\214\325\331\272\333;kw\263\230\300x"
+	.ascii	"\261k\032d\276(\031\365\265o,\335\377\036\257,K\r#tsf1\320\202"
+	.ascii	"\234\335\033T\264\234\3115\230NT\217\0336t\007\324\202\310\365"
+	.ascii	"=\016\033\374[7\335\266\203\003lG\2326p<]L\240\246\274\335\302"
+	.ascii	"\271\220s\2305\"\005\251\256\257u\013\272}\033@\225\262+}yll"
+	.ascii	"\333\216\221\361x\243mY#\215.\253\357\032\034\2461\313-}\217"
+	.ascii	"\303\206\235p\330(\252&/b\274,\fk"
+	.ascii	"\n\032%ON\222\216 \261In,\277\346tHY*&\313,\2607G\324\254\326"
+	.ascii	"\313jZ\030\ndl,\355\025\313f\315l\232\375b\325X\033l\027\353"
+	.ascii	"\305j\261hv\214\275\301\226\261hl\030\313\305\236\261eV\214\305"
+	.ascii	"b\301X3\226\214]\263[l\026{f\323T0\253f\237n\251X\261,(r\313"
+	.ascii	"*\253f\263:\260J2\234\344\005\365\244\333\220v\211\306\331\270"
+	.ascii	"\272\306\222\030K/:\247\032\366\206\321V\225\225\035R\323\236"
+	.ascii	"8\344#\257*\254\2524\342\201L\3242\347lu\360\260@D %{"
+	.string	"-\250\224\004IQc\227\222\266\311\313\311\262\006\023\313\365\302K)J\034\226\262\333\250\\X\"\277\255\372C\214`\325\354\225-b\225X<0#\035\313\260n[\2035\245f\273\272\255\316\276\260j\266\212%\253iO93m\240\244*\253K\\\316\331T\023\"\227\005\002\367\267c\267d\277U\2620x\272\364\340\022\243\257\265\022t;v\237\034*huW}}\204\340\035e\3759\253Y\3659\217\323\003\037\347\t\037\347\005~\257\016\277\247\006\277\227\206\337\303\202\337\203\202\337S\202\337\013\202\337\303\201\337\213\301\265\205\217U\264\204\331\262Mr\234\030=1\365}\317\b\037\313\341c7|\214\006\037\223\3015\374\213\0174,\372\036\243\341\3431\374e\3659\217\275\360\361\021\374[\254\333\"\325\314\005\fV\034\031\335\365\r\n\272\305\272Ou2\367\204K\337c+\354\301\016\021\202%\313\254\252\357_\301\256\306\006\371\177\235"
+	.ascii	"\354|99y\365=\326\201\217m\340\232\253\317i{X\037\025\354^\354"
+	.ascii	"\217\237bT\226\034\365=^\302)\310\367r\036\267\300\277\245\332"
+	.ascii	"\321\323&L\031\345\016;\305S[VI\352{\336\034>\217\r\256\311("
+	.ascii	"\013e\223`8\331`\241l\216\261\250\262-}\317S\303\347\235\341"
+	.ascii	"\337\336\2606\304\242\326\222\254\r\373\324#$\255\213V\337\363"
+	.ascii	"\310\360y]\270J!\301\226\311\312\250`G\2633\256\354\341\301\322"
+	.ascii	"B\nZ\337\363\210\340\327\243\235)\250G;\317\373\201+\026o\nW"
+	.ascii	"\251\372sZP}\316\252\264I\002\350Q:\301\340\341\242\2121\331"
+	.ascii	"B\025\206\354$\036\215/\2702\266E\007GY\2504\351\373[$\313\242"
+	.ascii	"v5A\003\322\327\036\361\252d\272\255\276\3479\341 7g\223\262"
+	.ascii	"\314Y\331Yl\372M\003#\244\n\\bv]g\217Mg\2635\352\273\nf\215\177"
+	.ascii	"\277i\2716dS\342\254\261\347\254,s\316\313n\323\300\b\251\202"
+	.ascii	"\221*\326\330p\235\204\343\002\313\r\235\207\n&\206V\026\016"
+	.ascii	"\367\347\033l\225\365\347\024Q}\316\237o\370\247\032\374\323"
+	.ascii	"\006\3743\r\377\375\326n=L\232|\bQ6\3119\367\364\256\314!\241"
+	.ascii	"\321\367\247\227"
+	.string	"\266j\206B\r8\320\364\375\311\005\377\275\346lm|\222\344L\r\222s\353\215]\033\266+,EM\332\2134]n\022\253\037\\\320\234\341Q[\0061\323\267o\260n\262\230\324\372\376\254\202\037B\257\365\215\356b\304\211\262t\323\212S\376\325I\257\325\256\032V\323\200P\240\211\031\231\266\241\313\364\230\026\323i\035\246\325\032L\233\251`\275\3667Z{\251R\252\330Y\265t\323\212SZj\247\232\366\224\025\220t\323\322r\262\326_\232\006\217Q\231\227xA\222nZqV\352\225>\036\255`\345\234\215z\255\217\372\250\201\021\362v\251\262D\352$1\254\234\225,\326\372E'i`\204TA\013\225\032k\375\324N<Fe6\362\252\262\233\226\007\036zl\332\206\f\271\340\376\254\302\225\211\262\376\234\030hU\237\363\314\203\251\205\005\305\251\357\317\034x\212\252\253D %{K^VK\256\"QXm\205\245\003\253\255\202"
+	.ascii	"Y>\341X\342\310\321R\"\220\222\275\030d\206,\331\376 %\335\304"
+	.ascii	">I\342)d`,sVj-=i(\"\220\222\275\031FIS;\316&\002)\331C\"\023"
+	.ascii	"\244I\r}E"
+	.string	"u\003\253\255\214@eI\351\245F\"\002)\331{A&G\343\370C\214\320R:J\323\260J,^\024\252\253e\316\312$}e\237$q\024/\033\177S\351,=\326f]\326[\232KWi\261\326\322VzJ_i,\035\326d\025\254\2454\330\273F\3338j)\275\325J\336Q*#\247\030)Y'qk\270\304\345\254\364\200\247K\b\fe\001\356M3\370&\032\376\033\312W\330\2234g\224\327\210\rcW^\335ur\221\001\322\245\357\315)\370\246\027W;\351q\003\343mM\213+\253\231\350\034\221\261D\244\357\315\036\275\344\267Kj\307\036\235\276\214\365\275\t\025:@\\d\251\3655\323^\306C\003C\245\203\203\016\261_\314\374b\351t\262\261+/\325$7\260\211\322\312\371\t\210\307\254\t)\f\313\315/7\275\204\030\341eT\312-\272\276\346\231\211f\n\311A\307\242\257\331\345\003(\271)\272\2767\265"
+	.ascii	"\0313\004I\337\233\\L\263\277\267\023\266d\345E\337sx\302f\231"
+	.ascii	"\271\305\351K\315\256\35790a3\213\251\345\250T\365\325\267\353"
+	.ascii	"\313\316\177\250\003\"6\243\257i\305\274\2226\025\307\"\347\312"
+	.ascii	"\325\030\0322s\314\274\302\343\205\332\032.J\250\272\2767\253"
+	.ascii	"L\t\271\222\3217i\346F\0137}\317\301\205\224\233S\244\230QjW"
+	.ascii	"^\342\325\250\262\243\323\312\310'\240\236!h7@\265\301\377on"
+	.ascii	"\335t\262eF\271=\312Q9xE\224\330\321\305e\344\023P\3031I\002"
+	.ascii	"\363\272\031\345&X\210\021^v\366\344\005\216\2767\277L(\177\017"
+	.ascii	"'\253\307W\222\276\357\331\202\377\301\377\036\356rbb\352J\276"
+	.ascii	"aJ\323\365\244'\252G\2146\232^m\332\310(\237\301\316Z\033\024"
+	.ascii	"4\\\177\317.Q\261 \353\373\036+\370=Jp\222$&\023\234\353\214"
+	.ascii	"\"krZ9l\222`-\226\334d\022\346\346\006\252\257\251\304\224\361"
+	.ascii	"D\252)K_S\313\332\375\357\355\300(r\214\322s\205\004\311\325"
+	.ascii	"\212@\024 \313\374\364\004\204C\345E\206\354\373\036\037\330"
+	.ascii	"\3142\263nr\316\330\323\204_\225T\263\310+\230Y\344R\351!snr"
+	.ascii	"@\215\246\005\274'\t\377\246\220\nf\n1\257TPf#\016\225+\346\325"
+	.ascii	"o\0161\211\364\031\035\251$338\372\346x\311\365\347\254L\224"
+	.ascii	"\325\347<\317\034\025"
+	.string	"\225i\005\201\255\23477\254-\263\352\246\225\245CS\363J\3665\201\274LN\254\311\216\276\346\217\256\352\251:\263\004\331\327\364q\266#\036E\320\372\232=\372\252I\024\226\263\276&\217:G\266\346\242\233X\260\2522K,%eN\251\220\353\020#\317\216\032| \017ws\252W$\213J\251\357y\312\3340\243n\230Pg\316U)\265\224\314OI \0348L(l\364P\247\003\347\324\003\231\343&\0241\314k\206)\243\213\251\nW\337\363t\301\347\t\303\257b\325|\0023\237\252\230\207l\321\264\255\311i\345\244r\001\347q\342\344d\341<(\263\f\336\213dr\001\347\021\202\315\030f\f\263\211\r\003\2200\2313n6\2312\316\243\031kH\372\232K\246\214\377=\2360bif\372\376\246\f\223iF]\214\265\276\301\032]\204A\232I\036(\374\233J`\246\222m\263H\251\343\224\2102\033l\242\342r6["
+	.ascii	"\316\231\215\031v}\317\223\223\222.\221\003\204i\303VO>`\364"
+	.ascii	"\375N\234\2114\221\267\312\202/b\326\344\342\314#mk\330\302 "
+	.ascii	"!\331;6\007xc\\\223\213\0233\217\314\243k"
+	.ascii	"\204C6*S\005+?=\001\365\256j\220\241\245\357w\264\260y4\217\327"
+	.ascii	"\bP\231\230' \023\224\261\271\353\373\235)3\233\331\346\034\205"
+	.ascii	"\006\353\006\266\263\273fp\316yH\333\216\f\374_\271\337\272\377"
+	.ascii	"\316]\272f\273\301e\325\267.\353\3179\200\352s\3367A\277r<J\214"
+	.ascii	"PD\372\n \356\272\251\262\205G\217\276\267\215\362+\347\234A"
+	.ascii	"U\0035W\326\367:v\230\216\312\205\273n\025\354\276)s\376\272"
+	.ascii	"o\025\313e\303cTf&\020\246\350L\211j\321\342\274\377m\373e\363"
+	.ascii	"e\005\210\325\262\357]\006\375\266A \b\217%}m\232\3375\377e\273"
+	.ascii	"jzSd\312*}\253Y\3759\003\200&\3507\215\233\231/%}\001p\317\230"
+	.ascii	"\341\031\2332{\322\367W\314\035\363K\346d\256\231\247ll\023\241"
+	.ascii	"\210qM..?%\201\376k\303\257\031k%#\214k\255\007\025\252\032\326"
+	.ascii	"\312D!S\247\303\036\251Q\n\"w\325^c\024a\201\326\367:Z\360\377"
+	.ascii	"\372\376\317|L\346\234e\230\312\2344\3229\377\372j\326\n\364"
+	.ascii	"\357T[\013\360\377\336\001,(\263\221\230\220\234s}\303YcG\034"
+	.ascii	"\033\344\377\007\312\331Xs\316I\344\327\016c\007\344\3271#\241"
+	.ascii	"\2441u@~\355`B*\363\024\006\371\213GF*\245\214W\312\230s6vV\346"
+	.ascii	"\243\035L\371H\312H\204T\346dVJ\0319\344#&\016H\345\321\210\374"
+	.ascii	"\332\301T\221_RL\310/)\246\016\371(\033\363\321q\n\037I1!\275"
+	.ascii	"H1q@~\035\231\220G;\230\252R*W1Y\224;\214H\371\353\270\223sV"
+	.ascii	"Rb"
+	.string	"\031ur>&\263qL\303\310;\2260rT\256iJ\224<r\316\30603TR=\245QNC\036\221J\201\224\263\231\fC\004c5*s\316-\262\221\261\346\214\244L\346l$\345\302S\3169KU\265\026\311\274\223\217\216JFTR:HFR-\362\221\251\232s\316L\310/*\251\240+`_X\331Hi\254H%\251\214\225\315\354H\342/cu\333\371\n\362\244\364\3457\355\277`n\030\2351G+\253\2765\254\376\234\031x\t\372\375\242\223EF\027\227\276\036\314~\321\376{v\273\234cL\232\314\350\333\311\372s\026\240\372\234\227K\320\257\231y\346\214\033\231\276\034\334-}\3641\267e\324\367f\261)\270\273\273\273\243\313\371x\263\364-\273Z~\263\274\207gF\013y<\261\\\201RJ\031\353\233\223\271\302\276\220-\031\3432\275\272,9Z\351\037\366\r\224\034YU\304\332\212\224]\0261*a\336"
+	.ascii	"\261\353\253<\302\032r\204\325\027\311Ub\364\345b\335,#3B\356"
+	.ascii	"\025\004\266\244\326\330\305\335'\367\353B\271]\027\354z\335"
+	.ascii	"\255\353\344*o\223\033v\245\\\256;\245\202\335(\335u{\344.\231"
+	.ascii	"B\272/\352p\030\357\021\262\206\215\273Y\004R\262\227\304\"i"
+	.ascii	"9\245ti\314\261\270GwX5\230\\&\021H\311^\013\026/\226Y=\256\325"
+	.ascii	"\232\245\225"
+	.string	"\324\345\341$\271\306.\356\310\315\332\261\001\223\345\032\2738\247\253c\002Rk\354\264n\224\033\3442i`\204\314\307)\020\266\310\326\330y\340!\356\006\0324\006p\257s\004\363\362U\242\305\003\027\225\304G\222_-\\&\216\316E\337[C\007\321R#\253i\230Tm\322\214\365\275\016\020|\235\031YFp\236\352\210|)\362k\244\257tz\220\021B\245c\274\"\022b\r\013\306\220_\"M\243\351\254\313G\033\374h\032$\316\200\026\207C\300\264h\210\252\b\232H\321\242O\030L\207\202E'|\276\236bZD\204\302L\203\302`Z\024\016\201&\212\037:t\205\303`\372\003\016\207|C!\221\210\372|\034f@\205<4\374\206\320\023\206\031H\321b\317\016\021]AH\350\307a\005\nB4-\006\207v\322\237\n\342\020\305\211\"\025\006\211D(*x\212\017\030\f\r\025\t\205C!o\206!1E:\024\362b"
+	.string	"\016\207\204E>\013\204#zD\300\024\233@\004L;\020\001\323^\261\004\0210\345\021\242D$\210\200&\210h\021\2478\202\b\230\342\340\200\360!%\376\210>\244E$~\351\357\004\"`\332!%\376\322\022D\300\024\013\241$\b\016\375\202iP8\"%\0165@,z!\210B8\004\362<\305\207aP(-\376\020\211\250PZ<\205~<\"\240\211b\320\003\007\210\200i\005(JL\301\204O\021Mi(\201\b\230^\360K\177'\b\207'Z\034\016\231 \034\362R\0371M\177>\007\246D(\020X\001\341\020\037\030$\242B\364\005|\021H\370\200\004\021+xiP\205\212!\220'\347\005a0\r\376<\260\202\003\026\240(1\205\025&\206~\351\320\204\320\017\247D\007\032R\"\025(\244A\025E\341\217h\242D1\030"
+	.string	"\264\310;a\002\232\376\322\022\2500\270\302\02015!E\213\025\2340\241\204\024-\356\240(*\001\013\203/\240'p\3204H\364\200\220\020\305&P\031\210h\021%\366\240\260\302\210\024\356S|@a\205\021)4 \204\020Z,\022\026\371\360IL\211\320\342\357\004\0171%\332I\203\304\031t\204\204\250\017E\321\t\264\370;\261\203\026\177'|DE1"
+	.string	"\177'|$F\370z\204\204\250\017\225\341W\364\221\030\341\323)\022\321\030\210?\025>,\f\376R"
+	.string	"}\347P\210\016\005Q\370x!\212/\374\206P\370x\251\217'44\364\345\bU\024\r\r\201>b\021\320\227\203\016\235\370\2452\370xP\024\235H\211\303\024E_/\365\221\030\341\3031S\237\b$\240@1\364\371z)ZD\201b\350\343\221\030\341\313Ie"
+	.ascii	"\242BC\240\017\223\030\341\333A\205\2023\370pPXaD\n>\022#|8-"
+	.ascii	"\006\207vP\024\235\360\025Q\"\212\022Q\370tR\037J\202`\361\034"
+	.ascii	"A\350G\344\363\235\250\320P\205\317L\205\250\f(\340<\305\007"
+	.ascii	"\241\037\rB "
+	.string	"\204~4\234\b\016\201\370\200\001J\202`\361\242D4\244\367\227\376\204\212\314\342\211\246C\025(\361|\241\250\302\376\322\237\320M})q\250\001\"`\332{\212\r\204\202\235>\305\007\r>$B\211 \322\341\220\b\"\207\210\006Q\004S!*\024\304)\372t:\220\022\207\032\340\200\016\235\370\231\220\341D}\250\320\220\205\2248$\302A\205\206*.\352#\221\022\207D;E\3410\230\022\ryh\372\343\200P\321\357\004FI\020,\221\016\005\177&t\204~\250\n\251/D\bC\301\237\t\035\031\202(\020\345\200\007\234_\372;a\005\221\207\230j`\304O\f\300\337\211\241\241\237\t\350\220PP'%\016\211.\021\247>\021\2510X\304#\242(P\024\225\260\"\3052\020\321\342U\361C\211i\t\237\320\217\006\241\034\241p\b\274\351\231\366\b_\b\016\375|>\336S|H\201E\304\264\030\242\350[\201\246E*:\304"
+	.string	"\034\016\371|g*,\032\002}>\036\021\025\3160\364\371xE\"Z,\022\372|XH\030\214\301\347;\213\302 Q\321\347\343\t\207\301bp\b\365\371z\251/-\006\2078<\305\207\"JDC\372\201\020J\374\245(~"
+	.ascii	"\242\230\006O\200(\022\276\360\301\212\"ap\350\003\021H\360\221"
+	.ascii	" b\005\bT\250h\b(\f\202 \026\213@8 ]\201\n\207~B\"\232\n\203"
+	.ascii	">\241\037JL\221\022\371|\030\310\200\022\211|\2763-\006\207|"
+	.ascii	"\276\363\227\376\204|\276\223\370K\001\274(\t"
+	.string	"\202E\237\357\214\0018\\a\005\361\034\032\016K\360\231Bh\nD\205\302!\260\227\372H\bJ\205\301\"\374\240 \0236h!\003\026\300\300\017D\300\3247\364\013\022\321\"\210\"\021\225!H\024\002!\f\376T\200"
+	.ascii	"\022\213 >\020 \025\026\rMH\205hp\b\230\363\377\324:\245x\316"
+	.ascii	"t\301\212K\002\325\303\366v\204\244\206(<\245\244\257$H\232v"
+	.ascii	"\270\260\035\3758b^\341\253/Shd\265\023\017\331U[\223\021\264"
+	.ascii	"-opt\025\271iWJJ\207\rX\246Z\255\352\322awe\302\231o\324\220"
+	.ascii	"d\021\271kX\254\271[\242|\262\301\256M\210Y\207\317\270Q1\n\342"
+	.ascii	"b\207F\032-`\254N&\234*3\266\264\2502\315$Ij\212\234@N'\233\217"
+	.ascii	"X\215\235?L6\247q\007\026-\247\217\363\006\322\02154z\334:\242"
+	.ascii	"\267\2553<,\231\231\033G\336\250\314"
+	.string	"/G\304\346\264v\230L@<\231\252\241o\216\034\247\324\022\254\234\237\200\260\034W\322\356\324\361S\2527\007\305\270\245\357\031\325I\030\304\215\211\353{Bu\020s>\235O\347\r%X\265\316\013S\322\306\317\033s\313\267\266$\234#4dU}\337a\3139\343\234q:yHB\246\203<\372Q\303I\343\247\223\225+LT\372\236M\235\324#3\313?\256$QB\253\322\367\035\300\316\027W:\231\3561g#\020\224Ffr~\002\252NQ/\316,\375d\372\231\f1\302\313\342\\P\345\350\373\267\224/p[}\317\030\375v\036\271\202%\016\306\377\236\3201K\217\263]\315\231\321\bI\337w\250\001\277\003\326\335O\343\335\351b\306YO\027\037bw'\322O\027?\221\225\2131\306\224\276?[\234,\314\256\034gt8\372\036\356<b\022\205\305\326\367?\217N\243\243\230-%\267\215\222\347\004\352E>\217g\356"
+	.string	"\345\346&\235\033\263\256\252\213UT\\F\346"
+	.string	"\322Y[\"\245H\235\026\037\310\261/}M\271\233s\177\257\257\304\335"
+	.string	"\353\373\016Fl\306\335|\363\367z2Z\\\221\365=\007:\214\346\355\315\204\003\241\346\026Q\274\242\354X\017\263\031pIg\242\234\215\361\262f\215\311\246rP\032\221\341\302\332aZ\342\026\325v\223\315V\032\224$}\315e'u\341Rc\212\330\332\232\311\346\001\347-\257 \313\234\237\200p\242$\215\244\271\311f\205\312\\T_\023M'\325\265\3359\351k\236y\231\021\255\245\"}M\033\314\033\274,\301\350\352k\2321CD\216\306T\337s\340\302C\302\2041\325jW^\262"
+	.string	"IvC\027\227\363\023P\317\035\027\267,\223\314M\265\262)5&]\372\232c:)\310Y\335\233\276\246\230~\013\204\216\250\223\001\204rL\264\244(\212\306\024B\204\020\r\rMs#\026@08H*\227\n\253\250\017\023"
+	.ascii	"\004\214\2144\301\256U\216\031\231\021\021\221\024\224\244\250"
+	.ascii	"Ph\f\216?\224b;}\312C\225Ej\220\200A\231W\205yG"
+	.string	"RT\240\302*\332\2447\022\333\235\021\304t\231\354\241\t0\263\272m\240\0350\373\230`\325\375V\234\331{^\232\003e\374\352\362\212\254\204\356x\246\310#\251F~\203t\0272\027`\312/\025\205I\356\3141l\314abW\232\347\026\261\"\004\222jM%F\034\340s\365\020\307J;\006\364++c\305\006\205\3749b\276\366\365\235\255\347\207:F\360\240\344A\022\320)P\354\r\270\327\222#v\225@;dz\035#\327B\320N\204@5?\373\346\007+\236`\016\336\340\351\244{:$\367\205sE\020#\371\240\301B71!\221\373:\f\035\204B|\25757\265t\2251$&1LaDi\245\322\323\262=\035\323\024X\363\247-\2748\265\361\027\260O\301\013\311\003\013J\270\337\334\372\235\277\027\361@\n\241\275\353\326\257\333P\351^_\013\244\2609\224xt^\277\224:!\242\f\007\023h\b:\327\303A"
+	.string	"^t\b\312}\325\320UM\341\212\256\220\343\307\005\275\005\347\356\n\244\304\230\034?.\350-\342\t\336C3\204\312\261 \037\364\252\362\304w\360r\204Xq\200?\265\365w\023b\r\003A\f\363\340\343\364\275\365s\036\267\007\246\363\3267\210\202,\375\\qh\017\213\233\3309+\034\177\273\243\311\270\316\201\262\374\202\033\352\277\316\277\224V\325\001_"
+	.string	"\327\363\261\325yS?xw\353I\017-l\376\013\303\"\225Mzt\317\f82"
+	.string	"\032\3209}\334)\250)1]\2300\r[q\003\005\033\214\264\364\202\232\202\351-\210`\032p\200\034z\300kU4m\261h\216|\254\365\3057\337\353\261\f\335x\316\310\323\302(\f&5\032\327\225\206\300P\017\317\251"
+	.ascii	"\007\362\216\200U3\340j\363\251!-\327A\306w\r4\342e\235\\c-\346"
+	.ascii	">k\373\307\261\310`\334v-\242'\007\225i\313)\021\364\026,nI\276"
+	.ascii	"\331&G\023\217\004\327Ab\367\245\324\265?x\307!\2448\004\366"
+	.ascii	"\351[\353\034\226?-$\254\344\b\374\276P[\227U 1\372\306$Y\023"
+	.ascii	"\366R\275\303\325In\360\363V\f\371A\232\321<\201\276v\013 /C"
+	.ascii	"\200JX\322\254\223\001\361\2128S\350y]\2552X\234}\361\217\343"
+	.ascii	"8\310\004\355\240\257"
+	.string	"Pev\236m\224\262\237\033\232\243\260\\\314\033\272&\325\035\276\353\013\276\2314\341={\302M\261m\304\265n\224\004\007\3348\355\341\305\274\362H\n8\314c.\374H\210e\311\236\366\336\324\327\034\340\317\313(,\253\225\326\212\363&{\021h\005\0204t\003a(\255\265\2100\334\354h\367\207\262q\376N\213Be\n>\253\271$^\t\363\261\036\324*k\272\340\307\242\241|T\347\250eA\346\226\035\217\351\237g\361\334\005\232^\013\004`\342\2711\003p\212V\203\341\311\340\254\261\320\276;\255\005x\021\253\303x\360(\013\324\211Z\265+\340\205\344\203\361\027\275\224\025\016L\325\226_\221YwS\320hd\310)\213\372\345\362\357\324\212\353\261\374\f\\\247X\265\361\2744\266o\350+\244\321b\205\004\321\304\313\324\311\351\211AG\320\246\006\250\355)4\300\270\020\254\356\371\220\003Z\351cf[\344\370%_\320\275S2"
+	.string	"\212F1\233N\002Pz\216\213\346\027\363('\271"
+	.string	"\350\312\345\306>\321\212\261\365\355\273f\026\305\225NE\274\022\0010\223\r\031"
+	.ascii	"\0162\314y\342\257hh\271\021\036\b \252,\031\224\354O\260d\024"
+	.ascii	"\365J%\211\300B\023t\013\365x\336\346\027\242K\261\342\2158P"
+	.ascii	"W\313\352\312\260\313K\333\376\314^\202\347\320`\377\373\024"
+	.ascii	"1\275 QNdr\300\177\331)\306X\214.L%\261y_\305+\311\\O\036\364"
+	.ascii	"fd\007\322\005\016C\220\374\307 \205\326'\234\223&H\223uT>:\276"
+	.ascii	"1n\246\374q\316\007r/\210\301\005;\031\n'\355\264\307o\3274\347"
+	.ascii	"\323\t\342\274\357\027\224\017:*\370\002[8q\003&^hRU\"\347\001"
+	.ascii	"\241X$\261\017\250=\262\255F\315K\272\177\242\030\207\262\341"
+	.ascii	"\277tg\021\221\007c\236]\254\2244\n+\334iP\331\333\177x\370\201"
+	.ascii	"\260\310MG\361\224\345\204D%\330\316\023\357\202K<\204\300x\261"
+	.ascii	"\322y=JC4\372\r9\356QL\211\227@\253\325\320\0334Si\236\021\""
+	.ascii	"{\315\3467\201\271C\216\303\227#\201\217Xx\2175\341Y\022l\377"
+	.ascii	"\367?u\307\340\210\333g\365SB\212,\361^\342\324\360\t\t\264\312"
+	.ascii	"d"
+	.string	"\241\231\313<*\2405\231\007\263\225__\254@\377M\251\301N\364\307\311\225\032'\033\377\277\251t\325+=\023\340\253\216\333\030\030\305\304\202"
+	.string	"=\321\315\255\307\340mly\t\354\316\265\235\303\030\254\206L\330\037ag\306\311\372\321n\300|#\270\032\257\214t\320C\336\347\215\261)\306\236>-Fn\344\255\260\013\203\364\2716\250-\206\371%\031\301i\226\205\022$\206\316P\304\"\f\342\fO\265\322\320\361Pt\005T\357b{\330\004\203W\234\330\274\243G\221\006D\243r\261\241\211S\020/\3130\033\036\320}/\3577M\342"
+	.string	"\031\r\337\303 \\\334Z|\2042\376K$%\201\250\266\033`a\331\017\002P\035\240)\225\315j\036\026\204F\016XG\237%"
+	.string	"i\312\264\342\224\r\262\360\216\353,\300Q\330\37202N\316\353\005\223\341\330\2308c*\336\347)\351\035\364\320\305\2347L\354\034a`\361\3642\246\207\001\330i\336D\257\304j\027\216\274\207\252\212%s9\267\232f\343\223\236\221?4"
+	.string	"\247\237\232c\275\226\222LK\2777l\017\236\034l_\004*K\004\237\n\261\225g\331\005kc/r:Sx!m~p\007\252Z%>L\266\370\036\271`\026\020\f\177\216)}\371(\242\250\316\210Y\242\006\026{"
+	.string	"\320\3535\370s?J\177\244c\017\2564r\013\"\221q\032\225\235\261\274x)Edu\361\265\363\030\003\360\350\327\177_\345B\204F\364\036`wv\276\220\001\342\311\323\251\331\311\375S\274S\312\031\224R\037KC\300D\027\345\320\026\215`\304a\242qw\366\003,\034c_6:\214b\007\353\b\002p6b\205\232\321\364\033h\314L\347;\005\353\273s\260\201\374\357\315qY\007\277\320\246p\016m\331\270\332\330\337\324[o\020?\0175i{\221M\325l\023\236\233$~\245s\205g\360l\013\334\271\320z{\356&\025\270"
+	.string	"\311\032nm\355|\3034\370u|\221v@\267\312\005\306.=\3511m\305{\224L\272\021 \212\001\323\257\234B\355\017\305\006P\300\310\025F\\\220\007\336'\3647\025\262\023\034\251\276\031\013\226\354\362\264oh\fT\271#B#2\336[\f\232\373\013\037\r\246G2\205\261,\341\326\254W\303>\272\036\225x\257\233\321\002\227\005\f\346v\342\"wB\311\001^eN98v\213YI r\347\207\007d\013\224\212\006\214\007A\320\370\215\364w\230P\357J|}\345\345l\263{\262\364\307f0\037\341\311M\350\bq\236\363\234\360S\001\016(\270\022x\211~\254?u\r-E\307A7s\031B\275\030\007yl\215R\265"
+	.ascii	"\006\302\260\n\323\240\342\013-a$\326\013\016\275\357\371=\""
+	.ascii	"\2020~\265\303\302\303k\314[\305?\372\375\327\307\nD\353\024"
+	.ascii	"\007g\317\364\323\350Ok\254/\300\341\006\335\223\213\267\306"
+	.ascii	".j\357.\376B\264~e\215\037\377\357\177\016D\267\331v[\320\006"
+	.ascii	"\032\276\225\372\203\3325\347\331\300eMl\317\304\331\2562(\312"
+	.ascii	"\375\367\2515\177\222K%\356\200\201\365:m\367\234\277\254\373"
+	.ascii	"\312\236\326\313b\227\236!A\232\006\227;\321M\277\326\177\206"
+	.ascii	"\232\370\334`|\321\347%7\027\004\365\2076*`\225\244\350[\346"
+	.ascii	"\242,\263;\373\336x\345\374\033o\353\316\323\3608\343\002\323"
+	.ascii	"\246\243\237\205]\030\335\025\200\\O\261\374\334EJ\246\276\253"
+	.ascii	"\355~\222\267)r2\200K\373\377i\242\177\3728\311\005\177\002\357"
+	.ascii	"\321\334\253j\313\302\252\200\277\270\2624\344\312\375>\303?"
+	.ascii	"\f\232\272{V\346)\206N\210\341\375\220{\341.\212\034'\233\030"
+	.ascii	"pjN\020\305<;\263\225U\223\365%\260\r\236pvY\262\366\343\336"
+	.ascii	"\001+\237\353yD\336$b|.\266e\233\247\315C\376\353\026\377/\276"
+	.ascii	"R\036\336\241\301\307\373E\236\335\362\311\220\037q_\224\224"
+	.ascii	"\031\317\327\225~\374\337E"
+	.text
+	.section	.gnu.lto_.symtab.fd059c05d3928b1b,"e",@progbits
+	.string	"tcpTotalRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"tcpTotalTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"isTcpTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"tcpRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"tcpIsStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"tcpDataOut"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"tcpWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"tcpDataIn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"dyad_listenEx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"dyad_addListener"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"dyad_setNoDelay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"dyad_newStream"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"dyad_setTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"dyad_close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"dyad_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fd059c05d3928b1b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
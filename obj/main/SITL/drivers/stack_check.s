@@ -0,0 +1,229 @@
+	.file	"stack_check.c"
+	.section	.gnu.lto_.profile.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\302\252\341\340\002"
+	.string	"\002\302\252\341\340\002"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	"\003\002"
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 VE\001"
+	.string	"\270J"
+	.string	"\002"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\006"
+	.string	"G9\354\f\260\031\356\315\3410\257\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 \024\205"
+	.string	""
+	.string	"P\b"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.aaa33445b2ecde0d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_stackTotalSize.10.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"\322N44Pm\323\001'\243*\310\251j\272\240\246E\301F|\264\274\242k\f\371-\022\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2360\233\211J\230\0166S\206s\305\313\242\0344\026B\\\320d\024\342d]\0213\340\212\201\262\"\247\252\254h\351\366o\025d\275h\n\341k\352M\356\201\021\204v\265o\276\350]\203\177q\350\007,\277\035\372\230tx\375'E\313\221\335yR+\354\277U\220\355tf\372\2572Q\"\020\262\0331BY\0228\202a\273c[\374\215st\234\275.\304I\037\242\017\310\311n\027/\017\220\016\337\001\244C\265x\366\314\374w\374iP\210l\234\347Y1\330]\347\306I\334z\333\005\266\243\355\214\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_stackHighMem.11.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"}\007"
+	.string	"\322\21644Pm\323\001\247D\f\202\215\252\213\304zD\301F|\264\334\210i\f\371-\022\323l\226\3627\357\2616vrdf\226\235Z\317XtU\210\312\206%{K\231R\2362\234\211J\230\0168\223\246s\305\313\242\0346\026B\\\330h\024\342d]13\340\212\201\262b\247\252\254x\351\366o5d\305h\n\341k\352M\376\201\021\210v\265o\276\307\273\006\377\342\320\017X~;\3641\351\360z\320\212\226#\273\373\244V\330\177\253!\333\351\314\364\237\205\242D\340d7b\244\262$p\004\303\266\307\276\370\033\347\3608{\235\210\223@D@!)\273]\304<@:|\007\220\016\325\342\3313\363\337\361\2471\201\262q\237\247\305`w\235\033'q\353m\027\330\216\2663\002\t"
+	.ascii	"\023\013\275\263\030]\b\351P\345\342\232x\034\221\263\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 D\245\001"
+	.string	"\264\002@"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\f\001 \013\177\002\r\003 "
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\340G\204\245\236"
+	.text
+	.section	.gnu.lto_.refs.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\001"
+	.string	"\001\002\002\003\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.aaa33445b2ecde0d,"e",@progbits
+	.string	"(\265/\375`%\003}\031"
+	.string	"vr\257I\260XQ:0\021A\227\016f\354\302dI\203\313WC\2037*\032\232\340\023\002-\227\2202\320S-\345l\265\226\b\336]\277\252I(\304\350/\3459\3718\274\371i\256\246A\250c\331\342 \357\242\271/\013=[\"\215\310\024\213"
+	.string	"\222"
+	.string	"\235"
+	.string	"\353\273\375P\334z$\272\365\177\202\334m\b=\356W\332@\177\033\267\234\337f\254\277\317\330\337\030Cw \237_\301\353\237\373\307\375\357\377\370\377\305\324\325\237ELY\224\313\375B\br\327\215F|~\220'\305w\226\351\020\3322\222\224\026\375\247\216[\002\241/:\323\316\024\323\361\307\201\376\257\025\261\350\\Q\005\f}K.l+!\261\275!\265\215\2627g\333g{\311v\317v\222\355\3206\023\333\247\246\246\246&\333\034lW\033\334\022\377\215]\242\033\210\006m\324I\363\277\n"
+	.string	"\365\346\r\306\013`we\023\330\3232\370)U?\346\270\"\326(B\266"
+	.string	"en\333+\342'\317\327\233*\325\211tw\376HAOc\\\365t\367\343\320\203\344\353\317\230\343v\247XI*eEM\325+i\036\207\216\373\235Y\362\310QU\246\273QU\326\335y\334\307-qH/q\350\251\312Qwf\231\222gL\231\356\316\"!N\232\314\224\270\243\310\351H3\346WV\364L\377\362|n2\370u\250\311D\006\005`\350%\022\355\345\035-o{\213\364\024\257\336\317\022-\277\220\003\230\037\237\027D`\270DV\311\333\333!\256\271\361iD\272Q\317\006\375\311\355\245\272\374djwfw&\3341D\203\b*\364\312\020\275A\242\227\307\032y{\034m\217MZ\232\337\236\300`5\311\"\244\206\226\013\351V)\237\022\242\023\2137\311\256\271\331 0\277\321\377\005')8~4\300p\353\376\330\243\325\"y\201l\352"
+	.string	"\270\372\364\257\251"
+	.string	"Q\254\270\340\201\241\314\036@\205k"
+	.string	"\345\016\242w\205J\355\ne\037\326q\022:\262\230\255g\006{\t1\263\220\363\201V\001\246\026\313\221\2050\f\260\035\232\005X\3123\346\0211\253\261l<<5\326"
+	.ascii	"\033\254&\202m\2076Bt\253%AF\303\005\n\242\f\202\216l\226#\203"
+	.ascii	"\261zj3\022\264\232\007\326\016-\026\202%\253\365\260 \310\314"
+	.ascii	"L\3200\200\210\331x2\350\310b\266\236\002\226\321j\263\235\331"
+	.ascii	"\007\3216\256\007.\234\022/\306y\321\274hP\306y\265Z/WK\264\253"
+	.ascii	"uJb\357\221E\262\275\023\357\257\252\t7ZL\001C\327=\200\022\327"
+	.ascii	"\200\317\247$@\307\305\007\220\216\245\245M\022\377\217\365)"
+	.ascii	"P@z?K\366\250,\241\004, P\002\021\224\203\344\001\346R\364qq"
+	.ascii	"\002~\241\370\221\242\030\355\256\237\026\013b\264\202|d\206"
+	.ascii	"\235O\336J\311\325\210\\\026hu\n\211\036\200\241\305\3750\302"
+	.ascii	"\303\216\016\262\210\nK\f\306\026;L\3552\311\376\355\227\025"
+	.ascii	"\263\002\0274V\023yM\314v\247.H.\215\261\f\225\203\354h\354\245"
+	.ascii	"#\267E\\[!\232\031F\214\215>\314\272>\233P"
+	.text
+	.section	.gnu.lto_.symtab.aaa33445b2ecde0d,"e",@progbits
+	.string	"stackTotalSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"_estack"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aaa33445b2ecde0d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
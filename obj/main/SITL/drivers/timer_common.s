@@ -0,0 +1,250 @@
+	.file	"timer_common.c"
+	.section	.gnu.lto_.profile.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 #\375"
+	.string	""
+	.string	"\310\027"
+	.string	"\003"
+	.string	"\317\253\250\341\002"
+	.string	"\001\265\230\240\355\006"
+	.string	"\002\267\335\335\337\n"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 /\345"
+	.string	""
+	.string	"\200#"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\003\003\002\002"
+	.string	"\004"
+	.string	".ev\004T\002\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 z\205\001"
+	.string	"\004\002n"
+	.string	"\003"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\005"
+	.string	""
+	.ascii	")\034Ecs]n\342\261\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 /=\001"
+	.string	"\370#"
+	.string	"\003"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\001"
+	.string	"\002\001"
+	.string	"\002\002\002\002\001\001"
+	.string	""
+	.string	"\002\003"
+	.string	"\002\002"
+	.string	"\002"
+	.string	",\303o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\200\004\002\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 2\315"
+	.string	""
+	.string	"h&"
+	.string	"\003"
+	.string	"\001\002"
+	.string	"\001\003\002\002\002"
+	.string	"\004"
+	.ascii	"/F\300,\004d\275\001,"
+	.text
+	.section	.gnu.lto_.lto.fc20cd451668f1c3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_timerGetByTag.7.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 \376\035\007"
+	.string	"\222\21525Po\322\030 n\203\2400\025fK\362\026\035\024(\201\223"
+	.string	"\321\213\243\342h\b~\200\265\205{\316\030A}\2667\313\240"
+	.string	"\006\353\004\035\314\002T\2671H\334[\246\025\036\211\210Q[\235O\314\262hM\310+\303B\020$\257\013LR\300\017\346\311\240%A\260sp\264\270$\f\305(!g\256n\225A\306\323\370)r/\344\025`\037\310\273\b\323iF\001f\267\243\206fM\224\013\311\257=\347\177\356\033\0344E\301\370\355~\274\264\354\316\205\0316J\375\253\211\236ho\005s\244$\2601\342P9\355N\370T\202J\251\215\016TJ=\021\335\324m\253\246(B\tK\214\314\nI\244."
+	.string	"bww#RI\177\372'\374\017\277G\b"
+	.ascii	"2\003\202\341\243\302b\025\220k8\007\213\001\331!\342\353\232"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_timerAllocate.8.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"]\t"
+	.string	"V\321A=0\345(\035\200\213\307\326\231\207\2175\204e\344\225\315\206bYp\275<\320c\2724\372\017$#^\333\356\242\r\200(\222}\3514\200\342=P\324\313\224u$\200\266\332i\261m\262IJ\001/"
+	.string	"2"
+	.string	"/"
+	.string	"\006\037-\220\327\200\335p:<\002\347\262\363\003\316e<9x\f\364\377z\266\202\"@\265\352860\261\273\306T+\326\035o{\301v\205\355\232\251"
+	.string	")\022\031f?\274\313\367\227S\366Y\017\222\220\210\316%(s\304\354\007\210\357.\016\307\335\021\033\231\335\260\301\016\235K\333>\313[>\203\ta\213\025%J\353\364\204\250\203\034\020*\246\3540\205E\023\373\331\356\256c\211}\327\377H@\003\200!fW\244"
+	.string	"\201\275\2213*\266?\333c\303\230\376\331\033\333\310\243\330\264j\242\244\255\026\324\315;Q\211!\262\240\234\264\026\362h\327Q\355\242n\035W\232\244\272ipu4=N\324M\255\222fH\3014c\2533\r"
+	.ascii	"2\003\202\341\243\302r\025\020\\Sr&@P\"\214p\204\020\224\232"
+	.ascii	"\007'\n\021\2321\t\223\f"
+	.text
+	.section	.gnu.lto_timerioTagGetByUsage.9.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\365\007"
+	.string	"R\21788@o\323\001X\340\311\006 \037R\327\357\315\377{\363\r\241\214wf\320\226V_#\201\205\177\215\315\336v\235\360o\030\036\340\034\031\335\240\330\320$@`\364G\275\244\355\224\002\023\231\207\323\344\347z`\310>\227\027\2211\306\341\272m\3530\007\232m\032hz4\223\320\250gr\332\265M\214z\223C\340\016\"\243\023\324utj\352\036\2646\026\224\310\256\241H\225\354W\273\273\2466\354\330\220qj1H\331\035\275\270\354\212D1\331\376l\215\355*\276R<`E,\341\002\346\3221\332\017\271\310\367\221\ngv5TNv\353\201\0210\227\233\017X\227\325\005\254K\333NP\370\f\276v\214\254\022\310E\311i\267N\212\343\340#\350\237\344\325\207\207IH\n=\002tv\3271$a\334\324m\027\330\356\3306\005\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363\036\026\307\b\367\032\240"
+	.ascii	"\306\230\256I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002J"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\007\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\b\177\005\t\177\006"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.fc20cd451668f1c3,"e",@progbits
+	.string	"(\265/\375`\213\006U("
+	.string	"jIH\020H\200\334\321pM\021W\266\267 n\034F?!\004\"\215\227\3548\201\263\017%\361\225C\311\031\236\351\t[#\223\313\226\360\306x\270\377\302Ka\230\326\214\321\037\255\356\1778\204Z\264M\3130\206\343\301\374\241\270\331\261\311\226)\331"
+	.string	"\351"
+	.string	"\367"
+	.string	"ON\335\005\372\355.v\263\334\315\356f\273\333fD\276\3354p\255\262X\354\236\361Sl$\013\305\251\373dr\341:\266\313\244\233\203\202\265T\266\212\227\345\366\311me\233I\031\325%k\325O\335\315h\252\362\370\342\354D\233p\326I\204\352\307\327\211~C\023\246N\033\"m\326\234\350+0V"
+	.ascii	"\260v\212He+\276\342*V\362s\022^\036\275r{\331\375\352\324\204"
+	.ascii	"1\302\266N\024\210}R\224{\322\263Pzc\241\224\2150\025W!`$w@\364"
+	.ascii	"\032{\325T\335\357\r\215\021\226\343\307\211~\201\332#l\242\237"
+	.ascii	"\352\031A\312i\214 \275\371yI\372\363\221\377Hi~\236\372O\366"
+	.ascii	"_\354\177\225\377Y\377\231\377\261\376#\371o\373\377\365\037"
+	.ascii	"MKKK\373\217\342g\r\377\r\220M%E\204\234\250\224\3676\305J\224"
+	.ascii	"\257(\265\212\243\260\327\333\375\203\206\261\351\032;\252\177"
+	.ascii	"\331'U\313\360\373\037@Zv\346\003\307\211\236\207\352\317?m\241"
+	.ascii	"\261\273]\334\274m\034\346\234o\230\205~\035\256qP\327~3\353"
+	.ascii	"n\241\203\214\ndKX\343D\377\003\365\220n\226\247\3376\266K)\266"
+	.ascii	"U2v\344y;j@/qt\373J\035Q\227=\373mn\242\324qD\373\272\306\366"
+	.ascii	"uY\\\023]\266\373=\342Z\246\220\345v)ul\227\356\221\247\211\315"
+	.ascii	"\366R\030\245\022\335c\013\346\036q\355Rxl\211RG\036(\035\311"
+	.ascii	"\257\366\354\252\006ci\211\rUD\n\215\270f\373\272m\326\315L\247"
+	.ascii	"6\006u#]\243\231P\006s\r\233PC"
+	.string	"-\241\313ow\023(\016\223n\023\233m\020\267;\3100D\027!\260o\263wp\223\305\201\354\374\356\260o\267\260%\305^t\241\351~\317\260\031F\303d\270\fW1\032{\235\305\360\230\377\274\335\304\356V\360\003\340+\211\245L\016\372\223\207\312?\334\023\006\fo!\201!\345D\371\013\316\323\224\327\321\206\352\345\f5\225\342\244\241\376\214\241\376\204R\317d\237\364\347P}\223}R\034\367\244\315&\223\235J\033V\016\"bna\272\264\220cg\262\027\007\b\215\261\250\023e,\254u\203a\\\203\004c\305\n\213\361\214\256e\321\301B\315\220\035\025N`W\302\316b5.\311\033T'\312`\374\346\364\340b\243\345D\371\213\227\324\314dX\2619\321\227a&7I3^\266\232\352\331\t?9o}\213\2530P\267\262\207e\302\240\2536Y^hz\006Rh\227\305\303\005\327\271\312\357\200\210\251\344tSu\367\201"
+	.string	"df\336\256\223\312\317P\270\213\247\324\332'\267\231\335/\317N\017\301\300@\260ID\260\351\227\202X)\254\"N \3516d@\302Y\352\005kI\273`Mi\365\371v!x6\246\246"
+	.string	"\002\326\340\216\367SR\212\020\364\237\210\0258\024\374\375\200C8A&\335\n\334\225\370"
+	.string	"\334a\270%\355\220NH\b\256\027t\316\353\001W\337\232\244\036B\321\202\"#\023\266\033\03558j\220\336\350(\227;*\312\251/\312\325V]\322N\311\302\232\264c\362\200\013\352\214\202\276^\223m\325\001W_\211\016+\017\330\364cZ\201\267\240.i\207\364\353\331\236\313M"
+	.ascii	"\362\300\341\202\312c\340\373--\375x:\340\272\324\013\0161\001"
+	.ascii	"W\022=\340\207!_o\2674\304\0032\r1H\240&M*\3542\244\354D\245"
+	.ascii	"\274\304\233/k\3343f[\230\311\016\213\353!\331\025%g9c&\265W"
+	.ascii	"i[\222\334\242\345\3171\032\227\261V\315\312\250f%1{\360\347"
+	.ascii	"\320\270\013\2071r2\002X\221$L\fw\37594\346\022q\250\221 f\030"
+	.ascii	"4\206\320\220\314\004Q\320&9\200\002\021\252\253y\021\200\265"
+	.ascii	"\241L&MKRj\337\275\247IC\355\n\2307\222\030\324@7\327\3675\216"
+	.ascii	"\367\370\306\310\3633{\353\032?\374\"\344\217\351r\037J\254p"
+	.ascii	"\200\240\214\353\246\3665a.\302\\&\331o\370\t\214\240}\373<\361"
+	.ascii	"\265'\232\003\2226\210\364\351\317\236d\021.c6X\301\026\324\240"
+	.ascii	"\360\342\271T\224z\230\242\225\256\255<\002!\250\016\bW\210\037"
+	.ascii	"\322\363=4\1771\026\021E\244<\377\201\370\323\345\2724Z\247\210"
+	.ascii	",\242 \341tf/|\027k\021~\3155\017o\2656\026\317\b\020\002\266"
+	.ascii	"T!\020\273B\330&g\025\220R&\303\220\004\240.\335\331\244K\251"
+	.ascii	"J\375\3353B.\377i^\336\276\2061\n{\266&5\"b[\371\032\"_4\002"
+	.ascii	"\233\003\340\203\264\270B\250\260\263\371\3532~\207\370\003"
+	.text
+	.section	.gnu.lto_.symtab.fc20cd451668f1c3,"e",@progbits
+	.string	"timerGetByTag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"timerAllocate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fc20cd451668f1c3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
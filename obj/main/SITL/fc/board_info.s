@@ -0,0 +1,570 @@
+	.file	"board_info.c"
+	.section	.gnu.lto_.profile.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\235\005"
+	.string	"$\b\364"
+	.string	"\027"
+	.string	"\273\212\353\205\002\004\002"
+	.string	"\001\240\342\234\212\n\003\310\306\373\256\004\002\002\001\002\001\004\005\352\263\360\321\b\006\357\227\202\223\t\007\b\344\333\361S\t\225\325\244\224\r\b\002\002\002\003\n\013\f\231\300\241\373\t\002\r\342\217\301\202\r\006\016\222\222\3753"
+	.string	"\017\020\233\246\366\244\b\002\002\001\002\001\021\236\302\323\327\017\004\002\004\002\004\022\023\345\250\213\312\024\025\026\240\243\304\256\017\002\027\262\321\251\007\002\002\001\002\001"
+	.string	"\024"
+	.string	" \030\330\353\2521\246\260'S\036\027fSdmB"
+	.ascii	"0\031\237a)w_5^yk\324\362_\251\202\306t\nE\363\332\334\350\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \236\255\002"
+	.string	"\002\004\r\026\240E\303\001\217\256\252\252\252\no\315\b\2674\346\266K\327\322\226)\"\367q\266Y\006\271\213Blm\262\310\036\306\334b\252\227\004\245\001`?\230\334\323e \f"
+	.string	"<\217\024s(\341e"
+	.string	"\236\316\022C%\214\334\020\240\002\234\363\211\212\r\2346m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\365\001\355\006"
+	.ascii	"\362\b +p\305I\007\200\027\272\205\322\t\345KC\372\275\360G\370"
+	.ascii	"\026\202\f\340\2170\263\352\250\252\252\212\206\376\342\027\377"
+	.ascii	"\215\260\333\233\265\3356\0053\b\254E\365_@,\221\343.\035\264"
+	.ascii	"\"\361\2655\377\033\230\024\004<-\001:\211\300\233Jg\304\001"
+	.ascii	"\3226\362\030\346\206L\332\332FO\017\264\264\235~R\243!\246m"
+	.ascii	"\225\224\312A\306:\202\236\377\332>\377\311i\240\343\034\261"
+	.ascii	"\3473\204\360\233,\333\226\360\324h\020' \260\"\022\243\363D"
+	.ascii	"@yj\001\365\356\225)0\221\302\323H\323\rD\f]\240\345\3014\317"
+	.ascii	"1\251\217\007\367\247\002r\035\214\203\274\2431p\325`\324;\374"
+	.ascii	"e\r\034\3331D\b\260\f\362.\002\036rX4\\,\021\222\215\216\024"
+	.ascii	"\274\037;\302\n\336`\247\033\244\326lU\215\273\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`;\001e\006"
+	.string	"b\t\036'\220Ei\f\377?\243\b\240\212 B\217d\246\243g\311\363\327\327\257\273;\225\236-\276\225\337X{\316\t\334do\231R\252\016\250\241\f\225\324\205\342\"M(B\017\252A\004\311\301\244\300\004\n6\240<\006>'\270\252\370F\313\345\326\354@6\241\355,\025\202\316\365\217$\035\360"
+	.string	"\337b\236&cg\332\271\024\243\236\332O\355\226:V9\253\326\271\325\330}\277\324\310\213\004# \240\302\242\264\003\230\242L\360}\315\002\027\t\227\031\312\315n5\244X,5:\034\021\321A\037\n\330Vl8B\005\273\2021\210+\031\257\242\213\024\f\256M"
+	.ascii	"\301\30011\t\b\2031\212\353$\302u\003)\256\357\220Bd0\342\205"
+	.ascii	"`\214.\234\033"
+	.text
+	.section	.gnu.lto_.pureconst.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\003\230\004\006\230\004\b\232\004\t\230\004\f\230\004"
+	.ascii	"\r\232\004\016\200\004\017\200\004\020\204\004\021\231\004\022"
+	.ascii	"\231\004\023\230\004\024\200\004\025\204\004\026\230\004\027"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \351-\003"
+	.string	"2\004\017\032\260'\035L8iH-M\034\205\002S\004\376D\306\30266X/\fv\313\0247\326\222\205\t#\207Q\020\277\372S\235\006-&\253\206\277\227\227\337\376J1X\337t\035@\343\377\004\020"
+	.string	"`\0260_\315\231%5E\213&0\020*H\352\371"
+	.string	"VB\004\216\231\032I\227\231\232\243wl"
+	.ascii	"1\006P\004"
+	.text
+	.section	.gnu.lto_.lto.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initBoardInformation.15.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\344\001\235\017"
+	.string	"\266\232aF\360\262&\035 q9\206\323\361\372\240\201\322y\\&\363\366\255L5~\230\213EX\264(,\003\223\342\255\021\203\372\371\363y2\257N\323\367\252\207\243MS\214l\351\231\374\372\270\3256x\354O\325\340\315\222\275\245L)L"
+	.string	"H"
+	.string	"P"
+	.ascii	"\366A\314\262s\f\200\t \223A\301cw7\2759\353Z\204\232,_d\002"
+	.ascii	"\300\373Z\327F4\217\"_\f$\331]\230\204\036\2560\001\020\217\016"
+	.ascii	"\221\357\005\005\314\344x\037\361\344\360\2712E&\273\353\364"
+	.ascii	"\276\016\267\350\266U\266\021\330\271 2/\250\273\001\355\232"
+	.ascii	"z\231\027.g\270\t\226\321\356K\201_\342:->\316\2437\270\344\275"
+	.ascii	"G\337E{\274N\270\351\241\323\345\220\rs\245\332\330\207\2535"
+	.ascii	"v\246\343\3230\323\371\364CBhH;vg\206~\354,\366\200p\020\016"
+	.ascii	"\370\224x\336\023AB\251$b$\341)h\276\f%Y\274\205\211\344\306"
+	.ascii	"A\342+R$\033\273\335=?\305U\234P\251\224\366h\253.\344=\243B"
+	.ascii	"\314b\264\365\017B@.\324/Z\352c5vn\274R\310\251~\354;/>\216U"
+	.ascii	"8N{\324>\225p)+*\024\013+\023Wa;\245l+*\223\312vZ\261l%\004\314"
+	.ascii	"a@\2556\r\034\267\332@`\335\341\265&\372\314:ui\005\322>a\240"
+	.ascii	"\332\312\2506'\036\3651\037\221F\003.\177\274\240\303\0165:\370"
+	.ascii	"\f\031-POr\340H\222b<\3709\2140 \300\002\0311\272\003#\310c\340"
+	.ascii	"\267\276\027B\027Jk\"w&\f\303\234\303\261\034\265vA2\337Pp\017"
+	.ascii	"\2406|\261\203\214\352\213\264\215\202\277\350\271\026\254\020"
+	.ascii	"\007\312\230Yxj\237\272\022\026G\256\022\226\201\003[\310@\303"
+	.ascii	"@+V}\r_]\212;!\346\332&\214O\307\222\257!\246\331\215\032\245"
+	.ascii	"\230!{9\307\230RT("
+	.text
+	.section	.gnu.lto_getManufacturerId.16.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \360\265\006"
+	.string	"\242\f/5@o\222\016\230.\220\302;\020L\335\347\002k\022\300\362\362s\006\330\246\372\177\263S\246U\264\300B\217\233\261g\030\035H#\032F\037\037(\263\364\353&\226\020\231\002S\233\252\363\3614<X\234\312\001R\035\370\361p\" eM\300\215\301\225\004\204\005)\252\312\202\232\230u\245'\2712\231\242fw\244\261\342z\364mq\265f}\367\232\372\016D\356\342c\250\271\215/&]\351[@\n\201Jf\306\213K\242\274\223\217\037\364\232\013\322\020\320XA\354 -\254`\224\264dFx\354\300\324\227\251\300\324\3478\212\265a\267\"E0a\311F\2416"
+	.string	"\206\314\274e#Rw\375\023~\205_#\b"
+	.ascii	"2\003\336::U\b\3055\321\031!\260\020y\270+\235v\222\001"
+	.text
+	.section	.gnu.lto_getBoardName.17.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \360\245\006"
+	.string	"\342L/4Pm\222\016d\254\2529\215"
+	.string	"\272V1\373(\355\374\255*\200W_,[\273\333Z\325\372\246\342\332\021\333\200\231Y\236\250uC\032\265/ \323\373\243\211%D\246S\232\212\343\3514<X\233\312\001R\034\350\351l\" eM@\215\301\225\004\204\005)\252\312\202\231\230u\244/\2710\231\241f\227\244\261\342z\364mq\265f}\367\232\372\016B\356\342#\250\271\215\357%3sG\372\026"
+	.string	"B\200\222\231\321\302\222+/\345\343\377|\346\206T\3443V\020;F\013%\f\223Rf\204\307\016L}\230\nL}\216\243X\033v;R\204\023\225L\004j\003`\310\314[&\032u\327?\341W\3705\002\007"
+	.ascii	"2\003\336::U\be\227\3111c\017w\245\323N2"
+	.text
+	.section	.gnu.lto_boardInformationIsSet.18.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \342]\006"
+	.string	"\302K,3@o\222\016\3206\022\331U \315\314T\2158\227\202\032\206\356N\325\301\326n\366\n\255\240\005\026z\334\214=\303\350\002$\226\206\321\307#\2266\214\246\367\226)O\031j\323\341<DT\032\n\242M\233\326\341h&\332TU\264\214\301\024\205D\325,(\252j\030,\213\243\303\203\020b|Kjb]\221/<\327\253\322\365\004T:\034\370\b]\366\030\350\020\344\013\2208\372\357\303\005\r\002\226\314\216\314%U\244\224\221\377\363\230\031\032>[\005\031\270\362\262q\322\222\2115\f\251\325\263nI\212\200\222]\"PO\300!3\277K\344\321\261\177\302\257\360s\004\b"
+	.ascii	"2\003\316:#e\b\3055\321-\002#!\362\270\033\235v\222\001"
+	.text
+	.section	.gnu.lto_setManufacturerId.19.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\004\001]\r"
+	.string	"F\232]D\020\221\223\0168\255\240\030\215\217#\300\260\312\323\267>Q\003E\316\336\265t\203\274\333\222\364\347\016\375\306\326\320\276\333\030\002\310\\E\257\366F&P\270\214@\233T`\032\220"
+	.string	"*\354x\270@%\371do)S\nI"
+	.string	"D"
+	.string	"M"
+	.ascii	"\266\315\240\201\310\335?\324\312E\230RT\253\335O\323\021\357"
+	.ascii	"\036\241f\347\007\360F\217\330\206\303\001\036\nD\260\273\231"
+	.ascii	"WJ\205\037(\253\017"
+	.string	"\231w\002\005\260Rd\\\346\231\301+er\200\354\256\323\344i\270\257\333\236`\333\201}O-\373\033\245\266\330\207\273\273\326\223\375\230\037s:j\032\246\017\340\203\305\312\206\001\027\273+\255\033\373\"\266x\261-\2623\333\231\366M\034F\364\030\223w\354\236T\260\330\375\0268\001\366\350\357\005\256G\354\004\256\3077\245B\035e\211\031!<\250-\376vA=+ECu\024\333\003\324\356\336\305\027H\024\240vI&\027\207J\245\003)[W\226\227\031\030\352\356\272\206\244j\224\222e\177\346':\337\305\240P\336\364\350\207\256\307+\007\f$@\300\260\2202\"\0218\016\007*\331h:\240\217FB\210\363\351\360\306c\353|<\024D8\315\026\242m:\332\307\243\031\3216\034\211\346q\300\233\005\016\247\225l\033\247e\337\036\256\236|\231C\210\341!\305\n}\352\206\251QUlG5\bIOb\226\230\332\025F2\023"
+	.ascii	"^\204\306\033\341a\266\327\032mA\214\034\270\247\022#\b1\255"
+	.ascii	"l\"B@$B\020\217x\272&\374\\\306\315\257\247\2211\363U{Ua\356"
+	.ascii	"\265\005\n"
+	.text
+	.section	.gnu.lto_setBoardName.20.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"5\r"
+	.string	"6\032]D\020\221\223\0168\255\240\030T='\2404\020\361\263\203\324\016R\221c\327\323\247\316\337\226$\332x\034\354\255E\373\356\256\0012m\241{\2035\001*\024.\256\200\037\344\006$\200\212\253\226\007\242\222|\262\267\224)\005I"
+	.string	"D"
+	.string	"M"
+	.ascii	"\266\315\240C\344\356\037\013\312G\250\230\304\254v?MI\274{\204"
+	.ascii	"\232\235\037\300\033=b\035\016\005x%\020\301\356f^)\0256("
+	.string	"Y\201\310<\022\250a\231\304x\352\271\301+enx\354\256\323\344q\270\257\333\236`\333\201}O-\373\033\245\256\330\207\273\273\326\223}\324\2179\0355\r\323\007\360@\304\212\206\001\231]\224V\215u\021Y\270\330\026\331\231\355L\373'\376\":j\344\003vO\250\025\273\337\002'\300\036\375\275\300\365\210\235\300\365\030PGYbF\305\203\272\342o\027\324\263T2b\236b\353\230\331\335\267\370\202\210\002\226]\322\310u\2658\371@\312\3265\305\005\346\205\272\273\256\037\252\031\245d\331\2079\212\316oq\206P\336\364\350\207\256\307\353SO\017\032N!^RH\031\235\317F\002\b\267\331 \204: \2159\034[\b\310C\001\204\333l\037\032'D\003y6\037\215\303\211h\034\007\274Y\350p\032\206m\343\264\354\333\303\325\223\237z\004\030&dT\350U7L\215zb;\252=HJ\022\263\304\324\256\360\311\233R\003\022"
+	.ascii	"^\204\306\033\341a\266\327\032mA\214\034\270\247\022#\b1\255"
+	.ascii	"l\"B@$B\024\036\002\314e\334\374z\032\0313_\265W\025\346^[\240"
+	.text
+	.section	.gnu.lto_persistBoardInformation.21.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"U\t"
+	.string	"\246\221@9@\217\322\001\360\013\377(d\326\212\204\342\001"
+	.string	"\213\025;\021\332\304\2774j\362<\033h\377O6\305jx\360!S\355\303\216RvAc\374\270\036 \272\031'\326\b!R\246\0240"
+	.string	"/"
+	.string	"0"
+	.string	"s\224\373q\360\333*\350\007\210\247o"
+	.string	"\031\337\255@\246\"# \252\266\001VH\370\327u%\246T5\2369\2475\0241n\356\266\023l\023\330~\tcJ\327\303\3766\267e[\315Y\275V_\203p1\213\341\300\314\311\252\315L\026nE\304\366m\233\354\215\r\016L\006?\272X\357\030\2518\231\315\233\332:\265%&\364!\267\273\247\273h\262\2245\330}A&.*\245\331\207\235\004\364ALQ\322\207\347\374Rw\356\273a1\343\200i\240\264f\007\016u<\021i\264\300\360}<\220\f\211$i\364q\220\241\017Bv8\366\036\032>\031\341y\237\334\214\250o\313\177]\241%\206\022\323\227\334\273\262\275k\017*\016"
+	.ascii	"[\b\230S\023\226\206i\206\025\202j\n\244\220\210\3137\342\271"
+	.ascii	"\230\360]\3039\206(\343.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_getSignature.22.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \363\305\006"
+	.string	"\322\214/4Pm\222\016\244D\214*\237\250\233VA\255\253\252\2735\222\272>\377\342\276\375\377\327\252\3267\025\327\216\330\006\314\314\262S\3536\016@l\005\326\371\277\211%D\246W\033\253\363\361(0\\\034k\001V\035\370\361p\034`uA\300\r\301\326C\303\005#,\353\202\232\230u\247\037\3012\231\243fW\244Q\342n\364=\201\265f}\027\243\372\fF\216\364Q\324\034\306\367\222\356\364\r\023\202R\220\222Y\321\302\222'\257\204\343\007\275\346z\364\003th j\230"
+	.string	"H&\024$+\231\021\036+@\365e\032@\365\271\214\206\332B\267 \275t\\\250d%Q\033&!3oY\311\324]\377\203\037\341\267\b\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_signatureIsSet.23.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \346}\006"
+	.string	"\002L-4Pm\222\016$\2439\ba<\250\254%\031"
+	.string	"\200naj^\276)\331U\373w;\274V0\360\325>\330\006\314\314\262M\024o\343@\204\3013\330\337\032\3312\005W\231\267\351p\022\026,\315Sp\325\306u8\232\006WY\017.\023\360s`\260\034\304{\226\303d\331F\3026\020j\022_\220\206\\\227\343\b\017\026+u=\226R\330"
+	.string	",BX\372\f\204-\343;e#\3758\266K\t\212"
+	.string	"I\246\250\264\222'\324H\307\377y\314\006\007\237\257f\033\242b\244L\210\250df\256i\364*^\267\037\235<.L\260\021\250xA\310\314\021\033U\364\326\237\340/\370)\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_setSignature.24.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\335\n"
+	.string	"\206\225L@0\213j8\330\241\2403%\364C\trU\353\321\371\374\n\341\270\356W\262\354\354\337\233\214&\326~TQ{\r\332*\033:f\025>\021\300B\036\240,\332\034E$\364)`\027\2217\331{K\231R9"
+	.string	"8"
+	.string	"9"
+	.string	"\266\255\2611r\370QA\352\0070\234@\200\355\216\235&x\370L3\364\037D\3223n\300\265\"\236\262\213\335}\353\031@4eR.\273\353D\211\002n\355\266=ls\330\257\b\366Y\377\346\264\246\317ud\200i\260\210\355\246b\034\366\245U``\373\266Gv\305v\246\375\006_\215\3162y\304\256J\002\205\3351\303\030\3345\217\237\330\256q\227\330\256\005j\3122Jnj{@yTj\246\244T\207\3335\343\272p\312\r\366\035\374A\350/pH\224G]\363E\333\265k\201\324\313\300\212@)c\366HJE`?\333\335\265\252\002\033\020\364\301x#\035\220\320\306\203\260\306\362q\274N\210\b\210\3712\235\206\323y\035\fI\247\001=\235\205\302_\311\006\354>\337\007v\225q\257*\277\365\017\013\035\"L\310\273nMU\005`[\325\227R\017"
+	.string	"]\004\234\211\231\007w\300\230\241\032"
+	.ascii	"\"\020\207D0\322\021\244\321\204\237\313\2146w\261\251\246\207"
+	.ascii	"B\262\265\245\f"
+	.text
+	.section	.gnu.lto_persistSignature.25.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"M\t"
+	.string	"V\321?90\257\322\001\204\331070\230$1UF\340,l\230\366\255\231\202\254\035<{\034z\177\313X\0033\230b\037\251\334\317\262\200\021\326)e}\323\201\221qX\021\021B\244L)/"
+	.string	"/"
+	.string	"/"
+	.string	"\243\334\217\203\337VA?@,}\003P}7\003\031\n\214FDm\002)\220\360\257k\206xR\315p\346\234\326P\324\270\271\333N\260]`\333%5{<\351\262\354osW\266\325\253~f!6{!P\2313U\213\231+\\J\210\355\333&\331\032\037 \220\f~l\245\316\272\260(\231\315\031\034\323\236\266N\355\t\n}\250\273[z\213&\213\255\301\356\353!iA)\315>\354\"\240\357r\305H\037\236\363G\335\271/\207\312\345\001\3330i\376l<\220(\304\320\360u<\217\374\200\244(\324y\220\237/Bn\006\354A8|R\302\363>\251\031M\337\225\377\272\002K\207\311\211~\344^\f\333\273\016\017"
+	.ascii	"[\b\230S\023\226\206i\206\025\202j\n\244\220\210\3137\342\271"
+	.ascii	"\230\360]\303\307\020\374\334\271q\315\265\bMcPP"
+	.text
+	.section	.gnu.lto_initBoardInformation.part.0.32.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`)\001\205\013"
+	.string	"\026\023IB\020\347*\035\240\002\002\240T*E"
+	.string	"\270\367\242E\247\222\002~\222\020\271\303U\005-\307\346\273L\264\370\366\377\317<N\006\326\"\235T\t"
+	.string	"\021\"H\227#R\3700"
+	.string	"\224\036`&\027lG\333d\223\224\0022"
+	.string	"7"
+	.string	"9"
+	.string	"\326\235\034\327\345\225\255\343\224$\344Lp\345\356\326\323)\373\352\323\373V\376m?h\275D>\021^*\367\024\376\031|v\327\233\225\233\336\366\204\355\217\3751$dD\200\343RFq\3101\245\002W@\246\334%\353\251\3117hN7_\320\234R\373\036YI\0013c1\223\210q\3527{h \365m*\033\004O\017\300\266\312\001\317y\370\263\337N \f\343.\353\255S?Ds:Yv'.,o\347\315\230\347\367o'\314\236\177\250\355\242\354\026\354\0135@\363\\\002TF}\333B^\300\022(\250\225\033\356\350p\230\034\034\352\204\242\322\bCC\004\205\0315$\252\245\021\210TC\342\251v \034\2326\304\372\021\206b\005m{\377v\302L\017 `\315\2219c\266\t\230\024z\003\002\037"
+	.ascii	"``\3701\bKc\340\204b`*\020\227f \3129\036 \n\206\271\302\t[\201"
+	.ascii	"}\235(R\355\371\334\370\271n\036Y\326\361=\320\006\320\003\024"
+	.ascii	"\f\026\277\264\361j\235\242d\320\031\2123@\270s1\333i\021\375"
+	.ascii	"\2562\006"
+	.text
+	.section	.gnu.lto_setManufacturerId.part.0.33.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"u\f"
+	.string	"\346\327UC\020o\234\016\300z\354\"z\t"
+	.string	"4z\215\372\213\372\017\311\t\331pb\257\374l\203\272N\253\263t\377\246?~\314c8\364-\371#\024\004"
+	.string	"\242\212\004d\211\370\302\204Ab\266\037\253\357\231\030m\"wJ\001B"
+	.string	"?"
+	.string	"C"
+	.ascii	"/p}b\037p}\332\027a\315\246\224a"
+	.string	"\333\232\215\311\341G\017\251s\020)|\230\354\216\331\247vxx\225V\350KQ\343t\375\352\030\027$)V\210h\\\270\274\334\002\300\331]c\030\356y+\260\257\005\273V\225mi\371\361\377\205\311P\331\330M\235\304X\r\023\305\007\333\267\277*\331\024\333dS\254\362c\351\036$\003\343Z\310\260J\373#N\302t\017\322-\273\252\221\222\3351\301\247\021`\237\036\003\376\303\313\027\371H\350w\370\001\307]\237\001J\204\230\274@\311\023\013\220\326A\327\365&\036\002\022`\261\213\3728\210\347w|:\002(/~\372\240h$/\372\253c*@\224\300h1AOR9\254\326\255\335\235\005\237\347\023\2056\355#\3524\006#Og\361\226\361>\035\327\240\363i\236\203l\373d\035\247\201\262\355\003\263\314\001{\020<_\026\362\274/\243\334ZU]\344I.\265\202\232\203R\tVU\016\333\025\220\020\251\215\023\253\033\002\024"
+	.ascii	"<1\352(p\342\203\257,pX\314xg\225\316PcV\246\005\360\036@Q.\203"
+	.ascii	"H0\235\263\017\355\\P\023\031uZ\222\324\3005\357[iu\314\301\001"
+	.text
+	.section	.gnu.lto_setBoardName.part.0.34.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"U\f"
+	.string	"\366WUA\020Q\225\016H\235>\202\335P\3620\360K\263]m\220\352\305R\256}@lV\353\316\270\324\332\033\302\330\335U\003#k \266\265 "
+	.string	"\200"
+	.string	"\032\230\371\246\f&R\210\371\352K\203\206$\222M\344N)A"
+	.string	"?"
+	.string	"D"
+	.string	"'\240}\332'aLf\224\262mL\206d\361\343\007\324[\034.\200\334\330\035\271O\365p\361*3\321\227'U\351\372\330-5^\264d\210\2504\\R\236uhv\327\333\206{\336\366\002\333\n\354w\001\266\264\374\370_\263\214\230\254vQ#9\2265[\200\260}\373\261\221-\261I\266\304*?\216\376!20n\206\224U\332/q\017\322?D\037\260\353\362`\261;&\3704\202\355\323\343\013h\237[\027\271\n\321\207\031\202\347i\237"
+	.string	"L\270\020a\303$G\034@V\376\321\256?q\024ae\306\256\t\344!\237\017\373\264\204P\376\364\351\207\024B\362'?\366-F\b\026\016\032\026\264$\365e\315\236\355\356Z]\016\235O\327\200\003v\037\203P\007$\300\233\313\347\001y\0168`\367=\3406\036\016\344u\037n\003\206\334\345\200\277\b\035\220\233\360} 'y\266\352\242\310\257\270T\fj\215I+XU_\266'!0P\253\024\253\035\374\213\232\003\023"
+	.ascii	"<1\352(p\342\203\257,pX\314xg\225\316PcV\246\005\360\036@Q.\203"
+	.ascii	"H0\235\263\017\355\\P\023\031uZ\222\324\3005\357\277\266\214"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_persistBoardInformation.part.0.38.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\323\001\365\017"
+	.string	"V\333eH\320TQ:\244\362\263=@\221\023\001`\026\304m;\023\024\265\2070$@\220)\251&5\320\221O\006|\375o\301\321\275\341H\324p\033>\354#\360\017cW3B\254u\235\366\216\210\2212\272gl\237\3314\331D\356\224\002J"
+	.string	"U"
+	.string	"W"
+	.string	"\271\335\025\251_k\331\"\233\306\026}\276\205UJ\255\032\333V)\321\330\365\2216\373\b\035\r1r\273\343\367\251$\356\272\312\316\345K\231\370\272\276\366\224#D\206\024\261\211\036.O\336\225\230v\327\241\017\367\274m\006\266M\266l\020\257=t[\201\003\302e\320\227\324\034k\367n\025\307\266\364KRzLnvgAI6\304\314aB\326\300h\231e\212m\300\320\331l|tr{aL\340\342/f\314\"0\322:\304\250\300\221\302\343Q\274\317\320\003x\237j_\305[\3567\020\236\371\216\247($+\236\r\341AV\f\374\354\256\002\377\307\201\260\260\274O"
+	.string	"(n9$0\031\344\221\024\320\003\226h=\356\003u\002A\036\240\216\357@!\030\361\210>#\331=\345}\3477T\013~va5n\203\202\3524T3n\013\375\022\237\216a\311\313>\017\334F<\031\013\3622\007\236@\222"
+	.string	"3\300 )tyI\261\264\254Na\204\017t\371^R'\325\007\256d>R\001\2070\250\325W!\fW\237\350\335*\316\211\374]\336\225\203\332\004\323\230\365\335\356\256j\216m\023\036\233\331\215\214U\021F\221\266\203\007-,N"
+	.ascii	"\341b\372\362\037- \220\"JT\363\f\234\227\2250\031\016L\242\231"
+	.ascii	"lH*2\3101\206\2345Y&e\340\310e\322@\222\321\032B\342`\037$#\343"
+	.ascii	"\3455#?\311\215\2707k ,\315\275\020$\257#\374\030\007\016\272"
+	.ascii	"6\235|\331]{\027\313\022\220\304U\361r\0015ru\004\233\303m\325"
+	.ascii	"s\251\017/1E\301\375\327\2321"
+	.text
+	.section	.gnu.lto_setSignature.part.0.39.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"-\013"
+	.string	"\306\025NA kL:d\030\330\002\031\b"
+	.string	"\263\371\376x#\023\t\200,a\323\250J`\276\267\345\222\274=\370EAX\220\035\222\006E\264\360\005\240J"
+	.string	"\241m\203\031\255A\201l\031t\245\337Qv\220M\344N);"
+	.string	"9"
+	.string	":"
+	.string	"\276`H)\333\276`J\026?\272Po\260\241"
+	.string	"\315\303\356\350}\252\203\213W\311\211\276<\251\006\\\037{\205\303\007\r5\013*\004\227\224s\020\231\335u$\301=o{\303\266\206}K7\333.\230\031\036\330\276\375\030\311\226\330%[b\225\037I\207\215,\306=\220\262J\373\021.\241t\330\350\022\273\254\n\030v\307\214OcD>=\276\242\373\214|\242\373\264\017!\035P+\n\253\f\354\317\004\200\376\313\237\235\026\300\177]\366\tQ\270vM?}\372\242\356Se\223\325.(0\311\233\324\226\225;\267\273ke\331\226\226\037\377\317\312m\262\332E\005\2340\004\322| \036\016\021\347\213\360\306\002v>O\307G\250\001=\274M\307\373<\232\020o\023~<\313\205A"
+	.string	"\234\320\003\201`\350I\316\255\262\374\330)\362\027;\251\006\324\031\223\022\260\252\266lO&\004\020"
+	.ascii	"=1\bQ\324\033C$\021g\263_\220\200<0\242\\\001\221\020:\347\035"
+	.ascii	"\332i\241\3460\352\f$\251\201k\336\177m\031\003"
+	.text
+	.section	.gnu.lto_persistSignature.part.0.41.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`.\001\255\r"
+	.string	"FXYE"
+	.string	"\2576\035\320XN\340Ev\227>#0\361\321\273\230\266\235\332+\323\\\361\360e&\216\306\202\270\241{\033\242iA\030TE!\377\\\252f\253\252\252\352\321\017\365\202\220\204\264*\236\377\334\001V\033\275\211\334)\005A"
+	.string	"I"
+	.string	"G"
+	.string	"\266\211}}\236\20478D(\266\275\301ab\357\341\211t\323\205\n(\306\335\020\373T\226{WYy\276\034\245\234\\\217\372\001\0272-hR)\031.5^ed\273k\216\206{\3366\003\333\231}\226\266\245o!\340\320Q\331%\335\304\330\016\223\305\007\211rB\344.\003-P\250R'\230\022\343N\b\023\230\370K\211;\002\341\2514\"b&\204\303\013\260>9\017`}J\373Z\022G\227\334\305\363\023G\354\356%}\224\310\276\002\356\230\261\201a\003\352\211\177\220e{|\005\310@\315\356.\360c.\023\232\235\365y\275\210\343\013\025\020\374\226\273\200l\njv?\361)F\374\026\223t\362\243O_\202\365Y\022A\232\230\r\237\274\221j\262V\257VW\002~\340\001\211\f\260\346\331>BB\r:\270\317\346"
+	.string	"\323>\260\220\320\007\004\3238\022\314S\300\233\210\007\207E\3306\016\273^\255\256\370\250k\310\337\263\256\030\324\331\247\240U\325d\273\223\002AR\201Y\365`"
+	.string	"\322\376h\362\243\037"
+	.string	"`\340\374X\371~\270\273\0335n!&\314\314.*\210\254\366\2742 \247Ui\206]\320p"
+	.ascii	"Q0\314\025.\330\004B\347\211Tq>#~\306\315s\013\206Me\261[@H0"
+	.ascii	"\303\341\fUs.u\206\227\324\0245\357\277\266\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\224\001\265\b"
+	.ascii	"b\214.2pi\323\001\316om_=\273_\303mqX\340\270\227T\220\300\002"
+	.ascii	"\177\344\252\252Uu\205\177\264\332\367\025\321\354\273\311\254"
+	.ascii	"k\212\210\326\376W\275\255\2242\005\31629\037O'\2526KuP\233\301"
+	.ascii	"\t\2226\037R#0\034\0306\262\331\213\026K\260\340\246\226\215"
+	.ascii	"\007\027\272H\365\333\254H\210L\316\307\323\261\036\264\330n"
+	.ascii	"\334\242}\311\330\274\222\232S\016na\257\fNe>\301\\r}\272\\*"
+	.ascii	"xD\t.0p\004\265\\\243\225\310Q\236\323\266\t\353\001Z}\243\016"
+	.ascii	"\b\365\214N\240{H\216Q\200X\334\332\271@1\0018\333W\324\264\006"
+	.ascii	"\t\373\266\305\226\215\030c\224~\251m\335\002( \320\002\261)"
+	.ascii	"\356\f\002\031?0/\025#\2730\314\366\302|,h\257\240\252\2145I"
+	.ascii	"L\025S\364\335\030\270/\355|\216\317\375\334\317\3659\237\233"
+	.ascii	"\357k\302V=\024\312\300\035\243\275\022\260\032h<\204\032#\264"
+	.ascii	"\031\256\016F\367 &E0\340\314\225\3300\226a\325`cY\031"
+	.text
+	.section	.gnu.lto_.refs.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375 \263}\003"
+	.string	"\242\b\025\031\240'\351\377\377\377\377\377\377\007\336\376\377\377\377\377FZk\204\020\262\223L\001\272\244\"1\227D|\2303\032f\241\302V\221\260C\034\b\026\230?7\335\003\224\365\034\355\357\312\211\361H\023\255\347=h\315k\312\0262\267\207a\f}v3W\256\335\272\315\325E\t"
+	.ascii	")b\262\212\324r%e\346\013\215\037\272\256E\330\027\324\302\024"
+	.ascii	"+N"
+	.text
+	.section	.gnu.lto_.decls.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"(\265/\375`\004\024\rY"
+	.string	"j\215\030\037Q0\222J\032\016\032\230\265\200F5\r%=\211\364\245\027C\256<<\371\260\211\246\317\202\001J$\341\3216\243\300\0235ZC\272\232\373\200\232\377\244\354\255\250YC\314<4wgW\255\273\206AX\305\026\224mRa\211"
+	.ascii	"\276\217"
+	.string	"\001\344wO\266\233\224)\227\001\333\001\345\001\277.\256#\033\247\313\205\350\373\303\017o\331\\\273G}\263e\006%\234\002p\202\272R\013\304\003\332\037^\212\375\341\005a\240~l\201xke\303V\f\305bY{~o\256\336\320qz\t\324\357\225\237\200\352\0277\241~Q\360\266nQ\360\376S]pY\240\036P\364\254B|Dq\372oW\264W\237\034\254-P/N7\312\273\265\\\337\350V\361%\327\215\246\253\202gW\005\216\331\324q\213\227>G\375\227\312\277X\233\265\353N\331\364l\257V\256>\233l\022V\205\323\235\262Z\337u\245\234\201\027\337\031\253tVw\357\352\300\263\373\270k\317\020\335\307\236]\025\273*\322(\320&`\274\364\254~] \236\272?\2746\023V\370\374,\203F\357\347\006p\260\250\020\300\317\024\374$\360\373\371\304\232\260%\374;\202\316\317\277\025'\016\310\340_\022!\250?\023\271"
+	.ascii	"\376\017\003B\n\377\022\360A\316\317\023\374\214@\340\337\035"
+	.ascii	"\017\376\303i\t\220\376L\202\0023p~\006\341\337t;x\333\277\034"
+	.ascii	"\354\006k\301V\020\203\314\1776\003\034\305\317;\377R\360\357"
+	.ascii	"\001\377\226\370\327\305\277B\377\026\360\357\210\177}\377\266"
+	.ascii	"\370W\201\177\023\370w\305\277)\376=\361\257\211\177q\376\025"
+	.ascii	"\340\337\237\177{\376\375\375\233\363/\357\377\334\377\255\377"
+	.ascii	"?\374W\373_\367\377\315\1777\377\351\376\313\375_\363_\315\377"
+	.ascii	"3\377\343\376\233\371_\346\177\327\177\256\377\353\377\240\377"
+	.ascii	"g\377G\324\325\325\325\375\251\357g\255\237G\201Oc\222r\355e"
+	.ascii	"\257O\243\210N2E(\327\243Q\031\205b\2562\372d\372t\262\215\235"
+	.ascii	"<\032Q\223O\246\022\355\311"
+	.string	"\024\241\214\036\231\312$\024s{}\366~\311\262B\031\227:z\374uw\323Je\364u\037\227m\004\303>\032*\316G\027\351]\273Z\243\272\273\333\350\345\006}\366Vd\257)\253\2367\226\272\335\332\207\003\3065\256\335\275\243\221\306\355^Z\227\335\310\347\n\315\347\262\355X\366\257\223\307&$\364\351[B>wt\225\221e*\243\320'\021YW\224\252\221\253q\251\332\rj\251F\215\213\346\027]\322l\342t\2310qx\342\324\314\226/\347\0327_\261u\263t[\245\215(t\351\241&\327\335l\361\243\341H\205\215\227!\350ze\234ld\234\316\225P\221m\334\350\320Fn\327CJ\032,\234\372\234\234\226<}\020c\237\356\243\026\325\242\3314+\366\263U\363\036\236\262\035_g`\352e\330\237\t\321\205\307\252\0063/4\261]y\nS\226U/\227qf\260\200 \311a\315\352\221\321A\t\002\367\226\322\365"
+	.string	"e\311\312vl\327\232\021D\021\213\353^\337\300\333\242\255\227\260,o\353\303v\331\265fZu%\256\273\335\266\314\216Y2\033\304\212\355\333\212\371\002\261m\337\265;\331\300O\364\266_\226\215g\327}\264B\325\335_\257\177\277~\006^\354\333\202\355\330"
+	.string	"\310\356\"O?`|"
+	.ascii	"\343A\256{e\301\202E\t\026,v\276\200y9}\351nm\201x\021\304\240"
+	.ascii	"~\331\376\325\262k;\366\013\303aJ\024\247\013\206\350\033\346"
+	.ascii	"\307%I\034\247\005\020U\356\365\362\357\331f\361\211\245"
+	.string	"q!\341t\323\210\276ji\324\032''\234\2465T\234\355\362\257\331n\331u\205\356dw\223\bSt \023\366\206\323\343\034U\316Z\200\237\346\214\f\201\245#\005f\n\n\247\2747\343\261\025_\341|qB\223\234^\255\027\3540d\f\247\314\303\3069\035\341\316\254\331\251A\303 9\345\2523\224\277\327++r\004jN\375\371\311\337\313\001\003b\b\225\032\365i\031\225\212\212\235\032t\020<[Z\264\222\250MM1\023\035$\232*\344\251J\035\2236;Nb\332\240d\352\222%\354\354u\277\271a\312\222\023@I\024\026\226\022%\273\356\"rT?\2523G\236\230\250H\220p\022\265!\030C$\210w\244\013\221\264$q;\263&19\"*\024GA\261\023\ne\247\030\036LYV\277&\221\256\343\364)\223\372\035\232'~>\261\263H\021vf\355\204\251Z\223t\366tx\002m:S\277\313Z\260\005#"
+	.ascii	"\214)\313j\313\266"
+	.string	"LJ\020\266!\b7\205\b\341f\0308\246,+\236\021+\316 5\234\233A\244\274\241\265\331\201\246\261\2455Q\277\033\302d\032\230?~8\323(\320\253\035\234~7\203z\236S\331I\214\2356\272k;\301\360Z\256-\316^T\036\354\203\0077\365x\017nR\215\335\306\265\235\026\332Cus\263\204\206\231\316M\033\315a\003\033\243f\343zx\240c\002\342\212z\256\372\"\326S\246cV\342z\271l\201\344%$\353\340=\235\226\335\\\006\235\215|<'\3058\311:\266\227\335\315\336\221\271\302\224%\327\315f\320ne\263\202r\312:\016\347\353\001p\300T1\001\343\364\354T\317H\365\347\237\327\375\003g\355%\322\367\305\331\r\372\177\273[\003zW\200[\267S*\215\372\004\313q\310S\364\273\215Ke\024\312\350\243\214\036[\311\265\306\364Q\256m\204DG\243Z\271>\215\351\323\310\275v\022\212\331\311A\034,"
+	.string	"\213J\036\354\374\206\220\221\360hX$\016\005k(\341(\022\036\r\r\211JC\001\340\300\241$\024\"\tsZ@\032\336(\"\tsl"
+	.string	"\2038\322\027\222\212\204\303\"1\207\247\030\234A\224\001d\3443\362\021A\202xD\034\006\223\b\230\341\013\022\177j\004\213\300\032I\"\020\201$\230\360\361\240\030$\226"
+	.string	"\300\205Pq\bL\022\212Q<\022\036\235x\321\3210(\f\032\251w\340\201\005\036\200\341BN\216`\221\370\302\214\021\305\"\215 \fGD\336O\374\206\220QR"
+	.ascii	"GJ\n\016\207\212HH\303\241\035\"\r\243#\033B\244\n~\275\0322"
+	.ascii	"\206E@\033JB`\016\236`\016\340\007\275bp\206\020\351\250\b\314"
+	.ascii	"1D\262!\224\361S\244\001\243(<R\3129\021Q\005)D\370 \003\265"
+	.ascii	"H\b\311\206\360\210F\215!\020\211\205\241\"\033C\302#`\216\241"
+	.ascii	"\242!qH\310D18#8T*\002\205FGD\037\016$\244\0304p\206\300\033"
+	.ascii	"E\351W<\373\211s\346\244\215\213\323\2633V\353\211hd\033\323"
+	.ascii	"\230\032\247amU}\245\241M\205\2555\231Sa\315\t\220)\356\202\""
+	.ascii	"g\b9!T~`.;pcN\316$S4%[N\234\226\225\361\226\2361\207K\023H\320"
+	.ascii	"\0266\033#[Rg\306Zz\314\244\326\306\314\255>\254'\\\220p\372"
+	.ascii	",+\346\177\317\322\23002#d\334\354\271=I\3531\306\226\2265\006"
+	.ascii	"\207\305\031C\210\246#b\334\304\003\262\303R\352\212\216\364"
+	.ascii	"\313\006)hX\235N\220\031\232f\300\316Vt\350\264\204a\343\224"
+	.ascii	"\275\370K\007\032\266\266\266\362Z\026\023)N\271\213{\350\202"
+	.ascii	"\3421\306\251\231\245\216\333\r;\330pq\363\320\205M}\211\256"
+	.ascii	"\227\235\266.\264\257-\246\202\243\3459\247<;9\357p'Le\267f\327"
+	.ascii	"n>\215g`\230)\337\252\344Z\331\f\372\261\311\022\367#\312\231"
+	.ascii	"\312ye\340\005_\365h]\245ar\312Z_%h"
+	.string	"\272\224R8\201\275\250\301<\205\024$\"\"\"\"\"I\222\244\003Q\005\204 \006\2554\017\021 !\303\214\020\211$I\222\341\321\340@\025K\376\342t\337g\235\206\241\320w(GG.\325\250\013\364#\303\302\177;W\244\312\277\\\361|\266]\356\021\2778\241\204\206I\f\310\201\310aP0&\322\206u\234\343C=\021s\357\001\236\2768\277\350\316*\3028\007\210k\034W\232\027\256j?\2347\002\017\335L\241&I8\355\221\177\306\320/[}\007\316=\225.cB\004\200\017\220\020?W\210\340\237`\221\322"
+	.ascii	"#\2717}\\\251\276\204\344\363\326\207\0016.9Q\236#\377\336\325"
+	.ascii	"\373\177\354\017g\257\200\3308`?\265\345\311R\301\252\177\355"
+	.ascii	"\371\351\224\002\251E\352T4{!3o\313[\037\024O_\335\006\216\361"
+	.ascii	"\251\b-3^\024\b\260\232 T\343M@\373Pd\017\351\037\311D\336\213"
+	.ascii	"]\0333\302\234\213\006\351\213x\370\354\2062\343P\362Ic\022A"
+	.ascii	"\207^\016V\340%\244\004\336\344\001P\021\016NO39\301\224\270"
+	.ascii	"R\265D\344\276f!}q\024H\311Jz\304\302\3632\220~5\365\324\363"
+	.ascii	"BJ\007o\320\"*\213\211?\t\331B\234\2331r\203\b>\357\245\0043"
+	.ascii	"\"\323w4\2449_\272C\343\365n\274\253\303\324\023\005\307\227"
+	.ascii	"\334v\273h~\024\3421O\237\004Y0\266\343XqO\bU\211\007\315'\322"
+	.ascii	"\364\226M{r.\255zg\226\364\363\227=v\f1\267\372\246"
+	.string	"_\201\300I:\325{\315\245\307++\277H\231\303\032IibjE\363\227\244pH\374E\374iH\027\034e>\305\3227K\032\376\304\247\330\031\331\t\241:\351\240\322\rD\t\223\004\f#\347\347:\334\244\210\312\316\246\024\037\363\210z\216\025V*\322\375\2020\237V&\352\036\021\325\005\032=\315\027@\372`\035D\324\346X!\020\375\\\2027\271\2754\032u\273\002\016]\003\004}\370\022\212\206\360[\347r\207\203\310*O?\371\337R\355\231l\201I\025\3061#\f:\203\034\212\277(\002\212=\025\223\036'\021\342\224\200\236&+n\256\257\230\222\2639P\021\242\331\001\207\342<\241\t\\\347\321\3309Q&\r#\204\267\220?\016@!c\252\340\312\200%pS\311\264t<C0\\\317 SY~\375\207\001<XGL\302K$?U\350\031u\367\3149\270$\255\260\375\363\310\003P\260\306\211\270\324\303\b[m"
+	.ascii	"Bg\027o\342\317{\013\212i\375\341\267\025\305\013=\244\316\202"
+	.ascii	"`K\374\347\324W\016\2707\211\316[c>\374\324\031v\271z\016\346"
+	.ascii	"\221P\177\373f\3323\300\323z\025\375\241\r\345v\374KK\353\376"
+	.ascii	"\017\3676\346\223\263/^\022<g\240#\231\276\027\364\250\327M&"
+	.ascii	"{\244\307A\273\264\312\201j\337\230\007|\364\317\374:\264\204"
+	.ascii	"\016\257,\025\3136\203\206s\353\313\353c\374\247vQ\036\013\003"
+	.ascii	"^&\246\223`\362N}\2129\202\360{z\313\367\215\267yX\372\234\307"
+	.ascii	"\362\347\342\227*\270\264\367\215\276\002n7p\021\3523\242O2S"
+	.ascii	"\352p\274\025\344\313\311\3516\223[\221\262\374\332\024\253\356"
+	.ascii	"\230`\367|\244\316*Y\270xL\025"
+	.text
+	.section	.gnu.lto_.symtab.bc73f5c76d2aa0a8,"e",@progbits
+	.string	"initBoardInformation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\001"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"boardConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bc73f5c76d2aa0a8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
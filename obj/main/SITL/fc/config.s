@@ -0,0 +1,2437 @@
+	.file	"config.c"
+	.section	.gnu.lto_.profile.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\327\001\035\f"
+	.string	"\244\021\313\002"
+	.string	"\""
+	.string	"\263\316\370\260\t\016\002"
+	.string	"\002\001\002"
+	.string	"\002\002\003"
+	.string	"\002\004\002\005\002\004\001\240\342\234\212\n\004\007\321\211\300\200\b\350\223\272\372\005\t\240\270\375\251\005\002\002\005\002\002\n\262\374\202\245\005"
+	.string	"\013\235\363\325\334\bV\002\006\005\002\007"
+	.string	"\b\t\002\n\002\002\013\002\f\005\002\r\001\003\002\003\016\273\203\325\342\t\020\322\330\224\374\nn\002"
+	.string	"\002\017\002\020\002\017"
+	.string	"\002\021\022\002\023\002\024\002\025\026\027\002"
+	.string	"\002\030\031\032\005\002\033\002\005\002\034\034\323\307\351\365\016"
+	.string	"\035\331\263\275\357\n"
+	.string	"\036\235\357\220\225\013\002\002\035\002\035\037 \202\312\321\202\003"
+	.string	"!\267\333\375\360\007\001\"\227\316\342\246\007"
+	.string	"#\312\302\204\263\006"
+	.string	"$\377\354\255\233\013%\236\376\250\313\b&\350\300\306\254\005'\231\201\201\232\001\004(\365\336\333\371\r\b\002\036\002\026\037\002\037)\334\237\214_*\261\340\353\213\002+\352\263\360\321\b,-\364\353\372\210\001.\360\377\373\334\f/0\240\301\276\347\0171\271\230\252\375\00623\240\342\234\212\n"
+	.ascii	". p\002sS\243\007u\371Dv\377\2235\320J\202\302\365G\314\2445"
+	.ascii	"N\"\343\\\371\332Jva\212\030_v\335\230v\333\360JV\021s\001J\b"
+	.ascii	"\274\334\315\364\304\005\2612\240\234'6\016S\214w\274K\277 \b"
+	.ascii	"\233\262\375\346V\274E\020\261`\256\326f\275\253ect\223\002W"
+	.ascii	"6\250\3007m\232\356Z\304*\312\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"m\003"
+	.string	"\022\004\013\016\340\266\302\001\374I\n1V\021\334\272\224\001\316j\227\232\223\364G\023\332\307\321\206YVIvd\201y\274\0051La\256\031\254\206\257\033"
+	.string	"4\t]\201\301\241\304\253\310\341\f\321\352\300\253\276`g\346\272"
+	.string	"\022\230\232\340,\003\310e\265\0037"
+	.ascii	"\356\345$\021\323\200S\272(\204\310\031\360\224?\253&P\342\376"
+	.ascii	"\fP\216\022\r\f\001"
+	.text
+	.section	.gnu.lto_.inline.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\362\004%\016"
+	.string	"B\217880s\322\001\360wz+2o7\247u\235\267\350\346\306Pv\006\340\3677\270\323\256\253=X4\215a\231\b\207\"00H\001\273\335\317\203+\251\321F\"\225\220-\323N\001\236`\221\260\370F\2244\fC\241\314>i\214LG\213\342\321U\343AB2\204\224\262\3424\257\026(\255\331Si\233{\214\032\253\214;\312\007R\235\004\t\370\301\241a2x_\031\231qi^P"
+	.string	"\023.\236\263\273\230\271\337\034\200\273\253\231t\322\237\335\335l\340\3078Rw\023\343*%,\036U\241\016\202c\302\372\213\00762\373;Jj\212D\230\333\372i\310\213\303\305>\026e\354n\3126m\001Z\351\367T\032\300\321\266\350[t7\335\315\333\036\351}\357\273\273\231m\372J\347\243\247\340v\374\324f\250%\005\301&0\266\023^\250\001:\232HLS\222\3024\006P\242A\350\254<\022\340\023)IS\nI$d$\222\nH\"\t*I\301B\2455h\340@\311*{<X0\345\351\307\027\"\222g9\234{\267\013\242\243\330J\203\3156\271\252\245\255't\\V\202\224|&\235\331  \f\200\254\2008\264\rl\362CA\020=\256\266\265D\215_\322}\276\344\331\02315\b\001\323\274oOd\372\"\366qk\021\375Ua\375U\f\f"
+	.string	"\210+\f\224\200\2376UD\360\245\305<\342Y\272\320\267\215\331\246\377\020\252\200\247\350i:0i\375"
+	.ascii	"\334\313>\251\225\237wc\343\334\274\334\332oy\314\312\300N\223"
+	.ascii	"\037\002>w`\002\034j\311@\360\330\200\235\263\2138\331\244\210"
+	.ascii	"\377u\240xVszx\213p\226\246\302Zj\364B\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`$\004\025\017"
+	.string	"\026\322<:0\345&\351\300"
+	.string	"/C\300_\317_o#2\017\326\365@\357\250Qd}\366\022\t\003\230\376\202e\036\031\021\021\241:\030X\344\312O\374 -\005\311Ln\213c-i\255m\231\002("
+	.string	"."
+	.string	"0"
+	.string	"\267\211\237\375\264\366\323\260s`KU\311\224K:Ki\302v\364\262z\252\365\252\360{\365^\255\354ZY\337\372\025\276\026\002\241L\204\312@=\025\344Dc\016\253K5\232\346IC\204\367\336\263\254\315\246\3458\316\331\031:\207\3165Q\032\342s\f\376\202'\370\315k\002\031\222\320S\002\332"
+	.string	"-0\240\004\356k\247\335N\303\366u\24555E\n Gk\\\231\316\344\310%\365:I\262\344\240ib\235P,\215iK(\277\307y\264\213\267\350`\230U[\361\024?\361\036\211\210\317(\304\377\2009\334\300\260\201\030X5?\262/E,L\0217\320\0039\002\tp\250\201Ad4\313)H\262\034p\002\021S6z\022\300\322D\316\203\216I\351D\024\270\262\337\001\222(d\220\023G*\300\2319]\222&9uWF\261\b\210\251\307\357:\221\031\260\022`\n$\217|\251u\007\276$`\204u!\026u\205\340\363^5\b\021\002\344\360\270F4\\\312f\376W3\r\371:\260\214\263\265\362\030\331\t\322\t\271\344j\t\237\244S\314\271\3325(\023Ld`\326\252\257\330?G\2466I\306\235&f \374\002\303\n\332\262J\364M0\246&\202\320\031\260\230\020\306(="
+	.ascii	"\316UK(\235\265\367\323\001\206\336\266&g\335\211\342\031d\253"
+	.ascii	"QR\245\377\352\276\222Xx\013w\311j\346\275\3459\035D\225\302"
+	.ascii	"*mc\036\016\316\016N\3144\321\375KK4\221RB\243\270\303>\362\263"
+	.ascii	"\0165&R7t5\336\277\3632"
+	.text
+	.section	.gnu.lto_.pureconst.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 G\r\002"
+	.string	"rD\017\032\240E\215\001\377\363\366\225\377\377\017V\301\367'[3\262i\224\266\222\225\351\225\001^\300\001^\345\200\362\311\223<r\310\037w\274q\306\027W<q\035.\303\013\217\360\006OpC\314L\020"
+	.text
+	.section	.gnu.lto_.ipa_modref.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`,\001\325\007"
+	.string	"B\n\037'`k3\0340\f\3030\f\3030\f\203v@\f\210a\030\206\266\221B"
+	.string	"A\340\333\377~S\221\006\240\315~\333\231d\nj\001\301\300V\317j\214&c\002\007(@\006\343\345Y*F\006\217\342D\211\253\271\330QOjg\261\253\330Q\354\246\347\344&\236\022\273\210'\304\356\341'\262\234\303\256\201\341\271\260S\330\255\347\332y \tO\351\341\230\243\316!\354\240'\264\223v\0077\204<\n: \260\202\231\301\332\001\243N>\016\020.\331\n\025C\303P[2\2568\024\232\367\322E\013\025{;\006\304"
+	.ascii	"\301AL6<\233\300\002\361\260\023\206'\002p\321%f\027va\360\300"
+	.ascii	"\204`%\270e\270\021V\013a\006\031\023\022\023\227X9b\337\203"
+	.ascii	"\272\020$\302\206\302\275*,:\026\244I\260A\230qd\b\231P\303\353"
+	.ascii	"\216\260\352\300BN0 \021WU\350\035a\tf\300\005\030\002"
+	.text
+	.section	.gnu.lto_.lto.61b376037f100423,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pilotConfig_Registry.128.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \233\225\004"
+	.string	"D\bj"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\344\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\"\005\001\006\035\001'\001\257 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pilotConfig.130.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 (%\001"
+	.string	"\340\030"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\005\001'\002\002\177?\202\210\200\020}{\274\001y\273\001"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.ascii	")\243\f\240\b"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.134.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\bk"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\354\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\222\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.136.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 W}\002"
+	.string	"$\004D"
+	.string	""
+	.string	""
+	.string	"\007"
+	.string	"\005\001\006\035\001\002"
+	.string	"\005\001'\002\206\b\177\005\001?\202\210\200\320\001}{\274\001y\274\001w\274\001u\277\001s\274\001q\276\001o\275\001m\274\001k\274\001i\273\001"
+	.string	"\005SITL"
+	.string	"\004"
+	.ascii	")\"`\036Oi\005\003E"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.137.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \357\265\006"
+	.string	"\222\f/5Pm\222\016$\237\255\242\300T \017\333\364\263\264\363\207l.\370\257vAnh\267\243\r\275s*\276x,\221\2319\227Yy+\341\201\"\3602Zk\237l\231\002W\232\006\316\246cU\257\332\274\016g\301\341U\227\347i\004\266\036\030\256\007aY\327\313lY\035iG\220\271\320\357\251H\004@fE\302\riI\342z\224z\342\203\325J\335\317\245\024\272\200R\206\247\337B\3506\276\226t\244\037G\2071\241\f\220d\212N+yB\231|\374\240\317|\200"
+	.string	"\032\353\326!\272h\244X\214\250dn\317q\024+b\267 \265\2302J\264\021E\021\243\220\231\2436\272\350\256\277\301_\360c\004\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.139.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \357\265\006"
+	.string	"\222\f/5Pm\222\016$\217\250\n\021\213+k-,\2022\231\345\211\254\376\341\345\202\334\320nG\033z\347T|\361X\"3s.\263\362V\b+E\240\2078\254}\262e\nW\230\007MfcU\257\312\274\215\246\001\342U\027\347a\b\266\"\034\256'aY\327\273lY\335hW\220\271\317\317)\310D@\346\305\302\375\250\211\342r\224\272\242\203\325J\335\216\245\024:\001S\206\247\337>\350H\337J\272\321\217\243\033\020\231 \214d\202N)YB\211t\374\236\277\234\240\340\031\353V\002YH\031\030!(\231\333s\033\305\212\330\255G+'%\022-dQ\004`\310\314Q\013it\327\377\3407\370E\001\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.140.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \375\365\006"
+	.string	"r\r14Po\322\001 Od\001\340\306\301]\003\021(u\037vM{\323\324\332\217|\324z\254\b+\260U\207NTU5\222\224\376\006\007\212\325e?\263{\023)S\n\206\233\207\016\307C\301\0079\317\323i\200x\260\372\274\215\201\251\b\207\352IPT\3654\361\272\222\254\007\227\212l\177\2562\001\260{\261\340\247<R\370\"o\256"
+	.string	"\345\2617\037\344\336R\003P\256\314\354(J\355\260?\255\222l\247S\005H\\\024\262]\215,f[\032\313\210\355\220\255\361Kn\022\262\225\021d\303\22520J0\273\361\r\274\300\275\345\t\334\233~\334zZ\376O>\275\204\254`#\213g\206aw\235\330\210\343\326\333N\260\215`\333#\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_resetConfig.141.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \320\205\005"
+	.string	"b\312%+pm:\240{c\203\333\021\373\374\342\275$\345o\260:\260R$|\236\030\366\313\020\267\346\377.\256.\\|\337\365\303\335h\345\226)\247U\343\262\260J'\265&v-\034\223f\220Y\025^\037\214lFj\315&\025\366\362wEh\2540w\226\277\204\"\267\273\364\200#\307\333\037n\2225\377\002\232\277\237\t \021b\324}9\231z\f|:\377\227\272\366\2236\344\364\212\031\213X\352\356\311\233\325Vj\337\005w\320y\333JA\242\273/;\017\263\347\375o\370\177\370?\t\b"
+	.ascii	"2\003njF\270\340\\\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_activateConfig.142.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\211\003\265\030"
+	.string	"&k\230F\260\032Q:\340\002\tA\321\031\222\013Y0|m~\003l\317\242'\206\326\224\314\022yj\342.\337\035\375\337^\331`;-[\17747`f\317\r\334\231\237\316\230\366"
+	.string	"\344M\267#\272+\243\"\003\374F\366\226R\246~"
+	.string	"|"
+	.string	"\216"
+	.string	"\347\346\357\216\230\204\251\007M\255-\202P\0258\251\004\371\277\337%\273\224b{O\335\202Hj\255\253\264\274\037\305*9\205,(\376\024\277\270s\305\323\337i{\272\232\312!\255h\302\246\326:\266\217\245\033N\331L\277\273["
+	.string	"\266\233lC\325\214\235<\265V\361F\304R\205x\253q\313\036\035\\b\004\270\321\344\212\tgfw\313,nD\314\251\005\265\326\263\355\366b\237\332\377\260\377\n\376\266\022\337\335&\237\220\337l\243\303Bn\001a|d2,\024\030\007u\327\260O60\224\030'\373kup\271\302\235\334\034<\372\323\023\256\212\344\006<e\rSQ/,\334\306\211\362\215\251q\233\377\257m\002S\325Z\003\372\372\226I\210/\322\316\307H\360\332H\204;\267\305\027Y\222\224f\034\374{4\356\334\277\262\266\321\337\374\325\344\353H~\316\344\253&?\025\362\303\311\237\315\227\222\337\315\001Ej"
+	.string	"kF\304\030\364\210\350\242"
+	.ascii	"w\377tG\227\360\324Z\366.\335\354\305F\215\031\007)\217\r\203"
+	.ascii	"\0335\004\370w\360`w{\363K\003\244\265\3549\375\325\262[N|\221"
+	.ascii	"\016!(\210\267\006\322\004iM\277\247\245\305rBF\321\331,\354"
+	.ascii	"\225\b\022\214\256\326\212\240\312Z\2210A\210\327&\024\356\314"
+	.ascii	"\351]\332\t\243G\224\223\246\337\214U\353tGY\021\265\274W\330"
+	.ascii	")RV\275\274\035\213\202I:\254\352\377\002\006^\333E\036\265\226"
+	.ascii	"\251\302\316\005\377\300\342\360\0321\232\370\340z\201\330y\213"
+	.ascii	"\345zy\020\021k\215-\017\243\210\327\206\020ck\250\304\310\032"
+	.ascii	"\360\330\210\016C\243\211Xlh\024{\263\225\265\215\316\322g\271"
+	.ascii	"}\026\007\352\212\323\374YU\263\b\332\001gM;\020\317N\311\240"
+	.ascii	"4\210Z\366\260S6\326\211\3428\0236\353HI\366\354\0039\266\fL"
+	.ascii	"\265c\226\f\335QDq\2746\212\013w\312N@\304LR\356\306\017\177"
+	.ascii	"\303\320\243/\013\206\376\240@h\020\271?\023\356\374\351\020"
+	.ascii	"\032T\250\201(f\220s\b\231\214(HSPH\007\200\002!\"\254\007\020"
+	.ascii	"H\252H\223\fk\335\315\222\323k\311\376\217\344V\352k\252C\207"
+	.ascii	"m\206lW\206R\370\f\303/\357\330\314E\210>\260\307\337W}\271\377"
+	.ascii	"\327y4\007T\005J\263\271\020\034\305\327E\321a/\035\\&\033\\"
+	.ascii	"}\"\206\373N\2302f\033\377\305\220\212\210s\327\260uP\266r\365"
+	.ascii	"\365\033C@\336\320\254\217\357\237\256\267\3647\373\327<\354"
+	.ascii	"-\227-\310h\223\256_`=\200,\204c\021\027\202\351\037\241F\006"
+	.ascii	"N\202\2745X\351\263hhe\363\035\034\003\001J\325\375\203v\340"
+	.ascii	"\270\367P\325\251\032"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.144.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`>,M\246"
+	.ascii	"\352\374\2448H \016\333\031\003\373\355\005\262\022\236\322\213"
+	.ascii	"KE\265\365\020\006\332\224J\356\243^\310\200\374\245MEUb\374"
+	.ascii	"\n\271r@\177\261\342\351N\336\240[m\265\3256\317~\300]\336\177"
+	.ascii	"h.\221:\252\353\2729c\214 (\211L)\245\202\0037\003\201\003\257"
+	.ascii	"'\347\370F\356\r\023E6\262\253\312\237\007\351Xh\201] \214\352"
+	.ascii	"?\016r\262\311\035:n\3016IJ*-e]\241\243\"\re'\245i~\216}n\322"
+	.ascii	"\366\034\033\257\363\230}\230H\323\361O\225\b\363P\001\323\b"
+	.ascii	"\035kT\273\020\255|\213]\214|$4\035?\036\2354\346\206\343\236"
+	.ascii	"c\237N\312%9\260\306'\243\204\206\343\307B\306\221Mh8\336\340"
+	.ascii	"U\205\262\275\357\353\363\241\335\232\312>o\r\306\331aN\020Q"
+	.ascii	"\365\366n)`VmRvR\004\333l\335\346\354i\223}\273\336^\256)5E6"
+	.ascii	"\307\367}K\321I6\241\354$\277\265Q\333Ie\023\265\235df'sb\277"
+	.ascii	"I_\236h\"\2228\307\367}\231>K\222\273\017\026\025\025\371\335"
+	.ascii	"\325q\034\177\263o\315(\224\316f7<\310\202\334\206\003\031\220"
+	.ascii	"\377\330\217\331\360\032\356c5\314\307{\234\206\3658\217\361"
+	.ascii	"\370\216\321\360\031\266c3\\\206\311p\035\217a:\236c9\026\303"
+	.ascii	"q\f\307T\016\303`\370\355\206\215\0324f\310\b \006\f\247\027"
+	.ascii	".Z\260X\321\304\264\244B"
+	.string	")\005\212\023IH&J\034\221\030\001\200\210\020 >x\350\300a\203\206\f\030\214\212\210\206.\b\005\0011\177|\226=J\2366\311\276;\271y\004\030\321\245\367,\034\263E\325\354\2065\322\322\205\213\007\260'\031\026\205^\031\273fts\036\024\034\323\334fL\340\\\035:g@\036\001\030;i\206\210\304\316\t\030\226\272\346?\366\255\034\275<\200=\247,\2158i\316~m\315l\330\232\327\260\365}YsV\303&G\315\231\217D[\363\236Ys\032\017`O3\f`\317-\316z`X\312\232\363<\200=\311\250e\316xc\211b\316wh\2644\237I\034\203b\2278\366\345l&q\f\352\\\246\212\324\231\214\327\233)\316uc\2504\323A\231{\343\205\001\354\331\345,\227%\305Y\f+\324T\210\202s\\\221 \234\020\226%\315T\026E!\023\fa0\200=\257\274\300\236X\316`X'`X\2244\277y"
+	.string	"{*a\241\200=\223\370\215\310\266\021\t\3515\3564\215;\217>\303N\313\260S\307\003\270v\fA\255\253\243\303\260\266S\242\277@t\027p\274\205UP\353\215\263\260\036\372\n\303n2\254:\223!\025\320\227\376Z\305\237\237+\261-\254\034\275ZP\353\217\375\251\203\304MS\331x\nVh\r\333\244\305Q\244\300\325\327'X!5lS\031O\342\021 \005.\276F\262k\023v\202f\274\004_\037\221i\022l\t2,\207\021c\346\352\034"
+	.string	"\272\026A\027\302m\316AL\373\303\264\315=\260u\007\266\2715\347\360\2457|\361Ss\ri\235!\255\317\3141li\243-{e^D\326Ddyc>\344}}A\254\205X\027p\266\246\3704I$\354.ZR\017\022\324\022\373r h3\331\017\203\177g#\274\256\324u\027\255*\376\303\242\200\262q\322\202ZP\326\250\r\0268]\264\274\334\207J/Y\024\212h\350t\027-*\254Q\326\226\253\2466"
+	.string	"\202ZS\274\007"
+	.ascii	"0.)\255\354\242\325\345<H\274\205\322IV\211\320\313\024\")d\b"
+	.ascii	"}\266\254\234\005\332:\342\263U\345/\250%\205\025\361\276oS\333"
+	.ascii	"\261\266\236\356<\002\274\357\313~\265\305\325<\244\231\225$"
+	.ascii	"0\363\022\346\243\246E\326\032\221@2\035\223\270\257\241\217"
+	.ascii	"\262\0039Z\273\220\243u\317u\017Y\3434\210;\251}\361X\334\027"
+	.ascii	"rx\277\355\336i\231\335H'\225\220\306\367\252\350\204\211gB["
+	.ascii	"Z\352\213TA\243\032\n])\206\t*\353\237\327P\305\214z\270\202"
+	.ascii	"\227\237OR\323\\\201l\270\3173;\255\234HDT=\225\022W\301\211"
+	.ascii	"\365Su3\327\212sI\t\237\377&yjS\026-\013\216\371Q\356f+\365~"
+	.ascii	"\330\31204\320\037\347V\273| YN\346\334R\272\026\037s6y\342\214"
+	.ascii	"\022\245\355\344\362\223T\273\353\264\205{;\251\264\314\316*"
+	.ascii	"\316/\357+\251\367\025\346\004^\025}\230\274\343<\005g\331w\020"
+	.ascii	"\214bqF\275\257\370\307\314\231\322*\355\312rH\253\374\006Cx"
+	.ascii	"e\316\340\241\222\267\030\277\342,s\243\273\270'\026\333\373"
+	.ascii	"\032\351+\366/\267\342\024\3431g\231\227\265N3'\027\357+\345"
+	.ascii	"3\231x\t\254z\252\036\rT\246\370\340\211IS\362\274\013z\361\256"
+	.ascii	"\247\206\253Fq\236\301\220>q(N4\326\251\346\\s\256\265\235\344"
+	.ascii	"\371\2063\344\371\250\037\351\266\315\233<\205\340\342a\264\325"
+	.ascii	">\317`\334\265\315\320P-3\002\316\004\352\250\352K*\360\n\203"
+	.ascii	"\262-\266\241\035-\311\r\332\344\373!\325\260\312\353\270\371"
+	.ascii	"\025\216\033Jx\274H\222\374\033b\335b)\246\261\037\345\247\226"
+	.ascii	"\375)\352!\263\016\267z\n!}\337*'fv\311\274\212\207Q\365}\253"
+	.ascii	"bt\222\335\210?}\260\004\030\320\032\360<\203pj?Q\002\025\377"
+	.ascii	"\243I\355?\020\352_\225\327\341\240\310\310H\303Nj\243\376\237"
+	.ascii	"\205Y\344\021\350\323#\331?\352\275\f\022HF\240!\241\224\357"
+	.ascii	"\373:q?\366\235\005\270\311:\311\r<\340}\325I\356\007>*\312\""
+	.ascii	"\264mj\304#\231\337\236\376Q\346\326`\006&\220?\214\271\321Z"
+	.ascii	"\256\271\317\312zL\332Y\372\332\334\321v\302\265\325YK\032\253"
+	.ascii	"\247\315R\035\2469\252\027\233}\364\340\261\343i\200\226k\326"
+	.ascii	"\321\343\234\243\307\031G\267i\276A\344l\203\351\\\203\310\231"
+	.ascii	"\006\221\363\f\246\263\f\246s\f!g\030Kg\247\226k~\301tv!\344"
+	.ascii	"\334b\351\314\202\351\274B\310\271i\351\314\324\204\315KLg\025"
+	.ascii	"K"
+	.string	"g%\246s\n\2463\n\246\363\t\246s\022\323\031\251\017\233M0\235K0\235\217\032\261\231\004\323y\004\323Y\304\220s\210\2453\210!\347\017Kg\017C\316\035\226\316\034z\2347,\2355\3648gX:cX:\033-\235\213.8\023-\235\207z\234/\3648\013\3658\007\3658\003\t93\201\234\177\202\234}\200\234\227\255\330\334\303tV.\235y\226\316\355\217sr\351\314\3728\377\322\331{\234\273\331:N\n\365\212Z\277\360\355\315\212||\003\223wf}\355^\354V\354F\354>\354&\354n\323-\327=\355\016\323K\346fn:\334u\330\247\261\035\235}\225R\276g\224L\314\022q(;)\344M\3242BVE\3509\314\264\262:\312\3418\254G\303O\221\315\312\257\227\227(\205\303\001\2147\250^\2743\033)\370R<Q\227\032Tx[4P\260A\361C\2203\3367%W\031'\376N\374\020\235"
+	.ascii	"\204\250\336\222\304\211\221\364@\276\257\223~\350\017\306\377"
+	.ascii	"-qR\r\361\375L\321sBz\r\204\336\367Ez\237=6r\313\213\022_D\370"
+	.ascii	"\276%~\251\366\254\270d\316\305\3213!\225G\317\363\304\035o\r"
+	.ascii	"\265\305\210\177\301\036\361\335h\245\352\251\232\005X\213x "
+	.ascii	"\324\303\"\316o[n\023\357+\021\317\274\333\373\300C<\177\032"
+	.ascii	"=\274\317\003\002\361!\316\230y; \020?#,\357\303\363\223q\263"
+	.ascii	"x\225\335'_\347\212\321\375\0307J\213\221J\361\360\037\250\274"
+	.ascii	"\030\270\217s"
+	.string	"\253|\271W\260\264\235\364\3603\302\354\324\246\037x\207\347\017\343f\371\267\007\343\2125#\266cn\231\325S1\207\357\360*\314\276\355i\355\331\\.^\334\263\263\266\223\034>"
+	.string	"7f\256S!\316\354\252\271k~\207\026\370|\252\025\037Es\255%\244\357\373\262\340\266\2018cV\221I[l\372(\177`K\265\033\376\247\213\333w\221j?)\027W\256\323\250\260\341\333O\214I\303\226'\020\3222W.C\225L\303\363\300\311-}\264*\346Z\217\244>n\342\034}\215\257Q\305G\231\247\260\245\332\f?E\365\003\363Q)eX\206\347\t\213S\313\341\"\356\266\032\271X\225>\312l?\265\030\\\352\177=}\250\272q\017u\3452t\222\337\353\253\270tun\2312m'1|S\033\311K\3445\305GY\313\211>{f/\274x\035\217\305S\344p\233\351\221H\024\037\225\322:\276\317\222N\326"
+	.string	"O|\224[\260U\364!5\3323{t\343\007x,\377B=\374\366\260/N\356$}\264\223\332\001\276\321\276\373\334\344\034\351\332]Q\252n\240\374\023\352\235\264ED\275B\253\211\217\262\321\027}\203\331}\023\250\336\253r\271h:\317\305\373-W\357\275\b\265\262\214\276\367\f\247t~\t\324R\225\331\335{\024\\5\007|\271Iv\013XWE\357\203\367x\275\3535cv~%F\bv\017[$\023\022\216\3267\216\220\2500\346\310[Q\351\244-\266\210\023\374#\341\374\001\243\262\031\361Qe\273~-\321OQ\327<\225\353\367\343\213\254\216Y\310\277\221D\377\214j"
+	.ascii	"p\354;P?\276\254\220y\2643g1m\321\351pN\243\210\247C5\f\341\246"
+	.ascii	"\241\332\241\237\242\002z#\324\017\350c\031:\214C\377V5 \346"
+	.ascii	"\3001#'NP\023\304\017\027^\350\247\250\177m\334\352Z_\n\255\236"
+	.ascii	"ID\274\360\235'6\350o\252v\207\206B\377\210"
+	.string	"R<|\264\257\013W@C\330\002\323\013\241\343b\207\217r\320\003\375\024\025p\320\265\376W\240`\233\240o;C@\327\372\003\252\002\340\037\033\367k\241\355$\320\367\\\237\300B\2506\345\360Q5|{\033\244\205\256\027\306&\017O\372\355\247\001\315\031\273\f\\\206^\306\265FA\255\250!S\307\365\335\207\201\3561\315\234\234Qo\275\361\270\3074p\324\336\372\336+\372h[\203ys{9\214j^Gr`g\210>\312!\254\264km\301|\2712g\020\321\331\\kT\025G([\3371\013\36157\016\273\001\f\222\272\246\346_\3349\3542\272\215\356^\333N\366\222\357\274&\301\265H-\254\233\242\343\231\037\314\301\022\221!B\244>\270 \310\024S\220\r\314\301\222\220\250\020\230F\340`\203(\0174\320\300\034,\021a\222\212\032\241\211D\025\311\200\215\352!B\244\f\230\032R$\352\203\036\0172\210\232\032\262"
+	.string	"\221\0206\350\341 K\033Di"
+	.ascii	"\202T\020\246 \0320\201\020\225\301\007LA\246\2100-e`\251\020"
+	.ascii	"\206L1\215 %5\305\344\363f\244?L)\346\211\225\253\242\221\177"
+	.ascii	"\n\371(\373|\001\322Y\376\017-H\321>\036\013\205)]V\333\221 "
+	.ascii	">\276\263<\013\220V \237\306\265*\3515\345\216\362Z\270\222c"
+	.ascii	"\344NJ\311\236a\3214\355X\272f][\327v2\307\007\355=^\357\036"
+	.ascii	"\3312\360\252\233[#\2658\276\331\216>\216/\022)w\004\362\351"
+	.ascii	"\221w\3600@j\273\254\212\233\333OK\265e\317\216\244\013\016K"
+	.ascii	"'\345B\312\334,\303\3165\355\224X1\254\\\023M\023\257\251\327"
+	.ascii	"\324\213~\327iWsK\203\266\3355\001\332I\341\002H\177\337\267"
+	.ascii	"\003\235\267\303_`wH\263F\321QQ\331\001\312\013\371\307\276S"
+	.ascii	"~c\201\r\007h`\216\246v\003h,\210\323H\207\024\364\3303\373@"
+	.ascii	"\317\367x\254\242\036\337S\366}\337\267\202\217v\217\357\261"
+	.ascii	"\3578\315>\3725b\241\300\306/\260\245\351\327\201\031Y\031\231"
+	.ascii	"\215gF\031\257,$F!\233\240\306"
+	.string	"\373t\30637\367j|\237\365u1kN\202\2172\033m\032\206jX\261\246\237\222\231T\232\205\306'\343\030\325\246s\252_Z\021\370\2653~j\r\033\326\364K2\013\203\262-2\273\211,\226& k\024\207\316\023\016{\205\005k\266i\0166[h\026\266\235\234\361-\247KX-^\247_xfz\005\202\217\262;\220\242;N+\257k\211\r\244\350\236\007\260\234\205\276i\"\002\355Iq@F'q\236n\306i\231\233s\232\214\336W2\236\0045\025\256\212U\r\024qg\201{\215\201\030\357\204`1PH\003\030X\265@b\2378\204j'\317l\002$\236\007\017\033\201l\300(\300\343\333\311\267W\237\334\265\221\235\002\365\243,L\221\331\251\305Ja\273x<\214\227\321g\307\224$\216\013T\001\211\335\323v\306\004\001Gk\022\217\305\035\304\027E+\001+\355\364J\214\311,hG\020\270\266\323o \263s"
+	.string	"V;\275\017\2629P\2368}R\317\214\001.\\\250\025\360\246O\034\376\350\254g\326\207\211\337\261#\356\021P\r\001;\276\263\276\275\370\032\217@\237,\227ku!]\302n\261Z\256\336\01726Dfg\027\233\3052a\275\266\223/\252;\276\305\313\340\213t\321&'\370c\307\233\356i\343\222\330\303\321\332\304\005\267(t|\370{\221\231\365xjY\274\017\2621\352!\253\204M\302\342\223qqW\036+V\364\022(Ov\024\366\211\303\001\032\353\231\325\261\364OO\357``\244\321\307\247\247o\254o/\273\302#\320'k\345Z_HU\260U\354\323\361\2205\302\206\245\312\213l^?\322\265\272PzH\027\r\322\035W\357G\226ECf'\364\037\3558I\027\237\276\351e\330Y\277\t\322\253m"
+	.string	"\034\205\335\323\366e&\207\243\365\222\220\026%n:\372\251ezO\241i\347\035\033\231\236Il\232CES9s3\322\245\362\276R\361Q_*\\\025q\270\317_\204\372 \235\023\366\230\266(\200\322\003q\255>\016\224\362\255\257\350\"a%.\026V\333I\245\347\t\013\203\253\250\0229!N\243\216\241\221\021\021I\n\222\024:\262\013\020\206\302h\026Ky\033\022"
+	.string	"$5\310\263\216!5#4\224\244\275\003\254\205\253\213eTK\200\263\027"
+	.string	"\001\223\201_p\303_m\213\f\036\301a\366\006`F\037\224\267+?,\215\360Fuk\222\003P*n\f\177.n"
+	.ascii	"\215\340\217\327\257/\245\261sM\367\032\212\"\205~\004e$#)0q"
+	.ascii	"hk\313\264T>{b\2735\310k\301fL\032\236\301!\310\276Ps\317\307"
+	.ascii	"W\367\030\037\335{WTZ\200cr m@\331\250\244\"\200\207V\303\343"
+	.ascii	"\330V\247D\241\024\276\207\032\361\027\320\232\274\243\311\245"
+	.ascii	"k\222-c;\313\023\222\301 'P\350\311\347\214\013n<\236\004\360"
+	.ascii	"\223\005\343|q@`\2235\021\346\316\336\362\332Z\276)*\237 \344"
+	.ascii	"\273\330\271`?\032\355\204\3429#Y\256GYo\0166?\206X)q\325{\260"
+	.ascii	"\204\244ud\311\275\350\3604xl\355\032>f\004\337_K\356n\213\235"
+	.ascii	"\320\007&\371\255\262hO\007\371\372M\370\332\376H\206M)t\313"
+	.ascii	"\274x_\316\343\374\357\206\273\230\324\374L\037\243\363\027v"
+	.ascii	"Z\354G8\363sp\314\230\33338n27\003:b\376\316@\372\275\034x\337"
+	.ascii	"\252S\305d,\231\323\231\305\350\276\200\002FZ\207\223\340\353"
+	.ascii	"\353\217 "
+	.string	"\361\246jo\235rR\251t\351\343R\334l\211!_;\240ozg\234\331m\367Ch~\326\371\222\021\270\002\347m\362yZ;\007\023\277\315I\016\330.\332\313\305\301C-:\031\031\t\202\233\222\223g\260\214\021PV\267\f\2049\3545c@\026!\rg/\277\365Z\261{\017\265\310br\b\336\013\256\241\275\313\223v\347L\\\300\025\304\250j+\034\353\364\367\tB0"
+	.ascii	"\374\034!\030\r^\265\r\272\211\277\373\307\247%\0233\031\032"
+	.ascii	"L\300\341\351\274p\317-\206\255\210\320O\332\266\022\316\377"
+	.ascii	"\265\r,*\272\\\376\226\224YL\027\234Tm\3218twL\336\310\330\253"
+	.ascii	"\273]\317\020s\220\001\022\206v\247\344\r\305\203dF\031\261\332"
+	.ascii	"\031\r\321Uf\344\002f\310)\347]\024\373$>3M\366\230\203\tP\t"
+	.ascii	"\333\263\362M\237\370\250\036\236\306\021\205v\350\022vw\265"
+	.ascii	"C"
+	.string	"\376\030O.\265\231\336.B\246\255\004\345\272\321\005\023\027\037a\023]\375\023\315\007\354\375\332\343T\345\365\346\230*\273\243\272\302\227pNh\217}Ae \235\300t\0352\212\213\202\032C\0246f\3027\272P\"\272\212?\227rv\240\351\002\005\033QQk\212a\206\213\026&\006T\310|\327\375C\004\026,>22j\225z\334\220f\361Z\234\221\234\360B\213\350s>;\266=\201\226\350G\022q\260\031\225\273\345\327\211U[\210\2631\205+\257\276\367\244\317{h\352\027\356p\t\265\0218\033o&\362@Z\315\342T\366&\200\224geJ\370IJ\t~\224\216\017`s\234\251\350\241\233b\322\342XEHOl\260\341\023\242\"/\b\310\313q]\337\3716\372\217m{i\\\251\371J\254\302\263\016\270\322\213?\"T\016}\373\277\302|N\360\303o\372\007~\267|\370\274\325\377o\253\251\271\236\330\3364-\303"
+	.ascii	"\302\333"
+	.string	"\007\273\007\330.\202\334\244%\3673\271?\257Js\004\036\350\256`\003d\366\r\356\237\216[\234\274\211\331\353J'\240\247\002a8\357\314\036\333_{s\212\300\352\377\335\371\273\354\263\f1\321\331\245\301Cqx\323\207Q\"\\U\220\374\245c\321\2227fW\373\303)n\fH\324W\\\320\314\315]\334\357\367\3056\204}\371PHwV\033\232\247\\\215\223\202R/.\300o\271\226W\031\212\027\212\213h\031t\001\362,\316\021e9jq\"\3534\255\321&L\271{k\246\260\205yWXXd\372C\234\253\320\220Y\001\200O%\302\004U\252\017`\376\272[\2118\317#\356\210\246\016R~\335?\216\231z\346\360\0023\004\263\344\254\3246!\221D\326\231\n\230)}\227a\335\017\306~\276|\005X \324\213\252%\254\"\3024\350Y\\\226\3048\0049\261\352\036\3119\2655\032\333[J\026_\320\216\267\fZ\324"
+	.string	"\rA\313k\230\270\331\274\2478Yy\031\307\304\\\021\224`Mj\235[)\235Vn\204#\020Z/{=\323\371\211\003\022\212\023/\372I\332.U(\224\347\361IYtSNI\005;\031\325\300\273\377\370\253\227\020N5/\235\257QM\ne\242\006\027\027M\032\320\354\031\242\366c\306\315\361\347\345\n\371\016Ya\326\232t\214.I\215\272Z? &\234\227\001\354&\006\352\371\273"
+	.string	"\311\300\b\036\fzV\3554\336\227\3405!\032\346\034&\260\214\323\374\276\330L\003eI\201\234\236\b\233\004\332\246\235\226\310\221\271\217\255\337\215\222\n\270\234\027\211TUK\341\027'\033\017QIY\250L\035F"
+	.ascii	" \002\363\013\031+\213\2120y\264*\177\227;\273K\030\3656\035"
+	.ascii	"\216\b\270?\213\265\200Vjp\016\232^<v\3177&|\177\362\277\376"
+	.ascii	"\016\214\201K\030\004\306R\354'\247;\312\247m\254\007\004\326"
+	.ascii	"<\252\250\340W\f\020\323UL\224u\006\316\024\262\305i\016\004"
+	.ascii	"\002\f\350"
+	.string	"\005\004!:\221\020\320\213\213A\361\353\345!z\346I4\213\323<\332\243\324\030\005P\242]i\2175\007\007!\027\020iW7\303,\233\346\005_\341?1[\350\256\241f\307\307\333\200Xf\331sm\006!\"\2408\\\320\345\237x\265n\350\272,k\211\245\320o\027\275n\323A\003\255$\315\351)\353\034I\207\203\370U\202jUj\031\t\022|\262\bo}\341\226ox\260\016\202)(\030k\022\005$-\003\017`4\026\314\211\005N<\323i}<\005\0034'\367ep\365\025\231\226\340*\026\267\236OL\007\275\020\354\237~\002QIf\363O`\364\256\227+\310[\251\342\236]\302u\023\203C\233\236\223\227\2244;\275\242\347[\3652(F\227\342d\210\022sm}\243\t\203\351\274\214@;\312\264\231\005vF\311\344\345\376\217H\247\320\032_\206\366\312\330t\005B\277T\330\315P\tk\343}\301L\023S\201"
+	.ascii	"\372\2407\222\2736\210]\273\007\202E\315\226\324\306^\256V\362"
+	.ascii	"\244yl\300\357x\240\013.\n9.\200\032\315Y+\2561A\247\005"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.145.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\321\024\365Y"
+	.string	"\212\220@ P0RJ\352{\277w\253k\376\357\273\226z~\306^W\254bQ\347"
+	.string	"\366\252{\350\b\207\206\nfb\371\253\223\342\243L"
+	.string	"\020\300\3122\006\310\305$\216\007Kk\023ICJ\315\221\210\"\252\b\030IU\377\335\315\355\336\377ck\006A\273IJ)\005\371\001\313\001\354\001O\275\205\007\210\266\026\356\270"
+	.ascii	"\bh\033N\331\267\352v\320%\354\013\216\340[\226\f\372b]\327\322"
+	.ascii	"B\230\0270\367\336\t\202O\314D7n\035\230X\245\255\264}E\003\232"
+	.ascii	"\250\255Ks\305$\214\013\230{\247\022\004{\245\361\276a{\006\356"
+	.ascii	"\034\250l\020df\352\371\204l\357\336\251\003A\2669\347\0247)"
+	.ascii	"r\31657(;[\234\367\336\032Z\255\0034?\356\200\371\254\323\230"
+	.ascii	"\211\374A;\341\003\256\366\232\206Fc\366\240g`\b\332\242O\262"
+	.ascii	"{\257\007\314\0370\023{\035\266\fm\306\304)S\201\367I3\371\032"
+	.ascii	"\303D\201`\223uY\333R\246\"\251\246\327\213\215\323\002Cv\242"
+	.ascii	"W\026\021\354\025\3318l\257\300\276a{\345\226\371\256\247\321"
+	.ascii	"\273\363\345e\205\266w\357=\372#\335\366\t\023%H\214\020aTD4"
+	.ascii	"$\204\f\002\372\t\341\323\303\263\243\223\203\003\342\306\246"
+	.ascii	"\206f\346h,\022\207\302\240\f\273\002\337[\356!\255\2663:\265"
+	.ascii	" Q}\342J\233\270b\305KTi\022U\334|\004\265EP\315\326\334\250"
+	.ascii	"(\312\033\024'\212\322Cj.\024\005\210\004k\326\340H\033\236x"
+	.ascii	"\020\220"
+	.string	"\313\320?6M)\020\211\204k\226y\210`^X4\214\021,\262\366\001k\222\261\020\\s\314{\200\002\200\2607\244\341\232d\300b\237\325\226\006k\306\340<\002\\}\355\310 1\300\345|#\3433\202%\326:K\304X\234\2566$m\244\331\344s\2244\016\320\304S\207\022\032\256\251\004\210\243\205\253K\022\007\341\3257^H\334\246\253k\272Xp\232h\317D\315\210\370\361\331\306'[\n^\034\322\304!S\204\370P\253\205ZRZ\b\254\231\345A!#X\316\226\201k:\327\254\234=\241\327*( 8\260\204\376c\020* \362\336\333j\355?\202L\271\313 \335{\331\231A\260\232\001h\346\027b\346.\346\232\276{yJ\230O,8\255de\376\306\231\335\n\207*U\220y\033N=\020F\212\2609\363n\036\312\354\257-\234\310\223\375\004\032\360!B\326\267\341\374\302g\223\345\364\262W\003\374w\341'\230"
+	.string	"|\341$`\275\r\247\0271\232f\022P\364\336{\325T\234]\232\344\315<\224\375\373o\234e\341\007\034\210\b\376)\354\244\034\303\231\032\004\357\245*\200=\004\367\001\001\267W\2575\330^\373\333\254\215npB\366,\223\036\037\352\327U\306\032>\345T45\276\331\212\177\036E\244\361\327\325#\215\357)\303\207&\261?\b\223\366\232\257\230\364-%\250'3\243\207\316\033\316\370^c\303\2542\356\372KP\3067\224\006\202)\241\376"
+	.ascii	">\224Kwy<\037\304\206t\265Z\365\373\207\006mu\022\033\343o\234"
+	.ascii	"a\241\362>\346\256k\273$n/\226\240\2067\263W\266)`{\215\361\255"
+	.ascii	"\326DXygt6hIy\225y:\345\017e\356\257V\253|\374*0\013\235k\b\235"
+	.ascii	"i\b\235\223\204\3163\204\3162\204\3161l\234a\364\225\346\027"
+	.ascii	"M\245\331\305\320\271\205\321\231\305\320yE\3035/`tVQ\343\214"
+	.ascii	"\324Y\232S\030\025\365\264\231h\350<4t\026\032:#\207\316AFg\240"
+	.ascii	"\243\363O\210\2266\373\034\235{\214\316"
+	.string	"<C\347\235\243\263\316\3219\307\350\2143t\006!t\276\241q\266\231q\2569:\323\f\235g\214\316\307\241\263\261\350\\$:\023\207\316\303\242\263\220\350\034\034:\313\b\235Y\241\363*t\006\n\235_\350\354B\347\266\321\323v\026G\303W\222\247\233\336\253\252\337}[\247,i\270\356,\335W\272\251tK\273\247\31527soi,-\027\177.\336\346a|W\345\275x\233G@\316\352\017\210\303i\340kQ-m\021O\253{{\361\255C7\340\226\345\203\230\264\346]\374\313Y\375\031\3404\317\334\006iI`\233Y\363H\252\217b\243gj;\315w\016M\203\353I\255\2622\345\325\351\275w\350\241\354W\332\370E\251P+Y#\221\031\225\353l\007*\357C\376\204x\006\002\371\274\321\377P\2623\177\343\214\013\225\367\231\340V\224?U\332\":n3#\276\326\366\236eA\313<gc*\033\300>\305qhQ"
+	.string	"f\265BX!l\257>\337S\032hK\210\347\200\221\272\375\336\033\365\023\246\347s\327f\335)T\205\255\3650\265\357\242S]\230\207\350\213\372\207m\361\277\203\361[<;\023O\312\253)\270\2322\250\216[\"^C[\344'\332+{\232?i\271\240\355\021of{\204\355\325\370\313\254\034\370B\004\243\267\231\203\354\215i"
+	.string	"K\233\363y(\017[\007[\374\034gvT\336w\266\243\370"
+	.ascii	"\020\337\237\314\271\300tR\244[=\017e\366kn\207\251=\345C\310"
+	.ascii	"[\035\373\365\202\016S\233\213\207\031\246\\t\252\276F\310aj"
+	.ascii	"\333I\225\360v/\247\250V\347\250\356\225\"\"\372\037\274B\017"
+	.ascii	"\313\224d\0200\320J\026\024>w\241\031\t\310\023\3269\264\336"
+	.ascii	"v\036\332\244\221Q>\246\253\255\213\212\216\030{\f|\027,2\231"
+	.ascii	"\334\255\027\330a\340\273\235\252\333\260[\026\330^\235yKx\013"
+	.ascii	"\314|\027\2747\252\237\275u\303\2000\271[\267\004q\213\312\377"
+	.ascii	"\2208X\233\344\313\251]\022\364J\262\275\n_\204\235t\2043\267"
+	.ascii	"a\255\013\336\314\340w]\334\230\267\251\217\312y(\222fnap%\355"
+	.ascii	"X\0222\247\230&yR^\345\356v\214en\305\274\253\035\373\251\213"
+	.ascii	":\013mY+\203\n\025R\247^\274\003\005\216$\217#\250\035:\222\030"
+	.ascii	"\344\330\341\035(\236v@)5\0359)\233\232\224K=MJ'&\026OOLK\312"
+	.ascii	"\0362p$e8%\233l\230\232\222P<\224J\0308\222<\210J\0278\023\224"
+	.ascii	"\322\214\245\247\026\034(5\r\231\232\222\021\350pJb\300\243I"
+	.ascii	"\351\251\350\244LB-%{@=1\315`\202R\302\301C\202\036J(eS\016/"
+	.ascii	"\241\320\221\314\341\244\\:Z\312q\344\224Tj:Z\352\361t\204B\207"
+	.ascii	"\225<\230z\034"
+	.string	"A)\225=\216\210S\251\006\336W\201\333\254\203N\332\230\360\201\221\372)Fz~\254'\241\202%\335\322\316\016\255\215\302T\247\350\324\360\322\276Y\0010J\224\271\364\373\253%\017@9\003z\345\007\362#,\275,\277,\303,\303\260\275\"}\247\365\214\026\226\324\265\035Q;a\305\253\370\217b\365\207\366\203\271\342\033\255\275\357j\357D\bo%E\213\255\211\211V\262C=<\325O\r\275\005ZT\276\026\316\274\024\263\344\363f2\t.c%\036\272\327\177\333\261\240\252V\224\275<\022\017\345\265\225\254\320\362\007\367\353\363\037\226c\226\3256*\212\355U\350\3270lu\317\262\021\017\025\323\216\025\351\201eU\337D<\224\221\355\224\347\341y\017-\bV\255\017\037l\257H\274\254\252\230T\nh\024\364`\332\261\240/\035\3279;0\361\026\370\235\017\372\236k\241\2308\"i,~\001\240^\226\2303\272\264?)\2572"
+	.ascii	"}|\026\317^\245G\323\334\306\002\375\361[\256\2011xM\313\304"
+	.ascii	"8\311\373y ,:o\364?\337q\035\344\302\365\254\026=\224S\274\321"
+	.ascii	"\277"
+	.ascii	"\031u\354\fK\317\353|\212w/<\337\363=;\317\323E\311\303\3167"
+	.ascii	"\026;i\321\347\274\316w\025\030\316\347<\213V\005\006\304\343"
+	.ascii	"|[\375\331\325\201\370~\353\325/K\217\217\350\346\347\222F\310"
+	.ascii	"\265?\212\352\356\275[\232\211\007\343or\344\254\002\201\253"
+	.ascii	"\250\221,d\231B23\"A$IRH\007\201\005\204\030&\0354n\021\020\245"
+	.ascii	"CN9\032M\222\302\260g\334!\331,Xe\252\361\244\021\331,\303\021"
+	.ascii	"\026\305\274ewI7~\364;\364\027\243@\350\202\323\330\005!\322"
+	.ascii	"cs<\301\273\201\223em\302\3250\036n\233q\032\021b\355\337Vd\367"
+	.ascii	"K\231\257\2105\316\212p\034\311\277\340\227\371\363\0234\003"
+	.ascii	"\321\254\021\3078\361\312\266"
+	.string	"\\\263\002\327\304a\006N\032\0203S\273\320\373\375\321\326\177srJ\007D\032\202)\333B\322\021\016\361\004\267Q\205m\256\f2\022?f\315m\"\334kh\261i_\2476\f<\346JOR<\2129\331\003\340g\274[@\340u{\003\360k\355\006MNQ\221V\301`\212Q\370\266\235\203\036@;\214~\215\223\206\211\325m\314\3604\371\201\301\325o\320~\265\361\224m\257N\254\251\237\032\347\252b1\212\026\2744\346A\242i\310g\036\365\300f\320\314!\331\232\324t\365\241\200\231Y9\223\220n\"\241i\300!\214\216\2557]\377\355\007\016as\007v\035\222\304\316y\336V\302\250\343Es\3520\323%a\304y\013\025$\276\016ROTa\360\261sX\031\031'\020ku\206\230@t2\203g\333F\371\245&t\031#\224k0S\343\314\355C\224\023\3024*\321\351 \032\027\307W\200[)@k\213\327\373"
+	.string	".eTx\350T\205\360\r6\272\254 \2160W\fP\274\237\267\231$\245\342\321{1\376;\260\321\204\221\302\\\343=\232\371\340\310H\236t:\245<\275f:\362,$\231\030e\263\336\267d\211\\j\214\206\213\330GT\307\013\354\327\317P\343d3\006\242Ag[oU\370\221JI\207?\003\0136\337\366\334\363\354!\" \217\331\f\221G\203\326\022\264C\344K\303\210O\022e'\345d\204R\237\246Vv\241\372v\003\b\263&M\244SZ\355\021\375F]u\334\2075\031[\303"
+	.ascii	"\262b\243\307P\214Io\336B[$\025\265Y\355\004h\246UQ.(|OLP\013"
+	.ascii	"\240\226\030\017\277\214_\2206\223\240>\323\035\245\237\017\240"
+	.ascii	":\353\205I\250\317\272\377\223\351\003\026\323\241\377u\370M"
+	.ascii	"\320\031&3\032,\004o\315\370\350\311\325\314\037tl%\017\267\204"
+	.ascii	"|\220\260\374O\031J5\246Q\312\001R\r\254R1M\213\256w}\236\243"
+	.ascii	"\325\340\021\241\373\356\003\023\013L\325e\307\026\261\227.\036"
+	.ascii	"nW4\326\005\254q\004\355?\3668\250\360D\240\314\305;\026\346"
+	.ascii	"C\367\240\250?\360H]\326\037o\2373.\200\307`!\031\016)c\316\253"
+	.ascii	"q\206\036\254\021-h)\tyk\211,%\364$B>%\3633\231,7\346'\303\006"
+	.ascii	"\261\345\f\207\316\316YU\215\313\302\001\3471%\314\215\251\206"
+	.ascii	"v\371\306n\371\340\373\307\254\321\234\020\233\217\304\032\037"
+	.ascii	",H\242G\342\253\"\005\275\"\005\275\222\240h\233\020\027\353"
+	.ascii	"JB\242\266\006!\306\253\373 \324\275\250\027$\244\250$\355\266"
+	.ascii	"\003\241\002"
+	.text
+	.section	.gnu.lto_readEEPROM.146.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\355\b"
+	.string	"\202\217:8@\2173\006pFH4k\340\251\026\331Z8\324%{T\021-I\225\210\236\264%UB\276\325\342"
+	.string	"\273\3741~aW\021\270\326\017\200\316\220\277\200\321S\236\325\275\245L)]\327\251U\324e\256\234\007\315\023\332*\255\036\032\322\034@\264r\035\345\020x\213\350pTb\3338\252\271\366\323t\315\217/\032c\305\004\265\214\317\347\002\004\321\032\267\003\027\326\230I\273\023\311\207\327\034H\255l\\\322\236\240\220\017-S*+\326\n\234\237}?9;\354_v\232\354\213\367\225)h)a19\215L\325\265\244\230\226\035\261\024\222\213\277=\362Q\326\\\364\f\276kI"
+	.string	"\034 (\"\3021o\002\216Yaad\357\367\203$p\022\2618\201\261\366\322\351q\357\322\363\217z\003\030\242\nK\337e\306`\255\265\fK\030\367\274\355\215\355\004\373\231\024"
+	.string	"2\0013~\006\331\004\202{`0P\002\\\004\305h^\007H(u\004N[\337\034\3025q\n\013\342\206"
+	.ascii	"\027E\177\250\340\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_validateAndActivateConfig.147.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\265\006"
+	.string	"b\213+2`M\323\001@\343Q\317\025\177\332\262\241M\351\225\341T\273\fr\312m\177\302\317\217o\307,\021\360xR\024\005\326"
+	.string	"\266\276d\fj\3321M-\221[\246\226\020\202\024MSF\031\305I2P\210\222\252\"\004\340\271p@\305\2069\251\370t\327\346\273]\276\022Ob1\006\222J\304\301\343!ac\241\r\021\00153\301\307y\330^vw\301\265\260\265\371\177\357f;\031\216\023M3B~\212\025\225{\226\021\r\333\372\330\262Q\264\303x"
+	.string	"g2\001\222\362?\356\205Z\n-\253v(&\323.\205N\301\177\303L\253P\257\332\026\260=`\373#\020"
+	.ascii	"3\241\217\037\230c\316@;\200\031(\002\306\201\302\300\020P\227"
+	.ascii	"\346\3415\033\263\013\376\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_writeUnmodifiedConfigToEEPROM.148.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\235\007"
+	.string	"\222\r36Po\322\001C7\002\r\213A*<\303\026QJo'`\360\313+\364\363\371j\215 \002+2ll\264\253CY\315\030\342\231\341\2758W\251\300S\315\022\"eJ\001\2666\n\035\316'Z\320\342\300O\007\341\202\026\026\202\233"
+	.string	"\307\205\004\f2\304\210AM\267\247VK\006%\336\311\023\351\310\376\205\361=\376q\371\030\216\240\374\366\312\007a^\035P|\034)\242\374B-\r*\016\036\024\223\246\375"
+	.string	"\221\337\234!$\336\311\033\251fwZj\205}j\265dg</$\t\356\031+\273\244\317eM\225\210\206\355k\234\331'\357.V`\303$\002\204ew\241Z<{f\376;\016\260q\3323S\260\273\316\215\233\270\365\266\007l\023\330\036\t\017"
+	.string	"3\241\275\037\2303s\0054\001\370@a`\b\250K\363\306\233\266\271\206\317\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_writeEEPROM.149.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"5\007"
+	.string	"\322\r36`m\322\001\300\025\301(\036\nCv8\302\215\233\337\357\241\303W\316\251Z\001D\032\352\253\201\250\214\237\2520m1\f\203\241\001\331\372B\306\204\362\241\r\262\311\226)\005\226\227\206\fF3e\224\230\250\311,8DYm\342e\300\363\201\241\212\021sV\321\262]\237\366\201*]\006w=\314\025\265!6\372\314\b\335\207\303\236\307z\016eK|\204S\020\332\335\004_\344\242\t\237\343\320\024\035}v\350w\250\303\213>#\022\312\245%{\303\364i\330\237\366\201\354I\340\204D;\210\311\356E)e9X\322a\373\026[v\367-\264\004\037\026\025#\322\356\306\267q\353j\371\017y@\246y\256"
+	.string	"\n\273k\3154\214\373\335\266\201\355\003\333\036\001\b"
+	.ascii	"3\241m\037\b-\314=\256\211n!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_resetEEPROM.150.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"%\t"
+	.string	"\006\321@<0\345(\035"
+	.string	"^\245\fP4(f5\316\233\034\016\370\177H\210\227\036\246\006\352\365\327\3376\354\017\001)\217\340\371\031%h\r\004\0160\341\311\251\307\205\231\244\244+R\254\021\262wJ\001/"
+	.string	","
+	.string	"0"
+	.string	"\234\205\222\305W\016U\301\007\353\202D\266[\351\334\270x)\372\207]\363h\261\270\274\230\254L\227\001\r\273k\231Ze\334\363\266\023l3\330\216\005\001"
+	.string	"l\313\226\322a\373\376\310+\351\"\346\264V@v\227#\331\334\267\333%\233\263-\345_\342\301a\306Wl\267*\030A\340\233m\007\254\331x\232(W\300\016!3\3124\322\257\241\205|\312\257\217PA\231\215\250i\262+JN\r\373\332\356\256\247\313\326B1*\214\325CNvU\001\340h\"\354x\274\007\3207\002C\007\017\f\t\334m$>\236\320\327\321\316CC\237\016\210v\"\220n\f\374Qx\":\372>\021u=]\333\351\362E\315@\311L\013"
+	.ascii	"'\213\302\265\030m\210\2243`0E\235w\320etPA9\025Vx\336\206\265"
+	.ascii	"S\017"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.151.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\345\007"
+	.string	"B\31646@\217\322\001\360\036\034\021rC\345O\235[J\225\034\002\nL\bg\022V\360\224\362[\310\315\210)\261\302t\026?\f\303;{\300-/\303\325\337\204\353[\333R\246\024\2666\f\236\316'Z\320\352\300\217'\241\001Z\027\bn\006\034\035\026.\370\020\343\0055\235\350\034\221f/\2236\b\"\257Y\257\312X\221\250'0W\005\220\223Q\252\374\322\216\220\310k\327s\177\305\310\n*\245\222i\310\356\262T\r\373o\365d?}L4\225,\266s)\273\245U\313\242.%\035\266\2571f\243\274\343X\002\217\017\222\b\313\356B\3358\366\247\211\371\001[\350\017\300t}\005'\214\224\300\226=\003\023\024\351\334\223b\033ef8\273\353\324\266\213\373r\333\b\266\017l\207\004\017"
+	.ascii	"2\003\302p\036\302V\rt\205\275@5\017\274\264\356\375\026\326"
+	.ascii	"s!\337\013\326_\306\025\227\256\251\246i`\n\n"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.152.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"E\t"
+	.string	"\326QA;0\345(\035"
+	.string	">U+l\022\nHad\2601\221\345\3323\375\032\333\236C\226\256B\370_\277\217Bw\243\rk\022Z6\"\"D\303\026\243\3278(\t\004\327p\263\301m\367N)-"
+	.string	"2"
+	.string	"0"
+	.string	"\036\331\333\3477\223\354\327\301\325\"\224\254p\250\310v\227\312\220\223\036I\376[\327x\250\322c"
+	.string	"\304\356:z(\217[\336\266\202\355\005\373\016\363\337\033^ZX\037.\030S\234\331\340)J\020\373\231\225*[+\210a\241\356\202\355v\314\002l8YDl\337?\3717\272\313\003)\027\223\335\335>\035vG\361\326#"
+	.string	"\304d1M\364\277z\021\357\231\341\225\nO\262\344\370\220\366\317\240\247\204\022V\273\373\340\203G\311\360Y\237\326\020\305{\237\276H{\3466\023]\307S9\312u\250\247\223\250\240\334\007D7\007\256\026\234\017\305\250\365C7\320\364\314J\225\005`$\241I\236l\020\035ns\234:\022n\310\222\tb\f"
+	.ascii	"2\241\th\340\270Xh\306\327\031\354\330\f\3075q=D\036T\210\227"
+	.ascii	"+\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_setConfigDirty.153.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \351e\006"
+	.string	"\342\213,2PM\324\0010\3624D\301Z"
+	.string	"\242Y\001\305\303^E8\007U)\366\312\302R\rul\203Q\255\343\2413\243e2\345\027\210\204bA\315\310\376{\247\024\246\216\002\364D\225N\372\314\bBX\230Tj\230\216\200+C\2024\035j\225f\343\355\343v\200\362\235\224\\\021\302\377\304\370\335=&?\303\017\024<v\351S\314\245\334\020\261Tp\226\013^l\317\202\321\302~e\343f\307\312e\022\332\273\221\335\354\222\262\237\004\321\260\375\306\225Mr\017c\0078B\">Lvw\306\213W\207\225\377\216\007`\232u\b`\260\273\206\2306q\307\333&\260]`\233\"\b"
+	.ascii	"3\001\0178C\\|\241k\370\\\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_isConfigDirty.154.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \344U\006"
+	.string	"\"\314,3Pm\222\016\004\210\200\r\242\025\200\206\033\020y\222\321\363\346*\355V\nk\366\357vx\255`*\276x,\221\231l\234i\3013y\245\002\261C\343\026\367\226)O\027\210\fFCMm\3024M\306!\242M\325D\273\030LI<T\215\202\242\252f\311\262\030:<\360\340\347\033R\221u;\256\330\\\257Jw\023P\351p \303s\243\317:\207\032_\200\314\3141\364\337\207\004*(XE#\231\240\321J\232H$\036?\347-+,p\266\232q\200\n>N,DR2\263\206\033\265z\326-H\033>\242\222\013\353\364\004\0302\363\2730\214\216\375\023~\204\377\"\007"
+	.ascii	"2\001\0238#(\016%\256\321K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_changePidProfileFromCellCount.155.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\177\004] "
+	.string	"\226\274\325I\220\232N\007"
+	.string	"Ca\3171AI\251\233\231\364\004\036\347\t\321T\224\356\2002lU\367\341\031\267\302\002B\377\r\341\213\21534\3356\210H$\020\247m\020k\020\311\343\212\240\215;%@@9\021\335D\310\336{o\231RJ\001\305"
+	.string	"\261"
+	.string	"\304"
+	.string	"f\227\314\354\316\354\340\301Qo\261\340\277w\212\f\311\275G\006|"
+	.ascii	"\355\222\217\230\323\372x\343\356\262\262\f\207\200\271\367\362"
+	.ascii	"\336\006\333\374\250s\270\233-EO\263\264\357G\3346\025\251sT"
+	.ascii	"OR\215\263:>\3040i3\242\224\315\361b\312\321XD\032~3#F\365\332"
+	.ascii	"\356\2442\271\255@\215\247\031\235\022\270\367\312p\264\223d"
+	.ascii	"\364iu\312\252\260\350\324\241\315\231\"\203\321XD(7\255\004"
+	.ascii	" Z8t\252\320~\027\221&\215E\214\362\022\230U\206\013\325\323"
+	.ascii	"\214\2666\301\024\031\f\235\272dm\312\252\260\364[\007E\3240"
+	.ascii	"\235\252ds=\322\260z\355\002XD)\367s\302\275\227\275I}j\3265"
+	.ascii	"3\25713\tf\013 \334`+J\240W(\314.\375Sc{5\021\024\334W,\024\364"
+	.ascii	"n\352\222;hv\331\337k[/Qka\240\222<\311|T\362/Z\271h*\277\025"
+	.ascii	"\363\316\235qnz\253\333\246\206\246\217\3153\335\325\254;\235"
+	.ascii	"s\2473\316\235o\245\263\315\235SwF\335\371tg\323t.\335\331\272"
+	.ascii	"\363\227\316n\235;Gg\303\205\332\306\265{_$\311\334(\245\330"
+	.ascii	"\216>vw\26537\253h!\034!*\251u\357\275u\007\351\225o];`\262\306"
+	.ascii	"l\271\367X\001\355\222\333\330\\G}\344\261\276O\267[\234e\221"
+	.ascii	"\331r\357U\320%7@\273$\3206f\227\266\003\004\246\356q\037`\375"
+	.ascii	"ZK5\230\266\367/\375\343\307\016$\364\213\334\355h\\Fb\234o\305"
+	.ascii	"\n\232\346K\036g:V\262\007\223\262\0323oo\277\310\366\267%\032"
+	.ascii	"\3222(`\246\266z\b3\260\225l\360\001T\3105\307\326\275\027B\222"
+	.ascii	"\026\343\320\301\303\007\263K\333#\300a\324}\372g\025\327\332"
+	.ascii	"\020\371R\320\272\300J\364o\276\325\030\364\371\350\357\236\b"
+	.ascii	"\305\026\264\371\347\237j\302)%Or\371&\210>\022\002\275w\251"
+	.ascii	"\207\333H\207\371p\317\347\335\3443\273,\277\265\242\312\204"
+	.ascii	"1\366\2309\271\262_\344\237\351\217\253\321b\310\342\327\177"
+	.ascii	"\221\355\377\213X\255,\271\030\266y\373\346\224!\322\377\277"
+	.ascii	"\207H\006\352\"?\364\336\333\023\034\3043\342G\3043\n\002\372"
+	.ascii	"\001wD\270"
+	.string	"\024\276\021C\026|\300\337O\260(\003\320\320/\250g\344#$\300h\350D\220\002\020\350\353\245\334\343\001\372\375\f\005{\274\336\017o\350\347#\304\353\025\231\340\361\340p\220\310W\3043\n\006\213x\267cROHz%b.\307q\236\371\002\006\357\246\232\257.=\242,=\022w\262y\314\254y\234?\241\224<yC\306\224\004g\243y\035a\022Y\246_\363N5\006\220\316\252\254P\226\\\214\216\233Mg\036\347\225\f\263<M\363N8C5-\335\375\2140i\2647\257{'\335\347\276\251\254W\312\317\375\315\312\245\305\336\265\2738T\215h\372lO\232\237y'\346\357\035\023\367\273w5\241X\367NN\250a\030\206\220RH!$#\021\ti\322tP\0021\nZy\020xg\222\346\307\222\024\020*Aj(\207\313\363\330\314\222\333[\035\246$\002\231\364]\273\225\311%r\275_5\2347<\250`h\262l"
+	.string	"0wVH\177H\230\021D\273\034\3600}g\320\301\345\003Ym\360\262\002\333L\0039"
+	.ascii	"3C\230\232\036z\251\372\036\271\202\200\201!\221\317\224<\302"
+	.ascii	"\271^$\2374\001\252`\243\265J\265\306w\204-\244k\262\024!\b\247"
+	.ascii	"\371x\225\024\252\377j\312\245\250\346\f\001U \001\206{\225\351"
+	.ascii	"\274\213\245\",\205\230\255\221\024\237\262\025\322\232\235\221"
+	.ascii	"\340Q\001"
+	.text
+	.section	.gnu.lto_changePidProfile.156.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\273\001E\021"
+	.string	"\366\337rF\360\322f8\270\357q\213G\033\007r\254\313V\377\230\034\342;\275\336:\351CD\027\247z\005\276C\277\300\376\006+e\337\215\030\244\276\233;\317V\005[\370\303\202\r\235\353\353\206\252\367\347\370\365b#\314do)S\nY"
+	.string	"Z"
+	.string	"b"
+	.string	"\266\261\275w\367lg\332(\020V\007\272\261\356\302\204j\273\243\211\033\210\274\363\312\376\3611\266%?\260\034\032J\273\373\251\213\257\316i\256\374\007=\200\353\305:\207\342\312=@\312!d\300\253\305\031\320y\341z\320\223\304K\314\004@aw\235\256\227\211\273\273\355\n\266/\330\231 \247w\257\355\354X\332\301\311\333cLH5\375\315\211Se\035\361\310|\264\222\311\036\305\324\026\366\271\325\036\373\224\3662=r\240\237\313tv\351\013P\032\255\365\263Bm\343\352\334\206\254Q\247\003\206\355\373B\227\331|\206'\350(\301\200v\367\343\207\354\232\3130\312\016\217\030\273[\343\356\340!\357\362\203\376\022\263\024\343\022RKY\366\324\307\361\332\214\357\343\017))Cg"
+	.ascii	"\344&\332\210\222.{\321\fW\024s\201\370\r\024w$\201\350\264\024"
+	.ascii	"\013\b\236\336yz\331\273\023,\232\212lD*F\364Cw\360\272\211\266"
+	.ascii	"Y\023\247v\210\333\270Q\020\333\335\b~\215\317^|\237w\016e\362"
+	.ascii	".\231n9Q\001c>\232\026\026\320\245DDJ\005\306B\312\005\\\tU\031"
+	.ascii	"T\300\030\002F\235\260\200+0!\352C\255|0`\312\313\207R\315|'"
+	.ascii	"$\016cR\252\217&\fU\2377\342\234[\355\261HR\020#\034\025\215"
+	.ascii	" Sm\f\032\026\\SMr\232\256$<\264\331\b\230\2307\356@\332\033"
+	.ascii	"8\250z\030\211\312r\201\364\324\001% P\202A\312\354\016\265\304"
+	.ascii	"P4\335\n\303\241\255\237]m3[\033\220\210p\210-{\243\341\355K"
+	.ascii	"\347B\222=\013\227\355\266L\215\205\317V\230\027\001\343\215"
+	.ascii	"\362\252N\232\036N\304\361}E4`T\033\214\211\025G\354aA\253\200"
+	.ascii	"\362\230=1\265\243\022q\262s\363v\246h\031\n"
+	.text
+	.section	.gnu.lto_isSystemConfigured.157.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"5\007"
+	.string	"\342\21525`m\322\001H\241\br\300"
+	.string	"\001\311\221\206/\325\372\252\210\002\320D[a@>:vh\004\377\321\027\246-\006.ap\375\324\326\027\355\fJD4\273\211\224)\005\216\230\007MfCE\0303p\243i\200\200\261\262 f\300T\204C\005'(\252\202\227\016\373\264\nR-\3004s\336\252\\U_\212\207\224Y\342 \026\300\356\205\202\377q\021\205\337\361\347\nN^\373\3639\225\277+\001\207\b\313\222\335e\251\031\366\247U\220\355\264f\372S"
+	.string	"'\262}T\262\373)\241\354\310#q\266;\366\305\b\t\035_\3576>\002\036!O\310\311n\007U\343\327\363\362\037:\003\311\310D\333,\236\226\205\335uj\033\306\255\267}`\333\3006\027\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_setRebootRequired.158.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"%\007"
+	.string	"\242\21526@o\323\001x\275Kv%\030~\230\233\247\004\221\030\351\200C\357\200\001\205Bk\302v\262i\303LG\201\027\2240EQ\\\303\353\321\017\251\225\3047o\335\310\226)\005\2754\b\234M\007\273\342\265\211\035\216AB\2742-j\002\212)\034dq\001\303\262\230\371n\352p\204I\021\231@\360\241\227\264f\265\f\r\351\256\031\"\312`A\201\200\\m\217Uw\330\303Sc\324\341\223\356\\\325\037\313U\365aB\252\340P\001\345\251\375\270\204\026\255\251\377/\034\265\224F\021\222\360<B\362\207N-7U%\245\266\316tkO\374\221.\240!\022\001\262\362?\302\013o\316\255\366\206\001:\217s^\n\3767;o\302\205n;\320\226\240m)\b"
+	.ascii	"3C\347\004F\374\371\356\030\013\3572\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_getRebootRequired.159.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 \344U\006"
+	.string	"\"\314,3Pm\222\016$\243\252\214\252\n\266u\001\233\t<\"P\264\032\355V\nk\366\357vx\255`*\276x,\221\231l\234i\3013y\245\202\300Q\343\026\367\226)O\027\210\fFCMm\3024M\306!\242M\325D\273\030LI<T\215\202\242\252f\311\262\030:<\360\340\347\033R\021\353\212\256\330\\\257Jw\023P\351p \303s\243\317:\207\032_\200\314\3141\364\337\207\004\036\"\254%\243L\320h%S$\224\216\237\363\226\025\0268[\3158@\005\037'\026#*\231Y\303\215Z=\353\026\244\r\037\023\222\013\353\364\004\0302\363\2730\214\216\375\023~\204\377\"\007"
+	.ascii	"2\001\0238#(\016%\256\321K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_CSWTCH.67.259.61b376037f100423,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_ensureEEPROMStructureIsValid.part.0.303.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\005\t"
+	.string	"\"\31778@\217\322\001x\021\340<\t\020\323\344\001\fB\036\234\256\004\310\261\022/\3461/\207)\373\310\372\261qX\360\231\316\320\313S\240\253S\016\321\243z\021\\hGlo\271S\n\3166\017\236\316G\313f\326\231\037O\003\304\314\266\211\2719\260\026\341\260M\nM\333&f\033>\256\242\314\271P\222j\312\366$\274/\310\270^"
+	.string	"\320\377*,\340K\376w\206\225\224\031\027IGPS\326\370\270\212\262cT\265\nN\273\03154\333!U@|\223\177\241\237X\273\226\220\323jw\317\272\007z\211\007L/\240\320}\022\221\215a\227\037\261-\3220g\307\234\365\261\b\252\025\006\312kw\347\245z\234\273\302\310\371\260\324\215\256\367\036EL,.0\255n\343\320\3401\200\263\273\026\340\270\345m+\330N\260O\020\032"
+	.ascii	" +0\356j\257H\203\213\301\024:o\003D\3010W8.\213\253E\274E\210"
+	.ascii	"\337\022\210\324\261)\004\254\334\333\231lf\213E\211\323\031"
+	.ascii	"\240\315\224\235\006\200kO),l6\365\2042\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`*\n5\037"
+	.string	"\0261\257Fp\336M:+\001*\270'V\341\262\364\003\247\373-S\305^\034X\213U\021\224\001\252\037\034\373\020\344\004!\240\226\237\361}\036? \371\340D\264'\034\370\212Mp/\354\330zW;\240\323\fv\f\333\320\266M\222\f\235"
+	.string	"\227"
+	.string	"\235"
+	.string	"}#N\375\262\246>\021\246\376\020\031}\262\245\276\220\030\375 &\232\246\352\232R\233h\346M\342\271\035R\037\210\261\377\343\250\357\303\204\361.F\177{q1.\3566\364\266\005\017\323\342`\032\374\013\213\237\255x\025\025\367b"
+	.ascii	"\315-N\212\276\230\211\342O\320\023f\226\211;)\361&\273\273\\"
+	.ascii	".\367\220\350\217\215\350\203\211\350\177\205\350{\231)\312\006"
+	.ascii	"\242"
+	.string	"\337e~8\334\360j<p\237\016\207\"\344p%W\2616<k\307\314@h\232\242k\314\315\f'v\035\212\242\250\206~\017\223\231}\t\002R~\364\247\370\350S\031\353\243\211\365\255\204\365\257\364\350c\001\353k\371\352\247y\365\325x\364\267t\365\271p\365\331v\364\327\266\372Y\264\372K\324>\223\254\276Y\332g\217\325_\217\366\307t\237\214\216~\231\034\375$\216\276\231\253\376\031\253>\232\243(\312|`Y\325O\363\033\374\207\212\375L\035\265\361T\352\352\216\271\352(\205dZB~k\307|$u\224$\245\204T:\032-E1\340\253Z\307s\355j\364\223D1\237\035T\037\311S\377\b\323A\353\214\321\350\027\231\021\347=\262'.\317\216\352\031\017X\222\275)\367\346\rJe\307\234\367iub\333\344y\233R\337y\221\332\353\364\\\271\023\324\336\224cg\013\273\235\327\327^\247\026\306\262\231\363\366\3303'"
+	.string	"-.f\214\346\274\274\226\323\234\027j\365]\243znCQ\024\203\357\026P\317s\224`\224\fh\271\315w\211\027z7hu\300\327\247>\340\333k!\360\355\261\021\370\366V\t|{*\021_\036;\201/o\245\300\227\247V\340\373\326\002\337\262\276\034\221>\233!\3758\262\276RH\177M\220~\024 \375\354F\301\025\220\236"
+	.ascii	"\034\255\270\342\320\005b\213\367-\267)\036\312\034\036%QQ\216"
+	.ascii	"x\215?\"\361\032\3779\263eR(\304Fh8D \274\031\202\302{5\030\027"
+	.ascii	"\274E\312\340\035\006\357W \003\257\021x\213\200\227\250\004"
+	.ascii	"\336\263j~\367K~\367\351\371\273Ip\277[\264\346w\211\327\241"
+	.ascii	"\312\337=[\313\256lj\313\256jj\313\256i\317\242\376iv\310\250"
+	.ascii	"`Y\317{\362\204%\371M\314\312\236\367g\237\302\336\t\333\355"
+	.ascii	"\225J\346\274V*\025K\265\266S\354\224\212l\221+R}\20027\\&\200"
+	.ascii	"\266\250Q FM5\n\222\224\2440\214\001 \003\231\031\247\003\021"
+	.ascii	"\200 \351\214S(\220@DD\244\322\036o\372\2318\356\332\260=\325"
+	.ascii	"]\372\265\n\263-\212\231v#fGy\343\027\217g5r\346\255\365\027"
+	.ascii	"\214\225\334/\037\277\302P_2G\261\217d\263\374\250{\2561>3B\235"
+	.ascii	"\206\305\375\242\277h\013B\3519\021b\013\025\257\363\307\253"
+	.ascii	"\217\\/0zK\267,-q\033\232\023e\200\327O\b\274fPT\310\347\271"
+	.ascii	"R0\"\2576\304.f]I`Q\\\324$\213\376\037\311\233\341Oh\376\025"
+	.ascii	"\371w\263(\026\n\205B\261\260\302\265(hY\364UUUm\323\264\246"
+	.ascii	"i\232\246m\232\3264M\323\274JP\361D\221t\251rRR2\227\371\241"
+	.ascii	"s\224\376\037\231\313w\002l\202\007\323\321\f\315X\240\270\277"
+	.ascii	"\262\352A\317\233\210L\274\345\223\337\300\366\351|>\327I\302"
+	.ascii	"\245qN\315\bd\314\022\351\001\273aS\344\304\251l\002E\261L\f"
+	.ascii	"\252\324\017\242\203o\r\224t\225\267\241\036n\272\314\325\322"
+	.ascii	"|HTk\265\254\230\274\254\257\002"
+	.text
+	.section	.gnu.lto_.refs.61b376037f100423,"e",@progbits
+	.string	"(\265/\375`Z\001\225\f"
+	.string	"\206\340W> o\223t\001\026\002\bh\343\300\251\301\211\366\002\030\n\022\200d@A00"
+	.string	"$"
+	.string	"$\002\b \325{\322r\230Fb\3361\301a\331uN\354\3506\373\377-Z\354E\337\276\375F\366\226)?"
+	.string	"H"
+	.string	"H"
+	.string	"\337\221\317\311\236\345c\371\233\354\231|L\376%;G\276\225\275\312\317\354\226|*\373\224O\311\336\3621{s\r\320\275\251J\247\216Q^Cy\214t[\3555Z\267\340]\351\267\373\366\251?\b\001\030\315_\231\333\312\334\033WO\314[.O]}\272\274t\371^s\214\336E\353\267\300{\026+T\244@\321\377\204\325?\261~\023U\337\244\372=\344\337\341\372\033\356G\367\f6^t\017\312\037\220\375SuO~'{\200\f\303\310\372/\262\023\f\273/\201\375$6\367#6\277\210\020& >\334\317\341\376\001v\007\370#\374\006\330\027\340+\300^\202/\302N\202?\202/\202=\204\017\302\017\301\016\202\377\201\335\003\237"
+	.string	"\366\017\276"
+	.string	"\354\035\374L\363\001#\270\004Wr\"\0249\222\353\215\340\r}\2407T\320!\275\302\237\372m\033\300\245\326\033\336\327\202\340\365\374\321\353i\001\217\336\366\323%O;\275\0328\275\031:\276\0308\337\013\026*"
+	.string	"\370R\230\220}%`o\204\0312\260\037#\373\024"
+	.string	"\272*\nR\216"
+	.string	"\023(VZ\314e\032\213b"
+	.ascii	"\314\266\f#\033c\231v(\306Z&.Pc\002\214\001\223\226\335\216\324"
+	.ascii	"\230Li\314\264\2522"
+	.text
+	.section	.gnu.lto_.decls.61b376037f100423,"e",@progbits
+	.ascii	"(\265/\375`L\220-C\002\332\237\277\313V Ji7\215\001lS2\212\002"
+	.ascii	"Q\336\261H\322\214lv\"0)\273Y\204~\037)\023\t\344\227\2525aH"
+	.ascii	"<\317\345\353\315\255\206\314)\377Y\r{\013\327u]GM[\031\216\352"
+	.ascii	"\252h\333\266-\211\022\304\314o\272\246i\226\301\035\324D\247"
+	.ascii	"\221-\367\336rK\231\002H\013\343\f+\r\245\\\020\254\244\210\354"
+	.ascii	"4e'[\225r\236\234J\030s\225&)\267\36715\0132FF\b\031\037\357"
+	.ascii	"\321\371\341\032\235\327\020C\337\350\215\276\221\232\276\221"
+	.ascii	"\231\276\021\230\276\021\022}\243\036\372F2\3643\310\351g8\243"
+	.ascii	"\237\341L?C\f\372\031~\350g\240\241\237\301I\277h\216~\221\031"
+	.ascii	"]\342)\363\\d\2072\016\256\013\312\n\347\027\201\321\"\330\373"
+	.ascii	"v8\357\334\334\355p\276\210\212~\021\021\375\"\033\372EN\372"
+	.ascii	"Du\364\211\310\350\023i\321'\222\242O\024D\377%\234\270\023\007"
+	.ascii	"\013>X\336t\240\243\276`\221\342\346-\257\211\271)\202\363\377"
+	.ascii	"\262M\311\346\"\313\267r\315\361\334M\033+\337J\267\263\344["
+	.ascii	"\251\346\306\335\266\256\235_\\mM\371\002\232S\"\245\354\314"
+	.ascii	"\037\272\243?\244\246?t\324\177\231\006\215\020\214\033E\334"
+	.ascii	"\340\374\227h\312\2664\314\023(#8\237QcU\365\003\347\017-\321"
+	.ascii	"'\341fF\322\316\036\2678ljv\330\341\343\006\307\b\2227B\206\350"
+	.ascii	"I\226UkB\210\3149\002\347M\235\271\244\2358.:v\260\334\034\243"
+	.ascii	"\024\267\254$.\"\307H\0243lix$\303\246\250\031\215H)C\226\206"
+	.ascii	"6&I2)%\304+\016\333\231\256RII\246tR\216)\273\224WJ1\245Zi\244"
+	.ascii	",R\376(\305J.\245\226rK\331Uf)\307J\255RG)\244<RR)\245\224D\312"
+	.ascii	"\036\345\224\022J\371U>)\311\312\033eX\211\245DRV)\267J\2572"
+	.ascii	"\206rHiV\342(\271J\264\322Ki\246\214Rf\225;\312$%[\031\244\\"
+	.ascii	"RZ)\301J\036\345Y\031\246dR\372(\215%\262\004S~)\217\345ZY\246"
+	.ascii	"lR\002)s\224i%\326E\226e\345\325K\032e\215\343\244\234\030\311"
+	.ascii	"$\0300\243\0254\263<r\30642G\214aX\316\222v\260\0369F\234`0\026"
+	.ascii	"kI+\\\246\210\371\n\313r\205m\215\21690\222\327\254K\230\021"
+	.ascii	"\r{\221b\304c_\242\b\351\222K\212(\303\177J\031\345\221K\003"
+	.ascii	"\240\334$\337\300\375y\023gJHic\217\231\"F;x\270\366\274Q\211"
+	.ascii	"IC\022v\206\305HY\206c\300K\312\243\221\001doe\274\21409\203"
+	.ascii	"\303\264\230%\303\3122L\005#\205\234\210\366\016B\306\270\367"
+	.ascii	"F[#rv%\313\03382D\2243\240\316`\261\037\263\241\351\221DS3\202"
+	.ascii	"\2154\t+\333\202\355\334\341\203\303\360\026\026b\370\r\235\027"
+	.ascii	"I1lr\030\323\332\254\3012\206\231\005\321Bu\343\204\236\210v"
+	.ascii	"\024\024[Yie&\211\331\312p[\020\037I\214V\206\303\220AI\356}"
+	.ascii	"<\243\204Y\362\343^\345\017\001\321\332x\217\316\333\342\032"
+	.ascii	"\235\037\302\241?$\245/\024\247/\364\246/\024F\2272~\334\007"
+	.ascii	"\373)\247\256VZ\203\214\227-8\307(\377\300\330\022\206\363\205"
+	.ascii	"\266\350\377\245T\351\242|Q\266\270\310\022F\031%\302\323%+\217"
+	.ascii	"F\264\214\253+Y\302(Y\334\270\362\310E\273@\026I:]2!'\242\r\345"
+	.ascii	"F\204D\t\243\204\332NuBXR\307\216\232\334\336G\223\b\026\234"
+	.ascii	"\233._h\211\276\220\021}\241\"\372B]\372BB4\236\023\361rg y\250"
+	.ascii	"\224\340\234\267\364M\336\243\263\202kt^\250J?HN?(\216~\320\232"
+	.ascii	"~P\026\375 )\372A]\372AT\372\202kt\036hN\037\350M\037\350\213"
+	.ascii	">\020\025} %\372@?\364\201\252\364wq\032\204kt~\027G\177\327"
+	.ascii	"\246\277\303\242\277{\242\277\343\322\337\311\320\327\371\321"
+	.ascii	"\327\301\351\353\332\364u]\364uU\364\217\327\350\274\316\210"
+	.ascii	"\276\216\207\276nJ?\325\243\237\312\321O\301\350\247R\364\323"
+	.ascii	"\"\372i\225\276\236\323\327r\364u\030}]E_'\321\347r\215\316k"
+	.ascii	"\035\372\232\205>jG\037\025\243\217N\321G\215\350\2432\364\317"
+	.ascii	"=\372\347\032\375\263\213~\032\256r\214\374\361\361\252]26I\016"
+	.ascii	"+8_8\021\307U\270\210i\321\007\347\237Xty\215\316\267\335\243"
+	.ascii	"\363\347Q\277\355\032\235?\225\350\237>4~\202\277.\022\tC\031"
+	.ascii	"\272i\240fd\341\374\023K\217`_\244\363s\027\351\374\271\365\315"
+	.ascii	"6\372&\233\376\261\222$"
+	.string	"\330\bT\304\006\21538\337(\"\216\225\f\271\241\341A\202\363M/\372f\367\350L\311\364\315$\372\311kt\336\354\3227s\350\233.\3643\036\375\354\246\357\306A\360\217\035\0276u\330p\376M\323s\343\204\314\275\265\344\214R\354\354I&\377\213\346\307\255\303g\013sa-\f\004\367\300>.\022\377\300;\216\2630\217\343\343\336QY\344\364$\367>\342\037\327\017\326q\333\272\262\2319\311\275\367E\363\343\356\271q\267\255K\001R\350$\367>\246_j0\031\"\224o\333=:=\\\243\3639\214\316\201$\004\227E\313\n\316\317c\372$\356\0377Rf\356\334\233\221\no\314B\250\334\033\310\031\243\332\21320\324\304\270X\273hd\274\301T\270\005[\022[a,|\003\333\300U\370\n\343\30050\r<\343\"1\025\236\372\345s\373\034\223\370E\034S\341\0307N\350\351\270\253P,Un`r{\037A\200"
+	.string	"\321"
+	.string	"&l\3426\344\347\033\372\231\205~)\247_\266\321/\303\350\227V\364\313/\375R\210\376\361\3231\013\034\305\201\315AcEM\335\300\031C\345\033kA\220\340\374\262\207\306N\"\216\237*\320\022\246\013\316\3505:_\342\320/\267>N\352\3438\372V\335\2433C\030}|E\037\207\351{\347\342\271\310\016n\236_\270k\346\346\323q\037\367>\016a/?W\2208\0373\321\277\035\234\345\334\334\355\340<&\242\3615:\217u\350s\241s\337n\037;W\246\340|\022g\342d\t\263'\215\214\234\2301z\324\312\3201\2636\347\277k.\233\333\346\272]9\027\316\215s\337\\7W\315\235s\221\367\355\266\375\242\271i~\217\277fW\372X)\363c\234\"v\311\204\312\275{\3741\356}\274\b\277\210\177\204\b\367\355\262]\262\333\206e"
+	.string	"09\311\275\217\277g\277\210\267\253\345\202\361"
+	.string	"\265\367\223\216\n\324\220Q\255\311\355\275A \201"
+	.ascii	"\001\002\004\210\335S\fN~\220\362\335\367\350$\272F\347o\033"
+	.ascii	"\375;F\377\222\351_0MTD#\325\320\027\334\243\363\267\205\376"
+	.ascii	"p\217\316\013\365\005\363_,7\313\375\302\201\275\243\366\336"
+	.ascii	"\034N\251\250-&8\337.\327\313\357\227\313e\337/!h\355\375t\277"
+	.ascii	"\f\365\331\373i\350^\f\356\305 \203q%9;\363;\240\357\026\021"
+	.ascii	"\277hFg\025\326q\233\355\275\207\3127\253.6p6\257\321y\fh\020"
+	.ascii	"\356\321y^\243\263\204{t\276\005\375\267{t^\001\372\311{t\336"
+	.ascii	"\343\245r\221\024\334\261\217\020\341\245S\225-e\357\343P\320"
+	.ascii	"\037(\177\370\340\374\022\364o\225sH\263E8\222\376\245\340\274"
+	.ascii	"s\227\202\363X_\356\036\235\377\r\373o\224+\205\202RjJk\233\355"
+	.ascii	"},\032:\336\220\001\004\347\037\357\321\251\257\321\371\347!"
+	.ascii	"\bP\310\371\375\265\215?\317\250\302\3407;\360\347\241*"
+	.string	"3\246:\230\303\f#=\002\301^\202?\r\312-L*%\232\025\016\346\361c\237\340O\213\260\006\314\274\357\237YH\371\363\013\346\220,\002\355\007\305\013C\212p\376<t\001k@\317\237A\230\354\330\323_\327\371\261\006\312,j\006q\335\257\321\\\377z\3557/\360g\017\314\fl \203`\261\0064\231\313\271\033\236\300\003~3\212\t\006\345\277\033~|\002F\001\223\360\343\004\230\024|\375x\350\307!&0\237\374\330\350\307\027\374X\303\2179\374X\203\037\003\3758\003\323\tV\341\277m\031\370\017\001\022?.a6\371\315%\177\336`V\351\027\177\251e\036\371K+\177f\3723\007\246\2212\004\177\t\303oz\375\371\304\237{f\021\023"
+	.string	"D~3"
+	.ascii	"\177Y\354\372o\331\177]\374e\003\376\374\302\220\277<\341/5\360"
+	.ascii	"\347\rL!!\202\224t4\374%\007\023\001\277\t\344\307`\270~\254"
+	.ascii	"\347/\363d\024n\207\377\006\3757\203\377f\270-\376\033\343\277"
+	.ascii	"L\376;\365\337!\3775\341\277S\376;\200\377\242\375\267\353\277"
+	.ascii	"<.\327\177\261\376\273\365\3371\377\363\230\030\374\345\234\255"
+	.ascii	"\3374\341\307\217\2218\211\251\365\233*\374e\037\037\277i\242"
+	.ascii	"\307oR\340\317;\223G\326\217c\374\231\002\177\256\200\271\343"
+	.ascii	"\307\302\037\007\177S\307\217\207,\374\271\0053\307\2179\220"
+	.ascii	"-0\261\376\222\370\233#\374\347\200\227\374\330\n\357\377\035"
+	.ascii	"\234\003\023\307oV\2311~S\3527Y\374\270\354<~\315\343\317t\314"
+	.ascii	"\247\377\256\271l\376|d:\305\375\3466G\320\3477\261)\002\364"
+	.ascii	"\317 \330\213&\2230C\260\003\301\177\207\376[\301o~\340j\316"
+	.ascii	"\301\177\027\356\3417a\370M\025'\341\327\025\3703\b\366\317&"
+	.ascii	"h\026\377\325\300\310\364\300\3638\375w;\300\007\314\341\237"
+	.ascii	"\213L\341\237\013p\364\327)\376\253\371\277\346?\233\377i\376"
+	.ascii	"\307\371\377\346\277\233\377o\377\335\376\313\371\263\217\377"
+	.ascii	"_\376\003\375i\211\017L\241\031\264\361g2\177.\363\347\265\277"
+	.ascii	"\264\372\237\3774\354\317\310?\227\375\331\312\237\307\376|\374"
+	.ascii	"s\225?\223\375\371\n\234\337l\372\363\221?\213\375y\312\237\331"
+	.ascii	"~\023\370\237\350O\265\374\346\013\277\271\364\233\353o\366~"
+	.ascii	"S\375M\336on\34073\360\233\027\370\315\n\374\246\004~\323\001"
+	.ascii	"\277y\302o&\3407C\370\315\021\277\t\302o\n\3407A\374&\007\277"
+	.ascii	"\231\301oV\360\233H\277)\364\233@\277\231\376&\372\233\346o\226"
+	.ascii	"\177\356\363\347=\177\226\3733\334\237\223\177\206\363g7\177"
+	.ascii	"f\363g\266?g\371\363\331\237\265\376\\\365\347\031\177\236\372"
+	.ascii	"3\214?K\375\271\305\237\237\376\274\377,\202?\027\377\f\202?"
+	.ascii	"\253\3703\212?\263\177\036\3769\370g\340\237\177\177V\372\263"
+	.ascii	"\357\317\032\3703\006\376l\201?\273\360g\023\177\206\300\237"
+	.ascii	"\037\360g\007\3749\205?3\340\317(\374\331\204?+\340\317\007\370"
+	.ascii	"s\001\376\\\302\237G\370s\b\177\016\361\347\017\376\354\301_"
+	.ascii	"n\371\257\225?s\360\227#\370\363\006\177\311\341/\363\374\367"
+	.ascii	"\314\217\301~l\345\317\031\374\031\203?[\360g\n\376<\301\237"
+	.ascii	";\374X\001\177"
+	.string	"F\372\237\347\317\033\376|\364g\243?\027\375y\350\307\032\3703\320_\366\371K=\177\031\367\227G?\006\363\227t\376\362\316_\302\375e\362/\213\1779\347\307m\376R\316_\302\371?\366\227h\177\251\345/\263\374%\226\277<\373\313\375\227\275\277D\372\313\377\267\355\307e?f\362c\343\217\257~\\\365c\247\037\027\177\354\373q\005~\214\302\377\025~\\\342\307!\374\030\204\037\003\340\277o\376\353\346\277o\377E\363\337\r\376\317\371/\345\377\216\377e\376{\230\233\233\233\373w \3701`\177\037\004\002X\3170r\214 $L\370\234\341\374\2447\307\035\227\036Wjh\033\351\327\021\032Cp~\022\232\3264\360[\030\26518?\211\212\326VF08J4\225v\323\023\244\f\316O\342\241g\374\371E\242\177\364\324\255\272{cY\003\003\215\243\202\246\016\3161\356\r\266\255=8?i\206\326/4\224\216*\251TA"
+	.string	"\312OR\273\320R\032\306E\352\027\232\305\3219\275\303\364\013\355\364G\277\320-\304\354\270e\311\351\336\270\355\021\242\363?\360\243\377\301\034\035\365\3430\375d\226a"
+	.string	"\004\361\023\207\363?H\243\317\017\262\350S\353\036\235Ws\215\316\177\360\205\366\021\312\023\003\317\030\234\377\001\227F\371\240z~\221\250\0364\356\202\030\240\346t\234N\250L\321\201\363?\230\241\177T\016\215\3232\204k\013g4\317\r->Hp\276"
+	.string	"\376\350\037\275s\221\350\035\024\356\203\326\246\361\001\223\251!Yr{cy\220\266\371\023\006\005\347\013"
+	.string	"\215\376Q;(\234\2304-_p\206;\232\274f\336h\331\252\203&\207\266\030\361"
+	.string	"\321Y3\326\300\371\250\001\353\311\f9\277HT\016\n\307\304\335/\320\220<\222{cy\260+\303\347J\031\234/"
+	.string	"+\372G\343\240p\316\240|\221\203\363\033|\363\304M\311\302\371\0020\3526\250\030\324\255<r\321[\270t$\3216h\027\363\315\003\213\275\201D9\225\310\020\273\222s\203\276\241kP5(\233\213D\333\240ap\033\024\314\231\245\346%\257\3458\2152\304\256\344\3206\350\027\252\344\336\307\240.2Z\274"
+	.string	"\3454ce\330\234m\234/\200,\335\206\236\271H\024\r\232\246\206\262\225G.\032\215\353\005\212\306<C\307pI\031upEt\234y\r)h\210V\023\0378_"
+	.string	"Q\372\327L\037\324\f\252v\221h\031\224\fZ\346\346\221!v\365U\352\031[K\236\371\036h\321\367"
+	.ascii	"\312\230RnG\243\315M\016\234\357\201\020}\017\252\364=`\241\017"
+	.ascii	"BN\037\004\034}\020n\372G\271\240hB`vt\201\303\262goA\n\202\323"
+	.ascii	"g\215MK^C\243\210\3412\313\202\376\260\362*\223\005\013:v\217"
+	.ascii	"_O\274\2401\260r\360\2302f\311H\032\361\201\376 \362\302\370"
+	.ascii	"\004e$\211\306\270\261#\211ZA\241\240OP*(\030\032\206:A\277\320"
+	.ascii	")(\031\332\004=C\243\240H\264\nj\206^A\217h\031\272\004\225"
+	.string	"\2022A\225\240b\027\211\216\241I\216\032\321\030\260\020\035\030\354\005\325\216|veF\022e!E\244G>#\002\303\210\216\241^(\222\362\310\245\001eri6\210d\241,`\\\361\2214\"\244\215\037!9J\271\027XF\224\305\213.\343\336\307'7^\306\032<\222(\213\026\250\213\362h\324e/\212\2401\306\320\031(\215\362hd\300\225\036I4\006:\206\342 \242#mH\037#\350\030\272\205\006q1\207\216\241]7\316\003\213\275\265z\f\345\221\341\004)\215\226#\327\210\034t\274G\347M\243\242\177\364\310Q$?J\004-r\343\202\304f\304\225\301\0315\"\342\350\221=\307\2524\234K\370\322h\325=:\017w\215\316\203@\242\017\002\210>\210\034(\020\2755D\312\f\234\017b\006\312\005BJ\377\250\326\321\0377\356j\355=F\245f\006\025\316#D\034\325:\277\300\374\320\203\363A8\351\007\240\216~"
+	.string	"\330\350\007\300\214~"
+	.string	"\266\350\007@L?"
+	.string	"1\350\007\300\207~"
+	.ascii	"\250\364\003\320B\377C\036\375\017n(\215\037\235Be\240W\273\267"
+	.ascii	"\030F\226\340\374\243TG\257~\264\n\265\272_\204\332\2348a\203"
+	.ascii	"\363\225\272Gg\3215:/\032\021G\251t[\222Q\250p\376\2072\272\304"
+	.ascii	"\272G'\211kt\336*3\375\017P\364?\bA]"
+	.string	"\034\203q`\357\261$Z\326`\301\371\037v\350{\274F\347?\274\320\357`\217\276G\235\320\375\003\022\003\024\234\347tq\310\200%\301\371\035\264\351\223\260s\346\021\212\"\332Q\\k\306>'\034\033\237s\317\251\347\364s\376\271\310\263\317\031'w\346\341rs\3669\327\234o\\o\311\263\317\351\346\254S\036\215:\006\324\231\344\336\373D\356p\323\002\224\337\301\030\375\016\302\356\234xR-\035\310'\234\337A\223;\035 \321\357\240G\362F\225:7p~\007T\372\3779\347\224s\221'\235\023\3161\016\031:\347\233K\206\032\247\342\324L\344\027\215\2713\237\0039\372\034\260\351s"
+	.string	"F\237\203-g\033\334\347L\233\030p>\007UN6\034|\351\377T\223\032Q\243\3021\244\210\2213@\264\262p\351\021\301\004\315h\226\365\"\b\035)H\266\366\244\031\313\370\360\343\005\345\354x\222\235f\316\262\323\3139\346<sR9\311\234lg\333Y\346\034;\335\316*\247\2253\315)\346Ds\232\235j\347\2253\355\314r~9\271\234k\247\226\023\313yvv9\303\234[N\344\211v\221'\230s\312\361\233SL\t\231\036_8jI\232\361\004sJ9\303\204\312\275\201\210\031\215`M.\331\02631\2509\321\362\004Ge\311\222\304L\362\2429\302f\3441w\321\020\201\223\264\262\003\206QMH\024\263\023\314\331\025')\345\307%;\301\234:.\231\007\250\275{\3608oL\331\301\222\333\373X\346 b\305\226B.\367=:\317A\2163\354\222\241K\346f\300\341|\016h\350s\340\244\017"
+	.string	":\372"
+	.string	"P\243\017"
+	.string	"\244>"
+	.string	"\212\350\003"
+	.string	"K\177\203>\372\033\320\321\337@\215\376\006i\372\033x\321\337\340\212\376\006G\375\r\214\372\033`\351o\260\3655\220\243\257\001\030}\r\314\3645\220\242\257\201\021}\rn\350k"
+	.ascii	"C?\0039\375\f\330\3643\020\323\317`\210~\006T\372\030\300\351"
+	.ascii	"c@F\037\0031}\fb\320\307\340\207>\006W\372?s\234X0\342\330l\301"
+	.ascii	"\031\307\361\376p\"\306\n\316\277`N\237U\347\024\332\323\226"
+	.ascii	"4\026\227\f\213Z\013\034u\346\342\212\224\231\361\274q\3328e"
+	.ascii	"\234Tg\215\223\306yuZ\2353.\362\254:a\374\214q\255\210\211\272"
+	.ascii	"dY\222/0\330m\3032\300\227X\362\254:\241p\324\32515$\353k\357"
+	.ascii	"\343\325\002s\353\322\220\177\201\030-t\215\316_\200\324\277"
+	.ascii	" L\377\202&\372\027 \321\277`\210\376\005Z\372\027\330\320\277"
+	.ascii	"@\206\376\005P\372?\235\232H1j\301\3717K\0345:r\214|\314:o\214"
+	.ascii	"s\334\340(>F93\217\331\307\324c\306\235\333\304c\3721\347\314"
+	.ascii	"=\346\237\2134\371\230p7\355\230w\314$\337\340\250=|\314+f\230"
+	.ascii	"\333\326\225\331\374\234\301\321\223\344c\2121\337n[W\ny\372"
+	.ascii	"$\305\230|L9\245\034;s:\276\366>\202\2701\330\306\230!\345{\274"
+	.ascii	"G'\3225:oA\030}\013\310\364-x\242oA\021}\013z\350[@\245_\301"
+	.ascii	"\234~\005I\375\n\324\350W0\246M\007\240\263\026Z`T\324\230k."
+	.ascii	"\322dc\22293\323n[W\n`e\330\230j\246\333m\353J\341\217\231\334"
+	.ascii	"\004\217\030\2363\247\001\202!\027\206\363+\030\322f\262\231"
+	.ascii	"g\314\265\2134\321\230e\314\320\230f\320\320h1\242\331\202\006"
+	.ascii	"%\202\204S\"\267\367Fz\261\325\243\216.\237\202;\372\024\244"
+	.ascii	"\351S\320E\237\202(\3727\307\334L\223\273ZB4\310\276t\340\214"
+	.ascii	"\217\"n\2161\200\027\020\260%`:\224akk1\340|\n~x1\273\\\244\371"
+	.ascii	"\305\314\022u\023M\350\211h\357\"s\222\346\027\363\314\304r\333"
+	.ascii	"\2722\230\233\344\336\273\003\b\020\347\022;hVg\3765\023\027"
+	.ascii	"\307\334br1\265\\\244\211\366=\245\234\034\243\211\226\345J9"
+	.ascii	"\335\221%m\362\310\261S\202\360\321\371\036\334h\023\313K\271"
+	.ascii	"\213^\201\241\342\005\347{X\243\357\241\213\376M3\263L\007\034"
+	.ascii	"\017*8[9\311T%\333\340|\017S\364\177\023iV1\217\246\2309fR\271"
+	.ascii	"H\223\314\f#3\241\230QJ*U\032\rJ\316\330\024=F'r&\231)%N\022"
+	.ascii	"\033\237\3201\232d\346W\230\233[\326\020\233832B\371\036f\350"
+	.ascii	"O\300G\177\2029\332\004\273ceD\370\340\374\t\306\350O\220E\177"
+	.ascii	"\0020\375\t\272\364'\260\322\277\331\204I\030+9up6\225\230K."
+	.ascii	"\322d\362\035\264\013\302\305\354\tg\025{\357}\037\346D\037\346"
+	.ascii	"\374\315\030\210\034_\210y\341|\022\\f\020,\0227\262j\364H\342"
+	.ascii	"0u\270\355H\232DL\033<\322|\230[P9L\"\346\016\263\307U\bK\270"
+	.ascii	"\236\310!1\215\230I\314#f\021\323\3134^\244I\304\024rs\210\331"
+	.ascii	"\365|\334Am-h\300 \312W\353\036\235\032\256\321y\t\222W&\020"
+	.ascii	".&Z<p\276\004i\364% \243e\376\320G\310\314X\331\242E\226e\362"
+	.ascii	"Xbr\245\n\316\227\240\211\316*b\3460\325\220)\013\203\363%\310"
+	.ascii	"\322X\022\320\320\357\340G\277\303\032\375\016`\364o\3220\257"
+	.ascii	"\314++\263*\035\003\342\364\302\2542\2510\327\230208\317\300"
+	.ascii	"aNRxp~\2072m\3060Y\2300JhQ\225\316\340*\2234c\230PQ\270\274\234"
+	.ascii	"\310\2312\314\251\2134c\230QHZ\353\n\025\2263\377&\f\363E\037"
+	.ascii	"\0360\276p\226J\205\bi\263q~\207\036\246\013\263E\336B\265\211"
+	.ascii	"\340\374\016V\372\035\246\364\221\346\364\221\222\3727\237\234"
+	.ascii	"J\257\267!kL's3\301\202\307\t\316q\216Y\366\336H\250\227/I\031"
+	.ascii	"8\237\204\236\027\177\356\223\371d?y\356\"\363\237\374&\213\034"
+	.ascii	"\f\343\236\243\tE\021\355\030PS\306\275\367\237\034w\264\222"
+	.ascii	"J\325\206\026n1\222{o\020H @\200\300k:\330\246t\371Hq\364\221"
+	.ascii	"\334\364\221\330\364\221\322\364\237\363\340\t\332#\306G\t\316"
+	.ascii	"x\376?\337\001\322\252\322pm\334\220\341l\247+\217\024\024\316"
+	.ascii	"G\342\242\377g:9\231\353\\d\206\313oHmv\030\3412\233\254\244"
+	.ascii	"\224\f\227\335\3449\036\240\244\366\023\327\006K\274\314\301"
+	.ascii	"\ti\315\271\262F\347?\317\221Sz\371\003W\007\3478\307\223I\027"
+	.ascii	"\334\027\234\217\204\324\377/2\303\311o\216\033\t\323pCd\016"
+	.ascii	"\316Gr\242\217d\324G\352\322G\342\241\217Tc\215\033\020\333\031"
+	.ascii	"\\\030\316\277f\310x\251\311i2\232\213\314n\271\355W-\257m\320"
+	.ascii	"dk\016N\316-\237\271dBN\307M%\302\325\034\334\027\bs\f\020*_"
+	.ascii	":\237\003\034}\016ht^\303\331Lf{^\313e>B\204\003E\345\265\274"
+	.ascii	"\367\323\275\030\b\335\213\201\031\346\310\023\362\314\347PF"
+	.ascii	"\237C\231>\207$i]\210\366\0303\234\217\305\312\274\314h\341\352"
+	.ascii	"\222\315\362YI\245J\227!\213$\315\254\030Q\313\322eL\353\222"
+	.ascii	"\261\020\001\223\307\3440\331K\376\222\305d.\027\231\273d\264"
+	.ascii	",]\362\226%i\366L\221\333\373\270c\303E\306\007Q\376\206?\372"
+	.ascii	"\033\362\350o\240\243\277A\215\376\2063\372C\276\222F\035\207"
+	.ascii	"R6vx\230\341\374\rb\3647P\321\337\300D\177\303\226\3763\331\030"
+	.ascii	":EF\016)\234\177\\\005\211\305\216\206\361\231:=\344p\006\252"
+	.ascii	"BE\027\207\013\2360\234\217f{o$\035\231Y\027\0278\237\204\223"
+	.ascii	"\374UR\251\322gC\274\222S\362\361\"\263X\206\362|\334\333,\213"
+	.ascii	"e\260\034v\333"
+	.ascii	"\314\366\023\215\r\360T\241\203\004\"\350L\216\317\2153G\311"
+	.ascii	"R\206b\034q\341\205\363\217\324\350(Gd\364\217\306t~\202\257"
+	.ascii	"\310\212\274\300\371G_\372G1\350?7ab\"\325\300\236p\316J\362"
+	.ascii	"\222\213\314L\236\253h\355\261\275\217A\345\323\21554\234\177"
+	.ascii	"?\234Cssss\367\303\371\347\030\362\021(-0>8"
+	.string	"\237D\221!R\371H\356*\203A\244\315\013#9IF\222\215\027\231\217d\257\264|$\017\251\023\203\03559\023\313\216=C\227\177\024D\377\210\206\276\0069}\rc\3645,\321\177\026\222\255\334\312\262\302\340\234\241^\\4\177\250\214\"\362\226\221\264\223DR\347H\222\305\237>9.\032>Y\306\2509\243\324\036\343E\243\307G\034\260\213f\017\217rn\206\321N9\347K\312\235.,\006g\244E\237\244\235\"I;%\235$\306\254#Oe\034\371*o\345\037\331F\246\221o\344\0359G\356\221}\344\031\031H\306\312\\YF\246\312A2\217\254\225k\344\252\234u\221\331*\277x\206\221cd\253\354\342\311O\233K\f]\2302Q\216q8\337\204\250\235\213\235\213\235\024\024\001t\341r\313\332I\241\271\260\345\244Kr\307\202\t\025\02028\277\204\232]T>s\202I\362e\nT\232,\235H\311\262\361\244o"
+	.ascii	"\235"
+	.string	"\201\341C\345d\276\351rT\341\030\262\333\251\334\320\231\033\227)s:(\334\343\316\036\271?\232I\0316\004O\023\235\037\335\224\021\034r|\340|\206\344c\206\263n\217n\317\023*W\"\214\356\316\357\350\344\236\341I\312\007\254\032\037~\035\236\353\344tq^\210\314\271\211\313\243\243\341\206,\214I\204\017\215,a\376\247\331F\227(k8\277D\025\375\353\354h\257+9\272\270\340t\2158nP\330\340|\224\262\367q\b\210\212\312K+\251\257\212hI\243B'\325Z\202\205\205\227nN\352F\314E\226&rR6\0377\340\244\340\354\306\215\016\316\311\244\206W\215/\323\311U\027\2627\327\301\271sh\310\314\350\252%[,\354\340\374\022U\272M\233\001x\231\203\033:\323a\f2\267fM\332\002\275QcH\217\241\037\373\213\03647\267\254!>t\270\334p\276\002\276\320\240\271F\2529'w\f+\310\031\234\257"
+	.string	" g\3168\321a9\2228\341|\005\314X[;\352A5\347dL\016\263=8?\001me\312h\257\363\212\252M\332\025)eHp~\002\300\220!\243\275\220\264\234\362\b}Q\375\251\222cq\303\306\021\234\237"
+	.ascii	"\257/_tc4|\371\342\226%\007D\305\344\314\0251\327\2151\261\220"
+	.ascii	"\371\262E\027\006\303\241\203C\215.\214\016\214\2323<\244\350"
+	.ascii	".&T9p~\002pd\311\242\353r\253l*\2440nnYB}\300\252\314\341r]\227"
+	.ascii	"9\245\027\214\260)]\272\243\n\216\032\264-\300\261dZ"
+	.string	"\f-\025\344\016\226\026\315\"\350F\013\260\004l22\335\031\222\226\023\\\ba\240\334\262\344\202\212\330@\342\302\312ug\272+q1\272\260\271bf&K\2145V6P\220?d\350\224\231a\023\310\221B\375hAcE\013\034*Tt\310[eS\265\300\345\226\025\204\226\206\243L\225\353\220`\\]r\340|<f\224\377i\021\013\247$8\037\001jN\356D'v\253l*\0224\332\344A\247\250\266\306L\271N,\035\202\245\306\007g\035\230.\254\211\026\027]a:),\300\246\332\200\321;\300p\260\321E1\263\234v\336\216\224\201\362?M\300\326\232\0278\353\276\256[\236=/p>\002\260\350\236 `\b\023&Xx\r\232\030p>\002r(Q\242\343\334/*\260\036A\276`\224\341|\004Di$Ht\3066i_\347\225>I\316\222\\g\f\302C\3266%i\304\210\256\310\215\322\353\006\232\033\316?"
+	.string	"ZW\227\256\b\222\336aA\246\222{c}\030\022\363\246\310\233\216\310uE\206\240\232\030\321\222D\003\001\242\023\242\3231\025\247v\2569\352Y\023\344:!h\037(bV\316<A_r\326\344\300\371\007\260\322\322\322m!i9\3459uP\265I\223@\034\2168?\256\333\312nbl\336\316\376\247'\033U\237=8\337"
+	.string	"kt:t:t=\220\264\234\356\200@\006.M\362\262`\001\205J\327C\307CH\210\027\262/\036\272,!\\H\216\004\251\325\321\023\205\263nG\206r\245\207\221;8\337"
+	.string	"[\252\256\273Q\245\303B\301 m\250\250\335\203\210\021\037\2524}\344\266T\326\207%!>\314\340\270\016\313\3149G\306e\013\355\177z\233l\201r\206\263\256\306u6\376\024m\263\246L\025\234o\200\033Zwu\035\215?5w\320\200\303\004\347\033\300J\377:\253?\005\3522\303\006\207\363\r\020C\337"
+	.string	"Q\272\031\272\031BJf\374\221\313~\224\344\230\303\371\005\320s\305\256\230n\352V\331TB5\250\246\260}\001i\211\361\242\213q\335T&\022\307\006\034\335\013\335\213\033TQ\300\004\351)\033b\304\371\005\330\241s\241sq\231P\201\365\320/\274\270\351\222G\307B\307\"\215\312\211\031]\033\036qx\340|\002D\371\363?:\250[eS\255\370aG\355\013N-\b\220\247\353\240\322#x\344\212\350\234\330t\\\275\341\374\353\234t\373\315\306\f$gT\220\0236\006\347t\256\274*\325\216\244\331Y\322\247\317\356\213J\211\2313\251648\237"
+	.ascii	".\366\354A\257\250\222(1uT\255\271)s\347wR\271Kt\204rKb\004\262"
+	.ascii	"A\344\313H\334S\271\334\207H\226\026\234\217'\315\363?E\241\314"
+	.ascii	"\251\"\222\007O\222N\330\021\347\024\217I\246\003z\3256\306\205"
+	.ascii	"\02588\355u\253l\2523\211\365A'\303\n,\006\316\037\300\223T\216"
+	.ascii	"\2344\211\244\345\224\347\354AU\244\217\334\336X\037\312(6\036"
+	.ascii	"i\350<M\276\361\371\321\005\347t\316\215\373\237\n\361\270\362"
+	.ascii	"e\303\n\016\0342i\222\213\020+\234?\200\255\377\364\355\177K"
+	.ascii	"\335\244@\2653vq\241\302y-,K\230.8\277\0049mO\331\264\245g'Z"
+	.ascii	"\244b\310+\311]\225\345\301nK\233\231#8\247j\3225\251[\0324%"
+	.ascii	"\244my\n&\r\223\212\271\310tK\312fB\355\247#\350\r\323"
+	.string	"F\031\r$\316kG\323N\027\234%8\277\204\2631\350\225P\271\367\323\2321UK\315\\dZ&M{\032&\025\363\233\226I\311\240WBN\307\355\024\002\333U\r9\234%M\354\314\231_\302\024\375\022\214\372%xi\\u\217\316\f\256\321\231zI\277\244]R.)Z\tT\372O\323,\372\352\003\321\336\\l\\v\025\226\007&TYY\f\234O\202\237\255\247^\351VzvV\031\367\020\031\250\261\244\022\203U\025\234\257\240Om\330\220\301\371$$\365Ec$E\022'\231\004NrI\332\344\266u)\300\311\231\2441=\342\001J*\005)o\252\244OR\261\333\206E\264\243\266\310\211H\253\244J\336\306R\263\264,%K\251\244\310\324\312E\246UR'Qi\225\324Mr\350N\2242\034D\331\310\345x\200\222Ja\312\234tJz\274\310T\354H$R\261\364+\r\273mX\307}u\331f\374\221\353"
+	.string	"\"\bN\315\333\2163\225\222\3458\304\016\316i\024\024\013G\031\0268\237\004.\372O\241\\d\n\246\361|u\341\203\363\361\\\316\377t7\246\b\227\026}\022\312\364I"
+	.ascii	"K\231\3505I\036l8\237\004&"
+	.ascii	"\372$\030\365I \242O\002\020}\022\262\364I\300\241\377\024Iz"
+	.ascii	"dL\355\016\333\021\354\2666\005\205\363I\240\241\323\256\264"
+	.ascii	"\310\020\030\027!Xp~J\344\177\n\201\"g\260\340\234\207\3402I"
+	.ascii	"\2142p~*D\350\r\311\025*8?\r\202e\356N\016\234S \272\005\t,:"
+	.ascii	"\320\361\330\342c\007\327S \177J\343\232\3010\347'\016\347\214"
+	.ascii	"\024\361\224\213MLR\f\347\217@'\275z\352#\275J\265L\250\375\204"
+	.ascii	"\004e\222\345A&\"\005\ng\335W\2344vpNw\244<\322\036\177\232~"
+	.ascii	"\231r\313\302\371#\264\321O\263\376\247\272\2564G\232\340\214"
+	.ascii	"\357\303\234i\216\247:\376\024\225R\025u\005\347\217\220F?\305"
+	.ascii	"\221b\375i\351\307\314\227\0278\177\0045\375\364\306\377t\004"
+	.ascii	"p~@\3019\265\241[\214\200\245\203\364M\0259^5\236\332\370\375"
+	.ascii	"\302\201\251\035XtpNi\210xZ\003'1+S\006\347\240kt~\004$UU$\262"
+	.ascii	"\320\342\352\370\301\371#d\351\347\265\233\316Hg\260\215 cjJ"
+	.ascii	"{\231%mH!a\301\007\006\214\021y\316\250\264-`oRRi\0139F,u\246"
+	.ascii	"c\r\316\027\341,\215J\243\322\0268\rJ\017T\312)F\022\234\377"
+	.ascii	"\224\305E\246-\242x9\342\300\371x.\331\377\324\344\312\023\007"
+	.ascii	"\r\312\323\223\216\363[\325%\004\227\335\2224y\326p\276\b^\351"
+	.ascii	"N\367\2232BamXe8_\204\254?\177\320\204\300\022\300\237>?p\276"
+	.ascii	"\bR{\366\350>'zJ2^\341\323\302\215\346s\335\007g\371\342\343"
+	.ascii	"\t\316\307\223\327\376\247@0\256\276\364\300\371!\364\221\223"
+	.ascii	"\253J\272\2221\007\367\245c\3109i\303\371!$\357\350<w\264\327"
+	.ascii	"\271\367=jQUm\254\252\017x\360<%\311\351Z`\031\023\303\371!|"
+	.ascii	"\321\017!\211\3765\034R\303\345\265r\357\036Y\247\332\321\203"
+	.ascii	"\207\360#\2314@\0239\3062J\033\213\0338?\004\2509s\264\327\211"
+	.ascii	"\320x`\254R\223|\202\363I\270\201\003G\3079Q\027\020jAq\340\354"
+	.ascii	",q\362Z\032\303\022\256)\234O\202\355\355M\2731q\267\024\226"
+	.ascii	"6q\222{gy0\364\307\317\025'\234\177h\034:\036jr\214\341|\022"
+	.ascii	"[\364\257\331\374\"5\033=\304H\0066\031N\300\356\230\033\225"
+	.ascii	"\017\234O\"L\377\232\355\"5\233V\223F\355\24734m*Nm\350\253\214"
+	.ascii	"\231$\316\277Ns\255\346\327gt\233v\3038\332\034!\223\331\310"
+	.ascii	"}\215\341\254\321\210\270N\263\303R\306O\022\234\215\256\321"
+	.ascii	"\251a\337\243\023\223\300\322\2776\363\213\324ft\0203j?y\235"
+	.ascii	"YSv\260\216\340\241r\302\371$\244\364\257\325~\221ZMo\245\240"
+	.ascii	"\265\257@hB\343\211\\\220\031\213\262)qb\304\350\264RJk\323\020"
+	.ascii	"@\0247/'r{gy\200\302!\202\345I\217A\357\254\241\361\3112\334"
+	.ascii	"\020\231\302\371#\340\350_{\361\242\301 \021\0357\027\230q\357"
+	.ascii	",\017v{\316\274\311\320_\314\037v\374\030A\002\232\332\261%\f"
+	.ascii	"\316\037\241F\377\232\013Rs\321ZHZ\373\252\204&i\346\340\326"
+	.ascii	"\314 \223\006\347\217\350\262e\313\316\314\b)Y\262\350\036)h"
+	.ascii	"=-\331\240\t\334\236)@`\250\346\364\300\371#\204\350_(W\237\375"
+	.ascii	"\"\365Y\036\023\261\271<u\341\200\255\205\007\037\221\245\177"
+	.ascii	"m\206\324f:\353\203\326\276\002\241\016\032;j\330\310\031#\031"
+	.ascii	"\316\037\021C\377\332\312/R[\3219\306xI\223t\n\203\221E\317\330"
+	.ascii	"\230\366\272{\357\215\265\235\352d\220&c\016\356K\213Eq\303\323"
+	.ascii	"V\245\212\366\272\273jo\254\003\220\355Hn,\254\017CF\342h}\201"
+	.ascii	"\021\023\323\307\f{\357mD\255\220\315H\246\307+H\350\034\343"
+	.ascii	"t^TZ\374\230\022\026\246\243\244\260\367~a\334XX\037\202l\270"
+	.ascii	"\t\342\205\363Ed\201\201\351(\277U9P6\254\0179\nN\034!x\256\243"
+	.ascii	"\\\262\235\033\253\2570\234/\342I\377\372\013\251\277\364\r\\"
+	.ascii	"e[e\220\003\2675\305\004\203\343d\016\316\007!\215\376\265\023"
+	.ascii	"\244vR\242\021\2617\020\037'\\\232\007f\013!p\304p>\b\\\364\257"
+	.ascii	"c\270H\035\203f\362Ak_\205p\246\213\0355}e\326\366\004g\315\344"
+	.ascii	"\327J\364\222\262\355\226P\336\300\231\201s\207\252{t\226W\327"
+	.ascii	"\350<\b_\372\327It\022]\003W\331N;\2646709\0366p\270\300\371"
+	.ascii	" \004\321\277>\242\217\350+]\325\336\\:Pc\025\226\007AR^\370"
+	.ascii	"\364\301\371 X\351\353.M\344\272\310u\021\355u\242\275\267.M"
+	.ascii	"\306\034\234\334\306\252\372\360\037\317Ej\257\317\001\332\036"
+	.ascii	"\3144L\220\234\341\374\020o\364\177\217\377s?U\355\275\257\314"
+	.ascii	"\343\256\202\002:\377\373k\336\373\341\017\272\345\315\340\177"
+	.ascii	"\336\373$\364Ia\357\035~\324\354\275\357\035\275\004\355i\007"
+	.ascii	"\316\377/\330\034\366\336VRQ\333\351J\215mYI\215mU\025I\231\331"
+	.ascii	"\262\332QV_Q[ZW*j\253\252*j;\025\355\261\255*\251\275eE\264\307"
+	.ascii	"6\016\251\261'\247+\025\265\255\366\336\332D[\352\311j\217\035"
+	.ascii	"\253\212\244\306\266\252\244\306\266\254\212\244\306\236\254"
+	.ascii	"\244\266\326&\222:\002\251\332\307-\247\242\030cOV{L\313\252"
+	.ascii	"h\217mYI\321\261c5\201\237..\261,cO\344n\027\251\250=CF\326S"
+	.ascii	"\025Q\233\324Qk\277\355}\315Z\354\252\335\266w\006{giU\275=\341"
+	.ascii	"\270\\\240\332f@ey\322\272\307\275w\007\031P\\Z;\252\315\351"
+	.ascii	"\3566)&Z{3\201b\3322\366\336;\004\247c\333&r\333\234\200d\355"
+	.ascii	"\251\026{K\260\217{\313\330\333\351\356\266\275\267\323\336\033"
+	.ascii	"\255\312:\356\255\203H\312(C\306\336XH2v\226S\227\026{c\2637"
+	.ascii	"\\\254\244\306\270\264Dt\2612f\334.\216NWjJk\033\367\333V\225"
+	.string	"\036s\242\262\247\366\336\327\2166Z\321\200\303Y\0131\347\206T\271\341\374\020P\264\006\202j\261Y\363\206\363C \3018\300\3524\301Y\377\210\341G\215\032\316\017\261\245\265\017(L\270\300p~\210\032Z\363\310\345\031\024\034pp~\b(\255w`YC~\301\371Iq\307]\233\232\227\036\234u\304\025\370S\022\262&T!P\311<S\022\221\251U\233\202?\225M\221\212\200v>U\b\024Z\201'\324\266\270B\2063%\361\326\246_\033,\372J\264+\261\210\350\013.\240G\\@\b\341\2178\\W\023\232\330\341\272\236\340@\374m\360\005\327!\261H<:SR\223\220\035\256+O\b\324\265\277\340\356LI*\330\020*X\240\032\\\372\265\32044\321\224\302\204\n\026\326\246\"qe5\264@\374\031\361\202\033Z\360\005\177J\032ZVh\202\005\242\225'\304\252\276\240\332\266\320$d\031\340\003\376\212'4\bZ"
+	.string	"Q\205\026z\254\006\037Q\005\2436\270\022W\326\304\005\017 \376,XQ\b\233V\226\2023%\205X\331b\253\256JB+"
+	.ascii	"\325\036S\2536\205 \266\277\023!\212\301\245\017T\024\203?\340"
+	.ascii	"\007!\214\300\033\241\004\025!V_\021\330\013\376B\260\304b\210"
+	.ascii	"\020)\204,S+\f\242J\352\n\314-1(\354\231Jm\360\307\002O \260"
+	.ascii	"\204\356LI\030\234)i\003\237*\004n8S\322R\360g\242\307B\373\013"
+	.ascii	"\376\210\316\224D\264\240\304*A\373\013\252\340\373\r\3213%\021"
+	.ascii	"=\264\277\240\n\304\036+t\246\244UI%\002\177\252RPP\370k"
+	.string	"W\242\006\"\003\332_P\205^O\025:SR\261\351\027be\213\305\246\037\320\212\241\360\204\f\032Z\b\354\210\274\240\265I\rf!\3607\234`\305PxBQ{\246\244\245a/Xd\300.\250\204M\"oi\b\324\362\202KC3\2704,\231\332\245\340\n<W\030~\304\214\256\030\n{\231m\207\345\203V\260-\361\267\264\262p\344[Q\337J,f\"z\265U}\274\245a\222\320\260iuai\350a\251\210\025\362\255\354\257\350\201\225\005\026Z\266\330\002\361\227\001\b\\Oh\022\262\f\240`]\n\252L=\242_\220\320\n\245_+\204\200/X\002\205J4\332y"
+	.string	"!\251e\325a\222\357\007T)@Tae\213m\257\310\266-\254l\221\030\\5X\321\262?\024\210*\004\t]X\177J?\237\260)8\201\265\375\261)(\350\260B\004X0\261\200\005\370\324\225\325\265\300\242\252\264\242@\024\016\021m0DD\334\021\317\f\032\216H\030!)\205\023\\\250@\013'\244DE\rP\361c\200/XbmU\337\017\250\242@\332\255p\204\301\t\355\272\324\301\002\023ED\016\031\214.\364\336\217]\203\353\222~\b#|0B\t*\320\227@"
+	.string	"\020\b"
+	.string	"\302\371\022\b B\004\001F\020\241?\202\210\262m\333\266m\333\266]y\304%\025\310"
+	.ascii	"\024T\r-\273\266=\225U\231z\274V(<\261\262DD!\342p\007\003\023"
+	.ascii	"omU\337\260\310;2Zy\f\320\240\241]\241\262l\t\017-H\320\266J"
+	.ascii	"\253\217\327r8SRP\370S3 \026y\276`\t P\310\032eh\327&\241z\004"
+	.ascii	"\003S\257\247\352z=\025H\310\256\030\350\365T\364LI>\2420\204"
+	.ascii	"\217($\nwD\341\220\327\264\266?\255\366R\240\232\256>\242PGl"
+	.ascii	"\177\301\242Id\327\246_{\022\227\202\277 \253V\300\204\016\b"
+	.ascii	"\024\262\240B]\201IM\211\255\332\022\203kP\217\270\n\r\331\240"
+	.ascii	"6\270\262l\261\307\353\021\327\242a\323\332\362VV\330\033j\231"
+	.ascii	"TM\024\016\t\177>\225\345\255P\201\354\212B\230\001]\321\376"
+	.ascii	"\200j\321\003\274\027\202?`\206\246\023>\241\241\320\307\304"
+	.ascii	"K!d\"\362\210\255\232\241\307\352ZVhb\205\n\034\022\177\276\242"
+	.ascii	"&V\005\252\274\265\027T[\342\317'\324\n]\360\255/\004\177@M\344"
+	.ascii	"\371\202\302\023\202\302_S\207\225\347SA\205\360\004"
+	.string	"\352Sa\365\t\233N\025Eu\250=S\022\261\307\206\350)u\030\256m\013\276\340\212\022y\353RPeAh\270\266-\264\254\332\022Ss\345\355z\277%\341\003V\237\260)=S\222\n6\304\322\320\210\325\r\325\246\036k\372V\025l\221\212\0258,\242\240\004T\231t\253\357\307\006\177\027\360\226\212\300!\022\353\013\376N\360Z\225\310k*\262\355\013\353\2208\001\320\nT{\272\226]Q\004\177=\326\367k2\203\277&\255Bm\322C\304\023\200*\212\240\360\247B\217\345@\\WviE\241I=\001\305P)C\211\237\212\024\374\365VbQ\005\273\003\256\301\240\312\324\343\251(\252<\025j\323\020\361h\267\016W\264E\035*h\213\303\340\217\303:\\\321\252(~\354\352\363\300\n\333\236\252\304[\n\376\230Z\241\260\211\310\353\261H>\341\217]\207\274&\225U\342\365X\"\357G$\262\035|?^\373\013\026\203F"
+	.ascii	"U\260\304\241\226\250*\361\212'\210B\355\231\222P\254\276\245"
+	.ascii	"\341\020\n*V_\360g\242\304\242\t\277!\361\\R]\b\022{'\261hBo"
+	.ascii	"\304\357,\321\033\361\323-\251.\374Z\025+\232\236)\211\002\242"
+	.ascii	":l\022\366\206\202?`o\365-\251MAKj\023\320:\\\321\022\213'vB"
+	.ascii	"D\342\312\372|*\2577\342\307[R\233\206\204\202\304\036\3577$"
+	.ascii	"\362\226\324\246\335\222\352B;,\262@m\313SZ}\035\316\224D\201"
+	.ascii	"omW\340\260IxBO\003q\002\342Y\344\021\233~\254\013\304\336\257"
+	.ascii	"I\r\256@\341H\310\256\030XR\233\320\366LI*O\330\324$\354\001"
+	.ascii	"\240\310+J\241\262e\033\\\233\202K?`\211&aK,\366xKj\223Q{\246"
+	.ascii	"\244\020\302_\313!\303\013Du\205`Q\th\345\265\254\320\004P\375"
+	.ascii	"\261+q\303O7$6\021\207KE\255\312\372\212\352\t\336\2063%\021"
+	.ascii	"\207K!\204?\r\304\341\322n\345\231 \016\227\202\330\325\367C"
+	.ascii	"!d\207z\345\351V\237p\005\242z\202\250W\336\220\260-\252\272"
+	.ascii	"\225W\2028\\\n\362\025U\023\204mQ\325\302\025\370\003\252K*\204"
+	.ascii	"\300\023Gk/(\344\255MB&^\273\022y\304\341\022\007\037\t\336J"
+	.ascii	",\362\210\303%\242\366LI\304\tZ\240\025Xd3\221G\\\201E\026\200"
+	.ascii	"\212,\bQ\260+Q(\205\272\242\324@\240"
+	.string	"\220\315L\275\36674[\240\025L\"\017\325\tQ\260k\013+\261\250\317\224$A\320\352\023\256\300\256*~M)P(4\201g\372V\"\273\242XY\0361\205\272\302\2107\374\001\2258\234)\311\002\025\302\023/\364T\340\t\"\336\020]{?\024\253\357\354\365T\236\217\025\366VV\267\372\204M\271\345\215 \361\002Qm\342\371V\340\t\225\370\363\361\210>\340\372S\322\260\262\305v\250\366xK\301\237O\330\013\256\274\025\305\257\035\252>\265\350LI\305a\023O\310\256X\352\365\324\020DvE\361c}\001Xy,\200 \002\b#\024\207ME\240\220\270\262:\"\257\005\026\211+\013\355\212Bq\330\244a\345\265P\0346\355N\337o\270#\022\327\236\220\035\362|\277aQP\370k\203+\212\225\035Jp\001om\325\325\307SR\022\256/\250-o\205\232B\r\026Y\r\316\224$dW,\205 \262Bbp%J"
+	.ascii	"\344B\033\\\233V\024\302\025.h\022\006W\037\257\027\\AT\032\002"
+	.ascii	"y+\253\246\360\261*\023KT\3421-\375\230\202Vb\221'l"
+	.string	"w00\r\301\300D$B\304\b\036\fL\032F\360Z%!\021)\205\272\202'\034J!\004*\261+\212\b\274\320[\231zAE\353pE\233\241\b\r\376\206D^\nuE\006\024N\374\200\352\tBv\305\022\007#\243u)\250\262CC\036S\353\373\245\340\340\201]p\205\217H\310\256X\332p\246\244\225\025\366B\364\216N\220`-\002U\024\274\240\360\327\366V\226\025\366:\264/\374\206D\236\222\222\020\221\007\004\003\023/\205\272B\b\006&\036\021\fLL\275V\030l\317\224\344\373\rC\264LK?\240\022\022\003.\221\247\344\373\rO\023W\205\213\302\365\375\206e\033\374\tM\f\213\276\340\257\002\034v)\324\013\024[\360\375\206B\301\337\nm\t\337oH\264\242X\201CmoUR2j\331u\250b\345\265\300_\313\013\na\370\261B&\244\325'\\aE\373C\241\262\r\370\265Au\310\205\r\301\237\332"
+	.ascii	"V\330\252\354\252\201\205\024\352\212\"\340\332\353\225X[\225"
+	.ascii	"\025\362-\021\371\200B&\342\372\023\016\333\225\210\2646\375"
+	.ascii	"Z\335\n\025\270\372v\032\214\210\301u\330$<\301\3673\321\252"
+	.ascii	"'P\030\005\205\277\366\347c\325\024\254\220\001\276uU:J\241\256"
+	.ascii	"\340\r\351``\342\215 \022\325a\n!\260h\005\273\242\020\366V\226"
+	.ascii	"\307DT\331\236\220\320Q+\024Z\207+Z\242\337n)\250\"\021\177*"
+	.ascii	"T\016\301\237\272TDl\342\371\324\225I}A(\004\362\3305\370S\331"
+	.ascii	"\226'd{j\207\340O]\"*b\205,\273rPR\022\266\305"
+	.string	"\036\257\307#\236P3\254\303\025-o\004\273\266\300\237R\006\030\230x\301\037\fLM\354\332\372xJC /\270\302\247a\365\tW\b\256=v5\341\202\207\366\327\364{\300\n\\\n\226\340\020\374\251\r(jW\342\312\002\273.-\375X\027R\b\201\300\022@!\333\006\205'0\365\202E\025X\001o%\0263\250P\201+\313K\241\256\340\371\326Ve\227\3266\370\323"
+	.ascii	"\303\217U\327\340\357\001-\261\3102\265Ff\360\247.\351\326^P"
+	.ascii	"E\341S}Amq\330\026\205\274\263\r\026\205=\036\020\270\366x<a"
+	.ascii	"[T9\360\332\340\372#\006U\266Ej\211B\341\t\236\222\222^\233T"
+	.ascii	"\b\fwMC\226\027\3745\001\371\326uH\344\265\301\265\251%\026;"
+	.ascii	"\340S\217N\337o(\264\022\325\225\355\005\177+\320\367+\032\022"
+	.ascii	"yk\253\002\205Cvm\203?\236\222RQ\373k\372\001yk\253\262<\025"
+	.ascii	"j\023OI\251(\250=SR\210\245!\2736\375\\\360\255\033P\254(\254"
+	.ascii	"\255\312\002\020QP\370#\262+"
+	.string	"\212\240\nM)L\0245\2450\341[{\301\025\304\340\004VbQ\250%\262E\023Vb1h\005\333\256M+pu\241\250\345\241\304%\325\005\341\357\004\n{\302V\310\232hY\341\220\030TY\0276,\005\325\023\355\317\204V\310DDa%\026\207P\254\276r-\002U\n\264+QI)\002+\320\247\002Pm\177K?\337\206\340\257i\267\002\333V\3102\265*\324\246]\313\033AD\033\374\025\265/\25065\t{\301_\223\256\r\026\205'\254@\241\tV\330\n\233\204\316\304\341\302\341\312\206h\205B6\304\216\310;\241im\211+\210B*V_P\005\337o8\204\342\327\366\324\242\325'l\342-\025O\254>\035\261\367k\211\277Vm\211\274\027\210j;\304\324k\177)Z \nM\214\260\002\177JB\326\304\332\252\354\321\013=!\260\307\256(\204\274\342\260\027\2646\375\\X{*\333\200\245\340\257\211-\021\214"
+	.ascii	"\273\246\020\0167\260*S/\263\353O\351\327\006W\237\n>V\025\236"
+	.ascii	"\030\202\201i\205\225\310t\256\255\332\266\020\024\376Z\225-"
+	.ascii	"fhy%"
+	.string	"\264\301_\021\275\b\021'\\0\001\b4@\367\222\226~JAa/DO)D\360\2476\205\350\261\304\020I\033\326Vea\205\341\327\364k\207\021`W`\321\2672\365\210G\377wH\035\034,-\316\356\340\f\245F#\013\347)Sv\307\256\r\316t\261\243&\366\335Q\347d\303\316\025\2566\372\337\205\245-\204\344\324\326\274\220\242\227t\034\351sdR\366\305\006\f\013\265\"\267\345\nJ\217\257\344\013\260/\235E\243k\211\225':\307\024\225\247(\234\377\213<\332\256\t\025\343\336\233\b\350\315\035-f8\337\0044\273$\273$\273%^:\271\032N\262\224|\267\344aZ\304\271\223\006\347]\f\232\317\025158\357\214\017S\206\215\313\207\024\375\357\220h7\346f\"\304\306\021=\204\212\030\231\022\234\205\216\314 \302\303K\253\331\315y\335A\026\021\022\204\213\2363;\"E\352\200\3451\202\363/r\327\245\343\230"
+	.string	"7\025d\210\016\202fa\331\262\"\3048\364\246\025d*\210\031\346\274\"\207J\013\020\235\330\016\214\2339[\270\266\362X\034=~\266\220\272\215,\216\221\037[Bu\254\214hZgBerb9|\350\272\240\351\323\225f\327COm\254U\245\017\013\036\2721'\2158p\304d\351\26446kq\216\272)PI\312\350"
+	.string	"3\306(e\227Ck\261!\311x\341\274\273\332]\355p\334\013\264\3666n\2506Sh\332T\334\216\306w8v7\254\304\340\300\354n\354l\350(sr6w\203\214qq\265\253q\306\335\2528\032kL\340\332\311\330\311\330U\235\350i7eG\365]Uy\334l\324p\336\315(\341X\261\361\002\354\306\211-\301\022b\005\003\306.F\352\264\003\212q\250\004\345\022\323F\003\232(\205\342(\310aL:\244\212j\033"
+	.string	"3\025"
+	.string	"@pD\"\020\n\266\311\332\003\024"
+	.string	"\nZ\264\246\200D%\316\343\240d\b\r\f\300\b"
+	.string	"d"
+	.ascii	"H\202\002\363\241s\226\306\004\252\2104\025O\307g\225ka.`\255"
+	.ascii	"/\350\313[\022\324\216\2164(\260\256\303\324\327\210\355\373"
+	.ascii	"\346\346\351\314\222\027\300\327\234\004\030:\231p\3438p\207"
+	.ascii	"\004:\357J\354\024\236\"\310\273\032.\272\r\343\333\031y%\257"
+	.ascii	"\227\332\r\212\246@]\362L\362\222\207\241Xl\270|\376\017\214"
+	.ascii	"\263)G\007~\237A!\245\326\033\026\024\f\264\036R\016`\300%8Y"
+	.ascii	"HFj|\213+Cc\203\264\001\252\001E\257\351NM\275\272\225\215\206"
+	.string	"\211N\254\2061\2640e\3044\207\0279\305\262X\303C<.\335\036\033\325\206\361\336\244\b.]\206\203-7\216\252s6Y\3701\201\266\022\327\325\212.\223\330\252\262\001\241\253\260\360\364\354\t\251\264\207\252\026rD\2074\020\b\344\0353\242\030z\316Z\017\332\357TiN|+t&\243]\222\232\302\242\304\035\242\245\233\300l\026\343](\276\272\242\376\025!\272B\034h\343\264\007\342R\210\034\263\221\377#s\345\273\370U\t~\273\213\323p6\030\314\017\032\331w\363a+;\333\200\247\004r~\204zu\255\027}\247\361j8Q\005\224\013\001N\373'\022nv\224\315\263\210h\2525G\242\230\r\337\177RM\366\376\244\001g\270\332\303\220\200\223\352\222\203\202z;\362T\266][\365\275~\224\003\221j\030VZ\017\367\t{\300\213\300\261\210\335\256\032\365\272s\237\312\260\251\f\3159Fm\225\016L8\035m_\320"
+	.string	"i55\234\312\277dg\210.\351\022\034\332E\315(\362\246\340Y\350Q4P~\266\026\325L\267\317\300\300\304\r\232\033\206\005\365\002\037v\224\252\225!\002\336\206\214sAa6\211]@~n\331:U\017\332\376Q\233\343\036X\230\240_\243q\261N\212\021(\260j\312F\254B\206\327\205\337wb\263s2)\357EF\325T\245\rg\311\227H\016m}\021\2227[\267\234\361\2670\210\241\201\330\246\256\363\221\262j\264\032Oy\271vE9\027\035.7\"z\225\306m\351\220\237\237\374\017\"/H\240\213^p&v\265\335\263M\365\302\306\311v~\343`"
+	.string	"\035]f({\315NE\005u:\374\224$\234t\002D\2420p\341@^\240f"
+	.ascii	"(\221\254\247iG\214_K\232z\234gU\373v\234\326U\320m\317*\316"
+	.ascii	"\333\300}\235\025\307\216\201!\f\337f+\242a\223_\304\001}k}S"
+	.ascii	"\2715\316\276\246O\245,\302\3675\013(:\346$\022$\262\2436\030"
+	.ascii	"\326\002\021j\215p5\230\007\323\006f\r\341q\007\276dB\242r\022"
+	.ascii	"\232c\032D\002\377\326\2720\275\177\377n\006\261z\313\220\r\334"
+	.ascii	"X\003\0355.\264\366Lx\337\226\331H\273\025-<c\215'\336+&\242"
+	.ascii	"|0\363\262\245O6\255n\230\320\204\205\243\356\233v3\033x\341"
+	.ascii	"\374+\251\341J\303\025q\030\272Nh\0203n\203l\225n\255\001\276"
+	.ascii	"\020\317f\206\221\213\351\355}\367\305\0332\003\327\335\352\337"
+	.ascii	"/dr\325iR\341\004l\2403\333P\034k\271\207\205VRV{\311\326`\374"
+	.ascii	"\352\t\0356u\274\230-)\323*\013\233<\200#\342\310\034\221\030"
+	.ascii	"\230\374w~\342\f\227M`\354c,\337\034\320c\033#\357\032P\274\224"
+	.ascii	"\321}\340\275\002\230r\b|\256\033#\204D\033\207\034\003\312)"
+	.ascii	"/w\227D\033\221p@~\322i\373j?F.\225\3459x\232xe\027\026Sp\345"
+	.ascii	" \030\267\232\0341#\272\370h\267\r5\332nO#\00716\237%\b\334\305"
+	.ascii	"\233+\321\301\260\276\336C>\"\274x\001!\\\326\320\360AuX\322"
+	.ascii	"\273\037\244\\\026\263\254\345+\f -Mp0\267\327A\"\250y\200_\002"
+	.ascii	"\023\204\247\212\201\347\230\207\237\332\321\324eZ\215\231\365"
+	.ascii	"\275NP/\032\034d\016\376\237\206\266\206'\336d\323\314J\004\177"
+	.ascii	"bYi-\323\037W6\026\032\211:\020\200\231\3370\212\264V\312\025"
+	.ascii	"\360\005'\342\372\310p\376\310v\027\306\244\301\310"
+	.string	"f oI\336e\243t\346\214\230\254\t\212?\221Pza\336\304\214L\004\t+\222ak\376Cdzf\264?\236dsI>_\016\b\265*\032\336\220}Q\220\221\263\341@\321o\337\261t;\224\213\033^\3671\352\004I\375\2108E\257\306\345\253~\002I\313\263\242iC\030;\232\262\265{\b\377\331t\327^\273\306z\356Y\027>}\320M\006z\373\177\234-\206?,\t\244p\245\032\302\324\220I\2614\345I.A-\013\235!\310?9&\004\231\363\204i\344\214o\216V\235\301\371|\222\005\007\315\233\n\351m\264\2270\246\314J\346\267uiG7\211\247\223\301\275\306\370D\314\023\317\033\237\362\211\373\232\277\342OJQ\341`}\026\3346X{\211\2526\004\24364\021L\242\346\\W\234\373H\250\034\337\204\260\235\244\223\244O\025\314p\f\177\360B\1775I\220\330\253\026\335-\342\372\337\240\256\253Z\237\364"
+	.string	"\213\200l\314W\362#\036\016\024=7em\312\227d\005\217za\200\320\237X\276\023\2152\254\rk4\321\276z\275\334\f\fq\340g\025o\003\004\324t\323\343+\317\376\224A\036kU\266\316\332$l\240\224\273\331\025^b|\3760\374\234\3526\3570\222r \225~%Eg\025C\030\256\001a-\233\342\244\254\221)\267nu\323\271\333\022\204R\r9\241\336\342!\354*\377D\223\232\263\344\030\220\353\324\372"
+	.string	"\350\216\300i\371\016\351\371\241/\222"
+	.string	"F\243\20307\216\317\326\356\260\r\330z'\367\240\231@\364Dl1F\244\341\264\264\233\031?x\03733Q\202]\270\236\337\002\357a\227\200\266\203\002g\304\016;\310\300\204\331\223\332P\232E\377^\335H_\024\031\354\246P\210\373s\354\233\n\204\277\201\356b\016\272\0335\376\006\370s\024\251o\372\013\324\270E\247\311=\357\323"
+	.string	"\025\277\351\264\021X\362&\237\3006\257!\212\330\030E\030d\024\023R"
+	.ascii	"'\216\023S\260\206N_\314\221.\226\202\0365R\220\031J\300\223"
+	.ascii	"\213\264:p\b\004\227KsK\241\013~\2015]\217\375\231\025'\273\370"
+	.ascii	"\331\204\300\376\373&\370\357\3311$$\225\034:\232=M$\205\320"
+	.ascii	"\031\377 \264\211{\0349\304\245\023\3023\373\326D<D.fa\351\226"
+	.ascii	"\325\311\336\271\346\236\246\263@\3261S\245\345.\205\177\315"
+	.ascii	"N0\215;\213\361\2030\004\214\030\304\256X\n\325\3515\277\224"
+	.ascii	"\263^\324\001W\303\273\377\332v\020\033\022\034\330\362\214)"
+	.ascii	"\314\342\355\215\337=\317Q\261~\321\311\326\255\265\323\211\217"
+	.ascii	"\2629!\321\341\3663\234\311\244\022>\013\370\337\311\341\345"
+	.ascii	"\250\237\337\241\030\202,\004\331\232\216\347\262\024\351\201"
+	.ascii	"\362Ep<1_\201\311k\334?\244\251\262\031\n\206<c\361\321\352\352"
+	.ascii	"\352\3057\027\372\356)\345cm\366\345\325\207\316g\002\256\267"
+	.ascii	"\033\334c~\2541\200N \002h\207<\237\323\211 _O\312\026\211\274"
+	.ascii	"\256\355BrJ\210\236\212\301\203\235\363\316\037\2315U\206v\\"
+	.ascii	"Z5K\232\353\255\032\306\001x\374\305H\004\\\314\240\022E!\237"
+	.ascii	"-X\351\332\243F\t\347\0201\027*\204\306\203\256\2648\f\0057\347"
+	.ascii	"7\237\202\036F\226\036P,`\2205\301y\342\017f\316\021\021\340"
+	.ascii	"p\324\347-\0343\265\343\321\243\034\263\316:\027#x4L\301\350"
+	.ascii	"\017\303I\206\357\271\233\213\364\230\347w\017\330\203\\YY\212"
+	.ascii	".K\212\237,A\311\331|RW\323c].k;[\2537\212o\231ns\025MG\236\272"
+	.ascii	"\351\357\306\361\037\261\230\017Y\315\020\350\003\220A\r)_}#"
+	.ascii	"I\251\217\235p\007wf;t\207\345\251\313\357:F\306\351,<\267\017"
+	.ascii	"8\256=dp\214\250;%@'>\344n\306E\220\255\017\357\2175\024\226"
+	.ascii	"\263sr\034\234\375Z\027\232\370GKM\036\220[\264J).\247\331Uf"
+	.ascii	"\335\245\225\3319,\302c\036\267\2641\211\254\221T\227\316\342"
+	.ascii	"\341\357kInU\221z\2628\231\f\243<{j?\311e\334Pi\340\275\034\344"
+	.ascii	"\221\017<\005\347)H\367:2\0360i\b\247\325\2379\267\304zua\205"
+	.ascii	"\266\343\031,\231q\310]\276 \356_KV6\"\f\212\364\366I\021\b+"
+	.ascii	"\266\3651\237>\036\rf\272P\b\032\212\247U"
+	.string	"\nx.\3124\b\026\017\360v\2042=A\263\340\n\330\347\260\264\233\247j6\325\031\333\211\026\314s\031M\250{_\bZ\305\n\220Wu\226\200\277Nk\236q+\006C\300V\302\371\373\322\241\022tQ\201\353o\222\316\206k(\345]%\224ac\004\272${zR\331\034DP\362H\354\005\336^\261\263\265\"ov\214l\023vT\020\221\267\254\224\214\321L1Q\3404\tfY\2551\343\f\365\235usI\253*\272\302\217\360\2430!(\021\f\336\342\275>0\200\r\"`e\213fU\200\016:\302\362\272Pd\326\b\314I\247\332\375\340y\331\244\332\r\"\272\251\354+@\311\272\257\316\203\216X>\347L\201\320\322\f\222cs\316#\003\347hf\311q\"\305*6]J\234P\030f\362k\320f\303#si\274\260U\344\253\342Y\177\323\277\203c\037$\344\013\217\2011\267/\255\212\2374\002C>\032\251\226\024"
+	.string	"\033\007\321\266\023\225\351E\363\211\302\240*\022"
+	.string	"\333\016O\3642\323\\1W%\355\027\312K\202\306\021lX\233\255\324'\037\333\002\371\261\326"
+	.string	"q\324s\013\334\016\372C\210\tPm\210\005C\306\225\022\350@\224\265\226\tV\252\355D\227\331\212K\223\322D\024\250\0209\343\020[L\373\371%\351r\354\260\372\340\335\r\260W\244&\243\247\340\027\325^OvR\347\201u"
+	.ascii	"g\263\340\354\325\236 $R\214t\\\027\\\354\350\301\212\262\315"
+	.ascii	":`\225\357\035\226UA\315\311i\332A\376\263\340"
+	.string	"\334\017q\241\371\263V@\336q\2525l\272\234\266\376Y\334\033\tp\366N)!\f<\212\022{\003\232\324\037-\0132xh]&\300\224\267^?\314\323\253\251\217\263\030\304\332\350\245\177BW\215xc\340\222\227^\267\257\216\251\244\360\263O\312\265l\306\250\302fX_0;\307\240\213ALc]\200\016M\f\264\003GP\201b\360\320\024\177 \263\315FqZ\233;\324\024\005Dr\207;d\r\304G\264\226jut\017!\237\240p\300\252\336J;\346(e\212qWb\366y2\276\307\357\203\243\\c\355\216|U\230\021\t]\374\266\346\236Y;B\006\345%\201\t\342i\207\276\327\236\003\236\0316\355\215\261\240\325v\b\274\006\037O\205T\324\225yT\005\227\243\333\031&t\362\204\033\273:\207\277h\311\361<Rq\272\243\342\255\340\207\200\275*\357'&\240d\007\342\352MT\213\245\003\321\316\007\372\2372U\216"
+	.ascii	"\256\345G]\234\261\340\360{\024\330\370]\024\232\032\332\021"
+	.ascii	"y\317"
+	.string	"\215\221|\016\345A\300\006~\233\243\256`H\260\371\202\302r\347\361\0020\350\316Dh\345\353\017\355\024\331I\265:\030C\235\303-\023\211\017\255\024W\201O\231F\3174s\223E\215\327o\352\242QC'|\222\"l\013\274\262\255@\026M]\345\220\377pe\325\"\225Y\307,\244\345<+J\202\177\241+\344\300g\247\206-\b\232B\202\033\263\033\312\317\260T\2138u\301I\006\301\024*I\316/\024\262sowT\032N\366H\347\223\220\024\364\214\3457\314e\333a6\203\003\224\317\271\3617\217\327\203[$\004\327Q\222+\224(\364r\347B,-\300ny\207\210\027|;6\364&\021\002\250\013\373\034\351\331@\225\3305\006\334\203X*"
+	.string	"\205\200r\276dB\200\213:\brh\023\245\256|\343)\026 \270:>\303>\037\361_\376\333\r4hxy\370\333\003\336t\302+\213\222\031\245\242\262@\\L6L\223~{\206_\362\375u\366*"
+	.string	"\333\f4\371g\332\356\304\337\"\216\351\305T\276\265\001\"\254TT^W4>\005\327\236\364\251\360\202?\336\273{*\207B3\331\343\267\203m\024\202r\275\310\374\365\337\213\2104a\336b\224\177\234\352!pk<7\201O\205\356G\0042\313\223\306\367a\021j\003\370\325\236\002\020\211\f\254\367-\214}\240\323\333,P\360\340(\205\005\021\335\260OC\237dA\374\344<\024S\217y3\032\242\005\nU\332*\026\"\007>\240,\362\266\352\277\325:\313D\256\304~atr\307\320e\265h\304\341\3568QBhsZ\326\316\232+\236\262\333\310\004_\372\232a\341v\240\324\306\2759q\320\355\017\177\317R\372(\001\017[f\246.\214v\266\243\277\331z^\215\212\201M\252\004\272\304\363;\270\203.\217y\204\305\304d\221yv\307\246\323\253\262\214T\234\027\357\356/\371)Eq\374\233\272\371\245w\354V\373I\220"
+	.string	"\216\bQJ|\241\333\311\231%\243\277\322\241\004\313H\332\274R\023/>\276\206\234\210\250H\365\020\333v\b\354B\305Fn\270\226M\346\030JGV\275\211\251\3703X\240\345$\021/\316\224\034\372\"\231N\200A\002\273b\316\217\202\350N\224M*E\222i\020\302C\332j\261B\340\305%\327J[\367\321\370C\340\367"
+	.string	"\234\007\376\270f\320\276D}\330\357\233\311\334Fk\3248|\201\316\3643Y\036D\3548G\035\007\317\211(f\271A\277\r\013\323_\244,\213\235N\030\\\340N\375\371\354q|\006W-\362\233\021\341\216a\216\257\225d\241\350!\270\035ILl\267\271\275\261\317\303|x\264\341wa'\256=\312\232T\377\214\213\227\030\351\321\367oo\371\377\030<Wr\207C\304{\nJ#\334Y\032R\026F'\201\027o'Z\234'\267@\317\333h\2560\317\251A2%\246\263Q\306`g\263c\021\034\252h2%\262#\353\242k\202=\312%\2622'\316\351\276\r\337\365\224\264\3403\345\323\325\177\266\257\263\343\242\310@\235\206\022\201\234\tA\\\306*|/\251\tu3\243\223A\0306\002\251\343q\307\020U\027+*\t4\326\221\021K\n\007"
+	.string	"Z\361T7\325\b\321\250\314\343I}\005!.v|z~C"
+	.ascii	"\345\2017H\241z\237\216\321\217\316[P\267\f\216pH1\263\037m\245"
+	.ascii	"GM\307\344\347\032H\272\301o\274U\260\342:\025\350\241\342W\360"
+	.ascii	"\357\365\320\324\342\036\"E\371\2252eTFM\236\241z\n\201\024~"
+	.ascii	"\226\331\246\367Ug\267\365\246i\227\215p\231Q\272\344\300\203"
+	.ascii	"N\307\344\357\374 >\251\235wU\314\231\332,\225e\347\251d\245"
+	.ascii	"\243&\277\204IM\234\034\300\267\3557\236r\372\005\365\311Z\215"
+	.ascii	"\350\235c\247&6j\373\350\266\205C\236E\367-A\262\376\237,\201"
+	.ascii	"#\3101\240U1B\230R_\216}\304\030\317\255{\2422e5\362 +S\204\t"
+	.ascii	"\204$\263\240\376\3554DX\256U\207\373,\027\252\365\203\351\344"
+	.ascii	"\245\353p\326\037\006\336c\007e\265\331\217\237;\244a\201=9*"
+	.ascii	"m\335vg\371\335\227W\300_\007\f\323\030\302\301\213\005Zs\221"
+	.ascii	"\005\332G\301\373\335\203\241\033l7\342c\b\357\337Y\257\366W"
+	.ascii	"\311G*H\027AC*\0306\013\265\330\\!&\351\204#\204\203#\013c\325"
+	.ascii	"\371\254\017!\t\250\241\333Xd\303S\307\311\257\244\\\020\r\221"
+	.ascii	")\265\371B\306R{\022\242\024\213\r\347Z\334\263\025)n\320\332"
+	.ascii	"\333\335d@\004B-\317\246\303!\006r\207v\214\0360\004(\212\217"
+	.ascii	"\257\264\332\336\231\220\240\026\351\335\242\267\302\324.\243"
+	.ascii	"\257\034N\222\205\205\274\023\347\360\204\232\356\221\235\331"
+	.ascii	"fT\035\305\263\364 o\017\254\301{A\363\364\006&\030\346\205\224"
+	.ascii	"\231\242\207U\212\027\347\271A4%\250\364Abh\030A0\377\337\025"
+	.ascii	" G\3054\035\330\361\324\200\257+\206\353u\206\263\264^\360\312"
+	.ascii	"\215\314\017=\276\277fq\2420\252U\023\356,\016\r\037\373v\026"
+	.ascii	"xl\3436u\241n\255U\351\346\bM\204\n\250\315\236\177\333Y\234"
+	.ascii	"\007\261\276\375>F\236\200D\311\264\341\2446f\"D\300\r#V\277"
+	.ascii	"\320\364O\206[-%\242jp\226\374\0205\316\221\037\230\357W\312"
+	.ascii	"\330\3027l\035\313\026)t[\312C\"\300\276\325\177I\255V/\221X"
+	.ascii	"gF0l\t9l\035\266\252\301\314\202$\f\310\004j\3579\264\213\377"
+	.ascii	"\362\n\351\306\307\037\003\317"
+	.string	"b\341\307{\0167\301\304D\255tv\032\331\220M\212\354(7\201\030\240\327\236\334'z?\311\376\271\212\220\023\257W(=\245L?:\327\363\333Z\257~\202\351\260\246|\233\242\207\361\276\356\343\004\2505\317\357\363i\022\"K%\210\354;\3506\257z\336n\\9\235\367\305\370\322\3646H\304\b{VU\005\212P\361N\254\034\230\255U\366\327H\244\375/\350B\262\017s=S6\207_<M\204\211\266\247[I\031\317\375c<\247\372h\364\305\003P>[\\)\250\221\340)5\243\352p\262X\221\027\212.)+\326\237H\r!\255j\260\020\202\336\212\327\226\261\220~\204\225\302\255Q\256\247\244\3111\335qV6\376\021\244\2026\323n\244\334\250.\230;\302\253\334\247\003B\274\242\216\250\\\337!R\334\252\b\t`^F^\026\317\200\021\326\030\204\035\216=\374\334\322\001\025\316<\331\346\233\332t\3045\036\365m\037"
+	.string	"\250\211c\037w\323Y\244?F\244\300\355\306\237\226\003B}V\027\301\006\276\226\r\300"
+	.string	"j\301I\026\001\241\335\265\004\375\267'\337\361\241:\213O\261SR\"\005\352,\363\036\203~\300\325\023\313\351a\271P6\377\\`b\237\355\2054h\303&\210\303\221e\301\016\273KT\203'\304\372\232\264b(\307\0064\316\330B\330\"\222R\004\270\277\364\343Z!\300\351:~\033O\006`\264\001}\213g\234\373\2022\331r;xh\203\337_@\023huIPs\362\005R\3468\234{/\2106?`\022t8,\246\206\rM\374\227\016\211\032\013\325\340\003T\006v\221\"\366\013tX<\337\034yYZ\266\257v\311\006rS+m\r\324\200\342\234\035\374G\307\036PN\305tS\003\377\034\2709\321\002\361\323x\324[H.\f\273\222\206\211X\222Q\202[C\364\317\027BN\"\337l\225\214\272]\336T\377$K!\003\254mS\304\021"
+	.ascii	"\375\360\235\256\322\226\346/p\320\334s\233/\254\342\005'\327"
+	.ascii	"\202\366\325\206K\352\030 \255"
+	.string	"\264\363\365a\202\350}\342X/5Qg\007U\030\263|\212\376\222(T\026\212\217\236\225I\257#\020\225W\227e\376\210\027\275x/\223\021*S\277\361\217\374=\327\310\203&\337\336\375D\357\326\241\3240\3058\224Wh}\316\336y\230\201\020\211\202^\020\200\224\020? \"&QsD\255\302\013<\360](\320z3\360W\273\300e%Y\26690\244\352\351?\253\217@\276\304\206\363}\017\250n\351\350\250\342\034\021\033o\305*D\327{x<?\3629\204\t\t\332/\346\237\203\312\366d\236E\277\333\300\021\201\345\362\366q\031{\017\327\361\3256\027\266\276PqWj\023GX\347\347\366\237\256\272\251\350\360\275\235\356\356\374\324iI\365D\336\023x\334\206\361\222\334\006\300\016\252\366\021\200\371\270;\350sA\371;\366\303_\267&\350F\253\374"
+	.string	"\214W\r\313\305\354\302sNAWZ\376\353ks\326\017^=\374\327e\313\353Bo\2379\233\370T\3453\352\261\341\245\037\200e\215kyO6\367\335\362\232\226|\221\333\275\370\266\352:\201i]Dt\376\247\251!\020\r\335\3058\177\034H\373U\001\316\313\317\3307m~\203_u\226=\363{Wb\177\024\341\367\003\223\232\317\t\373\217\003\347\207\332U\362\261|,\314\256\256\206\267Y\327x\207\321_\320\016m\251e\270\375,\2703I\323M\250\352\034z\316\203~\276\246\337\261\346B\004\235\241\310hd\3538\b\303r\264\201\034\263"
+	.ascii	"\336>\337<[\306\247Y\273\367\332)\357G\341\300\0216\036\245\366"
+	.ascii	"7\361\254\202\267\215\322\220\357\226-\273\370{\3351\005~\035"
+	.ascii	"\317\t9\317\300t z\277Y\275\233\363\353w\226\215\377\271\205"
+	.ascii	"\257c\237r\303\375I\213\334\3733q\215\221_F.\261\2358z\247\367"
+	.ascii	"\301)\303k\372\360\224\237i\302w\364&\017\337-\037\375\232<H"
+	.ascii	"\360\355\310\237y_\220H#\335\271\234\005\2613t\356\327\022E#"
+	.ascii	"\275\037\355k0Q\327\3448\277\221\352\026k\247\177"
+	.text
+	.section	.gnu.lto_.symtab.61b376037f100423,"e",@progbits
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\004"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"resetConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\004"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"validateAndActivateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"writeUnmodifiedConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\004"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"isSystemConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"pgResetTemplate_pilotConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"pilotConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\004"
+	.string	""
+	.string	"pilotConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\004"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\004"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"osdConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"osdTimerDefault"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\004"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\005"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\005"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\005"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\005"
+	.string	""
+	.string	"featureDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\005"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\005"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\005"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\005"
+	.string	""
+	.string	"featureIsConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\005"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\005"
+	.string	""
+	.string	"featureEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\005"
+	.string	""
+	.string	"buildAlignmentFromStandardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\005"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\005"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\005"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\005"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\005"
+	.string	""
+	.string	"featureInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\005"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\005"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\005"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\005"
+	.string	""
+	.string	"isEEPROMStructureValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\005"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\005"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\005"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.61b376037f100423,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
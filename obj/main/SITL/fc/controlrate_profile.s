@@ -0,0 +1,521 @@
+	.file	"controlrate_profile.c"
+	.section	.gnu.lto_.profile.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 a\245\002"
+	.string	"d\004U"
+	.string	"\n"
+	.string	"\206\214\261\346\016"
+	.string	"\001\337\351\353\255\n\002\363\341\340\230\f"
+	.string	"\003\240\342\234\212\n\004\235\205\271\212\n\004\002"
+	.string	"\002\001\002\002\002\002\006\007\200\242\234\020\006\b\273\305\341\276\004"
+	.string	"\t\315\326\216h\n\240\342\234\212\n"
+	.string	"\004"
+	.ascii	";\023\334le8E\331@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 ]\325\001"
+	.string	"D\002Q"
+	.string	"\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\002\001\001\004"
+	.string	"\001\007\001"
+	.string	"\001\b\002\001\002\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\b"
+	.ascii	"6\303\250\212\364\313% #\317\r)V\333,h\003X"
+	.text
+	.section	.gnu.lto_.inline.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\205\005"
+	.string	"\362\311\035$\2207\351\177\365;~\306n=p\273\273\022\035\224\025y\257\270\215\335\317\306\363\356\356\024l,Rkd\023\271S\377P?TWs417|Pv\367QA*\347\366\317\334\243`\352\r\331\035\024\254\341~R\023\231\tx\201\260\177\021\033\037\221\231\323\367\177\365\256\037aE2s\271\177\377P\353\317\301\377^\250\231\231\312Kk\"a(\230\376\025\326\242r4\232g_ \027"
+	.string	"\251\020S\210\001\002i\325d\314u\2002\200\005\346\272\231\250O\205k\ty\223\b\254\004D\260K\r\002W\205\327u\005\214\246\","
+	.ascii	"\354\n\301\263\2412N\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 \260\335\002"
+	.string	"\262\204\016\027\300\245\320\001?X\275\351\037\374\364\365\377\203^,\246\221M\366\226)\005Z?"
+	.string	"\207\320\231\360d%\253\300o\026\305\026h\265Ao\320V@\023\255\315\341s\2544\254\344\035\034\004\f"
+	.string	"BH"
+	.ascii	"\366\240\260!\326\345\241e\254b\2029@\201%\205b\227O\021\222"
+	.ascii	"Y\360\006\332"
+	.text
+	.section	.gnu.lto_.pureconst.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\230\004\004\230\004\007\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 sM\002"
+	.string	"\324\002_"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\005"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002\002\004\001\002\b\001\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\007\002\b\0071cO313"
+	.string	"\013"
+	.ascii	"\270\001\020\256\347\306O{s.J1\222i\257f\0164\013\007\243\f\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.lto.6de3b69b273b5c82,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.24.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 \252\335\004"
+	.string	"\244\bl"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\254\250\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\314\030us\326\007uq"
+	.string	"\005\001\006'\001\314\035\001\006\214\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\005"
+	.ascii	"0e(\025<\314\242S\024y\003(\002"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.25.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`\205\001\375\017"
+	.string	"\266\237nF\360\260(\035\272,\\\356u\313lC\025V\362@\220\210\261\216\373\227\\\236\235\260\245\365#\326\022T\376\025\303\325/\342\374\373\322\017;\353\332O\306a\3620\356\344@\025\023\314:\270;h\332\\\265\251\366\223\275\345N)Y"
+	.string	"W"
+	.string	"\\"
+	.string	"\237\006/\332>?\037\260}ze\327 `\022\300\346\004\006\307\356r:\302\333%x\313\270\372\224\032W\276\313\343\027\023\326h>\326\247\004\245\274x\021\360\231\310\0064b.\237=\242|\255(YT\256\237]\024k\325h>\225G\217\203\335u|})\367v\333$\266#\330\227\0053\0378l\260\302l\320e\277\347\341-\037\255\032\0355\372"
+	.ascii	"\264"
+	.string	"\303\211\214H\306\256\207\035\035;c\3020\021\343C\3730\007\375\231C\237\366\313Y\254\036\232&\267EH\313M\316\356~|\032\302\347\323\200|\310\366\243\375\226\257X]\226\341\036\2730\235\232]p\201\031|\002O@\253\271B|\342c\376\230\273H\025\270Ab\327\365\227?s\032\013\362%>\215!\265\375\365\351\247\266OU\233\344B\374\313&\232\b\227\262\034\325\243\252\n\202\346Jq\340\216\261]\243\336u\242\025w,\365z\230K\0247\261\260&\263\243$\356\250\252\300\261\221Cu\305\006YQa\001\247S8\231P\335\203\222j$\301\303$\220\222\310\311\324y#\023J\252\221'\322y*TG\342H&\016u\032U\340H^\212\003A\340n\244\344q\252\256\363\270\020\270W\230\357\362\020\226\032\235\234\022mM]\261\307FA\2528\361\343RQl\3236\251\227\2058\032b\216\313\335]i\005\227\n\322\317\002\032"
+	.string	"\2423\341L\213\201\032\3224xL[v\277,\201\025\022\263z8\301\342f\332\203i\223k\206\020\342\260\025\005\212\313Ah?Uk"
+	.string	"\021\253\3566\253V"
+	.ascii	"aqCD\331KW\215\007\024\021\3235\237"
+	.text
+	.section	.gnu.lto_loadControlRateProfile.26.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\r\013"
+	.string	"\366SJA0\247*\035\005\217\377-\267oNs\250A\017\277\346\262\233wb\352\213\243\331\215\327RZ\303\351\nH\370\324+\301\332\222\201\305\272c\b\001&\035\350(V\243\030\013\r\233\001\0170\201\301\310&{\247\0242"
+	.string	"5"
+	.string	">"
+	.string	"\256\244d\335\253=\262\273\327w&\331\n^\256\366.\324\351\345`w=:r\322'\311\177\353\2251\305\361\231@\261\273\236c\312\343\246\267\315`\333\302\376D\376\204\346\307W?\304\275\236B\204\310\036\220\245Y\263K\323\244\"\366\267\245*{\233\336\350\364\234\323\347\270\022\004\013\260]T\r\302\322\352\001\022\333\367SN\216\216\022_\353\016\fd\256\004\261\006\344a\242j`5n\234"
+	.string	"X\027\254vWb\300_\030\031\215\206{\335\350\311?\200"
+	.string	"\230\235\304>N'\335f\247\b\346\\@\250\260\333\021\341\227\017\240\341\263^\003\316\370,\340&\203\tE\317\005\b\272\210\233P\004u\302\317\3730^'s\341x\237\370\361,\r\016=\240\350\201\302P\364\272\262\364m\251\312\025&\264\0225y\243~\201\307D>\313\227/\025"
+	.ascii	"\020)\2022\253\t\274\030n5\370E\330:J\210\005l\\\232\to3\020"
+	.ascii	"\030\330\020rye<\244j\320\205<\004c%(\333NY\276\264\013\316\271"
+	.ascii	"\2050\237"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.27.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`\264\001\005\020"
+	.string	"\206\335iG\360\260(\035\362$\310_?\201\335\f\323\3078\250\256X%\275\245\250\263)\266\341\357\321\227'\r\n\354\375\326\352i\305\271V\"cg\2721f\372<Lp\246\305-l\f\n\006\002\362\233\352\216\032\372S\333\310&[\246\024P"
+	.string	"S"
+	.string	"Y"
+	.string	"\240\317\203l\253\332\013\032\250\036\223\262\334\025Q\263\331\215)0\203\317\247Uv\215\307^\366\343\212J\212\235\335\365\344\210\253\316IU\371\236\020\017\361\265:\007\3422\300\313\305\035\330\335\313\\9\274Z\252\236\220\335\265\212\257\017\367\274\355\b\266A\373:\001\023"
+	.ascii	"K\355\306\nKo\272\273+)]\346S\235J\002\035r\2143\\\212\303\216"
+	.ascii	"\265T\272\330\347V\266\330\235\372\243j\317Ts\217\371\365\243"
+	.ascii	"\213A\243@\316\256\207\233\216\265\315\033\022\266\357\237\370"
+	.ascii	"\230r\024\366x\321\036\273\314F\371\214)\2740\261\273(v\212\035"
+	.ascii	"\363\262'\260A\033qf:\343mN\263v\321\364\232h\346<\250y\213\321"
+	.ascii	"72\322}~\344\307O\030\316\016\254\304,\004'=\222\253Q\331q\231"
+	.ascii	"I\316\202\364\331u\3158y\3319\030\013\355\306\fKo\234J\233\344"
+	.ascii	"+R\006^v\327\201Os\025&>\314\247\301\023\275x\322=\326\260\341"
+	.ascii	"\313P\2220\341C\211*\f\360\b\344+!\211\200\241)\364\241Da\t\030"
+	.ascii	"\242J\340\310\033\211x%\222\310\304\033\205'\017\004\201A\323"
+	.ascii	"\027z(\020\f=P\214une\213!\310\260\261d\313\002\324\266pA/\372"
+	.ascii	"2\377\240\201ak\311\225?\322\277\271\213\223\017c\f!\275\030"
+	.ascii	"\352\036$ P\202a\314\314\003\200\211\316`-\312\2042\323\331\030"
+	.ascii	"6\263\262\322\324u\227\311\2131\262e`\257u\221c\234\320\\\317"
+	.ascii	"x\254\271[VX\252(x\027\"\356\320H\343\343pk\301\302h4\246\203"
+	.ascii	"\333\246\261P\255D\r\337\356\224\243\362s\200\355\035\227\302"
+	.ascii	"\032\333\025\312"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.28.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`0\001=\r"
+	.string	"\206\030XB"
+	.string	"\2216\035[X\222[\317w\256\276g\r\342\333\030\320#\326\243\356\005M;b\003\275"
+	.string	"9\260\255y\007G\212&\004\217\005\215-)\273k\326:\305(\3752\230r\\w\006\211YA\262\330\233l)S\nD"
+	.string	"A"
+	.string	"C"
+	.string	"v\214\223H\354ULt+d\354\256\245#\376\371\0045?>\225\301\210<\320\247\215\017\207\260\203\245\324\025\030\211p\251\274\221T"
+	.string	"\036\t\354\330\335\247<5x\\&\225\331]\247\310\363p\307\333\216`\233\202\375M>\\\035\331\231\306\034\345\247~\362\307LCM\253\246S\323\257 \n\026\004Vv9|4\2664\2718a\373\225\215\342y\200\345ZJ8\310\264\021(\370\374\304c\335\r\301\322bW\305\001'\330\370\344O\n2\245P\251\250\030uv5B\371\371\245\303\367\002R\032u\300\206\226\334]\220\252\211\355\fQu\202\n\214\221\234\341\324\253\352\264\322\2018\351\224\246\nx\231\356\211Q\257/)\371\272\024\\~6\211K5q\227\326\341\300\200m8\r\036`\233\006\302\202\255\263\341\360\345\201\205\200|d\232\210\004l\323h!\231\266q\262\313\272>,\016\210\246\202ui\035\313\303\2003\021L\263\266,\323\254\212\024:\\\035\231\201K)\244\334\024\023\332\302\205\274\310Oy\206$\034"
+	.ascii	">\353\341\211\265\365\0348\023\272\223bT\030*\365{\271\320CP"
+	.ascii	"\213\275\210\007\267\200\264\240\r@!>\302\004\223\031\316\232"
+	.ascii	"\203\271\206\033\314\002,\302\030\2400\030\246\317\300\301]\002"
+	.ascii	"\006\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto__reset_template_45.0.30.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 \250\235\004"
+	.string	"\"\b\037*pe\322\030\200V\325\027GP\207\b\206\252\252X\264\220\003\020\b\004\002\201\n\300U\025p\257\237By\361l_\\Z\252\275\223\f\327u=U}\226e=U\247o\022s\024{\026\177\030\317\306 \307\241\307\"\310\243\310$\311s\362\244\\\252X\016\300\264\2542\034a\200\222\357\305\355\244N\252"
+	.string	"\307\355\316\033\342\355\200)`ZV\275n\002|\005\246%|?\3027\343\234|u\240\252\232\b"
+	.string	" D\352,\tva6\004\302\236\272,\241l\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_copyControlRateProfile.part.0.36.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`?\0025\021"
+	.string	"\006\337nH\320\322(\035J\250\201\201"
+	.string	"\242c!\306\234\024\241i"
+	.string	"\357@\331\314@E\264\317*uTv\034\236\334&\270\354\255\367\274\370I\031J\235\006\243_\301 k\337*c\253\324\373\340\307?\220\352\005 +v/,$\233\310\235RS"
+	.string	"^"
+	.string	"Y"
+	.string	"5&)\275N\343\372\270.5\253\264IJ\260\323\270\254\273'~zvo\032|\272d\364i\177\306\366\253f\230\335\343\243m\177[1\303\311\355\356\367\251(\016\273\312\016\346\377v\020\332K\354\032\340\005\304e\310;"
+	.ascii	"&\273\353Q\210{\336v\311\266\007[\262\004\322\3626\377A\b|&v"
+	.ascii	"]\212\210\026f\372\260\220\265\235\227Y&\262\016\033\272\035"
+	.ascii	"\022B2r\253ad`\333\3279\215\226Y\bF\333\207\020\242\242\231\213"
+	.ascii	"\334\356\370}z\374\001\357s\364\002\236\2173`;\316sZ\277qI\f"
+	.ascii	"(\306\356\266\244\177{\331$\222\3158\272>`e;THP\371\307\035\007"
+	.ascii	"\316\026\177\303\206\247\307u:\365\267/\210\001\311\202f\374"
+	.ascii	"\310\271\017k\362\330h\031^Ce\372\260\355\256\003\236\367\200"
+	.ascii	"~\212O\263\254\344i+\357S\3659\237/\202r3#tD\\\245z-J\344\230"
+	.ascii	"\375h\221ERe\254\335\273\325\030{J{*=_\363wSZ5\266p\nW\"\030"
+	.ascii	"P'\252\b\023P\242\211\302\003qu\"\342\323\b*%\205\002\206+\025"
+	.ascii	"P\242)L\001CQ\005\236\276\023\312\247J\231T\276S\270\372F\024"
+	.ascii	"\030\\A\205\237\b\202\341G\262-\337\255\306\030\302\220\216\026"
+	.ascii	"\225\251\312\330\026 \023\334?\236\252\247v\352\202<\315\277"
+	.ascii	"}\304\003\006\314\220\020\007\2159/ p\002\231F\354<$\360\352"
+	.ascii	"aXw\323@\017\t\214\202\221v\244\264\301\221\305\005\231\350\376"
+	.ascii	"\324\202g\336i\227\241yVV\227\031\030\260\037\242>\314\021\216"
+	.ascii	"\226\003\255u\"\307\371\2107\356\361\016n\031\266\f!M\225Yd\276"
+	.ascii	"\032\233KL\354I\212\301\355h\231)2\tu\254\346\360f\336.\013@"
+	.ascii	"{\221r\212\247_\213\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\005\006"
+	.string	"D\t\036\001"
+	.string	""
+	.string	""
+	.string	"\002\031\177\t\210\214\225\311"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\036\006\200\204\001"
+	.string	""
+	.string	"\003\002$\177\n\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\025\013\201"
+	.string	"\002\032\177\f\272\200\037\r\024\016\033\177\017\002\034\177\020\030\021\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\026\022\001\035\177\023\377\037"
+	.string	""
+	.string	"\200\200\200\001 \177\024\003"
+	.string	"\013\372\363\352\266\003\001\204\001\003\002\013\244\001\003\007\344\001\003\b\002\344\377\220\375"
+	.string	"\001\202\006"
+	.string	"\020"
+	.ascii	"D\313D\036\006\345S\004\370LAF0<\277y\f\031\202\260f8\b\240\003"
+	.ascii	"8\274T\340#\f\030\234fT\370'\204*\003"
+	.text
+	.section	.gnu.lto_.refs.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\004"
+	.string	"\002\002\002\003\002"
+	.string	"\002\003\004"
+	.string	"\003\004"
+	.string	"\005\001"
+	.string	"\002\003\003"
+	.string	"\001\006\004"
+	.string	"\004\007\001\005\002"
+	.string	""
+	.string	"\005\003"
+	.string	"\002\003\005"
+	.string	"\001\006\006"
+	.string	"\003\t\002\003\002\n\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6de3b69b273b5c82,"e",@progbits
+	.string	"(\265/\375`c\027]r"
+	.string	":\301`*T@\022\"\245\003\312\254x\036-r"
+	.string	"\213\364\2423\360\2738T\271\305\251hv\202\242\267\037\024\005=\017FU?Ro\366\246\372[q1Q\224D\331\273\202x\250Q\034,\312\21193`\356\316\254\031\355O\303!\031\252\252z\356\r\362\\\362sbk\225\020)S<\002\222\002\253\002\347\f{\322\261g\366\032\373\366b\337d\366,'\016'\203\334j\220c\244Q\366\201\177`2\005\370\355\354\306_\276CT^e\027\241C\205\254\3217\230=+\220;\343\342X\201\034\273!\235\341`\341\"\003\256\321n$\366\315ey\314\3300\033\303\275\241\362\244\321C F\r\332\0269]vx\343\242C\034/jl\276\200YS\206\315p\017\274\306m\234\206\3250\032>\303dx\r\2231\0333\317<\360\230\263\362lF\005\256l\n\235\256'PX\n\320y/V\235.\025\017\250`6\016\303R\230\211\244"
+	.string	"\254\255y\257\362|\366#\2611\016\234\303\b\250{\2114\020@\346J\032\325\333\275\227\001#\006z\210I\206t\214P\276\\\224\023b7{&c\317i\366<\305\n}Y\243,[\202sX\0231\330s\016?Wa4\326\262\302\275\305{\257"
+	.ascii	"9cQ\313\253Q\316\302ig-\214\345\262\226\b\222\367\022YK\020\334"
+	.ascii	"\275\304 f\003\230\r@\301\266\220\234\345\320\277\260l\005\351"
+	.ascii	"|\205(wD*o\320\3116\225eG\243;J6\005\027\345rL\224c\261\202="
+	.ascii	"[\013\373&\027\345X\311Q\230\214\004/\377\200\212\237\303\261"
+	.ascii	"+v\2572\350\247\316\ru\3464z\016\354y\354\005\020\257\212\033"
+	.ascii	"\3313\211\034\3071\211\334\333\376\215\213r?;\3719\214\305H\234"
+	.ascii	"\306\250\3445\273W9\024\244\344!\365\243\321+\271(g\231(G\342"
+	.ascii	"\347o\027~\016\372Y\350g\242\237\215~\376\371\271\350\347\241"
+	.ascii	"\237C\374\034\300\317\"~\006\340g\240\237\007\340\377q~\366\371"
+	.ascii	"?\3647\n?\257\b\362\363\217\353\376\006\376lA\326\210\236b\n"
+	.ascii	"\276\2264\341\377\210\237}\f\177\256\372\371\304\216\377)\234"
+	.ascii	"\347\357\022~\026\376\374\342\347\027~^\177\016\376\254\376\354"
+	.ascii	"\364\363\223\216\237U\370\271\351\347_\216\377B\177\303\371\031"
+	.ascii	"\307\317\307\237c\370\031\306\317\022\374\374\301\317\033\374"
+	.ascii	"\234\301\317\027\374\\\301\317,~^\340\347\243\237\035\370\271"
+	.ascii	"\201\237I\374_\376\\\300\317\004\374_\363_\354\177\321\177\265"
+	.ascii	"\3776...\356\357\004~\224\310?\024#Rlx\177\241d\346\314p\245"
+	.ascii	"\321\366j& \322\260QK[\262\345\203\232+\215Z\261\337\351\262"
+	.ascii	"\215\344\354\002K\243\226e\377>b$7\366\343\314\221F\3177pg\275"
+	.ascii	"\211t\2216r\001\r\343\216\027\230\346=\3528a\245,B\211\301J6"
+	.ascii	"\372\035\033\366\255\325[\357\037\377\321C\254\362\336\340*\311"
+	.ascii	"\036\224\274]$\322D\017\215\036a\350\by\017\371\032\237;bg\206"
+	.ascii	"\030\332\222F\017\247\271v\332\b\251q\344\352 V5\314\220a\325"
+	.ascii	"\023\243\370\306L\243d\r\244\215O\212 IR\305\376\375\347.\361"
+	.ascii	"x\357\305\261\243\274G(\237\363\016\263\211\377\207O>\340?z\317"
+	.ascii	"_\004\007\367\016\247\260\271\331%W\210U/q\277\303\274\267\250"
+	.ascii	"5\274@k\252\250Ee\\j\335a\361\310p\350x\265\206\306\345\275C"
+	.ascii	"\267X\034n\220\274C\306\345\235\2721\306L\361Uj\ro1y\207n\361"
+	.ascii	"\022K\030\213ZS\306%qj\310\270\324\232\272K\255+t\213\304#\215"
+	.ascii	"\342=\016\335\245V\233\273LN\t\031\227\311)\343R\013\311^\214"
+	.ascii	"k\\\246\312\330\266\242\230\007c\361\332\220\262\"\036\205\230"
+	.ascii	"Fe\362\262\335\313f2\356\361\200{\255\222G"
+	.string	"6\"\025c\201b\332\200B#&Yy\357\025!\005\265\225\274E\246\321+y\257\027\324\322\225\212`\250d\336!\314\034\376\260\272Q2\356\035@\352\336!_\346\275wx\357\325\035\255\224\367\322 d\354\222\222\272\027i$u\255\206Yd\334\333fh\260L\031\227[I\244,e\313\256;C9\344\256\313\246u\264\313a\224\033\365\306vM\345p\323\350\321)\253\024\363\271q\243H\322\007V\267\225yii\254\276\002\341\346U\344F\243VF \302\216HQ\243c\017A\317`\353\362Rl\"1M\327\234\277\217=\325:\272G\333h\036\215\243\251zG\323\3209\372FW1Y#\333\370\246\3213\274\233\303\266\262F2\035\216\303L!\027\210\261i6\262\241\232\b\246\246\221\374\206\3450S\b*&\247\371\245c\240\251\303qbn\3464\233\215\354\032-\305L$\352\005\327\274\367\266\2143\020\374\314C#\031\216\245"
+	.ascii	"\r\225\004\274a5\233\334\253d\340\247\215\025\031##\320\267\324"
+	.ascii	"\317m\270\311Z|\210\354\310!\246Q\016CzG\005\255]\201s\004\315"
+	.ascii	"\366\221\213r\007\234M\354\317.\373\223\313\376\264\262?u\330"
+	.ascii	"\237RM\374\373\262\027\226\242\"\351Q\326\350\003Z\232\3077\257"
+	.ascii	"74<\316\243\215\2609Av8\321\331\200\004\333A\307\020\324\206"
+	.ascii	"\037\254p\2348Z\311cY\\_LX\032ig\262\224\261\257\363\223X\347"
+	.ascii	"<\236k>w8vo\350\252\334\020D\354\355\032\221&\200j\260\321\002"
+	.ascii	"r\322\370y\374y\343\001\025o\373\005)+k\364\264q\036\362\246"
+	.ascii	"\314\030uJ%Q\203V\247\314\2365\034\270\222\223\0057\203\2201"
+	.ascii	"50i\264O\343\333Z*\215\311U\243\347\214\263\371A\213\"\304\352"
+	.ascii	"\224q\206\331Z\203j\364\204:\213Lv\2653\306\201\322fPQ\203b/"
+	.ascii	"\003_-w\336\237\303\237\207'\r\013\210\326W\334\317\243;3S\325"
+	.ascii	"\245\304\336\026\201\203k'\037\b\335\013\304\007\226\\X\221("
+	.ascii	"){\366\356\302d}\326rN#\362\346\260\240\306\265:\3013VEdF\243"
+	.ascii	"qt\304\036\314\354\320\350"
+	.string	"\355\265g\261/\035FMSL\232\265.c\203\230&\022\263\301\210\241i57\335C\263a&R\350\026\255\274\265\233\036\303\346\326o\375C\303\3516\375\246}`\262v\323f\336;\264\227\033uq\323<\234i\006\271\205M\241\022B\277\274m\004\224\361\203'k\232k\272\311d\315\346F\312\213\304\246\331\272\215\231H\034\232qM\336D0\360\343\206\f[U\256M\r\020\232\222\353M\243\235F\207\244R\213\301<\303d\215\306\302i\222\345m=:\020\331\002c\257\323\301^wf\233\214-\323\274\n\263\264\327)\355u7\330\353\274\354uF\354u\\a\032\314\316\322\213[\0300,e\rL\024\324\226-\241\344\242\234\211\034\232K\353\360\363\004\201a\tR\245\312\276\267\204@DL\225FQ\376\226\\\247\275\265\374<\255\206\244K\212\207}c\351,?\017\020\333\021*Q\032\275\356J\2258\267\036\215\266\025+Cw\025"
+	.ascii	"qe\305GU\243o+\177\343\300f0\342\350\374\320\350\017\023\345"
+	.ascii	"\272\n\322\033\255'\f\227&\224F}rkeemf\357\022\345OV\024#=\345"
+	.ascii	"m\026\226\246\244b)g\313ec\031)/\216\036*\314.'r<\254\2049\323"
+	.ascii	"5v&\353\261\356\342\261;\354Y\243\201\343\311\333\275\310\023"
+	.ascii	":4UW\274XA\201\322J;4J\322l&\034'W\207\363V\216\361:r\326\350"
+	.ascii	"s1\300\230\254\301\332\t\217\361\336\251\023i\356\021yB\307\204"
+	.ascii	"\253K\221F\333\311\337a-\326W\250\230\022+K\032\365a\242\355"
+	.ascii	"\224I\322M\222\364W\356^V&"
+	.string	"o\034/\362hB\211\222\376\262C#&L+Q_\001L@`\006\273\235\224\211\005\336\352\324b\200/\241\350\251G=\027J?\237P\230\366\200\352\b=\022V\337\317'\364\363\251\253\360(Mrb\352\375|G\252\320\351(\004\023\223\323\357\007\374\351\326]\356\005\360\247s\301K\231\320\247`\257)m\312=\005\201\032\004\217\224\202D\275\237S\317\317E\357\bw>\353\356\247\024\334\371)\005\317\245U\351\2272\345R\030>!*\024\246jR\022O\367\024\004\366Pu\r\236I\351O\311\307\304\323%\245B'\264\227\nuWwJA\024?O\352*\364)\245$\214H\225~\274\245\236\321\372KU\325\251'\202(\211\007d\n\361\304SU\fJ\330\025\020\"\005\212U\345\005Qh\360\024\004\366H\254"
+	.ascii	"\274'\334\375: A)H\342=\237\232\376R%\373\bV8\260\202\005\f\272"
+	.ascii	"\263\230 \305\004)rg1\001\022\322\004+\220\354W \235)P\250\210"
+	.ascii	"\200)\330\224\256\2735\025\246\352.\200\365K\t\244M\274\020\210"
+	.ascii	"X$\371Z\250K\253\216\205\272\264Z\241\260\247\352\200A\0308\350"
+	.ascii	"\2519\341\316\006 \214\240.\231\360{J\342Y\177>`\260\005^\252"
+	.ascii	"\262\260\343\005W\2404\370\264\022\255\277\264\247\246\301\035"
+	.ascii	"\323\272\002\325\2455\304\272[\201dW_\223\217i\007\"M\002\266"
+	.ascii	"\340\005W\335\227P(\371\\\bp`0U\217V P=\352\021\3564hJW\341\223"
+	.ascii	"\020\b\2064\351"
+	.string	"\007B\222/\030\364\202o\355\361\206\322$`\323N\311\211\2054\t\204\260\347[\205\276\225\267\nw-\byk\320Ro\365\275(A\b\034a\305\bE-\364\200L=5}\001\270s\n\366~\322&\237\ti\217\247z\240\364\3635\251\030\374DP\323\027\300`\b\225\267\324C\325\324\347\302\267\376\322$\020\222T\036\220\205 \030K-R\341R.]yk\t?\240o\345\251NJ>\027?`\017\200u\307b\375\371\234tGB\322\240\304\t!x`{(R&\237\013\240\032\334\245+Oe\002\252\353\017\330;\352\2718\372\371xMG=Ux\204\002\201t\345\221\220\302\3605\371\326\240\bj\312\344\224\224.\365\204E\\_<ol<Qk\364\004\322\347\2173\310O \347\226O\361\004\202\262\001@\314\006\354l\251\201H\226C\317\003DKI\245\207\220\255\254\356\362!\202C\227(\215\236W\347\325\351\203g\b"
+	.string	"\\\034V\363\355\"u\230\370O\254\237>\232\013\210\310\027\225\331\026tG\22600\215\236g\006\373\237U?\255\202\334\360\310\252j\364\354q\322\360\325uv\206\354mk\226\250I{\322\350Iu\"/\244\213J\201\276\250\241,\247\0303#2\"\"2\222$I\007\021\005\204 '%\274z\022\24059\2211\207Ddd&\005\005\225\302\306\001"
+	.string	"\242\311F\361\241\312\035\035\021\367#E\243Z(`o0\333q\353\\\206\247\302$\037Y5f\n%x\357\363T\004\303\035\340\2750+'N3!\233\257\336`\3227\275:)\232\bv\262x\316`\003\031"
+	.string	"B\243`\341\273\353M\317\365F\311gm\210\241\017\377mf\237N&3\305\330\303*\201z\364\034\004V\327\220\227n@\367\325F.A|t\"\202#\275\030\301\304\254\367\353-\f\371\245\335\003\350.\253\273_o\237d\365Ce\370C\005\245\b\235\020\241!>\021\220\006p<\363\353\200-z?\312\343\346b2\263\235$\031uI~\373\374\216\375}]u\002f\230\301\325\032\001\302@s\3444\207)\271\027\324\237\275\224\365\354\323\340\206\313\300[x\214]\274\376\333%\236L\257&8$\265\334!S\342\004\304\215\213\304\004\251\231\244\267\001,\267\272Q\347\345R\373MM\2240\356\331\t\374\245\"\223>\305\003 \317\260T\301\360B\251i\030\226<\362\373\b\252\243C8_o\334\224=\227q\334\370V\270\204\337nV\346|W\375G"
+	.string	"\203k\255\334a.W\be\337\3457z\213\211\226\027\001KN\321\037;\304*V\340\341\253kM\016\321\271\013\256\003QN\371\306K\341\321a\301\023\337a\300V\016\221x\307ChQ\262\220Eu\274!\333\032\222\030\261\213\003M&&\004Y\006\261$le\352\231UN\376\340\306\311eVv\257\206\246\002\272F\013\343\006G\211\\\2707#^\364\"\246\rS3\231\264\016\207\244\336\210g\224\373\317G\356\262\351\303}\024\350\b`\307\213[,&\312c\035\277Z\003A\035\202\371\336\024.[\3609\227\315\002f\301\341\027/XV\351\n\206M4\221\026\b\201\276,\232q!\n%\200\363\226<\274\2331n,\242\307X\321\202\342&\257}\r\227\342\3541\b"
+	.ascii	"\036T\256\017\017\221\325\003t5(e\262^\300h\315-\344\027@\024"
+	.ascii	"\250\342\375\210s\276&S#`\030\216\033\024\336DTQ\205\313`\316"
+	.ascii	"]\277!T.\331\270 \252\306\232\007L{Z{\212\021x\200\316\211\366"
+	.ascii	"M\325\205}\326\334\260\344\230U\"8=g\253K\3057D\377q\371,\313"
+	.ascii	"\376\023:\345S\016\200h^\344\223B\005\035(\030\220\365*;\366"
+	.ascii	"\033\265\345A\232\316V\206\207PWI4\231U\262\"\016:\022\266\340"
+	.ascii	"S'J\214\277\266o\260\304\317_\311\231\013\"^S\205\f9\300\345"
+	.ascii	"\r\331\323\247\335*\210(\232f&\365\244\225>\335\325\246\220\317"
+	.ascii	"\016\247\0250\326\244:3\035n\333\023\037\204\341\037FQ\022X\001"
+	.ascii	"\311@\350\244\364ev\261\220\334\260\214\272G\247S\225\001YV\b"
+	.ascii	"\242%\232\t\3649\3024+\206'\020\251\363\225\310.\017)\305p\223"
+	.ascii	"\020\376\2465*\327\336\304\327\304\261\300\240\030\214\227\330"
+	.ascii	"\210\324P2\333\345R\222\355\214G\222q\310M\323.\2041\2330MM\340"
+	.ascii	"\323\227\b`\230\006wZ\323\366'\242\247\013&5N\022\007D\350\r"
+	.ascii	"\261\332X\036M\272\206/\360\247\036\333\242\3767\361T\2117~X"
+	.ascii	"\016r6\377\347c\217\035}\342k\206\233\364\027\277cR\270\324G"
+	.ascii	"rN\302M;\211\037\272\007\346W\371\206\312\025\211\201\303s\037"
+	.ascii	"\262_H\316\016\300[\272=M\334\272/G\251\275 \274(\200\007\222"
+	.ascii	"\007x\275k\317\277\270S\003"
+	.text
+	.section	.gnu.lto_.symtab.6de3b69b273b5c82,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"loadControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"controlRateProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6de3b69b273b5c82,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3573 @@
+	.file	"core.c"
+	.section	.gnu.lto_.profile.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`F\004\035\025"
+	.string	"\364\030:\005"
+	.string	">"
+	.string	"\336\224\344V\034\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\004\002\004"
+	.string	"\001\352\263\360\321\b\005\006\007\b\t\231\357\210\200\005"
+	.string	"\n\215\343\331\336\017\f\002\006\002\007\b\002\b\002\001\002\t\r\350\326\320\274\b\b\001\002\n\002\001\002\013\020\251\222\262\341\t\024\f\002\f\002\002\002\r\002\002\r\022\240\342\234\212\n\025\260\326\266\250\003\022\002\001\002\016\001\002\017\002\001\002\020\027\030\035\250\200\234\374\004"
+	.string	"\036\243\262\274\213\017"
+	.string	"\037\231\342\313\356\b\006\002\002\r \235\377\255\301\t\004\"\210\303\346\214\r\"\021\002\021\002\022\001\023\f\002\f#$%&()*+\233\304\365\321\002\002,\214\233\312\236\002\002-\334\255\260\200\002\020\001\002\024.0\255\375\356\275\0012\r\001\002\025\026\002\027\002\f\002\002\r235\311\202\342\200\017\0176\376\336\373\325\016\n7\364\355\322\327\017\026\002\026\002\030\031\002\031\002"
+	.string	"\002\032\t:<\307\357\321\225\001\n\002\002\r>\266\231\367\251\004\032?\315\347\335\233\n"
+	.string	"@\304\306\257\225\005\003\001\002\020A\364\316\2219\246\001\005\004\002\025\033\002\033\001\001\002\001BCEF\234\361\365\241\r"
+	.string	"G\350\300\306\254\005H\234\346\300\362\007"
+	.string	"I\312\336\235\231\b"
+	.string	"J\346\312\266\300\f\001\002\001KLM\354\206\342\366\006\002N\342\201\222\246\004OP\252\257\370\340\n\002Q\202\321\330\342\013R\346\270\272\264\006STU\264\264\266\260\rV\240\342\234\212\n"
+	.ascii	"\200\216\250\3615\241\0211I\nRi\f`\00224f\335\0210E\203(\323"
+	.ascii	"8\303\236\001\271Jg\263\204`\257\3125\323}\317\n\007\257\034"
+	.ascii	"\037\354S\370\272\030\272\232\331\002\177C\n\\\023\013\346\207"
+	.ascii	"\214\270K\017K{\277\251\311\357\246\243Jm<\016\302?\236o\353"
+	.ascii	"i\3761m%\276`\303;\236v\340\275\355{\201?\177\377O\242:\366\251"
+	.ascii	"*\257?pX\325j'\315\364@\231\372\226\367!E\241\026\373\354,\323"
+	.ascii	"\253l\317~4\002`9\252p\243\016\345\266Jo<L\001\031>\262\204\304"
+	.ascii	"vG\226}\202Ds\366^\254\357\264\036\374\372^\236\356\336-G\316"
+	.ascii	"'\033\373ua1`\327\377\036z\335\241y\257\303\214\220gA=\213\366"
+	.ascii	"\027vw\2260\260\252\277\300\025\365\b\205J\021\327\rq\317\017"
+	.ascii	"u\271v\314\271`\016K \343h\251\343u\315Ft\301\361v\032\327\274"
+	.ascii	"\t\003 fX\005\311`\300\214;\312\007N\271~\312qJ\260\227\326%"
+	.ascii	"3\344\205\341#\225Y\362"
+	.text
+	.section	.gnu.lto_.ipa_sra.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`}\001\215\006"
+	.string	"r\306\022\031Pu\241\00303SP9\270r\246B\232VI}\273[\227\277K\356\224\002N\315f&f^\246\245B\2716\231\222rF\336\035\344\261c6\324\031\273X\261\t}\204~0l\341\t\202"
+	.string	"`Z\245\322#}\350\321\351\254\003k\023L\250"
+	.string	"u\233\315\240\002\"+\326\001\020@g\004))\fcs \347`\032\271\n\242\035\216\225\200\247\031+\241\235\363\r\rn\315V')\007\006\006K\361\017\030\330g\325<Q\375c\025\256\020\375Zv\352\025Q\037T1\302\312L-3\351*\200\330P(\250\235G\225$\204\375\341"
+	.ascii	"t\201\202\346\207\262\221\250ZK\016\203\023\020\332}\263\264"
+	.ascii	"\027\r0\307Aj\003x\301\203\235\032I!\036B[\3217\204x\013"
+	.text
+	.section	.gnu.lto_.inline.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`~\ne\034"
+	.string	"\206\334nI\260\326\321p8X\300\260AO;\262\324\201\271\033p$\323\226\013\236\241\322\031\026\272\242\007\226-\3134\350(M5L\254\363\263\367\001H\262\372\374\200\201\\=\336Zg\271\237|;]g\247\003U[\371\277O,\251[J\231\002X"
+	.string	"V"
+	.string	"]"
+	.ascii	"\345\371\362\334\031\272\033\016\001\013\t\002d\243\300]V\364"
+	.ascii	"G\367\004e#\254\352\005\301<\300l\237\370\200/b;\244\307\351"
+	.ascii	"\367\336WXv\3064|l\273\227\375\265\266Q|\266\035\314UT\377\267"
+	.ascii	"\360~e\333\335\335\372i\274\3038D\252\260\277\3520\260\310sq"
+	.ascii	"\363\327\234\245DT\004\256`\346Z\031\277\"\317\365\004!veL\376"
+	.ascii	"F\257:\034\205\224E\244\303\376<b\207X8Q:\220\303\356Sa\004\202"
+	.ascii	"\341\314\\V\315id|v\267\312gd~5\321\335\346O\343\242\356\006"
+	.ascii	"\360\227\352\365D\353\257\2550\305\025\016-\332\331\032?\245"
+	.ascii	"\236\366\270\200/\235mK\250\261\217\251 \021g*H\204\035\347="
+	.ascii	"tD!EsD\204\022|=\302Rw\307h\\\325\335\006\376\340%G\267\351r"
+	.ascii	"\007\252/Oe\243\337\017%\007\236nK\216l\336\200\374\007\306\352"
+	.ascii	"\211\321\273B\241]\013\205\021\263\\[\247 \237\343\257\316\340"
+	.ascii	"\346\356\226\210\222\026\020"
+	.string	"Y%\t\347\260a_j\310P\344\301\323Df\231x<$3\307@\273\360\362T\236\244\033@\251\026,)QS\006<\226\363&\013/m6%I\022\304B\031\2078\362\256\313\366\247\365\213`]N\307\220<B2\t5iN+fI|\317;l\265\"g\304FN\301\274Q\375\212\036\212\004\217L |\002\031\200\336\250a\242\021\231)IAj\264\006P\"BDV\335\022\200\341\210\204\3140\006:\307\034\252\221\t\232\202zV\016p\324\2623\0072\352\355\277C|9\246Q\300.!,5\330\221\276d\023\275\265\016\327\326\340$\325\200A\225\325\360\264\231\203L\334Db\335\365,\020\206\312\266\2505\272\267vp\260\263\215\334p.\232\375\323b}\374\027\202&\034-\257\306\300F)\310M\272R\275\331\236\203\372\3119\331cPUs\b\216\336\3016\357,fb T3\260\030\220'\274\366\\n\302\203\356\377"
+	.string	"\356\245bC\206\204[\342O\373&:m\272\262\366\025c\364\270C\244\244EJ\304\312b\201\2743)\034/Z\213\004\013`z&\350kG\217"
+	.string	"\314\271\341\360\202\344\334WD\215\n\326\211\356m\246\004\333\212O\3502\343\233\234V\241\346\371\2043\330a\374'\372qiRUuG\332\321<\335\341 \026\007\222$\016k%\204\332Y\300\344\351\305KM\347\255i\030\260\374#\205Z\215\b\372\214\242$\341t\352{\206Y\020\301\264Q\204\260m{i\017\220\337!\341rQ\024 \322\f<\254\310 \004=/\275\b\207\035.\212\016$!\016\263O\262\205Z0\032\232.x\b<w?\021\301\301\034\203\272\233T\032\344\\g\022\257m\235\253\360\307x\273]\035\033\266D\374\364\273\257\311\t\235\377\037\020o\027\345\3259\211\313\376\225$:\220s.,N\322>s\260\375\2502\227\005\370\226r\004\3678\213j\r\370\206\324Q\367\b\0215\252\277{\231&\321.\247\005.\231\034\377\307{"
+	.ascii	"\367R\223R>\206\317\326\327\360\323\337<t\204c'E\276\336\277"
+	.ascii	"y3\314_\231\201\036"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\253\tm\031"
+	.string	"VZU>0o\223\016\300V\320\362\326\016Q\3645\267\203oiW\b\2208\0278h2x5\n\376\003\003\003\003\325\236N\334\204\264H>\246\343\327\352\350X5\341\274P\234\206FHz#I\262\245\224\002?"
+	.string	"I"
+	.string	"E"
+	.string	"\351\rn\315\035\277gG\222?\246\255/\241P(T\207X\337\236\332R\266x\304\366\225\027\027\222d\f\3767\033\016gzoz\317\016\223\020m\375\266*\2551\263\0303\327\342+\377\266\001*U\b\037\255G\033E\034\034v\035\327\261=,\200\203a\006\271\322\320\260\273\240A\004\200\201a\327\311\264\215\204_\263\314\216\004\203\361\225\026\341\377=\215\246\205h\315CQ\276\022DU}\230&\017\177\257\243\303Wv\360o\233\2033}\005\367\3113\234X$\177\r\376\0215\037\237\360?M\025\310\204\203].&Zg!\177\312\362\b+"
+	.ascii	"\311$hkG\320\036hF\206\001W9\223u&o\020\277-\320\272\243IK\362"
+	.ascii	"\257J\250;\212M\240\037"
+	.string	"\036\3206m)\264\023Z\tm\204\026\302\203R\016@\277\335\240e\320v\301{\257\265\215\215\217l2\377n\341\377J\214E\024IR\245\342+\275\302?\242\n_\204B)aO\210'\304Vb\n\037?\037[yDD\361\201\017\250AeEE\222d\330\f\201\005\2040\347\240+\017\022\240Q\232\022\347\2202\312T\2154\005\245l\314\001\024\035\036\265\357\355<Q\311K\247RX\336=t\364\025kj%s\336\241N\263b\221\311\205i\035\305j\330\352\364)\"j\267\204\026\"\"g\361\264\334&)V\032I\206\2460\227\260\027\341\372\034\242\003WE\f9\254\322l\364\033\"O\232\336G\260$q\025g\351\207c\020\204\226k\225\357\237$@o\\W-\263\016\207\3442\220\242\037=\257s\236\016I\324/,\307D\326\376\214\"\023I63\257I\225\363\340\370\270\232Q\271\314\374\350\t\243\253\310O]\304i\233\301"
+	.string	"0\222l&S\270{\304\022lA\277\250i\305\376$\303P\263\264\254\357s\032\235"
+	.string	">\367\207L\223~o\311\352\2215\017\241\n\234\212\370U\336g^?\204-\362V\017\357\322}\371Td\365Q\360;}\337\246:\240\347\f\332r^\216\0015\361\306\303\203\204\276\324\035k}\277\3755\334\323\3315\254\215\264\211\335bQ\223\345\302\315\254\f\207\n\317 Wb\310\215\013@\016'\037w\342\247qY\354\033\255S\305A\273\031\326\334l\035\323\220n\233\r\034d\317\277\357\215\305\032Xw\230*\225S\316\356N\031-\325[\210Q\022:\232\t"
+	.string	"\224\355\t#\355\276\262c\202\301b\2244\223!M\204\201M\207\\\225\336\202<\271\310\353V8\316#\334(<r\34563\004\251\2076\263\335JT\202\217\220\024M?6\334NS\031#\247\215^\330\363\224_3e\350w\270\243T"
+	.ascii	"9\200\t)\221X\214@E\311\211\225\317/F0\bObE\004\013\207\250?"
+	.ascii	"\273\260e\360\362\311\245\366\221\342\nl{"
+	.text
+	.section	.gnu.lto_.pureconst.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 h\235\002"
+	.string	"\202\306\023\033\200\3170\006'\214fP\231\257g\233\265\007\351\335\347\257\377.\205\313{\2763\225\001\232\3063\032F\273h\026\2578\305'\232\304#\036\304\037\356\320\032\316\360\026\256\360\204#\374\340\006/8\301\005\036p\200O.y\221C\336\343\216\327\240\2526\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`_\001\315\007"
+	.ascii	"\302\312\036#`o\206\003\3100\f\3030\f\3030p\005\004\327\364\301"
+	.ascii	"\006\201\271'6q\303k\002\t\206\350\227{4)S\377\317\256\274\003"
+	.ascii	"}\336\363\354p6\324d\036\363\205\223,\037\020\26127\301\210\224"
+	.ascii	"\t\326))\217ts\333T>e\230V\256]\177\3429\251\303O\003UNA\nY\347"
+	.ascii	"\243\323Q\336\350\304\312\257\002HxF\347+\177\235\213rE\245\301"
+	.ascii	"\357\247UnuV\345U\373D\334P6 \200\002!*\253\003\263A\2201\017"
+	.ascii	"\250\365\321ho\026#8\313\036'\310\360\35685~\026\263\351\367"
+	.ascii	"\022R\b)\355\213P\214\026\264v\371X\0132\034;\275\264\311\300"
+	.ascii	"\307M\230\234\204\004\213\035\226\023H:.Sb\272\f\324p\304(\321"
+	.ascii	"\320\247\b0\020\303c8%\2302b1!\344\202\b\002<H\337\276\246a\277"
+	.ascii	"\360\316YP\223\333d\332\324 \023D\230C{D\202\007Q\314!"
+	.text
+	.section	.gnu.lto_.lto.3e86d57d51d3abfc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdLaunchControlModeNames.128.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bX"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\255\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'*\206\b{\370\347Ry\276'5\206\bw\230\347\002u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005FULL"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\nPITCHONLY"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8S\373\264\272A\3457\200\""
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.132.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \230u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\206\200\200\374\342\203\356\322\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\355\030us\367\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001'?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/fc/core.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.134.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_isCalibrating.135.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\246\001%\017"
+	.string	"\366ZaE\020\221\223\016;\3641\337\363\305\241l?\245q.m`\365\243KQ\250\262\327O$E\357\027\370\347\324#\n\262\215\344\026\374w\265\300\242=\222\001\320\n\211\250\002*\364eMr\003\020\355W\213\226\354M\266\224)\005O"
+	.string	"J"
+	.string	"N"
+	.string	"\034L\306\013\256n>w\216\0041H\235h>\234\250\034;)\3452\204I\212\247\221\304\323\253\363\221\214(\204\004<\310\240t\276\016~\300"
+	.string	"\201\3431LTt\001|\035\0240\347\274\313\365\364\225T%h\316i5}'\267\307m\263\330\036`\237E\316\240Ao\372\336\345\230\f\02736\254n9{\305\351\242\354\303\271j\217\2521\253\245\325\321\352\313j\250~"
+	.string	"\321\252\206\346Sc\316\222\033\035s\346Z\321b[\304\356\370"
+	.ascii	"\002\021o_\251J\344\310\r\357D\315\234\253lS\337\036$B\342~\004"
+	.ascii	"T\030\031\224\227x-\006\275v\301J\267\334\337\342\245\204\352"
+	.ascii	"\202\253\240CK\004\221\336\004\027\302\013\226\r\253\264\234"
+	.ascii	"W\325b\251\200\207\271\356[\034\2655\221\336\244{\016+\245\345"
+	.ascii	"\256sNn\275\305\257\003\0236:m9*\374\205\350\016}@FZ(\013=\310"
+	.ascii	"&\2044\220\220\205F\025\262\317\2075\n \243\314\202\246\215\262"
+	.ascii	"\316j~Y\354I\235\274\030\314\223`F\016\0241\373oQZ\256A\244-"
+	.ascii	"q\026e\215\005\256\322\300\261=\331\330z\366\336\016\222\336"
+	.ascii	"`\330\242\256\033R\320\020!\343j( \220\202)\271\362\t\005<s\274"
+	.ascii	"\220\302\233\013\034\232lWb\r\341`\330\304^\2140\333\275-\365"
+	.ascii	"=\221\233y\371m\261o\255\266k[\314\306t\002\003v\206\020\216"
+	.ascii	"P\274\211\017\n\221 \243\355\327\222d\204\274\275\005\265\216"
+	.ascii	"7\216\273\241\253\215Q\223\247\225o\235c\266\001\324\265M\240"
+	.ascii	"e"
+	.text
+	.section	.gnu.lto_canUseLaunchControl.136.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`3\002\365\021"
+	.string	"\206 uH\340\360&\035XX\017\364(F@\367\206 \332i\335Hx\035\347x\307"
+	.string	"h\270&J`\374\0346\177\255\347e\033\266'9\356IY\0030\353\021\334\303\204u"
+	.string	"G>b\331b\274\200\307\344a\377*\226\021B6\331R\246\024b"
+	.string	"W"
+	.string	"d"
+	.ascii	"\261\021Ks\342\302\315y\353\035\340\347\311.\256\266|\327;\342"
+	.ascii	"\210M\013\f /8\3148\317L\215\2020\032\375P4\030\317LM\275\023"
+	.ascii	"-\026E\346\234?\232\251\251\264\240\335aj\036O(Z\005\3358\242"
+	.ascii	"\204\342\006\212\006\213 \263\035\331o\327\030\332K\325+\231"
+	.ascii	"sZe\264\013\367\351\266\201l\017\2605A\233Zk\254\366\372\317"
+	.ascii	"\201X|\017nq\321\313\336\371.\362\335wG\003\f\233\237\032\214"
+	.ascii	"6\3318\227\256\315~\234\213c\253:e5\270\352\317j\317jiugu\264"
+	.ascii	"zU}\001-7K5\020\f\3159k\3021s]\212\017\266_\354\223\013\030x"
+	.ascii	"q\3538\235\331sf\001{\0277\257u\035\244!\261\302\353\002\350"
+	.ascii	"\307\033H\033E\245\227u\013@\306'\325\223\241G\256-\350\321C"
+	.ascii	"\t\334\201\264W\036\350eqQ2\"r\260u\035\310\321\350\351\326\366"
+	.ascii	"\315a\304BEl\311]\025!\031\240\332\253\tz\331.\212(D\356\265"
+	.ascii	"\256\3530)\235X\207\310\324\376\366\357H(\t\246L\376x\210|V\221"
+	.ascii	"\244\260V\252P\245\022FXA\201\020\252X,!\t\210W\022RX!\205\325"
+	.ascii	"\212\025\236p\363q.\216%R\207\241\242\370\240\377v\005H\033\206"
+	.ascii	"\212\300\277%\301\215\261\r\256K`\366\325\2616\233\310oU\204"
+	.ascii	"\222\374\0227a\262\340\344D\276\373\3263*\362\2216j/\320\023"
+	.ascii	"\231\336\242\210n\0361@\304>\271\273\303@\006. \320\002\221\251"
+	.ascii	"\252\007\305\b\355<\tO\364M:&\030\305\001wm\242\230\006\227\026"
+	.ascii	"2S\330\302w\375J;\271\254\264I\366\275\005\220`\227\2751\020"
+	.ascii	"\241\226\2613\023k\250\313\300F\360An&\330\300\034\nld!\366{"
+	.ascii	"\303\271\334\200\343\026\244\360>\222\305\007T\276\t\032p\207"
+	.ascii	"\211\321\366RH\303:j\227Ueb\017"
+	.text
+	.section	.gnu.lto_resetArmingDisabled.137.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \341\035\006"
+	.string	"\362\n*4`k\323\001P\235oFJMXq`d\035\n7\355\257\006\202\323,\326\2024\036\034\267\377\376\221&\267"
+	.string	"\016\260"
+	.string	"\300\301Y\341\310a)d\320O\376\336)\005\236\322T\351\2243#9\032\314F\316\n %\211ig\2522\200\322*\243m\037\265\013Fg\305\001S\3567\334\301\022~\202\005\314\301_\177|s\217?P\305\204\227a\301\317\336*\030\r\354;6jv\214\\PT4v\261oc\273'b\301\366#S\266\3057\204=\204\002\301\203\267\2732\036\234:\244\3743\034re\325!d\331]\303++\270\343'\266\261\t"
+	.ascii	"3\001\0038\343(\276\3055\221,\004\3742\004\270tc\266\266\353"
+	.ascii	"\264"
+	.text
+	.section	.gnu.lto_accNeedsCalibration.138.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\257\005\025\035"
+	.string	"\3062\265I\240XU:@\345\302=%\315\034\225~\310\351\255[\337\374\254\021\302h\232\314\255XK\314\3041d\n\275\375\201\306\033\037I\374'\334\020?p\033=x\344V\262\002\357"
+	.string	"\367\2124S\326\n\026\305\267\363x\373\204\020B\244\224)\246"
+	.string	"\213"
+	.string	"\255"
+	.ascii	"??\353\t\024\374\274\266\304`\320\231\023\346\220\214\251\225"
+	.ascii	"(k\243\255\255M\rM\f\366J]-\326J\205\236fI6\327\276@k\223\253"
+	.ascii	"Iy9\244\335\017\246Y\244\235\217c\344M\020\020\335>\355|\220"
+	.ascii	":_\234\302\364`\330K\303\020J\310\024Q\r\337\246A\327P\213\007"
+	.ascii	"k\307J\207*\307\n\027\007i\327ctmG{\222\001\212|S\373\264\023"
+	.ascii	"\"\005T1\346L\031e\f\222\324\351Y\271\221\362p\344\r\226_\027"
+	.string	"\026/\307\235\362r\244\200Z\353\n\227g\360n\314\247\203Z\353Y\307\253\261\277\331\177o\377s~\362L{\344\203\202\340\017b\215\314\fd\371\316\026!A X+n\001q\211\224\370\036my\023<\345\227\307\334\222\333\365\203J\032\332\370\310\265V\240~\315\334\016ad\013\216\311\034e\336\024\346\257b\005\257n{\205\213B\211q2\365\005\327@?\361\306\r\374\227\254]\364\237\037;\037v\376\213\344\247\315w\235\337:\237u\376\352|\325\371\350\371\347\371&\363K\346\223\314o\346/\316\3320\216\001\303@\252\326\240\243\231j,\237\004\371\277\377\003O\266W\316\320\206#e5\013\237\021\001V\247E)[\207T\\\253v\341\373\271V\235\026\241\260\f/4Z\252~\321;\256T\235\026\235\310\034P<\026\332.zeN\264\323\242\322Q&\035Q\253\263Y\364\304\360\331iq\210\021\327@\033[\302EH\325\300\341\232"
+	.ascii	"x\367\202\371c\310\300\2533\333\247L\216\031->\320\006n[\001"
+	.ascii	"2t<\313\206\321\373\261a\243@y\342TN)a\222\322d\222\375\3233"
+	.ascii	"\342\260\305&MLd\273~QI\367B\344\212T\331@$\333\335B\275_\207"
+	.ascii	"]\242$\311ROm\220\314\027'\344\007\223\233\366{\b\237\035\330"
+	.ascii	"\241\365\314d\263\021\262\023%@\360\310f4\025\262\0037\357A\261"
+	.ascii	"C\223\371\364\364\320d,\242m\311\332E?\273,-\275V\270\024\244"
+	.ascii	"\232\226\212\347\0167\3263\376\307\372\016l}\263\201\365\022"
+	.ascii	"\r\340\277\226T\023\362\352`mS<\032o\260\312\244\346\205\303"
+	.ascii	"\260Z\267\246d\376\017 \360\352^\355s4\"P\332B\323\300\257\004"
+	.ascii	"3\355\026Q\204\315\"\001\255\265.\370J\211\230\200\036\2650\267"
+	.ascii	"L[\265P\033\325\342{\364\n\026xu\026\314-]\275Sz\b\331\370\270"
+	.ascii	":\272\241X\253@\253}\216\265\201\224\rX\216St\2501\\\2012\330"
+	.ascii	"\020\211\210\004ISPh1\020\003\221\241\255\016\0208\204\306\350"
+	.ascii	"\024\033*C!~w\\H,\207T\336\367\2779\233\331O\302\371\205\327"
+	.ascii	"\304w\220-%\200\026\240\320~\246\312\236\036\245c\217 \241\226"
+	.ascii	"\325\277\326R9\001L\005\002j\310\nl\3512l\3512\024\202\335\301"
+	.ascii	"\262\212\271\357#\262\256\276\217/\177\037c\t(\302V=\216(\025"
+	.ascii	"xJ\270\005\304S\254B%\364S\305m\317}\331t\332\026\025~\245G\035"
+	.ascii	"\231\237\037D\277w\375P\347C\371C\001ec\205`\351\001\351\027"
+	.ascii	"\313\225\222R\350\034&\350Z\260\256\363[\021\210\313c\354\217"
+	.ascii	"\373\034:K\3169\307\017\347S\254!(\223\2755x\332\214\345Ukn\341"
+	.ascii	"\250\001"
+	.text
+	.section	.gnu.lto_updateArmingStatus.139.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"%\t"
+	.string	"vQ?9@\305(\035`\255\247\274\022;8\2637e6\300\250\331\367\230q$\226[9\304\224\237R~S\0357t\212"
+	.string	"0,\3440p\347\254s\320\031\372$9;\262}\262\211\224)\005."
+	.string	"."
+	.string	"/"
+	.string	"\367\034\323\364\370O=\340\003?\307,\024W\f3\302\370\004@\017#h}\240<\365\224"
+	.string	"C\231\225\202\335u~\340\304\035o\333\300\366\200m\222+/\325d_\3030\f`-\331O\307\247\237\235\265\256\223\203\220\335Q\b`E\"H\206\355_\354\261M\276:\355;.D\034\256\335\325\324\"?\275Z\036\352L\026\365\251[F6JB\371\362\237\311\256Q\235\"\222w\3255 |\224#:\371\357\321\357d\217W\215\tU\241\"\2012\264\003\3364\233\216\333\264-AcP@X\320\266\216\243i0\346\0326\235\346\300q\235vY\201\216\255\226\034Y\233\322\002\251\207\355\356b\225\2649\017\371\317\252\237\016"
+	.ascii	"3\241\335/FV\301\301\025@\265\017RX\304\205\017\341jTxv\031\345"
+	.ascii	"e\bq\351\242j\207\006\246\240"
+	.text
+	.section	.gnu.lto_disarm.140.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`X\003\265\027"
+	.string	"\006\252\226I\300VQ:\342\t\240\340\\\360K\243I\327,\263,j\273b\311fL\231\221@\344H](\267d\340\322\035\377[\037\377S\304WP\326\207\274\005AD0@PH\274\263\2742\221\210r\222\207\0202y!\221\020\2627\2212\311\204"
+	.string	"t"
+	.string	"\205"
+	.ascii	"\237'\327\265k\345\272"
+	.string	"\243\372#TfC\240j\255\251\246q\327I\230Q\f\351\004\233]\373\220\347\366\261\254\275N\0366t\030\234\0344\027<\342\310P\321\342\"x\243\304\233\025(\202\021\365\0344\033\207M\264\026\340M\255u\306\224\305'\250C\004e\205L\355\004X#eF\025P\246&#k&\270A\235\336\216\313\233hC`M\n\033\345og\024\265\030s\310Sk].k*\2761\337]\244\3355\260\333\030\002\275\244^\033:\323\277]l\022BE\306]\366\267\241\357\231^\236\331b\327=\210\320\276\306\262B\360\313\317}\b\372\371\336\341\201\203\bg\203\361oW\027\3436\332}\377~\277\337v\321.\345\245a\336\231\346\035'\257\310\274!\363R\220w6/\310\274\315\274\037\360-:(,\037\230jM\361\363U\336Lrcw\277\307=W\342@\226d\341#?wK\354\222\001\237;\341\347\207~\322v\300\303G\204\313\301\250"
+	.ascii	"V\360]\n\025\370\345\312(m\341\311\372\265K0\200$\315\037\210"
+	.ascii	"\322\004x\312\305x\232\342\224\364\035\220\205\240 \372I\323"
+	.ascii	"\317\035A\026\246\336bq\361z\001\222\240\263[{\244\037!\201A"
+	.ascii	"\203\006\3729\273\231\370\242l`\357\213\334\310\006\325jE?{I"
+	.ascii	"\f\357v\360\300/\301&0\024\205\027\353\327v\023y\231\005\306"
+	.ascii	"\277\375\227\013\321w\367\005+Wf\266\330\217\272\004\253\332"
+	.ascii	"Y\265X\252\224\212C\352C\207\rB)UKDj\247fY V\255\324\b\026\253"
+	.ascii	"\225\"u\260wQ\006'<X\307\300Zk%wt\277\030\360\256\350\200\311"
+	.ascii	"\241c\267\2048\361\236C\305\036\033\364r\300\207\353\306/\305"
+	.ascii	"\006\260\264s\341zVO\272\250\336\221\234i\244\201\004\245e7\336"
+	.ascii	"\360\356\203\236\245Z\002#$/\261\215\226\357C\303\346\037\020"
+	.ascii	"\256\364$\354\006N9%\270\036G\241\017\245\033\341M|\304Ze\013"
+	.ascii	"\366K\316D\302\276FG\250Q\034\006\t\224\210\005C2I\222\244\205"
+	.ascii	"\003\260\002\221)\273\r\020@\310JT,\254\001\263p\027\343\247"
+	.ascii	"\240[K\310Wr]\334o\3528CR\037\231\301a\325y\320\303\303\007\347"
+	.ascii	"]\275^r\272=\310\241\231\24791o|\355\210b\361\236\003Xx7\363"
+	.ascii	"1\224\370\372\013|7\3612i\004\016\377|qt\364\204\200\346\321"
+	.ascii	"K4W&$\030\022_\202\017\256\211)\f\016L5\307\377\344Z!\341.\233"
+	.ascii	"\367\263#?y+\235\031\033x\341Q\213\371\207\203\022\235,\"6\353"
+	.ascii	"T\r"
+	.text
+	.section	.gnu.lto_tryArm.141.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\375\003\345\032"
+	.string	"\266\257\247J\300TU:\350(\020\rW\326\263\0237\230\\T\323\271V\346\004\322\376\200\213\021\232\340\037\224\231\271V\350\251\322\320\306\363?\333;\327\272\201\tF \022\323 \211b\033\344\372\035\020\245E\036\030\351'\365\313\214L\354\336D\312$\003\224"
+	.string	"\205"
+	.string	"\226"
+	.string	"\301\037\2418p\273gI\207\017Xk]}\356\242\330]}\216\253\245\355V\271\320F}\221!\\\022\227Z\353\253\203N;\314J\225\"Qt\216\315\264\275j\327s\030\033\032?\275\257\210\272^\221.\006\253\2066D\035\fN\275\326;9\016"
+	.string	"\222\361t\242\2167\272\232\224\270\373\270M\221\256\307\250\"\335\013\026;\034S\027\2372\273\024GR\301c\213\367x\300\351\210\026\231\335ml\371\f\345nt^\261\2631\243nj\255\313\271\335\3177\346\273[\356n\203\335^\022\265\336\026\354\205|\210\316^\350se$\3709\022\364\223\373Fg\242`\351\013\036\325\270\270+\264q\377v\337\305b\261\270\r\264Kyi\232\267u\245/\253yc(\257\212\362\246&/9\362\322\346\235#o7/7\357\003|\311\213\257GD\324R\204\325\247\350\245\226\023\t\321\225\376\341\256\366@\236D\273\3226\271n\302\272S\325\340q\001\"\370\\\002\344\247\353-\3729\036"
+	.ascii	"=\360\302#\2358pg\320\351\304\356\003\024\226i\231\350\347\217"
+	.ascii	"^\340\347\t\017\0370K\215\213\251\255\240\341F\277\261\005%\201"
+	.ascii	"2$\373\207\344'\257\034\371\354+\231}\0377\020\364\344\211W\343"
+	.ascii	"\"+I\341s\003e\2026\r\357^\300\300\31759eK\371\344d\353\036:"
+	.ascii	"\303{\244\f\032z\326\320\030\222\370\327\320V\307\3642\216g{"
+	.ascii	"\221\033\331\260\027Z\0160\030\375l\365\221\316C?!_\2207\312"
+	.ascii	"p\202\357\306@\360s\013\343\004Ky\353\236\333\350\342d\244\373"
+	.ascii	"\267!(w\207\037Tn\334ewsN$\004\031;2\036X\314\202\207\230\210"
+	.ascii	"\0160\236\034\b vrtf\260\231\305Q\020\233\311p^8\037^;90\235"
+	.ascii	"\027\316\214\347\245\240\265\262\021\261\331\253\204L6{\255\204"
+	.ascii	"\265\337\324\3326\326Z+\f\001\246\351]Z\017\232\321\360"
+	.string	"\254 Qv\224\254\246\351\345\334\025V\023\005\314\020\002\255\372\307jU\237FI\013.\223\252\257\343\305R\017\236\213S\275\353\340\001}\216\325.\262S=\223p_jx7\202\004~\216\354\017\337*\243\310(\031\224Vr\250\372\327t\332\263\t\364>*p \370\236\311\233lSV\250q$%\225R\312\314H0\022\204$i\341p\002\031\2713\017\020Xg\263-4\006\362\250\276\304-\215-\216\2033\243$\300=\310\357a\360\336\360\r6\0042Z\221\b\311CM\005\343\004\037\213\321\347\200\033\004\303A!H\265\373i~\337\235\017\352\207\350\244\016\027V\004\364\364\007\345:]+\031\352\262\035\323\"\357\3454iw\212\220:h\267J\213\037\363\365zg\363\003C\256\211\257\327\254\254\272w[R\275\301\t3\246\332\362\314\007E\376\022!\353\352c\024\3115\337k\364|,\317\350\337V\375_\3242E\021\360\330\206\302"
+	.ascii	"8\003}\2148V\225\375\226\265\376\022\214)\326\250\001"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.147.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`M\001\335\f"
+	.string	"fUN? O\225\016 \206\304\270\230\233\r\252t\350\361\256bwA~\220A\372)\367\247\366\251\345\210\024T\177#\354\330\224\231Q\242\376Cg\b\002\b& "
+	.string	"\340\002\001D\004t\341\372\t![\312\224\0029"
+	.string	":"
+	.string	"A"
+	.ascii	"\273\253\251\207o\216]\026\324\334\370\330\004\300\027\275c\227"
+	.ascii	"!\241[\023\262(!a\200\030\272\n\210\036X`wO\342I!v2\261\311\356"
+	.ascii	":\277h\341\206\334\366\305\266\001\373\"\002\327\255\253\306"
+	.ascii	"\215\216\221I\304\311\017\033\345\245\222\354\303\335]k\007\373"
+	.ascii	"i\370t>\375L\201\006P\205\370\f+vA\037\036\253\262X\204\260\375"
+	.ascii	"\314\033\033\306Q\037\226\300\210\322\347\204\214*8@M\001_|1"
+	.ascii	"R\241\376\203\001\305\203\364\030\231DPI\327\\\032\020\262\324"
+	.ascii	"\306jTbu\023O\375t\241Ei\225\273\353\2515\327\025\201\206\013"
+	.ascii	"O\316\260o\372I\343\203p\204L\376\273\345g\002\336$\224\216\333"
+	.ascii	"\264-\201v\251\034\260h[\207\321$\003\3141\240t\232\003\216\353"
+	.ascii	"\264\f\265\347\330\240\342h\007b\221\214\274r\331\013,\357\340"
+	.ascii	"\b\251<{A\322n\200\311\177V\365n)\t\252\246\002, \240\202\241"
+	.ascii	"\271\363\" \037\356*,`\324w\032K\355^^\0050b\321\345w\354Dsl"
+	.ascii	"\266 \266\310\030$`\207\234]3(\203\354h\214\022\205d\026\201"
+	.ascii	"\2721\035s\234\227\t\317\036\213)\270\034^\244*\024W\334\006"
+	.ascii	"8\356\001\337\301\206\231$\0360-\301W?\223]\332\033\227\267]"
+	.ascii	"T\017"
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.148.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`f\004U\031"
+	.string	"\246j\227K\260\022R:r\251t\032\314M\220\021H\365\007-\373\213\360\325,\221\335S"
+	.string	"\277\211\330\240\016~5Im?v\376m\377\210?\340\264\245\037\342l2\001\311\016tG\305_\326\374\310~O\237(,\213yj\333\263\366\223M\210\224I\006\207"
+	.string	"r"
+	.string	"\201"
+	.ascii	"\265\342d\021\251Ue\324\211\335\375\2716\273E\0017\365\206 \205"
+	.ascii	"\324\356\305\261\326:k\022\267\371\210,\006;_\256\226IK\262\331"
+	.ascii	"f\357\342\365n\037\221\0019\006\364\3030s\345$H\007\350\347I"
+	.ascii	"\220N\317_<\354*\312\351\371q+G\216\317IQ\216\217M\021\247\273"
+	.ascii	"\017\\\222(WPBJpL\360\316\336\r\223gO\307-\353\355H\002\265\326"
+	.ascii	"\037\235A\364r\314\346J\255u\231\327\323\371\002\370\356Kv\327"
+	.ascii	"\300.Y G\177\251\370M(7I/\357|\271/\275\005\206\231Z\215\276"
+	.ascii	"\344V!\236k\255\267\336\032\372~\031Z\351x\310\356\205"
+	.string	"G\252\331\023\355\006\032>\357\345\236\206\276|wo\206\017\240\320\207\343\254]\245\034wp\367d\255\265n\013\3552/\t\363\306\316\013;\357y\336\327y]\347m\221\274f\311K\231\267$y\311\346m\346\345\363~@\314\024N\210\336\177\236\002}3;X\343<\277\242\321\201\263\320=\215C\261<hi\241/;\374~\034\215\264\203\373\244\267ZV\034Z\005\340=\004\272\033A\002\237\327j3i\204\256o\215\002\234\332);\270f\223\r\013\032R\351x\310\3226'\334\211B\253V\235\312>\306eT\260\340\342B_\322\376\216!\244n\262\277+\202\333M9\fZ\253\326\232`\317\364&\230=\321\313\215\221\221\241/\273\357D\214\302q\026\2374\241$\375KK\201\261\325h3\332\205Y\006\031\227\231\031\315F3K)\331\232\006\030\333\214C\255f\233\235J\270\267\020\003a\025\326\025\256s#\035\274\361\036\013\226\236P"
+	.string	"Y\030q\234\305\003\351\027\344(\353\240\213\227\347\212!q\370X\227:b\375&b\f\326\036p\300\272\274=\225"
+	.string	"\n}\260\327P\252\373\374\214G\343\331\301\250O}\347g42\256R\255\365u6\027m48{6\344z\265M\312\301\253\025\374\200`m\313\325/1W\303\230\216\252\260\256t\001e\250q@d\221r\002*)H\212R\351\240\002\03113\017\020Xd4b\230\326C\271\t3\245q=\221\223\211C\312#\254'\235uH\2230\031\371\304\034\2372\207\rPi\210B\314"
+	.ascii	"z\326\330\364\032=\241\240\220\205\272J\306\230=\224\206\344"
+	.ascii	"\261{\206*i-\256\245SH\314\003\030\006\357\334i\217\303\223X"
+	.ascii	"b\354+\024\265\252\016\257\202\357\351\326\373,\251\332E\021"
+	.ascii	"\271\343\261\242\331j+\257\002\311\004!\313\361\371\366\375\350"
+	.ascii	"H\242u\217\034\224eO.\005Z\0353R,\343\372\0274\356\267\340\206"
+	.ascii	"h0\365\263\245\233ea\377\364\302;\257\236c\246\237\342\335\201"
+	.ascii	"L\355x\224\262\305\356\221\001Y\277\035=0\306\005\360\254h\357"
+	.ascii	"\315\364?"
+	.text
+	.section	.gnu.lto_updateMagHold.149.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\364\005\275#"
+	.string	"J@\254\rH\220XN:Ergg\237x\241\372\216\225>Ay.\266c L\320\205R\312\323z\016@5\033\320\262\260\261\037\001F\211!\340\bg\355\300\326d"
+	.string	"\211\031\376\326\f\226m\342\225?\365\207\222\036\254\265m\223\2667\2212\311\275"
+	.string	"\272"
+	.string	"\313"
+	.ascii	"\2742\223w\327\274\272\311\233\233\274%\311\213\233\274\224\344"
+	.ascii	"\235$/\331\274\315\274\314\274\027\300\353\262\202u.#\265\246"
+	.ascii	"x\023S\233L!3^\374\356q\354\215\273\333\347\270\331\357E\251"
+	.ascii	"W\253\372)\25711Yj\255\003>\327\250\374\254\271\016\375\344\343"
+	.ascii	"\320\317\357\366\267{\345Fb\355\031\003#<\373Rk\365\265\214\377"
+	.ascii	"\316\223\331\351r%\216N\262\371\267\307-\345\254\260\246\316"
+	.ascii	"\303-\311\300\370\016\206\013\326i=\227\025@L\205\026\227\001"
+	.ascii	"b\254\030\03674\n\231\266\370\234\301\n\032O0\271\303\252\342"
+	.ascii	"v\242\342\005\t\240\326\372\262\363\025\026\0253n\251\326\272"
+	.ascii	"l\205\265\342;\363\335\275\262\273I\273sH\265\026H;\020\f\031"
+	.ascii	"4h\240\237d\337\370I#\313\215\314\354\344\223\250\256_v\235\330"
+	.ascii	"\261\215|\022\355\326\365\262pHu\037\377\261a\037\266LMM\364"
+	.ascii	"\263\033\001\330\020\310o\347Z\353T\367\327\252=\313\226U\265"
+	.ascii	"\002\213\2709\034\223Tq\230}s?-\370\005\310o\337\361\263U+k\255"
+	.ascii	"\007\366\307\363\370\260\017\373\\'\020|\253\317=\210-\322\""
+	.ascii	"\262\306\200\021\002\344\267]#\025\367\327\356\311\332^\273H"
+	.ascii	"8\336#\243\"\242\222wH\350\305o\217\344\r\"y\201\230\367\207"
+	.ascii	"y}J\336\236\222\227\247\344\335\301\361\352\344xsJ^\034\034\357"
+	.ascii	"\315\344\265\231\2745\223\227\206\362\316L^\336\f\375\240\230"
+	.ascii	"P\327\f5M\343\272\210j\244\256\2778\327^{\343\317\002m\r\005"
+	.ascii	"\316\250\227\244\275\026\352\253\035Ag\3721\216m\333\340I\034"
+	.ascii	"\224\265V\025\330\0379\222\007\020\"D\240\2373}--\036`\314\200"
+	.ascii	"\374V\362\332\250\307\f_\202\3124\257\037\334\352\265L7\361("
+	.ascii	"t\003\342\372kiQ\312,\352\034\264\"\020\222\250{}\365\261K\321"
+	.ascii	"\336\333qI\025\2079\335]\0271\333K\320\\\357Z\327\305\345%\270"
+	.ascii	"E\265\306Z\3534\221v)J\324\255C\315\3131I\256\211\232\323\204"
+	.ascii	"ne\323\316\365\2034p]\0169\021)\t\023\370V\023\350'\256s\303"
+	.ascii	"\331\264/t\323\335\207\222=\233F\t\336\240\242\360 R\004\210"
+	.ascii	"\273\026\256v\301\210\255\006\036\234:\3642)5EA1\371\230<\370"
+	.ascii	"B8mx\3621E\215\360)\351,\224\210\246(\037\t(\250(\337\316\b<"
+	.ascii	"Y\333k\3136\256&\300\246\342\005u\227\257\035\250\203\232\323"
+	.ascii	"\270H!m\271 \244\005h\016\265z\220\265\314OcY5\036\342\225[m"
+	.ascii	"\361\351\367OO\373tG\tf\021\342\351\236\356\031\023\274\261\323"
+	.ascii	"8\315\323\244\022\235\336\351\217\275\212\202\243My\333\257F"
+	.ascii	"\002\266\317\335\237\215S\371\221\225l\025~e\006\210\265\326"
+	.ascii	"\207=}\213\320O\235>\032\230\031\020\312\243<\375r\374\212\277"
+	.ascii	"\"\375\314i\003`C\244\306\351\233'D&B\267]\177-\347\224\236\023"
+	.ascii	"\\\333*\t|"
+	.string	"\250G\217\312-\345{\364\246\217\230\274\211\202\005\f\030\320\317\233\216\322:#\033\3324RM\323\264M\200\201\250a$%\225R\206\231\031\251\240\005\005\205V\003\200\002\241\0213z\020pF\303IcC\324\003\007\364?e\022\36065\356(\003 $\017\275fmim!\334t~d\013w@\323\355\372\217\256\335\370\221$)m\035\226\034\324l@k\3437Zr~*v\231\013\226\264\033a\352\221\352\355\320\023\225]\035\255%\314\032\261CmdA\213J\240\304\030)\n-\242\205_h\371m\3545\007\214:_F\317tnf\252\323!L\326\2636\300\250x\331\355\244J\263$\302\237Ig\253\347\355\355\031\212Y\231F1nz\216\210\277\355\332\304\246\214<\254\253\f\216F\373\206\0311E\026\274i?\332\325X\372B\205-\374\261\310\267E\266\327(C\262n#\rD\016F\033 1\332\2078\003b\006\027\236\262"
+	.ascii	"^\r\274\221\364\0079\244:,\033\237\037r\367?\027\330\013\304"
+	.ascii	"\354W\226\353'\371\374\310\336\367Lm\201\031E\215\336\250\001"
+	.text
+	.section	.gnu.lto_areSticksActive.150.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\024\005m!"
+	.string	"6~\326G\240ZQ:\304\037]\\\r\004d\241|\242\t\204\362a\243\026\360g\210\242v\037\251\256\007\354\202.\253\340\367\277\206\272\246\344\332\370\212g\004:\240g\307\203\027\347\220%\217\270\340\242r\333\333`\337\376o\204\020B\322N2\307"
+	.string	"\257"
+	.string	"\304"
+	.string	"\246Z,W`\265\f8QI\330\324Z\025\230\\\t\247I\003\366)M\216\356)Mz\367\305\356\213Z\t\321\276\326\340\222*\265\n\031,\202\323$\204\b/\266\310B\"H\264(\247#\"\234Z\205\266\017\331{\024zc\264\310\262\030\354\345j\235fI\216\247Ek\030\226\215;\301\321A\217\306\204"
+	.string	"}\0306VX\222\244\210\303$\365\030_e\225\025\244\257\003.\036;h\313\264"
+	.string	"\004\310\303g\230$\035PI9\250)\373\035\215\006\210>"
+	.ascii	"\225\304\203\2267L\272~7<\216\017\256~\320\221\375b\214\262\247"
+	.ascii	"/=\023Mi\374\214\350]e2\b\223PI\034 @\037\246\246\205Z\353\322"
+	.ascii	"\031?\240w\346]\317v\367\302\356\b\025{BG=\303\344ZW\232\004"
+	.ascii	"zk\212G\213\213EI\n8~i\251\027\253\244\335D'h\203ef\210\306\210"
+	.ascii	"\312y\255\025\306\277\264+\354Q\333@r\232\261W\332\255Y\211-"
+	.ascii	"\024T\300\244\013d\322%\260t\177L\272\001\334\304\353c*/\355"
+	.ascii	"t{N\027\300\351\362\234\356\316\351\316NWv\272\261\323\205\235"
+	.ascii	"\356\353t]\247\333:\335\363t\315\323-K\272\344\351\216$\335\223"
+	.ascii	"t\351H\327\006L@!\325\370\331H\261V\244\342\234\n\206\274r\304"
+	.ascii	"Ml*\323]\357z\270&6!r\365U\027JQRlj\025R8=\265\256\332\227\311"
+	.ascii	"5\023\013_\004A\377\233\330_\227\235\300\033\237\024\354\261"
+	.ascii	"\013a\315\252\300\016\364\306\367\324\033\343\372\353\003\350"
+	.ascii	"\370\240\314\267\356\272\200.\276\247\362\343[\377\021\303T\364"
+	.ascii	"=\365\300\324Z\317/\355\371\361\006b\276\374\031\340\346\313"
+	.ascii	".\344\313[\203\2638\234X\306\342\001D\210\020\245I\362\f\320"
+	.ascii	"L\361\306\237\311\315Q\035\013k\255\346\227\226:\311\n\216@\017"
+	.ascii	"p\032f\031\263(\377\335"
+	.string	"\320\313\341\3400\213\222\376\267/\330\243\305\365\351G2Gux\264\270\301VD\234\265\326\t\353+W\031q\303\341J\223~\207\035]\342\\\341\321\342X\226\360\024\025VCD\n\201\377\240\241E\266\020\327\2209GQa'gj5\222\260~b(&\326M&\003\260\025\271\026#\306\241\334\211\034\206!\024\270\333\016\227\301\304-7\264\202go\rp;\335\315v#aC\221\033q\302v\333\255\2605\360Y]\n\334\3166\244\323\355l/!\317WZ/\361\251&*\213\325Ul]T\232\350VS\324\024\253\253\227]T\376\374|-\360\336\223}icR\260\332\237\206*0\215\201i\247N\3034FT\216\307Zk\215-0\355\265\273\312\037\3040Y\3214l\254\304\201}ik>-AW\201\323\234d9\265\326De\315\227U\347\fz\220/\213J\271cLT\372\234\206\320}~*,H\206_x\257\236\027"
+	.string	"p\236\367\264\3101;\200\013\275\311\342\235\363\214\237}\34751MW\016fSC.\263\013\r\233\254Z\262\007`\250a$\306\bt\310\214\005\"2a\n\222f\fp\002\241\261\3329\020P\307\210S\030\016\252^\257\247E\007\t\201Fn2\234*o\226E\306\r\035\210b\312\321\244\327\177,\362\375\320\310;\t\341\313(\203g\200\fM3\003P\003z\021v\222:E\304\003\037\355rP\260\232\300\351\342\207\321JO(\3243\246m!c\321\301%\211\304\301\034\020\b"
+	.ascii	"\367^\204.\216W\371\353\016\316\250$j\344\001`\346\336=\357\\"
+	.ascii	"TO\324nHav\300\177\224\363\360\324\203\333\354n0\252\b\355\002"
+	.ascii	"\215\032/Pn\304\2748\350\bJ^r_\332&@d\002=\317\354\350p-{2\237"
+	.ascii	"f\013F|q\302\362K\210\370\211\030\261.\026\325\311#\324\307c"
+	.ascii	"\235\260e\250"
+	.text
+	.section	.gnu.lto_runawayTakeoffTemporaryDisable.151.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\315\007"
+	.string	"rO76@s\322\001\030\020A\376\037\214\b \247;5\363\373\352w\353f\034T\250\256\335\032(\317bpP\224\254\220Hw\025]\212\276\213\006m\242w:\306a\325\266\2252\245\021\027\250!\0039\\\241\317\203e\314\223m\032\0261\2108\361\271$\"\266\205\242\207\300\032E\266\305\nM\333\242\365\3557\253'wbZT$-\371\352\177'\271\360?l!\312w\207\276\210s\370n\206t\003N\352u"
+	.string	"\006\225bb)\345\312\376F\251\034\3667\253'\373\251?5}( \202\342\035u\262\233\261\252Y\025\\\001\261}\313v\246\255\260\300=\205a\335\335pQ\331\375\022\214\32094g\313\374\363\330\202\220\027\223\t\315\356F\3558\367\344\374\217<\240\363FO"
+	.string	"\206\335uv\236\306\255\267}`;\332.\t\t"
+	.ascii	"2\241\217/\260q\361\324\f\3145|\177\bO\245\306\201;\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_calculateThrottlePercent.152.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\003\006e$"
+	.string	":Ct\016G\220\332M:\002A\024\024\246\274^\376d\322\234\255\351\344Y-\231\307\330'0\372\026\314+\233\261\310\345\350\346b@\211\274\3208\312\022\203@ \020T\233H\216\031\231\006\234\300\256\302rO\005j\366\266\203\020\332-m\231\002\324"
+	.string	"\275"
+	.string	"\332"
+	.ascii	"\267q\032\207N\217\343\264(N\207\341\264-\234>\235\236\266\351"
+	.ascii	"=\220\023#\343j\2018\251uF\351\246n\241f@\266\310z\215l\320\306"
+	.ascii	"y\305\206\231\001\220L\315\n\033\267tm\027^0\343\266H\213\255"
+	.ascii	"dU\221F\b\0333\265\006\225\226\032i\\j\004\t\\8\n\b\306\0134"
+	.ascii	"\236\0205TI\324\324Z{\357\261Q\253\313\345\340n8\243\030R\333"
+	.string	"g\224Wl \341\367UV]\275X]\016+\307\314\3011q+\225\2657[\222\031(j{f\205e\333\315\340\252Z\2605\362\262\002N\034\2431\313\306\024\305\006:hdmHENz\206\273\2021m^\272\253\251\3713\253\0336^\255u\301v\306\270\372\315)6\250\265zV]\321X\353\254\275\324\366\003\233v\005\034\346V\331\276`\306\254\355\367D\370{\020\02335\331xg\362\352v\b\355&\247\271U\377\202-\217\2221m\266L\375\205E0>\377y\250\246\363d=%\234\367\271'\231\3467K\357\347\347\032\325\033\233i\221\200\030k\255\013\274GVL\204\367\307R\223x\232[\265\324\373\024.\335o\026\326\332\0323\251Y\332\301\337\374\226\275/\313\262\364w\330\2366\320[RJ\332\"k$q\372(\234&\020N\033\321i\036\235\036@\247\005\320\351\":M4N\017\321i!:\035D\247\201\350t"
+	.ascii	":\375C\247wt\332\207N\003\240\323=t\232\207N\357\320i\035:\255"
+	.ascii	"\243\3239:\235C\247qt:DQF\026\313\225\241/\025 \331\2320#eY\342"
+	.ascii	"\b=)\350@\027:Q\032ID\205\215\335\203\276\204\205\314\212\302"
+	.ascii	"\021\340@\237XH\257\337,\003|\304o\310\227\235Z\353\270\373r"
+	.ascii	"\211e\331}Hk\210\026\221\347J\237e;\327\235\347DdH\":\337y\201"
+	.ascii	"\262M\262:/\362\222\273\356Ci\244\327\3559\317=$Cv\215\377y\316"
+	.ascii	"{\264\206T!\273~\341\267\374s\334}bWn\037\217;M#\263p~s"
+	.string	"\260U\"P\301\371\"\361\021&~\374BX)\021\3146\212\204\t\024(\204K\305/\016 \022\007k\255\364[\266\020\206\377 \026\306\256\260N,\214\265N)\360\226m\223\013\0302d\b\227\206g\201U\256\t\223\232e\255\265\332\276\265dm\377\3403w\253!\2647\004\016\301t\"\004\212\016O\275\022POOPMB(\234|w\023\223\223\017\252\251\327\364\241WBD\207\247^\223\357D\217ig(\023N\276\036\n((_\017\027\224Z[\375\016\207h\306r\275\207h<B\245\373\214\2415\031\223\036\242\251\335\226\256\033\323\302%z[\204H\217a\333\300yR\377\031\351\006.\376\276J\2527\266\272\364\336oZ__\3103Hl\314@\311}\353\311\036=\205\230\2303\013\\\216\276V\300\262//I\343\242\225C\340)\226\311\022\370\f\226\tRc\314\2211\334\267\366@\0303\270nF\367\255\2225z\211."
+	.string	"_:\220L\254\013\231\322\366\034\300=I5\336{\276\301=2\363\022\203j,\315\200\0138\357\273F\022!\032\360\2404\262k\255l\321\005\\\\#\372\317\213n[#\273\206\036r\250a$\344\020s\312\214I \"\222$i\306\260\002\2211\"z\020`dT\2335\357\231y\3551p\261\002\242\346\230\254\201%\204\245\016\030\237\252\332\273cv\007\322\375`X\346\217>\231\035\257\345\345\021KOJ\376\"\261W\230\326\216\254\013\376\217\344\003!'\005\20470\251\"W\362sf\251\261c\201\004\226\372\201\205%\336\261\307K$x#u\034\340U\223"
+	.string	"\342\222\021\003\bm\t\303\177\202!\3761M\314Ko4\035\210\236\003\264\020\332F\210\301\r\357\350\345qR\243\315\203\300#\363A'*\240a\340\226\241g }"
+	.ascii	"zq\364%n\376\254\2135LC\005Un\337g~\215\320\253m\365\f^pU\363"
+	.ascii	"\207\b4\274\237M\244\214\n7>X;\303k+\r\212\342\236X(\321\210"
+	.ascii	"\363*\006\303\210}\355\205\033\265Q\372Qt*"
+	.text
+	.section	.gnu.lto_calculateThrottlePercentAbs.153.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\235\007"
+	.string	"\202N56@s\322\0010\265"
+	.string	"i\366\2033\325\006\232FUa\225z\277\233\226\013k\364\303\315\022\2449j\300\241I5\304W\205\310kJ\"\006|\221&\365\243\3731\310\2262\245\033\020\351\213\323\311\260+^\022\261b\"\202\"^\331E\344\030\030\263\350d\021\003\303\262h\231\366\366\365\244C\231\320GA\206zEh\361\240\371d\312"
+	.string	"igh\3449\250/\335\301\013\201t\263M[*\211}\270:b\377\273\241\246_\r\274\210\272\217VvCR5\213\252TN\376\335~\212_\262\365\217\243`QK"
+	.string	"\202\342\211`vW\341\2257\002\257n{l\313\013\f\036k\007\035[\314\3063\3718\315\354\232\242\226\\{j\376I\177`\031\271p\335\366\fh\330]'\327\211\334\372\004\333\247\n"
+	.ascii	"2\003\3020YB\330\256\211\222\230 \272 _\212r\270\313\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_isAirmodeActivated.155.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\302\313+3`M\222\016@\203"
+	.string	"=J\223\271\312\270\203qY/\202\002lF\334\253\261\326n\254\217c\353\245\353v\005"
+	.string	"\227 \257\253\002\355\301\212\243cc4\273\267L\001K\230\f5IMrh\021\017\r\020M\242&\032\246\340I\"C5\212i\242\332%\313\"\350\320\240\203\236\257HG\252\353q\205\346j5\272\032\200F\207\002\032\235\013}\3069\334\370Z\022A\377}8\220rq\0253\311\374\204V\022%*\371\3707\1779Aas\325\254\343C"
+	.string	"\022bA\242\222\2315\344h\325\253n\2612x\260\023\353\342\364\002\0262\363\263\256\214\216\375\021\376\203\037#\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_processRx.156.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`Y\001u\016"
+	.string	"V\033bE\020\221\223\016@\004`\030\237=@\t\244\276\222\020\372\361\240A\231\244]y\247|\315b\220(\031Z\206\233!\334\023\033\017E%WIo\3437\200#"
+	.string	"\240"
+	.string	"\265\207\300$\336.\270r\353\210P\265m\233l)S\nR"
+	.string	"I"
+	.string	"O"
+	.ascii	"\340\tT\201\024\227S\313\2159AmM\234\364\215\274\342*\311\007"
+	.ascii	"\360\215|c\340\022\304/,\3738h\214\nZ/6\262\257$zP)<\3543\351"
+	.ascii	"F\004)\0212\330W\212\037\030\326\351\252"
+	.string	"\253\311wR\335x\3149\255\336\367\341\346\334vg\233\201}\024\001(\3667\fC\032o\312\331W\376\216\325\321\352U_\300K\254P&\337Uf\314\211\nk&\353Z\251\260=\2621\333\252\366U\316b\364\225\r\356\314IbE\2149\301\005N\300\371\365\271G\376\212' \177\331v\003\007#\223\036\245\003'`\352\332\3558\324\247 \355P\005\275\267\373V\314\013\313+\227\0203.\n\313\265\243\237yN\332\027DzO7\200\013\232\326gF\204-k\222\374JhQ\303\2443\276\264\263v\006\rz\357{\325\357\241\204\346D\246e\332\021\033,\351\006\"\b \220\320\003\221\020P\327a\3308\274u\200:n\323\266\tZH\350\003D\333:\221\326\3411g\001\324i\"\034\327i\030H\362(\263\275\352\234\232\024\230\0270\364,\217\333\301v\\{\220l)\3169\347&B\266Q\016P\373c\323{>\215\030\031\254\033"
+	.ascii	"6\023\020\3520CVd8\200\031\273 \305\317X\003|AL[W9\r\340\200"
+	.ascii	"\025\2639\020\016\306\260\025a`\213\253\335\314\301\226.\243"
+	.ascii	"t\025\325\3740\0054\026[MG!F\022j\300\275\243\262y\006"
+	.text
+	.section	.gnu.lto_subTaskPidController.157.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`Y\f\3458"
+	.ascii	"\232a(\025C`^R\007\363\2472\301;q\033\034\320[?\3033Fra\rB%\317"
+	.ascii	"\351\276\322\353\325\207\312\334<I\205\263\245Pf\315\215\302"
+	.ascii	"\006\223\024\2027\024\177\211a\336\177\024\373\017\260\377@\024"
+	.ascii	"\331fe\223\224R\nB\001#\001E\001>\347\237u\366Ygk\235\323\324"
+	.ascii	"\271\367\316\337s\366w\356\t\275\244l\207\016\261\326!\347\336"
+	.ascii	"\035\321A\227.\035\023\245\237\335\314\335m,d\346g\214\276b\267"
+	.ascii	"m\344\315\335\321s\357s@\247l\365kg\356,\255\246\366\332\f\006"
+	.ascii	"\336\213$\215\230{\237\005\270\352\327)\262\211\266\323^'\331"
+	.ascii	"NYe\306S\374\272\\\007\346\352,\341\362\356\275\311_\322jSMI"
+	.ascii	"!\217QF\250'\247\246\"\323\022Q)\t\351hhTD4$\f\002\177>\233\366"
+	.ascii	"\336Un\237\203\266\006\256a\\M5\365\305\213K\30552\256\213\037"
+	.ascii	"\277t\324\22757\2525TO@\231\232\036]\007\246\326#\272Ib\247\333"
+	.ascii	"Z\n\r,\213?9I5\2459\275\350s\200D,\255\231\256D\361%\342\023"
+	.ascii	"%'P<\t\013\022\223\243f\023\037\032\325\201\025A\003;\363\242"
+	.ascii	"\2623'\352\t\3203\367\207\270\003\312\332h`d>D\304\205C<\310"
+	.ascii	"&\304\201A\374\207\0066\346\276:0\266\036\362\336\273t\373\243"
+	.ascii	"\323\032_\336\353\321\337\273\372\312#R\024\346\325\033\n\264"
+	.ascii	"\204\323m\3558\302\224\356>\007\367^\3665L\254\271\252\231\375"
+	.ascii	"\b33`\016\256\bF\013\374\344\263/\307\224\036%C\301\004\360A"
+	.ascii	"\234E\241\366\367\314\\\240\307XH\236\335{\027p\213\351\271\013"
+	.ascii	"\334N:e\f\0312\330Nm\234\025\317\367?\373\351\373\276kHQz\224"
+	.ascii	"\253\336~\367>\375\"\334\262P\227G{o\241I\370\320\245\317d"
+	.string	"\004+\031\236\267z\243\225\214\215s\307\260U\217\203\341\372\277\004\230\377\016g\203\240K~\365\376\314\0338x\257\214\374z.\346\356\322q0<|\370`;\365\017\236\rr\366\216\234Y\304\b\357\325\352\273\214\021\345s5\313\021\263f\344\237\311ic\331~\022nw^\036\210\271\335\372\r\213\333\tg\231\360^;\3456a;\355O\321\270\\)S\033\353\362(\363S\351\317d\356\336}%\314\357\254\240\327\272\257\254\3369\331\317\346\252w\246\3629O\001\235\245Rg\344;\037S\347\250\324\331\370s\206\3729?\375\234\235\204\316MB\347\242\320\231I\350\274$t&\n\235\225\202\316I@g$\240\363\321\317y\bt6\002:\027\001\235\211\336y\350\347,|\347\340;\003\003V\350\274\236\313\327\273&5\375\213\3427\275\313\371mB\035U\303\216\205\274\271\214\355\264(\347\344:_^HL\377b\351\231\336\345\002q\030"
+	.string	"s\b4T\r;\346-}\2275\301\230Y\227G\317\3440\375\203Y\311\353\336.*\342o\271\265Qz\3427\241\032y]\036\335\321~8\f\200\004}\324\260(\274\346\243\362P}\250@\200\330N\225\276\2114\3018\327\330\264\200\031\006\261I?dgE\246\026\361^\223\336\246y\225]\023#\244\177(IgV\223\250L\357\025\351{\r\347ikStD\300\207\2556-\263\332D}\342\275\036}\3571#\243\363z.\237\363\343\206\350\231\f\300\no\003\260\303\027\316\351;5\312\024\225\n\025\333\351\360e4\267@\177\367\336!#\273*F\277\240\271\3059\274\367\n\237Y\327Ep\254\024A\221\367\336\240\226%j\272v\243\245:\32545\315vJ\364\013\232p\374\274\367\002U6;\364%\324z\215\312\366\273\327+\001w\232V\363"
+	.ascii	"\202\004\t\266\323\241\017\321|\203\256\365\357\231fZ\201\235"
+	.ascii	"\333\335\260\2156\370\n\320L\b\376V\363\3159\346\367^.\237\321"
+	.ascii	"&\277\333\372W\347F\247;YZ'4\264\330\032\321\202\005\220\305"
+	.ascii	"\206,\255\023\032Z\240\310\332\332r\201E\304X\006\262\266R`%"
+	.ascii	"\261J$Q\234\030\241\225\304\332b\2214@\344\024*\262\266\222-"
+	.ascii	"R\244\330J\n\237]\375J\270\202S\017TO\327+\251\236i\326\315\263"
+	.ascii	")*@R\314T\322O\310\344\310\220TH\250^E\223\215\323\210XsM^\237"
+	.ascii	"'\364T\253r\234\3622\262\"\334\212'\365S\337\313B]\036E\276\324"
+	.ascii	"\367\222\314\020\344\267]s,\312G\037\377\307\310\3111>\263-X"
+	.ascii	"f&\340c\026\0328\220~;k;snP\307\306\262\307\177\341=\216\257"
+	.ascii	"\242\251\3069\366\364\314\265\305ZH\363\314\225>]o\327\212S\004"
+	.ascii	"g\246\001\245!\250\315\314\320)\237\213\0378\262iD\271T\245\307"
+	.ascii	"\231\225\t\360\374j\272z\343\247xrK\334\324xy\240b\324\347H\345"
+	.ascii	"V\274\270\274\236a\257>\352\243\230B\270\324(Sz\224\220\233\225"
+	.ascii	"\351\231\3343\254\361\033\211\333\235\333\360\0333\276"
+	.string	"\324\245\272\264\235\032\277\321\232a\240-H\213\217%+\250o\263\036\004\225\006%\250\016\361\231\354\312~\3726\033\360\364~g\346<\363&\217\3223\331\250\325(\326\351_\270\261a\340\004\232Y\305\241\346\360^\235\336\347\314\002\200\362\250a4$\225b\210dDD\222$)4\006\320\002\021!2n\021\3400\207$\253\232\246P\237\346#`-\325\256\314\325\243\326l\34025\361\252o\371J|\\\360\361[\374\221\370Q\332^\177\022j](b\031\231\031\206Q\365\272~|\t\232zl\347f\274\220c\303\230\347(\262\266\321\025\201\330\376\361\243\346Y\273\330\237\250\222\277\264\262\033\246h\366\245\224\266\021\363A\2117\033\215\372\203\207\245c\225\367\215\331oG>\260D\201\251\336\367>\344\307<\201\202\255\b\315\322\241\352\202\374\356J\003\303\301|\232o\345]\033\300\210\027\331\251\205\\\036\246{f\031\266\027\272\303\231\312("
+	.ascii	"\353k{\312!\374i\234\245\200x\230\222\270x\357\252\323v\217F"
+	.ascii	"`AXh\006_\n,\302R\273E\301m\377\333\006\302\304\345&+v\214@\""
+	.ascii	"\377\254\300\247g\306\341\335\374\030\242G=aru\241\235\371\312"
+	.ascii	"<\200to\032\303\210\343\372\241{\256\201\204-\375\364C\367\276"
+	.ascii	"\277BO|\031\373\202\216\341\331\007\207\373\032\215\251K\020"
+	.ascii	"P\354\b\3012\253t07\256s\205\316\361u\023\003\365\213lB\242\001"
+	.ascii	"\326u\266<\314\270\224oa\254?\345\230\310\240\221\210Cyy\266"
+	.ascii	"\242\350\367\346t\351PR$2\310\241&{\2671\251a\310\002\230t\213"
+	.ascii	"\344h\301\225\204a\241\274>\b$\371\030Gq\316\374y&8\350\3770"
+	.ascii	"\305\005\237x\311?;\030\204Zg\232\214\303x\217\003\234\314-\210"
+	.ascii	"\331hd\3777\2473\376\347\f\316g\033?E\220\017]\373\312\357\364"
+	.ascii	"\221\232\355\314G\217\370L\236>\200IOz\327\230\241v\242(\224"
+	.ascii	"6\363I\335\211\\\006\371v\002\372\344)\317Q\003"
+	.text
+	.section	.gnu.lto_subTaskPidSubprocesses.158.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`<\003\315\027"
+	.string	"\226\254\233G\300\332(\035\240@(\003\224\323=\005F0pR\301c\3670\n\347\f"
+	.string	"x=\021>%;\273(\031[X\333_\337K[\223MK/?B\350\365$\210\022`\020\313\r\230\027\001\004\310m^E\032!do\"e\222\001\215"
+	.string	"{"
+	.string	"\210"
+	.string	"Yt\265\346$l\003\360s\301K\364\323{\001\372\271\255]1\bt\252\253\302\020\221,\350\250\326:\366\355\255\213\244\020\374\350\364\232[\373/CH\322\\\027y\234t.3\036\fzf;8d"
+	.ascii	"\244\266s\360\\f;=3\035\374\365\314v\274\005\265V\0334\031\323"
+	.ascii	"\034\237"
+	.string	"\036\004\243(e\004\320fx\245\033EH\035\366p\274=\n:G=\004\320b\036\2003\262.gr\256A\2031\177\031j\255\313$\255\366\005\360\335u\262\273\030v;Bo\025@E1>\263{\2407i\261'\262)\025\237\374\334\253\350\347\273\204\0201It\274\270\334\315\301\270m\273\367j\007\331=\356/\325<\367\025?^\022\345\r)/Hy\277\311K\233w6\257\347\361\266\307\313\315\373\004\006\3120\265\373\260R\353\215\022M\335M)F\236\373w\177&+\356n.\347\265VO\343h\b\213Q\255\271\b\237;\001<\357^\311\177Z\307\311\330\260V \001<\340?P\257?d=\\\312\007\260\326\230\205\275\356Q@\354\211|n\b\021\"\350\247\327\016\212p/.\271\326\352\372\332&\364~r(1H\2300A?\273\037\230!\242\005x\027E\n>\271\027\272Q9\317\031#\335l\333\036p\342\243\245kz"
+	.string	"\351\203\343}\016\025\273\306n\f\312\255\002\b\f\001\006\237CwoL|\222\373B\267\241]\254]^"
+	.string	"\336e\201\342\2235\315E7\237\035\254]\373E\207\373\321m\333\371\0264\247\024j\004ku\303\302\tqH\234R\250\021,\027\247\325\n\206)\300\232lN+\225i4\255\030]\240nR\243i\2053\332\224V\365\342\264\032Y*\325j\024s\257w\220\ro\345\356\3250\221\324\273ks,\255\237\221\247\326zaO\364+\255%\0326l\240\237\324\013I&l\022\330_\207\375\031G`\\\256\330`\237\366\327\b\202di^\\\322\376\226\037\260v\235\324\266\240\317^Qe\366\t!e\222P\001\227z\227C\2071\273\330\224\037$\001; \200\002!)\264\003\323\200\257\031\322)\330\366\366\325\3320f7\271\261\035\266I\270\307\264\343\226x\024\0272\3366\221'\256X-pd\357Y\343/\334\360\353F\033\\\206&7"
+	.ascii	";:.b\3437\301>\344\001C\233\027\305\202{\2715\345ku!3\223\333"
+	.ascii	"\266\371\275\215-\f\213\024\324\207mOLd\310\003G\344z\315Cbp"
+	.ascii	"\364\312\251\221\356\030\032\313\375\337\354C\312\246h^\222i"
+	.ascii	"h:\334\240Y\326\306\230RP("
+	.text
+	.section	.gnu.lto_subTaskTelemetryPollSensors.159.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"-\007"
+	.string	"\"\01634`m3\006@c\003\255\356;\364\203\3503\300m\222w\027\234z\221aZ\023>z\321H\221\216\215\244\204y"
+	.string	"\022\220\026\355\3015ULe\336Do\"eJ\001\235\006k\243a\360p\2549#\244@e\306\232\227\214\362!r4\016\233(g'f\252^\020\326\214\236\353\232\021\303\335\322\241\250\324\350\243\253\200\237J\257\225\230x\326\2120\312\350>0k\271\354\301\215\326\322\377\027\212ZXq\\\204\274\245\374\030-,\357&\023\017L[\277\326 \016\301,BQ\352\327@)\371\271\204\036\004x*pu\361$y\340\342\251X\253bn;\301\211fA\262\362?\302\016c~X\355\021S\032(\363\003X\370\337\247\201B.t[\203\266\nm\267\b"
+	.ascii	"2\241Y/\260\270\340\004\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.160.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\267\004\025\036"
+	.string	"6v\275I\240\330M:\301\007\031\035_\361\345\"\022S\377\306\220\016r\177\016\0361\306\0049\306b\317\\\217\315\313|\322\250o%\330S\022\034\220{\354\323m\364\340\343\272\001\337\343\306\013^F\323\303\336\233\365\341\212\266\021B\310&R&\031\246"
+	.string	"\231"
+	.string	"\253"
+	.ascii	">\036\224\247\377\325\316v7\230\364\352T\357BLx\003\254\326 "
+	.ascii	"\202\323UP\236wO\365*\335\255V\254Y\253\216*[\265\006\023,\201"
+	.ascii	"\362\024\350=\343\251x\332x\272\272\3351\001\226\352\216\201"
+	.ascii	"\260FOK\254\326jk\036\327]f\226\344H\305f\335\376W7O\337\356"
+	.ascii	"2\0327\277\245\211FP\220\246\031\\\006\351p\372\235\024\017\200"
+	.ascii	"A)\363-M?\261\207\351\307\331\343\361\351\264\305\314\267\304"
+	.ascii	"\242\314\367\364\026\027,\211\331\300\361\261\020m\316\364\270"
+	.ascii	"\374\352\f\303\307c&!\324Z\227O\237\323w\366\335\235\332\335"
+	.ascii	"\013\273\"\220?k\375\254\363|\001\215\fy\275[/[V9\372\267\361"
+	.ascii	"-\002\353\213\005\237\331=\222'\271\355\245\026G\202\177\236"
+	.ascii	"\356I\214\247o\032D\212\030\216\252\237\022\257\331\r"
+	.string	"\356\270\241v/\326\336\261{\253\037\350X\337\237\232\317\203_\032\311\313S\362\356\224\274:%o\316\310\213Cyof\27462\336\031\345\225\231\274&\311[\226\274d\311;\216\274\264\344\025I\336\036y\231\362\276\300\243\250\230b8\335\207\227Z\231\326\244\251C\032e\352X\027\371\301\367\356w\177d\237\205\245\342\305P\030\374s\201\226z\267\262\236u\202\336\330V\370\360\326`\357U\302BYk\275T\321x*k\323J\351\312\261\024a\310\220a<5\373T\300+fF\237\346/ \226(\\\303$\224\376\352\003\302\204C\3727u\245E\2545\225;\001\273\210\374\312\336]\241w\tYx\206\221]\216-6\331\247=\366{cJ\\\032h\233?\261iP@\257\336X\267\223C\331\220\323\243\326\352`\377\344[\035\366R\247\353\341\303\207\257\360\f\373\351n\231\026pJo\214\273\326?\335Z-\200\360\316\344M\222R\200"
+	.string	"1\236r\337\nP\212\231\035\336\r1\304\001\270\"\"\016CH%p\022trCHG\346Q\007\\\021\021\007$\023\270\\\016\305\355foB\270\234\321\315v\033a3A4Td\273\345\216lB=kt\002\227\263!\031\031\345l\263`\275X{\307\232QUC\245\346\311x\304l\260\205\031\273\3544\217N\347\364\016\255up:\247\003h\341\364\275r\360zw\263\312oz\304\227\233\246G\272\310\b1\020%c\310\353]I\200\210\256\310\225"
+	.ascii	"\325\274\307\031\260-\262\241\026\300\022\341\030\352s\246\223"
+	.ascii	"+\213\270O\032\237\365?-\341\032\353Z\323\032\306.\321h\323\""
+	.ascii	"\260\300\004\361\256\316H\004\376i\323W\002D#\200g\r\324\273"
+	.ascii	"\023(\004`\250a$\006\025c\n\215\214\004\221\202\264 m\220\002"
+	.ascii	"\031)+\017\020X\210f\233t\333\213\372\243S\206\350\321R\324\255"
+	.ascii	"\211\244B\361C*\307\005\364\020\242\215Oq\277\260\251[\207n\312"
+	.ascii	"\230\333\235\312\265V\335-2^\321\306#\254\336KH\304\340X\006"
+	.ascii	"\277\3438\343I\275\367\244D\351G1*\323m\2601\347:\274+ \212\266"
+	.ascii	"\372|T\323N\316#`JrW\306\334v\214\0207\360\223\370\305\026\246"
+	.ascii	"\361@\350\237\215\244\347\023y\244\245\2063\214$\372+\3217\n"
+	.ascii	"\322l?g\204\333\3548A\026\005\016s\322Q\266'm\311\334\032\317"
+	.ascii	"\322j\306iqu\374a=\034\rE`\252aj\210\225@\2447\362w\345\240\377"
+	.ascii	"D_@\215\236\377"
+	.text
+	.section	.gnu.lto_subTaskRcCommand.161.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\236\002M\024"
+	.string	"v#\200G\300\3241tx>\276\235z\2012-@|\033\016\257Q\273A\271\202\020\363\254\t\254\302=`\211\025N\227\276\264\325\210\016X'\363p\r\n\023o)\025E"
+	.string	"\221\221\241\322\356\177P\336D\350\234\267\273o\204\354\275\245\224)n"
+	.string	"_"
+	.string	"j"
+	.string	"\362\264\237H"
+	.string	"\234\256-\330!$g\204\244\273_\334Bij\302Z\251\246\214\274\264\253\212\205\245\343\325\324\304@OoGY1\305I\230+\340\303#\245C;\235]\351\320.gU3\2672\272~\254\030\202\302\033\021\023\244\350q\242\305\303\331\330\342\341\226\201\354vbJw+\r]\022\274\333\256\212\245\273\277:^O\337\322\377\277\377\n\376U\0215~\210\251\274\001\b\205\333\251\263\366\227}X\325)kRP\224\360\306\265\377w[\376\3715vw\237}\376\271W\315\375\214{)\3671\356\231\367\273{=q\005\021\352\251o\251\273\3040I\013e\020F\353\277\356\2573\224\210\246E\"\316\352\356Y\302\321\375S\371\201\225\312\024uM\225Q\001L\rl\344:\210d\270\220\374\243.s\262\262"
+	.string	"B\375\025T\311\305\206\336x\271"
+	.ascii	"\0033UN\326\034 %RE\266\035j\344\237Kf^ \240\017\334N=\262\304"
+	.ascii	"\240I\031V\3358\006\327#E\322\020\003\203\261\032=\025-3kn\211"
+	.ascii	"m\207+j\024[uw\203+Pkt\270\n\251\274\314\214\274\316L"
+	.string	"\225\313*OA\333\016u\273;6/1\032\031\01375\261\331\f\004\354\344\260\225\330L\006{\3018\274jdbh^\260\231\315k\305u\231\207\330\354u#\223\315^\255\237Mc\263\317Y>\024B\033\337\036 \360\351D\023\002\373C\210\260\252\273&\371L\f\b\326\202X\253m\222r\300\024u\264B\221\275\246#w*\022\203\207\312e\252X\207\200O\0224\007\223\006'Phi\231*U\254\303\027\214\304\263S\232\002\002> \220\002\231A\353\006CC\347L\f\3470\356\222{\312\013\222\213`?\344\324w\0037\3351\021\341\036\357\307\0241\215DP\2664Y\270cHH\003\277\312\213\261k\323\034\023\223\376\367\254\264\306\305\340\201\264\345L6\260\rY\211m\361\354\022\326\253\346\303\032n\375)\336d\332\032\352\267fcK\253Z\273j\261\317k\300\206@\274\246\030.\371\200\030\233y\275\346v\204-\220\"\224V"
+	.ascii	"\330\273\250c\326R\217\330+\003"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.162.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\326\002\325\024"
+	.string	"\266&\206I\260\322U:\362\360@[\036\311\272Dt\234a\372CWS\035\347\373\205\333\356\227\367\212\237<<\242\312z\214\025\255\347\3171-_t\346\377;\356\245\230\213\332-j\274b\343\f\247\367|\210\177\330\253\206\031\256\233%\233H\231Rt"
+	.string	"d"
+	.string	"o"
+	.ascii	"A\022V\315\311\002hhN\241\002\037H]\026\370\310x)>\300x\351\232"
+	.ascii	"\315\343B\234I\300\350\267\373i\232"
+	.string	"s\276\266\305kO\241F)\256\326\374\367\\\305\363\331\236\372\355w\324s\234\370\355t\244\271\024\023(\0211\205\370t\342H\017\310\223Q\021\305Wd \323\244\"\304\227\023[N;\035\357\271\226\360\341TQ\017\346\234V\236o\346V\335v\317\366\002{W\001-z\336\245\3372^~7\344\030\361\374n\372d\225\212\254=\013\241\347\031\001\360\3060\2676[\210\323\275\261/\3169\247\327\306~\360\027Y\265KT\267D5k\325+Q\255\022\325\250Q=J\265\224jQ\252WT\353\252?\340;4=\0233\347\021\232\263\367\004d\016e\321\216\352\355\263l_\355\2778\214\332\003K\222\024\\\241\363\226~\330\210Z\325^\267\302\237q\032\260\021''\343%ji98\304qm\223<\210\303\013g\316\351\300\227q\240\016\276\316\245=\240\240\214\227#\022oI\356(\356\256\334\353\\\340\364\311\"+\356uw\005\374\354\202"
+	.ascii	"P;&\323\363t\177T\203[\333\275c(X\263{c\371\225\361\253\342\223"
+	.ascii	"\224S'\3731\356\263\342\353\230%00\231\013K\206\230\027\031\215"
+	.ascii	"&\"\346r\254DF\233\305^1\225\327\013\313\007\227W\214\006\363"
+	.ascii	"*\031\361\f\204\214\366\212\231\315h/\226\360\366\265\261j'\305"
+	.ascii	"\360\266\270\224\001\265k=\020vmF\375+\243kSl\270VC\316\321\217"
+	.ascii	"1B\223\004\246\t@\037\024\036\004\3541\314\255\315\307qR\032"
+	.ascii	"\222\260\261\265)\254Emk\027IW\264Z\226]\3415,\244\346\3145\360"
+	.ascii	"\211^t\001\203\211\311x\271\n: \300\002\231!\353\001\243\200"
+	.ascii	"\0079$\023\254\275[\333`\\T\337\263e\273\314\270\232\234\204"
+	.ascii	",\272\3231Qt\007\221\235`#kOv\270%\013,\313\234\341\3110\235"
+	.ascii	"T\030\213\223\245\201\035\315s\330\207\213\325\316\262*\203\036"
+	.ascii	"\2367\212\200\2377t\203\253\341m`\341\002\226\334d\207M\022\316"
+	.ascii	"\211*\206\275F\304\203\016\361\231\306!>\243E\217\334i2%>\344"
+	.ascii	"\226G\"\034\303ee\214)\005\204\002"
+	.text
+	.section	.gnu.lto_isFlipOverAfterCrashActive.163.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \342M\006"
+	.string	"\302\313+3Pm\222\016\244\204\251\346h"
+	.string	"(\2526\3425\201,\255\271\341\377\364\343\033\366\357vx\255\340F\020\266\020UeA\304\312[\001\202ZJ\365\212\267\270\267L\001O\027LEMmjh\020\016\f\017m\252$\332\3052\025\201\251\332\004EUM\302\262\b:,\340`\3057\244\"\326\365\230\"s\275\032\335L@\243\303\001\r\316e\217m\0167\276"
+	.string	"\211\240\377>\264\240`|\032J\311\354d+y\022\225|\374\232\227FH\320l\025\353\350\020\230\220\\\214\250db\r9j\365\254[\220.X\204\262\313\263\351\t(d\346wy>\035\373\037\374\006\177F\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getLastDisarmTimeUs.164.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \360\225\006"
+	.string	"\242\f.3`m\322\001\300\016\b\334f\270\203\313\343\034\324\333M\373v'7\214\n\2064k=\214V\263\323\327l\207\t\307!\212l\221\257-)j\204\215l\"eJ\001v\226\013|\256\271\204\306\240\200\260\320\034th\026\311\257\341\002\333\303{\260Q\256\275vR+\223F\330\337\370\025}\217!0y\352\314\307Dg\251"
+	.string	"\024S~\354K\223ja\037Z\355\330N\247J#\036\316-\220\335\211O\311\206\260\016\f\333\031\233\342g\\#\343x\260\231*\002\217\017\t\016\222\335\253U.Eg\320\003\2423\275x|F\377\326\r6\226\bUi\236\223\202\335uR\025\347\326\333\036\260-`\273\"\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_isTryingToArm.165.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \366\235\006"
+	.string	"\262\f.4Pm\222\016\004\210\314\020HU\217\221\203\033\242\002\005\035Y\020\253\375k\177\366\355\337\rZ\027\337\b\302\2021\215,\242\350\276\324F\200\225R\207\3064\273\211L\001?L\206\232\236{\r\016\302\201\341\301=J\302a.O\021\031\312ML\023\345,XvD\002\016v>h\021\261\236\254\323\216^\217\\\215)\316Z\255J\367\f\240RQ\240\202\323F\217m\032\212\276\225\304\213\277\215\255\335\312\005\005$\324\353#\3633JI\023Id\343\327\274e\204\004\315U\261\214\317"
+	.string	"I\211\307\343$\023s\210\321\252\255\272\345\350\202\350\n\261@\233\266"
+	.string	"\205\314\274Y\240P\307\376\006\177\301o\021\t"
+	.ascii	"2\003\3020T8\313\242,qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_resetTryingToArm.166.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \344-\006"
+	.string	"\"K*2pK\323\001@25j\0242^+]\320\202\025\001\243F\230\326\323\212\030A\032oG\313\337\330\222LH\364\277\376\341Vl\374s\373\211\\\263\315\356\235R\236PT\351\2243@\022\b"
+	.string	"\f\310Y\r$\364\230\026DU\036PZ\245\263\355#\326d\030\035\025\023\\\271?q\315\026>\204\021\314\301Wg|s\2213\227\007\216\210\r\n~\3666\301\310`\037\262\021\263\343\343\341]\3274v\027\276\217\355\230\212\314\366\035Kv\3067\207\235\\x\n\024\035\273+c\303\245C\311\277\304\233\312\232\016%\226\3355\254\254\353\216\247\330\276\002\t"
+	.ascii	"3\001\0078\003V|\241k\270[\b\343e\bp\351\306lm\327i\001"
+	.text
+	.section	.gnu.lto_isLaunchControlActive.167.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375 \365\245\006"
+	.string	"\242L.4Pm\222\016\244\204*\"a\354\263|\272'"
+	.string	"\001t\2131.\3607\366g\337\376\3352\324Z\301\215 ,\030c\306\"\212\356[\001\202)\200\237\325Z\373\233\310\024?L\306\252\236{\f\356\241a\301\301=+\302a\004\256 2\226\223\250*\313]\262\354\210\004\036\374\334j*E\304\202J\237~\024Ds9\236\330\264b\245\356\246R\252\bP\341i\247\317:\r3\276\224D\214\277\215\255]\312\300\005\305\250$Sf\350t\222\"T\251\343\347\374\345\003\004\316W\263\215P\200\311\004\024R\222\2319\324\350\325v\335zTa\204D\202\211:m\226\204\314\274a\242Q\307\376\006\177\301o\021\t"
+	.ascii	"2\003\3020S\270\033\241,qML\031A\226\0209\3349S;\237"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.277.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`X\022=N"
+	.string	"\032w\030\033@0bR\007\247\257\312)S\224|{\254_\304s\215\nq<A\305X\370,\320t\321\270)z'\247\252\001H\001\200q\204\320#\364\256\352\361eU\246\316\314\335\213\3147\2625#d\357-eJ\001\254\001{\001\240\001~,C\206\314T\026\r]\0270\342\303c\034\314\200\216\027S\346V0\003\362\213)k\232\331\315CJd\347\320\r\316\263\235\327\303\216E|l\216\017\343\b\212\3109\276\376X\035\356\307\343\303\017\306\335uX]v\027\364vp\363\247\211;+38\317\363\363\341\035\345\345w\320\200\301\002\005\t\020\0340P\200"
+	.string	"\330"
+	.string	"\001\317\257"
+	.string	""
+	.string	"\274\272\270\234[ZYXWVUM\252)\251(\250'\247&\246%\246R\022\322\221\321R\231D\036\215E\3420\206\337\255\303d\377!\004+Ag\252hf\357\240\360\0330P\364\013\022\021j\005\t\270\203\032A\030\2406t\\\2674\356\037\030$H\033\030\024H\027\030\004H\023\370\363`\177"
+	.ascii	"\365\200;\177Z\200\037\375\374\373\257;~:\300\035;\032@\235\367"
+	.ascii	"\352\253\243\273\372\3704W\0367\217\225\216vn\315y-6y:+\373X"
+	.ascii	"\3315\372\312\312(\327%\320-M\315W\341\245\321M<4\232JM\235\236"
+	.ascii	"\222\n\363QX:\r\365\004\346\235\276x\321MLC\271 \201ni]~\311"
+	.ascii	"J\025\315\264BE+%My$9)\372\310(\356\227y\254po\023\373Us\326"
+	.ascii	"&Z9\204\340\226\306\366\311*\344\\\036\353\022}d\262\246\215"
+	.ascii	"\035\262\203t\\\2674&_L\242\211y\254J\346\254jz8gU\3626\347y"
+	.ascii	"~3g:\3769+\233\020\264\036\032\326U4#\377\036\321\250z\277]["
+	.ascii	"7\207\224h<^\346\220*\325\307\276\006\2026\325\032\351\303\206"
+	.ascii	"\020\346y\366\337\261\350\375\301\273\277#\334\375\314]\311\""
+	.ascii	"H>w~\361\036\016\375\274\353\305\360\216\267\263L\217\271w\303"
+	.ascii	"\373\317\026\271gx\255\006\342<S\017\370\337y\277\r\376S\036"
+	.ascii	"v\016\036\364W=\304\017\277\373\373\374\205\331\241\273\316\324"
+	.ascii	"\356 B\350\257\356\035\203i{8\302-\233\275\257\356\356\214\365"
+	.ascii	"\216\336\001R5\241\277\363;\343\337z\277\206\316\324\246\272"
+	.ascii	"\353H\332\235\204\t\375\325\337eF\266\334\355t\233\351}\365\035"
+	.ascii	"\366\273\333\355\026\372~\342\376j\357z\265s\275\332\235I\355"
+	.ascii	"[I\355ZI\355Y\257v\254W\373\325Q\273\225Q{\025R{\363\325N\365"
+	.ascii	"j\237:j\2272j\217Bj\207z\265?\275\332\235^\355MH\355LH\355K\257"
+	.ascii	"v\346\253]\351\325\236\264\324\216\364j?Bj7Bj_*\265+_\355\311"
+	.ascii	"W;\362\325~|\265\033\277\314{\361\325N<j\037&\265\307I\3550R"
+	.ascii	"\373{\324\276\217\332\265Q\373\217\005\360\263d\233\347!]Es\033"
+	.ascii	"\374\306\312\227\371\037\363\237\375\307\37390r8\214\267\037"
+	.ascii	"gm\366\2404\034\352$\354\232&\216\016\237\001a\352\203\307\273"
+	.ascii	"\006\017\r\335\340L\265\363\3627\017\247\206\317\330>x\354p\263"
+	.ascii	"\332\363\245\307\336\363a\267{f\3740\361\223\342\207\207\356"
+	.ascii	"\3574\236\2157\310\"X\343\3318\006-S\330\350\374\321\250\371"
+	.ascii	"\274\354\032\2625d\177~,\340\245!KC\026\006\210F\301\333}\030"
+	.ascii	"\377\2737\023|hXMTM\273F\335\226\273\245n\263\253\265\027\234"
+	.ascii	"f\217\264\261\"\356\005fQ\341\233\253\366UO\237\311H\370\276"
+	.ascii	"T\274\264\231\324\320\226\366\203\277@%fK\232\314\375n\332\310"
+	.ascii	"3\267\322\236\037\225\322\216F\021Q\332Ku\264\324\251\264=\251"
+	.ascii	"&\234\250$#I{\251\215v\272\315\240\204|y2\342\242u\322\3632\222"
+	.ascii	"\030iG\357\356\270\256j 2\222$\362\332Z\3740\322.\356\3116\351"
+	.ascii	"36\2711g\3460\351yo\rn\351hkAPG\373\353\332\230R\261\021\221"
+	.ascii	"\320\335\037\361\245\342\3456\332\256\317\324\246z\326f2\223"
+	.ascii	"&\262\023\331I\374\360r\017\257f\274(\025.\245i\251\2374w\221"
+	.ascii	"^~\213\225\001\242\310q\372\253\312\235\244H;=\032\374\244CF"
+	.ascii	"F\205~\231\334\3218\271\037\373/\004N\240\226\332U\026\267 \234"
+	.ascii	"\345\0207\371\333w\257\240w4w\b\020\211|A\217\334\217\244\215"
+	.ascii	"Z\240\216\233\333q_\375\001}q?\243\2745\301s=d$>\0059%8u\305"
+	.ascii	"$x|\305\343\376Ew\\\332_\266\022\273\313Wd,\372\253\307\235E"
+	.ascii	"\004\f\324\226\013\037\261,.\356\t\373=\016\266K\224\241qk\302"
+	.ascii	"?Z\214{\003\024@lX\265\035\272\313\245\270\337\314\033\235\254"
+	.ascii	"Y\271\333x_\373<\361J\273\313`d\254\376*q\227%\331r\267\376d"
+	.ascii	"\261\377\236\347C\346?\305\345\272\b\021\342\207\213O\370t"
+	.string	"\021\334\360\224~\347\247\020\273W\270\240\277\352J8hZ*\002\355 ,\357\276\016\367\336\001\276\342K\005\213\0241\240bL\276\342\213\306\013ht,\006T\314\204X4\n\032-\253`D\361bl\f\032]\361\001E\024\032C\005\013\345\215\016(l\234X\021\273\020;!\341F\2071h\2051\0325Z$]\354\013E\024*\366\024K\361\214\301\342\004\214\247X\224\306\363\213\351P\031(\242\3171(4\372<\376;\357'\"\334hw\354\251\203?\322B\310>l\203@\322B[\030X\b\224\026\352\303\242\347y6[\320\265\243]}Wf\005u\277\354K\222\007\367\305/\001\327\376-\\\233\251\017I\240\270\264.\002\"T\021\244\275@\363\001\347\226:7s\215\210\226\232 ;\347\031\330W\367\372\255&[\336\264v\326\336*2\225\033sFN\001\254\215Cj\bk/\371\n\265S\002n\367\024bA%\201Z0\001"
+	.string	"\376\271zy_^\257u\265\245W[\211\317\316"
+	.ascii	"\253\375\204\213\252\266\325\036\332\251\332Y|t\264\323\344\340"
+	.ascii	"Z \001Z\3127\377\244\210t\2269\215E\312\225&\222\026J\013\343"
+	.ascii	"\207\233;\tE\217\033\246\213\255N\221'wJ\350\307\027\325~B&\325"
+	.ascii	"\326qzm\334-5\300\276\272\366\362ze\226\355\214M\027\200\317"
+	.ascii	"\332@\246v\230\026,w\200\020t"
+	.string	"s~\331l*\363\320_\235\332\332\211\236\225\273\005\240\207\347\355\217W\337K\355\007\274\373[\"\352\372u\337\031Gm\251\035\027Fm\271m\332\245!\206\332\013\262$:\323q:\212\206\223\177\310@\344 A\342\207\241\366\347\275\346\313\"\310\206\345zz\332K%\\\264S\347\333?\261m\315|kZNC\234\366\223ZV\201\227\250\201<f\0213#\"\"\222$\005)\f\007a\005\304 \347\234\\\017\021\320 \203Z\331LRP\310p S#b\306C\260\n\235\373\252\313\303\025CC454\212O\036\200\250\325\022(\005\366 \323h\202\200.\370\273%\242\\\003\242`\250\236\205/(\204\246\007\216|\241a\316 n\236z+~t\216J\310\310\033\336\213\227\253T\357 \340\340\347GZ\275\361\\\370\241\247\201\202\342\244\025/i\356\033d\264\345H\310:\252\262\034\323(d\303<\007\263B\361\361\3408\024\241t"
+	.ascii	"\310\313]\233\315\301\370\302\374-\006L!\003\003=\267\376/\342"
+	.ascii	"={<3\265[_\270\3274S\325Y\222\265\276\242\301\272t\221\253\315"
+	.ascii	"\230\0312\254 \266\323\333\214\312\320=\233Ib\226\252\373\214"
+	.ascii	"\277?\306\\\244\216\322\017\023(\241\213L\211S\341\255Y\350\335"
+	.ascii	"F\017\262\212\223m\252,T`\315\207~\276"
+	.string	"v\240:\343a\342G"
+	.string	"\b\365\275e\223D\370\373\035\312\006\223.\253(i\2250\307Mi\315\350\340\233\036\nD&#h\207g{\240\035i\357j\262\2250&\005\365\306k\240\364\365;\343\335\016\221\361\363Ml\005PW\237\240\205k\323ui`7H'\310\032y\201\20305D\321\203\356\r\226D\235\016%l\234\365Z\334\t\244E*\035p2i\0248\237H[\270X\311\236\235\"g\001\026Y&\"`?\315z\177\337eg\233sZI\277\270\b\004\021!\301@\315\025\027\035-:\272F\350+.\254\250\374h>\210N\237\022\030\374\021\352\376V\361\232\016A l\035\006\234\r\342\311\335\251\307\352V\237@;\304\253\031\273\201\030m\243A\320\300\024O\334\374\005\372\2729np\347\307p\321\316\022zc\003\376=4L$\177\327\251\001(\246N\017\265Pc\206"
+	.string	"\340\206\024\326\027T\377p\350\t"
+	.string	"\313}\226DHQ\252\231\"H\364E~\270\225\373t\306\357\261\252\334\3279\365\212\323u\036S`?\251hQ\\L\250@\343"
+	.ascii	"P\240\363 sk\242z\354-kHU0:\206\030\215\027\244\326\247\207\242"
+	.ascii	"8\262\246^\372\024\204\220L\320\b\2042\020\257$\200\272\260\331"
+	.ascii	"\027\001\313\361U\375\007\227\2222\235\001\267\231\313\212\304"
+	.ascii	"\361\246\301\254\263\020\316\005.\366\324\340Z\344\323\212\356"
+	.ascii	"LB\303Q\312&\213\035\233\302\006Dto\276\013\267B\333\252\276"
+	.ascii	"OB\370ZC\216\"\313\223\203\2638@\354|\326\240#\235|\357\022\354"
+	.ascii	"\0301k\016\273\270;\003*X4\006\265\317\026\365\253/\317\262\261"
+	.ascii	"O4\177\347\301\007\2624\272D\352\244\235\007\t; X\265-\204\236"
+	.ascii	"\305s\002;\340\2575\326\315\325v]\251 J\362\200-\227\310i\322"
+	.ascii	"\210I\237\251\305|\n'\033>\344\016\270\304\365\221\035\353h\261"
+	.ascii	"J.\334\375\224\237\313#epG\005"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.278.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\375\006"
+	.string	"rL-3Pm\222\016$\203\260L\3314\234\t\324\210\220A\243\322\355\326`?\356\035\340aw\303\252\326w#\b[\210\252\252\210j\326\002Q\305\f\316~\374\204l\"SO\230LEMoJx\f\n\b\013o\252\034\036f`\252!S\275\007\212\252\236\364\263\266D\317\227\221\206h\002)\020?\277cR!,\037!\301z\335\223QGT\201\033\206\237\261\265%z\036\033\250$`#\363bE%9\234\311\3077\244yI\252\253\310\257\301\330z\224\216x$\001(\304\202$%3_\035v\324*\262f\335\213\263)6Tvq:e\002m"
+	.string	"\007\231\371%\243\273\376\006\177\301\017\022\020"
+	.ascii	"=\023\030\0278G\021\007\210\202a\256p\032&.\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k\317\005u\314v\236P\306"
+	.text
+	.section	.gnu.lto_tryArm.part.0.310.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`3\b%."
+	.string	"\252M4\021Gp\032R:\023\275\bA\240I\370\331\327\242\202\006B\240\224\002\232\002D\241@:/\007\360\027\346\006\375Z\035]\204\215\2509\t\035)\024\006@,:\375\250\377\224\211\360\3469\027j\035\376\322\203^\227o\255\221\330-\223\f\372"
+	.string	"\355"
+	.ascii	"\002\001Y\324\270\301\322\213\032\373\236LA2\345f\374\264+R\267"
+	.ascii	"\302\202\223T^e\275\025\026\004\216g\027K\305\0350es\367\236"
+	.ascii	"\035\035e\003\275\243\004N\224\036\335](}\223\271\305\3158@\323"
+	.ascii	"\311\207r4\0277c\264\371t\301w\3623\0307c;\245\246\204Yv\357"
+	.ascii	"\205\221\362\233R\314\252z\364M\230Y*\311+s\233\237\205\335k"
+	.ascii	"1b%e\356\336+<j\301\276\376\307'\330\003T\177\276\036/Ew\266"
+	.ascii	"\201V\376\324\177\2327\362R\206\335'\330\303C\002\222\304\355"
+	.ascii	"\215\227\262\353@\261$\217V\271\304\222;\372\007\227dn\265\317"
+	.ascii	"\310K\251\365\036\\R\353i7\022K.\233\327H,\035O\255\252\032\335"
+	.ascii	"%`\212\311\n\276\375`\263\013b\035w\004\356\275*\026U\333]\202"
+	.ascii	"\347\332\034\025\313jGt"
+	.string	"e\004\371\264\367\r,cw\320\201xH\367^~Q\3109\350\314?\300\314Cf^W\366li\354\231\255I\026\266\373\230[\333fC\315\374\001D\037i\355\227\364xX\235\347\026k\277\230yE\332\226\210\246\346\330u\230\037\346bV\360\211p\b\021}\244\210\364h[\273\026\305\311l.\213]\307>\315<d\352#o\237\366\337\033\035\022\272\247\321N\265\375b\013\364\335\265@\230\177\315D\277\346\241_\263\020\2579\b\330\f\2446\377\250\315>js\260\327\334\363k\006\252\315\352\257\371\367k\366\361\232{\277f\336\2579\3655\243\275\346\035\257\331\362\232\373W\316g\260\033\353\362a\336{Uw\347\366@\271\034\371\225\237\313\033\300Y\2302\371E\212\241\220\2142\250vju\236es\367xv\324v/-\030\312\312\240*\372\230\360e\245\212)<\312g\275\0131\237\317\245\013\253kR_cu\013\267\375*\357g"
+	.string	"\031\273z\336{\033\364\002mUnV\265?v\327V\3054\256]Ny\357e\004\307{\213\005\202\326\307\276J\254\307\006-"
+	.ascii	"9UO\240\355\261\267\312S\354:!\317\263\016\351\335{\204\300\277"
+	.ascii	"s<k\021>\221\243\274\036Y\223\254I\322\243@\373@\210\331\255"
+	.ascii	"j\203\320j\234\251z\016\215\201\300\3434\372~t\273\027\245>\373"
+	.ascii	"\263\237\343\263QK7&\313\356\365\016\364\200\257KR\346\225\311"
+	.ascii	"\332\244\217\354\331\243\201\243\343<\332)6j\346\325IR\332_c"
+	.ascii	"\212\216K\367<\372\233g\371\001%\0312f\231\034\317\2729\022N"
+	.ascii	"Q\232Z\236\265"
+	.string	"\3100VY\306\256c\376\232\263Q\252`\301Bz4\265\350\233\2240fs)\240\217\316|\001C\037\311\257\002\267\346<\362\354\3273\244g\276\\b!\223\213\200\345fI\237!E\355\275\342^&\203\006\016\034\322\243\250\375r\251F\367fk\212\013\265_\n\276\263\300 hi\234\177\3436\017\314\306l\001|b\001\024\212'b\224\323\323P\304\2208\300\351\tj\211i\003\t&\024#\226\240\232(\230pjJA\\\032\202\362\300\224\242\251C\224\023\023\221\310b\330\303\303\005L\304\247\241pXB\350\324\264\224B8$B\t\027\020\361\223\n&\2420\352\351\211(T\231\271\217T\264\306\237.;J-)d\275\343\\x\266\264\242\314\311\025\327\037\351V\214\272\025L+\n\231\234\321T\322\234\323hL\212\213\343\203\036M\334\027\3471\b`\270\305yl\032K4Y=\022:\375j5c\245\321U\342\232il\300x"
+	.ascii	"\355\027\357\256\224\022\331V\203\346\306\253\215\276R\352\335"
+	.ascii	"{!p\333\350\033\353\025\326\212\003Gz\224\310>HcV\354:3kn\340"
+	.ascii	"P\213\322!\237W\277(\025\262C\226\333j\3313\224r\b\331\027\313"
+	.ascii	"6t_\250\256\220\374\202\034\364\357W\255\035+W\037\031d\217&"
+	.ascii	"\216IWR\334\230\263\217\334\346#ky\206L\016\310rOuq\375\261~"
+	.ascii	"\255``\351\217\005\262\035\200\272\250\2014%\225RhfDR\220\024"
+	.ascii	"$\215\001p\002\021*3z\021\2401\205\246\205\264\031\nW\271\266"
+	.ascii	"*r\310\327\r\251\303]\314\376h\211'\304\247\351\332/\033\350"
+	.ascii	"p\t\300g\273\260\310\217 \272\""
+	.string	"\364\265\331\210\030\312WB\355\203\374?\210(\300\243oO\013]-\260\3222\273t5I\027L\254\252\204\307\021\226@\327\330u\253\334\002\276b\323\2750B\316\355\225x\310vD\263\024v\344\323\330=V\305x\330\351\220\203\003A||r\315m\231\334<\367\330K:\355\320\274\235 \325|\023f\357\363\211\016\310\212E\253>g\242c\301\273\326\334d\376\310\263\320\037\374$$\333\377\307\254\230\013mq0\243\315\0160r\236\243#\231\020%\004\200\3154\305\367C5\351\001$lb\247\340K0\344\241\300\005\370h\305Ap\341/\340\275\022\304G/Od\373\rx\345\220\002\304\\\273\2469\"o5\031J\275\375\254>\2267\212PJ\310:\207\006\367\330\017\304O\216~\220\225\314\242Y\233\037+\233R5\315?\021\370\354\327\224\304\202\215\215\t[\003\026\030\223~\002\233\350\327\314\203\232d\234!\213\213\265\361T\204\364"
+	.string	"\303^\263\240(Qi\373\361V\261=\321F"
+	.ascii	"u\035\224\215\230\220\342\317A<P\261\227F4\224e\244$\204\261"
+	.ascii	"\024\335\216\263\026\254\255\374\2639P\001"
+	.text
+	.section	.gnu.lto_disarm.part.0.313.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\r\f"
+	.string	"\346SLD\020\251L:\200;\020p\307Q\241f\214\260\312\317\373\360\343\034\377\"\214R\376k\320X\224U\363\002\341"
+	.string	"0@\371e\211\n\262q\273\\m\370!\002"
+	.string	""
+	.string	"\\"
+	.string	"*\347I"
+	.string	"\020\202A\314\364\340\320\210\354MR\n3"
+	.string	":"
+	.string	"?"
+	.string	"7`\233t\371d\347^\322\366\0200\220\334t\273[\377M\001?}z\364\344\337\366\013\353\205\372\304\274N\356A\234:xv\327\026\224\373\273\355\216\355\n\373\2445\335\252J\212\005\277\231L\222(i&\230\024"
+	.string	"\032`\272\335\262\376syM\345\237\345\021\225\177\323\276\237\340\nJ\026J\231\0136\375\200-\n\354b\265\335\005\247o#m\020\374\027\336Y\316T\230\200SM\2247g\236\364t\247\314\236u\300Cl\267\265a\267\001>\t\004\034\230\323!=\242\013[\315\f\234N\311\243\227\264\326g\b\032\324<\027\003\322$O\252dE\037\344\"\004\316\330\210\210\240\215\360\303\001\232p\270\t\215bXC\214\352\241\361\351\250\341(\252\033\215\305\217\320XCDq\254\240m\357t\247\314\027\024p#35\347\314\366\305\243\027+6\210(! @\002\242,t\f\\\270\222\254\374)\334^\200\233\"\030\344y\2045F\250D\310\020|\316\271Bf\240\337\311\202}\330\027,\343"
+	.string	"\361Z\363Z\202\234\341\202\326\216I\2029,\260V\354\241\2572~\333W"
+	.ascii	"\345E\356\224M?\201\217\001"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.316.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\200\0015\017"
+	.string	"6\234dF\360\260(\035\333\374\302\227\350\355^\352\035\342Y\305\211!\266\310\313\211\246bglDImJ\211\275\265\223\035\243\0208~\336\372kF\203D\273\023D\036\270\274\360x\020J\3476\343\266h%\376\210\260\337\310\336r\247\024K"
+	.string	"U"
+	.string	"N"
+	.string	"\016\355n@\021\333\235\"\2276"
+	.ascii	"\272,\360\017\3552^\200v\271]>\204m\324\005\247l\032\237\257"
+	.ascii	"%\260\343Z\341\314v\227\273T\016O]aL\371\277y\210\325j\271v\264"
+	.ascii	"0\034\006x\374(\330]\2032\334\362\266\021\330f`\377Fk\241'\307"
+	.ascii	"j\220:\260\023(\253\304u\315\327\313g\200\2305\263u\231!\306"
+	.ascii	"\271\211\025\253\200\314\327\313\307\303\207\032-f\273\223\273"
+	.ascii	"\364\004\335\346^y\t\177b\274\220\305\324\354\356v_\004\312\277"
+	.ascii	"\361f\203\372d\201\013V\005\023\333\235!\227\206\320\376\210"
+	.ascii	"\223H}\262\004\252#\035d\340pA\265}\340*J<^\273\233\300\317y"
+	.ascii	"\212\316\247\271\2647\222\376\210e\343\n\025\272X\361\250`\217"
+	.ascii	"78\340\0224\273d\202g]!\fXK\346\242-Pg\254\361qU\306\326\240"
+	.ascii	"\343\007Z5h(\241\037\212;9\0361\0336\021A \241p'\223\021i\002"
+	.ascii	"HJ\003\257D\0329\235x\337G\241\003\340N\344}\246\216\353\"p'"
+	.ascii	"\244\222\022\327})\234\350\303&\024\357\343N&\323\307m\266\341"
+	.ascii	"\343\252\214C0\030\231J+\250\316\330\216\"g\241\243\032\365+"
+	.ascii	"\036\177\305c\016|\032? !\321.\003\" `\202Q\356l\003x\206a\177"
+	.ascii	"\032F-\317A\206al\\\006\036>\312\024\205dO\237\254\2715Fj4\274"
+	.ascii	"g\337\211v\230#\034u\n\022\024\202\357\030\nl\320\004j\031\361"
+	.ascii	"cD\016\261\354\301B\017\355*\333os\0050y\241;M\323O\bc"
+	.text
+	.section	.gnu.lto_processRx.part.0.324.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`^9\245\336"
+	.string	"\252MQJI\020\020\246\355\214\001\257\267"
+	.string	"\314cE\n\340B\203;"
+	.string	"\025\254I\304;&\264\342\211i^\310|K\250\031J\232\204f\325\303$.$\006}\350f\3775\271\331E>\334Q\357\376\366\261\212\241|\247\267\030\320\013\246\262wJ)\005\205\0043\004\273\004\331\251\354\024\362\005\233a\235\323E\313\217\036\301)\301\251 >9;)|\314\200m\250k\320\336\367\255\323~M\215\207\273\003T\220J\363u\035\367\035\006\352\263\363\264\363,\223sk%?d\230\233\364\032\313\f\304N\213N\314@t\372\216\033\217\201\346"
+	.ascii	"\241\323\313\212\251\331q\317a  -\347\t\371\202\275PB\022eiX"
+	.ascii	"\265\305\367};\013\bT\327\261\005\250\035*#t\035\377[\337\241"
+	.ascii	"\230ZT\3271\020tP\213\230\032\006?\226\352:\026\"+\203&\246\026"
+	.ascii	"\304M\006\t7\\\237i5\315\246\351\030\250\315\\\ts%\364\373\365"
+	.ascii	"vVVLc\366\004\2715Sk\246.\360\265aEH\203\206\b\032\">|mY\r\342"
+	.ascii	"\314\024a3E\216\254\334^/\240h\236]\003?]\246\257O\356\352\353"
+	.ascii	"\363\b\352\366r\271ez\262jJ\235\344\026?Mf ~o7$\335v\004\351"
+	.ascii	"\366zu\361"
+	.string	";s\2575[\263\333\216\260\205\367%Ck\363\276n+:\311%~:y\324\037\334N\"\273\203\333I\346\036\303-^ \351z_7&f\346\026/\232\374l73.\017b\324`\301-\276\257\033S'\337J?\273\2334\223\376j\257\356j\256\336\352%\255\244\265z\332Y\235\244\261\372\252\245m\325\321\256jh\277\274\345Gv\344=\334\310\214\254\345EV\344DF\344C6\344B&\344,\017\262\036\026\344@\316\303\200\374\307~\214\207\357p\037\333a>\256\303{\214e=\316c<\276c:<\207\345\260\035\307\341\0010\034~\303n\270\216\351\270\r\3171\033\226\3435\254\206\3230\032>\303ql\206\341\270\f_\231\f\277\261\033\r\005\022\230\201\300\001\006\310\210\001\343E\001.Z\020\300\202ii\205\n\245\024\003\240H:a\242\004\t\001\220\216\214\226ED#\224\"\206B\200\370\340\241\003\207\r\032\204\2022`"
+	.ascii	"\272"
+	.string	"`\341\307\307M\"\337\333\311\223\033\332\335\304\247\306\006\025t~qZ\272\231d\351\376\312\342u\005\213w\227Y7\227\331\230\367\226\231\230\367\022j\267\2220\252\267\2264L*\305{\232\225<\242\273R\215\322\235$\n\024o,i\024)\230\367\025\227\224k\211\267\225T\211t\313;*U\"\325\362\256r\2514\212t\352\r\255fu\277\322,\020[\244\013\351b\030\021Yt\213\304\300\210eG\232\304\371\321\361\261y\217\343\036\347\306\306f\306FFgm\243\326yQq\2619qQ\2173\342\240\240\363\241a`sa \2403a\236?\347l\343\240\236\237\263\236\274f\301<<\347\300\274;\347<\200t\232\377\346\310q\366\303c\327|\307\216\215s\337\234\234\263\235\2715\316|j\232\353\220P\323\274\207\246\031\213\346\214\263^\233s^\032\27456\347;\265f:c\234\347\250\2459\313\2616\333Y\321\234\343pi\036"
+	.string	"\2270\262\350\026g8o\334\234eq\256\243\303r\305\271\315\334\331\2303\0339\244\212\265$XsM\310\312\316\232\327P\303\234\325P\2458\247\021\213\342\214\306\f\212\363\0310\3478.g3 \210\310\242[\316p \310\242K\234\313hQ\342|\325\202|B\026\325r&\343\341\215\335@\220E\247Dd\321$Nc\353\nd=z\002\310&de\323\236\261\307\021 \"\213N\033\375"
+	.string	"GF7@\306\242\307\030l\030\203tz\374E\001\332@w\221\247[\344\001t\002\264\315B{\307\317\231\364z\251N\227\336\227\256<_\361\207\347*|j(\321\351\024t\356\314\361\001\356\032\305\235\235'\315\365\21196nB\256K\3109\256q\022jZ"
+	.ascii	"5i\034\t\215\037\235q\2436_\312)bs\24255\037Q(G\2316\306EX\357"
+	.ascii	"4R\235\2561>\364\245\013\315Cpq\020[\374\203\340\231{\020\324"
+	.ascii	"\342\035\004\2638\207\r\032\260\264\220\331\230\007!\217\350"
+	.ascii	"`\261\214\250\214i\373K\227\230g\270Bu\fu\272\2564]#}\351\ns"
+	.ascii	" \237\032\027\220\310\276\244\264\005)_\272\240\370\017\362\303"
+	.ascii	"^Y`\n\261\273&\375\245\013\314}\200\274\260\334\255\323\025\005"
+	.ascii	"y\364\276\357\225'}\352\345\244\221@A^V\376\310\024Y\272\304"
+	.ascii	" /)\362\003\327\226i\323\265kyE\3359t;\361\251\361\276/k\250"
+	.ascii	"\2365\367\223f\006\202c\356\227yE\206\021\270\235\314\360\026"
+	.ascii	"\330\252\330\274-\002\247\326\331\350lt;\211\341}\366\354,\340"
+	.ascii	"*\232\331\271}B\013\305`\255\036\352&\217\227:A[\332\375\177"
+	.ascii	"\314B&\356M\006\240\367:W\3001@\277\342\017\314\343H\271\256"
+	.ascii	"`(\301\375\037\332\252\362f\310\367g\345\214@_E\363y\263\243"
+	.ascii	"\202\230\332\341g!\0237w\341\253.\273\n\036\346\031}J\245n'\273"
+	.ascii	"+\f\016\3550\205\330\035\023\013_\345\013\237|\346U\217\371\211"
+	.ascii	"\345_\246~\336\327\n\006{\027\367\362\314\342\326\322I~j=\227"
+	.ascii	",q;y\341[\205\2602Z\266*\337\276YC\253\362\363\325~:q\335\177"
+	.ascii	"\266o\336n\267\216>E\256\005\013\205\335E\356\317[xv,\260\250"
+	.ascii	"o\231\035\213g\261\301\365\364\362\372\245+`U\276\335n\267\214"
+	.ascii	"\356\224\366\371\036L|\276\351\272\225\304y\275\332,{\025\267"
+	.ascii	"\362t\302\255\205\237)<\241xO\237P\334N\272\337\330N*\324\313"
+	.ascii	"\212\255\201!?\371\313\276+\306*\337r\013\347\276{R\237c\336"
+	.ascii	"S\3447^o\2203\203\350\246\3152\225=\253\336\323\377\244\337\240"
+	.ascii	"\"6\372P+\3173\024\203\206\330hR)\313\363\354\314\240\0366\006"
+	.ascii	"v\360\013\362\351\372\273\236+ \ng~zy\202\361\236\372w\333\224"
+	.ascii	"\350C\371\273\315\030\263k\376\253\314^\236\270\365\021\267\377"
+	.ascii	"\241zc\256yV\316\310&\274\237\371)\346i\365\236r\323\365\005"
+	.ascii	"3\216n\332\254\325C\375\253\374\355\244\177\273\335\"\362Sa\346"
+	.ascii	"\332Z\242Dk\232E\344\334I\260\256\244\354\334V\354\334Qv\356"
+	.ascii	"*\245sC\225\316\375\262"
+	.string	"\363\223\235\235J\347&;\243\300\316H\330\371\004$\347#H\316F\330\271\210\221\263\tF\316D\220\234\251\220\234\247\330\231\311\316%\2603\tJg)\245\363\020\245s\024;\013Ar\036\001\311Y\004$g($\347 ]\246\031\b;\377@r~Br\366\301\316N\354\334\203\235\233\004p\016\201\235y\2603\b\354\274\203\235u,\235?`g\017\330\271\203\2453\007K\347\r\330Y\003$\347\034H\3168\330\371\006;g\240t\266\241t\306\200\235/P:[\240t\256\240\343\232)8r\236\340\310Y\002\"\347\b\224\316\020\260\363\003Jg\007F8\007@\204s\003Jg\006F8\003@\351\274\200\322\271\206\322\231\206\221\263\002K\347\004\226\3163\226\316\b,\235\017P:\033`\344,c\351\034c\351\fC\351\374b\351\\\300\322\331\305\322\271\305\322\231\200\2453\213\2453\023\221\363\022\221\363\n\025Kg\245\245s\212\245\363"
+	.ascii	"Kg\024I\275\247\371\304\322\331\304\322\271D\2213\211\"g\001"
+	.ascii	"\212\234\221\212\234\217\212\234\215\212\234\227\354\\\324z\232"
+	.ascii	"\211\210\234G\0209+\211\234E4a\363\020;\207`g\020J"
+	.string	"\347\017Jg\017\354\334\201\2359\260\363\006\245\263\006\245\263\220\3229H\351\234a\2043\006v\006R:_P:[P:\377\260\263\217\bgw\310\031\331m\232\237\235\275\335\272\333\307\220t\177Bb\357\313\265\335\363NI\326q\3516\335r\335i\272\343\272\313t\367u\023v\353\351\336\323n\325aO\344\013&}>5;54'~\016I\277\257\355\214\032Z\024\033GP73. l\303-Kk\243\326w\rv\003\212o\270(\333J!\315\t\303\341\301\f\347B\237\332\2237_9\276r\214\3009`\304m1)\344\256\327\352\335\342\r\216\254\334\314\274^\245&\336"
+	.string	"\351f\346eB\336\327#S'\225t\020\305\035(PE\363\325\304\207\334\314\276\272\262\220\360\007\310\027\314\315\354\253\313\324\354\324\026_+7%\306\362$R\374\301'\221V\t"
+	.string	"\201\350\026.1v\373\031bn\366\252\256c\227\272\225G=Z\315\302\312=rw\t{\\\334>2\016*\034\332\242\343\036$\335\270\203\265\315\330\354\306\035GUno\027\320u\316Omq\355\247\223\032\274;\270\210\235\310\243\r\231H\320\216\007\363\bm\310Lf\0358\330\205\fD\030\211\025<\337\323\271\344)}\"V\006\215\313\375\024\267\027\362\356(\370*o\360\375\236x\315\303\036qz9\3376x\032Gp\177\023\024q)\370\344\333\240\"\0134u\022$\241\203\206{L\250D\240\3013\235\032\220\251r\006\202\257r'\2719\336Nrq|\216\227\363sv8q\246\220\202\333I\034\217\002u\217vM\337\331\0037\376\307\rBl\324\002\2244s\034\310\340\350\315\340\333OQ\017;\"+FN"
+	.string	"l\310i\f\336\306\277\301\340\231TE+\230\225\006.\370\037N\247/\370\306*\322a\300\202\n\336\002\272\n^\0075\321\n6\301S\360\336w\225G\327\207_($\370\t\"x\t^\004\234\253,\004\037\3017\224g\363k^\316)\205\352\034\033s;\t\301\367\035\025Q\313\326\b\200\257\236\3514\202l\026\370j\034\03050h\013\225\264\032\017<\206-R\236\324\316\262\252\323\212\367\364\201w\307h\\\333\201+\177=t\340-"
+	.string	"\337M\250x\264\n\274Z7\320\326\300w\027\265\317\232\200\323/q\213u\366*?\206\252\207vHtw\346p\306W\031\370\344{\225k\336\331[\235\214NE\006^\f"
+	.string	"\276\327\\\211#\345\342\202\300\233\340\340\236\003\026\250\361\013|\230\032\257\203\212g\325\032"
+	.string	"\346\213\214\247\023\024\023\343\253Q\272\213\223K\002\\\312\264\026*iO`\320x\023\316h \263\324\001X\031\357\232\204y\241@\026,\t\274\002\324\236\361\t\274R\337U\032\002\177\300\3170\263\"\200l\243\023\244R\300\367\037\360\355W@\322K\320\212\213\256Ria"
+	.ascii	"\231\001o\204\372\306J\200\214g\346\245\2372\026\343e\374P\337"
+	.ascii	"\021\027\306\307\370\276J\013\203\361\335\367\007\306\302I\277"
+	.ascii	"\370\244W`#\323W\235\\\334\207\342\344B\203?\205\007sz\001\343"
+	.ascii	"\f\343\fc\306\354\260\260\220\312\322W\331\250m\270/\276\253"
+	.ascii	"`\371&6\304<\275^\274\021*\033-X\025\035\342\336\212\002\236"
+	.ascii	"y\375\373*\340\213\330@Q\361\325\256\266.T9\264C%\027\277e\235"
+	.ascii	"\026\266x\002\336\205\022k\013\272@,\213\357'\340\033\320*GK"
+	.ascii	"\n\026\337dS\026Jo\201jH\303/v\003\254\360I:\215\n\267xX\205"
+	.ascii	"\342\253\\\"\316\313\326\211\244\017\2015\226g\342\304\253x-"
+	.ascii	"&\262\245g\372\366\361[\361K*~\305\033\301a=\246\370\001^\351"
+	.ascii	"\373J,\352\333\227ZS \275\020\006\242\370\376\001\276\267\215"
+	.ascii	"\f\323G\230\202\242\231.Q\337~\024\305\343\240\302%}\265O|\322"
+	.ascii	"s(\263\213\273z\214\236H\323S.\236\355\230\177\235k/\266'^G\330"
+	.ascii	"\243\226\315\204#Z\230c\t\3056\361Mv\375k4\361\355\330I\2640"
+	.ascii	"G+\211\257\262\266\333\204!j\303\206\302\302\b\320G\334\022\337"
+	.ascii	"_\256\177\210\236x\244\315\371\366\346v\262\304g\200\3421c\201"
+	.ascii	"\006\210DB\200'Q\310s+|\317\t\263\002\fj\031K\b\347\b\351\350"
+	.ascii	"\221\004yn\205\237\n"
+	.string	"\017\314s\364\275B\330`\277\361a1\372*\317\365\031\016\262z\337*\022F\337U\256w\3137z\027\274Z\274\272\037\317-\2311\257p<N8\0232:\311\336\347w\234qN4N5N5n'\227\337haz>j\346\315\362\253L\364\311\317P\345\252\367tX\217EE\377w:p\241f8sN:\357i\321\267v\212\325CW\220b!\372*\017}\362\223\320;\206W\275\021Ot\305\023\247F\371#\276\023\033\231\246\345-\214\0253\207\336\f\307\025\361\312\357\253/C/\342C\\\345\364\260\036\253|\353\306\365\246f\370\345\r}\027621L\320\312\206\f\234\272\031a\355\177\fw\006\337\364\224!\376\2670\t\361\215\247\027e\023\001\"\207khg\0349N:\336S\020\337w\272\271\260\244ti\263\311\262<d\206>\374\334\271\376i\350\"\327\303\177\260\263\201\367\364\362\360\3140;Z\r\357\373\206\3500"
+	.ascii	"\275\016/#\314\216\325h\273\335\202\340\360f\217\203\226\306"
+	.ascii	"v\273\375\260\341\177\324=\235|O\351\206\227\021\246g}\364\320"
+	.ascii	"S\256\206\377q\005t\366\371\234\234\263q\342q\3769\363\344q;"
+	.ascii	"\251\341A\b\313\323\2625v\370\252\237\265\320O\035\327\322A/"
+	.ascii	"\244&\350\223{}Y\2615E\016\016\327>N\246,f\027p%7Z\232\260i\262"
+	.ascii	"\201\231l\032\"\360n\347\240\313\354$t\032\372\025\216\301Z\r"
+	.ascii	"\200hG(\3246\334\f\317\274\002:\021\235\214\215\237\367}a\260"
+	.ascii	"\277\375p*rk\t\034d\311\b\223\t\b\t\035\202P5Eq\220%\037P$\f"
+	.ascii	"q\220\245\247((*\246!RQQRN\"8\310\322\224\023\017'&\223\023\021"
+	.ascii	"\007Yb>\031\201\212bR\036aR=E=\ty\302A\305\224\302\300\307\023"
+	.ascii	"\263)\310\215!O\"\236\250\232\232\236|\b\025\221\022\242\201"
+	.ascii	"\n*\n\212\002\034>\240\2424P\005\001\002%\304\201'!=\232\250"
+	.ascii	"n\f\201\n2\302\303\247\210P5Q\335\b\242\032\362\344\304|\302"
+	.ascii	"\340I\b\025\225\0243\b\225\320\223\tPTN\013\b\221bR\r\221b \210"
+	.ascii	"\323\020\"MB:L\3458\322$\344\251\201(f\323\024T\003RTD\2326<"
+	.ascii	"\371\220\252`\210\324\tPL)\b\236\246r\fir\3320\225\343)\n\n\007"
+	.ascii	"\325\220'&\223\210S\006vZzbJ919\375`\032\002\325\024\305\344"
+	.ascii	"\304\234bZ\372\300R$<1\231\250\244\244\230L@O\205\003\233\t\027"
+	.ascii	"7\327s\215\252\2176\371R\321B\200\355\245\324\275\365Z\274e\205"
+	.ascii	"\211\234\376Z\362\317\330K\274\224\374(\371\337+[\303v\205@S"
+	.ascii	"\026\006k\005\246\271\264\336\253\\y\202\321z\344_\031\030lt"
+	.ascii	"\353\253\354\255D\251iL\241\344\265\226\212\356$\2575\315\372"
+	.ascii	"\236\022f\275\016\263@m'\311\362\204\002\275K\354Z\t\326?cc\265"
+	.ascii	"i\255\253\177F\023WbS(m\264\331mO\247\344\211s6\207\213\023\267"
+	.ascii	"%c\"[g\341\351b\366f\361\220\313\363\214\255\351\345y\026\224"
+	.ascii	"\206\t\266o\021\261\223H\237\001>\351\003\025\302\231\211\255"
+	.ascii	"\341\371\351\301\323XV\357\310\275&\230\266\372V\301\214\215"
+	.ascii	"V\315\027\324\257\257\242\017\342NG\037\310:eZ\005\246\245]\365"
+	.ascii	"B"
+	.ascii	"it\272\253\336\007qJ\366,\013m\253\206.\001\204\342\365\373-"
+	.ascii	"\330\321\347\013\245\t5\303<\337\245\335gi\230\270i\263s]\345"
+	.ascii	"\374y\235\337d+4\024n\254P\355\016\\\277A\317\006\306\345\r\357"
+	.ascii	"\371\323Sn\363{\210A\276A\326!\3354\255c\232kkn'\233\257\303"
+	.ascii	",\316\352\234#{\202m\276h\310\230\240\200B\022\205o4d^H\276\352"
+	.ascii	"\027\236\207~n\314\234"
+	.string	"\200\344\233\254\r\311\373\231\255!6z\344\004\013'\3743k\004\016\257\b\273\3051\341\b\273u\222k\344\217\2201\202h%R\004Y\344\237uT*l\327\370\361\256\311\230)\023\236\221j\3105'\227\267\346\365\352^h\021.\2217\341_\356*-\332\204CZ\235\\\232qH\264&\232\023~\357\373\302\350$#W@\212i\252i\3125\347\232sn'\211|\243\215\t\"\267a\260V\374\306\320\r\221Ie\201\354\372\227\344N=\225\227\251\357'c\201Z\207\226\345\271\226\300|\3463\277\375\266^\260NB\t\337\211?%|{I\221\360=\220ZM\302\367\231-u\210\324c\351\306\266\341F\275\324\003]\367\304\301\002\213n\243\206\\`Cv\221\033\365C\220U\242>\306\237\220\257\262\020\"!\337m\266LF`6]c\355\334#B\n.\324\006\331M7p\232q\024\261\322G\250\021\222\\\021~\2040\021\036H"
+	.ascii	"\216X\261\265 P\036\305l\365=\356\001\361G/&\316\346\274?\240"
+	.ascii	"\274\223\334 \017\365$\310;\307\342\036\245\020F\201\206=}\225"
+	.ascii	"/\340\252\263g\310\267\305\307W\331\307\232\036\254\271\036\276"
+	.ascii	"Bw\340\032#\326\\\223Oi \257\365\303\177\274\363\t"
+	.string	"\326\321\t\331\325\314M9\315\275G/l\333v\353\330\243\351\313\273\233xz\315\275\306-Sj\b_\375\273~\372)\274\376%\271>\376\t\271\304\307\373\020*f\273m\273}\344\341\364\237\270\345\336\315>\227\271\211\247\371\347=uz\227\311\024+\007\241\307{Z3O\217o0S\242\017u\334\321\364=\272\3513`\351\275\332\254\216,\017\341\231\233\203M\302#FZ!\245\3171M\303&b\023\321\355d\b\337B\fQ\013\346\003\036\337X\236\261y\374\216)V\036\200\360=\220\320\246\"\b\377^\212fbkMm#\230\306\016\032\237gT\016v|\017\344\216G\022e\203\257B\235\271\271u6:\301F5\320\361=\214t|\267al\314\361\301\242\177\360\335D\f\357qM\316\027\034S\022\343\320\371\260\206v\303\203o6C\017\336\007\212\330\205\337\264\3522 t\212\301Y\374\276\3663\214p\260\352l\240\340\302\""
+	.string	"C>\f\364\260\2112\212\211\376]\320\301\367\227+`\236\016\336\00319+\030\007\377\367p\246\205\024|?\007\337*\210\255\211\3421c\301\nx\3144\261\262\234Z \342\350\272\230"
+	.string	"\f\204\343\2503\202T\351\200$'%R3\"\"\222$I:\263\025@@`P0\236\255r\316\007\023@\r)\203IA\226Z\006\215\220\202\202$\205\2159\230\221f\253\271\\\314T\303\032\315%\301\275u$x\207\035\342O\343\246\022F\347\355~+A4\"\327\365/\346\023\334\223\t\fkt\271s\201\353\213\227\310\253\0339\022\262b\025g|\024-:\200\322\301\217\251w\365P\256\211\214\223\373\n\372U8[)_\006s\371VcT0D\367z\263v\261;\217\013\240\177\022\003\005s\210\332\023\377TAa\036\340w\330\353\324#;\266\222\005\017\275+\326\001?\365Y\276\263\351\271\036;f)\005\034E\206\311|\037\216YP\245`\323 nJ\240i.&\320\356\242/\211h\271FK\022\2328F\271v?)\352\023\344\326"
+	.string	"M#\321\316\375\035\376\315\210"
+	.ascii	"( \344\tT\0038\266[qCXV\252E-\"XB\346\332N\267\245P\320\302\223"
+	.ascii	"\207,\272:\326\351`\"\323\276'\345\342$b\025kK\333x\361Ux\355"
+	.ascii	";8\034\302\304\337VqM\341\016\232E\272\231\212\214T)a\326\320"
+	.ascii	"\335Y\260\374\272r\346\"|@\330\177\331.pn\300\236\331\007FQ\334"
+	.ascii	"\366l!\241\244\2170#M\007h\213\217'\031\364\"\001u\362r\233G"
+	.ascii	"\342\340\3456\006\365\370\273\314\304\350\003'!\2374\235F\230"
+	.ascii	"\333\224\206u\343*\203\356\222\"\250V;{\331H\230:IOn\336\006"
+	.ascii	"\003\203\304\350q\202\004\005\227\033d\311\343\230\t\362TJ\353"
+	.ascii	"\326ZEK\337\230\343C>\240\260\226\214\322O\264\360\342<\246)"
+	.ascii	"\003jGPc\201\013\317\254\024AD\265\002\022\263\322\333\365\316"
+	.ascii	")bA$\213\332\210\347Z\377i\030\212h\306\356\263\354%\220\275"
+	.ascii	"\031Z\3237n\304F\034\003\230\241\341\f\273\235\244\234\207\357"
+	.ascii	"\312\302\264@\2424,\204\244#cnr)\021\351\025\253\234\334\306"
+	.ascii	"\366\373\f,\257\350\221S\367)\256\311+\341"
+	.string	"\351\331G\n\362\303\036K\023E\275fm\237\321N\366\017e\233\334\022\222}\305\244\265#\370f\016\3109\341=\013\356X\277\252o\211\210\020\005^4\213\252q)\022s1W\030\316A\f\033A0\351[\254@\f\214\347\341\033\334y\251Y<#\3265\"\0272\020\016\032\267\342\024\b3^\232\230\024\030\275i\326A\366N\250\302T<\307y\016\341,\032\374\212\231A&\002\354n\202\371\027\2015\210\200\351~,1\247I\r\246\367\001T\031I\267pB\324\257\357qY\317\276\031\304\226)\335lg=]\374o\266n\254\0254!\214\373\003\211\237$\271\241_\243e\024\361e\205Z\217`k\351.`}\265q\250\377r\203\200\276\r\251\f\365\002\256\037{\263\340\002\300\223j\361\2066*1\bO\251)\004q\275\346]Xt\303\207I\206\203w\026\324\243\317\205)\013\377\203\3238.\200\361\326\354\353\350\333\262\241IM"
+	.string	"\371\264O\355\001\230v\250\234\255`\333\210?9\325\360\277\005eB\234\365\341\026\302\022\270\3024\3029\245\235O\201\t\013\002\244\323\200\303\304W%8t\373\006\222Z\225BI$\n\322\034b\002\024!>\264A\016DLK\325\nTrm\304PdfRwU*\357\037\345\227\032\241\177\306\004/\243*-\324\006R\243\004j\311\2134\244\261\226k\341\242\353\220D\336?\2456\001\310\254\002\024\272\272\236tC\022\265%N\247\322B'\3120\nQ'\034\032\356\020\007\363\260\016\f\300\201\002\323\205\030\205A;~\004\200 Q59\\$Xy\336\020\232\311\b\372\267m\322m\031\343\256\270\333\177\365H\217\300G\204\373\223vn`*\006\026$\205\362\363\350\361}\352\267\t/\263h\\!\221e{\214J|\215/^s\310\217$\324h\033\342~\020\035\003D\016\006\375\245\240Z\231l\302\263;\025\253N\225"
+	.string	"\035;\001{\267D\333\233\264\203c\037\233 \214hZl\322\036B\275v\227 \"\233E\315\200\325A\224J\022MS\f\262\002\037\0162\264#@\247\240$\353\310zu\276-\342\031"
+	.string	"\202\tL?\244-\033B\363\351\342\375\216\006\"pQ\243\005\317B\303c\223\373\035X\251R\344hI\215\227\260dQ\310\035u;\002\276k\025\005O\204\240\031\2364l\372\261\206G\177'\3530\226\233\025{\361\313T+\2654\313O\310\341\262\347d\365\230\316w\016\244K\363\367\347\357\362G<\201)?dX\370\337\272"
+	.ascii	"A\r\004\321\362c>!\233\332$>b\375a^$\001\354\315\337\366\362"
+	.ascii	"\324\255"
+	.ascii	"0XF\032\231\017(6\233\360\003\213\242\n\234<\003\274\020\334"
+	.ascii	"\221f@X\002\021E\003\346/\272\311\023B\351\266xL\006c\361.%6"
+	.ascii	"\231\313=\0132S\341\254\301\326\232\362\311\362\325_Vb\3540n"
+	.ascii	"\213w\213[L\007\350ZWp\366D\232c27\314\342\t\n$:=+\332!\016\342"
+	.ascii	"\022#\276\210\270*\006\023\367\221\312\006\001-\244\247\342\202"
+	.ascii	"\201\222=\201\312\344\207 \363\b\250\316\037!\2438)\261,\312"
+	.ascii	"\032\365[\357\020#\264\nLJ39\216\300UR+\223\333\315M\006\035"
+	.ascii	"\2152\311L\302\220\033\306\337\354\206R\313\231\310\210\216e"
+	.ascii	"\227\242\362o5\311\023t\205\361$\302\361\034\244 q\221\377\300"
+	.ascii	"\357\221\245\331\r\315\354{\315\335\001\221\034s/N\306\335\373"
+	.ascii	"\023\343/0\363\021\013\241'\235\353\223\365\245\310\316\353\341"
+	.ascii	"\326=\267b\347\361C\323~T~X\335tTu\034O\030\360\261g\334T\032"
+	.ascii	"\324\240\347\311\230\r"
+	.string	"\335\316\020\373\b\337\235R\315\026\331a`\241v\261\264b\377$.\355\032\356\035T\211\b(\353&\030\nn\216\237G\257}\330\375\b5\317\202F\320\tyfl\311N2?\362\226L2w?\033\304\255\016g|\024\002tT\ne\245\213\267\225C\347\212\2237\344\246\342\226\032o;\211\272t\372[1\nN\004A\332\2355\240\261\320\377*\373r\361u\031A\342H\3645\376K\\\022\rJ\023\273\334\251\237\022\241r|\by\354\302*=\034\327\372\335\331TO\226\2773@\036q\254\244\236,\211\326\273+\016\345Z\340\326uT\3003\347\217\202\346n%B\366\360\023\227\313\311p\270\326\314\216~A\240\310e*\t\321o\013\330\004\003\225Gc\355b\353 \344\372\022\377r=\223A'\221\027\365\bv4\372J4\333r\275\024\324\1779/\227{\2151\007!?\3158\345\037\034\006\021\023\347E\3453\267r\233\262t"
+	.string	"a\306\274G\335\205\321\342\255\333\224\276\020\233\206H\330Q\210\301ur\020 }'\303]"
+	.string	"\264\034\336@\242i.5\262\266\315\270\204\222yqW\273r\302\310\017Y\013\315W`E\0072\2701\262.\364}\226\005\367{\255\227i\317\202d\360\335+P\355\224\\\217\301\020\024J\204h\244\204\310O/r\374\212;\263\004\016\260\262^\274\267\031\342\245\261<\021X\330\254\b\237\2422Vt\321\256\213\031\320\264Q\220\230\252\177\352O+\341\335{\277\205<s\025\210(\254\213S|\016\023\270\324\336L\301\b\341\242\003\370W\257\240\037@&\356\342\001\315L\244bv<\035D=v\243\"F1v\372c\325\231s\343\226\031\313w"
+	.ascii	":\r\366\025\024/v\337\\F\023\264t&a\355\336\227\376sp \301\002"
+	.ascii	"0\211\202L"
+	.string	"\013l\306\266\261\204\022\347\245\007\342m\200\313T\036A\">\272\333e\216\n\262d.\302 \256Z*\327S\336\353c\352/I&$\363yLD\272~\353\222\006\037YS\217.\027\233\224\352'\250\320\037\360p>\355\323\375\371\213\223(1\377{~\226*3\374\251I$\344\234n$\037T,\335\027\274\366\253H<\023W\\\345v\341\016\312\272\b\223\235\225\362+[xb\304\370!$`\236\233\377\305\037\225\257\200t1\326\254\315\320\353Y\315\016\303\367&\031?\243\343\302\200%\311\237F\252\004\224\316`\t^\026\031#\022\314\026\351\32151WK\357y\233\244\\\250,r}\217\273\bk\f\307Z^\224\243f\367\\\2000iL\314\342\225\302\324\033y3\205A}$\220\t\\\345H\336\302\241B\371 \354\rn\330\034\331O.s!\264\031\231`\270\334y,\222\322\0232\027F\330~P\2070h\332\330D\2622"
+	.string	"u]M@sg\266\f\\\2305,L\261RQ\217w\036\005\222$P\022\373`\231\261h`u\257)\033\002\261`\035\243v|\223\013\377\316Qd\\\242\266\233%\242*\367\177\027\371"
+	.ascii	"\f;\006a\217\227\345\362dG\323J\247\250\016\0040\336\274\223"
+	.ascii	"!t\320iI\034d\005\207c\314\007Cx\212OBx\026KG\026\236c\312\326"
+	.ascii	"a\326\322DNu\341\3243\340\365\261\2514kC\002\336\352J\007P\314"
+	.ascii	"\302Wot\311\027\277\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`\307\026-I"
+	.ascii	"\nqt\03090\244J:\357\374>\nj\310\013\343r$\326\211\230\311\221"
+	.ascii	"\203\317\2233R\2205h\244f\363e\f\\\013\t\275\220\240\241\003"
+	.ascii	"\220\301}o?\232\273\275\370\004\240i5\265I\222\001n\001o\001"
+	.ascii	"\205\001\375\250\230~\334Z\337M\255o\027\246/\007\246?\367\245"
+	.ascii	"\037(\255O\367f\263\311\254u\264~\333\275pc\2277\271\334\371"
+	.ascii	"-\037K2K\021k\302dH\220\263\363h\302#\254\311\017&?\304t\004"
+	.ascii	"Q\002\201\257\226]\313\261$\263\364\343\230\365\341`\351\277"
+	.ascii	")\353\257\251\332ws\262\177J:\373\317\217\365\327<\276\331G\323"
+	.ascii	"\3753W\372eR+WLV\371!\225\023N\271\231$\243\224N\331(}2)\224"
+	.ascii	"\376\230\257\241\275\235=\351\213I\235\334\260I_M\312\344\220"
+	.ascii	"\304xq\311\371\222J\376(\231\244\277\206\244\037&=\322\357\222"
+	.ascii	"\0329\264\bG\022\341O\311!\357$\244\237&\r\362C@\270S2\372\243"
+	.ascii	"\317%\254\277%\365\321\327\222\366`H\036\374\270\203\035u\\/"
+	.ascii	"\007s\302\301\21478j"
+	.string	"\203=%kt\272'\245q:\251\263\351gF?\213\214N\001\305\350\264O\n\243S1\351\213\017rq\266\305\367\2608\333\212\303\251\340M)\016h\253\351t\2527\032\215B\242\350t\355D\252\232x\233\274\315\022)\031\211\017\216\350\263\021\2216C\334\023\210~\233\364\303\353<\\P\262C\377,\345\3207K7<M\303\3212\374\013\206\203\001\273\337\205\367mY\370\333\325\261\n\367\222df\250\246\323\331\354\303\334\314yi\007\320l6\233\024\372j)3c\t\nWL=\347\261\371\221\304\226\226W\f\323\362\212\265\231\226\227\211\212\270\274L\022\227\267J\0250hu\005\250?\233c\242\036\267Vw\212\245du\247VB\336c4\251P\330\271PO\216\rC\255\256R\225D\245`o\314\215'Q\tR\335*\366V\315C\374\247\274U\352\275\346\f\031Py\247\332g(\f3\265\376M9\277\366)\026\304.\312\365"
+	.string	"\312\264_8P\031"
+	.ascii	"\221\031JQ\353\007\340\035\222\341@\345\202O\226\3328P\251\274"
+	.ascii	"P\353S\271?\265@\fI\352\276\375\033\005\342\303\366\365\227\315"
+	.ascii	"1q\021\373I\335\260\217q$\251\313\325'u\243Z\250\366\016\324"
+	.ascii	"\374\2511\037\337\275\376\343\242\276\243^?\222\242>\247\274"
+	.ascii	"~c\242>#\242\376\246C\375E\274\276&C\375\304\273>b\241~&B}L\203"
+	.ascii	"\372\227\330\276%A\375Jv\375\302\272>%\272\276\340\\\177\222"
+	.ascii	"\\"
+	.string	"_R\240~ \240>\340\237\376\237\237N\265\364\351#\342\323g\024\327o\264\247\357HO\247cy:u\302\365\357\360\364\r\335\351\357\331\351/\252\323W\364\326\317\243\323O4\247_\310\255?\247\255\017)\247\217\307\326\377\023\247\357\007N\277\317\233>\237\265\257\307M?\317\263\217\247M\377\016\233\276\2355\375:j:-K\323)\0264\235\232\235\3514\213\231>\2412}9d\372\221c\002`\023\300\356W\260\033\006v\t\027\352\371+\220\200\200\r\335\312\221_W\331F\277\256r-\374\272Qm\363\353F=\3778\217\006\0131\277\356\327=t\371u\303>\366u\263\240]^\r\350\312\370\320+\301\343!\177\362b\276AD\254\366\351Y\363\214?y]\002\352\271\b\335\370\222\327\275b\317\210u\222x\321+]\304(\310\200^\027j=\244\327\r\363\272S\320<Y]wJ-\354\272cW\2037yc\374\330\305\201k"
+	.string	"\351\361\246\256{h\227\242\345\203\313\005e\336;\267\230\027\252\335\304\274JF\346U\0062\357\024\333\310\274W\234\230\367\n\220\311\207.\305A\263>\335B\246\222\032\253\310\274\005\332N\314\213\345\211IEh\307\f\212]\334\272P\352\257\340\326\340\030p\353\236o\353^pK\223V\226\242\202\313u\265\322\362B\261\2370\t\021.J\205\214b\r\227W\311\036Ab\234\337\224z\2512x~|\270\214\360\367|\nP?"
+	.string	"O\243\241"
+	.ascii	"\366\267\252\352^Z\336+\365j%\260\376\004\332\002\352\257\233"
+	.ascii	"]!H\005\260\260\244\226\027\353\300\2015py\017\264Y\352\031\320"
+	.ascii	"\361kf\255?Y\"1zY\354\257\226\"\255\347\257ry\265\332\036\352"
+	.ascii	"\337c\375\025\\^\037+\220\025py\201\264A\332Su:\203\211\013\227"
+	.ascii	"\227H\221\225=\027i\177$\355)$j\346%Y\177\365\bS\223\017\227"
+	.ascii	"7\t\373c\222\003&\312|\313<\005\325b\274;\345\004\203Z\331y1"
+	.ascii	"\336U>\251\030\357^5\303x/\303\206.\224\263\016\332\305w\274"
+	.ascii	"w\b\315\335\r\373\035\333D"
+	.string	"\0071 \337].2|w\231tL\350r\221q\335\rCtu\305\3632\366X\332KN:\256\273P\214\002\3263\243\303;\320\233\255\r\030!)V\265f\\w\347\250\345\251=\013\327%\335\034\332]\022\231\\\226\335\323=em\031\236\353\265\270i\237\340\357nS[\253\036Ab\\\037\003\276\325i\177;8w,\370\2742\360\257\013\256=\003\303FV\214[oEf\351g~\324o\231\355\261\342\037\365\313@|~&\247\312\261\337\"\3272\340\334s\216\345\002]\363\230O}\227\301\365\221\371\006\333\377^\b\327\247\3545\274\235\2459Za\373t.\032\205|\232\341z\250\236\025\315\214\241y\332\3212\255\277^(E\n>m\375\202\330.\262}\215\352\337\327\310rj\035\333Gu=7Z\244c<Z$\373\264\310\366)\363\255\347\310?\265?\334\310u\367\321\366\r*1\"\304\212|,\332\263\215t\323\376\232"
+	.string	"\021\016z\232\n\b'0N{N\244\2238\306\201m\353\031\2349\341\230\317\255\005\243\336"
+	.string	"\245N\214l\230\267\366Y\216\215rW[\177\353\364\341a\277\006\307\212Q\025\327=- \327\3354\216\035\303ua\016\355\b\315\275e:\246\273Qm\224zg\201\274\250q$\t14#2\222$\225\341q\005\204A\347\030U\035\021 \241\223\214\210\210H\214\210\210\364\037\300l\271\260\342\016\350\313\177hB\315\216\247\362%v\370=\331\\(\231|\003"
+	.string	"%\230\034:\024ct\26335\206\255\272\370\032@f\032\202\n\260B\306\375iz[y\306TS\266\311\240&\225$\210\006\375\223c\024\004\003u\214\003.\036|/ \331\031X\246T\2515)\356/\211\366\35002(\303\307\267~\335\265\215\"\365\351\370\362\260\250\2123\325\345\017\350\367P\227\350\306K=H\r\323\005\031\323\336c\251\n\324{-9K\216(\033\225Sc\366E<\247:Q2\255\252K]P\265\304\212\331<\201\320\"\334P>\316fr\024\240\032\263\037%\202Q\3548w(\340D\271\023+\tx#\234\025\020 0\335p\374X\300\335\211H\251\265,\334v(\200)\031R"
+	.string	"\313C\356"
+	.string	"?\254\022-h\335<t\257\247\212\263m\372\322\273\254\321<\300\323\214M\2538\210"
+	.string	" \215\325K\247E|\213\260\005$\310\"O\034\244\234&\3621\207\3546\217\241\335H\373\013\f\200\310y7Ba\030\254\232\275{\245"
+	.ascii	"\332\325(\301\335J\366\b\007i\217\315\201D\240A\352\006~\003"
+	.ascii	"\254<$]\002\224\363\320\331\273\250\223\242\3702\026\255\216"
+	.ascii	"\275\364\275\370q&\022\236\373\276!?SJ\206e\031\351\215\210\212"
+	.ascii	"\376\274NR\\\023^PU\212Y\315wa1\212\273\312\254^\360\255r\333"
+	.ascii	"/F\364\203\303\320\305\240X\235\234\314'5\2626"
+	.ascii	"\263\255\231Mp\037\031\227\005}\322~i(\343`\250\251\220\266\340"
+	.ascii	"\374\307\023\247Z\351~\002\020\013\317\210\bkn\262\254a]\252"
+	.ascii	"K+x*\244\004}\236\262sg\256\365\016\235\231\324\267\007\307w"
+	.ascii	"\342\301\361\225\003\205\350}h~F\323E\177\334\350\362\036L\003"
+	.ascii	"3w\252\356Z\354\237j\313M~\n\230z\371\213\300#O\355\021e\r\364"
+	.ascii	"\300\255\242\247P8\024\016\205C\341P8\024\016\205C\341P8\024"
+	.ascii	"\016\205C\341P8\024\016\205C\341P8\024\016\205C\341P8\024\016"
+	.ascii	"\205C\341P8\024\016\205C\341P8\024\016\205C\201\003\301bw\206"
+	.ascii	"_\372\221\200\261\343rE\354F\002`\331\332\017\032\020Nt\274\343"
+	.ascii	"\325\304\0075w,\203Vt\210\002-\233p\243\263\260\2075\221\245"
+	.ascii	".\240P\021\024\325\205[T\245\363\263t\026\217b\273\236ft\345"
+	.ascii	"\327\316\013d\374\365R\024\337@CY\\\313e\375\224\363\315%[\232"
+	.ascii	"_@\213bL\246\257\226\032I0S\377\200\005\3246y\3058]\337Hx\266"
+	.ascii	"\"L\f\251+\362\t \322v\244CX-f\327\247\245l\234u\335h\344@\230"
+	.ascii	"{\035/?N\274\215\004`x+p\3110V}\241\260G\273Da\210c\033\315\263"
+	.ascii	"\223\213\037\n\347 \327bR\034\254\231\006\233\227\230\253"
+	.text
+	.section	.gnu.lto_.refs.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`.\003\365\025"
+	.string	"\006\365\220@\320\032gX\003\020\301"
+	.string	"r@Q\004N\262\005G\001\3404h\004l\006\233\0018N\356j\006\271\232A\256f\320\302\f\017"
+	.string	""
+	.string	"J\213\302Q[\033\341\007\005|\002\337\320s\215\232HFMD\310\226)v"
+	.string	"}"
+	.string	"{"
+	.string	"\262M=o\260<\256\255\235/v\300\326t\363\350u:\243\203\344\234\b\347\005\333@7\363\304\216\331\334\030\233U\260[\252I\003s\347uo\\\313\254n\311\\\326\353\302\314|z]\222\314\347\n"
+	.string	"\246*fT\353\022\351\321(\2134\266\032F\365IuI\365H5U\032"
+	.string	"usN7\266\r;]c\2724\245\373:\3552\335\272\313*]\024i\323\350\321\366\335\255I\2645\263;3\273\325sS\333$\234\013L\377\350\301\303\365\035\264[\307\353\306A\273\302\353Np-\201v\035\320\356\002\332A\265\201j\317j\007\330\031G\3011\330\260\004\323\f-\023;f\273\365\272'\327\245\025\202X\031\330\215\021\232%4\n\366\351\300-mg"
+	.ascii	"\365\266A\367fW\340\n\321\356\001\240k\340\347\316\b\334\023"
+	.ascii	"[gv\005\370\\\033\234i\266\373\332\216\351\271\255\355\256\266"
+	.ascii	"S\262\213\n\tn\"@\027\002d\350E?\267\217\237\367\370\371\251"
+	.ascii	"\375F\355\t\265kC\007\305\246)\370\007\366,\301\262\241w\266"
+	.ascii	"oV\327\314\361\314k\216\353\332.\0242(g\035\322\254\234U\244"
+	.ascii	"ar\276Q\013\246\233\202\253pS\244K\021\336\"\244@:\363\272,\327"
+	.ascii	")\241Q\023$\224\006A\270\264\007\0039\270<\253\005\304\206E8"
+	.ascii	"\005\341\323\203I\0166H=\335-\335$\324\035\235\356\2352(\r\017"
+	.ascii	"\331\032\331\026\331>\214\236\254\207\353p\257'\207{\007n\270"
+	.ascii	"\007\253\341\322\270f\r\275ZtS\213\206y\335\3155\203\351\315"
+	.ascii	"\021\303\335X\254Pq\307\335R\240\270\343\315\304\366&\242\365"
+	.ascii	"q\311\002\341\036\226\007\237\025)O\224\034)\"\252\343\263Q\203"
+	.ascii	"\306\f\0311`$\372^\370\334s\321\"\321=\026>\337\212\024\261\357"
+	.ascii	"D\t\234\217\304\b\331=\021!d\037\b\331\375eu/\333\273p\331\242"
+	.ascii	"\345\212\225*T\246D\201\342\244\t\023\240{I\022$\0015 \200\""
+	.ascii	"c5\362\001\233\004\200\203\351\366\324K\270~k\031\240\\)\337"
+	.ascii	"k\031z\005\243\265<\356\231\027\223Hy\0274F\020\032\217\226e"
+	.ascii	"p\321\006\241\301\343\265k0\331nc4\301.c\027\023#\332\301\215"
+	.ascii	"i\022$;Sc+\2034\201\371\202-\300\355\212;\006Q+\303nHv\227\033"
+	.ascii	"\322\022L&\204\035\013\275J,\032,\023\030Q7\356\313d\017\346"
+	.ascii	"\355\360\"k\240\001"
+	.text
+	.section	.gnu.lto_.decls.3e86d57d51d3abfc,"e",@progbits
+	.string	"(\265/\375`E\225UV\002\252\273w\322S\020(e\345f\f\373\371\202\223\005\017\365\033>\006\\\245\313\354\300:h\311\007\032D\303DD\217\342\001RCc>\017\343x\203F\327\266\312\215\363f^\030F\001"
+	.string	"r\277\b\200\331y\365\3534\b0|\025'\032\206 \300\3718^\020\242\254\311\356\225+w\nu\013m\r\310\r\031\264lsinH+0\203\322g"
+	.ascii	"\333\317p\265\237aj?\303\322>\206\272}\fr\373\030\320\36618\331"
+	.ascii	"\307\260\265\217\341i\037\310\316>\220\232} \267}\240,\373@`"
+	.ascii	"\373@A\366\201\246\366\201h\354\377\310\331\377!\263\377\263"
+	.ascii	"e\377\207\311\376\217\326\376O\325\376\017\215}\237:\373>k\366"
+	.ascii	"\223fPz\237.\373>W\366}\276\366}\204\354\373\350\330\277\220"
+	.ascii	"\267\177An\377\202\332\376\005\260\375\013[\373\027t\354\367"
+	.ascii	"\350\355\367\254\331\357i\333W3\203\322\367$\367{\270\366{|\354"
+	.ascii	"\363\354\355\363\234\331\347\351\262\317\303d\237\007k\237\007"
+	.ascii	"\307>\260\316>s\374Yi\332\231o\356\022\037X\2626\317H\374t:\325"
+	.ascii	"\276\320\330\313\372@9\373\3004\373qfPz\240\333>\260l\037\230"
+	.ascii	"d\037\270c\037\210c\377\231\357\347\322\237\367\3143\247\022"
+	.ascii	"\007z\220\360\320Q&\3533>\223~*\345\276S\351\003\2548V:\225~"
+	.ascii	"\366\342X\351\3074-0M\013\264\230\326\022\263T\037Hc\233QH<\363"
+	.ascii	"\375\314\245\321Q\222\365\177y\373G\267\377\003\263\2774\203"
+	.ascii	"\322\377\324\366\177U\366\177K\366\177A\366\1778\366\367\336"
+	.ascii	"6c9pR;-g\236\262\276\t\007'{\311rgRm\243i\375X\302\311s\031\215"
+	.ascii	"V\007L\242\370\334\360\2269N~\223\335d:S\231\341d67\365r\033"
+	.ascii	".p\362\232X))\004\2578\2734&\0253\256*N\222\203\001\223\230\317"
+	.ascii	"\r\217\004\234\254\006j\031\307I\021\"\204D\210\020q\301\310"
+	.ascii	"\333Y\227\036m\306\346\206\364;\315\376\026\263\277\321\366w"
+	.ascii	"\225}F\213\031\r,\261\254\277\271\366\267\226\031\017=b\322\230"
+	.ascii	"\305Y\177C\3552\031\316T\346\270\fFJ&s&\325v\232\226\215e\216"
+	.ascii	"\313f\371\213\217\022P\314\244\325\204\004\326!\371\221\3521"
+	.ascii	"B\027\212`9\021\222\365\325:\373&\032\225\275?\213\311o\2462"
+	.ascii	"\207\311nda\240\220|naq\034\213\020\022q\332!#\263L\365\325\344"
+	.ascii	"\276\332\265\377\334\366\374\345\317l&\035Y\034\307\035xt\304"
+	.ascii	"\261\361\221u\t\022\317mi\230\227\026\354d}\325\307\326\271\313"
+	.ascii	"Z\246zb\232\313\372\177N\313j\2462\257e4\263|f\306\031AAL\314"
+	.ascii	"2\216\343\265,%o1\343\214\240\3007f\031\307\261\007\021\"\264"
+	.ascii	"\023:T\350\244\372\352\322\316gi&\226\217\216\262\260\037Yg%"
+	.ascii	"\211g.#p\r\021\313\3724\203\322\247}Z\204zn\340I\311\372)\232"
+	.ascii	"\375?c\311d\271,_1\2259K\256\362\234\214c-l\254\244\241Q9C\322"
+	.ascii	"M1\323|\3208\306BC\306q\234%'\31543\316H\254m$\357\256\302\342"
+	.ascii	"8\026\022!B\204\210\037\033YWr\200\372\351\327~J\265\237J\355"
+	.ascii	"\2478\366\323\032\373i\274\377<\366\353\n\003\325#k/&\035:\275"
+	.ascii	";l\220z}e\334\274\301Cz1\321\354!\331\264\261C\242F\032r\f\031"
+	.ascii	"\363\355L\"\325,Z6\226tp\314:3\256j\204\2608\313\261\234DF\315"
+	.ascii	"oz1\327\344\321-\211Y\232^\314\271;z&\237\371\266\306\224\373"
+	.ascii	"I<\231\375\271*\007\311M\262\220\214$/\311O\262\217\354\225\301"
+	.ascii	"rXf\222\255r\224\374#_e\261\254$C\311X\371+\267\220\221yH\346"
+	.ascii	"\312F\262\223\274\225\265rV>\222\223d\"\031H.b*sW\346\361L\225"
+	.ascii	"{<'\017\302o\352\345\031o\246\027\323\214\371\306g\306\375$r"
+	.ascii	"d'\245\251\227i\270!I\344\256,\225w\370\234q<\204\n2\216\343"
+	.ascii	"\233g\240\266\204i2\337\320\320~S/3\205\031\363\223\260qF\"\337"
+	.ascii	"\310N\\\226l~S/+\2159\363\233z9\206\203\373M/f\231>\275=7a\304"
+	.ascii	"\230o>I@\361\322\334\r\244\335\0348H\0229\312|3\343\252F\020"
+	.ascii	"\323b\302<3\321r\227yg\346\231qF\0260\366f9\226\306|\3639\343"
+	.ascii	"\370J\017\031\307\311\233l\277\351\345/\001B\3562\333"
+	.string	"\31475\216\213kd\321\302qJ\211\213#\205\027\307I\021B\"N\037G\244\340P\320glnH=h\333\177\326\361\274\343\215\003q\007\225I\337S]\326y\212\304\263\216\n\316\332\326\262V\315\240\364h\332>*e\037\345\332G\261\366u\337\31684\025\231-%Y_\327\331\327p\373\232\313\276F\356k\255}]\265\257\235\3665\215\375\363\316\3769g\377<\263\177r\331?\233\354\237-\354\237M\373yo\003\231A\251Y\307\3043\225\033\230v\222?\231\353\316\226+Y?\333\355\233\033\244g_\237\271A\372\254f?\203\331\317U\266P\034si*\205L9rKOVY?\213\355\021\304\246P\372>S(}V\262AX\355\020Yi{0\267CP\356\233L\366\265\230\033\322\233T\373j\346\206\364!\330w37\244\027\356\307\231\033\322K`\177\215\271!}\t\373KsCj~1\301\230J\nL\267\227"
+	.ascii	"\341g\222\225\237\013|P\370\364\262>\002\366M\nR\263\317\244"
+	.ascii	" \375\320\006a\006\245\30737\244\277\331e\203\315\304\246\034"
+	.ascii	"[S3\223XP\356\224\335T\373M,f\0263\315\304\212c\2468\216;\230"
+	.ascii	"3\340\344"
+	.string	"\310\313\332\324bn1\225\036L.7\317L\264\243J\3118\031\307\361\217YgdI*k sC\232\315\240\364\032\354\233f\377\311\212A\370\336\"\210c\323Cj\366\365\231\036\322\214enH10\203R\223\214\304\315\262\2404\252*\031k\211\343\370\307G\nJ\231Y\326\030\314\240\3647\257xP\237\254\t!b\205\202\237$U\216!Y\377f\225\337\214b\216\231T\316&'\254XK\034'1\250Q\276hi\311\332\244\222\315)f\362&\025S\312K\200\360\036\246x,\216\223&\025\035\307J\246i\201\217iZ\200\266%Q\272\222\352\347\375\244\271!\335fPz\222\311\"t\226\266\373O\016\350\323\233\377\374\200\346H\203:\251\332L\035\212\343\327d@\240\205EerJ\201\034\345?/@?\234e\350\215?\207\035e1\355\366\237\036P\033\177\366\240\203\240\025\230\006\370\301\246\327R\240A\372\354L\377k \364"
+	.string	"\264"
+	.string	"h\223\246\242\361\337\016\312\364\237t\320\021\374\250Q\306\217\276?\n\202\003lI~\265H\017]\365\243\356\177\rP\017\374\250Q\351A\277\212\266h\321\177\206\340\300?\325\313?\376\223\n]\377\363\350\324!\225\213~\024\204\316\322XN'\323\212<\202)\034\370Q\n\334@\361\253\033b\244v\247\007\250\0049F6:O\320\200\035\224\203\216\265\b@\220W\026\r\376\032\006\272\201\026\033\240\032\370Q\f\374\250\005~\224\002?\032\201\377S\320\006\374\247\213\006\374iY\036\301\247\270\261S\363\237NK3?2\377i\344\006\314\177&\241%\374g\322H\036CO\234\017X\300\311&6\177\035\\S\374\247\006h\212?\213\300"
+	.ascii	"E\361\233#4\370\035\304\237\n\371u\321\177z\200J\260\202\361"
+	.ascii	"\327\307\037%\341\271g\003\350\211\214\201\004\270P\375S\225"
+	.ascii	"\347\003\320\005<\331\004\002\237\362\013"
+	.string	"~5\351\003\377\t\204*\340?\257\364\0224\001\177&\373\263\362\317\\\376\363K3\375z\306\257i\374(\002\3763\005\032t\"\225d1.t\204\377<:Z\006t\030z"
+	.string	"-\201V\372?Eh\203\017\277\227\360\253\021\360"
+	.string	"\225\340\\\023\241K\206_\335\372\317\2669\375\253Y\376\223\013j\200\037-\300\1779wS\253d\031\277\031\200\034C\004\n\3025@?\370\357v9\377-\370U \377\211\234\342\366\364Wy\374f"
+	.string	"r\231?\233\271\006-\260\344\370M.\277\331\3457\363~\223-\317\375\350\320\177\206@\007\200v\360\347\265?\203\371s\227\377\204\202r\220\321rZ\013T\304\177\241\007\234M\324\366vP\016\346\bt\203\253ip\241Oy\005\177*\374\265\324\177\006\241\032\2342N\023S~\341O\345\374\347\226_G\371\321\f\376S\307\217b\200\006 K\n4hK6r\321\013\376\267\260\241\006i\027\265\340\327HtW\356\3723\362GA\374\347\026\n\200_\007A+\370\317\016P\n\376\323\350\374\241\037\376\223\016\235 \217\340?}6\370\377\001\004\251\235\377\364"
+	.string	"\225"
+	.string	"\204\017\337\177z\345?S\240Af]\356\311\031h\300D\361\233)~\223\204\337,\341G=\374\346\003~T\3507\213h\207\017\027\372\317\0232\370S\250\347_=\361\337\016\312\341\002\032\003?\272\341\327*4\003~T\203\360nZ\202\377\032\374\377\360\237L\034~\365\247\302\177\246@\203~\r\201?\017A3\234%\364\374)\216_\357_\253\277\346\371\177\376\333\303\257I\374\032\204_\177\360\353\022\277\036\372\265\007\2776\361\353\002\374\372"
+	.ascii	"\277F\300\217b\370\365\004\277\036\300\257;\370u\317\217\002"
+	.ascii	"\375\007\372\267\007~\215\342G\177~\324\347G{~\224\347G\367\217"
+	.ascii	"\252\377\325\177\333\370\321\364G\365\217\346\037\375\257\371"
+	.ascii	"~\275\367\353\274_\343\375\372\356\327s~\035\347\327t\277f\363"
+	.ascii	"k5\2776\363\3532\277&\363k1\277~\373u\333\257\331~\275\366\353"
+	.ascii	"\264_\237\375Z\371\353-\277\316\362\353\262_G\3715\224_#\177"
+	.ascii	"\335\365k$\2776\362k\"\277\036\362\353\254_c\375\372\352\327"
+	.ascii	"?~]\365\353\251_?\375\332\351\3277~\335\364k\032\277\216\177"
+	.ascii	"-\202_\203\340\3271~"
+	.string	"\375\376\372\370\353\025~\335\376\272\350\327\354\257\205\277^\177\035\374\265\006~\215\201_O\340\327-~\255\302\257W\374\332\001\277f\300\257M\370u\212_#\340\327\007\370u\b\277\356\371O:\377i\367\237\313\377\204\363\237n\376\223\315\177\306\377\211\346?\273\374\347\334\177\306\375'\231\377\f\363\237n\377\331\366\237l\377y\366\237f\377\211\345?\255\374g\362?\247\374\347\330\177\212\375'\330\1776\371\317\030\377i\343?\277\376\023\371\237J\376\263\353?\215\374'\221\377\314\372O\020\374\347\372\237X\377y\365\237V\377\371\343?{\374\247\216\377\224\372O\250\377t\372\317\033\377I\343?\231\376S\351?C\360\2372\376\023\351?\337\3774\376\347\321\177\256\360\237F\377I\364\237.\376s\003\377\231\201\377\274\300\177R\340?%\360\237,\3763\002\377\t\201\377l\300\177\252\370\317\023\376\263\204\377$\341?\027\360\237\t\370\317\021\376\323"
+	.string	"\377Y\200\377\004\341?M\374'\211\377\354\340?E\374g\210\377\017\3703\332\377\026\277\351\200\377\324\340?1\370\317\013\376\323\202\377h\377\323\376\334\363\237"
+	.string	"\370\317\n\376O\371o\347??\374\247\207\377\344\360\237A\377\t\364\237\027\376<\344?{\376\273\375\347\357?\325?\243\371\263\333\237\323\376|\366?\205?K\371\363\327\237\205\3749\376\317\342\317 \370s\007\376,\374\363\t\1776\341\317%\374y\350\317\030\3749\203\337<\376f\004~\363"
+	.ascii	"\377\327\376\253\375\267\362\277\312\377\344\177\266\377b\376"
+	.ascii	"g\320\327\327\327\367\007\t\375\026$\377U\003\001W3\262~\210"
+	.ascii	"=\225IeJ\313\350\370\\\321(2C-\353\207X\323\247&\365\251J\252"
+	.ascii	"\222\032\253q\232V7\204tR2\006\357\207\013\227+dn\373!\252\350"
+	.ascii	"\245w\364\366\366R\257\2354\201\227\252\0209\310\036\237Y\326"
+	.ascii	"\017!\266\037\242\253Nj\247\016\036^\352u %3\032,M\273#}iY?\304"
+	.ascii	"\214\375\r\300\354?\245sS\231\322I\271V\230q\214\266%\266\264"
+	.ascii	"S#\013J\326\337\240\212\0349\251\235\020\226\222\322\bo:\262"
+	.ascii	"\226@*Z\256\372\322:\241\237,]Q\320d\375\r\276\3667\270\332\177"
+	.ascii	"\032'\216\231\2072\305XGx\334\234\352\340\311\245q\353\221\365"
+	.ascii	"5\230\333\177JGg\276\235L\361\225\0215\017M\273\322\303+\353"
+	.ascii	"k\340\326F.ucRY\300R\034_\205\005!\273\354k`\266f\215\025\260"
+	.ascii	"\213\006^g\316\244i\204\260\342\251\021\274\246\370\276\3246"
+	.ascii	"@\322\302d\235\2429\221bn\304d}\r\262\3665x\212K\345\342R\257"
+	.ascii	"4\216\315$\026TT\\\025\025\302\214\231\250\273\f]\252"
+	.string	"B\370\260)!2\225\3653\320\333\317\300\314\376S8e\n\207n\241\200\2454\205A\035%\260;\037\253\0329\364\262~\006ic\306\344\263\020XJY \226Nj\362\360\274\304\312\226\262~\006[\366\237\276\245_\3220\350\326N\212\212\231\212L\211PKr\360\f\274\3663\350\001\006\f\210:'5y\372N\2344G\354\332\332D\200a\020\307\306\226\026\311V\342\244\bd\305\261\352\261\322\306\216Y\326\307\340l\377\351\2322]K\267\204\260\342\251\020\234\310\311\215\241h\236\336\344\262>\006bggi\232\351A\2744\327\205\003\265\024\355i\232\317X\333\322N\326\247\223\336\370\377\013\266!\301\313\372\030\034\331\177\252T\246J\275u6a)i}\340e\205\357k\337iU\211\313\372\030\364\330\177\272\345\2462\335\222\n\t\201\245\304$\004&j|n<b\364\266\210\311\372\001\330\313\222%-\333q\034'%c(\237\273"
+	.string	"\254!#K\313\016\024\307\361R\034_Y\361|qR2\006\357i\231I\345\347\305D\313)\214\025+ni\221%$\224\254\037\200'\311\244IE(N\222\243\301\027'%c\302\266\354\234\340\262~"
+	.string	"\244\246L\t\363CB\345\006\231\365/\230\263\237\212\231\351\230\251L\307\314\274\0251\323R\013\032\214A\253x\030\201\222\365/(\263o\232y\351\237B\271\251L\241\244Y!\260\342\251\016\274\342\342\204\341\305q\025\007h\022:PIY\377\202\264\375\247O\224\351\023S-[\211\223R8'&waq\\\305\301\005\260.>\262\262\376\005N\234\230oBXIu\026D9}\271\341\305\261\033\007?w`A\270\262\376\005M\373&\0253e\362\227"
+	.ascii	"\301T\246LL*g\034_\255i\340\305I\311\030\2748\312\215\003\236"
+	.ascii	":?\310\220\311\372\026\274\331O\225\244K\236\"\225)2\3652\343"
+	.ascii	"8\216\253\342$9\033 \235\224\214\t\213\253\242B\374\247c*S\257"
+	.ascii	"\303\351\211?\240rM\224\230e}\013\236\354\337|\376\323X)*\216"
+	.ascii	"\343)4\031G-\365\244\277y\0235\315\020\377\005\3634/\370\257"
+	.ascii	"\343\230D\222c\034W}\t\213\343\330\234\263\231\244)\001\001\021"
+	.ascii	"w\210\343X\252\211)N2\233\310\262\244\232\310\262\24204\215\311"
+	.ascii	"\222\212\231\244\302\230\262\260\314&\246\254\250(\2468\tCL\226"
+	.ascii	"\025\325\024gI\001\305dq\217&2\245$\263\211)\226\212\343\254"
+	.ascii	"\030(nR\222\212\311\222Q\030\232\310\262\242\232\310\262\244"
+	.ascii	"04\221)I5\305"
+	.string	"X1PSrHT\234\314J\302\200\203LI*&\303\222\302\020\223eI5\311\265\231\021j\333\323\272\001\206\311\013\211\331B\023S\374\224\303J)\n(\256)\211\025\257\211cS\013\2158*\216\213\343\013\342\330\n+j\215R\017Sm)\356i\211\213\022\226\231\214\343\330C\216%-\254\230).\311\214\343\232\232`\305q\223%\2438G\034\307\361\007I\311\270\370\210\031\2274\304*v\242\021\307\022\304\3118\316\021\307If\034\027\307qR\034\307j\224U2\216\177"
+	.string	"5!s\344\210\343*\241\034\261U\322\032\2158\316Z\332\250I5\221ia\221X\303B\206\214k$\223\314&'\254\030\031\257\311\212\332dIUb\2478\216M\273\215\224\322Q\227v\251ZzkY\262>\210;;E\242&9\373\262\314\372 \336\354\324\310\005\274\026\256\274d}\020o;%\222y\222\252l\271e}\020\312\235\016I\2414\321\022\313\372 \244\354$\217\332\325\226\035Y\247-\250Xi\320\254\311\372 \276\222Z\3428\366\260\227\250\344\326\262N\257\356\352L\261\312\372 \2546\220\324\252'\307[\0264Y\037\304\r U\251\2173*4auU<R*\030uH\302\250\3411\225\352\310=p|M\205\231\202J\243\366\234\235-1ePI\rUO\236\262N\235~X?\256(e}"
+	.string	"H\331)\216\324F\217\022\025\232\231\254\017\200&\373O\233\322\032tX\232\260e\375\2475R\032\3009M\270\240\262Ng"
+	.ascii	"\243()\023"
+	.string	"\223\365\001\200\265o\302\316ny\346\3609\343X\311\r\262\215\0354\017\275\223*\241u\320>T/\215Q\276t\t\335C\361R&S\231&\241s\216\322A\357\236\317\300\241#\221&\241o\342,\323$4\316\231\303\214\253\322bo\226q\034\247I\350\032\224\215\031gD\217\345-\321\344\264\241S\243\227&\345;\347\222\031W\245\233\354-\353\31476i\022\352F]\262T\347\016\357\202\034\2533]\037t\21627\244\027\230A\351+P\263_A\231\375\n\276\354W\240\334\257\340\312~\005c\373\025\200\355W\320\265_A\220\375\nl\354SP\267\331\344\375\314I\222\327\225\365)P\263OA\231\375\243iP4<eQ\270\320\240g\3209\324\f*\207\306\231J\024\rZ\346\372\314ts3\f\033\223\254%\236\230\037H2cP4(\334\232]\326R\204j\006\246\246\205\036}\n\270\354Spe\237\002\260}\n\206\354S"
+	.ascii	"\265\377!o\377\350\033\n\306\fi\207\226\265\024\224\315G\t(\216"
+	.ascii	"\225\274Y\272\241_L%\n\006\005\223\315\32063\316\210\026\203"
+	.ascii	"[\306q,\302\203\bm\206\247\025&m3\323Lu\312K\225.m\220h\027\324"
+	.ascii	"\013\272f*Q\266\273A\262\345\244\231\346\243\224\214\243\200"
+	.ascii	"It\250\231\302\023\341N\331\322\333\372G\325\320\264\032B\310"
+	.ascii	"\312d\375g.G\323\236\226\261\342\230\213\r:w\362\262\376Q\264"
+	.ascii	"3\255,\222V&k\364\354G\251\240I\224K\236\343$)\231\265r/Yc\303"
+	.ascii	"-\353\177`+C\267\240YP-(\026S\211\232\241U\216ZA\257\300q\021"
+	.ascii	"B\247%H\226+\344\271\345i>L@1\216\032V\3108\216\315P\262\247"
+	.ascii	"\235U\2428\320Psd)\242G\216\325\031\270\036\375\017i\333\304"
+	.ascii	"27\244\032\314\240\364\037\252\3543\316\334\220\216\200NA\305"
+	.ascii	"\226\260\304\364\262\276\211'E\232P14\313\215%\230\032\033H("
+	.ascii	"\350\030\032\005\225b*Q14\214\016\025C\233x\340\013\354.,\216"
+	.ascii	"\223\"\224@\342'\240\376\007'\373\037\264\366?4\355O\240f\177"
+	.ascii	"\202+L\272\200b0Z\262\270\320\214\bY\306q\262\013\325B\267\316"
+	.ascii	"*Q;\313\025$\3131-t\331\0251\322\205\0229\262\004\375B\221h\022"
+	.ascii	"T\t\352\205r\231J\264\013E\302\005\355B\2170\231\213B\205\307"
+	.ascii	"\223F\353M\b\220\376\004S\373\023\334\330\237`i_\002\274}\t\354"
+	.ascii	"v\btH\362\347\227\306.\210\226\254/A\233}\t\332\366%\320\262"
+	.ascii	"/\001\030\226U^\030\334\222\254Q+\264\006\312\343\254\022\305"
+	.ascii	"\2009-K&%\034\215-(\020\364\007z\205\372@\203\240BL%j\205R\035"
+	.ascii	"\355\201V]'\343\230\311\324C\255P\245\263%.\250\025:\343\212"
+	.ascii	"\231\326\235\270)>\332L\232\033R!3(\275\004Cv\350#J\263\266\254"
+	.ascii	"/\001\025*\205F\241S\246\022\325\201>i\0239\304\306\240P'\037"
+	.ascii	"&\240\230Ik\f\211\352@\233P'3NK\254$\365\301\023&_Sx=lcuA\266"
+	.ascii	"\276\007\275}\017t\373\036\330l\324\006z\303T\276\r\305\361c"
+	.ascii	"J\306dG\300$\035\311\372\036\314\354\030q\034\307\346\333R\365"
+	.ascii	"m\351=\220\331\367\360\266\357am\337C\331\276\207\260}\017L\366"
+	.ascii	"=t\355\037MBc\364J\0301\245\2545\237\3563\225h|m\005+&\213\343"
+	.ascii	"\344\205S\211\212LZ\3267C\244?}}}}f\210\364\327w\356x\350\334"
+	.ascii	"$%e}\023uG\220tK\2568]\313;\375F\216n\206\0228I\354h<]G\347i"
+	.ascii	"=MG\357\231J}\247\355\256\347\230a\356\264\034$\3138N\252dpp"
+	.ascii	"\254\001i\0373(\275\007 \373\036\234\366\205\366\366\205\352"
+	.ascii	"\366\205\340\366\205\272\354\013\225\355\0139\331\277v\243\333"
+	.ascii	"\234\3124)Uz\215fc*u\033\255\306L\306q2\r\bm4\032\363\315')\031"
+	.ascii	"CQ`.k\031\326\023EJ\333\215T_\310\306~\007\273\375\016f\366\257"
+	.ascii	"\317h2{v[\246d}\023_\336\260Q\313\243\353\202\347f\215-\016\232"
+	.ascii	"\2270Z\214\036\243\335\264\234\216\323ft\031\r\247\337\364\234"
+	.ascii	"\251\324d4\030s\214r/\214\331\026MF\267\321\221\320d4\027\235"
+	.ascii	"\346\223\224\214\223\322\264/\276/\2748\216y\224\274\222\356"
+	.ascii	"\b\351w\020\333\357\200d\277C\325~\207\034\373\034\356\354sP"
+	.ascii	"\263\317\341m\237\203\225\375k\264\353\264\247MLYM\262\326g$"
+	.ascii	"\256\321\326H\255\361\310\0325\203\322s\370\332\347\300\265\317"
+	.ascii	"\241j\237\203\322\376\265\226\263\027UUS\262\204\260\223f)\f"
+	.ascii	"\013\331\017*\275+Y\337\f\343\305WE\227\351+\332\212\251\324"
+	.ascii	"d:\tG\246\277\356,5\231n\242\251\234I\265\006\\\331[\262\221"
+	.ascii	"i$\225\2728V\"|\216\354q9\001\3657\270\355)&\035./\276\254\277"
+	.ascii	"!\313\276\t0\033\3138N\352(:LC9\223\310_\r-\034K=\246\305\264"
+	.ascii	"\024S\251\243\350'\327LL84\035E;\311rc\205\207F\005A\003\267"
+	.ascii	"\265\206\222\235v\025\223\023U\326\337 d\177\303\323\276\206"
+	.ascii	";\373\032\226\373\032\336\354\0363(\275\206\267}\rY\3665\034"
+	.ascii	"\331\277^\222\004\316\254NJ\3267\321\212hqi%\272Ks\231J\235D"
+	.ascii	"#\271i\304I\226\334\030\236N\242\2178\231\222\033\303\213\343"
+	.ascii	"\244\b!\021\"P0C\252\204m}\r\361~\320\335~\220\334~\220\331\376"
+	.ascii	"5\221\255\013I\254l-e\375\353-\235\243\007k\355\214\231\254o"
+	.ascii	"\342\353iYe\356M\221$@\330Xq\203\264\223\365\332\324\315\261"
+	.ascii	"C\002\f\231\272|\007\007\231\363\334PA\351[N\211C\005\016r\254"
+	.ascii	"\313jY\207.\333\2511\246\bW\220\245\215\033a\220v\232\304\304"
+	.ascii	"=\271Ua-Y\2065\345\272\214\367\206\315\210\221\345\211\247\205"
+	.ascii	"\234{:\210\356\241\241\264\225\306:\353\316\345\251F\317\320"
+	.ascii	"TZ\207\336q\302\321S\372\306\231\346\214;"
+	.ascii	"\337\234v\272\206V:\343\234g4\323\331w\362\235w4\216s\214^\322"
+	.ascii	"R\347\034\335t\2569\345\234uN:\375t\2229\331h\036\272Jg\351\244"
+	.ascii	"S\3564s\322\321CN7\247\035\355\244\343sNGi g\336\211\346\274"
+	.ascii	"\3236\364\017\355C\323\320Z\272\205S\357ls\226\321W'\234\251"
+	.ascii	"\3249\316\267\237aN1\246\234\023\034\313\252 brPic\244\340!\351"
+	.ascii	"\262\222 O\033;\314L/I\272l\207\206Y7\203\3142\214\217)B\302"
+	.ascii	"N\033<\266\024Q\262\365c\f\354\306r\314\017)H8 c\3108\253(u\231"
+	.ascii	"\016\336R\3478\313N/gR\355\204%6\231J\214/S5q\252\313vy \374"
+	.ascii	"g\325\026\2220cyK4/(7-(9m\350Pf;:G\276s.\235I\244\tek\226C\270"
+	.ascii	"\262\035\2462\247\r*-K\033:\307\211\343\314"
+	.string	"\341\223\004\024\307[og\025\221#j\246\270d*&9\220l\332\312\234E\220\\-\317*\255.d\2663\003\356\264\021\205\026E\357\264\321c\006\225L\365\304\306\322\315\022\037H:$\232*\244\r\251\255\263/f\336\022\234\333\230\345YD\3478\217l\tY\236U:\307yU\006e\031\307\3114J\033\223\026\314)\275\221\346\206\324\244a\006\245\017\222\262\037\244d?(\310~\320\323~\006\275}z\371\317+'\331\311\366\333\361\326\005-\353.B'\337\r4)Y?\303\234\375\377L;\321N\265\363\314T\236k\247\331O\245\311F\213\221s\355\344b\346\235I\265]\343\n\222e\226#\347\332\271\305|\373\200I\035\330\035^\034'\321#Uus@\375\fo;\355\262\237Am?\003\332~\006.;\263\221\370\211E\017\271\203\372\312\372\001_@%\320\354\307\235*]\262\031p\313\020$h\226\244h\200a_\324\236"
+	.ascii	"\265h0\277%p_n\262>\tX\366\017\304\242*\225\245ET,\223fd\351"
+	.ascii	"V\nw\345\215\353\312^\332\200#\007I\266\202n\355-p\342pTI\323"
+	.ascii	"R\276\272\262\265\344\336S\3220\233C\345\207\234b\303\355\314"
+	.ascii	"\024\032q\234)SR\324\256S\207\021&X\306~P\200[tkPQ\324.\273\005"
+	.ascii	"\"yLb\352\331T\23243\262\006\206e\340\023 \224\003\303\236\004"
+	.ascii	"\206\001`\357\3074-\370\371\241t\373\002\343JB!\343\312\032\210"
+	.ascii	"D\002\233<\203\022\027\020o\007\0230\274\270jG\210\037\310\344"
+	.ascii	"\300&m(\2157s\344\262\006~\275Mo\013\2253Y\003"
+	.string	"\275T1pZBHha\373\244`]5\326\224\244G\344\256\344\304%\331\362B\213\222\273T1\021xD\254d\r<\002Dr \327\201\\\031\310u\366\365\245R\316dI\215\244YV\312,,E\246\200X\236\270\321BD5\303\013\203\306Fr\314M\035\245!\277\262\2361+wWZ\251\035\024\262/,Y\333n\f\217\344W\326PP\\XX*\221\242\037I\366\200B~W]=\350\204\\\245I|\262\240\362\336\004Io\360\214\261\262\367\305J\205c\256\031\002\005\007\220\324k\213\017#ZysPu\262~RE\307\216\252T\210j\006\205\215\256\207\231\327c\206\236\222J\f\217m&G\354\256+\353\233J\340\216\264\214\204:\247-\035j?k\260\266\234\246v\0243/zP@\251\355\324%\267&\013\030\005\204\242s\206\214\016\340\323\201P\177\2362\325\364\240A\2533\222\365\251$q\340\223\024\"MHr"
+	.ascii	"\235fD\215\231q\343@\247\037\210\303\224\353[2\307)k\240\031"
+	.ascii	"\224\346=\022\007\336`\332a\246\004h\003\330\024\253\3012f\013"
+	.ascii	"\226\003\233\320\310\224\021\311\032H\003H#M\243\322oP\226\252"
+	.ascii	"\262>\tT@& S\352\305\003\366\244\246J{\021\363d*\353\223\240"
+	.ascii	"\004T\002*\251]\246`\250\273\322\226\365O\220\001\306\300\370"
+	.ascii	"w\245g\005\354\016\r[\322Q'\353\237\300\302\307\267a\312S\035"
+	.ascii	"\253\2379g}`\262\376\211!{{\277+9\260\2731U\200\244\311\372'"
+	.ascii	"r\344\345\201\355\320\242\n;\251\350\315]e\375\005\334\375\360"
+	.ascii	"~x*\325\016\"na\247\024&0\\\262\376\002\222\277\273\337]\352"
+	.ascii	"%\266C\3537\305\006\2172Y_\001|r\344\374\346,\235\352\340\251"
+	.ascii	"f\313*Z?\273\377\346"
+	.string	"\244e^?\274d\375\253K{@\241c\303\205n\305\211\023\347Gg\002%\227\3204!\323\202(\200\214\0337?:\225\317\351\313M\327\371\202\204\307\233\377\3502\222\266\264\2704\210\233,\034rY_\001\\\330\260AB\301\t\303\313b\236\322\326\262\276\002\242\314\315\375\324t\201\312\333SR\342\2514\377\251\001>\3519)\373\241i\2432\207\346LZ\005\n\230\226\254\317\240s\200S\270\226xe}\005\320\370\231\371\231I\275\236\346\324\302\316\264'^\312\310)SF\2653\255\304P\026\260\313Z&]q\202\363F\206L\352\245NA-\371\322X\364\276\200)\305\210Q#\005\351S\305\252\211\034)`\300\374\336L+1\024\f9\260;\247%4b\334\376{\273@\203\013\231\327\217\377\277\237*F\264\270\262~\002\212\264\265\375\256\244\276\300\356\302~b{Ub\250\330\330R/\023(\2714\307\005\031DG\227\262\254\237"
+	.string	"\245\337\332o-\365\022\302J\272S\251\240\340\204\341\315\261\342\345\225\365\021\320&-\355\n\nNX\317\227\0276 Y\037\001O\316\316\3224\2369NL\356\302\316\2532lM\262>\002\272\224\3124\255"
+	.string	"lQ\250N1r{oY\037\001A\266l\341A>\251\251b\262F\016\230\254\217\200\246,Yx\276\236\324T\365\254\261\265p\225\365G8#\345\277+R~eAo\204\342%\246\370\312J\365\202J\023\206\0277Y\205@\335v\240!\373\257\354m?@\266\244\230~U\376\263\362\377T5h\304\220\355\037\225\377\222\377\017\005\242\303M\223\254?\002\225\375\377\246\374\277\036#c\340\352\262\376\bP\366Gp\022%\212j\246VA-\371\n3\333\202\305J\326\037!\353\353\353\007E\310n\n\354\016\357'\216\2170\264\260\377\240\230\t\323r'\353\037\223\337\223\377\277\255\306&\214\231'?\2605<\236\224d\375s\"\244\202N\n\230\254?\002\217\335\344|\373\3770I\334\354F\250\241D\311\017\371\203G\355IMU\312\006\007\310\325\222\377\220f\236\2362\007\314\214\266\377?\315c-\n\031\274\256.\003hE\241\272"
+	.string	"v\025$\231\365\017\300\006\t\022\037_fA\304\0301\342BM\251\022\262yq\223\365\017"
+	.string	"\205\b\021\363\007\224\330]\330\336\372\222%\226\365\017pc\310\2207\273\257\251\364.\253\355K\326\027\241\356\227\365\313z\242C\315\024\036Pj\016\214*\353\213\300\366\303\372a\311\350\002v\027\206NY\0212'\353\213\220\374Y\375\254~WAuOq\324t\222\0343a\277 \377]\351#ox\2701\251\334\230b\273\312\372\",\371\361C\345{\232S\333\341d\214S\326\027\341j\307\216_U\020\2369Nu\360\360\256\306\244Q\363\343\361_\325\257\307\325\234\222\261\254\177T?`\350\bQ\313\372\"L\355\323I{\374\377u\350\343\252\221\365EH\372E\375\242~SQPK\276\302\362\017;8$?\251\377\246\200|4\344(w\374\377y\320\206K\211\334\323\223\0302E\262\224\324\312\372\006X\3739\375\234\302\220\332\211\033+qY\337"
+	.ascii	"T~7~7\356\240\220\354e,"
+	.ascii	"ub\214d}\003<\375\232~MiX\327\\\f&\353\207p\347\247\364S\372"
+	.ascii	"\321\020\302J\252\013\3616\227\265\374\002\347t\344G\3437\003"
+	.ascii	"\b\222K\224\254\177L=}j\346\250d\375\020\336\374\226\274\374"
+	.ascii	"\342_\334\004\005\233Z+\263\302\307\227\226\ta%\321\341\021s"
+	.ascii	"br\207\347$\207\233\222\274\274\275'\204\225t\227\2029}\271\001"
+	.ascii	"\253\306\240\255\331z\337{\207c\366\231)\033\223J\3650\311\232"
+	.ascii	"a\227\365C\370A\207\316\306\023\302J\222#\200\250'\275\037\272"
+	.ascii	"H\236\2246x\273\216\035\037Xw\366\335p+\213\227\254\037\202\324"
+	.ascii	"~\b7\352\352\266\235\222T\314\351\313\r\317\211\207\227&\333"
+	.ascii	"N\n\016\\\2310s\350\350\366\362Kn\f\357\347CJ\0207q\276\227@"
+	.ascii	"9\361\034d\326\033\216y\006\031\333\271q\343&-\023\332\261\224"
+	.ascii	"\255\037\313\037\271\2713<76lX|\305\261\n\353\261\202\213\341"
+	.ascii	"\262~\001\270\250Q#\024\245K\210\236\0364\252\\e\375\002$\321"
+	.ascii	"\240Q\341\ba%\311\t\261\367\244\367\003\257\007\023(6\262~\001"
+	.ascii	"\256\346\3464\210\321\221\265\3043\253\030\211\203\226\365\013"
+	.ascii	"P\303\214\231\324\353'S|\365\206\324U\310\230\211\263>\001\362"
+	.ascii	"\312\224I\275<P=\325\261\302k3\233q\246\215\f\231m\006\244z\232"
+	.ascii	";\271\250\322\346\262>\001\232\270\271m1up=T\362\344\244\204"
+	.ascii	"\371\026\263\337\b@\343\313\227\264\214C\324S\034;,=\222Y\037"
+	.ascii	"\2040^\274\244;\236\334\314Q\265\366\310,e}\020\260\272t\001"
+	.ascii	"!\212\317M\333\021\002eG\326\007\241\006\032\332V\003\356"
+	.string	"p\372r;\305l\244\021\222\366\255F\247,nJ\326\247\203n\375\377\245pP{y}\\\270\244e<M\236\324T\355,QQ\304\262\376\007f[\313\326\262\315L+1\224\212\3674\247\026\026\307U!|\346\210\334\300\261\345\333\354g\311I\327Y\216\377\277\013ath|d\375\017\256\366\277\261l,t\200=vcg-d\375\017\246\250l*\233\f\030\325\200\031gK=0gP\256\364t\361A\365HV5\235M\311z[\331UzD\310\361\341V%\031e\007\221\256\344X\034\307?\2775='<\360\244H\331\n\323\223\\\003%\353\233\b\263\377-\266\305v\224\f\0243i\301\251\305QU\034\354*a\354p\021\372\205%\321Q$\353\233\020\333O\337=v\325\366a*\367\323\016K\243\220\361\021(<ag\214\224*\222\365\223\244\252\244&\315[\3267\221d\353\375\330Vo\226A\334\264\260\265\3148#\013"
+	.string	"+s\265\201|XjBa\254\rro\355$f\\\025P\314\204\206\267Dn\2545_\033l;\331L\366\222\355\265\233\230\312\215\334C\276\253\266\217\013%\343\230\211n#\267\0206\313\2379Q\262\364"
+	.string	"\322?N\367a\251\t\205)pv\327Vb*w\222\013\231\330I6\221\315\365a\251)V\3122"
+	.ascii	"\334\223X\235\007\021\027\352\316\254\001\222\352\177s!\361\341"
+	.ascii	"\222,b\227\365>\242V\365\0203#\353\233\310\261\377]\304Tn#t\302"
+	.ascii	"\326\364\262>\235\323\375\377\361\200A\242\005\227\365M\334\330"
+	.ascii	"7\301\264_\242\316\336Y\033\3152\b\\\326/!g\277\004\335~\211"
+	.ascii	"4\373%\314\354\227x\333/\341e\377\333j\003!\0133\007\016\310"
+	.ascii	"\034\031\247\245\254_Bm\347\244\271!\ra\006\245{\307\246\372"
+	.ascii	"\021S#\242\314\372\233\307\377\337\003\220\224Qf\255\267\216"
+	.ascii	",f\t2G\326\337S>k\224l\251\222\365\267\224\262o\216\217\254w"
+	.ascii	"\324\246Q\302\312\006\300 hB\200d\375o\250\357\250_\3053\307"
+	.ascii	"\260\320w\247N\326\232\t\211o(\036\270/K*Y\277\004\326\276\t"
+	.ascii	"\305T\353|3\325\331N\350R\234e\306c\305\201\276\321FiH\3268\222"
+	.ascii	"dlH!QY\277\304\214\375\177\333\330M\246r\337\3304\310\366\215"
+	.ascii	"]\303l\031\307\311}c\3170\300\324\323\222)x}_cYR}\022m\373$\304"
+	.ascii	"\366I`\355\035o\245\275\364\377~lNsVY\237D\325\376N\372\377\003"
+	.ascii	"\032\221K\342$\353\314w\265\357\377\251cQL[\262>\t\035\373\352"
+	.ascii	"\236z\347\377\235w\306\260\331\310\372$"
+	.string	"p\354\253z\377\177#p\323\002\224\254\325\274M\303\203\275\r~m\254\320q\331\271\232\227\235\200T\305\311Z\305#q\325N^\242E\214\230\254/\230A\351=`\243CG\251\256\247\2055orR\352\352T\273\034c\3051Ru\003\363f\331\203\005+\215\232\335\005\271)6q\327r\251\316M\371\262dc\314\025\035\235\n'c\255\001\023\346B\030 yL\340\2447\364\233/}\036\334p\343&-\273\031\325e\304\017uK\030\267.Y\177D\234}5\215\251\256Q\223T6[]\206\232\214\200\333\037\241\3347\321\255\024\r\2324MN\304\216%]\352he\375\021K\344\344\324\271\241\272\013ekec\256\316Q9\357\276\\\355e\375\021Ve^F\2153A\30412^\232\223\0322\221bx\254\305\275\361\260\221\n\223\222\365G\304c\310\\\241\331\037\n\243\206Ik\350\250s\247\326Y\202\303#\353\017)\001\363\227"
+	.string	"AeS\335L*;F\306Kh\222F\374\030\302\332\037\212\332\277\332\326fR\361 ^\232\2532\0047\200;j\232\312\246\246\251]\324\324\324.\007R\032AeN\225\255\231\263v\265\313\217o\314\223\037\003\260\333\037\200\034\027.\352\031\2108\216i\3041\342\234\340-\255D\035y\312\372\254n\247\321AS\333\242E\213jv 3\034L\001\232\001\363\362\264\305T\252fh\224.\311\036H\310\310T,7\243\326D\214\311O\344\220\361\312\372W\313\256b\271\320\346\003\fH\326\247c\276\375\377\241Zwo\322\262\376"
+	.string	"~\354_\265b\305\244\"\204\225$\307\203\272\034m\252\260\230]\321\221\365;\330K&7\370\352"
+	.string	"\315\376\325)7\225\352\224\364\210\020\326\006L\262\226nq\\\305\201^\262\211\305Y\277\203\263\26113\r\215c,\037\300\261*\016T2g\\iY\277\203\262\2600U,[\211\223~\322\226\324Lm9>\033wY\253P<"
+	.string	"\323\224URY\277\203%\373\035\020\001\003C\323P\300R\362\n!\212j\247$\007H\326\357\300Jm\2426I\275\314lP\247W\303N\220\254\337\301\323\376\325/S\251~\241g(`\305S!\320\371\275\345\001)\223\365;\240\201D\232T\314d\f\005\344\343\340\214\252DU\222\307\201\226\375\253Hn*U$jW\b\254x\312\0039r`w\271\253\f\262,k\225KI\346\n[\326\347`l\237\003.\325\210j$"
+	.string	"_8\240\332\277:D\035\242\022A\001K\211\t\006N\354\242P\341y\201\202s\225\265\272\245O3(=\334d}\016f\354\213\210\263\1775+\013N\004\334\306\302\212}\302h J\247&Y_\204\331\325UzC'c)\340\236\223\2221a_VV\351\r\r\0243m\215!EP\355\253U\246\372\343\307\235\336\276\231\3360\225*\017\265\007\nX\261\216\020mZ_S?\033i\222\234e\255\346);hL\311\372\002`\263/"
+	.string	"\271\255C\307\230-\373W\245\244\322\033G\200_\222\373j\016S\205\202J\223\374\3428K\n\017\225"
+	.string	"\222\354\233i\222\364\034\230\252\223\352\364\266_\034gY\001\2271\007\027@\013j\223zCmRm\2506*\030C\246\226\304.\353\013\340\307\276"
+	.ascii	"\234\366\257\322Pi\244{["
+	.string	"\313-7\032b\217Z\370x$\374m\236_\217O\317\215\206^#x=\032Q4\036\035\031\205\305vu\177FWF\021\320e\217Gl\213\341\312\252`te\024\005\231P<\021C\005\f\210k\013\267E\025,\204.\207\027v\215+Xx\025\032\211\304\023\034n4\004\007\335h(x|\217F\034\337\243\027vY\260\357\312\022Y\025X\034\337#\fVx\327\026\254\3533\304`\002\013\304\276\357\t\r/;4\246\240\341\025v`\205E\226\330\262\2700l\217\0276\034\271,\254\002fY\f\333#PP\207\033\r\215(*\266\256\021n\213\306\024^\025,\321\372\022\333\225H\203\n\026,T"
+	.string	"\032]\031E\032\212\212m\261\210\244\202\333\232\360\266\001\270\321\320[Tl]\370\035\301\016\221\210\302b;\302}\221Ft\200at\215`cQ%ZY\242\206\337\242Q\210\276DD\347{dY\022(\220\001>\246`\341U\205\327\305\t\243+\243\310\307\350m\213\255\t>\0278\2747\032z\205D\307 {d4\n\262XqB\007\230e\001\001\226u\211\206+\213B\321\330\026]\026^\221\"\200t\324V"
+	.string	"\267E\025-\214\256\360\004\274\302,\336\227u\217G$\026\303\327\b\004\004\007\331\243\026\346a\217\332\026+LdS\254\360\256-`\266\b\350FC#\214\255\213\024\b\303\215\206\\#\274\n\333a\261}G\030[\243w%\2320d\035PTl\213\356\n\343g\370\266@l\020\250\003\006\342Z,jY\024\025\333\027-+dUxU\304p\203\212HAp\360M\341m\211\304\366(-\332\300\022]\254-b\264G\333ec\264)\274m\206\327\370\302eY\274,\334\2720xn4\304\036\265\360kt\205\355Q\352\032MxW\020\266\257\004\336\226\303\333\3068\001c\265"
+	.string	"\314\276\254\373\262\356\212\341\333\202\270\321\320\210W\005\353\"\301+K\004t\243\241\341k\0341|\215'\206\257q\303\215\206V\027"
+	.string	"XIx[\017*\204\302UH\275\321\220\321\225Qdte\234\360\266Bw\204\220\250\204\t\250h\201\342D\260\204\024\020H!\210B\205 \013\025\030`\260\017X\3415E\005Tx[\236whLa\370\032=\3108\032QP"
+	.string	""
+	.string	"\370FCE\307\021EGa\021\311\004\236\"QF\337`\321\261\007\016\026\213\216h\261\350x\032\301EE\226\230\262,\264\257~_\326\035\016WU\306\321(\324.|<\177A\206\013\277m\021\253\202\005\360\215\336\240\004B\017C\266X\324\022Wu\310\276H\372U\277\302\3530Xt\034\362)j\211\212B\326u\215(\210\307#\266E\3211\004\373\266\033\200Z\274\355\005\007\300lQ\220\to+\001\020\211!\227\205\213HF\024\303\366\230\201\005\221h\\1\301\211\267\315\360\27281\201\004%\206\212%\310pa\366\210%\262-`\327\270b\310\272\253\321\373\001\205\207\013&\206\212\020p\331#\313\222\3603|U\260C\343\221\333\256\031~1T"
+	.string	"\022\022W\241P\005\357\n\302\026f\301\272\353\317\215\206Z\242pDK\024\016\215)\264D\241\372\262.\220Xp\350p\244\302\301\327e\211H%l`\207Hp\013\303\353v\177C\242\021\205\2425\205\013+\274\246\030\266GU\006\261uW\327x<b[X0\\A\310\032\241\200\201\\\226\250\001\336\320\"\005\374\256D\240\240W\002\035^\t\fYx%\"\035!\t\205'&x%\220\242\005\234\026\215\357\312\2520<\001\277+Q\b>\2613\034\271'\214-\212\212\255\f\027\3469!\303\205/\3748\200}%P\\\205A?\305vMa\205w\2059\244\02740\256XA\330\022\207\305\325h"
+	.string	"\033\340\240\033\rY0\\\215\016`\213V\227}\261\n\301+\374\002\321\017\206b\2500\\\215T\243wuQ\270,Lt\302e_@\340\330\022\211\204\340\240\f\036\f\301\356z\034z\221\340\025f\341\201=j\341\243\321\350\200a\273\002f\213\334\025\306\200v\360`\210=j[\274H\306\366\005\353\036=\334h\250\b\311\005;\0341$\266H.<\260Cc\n?\t\270F\330\230B\206\f\303\342ztdD!Ta\205wm\341\002\351\005Z\001\027Y\327E\022b\220\240h\034\262\354\003\204\3025\250\250\370\266\027\216\214\356\212\022J0\302\354\213\225\305\005l\321\230\002.\262G\254\213\364\256l\n\031|8QT\024j`\361\023\303]\3415\205\320M\203\354Q\013\027\221\334\021B\"\236!{\344\236\020\nOLp\341\020\353n@QT\301\302\353\360\210T\301\205\255\313\026\331\242\375\017\b0"
+	.string	"\002\204\020C}\b\"x \202\007\351C\020\201\004\t\021\b@b\237"
+	.string	"$N6\250\001\206a\030\036\032S\300\300\006\337\226\330\272Xa\026\303\366\330\201\r\016U\254\360\256-\210\204@6xdY\027=l\360-Z\211&\244\320\300\006\207*b\030]\250p\360\225"
+	.string	"{\324\302\033\276\321\020\321\350\302\030\260\360\252BP\b\3036\005\327\bVC0\036c\224\340\032\301\033\370\262\360\252\202\320U\215\307\030%\b\335\364e\341\325ES\250X\341\032\265(\312\030\376VXY\327Ep=\302\034RX\217\260\372\n\335\f\033\306*\243\007\003[D4\032\005a\342\252\001\306*C\303\215\206\220\216Z\370\b\211\305\371\2661N\f\333\343\205a{\34492\026\331a\360}Y\241\321=\006\207\355\021C\321\330\302E\366\005\353\036%"
+	.string	"\301\302+;\f\022\021\031\331\025V8(c\205\261\026\221\334"
+	.string	"\334h\b"
+	.ascii	"F\027+\bW\242\013\240\340Qe\205\355\013v\230\n\205kp\350\032"
+	.ascii	"\205\254\013d\207\306#\r\007K\230X\341]\217\202C\226\350\342"
+	.ascii	"\035\022\331\226H\003\353\"\301\307\236\242b;4\n\213\354q\035"
+	.ascii	"\256\030\336\340\n\257)\212\306\026F\"\032Y\274\307\"\f\360\215"
+	.ascii	"\206\336c\321\bc{\204\002&\256\350\033\024\032\035\360\036\213"
+	.ascii	".\300+\361\204"
+	.string	"\203%L\300\305V-\032\211\247\021\221x\016M\250C\226=\262\340a_\027\311\210bXD2\272E=G\343\320H\303+\213#\244b\232\302\004\020\f#\321\307\250\2505\372\031\232 \256.\214\304\026\177\301\241\211aqu1\\\331a\020\f#\221gh\242ghb\310\276?7\032z\205\356\207\325\347\310]\203\360\353\266D\301\2421H\\\205A\243+\243h\303\221\273\276\355\020\303\215\206F\b;\034\261\360+\343\365\211\301\016\213*~^\264\260p\305\300\016\215G\300W\330\302o\013\257\360\033\\\341]\341\037#!\334\302`\361\032W\020\200\205Ww\303\nB#Q\210t\024^`\217\332\026\254puO(*\266G\356\211\"\004\\\026\206\361\310\301e[\242\026.\262C\025Cw5\272\370a\301(\005\3665JYx\205Y \t3\260\360\252\002\313B{\324\302G\b\270,\021i\310\032\t\337\r7\032z'\270"
+	.string	"\337h\350\b\306q\304\353\262/Zw\b\342M_\260)^\"\322\n\227\205\213,\n \026^U8\202\261\242\347\005;<=\300\272D\031\214/\\\366\r\016\331#w-\"\005[\027\306"
+	.ascii	"\273+\314\242\250\330Rp\243!\t.\2601\332\243\337\220}]\366\005"
+	.ascii	"\353\006_\030\253\214\240c\360\330\022\211:\274\301\025\303\366"
+	.ascii	"\330\303\202Q\020\306*\303\207\005\243 \020\013FFB\330X\204o"
+	.ascii	"44l\217#\204L0\337 \321\260=\246+L\025f\ns\330\036O\270\330\032"
+	.ascii	"W\034\221\206\305\226\002\035x`\254\026@b1l\217>\3056\005\370"
+	.ascii	"\304\260=\002\261/X\342\017,d\211\210\202\330\241\361(\b\273"
+	.ascii	"\3541\006\033\204\211-\034,\032Yh]\243\221\020;4\246 \003n_\254"
+	.ascii	"\356\t-\\\\\1778\024\333\365\004\327xB\203\n0V\031\030\210\254"
+	.ascii	"Px\202\205W\327gX\004\324\032\2170\373\n\261G-\f\224\261\022"
+	.ascii	"\331!\217\206\240\267\310\036\217\214(\206\355\nxu\361\"\250"
+	.ascii	"hl\341\026Cw\205\341\032M\030\262,\321\006\030\253\214\340\017"
+	.ascii	"\220\005\243`\211\367]\2170\214D\f2\\\366\205Q\310\272A\243w"
+	.ascii	"u\205>>\033`\243\017{\224\001\003\265<E\305U\250C\261]\2130\274"
+	.ascii	"G\301\341\312\032\255+\030\215\304\240\313\026\333\325\205\203"
+	.ascii	"FW\270z(\266k\021\020\206\016\302\340\353b\315P\302eabK\224\201"
+	.ascii	"\005\243`\261e\301\350\310e\341aQ\306P\003;4\246Pd\205.\273\242"
+	.ascii	"\305\007\270=j\035\320\241\330\256'\250\340\262EE\255\333\002"
+	.ascii	"\206\221H<A4\272p\321\210\302HXDZ\211\025\004\331\027)C\214\225"
+	.ascii	"\310\272A\030\253\214\340\220\205W\267\210\205\213\255\006\026"
+	.ascii	"Zwe\213\255\003\340\027\3115\202\203\320b\273\026\001Yaq}1\\"
+	.ascii	"\207\027`\244#\214d\f\272F\330x\224\001.\"\031\205A\"\221\025"
+	.ascii	"\006;\020a\330\350\032\301A\270\310\266oqua!\3705\032]\004\211"
+	.ascii	"\210\266\273\032\t5{\264>\200%\266DF\367\310stt\203\305\366\250"
+	.ascii	"g\310\262\3077\b\027\331#\370E\352\300p\335\220\016\333\243\017"
+	.ascii	"\373\256\254+,\266,q\330b8\276A\266\205W\227\210\b\003\334\036"
+	.ascii	"\265\304 \273B{|\203DD>\033X0\n\022\035\211@\326]a\f\335\325"
+	.ascii	"}\211\202FE\255QP(\\{`\243\313^@(\\U\230\210\035\006\341\016"
+	.ascii	"7\032\272\340E\n\032\t\341v\305\260x\202H4\272A.\013\263GF\227"
+	.ascii	"%\262B\341\232\001i\003\214\325=\341 \021;\364p\243\241\3275"
+	.ascii	"\276E\366\245`\310\302,\361xdD\341\272h\211\253P\303\033|\217"
+	.ascii	"Z\267\305+l\217\326\242\214\024\260QQK$\232\200H4\272\332H\b"
+	.ascii	"\267G\024\306*\343|Y$\342\372\"\275\321P\fwD\3211\350\306#\353"
+	.ascii	"\216\200\215Fw\004\317\033,j\211\212F\0241\\\340q=\022\272\250"
+	.ascii	"\313\016\333\027F\3678dc\270\304\265u\331\027C\f\226xDJAD\\\215"
+	.ascii	"\200\354\260u]\366\2051XlA\300A\265hmal\203EH\304\243\020\006"
+	.ascii	"\230}YwXl]\004\341\365\r\036!\271\360\n\354\361\235\240\207%"
+	.ascii	"\256B \354\262/\212\255\320\035\266Gh\261=\332+\bY#a\214\365"
+	.ascii	"h\377\274(\210\353\213\242\261\205W\242\361\350\262pQ\205\320"
+	.ascii	"\355\360\262\254[\304\246`\211E\305\023G+\212\027G\242\fC\242"
+	.ascii	"\321\350e]\243\026,\274\276ha\341\tvhL\301mW\241b\213\264\205"
+	.ascii	"\354\213\024\214\261\036\005c\270<D\266X\\\215\204\301\030Hk"
+	.ascii	"0\306z\364\363\272F\327e7\2440\373\022\021\031y\330\243\f\030"
+	.ascii	"\203\007\"\"#\214$\254\340mc\254\301\"$\027\354\020F:\026\333"
+	.ascii	"\016\354Q\006\034d_\264\360\372\242u\331\341\007\327\b\013W\242"
+	.ascii	"\240\021FZ\203E\305\326\b6\032\217\336\240\320"
+	.string	"\025\032\032[\227=\006\211\216\304 {\264\272DA\241\373\006\333\367u=\f\333 \334\026\221.\224 \306p\337\0378\030\002\\l\221T\370]\211\202C\244\325E\360Er\361\372\300A\002\220\200\213\255z\022$P\200\220\300\003N\330\302!\3265\nG\b\211F\024\333\365h\204\320}G\fi \032\215$\004\321\377<P\2779=U\\\206\210\341y\372\321\371P\005\211\343\301\223\343\247FUz\201\323\306\343d\007\274\243\004\016\017\207\212\205\207L\232\245\331\215\337\333\357\rl\211\306c\203\247\311\215\bZU\231+<5xh\\\315\331a\223\265\\\013LH\262\346I\342I\342a2\243\242\354\0060\266#\312\025\317\322y\230~\332\024i\013\2235\217\322)\307\227\244N\020==`\237\325\007^qq\302\372\200|c]@\200\360\335y\362\304\314\334^\332\202\220\025&W{\231G\017\326\2329k\262>\212\035t\350"
+	.ascii	"\355\\y\340DNn\314\016\020\257\316\030Y\027\036\260N\006\304"
+	.ascii	"h\320\335\245C\226\\\tS\343N#\321Or\340\300\222\365Q4\355\244"
+	.ascii	"\232\336\323\026\273_U\331\225\0248ur\252\372\344\302z\266\230"
+	.ascii	"\306\330e\355\306\r0N\220\020r\344\300\356\342\300Q\363\276\254"
+	.ascii	"Y\203C\367\203\304\307\035(oT\256t"
+	.string	"J\336\235\2477hX\035\035erY\237\004\276\375\003\333\260\231\213\277\242$\271D\255\365\211\311zn\016\250\306\211]\024*5i\272\004\211\225\244\001\242Y\241f\006\336\031u\0138\243O\317\352\f\212$\235\212\362f+\353\223\020g\377@9\265G\220\246\036\\cmOqi\032$gnU\312l\274SL\232\223'p@2L\2243\270\230\336\310\331\215\001\2121\023\347NR\016\237\226.a\200oJ\322$\321\312\232\207\006\021=\274\254\201l@6 \030\f\230\370\266\266,\301|i\301\216\357\354K\333\257.+N\317KZwa\206\231\223-/Z\215\372e\347V'wv\006\\3\322\001\030\255\254\345\232Z\326A\366FD--u\243<+\202\226\"\371I\361\212\241\240i;\024N\027 ^Y\237\004\266\235%\013P)\004\003\257)\276\213\013\250\204$\323\223\3463\252$\006\023!\006\235RJ\231\252\322\004"
+	.string	"\323\025"
+	.string	"0X4\032\221\313\245e\315\003\024\200\fW\316\236xF\035M\264(dJ!\031\021"
+	.string	"\b@"
+	.string	"\200\026\377\nz'\336\3413H\320:\352\347\024\217\365"
+	.ascii	"\337V\203t\266\177V\331F\215\023\013pb\204\326\265:\001\305\241"
+	.ascii	"\367\0172\261A>\020\017\022#L\236\253`\207\334e\212\272\246\315"
+	.ascii	"r\204\024p`\372\341\251\241\325\313x\367\005\320\003\t;\336f"
+	.ascii	"oP\366v\252\374\2733\307\276_\037\312k\030n%\031\334\372\250"
+	.ascii	"7:F\262j\314\025P-k\367\244\003\327\350\376\007>\\L|Z\355qx\227"
+	.ascii	"\234am\225WB\352W\257\0019x\335r\2634\360Y\262\314\364 \320 "
+	.ascii	"\316\375\362q\306\220\235F\265\254\234\344d\251K{J\224\266\230"
+	.ascii	"Y\376h\212C\221\271\271\346\267\241\b\230UU\344\233P\270/54\366"
+	.ascii	"\316\345.\036\264E3nC{\226|\365\031^\030\204\356_\t \363\240"
+	.ascii	"'X\221\211\246\030\311\347\256\364\310\225\016%\300[\026-\244"
+	.ascii	">\365\030\301\314\207f\036\207\373|\264\211\013/v6x\237\304\321"
+	.ascii	"\267\250\207\370\246#\221\t]<D\307V7\317V\223\321<\302I\201|"
+	.ascii	"?,\341E\003\341\254da/q\351\232\261n\247[\375i\333\021\214\372"
+	.ascii	"\371\272d\272j.\323\0133\035\374`S\002B\201\350\326\211\342q"
+	.ascii	"\311\334\350U<\232\312\0219\350\322C\271\203\035\013S\377\225"
+	.ascii	"\206-\\\223\203\241\265\0375\b\374\204w\373q\002\313N\207p\352"
+	.ascii	"q\373\231\233|\240G&\354\233\361'|\270S\005\220\263\202,PB\310"
+	.ascii	"Ye\f\322\242\033\372\r\314h\335vZ9T\255\354o\344\303\210\205"
+	.ascii	"W\374\204{\336\226\343?\f\351\351i\302\001d\223\r\"A\365\311"
+	.ascii	"#u\n\252,\314\221V\035\367\310\3155\366Z8\306J\207\206\276\301"
+	.ascii	"\334\302\252\203\235\256\231\340"
+	.string	"\002S\324\025\206\235\202#\210\232\223QrW}\004\324\275J\222\345|\201`\204 kY\3050\322;6SY\212\263\321\322\316\331\246\221\211"
+	.ascii	"\237\004\303\320\201\377\r\324\001\001"
+	.string	"\n$\022\345\230\007jD\2256\306\214Y\262\364\212\017\312\307\245\340\274?m\t\333%u\232\3241\354\224\004m\215\375\363\261\031\300\ttK\333gQ\230\360\231KSLN RAr\371\036\006\026'\211\022\312^\267\023\302\2666\266\342\376\242\333?oW\r\227\231\256D\316$i\377\225\245`k\367\220\333\316\372\013\235-\364\376`\346\375\336\361\371W\315\375S\3165\235\023\355}H\310/\200\301\337\310\013\031$^\017\31509F\356(^u\270\217\322\307V\325%\240\375.\335h\302\203\223\240!\030\251i\330\003\207. G\226\210\350\035\326\326a\335zB\253`n\360\2274D4\026\310L\222\352\261\364!\323\b\237}\002^\244_[_q\330W\233\345\337\017\241W\\[<z\373P\356\357\324\273o\027\021\351\272\t\256i\355{\303\244\200\354\234#\004@\034\2773\251\335r\3408\214\363lt\032\036`,\201^"
+	.string	"\t\365\351\245Y\354\267\347\211\320\"\203\\\346\206\224q;V\005Ew\320O\277\215\222\rW\254\364J1\221\337\2621\020\340\360\321\022\2313\211 \352i\f\231\245\355R\007\344\321`\265\005\345\216\016E%\345V-\201c\266\320K\313\231%\177\177\222\344\346f\252\022\253F\355\022wT\3653Y\374\221*\256\371\002\231u\340y\335?\002\005\251\222\313\252\227^\220\200%\003\344\226B\001\307\210\031H5\341\r\t\301\004\313\306c\033\306,/'\204\206\2454\022\032\350WI\3460\225#4\210\304*?\035\207\023\006x\271\007@\252Y\336\361BJuoc\251x\341\344E\177b3\357\244b\021\002\2244\256e\341G~\006\370>\332K\373O\225"
+	.string	"\363\262\324V\210\030Se\330W\b\002\031\002\026\220\204OH]^'\274"
+	.string	"8\246\331H\353\226!\235\311\027\274uMaH\357e\236\003\237P\215A\007=8\024k\272\326\t\367\214`\315\\6DP:\350q\0344\360_\321\260q\307\344Y\252\313\2367@+ ,\245\223\211\t\b&\\\001\201\215>\232\207;\003\340|\234\"@\220#\274\330\306Tf\340\022\3719\324\265\346\231W\223\304\370\227E\232\214\033O\001\0264L\0163Z\n\264\224\273\251\210\230\227\004\246\0303\202\202\221\303\f =N\322\212"
+	.ascii	"\361\006\005Qe$"
+	.string	"\237\0249\210\335<\270\343F5\ts\232\344#K\345*+GGmLP\326\202)\262#\206GS\304S\215\357\371{\360DtuH\332ju\334\270\255\3527\330y\251U\023\036Lo\241IW6\226'\204\342\343\r\b\345\374\322\323[\"\035c\364\327\202\270\306\026\233>\355\315\257\206yL%L\274\331\244l\355\371\274\354\373\020\352\344\273v@\254\022l\277\242\247\251\227\243\002\"B\004\307\323}T\305\265\033\203\260wMTd\313x\305\336\177b{L\344\220\321\034\020L\245\307\023k\255ga\350\r\232\342\315\233I\260~>MGE\246H|\250\334N0\332\341\263\252K\235\004\364\031\305\007\275\300\236\f\023\034\255\f}$E\20769\027D\264\223@x\345\307\224\312,\370{(\0350v2\256\230G\361z3A\337\214{i\261\344s2Vf\020S\346\263\235/\301]\312\331\315\312\365\002\345c\330\356\274L"
+	.string	"\300\204\244\r'\f`K\nz\037\3772\345\355\3051\260\334\203\017\302(\350\016\373\327\377\221N9\346[\346%R8!p\026\325}s\235"
+	.string	"\220\277/\347\035\206\354\234E\323A\363J\265\334\340\177\223\240\021nuU\242(\350\213\235K\254\033\375#]N\252\260\336\350=wa\217\356\177W\333]\252\032\346Y\253\204HtI\247\207`c\257\237\263\025&\347\007\223o\227\tW\244\360G\004D1}\352\027\241\215\314e\337\003oK\267\266\305\224S)\217\355{\353\247\267\264\037?r\034\301y\305\023B\265\375\"Y\016\020\215L\\\351b\003\027$\0012\tvW\023\235:q_\251\375\274\311"
+	.string	"\332v\373\337K\205^\302\275j\273\242\025\217G\346W4\347\316\271\331\221N'j/1\354I\207\234Wa\216\276\212\024\324@]\231-N:\2562\337<u\366\264F\272\272\301\340)y\343\021\374\365\227\323\326\276\217\0343W\3744|R\007\314\210\356\231\312tP\3759\354\311"
+	.string	"\365\256\255\364\242\336IyxFnkP\200\021\037\334\371\021\017\225X;\\=\nZ\347~K\315\004\370ek\230\327r V\251d"
+	.string	"a`\272\204a#\317\227\334\342\265%\300m`\225\261\364*U\363\030\201\243x\202N\016\030\037ni\343u\017A\037,\326\376\277\330\206\262S\306\302nA\"\330V\237\foS\267\226n\323\024\025\271f\340\351\372G\016D\254\256\264\275\353\346wJ\363\013\004\355\204\f-\217\240\226?\356\217_\241\3576\346\353kr\034\206\255j\277\r\270\330-2\270\331\3672N\337\304\017I\351GGS\n\251\211\266\370)c\361\201\301b\3413v\215\212t\371\256\025C\321\276uQ\246Pk"
+	.string	"`\0053H\367O-\227\027hy\316\240\003\220=\200\361\275\026\327\t*\322\236\2550\0223\\?,N\016\305\300S'P\246\013\244\t\252\213x,\2463\344\247\013`\265\b5\333:\201\033S\226\261\212&{j\266\342\022I\313\257W`\036\370\034\274S\373\265\244\375\353X\035\2423\363k\035?\224\324G\327\004\230k`g\332\201\f?\305\301\341\313r\004Y5\243\227\233\260\037\033\363l\331l\323HH./\276lt\301V\330\213\004kVibf\304\365\302\364\365\311+\235`/\327d\200\301V\366:Q\363.r\371\260\277A\036\025~\250}U\337^\030\330\337)\211\312\f\3445%\256a\233\266"
+	.ascii	"\370b\037[\306\177\214\356\245\341\330Q\247\330q5Ip\255\302o"
+	.ascii	"u\330\016\n\rZ\306\177\321\363b4\030A \032\215\314\34337\227"
+	.ascii	"\306\212\215\243W\362V\302\312\277"
+	.string	"t\227\002\250\203\225H\346]\340\367W\001Q\257\326\260+\365\346%\361Zc\025\242\323\206\317*-\372\321mvNJ\004\"\370\312\037\211g\225\025E\206\007\377\321I\301\271C\023q\331\032:_\"\376\034\251\301\266\222`h\347P\247J\b\027B$2\032\251~\304\377\307\304?\022\334\022\352\215,\223\177\f\3428@\311*\r\207_\303WeB\215#l\336U\340\267\236\267\035\"c\215]\034\274g\342\0309\261\256y\\@K\260&WT`\216V\217\304\307g\361\256\023\225\200\270=\240\242Q\212\356!\343w \206!\262;!\001L82'1\214\263\331v5p\352y\271y&U\017\r\017@\372L\336\203z6\226\206H\322;\350\002\322\266b9g\036Y\314D[\356\301\335\340#3.\025\304y~\f\220\335doX\345]\344o\201+\352\230\360\337/8\020z\261\202#\271\367\222\036S\241DB%\207P"
+	.ascii	"\301\226\023\013\345\013\027e\225\321\245\300\273\362iQ\030\""
+	.ascii	"b\231\234\003\236j\336\307\r\375>\334u;\365\206u\021\244\324"
+	.ascii	"\255\251\345\275\244\3404\311\215\210\350\355\211\2533\241\213"
+	.ascii	"\323\330\217\222Ll\021\222\246\360\272\272\225\330F\002&<\313"
+	.ascii	"\005@(\016\340^1\3613\310\345M\342\370'\035\214\270\210\212\022"
+	.ascii	"\033"
+	.string	"\214t&\342G\004\202\024\251\007O\357\366\206L\272\361\204g}:y\302\212\322r\343\375\372\313\346\326\233\324\001"
+	.string	"\333\351\200\025f%\224\254\205%\2100\021\264\224\343\266\266~\037p\217s6\335\347R\324\207\371h\221\245\265[\315\210\016\016\3723\006\235\013\002_\357\300\355l%\225\225\264O*\245\262\002\313\223\006\330\203$\241k\257\264\027\003\215@s\366\264\215,\310\204\260\273\016\251\274\341d\365u\036\027\035(D\267ru\356\327l\341\332\375\026\355-\365\362$\376\353\323\266\206\\b<e1\355\365\333\351\225o\216\305\3663R4\266\322\261\200^\36753\262.O4J"
+	.string	"\342\024\236\021\260\002\022\006B\254c\233\354\270\261|(i\212\304()\336\325\222\251\023M\260t\370M\310\3750\373\240\313a\205\253\211vOrM\211\033\256m\314\352\275\236\227\342\304\\W\3403\016\335E\374W3\213yA0\320\205\317U+(b\361\334\"\213\356\337@\301+\221\353]\210\321\376\326m\336\"\016\261z\376\366]\357\307\302'G\371)\373\2760\030\216\3673[\007\253\254\371\352\231^<[\331;\367+\203\314W[\234F\236\211\f\232\201\fI\372vi\217\021\031+@\307\223\223-\\V\226\336[\211\200\002"
+	.string	"\235\007\270\206\215M\005\027"
+	.string	"`\366\203\350\203\234\235\320\333I\365\252\314NJ\313\fD\353l`=g]x\022\311\372\033\t\271\354k\306"
+	.string	"ZM\004'\343'*\260\355+\264\270e\353\252Ah\364\226j#\306\363]\364\002!\013\357\027\207\253! \026X\003\n\bC\t\307$\354\306\340v\\v\242<]'"
+	.ascii	"\200H\2271\021s\353nK~\231\022\337\227\362\366Z\247\371\006h"
+	.ascii	"\0030Q\372"
+	.string	"\360\032)\274!\302\207\343,\371\021\235mEZ\217\223\034E\314\225\230\001\371dSr\250\330\342`\230\213\225\342\260\002ZW)\255^\310\246$\2309\213\326\0244j\322BC7\325\260\211'\230\240y\034\222\177\031\257\276\256\036\267m\"\333c\002\035w\272x\344\341\n\310\272G\306&7\264\235\240\361S\312\361\234vL,\320>1\251\3236\255b\211\253XD\357\310\362e\220\266\233\342\riHC2\340\312\r5\313\266a\300\254\021\266\020\255\314\323#\257\311\203I\335b\022,\30323\312\323*\374\200\225|$`3\331\363\230\320H*>E\300\366\363l<\251*\005\254\007\004\030\347F*I\322L\272\021\245<u\212\271\350\347\327\266\370\372D\220\247\025\301\001T\301\322bh\201\376]\321\354F\300\035\230b\305\252\371[\311\220\250\231or\225\273/\\\202A\325%\341A-_6\247\fR\026z'\341\006\264\361"
+	.string	"\306\306\264\0346\370\030\310\277\370U\3642\244\237\265a\004\213?p\205\241\204)V\305t\\\260\336ZDo<\037:\331\206\207\354\261~\320\245\362\255\251\313Ky\321\324\375I\201\225\336\216\033\003\016\262\314\315\306Q\333\263\257\263\t+Kp\346\2051\357(\227\351\303\250e\025Y7"
+	.string	"+\275\222<"
+	.string	"\237\355\257\340O\237d{\024\026\\i\211C\016[a\324\264\334\226S\3430\247\027\001\264\034\236\336p\207\313f\246\203\276\334\363\b\376\320\326\323{\307h\215\203\322Bb\304\354\334`\007\261|\274\247\323\373\n\212\305\240\343\360\270#\222.\243_9e\2355s\372b\254\317\242\346Z=9*\b\2523Y\345\2318mNi\017\240G2x}KG\366\235R\315\230v\353\241/DRex\024\021\037\377\32361\202\300p\246\024\n\271\304\345\204\002\237-\" \306\276\0358\201#\035y\202\002f\225\267\261Cj\217<\251\002\253\313\340\373\355"
+	.ascii	",\025\270/\366x#\332X\374\0203I\204%\024D\370k_3zG\374\205H\243"
+	.ascii	"F\254q\374\315\235\313~\024\354\375\024\264\n\032*\327\361\357"
+	.ascii	"\017\027\204\206\354\333\3253hXz\215\235\332Z-0V@\340)\377<\307"
+	.ascii	"XS\220\212S\341\330h\022\355B.6\206\202\352\203\242S\201/$|x"
+	.ascii	"\244\200{/\211.\255\207\353\004C\204\005s\273\233\326\315\036"
+	.ascii	"\003\253w"
+	.string	"\013\260\321\372`\367\253\343\374\360u\365\021\027#\345\226\3542\363nh\3200\036j&\332z]~_\274\266\023\205\034\001^t\24116\336\215\t\307\273\333\310\223\333!\266\347KqK\254\277Z\220\363\261\236\356\204\247\337\260\372|r\023bq~\203e\0312\271\022qS\226\023\037\\*\240\0210\t\266\214\005f\340\232\354\323(m\n\210Q\300\247\356g\251\361k\340\201\337\340\306bc;\376!{\374\340\030\031\303\036[\241\3168\1776f\307\227\357\356m\314ul\265P\306\007l\346S\273\322g\375\351\013B\272\310\244s\375\265\370\372\230\307\342m\002\026\367\200\307\001\032\346\033\245\213\377FIF\3339\227N\366\f\214\346\032V\330\252U\323\361\346\017\306\276\035\330\227\236\327\304\333MN\b`\356Wk5\345\215a\231y\325\345\366\036}\264\017J\257\244P7iR,\203\200\334V$0\201\342&/\217C\342\231\304"
+	.string	"\313\036\242\037\255y\214\216\013\355T\003\177\276\203\2004g\331\240oL\373dNU\361\032"
+	.string	"\223\307\276\241\250\337\336R~\303\224\032\177\206x\271~0\030=\301P'\2453N\243\245\230\034\321b\tx\b\200\001\204\223\201YP\265R\216@{6vHf\362\307\320"
+	.string	"7QL\003\230\222\247\344\330M\205#\336Z\301\\3\224\201\326\370_\247.v\022\253\306\234\365\232Kx\220\375W\303\217Zs\270\304\\.I\226\223\375\352\344\252\007\004N\256\316\211\336\262L*>\2040\303\335\265/\254\371\211\346\ff\355\030\317f.}\003&F?~\234\204\224{\213n\252@\027K\234\336T\257\367_e\030c\356HFX\346\316x\242\372\231\325\256\214\226\355r\332\203\341I\b\203S\n\263vpJ\335\331)F^F]\226\017\f\223\256V\277+\215\245\356\272\035\337.\246\b\261wL\3367\342\341\337.\b\367\337\332\200z&\213\3321\231{\372\303l\017\t\361\037\3740T]^\1777\322\267\252\0016\304\222!$\236\265\304\240\023\252\270\302\376\340&\327W\335\024\334\346\005\032'\\_7\366>\030v\310J\261\361L\005\f\244q\001\276\202"
+	.string	"\354\207'\016\225a2;\\\2003W"
+	.string	"\2678\\ \230\231\2136O\242\327\326\177_@\224Ru\330\017Q\272z\274\003\337JW\032\301\325\210\231\202\252\305\376\214\3137\370WH\252\275\247I\215\372\263\247\233\251\207\336\311f\270_=}\276VV\353a\234"
+	.ascii	"\205]\274\224\201\017\314d\035\3118o\251\265t\320\266\370\365"
+	.ascii	"\023t\304o\267\032\321\370\b\370A\003\300\nn\177\344\317\227"
+	.ascii	"\337s\22168\270'\024\232tL\216\026}-\320E\001\007];\023\t\240"
+	.ascii	"\243\f\324\227\264l\017\372\347\207\002\254\f+\312\356\265\250"
+	.ascii	"\267\201z\236\b\231\030C\\\234\024\324(1g=\223\367+/\202y\335"
+	.ascii	"\030\001\227U\006m\312\241\242\302\211\2252\251\032H\0164\212"
+	.ascii	"hG\032\216\255r(\361\376-\363\206)=b;EL\211\013\360\331\356\363"
+	.ascii	"\207uo}\363Iq\375\265Y\\\313!\273\336Q\212\304xPFR\304C:\341"
+	.ascii	"(\261\246P\237u\205\276@w^\320!12$4@\362W\025KH\225\244\350c"
+	.ascii	"0qq\223b\305M\200G6`\327I\354\027Q\354V\224zo\267\3357iM\377"
+	.ascii	"\025\025+\351\256h"
+	.string	"\344\242\363E*m\2726\361.\007_\305\215\270v\201"
+	.ascii	"\225\356\3025\030\3041~\rw\310|\024\007\324!\311\237\007\365"
+	.ascii	"\362W(u\254\030n\022\246"
+	.string	"o\362~.\341\226\372\234\n\316!\250\366\324u%\253\004\273=\036\b \276)\221\217\305a\021zCf\016\213\243\024\303O\2346\017\236\003v\240\037\356\351\312\312!^\331O\030\212'\201D\034D\236GW\334\206\354 &\2265`\r\351\263\260jo\305\231,\200#\021\t\247\026\306\306\200Pob\225 :\200\006Q\261S\001a\344\267\305\220\013v\n\026GF\334*y\310\262\256\026\221v>\2535\0136xC\337*\316\217\332Y\365e\006\364\341\376>\r\271\2776\256\276#\"G\035M\331\304\004)\013\033F^\017,FFX$\b\244\253\332\020\243\274\224\302W\244$\257\036\332v\006\211\333\213\365\313\266\260ZV\214\301x\335}\254\027\331dYI\264W\201r\322u\250\262d\245Y\277\313H\224\364\222\331\313$\264\2328g\tUT`\315O\301\302U\241\205*pg\255\262l&\321$.\323\016#\307\343\220"
+	.string	"(\026xI\370w\tD\365\220\221\\\271\364\346\343\236\234\005r\237\221\2142\363\021\031\361\f\333\253\025\267_\305!:9\031%\362\322\243\323hE\017\002C5q\307^qa'-\002\244=viv\027\311\266\252SU\003\212\035R\025\370s\373+\365\236\331?k\332@\027\356\363\327W\271\357[\327\204\032\232\236\305\377yx\245\277\037~j\356\277\337X;\375\354b\007\001\323\341\321\006#\311\247\223\340+\263OAu\3304\277\342\371\257\001r`\264\377~\202\347J>b\301\006\004\347\357\323\333\016_\237A+&\247\261\216\t\366\316G\347\270\314\227\037{\007]\330\203\324\007\"x\276{#\350\300\275w\366u\230\003\227\237t\006\317\373z\334,g\035\276m\3718\315\033\031\236m3\003\201\374\234\235\367\225\335\303\270e\350f\203\233\360\004\317t\307\350Kz\006R\027!\376k"
+	.ascii	"?B6\341\343\244\265\342\030\362\360}\236F\006\2526\342\bqB}\314"
+	.ascii	"\240\315\006|\310\003\036|}O\021\313q\2215z2\323zn \331Q\302"
+	.ascii	"'n\276w\374\324\232\247\276\317\221\3608X\367\002\324\246\332"
+	.ascii	"r\346\373\367\3633?\235%\\\355par\211\373\270\002\361\355\247"
+	.ascii	"5\031\237'\311\036t\211\234?\267\263\374\r\263\b\373\271\257"
+	.ascii	"!\221\367m\3403m&Y\375\231\276\317g\253\275@\311o\263\206\321"
+	.ascii	"_\273n\271+H\323\364\314\037 :\021\301\365\370O\343\315\315\022"
+	.ascii	"\317{\2437\374K\2746\240\275\365\360.N\264\273N\367\312\343\232"
+	.ascii	"\367\021h\365\221\2152\342\366\223\364\177\267\364\b]\237\b_"
+	.ascii	"\212\237\223\375\207\264\357b\236\003\367\233?\275v\367\357\244"
+	.ascii	"\263b\275\254\037\266\262\363\273\274\312\023\3755n\242\f\252"
+	.ascii	"\324\177\365?\322\325[X\026<\364"
+	.string	"\357P/O\377an\227\344\177\344m\361\005a'\353\006\232\324K=\236\210\321\271\025\270\243\244\376\241\337O\177(\3020\352\371H\346\316\227\315s\231=>\342\254\207b;\232\345\373\004F\231\226\021e\226l'_K\220\016\217u\021\322\317\034uo\302\201\271\270D\322C\274x\032\275)\213CPWL\036\b\301\353\317\016\3375\302-\354\245s\237\375\331\217he\227\335\344oh~\n\356\r\277\214\303\333\343g\332\350\226\321\331S\326\0339\3629(\231C\236\030\355U\026\033t\311\375\203\305\230\021=^\376\375\224\365d\373\223\201\341\345\322\351\210\335\346\252\236\f<\335\211\361\334\250\335R\354b\344i\231\327\"\327\305\321K\363\207\367:\025\274hy\305\\xm\236%S\027\2747\344\302\177g\373\223}\360\361\210\336\355}5>\333)\007\230\250\363e\371X\370P>\3571\"\203G\324\341\335m\326\247w\365\037\330C"
+	.ascii	"\331\217\364\353\350-\240\214V\237\362\226\213?\253\360\207\263"
+	.ascii	"SIQ\344\021}\201\325\256\363\342\007\323\203%;>\206\203\r\354"
+	.ascii	"_\373z\357d\345'&\377\253p\007lY\214l\327:\237\345\357\261\344"
+	.ascii	"\272$P\373)j\201\317\315\b\310\254\3643\216>3\005\3558Q\373\032"
+	.ascii	"V-|^\271\343u\024[,\276\025;\367\370a\b\2556\217\346\274\330"
+	.ascii	"\372l\277\263\006~\377"
+	.text
+	.section	.gnu.lto_.symtab.3e86d57d51d3abfc,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\003"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"canUseLaunchControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"areSticksActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"calculateThrottlePercentAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"getLastDisarmTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"throttleCorrectionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\004"
+	.string	""
+	.string	"osdLaunchControlModeNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"osdNeedsAccelerometer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\004"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\004"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\004"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\004"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\004"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\004"
+	.string	""
+	.string	"osdSuppressStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\004"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\004"
+	.string	""
+	.string	"flightStatsReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\004"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\004"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\004"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\004"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\005"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\005"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3e86d57d51d3abfc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,334 @@
+	.file	"flight_stats.c"
+	.section	.gnu.lto_.profile.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 ;\265\001"
+	.string	"\324\002/"
+	.string	"\005"
+	.string	"\261\237\365\212\013\004\002"
+	.string	"\002\001\002\002\002\001\001\374\320\343\225\r\002\240\342\234\212\n\003\266\273\344\364\f\002\005\346\300\255\206\004"
+	.string	""
+	.string	"\002"
+	.string	"\003\341m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 /-\001"
+	.string	"\330#"
+	.string	"\003"
+	.string	""
+	.string	"\001"
+	.string	"\001\003\002"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	""
+	.string	"\001\005\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"*\243W\302\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 \2435\003"
+	.string	"B\005\023 \2405\351\203Ap\3728B\374\002\340\275DOl\352\364v\013\001UU\025H\272\373\332\266-w\nC\210\030\375\272\213\344\230\243\377\325\266\255\251\2000\005\220\357E\2727\205\370\357]ED4\336\271B\246A\365\355\351 \363\240\376\006\004\t"
+	.string	""
+	.string	"\231Vv\221\272\003\006"
+	.ascii	"\025`W\310Ru\257uCo\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 yM\002"
+	.string	"BD\r\027\300%\215\001\377\277\033 \376\377\246\236s\375\377\277,Tn)eJ\001\322\034\275\360\376\352\300\003.1\323\\\360CR\361\362=\354\207\315\nS\304\213\254\246\222C\006"
+	.string	":u"
+	.ascii	"\276@\317Ra\232|\31626\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\230\004\003\230\004\005\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 \"\275"
+	.string	""
+	.string	"x\026"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\240\340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.32b1021b594d3732,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flightStatsPercentile.4.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 ~\245\002"
+	.string	"\224\003q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\001\005\001\006\035\001\337"
+	.string	"\005\001?\202\210\200\020\177}\274\001{\273\025\001\003\005\277\002\302\273 y3\304\0014\303\001\301\001\300\001\276\001\275\001"
+	.string	"\n"
+	.string	"/B\226\332p\3258\260\201U;\200\261\236,\210\352!\31650"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_flightStatsReset.5.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375`\250\001\265\017"
+	.string	"\326]hE\360\260(\035Z\030.LDg\022>\317\261\260\310R\333\305\231\323Z\001Ar\355.s\321\204\344\250\254ao\255\246\205\307WU\003,\341\325Qw\340\031\230\236\253g\\0\306\260r6\271\326\204/+${K\231RS"
+	.string	"R"
+	.string	"V"
+	.string	"\361\343\036\333#|\307\366x\316'\033\006\001\024O\013\225\030\215\335\355\264\203\341\341w\303<=B\315\223\037\363l\241\360X\250G\350\241\301l\030\300B\201\t\\2\332\nK\225\360\205\345\372\3579\233\341\261X\236"
+	.ascii	"\032\354\256\323ci\270\267\333&\331F`\037G\321?\321\1777 s\251"
+	.ascii	"\001KeM\325%\243\275\250\266\330\037*\365E\203q\245\260\276\354"
+	.ascii	"\316g\356\r\246c\246\241\2465\323\371\3649\001-\217\030\273\031"
+	.ascii	"j7\366&\252p\371\314\355\313\370\237\271\2078\354\364\031\317"
+	.ascii	"\340\3268\220q!cwA\036\035\022\340\0016\204\by\317\037)\212\262"
+	.ascii	"\177\002\203\347\236\315\310\001\234\3355q\331\307\240P\336\013"
+	.ascii	"m\217Q\357\265Ta\311K\210\036\253\0311 \241\372\330\007\3305"
+	.ascii	"\3656*9RY\263=\3411\223\323<\354\256\024\330&}\304\350/pvW\013"
+	.ascii	"D\234\346\002<\210G\227N\266{\017\242\033$R2}L\245\021\223\204"
+	.ascii	"\022\021\005\222\016D\322U\020}L:\020\251\324\211\024\360\310"
+	.ascii	"B\210\324\231F#R\307}{}\305\374\301\212\233\224\252\242\266\230"
+	.ascii	"c\241\035\325\234\004\371\246+\236m\233\036F\223\263J\033\207"
+	.ascii	"\273\273\320!\337\264\243\334lF\n\007U\326\334\221\251P\243\006"
+	.ascii	"\" p\20217\305\003b\300\2761L3\370\240\354\205\271\371\217\242"
+	.ascii	"\003E\tEk\276\355\246'/\032P\034\206QS\220\367\330\270\t\244"
+	.ascii	"\374\362c\260\f\250\375\340\225L\034A\354\020o\3050\211\313\246"
+	.ascii	"\257\020&\0074D\330^+\323\332A\377D:\027|\002"
+	.text
+	.section	.gnu.lto_flightStatsAdd.6.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\305\f"
+	.string	"\266\230WB \217\223\016\220\377\321>M\212&\001~6\037E\241J\343<\322e\223H=\017\361TN\006\376\033\262\330!c\204\250\232\317\261\376\254y@\b(\025L#c\372\024\007l\277\227\363\252K\311\337{K\231RE"
+	.string	"@"
+	.string	"E"
+	.string	"\036\357\210\207\357\001\342\2415\273\305"
+	.ascii	"\223\r\026'#b\354n\245\034"
+	.string	"\256\375ij\376M\337l\034\351/\303\365\025\2309\361\202\203+y\035(\035\266\233\236\027\270R\246\206\202\335un\034\206\033\336\366\002\333\b\354g\001\177\273\273\326\025[\323\324\273?\336\345\207/\235\232\376\006\200\005\001*vQjfl\fD\341\301\3669\266\263\243 s\332\335\017\037\240\016\375\264\017\342!\264\273T\360fW\003\314i\267\373\260\001\3520,\273\233\200\304K8\360[\016=bY\3610US`l)g\241\2319\251;\221\322\233N\245xYQ\2224\376;\361J\251\363D\245\364\227\213\210\340\267\370\312\362[\026\017\257\236\0172TH\262\306\356H\251\033\354\241L\344#\001>\203<\027\366\301.\006X\203\020\221\bH\005\002\251\036\210>#\025htU\236\216-\b\241Q\205Y\326\250\342t\373\267\272b\350\"\206DK\217#\243\246\332\241\220\374f\017\023%\33171aCf\263\215\035FD \025"
+	.ascii	"c\21123^\327pz\004h\263\025\215\321c\320Ze\263\322\205\235\207"
+	.ascii	"/+\366R0\353\020]u\017k\245\013\303*\f\r\n\023P\007\307\2651"
+	.ascii	"\225\220S\n\265\007"
+	.text
+	.section	.gnu.lto_flightStatsGet.7.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\355\b"
+	.string	"6\321>:0%'\035\3003#Id!\270J\2144\367]\301\211\306\277\361`J\027\n\001mC&k\340o`\220v\237\237D\f\007\203\026\b\374\363\272\331\317\243\317\237\266\210l\262wJ\001-"
+	.string	"/"
+	.string	"+"
+	.string	"\247\t"
+	.string	"\"\252\235\335:]\177p]znp]\306\223{\207\236\177\2273\310\344|&\322a\200\304\356\032~\246\323\035o\273\3016\204m\234VA\r\202\315\356\310*\300\336H\232\024\333\235=`\033B\373,o\351^?,\260[\2423\263[\037\354\340\271\374X\266}\225\257t\366\022j*\266A\256\342\024R\273\033\361r\230\016\037\345\322\036#\370\357\322\037]\2270\376#)\301\225]I0\232\330\267vw\035Q\206\257\377\003\024\243\234\345\f\304Q\214r\024\364\302B\204\021\232Yhj\210\260\214\231m\334\004-X\333\250\330&\325\264m\272\356\255\215(\307O)\206\330\217\341 H}\001\013"
+	.ascii	"\025\023E'\006\210\221@_\250\331\f\217\313\250\220\306`\300\004"
+	.ascii	"\001'\214T+\035a\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 \263\225\003"
+	.string	"\342E\026\"\240'\351\350bq\305\335\366=\241\375\213\320\371$\374g\366\377\377\377\bV\334\377\337Zk\204\264Md\n\023A&$\021h1\243\203\366<\242\305\332\004\347\260\355\017&\201c\b\270\205\3404J\3336\267\022c\312\236\206.\212\372S\241\215\277\207\034x\304x\240u*\375+\002\b"
+	.ascii	">EN\314\324+\301p\331\023J\216\t\254k\n\311p(z"
+	.text
+	.section	.gnu.lto_.refs.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\002\002\005"
+	.string	"\002\003"
+	.string	"\004\001"
+	.string	"\002\002\004"
+	.string	"\001\005\002\002\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.32b1021b594d3732,"e",@progbits
+	.string	"(\265/\375`\247\013E>"
+	.string	"\032l\244\027DPdR\007S\026\251\003\2378P'?\377(G\246\216|R\264\321m\346!&\201\344q\266\273je\205\202"
+	.string	"m\254\003\264P\236\377\255\026\fp\0240\306"
+	.ascii	"\020CO\255\360\206\233-\307\252\376\300f\327&2\245B\001c\001"
+	.ascii	"h\001F\312\261\345W^\333\245\335\036{\026\007\343\360\177\333"
+	.ascii	"\377\0170\232\213\333\222\226\327\276`!\203\203q/\376\346S&\207"
+	.ascii	"*^\250\256\326\035l\007\343Pg;p\343\037&C2J\265\306\360\376\343"
+	.ascii	"0.\306\243\016\347q\235\343\177\350\377?=)\371^/)\016ve\362$"
+	.ascii	"vm\363/\036]r\267\266\220\241{F\265\177\026\005\242\022\310O"
+	.ascii	"^\273C\333\276\304z\325\227\330\216j}\213s\361h\223\257\265k"
+	.ascii	"q\265\016:\306\037\377\307\277|\006hMK^{B\333\336\245\221\216"
+	.ascii	"\237\241\205\332\366&\266W\255z\023\333\271\315\216\304\002="
+	.ascii	"\211\365\367$\026\350H\254_\t\266cAb\225\314\370\177\034\316"
+	.ascii	"\314\252\344\265\347i\335n\305\237M\275w\013\376\350\177|\324"
+	.ascii	"\"\303xy\346\265cOb[Gb\317H\350\356\266;O\350\366\005On\020\372"
+	.ascii	"\327\235\rt\373\222Sw\347u\273P\323\003w\340\r\016tw\212\356"
+	.ascii	"~\020\240\333sw\203\351\3560\335\356\335\275vg\241ng\320\355"
+	.ascii	"\b\272]@\267\377\272\275\250\333\333n\357uw\265\273\331tw\037"
+	.ascii	"\271\356\226v\367\263\273\215\272\373Lw\007U\253\325j\2673u{"
+	.ascii	"\223n\037\227G%p\372\306\360\307\371\367\250\326+\027\374\213"
+	.ascii	"\301\3128\307\037\016\2275\345\312j;\302\036\377?\201dV\031\374"
+	.ascii	"\310\351\353\204\377\235Y/>\211\301\030O\377\210O\215fb\277\245"
+	.ascii	"\365_ \371o\364\237\376\277\361\377\205\224b\361\177\030\360"
+	.ascii	"EK&\377\231J\311\0273\306i\375\347\350\034\270\345\013-\203\203"
+	.ascii	"q\\\240h\217#6:\332\307i*[\2501\313o\331\265hK\257<~\372\244"
+	.ascii	"\301\205\375\310k\236RKG\214\021&]\333"
+	.string	"\376T\343\205\212\306\316\241\316\346S#\036\236_\250i\354\214z\377dmhqs\234\256J\224J\307\353\3704\032\342\211\205\312\307\3678\236\343\361<~\347z<\352vn\247\375\216S[)\376G\372\263;\350v.\307\351\214|\377\3155\264\377\357\013v\336\306\343\370\224\0317`\343\3421\345\377\237\224\236\2362\230\223.r\30053\371\223\326\311\353|o\354\306\242H\332v\263\266\035n\333\305Zw\343o<\332s\016\247s\035\267i\220\036\255\215\237c\333\225\255O}\215G[\352l|\310\370\241~d\214\361\310\333\322\020j)\3335\332\236z\022\333TOb\375\214\221\032\256\347\312k\307h\235\214\227\361\250\233Y\325\340\270\250w\374B\363\226\327v'\366\347Nc\226~\361W\322L\316\245\0017\236y<:\177e\037tsS\202d\037\271\207\317\031\005\fP^\354\363\361e\230\344\325\313\355\260\322\257:\3119"
+	.ascii	"?\334\306\f\311k\367\220]\321\334\345o\256\366]&\242?\230x\377"
+	.ascii	"d\"\374\366D\031;#\223ud\0359\331\002?\253\216\016\365\347T\222"
+	.ascii	"\327\226\267:'Y>b\202T\363\232w\370\334\n\035ypy\355;\247\353"
+	.ascii	"n\037+\307)\004\307Z\333\235oD\363\215\374\372\336u\016\013\365"
+	.ascii	"\225\312\374vg\255\214\303\373\020\301\377\310\325H\231,wym?"
+	.ascii	"\247\265\355T<\033\243\331\230\263\234\200\217|\363\205\372\312"
+	.ascii	"\036\021\362\221\205\342\206\344,\2571t\251&\005Z\244m\377\343"
+	.ascii	"\200\332\003E=\220W\235\371\275\2729-1x\317d:\005\215\341\252"
+	.ascii	"F\271\263C\364\377\374\377\003Al\234K\330\362\332\371\253\355"
+	.ascii	"\334\315\376Q\371\377<\202\342Wf\021\265\007y\221\367|\301"
+	.string	"\367\272\201\236\1773\247\236\366\311\333\021H^\273\233\351{\312\277\361\350\343W\276\320\246\361\335\302fy\024\277\220\001\0175\3737n.W\370\363\307\357\217l.e\2741\254|c\330\b|$l\374\217\227\3007z4\372\013m._(\274<z\344\033\037z\024\322\"\341\345;\007/\201/\364\270|\221\315\345Q\020g\221@9\3744\257\370\362E>WR,-Z|0r\207D\022?W8\242_P\250\032\272 ^QI\t\255\206.q\006\026\024\225\213\004\305\252)\030\"\252\210C+\254\251\241\026->\030\r\231Hr\205E\341\211\"\260\251\206XB\242\260\252m\fQ\023\2424\320\020j\r\033*l\250\300\266\206\r\301\340\206\250`\333Q\301\236\333/\240\210WVVWT\n\212RE\253)!\226[,r\2113\256\250\202\210C\253\036\215)\253\236+\205!\312jF\261\347JY\270\340\022\207BB\030C"
+	.string	"B)w\312EA\324K}\025C\210\005\345^]aA\r\271R\032\204\\\242\220\nK\030C\310\225\212\n\272\304\341\214\266\203A\020L*J\214h\251(\024\335)\267(\345\276\250\032\302p\001E\345\002\2128\234\262\202\242\302*BQ8\020C\350\026W%9\311\217\212W\232\272\274\346\305\310\246\023\251\217\263\\f\304\354\262e\016\022\177\313th\266\262\216\220\335\2355\221\032y{rZ\220E\362\032?\211\272\272\316\340\274\306\361\020\034\331Z\217!Y\256\326U\366\314+\f\347\262\356!\237\254\f\232+\331\323\305\331\354\\V\324\f\203\246\3455\013\031\202s \t\323+k3\263\231\231L\t\356\325\221\341\342\201\367\237fM5\217u&\363\311q\261C\226\327\034\226\305|o\030\330\0371 "
+	.string	"\300\222\323&y"
+	.string	"\226"
+	.ascii	"\311B\315k\006\363\267^\027\234\037'\333\212\345\t\223\210\327"
+	.ascii	"r\231\277\342\357b\321G\314\251\375\022\200\344\250\201,\206"
+	.ascii	"\020D\212\314\210\210\bI\222\244\003p\002\221!\253\342\006\021"
+	.ascii	"`\261\223D\210$IA\n\355\006\363\320\031y\217\257 &\317\365\210"
+	.ascii	"\363|q\\\220\036\342S\334i\266\016z\306\220[\316n\214L\271\002"
+	.ascii	"\370\375[( \361^\216\223\235M \276\013\273\246\006\252T8U]\\"
+	.ascii	"\261$\307\306\213\347p \217\007F\"\332\0310q\020*\021b\210\236"
+	.ascii	"\341\024\262\221\251\310cAN\210\204\343\350\241\034\336HRKEG"
+	.ascii	"h\223v&b\027\263c\342}\321\266\fP\0367K\230\t\275B\327\237"
+	.string	"\247\315\346\254E\0209\315\262t\2361\307B\274R\310(\330\340\200\\\032\002l\213_,?-f\273\rV\372\216\001\316\234\034\232\313\210D\233\225\375\005\364\204R\016\354,'\003\024scs%xrq&f\333\210\024\350\255\027){\317>\316\240\324\3047fX\0265\237\273R\004\251\331pm6\277d\267\323\334\242\210\353\306\f\221\342R4?\220\001\373Np$\353(\2472\236\211@WK05\253wh)c\233*y.\277\210\037\350\314\323y\252\t4\327\362\005\344\\\373\372\276\214\001\221\025C\204\337*0\356r+J\212\265#\362M\001\204\364X\241\347\377\266\232l@\025r}N\004K\214\211D\265n 8\202XY\240\352)U\300'8\216\001\252\307+\321\231^\020\312#\372Utp\030\227\325|\360\211\261n(\\Gd\270\355U=\026\353\307\242& \362H\3010:\207\205G\332(\210\275\373\211"
+	.ascii	"\206\371\357|\202/a45\317\004\377\207\022\236\034\242\034P\301"
+	.ascii	"\323\034\236\373f;:@F}\274]\236\006\177\013{\f\355ev:0Dn\352"
+	.ascii	"K\333\025\230m#\203'=\302\324^"
+	.ascii	"\203\251"
+	.text
+	.section	.gnu.lto_.symtab.32b1021b594d3732,"e",@progbits
+	.string	"flightStatsReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"flightStatsAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"flightStatsGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"streamStatsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"streamStatsAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.32b1021b594d3732,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
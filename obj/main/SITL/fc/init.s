@@ -0,0 +1,1756 @@
+	.file	"init.c"
+	.section	.gnu.lto_.profile.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375 \201\265\002"
+	.string	"$\004u"
+	.string	"\004"
+	.string	"\233\364\343\336\006"
+	.string	"\001\250\322\311\365\017"
+	.string	"\003\224\377\211\241\004,\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002\006\002"
+	.string	"\002\007\002"
+	.string	"\002\b\002\t\002\n"
+	.string	"\002\002"
+	.string	"\005\352\263\360\321\b"
+	.string	"\007"
+	.string	"I\365"
+	.ascii	"Z\201\267\006\245\177%3r\005o\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375 \225]\001"
+	.string	"x\211"
+	.string	"\003"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"`\344\b\004\340\036\310\f\024\262\023\201\243\352\3554\006\313"
+	.ascii	"T\206\345.\334@\033"
+	.text
+	.section	.gnu.lto_.inline.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375`=\001\025\006"
+	.string	"\262\205\023\037\240'\351\320\377\327\376\204\032\353Z\324\301\362\301\211\177\007\030\324\270*8ZkN\267\326\266\334)\377#c\020\265\324\372\243%.\307j)g"
+	.string	"\036\212(\b\370\026`C\301H\230\341;\361\037=\\\3303\371A[\302\363\315a\333\336\337l\0021 @\002b\034S\017Bzp\302[\200%\320\200\201\021\013sz\343Y\202RD&\034Z\n\260\325`\240\006\266\224\265\020f;Tu\004\257"
+	.ascii	"\"\001P\r,\224\260]\370\b\360\231\302\270)P\310\232\202\003\243"
+	.ascii	"\036<\201k\200^A7FD\004Z\t\212-fJ\001\371v\016\221\t\310\004"
+	.ascii	"D\030X\016@\313lr\2029\362\030o\f\366r\036\243pn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375`\345\001\335\t"
+	.string	"\262\f*/`M\222\01609\204\366"
+	.string	"\201\266\\\336\200\021\004\013\200:\216\0370\230#\313\227\204W\210K`\250\316B\221B6\327\021*\3036v#D&\031t\230`\220p\034g\222\\\021\236\215\013\024\027y\223\240\260"
+	.ascii	"0K\216\240\212\222\264\205\261\033\256|=M9N\271\376\364d\362"
+	.ascii	"4\205<@D\034f\240\245`\032\007\203T\360\016Z\\t\216\035\201?"
+	.ascii	"\336\343\016UU*c\264\326\242\210\020\264HV\366\237\366\264-W"
+	.ascii	"\225Q\231\rn\327\254\231#\327\256\266\332\031\327\262/\367\227"
+	.ascii	"\353\304tI|I3\240\252$'\251xd7\001K\250\021Y\213djk\327\016\260"
+	.ascii	"\002\t\314\212\036\021\300LJ\022\331\002\325\254\031\030\320"
+	.ascii	"\375\323\307U\bxX\341\37496\354\n\241yf\255\320l%\345\261-\252"
+	.ascii	"\023\365\273\370l~\302\317\344\307j\341M\202\232\351\372p\251"
+	.ascii	"\373\240\032 i\207&\312\217\367d\315\202\310\271\276U&\270\360"
+	.ascii	"\251\274\374\007s`\243p\177\375\351k\314\351{L\233q2\245\224"
+	.ascii	"o\373\310@\034\254\367oq\334f\336Y\020DL\2534\351\276\3563\250"
+	.ascii	"\220\343\201\370!\\v8\003"
+	.text
+	.section	.gnu.lto_.pureconst.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\200\004\001\230\004\003\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375 \030m"
+	.string	""
+	.string	"(\f"
+	.string	"\001\001"
+	.string	"\002"
+	.ascii	"\240\214\r`\001"
+	.text
+	.section	.gnu.lto_.lto.134942ef85ef6987,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.165.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375 \273\355\004"
+	.string	"\222\210 )\200k:@\344d\0222\005)\240\266V\005\001\333\265"
+	.string	"\370\277\275\331\241a\017\377H&\261\302\212\250\036\017\260\341[$wJ\001\236\244+RQ'\205R\021\261\320\311r\250Dp\305HXzU\225\245Q\267O\256\360H\210\335e0)\366\001\233\234\r\033\231\317\243\233]I\b\264\234\200\346b\373\2211\273\363\316\262\367>\021\357\333]\315\312\261C\314?\346\003m\313\016\005\207\3355\324\266\311\2357\330\216\001\t"
+	.ascii	"3\003\316\231!\340\313]\303\323B\030/C\200K7fk\273N\013"
+	.text
+	.section	.gnu.lto_sdCardAndFSInit.167.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\355\007"
+	.string	"\"\01777@o\323\001`\241H\220 \312O\377\017\031\355\223\013\304\037\260z1\022\303\025\324\br\216\205\3552\212O3\203@\361\033\007]\257\261Z\306R\227&\321zkm\357\224\002v\2506\231\306\332h\264\3013`\253\372\\\235\213Z\f\264si8\324\3124Ze\214y\0262\372\301\260\214R\241wig(\301B\364\346\347"
+	.string	"is\260\f\270+)\337\354\214\221\357\370\307Vp2\032\021\355z\257\276\307C\315\327\370\344\207M\276~\362\267\313'\033\"B\276Z\222\214\342\304\354\354\360\223\363\302\276\2643dK\002 \223\003\225\335\212\221e\305\251d\303\366-q\221\025F\352\2249\033\345a\306^\244\205\"d\264\273tb\234\273\344\374s\034\240\202\335%\006aw-+\b\272\347m\023\3306\260\r\022\013"
+	.ascii	"\313io&\364\361\003\343\230{\303+{\\\023/Cd\242\242\275\\\001"
+	.ascii	".\335\242\235O"
+	.text
+	.section	.gnu.lto_init.168.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375`\022\022\255X"
+	.ascii	"\312\217( Q0Vj\215\001\203\tLz\334\337\224\031\n\330\355}\327"
+	.ascii	"\235o\251\024\262n\255\035\222V\336\327=\006\330\244|lc\334V"
+	.ascii	"\355\226R\r\"\247\025.\t\254\322\356u\314\371\365\323`\275\345"
+	.ascii	"_\2165\036\022\324\260\334\017\226\376P\322\203\270B\322D\222"
+	.ascii	"\224R\n\343\001\317\001\364\001\354{g\325\347\334S\235y=\347"
+	.ascii	"\335;\247\2523\252:\353T\347\3579\373;7\216NB\354\250ed\307{"
+	.ascii	"a\272=\346\222p_t\312WK\351\036\353n\322\355\244u\314\275\306"
+	.ascii	">n\037:J\333R\230\rI\310t\255ve\312\327\275\200\327(\222\356"
+	.ascii	"\251\317\030%\013s\024\353\036\372\t\263\217W\260B\013\303+0"
+	.ascii	"\373\032\345\250>\343f[r\324\262\321g\254f\2359\271\205>\343"
+	.ascii	"\177\243b\346(\266k\262.k3\366q\002\013\264\355\004\007\022\220"
+	.ascii	"\351\366H\300\210\027\002\036\263yh\273I\016$)\246[\334\225\351"
+	.ascii	"P\200\327h\216s\213\365\262\355\261U\347\032\231\256\017_p\331"
+	.ascii	"\024s\272.SE\243\234\202\327(3\333'm\224\327<i\243\3342\217i"
+	.ascii	"&\227\333j0\f\315\234\256\353*}\r\254\266\216\331\234\343m\037"
+	.ascii	"\031\025\021\225\030\022\n\002\372\361\351\341\331\321\311\301"
+	.ascii	"\271\261\251\361\251=\336.Eu\357-\367\216\305\t$Z\231\227\036"
+	.ascii	"\254\200}D\326F:\005\246\234Z\335V$\323\325\244\031n\031\363"
+	.ascii	"\242\035\013\242e\227\020\303\241\270\203\017-\231\270\220\262"
+	.ascii	"\203\224K\034\350\253\177\276np\237#\3353\245- \322C\232W\363"
+	.ascii	"\f)v\261\211!E/\3379b\203\353\350P#~@\353\266\242\021]\003@\274"
+	.ascii	"\224\275\206\364\034\032|p5\316\216\305Z\243D\224\257\330s\210"
+	.ascii	"\017\256\2769\266M[\361\270\3455Z\355\323\025\320\\C\3238\024"
+	.ascii	"\265t>=n \266\025\263\\\025\322=]\001\307!~t[Q\210\316\207\b"
+	.ascii	"\"a\332\254M\340P\f\342<\023C|\030{\327V4VY\r=\215"
+	.string	"\241Q\252)\327\to\254\246\374}VA\035\222\353\272m\326\316\303j\312}\307\302u]v\242\225\217f\244f\366\021\230\271\214\031\347Kd\\\310\276\t`\204Ky\220-\303\236a\341X\270\264\321\026\377\2001\212rL\312\347\330\347\017\306\222w\002\357=3\033\307\316\361\276\007l\271$:\256\rN\265\303\341\3370By\2169\340m\267U\351\356\231\333\035m\017\244\251\007r\372\273?`(\267\302\231\331\355U\312\334b\265@\274\211\351\367P]\271\317\246\360\201\254\2007\224F\323\"]\350ML\320\210\230\353J\231\3513mV\273\325\"\221\355\f-\221#4\257\260M\306!y6\321f\rqFzL\333\305s]!\003\334aZL{\304\202\264Q\364#P\262\345\270\034\323=\230&\036\321]\224\376\353\276\207?\202>\307\334]\332K\373\305\355\305-X\233\304\233\330&I\033\375' \007\347qi\224\362\271\024"
+	.string	"W\321\314mX\253\254\261\022\366\n\007\030\"\355\r\375$\253h\377\247\341\204\243\315W\322>\353\266v\311s]\252&\266d<*\f\004h\224\373\225 Kki\301\355\325(\273\260"
+	.ascii	"\3355\213I/\300\300\233\350\337Ud\240z \373\326j\340\241\373"
+	.ascii	"\244\225\356o&\032\364\333\220!\370\300\006\032\342\203\326\177"
+	.ascii	"\222q\244+>(\007\26720BO\263\201[A\0029s\007\037x\023W|/\327"
+	.ascii	"\230\317f\bC?^\021z\315u6I`b\302N\016o\2163/\375\274\211\354"
+	.ascii	"c\325|6\203\017df\006\375\223\314\235d\246\265\204\277\b\363"
+	.ascii	"\215%\027-\332I\363\212\036kN\321R\232Q\234\350&\315&Tg$\325"
+	.ascii	"\371Hu6R\235\213Tg\"\033\347\022\252\363\320;\013\275s\220\352"
+	.ascii	"\f\364\316?\357\354S\343\334\243:\363\250\316;\357\254\243:\347"
+	.ascii	"\250\3168=\347\233\236\263\215\352\\\243zi\243@\337S\032\025"
+	.ascii	"\"\013\315s\347'\307\375\371\232\2638\346\263)\324b$\342\307"
+	.ascii	"Z\304Sq\345\342$\267zQ\317\340\244<\233:\237\344\035\030\234"
+	.ascii	"\033\377`nT4\212\257B\361=\326:\327u\335\034\003\032\305\337"
+	.ascii	"x\027\262|\bz9;\006\253<\201^\335R\346U\314J\246\033\206\263"
+	.ascii	"3\315\347\377\032\223\"\324p>9\364Ns'+\034\252\2064\263\322\304"
+	.ascii	"\313\3262\353\231\025n\205[\237+\022NB\032\350\314\353\034\013"
+	.ascii	"\364\263\267\"\353\215\346c\254\016\024Yd\252K\314\227\354\324"
+	.ascii	"\220\325\241#\255bw\244\351Q\346\246\005g_\302^\205\261X@\330"
+	.ascii	" Y\354\226\226Wh\363I\366A\372|\247\271]\231A\b\"A$S\320a\206"
+	.ascii	"\367\030a\273\330o\360/\024\330#\354\327W\332h\317\017\205\251"
+	.ascii	"b\004\373\r\340\006\366\362x\227wQ\272\363<\316\265\363/\204"
+	.ascii	"tQ\032kN\360nVI\030\253Ls\273za\2707\263\245\335\3542ef\311X"
+	.ascii	"\036n\316\2504\237\315\251\007\036y{\301\367\311\236\027X\327"
+	.ascii	"0J\217;G\312:\236\211?\361U:@e:oCE\305}6M\360Vs$\373\004UK\006"
+	.ascii	"\263l\371\221ESc\237<I\241\260Q\314\272\002\266\327\331O\330"
+	.ascii	"\265\237?i\017\340\220<\233\036D\327E)\316\347x\f8\377\302\210"
+	.ascii	"Ei\004\301m\376\346\331\177\260l\336DF\300\257X.\314Ra\253\234"
+	.ascii	"\370\233\357\241\\\315\333\274\300\302j\361&\326|*\245\255\314"
+	.ascii	"\033|\240\372I\234/L\270z_\204}\316\260x\354\\<\016\325\325\230"
+	.ascii	"\264\305\233\370*]\267]\251\357a\224}\021z\032\"\234G\333U\304"
+	.ascii	"l\021\276\203\345\002\304\325(\f\276g\301\310\246\034\343yq\""
+	.ascii	"\373\026\300\013\256\203\375\342\306\212q\361 \030\201\330\251"
+	.ascii	"\017c\205#\271\352wZ\033\331+d6,#\351\306\023\f!\226\221\364"
+	.ascii	"\324\344\324DC\t\005\032?,#\251\206\023\223\nN(4\315X\212\001"
+	.ascii	"\265\364\004C)\n\352)\312\211)*\005\313H\232\261\324\004\305"
+	.ascii	"\024\245\024\005\305\304B\023T\f\"\316\300\203\013:@\233:*\212"
+	.ascii	"\351\367\263\321A\214%&(\037S\324\f\033\0340\315\210\321\324"
+	.ascii	"\253\001\365\304\001\216\245\0314\242\232(\210\021\365t\303\277"
+	.ascii	"\244\032MNMJ\277\023\224\234\232\226TP\372AE)%\371\360\023\r"
+	.ascii	"&(\245\032OOPJ>\246T\177\021\346\311!_\251\0172\322\363p\273"
+	.ascii	"(=z\244\257:\372\027H4e\217\037k<\301u.\373\343\025Z\311\275"
+	.string	"W\277\034h\336 \026\013\314a\006\b\226\327\331\f\362C\273\342>\215\236\273\313\003y]\224\026\275\221\\\373\265f\265I\212\376\3051\313\323\270\365\243\"\203\263\323\220;\262\242\263\371\265\022Y\223Z^\341\321'\275\374\213\315lF\326.\270*=%Y\236F(\221\237q3D_\302\326\231\347\330z\004\216\354\r\026}\222\333\257\264\331~\005\300\345\272.\031&[b\234f\244|N\2052\324A\364I.\2605I\032\034\030\252\225\004Yb\rKK<T\031\030%\356\266\206}q0\253r\207u\271L\033-\361,luy\016}\222}\210\314\273lq.+\017e\253\231Y\332\350\320\357\254\306 9.\205\320\320`\005\t\361\204~\007Vt\002\251\375\312Ty\203?A\035\3645h[H\236M\241\017\222\260,\303(;\334kz4\304\342\301\263\364)Z\210\247x\346\025\312\032eJ\353\244\035\361|\205?4\263"
+	.ascii	"z\\\017\0207\312if\373a]\372"
+	.string	"\243!\226\353l\235\316\025\235M\240\307\361.\b\247\023\0367\362\230\336\342\364 \270\277\360\030\336\324\223\245\211-q \230\213\330Q\313u\201}t\242K@\032\031-\257\320\345\230y\245\342S\332.\236\024_[\253\\Y\261`\t\201\214\250q4F\221B4\"\"\"\222$I\206\003A\005\304 \006!\264\033\021 1d\214\321H\222\024\226\003\212o\212\350\370\300O\017\031a\025\340\n)\350\252\322\357\361\257J\222\207\216\315\027\265\307\335\2501p\036\240C\246\352\212>~\364j\373K\303\002\016F\356\336O\221,\t7+*\324\310!\023\225\375\332Ll\005\003}\372~\223\216\307S\022k\346II\3024L\313\330\332@\210h;\320\334e\314rF\013\032\211\335\235\031.\321\206\321/\305\367\032>P[7hd\224\327X\3215\273L\251OT\341\202\b\370\"\013<\201\020\253T\305\321\377>\013"
+	.string	"+\\\345\362\310\360\366\036\217\376}_{a\260\217|\266\267\031\212\370\371\3510\315+\204j\254\0342+\324E\034g\316\321K\247\263\324\027\001 IO\335\334\222\205\3466\207\374\357\376\255\2700\f.\"\307h"
+	.ascii	"7\275&{\232`0\331$e\177G\323\312I\3111\t\032gj\225d\252\214\035"
+	.ascii	"\216OAn\312\242\303r$\224GZ5\336\250\312\351\366\303\370E{\361"
+	.ascii	"\262M\304#v\301\220I\321\364\037+\033"
+	.string	"\325\213N\332hO\007\211\373e\376\310-\fw\023\355(\236\345\023\205\2151\324\270\274)y\033\b8I\210\021\231l\340\355}#\305\265'\362\27303\335\017#[\334\017\342\302\036\334\210p\322\206G\nd\034\330E\"\267\246/\255\242\354\365V\366myl\004\265\254\024\002Ie\224\001/I V\346#]\\\224\271\025\n\362Dj\227\262\305\320\276\341,^\274\231\227F\322\367)\350o\022\242+\224p\323K\212\252\261\033\035?xua+\265C\203\306\236\"\367\2427`SD\222\317\323wI@\271\210\365\b \001\206\225\342\335:\245\032\024\031\352KI\346\276\017V\0048\224\013\306\365\246\353\250P\271\352P\255\342\274w\301\227\030\022\213P\326\004\234.JC \350\016:\031S\342F7\360\211\277\032+\254\n\333\243l\340\336x\242\316v\203\350\3370\225\2741\34642\363\024\374\227\256\013\223\006\212\212\344V\261"
+	.string	"!\t -\031\205\373\246\214\2304\333~C\335\342Z1\003|\022iQI&)\261T.\272=\016\224\267a\225\203\310Y\235\356\244\021\312\346\305\301\243\303e\236\211\211\270\210'\302?\216\333H5\246{,D\311\372\004\023\237\\IO\275\307$S\231\207\324\353\200\363\272\276\244\302Qu\\\036\254\007a\251\002\271\341\222\245\274\262\336\t{\254\004\371#x\350\272\242\322JA`\363\312\311\220\233\244\224\350\254\236\377%\020\353P0\377\257"
+	.ascii	"5\004\035\361\023s\b\252\001\240*\256\224\232\341\276\274\030"
+	.ascii	"\221y\032\270\323i\"%G\2752\256^PTgQ\320\027g\345Px\"g\261\222"
+	.ascii	"\246\240\237H\311\222a\250\231{V\257\004!\212\311\002\335\251"
+	.ascii	"\336Y=\332s\270u\307\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375`\216\bM\026"
+	.string	"f\251\215G\200\226N:P\023\245\026L\3604\036i\200\3410\221:?\260,\035h\260\250h\313V\375'\330\256; \262(\207\201\275\274t|VJ8\340\200\003\016xp4yw\022\315\320\270\351k\354;%V\017\b\276\232i\244\035\202"
+	.string	"\177"
+	.string	"r"
+	.ascii	"k'Q\353'Pk(O\353(Nk\275\246\265\024\246\365\224\2455\025\245"
+	.ascii	"u\225\244\265\025\2445\337\321\332\315h\235\026\255gx9\266\254"
+	.ascii	"\325X\206hM\303C\336\023r\030\244\301\b\360\227\001\366\022t"
+	.ascii	"\227 \243Bs\001r\226\034k\371\261\030\242\261\034\335\343Wk\265"
+	.ascii	"\331\346\343\363\267\343+\277#825\004k\031Z@\327\370\365\254"
+	.ascii	"\315fX\214\255\325\272\265\336\215\031\300r\271\\\362\254c\314"
+	.ascii	"\324Zm\\\0046\266\326g(\3267\264\3268N\254s\230X\353(\261\336"
+	.ascii	"Ab\2156b\315C\304:-\304\332\007\210\265\332\207\365\232\2075"
+	.ascii	"\220\016\353 \034\326B6\254\207hXo\311\260&\202a\315va\335fa"
+	.ascii	"\375Va\rGa\0357a-'a=\027aM\007a]\367`m\347`]\244\301\332H\326"
+	.ascii	"\372\216\301\372\310\2025\022\005k\274\004\353$Xk%W\353%Vk&U"
+	.ascii	"\353<\252u\223\251\365\017\251K\177\321d\372\211M?\321\351'\232"
+	.ascii	"O\277\216)\374\207\251q\316\372Z@\375\3033\352\037\232R\277p"
+	.ascii	"\352\017\246T\177\320\254\372qn\254\376\033\364\352\007\246X"
+	.ascii	"?\360\374\201&\333\037 m\373kN#\365\346\372\252\333O\223\032"
+	.ascii	"\210g\366\242\276\3754\247\207ewd\025\375\235\302\375F\343~\237"
+	.ascii	"r\277\315\271?\005\335\237U\367\037\253\335\237\025\364\217\004"
+	.ascii	"\374\344:U\231\026\370\225\250\360W\236\303_i\346\374b\251\201"
+	.ascii	"_\f\325\371\305N\342\037v\340\017\333\371\301\212?\030j\233\264"
+	.ascii	"=2\306\377+\345\371\277\312\374#C\203\341\177\205\331\363{\241"
+	.ascii	"^\247\317\337\225v\241\307_E\352\232\2741\350\317\317\205r\001"
+	.ascii	"\375\\A\177\022\371'\205\376\3449\364o\235>\336\032\037\035\321"
+	.ascii	"\277U\364\033\215~\343\321o<\221~c\322_D\225\376\342\031\200"
+	.ascii	"\204\250\0210\b\307\352\024\224\323\032cp\203\246Ic\0210LM\f"
+	.ascii	"\021'b$\222\017\247\365W\344\337\321\356\027-\214r\350}\325\354"
+	.ascii	"F\203\335\302\311@\375\327*/\347\255}JJ\200[\274\306\230\306"
+	.ascii	"\312\244&\306h\t\275}\337dS\034d\315\2540\266\250\366\0249\271"
+	.ascii	"\251\242\230p\0353A\223$\246aH\223$\246aH\223$\246aH\223$\301"
+	.ascii	"\377#\244\373\243\331\330\n\2609y0\363`\363\3417C\257zx\330\352"
+	.ascii	"qc&\200\346\"\363\372\325"
+	.text
+	.section	.gnu.lto_.refs.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375 \213m\003"
+	.string	"\262H\032%\2407\303\032\336\037?Z\204\204"
+	.string	""
+	.string	"\034UU\325\265\205}g\376j\243qN\370\336\335Kz\223\335\326d7)S\217\270\032\342\3760\325\016\323\033\2323H\365\202]AzBt\204\2075\200l\201\303\0224\036\270*p\007<\026\340\352\345\2668\266\342La,q\2164C\026vRT\2119\272\n\335\017c\211\3112\253\372A"
+	.text
+	.section	.gnu.lto_.decls.134942ef85ef6987,"e",@progbits
+	.string	"(\265/\375`'`\225\224\001\272\233*\223V \fi+\215\001\\?=I]\254\313/\336W!H\333\""
+	.string	"&\200\001\305;\374n>\306\245~\375\370\2072/\352\031{{\022H\301|\214\266\021l\223"
+	.ascii	"\331\355V\242\231\315\371+\247\244\310\356L\247/\2355E\362\026"
+	.ascii	"\0138C\201\317.\245>\206\334{K)e\n(\b/\t\312\tK\316\252\314\025"
+	.ascii	"=\234\3016p\030&f)A\nM\021\257h\221\007\257\300VUgS\350\360\364"
+	.ascii	"\030n\341\027_t)\256\274\324\t\273nj\252\240\3413\227\313\365"
+	.ascii	"\202\211C\022\314\342\212\367\216\017\264/c\256\333msVt\303g"
+	.ascii	"\356\333mA\b\212h\357\034`\206{\357\342\315\003F%\215\225b\224"
+	.ascii	"*\253 c\206\267.\252F\261h\347\307ES\0233\274i\377u\273qX\360"
+	.ascii	"\226\013;\305\353\346\346\t^\201\261R\024\275\240`a\250FU\206"
+	.ascii	"k\350v\321\\)\016\245\304\f\317\340!l\305[\207\317`(\033\305"
+	.ascii	"[\304g\356\234$\305\275\211\344\222.DnX\255\254\207\366\210\264"
+	.ascii	"'\254\021\371\0134\364/\260\320'\302\243O\324F\237(\214\376\361"
+	.ascii	"\215\343\260\037\323\30050\020\333\325\263\005f\013\226\233\177"
+	.ascii	"\340<*\2604\271\371D\\\364\177\f\206y\340\036x\207%\303>p\216"
+	.ascii	"\337/\036E5\354\003\353 \353Q\364\262fBPD[\n\016l\210}`\034P"
+	.ascii	"o\020@\004\316\327\234\271\275\211#\030\027\0348\237|\242$\372"
+	.ascii	"DC\364\211\206\372Da\372D?4\356\362p|#\343\230s5\344\346\314"
+	.ascii	"C\333\242=\"3\260F\344\211^\350\017\345\321\037\202\243?\004"
+	.ascii	"\247?\264E\177hL\177(L\177\310\205\326\300\032\221\0372\241/"
+	.ascii	"\324F_\b\214\276\220\024}!1}\241\035\372B/\364\203\360\350\003"
+	.ascii	"X#\362Ap\364\203\314\350\007i\321\017j\242\037\004\246\037\324"
+	.ascii	"B?HJ\037hN\037\310\214>\320\027}\2403}\2425\"\0174D\037\350K"
+	.ascii	"\037HK\377\247N\377GN\377gM\377gL\377g\250\377\363B\377\307\204"
+	.ascii	"\276\217\234\276O\030}\2373}\037#\372Y\254\021y\237.}\237\025"
+	.ascii	"\372=u\364{\330\364{\312\364{\206\350\367\264\320\357\331\372"
+	.ascii	"Z\215\276\376\242\257f\217\310\333\302\255Y\032\204\205(7_(\017"
+	.ascii	"\277pY\274\234\270s\363\265\026}mD^\213\351\353\034\372\256\335"
+	.ascii	"0\226\f\351\262\r\3317)\0263n\276\256\241S\260-\022\371:\213"
+	.ascii	"D^\237\320/\331\350\227-\350\377v\371\365\362\337-7\r\250\207"
+	.ascii	"\213\026cn\266K<\374v\031\202C\223\023v\363K5\3753{D\366T\321"
+	.ascii	"/\215\350\027\255\021\3712L\277\264\241_Z\351\223v\364I4\372"
+	.ascii	"\344\232\266\333\032I!\262Q\003\005u\363?0\001\033\252)\361a"
+	.ascii	"%\311=\201\211Y4\n\263\037\327\310%\336#9\202\024\353\220\204"
+	.ascii	"\211\335\023BQD{\312\004\220!\331\035\273Pn\3315\273On\024Kv"
+	.ascii	"\211\267\311\257\023\033\345\227\215x\227l\240K\216NlobY\326"
+	.ascii	"f\205\026\242,d\215\310\223?\364I\032\372\244\225>)\245?\272"
+	.ascii	"\321\037\341\364G/\372c\024}\267[d\370\223\305\314\03317\337"
+	.ascii	"\252Q\335\023B\343\336]L\242\350\212{\023\311\f\357\266#\344"
+	.ascii	"\016\271A.\221\013\344\206Y\262;\274=~}\334\037\277\304\275\247"
+	.ascii	"\254\240\250S\334\233\250\342\256\270\303[u\301\254\033\217\314"
+	.ascii	"\326\246\270\367\266"
+	.string	"d\2067\305=a\335xH\200\211\233\342\336\304\236\264\255\";\204\262u\263G\344\006kD~\024\323<\220\204\340X\351\212r\363\307\035\372\037~K\306\n\215\032\f6\026q\303\032\367\352n\t\341\275q\214\031\256q\205aa\315\313\2136KfF\232[\343\272\020S\274]w\307\315qq\\\033\367\306\325q\277\256\327\245a\311n\215+\343W\305]\361\373\341\367\360[\343\306\270'\204\242\210\033\253\254\202\225&\313\334\336\304\016\035:\224P\304\f\235\f\371\271\216~\216\323\317a\3643\025\375,\246\237\301\364\263\f\375\234B\3777\353w\353\266\030\301\326\240\271\246\252^\334|\265\362\213\266\034a7?C\351\213\345\3417+\203+]\264\334\\\322\351c8}\234\246\217\321\264\305\262Gd\2215\"\217\305\364\361\017}\334\245\257\324\235\262d\004\270&~\241,\333\307(\342&\356M\034\272>\360L!\273\371\030\206\276%"
+	.string	"\211\353\352,\001\310\343*}\361\350g\311C"
+	.ascii	"=\225V\205\311\315\277\305c\007H\f\0258Mn\276e+Z3L\034\226R\276"
+	.ascii	"|\024\357X:[\307\222Y;\226\316\355\234]K\300\033\033G\b\212\270"
+	.ascii	"\257\310\257\0360\266\346>\330\261s6\206\003\203\261%\2667\261"
+	.ascii	"\003R\207\016\343\027\034P\304t\306\326\210\374\345\242\177\251"
+	.ascii	"h\033\347Z9+\3476\216\205s\020\022p\240)\033'\333\r\204\254\335"
+	.ascii	"`\354\002$\212\214\314\277e\372w\250\177\271\364o\335\3308{G"
+	.ascii	"n\212\223\233\377a\314\032+]\350\324\300\314y\371Rg-\214\033"
+	.ascii	"\266\2666\277-c\315\3303\026\316\262\261j\354\032\233\306\242"
+	.ascii	"\261-\3306\226\314\306Y\267[2\366\355\226x{6\345N\024)x\206N"
+	.ascii	"\236X3!\274w\215<\303\275\211O\300\357\341\007!\0016\316\212"
+	.ascii	"\261f\326\215\353\001J\330\024\367&\336R\371=\304\331+\226\313"
+	.ascii	"\006\251\275\243bd\320B\331\025\230\271\275w\007\244\016\035"
+	.ascii	":t"
+	.string	"\350\360\023%\004\n\017R\266\333\036\221D\326\210\274-\243o\273\350[2}+\246\211xh$-\255\201=\"o\2474\007{D\336I\377\026\355\226\313o\253X+6m\004{O\355\2755\220TS^En\266Z\354\226\3334\233e\3334\004t\355\035e\323\206\356\354\0355d\355\006\326n\220\225|\005\241B\346\373\264\305\342\341\026\315\210\304\342\"\356\263\275\367\020\216\313\322\342\342\346\321\032\221\367\200>\200=\"IkD2\300\036\221\327\200~\234=\"\037\001\375\242=\"-\321B\261d\030\330\262\203\220\200c\250\261\315do\342PP\236$y\354\334|\005\350\333\261k\360\332\t8\222\276\305\200\264u\026\003\362W\177\316\036\221\277m\362\333%\226\t\006\230\252\252k\237\355M\2740D|a\205\343\346\023\355\021\251\255\021\211\264A\003\016\n\220\025\360c\001\344\004\\5\031\001\377\035\361\347\017\327\374q\316 \374\370"
+	.string	"\017\310\036~<B>\300\177%\360\343g\245%\023N\370\357\211\234\364\343\017\374\227E\376 \033\340\277i\262\007?\016\361_\026r\207\\"
+	.string	"\025\376\314!\023\340\307A\325\004y"
+	.string	"\266\356\350\277RY"
+	.string	"?\226\372\257\221\334A\325\177\313r"
+	.string	"2\0070\376\274A\326\340\30712"
+	.ascii	"~\273\301o?\260#\374\227.g\360[\017\177\306\340\277R\276\362"
+	.ascii	"\206\377s\377\235\223/\3701\217\377b\311\026\374\370\303\177"
+	.ascii	"\247r\005?\016\362_\266\214\2245\374x\310\343\376\234\341\277"
+	.ascii	"c\376\227\345\243\037\033\311\030~l\345\317F;\027\375\030\r\230"
+	.ascii	"/|\t\323v{\277\315\363c\033\3777\374O\341\317D\177\016\372\363"
+	.ascii	"\317\237\365\237\307\377r\277\035\377\374'\371\307\266\377\236"
+	.ascii	"\201\373\361\320\177M\200\337\310\374\330\355?\377\b\346\366"
+	.ascii	"\037\265\374\270\355\307a~\f\346\307_~\334\345\307i?\326\362"
+	.ascii	"c\264\037_\371\361\221\037\017\371\361\360\307`?\306\361c\032"
+	.ascii	"?\226\361c\256\037_\375\330\352\307'~<\365\343\024\374\370\004"
+	.ascii	"?~\372\261\372\343\022\3748\370\343\337\217\317"
+	.ascii	"\037\363~\034\202\037\203\340\307(\3748\003?6\341\307\026\370"
+	.ascii	"\361\322\217K\3701\005~\f\201\037+\340\307\b\370\361\001~\234"
+	.ascii	"\364c\003\374\270\303\217\007\360c\016~\254\301\2173\370\361"
+	.ascii	"\206\037[\360c\244\037g\370q\321\217\211~\334\363\343\362\307"
+	.ascii	"\343\217\355\177\361\374\327\316\177\351\374W\356\277o\376\333"
+	.ascii	"\346\277k\376\033\367_\270\377\246\340\277o\377u\373o\333\177"
+	.ascii	"\261\374\267\312\177\251\374\367\354\277f\3775\362\337!\377\025"
+	.ascii	"\362\337 \377\215\361\337\253\377\236\370\357\324\177\245\376"
+	.ascii	"\273\377{\202\377\226\370\357\371_\336\177O\370m\335oI\370\355"
+	.ascii	"\207\377x\376\337\371\337\346?\223\377\275\377a\376\347\272\272"
+	.ascii	"\272\272?\237\375\032\330\374#\204\bE\375\217rr\326\314\216\355"
+	.ascii	"+\037\024-\332\260\315\355\255\346A\306\343\306\f\330\315\307"
+	.ascii	"\300\212\376\350\306\216o\310\3067\326\fiC\275\351`\214T\232"
+	.ascii	"\265\271\215\245\346\001\220\031/F\234\334|\f\210\372\326\232"
+	.ascii	"\221m\332pqq\350\211\322&\355mI\2324\343\232\024\244\245Y\023"
+	.ascii	"\333\\\\\034\206\344\352\356\204-\351\322R\374\250&\350M\013"
+	.ascii	"\315\276\371\030\370\320\037\313\214f>\236!\033\317\214qz\357"
+	.ascii	"\rE\334WHc\276\322\254\315m\256\031\034\254\234W\332\230\034"
+	.ascii	"K6\306\275\r\320\3360\276\025\t\243r\36310\241\177\373\373\223"
+	.ascii	";\nk\357\2555\0227\226\024\020\371\333\333\321Z\016\177\220\305"
+	.ascii	"\226\203\377\031\277\004\n\366F\2016\334{\3338\232\bZ\224\214"
+	.ascii	"\233\377k\260\377\237\303\336Pv\357\215EU\346\005u\201\252,j"
+	.ascii	"S\231\271e]\240*\363\312\242\"\356\033\032v\031\216ME\354\202"
+	.ascii	"\312]P{o\250\273\211{\312+kOuA\t\251\210\033k\023\273\240\210"
+	.ascii	"\366T\026\021\0251\n\212\252\314+\313R\225ueQ\225ue]\330S\033"
+	.ascii	"jOE\335\320S]YTl]YDTeQYTS^Y\226\330\265-\2314\242\027\324\211"
+	.ascii	"]\026\025\264\367\256\"\016\241\200\366\216\302\332Po\327j{\025"
+	.ascii	"\255v\215m\335\222\020q \355\275\241\316\342\276\272z\210R\333"
+	.ascii	"\215\252H\227\357\304\336q\333\n\001P\026\212\270\367F\261\245"
+	.ascii	"\240\354\336'\210X{Ku\215\200k\357\275\273l\013(\260v\320\236"
+	.ascii	"\212\252\222\372\352\002:!\325\205b\027\271a\367\336;\213\252"
+	.ascii	"\354\253\313\203\226(e\303-E\204\262TU]{\270\343\274\260t\031"
+	.ascii	"\024\321\312\005\225\371\340\252\272yl\341\267X\254\027,mf:\336"
+	.ascii	"\336F7;\266\241~\340Rha\315\245\221\201\266v\3637\270\351\177"
+	.ascii	"$3\272\365\270\242\006\345\346q\314P\211\23207\177\203\026\375"
+	.ascii	"\217Yn\311\306,c\333\001\354\336X\310\326\312\250\0273\350nf"
+	.ascii	"\023\232A\346\211\327\315\337\360Dm\\\033\301X\2621\314\350\345"
+	.ascii	"v\013\226a\227\221\313\327\025Kf\f3~\031\271X7\256\275\263\020"
+	.ascii	"\220D\016n\013\310j\210\r4\235\277aK\177C\224\376\005t\372\037"
+	.ascii	"\323>r\371G-\266\356\266\030\301\320\020\030]Tn\276[<|L\373\231"
+	.ascii	"\332\242\022v\363/\200\243}\254\021\371\013\302\214Xl\231\024"
+	.ascii	"0;7\377\202\262\361\312w\320O\216,gQ7[*dv\316\250\334\222\215"
+	.ascii	"T\306\263;\266\241~\320\334\322d\231\373\241\341\002\006\212"
+	.ascii	"\233\177\201\220)gx\r\\\02237\217Rn\\\227\265/7\377\202/\375"
+	.ascii	"\217HF$\243Y\005\364\236\202CE\n\314\030\225\233\313\206\344"
+	.ascii	"\250\252\304\335\374\013\264\240\214\304q\314\222\215d\243\223"
+	.ascii	"&M\230<\031\231\b\365\354\355\365\204l\024\033\231\bM\301!Q\322"
+	.ascii	"A'\211\323\006E\347[\360\246o\201\026}\013\314\364\230dTb\311"
+	.ascii	"\336e\\\002\366\005\n\354\346[\320D\223\330{o\373.d\371.\344"
+	.ascii	"-\030\352[\020"
+	.string	"C\027\031\215\370P9\263\345\344\346[PU\204\250\327~p\325\020rK6\n\031\203\200\260{W1S\0014\226\246\016\225\233_A\035\375\217\303 KE\"\225\233\303~\240\240\344P\273\371\025\250\321\267Qf\214`#\220\321\307\330\303\222\215?\306\035?F\032x\306\037\267j\324\201\211Y,@v\307\311\370c\344\361D.\314\311\334\336D!\260;>\252|\362+\020\242_\301\227\316q\255\034\037B\362\334\374\n\264\364?\330HQT\033\275\356\325\335\302\304a\017\212\257\025\377\3705\336\030qX\262\321k\354\272\243\327XC\310\327\216-H\035F,\032e\304\350|$7}$4}\2441}\244 \372H4\364?f\221\215Yc\f$\275\317\330\316\306\254+US7\263p\206\335\250\330\366\315G\272z1\302\260d#\327\270u\2465\266\020\302{{1\341\032]l\251+v \327\310\221\221\"\3635\274\321\327"
+	.ascii	"\247[\334\026>ph\246\244\335|\rm\372\032\250\350\177\244\"\033"
+	.ascii	"\251\306+$\275\313\340<\311u\302\264\200\335\314\342\314\331"
+	.ascii	"\030\213\233\257!\211\376?VY\262\321jLa\211{\227\215V\243\212"
+	.ascii	"q\205\020\024qg\225;\306\350\362\314\355\275\221:\004\325\301"
+	.ascii	"\332Zr\036WX\263\2406\\\210@n\276\206\026\372\032\242\3643\254"
+	.ascii	"\031O\364rH\341r\3633\300\0211p!aq\363(\005W'G\230\233\237\001"
+	.ascii	"\213\036\243F\250q\017\215\031"
+	.string	"\303\363\346\346\\w\351\220\271\322\"\366h\261c\304\205\235[\262l'\343\251\200\336Sb\304\024\367\346\362 \310\016\213;k7\337\351\221\021g\215\223\233\237\341\211~\006\037\372\317tYN\2355q\314n\276][sEN\376\222\343\254\333\331\b\\\302\024\255\240\001\243\006\313p.\323\311p\362\234\\'\307\311r\371\215%\313r\262\233\347\3425\362\314\346\266\260n\\\017Pb\005\314m\263n\\\017\020\253\342%\215\3320\313\311m\320x\301\361\"\2667\261\224\273\003\327V\224\201\254\021\371\fS\372Gx\364\217\334\350\037\221\321?\302\242\177D\324?2R&\237\001z\323f\216\324\315?\342\241\377l\246\314H\266\246$\352\3462-\3446\242\375\345\354\346_#]|\260\201\371\262\321\226\275\220\365(\236q\371\261\246\306c\350\241-\177\371\002s\313p\231L\026\223\307\344\267\314f\311r[\016c%\267\345\265\035\005\305"
+	.ascii	"\"oi\206s?f\276\300\330 \312\307@G\037\203\033}\fq\372\030\332"
+	.ascii	"\3641\250\351c \323\307pD\037\003\016\375\347\264l\305\022\305"
+	.ascii	"\220l\311+\270X\310Q5\304aUD\333\221\301\300R\f\241\242~\024"
+	.ascii	"_\200\311\310X2\224\374$O\311c\331,;\311\304\034%_\311M\362\226"
+	.ascii	"L\226\253d*9K\326\222\3172Z^\222\3132\223\254$K\261d\331JF\362"
+	.ascii	",\226\223<\023\367\236\272g5n[\212\253\"\023\033\371\013C\301"
+	.ascii	"\322R\246\260(\346)*0\035\371Kh\212hO\201\251\360\220\255d\""
+	.ascii	"\371\b&f)A\312\234\232\013\260\031yj\212\215\"Z\330\031<g4\362"
+	.ascii	"\214\024\\\303\275w\236J\201\206\007\224\024\032\037\303-\032"
+	.ascii	"\305<e\"\243\300\304\241\226\222\242G1\257\260\222Y\344\026\230"
+	.ascii	"8$aJ\215b^\221\255d\030`1\324\202H\271SD\313Vr\217\f\004C\301"
+	.ascii	"\322TP\324e+y\230\202!oL\304\366&\"\275]!~\201\220\203\210\366"
+	.ascii	"\210\264j\326\210<\206(\375g#\317G\376,$\017\271'\202\236\260"
+	.ascii	"\240\023\346\346\\\304\303\263\021:\"\226\332\315\f\250\243K"
+	.ascii	",{D\036\2165\"o\344F\337\250\214\276\321Z\376\241\275v0aq\363"
+	.ascii	"\215\320\262\217\347\261\256 \034\365\242\r\355\346\033M\341"
+	.ascii	"\361\fv\302v\225W-\260\270\272\031\004\017\317<H1.7\352\334|"
+	.ascii	"\2431}\243!\372F;\364\215h\350\334\225oX2\016\331\353=S\304]"
+	.ascii	"\2667q\250\307\214\034\215\263\233o\264\245o9\220Cuuuu\226\003"
+	.ascii	"y\243\023\372Et\364\213\320\350\314B\216a\311*\3102\340\360\220"
+	.ascii	"\312\272\371Ed4\n\366\266\025\220\266\256\316V@\276\bM\277\350"
+	.ascii	"\211~\321\021\375\"\035\372E-tn\361\347\252l\225\265~\342V\374"
+	.ascii	" r\363\237\257\236\265\376\214\225\263l\232\220\333\221#fn\266"
+	.ascii	"T\366\210\274`\215HK\306\303\363\225\017\226\342\222\253\233"
+	.ascii	"_\264Bc.{D~\260F\244\305\232\323\277\200F\377\202\027\375\347"
+	.ascii	"\023\317(~\334e\325n\333\b\366.\013r\245L\225\233\355\234\207"
+	.ascii	"\347\023\017\360\201C\311\315\277PE[b\022\375\013=\264\315\222"
+	.ascii	"w]\020\220\261\034R7\377\270\016\237\001\352\322\322\002\231"
+	.ascii	"\233\377A\005\213\"\336\3022\340\326\324a\0232\254\314P3D\323"
+	.ascii	"\222\346\214J\235\242\2206+m\262\250\301+\264\352\2660\327\227"
+	.ascii	"\033\274\305B\233!\223\251\031\305+l\320\304\260\025\353\244"
+	.ascii	"h\024\335\310\254\r\321\306\204q3\2436\227Eu\206e\315\255\303"
+	.ascii	"\233\007\336\202\353`/\230\016~\203\321\3409\230\016[\301T0\024"
+	.ascii	"<\006\0271\033\334\006\237\3415\270\005L\304Jp\024|\005\223\301"
+	.ascii	"lx\nv\202\305`0X\r\177\301e\360\021\334\206\325`,\370\r\217\341"
+	.ascii	"*X\013\226\202\3430\022L\206\335`8\370\016\016\203\231\340%\030"
+	.ascii	"\r\347\301f8\r\233\301k\270\tN\203\345`.\370\t\316\202\341p\034"
+	.ascii	",\207\3350\036l\007w\301e8\t\236\303"
+	.string	"b\226\f\237\301D\216\213`#u,V\024\353\344(\031^\2673hg0\346\206jt@\206nw\r\225\255\030l\320.\230\333f\242\255\030\345\215\023:bnl\246\324\341\0231\256T\024\355\031\234&\303\242\034\223\341-\023'`Dr\025+\035'x\220k\206\230\270\271\243f\007\211\347\326\210C7\247\203|Q\345\004\22589\246~`\314iA\203\303,H\023\027o_V9\264\264\224\361\032\255\370\304i2\004\307\r.\241\2524.\256\272J\031a\304-&\264\215\321\0161I\231\217\233\211\304\275\211C?YjL\331\242Q\342\340\372\"\346c\306H\207\024C\006\306\207\f0\333B\007\f\254\030d\221\241\270\256\034U,\214m/t\264\221i\256r(f\314\360\311\315D\240\253+\037]/\254\331\205k\253\222rQ\036\031\332U4\246\364\326\330\302\231(lSZ\224W\272\356h!\271\371\226Lk\221n&"
+	.string	"\247*\307\315WW\032\353EQ{K\355]\003L\203%_p[XeX\371\204F\21411VVc\234\335X{\313I\303\342p%)*T\350\025\030\315\027\022%b+\312\025@>X\2103F\f\005\nM\005\207\2033p\350\362P\221jk\336\276\360\270\371J`ZG\351(m\302\001)\242\352\212\332\204\236B\001f\366FOi)='\314\2347,\320\021K\"\346\346+\321\320\277\206\322\373KM\233\214\233\307\200\2501q\344\346'@\2155kR\314`\316f\203\024U\005\216,)\242\311c\231\224\211aE'\317\\\232;V\316\274\260\242\223g\256\234S\336)\343\224t\345\\\211\247\264S\326\225r\312<%\035KV\326!\223\034o\225p\216\244V\326)\343\316\212e\235\222M\371f\203\024\325\216\302\361\2008r\267\315\303\f+:y\346\326\314Y\321\3113g\311\224uJ36\216"
+	.string	"\270\254\350\344\231\333\233\230\322P\003\007)?I\216\276\273|S\026{N\340\360\212\022Bc1EW\272)\333\344)\3626\343\346'\221\321OZ\323O\352\242\237\224E?\251\212~R\024\375\244%\372I@\364\223r\350'\311\320\267de\013c\334\024\026x|\301\341\371\032\203\202\361Fb\tqa3\342us9fL\351f\261\260\366\346\332Po\"\340\343\r\216\227\271\315\265\305\301\215dA\027\245\312\352\346'\261hk\023Z\2719\202\"\216\211\326\315\377`\255\fS\206Y\255|`\215C\276DA\271\371\037\240\201\0013\306\371hY\251a;\203\004H\330\315\377"
+	.string	"\254\374R~a\241\205%\206{L\241[r\363?\250Qv)\273\220\315(\026iq\005\306\315\377"
+	.string	"*-\215t\303\265\344l\t\212\233o\2009\245\226R\213\030+3q\346\364\0336\025nn\276\001\314J\264\022\355(\206\025\334V\223!\235-7\337"
+	.ascii	"Vb/\235\210\225W\206\254\330\275\271\266\324\324\2561\243|c\365"
+	.ascii	"dmnSqq\360\271\022U\006\025\345\345\225\227V@H\300\273h\032<"
+	.ascii	"T,\271\271\254r\013&\027\205\352\346\227SJ*\177O\217\2205V\362"
+	.ascii	"\334|\017\330\350\362\354\203\377=\227\006\335\215;7\277\224"
+	.ascii	"\302\343\r\210\221\233\257YY6E\312\020\026n.\311\312\262\253"
+	.ascii	"\2506o\312\\\267dK\307\217\261\377=X"
+	.string	"\314\027\234\324\315\345\223\222h\311\036\246\204r\342\220\320\026\024S\302\334|\017\314\350\333\207!S`\037\206,\231\274l\362\367\3748\351r\002\356\346{ F\227J^.\371{\254\016\026no7\337\0030\372/\223\374=@o~\274\350q\363=\340\242\357\301YY\244,R\036\261_WZXB.R`\341R\032yy\344ZI\263\201\304\003&C\206\024m\251\n\222G\254D\213\243C\355\346{0\304\207\217rX\304JI\026\261\036$U\3508\t\362r\270FV\243M\030\0249F\266\204\001\361\261j\022\265\205\r\310\006\2334\257\362\307\350\205K\225\23387\277C]\251\243\324Q\202\r\261BRC\314\306\234\033%\217\227`hbN\276\334\\\356\260q\250X\261Q\206\366\277\347\202\t\250 l6l\2248,\021Q\n\016\3130\233Qks\345\353%\016\362\016\261\206\225W\036<Vg7\2277\206\212\\\341"
+	.string	"s\363;d\321e\227\235Cr\t\222\346$\n\r\032c\034\231\032\214\2559+\266\307\332\334\374\016B\312\030e\214R\006\371u\006c\213DB\303\213Z)\303\232\241\311\022kr\363;|\225YeV\311\245V\265c\355g\b[\f'%\214\227\\9\b\034%_7\227-\312\027\377{\032"
+	.string	"\006\027\243|Q\272P\262\205\345M\031w\006\307\235\255+\243\347j(c\356\346R\353\236\020\2421E\314E\207\027\345Uy%\002\253\2411qj\354\270\371\035P\224T%Ui5E\016\211\2229-,\"e\325K\253\241\027g\\\030)Wh\036P.\264\224+J\025V\264\304\302\312\234T\351\"\345\3462\305\350\244E\230\032\222\233_\2008\345\211\362D\321*\314\311\334\r9hV7\277"
+	.string	"MJ\250\022\252\234\232c\345\003\013\310\204\233:/\245\324\313)/W\266n.\243\306#s\344\024\301\336\305\205\226%m7\277"
+	.ascii	"Xuuc\034R\027\206\263\241\205\365Se\253\311\217\233\317\201\016"
+	.ascii	"\035:$\236\022^_s0\234\265\0348\356\234\304\323\003D\316\\\017"
+	.ascii	";?bbh\305\331\241\033\343\\\260\b\233#\353,\261i\362\345\346"
+	.ascii	"sH\243\3470\021\274\006DM\356\346sx\223#G\311\234\230\217U\226"
+	.ascii	"\222\025irrc\234%\"J\225\3411\034\241\206\264\240\346\354\315"
+	.ascii	"\2331\016I\357&f6\212n\262r\240 \322\246"
+	.string	"\r\351\306\216\355+\fi_aN\346\336\340\256\314\235t\323#\204\310W\325\315\347\320u\346g\3105vl_y\200\333\261ECM\231\271Psr\r\t\303\316\027\2154?rRHx\244AS\026\201\203\346G\216 \262\253:(\342\306.\270\2652g7\237C\2132e6\320\"\314I\217\2637!7\237C\224\0301$\234}QU7c\004\254+\270\267\223pBe\350\220Q#C\306\255y\305!\343F\346\007\025\231\316\242K\2626f\334\n\222\223cF\224\233O"
+	.string	"666\024T\331\031\252\2022\027\343\346\023\300F\227.\344\032]\214\236\025nne\300\234\\\033\272!\345\306\026R\rO\026)Uj_\362\217'Rp\260\310N\254\004\241\341eL1F\231\261"
+	.string	"u\363\0070\247E\013\231F\242j\016\235\020\2326bbl9\231\346\223\306\304\2243\024\377{\204\326\240d\265\360\005\r\215dR%wg\253\306\035\0257\177"
+	.string	"G\256\\!\271\252\344\260\206\342\\T\235\271\371\003\340\252R\305gX\345fN\324\025#T7_"
+	.string	"l\246Li\343\244LC%\352\353\346\013`L\212\224#Uj\230\314\301I\245qq\363\005\260\343\311\023r\203,Ui\266\346n\0359tZPN\232\221e?b\202\270i)#\033\322\261\343\r\306\230P\232\031\025[7\277\2038\232$\372\250q\023f\213\331\377\236\361k\316\032\264\233\337A\233\230\030\331\304\322\360zc\022\264\267@\231ar\262I\232\327\214\031K\350`\321\310Z\242\304\004r\330\260PB&)Ql\261!r\363;@\323\357@\312\221#c\034R\027\324\234\037\254*8.ssh\206=n~\007=\206\f!\213 uA\311!\267\252\336\224\314=\241{kB\344d\021\033G\216\231\233\223\233/'\177\375\357!\305\\\335\241\273\371\001\2703\034\226XUN\342\210\305\210\223\302JX\330\002\306\322\f\333l\3111q\363\003\360\344\307\017.UJ\346\212\242r\fo~"
+	.ascii	"\246x\360 {\330\261}\3653\254B2\344\022\211{\363\005\354d\217"
+	.ascii	"\f\266\306"
+	.string	"\205\032\033G\205VZ\215\233\317\001\027\0348H\035/\252\210\250\3010\203\001$\307I\035\270\255\007\221\262\233/\347\236\370\337\223\237\020\341\322q\3639\220\341\345U\304\245*H\036\022\f\2228]q\272\272H\266\25206!'X\332\250\241R\243\306\030g\213T\371\020\263s\332\316\266\215\0313F5G\306\027LjD\271\371\033d\305\210A\026\253v\254\t\321\250\203f\n\032..\021T\351\340\342\263\303\t\230}\266\265E\276\260c\373\352\303\027\035\234\361\210\226\0263\027'_\330:2fl7_\3168\365\277\007\210\210\227\t\271\233\257\301\021-\255\264\312+\317\310\206N\026\335\315\327\300\305\212\257 \261\220\272\260\233\264\272\242\330\336\\\034\200t\24492\345\352$\326\t\246,9r\363\345\220,\376\367\364 Q\361\246\355\346\237dAZ\261P\262\003\355\016qo1S\\n\256\312n\210\033HN\316\214+7\037"
+	.string	"k\364\377\223)\310\024c\234\035\333WHF\340\362\304\230\333\233\213\003v\323B\02257\037"
+	.string	"I\364O\242 QX3\244.(8\032<I\243\2033\242\221\301\020r\363\001\300B\377\244\024)E\232\250@W\024\221\016\214\300I3\234\343r\325\246\306\315\344\024\225$0\324\334\374\f\360\350gpF\377c\335-\331XGBU\240kkyp\001\347\215\311\334\336\\\036\3302\270+\0337\223{\254\333\201\005w\3633\b\243\237\001\025<xp\035\322\330\326\032\372\252\322\302\322s\276\240\270\335\374\f\304\364?\326\271%\033\353\214v8t\355\026\035|\351\222\243\253\203\302+\311\315#]\t\344\212\227\342\315\317`\207~\006Y\372\037\345\220\215rF:da0\266\346\312\260"
+	.string	"\363v\3638\207LR\344K\311\315\317@J\037\203CK P\350\231O\032\350\001CX\002\201\302\231AH\350\347\276\244\020f\332\324\243\356\214\316_\b3\005\021\244:\"\230f\365\027\344e\017\250Aa\376\200\032\024f\037\340y\246<\365\367{\"\341T\237\202zgj\236?^9\"xB\032T\323'^\017\220\0220\350\344\024\344q\300\264\002\321TH\264\242\300%\364g\206\b\376JXQ\340R\006\226\200P \352\303{JW\024\316\364I\005\236\033z\346\231\372\334\227\024d\002\242;\036\223S\032d\002.9\005S\341y\356z\350\317\344"
+	.ascii	"\007T\024\303}Ij\023\020MWU\351\354=\375x@T)U\237\2244\374~O"
+	.ascii	"@`\020X\256\273s\005T%G\004S\337\032\004\226L\346\371\313g\372"
+	.ascii	"$\314B'\336\251\232<`\272\252?&d\340\004\020\024\240\300z\252"
+	.ascii	"g\332s_\322\232\232O\2733}ZS\363\211H)\210jP}~V\024\270\204a"
+	.ascii	"\005>\231\260\236M@)\b\241\t\254(\020-R\321\237\211\256(\020"
+	.ascii	"\355\005\327\247\020H8W\223\207\366\200\350PZ\242\004\022(\t"
+	.ascii	"=`\b\347j\366\320\237)\002iE\205\245\272\242\300%\036\317\024"
+	.ascii	"\362\311\300\231>a@\241\t\210\252\033HO\022\250\t*ZD\202\212"
+	.ascii	"\002\227z\356K\002\216\b\366v\302\247\335\357\367$\334\001Q\341"
+	.ascii	"\022pD\260\367\373=\201\020>\375~O \200\250\360(\210\256(p\t"
+	.ascii	"\350\276\244\323\t]K\230\277\2637\336\227\364\344\204\256(p\351"
+	.ascii	"\311\t-\357KZQ\340\222Pu*wB\325II\250:-\241 T\235\202\356KR:"
+	.ascii	"\231L\365\207\232L\251\022\211\324(%\357K\022\261[\323\240P)"
+	.ascii	"\210\256?\363iMQ\016dPw="
+	.string	"5X\336\227\244\n\233\224\202(\006aSy_\222RO]:\323\247\325<\231\210\356K\332`E\201Kk\320\212\002\227\200\356K\002\006Q\223\003\036\317\324p_R0-\321\024LK4a\270/)=\327\323)\230\236?^\t\021\200!\320\237)\302z\242\020L\315\020H\367%\371\334\227T\"=\327\325\f\361s_\222\223\311\333)\005Q\fV\024\270\304K\201V\024\270\264\252A\020A\024\370\271/i5W\265\247\027\302\252\304cZQ\340\222\252\202j\256=\033~\356K\342\001K\250\246R\020\035\300\212\002\321\235\312\264\232L\346\317\356tBW\340S\252\304cZ\315U\365Y\217V\"\020\027\326\243\265\350\276\244\246\247\020gO\251\367C\237B\234\275\240\t=?+\nD\363\212\002\227P \241\007\f\241\227\232\"\364\324\241\253\3003C\b\203\301\013\250\352\311\013\246\302\241\363\320\364\004\236M\372\bP\300\007\n`"
+	.ascii	"\211\322h]\357KJ\203\324\013$R qB\tD\317\335\232\006A\374L4="
+	.ascii	"\325\fE\353}I\246\222\232\006U\340\251v0\302,\341\243\022\375"
+	.ascii	"~\301\364\247T\3173m:G\360\361VT\b\004lB\177!\034\235\351\323"
+	.ascii	"\0175\231\202\212\326\373\222\324\013\326\324\\Qh\002\242<\f"
+	.ascii	"\202\326\373\222\234F\b\225\324\364\024\201\246=\r\324\337\023"
+	.ascii	"\210\364\\\201\247\b@%8S\246\242\240\210\364Tw\275\323)5\201"
+	.ascii	"O;4]/\254\367%\221j\320X\264\336\227D\"\030B\251IXAoi\005\236"
+	.ascii	"@\323)=\205?*\321\004\202(\020\025\036\255;\325\204\323\t]\365"
+	.ascii	"\271S\233\314\037\t#\230\030V\024\214\356KRj\022j\0202\235F8"
+	.ascii	"\325'\262\311L!\250\311La\345\235\277\023\005!\352\343\005\365"
+	.ascii	"\316\225w\256"
+	.string	"\347\b\275\324\344\025\231N\275 \323\251\347s\356\316^\320\204^j\362z*\320}I"
+	.ascii	" \021\f\241\002\317\374\205 \332\t\313\036\311\343\231\273^\032"
+	.ascii	"\344\235\251\317\331\013:e\025T\323i\247\242\275\235\332\373"
+	.ascii	"\235(\023\2063}Z\205&o\027LK4\0015\001\321^\220\007<w\247\bt"
+	.ascii	"\025\232=\363\302}I=5\250\324S\203G=5\370\243\006\205;\247sE"
+	.ascii	"\265\311\353\371\231=>\347nE\201O\273\236\032\364QW\024\3704"
+	.ascii	"\252\351\351\204\256\244\332\004D\201\251\331\001\020>\277_\360"
+	.ascii	"\004\022\246\t>\263g\335\201\360A\355\235\277\020&\360\f\342"
+	.ascii	"\251\247\2200\335\361\3243\250\\\201g\232>\361v<\365\274 t:\327"
+	.ascii	"\335\231\006yC\253\317\324$\316\036pI\r\016\005\321\236\231\356"
+	.ascii	"J\230\277\364\024\021,*K\254\350\317|*\301N\005 \372+r\n\321"
+	.ascii	"\333\241\252\232\n\t\203=\337nD\320\247\356\324\325Tw\252\260"
+	.ascii	"\251H\375\235@\240\351\023\201\227\372\234<T\3049\302\232\006"
+	.ascii	"A\2240"
+	.string	"\177B\025\355]pJ\315\237\271;y@sU\321\236\220\272\003Z\301\267\033a\226\020Z\301\267#Z\301\347\343\255A\340z_R\017\025\"\221`\325\035S\017\025\222 \354\222\035\301\366P!^\201h\020\204\360\251\007D;\240\341g\204\371\201'\024z\250P\b\210\232\260\206\320C\205D\247\210\3637\264\362N&&\2435=\205$\316\335\372C\327\0350\270\002\232\006}Hg/hB\211\025\025a\246%\240+\320\034J!\003\0205KH\203\253\231\236\030N\030a\226\270\360;y\274\020\316\325L\205zMD\275_\320\247\236hP\270\236*\322\351\204\256>%\314\337\331\373\301`\244\002O\241SP\204\036\nb5C\2100\002\006\321\025\355\245\346\2104HB\357<\231\216F\230%vC>+\370v \250\252)\034\021\374](\221\236\"\202\2743\335\t\t\035\255A\241SXb%B\177\232\200&\222\212\22205"
+	.ascii	"Q\263\351\202\352\264\353\231\247\317T!\030\374\355\322\023\210"
+	.ascii	"\232\351\272\013\246<\263\002 j6\021]H\203izj`b\n\256O\274\235"
+	.ascii	"\032\302,:\205%\326\035\b\351\271\376P\246\242\025|; \272\202"
+	.ascii	"\317)=\327\336\216I\370\333\001K\3640\234\275\240\t R\330\260"
+	.ascii	"\242N\350\005\316_\0230\004\r@\324,\341\302z\252\347\t\351\331"
+	.ascii	"\324\204\246)\214\b\376~!"
+	.string	"\210\340\343\001\237\314_\006\273S}*\"a\376\316t7\302,\261\353\235\253\2316\235+\020\305\260\002\232\232'\020\275\300\252>\245\276\325h\004\242f\223\317\311\003\232\"zf/h}\022\256O\301\035\271\002\237\202\274\335\357w\362v\273\340\372djX\201'\252\002\315tEZ\325`0\304\216\211I\237N&\006\204?N\302t\007D\235\200z\347)Tw+\360tZ\325'\022\364\314#\262\207\n\205N\325<S\036\020=\177=\364\202P\335\235\253\371\013\n\323s\005\242\253\231\356H\230N;&\246\013\273S\005T\250\356\230\230\204\356KR\177\301t\005\006y;^\252\304c\3320\302\007\242\021\301\237\220\257\t\365\r\365>\374\314t}:\201=\273\336\207\036\320\f\3213\317\236\321\210\340\357\307\327\204\372v\275\017+\352\204\376\200z\037z\247:\024\264\336\227\244\324$\314\220\236Nh\n\2753\203\210s\204s5O"
+	.string	"\"\002\006Q5=E"
+	.string	"\227\234F\200\270\3404\002D\357\344\001K\250\300\r\234\352\223\320\252\246O\0238\325\247\240\022\351z:\235\2773\205\013\353\256T\233\314\024\202(\371\013\362\202k0\005\261\246A\241\n4\323\02424\001\315\020+:\2015\350SG8\325\247!\021g\017\237O?\223\003\353\25121e\340\374\365\226~\346\2126\241\275\f@\324\351\347\374\255k0\365\255$L\247\237u\247"
+	.string	"\017+\020}\322=\240\351\344\024\344\001Q'\237\025\370\024\024\341\374\005A\b\335\227\244\264\372\232\320\237\005Ag/hBz\222@\235z~\301\340\004vc\357T\323S\304\231\356\324\021f\t\243\025x\362\322S\270K\203k\320i'D\177L>\325Ly\032\356K\322\360\240\360L\225\326`0U\372Qw\"8\235\253ZB\025\"q\366\200K=T8$\002]y\346\205\263\027t\3325=\2058{>*\017]Ut5Wu\247\202j\256C>\336\212\216@A\r\202P\300\371C\231\202)\210s5\323#\025x\301\037/=E\004wOB^\320\351\204\246p\362\314\264\204& \352\224\206"
+	.string	"\314@z\216\b\n3\244\246\217\227\323\023eBW\340\331[\352\245f0\304\320\n>\023N\325G\236\253\271\242"
+	.string	"\f\242\253\231>5\241L\300 \257h\3351`\005\242O\345=x\020A\203\r`\240\004\315KZQ \252\304cR\002\242\246\223\022/U\225\2220\234\253y\302\271\002\352\204\256\302\f\244\347\357\251w\372x\352\321\177\215\204\354q\177\300`c\343\210\216\261K\025(\036F\326 \341\201d\316\315D\0243\300\274 b\242)\006\220;C\310&V\253\016\r\f!\244\331T\027\227\254!\t\025\004\345\211\331\220 dZ\0201O\0225aW$\036\266\031&\200\220k\245\034\216!f?F5>x\302\304\370\030c\214_X"
+	.string	"b\326\203\204+\207\274y!\025\207\031\250\003\262drD\025B\224\223\f!d\206df8\351\023\026@@hD \221k\263\346z\023"
+	.ascii	"\303L\354\324y$\007\035C3\")HJ\222\2559\242\251\235\361\274\222"
+	.ascii	"\"\346E \247\301\303E\356\017\345\032\363\r\255\ry\374\241\022"
+	.ascii	"\202\341\240\264zK\200\224\214\220\3648\313\377e\306\002\007"
+	.ascii	"\314\217\375\341\305\201\233b\234\267\327a\362\262?\020K\204"
+	.ascii	"yh$\327\310:>\323\035\004\201\2367\325\204\261\213J90\200\226"
+	.ascii	"D\362[\017\357"
+	.string	"q\212\324\277\020\036E\212\b\3519\277\345v\305\322W\256fJ\006o`\024\201\020\201\377\211A\200q\3068\032\336fe\311&'FJ>BT=m\252\303\371,\255o@Y\222\037\177L\317)b\320>,\335\221\264\264\245\217\247\313{\241\255\320\323\357\201\240\257HHDbsy\317\321\363(o`\027 |\346\356\037\264\305\236{\214\375>\270\324a%\316\r6)\251\347{k\372\323*\013\347\021>\311:\272\215{\2460\r&\017zg;\262\356q\343\021\006\241I\2137\2023\363\370I\376\231:\220\364Wj\031\277\227a\266\333\030E\237\202>K\310,3\036b\030\235\341x\f3\201\315\213\030\f\216\246\331\257\311x\237\350\002\361\275'\263\310\033\225\362\354\377\322\212\022\276\240\025@\310\336\363\212\206\013\275\363\236\226A\256s\202\360\262QQ\207\236j\206#\316c+b^\233\340\375\277\032\fy\274\210o\257\034"
+	.string	"Q\244\236X\027\254d\204\357\207\t\013\002\356\254\321\337\352\252L\025\240\323N\314\331\231jY\b\210\231\306\266\306\0017x\230\017\251\245\204\242\335\356\340\237&\004s\2160:c\025\256\224\336x\227\332\240Tk\364\364h\377-t\302&\372V\271l7KH7>;\340:\251"
+	.string	"$\231\237\263\245\343\335"
+	.ascii	"\375\310\216\" f\202\230(\363\255\3457\200\002\033\214V)\350"
+	.ascii	"\372\214(\274\216w\254B\261\255o\306\200\265R\007\016\021]j9"
+	.ascii	"\252\247\273\"\244\204\360\357\311\324B\374<Oh\367\274\034]\355"
+	.ascii	"\352\240\354,\"\305\034\003\032F\032\353:H\307"
+	.string	"\342oP\347\222\354\204\260\220\260\r\211\251\317\223\001\336\261\027\337|\33590\224\316\023f?\334K\365"
+	.string	"M\325S\267\331nZ\274\030\311\002\337j\263T\255\245\312\\6c\177\337\231\"/<0j\320\207wg\330Y\235\315?\214\304t\374v\303\357\272Up^\234\225\230\242\3128p\217\352"
+	.string	"\301\357\334OX\341\250\271\246i\251\342\236g0\301_\234\245\276>/\362\247O;\013\342\264\244pj\243\331\022\177$\347\370\027B\207\354\3255\344\251\263\351\001P\202\344\260\f-\246\004E\3147\362B\231\207\024\357;r\206e\337#\017$\307Z\313\242\b\306\267<n\246\340\r5`\215u\223Bu\312\347\027\t\334Z0\022\020\004\002B$\247\246@\276M\326N\326\376\315\372Tm\313\267\232\0301\261\033\263 ~\215\202\214\375\027\1772<Zqt\274\362/\311\203\374K\214\035\300I\340-p\013\377\253\035\362W\303I\221=\016\rT.+\r0oH\325\346\303"
+	.string	"Cc T\323$\302Y\376\212_\037\023)3G[a\270\350x\376M\013\376<.\027\236\234]\345\032\201\243\n\271\274\253y\t6\210\337v\344\323\357i\314\240"
+	.string	"\021)\2422\026\"\212\307\257\f27\256\347\231\\e\254K\224\004\326:\275\036\224\017\256\bT\326V\024{\332jX)\3005\236\372\305\264\314l\325\257"
+	.string	"\325\026]\203O\034d\225\rCj\245\276\207\t\246\025\331\177\200\020\fY\272\013\302\3465\344b`\335\234\254~@\204\002\030\024/A\340\264\376V\030\2601^c4N\341\236\235\243a\204\020\226\350 =\357B\2360a\b\244\352\214\256Ns.So\\}\352\336\334G\272\227B\307j\260;\316\275pMy$\255\031?\214\017\333T\215\3060sU\b\270\323\201\262\356F\214\243@B\323\332U\020N\305N~\266\302a\341\233\335N\226mp\246Xx#\223\267\342j9\370\230\006Rn\314h\205\240\345\2526R\337\347\361\fPcR\324\240\304u;\333]vis'HZ\246\262 \327\207\301\323\373\205i\334\324\241]g\f\363\232\tc\272\235\216\367\021\022w\334z\305s"
+	.string	"b\265no:\237\026\231*`\227\3026\336\037<\\\0018\234\355\356\227\262@\251\363\032\372\263f\244\253\374\004\203\004\021,\350\353B\2004\271oMX\203\037\311D1\310\322l"
+	.string	"\272I\023\215@\024\004?\306sA9\265\\Q\207\204\250\030\277\007\240L_\212i\025\340\\\275{\347\263{\356\306\003\2664\304\320,i\205C\2768\202.#\316@\260\312\300\223\246\302&/\225\273\241\025\3665\222i\271\\ \377O\025\377]`\243\325Q(\361*p\320\234\036\230\004~\253#B(Z*\371pO'\216\356,Q\377u\335\221\324\301\223\340\276"
+	.string	"gu\37040\246"
+	.string	"\205\031\215d\247`\300f[(o\374c:\f\236\215\017\222\024\260\316\016\373\317\325L\244\244\200\315\2174*\353\265Q5\311@\245x\323/ \364\215\226\265\274/\330\003+D\303\364\036\024\\\\\200\311\252\301\277\221\021_@[\213\022\326\332S\256^d\214"
+	.string	"\223El1\260\321\271ovr\273\267\215\260\207f;\356\037;\016q*\252\372\354\f;\331\322R\371\355\020Z\363w\375\357\201\225\247=\374\022\336@\025`\325f\364E\325[0$;\227]\200g\004e\200\332F\312ir%\237qx\300\264\024q~k\2426\376\261\241m[\313g\274\f\352\227U\3252?\267\334>/P\247\356M\244\"w\314\231\231a@\037\213\356\f\347\307\215k\365\256}\027\177\360\247Wr\306zoz\354d\243\037\300s|\257+\335\243\030\351_8/Y\326c\365\327\334P\260\240\r\202JJS\321\026\307\030\005l\204coF\2671\037\004\021\273mkq\275\214\253l\006\304\001{\b\":\031\237?\236lr\0217y\341D-\310Y\224"
+	.string	"F\233\234\2658|\231*\316f[0\237\317\253\027c\332\256\032\336MBKV\255\270\203\210\312\303_\023\256XD\226j[ v\233\204^\264\242\352\223\205\354\300\276Uu\b\006\361L\316>\005\341\347\237\\\362\204\322\356\351\224\244Qf\tMG\274cU\207\023\\U\320\023U\005V\331@\325\264\024r\2515\n\215`\242\013\355\203\342\310\277\223\003K\270\340\340%J4\260&\"\2326\257$\2423\036\317\257A=\362ZV\025\231\240\3658\245\025\353\b\204Y\345\004\\\363\002N\323\037X\023\023\0221o7\273$\251\360\256s&\203\332*\353(\247\330\273e\226vT\233\034+.j\364\350\306gH!8\275%\353fv\202\322\355+48\265\271\320\224\fV\034X\024\027x\252\234\372\004\373\223t\227\310\315\034\227\377E\\A=\bJ\367q\333O,\227\346"
+	.string	"?|\204GK\200h\275Qj\r\0019\235z\n\333\024\007\273\215\024bn>\370InS!\364\256\304\371\326\227\372U\0344L\365\200\350\253\251\367\324v\253N\301\240\2016\025\\\313\211i\020\205Ry\200\232\215\354/\001\003\215\377$D\"U\016\264\277a\t\2107B\024x\021i&U\257\377K[\001[s\035\221\240\024\002\237fHr\272\0233\201X\345\2206\372\335\035\321\252\272@\024V\201\032\370\362W&\2756\033\231\250r\023\256\372\205\\\377\n1\324b\342D\221\221\234H\277\026;\004{v\353y\bG\226U\271l46\037\200\025 \235\343\247\265\344\250l\276"
+	.string	"\2077u\204^\033\227\317\2629^\025R\341\233\216n\352G\257\004\206\276B\256\300iZ\302\367\231\013\204\f\304\236"
+	.string	"\017l\007\017\234\363\240\310\306U\201\205z\033\314\236\215\345\002gE\261\022B5y\031o\201C\310\322w,\"\2742\224\3145\334\361\204broh\f\274P\343SY){ \257LZP\264U\007<Ki\3733\245\276h$}8*\003H\210\232\276\345\003\022\236\250\\J\267\003|m\020\037\025\323aL\313n\356`\326Sz[\206\030\362-J\375\331\323\003\331\210\264\2511\241\013\211$\251A\322\320\0205\b\240\315\252l\300\320\271\263`\247\226\034\336]\227"
+	.ascii	"\026\265\\\002\272Mm;\021\202\243\304\326\252\016\037\033\330"
+	.ascii	"uYvr\214\247\277\261!\3322\226\351\343)\257\241)O\242Y\344\341"
+	.ascii	"\260U\020O\205\2754\336\267\324\367h 6i\024\322\367\252y^\356"
+	.ascii	"\003p\035\311\304-\366\307Gi\205\212\213\016(\355\237*\024\334"
+	.ascii	"\030\302c\213\264\357\026\255\020\204\017\300Zg\021A\035t\212"
+	.ascii	"w\364\216\321\315A\367!Q*G\210\272'\002b\341\262\352\036\214"
+	.ascii	"\202\363Jz@\\\256\216TH\260\005\3715A\361Gk]w+\357mI\306\274"
+	.ascii	"h\017\227i\323\224\001&'$\232\0014\227\334Q?\005K\356\001\222"
+	.ascii	"G\326\342RR2\205\fI\261\356\303\327\222\342\314A\334;\203q)\272"
+	.ascii	"\247x$\343SJ\017\356\026\225\372\347\247\213\3460IR\217\210\357"
+	.ascii	"-\253\243\326\013tJn\260\276k\221w\244\221\340\210pz\265%\354"
+	.ascii	"\361\226\327\323\272\013\245\364\004&U\r\247\372\313\242\375"
+	.ascii	"C}J\241\333A\234\316\242\374Xw\016\327\002\371X'*\3700\206M\224"
+	.ascii	"\247i\355\340b&\026\306\236\270\215p-\336\261\r)\t\005\235\017"
+	.ascii	"\302\206\246%\354@]\362.\343\237t\020\344,(\274t\001v\325)M\222"
+	.ascii	"\237\036q\351\003\240\373\274\220\031\353 \023\200\037\0217$"
+	.ascii	"\213\246\r"
+	.ascii	"t\003\003E\364\256\224\007\264\251\302\273\216\352\374C\021b"
+	.ascii	"Z+U\376\036"
+	.string	"\362'\377\205f2\355x\233\2171\225\361S4\351\315\035e\374\2411\021%\312H\033\n\344\300\325u\215\366GX\030b\361\327\364x\213\221X\375k\377|\254\311\222\375\315\376\002r\026\301f\326\300\016g\317\347\273Y\311\205\251\362B\2709\331j\023\266\314\240_\212,\240%\261c\263\013\230\n\367B\245P\260[D0\250\026\235ii\362\213\036\001y\203\237.\346R\256]qp\324\0031\322\351\220\303v-\336>b!\333\377\201\277\235uo\312\365_R\302\024\267\254\200\211\031\317m)\231\343;\270\222\026\231\336\343\245\032\340\245\231\270:g@\306p_C\331\032.b\031\346\232\354\235\017w\375\225\013!e\214a\261\206\264\273\212Qd|\247\323\342\311p.5\342;$\f\030H'\377q7\225\376\277J\265\213M\331\b\272\303\250\255\272\351g\254\327A\330\317\025\252\370s\351\333'fC\263\330\220\256\213\032\215\307"
+	.string	"~\2543\346J\313\365\214\016\035p\2401?\223\300\213\343Z\371\210,@\004\3004N>bz?\021tO\"\253Ln{\251\220w\005\254\311\342F&Z\234\001\001e\005\r\013\001\002\017\nBI\033\261g\177\374\303\035\313$\346\221>\007\356x\206\251\236\264\007\356\2326\263\217\246\270P(\270\032\304F\236\305\355\313Tj{\034\3676\312f"
+	.string	"\332\"\240\312\335=\326\346\244*w\002c\2403\tOg[R\205\351\305\3104q\317\200\365R\234\343\202\312\027^\226\363r,\374\320\314\034\331\021\224\264\224\235\267\373\327W\033\320ate\321\324P\376\301\204?\241\013\315$^\231\364\356'X3\n\037\360\b\375\n\262c,\246\374H\351\237\264#T"
+	.string	"\202\257\n\352\r\265\345\307YW\035\264\361\332\355\320\r\270b\304\031\337\361i\324\203\270\321\235\275M\300\340\005\231\222\266u\315\326\264\350\302)\271\360\273\026\242\244\f\225q\367\335\300\353\332!\023P\263U\220\317\300\210a\236\237\274\365\022x\273\320'9\321\017I\350P\206/\330#\366\351\325(+\0305F\030i\017V\354\034g\247?\020\247\225\032,\264}\343\353uF\264CX\325\367\205%E^\373G7@k\f2K\210\244\355A\236y\330Nnx\234\334\272"
+	.string	"d\233t&md\337I\017\237-\347"
+	.string	"\005\242\b\023\322\303\333\357OC\005vs&\370\346\030A\032u\300\007\255y+:\177\332\215\235\315u\026\201\026\324\003\237DZ|\n\327\177\342)x\270)\334*\363f\335}x\352\221GJ\205\256\217\234H|\326VL_\021\2111\342W\247\340[\t\276\r\202^(\276\210\274\331n \021_\2636\240\223\006}\310\254?\250\021\223\006\345\250\206\230\356\361\272'\312)\250->-!J+5\304\236O\322\312\300\226[*B\362#:\234\016}\266\276\n\342,i\343\020z\205\210\327@\240\005\340\200\206\371\340\361/\373\027\034Gj\367\343\325k>\2031\355\262X\2651\257\021[o\370tg?\321\016>\215\334:\021\347\300\237\347m\370\032\022\327N:\266\322a\324\252\207>\355\347W`\fz\277Y\367\005\306\224\223qK\376"
+	.string	"t\326\365\207\225M@\375\356}\377\244w\232\177;\354Y,W\211t\315E\217\\'O|(\211\035J\036\333\362\361\313\f\027\271y\357>\005\257\2731 \345\333\233\333j\331\"?\342\335\241~a\371"
+	.ascii	"\020\260<\n\235B\221\217\366\217?\017\220d\3040\313nd\313v\005"
+	.text
+	.section	.gnu.lto_.symtab.134942ef85ef6987,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"sdCardAndFSInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"sdcardConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"pinioConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"osdConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"afatfs_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"sdcard_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"tasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"motorEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"motorPostInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"rcdeviceInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"osdInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"displayPortVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"pinioBoxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"pinPullupPulldownInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"pinioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"sensorsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"isEEPROMVersionValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"initBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"ensureEEPROMStructureIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"printfSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.134942ef85ef6987,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2426 @@
+	.file	"rc.c"
+	.section	.gnu.lto_.profile.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	"!"
+	.string	"\""
+	.string	""
+	.string	"7"
+	.text
+	.section	.gnu.lto_.icf.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`L\005\265\026"
+	.string	"\264\030@\006"
+	.string	";"
+	.string	"\331\342\211\330\013\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\251\317\374\337\b\003\263\356\307\243\n\004\316\203\331\035\022\002\003\002\004\002\003\002\005\006\002\006\007\002\002\001\002\001\002\b\002\t\006\240\342\234\212\n\007\b\t\f\304\377\327\356\013\034\002\n\002\n\002\007\002\013\f\b\002\r\001\002\013\016\017\020\237\325\371\277\t\030\002\001\002\016\003\002\003\022\352\263\360\321\b\023\315\343\301\244\013\024\025\245\331\372\241\016"
+	.string	"\026\354\206\342\366\006\002\002\017\002\017\027\030\377\341\234\356\013\031\032\033\003\002\003\034\035\036\037 !\266\333\201\353\013\002\"\354\305\344\303\001\004#\236\307\314\315\0046\007\002\007\020\002\020\002\b\002\b\b\002\t\b\002\t$'()*+\215\317\243\217\013"
+	.string	",\366\336\227\332\r"
+	.string	"-\361\337\314\374\013<\007\002\021\002\001\022\002\021\002\f\002\021\020\001\020\023\007.\204\220\370\263\n\b\002\003/\206\211\273\246\f\034\f\020\002\02401\305\333\225\300\005\006\002\001\002\024\002\023\002\0242\306\300\206\200\b\220\001\022\001\023\003\024\002\007\f\001\002\00134567\220\303\315\362\001&\020\002\0208:\342\274\206\374\002f\002\b\002\025\003\003\002\003\007\026\001\002\026\002\020\020\002\027\002\001\002\027\002\b\002\030\001\002\031\003\002\032\032\004=?@A\232\214\265\246\f\005B\350\300\306\254\005\002C\225\350\354\226\007&\006\002\001D\264\323\204\275\016\016E\313\322\375\213\007"
+	.string	"F\247\226\246\235\017\020\002\024"
+	.string	"\200\270\250\3619\261\021\031)(H\322\001`\202Q\252\252\266\001\0210E\243\254\031I\222\024\246\003)\355&\333\272\r4\325>J\222&Q\024\371l\272\270\316\315\222\023\201\350a\2307\241I\b\271\241%f\3005\304k\\\013\013\255Y\363\342f\033z\334\365q\357A\016]\332o0\353*\273\027\035iR\204\353\021'J]\250w"
+	.ascii	"7u~x\262\247\227\371\266\203\b\305\271\303\024\232D\251;A\b\022"
+	.ascii	"\210\212|\353\025Q\276f\233\"\307=\204\356\225{\342\355?\357"
+	.ascii	"\005K\350;\263\303\276)\370*\217\307/\375\221a\273\256\322* "
+	.ascii	"Q\337\217V&\241kF.\343\031\263\205\356\\\231\213\301\221O\207"
+	.ascii	"(%\366r!\351\227\360\343\202\347\367\212\305\366\n\242\b\027"
+	.ascii	"I\245H\362\023\217#wD\317\305-\375>\037e)k{Ko\371\\E%\251\230"
+	.ascii	"\334\034\003,``\031\226\235\337q\230\274\360\336&r\210|\304\327"
+	.ascii	"\205\342\264\022G\273P\0305\256_\251C$\217\377F\377\r\370\253"
+	.ascii	"n\370dsk\021\177\267*Qv\346Z%p~#\366s\315\377#Un\206\347v\217"
+	.ascii	"H\223U\373\355\201\237;'g@\002\236\207\244\245x\025\032Y\361"
+	.ascii	"#@\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"5\005"
+	.string	"\322\006\024\034pM\322\001\374\271\372\377\377.\030\2237\024;#\024O\220\270\211\235\340\302#r\247\024\316\313\264\314\312R\346d%\032\021\262\372c:V\215e\370\273\330\212\322Z\002q\250\337\3262\020\006S\020"
+	.ascii	",\232Pi\302\324\373G\235\033\375\264\232\263\340\231( \320\202"
+	.ascii	"\251\343\034e\300\256\306,'\021\256\2275,\363II\375\203-\210"
+	.ascii	"r\021\360P\360t,9\201\033\032\376\262\3129\001\307\330\334\201"
+	.ascii	"\025\262e\005x\"\3461]i8f\344H\017&\247\305\356#\231\2679\300"
+	.ascii	"\004f/%aae&d#f\315\f\001"
+	.text
+	.section	.gnu.lto_.inline.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`(\t\315\037"
+	.string	"Fj\220J\260\224U\032\003X\223/\214\260\376\273lp\376a\225\017e\346!\351\247\375{\223\266)jY\333\377V\020\274u\3701\224\277\334\263\245g\301\322\360\354\354\200r\001\262\336M\336\274\266\0228\265\343\327\321\245\274\321s\337\337\356-w\nx"
+	.string	"{"
+	.string	"x"
+	.string	"\276&?\020\034\203\315m\276\223\325\315iT$\232\260\241M&\242\"\213\231a\333|),zn\237z"
+	.string	"\207\300F\020\203Jb\346?[\271\344A\f*\201\231\356\366HH\330\243y\022\022\366\016<[\217u}\265\326\027\272O\034\225W\366mo\215\343\321\351\343\334w\334Zk]=\316d\212\001\365c\243\372[V\312\237e\345\376++\237\317\335\016\001\205\274P\360\265_,\001<\377J\232\273\234\346\322\247\270zY\236]\317\234\tu\244B\270\324\f\344\002\372"
+	.string	"\226N\0319[\016\323\245n\206\b&1\362Zf\020MR?tH\244\335\207\ra\320P\303\214\271\326\"\251\265\312~\221O\234\235\252\265\302v\241\265\314\025\003*9\325\262\177\234\005d\323\232l\334\036[\267Q\255\017\317\372k+\245\213\364iZ\325\266\203\244\317]l\002\333|Ld4\025\241\331O\0045\002|n\036Y\372\325H\021\360I\235\323|sZ\324\234\275\234\346*&K?\03417\370_\347&\353\231\326\302\246D\241(t\233\257U\277\315\245\037\r)\325\333\252\257\206\335ATl\222SZ\2478J\351m\316\227n}\351\r\225\365\24575\217\353\2645o\355\332{[\231\233K\212D\240\312\357fq\007Q\212\f\261\237\317\\Is\230\223\240\213\353\306\2346%\223\254m\363\200B`\270\266\360o\205\205%\325\312sM!h\365;s\bT\244\324\2633Q"
+	.string	"\025)\355\342\t\322f\\I\330\346\323Y  7zK4\302CAC\3168B\nK\276f\016\243\0266<\350\254\b\022G\206?\r\341\345\2333K\004\231a\264\301}\212\310\321\220\024\376\340\237Q\265\326\001\272\035:\350y\234\3327`\370\306i\277P\223`\334\024\366\220\242V\261\307-\372\021\032\262\336\330\013kQ\272+\226~\001\200\312\250\021=\306\f\r\215\214$%IsP\0021\210\212\252\007\022\340C1\206\223\nA\205\210D\202\211\222\244\244$u\007`,"
+	.string	"\313ZUJ\200\307^\310\376\006\375V\340\311n\250uD\321\256\362\214\264\nf]p\202\222z\370\373\256\355N\004j\211\240q\\Vh\206f\323\004\2412m\306EM\3074/\312\374\213\021vLD#3-\007\241a\262\240\200\212\307\305\023\003\236\031\226\343/]\003,[\363\233\227\3525\345d.\251H\362N\366\357_;D*\354\307^#l*c\207@\031\200\341\317"
+	.string	"\313\236"
+	.ascii	"\016\022v\375o\246\016\364w\332D\032{\373\260\362\337K\241(\t"
+	.ascii	"Ay\330\023b\324\270\264\fv\361t[\232\360\365t\303>}\013\n\326"
+	.ascii	"\376)h\204\016\031\344\\E\223\307\"\225-\250\314[%h5\320\207"
+	.ascii	"\223\312\313'\214\313\0043H\214\273\312\216\220A\206V\261\023"
+	.ascii	"\340S\313\361(s\266\255\356\365\332/\325\245J\225\276N\353\212"
+	.ascii	"\032*4Dd\333V\021\370 \340\206\035\321B|z\002\307\252\264\360"
+	.ascii	"R\225\270\202\032z\266\336-\214\327b\202\310/\207\016A\300\017"
+	.ascii	"\335\002\324\t1\032\002\2218H\317\202\226h\306\312c\355\340N"
+	.ascii	"\231\300\205\331\221\013\027\376\023\230\324\347\024\256\247"
+	.ascii	"\036B\033o\034f\257G\321\267\006K\2226(w\354Lz\311\315n\001\265"
+	.ascii	"'\262\003\002\031\210I\237\377\257\241\216jo\037@\237\246]\211"
+	.ascii	"\267cz\302\254u\201\316!(\344\251\254\355\213\341\021\305;\002"
+	.ascii	"KG\035\250C\0021\205+\236\004\234&\240a\361\001\2723\3018d\026"
+	.ascii	"\227\2620\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\363\003%\r"
+	.string	"\262\31721`m\322\001\260\201\322\033\264\353\026\255<\032\nH"
+	.string	""
+	.ascii	"\003\271\270C\220\346\020`\002\254a8_\205)@\r\331\266\320\033"
+	.ascii	"T_\321\265\341;\310\235R\nm-\332\212\226\242\235h%\332\b\213"
+	.ascii	"\370\357\307(I.1VB\225\320\233N\215\004\b\216;M\316\017\366\207"
+	.ascii	"\232\260\215o\3148\302\3277\034\332\206\352\031=-\366\031\242"
+	.ascii	"\005\206&\261Gly\357=;A\330\335\274\375\314\272\336{\304Q\330"
+	.ascii	"T\323\262 {\240|<\235\367R.~\320\022\003\235H9\300~\006C\265"
+	.ascii	"\227\002\202j\240\2352\317\366\254$\2016\327\2343\204\375 \273"
+	.ascii	"\366\035\316qh~\f@\313\246\321S\243\307m\023Y\365\\6\256\033"
+	.ascii	"<\251\347\345\331\261\275\332\212'\001d\250AM\211L\304R\230\326"
+	.ascii	"p\002\0312\253:\022\300c-\306\221\240d\314\021\223 \005\005)"
+	.ascii	"\261\323\034f\036\360\220&9\314U\240\313}\f\362\340\315\243<"
+	.ascii	"\0207\360\266\004p;u)E\\c\262Hp\007\3551\017\203G\362\331<\330"
+	.ascii	"\370\027\361\332\t5\365~\273.m\230?]|2Ht\244\303;mq\200\360\377"
+	.ascii	"\002\316\302*\247\323\205\366\274\237\371\305\243C9\025\226|"
+	.ascii	"\bR\001\320\313(P\270<\033K\270@'!\201\270\235a\3539[D;!\276"
+	.ascii	"\373\200\035\366\223\303,\r\357p\f\315\025Tq\003\347\225\346"
+	.ascii	"\277\361/\0318\247\337@\022\316\215W(~\205\313\251H)\312\006"
+	.ascii	"K~\216#p\"\373?W\036\027\245\001\223 s\020O\004\246\247\023P"
+	.ascii	")\273\302\362'"
+	.text
+	.section	.gnu.lto_.pureconst.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375 e\305\002"
+	.string	"R\006\025\036`m\322\001\363S\212F:\212\031\202@dp\\wf0\315q!\202\251\340x\246r\013;\327\362U.\345\234\\\311\0309!\343ct\334\306\213\361Z\274\024_\342C\214\207\3210\026\356\340\nn\340\002\356t\245\033}\320\370\234\316\371\252Y1+#\230\331%"
+	.text
+	.section	.gnu.lto_.ipa_modref.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\217\002\375\n"
+	.string	"\242\017-,`M3\0340\030t\327)*\013\214&\260\222$IH}"
+	.string	";r\204\335\252\265\215%\203\317\243\330._\323]\274\341\337\320\222-e\n\377\317W\215J\306\023\203\272\370\212N\251\363B\3219a\351\224(\2574\242\317\345\031\013\245\234b\225?\253\362\230\227\257\314F'\237\2359\330s\317%e\363\367\034l\336\266>H\275sN\307\334\271\200\220y\227\312\255R\302ij{\206\205\252\274R\220 \250D80 \306\202\207(\t\266\270\r\334IgT\036Q\235\222\316\247\374i\344\007"
+	.string	"\241\300T\376\320\t\225;\360gZgCg\313\333\376\315\325\\\r\326N\270q\004N\250\361\\$\321\005\005\255\324\351`\002\0312+\017\021`\211t\220\r)\263\300\240T\254\033\334,\376P!,PN\200\306>\364&\005\020\\\242\275+\2553\231JV\241\013\234\243\3351Ko\200\267\027\036\026\316bA\324\204h\221H\317y\333\343&O\221\323\367I\315\270o\301\002s\026\326\303n\315]\317<\235=\233L\323"
+	.string	"N7D\263\260\t\230\020\220\324\035\242\327\356\307c*^\005XgHP\312\254v\370>\337'\024v\363\214`\301\3632\261\3409\317\236$>\214\205\236#7I\353\277\316\311\033+\036\0339\365"
+	.ascii	"<"
+	.text
+	.section	.gnu.lto_.lto.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getRcFrameNumber.73.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375 \354u\006"
+	.string	"b\f-2Pm\222\016\244\004\252\312\251\272\211\312\360\351\212\\\343c\315-\225k~\307\332\335\016\257\025\334\b\212\205\250\252\212\250\2013<\217S\347\377\375o\244\221-SK\031\211z\322\301S@(Hx\022\305\3602\227\247\005\003\3525L\023\365,X\266y\260a:\355\341\373Q\254\272\032;h\260V\335\325Du\330*\024\035\314\036\343`\273\370B\331<?\216\215\"A\022P\222\031\221\235\344\210\023\331\3707o\271\035\365\330\\AX\306\025\201| BL2\261\207)@T\007\365\022\3255\214V\305\352\366S\210\303\"\263.N\221B\220\231\243uM\364\326\177\340\027\370+\002\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getSetpointRate.74.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230>\246\270\324\016<\211\336\f^\240L\2004\b\236&\272\334\257\372m\f\325\250\241\241\247u*\3030\020\030]\r\220b\271U\222\372\255\265\275\267L)!\320\303\347\365\362\\Y\274\020\242\002\350\223\020\257,\024=\234b\013\007Yd\300\260,nT\367\27339\327!\271\b\b\203t\225\371_P{\370\243\241>\031\326A\224\336\fk\221\323\260H\331jU\243t\030\255\337\235\251\315\254s\312\316\207\251@\t0\371'Z-?\201\254\215\266Z\273i\353t\252%\325\374\027(\222\377\004\025\310\030\266\255Q\346\320\332\325Si\234\234\"\"\021\302\362?v\fp1|\346\\\f]\2065\247V\273\303o\305Be+\215\234\030\203\377\315\255D\341:\017\264\035\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflection.75.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"\362\31645P\215\322\001$\243n\222\322\240\024\251\262#u\360\222u"
+	.string	"\026\021jvQ(\355\237\306\2111,\301\337\020\222\252\2522\352\232qc\330#\234\267\276\355\357\275eJ\001\240\317\203\347\325\352XX\264\020\242\302\307\223\020-\f\024;\233^\013\007Xd\270.,jR\367\273+9\307\031\271\b\b\203t\303\374/\250=\374\321P\233\f\353\020Jk\206u\310eT\243\\\265)Q\272\213\326\357\256\324f\326\031e\347\273l\234\004\210\374\023\253\225\233@\225F\333\254\325\264u\032\325\222f~\213\023\311\177\202\n`\f\333\326'sd\355\366R\031&\243l\022!*\377#\307"
+	.string	"\026\303\347\215\305\320a8sf\265;\374R*6\215$r^\f\37675\022\205\353<\320v$\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.76.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"\362\31645@\217\322\001\230\301P\032\201\026\361\021~\t5TIW\374\031f\315\345\246)~\033C5jh\350i\235\3120\f\004FW\003\244X\030\236j\356\377\266\367\226)\005!\320\303\347\325\362XX\264\020\242\002\350\223\020-,\024=\234^\013\007Xd\270.,nP\367\27339\327!\271\b\b\2034\225\371_P{\370\243\241>\031\326A\224\326\fk\221\323\250H\271jQ\243t\027\255\337\235\251\315\254\363f\347\303l'\001)\377\304\252\345&P\245\3216k7m\235\336JR\315o\261\215\374'\250@\306\260m\275a\216\254M=T\306\311(%\022!,\377c\307"
+	.string	"\027\303g\316\305\320a8sf\265;\374T*V\264\322\310\2111\370\337\324J\024\256\363@[\221\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.77.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375 \360\205\006"
+	.string	"\242\214-3Pm\222\016$\243\271\350Np\024xQ}\223\244\030\323\370\203a\345\361\027\313\326\336\024Z\301\215\240X\210\252\252\210\0328\303\363T\335\356\177m\2154\262e\nS\031\312z\324\301S@(Hx\224\305\3602\227\253\005\003\3535T\225\365,Y\266u\260a6\355\341\353\321l\320\365\354\360\007\213\325\335?R\035\266\312\304\006C\237i\260Y|\243l\235/\216m\022)\t\b\311\214\b\245$\211\003\311\370\257\267\334\215r\\\017\2122\fOMN >P2\363a\n \325E\275Hu\355\242W\361\272\355h\244Q1\202q4\305\211 3G\214#\321[\377\201_\340\247\b\b"
+	.ascii	"2\003\346:\203i\b\3055q7\002k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_getRawSetpoint.78.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\255\007"
+	.string	"\362\01655@\217\322\001\230\276\322\222\302 s\001\017\305`\177\265\363\376\263\311z\313MS\3746\206j\324\320\320\323:\225a\030\b\214\256\006H\361\244<\325\334\377m\357-S\n\242\320\003\350\325\372XX\264\020\242B\b\224\020-L\024?\235^\013\007Xd\270.,r\266\373\335\235\234\363\224\\\004\204C\252\322\374/\250?\f\322P\243\f\3530Jk\206\365\310mV\245|i7R\272\213\326\357\356\324f\3269e\347\313\260\244\004\214\374\023/.G\201+\215\266Y\313i\353t\252&\335\374\026\033%\377\t*\2401l[s\270#kUo\313@YeEB\244\345\177\364\030"
+	.string	"c\370\334\301\030:\fg\316\254\266\207\337I\205J3\221\234\031\203\377M\315D\341:\017\264%\t\013"
+	.ascii	"2\241\241/p+\n\036\026\317a\002r\r/b\302\271\204\034\200J#\315"
+	.ascii	"\206w\335\033"
+	.text
+	.section	.gnu.lto_getRawDeflection.79.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\245\007"
+	.string	"2O55P\215\322\001c\302B\260@5\235\364\023\241\367\333)i$\226\001jvQ(\355\237\306\2111,\301\337\020\222\252\2522\352\232qc\2502\235\267\276\355\357\275eJ\001\240\317\203\347\365\352\\Y\274\020\242\302\307\223\020\257\f\024;\233b\013\007Yd\300\260,jR\367\273+9\307\031\271\210\266\205\360GU\230\377\005u\207=\032j\223a\035B\351\315\260\016\271\314j\224\2556%Jw\321\372\335\225\332\314:\243\354|\227\225\222\200\223\177\242\305:\t\\i\264\325ZM[\247Q\035i\346\2678\211\374'\250"
+	.string	"\306\260m\275\341\223\326\252^*\303d\023\226\004\210\312\377\3101\200\305\360yc1t\030\326\234Zm\016?\224\212\224\215$r^\f\37677\022\205\353<\3206$\n"
+	.ascii	"2\241\241/\260ZQ\034&t\327\360\"&\234K\310\001\2504\322lx\327"
+	.ascii	"\275\001"
+	.text
+	.section	.gnu.lto_applyBetaflightRates.82.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\335\006\265&"
+	.string	"\272D\f\017J\220\332M:\204Q\343UZmOl\025\007\331\272\203\303\243\321\336I\202\234\212x4 \\\364)\302h\220\256\267n\274SM\267kN\255\345O\345\034%@\016\342u2\347\275\332D\037\335\331\026\303\005\035!i\204\020B\210\334I\006\335"
+	.string	"\307"
+	.string	"\334"
+	.ascii	"I\256:\240)\230\3253\341s\261\332d\005\023\025\220\f\350K\373"
+	.ascii	"%\337bU\213\2076`\316ezA\344\n\203\022\036\242.\232z\326\262"
+	.ascii	"#\306{/\203\227<\241\261V\2209\227\351\027\345\300\ny(\245\013"
+	.ascii	"\361\336[\304\nn\217\244\005\247\367Ny\021\357\005\026\261\020"
+	.ascii	"\372\222\231\371EnD\211yH\n\253\254^\346ciI\231{\357\315v\036"
+	.ascii	"\363%\371\035\363e\363\270\322\325Z\212\236fI\266U\342\237\023"
+	.ascii	"\206\260\312\262\270p9\271\270\0324\365t\343\265\332\213\261"
+	.ascii	"\245(3SOQOm\240\344\002)\261\031\317\322\004E\362`\321\341\345"
+	.ascii	"\304\007\005\233\242\354\231\245\351\306\2225k\274\\_Xr\306\373"
+	.ascii	"\306\tH\332\356\275\337\272er\372Y{N\270\367\262\205\341\364"
+	.ascii	"t\25693\027\231Y\211\331\274\001Y]\2006\355\302\303tEU\367\336"
+	.ascii	"\b\314\"\016F\002\275\367>\370bQ\202\250\312\n\205\371\322vQ"
+	.ascii	"\217\342\213\207\202\202o\305;\236=\f\236\371\362\235N\201\021"
+	.ascii	"\201\362\331#\263\360g\233\212\371\344\355\035\314D\357:#\260"
+	.ascii	"\226\207\204\202l\007\216\365\033x\2233\320\205\177\201#\371"
+	.ascii	"\t\\\311\371\347"
+	.string	"Zg\237\013\317\002\254\345\036k\231\307Z\016`-\357\234\226\001\230\226u\254\345\034k\031\307Z\276\261\226mN\3135\246e\325Z\256Y\313\251\265\214Z\313\247\265lZ\313\245\265L\236\226\333\264lK\313O\240BaY@v\257\214\343\231{\245,\006y\327\337\344W\362k\235d>\337\311\211\314*\247\370\220\215\314\356\275^]+\002\355\323LR\256S\246k`\206\373\026\235V\237\310\210\344\264\220O\013\350\234\276\324\0170k\360g\332\032\247\203\332.Y\245~\366h\366d\314\025\364\246q\272\277.i\353\233\022\352\007\331z\365+\233\212\317\365\364\352\353K\037h&m\201\026\320L\314\314$\307\207\306Y\226\025\240M\263i[\177l\r\326\264M\237h\253Q\355\232\376R\032\237=\216\351 \344.fd\246\366\267^\224E\314L\221\2545\332\007\332\226\255Ri\327\032\350k\r\362\3606m 4\353\025P\237\215\366"
+	.ascii	"\264\002m\366\331d\227\331>c\006\332@\227}0\037d\326\340ox\035"
+	.ascii	"gX\302\313\022\216G1\300"
+	.string	"{}Cd\003\265E[\203?{\344n\262}\320V\243\355\356s\275<\343\003\314R\032{\357u\321:\323\366\207<\302\biD\022nw;\342\355v\274\334\200\036/)\207\013\321\323\235@\261\201wB\205\256\314\365L]\022N\203\316\204\210#\\\212\364\201\202M\b\020G\270\335\216W!\327\253!\221P\201#9g\224\353\335r!nG$p\273[\256\207t3\332a\336\t]\357\226\304\343\365n\252\320w\362\366\016\276\327S\253)1jDm\"\314\212)\324??\250q\312\225\031\243\257\177jS\261\007\260\264\247=\bAO|\232\243JS\230 \347\020\202\026j\242\346`\265\265\006\207\020\020\025\311\262\270hQ\2515\025G92\244*\355\035\314l\207x\032\250\306Y\226\030\320\246\275*\315HD\233J\353\346\304[\250\032Wp\234i\341\351\351\022-@\363\364w:@\037@\357\364\317\230\325\350\263G\326i"
+	.ascii	"}\257[(\3768.\245\361\2359\302\220\224Am\"L\212\264\005\177\250"
+	.ascii	"a,\004\021B\206\231\032\031\221\2440\205t\220\002\03112z\021"
+	.ascii	"P\251d\210\210\266\244(\351\332m\224\024\372\225\302\376\255"
+	.ascii	":E\013\021|\366\273\204\347\364s_\247\322\316\334A\360B\353c"
+	.ascii	"\2645B\216[\b\242\021\256\260\2640\037\247\303dq=\032\367\304"
+	.ascii	"\370X\204\r\266\024\307\362\005a\247\204\372:)\262\200\301.2"
+	.ascii	"\204A\013N\357Rjy\256\310\205b|\353\302X\215Z\247\240\305\272"
+	.ascii	"\215.\244\367\371\242\232\337\273\302\361\360HZ\337~\367Q\303"
+	.ascii	"\314rX\343OG\310\361\317\341X\r\376\266\353\274\250'N\215\236"
+	.ascii	"M\237,\212\030\020*\234\264\b\215\233\356a-\234\207\266\242h"
+	.ascii	"\035C7\262\261@^y\273\355\004\013\311<\347W\377\005\227\231\324"
+	.ascii	"\232\026k\321\275@\303R\020\356\322t,<\325\201\203\316\243Z\365"
+	.ascii	"\253E\"\260\036\312\355\336\254x\370\350\341x\035d\336\232\257"
+	.ascii	"4E\344\322X\2310\334Qq\241\r\207~\307\317\007\227\220B26\371"
+	.ascii	"Q\001"
+	.text
+	.section	.gnu.lto_applyRaceFlightRates.83.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\357\002\275\024"
+	.string	"ff\206I\260\224U:\3709\332f\2054\264<\216\311\267\277xV\377\377\275\364\2469\3422<w\360^\030\364\177\034\242m\024Rn\"Z\201\244\225\236?\350\\\351\307\336\202\345yn\357\372\307\255\237]m\344\324\266\351fb\t!R\246\024p"
+	.string	"b"
+	.string	"y"
+	.string	"@\247l\377\034,oB\274xI<\224\346\234\b>\372e}\035\304\326\334\331\215X\240=\007w"
+	.ascii	")\232s\266\370\300\365A\037|\232\323\004Q\321\2348-&P~\264\355"
+	.ascii	"\307\270\214\234\035\024{>?O\"\312\001\"\231s\306\006\334E~\024"
+	.ascii	"\237B~\\\025\317]s\376\201\027_\2608\242\303ss5\275\3149\255"
+	.ascii	":<=\367\336\266\001\333\024\354\255\t:3\344\307/\313'dI\204N"
+	.ascii	"\207v\357F7\205}q.\n\033v\337\277\362\337\255\362\336\375z\357"
+	.ascii	"w=\350\007\240j\024U\237\250\272\245j\326\250^\251Z\245j\023"
+	.ascii	"R\235\032\325(U\237T]\252\332\244jR\325\243\252ER\275\243ZE\365"
+	.ascii	"\003\244\202|$\030\316\tb\230d\"\215\302\026\377\375v\316\017"
+	.ascii	")a\355\277\037\264\347x\200Z\005=C\226\204\272\323\276V\201\345"
+	.ascii	"\236v\207x$N\004\361\365\"\f\207EL[\356y@\344\212k\002\332\005"
+	.ascii	"o\305\231SW`\\rY\214\360\\\270\326\265\343\n\030\342\001\355"
+	.ascii	"t\350]qaG<%\335\335\347,\321\351\320\302q\324.\3443\347t`\307"
+	.ascii	"\374F\206r\316\311\300\206\007\033\004\237\037\033"
+	.string	"\362\243\356\205V\bO\3435l\374\037\337f\364\001\264\032Y\005\232\206\232\214\354DsA\202\n\006\203\214\314f\273M\230\341P41\034d\242g.3\\l\006\023\223\211\221\331b3\034M\314%\305\267\r4\\\254\346v\303\305R\275y\033\266\253\235\031H\272\335YeQ\026\266Wr\262(+\002[{\262,+\313\332\326\222\300\325\262\2264\342)\351\250\275\307\354F7Zm\203\036\"0\204\272\022\245jU\366G\2575Y\325>\265&\013\003\24266 \240\002\231\262\352\006a/\024\026\3710>\nn\330pC\367\005]$\303\321\222\223\r~\007\357\t3\330W$\334\312Jl\034\245a8\232av\256\326\304\003\276\312\224\345rd\356\b\264\230\210\320\235\201\021\024\310/X\265\253\330\025\366v~n\013Y=\3242\302\325\225\023%BBpOt\332H\274\215S}\220\007\021\3339\304\n{\206\025D\260\306\343"
+	.ascii	"\006\024~yL\355\"\003"
+	.text
+	.section	.gnu.lto_applyKissRates.84.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\337\005\265!"
+	.string	"\226;\322K\240RR:\222\265ui\310\212\215\276\272\252+uFTT\2255\033p\275\325\300\266\210K\362&\337\223\227\357\327s\203\362\023\177\325Oo\372_\213'\343\354\216\227V1\343\254\201\306-\034\306\356nqe\372^y\326\b!\204l)S\300"
+	.string	"\240"
+	.string	"\307"
+	.string	"\266\254 \243\2472&\005\254+o\214\271{D\224D\n\202\325\225+\b$\336qL\t\363\336[\200\321\353X\252\2403w\217\212\"\016t\362\312\036`^\367^\003\037\300\3154>\274vo\212,\257{\215\006\036`e\364\377Y\006\317\020\372\225g\022*\212\307\216\024]9\271\367\366nx\2272z\262.e\324\256`!^\325\024=m\013\235U\035-\306\241zRed\013\t\202W\226\024IK\254\026qz\354b"
+	.ascii	"SHK\215F`A&\243h\013Y\202O\034\322x\336\334{mH\242\266'\201&"
+	.ascii	"0\0228d\361\334\211\251@\302\\\334GH\242nU\347\336\3736B&\361"
+	.ascii	"k\374\177\351\377\320\217\306\bG\226\354\3058\200\316Q\017\n"
+	.ascii	"\233\215\204)\243loK3\264\245\241n\376\311b\333\247\237\317k"
+	.ascii	"\235\376\356\333\260\025\277\206\223\3144\214\305\237\351\276"
+	.ascii	"\fS1\307p\026\037\206i0\277t\237\327\375]\367]\272\257S\373-"
+	.ascii	"i\237\245\373\271\356"
+	.string	"\257t\037\327\375[\367U\272o\353~J\367k\335_\273\257\252\3754\355\243\335?\325\276M\373\215\366\371\306\306D,\207\307\275#\232On\030\272t\301V\314X\314Yl\177\356B\2274a\033\314\365\333\316\201\267^[\2369\341\360\333\030\355_\350|\3055X\353\001_G\226+\366fs6\346\306\261\tgW\254\214\031\f\316\316\0049J\301X\025{\263/f*6\205Bci\254\315\362\213\026Mdf,k1\316\324Y\225\021\254\037E\324>1T\032\323\353T\376o\234\232\245Q*\253\0023vZ\3430\023Ca\355\023\026nI)\214\251\252\210\020c\247\275f\257\344N\261g\222\243Tq\2655\3131V\265\253\345\324\252\366\305\f\265\251\017 #\371q\017\036\203B\255\202\2443\264\245\222U\224Q%\357\0314\233L\214\367\016\341\234\026\306\366\215\343T\261\233\267\366\264/cGf[k\271(\312\377\200w"
+	.ascii	"\027\220\335{\023\374\027XG\317z\357E\220\303C\006\004dQ@)\243"
+	.ascii	"m\027"
+	.string	"\004\307\220C\304\360\343\013\366|\204\301\240\360\027\303\003\3340\004r\360\033\256D\340\217O\002\2208!H\303\212\004\"\261'\003\216X\241\301\215\307\202\217/\030\024:\370\rS\210=\035|\347\1779\277a\357\307\323\363\351\361\005{\277!\261\227\243\273P\003p\330\373\021\n\207=[r\210\317k\235\276\363\245\362\354\016\214\224\327\205t6\002\275\222\321\302\234llV\346\020$4\346\220-\256\252u\372\311\244TV%$\265O\337\371:S\354\016\f\346\342\332\t M-c\217\3767\2070\205\t\340\2564\336\316\362lC9N\325\330\031\273\263\034\245E\3638U,\2060\021\246\304\305\326X\016\242\2639\353\322bu\266\346\212\305\266\020\001\366\227\217\305\272\213\305vo\250q4\303\024bH\321\214\210\302&\205J\007\220\002\221\271\252\016\021@\251uhJ\242\242ja\r\272\271\305x\225\0012|\177;\250\320\262\005;"
+	.ascii	"x\037\300\337\330;(\307\335\347vyWj\251tw\375\366\\\025\243\222"
+	.ascii	"\200\202\336\t\bz\260(7\033\226\275\217\241E#G\360-\033(\314"
+	.ascii	"H\330\352\315\313\316\303'\343H\032\202\251j\036\330}~a\016_"
+	.ascii	"\300\217A\024\254}\204\342K\213\215\254\222/\202\313\2315`\206"
+	.ascii	"?\324\355\227\t\340\234\b\3548\357\220\037\302_\365_\301\004"
+	.ascii	"\020\371\0210\307\333\301C\364\245\321\023\351,w-\2470,Q\035"
+	.ascii	"\244^\324\361E\240?\374\223\245j<\b\242^n\264R\261\"\202G\201"
+	.ascii	"\251Hr\247\310\256=\360;n[xh \203\034\t\330\215\2257\025\201"
+	.ascii	"\270\312\330\275\237\372\205|\350\345\262\227\274?"
+	.text
+	.section	.gnu.lto_applyCurve.85.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"]\t"
+	.string	"\326Q@;P\245(\035lT_z@T\276T\227\235\177:{dg(\3265\240\202\241\345T\216\027\354\227\207\267\332\024\243\343V-\322\314\314:\223\321\353\016\030\r\261\247G\373\204\354-eJ\001/"
+	.string	"0"
+	.string	","
+	.string	"\035\307\351\006X\025$\253\335\215\227\033\\\207\357\226\353P7\316=9\377!\177\036(\004\244R\350\2111\354\256\223T\272\270\365\266\021l/\330\207\001\232\376\244\222\240@<\260k\321b-\001\030"
+	.string	"e\233\263+\266\263\263j@I\302\363)\0130e7\243\003\300\356*\370`rh\333\3778\bg\253^\352+\246\227\221\206\3744\365\243\325E>2\341\237\034\001\312\223@\327\341\225\202!\312\226\335\205R5\354\277U\023\366\324\017\337\375/\323\031\035\215\363\3114\016\033MC\201\207#\221y\3160\331\026\263M\354p2\0171\333<\021c\261\006\241\331\342G\323\266X\351\366o\325\204\351E\244\024\2762\365)\f\017"
+	.string	"2\241\023(0\244/\036\241\247\354\301V\327D\236\211\346\253G,\306FP\016\204\006F\004\025p"
+	.ascii	"*\217\251\235d"
+	.text
+	.section	.gnu.lto_getRcCurveSlope.86.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`I\001\265\r"
+	.string	"\206\331YB\020\221\232\016\250Z\300\030\226U\342\267(\327G\025\377\333\276?Oa\307\375|)))H\325\251\2275\2449\232\bq\354\323p3]"
+	.string	""
+	.string	"P,x:\342D\223\276'\2154\315[\262n\"B\233H\231RF"
+	.string	"A"
+	.string	"G"
+	.string	"1\266v5\254\244\330]\003\036P=\332\366W.\242\263G\022\210\222\362\030\026*\220\230\331\335\214\363"
+	.string	"\323\243\364\215\351Q;\274{v\376[\316"
+	.string	"FE&TB\362\244\026\354\2563T\202\341\326\333&`\373\200}\030\001iLJ_\231\2662]Ii*\323\323Y\376x\360\327Lg\246\017`c\362\"\001\213\335\013a\215u\021Ux\260\375\027\004(#\3562r\221u\0056bc\217iw6f;A\217Z\214\n<\317\342\177y\003*1\275F\365\245\032\345|J\342+\246\377fn\342'$\370)\376\210\344C\"\323\343\245w9\207(\fa\342\215\276A\206\b\\+\bC\032\024v=\016\325\353g|\031@\031\332 (\225\203}i\365D\223\001 \233'D\353<\370\3508\270>\236\t\036\222\265\016\215\313\264\217\f\304\343\001!\323\270O\326\261\341-B\207\313B\266\215\3130\320\273\264z2)\307SP\211\335\335\244N* \346\003a\251FS\337\362\b\243\"\363}"
+	.ascii	"U\252\224Z\252\025\nJ\003! \260\"!\254\036\262\320\352\033x\266"
+	.ascii	"(\b\024\223\027\315\321^k\031\303x\230\270\313\311\245\2026\""
+	.ascii	"\210\2422\252q\354\234\270\303\236\210\240h?\360\266\254\300"
+	.ascii	"&\324EH\210\021\020\305\346n(\273\326 \240\303B\241\r\3003\232"
+	.ascii	"\332\365\004"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.87.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\327\003=\033"
+	.string	"&\362\257G\240\\Qc$\033\036\323\364\250\256\325kg\003\375L\023I\bE\364\343p\n-\031\336\352\200\316\240\327fP\022\250\306\320\237\262M\023\200\233s@\027T\340\262<\2370\320iz\237pi\276W\013`\215\354\275\345\2262\245\221"
+	.string	"\217"
+	.string	"\246"
+	.string	"G\262]vq%\226\300\243\214\220\221{\257\313\205\355\272\245\017\332e\033h\342\3513#"
+	.ascii	"\317\370\253\272\3672\270u\202\363\326\366\251}#?\222;\022;\231"
+	.ascii	"u\357\017\242\224{o\003\0378o\r\034@yK\036V\336:g\1779\260\350"
+	.ascii	"\232D1\200\226\214\271\367\306*\321s/-Yi\316\177\360\254\236"
+	.ascii	"\317\347%\216[^\360\005%[>\033\257\344\002\241+6^\276\035\t "
+	.ascii	"\n\210\227#\235\006\371~(5+\334{M{>\032\267y\333;\266s\354z&"
+	.ascii	"\024\216\307\252\237{u\b^_\365fxDv\364\230\363(&\236\367\336"
+	.ascii	"\b\376\223C1\341\033\335"
+	.string	"z\007\005}\017Ey\373\372&W\3004\345jIG\2176pG\353\220}\362\326 6Ims\340\r\373\360\256y\322\375:\222\237\206E\335:\251Y$\365IR\233$uyjkR\223%u\265\324\224\244\276\200\002EB;\210dT#\360\3128\226\271E\2734\344\303?\351\007\276\332\267\257\304g\362&I@\306!\024\316\333a\213 \242#\007\027\006\tvPB\243\023+\262\254\260jVS^\230\035U\022\023\345\243\326!\303\220N\1778\2129\230\264<\375P2.\353Y\317\263\262\265\254\325\211WEV[\017t\006j\003m2\207?u\200\200\205\305\007:\2342\302U\332D\265\364*\267\202\003\021\"Dy[\353\203'\225\230\240\256~0ZS_\225\246\232VX5\300\253>\366\247\234\312\n\337\310\"F\214(oi\265LOG\277\032'\023\t\0245\2210\301`9\372\325\324\tOxc^u\311\304"
+	.ascii	"SR\256$\233\321h\345\255)\274r\364\323\021\277\203\241\243x\035"
+	.ascii	">q\203;\321#\253\305xl\265\232m6\240\205+aA'\207GV\253\331pf"
+	.ascii	"7\032Z\217\314\003-\205\t\036\031\013\267\303BFzv3\273\305f:"
+	.ascii	"1\236\035Y-6\273\341b70\333T\320n\261\036\233\355\026s\001u'"
+	.ascii	"o\rb\0167\212\272\272+[]rG\036\024M\235*\227\304\002\016N\317"
+	.ascii	"\252\266\352\203\217\325\220\022\032\207O:z\374\205\364\204\212"
+	.ascii	"\266\016YD\221j\262zX\231\301\205H\317jS\203\316_(YUGH\345K}"
+	.ascii	"\313\005\337\310\0302\320\3672\224\267\254j\205RW?\233,&\332"
+	.ascii	"D\311\254\201\366\340\003M\250!0\307\020D\310\320\220H0\n\024"
+	.ascii	"$\305\006\220\002\231\251:\017\020pf\2344\006_d\360\2409\375"
+	.ascii	"rc\001^\232Z\207\r\315\"* K2xW\317\322\233(\330\021u\027\304"
+	.ascii	"\320\032\267:c\202\246\003\177Y\334U\004@\305S\345\022X\353\362"
+	.ascii	"\257-\342\320`ht\200A\213P\271\024\222\025]\002\216\246S\331"
+	.ascii	"\210\364\370\027\270\306\255\342\336\322z\215\341\317j\260\341"
+	.ascii	"\332\025\275\331D\221\245M:\271\217\356\207[\322\200\314:\261"
+	.ascii	"}\003\263\255\205\271\271^\205\271\277\020\214\250\n`\232\201"
+	.ascii	".\244\210p\376\3248\231\n"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.88.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\022\004\345\030"
+	.string	"\206n\235F\260\032Q:\270\232\247AM\354\267\0301\225\2666\346\326iM\274\217NO\003\215|\027v\350\352\331\336\377X\345\241\233\253\363\364\303\007\351\016\357\016?\005\316\206\247s;jsgP\325B\037U-\3647\"\211\224)\005\207"
+	.string	"v"
+	.string	"\221"
+	.ascii	"\376N\315\222'\n\224bD\021~\211\274=\302\361\334\257\273f\346"
+	.ascii	"s\355\277\307\211\214\322y\347\252\251b\211\333\224\240\001\247"
+	.ascii	"\257\317\343C=\317yw\362I\301\262%Q\311\022c,\360u\200\323\327"
+	.ascii	"\365\034\360\373}\005~\335cc\271\256F4\321\030r+\352\022c|)\215"
+	.ascii	"\367\374\323\354"
+	.string	"\361O\364\030\334\217\317\277\025\327\317\305\204wK\375\324\276\026\320\213\336\211\236%~h\231\246\0061F'\356G\305\275\267\355\3006\001\373c\021\265\364b\037\310\203T\360o\230\304\205\013\3407U\200\215\026\306\360\242\f\247\030k\b|\037\377\261\301\277\361u\314C\036\367\365=\200\337+\312\310\225^n\226\241\255\243\245\316\260\377E\005\262\237\273]\327\335\255M\353l\232\265\351\234M\343lz\265\351\233M\333lZ\265\351\232M\2476M\263\351\231M\243\300\264\314\227\216\331\364i\323\246M\203`z7\375mZ\277t~\031>\002~]\2529\266\3548\232eh\340K\274k\325\2101&\360\223\\\t\204\b\022$\200\337\226j\016-\275\243\217\006\211\b\033\345q3jO\240A\351\214\214\242bTF\177\013sT$FQ2\224v\344N\352\033}\347\335\b\033\331\b\t\267\244J\223\332<\260<\356\244\256\232\372\330\273\237"
+	.ascii	"c\002F4\2030\344R\213q\266\003\252Io\023\242e\350UP\363\212-"
+	.ascii	"\313\352u\f)\335\302\\\205<\305P\022n\351^b\204ATg\244^)\370"
+	.ascii	"\240\022\0324\304d_\b\036\021j\330\001\230\354\005\263\360\342"
+	.ascii	"\200\201g\303\013&\373\360:\260r\254C\005\331\013D,&{\241t\263"
+	.ascii	"\177Q\201\374\200\to\2464\177j\245\312\r\030\325OG\225\2458\252"
+	.ascii	"\243J\304\346\202\246R\226\232\220lB)\305\321\007\345\222lB9"
+	.ascii	"\232\344\035N\224\023}U\204[\232\001\2554GA.\264\f{\274\030Y"
+	.ascii	"\265\030g;7\272R\247M\213\215\326\350\215\352\021[\220KUj\003"
+	.ascii	"E\245\013l\2644\2455\274\224\242dl\351\265\230e\330\344N\274"
+	.ascii	"\003 \005)\037F\250A,\346\024B\2101\242\244\260$-\264\030\240"
+	.ascii	"\002\021\2619;\02101c\214\211\220*I=\032\003\323i\223\324\250"
+	.ascii	"\244h\253?i\372\375Fy\003L\324\214\006\016\317\325\300\316\277"
+	.ascii	"\241'\221\005\246|\016&\235\350\002t\224\001n\006\333t\343\377"
+	.ascii	"\243\021\224\262/\320\0344\316\n\310\345\262\034*T\270\335i\227"
+	.ascii	"i)B\251\002\263\320\224W\336T3\376\033\367\215C\276:[\005Mi\316"
+	.ascii	"\301\235=\0212\232,X\221h:p\255\270\305\202pz!\305\325\"*\202"
+	.ascii	"\336\n\245\353-\310%\tF\345\344T\336\024\222\252\001"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.89.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\343\005m#"
+	.string	"ZA\364\rE\220\234M:\244I\307\002D\204H\006Q\326@\261TbH\223]\212\211\013\270\211Xf\211\016\2524n\370y\"\276\025H\220\221\213}\205I\210\\\273\b\244\017d\362\322/\f\344\324\177\212\214\224l\223F\244I\231R\311"
+	.string	"\266"
+	.string	"\321"
+	.ascii	"\276\330\255\374\212]\332\305\305l\343\ns2\347,/\332.\354\362"
+	.ascii	"\242\236\312\205.\253\034\214\3670\030d\025\026i\205\315\020"
+	.ascii	"\002y1\251\026\224A\316.$\320"
+	.string	"\215\326\331\2343\301E3 U\355G\271\024\336\277fX\234\023\210\234.s\006\027x\211\274(t\243\361\242\236h\274h\236-\347\301\"\323F$\355Jxg\316\231[\"\347\275\304\335H\333(\326Vy\276-\302\r\230U\365R\tg\213 \004\207\217\337\320`\365\360\302\342\241d\r\301\026\231\034G\203\345\243ftf\b\234\013\257\344\205\245\245\266\035\037\257~*\352x\r\227\245\343\013\224eUK\232s^x\265\221\345S\265E\230sZ\201Y8n\237\333\216b\033\205-z\005\232\346!M\232\0271\332#\236\364\300\335\013_\006\311\302\302sf\265U.\372\331_y\r\312\221 \023;bh\005\326in0\243.\325\025+\337\002{=W{z:\264\255\315\233F\002\373\375\327\224\341\017\212O\207v\320\247\333e\2776\227\253\351\301\233i\325K\253Vz\330]\340_?\201U#\225\352\001\245\372H\325\002Hu"
+	.ascii	"U\033\001\251\213~\324D8\365P\251\006P\252\205|\324A\252\006"
+	.ascii	"R\365\217\217\332G\325\245\252q\245\372F\252I\234\332F\252GR"
+	.ascii	"-\342\324\265\233zU\255\244\372\b\206\306\316@(\233\363\3060"
+	.ascii	"\3174\023\307\224<\370\207\335\246\243\326\354;A+\2646\341\357"
+	.ascii	"\214\304\343X \341\004\355m\354\r\3206h\222\345\211\226-\301"
+	.ascii	"\333,\232\330\035\264q\273\2545\245=\222\254\255]Z\244\265\361"
+	.ascii	"\263\345\036q1\001+\363Y\333)\276\306\202\201\"i\256\346B\013"
+	.ascii	"\f\030\306\333\372\254(\374\231)\027\315\201up[\356\177[\276"
+	.ascii	"\262\233\031\314\224\311L6^\304-\223\021\247\2271\227\007\376"
+	.ascii	"\230\223\311`k\330\240\007n\030/\336\366\247\211\020\317XO\207"
+	.ascii	"5\221\\\245\3252W{zbX\220al\253dZ\033wi\257\340\342\216\253e"
+	.ascii	"~{|\356p03\034\370d/<\220s\316\037Q1^\024\367\366\325\273\227"
+	.ascii	"\217\251\360\217\370\003\b=\360\242\017b\237\306\215VO\207\327"
+	.ascii	"9g\325n\227u\343\356\223\200\275\261\n>\3414u\202\352I\227[!"
+	.ascii	"\245\323IA!Me\b*\021\025\305\242C\211\025O:\235\324\004\250\035"
+	.ascii	"P\024\325\023\207\023SQ;\023Q\034b\354~\f\345\004\265\313A\231"
+	.ascii	"\310\255@\361\244\313A\355\246rND\226b\021\265\313QII\355re\260"
+	.ascii	"\367\332\227\213\303\027\263\336\372\\\232\313u(\212\231\325"
+	.ascii	"V\341\226t\300\332<)\274)z\240\223\314\345\276\032>\314\246!"
+	.ascii	"\f\207r\254\346\354\0358\332\001\373\237\227\200=\332\307\371"
+	.ascii	"\235\005X\001{"
+	.string	"\tG\013\021`\203\320\266<\371r\030\0327\226\334\266\313Mk\264;02Hk\264\027^\177\350)\332&\246-\332cy\2054,e\277\264'\001n\231\221\333\345\237\302H\264$\300\334\330\023N\207B\b\2429Ck\343\322\362D\013\3002\231\021\332\333\002\330\377\226\004r\250a0\004\rCH1\021\031I\213\322\214\001\200\002\0311\263\016\020XV3%\351\304\344p\320Uc\253\">cPS4\257\206T\245\374\206\"\216-u\b<\351+w>\227\306\003\354~89\312KB\226%\212e\032\b\214\327\263ht<:eZ\021h^\372K\202\325\373\0368\274\223\177\304\252(\3432\nI%\200\234$\231\300\221\201\024\301n\021\210\274\303b\205\221\347\263\355\343w\210@m\t\373u\202\224\230V\r\025\343\376\240\327\013T^c\260\t\226\370!\213j\326\211xf#\274\300\264\025\202\331\026'\"\271\246\227\270I"
+	.ascii	"\373M\230Ti$]J\004Dg\326\337\215\334</\321H\243\3418\033\"\222"
+	.ascii	"U=\354\021i9\334[\367\312y\326\322\021\034\345\177r\352O^@\370"
+	.ascii	"\017\0362\345\361\322\237\232\030\257\370 \351F\361\037"
+	.text
+	.section	.gnu.lto_processRcInterpolation.90.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`4\f\265="
+	.string	"Zi\004\027?@\344\316\030vU\206\032I\253\210jb\031\243>L\244\343\023\213\206\242\204\033"
+	.string	"gR\005\372\330\0030\222&\341\007\354"
+	.string	"w\262?\215\023\237\035\262)\r\021"
+	.string	""
+	.string	""
+	.ascii	"\214DDD\204H)SJ)a\001D\001c\001\274\032\235\277un\rHT\326hx\363"
+	.ascii	"\276=\252\201\336B6\360I\357u\327u\3475\353\253\277\267\314\315"
+	.ascii	"\334X\270\371X\311\235\245\265\330\350=\036<\216\231\035\275"
+	.ascii	"p!\264\363\276\357\326\261Y\251\265\231mp\333\265\036+\271\357"
+	.ascii	"\032\317F\347\3258\276`\216e\\\346\016\034\233\025\352\243\266"
+	.ascii	"Y\357\242\266\331\256s\217/\024c\337\033\235\235\367\315\273"
+	.ascii	"j\226\001\034\233eF\240\300\006\273\235\347\326\243\345\002W"
+	.ascii	"\266\347\347}\363\234\257$\211\327^\363\232\231\357\266S\023"
+	.ascii	"\323\222R\022\322\221\321S\021\321\220PP\223\271T&\221Gc\313"
+	.ascii	"\256\357.\267\0253\200\322\263\261v\252\353\246\272+\316\344"
+	.ascii	"t\2754\327JtzL<\351I#9\351#'M\334\250\237O\372ie\232[\251\354"
+	.ascii	"\274\210\b\256\207\340\336\\\310\255\203\326\002ji|4\0333\267"
+	.ascii	"\365h\r\022:\255g\304\233\353\362PNH\2631S[\023\244\371\0356"
+	.ascii	"\237\020g\032\271\222\240\025\351\345\324\032\032\221V\022\031"
+	.ascii	"\342I#\027_[\021FYC+\322\3108\2634?.\231\2123\233\272\261\345"
+	.ascii	"\320\2065r\255t~\200\322\263 \275\336H\236\221\265GK\006\341"
+	.ascii	"\242\377l\314\254\254R\357\373\266^{\2163\250\273\221\353}_v"
+	.ascii	"\351\031Z3T3\373\003f\266\300\234t\013qP\257\362\372\354\277"
+	.ascii	"\2322\352\223A\364\0313\353\267^_\2711T\274\013\323\314\305\032"
+	.ascii	"\341t\215\366?\302\277\232\250\032\264\007{L\rn&\034B\204\210"
+	.ascii	"\266\331\177&\233\233\271\351\323\253\334_\232\210Z8\346\213"
+	.ascii	"\016\020\323\336\326o\013\344\026\303\211\253\341\364]\372\276"
+	.ascii	"\200\334`8\361\350\375\3246\213\007\345}_\253\376c\346\304\365"
+	.ascii	"M\231\367\035k5Nd\227\2768\376\240\274G^\253e\340b!\231S\273"
+	.ascii	"I\237\027?\377mL\242\355?\221E\016\231\377a\346\021\335\205\304"
+	.ascii	"\361}\311\026poi.%\270\2314\313&\272\274\245\315rw=+\205p\356"
+	.ascii	"\356\351U\346<\250\177\033s;\232\036A\356\360\2631c\240\260\025"
+	.ascii	"\001B\3575k9\273\2569\253\363\232\261\222\316\006Z\347\253\245"
+	.ascii	"s\201\245\263\325\322\231\200\322\271J\351<@\351L\245t\026\320"
+	.ascii	":\007H:\003H:O5\235\245\232\316QIg\250\244\363\023\323\331i\351"
+	.ascii	"\334\244tf2:/\031\235\225\222\316ILg\244\245\363Q\353l\264t."
+	.ascii	"Z:\023-\235\207\226\316BK\347 \245sS\351\314T:/[ge\3229\211t"
+	.ascii	"F\"\235\217Hg\343\321\2715:\263\255\007I\257dXF\265\362\243g"
+	.ascii	"v\237\270Q\332\226\"\275\024\331\217\361\037\305\243\357\276"
+	.ascii	"8\335,|\023\fj\2675\372^\313\022\207\314\377\360\221s\355\214"
+	.ascii	"\252\244\360\231\2336\277\215\017tYRxV\016\362\252\265>\307\332"
+	.ascii	"<\330j\275'\226Q\274\313\3034\320ZO\341\333\351_\237\250\032"
+	.ascii	"\324\253\276,\372<\f\030\005\007\217\f\366O\212\207\350\207\276"
+	.ascii	"\350\233\324D\317$\237\350\233\020\243v\204>\350\207\336\270"
+	.ascii	"\030\205\002\265S\207\206;'\364-\370\026\370\364\252\253\326"
+	.ascii	"\210\fx|\337\267\001\367\234\246\343Nq\253\270ssm\263A\317\024"
+	.ascii	"\3243\027\370G\371mW\335\374\2163\320\314o~\227M\265~\371\314"
+	.ascii	"\357(\025\352UV\376\362\273\214\372\204\323q\\\367\212k\347\332"
+	.ascii	"\265\315*\277\371\232J\260\216\236d\362\271\r\373\320\305\213"
+	.ascii	"!A\202\024\017\362\223\277\356)\243\036\337\370\310\357(\035"
+	.ascii	"\233n3\241\302\205\013m\263\307GN\261\336\370\235\346\357M\031"
+	.ascii	"\365*\n\236*\262F\213\365\016\222\324i\036\323\306p\361\370m"
+	.ascii	"\334{\206\360h"
+	.string	"\267\276\323\250\260\020\276\021\323x\254\021\036\353s\204\265\355\213\265\232&\f\313\260aC\333l\373/\210\250\b\310\270\344\314\035<xK\267\036JL\224B\350\217q\373\365R\314\220\302\366\333\3104\373\020\276\243\001,\276\300\300\272Tx\031\277`t}P\361\342K,\305\327\207\031bL\026_``]*&\240\370\202\321\205\302E\214&{ey\2119\275R8\301Vt\265pz\211\275pf\025q\230\213/1'\214\26001\2472\357\331\317\346\374&\020\271\302\347C\235>\211\273\271x\f\340(\341A6\003\0374\330\327\314\347\371\267\326\244\327\307=A\234,\271Z\363\232\344E\332\3719\256>\205\257]=\273\327\2478\335\303\324z\320P\221,\371\216>\202l\343\263\242\307\217\322\267\261\2023H\030\036)\344\211\237\312\372\276\357\233\364m\355\266Y\217\341\3333\200o\220\2060`\224\233\013\351;\300j\201\2372\340"
+	.string	"7\017b\365\004\276\300\267\210Q5\350\017\006<\272\017\253\357\275\267\300\247\024G\3633\002\217\324Rm\277C\271\264\243\252\001_E\365\002~@\326S\005x\001\336#\300\263\202T\305\351\247\371\035\306\0315\037\312\245\201yz6v\361Z"
+	.string	"/\226\205P\007\200G\272Y,\232z\251\324O}\265\332^m\324K}G\325\240>\312\320\313\240\036)\330Gq\332\317\037e\002\021=a\371\r's\372\247\246w\372\216\0222}\323+-F\355,=\323wU\253\364K\337Q:\037S\3726\2143\035\352>m\364\004\224T\021J\372\252\213\267\345\266\330TW\311\233\013\007\207\364\001\200\370\250\201$\007\221C\210hD$I\222Bk\240\002\221)\242\252\003\021 )d\220\021M\222v\003BhW\214\377\350lX\337\b\271Kp\376\230\004\326Pb9T\221\026m\344\3004\3369\224\213\272u\226\021"
+	.string	"\231L\202 \257\316\373\367"
+	.string	"\206\r\017j\007-H\033\347\fd\360x}\346\002)N0\021@~v\212\226B\3337\035\246\202\027\316\345y\312\013\t\023\360Sn\343\332\257 \210,\270\017\212zr\f\3466+(\304+-\353\206\264\301M,!l \373 \313\357\342\362\261\205\250\021\217\301\203\217<\217\371\373wb\217\374\227m<X\217\273\270$\2009YK\3477o\214o\272\255`o\254\r\f\224\001\007\006\334:\212K\330\214(5\211f\3255@0\236/\210\007#-`\237\224\237\264If\267\217\246"
+	.string	"\266\265\316\344\004\237\007\226\275]\313\322\276\221\206\364dY\023\017\322\256\301J\020\030\245\246\345\323n\266j>^\203\306\025\bs\314\326\031\325\241H\321j\231\3427\001F\263.\326\224\201\367\300^;\340\223\267\017\2517)\303\254zs\366\275\317\217"
+	.ascii	"\350gO6\211\276\371\207\220\202r\334x\022x\t/\321\265C.\301N"
+	.ascii	"j\335B\205\214E\202E\247\265\322U\311&\271\211\230\346\\N\215"
+	.ascii	"(oI\002\210\200\253)\263\342\r@\007&\274\251F\037\340\020\207"
+	.ascii	"P@\023\202 \316\312\215\317s9T\224\f\263j\226\365\311\036A\354"
+	.ascii	"A\235\302nGm\310\260\n\3169\022\032\340\231\247\327d\024!\251"
+	.ascii	"T./\355y\337\006f\225I=\202#\364B`\323\367\261{E\022z\307\264"
+	.ascii	"m}8\363\3111\034\213S\035\027\253W7\243@\323\344!\221c\252t\351"
+	.ascii	"\251\241\261\216R\253#Z\246\333k\350\031\247\252\367\371qsS1"
+	.ascii	"\252=\367\232{\2637\002\311\250\0305"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.91.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\335\f"
+	.string	"\366XZC"
+	.string	"\2614\035CN\277\253\334\300\371\364A\f\305\002\031\347\254_K\353\"&S3\f\361m\260\016\033M\016~\207\b\021\255\340\236\204\320WS\223\027p\0050\313\307\004O\307\334\033\357\364\024\321\250\t\331R\246\024F"
+	.string	"G"
+	.string	"B"
+	.string	"\237\361\354\033\030c\276\273\210Yaqcw/\003\027@}\202\007\241>\251\211{\207\232\236\337\361\211\016\255\226+$\3402\243\005\300\247\002\021\344\224\260\361\322\223\345\033eV\237\335u\222>\020\367t\333\016l?\260_!\257\371\341\323z\232?\237\276g\200N\016\005\030\273\037vt\026g\212\221\302\266g{\3305\034\376\261\243\03226\r\0240\360\036;<\026\020\021gd\354F\021/x\236\3067\366\354\222ha\263\273\">`}\262\355\257\b\237\024\035A*+UM\265Q4P'Y\372\322?\036Td\250\225V\223\252:Wr\244\344N\242 \271\340\250\3028\344\251!dN\224h\250$\016;\212Ra\354\303\335]\353\213\375\264\365t\365\370O\001\334\326e\030I(\244\231`\350\266\r\024a\353P\260"
+	.string	"\t\272\023\rM\320@%\0224\020\306\221l\200p!\003\366\341l$\343\256\314\302eR\202\201\256\214\013]# \336N4\356\352\266\215\273<\342^_\374\322=#T\274\310\220[-\275\262\250\003\022"
+	.ascii	"y\b8\323a6\0135\306^\203\320\334\213\370\242\216\343\246\027"
+	.ascii	"\226M\3015&i\002\004%\301\025}R\b*\264\002\250\214M5M\003SP"
+	.text
+	.section	.gnu.lto_rcSmoothingRxRateValid.92.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\265\b"
+	.string	"F\021?90\345(\035\215\223A\305\311\2140\266\231\203\207\334\306\240)\221j\n\0236\236\357\266V\177\303V{\206\357T$h\034^\031A\202\313\321Xp\214\211\313\315\240\243\021B\244L)."
+	.string	"/"
+	.string	"*"
+	.string	"\266\025\026J6\335\363`a"
+	.string	"\230\250J`\273\036\324\216\233\236&\377$\327@T\\V\255\323\023\323\260\273\316U\313\342\326\333F\260\315`\373\025\337\f0Z\034VvY_\200e\321^\037\266Kv\306v\246}\221\217\224\3562\212\005v5RNv7\301\007\001\3276/\330\256e\327l\327\034[j\246W\205\f|\037\354\342\244\355\232\372\212\214T~V\275^\025C\345g{\247T\016\373\331\356\256u\303\331]\277j:5\035\335\310\323y\020u\361\323u(:#P\027\343\004G`\216\303E\310} \b\302\023\001\271(\202\034\215C\022]\204\243P(\302\214\267w\246\033\224\246\234\261\227\223\002\b"
+	.ascii	"2\003\302\260T\270\033\233\226t\031\245\250\361P\035\302\230"
+	.ascii	"\256I\006"
+	.text
+	.section	.gnu.lto_rcSmoothingSetFilterCutoffs.93.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\007\016uA"
+	.string	":od\030A@\242N\007\027\266\362gfQ&\263\177\364R\335|\274\243\236\346o\377~\365\024\036\235\005\371\354\016\334\305\372\331\211\301\237\021\027k\013\365\214}\\\240\211\2368G\315\2528\232\"\275\2447\331{'\231Ry\001U\001w\001\355a\332\365\312t\237\0336u\361\306\310\321r\363\336;\211y\\\214\343u\277}\303\303\364\322\216\017K\034\307\357\215\356\327\331\367/~\327/\030\257\203\335\016\207\0336-\222BY\243\030\3071\003\327\331\246\225\316\273\300\356\005\314\215\315\270\3211l\024\343\230\316\351l\027p\235\r\312\236\273}\316\267\300N\315\341\3148^\222\307L\034\323Y\265"
+	.string	"\327\331\246\363f\353\254\353C\255\263\rw\317q:\267\330\343\244\211\326\345\211\343\370\371Mz\365\225\316[(\303\276\244\224\204tdT\324$\032\022b\006\001\375,\225o\022\351\036[v\375\f\267\037\267\220\322\2630_RZ\233\326"
+	.ascii	"F=p:\2672-1Ru\270\251\226\2344\347H+\225\342\231E\207\233fY\233"
+	.ascii	">\246H\375N.\037aq\2437/Z\223\002\247o+\024\336\224\334\224\222"
+	.ascii	"\211\260D\311C\253r0n\210\007N\241\254\b\324\362\006\325\262"
+	.ascii	"\020\223\037O\234\031\004\344f$\377\034\267\226\307\255$?\234"
+	.ascii	"\270\262H\340\224H~\327\326&\247\300)[N\006N\235\300M\207d\244"
+	.ascii	"\236;\301M\241\3648\213f\327\305\236\370qm\006N\323V*66A\242"
+	.ascii	"\271M\236\tq\026\315\3275\211\215M\220\237\263\262\025\352\215"
+	.ascii	"\0229\236G\226\377\347\f\2726\305q\354w\236\315"
+	.string	"\316\306r>n\305q\334Yz\366\303\033\200w\347fw7\350V\272\005\216\307\tu}\366\331>QF\020\276f}\022h\211U\252\326\237\235\277\377\266\346j\377O|1$\313z\272;\204\243\341r\377Y\301\304\036\341~`n\034\307Y\355}pL\"\2520J\216\326\331\255\177\3019rT=\207\256%\036\211\273\03546\252!\213c\261\247\374\r>\223\201\302\215\345\306\366\317\357PE?\343{%\332\243\264\211\256\354\322\256\326Y\377\267\f\261\232&\226\033\273\351\306\362\267\355y#\234\322\277\244\333\315\315\301\315\275\301\315\255\301\315\235a\231\333B\005\n\356\305{\313\251\356\016\334\316\273A\226\233;\301\233\033\313\315\215\340\315}\300\315m\340\230\273\200\233\373\271\314}\225\314m\365\346\256rs;\335\334T\311\334Snn\251c\356\250en\002\307\334P\312\334\003\332\334Oon\001ln'e\356\24667\323\233;"
+	.ascii	"\233\033@2\367\2222\267R\233;\251\315\215\364\346>R\3466js\027"
+	.ascii	"\265\271\233on\242d\356!dn!77\323\315\035\344\346\006:\346\376"
+	.ascii	"\3612\336\313dn\345\233\373}s'\335\334H7\267\233\314}D\346n\335"
+	.ascii	"\334\3541\367z\314\375m\356\314\346\366\016I\212oH\374\305\261"
+	.ascii	"\217F>1 \273\367\346e\334\275\270\333\371w{\007;\300\002\274"
+	.ascii	"#\032R3\024\300\037\375\352\252i@K\231l\351_+urG\342\251\"5g"
+	.ascii	"?I\257\364\226c/\257k\204\2578\033F>\245?BJ:z\244=G\357\240\214"
+	.ascii	"q\031\225\213\336(\016\256\222]\332`G\332\363xi\271I\1778\036"
+	.ascii	"\370\212\363\271\305q\274\300\331nX\316\027a-\316\346\031\375"
+	.ascii	"\261O*\304)7\370\346w\303\\\036d\227\026}S\331\2075\3217\377"
+	.ascii	"\021\241\212v\300\210^\253\254\217\362\333\n}\350\235N\213\241"
+	.ascii	"\177\253\360\251R]\267x\032\307\361T\321\037\035\300\260\334"
+	.ascii	"'\357\375\266\366\027\255\320;\023D\017B\217\024\304#G\365\274"
+	.ascii	"\301\270\264$\363=I\225\007=\363=\232\226\365@\037\364\016e\374"
+	.ascii	"y\240\367(\343\241\307\341\202 !\273TB\353\354\317\273\236C\241"
+	.ascii	"-V\323^-o\220\n\262E\253\374\2573\301\t[(\231e\f}\252\2726\347"
+	.ascii	"\272N\357\265u\372\362\315\332\233.\314{0N\315\314q\353\337?"
+	.ascii	"\361\345P\020\354\375\267\267(l[\250\355\272f\260`6\027\325{"
+	.ascii	"\247kx\263\356\344\303\001s\215\\ZG\303'\337\357\334\331\227"
+	.ascii	"\370\205\360\216\221U\312\354\273\217\374\366\274\013\030Z\227"
+	.ascii	"f\370\366\303\006\300\341\361\255NG\276\3479\323\313a\027;p\334"
+	.ascii	"hp\300\356{\026z\237\033\362\221\324\343\273\357QF\017m\373\307"
+	.ascii	"\2751\016\336\306C\373\001,\374\003\212\254B\305W\r\033\020P"
+	.ascii	"\270\370B\232\250a\"\202\027\f\026+j|}\275\240\261\354\256\253"
+	.ascii	"\256\031\317.\025O\030,L\274xv\315\240\361\274\032\352\257\030"
+	.ascii	")f<k|}\315x\276tb\376KD\320\001\024\373\261%\0059\001\020\030"
+	.ascii	"\215\354\303\032\353\023\374\201C<QF\2518@\252R\205\307z\035"
+	.ascii	"pX\177\364\363\253R\367\370\272TI\302\312\317"
+	.string	"7\360\b\324\340\265&\350\207\365\201G\360\006v\340\023\030\026x\003\357d\340\"Y\nW\201w7\206T\013\377$\323\350)\332\253\267\360\235\243ic\271\361\t\214\344\352\265\026\375\244\326\264U\221\254\376\204[\013\253*GE\033\336\361\232N\347P\365L8|\225\025\023\2761\302;F#\251\247z\347\267\343m\020Rk{R\344|\307\313J\272/\313\355\317\371H\352\324S\371\324{t/\352\245\276\025\2142\202\310G\270\242^\006\224/@\234\252\234\246\303HZ\002\377T\330H.\002#!\360\236\347\204\350\333\3228\324\237\200\225\3445\250g\027\365\252mY\215\311\255\302\323\242\236\334\320\267\265\353\271\363\220I\341{=.?\353\315\272\257\315z\237\343\356\253P\225g=\205\36797\204P\266\261\334\230\231N\377\364\003\232\240y\271]\020\370\212\267\001\3227\340\217\020\005\374\323\231\200\3679>\234\276\265K\223\026\344\314"
+	.string	"\236\351\233\240\300R\240<\274\274\2560\233\025f)_a\323\037\265\t\360L9\201\005\250Q,%\025ejD$H\222$\031\326q\005\304\030\346 \264\033\021"
+	.string	"\245T\016\325\220$)p=\003\343\3215\234\234\301'>\221\\q\366~\003a\256@\362xS4\360\237;e\005\301\277\247\262\201\257\240s\243$f}6\321P\340eT|\373\345\rM]7\315IE\201/\252\026\256h^\241\273/Hp\177\311\275\350\267*\322\366\224\313\031\366\210~FB\337\267\277\004;-\006\227\224\004\231\341DBHn!\225J\341\203Bl\201\201\rr\207E_R@y\253Bxn\b\202\340\343+1Y\005\302\325\372\332\230\275\037\222|9O*5\300%\245\024&;\205\031\316\357\257+\307!:<h\t9\343\203v\035\341\370\307\254\356\357\032@\205EK\215\252\232\330\223*\032\254\001o\332j\252\030_}\242\242\212?\276$\302j\317\034\027\312#\026\013"
+	.string	"\031\264N\361GF\342\302}\177\323\274\310\332\327\353\310I&\226Z-\331rH\274\304\350\203\2161\222\220\261\261\016\374\252"
+	.ascii	"(\320\374\260\007`0\335\314\3131lt\353\317\325\036\274\264\205"
+	.ascii	"I*\331\021\263\0049\232\243\316\242\262[\222\030#\202\\\027\327"
+	.ascii	"Z\247\005?\003\266\223/\271\333G^\nE%Q\203\210\232\020k\220\016"
+	.ascii	"\364\376/\223c\300(\224\366|\026\376\300\001\220\304\255\205"
+	.ascii	"'\372[\343\f\231\311\031C\352\377s\343\0048\230\355\272\244n"
+	.ascii	"/\200\036B\202\372~B\350\241K8\202\243\202\205\373\306N\013\223"
+	.ascii	"\225\343\3078\342\277\034\211\244\361\334\221bLo's\006\325\243"
+	.ascii	"\b\253"
+	.ascii	"\312\035d\016\b\314;\342GG\027\270V\354\310+[G\254[\221'\344"
+	.ascii	"\205\232\223\221\223\t\225z\210\034\232@\321\373\317X&p\n\207"
+	.ascii	"\320k\034!\204t)\354<`\220\266P\032\345eU\037!z\220]\003\250"
+	.ascii	"\312\036\203\325\215\243F\271z\200\216\031\312\367/\020uFe\256"
+	.ascii	"\255\350\t<\354\330\243\330*v\315r\002\331\212N\r"
+	.text
+	.section	.gnu.lto_rcSmoothingResetAccumulation.94.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\205\n"
+	.string	"\366\222F> \345*\035\300K\202\227\307\t@\237Bx)\022\215\230AC\f\261\224qsD\235+\304'\240m\230%Xl\245\225\250ox\304D\bD\036\t\305\345\241\001\315\t \004\325m\215\004\221\235R0"
+	.string	"2"
+	.string	"8"
+	.string	".\037\002\377u\016\002\377\231\264\001\274\234\355kF2R\314\335\255\236\307\311S\322\177\311=/X\353\224\223\260\273\246/\330\306\355\335\266\310v\265O\021\247]\266\250\327a\177\263\273kOf\337\366S\316g\326\024"
+	.string	"\201\333\3258w\233\373b@>\266O\355\327NB\336\306\372\300\256l"
+	.string	"\314ny\340\202\316\277)\320\026\337\222b\341\300\211\350\fn\253\276b\031\025O\b\215\251\273\331\246\"[\342(\276\021\314\354\211\237Ttv\027\301\304\342\"4\373\370\347\263\300\177$Z\200X\315t\321\245UI\301\001ezX\211\342I%\340p\024\2165l\250(S\351T\303QUG \213\021\fc]\211\342X?\345~\263\236\314\013\260\234\313\303\260O\177q!\321v\261\232w\236\017\025"
+	.string	"2\241\267/0.\016\270\003\214\253\225\352\254n\202\355Z-R\007v"
+	.ascii	"\276[U\023\302U\027\2331\366\220\236\025\007C.\3016\253)\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_rcSmoothingAccumulateSample.95.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\365\005\205!"
+	.string	"6~\323I\240\230Q:\301k|\232\016\270\316\276\\R\321\372L5\323\375\020x`\375\332\315h\302h\230`\016eV\237\177:\\/u\371\005\035\243\311\364\324x\n\324\264\366x#U\257//U\207O\312~\346\340v\240}B\210\334)\005\271"
+	.string	"\261"
+	.string	"\310"
+	.string	"<\374 \216\371?\016\004\352WN\257\277\372\372\345\305\022d\255\302\242\233^"
+	.string	"\273)\243\357qb\207\363\360\232H\332\250\265\306:\330\261\233kC\3311\333+\274\016\250\357\260\261\224\325^\212\026Dj\255\005l"
+	.string	"v\263VRj\337\3529\240\036|\372\221\325\336\020\004\221Z\205\005,\004\273i\341i\347M\330y\316\233\266}"
+	.string	"\001\224w\027V\215x\035\205L\365\330\252Uh[\026\337\3754\313\245;?\352\347\212IV\301rEe\342f9"
+	.string	"\370\244\004\016\225\257\244MI\321\345\003-K|q\250\244\312Z\255\365\303\323\020T=J_G\265V\323\037\025\211\373u\333\032l\037\331\247\202\306$\345\236X\230\004w\221\034\371O\213\356w\367>\240\024\355r\200\245[b\371\220Nz\021\027\201\252l\245\023\311"
+	.string	"\253\265&(B\310\321\252\\<\2357\277V4l"
+	.string	"s\004y\264\313\026J\321]a\277\254\253\202h\251\207.\344\026Z\352\332R\007\375\352\006\372\216?\300\203?"
+	.ascii	"S\373,u\317R\323`\324\263\223\232\347\244\336Yj\235\223ZvR\347"
+	.ascii	",5\316I}sR\333,u\314\3245/j\232\245\206\275\250_K}.\265\271\324"
+	.ascii	"\345I\275'5=\251_\364,\341\026\030\r_j\035\321e\246J1\215\304"
+	.ascii	"\270\220\377\352X5\236\254\366D0\221\361+\303\331\234\025\200"
+	.ascii	"\345C\006-\016\n\343O\353\307\3276\310fwo\366>\031\261\265\331"
+	.ascii	"\237,\037\222hc\r\266\216c~Z]]CK\264\246S'\016\343\007\224b\356"
+	.ascii	"\n\323=`s\303\311\020:\273\215g\317\206\350Ys\177h\214\031F\351"
+	.ascii	"\3212e\271+(\255\265F\355\252\360\356\254Y\033\034\303-=Z\306"
+	.ascii	"v\205k\331\301^|\226\234m\341\211\376w\263fcI\274\334\240\331"
+	.ascii	"+V\206\226\006\266C{_Rha\267W\241\"\264\307\"\023|\255\024\247"
+	.ascii	"(\265}\355\207\237aMq\361\316\255\355}b\200\366\\\333\231).\334"
+	.ascii	"\263\234~\346\311\223@\373 /k$\351r#hn\023\033\231\020x\271\346"
+	.ascii	"\226F\037P\n\351J\0347\013\224I\002RN"
+	.string	")\002R\356\246k\340Awsk\2721H\332\240\204\241ii)\307tc\234\021Ng\303]\260mP\272\345l8\035\223\315\210\307K\034\220t\266\246\245%\235-&\344\275\254\253\302\347\221\213\217b\371-\377\360\016\216Z|\024\315\177w\372l\b\333>\353#\336J\2356\356\\g\036\3140\003\264J:\235'\372\3662NdLD\261\221,\372\211F\372\030\033\305\320\320\200\262\225\344\025m\323\241\023\235\3640'Z\351Z\031hU&\236\002\231\201\004Zm\321\326\226p\244\2150\237\331\322\326\314\232\342\232Q\236\265'P8\377\233m\255\267Q\336Y\331\362\354}Mtvg\315\243\321\313\325\331\227\221c\227\017\230\2637\001g\250A,\007\221a\204!\031\032\005I\222d8\240\"\221\263\321\003\021\300)\023\020\021\215\244(\205\354\006\303\240\330\216\212a\320\bT\004\347\345\371\225\333ys\252\2758\271\221\353\026x\200"
+	.string	"oG\0065(3\271\354\037z\275%\006\364\336\351\334\300\016Cm\030\216\277v\224[#\013\214&\310\305\355\205\213\33117\375@`L\307[\233\307\231If#\347\334;\301\016O\3207\211\262\035ER!\243\222c\220nN\023\3419\312\032\270\034E\265\017\200\035\351\f9\273\272\316Q\264\013\340\264\033m\351\037\360 ]*\2120\376\3442\244fb\300\n\277:\374\027\210R\254.\220e\377\271\177\213\312\bV\2664o\236\274i\021\315[V\213\202\252{\200=:)5"
+	.ascii	"k\332-\032\316\025~q\013e\274}\357\017"
+	.text
+	.section	.gnu.lto_rcSmoothingAutoCalculate.96.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`z\001\215\r"
+	.string	"F\331XA0\215\223\016+p\326I\374P\206(\252y\351\276]\311\370\204n uW\233\204\262\3048\326\314\271\bD\r\257\002D\2175\255\235\374\201j)\360\300$\nM\220\360 \365\025\253[\f!{o)S\nF"
+	.string	"E"
+	.string	"D"
+	.string	"\320\027\004>\254\275+\361P@0m(\246\335\316\322\n\327NE\37045\037c:q>\233S#[\306j\302\341\210\203|\022\256\024\037\221W\261\273\037=;\237\220L\312\300\356:9\237\bwu\333\232m\001\366S\002\276G<\274b,\220 \031]"
+	.string	"\311\223\335mRC\366\337*\310\206\347\356\227i\325tf\372\024\206\n\t\005Q\t\005\321\255\347dbU\340\207\223s\277\375\341\217|9\247Ul\272\365\\\210\360\300\r8t\200\352\001\277B\005\231\022\235\330J\372k1\212Z\266R\372Z|\332\311\304\324\fR\b\005G\311lH\305p%OC\271\273\033U\220\257\211\327\f\322\212H\266\330\306\236AS\355n\001\037\303;\016\337\344\320\r<\362\234\303\035\032\231\372\262\2702\353J`-\330@\220\261\256\214\303\262"
+	.ascii	"`\214\201Ffu`Xf]\272\375[\005\371\243\0378y\260\225\3429\334"
+	.ascii	"\017>\205\332\261\r\365#XL, \032BiH\303U3\322\312\306;hRT18\223"
+	.ascii	"\250!\007  \300\002\241\200\3221\302\bM\025\t\217f\217\2079\310"
+	.ascii	"\342\266\221\212\f\007\2755\277\331q\354\007U\\lY{\343\210\276"
+	.ascii	"\3636k\320\"\207\231\221A+F\263\220\234\350\200\021EG\320[\344"
+	.ascii	"\004q\024c\222/\233Q^c\273V\031"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.97.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\371\033Et"
+	.string	"z\271,)N \222\322\032\003=\324\273</\223\025\210N\005P\252\201\355U\367\261n\350W\302\314\265\370\342\0261At\277Y\0306D2"
+	.ascii	"\203R#\302)\262\273V\001\"\034\004\001\b@\324\033\351\244\360"
+	.ascii	"<DD\266\027\211l\227B\235\222l\221$\245\224\002v\002c\002\201"
+	.ascii	"\002=Fg\236\242\363N\321Y\247\350l$:\027\3359'\307\031'\307\231"
+	.ascii	"Ht\276\001\341lCt\036\022\235\2058\316-\321\231%:\007\211\316"
+	.ascii	"\337\320fw\347\356e\263\211\201\r!\023\362zh/\327\025\360\255"
+	.ascii	"c\335\310\332\206\356\270n\266nj7\226\276q\033\037\272\320\033"
+	.ascii	"\3327\314\315\334\\\270\27501\216\253F-#\257\316\2171(c4\206"
+	.ascii	"p\\\330\306\313\312\223~c&j"
+	.string	"\331\322\325\034\255\205/8\003\004\203\346`&\272iaVK\232Y\226nc\"\325\004*\227\225j\330,\033W\207Y]C,dj\372X\f[\312\255\206C\347\260\243\261p\365\210\007\332\353\365@ \016\257\212a\263G\355\3236\033l\236\326J\2471\023YGK\031\206\031\260!:\270\253\264\r\334S&2s\243\241\320R~!\225\002\006E\201\033\215\211\315\242\320gXGYh/\327\224\017m\320\277\023\303f\205\314;\270\243Ll\250;|\237\b\257\220\r\351{_\264\250f9i\330,\363\224\212\035\3546\332\030WK\r\242\264\362\367\276h\307Wb\202\203\035Dk6\276\333'L\034K\220\220\212\202zrjbZ\032\241\224\204t$\302\250\210hH(\b(\304\217O\017\317\216\216\261\230\003b\n\207xc3\024\266l\360\335\345\026&\203\\Yze\365\t0Q87\261\327\307\022(\270\240\220\020\312`"
+	.ascii	"\t\263\rj\r\373\242k)/\301#\273.9\217\232\213s(\272.\376\344"
+	.ascii	"{\355\304\245\233\270D\351\242:\023\227,\276\304\326#\202P`^"
+	.ascii	"^h\237/H\302\254\271R\222P\206[{\0304\3503\354+\206F:\302\262"
+	.ascii	"\003\016.\002K\033\235I\275\350\355,\352D;\250A}H(#\354\213J"
+	.ascii	"\013\325\320A\317\032\034\210\212\231\207 \363\237\034\234\270"
+	.ascii	"O\233\f\336\243\326<14\361\035&\256\023\304\311+\013\322v]K\202"
+	.ascii	"(\232ky\255F\304\215B\031I\276\306\272X\244s\212\250\2019\210"
+	.ascii	"\326\032\353\2516\266(\237\343\fib\020\252O\013\032\037.'\313"
+	.ascii	"\2166\222]\227\020\277\t\3426Ha_Azh\327\305D\212\322\325t!\220"
+	.ascii	"n\225\323v\037^[\316\376\350`\216W\017\242\027\017\377(]C\202"
+	.ascii	"G\357\373v\264\275\005\257\244\273P\306\373\276\354K\257\257"
+	.ascii	"f\024\315\374]\230\331\001f \264d+(\2516}\327\034\034R\3605j"
+	.ascii	"<\221\364n\312W\343\271\347\274\311\0074\242\335\244$o\252\207"
+	.ascii	"\345\346\235\314\244o\276\357\354\276\330\274\223\251\254\231"
+	.ascii	"e\370b,\224!PIm\373\256[\031\324(\251l\3275\005\357\203\223\264"
+	.ascii	"\315\277]\0252w\302w\266/\326\n\277\247\2553=;R\346\016\f\017"
+	.ascii	"W\303\342x\371\022\267i4\266"
+	.string	"f\351\207\363\355\023\3007e`\320Z\236\224\240\273\244\265y\"\251\022\242\013\356t\233b\304\357h\037\323\320M\365\256\004\376\360#F\212 0\005\020\fj\346zm\267\331\002\361!nSH\020\030\350\314\314\bq&W\201\300`3\303\334\237\031*3\273\022\021w\201\251Fi\354\026\361/\367\210O\263^\235\326\236\303\224>0\350\337\r\022\347j\241es\372\n\356\343\346\213os6J\\\005w\211\247pf\37061\370\226\367\030~Q\211\234P\006O\272\026\213G\346\357U\370E\245\\\013\245\327\270e\200lK?\366\333oe\340\224Vce\037\304\233\027k\220\206N\203&(\367l3e\202OL\343\345\371\317\354Ri2n\037{f\351\307n\264\307\270g\303\367\345\261\202;L\213\031\200j\306\214\266\331\377\242\2227\2534\252\231\017h>\256\202\251\0215\253kf\004Z\017\213h\354}\337\025\334x\235\247"
+	.string	"w\223fy\201\006\032h\233\255 *\005\fj\246\033\253\265c\337v03\203\242\271\266\367\214\325\366k0\345\343\341j\230{\256\351\260\270\233\360\b4\274\2274\332f\373\203\242M\300\242L-\2772\243%\375\235ye\3156~1\346\035\354\254\343\252\350\214\243\343\232=hjsU\215\266\241\231\202\037\347\t~\234#\360q6`F\2635\027\320X\232\251\b0:\017`t\226\321\343\034\303\350,\200\321\031F\217\363\013\243s"
+	.string	"8\316.\334\031\200\242s\213\2423\213\242\363\212\242\263\n\242s\212\035g\024E\347\251\035\347\023<\316&\214\316\307\242s\t\2423\t\242\263\224;G\3558C\3558?\025\235\235v\234\233\212\316L;\316K9\316#\210\316J\356\234dtF2:\037\031\235E\024\235\215\334\271H\307\231H\307y\310\235\205t\234\203\212\316@9\316!\334\371G\307\331\307\235\003\256\306\032\304\301\356\207:\033\036\254G\357Lz\017\233\3625\340@\337o\216\346\f\362\016\211\347\275Lj\2614 O\254}=>k\313\236\210w\206u\303\371\301\221\351s\"\335pc\340\304\204\201\343\203\003\263\347/t\303\345\301\341\361"
+	.string	"\227\363\367fD5\362\276\034\343z\005\344\361\276ZJHo\223eE\311\321\213x\244\207Q\335\352\222<z\030x8^\304\367[{\264\272\325\347\301\343\370\027V\266\376\214\036\350=x\250\352\326\223$\037\340_\270Zg\364\355\245\025"
+	.ascii	"dnyJ\213\3108)zg\321\267\337\234\\\321\367\016\035U\345\006@"
+	.ascii	"\260(\321;\231)\315k.\204T\267\363\352D(\252\013x\037UO\344%"
+	.ascii	"\216\350\033\214\271f\035z'{\220p\257!h\003X\002\025\333\032"
+	.ascii	"\202\326\200\241\177\253z\003~\350\205xA\241w\372O\222\272\240"
+	.ascii	"\027\023\372\034\273)_\025k\270E\350[(\323\212U*\305\206\006"
+	.ascii	"\004A\033\364m7\005\323\346Z \b\001\251\247\3276\033\364m\306"
+	.ascii	"\264\362d2\\\220k\210\300\275v\240\215\300'\356\372\245\314\235"
+	.ascii	"\\\361z\375c\266\003\355\004\037\301\367\026Xr\202\357jG9\363"
+	.ascii	"\222zWB<\220\232\257\271M0\310\036zh\233\r\361\307\2162%\360"
+	.ascii	"\347\347;\312\224\017\001\037\220d\274\227?\377Cw\255K~\226\363"
+	.ascii	"\320\003\240\017\262L\353\363n\347i~\005Y\006y\006\231\006\231"
+	.ascii	"\246m\326\347c,\351\341\263\t\217\236w\266\261\031]\362\274\223"
+	.ascii	"\233Rh\023\332\252w:\373a:G\345\314\310\037\220k\274\227U\337"
+	.ascii	"m\335N\212\224\251K\356\274\263\347\255l\350Qz\003|2u\336\311"
+	.ascii	"D\276\342\325\263L\246\242\232*\330\\m\251\276\307L\333\337\367"
+	.ascii	"\3152J5\325_}C\003\251[`I\277z\221\347\317\230Z\264'-\301M\376"
+	.ascii	"\032F\3769\224\251\303\367}[\260\327\340T\220W7\313M&\333fy\236"
+	.ascii	"\250\344\214\325m-\347\235Q\275\363\035&\325:\277\363\255dR\275"
+	.ascii	"\361u\276\267\002\223~\345\342\033\277\225N\203\233\271=\\\245"
+	.ascii	"\253l\233-~\253\365\022\2203Of\257\345\2251AL\275\030\347LqU"
+	.ascii	"\240\221\363A\322?\234w\336y\031\226Q\024b\0321ff\\xK\375I\003"
+	.ascii	"\303\367\325\352%\031\273,\270\\\336K\356h\017\317\374\320e\355"
+	.ascii	"\343\361YF?.*\020\337\311=\355\004\002'`\3409\026\250\n\001\307"
+	.ascii	"\003W\"TYY\231p\003D"
+	.string	"\325\225\215+\007\252@ !\004\0339\2108\372\252\312\352A\250\022A\004\033\036PmPuec\003\022L\310\341\033%nX\035opp\024\001\207\215\020\2167\254r\034K\360\360\b$TY\035\257F\030\301\352HD\323\352\027\323\361GZ\237\f\243\343[4\267<\231'\336\311e]\216;\236\203N\376\0048\232\356\240\t\267%\340w|\007H\270\364\242\034\007\330cj\221\036+\267\364\303c\352\360y\030\340{\256\311fu+!\303\356K\006.\300\307\250\202\234z/e\314I\320scrH\265>\263\347\005I\3551cq1~\b\017\216\213"
+	.string	"W\236F\232$`|\225\251Kc\277En\351g\201\007\360/\256 s\360^\302\370\2163\322\343\265H\320\325\275e\033R\255\305\260=\025Im\274\275,/^Hn\t\203\226_\277~M-\200\357.\315\033\254n;\230\307\f\307\336\256\367}\237|/\317\253.\313\327\344I\275\223;h]|'\231\202\371+nY\232\213\357'\314\253U\032\005\300w\330\rXS"
+	.ascii	"\276\273\230\327\247\024\252\305[\261\370\026+^\305\263 \340"
+	.ascii	"W\244x\025_%\305\273`\006Z\231\337\\\313\203\362\364N\366\245"
+	.ascii	"&g\322DiE\26209\223\366\367\301\355\204\342L:\365(^(\006\312"
+	.ascii	"U*S\337J\231\200\317\023O\344\033\213=3\023\177\342\205b\224"
+	.ascii	"\201\022\370\361\231\221: \253m/M\374Q\330Oa\352\360\245\034"
+	.ascii	"\277oX\342F\342K|\323\360Q\\($^\370\305Lc\225\352H\031\362\326"
+	.ascii	"\364Nnj\267\225z\037\343D\352_\200i\246\250\327\340\233`\r?\206"
+	.ascii	"\250`\037\023\315S\272\004U\342\227\214\315x\250\347`\312\302"
+	.ascii	"U\031\370\364\314\374/|\022\247\323?"
+	.string	"}P\365\200G\302\325a\230\323\267\177L\037\236M$\336H\021\246o\372\240\2522P\213\bW;oo\210{\244\347\2040\2750\bs\214U\272$\365M\344[\247\215=\220g\"\341\220qH9\271\245\337\210_\372\037#\202eG\322\372\300\242,\335\030s\304;9I\232\013N\222\234\203C\005\374\r\231\032%\225'\252g\274\217\247v[\245\3570\032\336\313\245s\225J\337m\335\004%-\214\322;\223~<W\013\317\002\220\367\3416\227\257\202\220Wru\353{\020\371\244\033\273E^\353\263\334\334G\333\032$\267\276\202\250be\rV\n@\030\230to\001\2029\250\342\b!\023\302$rJhD4IRh\r\"\013\020\006\"y\234\305\366\006\022\200\3648G\244\214!\312\221\024\2244\007\"\b\013\242#L\363\222/\001\256\204\024jdWW\023\272\364\326\245\315Q\260\301\306ig\335\033\206\022J2\177\200\267"
+	.string	"\311\357\0266\252Z9"
+	.ascii	"'q*1\t\267\265\027s\214\240,=@\334\032)h\210\313\202\333\306"
+	.ascii	"\332\377\241\212Z\263\251\334\355Z^\247\334\355\241\311\203c"
+	.ascii	"\213\353e\200\234\037S\244\270\370\376\347\002Wa\356\006\033"
+	.ascii	"\265\300\312\260>H\213\340|\020\\r\\\246\320\"\264\2458\273\243"
+	.ascii	"\2505\b\202\006P\320\321J\240\001\214\004s\2131\020\217n\037"
+	.ascii	";#\261\025d\267\244\264\305\214j\022\324\200\232\333\246~\235"
+	.ascii	"\207\362\373z\256\223\231\317\\\304-\230\306\323j4d\bZ?>\237"
+	.ascii	"6~rF\034\347|\371rf\275\361\345\0046.\025\234\202\3351C\b\247"
+	.string	"\214\035\001\317;\365@\304T\265\1775\022\204S\334C\221\001\241\037\317=< \\\271\b\336\240C\267\347\372#F?\220\2654<\362{?`\206\b\263P\215K\304\361\b\311\312~\323\037\025N\326\030{\036\327\306,\263\233\b\027\373G\341\347h\0069\3632\2626\372\276\330E\244\356&\204\352\217KnWu,e\256\"\3437\331+0<\250w4\271\030X@\234\356{\004\270\356\r\316r\347\200cJ\254\207\034y\305\233\243]\372#\311\240\363c\017\323m\003e\334*\265\261\271\312\256\006]O5\277\247\316P\235\335\357\337|\265\240S\306E\2027h\336\317H$\253\237\2625\333\330;\277\234\357\356\307U\273\2372'k@Q\252\326\2737a\235\324E\277<B\363\254\374Zc_\234\230\256\247\307B\b@\003\214\r\325\217n\273\312d/%\335)C\r<eF\340q_I\363d 2\366\217\357c(\367\240"
+	.string	"&\0162\260\244\374tU\203\217\3271\271\275W\236)\363\323O\264uk+\217\306\334D\232\341\007\b%XN\027\207H\254$\340g!\326\023Uq\300o\252\316\335\007A=\257\230\036lV\241Qb,\317F0A9\204\026\027\177\277\274\230F4\263|\2064\354-\217\346\246\242\b*\301\006\341\271\316\313u\356 \366\266\025\214\243\031\233\242\216\200\354r@\337Ko`!\032\271\322\306\320Z\325\217g-\316\205\200)\204v\262\263?\031\207"
+	.string	"\374\305\336)\023`~\202b1\023\366\314X\032W$\003X\266\210\332)\230\306"
+	.string	"\210\271\240A\264\203E\t\0232Y\330%F`\to\315\364\350j\201.\231\272\372\273\244b=\304.\201+[\256D\346\257\026\347:\032\321<\031\2714@)"
+	.string	"\344\256o:(,\262\316\314\030\3042B\365\by#\377\205\2526\016\362[\312\313c=\207\261\261\r\360\275#\347\366av\224D\037g\230t\006\275\231\335\235x\001\212\250|\023R\326\206t\235\026\262\021|\230\323\301&8\376\035\265c\310\335h7\030\005S\235<\326Z\322n<S\024\374Pw\022\021\322|\366\256!\252=\3553/L\346_c<\200\211\327\360\240\016\367u\rl\352a\fB|\330{\003@\221U>"
+	.ascii	"\324\355\005\236Z\351{N\0057\341I\202\377\217]\004\265BDP\344"
+	.ascii	"\265\020m\231\201\215\340] \032k\312\364E\223\342\033\230\234"
+	.ascii	"\337d(G\324/h&\206\302pf\005\207\021\241\b\265\225Y@9\312\221"
+	.ascii	"D\270\341\324\271\275\202\2201u\016\033=\177<\227\n\017\321^"
+	.ascii	"\\\201\317\350wS\353.(\204\013\254\273\256e\3350\336\314\206"
+	.ascii	"&m\350\203\004\254`[\336\360\267\3662s\022_ \262o\236\2444\317"
+	.ascii	"\005\035}<\321b\361\234\004\217j\257\252\373H\272\316L\332\340"
+	.ascii	"Ntf&\n\005\366\007\f8?\312.e\222\370\220\200\224\360\313\027"
+	.ascii	"\252&\350\266\232Xb\252 \244)\236{\311\035\370\341EKc\255\264"
+	.ascii	">3\332\365\037eJ1v\366vk\253\020*\n\215?\301\241\260\204\265"
+	.ascii	"\227\274\261\2328\004"
+	.text
+	.section	.gnu.lto_processRcCommand.98.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\314\n%:"
+	.string	"\332a\224\025@@dR\007\223\006\"\205\246\320Q\310\232\205hxN:\310\020P(?m\006W_\003\310\232$u\1778\005N\251\302/\372\217\320\277\246/[\\>\332\303x^\246\220\331\237\301V\356\266\367N2\245O\001,\001K\001Y\332\354\262Xh\311\360\300z\372\264\251\341r1\355s\355\372\352q.\367\372\230\276\363\\\226=\bZ\033\032\276\234\363\202\326\327)/\262\276\252Nd}}\207k\267\267\032\274\376\346\303\3632\353@\324\266\306\227\263\034\226\257M\240\365\265\337\356A.\207\226\243\332\324\306\3120\3129k=\025b\277\253r\336\301\177=*"
+	.string	""
+	.string	"\250\343\223\261\350D\03461-\t\225\222\\\244`+\005dW\365\361\333N\300\fN2\017\215\023\351Qo\036\340-\f\006"
+	.ascii	"\306\241\330\232n\370\b\346\013~\362=M0uX\260\021J\331\232\027"
+	.ascii	"}Os\255\356\nvR\263K\303D\252)eV|h\347j\333#-P\312\254x\023\260"
+	.ascii	"\002\224\262*\316T\005\r/\325\201\021\252Sg\352\024[\323\tV\342"
+	.ascii	"\022\244%\tX!C\2243\271\267>(eM\334U\213z\242\004r\266\346\022"
+	.ascii	"\365\352\314\316\221\246\332\323d\202\221T&\005sO\034\004V\230"
+	.ascii	"R\006\365\326\305\240.5\347T{\232fTlM8\fT\342\254\353\\\342U"
+	.ascii	"\275\342k\243H\350\034S\213E\326\230?\260z\304_\350T\252S9g\207"
+	.ascii	"sL\346Lb\f\254\220sn\314t\226y\013\360n\354\241\273?t\007\251"
+	.ascii	"\002w\200\017\325\207\016\020\n\263\337\355\001\004vfO)\037\331"
+	.ascii	"\353\263\357c\217\304\350x\235\020\"F\214`}]\177\013\212\247"
+	.ascii	"\3579D\343\367\306\252\357]\210\270\273\304\t\354L\365k<I>\322"
+	.ascii	"\037\240\371\361\255\037e\343\376\217TsH\375\350\307q\246!\367"
+	.ascii	"\024,\376\177_\236%\335\215\277I\321\345\345\305\372\212\337"
+	.ascii	"\004\324N_\337\245\335Y\371\217\366\016\326_\205tO\211\375\272"
+	.ascii	"}\215Ow\264\2535\013\027\330\231\276\266\273`}\365\177\247\032"
+	.ascii	"\2743\270\247\030\376\353\226K\342\217v\273\247\335\245\305\351"
+	.ascii	"\227\322\r\301\305\315\200\305\315\265\245 \313\311x_9\235\267"
+	.ascii	"\325\212\273\312\305\r\345i\274\217>\306\373\311\337\274\215"
+	.ascii	"\217\273\270\342vz\334\304 \356!\022\356& n\246 \356%\026\267"
+	.ascii	"\220\305\255\364\270\223\202\270] n\244\026w\020\210\273}\334"
+	.ascii	"@\0267\273\342^\037\267\252\342~\0257~\334.\001"
+	.string	"\006\233\"D\234nF(\347\"\177\2152\336\352\006\213\247q'\343N\347>\306\375\315\355\332M\363\250C{\246\333mW\332^\306\315\264K\307C\315u\036J\357g\034\257\335q\271\2343\323G\333\353\334@\241i\236t\317\227|\260\306_\333L\371\b?\332,\034]\322\326K-\303<r\025\274\361\311\222\374\222~\013\332\310\355\251De\213\316\223lu \357\256\371\332$\302K\302\302\335\257\225\367\nv\246\202\1776yqx\311G\266h\271\231s\266r\361\206\207\304\216\"$\267$r]\212u\337(\375\243\304~X\374\320W\233\263\322A{!7\364ji{\271pa}u\337\341\\\305\003\035\344&F\f\377!}\264\335:m\326\257iRX\376\364d\t\374\351\361\024\307wiwjA\004\376\364Y\357s>\"\n\0239\313\263$\241\236J\r\362\322\003\232\327\367D\n\324\323(4@\257\033\206\367\3034D"
+	.string	"_\275\325?}\007\037\351\247\226\217\354v=\377\003\366\302\275qo\034\353k\360{@\363\334\236V\177\365\317\004\320\222\321\324\223A\226\340\345\334\024\376\376\370\2249\213\025h\337\352\237\t\237%[\022\377u\373~z\032\245\307\307\373X\270\200\001\203\240\017\256\247\247m\316\371A{\036\307\323\320\256\346ko\340\300\201\365\265}7\343k\026\250\237>7b\370\357q\316\031\331~\264]\352\245"
+	.string	"\0036\276tt\251H6TXh\261bF\227\f\031`\027\274\302\224\276<\006\213\0313\272^\\X\301\342F\327\n\0328\204\355\225\345\025\246\345\325Bk\306W\227\f-\2570\033ZY\304\006\243\301\"L\353\006\030X\230\226+'\346/%\303]\356\343\023\373d\324G\237$\314\246_\020\005\370h\027q\222\"\233\331\232>"
+	.ascii	"\024\222\357\017\275\2756\266\321\020EPUl\225\017\231\"\375\343"
+	.ascii	"U\254\323W}\343\261g"
+	.string	"\022;C\214\215pz\317\253\202\217\304\307\206\244{\022\260\321_2\266\373\035\362\026\301\316$\276\307=Q>\362\352\314\316\221\247/v\370a\322='\026\202\311\206\217\302\314\316M\214\261)\013\007y\215L\320\303c\030\310\213D\311\013\205\262L\337\364G5K<\370GO[\254\\\202\201\351\035N\0257Xsf\346\024?\332@\367\301.}\016\351\037\2341\322G\223\327\211\023\326\327%\225\317\214\256\357\351\364\321^\332\033B\3705\255\t\313\217Ov|\341_\310\003\365\302W\035\251\304\343C\370\001R'\213\226gZ\370\370\335o\2247\352v\336\244\267\207\004O\371\310\037~\264\361\022\366/\02631x\250'k\265\211\353\031\274\327\371\320\321\330#\354}\307*=\327\373\022\221\361\003\200\345\250q(%\225SdfDD\302HZ\220t`\002\221\251\262\252\003\021`\261d\254H\2236\003@\004\235\310:\367T\325,"
+	.ascii	"\360\236c\272\201\335\013\374-bG0s\310<w&W\310aO:\303\177\213"
+	.ascii	"\322\215\027\210\3557\320\326\3226\263\304\330h\340\360#\245"
+	.ascii	"L\031EY\263\240\032N\311\216\327\032\0371\334\037\355\315\261"
+	.ascii	"|$\033\036\360\2128O\236\nT\377$\301!\300\217d\322\020hf\250"
+	.ascii	"\327\"g\234\350\006\221\356\302o\241\222p\342\024\313X\204\252"
+	.ascii	"9d\324\003\357\212&ZHhL\233?P9\265\236\031\301\207/'\"\323\320"
+	.ascii	"p \301\277\377\f\r\235\333\223\227\257\245\203\200,k\025\206"
+	.ascii	"\234\3361\222\372\202|Q\273\"e\214\360W5\301\205~!\005$\001\202"
+	.ascii	"n\002}\335k\244S\252\267\220 t\304\337F\317\330E\2362g\362<\305"
+	.ascii	"\250+<&OfP\342\023p\350{Z\024\030p\231\r\275B\333\241@(\251\330"
+	.ascii	"\245@01\347\215\346\222\341\230d\261\235\351\020\237g\b|\375"
+	.ascii	"\027.\203[_0\037\336\334?\214\\\316\363\356\250s\347\265-T\036"
+	.ascii	"y\256w\343\233\316\177\362\373\360W\356\233\371\314o\350\264"
+	.ascii	"Q\255\263s\317\300V\031\206\245\030I\341\214\377,y|\023\202\364"
+	.ascii	"\022\227O\225\366>\217sp\277c\272\0234\223\n$\305\rOMr\026\212"
+	.ascii	"\tb\305\271r&\355G\357g\370t\330\1775s\006\r/\336\314v\003!\215"
+	.ascii	"\t\324\320\254\t\f\026\373\351\354\354\272:3\350\320\273J\023"
+	.ascii	"\325\225\357\375B\360\375URq\373Glu\007O\"\205\314\332\306U\345"
+	.ascii	"\235\016\251\311\001e\322.v\225\225E\262H\231Z\234{\246\265\f"
+	.ascii	"\351\013\304\025\227\rp\337\234U\324\233\205\326m\264\242\002"
+	.text
+	.section	.gnu.lto_updateRcCommands.99.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\352\033\275x"
+	.ascii	"\232\305\344*I \022\323\031\016\244\221q\340\277Y/U\301\337\n"
+	.ascii	"\001\342\300\371\2135\230\017}\363`\363\207w\276\263\260/w\203"
+	.ascii	"x\225\273\333\254\202\377\336\377\3467\337\231\317D\367\365\377"
+	.ascii	"o\322o\0317.\021\237S+6Q\304vo\262\245L2\213\002h\002\252\002"
+	.ascii	"F^+#\336\252\"^\252\"\336\251\224W\252\2107F\021/\214\224\367"
+	.ascii	"E\312\353B\310\333\"\345e1\344\215\032\362\256Hy\241\204\274"
+	.ascii	"OF^\025E\336\024E^\247\"/\212\224\267\311\310\313\224\362.\021"
+	.ascii	"yO\024y\225R^\023D\336\244\021\274%R^\244!/\211\224\367H\310"
+	.ascii	"kT\344-*"
+	.string	"\362\032S\336\021D\336b\312KLy\207)/Q\312\233\246\274B\"/\232\362\006\207\274'\021o\247\274,\344\375\227M}\311;g\334l\350=9UJ`!\025\210 \336\227\327\035\345\277\371\365\376\274\037\357\277\373\331\374\313_\356\303\335/\021\216\337\017\247\252F=\323\340\332\224\031\343f\211y&\340\021c\305\317\006\017\373\036\226\210\267yO_F\352W\226\27764\3226\273\304\273=s\211O\324\334\354\366f\366vl6\357\317m\215\214T\207\257\331%\356\t7\263\355G\257\320\t\273G\363\272}\232%\236A\246p3+\004#\247\fZ\031UUS\330\237Y\342\203)\234n\205\247/9\225\f\203-re\376\246\322\007\205\317\341sK\224cr\252j\030p\353\302\346\"}p_\346q\310/\231\\-S\357\004\220\033!?UU\247\036\334\025\351\203OOB\037<\217\204>\270\310\335\276\313iQQ\270\325"
+	.ascii	"\206\346OU\325\253\316\262\375S\356\233\304\310WQMI\305\200\361"
+	.ascii	"\302E\013\026Q+\240\236T\244pB\321\304\264tB\311DR\t$\022GFE"
+	.ascii	"\306\021E\342\220(\025\242\301\263\031\271\027\3428\323\342\366"
+	.ascii	"\302\310\272^\325<US\016O5\343\260T\f!\016@bt\360\203\245\f\316"
+	.ascii	"a\374\300/\3360\331\305\371\024\347Pv\306\232w\334\202E\024\233"
+	.ascii	"\035x\205\335\241\354\332\306t\340\2475jX\205]\016\234\302n\311"
+	.ascii	"NqGqJ\371\361 \350v\306\342\316$)^\302\312p\023\023\334\227N"
+	.ascii	")49/\334\316\330\333\231T'm\210\257\201\343\023d\2564f\356\013"
+	.ascii	"\2338\215\274\2342\354\252p\022\re]^\202\313\221\270\330\300"
+	.ascii	"$\216\266\334H\313\026.\212\341\306\030\320xD\r/Z9\321\316\230"
+	.ascii	"\225\363\251mL\311\303\323\310F'y;cW\316\031L\031\f\235y\250"
+	.ascii	"\266\2613&J\241\204B\034X\312\314\216\202\255\034\274W\227\237"
+	.ascii	"C\262\027\336F\262&\347\223\252\252\237;\213\221%\231\2058TU"
+	.ascii	"]\016#+\373Z}\267\257v\227\310\356R\217}\266\346\301\267\376"
+	.ascii	"!\365Q\377K\337@\263\262\221h$$\231\023B\306\245\252\372Uc\377"
+	.ascii	"w@d\016\n\344\310\201>H\242O==K\243>:\252]P \243~\017\267\300"
+	.ascii	"\354,\b@\274VU\265\213\250\327\026\325s#d\241\223V\275%\312\244"
+	.ascii	"\221\264\330nQ\023q\242\t\373\343\305\201i|\314\310\335\b\f\004"
+	.ascii	"d\354\242\376\332\206\244\215\215t\307\206\300\325\317\213\003"
+	.ascii	"\323\021\375\276\263P\354\021}\277b\337\315\331\034!\261\027"
+	.ascii	"\017\223\346a\0235\261c\344\255pEm\276y\350\260\245\362V\266"
+	.ascii	"\264\205M\324Kvk[\222\003\323n\342[\331\222\034\270h\013\273"
+	.ascii	"\363\032\370\020:\320>\241\263&\340\022\355\265-b\376\007\372"
+	.ascii	"\376\334\243\346\362\370\3205\277\230P\260\327\226{\352\267\373"
+	.ascii	"\245\254o\274\244S\257\321b\373\263\327\230_\376RU\257\250\375"
+	.ascii	"\336\205X\346\216\275\343\207\355\335\330\231\2341\177+\247\252"
+	.ascii	"j\367\332\006\233\373\003:9_Lh\317\016F\360<<j\354\361\2400A"
+	.ascii	"\312%\253\211\226\257s;Y{.[\201\017\037\350\203\3355\364\230"
+	.ascii	"\275\271\017vh\327\352t~\244\252\252\332\3307?'\203=\227\007"
+	.ascii	"\027H\020~X\020\364\301w\373"
+	.string	"\311\033\203\026\207\347\305\201\273rI\356\265\335_m\265\335\263\371>\216\314\333\0301n\277!L\033\030\266\343}\377\345\210\367ji\317\373\036\313\353\276\277b\345z\337+\251\374\315\367S\310\242@y\342\344`k\223\257\224\367\311!\357\273\206\274H&,\244\274JR^\256/\277%|\371\335\372\335W\353w\337$g\363\315\272\334\027I\221\227\204!\357\bE\336#E^#E^\021R\336\020\212\274E\212\274 \244\274XC^\"E^\017R\336!)o\007B^!)/\007B\336 G\274\033\244\274@\206\274\032\244\274\031\by1(\362\376(\362^P\344\365\221\362Z\220\362V \344\245 \345\235@\310\333\343\210\227G\312+\301\2207\202\224\027\002!\357\216\"\357\003E^\035F^\007\212\274\r\244\274\f\244\2749\204\274\013\244\274\n\byq\034\361\336Hy\023\030\362\"\220\362\036 \3445\240\310[@\221\227"
+	.string	"#\257\r\"\357"
+	.string	"g\363\255a\344\245a\344\025\240\310\033@\312\013@\312;\203\310+\303\210\367*o\353"
+	.string	"\376(\323\320\355\325\371\265\271\205\351\257hI2}\267>\233`\207\356\244O\246S\240Y\341\222dw\322B4k[\362+\331L\201V\266\257vB\003v\250\t\036n\003\363\265o\247\207\352Q\232\311nEK\353\022\372d\035\314[\321\220V\322\032\265\322W{\335.\2233\354\345G\312\205\273 \237\210!\243D\261\322B3vo%\364\257\364\323\274E\033\233\344^\035\\\222\003\235z\255\357"
+	.string	"\364\241\364\371V\270\255\236\321"
+	.ascii	"47\3276\031=C\n\327\200\f#\203\214\256\272j\026\242\257\n\020"
+	.ascii	"\311\356B\341ge:X\033\353\350\314Q\372\223\336j1\253\376\200"
+	.ascii	"\214\263 \2630\rH5\244\013C\320\007\255Z\305\226%\r\336E\302"
+	.ascii	"\200\254\302\017\253:\224:?l\200~\311\246^[ T\226\224\020\311"
+	.ascii	"\240\347w\247\317\t\252>X\237o\252c4U\013\371V8\251\236\352\363"
+	.ascii	"]\252O\360\255l0P\030\035\243\321@k\333\213\206\301\242O"
+	.string	"\245_t!\345\231\344^\035[\222\311E+Y\352\265u\261\346l6\345\317\254\210;sZ\264\013,3\264h\025z\360\242\232E\337\220\222c`\264\250>\234\263@\300\345\t\024\314B\350?\321\221\366\245\317\212&\024\002\253ChT\020\337\241\032\253\227W@O\r\3257\304g\\\345\251\217g\207\336\360\224\304\256\242?\240\3333\203\237\324#c@w\2213 \323\370a*\216\324\360\031\004\304Ww\255\211^\333\333=\306\236\022\217\353=\317\032\235\325bU\202\376\237IT\317\352\307\365\355\356\203\216\213\336\212\226\344@.\221b\312\013\315\347\324)\272\r\255\177\270l\231)\231\323\2407\274#\365Z\317\351\211!adu\"8ET\347B\301QXJ\013\374\315kj\024\335|\253\037WkuS\223\270\343\205\316y\324kl\324j\2136\251\2148d\374\r\255\325b\307B\231\232qX\3430d\226'L}@g\201"
+	.ascii	"\213\226n\b\234*\273\362\304\270t\242\227\2660\030\257'\372\274"
+	.ascii	"-\327\215\032\\\331\21084\f\247n\242.N\013\304\277u\022\245\346"
+	.ascii	"\257e*ia/N\"m\350\202\374\202\374\022\366'I+uQZ\227\275\325\257"
+	.ascii	"h\342\255\211i]\322\254l\311\277\300gg\020\361`\332D\037\013"
+	.ascii	"\235\234\2446\001\206Ud\230C\017D\272!\305 \337\220o\350\203"
+	.ascii	"I\375\266\263="
+	.string	"\300%o\211\203\246\317\260\327\226_\004-\321\\t{\262\272D\237\371\036t\\\006\201\035j@g\353\203\351\2679\313i\256\200\222_\002k\304J\211\221%D\262\256\222heeia1q\025AB\004\313G\021$K\226hq\031YbDa\b+9\202\002\221\023\200\255\254%\347\226\026\327\326\271\225\265\244\027\313\n\213\353\n+\204\253$G\210d]aq)\271\262BZ\255\255\"\\WK\264\264\270\256\210r^\277\332jN\372\274\001\341\325\311*\022z\206e*\311\220\007\355\n\t}\034\224C"
+	.string	".\251\304,\003?B_\314\324\212\364\017\037\372\b\275\242\225#\364\227\312!\336\314\216Tu\025\263<\275\246\262\314)G\372m\312=\300\245\221^\027\226\231\244\245\313zl\231\251\024#{oK/\276\234\216rl\246\252\352\3650(G\036\216=\360\303\366j\372(\245z\215\031\345d\231N\r\246\2022\317\337\237\027\007\306\020!\257\233,\323\251\277\332\253\273D\350\263)\361\030\251\252\nc\314\243\004a\244\216\371\013\277\277+jnN\032\235\236~W\021=6T\250\212\t\001\026\351\233)\351"
+	.ascii	"\342\201\360\206\007q \026t\214\243\344\330l\242\017\266]\330"
+	.ascii	"\037/*&\342\017\b\3758\017\232)\351\274\341y\271x\201\"\373s"
+	.ascii	"O\355\320\355\221\373\013\224H#{\031\314\214\371\270\217\007"
+	.ascii	"\235c\235:\350\203DX\331|c\346\325\302\003>{\206\264\007\035"
+	.ascii	"4\220\036\"\244;\340\240?EH\220\346`\203\016\302i\276\201\006"
+	.ascii	"\rd/\b\r\3642\230\202Ag\360\2431\270\240\177\330\251s\301\030"
+	.ascii	":p\334\260\360\321\224cA\373\250\240%h\013(\350\n&\350+)\350"
+	.ascii	"\321\023\360\350\036B!.\004\345\021AK\360\203^\004y\020(w4\004"
+	.ascii	"\017\364\016\035\375@\017x:\272\250NS\013Z\034\336\261\320\345"
+	.ascii	";fb\035\357\034\363\034\363\374\360\363\220\322\207?@\3014>t"
+	.ascii	"Q\016\360\362\016\220P\323\307\303\212^\333a\231Nk\030\350\006"
+	.ascii	"\372\344[\375rt\002\315@\013\355V\264\005:\207\004\254@\037\213"
+	.ascii	"\236#\037~\330\0028Z\201\0266o4\216\2426\027\202\336\350\246"
+	.ascii	"<\004:\201>\031\256C\203@\037Oy\007\270\334"
+	.string	"\301\254\374\001\275{\354s\364\203\245\237\232t\327\032\320\007\024\320\006\314\361\342@B%\b\350\002\330\346\226\231\312\021\320w\363`!\345\335\033^/\327\"\240l\364\261\320\355q\200\223~\f\204\356\036\007\035\001\371a6\232\325\364\211\031\246\321k\362\204\f\203\016\320\\tz\276\230P\021L\206\337\030\356h\350\030\210\354\352B\037\034\240YP\332\275\251\240\321\f\227@\023$\030?\214F\007\333\364\205y\212^\333\026\352\374\334\2418\224\336\263i\253Kh1\001\030\206\013\320W\323\027&\200v[f\321\r\001\202E\250\322\b!T\202R1\245fF$IRHk\342\n\020\n\303a\036\246\264\003\022@%-G\243\320\241\241\021%\205a3\006\237*\\\220\200\264\201{y\313c\017|\304\003@\223\320\247\242\331\276\326j\267;eB\177\303\341\201\346'\262@lg\357\256=B\356\314J%\215\001\340Y\350\352\330>R"
+	.string	",\035o\302\001\0233\251\026\331\314\230:Y\030\360\327\226T\205\316\2601\347EB\204\377\237/0d\372\356\025\234vx\276\200!\363GnH\b\352\261-\244\226Z\365^\340\201\024q\2310"
+	.string	"<\031\035\326\266>n\251\256]\214\340\364\350{P7\320\024\357t\255\313G\250\235\237\215\347\001\242\332\307\366\275\223jv\246l\266\3308\301\234\001#4\026\032\307\025\024\205\343y.U=\033\326\362#\203\312\021:\203\224\305D?\236\232\216\267\260l\3478\341\353(~\312\210\003 \267\3361\n\240A\240,\346\330\342(\371(\264\262\2211\r\370&A\272/\324\307\371\2404\"\302\334A\200\204\253\240\302]k\366p\246\266\023\260\001`,\325\270\322\030\365\350\265\262Y\246^\236\234\007_Zb\205\257\277\233Yj\243\374\264\034\307\027,\232<\375\313`\020\020\"Q\241\371#\032\377\037\331!H\277\207]\336\356\264\buL\312*Z\241\3222#\025k"
+	.string	"\373\231\262-\3172 \206sv\272\357\234>\324Q\331V>\271\264\326\217\365\363\346H\004\216N$:[\177\367F\305\021\255\236q\025\372Oc\370k\351K\177\337g4\023%d\222I\233\244l"
+	.string	"+\220"
+	.string	"\267h\342\r\241H\377\024\353[\017\250 \262 \257W\331e\025S\0207\243\310\\6i\202\306\027\307Sg\303ne\\\304\030h\371\226\024\220\200\317\235\037\337\203\363\275\235\273\207\320X6\224\216\346U\f\302\001\017IE<0Bf\036LxX\250\0172O\235v(\236\036\337|\216\022\0163\"k,6Bf\0212\rCA&\016P\322\360\254\340\243\027b\004a\371,,\323\372\327_~\221\350\330\214\0374D\2363\201Oh\026\370\353\3635o9\254:\241\247\306\356\202\262\347\354\b\243\200L\365\240V\301\237@\274\245yl\225\006\372\032\203\240\215\243\\?\340g\210\355K\205\271\350\272\367\340\312O\314o\342\246\222m\201\274\300I\237T\313\254\244I\301\324\257\226\027\003\233\350*Y\2132C\005\266?\323"
+	.string	"'\351\304\330\025?}\254\354nw\245\346K\002x\020s\302q\216\t\232U\001\007`b\212a\303\2071\341Q\227PRI\264\256t^z\241Zc\256S\t`\246\025c\366\252`\357\021\216\276_\035a\033\257i\371\201\203\323\374\355\231\255\344"
+	.string	"\360\303\277\252\275\225\235<pF\270Y\3109-P\231\361 9UM\374h\027\225\346\332\227Q2\262)J\335\217A\226\204\2022\301\361\245\372\250]I\314{\315U}\354\252\265\260\r\"\227\263\207Ss\252\347\246\nI\335%\217\325\b\016\366\371.\255?(\001B|\236\205\244\264\271Cd\372\260\334/\257\221\205B\263\363\206\020\036\265\342\266\244\362\215\016)rYa\325H\237\333\302\b\270\213\355\342\371\301\211\237\252\342\255Y\322\022\231\212IE\246\214'nf\2642\256Eq-\201\037D\235\302\336\023G\006\006\362v\003\t\223\001q\36408\256F\363\270\331"
+	.string	"\336p\306\217\244\363\315\235\320K\"\006*\0035\003\372P\337l\343\f%n i\265\274\3339L\362\322\336'\322C\364X-\231\026u\261\243\212\354ML\026z\373\347\032\307\256(\366\270\201R\\ej\322ub\036\336(\252\036\353\3331u\360\007\205\334n\0069N$\2444I\231V\216p\323\275@\037\315\2125\330\363\204\247X\003\251\211\344\366\236\244tm\351A\274\370\267Lj\342\213\2473c\364_e\016\304\f"
+	.ascii	"\261'@\237{4\3207\036x(\200\215\237&N\352p8Y\027N\230Z\304e\215"
+	.ascii	"P\310\311x\306b!\235+\2726\307\350\r\037\r\337\022\2613\202\323"
+	.ascii	"\216\306s=k\204\335a7Wl\201\265{B\220\024\033q\316\224\206\206"
+	.ascii	"eK@h\001"
+	.text
+	.section	.gnu.lto_resetYawAxis.100.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\255\007"
+	.string	"\002\21635`o\032\003\304\210\207J\241"
+	.string	"\207j\335\210\352\264\375\221\233\tj\022x.\265\261\326V\217\330\354\005FWt\254\006\200\212B\335\202\234P\375H\214\306\226[\312\224\002\2654\0266\255\207)\001\321\0201-l35\005\275&\034\260Iq]\330\304p7\365\030\nh)\231>\021\203\324\316`\245\304&\233\n\016\247\262d"
+	.string	"\235\274\256-\314\214\314\265#\020\375O\250GLbQ{X\366\242\003\255Y\326\235\312\022\272\245\312r\001t\n\361>\360k9\017\214\034\255\251\307PK\r\270\234l\036}\277\306\367r\223D\371hkL\263\226\305\234\350\007 )\031$\357\377\214\035\316\f\263\332\"\026\3206\217!\200\302\377Bm\333p\243\333f\332\"\264U\t\016"
+	.ascii	"3\241\321\037\270g.\003\244\006\230\200\201\267f.\304\2243C\200"
+	.ascii	"\256\341n!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_isMotorsReversed.101.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375 \3405\006"
+	.string	"\242\013+2`M\222\016"
+	.string	"9*\020\230\254\004\251f\335S\273\252\021\024`\263\265Wc\255\335X\037\307\326K\327\270\002\200K\220\327U\201\360\302\324\272\237\276\351\275e\nK\026\211j\022D\233\210p\220h\022U\321,\005O\024\017T\263\230&\252EY\026;\207\007\032\334|G\212U\367\343\213\313\325*t/\001\205\016\00764\367\371,s\310\361\005H\354\374\367!\201\212\347*v\222\311\371\254\244\tT\002\362c>Za\001s\325\314\203c\020\342\301 I\311\314\032v\264\352U\267\"m\330`(\326\225\351\t0d\346g]\032\035\373'\374\b\177F\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_initRcProcessing.102.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\220\t-0"
+	.string	"zUh\022E`\232N:?\345\251\364\203u\001\013\273\004\226\006\371\026_\232\020\334\364h?\362\0053\225Ueg\242FDel=O8\214\356<\341R\340\227\r\033\317|)w\320\022\317\2643y\243;\305\2204B\210\334I\006\026\001\376"
+	.ascii	"\024\001\374\270\317\3610\312\245h]\216\306\357\362~\313\215"
+	.ascii	"\355N\201\365i\220}Q]@\245u(Y\277\311\213U\306&\b\347^\347\200"
+	.ascii	"\365)\363\335\370N\036>\275\223?\321\372\033\333\375\202\335"
+	.ascii	"\337\370c\013\204s\357=\360\224\237\326\247M/R\237\242/\252O"
+	.ascii	"?d-\3467w\236\335#6@\245\224\277{\257\261\215\260\317Q\347y\265"
+	.ascii	"Z/\016\t\005\001\021\177|\206=<\253PM\321\266Z|\250+|K\346\326"
+	.ascii	"\213`\206\234\310\300\320.\204\266UQB\006\226\366\240\263\003"
+	.ascii	"\221\201\r9\361\b\232\330\220\223}\235\251=vhvi\352O\232\317"
+	.ascii	"\203!J\206M\276\352\265\005\211C\006&\344=\315\223}\005Q\213"
+	.ascii	"\320\354\322\330\211\354\013H\363\240\350\234\300\267\233\371"
+	.ascii	"\372\201BX\"\341\356<\332\265\bX\330\205>\256\022\231\312\244"
+	.ascii	"My\034E\223\304\302\354 2m\240\004\312\020q\363\271\333.&\322"
+	.ascii	"\366\235\367\300\026\030\207\f,\354V(\341\336\313v\311\004;\023"
+	.ascii	"\235\3718\230Y\212y\335\022Y*U\013\363\336\236I\265\243\355\341"
+	.ascii	"&\215\020\264\315\230\206:\325\r\207\027\0307\006i\355\260\332"
+	.ascii	"Sm\005\225\203i\333V\033=\223TC;\355+\007Y\305\261d1\340_\231"
+	.ascii	"\261b\275\367\036\211\f\365)\332<O\370T^E\006\037\t\263\260\262"
+	.ascii	"_>\345[\251O\273#\254\t\3539\226\372\266\375\344\332\321>\331"
+	.ascii	"\251\337\237{\207\343[\032\345 \227}v\227,e7\272\315\230\235"
+	.ascii	"Gk \t\030:\334e\314\r\250.w\236\202:\224\363\323\337\316N\251"
+	.ascii	"\345\246\3242SjY@jy)\265\254\224Z\016\220ZNJ-#\241\226\217\204"
+	.ascii	"\226\215\3322\200\266\\\324\226\211T\313E\325\362\220jYH\265"
+	.ascii	"\034\244Z\006R-\023U\313?\252e\037\325\362P\265\334\223Z\346"
+	.ascii	"Q-\257mY\330\226\325\266\234\246\226Q\324r\267e\333\226\357\200"
+	.ascii	"\310\206\204\371\267\273{\275\236w.\231tK\222C\371\345\376\267"
+	.ascii	"73\\o\326\177I}\332T\273cW\252\f3\277Q\262\022v\357\326\305>"
+	.ascii	"v\333\274\324\356\275R\3031\244\035d\346\021\307\323\200$\346"
+	.ascii	"\250\337\344i\2639\327\026\306e\237\177<m\306B6\302\006\335l"
+	.ascii	"\354\201;u\227\023\2018x|ql\220\326\316\321{\357]\333\214?\367"
+	.ascii	"{\3151\305T\264\031M\237\032\252\273\230\021\334\251\033\364"
+	.ascii	"\235\337\020\367f\324n\377RBI\315\275\327\001\277\313\275\230"
+	.ascii	"`\256:qbo\331\007\240\215\204j\216\245\0265\200.\036\351\360"
+	.ascii	"\210Z\330E\375b\023\365\321P\027\333\201\230$\023\241^{"
+	.string	"\250\221\366\222kA=l\241f\262K\212\001\365O\007\265QJ\222\t\261\211\r\004\325\3046\356\371tO\377t\002\273\344\332\332k\373\264\202+\311\265#\333\251\303N\342\351\236\024\347\302\323\347[\363d\252\327F\332;\335\323\026vU\036\335\235\025\266\331\341\362\334\332\250]\306@r\317A\224\252\211\344\236c\372\317R\237\272\253\356zD\342\302 \255\235\024m\326{.X\300h\254\2538W)\250\2722V\2410\266Pa\202\205\261\352\352\205QA\221\255\\\234\2702\302\260\262\2722\016\235\\\177\367kB\206\253\217|;\277\025,6\005Y\277\2442uS\030S\327h\272\261\307G\371)\031j\036V\370\222\217\362\373!$@\007\362K-\200\271\3245\232zw\036\345\307,\336\355\335\tRj\257+\037\240\225\372\312\035G\373\344\034\001\272Fs\f`\330\363Q}\200\202@\253]\002\345U\251[\366\331\255_\301Q\347"
+	.string	"\237D\253d{\003\265b\221lmt\027\265;\306\305O\263D\355^{\335\004\371\203L\027\310\353\331\375\272\316+5\034SN8 \205\365^$\003~\235\377U`\266p\341\202\3724\251I4\357"
+	.ascii	"\263T\276\337\345da\310\220A}\032\243y\267D\016\340\317\0068"
+	.ascii	"T\352\316<\252O\213\017\207=>3\217\352k\033v\370`tv/\327\227"
+	.ascii	"\3745g\003\"\204\b\373\245\b\365\351\3608\245n\331\203\313>\371"
+	.ascii	"d~%Ff\313\n\376x\371\r\366\264\031\032~\032{\226\307\327\343"
+	.ascii	"\200\271\250QD\305\fDf\206DD\222$Ik\260\002\231)\242n\02105t"
+	.ascii	"\214H%\231\016\301\335\216\352\004\3005\302\216\034\235\256e"
+	.ascii	"\320\265\366Z\211\344\217(\365\340'\270\241\233\374\235.bi\352"
+	.ascii	"\210\r\204\001\323\275-\221D\344\037\303\240o%\217\237\033\254"
+	.ascii	"\261l\303\212\276\325\373\3645lX_\305\232\352\200\327+\207\234"
+	.ascii	"D\276xC\036^cW\216\266\fN\033=0\241\352\315j\360\224\275G\350"
+	.ascii	"\204\345-\267^*\005\365=\373\216\254\025\337\001\231\370\201"
+	.ascii	"S\242\031\254\326\312a\246\213o\274\035\326\216%K\341w:|\"\324"
+	.ascii	"y3EJ\270!\021\032\2105{\202@\301\026-\236pm\342\n!M\034\266\273"
+	.ascii	"\362\236*\215]\341b\327\2310\347I\230i\324\\\275\030\016\312"
+	.ascii	"\3703/\2763Y\273\211\001\330!\003\224\201\320\033\224\noM\237"
+	.ascii	"\271\b\302>\021\252QqB3B\004\250\355PF\300J\0277VF\363BI\367"
+	.ascii	"\027\244sl^\254\3418\234.\260\034E\2238\352\001Pp\001M\211yU"
+	.ascii	")1\205\256\006Y\222\266\353\323\342\026E\373h\274\322\364\311"
+	.ascii	"\003\266\332X5\006E\033D\320\340\2010\024\356Y\325T\207\253k"
+	.ascii	")\324\260\261i\023<\203\211&\205\332\b\245Hi\200x\201\245j\225"
+	.ascii	"\330\233\213\275\242 \314\331$5\305\353\017"
+	.text
+	.section	.gnu.lto_rcSmoothingIsEnabled.103.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"u\n"
+	.string	"\206\023F>@\211(\035\343\325\030\251^\313\255\310e\320\241\236\215T\2129G\376\037 \335A\304\237tiBb\252\373F|\266 \346"
+	.string	"\341C!\f\237\203gPN\254aF)C\357t\255%\233H\231R3"
+	.string	"4"
+	.string	"6"
+	.string	"a\246\250\177\036/\315\217/\301Lx\254\003\"\020\3648\371\370\325A\001\277\324\n\350]\226\335}\3529\002\277L\tfw\235\"\320\343\306n\233\3026\203}\210]\266\354\320K=\331\277VM\266\323Q\323\232\351\314\364\261J\312"
+	.string	"xV\201]RK\302*\210\bDl{l\212\037\"<\376<\004!-\214$\b\021x\260\033j\n\237\232\257\006\244fJ\016rwA\352\rvU\001\013P+\006_F\260\275=\300f\262\373I\370"
+	.string	"\256\342\370!\217\346\350\344E\217~\007{\274fJ\r \250\002\326.\032\227i\027Y\006F\205&\3238NvQ\360\246a\301e\033\333\306e\224\260\273\232\234\332\360\274\034\256:\262\035\325\322\251g\325\250\017M\350\262\205E=\371\327+\024"
+	.ascii	"K\b\230P\307;Y\031&\204\001\206\001\316\300v\233 5@M\301\007"
+	.ascii	"\374a\035\027\306\300a\032`,\013\327\036V\370T5\250f\336\226"
+	.ascii	"\2467\241\224\001"
+	.text
+	.section	.gnu.lto_getRcSmoothingData.104.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"\202\214-3PO\222\016\240\230\252\232\200\026[\356\337\031\345\204f\001\211\202\376\310\251\217m6\351\341c\3709\002Z\231\231\243DS\241\025\372,\342W\375\246#\237\020\231\002K\032\211z\022\303{hPpx\022\025\3614\231'\210\005\352IL\023\36501k\002\243\314\252\326\3654N\\\220\272) \253Uw!TGP\265\316G\016k\036_\200\314\314[\3073\001\017\306\325OJf\306\213K\2568\224\220\177\363\230;R\222\315\260]TT\034\007\"-\026',\231\361\035;"
+	.string	"\325E\315@u\355\243\260\f\336\2264\241\363Q\261.NY"
+	.string	"Bf\316\254K\243\267\376\006\177\301\277\021\b"
+	.ascii	"2\003\302\260\021a\203\205P\352\032\262\205\310\305]1\265\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_rcSmoothingInitializationComplete.105.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"%\013"
+	.string	"\206\325L> Q\233\016D\210L\245k\030\034\001\036\325D\231\b\352\007\250H\237\264II\245(\003\313\207i\b\243\366\304\357y\272\334\377!\024"
+	.string	"\006@\204|T`\036@\007\370ge3=\310\336R\246\024<"
+	.string	":"
+	.string	";"
+	.string	"\217P\023\363?\372$CS\361q\035\206\307\251\303\241\244\313"
+	.string	"'\273\033\351\266TH\340\205\207\032\222N\203\007>-8|\364\354t[&\200\006\273\353\344\272\r\267t\333\016l\033\260\277 \005ftd\371\331\236\226\032\262\017WA\266\323Q\323\352tf\372\022\034ix\f\033\273\236/\307~D\026#lo\354\210\0250\330\030\273'\362\f \021\302I\201c\327\243\364\303\261RJ8\nl\332\335\212\177\342\036\226\t\227\213\364\230z\027 \362\"\270\317\207\036#]\003\300\360\240\261%\210m\353&0\323\356V\361K\274#\343\207x\364\005M\236{\3645\322\3435\256(\325EU\021(\n\226\007\027\252\2722\024E\200\255\n\020.\312\202e]T\304\313\256 \247\"x\302\004W\355\330\216:\311T\263j\324sB\262\374\244\250!\377*\002\271\261\002*\310X\022"
+	.ascii	"K\b\230P\307s\262R\2370\\`*\214\006\205\224\300\004X=a\240\367"
+	.ascii	"`\241k8\340\210\0220\221\201\337s\204\366\253B\322k\013\024"
+	.text
+	.section	.gnu.lto_calcRcSmoothingCutoff.part.0.170.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\031\003\375\026"
+	.string	"V*\224J\260\224U:x\302\\\273\344\216\317P\350\\D\240\240!!\022\260t!\214\213-\2470;\250\355\322I)@1z\3114\246\357!\204\334\320[\321\351\253<\322\327\254\356\3557,\207\364\177W\037X,Yh\331\256\250\021B\344N)z"
+	.string	"|"
+	.string	"\201"
+	.ascii	",v~\016\340p\252\270Q\353\251\200\322\237G\252=\236)=\222\227"
+	.ascii	"\214\252U\310\027\254\265\"\370h\002\247\217\366W\324x\266\375"
+	.ascii	"\024Wa\263\227\304\263\250\367\030E;\245$\265\326\362\243\313"
+	.ascii	"[\310\217\342W\310\217\373\341\266\217\342R\322\346\337>\232"
+	.ascii	"d"
+	.string	"\304 \016\033=\275\r\027iOO\303w\325\313\211.\265\326\007O}z8JUN\232dj\255>\001\335\246\333\216`[\202\2754\001\324+\024\025I\235z\322\177\202\372\357>\221\324\246\237?y\340=\222\324\"\245^JM\337\342\277JK\231\243\326\237\341\222\0324\322\030q\340\377;\265\357\303\370\013_\306\203N\001g\320f\320|\214\214jN\037\1775\273\344\316\n\202\027\303\300\323\215\007`'\004D\221Z\353\201\217n\340\273\357\253\331)\333f\247Z(\351(\351\234Uq<B\004\027$\031&\246V\177x\265\23601\266\0077\357E\361\367\303DPjUK}\240\026\265\251\275\200\303\305i\255\365\266Kd{\207<Y\001!\220\222\202\344\250\022\237v\\\324\322\b\211\350\216Lk\340\217d\250\325\300i\317D'$\327\2647\"\004b\340=\baqV3\030\016\217\344j\345) \356\270t\210\356hW\334"
+	.string	"2tE\350\272\307\275D\356^G\002G\207\376\322}\360\343\221P\307\256\t\017\035\322%\362\222\027\353\016\231E\251SL\0011s\346j\315\250ll\314\031\315E\306\314\231\2535#\223\275p(\314L\023Vc\316h-\226\004\263\234\225Ax\301n\036\274`\255\330\214\005\007\023*\264Xv\275\270b\245\313\246\304\271i\301JWLV\276\254\330\314y\305\312\231i\306Jz\261\356\220\037<\252\003\n\021b\312\262\314Z\313\360,n\\\"\277\004\n\f\253\332\237\250AQ\213\262>\266\350\253+\344\325\246\354wMN(\312\3320\223|\317jY\200\220\354\310m@\250Q<\305\024R\244\230\004\022L\230\245\306\302\001p\242)Fn\021"
+	.string	"\256\204Uk\330\r\221B\225K\312\354\221t\334\f$d\006\033^8\353\240\220\316/\325\003}Y\263\217\355!\227\033\315('V\256\001q\212\360\365\354\254"
+	.ascii	"B\036%\031\304\215\007%HZ\275\376>\033&@\240\303f\021n\362d="
+	.ascii	"9\334q\352\212<\037!\013H\333T\366\324\006\216Y\370\334\354M"
+	.ascii	"\035\347\021\276.Vx\343\301\325\177\n\340\020\3206\356\231\337"
+	.ascii	"\255\374"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`\245\b=\037"
+	.string	"F\364\272?P\350\315p\225\\\024a\317@mQ\242OHePg\254[q\271zf\031\312{\245qN \216\274\33718\271`\2643\002"
+	.string	""
+	.string	"\220&\"\240\f\212h\254\330\215.\333\347\017\361\377nr\313\024\246"
+	.string	"\243"
+	.string	"\256"
+	.ascii	"\277\353q:'\217+\332\361D\247\216#\332\025+\307\347\234f\362"
+	.ascii	"k\214\021\216>\237\033}8\323F\377\255\206\005\032\375;3*\234"
+	.ascii	"2\372m1^<a\364\355\274\350\263\271\350\037\315\026\3755\026O"
+	.ascii	"K\317V\364\353\244\252\272\252\350%3S\254\226\023\305~\235X/"
+	.ascii	"\023_\226\350\313\231$\366\312\210\355\022\261\\!\372{L\020\177"
+	.ascii	"t~x#\017\030:\334\310\341qN\376wM7\034\355\324\360EJ\251\252"
+	.ascii	"\246n2\364\343L\f}\244y\241\257'\201\205\037:\377\233*\332\331"
+	.ascii	"\337\177\033\330\376\3224"
+	.string	"M+\364\363\230\377\001\210\t\213\365\325\233\225\245w\365\352C\302\322\307\273\322\217\324\325\317\343\352\353Y\351\357U\351\363m\365\355\264\372\216\326\336,Y\275`j\257\225M\323\364G\320\267X\275Xv\323\276\241\356\027\242\322'd:0K\342M\351\327I\351\0172\257\372J\223j\307\242\\\316\te\277<\271\233\223\035\236Mv\3132\351\0132\227l\025%\027\322%{#\203K\322\017d\"Y\365\310\373\214|\322Y\344\222\316\327\261\031\272\021\351\003\032\322\247kp\265\323\252\377\247\252\357\347{f\204\312\204\364\373\004\351\317\001\351'MN\177\234\221\217\215\344\270P ;\021w\177\214\300V\312\245bC\007\347vP\256R.U\262L\336\333P\346Q\\\247a\0312(\224\r(\357\240\\\300\350\206r\224\021\017\312Q\353\023Q\017\312N\312\2250d\253{\036\224\227\212\313`\315\032\022\n\345U\327,\353\nC\007\005A"
+	.string	"]\032\344\217S\274\264.\205D\3034g\233\342]\256\330\202\037\023\005\277\245\365\b\305K\306:M\254\264\356\352\211\351S\373Z\023G\255O\312}\234\326\227\232\2471\361\022\367\227\2521\361.\177?/\275\\\306z\303\272\364\212\211\365v\t\353\365\302\245WkK\357\226\226\336\024\254\003\3373\342\036\215\217\220\327\254\354\2141)<\311\330\311\3311\304^\223B\2762.\303\331\332\373\234\220\243\254\033 -N\353rBv\262\366\021r\223*e\325\352G\310R\306]5!\007X\256\031\374I\215Y%>/\274\246\340\2030sa\227\013r\224\272\234\246)\326/\310\003\212\373;<K\272\251 \017PW\230\325f\t\f\262R\240uZ\323{\303\024\344U\356\0044zw\337\023\344=CD\002y\315\254o@\276Z\227@\0330q?\002\271\210\272"
+	.string	"\224y(\220\255\212{"
+	.ascii	"Y"
+	.string	"(\002\220\245\3265\225v|\207\003\262\201\365q@~R\267)\200\210\250!\f\307b)\031\221\224\024$\205Bc\320\002)*\326\001\021\240\030\305\204\020\022\214\210\204eA\364\016\200\373\355\365\371\311\255\034el\311rm\t\355q\223\273t\001\274\027\036\335t$\202=0\340\253\313\275\243\212\312\213\357}/\230\300\201\331\b2\350oB\310\316q\274\372\370\336Ydz\301\315J<\332\230/%\320\262H\311\005%\021\265L\320%A\221\305\025\300d\013\211k\221-\244\351?wK\243,[\034r\005\362$*Y\201p?7\035\222\315\266U\233mD\310I\200\3022<Z\207+\3705\331\334U\220\346*\2652\201\347\332\345\326O\337\353l\242\264\267\254\032\371Ba\020a^\033C\t\033\245\036\034\233|\332\023v\213\006\345F\302!@\353\220|\264\245o\210G\0138\037\364k\235\204\232\375\332\231\016\346\003\247\325\347\241"
+	.ascii	"\333\300>\214\337\350\037\337\033\001\330\037"
+	.text
+	.section	.gnu.lto_.refs.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"(\265/\375`z\003=\026"
+	.string	"\346\365\225E\300\330*\215\001\210\347\t\tz\203T-  \232\2140\001\322SfyWT\270\016t\n\267\315Q\024EQ\024EQ\024\005\246\365\302O'|\336\352\337\374\335e(X\345K\257\277\376\177\372\377\377I\204\335\310\226){"
+	.string	"{"
+	.string	"\217"
+	.string	"\364]b\373)\374\022\354\277\371\3625 f\371}\374\236\211\357\267\200}]\007\330Wf"
+	.string	"\373\266\216\331\0274\314\276\237Y\373\202\277\354\273Z\265\007"
+	.ascii	"w\026\270\247R\177B\375\004\337\224\332C\363A\324\3569\355\361"
+	.ascii	"\364;o\031\335\"\375\213\351W\245W\225\366\224i?\225\366\226"
+	.ascii	"\322\233\344\213H\017\"=\n\235\022\3553\364-\340\376\355\177"
+	.ascii	"\276\227\240\335\373\354+\367|^\334w\177\337\363 \260\207\325"
+	.ascii	"\375U\34335{\253\356\254\272\257\352\256\252\273K\335SuG\325"
+	.ascii	"\3754\177\326\3354\277Tw\322\374Q\255\013\252\373\247\356\236"
+	.ascii	"\272{\267}o\333\316\361\247\276\247\376\326i\274O"
+	.string	"\365\332~\013\337@\370+\372\033N\363<\016\321\376\215\330o#\364\327\210\355\317\220\3732d\373;\263\327\221\375\r}\233\330\347b\273-\3664\242\235\300\353e\242=\224\377\n\275k\266\267d\037#_\025\307\344.`\3670\363_t\277j\355\240\326\356\351\306\251\275\203\3558\260\317\335\274m\326\300\247\205\336\005{\326|\027\327\236\222\331O\337\233\016\354%\371#\330\203\257\227\253\335[\375\302\266A\275\0366h\310\200\341\202\005\271o\205\032_\n\270_\t\021\262\320\037\313\025+Up\377\024)P\2368a\262DI\022$\257\377H\021\"C\204\004\001\362\303G\215\337\203\307\016\035\265\326\334O#\267\037\243\276N\356q^\237\013\337V\363\006p;M>\245\037\006\357U\007\361\255\261\301\356M\006\361\034\272\353\350nCw\034\375\033\335i\350\327\350^`>\001\272\317\274\370\354\333i\214\323o\017\217\207\337>\263/\223\263"
+	.string	"\365\352\254`\217\340\276r\023\304\027\306\013\027-X\254P\361\316o\212w\342\213\342\204\211\022$\344\357\210w\366\025\021\342\346\027\304\007\017\0358X\230\277\023\244\316\276\020\344\374\251\310?\n\202\277\211\221 9\377\f\335\037c\376N\3679\271\327\310\267\311\235\266{\272;C\250\021pN$G\002\td$HR\216\036\320\242\252\031;\020\320vs\354\2243\260\317\354\267\237?w)\322:D\032\204S\2543|\237\206\227\332\034:\016\222\366X\177\307\\\235\003\304\300\2615f\362xza\232]\263\207\262\330*\036}\212\220b:\264B\017\217\241"
+	.ascii	"\323lu\032\240\033L\3632\274tB\327\363\306?'U$VD\001"
+	.text
+	.section	.gnu.lto_.decls.dae2bd6c6f23ad5f,"e",@progbits
+	.ascii	"(\265/\375`\231h\205\254\001\032\270j\230S \ni:\215\001\004#"
+	.ascii	"\242&O\317\200\027c6\007\2220\316\001d\n\003HXNS\021\353y\350"
+	.ascii	"s?$\361<*x\226\225\321\244k\f\333\255\313\013\f\327u\330\024"
+	.ascii	"O\262\354\2314I\222p<\351[j\262'\322\034\311\3442\027~P\034r"
+	.ascii	"\357-\245\224)\032\b\243\t\363\t\200.\037\253VDu\334\\ \330\301"
+	.ascii	"Ic\266\367Q\t\004\b\020 \312#_y\342\204\362\211\274\364\211\264"
+	.ascii	"\364\211f\350\023e\351\023\305\3207\006\323\257\236,\204\017"
+	.ascii	"W\331\315'\252\3226i\223L\n,\222\371\241\244\376\320\233\376"
+	.ascii	"\020\030\375\241+\372CI\364\207|\350\017e\351\013\341\321\036"
+	.ascii	",\222y!7\372B\\\364\205\234\350\013\005\321\027\272\241/D\245"
+	.ascii	"\037\224\324\017:\243?\260H\346\203\300\350\007\035\365\203\310"
+	.ascii	"\364\203v\350\007Y\351\353:}\315F_\217\321\327G}\335D_\213\351"
+	.ascii	"\037-\222y\255\245\177\002\322?\355\350\237h\364\3170\372\347"
+	.ascii	"\023\375\323\207\3769C\337L\352\233n\364\3150\372&\024}SL\237"
+	.ascii	"\316&\2317\271\364\331,\222\371\322\217~)\247_\222\321/\243\350"
+	.ascii	"\227?\364K-M\242N?\247\321\317Z\364\331\232\350\277\331$\363"
+	.ascii	"\231L?\207\351\303Y$\363\371\206>\336\3237\311Ub\221Jw\t\034"
+	.ascii	"\253\032>n>\306\323!\330V\311\374\236U2\217\341\364\361\026}"
+	.ascii	"\214E\0377\321\307`\372I\213d\036\317&\231\3078\3641\f\375\253"
+	.ascii	"G\377\276\321\277k\372\367\250\355\266H\346\007\233d\376\327"
+	.ascii	"\007X\213\257/,`=\270\024yi1\353q\363\335q\277,\222\303\345\261"
+	.ascii	"\215l\036#V6n\3765\323 \330\333r0\355\336\236\345`\376W\007\207"
+	.ascii	"SJ\033\020\"98\320Wd\276X\301\341U\204fe\344q\363\177\275n\350"
+	.ascii	"5[M\376\334|m\\*)~\262n\376%\323\377\345\262\310\333\3655\242"
+	.ascii	"\335\201\b\212\027\331\230\233\357\214[\343\177\220\245\342C"
+	.ascii	"\356\354\346K\343jY\344\335\356V\320\325q#\367\336F9J\f9(7\377"
+	.ascii	"\026\321S{\357m\357f\236{{{{\366n\346\225\021t\273\352\330\351"
+	.ascii	"\335\374\273\233\365?\350\214#\026\206\004\371\265\013\3437\306"
+	.ascii	"\305zF\013\2432\356\275\217J.9}\336n\366`\223\314l\221\314\337"
+	.ascii	" \372\277W\327\352\304\262\305#\353\346*k\346k\367\272\261\373"
+	.ascii	"\201w3\221E2\377Ku\267\211\005\004\351&\220\305b\367\276v\303"
+	.ascii	"\366\006\263\367\336\240e\334\001\362s\263\3356\311\264oL\267"
+	.ascii	"\201\n@&\204\n\240\t\214\216:\266\204\374\321\273ujO\310\334"
+	.ascii	"\374[=\353\007gi\205m.{\037/\b\355yB\306us\236\222P\225%Z\324"
+	.ascii	"\334\374\273\245\017\002\034\235\021\r\033\253\246\b\357]U\307"
+	.ascii	"h\261\214\311\373m\235\275c\355,\037[\307\352\261x\354\036\233"
+	.ascii	"\307\366\261Ik\307\342Y\244\275\263on\341\330\270\337\343\336"
+	.ascii	"WW\322\324\225\371\231n\357\254\233e\263pF\022`\005O\262\313"
+	.ascii	"\317tg\327X5\026\356+S\261sg\275\3306\013g$[\361c\267\264\241"
+	.ascii	"c\346\314\035\243\225\243U"
+	.string	"\263p_\005\240\242\227\334\373x{\345\267X\356l\034K\307\302}\345'\177\222{\357\213\3603\271\261jEx\357\037s\214{\037\017\302o\261\374#D\260w\226\214U\353`\265\367\217\025(\260\262S#\017o\357#\b\020 \224@X\260\363\021'I\207\374[\271[:\277\315b\257\3309DHrx\271\271\331\316Y\272\3339V\316\266sB\b\333\273\312\3161\372\263w\225\221\265\026XkA\2462\306\304\213\231o\317h[\205\351V\316(n\355n\311\315\267_\364\355\262I\346\005\026\311\274\225\242o\231\350[\"\372\026L\337z\351[-5\277}\263h\254Z\006\210Lx\250\335|\033C+\331$\023[$\363\036\320\207\263I\346\241\364\2236\311|\005\364\025\240\177\013\206\213\355b\331l\330\336W{\357\rF{\224\370Ir\263\rc\305X$\007v\355\366\213\335\362\262\352\270\217{\037\215.\031\240.i7_"
+	.string	"\372\226\003\023\357\355Y\016L\373\205\351\026\314o\253X+Hf\327\327qs\331{\033a631\376\334|-\222\371%\375\201M2\315$\323\236Y4\213\234\300j\371\b\021\216\251\320\266\225\275\217F\026\002M\t\244w\3637\320\267i7\022\333\"\\H\337N`\332=;\201\371\253\203,\222yd\221\314s\261I\346\2176\311\324\026\311\374\005B|\3507'\360\337\252\253\265\"\314\302\177\226\270Z\006\270\027\\\020g"
+	.string	"\376+\364g\245\374\200\337b8\236\337rx\235\377}\256\224#\340\361\337\303\177\202\200w\234\"r\234!~\234\227Q\370\357\227\377\212\371o\230\377\272a\031^\377\355\340\331\376\371\204?\227&\240\375\267.;\340\307+\t\314e\344\277G\262\205\006\3747\202\013\344\317(\376\273\302\005\253\223\031\360\337\242\377\316\371\235\377Z\362\374_\2737\274\356\022\024p\240\274\200?\233\370\263\002^\201\277L\373/\\N@\022\333\375\031\001\377U\302\370\342\345\003\240\220\r\360\337\013J\\\213\207\276\226I|\220\225,\206\r.\210ky\002\376s\350\307pr\001~<\367c\272?\023\300r\340@\036\300\237\005\200\327L\302N\016\200\006\362\b7\004\022p\270\036,\300\031\252\256\234\013\234\350`\265\263\b?\206\302.\320\337\304\363\337\030o'\244\210~\263\316\177a\334\267Kb\203\265\025D\r\277)\367_\022\377\035\200"
+	.string	"\376;\302\177\261\376[\200\253u\241\337T\363c\241\034\302\217\3232\b\377\225\361_\253\377\226\360\337\030\377\375"
+	.string	"\230<\302Lf\372o\213\377\356\377\272\370\261\232\037\257\371\363\007\267\352\302\370o\326\005\301\177\251B\360_\032\367\304\237E\374\337\3406\200\203\333v\265N\3427\317\374\271\203\377+.\210.?\006@\016\001\"\002\031D\006\300\217\313\254!\177\300\021P\201\253\374\330\312\2379\370/\006y\203\377v\270"
+	.ascii	"\007\230\002\017\360\3407\201\374x,k\360\333*\277\035b9\3303"
+	.ascii	"V\r[\300F\376K&g\360g\f\224,\333\006\331C\216`\355\030\374\346"
+	.ascii	"\206$\231\303\177-W\351\317J\377\245\313\033\336\341I\277\031"
+	.ascii	"\002\237\327\2225\374\030'\377\263\335\275\253\247\264\201\305"
+	.ascii	"\220\223~\301_\352\301\r\270\376M\036\277\275\360c\213\341\347"
+	.ascii	"o\346\370\317\347\256\316\215\376r\356\277\236\377|n\367?\315"
+	.ascii	"\377\274\353u\310I\377mc\373\321_\272\301$\230\300\302%\020\020"
+	.ascii	"\202\243p\374\233.\366Hp\340\002\032\001\352\267\327\342\257"
+	.ascii	"\270\371\233j6\272q\376\347\337\304\300\237\213\376\254\377l"
+	.ascii	"\376\331\376\330\317\217\365\374\330\356\307u?\246\363c\272\037"
+	.ascii	"\307\375\270\315\217\327\374\370\314\217\327~\034\346\307\310"
+	.ascii	"\037c\371\261\225\037O\3711\223\037+\371\361\221\037\013\371"
+	.ascii	"q\330\217\177\374\030\354\307<~\274\343\3079~\354\365c\033?\346"
+	.ascii	"\372\361\326\217i\374\367\315\217e\374\030\353\3070~l\365\343"
+	.ascii	"\375\343\017\374X\205\037\273\370\261\324\217\211?\206\372\361"
+	.ascii	"\006~\f\3741\210\037g\340\307\030\370\261\005~L\201\037G\340"
+	.ascii	"\307*~\f\201\037?\340\307&\374\270\001?&\341\307&~\\\342\307"
+	.ascii	"\b\370\261\001~L\200\037\223\370\361\b?\016\341\307\037\374x"
+	.ascii	"\351\307!~\214\301\217+\370\261\004?\336\360\343\244\037#\375"
+	.ascii	"\370\350\307\026~<\364\343\363\307\345\217\361\217\355\177\367"
+	.ascii	"\376\013"
+	.ascii	"\350\277z\377\315\373\357\335\177\365\374\327\356\277x\376\353"
+	.ascii	"\366\337\272\377:\371\257\222\377\326\371\357\234\377\322\375"
+	.ascii	"\367\306\177\345\374\227\306o1\3747\316o\315\374\337\373\255"
+	.ascii	"\331o9\3746\202\337\336\377y\377\215\373\257\232\377\276\375"
+	.ascii	"\327\314\177\311\374\327\204\377\035\376k\371/\210\377k\377W"
+	.ascii	"\374G\341\277m\377e\373\357\332\177\325\376\373\344\277K\376"
+	.ascii	"\033\344\277^\377\345\372o\215\377n\375W\353\277\035\374\227"
+	.ascii	"\203\377n\360\3333\377U\374\226\355\267m\277\225\340\267I\277"
+	.ascii	"\315\360[\244\337\342\337\376\377\t\377\375\374\377\363_\357"
+	.ascii	"?\217\377j\376[\260\267\267\267\367\027\375\327\020\345?A&\177"
+	.ascii	"\336\033j=\356\030w\342\354\275\355\036\355d\255\n\314\303.\341"
+	.ascii	"\366\276\022\243J\200\230\215+\261\035YH1\033\027\262\220b\233"
+	.ascii	"\352j\t\325\205\256-F\225\205\334\373\302\325\025\325\211\260"
+	.ascii	"}!\013\271ml\030pl\330}\024\243\332Wa\373\302\276\332U\036\262"
+	.ascii	"\256\304ld!\253l\\\310B\212\331\330H\261}\264\257\252\272d\\"
+	.ascii	"\355\256\013\033)f\267\221a6\216\262\220a6\262\220buv\n\r)8t"
+	.ascii	"\324\305Q\222\306\266e]\355\032[>\252\272\216\340\262\216a\233"
+	.ascii	"no\313%\306\356\332p{_\260\267\217\260.\272\252\035\226\315\n"
+	.ascii	"\256\206\025\230\2520{\334{s\330\262\032\013\333WpTv\303e=\t"
+	.ascii	"\333\373\211\325\323\336\332{\357\020\250\216p\373\210\205\243"
+	.ascii	"\022\342ck\305\330;\202}\334{ko*\273\341\366\336T{\357\263\313"
+	.ascii	"\307q\357\036GY\306\255\255\275\277\224\266\266\017\252\266\030"
+	.ascii	"{_.t\330ld!\307\302\230\332\324\220\306\215"
+	.string	"u\244\262YZa\333\270\351\304\2724\222\352lk\355\275\255\036m\264\341\225GK\251&(\254GZ\325\315\217\340J\231\346\355\026Y\276\225ZAY{{} e\314I\031\336\356\352\n\361\bx\350\277<c\246(\216Q\212\325\315nAE\354\330\271\271\371\021\310\320d\216\031\276\244\324\270\371\021l}FDgO\030.Gd\23399tle\2306R\322\344\335\374\213\325\245\207\321\313\327\212\256\2166\r+\036\306\022L\271V\212\261\3102L\371\305J\031\246\344\342\304\t\223\036x \214\252\306\224\034\321\371\034\324\350s@\243\317\341\214>\007\267-\307\272:TT7\037\004+G\214XT\310\272LI\222d*\217e\024)R\226\030\315\224\224i%ZyV\"K-e\226R\315\"\313cy\345%\026[fKy,\253X\266\242\252\343\356\212\200\230\224<f{\037O\344\035\032mG\271\310\"\231\347\200\324\347"
+	.ascii	"E\237\303\020}\016`\372\034\260\364\225\364\364\225\356\350+"
+	.ascii	"\265\201\362\004\320\2251\257\311\313'\177YV:\271=,f\323U\007"
+	.ascii	"\306\315\366h\223L%\213d\226F\246\227MJ\036j\202\220\335<\304"
+	.ascii	"\244\\\002v\026\b\356f%G\013b\342\234y\271\371J_\364\377\222"
+	.ascii	"\254<R\"\261\3102I9$II\2444\262%\rL\b\017\2462I9\346dl\214\n"
+	.ascii	"\236\211D\213\020=\235?\224E\216FDU:\304\274\271\371JB\364\225"
+	.ascii	"z\350+a\351o\330\323\337\260G\377\245X\031dHK\0252\271\233\377"
+	.ascii	"\227a%\220r\205\362G\351\303\"\313 e\217\227`w\205\333\034\231"
+	.ascii	",\0032eR\362\340\351\350a\374\332Q\006)yp\031\367>\236^\242\314"
+	.ascii	"\005!\312\245E2\277\341\215\376\2067\375\r_\3647L\321\337 D\177"
+	.ascii	"\003\227\376K\034\245\227=\206M\001t\343\245\327o\017\013\343"
+	.ascii	"\316\226\237\233K\033L/o\024\331\230\242\305\313\315\027\312"
+	.ascii	"\256\022\306Yf\353\340\322R#\177IKC\245\352\346\277\334*\265"
+	.ascii	"\312@p[\373\346\222F\036\226;\0317_\203\236^\302d\310\2143/9"
+	.ascii	"\f>\353\322ki~J\030\271I\276\202\317\272R\f\221\221\215\307@"
+	.ascii	"\331\210eH\326^9\243\314*c\344@%VyU\356\262\252\224QR\225V\026"
+	.ascii	"Y\302\310~\236\365\362\237\347\343\336W\371\254\204\221\321\362"
+	.ascii	"\026|\326\245\307\304\001J\346e2|4\236jcx\311|\326\245\204\221"
+	.ascii	"\3272\036>\353z@Z^>\343\362'\231\227\22402 \032\331X\302\310"
+	.ascii	"Yv\025\025\211,y\216v\357\313\0223\021\344"
+	.string	"k\220\243\207\2166\311\264f\026\311\274\2061\372\032\216:\343\375\371,\213\311}n)\306\017\231-7\363\341 \224\245\316\236\225\233\257\241\210\336\223\307\3444\370\254+h\306X\235\244\236|g\221yOV\223\367\34459\317\276\361\301\025\016 n\240\031bi\314l\247\303 \031\223r\3635|i8oI\213\305\r\030\233\2256X\3200\275y3\316\311i\203&\031'\n\0266f\320$\367\336pU\330\354d:\371N\306\223\347\344\272\234\314s\271\216Ef\272,\367\314\226\333\236\261\350r\2345byK\356\275\207\276\330\262\3502\344k\310\241\257!\206\276\006+}\r[?\t\220~\222\037\375\244>\372I{\364\223\354\364\223\356\350'\275\321O\342\242\321(E`\016\313\216\233\237dE\377b\271}\255(h\357\267+ \230\311d\276Vtu\334I\3149\264:]x{\357\377\371-\237\261\310l&\227y>\202"
+	.ascii	"\241\0244%\210Y\f3?\351\207~\322\r\375$-\375\244*}\303l\222\231"
+	.ascii	"\201E2\237AO\007m\233d~\311`\312)y\206\370\200\363%\303\030\375"
+	.ascii	"\fY\3643 \311j\346V\224=\347\346g\320\3229-#-2k\371F\356}\264"
+	.ascii	"\200\253t\260Y\273\371\366\203i\364\301<R\037m\273,\222y$7\372"
+	.ascii	"HZ\364\221\312\264\025\223\316\031\034\330\315G\322\241o\255"
+	.ascii	"\224\265qr7|\326\245\325\306\330$\263Y\216\342&9%W\311T\262\024"
+	.ascii	"\213\314f\031J>f\263\374\344k\026\216\313\206q\326A\0254)y\360"
+	.ascii	"\366\336A<\350\214\355\020\312\307p\247\217\001\215>\0067}\f"
+	.ascii	"k\372\030\276\350c@\3236\314L[cVBV\305\314\030\227\2333\331\315"
+	.ascii	"Hr\222g\262|\344#D8\321U&\313{WYkA\221\265\026\224nJ\252\322"
+	.ascii	"\314|\fe\372\317F>\344\311\2612\273\371\317E\202\222\244\341"
+	.ascii	"\332q\363\355\0269us,\226:n\214qx\177\214]\340\3441\351Y3\"\325"
+	.ascii	"\310\210s\231X\270\257\002\230\341IZ\251cc|\343\347b\341Q\323"
+	.ascii	"\006\020\035&?^\214\331*ge yF\316\221{d\261|\225}\344 y,\377"
+	.ascii	"\310X\231H\206\221e\344!\231G\026\222i\344\025\262V\006\313\\"
+	.ascii	"YG\366\312a\271+\327\310[\031G\376\3126r\214|\303\"\363\216L"
+	.ascii	"\365\333&W\331\241\271sl\254Z \246<\214\367\305\230\347-\357"
+	.ascii	"\300\200\362.\302{\013\311b\324\353Rf\217U\023\263%\231&\311"
+	.ascii	"t\027\206\211\017\306\003\323\345\316\032;m\214k\366,\026\272"
+	.ascii	":\3112if\030\321\310\375\341\222\234\313;\360\234\235\244^\336"
+	.ascii	"\201\321l*\273\020\232\224\225\375\301\333\373\210y\034\261\321"
+	.ascii	"\206\001\031o\233d\036\203\227\376\361\336\363V\313\300\336p"
+	.ascii	":\331\253\221\347f\034\210\351x\217\2020nm7\237\026\311<\206"
+	.ascii	"-\375\013z\372\027\346\350_h\243\177\341\212\306}\262\0166C\226"
+	.ascii	"\334\374\013P\364/\370\320\2770C\377\350\216\376\321\033\375"
+	.ascii	"#3\372G^\364\217\220\372GU\364\217\312\364\217\304\364\217f\350"
+	.ascii	"\033\345\3217r\243o\244\246oDE\337h\211\276\321\017}\243,\375"
+	.ascii	"\242?\372Et\364\213\330\364"
+	.ascii	"\213\232\350\027\361\320/\242\322\267\020G\337\302\027}\013M"
+	.ascii	"\364-\214\351[\360\322\267p\245\177\374v&w\321\002d\227q\303"
+	.ascii	"fn\017\033\226\025hG\216\233\357\321&\231\037,\222\211\3110\035"
+	.ascii	"\227\031\372\242\006\020\223\233\221\360\2306\013J\320\206X\335"
+	.ascii	"\374\3436<\205(\254-\316\233\233\017\002\233\032\311\271;qv\306"
+	.ascii	"\274\201\315\341\211\253C\304\b\235\037ayL\330\212\315\017\261"
+	.ascii	";E\352\264\221\333K\316\325\031\3033w\355\234\361\221\034\253"
+	.ascii	"#b\\3\306\314\n\3112'i\214D\232\250\201\022\345\r\355\013\223"
+	.ascii	"d\234\254\037B\354\214!c$\211\205\340/\330\b\356\202\323p\025"
+	.ascii	"\314\005\203\301?\260\017\354\205\233`4\234\005\037q\017\214"
+	.ascii	"\005G\3017\260\026\376\302@\260\023\274\004\203\341.l\304d\030"
+	.ascii	"\t>\202\245\340,\314\004_\301a\370\t\306\201W\300c\230\007\246"
+	.ascii	"\202e\340\034\370\f#\261\030\254\004\327\300[8\bf\303;\360\020"
+	.ascii	"l\206\223`.l\005o\301D\260\r,\206\241`5\254\005\227\3415\034"
+	.ascii	"\006\027\301:0\r\354\005\317\260H<\005\3038\216\201\261\256\224"
+	.ascii	"74\222h\\\250\\)fkH:xF\2540J\214eX\274$\347n]\035\021\262\313"
+	.ascii	"\004\006\2334,^\314\312\262t\031\203fH\017+pf$/R\313\025#\232"
+	.ascii	"\232\025\343\205\262\245\312\217 xI&<\345\346\301\033\037\331"
+	.ascii	"\026`5'\331FN\2406pZ?\200\370\021\201\r\211qn\316\230\2371k\270"
+	.ascii	"\300,)\273\362\205\b\236b\343X:\370h,A\013\335\032\031\221#n"
+	.ascii	"n\331\221K\262\fO\271O\254\232\"\252\243\275\207\2401\356\275"
+	.ascii	"\321\332\216\334*V\300\264q\263E\345\346\216q\373\221D\023\223"
+	.ascii	"\344\022A\322\306x\313\246\210\031\362\3379:\275\344-\273g0\262"
+	.ascii	"\030o\2338\031\311\025\322\3600\252\221\3732\226Q\031\022\246"
+	.ascii	"\312\262\025U\035\355+\2536\370jMr\357\343\035\203\247\3342C"
+	.ascii	"\200$/\032\236r\273h\231\222\334\373\250dVqs\022\304\336\310"
+	.ascii	"\332h\223L\033\303\"\231'\352\243OD\247OtF\237\210\213>\021\024"
+	.ascii	"\215\367\177\223\327\356\356\331 \034h\306\210\2719\020\0164"
+	.ascii	"C\314\225\233O\264D\377\277z\327\317\375s\363,\362\002\272}D"
+	.ascii	"\270\263j\370h<\267\214\031\271X\027\320\305\263l\370\310\246"
+	.ascii	"\261\322\220l\331c\325\212\250\216\266U\334\221\021\"\334@<\300"
+	.ascii	"\241\375\304q\365\351q*\351\262gg\347\346\243\025..\262\260\257"
+	.ascii	"9\247\217/bjz\207Z\034\033-\253\233\265\r\033:\207\355\352\332"
+	.ascii	"!\240\211c\322\003\357\032\307u\216(ium7k\257\257\235\ri\203"
+	.ascii	"s\263\276\341\201\f\375\353\256RNw\271\003G\343\346\031\237\241"
+	.ascii	"k(\205Q\351\351\340J\332\030\025\274\031_`\300t\r\275\305\301"
+	.ascii	"l\316\336\322Z^2\250dQr4\332\002\327\247\207\246Q\016\261;\003"
+	.ascii	"\004\353\346wp\247\263t\326i\334\222\323\346\252\251\261\326"
+	.ascii	"v\363;P\323V\332J\307\240b\034\n\033\203\303\216\206q\035\343"
+	.ascii	"\334;\231\334\035\351n\326WAgnxT\271\271\312\237?\232J)\214\312"
+	.ascii	".\2033^Lz\340YB\243\311\315\277\336\327T\267\307P\035\273*q7"
+	.ascii	"\237\200\316\275\353&\210\232$g ,\227\003\207\223\233\337\201"
+	.ascii	"\023\375\273\333cO\022\252\233\337\301\221\273\337\235~\224\302"
+	.ascii	"\250\370\230{\266\340\260\341\355\331\301\375\311\373\351\347"
+	.ascii	"N\0259;DN\274\030O\274\264\234xg\037\0343\366p\271\305\331A\303"
+	.ascii	"\204O\371E\b\314\236\\\362\346\207\200\323\243\307\274\263h\233"
+	.ascii	"\253\003mp\322\230\005\222c\246\356\346\207\360\202\007\317i"
+	.ascii	"w\342mUa+\212#2\203F\362\247\235\025\224$a\326\374\017\262`V"
+	.ascii	"'\307\343\346\207\370a\307\316Y\247\024Fe\007\200\256-*:\212"
+	.ascii	"\370\271B\347\254+\347\362x\204\001\372C\207\216y\247\024Fu"
+	.string	"7D%\347A\331z\243\223\223;\351\220\024\005\232\243f\317\375\244[\023\322\362g\210\235\233O9h\340\340\316\270\257\241(d\346\332\340\374\214#\312\252\272\273r\363\371\346\3742\326e\216\016d\2336\347\031%\275\257\244\031I\356\375\365a\250\210\01795n>\210(h\320\234k\224\364\276\022\007$I\346\n\234<5?\327\254\345 t<\212\334|\246\371\232\2303:2#mm\347\231#\3061t6\340\314\374<c\026\350K\216\233\3171\247\033\221W\020\2745\2672\270\211\222\032;\320\334U\271cE&\227\271u5\360\374\001qcm\355\fc\217\216Vq4\214z\213\027\037`\201\324\256v\206\261h\233\213\tN\235.\263\275\277><\351\310\243\005\346g\030#4\2554y7\237\\\316/gdd\001\364\345\364\322&\304H\225\035\321\037\260<sg\227,\207\237\210Q\201\273\371\334\362\2657\2640\311R\356"
+	.string	"\240;\036O\344\334\232\005?U]\332\234i?\221w\206\002\345\331Qu\363\211f\3314\025<#On>\317\254\232P\035<j\306"
+	.string	"\340\013\026,&\r=*8iN\035B\270\210IR\345\257rZ9\276\332?z\024Y\321\312\203\207\363\302<\221a\305\262\221\235\305\br\363\001"
+	.string	"\326\344\247\224&\347\224\263\214\322\266\272\332?\216 \351m\025\211\202\267\263||p\"\002d\215\331\317)k\314=-lb'\224\237Q\376\240sNN\r\332\315\377\020\247O'?\237\374A%\230W\235'7\377C\033\375\237e\177\020\221\2215m\362\334\374\017o\372\037\332\23009\225\330\243\243\225\234\226q\357\257\017\232\352\f\307\02352\262SI\2076'LzT"
+	.string	"mI\236$?\225\254\331-t\336\220\251B\204\310yD)\214\352\316\304\261%\366'\213\0378WN#?\217X\270\323\002\207\345\346\337\235E\376\007\231m\270\376\370\271\371\303\326)&v\n\261h\233K\251\217\335\327\007\242\031x"
+	.string	"\261\271\371?\307~\n\261\202\214\263\305',\fH\334\032#Xx\224Ya\205\363\207\207\275w\214\375\302lJ\336\t\344\212\n\234\363\2079\307\254\241Gg\355\f\f\354\004\313T\320\222:n>\007IN\036'\2177)yIc\226)}n>\007`;v\230wAw& s\216\306\217\275\233\317\301\2143\307\231\203\217\251\027\027#\231\344\312\315\337"
+	.string	"\220~&\263\247\327\351\225\311\2246\225\335\007M\2746\300\243\377\323\306-\362\264Q\336\371\020\266\27528#&%O\036\226\330\224\233\277\001\032\375\237\\\026yr\225O\312\254\275oxhK\333\200\213\376\317\255[\344\271U\332Q\n\333^\035\220\201\223\223d\250\354\233\277\201Q\377'\r\213<i\224^\345\325\2562b\266\321\312\203\207\027e\f\017\261\233\277A\016\375\2372N\031\226\255\274\332aG\314?Zx\306\336~\300\270\371\032\310\351\377\304:\261\310h\360v\3028a@\261Pd\207\033\330\315\327`\213\376\317*\274\323\252\234\023A\217\036\r\236\350k"
+	.string	"d\017\357\334z4\300\241\257\001\326\037@\231\314\003\325qs\331;+'ef|\3643\210\323\277\231\207g\372\311d{<\320\223\301\031\375\f\272\364\351\243\307L\036\027\263\233\237\201q\317\036\363.hw\351\261\300\215U\021\r72ZwN\306\264n~\006;\360\3401\363\030"
+	.ascii	"M\232\220<?\340\354n\346\tj\302\007\356\306\315f\222h\205'v`"
+	.ascii	"zuuf\035MUG\305x\004I\r\343\315\307\240\215\0349f"
+	.string	"\035\003\324A\223\264rv\216\3341\351\334\254\263\004\207\035<7\377\316\234\363?\b\003\2749\"sL\272<\265\263\253\222\206\306\223\305\304\317\315s\331\317Q\251(O\306\231\235\233\217\001\032\0348f\034\273\273\f\340\343\203\325Z\223\363\022w3N&\323}\226\264\261\301\200\314\r\334\335y\0339\332Ws\226\030\303\3641\270\241\177s\315o\261\330=\223\315dsw\002`d\355\2522"
+	.string	"\344 \203A\225\376\005x\322\244\261jJ\233\312\356C\0232o!\b\200\347\t\334\315\277"
+	.string	"\315\031\223\315|\273=\3626\262\253\252\230r\350\271\340\250\177\201\0207\267R\216\001aU72\350C\005'M\221\017\254-\275\233\177\301\r2d2\231R\030\225\335\007\177\264\230\340\031\335)\003Vv\363-H\352\337lC\232m\226\355\036w\027\223\023'ef\273\353-\204\355\301d/\320\315\267@\215\0301\346\232\005@\016'N\312\360\202\346\322\214vkVmh\216\r\263+7\337\002\244\t\306\004cz\321s2\352\322\356h\334|\013\236\230[\314-\246\027M\345&\315\215\025\025\3325\275\254\r\241\362\261\347f\223\013\235,Q\316\326\240\210\231\342\345\210\026-i\026\200\245\245eI\013\332i\232"
+	.string	"\271\371\026\3148;\363\020(K\226+zN6|f\300\301s\345\312\327\030\260a\234\221hb\345\341\215\n\025\263\312\034cI$\313XgV\t\372\"\353\302bf\266\306Xc\211\216\252\233\357\201\314\214bF1\237\304\255\r\341\330\212\363u\363=\200\231ef\231\371d\212\266\363\206\r\024'7\237\254\021y\271\262\367\346\201\206\321\"Mc)\307\200]u#\203&q\025"
+	.ascii	"2\225\230J\314%Av"
+	.string	"\037\244\220)\362q\306J\326\315%\245\234\020Z\237.Y7\277\002;CL\262!&\022so{\f\343\352\332_8>\020!b\"\261\273k\357/\003|1\222\334_>>\224s@\374\314\271\3717\217\334D\342\206\261\366\02497\233F\212\214]\276\2227\233E2\331\377 \2432Q\346\256\324\376\007\225c|\354\254\335\374\n\314\350W0E\337\f\263\246\330\330\327<\\\035m\032Xh\214L\364+\030\323_\373\1771\260l\372\310\230s\363M\037\326\374\241\303\004\3625M\325\245a\306\226\267d\005<\364+\330\322_\263\367j\357*\f\214\206\\\241\313q\363\315/k\366\370G\210`\3520\301\254Z\336_\233*\317\007yz(\340\243O\001\033}k\325\314\337\334q\2134w\224s>\204\355\033\0354\201S\366\247Tr\307Eu\363)\bc\3460s\224o\300$)h\242\177\363\206\251ez\3413v\337\350r"
+	.ascii	"\026\240$\005;\364'\320\323\277\311ej\231]w\313\233\313\256\272"
+	.ascii	"\341a/m\207\370\004w\372\023\324mm\3416\234\025V5\026B\223\264"
+	.ascii	";i4\237\2613\270\233?A\232)\303\224a\322\330\033sR\206g\316\270"
+	.ascii	"I\003\263A\342\004i\331\2628\371\"r\363'\030\303\302\272`/\257"
+	.ascii	"\266\0203\343\336_!,4\241\242\305\352\346O\260\202\376M\030H"
+	.ascii	"\023\206U\263h\233K\b\313\213\216\216\f\b\217\234#7\277C\236"
+	.ascii	"\376M+\323\352\\\263\243\177\223\312\244\272^8kW\211\221hr\f"
+	.ascii	"\361\016o\366\366\256\225\275\260w\025\035[\233\376K@\267\310"
+	.ascii	"\022\320\265R:n*#<z: \365_\352Yd\251w7\003\302\252\232\220\250"
+	.ascii	"r\343+\304\251\247\312\016\354\346w\240\322\247O\231w\367\336"
+	.ascii	"\333xn)R#\271\277\272>\374%\336\313\274\337\321\343\343\005\312"
+	.ascii	"\315\277\273\333\377\240\234\243\255\n\233\233\337A\310\335\335"
+	.ascii	"\034\343\376\372\372`\367 a\303r\363;\344\320\243\007M\234\220"
+	.ascii	"\2178^y7\277\303\326\177i\207,"
+	.string	"\355\254\236\022\332\276a4&\203\313\210\267\367[\210\263\217\325\235\0347_\0029x\360\334.\006\354\275\251\216\233\253\003>\253S\006\306\315\227\240M\327)\tc&y\363%8\352:\026\360\202\374P\242\217Cl?\272\340\270\271\244;\303\344\310\321\211\311\001\016\331R\346\346K\300\303(H\216\236\025\270\260\201S\306\225f\364n\262w\025\027\263O\232\0044\364\3136\245\233\227p\310\022\256|c\367\336\373kS\3651\335\276\276>\030\231\201b\345\317\335\3137\277S\302y\262\304\313\315\217\300\217\376o\177\177sWu\355\275o\224\307\335eEd\376\366\266\264\366\303o\301b{\301\003&\374\210GgP\223PE\211B&\254\251\023\322\237\226D\244E\024i\023Z\f\252h\323\321\372\223\"\256E\341\320\004\007\204V\337\b\246)\265\351|\021\214R\327\240\324\t\034\b\372\323\222\024\224\372\0028T\300p\305\323JDI\220"
+	.string	"\024q\330\224\246\304& \2322@8T\205\304tE\245  \005\245\212(\001T\243\222\376\264T$A\002(V\230(\341#\341\304\003N\360\231H\341S\201\002J]E\024\211i\013\225\b,\252\301\240\ne\006Q\241\223\252\302I\250\266P\323_\232\242\210b\212\210T\304T\302\211\027\301\250\250\022\031VU\210B\250\242\013\260\220TB\n&\254\252\020\005R\t)\230\220\244\nQ"
+	.string	"\325\250\016MQ&D"
+	.string	"\250FQ\260\246\013\230\"\036\005\321_qUY\210\220\022:y0%%T\203\036\2040\202o\004\022S\"R\240T\360'TE\020\213R\"D\270\030\022\237\326\241\360lB\323`^\213\302\341\257lZ\205*1h\026\207?\241\251!1*\n\365\t\325\242\320\237\226D\244D\251\025M\233\216P\254\251\n\240\032\245!]\323`\024\324\320\204\005\350\212\236 \241\210\"\203\223PM\341\227bU\205\352Q\212\242zTT\247J\270@+@T$\016\327\341\t\026\222L\244\210\222\332\300p\030<\3320E\374\021M_\n\245\256B)b\005E'4XB\n\034\236`\004\f\016\2170\214\260T<a*\005P\r\242-2\b\005`\t]\321\023S)\326\"\032$:\"\261\204aH"
+	.string	"K\252\005%\023\303U\252D\032\214\202BU\244A)(\251\337\257D\207b\252\002\250\006Q\t\244+\232b*\205\006\241\017\230\226R\025T\025Q\351\252\342G\264\300\304\264\204!Ii\004\323\322*\224\032\232\210JW\025\022\244P\352\0325\034\232"
+	.string	"TSXS'\"\272^\370\323RJLr\221\242\200\256\350\t\n\244(\252C\351\212\246x*\246\304\2464\305T\212\f)\212\305\3647$FiH\243\206A\025-\210R&\210\026\\\240\304!\027h\2125u*\222\022\246\353Z\342\004\2125u\342PdQ\002\203\321\232:\031\021-\020S\026PR(\374R\254\251\323Q\322\007K+\021\215ZJ\361\013\242\277\016ALKB\2658\0244bi\370\033\322"
+	.string	"\302\322ZD\203JP\351Z|\241\302\250\204\341\n\t8\204\260T\224\032\252-Rb\n\022\224\",M\245@\241z\376i\351'\342\327\264!\205\013\351\212\256*\206D\"\t\304a\t\025\224\177Zr\222b\221\002E"
+	.string	"\203\252\024\013\016)px\002\221P\221E\t#\341P]\177i\260)=\361#\022\005\245+\232BE\272\242A\251_\020\375%\025\213\252\003\212JH\177h\n\023\2530%\022\245~\034\3205U@\206u]W_\361\004\013\305\024\351\212\002\243\244\216\376S\211\2510u\322\017a\004\017F 1u\236\304"
+	.string	">\030\300\007\346I\f\200\211i"
+	.ascii	"#0\351\217\300\204?X"
+	.string	"jj\222R"
+	.string	"P\210BA\rM\374\210F\251\017\210bj\310\342\374o\t]\321\023FM)\320\347[\215V\337\b\020\376\264T|ZQ\250\b\210\303\365\227\266\360E5\005Q\300V\300Z\300\236"
+	.ascii	"\341\310\3050X\364\344\244>\031\001A\b\242\304U*\025\006\371"
+	.ascii	"\200  \271\030\006\207\236\234\324'\037\020\004\" \b\300\364"
+	.ascii	"\351\267\252.\212F\353\237\226^"
+	.string	"\020\323uEY\210(\022\207EaZ\234`\365\255:\205RW\254Dt-\006\025}N\350\032\034J\300\3050\210\001\230\006Y\240\302\364L\235P\241\342\217\210A\273@_\020\001\205(\013 \232\002/\244N\301\341\223o\r\242\031\200i\221\230\266H\211>\027\350\213\fk\t\305b*\034\256Rh\206\242\017\t\230\252\240\006QuU\205(.\254#^\334\242\257\350\003\026\227\211\305\035\301\3422\241w\004z\231\246\356\210\251\313\364\342\002Q)\016\250,\210\244|\305\365OK\"\204C(\250\341O\202\r\330\242o(]\321\265X2\255QAf\352C\241d\204!C\352;1A\032\365\"\203\223P]\327T\305\206\027?a*\305\201\224X\202\t\016\305\b\244P\352\212\024\n%\226\220:\241\304\264\005\212a\375\323R\261\303\024\n\205\213\276\025%\250\370\021%\200\222*\342R\250Ba'\241\252\213\352T\211\240\340p\250"
+	.ascii	"_\371\247\245)\242\b\247(\244)\242P\024\n\365#\226\304\024\250"
+	.ascii	"\266\030\022\243\200\351\0241\210\252\304\264xa*\rFI\235h\n\242"
+	.ascii	"OB)P%\022\323\026C\237P\365\260\372N't\305P\3659I\005\243\224"
+	.ascii	"\210@\241\312\302\267\242E\037\224\024q\335@\032U\224\200(\r"
+	.ascii	"\242"
+	.string	"?\241\225\230\266\020\252?\"P\205*\205*\224\336\300/}\372M\241P\332\250h\"\210\266\020\016U\024?\342\206b\232\022\235\322\023P\250\211\026QM\030V\264\205\272\376J\244\300\341\tD\025U\022\252\277\264(5E\034\n\246B!\372\364\363MI\241\276)\024\312\250\230\264\246\305\246\246\341P\032\365b\275\300\201\202U*J\250nH[\250+\332B%\246\300\016\304\341\372C\233|NB\365i\035\016\241\212\276\037Q\t8T\211iT\n\205\022\233|?b\321\247\026\213D\016@\325\267\252B)\013#\202S\304\242\321ZD\233|@)\224\205\257(\305\242XTL\001\250F\021\251\360\344s\201\276(R\341\311w\244\302\323\323o\035\n\327?-\001\325(\021\353\223\223\032T*\301\026}M@5\312L\301\242\260',P\215\302\253P\035\246\020%\005\024\252\023\3300\344\002\255\200\224\n\240\032U$TOXK"
+	.string	"\325\250\243\264E\0324Z\177iS\023R\n\034B\371Vb\0325\225\372\326\240\272\372\204C\025T\342\360I)\005\016Ox\261\252-P\342\002\324U\210\032\255\320 T\321\005\020\207+JL3\244p\201\276\270\020L\177\277\022\351\212\022\213\200NG\300\340\360\251\230\022\237V\337\232\026\225R(u\025z\201\006S\340P\006\244\2420\215\202\032\232"
+	.string	"\252)\254(\213\026H\302\241\272\256"
+	.ascii	"\022Q\027\304a\t\3004mJr\201\276\360\031\t\251\360\344\033Q,"
+	.ascii	"\242Q.\206\301\013/\210i\213\341/%\372\236\212(\361WT\224\264"
+	.string	"\016\217\324!'!\252TT\247P\237\223\024\213\024\270A\250\242N\027\212P> \232>\241\033\030\016\203>b*TQ\342\352\033\022\177(\007\241\212:\035] \016\211\304tCS\323p\225\372\371|E\026(\206\021\304t\r\252M\030Tx\362\tU\025\236\240\210\351\n\3645E\005}\302\027\300\f)pxB\n+:\254*\224jB\032t\022\226\330 T\321\005\\X\323b\232\202\230:9\251\304\025.\206\301`\t\023O?\241\024\032\244\300\227\026\2450L\241\301\224\350s\201\276\360\001\323\025%:\245\253P\315 \034\252+\252\202JDS\241j\302Z\224\">\255H\245PE\235\204\322\237\020m\001D\201\026V\251\250Uj\350#\016\327!\024\006s\025J\r\177\276`0\375\371\206\253\024\272\301\267\nS\265(D\211\253\322Z\034\016Y\370\232\2324T\024\321'T\241\210\200i\032U\364\255\302\024j-Ji"
+	.string	"\210&\231@5\252(-\242)\361'T\323 P\275\020U\364\245+\032\034F\021\323U\250\372\232\232.\370\246P(_S\323\205\r\250QE_SS\321),\341E0*\n%Z\205*^\321a\260\251\\\377\264\224\301\207Q)Q\304:\034\022E\f\021\321\247_N\241P\024\322\240\3324$F\r\025}Nj\223ph\"]\321\024\301!q\025\016\177H$\200\352\t\304\247\365$1\214\232\"\201\370\264\352b1]\321\024?\3429\214\232\"\341G4\213\351\212\022\313\023(R >\255\020\276"
+	.ascii	"\006\255Bu\030\265\0014%\262\360\241QkQ\032\365bEZ\205\351\217"
+	.ascii	"\230F\371\202\353:$>\255\032V\337\bL\253P\225\322\253\n\245\006"
+	.ascii	"}\351\212\022\205V\037\211U\250J\235gb2\341!\002(,@\377\226~"
+	.ascii	"D\021\277&\021B\025\205\022\361#\026E,aH\201\303\023\320\250"
+	.ascii	"\365\374\257\331n\327\227\252(tk\247\037\235\003\211[\235\030"
+	.ascii	"Mu\312\375\251\343\021F\307\260}z\330\030\003S\3369\217S\220"
+	.ascii	"d_t\215*dnZ7\027\231Q\222`\265u)\355\300\371a\007\247E\213\336"
+	.ascii	"\022\264=\264\3059)\303\323j\327[\202\312\344\325\321\322is\236"
+	.ascii	"\004\301\272\371\036\020\321Dt\274\270\271\323h\366\310\031\252"
+	.ascii	"#7\337\203\037\372\327g\345\033\036F\306\216\247\235\035\025"
+	.ascii	">I\262\224y\026\230l\001\342\006\213\271\266\3448\006\306\225"
+	.ascii	"8]\244\254\315\017+'\035\230 \\rU\314<VG\031\2400*\345\034f\362"
+	.ascii	"\306\017\325\024\363N\001y\264\206\230\235uX\315\032\024)R\314"
+	.ascii	":P\222\020qs\263\034\355\245\f)\246\241\2304\334\276P\031\321"
+	.ascii	"O\220lsTH\234\204\311jpbL);\317\300\321\243'\327d\215\223*\263"
+	.ascii	"=c\356\363dn\b\225\233\265\022\034\202\275\275\275\275?{Wi%W"
+	.ascii	"3\321K\256\225\334\350\2443\313\2522\223\230Hj\324A\211s|\262"
+	.ascii	"\305L\016\222s\212\032\236\230\033G\362\220&b\252\030\261\262"
+	.ascii	"\001\226\026[\021\313f\356\200\241\367\205\210\020!_z]\206\034"
+	.ascii	"1\242\013\033\242u\263\026\323c\327B\256\205\\-\004\357\355\231"
+	.ascii	"W\342l1}\370\320a7,lo\343\351E\316J\022\310u\230[\031\303\316"
+	.ascii	"\03687\353\037w\323\353\222%\316\315z\205\273\235j\332\214\005"
+	.ascii	"\207\244\250\023\362\224R\236(1JI\207\020B4#\263M\032\003S\025"
+	.ascii	"@@x4\"\223\213\366U>\023@\303\n\213\024\222$'\025cfFDDD\222\222"
+	.ascii	"\024\2242\214\001cA\320\344\310\373\201\206\3339\214\270\233"
+	.ascii	"\362\f\021\267(\357\266\241Y&\362\277\323\221\344[\001\214H\212"
+	.ascii	"+\356q@\241+u\025a\251\016\263r>\242\241=\024fV:b\216k\202\177"
+	.ascii	"AUN\207\013\207*\306\262D,\3220\004\377\323\341u\240\364\216"
+	.ascii	"\261+UTn\310\037g\307\363\033\005\b\313KZs\362t\3765\356\206"
+	.ascii	"\334\006U()\350\236\214\331;\355\361Yd\372K\3467\r\304\213\275"
+	.ascii	"\303\276\230\337\004w\245?\244\344\276\3705\177}\200jN\343lX"
+	.ascii	"!\366r\037L\206\211\007(\332h\037y\271\202\302\300/\344\320\025"
+	.ascii	"C\374\227\254\324T\b`\224"
+	.string	"\203\007\266\007\342\265,{\306\252\020\375`\004fp<\257\345\341\204\336\222)`\2012\357\360\367\302y\0231edv\277~\220\b\317|\003\337/h\271\022\3211\f\033w\001a\235\034o\013\375\2412!\376\353\307\370s\t\nr\225\277*\2767\260\256\260\202h-\021N\272K\300\020\267\233\223\207\032\357\253[EmJs\031 M\211\267$\201\360{\202\201\036-%\007\371\210'\230\260c\033\270"
+	.ascii	"v\316\202{J\251\346\317\326\260\316~\275>\270\034\312\264\205"
+	.ascii	"7\232\0074\327\200,{\303\271|\266\bi>\237\334\035\242\232\323"
+	.ascii	"\304Cb\321\253GV\350J0\3235\304\033}\320\320\214\343\243\320"
+	.ascii	"v1\023\005\272\360/\231\306\313\251y&\004E\346uS\031\364\340"
+	.ascii	"u\334\272\237\364\r\374y\037'\r\263\354+CS*\311\361\237\376\317"
+	.ascii	"9\225\304\031<\372\230\204\376\020\277\374l\013q \333\241\030"
+	.ascii	"\320\004\356\312t\210\244\223z'!y\351\251\211{zP\030\3349(E\226"
+	.ascii	"K\200F\034@\343\271\332\2609r \344\251I\003W\026i3\035c\266\236"
+	.ascii	"\231\013\001(f\003,\200\250\236\322\273H\260c\020\202b\2164\371"
+	.ascii	"/9\226\257C\034i\355\210\373_\001p\207\312\374\246\363\327'-"
+	.ascii	"r\r\215\350\246W\341k\347+\221\373\264\013\363\356[3\250\306"
+	.ascii	"\252w\001\007\336XqhX:\212-7\020\244\361-\001O\317\216\2145+"
+	.ascii	"\252q\003P\237\tA.k\237\027\2776\244l,\220\240\003l\341\320\345"
+	.ascii	"\234\n23\374\271V\360\243\312wL\036\313\020\216\244%\232\327"
+	.ascii	"\315\255\332M_1\300\276c\225\327\241"
+	.string	"T\271\217\247\032}\211\311'\354a;\227}\177\024\2742\351q\367\004\211\rjO\302\337`\301\354e!S\255%\211\2236x\317&\025p\001\350A\216\241\330\231{\007\354\235\260\337\002\304\027\240\322\346\006k\237\327\202vn\212\314,9&5/\305\033\254\201im\226)\340)\213\277\242>\004S`\004\205\"\227\002 \241&dE<{\003\031j'\314\347;B\374\b\322\325\210aq\320\202\234\3347\024\210\037\355\300G\303\210\241\330F:\271\244\275`D\306\367\207C\233z%i\244\3341\332\264xj0\360\312\250\232\rl\230\321D@F8\343\270B\313\307\267r \024\371d\310\315v\235\264\271\024AJ\306\213\375\313\352\332\241u\241\226\277A[\216#\316pc\363\341\005\0319f\200\377O\277\213\324\nc\f\277\311\241`\373d$\004.]\213\257\250F#$(m\n\331\314r\370\275\304\3010\037\bt\226z"
+	.string	"\346\204g\357y\376\023\004\325\b\231\020\273P\343p\0234_)\257\363\001\320\265\007\224N\346\032\035W\312\2370tt\b\373s\224\260\300y\323\372\2514+o\025\340va`\2161\337\262\273\001\022\221\325\260\342+Z\006>\304\301\316\222\306=r\254\"\221\235wV\201\\\313E\365\240\302\373\310\316w\220\216t\037^\221\352\247\367\33409,\037\226\357\356-\002\026\367\310\237\321%*\030D\307'\233\375\242\327\351\3741\3604\271\316}\303=3o\214V\370\215\251\030\016a\007O\377\371\301\346\245\270\265je\334\245\202\b\246\326&t\333\372^\020\025D\r5d<K\004\213o,\341NTyfL\241O\253|\253\255-\362\026\316\307Ej\177\245\333\201\225\340Q\\\311\335"
+	.string	"\277nN\325w\245\233\200\026\204l\212\247\373\016\362"
+	.string	"r|7\215i\326]\370\213\036\333E\324\241\001\345\005wm\030\370\335:\353\224\300\314\313 \275\277\275\351jk\261\205\343A\266\237\355\224M\252p}.\344z\234\374\271\213\304\246p\320\001N\360o\240WOp\312\320\303\222y/\334\256\021\342@*\276@E\026\001\200\005x\026:\267\355*"
+	.string	"g\232\254?\266=D\262\375thV\337\330\206\317\f\266\360\362\336 Ec~`\0057F\346\377^\205\352`\274\273\n\245\350m\353\337i\350\302\263_\226\371nF\353\302bW\007\210F\353\"\035\023\276\346\246!\242\246\034'\3468\211\265yb\306q\346 \331\326\2709$ 31\302\352\224\033j\276\330A\303\216\2158=\357@\f\240Z\221T\273\305\3416@\255\b4g\353P\"\030\305\201\002\350\007U\376\201\017\202if\r\032\206\005)\217\356\233\fG\203I\225\366\335V\370\305\364\006\344\031C\"\343\312\206\354\203dJ\373\206\030\327B\250\t\225T\227f.\275\023\241\207\221\324\233y[\242\003\356\2506\277\031\262rj\334\002\271\275 h\345\271\n\272\3752\335b#k\2607L+|\025\334g\304+HjA\360/\303\004<\204x\261b"
+	.string	"U>'\316\214\273\337\241,\r\204f\337\272\312\305\266\241N\206\005\333\037\2632\177C\225:v\031\250Y\230\357\330.\225\212\257\020\274?\022e\301\205\213g\234y\3141\222\274V\336\023\370\272\313\275}\232|A\231fb\177\210\210\3661\324\342J\205\022"
+	.ascii	"\364\021\227-\232\020;Q8\005U=\037\346\335\230\034jp\204\320"
+	.ascii	"d)*\266\224\214phB\250<\216`\206\210'\2628\3334\242\237\221S"
+	.ascii	"T\036\210\022$\211\270\234bw\216|\t\345j+\215\220M@0\205]z\255"
+	.ascii	"m\312\264\366Y>\302\342\224fR\267\005b\276\234e\331\313\210\252"
+	.ascii	"\245L\312\0049q\377<s?8/\027\232\245R\003\006\f.\342\f;\224/"
+	.ascii	"k\243\343\212\255\322\226\302\213\203\314F\3114\232r//Yq\336"
+	.ascii	"\344\272\\\255,\\\005\307\037\340\330\347^\335K\bF\202J,.7\223"
+	.ascii	"\271b\307\b\355\212\t\006)\314\257K\204X\320d]C\006+\210\202"
+	.ascii	"\373\274I,g7\177A\240\210\340H\235a\236\311\231-\326l*\253\372"
+	.ascii	"0-\364\223nH\233>\366\203F&}\3309\352\227/\372_\355\306Z$\326"
+	.ascii	"I\271lM\230\\\277U\362\331}\201@/E\0352\240G]\247!\005\f~\237"
+	.ascii	"\233\367\242\274\007r\234\246\353\nT\024\177$\314F\311P!T\353"
+	.ascii	"\251\227\347\276\274\201\320o\315&!\333\363/_GBe\207\221\030"
+	.ascii	"l`\305I6x\361[\363b\236V\037\3658\265\027\331\267e\027\202\300"
+	.ascii	"G8\033in &V\006\213\301\022\2279\275\375\1778b\3454\n>\346\270"
+	.ascii	"\226\213\266\262\304U\005\3778\344\206{1\020\261\260>4q@\211"
+	.ascii	"*\r\023^\240\344\310\201Y\"\325\017"
+	.string	"\020\212\336O0\316\221\355\264\033\237\230\315\300d\275\"\333\323*C\234\0365v*i'^C*<Cl \005\302*\312\236=J^\210r=Q\330\317\026\274\022x\325\201s$m\321C!\305\t@\351b\226\266_\177\003u\364\034\277\005\363O\225\225\275Q\3018$/\366\255H\213\235\255\231\"\352\353M\030\265\024y\021*\200\370\330h\275\"5o\b}l0\264b\331\222b\331T:'\304J\254\200n\306\332\375\026\n\227ra\237\256n\212z-\be\\\360M^t\n\345G\376-\205\225\214k\r\370\306\223\027/aU\323f1g\246\372\260x'\245\013\207x\312\257\006\311Lfo$\023\254z\261\316\270g\036\023\266\003v*4*>\364\374\311h5\331tHU\305\203(\251\317r\235i\244\305-,\023W\246\363}\022\326\250\206\226\225\322\360\330/\355\260\300b\301\250\007\273\374\324\006\006\\a\206\205"
+	.ascii	"<XP\306\303\352X\275\353\316R\254Z\202\332H\262\343\203\241\224"
+	.ascii	",\352\341\2253\036\261v\261\206\333g\226"
+	.string	"\035\361\265\026O\207\243@\235\306\377\261\322\376\235j\366\0358\310m\222\036\021\302\274\265E],\254+\340X\262\210\302X\373\023\207c\"\035\366\257*\337\266i\364\254\356f,F\362\232\350;=\353\3131\214\f\333!\376\247\360d\204hj\336\020>$G\246;\007\031\017\003/\374\3279\024\341\t\031\326<\003\026H\241jJqs\022<*[V\213[n\252\232\255\002z\344\341\313R\ng\241\216\"R\264\020\234L\020\027\024\311\264`~r"
+	.string	"\250\220\337?L`\024e\240\2763\"K\302GL\271'\271XO\304\"`v\202\323Q_\230/0)\261J\231\312\332\321\"\277\212\241)\241\370u\342\244~\003\3120\023"
+	.ascii	"\262\031\315\222\025w\016A@\240$R1\237\301\210\037\236\364\336"
+	.ascii	"\323\371,\3301S\355\252\314:\027eS\2272\006\336\267][{[\362\375"
+	.ascii	"v\021J\003\250AS\377Fn\234\312%\211\3223dV&-r\355\026\0177\003"
+	.ascii	"\b\027+\371\311\f\303\313\231\024 \273m\241\1776\312\200\244"
+	.ascii	"\030q\225\321\243\025\272\244B\222\360\247V^F\325\034-\271[\256"
+	.ascii	"QHk\026\240=B\b\361\245/\276\300\007\336\322x\310)Y\224\377\246"
+	.ascii	"G\260\307\220/"
+	.string	"!\345m\366#[\217n\2116t1Zg\304\315r-@\264\311\002\227\334\023{\221\301\256\267>8\275\233b\216y\257\254\234IE\212Y=\023\247\350N\225\330\360\345=66\321<9\343\250\312\361\206\256\2524\261\352\332\372\277qDOE\232K\324\312'\357m\234\3719H\3531\236\270\260\364\312!\326\372W8)I\\/;\312J\324+\354B\344l\340\345B_\232\262\240\tw\273\001\232\3425A\321\266y\235a\200\336\346\300<&\320\326\2250\261Q,\225\334t7$\252\"\323\bQ\242\032\307s]\377\255X\371\023F\372\262n\300\351\276\261\374A>>\270\332\377\240\022\r\303R\253\245\035\026*-\\\023{;\320\377\327\346s\023\310T}\271?\327\007\024\307\226\362\300Ub\340\300r\312-\352[\032\344\331\267\002\316\345\261\242E\026\217\n\007\\\001#J\245\n\007k,\330\207\005j\314k*g\256\223h"
+	.string	"\231;\362x\323@h\221\373\242\177w\377\375\203\232\314\235_\232\tzX\213\253\3330\301@R\204,\303\2560,\247\352\214\177%\004X\017-nf\324;$\362\232\314\336pl\244\\)\351K\215\207\231_\372\r3\020\241\252\323H \243\254\362\273\300K\3516\360@\3275SD=a\212qE.\377\031I\265\206\2356\022lRa\307\033#J\345\244\006\013W(xm\274$\317\3268\001<\270\270"
+	.string	"=\016\354\305*eo\t\353\001\345H\307\"8\325\353\323\261\035af\244\366\217\024\341b"
+	.string	"\337\220\303\243`\306\365KAN\267a\342\343\034&\261,\321a\203h-\342\217"
+	.string	"\225\202\331\204\200\211\235H\032\235\264\247\332\215\326\205\365\"\372\260\035V,\331|\317\231\347RU\271\336\274\203Z\271\030\232km1\211\317\371CC2N\222\017<z\311.\315\330C\241.\207\217\235\232$\261{D\031\370|\204\330\301\226\020\224!.\250\245\"\250\036\351\361\360R\304\205\r\314|0\246\013\357$\030\256@\356\223\246\267\025\356\243V\001if\311\013\275CI(\r\260u\277\304\035$\275C\336\270i7\354<:\032R\366\261\030\034`\227\227i1+\320\223\237\300"
+	.ascii	"\362\327\324\226\370\247\326YnE\032]\363g\301\fI\265\220\224"
+	.ascii	"l\356\363B\322W\315a\013c\3766\316\025#\314a\001\303\\[\317L"
+	.ascii	"\261^_\250\344\240C\037\357\350\210\362\260\374\314\241\035\343"
+	.ascii	"\245\202\201\242\244\311n\313\270\306>\030\025\375T\024^s<\215"
+	.ascii	"\032j\357\301\356@\262\007+\273\307 h\232\2511\355/Pe\321\002"
+	.ascii	"\366\347Sh\271\276\236<\367\033\213\270,\233\007~\351\233fd\260"
+	.ascii	"\323\3022\315<AI\374\310\301\326\237\322*\031\351\217\001\233"
+	.ascii	"\017\237\020,\322\272\362Q\262\274*{\377ri\223\003+\362\007\260"
+	.ascii	"l\355\2251\306`V\271\2732xg6lS\306Ge\371\327\201I\267hs\026\320"
+	.ascii	"OE\027VNf\221x\233\223,\0065F\241V\346PF\257\233\226^\304\374"
+	.ascii	"\332p\347p\342\202\257\367\302\273\235\245\264n {\324\205\356"
+	.ascii	"\023\310\314\037\245|\023\301\337\fOa\035\355l|\030\306L\236"
+	.ascii	"\232\363\037S\351\247\200\263\017\215\020$\2773\032{$\351=\364"
+	.ascii	"\232+\300O\334\236c\367Y\201\237M\274\327hcOxDe\356`K\031Q\322"
+	.ascii	"\361\226_U,\224\035\375\016\023\370\006\2133R|\315|\037+`si\037"
+	.ascii	"\306\325\303\330\214\236\224\242!\305\247\216\265\0349\366=\346"
+	.ascii	"Kx\350X\265\023\311XLg)\2357\352\207\270h\331\255g\032\372\250"
+	.ascii	"\214<G\212\241\204\371\260\372%\034\333\222\276\253[\220\347"
+	.ascii	"\315\375\241\210a\206\n\2772~\t\321sJ\330E\347'\360\3369v}7\336"
+	.ascii	"\002X\001\370\177\371n~GXg\213;\033\212\037a\224\217\327\353"
+	.ascii	"\"\345=%\310Q\262\253 \3233\332\007#\306\326\372R\221\243\027"
+	.ascii	"X\027\201\353\253\273\244f\233\302\333;\234e\362P\366ob>\307"
+	.ascii	"\037\315\371]:\016>\374\366\342\221O,\271\240u\232\3302\242w"
+	.ascii	"\345\326\277\265wS\327\r\237\357\267\206\305[u\353x\355R\366"
+	.ascii	"(\305\005\330c\372\326h\251\277\206\276\215@"
+	.string	"\335c\370\357\276\021pp\177s\353 \002\373\217\331\027\331\023V\361\230u\345\257e_\rN\245;J\305z\223\332\327\233\360\244\355\237F\275\251\230|\310?\020\301\347\377\367\260\217\355\227\225\364\322\202\217v|B\354Y\342>T\225\027Yx\366*\316\230\306\261\3204{\253\t\237L\346z#\006|\344+n\363\004\355\313\264\351\344G\312\023\225/!O!\264\251&o\020u\274\327\023\320{\324=\"\353\034\217\255\265\246\277 \003\357vj\353\200s\203\317G\227\375\320O\360\353Q\350#\273y1\001\027=\327A-\242\373\333\032\262\033\345\013\232^\321\306l\tC,\377\024\227\f\004\366}\326t\3249\204\347\253\2370{\037#p\266\316\375W\210\247\020\354\002=@\321\242\3646U* U?\3102\035s\273l\306\"\256\256K_\003\371\255\337\217\002>\253wI\305\035\234\021\210s\025\371H\363\342\202+\362\330\243\341"
+	.ascii	"7\230\325\0068n\204xi\n\212VP\223\273\002"
+	.text
+	.section	.gnu.lto_.symtab.dae2bd6c6f23ad5f,"e",@progbits
+	.string	"applyBetaflightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"applyRaceFlightRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"applyKissRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"getRawDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"getRcCurveSlope"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"processRcInterpolation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"interpolationChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"calcRcSmoothingCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"rcSmoothingRxRateValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"rcSmoothingSetFilterCutoffs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"rcSmoothingResetAccumulation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"rcSmoothingAccumulateSample"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"rcSmoothingAutoCalculate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"processRcSmoothingFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"rcSmoothingIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"getRcSmoothingData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\003"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\003"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\004"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dae2bd6c6f23ad5f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1512 @@
+	.file	"rc_adjustments.c"
+	.section	.gnu.lto_.profile.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\364\002\275\n"
+	.string	"\004\r\350\003"
+	.string	"\031"
+	.string	"\331\226\256\205\n\036\002"
+	.string	"\001\003\004\005\002\005\001\353\252\315\223\t\002\240\342\234\212\n\003\004\354\275\370\376\b\005\006\007\257\205\261\336\001\n\006"
+	.string	"\002"
+	.string	"\b\352\263\360\321\b\t\n\013\243\274\344\244\007\b\002\007\002\b\002"
+	.string	"\002\b\002\t\002\b\f\310\344\367\032\236\001\002\007\002\n\013\f\002\f\002\007\002\r\016\002\r\017\352\207\200\367\002(\017\002\020\002\016\002\021\002"
+	.string	"\002"
+	.string	"\022\211\220\223\261\013r\016\016\023\340\333\316\203\007\007\013\024\343\217\301\203\b&\007\002\022\002\023\001\023"
+	.string	"\002"
+	.string	"\026\266\330\373\257\007\002\027\346\361\326\370\f\004\002\024\002\025\030\352\231\344\211\017\031\354\206\342\366\006\032\206\271\335\257\r\002\033\313\331\240\372\b\034\321\316\352\310\n\035\240\342\234\212\n"
+	.ascii	"B\2501\262`\002\021[\250\232\r\200\002d\243\261\003\022\200D"
+	.ascii	"\r\222U\316\251h\322\344\237\345\226\353\200h\214\206\331\237"
+	.ascii	"AT\274;\360\250\265\031\231\366\202\242T\3469\212\361\200\223"
+	.ascii	"~\211\030\nw\274\212t1\371\337\267\365w\232\236=\227I\352s\240"
+	.ascii	"\377\020\340|A\226q>\227p\275Z\364TX\f\2559\342\201\371\374\352"
+	.ascii	"?\365nH\216\361\221Z\252\224Hv\210DU\035\274\177.\376\253\362"
+	.ascii	"\264w`2\247\226\004\002z"
+	.text
+	.section	.gnu.lto_.ipa_sra.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\325\003"
+	.string	"\224\003^\001"
+	.string	"\f"
+	.string	""
+	.string	"\001\007\002\001"
+	.string	""
+	.string	"\013\001\f\003\003"
+	.string	"\001\017\002"
+	.string	"\020"
+	.string	"\007\001\003\001\200\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\022\023"
+	.string	""
+	.string	"\024\001"
+	.string	"\026\001\002\b\027"
+	.string	"\003\031"
+	.string	"\003\032"
+	.string	"\001"
+	.string	"\032"
+	.ascii	"j\004\240\264\302\241]\021\304\274\214\211a\024\276\206y\210"
+	.ascii	"\2300\220of#\232(n\364 \tQe\340\020!\030`c\200\f\357\365\312"
+	.ascii	"*\347l\300\002\340\r\230A\200\001\330\021s\r\r\f\001"
+	.text
+	.section	.gnu.lto_.inline.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\274\013\205&"
+	.string	"f\357\235F\320\030'\035P\b\334"
+	.string	"\232\"\250\256\253\317\325\016\343\236\b\02391E\034\205\"5\226\327\230C\200\2248@\215!.r\3446\220Q,\206\213\001\340\n>T\252\327.\316I4\266\377\254.\354\2235\220'h\357$S\210"
+	.string	"\205"
+	.string	"\217"
+	.string	"6\252\024\212fF\346\004`\306\230`J\244\227\315Ek\221\361\252\013\264\232\003\251]@S\257\360\033\253\204\303\030\242q\344B\314\351}\036\356\356\013W*]Z\266\"\026\231\020\231\346\032\363\304i\227\346\315\020\276\232\335\363%IP8\3414\333\250k\352j\033G\031h\250[\320h\365\211\"P\034\r\321\330E\035m\303H[\355U\030m5\265\334\347\371\356\006i\366O\364\360b\210E\202\333J!\236\220\"\202\310"
+	.ascii	"\311\2349\241\235\334t\300\331y_\205\366srrv_\376\334}\3054\266"
+	.ascii	"\033\372\336n\330\271\353\374\316qc\255\177EU\204L~\214\033{"
+	.ascii	"\360\025A\250\354\255\033\213\351Z}%\360\255\t|\226\237\016\270"
+	.ascii	"\326\001\275\201\326\360\345\371\232\353\331\255;o\355}\306\020"
+	.ascii	"\0332\223\177\007W\022\302\304\336\032\250\265\376\243\207\024"
+	.ascii	"\242\223\017\036l\202\004\210\020\312\2337V\f\2154\204'\bq6\233"
+	.ascii	"\325\320\354\b\217\355.\006\034\273\033p# @7d\262\222\357\301"
+	.ascii	"`\366`\254\003\231\362\304J\214\357\371\236g\317'\327]\353\273"
+	.ascii	"\2745\320\335\235\222c\324O\277])W\356\356\005\034[\241(\252"
+	.ascii	"\033p# \200\215*\205\242\231\2219\001\2301&\230\022\351"
+	.string	"es\321Zd<\220\336L\371\2024\334\204O0r#\251W\241\226\276\n\357\315\272y\223\360\022>d\200H\340\351\236H\024\345\310\205\334\240\331\023n4\213Q\204@\332V]\215\250\352\026T\201\246:\320\317\231|$\210\270\3101^\205:\003\266\341\211\322*\256'\026\355\b\322\361\342\024\351\316R\302\210\203\214Q\021\212\020\216\021\372\341'\246xq\005\346$\236\261\245\234\\Kzz\236\254g\tgK\2449s\255\253\340 \213!-=\313\007q\312\320\254\303k\030\341(B\342\271\207\243\034<P\336<o\254\236Og\260IW\245\2415n\261\372|H\213\025M\016X\006\364\274\353\344\332f\247\372\305O\312\3375\273\340vpggg\367\325u\335\356k\372sz\302\034\2505\006c\305\020\001\201K\2501Q\205HFD\244 IR\350Q\005FA\306P\021\037\022\200\004!G\363Q\341&\205\375\217\335hm"
+	.ascii	"\300_O\024\207\272\315\335\305R\003\235\323I\327K\360\262\306"
+	.ascii	"\363JgG\373\225\320\225\237{\276\016\306\252}\347\365\236\221"
+	.ascii	"ev\235W\272^\347\321G\243\266\033\215\026\366\257\177\326\354"
+	.ascii	"L\322c\013\t\230\024\025\\Y\225V{r\035\234\250*Cq\022\"\242*"
+	.ascii	":\365\322(.<<\366\371\307ag\346\342R\335TzF\246\204\220\034="
+	.ascii	"%W\337\215v\276\332\"F\235\351\276\313\265\201\222n\212\302Y"
+	.ascii	"\331\025\210WB\031\236\323\313g\267(`\264\212\305\361\245v\331"
+	.ascii	"\343\334\212\356\345_\370\005\265wN:$ \223\372\377K\300\314\336"
+	.ascii	"i\305\343A\371bPn\357\226\366\003"
+	.string	"\312\230\351'\323\211\023\215P\230\207\374\341\206q\241\324\r\227n\223\350o\373\352\b4\314,%\002FX\376\372\326{\021\371\242\236qG^p1&\035\304\241\300\30534\235\256\221\302r{]\375\b7MB+\345_N\204^\f\340\321\032\243\b\025\003\204\275\001>\343jv\365\016\345\3718g0\013\304f\211\265\f\021{\355\001\355\346,\257n\346\177\354\r\245?\257\376do\342-c1\016\2461\207\234\260\262\006\017|\376^\267%\037\356\221p\b\250\004H\305\005\231iTPt2)&n\361\264\3434\220\f\213Z[9-\t9\315\215\231\330\3114K\330\253\036I\323*m8\024\217\004\225\225!\276%.\364\235\020\n8\264$4\323\314K\001\257\002\212=Io\030\314\371\n4r\375U\343\200yO\024H\215t\036\356\017v\345\300\255\247\217\004\343DU<\341\303\261#\344E\327>\375\242B\272\035j\316"
+	.string	"61w>7\200\005?tX\231te(C\202\223|7L\371\233\317\252~n}]p!\311\267\207\3210\026\026\2549\247G\300\207"
+	.string	"\017\343\312\001\304$\005\354\276^G\006\3600\367Y,\307\033\354D6\250;\323\202\300\\\376\300\332\315_\276\272\231\371\330\333J\377\274z\310\376\2632y/c\"P:\244\032U\347"
+	.ascii	"\217q&x\340?\342*0\265q\020\206R3\375?Pa][\"\017"
+	.text
+	.section	.gnu.lto_.jmpfuncs.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`M\b\035\022"
+	.string	"\346\025J9@M\224\341\036\265\357#\337\226\021_\013~-\370\267\263\276\013\361*\212b8P\357\260q\024E9)O\211~T\352`\331\276\355I\311\263\366\355\177R~k\337\266\204\310$\0032"
+	.string	"="
+	.string	"9"
+	.string	"\0068\375\225Y/\253\352\002\256S\326\207y\020\323w\365Y_"
+	.string	";\270\344\240)j\222p\275\3013\370]\341\276\302uZt\322\370\244M:\222\020:\006\004RUE\"\242F\303\262(\024\211\244R\231L,\026\207c\212z\364\343\361\366\345\322\351\034a\217\307\302"
+	.string	"\335\255\317\207%f\206\013m_\327\007\\\247\253/\323G\365\t\370%\b\202N\300\035\027\034\027\243)\013\243\037\025\356t\241\320\231\340\221\360\007\302?\030C\341\253\205\202\376\336\236\\im\333\366&\354\310\327\352\034\367\034\327\245\213a!\215Fc\226is\263Y\243\024$5$F^SI\276"
+	.string	"w\242\332>f\343)\026\234H\200\302\304\005U\313\020\210\350L\206o#2\025L\204&D(\003\241q\2231\245\017\225\207H\007Q\203\203\205A\331 \321P\3110\301`\t\200\301\250\241\2607RP\222\244\222\306 #\221\232\324\001\022"
+	.string	"r\262\210!\205\b!\002.$\231\030\f\327?\003+"
+	.string	"\221\001y2C[\022b6\212\b2\321\f\n\215Bu\2622\346FK\273_\205,~\320\256H\n\327\t\251\327ol\362U\206_\235iq\352\221&\247~\304\311\013\354\206W\314\262l\023\023\013\321\030\247\016\203\2143h\303\337e\323\3364G"
+	.string	"_\224\257\321\3429\001?\241\305$\234\231Qt\001\f\334\322\t6\362e\026\013\206\317@\203j\352.f\266^\362\030\026!\206\203v\207\177{\305\322>\313\217\246\250/\243\336\357/)\"8\"4\225\0376J\240\312\b\002\241()\310jbZ\237\366\222#\327\t\270\025\201\006i$l=g{\234\334\232\212\326\230\230\f\3669w\346\215\267\356<c(#\350\323E\316\204\341\370\204\027\2178tW\026\244"
+	.ascii	"\017*\033\027w\320\334\210E\327\260Gu6Yl\350_\322:\327\177\035"
+	.ascii	"i\321\337\330\375\344\250\373'\275Zr\024"
+	.text
+	.section	.gnu.lto_.pureconst.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\007\230\004\013\230\004\f\232\004\017\232\004\022\232"
+	.ascii	"\004\023\232\004\024\232\004\026\230\004\027\204\004\031\204"
+	.ascii	"\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\024\001\245\007"
+	.string	"\342\213%+pK3\034\026\177\002"
+	.string	" \241\020\020\013"
+	.string	"HX\201\n\375#=\004\377\237?\321\347\361\\\277\323\225\032\254R`SY6\"[\312\024_\025\220\b\200/\354\302 \020\313A\364\017'\262\207\021\341x\027\357\227\240\001E\304*\267:\037\026:\263\025t\217F\220t\274\227\2757\253r\207\316\206r\006\345W4\234\016\374BgS\336t*\32497\207\334\033\363\312A\363\023\232l\321\230\003\356\023\241\\\242,\343I\225S\235S\371\324\366|\312\237N\251\\jg\026x~\004' `\0022\204\324\003\247"
+	.string	"\263\267<cNW\342\004\324P\250\022|@\315"
+	.string	"KB"
+	.string	"\376v7a\307wI+\023\334\201h\203|X\213\035 \355\"\306\3235\257>\346\342Y\233\342\023yA\224\372\310\212\347\026\204\232\274\215A\020\b\"S%\340\251\310\306\210!\260\005\005\2076"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.lto.476829754ff76bac,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.67.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\b^"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\305\321\035\006yw\250\306\006yu"
+	.string	"\005\001\006'\001\254\002\005\001\006\035\001\036\245\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.string	"D\210\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.74.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`L\004\315\r"
+	.string	"\224\023?\005"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001?\202\210\200\b\177}\273\001\005\001\006{\001y\001\"\030wu\276\001s\275\001q\274\025\001\035y\001!\302\301\034\001o\305"
+	.ascii	" \310"
+	.string	"\001s\307\001q\306\033y\001\037\314\313\032\036\320\317\031\007}\323y\030wu\325\324\030\377}\330y\332\331\027\027\336\335\026\026\342\341\025\025\346\345\024\024\352\351\023\023\356\355\022\022\362\361\021\021\366\365\020\020\372\371\017\017\376\375\016\016\202\002\201\002\r\r\206\002\205\002\f\f\212\002\211\002\013\013\216\002\215\002\n\n\222\002\221\002\t\t\226\002\225\002\b\231\230\007\007\235\234\006\006\241\240\005\005\245\244\004\004\251\250\003\003\255\254\002\002\261\260\001\264\263\002\360\003m3\265\0024\262\002\257\002\256\002\253\002\252\002\247\002\246\002\243\002\242\002\237\002\236\002\233\002\232\0025\227\002\224\002\223\002\220\002\217\002\214\002\213\002\210\002\207\002\204\002\203\002\200\002\377\001\374\001\373\001\370\001\367\001\364\001\363\001\360\001\357\001\354\001\353\001\350\001\347\001\344\001\343\001\340\001\337\001\334\001\333\001\327\001\326\001\322\001\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\200\201\250A\3048\205,\373\006\200\2234\315\001\020 \350d2\353\0015\350\263\242k4"
+	.ascii	"r\352U!\245C\272\231\004xgm\rDd{\215\215\201\223\210|\340\201"
+	.ascii	"\230\357G]u\200@\330\256\020@\233C \307\022\001\352O\306 \300"
+	.ascii	"\033\006\333[_H\343\215\330\260 \324\266\215\271\206]\322\306"
+	.ascii	"\273\313\016\216\202\314\262d_\357\243\035\303\253\326\375Sn"
+	.ascii	"b\031N\374\"\237\243\024\315\227\257D\240\002"
+	.text
+	.section	.gnu.lto_adjustmentLabels.75.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\256\004\225\031"
+	.string	"\306+\243K\220\234Q\007\033p\324\202\004\024\220\231\323QS\207\223\315\205\330\322DH\214H~\277\252YZ\001\272\022\354\021\232\252\032\276K\217o\374\215\237\2567;\354\374\304\351\326\031\030\001^\0236\003\325\f\275\324\335\207\323\237h1\312-e\222\001\215"
+	.string	"\214"
+	.string	"\215"
+	.string	"\\\375\213\3747\017\225Vs\2759\370\357\002Qx\272\253\277\r\376\333\300\223!\335\2653\335\357\374\367\001&m)\365L\3747\202$\274R\312\210\377N`\244-\247\272\007\323\355\361\337\n\206\360\312\251\027\204\351n\340\277\027\024{%U\367\231\256\216\377f \365+\251\336\240\351V\340\277\033D\t\313b\027a\272\023\370\357\036\037\303\262\370\032\231n\004\376\373|\036\233\337\370w\034\275\204@!k$\211D\367\231~\2170\335\314\177\343\177\302\270\204\005V\245\212 }\3253\230n\036\303\177o\024\255\276z\253\360\3376K\255\306\352H\370\357\233l\242\325XQ\274\304Pgu\035\3747N&\016u\326\213\203\377~m\r\365\261\347\033\374w\216\232V\0373\r\376[GK\203Fv!\323\315N\3747,\253\247\221oV\342\277ce~Z\253s\361\337"
+	.string	"\256~Z\353=\362\337\001\306\374t\262\277\221\377\336\001#\324\311\227\013\377-\240\213Pou*\374\367"
+	.ascii	"-B\275\365~\023\376\233\300\225#\035\253z\322t\251\016~\036\337"
+	.ascii	"\343\177<\324\003\371 ?\365T_\365B\236\310\027\371#\217\344\225"
+	.ascii	"\374\222o\362N\036\312\277/\345\247|\225\267"
+	.string	"\362X>\313oy.\357\345\277|\230\027\363\306\267z\254'\363f\376\314\037\037\371h>\315\257\371\344s}W&\221\221r\022\204\354f\245|\"3\345\024\271)\257\310,\262Sv\221\2372\214\334\037\344\031\016\200\312*\342\022\222\004\234e\374\264\2617\361\030?m|u\022\377\235\363\013\236\266\312:\267\350\351\270\306\316V\263\206c\331t\275\2611\214\203U\224\246\2424X\316\013\253(MEi@\263\240S\007\333d0\234KQ\026\325\345f+{\332l1|c)\344j+\253;s)\006tMo;5v\266\302p\252^\250\235?k\f\247(\315\302\354\244\241\352\013\333\316\333\017\213\252&\266\2358\\\272\336`\333\t4\013\262\301;\237`\021Q\333+\n\n?p\030\022\332\001e\273\0162\"\336PO\266\003\006e>=\330\027\242\005\312\212|>\240,\007\327p\250-\ra\250a0b\024\355D\332\2379"
+	.string	"\243!\332<\020\030\204\254\0212\255\001\004P\241\302\030$\236\n\260;P2Q\322\305\002\210\002!\375\034 \313K\202O\017\314\260G\227\343\353\222\351(\255"
+	.ascii	"\006\245\362\235=`\205\315\344\261\342\330\01646\356\341\330"
+	.ascii	"\264}\256*O|\26141\215\0261\245=\016\255\030:\276>\276\rSl->"
+	.ascii	"b\363\002\020\222\354tl\274!7s\017\351\201\271\336\003t\315\303"
+	.ascii	"\324\376\017\"\243b\204\364$`\320p\r\346\270{\216\211&\034Y\207"
+	.ascii	"Er\226\341\034\311\304\253\244!\250EH\001"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.78.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`62=\217"
+	.string	"\n\345@2I P[\031\016&\315\307\230\024\312\264TH%m\244k\004@=\252"
+	.string	"uQ\2249C\355\021_;??\030\002\215T!"
+	.ascii	"\020\212\323\362N\367[\272(\362\216&\233G\016Ui)`=k\312jB\211"
+	.ascii	"\255\207\220\275w\222R\006\031\003\307\002\031\003+C\355\215"
+	.ascii	"\361^\030\357]z\357\013\265\327E\261\267\205\332\313\342\275"
+	.ascii	"+\336\253\244\366\252P{S\2747\351\275(\324\336\023j\257\211\367"
+	.ascii	"\226x/\t\265w\204\332\213\364^\021\357\r\241\366\202P{\217\336"
+	.ascii	"k\364\336\"\265\367\203\332K\364^\017\357\035R{;\250\275\034"
+	.ascii	"\336k|oQ\355U\325\336\364\275\350{\257\3666\017Ba\006\217\021"
+	.ascii	"\272u\375J$\264\336I\341\274\300N\346]>\333[f\221\263,\363\273"
+	.ascii	"\322G\306\307\320\312\237\241\230\r*\f.\303\004}\0052\364\242"
+	.ascii	"Rh\3315\207\270\334r\032j5\r\243\324\265\222M_\335%\272A\344"
+	.ascii	"\273a\357\320o)\250o\031H\260\006>\200\006\r\007\237\206\177"
+	.ascii	"\b-\375\bZ\006\212\0252\344\323D4\334\323\\\352\231[\342\241"
+	.ascii	"3\354s\032\362\265\251S7\007O\316\035\236\235e\034\276\245\235"
+	.ascii	"\237\233>6\\\367\204\325\354\253\360y\262;$\003\257\331\035Z"
+	.ascii	"\022X\315\246\316\277\345\272\256C$\354\016q\332\264\233\\\246"
+	.ascii	"\333\241\335u.\236\361\n\314\350\364\362\205p]W&N\367h|\363\334"
+	.ascii	"\342\241F+\026\027\2757\353\272:\355\003\357\335\033:\222\234"
+	.ascii	"\006\311F\253R\217\332\020\356]~c\270$\307\231\300G\353\332\345"
+	.ascii	"\317\233u\215s\332'#\247\033g\334\335e76\223\334\305C\343\324"
+	.ascii	"\302\212[Y\264\232\206\353\272B\255`$\225S\224C\250\234\236\005"
+	.ascii	"N\362\322\255s\233;\267r\233f\321l\234\020\251 @~\370\350\301"
+	.ascii	"cG\224\216\0348n\330\250\001\365\344\324\304Dc"
+	.string	"\206\214\0300\226^\270h\301b\205\222\212\024I(N\230(Ab\004\222\210\020 \216\214\212>\020y\030\352\300\301XTS\364\235\\^\376\031\344\n\273\342\245s\246\300\333L\241\316\253wN\256\2137M\227\035W/\232\215C\251l\341\202\002\013I\332\242D\001/\261\245\n\005Ad \210s\b\365\017\037\203\270\307 \276\303\346\261c\220\243\006\361<[G\016A\306!\310{\374\364\r\033\201\\#0\020\260\241\236\354\260\223\235?|\335\264\307T\207i\324a@tz\206\f=\216\241\307\201\3344\2146Ku\374\242\216\017\331\264\213\026k\230\305\032F\224\241W\250Q\202c\025pWo\235\"\311\f\2430\023\305\255O\230`r\t\346\326\262I\2740\"\f#\205\361r\241E\204h\201A\264\020\366\245\217\214\324\270HM,K\1770#*c\017edXz\310\305\027w`\261e\312\n\314\201\363\200\255P\306,`"
+	.ascii	"#k#J\303l\217\n\347\001\033C\221\320*[\224_]\264\302*J\203\320"
+	.ascii	"\256\360C\230\026\212\364\025\206\253\317\262:\335*d6&\345\006"
+	.ascii	"\303\2756j^\370\323\247o\316\fg\312\200\361\302[\300\256t\b\213"
+	.ascii	"\242\266_\2253\021[\224_$P*|\364\204\331\036\225\017aJt\t\017"
+	.ascii	"\027A\246\343\356\n\303\352.\016Y\327u\233+l\no\001\274\233n"
+	.ascii	"\331\335\022v\235<\004\031L5sM\251\234r\326\231^\204\314\316"
+	.ascii	"\274\245GD.\021J\301\\4@I{z\246c\246;9r|\350\232\230\t\317i\337"
+	.ascii	"\316*\344D\364L\370\316\302h\0310qL\026\2346(;qO\370\217\276"
+	.ascii	"\367d\231)\377?\220V!(\235\330\324\207H)\300u]y\354R\265!\022"
+	.ascii	"\343\272\256Q\234n\0132!\217\007Qj`LP9\355\027\335\311a\302\201"
+	.ascii	"\322\211\333h\fB\357\316U#\356\2103\030PH\217\266\375&f\261*"
+	.ascii	"\335\274x\352\223wu\r\3336\254x#\334\006\264OuO\351\271O\325"
+	.ascii	"\215\236\n?\333\202\373D\237zI\201\373D\377\306P0R\375\333\346"
+	.ascii	"\263O\264o\354\204\337>\321<=\023\214T\361l\347!1\203\235\355"
+	.ascii	"\276\021fu\266\367\220\310\326V-z\333s\366\231\026\352\211\300"
+	.ascii	"\333\316\333g\312g,\004\234\3558\373L\345\350\201x\263\317\364"
+	.ascii	"9v\304H\265\315>S;F\214T\331\3543mS\304HU\206\3555\373L\233c"
+	.ascii	"\037\350\366\211\022\322#b\244:\267\335\034\362\222\202f;M\207"
+	.ascii	"\304\267m8\016\203\334\266\315\030\353,\267\231E3l\333m*\026"
+	.ascii	"\030\266\307\244]_/l\257\241\206`\266]x\037/\333_z\206\265UK"
+	.ascii	"\3326\013\37342#UN\267\271\326-0k\375T\005\307\326\365\212\315"
+	.ascii	"\366\331\\\353\fNY\371\376\"\270\302u\241"
+	.string	"\035\352'\337\raI3\327\256\300\372\025\212\036\255\331.\020\036-\177\227e\342\023\236\242\261 g\007\253\007\355\306)\373h\273\214\256\357\262K\370\024\354\003\370\347\227\347\216\235=:zyxpog\314\270\225a.\311\264\261\215Y\373\242\226\206\306\345L\213\031\226+dV\304\250L\001\373\3428fNAJ\327{y\353\275\254\245\366r\326{\031\213\3230\263\362\275\274\2767\311s\314'\274\367\t;y\255\324^'\357m\362\336\021\336+\202\332[U\354eb\354]\362^%\357\r\341\275 \030{\223\024{?0\366z\360\336\016\336\213\344\275\034\030{\251\212\275\033\030{\247\336\253\301{3x/\006\306\336\013\212\275\026\250\275\025\274\227\202\367\036\325\336\t\324^\t\336{\344\275\021\274\027\002\265\367\201b\257\003jo\003\357e\340\275\013\274W\001\2657\201b/\002j\357\001\3575\362^\003\336[\200\332K@\261w"
+	.ascii	"\265W\200\367\026y/\221\367\006\240\366\002P\354\035\242\366"
+	.ascii	"\ny\257\324{\203\274\027\210\332\373\243\330\353C\355\355\361"
+	.ascii	"^\036\357\335\361\336(\265WG\2617\207\332\213\343\2757\336k\343"
+	.ascii	"\2755\324^\250b\357\223\332\353\364\336\246\3672\275\227\206"
+	.ascii	"\332;\243\330\001{D\313\260\264\235\001\t\371\n(\031:\306\245"
+	.ascii	"u!\203J\255 g\275\363 \220\007\371q c\320*\250\030J\205\353\007"
+	.ascii	":\305\307\211\232\317\3032nk3dl=D\240\030l\201\366\210\246\200"
+	.ascii	"z\261\235\003\365x\027\312\205nU\331z\017A\345\326\2163\235s"
+	.ascii	"\rQ\337\241\343Ql\250\026\232\205F\251\242\003U\3468Q\223\317"
+	.ascii	"\341\035\214:\032\316\226\244\334\210\017_\214\341\303=>\261"
+	.ascii	"\320\230\363!\216\023B:\3350h\213\224\343\300\353\223b\343\274"
+	.ascii	"w\026T\3436\240^\203\355\206\202\n\267@\331\360t\242f\037s\214"
+	.ascii	"\f\2318\027-\300\016\202\021Y\2541\342\036O8\270vFt\372\203l"
+	.ascii	"\022L2\225\374\200\335\211\251\271'\007F\207\231\316v\3167\320"
+	.ascii	"8\323\214\323\bDr\023\020\220O\230\031\347f\340\036\031'j\356"
+	.ascii	"1\307\354V\314\320\007\215\322\224\027]\251\370r\265\307\343"
+	.ascii	"\271\363\345}\025\343v\220N|I\246\322^\f<7rSX\315\322\371\316"
+	.ascii	"9\361\305\227\\\374E\222\314\347 \331\251\246\227d\002I\272]"
+	.ascii	"N\362\314\363\222e\222p#\250\234\2728;\275\274Ay\234\337\215"
+	.ascii	"\260\ff\001 BD\345\264\305\211\232n\230c1\214\211K\221$\3664"
+	.ascii	"\n\n\265({\274\2336j\357(,\316f\006\261\263@c#\227\347,\266\342"
+	.ascii	"\234\347\255T\372\n\025W\352\302\313\240F\305\213\330\3300\341"
+	.ascii	"\210\021Cx\302\204\225\177\330*\201\266\265\307\317\311\241\275"
+	.ascii	"\267R\034M\234\225"
+	.string	"\247`s*\375\316V\222\316~o-\024O:q\024o\310 gN\274\210\255\251\206\204\023n\004\331\211\274\220\264x\355\361\314\245\226\267\227\211\267!_\260\231\230C\374;\223\2258\377\275\273H\274\304\210\223\030\203\f\"\300a\030\361\242\030\020\231p\302dYE\204\300\362\207\201\270\022\266\307\207q!,\251w\r8\300C\234:w\224\277Z\244\177\301r\244\031w\205J\3003\026\021g\300\367W\210\213"
+	.ascii	"\361\020\t\\\ri\004q\242\271@\207o-\224i922{\222X\021\025\261"
+	.ascii	"=\276\013\027*o\261\243\237i9\272\033\224\353s6\273\nlt\356\363"
+	.ascii	"V"
+	.string	"\241\350F\037^d\206\224*\373\360\242\271Af\237\017\200mWDgGA\346\341\213l\217'\033\373z\223\021\275\nrI\354\354Ds|\224L\314\202\347\263\365\363p\026|[\031\272\207\016\037j\372\024\244\224\332\002\017\353\360\242\271\277C8P\324\230\3518\002\262\265C\302\253F\034:Z\007.?Q\346a\214\206>\016G;\024\346\256\262=\336KJ\031\207s}\213\203\237\237\362y\346\322\203\330x~\276\257\024oT_t\272\026R\352YQ\352\213\356\372\016\341@\331\303\374\342\260\320\033\343\321V\017\263\362(O\230\263\032\364\004b\365\240\"\211\346\264\233\340\007\324\355\263\b$H\177\265E0i]\324\243-W\240r\3267\220\353\323g{\374U\005\306u\305\212\332N\374z\301n\373\301\223\223\017\254\246\226@1\251Z\262\244\212\352\004\222'J\246\216\220\200\204\211q\312J\t\022\016R&UI\254\250\230<\031"
+	.string	"\204\007I:`RE\004\211\325\224\003J\252\232X1\251\242:Z\252''VL\220,\261r\362\004\004\016\2462\240j\002E\325\001\024\223$SK\240\250\2328\201zR\332*\021\2204\201\262\252\252j\0025\024\007\205\337e\331K\0353\364\211y\216s"
+	.string	"%g9\205D48\313I\033r\344\214\227\025\304\3109N\232\217\"g\273\274\035<\316vY9\232\316pm6x=\237\371{b\254\263[\036\023k\235\231\2052x\353L\346o\211\245\234\311d\265`\260\363\230?%\236r\036\223\225\304bg1m&\330\3129K\332\b&;\227\265\205`,\347+\177FdyD|v\266R\330\201\271\234\305\210=\213\234v\253w\355\256\225\021P\2357\207\204P\256\334\346\302;\344\211\211\211n\004\f\240\344$\352\004\200\253\333cZ\206\005\356\\\347\344+(\271\023\247\264?\274+\031\341\214w^#\302G\250\272\b.\244cH\343\226$\234\261\352\034\322*L>T\370wg\316Z\021\"\032|\205]"
+	.string	"ov{L\247\204\275\235\355\226\374+)\246I-\205\324+\214\006_\322\346\247lr\rBx\223\263\033\020\036B\222\203\220v%\305H\001\246\\\351V\230$\227J\265>\370Pa\337\341\030\rr\356"
+	.string	"0\344\310\225\360\204\234\301\333c\252L\241\2349\343y\360tM\212i\002L,T\346\310=p\362u\360#\350\037F\362\016\316q88\022\252s@()F\210\332\r\203\312P]\210\027\303\r>T\3107(\365GO\013A\214\\\305\034 f\346\354\021\265\241\0063\3479S\007\224\024\343\244F8\3504\362\251\274;\006n\244\350M\006g\340,\007\203gp\30118\277\200\n&\305\b\001\364\223dF\251\365q&\341\240"
+	.string	"/\270\220@\024\320\202\017\025\3361\307\370\356\374\360Q\344H|=\334\370\366\210\372\351q;\363Up<\310\245;E^\201\263NN\352E(\270\324\271\316\361\024L\360#j\007)E\205\362M\360\242\274:&\034:q\300x\354\340\361!<Qe\360\354\021\235\243W\346\214G\202\347\341\335\321\341q\t\350\2247\316#\202\3378\367A\360\b\0368\004p\354\336\320y\240\215\003'r:\017\345\354\342t\344hz\207=8\230{\366\210\256\221\201y\336\323\300\351\234\315\277\2467\3206'\007\343M\013\034\306Y\217\002_ \201+ \227\006\315_\002p\b\234\3109\307\214#\274ac=\207\300\032\313\300=\242ne\226\347\300\003\276D6\221i\243a\375\001l\205\224\311\363j\300\223g>\005\334"
+	.string	"\002^"
+	.string	"\032\003\222\233j\350\030\030N\240\201\200ssm\200\0235\021\317\300i\201z\302\272\210?Nd\376\354\021\005\323\002\231\363\037\001\356\005\331\244\226d*\261\200u\001\232\202\344\260\210\234\363\316~\0028\021"
+	.string	"\036"
+	.string	"\032\332\005\345rB!"
+	.string	"\320\263!'j\n\222\323\344f\320\025\223\326\217\030\020\2156@\001\203\356\250r\2209\2252\245dDD$IA*i\f\322\r\b1\3120\211\254\016\022@\0221\b\307\201T*\006EHS\250\321\030\\\037\216'\240\274\310\303lHz\257\305x\264\205C\274[\030\276H\243\305>\363\366\250DCy\017\277\231$\354\215\002N%\327Z\311H"
+	.string	"@$\307.%\224n\314\211P\034a\233Ps+@\343I\245?\254Q\304\216\217\267}1\375p\334\333\013c\377\353\347\214"
+	.ascii	"\205\202<\303\23615d%\3041\f\032\277\216\360\031\032\252\323"
+	.ascii	"\305k\217\b\217\217\252=\304J\225?\037ZN+\313\0360\225\204\205"
+	.ascii	"\314\035m\256\031S\tz\0046da\346\335f\212\251\362\203\365\310"
+	.ascii	"\203t\341gU\275\200\026Q\006vf\204\370?\246\207\302\363\221\306"
+	.ascii	"y\314\323\267N\255~2\256\370\205\270_\271n\345\203\t\356t\030"
+	.ascii	"\314F\026\262h\226:\fH\354\213\021E\352z\2042\026oQ\366$8\355"
+	.ascii	"\026I\240\347\005YPd1\375\304\350\312\377\016\210\235\262\252"
+	.ascii	"PaJn\021/_\254\317\365\373\315\032\266\020\247\314\0172\271\271"
+	.ascii	"~\306\311\003j\216\016\326\"b~\021\204\345\306%q\320\305\366"
+	.ascii	"\335\371\233\370\235\247\330\343\027C\241T\322\330\013\357\217"
+	.ascii	"M\030\320dF\361\227W\266\221\262k\375\202\336\305\2413\313i\354"
+	.ascii	"\016\266\210\373*\302AC\302\341B\036\t\363U\334V\177t\356\233"
+	.ascii	"\003\201x\264\363\2226\362g\255\275\200vsd\3152Wa\033^#\216\251"
+	.ascii	"\261\232\"6:7#\006\203l\227\233g\034\203m\340\220\271\225?\240"
+	.ascii	"\366\242q\375\312\336ER\r\366nQ\006\020\347\0163\223(z\025\350"
+	.ascii	"1\213\020\027H\210\201P\327\265~\344O\2463\327"
+	.string	"\372\315{5\342\017\337\237\350m\002c\307\020\032\252\360\223\025\201\0254\232\275\341Y\332\370\036\332y\335\020F\246X#\263\311\2152\307;#g\275b\321\f\027R\247\311\271\n\311\"\004a\t\031|\361\227\210k\216\363\252\036b\247\215\326Jks{\254\346l\222I\315\345\330\332\023\203\007m\312\313\322Vow\300\320\023C\027\322\275b\341\007\305A0\205\226\264[_\330\253\tu\207s\305\001\363H\323x\212\300\356K\223\024\207\252\377\277\206\305(\244\352<\302CA\225G\212jB,\004n\324i\t\243\250\355y;e\027\215l\333\005\223\t\375\374\227\250\373m\312\322\r\210l\215f8\001\213=*J\320\375\260O\211\331\272\302\220#\200\306.[\325/\350\315\032z`\267\250\206 Q\226a\370\252\230v\255Nt\032\227\201\004\306\235\336\337\024\230J\260\206\203Rv\233\304\233u 8 \274I\357\217\202\330QH\016"
+	.string	"(\022\344\235K\"\320\344/\275hU"
+	.ascii	"\301\247J\222M\372\3070\255G\366x\342q\326`\021\026\367\207\301"
+	.ascii	"\356\202r\214\206\256\")\001\212\252\376(Y*\272\310\244#"
+	.string	"\244D\025\275\372ov\262\242\034\270[(\002Jt\217Y\321%\263\222\203\250\027UfE3\250\231I\365\277\021U\272\353\257\3543\311\227)hR\245\007\311\204R\215h%h\233UK\272T\221\305\224\215=\243zM^\310\345,\334\371\224\252h\331\026\203\343\200Q;\270\260i\225\350\324\367q\013&[\357xl\037\243\300pq\032\211\211\301\026U\276(\004p\021\211\334z\022?\0367\241\002A\307\267\0035\337\205\271\200\307\021-@\250\005\345sEy\300\314\347\034\354\322:\373\035\270\302\311\317h\362+\236\206\214\324\227\233\003hD\375\216\223\363+!\001 Y"
+	.ascii	"\346+\177\331'%A\f\335\344RhP\324\323\307x\315\313\207\246v\365"
+	.ascii	"\251\336\354|\265\245\357\3348\260\260&\317\035\244\243YL\301"
+	.ascii	"\234?\306!\276hW\214@\307\252\337p\372\373\202\017\366#\313\334"
+	.ascii	"W|\023\361\231N\006\204\0168 \203\365.\f\265\327Q{l\265\307\244"
+	.ascii	"\373\356\325#P\377\352^=M\255O\346\320\313\"0{\251|:If\243\346"
+	.ascii	"06:\324\257w\305\374\225\023.\243\t\371>\236\321\246\342\243"
+	.ascii	"rb\254\312\r0,5\t\307\017\316\332\177CA\223\346\251^\003i\306"
+	.ascii	"\251\234\n\355^\365z\260\362\bR\210\343~u\343\272\206H\220\230"
+	.ascii	"A\302\035\257\032\354Q\300@-]\215\005\376*\351v_I5\2462\f6qW"
+	.ascii	"\260\201\001\\\222\262\277\036\257\307 \306 \215\206p\373tj\235"
+	.ascii	"\207:\002E\236\003Lp\005\324\374T\234\307\352\3574\203\017\233"
+	.ascii	"yU|\"\353z(E\323`\242\0310C\377\272\275\374[\341q{P\260\252#"
+	.ascii	"|2|\353\331&\b\032\005}\330&\206\250Q\323pr\211\240\374\200\270"
+	.ascii	"\313\025\203\227\220yn\215\372\260\211\344\201\312\335p\364\371"
+	.ascii	"\233\365\220 e\273\277\217\360\312\274j\203\334u\203\252\312"
+	.ascii	"\260J\230-]s\214\r\322\202\226\203\317\216SC\274\320\206\377"
+	.ascii	"\r\305\212\325\222\324\375\267\260f\255\352\263\345\017\251c"
+	.ascii	"\343\321\363\332:\254\256\256\355\345\233\247\310A\232\370\251"
+	.ascii	"\003\373\030\302\230^O\324\2278\257\r\317)Ar;x\203\247\277\303"
+	.ascii	"\353\230\370\303\005O\017\354\374=e\017\242\005"
+	.text
+	.section	.gnu.lto_applyAbsoluteAdjustment.79.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\022(\335p"
+	.string	"\252\271\270(G \214SI\007\337+\n\236\234\177MPw\256\362'\231\366@\240\254,'\241\2537M\226\206\r\r\321#\305\033\001\374\237\256X\305+X\2279[\314\360w4\230U\370\005\274\264\037\006b\017!S@\021\032\331\215H)S\241\002\034\002\201\002|\256\374\3355F\340"
+	.ascii	"v\335AQ*\211\206h\240b\ne\366n\367_\2664\303e\227;"
+	.string	"IK.vZ\352\324\362\224\"\340)\261\344\261rg\211\326GE\217\322\354\317R\312\337\222\314\2202J!%\024A\026[\304a\220\022\007\017[\204\303I\206\205uKIE\274\304e$\275Gy\215\362(\007\357(\005\375,\025\365-\021\001R\032\372\243\f\f\\\016\"\264\004\\\244\004dH\371\227\366\021\334\023\251\017\022_\022q\251B\362p\271gw\247N\211\242h\336\3525Y:w\241\206\327\344W:a\353\374J\357`\351\334\207\332\235R\007\277\322\026\247~\260/\336\225\376\337\235\317\030vf\274\033\223\210\021\212\242+\266\370\n\214]w>\224\352\0210\357\234/s\003\372d\204\023f,\377\013g\343\200\355\334\007\313\204\242n\205xPt\216\352,\214[\374\234\361\3777n\337\200\375|\346\334\033\332iv(\212\335\022E\321*\022\353T\267hn\207\272\305\016\263`{\273\327\235\356s.\347s\bd\035`"
+	.string	"\226\214\002\256b\300\260\"\340\205\213\001ZT\261\240\232Z\241\"\205"
+	.string	"\001"
+	.string	"\200\342\204\224\211\022$\242F\210\b\001\002\352\351\370\301\203SS\007\016L\0334,e\300\240t\301\202\361\254E\263\031\354\273x{CLMR\031Z\330\336\256n\312\236n\212\236\024\376\234\3131\257\264\215@\266\237\013\321&F\266\007\002#\220\205\270\007 \362\035\262\001\206X\223V\306\244=+p\001W\313\215\261\374\033d\030V\202K\200 \340\"~\341\"\321\016\220h\003\021q\213*@\313\002\020\242?L5\345gW\370\021\354\303*\370\244\330\263\002\354\331F~\034"
+	.string	""
+	.ascii	"v\026\205\235\215\244\307'\362\244PX\023(la\035.A\202\316F\321"
+	.ascii	"\331\3038<\002\216\b\271\r!\027\366\206A@\271\331'7P\332\360"
+	.ascii	"\361C\231\365P\206\214\f;\215i\202\333\016pf%0\007&\022v\003"
+	.ascii	"\tho\254aim3\254a\341\302\030V\320\331\026%-{A\213\332\226@s"
+	.ascii	"\226\205-H\231\255\261D[\225\344\236+\350,\311%\nWS\305\232\237"
+	.ascii	"+Khc\246\023\340\b\213\026o\315\264613.bY\323T\301h\217p\t\r"
+	.ascii	"\212\351D\205L\031\263-KA{\302\235h\270e\254\2540\345\223\007"
+	.ascii	"g\214\242C\177wN\210S\212\351\262mgj\027\320\304*\023Jckj\023"
+	.ascii	"3\373\300\347\f\024E\317ehU\366\013\354_\354\340\277\007\277"
+	.ascii	"T\207\253\246\267\372<F\270\211{\276Z\325\253\246\271\313\232"
+	.ascii	"n\340\346\332\204\271\203$\306\211g\267\375\2140>\364\300\206"
+	.ascii	"\006\204\356/gG\347GO\217\211~$\006\317\214\236\036\017\243\004"
+	.ascii	"\237\036!%G\354WMtV\364\364\274\223\fq\310\017\304~\325\300s"
+	.ascii	"\241\2475\321\017j\320\323*)\371\264_5\320\031\360\351\323]\362"
+	.ascii	"\303\337\371\317\323\343\240\237\007>\347>O\217\202I\247\276"
+	.ascii	"\263\337\323c_\262)\317\231\357\351\021\317\257\303\3369\205"
+	.ascii	"\247\247a\222\303\035?\246\375\252zO\317\304\r\373UQxz\016j\330"
+	.ascii	"\257J\347|\302\3233\320o\351\356\351\371\227\314\260_\225\356"
+	.ascii	"\\\367\364X\310Oi\356,\347\351\221P\362\202\334\031\316\323\343"
+	.ascii	"\237\237\0057\347\270\247G;I#\233\263\362\351\211x\2529\233\360"
+	.ascii	"\364L\375\352\2313\232\247\347\242d\221\314\271\314\323\323\217"
+	.ascii	"Y\302\031\356\351\311\347\327og\022\236\236wI\376r\006\363\264"
+	.ascii	"\022\356~\325-\362\b\377\323\247<?\024\r\333\265\247\\\206\246"
+	.ascii	"\330\"U\257\210\333\202\306a\304\177N\214\373\313"
+	.string	"\277&\332n\277\0324f\310\300\211y\003\343\326\346emK\226d\332\225*g\315\337\020\232\277S\232\277e\225\277\244\362\225T~\222\312\337\240\362\275*\277\253\362\271*\037I\345kP\371\031T\376\221\346oU\276\221\346\023i\276\220\312\327j~\220\346\003i\376\217\346\373\250|\n\232\337\243\362%h>\217\312\207\240\371;\232\257\243\362\035h~\216\346\343\250\374\033\315\267\321\374\032\315\247Q\3713\232\237\265s\273\0064\037\253\362e4\377\252\362c4\337\252\371/*\337E\363[l\335n\325\316\331\245\332\273\375\211\312\227:\371&\214\374\022'\237\204\221\037u\362G\030\371\"N~\210\312\007Q\371P'\377\251\362\217'\377C\345{8\371N\225\337t\362;T>\207\223\317T\371\033N\276\206\312_:\371\031*\037\303\311W\252\374\013'\337B\345\033+\377\254\374Z\371\305\3127+\277k\206[\032\307\226\336\3016\001"
+	.string	"\220\2439\317~#\2418\022\351\310\356\303\347Ho\244\r~}z.\310\321\033\272\030\230G\003\241\265\316\361H\205\023yK\265eJ\233\034)\035\315y\373-4ad\013\217\354=<Fz\013\227\342\332\216^\036\021\035\275\324E\301:\031\002`\253\363\342\245ux\351\225\264\246\004\211\035\315{\373=\214\322\332\303#\033\357N\253\367\020C\335\326\324!\2729\030\330\330\321\030\272\0308\247thM.\331\326;\032M[\357$<#\352\254"
+	.string	"(\202Gs\235=\207\205\240 \354\310\226{CAs\330\205\376\301\344\332\315\026\325[\033\2608Q4ZY\243\331 \261\221\204G_\350\242`\024\304\267\2326!\311\027\3567\030`\240n\321\002\273\211\343eM.\351\326<\350\270\365&\246\001\001\325\243\371\314\236\241<I"
+	.ascii	"\345\3106SF\202f(\306.\241\307\300q\2176\206\021\004\323=\300"
+	.ascii	"4\213\2319~\360\321Lg\317d\036  ;\262\337\302@\320Lv~q\363\321"
+	.ascii	"'\233Bto\355\343\2559\n\236\223\335`\323\217f\273=\233up\300"
+	.ascii	"\354\310f\363\342@\263Y]\333:q\250\201\346\362\243+\336\0371"
+	.ascii	"\375CL\263\2241\034\230\2004\227\260g\264\r7\320\216\354,j7\232"
+	.ascii	"\321\236\370\337\001\001\206?\177\201\304:\354\305\376#\350\264"
+	.ascii	"- ]L\321\247\207\016\256\201\3005S\021\243a)Hs\242=c\3110\003"
+	.ascii	"\313\221m\245\312\214f,\346\031\225 m\366\345\021[\261K\246\203"
+	.ascii	"\364\030\231f+\2100\030*\304\246$\244\331\320\236\325.\310P;"
+	.ascii	"\262\247H\221\321\254\326SM\266\205\342\255G\203 \244\033\017"
+	.ascii	"\217\316L\0139!3\315\"\204\261\320_\214D\232\003\367\314\005"
+	.ascii	"C\322\021\240\263\277\360\341\306\340rd?i\261\030\315\\\230\252"
+	.ascii	"\303\0325TG\207\246\211@\332\252^4\315Z\b\355\236(D\304S\005"
+	.ascii	"-\025\323 8r\036\rB\364\204W(6\361V\263\240=\263U`\001o\331\213"
+	.ascii	"\035v\302\201q3\203T\027-\204.\321\023^\341\314v$\033\0061\242"
+	.ascii	"\350\023\030\347\025x\222\326\207\024\341-+R\267\350\242\231"
+	.ascii	"m\271\215\231\341\232\034\034'\375\177\212\227[(\016\241(z\365"
+	.ascii	"\037aI\032\030Q\024\205A\b6\306%\342\r\356\203\272\305-s\264"
+	.ascii	"\325\333\213\267+\364\030\212\031\302Ct\302\211\237\332\307\200"
+	.ascii	"\305\022\f\230hqUuyqqy\r\201\232\240\203\"]\306\"M\220hqP\354"
+	.ascii	"\362:\302dHW\223\0058l\0351\322\345U\243\b\023-\036H\274\224"
+	.ascii	"0\351"
+	.ascii	"\362\032\302\364!,\2260\351*\302\305dI\223\f\210h\005\031\242"
+	.ascii	"\244j\210\221\252\256#Z\\UC\224,\251b\021u\257\r\212(\251b\342"
+	.ascii	"\345\245\244Ji\316\311\266\333\235\306\322\220a\026[\317\350"
+	.ascii	"Q\240E\3273c4^t\355\262&\313\252+\2274\254\253\256Z\326\\auU"
+	.ascii	"+d\225\325U-\315\005\215\256\"\334U\325\350\212\205p\312FW+\205"
+	.ascii	"R\340\350je\f\200\034\275\211\204R:z\023\323H\354\350\235D(\202"
+	.ascii	"G\357\2444\250\036\275\205w\037|\364JZ\323\364\2437\322\035\023"
+	.ascii	"\220\336G\204KAz\033\025R\022\322\333h\314H\244\367\314\037b"
+	.ascii	"q\253O\264\224\377'6\204\2614\201\n\0319i\261s['&&\306\331P\240"
+	.ascii	"Es\240\375\352\325X\242w\244\031\347f"
+	.string	"I\257\236T\032S\271et\323\242\245\272\362\2551\241\\\223K\226u\213\262\336:\200\022\240\361\242\331\321~\367f(\331;\322L\203FI\357^\t3`l\312\230d\300\340\274\350\022]\374\203#\221\3476\245_L\351\275\323\b\201,\253\346\301\375\362\035\220\204\357H\223\204\267$\275|Q`\300\330\230_L\267\004\254:\312l\033\201\307(\204\2662\323B\350U!5`Q\034\033\326U\363\242\375\356\221\261\301\236#\315.\346\332\006\275{D\230`n\001ccj\311\262\300U\213\350\242`2\004\336\333Y_i\300s\326\333\347\247\200+\254f>\373\375\213\341\265\177G\232WL+^\275\177 L\264-\024G\3143\254\006QT&S\261*\215U\245\267\317\036\030VY\315t\373\005$\240\013\360H\323lJW/ T\033\263\314$3Ap \253\241\314\261\2477W:\353J/\2409/\\\320h\236\333o\340"
+	.ascii	"\\\201G\232b\246\023\256\336\300c\234\211&\">@\243\217]\3743"
+	.ascii	"\374p\367\226\326"
+	.string	"4\322z\007\305iQU\243Yn\277\210X Atd\027.\221\364\"\362@\2705\365\026\t\222\0045\332C\027\377\0349\331AJv\215d\257\2417TS6\232\373\366+\270B\003\301#{0\325\240W\260i\221\242D>lt\323\241\016v\201\262\264\215,\275\212\364\250\260#\206-\005\216f;\373m$@\006\215\216\354@B\031\3646\342\320\246\005\001\006\002\202\2439\374a\n\203\n\250r\260-\0203D\f\211\210H\220\024$I:R\016\204\b\r]u\003\022 \322$H\263\\\b\rUa(Ij\026\016W,\202\374\b\237\024\222\374\327'\227\035\231\226\006\307%!W\326\224\344\0278\351~\020_!\363\206\030\016\223fr\214\370$\326\3326\031\362\201\245+|\2037\tyi\253\233\30188\205\302x\373\205\301\232\0063\263\244\020\215\345\206K\310\325o\237\371\002\257\275\316\301\264#\276\265p\215\241\227\\"
+	.ascii	"\021\304\357\365\205\026\370\227$;\027s\310/\020$\253\243B\345"
+	.ascii	"\206=\315\261I\267u\347\202\n\245\215C\030\036\226\373N\264\373"
+	.ascii	"\352>\270<\255\260%\233\037\261\3012\202\f\311P\262\206\027\301"
+	.ascii	"\026\023\275\232\274\031\305\247\270\306I\033e\274`\367_\276"
+	.ascii	"@G\355\330\372h\310\024b\310\234\312"
+	.string	"\342\001\234\024\341\313\367\307C\357\312\322\002Pj\317B\f\177w\203\206\346\224\034\017\300\245\344\350\267H\276\304\353>\362\313\016,H\270r\253\314\316X\022\355\200$\334\374\202\327}\206\331\270>\216`\"\231\3238%\307\376E\372.\234v\221^R+\002\336\310\005\206\204\315\323\213\355F\327\031\334\025\035\352[\256\255\317\267\343\021O\276Wf\006'\322\304\032\001S\222\237\350\faXX\261gy\024\234Xt\033,\321\204N\234\243\\F\201\"\002\342\3774\020\244\263\204\341\260\342R\337\321\216\244b\237\274\350E[\027\212\035\343\362\263\216\373\027\337\231\rq \340\177\353\n\237zQ\275\331\332mc\304\232s\364\004\336I\f\017\226\375\016N\265\203\034:\216\217\306\357\355\3114!\226o\312\353\334!\204\237\327\311\005/\236\211\237x\324\211\f|\213\260\216=\002\201\254\367\t\346\374\031G\306\212\331\252\277\357|\201\327^\256g"
+	.string	"\332\334{\303\203\316\3458+\341\313\274\363\342\245\311\2528\261A=\302\217\342\367W\376\363\236\312\253\276!F\242\362\223/\340\324\2254\317\215"
+	.ascii	"b\265k\361k\b\2024D\266\033o^\274\324\222\005\364\334\032^\276"
+	.ascii	"\317xF\032.\244\004P6\004\254\324\360)\274\227\331K\260\022\007"
+	.ascii	"CJ\005\b\372\fs.\\\006yQ\205]\035\214\030\345\253\370)\\\252"
+	.ascii	"\267Erl\220\304\\\021\177\0311\rQu\247^\357\320fbg\022\361\336"
+	.ascii	"q\361\320\227\035\203\276c\263\025\034V\256$\333\251\345\270"
+	.ascii	"$n84\300\236\\i\274\350PL\222\350\027\036j+]h\005G\301\320\276"
+	.ascii	"O\021U\3649<\320\226\340j\301W]\310\205\251,\214\327\202\253"
+	.ascii	"\303ZH:T\f?\240\331*\306\031\350\273@\204\337@\034\365>\262\207"
+	.ascii	"\332\022\\-x-\360Z\210\031<\370q\360{\215\364\302\370;X\\y\270"
+	.ascii	"-\303\016\326\247?Z\031V\026a\270 )\251\347\257\350\331\273\033"
+	.ascii	"\346\314{w\326\315r\263t\013\360\352]%\373\033O\277\203Z\367"
+	.ascii	"\303\324\341\301z\030\243\215}\222\237jB8\330Fm\274\034C\305"
+	.ascii	"\234*\226\236c\006\260\210\307\034\362\213-\fb\231\207\025\262"
+	.ascii	"\037\212{\233\246\306r\273\002\336\3460)t+Q\352\224 \200S\360"
+	.ascii	"\341\\\0202\013U\343\034\226\232C\307(P\342L\360\217\002A\266"
+	.ascii	"8\306\323\332\001=L&h\251\350\212\222+\231g\354'|\023\373Q\177"
+	.ascii	"\344Q\25114\024\224jy\310\225<\360\027\212\330\355\005\3722\276"
+	.ascii	"\317\275\356\221.\360\021D\342pPy\001-~t\216.vF\365\237@\t\360"
+	.ascii	"\325\256\030p\2643\224\275\370*\224\326\342\216d\006\361,\223"
+	.ascii	"\035\264\242x\266\300\323\276Q\223\r\350\212/U\325\213\251\340"
+	.ascii	"\013\017\347@c\351\334W\367{\224\332\310KGG\017\\\230'\223\206"
+	.ascii	"\351\260\202\337\321+\361\352\2108\360\207\001l\360\013\007"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.80.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\324\006\365'"
+	.string	"\032Gh\017D`\346M:\023\351W\353\201%\232\002>}\305\201n!J\033\251YvC\320\006^T\024b\017n\323kh\r\202\323\213ki^P\252\366\332\211Y\007\337\2637\265a]\247p\272\026of\326\210%\233\310\235d\345"
+	.string	"\325"
+	.string	"\344"
+	.ascii	"\275\333\312\354\203\237\344\0363{)\376Z\335\035}\310\2400\357"
+	.ascii	"={p\313\037\322\256?+\036x\217s\244dHo\271V\346sy\231\217\233"
+	.ascii	"\365\340\335\275`\202\330\356=\213\300M\351\255\322\005\240\267"
+	.ascii	"\347\213\320[f\346\t\024|p\021\251\312\310G\211\354\311\025\030"
+	.ascii	"@\367\236\005\273\311\213'\032\372\371z\274]\252C\355\331\265"
+	.ascii	"\310O\276\303\361\311\032\226\226\361DC\310\372\253J\356\373"
+	.ascii	"z/I\345-\201\021\361\372\356r\262\274\324\270jz\n\210\303\004"
+	.ascii	"\217\003\244\033#O\373\022\225\254\255\252\323a \242\344\350"
+	.ascii	"\221\333\323\001\323\314\237!-\253S\300\220(XWV\325\363Tj\263"
+	.ascii	"\274\272\234\254\257\363@\330\327\334\223\257@\264\250j\177]"
+	.ascii	"\361\264\216(\360\336{\260\254\256\263\3520\334{\271bi\0219\003"
+	.ascii	"\317\374\004\314\254\202\031\r\021\314Q7\352\261\336\227\203"
+	.ascii	"\203\263<\266\221_\346\250\225% \246\261\022z\267\030\037\r?"
+	.ascii	"\315\022\222\215\013\2266\376\031\244/\271dfS\356\2225>\033\353"
+	.ascii	"I}\357\201\336\276\252\273\230\\\032\220af=w\013Cz\335k<\222"
+	.ascii	"\365T\254\333\340\326\250\253\322\n\333\034\263\252\026b>;\326"
+	.ascii	"\026c~7\233\315&w\030\223\255\274d \351hg$[y\300\317\376\243"
+	.ascii	"\233\375F]\271\350^\316\300\256L\324\225\177]\331\327\225{\266"
+	.ascii	"2\317V\336u\345\264+\353\2722j+[\264\362\331\225\273+W[\371\n"
+	.ascii	"dT\031\"D\353]j\356\035\322\034t\227\266M\312\321~/W\023\303"
+	.ascii	"&\270\340\260\374\013?\r\215G\02524\022\007s%s\217u\374\013'"
+	.ascii	"\271Ys\357\355\351`\016i'\275\261\322\202vQ\353\372\254c5\305"
+	.ascii	"6\332\3029^j\330\255\f\213\223\264\305\220\332\366\301\230=\\"
+	.ascii	"\256H\301\t37=\016\304\002\271{\257\005\021\207\033\221\336{"
+	.ascii	"+\324\311Q\202\311\311\030\021\275\265M\341\211\031_\316\347"
+	.ascii	"\020\371c|\002\005\n\364\366\354\033\341\2423\267U\324H\001\362"
+	.ascii	"\240A\273\213\232\253U\237cm\362Qw?\355&"
+	.string	"\216^7s\006p\204\226\272\026{\021=j\003\375\344\3174\\o\222qJ\344\0215\252\265\277v\276r\005\013\333F\243\266\270k\357\002\035\320/\256\344\026w\343\"\275\227\252\002\377\355m\234\370c\267,\034\326c\r\321\333\001}\345k\226 \203\220ef\276Z\233\371iF=\026+Q\265\221\217\272\266\216I\2220W\205~\324\346\005\264.|\316\243~K%\355P\325@\274\253\001C\0344\234R\350\030B\245D\033\303\341\013\373D\214\262\221BE=M\t\241pp\b\300\302&\342\024\324\260\306\024\021\207\f\030N.\204RAa\214 \324\223S\215\240P\212\030l:\300Q6\206R\301\251\250(\251`\357\354\307\317\333aK;d\313\037}\344\217\371ID\324\314\032\200MD\245+\3141.\214\204$\362m\250\305\370i?\022e\226(\276\244\376\030\331\226\2535\324@\003\033\bs\021\005\"0\272]a\fE\252"
+	.string	"u\375\356\363U\246f\3360\343\311\003\220\213k\263\244j\376\232\251\271^m\035{\277\356A\270\257\177}+\244\257Q?\274\356\365;\360\372rql\334\376\344y\312\262%sL^\367\333\316W+\300\274\362\266k\2617_R\343\026g\356Y\352\253!u\036<w\376\306Ugn\013\316w\235\324\225\220\025\362\330\273&"
+	.string	"&\325u\200\206\250q4\303\230S\244HFD\322\024$\215\001p\002\22113z\021\2205UD\223\2440\314\001\f\300W\216\016FY\222{9mQ\334\b\342\275\240\242\317\354\022\354M\262I\\~\336Y\024\016\357\233{A\224\265\256"
+	.ascii	"\234\227%fYC\020F\235\025\212\020\247\205\316&S\356\366;\264"
+	.ascii	"\017\023\240i\265\026wo)\\:\342\021\331\354xz\216\227\232\351"
+	.ascii	"7\035\314\217\364QI|\021\373\0322-\2421\036n\177t\t\200\033\334"
+	.ascii	"\360\234F\234\267{\\\224\217\214]\032'\262\306\020<d\261\021"
+	.ascii	"\026\025\024\351\021\017\336\217o\"l\341m\361(\303\351\006\030"
+	.ascii	"\302a\222!J\005\364\212F\277\252\365\225\220\271\027\316f\270"
+	.ascii	"#\335V\231\220\235\374\316S(\271\216\311'\201\206\316\335h|\024"
+	.ascii	"&\307\203\260\211\240\271\177m\355\374\020c\016\036@\027\210"
+	.ascii	"\316XO\372\224\303\t\021>\361\321(\036\r\250\332\221\350\267"
+	.ascii	"%\275\307Z8n?CL%\t\360\030o\247\310\343\341H\201s\324\202&`>"
+	.ascii	"\251\030a\330\245\030\206\0045"
+	.text
+	.section	.gnu.lto_calcActiveAdjustmentRanges.81.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`v\006m%"
+	.string	"\nC\244\016F\200\334M:5\266\200i\227\272\035|\220&\037\375\223\217\304\2103\001\230[ \335\333\205U!\212\324\360,!\004\326\370\217\210P\340#l\331\237m\007\031AC\331\367t\002\237#\032\332\200\255\020kk\226\020\"wJ\001\324"
+	.string	"\303"
+	.string	"\332"
+	.string	")\232 \212\242^\366\356[~\227\227\017\317s\231xt\n\275\224\361JJ\021EQ\r\270\227\r\310\034\366\356\345^\313;?\353\\\316\013\227\216\366\320\\\326U\223\"\212\372\204^z\b\367\322c\036d\276\324\235\200\371\322\247M\347\300\016\224I\302UUT\227\021EQ\3362\361\202\223[w\256\236\327\345p7\263$\267\236\276\326\037\244p\206q\302~L\327\221U*\f\323\321|)Ya\217\225\343\273\234j\356va\311\024\221\343\034\334n\027\326\256\260\354XMQ\335$\203\330$\231\003\241j\f\310\356\007U\313"
+	.string	"\277\250\335oG%\277\334\001\232\217\212l\340\365\332\343\367T\367]/\223<I\313b\263\232\"\362z\273\200\242\250k\3577u\357n\233h{\205m\362\002{\257\337\207\027\261x\260\2479\332\256\203\331*\216fi\315\322P\024\245@\274X\n?\312K\023\025\025\231/\203\366`\007\001\244H\232*{\302\2044\325\343\326\3312\204m\315\030\351H\305\202B\367\307\234\214\211~\024\263\360\231\372\236\317\230/q\244D\343ZS=zWu\367\032S\350\337\272\326Q\200&=;\006R}\317\325\213\350c+B-\223\275\345T\027h_"
+	.ascii	"W\032\224W\211\255\340V\035t\256\033\210\254\006\260\325\273"
+	.ascii	"\255\326\221\325\271\255\306m\365\315\2546\313\352r\253\311\255"
+	.ascii	"^\262\272n\365\027\034\245?|\374\356\344\210\242?\216m\350YY"
+	.ascii	"f\312\271~\341\253\3750\377\313~\227\203\331;\347\370\227\257"
+	.ascii	"'\366yu<g\226\373R\262\t\266g\374\316\211e\nS\262`\361v\316-"
+	.ascii	"'\227S\253b0\2016\267\t\332@1\213\372\203[:\357\335\211\360\333"
+	.ascii	"\342\366sn\373\260s\250J\311\260\250\310\234\0051b\376\032Ls"
+	.ascii	"\027m\250\226\341r4\230X\3221\243\355\033O\343`\212\245cA\024"
+	.ascii	"}\202\3638\035H\017\037\314\020\346Ks\037"
+	.string	"F\316\335\207\316\233?\345\002M\302,\367VC9\266\210\267!\221c\"\272AcS\356}\351\030\233p\350\273\344.\310\003U\345T\217\256\273\373\250?.q3\023GP\205xV\225\205\242O\023\312\226\326\200\2357\303\037Yc'\243a\276\254\373/\347 $\035\303\022~\017\031\2306r\201\026\3727i\250\366T\371\230@\275\230\377\353ZG\270\240\265O\240\bn\341\342F,d\020\215\300\240\004\303\006\321\n#\025\005\\4TCI\206Q\f\245\0326^\250 JQ\224\304+Z\301\223\341\202(\006\257(\251\006o\210\201\221f\030%\361\224\220\220\222x\273\255\246\257\022oP3\206\255\330\264N^\"Q\324\312\302\205\277\326\007\024\275\324\243\224n\201\276\251\341\024\354\252U\241\003m\017\023M\240\275\360$\212\242h.\302\201V\301\276\353d[*6\214\343U\371\340\026h\0371R{\347\021#\017)-\251\033#"
+	.ascii	"$\025\312M\360E\335q&1\323\244f\306\352T\237N \223\323I}\357"
+	.ascii	"\204\002`\023\264\211\362\265\253LF\272\335\035u{0'\267\220!"
+	.ascii	"\266Uq\241\002\372\301rv[\3409E\312\333\316)\306>|\250\244e\306"
+	.ascii	"\265\246\363\212i\237U\276\347\274"
+	.string	"r_Z\026\324\223\347\301\264,\270\226\333{\250A$\245\220c\310(#\"3#\232\024:\240\002\031\242\252y\021\220\251eD\n\013\013\232\375\r\374\265T\016\025Z\335\213\365%+eL\362y/\035\354iD\235\343EY\357\317\007O\252z\025\t\312\022\001\233\272dDPOU\222\0013\006\025\212(abR!\311^C\315\365z\016e\221\312\024<q\243\302T\024\323\347\334\372\234\360\317\260P\200$\036\354\304\001\225<4i\271\277d\033\352K\202!/L\017\0340IB\374\216\3354\255\270v\321(d+\322\214\264=\214)\001\216\n*\204.g\215xQ\226\024P\020t$-Da\2616O\017\033h\020\223U\322\246\211\037\267#?\277\3271\017Yx\217\bN\207*%h\314v\346\305.\2526\022m\367N\377\016Z\337\353\260\nNT\023\334\375\343$\177\274x|\2005\301\220gKS\344\255D\244\020"
+	.ascii	"%\226\331Ws\336\337X7\254\246\177"
+	.text
+	.section	.gnu.lto_updateOsdAdjustmentData.82.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\316\002]\026"
+	.string	"\246\251\223F\260\032Q:\310T\222R\367k\242SN@\202.K\025\333\300\241\372b\236\202\\a\020c\317@\235WC]pA\327\377\373W\312H\340v\324\017\375\343\2414\247=\315\023=\027\n\367Q\303b\333\241%\233\020)S\n\177"
+	.string	"r"
+	.string	"\200"
+	.string	"\236@\272\347\253\375\037\007R\363\036'1\2009a4\001\232sB0\212to\301\017\310{\335O\362\236k\354+\bL\314\230\204\035NfC\274\3149\303\235\361\232\177\322\353Vk\374\217\002"
+	.ascii	"Z-\366\317\305e\227@\347\t\216\200\332\254k@\264c\345\204z-\336"
+	.ascii	"u\007\210v\2548\320y\202\003\326nt\005\324Lt\013\346\234\307"
+	.ascii	"]S\324d\252\037\2059\247\225Vcq\223n\273\204\355\226\255A\001"
+	.ascii	"U\200\f\3116f\337d\2722\354ws\316\351\215a_}\372\3241\277\375"
+	.ascii	"\246\367\374\245\373\334\340\247\226\237\332\273\272\223\352"
+	.ascii	"\225j\225\352\0330\005)R\373\215(s\256\310\205\231C^\020\216"
+	.ascii	"\373\334S\265\357\017\371\217\rz\346B\034\301f\004\316\330\340"
+	.ascii	"\275\037g\320\266\017\315'\213y\024^v@)\232\363\366\340\236-"
+	.ascii	"\330z\033\321\021\2307;9@s\336 \004+\367't\204\274\215`3\372"
+	.ascii	"\342"
+	.string	"\201\353#y\020\rl\034\345=\021\2660>rJG:\220\260u\361\361\242[\277\310\2158\211o\303)\013\351i\026\222\367N\313b\332n\013\340x\260\314\216l4w\032`\212\200:\006[[RC\347\234\261]\031\276K\356nLI\016G\345F\301X\367\273{#\263\234\322GH\323\352\016\220\302C\004\365\322~\003\340n\344fB2\3159\200\332*\226\236\006\356\026\005\366\200r\201H\275`\341\212\245R\261\304\004\256\013\243*\205\341\265\032[-\230hZ\261R/q\005\253P`\204\201\220\31103\256H\026Q\256\327jT\275\\\260\017\033d4\210\255P\344\020\256R2\252Pl\271B\224\002\263B\214\255\360\305b\265B\360f\363\215A\252b4d\263\262\317\017\316\3448\266\243\036[l4\307C\323!\222\242<m\216\212\036\"-R\242\304\354i?.\263#\271\340\306\354\177^A\307\213)<f?9\006"
+	.string	"\235Fz\0014 `\002\221\222\254\036\233\231f\233\205\023\213{\230\241|\355\366\252bC\353\222/\217\261\276\330E\270%L\274\301\023\2135\211|#\200\340B\271\250,$h\357\300\315\t.\\\354\367u\t\306\020\301\324\215[\210\243\305\221\375[\221\270+$Dx"
+	.ascii	"e\215\313d\324\003\375\230ATk\"S0\213\330:\3018\020\023\204\301"
+	.ascii	" \027\034\273/c\024\005e5\306}\361\nq\266K\225\001"
+	.text
+	.section	.gnu.lto_processStepwiseAdjustments.83.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`!\rME"
+	.ascii	"\272w\220\032?@\346\316\030\327\253\217H\261\224\344\2766\036"
+	.ascii	"\242\030\333\346q\3673\272nt\350\262\240\243Vl\261~\202=\001"
+	.ascii	"\001[@\276\350F\321=\245l\200_\f\353\325\317\216\025Qu\260\270"
+	.ascii	"d\213\334)\245\024\231\001u\001\236\001v\304\327\314K\244V\255"
+	.ascii	"U\265\327\330\206\355\206\250l\203U\036WM\307-(\225\033\344."
+	.ascii	"\323u\314H\326j:\326 \275S{\337\027\211\206[\256\325\314\355"
+	.ascii	"\200zZ\337\250\222s\r\216\fc\232%T\323\372~!\371\302\370U\007"
+	.ascii	"\337\327\332\242\343\270\317\230a;!\203i_\200\357\373\2420j1"
+	.ascii	"#\233\375\206c$7\231vs"
+	.string	"\373\215G\277ao\017\331\222V\004\360}\255\016\232e\023\306f\241\210\357\314\023*\270m\375\321\326'i]\025\316\373\276E1\207v\346\2566\233\333m@\032\351}\245\030\326\275\2575\212!\030\233ek3\265\315\032[\251m\226]\346?\001\266\336&\2054\257.\270\301\367}\245\276\214\237\232hm^r\267\231\226\224\222\220\216\214\212\210\222\310\241\243\261\330\262\304w\227\033\256\021H\257\316>4\321f3\021\213[_Y\332\016\030\026\"\206B@6}\246\335+\352\364\245\"\207)aWZ)\351\002\336\031R\025*~4De3S%4*\262\003\006e\352DE\016caf\235|r\327\007\320\300\2348\322\016\230\025\"\024\032\230\324\207>L]u\355\330h`M\016\330\001c\342\306\003cab]$\016\230\342!i;`bD\005u\250}\220\321.o\263\322\250\004\216\205Yi\266(\312\205\214n9\221\330"
+	.ascii	"p\315 d\364Id\372\312\002m5\355F\242[\376}\246Y\252\332`\225"
+	.ascii	"p,\354J{\221\303\373\276\354\320hX3\200fn0f\2662#\341\002m\315"
+	.ascii	"\347\206\221\331\373>\033\312\354b\351=\256\226V\252\203'\310"
+	.ascii	"\352\361k\277\350\266\366\007Ur\326yv\264h\322\271\301\367}f"
+	.ascii	"5\036\227K\333&\235S{\337'\006\276\276\343z!\272i\356Z\353\206"
+	.ascii	"i\233]\360-&\235#\204\320\304g\377\311\216k\352\364+\377\023"
+	.ascii	"\277]\266\256\263\354\246@<\277i\365}\237\026\232\r\263\217\336"
+	.ascii	"s\305|S \0368#\325\274\326\353\340\001\2047T"
+	.string	"D\333\354\177{(\235[k\353\367/\332u\035\362\210\306#\321\nJ\345,0\363\207\236c\242\235J\3450\304i9'\270\257\250\360\206\256h\233\355o5\035BP*G\330\026\304\257_\346\315V\364y\311\231]\274\360\206&\370\002\\\201u\204\200\316o2[\235\376d\314\215\301\254\360\017\277\024f\r\335\246\231B\267uO\220\020!\351\034\325i\232\037\264\265\333\301;3\350\271\346\005H\316\n\372\2559A\3335?\265\231\346\002\357\354t\344L\340\235\007 \235\005$\235\003\274s\323\321\031\300;3\035\235\227\336Y\351\235\223\214\234\221\336\371\250\310\331\350\235\213\210\234\211\216\316\311\24432\351<\204t>\276\263\361\350\\\034rn\337\231}g\342\321\371\337\331\217\316\275\201\300\325\311\367\226F\344\373\254\357\327\265\320\273\307\262\321\322m\272\355\272\323t\317u\233\351~\353\226\271\231\335\364\035#\3558\310(y[\250c"
+	.string	"\276\353\244y"
+	.ascii	"\024\236\275)bjs\303c\2521}\fjU\217k\352$Zz\t\357\206LC\207\262"
+	.ascii	"\224\362c^}\3526\221\321<\263'\356d\351\273M\212g\rA\2246r\222"
+	.ascii	"O\306JcnyO/\264k\223^\351\213vH\237\364\355t&\356\226\321\227"
+	.ascii	"\270\230\3335\304\365\362j\233E\372\nT\332\214\376\350\233cx"
+	.ascii	"\022\267\210\221\375\210#q\2778\352\036\361#m\263F\177d\363\340"
+	.ascii	"\213\276\357\232\004_\225\256\353\220\337\334\312\272 \335%-"
+	.ascii	"\321c%q0wIq\r\235B\323\252\177\271\\Z\311\215\020\275\017\251"
+	.ascii	"\036a\033\261\227m\362\037\274\033rM\235L\334ki\024\245\343P"
+	.ascii	"\037\222\374\006$\315#\034\302\245\306o\210\330nV4\352\361G\353"
+	.ascii	"\340\235\212\374\211\022\210\317\370dm%\365-\253\036\3227j\376"
+	.ascii	"t\247\230\364\215\232 \362\275y7\350\357\225\205\203\002z\301"
+	.ascii	"v\237\264\t\036\371Mn`\376\270\246<\370\246P_\321\205\3222x'"
+	.ascii	"E\3704\003\361\351=\203/\n\352:\034\372\004\037\365]\327!\320"
+	.ascii	"\234\370\305\351\213\333B\310\245\026\022\016\275\006\351\335"
+	.ascii	"Z\313\225iB[\247\"}\325\351\373c\314\355R[f7J\017r\251=\244t"
+	.ascii	"\202\004{\213\224nP0\210_\277\t\201=\273\330\035\355\202'js\323"
+	.ascii	"\363\364B\367\2632#\206\304'c\253\366\370Xn{\236^\310Q\336\276"
+	.ascii	"\361\231\3352\227\2127\364\370P[\337\344\342\033\277\005Y\351"
+	.ascii	"\277%\362\354\217\237\342G\351\t\\\003\302\022\207U\226\226\224"
+	.ascii	"\362*G\216+\252\001\\c*\013G\225\f\266J\013\307\024\013\036U"
+	.ascii	"J\243\362\312*\213J\251\025\"i\004\216*\245r\252\006U\262G\225"
+	.ascii	"\f\245\025\313\343J\371SYS\037z\244\250Z\256PNQ%iX\315P^y\250"
+	.ascii	"\312\232J\201\343\n+KyE\205\304T\020\226Y\312\252\034YK-\033"
+	.ascii	"2\246`PaIQ\315\220RZM\345\220\242\302ZJA0\300W:\252\260\244\262"
+	.string	"\256\256\260\244\220\034\244_\n\303\2651\356\272G\b\030\344\235\200LO\306F\205J\032\376\367\270\203.\360^\005\336\351=\344\271\030\267\262\235\036\273a7m\263No@\217\030\361}\337w\351A\027x\r\337g\232=\224\226q\353\213\233:\375\352G\224N\370\202\247\300\307\304S\024w}\t\001\267\276Y\265*\216\321\353\022\006\314\240A\301\022N@\017\223\017\324\323\277x\032\f\356+\314\364\303\374\363\2062\377\332f\t<\001Aq\304D833\020S\2207\224\333\357\257\315\336\007\177\372\001?\341\231\231\204LB\336P\n\017\305\365MV\360\003N8\331\256]\207W\005\317\336%\226d\375\373\3625uR\023$\016\322\223qK\030W\024\341\273\232\206\246\213.)\341\237\336\253\003[\300\2363\253-Z\004\3741\232\327g\312\326\226\301\311\326\331\221\017\376)\371\232\006\300\342R\217\315\274\275+n\005\017\024\220a'\370"
+	.string	"\337n\244}\234}q\316\325T\254\216\315\274\352\264jf\242\221\002\361\366\246U/\353kd\331\230\323\250\351#"
+	.string	"\002\360M\337dK\nfR\334f\200\367\250q(\306\214s\210FDDD\222&\031\016\200\002\021\241\243\342\006\021`93V3\322$i?\003\303\363\270\243\002\021\263\017\036\342j\314\240x\256\237 \036\311\262\350\355P\022]^rqQ\260\341c\326\213H6\330:\034\224'`\237\350\370':=B\224\350\b\327\352\t<6a.\210gL\204~\307s\375\322]R\366Y\322M\304\1770\374;\244.i\235\247\330y\3034\335\254\305\232\347|G\016\2156\314o\263\277\"P\336\\\310\235e"
+	.string	"\035p\267\271,\225UjX\222CF\266\372\276\003,\306\343\300H9,\3016\265\233\352\265w\325\247c\0041/\303RVd\327\317R\230cNH\311\260\201{\t\005\327\241\016\213\347\320Sn\247\017\bV\355\370\004\005\276V\323o\022\026\005w"
+	.ascii	"\020\204$\235\210O.\314\347\004\207\306T\007\032m\177\332E\034"
+	.ascii	"\207\252\324R\347\231\022N%M\030\230\355.\005\377=\003B)\263"
+	.ascii	"d\232v@\222\244\205\034\214\027m\307S97\302q}\320A\t)"
+	.string	"p\363hwpIs\306\243\374\226"
+	.string	"H\234Y\212+\030\3755\261q\360\021\240\354\0066\327\303D\360\210"
+	.ascii	"\302\205|\037\023\265)\263\207r-\242\266\370\203\376\372\024"
+	.ascii	"\002\2406e\"t*\025P\307t\020\243\371\346\324{\215\034t\354\300"
+	.ascii	"J\362\214\265\024\365\357S@\002g\322\306\025\252\005q\037;\346"
+	.ascii	">\241p\273Q\263\333T\270'K\325\2616C\365\013\370\340\004\360"
+	.ascii	"\341\210\\\0134}\274!B\2138\310.1\326D\016;\353\361\232\362\302"
+	.ascii	"Hw \264F\026\313\204?#\232r4r\275U\332\276\302!\001\025o\027"
+	.ascii	"\224U\026\032P\376@\226\2006\300Pe\236\207.\355\306\340v\322"
+	.ascii	"q\\c\334\021\003\364:\223Ah,\021\235\3042~\351\273\304;\"\232"
+	.ascii	"\304\003\262\034\251\310\2761\320mU>C\345\360\3535\301\346\367"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_processContinuosAdjustments.85.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`/\016\rH"
+	.string	"\272|\220\033=0\242N\007;C\023\317\031\bB\257\224;\023\307\347\351\224\005\332#.\264\365\034-\230\374q\033\035\303f\020\245\r\020P\005"
+	.string	"(\320\203\277\013\253\234X!\210D\304E\303\310\336\335\222L)\246\001\215\001\256\001M\"\031\301\203\354\237\027\007t\277\272\267qw\343\276\347\216\347m\267\013\322\351\025\361ac`/\001\221\210\251\332)\242t\266=\216\377\001q9\235!.\354[^\221\304U\355x"
+	.ascii	"i!\336\327\236(\216S\007\303\360\262\333\363\332\365\374\215"
+	.ascii	"\363I\250\360\372^\323\341'\334\264\253N\241\241tS$\372\245J"
+	.ascii	"\005\021\206\357L(\3330V\253\037\224~\327\316\246\227\316v\253"
+	.ascii	"\3615\257\343u\240\303j\260\037i\254JA\204a\330\201\263\335A"
+	.ascii	"\351lU\362\227\335\355\271\333\355\034\315\353V#\336\004\303"
+	.string	"q\220~0|\367\240\261\224\316\366\235G\265\316*\375\251u\266\337\356C*4\270\214B\265\r\232\327\b\303p\326c\351\002\236\274\363\236\312\257SMIEA=951-)%1\227HGJ\267e\223\237\337\3664\236\204\273^\243\3222\247J\272hM\2728aZ]\362\302#\342\237\263\361\234D\352\314SW\324\274\270T\224\333\341M\215\213C\315\371\323\234\223\026\301-\271\211\013]\232\\f\"L\343\302\227%/e.\256t\340Mm\352I\204iS\246\023\246\305\177S\362\262\n\206a\267\214\344fn~\024\305\317\017\320\245I\311\312\244\3254\217\023'L\243\222\214\352\003g\310\351\322\332\262;V\235K|S\353\342mr\002Zc\254$\205&\231\217\320?\254\222\024m)}\346d\322\nQN\242\245\364,\031\325\244K\324\371<3\221>\363;\033oQ\225\222\370\246\346\305\263\333\001\206\341\316Q\251\2327"
+	.string	"\357v\277\356\256\322\315\f\023\371\261\031d\367\217\302\274c\262G\221\276\n\355\313Z\371G\357\210\3362\316\330\\\202YTT\376\203AVG\004[\312\002\303g\036\355~\253~\350=\343O}"
+	.ascii	"\305\261\207\206\356\273x{"
+	.string	"\327(\024\263\027\215\027*\322\322\305\327\306\356\016sBo\232\326\032_\353`\370L\220\017\362\220\004\021\242\035\321:{\365\336\026_\035\255X\316~\373\005\002\237S\347\263\357%\274\260\351S\211\177\032\001\375I~\013\031_\253Io\266\377\016>7zN\235&\274OsI\372\207qj\007\303gZ\016\247\233\210\017\236\370\251D@yH\354\3668\037\024*Xd\217\272xW\214\3438Z\375\363\273z\240\220\r\303\363\304h\265\254\216GF[\027\303\271`\307\357\314h\237s\266kle\217r\265\316\372;\237\213H\024\307\251Z\315r\344\353\t\242I\377\251\335w\316\354\027\262<\036\366\307u\267\2719\264\2717h\300\320\346\326\2520\301\255\356\021\034\320\033\202\233;\313\335x_\371\236\267\2036\267\225\233\273\201\233\233\201\233;\201_\275\021x\033\357\003\216\347]\345\3466\220\224\273\200\233\233\200\233{\200\233[\200\233;"
+	.string	"37"
+	.ascii	"77\225\233{\212\231[\252\315\035\345\346\206rs?\271\271\235\334"
+	.ascii	"\334Mmn\2466\367\3222\267\022R\356$\244\334L7\367\362(7\222\233"
+	.ascii	"\373\250\315\255T\346v\335\334\255\233\233ms'\333\334\357\346"
+	.ascii	"\316mn\367\240d\235\223\372\233+\f\007k~\226\\\211Cn\377{\241"
+	.ascii	"/\222\354\321\016k\033t~\231\025\241F\266\244\2476\004o\266V"
+	.ascii	"\217#I\2466\235.\016\356\315\212\245\213\363\252\013\236\300"
+	.ascii	"\221a>\265\025\350\261\035\"\265\356\347\356D\217-\316Q\205G"
+	.ascii	"\360I\362\232k\275\r\377\353wI\246\322L\021\347\325\345\351{"
+	.ascii	"f\311J\341\227<%\273\345\030\254uV\353\375\317\223~q^\325\032"
+	.ascii	"\365\030>#\202B^\310Y\177\365\335\257\364]\313\036\215z\272["
+	.ascii	"|2\350\221P\237\365\235\241m\f\376\351\241\334\f\237f\232\236"
+	.ascii	"\301w\216*\016a\324\340\237\262\024D\317\251{\226\340\033|\233"
+	.ascii	"\210)\214\323'\370\316OF\247\323?\371\351\273B!\021\374\321\027"
+	.ascii	"\357\300\266\351\005\340\365\351=\3158\227Omo\266L\377\220O\262"
+	.ascii	"ZS\231\323\262\364e\213\362\272\271\265\3162\275\003\3129\035"
+	.ascii	"J\033!=\265\335\261\320\266$\036}\034\223-\003\244h\351+|\206"
+	.ascii	"3%/in\020\364R\311J^+N'\336S\227$\272\364\356\347\254b\274\307"
+	.ascii	"\202\235\230CJ\367\227\332*}\030\\\206\276T\"\261\236\374\314"
+	.ascii	"hJO$\326\343he~v\276r?b\301\306l\226\313\236\340\366\"\243\212"
+	.ascii	"\016\267\346f\216;\200\211\026\273)\374o\237\343\360\354\356"
+	.ascii	"\332\244g~\022\030@[\260x\344+\347u\342\300F\310FI\257%\247\303"
+	.ascii	"\027\275r\312vG\177|\267\364\313\345\365\222_/\255\263\314?\372"
+	.ascii	"s\360\313G\362\263\307\007\n\351}zeQ\266H{\365IV\274Ag\3711g"
+	.ascii	"0X\2304J>\265}\264H\037\206G\350,\255#\b+\346%\006\226B\007\327"
+	.ascii	"\230\227\020\261\245!]7\276J\364\350\372\372\332\322\301\305"
+	.ascii	"\374\002\363\032\343\372\002\"\302\251\013H\217\255\027B\272"
+	.ascii	"\276\224^\236\303\013\307\027\030\210\256\261\255\025=\300\302"
+	.ascii	"\306\276\300\270\232\232\013Kl\354\253\313\307\230\030\220\035"
+	.ascii	"7\266jp\205eq\341\310\372\362\332\362\221\305\025&"
+	.string	"\226\205e\240\301~t\205e\215\201\201\205e-\357\314\374\343\322\270\037Y\\\0344{'\"\325S;iOJ\303?\241\354\300\253>I\325\033x\020{r\233\254\327\201\201\032\260\001[g\r\374\324\2406\263\034\351I\030\206\341\251+\257z\r\357l\\\206\363\215`^\223zj/a\271\007\272O\241nV\250\t\357|\356L\364\330\246LX\316\006\215\322E\t\303\0370\221\257\376@!2C\347\363&7\213v\006\321\276,\212D.\220H\266Xu\366e\335YM^\323\325>\327d\210\310\024\221)j\235-\220\374\213\0179\266A\t&\345Y\353{zj_q\016\202\326\246\323\241\261;\303\341\257\006Y\227\213z\326\234\236\332\033\004\253u\357\231\245>\205\214e\310lx\027\004\221!\374\325G\370n\262Ed\215\262G'\374\017.\226\031|~Y\023\370\001\017\341\263\341s*\365\004\036K\017\024\362\031\005\374\2007"
+	.string	"\347i&\300S\275\200\017`\370\244\003\360\001\336\311\"3\335\353t"
+	.ascii	"}\n\377\200\371\002\340=\220\334X\334\324S}k\370\234:\247\336"
+	.ascii	"\003\235\005\036\234+\024\262\2110\216\233\236\332\337\305+\024"
+	.ascii	"z\243\310\364\324\366\327\331J\275\277\225\345-\257\363\250\254"
+	.ascii	"\320.k\311rRlZ\034\310\261\013\t\006\201\f\250Q0\306\020c\306"
+	.ascii	"\220\210\210H\222$\031\016A\005\3040F\241k\007\021@\271C\214"
+	.ascii	"DDH\322\264w\366B.\035\336YJyYc\364[:\203(!\354i\2352\003\340"
+	.ascii	"\342P&&[\370#uG\343r\251\371J\373\321\344\376\365`\2110\0135"
+	.ascii	"L\325\357\224\273\264x\315\031B\032\327F\255s\215\216\374H*a"
+	.ascii	"\243\341\221\2538\211\246\320\320Nb\311!\234(\253\250\211\\\356"
+	.ascii	"=C\032)\344\033sLFA\035\260\222\266gG\214\204zI\375n\031\256"
+	.ascii	"\033\347W\001\3442\253\242\252TW08kQ\177`\2063\362[\351JN\005"
+	.ascii	"\255t9\2739\223-\257\371N(\303d\322\216Q+\230$Q\205q\320\234"
+	.ascii	"\217\217%\236\211\2075\333\312\330y\240\243O\354\301\001M\304"
+	.ascii	"Q\337y\004uI\246"
+	.ascii	"(\216\230\201j\376\362M\r\224\254sh\221V\304\bQ\276\225X`g,\005"
+	.ascii	"X\2768]\261\"\306\362\222\370]\204\265\375zG\251\272nF\004\016"
+	.ascii	"\367`\bQ\3216\n\214\007\275\232\221\324t\033\334p\255I^\006g"
+	.ascii	"\313h-|\350\016-]\004\372j\350\266l\263-\216.E\352*\226\300\356"
+	.ascii	"\r\tJ\260N\356\211\260]I\251\t\372\245M\017\007 \312\236-\242"
+	.ascii	"y1\351\361\205\272\024\017e\327\313\"\231\306>\221z\351\227\362"
+	.ascii	"\177b\027#M]\035!\271/\326(\357t\223\335\236\272tMv\274\224\257"
+	.ascii	"\264\351PTF\247\034\013u\360\033\315\327\363l\032\323\377\006"
+	.ascii	".@\256\307\314\236\370\330\036\324\244A\327\006\303p\211\345"
+	.ascii	"V\250\3776\221#\305o\235\321\367\024n'\020\272\210\303_\347\271"
+	.ascii	"c\216\241\025<\334\276<\345\322q'\331F\303\273X\233\216\364\302"
+	.ascii	"l\367^~\254\320\232\333?C\020%\b&J6\351\205\232\261@:\023\225"
+	.ascii	"\3529\367\005\331\2502\3350\243\027\236\310P\3247\f\007\031<"
+	.ascii	"B,\303\304\203\246\2152\2451\271\324\327\254pxQ\\\362\330\274"
+	.ascii	"P\221Z\364x\203\\=\337\204 T"
+	.text
+	.section	.gnu.lto_processRcAdjustments.86.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\212\001m\020"
+	.string	"F_qI\340\2608\035\342g\210>_\354\2542\201 X0\315\245\210\321=3\307\332\3406\031\375\201=*x\036\211z\340\3476\257\303\250\356\345('\306)\f\t3\003N"
+	.string	"\3010\260\377|F\304\371P\263\357D\302zl\"D\356\224\002\\"
+	.string	"W"
+	.string	"["
+	.ascii	"\235\317\223x\357<\027\340\275\363\311\326\361\323\245\022\200"
+	.ascii	"\351\260dpj\255\340\256\370\351^\307-=\371\227\375c\272\312{"
+	.ascii	"$\336q\bnd\334D\\ 8\222V\013sE\271\021_\216\301\n\307\204\210"
+	.ascii	"K\305\201\344\260l\\v\032\302\225\242\3643\251\265\232\232.\226"
+	.ascii	"\373\273\355\f\266!\330"
+	.string	"\207\021[\332gI\267\305>Wk\255\336\227\375\330\377\371y\177KM\227\372!\005fR53\030\217\265\235\265\265\303\243\326\272\031.~\376\366/\363\207\02748\375\\))\317\332\372jfl^pj=\023\274\263\211\347\324\376\313aN\217}\370H\255/\033Z\255\247\002\203<\017\335\212\367\355\2269^\304\340\b\241t?k\247\210JV[\356U\324\260\261z\240\350\016\007\200\332\243\221\336\364c\334D\330F\213\245\330m1\350_\01317T4\307\376\3542\246\341\2630\007\323\320\233\357|\323x\357\276g91\203\225@\321\035{\324V\351@o~\2737;tj\251!\031>\360p\0222E \205\"H\212\b\2054:\b\221\341\211\206\261D\222Fq\304\"\310D\222B#\322\244\202\341BXA,\201\"\nH\022\205#P,\231@\220\001\217\033B%\220\034\307\022\370q\326su_\366\334`j\250My"
+	.string	"\365%x\240\333\023(\034\270\301j\253-\275"
+	.string	"4\024Q\324T[\336%\347\206\026\033"
+	.ascii	"3\241\237)\206\013\203y\030,\305{\217j\274u\34138\rRE\034\360"
+	.ascii	"XCb0\364\324\310\312,\356a\257\242Me\241\207l\2145\355\232\315"
+	.ascii	"\205\313\343l\344\251\246\201\013\251\302\225@\001`\270)\205"
+	.ascii	"\332\003"
+	.text
+	.section	.gnu.lto_getAdjustmentsRangeName.87.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"e\013"
+	.string	"6\226P> 1T:O\206e3$\376\204\215zb\232\217\205u"
+	.string	"\251|\003M\032\0058i+\025\256\347G9\227\364\r\001\331u]3\023A\002\034T\300\331\007`\t\035\302\031\360\247\r\262\211\224)\005>"
+	.string	">"
+	.string	">"
+	.string	"s\216\234\307\023\330.!\027\260]n\211\203\327VA\337s\315\201\tF(s!\226\276\232\004\304\210\222D\004i\tf3fg]Eb\250\n\2002\347\264\206\304\017\267\274\355\006\266\021\330W\020g]\226L0\035!>\372a\217\036]\224}m\356\311\266ZZ\275\252VU\177\273\200\2034\022\037\2131'\351\203\307\244!]'lw\354\210\277:\212\216\301\365\260\341Cb\301*\325\201E\216\2209A\f|\025o}\332U\227\336p6\316v)w@\3125\371W\267\200\215\230\214\203\210pG7z\324\330E\035\370\027BK\006Hw\330O\361\3210_e\f~\351C\227\276_\333\3457\356&\237\006c\271h\276\r\205\b\225\007\235\307u\0228\314\204\312\205\353\274\217\233\030p\246\202\305\3434\231\214\307E\306\371=Y\303\312D\213\027\352\203\333Y\017\260rwE\266wM\371l\250-\312\031\276\302B\016"
+	.ascii	"^\005\254\247\343Ul\tO\264\021\005\312X\330\217D\362\033\230"
+	.ascii	"\006]\310\0052+}\260|\\+T\251S\324\252="
+	.text
+	.section	.gnu.lto_getAdjustmentsRangeValue.88.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375 \376\375\006"
+	.string	"\202M15Pm\222\016$\223\203(\261\316\270XT\337H\361\264\221X\323\224\321\330z\267\377ojX[1\315\006\344o\006f\226@L-\332\270\266;\fm\360\321Z#D\246[\226L\323`2Z\026\361\300pY\260\260h5D\215\303%\023-,\213\026\203/\b\f\026\265\353\302\"\245\313\302\317\203\025\016\354|?\332=\272\240%\026\275zJ\335EU\251\007\003,8\257\364\335\346A\214\357\224\360\363}?(P\002\342J\022\311\244(\235\344\b\025\262\361oO\271\241vl?\232:\r\216 \3041\001b\222\231\261\322\202\252\324\324\201\252\024\314\350\326\267\335zT\241C\"\361p\233>\200\204\314\374y\270\212\016\373\037\374\b\377E\b"
+	.ascii	"2\003\346:\203k\b\305518\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_activeAdjustmentRangeReset.89.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375 \356\225\006"
+	.string	"\202\314.50o\223\016$\354\262\304\324\032\005t\317\030\f\361\375\b&\316\226\017n}\257\351\377\373\351z\353\275\273\253\240N\037\021\221\350@)f\241Qk\"wc,\"D\246W\024\226m2\232\f\203pX\300(TW\254\030\342\246\001\243\211\325\205E\312`\353!s\305\314\262\2568uY\370Y`\305B\324\201\023S\275\036\375\230\344n,q\350u\253t\017\001T\212\2700\351P\351\274\321w\234\0071\276\227\314\314\341\347!A\312\t\327\022\221\314\212QK\212\244\021\216\277\323\332\243\264\323\310\002P\b\005\bKfF\230Q\255O\273\005u`\3438}\001\t\231\371\3338O\207\375\017~\204\337\023\007"
+	.ascii	"2\001\007xF\340\002\264\313\370\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.112.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\023\002-\022"
+	.string	"\006!vI\340\2626\035\2426X\016\2613%E\024L\214T\004B\235\006\230\030&p>\016h"
+	.string	"\2518o\245\325X\262\321|\267\312s\023\275\250&~_\203P\223\3211\024\3170H\353\241%a r"
+	.string	"\017\366n\345\tzkm\357\224\002Z"
+	.string	"d"
+	.string	"b"
+	.string	"7Y\346\306`\246\324~\214\313h}F\007m\300\276\310\210"
+	.string	"\3325\025|\263\211\373vr\223\3217\355\005F\337\354\277\260\315\202\271e\003\271I\263$\031\033\020\262\331\356v\337\252\213\267^\251\326\362/\373\310+\346z%\211\2258-\271Fz\260\273\346L\334\333m/\260=\332\364\024&\r\211\006(v`\314\366\305D\361\317\201V\036k\b\030\227\230\003<j>\344\230\355\232\3357\233\034\265\357\357<\307?]\362a\275\247\364\311\213\271.\230\317\363\032\255\367\224\234\013VAf\207h\027\206\362\315\023\204"
+	.string	"\310V\317q\215\351(Q_\306\262K%Wz\234\233\026\327\233\026\036\240\335\205\300}3\245\001\367F\366\007\322\277\254bc\016!\202\251.\373\250\221}\341'*hh&\244V{\345g\013\211\306\220M\nZ\355\324O\321\204fw\031\374\025\344\225\326\237O\260\243\007\216\017\235\".\264\210\326\031WM\333\332\302>\316_I\324\364\346\177\022\004?\002T\354\216(\"\262,\266\0335\367y\020\313\243\266'\002\306`\342 \246\254|\036K\212Gz\021\310\020\334"
+	.string	"\216\200%\213Ga\005\206\\(\242\310/,%\224\3703\215d\b\246\310\261\314\240\342\235>U\367Y\350B\224\227\352>\325\330\231\fX\324"
+	.string	"\252:R\024U]\3116\275\317\351\254\020r\251\036\\k\235\261]j\2731\016\356\363\023\335\320\"\023\240\267\361\363t\034?^\001\0020 \260\002\231\244\325\001\244\202\237\314G\210{\177D\331\342\016*\240av\034V\024\236$[\256\214\216\304Z\204\225(\016s\277F`1\0026\261\325\241\334\302\025\001\317S\220\335\232\367\301"
+	.ascii	"f\303\305\004\355F|\f\004w\316v\035\353\333\277\364\016\223\260"
+	.ascii	"\002\276\260Ng\355\354\233,\231e\201\341\274lY\240\274\270;\245"
+	.ascii	"\246\237\320\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\221\005\345\027"
+	.string	"\306d\212I\220\332M:"
+	.string	"'\tS"
+	.string	"\360\241\005J\f;\362\301^\005-0b\255\206\243\245a\032\201\004\n\021\256Ss\254D\377\207\270\257\3525\301\3745\213\254\252(\212Ep"
+	.string	"\fK|\252\210\236\374\"\001$-\2446\231H\214$2\005s"
+	.string	"u"
+	.string	"|"
+	.string	"\327\n\321;\305\203=\230\260\303\3038\330\177\t;\030\f\006\205\354\257\302\r\366]B\r\377\0223\334+\210\351l\f\203}Vx\341f\304\240\203\001\331[\345X\260/\013\373V8\033\n\3472\341U"
+	.ascii	"\356\275W\202=V\030\341T?\317\"\366\205p-\342\213|n\345\301\247"
+	.ascii	"\304\376\271w\035\034\213xQ\364J\371\355ou\204\007\374\302\210"
+	.ascii	"\364\330{\t\377\323\214\004\343\312c\223%_\315\326C:\266f\037"
+	.ascii	"\202Z\357r\306f\0377\031\024\322\233\334{\247{\317\260\347\222"
+	.ascii	"a\237&\206\275\030\f{5/\354\327\270\260'\323\302\276\f\013\373"
+	.ascii	"u\205=P\205\375\231\024\366hP\330\2179a/\206\357\275\277\316"
+	.ascii	"\204}\027\227\370\025\361\017\302\363\321#\007\321\r\036\r\""
+	.ascii	"\036>\347\236\021\211K\211/\032\361\237\b\373\255\020\366a@|"
+	.ascii	"\213\370\301\006_j\024\024\372\244:9I\233PVZ\255*\004\375\261"
+	.ascii	"\362v\240D\252\215T\227\342\n\240\247\357\326\267\025G\r\240"
+	.ascii	"\336\232\226\336:\247\216d\347z;\262q\277\035\262q)\037\260B"
+	.ascii	"\267ld\323\200\334SZFH\024\220\275\313!;\\Z\203gm\3241\025l]"
+	.ascii	"\241\326\247\365\211\312M*+\245C\200\240<TG\212#\325\345\200"
+	.ascii	"|2q*\222\300\326\006\324R\305Y\331\226\304\314\253f\353\247\245"
+	.ascii	"\343\3314\224\231\351\254\354\312<\233U\362lF\371`WU\226\374"
+	.ascii	"\3549\273\006\312\254tD\2255\232\255\373\355\314\326\365X@\327"
+	.ascii	"Q\325\216\331\270\225\t\254II7\263O \363\210\271A\3321\273L\031"
+	.ascii	"\210\n\024\262\322\354\261gv\t\344\037)%\\:e\337\026\224M\366"
+	.ascii	"\030\224\270\262(\\\265\322\304\002\273\265\262\371\307BTQf\r"
+	.ascii	"\312\036b\276\367^\236\2629q\250Q\034\316\2017I\024$IA1c\340"
+	.ascii	"\002!\262\325\001\021\300\034D\034\232HB\231 I\017\\\373\352"
+	.ascii	"^\263\324\357y\255\3264\315`\326\346\373\206\310\002\320>\037"
+	.ascii	"q\306O\335\373\260\023*\277\212\353hj\225\311\005}\363G]u\210"
+	.ascii	" Fh\277\373\252u\373f\200\253k\316G\033lN\0178\345,\3663S\340"
+	.ascii	"/~(\013\306\227\377M\206\245\177\001\341\361\177\226\215\256"
+	.ascii	"`\317\334\273\322\260+\352\324H\035\336\360\201\336K\344=\305"
+	.ascii	"/s\364~~Oy\250s[\220\021\354N\036\370\001\261\377\020\276?\200"
+	.ascii	"\324\227/\360\346\n,\214\326\227\311\233\207}\237\272\204\363"
+	.ascii	"\002$\007e\340\356Z\222\277\265\3320\317\330\231\004(\321\314"
+	.ascii	"aX\271xu5t\017\365\017"
+	.text
+	.section	.gnu.lto_.refs.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\210\001\305\f"
+	.string	"F\332O>\020s\222t\277\245\023T\371\326\211\026b\334\315\305\220\271\331+nY\026!Z\356\365?"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\346qX\356\256\207~\0164\373\366w#B\315\266\255n\255\265F\310\3362\0056"
+	.string	"E"
+	.string	"I"
+	.ascii	")\371(\371\234\374\3143'WQ\0070\3754uI\352QT\250\335y:\347\351"
+	.ascii	"\233\353\327\275\325:I\353#\255W\355T?\303~\302\207\360\031\336"
+	.ascii	"x\375\3325\177\031\002\027\020y\002\325\007`\317\301/i\375jO"
+	.ascii	"\265.\341GxC\354\257\255\271>\016\371ga\210\017\03609^j\314x"
+	.ascii	"\301\302B\305\t\023#B\254|\310\357\006\352\213!\310\217\230\035"
+	.ascii	"8\250\337\206K\3760\362+\344\007\337g\313\322P$x]\260\264X\221"
+	.ascii	"\002E\t\022\"@\254x\350\240\341\202\020 =b`t\334x\241\341\"#"
+	.ascii	"FK>\205\374\007\371\n\362\r\344\233\344W\371P>r\262J_B\353\020"
+	.ascii	"\250Oi\337\240\365\005\255#`\217\302\016\0178<\001w\333N\257"
+	.ascii	"4\2473\223o\364\346\276^\322o\271W\241~\002~\004|\007\370\f\360"
+	.ascii	"\023\340\037\300\357\\\277a\177\261\267\236.\362|UIxG\354\033"
+	.ascii	">b8 \240\223\244\230\003+\f\243\303\255\255\313V\370\036\226"
+	.ascii	"e+{\227\201\025\266\267l\345\236,S\257\354Y\266\262g\231Y\t{"
+	.ascii	"\227\255\354Y6V\256\001k\302\202\377\255+\366\226\255\330[\006"
+	.ascii	"W\364\336e+{\226\255\354Y\266\262\327\372\262\025{cY\377B\033"
+	.ascii	"\353\217\002"
+	.text
+	.section	.gnu.lto_.decls.476829754ff76bac,"e",@progbits
+	.string	"(\265/\375`\237Z\345x\001\272w>\211V \fa:\215\001\3003q1\204\345Z\371l8\334\320\316bU\375C\277`=14\313\033\257/\215N\371h]\323]_lk  qc\330\326\334\333"
+	.ascii	"\307\317\364\302\342\347+~L\227+\360\333\001\223\201\023\026"
+	.ascii	"\206\3718\240#\205B\375\207\322Zn\271\245\2242\005\210\007\223"
+	.ascii	"\b\310\b\026\227A\362iRdJ\233\305/\257\350{\360']\211#f\241b"
+	.ascii	"\215Bw\357\2505D\253\304\211\035\261\213\365b\301\3301\226\213"
+	.ascii	"\rc\331\254\030\333f\337\354\027\273f\311T\243u\263Xn\313\254"
+	.ascii	"\231\2246G\373\304\315\026+\225\372\326\325\20017\307\275\213"
+	.ascii	"\326\315N\261\306\372\226\205\305\330X%\326\315\212\331\261\372"
+	.ascii	"\326\205\307\352\034\253\310\021\343@\231#\206-@\314\316q\357"
+	.ascii	"\242U\342f\263\330-\365-\013'\271s\264R\315\204\356\336:\324"
+	.ascii	"X%n\226\254\232\225F\266\235\254\272\017Ao\264\314\f\331\200"
+	.ascii	"\355\226\337.\261@\254\032P\220\0311\306Xl\265\330\264[5\213"
+	.ascii	"\266\255\232\001\266\366\216\262jCw\366\216\032\252\225C\255"
+	.ascii	"\034\260\030\227\021,\031\277\334\241k\223\244\333\263!849E,"
+	.ascii	"~\031C\333\253z\224;\334\351g:\372yN?\303\351\3476\375\314\305"
+	.ascii	"\370\333(5K5\003\201\320\210\r*\026?\237\351[\215\362\263Q?\203"
+	.ascii	"\351\037\353Q~\346\241\237Y\350\3376aR\237T*u\013\303P\034\""
+	.ascii	"u\206X\\\235$\33561\312WY\305\241\253\245K\212;\026\237\274\323"
+	.ascii	"\271\032\345\223ttO5\312D\026\354E\331\244\013\227\225$\366\353"
+	.ascii	"D\016\273;\213\377\333#\226h\221X#\325h\277l\221*]G\253oV6\n"
+	.ascii	"(\004H\3232'V\007\304\256`_\324\267\254\r\365&\203\264\343\234"
+	.ascii	"X\335\230\375\252sg^\020\277\254\227%\"4U\334X\030(\316\211\205"
+	.ascii	"\355\275\221>|\370\360\341\316%y\323\302\007\237\364\3226\210"
+	.ascii	"\025R\215_\263C\274\274@yY|\222\2076\261\367\336\365k\271\374"
+	.ascii	"Z>\231\245O\262\320'\267\276\225\037\025\f\025i\270\360\341\303"
+	.ascii	"C\220\035\032\2510\256\372v\261<93c\361o{\360p@\024\256!\026"
+	.ascii	"o\375\310u\261\360qF\207\315Q\215v\207\255a$\263;l\226\325\022"
+	.ascii	"C\334\021\006H.\005W\213\214\255\r{\243\0323X\034{\250\302\351"
+	.ascii	"\222\302\262\370X\214&\301\3365C\256ww5C>V\323\307K\364oi\314"
+	.ascii	"\360\201s\374Ra\261\f\244+\343lK\235\305\307[\372\277\205a\257"
+	.ascii	",V5\332\030\226\305qqo+{\357[\024-\354\013!\250\342\266\312\\"
+	.ascii	"l0`\324\355]\2641\254\n\273\342B\271\322U\244\234\035m\f\233"
+	.ascii	"\002\355\370\341'K\\\212.\032\333\027\326\272\260V\267/l\325"
+	.ascii	";\370\340@S\366\005\336;\252V\016B\265r \327\210DI\311\370\370"
+	.ascii	"\206>\226\241\177\361x\260T=S\305\241\0364t9\254X\374\033G\377"
+	.ascii	"\312\351\3375\355\241\036\345\337NY) 6k^;,\266Q$\026\032QpX\374"
+	.ascii	"\033E\277V\211\253m\204\246\210\366\024W\0271O\225S\361\334\""
+	.ascii	"\261,\223\342U\363\324\271\372\346B\271\322gRv\034\355\266P\365"
+	.ascii	"\256\032k\236\n\347\225\256\3069\376\360\341\003\322\325q\007"
+	.ascii	"E\224\306w2h5\251\026r\026\377\036\321sn\330U;\325X\353T:\357"
+	.ascii	"\340\203\261:\265\016\307q\357\342\207\f\037*\035X\035\234\214"
+	.ascii	"\177y\350\337\027\372w\205\376\235\322\177\253G\031\250\032\345"
+	.ascii	"\3337n\352\021\017!3\306.\214\233+\225M1O\212\034\026\337\206"
+	.ascii	"\351\252\246\312Uc]\363\3274\265\312q\224\255m\334\273\030t\243"
+	.ascii	"h\210A\263\370\325C\036\272\273\273\273\253\036\362\355\227\306"
+	.ascii	"\025\315_\233\324\261z\346RUmm+{\027\213\310+\342\n/\213\315"
+	.ascii	"\024\247\366\336H#\350\312@\261\370\226\207\376\007h\325\313"
+	.ascii	"-\022u\013)&\307\275\367=`+\253p\205\035\307\302T*BQD{J\312\312"
+	.ascii	"_\311\3241ULu\253p\265L5\326\267\372\345\025Lm\273-\356=\265"
+	.ascii	"\367~}\362'\275\276\325b\245r\213Z\264\n)O\216Y\316\306j\225"
+	.ascii	"\267j\245\232\325\267\254}\341\234\300\200\021\266w\361\303\207"
+	.ascii	"\017H\037>|\260)\350T\031\205\360\353\033}-\365(\373T\243\374"
+	.ascii	":F\277\242uA\002\242\021\345\r\r\213_\213\372\177\345R\267Tc"
+	.ascii	"]\253i\265\270wq\357\375"
+	.string	"\017\324\252\231\020\024\321\226\202\373B\334\273x\017\376\244\277\203\017\352Z\325R\315n\221\270\245\340\322\016\020\225\206\205\234\272\275\213H\037>\220R\302b\334e\374\nC\277J\351\237\320\037\352\223\320H\365(\327+\025K5VP\313\336\301\007\277PQ\366\330\336\305\241\240<L\362\330\261\370\036\320\257\025\344zW+\310\027A_P\217r\205R\243T\243\006u\312\253\223Jv2\252\270\213{\027\207\254\020<W\244X|\005\350W)\327\020e\177p#\375\252A\276wwU\203|\2539\250G\231\250\036e[\215\362\213\365(\353j\224\377+5\004\377\257\034\200\370k\210\377ew\277\355\372\357-\374\344\227\337\216\335\376Y\304Gd\006\374W\303\177)\240\363\021v\307\177\375\347\244\037\211\346\374\026\317\225\363[&7\313\nq\356\321\006\277%\273%\335\377\267o\371\257\366_ 8\277\315\372-\330\233\377u\265\202\207y\231"
+	.string	"\220F\334cY\355\235\204?c \346\262\371/\326\032\0316\316\225\273j~\273\024\307\301\303\374\265\210"
+	.string	"\027G\232\377d\376\227\371/\232\377y\254\361g\254\006H\377\345\276\341\236\371o\3315\363\177D\355\035\003?\211\347\302]\021\224\251A\227\314o\213|\304\207~\322\311_+\250\033,\333\rST\211\376\252\377:\364\277\314n\271m\177=\272`\354\331\375\342v1\327\211\355\267S\256\3275\361_/]\344\276\341\256\375\326\370\016~\362IG\325\302u\267\316n\020"
+	.ascii	"\376L\301\313j\357\032\374\271\350\267\031\3745\355\377\224\277"
+	.ascii	"j\371\253\332_\321\376\272\366W<\177\355b\367\201\3372\311\362"
+	.ascii	"\327\021\177\365\300o\345\376\037\257\331_\207\377-\373-\361"
+	.ascii	"b\371+\357\257\"\356\212+\377\005\360\r\277]\363_+\377G\324\336"
+	.ascii	"?\374\344\232\377R\360\337(\1775\341\277P\376[\374/\331\177\235"
+	.ascii	"\374W\354\277\037\376\313\344\277a\377\005\373o\222\377\"\371"
+	.ascii	"\357\221\377\022\377k\344"
+	.string	"\277E~\233\342\277D\376;\344\377\321\237\021\360\333\263\377u\376\337\375\365\377\363\374\325\376\237\373/\367\277\356\377\235\377>?\271\343\277\027\370\357\t\3775\341\277%\374\267\002\377\265\300\1771\360\337\f\374\226\212\327\177\021\360_\n\374w\002\377\205\376L\344\277]\377\375\361_\256\377\362\370\257\216\377j\375W\306\177a\374\227\305\177S\374w\352\277#\370\357\211\377\376\376\313\201\377j\340\277\002\370/\207\377\002\340\277\033\376\213\364\337\243\377\032\375\267\350\277A\377\325\377\265\377\375o\363\374\326\356\267t~+\347\267l~{\346\267e~\373\366[\267\337~\371-\227\337\242\375\226\312o\311~;\366[\261\337j\375\026\354\267_\277E\362W\n~\033\342\267C\277%\376\225\304o\213\374\365\202\277^\370o\346\257A\277\035\362W\002\374\326\353\267@\376\227\375\037\361\377\370\333\037\277\335\372m\216\337\342\370m\t~\313\301o?\374v"
+	.ascii	"\277\325\340\267\036\376\372\364\327\336_\r\360W\017\376\232"
+	.ascii	"\301_"
+	.ascii	"1\370k\207\277r\370\353\321_\357\3773\377O\370\277\201\377m\377"
+	.ascii	"\211\356\356\356\356~\275\365\033\375\370\0310\201p,\216\373"
+	.ascii	"*k\003 1x\334\3041\236\244\362\223P\310(\344\224z\327\274m\255"
+	.ascii	"\240a\324\3552\213I)I'\215L\240r\024\261\270\202j\224-\274\325"
+	.ascii	"\243l\207T\243\374\r?\364O\222\221}\r\023\355)\256\"\304\rU\372"
+	.ascii	" *9f$\307\276&\201\035\205\305\001\330\027\031[\335\276\332\033"
+	.ascii	"\234\2028\372\344\0222\354$\023#\311\204\024\323{\357-pdl"
+	.string	"a;\353\312\303\1779'\305>\007\2647\220e\222\024\301b\361)`\242\377\327\035u\265\367\206A\026\367\225\024P\376\353+Y\253\207?\250\336\332\341?\336\373\227\356\235b\316\333\336\273\306\321_hQ8.\330\344\333\336S=\240\032\320\003k\252G\r*c\017\254\"*c\217\r5U\004\252\350j\367\200\2422\356]45\005%\302\026\026\2251j\027Q\0317\326FQ\006\253\356b\017\250=\265\265\213\366\324\216\332\306-\254\013\250\246z`Q\031\243\260\212\250\214=\260\266\261\307&\332SQW+\246\366U\3216\366x\263\215[XDT\306-,*c\217\271\032\326\242\t\f\032r\336\210\310U(TS\373\205\013\255\250+\2427\252\342\326\216\333\273ZI\261\257\366\333\336\035\366\326\332\272\212\213\252Q\265H\275\275\2202\213\332\252\305\275w\006\027R\\[{\352\r\252\3567\252$[{'\221b\332.\366\336\333"
+	.ascii	"P\305\267\355U\337\240|h\355\252\024{k\330\305\275]\354\rU\367"
+	.ascii	"\333\336\033j\357]^i\025\367\276ADEt\341b\357,$\027[\013*-\305"
+	.ascii	"\336\326\212\234\026,*#\327VR\032\025#q\253(BU\252\252\255M\334"
+	.ascii	"q=\256\264\021\n\312\256\332{W:M\304\212\001\307b0\242\330\232"
+	.ascii	"6\213O\001\n]\374\321\242\343\212\f\213I$\345\026\2323q\026_"
+	.ascii	"C\035M\022\2610\251\261\306\342kPC\026\361\375\250\302\305\342"
+	.ascii	"kx\323?x\212Y:,&\207\220B|hHIm\213\257!M\377d\020\322\253.\213"
+	.ascii	"\2138\262\213\304\202G\210\033\213\257\201\210.\216\355]\024"
+	.ascii	"\312J\206\250H\003B\376\270c\262\210d\310\036'\177\374$\027\351"
+	.ascii	"\203\334\002\022\3033$\215\305D\305z\224-U5\312\227,\351d\017"
+	.ascii	"\r%\314\226)\036[q\304\034a\266v4\221\001dHql\357=\324\223f\007"
+	.ascii	"l\006\251\203\314\261\267\304\342,.\3321\250 E,\376I-r\306\035"
+	.ascii	"\272+d\026\337\203\027l\250\352TaQ\267\302.K\0137\304\2529\022"
+	.ascii	"\006\031\203\224A^\2217\310,\322\006Y\203\244Ab\2218\252\221"
+	.ascii	"\234AZ\3253Rw\236D\341\201J\"g\220.\332\034\223N\316 \247H\025"
+	.ascii	"BP\305\r\225\321\276\220\200\251\333{#\375D\035\201\302\203\204"
+	.ascii	"\257!\205~\2069\372\031\314\350g\370\242\237\341\212~\206/\375"
+	.ascii	"\f?\3643\274\320?\231\342\244\n5\020d\252\251\036I,&Q$\235L\021"
+	.ascii	"\207\2256\303b2\217>\022\035}$3\372Hg\372'\367\261g\b\030\253"
+	.ascii	"\032\026\277\222=i\023\305*1\216A1VG\026v\207\370"
+	.string	"\244\211]\222\031\0321\311\n'\227\252\276e- \314\315q\214\212\030\242X\235*V\332\226\340\221\222\264\005\013\021\207\301dp\035\206\303s\230\016\333\301b\260\034\\\007\337\301t\360\033\276\303n\270\f\316\203\341`<\330\f\236\203\317\34088\016\273\301l\260\035V\203\323`4\270\r~\203\345\360\030\274\246\032\361\021\203\371\005\303mX\276\\2%y\324pZY\031\333\021w\301_\204\356\336>\236\020\271\\!f\251fgdW\300\034\223\316\262$\241\3414\263Z%\314\0247\"\330\335Q\t\2245\307/\026\304,dkV\310\360\021\26392\261\203\217\030I53\300\221/\2568u{\027\257\r/,7\t\340\213dD\377\230\355\370\313\253\031\b0\224_w/\340X\214\275$\035\263Y\220e-\315\342\262\032\345#y\351#\325\320GB\241\217\241\216>\206/\032k\3014\304\374(b\3611\244\351c\b\323\307"
+	.string	"D\037\003\013\375\t\360\350O"
+	.string	"G\177\0024\372\023\274\351O\340E\177\2023\375\t\310\364'"
+	.string	"\242?\301\013\375#;\372Ge\364\217\272\350\037a\321?\022\323?\362\241\177\224\245\177\224B\377\002\033\375\013Y\364/\200\351_\310\241\177a\353\033\245\3217\312\242o\364D\337\310\210\276\321\226\376\361\021b-n1\301C\344\230\370\343\"\330\210\325\252(\346\\\324\261\330n\325\243\234A5\312xH\3221\021!,&S\260X\\\204\205d(\227\244\355"
+	.ascii	"\022D\003=\265\245l\314\253\213H\224\037R\026\377\270\013_m\245"
+	.ascii	"\231!c\361=H\362\342H6\005\216\215\227\021\034dT\340\326\330"
+	.ascii	";(9:\326\316.\t\214\230\343\336EK\307\332\231\263y\366\032\260"
+	.ascii	"\261\273#Y\024.7dR\346\210cE\264\216w\332\330\273\025a\274\210"
+	.ascii	"\3448\266\250\002C\274c\321f\305v\243\207\221c\023\252#\035\213"
+	.ascii	"\207\215W\220\256k\007\367\270wx\013\337\3000\360\016\314u\345"
+	.ascii	"\\\272+\207\251\260\rL\003\327\270o\360\f\354\342\252\271p\327"
+	.ascii	"\315\235\203Y`\024\027\316M\203U\340(\f\2057~q\307\340\024X\306"
+	.ascii	"\245\203[\33457\316\255s\217\030\353\276]68\013\343\300?\360"
+	.ascii	"\324=s\315\334:\274\302\235\273w\260\025\226\272hp\f\254\343"
+	.ascii	"\342\271q\327\016W\341\034X\013\257\300@\260\217\233\347\266"
+	.ascii	"\271e0\217K\246\032\361\325\r\363+\346\272\335\266\205\2658\336"
+	.ascii	"\330qF\254\355\277-\256\320\210dP\340\352|\020!\336\0264\260"
+	.ascii	"\034\311\214m\216dS\227\n\205\030\034d<\302n\213\032W\274\210"
+	.ascii	"?n\2141a\241\345\204x\343\346\030#\336\027:\232\320\261u\352"
+	.ascii	"\216I\370\352^\271^nQK\004\244\324\034\301\234\344\001[RE\307"
+	.ascii	"\326\325\371`\205 D\262\"W\035\257/+\256\"-f\224\331;|e\263\330"
+	.ascii	"-\267H\204\300\2248 B\354]\324\230\333\"\313\312\261\005\276"
+	.ascii	"\272.\254Q\b\212h\357\037_\356\215.\257\033C\206\031\230\022"
+	.ascii	"\027\304'lc\256\327\020\035\307{\343\307\031{'\345F\274-\260"
+	.ascii	"\316\310\236\3309\336\0266P<!^0\261\025G\213\342\210\r\"\222"
+	.ascii	",b\013\030?\262|qk\013\363\344\277^\370\352\n\371qo\340\253\273"
+	.ascii	"5\205\311q\357\"Rn\262\366\305\243\302\300\232X\217rMQ\215\362"
+	.ascii	"\215b\350\033M\351[\240\323\267`F\337B\232\276^\376[\345Z\271"
+	.ascii	"]zd|Q;\263x\355\346aq\346\304\342[\300\242\377_\265\233v\267"
+	.ascii	"\\-\325x\271\334\263\017\314\272.\227\213\026\344X\346u\271\334"
+	.ascii	",\036\300\371R\013\333\273Hze\301\201\363\301\267`D\337B\227"
+	.ascii	"\276\005 \372\026|\350[\350\241k\232\244_,\330\307\034+$\026"
+	.ascii	"\337\202\016]\217\365([P\215\362-T\351\027\305\321/\212\323/"
+	.ascii	"\372\242_dE\277(L\277\310\207~Q\013}A5\312'\262\243OdF\237\b"
+	.ascii	"M\237\310\211>Q\021}\242\034\372DU\372Ct\232\203j\224?\024\247"
+	.ascii	"?\024F\177\250\212\376\320\227\376\320\016\375\241\025\372Bv"
+	.ascii	"\372Bs\372Ba\364\205\262\350\013\221\351\027\253Q\276P\227\276"
+	.ascii	"\220\r}!*\375 9\372Aj\364\203\264\350\007\205\351\007\001\321"
+	.ascii	"\017\252\322\007\262\243\017\244F\037(M\037\210L\037H\210"
+	.ascii	"\276\226j\224\017DC\037\bJ\377\307\215\376\217\232\376\217\230"
+	.ascii	"\376O\227\006\241\036\345\377\254\320\367\231\243\357CF\337'"
+	.ascii	"\213>[=\312\367\251\242\3573\246\377V\215\362}\212\350\373\340"
+	.ascii	"\320\027\305MQ\215HWE\031\251\027Z\026\337G\206.\301\256H\371"
+	.string	"w\025)\277\347\216~\017\234~\017\030\375\236,\372=K\364\217\325(\277\256\036\345\367\020\365{x\350\367X\351k<\372z\215\276\016\243\353\256Fs\334\020m/V,~\215\223F\b\231\225\333qtc\343\202\034\355\0314C\262X5]D75\316\013\216\225c\351\354\321\276\261q\354\\5Z7\226\315\255\022\333\306\314\215]\263\243\240@\370\"\303UW\367\203\206\353\313\016\"\\w=\312\327B\3645\227\276\326\322\327X\372\345\035\375\322\215~)F?\316\f\\\234$B\254\002\372/\321J\036E\212j(\316H1|\305F\027W\2265oT_\336,.\002YY\t\331*#\217,\335 r\007\013\213:0gV\224Fci\345\026\242\204\370\324U\321\211\325\355,\031\036\376\262\312K+d\n6q\312X\\R\371\232\266s\345\211\031\213\313)_+\333\334\270v\b\200K\377\245\024\273\005\n\325\034,Q\240"
+	.ascii	"A\261\212\221\244\370\022\312_\n\271/:\250\362Z\301\342\n&\351"
+	.ascii	"e1\207Q\331\021{R\222\225\361\241v\246\034{I\366\343!\245\023"
+	.ascii	"\253\366\246D\t\032\213+"
+	.string	"U=\312VI\322\3131\237\263c\023\253&Y\b\220)Xf\2101\001\332o@\312,y\311\344/\303\354\023[\205#\313\215\305B\325(\347 I/\227X#V\332\332\224\200\375\240\270\n\203\"\311K\260\337\031\211Se\261]\222\3642\311\224\f,E\276\220\360\260\216\234\261\370\307l/\221X\021\302C\244\305\230#%\021\3131#&FI<s\006\247\2534B\252\220#\307\245\242\b\021\032(\240\330\030\362\222\310\203\264\220\370\370aq)$\351\345\020\322F\033\017!\026\377\224AH*R_r(\261x\205\025\312\256\032e[]h\333RgN\035\266\003s\301\326u\344\213\253\312\342\013\300\352\307\217\222\007\322\026\324\233\f\226p!\001S\367\363\004\r\315\226\305\017@\233\222\253\344*Y\034)\332\321hQ\266h\341\262\265U\362\340\240n\025T\274\354\034\367\316\362 4\344\312Y\236\222\307\217\032\2540'\026?"
+	.string	"b:t\224,\220\266\240\346\030\325U\255\311\252\013b\321F\214\013\213\037\200\027%\215\222F\251U\177\254h\241\205\351\260\b;\342x\251e_\b\315\311\240\223eqy\243\232\345\261\"f\226\330\030\262\332p\314\2246\312,!`\304\255.=y\360\350Xaq\215\232Fr\341\230\263-~"
+	.ascii	"\266\f\031\037\304@\002\206\244\223\007\215\352M\325\253J\030"
+	.ascii	"5\312\266:\001\343K-\fO\301\303\026\205\365\022\006\0219uA\256"
+	.ascii	"~\334n\300\210\273\262\"\343f\274(\342\242|\2014B\033'^,~\006"
+	.ascii	"ft\351\342\206\271`\210\260\321u)\251J\252\222EI\243\n\356N\330"
+	.ascii	"\020\217\275\305n\305K\026M\324\2125\200\224)\236\202\024\253"
+	.ascii	"Q\266UMRU\206K\330\336Y\036\364\n55i\026?\003\250<y\312\251\032"
+	.ascii	"e[!-\341\301U\367C\343\216\230\030\251\227S]\212;\210\305e\024"
+	.ascii	"I\204\311\325\f,\026_N\t5\224g\013\017&%T\271\205\272\350@\363"
+	.ascii	"\245\334\371.\003n\203\203\307\023\213\217\001\033}\f\332\354"
+	.ascii	"\374v\362\035\244-\2507\003\270\252\"\273\252\333;\313\003^\241"
+	.ascii	"\216\023\271;\244\021;\033[x\230\034\237\341\034\263\335ES\213"
+	.ascii	";K\357\2611<G(-\240\220\221\363l\367\\\327\301\007o\023\246\004"
+	.ascii	"M\224\305\231\316\205\262\304\250\035-~\236\343\363\365\303\270"
+	.ascii	"\304\342\353(4\260\260,\316q\336\306&iS\365\306\342L\3675\240"
+	.ascii	"\2544u+\274\351Q\323\361\243\207\305/\261\240\301A\264\370\030"
+	.ascii	" \311`\236\337\300\344\271!\252\272w\326\226\232\332:\2642V\225"
+	.ascii	"\330\234\272M\225\345\341\207\211\234\022.i\236\347\236\333t"
+	.ascii	"\360\301\327\252Y\034\261\313\342\314\346\325\213\216\n\225\305"
+	.ascii	"\317ry\315\337\323s\204\215Y\036\213\217A\f\235\325\024\340\177"
+	.ascii	"\217\315Q\207\307\035\213\237\343\272\312\020\001\263\330\242"
+	.ascii	"\271\0330iu8,\316g\356\306\fJ\227\226\305\227\223"
+	.string	"\315\374\357\271n\\pR\026g2\271L5\276-\303\2758$\244\246\342J\233\305\307\240J\277\276-\227\240\276-g\267\3471\177\317\017\331Z\n8\213\217\301\224\316a\236\305\374=\025\310\213\2672\026\277\303\235\376s\333\337\003\364f\b\215 \026\277C\035\375\016t\372\317l\231\215\244\"\001\242\275\271\254\264\354\253\254\r\204\266PA\001g\361;\260u=\203e%yI5\346\256\334%IjG\021Y\300\021.\255\r\252\225:w\332,^+\243\322\240\371b\361;\224i\253$,\213\26196Y\363$C\251o]\rP2\3468\226\231l\220\242\222\300\230\334Y\226\222\313\352[\026\321\236:\253\313g\231,NK\346\222\267\344\264\234%\243e\265j\314g9\312\263\222\274\344H\371,;Qs\034\212\323\244J\r\"\034\3666\033\244\250$@6w\314X\262Y5\346\262#\025w.\313\306|e\203\024\325\216\352\201"
+	.ascii	"\267\252/\267\272 8f\342pd\374\347+V\204\314\212+\320Y\234\253"
+	.ascii	"d\325hCa\361;\b\321\177\236R\215\231\212\234\2604;m\274\004\341"
+	.ascii	"\352\322\357\320C\277\303\f\235\213\372\3141\207\233\305\357"
+	.ascii	"`\245\337\241\205~\207)}\016w\372\034\350\350s\200\243\377,\226"
+	.ascii	"\231\030\301\304qc"
+	.string	"b\341\304TIY|\016s\332\026\353Q\366P\215r>\222\277r\222\277gHL\013\2202\213\317\001\215~F\362\277\307\002A\306\224Y\214\353\327r6\362L\374{l\233\021\242\013\213\317\201\214~&\222\213\374=BqE\256@\261\370\034\276\350\347!ewqlX\234\205\350\024\034\3124\360\311q\266\003\207\327\263\220?\007\261g\254\232\nwx\350X\034T\215r\245Kz\366\372q\353r|b\3619\034\321\317>j\006b\314@\262\017\244\275\26128\"%k\003\214$\t\234\030\213\317\241\206\316>,\007+\r\200\326\346\330\220b\361\237\271\236}\374\330\313\215Q\315@\340\003\315\032\234\305\226I\3223\227u\002\204*\210\305<x\220bv\357\275\211%[\023+\307\235\225\345\341gI\231\032T\034\035:\362\216\0369\345\022.\24026\0273v\254\201\31199b\361/\3107\2521\337\310Z1\b`G\227q"
+	.string	"\3119\371R\245\370\223E\225\205\fK\215\0329\353\365\n,F\007\256\330\254X\234\263\310\255\273VuVg\361/@\222g\344\031\031kN\271#+\313\203\206\001\343\306\016\213\177A\016\375\347\0309\006\251\004ik\303X\300\221\030H\300\224r8\320\300X\374\013Vd\253l\225\261\312\030Rdlu\371\352\031K\305\230\331\027I\367\246\253\305U\033\026,\262\213\013\366\336)\366\211\255/\257c\256zvQ\315\206\306\326l\341bqnQ\n\271\202\344\314\342\313!\271\346\260A\263\370"
+	.ascii	"\360\222\247\362T\246\022#\225U<S\365d\305H\262\202\3059E\205"
+	.ascii	"\0133\307\207\305\031E}\203\341\354x\230\001\340\211\376s\324"
+	.ascii	"\2531G\221_\0048\002\307\025\207$\"\307\n\312\342\003\300\210"
+	.ascii	"\376\363\256\306\2741\321\303\326\206q\001\030]\2359A"
+	.string	"J\324l\364\260\370"
+	.string	"\220a\307\016\231\347\315\027\236\223y\264\0313<<,&\357\220t@s\244\260I\331\027,`l\261\323?ig$\355p\327\245\332\212\3422\300\021)l\033\3509\\P\336,\276\005i\364O\322y5\222t\310#\022\330\212\372\312"
+	.string	"\354\rW]\335\336Y\033"
+	.string	"q\261\232\323a\361-H\323ss\244\234\272wR\f\2728'\345\254\005\025\247\250ac1y$\351\376\367\374\034ut\321\301\321\"\242\"E\231\037\024Sth,~c\261\374?\231\020#G,&\335T\263\377=>h;6\230\305\2273#\255\211\030\213o\201\2234$\2334\344\232\274w-nY]\355\254+\017qq\344\232\272\257\366^\022C\356\344\232\262\313\261I\025\213I5Aq\246X\321\260\370r,\221\377=YM\022\036*,\276\0057\364+8\352\2374C\216!\317\220F\032\260b\357\036Dr[q\203W\340\246_\001\2262e\274\264*"
+	.string	"\323\337\240\222ooI1*\320jk#\335N\264\367\226\332[G\216\334\306E\306VG\2129\351\206Y\324\005\341b1\031\346k\377{p\2307Pm,\276\234\372\346\177\017\220\027(Qg\026\277\202)\375\223]\252\221\354B~\261pe\002\234\221#\351\205d\263<\252O\r\2637a\026\227\305z\224_\347F\377dZ5\222i$\227\030\013"
+	.ascii	"\223r\265\001\227\237T#\267\330\031\226*\t\032\025\026\017\355"
+	.ascii	"z\224\353\261M\2772\251\244\225j$\255\220h=T{\313\310\240\t\227"
+	.ascii	"\214"
+	.string	"\r\254\224\020\2251\2537\263\223g?y\205\304Bf\261CX\240\335\343\0245)\213\311\262\244\223f\244\234\034\035\234\305\034\252Q\316P\254G\371fE\321?Y\254F\262HR\261p5\201K\250\322\017(B(\375\235?\323Ix\226\220\002-\2404\302\206&4}\352\300\203\240S\217\0342\245\246S\210\037\320\311\t\330\033\376\200\275\236&\363\267\204\236\260\364CK\240g\3574a8\202\t\241\021\007\021H\"\322s)\303\231@\370\206\300\020\276!\360hx\201\336\021\032t\"\025\242\"\234C\241\024\375\215\340C\203Ag\002\021\002\210\006\317\323\001NB\341\031<O\022\030\316\004b\351\207\226\3203!E\177(\321\323\2053\2018\235\3204\304Px\226@\205>\rC\264\251\tu\312\3519t:\235\362\231@,\375Pa:\fq\372\236\232z?4\204p\370\024b\202\246\246\247\337\017\370+S\336\251\002:\314)"
+	.string	"\205L)\360W*\231g\023>\205OA\034t\3529\235N\371D\020(BCz&\020K\301\020K\301\336\357\t\002K\301\237\237\222M\317\341R\020(\345\375\226\202\344o)x\231\322\245\337\331\224O\025\320!\036\016O\241\317g\226'\202\300\036\026\246\301\353;\177Kh\223Y\372\316\341\023>\207\345\205\274\245 \210\240\023\302t\210.\235&\360\206\031\202&\t\247\017H\002p\004\020\365=\205\340C\203\031\376\377\332Z\232\032\220\206M'\t\263\002N\246\005\206\347\022\206a\317\204\013F\"(\350\235M\347\tG\351S\023pH\"\004\fC&\204\302|\302px\366\200\302\240\206\022\322\337)\024>\365\212\216\202gz\302\211\246`\3204\352\300\001\210Th\006A\214\260\004\254\300"
+	.string	"\2128"
+	.string	"1$\341\\\372\231L\"\206f\223\221\223i\001$35E\030^\340LM_\360\t\303\360\302\320h\270\204*\375\322\246'S\351\364!\2350\205\302\020N\340m@J\177O@\021C4\205\340\231\0161\374\\\372\231&\234\275&\263\247\341=Tx\376\316%}\003\034\240"
+	.string	"\007"
+	.ascii	"\301Dy\020\022\300A\0028\310\007!\001II\t8@\222\376\001\222n"
+	.ascii	"\232\246)oH\302\351\204\246\032\002B\351\231@,\241J\030\234\316"
+	.ascii	"txb(4T\002M{f\321\351\003:\371\f{h:DS3\035\362P\030\232\351\320"
+	.ascii	"\020X\302\001\316\324\024\036\241\320\0036\365\236\202\275\240"
+	.ascii	"\323\t\035q\366La\004\226~\250\2230\204\337\005\204g\n\300\340"
+	.ascii	"\004\302\023UB\323\337\351\033\301'4\201$\206T`\"\341\0342\345"
+	.ascii	"\337S\317\302\231\232&\234*\240Nh\032\274\200\360lz\362\235L"
+	.ascii	"\275\341\321\231@\230\020\206X\n\032\t}\202\246SOH\nO\037Z\002"
+	.ascii	"(\f\372N\023\302&\023\025\236\303\"\023gS\360I\004\245&\223\311"
+	.ascii	"\347\364\241B\341Y\002\310\373\241\027\244\274r\311\034\001D"
+	.ascii	"yKOMA$\241\357\207\222\340\245\346\220\347\364$LQ8\203C\n\200"
+	.ascii	"\316&\263\347\223\n\317\022?\264'\364\241N\344\017u\322(\364"
+	.ascii	"N\246\236\t\323I\017\r\233\314\022? "
+	.string	":BO\210ax\236\302\245S\004'SD\211\240\222\205\324,\201\246\275\020N\037\220\004!j\"\375\320\3369|2!\374\341\231x2y&L\247\241\341Qz\016\225\224\200?g\360DZ\224\301\202\364)\370C1\234\301\023\251Y\002\025\236\276\rB`\3323\225xK?\224)\005\002\235\206\274\236\020\311\007D\205g\360t2\205J\274\236p\310C\207Ca\006\037\312K\321\337SP\007M&\204\303\241th*\361|O&\t\336\360\211\304PhX\202\017\r\002\251\300\304K\301<!\244\002\023\217H\005&\246^\n\374\245g\002\341C\203!\220 P\207<%\037\032\314%\324\021\252\b\325\207\006o\372C\201%\004\237|?t\003\030~R0;\360t\202\017\r\n\375P\022\322\020|h\220\350,q6\r\245\275SI\311(\025\236A\023'/mBS\336\017\250\002*\0042!\235> \t'R\264\204)\214"
+	.string	"\232\376\314\241\021\023\374P3\002B`j\n\317\013&\244`\236(j:{\275\020\316\324\024\n\371\226\210|M@\246\341)dJy\3519D:\235\320\324\347\204\331t\372~.\030\r\177g\320\t(\302\207\226\220\232$J\030\375\200h:\302'4S\020\002!\340;O\245\243\024\314\023\274!\037\025\230x\035\f\207f0\005`S\321\t\341Y\002\330;\205<\246\241)\354\t\t\035\245@\"\364g\351g\"\rQ\023&o\351\211\304\351\303\360C\315\245\242\241\023\317g\236L&\n@`\023Ox\376PS\230\362\200\302\236\231\341\207\232KDEB\240PxbPR\002\246O=\036oH\302\264\320\201\360L\233P%\013*0\361~\250\nLN\3023\365\361\224\202M\274\337\t\337\205\323\007$\241\204\021\033R\324\t\255\300\331\264\364\013\001\303\0175#P\224\236\303\323\004\341\271\264\204\nG\244"
+	.ascii	"lj\nA\004S\357\367d6Y\300;\207O\026L\230M\247\220\227\202y\202"
+	.ascii	"\347;SS\270t\246?\324T\001\025\232\347\017\255@:|\0222\245F\344"
+	.ascii	"\0175\227|\316\336\317,\3413}A\351S0}\002\362\204\300\024\350"
+	.ascii	"d!\247\277'`\217\327\324t\366x\300\364\311\304\300K\177':\374"
+	.ascii	"\231\302\024)\035\002\201$xJJ\332)(\344\375P' \337y\006\207\274"
+	.ascii	"\243\354C\203B\347\320<\205\275\037z6\371\320\242`\0230(<\323"
+	.ascii	"\037\312SR*\342\2310\235xJJE(\240\301!OII\350L \210\200hj\ny"
+	.ascii	"\301\362\354\241%N_\356\365L\236O\b\354\235B\037\024\206\246"
+	.ascii	"\023\317w6\2210\207\250\2177\274p\n\237\322\240\331\343\001\205"
+	.ascii	"'\226\200\226~\250\017\330\373\235\274\263\004\232\006M\237Y"
+	.ascii	"\224\236\tD\210\236R\006B\223\251\207O'"
+	.string	"\323\002g\023\252\004\024\006\177\316\3244\241\t(L\177\300\236\021\b>\224\004!SZ\202"
+	.string	"\f\232x\200\220)\325\303\341\231\232&\364\204%0h\342\001=a\036\236\251)$E\030\241\004!\323\210\337\t_O\372C\201A\024\314SH\202g\006S\2413x\"5J\177gOx\006yMi\n\0242\245\023\244\250\023\332\304;SS\350s\372\200$\230\301\264<\023\210\241\322\351\3635\235\250\022\317\004\220\004\n=\263\211\304"
+	.string	"\206\274\037\312K\177g\211\007,\001+\2202-\241MJ\030\224)\234?}>5\231\032HM`\023\004R8\177AKf\023\004R\023\330\244\324\223\226fj\212\3203!\035\232M>C\340\323\017M\177\300\236\206\264\t\bt"
+	.ascii	"\217<\3413O!9\344\235\251\231\236\020\202\357tB\323\tR^\007\036"
+	.ascii	"\244!\244O\300\323\tM{\322\224g\246\246\b\303\037\020M\321!\260"
+	.ascii	"\204\341\320S\360L\207\330LM\037\036\362.\374\200h\332\373=A"
+	.ascii	"\300\302\311;}@\022N\037\320\t\247g\0021\004\300\331d\366N\030"
+	.ascii	"*2\361d\016\245g\0021<}@\247\f\007\006Oa\210\024\b\024\206\370"
+	.ascii	"\t\236\351\t\276\337Y\016y\347\322\3174\241'\024<\323\023R\241"
+	.ascii	"\231\016{\316\245\237)$\227P\245\0370\345\201\220\376\320\247"
+	.ascii	"\322\304\351\373\215\320t\376~&\223\b\246^\212\246p\202\211'"
+	.ascii	"\363(\345\035 )\375\241O\372II\".\310\200\005\"\240{ \206\274"
+	.ascii	"\2360DO)\304\0175\235B\364\204\303\020 ,\020\236\351\357\024"
+	.ascii	"\221\376N\247t\370\024\002\237I\364_C\225S5I\013+'z\227wp\033"
+	.ascii	"I\023\213\213f{o\244\240\253\264\2736;\273\022O\027\001\300\336"
+	.ascii	"p\325\341)\357\250\345\330E\356\224vJH\203\242\256\016I\364A"
+	.ascii	"qgG\253\216e\223a4a\363\303\342kPC\377e\235\226\034\234;7t\260"
+	.ascii	"\260\022:Zt\345\0342ON\022\303\206\226RN\331\005\247\352G\234"
+	.ascii	"L\205\343\354P\354\240\313.\206fT=)\003\207T\022$\013\033\024"
+	.ascii	"\213\313\271r\256<\236(\252\304\222*\335\274<"
+	.string	"\336.\007\n/\002\250\243\377\262\215\233\317Y\026\230)60\254\2168u\352\326\310q#K[\301\026\307\262\226\2640\242\346K\253\254\007\2252\256\324\3121z\230a\222&Dd\021V\303\342\2360)vv,.\032\261 1\3660C\0321B\246\016\024\\\276s\333\320\300\226\270\271\225d\214\2247\252\346\344y{I\306\022\261SW\262\256X\\\216\351\201\273!\227\306\256\310nVw\352|\021C~I!e\210\2330$\027-5\202X\\,\253\240\025\313J0hB9r\254\321R~\311se|D\025a#\247\340\200\262\005\205\227l\367\366\344\316\313\342RK\251\245\\\253WWpBH\225\301\200\221\366r\255\344\342#n\213\t\227-\271K\225\2550f\320\242V\330a\261Z\375R\307\345\214\020+\001\206B\250\023\002\225J\034H1\212I\246\220\231\"\231\331&\035C\025@0h@\"\224\215\226M>\023"
+	.string	"\203\312\212\265\211\252\307\034C\246FDD$\005\005\005\005\251,c\277n3"
+	.string	"\252^|\r4\363\260\240op\327X\231\254\323\025\r"
+	.ascii	"V\373\365\356 \212\003$\016\314\354\214Y\003O5\205\206\226R"
+	.string	"\021\337x\2321\216\"\"\321\326\245\306\366P\302GNA\304\022D\211\232\310\217\036A\304\301\274]\213t\220\020\374G\230\244n\276\345\325a\214\3530\324\243\311IU\0216\271B|\336\333\351\247\210k4\016\263\020\342S @\331\337\\\352\302\337\367\315\352\372\214\351\302\334\312\032\r;\bW\234\200BGZ\007\036\227\223\227\320[\207\342\034\221\300\r\003N\324\367\tN\313\025\004o\220q\020\335\031Y\275\240\306\324@\261\302{\316\265\254\202\002M\247\224Wi\277\226\320\213\027R#~P\254\006;\"~\230\007\013\005\317qnR6\f\324K\204#\303\226\246C\261\352\312\005\271\247%_~\311\226%<\323\251\272\200:\357\t\020W\241\332\214h\006\233\265]\323\222 \203\023D\236\240\374Vg\235\213C!C\027X\241\362\022\370\330%f?\353?p\324\265\246\023\371qm\222\275O\tN@\323<\t\375*\254\343\316\027"
+	.ascii	"L),\305T7\263\034)Q\334\345\361\026T\321\247\017\f\020-\254&"
+	.ascii	"4\f\230k\271\200\243\260\244\344<\033\247\231\240\024\356\255"
+	.ascii	"\300N\231T;=9\275\007\371F\312i\026\f\267\204\004E\026\3621\332"
+	.ascii	"\036\235\002\273o\031$\356\204$\036$\023B\374\274\013\360z\363"
+	.ascii	"=\310\301Ej\274\343bD\302>pN\273\247\006\232H\216IL\246P\357"
+	.ascii	"i@mF\373\024\230)\373_\256\026JT\n\037`\bT\227\034^\203\254\233"
+	.ascii	"H~\031\377[mT\2230\037'a\304\306\365!C\210\033\345?t\273\200"
+	.ascii	"\221\347\234\"\310q;dS\301\260\362\006#,\374\341\372\027\266"
+	.ascii	"\306_\304\333wj\200RA\351(\266i!l \276\246\252g\212Q{4,\232\313"
+	.ascii	"r\263W\362\370\250WF\222~\2357;\303\2553\242OT\360\351\0309O"
+	.ascii	"\007W\266\243W\354\305\267k\226\314\t8"
+	.string	"\271D\371\334\177\232\037\223\206v\232HJ\224\205\034\206\337\215*\004\321\240\330\272A.j\252rP\342R\222\245!\307\300\017\001\304\336\\(\242\t\211%\360Ix\021\215\021\003\310\317h.\317Rg01I(\245r\251\332&\265\365>Io\307\354U\363\310\341\366}\324\347\240,A]M\250+\025\345\273\232\204\334\333\275\206Y\201\206\326\272\225\004$\216.\220S\025Z\327'\020\220\270\274\205\347r\016\206\003\221yM\203\217\237\321\230b\022\337\r\301\373S\215\247\002=\315\373\311\244C\276\\\236Z\n\201\364\221\007a\027\270\257 A\302\203\255\327\216&\252\350\006\313\262\332\305\022\210F\313[\242\252\210\177\002\026X\004/\024\230\031\304b.\316\273[\314\330\243\2438\241\217a\260\305\021\002\227x\232\353\207_\005\257.\204\215\033C7\027\252\031\272\"[\241\027o\244\017\017\275Lz\207\331\352\036\361\034$/\216\265\317K"
+	.string	"tr\362\276\362|\247qDw\2431<\2606\205 i\323\337\312b\315`\222\337\337\315\334\336\246\327\210\256\335\240\3349\2350\3623\311\323*\023W\007=\315`\035s\025W\356Rh\304*\244\026\320\243\332\210\214W\306\275\001\212\235\034\324\371\1775R"
+	.string	"\237\033\3214FvH\327ZJ\360U>7\340\216\304\\\234\364\306\210\233(\275\233\337\206\177d\016\316\342TA\005r8d\324\365g+\224QG\340,i\256B\216V>\236N\367\245\332\320\2019\020\032\203\272d\347&\312\021p\312\332\357F\240@{&\313\363\373O@r\230\2277\200*\221\350\343G\366f\275\212\235\2405\031\323\0307\3326N\017L\027\036W\370K:\002\357\251D\r\277\255\3504\316\323<\251\241\314\223\275\272!\341\356\372\247\007\314W*8_\220\342\274\216\361\271`\323&|\223\0347MV\020li\343lN\007'\t\372s\030i\251OV"
+	.ascii	"\022X%\276\021\323\221\314\260\257\035\337'9\321\323\022\376"
+	.ascii	"9\0356\276\266\210>\311\"\334\242*nBG\331\030\311\3431\304\f"
+	.ascii	"\266\340\234n5\220\344\036\243$\325\2618\002;\274\304&\004\216"
+	.ascii	"\300\360Pj\\bK\177\030\205\310\2628b\355\036n\017\324\2229a\276"
+	.ascii	"1\352\006\305\255\325\301A)\026"
+	.string	"\002ob9\276e\373"
+	.ascii	"\006\f\020\2669\301\245\253\364)\367L\006t\342\212\"\242G\274"
+	.ascii	"\353\340\352\016\304\004\020\267\242P\017/3\023\206\023\006\260"
+	.ascii	"*E\226\212\306\334\367C\037M\242!\221\240#^q\300\347\023@\002"
+	.ascii	"_\260e\016\251w%\276\r\bT\211\235\222 \352U\t^gb2\210\361\344"
+	.ascii	"\035Iw\365[\311P\300\305\036\323\246u\342\264\257\2249\354=\201"
+	.ascii	"\342H\005@\254"
+	.string	"H\025\235\333\024\036`5\351\273wL\326X\217~\217\313;e\r0]\300\321/\005\254q\001\221[\251*M)\227\3043^'\213\264\314\267\334\345\323\262\204DK\272\201x_\310c\372\363Tk\221\307]S-\202B\230\327\376\274\r\023\254|]\321\346\343)4\256K\n\210\204G7\022[V\346\211[cjA'\203=/\203\276\235-U\373\214\365-\322`f\305\320\364\354\3710\370\2529\316\375E\321;\327\226@\260\321\255\003\b\232R\350\3318*\025]\356Y\305c\3621\360\357\177\237;\372\202/\021\260E\365\237\317\320'7\255id\245~m2\323\261\264P\345tR\275\211(\307-Ro\177\221X;B\025\370\257v:\b\270\236;:\206\264B\325\330!?\342\244\355\023\241\031\237i\321\203Dj\241\225!\t\256a-\367dNa9\027 \022XY\234\250\013\301z\021N\266\2338\360\366[\242\201\371"
+	.string	"\373e\244\035Z\335\n\320\025\031\373\261\355v#\030[7a\365\244\036\356\313\307\230\377t\232\313\272"
+	.string	"\205O\237\370$\264>s\2635\203^\3157\\\027\213\032\322oc\334"
+	.ascii	"I\315\f(\b\002\331\256\235M\342\017_\262&0Z\261\332\372\275+"
+	.ascii	"*\227\255\033\225\312\374Br'\031#\276\252\251\246\243\b`k\377"
+	.ascii	"\221\213\214\262p\232h\021\201]1k\263\toJ=\213.\004\r\217\336"
+	.ascii	"Wp\313f\341C\366\266\005\t\245\267Q\333U$\204w\0200\214sQJ\027"
+	.ascii	"~\346\236`4\0177\342\3219\370wP<\302\026\0375Q\203Y@\222\264"
+	.ascii	"\f`fL<?\202\256\b\240\253\265\336\020S\252\360\025>\204\272+"
+	.ascii	"xH\272\007G\372L`p'\266\026\253\343\362\217\374\374\2270\034"
+	.ascii	"\255\263Mn\b\316\037O\353\264\004\221\372j%\201J\026\333\363"
+	.ascii	"lX3\303\0074\356\342aI\207\234=\024b[F\353\004\343\364\212X>"
+	.ascii	"w\314\034[RJ@\207\0305\350\340\231\177\343\025>@\313\352\b\316"
+	.ascii	"\272j\214\224\316rh\263`m\207|\263\316O\365\210\232\315\265\264"
+	.ascii	"\020r\337\007\242C\237\274m\301`\034\304\263p\341\241\366\325"
+	.ascii	"\332\324\255\373\247\337r \nYe\007\332Y\252\235_\311\351\233"
+	.ascii	"}\213{f\216I\024\243$x\037\036\326\361&\001rtT=\007\310-\220"
+	.ascii	"s\301\353G\367\335\025Fb\026\323-5\265\347\373\025\370\214\224"
+	.ascii	"\325'\341e\037\r3\321\252\2347\224/\207\250\375+f\243\335\306"
+	.ascii	"\252\276\274\325\344\203\303\177\006\234q\250Ps\211\f\nLub\335"
+	.ascii	">\212\363\367\223\262\260|\001\353\t\377\027(\212\nj\207\033"
+	.ascii	"si@\305u\031\031,\273r\240\323_\274\346L\334\366^\322\347E\215"
+	.ascii	"\037\305\22181\313\340\207\020\260\033\332\312\303(h\231&\034"
+	.ascii	"\275k\0306\341t\252]\264<\177z\305\255\311*<ZSN\026GFY\005\374"
+	.ascii	"3\262X\227\314y\344\260n\305\027^\251\301\352]\252\260\177\201"
+	.ascii	"h\301\035\365v\300\300\360}~\331\307\001\263\215\305\354N\304"
+	.ascii	"\336(\322\254\257\034\027\245\202WU\343\336\223\352<?\247\336"
+	.ascii	"\247~\221\355\212\026P\351\026\016\264\270Rd$H\244K3\352\\\225"
+	.ascii	"\003\377C\007\206}Ok9Q~\t\276\225@r\277\213w\25679\332\227\322"
+	.ascii	"\022\303\023E\372\376\306\2404\231\216g5\323g\313\024\016\247"
+	.ascii	"]\214A\233\227\271\360\023\024\362\204\243-?\270\342 PGeu\265"
+	.ascii	"\347\355\341\224\323?_#+\210^\272\350W4B\246\252\216\373C\\]"
+	.ascii	"A\033\030\245\323\212@r\270\353\271q\312\207;\226\032\367\317"
+	.ascii	"\260\177N\024\227\352\n\033=^\251\252\203\016a"
+	.string	"\374\373QdA\256\344\374\354\246Gbs\273}\274\033\035-|l\003ZY\321\032ZS{\210\017\247\343\227\177T\306\254/\334\332X\036r\036\245\256[\003\230\232/\217\245>\261\216\214\3347;z\212/\313\021U\214e\367\236\367jQ\327\024\360\276`R\021\340g\207\253\245az`i\323\177Y\t\334\375\311N\320x&\264\347(\246\261\031.\2747\355-\027m3\214\036{\376\371'\031\003\003\365\315p\032\324\262/\177{z\250\276\375c\331&S\025v'N\253\377et\227\255\016\345Z\021KgUAO\301%\0272\344j\357K\257\227ek\206Y\022\357\b\246\314\333:\001Bh\373\370\336K`\320\222\225b2\225\023Uh*\335\353\206\375\375w+\264\333,\241\236\266\305v\264\320\204\353\241z{\363\301#:\230i\207\237\033 \3553k\016\370\323\372\250W\002\027\225\267;<\331r\034\224\217R\036\314\344\264"
+	.string	"\321\337r\322+Cd\033\334\n\375R\241\277JL\362\364PzK0\244i\346\217|\215\207\234o\231\241g\200\024\324\007\256H\316j\312\013I\366\244Y\277\006\373\330%5\373')\256\215\035\357Y\337Q\345`\255uX\335\255\270=_F\367\350\252\266\324\236\016:O\327hD\357\211\246\375\364z\177M\036\033\301\207 q\371&\362\211\330\254\f\337?(\200\224\356\030D\027c\335\260\336\221\213:\003[,\241\355\213t\006\226"
+	.string	"U\344m\201P\r\304\035\365&\225\004\204\367\351\266+\220\3552%\224\205\002\030\204\261\343\r\0039\230\033\240I<V\227\244HD\021\274\214\206\377N \036\375i\373\007\266\263\253\210{\031\265\322\375\256\344\265\205B\305\n\020/;\200,\345\"\241\215\202\016{\021^Y\225\256\006\b\216HP\203\343\366\215*\032\222x\305\r!\255\007\237k\021wE\315\327\363C\370\254\352\005B\203\t\003\262\274q\251H\232d\233\\=\210m\345\305\225\250<x\373\274<)\311\370\364\304~E\217[\226\022b\236g\nW\355\002\356\316\347\024Q\201\241(@\265\004\206\200\376\317\260\026\215\034\363\030\216/\277\304\237q\004\300R\022@]\326Tj"
+	.string	"\005\203\305\312\271\230\323\256\002H(\006\364\356R\204Yn\003\220\016f\346j\027~\037\256\227dnM\255g"
+	.ascii	"\257\262\305\374\t\002\275\032\200\376\027\224\240\331\020\270"
+	.ascii	"Uh\335\373\3261\376v\325u\320\013\343i\327\321\335\261\2079>"
+	.ascii	"\236c\"@\031'\224\372pQ?\313\323Q\033\3000\222N\200\300WO`z;"
+	.ascii	"\255\203Yz\315s\345\333j\027+;\215\315x\343d\272\220[\030\354"
+	.ascii	"B]\377\233\353\223r\023\232\347b\265K\323\341P\213\013c\316\305"
+	.ascii	"\242>\323\025\267\177\036\372\023\376@\215\341\t\027\236,\316"
+	.ascii	"\215;\036\030\316\240\333\027\335\342n\246\233\031\334\357\313"
+	.ascii	"\241\371\355\024Q\215\243d\353\300\177hwP\343\255\36053\373{"
+	.ascii	">\204\351\031Oq\363\316\373q\370\2057s\3616J\265\326\232\207"
+	.ascii	"rc.\340\253\r7|{\221Z\370\317\307\243qL!\350\336\201\3425<\033"
+	.ascii	"\377\017u6\264}j\366\345\270K\3360%\177\303\356)\036\331\201"
+	.ascii	"\234^j\003on\220\273\242\370\tFg\3105\304\352\373\270Q\f\221"
+	.ascii	"\033\2466p\345\347n\216c\021nwc\024>\374b|\332\227\251\037\003"
+	.ascii	"{q\367\203\210\021\342\237\363\271\033\247"
+	.ascii	"_+O\301V]\2223\363\257\223\026z\253\231\302YS\210:\375v\362\366"
+	.ascii	"r\272\272\312E'\n}V\323$4\327;\321\210\f\367\200\3055\366\374"
+	.ascii	"\n\311\311\013\333\233G\320\326\r\250m\246\330v\205\322m\274"
+	.ascii	"@\270\273\002"
+	.text
+	.section	.gnu.lto_.symtab.476829754ff76bac,"e",@progbits
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"getAdjustmentsRangeName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"getAdjustmentsRangeValue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"pidAudioPositionToModeMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"setConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"changeOsdProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"getCurrentOsdProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.476829754ff76bac,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
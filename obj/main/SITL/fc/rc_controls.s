@@ -0,0 +1,1380 @@
+	.file	"rc_controls.c"
+	.section	.gnu.lto_.profile.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\005\007"
+	.string	"D\t\213\001"
+	.string	"\030"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\242\302\263\302\013\002\302\374\277\243\n\004\002\001\002\002\003\240\342\234\212\n\004\303\375\206\360\n\020\002\003\002\004\002\005\002\006\002\007\002\b\007\005\b\272\242\276\325\b`\003\002\003\002\005"
+	.string	"\002"
+	.string	"\003\002\t\007\002\007\002\n\005\n\002\n\t\n\013\f\016\021\220\237\222\215\004\002\022\201\212\206\304\023\344\371\276\347\t\024\326\352\245F\025\026\253\262\211\366\t\027\333\314\243\214\005\030\031\353\227\221\315\013\032\366\336\365\327\f\033\034\240\342\234\212\n"
+	.ascii	"\" \200\202Bx\333\310W\337W\266%\243D\215\326\354v\024\206\223"
+	.ascii	"P\273\320\025:\npv\237h/#\002\206a\016\326\305\374\bC\200~\002"
+	.ascii	"/\301\036\360\034@\347\260\022X]\243Zk\001y\006/\356\264Yc\341"
+	.ascii	">\344b\272\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 \202\265\001"
+	.string	"\350v"
+	.string	"\006"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\003\b"
+	.string	"\001"
+	.string	""
+	.string	"\021\002"
+	.string	"\003\022"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.ascii	" \007\327\240&\fQ\365\305\264b\327\335\\\214\225%2W\201\001\026"
+	.text
+	.section	.gnu.lto_.inline.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`G\001-\007"
+	.string	"2\211\035(pU\222\016LC`\017S\001\357}G\013\227\020\242\276\n\007\304\233\210:UU\272\021\\p`\21247\255]\262\245L\001\377G\344\324\301\210\236\225wR\266\271;\350\003\347\205\305\217\310\252\030\n\304RN\237\225E\006:\027\022,\210\277d\377C 3\001P\364\3510\211\246  \361\372_\224\031\354'\224sk\264rw\322\275\323\363\214\266\317\311\356\356\326?w\021/ `\242RH\346\001\261l \256\303\n\271\201\001\346\022\214X\006\262\2139\217\326\027[\255\267*~\322\310\205\023\007\337 dq\260 hH\300\236_(\023\337\0310\030\200\037\246\004L\340\002\002\214\013\317\221\026Pv\356^\301C"
+	.ascii	"Va\004\025\2724\310\001\204\007\200$\263m\360\322;\256\265\240"
+	.ascii	"\027\370p\202\271\337`Zs\253j\327\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"\305\006"
+	.string	"B\t\035&\200\265I\0073#\247\372\245Rc\022\031\001\360jj\231\274\265g/&ht?\\\200\262\212\354\317\276=\244\311$\003$\371\221\013K\327\240\213\371\022\006\270m\232\023$\303\254x\206\330\332\320\265\214--\024E\272\356\270\345\224LJM\201\353\220\177|\353\350>\272\316FY\322\360\207\333\031\220 \026<\354aK\253\346\254\332tf\\K\252\245+\371\222<>\020, \220\202\t\024\221\007X\241\201\"\244\321\224c\213\233\373\311\310M\312\215 \370\356mh\337\275\n\3067\b\356\376\024\270@m\352\246\3144"
+	.ascii	"\3039\211\225/\201%\031Hjj\002^S\303?\"\013 @\237\f+R\305o\222"
+	.ascii	"+^D2Bk\265\023\021\204\240k\037&cfk\225\344\210\353\2129\004"
+	.text
+	.section	.gnu.lto_.pureconst.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\204\004\002\204\004\004\230\004\b\230\004\021\204\004\022\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 z]\002"
+	.string	"\264\002n"
+	.string	"\005"
+	.string	"\001\002\024\001\002\001\300\007\025"
+	.string	"\001\002\026\004\003\002\027\001"
+	.string	"\002\030"
+	.string	"\001\002\031\001"
+	.string	"\002\032"
+	.string	"\001\002\033\021\002\300\007\200\022\r"
+	.string	"_\020"
+	.ascii	"|`EP\016\\\205\365\252&\244\004\001F\337<\202\331w\267\003,\f"
+	.ascii	"\003,"
+	.text
+	.section	.gnu.lto_.lto.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.77.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\315\321\025\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\007us\357\006uq"
+	.string	"\005\001\006'\001\005\005\001\006\035\001'\001\031?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.79.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.83.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 \240\265\004"
+	.string	"\204\bj"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\326\221\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\365\006us\315\006uq"
+	.string	"\005\001\006'\001\002\005\001\006\035\001'\001\220 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.85.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.89.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 \237\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\361\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\032?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.91.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 W5\002"
+	.string	"4\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001'\001\320\017\350\0072\264\013\352\376\n?\202\210\2008\177}\301\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\007"
+	.ascii	"*#\300!\314\306\2004\225\313)V\017\240\b"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.92.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375 \347e\006"
+	.string	"RL-3Pm\222\016$\243\252\022\252z'U\023\216\332@\226\220I-\377\226\354\252\375\273\035vv\347`N`\020;3\213(\242\357"
+	.string	"\017(S\217\315Z\373d\313\024\273\314\306\341Q\034\315s\t\216j\216\241i\032\024\036\232\2436-\023\360\203X\240\032\347=\252a\256,\033!\033"
+	.string	"1\211oHE\252\313qD\007ku\272\035K'd"
+	.string	"\026 ,\375\365A\226\361\255df\316F?\216\354\342q\"@\222\031*\245\244\311T\322\361{\036\263\301\201\347\252\327F\250\030\244\211\021\224\314\2531\215V\305\352\026\244\225\217\013\222%\372\024/\b\2319Z\242\212\316\372\023\374\005?E\007"
+	.ascii	"2\001\0238#&\016\345\256!K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.93.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`5\001%\r"
+	.string	"\006\032YA\020\257&\035\250\201\241\207\n\023\372U\002\t\324-l\"^\204\222\313\024\237\223\341J\230\260'\377[c\3751\324\321\203\3218\021C\024"
+	.string	""
+	.string	"\2004\324\205\216\201\003\320}lI\343\333\030\t\331;\311\224\002H"
+	.string	"A"
+	.string	"F"
+	.string	"\026@\371\241\003P~-\320\251\307\333\005\027W\210\t\231d27\353\026\354\361sGO]\205<\r\023Z\210\264\217_\004\273\215\366"
+	.string	"\257\241\2558\216\314t\007c\213\246\202X\205dfQ\244Ap)\267E\320\226@k\t\001\265\313\314\354Gm\261\032\227\354\214c+\207\245\034\3669\254;\366\016\213\016\353MU:\261\241\"\323\345\364\"M<\230\fm;\355\246\355\261\365\006s\350\270\344\240/\223\302\b\021\231\333G;0\374"
+	.string	"\004\247L\037\006az?`\314\314\317O:\262x\211YA\027\375\335\315\262\"\343\277#\021\232\361\361F\301\"\323z\370\245!02\323@\355\301\037\032\324\030\374\312IA\213\374\352\024\312\317\337H\001\003\302S\273}\360\244\006$\t\260\022\221\223\221\252\027\b\207\001\226\241\230`\227\310\225Y\227\002\313d\301H\211ue\034\013d@\261\023\222\314B\301\260\314\332li\227\037\025]\207\361\036\256\336\322Vs\016\320UZ]s\207f@x\242\336I\356\356#\352\256\304;\025\031"
+	.ascii	"L\204^\350\206\0275E .\210\001n\300n\025l\001e\300\270l\220\003"
+	.ascii	"r\345\020\214G 1\261^\202{\025<\244\272\200\270\346\300\312b"
+	.ascii	"\203\017\201h5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.94.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`\262\003\275\027"
+	.string	"\006\253\226J\300\224Q:y\003?&\204\024\215k6\254\005 0\307\317\376\302\374!\310\252\337\302\234\252\270-+\210\212\004\372\317\037O\346\360\360\210@\360x\0263M\305*\2010K\255C~b\263\241A\3114\007\303b#\255%{\023)e\n\203"
+	.string	"q"
+	.string	"\212"
+	.ascii	"\271\222Iu\232\301\022\377y~\362\273b\225xN\013\177F\273\021"
+	.ascii	"\b\005\264\224\244\326\037\214e]tg\270-\272\263E,m\311Q"
+	.string	"\225\022\351\f\233i\337q\327\263\344\250Jmo\007$\3516\260\2705\017K\303\026\242\246\241\005\242\353\020\272\236@\b!w?<\201B\326\356\026\262\324Z\311\235\017w\330R\344\006\222\005\242\343\020\272rG\270\355-\007\355l\314\242K\255\365\214\333i\330\257\366?\214\377-\177\237\b3\026\273\266\206\376\025lxq\334\254\027;\326hI\021\033}\ft{\0020\310\215\227|d\226\2727\364\227]\340\305mooW\350\005\223\323\255{\376\237\215\233\367o\227eY\276\213\376\363]\223\277B\371\255\311W\t\371)\223\2172\371\254\311?\241\374\325\344\223\224?N\276*\344\247&_\244|:\3713\344\207\315o\3463\363\027\300\250{\022\300Tk'\tV\307\013\323\252\227\006\224olR\301\346\3001v\001\250T\253\2027R-\232`\222\"(6o7\304\021! m\336\305\017\300&\332\342\202\255\3612ci0h"
+	.string	"\003Cw\322\206\215\360\205={\201\242j\\\276V\206\203T\255\365\300\027\306\306x"
+	.ascii	"!&\246\247\021$J\2025.\037\3254\2444W\206v\263\212?\302\272\220"
+	.ascii	"I\325z3\360m\261K\022\276$v~\206f~i\032\001\224\257\306\345q"
+	.ascii	"\364P\030\205\315\373-w\217\275t,\310f;8\262\330Ll\006\213Q\200"
+	.ascii	"\341\330\320\334\300b3\035\330+\300e953\330\216L6\203\221\377"
+	.ascii	"\377\253m\027=\207E\324\270K\243\333[\225S\217\b\375\322\250"
+	.ascii	"\253\203\376\273\372.\265\266\205\225w\b\035\361\215\315\373"
+	.ascii	"J\253t\206V\257\374\360\321\352WJ\253\364\340\221\322\363\251"
+	.ascii	"\211\022f\362\311!\251PZ\325\254$`\023J\023\030\362Cd\343r]\271"
+	.ascii	"#\\\212\325\252\336#\340\217\223&\233\325\242\217\037$\033\227"
+	.ascii	"_uG\250Q8$\031b\250\2102\222\322\202\264\001\240\002\031!\333"
+	.ascii	"9\020PU$SAZ\016\225*M\220\266A\002\002\351\f\\\023\274\037u\237"
+	.ascii	"\207\217\254T\236\242\216n!\216kLO\335m$\b\375&\256\247!\203"
+	.ascii	"\341\204i\0072\266\214\244\257\007\200c7\222+\200\203U1\3116"
+	.ascii	"@\301?\212|\003+\037X\271\022q\323\206\215{@\020FM9\315\200\022"
+	.ascii	"\356\261\374C\b\003d\353\236\351\204\242f{\361[\024\261\225\313"
+	.ascii	"~a\b\243T,\021z(+\004\333\300)\337\242H\327\327\273\032"
+	.text
+	.section	.gnu.lto_processRcStickPositions.95.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`\267\033\205v"
+	.string	"\352\266$)M \220\342\031\003\257\254\024\311\005 T\037\2608$\352\326\212\030\2046\255-0/8b\257\005\020\b\325\355#z\304\214\245b\006\347\300\241\250\241"
+	.ascii	"\310\022\020\245\022\213\234\356\363\230\343\026i\244eej\270"
+	.ascii	"\332\272D&\"B\244\2242\245\224\002\211\002>\002\225\002\316\335"
+	.ascii	"e#\334\322\316\242<\036\314\364\035[\254\341\245\262V\220\264"
+	.ascii	"\223\356&\335q\335:\353\253\277\273\314m\347\244\204e\327\364"
+	.ascii	"%#\341\356\360)\325s\334t\234\344f\322\323f7\341=#\327\323\b"
+	.ascii	"\305\356\b\341\373\276\"\214\315.{\247mvm\016m\263\336r\234\344"
+	.ascii	"\250\251f\307m-\271\246\357X\211!a\342\016\337w\312\324,3\031"
+	.ascii	"\233\345&\363`O\205\274m\267#\314\356\360}_\250\017\302k\257"
+	.ascii	"\323f\2437\233\357x\nK\341(\354\002C\341'l\307N\270\216\351\270"
+	.ascii	"\tO\257R\2408a\242\204U\025\t\252\251\021RQ\"B@=951-)\201H\372"
+	.ascii	"\200td\344\241hI4$\024\004\364\323\301\247\207gG\207C\316\006"
+	.ascii	"\234\033\233\032e\022y4\272-\273\2767\271\271\232\357\370\246"
+	.ascii	"(\001\"%\t\232(\006\0209\013\3133sa\007\017\250\2163\226\241"
+	.ascii	"<\261s\242S\347b\331h\246[\271\t\215\032N\2355/\261\226W\263"
+	.ascii	"5\257\031"
+	.string	",O\203\326\274\306x\326\274N\360+\0358R,*:\212\034@N$\326\340&\020\273\004\242\364\231\306\255\320T\335`\201\004KFu8\330\342<ehq\236\325u\252\211f\304ZE\345\315s\245\213m-}\222q\2512c<\252\032\006E\204`\207\020\f\343P\\\372\211\313\026w\022#}\376y\323\bO\230\374\226V\242\037j\325\006|fY\227Z\250aJX@\300\240\305\223>$\315\205AAr\261\216\250\264\021\240\207u)\315\317l'\006\037dZ\372\224\342EQ\246\370\362\316\005'\242\302\304\207\250\314\271\320\2524%\321\256\001\237x+\317\n]p-}\312y\220\213%\327\005\004Q\013\3133[\363q\326@?p\335\241\2057\367\201\003|\272y\017\034\022\347Y\243\244\220\3415\3403n\255Q2(=\342;:E\234C\036\021\317\031\342\033\362Tp\234\274\276\001|\nY\227\322\247\232\333H\237F"
+	.ascii	"\237i^\243,Z+C\353\344\272DX\005M\003>\321\326\235\261#\316\226"
+	.ascii	">y8r\225\222qx\326\200\317\263U\231&\314K\313u\221\364\271\303"
+	.ascii	"\217\25320\311\216\006|\352X\245t\334\005z\271\321\305\002"
+	.string	"R\006m7G\267a\353\322\305\310\300\234E\241W\0332\031\353\362}\337$\331\227\177\323\365\322\020\302\270\352Z\031\264\335\305z\337\227\335IV\326\254\242\231\331=fN\200\231\207F+\336\346=1L\321\rS\363+\276=\323\177]\363\035\006\313\263J\330\216i\241-\371QV\376\361]\256\302.\177\275\270\230|\345\257\177`i\"@\221\237|\237=\260\026\206\\\247\th\231\r@\300\333\211\374#\265\312\366\365\\l\374cgi-,FP@\201\266Y#R\241\2277h\227\216_a\031\344j\274z\240\027\003z\367/\250\023\344\356k\030\266\270\213p\b*T\264\315\272F\205\\\252\320._<~\224\335,n?\215\207{\203\316\324X/\306\253\233\342[\256\215\206{[\234{\253\275z1\254\207B\001\256N\314\227\247\351\365}\337\327H\327\307\"}xm\217=\257,\212O\361b\314M\215\365\375|\022\206\320"
+	.ascii	"\226\346\345\213\356~t\332B-\212\357\261g\352\322~\224\273H_"
+	.ascii	"\332\3326\336\204=E\024/\326\372\261\3372\320V\252\260\177\224"
+	.ascii	"\376U\347\272\330\217\276-\324\332\370\b\210\344\205\231\365"
+	.ascii	"]`\022\350\372Q^\337_\253n\313\227\247\341\377\325\201\306[a"
+	.ascii	"|\337/*\356\273\246\002\201\004\023L\3206\373\217$8\327\357\337"
+	.ascii	"a\212\314\314Tl),\214\357\373Vq\273\320Q*\340.\322,[\320\302"
+	.ascii	"\333\331,w\213\266\331~V\352\367f\245\313\027\331\233\367\332"
+	.ascii	"\253\357\032\337tmT\330W\007\346\211\242\227/\276\216\273\300"
+	.ascii	"\266\377(\363\324\313\377G`\022\035/\360\377`\356\347\230\215"
+	.ascii	"\256\201t\246\300\350\274\002\351\254\002\351\274@7i\306\272"
+	.ascii	"J\321q\315(\\\347\023Ig\023I\347\022\256\263\325\321\271\n\351"
+	.ascii	"L\002\351L\205t\236B:\217@:K)\235\243\224\316\"\224\316!\220"
+	.ascii	"\316P6\316O5\316N\256s\223\322\231\t\351\274\204tVB:\203\250"
+	.ascii	"qNR:\177@:#)\235\217\\g#\327\331C\322\271(\351\274t\235\211\220"
+	.ascii	"\316CJg!\3279\250\343\232\201\220\316?G\347\016Hg\037\245s\217"
+	.ascii	"\322\231\007\351\274\243t\326Q:sp\235s\222\316\033\222\3168\256"
+	.ascii	"\363M\322\331\306\350\\ctV\032\235\223Fg\244\321\371\350:\033"
+	.ascii	"\221\316\256\321\271=:\263F\347\365\350\374Fgw\003L3\3143o\376"
+	.ascii	"\305F\306\251\257\267Z(\247\203\372\245\2640S\366\006\0307\303"
+	.ascii	"#\226>2M&\206\340hc\002\321>\275\362\b\265A\264N\377\364@\211"
+	.ascii	"N\337\252\275\r\026\"3,E5\213\266\351\177\255\356\257\205\246"
+	.ascii	"O!\350C'\230!\242\304\364\002\27019A\331{\002\002\204\021p\351"
+	.ascii	"A8\013K\317v\371R\265\363\032DKR\346\221\031\245\315\321\370"
+	.ascii	"\200D\003[\225\360Hz\274\341\327~N\210\0305\263\332*\275R\221"
+	.ascii	"\006G\302\254\272\021?\302Dd&2\027\231\213m\263Jo\345\325W\235"
+	.ascii	"\3630\003\321\303\362Mz\025hpu\202W^M\031\336\316\244\357\301"
+	.ascii	"\343Be/h@\212>|KO\314h\212y;?<\017\336_\022-~z\313\005\004\221"
+	.ascii	"~\201 H\177\205V$M\016Z\243\2437\366V.o@\210\216|\034\375\221"
+	.ascii	"`\037\347\n\357\206\374\2046J\301\350Y3Wr\022\277@\205d@\363"
+	.ascii	"Au\346\343G\020\220\225\363\324\306\215j\345\313n\216\2215o\364"
+	.ascii	"\0173=vL\2051\364\340\320\242\367\360\212`\275A\273\374\"\242"
+	.ascii	"_\242@\364\256\236\335\224\337t3\207\216&\017\0333\352\327\217"
+	.ascii	"\016\036Y\347@C\355\360Q\304V\221\246\207"
+	.string	"^\205?\207\336\005\\\254\306\340B\255\022v\006-\r\267L\321\315\320\221\224i\342#\364\235\306\235B\177$\330.\264\213\215\0363\315\242\r\362\260\240g\013\023\2536mO\316x\270\364V\013\364D9\3068\241\"\310d\347\243\314h<S\376>\f\332\320\371\336j\177\276)\307\222\272-?\336\325\275\325\372\374\317\242\317\273\200h\336\370L\f38\364\274r\210Z\317\267h\336c\350\312rx\336\003\241|4\243\336N\236\357\267\036^\317\305F\351\253n\370(\013\265\024\034\327\352\304\264P\273\363\024<{\030\264\332\f\262\363.\340\231*4I\205\246\222+KF\232H\222/\340$9s3IS\211\267\223m\246\310Q\275\236\213{\257\r\267@P\341J\007\335\f\273|\021\247\020\206\0317:\257u\344\334\315\267\226\271\t\327\224\363v\352\274\315\224%\324\257\347*\372\302Ff\363Q&\323\034\376\202:1\204\0314\231"
+	.string	"\300\341\277\254\314\033\024\350\007\207p\304\245\311\325|\2243h\271\305\364\230\f`"
+	.string	""
+	.string	"@\333,k%\360\320\220E\013\206\225\006\272\031r\025> ]\2249\377\245\235\205\033>\007\347m~\3037X\332\315\343t\271\371#4-bp\2205"
+	.ascii	"\214\0166\320z@++FV\007/"
+	.string	"\264\2628\310r\341\242E\317\006\375A\007\017\304\200\301\262\213'\030\034\274\320\212\341\301\013\027\026\270\320\202r\201\001\224\007\033\264\350"
+	.string	"\312\205\026\f\250\247 ~\361A\226\026T\214\027/\264\240\222]\215\325\265\243\333\023\027p\302\322\243\225|}\n\350\255\265\222\257J\002Mrg\255\344\203C\300\bso\t\365\323\232g\005\352\216\236\214\003|\360\177\tI\201\237\213\b\333\333C\215]q\007\333\243\261#\212\241\261=\217\246\301\227\204\n\346\212d\324\240\006\b\025Y!M\356\241P'\036\207\211?\3418\272\304\233\260\372\022of\365.\nvy|74p\2476f\022\020\324\226\364\216\024 6fV\303bg\251\021\360\321\023\224|\r34\337\325Yh\323\001\230N\303jg\241\275U\001>\332,\226|\030\013\2470\314\314\267\266c\302}\240j\266\346\307\340\241aW\r\335<\246\207\204\001\224\260\276\357\332\225]o \244\243\241\031\213\313\023\221W\306"
+	.ascii	"\340\305\3775\207G\375\227\237K./\221]\021\216\n5\316\r\261\227"
+	.ascii	"\030\033x\361\246qn\207Y<\330\252\204`\256\310-|m\326\3222u?"
+	.ascii	"i;&\023\035!\357\373\266\223\231\331\204Yg\327MC\257\215\n\366"
+	.ascii	"\\<%D\007\326G9\251\355\360\235\324V}\007'\364\031\230vP\230"
+	.ascii	"Q\242\264\315V\275\373#\260\232\002\224\266+\022?\270\266PK\365"
+	.ascii	"$\276\303\314\3060\247P={\305\313\333\222\fc)\202\370D\021Y\230"
+	.ascii	"\242\370'\025\346\237\231\037?\264\023\037\315\321[\355\324_"
+	.ascii	"\360e\352\331\037}&\362\254\364=y1R\202\257\267\332\021\357\023"
+	.ascii	"%R'\350W\272\255\372\211\234_\273\225\267\252&%|\355V\332HH\240"
+	.ascii	"\307\334\263\202\346X:\007J\345\362Dn0e\177T\177\354["
+	.string	"\266\234\261\275=\262\260k\371\243\301\366\276}\3540\360\240\361}\271:\215\265\260\354\316w\006\224\355\355\361*\371\036w\232;_\245\245\fW\324\033\361\017\330U\3353)g\246\372\232J\022\251^U~b#>\312Yz\253\225\372\227\346I};y1zS\251\250\277`\215ze^\325\335\003\262\030%b\205#\233\367\2640\377\376\250_!D4\340k3c\350\302\374\342\355\024\3617Y\240\230`\232Jl\362\252\360\036\032\272\247\020\nx\277\315\034\32323\3130e\360v\206\370\030\210\204UB\003\234\251\231\003\202q\250\022\3610\322\342\016!\232\021\221\024$I\2411\"\013\020\210bi\232\307\324\003\022@DEKt\316\\IA\222JZ\003,\323\223\021\217J\256R\231V\271\220\241\340\326)\032\260f\350\235`\242\231+\200\034)\206~\245\036R\211\301W3\b\2376m\202\330\203\350\031Na\2413'L\234"
+	.string	"\214\350y\177\027\231\234d_\270\250a_^\367\211\241^\231\274\2462\0038\250f\r\262l:\t6G\243\253\302t^\233$\322O\002\357\354\206\343\025^\366\001\354\021\243ux\357\350\332\2570\306= ]\254\215;\021\307B\205\360C]B\211\270\365Y\316\313d\237\037iq1\260\202k\031_\231"
+	.ascii	"R\253C\276^\355]\263\036\203\024\276*\332\203\271T\3454\353n"
+	.ascii	"~\252\365G\003\301"
+	.string	"\303t\017\255\274c/\351\322\032\344\346$6`b\226\335\324b\353x\200;z\310\354\203\302\177 \276m\241P x\254c\025\271\032\331\312\2567~\360t\200\356H\027\023\257\376\325\036\251\212\361`\277\\\223\b_4r\"\027 \306\306\f\224A\374L\206#\356b\236vb\377\002\025\242\033\344b\331Q\243\037S\250\327\216\016\004>\217\232C\001\315\327\032\205\\wR\\/\341\364\333\374\244y$O\004\317\367\237\336|\354%\323\\\264GH)LLl\213\3343\302\357\376\031kX\375(y\362\006\343v\350\315F{\346\215\243sr\027\027\036[+-x=\240\356vR\00313\344\276L\244O\263\b,\262\002\231\2601\223\rZ\016B\221\370W\371\001\303\030\262r\210\217\233+e\372)/\254j5\001\b9\362\233 \3220\371\243\235\323u;s\203\241&\033k9\306\341-;\2508`#\324\230\020L?\356\354"
+	.ascii	"\252\034\030\201\250\377\355\372\341\020\033\334k1\"\035\361"
+	.ascii	"\"y\276,\025\216\002y\221\034\354s\234\004$\207~\363\252\031"
+	.ascii	" C\0200z\262\245T\033\341A\034\224)\203\013\354|\244\346\347"
+	.ascii	"B\037\177\213\327e\023\342_\276*D\202\360@\3627\301\344\222\240"
+	.ascii	"tH\034\006\314\226z=\002\250\224\231\n\303\026\354x.(\202\233"
+	.ascii	"\350>\307\3516-\377b\323A4\322\274PC:6\202\351\030\004\274\013"
+	.ascii	"\006\216\247\326\026P\343\211\202\004\351\023\374\274\364&(\333"
+	.ascii	"\204\036!\377\224\020\353W\326\016\013\204\346a4\205\351\223"
+	.ascii	"t\315\225%\373!3\235X0\202\370\r0\377\353\373\0253,\003\235\206"
+	.ascii	"\247`\224\270\240P\370\021$\336>*|R&G\366]r\334\202\206\031\\"
+	.ascii	"j\002\222\\!%n\322\270\323\315,8\360%\003=ZXo\007\260\031\bf"
+	.ascii	"\352\367\250{\353\327J\260H\305\364h\312x\235\254\372\205\372"
+	.ascii	"\320\312-\330H\332\226\033\205Z\372\3516H\257w\260\360\372\221"
+	.ascii	"\213^&\267\306\254\327(\021\024^\373\263\320\340D\375\264\035"
+	.ascii	"h\001\313\316k\243*\020A\201\\\331s\326\235\360\271\243k\342"
+	.ascii	"\2031K;\237\212\230\300l\335\371\007\372S\370+\276w\214\364\020"
+	.ascii	"s\356\304r\"$Y\350yA\270\025cj\321\231HM\324\341\002\376\232"
+	.ascii	"\"\032/\t\216\214\031\276\254Ss\013;\252TM\341/r\257\355\001"
+	.ascii	"\321R@\003@U\335\214\020\231\f\226\256[ \346\357\264'\346\024"
+	.ascii	"JG\242\224D\256\214\212\322\365\336%\242\324\001\225S\031\241"
+	.ascii	"\315Z\250\030g`\f\342j\003\237$\270\013\303=A\")P\302m\331\\"
+	.ascii	"\210\362R\321\261n\234;2|Z0\312\240D\242\222T'\251)\271\225\327"
+	.ascii	"\017\345\005\021\377\370y,\314\277\370\300W\021\256\362\276\315"
+	.ascii	"|\315\350\261\230\371T\343\036\300J\205\3650\314)|B\021K 2p\202"
+	.ascii	"T\035Z\021W\257b\323\244\240\016;\036Y\201\324\007\002-\001\204"
+	.ascii	"\037]\f\037\031-\r\252\026\202\241w\364\026x\211\312\025\330"
+	.ascii	"\307n<\331\325T\"{&k\370hZ\255\324\336\363\374\r9\332\325\375"
+	.ascii	"e\375L\323s\b)\331\335\310\220p\020\245p\267s\005\207\316[\355"
+	.ascii	"\312\273\"\177%cB\325u\225S\013h\316\326\232\\\021he\005\035"
+	.ascii	"\225\214\355\035\016Ng\b\275I\234*\2272X\\z\255\b\032\364:\365"
+	.ascii	"2<Q\r\360V\027\237J\322\224'G\253\305\267v\f,\320\342\030\271"
+	.ascii	"\325xW\342\360\276h\225A\201\344\213\2729c\236\225\363\032\243"
+	.ascii	"h\001"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.96.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\r\r"
+	.string	"\026\233\\B \217\223\016\313\370+\230T\246 \312"
+	.string	"\276\242\234v\373G)\004\200O\\\372X\244\033\260m|\335\372\r\365\362\344\330\302\027\311\237k\024(\300"
+	.string	"\300L\036\021\237\203=\022\001#%l\207\020\262\367\2262\245I"
+	.string	"H"
+	.string	"G"
+	.string	"\001\362\233\230O\t\371\332\305`\302ew3\314\261\016m\373 \036\002\344\320\3438\224\"\212\005\022\223\314\356b\004. \036\276o\342\241nx\350\031\362\277\362\367\002\346\004\251$\362\254\026\354\256\223T*\271\365\266\013\330\336\260_!?\324\264j:_\372"
+	.string	"4\032R\314tP\273\024\272\231U\001_<\374t\373&\037ur\352[\262\237\300\002\345\202\213\335\345\034\372\200u\026[sx\033dklk\332\347.\002t\025\t\206\273&-\\v\271\f\033\260\016\003\235V\212\240e\364a$;GUM\260\342\232z\222\030\242\354>/\241Y\273\273\341\2178\211\b~\207C{@\362\244C\037$\036^\217\372\006\005\314\213(;\233\023I\315`\377\355\356ZO.M[?\335\325U\376\370\224!\034\231m\f:\036\320\323\t\351x\3164<\017\264\355\363\241e\034\331\206e\016\260\217N\207\007\226m\036Lc\2005\b\r6\354\243i\033\246\341\366o\365\304\266/\375\312\037\f\023\221\216Xc\356T\264\364\322\263<[L\243\230J-U\220\032\311\2102\020"
+	.ascii	"2\241\251I\343\365\204\337xa\271\006\311\304\004\3105\212\372"
+	.ascii	"pPgf\265\001a\370f\257\253\024A\022\250\300\202\237\031M\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rcControlsInit.97.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\215\007"
+	.string	"\362\31645Po\322\001 /P\253\354z\b\300\231\201\207P]\334\374\212\252\316=\367\233%\210\323\231e\021w\214\276^XPU3\306\330\022\353\025`\340\316\264F\210\224)\005~\033\353\001FO\007>\205\027\335kp\035\316B\345^\264\334f\300\020\202!:\017\204\321i\264\375\264:J8\331>\nr\252\257}\244\302\367\260CE\371\025\346\224\2222\226k\352A(\343\223/\006H?\002c[\022\371\354JP\022\331,\024\363\224\366\004E>s\226B6\220b\266\206\245n\330\237VG\366\323\371\3643\002&)\234\225\335\213\027\227\335(\224\017\333\327\370\262U\256u\354K4B\244\226\335u\312\361\353y\371\007y@&\302\236\031\204\335uf\"\214[o\273\300\266\201m\222\n"
+	.ascii	"3\241\227\0378\310\034[\312\374\001\013]\303\021\206\360/\343"
+	.ascii	"\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`H\005\225\025"
+	.string	"\366\245\212H\240\224J:\224B/\t\321\361a\216\032\245\3429\016\205\252P\2232\033tI\376##8\201\227q\363\234c+\022\364\203\354\323\320\"\361\n\343E\234\270\361\343\306-\317\254UY\001\214"
+	.string	"F\\(X\203`7\2264Id\nu"
+	.string	"s"
+	.string	"{"
+	.ascii	"'\234\240\236D\004\201nF\376IPIKPLOLN \202%\200\337j\365\363"
+	.ascii	"\"$\260\217d\364\351\243\215=/\376~\205\364}\214\344\371\333"
+	.ascii	"\316\233\350\234\t\231\3635\022\347jW\373\302\032\353\365\217"
+	.string	"\2147O\243\261\371I\326|\b\027\213\305\"M\337\310x\252\231\213\361\372g#\377[K\231\363 \377\217U%\330\337?\020\027\273+\313\262,\320'\216\377Y\220\0022;\356-\363v\374\2417\205\207\336\332\241\277\204C\337\311\206>\234\206~\\\206\276\034\206\376\223\013}6\013}(\025\372n\024\372m\023\372Q$\364\347\220\372R\"\364\247@\350\323=\350\3279\350Si\320\267\302\240\267\\\320K\245\240_%Ao\025\202~\222\375?\226e\371\317\034\350+\331\243\3730\360\036F\377Q\364 D\0272\364\241\320\311\202^F\376\001:X\374(\223\350\241\334$\334\237YZ>\312M\325\207\362\210s\307.\342\020H9h\006\353\017e%\023\210\262R\335\2051\207\026D9D\335\261\313m\307\2172\317\334\234\267\026A\224c\316]\266\260+!\3121\346\222betC\224a\314\036\3120\365G\371\345\\\001rDT"
+	.ascii	")\277\324\255I\363z!C\271\345\\\0266\260\033D\224\003\234;\200"
+	.ascii	"(\347FDyiw\253\016n,G\332]Y\226e\221\013\367\214\\xsT!\216\372"
+	.ascii	"%\\\002C\253\031\312\333U\271\316\365\r\271j(/\215s\213\266\260"
+	.ascii	"l\316\215!f\335P\336\031u\201\247\r\032\312+\303<\333\334]\273"
+	.ascii	":\353QFa\356\021q\005\016\345)s\001\220i\025y\224\247j\016e)"
+	.ascii	"\241\016e)sO6\027\266C9\352\344Q\216\022\356X\275\332x(\233\250"
+	.ascii	"\333bV#\316G\331\251\356M\214K\250A\020\203\271\216\204\"\023"
+	.ascii	"\204\024\024$90\003!\3324\006\021\240$\246\220A\302\215h\020"
+	.ascii	"\t\344\003:5E\003\027\030\216\365\":\233?{1}\277\360\251\216"
+	.ascii	"S\360~d+\303F!\016\273\304\005\270\357\356\377\356\376\367\356"
+	.ascii	"\377\366\376\307\347G\343~\262\300\327zr\331\033\2409e2zG\333"
+	.ascii	":\036 _i\256\272\316H\234\267\345\006\025Wb\031Sf\\\006\f\243"
+	.ascii	"\331\033\337\260\362o#\356\346\264\272\232\361\377\001"
+	.text
+	.section	.gnu.lto_.refs.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\225\006"
+	.string	"\262\316,1`M\222\016\300D\321\200\2543\235\277\027"
+	.string	"0_\0012t\b\202 \b\002c\350\350W\261t\276\fd\213la\207\265\266\265F6i\204\220F\266L\001s\260"
+	.string	"\tp@ip\203\023\n(\ffpa\200\372i\001z\331\227^\214\327{\221\275\026\371\255\260|)*\275\023\225\257D\n\312\211\373MJHFDB\246\037D\372?<\336\337\301\361\372\033\331\327\310?C\372\210\327!\336?\344;D\275!z\006\351;Q_\350+\270\236\360:B\366\203\354\006\371\231|\214{\332#\033\352\274i\257aoY?\265\217\330\273\366\215\375Z?\320L}\325\210\367\313\t\f"
+	.ascii	" \004\304E\211\252*n\251`A\205\200\270 <\210jd\006sE\3156pY"
+	.text
+	.section	.gnu.lto_.decls.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"(\265/\375`\2756E\354"
+	.string	"jq1RW \fQ:\215\001\024ttk\336w\214\316[\212\216c\204\203b\310/\333\225\331\206\237<\301\327\022\007\030\3064\253Ufw\"\354\336c5AZb[O$\023p`\232\357\227q"
+	.string	"x\313p3\370\221\313HP\304\026\377^\214dO1]\317\020\t\325\266\266\245\2242\005Z\0046\005P\005Qn\314{\246\317\305\026;82\027-G\271\263\217\342T0q\223\223\027&\020\266\321"
+	.string	"0\262\016\370\b\206\272l\367\355\006\004\302\270\330\205a\244\213\226\223\367\246\"\303\207\217\3341\027\355\276Im\345\035\007=\230c\250x8\344\0308\236\334(\240\263\006e\322\343-\264\017\354M\006\354\352k\201\2075\306\001t\234C"
+	.ascii	"M\326\322\260\006\376\366\322\377\260\244\3779I\377S\222\376"
+	.ascii	"W#\305W\032F\025\255\035X\377G\225\376\227\224\036\005\223\036"
+	.ascii	"\215\222\036]\222\036\025K\217v\245G\271\322\243Y\351\321\251"
+	.ascii	"\364\350\212\364\032Lz\335\226^\223\245\327<\322k\254\364:*\275"
+	.ascii	"F\221>\337\245<+0\213\373\344\301LpG-f`\375\254%5\301\356\273"
+	.ascii	"<\277g\267\364\231I\332\223}\244\317.\322\017\310\244\307q\351"
+	.ascii	"\311\222\244\307\\\351\331\260\213\3648)}\335\325K\177\347R\r"
+	.ascii	"|\367B\230\r)\222\232Y\330\236\336m.\205\230\301\372W\357\277"
+	.ascii	"_\256\335\315\273\313\275\221n\222\027\246\273\213w\237\031."
+	.ascii	"\230\213w\343\350\t\353_\267\264\004{\337\f\277\333\327w3\374"
+	.ascii	"\360\362^\370\025\240\013\320\257\227\234'!H\226`M\341V\340\222"
+	.ascii	"\001\030$\255\252\306\026,6]\266(\225X\277\203\025\034T\252l"
+	.ascii	"1\247\264\245(\220\350\260+\333\240\203\213\345.\271h\271\311"
+	.ascii	"\004*\321\342a\227\366d\307\r\223r\331r\214v6R\022\027s\357&"
+	.ascii	"\335\235\273r\267\356f\271qW\313}^,\367\355\367\312\205;n\356"
+	.ascii	"\215\264\367\376U\373\201~\261\\\267\313\226\233h\033\351\b\216"
+	.ascii	"\303\021\247Y\033\337\336M\016<\034\200N/+\322v\364\355\356\205"
+	.ascii	"_\316\315J\177_\244\277I\351E\220j(\246\032t \275k\027\312}n"
+	.ascii	"\270Q~\235\\\265\243F\315\335\304[f\312\216`}\021\351\357\206"
+	.ascii	"_\356\353\273\033~\017!\335\271\027~\030\355^\370]\263\313\344"
+	.ascii	">/\270gY9\246\203sF\310\0312X\337\001\351\377&\257\300hwp\236"
+	.ascii	"\364\367\202\337\355\273\027\374\236\246\177\273\027~\377%\273"
+	.ascii	"@\247\t\203)KI\222\037\212*\247\025\254\177\223\374\327y\221"
+	.ascii	"\374\f/\367f\262\367\306\220\246\32033\006\353\273\357\205\337"
+	.ascii	"\316\255\360\273c@\277G*\374\234\244\232[\247\001[Y`X\347[\341"
+	.ascii	"w\207\334\260+\226\227X,7\331\336M\n\300!P\260\310\260\276b\370"
+	.ascii	"\026\271\315_\261K\344\033t\360\033\244\035\266w\363\212\351"
+	.ascii	"\275\215\356\305 \347^\f\3205.\243#?}\234\276y/\374\322[\341"
+	.ascii	"\027c\3526\177N\342\021\243\371\263\tF\020\376\327\370_\022A"
+	.ascii	"0\020\\\244\200W\320\217\037\023u\375\230\305%|x\341\023=~\274"
+	.ascii	"\231?V\342\361c\025;~\314tYp],\035\3775\262\205a\344\3701\216"
+	.ascii	"\377\312\375w\001\033\376+\002|\303\206\211\377g\007\301\237"
+	.ascii	"C\\\020\376+\201\253u=\234\205\037\200\365c\020W\377\017\300"
+	.ascii	"\363\337\202\030\377\007\360\347\005\214\330\240\377\\\301\377"
+	.ascii	"\271\377r\377\261\374\247\373_\367\037\356\177\226\377\256\375"
+	.ascii	"O\377\314E\303\n/\201\377\325\300\1777\360c\234\377\371\327\027"
+	.ascii	"TQ)\340\307\031\374\230\303\217{~\214\200\037o\370\261\317\201"
+	.ascii	"\277\016\376\267\314\217\377\337\276\377\232\371\257\230\377"
+	.ascii	"\222\371\357\231\037\343\271\377\362\3757\314\214\377;\277N\376"
+	.ascii	"x\352\3071~\034\365\343\247\0377\375\230\351\307+~\214\342\307"
+	.ascii	"G?V\376\270\004?\036\301\217O\370\261\t?f\177\034\202\037\017"
+	.ascii	"\375\270\204\037\033\177\\\374\361\360\307\030\370q\005~\034"
+	.ascii	"\342\307!\374\030\002?n\300\217A\370\361\002~\374\363c\236\037"
+	.ascii	"\003\340\3079?F\177\234\377\013\345\277c\377\025\373/\330\177"
+	.ascii	"\277\376\013\344\277>\376\313\374/\327\177s\374\327\306\177\263"
+	.ascii	"\376k\365\337\252\377\322\370\357\324\177_\374\327\305\177\233"
+	.ascii	"\376\313\364\337\245\377\242\370\017\346\177\336\177\223\376"
+	.ascii	"\213\360\037\311\377\"\377=\372\357\376/\t\376{\302\177O\374"
+	.ascii	"\267\304\177\333\377&\377G\371o\t\377\345\300\177E\374\337\373"
+	.ascii	"\257\367\177\313\177-\377\225\374O\362\337\002\377\233\377I\370"
+	.ascii	"\337\366\037\247\257\257\257\357G\211\377M\005\377\001|\002g"
+	.ascii	"\322\347&\371\371\323d3T\324R\354\231`\213\225\020\254\263Y\252"
+	.ascii	"\204C\267\201F\313X\227l\226\227|`o$\314bJ\352\013\326\231,\227"
+	.ascii	"=/\311J\362\022\016\226{\033\345%:e\3666\322\271\027\203{1\320"
+	.ascii	"`X<\226\374\364q\340\322\214\004\3509\t\346A\326\326\2065\016"
+	.ascii	"\316\021#F\362\330u@\223\031v:\315\024M c(\334\217\035K~\204"
+	.ascii	"\205e1\032\003\250)q\234\224\214E\025y\026\303v8A\260\204\364"
+	.ascii	"\300:\023\301v7UWr|U\201\201]\266\236\245\221Q\001\202\\I\261"
+	.ascii	"\330\250\222\232\276\276.\032\317R\211\247A,\r=;\022\325\003"
+	.ascii	"\353\343 \375\270\317\374#\003\311{/c\364x\245\335pq\247#{\361"
+	.ascii	"\350(\3211DN/\375\315\025\037>.\332\035\333M5)\224sP|{\263e\240"
+	.ascii	"\263\007\204\306\026\326\277\361\342\301\274h\032\254=\331H\177"
+	.ascii	"\023\245\203\353\212i\rkV7+\322\333\230\301\221\265r\216\233"
+	.ascii	"\247\201\006s;\355\fn\003&\275\r]\r\255l\343\242\245\233\t4K"
+	.ascii	"\252\262\263qKo\243\206\205\225\263R\0365\253\013\352\302\262"
+	.ascii	"\356\005\007\016*\313\036b\365\373\314Vy)\001=\336\306P\241\\"
+	.ascii	"zM\312\255\252g\256\272z=\313\r\245\301\353\016\314\215oo\251"
+	.ascii	"\fp\2008\211q\205\365m\234h\374>3\215\254\004\264\267\221\f\r"
+	.ascii	"A\214\344`\241!\305nLTT\236\272R[\211\327C\344)\315b\245J\223"
+	.ascii	"\251,\243f\212\311d\b\3269\306M\037]\234X\226,U\223\366\342>"
+	.ascii	"\363\213\233\244\247\271]X\320\365$\225A\332\002\317\256\251"
+	.ascii	"\344\351)\273\030b\004X\326v\202\026\031\352\331\305\357\213"
+	.ascii	"\n(:\254\257w\331\376\323h\261.\251\032X\277\206+\375%rs\323"
+	.ascii	"37]1\236\255\274\323\240\207S3\203\327\310H\237U\344"
+	.string	"\025\317,\376\314,2\023\005\232\273\311\202\220;\036c\370\266\224T\217MX\231\026*Xg\246+v\263-\240\351\321\205\305b\356\367\267\215\234\366\336Phs;\035\335\374\242\367\366\37487_\002\354\235\201\007\232\333\250\312\217\274\264\353\314hJ\303>\372\2667\322\225\022\002WOHWQK\316\253\255D\332\241\244\340\264\257\224K\316\275)l$$%\210\345\246\260\344\334O;\t\356\351\356\346\225r#-7\205\215\264\2154,!]=-9\215\236(,9\257\236\266\363j\357l$#\247\024H\333\211\302v^\335m\347\362ig\311\271|Zr^m]\246\024;\302\240\250\374\320\372\272OKH\273\005\323\f#\247\235\267\245\346r\327\355}\311\224\266\023\001\366\236\261t\2523\212\272hGo-\216\230\030-o\223\351\bk\271\221\336\226~,\367\376q$\264\2318P6\3376\216\373\246\314\232\261Y(\355\035"
+	.ascii	"\246\275\225w\277\355\275\225{o\240\323\214\346\3362v\226\230"
+	.ascii	"LL"
+	.string	"{K\3610\355\031\3124\245\2751\231\026\264\247%'\326\022(-\211\223\271Q4\225\227\271\353\256\234R\247\322\310f\001&e>\271\300\303\272\331\264A\243*;\001\326\031\305rN\256\016H\232\223x\200\\M\240\330i\345#\023\360rL\221\221\215\372\362\306Q+|@a}\032\246\2762\330L\032'F\253\215\257\314\246\231\003C\203\f\217\021\003\324\303R6\205/\303M\333\334\222\215\245\007\3575\235\026\244\202\264h\303y4K\031G\214\324R|\207\361\356\023\203\271\036[6q\262\021\214*g=?\235\236\037\356\202\275\334\347\327\360\027\032\244\346v^\034Q\2248\314R\023\300\3735.[\326\314\2609\301Z\013\316r\237x\013\256\243\202\261\234a\245\300[\260\034\246\303Z\312\300\201C\r^\016\031?\3754HzLw\247\215\213\267,1\260\336"
+	.ascii	"\350x\356\367\365\304JLW\032\307\203cc\351U\205\365\323\251\364"
+	.ascii	"W\315\312\315\313A\367^\226a\356\275\341\360\333}\342+\330\355"
+	.ascii	"\270\355Rq\342+\270\312\315\273o7\266nb\366\331}\355\2759\360"
+	.ascii	"p\310b\234U\354\360\322\003\335\322\003\245\244\007:I5\236\""
+	.ascii	"%\233\235\021\221:\216\202\331\356\023K\301Pns\357f\20759\"\035"
+	.ascii	"\374@R\360\223,W\244\005\324\327\336M\036\016\034n\206\020YS"
+	.ascii	"\361\323\007\036I\017\344J\017\234R\243\3211\245)J\355\251\213"
+	.ascii	"\363\004Y\230N\030V\226R\3601\305\034\225aNA!\006\210\352\254"
+	.ascii	"\214\031\254\024*p\213\257/vaRU\2308I\351\242\215\241\"\243\315"
+	.ascii	".Mi\306\371\342\242\3251\265\226\340\037\330\f\003\301Fp\022"
+	.ascii	"\374\304LL\206\233\3403\274\004wa'\270\007\366\302i\030\tF\303"
+	.ascii	"Ap\031"
+	.string	"\376\302J\360\020<\206\3050\023\034\206\301\260\020\334\304NL\004\373\300E\356\023\037\301:\216\271\360\216\016fH\351\333\027\355\fP\026\3062c:i\2601\201\360\021|\003oe\2111\261Q\2152\270\252\213\366T\233\232\002\264l\302\304V\030\213\311\224\030T\260QWJ\300\246\020\347\226\025\224\232\035s\\X\313\f\344'\304\351#IU\013\030W\276\230\241\322`\030\216\352\356\r\245\241yD\225\205M\301\032\235B\247\362X\032\036\017*\276\266>\257+eb\304\320\3154\037<\250\266`\234\305\265\271p\201F\361,\225w\034X\271\"\203\307GEe\216\356\004G\243P\0306Tq;\302\260F_\350D\321\253B\343J\257\227\2210\364m\241\230\201>\241O\231)\r\314\355K\213\361bb\303\372\030\226\232\2322\323\0353\n\363\203\257\255\305Y\232\024\224\te\202\203\333\373\262\211Q%m\210\0234\005\232\002]\301"
+	.string	"#0yX\006\030\267\034\250\212\243+j\316(\335\231e\245\006Z\266vt\241Ih\022\212\242C\2179\250\032)*\317:T\351(\212\333w\005\t\025|\246\353*\tL\025z\204\036\345\261{\206\007\267\307\327\204B\221E\n\335\350F\225\026\272\234\2049\222T\006k\345\036\024\2522X\037"
+	.ascii	"*\316\234\031\203\333\303rf=\331+S&gu\301\301\355\221QYc\222"
+	.ascii	"\023#F\217\371\240+\215\305\213'?\364\2303^\334\254L9\323\323"
+	.ascii	"\323a:`\264\205\355\013w\325\335E\331\273\016\243qpy\261EL\005"
+	.ascii	"\224\032\025\326\277P\005\006L\036\223\202\247\345\007\337o\357"
+	.ascii	"j\r\n\336\227/\372.\315j\016\212/\203\245\230\253\262\273\276"
+	.ascii	"\303d\264t\351\242\351|\314\375\370B\243\220Dqa}\013=\266\374"
+	.ascii	"[\362\030\3172\177\271\202\333\263\"\"&K\026]\326\201\023%,/"
+	.ascii	"\251899M\347\265\354\263\343\243\300H\2139wM\227\253\344\350"
+	.ascii	"rV0S\273\216\242\246\343\362\334\315V\216\355&\340\331\224!l"
+	.ascii	"|{I\252\307\306\310\n#W\334\256\343\256\3416\350\340]\276\200"
+	.ascii	"\314\031a\255\257\\\277IUqbgE\277ui9\203\350H\257\200t\f\306"
+	.ascii	"\323\023\326\272\312\273\374G\027\026wXk*_\223\242\343\263\321"
+	.ascii	"v7\254\270#\2545\233\226r\237o\323S\236\343\004EY\233Vz\023\334"
+	.ascii	"\267\375\364\3325\024'TZW4\236,\231\233bb\375\nR\351+<5i\242"
+	.ascii	"\323\026\340\324g\367\245\363\224\007\203\t"
+	.string	"\355:\r\005\263u\327w6\303\312\210\357L?k\240\322v\344a\375\304u\331\313\005\025\245<3\263<\326\001\016\b\363K\017\241c:{S\242D\227\361\004\361\001\204\231\236\215\251\241\221]\227\241C\2344\243\320\260\366\270\234\361\030\033\323H\200\256|<\371\272\021\033\003G\304y\215\004G\017\311[\021}\344\347\326Tf\f\005\312\364Et\021\335\264 6\306\243''\256\206\212\025Z\354\272\251s\344\245\243\t\326\373O\203\363\325E.\306ZX\230\226\n%C\220\304\210\t\371\205h\260\273\243\346\215\314\216\013\016\237\025\325\023\033=\256\203\364\300\303\232\372-qs\001\205\265\366\322@~t\371\240\300$\343zy\237Z\206\346\321\323\205\347\370\270|\301z\007\216\334\036\035\022\254\2773&\325\241\2674\016\235C\337\270O\315\245k\\[\341\245_\033W\354\2475\325\002\212\0177]\311\310\222bb\305\320\\Z\353\242\345"
+	.string	"\265\232Z@\361\001\227"
+	.ascii	"\241\263\272\321\337\221K\277\343$\375NY\372\235\260\364;9\322"
+	.ascii	"\357\274H\321[\341\247\251t\025\215\031SyRZ*\003\271;\033\351"
+	.ascii	"\310-]b\004l\016N;]\303\320N\372\210\204\022M\034\026\027\r\016"
+	.ascii	"\025ZHX\353\023\350\027.4\224~\322a\242Q\\3i\024\272\305\b\037"
+	.ascii	"XZq\204\207\035\216\032\231\247\273f\263\346\356\f\231\023\254"
+	.ascii	"\365\n\315B\253\320)\364\222\016\217\364\327I:)+\361\354\354"
+	.ascii	"\215\305\207v\003\365\202H\324\024\3333\334}f6}\004t\264\215"
+	.ascii	"\300\022\020\304\bz\266%\205\023\326\332\bhD7'\005\353\353\264"
+	.ascii	"H\177\303\3442\035\027\273\272-v\\\262\027 V\354\262\344\271"
+	.ascii	"0-vb\310d\273\314w\337\244v6\322\223\317.\223\311[\352\314h\245"
+	.ascii	"\336\371L\036\223\313\344\276\373\314d\362\227\347\270\214\005"
+	.ascii	"(\223\311Z\262\330\351\344\rQ\022\265\243\345\336\305\202\243"
+	.ascii	"%\n\024\361\022&\213\271\317\314w\236\346\316|\371.\357\3357"
+	.ascii	"\251\346\206\262ir\027&/\003\007\034<,uS\277=\275\034&M\033`"
+	.ascii	"\260\316y@\251\250\266$/`R\275\25742\357b\023%\007\326\226\364"
+	.ascii	"9r\351s\330r\227T\316\216\206\233\223\3649\317\3649J\322\347"
+	.ascii	"\214\245\317\001K\237\343E\227\347P\347\224<\2679\034W\205\305"
+	.ascii	"Q\217\024\367\334\n\277l%_\321\001C\253a\366&B\016+fXk7\334\306"
+	.ascii	"\203\311T%\247nG\231\021*\250Y_^\f\254s[\252\224\203\265\241"
+	.ascii	"\206\306\263j\n\353\347\266?#\271eN\3503\023\006\353,\005\350"
+	.ascii	"y\212\215\033\024;1\254orV\244\277Bnv>\25793\224\036\251\355"
+	.ascii	"BC\220\264\031\031\244w_YVX7\221\366\336<6J5\310\360a\235\323"
+	.ascii	"\262Z~\362\323\320\250\261\210\3139J\237\235\324\334\200\343"
+	.ascii	"\362\302\032\347\263g\264\237\006\030\346\204T\026\254z\302\211"
+	.ascii	"\243\020)\034@\213\034\201\210L~@&\215\254Q\303\205|V\365X\304"
+	.ascii	"b\320\006m\324!\343\210V-\356\034\205\310\242\261\204Q\035\252"
+	.ascii	"\"\330\020&\326\237\013T6\204\032$d\217Fa\320\316\357B>?I#\206"
+	.ascii	"\037\262\350\304\332\376X#\016\261B\021"
+	.string	"i<\261\216\330\361\320\252\305\013\027\362\t\300*lI\260@T\374I\032-\020\005\325\241\244P\220\204\021&\200!\271\nI\\@\206P\217D\244P\350"
+	.ascii	"D\343\b;\254z\034\236\370@\302x\024~hU\022\206C!\006\244qm\331"
+	.ascii	"\037\225Xt\034\"\215?+[\364\003\200\343\261\b\211L\"\201m\360"
+	.ascii	"gB\022\t\f\022\252G\335\252"
+	.string	"\354\220:\364\023\266G\025\304\252\266\352P\322\303\211#\021\221\320\202\023A\3066)\002\021\351\241h\f*!d\177\206A\030\324\2431(\271\216\240\266B\021j\221\347B>?Dd\bl\bu-j\205j\320\316\205|\330a\206\0204\020b\304\007\017\301\020@\\\300\002\301\017\"\202$\204\240p\001C\206VeW\265\204\272\006-\260A\nR\023\204'n(\250\305`{\024Z\320@\341\202\005'\210\222\037*\264D?E\242!\262H\002\255\312\332 \2030\312\006o\332 \262H\204\"\213DY\250-\"\325\343O=\301\310j\226UW\"Q\b<A\224\034\352\265%\312\3079\261\266\254\261\250\212\bb \252\310\242\361(\004\022U\266H\263\300\013[!1X$\362\311Y\205BC\035$\032RG\210(\022\t\2405\"C\344\f\325c\220\n\242U\213\026tZa\313\326\264\025.\344S4\006\251C\306\026Y4"
+	.string	"\033\034\r|F\f\255\303U\307\006\310\247\025\252D\252\2106)B\222\210C\263\201\017k\001\020\303\325&\355\340\303\2565\354P\004\313\252\303\344J\204A\307\304*l\205 \206\353oHm\331\023$\\P\203;lQ+lI8\026\r\217\302!\006\"R84\224\3740\\i\214lr\004\"\017\310\020\352*\3140\264zH\216\240\340C\017kR\002l\tCcKB\021id3\300\032\001\360\241qU\221j1=\007\036(\300\203\017L"
+	.string	"\377\001\b\032\200\240\301\357\037\200"
+	.string	"\004\004\202\007@\351="
+	.ascii	"\312m[\002+\034\0214\254Q\203*\221\252\222\270Q\203lQx\224\200"
+	.ascii	"z$!d\215 ,\264j\220\030\302D\222\004\260\rn\320\241\310\004\341"
+	.ascii	"\232\203Tb\260\305p!\237U=\252\303\241\360\207]\223,Re\t@\204"
+	.ascii	"\262Av\310\270\216\030\201\210\364P\341xL\256\232U\213\216\302"
+	.ascii	"\022\277\"\3228\264\ns\206Va\260eWcP\020\231\f\036\205\303`r"
+	.ascii	"=Q\274pBxT\211\301\241U\310\032\211\024.\344cb\375)\022U0\261"
+	.ascii	"\326\020\t\207\206+\272\252Dc\211\344JDTM\254G\241qUY\n&\324"
+	.ascii	"#Q\021\210\240\243P\250F%\032\327U-\221\f\"\215\032\332 \260"
+	.ascii	"(\034\2214\006\213EG\"\036\n\255\312\252+\021i$\021l\205lp\250"
+	.ascii	"h"
+	.string	"mKP\211\330\nn\324\243pX\323\256j\t\244q\270\022\215C(\3228\224\2260T\205\206&\204C\251\016\373\341(,\201L\032[\3411I\264\252-2\304p\305\300\252\352ZTA\250\307\"\322\303\220\360C\t\242 \n\210\307\244\020\253\256B#\324v\350A%&-\260\032\205<H\343Pe\213\202&V\233\243\212D\n\205\206A\023E\302\240\t\341\220\016\273&\327U\275\360kU6((iC!CPP\262-\032\n\2005\232\020\006\213E$Tb[D\2044bP\211N\264A\265\204\261\025\2260\256*\321\2025\331\016\205A\301d[$\f\026\221F\2416\231\034b\203\303\225\207\2304\256*Q0\210\350\030T\207\204kPp\270\262A#\313\256\031\210\306`kD\026\341lp4\261\262:-+\f\n\022\213\204$\202l\021\t6\007x!\013\236$R\327\2376\231\\\177l\330`\321\030\204L~"
+	.string	"\321\241\025*\032\217A;&$\2179:\304\016G\341\332\026\251H\032\365\330\266\311U\250\r\022;\020\221B\022D\241J\254`B\362h\323\006="
+	.string	"J\205\212F\241 \261Ck\0342\036o\332\340\007-\322X\004<\020\320\007\r\031\020a\002\351\320\207=&\327\026\231\034\006\207\353\3170\350\007i\024\016\375\fW\366\307\247\002b\007\225\230\034\n\022U\241ak4\201\3259&\223\021\b\242B\322r\320t\340\250\361\025\227\363&\326\207#\310e\373E%\2211\003\242\313\370\246\310\245\360\242C\327\314\2247~\334u\3510XGT\227*\037z\f\220\312\213\246\217\036\250\362\206\013L\314\023\023Ea\246\264$\217\007\272\"I\220-dX\357`\212"
+	.string	"\036\013-\256\254\0323;\334\370t\344\261\262\0307\260\266\320($TD\274\340\0347Ok\365x\016\301\032\265\201\3368\212\343(\016\214\342\310}}?\"X\224\374j,\3150\273J\202u3\354\246\251ik\231\325\304\271\003\333\323\201\245\221\350\324-\265X\004\204\205\250S\242\324\221X[rJ)ej\206d4I\032\003\023\025@P`T,\230J\264\236\017\023\200QJ4r\022F\231R\312\220\214H\020IRPP\310\260\033),0p7\206\3315\242\205N\362\356\230\322\347\003\214W/\0338\312`\275W\265\254\222\034L"
+	.ascii	">\330Oo\n\223\264\324\2561\214C\202\"U\321\350b\317\267\004)"
+	.ascii	"cH\267`\3560xWi\227\213\227\272-\332Z\004\317\215\365\206\205"
+	.ascii	"\2362\324%\243\2669\306\007\343~L\341\261\342%\251\312Be@\234"
+	.ascii	"A\225/\200\305\326\t\307\004\201i\361\222q\320\213l\267|\026"
+	.string	"9Y\021\020d3@*\007K|&m\036\327b\271g\201\275K\331\334\233j\314w&B\262\237aP(\034\021RGj\252\252G\341\030\311w~+\233$\240\0162\2228\267 \246\253\206!\234\311\034y$\2064X \311\320\327\005\206{\025J\314\204\263\363#\263\216S\005]A\036N^/\204Wp\352&\274\375M\337\023\307\237\357\202q1\346\340\317r\367|-\003\020LA\330\032\377=\320\216\317\006)\004 =\\\317\366\326\263\235<H\265\rp\022\215\227\205-\274\3061\234v\340\320j=\353\005\270\241\b\036\2432\026\311n\205\232\353\007\316uOk\3346\317m\274\361!\270C\021\365\324\266\")t\260\341\022\231\303\203\227\375\202\231\360\230\260w\223\212\241O\227u\300\367\307:\337\230\0272\022C\314\335\031\312\017\210/\264\261\334\223*\022\200\225\315\020G\006\025NI\205\371H\004f`\302\305\364\306\r\372"
+	.ascii	"\214\n[;z7\240\363;|\f\376\32082M\006\300d\031y\265\264\325\256"
+	.ascii	"\305T\374\214\270'&\340p\323\342W+\365\177\251\220\305sHys\\"
+	.ascii	"\264\347\330\365;\371\343\213\261qT\366\343] i3$\275\237\365"
+	.ascii	"i\036\017\343\336k\243\363\322'\035Z\313|\225\020\n2b\006\307"
+	.ascii	"=\344\002\262\317]\256s\262\017\375\035\254\362\016+\227\346"
+	.ascii	"\316x\366Rx\036\251A\211\3205\231#Ip\332\372\341\313/\311\221"
+	.ascii	"\036+=\326?\360\237!\013\024\337\245\276Z~1\202o\345\260+\217"
+	.ascii	"\340\251\017*\354\021\367\214\267pN\030V\376_\257OD9Pa\302\321"
+	.ascii	"\247\036m\254\333[*\260\277+tKe\225/:\301\b\331\264\352\361\344"
+	.ascii	"\016\t\301e\025u\214\217\337a4\324\001s^\321\021\314\030\272"
+	.ascii	"\347\3113\373\350E%\210\2306\302a\234^\003Y\245;:\216_\320\331"
+	.ascii	"\2573\f\262\327\255r\3356\005\226\033\377\266\bJ<70\230\236d"
+	.ascii	"\035\322\350\320 \300\243ob\255\202\303\345\317\256\303\007\365"
+	.ascii	"\241^\255\256\305\307\300\326]\215\376}\037K\224\301"
+	.ascii	"\034$WP\321>\366\220|SE\342\256\246\021\241\300\316\336*\"\247"
+	.ascii	"\024\030\362]\032\204\201\374*q9\033#\b\264\2000u\336\022\022"
+	.ascii	"52#b\272j\314~T\260\350\035\323.\371Q\301\257k:\337\341\225\\"
+	.ascii	"|vA\377\370JS@\267\\t\267\354\362\214\334\257d\276^h\303\243"
+	.ascii	"?\207T\354\245\365(\260\005\263\030Ld\240`Y\365\205\032\270\255"
+	.ascii	"\033\375X\024\351\273\371\231"
+	.string	"\370X\312\203\023\024\003\320\221\324\037>\230o\224Rh\031\331\240\026\242\031\200w8B\344\2663\367f\327\213}\216,\322\265V9\370\001T4\230\366\227\363*:\310\375\311\224\211\250B\264\250\036s\237\202\215\030n\034\035\346\271c\273d\320\227IhZ\"\346x\313\272\206\374I\344\332^\3430\271.\251W\332;Z\036\352Vu\320\311\245\265f[\201\020el\313k$\301\"\250/z1wAix\330\357\347\305$F\002\f^GQ\256\344\317\370\2654\350\n>Uc\0204T\201=\0332[\006\215,Y\253F\320\202\267'\226\013\356\\\327mk\016\216G\177d\201\253\225\237\371\fs\317\242\226\240\277\301Q\214\330\223\225p\300\275\bws\360\254V\377\220\025\034\367j\250\325\200]p\210\217U\330F\317\351v\321\301\365\231\206I\273\362t\267\237\2410\246\007\034\314\246\346\026\237\274\240\226^\235\b\364\277HFh"
+	.ascii	"N\222q\026\016\347Ky\220\253E \233\023\234\305\n;\304\275@!("
+	.ascii	"\r\344\364\272\243\003)\331\243 \225\243\265-\021\027;8J\323"
+	.ascii	"_\246\305[\276{\330\002\246\366z\330h\341\026\230\340\027DT\016"
+	.ascii	"\036\307\370\3515\221\375\030\020@\212\326TT\312\0258q\373\303"
+	.string	"u0\306\2729\300\351N\034\270[\035\306P1e\370 #P\357(\375\003sc\307\f\201\377g\306\212\2133G\3701\370\024\320\256v4\305ed\345\004\005#%\005\220\313Vz\357n\262\221\270\350\025V6H\tg\004\002\023\313\343\013j`\314\017\024\333\335\246\302\273W\347N\371+_\217\234\004P\306%\236\244e,\004(b \f\367\2359&\316\3753\273\277\351\203\227\334\356\246\334\227\032X\217o\234\224X\277\021x\311\373\001\312{r\022\017\034;\332G\320\364\226\\-|\375\037G9\351\353\337pq\023+qXl\024\003A\315\002?\240ct\177\206)Y\355@\3644\024\340hrn0=\2251\225\354O5\354/\224\330\354R\242\202\201\276\201\261\0304\\\332F\"Wb\206\256@^JLn^\3339#F\240s\2715\333y\266+\2263 \001\200P`! \277\200@\256\023\327\344K\001\212\211\214"
+	.string	"LL\251\315b\b\331\226\231\367\245\341{\332\221\337\232S\336<C\017\217\244M?\273\326\025t\266\302g\214l\342m\344\353\212\216E\373;4\220\273g\254F\364\033\374\256\360s\242(\177Z\200\005,\257\222\b!\2650\r\237\2239\315oB\262\205\213\216\260Pi\271\024\020\027\221\215\325\302Hx\004\347t\362\325>&\201\313}\220\rKd\262:\202\265\370\234\320\221\320\357\205\027Z\002Uw,\022\216\302\265\324\302*\312\260\017rJ\231\202A(\307\265e\177\351C\2015M\203\203\215i\371\314\021\0030g \024/\244g]\233\352\255`$7\2553D!\227\270Jm\346\210\021\316h5\367\330\353\030\271\\`[\267\3719\243\301\031f\214\361K<?\206\204\373\367"
+	.string	"\001\274@\236\r:)\310\006\375d\206`A\330\326\342\260\002/\254N\346\202\377wz\203\241&\201\203;\25430)&]\007c\213\"\237\261Cr\252U9zU\310\250\246Q\254\315%\361\326*\202\361oA\231G\300\026\217\017\272\215\006<\333DU\274\310\201\347\027\r\356\002\332\263\214.n\310\"1d\303f\237]=\3342@\236W\274\212\343\370y+\303\237\bJ\376\004zp\264`Ml)^& \355\252Md\023\262g5\007\221\247\036\217\234\315IYRL\234\"\331~\333\354\201;k\261\244Ro\315\177\321d\224D\002\265\366\370t=\366>\211\210\244T\277\004\226@\205\230\272&\314\324\267\r\333%\277\360\312D\227\f\200I\305\336u\234\tW\332\211\327\270\022jO\352\023\037\357\353\325b\323#\323\263\322\256-\027~6V\223\231_\356\260@9\306O\201d\206\2208\b\347\222\365\242\324I"
+	.string	"E-C\254Q\325\363\345\215\250\210U\332\001\267\322\025\021\r\311h\3159\265@\331\207\\\005\356\006\024\032\323AI\024k\307"
+	.string	"I!l2Q\257\264cI\345\334\3720q3\223\032\330I\034<\341\221\263\362R\202\2779\004\336\177\366\351\224\026W]\003+N\213\312%\206\355]H\3235_\027\315B$}\317/\220r\025\334Sk^\326\314\340\240\004\032\311\r\204\372\372\225\256W"
+	.string	"\202E\261\024\341]\321\341\030("
+	.string	"\347.@\320p\fA\212\350\204\013eZ\007w\352\241\307\224\373$\320\177\374\034\260\003\253S\266\222\306\246x\226#\307u^\f\0356/z3\231N\335\316\016\300\035\312x\021\323/\312\247\201\261\300\254\375\330\037\214\237*\352s]\222x\375o\203C\023t{"
+	.string	"ixo5\3573\301\223\031\236\320\350/lb\361\365j\212+\352\271\310\036\231\177\344\232\251h\243\376{]\0035\266+\177'{\233\3043\345W\021\337\324o\023\030\246\030\277\341\277\343\263\367\211\007\275\207\346\226\317\307\217\314t\262\375\314\314}lO\303\3640\315\343Y\305\002w\354\226M\3076!\267\250\257\003\267\321g\234m\240\354\"\351"
+	.string	"D\343\231\304S\022ot\206hg\211|\221\034\244\234!\271\220~"
+	.ascii	":\341\273\344\032a\226v~\262\370\340\316i\376\367\214\312\370"
+	.ascii	"-So\205\2336\013\210g\375[\177o\177\321O#\027\313\217\231\234"
+	.ascii	"\217Zq\007B\252\256"
+	.text
+	.section	.gnu.lto_.symtab.1f8c34e2dbdf12c9,"e",@progbits
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"flight3DConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"resetTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"resetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"isTryingToArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1f8c34e2dbdf12c9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
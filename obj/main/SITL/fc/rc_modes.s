@@ -0,0 +1,1003 @@
+	.file	"rc_modes.c"
+	.section	.gnu.lto_.profile.3a37968579003349,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\375\007"
+	.string	"D\013\217\001"
+	.string	"\030"
+	.string	"\326\363\316\r\002\002"
+	.string	"\002\001\001\276\264\256\247\t"
+	.string	"\002\240\342\234\212\n\003\365\203\345\270\t\004\002\003\002\003\004\350\300\306\254\005\002\002\004\002\004\005\006\226\336\200\374\002\006\002\005\007\002\b\b\203\200\211\346\n\f\t\t\234\315\220\335\004\f\002\005\002\001\n\013\203\357\265\324\b\006\f\203\236\236\216\006$\002\005\002\n\002\001\006\007\002\b\002\013\002\013\004\002\004\002\r\016\017\352\263\360\321\b\020\021\022\246\213\347\204\013\b\023\240\377\330\335\001\004\024\262\270\337\265\r\b\002\f\002\f\r\025\230\311\247\340\005"
+	.string	"\026\206\375\263\365\n\024\016\002\016\027\317\247\261\273\007\030\240\342\234\212\n"
+	.ascii	"\" \200\202bU7\300\200\214\205KP\0240\001 t\265\317%\\\217%F"
+	.ascii	"\223\001j\031\357\236\315\262\334\272\313`\222P\314\0030>\326"
+	.ascii	"|\225\375\022\002\232L\303=C\"d\270/\307\316\263\203\363\205"
+	.ascii	"\206;\206\244\202@\212\342\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"}\005"
+	.string	"2H\025\031\200\265I\007\253\2660A\0234A\023"
+	.ascii	"\217\217\037\t\361\275\2215\273\267L)\256n\"\001\230h\210\375"
+	.ascii	"`\240\302\233\030\272\240\300\272\265\224YB\214\211\362\334\313"
+	.ascii	"+-C\306\316\377\026#l\006Y\033\346l\244\235=MG\217h)\357\303"
+	.ascii	"\343Q\347\322\r\366\024x@' p\002!+>\321\b\314\013Z&R\\\246O;"
+	.ascii	"\257\271\225\201\001f\200b'\001\001\216\201 [b\037\303\b\272"
+	.ascii	"\021\315\307\206W\022\006\\\024]\030+-\215\224\246H\210\224\336"
+	.ascii	"\002\243\313\206\223a\243\361R\333\307\206\327\330\360GX\374"
+	.ascii	"O\004\322\274<Z\007\001\027\300\r"
+	.text
+	.section	.gnu.lto_.inline.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\302\003\325\021"
+	.string	"\006XWD"
+	.string	"\223\223\306\200\263z\255\020\360E\"T,\346\226}\246\234\252\023\r\203c\214\346\330w7Pn\227\317\2774G\250\034\261_P\210\302\027\251BTUU\325\362\007=ml\237\362O\202\320\377\266\021![\312\235\0026"
+	.string	"B"
+	.string	"O"
+	.string	"\333u\237\216\317\226\246\242]\024\365\241I\365.\022\177\035\036\332\016m\372{\366\343\332"
+	.string	"\256\253H\347\234\323\372\tsN\n\037\177\037Q8\034\236l\315\234\363\343\257\243\211+l\234p\031\371\3703\205\233\002f\032a\177\270\300\312T\302\306\341\003=\205 \201\301\300\022[S\017'\365!\356Y\256i\367\335\274\250V\271\306\265\365pR \252\375n<\036\227\374I\024\276\004\240\020\006p\2647<\234L#\322\256\304`a9\207"
+	.string	"\317rr\304\312\214\222\245\322};@\207\204\350U\311\255\320b\303\242\363'\273!&e\346\200U\262\342\240Q\201\"\301\235(#\203\225\321@\223\322K\326\026%\323B\206\034\303`\274\224f:o\242\001/\215\224\226\016\001\204\315P\342\\\b`\240_\007z\232s\202\034\340\030\353I*B\345eS@\322\0225\\\324\f\370s\301z\224\265\361P0 \224\355\341\241`\2563\013\312\301\224\303\025\030i\007S\016\367\231dU$\036\332\340U\035e\250\301\2552BB\001\211Q\n\031\306`\2422U\347\001\0210)CJ!)\0311(H\251\003\367\203'J\r\347F\277\312\270\340\267\201-\257\324\352\250}\275\3518\233\323\243\201C]\006\017\017%\n\273\371g\236\226\331:w`\300\244Q\253\203"
+	.ascii	"p\302\257\352\202k\203hwl\240\244pxw\023\335\220\r\312\203p\206"
+	.ascii	"\336\347\2634\005\301r\372\210\273\204@\2324\214L\350\020h\264"
+	.ascii	"\"\323\206\t\306\255\376\205/\025\021\003\361;\272p\202\203\217"
+	.ascii	"V3\241\256\025\253\202_\341q\366\274\3058\023\320\202\277~ \r"
+	.ascii	"~7\232Lt![]\202b%M\"\261\017\303\257\205\0321wP\352\221j\366"
+	.ascii	"\306:\002\260%U\030\177\030\347\222\375I\271S\004%Ow\364e\n\342"
+	.ascii	"i>g\265\271N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\031\005]\013"
+	.string	"\302M&&\220'I\007\177}\362]@\257\266\273\273\245s"
+	.string	"\244\360_\313w\347\252p8e-aG7\"lDn\261\267L;f6\256d\245\204\024\257\373\007|\023I\202\220\2038U\367\207\027f\334\264X\\\220E\211\f\332'd\314\306\220M\246\212\242l\220\255\235\363A\326\004\362\332k\017\2637\n\237\260\2427\343?\200\216+\254BDT]\357z\r\377h\262v\250B\276i\206W\273?\205\352F~#\273!$zxz\177C\226eYV\305e\343\332^!^\217\257\021X\016\004Z\250\241Y1!IA\251\320\034\220\"\241\243\262\003\022"
+	.string	"\002\"\212\342I\022)B\024Q\204\002\tHB\021\241$)H\2061\300X\207\247-\357\277\332\023s"
+	.string	"\356]~\211jB\004*\257\334^P\242`m\314\263\312[^jAm\250\267\201_\335\355#\225\321\212\325qU\200\245?\305\001#\217L\022,\006.w\037\t\024\231\252-\326N6\n-\252\224\223DHR\232\215\334a^\376\325<\"\326\351\256\256o\230\236M\250\021\373\336!#\020\253\226\3556\355QTB\351\250\313H\265\377\025\275\215\"\276Z\006\313e\325\007\244\\ZR\222u\302\b\226\252Lh\001\017\247\3361\001\365\002\202\001"
+	.string	"\"%r\244\2623E\001\023L\320\300\374"
+	.ascii	"\230\273Q"
+	.text
+	.section	.gnu.lto_.pureconst.3a37968579003349,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\231\004\001\230\004\003\231\004\004\204\004\006\205\004\b\231"
+	.ascii	"\004\t\231\004\013\231\004\f\231\004\022\205\004\023\205\004"
+	.ascii	"\024\232\004\025\204\004\026\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\r\007"
+	.string	"\022\311\037*\220\265\031\016\340\257\007\337\035'\243XUu\304\335a\273]\007\302e\343\311\331\266\r\375\366\257\276\265q'e\343\267\233,\2212\005S\025UY\222fJ\300\002X&\226I\345R\247k#`\00138P\270\n2\306\204\214 \327<.\230\001^\t\327L \026\336\3324\225H9\274H\273c\020\032\244\374\321\247=IG\373/\257ye\036*\r\357\367\224T\236\246\347\\Q\356\312\250;;O\202* @\002e\n\311\007S\310\225\345n\334\020\r\n\006\360bHm\314H\253\235Ij\030WP9\030wwa\365\213\316\033\330[\347e\315\334\235\324\260RS\016\021iq\277\323\260\274\245a\301\340\350\n\346\003k\236\257\"t\030\340\211!\216=\204\262\306,\200\235q\020\220\021kt\225h\363"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.3a37968579003349,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.45.3a37968579003349,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007]"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\355\017yw\250\376\006yu"
+	.string	"\005\001\006'\001\300\002\005\001\006\035\001\024\251\300"
+	.string	"8sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.string	"C\210\021\346\r\317$y"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.46.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"e\b"
+	.string	"\266\020=80q\323\001\200B\207\220\274\260\270\022N\273\257\365p:U\227\006Lo&\370o\224\020\267\021\030\312\347h\246~)0\3504\264f\377\307\301\307\243\316x\215\331\336d\313\224\002,"
+	.string	"-"
+	.string	")"
+	.string	"\266\275\300\320\331+@\305\233\034\017\027\234\335p\306\222{W\317\377\352\b05`\352\273z\034v\327\n\246@\356x\333\t\266E\266c\002W\031\360B@\263\373\261\243\2636r\006\305vg\203l\253\332O\271Jw\025\207\001vEV2\273\241\310\n\237\313\320\007\256K\353\002\327e&\273\247\203\376\312Y.\374\223Ko\234\036\274\364\271\353\322\316\330\320\203V\f\241\342g\207\237F\022\373\326\356\256\343\210\255\253\036\244\007\215LB\032\033m%Rf\202\300\264\211M\314\n\212\b\323\304\264m\216\f\234Y\224\264\211\221e\332\004\205{[\261!\344\024;\374Q\215\017\337\302\035\004\007"
+	.ascii	"2\003\302\260\241\0137r\031\025\322\030M\034\"v\256\371\004"
+	.text
+	.section	.gnu.lto_rcModeUpdate.47.3a37968579003349,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\325\007"
+	.string	"b\31777@o\323\001\233NL\r\024\007o\032\264\2261\337\250\n\305{\210;\317 \302o\032\206\363hxPL\240Y/!\230\017a=\352\262\373\345\312\036\375\017\311\322&{\247\024\227\326\321 ,\256\217\345\312\001]\022\230'\242f\264N\320\017E\307Ck\006\242\234\003c\025WF5\f\313\350\346\333S+=?|\234F2\303>x\021B()\371\340UB~\311\030[|\367\351o\325\247\026\302\302!2\212\241\375\211\242\034\261O\355\356Zz\366M\177\244\032@\n\302\335\216PfO\363\305dc\373\321\376\311Q\270\233\266\013\354z-.\273\337\202\025\254O\177'\250>\255\017T\237\346l\030\003\215\200\231\215\225\230\335\245\222\344\334#\347?\345"
+	.string	"\035I\364\250q\330]\307\216\344q\313\333N\260\315`\033\f\t"
+	.ascii	"2C\363\f\f\217J\226\t\204`\310%\330f5%\334\341E;\311"
+	.text
+	.section	.gnu.lto_airmodeIsEnabled.48.3a37968579003349,"e",@progbits
+	.string	"(\265/\375 \344]\006"
+	.string	"\342K,3Pm\222\016$\243\212\253IsK\335\255\243@v\013%\262\372\317\320\305\262\265\273\035\236\336y\267@\374Z\231\231A4]\274\314\017d\247\016\215\321\332\3362\005S\226\314\245\241\302,PV\243\034\032\304\003\003\246QV\246Y\006\256\".V\223\250*\253U\262,\212\016\t:H\361\005i\310u9\236\320\\\261NW\003\320\351P \324\271\321g\234\303\214\257\224(\372\357\303\002\213\226\230d~F)I2\215t\374\233\257\214\220\260\371j\266\361)\206\247B\004%3k\250\321\253w\335~T\362\b\235` N/@!3?\ft\321\261\277\301\177\360{\002\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_isRangeActive.49.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\241\002\225\025"
+	.string	"V\351\216J\300\322Q:s\020\360\335+\t\205\003\200\366\016\036\221\003Pu\213\300\0220\242\214\203\375\021<\353!J\210\f\332\207\243\205\340\254\204\222\206ey\212\221EQ\024\"3\351dlp\022f\223~\346\377\223\330\256T\2254BH\2222\005}"
+	.string	"m"
+	.string	"{"
+	.ascii	"\032\303F\2033\002\\S'\354\261\004\365E\352X\352\t\251\243\277"
+	.ascii	"\372S\343\317\371{Q4gp\201\017\224:\332v\203\025\033\3374\330"
+	.ascii	"\223\243;9\274\031Qs\006aG\2417U\221\243\370\275Y?\250J\203t"
+	.ascii	"|\322q\352\371H(9B\307\335\212,\037\b\221\300\234s\345\323\355"
+	.ascii	"E\004?$\021,_N|-\355\364\320 \335\033\037oW\3252\347\364\366"
+	.ascii	"|!\324\245\332\266\261\375\300^\035\001Jco\240\3111*\243V\316"
+	.ascii	"\251s`\025N\330P\252\320\321:C\352\250O\201\243\364\203\001\204"
+	.ascii	"\333\241\035\314\355\201"
+	.string	"\266\212\363<~y\215\242?\252'\032T\005\360\265\313\353\326\327\254\257M\276.\371z\3655\311\327#_\227_\253\276&\311\365\370\265\370\365\307\365\216k\rP\300\004\217(\005\307\2349C\"Si4Za{e[\\[\201\002\332#\005\244H<\320\257\223\\\203t\365C\210\264\372\353\336^\220\334\310I\376\243\335/\245\374\310I\037;\037}y\037\035'\225N\365\325\311'W\013\362\252{wB\306\223\027w\360\246p;\364\2407d\345\234\223\305ZCm\314\374\002\263\332\203!u\034\277\322d\204\333\241E\365\021\371\213\327\335/\267C\237\374g\0204\224\343!4\2659\206,\235\370\201\336\353+\b\223t+e\033C\263\027Z\3146\322\314\\h\0222\314h\264\330\005\b4\035b-\313Tdf.\265\030\n2\033Lf\001F\203\211\305\300d6\031\230J\212k\032f6\030\207Z\315\006[\005q*\316\363x"
+	.string	"S\t\036\021\211\022\201IG\210h\2557\262\345\326\335\202{Nu\240wL\240+*P\327ol\327Q\256<\222<P,\342\242'j<\017\35358P\302$%R\223\263tHKnr\362h\347\263/\271\262\320\201\342i0 @\002B\220\223v\265\241\245\025\350\225\360\306\300\027\3576\366\326H\021\256iL\363h\213g\371Gq\216\353E\234\001\302k\t\276x\f\026I\023\006\306\311\214\350cG\244\301\223(e`\347\340\315\341u\306r\3504\f\332\342V\212)"
+	.ascii	"\204)\213\316\nYx^-|s\270RcF\017\202qF\026\037a9*\266w\003\312"
+	.ascii	"i]\232d\341*\264\353\265|\017"
+	.text
+	.section	.gnu.lto_updateMasksForMac.50.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`.\003\355\025"
+	.string	"f'\215J\300RN:R*o\345\205\213\370\343\200\341OT\330\320\3241Dn\257\230\374\231\2731(P"
+	.string	"qZ\302RUm\275?\376\314X\277~\375\336\311m\033.\265m\004\254\311\nn\245\377\022\340\373\237\261/J\313\226\020B\210\334)\005y"
+	.string	"o"
+	.string	"x"
+	.string	"\037\031/Zg_\375,\252\007&\3518e\325ZgKt\335]%9\212\341R\235O\2628\335\3453ww\035\347\367\022\311\312\007\210\222& ~~\037\255|~/\263\003\025C\330\226\216\r\021S'L\351e\005\275\314\036\r\377t\023$\237_x\240\326*b\362\350\206$=%|\"fN\210"
+	.string	"k\352\307\235N=\230<JI\226Z\253\251\317\374\271\001\334\366\b\333\020\354U\tA\357\220\375\246\177\344L\177\354\347\037\362\245\037&R\273D\352R\244&G\352q\251C\221z\227\232\212\324\027\260\"\225\345\243@\217Z{\202@j\225\330\342\310\366\355?\331\257\277l\207\324^\320@\367&\233\237\006\204\316\244\030\016\230\242\030\320\223\303\200"
+	.string	"\225\007\fJpj?\351J\272/\335\\V\353\220\226T\255\247\002\237\224\027}\236d\274X\0067\264\214\0054\0014\216\354\t\217\021}\021d\006\222x\3338n\t\017\221]\273\224m\334?\235\036\355"
+	.ascii	"\021R\362\0321A\301\b\037\365p\351\325n,\334\247`\261{(\035\177"
+	.ascii	"\321\026\226\324\332f\244\353\002\334\301\243[\206\321o\310\332"
+	.ascii	"12\364>\272)\037z\273\263}\373\n\\Y+O\305W\001\223\241$q3^\374"
+	.ascii	"J\330\311\022RZ\302\241A\373\334\321\ra\177\203\301`6\r15\265"
+	.ascii	"\007.\033l3\244\f\rm\302\313\f\215\254\321n\353\032\n\215\355"
+	.ascii	"\005wk\251\345f5\230\331L\f\3556\253\345hf(\004\214\303`\313"
+	.ascii	"\315jp\270\334\354u\326\207u\207\034\001E\025\316\346\204\265"
+	.ascii	"\326\352\"\241\261\205\255]\301\302\235\316\322\333]\tT\016\215"
+	.ascii	"\262\206\214\2726dE\206k]S9\264l* \017\021\244\214\226\033[\373"
+	.ascii	"\002U\271/\023\307\t\031%[h\364>Sp\201#\367e\006> \300\002\021"
+	.ascii	"!\254\0076*pV\350\006\211\001s\024\257\364lD\3532\357\013j\311"
+	.ascii	"\254\360\243\210\305M\310\022\327Qz\276\316\335\325\310\022\262"
+	.ascii	"\033\025l\306B\r\227\372b)*W\177\265\200(\313\t\3770\224/\367"
+	.ascii	"\306\264P\336\222\221E\250\342b\244\nf@\260!\342e\0017\f\226"
+	.ascii	"\213\202\r\315\211\035\036oo\311bqN`\226\210\021\0010J\351\021"
+	.ascii	"r6\026\306\313\020C\002AV\203\217b|\306\n\257\203\267\324\f"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.51.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\324\001E\020"
+	.string	"\266\236lF"
+	.string	"\223\223\016X\332\245\216\362J\235R\255\357\236t\360\364\241\246A\373\317\223\351\233\005b3I\201faw\353\355Y\022\b\3154\306"
+	.string	"^K\342\233TZ!\260\277h'D\023BY\3356Yvl B\310&R\246\024W"
+	.string	"Q"
+	.string	"^"
+	.string	"\254\227\b\2349C\006N\260]:<Iv\271}@vi\224\315\343\341\313\374\013G\210\032!sNnQ\034u\211\255\242\374\277.\362\201\251\313\255\345\030"
+	.ascii	"\260\345\213)\020s\202\214\200,\214\244\225\342\373\353:\002"
+	.ascii	"\\\251j\024\346\234\326\017$qg\267m\3016\004[#\004\243\035\256"
+	.ascii	"t]\354\3578\216\243\327e\237\346\337\036\376\232Tg\237\371%\246"
+	.ascii	"^L\255\230\372#\023D!=\020\334\314\331\032\207\314\034\222F\214"
+	.ascii	"\355\3735\267Q\271\013/\370\303si\253\330\236\313{l\232\033\016"
+	.ascii	"4<\301,\270\332gq\031\324gV\n|f\372\317\rL\344\350\212\200@V"
+	.ascii	"\374eG\304\331u\361?d\331\376u\001\341\316\t\037:v\260t\307\001"
+	.ascii	"\364\373\233\3178\035x\231S\365\317\217q\031\034\214r\322\177"
+	.ascii	"\247\314&$\322\177\331\336\346\025Z*tD\226M\331&\035\206\207"
+	.ascii	"mN\326\003\377E\212i\203Y\311.\277\022Z\256\02223*\r!Sg\002\002"
+	.ascii	"4\322B\246\316\344d\324i^'Z{%&\320\tI\244\301+q\336\006n\204"
+	.ascii	"\322\2118\257d\342J\f\230\324\001T\342RH\244\022\347\tU\307\346"
+	.ascii	"\272\260\026\242\216\250\332\0256\347\234\222\200n\253\255\\"
+	.ascii	"\373\002\206lSj\203\245\025\203}tw[;C\215\325\371\250\256\266"
+	.ascii	"v\347\005% \260\202\031\301\335#\241Y\n\334\373\270\255\230\222"
+	.ascii	"\264\031\303+\200\333\273\273\222\351C@zW\342*\226J\004\213\017"
+	.ascii	"\257|\356\227\2675\302\222\r\255H\244\025\022\2171\300\214\204"
+	.ascii	",\315\265\031\017\314\034\031\356\205/\303\210\200\2112\346\362"
+	.ascii	"\332d\033s\215\226A\001"
+	.text
+	.section	.gnu.lto_updateActivatedModes.52.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\343\f\305A"
+	.ascii	"\352q\310\030@P\246\326\030#\360\273\277'\313\264'\017\336\327"
+	.ascii	")\300S\346W92\267\352u\326\331\223aF\322 Q\275\265\357\354\320"
+	.ascii	"K?\021\021\321\325\377\371:8\224\0130\033\355&\375\017XK\331"
+	.ascii	"\244\224)\245\024\177\001c\001\200\001O8\334r\330\352\312\355"
+	.ascii	"8[D#\364\005{`\005\372L\364\276P\r\355\233\326\030\326\276\225"
+	.ascii	"\3112\245k7:\272\216!,\315\230O9\346\240\2164=\307\243\345\030"
+	.ascii	"\351\270\246\343\230\233\f7\034\007\325\364\032\267\331p\035"
+	.ascii	"\221\013\372\212E@\213{bh{%\252\335\304\3620\323gz4\031\006A"
+	.ascii	"'Q\017\346.\323n\314A\376\321d\370\007\2223\346\263W\346\037"
+	.ascii	"\314\301^\327\036\323l\035\345`[\225\bP D\340\373\236\211\211"
+	.ascii	"[\320\366\332\317Vs{\rHk\f\003\036\351\372\232\276oXT\257\214"
+	.ascii	"\240\355\225\241\355\304\366\332v\023\333\253\313\f\250\241\316"
+	.ascii	"\267\313\fI\226I\364\276/\325SI\342a\253\320f\244w\273\211iI"
+	.ascii	")I8D:\n\032\001\333\037\273\252\357.\367/+\332>\226\007\231\207"
+	.ascii	"F\314\330MV\232\311\212J\\\262\023\206\326\321*\256\344|\303"
+	.ascii	"\364\244'-\354\343\223\036\252\277.\260,m'\354\212\212\2657\235"
+	.ascii	"k8\244#M\031s\322G\301_\226\233^\017\225\351a\322F\006\242\214"
+	.ascii	"-i\340\022o\313\322\302\224\370O\205b\336\221\t\305\222\252S"
+	.ascii	"\035)~\332M\033H\013c\342\254J\264\023\326D%\276\357\033\024"
+	.ascii	"\363\3625\312X\223VU\250\251\334!\241X\227\352\004\226E\331q"
+	.ascii	"\355_b\\\376\r\327PhqO\275(cN\332\177Y\357\373\262+\305\306\232"
+	.ascii	"\235\232\271\227\314\f\2039('\337\344-V}\034Q>\\\276\307D\377"
+	.ascii	"o\271\036Sl+\\\360V\252\017\301\254\2133\264!\255\023d\205\270"
+	.ascii	"\030\024\342\240:\t:\204d>\0075\241\031l\257\377q\310\n1\325"
+	.ascii	"\326\346z\272\341\r\371\350@\034T;=\177\032P\007\017\037>\260"
+	.ascii	"\275>}\317\265\007:\246\264K\036\032$\375\376l\231$\337\321\373"
+	.ascii	"Ht\237\020\355\373\276X\334{\232\317\b\356+\275r\t\023\336J\023"
+	.ascii	"l\257\375\035\327\252\227Ak\364\346\216\336\367ov]b\317L^\240"
+	.ascii	"\021\260C=)T<\221v\215q\322\322\216:\032&\322$o\233\345\260Q"
+	.ascii	"\335d\232\255(t*\231]\300\360V\362P\016\2527\365z#3\024\351\337"
+	.ascii	"dn,\347\336\224\377\214\231u\266`\344\\\201u\316b\235)\264\316"
+	.ascii	"\023Zg\t\255s\204\326\031B\353\374\240uv\320:c\265\316\rZg\006"
+	.ascii	"\255\363U\320yA\353\254\340\347lU\365s\236\222\3528\315PF\316"
+	.ascii	"O\2553\200\266c\323<d\235\233Xg\246\326y\251uVb\235\223\200\316"
+	.ascii	"B\326\031\t\350|\324:\007\177\316F\2553\260un[\347\337\317\231"
+	.ascii	"\005:\257\254\263\nt\376\326\331\177\316\235\001\200\223\331"
+	.ascii	"\244\251\374<\350\013\326\247\350\225\256sZ:N\267]7\233\356\265"
+	.ascii	"nhw[\263\314\215w\3071\226\001\\\307}\205]&L\347\255d:\266W\340"
+	.ascii	"\007\330\243\344\350}\255\276\357\373\"I\365\360\253\276\341"
+	.ascii	":*\312\032?\372&\023\270\343$\tgDA\353N\331\033\034\333\211:"
+	.ascii	"\253\312\333\357\272\272'.\024b\362\215\234\365\355\2019\272"
+	.ascii	"h\336\033_\360\233\354\300\250\366V\252'\374\027\363\204\247"
+	.ascii	"\360\235\344;\032}3\215\031\345\027\340\237\261\204o\360?\210"
+	.ascii	" \212\342\271\222\216\360\022<IC\370\b\317\326y\245Y=\204\357"
+	.ascii	"-e\210\222|G\253-^z\3557\371\3017\370\007\024\235\363C:\370\007"
+	.ascii	"\377u^L\001X\357\340\331?^iS\217\365ie\201~\\\f\276\301\263\207"
+	.ascii	"\224\272\\=\203g\367*"
+	.string	"\204\364>^\360W\257\342%\371\\%N\346Ji\331\307\374\210\333t\251\270hhl\257\013\376j\317\234\332\\\307\376^\301W\261\261A\346\2711\221\214GZd\320\357\233?\365,\242t\270|\317\212\203\271`<\030)B\304\352\237\366\270a\027\213+]0PD\244\314\256\026\037\342r\371\257\245\331\352B\334\313\223n\027\266\327\251o7\355U\210H\231jk\354\377\376\361\\/\316\345\202A\2614s\244\037\331o\272\366\273\245\231\2226ok\354Sk\261\353w\226(\036\227\357\365iQ\221)\342[\264\376:\bNo\315\271P1\262h=\340-\327\321b+\327lO\317\354\212q\325\204h\324\244^ol$Z\016\221\251\001\034\303\305\016\0319\212\025X\374d4\017\0275~3\266VthQc\305\257C\217\031E\0319\266\202\\L\260\345\242\205\r\032*\2128\250\212/\250j\310XA\203\252\210c\213*\201"
+	.ascii	"\266q\303\005\016\252\0346l\340\240\nB\217\375g\354KQ\375R8L"
+	.ascii	"&\251\006\360_\034\226\322\343#\327\240@\324\367\215B\241\333"
+	.ascii	"\272\247m\336\307M\317\356\346o[A\372\\\243\221\355\325\363("
+	.ascii	"\007\001\370\246o\266\351\233M\205T\233c\262\020\200-\r\n\241"
+	.ascii	";\303v\221l\277y\2648\300\371\276\307V\266\001q\263\360\355\326"
+	.ascii	"Z`[\364\246]Lh\366\236K\337L\324L\377v\242|$\270\273I\226\331"
+	.ascii	"\035\342~y+\231\276\243\r\f\003'Lo\312\365F\356\266f\177\272"
+	.ascii	"\032\220\"\305\342\231~\202B\006\231\227f\t\2267p&pJ]1\367HG"
+	.ascii	"[\204]\234\3364\251\364MFR\n\245\376\371\f\243\332\311\351\227"
+	.ascii	"\276,\231n)\311\351\245\276\337\364\324\321\016\231\347V\345"
+	.ascii	"J\337ww\025\240^\351\255\254\330%\371\222\036\351\241\276\377"
+	.ascii	"$\221 \205\321\244\357>-Z\037&\013\026\341\367\035\032\321\217"
+	.ascii	"\276\357\232\r\351U$q4\255\030K\251\223\312\221\353YJ\361\274"
+	.ascii	"\211\307\034\303\317\\J\205o<\243\017\212p(n6\242\314\204\321"
+	.ascii	"\267\234>\240\266|2\325^\370M\356\306r"
+	.string	"\356M\207\177\306\301*GU\377|<\252\207\377\365\300\2770\207\335\2113\003\200\366\250Q$&\225aH!\031\021\221\321$i\fp\002\221\251*\242\007\021`%tlFD\024\244i\016\203H_\330-W\301R p\207\331\360S\210\225\363\264\357\344\021c\361~\347\245\340\023\311\306\311\306;\300X\203+\357\205\325\250\036h\037\261\227\200\252v\2072\310\3622A\340!\275 \266\254\031\256)\353,\251\246\220\367\344m\230mz3Y\364cez\267\255\201\373\2044\200\337fg\3001\004VS\026\002MZ\242\013\3173R\216\r\313w'\335\266\304x\302\244USi\355\332\331\200y\026\302H\3267o\272\231\326T\t\254\230\317{\311\303\243\331,\231s\346\303gk\033\224$;\360#v\315\303\246$\304O\237zs?\232%\237}\251\020n\220\255\364R\252\3153\023X\217\316a\211\315\2613!\340\246\020o\264\310"
+	.string	"G\312\027j\007\216r\345\227~\314h2\031}{\354~0\024.\252\034\334FI,V\231\230U#\321L\022\351\037\f8\f\331_\347\235\205\242\246\304\266i\212\007\312\302\032 \365C\371\241\360&\2458\266X$\025u\376\245\240G\001\340\245|Z\003r9\230\220g\271:\236\202\341z&"
+	.ascii	"_\004\004\205\366\275\332\230\346\224\326A$|\253\223\245\272"
+	.ascii	"(\032^)\260\300\200\002\230\251wGZ\303\246\246\027\242|\204t"
+	.ascii	"\017\251^]\203h\370`2\320\264z\0348a\346\216 b/Q2\306\346ij\326"
+	.ascii	"a(uR\216\375\267\275\226"
+	.string	"-\332:\005\240\363\n6\313\254\2726\214\261\tZ\333\241\330\245\334\221*\335\344\354p\304\275\003h\326\340\343\216,\3245:\277\270\214\007"
+	.ascii	"\260\232Y\240\275\b\"\rr\006\240L\323q\357\211*+\304\017\314"
+	.ascii	"\333t\361fpc\372\020\317\365\231Qg\363\202]$\313\260i>\261\225"
+	.ascii	"\027)LE\303\217^\325.&c\347\356l#\026\331(\373\315\311\"}y\357"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.53.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\373\002\035\025"
+	.string	"\246\247\212H\3200\2511\300\210u\005h\343\332\375C\256\371?%)\366\017\b\033\302\f\354X\247\263\351\2114G_\222\314o\315\226"
+	.string	"\330\227\320E.,\026\024\037\341\005\347\230E\206y\\a\013\266\036@9\370\007\330>w\333RJ\231Ry"
+	.string	"l"
+	.string	"{"
+	.string	"\342m="
+	.ascii	"\361\026A\202\026\327^\352\344\276\033\212\t\032\336[\222\024"
+	.ascii	"\204\003\274\2267k\326>\262D[\351\254\371.\037+}\031n\270\f\232"
+	.ascii	"\233\272\240*\346\351\275\333d\225\260\271\bc+\203\244\232\234"
+	.ascii	"\207\356\245N\021\301\251\233\240\271\231\265\032\300i\322\340"
+	.ascii	"\241\203\251\0371>D\335\3679\243\303M\372\336'\022\360\006T\241"
+	.ascii	"\263\371d\225\334{=et\031\356\326m\357\3306\261'Utg\227\267I"
+	.ascii	" \247\2642\315\2619\316\373[\236\026\377s\333:]\3554\265\323"
+	.ascii	"\263N\337u\"5\234\022\241qo\356\312\352\302\260H<\377\371\355"
+	.ascii	"\373\302\201\334a\003\016\357\275.\373>\277\364{v\375Xit\241"
+	.ascii	"\031\177AER\367\336\220[\223\343\355\355\026\333e{N\373=?\321"
+	.ascii	"r\036\006\267\356\365\340ttoy\300 \343\355\200\177\004'\177\021"
+	.ascii	"\243B.\224*\375\323\344\320T\003\310\322\235)\235t\216\3605="
+	.ascii	"x\013$\030\325aqD\351\223B\030\345E)\243\375:\021Lf\207VLJ\022"
+	.ascii	"\374wPD\275Jwn\321S\232/\210\233U\266#\\(\006R\363\204\323s/"
+	.ascii	"\216\344A6\313SLh\361\344H\004{\356\275\nP\374'\363wn=\2630/"
+	.ascii	"s\353\257\210\267\247\367\275\200-\212\212g\233W\024x\304\353"
+	.ascii	"@\003\226\020\273\212\003\321\257\221\025\230\312L\206\362\242"
+	.ascii	"\221/\b$\205X\212\214|\321V\310\021\001\236U\200\321H\226\331"
+	.ascii	"\214F\272J\333i\216\353\227~\2377\200r\372\031\261\374\232x\337"
+	.ascii	"M\240\226~F\366\257\211\242H]b\243\267\033#\335\231%\0249(\025"
+	.ascii	"\316\220[:c%\321\322\363|B\334\254z\275\367^\226\310-\345\240"
+	.ascii	"\357\275Z\355\330\200\301\271Q&&\237\027\3611\261\322\216\031"
+	.ascii	">a4 \220\002\241\232\254\003\346@\316\357\013\265\360\020Af\""
+	.ascii	"w\3405\266%\tK5\277\242(\337U\326\270\001\354\t7*\007\201\206"
+	.ascii	"cf\3562!L\307\305\330\230c\270\210-CX\263\200&u\r,/\326@\312"
+	.ascii	"9\260f\341!\024\337\024-/\330B\313\"\220\320;Q\367%\241e<\256"
+	.ascii	"\025-\220\2067\233\256\013:\001\026,\200\n\013\301u\220Tf\262"
+	.ascii	"\255~\265\213\f"
+	.text
+	.section	.gnu.lto_isModeActivationConditionLinked.54.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\030\002-\022"
+	.string	"F#|H\340\322&\035 \331B\355M\365 \375\037\n\336\024\255\212u\b\265\210]\r\310\356\f\331$\255\\?\240\242\256\365\246\333\346\236\343\253\225\332dc\274\024Q\030\243\325\300X\016\242&~#\353*\316\307\001e\315\220F\366\2262\245j"
+	.string	"_"
+	.string	"k"
+	.string	"\t\024\320\270u\320D\316g\270\330P\323\234\340\267%,\340\021\274;m\035\325\311\270\332\362k\216\212k\323\004\202D\026\213*N\261\035\267\275\264S\261s\031U\204\200N\254\355\226\224\222\3054\306\003<5tHd6\261D\307\b\246\207W\034\031L\367\266\353Q\220p)\206l\347\212Z\231sZod\036n\357\266wl\263\330\212\022?\312\352\370\332\275Q\255Q\375\221\026\260\tHJ\322\2349OEf\016y\364\363\332o\337\032\336\302"
+	.string	"\\B\200\346\234)\373\241\017\3726\247jF\362j:x\267!\036?\346\234'\227\376\274\313\3334v\312\266\252\375\240\013\321\234\266\301#s\212\260a4'\210\300&\336%\201\227t\227\361\001\272\313{\243FBG>\246\323U\2370'\341D1\017f\310\320E\301\3753%\"[\334\231Q\373e\2058\230:\331\2069\214\030\223\017@<As\302\026|\310\316\360\0272#?9)pAsN\006.~[\371(.maF\177s\351c\350.\277\017o\3005d\005\315\245O\273dD\013\261;\263\301\227\026\240\321`\362\366\330\336i\001\236"
+	.ascii	"s\027\007\235U)3/.+\231\026\025\353SE\370(\300@\220\371T\254"
+	.ascii	"\231/e\200W\025^X\337\205\325\212\365\245@\327\267\307g\361\006"
+	.ascii	"JDnE\235\337\352\036\236E\311\307\255(\376\255.\306\365\212k"
+	.ascii	"_=P;3*'\275\335\234\236|\027\307H\335\356ia\016\246N\217s\316"
+	.ascii	"\331\241|\327\333\333\036\213\370\340\340\300\363\322'\r# \200"
+	.ascii	"\202)\263sf@N\263\217\262\205\277\025w\370\032\"IB\362\346;\312"
+	.ascii	"\362\205\f\302\330\372\260\322\341)\313\346\353!$\337\324\226"
+	.ascii	"\027l\241m\021PhO\324\276 \262\214\213k\241\005\322~\263a]\340"
+	.ascii	"DT\004+\312\336\203K\"\371\"\277\256C\006"
+	.text
+	.section	.gnu.lto_removeModeActivationCondition.55.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\227\005\215#"
+	.string	":A\024\016K\240\024R:\224gg\360\304\205n\324\016\t\357\350\243M\315\243\256\255\004\227\332\032\375)\230\361\216R\253\215\373d;\374\233\323\210N\224\224\310\314\270\347i\214\036\257\323\373\204r\264\326q?\342wa\317\246}+\371$\226\220-w\222\001\317"
+	.string	"\300"
+	.string	"\320"
+	.ascii	"P~\334{\\\300\272\363%\201\307\230/\355a\314\227\374\303L\345"
+	.ascii	"\306\247{d\027\"d\331\275w\327N4\026pk<\343\372\3479\334\315"
+	.ascii	"\226\326\320\223f\276\224\266\353\017?\307\r\340\030\373\t\201"
+	.ascii	"\236\263]\242l\370d\320\205u`F$v\244\257\342\016\343\210\370"
+	.ascii	"\233\355AJO\227\216Z\274fc\214h\374\236\f\016m\202*@\262\\*\310"
+	.ascii	"\242\242\251p\250\236\266uh}=\031\\a\035XM\305x\326\013H\005"
+	.ascii	"UTZ\315F\212\233|\246\370\213\265I\202d\365dP\311\002`\212\202"
+	.ascii	"u\251\340S-cnm\002b\022$\234\260\204\215\tc\222\362\254W\240"
+	.ascii	"P\250\366\221/\235\212\310\226\216\210\257\264\007\367^\256?"
+	.ascii	"\341\321\031\300\231\317\200\231%0\227\035\207z\311:\035\352"
+	.ascii	"\177/\371\035\314\2273\375\256\227@\204Y\214\210\270\222n\375"
+	.ascii	"~\326\313\033S_D]\202\352\331\271\246\364\260\352.2\033}\265"
+	.ascii	"&\\R\304\335\304\\\203V\2469+\317\310\374\352\027@\253\fcV\316"
+	.ascii	"\375x\276\331\322\332\215g\324V>_V6m\345\322\254l\315\312]V\256"
+	.ascii	"\266\362\007\340\214\204\355\316\3565:\333r\301\312 5~\374\215"
+	.ascii	"|\036\357\nq-N\231\220!\320+]e|\254o1\247,\342ZL\023\3425u\357"
+	.ascii	"\315bN\257\203\217<r\215\025\335\210`N_\366sp\312\314F\335\t"
+	.ascii	"\024<\265\264LT\271\327\250\340%\357\316\227\314\374\312\374"
+	.ascii	"\252[\375\374\212\004\243\367.\005\255\033j\231\201\232]\245"
+	.ascii	"\226\220\350\026C1\241\233s1\373\\\t\017\255\201\344I@\230/\315"
+	.ascii	"~\217'\335e\237H\345u&Qt\3548\273Xu\205\206)\323l_\320\256\301"
+	.ascii	"\\gvW),%\267\256uw\005*/{\357\275\264\257\327Z\246/P"
+	.string	"}\r\021}\365\214{\207RS\021\263\213\374\337$\221\310x\351&~\326Q(\262%6\327l\333\326h\003\231u&\372a\030\026\024\241jVv\361:\323\326\271\346:\224\305W\317\316\307-NH\266\213]\233\007\353\211P5c\346\f/\202\243\033F\021\253\356\2757Dx7\037FQeUB>\244g\276\254\3754\214\"Z]\275\353@z\346\321\311\357]\314#\376\203g\216=\335{\033\370\270\327\006\016\314A\347>\274\236\234\234\236\251\001\202\31186=<\r\275\035\f8<;\234\234\235\007\235\f;;\034\236\236\235\r\r\367>\360xv>\275\036\317.5\006\275\233|\034\001\013j\0370\327EFq\334j\240\310\210\267\006\262\275\245\375\034?\313\310N\324\033\271\255\201\327\2317\324\312\207\234\315\330\302\245\264f[\336\310\323\006\336\272\246\217|\2314U\257n]\254/g$\246\202\31743\005\013\365?\306\375"
+	.string	"\033j\240"
+	.string	"EG\244\255\213)M\363\305\"\240*\370b\023v\370P|\f\346K\032\004(\274|c<Xl=\331k,O\036\036\306\263_N\300`\372[\267\\^\330>\255\031\225\226\003G\222\232\324\316Z\263\245\325\232\326\300zv\177\352\n\221\326m\177\3446l\250q$\303\224RL!\221\211FD*\315\030p\002\2312\252\036\021\240\321\013hJ\n\303\236\001M\3523\177qu\343H\230L\371rS:\341\230\223?\202\342\255\017!L\023@\323\346a\255\214\203<\b\313xp:x% \276Vq%\230\211\354*6EL\"\276\303\370\363\027\200*4\271\344\n\226\322\2026\255w\243d(\027\003j\001\2002\030J6|\201,\305^@\210-\017\023\022\006Fq\346!\375P\026\357d<\266\0055b|\372\021\352\306\2175Y)\277_\376\342E\0332\322\016\205.\302\201\245\002\021\353$J\235\265"
+	.string	"\2756Og2\305\274\034\270\374\035$\035q\273\365\322\2425\177\2014\237\306\271\201\242U\347\020\230\017\336\227D_"
+	.ascii	"-U\260g\311\260\247\035\303\302\223DG1\236\353\247\345\205\353"
+	.ascii	"M\211\371\003"
+	.text
+	.section	.gnu.lto_isModeActivationConditionConfigured.56.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"\345\n"
+	.string	"\266\025M<01P:\2008\222\306\270\252\"\307\340+}\341=\237\242\2630\347b\0302\367\317\257V\t\266G\360\226FBZ\330\310~)\260\004\274\b/q\326%C\305a\350\235|B\266\224)\005<"
+	.string	"<"
+	.string	"7"
+	.string	"^\320@\343\3561\304\347\"\021\035P\244v#\246\242w\207\232\235\357\035j\215\026/P)\276\017W"
+	.string	"\337\006\026\330\335\223\236\236\217\223\371\230\354\256\263\363y\270\253\333\206`\233\201}\003\001\325G?t:5}+sJ\321p\320\261\373\351\310\261.\252\025#lkl\210\035c$\310\264o\342'4\037i\030\020YN\t\304i7*\360\201\353\225\343\005X\257\256\007\260^\331\016N\365d\203n\240\206rw=U\220\021\374:\241$\203\2238le\344faU\n\325\306\220\311w\256'\375\202aco\314\340\240\236\035\275\324\220}\270\273k\005\331\217\177\031%B\006\214E\253\\\031ESg\222K\205\302\246I\3108,\253\200]\260@\321\260\214\273`\022\002\336,\025\016\303l\033\207A\342\036\256\202\374(a2\251\337Y'\375\001\212\204IE\376\235\225\352\261\003\016"
+	.ascii	"P\204\366\323\206\327\304\016 4\007\334\202\346BH3\266\20090"
+	.ascii	"\030\030Y\200\n\206\252rH]\337\332R\006"
+	.text
+	.section	.gnu.lto_analyzeModeActivationConditions.57.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`:\004\225\033"
+	.string	"Vq\254I\260\226Q:4\206\002\301a1\327\244"
+	.string	"\340\026\257\270\230q;\320\177\\\313W\344\272Rx\230\320\016\235\251\375g\212\376Z\022\304p\037o\020x\2409\221\274\311\375A\264o\017\":\303m\216\205\0029Y3\215\020\262\311\226)\005\222"
+	.string	"\214"
+	.string	"\240"
+	.string	"\324~a\273N\367<\273|\245\353h\337\371\2245\242\026\260J\tV\255D7\247nP\236\276\336f<\2559\201\361\3244[\370\036R\375\221\237\220SV\255\3655\177\270\300\305\336].\355\255\222\034\2518\227\346\363\276`\007\274\341jo\2113F\026\216c!\272!Z #Du\237mK2\203\217\"\243\2236>\n=\005-\005\200\263qQ"
+	.string	".\206\250\240\351+\003\007\264\363\276\323\037R\\v\024\031}\311\f\265V\357\rWt\003\270m#\2665\330\242\203\027b\023\206\332\337\f5\236R_U\221/?;\264kk\356*\343\315\337;oG"
+	.string	"\322\315\346\211\355o^\340\215`\320\254\331=\333\316#\373\007\222\226\202\236=l\033r]C\3274g\272I\272\036\351\232\322\265H\327s\\/]\337"
+	.string	"\315\223+\026\242j\035\032\226\251A\372$\351L\377\356k\337G\362_\213;9\200mK\221\026\366\227\376d\273\374\342N\246>a\223\355z\317\367I\230@;\323\254\254C\310$G\244\260j\355E(\037\263F\311i\333\305\251f\f|,\237\372"
+	.string	"\002\007g<\275"
+	.ascii	"\304H\234\301\337\272<\370\234\342|P\316\266C[\2313\300\224\320"
+	.ascii	"\210\321\275X\345 \022\347\221E\214;e\276,@K\306v\210W\021\321"
+	.ascii	" w\225S\252\025\210\002\025\237V\322\320\020-JS.\265b<\335E\312"
+	.ascii	"]\345t\273\377.eg\202\371\317\206\361(>b\224U\255\265\002\224"
+	.ascii	"C\215\360\205\234:\007\006\233\377]4\243#\314\f\"Ij\220\363\363"
+	.ascii	"M\247MtQBg~v8\253\232\354tL':$\217\252\254\233\373L\016t\024"
+	.ascii	"\007>\201\342\260\234\r\263\036\025<:\245a\020X\350\220\210\361"
+	.ascii	"\214\200\311^\260\022\257\024(rx^0\031\213\027\004\004\216\251"
+	.ascii	"\320\221\275zb1\331\313\325\373\371\354\301\001J\360g\332\354"
+	.ascii	"#\326\272\003\303w?\357\003\260\230v\330\232Gn\005!m&\r\262\226"
+	.ascii	"q\341\305Zk-\377\331HN\233y\337)\r\035p\311\236o\231%\270\332"
+	.ascii	"\200\363\032\263\230\240s\264\242TrY9\235\307|\031B2\336\234"
+	.ascii	"f~IX\3632u`\277\344w:o\347A\356KN\251f\372O\035<\354o4\363O/"
+	.ascii	"\251\304\3241XA\001W\250Q0\305\214C\310\310\0043A\215\026(\351"
+	.ascii	"\200\002\031\262\262\016\021P\305tT\213\213\365\f\201\224\n["
+	.ascii	"\366\017\201FD.\225\177L\237\002\2506\253\323Vqd\r8\330\265\233"
+	.ascii	"-T\223\321\304D\251I*\2644\003\324\027\375\300U\267\252\330\247"
+	.ascii	"\020\300X2\302\306K\354\360\007\350\256\264{C\354\224\035\214"
+	.ascii	"Lku%\306h\301\022\220gS\227F\024\257\235\r\213\3056\003\315\300"
+	.ascii	"v\214\313\"\250s\335m\356\001\323\210\220\221hNe8\351Z\273\310"
+	.ascii	"^\200\253V\205\022\245}\304\026\341\260\321$\240\204\221\376"
+	.ascii	"\363\211\204\375e%2\216[T\312\241%a\362\326:\311\344bH\332\375"
+	.ascii	"\3217\246\303P\001"
+	.text
+	.section	.gnu.lto_updateMasksForMac.part.0.67.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\266\001\245\017"
+	.string	"\346\033dF"
+	.string	"\257(\035\220\0315\203j\242\210\2629\371}\240\177\243\311\202\340\305\346\373O\006\023\337\337\2045\033\370oH[_m\270\343l\361\366_\262U\375\250\317n8m:y\"\233\240;x\346\233J\207\005id\023\271S\nI"
+	.string	"U"
+	.string	"N"
+	.string	"\033\273)6\264\335\321\343\323\b\272O\217/\300}v'\300}\332_\261\235jY\264a|,\261\207\2756\304j\273\353}*\211\213W\271\211\376g\3178q\251\256"
+	.ascii	"\\\036.\007|\343\204\354\256\273\017\367\274m\217m\b\266\364"
+	.ascii	"\b\261\373\261\224\257\3423k\304\030\304\223:L\330Q\205,\013"
+	.ascii	"\305\253fJ\033\304#\036&\374x@\304\370\252q\320]\366r\352(\207"
+	.ascii	"]\215\350\370|\t\241\240\373\324\260\312\303\\N\352r\342\020"
+	.ascii	"\260&\260Y\002)?\246\336\202\342\030\267C\313R\332Oq\026\361"
+	.ascii	"-\250\007k\262\300\247\301`\3017\361\351\243\270O\251\247\275"
+	.ascii	"\303\365\302\206e%o\244\252X\267m5\305>\354WNZ~\374\317m0x\355"
+	.ascii	"\262nb,\312\2449\361\231_\366\307\\\355\373,\276\302\247\315"
+	.ascii	"\310\204n\311\204\035\325\270\254\006 j\257\332\203. \222\310"
+	.ascii	"\310\026\272 *\371DF@\244\017\207\304\364\211\020\206H\234\357"
+	.ascii	"3R\177\037\246\020\b\034M\370J\336G\301#\211>#\357+\231\274\017"
+	.ascii	"\003\006+\204J^\t\b\226<\371\331;\331\212\213\225fPU\261\035"
+	.ascii	"@JU\265E$\362'\226\200\242AU\266Go\001v\033+ \200\002\031\253"
+	.ascii	"\354\265\013\374\n\354\221^\001\374\013'4\023\023y:\302\177\270"
+	.ascii	"\266\263\340\260\250\347\324\026\027\274\t i\244\353\211\fj\f"
+	.ascii	"a\241t\002\270\235Aw\266\342\326zx\234\264\334Q\006\341\233\217"
+	.ascii	"\310\303]\037\253\317\370f,\021$\362A\262whg\301L^j\026\324^"
+	.ascii	"\220\234\342\351\327\3421"
+	.text
+	.section	.gnu.lto_updateMasksForStickyModes.part.0.70.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`j\006e'"
+	.string	"\232G\204\017Ep\236Q:\267\303\211h \003V\356\210\221\016\\\036\335M\371\036\250Y\250jP\243z\254\256\032\375\261'\303\305e\306UF[\334\001\323:\024'\263!\241\\K\274\267Z\243\252\236\345xamO\032!D\312$\003\342"
+	.string	"\331"
+	.string	"\346"
+	.ascii	"\273S\373"
+	.string	".\367Bu.\333\306>T\274'\263\332\325\351\266h\321b\346A\363\225Y\252:K\325\022\005\314OZ%\353\216\3422\357\336\312\305\202\277bc\311\250b)q\230\325\232\\\360s\021\244?7y%\364gz$\364\347\356\253\354\256Uq\203\273w\236LR\257TC\324\262\254\265\362~6\222\007\277\323\345p\351\r=\315\346\241\340\236\354ll\273\372\316Ig&\310s\366\347`\305 \246\022\027\223\255\267)\002\341\\\020\263\t\254\370\203q7\013Dv\004y\332\246\350e6\235\335\t\254\330\305\267\253\235\367\004\214r\255\213\321\307Q\3362\366\370\251\305&\2211\313l\252\265\352\214X\334f\202\343\031\036D\306\241\251\304\246H\235\253\235s\030\211\314G\037\272Y\250\265\356\205__\242\357\356\332\356\212\330E\r\004\177\272\372\023HL\310m\334\310\355\241\233\265\326\272mdW\307;`\307\313\364-\377\322\225\277\200\2247"
+	.string	"\312\253\204\362&\351x\221P\336\243\224\027@\312k\224\362\026\245\274D)\357P\312\273Kyu)o.\345\305\245\274i\216\367\226\362\2428\336\023\307k\246\274\215\343\345'\377;\025h+:\326\312\325F\250\n9\321\232\334\254\f\325\002\237\004q\034Cv1'\263@\263veu\235/\254\344\323\356\002\227\262zN\327\222\367\323\334\375\376\313\325\246\216\266O\343qE9\206\325Z\305\204\221a\326\256\332u\276\226a\313\224\247\036F\306\223\225\213F\3272l\231!\005s.\373\263\325\335l\035@\260z\031p\213\016 \004_\006l\272JV\256\t\3078a\313Z\223O?\267BJ\026w\270\302\216Vn\215\\>\237\316\246\202\003\350\034\273"
+	.string	"\372\250Od\023\242\215,4%\311\362l#k\324\271\266\241\003\220\022\315\351\274\250\215>\347D]\324h\232\026\330\331D}'^\200\210l\302'\021\224\307\314l\344\016u\256\373\2162\315m\270\353\241\3564\255#\223\256w\215\332\321\002\033\266\256\257\366\023\314\013\017\221M\210\205\353\\\243\177\214\240\244\215\353e\255>\267N\333DCd\223\372Z\210\264\326*a\377\346pD\354\b\022\374-\022\350\317[C\220\203f~\323\320n\264\033`\0013\\\333r\034r\333\366\371\314\017\233!\335\310\263\315N\241T\203\305\202J\274M\037\220s\2655\3615jn\2348\217\002\375i\266\022\035k\216V\304\270\273\271\020\221m\267w4\276\264V\254\b\37337~\373%6\320\237\334?\0135~*\2408\274\370AA\365X`\2501\325+\372\321h1\303w!\005\325\017\352\346\002\330\363\240\002\252w\363\365`\364\372\030"
+	.string	"\177*\242`\240\360I\361|+xP-z0x>) \217\001\323F\305\370I\361fDEI\361t7\353\323\261\2665\302\036n\337\334!\340\001}\264\023\252\"\020g\320\006\237\004\241\210X\016\350\242!\205\002\211\351\032\271|\244\326Zs\215\344'=\256<(\005e\352\023Q\2461\300\273A*\301*\374-\246N\032\363\263f\330W8'\016\320K-\240\337\273\301+\027\370[\333D\354\253U\352"
+	.string	"\005\316\b\r\327\306\330\204\265\326\253\264\221K\300\315\027\261\f=\332\340\306k\254\214\317\347J\235c\017D\223ZJ9\207"
+	.string	"#\365\321\276\247*\255U\370\255}\236\353\321\260\241\252\n\345\320\201\277\225\324\024\204d\365\325\356z\270\235\017H\034\200\201\250a$\305\214R\306)\231\031\021ia\222\306\220\002\221\252\252:\021\260A\253\232\202\322d\332\f\266\327S\3743\363\n\267\302=E'\376\353\220\003\301\240\001\254\222\250 \r\222`fF\232e\240\216\002h1\013B#\301\021:\346\177\306$\237\215<\374f\353\360\224\357\023@Y\341\317E\364\354\250\332\200j\332\323X\030/\211A\245\2666\245=\320\241\363\264PJ\235\032h\362\210m%|\212\252\303c\225Ld\004\351\233{W\254\317\205\374\351\004\223\261\213\237\237\371\310Z\b\350r\3727\331I\345\260\313\f^\007o\005\251e\253\340\306"
+	.ascii	"\342\236\2127N@.3\217(\021l}\224\214\305>\353\f\023*\005\235"
+	.ascii	"\203P\334\320\315'\213\004N/\2705S\234\372M{X\241\013\025/\n"
+	.ascii	"\266)\005:*\362Lr\367n\222\216\226\"\243\\:\020\200\377L\267"
+	.ascii	"\326m\241(p\334\353'\344!\246\330x\033qT\355m%\2121/\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`\366\002\375\020"
+	.string	"v\231cH\020\317\246\003`\b\253\r\342\221\021\252\374\b*\027<Z\300\332\005)\220cZ2T>\032&h{[[\317i\341\235\026\001"
+	.string	""
+	.string	"\005+\207\320\344q\222H\3614\b\312r\221\306}\262\235\t\356\320\222\335V\266\311\223dJ\001N"
+	.string	"U"
+	.string	"M"
+	.string	"\366\200\310\310\307<\235\246[\021\220\224N\f\026\362* \2372\372\346\307\363\007\351\3438\216\036\217\362\301\314\216?\221n\rxp\274\2114}I\2074\031\035\223\231%h9x\2172Y\020\f70?s\b\233\006`\255\265\245g\227dfW\021*\216=\346\2715\302\274\202\227g\036\227\347\236\324'h\371\030\226\177ik-\263\267\362\bZed2K\230\211"
+	.string	"\301\201L\203\231\0052\017P\334\341*\205d\022`\365\234@y\027y\362)\321\rP\215\311\267p\354\224\b*y\026\371\211<-P\277\"IB\246\007`\313\237\025\005\226\266y_n#m\233oW\363\213\026\325\374\3426\315\206\346\001n\237,\230\300\3414\027a\350\215\327\004 \246\036\272\315$\\A\0318\352!\221\243\236\335f\230KC\016\211z\213\335:1\230\210\216\272\252\275\243\376u\355\001\034\n\273W\244\270`c\032\371\347\215L\031\276\3714F\215\217\007o\200\227nc\200\210u\350\252\227\304\002\325I\267T\275k\321\352\032WC"
+	.string	"\330\2353\342\265C\253g(\272+\260X\340l\3253\261\375\365\263\272\351\252w\310Ug\240\372\274\352Y? \240\002\241\"\353\006UR\340d\204F\275\247\332\336\340g\0271\322>\033\365\035\351c\272D\200\374h,\315e\311\35521M)\313\206\207=\016V \265AT\034F\004\222\221C\200\031}\023\314%\230\t\272\004p\f\034\016@Rwi?\302<l\274\201"
+	.string	"\3530\222\365h0[G\016\007d\253\b?\352\334!\t\243\224\007\226!\b\363$\001i\022\346\367\017\017y^-"
+	.ascii	"\367\320l\316\323\216H\203\035\274\217\230\006b\366wn\344Av\002"
+	.text
+	.section	.gnu.lto_.refs.3a37968579003349,"e",@progbits
+	.string	"(\265/\375 \325m\004"
+	.string	"\322K\037!\240'\031\016\377\377\377\377\377\377y\201U\232\264\317u\377?w\263\233lIZ\333\255m\262\367\2262\005\013\260l\360\205\354D\355\252O$;\255}X\237\362\2626\325\002\322\213r\204%\303,\370\3217\375\322_\00703\234\275@\256\300\235\260\036\241\177\3207(/H\236@=\003\375\352'\375\366\025\375C\037\225\037d\305\232db\017$\336H\034\241\021\345\003}\354\235\315\312\036\271\375\r\001\004"
+	.ascii	"\243\022\341g~yM\212\022\224/"
+	.text
+	.section	.gnu.lto_.decls.3a37968579003349,"e",@progbits
+	.string	"(\265/\375`U$u\242"
+	.string	"\372"
+	.ascii	"\2718Y0\f!\235t\\][*+\205\327\276\353Q\304\356Nu5FCo\335I\r\313"
+	.ascii	"1\273\340!\245\315K~ORl\204\225\365\344\005\233\204\266S, \242"
+	.ascii	"\261\307,xW\330(\375\213\024\243\257\375T\020\257z\360\362i2"
+	.ascii	"\241\032\344\223\210$\2500\220\342*\375\211$\222-e\n\374\002"
+	.ascii	"v\003\216\003bj\222\214\207\336\213d\276\340\206\371\202\031"
+	.ascii	"\265*dX\212\276\245\302\200ISh\243\001u\247\303Q\202\314\301"
+	.ascii	"5\372\246\361\305\016%kb\366\244\321\363\312v\354<\272\3321\027"
+	.ascii	"\256\273I\256wi\002#\253\026R\236\037p\352\232v\314@\321\267"
+	.ascii	"R=\327ui\346\275\0244\222\216,\312\035\246\243I\256W\214\006"
+	.ascii	"\313\027\250\261=UD\317y.C\272tZ/N\272\345$\n/O\325\022\304\001"
+	.ascii	"\204\253Q\271\265\314\302"
+	.string	"\334Z\327\225\233z\r\2460\225\233d\316MNQi\202\305\261\224\266+\f\307o\214\205\263\360\312q\334v\256\302nG\327{\313\330\210\025\246\202dJ\213\363\336\265\207\343\370\b'\261E\226*\331\224\234\223\3118\216\315x\315\256M\025\206Q\025\347\275\367\303\007\235\017\037>\244a6\340\314j\3203\024\225/oHsx\0055\214\331h\230(\204!\263\324\263\225z\276\021E\247\206\t\314\013S\243\347$\365\t\253\361\312P\270\311Y\t\227\235\327{\327{\357G8\341\264\233c\3165\202[k\336\273^\203\277\347\0271\202\241\360\022N\263k\363\032\301\241mp\f\203$\310\363\336U\347\303\207\231\260-\031{)\372\237z\021Tf\302g\274v`\264\213\030q{\004\273^\367\25686e\270\312\214i\364\022P\317\035R\336\343\016\351\035\240\276\0035\2077\244\315\031\322\035\336\220\362X\353U\311\002\244\321\207P\221\274"
+	.string	"\352\335x\203\030{q\230U\0361\357\330\275+\206\2310)]\310Fy\005\376\342\225\303~.\302`G\301\230W\354\336\325\306\"\231\2500i\324\003oHQ\316\220\336\274\335\021o\365\274\223\342\360N\372\2257\244*gH\273~\036\322\335A\017-\001\"\030\340\357\034A\037\320\342\345"
+	.ascii	"\370;\356\347,\315\276\277\255\3641`\275k\370\033\212\026\024"
+	.ascii	"6\177\233e\370;\t\2210L\006\346p!\356n\345\347/q\027\340\234"
+	.ascii	"\2379p\323\344(v\025x\271\007\177[\200\356\371\r\177\213\340"
+	.ascii	"\271+.\377\337\260\374\310\177\260O\360\267\217\332\177':\377"
+	.ascii	"+\300\371[i\004G\377\016\301\317X[h\376\036\376,\365\263\216"
+	.ascii	"\237s\374<\365s\n?G\375\214\343g*-?+\177\276\3613\324\377\233"
+	.ascii	"\337\256\375\254\344\347\365g\257\237\265~\316\372\271\371\263"
+	.ascii	"\217\237y\374L\374\231\350\347\022~F\3613\320\317'~\376\300\317"
+	.ascii	"\036\370\271\003?k\340g\022~\276\300\317\"\374\314\363\263\004"
+	.ascii	"~.\361\263\003~n\300\317\n\3709\001?k\360\037\003?[\360s\372"
+	.ascii	"\263\357\277\336\177\271\237\005\360s\207\237\003\360\237\355"
+	.ascii	"\377\363?\332\317\034\376\337\375\254\3633\005?O\3603\206\377"
+	.ascii	"#\374\214\3633\315\317\352\3772\377\311\374\037\363?\357?\230"
+	.ascii	"\377v\377\265\374\017\373\317\200\377S\376\347\354\355\355\355"
+	.ascii	"\375i\315?3\343\347\220#\314\273\344!\313\t\267|\336\353\004"
+	.ascii	"\302FHZ\r\251\032``=V\342\2304\303\246\027\345\251\221\274\307"
+	.ascii	"n\272\314\020\343\324h\037\341\264\324\313\352\212\226\021\234"
+	.ascii	"\244kw\305\210\230\217\254&3\nM\03127\\\204q\223\231)\033an\243"
+	.ascii	"Ga\254k\257\214\307\353M\342@n\005q\253\247\256\260B\177\225"
+	.ascii	"\270S0p\230_\\\2005\332_4@\202L\035q\341\342\352!\352\361\336"
+	.ascii	"\2712N\233\257+f;\272\336C\302l4\301\265e=\253\265\370.\357u"
+	.ascii	"\272v\013\236e\032\003&M\310[\213\361p\214\262~\230Q\261\331"
+	.ascii	"\242\213\253\321\350m\231:\325\315\251\016\222\336\313+3iy\235"
+	.ascii	"\226;\177\253\360\016\222\036Uy\013\322h\003\351*\337\021\246"
+	.ascii	"\036?\232j\346\006\030\323HTK\275q\034G_\251\307{\217\353M\342"
+	.ascii	"0/'\247\035\024ZjZ\254\336W\357Rs+\260\360\305\")\253\321\356"
+	.ascii	"\321U\350\225\223\223\246\252\037( \021B&\267\346\200\322b\311"
+	.ascii	"\007\267\361R\214\214\270"
+	.string	"F\233Gj\004\207\331^\243\235\243\251\254\027\026\215,\252\336q\003\312\333\217\273t\314\216&\311F\337:\330\371\377.\2118\351j\364`\030\257\346\305R\223\033\215\336v\251\267Q\347\364\"\227\367\336\245\231\365.\215j\3163\314;\277\r[\036\300\265#\334\356\315b\336\251A\230 mx\270\337\272\367\210\341\256w\251\024\223:*\215\274)aXo\024\005W\f\307U\256RJ(\363\366]/\337\244\224\022\b\224+s\251\\\231\307\234\233d\036\357]\225r\224c\310#+\305\244\224\224bL%\f7y\217W\f\031\245&\231JJ6\246R\216R\f\251\244LJ)a\300bV\325\200!\205\254\302E\224\311\033\003\351\t\271\314qS\256\314+w/\217\261\270\313\001\334\373\304\\\312!\233\370\314\310-\206Q\031\222\311\034\220\214\246\2307\351\246\304b\336\213e\224\342\"!\340\270\272]\036\354v\304\361t\217X\334\013"
+	.ascii	"\244{\217|\335\356\275\307{\257o\371\264\336\213B\216\262\211"
+	.ascii	"\204t\257\223\016\322}:\242\261\270\267\307\266"
+	.string	"\234))\305\246\230=hG\304\232\267\305z\344\346\225\223Z\252b\307\"\367\350\336\313_\324\246\222\f\273F\331\353\3121o\025\323\340\244\025\003\n\212\301Xe\t)m\316\273\\\202x_\261\261\266\r\006\243\263\336\245\005Pa\302z\336\245\023\b\337\221\261\270#Y\253WMR\222\017f\243\353MU\f\036PN\034\327tVUGM\315\244\\1p\362\252\f\254\321\236\3214\336L-\3436\023\002\230\367\"\233\tG\357^$\016\363\005\314\027\240]SWdM\365\357%\245\206A\006KX\243r:)\226\347\226\3302i\3559\304K\243\357\244\277\221:\006\247}`*JH\\\243\254\001F\317\373\350\202\222)d\256\032\315\320/\220\264\213V\362\312\344\"\323\307\267\362od\033u\013f\336\233\344\023\272 \3455\332\311>\201W\016\315b\006\271\336\225\355\250\214\224\250T\022\334\313\034R\336\333c\016i3yCZ"
+	.string	"\316\220\366\355y\037o\224\270\214\2205\212\2013\354q\360i\241\245\240\243\f\031{\231]r\215FY\327\366:\366\260\322\353\200\2632!\341\3401x\276!O\246\306\032e\274\346'\347\235\3618Ar\210i\001Q\177"
+	.string	"\025\214I\251\311\351\216Ew\344\245Q\233v5\247,\317\035v\254m\n\316\250Q\313\344\366\354\247\241I\273\221C\212\307\022,6\2328\324[\200\002\003\263J\242|\317\245\024\026d\267J\304xy\321h\324&9\335\225\345Q\231F\255\230\035S\2522\206I\243\326\210=\302\353\247X$\277Ik\221d\n\223\372\022\360\247\2446\314G\206\202\031\322\302\213\257/\273j"
+	.ascii	"\022u\325\365\254!\222\367\266\002\221\333\025\214\021\267/\356"
+	.ascii	"\222\266%\351\345\261qqY\257\024\211\025\253\245\247\332\024"
+	.ascii	"\204\313\205\365\262C\346\236\354\351\331\256\032$\323\022+["
+	.ascii	"\352i\200hi\331\346\034\227\323\327%/*\207\n*\330,\316Y\215\266"
+	.ascii	"\\9\241x\315\230a\261n\263l\270\320~\2205j\203\274\016\r\303"
+	.ascii	"#\271\205\246\206\372*[e\233\fv\334\021f\307\342"
+	.ascii	"%\245\270\364\325m\323\367b\005\037J\215Z\253\323Y\321\322\252"
+	.ascii	"\332\371\213#a\214\352|X\037\315V\"\347\336)\"g\\V]N\312\324"
+	.ascii	"3\027\367\335\255\021\257}gy\350\024Y\2177muO ,4g0\215i\224j"
+	.ascii	"M\372\220Y\260\254\021Q\317^-\254\213\2579\256\362\202\313\222"
+	.ascii	"\235!\244\n\f\253\364\332\342\264,\242,\223\275\301nN97\271\344"
+	.ascii	"\351,\373{l\224U\3424vsZ@\227\334\224\335auX\034\226i\245l\016"
+	.ascii	"^m\224\245q\233\264'\\g\2757\tf\243\354\221]\262\033\225\003"
+	.ascii	"\274\264\340\334\rA\322\224\203\2668]\005F\312\022_]\234\367"
+	.ascii	"\256P6\005^\355\215\353\330\033\266\311>\261\233\323z\227.\230"
+	.ascii	"y\231\022\362\201\303\007\033\273+r6\322'\0337e\353\216/\215"
+	.ascii	"Z\024\234\232\246\234\220\202\023\257\266\206\nf\013m\314\351"
+	.ascii	".@\3511\365\244^eR\257\272\220\241\3069\241T#\365\276=\365\276"
+	.ascii	"\247j\221l\f^1\260I\355\203L\222\260:\365\214Aj\367\366\030\203"
+	.ascii	"\364\276-\352}o\352}T\324\337\272\260J1)wmV\231\006G\345\310"
+	.ascii	"hM\365\260\303\031\322\336\263G\213\354:\323\241\004M\275\275"
+	.ascii	"\024\350QEI\243(_-m2\3572?MO\271j\"\225\251\3571\255'g\225\244"
+	.ascii	"H\243\367\211\251\357<%{w5\032m<\225\205O\b\006\026\240\226\244"
+	.ascii	"\320x\177\213\351g3\211`\217\214\230F/\307\033R\0330=\3570mO"
+	.ascii	"\234D\032\255\361\315\260\263k5$Ix\346\230,\271\243\243k\347"
+	.ascii	"\016+\337\027\017\265-uo'\212\227G\206H\243\335\345FF\2302?\272"
+	.ascii	"\312B^\323\222\21739\271\346\242\032)\303\204\365\264\300\314"
+	.ascii	"kA\265\345\315\305\247\307E\344HkIU\300\202\245\265h\2640am\321"
+	.ascii	"\314\210\361\204j\364\351\322\225"
+	.string	"+\255\225\243L\205+`\315F?\343\345\355m\216\315\315\255\223f\224\350\031\235\023\211z\020\334mk\267]\255\304\007[[\234wyA|fk\215\327^k6\032%\032\246\316\311N1\316d\260\375-\245\247\264R\373\232\262T\2555\252\341\256\234!\375\214\fum(\235\264\263\336\243\005\2700a=g\222N\234\264\032\337\033\347\202\tk\313\2561\333n\250\315\274aY\221\325\225uZY\243\231\2315\232\032V\305\366\220#\303v\366F\223\372\342B\327h3A\233L^<5\332K~4\221\302\205\252\251G\261\310xm\262V\356\004@\241\023?c\221\t\013t\200\304\"\"\224h\350G\030$\032\213<@\240\"\241\037a\220\207X,\342\231@H\250H(\034\n}!\030\022S\030\207B\037\212\037P\b5\002\213C\300\241\324\350\223\022\207\033\340\371\251\200Xd\374\001Q\344<E\b\236\"\021hB\220\b\004"
+	.string	"\243O\221\004\340P\320\250\026\207\304\237\340PJ\024\"a\004F\340)B\374\214\301\023<\302\341\320\320\360\247\203\0218\2021x\342\302\n\242!\211\001\030\237\"D\020\021O\020\321\217\260\b\002F`\361\202\020E\033g\212>AD5F\037a\020\321\2140\210\310\2460\006\t\201B)P\004\301\"Z,\002\211@@?\337\n\242\341\017J4\022Y \2400((\364\363\001\001\213E\350\017\260\350;\321'\210(\204\315\n\242\261\030\f\002\212pAQ\004+\204~\302\237\005@@bQP\020\205pH\202"
+	.string	"@\023\206C@b\007\013\214B`\021H\264@1\350a\002\032\214\302\242!\211!\240\261\270b\004\237b\001V\374\210D\017~~&~7E \240\361\247\201\303\b\036\236\"\204\n\"\217\nb\206\237\361\367\301\0171\005\026\20367B\020\212!\020\203\277\034\022j@\310@\b\030 \341\201\017\b\037T\300\204\017\t\021|F\b\001\003\206\fB\030\211?\242\020??\023\304!\004\212%\024\177&\200\306\037\020Q\221\316\177\202D\240\020\030\244\036\001\033\034`\003\016T\370\316A\007\031t\220Az\016:\350\351\351`\203\036\365\033\364X \240\320\211_1\370\001\021h\002\b\305\025%\374\004\215E\n\376SB\361g\302\304\017Q\003\361\227\342\0075\372l\320c\024\006}B\303\341\003|f\214E\237\022\212\277!c\360\001*\206'j\214>\"4P\213\306\340\t\3248\304"
+	.string	"\020\260\004aPH-\372\004\201\204C\022\302a\320\3703!h\374\361\200\003\320\007(\004\025\303\023>\240\020R\025@ a\b$T\024\375p\214O\301\341C\" \221\3078\034\022y."
+	.ascii	"\t\201\276\242\217\bB@\241\360\227\342\347\306\350\303\201Q\030"
+	.ascii	",\362\021\001\215#\030\211?c\221\006\030$\374\021g\200>\027~"
+	.ascii	"\202A\303\t\320\274\247\207\204\007\022(\020\001\365'D\021\b"
+	.ascii	"4\034\362\371!\362\374\240\340\021\006\177C<?\304\"O\b\035#/"
+	.ascii	"\226\303\301\005\003E\312\275\341@Z5\232\001\325\312,\253\232"
+	.ascii	"JJ\322\250\335k[\006\275\267{\267\260\244ZW\273g\331p,_\200\203"
+	.ascii	"4\343\322\226\242\366i\237V\217\206\313\323\031\336\255\236\035"
+	.ascii	"\003e\244\253\316\216\261y6D\254\320\246X8*Tc`\304\2548r\314"
+	.ascii	"\034Ga\254\022\033g\0233\t\246\257F\320\335u5\271i\276\330j\352"
+	.ascii	"/knD\366x4j\353l\235\365\302\313\345\361\013\001\214\346\234"
+	.ascii	"f\354\374\326y\353\245\253,(\021\261s\242F\003m\b\025\266.h5"
+	.ascii	"B\310$\235\321u\2204)\314\223\305\\S\215\213aU\307\305f\355\245"
+	.ascii	")ooi\266\013{>\356\302\032\235r[e\212\225\263o9\327\350\336&"
+	.ascii	"\337\026H\214\224N\256-B\234\274\335\312\335f\0211\342j\\&\327"
+	.ascii	"\244j\324b\271}\302\343\313\021e\234}\002d\256\354\312\001\240"
+	.ascii	"\362\242\364\340N\365Ve\255\274\256F\n\332\323F\243\326\355u"
+	.ascii	"6eE\250\236\332n\317\276\324X\3005j\251\260\216\030nol^~0\365"
+	.ascii	"\200\242\336\302\231\331-\232\231]\263Xj\356\021\354&\371\230"
+	.ascii	"\254\005\261{^\245\323\316\205\"0\212Xqr\273v\033E\304\210\323"
+	.ascii	"m\t\301\202l\324B\271}\342D%\315\251f\237\004\203\002\250\222"
+	.ascii	"\311"
+	.string	"4\310\002\2252\b\321\210\310H\222$\215\001B\n\020\204\"q\244(\352\r\022\340\3654P*\246HfD\222\202$i7\334\260\231\350\260\227\017\212\367\027\354\320/\215\227\244\361\277cFO\362\276\214-q\342:\033h\2565\220\310\351\270 \263\272\267u\247\024\315\277\276\003\tY\335\241p\024~\313>\346\346\301\350\303\201\203HF@\264\260\2410\001\322\344\261\035^\016 \244\347\270\301\177\013\267\256.\n\303\b\345'\307\300\257\3531\321_\337\366.\365/D\270\351\312\223$!f\3333\2560\245\322{\224YD*\272n\353*\362&\\\006\2754\t\031\221.\253\310\204\f\327\232uI\330\205\277h\266\337\203p\234\352\262!R\221\221\210\220\201\302S\2505\220\221\300\326P\232\023\275\026\312\350G\022\031\t}k\263\024\262\211~\037\257\344\302v\315Z}\214kKqZ\346VUoE\373.\246\353\304\276(j|5"
+	.ascii	"\320r\236N\213'\225~\253\266g\001\277\352\303\006\024\365.C("
+	.ascii	"\225\217\372}\254\265\351A\334G%\r\201\r\275\267R\346\232\016"
+	.ascii	"p\333\265\302\346\312hP\320G\005N%\022\233\001\271\007$\251\314"
+	.ascii	"\343\3641\244\242\2778\227\337\032H \353K=\355W\t\326\334\314"
+	.ascii	"\205\262\306\0276\367;\311\355\031\240"
+	.ascii	"TD\312\230\240%1\304hv\247\017\266>[\270\013`-V0\306\316\362"
+	.ascii	"\350jh$\204,.\267\020\300\223\220\241\035p\321\263\234\033\271"
+	.ascii	"9s,\002\334|\242j\331\340\025\245^\034\330\322\027\016\300\202"
+	.ascii	"\336:\316\b\021\177\301\036a\351\003#\211\364\t\301\210w9\301"
+	.ascii	"\215~\025\272^1m\321\327~\272\320\212[L\235{\305X\322p:\352n"
+	.ascii	"\226\224\313\307\246\001ZF>B\236Q\326\221\267\344[\354\257]\210"
+	.ascii	"\030\255|\254\263J\367U\361\253\314,v\303\0055mPi\314u,\350Y"
+	.ascii	"\021\362\225`\3338\302\231\330\3701X!{I\251\227\2148&L\300\006"
+	.ascii	"\343\217\353=\256\352\234e\231\020S\r\203?7\274\3414l&\314\035"
+	.ascii	"\r\004\372\317C5\265\002\202P\005\212\230\t*o\310@u1\252>\300"
+	.ascii	"\200\374\256\r\202d=\374\327\03110\016dn\300\277\206C_#\020\367"
+	.ascii	"\231\216\306+\231R\304\001!\336\300\007\307\227\237\354\251\325"
+	.ascii	"\r\f\006\013\327o\346\256_i)\334\241\034\215\331rM\257y\373o"
+	.ascii	"\035\264\316=[H\017\223\2053\240\215(\030\321\177\220\361l+\240"
+	.ascii	"\271>\026\233y\272\232\326\345\242\242\303\326bEq2h\221\334\222"
+	.ascii	"\020\032\021\373x\360v\301\310+4\226\375\002\237\n\200\312\""
+	.ascii	"\300\236H\265\337!w\370\007r\214C\305\316i\f\034+g\336\371$o"
+	.ascii	"\312\225\213+\324\375v\260\350|\267\3575\373\220\215i\3340\304"
+	.ascii	"\024\254;\343\nE:\240\305\255\n\365WE<\254\022\223(~\334\371"
+	.ascii	",\33738\347dNR\322\224C\374\335\266\256\006R\354\234!T\302\006"
+	.ascii	"\344\374\263P\b\f\371\337\262\023\213\214\265e\323\215\220\256"
+	.ascii	"\207%T\366\221X*\210\363\365;E\357JC\0374\221\370`\311\265U\017"
+	.ascii	"\230\340\026\005\350q\365%\305\221\343\357+\327\222x\0202[\322"
+	.ascii	"HK\036\0077\032'-1\352\312\305!\225\354r\313\3229\034\322\365"
+	.ascii	"\263\t\274\306\"\020\261A\256q\244\020\007j"
+	.string	"l\365\241\247\200R\230\351\307\276N\375\202\374jQF3\272\300\265\322\201t\327\372\355\336\321\242\250\033H}#\346&\032K=\265uD\335L\367\354%\312 \270\030\200\307\314%n\336\313\330\345x\242\223y5J\327\356\200}H\335\030\210\311\263(<]\312\250\037\233\376\360\355N^\237\264LjT6\327\370\217&\300\332R%\364\230\330F,\331\026N\212:\207\t\245(s\345I\2627\177\360\362b\224\026\024\352\257\222'\312\270\336\254M\313\356\262%O-\315\2406]?\3345\344xt\322\205\277\244\333\304lpK\312\024aA\036\2140\320\243\215\326`_r@\332\206m\3176\305Y\234\346Pq\346\265\213\272\030\363\"G^y9\r\201\200\356s\3168\020\252\377>yy\320\317\234\324\372\203J)~\372\376s\\\f\322y\344\313@N\220`\360T\310/\336\013\3738\331\027\216<\314\224S\027~6\264\302 "
+	.ascii	"\"\346\300h\306]\265lA \334\326\222\204\265\t\314\343R\344\215"
+	.ascii	"\361\356\353}\235*I$\301\363q\344\223\356\"\305\347\003\215P"
+	.ascii	"C\020&\273f\226\355{\002=\r\305\322V\232\021+\246V\\4\305N\203"
+	.ascii	"a\365\325JSt\217+\320o\346\321\016\357b5\336R\272\265\207;\330"
+	.ascii	"\n\f%\356?\213L^\216\344\313\207a\361\321R\026R\341\320U\317"
+	.ascii	"b\370\307\234\367\236\264&Zo\242\327m\210z\335\341z\356\343\307"
+	.ascii	"\022\377\237\215\224\2629\222\246\272\224\307:\322>\346Q\212"
+	.ascii	"\225\264\027\024\277<\364\r\301t\374\307\377\243\332K\274A\340"
+	.ascii	"\037 ^\360\370@\375\321x\321n)j=\224\331x\257\200\205\370\363"
+	.ascii	"h\227\345\365\371l\323!\252z\350\024=\361\251\366\236\250\371"
+	.ascii	"\361\370\321\257\270tW\367\233\371\264\206\374\242m\314w\020"
+	.ascii	"\262\025\346)~\027\320\245\002>\307\177\346A\275\346\273\360"
+	.ascii	"\370\335\363\210B?\320}\"\376Rs\224\f\017\004\036\ti\227\230"
+	.ascii	"\267\264\217\251\343\006\177m\034\346h\311ME{\b\252k\375\272"
+	.ascii	"\350\273\322*\343\221\317\257\236vC\311{\357\370{\321\030\314"
+	.ascii	"\350\311\215\307\216\320\177By\364m\277q\3506?\357\340^Tu\375"
+	.ascii	"\005.\240\037\237\214^\023\315\270\265\232\3722\2043\n\317\362"
+	.ascii	"\3739\303B\266\251\270DW\177\237\375\026\305\222\240g\372\216"
+	.ascii	"8\247\332\235PS\262IiFqK\231P\377K;\250\366L\007\236\033\324"
+	.ascii	"\266\300\177\021\257\245\215\245\001\362\250\342\233\271\007"
+	.ascii	"\036\325A\347\230\225\202\361CKc&L\326\330V"
+	.text
+	.section	.gnu.lto_.symtab.3a37968579003349,"e",@progbits
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"updateMasksForMac"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"updateMasksForStickyModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"isModeActivationConditionLinked"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"removeModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"isModeActivationConditionConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"analyzeModeActivationConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"bitArrayXor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3a37968579003349,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
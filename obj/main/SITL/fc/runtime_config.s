@@ -0,0 +1,563 @@
+	.file	"runtime_config.c"
+	.section	.gnu.lto_.profile.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 \300\315\003"
+	.string	"\024\005\264"
+	.string	"\020"
+	.string	"\354\270\344\363\013\004\002"
+	.string	"\001\352\263\360\321\b\002\267\204\341\306\016\003\342\201\222\246\004\002\004\354\206\342\366\006\005\243\276\342\320\003\006\002\001\006\007\320\253\336\204\013\b\220\352\317\274\f\002\t\n\013\f\002\002\002\r\364\356\343\227\f\016\017\352\263\360\321\b"
+	.string	"\020"
+	.ascii	"X\005\246!\037\344\240C><\207\036\362\216j\206[7\317U\200\357"
+	.ascii	"\315\355q\3512\32428u\312\r\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 L}\001"
+	.string	"\320@"
+	.string	"\n"
+	.string	"\001\001\002\003"
+	.string	"\003\004"
+	.string	"\003\005\003"
+	.string	"\001\007\b\n\001\013\f"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"*\2033/\003C\260\020\201y\215\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\305\004"
+	.string	"\022F\023\034\240'\351\377\211\254\3702\325\322u\357\267\370\004\376\377\377\315\254%\344,ido\271S#r\f@pG!\201\b\\\336\376\323u\250\2033\020\016\2133IU8\026\311\207\247\366\376\253m\333*\367\277W5\325e\337V\025\231i\274\331\216\036"
+	.ascii	"(\026)\3409\234%3GIA\261\344\200\320\270\302B\035\b\200\006i"
+	.ascii	"caV\271*\00566\242\277\b\026`\206\003x\340\330Q&@;`\016\030s"
+	.ascii	"\001-\260\201\225QR\326u\212&<\305\2779\203KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 f\365\001"
+	.string	"\204\002Z"
+	.string	"\n"
+	.string	"\001\001\003\177\002\003\002\003"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\005\004\002\002\001,"
+	.string	"\001\300\004\001"
+	.string	""
+	.string	"\007\b\005\n\005\013\f"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"*\203\201:\004-\313\371ng\375f3*\370l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\002\230\004\003\204\004\004\204\004\005\230\004\007"
+	.ascii	"\230\004\b\204\004\n\230\004\013\230\004\f\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 \364\255\002"
+	.string	"t\002\350"
+	.string	"\n"
+	.string	"\001\002\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\005\001\002\006\001"
+	.string	"\007\b\001\300\001\002\005\001"
+	.string	"\013\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"@\026=\027\266\354\250\331@z\003K\305\335\305"
+	.ascii	"*\030=\027la\2663\207b\345\247d\002\362\355\271`\013\263\235"
+	.ascii	"9`\333\006\332"
+	.text
+	.section	.gnu.lto_.lto.7e01699e28aabf18,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_armingDisableFlagNames.14.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`\007\003E\025"
+	.string	"\326\246\220L\260VU:\024\374\034\017\203\377\202\0256\025<\017)\205s\302\302\366\003\316N\332\0250\340\362\323c\243\234{\327\200x\331j`\302\235\353s\372FB\016\260\001\300\233\310\311\017\367\225(,\243w\3058;\177\24530\323\226\r\253nI\006\200"
+	.string	"}"
+	.string	"|"
+	.string	"Az3E\337\310\276\003\376\005\340#H\323r\300\277\001x\004i\212\033\360\257"
+	.ascii	"\035\301\232\326\b\377\016\270\021\254y\006\374K\240\306\317"
+	.ascii	"\246\035\032Y!\376- #hS\2540\262D\370\327@\322\360\246\345\341"
+	.ascii	"\337\003.\2067E\t\370\027f\205\020\247\325\301\277\bP\bq\212"
+	.ascii	"\026FV\206\177\023\230\030>h\035\340_\005\207Y\375\366G\fsMO"
+	.ascii	"\036\260\020\211\3545\374^\030\331\024\376\355\263\272SP\001"
+	.ascii	"Lh\356t'\207\362\247C]\312\247\234\312\255\374\312\263\\K\212"
+	.ascii	"8\223*j\240sA\"\032\025A\350\024\006\037\006)\"\336\362\303Q"
+	.ascii	"\3707\205\305\007\027w#{'\374\353R\245\027\3232\341_U\2240\346"
+	.ascii	"K\370\367F\371\221i\203F\366J\370wu\230\325\223\236L\022\376"
+	.ascii	"e5\371\301\332#\274\244\007\023\201\177[MC\362!\360\257\353\310"
+	.ascii	"\217,\036\004\376}!\302\233i'\214\354?\340\337W:f\252[Q4f\246"
+	.ascii	"\257\236\335r,\246[Q\232*{u\254v\346RW\226\331\325;X\020\017"
+	.ascii	"H\310\267\323\375\364xDBA \271\003\"\205x>=r\007\034\"a\013\332"
+	.ascii	"G\341\007H\022\371|@\362\245i\345Z\313\251\2664\273\372$^\342"
+	.ascii	"'~\364\024Wq\026oq\244\2778\214\307\370\214\323\270\322m\034"
+	.ascii	"\307s|\307\213_z\217\3778\220\013\371\220\027\271\221#9\323\223"
+	.ascii	"\\\311\003\215\246=3\364\306j\265\252\242'O\312j\236T\226c\253"
+	.ascii	"6s\262z\326r\016\017\032{uO\316\345\333N:6M\315i\271j\363\\W"
+	.ascii	"4\245\255\2556\317\331-\257\332,s:s\265-\315f\212Co\255\226e"
+	.ascii	"\364\274\253\256\235\245\252U[\251\352U\215\251\032\247\332T"
+	.ascii	"mF\3509s\232q\255Vq3U\347T\235\271S\252f\352\352\324\\\317Z\216"
+	.ascii	"\r\227\272Z\0263 @\303\241\352\004\263b\257a!\350:\346d\003\006"
+	.ascii	"\243\304\365L\346\243L\250F7\017o1\245;\231\350\317\004\326\230"
+	.ascii	"\\3\023\247a\006\343\305\265\363xh\n\314\004\270\313L\346#\223"
+	.ascii	"|f\322h\231\030}\231x\243\227\007f\212Lf\236\311\314=\223\266"
+	.ascii	"u3\211l\235\211\255gb\23173\t\260\257\205F"
+	.text
+	.section	.gnu.lto_setArmingDisabled.16.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\265\b"
+	.string	"\326\020=7@\217\322\001\230\222|\275\017\275\006\253\271@\345\226\333\364\344\254\267\022\352r\235\324\377\021\335\234\005\f\206\375\353#'\313\200L\362\f/\354l'\225{b\232\220-eJ\001*"
+	.string	"."
+	.string	","
+	.string	"\027\310\216\271\263Y\376e\354E\274T\313ew\243b\274{v\376?\216\361T\246'\200\302\356:=U\304\255\267}`;\301\366Jg\375P\323\231\351g\031\205\nA\312.\304\353e]\330\311F\306\366\323~\307=\272\263J\306\354Z\240\224\354~\b\326\004\0343\370@v\f\006:\242-\257\005\3525\365)\t\324A\036R\3625<\"\345\275c>);v\315\230\220pL\234\362e\177\246\324\013\373pw\327\272\262\003\236MC\007Z\323x>\235\320\2461p@\037Qh\304E\255\023C\237\r(j\334C\324\024xs\340pQ\264m\\\314|{\270\272\362B\205\353\244(g\f"
+	.ascii	"2\241\335/0.\020\0047)&R\031bQ\366\025L\271\004K\254\246\200"
+	.ascii	"\273\274h'\031"
+	.text
+	.section	.gnu.lto_unsetArmingDisabled.17.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\r\t"
+	.string	"\226Q?9@\305(\035\240.\220\360r\257\206:\370\351"
+	.string	"\315\030~\226\360n\227;(\230\001ze\277!\272\271\026\256,\373\351O\2463\314\034\214\347\302\214=i\252H\352\353F\b\2212\245,"
+	.string	"/"
+	.string	"."
+	.string	"\317\260\013h\317\374\331)\017-\366 \250Skew\243V\374{~\376;~\001S\244\247Eaw\235`\n\342\326\333>\260\235`\033@\366Y?\226i\325tf\372\026-\343\204@d\027\365\n\260\256\254\004\003c\373i\177\343\034\337Y#_v'LHvC\004o\001\317\f>\240\005-P%\365\252\372\223\312t\217\177\214\374\013\207Dy\360\231/\322\236\245n(*L\257gE\214\234$J\371\262CR*\205}lw\327\272\n\234L\303\0063\267q:\233O\3071h<\035\320'\344En\023?\235\214'r\336C\334\n\3349h\274\b\352:/b\302=\266\272\362\202\206\253\244&\253\206h\r"
+	.ascii	"2\241\375/0.\020\0047)&P\031:*\033cZ\020`\326%,b5\032\334\345"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_isArmingDisabled.18.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 \375\365\006"
+	.string	"2\21505Pm\222\016\244D\214*\247\244\233u\003\246@Q\2670!^\360_\375\331\267\277\263\206\340\257`tkw\330}33K4]\244\027^\234\230:\324h\255m\"S[\225\206\353\202e\326\202\005se0\215\006\255\013\304.\006\f\264\264\007X\0318s\260h0\223e\032\244t\2619\312$\360\344\347kP53\013\n\371\324\243$\315\325\030b\363\312\225\272\233\252T3@\302\363J\337u^^|\247\230\243\377\235\357\335\251\"\215\b\220\304\030*\235D\021\nd\343\347<e\204\004\316[\273\214P-(@\037&1v01\272\365m\267\035\2358&J8Q\247\017@!\306\370\343D\021=\373\027\374\007\177E\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getArmingDisableFlags.19.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03pM\322\001\240\253\016X\204\316c\260\344!s\351\344q\341W\344,\325\266\206\264\235\341\026\361I\200\3727\334\377\377+s\226\331\277ED\340\330\356\275\245L)\226.\013S\206\252\244\004\214f\332P\016\026\2242\220\232\0244P\262\032\340\245\300\025\003\306\202\233\252\262`\024\367\nJ\265|\024\302~\310\343\345o\370\201\223\307\356|\316\273K\r\240\370d\310\216\236\324\013\373m\025d;\235\372LR\bJv%B+\213\342H8lw\354\310\367\370G\307W\213\031Y$\242\0211\242\262\033\241\345\003\357\256]\340\335)\306\257\347\345\037\344\255\303\342\004\313<O"
+	.string	"\204\335ub\331\304\255\267m`\373\300vE\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_enableFlightMode.20.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`\034\001]\r"
+	.string	"\366\330ZC q\223\016\037\363-4\0338\214\006\013:\220O\0044\310\240\252d\244\372ru8b\223\3419\035\326\277\241\r<<\232/\262V\311\377M\0041"
+	.string	"\352%E\001B\fYI\250H{\301\332\004\221\275\245L)F"
+	.string	"E"
+	.string	"E"
+	.ascii	"\351\215\320`}(6\226\035\273\0366\340\005\254\307<\001\353QE"
+	.ascii	"\\;\324\324\374\177\207&<\300\340:\322"
+	.string	"\341\351\n52T\233\200\316\004CP\037`\376=1t\245\314\217\006\273\353\344\272\rw\274m\007\266\031\330O\t\216\232NM\037\300\307\351\345@\215\335\f+\036\253\2121J<\365\333#\3773\210\237\322\256u\271\266o\005\307\256\207\340\321\013\256L\373*\276bt\357\2023\273!f\270\354z\n\274\271\0365\320\266\237\342+#k\001 V-\252*j e\365\3350e\214S[\316\345\210zM\375v*\345\312\226^!t\320\261\3658\313[h>\t\233\234\344\271G\377\304z\214\252/4Np@\311\225\355\221RU\354\303U\2243\367~\353\251\007$\234\007\022H2\213\202\210\363\201\356l&xF@Y'\202\310\307S\0022\ta\235\021\f\344\341|\260NH\204mB\234U\020\ta%Y\026\302@\274=\\EeT\203\242%\277\310\250\262\260\001\003\257Lp\333\202(\3179\200\213NeR\322c\002\030"
+	.ascii	"2\241')p\206\303 \270bp\2451\3626*\341\016\027\270-\2061\n,Q"
+	.ascii	"\025\017_YcQ\355\271\220\307\315\260\266\260\2024\2735\241XN"
+	.ascii	"\235\203v\001)\201V\3354\245PP"
+	.text
+	.section	.gnu.lto_disableFlightMode.21.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`C\001\005\016"
+	.string	"\366Z_C"
+	.string	"s\224\016\233\230\254\274\343\024\224_\313\003\322\246\021\330\371\357\024\275Lk\300\032\334\254\257{\267\326\2545\344\230\200@Cg+\265@\250\333\375K\273\352\225PBx\t\205\266Z\032\341\0055\220O\310\2262\245L"
+	.string	"H"
+	.string	"H"
+	.string	"~\211\233\030\271K\260\005\003\026\312\360\\x\354\202[\200\213`\277\362\002\260_\352\341\335\243f\347?|\034\261\322\372P\244G\r\327X\200\005C\007"
+	.ascii	"\324)\212\250"
+	.string	"\200\370\036>-\240L\231\231\005\273\353\374P\031\356\353\266\031\330V`_DNk\016\376\231\253nL\323\252\351\324\364C2+\230\001/vUZ>\366\345\212\021\342\252\337\036\371\2415_\325e\273\312\274p\006k\0274\360\313\t\262L\373(\236bt\260\202Av9\320X\355\202\b\274\311~\215D\333\001\251\013;B\033\247\2141\246WM\235\252-\376\345(eKU\357\245L\331\3625\365\336\206\214^\035\254\324\360~\334\345+:\377\203QR\362\337/?\005\373\205\251\302\334 \221*e\313\006I\251\035\354\307\335]+\213\255i-&\234\006\020L8L\202\210\363\211\356l\"xJ@\\\347\001\311\307s\002B\tm\235\222\r\344\341|\266NH\264m\b\230\233@\022\332N8.\264i\340>\256\262ht\244\244&\273\320\250\252\300\321#fy\3406\005Q\376s\b\213\023/'%\275%\206\265\322\016\3234\031"
+	.ascii	"2\241u)\260\206\303 \270vp\2253\3626J\002\034X\314\226\312v\276"
+	.ascii	"\267\326R\n\021,\006\004\303t0 \225I\026\325\b\341\302\2104k"
+	.ascii	"4\241XN\235\203v\001)\201V\3354\245PP"
+	.text
+	.section	.gnu.lto_sensors.22.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\255\b"
+	.string	"v\021>6P\215\322\001$\351\252`\370\352\270\323 \na@\345%\3767\233\365\036\372\232\375\372z\352\337\"\224\215\037\377413\233m\242\270^\255c2\226\325\370\311\336R\246\024/"
+	.string	"."
+	.string	"+"
+	.string	"\001\331\241\021L>\275\253h=\002e\345\241\262\333E\245\370\351y\362\277\361\227\362p\302r\241\236\226\204\335u\262\\\016\267\336v\201\355\003\333#\001\232NM?\263\210\230\f\220\354\266b+[\002A0l\233l\214\355L\373\031\3270\035V\362e\027\342\342c\2673\260\006\3400s\201\354\360=\253\020U\306\374\364\232\372\325Ku\216w\224|\013\217Hy\326\241O\312\016\257\227W*cv\207J\235\260\377vw\255\022\206\207\375/\f\241\315\347Y\323,x:\240MS\340|<\"\320\210\213Z'\202<\233O\324\270P\324\020xk\340pQ\264m\\\304t{C\315\244Te\277\224\245B}\t"
+	.ascii	"2\003\302\260\200\341H\204\262\244\313(E\215\007t\004\274\b1"
+	.ascii	"L\327$\003"
+	.text
+	.section	.gnu.lto_sensorsSet.23.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\275\b"
+	.string	"\306P=9@\305(\035p\335\333n\240\320\240J\204%3d\302\220\376\245\334.)\300\246\362\223\372?\342O\317\302)\033\201t#\323\0316\236\3461a\306\236\213}\237\372\272\221\275\267L)*"
+	.string	","
+	.string	"+"
+	.string	"\002\327\245;\373\344\337\305\376\003\305\024\002`w'\264xw\355\374w\374\342\235FW\013\302\356Z\275S\304\ro\273\300\366\201m\223\177T\265\252\372\227E\245$#\262\013\321b\355J\222d`l_\355o\234\243{J\344\313.\205\306\310\356g`,\340\222\340\003\327e|\367R\"<Tx\223D\351\252{\210|\f?\204\364\336\245\037\272.\017\245\212\025`\202\244-\373\033)\254\260\037ww\rQ\366S\001\f\037M':\303\0264\216g\313\0246\035\r\344q\340f\306\231\036M\323\231\031\367\231X\306[\303\206\233\240m\343&\346\333\307\205('\254\254H\260d\205 \001\f"
+	.ascii	"2\241\333/0.\020\004\027)\036R\031bQ\366\025L\271\004K\254\246"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_sensorsClear.24.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\375\b"
+	.string	"v\321>80\305*\035\356\220\357\321\201B\270\202A\231u\0262\024\317\267n\306\332\322\027\234\001\333\260\202Q\213'\306\305\007\021(f\004\023`\204\332\354P\032\007>+\312\326\310\2262\245,"
+	.string	"."
+	.string	"-"
+	.string	"\031\274@\345\231;\373\344_\306>\004\206\032y\355nT\214w\317\316\277\307/^\252\364\264$\354\256\323KM\334z\333\006\266\021l\277\002o\3750\323\232\351\314\364-\226"
+	.string	"&\031\224]\211\030l]Y\t\007\306\366\323>\353\035\335[$_v-X$\273\337\2015\001\317\n>Py)\251W\325\243T\247\177\034\204\344o8b\224\367\236\371\243\312\263T\002\r\025\324\353B\005"
+	.string	"\024\205)c\366WJ\275\260\017ww\255+;\016\241\315\007Z\3234x:\240Mc\340|<\"\020\004\027\265N\004y6\237\250q\241\250\311x{\340pQ\264m\\\304|{\270\272\262B\314e\322\223UE\356\005\r"
+	.string	"2\241\371/0.\020\004\027)\036\300\320P\331"
+	.string	"\323\202"
+	.ascii	"\263.a\021\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_sensorsMask.25.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 \370\325\006"
+	.string	"\"\r03`m\322\001@\203"
+	.string	"3\202;\300\242\230\226\375g\304\351j\223\025j\3017\213z\027`\251\237\016\200o\371\213\242\262`\321\004\rS\366Y\364\224\266\367\2262\245\226,\013\023\206\252\244\204Kf\322P\016\026\2240\220\232\0242P\262\032\240\205\300\025\303\305\202\232\252\262 %\356\025\224Z\361(\204}\217\307\313\307\360\303&\217\335\371\233w\227\n\360\361\344\310\216\235T\013\373m\025d;\235\032\360\0311"
+	.string	"\331\235\030\225\254\210\373\310\260\315\261)\376\30698\276Z\feO$\021!\"\331\215\260\362\201w\327.\360\356\364\342\327\363\362\337\361\246\021\n\301\262\316s\202\260\273N,\243\270\365\266\013l\037\330\256\b\b"
+	.ascii	"2\003\316:#f\b\3055\2216\004\216\031{\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\345\004"
+	.string	"b\307\033%\2209\035\333\374\356\267\345T\373\026\320U\274\211\220\344.633;\b|j\"\"\264\324D\244Y\203\374[\312\024\016<\304\0066\2218\245\341\003\021cd\020\247mw\355Cv\335\200\326R1J=:\275 \235\020\375r\216B\267\362y\365\022N\243\315)\346\323r)\007\217\262\331\370V"
+	.string	"\251\355T\254\303\276\035Y `wW\271K\333\210\b\021"
+	.ascii	",\033\332\262.\303\345\007Fce\3270\203\003\264\003\237\203\357"
+	.ascii	"J\22696\320\031\350h\030A\003z\200o\354\374\210\b\255\312"
+	.text
+	.section	.gnu.lto_.refs.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375 a\365\001"
+	.string	"\342\304\013\020\260%\351\f\3030\245\266\265\335\310&{\313\224\002z\t\330\251]9L\251\205y\031l\221\212!\016\322\241\235\0242\262\363n7\345}\235\032\b\004"
+	.ascii	")A\2119\233\022\327\273\346\030"
+	.text
+	.section	.gnu.lto_.decls.7e01699e28aabf18,"e",@progbits
+	.string	"(\265/\375`\210\016\325G"
+	.ascii	"\272~T\033CP^N:w\343\004T\343\300\267gX\366\2351\246\003\261"
+	.ascii	"C\336\303)\317\3162#\332m\215\221\346\326\3650B\022~\330\033"
+	.ascii	"m\220\337j\201\006&,\r\202<\016\312\315\f\n\036\360\316\374\347"
+	.ascii	"d\362\304J\231\002j\001\240\001\261\001\315\366\3361$6\355\353"
+	.ascii	"\353^\261\002_\267\211\314\333\272\267\243s\360\230,\324\314"
+	.ascii	"i\314\233\203\246\335\037-\222\323n`\331r\205\"\341\256\327\275"
+	.ascii	"\227\363\254iL!x:e1|\307\255\004\306;\347\361\230\007%\333\333"
+	.ascii	"v\024C\272g\247H\274\244\266\214\365,A%\036\036\262\004\225\211"
+	.ascii	"\303\f)\333\243!8y\222D;\275\213\225\216\301\024\277\320|y\323"
+	.ascii	"\351G\254t\374e\005\364\303\204\257\323SX\177\236c*\362\003'"
+	.ascii	"kMN\302\252\324\253sk(\273\361\223\310z9o\364\3366)\350\231\206"
+	.ascii	"-\331)w\3417n\371\3713\034\307=\215s^\350\275m\0211Y\244\357"
+	.ascii	"\256\323\006\274\244\246\254\244\236\275<@\331\345\360^\317L"
+	.ascii	"\352\0213\251oyI]YIm6,\f\372\231\017\243\2203\330\346g\003'\330"
+	.ascii	"\304\377\bC?\237\211\223\376|\327\206.\256\257\215K\374\227\360"
+	.ascii	"?N\375\331\312\317\305\237I\374<\342\347\020?\203\370\331\351"
+	.ascii	"g\017?o\370Y\303\317\027~"
+	.string	"\266\3603\205\237'\374\034\341g\b?7\370\231\301\377\244\277\021\374|\340\347\001?\013\370\271\350\347\3777\374_\370\237\317\177=\377\007\377\013\376\247\363?\316\1777\377\373\366\376\217\371\037\346?\230\377_\376\313\375\207\376\177\376/\360\237\357\177\361\360\360\360\360\347>?\343\371\211\202\004g:\254\327he\356\374\352\350\224u\375\215\301\201\303q\002\244\t\325=\241\f\256a\234\374\331\212\023\025\022\\\303&M\247o%\0336\354fE{\301\330\254\331\325\354<C%y'<\273\341\277!+W\314\274:\345\277\3466\fx\376c\277\242\262\345\277\364\336$\263\003#f\007Ae\246$\237jz\016\264\236\355\254}}\274\307b\"\236`\203Fo\355\233\026\232\365\214\206\231\357\3342\037Gy\271\336\231\261\203w\331V8\317\255g\216\252g2\\\346l\246e3\274w\244{o\326\275J\332<\210\213\303E\330\347\212\2111\001"
+	.ascii	"\214#\204v\312{\177\006\016\027,\336\353v\357M\300\207m\344\324"
+	.ascii	"tzB\216\026\257\224i\345\351"
+	.string	"\364\314\256\357_\275\311\345\2757,\250\275\313\254\242\312A\314L\177\021\023\371\301%\376\b\320\275`nz\326+wI$\235\376op\327\356E&\335\366.Yh\031\222\225\373c&\265\227\214\300\205\236]\266-c\246\316\333\267\275|\225eL\036l\353\\\262\255\023\211t\225N\344\275-\023\211\215&\221\314B\313\230,\324\311L\272\312\213\274\320$\331\252t2Y5N&\022\013M2Ye\0313)\210\233Y \233\347\257\311VX\345\r\362\325L.\221\374\330\326y\003\357\345\350\326]>\270\267\351\\\006&\2150^\226_\220\2540I'\267\367^\003_Yf\316\253\364c\2618\357\305\222u\343~m@\266~\027\n\373!\317\232\327k\353\336\003_\367\"\371\372\335{\221\367^\241ej\261\314\3706\013:\302G\026\245S\242&s\022i-\325hu\372v\376\255\244\2274\327\f\365\260\212\036\257N\217\307K*"
+	.string	"VR\273i|'!R\016\001C\245\323!VR[\254\305z\214\343\352\224\354\351s\257\030\323\021\331\325\363\323G\336c\027\fj\033\323\032\351\260 \263=u\356\236E\212t\330\211\367*\351\222F|2\306'\266e}\207q\017i{H\207\025\b\241\3666h\264\227\207wG\312z\3560\265\301z\311\255\202f\026\005\342\022\250\260\323\023\317\326\263\002\225\017Y\201z\346\302\235\344\266\223\375\265\242\275\310\017a\304*p\235\272\255\376\372;\253\225\355Ut\336\253\274\367\022X\211\31499\323^\335u\3246\244\211\224\326m(\2570\013\221N\233m o\256\376AD\3065\327\006\347\275\311\346:\002to\362\210\331\001\263\203\224\315\254\n\0305=q\311\332Z\306\367\226\222\272\024k\357QQ/,\356L\247\005XI-r\224\310\036\036\366\235\223\003RT\344\257\212Z_;\342\234-~U"
+	.string	"\031\032r\341\212t\263"
+	.string	"\001\245\261\231\300\347\327\235\325\217\037.\\\237w\272\232\351\231d\035\260?\347\302\024\320\013\234@7\353\231\220\231\017\037\266K\333\313|A\327\325\354\323e\354T<xX\317\034\325\310\2335[\234\347\254\247\210P\316\357\315N]\003\006\350\217\335\340 \323\271D\300\275\256\346\032\321\226W\264\255m=\327a\026<\267,\310z\3356\360\322\325\\\273\313\275\n+\023\266,wQ\3263\353\251r\3440\235\236{\262\r\252i\346\220\3712'\277q\241\251j\212\300\325\216\343\321\004U\325\024\026\224\016\253\023V\307\035\307#\r\002DXPXW"
+	.string	"\260\236\234\204\254\240nD\245WG\035P-\006\340\270\202bAd\005u\314q\242\210u\204\001"
+	.ascii	"F\r\243+\253\252+\252\343\225P\215\244#\252#\222\324R\216\252"
+	.ascii	"*\023OAWSHT=\224\002\234\301\253v\034\255\232\260\252\252\254"
+	.ascii	"\232\210j\224\300:^%=j\312\352Hu\224Z\277\241\203\205\016N>\204"
+	.ascii	"\356\364\001\303\007\f\352\235>\030\215\037:\030\327w0\022\261"
+	.ascii	"\236:\030\261\2362h\300\242\232\352\261\326\250b\201uCj*\207"
+	.ascii	"\215\244\343\323\225\024T\216\024\307\0344\240\256\246PHQM\351"
+	.ascii	"\260\202\022p\243\361D\203\030-T\254Q\027\244\246lPUE=\035uL"
+	.ascii	"aQ\365\260j\212\262\321D5\005\245\243)\312\352\252\351\302\002"
+	.ascii	"9\266[\351\004\375\272\240=f\324'\315\033 O=\325\210Va]\034G"
+	.ascii	"\247\376\360\302\340\332\224\320M\237\220N"
+	.string	"\337\355\337l\355\345\215\030<O:u\342%\265\325\214\357\267\356\322\204E\353\342\366\304\264\322nQ#\303)]l:m6\343\273m\201]\231\274N\205\270\254\305\231SC\327\351{\355\357\264\336\"\246O\256I\247Lp\306\267\226\364l\017\230Z\026,\204s\314~t\372\306\362\267Z_a\225eX:\305\300K\252\232f|[!\0062\363\210t\032T\245\251\300\261{\300t\372\246\362w\263\247\024\321\210\ba\323\351\243m\306\267\224#\300;B*Q\320\306\310\230pu\372F\203\016\211y\2026\330i?1\276\241\204\210r\306\326)\321I\223\265\210\026\334\221N\337M\376>k&EM\2653&\235\336\217\227\002\201\027\250q,\207\0205\246ddD$\005I\222\016a\005\204 \b\245\264\r\021 )\244J\210\024$M\n\373\034)\211\340\304\240\025\2065 i\005\205\321\252\027E\275\005\b\205\345R\234Kmx"
+	.string	"W\320\035B\342\275\006\271\311\330\r\3005\216Q?\316I\264:\365\3634>]\345M6\247(\3679\n\013\257j\272\305}\240\360!<"
+	.ascii	"}\254\306\2779\243\013d~\214\216\035\2716\353_\314Q\336Mu\323"
+	.ascii	"<\016\376\304S\b\001\210c\353\277.\345\266\017\321\025\243p2"
+	.ascii	"\322\002\212\321e\024\261\264^\037\007Q\001/\347\210\177\002"
+	.ascii	"\030\233\264F\037g\304z<bq\315{q\351\261:\376\330\232b-\212\006"
+	.ascii	"\321y\375\273+e\316D\307\271m\354T\3501{\213\3032\004(\0275\225"
+	.ascii	"Ddh\313\335. \035Er\021VhwK\372\352?b8\364"
+	.ascii	"\305\013\323R3\261\262\253\034~\247JM\355\016\006Lb\030 \250"
+	.ascii	"\322\313\374\322@:XM\3709\331\017'80B\225\345\374\377\246u}\256"
+	.ascii	"\235\032\302Q\303F\266\224\nd5,\357\222\216\236Y\300<5l*g\037"
+	.ascii	"(\230\"$\\+\002\035\307\206f\2508\225\342J\205\313\202\304\020"
+	.ascii	"\377c-\375\316\224\356(\213\364\200\f\320w\370\211M\r\221\no"
+	.ascii	"\371P\222\363^\334\247\242Y\364\2470\263\346\354\272\263\317"
+	.ascii	"\303y!9\224F\250o\330\035\305\302_Ro\310|\264\361\025\316\243"
+	.ascii	")\256\024\330\232\376\336\231\313\221]W@\342\216\316\0338\024"
+	.ascii	"S3\370\315\0220\376\231h(\270\223y\222'J\253\214n\224\200\244"
+	.ascii	".-\337L?\353\245l\355?\017\216\3360\023\277)t\272\357\302pY\250"
+	.ascii	"lG\203\237\367A\206\276iFY\373\003\024`\324\344\004'\216O\364"
+	.ascii	"r\364\202bk.\301\367\260K\022\261\314\364\007\217Q\333*\274\t"
+	.ascii	"\336\253xjy\242)J\017\344]{\017\357N>\003\277/\216\370\021/\004"
+	.ascii	"\230\202\200\307=\035\0374j{\233wtz\032\352%\002\215\215\252"
+	.ascii	"\312\025&\177"
+	.text
+	.section	.gnu.lto_.symtab.7e01699e28aabf18,"e",@progbits
+	.string	"setArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330"
+	.string	""
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"sensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"sensorsMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7e01699e28aabf18,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
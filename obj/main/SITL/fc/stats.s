@@ -0,0 +1,484 @@
+	.file	"stats.c"
+	.section	.gnu.lto_.profile.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 \224U\003"
+	.string	"D\005\210"
+	.string	"\n"
+	.string	"\330\331\340\372\016\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\272\264\263\242\004\002\002\001\002\001\004\316\305\253\235\003"
+	.string	"\005\200\202\255\250\b\006\262\374\202\245\005"
+	.string	"\007\362\354\276\360\017\006\002\b\240\342\234\212\n\n\013\366\222\265\231\t\030\002\001\002\003\003\003\002"
+	.string	"\002"
+	.string	""
+	.string	"\b"
+	.string	"z\b\222#"
+	.ascii	"\364\255\330@T\372\224f\022D\b\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 6m\001"
+	.string	"\004\002*"
+	.string	"\006"
+	.string	""
+	.string	"\001"
+	.string	"\001\002\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\004"
+	.string	"\001"
+	.string	"\001\006\007\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"?C@\211\265\013z\003X"
+	.text
+	.section	.gnu.lto_.inline.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"e\004"
+	.string	"\302E\025\"\220)\351y`\212|4\036Cq\245\020-\363\345\353\235\204\020\314\314HL\006\322\372\310\220\315\311\226;\005\377c\033\253<N\202\020a( \203\361\005}\001;\2745\020\342\276i*t\341x\234t\277"
+	.string	"\205\375\357e\372\214ef^\277\f\225L\036\024\374\273\004\001\026"
+	.string	"\240\314\025\203\365\314\001=\006na\b8"
+	.string	"\005\236\250\013\274X\261\f\310\212\212\326\364Z\024\232T\205\001\300\265\225]`\371\322"
+	.ascii	",NY>\213h\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 je\002"
+	.string	"\242D\016\027\260%\351\254\210%g\315aD\264j\3010\314Z\304\252\355&\233\224)\377\023\377@\216Yk\223cv\200\bX\241\255\020\267\301\326\304\240\337\205\361\327\352Z\273;\210\234.\002\006"
+	.string	"S\020"
+	.ascii	"\243\342\365\274\023\305\002\260m\003m"
+	.text
+	.section	.gnu.lto_.pureconst.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\007\230\004\013"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 \227\225\002"
+	.string	"\004\003\213"
+	.string	"\006"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	""
+	.string	"\002\001\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\007\001\002\t\001"
+	.string	""
+	.string	"\002\002\n"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	"\013\002\013\001"
+	.string	"\002\002\013"
+	.string	""
+	.string	"\r"
+	.string	"5\013\210:\006\r\005\370\211\304\253\213kV\332\305\250\031\214\245f\260\360\331\255\0010\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.41a794e2f65b9b5a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsInit.21.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 \312\225\005"
+	.string	"\362I&1pi\323\030H\361`\020\254\260\025P\350\226N#R\213\213\034\305\"D\030\363a\"\262\216qc\335\377\177\353K\264b\336\354\306\337\264}kVn\231\002O\221uI\227\025'K\314\\$L\234*+F\320\224\246R\305\213\242\252\370x\233\3329\016\237\200j+|\200"
+	.string	"\230\333\220\206O\323\354\275\f\352\301\347b\265{}H@\021\273\005\025\024\3739\f\t\177>c\017\021\031p<\020,L\354nT\204\304\022bg*dc\343\262\204\f\312\356\0167\316 \327\374%\377\344\337\004\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_writeStats.22.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\235\n"
+	.string	"fTJ@ m\225\016\320\332]\251\004`B\263\364\002x\353O`\200\340\013\246*a\313\"\321\"/\337\337\3208b\200\372\027\372\254{"
+	.string	"\300"
+	.string	"Bi\201#\235n\277\231\034\032n\375\030\273\"\177\223-eJ\0018"
+	.string	"7"
+	.string	"7"
+	.string	"\007(X\243\013#v7\323\006\337\01657\377\251Op\335\347\020Sp\205\034\253\f\"*:\021\244\220 pO=\021t\241\314\210\307\356:\271.\301}\335\366\207\355\r\373\223\316t<\352\317L?\242\245\021\006\214\r\273\244\257\304v\2704D\220\330~\332\237\360\323v\224\201[\354\2328\250v\275\016k`\277\354\235\022\177a\237\304_\336l\020\031\001\352J\214\372\3241\017\026>\210\262\345\277\022\257Q\235\243R\350\024^\201\200\377\300\005<y\356\227\357\211\277\256I\"\304\202S\t\224\237\355}R\031\330\327\357\373>\253\311\001\232\220\214\006\215\261h\235KG\3130\232,"
+	.string	"\310\005@\206\341h\231\345\302\033\001\031N\326\331l8\231\304\333\303U\223\241\204e\255@\032\202\273\273\020K{\200\226\347\254\372\271\203\326J\025\017"
+	.ascii	"3\2413h\214\254\202\203+\200j\037\244\260\210\013\300\204\253"
+	.ascii	"Q\341\031L\271\004\333\254\246\214;\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_writeStatsEntry.23.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 c\375\002"
+	.string	"D\0053"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006}(\212\001\202\200\200\374\342\203\316Q{y"
+	.string	"?\202\210\200 wu\276\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/fc/stats.c"
+	.string	"\003"
+	.ascii	" D\312E\003(\002"
+	.text
+	.section	.gnu.lto_statsOnArm.24.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\325\007"
+	.string	"\202\31635`m\322\001"
+	.string	"w\005\205q\206\"\031\267\365\265\270\003S\317\252\337\256\235&W5K<\026\264\004\376\267\031\323Hi\020bp1D\345\274w\\\315i\204\020)S\n\266.X\206\311\260g%<\205\ff\363\254\013{\027\001\303\005\204\353e\020^\317\302\355\247U\320\301H\327Q\217S=4\031\370H\3627\316\241\331@\250\024\310\be\342\352g\\\203\301\2670\306\241|Nu*E\221\324\311\222\247\264\033\034\362\361\032\3600\352<\272\331\334\226Ja\177\332\335\265\202\354\247\363\351W*\021\222\201\217\335\210R\312vT\310\205\355[\254\331&\347B\373\216\020\204\350dw\237V\\{j\3761\016\020?\333\263b\260\273\316\370\221\270\365\266\tl\027\330.\t\020"
+	.ascii	"3\241\315\037xg\356\3544\f\f\177\325\243\250-`!pv\324\302D\255"
+	.ascii	"*\317\365\350\202\313\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_statsOnDisarm.25.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`_\003\225\026"
+	.string	"F(\215J\300\224Q:t\216U\201\034\020\007l+\253J\200\331\376\023Q\030\226\210\334\n\377\f\311\261\231l\027\003\242\t\355\350\337\246\365'\254\366\363\376\f\243;\r\002\216\"\222\375\227\3322\3453\251\376\356\323\215(n\274\354\023\2627\2212\311u"
+	.string	"l"
+	.string	"}"
+	.string	"\345y\357\321^4\033s8\2142|*\236j-\r|\356\200\361\323\345+\3643<"
+	.ascii	"\372y\325\322v\203\274\334\325\373\206v^@\325Z\311\036q\332E"
+	.ascii	":\303f\332\376DO\341r9\027\307\017\247\254\362\306\323\303CV"
+	.ascii	"NC\350RkU\345t\270\303\002OGH^\236{r;\341\212\317\020\356D\347"
+	.ascii	"\r9\033\263\030Sk]\306\345:|\307\357n\335]\002\273-"
+	.string	"\024\023|N:\034\265\2736w\361\032k\3259\260oq_\206\275\320\347\306n\370\270\317\375\r\375\344\206\341\001\376\360z5\016\356\2266\356\240\335\207\265\201v_\364U\tyS\232\027\245yY\315{\322\274\253\346U5\257I\363\246\232wl^\261yi\363\316\346\r\233\267\231\227Y\022T\250!,\301Z}\202J*p\"\225x\321w\317b\0379p\230\364\1777z\251\266QC\245\307N5=\022\341J\2631i\354\377@\364\304F\232\2754\035\035G\344\237Q\332b\323%\267\237\225p\243\331Xk\235A;\225[J\262I\274\024\273\320\310\247\205\347\207\357'6\275Eg\2534+\335V\3308\270aw\317\376\315\204\3550\036\243\265\027Z\027\rM\277\370\320\255x\267\306\002\037\327\375\362\017q+\002\264u\316wQO4\272\203\366E\271\0032\n\274.\230\230\254%\213\221\256\n\344\205\232\226\r\351\202\305H\230"
+	.ascii	"\373\302@\003#e\257\027\214T\225\2657\220\202\023\300Z\333D\026"
+	.ascii	"\336]\300\200\217\333\023=\006\001P\b\n\212CS\032\346srJi\001"
+	.ascii	"=\273\037\236\256\306\301\331A\307\241{\036\357\201\323@F\206"
+	.ascii	"~\212\"t@\031Ai\246\035\2546i\024\246\317\350I\263\272\005\310"
+	.ascii	"\252U}\002t\260\352\224\256\266\364\337\354\301\314\f\375T\365"
+	.ascii	"\225H\350j\020\036E\250A@\306\024cfLHA\031)H\016\300\002\021"
+	.ascii	"1\353\006\021P=clj\nm\007\263\340\235}\313\265,\025\3364r\311"
+	.ascii	"\307\272\244\256\256cq\336\260\210\264K\004XC^s\207\307W(\251"
+	.ascii	"K\356\013m\311\210O\220\344.JO.If\022\206\355\326\2706\325s\270"
+	.ascii	"~\f\354\301\231Yx\371\372'\036\217\273f\313,\007\201@\026\310"
+	.ascii	"\351U<\263lO\217\200Y\316\223\200\017\252'\212C\376\263\374\346"
+	.ascii	"$\303Z\224U\016\013\301)\260\320d\032\324\306s\235{Jvv\006\233"
+	.ascii	"\251\032"
+	.text
+	.section	.gnu.lto_writeStats.part.0.35.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001\345\f"
+	.string	"\366WVB\020s\223\016\030 \321CPQ ep\300L\335E\033\233\013\302\013p\366\351\206\217F\242\307\327t\267\206vL\006Z8\363/\302\020\332\210"
+	.string	""
+	.string	"\200\002\200\002\354\317\263\301\220H\035\333xb\367\336R\246\024D"
+	.string	"?"
+	.string	"E"
+	.ascii	"/\t8\004(u\230\001dw\251C=\361\354\360i"
+	.string	"\306\314?\351!\332\3469\004\260\211\370Km\013q}\016\272\034?4[\350\211\244\244\320Nz~\330@\231\006\0363\021v\327\223\312\235\271m\t\266\033\330\277\002g\271}\027\035\237d\215\355\263t\316\241(P\017\3731\361\340\320\231\366_\034Fv\016\345\005vE;Zv9\b\207f0\035\232\273H<\234~ \036j\016\337\302v\307~9\267\262 \234\331\001&\024\242\212KH=\016I\333\312\220\327<\200\306\346\362\025\230\256Eud\373$^\257\030=B\t\343\230\266\206\ry\355\232\301\321\225:\220zRG\326\370\267*\2625\375i\301\b\002$vSb\202l\t\250CE%\025H\260\347j\004\343l8\030U\225P\027L6\026\250\352\302\250\021\004\2660\220\\\024\307\262.*\377VE~+\266\324}\024\004u$\343\276\215\3378\361QxSA\277\212\207\220G\r\026>>\031\363\004\344\373\204h\007\032"
+	.ascii	"x\013\302\2671\374\020\370T\032\324\b\245\215P\317@\342\252C"
+	.ascii	"iZ6u\274l\b\016\020\005\303\\\341\224\232\300uQ\301\365\367\264"
+	.ascii	"RT\273:Wq.0N\\\314;-M\323\024\272\327\2261"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.38.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`\230\0015\016"
+	.string	"\306\327WE"
+	.string	"\2216\035\330*\261\323?+\223\276\344\331\030\245\372\337\277\307\375\250rv4;\b\217\364c\200w\013\bE\257q"
+	.string	"\nH\264x\007\353f\332\241\377\377\377\321L\255/jC/\330\356\263;l\216\244i\223\275S\n="
+	.string	"C"
+	.string	"L"
+	.string	"\273\213U~\251\2631\354\363,lw\237=;\307\253\312>,q\001\225\332]\372)G\334\273\214\225\347\277t"
+	.string	"$pt\031"
+	.string	"\344\360H\340\225Ggw}u\270\347m7\260\375\300\216\t\002'R\273\225~\272^1\307\341!\344,\2262n`\376\351+>*\354n\022\261\306\244.\370\275\344\207\365.\274\233D\256\321w\271\204+fv\353\346\323\f\256O\315\rX\237\325\013X\237\036\371\212%hCE\237~fi\037\361$\037\365gh\001!s\"GQ\246XV\257V\212\260\345\202\230\001!v5\354\320\261(s\206\211\237\036c\033\361\346\340\024\277\227\316 \235\022\f'\325\313\207\231\026\2515\251\033\273\034F\210A\020T\225\r\037)^\004\2460!\304A\210\376p6\316\303m\364#\201Z"
+	.string	"y2\372\021m\224s\300Z(\202\210r\232&\242\230\355x\377jA!C\"K\244L\261- *0\241\3340\326Y\016\223]\273$4^\003\344\223\370t\205,\236\024- p\002)X\267\001dX=/\033\2611\356a\201\023\211\306\341q\227("
+	.string	"\310\363\b[\f\303E?\034\031S\035C\233\025VIL\266\342]x\327\305K\3509\004\234(h\220\274"
+	.string	"\356>\035pmX\354\311^X]\027U<5\202\017e~a\2276X\220\241\204\262\346\255\260"
+	.ascii	"l/ \247?\375Z3\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\345\006"
+	.string	"R\312%,\200'\352\234s\2513\034\002\023\2301\\\030S\204D7\342\031\220\031\230\033a<\024\377\t\277\264\322Jk\334\322\032{\376\334mK\231\002_\244\0168< \034ILb\302A\232\343\251\374\276"
+	.string	"\345\217`\371SN\365 \002\242\201\371\313X\303\330\272\230a\361\242\342L\377ow\377\032\305\230N\r\211\253\215\236\r\332\340\023adj\273s8\332\027 S\303\002\313\\\360\377J\205\356\3159\347\302\322\276_\271V \370\177k)\271\204\237\177\006\003=\272\273\025\f\260\377u!\033"
+	.ascii	"@ \030\020\334B0N\242o\006\301\276A\270\f\n\324\003\200\003\200"
+	.ascii	"\003\200\203\017\370\330\023\306\303\266L\220\245\002L\325'3"
+	.ascii	"\203[\f\304\307\303\330\241\244\300\0026\3524\004\243\bE\226"
+	.ascii	"b(\314\253\240"
+	.text
+	.section	.gnu.lto_.refs.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375 [\355\001"
+	.string	"\262E\016\022\200'\35230\003s\207\320\"\372/d{'i;\245JX\007\257`\033@\n8ZL\211m\232\242\255\231\022\243\3174\t\332q\264\314\303\250*{)\262\017k\313\273Z\b"
+	.text
+	.section	.gnu.lto_.decls.41a794e2f65b9b5a,"e",@progbits
+	.string	"(\265/\375`\303\020\005R"
+	.string	":\207\034\036U@\020JJ\007\253\017$\252/$v\275\177\335\260?\346!(\272\372\305\335K\034\2424\0351\004\001\273\362.\264\346\346TB\373\225\003\354\220\270\325\354\243\330\252\314\274\3731\250\316\244\356\273a\355\3179\026\312 \352\361\t\354\362bN(\312\024\341z\251U\322\266L\001}\001\320\001\327\001\335i\335}\016k\201\331ph\272\255\304\270\272\333\363\222_\350\374\306.0\333\007\031\335V:r\224rNbu\335-\020P\017\020\220\214\226\016/:jVn\346\351\351p\263'\262\377\200e&\254\306\324\037^;\247\361\222\3230\265=\245\231\323\222\343\354\256o\301\236\177z9\374\323{\004,\b\346\351\255\314\241\307H8\tS}X\t/)\315\271\261+b\027\346\2567\301\236\317\356A\331&\036"
+	.string	"{\366\351\361\035\373\364\316\262\2572\217\331\317\315\227\271\345\227\324'\247\235\202\342q\327\237\313~\006\3430&\3431\237\242}\326\335\356\314\200\271]\235\335\225\311.\217q{&c\261\2230q\037S\207u\267L\266v+\231C\3400\207\220i\333R\232\365\326_\366-\363\364X\346\320\373Y\201\025?\253\340\024,\301\315\177\005"
+	.string	"1\3443\200\003:\377\235\3619\371\377\302\3777>a\342\004\374\327C\211\006~^\200\304\177\005\356\373o\210\377Y\376_\371\217\345?\335\377.BL\367\363\375y\304\177%\277\377\037N\363_\336\3175A_\377\313\300\317@?\377\374\034\342g\237\237\t\370\271\347g\233\237\003\370\271\303\317"
+	.string	"\374\254\3633\316\317\276\237g~\346\237e~\346\375\027\363\037\314\377\265\377c\377\353\376{\371\257\345\277\f\377\343\376K\377\227\375o\377\027\360\037\356?{www\367\337\004~\336\207\337w\f:\315\024Mv\267O\035\346\2312\311\314\251\325\2239\215>w\232\251\223=U\356`\231\242Of\\\364\251\303\234*\237L&\253\347\316\217\252\226\024\247.\3128.c2\365\f(\034J\247N\225\331F;J7\2375\265\363\200n\034Qg\024%\025\253-\2533\226i\312\250"
+	.string	"P\313\253h3U\231B\242\335B\226G\rU\"\331V[\005\256&y\340\350\247\246\356\001\272\355\206\352NrW\273;\331\3353N\034m\367\r\035&\027\024T7\264\007\252q$\327\232\272\357\331\024\265'sz\025\025ZC2\345\352\030m\222\271:\212\225\223\235&\313\372\251\273Y\013\313\365\224\312rW1T\202@\307\270\201)\352\221\244\311\222/^n\021\026\332\234E\230\271\234\251\314\205\275\\\320v\262\346\352\206T\\];\241\"dz`AO\270k\227\236\234\255'VXw\375\305b\177\247\266\320\321H\245ilat<\003\223\341$\333\216\"1F\307s\314\306\325\263\n\302\302\330\355\t\327\360a\311\274"
+	.ascii	"\214\030\035\333\300U\270\nm\233\206\007`QuZ\030\013g\341+Le"
+	.ascii	":\206r\276\201\255\274\247\355f\352n   \240\236\033\267'Yx\324"
+	.ascii	"\254\027\004s\250B\005\207\256\306V\326]y\nc\231kk\322Ea*K\271"
+	.ascii	"\025_\367\207\232-]@\324\356z.\\\303\bR7\264s\354\031\006\366"
+	.ascii	"\347\032h\340'sjew\2452\r\f\345m\367\330,\247\2222\250\354y\312"
+	.ascii	"\236\307X\206K\325\354\242\021\204c\370*\215\336\360\224SrL\344"
+	.ascii	"\336l\276\254y\265w=OI\230\3407>\302h\\\205B`"
+	.string	"d\354J\003M\300\342\030\006v\302pL\3457n;\273\361\013_\333hP\344\236\226@\232+\365\204\254\253\273\256\260\302\335\352Q\233n\252nM\001\214\330\224\2550_N\210\216\211\363\341\3436\317cj\035J\270r\2446\222|-\271\272\272Y,- -\252\016\001\270)\227\024~\263nZ\370r\341\356\256\227\307\305bM\020cD\r\353\366\300\271\002\245l\352\362t\307\304\351m\253\21550\2712\024P\270;\036h*]_\367\206\226\030|\334\350\357\016\273&,h\325\021S\264~X\345\310q\233=^N_\023&\221\034w\275\314\024{o\334\270U\035\206Dm\020\363\323\363\343k\205*&\243\t\342u\365t\005z\246^(\217Y\245-\005\002\325iK]7T\004\033\327\325d\214\334\324\024\263\255\355\001oRq_Kj\324`\266U\332\317\r\324\240\\\371\222\t\322MU\254hP/\r\016\263\266\375\344"
+	.ascii	"\206\225\212u:o\223\273\241d\365\222\334\240\005\367\304\316"
+	.ascii	"\230q\233l\027PE*\356\313g\303"
+	.string	"lK\221\273~U\312\270O2n\323\351N\267\311&\273\331\354\007\353\2265\246\352\256\277M\336\026\366<\031\330\377\306\210\301h,\355\250\026gUvu\335ND\344t!\222C\313\213\275&P\257\tL\306mG\r\305\265\"\316\303b\373*\373.{\335\334F\243\234\ru\376\374\347\302\324\273\274\314\023!?\224\330\361\335o\3627\311R\270\235\335\320\346U\371\002\205\376\364\356\2240\207\334\365\274*\366<\031\354\357\337k\245\263\273i\310\264\355\\\372\3162|\303<>\240y%\242\335@\252[X/&\312\252\273\376\007\321\377\352N\356t\333N\346\324*\311<\362\344\271\323\366\016\017=\345\321\314\326\352\271F\373v\333\334LVO\021\230m\324\311l\243\311Bb\bA\344\022\213\337\321(\034ah,\032\240\247\002\247\250h\202_\322\260\307B\003\016Z\250Pa\363#z\341\001\006\3228\254`x\203$D\036a\270"
+	.string	""
+	.string	"\211\bxT2\372%\r; \245(bP$!\211\270BHT\f\272ha\001\317qH$\016\221\200H\306`\r\222q\202\242\0065\310a\021\003\232\033$c\3608\254\240\250A\207\037\005\021\001\213KF\003\216FA\342\n\243\342\020\311\030\264)\022\032\207K\"\b9\020\216\020<\372jF\004!\215A\245\240\235\023\r\215\302\242\320\210}\211\023\f\234\030*a\346C(F\240\030\321\373\020\n!!\024'\204\330\237\020\342!\221\300#\013\366H\027B\344\320HB\316\217\202~D/\004 *.\255\360\261\304!\262\330A\221\020F\220(,\362\035\2010\214\310\242\212#\"dP\3518,\312A\226 ,\256\302\245\r\212C\031!PX\224\304\302(T\022\nC\360\375\310H)\200')\t\215?dR\222\361gs\004\032\r_\024\223R\034\221GFC\342\013\016G\240\020i\210$\321"
+	.string	"\213\004D\036\207E@b\020\231\204\004\002\200\004\016!\213\303\245\231\013\t\245"
+	.string	"\321A\006\026\260DA?\242\027\277\3420\210\364#2\036\177A<EBb\b\301\242\020xD\006\221\307\033bR\022\005@\231$Y\325*hRH\216\204\260\342\003\2056m\255\316\305@\275k\333^3\032\235^\332\320T3\223\372\210aC\207\364\226u\265J41<\253\266\236\273\353{N\254\021#w\214f\306\t\264\306\317\330\025\263\321\242R\301\211\335\2607.0^bZ\027T*\330]0n\223@\215jiWdG\r\022\026\250\234}\335*\n\262<\365\270k\033\346\213\212\322\212\022\031sd\306\221.C\230\215\245Z\2516\205\204\341\001\231\001L\322k\213\007\307d\b\013]RV\"*(\263\202,/W\201c\250\2014\246\030D#\"\"\"\"I\222\244\003Q\005\204 '\251\254\007\021@)\263h\212$I\2452\314\001\260v\220j"
+	.ascii	"\016R\262\356\223\211\245+K\217?!O\006 \2604"
+	.string	"\034[\320\023\364\203\217\016\005\223k\204\347r\205\356\3454\362\205\216\327\310K\021\360\023\335\277\361Y\024^\316\276\016\257\251\336\006`\211\f<S!\236\333\2142[~]\373H\242>\356\001\322\227\230\345i,ov\031\212\370< \360\037w\017\221\276\237\222\245\366\371m\347r\021\306\364\373\036\0336\352\311\226\213\226\177@\240'\237\035\035ic\321\220"
+	.string	"\343\241\017\3541\\\273\311\023S\353\004\262\005o\212\352,\307\240\205\337\376\364\025=\030Bi\227\357:\273j "
+	.string	"\226N0\361\034\350\347\256F\236@\276O%\235\356E\367\327"
+	.string	"U\235\346\003\2549F\220\374\360$o\210=w\233\362q\323\361\273F\302>\036\250\255\2141\362\f<\263\342\233\254\373\316\317.@\365\0302\177\237\016F\205V\006\002\333Le\365\245b\365L|o\037\tKl\034\305Vc[\202C\027\346\245C\230\013*\220\223\032\350\254\032_]\361\n..\324\312\353\203C\325J\212F\bj\031\031\005[l%h\351\312.\177m\340\202\204L:\240\223i\223g4\2549\335D\266\342n\035\\\252\f$j\360\304k&\025f\003\331\354\300C\227lG\357)\265\007\302,\\\312\360\347f\374\203s\214\204\033\351<{\212\322\310u\325\254\211\256\340\364\275\377\002\23363\200?\204\016_j\242K\3767\017'YN\326P8{tP\002O%\355\245V\363\264\271t(\371\3250  \022\255\215\342"
+	.string	"\261|\271\236&\243r\3137\234\264ks\275\371\322\226\250\211Pj\222\274:\327\370\035\f\273W\223\002\350\037\004\217\357\360\026E\264"
+	.ascii	"\250\313\340\017\300\270(\370NI\352y\365L\226?%\204\244\034{"
+	.ascii	"SlxbrS\036_\021\013\037\214\007\322\373\246I\310\316y\"z^\326"
+	.ascii	"P\rn Z|\347\245\017}\230\332W\316\":L\233\275_Vmi}\217\366/X"
+	.ascii	"\032F\360\365\344/4\030\302=\020\200l<\274\217h\232\241\300\337"
+	.ascii	"\302>\300\365Cy\337|/\271Y\337\017\325\317\345\337\313\257\226"
+	.ascii	"K\356\367=\366\334\230FS\366\263\362\273\370\376\364y\017V\246"
+	.ascii	":\203%\343/8\315\353f\305\025\217\215\302\031\342~\037\334\223"
+	.ascii	"\202\017g\323\302e\301\275\350Xp.\377uY\264\266\253\366\315\212"
+	.ascii	"<U\263/\3539{c\027Ka\024vq\373\017\023\271B\256\002"
+	.text
+	.section	.gnu.lto_.symtab.41a794e2f65b9b5a,"e",@progbits
+	.string	"writeStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"writeStatsEntry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"statsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"isConfigDirty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.41a794e2f65b9b5a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1406 @@
+	.file	"tasks.c"
+	.section	.gnu.lto_.profile.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375 \264\025\005"
+	.string	"\324\b\250"
+	.string	"\017"
+	.string	"\314\345\244\232\005"
+	.string	"\001\223\317\352\353\001\002\002"
+	.string	"\002"
+	.string	"\003\276\376\210\236\003"
+	.string	"\005\312\336\235\231\b"
+	.string	"\006\275\236\357\212\016"
+	.string	"\007\313\233\235\316\016\002\002\001\002\001\t\363\240\274\354\005"
+	.string	"\n\376\376\316\323\004"
+	.string	"\013\376\303\253\241\n\016\305\352\265q\017\220\232\246\235\f\b\002\003\002\003\002\001\002\001\020\240\342\234\212\n\023\207\311\252\341\017"
+	.string	"\024\331\335\320\254\f\020\002\003\002\004\002\005\002\006\002\007\002\006\002\001\002\002\t\002\n\002\013\032\357\337\327\312\017"
+	.string	"\007"
+	.ascii	"_\005\334]>`\004g\334\250\246\007W\342l\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375 \365\225\003"
+	.string	"$\003\351"
+	.string	"\r"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\003\001\002\001\005\001\001"
+	.string	"\001\006\007"
+	.string	""
+	.string	"\t\n"
+	.string	""
+	.string	"\013\016\017"
+	.string	"\023"
+	.string	"\024"
+	.string	""
+	.string	"\001\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\034"
+	.string	"7\t$e\007.\266\033\3011\230\251"
+	.ascii	"X\004\023v\002T\274\013\020\007\216\001\023\027\0130\327\na\252"
+	.ascii	"\222\353\205alrw+\327-\2068\013*\206W\332f.\200)\200J>\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.inline.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\346\002\355\t"
+	.string	"\202\013(0`k\222\01605\260\325!a\t\362\315\202\247\357%\030\307\231\366\360G~"
+	.ascii	"I\021\300\261x\200\033\002\202 \b"
+	.string	"\202\362\220\265\337\250\331\326Z\333{\247_\001F\\`,\003\006\370\241\240\261\270\206\005f\r5\0206<\326\001\224\334\264\225`\264\215\f\220\034K>\377\352im\247\251?\212N\3462\275f\355\021qB\"\341a=\375M2\243B\003\261\220\343\260\300P-U\244\243g\350g-\222\233\\G\201\340_%;:\231\013\365\315\332\375\024>N\260m\243?hky\374#HL[\350\253\223\023B\250q\036\032\t\244\030\244X\353P\242AR\235\007\022\200\001r\002\006FI#P\002*(\341\004\025\325l\357\001\277D\352\030\217)\354\210\271\356e\226\250(\244\214\275\317B\\\260\036\222E\226}jU\006\342H\256\350\351\345JY\332V\242\266\222VKd\332\253]:)\341\236M\307\f\314>\3771\026z\321\033\367\356r\2315x7o\214\235\352H,Fiq\373\315\022*\212B\022JR!\200b4gn!m"
+	.string	"\317\310=>}S\375\242"
+	.ascii	"\273\023\274\2463\251\033\244\002/\024"
+	.text
+	.section	.gnu.lto_.jmpfuncs.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`5\004-\r"
+	.string	"\346\2204/`k\222\01605\004\311\206,I\276\245\316\001\013"
+	.string	"\200\020\225\366\n\202D\274\323\036 @\220]\353"
+	.string	"\212\3521\373\375\255\337~\373\233\020\"\223\f&"
+	.string	"#"
+	.string	")"
+	.string	"o\256S\241;\374p\300\033\210\220\320\031n\320\334\270\333b\213\234QUU\325\214\303\031g\222\023+\324\373\224\260\t\004c\244\256\277\034\277\\\377\310\bcg\256\205H\322\006WF\362\301\207z\2505\327:\332?B%\277Mo\356\355O&C\334n\361\025\227u:QD\241(\212ZC\ne\340Z,W*\022"
+	.ascii	"\tuZ\037q\362\304K\034\3205\215\271\003\344\237\306e\004\013"
+	.ascii	"\234/\027\025T\325\335\363<\036\024\020\3107\343\266\305\270"
+	.ascii	"l-\306Zs8.n#\221\347\314A\220Dr\304\001x\2501yC3)ie\347\360B"
+	.ascii	"*\262\r\022\240\320\213\220 g\234\241\021\n6)M\373\006\"\375"
+	.ascii	"P-+\236_\223\235Zw+\323`\320>\256\312ax\323,}-R\365x\023yR\335"
+	.ascii	"\270\306\215~\277S\256.\312E \350\016\207DZ~\226x\303\370)\374"
+	.ascii	"8`h\rcP\250\270\317\240\207\234_\206\306\253\202\220a%\013\020"
+	.ascii	"\203\005\024\207\260!\354R\225\274E\231\241\254\203\353\230\227"
+	.ascii	"fdP\233BU9$\263\017\"\256\355k\306\n\375'\260Wt\302\355Rc\260"
+	.ascii	"\023\303\301|Fba\337\277\251q\303\264\260W`YM}\250\004\302\016"
+	.ascii	"\215s\363\212O\b\202\225~j5(\n\305\035\017\017\216B\006\250\312"
+	.ascii	"\250\333\213\026\274\373\3409\307\312e\366"
+	.text
+	.section	.gnu.lto_.pureconst.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\230\004\001\230\004\003\230\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\t\230\004\n\230\004\013\230\004\016\230\004\017\230"
+	.ascii	"\004\023\230\004\024\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375 \365\325\003"
+	.string	"\022\306\021\034\240)\303\030\377\377\377\377\377\377\377\3773\355\177\373\337\332\247\343\333\377\346'yK\231\002\377\242L'\222\0253\215\254 \253\307\312\261\263\261bL\027[\022\231j\246\315\316*L\210\003aP\260b\n\f\370\264<\253a%\025"
+	.ascii	"\003\371V\026\247@\370\251mkR\332\305\200\340\252\272\300\271"
+	.ascii	"7\341\302\250\332\315'9Vaw1@\030 \007h\332\346\233\235\273@\343"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.lto.faf516c52598b806,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskMain.120.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"-\007"
+	.string	"\002\01634Po3\006\240\3703\b\332\021\023a\372f\b\334\302@=s\227\226\003u\244\304X\274\225\263=/(\345j\242\016\"\356\246ZJ@%z\253\341\322&R\246\024\231\303\325\3414h\236kN\t+\240\226&\203\3106\232\264\036\244\207\263\351HkfRCP,\342\232R\303\260)3\336-=\206\312\300\362Y\304O%\330NP@w\205#*\337'r\255\307\301(j-\375\177c\250\215\325\212IA\312\217\361\342\362o*\361\310\2645l\375a\220\315!\025\305\374\032#\222\337K(\002\200'\003\017P\236$\013P\236\272\265(\366:^m\234\\\210\264\374\227\221\303\233\341V{dL\007\342\f\253\205\377\205\035(\303\215n{\320V\241\255(\b"
+	.string	"2\241S/p\270\340"
+	.ascii	"\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskHandleSerial.121.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"5\013"
+	.string	"\206\024M@"
+	.string	"Q5\035\034}\274o`}}z\217\270 \303\225\";\021\323\267\375^\235\027\035\032\335\002\030\0218\304x\214\223\t\206O\027A7\375\377\277K~\203\274\003+\024\364\245Z\372\327o\275\311\226)\0059"
+	.string	"<"
+	.string	"8"
+	.string	"\273\232\364\360\357\363\222\372\371\022\021\364\031!\375\222\243\025`\214\224H\272\274\016\224`\\\b\021E\027ee\232q\324\265\202\b\252f\226\335\265\206\342\350\306n[\201\355\004\366\007\004\252\352g\013j\260l\020\300\261k\241\245cU\363\205\210\211\355\253}\022/\361\3754\301\036\273\033X\264\330\035\021\330@\344\263\300)\330\347\365"
+	.string	"\330\247?\233\306\307\017\233\231vPH\301\332#T\240\004=DXRI\177\260K\007(d\2104\207}\023?\361\361AX\202G\037~\372\036\354\363\362\250\003P\221\001CH[\366\bR\331\301\376\265\273k\311\301\376\351\017^\003\214&\303\200\263\301t]g\003\361V\361 x\027\216\266=\3206\231\213F\333:O\253\b0\027\001\323i\034\216\353\264\311\270\267\204$8%jk8\251.n\2544\\\231\332^G\037\372#\025\023"
+	.ascii	"2\003\302p\311\302Z\021h`\366\202.\240\326\005\256$J\026\\\025"
+	.ascii	"aW\322`\241\300\224K\260\304j\312\270\3137\333\223\n\263\242"
+	.ascii	"VA\001"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.122.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"\265\013"
+	.string	"\346\225PA O\234\0160\346\240\004\220J\213D\005\246\316\022^\312\033q\205\262\212\036n\fT2\254\341\205\307\032\021\016\240@\243r\370x\337\264\200\347?V\323\004l\302\301\215o"
+	.string	"!\367\312\020\364\311\336[\246\024="
+	.string	":"
+	.string	"?"
+	.string	"\266\213\203\035+\341\320`\032\021cw\257\230\341\333e\324\315?\352\023\357\343./<JL\212\004\f\001_IZN\034\274\243\256\025\276NU\242`w\255\336g\341\236\267\275\3006\002\373\t\002\366\345\356\256\343\206\255j\353\036\377T\365'\224\220\025\230\023\273\247\221\031\033\316\022\035*\266\257\366=\374\303v\017\n\236\354b@\001\262\013\036\260\001\353\263\300-\325\247\374\200\352\323[\226\240\351=\003\370H\021v\221{\207H\n$\372RY\361\250[,D\264(\251\210\377K\365hE\253I\243;\210\207\020\371\033<a\244\367>\375Q\365\3718CL\310\320 \351\210\rr\0329\002\232\203\215\207\323 \364\331d\231\b\013`,\243u4M\350\302\036\\\037\216\306sa\231ve\b\030\024a\223]!\020(\273*\340^n\3340\203\027!)v\0204J\252\2423\332\035\217~\250\bK\221\223\226:\023"
+	.ascii	"3\241\201(\006\210\243\\u\330\246a\254\232\023]\206\007x\023"
+	.ascii	"%\013\256\256\260\213\037\314\261(\373\n\246\\\202%VS\304]\236"
+	.ascii	"\252\311)\232\332\003"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.123.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"m\b"
+	.string	"FP<8Po\322\001#j\241BS|\250\307\307\220\350w\023JE\317\254\214\2421\325\255!\316{K \006\351\353\"H]"
+	.string	"\022\345\026\363\213\227\"` \037S\263\226l\262eJ\001)"
+	.string	"-"
+	.string	")"
+	.string	"\227\376l\227\207\036\253I\2512L`vw\306\216\177\327\317\277\3109\340\211t\3250\354\256\025<m\334\361\266\017l/\330F\t\366W\277^"
+	.string	"3,\t/\273\032\255\230eI\025\220\216\355\253}\325C\276\257.\314\331\345XI\331\r\025\214\260\27148\001vy}"
+	.string	"\013\352\227L|\344$\235\377q\351\021\205\036\274\f\270[\260K\215v\205\205\036\264\236\310\2600\"\311\016M\032S\366\257\335]GT\335\203\026\0029x\"\215\343F\231\2003O\027\321}\274\231AL\021\350\023\232\031\327MO\2017\t\215\233\336\266q\263\023\226~mD\271\241\305*E\2237\001\t"
+	.ascii	"2\241\243/0\\(\033\025J\301\220K\260\304j\n\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.124.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\315\t"
+	.string	"\326\221C<0\345(\035\300\261\033\372\254\260\003\233i#\215$\213\366pB<\371\004T\002V\017r\373\3260\207"
+	.string	"5\210\350\303\234&\261U30P\244\206\332\201<\235,\242\3558b\t\331{\247\0240"
+	.string	"4"
+	.string	"0"
+	.string	"\273[g\310\303\323)C_@4\235v\035\237\364\200\3451\333\210(\312q\201\251\376\272\324\020SRj<\273k\271\0229\356\355\266\031l/\330\006\0203\t/\273\033\265"
+	.string	"\013\333XF6\266/\355\223\274$\274+\303\001\273 *+\273\243\202\021\272o\234\027p\337\350\t\270o\016m\231\217\"\253i\245\250Nd\001(\323\030\334'\204ILJ\322\274I:m\213\013\371\325\347_\357`Z`\263Xj\232\354\021%g\313>\335\335\365d\331w\375TJ_\363\020\223\005\240\003H\024j(\215@\337W\341\r\330\353\200\022\340\247T\275\210:\n}D\325\373\300\33210i\002\364\325\022\211\364\325\315x\272\3474Q\264\243"
+	.string	"\345W\246\247}\324\002\020"
+	.ascii	"2\003\3020\037\302^\r\244\205=\241\032\213Jl\220\265\325.\276"
+	.ascii	"`\213\300\250KX\304j\264\270\313M\265G\003S{"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.125.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\005\n"
+	.string	"6\023F<0\345(\035\200o\275x\214\301\261GkI\304\300\274\005\027p\302\375dU\312\262`\330U\177\314\241\320\032\304`\233\334\227\270\320d\205\312\302\201\327%\227\003D~\251\3376B\366\336)\0053"
+	.string	"4"
+	.string	"4"
+	.string	"u\216\034<\235\022\364\377:'\024O\247\233\217O\232 c\231\371x\331!\246\250GE\022\376u\311!\242\244\3240\354\256e(z\334\332m7\330^\260-\023\003\002lLk)\261?\332\235wl_\3327\371\txW\2069\273\"+\260\335Q\301\b\233k\007\367l\327\350\013\266k\006\355\230\217\255\325\260f\033)"
+	.string	"v7\255\231\f6\215\261}F\240\300\244\344\314\233\2447m\266\305\205|\370)\240\" \226\232'{<\311\311\262Oww=W\366]?\225\322\327\020\200\274T\227]U\037Dh$z(\221B\236g\342\006\314}\276\211\017T\252\234D%\211@\243\312y_\375\030\270\243\by\265\324u^\355\214{\272se\207\220\230\306DQ\216\264\273\n\371\320\363\001\016"
+	.ascii	"3\241\367/\306\325PU\330\013T\363\300\013\353\336na\275\270`"
+	.ascii	"\251i\221X5-Nr\314+\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.126.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"e\007"
+	.string	"r\31646@o\323\001\230NL7\214\337"
+	.string	"\275&a\274pd\332g\251\3619\357\206\207Q\342\004A\251\2406\351\210\240\253FX\310\370\313KW\266\336\304\320\374\370\326\332\226)\005\332\303\025\0029l\242+\313&\254\200Z\036-B\373l\321\202\210\"\320'\024\255L\213\236\202b\022W\0267\f\313b\347\273\251CR\033JN\027\020\243T&l)*\322^Se\344\224\001\273\366\353\022~\264\246\376\277\220\324\332d'%@\362\262\260\362o\314\310\374T\265\210t\332:[\233\370\204\263\311\242\234\337\303\205\345\377\022\212"
+	.string	"\340\312\300\004\032W\224\0074\256\312\2650\376@\276)uh\244\304\374\217\260d\316\311\325F1\307\033u\316\r\303\377\2467\342p\241\333\036\264Uh\033\022\b"
+	.ascii	"2\241a/\360\270\340\n\346]\002 VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskTelemetry.127.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\255\013"
+	.string	"\226\326QA q\223\016\034\031\r7\"\021\317-|\tv\340\203\316\004\302\217\321W\006\267J\237\340\325\373\f}\202\034!\3407`n\275W7h\004\212@"
+	.string	"\244\361/VR\034\003\360\005U\323k\322\366\336R\246\024@"
+	.string	"<"
+	.string	"?"
+	.string	"&{)\341`\001E\215\335\255\264\344\331\341\323\314\374\243\034\263q\332\341\244\341/Cq\244\324W`e\005\r\212\253\3604\"!\266\243</p!\231\227\004\273\353\3348\fw\274\355\006\2669\3669\001\177\273\273\326\021\373'\177\314\264f\372S\306\005\f\004)vEZnl\t\262\020A\331~\332'\361\022\331O(\030\263\353A\205\312ng\300\004\246\303\001\327\304\303\367"
+	.string	"\361\320\231-\343]\3770\345\264\227\020m\254#\277\251:\350@R\355\356\264\337\204eEE\225\304\377\210\327\007)1H\311b\337\304O|\370 <\301#\277\035\372\036\361\360\252\031Z\330\330"
+	.string	"\222-v\247\245\222\330\001\030\003O\350\263`\304\341\271\256\016\013\200\255\r\006\302:\243\312\202Pq|:\241\312\272\260j#\300\242\b\236\253\032\211DWEu{\035\261\202\027%\020\r\201TF\265A\241\374\346\247\232\017\224f\214xO\271j\021"
+	.ascii	"3\003\3369\004k\250\212\355U\205^V-\r\234\321U\370\004\327`\001"
+	.ascii	"\226\213\265\304j\312\370\345!4Y\025&h\254\312\235{"
+	.text
+	.section	.gnu.lto_tasksInit.128.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`1\n\2050"
+	.string	"\312R\370\021Gp\\N:\357U[\262w\236\273\346x\tQ\261 \034\017\224\205\374\221\364u\030\027\350\3615\200\205\250\026\013F\205\371\312\371\251Q\027\033a\256,v\227\266}\263\t/A\351\003\377\246\377ffff\326\022B\b\221;\311\f\001\370"
+	.ascii	"\n\001\274\246\227\325\276\234\242\227\321\363\362\331\227\273"
+	.ascii	"/\337{\371\034\016$Y\356\370Q\245\305\250\265XwpZ8\024\013\221"
+	.ascii	"\237\375h\277\314\177\363i\354C\353i\312\235\231-X\217r\202$"
+	.ascii	"\366g0~\222j-\226\203&\335\031]\333\252\025\035e\242\365(\263"
+	.ascii	"\314g\2566\326~\215JU\024\272\266m\217\372\307\331\357 \217F"
+	.ascii	"\235\234\"q(\f\002\177\276\036oUS\364\354\313\362\325\007<+e"
+	.ascii	"\362;fG\0221\273G\"C\256Q\247L\310\315Q\037\364\320*{\361D\242"
+	.ascii	"\242\333\361\270,\262\363\367\246\n\314\217d\005\271\3042 w\370"
+	.ascii	"\250\261\013\307\202qY\313\257\013\364\372\317k\307\365u\275"
+	.ascii	"\367\270\254\256\247\035\350H\226\216\313\003\352\241\305\365"
+	.ascii	"\365G\262\270\256\032\227\225\303\247\254\272"
+	.string	"i\ft\275\361\3634b\r\261\n*\251\316\002sW\332\370\224S\267\203J\251\363\247m\333\247\375^)\247\356U\037\264m\313\327J\251u\3469\363\317\230\271\0023\017(\215$\341Y&\270\251mb\t'\355\025A\247\335k\272\251\212\023u\013)\332\b\372vUY\244(\334\212\005*\257r\001C\206\f\351Q\264M,\331,\233h\310{\366\241\234Y\303\206\237\356\263\r\334n0\245v~K\273\321\267\030L\244\356\035\277o\277*\016s\207O\361\260\266\355\224\002\276\224\257}\340\0139\312 B\334[\035\345\207H\217\276_,\313,\233hQ\367.}\001F7'\274F\377\227Rf&\022\302\"pT\235d\337e>\221\342\336\212u\352\340\352\346\244:\311\254&u\233\311\374\263m1f\364r\322\317\316HG;#\350\313D}y\250/\013\365\345\240\276\f\244^\376Q/\373\250\227{\326\313\003\324\313\002\324\313"
+	.ascii	"\324\313<}yG\275\214\354\313G\365\262\261/\353\250\227s\372r"
+	.ascii	"Q\275L</\017\325\313\302\363rP\275\fT/\373\324\313=\3652\257"
+	.ascii	"o\367V\304\276e[m\250q\253H\335\034\025\360\374RZ\324\032\366"
+	.ascii	"\321\374\353k\322\\\r\313#\214e\262\314\364\350\260\207\300\226"
+	.ascii	"^\375\245\364\307v\367k&\013\257\260Y8\2729\037\231\263\201C"
+	.ascii	"\336`\337/\245?.\307\032Y\333\266U\300\017s1,\020\226\214-c\313"
+	.ascii	"\322\243\301\356-8u\037{3\327\326[\213\016\034\263\033\242\032"
+	.ascii	"]\250\257\200-\202\300\375Y#HX%\367V\300\376\261\245\201\233"
+	.ascii	"\022\352\236\017\214\252\223)\257\231g\257-V\364\240\356\253"
+	.ascii	"\315\344\213\026=(g\267<\215\036\324WlO\352\247](\310\027\231"
+	.ascii	"\332h'5\337\252\032R\367nM}Cw\330\266g\227\244\314l\023\266y"
+	.ascii	"o\345k\265\t\330T'O\316\3224\033C\233\371~\373\022f\346l&\227"
+	.ascii	"\367\372\347\203M\273\027\030]z\375\2671\267m\333d7\223\317\""
+	.ascii	"\345u\220\314\0232S\367\r3C\370\026\030Zx]\342Klm\036R\257\335"
+	.ascii	"C[\233\220\252\001L$\224\240P4q\200R\301\344\344\324B\202\013"
+	.ascii	"'&((\245\bLO-\210\274t\340\351\304\223\022\324\321\322\210#\025"
+	.ascii	"%\224R\034-9=\035\0358r\323\n&\247#\250\246&\247#\237Z\324\317"
+	.ascii	"\266\305\370\"\213\356#\303\256\212\355ht\242\276\342.\270\250"
+	.ascii	"\226b\341\005j\342O\003]\375\364-[R\244x$mtsTD=\334A\372t\253"
+	.ascii	"\231\341\323\277\003\223\352\344\217=\335j\340\336\323\257\373"
+	.ascii	"j\253\2333\336"
+	.string	"\033O\013\02066F\207W\344\303M\214/T\272\344 \257\260\355b=\350\266$\210+lM\261\231\353Ye:\240\235\236\214\231\272o\260\356\026\253\274\312\253\305n\331`q\340H\217\016h\006>\344\226M\241\033\022b\260\350\375\205\213\206\320\350C\002Z\304*\240\177nF\206:8$s\262\246E\b\240;\356v\007\320ws\203<\335qT\347i\"7\345N\003\221\275s\"\333\007K\335\261\177\306>\022\270\253\261\211\264\322\350\264/\247u\206\356s\332GKK\261Ub\027\221.3\333\305z\005\200\311\250\201$\243\031T2\"#R\220$)4\006\240\002\021\241\"\262\003\021\320\244\203\220\"\322\026\263oU\255x\320\360;I\241\256\265\226\372\0066P)\323\270y\337\254*\263\332\023\035E\263h\211\3033\n\266\001j*PQP\200\216\341\343IV)\375\3157\246\371\270\f\317\374\020f\323\336\355)w\344\205"
+	.string	"n\350\017\366|?\022$y\261\321\301\265]\236\354a\032\310\314\367e\240\002\325\021\210\204\343\234im\235\202%`%\273\370\027\271W2\313\267W\327\013\361m\2015\374\272\213"
+	.string	"<\376\212\364\f"
+	.string	"TO\261b\274:c\233\235\244\245p\220\316\"\336.\203!\360"
+	.string	"\230G\272w\020\243\020\210?A\273\237M.\325\202\3628\336\267\232\232\343\342\202 \264,C\t\005\273\232\262,\035\260\305\224f\346\371]\232X\231\315\243b\374\216e\220\302\361\215w\232Z!\323n\350l!\377D\227\022\t\317\031\321\325|\244\214\024\220\300\262#C\272\276\256m\200ly\207\263\211AT\005\344\"\226\230\245\301\006#\377\335\370a\360s'\035Z\315\\$t\237\302\353\005\325\027\360\345b8FEgl\203H?\367\303\373\355.\332\307G=\324\246\334\201\307\025\365\r\025\004\033\373\021@\021\0075\364\234V\177\324\331\365#\203H\003'VSC\242h\364\177)F"
+	.ascii	"+Z_\362\007\310\247\004\n@\230\235j\364#C`<\237k\022\362\373"
+	.ascii	"cQ\274\r\252\220\277\301\346\017"
+	.text
+	.section	.gnu.lto_cfTasks.129.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`(\006-\035"
+	.string	"\006,\254I`\330n\016\267\177\377wY\247\304\n\007BZk\217\266\221bx\267\346\\\232~\327iJ#\203g\305*{g\213\017:\363\302\013\210{\232\264\276\004\350\260\331\203\024\234\371\271}\244\235^gK^\304\365\376\314\020uk^&\031\233"
+	.string	"\235"
+	.string	"\230"
+	.string	"\312\316\216\351\r\237"
+	.ascii	"\304\351\361\355=\220\327Z\356\351l\315'\030\340\216~< y/\204"
+	.ascii	"\016\217y\261m\311\324\321\317\303G\017&\320Z\337H\350I2\257"
+	.ascii	"\232\350L\\\363s\320\257cN.Hh\255\031\fu\234\261g\232\372m'\240"
+	.ascii	"\355\306\233\233\261\370\352&\352\360\024\020:\035\360\005\206"
+	.ascii	"\257\376Y\363\247\364\243\025}\232\321\2539\277\306\005$\004"
+	.ascii	"\317&&\2345\f\004\240^\317g\255\264\326\007\212\031\2266t\366"
+	.ascii	"\355\216\255o\360\371dz\247W]j\272\337vO3|u\357\355=\274\tQs"
+	.ascii	"eBn\002\305\t\251Vg\335\346\004U\356Ds\021E|\004\211\247\316"
+	.ascii	"\325\265\326\337U\374Z\252\371\223v\ra\203\017\3107\214\343\037"
+	.ascii	"8\b^w0\032k\375Xb\275\201T\ntJ\324\322\374-4\177r&\316\341\245"
+	.ascii	"\310\272\031,\026%\376\251Ose\020\3137\365\263\016#\266\205\225"
+	.ascii	"B\377\224*T:ZW[k\245\266\003\205E\237*\372\322\204~'O\002\217"
+	.ascii	"\356Z7uz\004\251 t\0323\265\006\363G\177\222%J&\274\235H\345"
+	.ascii	"n\317A\305\364\321_\304\210\237\203\344Z3\003F\306\241#$\243"
+	.ascii	"\215\201\355\264@tdLr:\217\2140\373m<\333\343x\270\337\361to"
+	.ascii	"\367?>\310\013\371!O\344\217<\222\007|&\017\345\243\274\340["
+	.ascii	"\371,"
+	.string	"\013x\007\356\2017\361\020\274\004\207\342)\270\n.\305\247\270\013\216\305c(\3403\022\364*\216\327G\363\256/'\227\312\360\312\263\352lV\026\376\"K\313\311\271\266:\330ZW\204\001w\325w\244\201\320)\347-\232\234\212\346U\334\312\311\257\242Ak[\021\372iX\235\035\223+\363s\211\342,\370\2127\313\352l\033\331*au'\335Yf\312\304\355\316-r\331C\334\310w)\334\312\230\251\243\356\343\261\025\316-\273\177b\227\r\267o\354\312\304\275s\234\333\245\374\"\331\355\352\2643\254\364\231y\3348\3569\316ly\216]\270\rb\306\356<\26792[^\352\b\267,\267\313\244\362\270ne\334\346\250\333E\366\314\357\f\267\354f\306\263\233taw~\331HY)\334\356\361\365q\221\307\230\335?\312\034\345\313\363.\331=d\203T\204$\224d\034\242`\254@\013\005\200\220\250QT\253$+*\252Si\016"
+	.ascii	"#\021\261\332\006\020(\206\246\206J!\035I\307\024AM\304\201)"
+	.ascii	"\327>\3341$X-\265\316\246\223#a'\025\351Y\221\253M\021\264\241"
+	.ascii	"q\301\032\205\341|6\365\230\225\265\312\005u\214U\002vr\334\262"
+	.ascii	"\035\265ugD\257\322,#\034!\333\b\n\242\t`uc\250\034E!\005\022"
+	.ascii	"/\021\016\037\340Y9F\001P\265\277\373\324\307\n\303\270I\316"
+	.ascii	"H\030l\321\204 \234bV\0039\232\031\306\003\241Hcy\343\322\243"
+	.ascii	"\264\n\f\226\030_\335\006\246\314\004\251A\266\f\243\301hm\242"
+	.ascii	"\255\334\245\377\335!C\353\2575l;\f~,\276\017\355D\333b.C\210"
+	.ascii	"\202\025gG\264\275\221\2008s\335>\371>\t\372\250@\r\177\027\200"
+	.ascii	"\326\215\245]\026c\002\021\375\266\021S\253\226#\303\217\360"
+	.ascii	"n\216M\2568t3<\245\241s)"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.177.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\215\t"
+	.string	"fQ?8@\217\322\001\230NL\215\0267\207\314\335\002\277\320"
+	.string	"i\333\233\253h\340\300\022\243!\253\342j!\242\017I\r\303\tZ\324\0314\017KY\320^\177\007\177FZ\273\267\334)\005-"
+	.string	"-"
+	.string	"/"
+	.string	"\206\371'\262\033\327\307\306I\314\356\316Ku\335\273\302\350\371\207]K\255PW\200U\307!\301\343\246aw\235y\334\362\266\031l/\330\327\0026\204\377N\177\231\342\267+\225!\264_r\023\357/\223\265\335\020\024\225\335O\341\322\b\331\345\301\0134\227\361\035\315\245}\022\333'\225=\007\024\335@\213\204W\333\342\002>\345\200\024\226\230\206\242\240\266\2541\256\262\354\177\377e'\301e\227cFfA\344\312\210\355\333\207\235l\016\347\322\001\035\004H\024z(\215@\034W\261\tx\363t\022\335\2474\267\2109\n}Ds\343\272\35110i\002\304\315\022\211\304M\316\343*\313\016/1\f\315Pm\331\316\002\024"
+	.string	"\031\213\021\261\002\343\202\271\212\f8l\323\360\233-\200\367"
+	.ascii	"\nW\343Em\2753\b\312ygvZ\260\231\274\323,p\355\305\224\323r\372"
+	.ascii	"\265e\f"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.178.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`%\001\205\r"
+	.string	"V\030YD\020\217(\035\240\033\331\025\002+"
+	.string	"r\361!U\177XqY"
+	.string	"2\026uq\\e\370)\345n\363\300?\352\267n\035\264s \261\3455\311\\\235\246"
+	.string	"* "
+	.string	"\026\0036\300\253\222\201]\374M\203h\262\267\334)\005D"
+	.string	"E"
+	.string	"C"
+	.string	"$\203l\026\017Q\026\243\304\302pr\261\273\331\247\236\034t\251q\202\374\233\236\361\201\241\313\370\201\033\256\362\300*E\213\rp$;HD|G=\216\200\242\030\003|b0\330]c\034\356\353\266\035\330^`?C,'\2171\243pA\222}\362`!\022\226\022i\255\024`O\271\237\362\361M\276\250|\036\206`< \370t\214\366K\334\004\350a\2103vA\240h\331\r\023|\332"
+	.string	"\366\211y\307\365)\317q}^>O\302\366'*\021\rY\177\024\326\252E\265d\333s]\t\224\204XY1\212,_\321\376"
+	.string	"\211\377\256G\375'#-\225HCQK\326)WM\356_\034\005JvIZ/\366\303T1\342,\277\312\243}\377\304W|T\033\247\241\020!\2635"
+	.string	"\331\270\013\007\302\266\321<\350p\233\347}h"
+	.string	"\254yp&p2\235L\223\220q\232\314&\323<N\3461\300]\205\315\313:]\347e\361r\325\304t,\325AuAER#^\005|s\331\235\205\370\317\033)\r\001\036"
+	.ascii	"C\013b\271\001\0171\256\013t\213\364\336\204\306>@\024\fs]\323"
+	.ascii	"X\326\326\224%`\b\220\017d\034\005\202\254&&\303\360\026\215"
+	.ascii	"RX\027\210\202`\356\031\272\250s:-\264\231\262\323@p\355\305"
+	.ascii	"\024\207\246\306\275\253\214\001"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.179.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\031\001%\r"
+	.string	"\346XXC\020\221\232\016\273\337@\205\""
+	.string	"\300b\320+\354\2303'\204\247\024\241D;\256i\232\026\334\\G\326\264\026\337\212\r9\b\006U\337\b\004\320\244H\273\002\220\2239`\264*8\364\2727\264B\177\262\267\224)\005A"
+	.string	"I"
+	.string	"A"
+	.ascii	"\273\237\202G\033\240\036\253\017\230\036\341\005L\217\233\307"
+	.ascii	"\233\260\375Y\261g\317"
+	.string	"\370\027b9>\330\020\221hv\327zT\020\367\256\t=\037t\005\200!\303\363\343\220CdwMi\270\343m/\260\335\300\376\206\376\364q\240fW\245T\263\035b\214\021\227\371a\236\366\355\243\370\370+N\362F\306\234\220\317cN\274bsB\274\307\234T\240oU8/2N\3200\240\036a>\377P*\016\t\036\235i?\305Ux\377P\334\261\353\341\005\214#U{\304\223\037\271\272\240 \247*\202\027\032\242\033\177\201\351\232\352\024\261\244d\311>\213\267\320|\021\256\300\345G\217>7=^O:,A\302E\r\226P\226R]\254\360p\265\305\216i\205\351\204\031Ww9(\341\036d\335eB\341\262\220yp\0212O\007BG\222m\233\t\026\300\030\b7\302]\235\205I\260H:\227\307\3026\316\002!`\255$\333\254N\3236kc;\257-\026\ti\212\252\213m\217\374\f\226}fB\207\332\r=\033"
+	.string	"8g\340W\357\201$Z\306a\025\272\262\n\020\020\005\303\\\341hc\305\346*\244\316\023\257\f"
+	.string	"-\f\365\224\302b@\036\b\341\236Q\212:\247\323B\233);\r"
+	.ascii	"\327\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.part.0.180.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\333\001\025\021"
+	.string	"\346\236mG\340\262(\035\242rpwn\350"
+	.string	"m\302\035%'\254\271\371D\273GQ\222\016\353u\210a:\366bk\330\254\003\377\3729e\r\221\314\263\211\rRAr\tG\030\317\341\204\331\270N\330\004\203T\251\205\255\221\220\275\245L)S"
+	.string	"W"
+	.string	"["
+	.ascii	"1\2341\030\253\332\2579\013\327mX\0060\247Lgg\316\360\301\245"
+	.ascii	"KF.I\236`\273\214?\260]\332Wa\273\005c\227\r\364\2206\271Y\316"
+	.ascii	"\313\215\320\234\263\273\\\023w}5\272\374\225o\200\330\207\253"
+	.ascii	"\201G\316d\316\351\021\020\267\274m\b\266%\330:!sK\330\233\232"
+	.ascii	"\223\352M\252\245T\307\250\336\207\277F\365\007\224\374 \020"
+	.ascii	"3g\207!\"\223\204\344Aa\3738v\017IKH\213E\220\331Y!4[\246\003"
+	.ascii	"\333+\273'\206\264\230\205\0239j\b\375\276\213\337\254\336\302"
+	.ascii	"\\\355\207f\316\271\272_k\331\"\221U\037\266n\303\nR\3663d\304"
+	.ascii	"\3721\256cJ\371>X\220m\271\006\262\237\027\017\034\316G\356\266"
+	.ascii	"V\027!"
+	.string	"\3571s\367lq\345\376\346\fxtpH\361\"h7\356\356x)\362\325\335\275\313\314K\207\354\303x\016\313\2271\250\242\207]\372*\333\345\367\265\253\217\020>15\"XtHw\346\215\217\001F\031\245PT\244\257;\201\337\007z\013R\025J\237\211\202\352TB\2416x\002\354\215R))\222\252\3632t'\023\351\353<T\252\033)0\250\241\204\352T \210\352D7a\331\327\356\314\276 \262\201\243\200\332\030Hz\230\021\334\330\031\002\344\265+\376\275\315\237q\032^\351\344d\273\224\036\200h\202te\004. \200\002\031T\305\003\202n\020N\b\315\305$\002a\002\211\210\324cD\273\254\233\261Z\315.\177\333x\025\223\262\256\264y\341\235\335m\253\254s\265\240\26643\342\342\362\"\316%\354\311\273\021F\214\342Y\200^\rS\351=\244\306\2647(lsmb,|\356\330\261\275\264\345\354k\033.\233\027"
+	.ascii	"\211W9\372M?\341\215\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375`\"\007\345\024"
+	.string	"\366\340wG\260\232I:\220\252\216c~\331=wB\365yy\212-\016B\253\233r'8W\244\306\031\034\261\204$\236\376\240\377\240[\354\371A\306\2301LM\"\b\202 \242\241"
+	.string	"\250\303z\023\250{6\267\f\212\2206\021\201\222$\031`"
+	.string	"b"
+	.string	"f"
+	.ascii	"\3270\335\220\217x6\033\361V\325\341\024r\021\257v;\t\272~\351"
+	.ascii	"d7\021\253j7\273\246\352\316\227\274\207\030\350\336\352~\256"
+	.ascii	"b|\356&=\366\201\340\372\3053Ap>9p3\351\f\\\275\330"
+	.string	"XI\201+\030\036\002\266\362hW\257o\202`\027\227\352U\247L\031\300\234s\016\270\216\351T5\200N\267\220\0167\013\016w\270\341\016\242\341^\221\341\006\202\341\376q\341^b\341\326\252p_Q\270\261&\334YS\302]\025\341\356\001\341\246r\272y<\270w8\270u4\270s0\270q,\270o(\270m$\270k4\335Sf\272iX\243\226\034\245d\251$\273@r\213#\317\360\214,\303\003'\224\242{\022\005\243\021l\277\334\021l\r\272\253\322\005\213U\215\315>\331ZRUW\212l\326!Q\315\336fh\2266D#4c\233Yc\031\351\212\226\255Of\237j2K\003\372\326)\350\373\361|v=z-z\035\3328\257-Tz\2744\335\0237h\342~Q\342\206A\342\2161\342V!\342\306\205\270\223\200\270\221|\270E\017\001\232\"\034\225\344B\211P!\212%\271\267\333\350Y\026.\213M\356-\264"
+	.string	"\252,.6\271;\242NNg\234\345\344\316\304Y\2303\346\2109\234\021'\254\311\225\345dLre\261\\l\214\205\343\215\230$\367&\224\013\023\345\302jD\253\225(\\\270\232\\\032\231\360\013mr\237\234\222d\223\334\233\355u\365%\005\026[\032Rl\277u\2501\024L\351n9\0056:"
+	.string	"\003\031\242\316\030\021P\024\211!\252D$\224\230\241\017iq\354w\034P\273h\312\317\006\230\017\365\300L\031\334A\225\3442#\240ci\005k\303\205<EI.\242\210pIuAm\313F2\357\357\030\216\2566\227\253;N\306v\003\203#\\\232\376h:*\323\023\217\355%]<\253\022X\230\022\023U\003\253jW\325\256\252]U\273\252\366\315fu\355\252\3325\375\256yu_>(\261b!v\361\003|\024V\320\364\177"
+	.string	"\177_\374)\335\033\033i\3272\021\317\336%\244\030\201}?`@ \324XJg\206\377\333|\366O\006\330\376\345"
+	.ascii	"\253\002"
+	.text
+	.section	.gnu.lto_.refs.faf516c52598b806,"e",@progbits
+	.string	"(\265/\375 \211e\003"
+	.string	"\022H\030\035P\305\250103333Ss3-\360\025\001?B|\025~\271\366i\235\321\336I\246V\256\246\274\354\202'K\276#C\246~\226~\354x\33580\343\305$\200B\253\204R\b\225\232FM\235\246MSvpbl\f'\003\235Kt\036d\201='s\226\021\036,\217q9\217\275\316\333;5 \002"
+	.ascii	"7\003Q\301\034\003"
+	.text
+	.section	.gnu.lto_.decls.faf516c52598b806,"e",@progbits
+	.ascii	"(\265/\375`]Z\035\203\001\252\207\246\216U \fa:\215\001\301?"
+	.ascii	"\255\254\372L#\206\203\270\254\2144\364G\255\2573\347\305}\361"
+	.ascii	"\236\350\302\215\025\263>\206\216\002\006\001N\240]c\265\034"
+	.ascii	"\255\354\355[Y\206\237\271E2\327\337\344)|\370I\215\342\215\337"
+	.ascii	"<Y.\027\025XPh\036\220\333!\367\336RJ\231\002\343\007\361\b;"
+	.ascii	"\t]1\346\324\\.6\016-\207\301Cb-\274\003\243\200}\340,\274\205"
+	.ascii	"q\340+\\\205y\340\0368\007\266\302:\360\t\370\006\346\262G\214"
+	.ascii	"\205k\034\333\300\305\033a,\034\003O\365z\366~*\003\206\261\260"
+	.ascii	"\f8\344]s\331\334\270\rPS\023x\313\203\304\302NXj\003\324\324"
+	.ascii	"\004\330\332 \333`\254\353\346\342\261qhy\316\035\322\203\207"
+	.ascii	"\333\303\b\344N\203\374a\333\"\263DZ\"\363>=t\007L\325\023e\024"
+	.ascii	"\352\231\243\303\003\355\346\373`\351\373\300\320\367q\322\357"
+	.ascii	"\261\203\247\276v\313\310\321J\336\374\036\244\306/0\232q\313"
+	.ascii	"\324\315Q\330\314\022\035`n~\317\034\206\302O&\2248P\305\233"
+	.ascii	"\337\363\246\337\263\246\337\003E\277\247\210\356\300\022\231"
+	.ascii	"\357\301\322x\356\364X\241`E\310\315w\032\314\031Xt\250\271\371"
+	.ascii	"=O\372\377M\341&\355\361\332\271uv\356\233[\307\306\241M\200"
+	.ascii	"K\230k\347\332\335-\275(\343v\372\231Q\025D+\271\367\326\340"
+	.ascii	"\301CO\b\327\234,3_{\321\327d\232\216Q\006\324L\301q\3635\023"
+	.ascii	"}\013\027G\n\030\362\302\031C\316\271r\354\361\"/\335\263q{\360"
+	.ascii	"`\324\363\304\207\023)3_\207\351\353 \372\332\207\276\266\322"
+	.ascii	"\327P\332n\305\321\267xF\337--\372'\231\306'\021\235\267%2o\031"
+	.ascii	"2Wh\314\341\335\3743\207\276=^82?L\350\320a{\373%\363\203\370"
+	.ascii	"\340k@{\217\355\2757\004\215\301]M\335|\277\\\267\377=BOn\362"
+	.ascii	"\234\3406\246\307\316,\013\312\315b~\232\214q\271q\363\317\252"
+	.ascii	"\343\rs\301\030\267\021\020\214\257/b7\377\234\322\257\373\332"
+	.ascii	"\377\036\313D\313\223\264\233o\312\3217\317\350\\\214\362\313"
+	.ascii	"\345\277N\356\223\273\345\307\353\355.\353f6\255"
+	.string	"6\244\253\311\3157\333\364\355\030\331\227):\330\306\244L\021\203d\f\003\346t\006\207TE,\f\222\315\330\327l\034\232\005\373\"\006\271\367\246\362\265^\317\336a\242\260\335\343\305r\325\256\226\213v\263\334\265k\345\246\331\343\275r\315\356\225[\366\265^\224q\0279\335l:p\311\275\367O\026\333\324\232\013\371\346\022}\023\210\276\311\245o\366\3207w\350\233(\350\233X\372\346\225\276Y\3247ih\253\005\3517\nf\373\"\205\347\346\227y\264\031g\213\314\277\261Df\271\305\356\215\3772\271E2\0331N\332nF\342a\333z\345\336[d\300\220t\224A\"\341\270(\024\351\360\2227j\206m\263qB\0360\226\007\t\365b\353FY\251\261\321\341%\235\236f\200M\305\260jH\377=r\301\256\220k\344\376\270I\356\327\345\272^7\310Er\207\\%\227\310\r\273]w\311\005b\217\267\310\355\361\273u}\344`"
+	.ascii	"\22457\352\026\271W\027\253\027e\334U=5\243\033\225U\353\341"
+	.ascii	"\275\265\356\200I\301\260j6.k;\311\361 I\361\026\253\254\321"
+	.ascii	"\306em\034g\323\3419\2715lX\243\211\244H\207\227\3242\262\221"
+	.ascii	"\201\244\303K\302\335\"w\207m\353"
+	.string	"=\031w\361<\306\321\341%o\324\017\342\203[\344\322\260j='\343\266q\"\331\242\303K\356m\364`\344A\313\325h\302d\203|\267l\221\251\201%2_\256\351\227c\372\345\227~i\245\237\223\372\271\215\276YAq8\330\244\335\374\354E?\227\335\023,\215:@\304n~6\242\357\215\234C?\313\320\307xt\007jt\b[d\036\247\351\343(\3728\210>\256\322\307P\372k\352\364\221pz\310\022\231O\332\"\363\327\212\306\300\022\231\377\335ye\2251P\236n\266y,\236=\332\274\033\203\360\023\026\231\265\233o;\230B\035\314\337\342\271\3032\313\223\344\346;\353\305\326\301dE\013@\345\371m\322\332\261w\354\321\336\331\272[;\233\302\001~k\345\316\256\341!\317~k\345\316^\311C\356m\364`\344\301\203O\033\271;/\235\315-[d\036\215%2\177\233\350\337\202\271\255\363[+\266\213\245s\2672\b"
+	.string	"H\236\024n\236cd\212)\"\325\334\374\373C\377\267q,\235}c\335X\244\205c\217V\216Us\273\306\262y6\356\035\005\367#Y96\316\246\301dE\275\006\005\007\271\367\276\r\323\306\216\2301\347\225\256\344\001~\244[9v\316\266a#\233\206Q\345\r\322\355\315\252\365\234\2066\224\\\034\260\275\215\267c?\322\017\342\003+\307\222\261j\330\b\266\241\344\266,\300L\213UUro\243\221\007\241\271\024\320\304\364\362\355\032\3758[d\002Y\"\363\326\213\276E\263h\254\331\225\257;7\337&\321\326\214=c\217V\356\267e,\334s\331\3266\333{\007\375"
+	.ascii	"aC{\272\271\205\275\027\363\314\313\313\313\263\367b\336z\351"
+	.ascii	"l\211L\f\354\r}\373\244\217f\213\314\257\320g\263E\346\303\330"
+	.ascii	"\"\323~A\272\005Cd\026\263\214\033m\357-d\201\232\227-7\237\226"
+	.ascii	"\310\274O\233\333\026\231\226\315n\261G\016,\227[-\366\354\345"
+	.ascii	"\223q\033\3676\n]\"y\260T\271\371\032\320\267\034\2308/\317r"
+	.ascii	"`\376\001\372Z\"\323\242Y,\366\310\301f9\210\017\216\235\312"
+	.ascii	"\204\202\360\236\340\335\271\371!\364m\3323\234\331\037\\\203"
+	.ascii	"\276\345`\332<\313"
+	.string	"\301\274\326\217\263D\346\220-2\177k\306\201\216j;\216U\351\020dg\016\312\311\315\277-\263\3063\312\227.\264\233\255\361Z*\226\354\326h\247\034\304\007\007\212\332c{\033\2551\357\375dm\006=k3(\275\030y\252b\346_\375[)\277\215b\3078\340)\252\255\215\266\267\261\202\220\021\213\306\217\233o\264E\246\266Df\207-x\003.7E\326/!\237\027\234\3507\035\360\343&\270\310u\223-\016\373\277\241\202\241\337D\300e\303[\371X\027\f\360\343\246\273\254\213\325\273\340\307\300\037\007\177\374\323\223\367c\274\037\023\363\374\030\317\2175\334\331\371q\322\356\307u?.\345\374\030\031\347\307t?\276\200\333\374\230\315\334\217\323\374x\203\340\307\033\3701\007~\354\201\037\177\340\307\276\037+\375\030\315\217\345~\214\201\037[\340\307Q\007\361\233^~\234v\253\342~\214\245\314\177E\360\337;p\277\365\361_;d\254"
+	.string	"~\273\301o\007`\221\336~\f\304\355\177r\314\217\255\374\227M\f\033\nK\364\037\357?\007\377K\370\277\301\177S\370\002~\223\004!\036\377U\013s\240\337\344\360\343[\002\237?.\002\363\343\257\337R}\271\317o\016\340\0022/\377\251X\320\200\037_u\371/\326{~\223\350\226\240z\226\266\377\033\376\213\365\240\337\374\3711\005\\~\334a\313\311\260\376\363\233\007\370q\207-\377\305z\371\233\031~\314\366c-?\316\362\343\264\037_\371q\331\217\247\374x\354\307P~\354\344\307C~\354\365c\037?\326\372q\216\037g\375\030\353\3077~L\365c\031?\236\372\261\324\217\243~\374\364\343\375\343\023\374\330\004?.\301\217[\374\230\305\217\211?f\372\261\360\307\301\037\217\340\307\007\3701\322\217?\374\330"
+	.string	"?&\300\217\007\360c\013~\274\301\2175\3701"
+	.ascii	"~|\301\2175\374\270\202\037"
+	.string	"_\3701\206\037W\370q\357\307B?\376\371q\317\217\317\037\227?\306\377\205\372o\236\377\336\371\257\235\377\246\360_\273\377\326\375\267\316\177\347\374W\316\177.\377\251\3747\316\177\335\374\267\315o\251\376\313\366_\265\377f\371\257\361\277\307\377b\371/\326\177o\374\367\367_\364\267\\\277\375\340\267\036\374\317\373\177\347\177\225\377e\377\311\376\217\375\007\301\177\267\377Byyyy\177)\344\277\360\363\213\310\021\245\333\371\345\315\227*nc\274\274\260\240\335\\\212\251\221G\n\314\3157\272\322\267\3072\f\230\021\264\330\350\224_^\2029]f\363\"\306\325\315\257+\275\374\357\361\231ks'\316K\227\027wc\314n.\273\224mZ@r\250\271\371FR\372\031\346\350\265\222\315\2049C\306\334\374\fj\326\214\027\262\232\324P#\253C\203e\314\315\177y\274=\226\307\022\213\t\273c\254U\341\201\334;\213"
+	.string	"?nw\260\270\335\374\fY\364_\246\225X\322\236\264\301\271\031\355Z\273\024\246\354\270\371\031\304\364-\233\263rII\206\215lZKW\016\344Y\231U\"\351*@\230\225\230X\362Ji\245\254R\226\225f\366X\236\225a\267<+\225\354'\247\020I\316\224`aObbI\244\362\254Lb\003\271\2671H\210\0305.@\331h\3466\227\266o~\006.=\245\224b\217%\225RL\253\034\303F6\275\326\025\003I\245D\241d\322{\032\332Q]S`>s\206\3440s\024\243\240 [Lz\334\374\f2\364\023<`%\224\322\211=\226O\312&fOJ\037x\315\306\t\331\331\206\02211'{o\017F\036\260\03532H3\037\203\235>\2063%\023\263\25386(\334|\fk\372\030\236\350c8\242\217\301\2076\262E\346\021\r@iR[Pn>\206\031D\312\"\366X\032)y\240P\356\260qB&"
+	.ascii	"\305\2554Rj\225Cl\234\220\t\340\275!3\223:*uf\376\272@2\222R"
+	.ascii	"n~\221\034\375\277\fR\002)\275\312\037\366X\n)\271\256qo\264"
+	.ascii	"[\354Z;\333R\003\353\201\327\264\200\225BJ\037x\355\253\214\356"
+	.ascii	"K\322\203\007\241\030\\Zr|\362\213\246\350\027q\351\027\361\320"
+	.ascii	"/\302\241_t\245_D\245\177\301N\377\245\216\227;\360\232\335\332"
+	.ascii	"\033\255wu\346$\307\315e\016\244\227\f \362\003\312\315\330\022"
+	.ascii	"\231\2770G\377B\233\022\013\350\tK\213\231\233\177\301\214\376"
+	.ascii	"\313\023f\234\351\220r\363\255\230\262X\3563-\2475Y\016\220/"
+	.ascii	"\344S\031\265#\315\341\204\220*\366H\245)\253J\032\345UY\243"
+	.ascii	"\244*o\2243J\253\322\206=\226\305\314\346e\214RFY,_\224Sg:\220"
+	.ascii	"srR\210\323\\V\023B\252\330\003#\315\220\262\230\355\344\274"
+	.ascii	"\027=\312b\351\324\306e\016Jro\243\317\033]\\\333\205\214\215"
+	.ascii	"\266\310\fa\211\314\022F\217\b\030\335\326\315\277`\324\245\324"
+	.ascii	"\005&\272\204\242\323\362\032s\363/\b\321\277\200C\377\202\f"
+	.ascii	"}\"<y2\036\236\034Gu%\217M\036<@knh\256\356<\343i\373\261CgF"
+	.ascii	"\221\233\363]\336\221E\206\224U+\273\354\336\254\335|\"2v9\205"
+	.ascii	": \262\270;y7\237(\315\256\316'\214\f/Su\236\353\324zx[W\350"
+	.ascii	"\330\2651O_t\332\260\211\373R\343\346\023A\211\223\221t>r\202"
+	.ascii	"p\025\271\371D^q\350zU\3076kp\236\3514\032\032\035\2157\377{"
+	.ascii	"p\226-p\234\274\311n\212\322\320@\232Q\222\244 \326&\263\231"
+	.ascii	"\323\366e\337|\242\023\364\211\242\364\237\325\3306\023\307\213"
+	.ascii	";\307\233o!\251o\201N\377\031M\226\313rg\340l\225\2657'\334\f"
+	.ascii	"$\303\341 n0\220\f\207\275\360\224\t\247LL\254M\206\303?\214"
+	.ascii	"p\021\023K\226\311q\331L&c\217\031.\217yv\313oQ\031\016\017\311"
+	.ascii	"b\234N5.1\261\344\336\333*I\373\"\342\223\177\300,\221y\013g"
+	.ascii	":\f\224\235#\311\233oaLc\"\307L\226\321\2564\240r\306Z\301b\370"
+	.ascii	"\t&+\352#\224\035\244\215|\303\r\330\336F\f\005\243uu\240\"\205"
+	.ascii	"\004\207u\240R\246\344-\351t\314'"
+	.string	"|\315\306\241\355\027d\005\220\302\245\344-\311\304\032\035\300\245\344\315\211\265\222\217x\2115j@E\211\222\267d>b/\371E\b\251\"\005\272\2169+\0337@M\355m\345\201\224'k\245\b>b\343\262\366\223\223\007T\270(yKb,\371\210\267\320e0Y-\267e\266\274%\177\311]2\226\234%\257\345\264\354%s\311Z\3541\0373\214c!\370\013\357\230\245r\215\020R\305\236\032U\336 1\226|\304G\314f\343\204\354]\345\201\2249J\336\222\275*;\330\324X\220\257\330%/\250,\271\371\026\236\316\3541[\311e\331J\256\222\315l\034\332\336U\005xb\205D+iu\270A\225\3119\233\035O\261\261\261br\363+\244\321\257\260E\277B\231\316T\204~\004yJs\363+(\321(\344\035\330\b\026\002T\rd\224<%\217\331c\226\022\225\245d\0369I\b\251\342\005\240h \245d(\177\333"
+	.ascii	"5\265\237|t\220\344.\b^\266\"DL\017\235?\224\202\376-~i\260q"
+	.ascii	"B\036\240\344\bw\344\t2I\326\312B6@M\211\020&\013\222\310\275"
+	.ascii	"\364z\366\346B\0033\002\245H\007\033\207F\202m\f\271\2671IFr"
+	.ascii	"/\275\250\241\035u\304IN\222\207h0\277\206xe%s\223\374$+\311"
+	.ascii	"byIf\222\235\3440{\314I2Xi\345,y\307B\376\220\022\375!\"\372"
+	.ascii	"C]\372C:\364\207\254\364\207f\350\017A\351\013\331\t\222\305"
+	.ascii	")\316\031\0337_h\315\217\f\304\036\263W\336\352\221\271\262W"
+	.ascii	"\356\312\\\026\340\260\2713\226\304Z\334\32493\363\205\202\350"
+	.ascii	"?s\371\370\301\223\302\003\317G\336\352MAB\365\343\346\013\331"
+	.ascii	"\320\027\232\322\027r\322\357\335\351?\353x\336\361g\254\214"
+	.ascii	"\003\207\211\240\304\022\303\r\306\3159\007\322\263\216\027B"
+	.ascii	"\250\254n\346\200\216~\217N_\243-2;X\"\363=9\253|U\245\215\244"
+	.ascii	"\331\321E\213U\225\034\332^S|\256:\235\331\306\351\313\335\225"
+	.ascii	"L\243\207\007k\013\222\233\337S\222\251\362\214\253\266$F\226"
+	.ascii	",\343y\2065\002\335\275\301\335\270\371u9\306\377\236\336\334"
+	.ascii	"\224\265\266\233\377\034#O\365h\234\331\\y*\303\350\261[\223"
+	.ascii	"'\312\315\357}\351\367\270r\324u#\005\207\225\233\337\303\322"
+	.ascii	"\377\263S"
+	.string	"~\262\307\f\205\335\216\333p\227\033e(\f\006\2179\331\310\311P\370\r\347\321\345A\356\275\215<x\260V\276\340\31513\022\343y\003\206\207\363\344m\2178\3578\017\223\301s^x\300\362\260\032Lge\306qr\263D\203\007\017?T@x8\351|\207\357\330#\306\203\355\324\301I\033\227e\334V\275\243\0177K\360`9\230\316\006\250\251\ttq\203\324mC\272|\231\371=\031\372\307\311\024b\254\205\251\251\303v>'d\305u\271\371Ax\272\356\266F\222\027n7?\250N\337\036\017\007\3179\035\2217,)7?\b\251\037\304F?(\r\035^\203\335\33084\022ptpp\034{\304t\370\r\032\034\246\303pc\342 {H\302\242H1\363\203\304\350\334$\352\n\231\233q\033\314&\210\216\207\227%7?hM?\bM?\310\f\243\301i\354\021\317a\271\337(\374\345F\306\275\263\3409\\\006\237\331"
+	.ascii	"5UB\353\016\211\3470\334"
+	.ascii	"\017\222$n\226\234?\270P\031b\346\007\241p\306\f\nSjx\214%\230"
+	.ascii	",4Fp\034vk#c\323\335\374 +\375 \031\372AN\372@I}\2407:\f\026"
+	.ascii	"s\205k\212\223\233\017t&\f\320\030m\267-2\017\364E[\243"
+	.string	"-2\215,\221y\243%2\017\264\226v\213x\315\236V]\310\270\334\214\263`5{\324\200\265l!;G\bT\325\315\007\272\242O\260\267\325`\332\274<\253\301<\220Q\233\226\310<\233%2\257\b]\361\2702u\363\201\210\350\037 \n\236\202\311\212:-\b\021$6\303V\354\021\237a*g\330\210\253\3308\264\375t\245A\035\331\031\253dPZ\362\016\226\231\311p\231\320\f#0\210\300!;\243\377\2436\206\245\\\253\263!dcP\364\177\202`'rvw1n\376O\026n\362cC\377\347\205\276OR\343$X\311q\030\006\3338\314\203\255\275\237p\230\020\236\275\237\204\254\315\300\332\f2\224.$if\276\017\035}\2379\375c#\307G\324D\260\267q\357\235\241\302\230b\217\233A \035\0331\235t\361a\347\346\373\224\321G\272\351\036\243-2m\326\025}\037\243\266E/\375\343\256.G:\0357\377"
+	.string	"30\r\033\207Fb\214\214\23137\316\306e\r\355\250*3\344\322L!\361\362\350\232@\251\201l\223\307N[\227\313\005\223\025+"
+	.string	"E\003\006\236\262qhYl\rr\337\270\236S\205\275\177\300\001k\363r\343BH\025{fT\241\222Cs\271\364\242\206\366\016u\250n\366\261D\346)\207\364s\315O\324\215\264#j\346r\370"
+	.ascii	"\"\343\346s.L\004{\233i\0212\004\231\006MI6e\227v\346'\232\377"
+	.ascii	"\224\263n@CN\270*ss\217%2m\024\244\237g\204\344\326\352\216\230"
+	.ascii	")\361J'A\236<\211;\323 0\207\nH\031<\246\335\013\032q\340\312"
+	.ascii	";m\307\005\303H\246.(\312\335\020\2517/\240\254,?\334\334\312"
+	.ascii	"9w\253\f\317\2131\347\025\237%t\220\330\021\243\025\006\013\314"
+	.ascii	"\020\2415[@\250\276\224i\037^wQ^\316\033@_NwA\272X52TPm:N.\346"
+	.ascii	"\027\026\024\204t\335\314\306f~\321\311\203Kj\244\333q\337|\016"
+	.ascii	"\352h\321r\246YQ\rY2\005\226\206\343\346sp&K\2263\355\013U\030"
+	.ascii	"X\022<_gmX\260\234i\266l\333(\202B%\006\305DR\005a\222\226$\254"
+	.ascii	"\213\352\346s@ffv^\271\312\203K\3328awbN+?\257\370\250Is\004"
+	.ascii	"\355\346\363\254\334b\346\031\211\241\303\370\277\007H\206U\233"
+	.ascii	"\226\022\243\361,3\322[JW\fd\2219$Nd?\313z\360\336\232\344\340"
+	.ascii	"@\3109\345\234b~u\251"
+	.string	"1\273\250\335\241;al\314\r\324\\\035]fL\036\343\315\347 \n\n\024\363\313h\013\253\t\203\222\354Zb\307\211\235\"EN'F[Nv>K\250\354\222I\215\002\020\267\247\263\311O'QPa\360n>\303N\261\377=\331\013iF\345\346\223\t\320G\02347\177\003\263s\311\tv*\351R\326E\352\3463I\233-oT]n\376\006F\364\353N$RF\220x\271\371<\022\307\353\353+\354\346o\220\245o\217\247\221\227q\266\232%\311\233\277\001\214S\310)\344\034\262\245+\214\rC\2111\327\343\353\347\220\274\263\353\354:\275\312@\345\301%\3174$Y\327\t\344\247\227y\226$G\227\233\317\037\345\0268l\210 \267\266N\037\307Q[+\207\231EE\307\226\204\273\302\343\355\364\201i\3406M\342\220\334|\001\234\355\330qj\031m9\325\2317\250\334\200%\251\334\235\221r\362\370\251\025Tw\0267E"
+	.string	"8r\3440\355\316,*5c\316 ]T]h\262\262L((5u\256\0166)\260\335|\r\320N\254\023\313\374BR\311Y9)\347\360h\222u\36358\241F\215\363\306\007ebbdj\210!\273\372y\343|\341u\347\306\315\247\225\026\253\273c;\253\236\316j o\376\317\252\263(\302\0251t\214@Tn\316\334\2356J1\r\230\311\325\233\324\315\327`\006\025\225\371\345\304\002\241b\"\245N\206\f\023\312\016\031\241\344\250\200\001\235]y\203\306\314\324\224\371e\313\266\215\004l:<\241(Oo7n~"
+	.string	"\324N\251S\312\026\251\242L\371\351\261\244\254\352\346\007\340\306\031uF1Q5\251sjmY\033ss>\235OV\214J\fJ\213-5,7\037"
+	.string	"S\316}n\023\212(\fU\030\230\023\23476\367t\363\001\240\205\207\207E\245\244\230\2710q\342\272\371\031\314\301\203\307\204\372\261\242:r\347\244'C\316L\311\315\317\240\355\356\256\001[tx=qPc\256n~\006O\222\311\017\220tx&\017)/y7?\203\037u\352\230v\032\260\250\206,\321yZ\264@\231u7\355\344\250\314\255\271\371u\230\306\377\036\023\316\006\236\273\2739sL-\027\334\312\346\240$\315,\27139\336 \221\246\030\225\327\227\237\r$o\r\031\035\035R\0255u\234\354\235\325\301\347)\f+\312\315\307 \2116\337\230oL([\266m\030\311\271\312\203\303E\271\"\336\315\307\200K\337>\261&\023{4\231\230mz\246\366\256\032"
+	.string	"\225.$v\311]\314\"@\220\r\031g\352\236\334l\363\233bf\023\223\r\220=2\344\311\235\233\3155:\2020\001s\3631@A\337\216\231\331\266\027\3071(p`^\312\200\215\275\201\231i\3149s\214\211\306\374b\276\231gL3&\030S\215Y\306\2043\303\230bL7\223\214\031g\217\246\334\217\261\230]\360\250\2248\264\200\031K\034U!\304\264\345\301%\333\256\362\340\222\327\311\2243\317\322\256\223)gZ1\257\314)"
+	.ascii	"\030:fl&\027\256\016`\272\362\340\222xS\326\216\346\332\030\346"
+	.ascii	"\022\245\304\201\311\212\372\312\031\231(S\316\304b\246\275\220"
+	.ascii	"\202fV\0012\005\314\211\314\254\002$\013\362\342\231r\246\024"
+	.ascii	"\267\260<\270\344\336\333CP\r95`h\220\177\001\032]^\340\306e"
+	.ascii	"\213P\224\033^En\336r\207\311\t7\377\2025\375\233k\246\026k\346"
+	.ascii	"\313\025)S\355\246\226\016X\t\233s\263\231\245\304A\305\305E"
+	.ascii	"\353\346\327\231U\230\374 \262\344\346_\220fB\341\3159\333r\363"
+	.ascii	"/\030\323\277\340\2106\216\331\260Ad\353\346_\320C\377\002\033"
+	.ascii	"\372\0278i\263L\bL]\017\266\233oA\235\276\005f\364-\340\242o"
+	.ascii	"A\025}\013\230\350[\240\245o\001\f}\016u\3649\310i\323\t\322"
+	.ascii	"\315'=X\356\274\300\334l\301\022\231/\363\303\301M\377f\330\355"
+	.ascii	"\321\f+\361\360\324\326\276\322\300\315j\016\312-3\023\345\204"
+	.ascii	"\233\317!\213\376\315$\267G3I\211\307\250l;\235kObbf\016,w\242"
+	.ascii	"n>\0074\375\233Hn\217&\222\362\016Om\355*\006\204m\t\242%$7\027"
+	.ascii	"\345\356\346s\250\242\177\323\210=\232F\312\272\tl\355+\f\222"
+	.ascii	"\304\321\341i\220\302!\344\346s8\242\177\223\310\355\321$R\316"
+	.ascii	"\311e\333\351'\215\f+'\311\275\263\bp\246@fF\316\315\347\220"
+	.ascii	"C\210\020\363\313\310N\225\254\016:\306\030\261+7\177q(zy\311"
+	.ascii	"\251\251C\327E\207\222\233\277\201N\377\346\217\243\371\303\266"
+	.ascii	"\335\262]\364\371\272\232\253\343#\245\f\216\274\233\277\341"
+	.ascii	"L\377\246\217\233=L\256\022\207v*\352#\220,\310]4\022\340\033"
+	.ascii	"\234\350o\370\342a\366\340aBi"
+	.string	"iu\240kC\226\376\206\235e\346\3102u\350@\001\005\007\264\305\321\257"
+	.string	"\314\225y\302\225\211\365\272\233X\345\231%G\322n\276q\243X\246\253\0024\375\n\224TUY\343\t\343\nJ\262g%\255\312\325\315\257\340\006\r\323\006\r\023\312\334\333\032\267l\024k\3240\241\264\223J\247\002)}\n\344\314\230\321\200*kb\304"
+	.string	"S\205\0026\375\2330\216&\f\253f\313\266\r\237\030Pal\311\275\303\020@\310N\214\007\221\233O\301\217\027/L(\275\367v2n\033\031\270Bb\347\204\002+\3752\317\3347\235n:\231Pv\357\275\351@!\261K\356\254b\207\337|\272\t\325\033\363\202\264\203\343\177\217\317\313\220\344\315\327\220F\377\267\277\277\271\237\212{o\253\322\270\213P@\346ooKk;\374A\026["
+	.ascii	"\374\317_\021\202\275\245\310\200\355\275m\035\035\266\366\244"
+	.ascii	"\003\203\375\270\275\243\270\234\036\300U\025\305\205c\312\214"
+	.ascii	"\253\252\302\224\031\327v\212:\342T\241\270\271\234\246\314\366"
+	.ascii	"\256\020\025\345Db\253j\312\354iW\2302\333U\373\305\231*\273"
+	.ascii	"\215\\N;jkW\330Q\373i\233mUa0\025\305U5e\366TUa\312\214\253j"
+	.ascii	"\233q\355\241\035\365T\214\021\265\213\025\266\031\227\234m\266"
+	.ascii	"U54e\266U5e\306\345\306R\3158\002\005\353\r\314\210\023\3534"
+	.ascii	"\025\265k\320\330\361T\034\212\2332n\3555{[4\251]\334q{\003`"
+	.ascii	"\357\035[\3055O8,\033T\\\r\250,O[\326\270\367\326@\003\252kk"
+	.ascii	"G\3059\331\0357\265dk\357%PJ\233\306\336{{\340d\214\333_6\316"
+	.ascii	"\351\307\216M%\2657\005\333\2707\215\275\235\354\216\333{;\355"
+	.ascii	"\275\317\342\016\343\3369\206\246\300h\320\330;\313\210\306\336"
+	.ascii	"\341\264Ej\357\213\326\206\255j\312\254k\013i\213\0253\260\r"
+	.ascii	"\303\350d\247\250\2666\330^\303U\324fNd\233j\357m\351h\260\252"
+	.ascii	"\25397\227yzf\220Y\022\343\346k@\242\313;"
+	.string	">Q;\270\354n\276\206/]\3329\246\360\004\307\315\327\300\245\215c{\033{\246X\021\030[n\326M\222\004\271s\2631-\307[\220\233\313:\371\016\005\rV\332\370\303\246\205\345\306\315\245\034,8\256\273\233\257\001J\303\201S\3061\322[J\225\032\310\275\263:\004\305\200#\303\214\356e\034!<wh\236J3O\362\250\221\272\371Fr\3127e\233\035`h\362n\376\377\222\313\271\224m\214\266\234\344x\220\244\315\313.\271wV\007\373u\204\222,\347^\266)\331@\345h\202\343\346rMO\355E\034;7\337h\255TS\312\225i\236\3408z\335|/%\232-\204\323\200\344\221\273\371FTty\2464\203$\211Z\215\233\313\267\322L\017[\036\270!f\342\236\270\325\331qs\231\021t\271!s\363\215\3024\\IF[\241\331S7\337(\210~]B J\\U\341\360\327\263\002\205%\210A\025\222\322\022"
+	.ascii	"\203(p\005\nK$\251\303^\205\025*Z\302\232\252\275\026'\230zD"
+	.ascii	"XP\177'\206\200\301\237\217/\365\241+J\202I\035A8\264@\272\242"
+	.ascii	"MA\224E\004\230\324\245\f\030\210\253\ta\bL\352\322\005&ui\350"
+	.ascii	"\\\241\242%\244(\212!\021E\341s\245\243\017\033\222\322 \nT\030"
+	.ascii	"\001\265DJlZ\3214\305\320\225\2162\030RI\b\006\207&*\270\322"
+	.ascii	"\321O\350BE7\b\006\207L>5\305\212\246@\177~?\264'\375\231(R\325"
+	.ascii	"%\"\032\024A\004T\207L\034\226\200\253\032\201\037\005W:j1D\361"
+	.ascii	"a\b\034B`\b\024\002\231zW:ZB\177\276\017C\340\217\330\273\322"
+	.ascii	"Q\222:\374\220\244\016\213\222\324a\317\225\2168\250"
+	.string	"(\323\322\360\027t\245#\225I\305\207!\360\202\312\244\242g\204\006\r\\\351\350\303/\205\322oE\231T`\222\320\212_\2524\242\0051\350JGMK\300\017F\253\210\246%`\005\246\341P\204$\240\t\241$t(\302\352\323W:\"\246\301\246\244T\351\247f\020D\327\341j!]B-\220.\241\026X\241\242%\240hR\177~\251\322\257\347'l\n!)hEW\265\347b\005\022\207@\242\211$!U\304\352K\227\200\353\317\252\246+*\302\n\025]\211\202\250P\005\220\204UDRJ\004\252)\211UE\203A\351\022\260\2044\370s1\"U\201\022S\026\"0`H\227\200%\240k0%\261\324D\202\n!\220\305p\311B\272\004,\341\227\266\210@\013tiH={\277\037\212\207D\027*\362\005\242\025(,\241\366\\\351(%\016\177\037~)LH-\200\256(\t\016\234P\201?W:\372\021?\374R\234"
+	.string	"\352\340\250\204\026'V\025\r\366\204@t\204\026'\206\322`\222\020\235@oHD!\240t\004\f\376>"
+	.string	"\203\277\244\341\b\300\340\357\f\352\340h%\242LG%\254P\321\365\202\020\210\216\260BEW-b\205\212\256\031\256t\364\363\021/PU\240\301\020T\b\201KD\364g\205\212\256\025\216!MjZ\201kPD\272\242\301\246_\020\035\261BE\327\242\377\200\304T\230\252\320\367"
+	.string	"\004\003\200\020\242\305\371\020\n\350@\001\035\230\017\241"
+	.ascii	"$$\005\200\200\244\017\002\022^\327\325E\220)=Q\341JGL\352\322"
+	.ascii	"\007&u)\3651\251K?\253\2178\\\231\200\304\237\232\222`R\227\204"
+	.ascii	"V\325\267\246+~\250\t&uiU\207&\230\324%\"\325\007\224$D\227\226"
+	.ascii	"\206#B`R\227\210R_R\211\025*ZB\212\237\317R\272\252.H\240`]S"
+	.ascii	"\244I\2765\203\332\344S"
+	.string	"\372\255@\023IB\021\301\340\220Hd\201\230\256\351\322\260\250\004J\276\024L\301\224\210\232\220DD\327\325\227\"M\322p\245\243\244tM\203LK\303\021(\200A\364wA\255 \030\034\022\263\322o\0052\225&\240.\260\2326\005Q\026f\223O]\002\022KP\177\300%T\350\202\304\252\244\002\030LQd\002J\304Cb\352\201\337\017=W\237\232\201t\t\270\352+\035\265 ~hA$Z}>)\223\213\0228p\202\004 b\232\004d1$\232hA\034\002JW\364\204\222\232\022S\244'Z\020\203\210\253\ta\b\350\212\2220\001=A\374!\256&,\bCP\233Vt%\341G\024\"\256&\210T_\272\242+\t\351\022p\0256\235hA\034\022\206\220.\241\304\020T5\375\r\211&~\304!tEI\004S\241\020U\372\375\240+J\"]B\211)z\256t\224\006\323\337\017\005\200\352\373\375\320r\275\322\221"
+	.string	"\326+\035\251J+\272\264dU\237\217)\005Q\013 qEGX\207\304\336*\344;\257t\264\376\232\210\253\nB\365\265H\327\246\245\n+~\303\240\317g\256\302\246\341\317\347;\211\251\320\204\241\317w\252\304Tm\022\372|:I\b\\\341\363\231\252\020\310\244\372|g0\365\371zV\337\252\002\203CW:RS&\027\253\001\222R\"\252\244\032\340\203\272\002Q|h\022\2520@\213&!0h"
+	.string	"\017@\360\201\020\242\305\2074\251)\370\023\002?\020\325\246\017\tX[\244\302 *$\246\253\020\350KBS\242\322\312\344\363e`\221\022\231|>sU\201A\237\317DW4\311\3473\323\022"
+	.ascii	"U\237\317\\\361\033\006\363/%\372|V\240\260\2040\204\025(\004"
+	.ascii	"\232\304\325\304O\330\024B\022\232\236\370\375D\\\370\375P-\f"
+	.ascii	"!\tM\211\346\252\372\200L$\244HI\244L.J"
+	.string	"\360\2250A\302O\372\023\242\253*\004\352\325w\201\022Y\b4!T\177&\220I\305\252o\004\210\022?#@\224\3501\177 \200\370JGj\023\n\r\252o\204\244!b\272\252\350\222\251\252)1)\t=S\026h\220\204&\246%\335\344c\221&\251M(\264\352K\177@\026)\t\265\t\305O\352K\231\\\224\2406\241\350I\231\\\254j\023\212SmB\201%\200\344\373\375P\3634\001=1\202\204\bs\275\322Q\023\323\222oHt\241\342\367C?\250\304\224\005\220\2304\200\324w\242\203\017:"
+	.string	"\241\211i\211H8\004\256M\301\241\232\022}T\337\205\324\327\304\264\364c\256\301&5=\221\256)\211&\246%\013\251O\250\002\030D}=\241\n`P\304\357\207j\027Ihz\002]\321\244\036\242\232\302\247\244\002\250\344\373\375P \"\252\364\313i\322p\204p\bT\201,R\"\0201\r\006\201)L\026i\022\016\242,\210\351*,\241B\b\f2-\241$\374~(\321\b\022\"~?\324L\177\302\013\254*\232\212\260\212H\312@0\375\375D\250@\r\252oHt\241\302\\} \016\220.\001W\246\341P\2045UAD\327^\032D\177jy\246\030AB\204^U\037\213\224\304\220\350BE\017\213\224\004\t&\240\304\013\301\240\242\365JGC\242\013\025\024Th\362\2110$\272PA\264\256\260\252\357']\321U-\323\025]I@Z\231z T\025e2a\030\354!!\021\201"
+	.string	"*\"\256&\206V\325\247A\bCp\021db\022\201\241\267^\351(\305\007\341pii\370\253"
+	.string	"\204\213\253\372\222\320&\022"
+	.string	"Q\364:@q\221P\\\020(.\022zA\240\027\251\305\005\321\342\"\271\270 \204.H\020\3235\b\fA\351\267\016\205BW:\372\240\022\207\2520U9\250\276\026\250\020\270d\301\004\f\2530US\"\323:\024\256(\n\026\032~,\202A\251\317B\352\273\220\376\210MC\022\210\351\232\216\260\nS\"\261\351g\301\305\n\374\241L(\n\241\025\205\200\006R\265)H]\211iP\304\210Tm\272\220\252@Wa\372#\246&\204C\340\312\264\324\244\n\207\277\r*PM\211\351\252\272PZQ\024,z\251\nt\r\016Y\004\203\351/\030lJ\261\242(X\020\255\302\246\341\210`0\035\341\202\230\256+\n\201\364G\034\246(b\021\2244\004\022S\023)\230DXQ\024\300 \025B\240\220\210n"
+	.string	"C\020\375\001W q\004q\030\202p\b\\Qb\023\211\025E\301\242\267^\351\350\303\020\230\341C\246\224\370a\035\016\211\037~\\\020\327t)\r\246k\006\325ga\205\212\216 \034\002\327\237\260)\005P\352+\261\022\207&0\020S`\n\340*L\223\200>L\352\222\312\244\242B\2134IX\"]QbR\023\212\302\327b\210b\305\017\r\242\300\240\252"
+	.ascii	"\246\020\016G\254\304!\323\317\352\003\001i\025\002\233t\t\224"
+	.ascii	"|\351\212\022}\351\212&15\371\202(\220\230\252E\253/\304*\004"
+	.ascii	"6\235GB\032\201A\006, \001\375;RW\250\350\372\341\227\342\203"
+	.ascii	"\020\210.}\370\021\325\017GE\304t\375\241DT\351\347[\207C\024"
+	.ascii	")q(8\034B\300W\376\3271J\034oex\276h(\r\245a\330bq\3572$Z\311"
+	.ascii	"\235u\243\303\257\245\256ax)\245\336\3249s\263~q/w\260PAs\263"
+	.ascii	"\216\272\0277\270\256\036"
+	.string	"7\277\356^N\330\022\205\314\315\357\360\244\177\375t:\3018\212f\202h'\0371\264\350\356\350\235w\233\220\375\220\272Q~\346\375e\216\022,\003\321j\323\003/O\256CC\346\n\317\317<\277\375rkD\001\245\3212G\310\3158\r\351'\236+\305kj\310\035;\2637v\362\334\331\021\232\363\232\002\227\374i'K\217\033:\316\334|\326!\375L\342\331\231\201\226\202\035PW\221\r\220:?\355\376\263\356B\271\211\221\273s\263\220%2O:H?\353\350\274\274\266\257\233{\347\0349\276\252$in>\345\240\365\362\030\231Q\006\031\347G\215\2257,o~\306\371O8'\235\0262g^7w\260Efi\211L[\006\351\347\233\374\303\316\206\0227m~^\024\337^\254\371\331\346?\331X1f\036\222\206A\250#\362\343\201@,\345(\022\306\020C\210\031\232\331&\035\323\025@@PT\"\024\313\222\350;\023"
+	.string	"\304\314\353T\221 '\035c3#\222$\251O\206\003\005\367\304S\325\024\032\027\254\322T'\307!\332\365\307\343HOr\211\003\f\003h\"H\366\026Kl x\363\316\rI-\234g$\020_\240\032,\254\246)E\226\020=\271\322\r\257\0350\365KN_\351h\232\364\0357\246\341B<\255\230\264\325\220\317\205s\237\331\277\370\025\261\373u\363d>?\304m\016\312Ge\350Kh\303\313\346\207s\n\004\365\023\326\005!\304\240\340k\334\232["
+	.string	"^G\332\351J\004\200r\346\207\207\300\374 \004\204\030JM\025\357\324\021C\346\341\216\370\203\231uY<\235\357\234\216\244\210\032p\022\201\361\344\247k@\311\361\314\2015\302\324\024Y\305\354\357\326\020\257 \025\263\323\332^\273\264+\3107\330\226"
+	.string	"\r\001\327\232\t\013\256\217W\304\343qH\034\023!?\260(\0328\333?\250\340\332bT\031$\303Ub\336\016\256RZI\007V|\203,w/\016\201\240\035\215\357\203\2322\342@\303n\031X\205\223\016\002\244Oq\334\0065B\201\323\350\213n\231\323\035\313\200<+\320; V%\345\275\210B@\362-\316\242q\331\243\320T\f\221OP\314"
+	.ascii	"\220|w$\203\251`\3209\365\253&|\360\375\035\233\217\301u[N\223"
+	.ascii	"\272\036)\234\216og\2470\334%\214\223\004\237\246\025\027\224"
+	.ascii	"\242\210M\253\250dn?\333D\"\353\374\315\312\265tHQ\304B\300\017"
+	.ascii	"\001xQ{r9\026\277\201UUm\251>\221\213A\335\357M8\347\371\254"
+	.ascii	"i\3700'\312L=\223\344Z\357\277?\261\217\255\356w\025/z\256\200"
+	.ascii	"mY\217\267\225{\220\205\343\240\230\203\253G\005\346\377%1\363"
+	.ascii	"T\321\367<F*\322\306\305E7\020\3619 \r\254\265\205E6FD\225\013"
+	.ascii	"\"\250S\2639I\203\240\325\365\277\275\203\0370\252ySl:\366H\355"
+	.ascii	"&G\245\262VF\250\023\232\220\276\224l\345(?\004n4\212\225\213"
+	.ascii	"[(\202\317\266W\242\237d\242\2056\211\242%\004\231b\222D\274"
+	.ascii	",\340\341\270aZ\374\316\247;2$\377Z\353w\032\246\253\2043y\274"
+	.ascii	"\256\331%\204\230\243\374\313\024\355\222\216}>\314G\340&J\377"
+	.ascii	"~\263\016\024\\'\306\353\251+7\333`9\\O\030o\221\377\031(\311"
+	.ascii	"x\025\344\253\261\276H\022\201\271\304$\321N\214\323AE$\205w"
+	.ascii	"\024\017X\312|~w\205\204\323(OE\320\036I\034Q\262\214\376QA\006"
+	.ascii	"\333\341G\030H\257\013\333:\267\035\374\"\177\241\247-$U\265"
+	.ascii	"\232E\264\211\255\335(\n\307\306b\263\234\221(n}\303\374\255"
+	.ascii	"\277D.1\334\212b\305\3472\236ca!\030r\007\3531\251=\244\331\260"
+	.ascii	"'\tzO\374\317\202\003\005\021\240h\273\303J\237\250\2274\307"
+	.ascii	"\361\267\007\022V^\036i\354\021\323\257=R\301\006j\025\030=c"
+	.ascii	"t,\346\253\350c\230>\255\031\250\241\357\243\216\016\223\311"
+	.ascii	"\201\3167}vF\036$\360+e\301\327S\325\247\031k7\275\317B<\222"
+	.ascii	"\341d\221\342\361\304\027\035+\373\225\203\335\276\241"
+	.string	"\034\361Kn\274*iW\351\374M\374\261\025\004i\256\213\245\271\256\27013\032\351\315477qh\271_\233\224j\354\017x\255\201\027\236\326s\310\360[\007\273L\\Xz\231'kDN\253\347\247\246\225\246\002\210b\333\335\351qe\352o.?)\262Lx=\263\"\346Z\354 \237:*2$G\340\220\n\300\256\032\235\006\214-p\353:tsD\262\021\363\351\326\036$#\262wr2\021\244\254\214\364\204Z\377\250\216\201\243\230\334\332M*\275\304\033\3272l8\352\207jB\273\257\026W\322\253\314\270?-\301\234z'\027B\337\334\256G\275}\0202\006\307\033\034V\016\020\276\034\276\032\206g"
+	.string	"$\235?\206(\211\261~Q\317=.\214ej\020F\235\376z\004A\006\307v\230\237@O\362\334t\330\003\270\241y\346\242d\253\017\307\375\027\2247w)\233Z)N\355\362\36533Max\264\020T\376X\tn\r{\262J\0274\317\203\307$\312N\353\243\3040\270\205\350\343w2pj\352\203\222z\223\027i\333Rsf[\200\252\377z\364=P*\267\322\376\2579\333\024\220g\251:\351\360\254\253\n\221[O\377n\342\353T\262\3546\2338Q\306\235~C\001\254C\026\001B\311\275\t\344\371\353\2623(\333\277\231\024~UmZ\217\302\375\243w\314\221\027Q0\207\335\252\200({\374\250"
+	.string	"\303d\275\336\307\034n\220\021e4.%n\304\350&\323o4_\265gPC\215\240B\360"
+	.string	"\325\033\005UN\346@\255 4\007xa\324\214\003\261J\234\3261\206n\365k\257\233\235\210G\224}\2234o\301\201\222\347\2068\302O\254\246\036I\221\245\377\203\376e{\215W\333C\002C\350H\2234D86n\371\253O\377\257$\221\323\352\360\246\336\337q\323\264H\356[\237B\260\257,\003]\026&U\036\232I`\026\031\274xYpqE\024B7\337\207\343\030f\243\372uB\233G\035\216\350\221\275\230\t\276\266\345Wm\346k\347c\342\325\213b9\b/.92\357\266\330\333>\035\024\202\025\335\322^vVP\374E\273\263\233\270a\222\340\215\375hV\b;tc\351\247\311L\325\222\344\306\311{\013Ha\375Uww8"
+	.string	"J\257+\217(:\224\212\305wX\302\254\3376\240\312\t1?\013\313\207\300\351\252/\224X4\245E\225\371\304\375\005fC\211#@\236\330>0\277}\274\257H\246\273\226\300&2\352\272\356\341\327\325%\310\367\335\332{\204\314\347\017\356\\}\021\251\322N\370Bu\t\026\271|$\306\373\226\221x~\221_3\231\2136\213\254\235\372\242)\325\217^1\245\356_B\2036Z\026-L\320al~L\211#\222\271\274\324\300\320\203\241\321\333\343\035\321$N\322\330\031\013\221\212\304\365\364\2159ky\024T\032ut\370\213\316\260"
+	.string	"\333\273\023@\357\021JS\\\232\233\261e~R\337\247P_\362c8'q\"\327]\262\233\361\232)\"\220pX|\030\220\r \221\355\242\340\305+$\026J\313\020a\177"
+	.ascii	" \n\tV\370pd\307\3724#6m\253\377\305\"HsY\211-\035\201\224\304"
+	.ascii	"JP\027\2709\354\265\203\304\226\f\217-\255\270r\366\243QO5Q\343"
+	.ascii	"`\037\362\346\2333>\200<)\034mD\252F\204\264\230t"
+	.string	"SW\244\306O\013\227)T\235\227\315\030\344@<\243\250\261\\c\005`\tf\375u\272\270\003\263\f\267D\330\230\031'\202\232\324\361\007\005-\231B}D\374\226E\213\\?\240Ew\322\213\376\023\375\031pjHh\261s\315&\3251T\344\245U\232\332\027\207\307\023\324\022\234\312\202\251i\205\"aLH\0131\020Fif\017$_\363r\007\235?5z\252\363X\fLmiU{\220\227\341\177\202*\305\336\245\333\324B\244!\346s\213]\302\f\2502Z\031J\306\270\2710\0271W\251\342_\265\311\261R\342\325\317\374\tf\333\330\202:O\\\"?D\3024!I\222\362\267K\006\204=\024^\250\226p\357\336_\337z\242\201\375\376\2477\245\3079\260\262\317\261g\024i?\332\230\272\034}\204\342\250\246n\203m%\334K\312\273Fx\267\230\n\262\216!\212\0369\034\371\373SxP\375\243\002\210(\034\307A*"
+	.string	"b\244\214\b\357&\241w5\212-\217\301\257\020.\\\366y\210q"
+	.string	"\2606\307\366\035\270&\225\240\321W+\211G\210\020=B\351\242m4\340\301E^\345!J\301\233\260\255\325\t^Sx\261p\326\223\360\321\270\330\301\002\333\252\271\334nc`y\316\033u\206\035\246\003\275U\327\273\"\016\210bz\310\237-\nHYHc\345\036\237\347\2133ht*q\343%\373\357\262\265\217HH\270\350{\303\036>\276\020s\033\035\217I-\314\300C\250Y\2476\310\316L\317IQ\205J\354\3238\220C\216K\212\253((\022f\316\372=7>\226\b\267\251*#\373\200\3148\"e8\353d\352\311\331\020\252\330\343\263\231\"\037\031"
+	.string	"fQ)\007\030+\240d\340J\324n\355\351\360\326hwZ\013\225\350\2104=w\223\030&\331(\"\035\240W\276m\222\034\314\343E"
+	.ascii	"m\232\017i\343c\261\371\260\260\003\0377\262I\221\310\264\203"
+	.ascii	"\262'a\332"
+	.string	"@\224\310\305p'\367\224\320\235W\326bN\322\002\362&\246\246\206\347\265\004j\003U\200\232aMPbKV\013\020-\224U(2\361\025\210\261e\211\317\3101\337\345~\023\264\250\217\202\313\336F\020T\277\374\261-}a\030a\303\256sG2\323|\231\370\021\305\246N\240\017Z\300\021\212\016\306\306\307\236rTU86_^\212A6Kc\227q2\342\025mK\203Nt\262\271\337\255edZ\034\031\025:>y\022\342\210\304p\013\342\340I\266iG\025\370O\311\304l\177gzl\214\211-%\214+\363nk\211\262\021\2372\332P\345>\206\212?\364p/7\2423\021lo\017\003\024\234\3532\243\222b(a\205\204\016\367\334\275\206\360W\207 HF\217J\335E\360\224\007V{k\003(v^8\234\253!\b\200\375\203\265\300#%]\265m\257\314[\375\214#Z\002*m,\"\225\267\255mv\311\004\301"
+	.string	"\272\333{j*\007wW\213\316Np\273\306\332\202[F-\266\016:\036\247u2{Q\325\270sn\332\346zh\270f\305=F\2740\200]\315z=\256GL\266N{7\201'Z[\033\215\3314\r\373-\315\202\207\226UY>\243\214\377\034\264\363e\360\334\347\321\234D\"5h\200V\032\3465\227@\2635\240z\036\242]*=W\nQP\276\360\351I\217b7&(\360\277\033\304zXy)\303\263\233\214\247u\206\331*\244|\214\n\031\214\340T\3008\213\267eDa\243u3\2655\017\362\225\322\257\211H\340\264VzJS\343\330\226.(@\200\245\t\227\224<#}\376\360\347WE\254\206y\302\2718\222\360J\374\241~\033\334\021%b\213\350\032\377H\240%\020P\263\227"
+	.ascii	"\342\316[\215\335\277\332F/\277\314\264\004\203\300H\204G\016"
+	.ascii	"a\370\222\274\327\245\241%\304P\350\274\360)\232/\337\344c\033"
+	.ascii	"\t\223\244\237f\302\361\311#\243\316Z\023\t\004\307\254\207\266"
+	.ascii	"\025\320|c\335\336\272z\030\274\216\316\033\374\201\202a\021"
+	.ascii	"\332\004_\024\343\325\356@\227\tt\001\274\032\375\230`0+\\,\026"
+	.ascii	"Dn\367\027 \274\234o\206I8\201\242\306\310"
+	.string	"\227\377\260sH\360\222x\210\204\323\300\364\210\246\205#\031\022)\223\231\230\006\020}\370\267\3147\242\023$\026<\004\035\275\031 \277\363\237-\2779\341\317\207p}\270wfO\212O=\r\202;Y\356\346\373\263\256\340\037\337gE\247\016\t\220\376\205\026\201\302Z\032\236\265\265\343_\305\370?6th\246\260\273\305\256:\220\311\334\202\0277\341f;&"
+	.string	"\375]\305*P\302\364\261#\376\371\256XS\376\013W2\241\250\200\177\233\250\031\202\377\031e\351"
+	.string	"\311\263\303?\017\367=\025\017~\242H(\364\367\235\225Q \326\001H\234y\242BnN\024\034*\227\344\277\332\266P\336\0162?k"
+	.ascii	"\352N\316\260\326\344\037\"\305\017\302\213\364\374E\375\026"
+	.ascii	"\037f1\360\347\3647\241\313\324\034\302\214\274\016\342\363\221"
+	.ascii	"\354R\346\306\340sn\360\257`vMY\035\343\223\205-\004\377<\373"
+	.ascii	"8\360\\\350w\301\003y\347N\364hZ]\276\341\327)o)2\366\364\246"
+	.ascii	"\006\375$\307\227\207\3729\224\275TC\367\035\342\302\311\230"
+	.ascii	"\266\356|pm\370\206|\345/\305Y\244\333\203\265dU\177n\231\343"
+	.ascii	"P\237\023~_:\313\256\373Jn\327\361v8i=\237|\301c\343\260k\021"
+	.ascii	"\235\013\251<\277.\300\035$8{q\373kF+\016[v\235\345\321\360\r"
+	.ascii	"\257\265\216{\202\372\234\373\232\254\346~\276'S7u#)K<\366\343"
+	.ascii	"\347B\350\350\303@\277#\370c\224of\217\345\030[\260+"
+	.text
+	.section	.gnu.lto_.symtab.faf516c52598b806,"e",@progbits
+	.string	"tasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"osdUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"rcdeviceUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"pinioBoxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"afatfs_poll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"subTaskTelemetryPollSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\003"
+	.string	""
+	.string	"updateArmingStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"rcdeviceIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"osdInitialized"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.faf516c52598b806,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
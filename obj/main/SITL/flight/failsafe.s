@@ -0,0 +1,1120 @@
+	.file	"failsafe.c"
+	.section	.gnu.lto_.profile.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\305"
+	.string	"\205\b"
+	.string	"t\013\271\001"
+	.string	"\025"
+	.string	"\220\254\202\314\013\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\270\372\352\363\016\002\002\007\002\001\004\243\237\214\230\017J\002\003\004\b\b\002\t\002\006\002\n\005"
+	.string	"\002\001\b\257\253\313\240\016\030\007\002\001\t\345\227\312\267\013\004\002"
+	.string	"\002\001\n\207\330\300\037\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\353\323\235\254\b\017\316\362\227\372\013\020\260\222\312\332\b\007\002\001\021\223\210\212\227\004\006\022\315\361\362\357\016\b\007\002\001\023\353\303\321\231\004\024\302\260\202\373\013\025\301\275\326\260\016\026\305\310\337\235\016\027\240\342\234\212\n"
+	.string	") \260\2021\032\336,9\274\2002\261%\340\206d\\\344V%\243+\264b\222rG\271:\320\335\200\t\b \001\311\bH\226"
+	.ascii	"\346\205\006\2305\356x:6\021f\200\001g\347\026\016\t\230\034"
+	.ascii	"\016\201\001Q\004\314\001M\001\312+`\021i7\005s\"\004\356\366"
+	.ascii	"\306(\236\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 \177\255\002"
+	.string	"\204\003s"
+	.string	"\017"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021"
+	.string	"\022"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\f"
+	.string	"\250\300E8C\250\32655\200\001p\007l\344\nn\036"
+	.ascii	"\003^\232\202\001\026"
+	.text
+	.section	.gnu.lto_.inline.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\024\002\335\b"
+	.string	"\222\213&,pK\323\030\374\007\327s\244\204@G\b.\\A3\270@P\b\252>\345w\243\246\347\252\252\372UW\n*\211\335\215.\211[J\231\002\3777\334@\222b\302!#\031\252\364\261\273\314\317\r%u\034\035\022\r\356\201\037\323p\376\231\352\217Rr\303\b\270%\312\247\354\366\230\004p"
+	.string	"E@A+\0270 \356tl8.\3514\322\353\272,\344\017r\301B\241\002\037\b\031\001q\201\201\017\263\307(\363qRK\037\227\374\317\363\345\356.\362SV\273\373\344\243A&\354\256\363\315\252\004; \300\"\232\033;\177\302\322\273\301\272,p+\3111\347g\262\340H\355\364\251a\020\035\230WC\364\342\355B\204\fW\003)\336%~)\324)\210L\203q\215\233\344I2\223\"y\"sB\303\254\021\217c\207M\260v\216\007\377c\230&.\330\352m\357eyL!\020\3470\020\326t\025(\274\2055\207\002\271\344D\374"
+	.ascii	"f8?\022\013\343\243r\201[_\361\214\335b\240\310O\345\025j\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"E\004"
+	.string	"\002\006\023\036\260%\351\f\303\200c/\017\303B\371"
+	.string	"k]\222$\371Xk-\261\255\221Fl\261\211\224)\377\004K<\370\027\374\201\323C!\321\003>y\344\317\037o\274\271T\361L\327\266D\260\275c23\026\312\323\226Q\264\305\215\242\341Z\364\"\032"
+	.string	"@\b\314\r\027n\231\272\t\024& \365"
+	.string	"\340ye\261\263\373U\027X"
+	.ascii	"\344\340x\nm\2705hf\020`V\\\013 \027\334\200v7\205\341<'g\337"
+	.ascii	"\226%`\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\230\004\003\230\004\004\270\004\b\230\004\t\230\004\n\204\004"
+	.ascii	"\013\204\004\f\204\004\r\230\004\016\204\004\017\230\004\020"
+	.ascii	"\230\004\021\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\265\004"
+	.ascii	"rE\016\023\2407\035\377\377\377\343X\353MKo\177\377\013\322\244"
+	.ascii	"L\001\377\317C=\036\233\225\nb\270\242\360\r\006\256A\266\366"
+	.ascii	"\371\227T\222gu\242\316k\331\312\347)\267N\323n\346\021+ \200"
+	.ascii	"\002\031[\017\266\354\0068\256\b1/h\335\234C\366\016q\315\263"
+	.ascii	"\223X\241!\034.\034\013\214\210\233p{c\343\3443\002\326\024\341"
+	.ascii	"+\261Lf\324,\273\221\003\302\250\002\263\274B\324@\205\300- "
+	.ascii	"\032\3400P#ok11\260\320\251\254\t\tp8|\332\316\20557\004"
+	.text
+	.section	.gnu.lto_.lto.3cc2bf4c4f669952,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.44.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 \242\305\004"
+	.string	"\244\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\304\341\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\307\007us\336\006uq"
+	.string	"\005\001\006'\001\f\005\001\006\035\001'\001\201\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.46.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 ^u\002"
+	.string	"\264\003Q"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\036\005\001\006'\001\024\001"
+	.string	"\n\004\344'\001\350\007?\202\210\200\300\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\275\001q\274\001o\273\001"
+	.string	"\007"
+	.ascii	"6C\202\272\003\215\001\221\224\273/-a\240\b"
+	.text
+	.section	.gnu.lto_failsafeProcedureNames.47.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\231\n}\273\0012\206\b{\230\317\001y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\005DROP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\nAUTO-LAND"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_failsafeReset.48.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`e\002\265\017"
+	.string	"\306\233cE\360\220*\035\352|\t\345YiG\261,\2633\002\365ph\336F9\220\322:\306u\033\353\225\314\357z\333\037 \362\310\333\377f\363\306NM\316\270D\376\f\222#Vv\312\232\3742\257\227\206\304\304\022\262\211\224)\005G"
+	.string	"I"
+	.string	"U"
+	.string	"i\217Kw\232\216\231\3462\255\231\316\247/\300\333 \323\361\262\233a\346\306\312\"\f\b\333\007M\262g\234\305\262oQ\245\264n\273\033\252\207\223\236$\377#\376\241R(O\017\301\356:Q)\r\267\336v\001\333\006l\005\003\252\234F\031'\025\323\354~u\251\252\003Z\247\020\246\234\3615\365)9\\\362\022!\315.\206\017\237\304W\027\374\017\217\036\235\344Q\217\376I\367x\005P\203\211X\225r\306f\231R;\330\347vw\255+\266\2467\231\3762\255\311*\333\313m\b\207q}\265\330\315vOgG8\213\025`*\246\262m\324\226p\025)b\353\323\215\211k\364\323X\343\244bb\335S\215v\274:\365&\334\205\203\242\323\003(0\033\253\250v\347-O"
+	.ascii	"\226\335\375\360[~B\00442\322=r8P48\215w\t\356xx>\234\021\t\210"
+	.ascii	"\363\tM(\210\200H>a\005\020\247$\354\210F\241\007\001\207,xD"
+	.ascii	"\241I($\nAV\351\334\352J\002\016\262\222\232\354\203t\266\202"
+	.ascii	"\323@f^\215\026\322\331\013.\023\"\363R4\025\203\307`\265\331"
+	.ascii	"\255\301c\300H\315T\016\376\302\005\350\212\271=\370\253\205"
+	.ascii	"+&0  \003\0211\325\001SC?L\201\223{\367v\203\034\006\036\207"
+	.ascii	"Y\231\301\021\337>\354a\\}\330\303\270%\001\307\370\2724qh\266"
+	.ascii	"\370>H\315(X\006k\345\261e\314\022e;v\017\327\004\b\361pw\256"
+	.ascii	"`\225\312&3\0060N\177r\366vHF\270\032\007\200\030!\307\335\214"
+	.ascii	"\375\210\373\301\340d^\264\225\f"
+	.text
+	.section	.gnu.lto_failsafeInit.49.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"\245\007"
+	.string	"\022\31647Po\322\001\240\020\"\217X\221h\300\0240\236@\227\255\254\221\274\004m"
+	.string	"4+\232Ey\314\277\035(\314FXX+df\234\215\354\373\366\017)\026\266\250F6\331;\245\346l:\330E=\331\205\315\017\303B\346\301\246Cv5L\316F\347f\300\332Cg\233\037M\333\246\246\356\253\215%\200\323\007L\313(R\330\247\226\rq\024%\311\250\254x\007Yv\304G@\001\246\335=\360C.\"\341w\\z\"\004\337]\372!\353\022\301\"\245\001\3622\202\237]E0n\330\2576\226\354*\241z.\002\337\356\305\027\263)\211\342a\373\032s6\313\253i\217:\251(\361vwF\216s\207\234\377\323\0132R:\222\3500\243\260\273\206\035\t\343\216\267M`\333\300\266I\013"
+	.string	"3\241\241\037x\311\334"
+	.ascii	"6\361\224$e\025\206\256\341q!\214\227!\300\245\353\264\363\t"
+	.text
+	.section	.gnu.lto_failsafePhase.50.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"-\007"
+	.string	"\362\31525`m\322\001@_\002\fC\\\214\226\200\037K\324~H\220\262\322\305\n\321,\352\275 ,\324\211\236\030o\255\220$!uHQ\310\223\"\304\363`kdo)S\n\336h8\025\345\351XT\025?\t\bV\247\212\013\026\245\0207\230'j0\276\0308X\374\\\027\026/\334\376\255\222\254\231\221B\330nxHf\331]\003\037\344\234\203\257q\350\007P^;\364A\323a*\300\307(;\233\023\245Z\330\177\253$\333\351\324J\311\004\323\355Jt)[\002K\033\266C\366\305\347xG\310\331\3432\266\200\n\222\b\021\224].f>0\035\276\013L\207\212\361\354\231\371\367\370;\241\030\3216\321\263r\260\273Nm\233\270\365\266\tl\027\330\276\b\b"
+	.string	"\002\013\255\262\030\005\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.51.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"\362L06Pm\222\016$G\213\307r\300\334R\337\360\263\264\363\207\251y\371\252\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352Lj\031\002\030\274\314\326\266F\210L\001k2\233\313\352p0\353\212\036\206\005\214sE\007\314j\210\032\255\0233\002g\017\033-z\262L\213\230.\013KC\002\021\234\370!\n\262\001df\302\375\250)\342r\264Z\342\363\312\265\272\037K\253\007\003L\242w\372.\364`\306\227JX\372\337\017^FJ\006L2G\247\225$\251D:~\320c>@"
+	.string	"\275\265\333\030\025\343\204\"D%\263\213P\243[\337v\353Q*\345\002\205#\205\372.\n\231\371\343H\025\035\366/\370\r~\213\b"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeIsActive.52.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 \365\335\006"
+	.string	"2\31506Pm\222\016d,\316\264h+"
+	.string	"\r\333\364\263\264\363\207l.\370\257\326\r\373w;\332\302\356\274\021\257h\332\377\315\314\024)\352LjY\200\030\274\214\326\266F\210L\001g0\232\313\342l0\353\212\035\206\005lsE\007\314j\210\031\215\0231\002g\017\032-v\262L\213\227.\013IC\202\020\234\370!\n\262\001df\302\375h)\342r\264Z\302\363\312\265\272\236J\253\007\003J\241w\372\016\364`\306\227\312\314\034\222\376\367\203\026\024\223\001\221L\321)%K\252\221\216\377\363\227\017\020>o\3556D\3050Q\204\2302\273\b5\272\365m\267\036\245N.H\270\021\250\317\242\220\231?nT\321a\377\202\337\340\267\b\007"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.53.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375 \372\335\006"
+	.string	"\362L04`m3\006\260\2015\0379\0019\001H\301\217%\252=\224n\250\236t\207iMz\345\303N\234\350\305\274]\351\300\032\252i\261:o\244\260\341\313\222$R\246\024\305\254Kve0\332\225M\315\202\202\206\311f\203v1L\214\313LK\240\233\303\205\233\232m\343f\365\33514\211\\\305\304\023%jo\250\366\301\037\233"
+	.string	"\321\177\203\272\303\036\020u\206e#8\320\236e\315\241,\017>\244\n\016\024\017,\265_\007\306\213\326\323c\250\215\t\037\235\f\244\374\237\022\351$rD\243\255\253vm\211?\321\r\2622\0212\372?#\206;\303\256\366\206\001<P\307\320\202\360\277\320\003Q\270\321m\t\332\026\264\265\b\b"
+	.ascii	"3\001C8\343s|\241kxZ\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_failsafeActivate.55.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`z\001-\016"
+	.string	"\366\231\\D"
+	.string	"\221(\035\317Z\252\"\232\317\375\237|K\232\217\365\262\177\204\372\030\366\303\243\341\235t\204ie\215\376\227eTTU\277!!\326\3375F2\377\254\001B5\302\344\336\b\\Ddh06B\310\336D\312\224\002D"
+	.string	"D"
+	.string	"K"
+	.ascii	"\351\247iL\323\232\351|\372\001B6\324\3148pb\027\345Uc]/&\204"
+	.ascii	"\355s\230d\3138K\265\031\013\312\311K\315\356F\365p\322\223\344"
+	.ascii	"\277\345[\227Rzf\013v\327\331\245p\270\365\266\r\330F`g\201Z"
+	.ascii	"r\236\203\366\310Mp%\022\250\300\370A\320\266p"
+	.string	"\022\240\016\325\356~\370._\205|\020\177\3160\312w\177\376\b\376)P\231I\215\240a\312\227\315:\245\262\330\307VWl,\275y\351\355\2455,\235=\r\037/FG\363\364\n5{A\2450}3\267\fT\305t\200\r\224\210S\276\234\252\372\223\033\206\360\024\021\264]\223\017\037\305[\022BDD\340_\352a>\254\004\244=\201\202\306\226\213\353\244%\003Hm\317\201v\307\223\357\234\255\026\227I\356xx>\234\021\t\307\371\304\222\n#\034\311'^\3408\240\330\021\215\242\007\001\2070xD\261$\024\022E\016\226\351\272\322\240\205\313\244'o\364\005H\207J\346\035\315\246\033\rP\323M\217Je\252\251\3020x\f\210\306\"\323t\321a\005\325v\360\025\017T\004  p\002!1\343\003\343\200QeF~\356<[\032q\035\3120<%]@%<\013lQ@\364\004s\023\310dQX\360*\344\234\321\326"
+	.ascii	"\254\303\216\006\306\255\341\354\032\255H\336\226m\002N\016\263"
+	.ascii	"r\320#\007\202\332s<\004\250t\213\326<\001"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.57.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"\"N35P\215\322\001$\241\252\013\201\336E\362(,\002\002\343\320\017\213\322*\237j\266!{\372h\240\005}\003i\177!3c\006\302\305}\bb\232\t\r\330\337[\312\224\002\266T.V\245a\256\312\212\231\005\205\013c\305\206\253b\210\226L\213\025\2121\207K\0263\030\226E\252\333\277U\221\252@G=\376\265\311U\365\225|L\036?\234C\013\330]\004\177\343%\b\237t\350\bM\236;\3645\223\303+\345\242\324\311\223\335qRG\366\337\252\310vZ3\375GM\204\024|\354\202N$\013\002M\031\26676e\203\203\215\267w\026\240\217<>\035#\273]\324\212o\317\315\277\306!\005I\204\013q\236"
+	.string	"\t\273\353\344B\022\267\336\366\200m\002\333\030\001\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.58.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"5\n"
+	.string	"\306SH> M5\035$\004\202#\200B\002\f7\3444\227\313\234\240\210\021n\311$\220\017V\r;\232n\300\200\210\001B\256\0370L@ \006\261\004\n\263?Wd\232\315\376\330\213\233\366\255;J\231R3"
+	.string	"3"
+	.string	"7"
+	.string	"\033\217\307\214K\254G\307-\254G\177v\211\207\246=\312\203\002\324\211\335\305\364\301\277\347\347\377\302!\340\350\363\274\004\354\256\023\0341\270\365\2665l\007\260\177\021\341'\325\201}\307\356\256\265d\377\364\307Lk\2463\323\277\"\022BLR\273\013V)V\025AD\210\330~\332\257p\013\337O\236!\273$\016\037v\303\211\003\033\016\232H\275\252\306\016\242\006\241\\\371\022q\317\212\232z\221\020Q\b\271\273\006\357\261\273"
+	.string	"|\f\317\320\361!<:\201'\017>\372\036\353\361\032I#P\234@\271\262\003\227M\3432\002\027M\266\351:\005\272N\205-\224\fS\3512Z\005\203q\016\030\3202\030L\243U\020`\026\256\303(\030\3366\031\207q\266\215\303\"\341\336\261Z\362\200\t*\220\206\254\232\362$\246\r"
+	.ascii	"2\241=h`<\020\022\002\001q\217\220A\024\330\205T\013\006@p\261"
+	.ascii	"\201XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.59.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\305\007"
+	.string	"\262N56P\213\323\001\200\340\310x\2533\022\017De\037s\003`l\310\236\371"
+	.string	"\324E5\333B\335\037K\036gp\344Y\0242\315p$C^\300\345\033\216%\013D\233\310\235R\266T.\330\305e\262\013\233\033\204\203,\203\315\204\354\322L\313\306\315J\2005\205\31367\232\266M\013\334+\310\300#\354\250\307?\246\262\263k`2$%\222I\344jk\016j"
+	.string	"\241\335%\360/\216\261\340O\\\232\343H\237S]J\216\257\324\211'S\321fh\210\377\256\224\r\213\320\243\236\rzQ#\354S\253 \373\321\257\254\016\020\ni\367\3414\262\241\374\240\260}\313\235\035r0\264\027\215\034D\246\335\235*\361\356\261\363_\361\311\367\361\036%\005\273\353\370} n\275m\001\333\003\266G\001\f"
+	.ascii	"3\001'~\306\232\271\013\266\333\224h\244bW\236\353\271\220\323"
+	.ascii	"\005\353/\343\202K\267h\347\023"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.60.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"%\013"
+	.string	"\266TK?0M\225\016\b_\373\2727\310\370s\307\3468\310\362\247V\027-\333*&M1bf\2209?lg\324\365 \007C\n\373\312PU#a\rU\205\0273(\013\310\221DK\2641\356-eJ\0019"
+	.string	"5"
+	.string	":"
+	.string	"{U\211\007\252\024\273\233\351\204\177\0165?\376O\307\350<\320\341C\302\025r\264>\274\"\236\bJF\026\272\237\236\020<.\363B\300\356:;/\302\035o{\200\355\016\373\005\002\241\214\031\246\315\240A\276\273\002\340"
+	.string	"\202\305)\310\376@\251%\373p\225d?\035\237\206O\353\323\317\200\270FLD\354\216b+\226\025W\027l\037\342\217m\342\237)\242\204\331\326\276A\025\365$(\250^\241F\024\0160p\031\263\215\340\251\355\241AUc\365R\201\272\332\232\177\233\304\264\273\001|\3243,\360+<\232\343\211\276\307\3421v\350\\\001\256L,\027\n'\243Q.Y\347"
+	.string	"F\313\\\262\004\032E\223U6\234l\262\341M\201e\223u\266m\223A\276=\\%\0218\301\n)\007#i[0\371\316z\023\254\345A\265\024\025\252\201T\210\024"
+	.ascii	"3\241\265h`\254\267\272f/\320\346\201\3468\274\021\013\266\233"
+	.ascii	"\225\324\265\022\f\210\373\224\030\244bW\236\353\271\220c\r\266"
+	.ascii	"\274\f!.]\314vh`\n\n"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.61.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`\006\001\335\013"
+	.string	"VVO>\020Q\225\016\304\303\260Rph\020\004\210P\315\375\037\311\315\\t\003\271D \022\220\035f\251\211%\315Z}g,U\022{\303 "
+	.string	"\n\nD5B\371y"
+	.string	"\331\032\t\256-Z#[\312\224\002:"
+	.string	":"
+	.string	"@"
+	.string	"\036l\177b\221\375\342\035j\257\342\250\240\222\261\273Q7\\t\250)\362!\026\311\306e\207\245+\205#A\002\273\373\021\317\013\234\226\t\261\354\256s\3432\334\326m#\260]\300\276\205\3719\2226\004P~\273\032Xux\232f\266\022>\302\303\2260!\2779W\034\036I3\273\313RO\366\341\252\311~\032>\255O\347\323\237PJ-\242\213]\f_\215\365\254\025\001\252\272\340\004\013R\322\260}=\005\n\250\337\340\220zU\2656(|\320\362\263\215\271j\023I\245\002"
+	.string	"\361\315 q\26537\261\t\200\332\335\003~\367\022\230\337\341\226\033t,\277\363\270\005;6\030\243\306T2\232\013\304\301.M\f1\330`\034Mt\200]\235\210\371\200be\200=\0172\237\030\362x>q\322\355\341\252)\201\006o\244\032\324\223/\017[\301W\027\001(\025\222\020)\0211F\371\345\356f\252'\030\027"
+	.ascii	"3\241a)\260\205\267D\320\222\036j\021\210k\204\344V\023\316a"
+	.ascii	"\335\005\333\315J\352Z\t\006\304}J\fR\261[\236\013\272\220\243"
+	.ascii	"aly\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.62.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"E\n"
+	.string	"\026\323F=@\245*\035\240\327\355\212j\376z\367\236\236X\003\350@B\224@\347\235\022{\210\304=\222\264\277\032\266!t\323D\313Hf?\371\315e\030>\201\210K\205\265I\\\234&\327\321\366\336;\2455"
+	.string	"3"
+	.string	"5"
+	.string	")\223\332\356v\323\343\373\346w:\345\347\033\204\245\323J\306'MXq\030\340\302\023U"
+	.string	" K\335uy\021\242\244$\300\354\256%\030b\334\365\266\033l/\330\247\001,\232\306*\364\\\331R\232\326\273\306\032\201\313\200]\325\355\300\312\352\t\210\355\373\257\213\244\223xv\304Dv\227{\265I6\367z\316\237-\340ck\037\263\b\036Q\350\274\353\007\260\031\2146\013\200\2226_4\350%\243\312\3562\370\343a\024\376\307\253+D\362\340\253/\242\274\322y\361rD\025\262\361\022M\362f\217'9\003\326X6\234\f\310\323\311p\272\320\203C\307\303\351\":\031\210N\363\001u\026\004{\022\233O\027\362\274O\307\215&\360\030\323<\201\264@\332\336\204<\3509K\227\226\255\300\234,;\020"
+	.ascii	"2\003\303\341\306X\240j\224\207\001\202i\330\217|\016\017\225"
+	.ascii	"\036[\3432\016G\205\036T\210\227+\200\313\327T\32340\005\005"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.part.0.81.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"u\b"
+	.string	"\362\31787@\217\322\001\230\215\221\336\375^\236\013j\005\217\004"
+	.string	"\241Yd\344\226\361\355Q\277^\237\345f!\206\303\211\216\376]G\303%\262\032 `<|\317\246\230\365 {\313\235R\336h8\233\366u8m\233\037\206\005\256\263\315\006N\363\314\215\367M\r\201;\007\2167?]\347\315\3146|\\EY!\305UR\t\253j\3126\006\306{0\273{\2007Y`\244\3045\241$\377 \314\376.\002\032P\355\356\201\037r\026\204\277q\351\210\020\274\351\322\017a\227\227\216\025\017\225\022|AMY\343\343*\312\216\031\004\220\335\212W\313fH\022\016\373+\221\235e\227\377\260-\262\360\310F9K\265o\235P\264Xvw^\252\306GW\030G\376W\277\230N\244+\346tq\230y\004H\330]\007`\334\362\266\rl\027\3306\t\020"
+	.string	"k\023\030\017\327\270a\030@\036\030\341\212Aa\"\340\214X\3249\235\026\332L\331i"
+	.ascii	"\270\366b\312i9\375\3322\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.88.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`P\032\365o"
+	.string	"\272\256\024'M0\020\352\031\003Oe\0226_.\350\253\271\177*h\344\347\331\3530\225\357\240\233\007\305\345`^\245\3325!\231\026\352\004\355\006\363\306\260\224R\005\005 \020\344b6.?\362\240:,]8\255\351\352W\364\276\350\325\207\305^\271eJ)\005h\002,\002i\002J&ss\3775\rS}\345\016cnS}\375D\204\276r"
+	.ascii	"c\201\"\0200v\205\351\017\320\r\003\251\n\003\240\005r'i%\334"
+	.ascii	"Kx\251\247\002I\3571W\2715\022n\275\252\316\343<\001p\364\301"
+	.ascii	"MU1w\f\215\307\274d\024}e\244\0334\240 \241\257|\245\003Q\n\307"
+	.ascii	"\302mU\301-\327B\272H\303\320w\274\264\253\253;\202\201\322\b"
+	.ascii	"\035\035Ou\017\316\315\002%\221!C\254\224/\217\344\220\264\261"
+	.ascii	"B\004\224\215|AE\317\245\340\016\322.\270=\227\302gK\356\005"
+	.ascii	"\233\240\032\030\200\262\221>m\3236\222m\232\266\221@\330\371"
+	.ascii	"\244\242\343\2548\352|r;\316\312\007K\356\375r\276\311\301)\276"
+	.ascii	"\257\234Q#\371H\331\310e#\373\215\231UD\331e\236\322rjo\023i"
+	.ascii	"\361\024\242\370\276\257R#?\355\233\225k\016b\345\273-\"\304"
+	.ascii	"\223S\223\223iI)\t\351\310\250\210\b\304\220P\020\320\007\017"
+	.ascii	"?>=<;:9\03584qnljhfdb`\230/.\313\026\026e\262E\262\357P.w\013"
+	.ascii	"\030V\213\240\322!\250L\361\247\2560\261vb\223\\_l\355\027%d"
+	.ascii	"\241\030\013\361\272-*\305\233\234\311\021\270\252\223ii0\320"
+	.ascii	"\225\370\002=i\320\211#Ei\2136\361#\274=Ek\033\025\r\022)a}@"
+	.ascii	"\370E\367\226\370\320\265\205\330\230;viI\235\007%\243n\204\331"
+	.ascii	"5\220]\177`\223\230\300\260\266_\364\312\312L\007\347`p\017F"
+	.ascii	"\372\307\b\353\323\026\245s\037\226\034=z\222Q,#]!\334\"\317"
+	.ascii	"\016\220\270\326&\205<\034}\026\265\276\316`\347t\200k\3019\f"
+	.ascii	"v\023\307\255ov\260\271M\r\315[\317\340H\301e\332\2424\326<&"
+	.ascii	"\031\305\303z\004n\361,,G\303\250\2259\323/\252&\365\227\237"
+	.ascii	"\2630\262va\233\270\024\307\332/J\306\2720>i\350\266\350\230"
+	.ascii	"/\331\242\302\030\022\333/\252\203\265\371b\203\366]\377\264"
+	.ascii	"EQ\360\026\037l\026A&3\024\251\326hY\302\320\350\372,J#\251L"
+	.ascii	"F\235\205\211u\322\241`3\272}v9r\t\366\344r\226-\2222\201a\363"
+	.ascii	"d*e\t\306\345\317\004\333b}\336\367\355\273v/0-\367\231\206J"
+	.ascii	"F\275\357\313\235\245\330\f@3\263;\314|\002\363\r\215\354c^\243"
+	.ascii	"Nn\006\273X\3130+b\366\022\275`\207\301S\224\355V\3330\245\332"
+	.ascii	"\033UB\360\276\025\302\271y\224\231\247\354\260\361\300j)\263"
+	.ascii	"\1779\364%jUx\305\334\221\005w\341V\275\005\013\031\"\373\276"
+	.ascii	"\357\253l\221\355\330\314\262\335V\355\314{-\237:\236\327\326"
+	.ascii	";E\353H_\321-D\310\236W\226;E\313\364^\234\214\201\273Z\333G"
+	.ascii	"\343\235V\371}\327,\202s\336;m\362\225\316\225|\24451\237E)#"
+	.ascii	"\362\251\334\216\355\337A\006\261\016\377\004\277\223\370XXd"
+	.ascii	"\237\312\336\256\265m\277\r\347\242l9\343\233g\271V\345\373n"
+	.ascii	"\205`\177\035\313\005R\200\001\006\264\215l_)\212\016\f\353\333"
+	.ascii	"?\225\231\255Z\3447\307\036\347\004\267\234\221w\274\355\004"
+	.ascii	"Zf\005\030\360\206\"\377PN\261p\353\261\270{\247\375g\237\375"
+	.ascii	")\306\275\330\214\rp\347\340\007\"\210\240m\344\177\334\230\024"
+	.ascii	"\251U,\253)h\373\375\331\306'\236\226?r?\341\021\235H\201\362"
+	.ascii	"}\337\020\334\210]\245\002\356\034\027xC/h\033\331\337O\332["
+	.ascii	"\220\301Cj\215\313\362G\177*?\024\224\032c\"?\032\363\223S\223"
+	.ascii	"\223\251_h^j \315JL\347$\2463R\214\363Q"
+	.string	"\214\263\021\214s\021\323\231\210\351\f\202\351<\304t\026r\347 w\006b:\177`:{`:\3770\235}\230\316=\356\314\303t\336a:\353\3108\347\3008w\340\320\224q\306\201q\276Y:\3330\235k\230\3164m\327<\263t\226a:\3070\235ab\234\2311\316/0\316.L\347\345\213s\213\2133\313\322Y\271tN.\235\333&\322\214\\:\263K\347wgoqn\021\214\230\300H\337\367\353\361\312k\206\304\333\321v\335F\272\211t\277\320\r\304p\212\255\232\\/(\335+l3+\221\026\205\"\260U\263\315\254T#\205\036m%-\310V\354+\306\365RP\260U\313\251}A\251\035\201\013T\301\037Di\255\340b\353\334\266\344\214\272\206\206B\002\177\320\224S\013k\221\341\344\211\247\324H\226\013I\276x\325\370\242\350U:|\316\225\025Ot\323\252t\370\336k\243,\276\305\270,\177\024z*'\227"
+	.ascii	"q\370\027\374`\324\315\367B\352\346w\334\334\335\343Y\217\240"
+	.ascii	"\243n>\2077\001\007\224.)\316\367\036\263\003~x\325\b\023\370"
+	.ascii	"\276/\024\273\rnx\365\210\345ji\265\215\364&P\303\233\307\351"
+	.ascii	"=v\271\234\212\233F\350S\334\247\313\302\365r\275\332F\336|/"
+	.ascii	"i\007\022#\200\262* \020\r_`\335\207Gc\032\0260<\257?\016m\346"
+	.ascii	"\363\355y\365i\307vz/\367\363a\343\360\317\303\240 \340\317\215"
+	.ascii	"\264\032\215\202\306\273X\350\023\350V\221\240\300\310S\314\363"
+	.ascii	"k\035\274\030z\360\336\234\257\373\256%X\241\017\313\033\305"
+	.ascii	"x\370\361<\225\233\243\260\2741/\205\274\024v\376\270\257\370"
+	.ascii	"\261C_\026j<\372\330W\360\024%\237\327\274'\254\241P\330\204"
+	.ascii	"\2310\353\216.|\211kUb\363K$v\3258\235 |\205\317\234\264$n5H"
+	.ascii	"o\t\243\016\210.\f\255\303\021\032\020\031\315\304#\353\343\360"
+	.ascii	"T\031\334i\020\336\013\022!M\277~\3018\342\210p\345\333\356\213"
+	.ascii	"\030\356\f+}[rl\2017\037\344\221\351mr\265\231Q\003J\315S\331"
+	.ascii	"\256\356\0067D\026'B\254\320\340\270\321\271S\244\"\207\211n"
+	.ascii	"C\334*\222\220\227\027U\024y\256y\200W\314f\236\3125O\343\304"
+	.ascii	"\005w\252\fR\363!\242\320<\317\265\312|\301\205\03223\377\213"
+	.ascii	"\211O\016\377l\366\f[\304$\003\333\235\266\314.\r\267\272S8&"
+	.ascii	"\037R\024\275\254[p\253\325\245\fR\334\020\235dn\2317\224u\256"
+	.ascii	"e\356\206\204\020\246e\336\177\250 \363\004D\211sY\361\007\307"
+	.ascii	"D>\224\224\205\227\230gvmx\233;\035R\353\221\264\203\032\302"
+	.ascii	"\374\362c\276\t\330%e>\f\r\315y\355\3133\237\007\260\253\315"
+	.ascii	"\345_\276\237\216Y\376Hu67M\207\313w\2225#\034\256\016o\350\362"
+	.ascii	"\007\270\306\260am\211K\267\273\243m\371\366\033rf\327\207\373"
+	.ascii	"\303\033\332\362H_/\372\264\036\213\277\233`C\026\227\317f\377"
+	.ascii	"\210\3541\254o\350S,\304\242\013C+\322\362T\356\366F\376\346"
+	.ascii	"#7\220\264\300\342\324\364\314&\231\336\371^i\354j\310\0333L"
+	.ascii	"\331\321\3303%e\354f/\335+\202B\334\201\211&q\202\304\001%H\300"
+	.ascii	"\001\b&F0!UB\212\nF\003\251\017\250H Ax\240J\201\016J\2340A\302"
+	.ascii	"\210\031)\r\246\032\240\222\nAJ*\203\026\251\023$N\214\250\252"
+	.ascii	"\222*1E\025\202\024\025\223K$Im@\242\312\003\023$6P:\321\001"
+	.ascii	"\007&<\330@\t\004\023$>P*AU\245\224\264\303S!HQ)\235\230\232"
+	.ascii	"\242RZ"
+	.ascii	"vT\326k\211\220\300\227\232\\\361yC\273E\222\037}[3F\030\341"
+	.ascii	"B\260MM\277\364^\276\242\227\276]H\264\001\245\306H\345\351\251"
+	.ascii	"D\222p\271pz4\236\361\242{^\235L\355\3308^k\317\353\222C\333"
+	.ascii	"\225\332\021\251\035G\260`\362\274\0269\264\231%rz\337qh\317"
+	.ascii	"\260\260>\2579\315v\354\233\247\342\363Z\343P\007X\274\330\351"
+	.ascii	"|fr>/9\237\225\234\317H\316\347\242\247g\242\247\347\035\347"
+	.ascii	"s\216\363\271\351|\256q>\263,\316oR\2221<|r\370\367\203\231U"
+	.ascii	"\374\343\343\243\225\246\246V\337E\307'\337f\325\003\220O\021"
+	.ascii	"\361\305\0166>7\304\244\317\201\303\016j\210\364D\237\364I\300"
+	.ascii	".\351\321#\371\2166\372\243\337\001\354j+z#\352\257\271i\257"
+	.ascii	"V\364}]#\372'=+}Z7\232\251w\330\347\004\361Tw\032\364hC/\364"
+	.ascii	" \276\txfc\350;O\350\237\360\307\221\305B\2464\251[E\"{\211\201"
+	.ascii	"\304m\001\377\025\315|\365weC\\_\316\217)\340R\320w\"\007}/\232"
+	.ascii	"m\305\374`k\242\004\364\r\b\364@2\254\202M\252IO\345\017\357"
+	.ascii	"\301\311\fw\252\224\361\341\235<\274\216^\025)\007\225\263F\341"
+	.ascii	"\343h\372\302\255\366\250}X\336\020E\304\237g\276\202\362Qw\332"
+	.ascii	"\243\366\325\022B\r}\276\347\177\276)\304\205;U\266\360\371\276"
+	.ascii	"\366\274\b=\032"
+	.string	"\316(n\331\215\214\276\005\334\373\212\260e\276\242reC\215^\214\276-i\243\350\021],\304\362F\243\262\357z.BEDA\036\237\345N\037\013\006\221\220\347\\\030\n\026=\225_j \342\3717\234\023D\300\231\257\252\\\335\340\r\345y\002d\360\001\342\251\334w\335b\203\206\243\320w\212\226Y\017\316\177\332y\235\031\277\025l\034\3769i<\276Z\364Fw\252\274\262\363BQ\032O\347\033\257\225\2101\310-\026j=\326PN\202!\250\362 !\222\302\212!D2\"2\222$\351\262\n\020\210da\236\306\330\003\022`$5\213\204\214)\251\231\024\224\2242\354w2;\255He\247q\007\331@A\367\30757\301dCAm\342\\\370=\243\314j\211\260\337\212\244@\177\365\337\350\311A\267M=\304\264\274b\202\177\325S)\235\207\034\240\003\245a\304\021V\302I\n\356\310\266@\240\037\332\002_\377\343\342\315"
+	.ascii	"\036\247}O\215\357T\341NA\3024L\244Sa\332\203\356\356i2\035\364"
+	.ascii	"h\215\200Xf4K\\d\273I\313\243\274!%S\202\372\242Gf\360\224\020"
+	.ascii	"F\342\271\036$:\320\bn\b\222\232&!\004\327\213\222\206\330SS"
+	.ascii	"\321\335U%o\370\226\355\t\236\360\364\344G\022>\266\351\223\363"
+	.ascii	"\017\007\326\346piO\244\024\344\253\276\221w\t\320\370\376\310"
+	.ascii	"2\310~\371\001\300\217\332=\317\242&G(\016\361\027\371\036^\f"
+	.ascii	"\"s\333"
+	.string	".\"~\013N\266]\307\226\321\355\340\013\313a\321\020'6~\346\242')\223\206\t\213@\204\211\315\207`\032\354\f\317rx\306~\357\020\347\300%\016\"\"\264\37506_\376\207g\263uq[8\332f\352K1\\v\270!L\377\r\207\035\206}?\240[\273\300\013\272\323\316\214\336{0\266I\265\350X}V<&\226` q$v\237\027\036T\222\3770\032\033!\364]\005C-4\3104\373T\346\241\303u\341\261X\363z\002\323Gn\257\325\037\214\013\002{\250\216\343\270\256\303S\360mKn\276\203\003\311\034\007<\227x\376\346\307\005\320g\022[\244\207\235\304\246\334\311\247\004U-s\356f\371\214@a\bl$8\305' \305\207\357\231\200\213)\243\020$6\330U\361\b\0330O\224\341\3108Nu\346\337\315\3417=\r\001(\330\226\302\246\304\236\327\ba\222\344u\304\367i\311\372B\214\205\330AJ"
+	.string	"\332\355/\317\267&\""
+	.string	"\tj\3306\033\362\241C\013%\357\277;h\215f?\202\201\233z|P\314?$l\352v\301\007I]-\353\221ye\203B`L\317\254\335`;\253=1+\263\3048#Z\273\242\362\374"
+	.ascii	"\361\376K\374b\003%\363\364\375\356\305$\344\260\333\323\276"
+	.ascii	"\262\347\027,\004V{\203\347\316\364b\326\025\365\317\272\253"
+	.ascii	"\212Fh/c\354\374\207\204$+\205y,\345\273\204\0336\354\034\226"
+	.ascii	"\3565\370\005:\2552{W\352\235-\273\236\346d/P\242\r\355\037T"
+	.ascii	"\265H!5ibH\363\313Pl\005\246\254\216\310G\217\261`\372qg\261"
+	.ascii	"\024\343\205\f\334\277\005;\326^lK\tY\213d\2302\354'\274\016"
+	.ascii	"%R-\312t<\324J]\220\354\001\324\365\311\223\2619\017V\026\353"
+	.ascii	"\005\337\216+\265b\030\335\016\325}\020Ym=\343\307Qi\201\275"
+	.ascii	"\252\260\024cB\024c3\r\223\370\201\003\345\341}*\030\006f]\371"
+	.ascii	"9h\261\017dZ\217\210q\202\002\210\246\265\003e\262\377 \217\325"
+	.ascii	"\024v9\325\020\333Y\351\341\206\201 2t\304\214\021\360%bK<\016"
+	.ascii	"q\376\251\344\355\rd\326\251\200\276H\202 \250\272b\222\347J"
+	.ascii	"\004\"\030?\246Q\210\263?\262\261S\004\347\024\217\257\243C8"
+	.ascii	"\205b\\\334W\244\242\227R\324\302\360\341\325\364\277n\031E\035"
+	.ascii	"&\351d&u7h\020\370\006\b\350\247\371\305\244\270\n\020\361-J"
+	.ascii	"5\375\236\"\253\206\313U\262\031\263Y\223\202\233\307\026O\304"
+	.ascii	"\377\357q\024\356}\364\335\205\206e\256$c>\207#\261\372T\266"
+	.ascii	"b\217I~\266\3569\2008\213\006\036\034\245\227k\036\006F\030\253"
+	.ascii	"k\240\b\0211\364\323\027\343\320J\nC?q#\024\354\314\257\364B"
+	.ascii	"p\013\376\241\332\254\002\326\003N\317\332\275\257\373\255\037"
+	.ascii	"\325\351\200q`\037\237\345\020\372)\244\325\"\232\276\3161\220"
+	.ascii	"\035T\367\316\356E\214\272r+\240W\237\336q\230\216w\240\276i"
+	.ascii	"\035#\303\224\370\372\230\304C\2500Ri\305kt\003\022\211qh\004"
+	.ascii	"\247\373\330\330\334ey\020\027{;\277\331\345\022\016"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`V\003M\020"
+	.string	"f\332dH\340\322&\035\020\177\254,\001\256\264__\307UUx:z\303[\rD\\~\301${\306n\030C2a\253\322\213m\360P\352y\020`(\202\f\255\377\337\235\031\325\330\302\265\224`\264\325\016\265\336g\034\246\304\210-%\221)O"
+	.string	"T"
+	.string	"Q"
+	.string	"\006\272A\201f\200\322\013\b\264\314I\307\2304\214\252_R\315\332\272\251\002\325.\333\3510J\036#r\377\211-Y\255\310\324\277\241\232]\347\225\3725\266{\220*q\177\365&)%\376\0070\273n\366\374\375\313"
+	.string	"\241<\347\234$=\263\375\347\t\001\333\352\017\315\364\205\024\364\203d\372,b\372/`\372@/}\220\325o\341\322\367i\351\273\3209\347\237\n\262\352\b\232`%\376\033^1\330\005\027\013K\374ib451\033\230\315\213\202+\303\352\352}@\260\212+-\361>H|9*\r!\245\037\034h\007\001\026@\027\212\027C\230\342\275\361T\2747\037\216\247\2549\233!yqBU\351\230\365\230\360\276>\025\341\331\231q\274\257P9\036\023D&^\330\2472\007\350\207\344\325"
+	.string	"J^\016\241^(\304\027t\342\355"
+	.string	"\352h\250\266\342\204W\202iW=\371\255)=\257\240-Y\255\210G\344(5Z\245\251\312j<h\354\200E\021Y\3758\336\220\022\336\220P\271\307\t\034\222w\244\243[\n\033;\316;\362\251"
+	.string	"\360g\204\344%\351\224\211\200\2248/\351+\361\222@\225>;9N\274\034\r\245\243\001D\240\240\23576 "
+	.string	"\003\251\032c\003\"\"\030CRk\017\202\235\204x\032)\nK\264Z\177\324\255\205\2413\264\325\241\tP`\030\303\036\257~dI\207\241&A\022$A\022$A\022$A2\220<\203\036\223\245\226[02\277\3731K\3358\357\340\352\242\317\375\334\317\375\334\317\375\334\317\375\334\317\345\335\316\312\317#\21618Rn\251\225"
+	.ascii	"\205\305}\002\r!\205da\031"
+	.text
+	.section	.gnu.lto_.refs.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"\005\007"
+	.string	"\002\017'*pM2\034\037\034\013\251p\257B\247\252\252\252\252\252XUU}\026\347\220\260Kt\305\211\2615\332o\244\265\326\b\331{\313\224\002\016\254`\033AR\312\252\336(\327\232V\223LGS\235\231c\240\213\226+S\340\rx7\257\346\215\006x1/\364\316\373\244@zbRB2uD$\004\344\303\243c\225c\343Uc5\003c\352\305\263Z8J\361N\274\022\323\210\027\342}x\035\336\206\227aUx\023^\204\351\301k0\215\226>\323\264\364U\013i3\357e\265\274k\272\367\327\321+\002\034"
+	.string	"f\b\236ZA\300\371\026\323Q5\275#\003\340"
+	.ascii	" \020\034K\2658\330\235\276-8\266\305\236\206~e:Q\366\214Z\006"
+	.ascii	"\026\202\225\226=\260L\346\n\312\336\226-(\353G\313\036C-@\257"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_.decls.3cc2bf4c4f669952,"e",@progbits
+	.string	"(\265/\375`^.\345\306"
+	.string	"\2323\345CY JY:\215\001Zk\005\323\370\362S\337>\274\r\\m\004eF=[\270\223\3521.\254\016\005:\267\373\344\207\214T\356\370+\353w\327\033\002Q\030\315\352\022\311\013"
+	.ascii	"(@/9\f\027 \317YT\f\327qA\222\316\026\007\221\276\357\374U(\274"
+	.ascii	"\212\231Ve;J)e\n\234\003-\004`\004\310\233\302\306\341h@\230"
+	.ascii	"\224\347Uq_\\\025\356\366 J\216\r)\273\t\004\031'\007\321\317"
+	.ascii	"Z\372Y\005}|\247\217\257"
+	.string	"\350 &:\004.\242;\260?\350M^%\353\374p\225w\207\031'\031\020}\373\001\305yy\366\003zl\245\255\031{\306:;\330<\214\034\333a9g\210\234)s\363\361\224\276\355\200\332<\333\001\375-\243\317\304\376\240\035v\2320\232h\214Q\243!\223\362\225\274\263\323XjL\26107\036\314(=\236H\354\0225\271\"Co\266M\t\331\326s\n\234\025\303Mf/\211\326\216\347\336M06\006\233\305\326\331\247\355b\303\330-V\214\375b\275X-\226\213uZ;;wKgaxn\356\255\204\342\025\346\002\021kg\255X,:\311\346\206\352i\345\330\267ei\226\t>\002\245\321\264\302\236CRx\266R\213\213\331\344\267N\236\3306\035esG\365\310\276,\225\177\350\307`\003kg\343\254\230\016\262\271\237P-\0350\310<\203\337\216\335\332Y6\333\206\217@m\245V\025\020W\340\236\264\335\355\335\254"
+	.ascii	"\250\002\232\032wk88\344{\200#\332\312\331\027\254s\203\275r"
+	.ascii	"[\305R9M\262\271\233{\357\035k\207C)\352\346_\"\332\003{\333"
+	.ascii	"\r\250\315\313\263\033\320_\037\372\336\033\232g\251\201\354"
+	.ascii	"\017\372\313\244o\305\350\333*\3726M\337\202\351[,}\333B\363"
+	.ascii	"\304\331\0374\310\266P"
+	.string	"\243l\356\324`\3612\303\354\346\333\244>\221\232]3\301\207\220}\363)\240v\202E\313yr[\022s\363=\3206\211Ub\235\366\354\267d\266\354yl\271\313\366n\346\340$\214)k7\273\004Y{\203g\320\267A\350\216\rB\257\265\007\373\203f\353\203z\260G~\013f\303\254\030^bZn\263\275\233==\260'Zf7[\261k\215\330\346\255\230-r\f68\216r\207\355\335\264by\357\244\265\024\350XK\001\215\023\036I24\377\3527\355\017\252\255\317\005$n\001\354\016\t\\\340\267W\367\004\247\t\376\313\301\204\bJ\370\237\207\005\350\246\375\347p\205.\t\377\205\300\177G\374\327\002\031%~\274\201\017\214\233\037_ \303\310m~\234\201\027\bD\034\202\037#\375\266\351\202\360\235\037[Pw\234\037g\340\303{?>\2723\2756\037\374W\247\001v\227\001\377\201\336\341\307\035\230\277\377v\\\026\330\252"
+	.string	"\372\343\022\377\263\304p\375c\022\376\177\331\002\303\177-\377\271\374\177\376\007\363\277\356\177\230\253\200\377^n\002\256\0077\300\377\017\377Q8\207\037\217\370m\222\377\"\340\277\035\374W\203\377f\360\237\346\307O\277\365\371m\317oy~\013\301o5\3746\202\337\376\374\026\350\267.\374\257\371q\327o\315\374\327\376\367\277=\363[2\277\305\373m\336\177q\210\337\316\375v\314o\357\256\320\177\236?\327\374\027\304\177?\374\267"
+	.string	"\377\035\300\177)\370o"
+	.string	"\376\333\341\277\032\376\353\363\337\235\377\336\374\027\375o\376-\224\337*\371m\325o\277~\373\342\267^\277\025\362[\037\277e\376\226\353\267[\277\315\361[\033\277\245\361\333\254\337.\177k\365[\031\277\205\361[\251\337B\375\326\351\267\034\370\217\366\177\355\277\221\377W~\273\342\267*\3746\305o\223\277\375\300\377\026~\333\201\337\236\370m\207\337r\370\355\004\277\225\340\267\033\376\217\371\177\367_\314\377\346\177\004\374w\373\357\223\227\227\227\367\323\324\3756\034\376"
+	.ascii	"\210\020,\340e\320rK\035\240\253\n\225\0054<\300<!o\306W\275"
+	.ascii	"%\226+t[\364q\246X9\261\325\335vl?\331\254@\312A\261`'\214\220"
+	.ascii	"\031;\272\250\260\f\252\252\2529&&\376\261d\021\346\346\343\314"
+	.ascii	"\320\307INa\030S\330\t\335\3336\227OP/^`'\215\004\232\202EE\025"
+	.ascii	"\204\006\221\n\003\003\213\376\r\231\324\255\023K\341%\023[g"
+	.ascii	"QZzn(*\013j\260\250\314\244\270\3717<\240n\235\030\n\263\030"
+	.ascii	"\241\271\221:OU\276\244\3566\324\266\3407W\372\270\005f:n\272"
+	.ascii	"\0237a'\275\367\226@\227/)\257M\005\025\204\235\036\003\316\346"
+	.ascii	"@c\005\b\327\331S\377\277Ew\022j\357-E\323\334PJ8\2674\326\006"
+	.ascii	"\3759\026[\001\374\317\033\377\277\240\250\271\223[\360\276\350"
+	.ascii	"\037k\311\025<\354?noe\026\262\001YQ\312\254\030KeY\033\251\344"
+	.ascii	"B\366@\355,\344R\331\336=[\251D\206\260\334=Ke;j\247\260\022"
+	.ascii	"ew3\013\271\225\313\335\263\225;\351aI\231\025\265T\226\214\352"
+	.ascii	"Y*\313\212\332eY\233"
+	.string	"g+\223P+\224\033\252g\227eu\331e\313(\236\245\262e\324RY\026\017{\265B\310S\252\016\257F\024\333\265\244\334NMVI(\236\270\245\346r\323\355m\315Tl(\001\354m\265\204\242K\306\260L\224\342\234\224\226$\227vC\223\222\326r+\343\226\200,\367\006\242d\264\2334@6\343v\016\033\207\244a\265\231T\354-A\323\336H\273\343\366\336\310\275w\017\312\252\271\267\f\236%fS\323\336T@M\333\n\311\246b\357k\226\205I\324R\231\326r\210-I\031s\253\320DZ\346\246\313\202\322e\310#\233i\357m\275hf\224\013\273\233\361\n\033\037>\224U\3004V\001\350&\213\0300[\207V\342\0245K\031d\311,%Nj\27115\334n\276M\023F\336<\234\246(J\256\334\374\2322\367\214\031<\333\\\0221s\363/\336\177\311\3342\026\213]\356\255\264)bh\"s\363]\332\037\224"
+	.ascii	"\326\007\275wC\277ct\242\210 9\273\271\307\372\210\251\331\222"
+	.ascii	"\362\024\203J\220-^00\235|Qa\301u\307\034\323\201\307\034\343"
+	.ascii	"1\346j\214\306\335J\264V\364\270?\274\270<\303\302\2460\267\356"
+	.ascii	"&\3634\342\366\304a\306\t\021:[\306y\367\031\263\355B\271\\\256"
+	.ascii	"\224{\345f\271v\267\311\255\273]\256\227\033\303u\341\206\271"
+	.ascii	"Nn\224\013\346\302p\277\\\267\273\345\276]-\227\312\305r\345"
+	.ascii	"\356\363\306]\270;\345\276p\351n\225\373\344Z\261\316;w\231\374"
+	.ascii	"\262\335\0266hF\271q\367\231k\343\0372\273J\320\216@a\316\335"
+	.ascii	"%w\215\206\030\363\3468s2\311\304\264\376\241\2624&\222\253d"
+	.ascii	"\311R\221\267\034`pc5\362\206h\271XYw\353 y\266\222\034\013\346"
+	.ascii	"\024 10\207\320\314\236sWH\335\2162\314{5w\227\033\331E\203\256"
+	.ascii	"\256\036,T\200\253rD\301\215\220\361\266?h\2107\375\273\2661"
+	.ascii	"\2605\364~\3449\331\335|\323\206~\325|P(\252\3466\003@\232\023"
+	.ascii	"\266\233{5O\364k\312\364k|\350\327\334\320\257Qq\223d\030Sjp"
+	.ascii	"\335|}F__\321\327m\372z\210\276\326\241\257\257\364\265\013}"
+	.ascii	"\335\244\257\225\372\2752\372=-\372\2756\375\036\230~\017\207"
+	.ascii	"~\357I\277\247\244\217\212\321G\347\364Q6}\231\267\313:\201\256"
+	.ascii	"\017+JNV7\037=\323\037\330y\026\b=jD\037\335\322G\245\364i\274"
+	.ascii	"\350\323\270\351\323\220\351\233\321\330\320\247i\322\207\342"
+	.ascii	"E?_\321\247"
+	.ascii	"s\242\377\314I\364\357.\013\037\264\262\r-\354\3168\263\332\320"
+	.ascii	"\033\302vec\205\240\2341X\224\274\256\214\373\002mc\241\242\356"
+	.ascii	"\346g\340\264\204\305m\261\306dR\243\322\224\366\334\373N]\251"
+	.ascii	"\033u]\\\252\033\343\302\270U\326y_\334\247_(\333\344\267\214"
+	.ascii	"\305\273[\007\357\315\202\033si\305\3356\216J\001_P\356\213\033"
+	.ascii	"Po\231\310\237\275l\0314\257\307\027\246\233m\254\017\232\205"
+	.ascii	"\f=\017QN\235q\335\\\223\203d sI\336\2347?\003\371\363\217\313"
+	.ascii	"\002Gm\n\022\0337\323X\037\324\222\r=\373\3104\302<\371\350Z"
+	.ascii	":\302\344\214\214\t\345F\315\353\031\346\346\03492\027\221$\030"
+	.ascii	"\334\225\341\005N\007\217g.\2333*\272\240\345\255\020Yvp\335"
+	.ascii	"\234w\334\030-|H\351\320\341\243u\343\206\233T\0172w\366\b\016"
+	.ascii	".j7\337\207\251F\r\354\004\264\304\\\254\fy\363\332{\n\033\030"
+	.ascii	"\027--,924B\244\330\220L\301\302\302[c\306\204P\345*b\306\252"
+	.ascii	"\266\256\256\362\023\320\022\331%\210\r)G\246\2676\003\002\031"
+	.ascii	"UUy\006\320\022i\027\024\305J\01725O\340\230r\314\260\262Y\201"
+	.ascii	"\271\004\354\346\274B\336\234\234X]\226\321\344\305\213\034#"
+	.ascii	"\203\330\330\216/:r6X\264\3100\236c\354(\005\331JS\221\343\265"
+	.ascii	"\345J\025\216\250\250\354\002\350G\327\233\032\235\324\263\013"
+	.ascii	"\233W\005\311\233\322\217\254\024^\246\232\232\362\023\003\272"
+	.ascii	"\310\221\361\022\363D\307\213\354\364\374tS\\\035N\326\342\360"
+	.ascii	"\306\321\222\325\302\312\315\357Q\322_\312K\271\005\352L\336"
+	.ascii	"`\006\345\033d\212d\311-2\2131UK37\347\025\301\032J\232P\321"
+	.ascii	"\347\201\242\377\254\"\253\300K@<{k\3351\321wkcTeR\216\345\254"
+	.ascii	"\023K\311\312!\245\235\374:@\027\3222\227\344\2709+\365\222s"
+	.ascii	"X\242\f\321\267aX0]\335\023\006-\317-\230\213\020*\317,x.,\013"
+	.ascii	"\036\356\202\307\3308*\236\255T\273\303x\270\356\356/\27239\231"
+	.ascii	"\2218\017\227\301f\362\266N\214\207\237\307/\340+\007\032\302"
+	.ascii	"xX\013\f\317\nv\276\200)\211\301\223\261|\013\007\245\245\021"
+	.ascii	"\214\304p\207\311X'\036s\240\346\306c\260\035\026c\343\250\232"
+	.ascii	"[\352&\315N\013\306\206\nr\354^\240[\001\025\023FgI\363\206\227"
+	.ascii	"\2331\230\036U\f\267\0241\274X'\376\002\306\213\255\314\315\007"
+	.ascii	"\363-7.\350\320\342\231\322\347q\322\347Aj\034\203\276\362\234"
+	.ascii	"\001WF\177G\214\376\316S\177G\213\376\216\234\376\016\034\035"
+	.ascii	"\236+\223\362\005n\356\312MaR\222\242oP\034\266\262\363\305\304"
+	.ascii	"\006Z\225\022tPA\2739S\271n=\230Mp:t\\\316#Sh\320\362\276T\335"
+	.ascii	"\214\337\264\212\235%\037lf\250]\255p\363\361\333\217\317\256"
+	.ascii	"\326\006\362\314\210\271\371B\r\035\273\335\300=y\212\001q\036"
+	.ascii	"\273\340\304P\202\250\266\013\017]XrKR\250nn\352\036]\234\250"
+	.ascii	"n\306m\330\t~\362\327\324\2641\311Ym\351\343&68\254\360\br\363"
+	.ascii	"\265w\202b\266\343\026\376\232^\030\224\322yC\037\257a&\177\r"
+	.ascii	"6\363\326\266\342\346\357\250}@\013\026\221\233q\232V"
+	.string	"\261\003\365\241&\313\330\226\0357\037\247\375x\311\305\302c\030\330[y\231V\240\342r\263\216\365A\361\331\3201\332\355a\346\346vs\216N\027}K\304\3420\353\304aX\t\315\322N\372\b\361\203\315\312\202\254\374\201\366%\tzf\246B\222\346\r\325R\232\221\233\217\221\374\326\t.\202\313p\226{/\331{k\310K\347\224\031\\\206\311\300\246ll5\303j\330\312\004yq3n\342#\307cX\f\217i\260\334;\211\307v\360\366N\356XK\201\265\024\344/\255\036gh\276N\235\306`\350\330\b\352\325\004k\314\315v\3538\371\372*\303\224\322\003\013\230\227\327\2257f\017\314\n\230\216\233\257\203\003\b\020,\004\311\332\223*\307\225\027\034\344XH\226\023\303Bw\363\301\3306\024\356\t\217\314\315\327\231\322>|\340\255\0212D\261A\223b\302@\206\311\304Nv\001df\236(\363\311\026\245\025..\2745\302f"
+	.string	"\362K\312\253\307\266\244\016\217M\357\330\201\267F\310P\244\013mr\367%oK\254\246\353\207\026S\030\216\343\3009j\2506\322\216"
+	.string	"`4X3\226=n\316a\231\3507\27078.\0336\324\2307UV\214D\301\242A\003h\b\362K\352\216\307\024\213\264\233\237\343\"\313\211\263.\236\207 ]\346\316\344\bi\241*\353\216\205['\016+\222\2218B\004\212\241\321\370\201\006\212%\240"
+	.ascii	"!\002?\021\351\211\337\b\004\320\271\021\b\241\242PC\352\303"
+	.ascii	"QSc\232\232@\325\242\b\307\343\004\216\302\b\324\"P\b\370s\244"
+	.ascii	"\242A\241Q\b(5:\376T\240\206`\317\260\250\256\304\"\320\307s"
+	.ascii	"DB\001\t8\374\0015\334\b\304\021\270\301\001\024\030\201\202"
+	.ascii	"\210\017|\016\b\301\004\022|\"H\370J\214\350\t~\260\246G\"\222"
+	.ascii	"\0171\345\271\021\b\241\243\232\236\020\252A\tV\337\221\004}"
+	.ascii	"\024\016\207\302#\024\205\261(b5\n\025\031\201D$\021\326\364"
+	.ascii	"xC$\2724G\037\316\352#\026\031i\210EFl\264\026\021\323!\232n"
+	.ascii	"@x\314\307c\252\006\203\277\036\nc\021\230\325\325\210\237\203"
+	.ascii	"B]\217\302\242\224\204/\230\022\213\204\303_/\230\036\22120="
+	.ascii	"\366\376[\177A_\221\021\204\316\320x\224\242Pd\004"
+	.string	"\200\3723\002\346cz\364+\341\204\b\322#\244cJ\"HL\215G\244\022I$\210&\220\330\260\252\277\265Dz\034A\302q\304*$\216\300!\221\244\002Ut\335\271\021\b\240/=\022\256D$U\b\030\200\033\237\365\0274N@\202\020 V\365g\004A\001\242\t\0028J\327#\212\0229\007\036(TSbZ\244\257\001\007\027p\320AR\357\035x\020\302\203\020\350;\360`h\310\003\016\206\3649\030\302\253/8\"\251h\24274\361;\nC(\"\n\217\324_\206\324w,\372\rE\350\271\021\210$U\250\310\350\223\244\332\030\177G@\225FM\203\302\023E\325\030L\223\324\341O\250\246\307\236\244thD\n\201h\3703\262I\203B\325G\024zX}\275\242\037\nE\241\257\bih\004\352\t\022\205&|\353\357\350;BR\327\024R\343q\002\234t\370\003\332\254jz\202(\004\252A\341\021\rQx\244S"
+	.string	"\246F\300\244\337\221\3369\212\030\376N\020\213\302\3657,\032\325t%\216"
+	.string	"\252\032\216i\252\026\245!\244\303\"\342\007G?\021'\214D\020\240\220\256\277\017\322`\221\004U\370\003\"\n\201\351\021\311\227\022\211?#\240/\t\351\347K\372\035\355\034\325\242\252\246?\350\232\036\211\210\2127=\033\210\210\212+\022\020"
+	.ascii	"Ga\322\317W\204d\"\r\256HF\242PCjD\261\372~'\204j\032\344\240"
+	.ascii	"\026W\340\217\310W\\\221~\276\"\242\320h-\026\217\216>\240\n"
+	.ascii	"d\364\021\031\207\276\364\350\247\022\371\200\352\321'<\036\325"
+	.ascii	"\rA\241o\025\022\221r0\030&\251\307\235\365\370#\362\005\221"
+	.ascii	"~&|G$\023G\235\243\257HHD,\212\340\351\321@q\350\233@\207\210"
+	.ascii	"\250\230\006\213G>#\340*\324\3001C\252\"\005S`Q5\372 \320(~\303"
+	.ascii	"4\350S5\254\276\016z\301a\321\350\230\252F\253/\005\240p=\372"
+	.ascii	"\200n\324\341Ec\252\n\255\305\242*ts\364\255>\016\206V\242\260"
+	.ascii	"w\\"
+	.ascii	"\211\351\211\024-\"\n\325\342*$\026\217l\322\023\302\025\370"
+	.ascii	"CS\025IE\241\246'\212\300\224\204\232\201\304\317P\370\023!("
+	.ascii	"\034\376N\370h\240\030\201t\270\256E\325h\355Y?\b\246FG!Q(B\n"
+	.ascii	"Bp\210T4*QD\024\006\211\277\341\206\237\325\207A\006+Q\210\244"
+	.ascii	"\327\364\230\252'\004\213B5=\341\267\376BH\"QD\024\236\020\246"
+	.ascii	"\300T\235 \365\235\260\223\036\177FF\232\324G\342\347CC\"<L\240"
+	.ascii	"\204\007h \210\224\350w\034\n\177DB\253Q\221pH$D\024\376\216"
+	.ascii	"\204\200\352Q\b\004\207t\375\255%R \n#\220\244\336\f\213E\020"
+	.ascii	"|4m\\6I\206h1k\001o\201`\307T\203m\331\263B\313J\302d\006"
+	.string	"\316\346bDj-F\227\2570[7\247\245a'\r\234tePBC\303[vC\355\035\202\r\353K\352\316\007.#\311H\262\263\006i\003\003\216j*\310\231\315\272\\M\2011S\222\302\305\334\016\254B\223\306\305\021\254,7'\271O;Wc\352\300\326\312\262\013\0354\025g_\310\260SvV\341\320\032k\201\335\326\202\f9\222\237`\314\210{qs6\222\305\236\233\317\315\233\2338/\017-\362\202\02247\2337LXpN\205a\026y--\211\331\3158OO;\226_DR\004\203\355\250\262\0319\311a\205\314\314\210\210H\222$i\fb\n\020\204\303i\226\346\032\037\022 \024=\224J\247F\204D\244\240 )H\215a\317\005\221,\273\214\025\342\234T\f\n\302\244\217\343\270\333\334\211\b\177\235\241G\022o\200.\001?\356\360\312\320\333+3\266A\312\003\225\261\035[F!\202j\223q\003\2226\035+"
+	.string	"\231\311\256q=\330!\032q\376[(AeJPc0bw\333\001\341\345U\217\327\307\"\221/D.\223\375\002G~\020\005\371\344\232\031\317\345\277\272e\262\247?&-{\346\026\307dR\t0\335\327\334\306"
+	.string	"U\324\376\256\204\322\257\026\360\037\252\032\363\210-[\315\256\335F\362\2040\026\342\023\300\316\351\033\005\007\375N\370\264\347\0346vR\254\315F \013\211h\"\277\343|\313MwB\205ADp\3357r\270\311\373\2523\224\243ZD \334\247\031\214\355\207t\r\334I\301\234iQK\305\346\3608\324@\276\3707\355t<f\353@\367zZ\264\356\264k2\214\337\276\375\004\243\313m|'\007\245\377$\025>`\034\f\222\263\356o\0224\326\330'\005\366\025f0\211\305\326\231\207\033\244g8\2026\371\213\350y3\352V\023\331\320atb\261\213\356\013\266p6\345b\353m;[\256\2473\230\204\013\212\225\007SA\275|3\266r\r)\3145\3345\316\265\257\357\"\332\307Zr\021\322\300r\004[!"
+	.string	"\365kB\323O\256vPh\20234(F\b\231\377\373b\355_\034,g\233C\207!Zk\375\325e\376s\034}V\325'F\274\"\377{\020w\246\006\237\324b\3342q\230wt\nw_\020e\320\204R\237\355\344r\263\367gJ\2110\220E`b\277\250\367\357\363\320Z\316\274\233\251a \213\023\304Gv\224\343\223\20568\022\\\322\250\364R\211e\2673\025\217p'w\033\273\261A\2461\234\252\363\375.I\372<\037'\230?\346\360n{\200]\336\364\037\3740\002\272\017$\250&$\024\230\035Q\035\276\353\312*\002\024\250\036=z\260\214%\034C\367\371\t\275\266\307\367\276p\022\350\325\273\216\347\300\305\333\017\021"
+	.ascii	"\356\331$\235^\337\342D\275I\370\275K\223k\203\2130\231\340\227"
+	.ascii	"\216\352\342\273\374\275\272\360+\030\001o\027my\026\224D3\302"
+	.ascii	"\356\246\225n=\024H1\237\033\367\314o\021\266\272\253#\342'\242"
+	.ascii	"\206|(\220\267\362,\3311\340)\255\001Z6\013n\243n\0135+7\005"
+	.ascii	"54v\355L\276s.\317\217\253\f\003\235K\347}[!\200e\025m\311y4"
+	.ascii	"7\262\027![\t~\360\331\201\004@\225;\306v\251\373n\216,V\002"
+	.ascii	"1\3558\334I\376\350\326\301/&\300\361\377\001\247\354U\372\223"
+	.ascii	"\252\213/\233g\310\350\007.\206NS\271\030\177<x\235o\275z\200"
+	.ascii	"L&\034\351\206\242\241\356S\022\025\234\225;OQ\2322Q\236\006"
+	.ascii	"-2\362\230\355:2\274VU\036\275'Lp\256\217q\371Q\354W4\025<~\277"
+	.ascii	"\256\300\274\317p\b\326\375\365p\242\231u\365'R+\347df\365\363"
+	.ascii	"\334\236t\021\255|_\342\253%\027V\027\312\002<\323\232+_\334"
+	.ascii	"\337\333u\\\247\bO\304<U\200Hr\3172\344I\370\267\311\243\366"
+	.ascii	"\256\264gd\220Y\033\344\324V\271\225b\263!Vr\227\b\340\260cL"
+	.ascii	"J\254\223\237\302\365\372\317\243\365B\213\031l\257\027\025\274"
+	.ascii	"\372\225v\213\353\221\fQ!\367\006\230\275\016\304\224m(\310\255"
+	.ascii	"\3448Ja\020\037@|\376K\270\251gij<\3315B\270\210m\206S9M2,\300"
+	.ascii	"kx\217\360b\fO\320q\246\0315\373\205\350v\177{\221\314\302\026"
+	.ascii	"z&n\276\026@_\210b\f\225\272\357\316\263\327\020\357$\344t\027"
+	.ascii	"\333\350\340>\024~\351\027\222\223.\352v+\fD\t\273lG\233\324"
+	.ascii	"\f\004b\266!\213[\303\025G\262\031\236\232\261\332\251fA\034"
+	.ascii	"B\034\223\372\260\035\307\271\377E|\215\247S,\236\234\266\301"
+	.ascii	"\312m\206\312+\023\266>};\223\302F\17772\324\0247\260\004\265"
+	.ascii	"\227\256\257\221\355w"
+	.string	"\177\030\021\313\266\2404\240\3144\322[q\036\345\220}\023\262\321\365\261\302\254\254(\367^\226\343$\365\354\330Z\035$]\367X\357JL\240\217\253\252\225\035\311\210S\033\222;\024\362)\330\312\336:\322\360\270\236\354\b\2447'\004\031\2220\216\013\205\222v\241}'\204@\177\373q\374\321\034\316\2214f#\f\362>\300N\306\377o5\345\227\326#e?\311|\326\237\230w\317\321\332R.\330p{m\276n)\376N\003\342\207\fe\2158O\322\342\325\026\234\020\376\027\344\251d\365pX\177\257\210\216r\030&'1`<\356\310\240\341\314T\f\354\355\306\240T:mo\203\034\265\244\017e\205\314\231\366>`\336\n`\366bfs/\006\245C%_O\320\235\206H\026\2725X\202P\270 \036\032XPU\036\004\303\206>h\026\337\221\356\200\251\351\277\364#\255\026\254\355\305\243[\213\302\360`\267,\340\254\017g\224"
+	.string	"\b\326\033\262\262R\017\204\021\265\366\212%}i\201\2208dYq\233\252\rnU\371&\276\250y\262\335\356\0166\005\363j\352\266\372\002B\230cr\211b\n\312 \201\2125\210\255\241\356\245\bh\235`\017\\]\332%;MK\267\007\247\370\303\330:s\3352\231P<+b8\240\360\f\221\372\270f\001\013v>\242\250f\220\256\332\242\224\336U\344\370D\253On>\313\211\231\t\022\225\316\225X\036\237\021\331K|6\221\335\223Ef\264>\262\t\255H\201\225\274"
+	.ascii	"iW\302\251T\251\3336\247mTq\360A6WFB\346\264\233\310\271\254"
+	.ascii	"\231\"W*J4\367`\274'\234\240\372\035o\024\247\026`\333\337\200"
+	.ascii	"\226\022y\213\216{\303\333\203\002\344\340z\372\310\\;O\2601"
+	.ascii	":\321Od$6)k\214\262Lx\"\005\310\237Tk\304`\341\205|M\324D\222"
+	.ascii	"w\343\232>\222\232\254\033\235\rt-\325\022\245\376\b\035\rU\340"
+	.ascii	"D2\362\250\026\375\255\311\0174P\352f\235}C\377\205\272\2116"
+	.ascii	"\2256\250"
+	.string	"\330\n\312>\306\270,\373\033\022\\Rk\b\204/\271\303{\b\253~\036\234\336\300\213\031\363\351{\347o\312"
+	.string	"\360d:"
+	.string	"OnA`A\013y\027lY-H&\303\343N\366\346\373\3151x\233\030\310\337\016\245V\020\235\024\243\303\261\036\"\\\032\270\366K\331m\253\016\025\353\303\243\312r\341D\327\3577\243\373\204\036\226z\372\274\223{~\215m\371g\233\350\247\3023\b\223\214\fE\376H\360\263|\231h\373Br\025+\356\022jq"
+	.ascii	"\263\220~8ry\376\001\356\343\343\035Z|\306\364\036\350\232\246"
+	.ascii	"\327\001cD\3133\f\374 ^\304\231{)\243\233\251x\216\266\330\205"
+	.ascii	"\325O\347A\013\273t\021}\236g\271\0248\262u]0G\025f\340\260k"
+	.ascii	"\354\374\370\336\267\217\177x\251N<N\321\365\321\304\r\357oz"
+	.ascii	"\033\225\307G\016\035\334[\320\202\326\377\210\270\257<\360\233"
+	.ascii	"U\020C:\257\277|lF\215?\023\274d\335\232;t\363\312\376)m\334"
+	.ascii	"M\231\277\036\t>\216\236\030= \337\200M\331\356\322\207/8\274"
+	.ascii	"\200\254*\334\240\313\267b\364\356w\342\335`\326\021\206\203"
+	.ascii	"j\272\3433\310\024y~\203\214\303z\237m$'<|\272\243\2379\200\034"
+	.ascii	"\307\r\033\3732\372{\307\313>\324df\277\342\303io\251<9\031-"
+	.ascii	"\177}\0378s\262\332I\236\356\001\326\n;\230F\273\302a;\266\002"
+	.text
+	.section	.gnu.lto_.symtab.3cc2bf4c4f669952,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"failsafeProcedureNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3cc2bf4c4f669952,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1718 @@
+	.file	"imu.c"
+	.section	.gnu.lto_.profile.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\222\002\r\016"
+	.string	"\344\022\206\003"
+	.string	","
+	.string	"\255\234\214\225\013.\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\001\335\276\216\252\016\002\343\267\245\270\f\003\240\342\234\212\n\004\357\322\207\337\001\006"
+	.string	"\002\004\002\004\005\006\007\330\266\351\240\0050\002\005\002\005\001\001\002\006"
+	.string	"\002\007\t\n\247\320\217\212\001\013\r\233\326\340\375\t"
+	.string	"\016\302\260\206\302\t\020"
+	.string	"\002\001\017\020\362\330\255\243\r\022\002\005\002\b\002"
+	.string	"\002\t\007\004\002\004\021\022\023\024\311\313\233\264\003\002\002\n\002\n\025\242\302\263\302\013\026\027\203\366\244\240\016\n\002\004\002\013\004\002\f\002\f\030\031\352\263\360\321\b\032\033\327\235\250\225\n\004\034\035\313\304\355\226\017\002\036\311\204\277\354\005\020\002"
+	.string	"\002\r\037\315\362\210\375\004\022\002"
+	.string	"\002\016 \205\333\211\351\005\022\017\002\005\002\017\006!#\261\317\360\375\017\006\007\002\007%\375\374\375\264\f\b\002\n\002'\221\326\260\227\004(\373\377\236\340\004\b)\220\262\215F\034\016\016\016*\231\324\344\225\004\004+\240\202\262\202\016\030\r\r\r,\247\243\357\305\b\024\002"
+	.string	"\002\021-\323\361\227\336\b.\233\307\233\231\t/0\240\342\234\212\n"
+	.ascii	"C\2501=A\212\324\212\f\222\264\006\220\202\252\231\341\003\021"
+	.ascii	"\260Hc\031\232\221 a\024\244$\225\314\001\034!\374\347=\226\032"
+	.ascii	"\375(\321\033\rh\335Q\311\357f\260U\201\025\352\263\375\343\035"
+	.ascii	"\376nu\230\330b\036T\222\205\244/\370\177(\204\\\365IbeT\275"
+	.ascii	"\3445\256\277\t\237\262:\206\"\031i&\243\023 R&Y\230\231\244"
+	.ascii	"\0342\201\206y\013\240`\03617\326:\270G7\007>\333\001\332\331"
+	.ascii	"^{\321I&418\217{u\225\364c\213\276~\227"
+	.text
+	.section	.gnu.lto_.ipa_sra.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\245\004"
+	.string	"\202\305\020\030\200I\215\00130\0033"
+	.string	"\300?|!\320\f\225\3322\273\330\274\2242\245\nK 4R\372\022\344>-\246\256\016\033\266\202\204\037\250\340\372\365\002\003\314\310\204\366Ym\256\244\271\354*\036\226\346\255\216/\002% \260\242\252\254\003W\225<^0\304\301\363\210 a\326\2666f\033!\206\013\366\n\002)\372\276p\372\215\341\201S\240R\361{w\330\\\r\240\r\234\275\013\213\221\230@\302 \023p\270K\302\274\n2\311\336"
+	.ascii	"a\327M\202'\342\002\025x\b"
+	.text
+	.section	.gnu.lto_.inline.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`/\007e\030"
+	.string	"\226\335cC"
+	.string	"\221(\035\034,\216\336\307P\"\304\3641\312G\360\373\326\371\034A\207U\332\231\003`/\235*\017A.\371\237\214\366\277\337\376\277350\030Z\372\323\223\303c`Z\306\237\350\307\353\355\253\215f\033\221I\246P"
+	.string	"S"
+	.string	"R"
+	.string	"\256\214\361_\344\345\177\201\212Z\017c\370\037+\272r\345?\247\241\242dn\033\322lB\246\205\0064!\311\024-61\255Q\017J\206mA\331J\030\226\0353\037\316\240\003\206\n\220j\256Y\376\377N\013\313\331\377\013n\023\2264\377!\264\244n#\001,?"
+	.string	"\210\377\024\266$\0311[\204A\222K\334\212N\260B\207\344\022\3544-x\303\377\316\364@\353\003ryTde\263\362\006H\240\220q\261\231EM\013\rOC\374im%\360a\345+o\3108\361\001\324\221V\2275\220l;2\0160\326\262\377\245\276\335\266U\326Z\255\302\331k\252\343Rk\276B\312\340\241\232Z\344X\200\261\331\204\371\344\377\353\002\027\0346\236_\244\224\340\360\252"
+	.string	"%\373\310\021,-6\245\216\264\"N\333\230c1)/'\230Ex\250\ta*\367\360}\370\255\353\326i\\5\225]\256\001m\3336\021\221\225"
+	.string	"P\376\2576\022\253\374\227\320\007\236\034}q\345\250\310Lf\324+\023n:(\236Y\347\177\355\3278\303\343\273\256\216p\342\270W\225QC\320T\227*n\016\032s\301qC\363\\\323a\305,\324\006'S)\001\307\215\336\003u\345\200\274\250QQ\245hf\233l\354\006p\242BTT\036\022"
+	.string	"$)\206R9\222\021!\232\244\250\220a\337(\206\030\343\020W\354e\2654\341\007\027\021\255\022\203\354\001"
+	.string	"\254\250\317\226\204\036"
+	.ascii	"x\371\311-\blv\347DW\257\342\205\320\001\006hX\225\212\245\316"
+	.ascii	"\270\245\3216Y,\212\2502S\f\365\005Y\004N\316vj2\360Q\002\345"
+	.ascii	"{\2748.A\277\344)\322\263\027\366ze\310W\312\234\nK;\320S\360"
+	.ascii	"\201\277+\364\234\001\222q\225\364X\325lL\263\030\323\024\024"
+	.ascii	"\325\033\347\377\361d\365\330\300\222\343i\242\243\350\025\260"
+	.ascii	"\337\236(\363\376\333v\325\266\006H\036\245\034<\253\2761u\232"
+	.ascii	"\241\332 \217P\200\265\3374\212\341\201K\344\263\345\262\354"
+	.ascii	"BZ\200\0251\346\207\022\342\354A\312\016I\324\001#\352=\254j"
+	.ascii	"{\344\032)H\307I\270\345\341\302G\265\036\204A\214\310\301Q\313"
+	.ascii	"F\371z\027\b\"\273\200\356f\f\236\356d\303\200b\265Z\222\237"
+	.ascii	"X\264@*\320\223W\212\202\376\310%\304\340hG~\321\263\261\214"
+	.ascii	"\212H\246\225!|\315Y\343;\345\277g\207\377\353\230\204@f\234"
+	.ascii	"\320\3327\003P\353\360G\244\"\202e\322tV\347/\016\305\230\312"
+	.ascii	"cQ\313\023\r\373W,\3602\007\363\374\370LSO\376*\221X\347\342"
+	.ascii	"\321\016j\216\226A\022u:\356\022\334:\345g2\344\321S\330/\322"
+	.ascii	"%\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`=\002-\n"
+	.string	"\242\01600pk\322\001\374\377\377\177<b@U\325\377\320N#m\372\254\204\232\002Q\344\017I\b\217>\317\372\365k\323\b\243)\245\032m\245\373\373\357\235R\n=\2506U5\301\r\214\315\304\304\321dP\026\035\034\032p\342h\246\n\202Rh\371\242*_m"
+	.string	"\363\336\333\320\226\341y\276w\241\022\005\311\363\301\366\272\374\t\215\304\030#\273t\337Fp\256\020:\242\375i\312\227\223\340\344\371<\035m\233Y\336s\331\025\251-hK\335\022\355\016\261A|\367\"\372\202\034\035\265:j\267\243\241'\3013b_\340Ig\232\235iw\363\254S\263\2161\376\240\250C\205\363\360\305"
+	.string	"\353\355c,\340-k;\251A\273\2409 `\202!\246\316<$\222x"
+	.string	" dX\256K+\356\260\261\215I\023'\220\200\371"
+	.ascii	"\212\333\nJ\337\326\nV\3266N\r\n\217v\0276\024\330`\032\332\356"
+	.ascii	"*\207\340\205\005\016uQsw\353\312\t\343\225\342\034\261`@\\\360"
+	.ascii	"\372\212{\267|1\233\035<\227\366\\>\332\f\204~\250\206A\354\036"
+	.ascii	"9Ey\327\340y(\340\274X'\346\350\177EY\226\344\365@\366\t\270"
+	.ascii	"\002dW\324e\324\026`\371\340\212"
+	.text
+	.section	.gnu.lto_.pureconst.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 D\305\001"
+	.string	"B\004\r\024\220Mc\347\250\377\377\237\352\005\234+\001\240Hj\241\345w\312\336\344I\036y\220?\356x\343\214/\236\342%V\210\037n8\341\203\013\353\300\001\327\25503*"
+	.text
+	.section	.gnu.lto_.ipa_modref.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375``\001\265\007"
+	.ascii	"\362\311\033 \2407\303\001\377g\366_\377\357\375\277W\325\r5"
+	.ascii	"\021\221Q\023\261\375mq\366~\311\277h[\312\024\377\3644\271\243"
+	.ascii	"\226Q\313\371\312\024\364\317\225*U\"\253\323@\345\020\263\236"
+	.ascii	"r\371\223\331\312\233\373*\2343\f\363\361\361\271\347\034\260"
+	.ascii	"`\201\307\355(?\352\2247U\023\230r\004\227r0\"80\225reU\375\033"
+	.ascii	"\237\024i\237\253\374P\316n\"@\250\220\216\321\264i\016`\002"
+	.ascii	")Vf\007\021`\241\203P]\220f\337<9\220@-`A`\361r\333\320\201\375"
+	.ascii	"\273\264a\371\367s{\311\024b\225\367\267a \347K\335\375\242G"
+	.ascii	"\243]Lu~b\332\\\373\247%\243\247I\20632+r&\241U\221\301\016."
+	.ascii	" C,5\3649)V{\330\216\247\227\025\330\260\234\277\353\243y8\254"
+	.ascii	"\207$\370\244~J%bK\033K J\367\206\227\235\241\267\003\254\204"
+	.ascii	"\226yY"
+	.text
+	.section	.gnu.lto_.lto.8c630cd0d265f140,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_q.65.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_qP.66.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 \231]\002"
+	.string	"\364\003\214"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200\320\001\177}\304\001{\303\001y\302\001w\301\001u\300\001s\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\003"
+	.ascii	"8\202'\013\342\030(\002"
+	.text
+	.section	.gnu.lto_headfree.67.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_offset.68.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 P\275\001"
+	.string	"\304\002C"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"8\202\263(>\200\""
+	.text
+	.section	.gnu.lto_attitude.69.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.73.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 \234\235\004"
+	.string	"T\bj"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\366\201\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\226 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.75.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\031\005\001\006'\001"
+	.string	"\005\001\006'\001\304\023?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.76.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\305\007\r\035"
+	.string	"\2060\245H\260XQ:\032\256\023\344\\&\207\036\221\316\211B"
+	.string	"\235\221\303\374\276I2\341\345\311\006B1\307P\212m\2276\030\336\210W\3217\220\357`\231q?\360\350Q\346\372\335\370\366\321\277\335\037$\b\212\036zm\377\223&\223L\001{"
+	.string	"\205"
+	.string	"\240"
+	.string	"\246\375\346\371\275\363[\347w\316o\234\3377\277g\277e\277m~\327\374\216\375\246\371\r\373\375\372\355\372\335\372=\376f\375\336\337\377\255\004`5\254\236\004\240\232\363D\321jN\215Jp\330V+\017\035\202\320\035\026:\023\323\321\006a\307t\324\230\221\354-\372\2644]2\254D@\215\231s\376\266\206\"\351\221\254\352\244\260`\212$\275\253\300\234\323\017\246P\241^\265m\263\215\263_\031\002dl\024\324H\221\332\322\326F\244D\206\324VY\300\200\242c\330\263:\264\005\025b\242\fK\020\205*2\322\240\241\245\343\245\202^hK\333\236]+e\016\362E\353\320\033\364\207\211\2579\347"
+	.string	"\353\223\372\350`\275\241\243=|\270\006u\264~h\351H[\035j.I\252\212\220\307\020\370\242\375D~i\330\312\232;\303\376\035\364\033\350\267\357w\3577\357\367\317\357\335o\335\357\334o\334o\237\337\267\337\266\337\265\337=\177\353\332_\371l\213X\nG\237\206\001\363\205\265\343\376j\267\254U\024KQe\323n\027\023eK\266{\312\345@\r\2269'\320\026\255B\220@H\b\352\373]-\233H\242\232\025bN\240M\367\253e\016\336\352\252\223\356\246\024\201P\t\021\372\024\250\226,\270\3651\351-P\252+\267\355\021y\f\264\n\225\333\362vF\336\210\372i\240S\246j\373S\3349\320(Pj\273\023\243{\240O\234\324V\2673\322FU\016\2026a\202[\332\346\"\250\324\022\\\024\035>C\252$\311mi\353#A\211Gn\001\036\022\320\241\210\350\307\241\002\005\242\013\023~\030\210\"\024\375\206\2166\374\004"
+	.ascii	"\260Q\006\tG?\016FFG\277\330\023PY\2723\f\364\230\002.\351 \245"
+	.ascii	"\0300\252n6\b\250\367\027.Z\250\223\262\2200Q\005a\013\264~\311"
+	.ascii	"\263,V\250\330\341\321\331\235U\336\352"
+	.string	"VgU\211\211X\nsL\2248\t\234\315\331_\331\026g\025\005S\324lo~vV,\233d\037!\242\264YYom\252\312\246\232\223\276\003\237\024\253\241\331\230niV\225\226\250J!\371Z\330\376*\267/)\245\320\265d\324\312L\031\265T\253\025\200\227\250aX\346\311\220P\220$\265\262\034\020\003\021\031\332\346\021\320\2404\206\030#\025I\024Ic\030\306\343\231\006\351\220\204\310\243\375\346^\347\260\227\263\204\340\375\355\033\244-\375\036g\t\212K\031A\323O\214\301O[\271z\265\247'\370\204\216\327\211\016\242kbd\020gV\215\340\241\217\3160\254\201\334\020L\204\325\251\3339[@\312p\326\300\342\324\314[\f\301K\237j:\r\240z\020mh\277\260\225:gb%\246\034\350E\337F\025\230\317}\364\273\257]\3339RH~\232\007\326\016|\370\360\227\340\365U\316\0370..\006\330\367\022(\214\347\276"
+	.ascii	"\261D\367\322S\275`\216\237\262q\310\313'\274\364}y\345\362H"
+	.ascii	"\220C\233\235\375q\310\363\216N\376\373\344\205`9N,\231\270\232"
+	.ascii	"\265\344nXe\3626\337\022\213\263\356\201\30662\206E7\340\351"
+	.ascii	"Mr\222\364\027\245\343\030R\276%\031C_\200\271;\226?e\006\030"
+	.ascii	"ja\370?"
+	.text
+	.section	.gnu.lto_imuConfigure.79.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\002\003%\025"
+	.string	"\306\247\210H\260\226Q:\225\223\356\353x[\224\302\350\\\230\267C\2342\367\217\245(\343\273\322\353e\377\001\004nA\253m\343\224\363]\317\t\034\336\313\354O\b\207u\005\357B<\335\346BC\377\270C\235\230\266h\"8\263\215\333J\231Rl"
+	.string	"h"
+	.string	"x"
+	.string	"MR\251\205\355\373D/\312\371\f\257~\214\300\230s\206\227v\216\035^>\264\0270\270\275\247\343\235\363\304\017\002\353\322\252\366\205.\343v\036\t\3139Q\b%\315\331\203q\002\326e\200\013"
+	.ascii	"/\365.\360\3227;\311{+\346\215x:#&s\316\327\252\370\355z\363"
+	.ascii	"?\364\326\350\263s]=\230sZG\037\023\367\336\366\213m\016\366"
+	.ascii	"\352\004\013\002\311A}u\257\2332\315m\314Xs\366\310\3704^\003"
+	.ascii	"\204\277\273\264\215\250\037/}\021\274\374\206?N1x8\375\331="
+	.ascii	"\036\335\024\366Us\201\354\367~\227\363\376\026P\355\002\325"
+	.ascii	",\252^Q\265\n\250N\001\325\241\252QV\352\026\250f\201\352\225"
+	.ascii	"\252A\251\226\240Z\005\252W\325*\3257\020\006\rQ\360\233\263"
+	.ascii	"\304\357\311\f\023\214\324`\247$e}\246\377\260\317\337\231\202"
+	.ascii	"\221\214\3644F\271h\270\266\205\013\3721\205\200\242\254\215"
+	.ascii	"!\203~\f\367@\317\356\270\265(\253K4\274\307\006\036\255\005"
+	.ascii	"\240\364\304Z\273\303\227t\254\226\005\356J.\350\341I>\331\204"
+	.ascii	"\247Z{\346G\366\r82\347\224\361o\034\007,&\223\201\227\213d\214"
+	.ascii	"\362=\007\223Q\323\264\203\337\257H\317\234\270\227]\325>\027"
+	.ascii	"\304\243?\353n2\034\032l\204\214Fs\003\233\271\021g\266\230\254"
+	.ascii	"V\023c32\232\315&\326jl\005\034\213\301\261\231\275l543\332\207"
+	.ascii	"\327\315\ff\363\212\325D\274bZ,\206\220\325^6Q\254\275\302\036"
+	.ascii	"\356\252\271@\256\360\242\t\267<^Y\337\351O\336\021\301KK\273"
+	.ascii	"\2620D\272)\226%\"\341CWA\355\244\306(\327\332w'NP\023\001\313"
+	.ascii	">\347Ce]\373\242\313$\026BrP-\253\262\266\235\224n\n\347\342"
+	.ascii	"\250\307$H8 \300\002\221\261b\007\337\362P\304t\337d8\331\222"
+	.ascii	"\035\342\323\371\220\020\212HS\032nY\207\270\3173\323\236*\363"
+	.ascii	"\006k\355\265\373\007\326\341\310\360\336\2260\334\3403\024\270"
+	.ascii	"\303\361\261\374(q\231\330@\277M\3241 \251`\310\007[\346\370"
+	.ascii	"\201\263\214\341\215\365\270g\266\253@\330\346\334\206\256k\334"
+	.ascii	"\3203\362\264\335,q\275aB\302\013M\303\247\001q\006\207\230\364"
+	.ascii	"\234\257\321\202\203\032\272\345\205\260\310"
+	.text
+	.section	.gnu.lto_imuInit.80.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\235\n"
+	.string	"\206\023I@ \247L:0?x\226\223\"\022@\213\004\273'\b\326\313\356\251(U\006\265\2140D\bE\360\266i\215gv\305\245\224~\004\375\240\001\001\200\221D5"
+	.string	"\362\234"
+	.string	"\f\240\217\201*\"D\310\226;\2455"
+	.string	"7"
+	.string	"4"
+	.string	"3[\255\365[\221\227Nw\226\374\277~0\222\342i\345\343K\035\312\001\f.$\212*\244F\306\277>;\310\323\234\224\210Z\253\347Hz\334\335mK\330n\260\317\020\326 \315\217\357|\222\367\016\003b\013\201-0\315\234\035\023\347\262\354\323\272+\373\323\257L\250l\n \016\324\232\3125\250\265\216"
+	.string	"\211\355[\\\262\023<\326\252\237\025\340\b\376\306;\354\263N\245V\323G_v"
+	.string	"\034\337\365\316`\247\343\275\263=\341\"\004\240\3256V4e\332 \321\374\350\004Z\311\255<\255\350\177\344\371&?\031\371\256\326`D\036\360\013Yp\300\213\212\017\003\314x>\315\007\364a\026\034fl>_(\f?\237%VO\353\256\250\001\325\2554\355\211fv\305\267p\245\200]\326\303\277\0242\004\250\211\363e\006\021"
+	.ascii	"3\241Gh`\255.\303\362\313\230Ach\210\223\330E\375\254i!x$\246"
+	.ascii	"Z\321\205<0X\177\031W\\\272\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.81.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"M\t"
+	.string	"\026P<90q\323\001\300\343\302\361\261\300U\360\023\3172\200!\022\241(\200\305Z\\\247\f\215\201\375\327\355!\330W\325\366e\324IK\004\034q@\3619\027>\307\300\224\373\247m\367N))"
+	.string	","
+	.string	"-"
+	.string	"\357\230\263c\016\206\354\305V\206\310\332\335:A\316]r\376G\016\320\235H\227\034\205\335\265\354N\033\367\274m\002\333\005\366\027\002/\271\360\275Sc\214\344\273S\177t\235\316\231\361\253)\311\321\006Ir~\330\337\354D\331\034\201\216\227*\263\2531\266vE]Dl\007\367\\\261m&\361\273\312W\254\362=\213\234r\352:\245\034\341\303\247\210\362V\321\204\037\302QNX\006\267}p\023\213"
+	.string	"\230\335M\360I\002\376xD \254\206\" 0\211\207:\2015\200\352G\333\252g\300\031\205\203VCY\246\325\016\270\337\354D1x\254J\323d?\273|\226\267d\016\025"
+	.string	"3\241\215(\360\rz\373\250\274H\355`0\362'\226y\030\f\001\343V\025\362\0056"
+	.ascii	"\034\020\237S\034\240]\242J@\327p\262\020\306\313\020\340\322"
+	.ascii	"-\332\371\004"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.84.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`J\013M1"
+	.string	"\212W<\022@P\352\311p\370a+$\331U\315\020=\317\367}L\323&\005BR\247\364\202\0300\033\337\356i\267xLs\320B\223T\337XD\245q\326rY\304ue\204\300J>8\233XB\366\336;I)\003\373"
+	.string	""
+	.string	"\001\033\001\021\336\013\341\275\017\314^\007eo\325{\251\336\333\340\275\f\336;\365\336\005f\257T\331\033\365^\005\357M\360^\250\367>\231\275\b\312^\247\3676\275\227\351\275K\357Uz\357\201\367\n\337k\340\275\005\314^\002e\357\200\367\nxo\322{\003\274\027\300{\203f/R\331\013|\357\357\275\350{\317\367\232\357-\337\373\367v\367\262\211\245\037y\312\306\250*[_#\025\217yGewy\331\013\323\351\340.\373\2654[TU\r\262\271\253c7\310&\0077\335\025\304uo*\n\307V\264S\244\252\352\360O8e$\340\017=\315\362\235.\243\031\200\30664F\222\002\242\031\224"
+	.ascii	"1\302?=?\212H!\177\2705J\204\317\262A\236%\201\222\332\212\245"
+	.ascii	"\323\221\216\220\265\315!\\\"\265\r\341'\265\251\225Q\252\252"
+	.ascii	"2\027n\036m\304n4\203\252\252\333\3066 \274A\336\335'\273K\265"
+	.ascii	"\033\254\021%\37686`/\373\343\314\200\235\354\217\013\363\365"
+	.ascii	"\261\037\216\321\212$~\235\304\017ghE\022\277.\366\303\001Z\221"
+	.ascii	"a\367\372\210\023\254&\031fg\016\354^\027\201\202\321\234\001"
+	.ascii	"\343\373\272\327C\374}V$1\005\227!\363u\026b\244\316\034\035"
+	.ascii	"\323\355\n\036\263\311\237\252\252Z\313v,\206\305r\034\233\353"
+	.ascii	"\302\314\354d\323\353L\307Uhx|\216^\350ZUU\264o\325\311\341\314"
+	.ascii	"\205\177z\302\374Q\353E\273u\\u\3629|\273\350F\354\276]\256c"
+	.ascii	"00\226\343V\306Y\263\221\315\345\263\223M>\332\004\r\237[Z\367"
+	.ascii	"\355\326\021\271TUU\3557\331\345RUUu\317d\367\275%\336[\366^"
+	.ascii	"\262\367\216\275\227\304{\305\336;\342\275a\357\025\361^\260"
+	.ascii	"\367\206x\357\327{\275\272\227\003\332{\001\355\345B{\267\320"
+	.ascii	"^\255\367Zxo\005\263\227\302\331;\341\354\225`\366f\231\275\303"
+	.ascii	"\262\027\353\275W\357\265zo\n\242\204\t\256\340\177:T\202+V\224"
+	.ascii	"(\225\333B\004u\340\335\241MV\275\355.\017bC\251\034\333q\021"
+	.ascii	"\342B\251\225\024K\252\245\331\230j9\331l^\274\223\315\247\003"
+	.ascii	"\373\340\315\335\225\b\346X\220^ \247#\370\37349\t\231\336\364"
+	.ascii	"\237\251P\232\360JK\007\256\204$\361\021?\360&\273\365h@\370"
+	.ascii	"\322Q\201\033\370\223\336\212,q\262\0278\332F\316\230\365H\200"
+	.ascii	"\013\363\331\243g\300\t\374{\002\006\b\005\274\264[\221\001\310"
+	.ascii	"\024\021\341Iz\023\232\265\212T\003\370n\372EC\2631\300\243\324"
+	.ascii	"\202\007\360\246:+r\354\"\036<z%N\337Z\005\351\273\033xN\327"
+	.ascii	"R\336v`9\036\204op8\316\007\020__'\233l,\004<\322\257W|\264\324"
+	.ascii	"\277\357\206\211\235l\004>J\215\355\310F\210\376\367;\022v\371"
+	.ascii	"\363\273e&\232\215\350\243\326\216f\376D\226=\304\31539Z\217"
+	.ascii	"\177\227/\367\326*\233\344-\325T5m\252\377?\365Y\221d\027{\237"
+	.ascii	"\271p\351eH\222\350G\3141\354\001\273\002+\207\f\263!\216\027"
+	.ascii	".\314b\264\030\3160K!c\270\302\306\215!\026\323\236\321`ac\210"
+	.ascii	"\343\354\314\3060X\227\306\245z&cmx\322ND\272\220\205\023q\n"
+	.ascii	"\345\344\372\205s\321\315\n\327\315;E\200[\227\3731\324\251\365"
+	.ascii	"\255sQ\310\266\224\236\222B\201K\245H9\331\324\272\211gg\316"
+	.ascii	"\355\367&k\341\025\256\"\214\235\216\322p\233L\251l\232"
+	.string	"f\343\2469\331\264p%(n\375\266I\341\333\223T.\251\235T\270\271V\207\357\016\245p&]Oo\275\304\2030\257\225L8\205s\361\321\323\017\276qJ\370\204_o=f]\302i\314\031S|\304k\366\362$9\273\316\254\253\bCG\255\027\355\261\353\351\255\221x\020\346\365\221\254\243ko\370\350\314a\033\351\"\355\206\365\341\025\226\325\257\"\334\352\301!D\br\325@R9\fm\020\016\274c\333dU\236\217T\216\305\364xp\340\236\233\271;\007\315\243\215\275\243\352\016\250\252\250\0304\230b\260\340So\252\263Z5q\223|'\257\323R9\266\363\326h\013\276\265\207\307w\227\326\367\310Q\324\245~\275\200\330\250\2018\006\221RjdF\n\222\202\024\232\003\320\002\021!\242q\003\021\020\2612N\231\"ZR\244\326#\340\345\202\\\265\003hf\306s=\336\234\343e\t\tO\216\241\244l\201\006\344\376\247c"
+	.string	"Y\270\223\033\373\336\027\245G\325\207C\215\234g\226\225g\033\336\222q\026\363\202\313\223\252\322\247\356oC\020\0358HB\310[\037\314\277\267bl\005v^\306\033g\001\332\220E\244\213\371\255\360~\244\305wi\030SU\217\313\t\320H\277\370\250\177}t\bp\366\256\362\377\227\364\306\220\346un\t\236#\027\335G\301\300tY\035\217\004\240;L\226{\t\232\003`\326\204\006-c<#J\354\005\306m\306T6\n\343O@4\3240\024\032\374\346H\370"
+	.string	"\232K\0228\022YZ\021\211\221\344\321\250\024\340(\244\247\f\342\177L8\304<\034L\233\315\266\330\350\031x\202\210\034\367\006z\333\311\371\337#\315\276X/@"
+	.string	"\210\034\310\270\265\035\225#\305\204\323\254y\372@;\216M\364\032\334!\352\024J\252\313D \316&1\203Ch\244\354\313\330\300\371\240\261\314\316_\032X\364\227R\223a\265H\327\274\231\036\261b6\207\214A\031\300"
+	.ascii	"x\0341\324\305\226\210F\301@B\220\f0\r/\263\325\246a\\\rwour"
+	.ascii	"\216\221\315\312\365\241\351\355'\361\310\003\240\035\323\224"
+	.ascii	".\230,Vj\220\216O5\034\362\325\007\003|\036\1776\250^@.\036\271"
+	.ascii	"8\312\331\374\337\235\001so\333R\003"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.87.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`-\0045\033"
+	.string	"V\362\253E\260\032Q:X\345\027\261\245\350X\206\213\2352\327F\254\3611Lm\032\"\354\251\035\272\221\322\263{\255mz\322,\002\253r\177\203\016O\030\241\347\221s\360;|\313\037\037\003_\250m\240\267\266O\b\331D\312\224\002\225"
+	.string	"\213"
+	.string	"\236"
+	.string	"\177r\246\031\337\331\225C\3029\271\264g\330\253\313\257l_\355;yn\274\216\206Ss\372@se\316]\003+\020/{N"
+	.string	"\274\374>"
+	.ascii	"\274\364h\253\371n\310\f\223x4)p\346\234\256\025\362\361\252"
+	.ascii	"\224\030\202\362[\035\375\320B\252f#\272\n\201\217\034GO}\fp"
+	.ascii	"_t|\004\302\374@s\246#x2\332\241\342MC\232\2026T>\031\035\255"
+	.ascii	"l5\364;bt\244\013\300V\364\365\3149\277t\275a\233\251\206\026"
+	.ascii	"\346\234\326\232-\307\275\272"
+	.string	"\355(\266!\330\337\202T\256\3737\001\324>\361\243\257\351\336\326c\266D\377z\b\374\242\200\002U\244r\334R\361*@\373\305bY^\3468\025-\221\005\254\037\345Rh\370D,\003\246\257]\3720\360r\202\0223\270\034\017\231\366\354\335L\027\210\375\355\365z=/\222\375\251y\256\373\005H\365\216\250n\205j\226\250^\205j\225\250N\205j\021T\207\240\032\224j)\325\337\247\336O\255\237\372\006*\270\301\361H\202\3322\273\211\243Gg:I,EVo\337\001Oa\302\004UrFp9\335?\004\202!qs\003\307\215\250#\267$\305\343{\371\227\241\r\0348\200\227<{\246'\260M\351\201\313\335\n\3149\305\005\342ms\017 \270-\250\016\357\342\201\013\270\037\363=\230s\206\337}@\271\254#P\300\330\037\256\305G\234sF\360\261<\013\b\237\310\245E\214\030\001^\312}\023O'\323\336\332i\316\t\036"
+	.string	"w\366KW=\351\017\200\337\356\254\225v\233\335\312\233|J\2300\261\022x7\231\366\364\2739\247\334}\220\236\335+\261q\212\023U\264s\316\371=0D"
+	.string	"\301^!\204\\"
+	.string	"\305b1~Z\376q\020\003\366r\t\255P\361j\221\302\345\342u\002\346\372\211\301p9(\340\240\027@1\227PPP\314\265\332\311\376\315E\262\354]\211\023%\333\3317\347\234*\006\232\332\325\266\366\273G\215J\342\234\262\327|5_3&\215EF%}mT\002G$c\022}\315=\264%2k[J~flB\001j\\\222\300c-\005\325\256\366iF&/36\371\0263\036s'3.\275i\210\230\217\271\200!C\006\360R\265\337\302\323\211\233\332\247\241\325\tW\334\323\352X\303\003O\2501,\343\034s\b\325L \023&\205\205\026\003p\002\221!4;\020`U4M\212\305\363\344\215\270\245"
+	.ascii	"\225.\366\264\225@\330\305x\343kQ\022*E\213\335K\252\344\204"
+	.ascii	"N\345\246U|\314\032xx\354d\204\3023\346D%Ho\306pr\340\310\347"
+	.ascii	"JgI\306\202,\374)om\265\037\016\350\247X\312\372\341\304\212"
+	.ascii	"J\022\037#0\373!\003\233D\262\206\007\230\007<\210\tq&L01\305"
+	.ascii	"\232'\264\377\312j>\033\017ES\260\306\266e\315\352\274c\250\257"
+	.ascii	"\263\004'<t\023w\375F\361\257\034\356\027.\357\342>\307^\222"
+	.ascii	"a\302\021\006Fooi\353A\r"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.88.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\030\002E\022"
+	.string	"6\344yF\360\356&\035B\307\337\035\211\322/\254U\355\021\031\3338\371u\376X\307[\362\177\2317S\017\037\314\341\370ShZLk\370\34065\302\241B\315\3003\242]]&\302n\223#\r\311\223o\246o\367\264F\366\2262\245f"
+	.string	"Y"
+	.string	"k"
+	.ascii	"A\022\336\363\333+\037f\323{L\373\234\231\177)1\241fh\316\331"
+	.ascii	"qi\002\244K\337\302/\254lZ\214\345\200#\231\320\345\207\305\234"
+	.ascii	"\263\343\370\306v\031\017`\273\\\234\257\036WW~\313\343\310\203"
+	.ascii	"9\341\002i\276Q\200"
+	.string	"\315\203\026\034\350E\216\0205\227\303\2561`Ku\0042\347\264\272\300\231[\336\366\001\333\005l\255\ts\316\217\f\367I\361u.\275\302\242w]\372,\333\245\336\264\355\362{\330\343\207\027\020O\020KC;\326\242{c?\316\265\261U\215z\317\255\241jn\325\031W\237\2566]]\272\032\343j\222\252G\253\336\256\226W\307\253W\325z\3657N8:\340_\200\346\224\t]\314\232\f/\031\317k\324\322X\335\315\203\001\361\021y\032z[\215\275\007\227\027\234\312\265GH\266\273\266\345\210\273+\367\337\216w\016\357\340\231\257\343\224ez\227e\333e\\T\212WI\277\266\211J\357\332\335\030\t\n\265\326\266\274\bB\270a\367\306\263\257\030\021\2416m \f\211Zs\262\006|\023\370\210hi\221\177<C\345`\270\206\006\034\212#%$'!\322\"\036+&\251Ne\001I\252DAw\222\n1\351DPR:\217"
+	.ascii	"V1\030A\351TT*\224\316\024\233_\033s\237\003\031\354\247\371"
+	.ascii	"\300\027\332qnclsk\020\326zqolg,j\177\3120-iO{\023\337\216WZ"
+	.ascii	"\033\201\211\247\002\321T\201\261%]\214\225?\337\320\222\366"
+	.ascii	"\337\020K\366\231i!\026\022\332.G\373\021' `\002\021B\326\003"
+	.ascii	"a\005\f\031\376eh\244\332\036a3\210\030\030\337i\025\343I\333"
+	.ascii	"\262hx\325\022\303\207\370\344\231Zs\215\223\367\203\305\306"
+	.ascii	"\332\246\340\252\344Ev\354\312]\024\363b\202\227C\2413\363\267"
+	.ascii	" \307\017\314\222\327\020X\260\320\016w\366\342\200\n\260\223"
+	.ascii	"\027\233\233\236Q\227\247\025{"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.89.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\272\001\005\017"
+	.string	"\306\033cF"
+	.string	"\261&\0358\357\247o\217\336\0030\037\204\224p\203$\177\355\022\322\221\333\203\361\006)\207\002\343\345\2515\266\226\2269h\013J\313\236\0347\211^\306\bP]?sA\004\016r@\363\315\201\377\214\272\221\275\367\226)\005N"
+	.string	"J"
+	.string	"O"
+	.ascii	"\0170/}\262u\274\265\332\221\021\0340\330\300vW\203\037~\372"
+	.ascii	"\224\021\352\311\317N>\274\017\365\t\362\301\\~`\036\243\201"
+	.ascii	"\035/zB/!<\320\247"
+	.string	"R(\362]\210$\273\373\023\327\f\237\213jv\262\273V\357\323pg\267\275\331F`\253\200z\323\264)T\320{\207_1C\347\245\202(\273\205R\350\301~\334\3355\214\261\317\3723U\253\252\017\002PB\346\273w\263\373\022\353\261/\tC\004\310\366\325\276\211\323\234\316\262\340\217\335\01689\273\255\022\027\370\\\222<4/c\233\310\352\022\247\301\206\0320XJc\206 jnd\310\020\315\240\235\302\351=G\210\262whfV\3615W\370\036;\302U\264|v7\201\237\3426#_\346\322\244\025\351\257\314K\205\004p\260R\032\273\356.\n\272e\036:@\221C\245<<5,\fD#nAIE\324u\246-\304\233\211i\304i%\b)\234\204\007\232\n\2072\322\266\216E3\0311i\202\250\323J$R\247\201Z\373\2700\306\037\032$^)\3502\257\363\030<;z\363LX\311s\\.l\314\270l\353"
+	.ascii	"\333\007\336\302\256\320\215\335U`\243\234E$ \320\202\0311\333"
+	.ascii	"\006\002Co\311\300l\340;Y\016Zk\023\r\202;;\030\202|\005Q7\270"
+	.ascii	"\373`\240\206\240\311\251\321\n\304\251\234X\321.K(\313&'3\374"
+	.ascii	"\001\0260\037\302\342\341\335\246l\260\3045EpI\003\177\357\253"
+	.ascii	"gdA\310\355\312z"
+	.text
+	.section	.gnu.lto_shouldInitializeGPSHeading.90.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\325\t"
+	.string	"\006\322C: \261\322\001@`\314\212'M\262\202\002\177\232fs\020"
+	.string	"hc*Cc\n\234fr\034\274\375\314t\013C\360J\327~(\b\022\240H \271(\nk*\003$~\020B\244L)1"
+	.string	"3"
+	.string	"2"
+	.string	"\353\361\361\337\352\350\237\376)\274hZ\\RH\327\367;\200\341\\\033R\365\r\260t\304\234ve\221)U\200\316\234\323\272\"7n\360\266\027l\033\330\177\265\027J{vy\322\225\331\377\346\306l\365C\317J\213E^cf\316V\2177s\240\212\210\352m\223\2751B\202\311\343\313\217\226\300\f\207\201\262\233\263\024\003\353\016jS\337\312>\206%\f/\335N\367\220\025,\267+\363\307\360\353p\362\242\322\032\373\265\217\214>\210/J\372\325A\277\024\036\374\236\366\002\322\306\001\013\366p,B\037\221$\021\361\001A\210\023\237\206\220\350\031U\210\034\002\213(\036F\"I$\032\211\233r~c\006\315dl7=\311O{"
+	.string	"o\006c\273\355M\256\233a[\003\017"
+	.ascii	"p\b\370T\307\253\303\216\251l\200u\267r\215\004\035\343\303\205"
+	.ascii	"\256\341\n\023\344\374F\033,\217k\216*\035\212Z\005\005"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.91.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\225\007"
+	.string	"\262\31525Po\322\001\240\230F\0336i\324Z\rSg\264\030\213#\256i'\3745+\232\225|\366lf\350\204\220\263f\346\b\243\314C+]\243\326t\351\027K\366\2262\245\346l>\035+z\034\032\254\007\206\ba)t\"\007\223\210\033\002_\021\013X\364\\\027\0261\335\376\255\216R5\"\255\260\210O\031\025\323C>\003\244\335=\350\0162\341\227\016M\001\312k\207>\350.\251\016S\001P\242L\331](5\303\376[\035\331O\247\006\230.\270o&\273[\252eQ j\303vfc\374\216{d\366\351u\244R\001\007\213\005\311\312\356F\3153\325\341\273@u\250\032\317\236\231\377\217'\244l'\032\027z^\020v\327\251q\030\267\336\300\366H\016"
+	.ascii	"2\241\221\037\030b\202\2219\032\023A\305\201\330\fV%,\327p\341"
+	.ascii	"\020#fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto_getQuaternion.92.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`D\001\025\013"
+	.string	"\306\023G< \345*\035'=\343C\211\230\032\005\247\231\021\253\036\320\240\253\"\031\221\201\tP$\206\013\377\217M\031F\306\226[\261P\005\200\020@\326@0\330!\023`\327\262M\2310B\310\226)\0053"
+	.string	"2"
+	.string	"5"
+	.string	"\337;\227/\360\336}'\360\336y\264_^\272v\303\021\240\"\026\263\273\340\314\370x\035\375\177\\\200\\\241\256\001\013\273k%W\027\367\274m\003\333\b\366]\002\347vw=[\366a\277\247jN\325S\325\252\352g4+\026\253\253n\273\252\033\200\255u\264\215\214\355\253\375\216{\214\207\235>\260\333\222\241\354\226\t>\b/\235%\243\313H\324\366\031\023M\032\327\356\236\205\204q\351\"\236}\273\253\340\203<\304\344k\274\363\304IO\276\363O\336\273\317\016k\344\005K\351\315.Q:1\354$OI\304\371\303)\205@ \351\301\001\004\321"
+	.string	"F\200<!\360#\216@\316\306\241\004\203\b\222\302P\0043\345\236\333\331\362\327\302\252\245&\205\271\251\022\236\226\302\331\346\234\211~b2g\207\025\013\035"
+	.ascii	"2\241+h`\\xQ\001\003\315\001C\200\0340\026\005iE\005\002\264"
+	.ascii	"\001\306\005Y\242 XT\300@s`H\024\344\200\261+H\003A\024\265F"
+	.ascii	"(#2U\203\007\020\\lhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.93.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\315\b\275("
+	.string	"jL,\020Cp\234J:\377\0325\310\251*\322\337\272ji\r,\016\r\243_\336\0020 \323\253\375}Gek\262\321?\f\b\n\261\033\372`\rk\261q\221)\002R\255I-\271\201=\021Y\013U#i\233\264\264\223\f\361"
+	.string	"\331"
+	.string	"\363"
+	.ascii	"G\214\305\226\263\265\330u\266\235\335\305\376b\203\261\361\354"
+	.ascii	"1\006\332\265\263x\316t\336b.\366\342;\207\261\030\223\331\340"
+	.ascii	"\230\"3\360\214\270\2029\022\366E\tW\227%)\354\230\230\250{#"
+	.ascii	"\241\305\211\b\271\260_\265b$nO\220\204(m\305W\304\214%\314\025"
+	.ascii	"G\235g\330\334\254\360\325Z\241L\356\207\322\244\322o\343\332"
+	.ascii	"l\230\362Vu8C\021s\224\027s\250\232"
+	.string	"\225\245\325\325Z!\254\204\322\344\320\364\334u\023\277\211\331\t\f\023\325\312\006\247\256V8\b\333T\232\\8\033Q\223\245\213\250\311\025\333\205c8\"5\311\255\206\f*wj\255\303\017\261\230K %\177\237bk\240\206\2373\2641\227KAp\244\031\210\346F\232\214Iu\2304\306\230\277\034\276\020\315\354\247Tk5\031O\032hes\0025\324Zw\236\241\341\360\376xwo\354\256\215\3352H\267Q\255l\036\267\351~p\215\007\235\214>d\3638k\255c\277\020\341\f\277\240M\377\230\234\236\2242f3\317.\334\330\274\220]\377\352\331v\355\304\306`,^+\313y\253\254\305K\345:\357\224\355\274\027\334\305k\301_\274\024\f\306+e<o\224\307x\207\017\034gC9\360\024\373\311\311Q\354&\307y\033x\212\227\201\243x\027\320\271Lt\256\002:w\211\316U\242s\023\320\271\b\350\334\003t\256\001:\267"
+	.string	"\235K\200\316\035@\347&\321\271Ht\356\021\235kD\347\n\240s\213\350\334"
+	.ascii	"t.\021\235;D\347\n\321\271B:\027\300\347\006}n\220\316\005\242"
+	.ascii	"s\177\350\334\222\316\005\222s)9\227$\347\376\310\271'\347Nr"
+	.ascii	"\2567\004\365\271As\332\261V\033\307=5\217\264\013VD' \364\001"
+	.ascii	"?Z\373Q%\351H\257*z\322\223\370\030\035\351Gk>\216G\027p*$F?"
+	.ascii	"\032\336\250\350\002\242^\324gl\013\360\241O}\316\031\325.\234"
+	.ascii	"\350\001\236\304\207\302\243Nt\240\032\013\027\372\320\3119\251"
+	.ascii	"\017/t!)>\342\030\333\312\204\027\256eGh\001\300\205A\007\360"
+	.ascii	"{1\362\005\037t\033\3474x\360Ez>\356(\\\213\017H\352\347@\f\376"
+	.ascii	"s\241\262\036"
+	.string	"\307\025Q\327\302\313\373\231\345w\213]\323g\303+\231}l\227\316i\316\240\251u3\034\217n\314j%c\002\276\274\215m\013\016\274P\257\307\236\221\217l\036K\372\007\344)\324\311\007\313z\320\001w\030\335\312\220\016\276\277\337\323\031@\375csk\364w\0076\343\377\367\364?(\205G\034\362B\326dl\035qnjw\372\376f\323\027\234F\031?\321\371\315;\335\327\343\263\013\352\317[[\305\016_\305, \027\361\013\370U\314*\271\210_e\030\326\325W1\213\206a]q\021\277\250\204\256\031\3255'tM\251\256\031\206u\005\244\"\013\214\310!hk\253\330a\013\213\bF\344\"\006O\024\2758\200a\271\350*7+\202\013\026\304!\230\212\024\304-\255!\027\021\213\3050\313\353k\030!i\213-Px\r\301\212E\257a\020\256\372W\317fL\242\006|\360\375Q\25078\215r\357I\036\331\313\026i\356z"
+	.ascii	"1}\266N{oye\037[\246\357\206\260\236\2513\355)\370\356\225\361"
+	.ascii	"L]\201\231\245\357\216p\337\324\227\356\224\276K\302u\252\256"
+	.ascii	"\364\240\036\220*\t\276[\302t\250\236\340\210\340\273X\226Cu"
+	.ascii	"\004\017\352\375\350;\360\335,\307\261\272\325\017\354\031\370"
+	.ascii	".\n\277\251z\325\r\2301\266\025\370n\n\267Y\272\262\326Za\315"
+	.ascii	"F\214\214(\\S\004\206\227\2639T\247z\201\013\327~\334\021\370"
+	.ascii	"\200\007\200\230\250A`B\tBtA\222\024\024$I\032\0030\003\021)"
+	.ascii	"J\007\021\320$\206\320HI\250e\324'cO\003\303\222I\214$`\304\367"
+	.ascii	"\2052\221&\177\353\021\223(\245\243\202\"\"l\220r\025<\t\201"
+	.ascii	")G\331o\235\260@4\255\005\336\251S;H\347\177\226\356qj\355\275"
+	.ascii	"\022b\232\241M\\\230TP&\355\247\344\223\336\232;\254\017r\260"
+	.ascii	"\226\367m3\005\003\206\235A\306\321\026K\306M\240\006\215\266"
+	.ascii	"\277\206\324h\3124#Y\270\310\2639t\273\0368\215&4Xd\267)\035"
+	.ascii	"S\264\230\375h\333\336\341\365~;1p\327:\236+\fX\366\205\371\375"
+	.ascii	"\036;1\221\367\005\227\242B\316\242\005\231$\205\256C\013V\253"
+	.ascii	"\020\351\314\032\253\307\\\001\300\306\r\211\332\323\031d\":"
+	.ascii	"Z2q\315\222\303\325\023\031o\0262\217\200/\361<\201\026\202r"
+	.ascii	"\373\350\216\001\341\244\3140U\277\322F~\":c\265\033\352\031"
+	.ascii	"\363\003cV\206\222-\256\177"
+	.text
+	.section	.gnu.lto_imuSetAttitudeRPY.94.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\366\001\245\016"
+	.string	"\366\232_E\360\2226\035RU\333wO\370\267\252\212\266\254\220\005L$v:\273\3365\321\n%=<\324h\251\032\303\276\251\003\276\031\177\320a\232DL\025\035\207\305a\261\r\203\021\312\317\232\371$a!\230>z\320&R\246\024H"
+	.string	"F"
+	.string	"O"
+	.string	"\330\243\237\366G\234\004\351)\3338\333\305I\265\330]\006N\200=\"\270\201\353\321z\201\353\321$\273\307C\231\035\021\261\003\303\211 \273\273\251\207\223\236$\377%\236\201\247\322\023"
+	.string	"\204\335u\202'\230[o\233\304\266\003;a\002\243<8Za\311\203V\2403C\345\242%;,\245v\260o\355\356Zc\354\317\374\236\207\277\366\324\237e\372z:f\332zZ3\235O\237@\200!<NG\345\330\315\260\022\262\252x\003\302\3665{\306G\203\220\306\202zCSU\221\034\324*\325\376\234\005w@\3066y\315\211"
+	.string	"\035\273\373@\305Wt\025<\357z<\370\343\232\2520^p\230re\333|\2031\227]\023I\246W\021\016\250\235\227\020-\2712\2267\361\024#l\327t\320Gq\232\013\376\207G\253\004+\037\026E\341D]J\004\201\276\220e\256d\344u\233\b\345\244\003Q\330,t\037o\343B*[\311\210\277\024\223\320&\372\276\320\246\205{k5\306\230\316\216\312\244-6jD"
+	.ascii	"r\251-\34182bD\275Tk<\032u@\216\006\032K\355\t\177q\343B\325"
+	.ascii	"\322' \360\002\242Qm\0032B[J`\nl\2602\244\f\003\366 \331\232"
+	.ascii	"\266\304\314!~\205\345\2611\216\007\237s\273(\265\274\005\242"
+	.ascii	"\273%c\311\006\366,\215\337\026\030\230\321\032h\275X,\005h\334"
+	.ascii	"\021kc27\263\203\220\367\034sP\324 -/\204A\006"
+	.text
+	.section	.gnu.lto_imuSetAttitudeQuat.95.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\234\001\035\r"
+	.string	"V\227TB"
+	.string	"Q5\035\240\304\2062N\324\002\024\233x7g\374\246\260K\223\2312G\347\034\217`\277\231\240k`$t8V\2010\275\223\026\315m^\377\377\337\013\244\307\t0S\005F\254\003\372\324%\331v\357\224\002>"
+	.string	"?"
+	.string	"C"
+	.ascii	"-\307\314\355\316N\310v\327b\003\333+\201\017\230\274J.`\362"
+	.ascii	"\352\320\316q2\265\225\225\210\006\330\216\335\355\250\210\207"
+	.ascii	"\237\241\177\330\271\321$~j\rv\327s4q\270\351m\027\260}\261'"
+	.ascii	"\2037z\224%*\332\2448)\b\373\222\335]S\224\375\327\317\335\365"
+	.ascii	"k'\377\372\326O\001|\204P\231\376A\307\356\206\021\221-+\214"
+	.ascii	"\021\266O\261_<,.\034\t\310\031\202\355\325\237\366K\334D\370"
+	.ascii	"!\032\2655\227\021\003\306\252\324\336\374\205,\204R\333\273"
+	.ascii	"\013\307hjw\027\370,\336\202\002\347\373&\257\n:\274X\247\321"
+	.ascii	"\034\2616\217\342+\300mw\364\321Oq\025\036_\365j\0208?\202!\321"
+	.ascii	"\374\350\003\001\031\036:\206\203w\346\002\342x\335G\302\306"
+	.ascii	"\253\020\241\263\340a8]\246\343\351.\025\177\0274\235\356\363"
+	.ascii	"}\235\216B\356)\312\033\310\252\034Q\222\215\032v \"Q\226\036"
+	.ascii	"`&\234\002L\033\002\006\304CI\242\2429jgNcF&  \203\021b\3502"
+	.ascii	"\001[\345\f\0066\030\030\342`\217\266At\314\357\302%)\326/\315"
+	.ascii	"\335\311\n\233c\260\271\026\034\273ln,-n\2166\211\324\277\232"
+	.ascii	"8nm\251\213\341\304\230\346fv\020\3628\206\ty\350\230\003\242"
+	.ascii	"\206\267\274\020\030\031"
+	.text
+	.section	.gnu.lto_imuQuaternionComputeProducts.96.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\370\002-\020"
+	.string	"\206\336fC\360\262h8P\331\347S\317\276\202\232\376\334f\233\363\271\033\232\306\302\r\2121\362\376\321\362\212\312\346\007#\217^\013\222\356\222\303@\315\204\003uX\024<\032<S\233l7\224U \214l\263M\366\336I\246\024S"
+	.string	"L"
+	.string	"T"
+	.string	"m-j\213\037\212)$1\320\200(`l]\302&`\236\245X$\323E\307E\346g\240\004:o\375\034\200\363\326\031"
+	.string	"\347\255\260V\207\277\021i\"\021\243!\205\217\314\364.\3020#\254\366\t\203d,*\306O\202\314,\312X8\270w\333\001m\017\264\367\020\017.t0)\2347\337\244\205\006\317l\005{\332O\005\037\242\265\226\231\331\273\264\376l\021\317\354\220cK\307\222\216\035\035+:6t,\350\330\356\330\317\261\334\261\333\261\332\261?\026\217\265"
+	.ascii	"\222L\016\026\277\324dn\350\371\221;\033\214\230\177\250\007"
+	.ascii	"\350-\3127?\350 \261\227\035\335[\022\307\370\334\357J\374\342"
+	.ascii	"Sc\206{\233\262\315v\237\243\340\026\033\217\366Ve\026\277\257"
+	.ascii	"\255\274\342w\207\226\234\231\031\276e\271FE\203\223\322\r\024"
+	.ascii	"\316\033\336\310x\370>\37662\310\304\3722\212\332t\231\211\240"
+	.ascii	"\246\t\021V-\005\256\323\213\325\271N/\226V\324\310K\225\362"
+	.ascii	"\\\023JR\025$x\026R'\225\207j\235x#\246\256LHZ\236k\265jy\242"
+	.ascii	"/\255\345]\332\341\370\260\263\362XKo\027X\347\363\022\016\351"
+	.ascii	"-\003\347l'\331\214\336:\360\214\355\243\203\304`jDo!X\306/\352"
+	.ascii	"\t\275=\031'0 \360\002\021A\326\001\002CwJ\201a\260\356\236\341"
+	.ascii	"~0\353{\356p=\230U\343=\230\217\036\303\2751\030\241\036\303"
+	.ascii	"\2751\2302i\034\310`\270Z<\351b\270`\\M<\351\025\246k\265\313"
+	.ascii	"\220\005\260\365\214\001\236x\233\231\274\326\230\342\273\360"
+	.ascii	"\233\307\376\031\327\252\205\200:G\264\f\2550\303\002|h\020\227"
+	.ascii	"\027-$\003"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.97.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\206\001]\017"
+	.string	"v]hE"
+	.string	"\261h8\013\231/O\343\032h\240BR\323\304\f7\322\206\272\246\314\334\217\224\017i@\\7V{\030\250FR\206CK\307}\363\016\tQ&U\002"
+	.string	"0X\357c\276\330\364\375\374\272T\317\337\333\356\275\245L)W"
+	.string	"N"
+	.string	"X"
+	.ascii	" \037}\200\367.\355\224-\362\002\006)\253.\302\300\b\310l\033"
+	.ascii	"lv\354\212\240\212\270\352\035\247\251\362?\302\325\273\357\303"
+	.ascii	"9.\304\347\226c\004\033\361\022\205\256Tn\264\023\342F\200\220"
+	.ascii	"\205\013qy\341\3412\317\226\260\225\031\032\331]\347+\354p{\267"
+	.ascii	"\375\300v\002\373<"
+	.string	"\002\026W\2511\373:\216\343h}\261_\273?\247C\247\335\236\323\234\246S\323\3770\321\201q\b\037\243c\0276\006\355\214\256\005\211\327~\332\323~\315\001\026\310\272Xd\260\360g|\3614\237\245NC}_\373\026\016Y\216\317\356*xg\004\337\273\352\300fr\025(\275Iq\222=P|\372\232\013\350\341y\336~v@\250\306\254\265g\360\256\227\371G\243\004\fW\002\331\323\253\201\037\r@.\035\007u\0270\266\3517'\267\331\330\335\006&n\203\342\307\274\263\312J\376\365\316_\361\336yz\361\340Mg\306\205f\306\312\321\001\030 \244IDTJ$0\205B\t\251\302\004\320\002)B\t$9\241\200\"\005l\272 \341\004\246\230L'P$\356\365\305\231_\361 \031\017N\216\372*\317\\H9m\261\315\251GX\3322\267\273\333\001H\273\204\224\177\205Tue\367\324b\324\3404v\342y\330\354\323\f\035"
+	.ascii	"b\b\270\352\034\206&\034D\261\260\253m\330(\265\343\336\020\034"
+	.ascii	"\030\020\020\bJ\202\301\334 \021X\334a\371\370\032H\220\030f"
+	.ascii	"|\331\f\345p\031\001\006vT\217Ie\b\254\222\244\030\005\256\221"
+	.ascii	"\257\304\253jdV0\367"
+	.text
+	.section	.gnu.lto_imuQuaternionMultiplication.98.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\324\006\215\036"
+	.string	"\226y\276D\240\326Jc\324\213\274(;\365j\254z\035\006\"\260\036~'C\024\222\006\326\210Q\320\002]\022\367\235ev\214\021"
+	.string	"\263\327N9^\216\227\343\346XPc#\021\310H\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\302\310&I\246\024\262"
+	.string	"\214"
+	.string	"\261"
+	.ascii	"\037\256P\231yb\335\n\273\331o6\234\035g\313\331tv\235m\347_"
+	.ascii	"k\3170\r\327\260\r\317\371\206q\370\256/vK\016\324A)@\027\205"
+	.ascii	"\200\234\024\001qS\002\300Q\001\360\226\2417\337,T\253\"\314"
+	.ascii	"\3729\206e\220\331-\203'\210)\177\244\251Ya2\347|\262\330\253"
+	.ascii	"\237E\242\036\2141\036\232\271\241-\0305\264\342d\331\332\205"
+	.ascii	"_\220\231m\3145s\246\365\240\233s\030\325\245\237\305\016\235"
+	.ascii	"\343\263\370\363\215\317b\311Z%\036\236\230<jI8\310\2002\347"
+	.ascii	"\004\336\204\311,\311j\337\271\345\fM\203%K\2019g\345\031\032"
+	.ascii	"\b\367n{\324\026A\313\362 ~s\263\f\347b9\316\275\262\234ke:\267"
+	.ascii	"\312u.\225\355\334)\017m\240\331l\251\313B]\366\351\262N\227"
+	.ascii	"m\272,\323e\227.\253t\331\244\313\"]\366\350\262F\227-\272,\321"
+	.ascii	"e\207.+t\331\240\313\002]\366\347\262>\227\355\271,\317ew.\253"
+	.ascii	"s\331\234\313\342\\\366\346\2626\227\255\271,\315e"
+	.string	"g.+s\331\230\313\302\\\366\345\262.\227m\271\354\357\262,\227\365]V\274l\357\262\277\254\274\254\007\304\004\351\200f\025O\346\f<\337\271\026\317\316\023\235\347<\253w\035?g\311\030\304\371\315\261pn\212\214B\233\327\374\312\345\342m^\343c\f\322|\346V43xcP\3461\257\222\t\232\305|\306l\305\334(\204y\313\251^\356r\030\241\031\221\027!.\277\263\274E\310e ?/\347\261\274K\004\225\026\276\377S\2276F\026f\362J\305\367\356\273\350\244\307\b\361X;F\364\036%\357\377\0372\006\315\300\254C\036\tE\305\234\243s\2779gV\215GF\002\303/\205\305z\314g\321\357\022\361$\n[\231\274\322\0165\2707\347\234\362%Z\367\346\234\263Ok\r\303\006`7W+\006|\300\b\234\300\n\274\300\f\334\300a\025\304\300\"|\371\252\274$\225\227,\004)1\013[\3000\n\023\266*H"
+	.ascii	"^\330r`\001\b\341\013\f(\305S\256\256\b_\3000.\256/\340\313p"
+	.ascii	"\2727\237\366S\022\"\257\354f\205z\023\253?\035\312\351OMw\n"
+	.ascii	"6}\246m\315\007\323\227T}\351LA\245/%]I\210\364$$\274Qxt$F\237"
+	.ascii	"\372\221\260\350FD/\032:\321\325\207.\323\2666'\364#\0360\304"
+	.ascii	"\030q\225\263&T\017\272\320%\21718\347\366\346,;\002z\320{UF"
+	.ascii	"\026Z\3779\320{wc0\353>\377\371\235\214A\254\367\334\347\277"
+	.ascii	"\033\205W\357\371K\333\332\214\261I~\250Q\\f\315I0\241\224\224"
+	.ascii	"\024\024\322\034 \003\t\204\210\332\021 \235\203\314\310\005"
+	.ascii	"TY\206\032c\343\375\211\364\224j\332F +}\241\346\316q\033\350"
+	.ascii	"t&l$B\263\006\212>P\026k\344\f\276\022H*\f\0210\265Q*\315\233"
+	.ascii	"p\224\330\\fib\347\024\344\326)\334\303y/\310\036fy\f\344\337"
+	.ascii	"\341\032\372~\351\360@CO@\361\2536\004\235\306\"\223\3676]&h"
+	.ascii	"\260\005\016]\032\"\3411\370\026\226\244\233#\354\252\272e\336"
+	.ascii	"\030\275\246\004\245\005\277\335\247\2551\357\273\322\321\004"
+	.ascii	"\333\216K\032\036\333\224!\tLm\344f_\350\236\334J$\313\0262`"
+	.ascii	"\0231C\0066\0013\344\300\226\310 \244\224%^\212(\251Xo\377\210"
+	.ascii	"v\013`V\341\004\2658\374\037"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeTransformVectorEarthToBody.99.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`<\006\305 "
+	.string	"v\377\320G\240TN:\324\374r\343\306\275\316\025\374S\360N\315\242\350\203_\271\351R\023\036.\261\025`\207\265\033\333p\307\215\211\3167\007\333q\026>\205\327\341uz\315\231\273\321,\337H\355v\377\335\375\377\271\0173kw\2222\005\273"
+	.string	"\251"
+	.string	"\306"
+	.string	"\356\311u\214\\\303\3105O\256wr\255\223\353\234\\K\271\276\\\257\\k\201\031)\037\304\024F\334\234!\342\274L\270\334\217\026\272\246JC\325Mo\253\325\206\336\260{\346\3227\307\214\351\350q\331=\315\251\262i\233\326p\317\355\304\022\215\rr\276\351\360L8$`5\235\321\245k\033t\216\230\313\204\354\f\205\2259'\001\315Y"
+	.string	"OsER\327\326\030*\243K\3238\370lf\007\266\020=\346T[r\022OsV\323\035\235\346x\232\243\323\234\273l*\252\266b\372\316@xh\3332\347\f^\205v\351vY\265\206\302\204\211y\351\356\f\3149\275ab#\324W\333"
+	.string	"l\003m\335\2222\253o*$\310\325\017\037\021\364Myh\361\346\374\3220\253\016\335\201e5\323\234\263\264V\3034g\325\322U\270\260\032f%*/\340\306{\331j`*\347\234s\237\302V9\347\234>\231-\327UrM%\327Sr-%\327Qr\r%\327Or\355$\327Mr\315$\327A\271\006\312\365\222\\\377tM\255\2444\324I\352\246F\3224\325"
+	.ascii	"r}$\327Fr]$\327Dr=$\327Br\035$\327@r\375#\327>r\355\223\353\036"
+	.ascii	"\271\346\221\353\035\271\326\221\353\034\271\306\221\353\033"
+	.ascii	"\271\266\221\353\032\271\246\221\353\031\271\226\221\033H\232"
+	.ascii	".\365\336\005\264\215C\230\347\036s\237\342(\344\241\226\035"
+	.ascii	"\346\374\002\300;\314u$\356\256;\357B\b\364\311\356\232%\352"
+	.ascii	"O\327=\250m\024\312\377\271\373\246\214D;\201:i\322\345B\001"
+	.ascii	"\317\214\3035\007\213\252\357\377]\333\324\365\373\\q\034B}\351"
+	.ascii	"z\255\2419\021c;\330\240\270\t\235^\365\233\001a:\325o\206\203"
+	.ascii	"\351S\277\031\033\360R\177Y\227\221\b\006|\324_\206e$\202\001"
+	.ascii	"\017\365\227Iq\372\357O\013\224\t\234\223\0224\246\377\336\304"
+	.ascii	"@\225$a\342\002\374\357A+=b\004x%a\"\t\332\357\277/\375\305\221"
+	.ascii	"\b\266q\326\033n\240D\314\2037\347\224\032r\365\273\336\320$"
+	.ascii	"/!N\2042\322\2766\316\001\031\224K5(\006\265\025\360\002\326"
+	.ascii	"U\320\002\204\007W\022\034\004'\\1\300\nZmU\b\002}\316\242\320"
+	.ascii	"`+"
+	.string	"h!+k+\330S\373R9Of\036\225\"p_\007\263\322\261pI\372\025!hH\257\362\025PcA\270\2248:\321\225\214.\363\243\252\027\335\250\350D\305q8t\242\353H\024:\320\207\202\276\273\320\201\212\301S=\350>_\306\341\317\345\201\244\336\364\237\270Q\350s\236'\371\356s\355\271\314}\0370e$R=\370\036\341\316o\316\363]\022\235\357\276s\241\234\353<\b\3479\377)\216B\234\373\264\215C\233\337\\k.os]q$>=\3525\317i\202\246\205\3461G\372\352\2309\215\314{\237\371\200\003\032E\346\033m\250Q8\245\214%\247\002TRP\222\2449\340\002\t\246\250\266\001\021P-T\254\202\232\226U\315\001\"\322\235\334`5\203\225\352\2223\230G\207\234\376\333\326#\310\034\273\315E\211\032NeA\370\272\016wxTF\371\362\252>\017\\m\351\211?B\222QD\363\007\321&\245\245"
+	.ascii	"\t\334\222\257\343\273\370G\274\375\267\255Jp\017\035\3070\177"
+	.ascii	",\254\b\226\265\217\340\353.\317\2608a\037b\373\004u\304\370"
+	.ascii	"\005\346}\263,\016O_C\202\2428x\370t\300\f\326\273\2150\240\370"
+	.ascii	"\r@\227\233\202\214\210\250\031\327\207\262\f\363\356\306\017"
+	.ascii	"\032#\265\020e\013\220)\261\307B\001\374*6=f\310\330v\313\336"
+	.ascii	"\352\332\241q\257\034!\265-x6\357\250\302\222Zt\342\017"
+	.text
+	.section	.gnu.lto_imuInit.part.0.123.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"}\b"
+	.string	"R\21788Po\322\001\340\204\2653\212+a\326Bv\366\006#\233g\035d\342\tX\267\316\243\336\210]&#\n\361\004\221 JPQ\255\025\333\331\342\024\352%>\030\255\330D\356\224\002>\230\336\234[\207B\363\034\266/\203\b=\214:\256\263}\3316A\006\326>\243\216\223\337\204\004W\021!-\270\254\223\332\024\311O\201\275\3206\345\347ySb\266\341\257\325\224\033b^4tCUe{\003\375\024\221\235p\326\310\013\217\027\234\016\217\347\321\306\310\200?Y`\305\345\205CMPU\326\353\327j\312V\204\231\201\221\335\217\032\232%\211,'\366W$\033\303\036\217b\233\004\342\222\rs\226\311\276\325\342\321\222\331]\371\250%/]\341U\362\277:\300\te\272\006\240B\016\t~m\030v\327\034\221;\336\266\202m\220m\225\021"
+	.string	"O\023\030\027\314V\224\3003<@\024\fs\205\2730aqF,\352\234N\013m\246\3544"
+	.ascii	"\\{1\345\264\234~m\031\003"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.part.0.125.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\345\002\355\025"
+	.string	"F\351\214E\320\330(\035\240\271"
+	.string	"\036h\232!\032$e\336)\212\260!\f\334"
+	.string	"fe&\335\001\207\265d\375f\255\377\212\206m\254\330\3726\352#p'\200\307h\200p\242jdF\007\320}\226R8\270\017\"\204l\"eJ\001y"
+	.string	"o"
+	.string	"w"
+	.string	"4s\356h\"e\316\331\202K\213\276\313\234\333t\227\334\013t\227\366\213\330f\305p\313\366\362\231\217y3$\307\n&c\346\234\244\313\355\361\326\275Nr\253_\313O\340\"\2128\272\356y\020h\377"
+	.ascii	"$F\021G\033\357T\034k\\r\n\276L\021c\003#\210\030\032S(\027\032"
+	.ascii	"c\2725\243\n.g\316y\333\265\305\bS%\360\317\2030\347\364_\262"
+	.ascii	"\233\346\266U\330\256`\257\027\007;\023*\275\350\333>\240g\313"
+	.ascii	"\317-\266.]\036\357\307\315\345a\177\257\335\236TwR-95\307\251"
+	.ascii	"w\325\372\331\177\001*s`dN\030Af\246\016IE\310k\277}\177\311"
+	.ascii	"\225\3706\207l\277\306rN\214\211\177>e\314\263\b3\004\311\227"
+	.ascii	"9\347\350\322\r\276\323\356\323Xv(d\325\317XO\202\202\233\315"
+	.ascii	"1\206U\355\0379\222\326"
+	.string	"\223\240p\307\351\344vX\236\005\203\206\r\033\272K\271?\363\343s\316\311\211:no;\200\035{Q\267\313\255u\205\f\246A\366\255\374\n\207\016\036<t\227\273\257q\331\353\234\323\265\313\343\321uC%]bZ\306~\225\373\370\307\007\342\017\366\261Ow\251\373@\246\205\214\354\245AS\244\030\204JL\215~m\223N\2100!}\317\241\200\337\234/'\177B\302\007ri\024\250\027/\035)\360\264*\231\302\020\224`\332\321IE0\355\254V`8be@\245\301\204:eX\245Lax\242\024\300%\006'P'\322j\204\316iG\004)u\002\201\"\225B\025\211\301\215\301\022\246\220\264\002\301\220\244_\036\264\237\005\020\221\333ka\336\362XT\273\361Bz\253\334\35055\033^t\364o[\330\b\364[{\002\005\355\001\242q\213q\335\001\265-\\\320\213\336rc\200\306\033l]\336+\300\221e\206\304\351\272\277"
+	.string	"\363= \200\002\031+\335\006?\022\204\313\030L\016\372\013"
+	.string	"F\361\363)\232\227BI\216a\342\3726RWa\235co\344\200\231\017Y\32448s\035N\261\375,\006\314#h\373h^\343-W\301\222q\013z\334\256I8~\340\376\363\307\031\273\303.\211\3720\377\265#\261$"
+	.string	";\264pv4/\204,\370\n"
+	.ascii	";5^\340\361\370\274\331\361zI\221\263\206mM\331e\200\324\336"
+	.ascii	"\271 \346\340\243\307\027\234\352\351p\213\265\317\t"
+	.text
+	.section	.gnu.lto_imuQuaternionHeadfreeOffsetSet.part.0.127.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\276\003\r\027"
+	.string	"V)\217J\260\022R:\360\2154x\021\275\316\225\232[h\276\321\207xA\357\316\230\262\203<\304\215\240\013<\004+\233\367W\373\375\355?44\316H\267\341z%\t\214`\202\372%\353\005d\210\211s\215\371P\314;u\205`\373d\023\271S\nv"
+	.string	"t"
+	.string	"|"
+	.string	"-\\&\331\216\304c\231NX\177~n\344'\035]x;\022\317\253\257~'\004H\fRk5pj\002\260\323\223\007 O\347S\310\323\365\215lvi\337\354\362\364Enq\261\375\330v\213\313\315\270\013M\370"
+	.string	""
+	.ascii	"\016;\270(\326*\234\235n\211\343\276s\304\371\323\007\224\373"
+	.ascii	"\236\3701\030\004DG\017'\240\020\237(\037_0\265V\303D\334\364"
+	.ascii	"\266\021\330>`\217\n\002\272\3315w\310;~\254+d{:F\247M\350t\t"
+	.ascii	"\235&\371\323]\322\351\021:-B\247at\372E\247I:M\351\364H\247"
+	.ascii	"\227NO:}\225\021\230\025\373\325\352\3235\244\216\240P(\256\364"
+	.ascii	"3\375O_\373\276\023\361\311\366\341\216e<a%zq\030\267\017w^A"
+	.ascii	"\324\231c\005\260F\001\330\251l|\n\351\222\251iiI\246;\251\274"
+	.ascii	"\036\252\030Wz\320\017+\343m\256\\\222-w'h\214l\271S\253\307"
+	.ascii	"\025\233tE\326\246\251\231\367\215\254\254gs\260\025\331\265"
+	.ascii	"z-\271\260}\r{\277\235\315qL\2756\001VPG\373\r\033\344\276\214"
+	.ascii	";\351\256U/\005\361\036y\265\352Vv\307\025\020\325S\261\233]"
+	.ascii	"\236\373\335\0350\325\373\355,\\*j\356\251\260\354\233\3170\021"
+	.ascii	"Vk}\361e\034\252\346\023\235ZC\316\274/\207<\375\002\267\244"
+	.ascii	"\252~F\301;3<\313Af\232\206e\303\rm\246S\301\206v\201\302\f\003"
+	.ascii	"m\346f"
+	.string	"F\203\2233cQq-C\r\316L\247V\303\231\225\037\353\n\371\304\243\314\037G\306\326\203\355\330\032F\267;\357\307\335\241#\237\017MuI\330d\355\005\347\332b`\262\263*\253\250\212\267\271\006\327\362\361\203EQ\267b;8\326\025\204 \255b\261d\355\007\347ab\354j\307\255\"H\210\211\211\362q\351f\227Q&\311\332\023d\346}%\001J\250q8\345\220r\002\022\242$\222\322h8\220\002\221\271\252:\0210\275D\024\bU\250@\323v0\004\353\"\345vC\372\243\025\200c\022\225j(\0259NRT6\377\226\213w\036\346\212Va\341\221\007\004e\023\313U<}\260\344\312VS\035ZCB\300z\254\303\"_I\377D\027^\"-\200ah\023\205\205l@\031\260\307\337v\t&\256\367E\302\332&\257\n[WPm+\210pP;k\234[ \240\250\314\331'\241}]\"\262K\b\277\005\354\205"
+	.ascii	"S4PfFu\257\200\306\272\3703\036\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\314\005\035\026"
+	.string	"va|I\260\330I:\f\b\220\303%\037h|,'\004\241a\211\204n\031;;&"
+	.string	"e\335\037\252?;\206D\354:\037F_\276\330\215O\320\031\201t\306\300\267\276\370\320\343\242\241\320\033\215\301\220\253\353m\211\371\270\202 m7\271w\nb"
+	.string	"m"
+	.string	"i"
+	.ascii	"B}\037U\300N\220\017P\337\252\342\200~\204\254\317o\330\377U"
+	.ascii	"\2743n\375\036U\346\245\355\351\237W\024G\236\276\226j\273\024"
+	.ascii	"\273\023\244s\033\366M\340k\330\377`\316\237\340\364\257"
+	.string	"\352\rn\301\217\202>\220js\032\004Ne\371\247\343\375>e\257(^\031\177\377<^\320\327\275\367&\350\357\250\377aU\001\377F\364\253P\021<6\304q\330\277\205\022\323\322\212$\020\317a\177#&\243\034\023\322\022\222RQ\022\013\233\323\321\305\207\353\260\036\372H:\364\2658\364\217l\350\033\321\320/R3\364\2630\234\311\205~\020\013\207R\241\277\205\302\247L8\027\237\347yJ\350\377\210\320'R!\364\261\352\203\376\020\242_q\320\027R\207z\354\233\032\334\030\330\002\266\027\356H\236\027\206\225:\036w\244\315\343\030\351\361\314\216\013\037\225\237)S\0160c\312\030\030\023f\f0#s:\366\306\233\216e%m\322\351\2703;\022\347\305\264\274yq\216\322,1\316\252\234\027#\365\243\344\372NT\364\233\034\365\273\214\372KR\364\225\024\365M\024\375$'\372[&\372XJ\364\251\220\350[\241\367\336\007/p"
+	.string	"\301\271\246\262\266\274\032\206\2155\246Z]\215)\325k5\206\2318\032\032\246O\364WRQP\341\315"
+	.ascii	"\317\374\204<"
+	.string	"\004\206\270\220;\221\326\300\300rz\205\334\225!{O\024\200\223T\324\0072\310t\244\324\007d\"\3127\220\217\304\177<#g\243L\0263q>\216}L\237(\205\312\322e\345B\343\034\215\207N\343\256\fq\2501\020\314\211o\2224I6\016\320\002\241\262i\016\021\200\220\b\021D\321H\334\224v\240\220'\247ooH\343E\324\211\276\2714R\313?(\t\251\021\b'\005\247y\342\255\243\233\256\371\231a\2354d\254f\330\246\202\223\350+\367$\255\243Q3\350\024[\354f~G\017l\302h{\307\023y\346\335\203l\273\263S\343\335x\032\336\326k\373\336{\"A\370\224\b\320\343\250g\306\275N\375\325Y\366Zq\312\327\277\226\f\217\246'\356\021\036^%p\rs\340\363+\215\257g\336\003\017\031\347os\327\n\315\357\202A\304Tg\207^9\230\302\204\337\327\030\336\017\326\324\035\356\370\r,\006\b\365`\251"
+	.ascii	"y\031\01697^\341\001\030\356\212\302\001X\005"
+	.text
+	.section	.gnu.lto_.refs.8c630cd0d265f140,"e",@progbits
+	.string	"(\265/\375`\030\001\235\n"
+	.string	"\326\335J/`K\223\306\330}\377\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">w\034z@\377\027\315\207\0210\202\200E\377\326\322[\3336\351ovoB\b\331R\246\0247"
+	.string	"?"
+	.string	"A"
+	.string	"J\177t(\252F\023\243\237\351\214p\013\341\366\342\326\301-\203\333\211[\313-\201\333\312-\3056\262\225\330Fl\037\266\016\333\206\355Z\225\255\2636\266i=\333\327\211\232$>\224\021h\037\320B\320:\240uL\315t\323\361h\007\016\033\032\253\206\206\232\201\241b8\365\202\205\245VXK\341t\302\251\204\265\017N/\326Z\234V\234R\254\265\254\225X\253\224:J\031\245)K!\226F,\n\251,T\321\007\2132,\3724t\003\027X\314\016H\002\366*{\305"
+	.string	"&#\261)b\217\262F\331)O\030/2\207XbF\315J\230}"
+	.string	"X\210\261\f\210\256\3106\020e\";$R\230\205A\254\342|\2246\246\3147\207\254\201cZ\372r\201\371D&\363\246\367^{\242\221\021\231k\255\2636\255\0250>\227u.\333\\\366.&H*\004\332<\232\032#;\300\030a\346$\r"
+	.ascii	"\220\233\"\214\313\212\234m\261t\021\277\201\332i\265\200\305"
+	.ascii	"R\273X\272mO\253Y\005{\267\226\3318\253\221\002"
+	.text
+	.section	.gnu.lto_.decls.8c630cd0d265f140,"e",@progbits
+	.ascii	"(\265/\375`uI\305C\001z1~yV LQ9\351h&\370T%\001^)\t<\201\247"
+	.ascii	"&E\260q9\030\343\324P\253\205A=*\223\t\357\226\347\017u\327$"
+	.ascii	"\27647\265\252\254\366\211*\261\325\225\215^\306\314~\2752\034"
+	.ascii	"y\247g6~\272\332j\312\376uvy!\325\346\234\222f\264+!{\313\235"
+	.ascii	"\002\233\006\226\007\255\007\225\253\032UI\336i2F\254o\262\223"
+	.ascii	"4\024\213vU\2013j\3121\266j\206\244JZKi*\035\245\247\264ZMv\262"
+	.ascii	"\317\336\310F\233\222\354\"\375\302\"\307|\250|Y\251s\376:E\254"
+	.ascii	"\255\206\236\212r\024T[\033I\366\221\266\262\3107\354B\312\232"
+	.ascii	"2g\244\320\227\0369(C\267\"\353\321\211T\215\3167\035\263\032"
+	.ascii	"\204m-\256\357\233\r\376\337O\332I\223\325d\2275\223%O\312\232"
+	.ascii	"t\217\241\250\242\034\365U6v\326e\255\244{`\371|\221\331\330"
+	.ascii	"\022\224\245\254n\007\276o+\370}\206\337d\370\315\004\277\221"
+	.ascii	"\340w\030~\363\300W\326\243\363\235\205\3371\360\273\005\376"
+	.ascii	"\233\310\220\260.]S};\f\251i0y[\323\367u\016\376[H\007\t\232"
+	.ascii	"s\323\"\325@\220l\231\222\037p}_\331\374H\022\262\243\006\252"
+	.ascii	"\211\017\260\344\213\247\033\r\326=:\350-O\013\033}\273\253\275"
+	.ascii	"j\362q\375u^\0242\247\005\341r\f\322\367U\016\257\3109\347\372"
+	.ascii	"\270\323\347\356\356\356\256>\356\374\233k\213l\313\227Z\337"
+	.ascii	"\336\352\336\321<\336[\255\343#>xPTo\335\234\237j%\300P\255\004"
+	.ascii	"0\343\210<I9\357\353\027\374w\216\326\362\241\\\262\245\357;"
+	.ascii	"\200q\267\241\250\242\f\003\n\306\330Yk\365\325\335,\332\025"
+	.ascii	"\005-\316T\301\3208j\262\265\372\306/2{\360\200\204\353\224\221"
+	.ascii	"\343\342\274\257T\360\3376h\370H\311E`\364\035\361A\323\350\026"
+	.ascii	"\375\242\312i9\340\211\036e\316\310\377]\243gtVM6\215\306\232"
+	.ascii	"\003\243\255\362\214\345\214l\032}\325Vex\2249#G\334\210\373"
+	.ascii	"B\206_\223\340\256\352\0305\231A\313@\022u\230\236*R\372\276"
+	.ascii	"\206\341\327\fN{wW38_{\340v\321S5iAS}\304\007\267\307(\271,g"
+	.ascii	"$\221\320\036'{\360\364}\325\201_-8\353]\265\340|\275\302\177"
+	.ascii	"KY@\204\264\021\243\243\372\thml\316\225\276uU\317\320SQ\316"
+	.ascii	"E\346\224\r\325\307\232\354\247~\252w\235\253\034\220\373d\f"
+	.ascii	"\007\017wm\371\365\345\354\\\227\325'K\013\032\226\276\257U\370"
+	.ascii	"u\216\0357cy\352\236\212\247&\253\236\277*+\335\033\231sT\fu"
+	.ascii	"9d\346\314\365f\254\352\251w\352\262\312\001\021\001K\033$"
+	.string	"\017\036\210P\300\360\340\373\352\002\277\036q\265\253tj\222C\255\363\272\246\316\271\371\204\314\310\2343Q\255\003\002\205\325\367,\260\tr\256\034\316zwW9\2347\342\242zt^\2109\250G\347)'\003\034\225\205\255,\016\034! w\310(p\376\332\246\272\251s\274\2676YJ\372\376\225\315\353\334_\337T\263\2735W\316Q9\347\n\232\f\335\326\262oP5:\233\253\036\235\030T\243\263\256\021\361\312\306\350\274\322Bf\265\2343\221}\333\322\"O\337V3&\210\313\207\221\027}\353\0248\265.Y\236\274M\321\"V\257\270]\341\262\0257\344\257e\252\230\232\246\206\251g\252\231J\246\202\251r\025MM\3261\177\365R\277D\325+olu\n\026\263\2621u\313\335\252\234Z\035\303\342E\231s\366\200\344\301\203\207\332#O\033\"\024\334F\326\2433\251\032\235o\001\237\t\037\305g\001\277\207\377\001|\016\340g"
+	.string	"\377\004~\n\370\202jt\376\325\312_\311jYm\263SU\\Y-gd\206V3\347G\217\276\377\253Ze\253U\352ZM\326\266\277N\251T~\2219\267\225\241\361\350@J\216\263(w\033\342\345\334e\307[\316\371\325\354\027\361W(\365\254\266U\344\335\206\242\220y\310O\020)fL\2269g$\017\036<x0\261\260"
+	.string	"\031\362sk\256GgQ5:_\323\256!J\376\340?\370\030\377\304\277\370\215/\250G\347\255F\347\345\352\321yd=:q5:\255\035\223\001\"\277e@\357\357\007\330\020\374\225\247\245%0e7\320\001\005\r\013~3\001\277\315\360[!\020\374\255\002\376\357\327\337?\177\013\375\035\3647Q\213%\331\017t\321\217~s\370\177M\315v`\314\364\375\215\302\242\270@\257\360\241\377\206\241\320BV\350\022(|\303oZ\340\267\n\350\300\003(\334\3507\037\020F\256\214\265G\301v\240\216\tt\024\232\004uP\370\371\3376\177\035@\265\340\212\371\333\366\224\335\300\337\375\367\b\253\201j\301\214\f$\320\"x"
+	.string	"\205g\370o\t\376\216\262\031\320SI\370{\004#T\022\177[\331\025P\240\370\255\207\277\252p\342\267&\220\336\241\n\203\177\370M\243\277\362\264\374m\001<\377\365\230\277\323\377\363\374\355\201U\341\267)X\f\374\226\207\302\220=\301^\340?\322\177\017\264\220k\360_\252\277\252`M\370\033X\017p\336\177\331,\002*\232\022\376\016\301R\340\257\026\324\001t\n\267\313g\233\204\337V0\001[\342\257\034\220\376\346\300\222\260\022h\020\274\303\021\360\333\021\376\312\253C\037\300\177\231\374\177\363\177\356p\250\254\251U\rj\002\204<"
+	.ascii	"\377-\376u\303_5\3745\303\337T\376\337\337\304\372\333\315\337"
+	.ascii	"q\376\206\363\367\233\277\327\374\335\346\357\271\277\225\177"
+	.ascii	"\203\300>\340\357\270\277\325\374\235\306:\340\177\321o\236\371"
+	.ascii	"\353\177\367\337\376\027K\005\016\374"
+	.string	"\227\373\037\346?\0323\377\313\374\037\363\377\313\1772\377\317\034\350\277'\374\247\362\177\355\277\332\377*7\377\273\302o\033\360[\005\374\326\203\337n\360\333\017\277\315\340\267H\277\335\360[\r\277\375\371\255\371[\373\367\335\337v\177\317\371\233\356o\265\277\231\374=\366\367\n\177\013\371\033\354\357\255\277\265\376\236\361\267\215\277i\374}\365w\325\337T\177K\375M\202\277\323\277G\360\267\360\357\340\337\300\277\227\376F\377\376\375\235\302\337\276\277{\177\203\340o\017\374\235\201\277U\370\373\204\277-\360w\t\177\223\360w\211\277%\360\267\b\177C\340\357\006\374\275\200\277\211\376\366\340\357\021\1775\300_1\370\253\005\177s\3607\210\377(\376\317\375\365\303_\223\376\326\340o\017\177'\375U\205\277\021\3607\006\177\027\340o\016\177W\360\367\321\337\024\374\257\363W\336_\207\376\243\360w\321\337\346_K\370\253\006\177M\300_\021\360\327\003\374u"
+	.ascii	"\177\005\300_\217\376z\377j\377\307\371\177\342?\234\377i\376"
+	.ascii	"\267\375?\341\177\212\377`\376[pwww\367\363\312\376 \024\277"
+	.ascii	"\007+\004^\307\034\305\2253\344\250\374\224\323\270\260.\230"
+	.ascii	"\212\362\302\232J{\302\3120\225\346\205\225\323\274rQ\216z\272"
+	.ascii	"\242\212\312W\031r\232\027]N\343\302*\232J\343\302\232J\363z"
+	.ascii	"Ra\240r\243e\206\0264?\200T\270\251\250,#\206\216\247\253\"\271"
+	.ascii	")$Wf\223sUk\221\257\262\\\316\005\310Y\007\327\025\233\247\033"
+	.ascii	"\365\rJN\006T\333\023WE\346\2349\304\200\372\342\312Qr\307\232"
+	.ascii	"\345\246\222p\345\234\004\212)\307\3109g\017\216H\271\034\244"
+	.ascii	"\312\035{\350\310U-r\006@F\346\034#\347c\315r9\347c\316\331\347"
+	.ascii	"J\0072g\034ESc1b\344\254\205\024#\3538\302\265\310\271\325\334"
+	.ascii	"\274aM\245}q\211\200\233\2226\226]"
+	.ascii	" \217u\252\212+\217e6^W8\355\210\226\253r\316u\016\036\303\232"
+	.ascii	"Q\327\367&\371qc\323\302\352\373 9\370\036\371\211\322\341E\247"
+	.ascii	"\357\203\332\340;f\333\340\341Q\243\357\203\266\340[\304\024"
+	.ascii	"c$\n]\337\007\255\r\0312\206\353\251\007\234\276\017B\023\"d"
+	.ascii	"\355\f\030\345\031\220\327\344\005\322A~\256xT\240\310(\363\225"
+	.ascii	"\326\207\256\372\342f\245\357\203\232\340W'\365\372\360\321C"
+	.ascii	"xS9\317\320\200,H\t\276=\202\236l\\)\323\367AC\276\256\327ie"
+	.ascii	"K\017\260\276\267\013\231\226s\346P\343\354\300\023\327\367A"
+	.ascii	"Z\230\f\233\222\353n\325\344\345\221\306\303B\271;\206\216\310"
+	.ascii	"\214uR\005\tZ\333r\341\342\274\377\325\361\273\243\345D\220s"
+	.ascii	"\332\025 B\224}o\016\021\277:\034\020\326\343I_\013CM^\030l\232"
+	.ascii	"\022\220\3718d\205v\266g\231\257\256>\034\210\016\377W\313\246"
+	.ascii	"\301c\006\325\367\2773~o\374\227\306\255qm\020\265\371\222\346"
+	.ascii	"\330\027Y\226s&\342\301\341QR\243o\225\253Gg\207jt\336,\021\277"
+	.ascii	"3|\204t\231\205\365\r\300\305\372\275B3\306\004\252\257\025\357"
+	.ascii	"\307\034\035\231\276\007*\203_\317\\\340\030\233\202a\354\302"
+	.ascii	"\2702n\214\232\274U\227J\304\255\272/\220\030Y\222d\351\201\350"
+	.ascii	"\351\213H\020|\017D\006\037(\016\037(\013>\020\034\376o\213\373"
+	.ascii	"T\245\270\315\325\350\333v\237\372Jc\251rj%\312\336(\273\355"
+	.ascii	"\367\251\255\324\271\241(d>\236p\320\310\312\326\356S\263\235"
+	.ascii	"D\340\310\312\226\027\352F]\251{\254\311\373d\367\334\336\335"
+	.ascii	"\034u\237:\316\3529\372X\351\"+[\346\234\353\221\265 a?\027("
+	.ascii	"\327\243\263\216U\243\363@@p\036(;E\226}\017\304\003\367\026"
+	.ascii	"9V\215\235\233\201\301Y\231\356\322hz\215E\273\302lPv\224K,\231"
+	.ascii	"\2247c]\232M\323\371J:3\022\246\345"
+	.string	"\222\316\320\352\025+\307\226e)4\r\314\272\230\324-\317\364V\004\272\230\3245)\363w\0279m\246\267\252\234V>\322apf\204I]\007\177\343\271\225\323ylX\b-\256*\360\005G\231s\226c\315l\232\016PS9gy`vl.\177w\361\322`\252\234V~:zp\006\307\244n\331K+\247\357\304\261x,\235\255cc\260v\366\216]Z8Vi\347\3308\326\216\245c\353j\322\312\261E\336YZ\213\035\"\307\022\261JBhq\305\223!eNY\347\357\245\225\323vr\306\362\300\214\216I\335rH\212\216\2675\002\270oj\022\251\263$}\377\223\246MMZ7v\315\257uc\331T8UN-g,\r\234`-IRs\200\201\"s\357\177\324\360\177\222\340\377\200a\213\206\003Q\217\037Oi\372\376\247\006\206b\321,r\214\004(\031r\366\214-S\223\326L\2245c\243\330-!\264\270\302"
+	.string	"T\f\245\031K\346a:@M\345\247.\016\214\330\021\243q\247"
+	.ascii	"\361\302\003\337\363\276\340W\272+\034\252\034\020\021\216\260"
+	.ascii	"\235eq\242\334b\245X+\035\240\246.\320\245M\371\366\270!^\316"
+	.ascii	"^jX\236(\341\222\252\234Z\211\2672e\316H\273\305jy\\\221&J\273"
+	.ascii	"\305\272q\030zB\346\2533H\220\260\255e\030;\306r\261`\254\027"
+	.ascii	"\373\305\212\261]j\322n\261q\036\314)\311%\036\r\367\274\032"
+	.ascii	"\370<\031\370\274\026\370x\017>\266\303\307q\360\261\032|\034"
+	.ascii	"\246\255\355(\307\214U\337c\266*v\255&-\233M\246Y*=\340\214\261"
+	.ascii	"Y5KE\003\2346^X\226"
+	.string	"\366\312\233\030\222\347=~\201\177Ke\n\320\036\263\035{\246\330\344\020\024\261\252\036}\357S\207\357\363\006\337\007\r\276\217\030\374[\344-Z\313\211\300\254B\005\306E_{&\342\026)\005\244*\253o\006\325\350\274\317\026|\0378|\237)N\354\223&\230H\032\035Z\2148irF-\263ar\333\344qN7\307-w\204\330$G\362\330\200\023\353{\237\032\3705i\221\330#V\222P\265\031\271=\262\025\224;\004\335\t3\206F\337\333\331!5P\334\262\364\375\355\230\330P\f3\331K\314\026\341\321a\243\207\254\357}\252\360}\2440\007\325\350\024\362\306\354\306\224\276?\355\374\260@j\322\006\261G$\033\244\365\330\334F\031\304>Y\260*\247U\224\243\342\350Q\326)[\366\324\235\327\206\365\232\033\353a\277\254\217\232\264`\267`\026\312V\r\0353\344\354#\317\030\230\215ai\fE!s\326)'\327=Yz"
+	.ascii	"\252\002\333q\304\367\277\345\262]5i\275,\017\244\016p\330\255"
+	.ascii	"*\247\205\314YCl\\uO\226^\366\206\205\241\003\324T\tZ\336(q\026"
+	.ascii	"!Z\202\234\367'\034\374\333\255\035TnH\326\344\260:~jh\311i\351"
+	.ascii	"\373\263\f\316\361*\303\210\024\230\276?\273\340\327\344\341"
+	.ascii	"X\255\307\271aal\230\365\375\231\005\377l\303?\325\360;\2604"
+	.ascii	"\254\f\213U\345\324J\214\211cg\330\0325ii\330,K\303F}\221\243"
+	.ascii	"\034\022CBfv\336\237e\3702\211\242\"\306^Y\253,$\024gG\\\222"
+	.ascii	"\276?\217\340\237a\370\347\017\374\337\276\2600j\322VY*$d\316"
+	.ascii	"mUV\312Nu\200\2322a\353\216\262\314V\331\250~1tDf+ \261\261\272"
+	.ascii	"'\313\234\221H\036<\370\364\300r&\344\2747\363\340\337NY\027"
+	.ascii	"\026\206)+y\220&\027-4D\222\266\205=\"3\022\220\233\0279N\337"
+	.ascii	"\233v\370&\034|\023\r\276\t\006\337t\303{\372\216\212\027\224"
+	.ascii	"&}o&\367\230f\370\246\023|d5:o\036\3017\303\360\337\252\321\371"
+	.ascii	"\267zt\332!\021\315\330Ae\252\357M\033\370\035\264\3519\213v"
+	.ascii	"\205\327~\204)sF\326u\f5\331s\032\316\331\234\216\323tUN-?\315"
+	.ascii	"\300\300\016\271\246\311Rhm\211\307\306y\345\264\222\b\006\021"
+	.ascii	"\027a]\344X\301\277M\334\364\233\316J\n\031\342\346\202\341\337"
+	.ascii	"\254VS\317\320\271C\325\367\027\nw\232\337(\\B\366\311\206\030"
+	.ascii	"\267\276\267w\360\255\022\337\236\301gS\217\316\036\323d\336"
+	.ascii	"r-&\267\234\007\\9?\265\034Q\236\234\237\210j%@\255\004\270O"
+	.ascii	"\276\304\326\316{;\006\337\302\341\277\277\274\301\274_\210 "
+	.ascii	"W\220\341\313\025\217\276#D\274\277\234M\264t\331\351{\273\206"
+	.ascii	"/W\215\316/\353\321y\345\024\314C\326\243\263jU\243\263\335\372"
+	.ascii	"\255&\223\032\016I\304S3g\207Z\337[3\374\232t\022%\235\267A\360"
+	.ascii	"\255\027\256W\325\350\274\235\302\0019xY.\304\336\372\336Z}I"
+	.ascii	"\275\305\261a\343\324:#\306Tv\315\201\335\370\251U\003\316\216"
+	.ascii	"\026\024\210\241A\343\204\252\302G4\032I\260T\3058\263.\214\234"
+	.ascii	"\2418@B\261\311Y+\211\002,\313(V?\263~b\215\370\340q\"\354\211"
+	.ascii	"\362\344\352\347u\0251vf}O\301\032\276\335)\203\t\036\030jd\\"
+	.ascii	"\033Dd4|\f\351{\n\310\360)X\342\302\305\371\"\306\220X\227\214"
+	.ascii	"\272\223\352\347\013\267.60\374\350{N\005\221\222:\241j\021\022"
+	.ascii	"*\215\214\261\234\265\222\200\254\224\371\202\322\367\024\354"
+	.ascii	"8\217\347\361\204\252Q\262U\0078#K\222,s\326J\342@\224\"u\347"
+	.ascii	"\323O(7*n\312d\241 \013\327\271\251\247\216yW\355*2kq\035\353"
+	.ascii	"\016\300\343\213\034\032\313<\245#i\311\007\2170\346\236\233"
+	.ascii	"wa\356\222o^&\236\233y~\236\317\2324`\242\364\375\321\027l\332"
+	.ascii	"\271y\347\347\2319f\274I\322"
+	.ascii	"\367Gq\3707\227?/\bH\2301u}\177\344\206\177\244\206\177\323\316"
+	.ascii	"\264\253sH\310|\354\300\304\210\320\013\035K\034}\177d\206\177"
+	.ascii	"s\2169\347\212uQ\316_go\371J\353C\265c\003+\254\357\217\212\254"
+	.ascii	"\335\314b\256\231t\"\240\362S\221\013\314\320L4$E\\\364U\372"
+	.ascii	"<\255Q\343\245\357\217\272\260\251\305\334\002en\212\311\345"
+	.ascii	"\315\0273L\225\003\"\302\0222J\033e\306u\200\232*\241\314M\275"
+	.ascii	"\322\306\034c\252\271\262T\232mL/l\336\230r\3148\346\234\311"
+	.ascii	"\306tc\302\251I\263\215)\306lcvi\243\314\031I\024\003\031\225"
+	.ascii	"\033EW\313\341t\200\232*\001\212\231\306\\S\223\246\232#u`\252"
+	.ascii	"1\311\230h\200\254\324\271y\302\301\203P\035\03269\316\373\233"
+	.ascii	"h\3143m\310\037s\372\232f|\264n\200\221\352\373\243#\376M\271"
+	.ascii	"\2324\313`\273&px\372\336\216\007\304E\310\327\036\374\rK\374"
+	.ascii	"\roL08\215r\307\230\276\337\220\006\177C\031\374\r_\3607\304"
+	.ascii	"\341ox\303\277\271%.\355K\fc\342\372\205\230*\250\276\337\320"
+	.ascii	"\206\3157\023\013\321\2237\037l}o\302\375\347\241 \204\f[\337"
+	.ascii	"\353\326`\304\306b\364\275ye\210M\221*h}oZa\273\213\001\206\276"
+	.ascii	"f\033n\261\001J\006?;\256\360\310\301v\263\3557\237t\231\027"
+	.ascii	"\356\364\324\351[\337\210\270\311\0064f\213\362\254\3577\204"
+	.ascii	"\231NnR1\235\230jIZ9K\0033\035\037l\232\026\251e_d\024\217.U"
+	.ascii	"\354\3645\245\230Is\312\317\343e\251:\243\243\3577|\341\233i"
+	.ascii	"\377y?@\314\020Q\322\267\353\343N\023\355f\224\237\347Sv\025"
+	.ascii	"U\245\3577l\341\233g&\362\347Y=a\262P\365\375\006\033\370&\224"
+	.ascii	"\377\274\023\274\351r\322\3274\303-6\270\310\200\347&\n\2340"
+	.ascii	"\223\354\246\331o\226\265\221\226\353\252\034Zr\372\016U\243"
+	.ascii	"\323|\"\342&Y\213\251\201\001\323W\250\032\2357\202c\0361\217"
+	.ascii	"\230L\230\310\030;\333\252\310f,\271\311\204,\315\234\017%>-"
+	.ascii	"\222\314H*Ib\322x\021\203\225\225=3\347E\314Dr\251\332\356\322"
+	.ascii	"(\315\206\f1\307p\026\003\027\344&\271\325&vsLH\216\262\312\262"
+	.ascii	"\257Y\344Nl\214M_\223\310\265C\007F&\215Q\0276\177\230?L!g\034"
+	.ascii	"\335\331\236&@H\036\307;An\n\251M\274\324\371\350k\002\271v\202"
+	.ascii	"\340\234mYcB\201\261\331\341\350{\243(\223\313\3442\301\362\214"
+	.ascii	"\375\234A3B\326\343&\230\005s\305\316\256\257\371\205\233\264"
+	.ascii	"\361\322\323\327\364\352\242\3038p\230[5g\263.\336\030\234\035"
+	.ascii	"\322\334qs\353n\016\256\254\257\251\303D\003\2033\323\327\314"
+	.ascii	"At\005\215MX\337\333\335\355?\257*\271\342d\255\3575\220\321"
+	.ascii	"\372\355\335\3155ij]$HQ\362\321\307\355HVv\342\250\202'\252\357"
+	.ascii	"5\200\301\277i\303\264\321/j\224l\365Cu$\242\263dGX\337kp3\263"
+	.ascii	"L\032f\226Ie\3160g\230Tt\316\031tDj\224I3|\r=\360o\312\250IS"
+	.ascii	"\206yu\243\344\343PR\210\215-\313\234\265>\360\250\324\020\261"
+	.ascii	"\322\327\264\272Ph\264\200\322\367\032\262\3605\300\300\277\t"
+	.ascii	"\303|aV]0|\274\302lD\336(3\330\341g\020c\2720]\230Tb\260nN\335"
+	.ascii	"\244\032*\213S\332\001\373\317\353\305\tY\366}\2063=zL)\007 "
+	.ascii	"\2211\026\264\265\207J\206\031uS\352\007\315\022\037{\372\232"
+	.ascii	"\331\204\35290j\226\230P\346\323\017\033\235e\226\016#Js%\016"
+	.ascii	"\030\363x\357lZ\r1;\372\336=<420\220\365\275]]\216\3050\344\330"
+	.ascii	"\367\031\276\350\320\271x\272\030\331\243$R\005cy\347\027O\034"
+	.ascii	":R1\206\364\275\335\265\363\237'\224\207\313\306\033;\313.)%"
+	.ascii	"e\032H\206b\307I\337['C\r<g\316\215\201\227s\235\223\007\026"
+	.ascii	"\217\254M\316\214\030\356\246\025v\325\367\031\244\360{\253^"
+	.ascii	"\245\234K\327[\"@\345\274\005\344\314Q\006\371\341Ev\360\213"
+	.ascii	"\336\3408qr\234UZ\204\335\351\373\2427\374\353\246\336\271\271"
+	.ascii	"\306R\257\360\024)fJ\037\2651YI\374\332X\316\177\250\267M\233"
+	.ascii	"\307\2250\201/(\247\017\260;\266\276/r\202\377\273\3465y\327"
+	.ascii	"4\230\235\312\031\013\003&\030\b\027.}_t$M\232\353\204\f\032"
+	.ascii	"O\310\22321}_"
+	.string	"\204\003\277u\324{\346LoUd\266\332\300\204\256\313\207\240%o\312\350\364}\021\025\376o\2312lEO\370\277d\222\227\3145r^\361d\234\271B$F\314\025\373\311\330\314\327\234\262\006\r;3}O$\207\273t\271`p\346R\006\347\241\363\265\374\362\013\246\331\340\351\202\353{\275\264\325\216*Mj\364\275]\277\370\3173\277\350\314\271\365=Q\226,wK\226\033\247E\313\215\253\371\312\356\364\002g\252qe\345\350\033\3073\202\344\253\252\357\211\222\340\023\311p\273pn\327\311\231sErY]e\255\253\244\267\267\353\004\037s>\"\263\025\022\030#g{\226YK+\251\3468\362\245I\337\023\265\300\037\252\203\377k\345\037\361AM^+\375\002\211\353Xw\301\031\234\351&\345\206\221\276\037\232\303\277U\352ec\273[\275\242\300\205\2246\345\220\030|\267\377m\200*\246\016U\233\276j\311\253v\225$\345\234\345"
+	.ascii	"\263.\255\017?s\332\304r\337\017i\301\377\235\222\274S\332*\211"
+	.ascii	"\353\351\t\003&e\346tY\346\334\345\003\376\352\262%\325\367C"
+	.ascii	"=\322\322\256\223\017\214\320\235\355Y\016YE\211\362\270z\205"
+	.ascii	"\251@\255\345\301\377E&/\362n%d)\264\020\234`\235\355Y\26613"
+	.ascii	"\273Pj\3169k\345#\235\210;\272\263=K(qW\211\0333#}/\244\206\377"
+	.ascii	"K\226\274d\025\216\206+\nH\351\242\314W\371\303\205\244\340\337"
+	.ascii	"%\227\311o\223\337&\327I\347\234\363\230\017\225\257<\312\254"
+	.ascii	"u\225\364\337\356\327\211i&I\221\265\276\027\022\202\377\327"
+	.ascii	"\367\177\346\247\253\234s\226\211\314WPA\347__\315Z\223~\241"
+	.ascii	"jk\001\376\337\234\031\240\204\314Pqhr\3165\006\214\304\355)"
+	.ascii	"\307\005\331\224\3139\312\353(\202\027V\224\327\215\2514/\254"
+	.ascii	"\fSi^\371\030U\344\230\341*{\035\247\322r\316\020\025u,\301\205"
+	.ascii	"5\225\366\2243L\245e\254,e\006\253fd\251o\030La\006\340L B\244"
+	.ascii	"\350\t\"\272\002\3304\200\026~\303\240\320\270\241\205\3370x"
+	.ascii	"&\020\026\260`J\203>\264\204\242\t\305\242\317\251i\370+*\372"
+	.ascii	"\234\tD\005)P\b\354i(\n}@%\237\211!\212\"\212\022\227P\245\242"
+	.ascii	"\237`\320(\024\016\205>\305\324\350\324\023\002\323 \320\310"
+	.ascii	"B\2577TL\215Nw\204\320\227\372\202\212\303\237\017h\305\220\350"
+	.ascii	"\344\344\353\t\201\305\2373\201(\006\203\276\037S\352k\n\341"
+	.ascii	"\302\220\310\224\016\205>)|h\360\246E\341\360g\246H\205@b\360"
+	.ascii	"D\227|DT\305\b\277\237\357\207\205\323\220\304Pz&\020KN!\226"
+	.ascii	"\234\214~B#\t@\302\024m\026{KNAiO\270\344d\n\227\234,S\272$D"
+	.ascii	"\203'\372\002\260xY8\r\177\227\230:\331\013\261 \246E\340\022"
+	.ascii	"j\242\247A\t\365QB\213\306[\364\271/\365)\245h\021%\366\226\234"
+	.ascii	"@\f\365\320\324\027tjBQ,9q`\2414\224\300\020\005SJ\364M \003"
+	.ascii	"M\304a\212\242\320GD\021\002\030t\002\246A\343\t\001"
+	.string	"\350\220\372\214*h\340@\n&R\364\204\261\t\230\341\367\363\331%!\260\211\350\003\312\200\224\236G\"@\240M@\024+\234`B\3218\004\252@\211N\0254\001\323\342\004H\030\233\200\026p \005\023MC\"\t\001H\321%\2414\bDQ\034\222H\321%\" \016@(\001\205^"
+	.string	"\006}\300\024(4A)h\0342\025\001\320d<\2016\001Q\374~\276\237Th\034\222"
+	.string	"j2\236\370\375|g\223\361D\212\026Q\023\306&`\005KB\240\222\017-\341D\n\024@\213+\b}\277\242\337\317\327\373\2458\213\232\320\264\310\342D\257\b%\032\203\004\200\236\300@\t*\030\233\200\007\360\341"
+	.string	"DJ\3649\201H\201B\023\214M\300\241\324\227\026\177:P\034\372\365\210!~\003(.\371\202$\240J\303\023\2106\240\306\240/\003h\320\367;\221j \022\207$\320`\232\016\211L(\320\324\0274\376\202\276\337\005\251\357\004\3425\201\246F\247&\244\377\200DT\210.\341{"
+	.string	"\302\006 \204\260\302\347!0\200\003\006pp>\004\006\210\020\301"
+	.ascii	"\020D\340\203 \302\246\275\"\032\\\022\216@D\203\306\t\240J\306"
+	.ascii	"\024\230\246\276\2434EQb\n%\037\312\204GPS\264\230\"\305\360"
+	.ascii	"La\004\235\366\212+\240M\300\024\247=b\232\372\214\376k\3417"
+	.ascii	"\274\200\261\t(\224\002U\352\365R\242\016T\3420\375\241*zN)x"
+	.ascii	"\033\250\034\250g\002AD\203h\001\212\275\337\317g\246g\002q\200"
+	.ascii	"\364L \212L\251\257)\204p\330\3244\374\001\240\251\026{=\247"
+	.ascii	"\024F+\200\304\324wB:$\016\245D=\2373"
+	.string	"\201H\177FbZ\034Q\354\255@ScS\206\026~\303`\257w\246B\343\360\327\353\371\020Q\241\013\303^\317\247HD\213Fa\257\207\225\204\300\026z\275\263(\004:\025{=\237 \332\353\361\322^Z\004\006\213\316\004\242\210:\261H7PB\211>\246\342\006!\212)\220\205\020F\341\322\006+\214B`p\003\017@\350\201\020\302\212\020\250\2221\370\023\002C\020\213\306\020\013HW\240\302\240OHDS!\260\247\344C\211L\251S\257W\201\n\224\350\324\353\235i\021\030\354\365N_\352S\352\365N\364\005`\261\327;[\370\r\203\367\207\022{?)Ph\202\220\204\024(\004\236\3044\205\237\320H\202\222\0175\361\373\215\260\241\330S\201\226\370\375|XH\202\222\017%\236i\261\007t:\221\002-\201:\261@\3213!\205\023@\350O\350K\213B N{\0300\341\n\201)\b\213\277\023\350T\264\305\036\211\021&"
+	.string	"\221\030a\002\357\374\215"
+	.string	"\3323\201(\032Y\340P\354\235\240TDD\323\242\257\351,\026Q\242\222\222\317\007U\341\013\2360:5acO\005\252T4\262\200\213=\364\007T\201\226(\032Y"
+	.string	"B{\250\023\013\024E#\013<\324\211EZ4\262\340S4\262`) \242\367\373\371N\027|&H\224\030\341L\317\004\302\350\324\324\033\022Y,\375~\276\020E\"\252\002HTJ"
+	.ascii	"\3323\301\301\007\034\200`tj2*\242\304\237bo\003z\302\350\324"
+	.ascii	"\004t\246Ac\0215!\034\002\323\037\232\242%\214NM\032\320\236"
+	.ascii	"p\t\030\364\365\210\303\242\020-\016\t\227\200\301\021~?\037"
+	.ascii	"f\241\344CM\370R\237\022\217XL\321cZ\0022\365~?_\020\321\307"
+	.ascii	"\364\273\250\322\220\204p\b,\002U\240\304 \"\032\f\002S\234*"
+	.ascii	"P%\233\366Ft\020\364\251 \242\251\320\204%!0\350\324\344;\361"
+	.ascii	"\373\371\214H\224\030\341\367\363\235\350O\210\201\264\350C/"
+	.ascii	"\220\216\240\204\246>%\247\025\202\350\3577B\021\310\241\330"
+	.ascii	"\363\245\276\022\302!05\006\207'\212NK\031\3223\201(:-\205\030"
+	.ascii	"\00274\221H\203>\263\330\023\016\201\251\3577\274@\321iI(\365"
+	.ascii	"\005\255p\030\264L\301\240U\352@\tE\235\212>J(\352t\002\b-\022"
+	.ascii	"\215C\022JB\343\220\270\024\3444Tb\272\251\357D\223Qx\026\323"
+	.ascii	"\237QiHLA\203p\b\024\022\321\324g\034\301O\332\033\321A*\004"
+	.ascii	"\372\004\207C\t\364L\264\t\230\n\215&\214M@\r\305\336\0220\205"
+	.ascii	"pH\302\330\004\004r2b`\013\275\246\237\322\231\366BH\205@\243"
+	.ascii	"\017\032\\\022\372z\301\240\257\251\b\344\202\217h\203\301!\361"
+	.ascii	"2\375R\240\223\231\366@\020\221\n\201>.\370X\330\"j\f\372T\234"
+	.ascii	".\270\320+\\h\026.\364\013.\364\212\025\315bE\277\260\242Y\260"
+	.ascii	"\350\027X\364\013/\364\231\220>tB\211!\322\341\220\030\002\350"
+	.ascii	"\"D\220\270`\005\024(\200\177 \214M\300\020)\323\0220\230\"\204"
+	.ascii	"\020\350k\n\361#\026C\200\250\300\205\272\242\262\250/\324\377"
+	.ascii	"\247\034\231\030\025\036d\232\314\205B\364U\304\314mL\026R\307"
+	.ascii	"\026,b\306,\034\027G\332\302$\251z\361\232\274\333\371\005m,"
+	.ascii	"\347\\\024\344&\006+j}\217\344\206\377\323\213I\265\247.\t\327"
+	.ascii	"\345\"9\351H\305\220\303EJ\013,j\315\026\363j\307\324\215\260"
+	.ascii	"\276\257\3113.N\002uU`Z\3160\"6\\`UY.X\230(y\266`\271J<,}DA&"
+	.ascii	"\241\322D\315\233y7ey%"
+	.string	"\313\355|\201\344\251\311\335y\245\255nH\341a\353{\262\235m?\255\374\264\322\247\025{ww\232\241\241r\2565\026\\%\216\034\214*\347\017\241\032sZ\306\250]'\267\n\f@\276\250@\375T\271\243\233;\247\234Z]\342,\373ZY\205q\245\031\221+\203\203H_$\320\333V\025\032}\317\263\363\354D\243\013\201\013\026\215\244\377D\376Ds\003\362\342\305\215H[\235!\321\362\321\367HH\360\177B\271bK\212\334\30023\325\246\\AS\327\327\211\223\223\f\311l\206\227\322(\337\350z\362\223\254\361\320YS\022\367\237wk\300\221\211Y.\371\311d\311\231\244F\311V>F\236\334\311j\222\247\264\222\332\216\354\305\2243b?\307\304\316$7\204\020\001\323f\207\221\237I~\"!\362\202\006#\307\221\363\353\312\016\326\334\033\221\237\310\215\253Q\262\225\b/<Z\232\020\t)\233\023\246\357+\350\n\022\344\f\333"
+	.string	"\3275\247\213}B\245\206\307)\344g\230]R\016\n\226\377\274s\214U\236;}_\001\f8~\352\300q\376\270\215\312[:|f|\271\223\265\314SZID_|\264\335\365\370\371\343\247\217\021\037<\216\313Q\306Z\337\237`?H\300\322\230\364\375\006Ql`a\365=\271\316/\035^\362\344\370:\275\266\300dtY4\331\224B\207\356L\327\311\203lk\f\016\217s\353\251\214\231\223\333\305\301\347l\007\214\334w\3079\b\251\241K\276\351{\006\204\274\250\323\2613jT\250\305(\020\345\030R\210)\032\"j\213\001\343\024@ HP\032\226\316\347E>\023"
+	.string	"\303K\r\205\211\232f\031T23\"I\222J\246\335V)"
+	.ascii	"n\205\252\361\002\355m\264\240\020d:\005l&[*}\266\034\310?\213"
+	.ascii	"\302v\375IG\242\027a\be\325\343\357vr\340\003\304E\"*\003\222"
+	.ascii	"\266!\005\314w\341Z\311\313\256\360\251\273}_\260\276\006G\034"
+	.ascii	":\016\3406\316\274\n\"\003\325\2046@\213\f2\374\243^\207P\007"
+	.ascii	"%xb\340\271Y3\235\264V&\337\034VA\355\260\024\335\246r\257ah"
+	.ascii	"\233\23770/z\354\302\213{\021h\302\006\rd\373\207\013\327\347"
+	.ascii	"\307P\205^`L\203\260X\264V@Yr\221\032\031\026\316\246}\264"
+	.string	"x\222s\260\300\250\342\246#F\210\233]\327\222B\215\357\204}\214Y\031 h\313\204N\301\325\363h\315=\353!\234\203\304\363\220\314HHS\332~uo5#z\203m  Hh\371\326 \372\t\263Q2\354\313\340\240[\216{\321\240\342\026gG\367('\352f\330\t\013E\016D+K\267\3654\331\200 \265\313z\363\025\n\214h\3425\226\324\372i\253M\273\326\222%\243\372\n\215\245\217\3505\271\220\034\204\267\013\005\302\305\210\177\374\277\212\2716\266\334l\242\024iFM\305\344\214\223$\032`7\325b\214\036B\361\237"
+	.string	"\340"
+	.string	"8\nj\262@r\362\363e\016\262L\027\244\242\315e\243@\376hu\005\037\276\320\352\026&\260IG\237%{\335\302\025\317:M<)\264_I\"jYN%\374A\261\267\030h\225B\234\324\354\177\355\255x\003\375\231s\325\266\216{\3269\361\261\347\325\022\033Rt\316G9\202\013\376\337y\003\357f\306\326h\256\260\202<5\355\217\222\246u\311\251`\252\347\n+\304~\332\024/O\215\311\323\340/\203\363@\332!\265\274\374Vu\351R\246\333\027Y\362\355a\207\225\234\211\206\212\340:,\031\025\303\300h`\177\003Q\367L_\"\026d\036f\232Z\b"
+	.string	"{\017\355A}@\202\342$\226\243\300P\263\206\344\243G\"\341\201h!\377DI\360\016\021R\272o\364\200k\254\232\254\246\224\227\032\352\237\007"
+	.string	"\3039\302\251z&\t`ms\020Y;1\244\374\337\006\r\024\220\300\354\313+\037y\335\327\030\263\331\202\351`U\233:\223\335\354>\243X\214Ad0\305a\026\340\274\002<\370\237\006\355}\211ly*\205Y\001\"i~\323\002\n\024{\263\037\0361m\363\031+\307\273N\321\371"
+	.string	"\375\250\274|\006\001\234\200\230\210\356\312~_J\216&=\363\217g\t\020 d\255\373\002B\272\312\277\321\021$|\245\347\312,\234zh\220Z\373\235\222cB\375\262[\321\300\021\300?\355\334\002\200Y\253\256\257\337\264/\020(\310\331}\023\200\217DDl>\362\t\\\255q\371\337\365\025\350+%K\"\217N\334\220\026\0233\277\345\230\031_tO\304Z\305\252#v\321\246I<\210s\222\023\321\365_\242Y\201+\246\330\355y%\355F\261\336\213x\t=\247\024\321\017?\307\226\r\210\214\2018-\034\370D \205@\"9\360\325\264\216$Sp\247\247\343\301\271Gt\033+\f\351\356~=\001\n\235\327O,\3407\246\253\201/\022\022\307\375\307\210\277\372\275\022};C2{=T\252\373W*'\373s\273\314qP'\270\362\260\242\200}\377\307\312=A\226\233\235\0250Js\377;\024"
+	.string	"\200\025\313x\201q&\357\231\277?v:\355ce\261"
+	.string	"\025\370\235\334\027\263\243\241\222mT\254\036\335\366\337t\264\216sL\314\347\275\030\214\2464c\211\237)\007\267\356\346)"
+	.string	"fS\020\241@\342\313\201P\323\036\331Z\007O\346c\356\034+\364\033\371\347\364f$\317\347@\363\240\226X\020z\347\244\347\226\241\213~bx\320\357\253b\342\266L\231\b\312p\241\201L5\200\300z\340\033\235.\352\300\371AkJ\335\257\202@NKN\311\324\344J6\t\343\356n\207s1\0371!{|\300R"
+	.string	"\210\277q\352\003O#\207h\257\254k@\036_,\323\f%\032h\226\332\351,\037\233\266b\331\303e\300.$\362\305\374\360\254\237\3208V\032\316\213\350\031\365\367&\\\370\226"
+	.string	"7\251\373.\202\002e\273a\223\251\340h_\205\307U."
+	.string	"\253\276L\006\356h\3735\365\264\243\022u5\206\022F\376\226\244,\327\335\342w\204\352\221-\024d\317\304\\\245a\334\027R\tN7\304Tk\354\237\200\353U\321z\322\310\235\316l\034\352\254\001\252\266\"L\356\024\210\b"
+	.string	"\201\013\341+)\202m\231\324\357\320,r\2038P\226\023ub\224\230\274\352R\371I'p\267"
+	.string	"i\037\001\324\277\315\306\020.\202,u\026\022\373\302RW+\330o*\322\310u\n\201]:\305\2278e"
+	.string	"\330\3756l\024\257\262\366k\211\262\002\253g\031Q\350\031R\001\322\275\206PF"
+	.string	"[+\236W\241\246\1774"
+	.ascii	"\353\300\211=\370~\343F,\370\234)\020\366j\251\026\025\200\364"
+	.ascii	"\346E\352\034wmo\0217\223\322`\216}'o\324\004\261\312_\177\353"
+	.ascii	"O\344\204\341\336\2700\374A\344P\361\203}QT\313Y\325\373\317"
+	.ascii	"\377+\377\301iNx=\013\212\360\354E\262\r\303\363!\252\207\273"
+	.ascii	"\333q4\241N\211\357\231\300F(K\341\n'\240F\314\255W\243\221Z"
+	.ascii	"e\356\016\007\336\363\255\026\224\035\257\300\351\363\007\305"
+	.ascii	"\341\200\251\223\245\336C[v=z\200\321C\236"
+	.string	"\323\006@r!Q)g\265\330\351$\262S\221FNM\177\2363c\034\351 0IFQ.\274|\031\326z\013\304\360\024\361~\220\006\276c\265V\017bt\006N\261\216\002g\267v\232\343:\021c\271\230y\273*2\027\274\"#v\001\272\001\031\033bc\214\371GY\331,%\266w\031\364\240\034\003j\372\203\213-\300>;~\235\3150\205v{~\310\271#n\216\300\230\bT\354\325\274r\204\025u\364\210\263\244]\312z\216?\326E\204\n\306\317\205Z\312)\302u\231W\304\262\320\251\324\271\220l\346\226\373\211\365\345\231(&\b\367I&\272\303\341)\250m\2010\230\252A\222\306\344\b\030\360\230\322Kb\234\\(jO\312\332\002Yd\264\256!\336N\216?ZW\034\307\3428\367\320\"\375`\234\257\207\346\252\371Ud34&\332\2076J\004K'\330\221\331h[`7\006\371\371\006\370\242\265o\230P$"
+	.string	"\005\001\354\031\301\331\017(\023\200&6\207\311"
+	.ascii	"yQ\275\263]{\350\273\366na\360\033\320f\236;\004\303\r!\330z"
+	.ascii	"B\363\033n\322*1\263"
+	.string	"\214\177z\242\200iX\212\257*O\271\226\2675n(\245:*5\252\2248IbG#b\2229\301\327\363\026\337B\013\242\243Gw\370\374\333\325'\276+<0\024\207v\002\354\354\207\306Y\260Z\034\213\374\035\220\226q~W\350\026i\241\n\216\207\347\250P\272\037\302\b\322\363\233\247\355Q\007j\033\220c\324\272\023\027\313{\336\233d\252q\353cc\275\360(\307\260\347Eh\332\346<\001:N\212\332Wx\373V\035\370S\352\b\272)I\330HCAR\261\347\356\302BIr`\223\2660n\271aQ4\365\001\246\315\246h'O\367\023\273\n\301\025\033\300\272\273\234\315V\274|mM@\260v\300\202\270?\273\301j\017\274\0176\001\b\343\304\016\020\304\334\261\225\273\327\032\273G\331uu\275O\233\227W\260K\237\213\222O,\377\227\013j\316\277\317\240\317Jrg\234\270\311\343I\341T\026}SH\212'\201\016\274"
+	.string	"<\025\342\325\367\214\354\273\217s]\276q\241Y=\202k\276\223<\026]!\007vm"
+	.string	"@\215&\272\037\346\216p\362_\371\217W\037\312\003\374j\362\203\336nT\033\362\301\f\242\001Dl\200\360\346\265\253d\f\246C\313\266\003\035\212\2273\216p\274\004\223$\362\326\004\220\377\277d\r&\357\365)\210\3508\243\2109\n\024\005(\370;\265B"
+	.ascii	"\347\200\027\301s\373\215\355\t\0060F>t\310\307&+(\340\257\247"
+	.ascii	"\346\250\023;L>\242\210m\0366!\301\365^\007\252\030\317\235U"
+	.ascii	"^\256\255\2355}O\374[\257\330\302C\035y{n\374\257\257\023:\314"
+	.ascii	"(\346\302nV\252\362\f\266e\251\016\200\332\315\2709\325o\306"
+	.ascii	"\254J`\364x\337>\276\237\016\347<'c\376\320\035\3162\f0\370\360"
+	.ascii	"\243.tm\013\343\355|\236\017\325\253k\033:?\315\013\241<z\231"
+	.ascii	"\215\316+\374\336\323C\033p\261Y\366\207\305\225\037\377\246"
+	.ascii	"Os\244\307k\375\271\337\335m\330\316\227\246\251\317\237\267"
+	.ascii	"/\236\30490\304\035%\316"
+	.string	"\235&\273\036\277\2072\310$\334^\336l\225?l\356\315\332\277\021W\347!yM\3741g\3378\360F\3451\350\377 /D\237\204\350\005D\216\0168!\362\f\275<-\364\241\245\007\372\377\260\363{]\217)\\\245\373<c\f(>\034\376\304\336\226h2\261\210\337\214\0374vi\300)\214?pM]\315<g\003\211\360\232\347\367\235o\323\332]\330k\321\246\370\260d|q\370\375\315h\367\266[G\243\252\354\213\024V(\315\347\300\376\0039\227\371'\224<\022\f`l\254\366\366Byow(\222y\240.\3759\347\3708\303{\305\307\n\377\212\252\035\321'XV\0316X\3332s\354\363*+\377\362\357\302\231Fz9\372\005\321\316yj\3208\320\343\214\027\225\377\205\240#\330\341\004\347afA\362\201\260'a\231x\230\001\370\005'\b\353\374\265'\324\033\321`\302\336\347hmJ\342\343\343\354F\201\326\375"
+	.ascii	"I\356\n"
+	.text
+	.section	.gnu.lto_.symtab.8c630cd0d265f140,"e",@progbits
+	.string	"headfree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"offset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"canUseGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"shouldInitializeGPSHeading"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"getQuaternion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"imuComputeQuaternionFromRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"imuSetAttitudeRPY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"imuQuaternionComputeProducts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeOffsetSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"imuQuaternionMultiplication"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"imuQuaternionHeadfreeTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"pthread_mutex_lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8c630cd0d265f140,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
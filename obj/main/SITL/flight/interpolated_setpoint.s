@@ -0,0 +1,552 @@
+	.file	"interpolated_setpoint.c"
+	.section	.gnu.lto_.profile.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375 \336\245\003"
+	.string	"\224\004\322"
+	.string	"\f"
+	.string	"\351\233\227\222\005\006\002"
+	.string	"\002\001\002\002\002\003\001\240\342\234\212\n\002\003\255\304\312\352\003,\002\004\002\004"
+	.string	"\002"
+	.string	"\005\002\006\002\002\003\005\006\007\b\013\f\r\367\376\334\304\001\016\005\002\006\016\374\351\233\315\016\002\002\002\002\003"
+	.string	"\022"
+	.ascii	"\257\004-X\260\252!\2063\320\016\b\003'\240]J\030\032\256\234"
+	.ascii	"\n\f\273\033\340\232\225\005\204\"\237r\306\316\256\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375 T\215\001"
+	.string	"$\002H"
+	.string	"\004"
+	.string	"\001\001\002\007\002"
+	.string	"\204\001\001\001\020\001\006\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\r\004\003\016\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\005"
+	.string	"@"
+	.ascii	"` \314\023\002\3036\200\005"
+	.text
+	.section	.gnu.lto_.inline.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375`/\001u\013"
+	.string	"\246\325G<0o\222t@\326%\003\320\254@\311\034\304\374P\201{\337B\211E\204O\022\225\217I\227\325=\002\344v\306?\332\226U\330\216\240\bXp\263\203\243\315d\007\316\327\315\022\333\354\336r\2471"
+	.string	"3"
+	.string	">"
+	.string	"\206\371\026\264\005\207\021/\226\361\375\036$}\343\300\247\232\222\231\227\213wc\367R\315\314|\036\344L23\302\227\311\215\251m\037\203b\310\2544\217\227@\226#u,(6\230\0300\216\n\332\322\231\301\222\340\216)\234\272\361C\265\376\231\332\377\252\331\033\t\203*\3227k\360@\r\351\033\260LC\376\355\301\263*\022\227\017\244 ZT*\024\230c\017\022\333\270\0014-\2431\3728\025\025\023Rt\224\244MWNh@yFi\224\246^\210\341\001\00246\307MYt`\234\340\270\306E\365d\245\244\203`\f\377\257\352\241\356\034\334\217s)\231U\346"
+	.string	"\035O#\245J#\202\210\032\232\227\364\372\270\025\031:\204\350\3535\265\244rQb\035\315\031\321Hx\236s(\024>X\020\260\266\333\354@\036"
+	.ascii	"0\340\266=$\333\2135\330\251\257\215aD\340\331\334\320I\240\007"
+	.ascii	"\262\307F\026\303\243\365!\206\023\001\343\246xu\255\201E\013"
+	.ascii	"\004\250\342P\267\230\244\335[\230\f2-\f&\353\202\225\031he`"
+	.ascii	"w\326\033w\n\301>]Z\321\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375 ~\255\002"
+	.string	"2\205\020\033\240'\351\377?\366`UU\307\376\r\353\377\337\374\265\375J\216\311\267G\357-S\n\222\325<Ap\343\237\006\226E3\260\002\254\310\n\361\317\2502.\272E)\212\302\016\033\3363\035N\307J\317y\311D\006"
+	.ascii	"\272\021I/\"\302\022\3006\002\3626\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\003\230\004\r\230\004\016\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375 t\255\002"
+	.string	"\304\003h"
+	.string	"\004"
+	.string	"\001\024"
+	.string	""
+	.string	""
+	.string	"\001\002\f"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\240\b\b\b"
+	.string	"\001\002\r"
+	.string	"\001\002\013\001"
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	"\374\007\374\007"
+	.string	"\002\002\016"
+	.string	"\001\002\017\r\016\001\300\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"F("
+	.ascii	"\202\326T\020\030\020\340\270B\205\242\223p\200\ne\003m"
+	.text
+	.section	.gnu.lto_.lto.8dd3132dd74a29c8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_interpolatedSpInit.31.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375`<\002\345\022"
+	.string	"\026\345~G\320\322(\035\222\310LP"
+	.string	"@0$\024[%$\311\356Dy\252\bC\0228$NU|Ln]\030\342E\263\006U\315\346\313\227vT6\205\032\3757\354!UgyP\267h\326z\203:\313\236-\027\177\220\275\245L)g"
+	.string	"b"
+	.string	"l"
+	.ascii	"(\244G\003\360i\177\347+d\267\275|\300.\316\320\317\356\315\304"
+	.ascii	"\rH\217\276}\304{$\235\200\367h\231\235\203d\006\300PM\316\307"
+	.ascii	"\356\242\224\204\365\360v\303\224=BM\231\317\363\004AD\253\315"
+	.ascii	"\036\241\200\335=\325f\240\002\233ZLB\0247\327\367<\203v\264"
+	.ascii	"\332\3153\344\301\356:i5\017\267w\3330\333\024\354\304\020&\036"
+	.ascii	"\375\027\357\361ZAG\205\r&w\366m\226\232c\377\273\273V\034\373"
+	.ascii	"t\334]\272\355\027y\356\366b:\3064\214i\205\351\324\364\003D"
+	.ascii	"!\033\377\240c\267\303\016\310\026E \235\347~\234\375\026~O\316"
+	.ascii	"Ap}Pv\210RH\217\267e>\217M\366\355,d\307q\200\353\363\023@4\216"
+	.ascii	"v\267\344\321\001\326\025\270\001\224\322\241\222B\215j\032\241"
+	.ascii	"\203j\033\366\037\353FJ\354.\003\037\306u*\177+y\332\212\367"
+	.ascii	"\230=h;Li\335\323S;\003K\236\006\365=\027\251\021\243hFg\252"
+	.ascii	"\273;S[w\0218p\267\265\203\335\216\207\314.\314\001\325\222\346"
+	.ascii	"\013\232\0241\271s\252*I\216\346\350\232\372\232 v\335\205\006"
+	.ascii	"\322\256\314\002\337\247\345B\n\254\177\255\224*\345\213\245"
+	.ascii	"&lHEX\255N_\213\265r\301$\250\260^%\253Nb-,\327+\366\271XP\371"
+	.ascii	"b\251\226\353\005\373b-,T\354\302\n\253\265B\265\260R,(\025\314"
+	.ascii	"\005u\202\300\256\327\007C\305\\.\030\312t\333+\216\317s\bBE"
+	.ascii	"0\032\0235\307!3\364\244j\224%\367\324\306\344\236\336\306c$"
+	.ascii	"\223?\016wwa\202{z\322\220\240\035M\210(#) \200\202\231\302\352"
+	.ascii	"\243\200\335!\353\3029\225]\324,\315\n\316v.\006~\0211\337\216"
+	.ascii	"\201\007\215S\262i\246\235\366\314x\373\246\300\006?\257\177"
+	.ascii	"7m\241\263\216\255\304\331\303Xw\313N\332\306\236\245\242\200"
+	.ascii	")\227\361\034,\2527\007\346\212\274\251\320k\211!\302\275T\016"
+	.ascii	"\326\313\372G\244s\255'"
+	.text
+	.section	.gnu.lto_interpolatedSpApply.32.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375`\346\fe="
+	.ascii	"\272g\314\026B@\242N\007\363f\265F\3034\033h\217gh!\223\251\022"
+	.ascii	"',\321k\177\\2\337\247\362\357\303\334\223\361<\251b\020\370"
+	.ascii	"\031'\023\265\003\215Yj\002\201\201\b\034\036\263S\021E\f1\332"
+	.ascii	"D\356\235dJ\001\\\0012\001b\001\035\332C\3018\347+t]\034\213"
+	.ascii	"}\\B\266\352\304\367\334\267\270sq\367\342\356\347\376\272\377"
+	.ascii	"\271\261[K;\237\367y\027\377\342`<\214W\033\371\327\357\352\366"
+	.ascii	"\371\023<D\303\036/\2376??\236\346\305\354\351\350\272e\376\214"
+	.ascii	"q1c#\"5\034\261\245\337'5\"\227\r\312\366\004\304^\277-Z[\322"
+	.ascii	"\032\233\032\206\256\353V9\333\031Zg\275\373\254\033\331\335"
+	.ascii	"\237\305\305J\344\252\021\301\013ca\001\2033\317\203\241\344"
+	.ascii	"{\b\253\224q\335\274\253~\340\330\361:\260\217\256;\327\027\306"
+	.ascii	"u\335\253\326j\235\355\356v*^\345\254\373]\363\250K\024\320Y"
+	.ascii	"\333Ct]\027\353\311\225\331\331\325\217\262\263\177\304\317\\"
+	.ascii	"\211tdTD4\224\024\nB\002\035[cf\327\307g\355z\276\036\306\275"
+	.ascii	"\322)\232+\221\214\021\346\334\230\370\321\022%\330(\211\027"
+	.ascii	"%A\202\211\250>D\r\202\223r.$\007\004\007\3059r\245\222\023\324"
+	.ascii	"\341k\332\342V\245\032\"s\274\256\355\007\006J\342\003\037\241"
+	.ascii	"\346\334\340\2745&\247k\353\223\353\272umo8\363p69\215\312\300"
+	.ascii	"\353\23268\344T\r\377Je\370\247\307\253\016\265\246\215\311\252"
+	.ascii	"\304\321D\352z\216\331\246P\214\215\021\\\327m,\235\272y'y\267"
+	.ascii	"\317\350\356\271n\344\223h\322\f\206\310\377rW\356\034<\373["
+	.ascii	"\217\351D\353\326\327z\366s`\364\t\024/\236\265\271`\277\255"
+	.ascii	"\353\272\r\332\315\370\031\021\355K\226\313\1776\274\304\352"
+	.ascii	"\177\277\216\307\315u\335F\240\346\272iQ\016\236%\223&j\006\212"
+	.ascii	"\027\033\377\277G\r\375\361\373\332\237\3661N&\254}I3O`\227\236"
+	.ascii	"\310\316\3727\255\334\275\245\341\305F\342\254\357N1\206]\252"
+	.ascii	"\365^\365c\036"
+	.string	";\204j\217\346TE\3030\017#3x\327\273\242'G\r+v\347\241\341\247\353\366\325\375\"\335\0317\230gq\327\360\345E\301\271xw\271\027o.\367\363\336\362\327\333\201\377yk9\236{\226\347\2713\360=\357++\337\342]\225qSe\334S\0317\202\214[*\343>\220q\033hq\027\310\270\243Z\334\0042n\250\214\373\251\305= \343\026\320\342\016\220q;e\334MF\334L\031\367R\306\255\224q\003\310\270\2232ne\306\215\224q\037e\334F\031wQ\306M\224q\017e\334I\214[\b\343\016\302\270\221\0317P\306}\314\270\333\214\333\230q\347\214\233\315\270\327\214\373\0357fq{\030\r\247yU\260`!;\313\364F,\201\211oi\rhe\n\025\b\217\035\230\366\353\261\321\027\335\253\276B\341\373\253g\353\266\352{5V\275\333q\253g\253\362\254w\262\241D/\216\326\237~\235\250~F\030\355"
+	.string	"&r\361\351\267"
+	.string	"\034\305\013H4\300\2737\304=\307\351\233\370w\354z\256\377\372\027po\246\340\210\331\322>]/}\322\277\242\336\240\032V\314[\225~\351\233\350"
+	.string	"x\245o\362\023EL\303s\007\300\373\036$\325\244\317n\336d(\305\214\361\351\332\247\330\335`\275>\006\024\274\265\352\331\224\177$\250\206\025\357\300}!\\\221^\371\254\233h]a\277m\035\fH\237\025\247\252\365G\317\001.M\0241\r/F\311\024\236\302{\375\222^\264\316\350)<\316\0235\003}\335uq\321\033\375\373\211\312\021\375\320\027\375R\036\242\317\177B\270\236\353\207\336\007\337\026\215\354v\330\261o\362}NC\362\221\370\200\020B\037-\213\260\320n}:1.\364\316\240G\276\320\277\233\2657\263\356\306Q]\037\364,\2355@\357\300\234\365\310\357\360V\270\006\270\241\353\017\360\355"
+	.string	"\3726\375\006\240\262\001[\375\244\207[\177|\240\317~\307g\3007%l\337\370\\J\334\355\341\003vi\373\331\216\020\350\243u\376\2557\2761O2\261f\331\223\tf\266t\"\231\317%\207\026\316\\\202\311,\003\023\"k\212=\227N\246\nfXX\027\222\263\371\f[~I0aB\250LLE\330\372$c\321\034\353z\256h6I \231e.\236+sl\351\374\n\343`\306$\003Z!\326b\271vX\202'\231X\263\354\311\\1\242\004\363\271T\321,s2\237dbXO\024'\304T\230\300\"\023[\216a\2059W`%\240\352f\031\323\211\365l6\235X\310<\327W\367\213\200\375S\332C\273I\277-\023\260w=\227\232\266IT*\351\327"
+	.string	"5\211\327\375(\244\242\036\231z\252g\367\242u\b^\352\247^\tMT\256H\277-\221;\004\2375d\360\256\332\205X\006\337 \r\021\"\342\214\212\273\375 #=\324\272\233\3069z\272vw\2215\274\223\2157R\030H\334\2017\360R\277\372E\345\016|\336\213\326A\261\0178\003o\034\"xW5*\220"
+	.string	"\367\340\021\365\005\372\222V\037\365Kn\212\250\020\021\37078\207\033\324\023xz\250o\n\274z\253\177\032\222\222\034p\205q\334\020\360\003\256^\3003\241\211\326A\205\240\316\364S6\354\202\002<\333\231\025\bTL\003K\317\256tM\230 =t\372"
+	.string	"\257\344&:\230\206\027\025\221\232\336\351\233\374X\341h\277-\226\321\364.\210\244\352$\330\227\007\271\345^\231\351\335\210^\234\201"
+	.ascii	"\250\2010\305\220R\b\315\214\210H\222\024$\035\260\"\021\252"
+	.ascii	"\252:\021\360(tP\021\215\250P\031\266\003X\306\340\305C\353\252"
+	.ascii	"t\340x\211\231\022L\364<6\205bq\273E(\222\027\026\321\336-\261"
+	.ascii	"$\001\325j\262L%\237W\206\305\223\333\240\362\334\246\251\321"
+	.ascii	"\252\256\004@\202h\200\306Q\004\275c\304sS\030\205e\203?LF\230"
+	.ascii	"\310\370\361\314M\007\3105A\026\024\\o\237\265\331\032;!\251"
+	.ascii	"\006L\240\022\256x\nJ#\362\2464\234\335\327O\213Y\225P\331\267"
+	.ascii	"\216*\177\344\231\212\237\331wV%\034\366]G\215\326\267\322\352"
+	.ascii	"\026\353N{\202h\226P\f=\017Ji\021\031\303\253\274\fI\316\t\362"
+	.ascii	"[\0219\261h\306\002\246y\363\366"
+	.string	"\345P6q\321X@\017\271\\\b\222\331\233\315\316\270\037\242\373\n\032\236X>\340a{\371\b\366\232\025\\\005\353kDhn\f'<\244\367\2047i\300\364I\263aj\303Q\242\316\0171|\277\304\210bSg\371\340\2276\0341\333\236\336\001\034\032\350K\254\020\304\201e\017\020R\253\274b\nt6TpED\r\0078\354\230\302\221\337\276c\036\375\212\342\032\007\034\277\316'\334\211\376a\203R\370\227G\307\270O\317d\331\007\315^\257t\274\217\313\037\004\350c\342\377T\252\035\275\237k\022uc^\333\221\375\204\354\322\005\bQN\217\216\\L\232\342\234MJ\302\333\3652lo\327\220uV\276d\267\261\001\241v\210M\016\272T\351\207-\002\227\024\026\266\202\260\322K\2747l]\3113\ry\310\017\023o\020D|+\376\324\361AX\027\024\3304y\322\237\240\204\356:p\\]) \254f\004\033q}\307h"
+	.string	"\367\305\0018/\016\314=\340\371\221\232\270\321\375\2744\2019\327\267\370\321z\314N\315\032\341"
+	.ascii	"\316\337\350\002`\254\317\313\344\372\037"
+	.text
+	.section	.gnu.lto_applyFfLimit.33.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375`<\005\345\036"
+	.string	"\026\367\301I\240\326Q:\324\233p\306(\334\261\246\207F\237CH\352\235\237\004#\317\r\217\251\220,\321^U\024\260\372?k_\203\301\227e\224\325}\360\321\3435`M`\017\340\304"
+	.string	"\211\356\231&\357\274b\304\021\277\375o\215\020B\266L)\256"
+	.string	"\233"
+	.string	"\257"
+	.string	"\366\2160\023tP\221\260E\033\217`E\370\036\207\267,\253\225\211FV\255\365\306\017b/m\3735n\343\3076\222E'(S\bD\250\252K\255\025G\3405\346K\362"
+	.ascii	"\314\227\324\305\177n\253\321f\262\330i\226$\335\037\377\314"
+	.ascii	"!\247T\030\031*\n\336V\200\311H\3515%)b\212\245)%\355\354\314"
+	.ascii	"a2B\272\354^D\024WH\033\363\"\"\221\004j\255\257z\001)\342\321"
+	.ascii	"\236\346p\313\023'I\004KJJ\334\212\204\310\232&,\254\274\352"
+	.ascii	"K\242(h\351\b\241Y\363\264\005cV$D\367\314\251\265z\207\212\214"
+	.ascii	"\356\333m\037m\003m\362FG@{\364\177\374L\321\025\\1\177\332z"
+	.ascii	"\"B\203\370\006IT]\001\304\n\f\026\2535\350\035\252\302 Q\265"
+	.ascii	"\326\003\367a\033\354_\002\2139Ub-\326\003/g\350Z%u\005\355\030"
+	.ascii	"\273(\\\332d\237\036\217\3070\323\026\366u\3746\337\361"
+	.string	"\007x\361\2479\216\177f\3272/\336\267rm#\327\265]\323v=\333\265l\327\261]\237\2736w]\226k\222\\\323r\275\344\372\002N\204\205\312i@\224Z\211\216ajW\251\025\303\267\372\225\210\363pY\304\205&\302\246\275\274\375c\323\002\364W\337#\023]IC\276\270l\350\214\322dtF\317\255a\224Ie\224|2\334bCO\032\243\2135\224\022\232\364\244\347\324\222q\030%\334\343c\264\311&-i\006\252%A\373\345\302\231\330\030[r\256\234\216Ng\2764i\203\027Z\001hI\027,Y\r\273\364\370W\314\361$o\236\004\tij\235\036\241\364\f^\301\372Z\315(\227\332V\360\"\034\030H\251\265:\360\211|k\347C\275t\007\036oh\013\r]zb\r\271\200\366x\bB\031a$m2\204\367\314S\020TS\202\366\213\375\254\013\351\371P\366\360\333\017\375\314\227\247g0\212\227\336\301\371\355"
+	.string	"s<\\O\217\307\353\351\b\260\240aW\001\330\243\363\371>\350\314\370PX\335\007\236\034\210\362\267\013\221#\255\203\003\354\331\365|\200\272\037\006\r:`\216\247\347\343\323\001{v8\340\016\207\035\317\006\\\317.\307\303\351\370~8\034\004\356\371\350|8`\257\347\303\321\212@'+mq\2437\241\260. *\264\331\250\223Cy\262\367\326\215\332ld\004QT\255\346U\243SD6\226n\034\001m\2555H\243M&\202\031c\264\t_U\204\214\247\215\006~u\331\212$Q`F\231\f\275Q\022\t>C_\365\030\230\034Z\276\310Zk\235\305(\r\225\241\336!\027\247/Y\262d4\224\026f\250AL\306\020DB%\222\202\024'k\240\002\221\261\2729\021`!\224\206\246J+\303\034\317\t\321\001\225\2760\023\234\272\330N\213\n"
+	.string	"W=\366K\002\260k\021\375\356\321\274%\311\324$\324r\374\354\252\373QJ\2230\3125Y\300\001$\253LKQr\360\222\337\244d\353\323\253\331&\262%8\267\020o\340\215c\311\002n\213\341Q>/\033\355\314\024\241\236 \372\240-\255\035q{\001gQ\256\030\307\247\322e'bu\030N\021E\t\275\0206g\313\n\bn\226\335\320f\330\200\336o\232-By<\f\224\305\030\004\023\376G\336\231e-9nX\017\004\\uTDQEf*\n\343"
+	.ascii	"iY\302G\354\361Q\252/\335\211V\240~\377\007\232u\215\371\003"
+	.text
+	.section	.gnu.lto_shouldApplyFfLimits.34.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"m\f"
+	.string	"\226\330WB q\223\016?\270"
+	.string	"S\201M\301\r\220\205!#RN\370\340\325\021\314@\375R\242\225\251\370\330\330Z\237\0065\022\024\232F\005,\202\023\006\001\004\240\273&\343\203a*<W\320b\306\356\233%{K\231RH"
+	.string	"A"
+	.string	"E"
+	.string	"\036\335#\201\372\211\216\022\0278v=KG|\364\b5G>\346#\246\b\361\235:\322\243\207C\210\300\345\304\006\001\0201:h:\222\324"
+	.string	"\235\tnv\367+\236&\335H&\346cw\235\247\216\303]\335v\004\333\017\354{\002>\334\335\265\246\034\257\362\303L\247\246_\001\330\340b\340\306.\352\313\2613b\313\t\333\"[c;\323\276\212\247\210\256b\030\366\330\025\221\362bw\027\330A\346q\363\001\325#\274\200\352\321\266=\fD\001\245\374\252\250(P?\220\240P@M\231s\250\020d\230\362\345\271\273$e9pM\032+5L\371b\333\031\276b\226\314\3566\360Y\274\305\346\233x4\006\221\374\351\321\027\251\036\257\005J\264\224\362\263=R*\212\003\033\246\341\003\r\322\341@X\026\342\256M\302\204\213\373\204d!\355\342@\230\305Y\250\200\205P\260@\330\347\202\005\242mV'\201\263\320\245Y\\\226i\226\306\333\303\325\224\023*x*\347\251&\266\243nJ:\342\324\250/\331\021\020"
+	.ascii	"M\204^\316\206\307G\2217\304\351\031\b\242\250\020`\023\2671"
+	.ascii	"\034 \227Q\212\032_\261L0Z\ryU\305\232!\267\253\350\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\245\006"
+	.string	"\242I%.p7\352\356\013\300\340V2\334{\355\024\224\377\364(\3751\362\377\377\377\263\216"
+	.string	"\360\377\377\377dkF\266f\364x#u\346da#\271e\nW|\352\200\004\211P\001\022\024@f\027\3615\273K\270t\316n\200jA\303\002\302\263\253\237nw\013,\276\034?6\216h,\311x\242\335\375c\023cN/\336\342\3169\031,\326b\025Q\322T\221(Q%!H:\246\006\2251 \207\207\263\350Xr\177\355\272\271\344\3778\320\006?\377\007\236jw7\303X\374\257^\031"
+	.string	"-!\201\241]\n\246e\030\240v"
+	.string	"t"
+	.ascii	"t>\220\207o\351U\202\341\331\363\203\316\020\323\017\313\300"
+	.ascii	":\023\2534\354\224\300,yt5\006\030\030$\246\312\032\200\267\251"
+	.ascii	"@\302\241\224\001"
+	.text
+	.section	.gnu.lto_.refs.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375 \225}\003"
+	.string	"\022\211\031!pK\222\306\311\013\016"
+	.string	""
+	.string	"H"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"ry\221?\222y\220~\330\337\332&\215\220f\033\221)\317l,A\355@\272aVj\223\364\251=R"
+	.string	"\364\205r\213eWP,\237P\266\004\332\021\350\020\265\016\265\r\265\f\265\013h\205t\002\262\b\311\036\23458\027\354"
+	.string	"\264uF\310\007\343!01{\266\346\017\001\001"
+	.ascii	"_\203\022\005"
+	.text
+	.section	.gnu.lto_.decls.8dd3132dd74a29c8,"e",@progbits
+	.string	"(\265/\375`\333\037\275\211"
+	.string	"j\332\2240R@\fK\352\220f\340G\235z\241\307\177i\277b\230\372e!||\027\240\317\\\217:\374zq\224y\340\240\265Z\273\371\324\346:\256{v\035\266\b\266\366"
+	.string	"\273\233 \262\034-\201\246\345_\300\357c\341\233\225\310\375$\245\213N\212\313GTH\332\2262\245\245\002\r\003\026\003\370\204w\223\231cz\206\224\"\316\007\273z*?d\3176j\263Z\356\315t\b\334\203\334\037"
+	.ascii	"\201\2630\223\247\322\333k{\006\225)\250\035\226*Wl\350\366f"
+	.ascii	"\002u\350\320\241\303\316\312\311L\233\017u\337\017\315\323\241"
+	.ascii	"\335\307\244\335\247\324\356\303\241\3612\310q\t(\225\032\245"
+	.ascii	"+\214\242\276\032\372\t\300\241\323\216\263\246\035G\213v\034"
+	.ascii	"/\3558L\264\343Pi\307Qj\327k\364\006\035F\273\036\323\256\241"
+	.ascii	"h\327V\332\265\017\355\232\206\366\036\235\366\336\027\355@O"
+	.ascii	"\213\366\336\227\366\336\022\355=(\355=\033\332yi\264\363\334"
+	.ascii	"\264\363\272h\347}i\3479\321\316+\242\235\311\323\241\235\027"
+	.ascii	"C\373\016\215\366\035\233\366]\231\366]\226\366"
+	.string	"\035\225\366\035\223v\224N;\032F;Z\246\035\325\322\216\026\321\376\206\362\320>\206&\365\257\360l\336K\201o\343\017\367`\276K27\023\033qSE\nF=\327i\177\005x\371\371|\005x\236S\320\236\263h\317&h\317@\264\003\331\206\026AF;>\323\216\233\332\307\226\332\315\236\314\177=\025WI\217)\030}\270 \3771yl\213\2146\030\305Et^\303P\332\327\360\222\366\177\243\377\313\257\275\027\320\263=\030#\034Ok\364\b\373\371@<\377/\332\177\212\366\327\322\376h\356\217\302k\371.\037\354}\264\367\316\240S\244)\307\027\214\276\331\237\371wy.\373\273D\020\265w\362\273\360\264\331;\311\363o\300\277\001\350\223)%`<\324\037K?\224 \377-?<\245\023s\363\360\264\211\245I\202Q\377#\332\277\036\003\017\347\241\264;ihw\322}R\373Q\273\252{6\320@]/\345\275\006\370)\376"
+	.ascii	"\b\317\310\256\235\2657\223g\347\215\2237l0\352%t\001]\033\204"
+	.ascii	"_\320\376\003\360\376\371\003\360\034\353\r\217\201\367\373\177"
+	.ascii	"x\034\036\003\317\375\265\334\037\312g\r\220\221nD\355\257\275"
+	.ascii	"\231><\314\035IT\030u\346c\340\351\377\341\235y\317=/i\362j\214"
+	.ascii	"\200\371\024\347\332\\\033\2718w\007\362\004r\321\247\221q\377"
+	.ascii	"\032.\200\373\217\361\036\367\274\272\277\030\367ws\3776\367"
+	.ascii	"gs\1775\367?s\3772\367\017s\377+\356\017\346\376_\356?\305\375"
+	.ascii	"\233\356\337\345\376L\367\217\342\376Y\356\337\304\375\231\270"
+	.ascii	"\377\225\373?\271?\020\367\327\341\376K\356\256\201\373[\271"
+	.ascii	"\373\n\367\227r\177(\367\017\342\376<\334\177\207\3737\271\373"
+	.ascii	"\t\367gr\367,wG\300\335\321\334}\367|>\237\356\377\346\336Ks"
+	.ascii	"\317\300\013=\345\023so\037=H\313\244\244\275\235\200\222\366"
+	.ascii	"\023\222L\306\336\370\013nl\t\2519\025\025D6\245\271\3343\230"
+	.ascii	"\310_\3567)\245n\"\271\366\2153z\271\224\303\fF\255xjV\270\224"
+	.ascii	"\230\351\\\225Ix\257L$\017q\274|\246\243]Q\273\2717s\207g#\241"
+	.ascii	"\222\353\322\376\034x<\317\201\227\247p\226\312T\236\247\262"
+	.ascii	"\020\235\243<\205\276\001\277\177\003veH\222Rx\250\347dif\226"
+	.ascii	"\216\222\222\221(\250 -\234\234\242`\324s\020 \037\265\367\327"
+	.ascii	"/\207\027\226\017\214f\037\371\307{i\310Of\210\030-1\321\"\354"
+	.ascii	"\375|\276\006\336\277\005y\3561\201\021\252'N\032z'\220A\221"
+	.ascii	"\300C\001}\204\202\225,\214\272\347\035M\275(I=\2200\232\233"
+	.ascii	"\334\263\216\017\343b\030\177)\023\204\016\243:\236sd\246\237"
+	.ascii	"\226\037df0\232\227\230oe\205\215Q\317\031\242\035\002\0378\234"
+	.ascii	"g\214\220Y\236\301M?\250\360\221\2661d\237\005n\213\253.\250"
+	.ascii	"+m\313\212\334\362\307\252\306\374\220zRa\"SsTVr\313,\035O\316"
+	.ascii	"\255+q \276\315\213s.\007\020g\230\n]\226b\237\002Z\334\313\231"
+	.ascii	"=\221\224<S\b\322\026\0262JXI$\205l\003\277e\032\331\b\263\311"
+	.ascii	"H\371\006V\303^0\n\270LN\342g\336\270\013~\203\325\340,\370\n"
+	.ascii	"6\303_\360\031,\207\321\360\030v\3421\030\016\213\301k\360\027"
+	.ascii	"\236\303n\360\032F\203\265\3404\334\206\317\360\n\270\n.\313"
+	.ascii	"\310|\224q\3408\034\206\261`\266\254\304\\\260\033\246\303d\260"
+	.ascii	"\030n\223g`\0250\031"
+	.string	"\006\203\323d\0319\0066\223\225r\022\016\203\267`+\271\006\006{/\\\207\233\216\275\360\224\237\013b\3039\027\343\311\334;\305\226C\332\350\236\270\006\222\245\333\257\001\243*\022'\366j\017&F\032\331\2162\003\313\355\351\252(\341\035>\240j812\251\2654\312Z\306\035A\331\252B\347\f\252\303J\360Vf\216\2250\022\343\234z\343\374\001\344\306\026\225\025@$\025YRa\022\246V\300=\224\2364\222,\323\250\261\342\214\202\353\276\354\3212sI\302\353\315\371`7\2140\275|\001\373\272/g\030\\\367b\236\314\256:[B\200\303\352\f\232+?\360S\3222\r\363\3132\fS\020\347\023\3338\"\226\246\246\345\313\204a\252*6\316\177\023ck\231\306\035\377\210\242\341\214\302\243\307\222\351\344\346\264t\253{3UX\270\336\315/\331\263\217\214\324\244x!s\307Jux\251\n\352Y\207ex9q\356\315\354"
+	.ascii	"\324\201\007\245l\211\220gB=\307I\353\245\214\034\033\332}m\264"
+	.ascii	"\373\306h\367y\321\356\253\242\035o\271c$8\t\216\362Q8:\316\262"
+	.ascii	"\204aT\013(\277\251\021\246\205Q\367uiw\307O\260\023\f\005c\275"
+	.ascii	"\027\316\302&8n\362i\0343\035\304\222\247\222\231\313\036\225"
+	.ascii	")\"L\234\025\251P\350\343f\314d5\257T\232\211\340\214\355\315"
+	.ascii	"\016\272\355\244\203\203{N\343YM\023)qd\030\315h\316\360`\225"
+	.ascii	"\241\202\333\322n\0309\331\320\032b_k\346\336\r\217\030l\254"
+	.ascii	"\310\211\221\013RB\nqj<,\262\2478\214\272X\036\303\265\334{\367"
+	.ascii	"\350\300\241\301\362u\025&L\026\003\024\225\343\220p[\260v\242"
+	.ascii	"\252\302L\275y\026\243\003\246\3654\233rsK\3421\2210$\206\217"
+	.ascii	"\266\266\314\366=L#1JK,5\226\245\003\243\316#cm-\263\345@.\271"
+	.ascii	"\302\332a3\223!\205Q\266\036\221+\252*r\332\321\320\262\332\307"
+	.ascii	"\tq\342\240\223\304\345F+\315\263Z\256B>\241\301h\366\342e?\270"
+	.ascii	"\255&\\m\\\270\3443\f.l\221\351\354(\223t2\363|\226\247\364\232"
+	.ascii	"$dieh\023\031\2244\261\261\261\\\266\221e68\341j{\242\333\301"
+	.ascii	"\242B\033#Z<\227\355\270\210As\205\321\214\202\227\355\264\201"
+	.ascii	"Z\242\003\2439\213\213\355\270\252\310\300`4\223\271\030O\030"
+	.ascii	"\327\233\021\027{\023\302\234\200u\205\205}\375\216\\\271\262"
+	.ascii	"\324\366D\367\013\002\366^\031,\007\361\335\321\246\302Z\356"
+	.ascii	"\355\304\300N\tO\274\2140\352?\247\257\367\312_O\345\273\266"
+	.ascii	"\222o\306\322\\\033\324\315\234\nV\030\365\0354S\246\204\241"
+	.ascii	"5\233[U\272\272\256,O`2s\023\020s#{Uv\206Dy\257\034\345\335\340"
+	.ascii	"\256\255\364Y-\301m\241\333\333\214\001\237\326\027\036\3177"
+	.ascii	"XX9\353\235&X\3069\377\r\213J\b\024\317Yb;_ue\222\030\315O\274"
+	.ascii	"L\347\206\322\t70\232\235\344\251\237"
+	.string	"\033]\032]\221]U\331\\\025\\\223&\271\351}\366NvY\242i\367\314\344\2752\223\334\224\221\320,4\347V*\031p\0352\355\331H>\342\031\211#\311W\232\271\225\336\nY\333\023\335vr\342\200\323\005\007\246\253\004\317W.\247\263\005\300A\222\206\256\bF=M^\272;N\216\232\017\246\267\245\222\335[\023\216$y\311M\304iq\301\250WN\202\233]\220\230\235\301\250\353\344\320\330\235\267\223\312\2757\323\216\271\225F:\376\273\177\016\356;\237\377"
+	.string	"wGwvw\021'\3666j\022A\243\227\210%\177\370\206\355\276\266\367\221\024\222\002\251\245#)\036HM\251\215<J\202\364Qn)$Rso\237}t\204\274 j\373 5\367\322\216\001f\3517S\n\271\217\242\266\317>\332\311\rHGRKH\315\344\222\017RSji7\245v\317>J*i\034m\245\317nJ\225\331\315\250\245\036\244f\324\022RSJ\311\303\321\330R\303\364$R\345\346\331\220\2166\216\244\247\244\262g\r\211\031\265\337\366\376/\031[y\300\336OQ\312\267$\217\0373Z\303at%\031\365\032\222\214\246\242\366\321\032\022\223\250\275\231\030\rwR\004H\346\332\266\3725$\325\323\276!c\357"
+	.string	"\222\366F\376^\333{#\367\336\001>\364p\034\276\352\320\207b;4\324\002\003\020\036\213-\320\367\252-Q\270{W\241\337\212\013\264\333\276@\225D\005B\022?\353\321][\024M\250x\327\022A\326\230am\341\022Y\340;\216\b\022\211\332\341QHB\325\301\260\263\363\241\207\017A\"K\304B\003N\261e\201\210\306!\023\352K\\/\360Q\341\243\302\205\232\242\305\352\032y|\350\001\350~"
+	.string	"\376\b\327\024/R\274\305\325u\211\200\027\212\210F\343\b\243\212\237\337\013\365\204P\210\343\035^\266h\302\250\"h\301\201\254\273\026W!\355\021\204h \204\210\027=\027!\201\003\0228\300s\021\022\004\005I\020\"H{\210\240\374\256\351j,ZQlY\023B!\006b\333V\220\356zo\b\254\361\230\n\205\277c\212\"\310\032u`\f\323\037\214a\332\003c8\004\276m\361\365\241\207 k\004\362\326\270\272\037\336\266u?\344\220\370c*\f\262F\036\2127\361\027|\2205f\024F\242`\221\355 C\216\013\325\003\"\025A\326\370+\262'\336\021A\326\330\263\266X\211</p\025\n\177\326`;\224\276\356j|\261\246/\221}\323b\013\203u\333!P\321\313\266P\335\022\354[TyV"
+	.ascii	"\340\266\257\352\256\027R\270P\213|\210+\0208\342\027\024\352"
+	.ascii	"\t\022\333\341q\005Z\207\330\327W\244\022\327`\316\205\237cq"
+	.ascii	"5\016\265\026\004Y\024\257\312\242\305\317\212\240\253\272p["
+	.ascii	"\022\301u\025b\340\361\301\030\246\017\034\217\252\321EK\364"
+	.ascii	")r\327\026-pu\323\341Qu\201\277\037\206\267\375\365\2609*\320"
+	.ascii	"\221}\241\246BD,\326`\006\237\343P\032T\327\241\032B\333\022"
+	.ascii	"Sw-\262\252\373\246\255\013T5\364\370\270\255\353\256\031\204"
+	.ascii	"\302\366%\002\246\300\364\310B\265\260\032\213\336\364\001w}"
+	.ascii	"\211\254\320\002\214aZd\3374D"
+	.string	"\220\2061\034r\3277\230\n\215\304\264X\024\274\260\006\333\023\305\025\350\256(V\b\220\301J\024*\216\310Pd\325\022>\357z\\S\270\253\220\020\353\256p\321\022\211#\210\255\373\026[\013\206\300\"\221J$ ]\217D\026^\250\304\325M]\250EiP\350B\261e_\025\006\353\252k\221\315\340=\022\271\303\367gWdU!\337\n,\252-\202jp\347%2\276Dm\352\266o;d\201\367\026\211Z`J$\256\3004m_\"5\003\361}[w\370\262\307\242\352\276@\357\261mY\244B\241v\325!\020]\207T\rV\"+l]c\316\220\321M\213\354\220Np]\215\307\364-\256C\357\221\b\204\240\212\201\027d\215\277\365\250\256.\260\310\256\304 \353c<\246o*\342-\262D=\017\n\262`\003\007\032\224\320@\017o\221m\215\357zL\203\353\253\022[\243\273\276E\366\303;\024b\211\302\017EV\035\372"
+	.string	"t\217\037<,\360\262C,1]_\325M_\250C\001\202\255\250RYE\305\244BF\206FDF\2224\351\302\n\020\006Ei$\307\316\003\022\3403E\020\204\214\321\214$)H\235\375\331\r\310\240\b\265\030\375\036\343\362\034\355\272[\260S\221\271\037 X0\013\203N5AU\007\244\276\017cL\274$\027\331\025\253\210\036FlE\025\233\373p\017\342Z,\024\224\231\"\330E\301\260\373\312c\304\327\252N\304\003\227\262-X\260B!G\207*"
+	.string	"sK'\256\b\216\224\200\327\265Yo.~\272\253\246\365\312A\265\206\002a@\354\231\320$\313\262\006\334\232#\022\343\325"
+	.ascii	"#\\\020\210\201\\\267)#\013\227{\262\330\211\303\337\352Fu\016"
+	.ascii	"\027x\304B6PKt\220\374\226x8;[\372\225$\331~*\215G(\265\026\313"
+	.ascii	"\240i\315M!9\325N\352&\344N\022\257\371\335\360\244\242\316y"
+	.ascii	"\032\301\216\313J\002\276^\f%"
+	.string	"\0027h\275\016\263\302\207\001*\232\031%\237\331m0\004\217x0\275Jz\336\335\314\250\216\374\376\305\"@\266\235\370%2\361o'\324~\b|\356\204\250\263\256\254\305\273m\300GW\235\226I\374\222\347(4C\307k\365\241G4\236b]\317\250\255\351\311\001\250$'\304\332\016\346\r\215\364\365`\361\251\016U\2624\221\260\220\314\332\267>;o\006zKO.DD\376\020\377\225\345\341\244\025_Av Q\"\313\350\230\367&\213{\016\r\277u\363\030\366\267\036AX\024x\346.\262\021\350bC\254EY\375\375\305\0253Ed\177-'u\267_~?\341\200t^\230\255\241\372\337F\035|)G\263\326\366Xv\231\036P\017\023\2422E\2703\223C\360\273\200Dom\364*\372\373\001i;\366\250\212e\206\273\227\230IXZ\\\244\267\222\201\213\341y\247\023|\370N\226\307\273#\234\227\223L\353)O\273Z"
+	.ascii	"\030\316\3014\324\323\347\373\227|\310\377\222T\264\361\027{"
+	.ascii	"\2452\250\030[\031d\205\025\3730L]"
+	.string	"\364\351KxP0\211\177\311\343B\034q\217q\323\224\374\310j\252N\025\207\244\206H\251iJx\231\343\t\317\n'P\353\251\235\270\017\356\327\017\363}\2732\026\224~\224b\342\337/T\303s\3519\005\324)\241\375\253\322\302\336\252\375\324\320\263f:)\353\367\031\202?\317\234\346(\200\242\237\2256\230\277!\301\311\252\032\036\375\034J[\232/^\263lgo\354\265\311\f\257\3464^\037\253Z\2439\345\206\323\303\334\266\214I4\035l\312+l\n\374\306T\236J\323\302\236t\036Zh\370\322\313\224\322c\007\032\366\200\223\307Y\253\207\347\300].\371\376-,UC\246}\344\001\237\2243xe/\006\307\016\n\310\353\004\366\270\001\264q+\237\342&\250\276\006\313\302\225s-\304~\250\215\030\242\273\240\211g\300\217\007\307\322G\032\266\342\352\022\f/\260;]\300\351\277V\020*\375|\275\033\342.\214HH\334\205\317"
+	.ascii	"\3314P'\270?\234\343\334\242\213\314\235\230\020\036\313a-\223"
+	.ascii	"\325\311dRH]\267\037U\227\256=\315\255\270t\213\006\337\035\032"
+	.ascii	"4V\317\351\377\224T+\375\341\033y\306\030\255p\260\2454\332\326"
+	.ascii	"\254\224J'\272\202u\347\340\342\225Hh\333~(\272\316G\363\233"
+	.ascii	"\342\326\274\035`G\236\255"
+	.string	"\353\002:z\206\363\310\363\034\310\341\276|\365\0210\0027"
+	.ascii	"\307\206\f\177\326W\356U\204\304\362\300,GJ\225\3473\220"
+	.string	"\363\"\036\3638>\004-\320*\001\"\005\357.\004l\331\335\177\303\017]\241Y\242\177\254b<\232;^\006a\317\311\342\321\31252\356\242m\327B\037\350vh\357FL\237\343\324\260\366\032n\022\211\360v0\227\331=u8\223\033\323\241\322\320\321\234\006\264\260\341\230\224\333a\317Am\335E\311\216o\351\374k\357\341c\263z\342\270\216GH=\210\225\342\323\355\0054\303R-[@\037;\304>\1773\364\367g\033%\246xv\225\206\231\021\237\031\243\233\005\f\220f^Z\226-o\3715>\204\256g@9;\263u\332E\031\241\216\210\344\206\320\342dO\332=BU\347\240\264\212@\240\365Rf\374\312\255\023C\311\325\334^\301M}\r\336\2469/\322\267\341\240\202%\304EY \342\024J\007'p\224fZ\025x\"\360\347*\213\342^\260\"\205\035\313|\274\210~\362\250\351\245\342\276y\224TH\203[\027\360"
+	.string	"\026\251\264#\230\217\307\t\303t\376H.\201\246\373\213\273\303\203Pjd\217%\345\210\316\214\334\205\311@,:=zF1\212\b\234\203\351\241\303\203\367jt"
+	.string	":6\370W\274\362x\210\367\275Z+\336\323\303\317N\305\227\275\032\230\226^\226'\305\211\245cd\004\336\037\337F\347\2316\211\0379\227\326C,\343\360\003\364\243X\360\372\215\357\bm\276\016\004| \261\031"
+	.ascii	"d\233\240\320\n"
+	.text
+	.section	.gnu.lto_.symtab.8dd3132dd74a29c8,"e",@progbits
+	.string	"interpolatedSpInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"currentRxRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"applyCurve"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"getRawSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8dd3132dd74a29c8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
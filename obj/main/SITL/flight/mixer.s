@@ -0,0 +1,2457 @@
+	.file	"mixer.c"
+	.section	.gnu.lto_.profile.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\366\003E\024"
+	.string	"d\033\352\004"
+	.string	"H"
+	.string	"\273\303\355\350\003\214\001\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\003\003\002\004\002\005\002\004\006\002\006\002\007\002\007\005\b\002\b\004\002\004\003\352\263\360\321\b\006\240\342\234\212\n\007\b\t\n\013\f\r\016\017\020\021\022\023\024\324\317\204\363\013\034\t\002\n\002\004\002\013"
+	.string	"\f\004\002\f"
+	.string	"\002"
+	.string	"\025\026\027\030\031\032\033\373\365\205\353\r\b\007\002\007\034\035\353\252\315\223\t\036\234\363\353\250\003 \r\004\002\016\002\016\004\002\f\037 \313\206\250;\006"
+	.string	"\002"
+	.string	"!\372\242\203\372\004^\002\017\002\017\002"
+	.string	"\002\020\001\002\020\002\004\002\021\022\002\022\002"
+	.string	"\002\023\023\024\002\025\f\002\f$(),\350\300\306\254\005\002-\354\206\342\366\006.\260\216\270\207\006/\333\207\312\212\004\0020\215\304\374\220\n\006\004\002\0041\332\201\320\271\005\016\002\0162\273\355\313\341\006\n\002\026\002\013\0043\323\225\374\231\n*\002\027\002\027"
+	.string	"\002\030\031\002\030\032\002\03245\322\245\257\357\0056\220\236\340\376\004\r\r\002\r\0307\203\341\306\354\b\f8\202\335\331\235\013"
+	.string	"9\343\252\334\277\001\006:\375\242\215\341\f"
+	.string	";\256\330\276\211\r\002<=\316\317\221\317\017>\216\205\223\310\017?\314\311\255\300\001@\235\206\367\317\002A\206\270\257\235\016B\222\254\341\316\003C\221\260\327\363\002D\207\254\251\246\016E\325\233\244\265\013F\334\356\363\332\tG\335\372\220\202\003H\247\327\342\262\fI\254\275\261iJ\321\256\205\311\017K\251\323\316\250\fL\201\340\323\240\001M\204\206\332\243\016N\320\343\254\234\rOP\312\246\347\201\003Q\277\311\322\343\003R\240\342\234\212\n"
+	.ascii	"s\250\201\305\240\220\314\005%I\222\266\003\260\002\")\242\007"
+	.ascii	"\022\300CC\245\241\031S\220\222\026\332\377\r\354\026B\036\315"
+	.ascii	"\256M\336\007\263E\013\2541^\n%\262\267\304\333lu\357\243@WL"
+	.ascii	"\310\337\216\2414R\254\212\026^\364\275\006\233`\bh\333\t\345"
+	.ascii	"V\305\223@\313\306\342\314\024X0U\237\300\243\360\035\211\366"
+	.ascii	"ZrC\220O\245\201)\\(\336O\260\342\202)o\372\353l\311 \351\031"
+	.ascii	"\021\330\272Q\004@\346\003\343`\330\2109A\360\337j\300<\345n"
+	.ascii	"\252\020\374\273\345m&\003\376\033\363!\241w\\p\2327\317E\212"
+	.ascii	"([\006\362\323@\330\200\237\233,\337\035\376|+\273\210\177\322"
+	.ascii	"l{K\2140\212\343\320\226#\023D\221ot\030\026\317G\215\2011"
+	.text
+	.section	.gnu.lto_.ipa_sra.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \362\r\004"
+	.string	"\242\204\016\030\260\2511\f\3030\214Z\222\004m\315H4\26257H\210\026^\244L)\236\323J{\264\320\263\316\3152\273\254$'b\236\307i\234\305\333\022\347@\331\352\302\277\026\254\027\260\n\037"
+	.string	")1,\007\\\r8f\201\214q\335@\203\022\327g(\356\002\230\265\241\001,\2460kW\034"
+	.string	"\276V \304]\200vy>\241\271\n\340\3414V\225\271\244\254"
+	.string	"c\300"
+	.string	"\227=\234\r\225\271/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\246\003\245\021"
+	.string	"\006\030YE"
+	.string	"\263$\215\001`\367\257\273\325*\273 \230\0272\253\364\333\302\205=8\372\275\020\017@ e\001\017\334\274\373\223`f\350z\315\020jl('\320\037\372\256\312\377\327\377\037\250\0163\340\322V\253\222\037\275=\221R\246A"
+	.string	"J"
+	.string	"G"
+	.string	"\373\237hf\276%U\341\360\001\344\300'y\236m\021~\213vA%P)\323\242:H\354\304\314\272@\376\330\n\320"
+	.string	"\251\353\212\306\030a\340k:$'\207\323\021\372kR\032\216\007O\232x\003_)\002z\215|\001\305\026<*c\177\024\315\334"
+	.ascii	"Q\364C\352\353\2625b\334\260\2213T\024\234\340\233\264\207\273"
+	.ascii	"I\215\200\270\233\024\266J&\226.\272\203%\243\002\204\007\245"
+	.ascii	"i\275P\375s\312\331v\315a[]\021\rH\322\"\033\2565\nA:>D/\373"
+	.ascii	"\351\370\020\335\363\204\2703^'\224\2626^'4Z\002\214\222\262"
+	.ascii	"z\260@\201\035\341\3176\370\233\210\220v@i\t\f\201$\362\203\020"
+	.ascii	"#,*$F\030\222\035l\203\277\203\252~\256,\003\375\222\353l\013"
+	.ascii	"\257\206\314 \002\256\251\351\212\237\0341%c\310 \250\225\367"
+	.ascii	"\251~\f\231|\341\363\345\267&\306\b`\013\332n'\357\303\264\255"
+	.ascii	"9y\037\311\025\236EQ+\0273\020\007'\246\026\354\237@\363<M\273"
+	.ascii	"\032:\261\203`\n\033]\250QAD\023\f\315&\2511\214\001p\242\031"
+	.ascii	":*\017\021@%3\216!\241\322$\303n\350\207vT\025\326\240\226\215"
+	.ascii	"A\250w\330\325\303e\270\345\221H\252h`\351X\235\203\275;\371"
+	.ascii	"\337'\303Zb\252E\347%h\375\340-BS_\035\02159)pf\t\027\227\237"
+	.ascii	"\350\013\022\224>\312i\324\314h\307<,M+dF\256\006a\300\312\327"
+	.ascii	"\210\032)T\241x\242/\365\013\\Q~\310\336\231\202\333\374\005"
+	.ascii	"\\\\\334\013e\331~p\n|\206\017\205rf\357\265\013\030p\356\205"
+	.ascii	"\272\330\221\322\375k\260\336&\037!\260\257)\303G\rh\312\016"
+	.ascii	"\3645\257\036\213b\006J\237nk\317\252\301A\030\320N\221\017s"
+	.ascii	"ZV\321\322\365/\301\314qk\004y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\310\001u\t"
+	.string	"\262M+/pK\222\016\374\377\377\350\b{ \370}UUC\304i\340\377\252\"D"
+	.ascii	"\022)\226*\327\237-<\237U\232\251\315\325\354l3\032\333%D\312"
+	.ascii	"\024\277E\245\242\245\230&^\307DFBW_\342#\"\275\n\304?\374\364"
+	.ascii	"\b\016\007\006\005\004]\227\256\377\200ox\206\177\341\025>\363"
+	.ascii	"G\212\364 \243f29\3624N\271F-]?UUU\037c\003\224\220\265\274\004"
+	.ascii	"\200a\371\220Q\221\036\213~\016\302\217\366\022\216\3266.\030"
+	.ascii	"\214\322\213z\017Y\n7\314\214a\333\362\020\247}\001\251I\215"
+	.ascii	"\347AFAd\024\207x\341\264\177\324[\344\320\335\0047 `\002\021"
+	.ascii	"t'\017'\013R\314{\207X$\001{(\360\216p\026\277\301H\027\273\206"
+	.ascii	"\244\213\\F\021x\026\225\325\006\037\344:\022\366O\372n\376g"
+	.ascii	"g\203\317e\334\013\211\332*\241\211\235r\204\210\330\362\025"
+	.ascii	"\226\r@g/\264\350'\003x\227\373\246-u\271\343\bvwec{t\020y\221"
+	.ascii	")\360a\246\303\026ba^\034\"\211\371\nt\305\243\276]_L\360\033"
+	.ascii	"W\303\246hiw\024\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 D\345\001"
+	.string	"B\004\016\026\220+\035e\206\314\314\314J.\332\222\377\377\317"
+	.string	"J\022-x\317\016s\272\322\215.t\237\353\\5\037s\227\253|\311D\3461\215Y|\304\034>\341\006w]\003\314\214\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"-\005"
+	.string	"\002\307\023\033\240)\303\001\360\377\377\345\377\377\303[\3733\332>Y\312\005\213$cY\263\364$S6\234\214\205\"\201P7\327n)\346a\226\017\272\365&\206\302\006\273\363<O\320\300SLLo\026\007 \264\322u\310\023\331\251\247\372\224\236\202\247S\321q\216% \200\202BU\324\003yN\354Q\331[\263\330\004,\247)\nL\270\216\2308\265`\326Y\036.=\373\306\nm7.\303\223\302Z\343\372\214\230\223o\335%0&\340"
+	.ascii	"?\006\215\003!8\t\310\b\343i\003\314@]:\b\325\021\260Sp\b}\250"
+	.ascii	"\205r\003"
+	.text
+	.section	.gnu.lto_.lto.61ea6ec88627b956,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.81.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bi"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\306\341\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\006us\250\305\006uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\024?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.83.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 .M\001"
+	.string	"\370!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177\035\001\003?\202\210\200\030}{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.ascii	"@DJ\320\003(\002"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.87.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007\\"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\317\221\031\006yw\250\364\005yu"
+	.string	"\005\001\006'\001\200\001\005\001\006\035\001\b\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.string	"B\b\021\346\r\240I\310"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_mixerQuadX.96.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.97.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.98.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.99.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY4.100.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.101.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerHex6H.102.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6P.103.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY6.104.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerOctoX8.105.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.106.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.107.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.108.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.109.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\225\005"
+	.string	"D\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200$"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\004\240\270\275\224\304\001{\303\001y\302\001w\301\002\004\244\312\001{\311\001y\310\001w\307\001\244$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\032"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\360"
+	.string	"\020\204\323/\347\032S=@\0173\300uR\021\0016\001sA\031<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerDualcopter.110.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.111.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.112.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.113.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`D\003e\017"
+	.string	"\224\026\020\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\204\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\340%\177q"
+	.string	"\275\312\026\301\025\274\236\270\245\037om\317\024\023\260\245(ki\006\325\324\022\254%\177g\330\021\274\020\244\245\037ec\301\335\017\240%\340\016\274\236\374\244(a_\b\344\343\r\370$a]\347\f\364$a[\352\013\360$kY\325\355\n\354$\177W\275\360\t\274\236\350\244\363\001\344\244(kU\365\007\340$kS\325\370\005\270\244\037oQ\305\375\004\274\236\264\244(\177O\200\002\003\234\236\260$\177M\203\002\274\236\254\244\037KI\206\330\003G3\210\0024\207\002\205\002\204\002\202\002\201\002\377\001\376\001\374\001\373\001\372\001\371\001\367\001\366\0015\364\001\362\001\361\001\357\001\356\001\354\001\353\001\351\001\350\001\346\001\345\001\342\001\341\001\337\001\336\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.ascii	"Z\250\221\264#Fj?\326`\223\304i\003\021 $\323\021N\003U\013\007"
+	.ascii	"\354\022\200\214i0\023\346\2316m\245\361\240L\203i\224x\221\224"
+	.ascii	"\3757@\032r\003\346\222\363\222\3165\323\312iq\312a\201\377\032"
+	.ascii	"\365S\320\t\323\b\206\270(6\037y\017\275\226\210I\344 \t!Pn\006"
+	.ascii	"e\001\301\367A\362-\003z\377\347\331B\021\245F\361&\360\013h"
+	.ascii	"\245\036\001\236\215\350\370\f5(\205\200AW\203:\324)"
+	.text
+	.section	.gnu.lto_getMotorCount.120.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \345}\006"
+	.string	"\362K-4Pm\222\016\244D\214*\237\250f\254M\234\002Eqk\315\005\377\226\354\252\375\273\235\310-\200\232\026\3121Gg\212\320\004E\305\n\030F\331:\252\265\366\311\226)o4\217#Qu\234\247\201\241rXp\017\225B\307m^\204\323\blAp\236\363X\326s\231,\333J\330\006D\215\342\033R\323u;\236\370`\261R\367s)\205\r"
+	.string	"C\204\247\317B\3302\276\226l\245\037\307\026`:I@\311\034\235V\322\204\"\361\370A\237\331\340"
+	.string	"\364\325lct\341(\251\020Q\311\314\\\323\350U\274nAj\371\030I\301H\241\"\006!3G\214t\321[\177\202\277\340\267\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_getMotorMixRange.121.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\022\215/4Pm\222\016$\243\301*\204\361\030\332Q\031\276\246\230\333\370\340Xy\374\305\262\2657\025X\005wX4\303\216\233%\246\210\025\334\302\355\251jw\366\321Z#[\246g0\230\006\302\332<\316\202\202\305\220\360\032,\204\315\313`\017\0173\360\345\240\301\036\347\272\260W\331\262\016\204\356\342q\022_\220n\217n\350\210EX\255\324]T\225B\027`\341\301\322o\035t\030\337)\035\350\213\243\263\220\234\034\214dR\224R\322\204\022\331\370\263\257\334\216zd?\2326\215PI\244\211\020\224\314|\227\nT\245\246Z\252R.\243Y1\273\375\350\304!*\321>\235\"\200Af\216\332\247\242\273\376\004\177\301\177\021\b"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_areMotorsRunning.122.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\f\001\225\r"
+	.string	"\326Y]E\020\217(\035\020`\310\032\347\341\tp\241\325eWt\ry\343\270\b\200g@\273T\024\315*s\301\335\265\372g\016\254\302\236\003\214[\036P\212 +\004\203\020\340\363\\J\262\300bGVj\fF>\331[\312\224\002H"
+	.string	"F"
+	.string	"J"
+	.string	"\022\325\321\232*\216G\023\300\036\335a@\344\356S\003\352*/L,\031R\316lS:\355\016W;_\343\001WP\300\234\274\321!\206\341\013\300#A\216\224\362\337\265\304+\251j<\244\224\326\223w\341\216\267\255\300v\002\373]\266\252\343W7\334\253nU\3655\005VN2\250\300\354\212)Q32\322%\232\350\360\325\257\272\332\267\017\302g\361\346!>E_\271\205S\232\322s\320r\221\b\260G\316\005\\\217\360\001\256\213\374\317\233\253:\316h\006\246\226r\034n\211\215\251M\001\244?\351\356\216~\340%\305\206\335\2247\256\270\377\216\275\210hQ\322\030\377\033\3277\256\325dB\372\210\263D|\016\2560\242?=\372#\333IQq\362\231\220\350\214=G\272)\027\254\017'\274(\001\332C>\332\347#\322"
+	.string	"\304m\241\315\243\341\217\016\007bA\363d\241\b!\232\004\b\331G{\340\311>8P\326\031\340m\002\b\227\205\266\215\3136S~Q\374\357\fX\304\230Z\372w\227\341\352\2567\206\207\0223`\220,\251\005n\312g\371\002\0222\001\026"
+	.ascii	"r\b\370U\323\240\006\226\342r\016\254\336\025\201\0232\343\032"
+	.ascii	"\215\220b\202r\315\020\204\b\200\212}\013\007\200\tX\255>\214"
+	.ascii	"\205D\021\035*\242p\227\0305\344P\223\267\253\224\001"
+	.text
+	.section	.gnu.lto_mixerIsTricopter.123.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"m\007"
+	.string	"\342M25Po\322\001 ;\323\216\017\373\2550Kh\304\200@\3367\002\254\274\226e\315\242d=\332\016CJ"
+	.string	"\321\232rf6\321D\337u\222\342"
+	.string	"\006\351\203l\"eJ\001\276X\020Sqe\236\346\301\341\202hx\021\027C\346]\340\304\263\b\214I`\340\323`\030|U\334O\253#\325\202\217\202\234zU\275v1\220\377\206rz\275F\002}\344$\033\337\303\024\234\374v\347s\250;\247\001\030\237,\331\321\223\252a\177Z\035\331\231vNk\372\224@\310\312\302\311n\250\324\262*\216\364a\273cWFH\3508{\344\b\275#C3a\331\215O7\236=3\377\"w ()\233\310\363\004P\330]\347&\262\270\365\266\rl\037\330.\t\r"
+	.ascii	"2\241\215\037X\307\304\2028p\231L\242\021*\020\327\3045\004\225"
+	.ascii	"\237X\202\345p\315\231\204\371\004"
+	.text
+	.section	.gnu.lto_initEscEndpoints.124.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\007\002\245\020"
+	.string	"\246\036lF\360\264$\0358>\363\177\313\210~\020\t\347a\220\256\376B%\346\361\225\234\036\\\272J\330\263Z\351\222\332\337\232R\f\203\222\312\"P\3140\255\\\233v\370\276\350Z\344\273\236W\245"
+	.string	"N\215\373\307o\204l\"eJ\001V"
+	.string	"Q"
+	.string	"X"
+	.string	"2>\343\364\225C\022J\204\311\f\021\013\243\335e\360h\005\244\307\223\033\300\036\257\023\300\036}\262\213\016\252\330\367\254\240\3419\332]MS\374\364K\363\344g)$\237\n\365\213\3045\200J\346:\331\335\353<kT1\231Y\312\356:?\325\210;\3366\004\333\016\354\374\020\244\335m\340\333"
+	.ascii	"\321\201\204\003\203=\246\222\254N\343;0>\216_L\371\357\3217"
+	.ascii	"a\217\327\354f\007\214\022\251l\331 *\365\306\376\265\273k\265"
+	.ascii	"\261\263\257\356x\245/Mk\246\363\351\0030\031\342\203\002\320"
+	.ascii	"n\210\226\221\035\212>-\276\372\355_\307%~\340q\230E\332M\375"
+	.ascii	"\363o\274\307\241[\314\312\177fa\217Q\355MC\376\363\202\242\023"
+	.ascii	"kBQWx\024D;\340\372A\253%Df7\225\340\322L\365g\306EL\266\254"
+	.ascii	"z\351\201\237\031\243T\325\307\b\nBs$w\027\245z\343\037\357\260"
+	.ascii	"\324\0135\204d\262\210m\356<]\336\306m\021<\223\213g\222P\352"
+	.ascii	"\274\216\023\340\025\224\022\213\207\215\323\274\f-\333\006\f"
+	.ascii	"\032\207M\205\323VJ/\032\n\002w.,%\315\353\272\222V\002\356\257"
+	.ascii	"U\033\037HN\017\315\224\313Y\245\303oF\255\231@d(\2451Ev\267"
+	.ascii	"@\220\303\n\031\217\320\213\243\001y\360<\200,\374\350P\361\311"
+	.ascii	"\261\022\262X\036+ \320\002\231\300\306\016\365\320F\017\241"
+	.ascii	"\025\305=\024n\341\"\201\272+@B\3541o\rW\202\324\001\254\312"
+	.ascii	"/\302l2?\204\331\004~\t\273I\374$\fq^\224\033\372d\t[@\361\020"
+	.ascii	"\215/l\207\317B\352\357\b\223\370@\343\212\203\263\370}\274\263"
+	.ascii	"\n\243\370.\247\330\002\310\244\001K\226\333\256\245\007"
+	.text
+	.section	.gnu.lto_mixerInit.125.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\017\001\035\r"
+	.string	"&\230WC\020\261$\0358"
+	.string	"\006Wj\017jP\305\324;\265\t\215@1\024\340\2166\222J~z\214\234e\026bC\310\376\032\177\3610\300v\275JP\212P*&"
+	.string	"\005\004\307@\005\377h0e\244A\330\336[\312\224\002B"
+	.string	"A"
+	.string	"A"
+	.string	"\360}@<tf\327x\247\262\177\3412\222\301\261\273\226\232x\366\247\231\371\2079\265q$\177'\327\227\340&\206\r\001\\\311\363\230\254l\207yz\340\264L"
+	.string	"\rv\327\271q\037nx\333\016l3\260\277\005\351\316KS/=i:\376\345\327\212@\212\031\021n\354\232\224r,\t\322\260\370+\0363\362\316\032\302\246:\264G\354\352\360\225\355\247\375\226\273d\177\t\231\332%\3212\263\333-0\202\351\360\300=\361\001\017\305\250\223~D\243e\311.\242>\346\nP\300\300A\241\322\2766\3447g\r\b\222\246$V\365[\\&\344\2370\210H~;\364E\342!\264\221\2013B\224%\273\323RK\330\177\273\273\326\024\373\005\237\t\327\003\312\036\035\330\247\003\350\303\n\261P\001\204\201\202\225\001$\341\303\362\300@\254\016\003\2764|0+\344\2720\253\352D\177\253)\206\240\202$R\355]\bP#\342*973j\016\261\243(+,,h\224d\216)\235\264\243\037\235\024\240\036\033"
+	.string	"`\2212\023\017\222\206\333\032\240\321\254\020e"
+	.string	"\332\005\231\201\t"
+	.ascii	"W%\263K5#\326\226\005`\002\332%\363+X\205U\214\356*\013\313e"
+	.ascii	"`S\241\203\206\271B$buE\\\313S\t9\245P{"
+	.text
+	.section	.gnu.lto_loadLaunchControlMixer.126.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\t\002\275\020"
+	.string	"F\235lH\320\322(\035\030\341\262\231\232\025R%\300 \321#A\305\340T\304dhFn7\355s\035\300\255E\270\235'\334\177\253S\236t\267\312\351J\200\243\315 W3\370P\241\0060\352\230;\271\"\326&\033n\250\021B6\3312\245V"
+	.string	"T"
+	.string	"["
+	.string	"\022\204\301w\343\355i\353\2377;\251-?\347\006j\334d\242\353_\367\311\314n\214\2100\035\352\350\346\341\3435F\204\251'B\202\346s\346]WR\364a\307\210\250\241#\251\021\352`\022c*?\336d\350&\023i\256\037\203\335\265\312D\0167x\3333\333&\2666\b1\244\244\331\243KQG/#,m\354\322un\275\372\"\002\220\212\034\340\330\335\220KZ\242\371#\342:\267\177\302\037m:\212\327Z\327q\020\350\232\201<=<|\354\356\311\247\023\200\237\005\036\300\373\354\016\300\373\274\311-\273\307\307\233}\217\016\230\035\334\356\206\001%p/\315\301\360ya\232I\302\341n\302\205\315F'i\266\217m=p\271\262\t\305\024\311\266\205\367\330\247\344fw\027\264`\021\370dqY\242%\341\324xX\247\025+v\313U\260\006\344\330]\224\237\342\266\013~\210Ogp\321\313>}\227\361\b~"
+	.string	"\301\371yiN\362\310\004\t\251\033\345\264J\301\220R\tY$DHM\200\020RH=P\tQV+\341\211\304\252\n)\253\220E\245Z\205\246q/m\374\234\2033\204\020\275$\354\2234\1774fIJ#=\271\312\030\007y*_\263\031\305\024\351\335\356\256\247\340*K\262e\350\366R\003\323\234\002M\325\203d"
+	.ascii	"\355\f\t, \260\202\241)\343\006\002\201=\217\324\311\242\224"
+	.ascii	"\262,\023\232\217(\302\335\332#\324\020\301\262\215\307u0A}\247"
+	.ascii	"(\006\307\301|\bnR\303\372\323\345&\003\342\020\2139\222\255"
+	.ascii	"b\241\030\31293\r&q\230u\250\245\345\226\356\0041\247\355\004"
+	.ascii	"\277\225/D\310\214\307\215\355\200hC\326\357\033\257n\347\202"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.127.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\303\t\0353"
+	.string	"\332U\320\022DPdN:c\322\230j\372rS\204p\351\027!\314!\203\034a\241-U\006]Q\251&%\367\307=F'\303\247\253\252k\254NAPA\"\200"
+	.string	"`("
+	.string	"\002p\301\241\266L\361a\375\236n\215\020\"w\222\001\034\001\013\001\034\001:\370_\376\344\3031\321Kr\307\235<bO\355\336\3736\276\027\276\333\273\354\370\033\233\021j\205\t\343\350\354"
+	.string	"\336{\217W\231\201\360\352\323\225\326\253\351\223\326\253\314;\230\211WUb\222\371\316\337\320\356\355\276\274\300D\357\275\310vr\224\024d\341\323\267sQM\036@\022\222\322\221\321\250\250HD\\\032\032\n\203\253\232\266M\362\203\023\206_bZ\007\220&\006\212M\212r\244(W\222\002\307\264GOnD\273Q\212\200/\f-\035"
+	.string	"\227\304\026\245A\036@\246|*\020\240\336\363\216\330bpB\2231$'\262ON\374\026\222/\245IF\352\372\236w(\007}X\312\246\330!\250%ce\037\362\205\225\031\261\3024\b\026\326w\2760\263t*\017\236\262\327\361\260A+E\276\246\022\332\324\236\024\211)\323\376\022\207\346u\207\272\022ff\325\264\001s\215\220\363\205\221\245Jo\230\324I\205E\336Eb]\351\323\275\367l\267K1.k\203\023\356\275l\277\304\306\316Lg~\034f\266\300,\004\013a\354\326\334N\246M_\032\265\233\034\200\355\377\001\345\371\327e\003\275\200\332\223,M\217\347\324\036\237\366\222\317oZO"
+	.string	"\326\004\332lc\355V\361\204v\331@l\373\335}/!\002,\323O\254L\375\276\227\036\327\231\2439\221\302\312j\275\312\324\304&qkd\277Z\371z's\305Oc\026X\366_X\353UU\031F\215\317\226\rd~\343\262\335d\376T\036e\025\3563\346\005\007T\313R\177\236\243\240>w~R-;5\021\030\262\314t\274\263\321hh\271h\265\\\fZ&\022Z&\n-\017\005-\017W\313\302\325rp\265\274\252\226\325\323\235\323\324r\247\226mj\371\017\006\024z\323\242\315\275@\002\007]7\252\036\225?\377\271\037\357\247{\312\374<&&\351\354\250"
+	.ascii	"\252D\354\324p\334\216\207\312\273(\363\235\374\272\020\177o"
+	.ascii	"\316\250\334\347\370b\342\222WLBT\316\031\325q'\253Z\242Lg\030"
+	.ascii	"~\234\216\247\256\267\250\250\234\363\030\366\246v\3132b\017"
+	.ascii	"\233\250\257\314rV\263\0165\261\257\274b\354\241~\336/\214\321"
+	.ascii	"\211\363*\264e\003\233\241hg`D\335d\253\036o\203\307\333\342"
+	.ascii	"\361\207\273\020P\333\336\320\361\013"
+	.string	"z\311\304\027\305\374|-q\205u\330YO(\205\017\252\220\300OP\006%\277@\303\036\236A\2636t?\217\006\225f\242|\206V\250\300\031v\223\257Va\027\320\022\345\271'\354c\345|\017\006$\0323{\270\236\fMh\367vM\001>\217\206\224C\207\265\303zUx\354+\003\310\r\211\257\r\030a7\271lmjN;m\243^\262\231\325\250\177\347\t\375\177\307\354\n\234\240\203\033uS\177\354/.\330v\376\245\347W\353\332\301\276\222\t]\033\231%\312l#\373\235\337\0349T\005\374\370p\036\347C\225\375W\325z5\307\037\236e\231\334\217et\025\301\314VJ\355/y\3761\203\270\033\021\033\262\3701\235\367vE8\0363\212\267\241\n2}8\3258\357\275Sl\276G\202\237v\225KT\315\350\327\235A\334\002\353l\005!\353\352\006\326\013d\215\026,\260\\\254@\302\300J\361\002i\225E\003\ta"
+	.string	"\307\220q\225\205\254\021#F\026\222\370\266\365>c\266[@\003\b\bp\253\271"
+	.ascii	"t\223\203i\220\240\272\241J\307?=%=5T\347\210\3429\365\347\230"
+	.ascii	"\223nV\t\3431\261e\332$I,Z\222[\222[V\266f\366\b\343%\327\370"
+	.ascii	"\356|\267^u\352\213\271es\242!)\365\031\2471\036hN\211\013:\252"
+	.ascii	"\227w\036\325w{B\237\336{\357QT\037\350\034{x\224L.#\bKV\204"
+	.ascii	"\b\030Bj\321-\033\030dL\2148dP4\312\245\356\311g\324M\306\223"
+	.ascii	"\352\254\347\232?9\311f\301\030\017\001\332\2757\302\017*'?\037"
+	.ascii	"R=l\016Zs\373\242\202`{\374\311\234\344b\275\250\f(\223mUpW\320"
+	.ascii	"\347\317\232^\307\201\001\032S\324M&B\211\b\264\n]:\336\330K"
+	.ascii	"c\027u\205\275b\027\365\275\nm\331\256b;\375\375\017\2272\262"
+	.ascii	"\242\261\t\364\235\320\300B+\222]\016\347w\357}\0323\233\260"
+	.ascii	"ZTM\001\200\321\250\2010\304\0303\b\021\311H\222\244\222\016"
+	.ascii	"\220\002\221\251:n\021p)d\254D$\315\262\033\001\362\207\301\357"
+	.ascii	"\177\034\272\377\034\372\210n\317V\365 N\325\254Y\237=~\231\333"
+	.ascii	")\013\333\2054\016\227\354\255\221\352\027\"\\\200*-\267hI{t"
+	.ascii	"\030\022\263u\337\265\355*\031fF\304\370\250\024\230\346\370"
+	.ascii	"\013\273\313F:\314\205\207*\001\305\212c\026p7\356)5g\331"
+	.string	"\002NP\252\240\202\310!\r\341\336/U#\331F\266t\301\224\223\375\256\036\341D\244r\016\251\265\336\2069\020\357:\026\250\336\313?t\334{X\372\364\346G\240\263\305brC\005\362&\025\255\022V\247\256\335\360#\204\217\352s,)\267W\203\377\372#\344\031\023]\026\212\325\217-C\375d\317\002Pp\003\273\263Bz9\236\346\340\"i$\353\274Ma\026k\225tO[\025S\224\242\031\302\211\266\003\357\200\204`4\177\332K\275\265\224\023\254\353|N@\201\266\377\246\273\223\211\031\372\201@\221\255&\250=\221P\360\004G`\206\270Q,\021.i\246\243&\213-\264\357\342I\2767\036fx<H\203C\t\324\336Upc\332\202?(\037\263M\216\210\251\032\007\"\326\353|qU\244\343\333\211x>2\201+\016\367v\206WX\250|\201\227\b\277\240?\205\003G\276Ey9\202I\337\211\353\n\260\007bP\364"
+	.ascii	"4\226\027\230l\337\232\334\016\327\013\362l\373\367\f\367&T\351"
+	.ascii	"|\\\002\031@\214\024D\244S1\344\354\304\361\265\316\365\3121"
+	.ascii	"\313\003\\\3774\007]\262!\357\017"
+	.text
+	.section	.gnu.lto_mixerLoadMix.128.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\236\003\225\032"
+	.string	"&\261\253I\240\230Q:\300k\274\t\372Z&\360\022\004l\232I\277Mu\373\007\031\235yt}\007\327\374h\013\314nB\377v1\234\324\256c+\343\334i\3415x\025^\207\251\203\213\321:(Bo\200\205\327@:\027}B\b\331r\247\024\226"
+	.string	"\213"
+	.string	"\231"
+	.ascii	"\265\276\270\301Tk}YAy\321\300e\306\213\364\256\361\242m\366"
+	.ascii	"\324}\274\372\245!@GU\265V\330\306\370\360C\322\345\251\357\246"
+	.ascii	"k{I\216+\221\356\264\371\277\317\024V~B\245\235\317KJ\212(a\343"
+	.ascii	"7Z\250\232\236\224\233\344K\016\025\037K\025_Q\027\213\"\301"
+	.ascii	"'\375\200\024\241\025tAp\307\320\177?\240C\210\305\024)IB(\b"
+	.ascii	"`'\202\336\\\2612\244\333\341&\315q\342{\244O%B\234Piw\342\223"
+	.ascii	"\204Pk\365\f\332\231\270_n\333\311\366\003{ksh\373|\346\026\331"
+	.ascii	"\277\271\222\303\341%\262gdn\364\273\336\273c\336\373a\016\274"
+	.ascii	"[?\272Y\237~\021\247Ws\272\244\323\344N\217;-\322i:\247w\247"
+	.ascii	"\347N\177\200\315\026\027-j(\255\320WK\f\267\324("
+	.string	"b\323\215\003\377\243$\003?\276\272\223 \305\304G\325\205\370HGv*}\204J\340\222\021\252Zk\315E;(/N\226\355\351{\020\333\215B<\246V\"'L\265\372^\206\225\027\355+?\355\373\370\017\333{v\362*O\020\365d\304j\211>\214t-\330\216=I\316\f\257\326\037\033\333\023\336$\013\020U\353\317\r\323\221h\240:\263\361A\263\375\3574A\251\036\275\233\270E&\237vf\227\312\2549kuv\032Y\373\336\217\312\317\324rZk\255\224\2653\013\242\n\226\334\021\004v\207\027\361\221\002\274Z\253\215O\244\247& \212F\210\361\"\r\257\3526\207\236\353\332\335\347x\300\334P\343w\356s:X\373=\322\351S\225!P\227\333\034\356\002IdA\262^p\230\215\331\205\021\304\t\221\\\340\002\262\327h\261\036Y\004\235\031O\315\003N\253'vaG&\032\207\001-\326#\323\201\361d\310\221m\300"
+	.ascii	"\333\221U\320\201\341\320j0\006\004<\343\020\243\301xf3\032\214"
+	.ascii	"\345\253_\242\337K( Qn\213+\267\310\001\202F\231\025g\254j\336"
+	.ascii	"Z]k\352\367d\265/{\240.7S8T\205\327\223\214\246\311j_2z\2679"
+	.ascii	"\374\234\302E\213\216l\255\314\236J\n\312\227p\300i\300\363s"
+	.ascii	"F\";\265\002+\245\033\272\271\266\334]\032\227.\371!\027wl\255"
+	.ascii	"\270O\372\013\306\024N\b\234F(Z\340\306-\362\003E\250Q$\243\220"
+	.ascii	"\204\0022\023\310\004BcZh1P\002!\307\312<\020hg\233d\031\003"
+	.ascii	"\021\344Z\251`t\254-;\222\037m\343\313\b\264\244l!\226=<e\361"
+	.ascii	"0@\353p\345\242aM\264@\216\t\376W\354?\024\262s&$c\2105-r\003"
+	.ascii	"\320\376)\243\362\017FHo\274?\016\370^%Wo)\f\322\374\234\n\203"
+	.ascii	"\240X8\273\n\357j\007\252\221\305C(;\342P\240[Z\340uo\274\024"
+	.ascii	"\faj\3543\214\255#\\\271\006\2023\305\340\370\3528up\230\350"
+	.ascii	"\\\327\267\212\006m\274\204\242\002"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.129.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\t\001\375\f"
+	.string	"\246\230XC\020\221\223\016\033~\206\344\bz\260d!\257\245\251\275\364\275\342\b\202O1\337\243\362\273\323\021\314\334:\326\266\355\007"
+	.string	"\327O\320\352e\376p"
+	.string	""
+	.string	""
+	.string	"@\021\n\\\256\251V\220\222c\220\022\227\020\262\267\224)\005C"
+	.string	"E"
+	.string	"E"
+	.ascii	"\245\323\356^\n\302\326_\274_\202\016\237&\310\207\371\201\223"
+	.ascii	"\fm\013\035\276*"
+	.string	"E%\006\200\r\303\363\334\324\360\360\370D\331F\371H\254\\\037\3379q\332\266\362\254\026\354\256S\3338\334\324mg\266;\366A\002#\254-\366I\244;\237~U\200\005\306\247\333\335\320\351\330\032\330B\304I\267\177\302\217\346\034\305c@'\231\306\n\251X&N\203\215\335\3658t\002\353\320\300\005P\207\357\001\250\303s\f\262i<\206\330\257\330\221!jr\342N>\214\262\363\325\266\311M\346\006\314\330]\217_\272\212\t\376\313\241)\224\224h7D\331\331Oq\031s\376\213-x&\257\035\372\236\321\307#(Q2\301\"\312N\325\224\202\203\205\252\213\035C\351\2719\t\330\035\362\221\211T\300F.\022\007\r\260\007\f.\b\030\310\310\025\222I\270>\b\370\023A$\273H>\237\354\342\304\275\266\300\334z\321\241F\244#\250.\256\\(\245j\223\036OE1\r\225\372\030\031\233\013\231\343ow\367Y\301S\251\027"
+	.ascii	"1\003\373\334q@\343\224}Yb\326|\210\342<\2042T\212\210\232\003"
+	.ascii	"1\366aZ\202v[\342o\233\030\272\220\301\352\364K\023\201c\034"
+	.ascii	"\276Q\366BU\343\375$\322\271\346\023"
+	.text
+	.section	.gnu.lto_writeMotors.130.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \370\305\006"
+	.string	"\322\214/5PO\222\016 [\036-)>\"\351\354"
+	.string	"&x\020\200\237i\262\b\255?\332\266G<_X\2757X\367\317\232\b3\343fL\267\300B\3701\276b\265O\210L\001o4\026\347Cu\240\247\201\201rX\200\017\224B\007n\254\b\250!\270\202\340X\320SU\026\314h\331'J \331@\317\342\311\325\244\3325\340\222\tj\274'E\221\270 \225\236\270\\c\245{M\225\236\242\3025\356XD\266\213\227\275\226\271\327\361\005\310'\372W0\322\362\031ej\214br\223VB\376f\306\376\245\332GV%\003#\005&3\341\363(V\207\335\226T \206\262\272"
+	.string	"\204\314\334\305\320F\177\375\r\376\203\237#\b"
+	.ascii	"3\001K8\023\350\370\032\327D\262\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_stopMotors.132.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\375\001\345\021"
+	.string	"\246\242wG\360\360$\035\362\3325\243b0\321\361\214\374\306\022a\0022\026\326\0039R\341\031\237\027\330\342\201t\241\027B\265/\2161\016;\355\027\307\203Ru4\023\331\302\362\275\020f\027\2718\232\201u\230\331P#\204l\"eJ\001`"
+	.string	"`"
+	.string	"d"
+	.string	"\346\216\\\270\\\204K\222@\354n\352\321~\261S\217\231r\313\246qX\317>\346C3\204cw=\355\340\356\032\354\326\262\365\250i\266|\240'\310\021~ \314\243\306\311\330x\b"
+	.ascii	"\312h$O2\243\207\317\032\360\225\332\017\316\365\341C\234\232"
+	.ascii	">\020\347\3115\330]\347\007n\270\267"
+	.string	"\333f\261\035b\247I\312c\237\244\347If\335\261\2674*\246;\356D\367\246\351\250\245S\323\007\200@\026CC\215]\233\231\216]\212F\037N\364\333\367\211\036\344\207N\r\265\f\022\003[\360fwEN\302\037z\211\233p\371\t#u07]\030\323\221\355\256\310\243\025t\217 \377\330\036\265\023\330\\\354\217\270\320\313\203\0024;X\274E\212\212J\265=vj`F\216\266\273\253-\370\246\234\236\203S\323\214\316+g\216\372 \233\365\"\307\004\364\354.\211\257\342+(\370>\217^Y\255\276\033\256\23495\352\303kGN\263\031\231\206I2\240*\217\246~F\351(\236\3021\337\307\027\\\224\377\\\264=^K\222B\344\270rf\303^\031\252\033e\204\225\222A\265\342\265LPQU\220\340\261\250NV<\024\026\006o\344\200W\026RX^\313j\305\362R0\327u\307\021l,\271\364\345\002\311\340&\233\375"
+	.ascii	"\002\320=\224`\f\310\303\216\264\372\220\261\353\372w$t\202\222"
+	.ascii	"\377|\241{(\375,\305(LT\036\243\230\224SeJ\221oZc\333(\335\324"
+	.ascii	"\301\213\230|r\247(}& P\002A(\245\007b\002\217ud\035[6\rC\324"
+	.ascii	"\301\315\002-\323W\236GC>\005\\5\037\251\234\354\026\347)>\333"
+	.ascii	"\020\200\342\202\200\316\007\030\327\354\246\305\300\335lK\222"
+	.ascii	"\233\016\277\017%\211`\266{/m\244F\334\255\021\317\376\332\355"
+	.ascii	"\034\303\356Fb\241j\274?\221\316\205\237"
+	.text
+	.section	.gnu.lto_calculateThrottleAndCurrentMotorEndpoints.140.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\273\023-V"
+	.ascii	"J\213\004\037N V\322\351\363lfo\345\2467\344\312\017\024J\374"
+	.ascii	"\fUV\263\253p~\220\244o\007\206\264\351\222Dy\300\205\"\004%"
+	.ascii	"\254\240\263\023&0w\257b\001\003\211\257\024u\371\247\307\257"
+	.ascii	"\374\0013\227\"!b\246\252\232\265^j\264\311\356\226RJ\001\313"
+	.ascii	"\001\257\001\352\001\3169Bg\034\241\363\215\320\331&\350L\f:"
+	.ascii	"\017\203\316l\320Y(t\016\n\235\201A\347\025\350\374[\235\325"
+	.ascii	"\240s\nt\366\325\271;\251\232]\275&P\370r\357VT\315\365\222\306"
+	.ascii	"Ai\270ng\267Zw[\267[7Z\377\\\365\324\201\314\315\334W\270\237"
+	.ascii	",\204\033a\275\342Z\335\314@\273\331?p\003\321k\035D\277\261"
+	.ascii	"\320\255\204\342\361\346bm\315\2151Y\331\332\212\261\333JX/\226"
+	.ascii	"U\371\354bw/Z+\327No\274uT\265\023|\327J\217\221\031\031\233"
+	.ascii	"Z;u\236\320\327\353:\022;\220)-X;\355Nc!3\243\361s\275\342\352"
+	.ascii	"I\2321\302\356\336\373\242S^Z\333\231\273\254\315\214}\226\202"
+	.ascii	"\357\346b\205\025\301r/\032\022\267X;-6\217\332\251\257u\324"
+	.ascii	"N\331\310\\\246\321\232\334\037\024\267,5\275{\257\322\333\320"
+	.ascii	"\306>*\032\025\021\r\t\005\001\375\370\364\360\354\350\344\340"
+	.ascii	"\334\330\020\207\2540\b\\\177j\352{7r\377\230P,\361\220_\202"
+	.ascii	"\350\272\352\243\266.z[\033U\351\":\256*gN4T\326Be>x\220O\207"
+	.ascii	"\"d@\315\376iNq\037*=bP\234G,\007\337\3219b\342\205C\347\334"
+	.ascii	"\320878\361\233'M\334\246\217fM\3741\005\313\310\2504\301\304"
+	.ascii	"\013\254\207_\315\372x\220\b\033\323t\\_>\027`G\270\320Q\270"
+	.ascii	"\222\270PI\320\307\263%\246l:.\031|.\354\262\344\365[\037E\341"
+	.ascii	"B\342\300\243U\235\262\007\246\f\312\304k\331\277V\330\225\345"
+	.ascii	"j\362-\313\323\027\332G\354R\341\r\313\237\216\313\212\257x\357"
+	.ascii	"\355\264v\255.\244\373\217\351\336\313\256\354\362jF\321\314"
+	.ascii	"N\0013\2631\343\310\020\354\013\337\307\373\224H\216m\360\354"
+	.ascii	"\377\324\262\366\310\214\021\3760kM\363\314\203\277\301\373\232"
+	.ascii	"$\025\022\332f9\025\370\301\377\235I\202\255\017\374\316\332"
+	.ascii	";z"
+	.string	"TJ\203\371\262~?\033\251\0075\3203\264{\357\257\215M\365\367N\245\207N\302\330\244\353:\243\017F3c\025c\025\265\323\337'\020F}f\\\253_\345\024c\344<\335\24427\200\303[\251>\261\213\021^\260\376*M\237\233K\317\225 \002\004\020\250)\357\216\034A\0331\301z/\326\fn\"\272\210\n\270\237`\200\201\332i\372B\2663\315\263{\357\365\021\2519\326;g\230n\"\325?\307\263g\265H\2172\267\226\226\333\301\375\2043\320\300[\251\301\367[\257\350\001\017\332\036=\332\317Tj\377\017\247\030,O\3039^\274\335Ce\366\341\344\255\354\207z\002\013\324\016\353\257\230\321\220\376L\346\376h4\032\345\247\201\271\317\272\243\332\331\374\243\325\232\2358h\267f\037\r\327\274A\2675\367h\267f\036\215\326\254\003\350\234\203u\306\301:;\320m\3157\332\255\271\251\321\232m4Z3\003\2543\023\353\274"
+	.string	"\353\254"
+	.string	"\353\\\203uF\200u>\200u6\200u\246\301:/\261\3163X\347\002Xg\002\204\3162X\347\001\210\3161\210\316\002\f\235\225X\347$\326\031\211u\2061t~\301:\273`\235[\260\316,V\347\025@\347"
+	.string	"\202\316"
+	.string	"\260\316*\202\316)\206\316(X\347#\326\271\310:\033\261\316E\2543\021\353<\024t\026b\235\203\206\316@\254\363\017\353\354\303:\367\254\316<\254\363\016\353\254#\fn\245N\nQ\205\271\333\363L\356\035j"
+	.string	"\037c\311Z\2353\214K\331\341;\004\360\035\245\035\003=#\2660\203\013<M\017"
+	.string	"\227("
+	.ascii	"|\217\265c\232\355\3163\207\274\276\224:*\306T\274\017\362\b"
+	.ascii	"\232\024bD\237\342\377\b\023\311\271&O\226h\361rnP\242\231d\250"
+	.ascii	"\207\204\fN\243\260\001E\022G\314?\243\274;\026\377\350\203\220"
+	.ascii	"G\214\302l\220Z\305%JV(\376O\227\245\221\177!\331b8\243'\322"
+	.ascii	"\316A\333\233gr\321\023}\2139\273\340|\321\247jI\273eK\364&\264"
+	.ascii	"\\\240q6\317\354\256#C\227G\034\202\201\237]\f\347gv~\350}\352"
+	.ascii	"\264\236B\356B\320\013\275O-9\347^\336\025\364\315C{D3N\331["
+	.ascii	"?B\264xc\206Q\317~\304WHa\210\261\205\026\324N\233\253\335\322"
+	.ascii	"L\262\202rJ\036kl\343\013*\3207\023/\342F\214/\304`\\.\325N\201"
+	.ascii	"\276\333V\016\332\376|\022\211ONyw\354\371\237\017\252S\262%"
+	.ascii	"\307\220X"
+	.string	"_9H#Q\345\235\217\037\225\370]\342\363?lD\264=\277\027\326\312\273\343\023\255\206\237F&\3031\234\332i\317\023i\331\232\255\034\022aL\by\376\3138\305\300pf\243\023#\016\336J\236\377\331\321-\275 \377\252\265\230Mi\022|&/\261\366\220\022=\373q\3607^\253\337:\215nYy\004\311\242b?\037\337\364Z;\257\363UN.6\277\363\276+I\255\307\317\365\336K\203;\257\321\030s\200b$#S;\325y\036\355Z3.\347\177\340\274\r\226\234\357\344\330\215\307\371\242\260\"Bd\355\335\274\323;\231\244]\207i\233\277\371nz\233\017\342,\362\004\366@C\374\341\363\320\241\235\230\340\216\370}\305\311\231\235\231\341\367[#e\355\361\312\301\267\f\321.I\260VPC\202\004\251\300\203'(!OSQR\304\021\250$\350\231r\262\001\304\t\352\006\020\031>#PI $\244\203\250\007\200\310"
+	.string	"2\345$%E\325\364T5\004\325\301\224\323\005V\"\2000\005\001\324\007VVTUB\200\206\354\200\222\212\322a5\005UU%\302\323\220\237\222\252\240H\210\222R\262\022\322A\324\007A\224\246\242\234\244\224\236\252\206(%\0051\025\bPUJVTTUJB\264c\373\356\323\300\235\326\315\\k\356\025u<\373\214\030x\033\353\227,^\216\217d\007>\331\225\3268gp\274\003\257\346!\2573=\216gO\342\331\370\005\236\351;Y\304\037\027\370\034K3\320\366\350/\t\3132S\360\024\330\373\245W\340}\220_]j\250A~\t\241\274[J\243\344\313MyWC/l\215\362\016\201\247\3615\300\016x\003\036\201\357d\224\274\020\016\370\006\302IK\343\227\336"
+	.string	"<\032\017l\357\226^\335\262\034\323l\355\256\030N\307\003\311\340\312\300\314f\224\351\362g\247\341\035\254{\217)\n\370\031\004\374"
+	.string	"_\200\214'\340;i\347b\234\t\226C\262\026-j\2472^)L\013\346\313"
+	.ascii	"\337i\355K\263\224\203\306\025\237iT\303\231\215YF#\336Jn0Kd"
+	.ascii	"\341\242g\262\272\314\323\371\361+\326b\020#:=\003\257e\263d"
+	.ascii	"\253SPc\b\360Q\037\243N\200'\262|6[\277\367^\021yY^i2\007t\245"
+	.ascii	"\305\033:b\371\326\364e\231\241\006\241g*\025\241\364\335.\331"
+	.ascii	"\222\206@\372\244\017B\266h`li\315 i\211Cz\2405\030X\340`<\221"
+	.ascii	"\245\032\264\375\035\315\334\240g\n7\036mTOO\331\2667\004\036"
+	.ascii	"\020\333\032h\022`\rO\254\375<\363\205\332\2135M\027N\026\357"
+	.ascii	"\342\203\352X\210\266Hc\001M\213*f-\376\247\f\013\367\301\233"
+	.ascii	",\236H[\246\331\036\251\242\364Y\3616ik_\264V|\201"
+	.string	"\237\250\2014\005\2212\250fDDA\222$i\r\261\005\204 \246 ;n\021\3404\347\240\032\031iRR(t\013@\342\273U\376\037\005\373\351c\375\251|\013A\215m\2507:$\0165\013\255F%\241\253\273"
+	.string	"\341\376\235O~2\350\035\201T\266\356D\226}%\024\330\021p\256J\247\037\\\304\2208;o\313\007S\355e\023g\217Y\363\202\237\034\222\271Aw\233\320@\367\350i0\320\331\305\"\314eHke\311\216\032h\003*\2349Z\311\263\264\332\037\360\231\313\336\357d\274\\eh\340K\314\304Yc\207\206\"\341\225\276\231X\230\311w\\\376q<'@\302\354"
+	.string	";\267\310\240PR\273\371\360s\3158\353\302<r\034\020\277\251\354m\317\023\fd\f\336\346\335T0R\261~n\340y\372m.\220\233~/?\017\233K}P9wT\342\0373\031\200{O2\277\026\"\035\033\366\340<f\204\231\335\323\313\202\362\341\335\030\016\354\363x\261\020>a\343\254\334\360\034\371{\030\256\353\203JY\274\024\241\341\256@\304\206\374\0246 \365p\311\032\354I\027\246\227\232\205\034*\273\337r\327\271\364]\310'\374\231\201\"{|\304\365\357\311m?,\023|\023\203\341\354\005\312\346\346`D\3463\"\314\354\221v\234L\363\200\237\335\177\"\262\343[\253'\221i\345\224\007&S\0207p\335\324#\232e\267\242\235-&B\005^\213Y\023D\361\204\352\313\345\3452\021tG\372\b\031\372S\301\032\2152\267\234;\335\244\0047\350\230\274\3144\305\327\371\315;N\373 \216a"
+	.string	"\007\213\231e\356\2163\250\224\222h\341'|@\310\016\317\036\005\355?h\022i\254G\020\f\002\305\362\313\304k\003\310\326\216l;}\316\bGu`\005\022H\3775\271\261\022\307\212*6\372\030\252C\024\nC6\337\273I\313\3642h\201\363\367#N\340\366\225\314k\257\245\247\213\024(\274\326\002<\377\377\274\206\032\243\244\314\207\365A_z\206\370e\235\020\372\310)\027\252\035\204\344\331\034H\306\243\222x6)\343\263\223\240\334(\242\330\314\251\347L\301\013\035\004\322f\004\b\201X\006\373\024\205"
+	.ascii	"\356b\270\275\344Az\266Z,\274l\243Ma\322\271\237\006\203<\240"
+	.ascii	"\326J\301di>\234q\001\213\212v\315\033V\266\204\354g\202\n\327"
+	.ascii	"bh#{\252i\324\216\251Y3\266\016\354*\r\261 \204\363KB\331\352"
+	.ascii	"\260\276\032\303j\330A\211\245v`k\200\260\211\032\006D\341\300"
+	.ascii	"\376\306\242\036\264V\207\3201\n.\370\234h4\205\310\n\024\267"
+	.ascii	"ee\324\205@\253\350\237x\352i\215\332\365(p6\r:\200]\300\257"
+	.ascii	"\241'\243:\301^Z$\017=\331W\022\276\214\356\035\371\212H\003"
+	.ascii	"\021\213\312\016\2149ZV\263\3540\237\346\027\301\375F\274&\266"
+	.ascii	"\235\2404#c\222\374\001"
+	.text
+	.section	.gnu.lto_applyFlipOverAfterCrashModeToMotors.141.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`(\017\005J"
+	.ascii	"j\177\344\033<0\"k\f\277\312\t\205H\027\247\362@F\017\300E\367"
+	.ascii	"\3569\240A\215\237\216\003\207\273\321\301\360$\n\022(P\345\337"
+	.ascii	"\367\001\204\200QTQ\222\323 \217\243m\273\333\336[J\231RJ\001"
+	.ascii	"\263\001w\001\274\001`\342\332.\363}\3376\373\274\223\355\230"
+	.ascii	"'-\331\r\331\355\330\215\246\233\261\233L7a7\226n\303\356\303"
+	.ascii	"\356-\335]\272\277t\207\351\276\366\224\271'9\n\007\222;\022"
+	.ascii	"\210\037\240\0313\334g\372\221\243h\254\370ay:\362\325\323\360"
+	.ascii	"\001:\0026r\224\221\027{G\036\240 \224.\303Q2|\035JC\362V\275"
+	.ascii	"Q\001\f\264\364k\305\266\302]\330YZK#6\227\366\322`:\261\305"
+	.ascii	"p\364\252g.\f\024\315F\373\262\347E\027>^[\372\2148\364\303\301"
+	.ascii	"\020\312f\003,|e_.\355\007H\304o\301\263\333\276\322\203gM\310"
+	.ascii	"\327~\345^\237\354\003\030h\371\276/U\267|\340\331-TS\333\310"
+	.ascii	"\355\226\215\2361\323Q\312\361\2421\2002\207\355P\317\373\276"
+	.ascii	"W\317D\211\237\315\02663\375Y71-)%!Q\217\214\212\210\206\246"
+	.ascii	"B\322\240(\020\364\351t[\366\235\374\214[\260\331\273\276\314"
+	.ascii	"\2668\264n\232\ft\246%rUz\211u\346x\353kJ8A6k\217\345\230nl\342"
+	.ascii	"JN\255%rT:\t\351IS\373\234\370\221SK\211\034_\033\361\355y\021"
+	.ascii	"\337\243\236\0239\265\032\373\271\006P\320\216\0229*=\224\327"
+	.ascii	"\323#\177py.\224g\347R#\035T\304\210G\2114\020%\\\035\013\365"
+	.ascii	"\276/\021\207\nP\"G\327\317\246\204\233\023\360\007G\347\316"
+	.ascii	"!\355V\331\274\r\322,\033\225\346N\216P\334\032\313d\367\b\244"
+	.ascii	"\305\344\360\357\264*\355\304\"\260T\304lJ8+,\365\255\257\255"
+	.ascii	"\005\333\335\342\324\334\235Z\357\373\262\267\305\3115?5\263"
+	.ascii	"K13#\263\024*\317\367]\303\342\276l\314/n\276n\031\214\005\013"
+	.ascii	"\267\333\366]1t\1774\007\323|\023\372t\247\210\204\211-\202w"
+	.ascii	"c\377\341\364\033"
+	.string	"\226\217\323}<v\026\317%\224\362|m\366\265\367M#p\340\335\236\352\377\305Tj\262\355[}\250\017\317 {ef'\340\217\303\360q\315\367\204\371\277\231\312\314\346E\267\301\263z*/\251\262\276-\254\304\003\344U\315\fc\314\273\r\353[LS\271T\332\231\\{\264\246\310F%\377V\356\316\312\333c\351\364x\374\344*\370\026\354'\245!\2345\337\303\335On\277\202gg\233Sk\312V3\203\233\217\313hx\267\321p\273\3557A\227\2519\227\346\233\314\205j\376\3262lc\344\370\361\230\233\2619\203;_pg\013\355\330\334\345\316\025\032\262\231\302\204F\323\314\325\204\315\022\3349B\223i\206\320X\232\267\334Y\353\201\203\376\322\334\240\3034g\365\265\031\213A;+pg+\326\271\212u\246rg\004\356|\240%\233\r4\232\346\251fl\226j\303\346\250>l.@\240\2674\017\020\320]\232\241X\347"
+	.string	"\355\f\300\235\237Xg\247vnrg&w^rg%wNrg$w\246\272\363Q;\033\271s\221;\023\271\363\220;O\335Y\310\235\245\356\034\344\316Qw\006rg\250;?\335\331\311:\273\357\334\2723\353\316\357\316\336\316\255A*\030G\237t\307'Y\275\223"
+	.ascii	"\315\332\303\350\255\334\345\032}\377Qp ]\376\303\350\033H\035"
+	.ascii	"\233\300\301\3074/uEo\345\372\026\215\221I\321\017=\327\003\251"
+	.ascii	"\331\253,\360D_\364\177x\301\341\370Z\225\367\326A\312\215\017"
+	.ascii	"\242o\277:I\315\351K\177\350\231\356\366\352T\355\b\274\320O"
+	.ascii	"\377\303dp\036|\255r\343\326a*\257M\350\373\257N2P\300\007\275"
+	.ascii	"\364\177\261\372\307\033\\\007_\255\362\336\367\305\372s\266"
+	.ascii	"\016Sn\336\367\315\352\226=\207W?\200\020!\302\3556\350\373\261"
+	.ascii	"\333(u\221=I\345\b\020\242\267ruqp*4\340Y:\340\t\274\033\263"
+	.ascii	"S\2506\202\270h'\304\254\024\352\005\274\233\220/\326\302\b/"
+	.ascii	"\201\310\017\204\217\360Va\252\230t`\332\024>\330\334\354\263"
+	.ascii	"\026\365\020\276\313\364\223\217\341\336\265\3527\364Vv3\027"
+	.ascii	"\335L\037\257E[\274\023z+O!\022\376\tz\360Q\210\212\203\321\006"
+	.ascii	"\037\365nH\210d|\004\271\204\214Q\007_ 1\b\301'U\025\023\007"
+	.ascii	"\274\333\024\221p0\350\300'!*FF\241 \035/\267\376\261\224\341"
+	.ascii	"c\370\030\365\321\337:sm\3004+\223,\320G\177\t\022\350\231\356"
+	.ascii	"\232HV\355\244o\345 \240\004\335s\252\204\221\320\252\256\322"
+	.ascii	"\372\006\317;\206\221Y\217\365Z\337\212"
+	.string	"\rm\243&\357Z\3054r\3503\2278\341v\333\203\207z\276\363\241\317\372\251\332e}\326?\037\300\034\254\307z\347\177\251\035\331d\367\035|\373\251ZV=\325\273\257tX\375S\363\315g\364\255\256\264\316\236\"\3203AO\365\234UM\365n7\334\366\205\340\030\302aF\321\231^\001*\300\312\302\304\274`\220\215i\240\232\321\220aFc\003\331\230\331\030\214hX\247@\341e)\266\222\312Rl!\225\245\330\252\341E\242\305\227Y\030\007\250\230\330\230\207g\r/\0221X\204\2259[\230\261\210\001\206!\306X\230\331\027\230\330\n0\t/\276\302\314\312\250a-8\224\215}\271d`5\3068\310\b\023[\001\345\257\004d`6\302`\\\231\265`\021&\266\342*F\230\027\214\253/\262\262\253\004L<&\003\214\354\312ll\214\354*Z\230\326\217'\330\255#\016\344d\332\2535\351-1\370V\317\211\252\r\030\370"
+	.string	""
+	.string	">\300\023"
+	.string	"\377\364\246Y\246\267\262\201g\360H\206}\215O\357\204\317/\333\356\364\271\036_\237M\246\234\021>}Ov[\244\356RsL\232o\376oi\314\021\267\364V\216\326%e\370Vo\210\252\245\244\336\351#D6\275\3237\333\2374g2\343,\220F\023\213Y\007\251\331}\204`JQz+;\222\205\357\307&ZDD\223H\275\360VU-\365\031\276\033;\304\335\236\244\325[\371J\315c\277s\2743\301\263+g\204g\204n\267&\352\352\004\316%%\331\262\360PG\352\372\013\357B\215\223\312\266,\362\346\205\372Vv\035\031\213\254\020\035\007\215&<\025\2611\221\210\353\247\336\255\353\231^\332g\b\271\346{\220"
+	.string	"-=\323\003\270sRY\265[z\245\357z\207\254\332\025\211\260\364\f\232T\370\244W\372\256\376\2519\235\327\361\225\213\0239\321\3556i\202_\235\034\3159\n_\341\257 \253y$\374\324S\370\216l\350\235\232\223-\325?\265\243\2738Y\362 \375\204o!\253\177\324?z\244WbS\375{\352+]V-\271>\201'\250a0\344\230R\246\204DDD\222$I\007q\005\304 \350(\354\006\021"
+	.ascii	"%d\026\315\310LRH\007\217t!\016\323\234\373\026\313\231\204*"
+	.ascii	"\003\021\3405L\211c@\303\021\377]\022\311a\345X)\\R}m9\302Im"
+	.ascii	"\227\352\325\333\243\301\020\347\261\275\245:0p\335\320 \347"
+	.ascii	"&\357\212\232\205;\227\270t_\241\257\327\266\311\275\204Al\311"
+	.ascii	";M\035\003\367\330\305IY\244)mz:\321=m?lJll\200 8\250\264\326"
+	.ascii	"\213\3329\022\002\274\223eE\373\330S\236\023\0069v\341\240\245"
+	.ascii	"/\003\036\333!\033f>\317h\244\363\261\013\270A\300\333 \007f"
+	.ascii	"\324\203\357LN8t8n\366\302>&Y\200\217\200\323c\233"
+	.ascii	"\372J\326\202\310\256^\035\b\247(c\246.\bq\230c\355Q\213k\002"
+	.ascii	"\032(\200\246\013\253\200\363 m{\213&\332\026U\272\235v\200h"
+	.ascii	"\001\202A9\254\223\031\324\032y\336@Q\213qUt{|\242-\303>_06\220"
+	.ascii	"\202\337\227\357B\363\261Ut\023\\\252 \344\327\ra\267\234\343"
+	.ascii	"\235\337\315qr\204\307\331)\212\n\206\346\350\025J\177\344\217"
+	.ascii	"3\352\254\336>\tk\332D:\262X\244\3005}8\262i\245w\216\027\332"
+	.ascii	"(\215L\036\317\323#yD#\231\225o\t\316\314\030R~\242~\271\234"
+	.ascii	"\307Jy\374\302\371[g\347\255\023\003\200\024\273\b\271\255gA"
+	.ascii	"\032\f\237;\036\300\"!k\360\t\354\365b\"\204\273\374\266`v;i"
+	.ascii	"Q\350t\333\360x\002v%\324/\277\300\021\001)r\213\271\206NC9]"
+	.ascii	"\220t\n\250?\335E =p\022\323Z\325\367\302Y\253\360\007\\\030"
+	.ascii	"\321\037l\205\203\262\315\255\375\222\213l\004l\371\025\"'2l"
+	.ascii	"\037\365\274\330[/\n\212\340\024\305\033\001T\356\204\0249\f"
+	.ascii	"\0058\001D\016@\001N\210\f\340\202\254\301\034I4%\323\343c\205"
+	.ascii	"\371Mo\246\221z\201\232rH\360n`\307X\366\333\313=\005\205i\177"
+	.ascii	"rL\261\331\023C1Q\265e\371\221\222\275\204b_\272\260R:MC\024"
+	.ascii	"\206`\304\320#[\033\336\177 \315uT[\"\3608GK\214\255$\313\037"
+	.text
+	.section	.gnu.lto_applyMixToMotors.142.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\201\t\0355"
+	.string	"\212_\234\024C`\350M\007k\0062S\343\374h=\305\252\034G_\247 \320Z\020\\\306\333\360\200\3170\324\fS\303\376\347\364\323\216+\344\374b;\277\354\274\247\240\304\016V\230\252tM>1\r\031i\273\233\334;\245\224\0029\001\030\001A\001g\370\202R\315\006s\233"
+	.string	"gRL7q\364\031\256\241T\243\345\336\353+\303\315f\206\235.7\250\214P\b5\f\367\032\267Z\217)6\031~\353\033v{\207]\331\240\272{/\203N\031\204\332\351\023\212\203\331\327)\352cfwf09\236\030\332\271\317\332K\177)6\0327\273\350\336%lm\367\2429`\bh\235d;U\373\310v\027\346\265S^\240v\312Ef\272"
+	.string	":\256\226\2042\273.1v\367\336\3417!b\265Q\264\346\337\027\273\210(h\004\374\r\371z\253\312\263)\372^\344\346I\241J\270\274A\202iu\221\2237#N4\326\301\336\032k\243\267\026\316}9A\237\322\2368\020\345\351\3601\245\347\276\226h\205\273:\267^3\372\217IX\221\036\362)\273\327s_bM\245\257l-L\022F\244U\236T\222\260d\363P\250e\233\037@\260.4\t\216\222<\335\326\302*_I\267s_C\320\247{\357\321S \215\242Puh"
+	.string	"\001\301t\240I>\246 \233\255\335\013\214\313\277\327\372D\331\240=I\302\212\264\363\244\356\275\354H\260\260\346\243f\356\030\314LdV\223\001i\357\273\215\035/\352\017\177%R\237\351\217}\177\336[1\307*F6Y\354T\243ps\323vj\277\275\304\266>\352\323\357\343\025\264\231\215\375G\277\217U\214\376d\341\377\363\336\272\n\365\373\367\261\256\341z\r\025w\024\256r\341\215ta;\355o\266N\333\304\n\tJn\371\363\307\300\351"
+	.string	"\373g2\243\031\275+\214\335\325\361/a^\2359\254\316R\252\363\006\r\031Tg\f\027|\316\026(X\347\t\252\263\204\b\020\0364\230\356a\243uG9\3509C\255\316\tZM\363\001\003m\246\271@\223i\026\256\316O\326\231\300\352<\240\347\354\264:7\365\234\005\254\316L\253\363\222u\016\260:\003\260\316J\253s\322\352\214d\235\217Vg#\353\\\244:\023Y\347\240u\006Z\347\237u\036\262\316>\353\334s\347\225\347\254Zg\236u\266\355\234\362\234Q\236\363[gO\235\273\303\217.\017X\2239\357\365\361\034t\345R7\262V\323m\246\233L?s\277\261\217\307X\0262\267Nc\243\003"
+	.string	"\236\351\023\364\230~\351\273\311\024\340\227"
+	.string	"q\t\240\364"
+	.ascii	"\374()\240\342\346\310\362,\271>\223S\004\341\rX\217\300\325"
+	.ascii	"\341!\263H/\365^\314R\237\001\345\243t\032\351\250\325\251F\237"
+	.ascii	"\364\003\236\375\350\307\350O^\322#}\267\265'\201\330\211\341"
+	.ascii	"\211\023W\340\223\216\036\211\317\331\321\257Eo\364}\214\333"
+	.ascii	"\252cg\361\0137\213\276\206\322i\326q\360\200!c\237\311Mj{\342"
+	.ascii	"P\n\257\244\266g\371\021\276\300{\345i\242\307J#\340\314\036"
+	.ascii	">x#\211\276\353\320Q\2213\276V:\341#<\205\3773\307e\223\013\237"
+	.ascii	"9\204\bo\344\204\1779:e\007!\003\364\003}&\023\355\206'\322#"
+	.ascii	"\216V\2378w\270\374\2161\274\204\337\360\335\365cIB\367\bk\341"
+	.ascii	"1|w\271\325i;#H\224\360F\226\260\235Z\370N\323\316&J\236\345"
+	.ascii	"Y\360\201\037\341]\317q9\307D\360\0258\201\360\277\007\312A\361"
+	.ascii	"\373\346\243\f#(\211\344\017\2369\205\no$\204w;<O9\256\327\342"
+	.ascii	"\241\347\375\203oB\307\245\357{?\364\335p\330\271\202\233\276"
+	.ascii	"o6;If\321o\330\331m\352\334{'p\307\301\230j\270\261\034\266\003"
+	.ascii	"\374\"j\306\213\254\251\253a\f\342\325\025\221*\213\206\214,"
+	.ascii	"\032$|V=\242\252\206U\026\325\224\357\206\325\b,b\026\361J\245"
+	.ascii	"\252\2221\343\311\005\326\224\312TQXU7\254\256\206Y/\\X\301h"
+	.ascii	"1\214a5u5\244\302\2321\214bb\242\214*\254a\026\221\2105\364\241"
+	.ascii	"m\365/I\353\336A\027Hn\353\215E\317d\337\223\240\203O\237\030"
+	.ascii	"1\350\003\007\376\351\233.-\216"
+	.string	"\313\357\374\336\253E\364L>\360\016^)m\313\223\300w\2613\311\217\376\007\311\007\213s\261Su#\224\242\031\201\357\267N\211(\333\230\271m\371\363\203\317\344\356\246\037gZ\214~\t\367Z\267\020\2657\315_\323?\275\027;Y(u.\315N\267\223uz\250g\357J\032\237R\212V\234\276\323\032\215S\302\001\237\311\353\235!\r\377w\234A\013\337K\370M\357A\3007}w\025\032\324\204\212dT\212V\254\330N\005\240qb\205\314\032\275\367\336\3373\331\3769\372.4\021\265>tj\2067\320\240\205\257\341{\255M\244\221\3219.\r|\227\276cg\260\002\267]\013*\226q1K\321\214\273h\306\326\b\220\270\031[\236\371P/\301ws]z\016\034\376\202\032_\200\275\250A<#\0313\206fDDF\222&\313\001\200\002\021\2622n\021\200\271tE\nR(t\312-=/ B\305\331w}\034]4"
+	.string	"\237\373\303&\376\260n\220Y\013\237\344\323d\236\216"
+	.string	"\334\b\202a8l\207O\317,\b\030n\230b\322%\022\306\254\270\214\344\253\016L'\311\205\271\362Iu\257P\211] \0175sU\222\221\205_S;j\366\3365\013\302\022\332\273\004\216\326\006B\326n\370\232kWJ\220\365\251\244\266\237O\2419N@\245\320\363\331\002\301\276\235\3318\253\"pX@\211"
+	.string	"F\364\034~\331\320Y\201\345\351"
+	.string	"*\322iP\263l~\336T\326\025\216\031<j\356\260{\r\261\205\005e\265\345\214\327\276\205t\357\025\205\025\177\002\026\037Nzd\267Z\315\033\241/g\f\323\373C\267\204S9x\243\217\2230'G~?j1+\242\246"
+	.string	"\020Je\276\245\226\204\207\351Zz\212"
+	.string	"\313\314\323\033\341\t\212\204\222\036~SAa\316\0210b[F%\020&\020\002S\244\002ZR\f\2774\221\315w\3057\206f{*\303\216K\224=95\277\"\367\005R-"
+	.string	" \337\021\335is\214\220\247\206^\344\344\246\307e\202J\270\327\t\202\001\3507n\020\225ap\026.\312\0318\026\361\372\025"
+	.ascii	"\303\005P)\240\253\317\200\034I9\2412\311\363\304]\200Qv\246"
+	.ascii	"&\260\377\001"
+	.text
+	.section	.gnu.lto_updateDynLpfCutoffs.145.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\342\002\335\026"
+	.string	"V\252\225G\300\030Q:\204\300Ib\b\276Z\262\007\275\245\t\261.\255\350J\264@L\200\312\360\314\214 \227s%m\377_\034\355)\241\253M\2355U\"\004\230\333\026\305\312\353\216\356\314{b#\302C\024F\301o\004\021B\344N)~"
+	.string	"v"
+	.string	"\205"
+	.string	"\377\250h\233\336\254$\312nI\255\265\201!\204\377|j?\310\205\274.d\302\246ZoHYR\353\255\201\027\204\377T'"
+	.string	"\376\363>"
+	.string	"\374\347\227\355\245\300N\205=\b\352B+2\246\326:n\216\277\376yK_\376\214\215\251f\203\375\223q\317SM\321\321P\266\035\017\301O\215$\3216\243[t\352\302\266\343\251j\255'r\272\302&\243t\306\246\326jZ\263\305\270\301\333\326`\273\204M\227\002e\222xbtg\337dt\201\354{\265\326\352\375\261O\324\251\033\3354\317\335\342o\377)\2446]\350\017)\365w\242\366L\324K\251iH}\001(\034,l\027:\252\365\305\256L\325}Lv\334\350\317}\206\202\324\263o\337\210\177\304\242Q\016\265\202%HiB\370!\277\310\316\215x\215Q\257BG\020\031\244Z+\203\177\266!:N\347Cv\320SF\374g\353\330b\337\376\310/\020\r9B\201\024\263\022\214\035\026o\201,\256\267&\321\026\237\311\233\370\211\b;\261\023\360D\217R\022\317\256\270\224J"
+	.string	"J\327^\221\340k\273\252\331\302l%7b\324\254\326X\202\323\322}\321)\\\031\002\005E\017\031\255\265\302v\201\254\200\366\017`jyZ,\331"
+	.ascii	"s\245\312\214\222\261iS[@\fm\351\033\256i\217\273\347#\013\322"
+	.ascii	"\217\0319\036\262#y\022\023\276\016\343\224\364\265\022\374\367"
+	.ascii	"u\320\023\276\251!Y\3459\266\\,\226ke\300C\b\t-\235\016\250\n"
+	.ascii	"\035\310\022\345\331\342\220#\"E\2028O\227ys\2068\026HVY\341"
+	.ascii	"l\221\246\231\263\002\340U\215I\222(Y\343y\363\241\004\341al"
+	.ascii	"\225\034X\343\312\304\031k\016\330\025\2024\307\323\3452G\361"
+	.ascii	"\026\273W\367\347D\376\024_h\350b+\373\302\225r\030>\270$\237"
+	.ascii	"X\224\003\361\301\375\300\340Z\322\t\2404kg\330@_\363\265\034"
+	.ascii	")\351pp\031\272E\330\355\302|K\263\233D\3346 P\2021c\305\033"
+	.ascii	"\326\031!O,\251O3\317^\314\254\035\247ML\241PA\260\002V&\336"
+	.ascii	"6\035\257\027\303\242Mb\341\356\3322\256\030\226L,%\231\320\n"
+	.ascii	"\f\254\016\3461dF\302\214L;b-G\2024\375\330\242\275i\016P\203"
+	.ascii	"\313ZH\016\033o>\013\364\314.L\251\232\r\2515b\r\0234$\302V\024"
+	.ascii	"\327\275\232\023K\276\021j\246\266%\313M\207\351( \006\303\332"
+	.ascii	"3.\267\024\346\017\241\f"
+	.text
+	.section	.gnu.lto_mixTable.146.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\003\001u\r"
+	.string	"\006Y]E"
+	.string	"\2216\035{\r\020\200X\320\200\3371\274\370\222\333\274d\002HJ\250\204\374\016\301a\264\340K\221\326\237\022\251\217\203&\004\335\222\007]f\271\3034\254\377\003\320\2217\324\005\232Qc\300\243\376\004\323\275\211\224)\005G"
+	.string	"F"
+	.string	"J"
+	.string	"\262z\210u\351\317\276\361\261e\016@\235PZ\340\230sb[\342\373\276\352\273\254V?\377\022\301K\317\253\020\337\352\200\212\214\024"
+	.string	"b\251\362\314 a\3430\327\016b\250\352\361\231sZM\342\207\333\272\355\007\266\035\330\237\020.\336\225\353\343\317\371\313/+\365;')'\017\342]\304\314y\272\3211S\022\306\t\333\357\330^\265\023(\370>\236x\347T\241\261\200s\351\253}\025_\361\375e\203?\346\034\201z1\347\210\300\0068\227\005\356\261\036\327ZQv\220\364\206A\213\rM\005\2426\211&S\223\"\025\022"
+	.string	"c\240\330e\261\235\301\372\216\260\250QR\033_jo\234\336\364\275L\r*\025.h\017\225k\217L\364&\037\346W\f\b\0219hJ\013\332c\250\3132\3432\023\"N\363@#QV\262q\r(h\020<\320\b\206\220\221\204l\323\"x\242\254\353LB \016\211t\231\006m\303<\013$\332\205\n\230H\003mX\250\033a\"\002\314\225d\035\346q\\\207uF\322w\305\376\2206\274\t\031@\257\005\205>\034\0264g\003\025"
+	.ascii	"2\003\326\031\235b\320\237'L\205#`\261:\344\002M\023\225\222"
+	.ascii	"\304\325M$\332>X\3502\003\204\261\325\373La\260\0025E\270#-\355"
+	.ascii	"5%\334\224B\355\001"
+	.text
+	.section	.gnu.lto_mixerSetThrottleAngleCorrection.147.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`("
+	.string	"M\b"
+	.string	"&\020<8@\217\322\001@\265\322\210\205.\300\246EV\335\035q\337\360Y\f\023\337<\177\n\377S\001\020r\013\373\227H$\030\256\016\003\201\321\325\020\215\r\3345\366\310j\262\311\336)\005)"
+	.string	"-"
+	.string	"+"
+	.string	"\227\356\354\226\237>v\240\204bq\362\262\2733z\274;\354\374\227\\\343}\242C"
+	.string	"\205\3355\364>\214;\336\266\201\355\004\333\250\246\037^\034\021\326w\226\313\356E+fWR%dc\373\320>\311K\335MVY\263\313\261\222\262\273\b>\310\\\026\\"
+	.string	"\273\274\036\200\005\031\230\215\325(V\030F\037u\023\253|\020S8\005\357]\372Na\227\023\032,#\031#\330\262O\"\030;\354_\273\273\216$\373\001Z\304\307\263\020\242\033\227i\265\322\214\343\254S5\211\r49\207\206\355\3030C\233\0074\263\n1;\004\246\017Z\235\034\245unN\373k#\311\001\b"
+	.ascii	"2\241\213/p\340\002<\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_mixerGetLoggingThrottle.148.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375 \371\345\006"
+	.string	"2\21505Pm\222\016$\243\3164\017\224\022^T\037\035\033\030\323\370\362\235\322\321\346\257\331\177S\201Up\207E3\354\270\231E\202\030\302-\334\206H\2505\230\321H#D\246g0\227f\242\332D\216CC\365\300\020!\252\205M\314\\\022\021S\260\025\241\271\"\307\262\256h\331\262\017\344\336\305\363>_\221n\223nh\212G\256Y\341}D\025\272\027\220\341q+\277u\334\333\370N\371@_\267{\002\037\026ZK%\231\027+*\211\002I<~\354-\027\244!\330\223\246\255#d 2\251\030I\311\314x)\001U8u\200*|\034\305\352\260[Q\025>\245\223L\353\324\001$d\346.\3230\372\353\177\360#\374\032\001\b"
+	.ascii	"2\003\346:\203k\b\305518\"k!2qWL\355$\003"
+	.text
+	.section	.gnu.lto_areMotorsRunning.part.0.204.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\013\002U\022"
+	.string	"F\342vG\340\322&\035R\035,\327\347\321\323\372QO\005\327_\036\256\205>\365\362GjM\034\204\274BH\307\350`#\266z\2722\036\026c\252\306\364\002\203\f\323(\004!\202\236\252\364\360\301\n9^\271\227Y\334\221\266\367\226;\245d"
+	.string	"\\"
+	.string	"b"
+	.string	"`\215I\205 \n\324\247\023h\237?\341\224H\212LJD\305\337\301\0211\307\301\361\002J\252\025\344>\367\306\332%x\313\370}\312\215\364\363\017^\362\034\345x\201\255|\202\300\\\\Q\306\227\035\017_\331 \306\203\003\002c\221\3533{\361\331#\f\314%F\002\247&\007\265Vk\037n\323mo\260=bG\b\0015\366e\267iFS\031=\345F\357F\307\007\335\007\200\352 \200\246\326\230%\0375\3044*q\331\037\364h\337\017z\n\177\346\r(\3052\227\371@>\377Q\271\n\2738\265\200\025&!\224Q\031h\237\247\027\240\237\362\003\350\347}Y\212\017z\353y\354\263\214\212\337\343\355\323\217}\247\225\364s\356\001\244\031\227\254\265V\251\340_\2717\021\326\340@\303\"\004\242\346h\327f/\342\307FKT\262\317\342D\016}\035\253Ld\"\372\271\213"
+	.string	"i\346+\034j\265\326\021_\350C\236\257\363i\f\255\370\227O\277E?\343~\366(\273\341A\0233r\305%\357\227\306\r\237\241\2706^\272`\006\214\034o\335MV\335j\225!B\213\345\241x\252"
+	.ascii	"&\ta\225h\350T\034J\005\223\316\002\005n\325MPq$\254\026\027"
+	.ascii	"b\300\336\205\022\026\207\342y,n\263\035\2775\2468I\257P\372"
+	.ascii	"\037\335\220\224^a\374?j2\355\301k;v\212z\350p-\013\211\2716"
+	.ascii	"\2369\024\365-gal\233\356\367A\214\271t\377\372\361\242\2670"
+	.ascii	"\351NN\0020 @\002\202\224\326\016Y22x\325\333I\322\"\231\204"
+	.ascii	"\361;\315iq\367\211\264\002 \376m\307(\001v\fmJ\314\320\200\253"
+	.ascii	"\307\340\032S\211\b\020\233U\210\273\304\030\252\205m\201\271"
+	.ascii	"\364C\002\277\267\333\225{\033\2308\030\221\372\3207\364u.O\026"
+	.ascii	"\313\361\253\312x\032\013?\330\246y\341\026\230\205\266\237\367"
+	.ascii	"f\013<h=\356]j\f"
+	.text
+	.section	.gnu.lto_mixTable.part.0.217.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`:$\305\243"
+	.string	"\232\007\231:I\020\020\306i\215\001\375\315MM\021\302u~{\203\203\233\034\2378\232\333\374D\235\223f*\343\207m\263\320"
+	.string	"\216\020\013\001\260\304\345\324mx\252\265\313\355\355\315L\314\332W\256\013\240\026\350\215h@P$\022\313\352&2\245\224\002\241\003O\003\233\003]\310nv\345\213\233\304\234v\262VC\257\302\334\206\231\312\022\337]\231\236A\253.d\027SA\303({\374P\255\276\201s\340c\036e'c\244C\277\304\034\n3V\027r\221\315_\bT\253\2171\273\030;\024\313\237t\221A\246Y\343\314\034\261\230\303:\013\265\256\017\371\313\214d#]\310J\250t\206F\230\225]\310E`\204~\270\021\233\020w\"#\017\277\220t!\177\031\341 \325\372\276/r\020\367!#\221\264!\333\225\021]\341\262\316\206\244\002w\233/\3567=B\327\365"
+	.string	"\232N\333\351\274\346\353<\375\327}\372O\013jBF\016\236p\202\230\351\261\213\201\276:\233\345\032\342\336)\202\r\310\331\331,\2447\317\333elnd\\\032w\354$\243\237\300\256\300\256\366}\323lnV6C|"
+	.string	"\001\335\324d\003\217]\334\363\325z\226\354\327&8[\317\262),\356\225\022]\343\274\261\032\346\035\273\210\344\235d\304\323\327\027'\316\336\227\036c\373\374\270\341e\337\356\340u\341uQH\253\223\343\345\256\316\022n\002\253\263\244_\350\353$\321\3550\373\276qU\216]\264\373\352\022\270\300\244\357+\235\323$8\273\004\256\366}\323\276M\331\336W\312\301\261\213\376\266\2221\311(\007\213elS\321\373\336\235\311\351\227\356+\016c\217\236v"
+	.string	"\255\206\31498]p\272\372\235\362:\036/o\210Y\252c\313}\261\324\rc\233\304\342^2F?\276>+T\027\031\201c\027\221\334z_\231\305\213\257\026\301\253\343^)\2553\263x\341l\021\274\370\337\227\n\030\343\330Ev\357\270\257^\223A\033\367\226I\331\235\271\341Z\215\263\327d\300E\357\333\305M\316\373\306\245\350\"\2338v\261\251\225\214]l;\311\330E\346~c\346/);\231\005;N\355]r\2232\326\306\360}_\251.>\030\020%\370\330m\\s\215\326\3318n\330\250Ac\206\214\0300^\270h\301b\205\n\251\250\024(\240N\230(Ab\304\223\210\020 \234\232>x`Z\352\300a\203\206\f\030\224\334\244\344\005\244##\013\025\220\024\212\216D\306b\373\236\303\311\355\3212\260\306\321e\212\241\276Q\250m\024\352DD\257A\250i\020\352\031\207.#\321\320c"
+	.string	"r\030\211\202\376\"\321\214\364\217\273\310#M\364\343-\002\233E\237^\301'\254\217\253"
+	.string	"l)\276\027\320\243R\350\3559\212\300\206\272\323'\356\340\271\t;`\260^\342\313\224\273&q\327#Z\016y\355\023\2364?u\376D\327\"\332'7D:\235GJ\327rp\363DL\023\306\361\020-\321\023)k\235G:B+\0031;\307\315\3268\210/S\346\332\tN7\275\361)\034\3770\327\036\3244\223\0328_\262v\007\353\233s\b@o\b\200\206\020\334<C\231\306`m\243\013\244D4\325@\232\365\316z\330e\312Z\273"
+	.ascii	"\350.R2F%1vc\330\251\213t\355\223\234l\315\241\214\361d\0311"
+	.ascii	"~!L#\265'\262\003("
+	.string	"\354<\3220\255\222\224\265h\023\252\371\221\22662#\325\222GJu\013h]a\032\005\315\221N]\246\2345\205\266)\217\364,\213\027\021Mu\231\202\245\217\235GjF\245\235\314H\2618\021\205\262+m\204z\331\230\027\333\023\324<\017\224\360\244\371y\342\355\261J\277Q\331\263mz\337\267\t\333\311\312\304\334\223\235\203h\352}_\356\260C\315S\315\334\2661\267\026f\017w\001_5\376\321\361\253L\004\004#\362\275\254\213\266\334\241\026\213\276\202\021\025l\n\257\2433z\026S\276C5\330~B9\353{_\316q\350\220\240\330\373\206\205\250\360\026z\244\215\360\0075\363$\372\252\361\221\317\016\035|>U\031\034d\374*\027\361Z\366\271\254\f\200e\234g\032\315\264\216a\023\366\323\334\263\277\311zR{\337\260\216:?p\236A\006\322\303F\265\266x2\n_\364fV\372\364H\360\333\023s\3044\356\206\261\025"
+	.string	"\231Qx\033g\033\023\340\373\2762\256."
+	.string	"\247\033;\337\234p\336Q'\234\261\213\024\276H\315\361\213\210\376\370E;\250 \242'\3223f\250\370\306o:h6\314\017\255q6K&\3055\355\033\r\247{\207\305\257\266\227\361\277\013\257|\230u\270\325\353\370\276/\f\3667\fvp\223\231\300\330\305\377\"5\354!\270\333\004\334d\230\200\002\274\243\005\374\2130fa~\210\277\227<\200\013\241\215\342k\033|^b\354\1770=o\327>b\216\310\035\234\031\001\037\336\321\376&\354\376\"We\313a\366\371`\376U\376\0342\324\020\263\374^\2305\310"
+	.string	"\003/'\255s\223\2443\223\256&\324\314t\235\271Z\347\255$\347%\255\263\022\r\316\313$g\255$\347,%\347$Ig$I\347\013\224\234\225GZ\256\331\210\353\\\304u\306r\235\257\\g+\327\271\312u\246j\235-H:W@\201\353<\201\353,\201\177i&\342:G"
+	.ascii	"\301\020\327Y\210\353\374\200\353\354@\3175\007q\235\201\270"
+	.ascii	"\316\r\270\316\f\270\316?\\\347\005\\g\005|K\263\017\3279\001"
+	.ascii	"\327\031\001\327\271\207\353|@\307u\033\340:\027\340:\363h\235"
+	.ascii	"\tH:\017\260\303u\026\240\351\232u\264\234\346\251\034\2563\016"
+	.ascii	"?k\276\341:\333\250\341:\323p\235g\270\3162\\\347\030\2563\f"
+	.ascii	"\327\371E\221\263\213\016\324\334\"\2033\213\f\316+\374J\263"
+	.ascii	"\n%g)%\347\250\276kN\321:\243Pr\206r\235O\270\316&\\\347\022"
+	.ascii	"$\\\347\021\255\363S\322Y\204\353\034\"\351\f\002\203\263\223"
+	.ascii	"\353\334\324\327\356\017\036\224\234\231z\257y\311u\356\340:"
+	.ascii	"sp\2357\270\316\032Z\347\f\2553\006\327Y\311m<\315I\275\2479"
+	.ascii	"\331|\232/\270\316H\256\363\221\353l\324~\232-\270\316\025\\"
+	.ascii	"g\244\353L\301u.j\235\217\2553\221\353lLr.^pn\223\316\177\301"
+	.ascii	"\331{\260\271\273\332\302\315\035Q\337W\312\241\304wKqN\231\036"
+	.ascii	"\354\016\324\355\247\233O\367\236n<\335{\335w\272\357\272\355"
+	.ascii	"\272\345t\323u\317u\313\265_i?k\337\322\376\305L\005V\\A\215"
+	.ascii	"\347Z\226,e\216`R\327\312\324MJ\226\031\233\004\023\240\317\260"
+	.ascii	"\r.\353\321f\351\030V#\363B\031a\306\266qjd\220\325\272+h\244"
+	.ascii	"<\fS\265\257Y\234\332\224\366{ch5|\305\342\240\224L\365\033<"
+	.ascii	"\t\343\322\"-\212\225<\303\367\215\223\352b\023j&\346f\257\202"
+	.ascii	"a\344\027\nW@9V\3034\357\302C\320\004\r\251\\\266h\351\322\322"
+	.ascii	"\205\007\315[\336\334\321\212ca\2372\362\314\263x\226\3047\265"
+	.ascii	"\254\233c\225\204\315A\336\321\036\337$\206\345\200\377\201\366"
+	.ascii	"w\270\303\013x\003\236\271I\250Y\350\211\225\002\236I\017\026"
+	.ascii	"\263)\347\361\314N0\347\323;\312Mb\017\306Tx\234@\343;4\013a"
+	.ascii	"\326&\3728\355x\366\200\301\253\320\340\331\203\327\353x2v\312"
+	.ascii	"\340\271\365\340\344\247\236\214\200W\361;\362\006x\002\276\307"
+	.ascii	"\f\275\364\313\274\2368\307\306\214]\034\240\335C\303\272\201"
+	.ascii	"h\022\340\371\203\216\327\340\311\270m\232\352\251\\[\224"
+	.ascii	"\0179>\003\024\255\342w\274\2335\220\253\235APj\216\2476\035"
+	.ascii	"\306\272\200>\355\026\017m\317\315\314I\307\347x\001\332/P\204"
+	.ascii	"7M_\345\251\317\361\317\346\317\232\353\036\216\277\3619\236"
+	.ascii	"(\r\017\020\324\214\215\237\3617\236\310\017O\256\306\323x\033"
+	.ascii	"\377\204P\276\003\032\337V4\273C\031\017\343g|\2074<,\224\032"
+	.ascii	"\343/\274\214o\333\220=Y\214o9hvn/\336\302\303\370/\324\301C"
+	.ascii	"a\354\3617pZq\236\341&\223e\354\342\213\227\342\243\206\305\267"
+	.ascii	"x\027\337P4H\315w\214+\236\3057\324\214\212_\361>m!O<\354\230"
+	.ascii	"\241\260\227\253\363\244\354\003\023T\273Y\267\224\2613\202K"
+	.ascii	"P\215\301\223&\232\363z2gz\261\266 wfo\311\311\223\261\207\017"
+	.ascii	"C\223c\372\352\203\371y[j\017\005\231\03624\354\360U\366\r(\372"
+	.ascii	"\205\234\026\252\006\250F\361dR_u\215\372\244\227\372\247\033"
+	.ascii	"3K\361Q\177\364\304\016\032\313\202\342S|\027\0323\024\306a\303"
+	.ascii	"{\341\376\035\032\370\032\352\177M\n\224\2271-\322\f_"
+	.string	"e\022n\016\367\224L\264\0277\207j\334\022\357I!\216\3316;c\330d\210?q\342\023K\230\016z\376\315\t\n\013\324<\005\346\2050\230x\347\240\213\326\256V@\320A\303n@@X\224H|\210/\361\3114+\237\017\366\322\203>0/\304\337\355\035\037\034\367\220\035\321\r\267ly\333\342\260\275[\b\331\013Y\360\370\276`M\355f2\016\036\325^\251\323\324;\3306\227u(\354\202\270\251\314\036\210\231\277\004=\372\232\3507\200\250\364\211\271\241\264@\021\342\006G<\211\367?P3O?\342;\374\201fE\374\323;Y\037\375\236V\2711CFQj^\222_{\031E|\325U\317\241\260\263\314\377\210x\207\322&\270\350%R\341\372x c\251p\035\327\031\273\030\342\207L\007\271\231%\277\312+\242HM\337|rhkG\214m\307\361d\334\327 \276\252\212\377y\355qZ\235W\200\030\273\b\302\317M"
+	.string	"\342\304\342<;3v\321\351\333\203i\341\205\025Z\234\\\274\243M\257!\356\004\273\276\357\344\034\242\025\351\253\3144v&h\344\341-\310\235\255YX\372\032^\306\017\037#\320\337\230\243\2572\363\322{h\007\247\200\236\177n\004\031U\340\360\036\005\251\341;<\231\003F\246\257J\363\275%\307\367\025\203\301\236\347z\316*\030g\2300\306.2=\005S\301\016\277\304\303\217\256\016\324\314\323\302W\225\236C\205\257r\367\271\325\215a)\020\001\366\322\330\204}4t\2033\206-J\276\273\3415\274G\271s;\257C\207\355\214]\334\220\3415`\370\f\337PA\030\276H\347\276\222\231\351\237\353\237\233l\030\362\253\024\336\013\023\001\341x\364NeJ!\226\250\350\221\236\314A\350\244\177\260=m\3161I/B\016K\034"
+	.string	"|\316\322\205Z\362mLM@\372\013\355\234)\337\363\317MQ|\204\353\b\223*KJk\231\225\265\264:\022\345dK\312\210\222\244\"J\f@:Qf=3I\331:\222,\267\230Z\313\035G\254\264\272\250\222$\371\300b\242dZQ!\223$Y6p\341\210\025S\371#\311Tf)\023\310\352\002r\245\374\321\204\312\313\350\n\213i\205\305\304\032@K\251\004H\023*\257\243&T\020\\)\177p)\235\350\270\302JBe\305\205\264\265dZQ\361\300p\205\225\244\212J\213"
+	.string	"\243\243\023*-\245\017'J\037[K\3462\013y\205\305\344\352\272\340\212J\253+\211eD\213\352\310\016\254$L\346r\353H\020\254\253e\326\226\222JIk\251dRqia)\311Z\356\270R\376`RU1I\342r"
+	.ascii	"+K\031\204\251\205\265\265\325ee\201\255\242\266\260\234(\263"
+	.ascii	"\244\230G\214(\223\024\221\322RReIYmqIEq\340\245\022\254-)\346"
+	.ascii	"r\271%\205\354\251\260\177\342\340j\337\267K\216\254\b7\276\312"
+	.ascii	"\314Jo\361]\330t\232i\230\324\336\367m\226i~\300\201\234\235"
+	.ascii	"\3670\373$F\2331tl|\225\213\372\320\350\372\3573\003\252\231"
+	.ascii	"M\236\311\344\233\340a\362\031\210\240\310\211\326`~\327']\341"
+	.ascii	"\006q}\023bnZy>\306\036\251\351\375\036\327\231f\2324\306;\214"
+	.ascii	"m\343:\256\357\304~\342\262\227H\205\373\362\002\242\301~\330"
+	.ascii	"\263\031\357\205\267^\311\027\271\346-\371\255\246\333\333i\276"
+	.ascii	"}\235\277k\302\255i\262ac\354\342\222O\021F\315\362\225|G\275"
+	.ascii	"]\363\312O\302\227\320l#\327\204\003\307\330\305\345?@\325k9"
+	.ascii	"j\032\031$\214Z|\220\336&a\314z\255\272\307.Gh\322\321\031\273"
+	.ascii	"\230\365\032P\365\334\314>\21250\206\036\343\364\320\016\306"
+	.ascii	"W9\311\027iz\223|\003\"\006\352\023\253\340v\302\230\027\315"
+	.ascii	"dD\362{\256}\b\373\202G\362\354cfO8^M\254s\354\202\337\242\326"
+	.ascii	"94\013\333{\321\270\370*?\311\221\260\307\302\310[\220[S\007"
+	.ascii	"uD)\304\221\272I\202\221\271i\327\254\343\035U~\277A\324\353"
+	.ascii	"\233\362#v\234\317&l\nrvl\207Y\261\026+\260\336\303TT}\221 _"
+	.ascii	"\344\215\024\255P\353\256\177n\330\236,\202<\326\n)\253\3677"
+	.ascii	"\252\352\257\236,\310{\330\325_\363\250tW\025T/\344\255\220m"
+	.ascii	"cpR_\345\252\027\362\376\346A\360UC\236\352\215\236|\370\240"
+	.ascii	"l\317\013j}vQB\276\005]\367\220m\002\243\244x6\203\201dt\246"
+	.ascii	"(\276I\274Y\316\240\324H@\22534D\252\233#\346\304W\031\252Q\204"
+	.ascii	"`3\370v5\361UF\212!A\301\027\305\214\200j\"\026<\221\n\336\002"
+	.ascii	"k\005\317\304\307l-J\305S\342\253L\344)x\fW\300:P\352\004\217"
+	.ascii	"!*(\202\227\340'\370\247\203\342=\375P\363\315Q\202"
+	.string	"w0\335\342Q\333\034\316\ts\016\374 v@\302\t\315K\t#\336K\004\377`\203`\"hk\336\321\203\340\207|\004\237L\003\224\203\262=\3234\365\220i|\203\242\202\204\234y\340\035x!\337\037<\360Ga\314\302\234\271\211\247\351\347\035u\340\233\024\256}\031 @*\334\023\003y2\316\245\223v\321\006\036\310\033\013\031\370\006~\374\002\317\3007\224\252\366\3431\204Q\340}\374\002\337_\024\370\316\242\t&\360=\336\007\233\017\357\361\336\345\2754\003\217\337\345\323\232\177M>\315@\357h3\260\371\247\t\310;\232\300;\227V\312\016r\353{\222a-\r\215\b\020:\036\002\020S?\344\311\030\201\257\272\356Q\233\201\020x\n\320\376\034\232\365\370iT\020\017? \202\346\250\362\350$\221\262\034c\f\315\210\310L\222\024:R\n\020\006\204\211\"\307\324\003\022\200\2045\215;\203d\204DD$IR\251GkzA"
+	.ascii	"7\004\277\034oi\026\367H\207\001l\301\261\255\300\235\344)\357"
+	.ascii	"F\361\343f\bo)\302\3045\252\334J\376\005U\371\224\274\302\271"
+	.ascii	"\313VV<\266{\366\366j\342\031&\007l\217\006_\3759j\352\346\202"
+	.ascii	" \f\220\330\333\275\322\243\360)\263\307\333\206\350\2162DLK"
+	.ascii	"\"H]5a\023\326L\274(Li\306H\r\013\264o\007G/ag\026\005\273\363"
+	.ascii	"7\027\302@d\261;\343\305}\001k\032q#\264\246\334\250e\3068\201"
+	.ascii	"\025\\\346\245\006)1\007\331\260bC\3355\334\2544V\321vS\256\232"
+	.ascii	"\260l\266.\351\236\250\004Rv\321\343}oG\375WE\270\273\302\363"
+	.ascii	"\233i\250\364\270w\324\f\022"
+	.ascii	"B\307\352\306P\317\036Y+-\220\273\3621=^\363\201\245\243H\263"
+	.ascii	"j\340\324\246\315\024\376\314\247w%\320\250T\267\374\"\223\004"
+	.ascii	"C\250\326\377\217<7\324\221#\377_p\177W\335\230\244csg\212)\222"
+	.ascii	"py\002\327#:\231\377;\260\257\366\225\351\247\032\031(\300\362"
+	.ascii	"t\330Q6.% N\246\332\222\347sy4\364OQ\306\267\204\"\351B2\001"
+	.ascii	"\311\006\t7\007C\375\r\224\346`,\277:+\325\032\221\370\25387"
+	.ascii	"\316(ue\004\006\b\026\337\026#G\214\251s\344\001\020\205B\332"
+	.ascii	"A\003\256\305\257W;\302d\342\366\216\246@M~D;"
+	.string	"!!\016\311\n.\210\002\022\2027\023w\374\3517[!<9\245t\323\b-S\252Fi/\362\237E\304s2\303\343eEb\025\350\227\3221R\331\320\342\030\227\275\203\3322T\327\225\032w {\242\217\267wu\022\362\016\bH\365[\240c\3742\222S\320~\343\r\324\361\326\203\373\226\206\f~\313\246\035\334*K\016\210~}\230\361\347\232\227 l\017\261\354\n\304\274\207\254\237`nl\2461J'\"o\006Xp\262\030\244\275\221R\242\004\036G\2077\202\3774(Fo\311\236\017(\233\265#\273\210\331\207\265P\365\305cc<\022\007\257m\362\243\275\314\262y\352\330\007L5\b\373\366\003l\276\240\267t~\217#\323\005\324\027\030\247w\316d\272\316\277\303\033\312\320E\222~\374s\247\260)\277\016\362\231\036\tSEqco\221c\334\265\202\322\302\311\224\242\017\3357\364\3058/\251\310\013\020\236\342\321m'"
+	.string	"\036\177\331\302S\001\202\356`\030\276\366\027D\275s\213F|\304\022vX\361\224\005K\341\203\342+\324\0374\215\022\025\244\035\203\262\343\205b\261cf\032\003\243\327U\237`+\340S\034\200!{\370\202\241\332\306\230\200\365\366\201\214\246P\214\313\245\363\332\2026\257\020\243\300\374P\362\374\243\372'\247>G\257"
+	.ascii	"\212\370\220\241\002b\205\n\224F{\213y\2719\204\033\240cK-j["
+	.ascii	"\022\207G#\237\006\243\201B\301\335\301\320IJ\312\013\274jt\324"
+	.ascii	"\205<\362(j\356\342\224\"\211E\020\322nC\027\226\242iI\243*\032"
+	.ascii	"\376j\364\017/\252\374\256=\232\253\320\255\272\250\262w\323"
+	.ascii	"0\215l\002\027\347\272\334\366\021\371d4\373\007\36555\265\240"
+	.ascii	"\356\277\241\004\237\177\216\224\367\003\270\245\242p\3469\024"
+	.ascii	"\262u\252\262\032\336\206\211i\272\b\301\247\231\004\246\333"
+	.ascii	"\245S\037\2167\033@\027\375\335)~\335$\264\365x\327\226\200\363"
+	.ascii	"\241\226"
+	.string	"h\352\254\b\223\004\307!As\352S\025tv\003\225k\333\034xa\234\310\035\214\217\006\337fQi\325ZEI\n;\324#\255R\003h\2464\r\323?\213\237\305@tOS\360\311$R\212_b\237\274!\217\321)\306{\237Aa\240\310\3768\023\304c\"\373\214\225\321L\357\262P\261\362\013\312\304\367\037\314\243_\274\345I\311\224\377\360F \303\312\207O\252\005\257\356&e\325\300\204\314A=0\024\352pw\337W}<\366\224K\371\372\002\"\216\305\275\240]1:\020\226P\006\227\260@:\027\2146'Y\340N\003\307l\204TI\0049+\325n\367\022nB\227\2458d\334T\266\263\342\013\236:}H\375\336~\264y\025[\023\033|\221\314_\r\363\311b\341\352\362g\362y!``\252&\304\325&: (@\312\357\205\263/\220\027\035\370Z\212\223\310\216\333\002@\032\005:\002\345\311\330e\013\2017q"
+	.string	"X\334\033q\260\004X\300O["
+	.string	"\025\360\360\373\225\n\253\354\016\363\005\003\202\336M\205\f\374\022\273k\003\2700\304\247\021\177\030\377\270.\304\207\r\233o>\302\325<\032T\277\351\233\360\r\0227\255\352.E1\334@#\002`\200\210\313\376F\204m\314\025\311+\300\2538\2605A\307s"
+	.string	"}iG\022gO%\327{\320\2602\007\226\0238\367\346\254T\362\306\315\3266\352\215a\f\004'\307\303\023\260i,\320\365\202\007\320g\376-p\352\260O\230\224\237vd\203<\242O\270\031\033\035\346\372\027\305\004\013\r\220\202\233\207V\272iU\273\201\213\320\253\002\033\304\030\006\303\227rh\354\340"
+	.ascii	"\242ixb\233(W\240\222\203\227l!\270\225l\201\222\261\343\322"
+	.ascii	"\231P\227b\030tGW\250SY\t2e\377\377\001\005\327\0234\232\334"
+	.ascii	"=(\365\026Rt.t5d\332\203\2078r\352\225\343VT\364\214\b\307{("
+	.ascii	"\324\263\311\303\267W\244\3031\032:\354\f\267\203K\255\b\227"
+	.ascii	"\351\202\017Ec\355\304\225\327V>\255\375\303A\326(\334z\372\310"
+	.ascii	"\037M\265\224?\307a\245\1778"
+	.text
+	.section	.gnu.lto_.symbol_nodes.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`r\b\375\035"
+	.string	"\006\361\256:@lMc\265\230\244\251k}\030\335]\276\004\327)\244F\211a\325T\377\374\343\241]\335v\t\273\033\371f233\331\007\f\346\213\n\333V\240\355\374\f\373\331<{\017\271S\n\234"
+	.string	"\242"
+	.string	"\225"
+	.string	"\346\211\247\231&\356\341J\024\bT)\320\311\255\225\270\037T:%aF[C\344\335\210{-\245\210\273\231\026\rq<"
+	.ascii	"P\024EA\334\233\225N?X\316\203\027\231N\0358n\201=up#\016&\344"
+	.ascii	"\"\031\242\263\r\367YJ\r\237\223\301\241L\213b\260#\323)\226"
+	.ascii	"91\360\247\013\017Zx\233\357W\270ne\353d\025^\245\201AQ8\025"
+	.ascii	"\323\251\002w\232p8\022N\307\264\366U4\302\335@\370\036\004Z"
+	.ascii	"\357b\332\346\241@ \352f_\233P\331m2\231Lf\335c)m\0070\022\277"
+	.ascii	"&Nd2\261\321\264\233\200\205\375\202|y\201\351\370B\362\300W"
+	.ascii	"\203K|\024\363\235\022\333\2059\323\317\223\300\\\227\304\230"
+	.ascii	"\220\370\322\021[2bIE\274\022\261\246!\246$\304\225\2028\022"
+	.ascii	"\020?\3722\335\017C2\275\356\321|\334s1\256\031\327z\334\237"
+	.ascii	"\361\270W\273\356\201;\356\323R\307=Z\346\360&\023\207"
+	.string	"\213\346\215\353\344\246\26186\256O\325\2706E\343\272\324\214kR\266\003t\247(\343\032\031\343zT\tD\337`\\\213*_\234\315\305\327Z\030\216\305\307\316\257Yq\241\212\237I\3419\024'\023B\036q\205\263\262'\n\257\2767wTs\234\225\025\023&\262\375\261\276*8\207\272h;`\275\213|\362\fm\264\345\251\277\"[\254[\037m\323\356\303t\271\007\203v\377\205\313\275\227\263\373\241\331=\233\262{5[\356\323h\271W\313r\217\006\313\275\231+\367e\254\334\217\251r\317\207\312}\037\262{?c\367y\202\367o\352\275\236)\367u\200\367v\236\336\3379z\337\346\336\277\221r/&\312}\234\243(j\037\200r/\347O\\\310\211\017\231vWX\227\2170\257\376\237o\r\221w\247\317\036x\003i\334\233\225\317~0\372l\002\373,o\265\343\262<b\035\227\305\252\333\032\"\357\f\031\223\226\355\220\245\005"
+	.string	"\275\224e\257\206\340\201\305\202t\332*\272\323\022\020~\200 \344\036G:\355\001u=\355O\322i\177t\275\323\212\t'\235v\211\360\005\340\244\251cJ\247}\262V\"Z:\355\331\3266\365\002\334:\261\371x\332\343\371\363\n\200\330\024]\235\266j\235\273zZ\033(4;\272\262T\304\333@\307\240\231\037]Y*\241\\\317R\251\267\251\262\344jF\275\324\215z\266J]de\251\002\200\231\250Q\f#\242ID\222\202\024T\322\001"
+	.string	"\003!\242i\016\021\240\034H\312L \022\211\210\b\245=>"
+	.string	"\2019\354\206x]A\bwD\322\277\244\b#\312\214\304\363\235\261{\313!\303\306\241#d*\230\220M\354\275\343\252$\340\376\337\251\375C\352\247\357\310Z\030)\356\270IR2\034kxRw\325\360\374Mk\232\3225M\351\232\246tMS\272\246)U\007\266\001\223\276\001\355\246\367Y\321H.\311(g2\375\310\243\315ZG\240\313\217\310\244\274\035\3529\347\234s\3169\347L\026rtr\006\210\020\006\345U\243%! \215\260e\356a\257\327\2565\332\261#\246\033p\304A\035\017\3179Bh\223\314\202\203_\243\243\335gi\347\335gq\376V\367_\342\342\236\006\201\375\255\005\310\261d\215\021\324"
+	.string	"\301\321"
+	.ascii	"lr\007g\210a=\202\032Y\253\267\324N)\245\\\352\362\360\304R\364"
+	.ascii	"\377>:\366T\001"
+	.text
+	.section	.gnu.lto_.refs.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\301\002\355\023"
+	.string	"\0262\211A\340\026'\255\001\024\\\351\320i6\213\253\364PJ)-`\230\301\213\204r\204\rR4\302\030c\2141\306\030\007\016c\340h\035\200\017<\342\2040\312B\177@dG\361\017\374'\354\356\356\3667\273e\nq"
+	.string	"v"
+	.string	"y"
+	.string	"\3570\335:\\\236\003\307\215\226\333\306\3525T\367\214\324-\003u\3078\035\206\351~Q\372\n\322S\214\216\002\273M\220X\335#Z\356\204\325\022T\027B\352\026\241\356\203\227\035\230n\003\227\211X\036\302\256\320\350\006\261\214`u\201Z\256\201\325?\252\353\223\272=\250K\3404\217\351\356\224\026\3002\r\351\231\366K{\325N\2216\215n\251=\272\243x\024\"K\331\255\346\263)`\264\250u\037\330\314\340V\220\035\324\272=\246yP\273j\306A-\343\032&\265\213j\025\366\255\006\300\272\334\\\f\347\236p\276\233"
+	.ascii	"H\303h\301\302\346)\262\233h\335$j\216\220\272H\265\020\315@"
+	.ascii	"\254\177X\373\260~\241\371\356\f\366,\\\301^\205\212\224(P\232"
+	.ascii	"\310\234I\351K\224\304<\311\021\230\033a9\221\226\017\021\022"
+	.ascii	"\004\310\017\037=x\274\f\244\327m\257\217\365\275N\210\345\310"
+	.ascii	"\365\271.A\213\212\271\247S{riO5\355\351\245=\225\332\313\031"
+	.ascii	"dz\256\b\356]\240{>\017\334\313\032\270\007\"\373>\264\356y\350"
+	.ascii	"\320>\016?\337\206\002\237\206\3732`\300\356]\310n\305\247\347"
+	.ascii	"\236\202=q\262\004\3439\022\002\355#<E0\354G\206\335\"\354\002"
+	.ascii	"a\377\354\374\242\331\245s\214\316\245W[b\265-:\233r\036\345"
+	.ascii	"\034\300\023\313hi4\232Va4F\033j\024\332\353\t\341\036\314\025"
+	.ascii	"\335T\2535e\223Z\016H\257\325\032\334fs\257&\203\206\"\272\240"
+	.ascii	"}\321\272h[\264,\332\025m\t\025m\212\026E{\2425\321\226hI\264"
+	.ascii	"#Z\021mB\223\320\"4\"\231?6\267@\315<\257\273\363\272:\257sX"
+	.ascii	"\347\274\256+\373\206uYD\323dW&\2731Dc\331]e\253\206V\261.j\350"
+	.ascii	"\226\235\202\231,\257\033& \260\242\241:\036F\tj\236`\213\035"
+	.ascii	"\347\310=c\275\027\226rAew\241+\306\367\262\026\323p\375\205"
+	.ascii	"\033\334.jY%k\311_\270\341\270\212\215\235\320\266\216\301\035"
+	.ascii	"\023v36m\002\303<!+\022l\331m\254\tv\032\213\t\365\266\177\273"
+	.ascii	"H\204\301\001\300jR"
+	.text
+	.section	.gnu.lto_.decls.61ea6ec88627b956,"e",@progbits
+	.string	"(\265/\375`\313i\355\264\001\352\315\366\234T JY:\215\001\324\327\3724\037\260:\367C\027|\222\"*\362\344POy\024\3141\202Q\316\251\236(\342\252\325\357q7\317\346VC\240k4\257.\221,\313\262\004Yw\334\337\346Z\027\202e\226"
+	.string	"#\376\026\003\020"
+	.ascii	"\307%\307p1\323Z\271\367\226[\312\024\212\b\316\t:\nr\230\340"
+	.ascii	"\374\236.\335s\215\320\367\330\320\327x\364\227\327\b\275\236"
+	.ascii	"\243\257[\320\327p\372\232L_;\321\327^\372\307l\364\252\246\324"
+	.ascii	"\3308\34358\357\232a=\334\345y\254k\227\355\255\fB\3014\371\202"
+	.ascii	"\005\347\337\017\350\320\337\337\337\337\375\200w\327\243\246"
+	.ascii	"\315\215\030-\250\021\300\227%E\256\022\247y\033\232\206\007"
+	.ascii	"\227\"8\343\215\321\234\211\223\343r\303\371\314\217\301`8|\207"
+	.ascii	"\2732\370\354]I\343\206\263\031$\023\016\316"
+	.string	"\031\035\234\257q\350\223\210\223\361\3432x\016\323a\273k\206\3530\231\254\334\233\213\334\230\031\\\344\336&4E\264Y\220\262J\356\275q\230+\207\353\260\230\267];\264\rC\213\006N\222\033\004\022\b\020 p\031\036tV>\371:K_O\351\247v\364\3239\372\351R\347k\204\352}\217\320\273\277\274\001\321\251\361]\301\371\367\214\222\245\027\354\206\333\256\031~\303l\307Y\256\231_.\030\355\002)]y\310\370\275\341.\033\352M\007R\260\362\220A\002\001\342\0243D\013\230\316O\317\364\323+\372)\022\3754K\377X\r-\265\022F\b\032\316\030\r\3433\234v\214\206\201\2460Z\336;\352^\n\204\356\245\340\204[\022E\206\346\247,\350\037\233}\240\243F\n\254\f)H\357N\031:\26214\006\220\262:\234\177\254<\036\373\257\036\326\3626\334\2657\227\275w\006-C\016\236:8\337}\217P\234%\351Xy"
+	.ascii	"%C\252\340lb\241\362\323F\017\n\n\347\223\200\202$)\347D\211"
+	.ascii	"\230\344\3153\225n:\206\331\327\222\n^B\244\311\322\215\t\223"
+	.ascii	"&7O(\212hO\301XR\005\207a0l\005\213\341)\370\3125\303Tp\224c"
+	.ascii	")\027-\211\n~\262\243\240J\300u\365\211\371\355\255L\313\366"
+	.ascii	"Xx#\312B\327\b=ZF\037e\323G\261\350\243Q\364\321.}\364\206>\032"
+	.ascii	"C\377\354\323?\376\352\371\"SC\007\316J4m\364\332\254I\352\271"
+	.ascii	"\251\213#\343\227T~\271\223\0243\206NR_[Rm\355\236\231\312dz"
+	.string	"&D\306Rn\356\332]\273\255\003\200\271Y\212\275)\003\367_e\230:rp\344\226W\371\206Go\017\317\355O\312\243\366\343*|\205\207\340\032\230\007\006\202\215`\0318\b.\202\217`!\330\n+\30130\r\234\004\377\300H0\026\366\302Y\270\013\337\300=\360\026&\202q`\033X\013\357\300>p\016\314\002\326q\3150\027\206qL\205c\034+\367\236\332{\337\203\377\352\311\271gqlm\367,\317e\373\223\360\334;kI\2759c\222I\230\013C\341)!s\357!Y\222{\357_/\177ih~\367\214\355\314\177\365\342\220Q\373\223\350tI\252s\357pY\212\371\257\036\337\234\227\377\352-\351\270\374Wy\273\374\351\261\321CK\273gBPD[\352\314\214\244\231\273\275d\022\336\367\354\332m\035\240\n\032\t\314u\325\334\274kwD\001bl\226b`\356\231\220\271\367\017;\311\275\225\277Y\376\253\3749\360"
+	.ascii	"s]-\367,\335v;\306\231\020\026L\2611{u~{+A \2010w \311\242K\221"
+	.ascii	"\315}\217\320\r\270\350\037K\035O\3353\f\354\f)\224?\032|8\343"
+	.ascii	"\250\244c)#\024kK\271\321\366\336C\022t\201{\3039\275F\350\317"
+	.ascii	"-\372g\024\375\323K\377\324\241\237\347h;9G\031\"Lp~\336\323"
+	.ascii	"\317p\372\231L?\033\321\317<\364s\r\375,\245o\342\3217\343\350"
+	.ascii	"\233z\372\246\234\276I\246o*\3217\267\364\361\237>\206\243\211"
+	.ascii	"\256\021z[\270x\327,\203\273\3467\315=\3633J\271\225{+\207\260"
+	.ascii	"\022<id8\037\347\351\337\fP\363\357\357f\200\036\323i|\215\320"
+	.ascii	"c6M\204\3014R\231Kw\315\220n\335\036\272wR4\270p>v\242?\260/"
+	.ascii	"\022\372\277\213\204\036\023\321\036\260\r\375\201\216\336\200"
+	.ascii	"\214.1\246\177\223\350\243\335#\364\367J\337\355\036\241o\365"
+	.ascii	"\307\334#\364\023\320\267\273G\350I\320\307\273G\350\017\240"
+	.ascii	"\277\274G\350\035\273d\327\254\303\335r\016<\270\t5\266\305\366"
+	.ascii	"V\016\005\345\t\313c\007\347w\240\177\313\016\301\335\366\340"
+	.ascii	"E\372\267\003z\377n\007\364X{\270F\350\375\356\021\372_,\031"
+	.ascii	"\350\251/kb8\377\367\312"
+	.string	"\177\255\\\261\016f\225U\327F\333[Y4\244\314q5\004\347+\357\021\252\257\021\372\3434Y\370c\033\023\340\t\374\230\002\277\231\232'\366a\366\231q2\213\337|\363\343)\252\034\374q\236\274/\031\003\277\311\226Q\340\006(\340\307&\374\370\216\t\364\233h\376\f\374\257\t\370\302\217\353`\f~,\200\037\213\370\261\337\375\373\257\235l4\201+\002\006\371\002\177\256\300\237\037\360\347\025\177.\341\317)\376\273\304A\346\020'\003\377\271\006[}\005n\023\364\237r\277y7\b\376\370\212\b\013\374\230/\207\360c\263\f\001\346\221A\370\257\bp\316\026\3302\212?\237\370\3151\177^\300\237\023\360\347\r(\360?\203\314!\233hq\f\377\211\304\307\222&dL\264\234d\226\375&\035\266\302a\002\031r\001\376\273\204\325\374\017\361\237]\260\223\353\200[\001\n`.\271\203L\"s\360\343\264\f\204\366\233k\177N\272\"p8"
+	.string	"\376\363\212\211\231\244\2217\370_\227G`U\231O\256\211\037+\271\005\370\357\004\377%\300\221,\3427\245\374\370E\026\300\2375\370\257\321\237C\374\270+\2030\253\230V\376\034\200g\300\340\212\020\226?\374_\203[\\\001\3779\200?\367\374\030\307\005\177>m\034)[\360\233\037~\364\243*\374\371\374\257z\225&x\372\243\016\300@\305\005\236\303'\360\025/\372\321\021\376\253^\245K\201\013\264Y\002\tr\207\037s\311\034\314\rX\353[n\006&\360c\340K\310\021dx\006?J\342\277@\314\345\n3\240#\260Y\206@\004\254\365\237\037\ra\376=\037\375x\b\235\340+$\270\321\217Z\360c\255\214\341\277\031\270\"L\360c\275l\204}\234\303\217\331\364\374g\334K\270\371\243\033\314\026\277\351\203\036\375\246\004\371\302o\022@\001#\240"
+	.ascii	"\201\\\224\211~\223\002y(\013\375fP\003?&\376\270\3517;\344\240"
+	.ascii	"\377\035~4\001\277Y\342\3547U\370\370\315\004d!\373\315\022T"
+	.ascii	"\2404\371\315\025Jj\330\260\362\233!\020\371\315\022A~3\001P"
+	.ascii	"\277Y\002\371\233$\326\337,\361\337\n\374\227\002\377\265\300"
+	.ascii	"\177\201G\177\324\205\271\341\n/\364\247\001\370\257\003\376"
+	.ascii	"k\302\177K\370\315 \377\025\341\377\371\247 \374\346\325of\375"
+	.ascii	"&\326o\322\370\315\031\277i\365\2335~\323\306\217\3252\320o\272"
+	.ascii	"\370M\031\277Y\365\233^\177\376\371O\364\247*\374\331\347\317"
+	.ascii	"\350\237\361\237\377\233}\277)\3477\371~3\3577\361~S\315o\242"
+	.ascii	"\371\315\273\337\264\373M\272\337\234\373M2\2779\3467\337~\263"
+	.ascii	"\3557\327~3\3557\315~\323\312oN\371\315'\277\231\374M&\277\371"
+	.ascii	"\365\233I~\323\3537s\374\346\215\337\024\376f\3607\201\277i\201"
+	.ascii	"\337\244\300oJ\3407!\360\233*\374&\n\277y\302o"
+	.ascii	"\226\360\233#\374\246\b\277\251\200\3374\300o\022\3407;\370\315"
+	.ascii	"\r~S\304\217\341\374&\210\337\374\360\233\030\374\346\005\277"
+	.ascii	"9\301on\370M\r\277\231\3417\217~\263\3507\207~\314\3467\203~"
+	.ascii	"\323\3477\323\337<\177\323\374\315\373\343<?\276\363\343:?\366"
+	.ascii	"\373\361\234\037\307\371q\233\037\343\375X\315\217\311\374X\314"
+	.ascii	"\217\301\374\270\355\307]~\314\345\307j?\336\362c\262\037g\371"
+	.ascii	"\361\225\037[\371q\330\217\245\374\030\312\217\235\374\270\311"
+	.ascii	"\217\227\374X\311\217\221\374\230\310\217\203\374\330\307\217"
+	.string	"{\374\370\002\377\r\376\227\305\217\321\377\252?\306\361c\033?\326\3721\326\217i\374\330\352\3073~\\\365c\252\037\303\3701\007~\374\342\307-\376\257\370\277\345\177\t?n\177\214\3741\373c\340\217-\360\343\n\374\030\205\037\237\360c\007\374x\304\217%\370\361\004\377\325\300\177\227\376\253\364_\341\177Q\370\357\b\377S\370/\212\377\236\370\357\002\376\253\370/\002\376\033\342\377\225\377b\377u\374\227\373\037\342\357\357\357\357\017j\177\b\202\177\bj\002!H\270\361\005\n\347o\240\241\377\254&\253\271g\033\244jRJ~r\271f'\027|\246\247jo\255\016\250x\361%\3756@\351\377D3;\321N5s\357\250\255\0038\031\363\261\272\323\203\b\316g\032\032\026EH\025\234\037\001\034\375\b\354\314\314\316-'\332{K\355\375\303\007z\305\313\345\374\334r\336Ea\242\206\363#\020\323?\225\367\034#{[\336h\033\306X"
+	.ascii	"\350\360EPD?\002\032\372g\226,Z\b\260\343\t_\322\257\357\312"
+	.ascii	"\225\303\245\330QY\033\204E\361%\375\352\364\317*\027\307\341"
+	.ascii	"\270\266*m\377\261\005\267L\237\21458\377\234rO0\2563,\367i("
+	.ascii	",\275\326\204m\251\301M_C\026\375\233\373\320\377\224\"\345\332"
+	.ascii	"m\220\236\271A[~A\201\222\245\207\023'b\032\254\2324y[&\332,"
+	.ascii	"\324\300\222\314\263d\311\333\262r\177\335>/|I\260\215\265C\034"
+	.ascii	"i\251\377S\311\257\331\251\004\217\245\350\212rR\302\nV\237X"
+	.ascii	"\n'\352M\017\234\217\244F\377\247\221_\263\323\310\211\344C\327"
+	.ascii	"\266q\201\230\256>1:1\274\302p>\217,\351\022f\211\363\221\340"
+	.ascii	"\364\221\262\350\237^\367\034rr\235Dn^\336GvT\224\007t\274(C"
+	.ascii	"\034\351K\037I\207\376\275y\350\177\002\3715;\201\234A>tm-\r"
+	.ascii	"\234\330\271\311q.\221S\003\n\347\263+\355R\223\006\017\347#"
+	.ascii	"Y\351g\270\243\377\323\307\317\201\007\327\354\364q\317\356\330"
+	.ascii	"\256\341##*\217\237\337\336cB\f\315\231\342C\t\316\317\340\246"
+	.ascii	"\177\3528\267~\356\370\271\343\354q\367\336{kC\275\361\200\316"
+	.ascii	"\023\276\244\337\336\302\372\360\237<~\366\370\036\320\346 $"
+	.ascii	"\006\267\244\203\363\345\344\276\377=@\270$~8?C\021\375\377\036"
+	.ascii	"\377\350\216\302\332{k\235\312\215%\005\204\376\367\367\274\367"
+	.ascii	"\303\037t\315[\301\377\274\367\005.\240\3340\344D\331{\3378\032"
+	.ascii	"J[T\017\017\373\264\333{\312\013J\001^YS^:\252\312\274\262\212"
+	.ascii	"\252\312\2746\324\024\023\250\"\254\355\005UU\266w\321\324\024"
+	.ascii	"\024\212\256\254\252\262\250]TU\266\2636\214\273\254\273\225"
+	.ascii	"^P{\252k\027\355\251\035\265\313\272\262<TMyeU\225Ee\025U\225"
+	.ascii	"ye\3552\257M\264\247\242\260dLm\254\242]\346\365f\227ue\021U"
+	.ascii	"\225ueU\225y\321\335\253\031u\304p\304\211\242\004\357fU"
+	.string	"Mm\032W\\QXDvU\312\256\215\267\367E\243\332X\333n\357\n\366\346\352\302\302\213\322q\335\244\354hHq\211\352\272\312\275\267\206+)!]{\312\016\352n\273\252(]{G\221b\332W{\357\335\001\224\322n#\271vPC\270\266\025\325\336\021l\345\336W{C\335m\267\367\206\332{\247X\\\312\275y\020U%\257\256\366\336B\272\332\\PoT{c\264<\267\254\2522!]Io[\312\222;\206\022\352VYu\355\344\306\363\302\322ePZ\266\325\336\373\302\321\311,\033|'\216!\221308\037\002?\375g\274k\226\361\260\232\024\312\r\305A\312\035\336uH\322N\255\241(5\206\304\341|\b\330`a\355\271\305\321\240\221\346ffe\365\266\213\005A\2144\265\345\306\302\nq\b\240\314\230\361\266\367\354=f\313mcm\205\270Yj\324\362p>\004B\364\177V]\263\263\352m)6\f2"
+	.string	"\354\210\342K\372m\254\255\020@F\314\270\201\303\371Gt\364\177\3068a\3744\001\263\305\207\307,\3439a\244\350\212\362\332\240\357\311V\210\234c)D\r\316\347\024\222\n-`\321\201\363\217\332\350_\271s\277M\250g\3571WN\250\234\347mBS\312\375\205\2660\266\347\305\357\224:\243\256\331\t\225\377\320\366\336 @ \365\204\005\001\243B\363\217\332\364\217\310\364\217\256\350\0379\321v\224\030\266\250\3208\222\351\364t\361 \213\302\371G]:\373\335\214\312Q\246\355C\236\3233\245\034\002\212\312\301f\006\347\037\351\320\177\266\253Sb\221j\"\207\343\330)\3013\222\006N\346;\363\322\250\354\335=\363\375\371LF\223\337"
+	.ascii	"u\275\221\311a\341\274D\217\314\251\222\302\371G5\330\3446y\357"
+	.ascii	"\232e7\271\005$\022j\316\364Hr\223\323p-\263\233\214\227\365"
+	.ascii	"8HU\355(!\027@q\313CF\250k/-\215\316\177\326\3133\275\344\341"
+	.ascii	"{cF\211F9\302\367\005\347\377\327,\257\301d\224\033\t\333X\203"
+	.ascii	"d\017\347\037\311\320?\202\322\3070G\037C\033\275a\337#\324L"
+	.ascii	"\232Iz\276\003\202\203W\026\206s\004vuQ\326\344LQ\246^\276,\257"
+	.ascii	"\350p\335\223)qp\224\231\273\312\2560<p\317s\177\016\223\305"
+	.ascii	"d\271\013c\357\252\016\316yL\216\273f\0322\031\276#RY8\037C\032"
+	.ascii	"\355\201\275\257\006\364\376\375]\r(\356\272G\350\005\327\b\315"
+	.ascii	"`\222\236\341\204\262\302\314\324p.\372\242!\245\362\006\244"
+	.ascii	"\210\2277\334fK"
+	.string	"\224/on>q\242(\251\201s\233\217\025&fr8\037\303\233>\211+f\252\2301\204\314\275\243\364\222Q2Y.\313g\231K\326\222\323\262YV\313h\271K\336\222\3072\3335\313k\031\313s\226\254\364\002\326&)\257\345)n\226Ik9\314\214q\355\266r\0256W/\257\345'\031\312\265;\222\305\352X\311\243\342\304\316\032\356\303x\256\335V\216rg)v\317\326\254e)\367L\bJ\271k\244M\242\316\200\371\355\255\fz\303\205\346\213C\306X\367\b\255\340\032\241\307\260\245\217\001K\037C\f}\243;\372Fq\364\215\332\350\033\265\240oTF\337\210M\337\250\212\276\221\020\r\3457\357\016\305YR\347\013\347\033m\351\033a\351?'\233\3445#mu8\347&\177\016\222\2752\023\034G\n\224\022\347%\272\t\236\21418\337(J\377\317F\262\222\214$'\311G\256Y\376\312B\236\207d\"S\\\266"
+	.ascii	"\221\033\363\221\024\323\362#\271\3676\311bp\345\257\\\344m\246"
+	.ascii	"\026,\b\250Z@\262\334{#\001\275\341BC\007\224\177!\217\276]\367"
+	.ascii	"\b\305\260\324\246\335=B\017\220\273\200,\031#\"\205\363\237"
+	.ascii	"\201\344\030]oh\314\340|\022_4\226V\316\260\tb\244\207\0301\275"
+	.ascii	"$\034,'\017\314\036\235\244\2672`\360r/\211\343\350QA\371[\202"
+	.ascii	"\271\t\333K\212\025\341Z\276i\203\341@\315\005!\342c\231e\212"
+	.ascii	"L\022N\224\234"
+	.ascii	"T\325\230\244\030\036O\2520\030\314\307&\213\327\221\245\311"
+	.ascii	"\227w\230s\262\216\234\225e\344\034\231\207\311\306\3143\315"
+	.ascii	"\230\177\031+_e\032&^\266\312S\246\235I\306Tc\266\311P\346\035"
+	.ascii	"s\215Ig\3461\351\230~f_\206a\2061\361d\026\314\275\034e\336\231"
+	.ascii	"z\346\033\263\205\\e\2121\317\344\032Y+s\231v\3149S\316t\223"
+	.ascii	"\177\230iL8\231\312\254c\226\31132\0163\216Yg.\263T\276\221m"
+	.ascii	"\344\235}\344\036\246\034\023\215\031\227\267\3141\327,\3070"
+	.ascii	"\277\334\004c\302\2715aa\251e\352\250\342&\243M\215\212_R\216"
+	.ascii	"kI\322\224\242\241v\225U\332`8\373\332\301(\203f\003\313\016"
+	.ascii	"0S\252FZ\220#Dx\210%g,\325n\\Ir\301!\226d\313a\005\fv\343\267"
+	.ascii	"\3141\314,&\233\251t\023Aj\315\022SE\311\203\251\230X\201\301"
+	.ascii	"m\352x\360\233Z@\222\240M\251\263<\243\244F\\\017&\246\224y\265"
+	.ascii	"\206\341\344\030\270\017\3431\225\311\020\314\360\226?\224`8"
+	.ascii	"8O\235)\205\205\266\224\3121L\030f\f!(\242\275\211\304%\367\336"
+	.ascii	"Z]H\340\254\270`\252%WmuI3\310\220\037KS\313G\232/\f\007\377"
+	.ascii	"\321\231R3\330\244\3301\245\262\262`*'2\226qHv$\345\222\244\331"
+	.ascii	"JJ\261\320e\351&E\347eni\006\3111L!@\226\246V\216an\205-\367"
+	.ascii	"V\242V\340\240\004\271ZY'\357\021z\251\256\021\372\013g\364/"
+	.ascii	"\200\321\277@\246\177!\212\376\205 \3727\2257\331~\363\212\211"
+	.ascii	"\305\354r{n\304ya\303\231K\236\031lWp\376\005\036\372\277\231"
+	.ascii	"f\242\231j\346\33153\327\314\262\233fW\314\361\330\221\245\234"
+	.ascii	"\271fn!K\242\005I\322\\3\311\240\360=\321\362\333[\211\004\002"
+	.ascii	"\004\b\020'\222-\2763>\371E\177\032\365\323/\232\243_\024G\277"
+	.ascii	"\210O\3430I7\225y\310\234\032Op~\321\236\276\313{\204Jp\215\320"
+	.ascii	"\027\315\351\027\225\351\027\201\351\027!\321/\332\322/\252\322"
+	.ascii	"'\212\243O$\247O\264\246O\024E\237\b\210>\321\225\376P\036\375"
+	.ascii	"\2416\372Cs\372Cd\372C`\372C_\372C:\364\207\244\364\205\334\350"
+	.ascii	"\013\305\351\013\245\351\013a\321\027\372\322\027\362\241/DC"
+	.ascii	"_y\215\320\007\371\351\007\255\321\017\032\243\037d\246\037\024"
+	.ascii	"\246\037\324\245\037T\245\0174G\037hN\037hM\037(L\037(\210>\020"
+	.ascii	"\r\375\037;\372n\327\b\375\217\032\375\2377\375\237,\372?^\372"
+	.ascii	"?3\364}\374\364}\342\364}\266\350\3738\321\367\361\241\177\223"
+	.ascii	"\352f\214\3373\266\311\216-8\3374I7\251L\2670Twp\276\217\016"
+	.ascii	"}\037+}\273<\372=z\372=_\364{\252\350\3678\321\030\317\217\347"
+	.ascii	"\\/\370\016\006\200\222\340\260Q\2073\256\203\355\034\337\301"
+	.ascii	"t\360\235\016\272\366\216\302w\206\356\354\0355t/\005\367R\220"
+	.ascii	"\253\bi\242\206\346\367|\351k%\351\330o\350L[j\330\244\\\231"
+	.ascii	"\275MsiI\356\275\211\200\362\342tA\303\371!\236\350-\275\245"
+	.ascii	"y\374B\024\022\r\234,\363\220\361\333[7>\374z\3075\217\254\207"
+	.ascii	"\236Y\372\230\021\"\210\376\265\216sKN\333qDH\016\275\243\236"
+	.ascii	"\354\240\203\303\306\017\255\262\0368\377\232\351\033'\233\005"
+	.ascii	"\360Y\021\3216\320(9\236\330\271\241\005\347\244\216M\233,\266"
+	.ascii	"\013jQ<\260\316H\030cEI\re\324\031<}4\320\260\r\270\341qsu\252"
+	.ascii	"\321\221\305)\261J\275~\234\241\263\006g]\245\253\364\214\247"
+	.ascii	"\253*\\k"
+	.string	"\366\350xh\031\3273|\362`\244\241\345 \243%\013\r\316\017\261\365\224\236\322T`CQI\300\364i\030\327T{uUli|:JG\235[n\016\253\277901T0p>\210::t\364\026\273\232\222\003\254\007W\232\270\364\357z\357}\321\221%\004\3474\317\333\342`0Q\203s\212\347l,\250\355E\3019\275s\266\2566G\212\340\234\3329[\034\233\034\0348\247u\316\0266\326\307\305\346$\214\214)\311\276\276\264\rI\357+gz\313\275\267>\374T\265\201\263\206+N\234T\316\035\3335:0\366D\013\214\313\031/*\234\345\274\355\310\223!i8\037\304fs6)\337\035\3335<\360\332\363\002\226g\215\334N\337<\345k3\273C\204\r\316i\233\024\310F\020\277\266t\231\272q\262\204\206\216sjc9V\366\244\322\275\374\327\206\206\233;\001x\223\227\307\001O\324\023-\241-pu\362p~"
+	.string	"\334\360\360\3226$;ZO\264\374\202\346\264\335y\341\374"
+	.string	",Q\243&\315c\245\347\346sC\312\234\025\316\017"
+	.ascii	"\027\0324\350\025R\027T_\272ue\344\216\337\215\341\243\214\315"
+	.ascii	"\314\335\335\311\346\007\213U\235\037`W\210\034\022\0378\377"
+	.ascii	"C\027;;\024\214U^\322\217I\035.28\377\003\025:\272\324"
+	.string	"\354\216\355\032\034\340{\242\225\312a\243\352\302\371\037z\314\315\245i\035\266\254\376\346\374r\025\035km8?\2031d\310\234l\220\272\240\344\244I+;q\260\034\215\2667\234\237\001\222/O\303|I\307\244`\220\030\331Y*\002dN\314\3231s\350\237\231\233\027\\\n&\003\257\267\267\0372Vu~\200\355\275\365!\b\311\031*\2609]\272\244m\032\262\274\236h]1l\246\356\260=m\333\303beh\256\320\254\375ki\332\315\251\375\203-\271\367\326\007\006P\251\333\302\371\030\274\235\235\245i\035x\364\230\301\2627\227\242=Mk\003R\273\3627\006\003-W\236\222]I\315~\224H[jj\377\370\341\223\305\212\317\213\337\256\342\372p*!\203\005GZ\366\324\354,\317\314\227T\313\323\261\277'm!\215\334\030\316\307@\206N\263<U\376=g\017\033zQp>\006S\372O\261\374=@G\346\350\370p>"
+	.string	"\362\350\003\300\017\f,\265\202\336\260\332\233\003\224\245\316\335\225*O\255\004\3111\263\303\202\363\345\244a\377{P\272\032w\352\340\334\243\006\216\0174\234\017"
+	.string	"\265(Q\322)\251\237\225\236\033\330\231\"3XH\245<\2352$%\345\253K\235\377=A`m\322\354\300\371"
+	.ascii	"\370"
+	.string	"\361\344\t\312e\225\227\004\003j\023\373\032\323&\231<\331\034M\261R\303\347#F\211u\005\347_\200\2262I\231\234[\356\330\256\201\324\347\345\203\220\026\256(op\376\005U\364\237~\245_\247\332%\332[H\\Fk\243\"\003\347_\200$\035\3624I:$\275\301\202\252'\013\231\325r\317\210\326\016\234\323#)\222\324HZ$%r\301\215t\353i\220t+\365\372\260\265\265:\200\242\225\342P\316\241\361s\027d*\t\316\351\217\264\253\347\213\325\031.\234\237\0029r\267D\n\3168\365\221\212aM\245\341\374\224\313\3043\367E\006\316O{\374\357\371\200^\2200\234S\036\232\352\002\030\031\364\344\215\265Q\202\363\237\356x\312\003[\365\330r\2033\212\227\364t\007n\202&'\207\363-X\243\3774G\232\003\237\311E{G\335A\353\274\306\234\341|\013\330\322\034\205\203\306A\345\\34Mz#IjG}i"
+	.ascii	"\205o\330c\206\025\234m(\243ZP\023\207\363-\320\242\365\346\240"
+	.ascii	"~l\226t\364\360\240\177\327\356\210\002\246\324\241u\320>\016"
+	.ascii	"RU)\304\362\254R\250T\306\265\333\"\332Sl~\313\324\n\275\203"
+	.ascii	"G#\325J\263\322\032)\013\351U\212u\315R\253t\037\215\203\312"
+	.ascii	"\231\222K\255P;k\226"
+	.string	"Cq\254\234\351 \312\350\234\267\341 U\225\002\313\3362\255Jg\\\263T\006Z*#\215Jcx\021\200\316\312J\025\r \202\370\320\340\365@\363\237\306H\251\204\270(\215\300\3019\205\221n\351\220\203\201\363-\b\242\377T\352\232\245SZ\016\330\233\2356\377{~\304$\021\362C\337\202-}\013X\320h\036\235f\351\203\016\347["
+	.ascii	"C\337\002(\375\n\352\350W G\277\2026\372\025\340\351\037\365"
+	.ascii	"C\373\312\310\304\241\353;S\306J\n\347W\200Fc\345=B?\\#\024u"
+	.ascii	"\203\276A\371\376\236\241*nE\326p~\005s\372\350\362\177O\tI\352"
+	.ascii	"\326p\316\367p(\332\346\350\336\337\203\345\232$\257p~\005b\364"
+	.ascii	"Q=\224\315\337#\204\307$M\013\316\257\240M\037\315[\373\213\263"
+	.ascii	"\003gt\215\246\252@K\006>>\330\200\364h\341\350\232\037\305\273"
+	.ascii	"j\370\316\n\177x\372p\016\272F(\252&\351h\013?ta\226Yp\006\272"
+	.ascii	"F\350+0r\346\314^\262\202-3f\3200\265d\005Vuu\250\222\003w\312"
+	.ascii	"\224A\317R(7\224\n^|I\2607rrh\230\2254qq=\302\210\021\203\302"
+	.ascii	"\245 \332\333HU\362\f\f\030\024.\205rCY\300\013_\022\214\003"
+	.ascii	"|E\232\340|\n\254x\361\202\236\021\331\242 \351\346\206\206\245"
+	.ascii	"Pn\250\004\360\361%\301\216\254\241k(\333\007\345\266\321\001"
+	.ascii	"\257\033!r\335\351F\005\003\f\312\345h\027|w\247\252\252\374"
+	.ascii	"pNJ:\312\345f\261\243E\f\316\247`+-\315\n\005Wc\327\f\035C\317"
+	.ascii	"\210\254\345:`\222\2711\263\243[~S\n%\303wd_\334v\340\214\226"
+	.ascii	"%\0355\303\313z\303\201\363y\215P\224\002\030W\320+\250\322M"
+	.ascii	"\256\303Y\340\244\270\301r4\013\276\323\313:f\2268s\220t\024"
+	.ascii	"\013\n\006&\b\035\234\357\241\317\212\0255\017l\246\\3t\n\032"
+	.ascii	"\226\202ho!u\311\215u#D\2563\315\210\030\221\202\202\375f\020"
+	.ascii	"\224\n\276K\207\304\265\300\206s\336\367\b\275\0073O\320'h\024"
+	.ascii	"\033\032X\321\272\021\"\327\221\301\243\202\202B\301w[nN\350"
+	.ascii	"p\276\007/\311$zua\357\275\223\351\334\2258\b\222\254\251\302"
+	.ascii	"\371\036\252|}\241L\322\2701\276$\330\320\216\275-,,9\312\004"
+	.ascii	"\333\231\243&\005\347\313\3118\336\254\224\301\371\036x$I\342"
+	.ascii	"\346\013OA\223\223\205\363=\3248r\304\r\215d\332\\_\024\316\367"
+	.ascii	" U\244\310\271EC\335\272;\276$\030\352#jK\236F\203\240A\320!"
+	.ascii	"zk\210\323\342K\372\3456'v\202\b9:Dwq\311\241\2033\352u8\355"
+	.ascii	"f\312\225\332\004e\364o\330E}\\3\324\007\n\004\001YQ\\!\314*"
+	.ascii	"H\274\314A\177\fi1\331\023C\002\262\352\301\006\207\363'\b\243"
+	.ascii	"\177\264\007\332#\253\004\024\276T\306\021,;\302v\3548\267\350"
+	.ascii	"\335fF\236\"\353\262e\210\016\035\347\026\r\245\227\034zr\004"
+	.ascii	"\016\013\316\237\340\312\206\r\024\207\336{C\021m)\275+\311 "
+	.ascii	"!\\St\320\033Gq\354\241w\224?\256l\374\357\021\312\203\347\n"
+	.ascii	"\r\347O \225\225un\271kH\226{k\353\003\3325F\016\027\234/\001"
+	.ascii	"\237Fk\2405\240h\231f\264\200\354\300\371\022\230A\255P+\364"
+	.ascii	"\252\007\001k\326,\207\276\310\250\361\004\275z\333\226\022,"
+	.ascii	"\234/\201\233Fe\2402\320\031={\277\001@\217\261\023\215]\025"
+	.ascii	"\0378\2433\356\331\317\232,\260+8_\2021\375\2431\256\031\032"
+	.ascii	"#\317}\350\332Z\036\244\300\201#\0264\305\313\016/\234/"
+	.string	"\201\021\375\2430\256\031\n\343\346}\350\212\212\272\200\312]\036?!c~\300\300\371\022\350\320?*\205Jy0&\201\f\375\363\357\242P(\324\223\016t\362\344y[\212.\030ZJ\364ye$z=\346\364\356\334\311oZg\300\322>\251=\0348\277\303\233\376\317:u\274t\300\242\377\323\357\232\235~\271I\212\256\255UB\316\335\023\255\236\270:=\352p~\207)\372?\347\234s2\020\263\252+JH\007N\310\362\356\3509B\264\330\341\374\016Vn\3168nN8\350ry\302\271\033\253/\315\342\033\302\262e\346\n\337O8>ov\234$\316\347\233\334\207&\271\341\340|9\367L\310\0346m8\277\203\224>\0078yg\233\274\223\r\006{_eW\r\254\275\205\365AO\357d\223\002jo(\345\256q\344\343n\353\203\220\2223s\376pf\203\326\343\004\212\020+\234\317\341N\237\203\032\036\336i#+w\326"
+	.ascii	"\264\306\204\370I+B\367\206\3639\204\315\315\235j<\354\275\251"
+	.ascii	"\366S\034)~K\273\237j~\246\271Ql\350h\340\374\363\314\211\346"
+	.ascii	"\3579\371\276\210\361\202\3639<\321\247\231\363\356\177O\317"
+	.ascii	"Y\030\231/8\037s\370\312`\005\231\030\0368\377I;_Lp>\353\316"
+	.ascii	"\366\277\307\247\314\332\214\0348_\316I\367\277\307h\n\225*\272"
+	.ascii	"2<\240\314\2711cB\raA\016\347s\350\241/\342\236qd\016\327E\305"
+	.ascii	"\315r\203\035\375\rq:\f\334)&\367\335\255\265\257\214(T\3666"
+	.ascii	"l\321\337\340\344\355\355\004\203g\354\313O0`\340\276\224\340"
+	.ascii	"|z9\331\262\276\220\341|9=W\n[\230\032\316\337\340C\377g\333"
+	.ascii	"\331\206\325\364T\235g\232,7\326V?\355\332\264\222pA\311G\037"
+	.ascii	"\215m\n\254\2615\n\001\203-QE\2416\255\355\317\261I\330s&\021"
+	.ascii	"H\2466\330T\\\203lO[\\M$\221hB\250\r\032\211J'\321\231D\250M"
+	.ascii	"k"
+	.string	"{\022\211&\324ve!\320\256\305\021.\234I\304\b$\253\266X\331a\273\026GP:\222`d\202\211V\025a\270\0367\b\251G\017&\206\353\261\202\241\261\211]\203Dg\022\361\202U\3336\310\342\001\034\206j+T[\025Eq=\246\340\"(\001#\373b\311\b\271\036\255xA<\036M\f\327\343\2063\211h\201\035\316$bD\007\344\b\252R\020I\\\203JDJmqe\211\350\231D\030\331\027K#\220\254\021YT\221F\366\205\bDM\254\272\002E\021\222\205\211\013D%\025\205\020\205V]\032\"\006\205Lm\260i\004\262]Y\214p*.\t\340\311\251\270\022\005\320\301\007\300\017J<\215P\207NDaq\035\301\"\235F\214pad\231Zc1U\n\252\304\334\"\213F\341\251\324\262\033@\236g\0221b\250\022Y\004\213  GPY\2476\250*\021\235I\004R\035\032\233@x\300\b+N\230"
+	.string	"\202\200\302\004\025\300\023("
+	.string	"S\030\241\350L\"T\326(<R\221k\004g\022\201\002r%jb\325v\204\341z\fzq4\236 \002>\330\006\207\255\212\024\002\252m\220xlRWlxq4\236\210\240=\223\210\245\343\210\245\243\260\350\024\302\322\361\247\250\204O$p\351\b\324\002\213K\307\263\270t4\231\332\245\242JD\325\025VdF\"Uv8\f\246/\216Faf\333\2439T\213K+1\230\016U\244SF\246g\201KG\021A/\330\026\271.\251(h\350\200\004\007I\021\030\006\235\034`\202\030tB1\224\202\270\006\333\007\b\235\320\006\211!\030[\241\t%\"`l\205&\374D\240\203\243\221=A%.\025\327\024\206N\370\340IM\361\201\004\322\005\004E\340\204a\320\311\001>B$\264\252\b\031Z5\205\t\216\306\026\351\323\256\254\213\037\244\212\002\351iU1\f\032I"
+	.ascii	"B\242/\202,k\302\330\"\235\204\034T\326\t"
+	.ascii	"\003\t\303\240\221\bA\273\026{\204H\020\332\265\270\022\261j"
+	.ascii	"{4\nWv\005r\004\"\"u)\350\211\r\266A\024B\026U\207F\025CAK\305"
+	.ascii	"ui\311H\034j\221F\343\002\202Nh`\325\247\365B\260\r\242\030\256"
+	.ascii	"\3074\303\tEZ%\262\b\256xZ\233\206\2106\020\321\262"
+	.string	"\301\243\210\245\342Z,:\241\240\262\301\f\352\320\250\202\b\211T\205\302 j\201\022\024\330\340\002\347\323\252\202h\202\rD\250+\254m1\350\344\200!\005\027\222D UP\241E\006\211\030\220'\224\216$\024_\240P\333\340\360\350d4T\201\254\372\264\n\201\332\013H\343\nuhT\301\204\f\262'X\265U2\301\252-L8\256\304\020^\020\217\307\240\005G\034\210\030!\003\004E\343\332\nU\2265\236\310 DB\304\nb\220\250\270\264\246\360\264\252\270@T\\U\b=\005\213\253\nu\251\030D!hX\f65\031O\b\331\236\366\350B\007\"\220N\306\265\205\312\236 d1\264Mj\213|\221\302\320\231D\b\201j\323\332\026\235\330\021\302\t\220KAb\bK\305\265\211\r\376 \207E\020\332\242\312\262N'\206E\023D'!1(\f\300\205+\253\026\325%\375\016>\020\300\007%\236\322\227(\300\006\005\330"
+	.ascii	"}\211\002$%\025\340\203$\375\017\222\314\026\210T\241\002\177"
+	.ascii	"\\\030I\270\300\264\264\246\030\222P\321\304\006\221\353\260"
+	.ascii	"\210iiM1t\241\013#\t&\b\265g\0221\242hlj2\n7h\340\"\201!$\265"
+	.ascii	"\307\037\265\r\266\310S\351H\302O\013\344\200\204\n\034\216\360"
+	.ascii	"dd\221\266@\244\nj\323\332\352\366D\002\323\266\350d<\341cl\301"
+	.ascii	"\252)\250H'\235\266g\0221Bx\201\332\006Q0*1\\U\260LmZ\302x|\002"
+	.ascii	"\201ej5\022\251\266A\024\204lj<>\201 dQ\244\332\006\331\023\305"
+	.ascii	"\b'\260L+\212/\206=\032\b\252,\013`\360\330B\340\243\016\215"
+	.ascii	"*\202\3076m\233\234R0\221\300`\033D\201\\\237L\f\327c\020\022"
+	.ascii	"x\302p=\002\255\300\004t\021|!\264\002\023\220h\005&&ak,\266"
+	.ascii	"g\0221\\\217H!\\$Pi\270\036\321\023\356\b\027\305\035\256G\263"
+	.ascii	"-\256\306\023\216N\303\342\n\201\f?.\202\022pJa\270\036\205\212"
+	.ascii	"\253\212\326\304p=\022\251-T\342P+T\225\224\214ZV=>\251\300\226"
+	.ascii	"\270\266\300\242q\205\22552!\251C\243\212\027\355\332\"\310\212"
+	.ascii	"\260\266\305\340\020\004\3055(\002kl\203\254\212\001\005\027"
+	.ascii	"\301\027EDU(4\241\266AVh\270D\264\032\217\255\212DR\233\326\326"
+	.ascii	"\347E"
+	.string	"\220\250\016\1770\030!\213\352\261\311xb\270\236\320\006Y\2640*\032\327v\305\220\r\272`\215!\fUU\351\310E\360\005p\310g\005& \007Hd\360\350\302H,z\301\252-\214B\225\005\n\t\035\265F!\365\370\242%Z\177\226\212A\244\f\3055\270T\204l\002\016\203*SP\003F#\021\310\252\3055\310\266@#+\fj(\256\301%\242\242\fH\026\301\013\034\260jK\\\225.\254\300\004,\256+05\261j;,\276\030bP\207F\025E'\254\340\320\256M+\t\031\212kP\004\024XuiieW\2700\022\211&N0\t\213NA\242\004@\025\351t\341)HTY\240\213\340\013\340Pm\203\354\222\332\026W\f+\254lP-\256$\264H'\226\2515:\213kp\311G\025\026\203-\206\301aP\353tl\235\214\300\013m\321\311(\004\022\211\252\020\230\241-\252+\262\030d[\244\026i4\262"
+	.string	"*)i6\310$\314jS\260\004\225\270*\031\331\343O\323\221\005\026\327&\240\241\252\036\221\300\266\2506\265H\247\f\f\203G\350p=\n\251\310\240\312\n\213\253J\034\256EG$P]\333 \253\244T\004T5\260\036\221@%%\241\326E\360\205\211\004\262\352\323\252\002H\023\211F63\t\333\365x\236)\202 uhT\3213T\221\254\332Be\201H\027\301\027FmQ\025\262\352\021\310\032[c\023\360\270\022\225\230\220AV\230\201h4."
+	.string	"x\236I\004\222hd\333\242Q\b\024\262#\204J\034P\220 ra$\n1-\255LCC\022\304 \333:\251\305\036\225\330\266F\226\251\005\016I\f\213A\026\303\240:4ra$\3760-\255L\300!\211vmZ\211@C\022\352\320\330\004\034\252L\302vu\201\034:\223\210'v\304\322\321\350\306\243\312\216h\215Fv\304\017\022\270\264*\025\215'\236X\237c\260I\310\236\254:\\[\030\331\343P}b\211\301\225U\221EO*\361\350\204B\211\030d\362Q\207+\313\252-\214\300\342\352\241\005\246K\301\025\306\025\270\344D<\"\025\265*Re\207\305\225\005\260\r\"\201MNl\253\001\365\210\334"
+	.ascii	"\244\022\203B\237\226U[\024W!;\\\233\316\342\332\2445 T\231\204"
+	.ascii	"O\301&=\204<A\f\266(\032\3276H4\036Y\265-\216 d3 U\225]RQ\250"
+	.ascii	"\304\245\242\211\246\340\211\026G\245\013C\242\221\t\251\262"
+	.ascii	"L+\3246\330bm\205&\324\241Q\005\273\006\221\212k\013\374 \251"
+	.ascii	"-\256NZ\250\"\235\200O\301&\340\023\373CT\213\305 \223\020\370"
+	.ascii	"\344\024\004>\005\233\206\220\254\221e\325#\264U\221JJ\306\037"
+	.ascii	"\365\370\242-\322\240\244dl\235\204\022 \327\247 p\311\211\205"
+	.ascii	":l\235\216\3055\203z|\321\002\325\026k\033l\261\262\352\220\003"
+	.ascii	"kl\205A%\240\261u\n\002\227\212+Sk46!\201B\026ih\\Y\365\bT:\022"
+	.ascii	"\201jS\220U\002\nY$pE\"Y\r\303\025\330\256E\247 \016\210O,r\250"
+	.ascii	"\005\226h\213\253S\372\244\244\023\036T(A\004-\024\301\252Ok"
+	.ascii	"\323\210\226ii%*\215(\256\301\246\021"
+	.string	"B\0269B\204\206\026\031T\002\016\235\202,\200H'\026H\241\377\032\315\251FS\341\223k\341\214\234<\243\r\255\357.\345\033\342\022\244F\0323'\230\237\2749a_v\350\025\026\264\2559]\247\351\306\024a\333\252#\303y\314\030=\367c\003)vy\310\314\311\241}be_rd*P\205\252M\334\231\326\323\204\214L\2148\314\226\251\\\261\260%L\230\207I\315~\261~\240}^\310\334\3344\230%?\\_\256\333\364\024\2626o8k/o\323B\344\355\016g\3756\304\246\005O\211\006`jj\232\215\253\003'vnrh6\335E\354\253G\217.\232\013\025*f\316\234]HcP~\3505\f\003\250\013/\016\036\316\327\240\211F\323h\347\226\023E\331\031\323\240K\377\372\354\204#c\357M\222-=\320<|fofmC\266\354\244\315\231Q\316\300\324\220\245c\322-~lZbbZ\313\305\202#"
+	.ascii	"\261\253;.\277\275u\003\313\265\026\255\3143\002G&\213\0309@"
+	.ascii	"\334p~\210:Z_1\357\362,\351[N\231\242\253(\361\361\273\302\022"
+	.ascii	"v]\005\216\212M\234;\2345\330\341\354\244eA\203\263\246\222\312"
+	.ascii	"\321\t\001\262\246\225q\3264A\242\243\244fi\177o\330\340,\204"
+	.ascii	"N\371\212\361\366$M\323{?\234\240q\222\373~\346\306\356\204I"
+	.ascii	"\332=1\343g\243\t\022eX\231\022&\351\2247U\346|-\271y:`\330Y"
+	.ascii	"\303Y\371\343\366#\355\206\222 )\327\232\327\226$\251\025\274"
+	.ascii	".\"V8\353\"\332\3105;\234>B\327\202\032<\234\037\342L?\355\275"
+	.ascii	"\367=\034\232"
+	.string	"\036\016\3755\221\031\312<az8\353 :\210\026r7\026\234'\332\353Z\310\220\0337#l\262\\2\316\027\024\316\017\001\246\177\335E\225c\016\315\027\234\225b5j(\351\372\001$\r\207\265\250\263\021\205b\036i1\212I\205\214BE\"2\323\244\003\223\025@0h@ \022\013\246U\366\023"
+	.string	"\203L\314\324\241\032\007\235B2#\"\n\222\244\244\222=\0160h\361Yo:\302u\324DB\b\030Q\300\005\205"
+	.string	"\301\257G{\t\250\017\266\347%\274B\323\242[f\270\355/f\275\357F\312\bPqt\241\306\346@\254\270\2313\320\220:\365x\2707\035\2027\221\266\254\336}`}(p\273\344k\345@@\253\227f\260*6P_E\371\352F\372g\320\360\325\205\323K\316Q\234\370\263P\320\027H[>\335*K|\023\216`\335\377!\001\310\323\234<\b\314\340S\310N\034\312 \235\333\334g\246&|\005\021g\222W\277n\253\030[\3118\344\324\337\262\216\334\373c\024zH\315+\270\027\026\035\007\322D\245L\312\203\370\2035>\246?\356f\353/\302\247\255\266\2163\250\360\215\341,\357\33296G9\217E\360\262\262\005*\\\025\355\312\246]\320\003\267\342\356\365@\3510\354cl\305p\214\214C\240So)\240\354\344f@\024\331xW:\373\213\273\255\n\323\214\020\"\207;g\214\376\274\270"
+	.string	"/'\265$\033S\307@h\243\342X\302>\037Mn\232\251\274,qbN"
+	.string	"\212$\301pj\035*\2050@\362yJ\304\355$\037\323hae\305(-_\333x\002\3037\006\211[i\0208<`\346;\221\211\3235\333\020\002\354\275\227$a\242\356A\267\220s\212\f"
+	.ascii	"\021y\004b\355^_\024\023d\2460+\364(\0352u\324\375\343\353\256"
+	.ascii	"\267\033\311\247\204X\006T\361\340\347\312\004?\230C\266H\013"
+	.ascii	"\315\267\220\341\017{d\362\026\354\207rE_\343p\210tr\206K\335"
+	.ascii	"\274)\373\033V\224\300\360.tuP\206\\\025&)\"S\033\210\361\232"
+	.ascii	" \326g\300\202CNI\017\321\213\336{i\351\304\267\020\275\007\252"
+	.ascii	"y\333\2079\231\335\225\343\206z\004(\337~=\024E\230I\037N\202"
+	.ascii	"8\276\376\271\336\213\267\364\001\375\002 \221\"Y7e\3677\224"
+	.ascii	"=\346Q\260\364K\315\336\346p\331\254@\370\325\354t\032\345\312"
+	.ascii	"\321\250i\224CF#z\252\025\024\023\304\033m\312\275\312\300\261"
+	.ascii	"+\375 \342\3407\342\352\206\005\241\274\340@\313*\030\247y\236"
+	.ascii	"g?\245\337\201\016t\340`\035\206B\t`\306a:\005c\371$\244\002"
+	.ascii	"+\2314H1S4\334\023Sn\n\373\224\202RD^J\366\3052\306\b\020Nn\317"
+	.ascii	"\200\2047\341{\341\3237OT\3256\237B\344k\246\\\260\332\312d\243"
+	.ascii	"F\212\321+r\262\rS\037r\224\003\255t\317|\217\034U\304\002\355"
+	.ascii	"\325\344\013 8>=\034\261]\257\224\216\277\016\272\335\252aC\233"
+	.ascii	"\007[\325\2551\272\323h<>\333\244=7\205\002\344\306,e\212\220"
+	.ascii	">\355n\272\335\343&\004\361\216\377\233\276\t\033\323\344\244"
+	.ascii	"\256\032\254p\037\270\270Z\200\310\245\352\323K:~\262\350#\n"
+	.ascii	"\303\322\320\331\t\356r \305x \312\377\255\355\004\304\f$\334"
+	.ascii	"\341\340\306\312\237\310\257\004/\202\027g7\031\357\303S\346"
+	.ascii	"\270\274\250\334\3760\006\256}\340\006\230\372\337{Z\205\254"
+	.ascii	"`\034\3068\235\3134\237\274eXHW\250S%h\234D\233:\335Z h\260\211"
+	.ascii	")VvH\2466z<\347!U\206P\007\355\034\244L\275s\360\245\031\200"
+	.ascii	"\250\272\234\303\231\002\024\332\240\205v5;(\325\222\351h1\266"
+	.ascii	"\211\314\223eI#J]D<\227\332\365\216\271\223\355\340\264,\016"
+	.string	"\357\216\320\327\331\341\337W\341\336\327\f\250x~\310\301\341L\375c\353\304\346^\367\215$\201\017\275\334\233(\266m\013\324D\261\2344&\357\n\277\\\304\222,\"*8\234\017\322\034xv\370%\211:\215\027\231C\241\r\332\001\021\346\202\3575\212\\\023S\273\247\031+\345\023N\030\016\023\365\340<!\t\tO\250\017\"\253\221\2022\224b\3538\035\364nH+4~:\243\203\265s\030-\247\372\245\370\004\213@\342\324\263'8\017\250& \206\246\305\202\321\330^ \033\027\303\360b\007\004\211\235\030\211P\024\223q\016\324\204XIk\243\365\210\305\341\253.\274\240\310\017\n\375\006\351\275\007\226E\307\324\300j\332\270\246\363\362\020*?\326\300U\267=$*\235L\355\212:\336\226'S@\220\212\333\237\315\321?\357\314f\254\323\201\377\333Q\353\025\237\204\306l\340D\316\347\240\305\307\324\025\213\334\020\n\345\177\263\033+w"
+	.string	"\314m{\331/\272\350\330\236\216B'\243\314\342\260\3615\247\004_4\360\202\377\362u\303\242\321\253\016\273>\324\356WbH\200N%\321\177\357e\204\256]H\032\241;\377K\224?U\334\325\255\361\312;0\343\205\330\366\275\351\202i\246\237"
+	.ascii	"\035v\376?\003\001 \252\313\253?.\210\306y\004\245\260\327\231"
+	.ascii	"\373\275N\201\225pp\363\262\307%\266\341{AM/N\232\212\204\345"
+	.ascii	"\360[!~\314\326\035\360v\337$\002\253\336W\350\2171\236\200\242"
+	.ascii	"?\364\225\t\255.);\360\206@\373\233\004\303\240\364,\254\340"
+	.ascii	"\203\275;\245E!\371e\t\374\345\211\377b\376\347\035\0047\353"
+	.ascii	".\301\337>dL\317\363-4\346\330\223\023+\330\311\217\360]V\304"
+	.ascii	"Bhz\335\220\020\274\356\024C\315\200\t\364\376\361\371\202\356"
+	.ascii	"\350\213\367\344\363R\271\216\371\203\235\257@@\366\352\217\307"
+	.ascii	"|\027\364\335\006\376\231\271\004\210x\256q6g\356\2014+c\230"
+	.ascii	"\177F\017x\237\\\001\201\314\211\027h\337\361,\033\353\027\253"
+	.ascii	"\210\275\356\246\177k\336\340\007\017u\352h\2608\b/I\037\361"
+	.ascii	"\342=\347\206mE\206\200\357b\367\274\017\212e\310.8 Z\r]\013"
+	.ascii	"x\327\366p\253\217\307\327\333\325\022b\376d\353#j\335\307\221"
+	.ascii	"\nb\333^/\244\314\344X\2123\320\335$|\3163R{\272\317y2\367v\254"
+	.ascii	"f\363w\326VZ\303Ek2\220!\352\367\265\002\323\354"
+	.string	"u\241F\342~\371HH\216\261J<\220\340\373X\240\301\033|\343\003\177n\004\001\3148sz\320\305\004:\353\036\260v\r'\252%\221Rs B[+\224\270b\003\220\301\264]x\314y\253\215\302N\336\255\221E\bZ\026\206P\353\343\366\216f,\033\030|\2155\233\247\200\276\355\326k\250\177(\307jL\213\225\t\275\347\201\3457\206\311\337\021\232k\034\327\340\325M$\356\035\261v%\210\236O\210\3039\215\024\206+4\260l_\340q\3273\206\003\356\253\031\2215\365y\3301\362J\020\314[\035\372\237\332\240\315e\27370\323(\250e \005S9\260PHUZ\\<\223\306\036\004\212Oy0`\036V\352\227~(\322\302\214T5\306\002J<\307W9\217\256\231C[e|\221\024\031\177H9\217\376d\223V\017\242+\313\363\241\335\361f\210a\311W6\346\250\306\202\350\316\023\303\242\261\270\322\377&\210~"
+	.ascii	"\261\371\330zc\202\"\002@g\261\333C\016\021\243\3762/#\202\032"
+	.ascii	"\370\360\311\022Z\207\267\007\354\341\206~\0022 i\227\3448\001"
+	.ascii	"\nh\302\302\267\214\366\271\247EG\224\022P\020\360(r\361\305"
+	.ascii	"!\215g\251\013\304\330?q6\237\231\013>\243\327\226\346\316\222"
+	.ascii	"\315\251}32\027\350\355\n\202\276\222\200\216\r\250b=8\363"
+	.ascii	"\227\200\337\347\026\326\373\3549\311\377Q\315\362t^\243\214"
+	.ascii	"W$e\265\225e\214\354\342\004\232\253\3132\n\343SZ\245\006\340"
+	.ascii	"\213\245\032\267\227yKL2\2166\343\254\353\371{\001\320\017n\230"
+	.ascii	"\201\217\343\243\307F\b[/\026\350\245\301f(\205!\373c\2156\033"
+	.ascii	"J\r\314\237\203^g3\214\353\355\005r\036\207\365|pY\234\024\006"
+	.ascii	"\317\232\346\311o6n\016\211\334(\\\356|\373\263\340\367\350\266"
+	.ascii	"m-\377\003o\367\202\343|\254O\203\350\241D)<\360\330?\206\n\232"
+	.ascii	"\\\274\223c\350\360\355\225\262&\tu#\353\345#G?>\351\262\265"
+	.ascii	"\036d\276\275\314.\227\365\340\037N\244\225\351\375\301\243\214"
+	.ascii	".\202\302g\336\263\327\240lH\272\220\2433n\025\321\353r'.\271"
+	.ascii	"e\0037\270>$\222v\030rW\246%\226B\272\"\332HX\311\233/\347\245"
+	.ascii	"\320\330\211)\252W\255T\305\302\2718\330CW\256\314y1\313\370"
+	.ascii	"4\251\207\0046\250I\351\232\310x\212\210\270VB;\216\270\231\220"
+	.ascii	"\275<\0265\263d\260\007\316\"\310\255\227\343\0023!\3233\264"
+	.ascii	"\0049=\253|\207;\035\221G*\371\253Z\300:\253o2{\375C\317\323"
+	.ascii	"\244<s\336\206\004\324\036\212\247\002S]\317\255\377dr\361\304"
+	.ascii	"\221\362{\276\361\004\310\361\311\364\325\300\263^7c\354\016"
+	.ascii	"\262c\364"
+	.string	"\002\210\276U\222\f\327\275\230%\013\334{\216\320W2\\\324\373\314o\327\265]\305\310\263\242\255\\\234\213gi\211N\203\3727\222\004\230\240\363S.\271 \356Y5-\275\022\260FK\226\317\254\266\250\216G3$i\244\030\324\231\025\003\210\005\333\0249\005\265\022P4\213\341\032\214\316\007\355\321K\020:\236Izd\301\317?\225\375E9\257\3241\216\276lSu\207\024*\026\311\001\316e\234(\352\312)\323\314\t\223V\351P\030\004q+q\032(\244\t4r}\\\313[\340\351h\270d\f\221i\271P/A\3250m\t\332\272{3!\030O\334\320q=\n\303\314G\336\336b\352\261\006\230P\005\317v_0\225\245\305J\375\335R\222\251d\306wl\265\236{\300N\216D\220\031&i\320\356Z@\232\233\356\240\026\007U2\203{\021\037%\001\352\001\212\001\017\226\202\030\236\037\375\310!\343\234{\220S\332\332h"
+	.string	"\321-fJBWdRr\353\005\356\231\215f\231\366\227\277\361\262~\023&\220G]*\245\002 l\200\2020L\352\273x\316E\243\326\020\233\205i\3072\t\341\255\f\255b5l\0052\220\016\017\355\216]G\365\372\237-\244J\212\341G\315\036\241)\256\312\3720Ho\"[\242\243\217\354\004\215\207a^\032\235\374$\231\352\350\324\211\272\001n{\017\317\277Y\216\340\326\333\362\227|\250\265(\001\256\374\371[YJe\257\223\004H\216\313\3754\317\277e\376\324B\036\341"
+	.ascii	"\207T\372\027\351]\252\353\246\2356\005\213\351\302Ud\260:\200"
+	.ascii	"\332%\013d\213/\025\214\233\216\215\375\352"
+	.string	"\005 Q\2428\356\236.-\361\005\263\377\006\271\217\341>\217\360]Nr\177\373\213\376=5d\246*\306m\b\324\001]\277\244\001\036\276\341\202\325\251RBN\361WnK\334*\316\377\266R%\362H\252\246\177u\335l\337\322\226:Ut\025\323+\367a\342\\M\n\200\331E\\\020\376\300x\254\310\001\324\326\203\214\016\271\305\030\376/H}MkQ\322\235\037\255)\226\001\330Z\243\036\347\274;\343\006R\3270\361\272\r\210\216]\003\241H\013\3565 \224\277\2361\004\220bGN\240I\357\321\372|\004\315\232b|p\344\3734\003\325K8\34689\340\302t\2015\032L\374\263\340\372*\031\214\316ih\351\312\006\3346h\240\276\371\304\202\236d2$\233\0032\207\305\344n\025L\t}\351\311\023c\332\203\t48?\270\350\376\244\313R\377\204Vj}\034\321A\277\331\373\321S#\366\304\275\026\352T&\001\264\212"
+	.string	"O3\312>2\312\233\201i2\b\361z\332>\031\213\322\366\237\345]\315n\005\333\3530\225\266\227\350\352\345\335\212\345\320\310\006\372\320\233\317!\3219\r\027`\005\274\270\276\223\227\307\261\032\227\\F\276\243\342\362\224\375\030H\225\001\214\030E9\016\361\335x\242f\032\257\212\220\215\213\217\333B\036\002\272\341\245\370!oX\231\024 \3226\232\215B\262\004\321\213\022\245\210\220/\253\206\340t\246\214\376\\\220\336\302\223\316"
+	.string	"\207\225\026\226\372\241\211\2460\312\3256\321/2\323'\250\324\023\371\354\034\224\360])\372\203\276\033\035DY\376\006z\325r\2479\n\313+\245\323\366\352`\214\365d\362\\\211h#\031~\266!k\217f\345U\"\340A\t\300\244\374J8\241\367\275s\340\347\250$\333\337\214\021"
+	.string	"_\342\243\214\307\271g\232\366w\345\022\001I\\\0273\fEa\303\210\007\275\305\020\253\257\023\004\320I\026\363k\241#\362\242\217g>>\026\337_\317\310\320\345\310\326gv\032c\334\32552\3171\n\310\\N\274\236<<\301E\302J\307\301\367\271R]\225\236Ae\305\354\276<\373\227\323CD"
+	.string	"\215x6\013\201\036\013\247dK\366"
+	.string	"\r\276\275vf\177\024u\321-\334\326\225\206\275H\311\326A?\237Q\245"
+	.ascii	"22\365^\215eX\230\241\370\002\335\t\205\363.\337\200\255\252"
+	.ascii	"\223f1f\357\351Q\365V\031\256\211\211u\003XO\003\003\260\377"
+	.ascii	"`\231b\232\003R\215x\272\273\255+yBk\356\341\371n\355\240\325"
+	.ascii	"\340\f\004\360\220\2363\314\366\257\246\240b\016I\335\016\020"
+	.ascii	"\372\177\f`\234\237\207\202\245F\246\304MX\302\213\375k\355\373"
+	.ascii	"<\273\017\321\330\346}[\004\347\035?\037\236\356\354\252e\215"
+	.ascii	"h\235*Jt\310\337\004E\207\002\301\201\315^\306\355M0cu\033x\210"
+	.ascii	"5\274V\377\037\321\243\321~5@5\017\310\327\217\232\001\235y "
+	.ascii	"\304\363\020\343\3471a\374\f\310]\324\327\023z\373\320,S\377"
+	.ascii	"\375\326\364^\274\"\206\336v\235\255\345\273[\037\241\321\"\034"
+	.ascii	"\021\263\355\r\263\342\351\262\266\256Ju\003\372\254\342\036"
+	.ascii	"\200\031\353Xye\fw\243dK\364Jh:M\350\2330\275\321}Zt\347\020"
+	.ascii	"O\001\344oE*\377\374\021\267\267\372y\241c\247\252\031\304\327"
+	.ascii	"\343.X`?(YG\230x\334\265\017{k\007\277\346#\234\302\360\372C"
+	.ascii	"\363.},y\217\377\303\350\317\203\030;z\35054|\006\252p\030\221"
+	.ascii	"[D\367\204)\227@\204#`\016\241B\251\221nZ\007\351\017>.\240\254"
+	.ascii	"\266%w\177(\246\255\375\004r?\027\235i\340\263?\270\027WW:Z\260"
+	.ascii	"\321%\271\357w\366\336L\354mz\335\013\366\234\003\376\264x:\374"
+	.ascii	"\262\363\276\334\301xw>\264\216[>\353\316\247N\234\n\256\013"
+	.ascii	"+;\261\264\030\373}]\351xY\371\017\337\330\t\234\017N\367\233"
+	.ascii	"\321y\200\253\243uG}hrJ\r\203*Ol\276A\261\325\251\307r\360\032"
+	.ascii	"\260\001_\357%\264n\275Z\277\204\220;\306\217\r{8\013\271zK\036"
+	.ascii	">\334\005\263\302\2663\007\t\017\367\371\304d\027\017\255#0\312"
+	.ascii	"i\327\362\034\363b\310\343\374\304I\234?.9\3037\247(\270\351"
+	.ascii	"fVS\360\277\272>{{\275\343\221\333\245O\247rv\321\342L\376\026"
+	.ascii	"\206s\026\346\325\022\376\342\270\310E=\332E\217\376\321\276"
+	.ascii	"h\264G\317h{\361/\342\213W\213'GfO\372\200\237\343}\3029\306"
+	.ascii	"\347\240\2634\001\311\354\n"
+	.text
+	.section	.gnu.lto_.symtab.61ea6ec88627b956,"e",@progbits
+	.string	"motorOutputLow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"loadLaunchControlMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\003"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"mixerSetThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"mixerGetLoggingThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"customMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"isMotorsReversed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\003"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"mixerTricopterMotorCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"motorInitEndpoints"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"mixerTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"motorWriteAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\004"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.61ea6ec88627b956,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3796 @@
+	.file	"pid.c"
+	.section	.gnu.lto_.profile.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\216\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`:\013\345&"
+	.string	"\324'.\f"
+	.string	"\236\001"
+	.string	"\360\300\300\245\006\n\002"
+	.string	"\001\307\303\237\256\016\034\002\001\002\001\003\002"
+	.string	"\002\004\005\005\002\004\240\342\234\212\n\003\005\007\b\t\252\275\320\333\017"
+	.string	"\n\206\316\224\357\n\013\302\214\204\352\003(\002\006\002\006\002\007\002\007\002\b\002\b\002\t\002\n"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002\005\002\013\002\f\016\017\020\021\022\024\255\233\317\336\f2\r\002\r\002\t\002\t\003\003\t\001\002\001\025\352\263\360\321\b\026\027\030\031\032\033\034\035\263\272\250\370\006\020\036\037 !\"\361\354\215\323\t\016\002\002\002#$\235\326\347\231\n\b%&'\305\306\342\336\002.\004\013\002\f()*+,\332\230\334\315\006 \013\002\f-./01\374\315\322\335\001 3456\230\262\331G`\006\002\016\017\002\01779:<>@ABCDEFGHIJKLMN\242\244\203\306\007\b\r\002\rOPQRS\231\311\230\203\r\002\rT\304\310\377\261\004UV\343\250\231\362\004WXY\202\250\203\002"
+	.string	"Z[\251\266\340\304\002\013\002\f\\]\251\201\371\202\016\020\020^_\335\210\325\316\r\006\001\002\001`a\211\246\225\243\017\n\r\002\rbcde\303\325\364\217\n"
+	.string	"f\256\330\276\211\rg\315\343\301\244\013h\335\254\233\267\bij\356\363\250\233\tkl\354\206\342\366\006mn\261\310\327\230\n\b\017\002\017o\310\351\257\227\n\004\002\002\002p\327\255\213\231\013\002q\363\317\227\227\016\005r\242\262\337\300\t\002st\275\331\240\220\005\372\001\021\006\002"
+	.string	""
+	.string	""
+	.string	"\004\016\002\002\002\016\004\022\002\022uvwxyz{|}~\177\200\001\201\202\203\204\001\335\241\203\271\f\020\002\r\002\003\002\002\002\023\002\017\205\206\001\344\313\223\351\t\004\207\001\352\265\237\212\001\210\001\250\350\313\243\013\211\001\300\255\310\301\f"
+	.string	"\212\001\333\314\346\311\005"
+	.string	"\213\001\353\377\305\205\005\b\001\002\001\214\001\335\260\251G\215\001\207\312\266\244\016\020\216\001\260\302\311\240\017\220\002\002\024\002\024\002\002\002\025\003\004\005\005\021\022\002\022\002\021\005\220\001\221\222\223\224\226\227\230\231\232\001\350\300\306\254\005\233\001\332\253\224\346\234\001\202\271\345\236\005\006\235\236\001\237\001\271\213\357\254\003\240\001\377\341\234\356\004\241\001\242\243\001\336\215\314\344\r\244\001\241\244\203\332\003\245\246\001\266\264\346\335\017\247\001\271\357\324\266\005\250\251\001\277\332\376\350\b"
+	.ascii	"\201o\250\221Q\031\221!I\222\202d\031\003A\005\314)\306\230\231"
+	.ascii	"\007\022@\223R\214u\022YP\220\354\177\214\001h\372\252\257#{"
+	.ascii	"\n\351gP\300\321\302\227FW\217\361\020X\260s\262\251{:\237i\177"
+	.ascii	"\022\362\031\225\232\346\006\271\377\344U`7z\245\177\204\306"
+	.ascii	"\204\037\342>l\316\027\026\241x\361<F\211\355\002\376R\344\257"
+	.ascii	"\031\221T\377nwy*\375Q\373\323\034\260\263\003\007\264\270\207"
+	.ascii	"\370\227\007\370\301h\360\235\367\244\022\2362\035C\376T\033"
+	.ascii	"M@\357\232\211::\031\315\240\274d\363\233)@\021\307N\203\004"
+	.ascii	"\301\367\222'\274\274\346D\274\363~\256\375\266\310/-\277\035"
+	.ascii	"\276\326-*\271\360\331\376!\262g0>\260\314\034\352\030\254\034"
+	.ascii	"\036/\326\001\234^\336\036\275[T\2718m\220\027\201\n>\307\321"
+	.ascii	"\006\374\224\271)\200\0328t\370\375\224\341A\032\305o\321C\332"
+	.ascii	"?K\374a\231\320[\3171\357\200=\206\316\037\211yo\301\036\"\364"
+	.ascii	"e\265\357g\036\355\212v7?\262K\305\013Nru\005\250\317KZ\306["
+	.string	"x1\342\310\367\324\366\344\332\n\202\003\365\201\024\032\313k\355\033E\030\235\n\022\036\255\034\f\354T\335\314\322\241}13#N7&\006D\217PON\013\016\233ny`\232\344\223\361\031\0029sC\324R\232\236e\020\236\201\350TtD\002M\3367\263J\312!\020\b\233Y\250\341\003\311\243F\253\344\310R\322\003C\310\354o\025\317\270\r\237@e\\\243\225]\241\341\321g\364b\340#\276\200\247j\315\0318\234\217\315\345\303\3347y\360]\221\323\033\375\303\353\372\320u\273\235\373\271<\254\307\265\236\034\340P\363\301\034\216\037\376\337\355-\215O\336B\\\035\2671\302\341\342\033\274\365T'\346]\306\320\237\313\020\253u$3\325D\274\007\302\023\214\027\007\341{\204\310(\221 `\024\215NCv\357\r\365\350\212-\302\027\351\r\255\243\261\220p\334[\210\335\"0\356\317O\232\203\360\235\245o\273\201\034E\322\341\021_"
+	.ascii	"\321S\371\034>\276<u\373\336\177Q\260\323\350!z\004\355\310\356"
+	.ascii	"\t1`7G\373\037m\270#\251n\026H\210\275{\370\022G\210\370\331"
+	.ascii	"\025\016\007\356\371\340Z\"\313+\201\326!\034A\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\016\003\215\013"
+	.string	"\202\217(#"
+	.string	"Y\222\016\027\312\377Z\321/"
+	.ascii	"\225\t\253\366\315\037\241\365UUIC]W!\354\367\331\325l#[\246"
+	.ascii	"\024\226\347\224\343\324\315"
+	.string	"\332\324\224\323\314\310\224\307\250\037\rA0\345/\273\350\252\245\224\345W\246R\246\354(\237\350\020\227L\262#\"W\210G\323\347A\312\217\322\343\216\222c7<\006|\256#\005\\c\317\300\370\013u\026\257b5\305\204\304\356\210u^\352\314`\373A\275A\227\376M\326t\262nO\272\202\r-$\005\241Z\202\211a#\330\ta\316\362@U\243\001\377J\026\300\365\352\036\337\351`Zq\250\240\016\225&I\245\003\200\202\241\262\352\006\02101D\320M\321\260\377\031\263\207\342\005\362\023\302\004I\216\251\1773\242\230\237\235V\370\344l\217\001}\253\261J\243\2244\036~\231\013\332\326F\207\016#\r\260\306\2572c\032\334f\345\373\256Z\360v\256\033\022\n\344\264\031IfC\302\260yU\236v\230\020\210v\231Q\225\325\315\335Rs\266\345<\305`t&l_\366\216\307\371\353\007\315\034\t\021\024\303!\3710\235_\334T"
+	.ascii	"%\362\376\020\266\324!\224\253\276>\215\365\375\334<mF+E\217"
+	.ascii	"c\2262\356\351\346\240\215\303hY.\006\003\300\"\264,\242\033"
+	.ascii	"\300\016\207\332\030B\177\234\305]X\330QDF\305\334\212\314Y\306"
+	.ascii	"\272\221\bR>"
+	.text
+	.section	.gnu.lto_.inline.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`Y\024\265D"
+	.ascii	"\372YX\022Bp\250M:\265\324c\320@\026\202\177q\266\023U\022ZC"
+	.ascii	"\027\273p\0233x3\300i\b\322\230\320\274/\264\244af\270\232\334"
+	.ascii	"]\303v\323\f\307\004S*%\021\372\300\007\332\240p\374\370=\244"
+	.ascii	"\355-e\n\007\001!\001\027\001\377%l\002\306\372\244s\266\266"
+	.ascii	"\006\341\016\352\177LO\357\233\263\307;\353O\305W\204f:(\340"
+	.ascii	"\330\317\374\001\336\345\317*FS\303\347\212\203C\355\227j\226"
+	.ascii	"\211\003"
+	.string	"\210\207\211\252Y\005\312\225\256\fw\2529\376\231\226gZ\236i\024o\321\351\263==\355q\261\230\246O\356\225|\215\232\210\304\274\r\351\271\236k\024+\242\362\366d\276\276\366&\327\226\320\211\201\223\357M\033L\314p\324\177\212}\254Q\343\307D\322?\307\377L\274[\226\211\263\370\347\365021\026S02hw^|\001\336p\311\373\330\315\214\032\027\201\327\367\2024\210\364OMDu\0045Y2\372?\001#\340Ek\200\200\255x~R\261\032\265\036b\377\363\334\277?o8\377]\242T<\354\356$\376\267j\246u\007\225\016`\377\375\236\377+\315\252y\226\005\rG\210\036Y\026\301\271\240[>\377\270\273{\374Wp\215\356\216\300\377\\\301^\335\255\3731\334\300\207\234u\372\331bn\235\ts\262v\236\341'\237\264\345\313\023\374\025\304J\220\236\367,1\233BSp\027\020\2616V\333\022N\251\337\251\021\331"
+	.ascii	"Y\212#%qB \321&^0\333\304YX\304mb\254w\030\2338\353Hb\366\210"
+	.ascii	"y\275\314-\004\300\375?o\247`\032jD\320\354\267\277\355\233@"
+	.ascii	"\330\030\312\203\340\273\357\244\230\311\232\356\203;\357\316"
+	.ascii	"\273\024s\255\021X\333\236<\331c!f\272\016\341\316\344\231\214"
+	.ascii	"\232\30469\305}\355\373\230M\2253m5Q\02679\365\264\357\233^\300"
+	.ascii	"\276\350\250\347>\267\232!1h9#n\n5\232\260\364_\001\357\322\177"
+	.ascii	"\271,\023c\335\205\227U\300V\253\200\257\366"
+	.string	"\337.\313\304WV\007p\310K\017\243\027/\2017\\\242Tj*\361\3222\253'\377c\256\2570:\310\327K\261\026#\207\3006Q\240Fb\271+_F\206l\327$#\026\302s>\207\200;\375I\244\024\023\fP\216!?>\222\326\225h\301\217\251\220\025\313\306\223\007\326\340\370\377\370\213\320\235=\343\230\025s\311\360\331|\036\253\177<\203\265e\026\212\236\315\257\210\021\212\261\376$$vs\327cL\361\217\037]\260\324w\007\240\232\307\232U\213\216Y\276\321\035L:\214\332\233oooo\364\244\026\345\r\343\002\316b\016\343\023gM\361Yw0\367\027\034$\0134F\211_\346\306V\314\375\312\312\005\203\0052\356,~s\0042\261\352\377oN\001\203l\212`\314$\360\177\270\031B\004\302\245\376\373\270)\357g|\031K\316:\177\201Q\347\r}\363kK8\205&)sk{\232k\370T\001Sp\0245\322\272"
+	.string	"=y\342\265\302\226'\213\323O\3742~^\260S\323Nw#\275\004p6_\351$"
+	.string	"|\204\235n\037\272\246\2138o8\177C\352\305l\335>\230\236x\016\235\316;O(\\>\013\317\023\376\274\305\264\265\002\306%=\354\233nl\305AJ/\357c)\3354\306sy\226\232\304\356\346\223'\201s\254[\213\200\241\341\240\"K\247\276B9\257\343\3350\353Ta~A\214N\001G2\217\374\237cF\266\b\221\377I\323I\0219?\352Wl\344\033en\204\3527l\301\b\214\024\351\337\001u\277\337"
+	.ascii	"\270\335\235m\326\270\254\325\337\005\207y\241\021\304\261Y\361"
+	.ascii	"\2158\214\036\315E\272\335\261:\324pE\211S\277^Q\023\316\227"
+	.ascii	"5B|\346\r E\005\266G\330\331\035\003\337\034t\265,\002\266\302"
+	.ascii	"\241t w\345\306\315\021TG\320\322\267k\376\352<\205,\020\231"
+	.ascii	"\334\367\306\337c\346\261\356V\002N\342r\255\215\2642\267\266"
+	.ascii	"&~\232\"r\200\030\370\326\370wIZ[\005\273q\342\246\nk-I-\367"
+	.ascii	"\216w\277\372\332s\267+Kr\226\333\335/k\324o\357ve\331\375^:"
+	.ascii	"\223\375\332\335\314}\356\371\346n\3274\370\265\354W\240\026"
+	.ascii	"}\331\3771\221\313\016>\370[p\030\261\203\\F\303i\032eK\233v"
+	.ascii	"\346u\264\214\216\321\341\274\216\366\274n\216\315\353X\312$"
+	.ascii	"\316\353\330x\221\235\265MC\263P|\265,e~\235F\250\261g\007\201"
+	.ascii	"\336\25019C\206\206FDR\222$i\r\341\004\304\031\303\034\204\320"
+	.ascii	"\007\022@\0045\311\302\024rffDDD\202H\n\312H\222\346Q\016Y\224"
+	.ascii	"\227G\263\221U&\305C/tu\263\02698YL\273\n\312)\263\313'YW\\\021"
+	.ascii	"\314s\216@\226t\255>|2X\b]\347\361\021\272\226(Le/\373V`\344"
+	.ascii	"\222l\237B\254u\232\356/;\353\211\306\325\221Xb\351\256\235~"
+	.ascii	"\222j\017\016\245\364\232A\3053\333LO\252 \362\354\2211\377\216"
+	.ascii	"\271t`\223d\240\210\2229\020\327\350g\204s\317\370R\301\371\027"
+	.ascii	"\225T\350\005\346\221\334\016\260F\216%\331\367\016\202\325\370"
+	.ascii	"Y\207dn5\342\036\222G\341>\215\206E\214\222\002o\311!$s\227\013"
+	.ascii	"x\346\006\256\257\025\b\024\331q\206k\227\031\213\021~Iq\034"
+	.ascii	"\343J\273\377\257l\0273\317\244`_\334\352z\240\213\001}\266\212"
+	.ascii	"\211\251P\323\016Y\304\366.\337I\326<\344\255\213\275\323"
+	.string	"\366\206\224\255\373\t\322\272k~, o\036y\256\353pt\201\322J'\311r\237n\370\2527\304\227\252RB\257\250\353md\217\\N\034\\\342\307)\357&x0\345Y\202/\261\274\224u\271\311\005\243\026\217d\231\312WJ\311(\375/\367\237\2555\266.\230\3266\263[`a\371\252hUh\312\302C\331\262C\\\1771\324\261\365c2h\354\025^\361\005\305F9\354ASK,h\033\340N'\354\001\354\253M\310D\364\214\002\002\\\266\320x h\274h\273'\315\005\272\320\2034+\027Qk\214h\350l\222\241\033C \004sF\377\241;\003\334\340\374\307\270\242\346R\275\3773u\354\375ioN\321>\017\373\323\222\214\034\317\313wdqMh\365lQV^\036/m\336t\301c\226\322\317\257\016\327\271\257L\263 C\177\f1u\335\2046\314\002^d\253\360\352\n\006k\031\332\251\005\004Vw\234:\325"
+	.ascii	"&Pl\013\312xGH\233F\r\260\214\022G\272\360\023\223\361\033\327"
+	.ascii	"_,pe\346P\320\375&\213p\304!\300\254Y\260\307~\022\33733A,\231"
+	.ascii	"\024gw\232\342d\f\004\365\"0\222g\267$H\327\264\311;\227b\230"
+	.ascii	"8\341\3245\031J\331\315\240\027\302'\222T\356\2012\243\334>\375"
+	.ascii	"'\f\026\311\243\361\223B\311\371\033\034\r\"B\256\222,G\360\177"
+	.ascii	"\314\314\265\320c\375g\036)\3556wd\032\315\016\016\304\207j\323"
+	.ascii	"o\337\r\275}e\2029\177g\332\210\315<k>\320@\270n\243@>\304\363"
+	.ascii	"\206\350\232\177\214r\362_\027\274\375\022C\356\347POa7\030\231"
+	.ascii	"\276\316\3071\3711\324\376\362\357\346H\230\"\217\247B\256P<"
+	.ascii	"n\325\035\241\306\2170O\270\324L(lP\233Vm*\303\025\230\236Fh"
+	.ascii	"F\365\256\207\216c\330\275\360v\276\346X\210\315*\317\202\005"
+	.ascii	"\300\21275k\223f\207\335\256 \202}\365\225\370\302\006\231\326"
+	.ascii	"\026g_E\323\317\306\322^\250\365\340\254\200\203\201Xf\020fb"
+	.ascii	"\223eop\324"
+	.string	"\264\270\034\230#O\355\260\214\255\275^\343\302\017d,5~&R\324"
+	.string	"}\310\203h\304{\256\017\272\240\024\034\352\003\016\341L?\025`\232\035\350\220W\253\274\243r\320\021\233\t\232x\224\377s\357\312\201\312F\211\301xI\"z\0028\b\271\336\310~\267\317\251e\021\372\211\371N(9\007\215m\266\004\354$$\367=b\344\217 \313\357\314\031\037\352\222\301\220\231\f1]m\233fs\332\322\n3\347\252F->\215v\024\030\267p\201\034Vv\243\207\200\323)+\022\2043,\226\232\265\230p>([\264n\3159\f\342M\372\034\344`"
+	.ascii	"\240\036\247\321L\310M\203\3117\260\245q\206Z\303\242\221\214"
+	.ascii	"c~\242\343\344\377o.\255&'\007\247\247\2075\305c\231"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\032\013\305\032"
+	.string	"\326\\[@\360\224\222t(3\260\234\201K;9\306\216\013T\305\255P\265\326\211\030y\240*\230\b\003M\317H\021.')\344\267/X\342;\320!\035\370\244 O\007?\304\355\005\254\375c\231\265\304\022\"\223\fC"
+	.string	"H"
+	.string	"S"
+	.string	"%\333OGkUz1\275\224\225\362\232\034\022P\252'*I\275\006\377\n@\235u&\222V\f\007\272\310k0\275\365"
+	.ascii	"L\274t\261{<\217\357oG\353\274)+qV\232d\344\354\261\207\362\345"
+	.ascii	"\002\236L\0014]]\354\357F+JUU\325\215\246r=\003\222\245\322\227"
+	.ascii	"\243\365\217U\245+\275\020\023\005l\035#\357\3301\021{\250\032"
+	.ascii	"DC\246\304\264}pHQ\016\016\016\212\037\003\243\027\336<VR\323"
+	.ascii	"\025+@>s;\315\200\177\334\263\330\341\315^\241\202:\005\271N"
+	.ascii	"\373\347p}\t\022\344\b\026"
+	.string	"\021\274\313\022\242\023\b\362\003\351\201@\007\222\003\265a\036k0\032\250\336\317\340r\301\2079\260\261\300\250\036\251\202\217\333\322k\241 \201\244\"@\230\300\030\313\003\004KD6]\243\232\256$\215M\001$\267A^\203\344Cc\006y\217\f\236\013\017y\f\227\353\021#E\326\211\016\231\310\301\3408x<\327\323w\006\235L%m\320Z\310\007y\272Z\246q\231\326\257\036\335\324<s_\"&\350M\375\005\271\213[\360g \323\035\200\343\250\221\311\"\"\322Be\331\rP\002!\204\314\212\033\022`\001Q\022\244a\220b\214)\204\202\022!\005)HAJ\205a\f\233\346ci\270s\020\177\020IW\033\345zt@\275%\204y\352W\340\262\317\0177!\221:\242\370\362f\305\b\013\323}\223\2659\275Y\320c\2675nT\3124\364\234z\203\027\362\365\215\335\270D\035D\347\246'\214\343i\351\r\022\337\250_\370>"
+	.string	"J\211\264\263%Vf\262O\3578i\207)c\244\313\004\306\227\250\342\346\266`\255bhJR\270\245KX\201\341\251N\364\220/\352\353\274\241T-\005{DW!sG>\272\033\314O7\340\302\316\261\177\330\212\225\001\272\321VW\004\333\352\200C\372\277\260V\270\272\357\215\273\025x/>\251\022*\200+\"U\252J\372\016\023H\235\243\274\017\3013OY(\036|2J>!\305\350\260\037]ku\357S\271\324\351\243VGr\214\317\203ZX4\203\313\207(\362\257\305JR\bon\314{\310\345\320R0\274\331Xk\346OA\313\032\"\021\233/\230\006\371'\362\331R\006\005\272\277\273\241\206\352\251\220\026\177\350)[\024\3359\023\311\370\214\200P\021W\203\""
+	.ascii	";\342\341\002k\201^D\247;\215$\364\255j\260\001\025\001i*\230"
+	.ascii	"\360\331\025]\212\201a\351\032t\351\234\210\037\320\357\357\023"
+	.ascii	"\241b\024\036I\214\352\335N9\2430\013\036\030\277\335\275@\345"
+	.ascii	"8\ti\310a\006\t* \b+\330\2378)%\340\341\b\272\231\240\377\262"
+	.ascii	"9\034\022\371\215)\366*t\360\314\323Pc\223S\212\220N9\240\236"
+	.ascii	"\316\300\016\364L\212\001\252w2},N\223pY/\024a\322~c^r8c\327"
+	.ascii	"\005\376\306'l|\001h%@\257\246k\177@4\203U\316\fC\275\234\036"
+	.text
+	.section	.gnu.lto_.pureconst.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \264M\004"
+	.string	"BK!&@gC:\303\363\342\342\342\312\210\372\311\305q\277\301\265\336Ot]\365S\344=\206;\250\373\343}\320\nX\004I\002\037\031>.|T\270L\270D\370xpipY\360\261\315H\360q\340R\3402\340\023\001.W\037U\037S\227\250\313\233\231n\351\222\356\350\212n\350\003}\237\353\371:\227s7Ws3\027s/\327\362U.\345N\256d\026\271\217\233\343\326\2301f\213\253\270%f\210{\270\274-\310Z\253!"
+	.text
+	.section	.gnu.lto_.ipa_modref.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\303\004m\023"
+	.string	"\206\232S>0q\222\341\200\016P\035'\025:@\003hq\301\231\241\017q\274:\205\033\351\273J\006\313\232\221\2651\245\322\267\017\325\326\276o\343\275E\233\345\035l\326\024=\344\323L\235b7\331\204\020)S;"
+	.string	"A"
+	.string	"F"
+	.string	"$\347tNO\271\2473\244<\244\323*\267\352\376\327Xn\242&\302\264\302 (\027\351\024P~\240\322\243T#\t\300T\343\345J\t\375M\304\216\016\371\315\224?\346\365\316\356)\032\001\r\026\230\224\233P\344\251\r\310\f\025!Lb\2377\321\224\001\311\262z\346S\351\275\237@Pn\201\217\362\217:W\034%\245\376J4\215\246\321\023\201\177\300S\226\365l$\345$\t:G\312G\032\342}u\316\255T+-\324,G\265\314=\216Ry\231\260\371s\r\315=\\sd\256\335\230\263\305\235\315\235\233X\346\001J*\201\370\360\036:\314\3415\345\232\r\0322`\370\013\026*L\220"
+	.string	"\002\265\021\206\320\007?]tps6\034\006\0246\325\031\0311>\031\211\301\370\205\213\266`\361+\276\363\251\036S\246"
+	.ascii	"\241\340\t\023'd\211\237$j\303\345\302\250R]\344\210\247\b\351"
+	.ascii	"\251\240S\323SNj\275v=*{Sv=\t\313\336.sj\217\200\211\2501E\306"
+	.ascii	"\330\320\202\202\222$\303\034P\0021\250\252\316\003\0200e\252"
+	.ascii	"LR\220t\200X\377\227\006/\024\243\324\t!(\326\213\231\2719$\250"
+	.ascii	"\226\210=\343\330\254\213\312\355\253dW\226\030\322Ei\362\220"
+	.ascii	"\340\241p\330Z\235\032\"\taZ\344\314u\262F~(\261)f\257\n\250"
+	.ascii	"\366@\021\006}\200a\301\202J\tA{.P\225\355u\307\332\236Sdw&\020"
+	.ascii	"\306\210\020\274\277\377\326\n)j\233\327\243\3133\207)\035\\"
+	.ascii	"\313\202\320\215\r\246\363)\003\241\301E\264\357\272,Mf\346\213"
+	.ascii	"\347\031\020H.\327\302\2118\031\r!8\354BfkcX\375vI;\313\377\312"
+	.ascii	"\211\317\302\177\255Jq\216\360\251ZDr\301\021\030\231\253XS\206"
+	.ascii	"\340\230<Z\035\312o\2724\245*{\216\364\231\034P\302\360X\034"
+	.ascii	"Nw\376\354\370\216:\001:\3011z\357\303\242h't\311\360\217\366"
+	.ascii	"O\315\300lD\321G\211\3721\005#\315\343\341\360K\027\274\354S"
+	.ascii	"\222\364\216\211s\377\375@u\306#0\310\251c.\037"
+	.text
+	.section	.gnu.lto_.lto.1b3f415c60458c90,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidNames.59.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"\032ROLL;PITCH;YAW;LEVEL;MAG;"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.75.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \235\245\004"
+	.string	"d\bk"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\334\221\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\327\006us\350\364\005uq"
+	.string	"\005\001\006'\001\006\005\001\006\035\001'\001\370\303"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.77.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 8\235\001"
+	.string	"\204\002+"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\024\005\001\006'\001\364\003\001\002?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\003"
+	.string	")\"\300\274\177"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.82.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \236\205\004"
+	.string	"$\bl"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\303\306\322\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\376\006us\324\006uq"
+	.string	"\005\001\006'\001\222\003\005\001\006\035\001\003\216\240\003?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"\200\b0\313KQ\204\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_resetPidProfile.83.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\345\b"
+	.string	"\346\021A;0\345(\035"
+	.string	"\336\2309HI\232H4*6\266=<R\013\306^P\324F\0058\323\004s6\200\ry\020+\211h\277I\003\203\001\035\030ZM+\205\240LE\375\t\331d\357\224\002-"
+	.string	"/"
+	.string	"0"
+	.string	"\330g\346\004\330\247?\373\345\365c\237*e\244X\273K\245\307\277\307\317?\311\003B\023\370\2305\354\256ch\332\270\345m\037\330^\260\255\n\273ky\262\217\372\3435Z\026L\002\312n)"
+	.string	"\200U\315\225\220\030o_c\373\321\276\310G\276\243,>\260{JQ\331\255\nF\310|\272\276 n\301^\177\342e1.\273\244\207~\311MB\327A>]\341a\017?}\017\373\214\322\246\030\305\207f\340`\321h\255H\022\264+\030e\207\375k\003\036\220\366\331:\207\216\306\t\230\263\351h\034\025E@h\240\017\235\320\036$(\247\013\321\215\2017\316\323Q\321\266uTS\367\327\312\223\257\326\266V\027\022\303Y<\351\001\007"
+	.ascii	"2\241\311/\360\301\205C\227\241\233\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.84.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\215\001\305\017"
+	.string	"f\237jE"
+	.string	"\261&\035;FD\260\372\212\371\"\032r\315$\363\364\276\021z\217\226Nvu\223\246B\302\310\016h\275\251\266-M\031\207ue\005\312\210\324\004\250\004"
+	.string	"\206\2105\346\004<(\327\277\203m0V\t!{K\231RU"
+	.string	"U"
+	.string	"R"
+	.string	"\376\320\036\355\375"
+	.string	"\366\250\335"
+	.ascii	"\366\350\222m\343\036\211\375\327b\305\225cw7\035a=\364n\230"
+	.ascii	"\245G\250Y\362\263\221\230+`\275:\225\351\021\022\330]\001*\016"
+	.ascii	"\260A\262\250P\tO\270\\\357\372\002VO\247ryf#\273\353\354T\036"
+	.ascii	"n\354\266G\266\037\330\327\t\255"
+	.string	"?\373\314\r\237VM\247\246\037`\300\013\r\b3v;\274x\354N\214a\3423\277}\177\305?\225\323X?\360\334\363]\006\261\270L\3513\226\241\231Z\264\357\263\371\331]\220G;\320\036\023@\025\033\364x\220\355\247}\326U\224\336\322\360\002\273\253\034\030\273^H8j\354\246\336\371.n\023\202/\361\350\013$\354\335\243O\302\036U\375\017C\206|\347\177\177K\004N\213\216\237\224\232\234\232\251\352oR)\236\272u\260k\352S(P\3712\324\353]\217 X7Vz\234\362\245\272\273&U\030\333C\345ww\255+[{\334I&(\334Ih\024\241\204\023\201L\"R\302\211\266\024\n\0238\224\223\315\002'\241\302F2\"m\"\b\034\022\231\214\266\224Ph\264\201\274\323\277\272\362c\256\275\b\261sRTT\030g9\252\251\372$\310\241\262\204\034\352[2>\033r\307!4\203C\325>pxP=4/"
+	.string	"\3625\177\315oHY\036"
+	.ascii	"3\241\365i\f\246\001\215\332.\222\265\324\230\235\314\214i\314"
+	.ascii	" \036\266N\025\354\210\246\021\230\226\202\021.\207\246e0\013"
+	.ascii	"3\2101\340\322\006\325\002\272Z\016\304\365*M\263j%\020\0277"
+	.ascii	"D\224\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.87.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"=\b"
+	.string	"\026\220;8Po\322\001\240\343/"
+	.string	"E\337\325\334\254f7&\360lL\313\324&4-\016\305\255\t\341%V\030Yb\024\331h\235\245\316\n\020\265F\006\205V\263\257-~\262\311\336)\005)"
+	.string	"-"
+	.string	"*"
+	.string	"\227\346l\227\177\035{\223\226\213\222\230\335\235\221\343\334!\347_\344\232\2564:\004X\330]\303\256\224q\307\3336\260\235`\333\013\276\367CK\340eEA\265\213\261\232\331\224L\371\330\330>\264\017\362\020\356\236Q\326\354\252\234\240\354.\202\017\002.\013>p]Z\347\\\001\321d\007\230\024)Z\030F\177\344$F\371\036\256\360\t\276\273\364}\272.%\213JF\203\004W\3667\202q\303\276\265\273\353hrU\333<\225~(\2061\200*\335\032(h\210c\254\363\220\211\346&\021\221} f(\363\200&V'f\207\300\232\210\326\271iZ\235\233oom\b"
+	.ascii	"2\241\205/0\340\002,\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_pidOsdAntiGravityActive.88.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\r\007"
+	.string	"2\315/4`m\322\001\320j\020\210\2320jS\240\2253\254\227\334\002\004jX\020\205n\r\371\200%\244\303\177\361'\262"
+	.string	""
+	.string	"\3660\237^\321`\003\013\\b\333[\312\224\002\236\244\005\312\202\330\203\003\005\321"
+	.string	"%(\205\b8]\023P\032pe1\\\020\253\252\013Fq\357V7N\t,zq\352\325\3511\035\227H\221\367x\307!\276\206+\354\311o\177\276=\224\277k\300\205%Cv\254\244b\330w\253\033\333i\227\351\314\364\237\300\247\004ad7\023\002-\311\023\331\260}\333\231\035\331\340 \263\366\230\2219\347\203\0019\331\215P9\327\236\232\177\216;\320\207\311\246\251<\001\022v\327\271i,n}\201\355N\f"
+	.ascii	"2\241\205\037x\306\204\005\371\300`>\263`Q\344\271\206\357\f"
+	.ascii	"Q\302]\226f\303\273\356\r"
+	.text
+	.section	.gnu.lto_pidStabilisationState.89.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\305\b"
+	.string	"v\321?8@\217\322\001xQ\363\350Rr1w\314\333\230\2241_\357\336\026\2167\277\307\324\366\221\327\r\t\006\243\037r\260\337Z\302\224A\227\306\036\3000\270`\233\352\031\342\266[\246\024,"
+	.string	"."
+	.string	"/"
+	.string	"R\363\201\354\322\236\355r\320c\377\n1Lb\273;c\307\275\253\347\177\344\033\325w\272\0024\354\256U\365i\334\361\266\021l3\330N\t\353\310\262\337\372U\325\227\377V1\230\207\327nF8\263*\022\006\302\261}\265\037r\021\357-\2237\273\033-(\273\240\202\023\002.\017N\220=\250\230\362\243Or\327\205\377a\213\222^u\351\227\262K\003\327\312I\fJC\377\246L\343\343\002\253\304\305\362\202\2454\264\301\223F\016\373\232\335\r\241\316\323Ap!\221h\343\272\321\346"
+	.string	"\322H\002\376t@\032iv\023\022\232(b\2164\017\305\374p\025\263S\340\215\024\342f\267m\334\344\200{\315F\226\345\267\222y\t\b"
+	.ascii	"2\241\263/P\300\20530\352\022\026\261\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.90.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidGetSpikeLimitInverse.124.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \365\245\006"
+	.string	"\202\f.3pM\322\001\240\353\002\330\305Ui~\030e\310\314\f\324`)L\307\300\372[S\037h\210)\310\202\037\273\"\001]\340\234V\220\235\212\f\276hdo)S\n\276L\t\024\346e\032\030(\207\205\007A!<\274\213\025\361&\002W\030\005\353e\252\312zQ\334k'U\332\350\204}\221Gc\276\307\022\376\344\257;\337\037\350.\025"
+	.string	"c\223\231\0355\251\032\366\333j\307~:u\340\002\345\200d\267\"[\331\023W\322a\033\332\221\377q\020hc-rx\236\222Q\214\250\354\356\223."
+	.string	"\335\265\007@w\272q\370\204\376C\336<L\260\213\243yZ\fv\327yq,n}\201\355\214\t"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\322lx\327\275"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_pidGetFfBoostFactor.125.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \365\255\006"
+	.string	"\202L.3`O\322\001T"
+	.string	"\f.\323\270\372\034\370\320\316\324\345\224\363\241\263[\335\340\267&\017\331H\215S\005k\020\2140\034]\201\225ca\310p\370\f\262\267\224)\005\246&\205\352\3620\016\r\325\003\303\213\250\022 \036uI\274\251\300\326e\341z\030\313\272^\024\367\312I\2254Ja\237\344\321\037\277\343\t{\362\330\235o\017t\227\032\220\241\311\314\216\231\324\r\373m\225c?\235J\360\221\202\260\262{\221\265,\2123\361\260\r\355\310\017\271\b\264?-vt\256bQQ\302\262\273O\372"
+	.string	"t\327."
+	.string	"\335)\307\341\023\372\037y\0039\311\260M\346\tp\260\273Nl\203q\353\rlk\004\t"
+	.ascii	"2\003\346:\203i\b\3055\0217\004\216\031\233\270+\322lx\327\275"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_pidInitFilters.126.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\023\001\355\f"
+	.string	"\206VUC\020Q\225\016\033>\021\220\363\034U\006\236\273\334\313\276\304>)\006\n\261\320\037\247\2760\357;\\\261\202\373\366\321\355\312_z\b\300i\274\357\200\336P\004"
+	.string	"D\300S0M '|[\307\272\331H\366\336;\245A"
+	.string	">"
+	.string	"C"
+	.string	"\"{\027 2\224\314vw\233$>\313\367J\247\374\374K\250z\255\274N\025\310R\300\360\365I\017\2048\361"
+	.string	" l\321\f\212\b\034'\271\324\020\262\244\374\350\354\256%\030v\270\265\333f`;\201\375/\366\037\233\201\260<C\354\217\374TJ\337\2429Ai\220\262\273a\344\2615j\f\023\030\333\227\366Q<\305\367\221\013\027\260\0332\003\306\256\210\300\233\312\253\305g\264\327\312\007h\257\376\354\034\027\0032@\230\004\222\306\306\356\352\240_r\026\035\005\223I{\255 3\001a\216\315@0L\243\264O\b+n\264\344\016\373\261\253@\371%l!%\017\276\372)\355\365\363$\337\2340\321\361a%G[T\3119\"\240\021\027\352\274\005\037\256t\261\207\363\341J\333)\202\210\033\205\266\t\334\003\322\346\361L\033\207\200\273\022\310\333N]\347m\030q]\357\254&\313U\003H:m\017H\0364\235\252q\034{P\003\"/D\347 \243Q\240\005\347 \036"
+	.string	"2\003\303!\302Z\300\231%fS\230P\267\302<\301\204\005\001A1p\005R\203@9\260\f4a\024\t8t\205\325\202\340$<4b\305\244a\301"
+	.ascii	",\027k\233\325\224\340^\\\316\233\355A\205\031M\253\240"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.127.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`M\001\315\r"
+	.string	"\266\231\\C"
+	.string	"\223\223\016cE\np\243\206g\213\242\035\3327\021\341\267O\2707=}8\210\272L\027]\212\333\277\241\026\006\273-\203\222\031\311\"Y\017pW\365\262\f\253\024\321H\257A\267>\332\252m\223\2667\3312\245E"
+	.string	"G"
+	.string	"I"
+	.string	"\002\344\243>\200|tg\333\370\027b\277\242E\345D\314\356b\020D\247\335\243\005\265\3635\236\215\207*=^\035n\235\024\302\\3\240.X\003v\367\253+\006\224IU\343\331]\253\207\332p\313\333\316l7\260\317!\276\313\177\375\345\227\377~K\325\312\371L*&\207\005\027\273\032\246\217\215\021[\220\260}\3730v\347\035\373e\204\002\003\b\272\177\244\203\254I\206w\340z\264\252}\023WuwAq\334M\275`\261\373\0250\201\353\021\344\001\n\255*?<\347\224\261HR\302\353\370\347\234; d\261\215\"/\030\242\342\261\242qR\031K\025!M\t\030-\026\364Q<\005\311\027\341\321\211\336{\364O\344c\002U\215\017*\017):\355\257\244\220\305>\234s\3160\\q\331\207\344\200\023\332*,(\031A\310H6\232\306\211F\f@\231\310d\323"
+	.string	"xD\204d\373`\242\b%\233\211\206M\330\036H\300F@!L$\304\334'\003a\"\216\003a\235o\017W\342L\252\007\216\024h\272\0217\252\320\346(\350=\177u\317\t\226|\301\034"
+	.string	"\255s\340\314\200{f0x9\354\013\023\305\271\027\f"
+	.ascii	"[\204\252\032zW\f\363\"\306\024\264\003\202\375\234l\243\356"
+	.ascii	"\007\2561n\270\016\024\001\343\300`>\t-P\243\205\273\004\006"
+	.ascii	"\f\302\220{\326\341c\245\f"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.128.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`&\001\025\r"
+	.string	"\246\031ZB\020\2176\035\240\262\204\345q\t\311Q'\210\230\206\037\3749\305\017"
+	.string	"\244\365\210v\35536N\364\272\177\240\327\275\213P\212\236f\237{\017\t"
+	.string	""
+	.string	""
+	.string	"\362\206T\252\001\021A1\311c\352\255J\2326\2212\245E"
+	.string	"G"
+	.string	"D"
+	.string	"\003\250\303\274"
+	.ascii	"\352\320\236\355\342\337\206=K\212\023\0212v\367R\r^z\207\223"
+	.ascii	"\246\347kl,P"
+	.string	"\310sX]\370\364I-='\204$L\034\273\373\225'J\310$Sc\263\273NP\310\302M\3356\307v\002\373\235\232\351\324\364-\0020+:/\273\024\342\214u\201':\234t\373\237_\262\306\007\361\020\336IFQy*T%XZ^\354n\307\241\017T\207\034\3235\2663\355{\370\007\357\243\216\341n\006\025&v?\003.P\035\006x\337|\324c\250\251\316\223\031\307\030c&\216\272\036\306G\234\004\347s\360\bI\036t\350\223(\002\025\f%\031\377\030#\214\252\310\035\n\352\306H\206\324\342\2231\366\347I\025\331\327\030#\013k\212\375\321\017O\272\003\\\026\341c\3020\255\033Q\260q\272\220\f\003`\020\217\005\231\310\3255`\220\205`\327\203\354\303\301\005\262q\227\307\2065\021\316vu\232\266]\232o\257)UK\f\227\0225y\201*\362K\267Tdf\264\343\252(\266\225\251\266\006!\017\362W\002\026"
+	.ascii	"2\003\3769\203\013`5\030\360\230\002\201\024!J9D\006\222\261"
+	.ascii	"8\324Ja\030\240\\f\353B\212\213\fN\252j\227XI\021\356\022\030"
+	.ascii	"0\bC\356Y\207\217\2252"
+	.text
+	.section	.gnu.lto_pidResetIterm.156.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`7\001\245\r"
+	.string	"6\331YD\020q\233\016\030\0038\352\217\250\335\002\342\016\377\351\203\332U\251\024\020.h\f\241\2540\b@\025\245\t\327\217\257\007\321\343\214f\200\rs\371\005"
+	.string	""
+	.string	""
+	.string	"E\315\n\276,W\311\r\3406{\263\357\240%{\313\235RD"
+	.string	"D"
+	.string	"H"
+	.string	"\035S\f\020-\341\356ZJ\302z\t\3362n\237R\343\346g@,\227(!^8\217\364)\007\354\256"
+	.string	"\317\203\\\020I\274R\224&\223\353\301O\224\016\206\363L\0363\240\335u\344\274\222\273\272\355\221m\217\375.*6H\212_M\261\377}\3673\001Nt\336;\034\273\"bz\254\313\234a\342\337\355\247\360Ak\256\342+\266\177\246\361-\331\217\204&\0319v\327\363i\004\037\237\006\316\251>\3457\325\3475\336\354\033\007W6\247\016\346\303\210\022\f\2438\276\213\277\300,h\361\234V}f'6l\224\355x\300\276\360\026\243\n0\260\315\341-0\020X\331\335\006,~\322\340\227\370\364\206\220x\356\323\017\251>\017^\3528y\tC\221\030\243\272\273$\325\332\225!$-\3728\270@\254\221\204\b\327\004\bV\205+D\301\022e\232\365\351\030\003y\220Y#\f\313,\r\270\327\024\226\177\244\006\n\027\021-MU1\200\224V\252\251\350\371\225D\301\257\337qJu\210<.ww\245\023\374Z\351&\036"
+	.ascii	"2\003\006:\306\313\0164k\273\n\226%\260Bd\254j]pD#F\210\202\204"
+	.ascii	"\321U\303`\302-0M\321\246=\2306\301\\\327a\252Y\351ml\350LN\253"
+	.ascii	"\246_\204\b2\343\306\215\262!O{{\016\b\024e\3235\237"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.166.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\035\n"
+	.string	"\026\223F>0\305*\035\200\357\367\236\1773\354\364v\3676m\265I\230\031\026K#\225\021\017\346\351\030]F\377\377\031\027hb20&\203\267\2454\024b\370\020\350\324x&P\320\366\272\222A\310\336;\2453"
+	.string	"7"
+	.string	"2"
+	.string	"\006v\267\316\217\203\247S\202\376]\307\204\242\351\224\333\370\244\0132\026\002\007b\212jT!\341]\227\031\"J\312\202\206\335\265\fE\215[\273m\007\333\325\366\030\233\001"
+	.string	"\025\361\252\002\273\252\021\301\306\264\026\221\214\355K\373$/\001\337\362\2121\273./\260\335e\260\002w-\341\232\355\032=\302v\315\240=\340/\326nF\022`\244\0042\3304i\373\204@\021\220\2223\373&?!\371 \276(\311\207\327\374\322v\355\323[\215\007V'9\332/\223\234\036\366\351\356\256g\207\375\326?\245\364\003\236\320\367u\336\347\343\334\341D\200D\365\373L\200B\022\265\002\364@Q;\336\250r6\356D\036\257~]\347\325\314k\037\200#v\232(\312\3119m\213\221|h:Mg\315\002\017"
+	.ascii	"2\003\302\260\301\204\325\t%\342\275\204j\025\004\016\021\002"
+	.ascii	"\320\020\340\300\224K\260\315j\212\270\3131\233\244\201\251="
+	.text
+	.section	.gnu.lto_pidInitConfig.174.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`(&\005\220"
+	.string	"z\343d1G\020HM\247\003CD\376<\225\245\205\346C>\001\227:'\347g\023\223\036?P.\356\370\350\210\310\237LW\007\207\354\256\205\320\210\200\021\020\025\221>\322f\035@\362\324\323\326\024\035\245\232\212;\021\242\271A\344\226)\245\024\325\002\351\002*\003\032\\\347+\326\331\312u\256r\235\251\240\316P\3269\003\353<\305:cp\235\245\\\347\013\256s\024\324\031\n\352l\201u\256\240\310\371\211uvr\235\233\\g&\250\363\022\353L\301uV\022tNr\235\221\004\235'\270\316G\202\316\022\\\347\247\240s\004\327\031\202\240\363\003\327\331\001\353\334"
+	.string	"\352l\004uf\300:\027A\235\027@\235\025\b:\023A\235\207\240\316\t\004\235\205\004\235\203\\g\004\256\363\001\327\331"
+	.string	"\324\031\210u\376q\235\013\270\316>Pg\002P\347\001\202\316=\256\263"
+	.string	"\327\231\307uvB\235w\240\316:\202\3169\256s\323u\016"
+	.string	"u\306q\235o\\g\033\2503"
+	.ascii	"\250s\r\353L\303:\317\270\3162\2543\323u\216q\235a\240\316K\326"
+	.ascii	"\371\305uvq\235[\240\316,\254\263\322uN\272\316H\326y\305uVq"
+	.ascii	"\235S\240\316(\202\316'\256\263\211\353|\204:\227\260\316$\256"
+	.ascii	"\363\210\353,\002u6\262\316!\2563\210\353\\\204:\007\255\363"
+	.ascii	"\275\316\350u\266\250\363[\347\366\253"
+	.string	"\021=\034\342\352c\236\252vy\002\252\200P\033\326t\236\356;\335q\335v\272\351t\317\351n\353 s3\267\r\334z\330\210{\370H;\217\260\325U\025\312\240\326\202\236\252\262=\301\243\246\006\216\233\311Fq\314<\272\032Ssx\265I\203cR\003\367\233\035f\002\002L{{\240\016\0335\232f\207\2069'\270\0160\240\025\372Q\324l\334rf\3508i\267\261\\\253]j\247\340\207\266\246\247\252jS\243\334\243\250\321\030\326\0321s;s\313\320o\322^V\265\tU-s\303\035Ue\323\3016\212\032e\266Vq\033-j\024\267Q\346\224\231\207f3S\223\320\324d\271\371\251\252\352\364e4\216\370\333\2625\327\260i\317\240\301\024\003\306\322\013\031-X(%!\255P\221\002\305\t\023G%H\214\020a\024\002DQ\215k\203\357)\267%#\303\263\310e\3253\354\221\035\313\003\317\033\247\361\326L1\202D"
+	.string	"\325\326 \"\353\252\3230\330l\301\361%:z\226\376\302\337ZF\r\335\242\2065g\241D\326\345\246\223\224m\034i\305!\025>\356^H\021$R\304\227\366\007\021Y\327\232F\241\246\311\266\322\\\025h\344\3220\023\331V\013\177\302\0054n\302\036\235\261<\352\210\361#3]f]\"H\244N3I\263\203\210\254\313\254I\210\365\b\2610\027\001\326F`H\017\301D\326ul\0206\306\221\211\315\226\321\213\354Q\240\255/\313C\316\3525\332L\027\\_\333Wp\035\f\301\025\246\237\004\027\226\215\241\252j\303i\347\302Et\017\022QU\225\275\310\325\325\f@3;\033f\216\302L\243D%\004\205\345\255g7\3260\023Mn\020\232\221\315m\374\r"
+	.string	"\336\306'\325\255z5\276\327"
+	.ascii	"\360\026n=\243\3615\322<\r\r\036\2243\236\335\314\317\244j\312"
+	.ascii	"t\315\273\230\256\335F\177\356\215\233\231\361-f\304\223Q&\205"
+	.ascii	"\343,\3561\275\214\177\270U\017\211\223\t\205\230\215\201r\262"
+	.ascii	"\033\323a\306\364\315g\304S\306\020S\300\341`|\214\245\207\361"
+	.ascii	"\327\355\305/-q\244p\307\021\252\206q\351\305\267\033\343\241"
+	.ascii	"\246\013\017S\204\343\234o\203\320\306\376Z\274\013\026\337\342"
+	.ascii	"\321>\245g\341^B\035v;\334\013\024\r\357z\241\364\035\203\361"
+	.ascii	"P\210\244\337\352\302B\217Y\244Oz;\267\262!\262\022\347\302L"
+	.ascii	"\030\236\202\027]\313\233\345n\243H?4\016j.A|\362\206^a\304\327"
+	.ascii	"\025\177\203\261NY\364In9\255\003\315u\253g\033\354\263\357\344"
+	.ascii	"s\321\341B[!,\377\353\356\177>\237\316\0329\272\223\357V\317"
+	.ascii	"\242\rI\267\212\251xf\007\034\313\211~\265\005V6f\227\342U\240"
+	.ascii	"\370\024'\036\005\004\375|\3529v\201PC\354\234B\314N\374=\032"
+	.ascii	"\351\232&\236\371H\377\360\327,\356I\036:z\023%\376\210\304\227"
+	.ascii	"@\322>\364\361\221\240S\216xf%\275\207H\357O\f\033\240\210\037"
+	.ascii	"a\364\"B\274\321\222\306;d(\304\337/\343\237\346\022\30437\351"
+	.ascii	";f.\331=A\262SU\025\310\240&d\001G\221\"\005\256\270\307l\342"
+	.ascii	"W\032\240!\317\247_\321\203\370^\331\004\277\350Q\274U\357~\360"
+	.ascii	";+\220\247\264 a\3171c\256\202\241\003A\r1SU, UZ\207+\215\006"
+	.ascii	"\261\273\337r\272\201/\343\237\367\347\363\031x\321\247{gq\317"
+	.ascii	">3\233\016\223\300R\325\253\031\350\367\332\207\350O\376\267"
+	.ascii	"\217\272\255z\375\377\r\247\243\020\221\314\254@\373I\366o\352"
+	.ascii	"\226\323\335eU[\332\246\356\263\347\302\035\374$\223\231}\006"
+	.ascii	"w\237\316\201\231\334jx\003\216\363.r\334mth\344\343\347\307"
+	.ascii	"\246\252\352\177\222\205\267\237J\333\035\226\3771sT\363\021"
+	.ascii	"\026\251*V\001\334{\252\300xP\244\246Q\356\252\333h\277\023#"
+	.ascii	"\037\345\362\312\237\314lV\376\311\347\363\371\344/\303\354V"
+	.ascii	"\200\177\035\327\334\315\266\323\334~\211:Os\363\365\234\346"
+	.ascii	"\216\323\313\356\206\341\254\313\232Ns\233\351\266\346N\202p"
+	.ascii	"\3562d\310\306\214\211\021\013\003C\036\215_a\300|\361\362\322"
+	.ascii	"\305\265\325\205\205\025T\340R\324J!k-r\356-X\304\353\334W\250"
+	.ascii	"s[\251\3269-r\036Z\347\252\2403\n}\247\371\004\353lB\320Yx\235"
+	.ascii	"\265\\\347\022\2563\t\327y\204\353Le\235E\270\316S\3269\204\353"
+	.ascii	"\234\305:K]g,\326\031\204\353\374\301u\366\300:w`\235\243\256"
+	.ascii	"3\007\327y\203\240s\307A\315\345zl\033+\341\333\357\333I\302"
+	.ascii	"\217\360%|\020\257\311\323\300\314\226c\363s\236t\334\273\221"
+	.ascii	"\360-w7\302\367[#!\243\206\320\272W\202\252mM\237\bO\365\302"
+	.ascii	"\317 B\235r\n\016\232\313\205\360S\357ui\377&\204\357\343q\207"
+	.ascii	"f\22655<\251\317\362\355\\\365\224\257\224\332\001\313\253\255"
+	.ascii	"\325\025\367@x,\337}o>\r\204\037\036\351>x\264!\336\237\007\377"
+	.ascii	"\301\007\353:x\017\336\2353\374\231\260\203\357\263\343\\s\031"
+	.ascii	"\345B\2526lK\327\334^\2150\352\033\3548\247\344\340\321\fi\340"
+	.ascii	"a\203\347\340\225\360V6\032\374\006o\335\352|\331\223\006\337"
+	.ascii	"6\034\3754\227W\222v\254\374\225\377\271U\017\356\311X\371\026"
+	.ascii	";\372\2512\206\231L*)\252@=\225\357U\017\352\221\332\320\020"
+	.ascii	"\312\n\314@\fO_\236\007\313\340\333\353(\247\234r\224\253\343"
+	.ascii	"\363_S\276\267\216z\232K\f\300\340\340\226\303{a\360Z\216z\224"
+	.ascii	"$\244|\327\257\320\027\274\224\377\276U\214H\324B\002*\024\345"
+	.ascii	"/\200\362Q^in\325\323\362e\301C\371^\305\210\026\374\022\361"
+	.ascii	"\f\241\254\300\021\251\332\255\340\337JO\236\nsTG\2706~\025|"
+	.ascii	"1U\033\322\245k\256\303\247P\301w\327\321\255\271|\362\374[~"
+	.ascii	"\225\032\n\032\326\r\353\372\305u\362O\276\263\364\020\t\375"
+	.ascii	"\225\320\311\017\217nM^\275\233c\362M\226<\023\n~\211!w\n)\370"
+	.ascii	"\341Q\216\222\037\360\222\274\222w\267<o&y-\306\247\022I\"D\023"
+	.ascii	"<\222\367\271\036\274o\202\037\032\003\217\364\320'\301\037\371"
+	.ascii	"\257K\344\210$\370>3"
+	.ascii	"\006>\345\r\233\021\374\323\360\007\307\213\300\331\204\300\320"
+	.ascii	"\320\371\300C\360\3576|\372\335\323\003\337_"
+	.string	"F\247r\351\300\023b\246\025\3075\360\016\274;W=\242\327\t\033x%@\034\214<{ \027\224n\311J\265\264\346\212{\f\274\221O\352+\362\fpq:a\221\357\245\021P\271\300\\\312\265B\372\305\273\350{Z\201_\340\257\033\221W\240\213\347@\2449\344\331op\034R./\351\227/\267Q\357+\356]\331%\360C\036u\256l\204|\002a\\N\310\267\2271\221r\031\344\331m\360<\251\021\231\206\205]1~\347)\b\nf\364\241)\002\20182x\305\275\003\020x[\267\366!\306\371\003\036\211(F\267\236\021\r\370\216\363\216\007\344\rx\245\272U\357\307\003\371\246\241\241\264\211\361\311\n4\022\324\302\373\343\251\264\315a\371\337\030\247#\374\361N\214|\315\245\033\231)#_\033\277\002\276-\016\234\217\347\361\005\020\360>>\350\034\340\t\370 \\\217\037 \351l=\276\217\306\274\3462\207/\231\231\302\354\215"
+	.ascii	"\357k\314\264\301\256t7iYz&M\223\3466z\345\212{<\336\351\005"
+	.ascii	"Pcf\013\034\307\343A|\355x\247g\201\267\352\371Y\353\370\035"
+	.ascii	"\257\344\\\331\344x\035k<\355)\3077\2401O\271lB{\301\215\214"
+	.ascii	"\2418l|\001|"
+	.string	"\023\216\017\340\223\344x\007\034\037X\242\216X\261T\2468\026\251(\252*W\246\246\244\212D\031Qa\211\222J\222e\004+X\242\236\2000u\205*\352H\204(-P\366\312\007Q\032HM%\261\022\225%\004W\331a%*\213\023\025\007\033D}\240\201\023\226((\020\234\252L\211\340\264#\211\245\262\\\231r\242\222\222\232r2bS\273\325/S\224'\006\320\325\023\271\267\274ax\346*\035\252\004y\027\371F\036\262\313<[5\333\246\252\216P\325\235w\361\356\2261d\323\310\fR.\311\320\252\360\254\333\230o\262\261\3571\237\344\034\313\263gb\276\333 wh.\257\304\336\005fV!\342\270=tucw\260\302\276\305\336\005X\230MS\325\003\3307\2373_\307G\032\277\217\037\224\373\3726\366\3313_\177\301\220alYU\242\262@\206\324?`\276\303|\371\006\363\267o\325\273\362\372\376R\325\264e\274"
+	.ascii	"\221\177f\340\351\246BL\235\350\331\3128\341\273\254\314\322"
+	.ascii	"(\373N\364\215\247\237\264\271!\344WL\237\03436D\372\361\363"
+	.ascii	"\3631U\275\212\361I//\306L\027f6\254\352\2074M\227\227\267}k"
+	.ascii	"\237\256\255o\256\357\255gV  UUa|\222\273|\007j\373\203\345\177"
+	.ascii	"\026)\fbv\204\362af\215Wv\330u\371 g\272\227\232\357\177\206"
+	.ascii	"\271\2653\033F\350d\307\\\345\264`\252\2369\314\370\276\365\264"
+	.ascii	"\375\203\334\323\264\341UU\265z\301\242\251\033Ow\227\265/\256"
+	.ascii	"ES\237 \203\005\353e\325,\250\275\302\007\361Z\205G\321\346\206"
+	.ascii	"\206\365\214\310e\213\231D\216\263Z\315\345\221\332\224\317\265"
+	.ascii	"\017\261\305'\213\377V~~\350\242Ua\270\005\216O\353\273\250\365"
+	.ascii	"\301\271\024\262\254V\326\367\021\031\267\332\254Tm\250\225\256"
+	.ascii	"q\261[\326\357/\344[s\213%J\rW\030\326=\261\267\030\261VX\337"
+	.ascii	"^\3107\345\362\212\370\354\322W\337\304+=+\256\007lu\216r\311"
+	.ascii	"\342\257\205\333\227\322'\375R5/\351\332\227\367!\375v\203\224"
+	.ascii	"\243L\222\272C*\367\036\032/\363\0209\034~\3231\364\004\204\365"
+	.ascii	"V\\\365\210R51\351\232\217\371<a\3257\230\343\023\005\274\324"
+	.ascii	"H&\rs&\337\320\023\nO\302\321)\374\273\324X\226\206\005\005\255"
+	.ascii	"a\026\367\220\b]pL\344\307\267\342\223,t]\237\037\0379\025\036"
+	.ascii	"\210\257M\016\335t\f\301I\361I\272T\355L\272\306\203\037\037"
+	.ascii	"\016\355A\033@V\356d\024\237\364\303?\327\375\3426Jw\246\216"
+	.ascii	"\365\341\307\362s\246\252*\216\277\201\231y(RU\253\026\35315"
+	.ascii	"\255\320\231:\246\342\030`\f\313\003\323\374\036\023\236\204"
+	.ascii	"#^sy\342\351\n\237J\013\237Gh\367\034\361L|\222G\240)\321\200"
+	.ascii	"\377\205H4u\2331\303lVGf\276\001\277\3534\22465t\253\330\337"
+	.ascii	"\343a\346\322\235g\276u\227\271\373\272\362g7\277\377\036\b\334"
+	.ascii	"\352\203\337k\371n\376\215\276UL\311\2771\323w0\263\363\304\347"
+	.ascii	"\314j\320\362\315\354\247\255\203/\250\3420-\224:\310\030\211"
+	.string	"\210$I\222a3\322\013\020\006\"Y\026By\007\022 d5\n\223L\231*\021\221)\005\205,\0073D\345\t\347q\1774\264S\333Q\362\356\332\265\216/53\273x\304\005\205emM\316a\331\3657\250\006\334x#\3359\234\324\27543{\026\241\tt\342\261\255\261\253\334\315\325lt\323\021\343\312&Gj^\375\026\021\322\351v\f\301~\202,\244>7PKlV0\020S\346\231t]\270G\235L<\317^\236\242\016CT\244.\006\"\203\335{\0130\r\322T\242V\322\201\f4\b\316/\004\210\335\305F\321#'Po\326 Q0\303\006!\230\261\241%\320\364\001\021V\306J%\327\371\r\003P\r'*\034B\365_\203\264D\021\0047M\"\267+\341\215TKpd&BB;\02218K\363<\275\253\247\275\316\307\r\223\"2\212\324\204\025\312\300\024\267?\217\243\226\256\340G?\206C\231\307\216"
+	.string	"\270U\n\342\225\305\310\300P\372\330\212R^\236c}\220\001\005\020\326\001F\"\341\025\252\032\b,\300\365\201\021\331S\345\025\361d%6I\362\331\341\262k`h\326K\327\232_\211@Ja\201\242EH_c\251\202n\304\272\2619\026\033\364: \332\305\036\023\232q\262\237ZK\205\347)(\265\321Qj\211\263PF\020\n<\031\033J B\224\351'"
+	.string	"\336"
+	.string	"\312<w\026)*\001\304\027\243h\235\202\223r\037v\215\373\"\370G\322\316(G\214\013/\325a\324f\021\234\210Kw\212\342\365V~J\371\032\2506dJN\327x\335\031(\223 E\347\355?\243\366\2469C\035'i\001\357\244\347sv\364\356\024\r\350\330Q\215mJ\224a\006<\255\f\242-\003\007\232p\326\364\260\245\264k\f!\334\305\305!!\205\216G\024\3771*\241\253\375\177\340i\362\200\f\332\300\303!V\026\243z\257\377\241\304\341\275\200Q\f\035v&\375\004i\300"
+	.string	"\235M\3232\352|\234m\200\272@/\022\f\360\026f\234\273\232:ap\263r`=\0060\235\367\362r\316q\371\342U\302>\030V\361\350\261\276\216\243\262OB\331\354T\330C\005K9\223\256sBT\r\037\034\344y\256jF)\236\203,\346>\257\313\261\n\222\334\232J\326\311\rd\017I"
+	.ascii	"\224s\372=\361\032l@IA\007\352\232\324\b\\-2\tV'\203\360\016"
+	.ascii	"\327\246\277\177\023\237M\207\320\203\272E\377\357md\352\215"
+	.ascii	"Q\27587\323%\303=\307*\271\224:\326\017\271M\345Q\205F\230+\037"
+	.ascii	"\\\307\245a\007\341\035\302LB\232\273\3450r\377\250\254N\r^\004"
+	.ascii	"\002\027\rft\262\215>\323\334\373\3156x\017S\265\305%t~\226\177"
+	.ascii	"\231\273j\332\234\263G5\375k\371\325V\312S\035)\377\274\005\365"
+	.ascii	"\231\377/\220\270\237\236bD\276\323\\\264\374\344\275{.\005\222"
+	.ascii	"\205\325\374>\334\206\024\353\236\310\337]\"\362\321\036\tU\332"
+	.ascii	"}\224\372\003,\316\313\337\326N\352\023\301$\237\202]\260\315"
+	.ascii	"\246!\321ri\t\346\374"
+	.string	"\220D\020\350\207a\242P\313\311\003@\321B\370\271B\003?y5\313\215\320\321B\216\rOf!\316E\220\0017w\262\207p\020\324:\225\217\314{\356\021_\021\253\305\350Y\333\360$b\254\310\260=\224\250\364\033;\216\322\204\3044\30433\345\247~\227\037l\241#\022.\365\006\030\226\347^X\261\3372\n\311#\372Q\255A+f\2661\332MF\024a\211W\270\216HHz/\275\340K\370D\360\262\345 \364oN\270e\031\217\037\252\301\371#\357`\273\270\226\325\261v\214s\275\023\363\363\322\260z`\016P\016>\372Q\306\253\355\nG5jp\201\255\256\201\025+\270\353\262\371\320\226\334\341R}\310ugJ.n\275u\253ue\017\332\210\346C\177\302\034\337\b\254Oy\257\005\246\033D\261.9WE\257\353\020\350\367\324\034\367\213MM\003\245X\247\221?|\347]\f:l\202\331\235\320\""
+	.string	"\020\251\r\277r\004\207Hq\205G\264\326\305\306\217 7\226\365\206\242\217\005-mL\236(\375\r8\317\025q\267\310\224\272'\240\330\370\223\354/\261[*\r\027\321H\222\230I0\025\303\037\254\013\260"
+	.string	"@(\312\342\277\301\201\376\216\220\274q\240\034S\222bN\2251v\245-F=\016\227"
+	.string	"\024\305x\220\212\305\003\026;\324\357\274\215Bi`\3214\006{\345\266&\363\325W\334\026\177\005\210X\301\274*\355\353\003\317\203\326h\310\020\f\006\016s(7\360\246\223\274\357\n\002\232\t\332\r\355V\374\235W'A\320\354\177X\231\267\0135\226\"\312aUj\305\312\2013\034\245\345\311\230\205\274\007\223\327\026\365.k\230P\204\360\234$\b7\036\"\270\"GD\321qAd\b\207+F\241\301\b\007\326\003o\"\013%\t\243\337h\t\230\221\021\r\313\260Al\0061V+\304d\300\272\036\344\272nc\272\302\005I74\240'\242\333Pf"
+	.string	"\336\354ik\313\347iU\270a\026\030A\207\336q\320\362_\240\270\215V\317s&E$\323{\201\351\\"
+	.ascii	"\225f|R0\236x6\305\374,\363b\201\bO\365\221\367\017\263+\306"
+	.ascii	"\256\3211;\252\267\342f\354\352\247\216\344\265/\314\226w\334"
+	.ascii	"\326R-L#\245\324\351t\264\333\320l:\b2\036\002\306%\366\220\017"
+	.ascii	"lc\2156"
+	.text
+	.section	.gnu.lto_pidInit.175.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\233\002=\025"
+	.string	"V&\211I\260TN:\330\262\264\030\252\320*P\244x)~\343\253\024\277\342\325\277\246\364o[\242\020\344\332\347\t\0213\265l^<\370\330\330\374\034\351\037\305\215\357\b\325\234\364\331\277\231)\371-K.\f\tWd\245E !D\356\224\002p"
+	.string	"k"
+	.string	"w"
+	.string	"(\027'\212\355O\3730\316\033:\224\210\247\354.MU\355\366\\\214\200\274\350\336W\306\213\344U\306\213\036\262\275\336cZ\226\027@\212|Ivw\246->t1\3249\344?\352\005\222\304dhM\355\210.\036=\324\243\0378\255\251\335\3215T\240$\304\204\200].\\\311Z\301u\337\347\210\035nN"
+	.string	"\016v\327\263\334\031\335\343m\317\330^`\253\006:\343\305\251\f\266L\373\215\035rwa\374\032\267\321\3437]t\355g\276\374\031/^C$u\215A\335f\320\356\341\246\262\260\037\356\356Z\227\354qZ6N\237\214\323\344\241\3761\234\016\303i\025\247g8}\225"
+	.string	"J\232v\347]\355\222\b2Y,\221\207\223?\343\276\240\367<\300\353D\220\375\030\227\022z\317\262\244.\224\213\266\220\035\336\031C\275\357)RZYG\212l\345\246\022\313\2560L\037e\030\251\376]\314h7\201Lm\274/\035\360D}\253\367\360/\203\251L\345+\303~\327%}\245X\273A0\b\314\355\336\f\220z\242\327=\341H\005\301\323\322\201\205\352\377^\265\3437y\206\206F\352\323I\211K\211\207B\365\032\252\213\356\t7\203\236\252\372\242&\033\256\243\206\334\315\301\3708\236\303\006G'8<\264\234\232\255\302\r\315Gf\233\227\033\232\317\f\210\203\016\215'g\326\201V\3233\263\261y\230\275\260\270\346\203c\233\001\325j\266\031J\357\366pu\311\344\227\025\326Mq~\0203\243.\243\261\244j\f,\247Db\313\034\325\367A\210\231/\035*\321\334\201$KEx\200)+\302K"
+	.string	"\211\020\030\"AF\203U\211t\337\004\n-Fvo/}\340\203X\270 #3^\374"
+	.ascii	"\374\225HwQ*ai9 \200\002\021A\331\r\363B+L\fl\301,\016\251Xp"
+	.ascii	"\374-3l\240\002\007by\233%\337\3334\350}\\vl-\311\341\307J0`"
+	.ascii	"\005\371(\025\225\304\035\271\b\\i\334\340$\367\366\214\363\332"
+	.ascii	"&aO\305\032\024\216'\326\210!\246\262E\200oSX%\257\256\035\267"
+	.ascii	"-\303\250\215\006\317q\211\301\0046\330\301L\\\024:\030\2140"
+	.ascii	"4\364 \2010X\221\232\373\225\251\345A\361\3515\024]\020\n"
+	.text
+	.section	.gnu.lto_pidAcroTrainerInit.176.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"]\007"
+	.string	"\"\r270q\222\016#\340\257\316\335\202S5\0024\333\316;\023\f\317\365\344\231\225\306a\342\267\273=\362\3655w\355\36074\024\024\030\241\034b\037\205\376*S7\264}Bd\n\203>\016X(\212$\"\260\t\210X\2015PD\220f\021?\236\263\320\203\026EY\246\305N*\013O\002\253\031U\tf(tE\245\037&V\013\241\177BS~)\200\311\314\205\213R\324\305\035\3515\306\350\225\353uG"
+	.string	"\275\352ab\231\320\224\336\315\247H\017\202|9\tO\317!\260\331\350\212Zer\334\324\244\352r!\371\333y{\231\246D\322S\022\243\301\322\312\314\bC\272\365m\267'\035\340:R_"
+	.string	"Cf\376\270\256\243\303\376\006\377\301\337\022\f"
+	.string	"3\001\3638\303\364\256\001\303"
+	.ascii	"\356B%\265Y%\240k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_pidCompensateThrustLinearization.177.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\003\001%\f"
+	.string	"F\030S?0Q\223\016\343F\242\312\223\274pVu\345\310}\030\301\272\224\362\370\272rx\\\211\3617\3506\265&L\013\202\3343\264\333\353\217yR\250\026\251\241\202\225\034u\025\305C\267O#\322\366\2262\245A"
+	.string	"="
+	.string	"@"
+	.string	"6\367D\036D\004\210(\221\200b\306\356\306\313\001L\016\3377&\207\332\341\327\237\346\345K\232\002X\n\016\244u\376,\\-\332\347]v\367\333\023D\3032%\315\356:A\032\205\033\336\266\001\333\321~\204\026uR9\330\177\253!\366\364\320/=t\303\247\337\323\372t>}\212e\203\n\355[\214\335\t]\311\216 \213\017\266/\273\222\017\2313e\327\305\213\025\273K\300\003\246C\333>\211\227\270\002O\237i\300\262s\352U\365Y\b\214\273\363\263\353\301H\232\272\031\331\272\f\004\226\273\333Q\316vb\256\bF`|\222\206}\023?a\316\0271\004\223\344A\207\276I&\207\327\007\031\272\021\030<\3319\034\036\226EU\035\326\344M&\001\347#Z\035\0138\036\nb\003\316\001\006qS9\210\231"
+	.string	"\246>8\252hQT\025+\242\375[\r\361\267\377B\326\325\320I\375RR\250 \266\241~$\243\302\310\243\330\223\364\351\244\331B5\024"
+	.ascii	"+\013=\302\rO\263\275nh\371\247\306\326\300\020\227`\0167@B\022"
+	.ascii	"\266\016f\354vMl\232\310\320\n\3101AD\205;\200\312\007\251!\213"
+	.ascii	"*\267]E\017"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.178.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\005\f"
+	.string	"\306\026R@\020S\224\016\030@@\003\033/\201\233"
+	.string	"\021\352\037\242!\223>\267\264\"\205C$\352\3038\337\230\267\326\b\375\237\223$\225y\024E%\021 B\f)"
+	.string	"q\343i\313\033\220\253\005\3417K\366\2262\245@"
+	.string	"?"
+	.string	">"
+	.string	"\021>@\365\250\245o\217Ps\363)\031\006\240\031<:\217{\254\2048\204\004J\340"
+	.string	"q@\207\t\037\226\027J\265x\"x\331\335\207<G\036(\223\222\331]g\347}\270\253\333v`[\201\375\005\001\250?\352Qw>\375\312R2y\227\361c\227t\022dKb\r\025\2667\333\312\243\374\031\300\256\215\0334v7\201\021T\036m\373-\356b\263?\230Ja*p\362\320\001\006\220\335\275.\027P=\027!\"\255\200QUdG\310H\216P\232\344\356r\372\331N\003W\b#=Bib_\344/\374\371&s0I\276{\364MR=^7\220\210q\032\361\311\023;\305\245\242\260\017WO\330\017\232\247\243y\032d\230\206q,k0\0216\235K\253@aca\302ua\363\200si2\f\027f\200\261\216\204\354\3220,\273\254\324\036\246\032jT\325\221m\325\214E\311GA1fT;\203\206|\227\n\225\013\025"
+	.ascii	"\177\b\b\303A\023\226\323\320\r\333\353\bm\001\241\034%=H%\021"
+	.ascii	"\340H&@\327p\220\2113*\\\313\004\021\025\016\001*\037\254\206"
+	.ascii	"\254jd\315\220\333U\364"
+	.text
+	.section	.gnu.lto_pidCopyProfile.179.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\030\001\375\f"
+	.string	"FXWB\020\2176\035l\356\034\025\322\223\005U:\356\2402\312DJ D\n\030v\007f\267\026\252\274\300\266\246\315\216\030\323\323@gp\375\356HE4$\260\242j\320bT0L\312(\315\315\366{\223-eJ\001D"
+	.string	"?"
+	.string	"C"
+	.string	"N\361\357d56\234t,,v\327\322\f\337>A\315\315\2476\031\221\007\372\204\251p\b7H\220:"
+	.string	"#\f.\225G\222\252\361J\340\306\356~\345\031\301\3432\251\315\356:E\036\205;\3366\002\333\007\354\177\004pw\327:\2623\235\271\312O=\345\217\231\206\232VM\247\246_i4|\360\336\002bWB\311\305\222&\021(\266_\331*.\0052\355\001\004\266\247\214Xw/t\b\261\373\tp"
+	.string	"\314'o\016J\275\204\262\344\250\031uv/!\277\230P2\001\325\304\224FU\357\004J\356.H\r!\252*\360\200\202$[8\365\252\nY:\013\377Nij\\\221\037\211Q\257\030\\\313\210\216\003\227%\373\343RM\354\007\034\315\223\361\240s\205\030\350\200`\036\231\326qa\035\037\317\225a\016\307\205\211X\237\217\005\030\210\207\025\202%``q4\217\305\241\341L\244\243Y\237,\323\254\352\013\035\256\216\214QQ\202\024Rn\212\t\335\300A^\344\257|S\242 S\n\003\032"
+	.ascii	"l\263\341\214\351P\262a\2415\325\357\355B\017\005]\357\r~\300"
+	.ascii	"\342\240$\300\025\024v+\2141\231\366\2549\230p\rS\204\341@\021"
+	.ascii	"0\016\f\323g\340\340.\001\003V5\262f\310\355*z"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.180.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\376\007E,"
+	.string	"JN\b\021Fp\\N:\345\305U\024\177)j'\213\221Y/\177F,\352\024'\375\224\271&c\033\005\362\215\307\372\013\003\255U,\211!\235\263\305\027\267\350U7\270*.\313^\201\344\300+\267<(\324u\272\2735B\266\334I\006\001\001\340"
+	.string	""
+	.string	"\001\327\302\217c\341\026\032b\3120\361H\375\340\262\3501\353|\370\275\035U\r\257\225\226\026\0266\376\025\026V\271\225\251\267\315\030R\211\335a\330\020&[\207\337\317a}\020\312\302\237\314\217\302\227\362),\\[\266m\370\375T\343\346\221\325\360\336\270R\203E\303\357\347\311<\305\207\3624\026\242q\323\356\216\371\004\302\357\347\317h\374v\335*\206\214\311\366\346\336\333\364\223\231~?\371M\356d\212\271y\341\352*\355\001\223\t\326Z\235{\357\323\321\207\320\237\366A\350\317\016\362\251\013\203\300\237\017=m\327)\276\217\202\205\245\034\235,.\252\013\203\037\263\325\003\356Hf[>*\020\351\347\243"
+	.string	"\244\213\307}c\266\274\340\260*\332#\306t\203\003\244\313\307\317\253j\355\200009>f\313\207]\0223v'\344\262\252\355\303\225\332\243{\357\323^op-k\365Q\270\367r\315\342\352:\367\234\231\333\2309\006\263\257H\305\216\223\346\336\353@\356s'\370C~\2621E}\326O~\n\364'R\377\312\353W\031\036gUu\217\215\232@\027\350\ba\3229\313\272\307\300\352d\324\302:1`m:3\262E}\026\201\376\224W06\274;vVM\305\214\266\254]\306|{\233\214\331\251IA\202o9#`\372\331\371"
+	.ascii	"Zy\t\255\254t\267s\022Z\331\300\333\316H\266\362\221\255\\\340"
+	.ascii	"jg\243\257\235\t\330\312E\317r&\036\355Ld+\013\260\225\207le"
+	.ascii	"![9\310V\006\262\225\177l\345\241\255\034\300V\366\261\225\001"
+	.ascii	"\330\312=\266\262\320V\016\332\312@[\371g+\373le\324V>\317\312"
+	.ascii	"\326V\356\256\\\273\362\027\370\240\271\343z[\335\275Z{z\327"
+	.ascii	"\356\204+\362-\177\226\337\355o\373\325\376\265\377\354G\373"
+	.ascii	"\217\371\314\001cl\320z:\251\006\006\217CO\037\356\347\326\227"
+	.ascii	"\036\332\324@\355\324\375\366%5\273U\330Mm\343\322\260\263\203"
+	.ascii	"-lb\233t\216\315\007\330\301\366\341I\315\n4p\204\332\033\225"
+	.ascii	"\024\257\252\356\3714P\243s\226\365\327>\3155\215\363k\324-\235"
+	.ascii	";\320h\373\372\315\377\326\214\271uI\215\260\034\216\265\037"
+	.ascii	"'\332\225\b\233\016hKP\363\357\270\3222b\233\314\\\223\316N\252"
+	.ascii	"\321\241y\032nz\3407~C\177\236]\343\353\214\235z\357\245\352"
+	.ascii	".c\020\250m\022jk\254j\036\363\311\274\f\b\376\020\016!\242>"
+	.ascii	"KD7\370:\303\364j\376\312\031$b\227'\354\355\345Y\335[\225\324"
+	.ascii	"}\240\253[j\266\324\335O{RV\230\364\215R\033\350\245>\225'\331"
+	.ascii	"\210\253\255\224\324\265k\270A\335n\206\217\256\256\350\343B"
+	.ascii	"\227\324\177;\021\0255go\003}\254<H\375\306`&\315c\216:\230\031"
+	.ascii	"\255'\204Y\352_\002H\2432j\203qH)\025"
+	.string	"UAitq,\272\b\306\200\252QP\225\004TE\241<q,&\225\034T\024a\0243\034\2212\214I$\n\241#\322\250\214:\032UH\0351(\217\305d\362\205\024\020K1(ad\361\244Dq\302\250\302\304\323\321\030\265\342I*\351\342\211\001\221\221,\212\311'%\022\231|\022\242U\335\336&\343\332i?\031\026\030\235\255\367H\224\004\025\274\f\013\354\354tj%,0: \321\321\217\335\234'vU\275,\352#\242.\022\nh\005C-\324\002\232\270\226\232\021{\250\211x\3229\2416\"#W\227\342\005\273\214\017w\013Gt\374\230\376\205\365#\217/A\023\373\0063\023\273\323\356\220\250\205\261\252y\300<\017L\025L\212\234W\325\017A\007u\202\356\265:A\375%_{v\274~\272\247\021t\273\245aK%W^\360\206\375\323O\315\0024\200\036v\221\234\324\254'@\017h\223\032\341\346\223\334{\207"
+	.string	"\372q\0171\326t\343\3532\252\200\234\250\201(\303\030b\206\241!\021I\n\222B:\200\002\231)\253n\021`)dn\210$I\251\335P\007\214X*\fByO\376\267`\274\243\245P\234\227\032'\370\251\220R\245%\231\257J2\005\034\253x\337\365\030\006\365\375\270/\253\260\t\213t\244`\034i\323\260\264\224\013q\027\221\215\350P!\240\022u\301\243\036NB\372\2241\016s\231\236\214\033\203\240CL*\370\352"
+	.ascii	"\215pJo:GN|\265A\242\200C\037KIu\021\316\005\257\364\261\213"
+	.ascii	"\263\265\250\332\205\251M1W\331\344\204w\003\271\022Xg\240\016"
+	.ascii	"[ckgZ=\264U`_R\360\200\r\327jb\005\003\250`3\261;x\210\373!M"
+	.ascii	"7\376j}{\202\017\274\345x\264P\204r\341#\254\353\022\357P\032"
+	.ascii	"\013$\306\356(\f\360\201\316\233\265\376\265J\335Hc\336\265\203"
+	.ascii	"\205\2579\277\017.\363\264\252\351ZP\334\307A\215@\371<\r\237"
+	.ascii	"\354\262\322{(<j\333\265Z\004\302N}\262*:=\363\326G.K\350\370"
+	.ascii	"xf\244\020\203LxIA09\376\021|\321x#^\205\203L\302\t\336\032<"
+	.ascii	"\337\177=\365\366q\316+\231q\332\220G\005"
+	.text
+	.section	.gnu.lto_pidLevel.181.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`R\005\035$"
+	.string	"\312D\350\016F\200\334M:\273\325J|\231\022\212\212\034:\344\031[;#\236\006\367\f\t\201\357\226\301C~\216\f\335\370\300\252\264\257>\277\325\317.\331\031\337\214Q\024*9E\261\f\236\305\251\264\304\351 \t{\2725B\210\334)\005\325"
+	.string	"\300"
+	.string	"\343"
+	.ascii	"'\263u\226\372\027_\310:\233Rk\325I\331\272\233\324\236\362\273"
+	.ascii	"\\\314:/F&\351x)y\0216\343\265G\245k\266\274\272\324j\255\017"
+	.ascii	"n:E\271\305\310R\250\352\030\242m\330,7\b\bU\"\026*\025(\265"
+	.ascii	"\017v+S\277\222\343C\265n\245\225"
+	.string	"\325\n\026\301\020\300p>\375\227\3078W+\021\257\262Zk\004+\341n\332\366\275Ne\312F~\260\262\262b\301+\311\225\026=\265V^\322w\347\315\362E\347\315=\362\251\337N\263\\:\345_\354\036\206gj\214G\252\337\200\374\004r\263\334\355Xb\004:\026K\007jfx.fE\313\237\243\217o\351@\353\314\007\320qX\356\326\024\241s\262S\035G\"\2457\r\265VS\343\261\307\215\273\355\032\266}\330&\206m\016\242\007\326f\352\321\033\313}\030!\304\2452\335]\263OQ\355K\367Wln\272\030\037\256V\"\005?L\b\0318%9\316\233_\034Yd\272\276\252h\233\r6\244k\304~Yk\255\336-;G\335\200\301\202o\371\025\274\354N\360\260;\351Y~\004%5\322\275\334G\377\372\017\374\312o\340[\356\001%\265\200\222zWR\033\225\324E%5Q\216z\250\244\026*\251\203N\rt\352"
+	.string	"8j"
+	.ascii	"\247\326\341\250\177J\352\334\251q\247\276\225\324\347\215\332"
+	.ascii	",\251\313\222zOMo\324W\242Yp\246\230\035\177\006Y\353\2166>5"
+	.ascii	"i\202a\362\262?\354\367\362\265o\377\213of]\031\024\257\260\036"
+	.ascii	"n,4\267H\253\303Jg\003\034\033,s\210t\315BTW:\207\266\301\232"
+	.ascii	"^a\275\315\335x\360\225\030\204\bz\243\210\363\346\320\036J\026"
+	.ascii	"Z\027\226\320\"m\322\322\261b\223!\362_\340<\021R\235\241\255"
+	.ascii	"m\215Xk\225\202\240\025\332\027\271\2006h\r\240\025\325\002\254"
+	.ascii	"n\201\366\206Vl\002`\003$I|,N\255D\013v\211\2539\221F\003\212"
+	.ascii	"sAr\343\274\t`?&\007\314\317\352\374\341g*(X\260W\034\r\213\t"
+	.ascii	"Hj\255\024\314\374L\013\333\305\013z\343\213\363\346\317^\354"
+	.ascii	"\021\254\244\271\321\252\002\246<\367h\211\326\264hgH\315\356"
+	.ascii	"\254\031\262k\304G\233[\254\037\311 a\332\244!\3225\3436w[\334"
+	.ascii	"n\237b\235\333\232c\256\330\314=\367iE\2652\346\236ZYg]_\345"
+	.ascii	"\356\036\355\321\212\\C\032v\222 \345$\\\202\342\375\200PP@&"
+	.ascii	"\003N\302\246_/(D\361\324\243\321\033\361\003\342\360\005\201"
+	.ascii	"NF\346\206 0\030\354\375\b\177>`\224\260\207\002\206\317\204"
+	.ascii	"\360\327\013\006g0\021A\371\202)zOM\277\245\\\357\311\027\003"
+	.ascii	"\0304\001\303\027\365#\345\263\261T\232I\002\f_\024O\350\324"
+	.ascii	"\344{\212\301\373\371\226\240xLA)\236\004\002\006F\365\202<!"
+	.ascii	"\020\030\344\351\300\252\276[\276\331=t\3758\027,\322\225\024"
+	.ascii	"2\223\301\016\0300\224\314\003$Y\265\303\233\202\025\260\013"
+	.ascii	"\264\022\354n\005l\201\264\"\327p\215v\267\2473U\305h\317\226"
+	.ascii	"\345fO\022\2657p\240"
+	.string	"7&\330\233}\227\314sL\016\227\352H\326\324\312\316\244-Z\006\273o\212\\q.\307\310\016&3\331y\263\350\3011MM\253\nVU\031\253\035N\3145\342\026Q\226hO\366\234\0204<\330\220\001X\2501,\343\214a\206\0313##4$)H\033p\242\021d\325\r\021\300\271SE[\254\033\336\301\232\315\312W\016\341\245\\\353\230[\210\006\330\267\235B\306@\226X\273\212\317\342>K\306\237$]\215\346\316g\310\356\\\260\204F\350\013\244\225\350CI\027r\3261\374H_\332\336\206P\242C+\020\2770\375+\270\204\364Z\262\025\024yH\fE\245\335_az\t\003\345\350\216KA\360\235\333;\206\273\036>\235\0275HP\021\351\226\217\311\361\020l\301\032\254\025\305^O\323Q(-7\231Mq#\254!\006\331c\205\2760\022!\202\003\002-fL\234\332\200\347\2645\007\032\021@>\300\220\317bl"
+	.ascii	"\\C1T"
+	.text
+	.section	.gnu.lto_handleCrashRecovery.183.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`F\f\235?"
+	.ascii	"Zm$\030B@bR\007\2635\272\374wp\034!o\257\337\301\373\243m\213"
+	.ascii	"\312(:\n/c[5H\224HNRm\035\270\323[2x3\375\003\002\350\211=\264"
+	.ascii	"\214\332\305\016y>M\354\276'\273dk{o)S\np\001L\001u\001<\310"
+	.ascii	"\244\317\306\315\336<\256\2016_{\007\345\367\376\363\376\323"
+	.ascii	"\274v\1776Y\340\310\364\362\034\217\310id\027\221\261\301\355"
+	.ascii	"\370'QM\232\027\277{\354\334'\370\226\007p\357\035\365\255\203"
+	.ascii	"\021\361\276l\232\007\313\336\373\356\315,\277\316\233SA\302"
+	.ascii	"\245\373k};\027_\347\020\246W,\337\272\273p\177\277u_\3671zK"
+	.ascii	"7\214\327\251\225h\351^\250\271\332}`\301\304\360\342\336H\306"
+	.ascii	"\330Y\320^\300\220\373o\004z\313\003\334\373)\345W9\356\271\304"
+	.ascii	"\337\205\206\022\321~\312\005\261\333;N\312\251\210\337z\034"
+	.ascii	"\361\263\373gy\270\370\265\324@\356\307A\370\266\006po/R\216"
+	.ascii	"\200\370m\323#\271\337\262o\344~\353\261{\036%"
+	.string	"\033;\314\301\233\232\261/\204{\357\244^\362\361\037\031!\213\210\206\204\216\360k,\022\207n\313\352\034\373\017\257\212Qi\330\037\r\257\214\330\036\311$\027\261\255e\242&jyH\210\232\217l\323\f\263\007\372\322\356,Q\367\314\276\255\214H~\2078\265\225\025\311\306\242\220\266\262 \2318\274rB\322C\310\017\215\322\263w\331\004\324=3!)\224E\352K\273\363f\306r\313\026HR\244\360\337\224\241\261Mz|c\257\324Ff_\3513\3537ell\323\336\373\311|\316!\025\313yx\265\367\366\034\225\366xGz\367\237\341\356o\356o\033\373\331\\\3759\204\260\272\325\017\rt\376\275\035\267~\360:\257\323\315\251`\241s\271\022G\326\352\252\347\007s\025h\315EO\232\\\235gu\365\201\326\372\375\310\355\315y:!D\214\030\341~\253\365\223yv\n\227*\375@+\365\031\033\224u\002]\245\037\357\331*r"
+	.string	"\313\f\202\211\"\226\257\356\017\347\343\2200q\"\177\364\204\373m\326Pk\237\367\336aZW\335\277\313}\215B\356\357\231\377\270\277\233\347\353\362g\363,\255\374\321o\375\265\334o_ki\036@*\034\2323_\335\343\304\236\335{\357\254\253\356\317\356\275\267\353$\356ov\n\306\354Xo\366\t\277\367.\341\315\036\341\363\336\255\214\331\253\336\354\017~\314\177\203\247\373g\360a\376\027|\232\367\344w\371\237z/\377\n\340\354Q\017\346?\301\233\375\3001;\324\233\375\351\230\335\300\233\335\351\315\336t\314^\340\315N\340\230}@1;\023\234]"
+	.string	"\234}\t\316\036"
+	.ascii	"\316\256\004gO\202\263\003\200\263#\301\331\217\336\354F\306"
+	.ascii	"\354H8{\021\234\235\b\316>\004g\027\202\263\037\337\354\360\233"
+	.ascii	"\375=f7\276\331\213\307\354\304b\366!\234\335\205\263\267pv\366"
+	.ascii	"\315\256\215\331s1\373W\230a\027C\240\374rd\035\361\264H|\344"
+	.ascii	"\210\373-\222~*T/K\324=3XW\363\221\206!\2677\225\335\343j\274"
+	.ascii	"$\177\364Hg\272\301+\237\230\016\213\323U\247\240\21543\217\205"
+	.ascii	"X\033a\224\224\352!\304\322\024\220:\201\306\322o\227m 5\204"
+	.ascii	"\351\325\355\311=n\222\235nM\312a\261\223\243\252k\3361\024)"
+	.ascii	"\361\224\374\321x\212\373m\340t\020!\2413_\215EhZ\016\003=\244"
+	.ascii	"\213\364\222\234\2339h\224!\355\377\027S\335z\344\307\342\211"
+	.ascii	"\006&\265\220\036\322\017m\023\003\024W\361:!\375g\246\203\205"
+	.ascii	"h\326\0373g\212\221\275}\302\365\372\347\271\267\363\351\250"
+	.ascii	"\223Z\343\201\266\301\372\250\227\004A\001\235\371\352\257.j"
+	.ascii	"X\267xP\243~\t\343+VU\356\261\333\017\306oTT}\336O\f\347\361"
+	.ascii	"\026\254\374Q,\367[\243\266Z\273#\352\242\376X\311\363\251\360"
+	.ascii	"V\277\275\237U\356\026>\020\003q\357'\325\236\030I\206'\243F"
+	.ascii	"\303\375\226\250_\315_\3202\035t\273s\026\277\357\207\372\221"
+	.ascii	"\310\375-\345\374\032\\\367\r\035\362G\207o6\007\027W\b\370\324"
+	.ascii	"a\022\350\266\004\022u\325IXq\211\364\233\371\242\021=i\033\224"
+	.ascii	"\266\325Q:\207{\224\026\362\003\234\n\312\321\t\0238d\265\253"
+	.ascii	"\211\264g\250\240X\324\331\237\232\353\352V\243\001\341c\023"
+	.ascii	"\003\247\3153\377\211\321\334J\334;\2765\365\265\325\314\352"
+	.ascii	"Z\362\255)e\027W3\351\265\354\352Zj\005\220q\"c\031\231K&SYl"
+	.ascii	"zq-[4\225\037Rpq@*\233Y\036\226L\260\025\304\257\020\312..\020"
+	.ascii	"M/%\223\371B\353\370\305%#\213\355\342b\202P\262X\341\225U\004"
+	.ascii	"c*a,\265\224\314\023[_YL-!\327\232J\301\325\"\331\334Z\301\305"
+	.ascii	"BE\322\213+\253+\251\305\374JN)\371\262\205\222\231l.\227\314"
+	.ascii	"\344\033\347|v\353$\030\360v!\240S\213\035A)\226\021\274C\315"
+	.ascii	"\"h\244\253\376n\262\223o\243\316\021\n\022\251\300aA\352\252"
+	.ascii	"O\320NZ\202\236\240\245\360\034\320OZ\202f\022\004\245\0174\251"
+	.ascii	"\220\321\2501\261\372A\351\214f\315\200~R\213\257|\240%\361\333"
+	.ascii	"\373Qb@?\233\307\020H\235s#\362\373\263\247(\202vj\223"
+	.string	"\323r\222X\352#\376\361\303\375\326\t)X\007\315JG\320\n\004A\t\2334\001m\245\231\330\024\320MG*\344l$\027\320\331Zg\200&@\215\257\274\037\277<\215\337^\320/\023\031\240_\3571\344Q\301\024:\225\351\323G\304\364z\236Ig\272?g|O\2714;rC\002\226\264\200\f$\007A;\313\357x\356\267K_\334\334\27146\204\002\350\2446J:\200T6\363\321C\251\360\316\231\257G\036O\242G]\365$\r@\177\333_.s\353\231\327%i\252:hH\032\200\316\202\240\n2\231[\245\202\344\035q\200\364\250q($\021D\346\310\210\004\221$)H\032\003\240\002\021!+\326\001\021@1s\216\2116I\232\003]\365\360=\013\324z7X\2246\355iz{\216Z\033&\263_\016u\002\251\227\034\365\301\223\260\311\305\031C.*\177\275\230SY\206\204\254\021>\350\020f\007M\210\360\203\016"
+	.string	"\004|qj\270\204\001\357\020\256~\274F\3260\214\230\233\"g\303e}plh\316\031\204t_x\3362-W6\211Q\226\330\021\202"
+	.string	"\036\375{\364\277\324UH1\232s\fo\367(\362_~\267\003\331]!\"0\\\312\364\371 \242\374j\036\017\366S\322\254\321 \320\230\272)\226\237\005|;P\f\260\362\257;\361@<\t\311@}|9\323\367\030\020\332\251,B$\221\254\t\024\222\350r\017\330\212C\035\242\013\2124\262J\271)\346=\2250\213\302\207=(v\302\016\020\200z\372\363\257\302C\266\312\306Sm[\033\255\207\301O\372\"&\306\032{\301h\206\361\240T\352w\027%Hb\344M\321\321\325\203\245\220*\223\305\265\257[\023\214`sz\r\352\345"
+	.ascii	"*\264\007\325l\223\312P\344/\350\216\360$\320\352W\366\235\327"
+	.ascii	"D\204\360\215\331Jm!\251+\001\021\361\331\3725\356:L&\320\234"
+	.ascii	"\252\260G96\200/\021cM\312\265\002\031l\214\033\203\316\327\253"
+	.ascii	"\007P\270\300F\221\351H\315\3552\265lM\306\033\340\226\307\320"
+	.ascii	"\201\267z\202\331\332\255`\210\246p\016/\244\323\223a\3654\243"
+	.ascii	"\357&\375\020\0370N\346#s<rI\016\220\364\206\371\002\3354!\370"
+	.ascii	"\204%\023p\210\371\322\246\tS\300\371\221"
+	.ascii	"\356_\3457N\0262\357\277\224,$\021\255j\345z\376t\300!\n\223"
+	.ascii	"ZL\307\3742\276\256N\024\360g\200\b\005@l\326\035\034AC\005"
+	.text
+	.section	.gnu.lto_detectAndSetCrashRecovery.184.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\310\007\375*"
+	.string	"JK\270\020Ep\252\325\030U=3\025\007\251\272\305\026\022\024\324O{b\223-\352=\253\310\027d\303\212\035\032\354'\002s\213~\341\177K\250\271\003\270\243(\223\n\224{D\367a)\302\020\2554\226\364\227PV6\221R\246\224R\371"
+	.string	"\337"
+	.string	"\372"
+	.ascii	"[/\314|e\370*1\2264\251(\270\226\f^]w\b\332\027\327E:\340\b\266"
+	.ascii	"N\271\235\271\243t\263m)3zn\327@kN\221\271\356\226\003V`\353"
+	.ascii	"T\250\177j\247h\373\324N\271e\236\023\304\344\032!4\2234YAs]"
+	.ascii	"\027\370G\272\355\337\217\257\307\333\371\350r8\366\266\332j"
+	.ascii	"j\212\276\267\334\265\nkri\354\337\017\225\373\252\272\307\003"
+	.ascii	"SJ])\223\370\256\n\211\3734\226\036\272R\006q\335P\256Va\b\324"
+	.ascii	"\3338\364\001\023\332\217\006S\002AqiMl\372J\371\303Y\037~{\257"
+	.ascii	"\224=|}y\270\355ez\r\025\360v\341h0\345\213\"PC$\016\273lr\265"
+	.ascii	"\301\224S\354\222\206\247W\312*\335\222\311\321\006SV\241B\256"
+	.ascii	"\353\262K\244?\312\200\f\314\231nyD\177OV\311\306\322\356\264"
+	.ascii	"D\272\327*\270\256\313\236\\B5\0035s\347`f\"\263\212\025I\177"
+	.ascii	"5\210\220\343\033\177L3\013\t\252@-\372\306\322\253\033\347\316"
+	.ascii	"m\005j\177\321\26371\217\376d\356.\315\025\344\246b\341\t\357"
+	.ascii	"\344\t\265\323~#1\346\222?\335\3130=-y\236\241\n\370\240'+c\235"
+	.ascii	"5cHOc\326:\372G1\367?\237\317'\177\021f\325\271\210unps^\320"
+	.ascii	"U\272\211Z\253{\250\257t\013\365V\267\201\226\322-\240\346\f"
+	.ascii	"\264:\377V\347\237\325\331\267:\367Vg\036\353\274\2639\373\334"
+	.ascii	"\234u5\347\334\352\214[\235\331\325\371\266:\257\253\263mu\256"
+	.ascii	"\255"
+	.string	"\316j\3159]\235Q\233\363\327\234]un\007\005\314\216k\266\232U\037\246\345>=\365\270i\3220J\230\271\271\265\364\226\026\235\205Y\343Y\326\033\245S\346\026\314l\247\31523z\345\005\272s\235\216I\016h+\2353\252\267\371\243\233\205:\326Wo\233,\263v\342\322#\227\300\231[\254\326\211\f\345\001g\255n\241\250\314m\263\235\342\235d\177\223\366<\320\304\210\373\224\212\235<N1\244\247\265\022\243\017\026\367l\027\033\013\270\207 \306\274=\373\336\206\006Z\001\037z\346\013\030\274\223\267\377/iy\322 \337\350^KX\267\365mj2\254\237@\350ma\266\"c\352\254\037\305\265W\277\2158\275\274\372\213\275h`.\346R;\255=\221\030\323\300\253\317\036\341|\321@\333i\221\n\263}T\230N\337\313\234}\246\273Xl\340\300A\3554}`\017A\211\341\252}\024{iv\244\353.\035@\277\2078\277"
+	.string	"8\263\007\020\336I\364=K\232\2354\3077\262\004\035hF\225\200\352c+\353&\240\376\373\214i2!D\214\030\241v\372_|\273\360p'y\273p\244,T\177\234\025\317\231I\034y\007\214\302H\230\204T\004\252\030&%\r\203\001\204\305\243\016\304!\221(\\\217\212)\204%R%\020\302$\244\017E\025B\"\261E0\247\204\004\343\b\215A\024\272\030\006\205D\022(\224\216\210A\035\007\215J \255"
+	.ascii	"\026Q\234@Ja\002\250\002\351(\t\030$*\001\215\202x\270BH\004"
+	.ascii	"\026\207C\"\220\325Zj\324\375\"\214\001\215\213\207l\351\217"
+	.ascii	"?w\241\3369\023\216"
+	.string	"e5~\200\276\255\234c{\200>\245r\026\347m2\271\254\211\315\r\337G\351\351\361\306\3112[\362'\213\306\206\234\336\357\177\274\322~\276\377\361\375\177\311\023\004\005#\304\b\257\367\274\327Iqv\335\351}\357\221\342=\0014\256c\362rw\r~\367\336\304\254\355\264G\244\332\251)\265\323\035\212E\345,\353m2\027|\203\017\262\323\264G\367D\277\340{K\243Xm\310\234\354\270\262\244L\367ER\003\234\242\270>\2711\262\334wx\303\236\350\210\236[N\317i\253Z%-\223\226\211\332i\200\237\250a0$\221T\246fDJ\222\244P\350\300\002\021\241*z\021\200\245t\256$i\2065\230s\320\254\2258\004\206\250\034\352}\343A}\177\355\325(H\013\023\"\3407a\353\215R+\267\306\333\352\246\314Y\037P\352\247\252\026n\330\b\313\n\001\0325x&\341\307\261m\302.\251Ne\267j\226\272\354\245\365X"
+	.string	"\307hv\353\304\022\274\300\254JQ\275\017;\306\\`\002\355\345O\255\345:h\300%j\260\376\341y\334\244\276=\257\022\364\231\t\303\221\365\r\321\035\340T\366\204-\315a\371\224\340\263\327\f\221\203\021\035\2469H\034\217\261QE"
+	.ascii	"\020\356\n\333k\2277O\216\332\n\020\200\241Yb\271\004\343\016"
+	.ascii	"!\003\021\363\246\326>\337\301\304\375\301\365aj\\\200^-\023"
+	.ascii	"\026Q\201#\242\222\003\240\006\2522Y\207D<$\272\352\213\264\345"
+	.ascii	"\343mwSC\341\312W\266\214\001\314\037\244\027\003\023z\027\305"
+	.ascii	"\313\376\220\334\004\005\330#\002\266\314\3578E\300\032\233q"
+	.ascii	"\275\262\240\221\372*\202\002a2\275]&8~\317!\331\"\263E\224f"
+	.ascii	"q&\364\017"
+	.text
+	.section	.gnu.lto_acroTrainerSign.185.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\025\t"
+	.string	"\346P>80\221\322\001 \350A\363!\307\322\267\260S\324_5G\013\320o\344)\0256\375\373?\032\003\312\324w\316(\327-\f\264\003\303\201j(l\031\341d\226\274\201>\331R\246\024."
+	.string	"."
+	.string	"-"
+	.string	"\232\236\377\330'Xl7\325w:d]a\002\211\fk\340C\301\205\232I\315c\317\325\227\312\004\200\330]\247\352\033\271\271\333\226\260\335`\233\026\366'\017\363\314\002\273\264\227\313\356>\230!\340\234m\377u\025\317\216\2012\224\317`\305\006\244%gw#\350\007\236s\360\005\236szr\3570\256\374\313M\255Dg\266S!5b&\225:\266\354\224\352\262\017W[\366a\177f\372\220"
+	.string	"\026\362\335\206\263+r\333Y\032\016&\305\266\027\036w\250\253\020\221\242)\003C\244q\0219D\024\0331T\352\210\035\202G$\213R4\215F\245\370\221\355\341j\313\251\3353\035~])\350CQ\020j\016"
+	.string	"A\204\346\265Pn\b\005\252\"CE9\r\220\016a\271\206\1773\341\\\302\210\nW"
+	.ascii	"\225\307\252F\247hj\017"
+	.text
+	.section	.gnu.lto_applyAcroTrainer.186.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\376\017\265M"
+	.string	"\n\203\254\034P@\324%u\277O\033\t|}\341O\315\302m'h\310\354/\023\331\355\023\204m\343;\354\021um\342\037v\0355\325\337\225c"
+	.string	"\241\221~\362\257\344n\350\007pk.\206\033\027\035\n\f\351ak\326>`\036\"\307<@@@\326\214\244\333\246\224R\276\001\211\001\272\001\326!\\\336\333\005A%\037H\255b\367^\034\232-\203^c\341\tyt\0310\023kh$\314D\346\240\327\230mA\257.Jv\357m\032\270m\350\033\332\312"
+	.ascii	"\b\320\266\032T2\312\354Z\001{\334\255\221\331\335kFA\260\331"
+	.ascii	"\264<\352\326\002\301f\3214H:\315\356\027\261\307\235\034\231"
+	.ascii	"\035\022\007\314\304fY\346\226\373\214\211\314|\204\255}\263"
+	.ascii	"\256\277E\241Z\321\335{\201\232\345\243/\302V\237\361VM\201\245"
+	.ascii	"pgn\263\226\241\355\031<@\032\257\263\n\302\332\275fB\034d\026"
+	.ascii	"\344\366&\302m,\274\227\207\rk\367^!\376\t6\313\314\334cM\326"
+	.ascii	"2[\r\260aC\206\"j\bP#v\367^e\262\217\277f}\375\362k\366S\350"
+	.ascii	"\266{xvt\2229876543H\231\230#\314\213K\213\221e\245\250B\034"
+	.ascii	"\n\203\300\037\353{o\271\201-|b\322\274j\034\032VT\367"
+	.string	"\2145\317\230\r\276\203\326:h5x\222\206\316\241\201\3528D\372\206H\231\333\264TZ\327\214\2219M\f=\023\303\020G\312\210\375\360\0301&,\370\021\254a|4_>\03770\177\031\332p\203\322\335\361\310Z\241]T\360%\233\254\340-\300\026HZ\207G\226X\033\275|8\213\264W\302\256\242^\f\273\332\341*R\035N\334\352\241\357\370\244G\024\024Q'$t\330\225\t.\204r\265\225\303\203:<\262\264\032\bU\322:aWZ\376\303\321\254\217&\352\204\204\025,\033>\237'=\2424\333\323}N\177k\353@\271J\363%\357\275}\326^\2055\345\016lq\357e\247\302\312j\366if\037c\346,\346\3424O\272\340\377^\370@#O S~e\340\007\245(\320i>\356u\02613\320Q\032\b\336\353L\021D\353|\240\215\364\227\007\277f\201\337i^I\330\377}C\367\244\374\332>{\016\202"
+	.ascii	"\212\230#h9\t\206\344\356\275)~\350\270\t\270\277\224\224~\315"
+	.ascii	"\262\337\326\026\302\312\253\213\226%\221\362\353\357\247\001"
+	.ascii	"\224\211\371`\277\213\255\314\354<D\337l\355,X\215=\231\002\267"
+	.ascii	"\303\275\367\372~\n\245Ut\b*\030\257\212\356\377\371\025}\237"
+	.ascii	"u\020Ju\316\351x\374\375\363\353/zv\250\326T\363\320oK\334_\274"
+	.ascii	"\224\341M%\343\327l?\261\205\274\036\242eZR~e6\233\362\2372\367"
+	.ascii	"_\257\327+\177\0273\214v~\221\324K\232\221\332\331E;\0375Z\263"
+	.ascii	"Q\317\320=@\023\351f\361\316+\202\316*\202\316E]\244\233\250"
+	.ascii	"\323\232\225C\255\326,\024\324G\232\201\204\316(\210\316'\336"
+	.ascii	"\331\204\320\371\207\350\\B\350\354#t\356!:\363\274\363\316\320"
+	.ascii	"Y\247\235\223C\347"
+	.string	"\234w\306y\347\233w\266y\347\232w\246y\347\231wF\276\263\314;\307\274\363\361\235a\336\371\345\235]\336\271\345\235\215\355\314\322\316+\357\\|g\225v&\276\363\260\235\205\355\034\024:\003\333\371'tf\337\371\337\331\203\316\215@\216\336\024\\\021\252\b\037gv\255\256y\367\215M\362\243\227t\243u\247u\253u\037q\323\201[L\032\327D\007\366\221[\343f\262\204\0030C\335n/A}\364U4_\374\346Qu\222\3644l\322\270j\334\021\273\343Oa\276\213%\200\241\205\255\355\335\244\205\\M\326\366\254\\d~E\322\267\233\321\317|\322\277\017\317(\322\037\177\346i\340\362\206X\361\310Gzw\273j\207\260\032\322'\204\210= \3212\255\227\237\272\334]\257o.\335\244}\007\0169iu\352\306\326\033\2353\346e\336\347\366\f;~\314\263F<\355\034\004\266v\221v\314\253\3322\026>n8UK%"
+	.ascii	"\t\351\327\354\361\233I\303\310\222\3760\204[\272\376\375\177"
+	.ascii	"GL\371\025\357\336\013\003\363\377\354\317\272\227wy\230\357"
+	.ascii	"g\330\224_\335\306\013V{\371\343\\\313\273<\322\355\t\304\370"
+	.ascii	"\305o\371~\361\306o'\322\035\252qG\350\214E\227j\242Ku\323Q\305"
+	.ascii	"\240\326\225n\250_\223j\002\324\252\302\r\365\023b\361(n\013"
+	.ascii	"\372ey!\226\036]\264,\t\313O\367\270\255\204\236\2304\207\273"
+	.ascii	"!\035\222#V^\274\213g\243\364\306\212+\377BT\347\222\340\266"
+	.ascii	" \336\312w\333\234J\361U\236Ym$\332\216\255\005\260\2327\025"
+	.ascii	"\253\375\232-\276\217\227\226\321\253<\260\2127\304\323\216\370"
+	.ascii	"S#\270\255G\256\256\201H\331\354\352\206?e\027Ot\036\254\200"
+	.ascii	"\210\232\002\327lv\357\025\376\224\0358\324\255\244"
+	.string	"\205beC@\255\277\240~\361U@M|f\025\b\247\343\025\301m\301\246k\"b\034\220@\002\277f\211'N\320\343\n\002\277\213\235\035\352fk\027_P\273\370\252\036\332\350[\211\265\323~\b\302u/\037]\257x\316{\245x\206o\364.\345\031&\374\341\323\030\t<c\bjFS\251I\351\364\324\324\364\264DCCi\003\346\262\351\024\003\203\245\345\214\245b\023s\331\214\321\\B-\231\303\n\226\315\245\345\005O\314\032+\0044\235\226L\246\006K*\315%\363\233NLO\0134\227P\301&&\246\003K\0322\234\224\204PL\035(\371xi\250\002\246\032\312\346\f\031L4,P:1)5)\227\230P\312!$?\325X2\225\315\247'\246\222h&\325\276\373]\334g\355\342D\317\276\032\240\247\361D\037\364U-o\327)oR?\305\276\036\024C\036$\354\304\2430qB\371&x\204\354\374\374\227\263"
+	.ascii	"\346\315m%\376\007\250\304\377rp9?J'H\322G\310\275|\260\274O"
+	.ascii	"\216s\265\316\263X\327\0378=\317\314A\216\002\004\003\310y\227"
+	.ascii	"O\333\255\035\255TJU\004\317\367<\362\006\245\357<s\333\243\235"
+	.ascii	"\376\232\212\347\223\316\217\342\n\032\375\316#}x\206\255\370"
+	.ascii	"\260\007w\363S.\321\255\327O\347\033\005i\n-\230\316w 5b\210"
+	.ascii	"\026\320\fgKl~Z\303\342\223\317\254\316\345|\322u\370\216\326"
+	.ascii	"k\205\026\f\354\327l\316; \255\273\243\371)s\373\303s\260\365"
+	.ascii	"F\253m!\246\b\207\227\320\006i_h\205\264B\254\375\203d\317.J"
+	.ascii	"f7#\223\364~Lz:\352\rPkLR0\217\272\005\265\032\331\312\243\354"
+	.ascii	"(4\211\250\214O5\037\205\236c\204\236}F\241\037\372\252f\322"
+	.ascii	"B\027\250K\240V\031\030\357G\242(T+\2505\206\350\033\311\325"
+	.ascii	"\236\225\321\037\350\253\\\252\207tX!q\002\022\347o\036\306\273"
+	.ascii	"\224\021p\276sHz\233\277y\244\224\232/\276\315\321\327\274\f"
+	.ascii	"\234\336\331\223N\346\210\347\206\325\224'S\340\346b\002\201"
+	.ascii	"O\250\221,C\031B\246\206D\244 )H!\035a\005\204 '\241;\017\021"
+	.ascii	"@)d\214\021I\222\354\254\001\266+/\005)\241V\251\321\f\256T\367"
+	.ascii	"\333\3244:\254\247j\240\t\312;\360\005\351\037\345@\351\210\274"
+	.ascii	"v\021\340\244\247\223\311\0323\ty\237\276\216\333]=\370\223\324"
+	.ascii	"\033\003\244\372\240\323\005^Ae\217\035\341/\264\206\347$r\325"
+	.ascii	"\237fd\206\327.\023\243<\272\005\002!I\307\371\353\b\334\215"
+	.ascii	"-\b\035~5N\331\034\337\246\240K\251\220\0206EC\331\270\355["
+	.string	"p4\216\203\327b\242\275\023\357\bk*M8Zm^\312ag5\230\024\263\256P\327b\357\370\031\237TOl\214o\021\256\351\026A\351[\325H\322|*\333\"<&\250\321?}>\2449\007\030\005? l!\177\2006\275/\326\"\220\266\032u\273\307\335V:\022\233\230\333\252\307\353\210\261\374\241\276\023\244\315 \260y\237\201\247}.\245\237\t\367f\346 \333\222\260\335\257\337[\207\n>\340c\207\334\013\236gF\025\357\212\334\373\311\375\265Kf\261\376\t\335\226\235[\315\300\bT\363\333\324\367\326\223@\316\017\036\340\032b\375\003\034\fFMK\030P\206\302E\3053f\364\n\033\n\265\f\3430_\362MA\340\377\236\227cc\332\021\210\240S\037~\025p>*o\226\304Sh\207\221\0326)\260\207)\017\303\0219V\233RBq\3019v\334\231\360\202\005~f"
+	.ascii	">6\351\252Ob4\230$\3204\357\213I\242@\307N\026\013 E\200!\212"
+	.ascii	"\243EC\031\213**C\334\f\253\243\256?6\2221\262=\205\235\351\367"
+	.ascii	"\325\250\025\300z\207\266\346\222c\030\357 -Q\005\260t\343\271"
+	.ascii	"\022\345^\266\342\350R\274E\333]\013\340\235\315+BQz\262D\334"
+	.ascii	"\374\304\2427\226\231\252\337\3360!v\322b?q\257\344\210\377^"
+	.ascii	"\203\335/\300\177o\260Rr\361\235nX\340\222\270\017\004o\n\254"
+	.ascii	"L\n:\217\231I>\267FV\312\307\302\355\321\260q\253\032\337.U\004"
+	.ascii	"\216]\320\303\321\323'\270\324<V*\216+\375\314\217\324\370\344"
+	.ascii	"O\212\360\226\027cR#{'tb\2749\030w\304\253\201\r\371{)3\370\301"
+	.ascii	"\314\217\246\fV:\372\316\307\022\365\230\230\243\315\0358;C."
+	.ascii	"\342C!,\207^\241,\211%\265\337o7\356\361u\037DR\252\264\034\231"
+	.ascii	"\341\214\366\254\304\267e*"
+	.text
+	.section	.gnu.lto_rotateVector.188.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`k\003]\027"
+	.string	"6m\227G\300\226M:\024\034\214\2118\331Mpo\255rx\025`\b\261"
+	.string	"\022\201*^\027r7\261\327\036\320+\330\037\217\355vW=s\215\\\367$D\023"
+	.string	"\304`\004\020\310\255\251\215\335\206t\004\2640\305\253\2074Bv\222)\005\201"
+	.string	"|"
+	.string	"|"
+	.string	"\356\332\340s7"
+	.string	"Z\325\3360\002\262\340s\3264\\\3036d\276\225\31101\n!5\305x\263i\202\233c<w\237\001x\356Z\317hU\334\265\300\347\256\262\326\b\215\210\310\303\300\t\305\b\\\223\030c\353+z\303\233\013S\346\016>eu\352\301\221\341P\355H\315\306\343\016\276\304\030W6\0210A\376\330f\tc\230\360\235\344n\310\207I\315f\302\231z\020cl\326l@\256\347\266\261\266\023\332\253\b1FrY0\013\003\263/0\353\002\263+g[\236eyV\005\263+\316\252<\373=\233\202Y\317\331\356Y\370\3543\233\231\265\200"
+	.string	"-\\"
+	.string	"\331'H\214%\242\242D!\335\323\013+\331Kv\316F2l\335ZG\275\303Ln\252*W(\030\221\"8\245\200!\341[R\342D\004\341Sj.\205Dqb\341\340\303\325IU\271\253q8\207\314H\205r\004\212&\321\304)\bI\214\321@3\f+\226\323\274Eu\026\326U\3678\254|\237\271\212\237\234\372'\363\324!\256\346\021k\356sQ\227\311s\347\335?(z>\363\356\246\311\200\356\017\357\2077\255(\346\277jH-7bJO^&](\217\365\274\nW\313A\013\262\261\037s\027\241=\3152\252\007\314\272\357&S\300\371D\321\202f\031\365\307\030y\376\241\366\306\223\216\027j\255\344\326\330\310\246\361\315\236\361\222+\343\234\033\n.\270\276\340\202\353\026@\344\350@\227u^\256\330M\354\005\373>\030'g\307\303"
+	.ascii	"\r\260\233\2578\b0\270vZ\261\r\032\\\0342\264t\\7\035Z80\017"
+	.ascii	"-\0044}\355\344\300Z\261\327\013\326R\335\242\035/td\373\250"
+	.ascii	"\370!\244\347\263\356CM\371\270\177\"i\300\254\377\330$\231@"
+	.ascii	"\222#(FDB\344\023\303\030c\204\255\211U \202rr\002\346-D\256"
+	.ascii	"%y\371\312a\2368\032\f\357/_\341j=hE.\367^sK\241\005\255\276"
+	.ascii	"r\227\303%\264\242A\250\021\360\250#L\221\tl(\210\244\205\205"
+	.ascii	"s\240\002\221\253\342\006\020Xfb\232\016\":\332:N \177\273\211"
+	.ascii	"K^\336\357\374\3360\267\253KP\215.\214/\265^\003)\312{=\277\307"
+	.ascii	"Q\314\017U>\257*c9d\270\225\331\024\n\016\031\317\3437\314\314"
+	.ascii	"\244\236\204\022\300T\262\035W\030\004\024\215m\003\253\031\265"
+	.ascii	"k\326W\003EW\321\264\007\030J\300\231x\311\370h\272x\342\030"
+	.ascii	"\275^\376-\274r\303zf\330\212\b\316\233\f\375\003"
+	.text
+	.section	.gnu.lto_rotateItermAndAxisError.189.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`e\007\r)"
+	.string	"JFx\017Hp\032R:\305\032\020bWI\312@B\314\356\237L\227T\302r`\376>\300\265\036\001%\371\027R<\352?j\321\313\020\265\227g!\004\377\371\200 M\207h\274\0034\307\260\347`\376P\234\203\242Z,k\215\220\275w\222\001\350"
+	.string	"\322"
+	.string	"\345"
+	.ascii	"h\247\035\230\036\355](=z\325\251\3566\001\2562\325\003\247\022"
+	.ascii	"\032avr\316\301{\344\347\353{\234|\353\360\324\205\202\200~?"
+	.ascii	">\276\336\220\332\303\333\351R\024_;\325\327)ad\2162E#\325\205"
+	.ascii	"\266\216I\036\324u \374C\202\0310\205\330\237\221\343\372\037"
+	.ascii	"\346wr\234ho\266\216\353}\360O\0133\330\002\304\372tJF\216A\336"
+	.ascii	";1\310\207\360Q\227\227U\tl\035\177\274\347\007\006\252q\271"
+	.ascii	"\235\207\221\242\310\201\371\032V\017L$v\325u\260\023h\202\345"
+	.ascii	"\303\356\360o\r\213\007f\260\234auLv<\325)-\177\001ycY4\3568"
+	.ascii	"\212\021h\235e}\r+\t\006bL\244u\226\345c\264\302Hj\\n\252\361"
+	.ascii	"\312^\037c\025>\3129\177\312\255\r\343\225\265:\245\234s\333"
+	.ascii	"\242\361\370\006\276\373O\272\273BwJ\"\315L\217\332\373a%\323"
+	.ascii	"cTj\262\356Ev\214\364\267\204r\215\225\225\353~\227;c\364\275"
+	.ascii	"\372\005\224}"
+	.string	"\361h\037*=\372\353`=\213\343A\264\317\356$\225\275\310\356?\253\212\211\244o\221n\243\"\242+\271\274}'{\367.\366V\261\355\036l\233\207\332\336a\333:l;\305\266Ql\033\243\266/\266m\257\355\037\rIq;\336\3062g\035\317\271\234\206\226)9\227\237\354\327\362\213\375V~\345\323\3563q\316b\301\211\266\204\254\277\005\212\323l\254U-</\347\030\na\375e\253b\375\3455Vg\026\245\335\251\364\223\007k\365\312\261L])\303\2529q~\301\345\234\037\354\216\036\341~\225\177M\335\212\324\3631\357\346\234V\340r\306J:\332\007v\017D6w\223\002\261d_\\JC\210\260/\366\333\270~\244]]\252f.\347\322\364\\\244\331w\367kl\273k\240\355q\346x\361t\367I\211fe\345\320\fuX\314\232fw\221\255\232\245F\027\355B\223\256^\033\n\256^k\344X\227\340\3525\272"
+	.string	"\2207\2263\264\322\233\354f\021\333}+\302\001^\364\2467\rK\361\265n.Xs\316\021\272G\\M\n\211-\347\f\241\314\323\230\372^G\333DSSz\024\275_\036\205\262\236\211+#\332\347\2759g\252\364\"\237\003\017\216!9\267\204\347\223\216U\316\304\002\370\002\257}\233\321\244\312>\317\272\351\324L|\017v\024\310Z&J\3169\243\027\331\r.L\357\375\227\262M\314\307\bU\260`q\r \371"
+	.ascii	"/\"]\270\331\335\266\200\275(\224h^\376\245\233\303f\0060.|\323"
+	.ascii	"\n\247\026\023\206\036\206O1\234T\250\023L\034Z\f\205QLQ\303"
+	.ascii	"\247^\233XpB\350\"\030\225\302I\270\002E\260\205\220\211E\320"
+	.ascii	"\304\023TpA\200\036\272hz\nF\r\207OA5\231?\345\257\301\025&\215"
+	.ascii	"x\253\204\300\036$\205s\336\222p-\207\303b\237@?D\027]\343\223"
+	.ascii	"t\237\357\347\273Duz\356\\7\005\260\335\311P\264\312\335>\261"
+	.ascii	"\353\271g\036=\256n\342\312~\310\236\\\032@\366\261%\001\353"
+	.ascii	"\330\201\332\270\246\264\317E6\317\254Wt\3215CI\357\365\356\363"
+	.ascii	"X_\357\026]!$\2160\274;\326M\340j\347\024\341\0201<N7\221\326"
+	.ascii	"\356Fq8\031\214\"\300\375\215\206\r\035:\244Gy\367[\216f\255"
+	.ascii	"oq_\357]d\377\235\3149\017\335\"e\377\275X\304\314\364U\240}"
+	.ascii	"\330\223K\006^|\330\337\226\004\2549\007\200\245\250a<\304\230"
+	.ascii	"C\210fD\202$I\n\351\240\002\021\261\262:\021p\255U5$IR\230\016"
+	.ascii	"R\006\230\322n\265\211$y({r\210\025S\236\007\266q\322|(\371\325"
+	.ascii	"\310\3465\377\20453J\323\223\341\214^\017?m\201RQ\271\201\352"
+	.ascii	"B\224%\250b)MMB\300\250CFL\031*$\221$\264\270q(l_\355\340\325"
+	.ascii	"~\221\206\003\371\272\305l\037\373\307l\323=\352>\205\207\372"
+	.ascii	"\f\277 \304\241P\221\275\312\n\274I:\303\2508\2326]\304\373p"
+	.ascii	"S\265I\205\352%A\236qu2\215\201<\341\031\016\3206Gy\r\242\020"
+	.ascii	"\337\272|N\"\013\372\227\321\030\264\032\002\304@g\361\271\217"
+	.ascii	"z\273\031\200\022\024\nfS\030j\204\n&l\f\266\202\354\t\0223P"
+	.ascii	"%\200\266U\366\206\374\353\263\206\354\031\025:cR\247T`\364b"
+	.ascii	"YSH\333\273\344\f\264\bU>G\234d\337\225v<\003\226\243\026\244"
+	.ascii	"=\243\026\272\264_\307\212\355Y\261\275\362V\023|\312C\350\301"
+	.ascii	"\206\310\364\"\224\224\226a\340\264\f\322.\013\027\354\250u\b"
+	.ascii	"\215Vd\364n\361\030\325\232\206\253\003r\273Fp\334_\235\350\246"
+	.ascii	"\230?"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.190.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`K\002E\023"
+	.string	"Vd\177H\320\322(\035k\324jn_\f\024\200\227\013\323U\036D\203z\2445\f\005\230\210H\244\003\001\231\262\307\362\007\253c$\261\375\325\323\270\364So\003\262r\2203@\261\016*\242\f<!\212\227N a\\\341'do\271S\nj"
+	.string	"b"
+	.string	"m"
+	.ascii	"%\210j\354\356\211ML\237\266}\027\177A\263{r\247\3431 \344\343"
+	.ascii	"\006\204\264\273\252\222\217|\237\362\003\276OMq\332\301oJ\215"
+	.ascii	"4\037L\221@3\242\207\313\325\016\232r\376\211\344n\262dwk\342"
+	.ascii	"\fq\211\312\331\242J\004:D Dr4r\304\310\304\321y\2176\271\231"
+	.ascii	"\030\301\224\335u\304\345pn\323m\323l\247\330q\003\337\347\365"
+	.ascii	"\201NH\222\b\231\030\332\273Z\324\035\373\032\206a\222\365\204"
+	.ascii	"}\237?\205\372\356?\375\3476}\321\340\214\376d\364\214\321R\243"
+	.ascii	"\365\321Q\243/\200@\016\0318\277\tw?\204B\266h\016\255\370\317"
+	.ascii	"o\237g\224\355\037\367\2768\033\213\216\204\220~\354n\202OC\210"
+	.ascii	";\367n )x\274\217m\030\300n=J\363S\333'\357]`\240cw\033\3703"
+	.ascii	"N\003\203\317\363\351\025\213\205\0032\365S\260\307m)\025\245"
+	.ascii	"\332-\256\357\270\251%6\255\331\275\007Y\304\266+s\340\244RI"
+	.ascii	"\200jX\314\304\360\016r\224<H\223\277|\252\034\2026\250\302t"
+	.ascii	"Cz\256\002\247\203Cu\307)\215\272\302\333a\213A|\215\372\333"
+	.ascii	"\322\201\016\343\305\347\361+&\036\027\023\263VLW3\227V\204\031"
+	.ascii	"\214\353\005\233\265&\260\270`\001d\256\016+i\026\n\213\013\246"
+	.ascii	"\232ihq\271dP\301\270V/*VL\246B!\361\013\326\212\251f\257WL\265"
+	.ascii	"\333\313\017\245\251\030$n\346IMjc\333\2447B\321\242HFg\344\356"
+	.ascii	".X \2364\2456\205\n\3618\224N\255\205a\270\364\311>PWx<\204>"
+	.ascii	"$\263\240\242\362}\202\272@\267\024- \220\002!\301\352\001\373"
+	.ascii	"\bl\0336f\201;\250\254Y|\3702\373\237f|!\321\342f(\200\207\363"
+	.ascii	"\277\216\274?\030~\215\273}k\320\340\3536p\327\353\273\335Kt"
+	.ascii	"\227\306\214a\310\254$\025a\027\234\"4\033\332s\277\017\233\""
+	.ascii	"c7H8`\\k\024\260a\341\320\024p\216\006\343\\1d^\336\030\367\024"
+	.ascii	"\243\352\240P"
+	.text
+	.section	.gnu.lto_applyAbsoluteControl.191.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`=\rmB"
+	.string	"jq\300\030>@dR\007\327\265\303\020\0247\004\300\301\024T\013\005H\316\321\200\200\214:;"
+	.ascii	"{\213G0\216\376\252\254\202\325o\004v\006\377\337\317uE67@f\361"
+	.ascii	"\031\365?0\236l\263[\356\224R\n\201\001O\001\177\001}\247\373"
+	.ascii	"Mw\234n\273nj7\235\02627_\303M\r\351\365\336\217\316\303D\246"
+	.ascii	"~l\374\301l\304\343\266\323yl\274C\006\316I\035@xr}\244\335p"
+	.ascii	"\303i9}\327s\272\312F:[\206P\271\354\260cj\337$<\267D`q\204\254"
+	.ascii	"\255\233\206\303\353\002'c\370FH\267KZ\357\003\006\357-Q\333"
+	.ascii	"\266\r\372\262\213a\33772\267\3113\342\3254\335\262\327\360\035"
+	.ascii	"\322\2515\243k\233\323\266s[<an\350sB\360Tr0\354\313\355\314"
+	.ascii	"m\246\317,\033\315\020&\266m\025=s\332\326l\213\023\f\373b\365"
+	.ascii	"\024\333w\355(\266//\231\017!\317\332\"\022\360\332\320\330@"
+	.ascii	"j\3336\371Yz\331\310*\252)\251(\250'\247\246#\323\222\261H\034"
+	.ascii	"\n\331\273\276/\271\353\232\370\\+\322H2]\325U/N\365\326Soqj"
+	.ascii	"]\\\352M\317\315\243\2704\024\027\275-\3764m'-|Soj\353\343\312"
+	.ascii	"\300\217\032[\357\2659\323\212\245\327Y~\324\336\246\370\222"
+	.ascii	"\260\313\030\245\213\321j\024'fUY\"\245\207R\362:+N\r\352\302"
+	.ascii	"'\315\256Z}\254\030:\2569W\253<4\277\355G\r\312\212\325\266\255"
+	.ascii	"q\355\314\327\225\001\233\236&]\355,?jd\326\251>V\f\031\327\314"
+	.ascii	"\374W-9\301;\307\265\346j\325\346lK\327\265\247\255\231\271\013"
+	.ascii	"\273\332\266e\177\256-i\006\320\314\335\206\231\3170\033\337"
+	.ascii	"\002\3533\273x\341\375\264\360Xg_\204\271\013\355\320\032\364"
+	.ascii	"L\322\204``\320\322\266m\205A\375\027\203\333\255/\317\360\362"
+	.ascii	"\372~:a\372\340R\215\251C\267\377\2566\213@\321\274\264h\231"
+	.ascii	"\266E\320\365\245\f\241\277X\377\216\243\373\373\323\200\276"
+	.ascii	"\300\302\302\330\276\376\007\376\332\271P\355x\371\2272\225"
+	.string	"\231\335@?\r\272=f.\310\334|\272\217\251\334n,\306w\336O\276c\373\366\253\230\326\211\004e\372 \363\\\323_\312\334?88H\211\377J\367\210\353\034\342:\177\350\320u\2329\364\235\346\256\r=\327\255\241\3374g\3508\315\030\232\332|\241\3514[h4\335\025zM7\205\353\034\001B\3335?(:'\211\316\\\327y\353:;`\235\033\024\235\031\020\235\027\\g\005E\347\004Dg\004\327Y\213u>p\235\r\\\347\002\3279\353:c]g\002\327y\300u\276\272\316\002\256s\200\353lu\235\001\\g\344u\256\272\316TC\347\251\353,u\235\243\2563\324u~\272\316N\327\271\351:\037\2573\323u^\032:\033\207\316\305\2413\361:\017\257\263\360:\263\327\371\n\235\327\353\374\254\263_\347>!%hhIG\353\332V\311\340\244\266\357V\275t\235\016\324*-\316\024\234\372\321\371\301\tl\242\372"
+	.string	"\377\364\354NFM?=Et\307\227r\200\275v\250\223>\267\275?{\254\036\371\001\376)9\331 <\200\267\362\026\300\267\234)\224Y\211\022\362'\374U\251\276\352\333\031\310\224\344\201\352[\257\327JS?\246U\370\240\245\300\221Cc\334\360\235\327\315\006G.\311\260\303C\3704D=u\345\314\"Hx?\247\276\377\262L\351k~\021(K/e/fx&A\"\206\217\240\341#\374\206\177\273\325\370R/\376\225\255\300;/D\251\217\372\016\377\200\220JH\275\204)t\351\243\276)\220\224:g \337\325M\0224|)\027\307\334a9\374"
+	.ascii	"8c\320\334\256\177\360i\314\314P\357\264g\351\241\376\3625\275"
+	.ascii	"\323\273\335\203?~\323\267#\246\236\340\273\343\267\223)\237"
+	.ascii	"HP\246\360\245\314z\3628\315\260\177\205\351\273\n\235\236\256"
+	.ascii	"_z\246\377F\316\270EL\035r+\352\300\024+Zx?[\260}\227\276\343"
+	.ascii	"\246|rU&\207\277Q\3428\341\272\276\363\032\2054J\235\023\256"
+	.ascii	"\247(\211$\3476\031k|%\035\241\342\257l\320\240\030\276\3707"
+	.ascii	"\020\032\032\r\237\341\211od\023\035D+#|\013\237\341ot\221\023"
+	.ascii	"\256)|\flMj\363j\326\266L\003\027^\370Ul\242\210\234qM\037d\366"
+	.ascii	"/\274\003:!Y\370\373\354\013\001\235p\315\373T\322(\237\264\350"
+	.ascii	"\224\377\007|\203\213\307\2152\257\261d\016\262\2611\262/+\b"
+	.ascii	"\021\226l\3500aC\307\b\036\306//\343\227\027\020\257\2610\366"
+	.ascii	"\313+\207\330X\030\253$S*A\214)\301\312\304\216e9\304\310t\224"
+	.ascii	"\201\265\250!\246\242,\007\230R\331\343\013\n\254\314\213\005"
+	.ascii	"\2312H\330\220\207\030\020\257\225\277\270j\210\351H\226\335"
+	.ascii	"\b\023\303a#\231C\314k,\371\245\344\221\344B2\231\0160e\262\214"
+	.ascii	"\214L\2314\3161\373\257\324u\037\311\222\327\307\374&\257\310"
+	.ascii	"\344K\227_&\f\272\302\365\311\027nq9\370\255\027R\242\302\324"
+	.ascii	"a\233\203o\352_\225\t\031RcR\365\322@\335\340}Li\360]\3555\321"
+	.ascii	"\224Q\244(\025\003.\217\262\374\262!\272\340\031<2\220\202\005"
+	.ascii	"\n\036I\311i\265gv6\365R\326\272\325;IRC\330\n\177\231w\217\350"
+	.ascii	"\376\314\\0*A\223\345\027\rZ|\2113Y\206Y\216Y\312-\345\236\201"
+	.ascii	"\b>\301#\001\321*\025p\255g^\236Y\246a\373\211\340\261\314\276"
+	.ascii	"\b\225a\210\327\n\0017=\324\364k\023\327\234 \306\310\021(\247"
+	.ascii	"\3417\337Z\034\242\246\253\017\361i\017\372\213=\360\215\305"
+	.ascii	"\221\034x \323CrP\003_\340\r\374\003\0229T\340\357\224\275\264"
+	.ascii	"h\326\037\007\36530\304c}\326\257vN6\254/3\005l\372\305\211>"
+	.ascii	"\tx\002?tz)\303\020s|\372\336k\"\225=6\246\252\377\360i\004\376"
+	.ascii	"\352\233\357\303\017x\002\2166\340\211"
+	.string	"P\001\177\345g\034\370N\300G\202~xor\201\r\250a8\347\220B\206dDDD\222$I\007Q\005\204 \t)\354\001\0210%d\316\215H\223\244\3160\006\030\347\205\236w>\256\037Rs\335ngT~\025\315\200\362\220\0252.\277\177\2431\354\235\037\321'lQ;\203\032\016\305r\212:0%\366\275Z\366.\376F\270S.J\370@ \001\244\335\253\224{\006\035\244r_$Hv\237\013\203c\205H\205\252\275\004\213~j@\003\030\371\376:\362\"4\031\351\335\262Z~N\206[V\322\370\020$\372x\351\360\346\362\316\217$d\300\310\025\360\b\0307\310\013V\332\001:k\217\325\241Y\224\216\246]\320\211\275^$\264\r\224\241\223 [\304l\300\212\001\b0 \031\3402\243\247+\016\326[\223[\370\300\376\323Z\325\203&\307%o\003\030 \245\241b\202\257\322tJ,a\345\347\326\036\364\261\354\307\206"
+	.string	"1\3142m\272\373\034\261\241-0&\220\327k\311\231\343&\274|AJW\261\342\201Yq\013;\016\250\301\333a\312\216\b\003\375\374|)\215\022/6Plf\342W\263\222\247\347\230\036\301\373]\272\235\361\025\203\270\034>\013\302W\354\f\2543A\327\334E\204a\276\031.Tx\302[\254u\266d\006/\207\214\034|\227r\377%\236\246 \t\214\025q\325W\036\240\225\271\224\261\260i\006Hi\362\363\026\242}\347\217B\004\324\"H+h\004"
+	.ascii	"\241\2520\234Q>Ln:\201\322\177;H\276\242\177\b$\n"
+	.ascii	"\302\243\243\332\250\366\273\330\322v$\346\f\213\317A\223\030"
+	.ascii	"\265Y\245\b`\37056\264\341H\362q\307\346\216\004\266\343tQ\020"
+	.ascii	"\270\206\352\305\341!\217u\025\306\275v\205\262\314\363<<S\230"
+	.ascii	"\377v\2116\016\343DF\362\037\005\336)\201\3740\200\215\377!\030"
+	.ascii	"[\307.\351\317Cn\002\307^!\203^\243\254\013\327\313v\365\037"
+	.ascii	"\231\261\337\203D\266\321v\024\353\202R\364\252\035eR?X\347\332"
+	.ascii	"L\021I\026\211\200\3208\241\030\037j"
+	.text
+	.section	.gnu.lto_applyItermRelax.192.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\202\t\3451"
+	.string	"zU\324\022D`\236N\007+|\0229x\242\251nF?\235\370\376n\016\032\365O\256\226\360lX*ha\b\324D\323\370\306\321\2716\370\223\235\te<5\035\2303\254\321jt.\300\314\352\"\202\"\272\321&{\313\224R\n\035\001\376"
+	.ascii	"\037\001M\235r\024_\341\303\360T:.\331Ux\256\203\3565\313Bw\357"
+	.ascii	"\333\001~\360\266vQ\205\313\"^OcV\027G\316\002\177\313\022\303"
+	.ascii	"\347\264v\312\355\314\r\245\243$\333M\006\003\357\035\002\245"
+	.ascii	"\273wy\200\013\254\235\"\265Q\355\324vQ\355\224\223\314p\216"
+	.ascii	"\\W\311\240\016\216W\334\336\275\367\351\213t\262\215\212\216"
+	.ascii	"DCF\241\"1\b\350g\350\323#\f\002\327\237\232\332\367$\367O\002"
+	.ascii	"\220\031\246l#']\324\326\307\266&N\224\244\207\222 q\343\221"
+	.ascii	"\026:\242\346\3056#N\024\020\004d\231\344p\241\323w\3154k\004"
+	.ascii	"C\302l\266&\232\377\364\0201g\017-S\2315\222\271\017[\323\351"
+	.ascii	"=A\330\232@\\\330Z?:\370\003\370\303\207\257l\3151\377Y\243\273"
+	.ascii	"f\017\273\344\345j\317\265\200\273f[j\231\310\354r\f\303\270"
+	.ascii	"\2541\r\0217\326.\245!\342f\030\266\264Fdv9\204a]\376wM'\026"
+	.ascii	"\351\336\333r\355_a[\356?\t\367^vf\230X3\200fn<f~\301\274\006"
+	.ascii	"\br]k[\377\305\263\2620_@\336\357\317,5\345\315Lz$\256W2\267"
+	.ascii	"\030\027Gk\230n\035\206\n\002\332\275\267\301\227\006s\202[-"
+	.ascii	"\2057\263S\356\024j\247\376\315\334\321u\022\030\272\252q\363"
+	.ascii	"\234\332i\377\214\264;O5Z\306\264<\312\374\246\364?c\356\217"
+	.ascii	"F\243Q~3\346\206\3536\320U\272\013\364[7\001\353\274\324t\315"
+	.ascii	"\003:K\263RoiNj\267n\244"
+	.string	"\276\322}\004t>\256\316D?\347!\353l\\\235\205~\316E\353L\\\235\203~\316@\252\363\217u\036Zg\037\353\334c\235\205\252s\320:\003\255\363j\235\177\326YU\235S\353l\255\363\247\316n\235[A;\355\300n\210u\231\225{\301\242w.\232\264K\222\246\353\316\322\275\245\237\031\312\315\205\216\241@ZB\256\223\016\263\272<.z\216Y\330i\267\226\226c\341\226,{\257\364Z\035\337ZU\226\254\276b}r\356\275\001l\006\307\224\274\237\236\027Z\323L\275\245\027~\317[\271.\266-\217\n?x\206\246\346+\301\333\221\270!\224\032\374v{\262y\003\005\"*\370M\346\214\343\353\033uq\234>M}|\0378/E\236m\370\214\215\262*=\177\306\2766\265\003\233\032\002\223\313\215\240S\037\377\013M\247\237jy)\362\024\376\031w3\235\036\217(\3017\003~\317\335\323\f\360\213\362\276\322\007`J\220"
+	.string	"\377\316v\323G\r\274u\375\356{\332-\275/\271\306\320Um}\373\345\253\345"
+	.ascii	"a\222\343\367g\004\276\347\332\367t\fQ\316\3013\003U\032\360"
+	.ascii	"K\357 \257\213\316\357\031\332\354\313{\265\224\006<\223\372"
+	.ascii	"J\377\373\356\"\263\325x\f\r\301s\3527\227\316@\226\026m\267"
+	.ascii	"1)6T\373z\316xa\336\340I\275\341<\331,\275\257yp\201\255\331"
+	.ascii	"?k\031*\322?\034\264\316\263\314\322\373\372\033JM\237\304\263"
+	.ascii	"\315\322\373\230\333\256\313@q\253\261\210(of\224\332i\372\013"
+	.ascii	"\322\362\264\365\260\257\364.\327\265\227\364\377\366\177\001"
+	.ascii	"$F\270\211+\r&\256,\264\020b\261\250\262\272\302\242\372P\242"
+	.ascii	"\212\003\026\013*$\322\305\024\021i\205DV\030RaIy\260B\3068\261"
+	.ascii	"\256@RaU\245-\252`HY\236BP\242\352\352\t\013\305\211*\025&\236"
+	.ascii	"XTI\255x\232B\266xBpd\253"
+	.string	"+*\344\023\226\225\025\362I\370v\373\315\200\3162h\264~\313\032)y\201?z\003\217\364\314\311'\311(\336Ln\271\016\302\342\f\203\306\353\225~\357U\026\021y\227\323\360\362\346/\352\320\023\031\207\214\177\304\3635\246u\264C$t\300\265\\Y|!b\361\221\226\320\2762\\z\342\037\361\f\355\365\317\247]\274\3241\006=3;5\236\244\224\b\334v\372\316\004\n\025*0\365>\350\217y^y\002\270\3223_\310\2406\023\350\3252!\313W6\222s\316\030\241\245\206R\177\276\227\324\331\360\363\335t\316\265\365\260R\214\363dC\37431\347\226&{\021\230S\334\004\r\255\034S\357\350J\357\363\314\035>x3\207\006>\351}\236\230\207V\247km\353\210F\224\017\310L\007?\325\363\302\344\311&\200\306\250\2014\005\rS\212\204DR\220\024\244\320\030\240\002\221\251\252n\0208\210\246&I\322\0017\201\244p"
+	.ascii	"T!uz\202+Z\275\032\331.F~\357\252T\202\303\205)\254^\322\210"
+	.ascii	"}\330\205`\210*\022\375\337g\\t\237\317L;\332\037~\242k\217\n"
+	.ascii	"\201&\325B5-\220H7a\235AT\221\331\206D\210C\212f\313\213\212"
+	.ascii	"\374\322\013\016\251\334\001\3011\376\206\236\207U\021\373o\234"
+	.ascii	"\331g\321\314\\[q\213\256\202-\207\235P\332\247@\373\214\256"
+	.ascii	"\350\3732\253\217\214L\244\274\024\210\224\275R\r\032}\013\276"
+	.ascii	"\177\325\2059\362\236\350\335\354{\230\3330\347l\251b\013%\212"
+	.ascii	"\305\022\352Z\354\016\360\251\020\b\257\246\200Ri\370\200\001"
+	.ascii	"\266\210%\350\272-\304\361X\227+\216-$\203\0011\336\022E\316"
+	.ascii	"\254\001\361\250*\004;\020\b\"\264.\236\271\340\224\025f8\212"
+	.ascii	"(dq\3313\346t\355\357\245u\205\337>I\234\331/\227~\tNz\"4k\344"
+	.ascii	"\255\217#q\343d7\345\331\2561u\025M/&#K\240\340\216\277@\213"
+	.ascii	"\304\360g\367:x\356\001<$3\233\226^\2329\253\002N<\262\335\221"
+	.ascii	"\360\300\025\300\177\343\327\325\346.8*<\374\22023\324\024t\243"
+	.ascii	"%\026H\313U\376q&lW\024\360\374\3176%\376\332[\356Vz.\304\177"
+	.ascii	"\256X\255M\354\307I*q}\302\246\r\315\301\244\035W\277h\247q\231"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.193.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"m\n"
+	.string	"\006\324I@ \307*\035pF\003L\021\031\321\004&\340\361pd\225\322u2\222y\211LF\222J8\372)-\2645\266hP\202\203\253hg\260\0030\251\302\r\301\340\221\206\004\007r\\\312M\266F\366\336;\2458"
+	.string	"5"
+	.string	"4"
+	.string	"#\333\021\240\322\202I\260\273\337\024\271x:\245\350\037\214\251S\315\307']\210\201(H\030W\324C \327:\355\262cdI\231\001\355\256\245k|\335\365\266!l?\330\317\004\376\354\247\227\276\307A\211y\275\304\300\256\307n\301\346j\200\223\215\355K\373+g\021?3\316\006\273\003l"
+	.string	"v\327\301\r\232W\3179\336+\275\202\367j\321F\360Z;\333\2342\343lK\206\317\211\227\003,\251\263\337r\027\343|\023s\370&\357z\365}\363^?O{\205\221\024H\201\251\344\316\256\255\344\224\331\247\273\273\2361\007\241\b5\032E\204%\021\bf\204\020\034\372P\220N_hQA\272\030}%\222\004\306\027\002Q\337\247c\323I\004~\241\311\004~\233\232\3523f\220j\256h\225t\332\032\033\362.\323\231\272.$\r"
+	.ascii	"2\003\3269\004\353%6\354%\264\325&Hd\334\335\003\243.a5\253\321"
+	.ascii	"\342.7\325\036\rL\355\001"
+	.text
+	.section	.gnu.lto_pidGetAirmodeThrottleOffset.194.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\035\007"
+	.string	"r\31515Po\322\001\240\234\n\201!\221\363\345\372\201\b^\201\037\344\235\345\\\325\254h\326\327\343\262\b\3043@>*\263W5\222\240\276\2714j\317R\317,\331[\312\224\002\356p\024,\317\37384X\017\f/\302J\200x\035L\342q\006|y\026\260\367\271.\354e\342\276\255\226R7\"\265\260=q\022\243"
+	.string	"v\327\300\037y\244\360Mw\256"
+	.string	"\345\263;\037T\335\245\006\210\2102e\307Pj\206\375\266Z\262\237N\325x\254\220~b\331\305H\275l\2123\351\260\r\355\214\377q\020h\243Z\3340\021\234\240\\\224\270\354\356\333\\S\335\265\013Tw\252q\370\204\376C\216\240rj\311F\241'\346`w\235\331\210t\353\013ls\004\t"
+	.ascii	"2\241]\037\370\354\020\240k\270p\210\02136qW\244\331\360\256"
+	.ascii	"{\003"
+	.text
+	.section	.gnu.lto_applyLaunchControl.195.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`H\005\235!"
+	.string	"f\275\324D\200^Q:Y\211V\302\311\367o\311\027\flrx#\213\016j\344MS\025!e@\232dm_\373@\025\027R*\236\024@m;8xa9\202\033\2410\247\200\246\232\200\375\250*\263\325\276\355\223M\344N)\304"
+	.string	"\255"
+	.string	"\307"
+	.string	"\247\2460\247}\252oa:\227\0339"
+	.string	"\025X\245CL\255T\017\354\200J\346\317k1\031\317j5\002FL\255\365\201\027\310Nm\373X\236\205\311\326\342\020\fn\251@\346\216S\361O\255uw\340\270\362\224\274\200\362t\223\234\3515\332L\026+)\271\223\311\217a(~C\360\212\237!\024\216\327\214\214D\t9\215d"
+	.ascii	"6\246\317qO"
+	.string	"O\2067\006\23136;\200|\0212e\244N\201\221\224\035R3v\240\326\3524\313\033o\304f\207\020\341\244>N\222\270\257#tnPA\222\301TW\217\032\024p.\031!\370g\310\r\252\211\264\2059\265y\3613\007\024p\316\030\206Z\253\347\020*\352\266\335\366\034\333 l\352\337\347\251\222\3630\327J\362\233XI\306\374PFy\372\235\260D\3527\217\227\202\262e\315.\321\016N\264\373\343\nT\025\0078\303l\252\246\271D\373{<\036\217^$\266\356Yw\356Ww\321\271\374\004p\327\362\023\r\275\313}\243\323Bt\332\366\351\032\235\246\321\351\331\247e\237\216\225\323\345\247i9M\222\323K\247'9}\003\2709t\242\016\305\252\326\247\243\240\352E\267\240<\353\277\372\273|\355\333\307\362\215\256e\265\341\032\262\341_\\;\275\262\361E\205\353\311\302\275\330\265i3\371E\327lw\261\326kT\235^t\310"
+	.string	"\002\253\2656\bQ\312\215\261\001q\243\222Z\201\025l\021\377\"!\253\025H\301+D\211\027\337\344FyZ\356\215K\266\310\245{\247A\277y|p5&$T\260O<\r\n\bpj\255\024\320\274+\205\337\344\324GHH\373/\247[L\254"
+	.string	"m\375\346\321\021\234\024\231\"[\342\366\251R\003\234a\323\\\301\247(\261%:\251\\.\336R0&VV\376d8\345U.\321\367\362\353\300\302\243\203\304\255\020\326\232\251\265\026\202\333\346x\361\b~]XHz\005"
+	.string	"(\264\270\r\304*VB)\th+\264e\037k\335d\255?\004si\353)\334\3234\217\266M\242\265{.\346\207s\357\345\003"
+	.ascii	"19z\001\027\207'\037\036\\g\310?\251\fGK/x\032h\031\226`\360"
+	.ascii	"|>\032H\266%\236o\223z\276\021\274\027,`\034\315f\364j\034\221"
+	.ascii	"F\202\240\242\027c\267\324\202E\357\305\212\035\214\336Q\322"
+	.ascii	"\016\3117c\007!g\245\030<\337nII\311\267\253\3316\325\357\261"
+	.ascii	"\333zv[\223\364\366\036Xz\246d7\376?\260\364\330\241\351\326"
+	.ascii	"dy\333\241\315a{(\300\327\2234^\277m\252\351\346m\313\334\332"
+	.ascii	"\035>\314\017u\273\363\361\246\253J-\016Y\226\254#\264%\332\306"
+	.ascii	"\211\310rK\177]~r{\343=\020\255\274\021Fi*PF\214\231\331\022"
+	.ascii	"]\264\266\365U\245\251\255m/\004\333\255\355\255h\305\312\350"
+	.ascii	"f\n\221\013\307c\330l\213v\326\021J\221\355luE!Xl\351\3126V\024"
+	.ascii	"\006h\250a,\003\025b\210\021\222\021\t$I\2458`\002\231B[\007"
+	.ascii	"\020hV4I\2419nr\240V\244\256\275\002\214\355e\312\334\277\301"
+	.ascii	"vdI\003\001\304\317\221@Y\323Mh\f\260r\272VV\224\326|v\200.k"
+	.ascii	"\361F\031\330\204\0343\322\257\301^g\237a\355\007y\033D\2174"
+	.ascii	"u\206\371z\247L\265r\211v\271\255%<\226\023x2\3010u\204\205\006"
+	.ascii	"\234p0>(\375\f\364\007f\232\220\360\366\243\253\037\325ly\363"
+	.ascii	"\274\305{\346\231L\215\200'|\226\t\214\210\246\260L)$\317'B\230"
+	.ascii	"\036\2618\254\342\376n\b\"R=U\314o\350\007u\2009\217-\241/\361"
+	.ascii	"S\315\306\355\031\035\3019 \325+\206?0g@\315\301\356\372\326"
+	.ascii	"NI\2772<\031\355\021\311\033\205kg2.\256\025\177"
+	.text
+	.section	.gnu.lto_pidController.196.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\330B\005\024\001j\333-eL\020\020\250\255\f\007\203\225+\2433\321\200\375\177\017\321\333N\030#z\343\3440\233\345\214\302\001+\225\001\324\024\030\202\240M@\366S\245n\340\"\204\201\330.\237\213\330\001K\224\312\341\314\263SE\026\274\037\004V+\302k\364!{K\231d8\006\245\005k\006+\200\224W\203\025\274\031\f\361b\220\362^\220\362Z\320\274\001h^"
+	.ascii	"\244\274\025\244\274AR^ )/\005)\357\004\315+A\363F\220\362B\220"
+	.ascii	"\362\376h^\037\315\333#\345\345\221\362>p\202\327\201\023\274"
+	.ascii	"\r\234\340e \345]@\005\357\216\024\274:R\336\034*xq\244\340\275"
+	.ascii	"\221\362\3320\342U \005o\002)o\215\224\027\201\224\227F\312;"
+	.ascii	"#\345\225\221\362\036\220\362\306Hya\024\361\276@\301\353\"\345"
+	.ascii	"m\221\362\262\030\3425\240\210w\005\n^\025)\257\321\020o\212"
+	.ascii	"\224\267(\345E\221\362\022\245\274'\210x\207\210xM\224\340-\221"
+	.ascii	"\362\222HyG4\257\210!\336\002R^\241\346MO\360\206`,_\264\004"
+	.ascii	"\3579\304\333&x\271\004\357Y\356G\034\244\2353pe\032\317L\215"
+	.ascii	"j\006R\353P7\346\345~\302\037\320\031\313\371\312y\352\034u~"
+	.ascii	"rV\236\231\316\310\337\316\177\367\343\375z\377\336\317\367\367"
+	.ascii	"\375{\376\277\277\356\247\373\317\374i\3765?\233\277\355o\363"
+	.ascii	"\273\375pN\202G\260\b.\200\017\330=g\271:\245\036\312\326\036"
+	.ascii	",V\226\255\242\352\350\360q\025[\331O1\365,SY\256\262BS\273\226"
+	.ascii	"8vQqT\325\321\301jd\220TT\027\035.~\202\216F\331\025\332e\247"
+	.ascii	"e(\f\245\334\225\214\216./\350\t \035\235\267 N\"\261\323\016"
+	.ascii	"\371\302#\030\270|\344\246\025b\344\035:5~k\0203\355z\307\327"
+	.ascii	"\346\f\322\256\320\237\023\356\013\007\215H\036\270\017\024\""
+	.ascii	"\013\357\016\026\331\036\320\323x\250K\371o\327!\225\355t1C\350"
+	.ascii	"\247\252j\216\243\273H\366\203+t\024\311\005\237\230\221\t\342"
+	.ascii	"\020tt_\367>\273B\233\364\300\215\341\013\215\230\335\376\316"
+	.ascii	"\361<\357y\376\303\365\334\357|\016\270B\177q}^\366\360\340\307"
+	.ascii	"V}rd~\252*\305S\370\344\326\374TUeu\217\r\230\252J\355\321k\003"
+	.ascii	"\243\303\223\313\003[s\267k] \272\250\261\240\243v\226\\\235"
+	.ascii	"R\271\016\016t\376\370\205\005\325Y\241\243m\233\264\033g?g\205"
+	.ascii	"N5\215z.\327\362\310\304|\270\334~n\205v\367qF\030\036g\273J"
+	.ascii	"\332\026\026\231\252\252BGw\017\267\217[\241\2430\\\316\276Q"
+	.ascii	"\001\201\026\305\317\013\206]\241\243B\273\306}\332\325|\355"
+	.ascii	"l_\357\346o\376\266Bp\226t\245\3132fZnfV\332\3109S\033\223S\265"
+	.ascii	"R\373\316\214\037\231XR\020"
+	.string	"\033&W\223\252\f\201\340\232~\252j\266\302\232]O5\315\301\342\276\300L\b:\232\253\031\237\246\t\214&3\225ix\267VG&\250\252\352\215\243\333A]\001\r\3600\376\214\023\030Lfj\324p\311\226G&\250\252f7\216n\005AGw\227\315\336\203\361g4l\bU\315\"l \350(\214\363\274{\262\2271\276\214x\023\252\372EN\033U5\313\2615\202\216\256\331Q\f\217\006\375\304\360\350\032w\365\334lK5\202#{J\023TUuG\203\331\313[;\333?\315\276E\250\361\373\303\356m\236\345[\275\315[\274\305\263w{g\355\254\335\326\331\272\245\263s\226n\347Vn}\330\270\225\263p\033g\337\026\316\276Y\267u\263mv\335\266e[6\273\266kV\315\246Y\265E\263i{f\321\366l{X\263 @(\230@\202\b \370\341\243\007\217\007\034h\200\201\005v\350\310\201\343\206\r\005\022\250\201"
+	.string	"\215\0312\016\210\001\343\205\213\026,\fX\241\302(E\021\n\242\023C&J\220\030!\242"
+	.string	"\2414D\020\210!z6\033\367 *"
+	.ascii	"\243\304SRa\372\376\3609\037x\367\344\276y\344\276|'\f:^\275"
+	.ascii	"9\316\262\362\346\311\371\342\225\320\222\363\305\023w\307\366"
+	.ascii	"\326\306{\347,\301\346\\ F\230\324\016\274v\354\264\326\276"
+	.string	"vu^\2545\365Pei\255\371\326\251I\303KG\215\031\3369e_\2722\2522\274sd_9\036\252\310x}\330\341\0337\266\003\257\034\246*\023\343\205c~\343\260\310B2\213\262\220_\274oL/^8oN\252,\255\256\257[\230\257\033\026Y\3100EYH.\3366DYZ[\337\225E\026rK\212\013o\333\271B\314I\003\213\227\rn\355\257\214*K\353\352\313\346j\013\357\032\213,\344\225\026\3365j@T`\"m\r\356\213*K+\3137\215Z\224\242,d\024/\032\026Y\310(Sx\323dX}\317D\371\242E\201\342=S~{P2\324\317\252,$\024^\263\223*K\353\311\203\2346\2364\031\310\231\300\037?7\026YH)g\n\247\250\257\207I\0252\005\f\365sK\026\322\212\233\by\202@\227 \0207=F\230\024 \216\240(\013\211\345\017Cp\256\300\232\243b\221\205\304r\322"
+	.string	"\034\344\037\202\367!\370\036}z\230\007\337\037\370\241\017\037;\260\367\006\366\316@\036=^ \357;\354\244\362\350\260\2169\3171\207\216q\314\261\223\232\343\033r\267!\347\003+\020\367\004\342\344p\215\365\b\204I\311\261\223jc\032+\033\317X\331\260\214s\004\030\035\344\355\244\326\223\201\265\013\341\032\037\260\3461N\033~n\372\334Nj\315\211\"\352K\251\206a\244\371\0133wa\346-\316\025e'\2152\314\302L\341c\204I\221\261\001i"
+	.ascii	"\037#L\212\007^Q\347g\034\337\223\032U\226\326\332U\214\335\350"
+	.ascii	"\204!W\367t;\251\261\363\305\027.\203b\234\342,\301<\027\360"
+	.ascii	"\342\"\033\246\276\216b\316\321\345Z\036\331`\326\324\327\211"
+	.ascii	"\272~\342\2441\366'\316\355\244\272\316\025h\234\302\210\341"
+	.ascii	"\24107\021\206\213Kl\235\304i\003k\216\nE\035\255\037\036&\305"
+	.ascii	"\205Gla\261\210\255+.\340YSY.\364\343\226\247Y\264p\210,aRX8"
+	.ascii	"\310N\312*F\230\224\026\006\021#kj\313\207I!*O\214:=\361I\365"
+	.ascii	"\036A\005y\302PU\365og(*M\314 *PUuYIe\352\233\344\273Ad\273\337"
+	.ascii	"a\027\202\021\0028\356\3428\340\032\255@o\002m\243\215]\234\232"
+	.ascii	"i\227\373|\020dKU\325+\003\213|g\363\343\217\001\213}{\212\177"
+	.ascii	"\177\303\243\n4\210@e\225\037\357)\006\356\273\266\350\2478X"
+	.ascii	"\034\034\036M\240\213]wcV\273\304/\254gW\035[[\004\304|Mh\344"
+	.ascii	"\251\252\332\343\350\362\036\377P$,6\215LL\303\2435\372s\216"
+	.ascii	"\212u\321\031s;r\263\327\fyn6\233\200P\364rI\254]\231r\342x-"
+	.ascii	"b\315\212\236\241\337\351w5\324\022\335i\n\372x\311\260\335e"
+	.ascii	"\031\0234\005=\354\203\344\346\"\320\023\364r\022\020\311\315"
+	.ascii	"\245\3213\032\201>\036\215F\301%\243g\364I\227\004C\032\221\030"
+	.ascii	"\360\2252\372\324\013\333S\207l\246\345\021E\371\346\304\001"
+	.ascii	"\315\002\332\234&\376c\267\253\323\266\035\3203t\301\305h\030"
+	.ascii	"\375;}\272\272\030\035\302j\316\256O\333\006\243S\350\202\033"
+	.ascii	"\033z\201\203\347\214Px\310\271\350\027\r\202\255\205\013\026"
+	.ascii	"\335\002\216E\003\341\372\215358\023l7\240[x3\240K\350z+\261"
+	.ascii	"\242w7\007\2771B\361\221\247\252\352\217e7\354f\204Z\243\024"
+	.ascii	"cT"
+	.ascii	"\324\360\350U\364\212\006\301\367Tx\344\346\372`\243\3365V1Z"
+	.ascii	"\031^\251\242a45\323\037\242\021m\324Fi_3\344S?7}H\330\270ql"
+	.ascii	"\230\242c`c\034\273b\324J\321J\272\340\f\026\365\362\031\257"
+	.ascii	"\331\025\313\266\365\233\222\317\221\233\213\242\213\272\003"
+	.ascii	"\223X\353\265\366\316\314\2024\233\200M\252z\224A\324(N4\211"
+	.ascii	"&\352'\303\220\334\334\241>\321F\201I\277#7W\006\253\357\333"
+	.ascii	"\320D\017\365\223Xm\242\377TxL3ri1z\225\350\323\341\032\321$"
+	.ascii	"\372I\301\343\031\243\355z\265m\3336<:\242/\325\005g\314j\004"
+	.ascii	"\231\213h\013\314\234p\021\321\207s\021\275\334\277\375Qk\232"
+	.ascii	"\205\303=\223\341\236\351\317d\370\274\206\312z\001\315\002\017"
+	.ascii	"Lf\034\333w\255\321\213QKkx\264\200^\352Z?\327c2t\261\r\0260"
+	.ascii	"\247u8U\227\332\330\026\t\232\315\246\320\323^\356\336\3110\355"
+	.ascii	".D\3133\206qpB\304\270\\\016\217\246\3754.\253#7\331HU\325\020"
+	.ascii	"\214\007-O\023\377\371\216f\263\031\304|\210VB\323k\342?{C\210"
+	.ascii	"~U\027\232A\253\245\323l6A\364\222\206\341\262\027\177\321\260"
+	.ascii	"\357\332\"F0`\206Gk\350b#\bx\344\346\256\031\3620TU\035\366r"
+	.ascii	"9N7\332\313\345\336\365\352.7\251\352Q\206\210@py\236V>\\\177"
+	.ascii	"LC\355\3562\327\337\177\273\f9V\232u\376\354\344i\342?\333\177"
+	.ascii	"\215!\307\351\317\365\337n\202\360\t\016\222\233[B}\215\341\331"
+	.ascii	"\034\247\227\237\254\220\334\334e\033\030\214\221K\214\321\313"
+	.ascii	"kx\364l\021gt\004\261\312X\035\271\3114\222\221k\004\3264\301"
+	.ascii	"j\360\256q\214\221\f_\371\270~\261\246\251\016\372!\233\351\\"
+	.ascii	"3\344\331K^3\344\2034\233\315\356/k\034\033v\213(D\323k\342?"
+	.ascii	"\273k\324\201\275\030\307\202TU\355\261\334e\006#\017A\252\252"
+	.ascii	"\276\353\350^\205\341\321\356\020eGn\356\362\025c\251\260\357"
+	.ascii	"Zc\031\243\031\276\362\350\336hfx\224\373|\304\004\216Y\035\271"
+	.ascii	"\271/x\327\002\f\370\312\303\265\2135\200\324A?d3\355\232!\277"
+	.ascii	"\315f\263\220{\271\373m6\233\205\333_vK\360r\234\313}\031\316"
+	.ascii	"\345\276\374&\345e7\"^vs\202\227\333\244\274\274\036\320\227"
+	.ascii	"\333R^fKy\231\315\351\276\274\366\272/\243\271\235/\233\245\274"
+	.ascii	"\\\306W\276\\&\345\3451\034\365e\260\224\227\231<\365\345\257"
+	.ascii	"\224\227\305\374\356\313\\)/{a\246/wa\246/c\245\274|\305O\276"
+	.ascii	"\274\205\225_\326\302\312/gIy\371\n#\277\\\365\273/[\371\335"
+	.ascii	"\227\247~\367e\251\023~yJ\312\313RR^\216r\274/?\271\336\227\235"
+	.ascii	"\316\367e\344\367|Y}\331\177A\306\362\375\337\331|\237\3675\337"
+	.ascii	"\343\245\274\307\3635\337\337\371\331\3779o\373~\356m\276\227"
+	.ascii	"\273\333\367q\207\363=\034\021\357\305R\336\353\220\362>\207"
+	.ascii	"\224\367dR\336\343\220\362~\fc\371>\214\231\276\277\341w\337"
+	.ascii	"\203\275"
+	.string	"\356{\346\317|\377u\272\357\275\276\346\373\256\346\275\230\346}\230\224\367\\\315\373\255\224\367`R\336\333\220\362~\231\362\376K\312{-\"\336g\r\361\336K\312\373.)\357\271\244\274\307Jy\177\225\362~K\363^K\312\373,)\357\261\244\274\267Jy\177%\345}U\312{+)\357\251R\336W!\342\375T\312{*C\274\227Jy\037\325\274\237\222\362^J\312\373()\357\241R\336+S\336CIy\377\244\004\357\237R\336'S\336;\245\274oJy\217Ly\177Ly\317\224\362^-\3425\242\340-\246\274\304\224\267\206\224\227\206!\336\031\212x\235\240\340\225!\345m\222\362\306\220\3622)\342]B\301\273$\345U\032\342\205\241\210W\t\n\336\244\2247\311\020/\022\026\274GR\336\004\244\274\bHy\221R\336\027R^\027R\336\026R\336##^#)o\221\025\274,\f\361\0229\301{\200\224w\205\224\327"
+	.string	")\257\n)o\n)/\n)\357\tD\274&\030\300[B\312KB\312;B\312[\200\224W\204\2247\204\224wH\312K\200\024\274 \244\274\037\244\274\036\244\274BR\336\001\244\274\035\244\274\034\244\274\0334\007|G\353\252"
+	.ascii	"\203\354\270ql\210\244\217\347\314\202\244o\365\325g\320\252"
+	.ascii	"D\340\225\034\220\033?\263\031\3524\316\374\214\341.\315^\232"
+	.ascii	"\245<\204V\232\036:I@\344\222\031\253\217\350@\034\353R\245\301"
+	.ascii	"\213\323\n1p\202\263\312IE\344\241\f\321\214\231\341\321#M\""
+	.ascii	"M\017\234\262\252\221\232\261\272\357\222XW\215\200N@\253\340"
+	.ascii	"Cj\0044\2104\251(\244f\250\243a_\200\203n[\232\2654_5Gy\210\034"
+	.ascii	"\322\364\250%_h\027\232\267t\363I\351\341\205~\233\225v\241W"
+	.ascii	"\334\3615\223\202}\324\254\245\317\264\023\nm\333Z\350\t\270"
+	.ascii	"\262\364Q\017\245\361\371I\n^1W\265\221\336%\252\021\325\360"
+	.ascii	"\225\234\245a\234O>\300\361T\344;\232\2553Y\354[+\376\031i\206"
+	.ascii	"\372\bN|}\312*\035\205g\270(\350\345n\221~\326\211<\217l\305"
+	.ascii	"\264\"-\303\227\236\t\254XHs\025\013\275KtC|C\244Yhfk\022\351"
+	.ascii	"\373\360\2057Vv\244\0016\310E\002\n\232\314N|\033\262\233\346"
+	.ascii	"\246\363\326\2251^\3324\273i\243\300\003\364\3474\267iN\376$"
+	.ascii	"s\267'\356\n\0320\257\016t\200\036\362\205gp\2056@sU\217X\376"
+	.ascii	"\260\366\237]\341\266m\205\276\232\n\235B\033\340jT\350\031z"
+	.ascii	"nG?}\232\270PLK\241\271\351h\341\327\335\356\321\332;\023\201"
+	.ascii	"PX\340\236\235\032\034\024\bz\271/\240\336\264\371`\251\236\001"
+	.ascii	"\365\346\253\007O\365\301\032\n\205VB\233C\214\353\277]i\360"
+	.ascii	"!6]\354A\241O\365E7V6\305\007\243#\322\341+\331J"
+	.string	"\177\007\037\352\234\232i;h=\273\272\330\342\033\272\313\263\3768\241;h\226\352\016L\202\355\345iR\247\230vB\017\301\276\332\230Ik\017\215\217)\\B\233\320\304;\"\036_\311S\r#\331L\373\2576\241\277\330\220xj\205=z\271(\344\360\300\271\372}\036\242\213\\\025\255\325\201\020\232\327\206\"\352\rKh\245\273\306C\324\333#\362\361\225|\303\243%t\004_l\006\255\326\266\263k\n\273b\024Q\235\003\336\203e\036\236\222\307\220&\241\317E(\2665\370@/\227\033\340(Q\272\320=yZ\031`)}\034H\350\020\372}\316VUuy\177v\346 {\204&\241\233.\211\325\325\005\350\021Z\305\033\016-B\027`\357\"\364\004zC:\204~\222\317\221\233t\372\266mH\307\360\205\346t\240\227\273\247\351v=\334\034\261y8[rQ\270\201^\236u\334\256\304\277mc)\035\202\001\006\216\200Z\013\020"
+	.string	"n\327\026\275\245\343\024\243\212\336>\350\007\366\033\r\202T\365x\345\266\233v#\006\022\375h\240\301\360\350\202\320\004h\030N\315\324+q\2608\bB\027\275\b\307v\343|\331ajG\037\336\007\275K\004\324l\273\246`S\214\"Z\033\323\036\364\007\rBH\017\240=\350'\303\220B\232\207\036\221\260\325\354\272#/\r\261\211#\017M\253\025\231\220E'\247\341\321\001\364\313\274\002\215\2259u\007\315O\372\204\035\364\347x\001\036up\300\0334\007\033\364\305\274\364\214Y\325"
+	.string	"\370\003#\033J\021\212\257\334\026U}\002\251V\315\264_J\254\034\002h\016\203\326\003S"
+	.string	"\215\200\036\016={\177g\247\316\201\207E\203\376\336\257\344\323w\r\032\210\027\236\242\2246\263+\217-UU{\224\025\243tl5Y\227)R\251R\264bex\224\221}\202\327\335\022?\360~\017<\340\266\005\261\332\237\323b:d\320\273E,E-|\345\236j\226fZ\f:\203\036.\345\374<\025\026\257\032\207\"\227 Um\352\261=\246\206)E/\304\341Q\f\332"
+	.string	"^t\006\313.\350\367\261\332\026\364\005\375\277[\320'\363\232s\303\256:\362\032\254\t\002[\315T\373\004/\272A\267\343\215^\376\357\227\362\202\023\023d\262\021\200\270\006@\007\240;\020"
+	.ascii	"\235\336\371\320\367\344\206\344\346Q\201\n\222\360v\227\230"
+	.ascii	"e\021\f_YA\237nr\320\241\316\251\231V\216\037\263\277\004\360"
+	.ascii	"\270M\252\020\253F\220\0040\220\336\336\002#\246\350\305W\006"
+	.ascii	"i\030I }*/4Fj}p\b\224\375r]\200\236^\223\303\0362\032\022t\177"
+	.ascii	"\241}a\032\227\022\264\017*>;?3\"\350,'\305\033\214\313\b\372"
+	.ascii	"\005s\311\245\365\311h-?\263\373\354\007\346\001\020\234i-\360"
+	.ascii	"\217\336\356R$\303Wnc5\227\242\016cE\036\n\370\362\r\217^\260"
+	.ascii	"\313\024\315\360\225\0204\214\247f\332\377\375G\237\252\2539"
+	.ascii	"f\265\205sTd1|<\257{\264\217n>\376\276\r\317\354\036}\300\243"
+	.ascii	"[\272\n\321\360\324\340 \271\t\243\227\313.\230\255_\370O\371"
+	.ascii	"\342\006\352im\301lzO\003\036hnk\250]n\003<*\325\025\b\ro\r\237"
+	.ascii	"\266>a\226]\213\362\260\310\260\2456\266\345\005\217\346+\315"
+	.ascii	"l\375$X\215/%\226\013\276\322<\232\331\374p\023h\327\202\247"
+	.ascii	"4\004Sg\230u\252\252\262\350%\236\346\321,\240\3155\361\237\345"
+	.ascii	")}<=\\>\201\343+\375@\363\224f\266\023VYi\322C1\215\257\364\013"
+	.ascii	"\177\2169\236\351\202U\306\355f\252\252\032\300\243\225\272\364"
+	.ascii	"\324\256A-\325T\232\240\025\323\322\206Gy\264\222\256@\373@\377"
+	.ascii	"\357'L\201\317\354\335\242\232\342\032_\371@\037\360\267\001"
+	.ascii	"\352\312o\320\257\251\231VUU\246\025\275\334\203\305\345=\255"
+	.ascii	"F\277\223\241\2218\272\2475\005\223\371\277"
+	.string	"\032jU8\320Q\330\224|\034\350\216\033c\006H\0323{\214z\331\f4\013\375\244\241\024\331\366]{T\\\327\341\321\006\232\205\036\t\274[|S|\343+\031h\027PZ\352D\340\335b\\Q\216\257\344\032\303\245\016\331L)z\271ByP\360Zw\036\242\033\277W\216\257n6\233\203E8~\257\346\265N\221\266\326\267@_\315\256)\266TU\375\321|J>9zG\257\216^\240\221B~&\257\217\305:_\233\211\256\210\267\243\215\330\232tt4\016<Xl4\216\336\033\235\203P\310\317\004*\326y\333\037\006T\264sW\304\303\033\036\305\321Fi\202\305\300\242^q\360F\007\373\202\216#$HK*\366\005\035K^X\"\202dG\222$$H\222\212\254`a\0056\242D\244\211RR\006F\216\216Z\020JRr\242A\022$!FF$A\022b\304\b\232\004I\210\221\324\311\022R\221\244#G#\220"
+	.string	"a(\350(\004\022\245\243\245\r\2260IB\212\341HI\211\210\243%\"C\224\222\224\2240@\242t\264\2044\342\250H\022&'\222$!-\0259RRJ\262`\311\020\221\245#G\027,%AJR\262t\024\202\021$%%\2200\t\301\b\222\222\341\022$\031\210\234JIKE\210d@D\311R\210$HJBhB\304\211\210#IJKI\222,x\241H\022&D\216\234X\262\301\021\223\"K\216\206,Q\342\202\211\243\030\220\226\212"
+	.ascii	"\340\310H\222\220#G1\034\035!\201dA\022'FP$JGK\027\034-\021\031"
+	.ascii	"\222\244\344\304\005\021GH\210(ePdH\223\243$\351\222\002\034"
+	.ascii	"!A\022a)\311\221\222\022\223\"\"\216\216 \265\220\244\004\202"
+	.ascii	"\021$%\351\026\321a\004I\311\216\245\027\\@:\322\302\216$HD\220"
+	.ascii	"\354(\242\264d\207\016\243MRr\244\264c))Ii\207\320\356\256\331"
+	.ascii	"\361\375\305\003+f\203~\307Fn\2234\377\333M\370\235q\363Gz\271"
+	.ascii	"!\362 \200\341t\347Ar\343\374\206\337\364\373$\200\3374\303\351"
+	.ascii	"\023hQ\374$\261\220\200vE\201\376iB\224RLS\262\372An\213RP?\273"
+	.ascii	"\246\330\222\333\235A\016\332\247\030E\0248\367\032T\320\220"
+	.ascii	"a\221\t\276\200s\212B@/\367O\325\340\234\220\364\0271]\374\213"
+	.ascii	"\022\323F\f\316\240\025\212\250/%R/\227\263<G\030\027\376\327"
+	.ascii	"{\266\200\366\303\302\232\313\376\026s\246&\347\205\260\376_"
+	.ascii	"\257P\203\262&\261\220~}z\326\275<z\202x\356\356\264\211\325"
+	.ascii	"\251\243#(8\227\005\225C}\020c\023\0234s\023h\307\205^.\033\271"
+	.ascii	"q\316\362[\231R\005\353\350\306\321\206\332<~n\372\264\020\246"
+	.ascii	"9\f\221J\230\276\226.\310f\272\r\2549\252\243\255f\001\r\256"
+	.ascii	"\312V\377\355g\230\030\233\253\252\252\032a\201\321t\347Qq\343"
+	.ascii	"g~\235\252\252\252Ez\311h\372uNBZ[_\022\013\271\327\367\373\235"
+	.ascii	"\235\252\232\025\344\177\277\337\0317\231\0056ss\323\246(\226"
+	.ascii	"6f\305p\370\354\376\020\001\323mll\224|\2166\200\351&L\202u\371"
+	.ascii	"\263\354\333\320\006\274\375\313\262W\360i\365\273\364\277d\365"
+	.ascii	"\265\372I?/\375\254\276\032+^\372r\230\3151+.\375-\375.\335\204"
+	.ascii	"iF`\365\2714\032h\326\277\352c\241h\256\032\307\025\364\314\256"
+	.ascii	"-\320\212QE[g[z\211Y8Xvc\352\n\312\001z\271Z\332\002\324\314"
+	.ascii	"\t\026\343RK\273\340z\225\025\232\177hzY\372X\232\315\232\371"
+	.ascii	"\312v\375\2352\305\250\323\221e\351\337\261\352_\351ci\243\264"
+	.ascii	"\035v\375:V\214:\233<\261\376\252WV\325\267\322"
+	.string	"\277\322h`\022+\207]\201\220)F\371\310\303\241\201\350\205\355\232#\357\206b\024\002`Vr`\022\032\240\227\375\265+\215-\257\256\333\240gu\344f\231\346\262\306\301\226\354\303\265+\257y\350V1\212\321\344\201)\323lu\r\374\230}\006\313\276\354:cK+\253\212\031(\210r\301\272\262b\006\212\241Yv\235\221\207b)F\261\260R\340\254\371\005\213L\260\007\255\2753*\240 \324\\\365S\256\212\226\332\t\257\322\354\326PG\217M-vk+\273\272\330\242*F\025mUa\252\177pG\330\247\344\223\002\225>U\013\241\320\313e\023n\234\251\376)w\350\314=\255%4 \326PT\375*\315U\250\324\2563\362\320\250b\024\217<t\nU\207(\233\352W\351\223-\3517\325 \b\223|\304\372TzhI\330w\236\320K.cB\177\331\033\307\206\227\352\021x\320\364x@\241\214cZ\214ZR\315T\317"
+	.string	"\213\251g\314\252\204B<\022z\271{\205>yJ\336\211\215A\221\350\021e\022\024<r\023\320Y\270\353\013\302b\024\213@S\314;b\202\202#\240GB@E)\347\240\240\2379\202\005\210\353>#\374C\212"
+	.ascii	"\370\307\2079'&x\274\022\333\032\f\241\227\353#\017\b\f\326D"
+	.ascii	"k\201e\004\3401}\035t\350]\342\325\351\267k\213\263\257\030U"
+	.ascii	"t\352\231\201\37166\004\214;\350G5{!j\361\225<\206\360\334\333"
+	.ascii	"\225(\017\261\031D/\252\2070\337^\207O\031\001z\271\354A\373"
+	.ascii	"Y\373\323\363\0013\37394\324\247\264\017;B\246"
+	.ascii	"\027\030\"\027_\371)\335\203eouM\315\264\227\322\217\322\f\326"
+	.ascii	"Lw\007'\245\017G\217\253\017\325\217\322 \002\223a9\364\311\364"
+	.ascii	"\241\232\245~\302r\260y\202\320\313\335\257ffS\020\230\004D*"
+	.ascii	"\373P\232\277:G\232\235\262[M\317\212(\346P\232\253\274\2032"
+	.ascii	"]\232\232\351t\204O\334|\320\313}\322/\312\3169\273\022\275\266"
+	.ascii	"\355I\263\324\3219\346:\346A/\227;8\347\316\034\f\200\305\364"
+	.ascii	"\3114\324\222\351>\013\3647D\na\236>\354z=yg\034\261y\274\274"
+	.ascii	"S\216\230>\234^\331\221\233=\200\266\353\240\227{#\327\360O-"
+	.ascii	"\242\354|\373S\037\214\311\366"
+	.string	"\244\337\354\372b\313\355Y\230j\203O6su\277%\261\234\222=l\263k\320\332\204xC1\315\251\207XL\2651\267\246f\333\365\305\326\311\346\344S\3629\276\251/\207yf\320\215\203^\246\331\265\305\251V\214*:\321\234\177\276\232\202\202S\346\250\3126\350\3452\324\217\005EWv\001{i\024kr_\023\374\206\206\332=r\314\211vv\366\360\033\372\307>\262U\320%\303\340\372L\375#W\365\325>S\017\tO3\273\362\310;\313\210M\035ye\256\306\371*\034,\023\200\261wW\307\311\303\016\3056\022\21354\221\206\256!\00728\320\3006(\245h0C\330\f}\253\257@\203V\303:A(\031\364r\227\331 \302\374\330A\323s\001\305\0066\f.p\322'\030S\206v\322D\206*pku.b\350&m\304\227\f\363\322L:\206fqw\212\331\365w\302\020\233\247;\271\230\364\357p\225\035-"
+	.string	"1\345\307L"
+	.string	"\226r\234`lX\322KJK\266\264\022"
+	.string	"N-\207!\013\006?c\025(9\273\030\241"
+	.string	"\331:\271$\265\2226zK\222\224f\204\226N\322F\001\204\233\250\203\301C\341d.Q\302\240c\n\215\320\214\320$i\r\343\025@0@8,\031\356\222&\037\023"
+	.ascii	"\004\020\211\"\262$\346\030d\206H$I:<\326\332\363W\362Xlpl\337"
+	.ascii	"\301\225%a\330l\031\0139Xh\327\346}\374U\237`\370'.\306\033\366"
+	.ascii	"LC\377b\377S\217\335\256{9X{u\271\216{\325\232Rwi\021Q4\016\013"
+	.ascii	"\347\300\r\344\321\263\004\026&\211\334\304\364\312\214\245\n"
+	.ascii	"_\217\345\215\323\237\215B\371C\322#\tUz\264'\275\t\324\370#"
+	.ascii	"e\032\377\035/2u\310>\256\025\321\206\267\346Q\211P\3446l\032"
+	.ascii	"\242\234 \371\227?m\207\226\005a\264qy\216\320E\325\037\n\366"
+	.ascii	"\356E\356f\255 X\200y \361^:\325\267<[J\315P\254\222\031\255"
+	.ascii	"T]R\2167\\\177\300W\253<\230\3035\371\270\341U\252\374\324\372"
+	.ascii	"Q\272\240\b\312H\225\246C\236^\224T+C\"d\332\016+kBX]6\017\370"
+	.ascii	"H\364\247\031o\bM\254Q\t\306\344-\254\241)\205\245\006\361Pi"
+	.ascii	"\346\241\347\3444\376\344Z\177\272\253\0222.\177A\335\215\337"
+	.ascii	"\0333\302\303\270\022\334\200\221J\204[*\017\227\274\001-k\255"
+	.ascii	"J\276\f\267m+M\261E\017\362\030\371\324\306,J\346{Pm8\372J\300"
+	.ascii	"@\206\3667\246\244lwSH\221\204u\372\203\320\357u\260\235\346"
+	.ascii	"\340DM\303\331_WH8t\242\f\222\322\265\027\003\205a\276T\004\245"
+	.ascii	"\233\236\027K\025\276I\026\003\222=\313\034S\250\366\220X\203"
+	.ascii	"\304Q\2121H\n\026\224+\236^_VqSM\200$-\333\026\023\265\377A\261"
+	.ascii	"\313\271}Ec#\272\371_\031\213\257A\273\343\275\032.\232\351\270"
+	.ascii	"\250\340\220\025\306\240\366B\361\326\246\214b\302"
+	.string	"\005\213k*X\261@\220S\202\323\275\177\300\001\306t,\375\323\005\312]\330\3623\376\006\364!\255\335\303\267\202\335D\333p\n\334j\302\252\372\254\020\360Or[\252a\013\241\266 \232\252\216\327\367\220*\352%\347\334\263\260[[\256\306\303m:\027N\312\227\255C\032\243\214\204\326_\241\307\275\001\034\021\214w\003\306F\371\363\205\035A%\304\277J\023\201\217Q\335\017\216\345\021QaH\232,G\020\337\203;b\302\350\256ZB\022\267\030[K\204@P\374\302x?\016n=f\037\t'\226`\312\232_\200\225K\250\356-M\3108=\323\013>D\334L\203\227\264\306;\303\034\270\033\177\024?|`\177\023\310\224E\343cJ\036\207\370!k\350qM\317M\311#Y\025\245\240a\035<\022\320(SAl\022\343\266M;p\033\"\336\021\261c\360/U\260$\r\034r\267\023\n\345I\034\361\244\360\220\034\205\360\336Z"
+	.string	"\224m\347wmt8\013+O(D.z\342c\016\240S\224c\233q\205$\314"
+	.ascii	"5\334\037\372\205\364>L}`\316\233\311\216<r\025f\2153\n\203\210"
+	.ascii	"\321\253\265\261\241eQ\270\264xc\3638\300\310\310\247\032\371"
+	.ascii	"\313X\241_N`\323\227Lb\244\246-\234\227H\343\226\326P\232\214"
+	.ascii	"\t[\023N\302/\031y\0160\212#\336\\\341\\8\310\364L\207\214G:"
+	.ascii	"\3525\345\234v\034\021t\033\310\313\202\026\004>\360\341\313"
+	.ascii	"\232\322\031\206\216|]rS(]\330\312\302\365\232\272\n\252P}\263"
+	.ascii	"\034\211\222\230W[\261\260\276-0U\251"
+	.string	"+7\237\230/\240dWO\177\366\355'#I\213uN\222v\264\232\372_\306\003xp\\\251\222?d\3771j0\301\343\301\224\237k\336\215d\003\n\033\334\277\263\230\262\037\247K\226`\2107\344\262\374\247\255\255\324\327\340\266\214_\020\004\232\211jC\242\242\211\266\222\325\241\307_\\\357\324\263g4Q\207hu\367\373\f\351d~\341)\023d\310\364\020b\205\342u\b$)\335u\\\033\222Q\364\346\203\022\3050\341\2746tU\331t\252^\024\235m4~9vh\364/c\207\361\240\267)\323\254*\364\236U\245\2100\246\217\035\267*@\201\236tg\245\332\270\340\246[\230!\226#\303\255\021\235\377O$\231.Vs%{\361\204\304\2304\027 \252\204\b<&}\ns~\217\005\020\243v\260p\210\333\313\270\025\320'I\237\213\006g_\311U\253a=6)>\223\250&D\250_\001J\274A\236\211j\362\004"
+	.ascii	"\255\340\276\322\027\023\226\200\270!\226\344\372m\271ge\216"
+	.ascii	"\220\013\321\256'\365\023j\262\276\300ee9\211"
+	.string	"\022<\225\231\333\0302\030\302\332\235\363h&\304\326'\271\335\\w\r\207\240\243\244\036-\204\035\201\201\333\375\266`\327m05\312\226uD\023\224\357\305\337J\245\2751\2038\217\034\r\304\223\336a\227\316\377\377V\003\017\n\317u\245\037f\306i\325\364,\352\216\257\207\017\204\220\256~\355\262\253\004\00505H~\275\234\222\257\313,\225\036\024q4\276\r\335\221$\374\036\335\323<[\320\344!L\003\340\317&\206\225~\317\266\034\315S\362\343\232\031\250\336\357\244|+\332\364\314\335I\013\006\n\be\002\305\323\002\216\"\022\345\244\231\177\307%\265\201\242W\240\352a\215\202\342\370N\260x`\264xY\316\277\0068\215zg\215\340\031V(NH\213\247\214Gm }k\361\026;\013\314\311\026@.>~\036s/Qj\254H\240\313\342\351h\370\253\307\323\204\300|\242<~\016\316\"\020\346\b\001\016cZ\251\312\246}"
+	.ascii	"\0030_\rW^\343\002lx\345Fz\206\322\177W\205a\323\246E\027\020"
+	.ascii	"\321f\"\256\016C2T`\207\275\310f\201\363\"\374\344\366kQXl\257"
+	.ascii	"\275Dl\301-\354X\214\301W\231\310/\025\314"
+	.string	"\247\340\327\214\240\353CI\235\017\374<x\250m\353l\366\365\f\355\024D/rP\337\211i5\016z\213$\006i\212!8\336\237\213O\252\260\203\031\271\314\341\213\312\351&\3309f\272s\342|c\250\342\366\277mi=\tZ\035\305\277\347>\273\247\210\206\267\337\247JJ\226\366 n\362i\222\024#\206|\3241\346\365f'}\363\021?\357\004\0317%\260\2010\3375\206\300*\2733\027\263}J\207Fc\304\321\004\034\2531\346\216\233\023C\223{Wm\202\333*\354{\257\024\354\032/\366\0267~\307E\357\034\343\314\274|HB-JMa\020<\222\325oc{"
+	.string	"\372\340\372wl\231Q\302Ku\362\241\210\345\266\255*\226\363\325Z/\276)Z\225\240\344\f\214C\205\342\325\035W[Qr\255!\243\313\2059+_,O/\316A.\211\361\007uH\007S]\314\354_\267g\367 H\367}\031NW\375]\200.\241\211$\237^I\361\205\257;\233\227\003\022\367/\"U\3705\244\336\203\222\267#"
+	.string	"4/\330\367\354\236@\2044\375\004P\313P:\013~\0028H\356\310*\0242\364\322\326>\234,g\251\n\037\367\234\247\231x[\374\321o\245\264\347\310%\207-\213e\374\344\020\356n\373\256\323_\006\257\300\260\361@\030\375\253\336\353\312\275\313|\324koE\327u\004t\355\200G$OA\211@\200"
+	.ascii	"y[\254\331\005~\326\273\311;C\017\024\254\201\004\327=\314>\037"
+	.ascii	"?\344\004J\036;<i\036\263\300\256\bH.q\251(\004\277\314\201\370"
+	.ascii	"\215-L\026\006\245\357\bgJDR@\277\371\310\005\035\323\031\031"
+	.ascii	"5\003\304}\250e*\263He\ne\\\307\201\325c\224\240\261\353^\356"
+	.ascii	"\301\002rc\034u\"\252\244\371$8\260\345[\367\216\nI\005\031\026"
+	.ascii	"RN\3423\346\321I\346\335]\307\004&\317\351.\304F\036\270\375"
+	.ascii	"\261\002\362@-Q\027\224\356M\007\314\232\271mp\n\335\372\201"
+	.ascii	"\330V'\212FTE\374\325\233\215\213\224\301k\t<4\334\263\316\322"
+	.ascii	"\374\034\217}\017Y\202\363\251\334r\201\265B\275[\340\363\205"
+	.ascii	"\257s4\022aF\025\365`\303\360#\215|\204.\030QkB\356\254}\303"
+	.ascii	"\361\016\305vV\205`\364\317\266;]8\303\255\017\243E\231[\206"
+	.ascii	"f\020\264\023\205\354\3731:\001~}\313\371W5\265B\375\303\037"
+	.ascii	"\206\002\265d\304\305lu=\001,w\200\227\316\023\2569I{\005n\214"
+	.ascii	"p.\263aS\nn\352\345\257+\323ib\262\202\243\365t\357\364m\025"
+	.ascii	"2\272i\311\375=\364\374\314\371\377\206\323`a\375\277k\252Sq"
+	.ascii	"\037W\207\323\021\273\221\006l\275Q\353#\317H\006\200\200\321"
+	.ascii	"\205\254\360\352\335cL\200#AyDS>\240\002\377P\260J\215\222\316"
+	.ascii	",1\034\260\270\255\364@\322\177\2352-\334Q\354\211y\035\356\013"
+	.ascii	"P\223\321\360@\035\325\304\202\333&gH\336\200\253\342\212\226"
+	.ascii	"~\230\222\006S\207\017\035\312\234'\336\226K\332\2014.e\031\321"
+	.ascii	"\352\003N\234\243\021c\334\035\361\001~\337\235\034\013\266b"
+	.ascii	"\3429\231\035na\357I\0364\225\220\013\033S_t"
+	.text
+	.section	.gnu.lto_crashRecoveryModeActive.197.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \345M\006"
+	.string	"\302\013,2`M\323\001@\003*%4!.\263*`\033\251\032A\303h\rkE3\215\330\316\301F\f\377\343O\264"
+	.string	"\260Y \273\336\276PW\006\274x\213R\246\024\216 \007\211r\226D\2044\001\341*\244\006\n\027U\026\016*\360D=T\316\232\246\312=q\257\231\324\003M1\354\217\234\344\371\032_\\yx\307\277\002\356\244\016th\271\3311K\365\260\017\260\232\261\235N5\330h8\016\267\335\313\266\262(\316I\210\355\333\306\354\307\t\n\230\337#\310\205 ec)Q\331\215N?\376\236\317\277\310\031,\031&\020\223=\005\026v\327\t1\033\267\036\301\266F\b"
+	.ascii	"2\003\316:#h\b\3055\261a\b\022\356\2624\033\336uo"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.198.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"m\n"
+	.string	"6\323HB \251*\035/\227`),\017\364\006\035Hx\330J\271\244\201\311\300\240\004\313OY\263`\f\324\030T{\374\226m\254\214\f\265E*\311\262\002"
+	.string	"\272HDe@\203\321\027\301H\212P`\3374\331R\246\0243"
+	.string	"7"
+	.string	"5"
+	.string	"\026\346\234rU\336=\256v\376e\307x_\352\361\362\372\306\007Z\n\004\207\217\025%N\030\274.\273\272\276\225\252\2053\347\264z\337\310\275\335\266\205mi\377\001\013\213\007\377\275\372\026\b\001!$wI\230S\244\206a\3166\005\001l?c[\325\246\250\350\016\2424\247\200"
+	.string	"\\0g8\341\210\3137wv\204\207+S3\001l\035\b\034\326\246\274\033\327\332\312\240\t*\320Pvc\273_\f\003\017Xz\301~\201\207(\037\200M'\275\367\315?5|\373\202\fh@\240D\2455;\\\351\306\354\307\031\037\256\303]\230>\241\213=\233\f\320Hr\034\033\240\016\r\031\002u<\244\207T\222\033\215E\243\017Ir\"\021IfB\325\343\\\030\306\201\311L\265\253h\321\270v\351C\357\371\262\007\016"
+	.ascii	"3\241\017(\360\202\327`\274\027\251\315\005\3618P\214\200\256"
+	.ascii	"\341\004\023\030P\335WR\343\304\235\213\252\035\032\230\202\002"
+	.text
+	.section	.gnu.lto_pidSetAntiGravityState.199.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"%\013"
+	.string	"&\224LC\020\251L:"
+	.string	"\354\365\315[\0236\177\264\022\373\221\346\037\336\217\355\335`\225N\324\214\205 \nK3\236\025\214\032\336\331I|A\331@\022\004\211\b\016\200\"\004\240\022px$\b\024\350.\204-Bd\357\235R8"
+	.string	"7"
+	.string	";"
+	.string	"\234\t\266\221\003\273\335\255\023\300\303\323)C\377\263kZb\352\324\365I\033p-9\006\221E#V\036\270>\273$\021WRb,v\327\262%\236\334\337m_\330\256\366'\002r\302\354\323\235/\373\262\237^\372\030\007\002\013P^\222`\327\244wao_\203\001\266\277\261-\245MQ\021^\206\342\234\202\002\231\203\335Q\302\020\231\177\016m\335\307"
+	.string	"\033\254]\325\203o\3404\333D\\s\355\362\017\214I\330\355$\203\n8\2269at~j\320\"\260\244\005\373\005>\242|\0016\235\344[\377\374\323\345\337gF,\307KQ\311\236=\246\002 \320\003b\230@\242\214?\235\215\020\251\202\036\035\241\017\216*\ny@\352\247\024R;\034\217H\240R\005G\243R\335\214{\272\363e\r\204\331M5W\246\023\001)\246\343\251\320\t\263}m\031\022"
+	.ascii	"3\241mh`\020\016\001\373\203{\007;\247\204\320\340\004\202\b"
+	.ascii	"\016\210\334\203 \016\020s\241k\370D&\274\222\032'\356\334T\355"
+	.ascii	"L\321\024\024"
+	.text
+	.section	.gnu.lto_pidAntiGravityEnabled.200.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \345U\006"
+	.string	"\002\314,2PO\323\001 \333\002\321\224\"\t\252%`(n&E\342\303\242\013/\205\204\330\306\336F"
+	.string	"i\200h\220\252\212(\004\352\354\344BT\326\030G\004I\231R\216 \007\211z\226D\2044\001\361*\244\006\212\027U\026\017*\360D=T\317\232\246\352=q\257\232\324\003M1\354\223\274\004\372 \276\270\362\334\035\377\n\270\223:\300\241\345\306\216Yj\207}\200\335]\253\306v:\325@\204e\343\335\311.f\363\262*\016J\210\355\333\306\354\307\t\n\230\341\343\007\206\240ee3q\331\215O=\016\237\320\377\310\031\266.\205\313dO\201\205\335ur\031\215[\217`;#\007"
+	.ascii	"2\001\0238#(\016%\\f\207\273,\315\206w\335\033"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.201.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"\215\n"
+	.string	"V\024J@0\247*\035\200V\f_\333\256zJ\370\241\305\037\252\352\331\270\373\234\320_\373x\212=\306\252\253\260\373[\306\t\236\234\032\344\372\020\317c\016\r\\\002C\005\353\217\220Y\341V\003\2240B\366\336)\0056"
+	.string	"8"
+	.string	"7"
+	.string	"\273[\347\b\bN\360tJ\320\377\352\223P\f\235r\037\237\264\001v\300\301\307\313\222H\242\025\023I\370\325%\2078\222\022\341aw-C\261\343\326n\033\302v\265\277\005\036/\315vM3\331\2724\004%\366G\233r\212\355K\373\002>"
+	.string	"\274\312\006<\331M\240j\355\256\203\031\270k\013\257l\327\350\023\266k\006\355\327G\324Z\032\2746\n<\b1Xk\372\263}N\260\030\220d\314>\201\263>~\312\032 \371\360\232\017\332\256}F"
+	.string	"\220\005"
+	.string	"\021\311\231=\206\344\024\261Oww=O\366U?\225\322\337\024\024\244\002\031\316\367u\236\346\343\214\271Pl:\365\323Xl8\025\025c#qQ1\236\247^,\356:\031\257~]\347U\312\270\247;O\236,\bq\211\346\210r\222N;\303#\037\232\316\320Q\001\016"
+	.string	"3\241\035h\f\255\301\304\260\227P\255\202\300!B"
+	.ascii	"\032\002\234\313\224\232\021\233\325i\340\032\211)$\236A\355"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_pidSetItermReset.202.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"]\007"
+	.string	"\202\31646P\215\322\001$+D\355g\265+`\254\325\243\006R\2602\257\"\013w](\355G\266\003m\032\243\276\001=\332\324\231\231V\005\016L\007\007\240\242\333O26\3312\245\231L\223p\331d\2261XF\343\310\016\303\202\246Q\220\033\355\322 1\234\203\304.o\234\214\223\235m\343\244e\356\253\205\243\312\351\303\024\202\021V\350\207|~|\016?x\364\336\243\357\001x\204 \215\2200B\232\262'Ha\206\375jw\327pd\377\373\265\0228\231T\374\202dw\"\225\262\246X\342a\373\026\333\252\266\301A\367\357s\035U\372J\273\263\300\004\001\217\356\354\223\317\215\275P\026\022\"(\273+\241\306\273k\347\037\344\025O\004\272Z\b\273k\365D\0247\274\355\001\333\230\355\216\007"
+	.ascii	"3\241e\037\270\ts\313\\\206.\251\311\340./\332I\006"
+	.text
+	.section	.gnu.lto_pidGetPreviousSetpoint.203.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\025\b"
+	.string	"\222\01787@\217\322\001\230E\202\300\273\212\306\310\377\f\221#6#\r\002\363\0308#\027\332\267t\210"
+	.string	"-\251\271\023\311c\321\353\032\b\214\256\006M\375\305\244r\217\332O\366\3362\245\244\214\"\024-\002)d\243Yrh\310\036\030fD\026\202\230\242\2154A\002\326F\013\333,i\3326;\336>.\\A\370AA\213\212\237\330\265\331\335\003\277\344&\022>\353\322\023&}w\351\233 \347\205\322\317\366N\n=\354\307\205+[\325\360\255_\243\347\005c\343\252\230\335\214of[\344+\3046gw\364-\263\230\263\333\221\262\262\273\006&\330\\\332\366E>\302\331\256\350\201\260<0\034\027(2\273;?\017\300.\343\001\260K\370q\356\312\371'y\202\213\352\353R\247\253\006aw\255]J\343\206\267=`\273\300\266J\013"
+	.ascii	"2\241\245/p+\n\"\026\017b\002r\r\327\304\342\341!\210\250p\003"
+	.ascii	"PyL\355$\003"
+	.text
+	.section	.gnu.lto_pidGetDT.204.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \367\305\006"
+	.string	"\242\f/4`m\322\001@'\232\222\003\365\372\034`\210A\016\276\250\177Z:<'\013\264Yy\240M\245\334#_\321\006A\013\021\350\252hp=%\013^X\262\211\224)\005\266X\b\327\345a\030\026\256\006\205\367p\0358<K\006\361\254\001c\227\204\354a0,{S\334\253'\265\322\250\204}\220G\203\374\315\021\376\344\265;\337\037\351.\025\300B\223!;fR1\354G\253\036\373\351T\312d\253xgdw\"\224\262$N\204\3036\264'\277\343\036\320\006EQc\243N66!(\273\373\252\013Hw\321\003\244;\3158|B\377\0377\330tJ4N\346Y)\330]\247\306\241\270\365\004\266/\002\t"
+	.ascii	"2\003\346:\203k\b\3055Q8\004\216\031\233\270+\322lx\327\275\001"
+	.text
+	.section	.gnu.lto_pidGetPidFrequency.205.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375 \367\265\006"
+	.string	"\242\314.4`M\323\001@\247\005\024\320+.\324\301\020\203\340 \240\357cC\304\216B\231a\255<\244me\360\013~\250\025\344\0064\007\333\027WA\2739\304\336D\312\224\002\266\252\204\253\362,\r\f\227\303\302\203\270\020\036\236\225E\274\212\300XE!{\026\f\313\236\024\367v*\205\321\t\373 \217\336|\216%\354\311kw\276=\321]j\300\005&?v\274\244j\330\207V3\354\247S'\223\021\213oDv)>)[\342H:\266\241-\371\035\367\200\366\006E\016\316t\322\311\204\240\354\356\243>\020\335A\027\210\356t\343\360\t\375\177\374 \263\3314\315\345\t`\260\273NMSq\353\013lc\004\t"
+	.ascii	"2\003\3020\037!h\327D\341\0208fl\342\256H\263\341]\367\006"
+	.text
+	.section	.gnu.lto__reset_template_137.5.207.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\265\001-\017"
+	.string	"\326\232`E\300\032%\351@@"
+	.string	"$\304/\370\320\255\210`E\213f\301C\315\367\327\273u\370\273)@"
+	.string	"\200(\212\001\001\030\200\304\220)\264L\262\fA\020\004A\020\004A\220\201\302\330\256\240`\035\247\354\200\320z\332\206m\251\005S"
+	.string	"S"
+	.string	"G"
+	.string	"a\024\314\275V{\254="
+	.string	"\027\bw\316\325\311z\350\005\214\0052xhTx\2330\347\246\343\271SRs' \305\243g\233#\352\222\006\b\335%\271S\275\351\034C\333\272\267\0049s\252\003\2527\002\325\264\356-\203"
+	.ascii	"\336\2435Q\230S\275e\001\262L\363\t\3032l\244\341p\303!\207\271"
+	.ascii	"t\270\213\207\363\303\t\342W\210\223D\f\216"
+	.string	"\030Fb\244\022\267L\234'\216Bq\230\342P\305G+\016Y\264@\340y\371\313`Vzi1\217\221p\231\b.t\236V\223a\r\345 d0\307\264s\223\323\203\006s\261X\021\353V\272c\242\3668\353\343+\375\361W \0275\310Y!\033u\310\257\0229\353\363\327\"\2035\362\327#\203ErV\311A]2\22629\333\344\243:\031\326'g)\224\263Q\316\376\334*\320Z\352:\2640\322\205\267`\b\231\201\234T\226i\331?1v+.\r\024\231\226\022\235v\305\247\275\b\265\027\243\316h\346)\361\314A\021\315\031\323L%\256\271\025\331\374\3056\013\3057W\211p\316\030gWg\234\2551X\033\017\365\306Y\034\177\315qV\307\0010 \300\"B\262\003W\211\033\354\207](\007uX\236\303Rc\254\002\256\347\240u2\034\314\365\022\342k(\271 \031\340b\252\241\217>\037\327u\244\322\336\316\031u"
+	.ascii	"\374\236@2hCF\026o\007/\321\356\007\026\273\020!3\2000wm\006"
+	.ascii	"!\365\320\2473\262v\002\331\326\026\00297o\031x\021"
+	.text
+	.section	.gnu.lto_pidInitFilters.part.0.265.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`>\036\025s"
+	.string	"Z\264 (J \224\322\351\312N\276\341@\024n\tdc\212\265\0011\346\036\345\022\317\235Z\361n\251\327}\327?\275\022hfT9\274\007\340O\300<\327\307\270d\221\344\356\322\311\357b\212\025Q\204\315;3EP\252j\326\2156\221\335RJ)~\002!\002v\002}}s\374\366\366\224\320\203\362\355\355\275\355\025Q\343\340\3355\211\200S\204\227\347\0337F/\240\353e%,\013\033\273:77%\372\202h9n:!\224\3349\216+\343\346\364\240\321\364\031\35685iD\250\262\274\367\246\021A\345Z\232"
+	.ascii	"[\203\353\273\367\006Q\3210\027\303\250\334a\224p\217\3512\355"
+	.ascii	"\344\"\234\222~#\201\215^m\367\211[\233Y\373\215\004\225k\251"
+	.ascii	"\272\201a\341\241vj\f\366\220%\003\004\020I\214]@\327\013\214"
+	.ascii	"-\213\r\265\323\037\224\264\017I\330\330\325v\227\313\026\323"
+	.ascii	"=\254\355C\022\365\236Q\233\270=\373\356m;v\3120\324N\201\274"
+	.ascii	"\310\356\335\246\244w8\301\250\355\212-\331\235\271\301ts\355"
+	.ascii	"\035N\350\240{\251\320\235\271\267M\252Sf\241v\312m]d;U{\310"
+	.ascii	"v\312\334_\230Y\311\222ye\206v[\332m7\263&> q\357Ev\3724\f\213"
+	.ascii	"\204\230\224\240\246\370;\330\326\374b\2706\326\225U\214*\030"
+	.ascii	"/\250\220SRQG(\027-X<9\255hR\301d\\RJBJq\204\302\350\204\211"
+	.ascii	"\"\242!\241 \240\037\237\036\236\"q\250\nm\032|\227\261rs5\226"
+	.ascii	"\234\276\022"
+	.string	"f\241\211A\333\n\312\3471\366\272jO\317a\344\001\336\371\013\274\246\302k\344s\216\235O\265i\2516\0355\347Y\347G6P:\207\022f\315 \266\246]\254\351\026\320f\032b\311F\bg\361\024F\347\207&\346l\247\036b\t\267\302\314\2337\231\321\242\302\r\017\bg\"\323F\274\226jjA\023#\323Knp\300\270R\263\223\3404\016+^\374\320\304\232\215\264\203\016e>\205\017\337\232\037\232\230[\037}\t\032Q\004\215lA\2433\0077:!\314\2222\323\202&\346\245M\274\251\342EV\232\350MK\205iA\023\263\322C^\354jp!\265\016j\273\306\261\246\204\037\232\230Z\003\2555\3322\315\026\251\305\2551\023\332\362\312\377lY\302\340>X\246x\217\224\346\t\032\245\004\215\316\027\274\210&f\326\304 \220Y\220\212i\313\222\314\207L3\210\225\265*\314\242\353\033kN?4\261\262\026\006\241\372\320"
+	.string	"\0269\271\242,>i\342\366\313S\342\223\026:8\304\322\205\342\023/\177\237'K\202\306{o;\333\301\2360q\027j\031\302\254{/w\027\022\315"
+	.ascii	"4s\260\215\231C`>\352d\3100c\344T#\347\371\236g\356\341\200\267"
+	.ascii	"\322\347"
+	.string	"\215L\236\213\211\337\363\375\325W|\236G\241\256\316W\037\004>\220w\367v\265\222\235\211\177MP\301\017o\345\217\270\366:=\345\330\217^\2301\302g\262\226-~C\275\253\370E&F\2605\3553\271\361\272@\203\303o\266.MO\237\370`\314I,\361\215\256\330 &\357\233\237\321h4}\346\017\037\t\233:M\356\004\325\3777\"\246\215\360U \035\025~\372\327&\360\233F4\032\375g\332\377\327@\314\323\313\223\340\364\355w\223;\234A/\241\245\336\353u\305mg\004!\334UN\260\235\246\237r\261ck\372\377;\234\2576]\316\346\340\275]M\375\376\375\265e\211G\231\033\211\016d'w\025\346\200\341\274\225\fg;\355\377\233\013$\353\362\250?\223_\306S\211F\243Q~*\314\030Xg \326\371\002\353\374\203\350l\201u\256\300:S@t\236\300:K`\235}X\347\b\2543\004\326\371\001\353\354"
+	.string	"\321\271\201\036Eg\036\326\231\001\353\274c\350\254\243\377\232\027P\235\025H\240\350\214@\3735\347\260\3168\254\363\r\353|"
+	.string	"\321\331"
+	.string	"\033E\347\002\232\257\271\206u\316\262\3164\210\316\004X\347\001\210\3163\254\263"
+	.string	"\3269"
+	.string	"\2423"
+	.ascii	"\326Y\206u\306\262\316W\326\331Ju\216!t\256\2021t~\321w\315T"
+	.ascii	"\326\031)t\236R\235\245\242\212\316\307.\242\031\312:\273\260"
+	.ascii	"\316-\204\316,\254\363\023\321\331Iu^!tnR1tfj7\315F\353\274\244"
+	.ascii	":+%\025\235\221\272\2569\205u>\262\316(\254\263\021\321\371\204"
+	.ascii	"\352l\242H\350L\324?4\017\t\r\235\203Z\210f \325\371\247\325"
+	.ascii	"4\373X\347\036\353\314#t.\022\233L\363PuV\205\316B\325\331\n"
+	.ascii	"\235\323n\353\0166\\\363[g\267\316\335d'\216u\367:\211\332\271"
+	.ascii	"gi\020X\032\256\233L\367\017\335j\272\205\350\256\353v\323]D"
+	.ascii	"\367]7_\267_\367_\363077\035\300\2771\316\025\0023\246\370\336"
+	.ascii	"jf\245\367b\352\221xS\337q54\343H}\343\265\323\3303\220\314\210"
+	.ascii	"\225V\304\022(zr\322\254\t\\J\212\3724\017\351\330PPJP\037\365"
+	.ascii	"MGo\214\213?\276q\263\226Y\335\251\371s5\233\272k\223\214\256"
+	.ascii	"1\034\237\276\205\013\026\337\342\375\215\215\026\213\3579\274"
+	.ascii	"&\335\3237\234v\032\253\013L\302J\223[\002%/z\246\217\352\220"
+	.ascii	"\324\260\317\220&L\0074\354hg\302\256\300\275\225q\342r7\247"
+	.ascii	"\027\342 \027\330L\241\004\304\222\021\362\236G\317\344\025s"
+	.ascii	"\304\3245\375\212\027\276q\333\275\027\3053\233^\0031xL\374\207"
+	.ascii	"\246Oq\2103Z\022c\002^\235\023NmxsR\326\330`\202H\305\247yC\307"
+	.ascii	"6\032\213\214\257\342\233\316\235\234\031\256\364K\317\224\302"
+	.ascii	"\n\366\005fH\230\353Pc\306\332\364/\253\231U\016LE\277\344E\351"
+	.ascii	"\373M;\215\215!r\342\203\313\235\223J\267\263[\205\271\350\320"
+	.ascii	"3\371G-(\351\323<\240c\247H\361\016\205\212S\223\023J\361I\337"
+	.ascii	"t\236O,?z$\026\326\026\214L\266l\021\255Q\\\313Zf\225v\357\275"
+	.ascii	"\342\034\236e5\233J\273\342XV)+\fk\fk\f\266S$#7z\0242\034\025"
+	.ascii	"=\n_c'\223\341\214\276\355\332\251"
+	.string	"\205;ldA\317d\032\326\032\256\322\3265\261\347\234r\314\317\372\304\0347\\\276\004\177\023\343\324\342\200\236\311L\366\031\232\312Y4\213\307\300\216\326I\366\354\202\005f\271\367\272\360)|/WOav)j\332]\262+oXY\226{v]T\235y\371\035+n\266b9\361B.v\330\232?\317d\023\377\337I\210iS\364&\276\325\264\2116\271\343\003\246\311C\364I\276\334)\016}\321\203\371\355\242G\202\351y&\317\222&z\rV-^\246\245\022}\312\345\217\315\006\217\242%u7\364\017GN\361\231\\\326.JP\332\331A@\273'\367A\001\323\205\370L\356\311S\205>U\023\036\033\350\301\244\032\350\275I\343\212R\3120\252\201^\350\273\256.\3725\245\311\273\327/\326\347\177\276\347\203\236y\005\263\356\340\255\344\340%{.f_\016\361\271S2\363\005\356\244F\324\335\275WF\247\354a\276\202\r>"
+	.string	"\007\016\333i\320\267r\314\225\016\206\200\002:t\330N\177\276\351\272)n\217-[}d\253\204\f\202=@\260H\216l\211\020B\222\035I\264@\020\"B\bB\214\334\b\262Ud\310\204\034\035h!!\262c\210\021!\017\004\3411\241\003 G\216dP\204\004\"\037"
+	.ascii	"\031bD\b\222 @B>\330\332\200\210\021\036A\266\212\020Yk*\310"
+	.ascii	"V\021$\222\0168\330\372`"
+	.ascii	"\003$\b[\031\fAj\0319\202\2342b\"E\204\030A\"!B\304\b\262\330"
+	.ascii	"}\263\272~\t\226\325\005/@\0161\330\331\004\004H\235\023\t\357"
+	.ascii	"\352\307\005\237d\367\265\306\202\377\361F>X=\363sh\013\336\007"
+	.ascii	"\212\346\351,\370\341\234\\`\263\202\237K\246q;\345\0343F\330"
+	.ascii	"pF#\032M\202\202\257\340\355\333\327\226\t\236\202w\276\270W"
+	.ascii	"3\301\017\343\310\2615%\b\002\315\234\217>U\0023>\336G\\\214"
+	.ascii	"\b\312\220\241\203\200\030A\017\020\274\320Y\366@\030\036\330"
+	.ascii	"8\340\306>\360:8\360\037\005\016jJ\035\224\252g\256Xl\003v\317"
+	.ascii	"\326\200S\0278\266&\f\300\226R\243\352\361\034Db\360\013,\360"
+	.ascii	"~%\370b\201\357\361\255\006\211:\f<\017\034\266"
+	.string	"\270\254eN7<\223z<v\250\fd\331\361B3ed]\n<;\373\314\307K\307W\225!<F\374Z\r\026\257f\343\r\016\035\337\312\261OS\340?\312\230\247z&\373\324\261\033\260\325@?\350\361\330\030<\030#\245\022\370T-\352\3309rL\345\370\004\276\305\344<q<\002L\350SY\313V\310@DR\017\201\003\376\006\2163v\302a\270\033S\016\370\236\323Mrw\330\244\242\236\n\277\2236\340\005\003\276\235\3354\266\304\361\231<t\301\205\215O\325Z\034\273F\215o\250\337{\271\240j\274\215o1h\234\254/\340\313\266\222v\236l-{\272\373\261\217\222\214\223\304K\352%\365l\247\005\f\3604\262\bx\032\337,$\345$\371\222G\020\360C\262'\003|C\273I\0160\220\254\355\231-:)\307\316\370\260_!)\307/yD\362\b\333\351\214\377\261\277@\262.\001\300\224\177[\336J\031\037\200"
+	.string	"\017\300\007\360Ru\376k\305\002\300\317\300k\276\227\214\217\200\016\033\031\013,\307\372>\363][\352\337\347Z\313\002\267\266l\247Fn\365WXU\177e\307\352\177\f\312\026\370|r\002L*\261\344s\346\365\241\001t\212aD\325\307x\373\267\242*\271\204\323\251\372\024\207\275\246'\277\275\347\033\233\026T\030a|\232\267tl**&\252\207QG\352\221\377\002\312W#\202m\250\302X%\022R\247T\215\210H\222$\031\016\362\013\020\006\343@\212\255\274\001\022`35\315c\224\031ElD\024\024\026\244\214\224\206\003\3443}\2629\036\235t:u\005\3406\367\326\200\274Os\324\360\354"
+	.string	"\272\230\250\fkC\267\244\001\305\3610i\366\2272\021,\n-w\002\311\253\323~\322\317\300\245\217\331q\212\324\0259yR\240\342\335\344\255\274\370\314\360\205\373`"
+	.string	""
+	.ascii	"\352DO\352\34162`O\373z\247\314&\232D\025\316\224kE\326\242z"
+	.ascii	"\206a\236\"\220\266\333J\371\370\363\\\341\260|#7\2571]\276\252"
+	.ascii	"\313\255\277b\022T\005\037\356\007K\002\222\t+\336i<\311\007"
+	.ascii	"e\257\324\t\"\2038\263\267\347\023\203`\332\271\200\373\223\330"
+	.ascii	"?\314\220C\211{\3763R{]\214&V\007\217\020=KY\242\245\362<\340"
+	.ascii	"a\005\303\314\013\341\274\224\271\031\345LFdU\235\223\210\210"
+	.ascii	"\217\345\344\373\374)rf\362\347GOp\334&\310\224\276\003,lM\033"
+	.ascii	"\211R\223\237\366\227\313l\225\21646\350\305A\246\005\321\364"
+	.ascii	"&\"i\2160q\353\217\271\234\260\256'\335\t\377&\235\3663\346\256"
+	.ascii	"^\327\217\306g\n\341\251\017O\311\2220\335{&Y\027\302C\016\r"
+	.ascii	"\017\207\0375\356<\312\321\227vF\306\356\265\005Y\305ia(\226"
+	.ascii	"6\033\3250\350C\335\375\356\261\\\354\300L\231\324\241~\303"
+	.string	"\0202\317\221z\245\234f\301kb>nxG~\320 \002\341\026\304\324\f2\205\314\271\306\215\330\333\311h\320_c\241\305vd\326\241\277\202\277\033\037E\005\236\210|DO`\001Z\005\255\\\254\225}\276K\314\016Oz\022\224\250\223\t\2302\212\262\264\2043\032r\032\275\371\005R\256\357.\033\216\323O\f\3258\030\236\344g\b\202\332 \215\035A4\330\344\215\241\"U\363`\211!\007\250\374\336A\303Tq\271\223\313E\200=\0035\367\246\321\017?\f\311O\373\202\252Wg\035R\253\373\362j!Y;\023\241\340\301\210\327u\257\t\bl2U\004\342$\356\027$\342S\fA\200\001E\001Az`\177\302\27018\271\030kW\226\226\317^\023\021\021\237K\243{\275oD\222\366D\205\016\2370\336\007\3676\350O\353\177\234is\007\254\324\312C\223\211\210\231\221c`\342\316\304\350\273\313\b\230\344\266@1\222\221"
+	.ascii	"\241\377',\f\246\257\264\375\335^(#4F\\\364\031\212*\363\332"
+	.ascii	"3\224\t/uv\234\226\270\213\232\204\252<\326W\f/\343\017\341s"
+	.ascii	":\257W\210 \205\031\264M\204P8\311p)\330+\006@\202\025^J\213"
+	.ascii	"\201&Nz\316\223"
+	.string	"\353\207ev\217\277\271\tN\237 Y\022\327\203\231\334\256\n\226\261'\370]\253\252\364\311\3320\177\350\356>v\2231\250\305\360\313\336\354{\365\220!\0217E\372\300\361\3225\025\304\3426\222\t\035\032\226\253\370[\204\023lD\004\361\230\345\006H \226\025\255n\320\321`+h\207\325.\212O\2633g\003\266\004C\b\321\334\\\356k?\201\201VlX\013\013k\211\303}\020\264\246\375F\023(MDj\254~\312\265m\371u\304!\215\240Y\0269\312\375\007\274\361\317n|E\013\240\026\210\226\264.P\234\231s\005k\202\341(\251\354`$\264\024\223S7\251g\316B\023\227RKO\n!\250_\227HA\200\330\263\034\204\f\223\213\210\323\005A\273\353Q\340\013\216\222Zk\344H\037\007\243\006\220\2735\327\374\361\361(\032\202T\240\260EL!\r\b\264Y\032S\373B)\306\254X\245\272b\025Tl\256\240u\202"
+	.string	"\274~\325P\304\200{\355^d\3060\210\242C\315\327e\305\326\222\274\323#\347#\n\323\315\024\271\376\260\ny\371\006\262\230\242\210\205s\002$\210\344\221\2131\302\372a\343\356\003\350\230\267{a\251\310=`)\240\201=\"\253\360|\325.\272p1\215\222\307\230u\311\377\352K\207\236\261\304VE@*\276\005\f\206\307/\027\026@5\277 "
+	.string	"\275q(e6s$=:0S\244\263\317m5\001\026\016\241Rg\031"
+	.ascii	"\231[Oz\356\025\236F\256\260\006\220\026"
+	.text
+	.section	.gnu.lto_pidInitSetpointDerivativeLpf.part.0.266.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\234\004\025\035"
+	.string	"\226t\263F\240\232M:l\233\372\204\212X\257\332\363=kq\031^6]!#'+\373\304\0219\243\231\001d\350\031\324\266\365\344\243ou&\356\365\022z\f`\022\f9\300\213\207@\025\370\033\225\272\205\313\266\215\220\275\311\336)\005\231"
+	.string	"\233"
+	.string	"\233"
+	.ascii	"tv*\357\303]\n\207\364\355n\347)\355C=*w)\034\246\273MZ[v}\021"
+	.ascii	"N\355@<\345y\201z*?\240\236\332\207b\033\267s\316\376\272\217"
+	.ascii	"\310\376\352\311\016\252\260\335\245\235\316!\236\007}w(s\027"
+	.ascii	"\303J\301)c9?\334Pu\006v\262F\236\356\"\310Sf\007\004\234 \231"
+	.ascii	"xI2\224\343\222\037\2579\336\3200u\266F\236\217\203:d<\245Z\240"
+	.ascii	"\b\226\021\313\221\2674\347\257\0162\241\363\033y?.\005<\026"
+	.ascii	"n\330]\037)\310-\273m'\266E\330 S>\227w\021\362\217\330\006C"
+	.ascii	"~<\365a\324S\025Pa\275(p\220\344O\316'\317\330t\372\375~s<\235"
+	.ascii	"\354YLZV\245c\242\264\030J\207\267\272k\225\246U\032\274\357"
+	.ascii	"\237UZR\351\0178pAk\227\307\257\3166\321.In\365O\371\253|\332"
+	.ascii	"\367\257\334\212\177"
+	.string	"\345\231\025\316;,\317\222\273\026c\365(\371\226g\202NX\224\260\335\005!\236\366\200R\356K\301\371T\257\362\254\n\025*H4\210\237b\n\026p\237:\222\bV\027\347\301)\005\013\271O\035\235g\223\314\214\025\304\007\222\316p\332#H\310\217\366\275h\030\350\032m\337\276\246D\206\256\335\305\240\346]'\374#\247F\221\"E=\r\347G\037\002\244\234\340\264W\260\220\037\351\354\3211u\236\023\234_\002\363\315\374\214\257~le\253I\263\320<\271\230/\350\301\245\223v<\377\335E\002\271|2r\253\311r\\\036Y\224l\323\372h\371c\374%\356\352\336\373\025T1+\t\354\230\304\n\330\356\372\200\361{\366\277\210\276\365\351Q\222w\354c\335\313\021P\255VO?\205D5\365\240\200\314\335\325\315\371t\241\032E6\033?`\215\350\206\tY\221\315\006\007\241\032-j.bAACF5:\334jF1lA"
+	.ascii	"\f$\301\205\215\210f\364B\310\026#\2106\303\366#\203\006t+\242"
+	.ascii	"I@\340!\242\332\215f44t\243\311\177\247S\325\305\255&\\H3I\234"
+	.ascii	"O\016\340Ug\223\026\221\017^'\223mGx\2352j\312KI\316\361<\270"
+	.ascii	"\273\033Bx\235\263y-:\277\245^\322\227_\332\331Q\033Hq\306\246"
+	.ascii	"l\3329(9\250\24572\334\344\244NE\004\354m8t\360\340\241\236\312"
+	.ascii	"\346\214\261\371\327\007\020!\344\307\020\365T\2344+\215\234"
+	.ascii	"\255\023\330\nB\023\004c\250a(\307\020cDH\206\204$I\222t`\002"
+	.ascii	"\2312\263\035\021\220\301c\246\005j\317\254\256R\213\224tl+\301"
+	.ascii	"IZY\351?p3Q\300\021U\007\230\377\205L2\244\020\327\245\013\244"
+	.ascii	"\\aX\240\316^\2724`\256\205yZ\301\261\204\3014\301\316\302>\242"
+	.ascii	"d\246\204\036n\260\251\360[\323\323\344\201e\241`\377\021\223"
+	.ascii	"\204\242\227\273)\247E\302\"\315!\rC0\273\177.,^ P\360\357\273"
+	.ascii	"gC\266w\305f\2410U\344\220W9\020b\003\276\331\035Z\f\271<\t\352"
+	.ascii	"C\273<\300y_\300\220\323\266\013\220\230*\360\274\031\016(=\314"
+	.ascii	"\234%\373\3454\370\254!\263\270\n\344\032C\206\0203O\331\301"
+	.ascii	"*2\334\343!\225{!\272\225\260|\310\204\330\035\322"
+	.text
+	.section	.gnu.lto_pidUpdateSetpointDerivativeLpf.part.0.267.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\310\003-\031"
+	.string	"Fo\235F\300\030Q:\300\021Y\ba\003T\323\265\351\2445@*\244\0174\\\363\345\277\304K\331B\316\332u\003\375ho?`d\025\206}\227\321e\261\fA4\0252\272\216\203\234\333\n\022\"\by+y\333\223F6\221;\245\206"
+	.string	"\202"
+	.string	"\206"
+	.string	"\270\255\325\254\322\276\220\017\211\235\310\013\317\335\033\225&\273\270\007\237f ~\322\334&\374\224/\020~\332\017b\033Vs\314\356r\\\216\375\316\350\347\310\230\335U}*\016\353A\334\035\312\330K\341\004U\2121\377\271+\370\365F\233\354%\220fw\005\330~\300\bR\206m&C\313\361G\215O\030_\300\023\035\224r\3067\332h\\i=\241\215\016\336\216\223-\206\312\233\213\245\n\273\353\317l\334\246\333\276a{\202\255U\002LX>\017\247\330\221\037?\375\035=\321\027\364\300"
+	.string	"\2611\223?\353uweR\205\254\242\006\375~\2772\326 \033%J\237\246\264\251$-\206\322\245\017\335\341\224\236S\032<\356\327)-A\351\0230@\301hw\306\317\314\336fQ\217\017\375\366\375\241\027\361\211\214J\002s\212\206[[-\347'\271\221\037\211\035\211y\242\254&*\331\371\274\354n\203OK\020?S\340\375\034\314F\241>\345q\260\023y!\0035\276(\340\215\234ZR\373\003\b\371\321\376\021\317\r\322h\333u_\210\033A\332\335\tSNE\204\317\343\323#H\220\b?K\372\261\306"
+	.ascii	")\025T;GG~\234\232\212\2412\253\202z\037/~\224K\361\356\204u"
+	.ascii	"\326\351\354\205\271\223'(:\222\311$\353\277\2733U!\033\212\337"
+	.ascii	"\223\274\233\345\2703\270\370\330\333\342\024\371O\334E\334\225"
+	.ascii	"\035\350G\020:YY\263c\017-8;\037\310\276N\304-N\212&\317\330"
+	.ascii	"_\362<,\027%\300\325\252\365jq\301\245\363R\301Z\001p\016\004"
+	.ascii	"\023,\026\252\027\212\023,\025+\325\nV\211\035U\216\213G\005"
+	.ascii	"\341\200[,t\\\252W\253\345R\241l\313\1775(w\321\027\346h\246"
+	.ascii	"="
+	.string	"%\025\362\324!6x\200-\023\245\241\312\260\355\007\017U\016)\262\205&\313X\017\356\356\206\016\036*Jo\224\364\363\001\352\321\3752\351g\246\244\250&=\251m\341\202\217\226\026\022\206#\311\201\345Y2h\330\260!\374<\251\232\254\374\n\207\016\036\344G\017\341\247\250\263'\206\f\357\001O\250a4\306\224BFHfDD\302l\013\035p\002\231\262:\017\020X\212hA1\007\"\204\255\n\023\311 +\377\347\327\242a4jk4\331\223\203V\013\027\205a\374\235E\332\322E\363\320\253)!\\e(&c.G{\200`ya\217\200\354q\353\265\226!'|\r\255\320g\340\361\306\004{\340\345S2A\255n!|#\216\334\017\216\301\316\2227\351\272\210\nyV\355\216\003F;*\350\261\344\214\224\253\226\037\362\001\003]\032\342^\036O\363\335`\266q\266\226\325m]\313\213\262\002%\373\222\344\372\362\230\034\273"
+	.ascii	"\241\215\232Q\234\006"
+	.text
+	.section	.gnu.lto_pidUpdateAntiGravityThrottleFilter.part.0.268.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"U\013"
+	.string	"\026\326L@ m\225\016\f\2010(:.#|\227k}\240\205:\241\335(3YC\211\276\340"
+	.string	"\342\001\266ac\004%\345"
+	.string	"G\013\\@\337+\001\004\231H\026\213\313'e\264\236\251\331\267\306\262\241M\244L)9"
+	.string	":"
+	.string	";"
+	.string	"\020\273E\344\320\376\004\333 \222;{\304\277\007[\221p\342\200\252\304\356\306Cu\360\356\232X\347?\365\211W\n])J\t\236\025\307$\035\273\353L\301\ro\233\303v\264\357\021\231\316\177\377%\311 \343\303.\202\227\211m"
+	.string	";@\260}\373)\220M\241\034\332\316\374\007\302\276E\221\234i\237\302+t\267`\226'\273\036Bp\330\335\215Ckd\207\030\277\210<\036\tQ\276\234zU\205 \fD\030\345\313Y^\177\341\031>\331\256\350\236\257:\006\001>\352\320\236O\336;\364?\003\b\344\275T(\302Uj\025\320P\352\311\212\035\333\335\265\232\254\001\230\r\307i[\206\313|\261\200h:\221\313"
+	.string	"\320lBb"
+	.string	"\315\007'^6O\264T\254u0[\3444m\213\224c\253&g\256\005-\221\216\254\252'\333\252\276\206o0\313G\231\343\225W\252\025"
+	.string	"h\213!\266\002\343\001\221\330hB$\326\262\031\3242\255\202\367"
+	.string	"\n\027;\266j/\r\r\201\\\235\241\211g"
+	.ascii	"\233\311;\315\002\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_pidApplyThrustLinearization.part.0.270.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\035\001\355\f"
+	.string	"\006YVA \217\223\016\2409\001\343;a\006\220\033c0\330\210\314\2605\223H\211c=\022\337\007\361yT\352E\317\232\032P\3329z7\354\217"
+	.string	"La\364\326D!\230V\214N\b\rP\242\t!d\357$S\nD"
+	.string	">"
+	.string	"C"
+	.string	"\265\211\020\222\266u\t\253tZ\223#\201\020i\2142\\h\211\221\231\231\337\206\tP~\316\003(\277\247\270\343\243\353\324f\261\002\217\313\013P\211\210\017\240\304\304(\300\256J\220\231\2658\270\317m\021\264=\320:%\227I\256\205\330\n\261\024b\037b\035bo\222\215\2105\206!\016\225\314\r\247\031\371\341\251\b\321\232%\244\305\332N\213\025\321$\257\244\210\244\210^\251\251W\346\n\026)2\323\200_9,\277\006 \034\312\240\352\033\026.\322\367\237z"
+	.string	"\027.\245\217\007w\367W\242\340\356\026\241\027\031x\377\367g\204\007O\255O\270\245\246Z\324\n\205A\203\374\352\302P~\276I\204^F\035F\360\204G\351\235\313\237\264\001\033G\263q\026l\264M\373\300\352\321\321 \243\311\266\b\0202\022\036d\0232\f>2\217\rH\326Q\240\232\306\301&\3334m\223av\371\223j\224L4\240\365\353\030\332^w\f\214Q\314\310=?J[\367\352\326\217\342#\242B\352m\032"
+	.ascii	"1\033\303\327\r\303\307\020\260\250\310\\\005\017p\001\343>\225"
+	.ascii	"F\254j\020<\005\310\\\335\372f\263\240\026B\303\252\256\226\326"
+	.ascii	"\212\330\t6x\332!V9@\023\234~\247\347\2024%\265\234~m\031\003"
+	.text
+	.section	.gnu.lto_pidCopyProfile.part.0.272.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375` \002\355\020"
+	.string	"\366\236mG\360\260(\035\353E\232\320\205Z{\336\210\034\323\364\356\030\337\2732\343\343[7\327\272.O\362.\2662~/\267P\016G[\377\025\214d\003\342\3578,X\314\354F\\\303\206\221\345q\270\242.F\330\354g\262\211\334)\005S"
+	.string	"\\"
+	.string	"Y"
+	.string	"3&\225^\227I\371\\\226\2325\332\244\022\3542)\326]\01628\273\023\301\245\017\200.\355\233\260\375\252\031f\337\370\fwD\"\\\251\351\331\335\357R?\034v\215\035\314\377\355\036\264\026\225k\200\226\013\217\242w"
+	.ascii	"\026\354\256A\030ny\333%\333(;\242\004\247\371\357\021m\0372"
+	.ascii	"vYv\344\330\0162'&\216f\350RS\361r\253\333\r3t\371-7O\364\354"
+	.ascii	"\204\371a\333\317=\205\313-\255@!\346\201T\243cV\242gw~\227\236"
+	.ascii	"/\340]\202>\300\363q\004\302\327\334\306u"
+	.string	"\024>\217Mg\304\356\272\242\177{\331\241\020\315\234>\n4>8\233\365\027.<=\256S\251\277\275\303\261\351\310vn~l\236\323\352V\2044\224\267(\351j\204\273\233\200\305qR>\210KGX\305\323V\336\245\352m\336@D\214\215\0200r\032\256Q\r\310r;+?\261\270#*\214\265{\267\372b\313hO\243\345g\376NF\253F\307\0361\251V\"\t\250\223\t\003\024\t(\222R\205\234\300\020\326\352$\262\t\344\004\236|\254\221\007 \211\310g\002:(\371L\252\325\0072r\352\004\245\372X\251\224\352\013\331\216\357V_\f\3021\203FLe\2520\266\005\304\317\356\030\236\252\2476\b!\236\346\337~\0137\031\246\017\317LU|\334u\002- \200\202\031U\354\0025\f\3666\242\266Fld7\242\337\340\311\002\203Lx\177u\301\333\3614\006\221\315v\253\323\031\030\333/\321\031\346\017\327\315\002\255?"
+	.ascii	"\213\025\206P\367A.C\226a\244m2\017-\267v\207\204\023<N5\243"
+	.ascii	"1Z)\235\203\231\204J\254\346\341\355\274\025\013`{\321r\372\247"
+	.ascii	"_k\306"
+	.text
+	.section	.gnu.lto_applyRcSmoothingDerivativeFilter.part.0.278.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\207\004E\035"
+	.string	"\326\264\266H\240\330M:\001\017\314\004\255\343\0049\305\355%\333t08^\013g_\245\210\275\203\003Z{\376!\001\310\260\272\017\3372\236t\352f}v\236G=\317\342\007\3107\360:`GA\264\330\005!a=\324\335\032![\356\224\002\242"
+	.string	"\225"
+	.string	"\245"
+	.string	"\363SMj\3246q\226\0252\017\346\274\024\021\225\252?%\317y&\3462\255\326\036]Z\265V\b\027\315`v\321\376\022\"%\333~\222+\341\331YT\312)\312\300\326\030\222\0232\265V\334\305\333q\306\213\364\002\306\213\013\344\274\323f\262Q\244;k<_\303\221\216\254\362Wt\332,\1778>\273\325\023\030Q\002N\231\216\217\264\301R\227\r\333\017\006\305\371\362!F\376\220\246(\002\263\320[\235C\020XU\376n|}F#\016\024W\220\332\357hg\200\327d;\265V\277\267\343&o;\312\366\216M\223\002E_\372\017\214Z5\301N\035\263%\324\201b{\354_\262\217e\233\310c3\247\252T\245\252\316\3157\205\366\257\376D\347GY\305\317|y\321\377\031/~%8\t\313"
+	.string	"{s87\350\255\355p8,\343\375a\337\314\246m\262i\233\235\256!\351tmN\323\350\364L6N\217\257\272\305O\375T\234\336K\375\223N\177\300|Z\320Uk\322\020Me\022\243\fy\325\355W\021\371V&\251\210|\363\361|*\223N\234\365J\243N/\261-2aj\255\016.\272\2027W<\204+\256\315\025\217\031\223.\2712h;Wh\312\213o\232\361li{$ao\016\271t\370\231m\210'\2522@\254\237\326\002\223\356\270\266\207\017\363\245\354k\310\013\304\251\302\264|\213\210\021$H\214\027\307%\301\200U\246\374^\232j\320"
+	.string	"\223\356\256]\302\304|)\356\355h\213\354giA \254\264\375\342Xx,8\325Z'X\371\225\036?\352\242s>>\343\305]\022,iX\342\350\315\241\257\365\373@\343U4\323x\177(.(*\273A\233\313\2472\24701U)1\210T\246\252\263\345G\361\330\254\326\273\234\320\362\354V\3440\354X\350\200\202v9\020'tA"
+	.ascii	"\206t.x\250{\"\234\320\005\341v)|t+P\340X\350x~p=BC\270\b9\006"
+	.ascii	"\n\312\t\341v@@B8\322\366<\255t$\367fe\330\276\331\1775\035\361"
+	.ascii	"\352\255\021\315\266_>\306KR!\314\027;\030\336\022\036\223\013"
+	.ascii	"\363\345\205\361\342\274\271J16k\333\034,$!\202Y\263v\006\r\343"
+	.ascii	"K\233\275\371\262ne\233\257\326\236\002rk6\007\f\206\021#\n9"
+	.ascii	"\316\314\230m\320\f\256\033k\373\246.\033j\353\342\251\n\211"
+	.ascii	"\220r\311K\266A{\334\240kE\232\250l\t\004b\250q8\246\fR\006\021"
+	.ascii	"\211\210\310\004\206I\007\220\002\0212#7\020Xi\250\024\322\001"
+	.ascii	"\335\004\234\224\241\tuxb\200\365\322\022\256\266\331P\263\245"
+	.ascii	"6\371\337\264\313\350\310\200\013F\210\2625\376+\355v\034i\n"
+	.ascii	"T\205#@\026\305\207YE\246\007\032e\245\276}\037\375\326\214\331"
+	.ascii	"\203\031\360)\357\246\257\314\177\350r\351012g\377>\370g\204"
+	.ascii	"a\302\330\267wb\331\314\220\3766h\217\206F!\330g\205\256\273"
+	.ascii	"`\340\202\322A\177B \372tmRo\232o%\276\nU\243h\246y=\30043_|"
+	.ascii	"z\255\273\007\306\307T#\020\301\330\2609\355\225\025\022g.E/"
+	.ascii	"\262\371\002iY\364\226@\036\244\b\215\244\256\353\233\304\024"
+	.ascii	"b\371Q\001"
+	.text
+	.section	.gnu.lto_pidUpdateAirmodeLpf.part.0.280.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\317\003\275\031"
+	.string	"\206n\240F\260XQ:\300\013\f\220\016,\264\331\240\330YDU\330\254\243\030\374g|+\"\325\371\304\373 (\245\327\366\365\374\027f\273d\3338\016\005\037\024\376\0257\364\346\364\340\230\232\351\035u\243\013S\306\267\222O6\2212\245\210"
+	.string	"\201"
+	.string	"\214"
+	.ascii	"\337\t\201\273\251KaU\373D\2364\364\"\036\255\232sJ\217i\316"
+	.ascii	"\031\341\322\r\304\313\233\027\b/\301\023\b/\355\013\261-\224"
+	.ascii	"\302C\366\227\357\216\246\001(A\212x\2769g\353rs|\350b*\224\340"
+	.ascii	"\252j\310/qQ\201\r\243\027O\255n.\036\202\017j`\201^\221J\265"
+	.ascii	"\335X\034\274\231s\262n4]\360\200\214\246\025\001nD \003\250"
+	.ascii	"\033Q\347]M\334f\252\003\256JQ\230s\3722\030\367\352\266O\330"
+	.ascii	"\316`\257S_\335\363^\201\213NI\255\307L\177\2728\257\352\340"
+	.ascii	"\\\034\266Q5K\325+U\253T-\252:\245\352P\325\022T\365\352w\377"
+	.ascii	"\thnB\323\234(~i&\r\331d\307\221|\211=\336\320vG\272\363\220"
+	.ascii	"\230\206\370&mB\b\362\221N\203N\314\032\337\245\257\344=\233"
+	.ascii	"\345\240'\361\215rQ\276\240\373G\204|\236Y\266\217D\31074%\217"
+	.ascii	"\237FS\237\242\240\364\302\3149!\\Z\202x\311\272\264\255\032"
+	.ascii	"f^\310\344\342\326\212\307\004GU\336\"\327\305L\214\273 B\301"
+	.ascii	"\003\\\234S+w\263(5}S\233r\252\371d\372\363^u\330d@\355\342\354"
+	.ascii	"qA\270\035\224\260\320\364\214\345~\303U5\265\036v\317\245x\024"
+	.ascii	"\347\234\023\242\310\375\217\\\027 I2\360\211\023\020v\200\004"
+	.ascii	"cW\027\334\253\251\361\230\351o\237\344L0qN\331m\376\322G\227"
+	.ascii	"\257\273\264\b\230\336v\351\303\302\021$"
+	.string	"\364\266\335\365\202\244\342\211hK\330\343i\030\244\315)[\020\346\301\201\361\3048\370\264~\\>>\256\234\003;@\026\\\252\230\016lg\007C\354G\347\365\032\221\003\30098\036z\200Z1\236\017=!vZ?=\034|Z9/X\013\307\200]@:\257V\314\345z\265X_\034\246 \333\231\2708o\360\021\262.\020Q\231\001F\252\326fM\3306[<\"\320\302;\270&\027\245\324e\311\230\324\342\304e\255\265Ff\246L\312@\325\bW\275\0130\342\243\b\215\226+P\036\305\247\325\252\222d\372\263\270\252}m\214\354N\277\342\321\327\371\203\227\274\024^\212\033U\250\201,\003\025B\306\320\0042\"2\243m1\200\002\03123\017\020x8\233d9T\226J\327\2705C\367\301\317S\325\310\024\026~#\325&^0\t\324\273\324\256\370\354\005\253\316\357\023V3\266@\rC\036\205\334kmt\210\027\340\265}"
+	.ascii	"\310*\035\t\004\356q-\260~J\256\r\207\021=\020\204\245\036|9"
+	.ascii	"i\177\341\262\t\370F\366S\353\f\367M\366F\323\310'\b\221\210"
+	.ascii	"\025\254\311\2035\246o0\316\250mP 2k\030(y \247P\030\301\343"
+	.ascii	"P\001\204\237\351\262K) \366\313\b\326xK\212\311\350\267\354"
+	.ascii	"e\217\3277?\377\317\305\325'\006\261\037"
+	.text
+	.section	.gnu.lto_pidSetAcroTrainerState.part.0.285.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`K\001\335\r"
+	.string	"\026\331ZE\020\257&\035\200Bv*0H\363\0249\272\211B1\034|\254\025<\210\360\3124\352\325\007?\325\245\266\260-X\353\365\024\275'\224V\360\023\026\200\b"
+	.string	"\250R\345\243\342\361\003B\205U\212b\203n\204l\"eJ\001F"
+	.string	"E"
+	.string	"F"
+	.string	".\356\275\354\347\305*\202\f\316\356\306C\315p\323\341\245\211\231\374\f\324\25509L\224\024\205_\031\350{\256\344\240ljR\023\256"
+	.string	"R'\327\200\335\275\367\224\220Be\0068\226\201v\327\235\nwv\333\232\355h_C\335\001\226\335\224V\316b\200%6\330\276\017\342\337\350\037\234\240S\321\355\356\350\276W\262=\036k>\306\035\036\245\263H\3676E\305\232v\207\207\351,\322\34774\253\023\273\336\306\2415:\207\366=\330.\251\330d\007\026V`\340\024\270\201\323\330\204"
+	.ascii	"\026\273\213\300\237y\b\b>\314\241IJ\362(\207~\tv\370\357\004"
+	.ascii	"8\240\350ZV7\247lY\237\273k\242\252\262M\302\256\372\311\264"
+	.ascii	"\276\026'\031#Ue\305\256U\027\3731\377\263\f\032\367\301)\030"
+	.ascii	"i\"\035\203p,\b\215D\316A\203\320\003\006Q$\364\021\022AD$\221"
+	.ascii	"\343\343mD\023En\333D\321c;\177\255\2728\303\346B\212\223\242"
+	.ascii	"\240\252\324\037q\022$\037\306!\333\346]\243\303\314K\013\213"
+	.ascii	"\345\224\255k\343\"j\036! p\202\231\303\362\323\031\230\002\277"
+	.ascii	"\247\241E\370%\263miE$\266\003 \033\271\033\223z[\360W\026\320"
+	.ascii	"\362\360#:\303\214k\241\316\210\330\346\336\304D\330\372\261"
+	.ascii	"v\003\304-\261\244\254\031 \265\267w\034X\343\027yk\251\267\365"
+	.ascii	"\2047\006"
+	.text
+	.section	.gnu.lto_dynLpfDTermUpdate.part.0.286.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`G\005\355\037"
+	.string	"\366y\306H\220XN:\204\2410a\204\342f`\013\304a\370_rpp\250bd\323\203k\362\017\371\355\225\324%w\375?3\005\255i%\327\301\030,\351\250\322\001\311\311\t\243\226 \346:\300\024\001`\251y\207\236l\223F6\2212\311\254"
+	.string	"\246"
+	.string	"\261"
+	.string	"Z\274\327B\3325\315e>\021i$V*\3412\357>\353H\316'Y\261\305\325:\005\311X\255\365\300\351\016(O\201\276#O\307\357\220\247\273\277\332]$\341\356\271\213v\342T\375QCkR\262Vk\345\235\366\017\334\366G\342\227\366\371\034\256\274\221tl6\317\375MH\353\270\340S\322sUB(\306\335\204|\314\270\361\362\306o\037;"
+	.string	"3!\216&&G\235\231\020\307\230\240\326z0&\246\271!5>\2265\336c\201\250*4n\236\200\343\256\214G\230{\235c<-1\353\334\274\t\325Z\367J9\2765\337]0\273\353`\227\346\004=\362\364}\257\323\252\341\0316(%n\343\226\3326y\r+\n\306v\217]\237\034o\317\305\276;\346\345\301\361\356\350\224\2749\377\372\352\230\027\207yo\230\327\346\306[\363\342\327\244\2749\312\213c\336\222yo$/9\362R\346\035O\374\233\362\362\310{ \266\n\200U\253\214\2663U\007%\013\362\342\377\365\213\275w\277\017\033\023;\307\352\025a\f\f!J\276d\017\266\346\027Re\262Q\206jg\322j\255\f\316\365\255\275\327\232/v\271X &b}\022v\271x\235Q\357\224\246\306\226V+1\350t\023\224\\\273f{->\036/\301]\b\317\"\241\201\002\0207\243\240`\252\326\272"
+	.string	"\313\313*\354\251N\327\302\205\013\344iN?h\343\207m\372\246w1d\340\007q\032\350E'\255\3317Une\3056l\330\206\221\2476}\260\217d\3034]kM\032_k\255}\016dM\263\330\372\302\304fv?\345T8t\360\340\201<\255i\026C4lP\2716\273\267"
+	.ascii	"\257\340\232;\327\007\226)\033\327\264IS\232[\217]\366\201UK"
+	.ascii	"\334\266d\337h\223\375\2464R>\320~\027\020(\035w\357\016\021"
+	.ascii	"\361\203c?K\007S'\355\233\373\300\264=\331\237\024\355"
+	.string	"\251VD\217\037\f*z-\206\306\024EG\023\214\214|\277\025D\271\242\022\277\237\357h\304\257\\\"\004!z(x\277\021\"z%\214x'zC&xDG*x\b~\326\207\242\350\210\367\363\371\216x\346\265~'.9\260(\365\222S\256\364izv\013\372n\307N\310\224\355\300\355\332\247}\212PE\002\274\323<\335\023\344\034\002D#q\022\271\230\263\210\206\207\001\323c6\217\227\1779\217\234V\347\325yE\236\356\364\307>\222Yq\035\315p\212\255\\(Y\303\251\033\013 Rl[\303\212j\"[j\315\263Q\247\351Y\007]\3271\016\\\327ld\353\254?\322\226\332]\003\327\265N\373\024et\001F\001`\234\316\351\3353\311\003~p\003p\250\201,\304\fc\210\241\021\t\"M\232\345\240\002\231\"\243\007\021\3005c\266-\264\276\001\017\004.\260aH\267\307\205\245r\272\207h\034T\013J9\261\202"
+	.string	"\tR@/0@\330wr\370R\016w\366\234"
+	.ascii	"\231\260\241\340[\272B\\\363p\326\317m\224\242\337/\214\013c"
+	.ascii	"Z\217\221\205f\225\220\255\203H\317\332\357\370\366\357\021u"
+	.ascii	"\026\201\376\370\007!:\250m\234\214\241\r<\353\334\032A\332\373"
+	.ascii	"4\354PX|\232\340\020\020-?Fl\b\240']<\23461\0316\302I08A\230"
+	.ascii	"\303i2\372\267d7)J-F\026\317\031\031\n\306\016\215\035\006'\213"
+	.ascii	"\305\210\303\220\262&\035\275\246B\234\226%n\216\325{^Q\342\033"
+	.ascii	"\tN\352\266R\344|\231\210bN\"\263\022\265\262\335vq\375\311\005"
+	.ascii	"QL\354\177"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\306\022\315="
+	.string	"jg\364\025;0\242J:s\245\342\2732 #\201\353KX5\213\310d\244\270\247e\036\020\250\002\201\225\334\"]\355\252\275\001"
+	.string	""
+	.string	""
+	.string	"\021\026\355v:\035\177\314\021\274G\333=\362\3731\0227I2Q\001H\001V\001GC\246\3213cxOL\243b\3020\244\344\305\032\025C\301p\237\260F\301\320/W\223r\326\275\234\355\322(\023\005c\274si\364\013e6\352\205na\307/nL\275\330Q\027?N\236\253\321.t\213!i\341\311\013,i\201#+\360\243,\334H\213\031W^\204\205\r\245\234\025u0\024\370p\311\206Y\\\230^\345B\335\007\274\302\204\254\364\375\252\360 *}?\237\302\204\251\024\016\252\235\312\314 J\237\357Px\260\201\272\\\256\374\244Q.\324\311\273\244M\016\206u.)\223O.\351\277)\341\304$|\b\t#\036\341\366i\244oW\204\025\211\260\242t\b\337\taF\224W\375:4\310\305"
+	.string	"y\230\037}<\324\352ZU\3756\037\337\352q-<\236e\307\273t\364\347\2409\276\005\307\2317\356e\343k\215{\241\361\257\031w\223\341!M\212\321\247\203\302x\341\213\223\271\370X\213\227\261\370\231\025O\243\342\216R<\361>\237\317'\212~\034\032\341}\320\245]\334\211f?\224\263LPA1\242\022'$\301v)37\030qB\"8Qz\231\277\252!.\226\206a\331c\003\242?\247\244.\227*\034s3\357\201\375\252\252\252\037\372r(3;5\003\220\372\215&\373\203\222}\312\310\376\240G}A\216\372\201\220\375@\217\375?\307>\240\306~_\243\376\037\306~\343b\037\022\243~\244E}E\212\372\221\212}\311D\375G\210\372\220\207\372\213\206\372\210\022\373\202\210\375BW\337\366\367~\270\301\220\361\024\262\236\224\331G\023\037?\232"
+	.string	"\301*\304|\b\261\237\224Y\n\223&XC\256\2000\341q\245\304\002\177\325\372 \376C\310\202\322\301>\037\301\376\036A}=\201\375<\201\372x"
+	.string	"\373z\177\375<@\375;~};h\037\347\375\341E\2763\362\303\202\030\356\330\347\217{W\344\303w\366\374\220\236\033z\236\037V\036O\337\251\327o\346\365\357\356\364\351\354\364\341\234}6\274\276\034\264\331\217s\327\207c\307zi]\377\r\335\335\314\275\215\334\325\352<-\356fp/\363v2t>\306\355am\3772\207\235l\347\222\363e\032\347Yp\216%\375\233\376\332\0327\323$7\375\263\267\351\233Q\353\253(\242\2475?\357\"\311\260\234Ms%\212\326L\211\256i\216t\326AMs \313v\314\232\003\225\361_\232\246\031\020U\343\3204\367\221}\315\330\331\244g\216\206F\312\215m\335L\243ce\002*\035\377Q\261\337\275\263\357*\255r\334w\227\3309\356\273o\341x\357*\261q\274w\227\234\313\327\341\275\313\344\374"
+	.string	"\305f\336\351L]\001\354/4\363\376\376v\200}rZ\261V-\021\366\r\352L\335$-\223\365\006\270\254uaa\261\277\372\244\205\302Ra\251\264\177;\353\254e\316\3373\366\314\031\267\302\261\23706\030\3665-\334\324}\332\372\307M]\247\366I|h\316\232\234s\244\036\270e\275M\352\nX\217\016Z\266\235M\352*9\257A,2\353n\244\356\331\243~sohw\223\272O\206G%D\335\247\365@\353\344|\2034\307\300\253E]\002\353\031l=%/'\352\376\370\245\212\272W\3549\221\"\260/V\316?\t\256ZU\3533\270mq]M\302uZ\307<\216\204\373\366h\034\231\243\030*\t\267\211="
+	.ascii	"9=f\207\003\205B~\001\024\3647P\267\311\360G\233d\364\263\300"
+	.ascii	"\301\375\372\306\301\r\001\265\266\340>\255g<3E<\247\365lW\340"
+	.ascii	"2\255\357\240W\327\3706\005.\2215Hk\265\276\t\261\362\360j\002"
+	.ascii	"\356\327_UU\263\236\026\34065\317v\252\252\362/\223\341y//R\""
+	.ascii	"\377f\365\rQ\265\337>\373\210\225\375D\224\375E\221\372\214\001"
+	.ascii	"\\\370\261\373%\032&\3642\367i\220\347?6\316\313\231IA\300X\265"
+	.ascii	"U\001:\372|>!\235\231\204&\256n\3559Oa#\335\357\316\274\350\331"
+	.ascii	"\372\033\346\001r\275\371l\317\204\224[|_sl\217\236umYt*\266"
+	.ascii	"\211\330\247\205\304\036\257\226\330R\3259o\241\322\311F\003"
+	.ascii	"]\363\020\340H\222I\271\031\376z\2619\217g\326\274\207\265\256"
+	.ascii	"\261\2503o7\177\013\234y\2474\377@\217\354\034\241\316\274P\f"
+	.ascii	"\237 o\021P\300\231\027\253y\256\034\f\223sp\346-\302v\346%"
+	.string	"\3026r\236y\257\312\316\274\n\332g\370\352\352\273\2333/\202\366\024\232y\200\007\32631\3629\272Zk\347\314{\347\2353/T\336\231\267\352\237L\363\324c\302\177\335\245\345\317\202\367\272o\267\\\355^Wiy\246\004{\266\034x\256\373\345\037F\213K\034\376\373\326eZ>I}\374z\227\f\217\362A\026\246\231\372z\3212;~\274?d\371\361V\261\0377\3661\343$\357\361\342}s\212\031](\304\373\243\216\013\357R\013\307\205\227\211\225\343\302S\276\241I~\216\013o\210\225\360\236\245b\3014@i\177\036X\3602\261\337\020\006\022\363j,x\317\246q`R\201I\250Q\024F\003\017\211\210(H\n\222\244\003\341\005\2041\307\250\270\001\021\260\230\262\026\211\210\210\004\"\201Hi\007\037H\220\365\317\2611\3534\376\334v\224\024\033\177v\201\223\0170\361\006\302\314<l4\216\206\244\243\313O\226\205\"\024"
+	.ascii	"<j\217\277\n\361\334\020\263\246\326MOz\025\350@\242_\372xK\341"
+	.ascii	"G8\367\372c\025s\217I\t\365\334U\326Fad\007\342\0312\n\352C\365"
+	.ascii	"\372Rgq\034\336\374a\357\n\314F\017{h\212@\345\275\356\023D;"
+	.ascii	".Ps\324\n\214\006\036\310\016\021M\214\030\271\036i2\t\231\244"
+	.ascii	"\347\b\255\252\220<,e\267\363\357W\030hFr\266\341\371U\266S\305"
+	.ascii	"\036)\022\247|\300\215/\252\271\270,\227\317\344\212'\257\332"
+	.ascii	"\201\002\032\246\200\316\002\207\005\036\232\212[\020\0211\226"
+	.ascii	"5\n@O|\267P\362\006E\257\345\310\313\226\036\345i3\347n\2040"
+	.ascii	"\210Z\353\274I\n\002\225B\245R\251T*\225J\245R\251T*\225J"
+	.string	"\245R\251T\251 \021#\030\353\0178\274\327Zg\352\274\026\034Na\036=\261\333m\333[\033-\305\225\263\360\200\005\223<\351!\301s\375~\3575p\233!v\265\021\241d\353;i\351\350\025*\255E\341\311\204\024\2226I\210\261\340\362\373\300\301\372\237Kq\366\020\316\274\204\017\342%\246\341\017\342;\227\242\034A\221\252\323\353\351\301\242\260~\234-7\177dS\264\247L\265\032:\272\376Wa\207\240\235>\001\267\276\020\225\240\213\215\252@\030\325\020G\206\032D\003\350\361\211\242\216\311m\004R4\243\272\316Ec\\$\275\026\360X:Y\225`\253\302\275\271\306\244\275\030N\216\301\332\207]\017\252\r\204\354\355\316\264\323\017\226\234\226\257R\322\211\312=\336'\013\025\346\031\205(.\242\370p\355\335b\375*\255Y\301Ht\357}\032\206C\264\226\362\301\373Z\210u\340n\301\020h\333\320n-\214\001hZ;\266po"
+	.ascii	"W\340\002\321\202\273\376d\rs\265\355\355\f\270[\334Mpy\360\320"
+	.ascii	"b\335.7\374\211Ktv\327cf~\335\177"
+	.text
+	.section	.gnu.lto_.refs.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`\004\b\005-"
+	.string	"\272iH\022EpZN\032\003}\326\001V\004C\362\r`\301\024\312\263\017\305r\032\004\002\201@\372O "
+	.string	"\020J\326\006H\020\202o\212d"
+	.ascii	"h\275P\2626\020\375\333\022\375\357\366\337\354\263\333\3076"
+	.ascii	"\343\3154\255\223m\204\220-S\005\001\022\001\022\001E\255}\241"
+	.ascii	"F\240\234\352\270\0278\276\324q\207\312\372\246\003\2774\204"
+	.ascii	"t\374#\344nt\334\221Y\037t\340\213X/<>\360\352\253p\253\237\257"
+	.ascii	"\214\373\224q\1772\356L\347\027\031xa\325\003\251\276N\325\002"
+	.ascii	"\351\273\255\001\377\345\371\253\235\031\367"
+	.string	"\256\363\257\3147 \365U\300\035\n\375'\340;E}\022\324\023\241/\004\374\337S\335<\177\315\t\004=\034~\320\351k\323L\346G\003F\n\2378|\351\274I\351\007(\375\221\200\007\n\360E\245\037&=p\370\347p\244\364\317\216\307=\301\360\267\216\376j\370S\277\217\372\375\223\021\200WB~R\272\027\025\275\320\360{\210\3767\364&\362\367\270P\320si[\246\031\367\315\316\367\n\372\256t\327\372y)\240w\372\375\322\317#\021\337\210\270\023\021\037Y|!\342\016D\374t\370+\334\307\370\031\254=\373Q\272\037\3237\002\353@\347\027\315\357\371=\020}\364|\323\374\255o\360{\016\247\262~r\355\246\262nj\355\233\\\003\360\235\355\fmc\260\333\013{\275\356-\254\331\n\373\006+\205\235\310\253\216L\376\217W}\210\322\241\231{\002\360s\271\335$\356\225\270\022\314\201\206/\343>\370rG_\376\371\022K\215"
+	.ascii	"\334h\334\211\347\373\f\367\300\363-\025\302\357\3631\365\372"
+	.ascii	"\230\372\340-\314\016\352\346_\366}\2556\250\013\203\311\007"
+	.ascii	"\236\250\226\031\240\017\347R\367I~\372\226:\212~]\313\357n\273"
+	.ascii	"\340\367\316\270m_\261\331\366\375z\255\276-X\214\245\276*R\274"
+	.ascii	"\254/\n\3647\304j\365\373\370\276R\177\017\357\251>\235\323\376"
+	.ascii	";9n\246\352\327m\345g\243\206\352O3Z\3753rW\251_\006\016\216"
+	.ascii	"\f\231\317\366\301(\353\203\321\322\226\374\331\266\352\263]"
+	.ascii	"\266Y\3753\3647\353\252o\326\245\254w]\266o)\353[\\\273\226\262"
+	.ascii	"\256\305\265[y\325\253\222O\245\240N\305\265?y\325\233\320g\352"
+	.ascii	"\2523q\355E\312z\221\326.\224\240nL~q\253\036u]\274-\306{_\276"
+	.ascii	",\342\336\025{p\267\3571\356\347\371\253\342D\321\367\236x\211"
+	.ascii	"\273&\352De\235\370\331>T\326\207\\\273PY\027j\355A\250=Ew4\271"
+	.ascii	"\327-\361\373{I\370\\E\354\210}"
+	.string	"\373\216\333WoE\354\233\007\365;gC\354\333\246nA\354k\346\267}\311\034f\337\267\373\366\355r\236}\267\314\267o\226\367\366]\2529\355\213\326\264\357\331h\366-{n_*S\242<\231n_%{\204\310\n9m\337\037Q\373\362\220\3327\207\271\257\215\237}e\004\355K\006\264oX\261j\337\025[\3317\205\201}QP\355k\242\357\272\375<\337\355\357\325\375;\343Y\275}9D\373o\262\366\355\260\366\331\034\330Oc\264?w\264\0377\264?\006\300\336\331\367\302\266\035+h\347m\227\200=\031`\307J\332\255\224v\252\001;T\321\316\2644\336\037\r\005\215\207\267\247\327\331\315\353\354\207\325\336\357\366\260W\340\276\351v\250\034\026n7\324Qe\035\r\357\217\272A\352\226\250\013\304\354\251\353c{\230\273c_\364\3251\366\346\220\261\213\203\356\275ac?\027l7w\301\336\032\346\273\334Kcw\306^\301"
+	.ascii	"\367\372\245\313\312\370\352\226\245\215m-m\273\257T\24689\317"
+	.ascii	"W&\350\327%I\346\373j\204\210\220 @|\364\340\261#G\215\364\353"
+	.ascii	"X\323W\2610\260\257\026,\322\275\246\250&\240\276\202\340\273"
+	.ascii	"\316\257^\236\360\027oc\354{\2671\310\366\215\003'\335\327\256"
+	.ascii	"\216nN\316(\306K\027#\226M\253\262\"~\3136\304\257\224\205\262"
+	.ascii	" ~\233\354\022$K\366[d\310\216\355\013d\307~y\354\210\337\035"
+	.ascii	"\351z\277dc\357\375\212\245\013\366\331\357WJ\242/\375\363\330"
+	.ascii	"\371\375s\340\330\035\227[\030\365\345Vl\377m\305\316\373\271"
+	.ascii	"l\330\276\333\206\375W6\253e?\232W\375*\\\t\352\227i\275\202"
+	.ascii	"\337'\263\266\363XW\350[\275\346\245\316\2172\356M\3473\275f"
+	.ascii	"G\372\316\033\375\345\213\026\354\207\276{\344\276\330\205\202"
+	.ascii	"\366\305\027\367\353\211\373\265\247\302\017\200\220\250ADe\220"
+	.ascii	"A\212\214\314\214\210\314hasp\242SDZ7\020\310\347\262\t\ny=\367"
+	.ascii	"\2029\3131\025\233+6\324@\034\377\246\252\307\360\030\013\t\337"
+	.ascii	"\343\320\302\216\315\261\006\203\202e\005\036\234U\244\035\252"
+	.ascii	"SV\200\342u/\033\005\352a\240JHR\337\006\342\036\2320\362,}j"
+	.ascii	"\331\023\tr\033Y\346x\n\256\024\\\016\006\220\262\256\360t;\214"
+	.ascii	"\f\3401\365\240\204\2115D1\210\305\237<\366\240c\032\256@\376"
+	.ascii	"\357\021\225\320\t]\354\023\037j\353)aa\\]J\205\372\005\022u"
+	.ascii	"\275\362\030\342W\315\032\376\031\347\"\301\304\004\320\274Y"
+	.ascii	"\326\311\306v\246\204\272\250\003\035\302N\235\222\300\036\261"
+	.ascii	"\302\303\217\"]\247\236\326O|\245\375\013w\273G\3241po7\021O"
+	.ascii	"@\377\020\b#\236\305]\200\307\262\332\364\360\236=\\\236M\250"
+	.ascii	"\302\002Af\333xIt\300\331-\343)E\001\224\254\261l\025\365rS\036"
+	.ascii	"U\277U\211\315\306\353j"
+	.text
+	.section	.gnu.lto_.decls.1b3f415c60458c90,"e",@progbits
+	.string	"(\265/\375`.\231Mb\002\332\317\263\324Q\020(\205\2554\006\301G\037\261\370\321\367\003\265F\352\221\234 $\376\246r\274\341\365\322\016\337\331\"&3\313n\225\r\332$\200\300\006\340\250\253\3403\n"
+	.string	""
+	.ascii	"dX\300\026\331/`4@\202\fZ\036\330\212\242B\227\235\224?c\031"
+	.ascii	"\331r\357-\267\224)g\013?\r\270\r(\230\376\340\006\245\251\035"
+	.ascii	"\007\032\352\212\2246+uY\212\017\272/8\327\375\330\r\277a:6j"
+	.ascii	"Mp8W\031\342G\245\005\347\243ZP\360\024<\207\245\340(\027\017"
+	.ascii	"S\301r\307M\260\223)p`\3148\035\314%_L&\247\353\201\372\3311"
+	.ascii	"`x1\251\340'\247\273{Pv\324\222\016\004\263\3104\007\367\336"
+	.ascii	"B;j\274\304x\331\311\317l\364\r\273Ai\2061\372Y\214~\346\323"
+	.ascii	"\317{\372\331\213>\367nPZ\202\022\f\346&\243k\252\r\213\024\300"
+	.ascii	"\0348\237\204\030\356q\367\240\230h\323s3x\333\334=\256\237\r"
+	.ascii	"\305$\306\2338S\230F\r@\271'Wx\343\2557e\314\\\277sI\026\003"
+	.ascii	"\236d|a\260\273\007%\033\361k\332\270mz\232.\354\315\003\r\263"
+	.ascii	"\314\337m3\202T\326\032\203\211\325}\003\347\372\365@\375\354"
+	.ascii	"=F%\347\316\271~w\017J\326Bx\004\253a\"8\tF\303H0\023\007\301"
+	.ascii	"?\260\021\274\206\3230\020\\\004\237a!\230\355\342\341!\330\307"
+	.ascii	"q\0316\273\020\334\336PCx\b\016\303`=\353\336N_\230C\360\016"
+	.ascii	"/\315\275\367%\274\205\267\315\004OS(t\231\323\334\033n\b\276"
+	.ascii	"\201\275&x\232B\241\316Lso\270\337\266\037\357!\270\t\317\270"
+	.ascii	"{Pr \234\346\207\017\030\f\216\fN\006Y\304\276A)\332\274@\351"
+	.ascii	"3\236\306c\230\307\305\363\200\311\276B\301m\271\275\341|\326"
+	.ascii	"1kt@\301\371\271\212\376\365\220\372\024\026\026\026^\017\351"
+	.ascii	"\363\233~F\242\237\321\300~\254\343N9\035\376\242\346k\020\347"
+	.ascii	"\3472\275\203\275\216s\234P\340\254L\341\214\343\004S$\007\036"
+	.ascii	"\316\317_\032wa\2564I\232\247,\234\237i\350g\030\372g\240\376"
+	.ascii	")F\177p\201\322\237U4\236\201\265\326\031]N\312p\316\342\220"
+	.ascii	"\306\210\222\203\f\316?\223\350\377X\006\276\272x\030\013\307"
+	.ascii	"\300X\330\tW\335=((\330i\301X\330\352\222\351\201\202\333M\022"
+	.ascii	"\330\202\203pp\357\315\341\303\207\2362\261@\2564\377\224\241"
+	.ascii	"\217\337h*\241\007\220q\273\201\3631\032\375\313$J\t\023K\341"
+	.ascii	"\247\266&\236\3020.\036\226\302P\317p\373\303\007\241\025\311"
+	.ascii	"\2165\2514\037\377\351\343/\372x\213>\236\323\307l\372\206\371"
+	.ascii	"\3208\013\207\306a\027(=\226\322\277o\364y\303\350\274/Pz\005"
+	.ascii	"\327<\2211\206\020\347_;\375\213w\331\254\321Q[\263\246.\360"
+	.ascii	"w\315?\"\204\323\355\354\335\266\367\236\200\247\315\313\326"
+	.ascii	"\024\316\367\314U\363\177\365q\372\233SCMsm#\307\225\004\347"
+	.ascii	"4:G\332\354h\340\374\033E\377\277x\027\360\242\201\333B;0\314"
+	.ascii	"\262\030\301\371\027N_\360t\377\327\253V\005\311\034\316\277"
+	.ascii	"f\372\027\207\316Y\027(\375o\224&\327\311%\203\3036\350\364\350"
+	.ascii	"\002\207\013\3471B\232\312\217\261#8\377\306\320\277m\377\320"
+	.ascii	"\025-\315K\245.G]\033\235\333\226!;-\314\271</CwF\2644\247T9"
+	.ascii	"\335\335\203r\231Y\2664I\374\227\212\225\323\365\254{ka\253\333"
+	.ascii	"{\377\277`\356\227\033\346\212\271^.\337\355\273]\356\336\305"
+	.ascii	"\273zW\313\357\226\313\345"
+	.string	"\031no\250\275\367/\223\177\350\277R.\223\253w\261\234n\002\252\275\265\200ihJ\363\344\306\340\336\373\203\320\007\035\256\272)\277\f\371\031\3208\354\006\245\031\\\240\364\016\320\277Yn\344\264C\370\007\372\036\350\177\320\347@?\003}\013\364+\320\227@_H\377\\\240\364{7(\315@\351\2052\364\033\005(\315\342\202\333P\366\336>g]\026)98\343\013\224^\353t\357\006\245?s\201Rt_\240\264\303\rJ\377\033G\201\017\234\r\031<p\376\357\222\377\262\335\266\373vNY\205m({\303]P\331\262\214A\301\371\276\341\353v\341~\337\256\222\217\b\341;P\273mo\270\373\226\367v\272\327\202\236{-@\357\20481I\363\261>\334\rJ\365\005JM\370\230\0229\b]\300-\202\266\240B\356\302\207_cp\270<\324\033\376\214b\2644\0252\326\352\231e\344\f\303[s\216\301\257b\033\377)\210j"
+	.string	"\215S\303\363\253a~\324\355GQ\370\321\250\253p\366\251T\376s\357\256[WAO\211\t%\264X\360\253hvu?*\006\002v\343\206\267\236\25050\020\326\301k\247\021}\0229\231\250\001\224\374g\217\377<\373\321\021\332\376\323\307\177W\354\246\013G\221\200\016\375\030\b\333\325"
+	.string	"\245\200L\352\002\034$\371o\021\030\237\300\257\372\374\030\350\307\003\300#\374x\304\217?\374X"
+	.string	"?&\300\217y~\254\203;\374x\350\307!\360\2125\270q~\254\342\013\360\020\003\340\307\021`\241\353\006w\2001\300;X\3778"
+	.string	"\031\223\230\340\277s\360\017N1\007\227P\204\037\007\341\013!\374\030\204\037[\200K\300\350\177\341\374\230\204\377\276\271\200\377-s\315\\4\377\345\361\337\033\377\035\360\243'\374\347\005\260"
+	.string	"\360c72V\t\376[\301-!\307\330\360\347\020\300\360\271p\241\262Y\376\261\340\317\307(\235\343\323\252\376yE\221\374\231gE\036\352\240\273\255g\016A\016\300=\341\317&\\\006\374\350\n?\312\302\217\256\375(\004~4\002?z\344GwP\334\024\332~T\354\314B\215\374g\222\363\005\252v\2013\016\272\003\265@\221\\\200\\\002\013\271(\234Hh\232\005(\221\377\016\236(P\264\377DQf\346\371O\005\374w\t\035\362\347\026W\003\224\350\354\307\200\250\220\037\377\t\004\r\362\300\377c\376\223\371\317\032?\n\004\035b7\271\204|\314f(\016\026E\334\302\351\317\354\217\241P#\274\205e\374\350\217\0375\373\277\246\002\023|\003\016\240]m\036*\273[\002\236\344\327O~4\310\307\331"
+	.string	"\025\204\260U\2124\307\177\323\377\256[\030P\222\317\214f\254\321\377|"
+	.string	"\332\003\245\200\354Be\263\r|\205\n\317\340O\257\374\227\002\250\020\217[\301\031\366\237;~t\354\244"
+	.string	"*V\001\274\365\024'\004R!\377\031\007\335\361\237S.\005\204N9\352\033l\006\r\373/\t\354\006\013\256\271\025\\\202\037\375\362_\205\257\370C\361N\r(\030\372u\241\262\031\206\n\374\237`\0037T\353+N\342Oy\376\257\260"
+	.string	"\222\374\201\216\037\325\340\307e^\271\252\252\003\031"
+	.string	"9\320.\214u\017\376t\r\211\377V\200\016C\234\035|\360`\004\305\361\237\031\b\255\270\033\332\205\255\2520\326G\370S\005\200\200\322\370\317\016N\215\316\370o\362G\267\376\333\026\375\227E\017\316\240\304\205P\255\037[\335\245\257\370\005\177*\343$\341f\340\277\027\370/\373_\242\037\347\2411\376\\U\365\177\005J\205\255\276\341O7\360\237iP\251\377n\027\352\352\257\202\371O1h\324Ux\372\253R\376|B\002h\377mq]<\377Z\310\237Ap\203\211`P\244\377\016@\017\205\372\257\3029@\237~\234\200w\3705\031\212\"7"
+	.string	"\r\301\2177`\374g\0248\004\026\201\327\037\005\001\366\340\317\n\370\261\006X\305\352\1775\370"
+	.ascii	"\246\340\317A?\036\376\031\b\227\360\337B\034\001\346\200\205"
+	.ascii	"6\300"
+	.string	"\025\340\016\256\033\354c\344\307'\336\301\030\374\031\003\034\364c5\030\303\237\017\360\343"
+	.string	"\340\0170\t\234b\016p\206;\347\307_P\017\374W\016\376\371\361\026\264\003?>\300\177\213\240-\374\030\304\217\r\360g\002\374\227\360\277\025\334\022$\300\027N\001\340\243\200\357\217Q\374\267\fN\361_\277\037\253\360_3?V\361\343\025\262"
+	.string	".\231\037}\361c\r?\312\364\347\020~\\"
+	.string	"\b|\203\257\210J\300\265~m\374\317.\377\351\345G]\344\021\247\236\312Vc\001\377U\341\277\r\270*\276\376\272\350?\263\240-\316*\237"
+	.string	"o\310\177F\371\317\271\037]\372\317*\331\354+\316'*\326\177F\241\355\177\026\371\232\377\202\350\362\277\032\240\312\377\034\234R*\317\177\272\205\270\300\177\302u0\201?\333\370\263\326\177\374\257\"\376\034"
+	.string	"\267\314A\003\376\214\301\335t\211?S\220#\370\177\376:\204\261S"
+	.ascii	"\337\370\360G\343\374(\007\022\200n\340\372GM8\333\240\032\370"
+	.ascii	"\363\217?'\3713\033j\374\377\363\257X?\276\300\217"
+	.string	"3\360c\242\037\023\377|\367\037\375W!\177\206\373\263\334\237\231\374y\311\237\225\374\371\355\317q\177v\262\367\243H\177\376\361\347\266?\263\3759\313\217\036\375\377\371W%\177\366\373\177\377\365\312\217\032\375h\361GY\374h\006~\364\002?\032\201\037e\341GQ\374\350\002~\024\205\0375\341GK\374\350\001~\224\204\037\005\341GG\374\350\207\037\365\360\243\033\374\350\005?\332\341G+\370Q\016?\252\341G{~t\347G\207?\252\1774\377Y\316\237\313\374y\357\317^\376\234\345\317Q\376\374\344\3177\376\214\365g\031\177\216\361g\030\177\376\371s\324\237\237\376<\374s\323\237C\360\347\017\374\271\003\177~\361\347\026\177\346\300\237\217\177N\372\263\361\317\354\237\213\376\214\201?\343\377\224\363g\013\374g\363?\373\376,\201?C\340\317+\376\274\302\237U\374\031\305\237\027\360g\024\376|\342\317\n\370\263\t\177.\361\347\003\374\271"
+	.ascii	"\177.\341\317\004\3703\t\177\026\300\237C\3703\b\177\036\361"
+	.ascii	"\237z\177\036\372O\274\377|\362\237R\177\016\361\347\016\376"
+	.ascii	"\034\200?s\360g\f\376\334\341\317\024\3749\202\037\357\370\263"
+	.ascii	"\320\237\203\376\f\364\347\013\177\346\371\263\316\237\321?\237"
+	.ascii	"\377Y\370\237s\376\263\315\177\252\371O3\377\351\367\237c\376"
+	.ascii	"s\357?\275\374\247\226\377\264\373\317\272\377\254\362\237S\376"
+	.ascii	"s\356?\341\376\323\355?\333\3763\311\177\256\375\247\221\377"
+	.ascii	",\362\237D\376\223\371\237g\377\031\344?w\374g\327\177\336\370"
+	.ascii	"\317\032\377\271\365\237Z\377I\365\2370\376\263\351?C\360\237"
+	.ascii	"\037\370\317\016\374'\323\177r\340?\221\377\251\364\237\033\370"
+	.ascii	"O\343\177\022\377\223\350?/\360\237\025\370O\b\374g\003\376S"
+	.ascii	"\205\377L\361\237(\374\347\211\377,\300\177\022\340?I\370O\001"
+	.ascii	"\374g\b\3779\342??\370\317\020\377\331\301\177~\370O\017\377"
+	.ascii	"\271\301\177f\360\237\027\374\247\206\377\314\360\237\030\376"
+	.ascii	"\363\347?{\376s\347?\207\377\251\3773\375"
+	.string	"\361\234\037\307\371\361\233\037\273\371\261\340\217\327\374X\315\217\323\374\370\357\307`~\314\302\177\327\377\202\377\255\340\307%~\374\345\307z?\316\373\361\226\377R\340\277\035\370o\213\3776\340\277\355\217\361~|\367c#?V\373q\332\217\321~<\344\307B~\f\344\307e\377\325\340\307d?\036\373\361\215\037\327\370\361\326\377\t~<\343\277\333\177\241\376[\344\377\006?\306\372\261\325\217\253\376\257\370\261\324\177\025~\034\365\343\247\037C\375\230\305\217#\360\343\025?6\361c\023~\234\200\377~\340\277\036\370\357\213\377\272\370\317\302\177\227\376k\364_\007\374W\305\177K\370/\001\376/\371\017\367?\305\177\361\377\274\377\004(,,,\374#@\372)`\361\263X\021\0306\336\033D3k6\313\312P.\353\336bA\322-\"gY\203\023|\351\321\003=\262\356-f\246\"\341\243\242\177\337n\312\203\307}\023\332MkJH\263\233"
+	.string	"I\312\225r\245b:T6\247\035O\305"
+	.ascii	"{\304\316\004\361\201s\n\226\206\375_{\254\206\230\301\242\363"
+	.ascii	"eJ\230+\234\323\257\035\"e\274\246pNu\250lN\260\250\341\234\346"
+	.ascii	"H\275\376\257\037\210\201\325\006\347\024\307\351\312H\331\202"
+	.ascii	"\207s\3325\001\231\r\033X\216\207\260\374\344)mmmo.\020<hI\232"
+	.ascii	"<\341\374\t\300\364\237\322Hi\234Q\351f\nC+\323\234\240j\306"
+	.ascii	"\f'5YY\247\313p;H\252#\356,k\r\214\376\323\253\364\352t\353\336"
+	.ascii	"Z\276\322\034\022H\321\177j\225Za7C{\363\360Ju\020\221\300\210"
+	.ascii	"\376\323\252_\274\264\n\355\202\343v\223\017\335\376\203\243"
+	.ascii	"\371\b\251\332\340|\t\204\350?\235\272x\351\324\251\346!\314"
+	.ascii	"\311)\203#a\222$\321cZ\276\242p~\004s\n\013S\251/U\215]\032\365"
+	.ascii	"T\212N\017:9\363\003\347\024\352w\377\327sH\\\034\0338\247;}"
+	.ascii	"\372\277\336\25775\370p\376\323\247\324I\n\032*\034l8\254iQF"
+	.ascii	"\334pN\233\260\031\265\255.R8Gpf\316\034t\207\336o\304:\200\225"
+	.ascii	"\021\342\374\b\262\350\037\215s\361\3208\270n\235\332{F\207\264"
+	.ascii	"\031\351]\214,68?\202*\372G\337\374\342\241oP/Bq\273I\r\243\203"
+	.ascii	"\013\204O\2301lp\242\270q3BZ\240\023A\3013\352\306m\254!\214"
+	.ascii	"\255\264\265\301\275\265\200\310s\322\2141\303\371\021\210\351"
+	.ascii	"\037]s\361\3205\247CaG-!\241\313i\203x\0049\364\217\252\371G"
+	.ascii	"\204p\361P5\367\355\334\373\353-\255\021\b\007\342\021\310@\203"
+	.ascii	"\006Ms\367\336\233\253\004+C\230\233+\313\003\312\026f\245\211"
+	.ascii	"3  \337\2142\033\347s\020\f\023\006\375\373\317\336\373i\357"
+	.ascii	"/\035\303-\261,\017?\332w\364\357\250\031\007\324\230#\205\363"
+	.ascii	"Q?\264\314\277b\035sv\021\234\317\001P\243cP2\377\327\f\246\314"
+	.ascii	"x\302\371\230C\030\016\324,7\250\342\340\374\017\231q\202\234"
+	.ascii	"\341\214\212\311H\342\334x\341|\301W\371\277j\264,TFp>\207,\032"
+	.ascii	"\005\303#E\217\311\225\271/\327\f\257\311\f\347s\210\323\250"
+	.ascii	"^*\305\r\222\0338\237\003\233F\363\206tR\270\264p>\007\262-x"
+	.ascii	"\202`u8\237C\227\276x(\036z\247\342n*:&:\232{s\201\320\311\213"
+	.ascii	"\023%\017\347\013\021\352\037\315r7\207\344\n\032\234\261\340"
+	.ascii	"\333\306\215\233\027\316\027\362\323\277SP+\350\024\224\312\t"
+	.ascii	"W\247\253\214\341hZA\327\320'c\035\244e\005\322\030D\257\240"
+	.ascii	"v(\035Z\005\255\273x\250\025T\n&a\005\235;\325\356^\331vj\032"
+	.ascii	"\001m/\220\306 \224\373\226A\332\016\2441\210ZA\243\234Q=Mp\033"
+	.ascii	"k\250\031H\203\247l\013\025\273\035\271\2741s\033\347\013\335"
+	.ascii	"\351\013\275\351\013\025\321\027\362\241/\204\303\t\207\2359"
+	.ascii	"\251\260$8_\b\212\t*w\361\320&(\022>,\347\356\225\241\220$\257"
+	.ascii	"\2116\301wh\334\335+C\201\260K3\253\t\276\t\246y\t\336\251\032"
+	.ascii	"T\202\3637\230\321\377\3217T\t\352\206\266]<\024\016M\002\005"
+	.ascii	"\013\312F\307\244\302\254\302D\341\314\342\b\327|\250\304\276"
+	.ascii	"\324\f\3637\034\321\337\220C\177C\224\276\2069\350\216\223\215"
+	.ascii	"*`\324\324\3400\307\244\245\341*\241\237\r\025%\r\323\016\rM"
+	.ascii	"\007\237\333\220!\270jho\036:\322\032v\\ \264\326\026\326\027"
+	.ascii	"\234\257\201\210\376Q!x\250\020\\uN"
+	.string	"m'\261\241\032q\032\304\364\017\024\310\251\346\257k\f\347k\300\372\341\003-\323a\336\220\345\341\374 8><\240dmwW8?H\215\376Er\321\256\243b\350X\216\273{FV\003\372\272\232;\213\006\210\007\351\351\2438\320\034G\275\356\205\356\320M{7\301m,!+\\\\\036r\214\252\"C\320\260\243;"
+	.ascii	"\325%XVap\276 \n\366\177\035\006\202\351#\003\366\265U\246\311"
+	.ascii	"]^\202\232\305\331\232\202\3528\331p\021\242e\r\316\017\242\242"
+	.ascii	"\377\337\343?\335NY{\357\031(\334\316z\332I\377\373\213\336\353"
+	.ascii	"\341\347\271\347\275\340\177\336\273\002'\366\216\302k\356\275"
+	.ascii	"/\033\235F\347\224\003\347\377\0356\272\2677\224X\023\002\304"
+	.ascii	"\264\240\304nL\311\211i]\230\222\023\333MPgM\027\262\266X\323"
+	.ascii	"\224\334\336\027\240\240\232L\204iM\3119\355\013Sr[kG\361i\335"
+	.ascii	"\r'\326\264\241\302\366\205\r\265\235\266\\\230V\207)(1\255)"
+	.ascii	"9'\255\013SrbZ[Nl\377l(\247,*\250\235ua\313\211\251\331raZ?S"
+	.ascii	"raZSrb\\n\227\252?.5\2624\201\b\271MSP\373J\206\227S\326\317"
+	.ascii	"\336\024\\\330\366\333\373B\221\332Y{o\357\013\366\366\n\313"
+	.ascii	"\362s\272q\353\236\366\256\236\2468\205]\270\2757\007\031Oca"
+	.ascii	"\033j\257\351\356\275\251\"a{\027yB\3322\366\336\033\204&\270"
+	.ascii	"\275mv\367\232xxm+\251\275#\330p{\313\330\273\351\356\275\275"
+	.ascii	"w\323\336[\315\362\202\333\033\307\317\024S\206\214\275\271\204"
+	.ascii	"dl\257&+R{c(f\352\264\246\344\306\302\206\2548\221cn\030pMw\312"
+	.ascii	"*l3\267\237X\226\226kZ\262\255\366\336w\215fjm\005\342\374\240"
+	.ascii	"\031\372G\271\320\033\353\335\221\247 =b\264\262v\324\270xh\r"
+	.ascii	"\fvN\355\255E\302\215\300\263\254\301\235\225\005\342AS\372G"
+	.ascii	"iT\r\301\302\025\250\205\316\330\230\212\215\276\265\246\026"
+	.ascii	"\212\005w\245\370\362\242p~\006=\215^\375t\262\241G\207w:\324"
+	.ascii	"j\ts\357\375\263c\206\r\025(8?\003\236F\247P\252\213\367;\264"
+	.ascii	"\312\247\307\013\2311~8?\303\025\375b\357\275\357\357R\365w)"
+	.ascii	"\234N\335W\024\0328\303\265\355\r\347\263\203\205\005$,\n\n\243"
+	.ascii	"qR\344\n\024\372\304\246\b\020,\234Q\247!\333Y\223<\234\237\341"
+	.ascii	"M7\375\320\234d=\347\336N\177\314K\205\314\2336\331M\206\223"
+	.ascii	"\0133\233,'\017\34699\016\272\363\233,\2106]\274L\230\325<\007"
+	.ascii	"\3465Z\177h\bs\231S\355\356\225!\240-M\2230\2379\311\356\036"
+	.ascii	"WNr\346R\311\204\271/\217\271{e\271\r\016\240\031\246\0311%$"
+	.ascii	"\211\323\274T\b\317\031'\327\335\343\312E\3444\323\234Q=\347"
+	.ascii	"\336_e\250d\302\354w\246q\342c\263\306\243\306KL\220\t2\316\272"
+	.ascii	"A\351\005\027(}\006)} B} A} 3\372@|\372@y\372@w\372@R\364\201"
+	.ascii	"\332\364\201\312\364\201\264\364\230\237j\327\207\215\0208Ap"
+	.ascii	">\220\224>\006B\375\3470\317_\236\302\222\304\301\371$\272\370"
+	.ascii	"\230\372\222\271<\251\312#C\305\364\222\301\344\275\314w\361"
+	.ascii	"\362\227\254\227\277\344-j\230\250\224\034\373j\230\217!P\037"
+	.ascii	"\303\236>\206&\372\030x\350c\330\372\317Z2^\224\\\233\036\316"
+	.ascii	"\031/g\311qa<>[\b\017@\234\177\301\214\376\363\035\026\2636."
+	.ascii	"@p\316\331I\276\202O\"T9\210\340l'\264\216\005\342\240\201\363"
+	.ascii	"/l\321'\021\205\220\231\251\344*\231.[\271x\271.\317\375R\311"
+	.ascii	"R\2460\201\202U\330\366\004m\2129%\327\345)9R\255\031gY\037\264"
+	.ascii	"\222&ld\f\363/(\321w\337\240\364\027\202\350_0\323\277\320C\377"
+	.ascii	"\302\230>wn\202\245\206Y\214\370\310\312r\227M\325\026T\032\316"
+	.ascii	"\177f\222\343z\260\344\260\022\210s^\002w\245\300\3318\377\202"
+	.ascii	"\r}\022vW\315;\007&\314\231'Tr\360\3751\255\260\314\354\2467"
+	.ascii	"C\201z{\n\220)\343\017\323\330R\330\274s^\306\322\334\271/\200"
+	.ascii	"\314)^M*4Va]\236H\321\321\024\033\343\302\264\332\221\347C\313"
+	.ascii	"\021\270!M-S\273\352\f\224\262?\323\310l\231+#\311i\031H^\313"
+	.ascii	"m\371*[\345\247\274#\023\311C23W\345\263\334#;\235r\362T\306"
+	.ascii	"\312c\371+\307\310;\207\345\034\031G\356\312>\316\301\f\226\205"
+	.ascii	"\344\254\314#Ce\031y+S\345\037\347\233\034\225\321r\221\354\226"
+	.ascii	"u\234\204\347\234\254\225\3412\214\\#\227e\257\2630\007\311G"
+	.ascii	"\262\215\334\224gd\262l$\253e\261\374\226\225\344\033Y\352\214"
+	.ascii	"\223\223\234p.^6;\331\374\024<\333\234ew1\232G\224\364%9\313"
+	.ascii	"\376S\314\214\216y\347\364\302\f\306\ta\212\r\231\233\333Cc\225"
+	.ascii	"\343\004\213\322;\257\326\334\336\326\304\230Q\236T!\303\321"
+	.ascii	"\226\245\252y\"I\242\204y\204\255\215\331\243\215m\303\030l\016"
+	.ascii	"e\263\263\357Ls\302\325\235\360T\206\006\027BL\003\213\325v\003"
+	.ascii	"'\204&?\230w\256\313\030\234'V\260\226\234\235bgR\254\262\331"
+	.ascii	"9\343\344:\341\230'\232\340,r@\254\272\276\234bhP\232b\331\354"
+	.ascii	"\344q\222\3654\375\354M\266\345<\342\304\354\f\"d\n\246qE\306"
+	.ascii	"P\363\351\313\371d\356\253y\204I\020\346\336p\247\025\016/\314"
+	.ascii	"\275\341\304~T9c\374w./\316)f$\352\215\211\261\374\230\006\036"
+	.ascii	"U\023\027\322u1\353\372\270\230b@\310\250\2509\325\236\274\254"
+	.ascii	"\351r^\375\347\223lvF!\003;\217d\263\323\255\t\222\346\336p)"
+	.ascii	"\333]\332\216;#\377\002\f\255\2317(\275Rp\364\177\376\364\177"
+	.ascii	"\270\350\377H\321\377Y\323\3779\346g\232\377\fs\2129\001/\215"
+	.ascii	"-vUpFs\022VUQ\202\363\177\320\364\377\323\314Y\346\374;\375."
+	.ascii	"\336y\346$\023B\334\031u\3021\325'ceL\3163\030\356T;\341\352"
+	.ascii	"4\f&?p\226%gTO\323\317~\nc\306\334\033nD\b\347\031\314\344\214"
+	.ascii	"\272{\\\273I\r\biM8\241\017\037>|@\315\270\002\303\f\363\177"
+	.ascii	"~\350+e\350\347\230\314\243\r\026\021\234\377\323C\337\346\r"
+	.ascii	"J+\270@\351\177h\350\373\310\321\367i\352\373\200\321\367\251"
+	.ascii	"\323\367\201\323\367\t\242\357\263\245\357\363\244\337sF\277"
+	.ascii	"\007O\277\247\211~\217\021\375\0362\375\036\032\372<q\364y\232"
+	.ascii	"\372<b\364y\350\364y\330\364y|\350\363h\351\3634\351\357\264"
+	.ascii	"\321\337\021\243\277s\247\277\343D\037\356\002\245\337a\352\357"
+	.ascii	"\354\320\337\311\322\327\231\243\257\243F_G\213\276\016\234\276"
+	.ascii	"\316\231\276\016\r}\235'\375\241\032\375\341\026\375\241\023"
+	.ascii	"}\277\033\224~\230\246_w\201\322\017\277\364I\344L\273x\034\234"
+	.ascii	"E\340|0\2209Q\230\340\374a\r\375\313Az\026\026^\016\322\017\267"
+	.ascii	"\376\n\250\277Z\321_\221\350\257>\364\b7(\375:\245\257\005\365"
+	.ascii	"\365\236~\335\rJ\257\247\350k\271A\351I\366c8\247\324\031\245"
+	.ascii	"\034\322\345\004\347k'\372\232M\177O\210\276\306\241O\257S\307"
+	.ascii	"\305\023:\277\370\236\256\274p\276\336\322!\330W(}\341\025J\257"
+	.ascii	"\306\321W\371\364\325-\372?\267~r\375g\326\251u\336\310\300\316"
+	.ascii	"\217\032[_p>k\2346~\3368i\354\363\006\ba{;\2357|\344\354\355"
+	.ascii	"\344s\257\005\367Z\220\223\214\r\231K\363U,\372\262\r\375\334"
+	.ascii	"\362\tC'x\206\363U"
+	.ascii	"(\372PnP\272^\240\364*\233~\223L\177\360\006\245W\277\364U,\375"
+	.ascii	"t\216~\372\247\205nPz:\235O\027\217\202\023\352#B\370\331\024"
+	.ascii	"\347\303C\210\2040\016\316O\303\350_\n\322[x)H\237Z\321w_\240"
+	.ascii	"\324\303\r\"\364\300\363f\314\323\332\0349-\270\270\334p\306"
+	.ascii	"rp\336\355\331j\262\206\003g\fg\3508N\t@x$\301\371|\303\341\210"
+	.ascii	"\025\260\036\203nvz\314A\023\304\331\315\357p\330\336\200beQ"
+	.ascii	"\002\325F\360\366=\221\301\231\r\234\334\336\233\303\251\005"
+	.ascii	"O\210\025\316O\225\350@\254\346\342\3415\330\314\035n\236pu\232"
+	.ascii	"n\214\252\271\006\363\3412=N?\033jl\2129\f\374\201#\315i\204"
+	.ascii	"x|\204\251\201\341\374\224\f\215\034@|\346\342a4\370O\016\215"
+	.ascii	":\204\031H\343"
+	.string	"|#\247\327L\363Q@}\224\213\376\261\337q\231\274\033\266\267\334\326^\231.\234G\f\035\373\245kXv\274!\3237\307\\S\005\347;\274\327\343\364\263\367\331\2311X\314\305\303}}\230\017\207\271{e9\311\007\016\037\362\334\340\030\2274\207\301yW\235\201e\211\035\316G\263\350\343,]\3140\277`0\330\313\305\303{?\276\202\261\034\343\341\274\036t\357\260?&\336\303z8\257\307\tng\r\205d\375\301\021\372\360A\351F\026G\347\243k\372(\021\215\265\340-\027\217\003\346\362\013\005g9\352\004\267\341\366\336>7\260\354I\013\347\243?4\b\366\276\034\322[Xx9\244G{\350\237\033\224>r\004\203\310\361\261\355\341|\001\254\r\177\f\177\f\277p\300p\033\034\232\3610s\207\363\005PVV\246\303\310\274\340 \344\231\362\303\301e\213\007\217a\217\033\267\261H\214%I\262fd\206\225&C\262\017{"
+	.ascii	"\026\202i\322\0055\333I\023\213Z\203\363\005\320$&\246\321n\334"
+	.ascii	"\306\342 \347\252\r\216A\235.=+l8_\0048aa\\\303\260]\247\205"
+	.ascii	"\363E0\223#\307\360\353\353*\320\313u\323\264f\311P\307\207_"
+	.ascii	"t;\374\272|\340<\364\312\343\342\032v\t\2055\t\246F\256\332\340"
+	.ascii	"\030L[\363\244\207sW\233,_rp\276\bD\262\262\2066\324\272\253"
+	.ascii	"@/ki\324\035\230-5>\264A7t\222\205\312\033\234\2074N\247\311"
+	.ascii	"@\301A\210\363p\353tke\304\346\340<\234q:t\t\231\025>\234\207"
+	.ascii	"Z\"\304\270\272Zc\374\204\332_T\230{syX\301\270\001v\301\371"
+	.ascii	"!\304\031Z\r\255\326\030^Wi\276\326\366\346\362\260\200#_\270"
+	.ascii	"p~\bX\206U\303\252TM(\254\311\215:\343\352/\320G\f&`p~\beC\251"
+	.ascii	"\241\324p*\203\225\261$I\316$Tc\300\2060>\234\022l\262\347\206"
+	.ascii	"\363\005q\217\377k\352\005K\016\034\234\037B\030\341\207N\204"
+	.ascii	"C(\025\213\320~\202\332_f@q\256\310\324\r\356)/\017G=\300\272"
+	.ascii	"\f\237>\204\352\222\0266\251\023\0336\251d\372\362\342p\036n"
+	.ascii	"4\307\326_\221\302\177\335)\353\342%\020\347\203`F\037\2040\353"
+	.ascii	"\337\3274\177\253\2343\314\205\333\\aMjH8r5fmpOqy\350\211\221"
+	.ascii	"F\214\254\315W9_\343\214\b\341h\216=\2348\301y\205\363k\266\306"
+	.ascii	"\311\024\316_\007\3277\377\272\242\235\231B\210\363A\220\323"
+	.ascii	"\253\033\017\016g\207\234U\360h\260\f;5\0358\257l\236\206g\312"
+	.ascii	"\222\262u\315X\230'\234\327\346\252\346\342=o\r<\234O\217\035"
+	.ascii	"\f\020\224\350\337\347\245!\270\317KW4_\001\377u\265\373\"S\323"
+	.ascii	"\377z\346_\325\27119\2308\037\004\246>\bf|\027o\345[\313\240"
+	.ascii	"S{k}\200v\204\013\234\246\325\317I\307\016?+q\324j\214\371J\346"
+	.ascii	"_\303\254b\204\310\3701\207\363\3327\364u\314J\307\366\205\007"
+	.ascii	"\316\034.Pz\353nP\032\301\005J\017B\230\376\327\275u\017\345"
+	.ascii	"\303okS\341\0171\234\017\202\226\226\257^\264\234u82\343\353"
+	.ascii	"\r\n\r\234\327.\253\336\232\267rY\267\020J\371z\267JY\263x\340"
+	.ascii	"\3323:`\023[\233H\361\202\207\363\016\031T\22758\257v+\226\365"
+	.ascii	"\212U\030/\234\277^)\343\023\242\2063\266\242\266eAE\301\371"
+	.ascii	"k\3359\247\313\025*\234\277\206\340o\007\022\234\327*Z\212D\032"
+	.ascii	"\016V3qh\200L\371Z\345_\251\234W\347\215\fX\345\340J\203s\317"
+	.ascii	"\005J\327\034C_\247\340!P\362\362p>\211;\375\257Q\326(j\033\024"
+	.ascii	"~\366\036\343R\267\263\270@\364\3549+\0368\237\304[\327\327\036"
+	.ascii	"\253\217\265\354\342\255]\353\223\241\247\355\264V\202\025;\237"
+	.ascii	"70\312\370\341\354Du\"3f\013\316'AD\233\255@\3164\203\3741W\""
+	.ascii	"w\257\f\001F\276\bY\177\264\231Y\337\326\"k\333\335\343\372\331"
+	.ascii	"PU\006\233\353\333:\304o\311\332d\225[\343V\267\025ner\361\326"
+	.ascii	"\2675\355\253\217\265\354B\353\333zV\246\2717\234\017\033\266"
+	.ascii	"'7~\262\331\321L\3604\205\202\033\340\312\266*\271xk\033\224"
+	.ascii	"\265mU[\223L\3604\265\235\304H\360r\225D\016\207\017<\201b\374"
+	.ascii	"r\244\371_\223\254H\246\300\371X\203\363\272\006\310u\203\304"
+	.ascii	"\f\375\257F.\336zD\013\256Y\211s4x?\306\274\340|\022X\372$\250"
+	.ascii	"\364G\310Y\321t_S\207\027\234?\242\215\376\210@\375\021\177\372"
+	.ascii	"#\306\350\217\360\242?b\213\376W \353\0179.l\274\254?\316\250"
+	.ascii	"0zVO8\177\304\235\306p7(\365p\201\322Ul\345\261\222\375\253O"
+	.ascii	"\222\272\036Rp\376\b*\372\353\330\377U\205\037_\244\340\234\357"
+	.ascii	"\357\3225\354\353\216\177\305yC\2302p\376\b(\372\353\327\n\366"
+	.ascii	"\257=~gQ\226\340\374\021p\372\253\016)\205l\272p^\275\264\324"
+	.ascii	"\b\"\034\fuT\001\313\201\343\253\327\277\3468\221\2347Z(\234"
+	.ascii	"\343\006g\236\013\224b\035C_q\350x\311\322|\303\371#t\254Z\253"
+	.ascii	"\326z#\004\2558/\020\250\034\240\021\0336v\302\214\330hf\034"
+	.ascii	"s}r8\2575V\032\370\364\241Uf\f\347u+]\202\003\252\016\347"
+	.string	"\217Xg\fba\r\001S\305T\303\371C}\253\214U\206\016\262\256\371\301\224\252\243\201\003\347\017uY\251V\2525FO\232]!]\2307\234\377\265\352k\f\272\2359%\205Z~W\303\n\233\036\316\037j\262\302Xa\350\2525\\M\235\270.f\256\024\211\212\322\341t\2265x\346u\371j\303\371C_\353\323\372\244\253\356\336=]\201G\306\220x\341\374!\030zmZ\233t\330\272\267`O\r\276A\"lWp\376\007i\n\013\003?\3202gN\227]\034\0341:\016\006\323\033mo\247\037C7|A\364?\240\241\177=\250\007\267\210|\260\327hA\335\006\203\375l\276\275\226\275\025\212H\243\331h6\252\234\3778\025\332\211\320\323\0271\247\177\335T\203{8%\321\027Q\246\177\r\250\001\325D\324\320\177\377\210\020\264\030}\346\276!\340i\357\257\262\341\033;B\375\020}\372z\314\325~Z\214.\203\036A"
+	.ascii	"\325\336bB\206o\342B\324\351\207@\242\177\321#\351\257\373t\037"
+	.ascii	"\nuN\2059\215\201\2006\203\217\215\352\346\t\260\006\316\017"
+	.ascii	"\001\266\267\247\303\340\265\355\300\030\303\346\245\371\256"
+	.ascii	"\303\f\301\254A\231\203\263\006\2232\251+\303\005\314\221\377"
+	.ascii	"+\321\335\217A\234\037BKk/\332\213\016\262\356\235\027\227\206"
+	.ascii	"c\220\013\347{ \250\271p\321]\004U=;./\017<"
+	.string	"\177z\201`\362\256\273\334\311\300B#\004\347>-Z\324>\f]\216\310i\266\331\021\007\r\316\367@Ng\311\242\321\356\316\232\323\303eIW\027\316\367"
+	.ascii	"M\377\032\213\306\202\362"
+	.string	"\241G\3165 @\300p\276\007aZ\333i;U\n\357}dK\263I\\\330\026\234\357\001W\225*\272\016\303\276T\203if\232.\365\"e\311\020\234\357\201\223~\007d\246L\321\221E\377zn.\315\253\203(P\240\244\345\350@\211\017\037\\)\230\223\0177^\330\232\350&Q\232?\2300\351r\352\240K\377z\211^r#\256\003*\375\3537\375\026\304\307\256\354\215\030\316\007\021G\377\247\224SJ\r\261\237ZN-\247\232\207\355\344\224\201Z\3345\233f\343b\202 \243\177\215D#\301`,\266\036D\223\221\247\177}\344\342\351#\031\013\026\333\253\0304\253&\210)\372?\251\234T\264\212\024Q\245\356\336\251Z\\\tg\312,\301\371 \334\364\177r9\271tPc25Z\332\0257|C\344\357\n\215\257\310\331\034\316\007\301<;\323AP\330{7\375\354\247?\031L\273\346\032\017\234\017\302K\003\001\242\203P"
+	.string	"\026\2503cn\213\335u\020\2722\"<\242\340|\020P\372\327f\332\214\310\2073\232L\223i\037z\027j.#hN\272\307\265\017\036\251)rh[K\312\306\200\340\374\017Y\364\365\216\253\307\364\230\335Y\326\340\022\r\246\301t\030\n;C\241\330\025\231>'8\353\260\373\206\2266f\205\363?\230\351\353\034W\353\320:\236\3745?p\351\323]\f\265\267\023\006>dJ\374j\340\254qh\034\252\336\034\273\263\254A!3\212D\301\371\037\232\364\265\215\253\2714W\232\214&\033\375{F\245\277\256Q\343T\363\200\2004,\246\031\375\353-\275u\252\241{\207\231\245h|{XZ\013K\325\313\312R\365|\306\330\b\214\302\371\001\250\242\037"
+	.string	"5\375k\031Z\206\016\261"
+	.string	"\214i\030:\206\206\241\253R=\245\247t\325m\323s\203\207\314\234\2722Mu]\005\230\315\316\324\370\273o;U3\256|\341\374"
+	.string	"X\351{"
+	.string	"\324\277\216\322Qoq\036\256\350&\375\244\233T=\355\244\235T\2756C<1.:"
+	.string	"\277\340|\017o\372\036x\024\026\236QB\273)\320\002\0353<`\r\252s\006U9\351\2337\252\234;\324\301w\2265\210\333XM]\305\271*\207\356$k\362b\203\263\n\307\314\233\221%\034"
+	.string	"\352s\340D\377\352\232\213\247\256Q\333\\\255\275\235\2702\260\202Jy2\307\210\332\346W\331\250\202\350\215\213\304\314\337\025\316\034\262nPz\316\270@\35198;\243\2529\2436S4h\324&\336a{3U-H\312\232i\220\25616i\2566\305\304\251\242\303Y\005\344"
+	.string	"L\237\003*3f\3400w\026\027\210!\225?\033<p\376\006l\364\257\372\251~{ho\232;\213\013\204\216\r\034}{8\177\203,|\352\030>\265o\2030a\324\276u7\271Q\265\342\316\262\006W\035c\314\324\211\271\332Gw\237\230\001se\203$\372\033\334\320\277\272\247\356\021\331`sQ\275pQ\365\362\362T\275\024\314\356,k\255\307)\b\263G\227\253zmrbdh\240\247\257A\032\026U\013\026\025\357\356N\305\213\023w\2265\250\301tAie\271\212\247\001\r\375\f"
+	.string	"\355\354\2764\357\352\352\322<t(G\006oU\252\2301\2332\345\276}\240\322\225\361kf0\025\247B\211S\347\324(W\347"
+	.string	"\365~\244\311\251\275\245q\365\300\231\311\231\250O\356\316\332\233\253"
+	.ascii	"tH\232\233\213\313\203\252v&\n\034'W\237\020\006\336p\302Ymr"
+	.ascii	"\252%\031,+\202\263*wF\375\245\311\263\303\371\202g\324\377\025"
+	.ascii	"\035ks\206\016\347c\360\247\217\301\023\375\253p*\334\034f\232"
+	.ascii	"\376U7\325\r,\356,k\220L\377j\233\332\226\346\r\263\030@\305"
+	.ascii	"\245+I\222\353\267\005\003,\375\253k\352\232\024\f\244\364\257"
+	.ascii	"\032Q\215$\021,R\344\266I\263\326+3 M/D\210\374h^P\307d\326\230"
+	.ascii	"q\001\333\331\231\252\305\245c\344\n\031+8\377\202\036ccj\020"
+	.ascii	"\fY\f(S\326T\203\250@\206R\200TFp\376\361\2015r\302p\376\005"
+	.ascii	"7\364\177\325\207Zv\361T3\225\354\231\204j\246\362\300U\347\222"
+	.ascii	"\254\265\312\fK5S{\\2"
+	.string	"w\017\312\3363\206\266\234\316\262\006}r\344@\362$\315\277\240J\337\2028\372\026\250\321\267@L\216\034\352\216\037=\204e\362v\330\325\035\303&r\310\316\340\254z\251`;[;\006\351T0\365\013M\310\325\r*,\310\006\370\244\003Ca4Wi\344\334uu\005Z\260\344\306\215\273\206\n\255\301&e\006\347[\200\246\177\265\006\236Z\343\372\255\005\330\342\263\240\307\326\026\356\201\302v\322\352 \315I\013\210\265\307\032\034Sp\276\0054\324\030\217\241j\335\270\215u\303t\301p\033\334\233\313\303\016\231&\0322YW\265\350v\246\234\004\225\340\254Z\251XcQ\312\330\300R\257\254\360(s\032\263#'G \031U\306\325RD,\311\236\005N\372W\251T\252\333\346\234\332Nc\032l\331uh\352'\025\306\223*\225\356}\341\302\260\2626W\226\007\025J\205R\245t\023\2074\"\303!P\304\260\341\374\253QW\245"
+	.string	"\205\b\016\376\300\371\202:^p\314\360\303\371\035\300\350w\220\242\177\265Im*cv(RX\b\306\354\260c\316\234-\276\0162\364\237\306I\343P=\371\2641\242\003\b\316\357\320\264fM\372\346Nl\360\351\033\300\fD\212\312\025\316\251\2334\254\031H\370\207s\332\346wz\360\316\317\013\347T0\365\242#c\327\3049es:\237*K\374\200"
+	.string	"\200\214\0325H\264\244Is\272\233\245\001F\0246"
+	.string	"\264\241AsF}\240\316Q\2555\001\200\366\367W#\020"
+	.string	">\302\204I\313\f\225\360\371=-\243\363CI\031/\234S2\277s\302\344\016\347t\314\351|\270\266\024!\3049\355\023\003\200\033`\300PEab}\371r\273\304"
+	.ascii	"\340\244\377T/\325Ss\022"
+	.string	"\324\177\252\345\342\245Z\322<tj\357\031C]i\336\237nI\271\340*\314e\217L\031\316\027\356\006\245B\027(}\005i\254XI\263\f\323\002\357\236f\301=\274\370\331\3009\305\362;\264\302)GpN\257\330U\300E\377\347\331\331\031%T\002\032\033\363'\363d\336\020\233\233K\251\f\365\002\247<\245r\272Q\361a\206s*\345\3642\305\216\007\316\027L\237z|I\301\371\025<\201\002\005I\252U\001\333\333[\352DmF\332\344\251\223\273\244\n\215)\234S\271\337Q\261\222\203\013\347tI\312\304\247N\357\215\\\312$\215C\375j\\\235\t\245\200F\t\036\316)\\\005D\224(9]\376\3311\236\300\300\330\330N\367uo-o\352*\250B\202\204o\r\rkP\377\351\221#g\324\271\367WY\2725\203\002\276\264HZ$U\273!\226\252\321\255\\@\262p>\005Q\210\020A\3670\354K\025\206\346\325\244"
+	.ascii	"\b\223\251\243\353\354\f\345\202a_*&\032\216&\005SA\202\234\016"
+	.ascii	"\205\313D\303b\022\376\370q\272\355\321\330ay\\\332a\223X\020"
+	.ascii	"\333\245\024K\244\020\254\222\261M*\025\255FG#Q9\\\221a\351\310"
+	.ascii	"\266m\t\023)\250h\331#\016Gc\222\005\027\304\t\260Kc\320O\222"
+	.ascii	"\005\240e\322\022\022i\t\324\032\225\214(\214N\354\034)\004"
+	.string	"\221\210\017\255\361\230B\222\205\"\006\246\242\216Q\253\344\300\022=\241\002E\320\t\025(\200Z\3431\205\243\221x\002Ok<\246\360\343\200\226=\301\310\307\0052\311H\311\266h"
+	.ascii	"R\311t\224\241X\242e\227\027\224\224\304\245\261\230\262-q\205"
+	.ascii	"\226=\362)\036\211,\212D\326\204Q\317\221B\260\312\240\"\333"
+	.ascii	"\022\227F\fG\n\261Dj\211JFl\022\261h\251\343s\244\020EJ\021E"
+	.ascii	"FK\026%\222\214X\023E+\264\354\021\206#\205P\262/\214J\"^\030"
+	.ascii	"S(\221-2E\313\036\375\250G\n\261LJ\"\026!\265D%\021\313\326\310"
+	.ascii	"B\304\322\361\310\203\027KGc\222\007 \210@$\302\b/D\264\313#"
+	.ascii	"\262\b5j\217FeRz\244\020GG\243\262]\212`\213KIEG\243\b\345rI"
+	.ascii	"\204"
+	.string	"\206\244\244\245\343\021yT[\"\266\005\3432u\201T\"\265\310\243jDd\2232S\262H\211UJ\227\254\022Q\205\2421\251\231\222H\023z\2100\234\330\022\213-\273\354Y\301\201)\2114!\250=R\210\243\244\210\243$P\321qI\347h\204\321%\321Qr\247%:\036%\321\343Q\362LJ\331\026\214\313\274\\\262\312b\221\2502%\221EY\331&\317\"{<2&\021\325\"\273\\\312K\365J\242\243d\b\036&e\2734\036\261+dh\211^\260\305\243\221\210'IL\361\202-\036S@\256X\022\215I%\212\224\032T`XaBk\3701&\203\330\"2\305\006\266\005\rG\244\261-b\225J\244\tI\310\240\240\241\020lK\\\001\251d:a\203Q\005\320\317\205\017B$1\370\214\b\241dY(-\251\300*\021\225'\332%1\351\002\006\r$B,!\215-X\245\nv\251h\311\256\260L\036\te"
+	.string	"!\304\212VIlY`\213\310\024\032Lh\217\254R\271T\304A\311&\361\224\220\340xdd\201Mvh\215\307\024\212\306$\006\265-\262JH\345\t#\243\b\216F\342\tGc\212\"R\311t\302\321\230\242\270\343\2028\001\f.\210\023H\201].\375\030\031\340\303\323\342\230\002\020Sk,B&\261\020xAT\322\351\341)\032\223<'\200Z\366\204\2421\271\241\310&\261 \036\025\020T\\6 Cq\331\200\2421\271\341'\205\235\027\304\2431\305zAI\311\2560a\224Dqd*\n\261-\214mQ\211\013\032Z\226\205\2421IAkT2\242h\331\245\221Q\003\""
+	.ascii	"\212 C\207\0258`\"*\225%60%\203\022\220!\211X\204T&\215E\354"
+	.ascii	"\n\024H\260\242hL^`\224D\341\202\022\001\250\200m\211\305\344"
+	.ascii	"\003\212\306\244\006\t\020\032jU\004\261I\246\025GG#R\213D*\261"
+	.ascii	"P\244\f*\262-\030\223\210\306\326xL\241\303\004FI\024l\013cK"
+	.ascii	"laT\262&0`\227J\266\3051\205\r\030\223,\030\031\001\265K$2\001"
+	.ascii	"FF<Gc\212\242\016{t$\256p4\246(\256ED\375s<\241aD\206\241\023"
+	.string	"&2\264;KD=\353\316\361\004\320\211\244\244\245\243\317\260hTq\001\251\250E\252\320\363A\210VIL\206X\236h\215\307\024\212\306d\220\006\244\222\351\004\f&tZ\226\205\342\261D\221\003\233dZ\321\303\202\004FI\024.\326\027\304$v\005\237\"\242ZD\334a*:\262K\034`\225'\212\306\344\216Q\022E\021\021MB*\333\245$\344\222E\211\f(0\034\215\304\023t\212\306\244F\032[\342\nJd[D<\201\301\204\f\nh\223\214+\202\220\332\243#\253lYHb[\260(P(J\"\026\t-YVy\304\2320\026\261&(`[\342\n\313\007\034\215\304\023V\236\345\003\230\210+~\226\017hK\024\331\266\210mY\023\027\330\"2\305\321\b\304&\025\217D$ ti|Q\342h\211\005kB\311\270\002\205\320\321H<\301'hi|Q\202\230A\037)D\021\021\253dl\217KJ\021EF"
+	.ascii	"(\"S\370\254@*\213J0%%\223\304\237%\321\361\304Q2\210\330\022"
+	.ascii	"M\024\215"
+	.string	"I\025\251d:\312+\212\370H!\216\226X\260E\021\305$\343\022\013\016l\021\231b=\032\211'\024\021\323\025x\216%\224\224l\233\302\206\345\222-*\"\246\027 Q\201!\f\\\200D\005>\300\300P\211l\213X\b\260;\255\332.\225l\322\222\002\330\342Rkl[bPKDl\223X\023\254\222\261\325Qb\333%\023\013\021\264\030\224l\313*!\203Z@\"2J&\rY%\321EQIT.\215\210\220\216\214HDEE\304\235\266%2b\213\034\216\024\202\202\"\333\262II%\244\t,\214I\304\242\fK\t\226EF%\342\221\311D\020R\311R\240\250\210\250j\0301d\224D\301\026\221JJ#\021\310(\211B\307\005q\002JJ\266M\372``\211\226G\304\244\023l\022\013\342\322h\342\350hTR\0223\264D\313\007\260J\306V\003\251\360y\221Q\311\036\331#}\020D\360@\204\021^\250\037a"
+	.string	"\037\f\340\203\364#\f`hh"
+	.string	"\"\f\351\2130t\206\020B"
+	.string	"$\206\222JlK\324\262KVI\024\244D*\225\nX\032_\020W\226\210m\211-\013\306$#\013b\313B\321\230\334\300\022\255\200\264$*M(\032\223\030Z\"2\311\bm\217\306\263=R\b\021E\031\260-q\005\240\021\212\306\024J\244V\035\001\231|\241"
+	.string	"%R\253\227K\266%\256P\244T\221\311\027\n(R\246K\266%*Q\023)\250P\"\25582\025\327\r\020Y%\013\"b\262\005Jj\030\262Ed\nb\262U\227DGF\243\243\216\022\362\310\026\211\226K\266\b\251L\022\025\215\311\013G\244\261=\262-Xe2\202\016DlKlal\213\210l\221\310\310\b\311n\200\330\0221\021]\020\217KJ\fX\"6\311\264\342\2104\246`d\024\324\276(D\321\2304b"
+	.string	"^\026\031\215\214X\244\tEc\362'\311"
+	.string	"ld"
+	.string	".2"
+	.string	"\267\0330&\227DFF=K\"\025Ecr\247\005$\"\027D\246\236\026\220\210~Z@j\227DFEc2-\032\223g{4\"U$\227\212Gc\0046\350\270 N`\211\205\2421\331s4\246hK\024\215\311\037\266\005\233\344\323\026\261FF@l\021\251D\324*\331\344\013\226\250M2\266DGd\013F%\022I\210-\"S0\265\306\026D\345\t\306\366H\364Y\241\341h$\236\240D\226\310\260\202\013\"\323\205$\266\250\250\004\333\022\225=\305\243\237b\022\022i\311\032\221\311\226]\n\261J\306v\310DLb\213:\031\200\226G6\251\2044\241hT\321\022Y\264"
+	.string	":\"\215\355\212\242\222\350B\211<QdY\243 \027D&\"\237a\013HD\027\230\224l\013d\021\253$BZ\022\225E==A-\262\207M2\265?F\235\243#Qhi|A$:Zb\301\0267\034\215\304\243\013K%\242\"\221E\"n"
+	.ascii	"\211L\"R\262G#Q\331\022!\225ED\016G#\361\350\347\202\022\251"
+	.ascii	"T\262\033\214\214\220\355R\021Q\021\321\222\005\021\003\233d"
+	.ascii	"j\211F`h\001\211\350hl\211D\030j\001II\311\266E\"\243d\022\321"
+	.ascii	"\221\251\230\201-\"S\034\331\"%\253b\305\004\255Q\311\210\202"
+	.ascii	"M::\226\330p4\022O\270\320\262Kv\005%{tdT\256p\201LJ*\221\204"
+	.ascii	"T\266G\244\tHE\307%bR\005D\354r\t\303\013b\022"
+	.ascii	"\253$rAd\"*\262-Qy\304\266Gc\206\026\214J\"{4\242h\227KJ\244"
+	.ascii	"\026\b=\032\211GC\266\350HlQ$\026y\332\245d\273\204$R\"[\244"
+	.ascii	"\022\206\264=.!\213\210\222\222\330\"\"\"d\273D\334\220\324\266"
+	.ascii	"H%RK\324\036Y\343\362HT\266B\355\022\211dAdd\244\225D\244\242"
+	.ascii	"\314*\021U`\223\214FHeRG)\251$:\032\225v\212,\233\\\022\265G"
+	.ascii	"V\251].i\240H\fJ\213\306d\017\273$\262\312\242\243\221M*\032"
+	.ascii	"/$\227DlKLB&\225l{4\216\320\036\215KjkT2&\021\261-QI\364\202"
+	.ascii	"\250Dddt\2415b\213D\355\206#\2058\"\215-Q\311&\261EE\304\013"
+	.ascii	"\226KDK%\243r\005RQkTQ<\226HJB*\201\\\020\225\347\221B,)\031"
+	.ascii	"\223\222\220\312\214T\324\032\223hK$\302P{4\252.\210L\347\222"
+	.ascii	"]J\"\266H\333#\t)-\261p.\211\210-\321\304\322\370\242D\321\230"
+	.ascii	"\344QqS\270&"
+	.string	"\356\211\273$B*\231\216\322\226h\004\211\366h\\\322\254\222\261M\"\221(Z\366HIl{\330$b\321\022U\215L0QB\267K\242\026\254\t\244\222\351hm\301\232`\301\005Q\231!\211'\250=R\b\244\222\351H\304R\211\\\036\331e\004\027\226\210P \225LG@\355\006\356\222H\207m\211\355\022e[b\313\302P\233\354\031\261\\\022\223.\220I=CC@#v\202\224\255\212\237vI\244G\034O0%%\223%4\364\264H!\214D\034\221JJ\310\"\t\216L\262J\021-\022\251\024\2413\202\t/\211\212\304%\016\030Y\364|h\310\204\016\017P\341\004]\024\242hL\212h\221\216\214IF\"\216F\242\222\210\"\345RD\210\r\037\260\300C,\360\b\026x\210\210G\020\361\320\013<\342\005\036b\302#\216L&\224l\233d<\201T\324\"\217>IHd\002\210\320\353\310i6)jPp\376"
+	.ascii	"\262h88\235\2706\017_\352\3104\227\\'\016\005\303vf\205e\006"
+	.ascii	"\300D\323a6e\206\230\271\275e'|RH\224\f\221\360\255\211\323\327"
+	.ascii	"6$2&\2667\006g\340:r\225DW\341 7\320\200!\031^\331Y\223\347\343"
+	.ascii	"\314\332\020\017\2431\301\313rD\325\322>\210x\371"
+	.string	"2\362fG\307\025\033=5\275!v\204\204E\32221\324\324\276\244\245b\253\034<17\"T\326'\032T\240\320R)4\212\215.qL'q\306\3066\0362\334\373\"\013\303v\206\246\311G\312\216\264\021\242\006\351i\272\251Q%\310\365c\306\361\230\001D\005\342C7\b\306\310\217K\346\315\034<#8\303\265\355\r\327\223\032\t\002\303J\331\320\206\216`\337\027@\037i\026\375\246\006\310\216\036\303\2574\247\265B\035\262\256\035!I\336h\351\360Pw\370L\331\201\325\2473\226\346\275\301\bC\247#\246\312Y\263\342\205f\007\372\207\347\344G\032\270\"O\326\306\350\200\r\241T'\203Uf\350|i\264\034\245\253lLG\307\260\207\024\251968\377\342\351x\351\260\004\004Z\221\3458\242\323%NN\026\0336t\272n\326\032\017\332\260\322\210p]\247\013\345\342c\306\307\035\027\234un\240GN>B!n\006"
+	.string	"\246\177\235\032jnP\270\272\340\254\263\225\273<\331\305\300\031N\030,78\353\310\320\221\241\243u\fNBt\274\256\002\275\fn.\032\036~\235\254\353h\031a\202\306\n\316:X:W\003\240\241\177\035+\264\313\207\301\036q1\326\030\200_hbp\326\231\322\241\272N\325u\252\260N\325YX\230*\021\363$\315\277\016\214\346\272\346\312-OGJ\355\033F)TsF'\n\365\322F\f\006\234N\223N\223\316S\234\031:N\327y\002\f\3636\306\217\204B\375\353l]\367\304\t\231=\234Q\251U\n[\021+\302\341\224\217_\030\231\325\234=<\344j\210\240\034.\267i\214\034\2208\247\332\215\2508Rp\036\276\021\323\307\346\263\345\303\311\307\240\236\017\017\2568Q\334\340\265\231C\357\2444\225\t\252R\370\213\r\234A6\267M\217\226.\033@\326\340\036Q"
+	.string	"\367b\f\325|\030\030hcG\016\234\207i\206\315\377\353y\2049W\006\347_\274\243\001L;c\347\206\363\020\315\020\260\214\031\345J\2327\263\006\213\f\2329\263\312Q\257\330\342\364\370S\333\234J|\b\252\231Aw A\363eX\006\345\333*Ks\342\227%\345*\344[\303y\314\230T\355+o\311\213\372\303\371$\364i1\277\030\035&\024v\366}\301A\2706\226g\246\003\347\223`\205\217O\207a\3319\203\343\305\005\347\223\300\366\345\313pO(\254IM"
+	.ascii	"\262\\\245\371\342\3227\366\204\363"
+	.string	"\036\356\021\347&\312\324\217-[\206z6\260z\024\031\274Nkn\252\272|\250G\007\345\215\032'\234\207y\277\333\261\302:b\205\363\220\313}\353\033\324\033\324u(\331]\0322\033wwC\274 \034j\222\246\2341Y>\304\323n\316\254\350\221\340T\245\312\360\n\005\\}P\224\340\030\332}x\205\016\257\f\033\"8\017\255\374\216G\016X\032\r\234\207ut#\bN\231\242Jq\240\201\325\243\210>\003\203/\b\316\037\341\310\334\234\332\327w\006\007\341`\230\r+T8\177\004 \303&\037B\0316Q\373t\340\276\206o(\020.n5p\036>qB\306\204\311\360\355\n\311F\240\025\316\037\001k\311\222!\0223\325\316O\353\r\033\333\360\355\376\300=\205\211\241\237\314y\345\030\272}\370\346\023g\305\345\r\316C%*\026\036\325\333\034\234\207m\247\323\022G\245\331g\304\310\020IYS\307\207\327\230\253\341\332\207H"
+	.string	"}\326\b\245\324\300yx\004\257H\221\341\227\220\336J\302\2005\257(\341{\023%H\220!\021!\275\2250\261j\236O\376\334\334\f\321>$\002\310\243\343K\356\f\316C&\001\240\362\372p\036\0169\335\036\234\r\0318\017\317p\217\236 dn6p\036\n9\035\330\\\213S\250\324#\222X\206\003\262,G\0231\346\230r\314P\021I\203"
+	.string	"s\025"
+	.string	"0X@\030\217\212\345q\355\006\024\200\016R\320\236~L\233\354I\022*\244\320\214"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	"\r\344b\370<R"
+	.string	"+tO"
+	.string	""
+	.string	"\200w\261\255\266D\262\272N\274\321\371e\323\373\027@\244\032\233\237\244"
+	.string	"\241\353w\006\221\223\325m\314\207\366\275Y\371\235\342O\216\261\013\035"
+	.ascii	"\021H\005\324\325\020\2723#\0072\2132b\217m@y5,\272R\0242<\334"
+	.ascii	"\n\242\254my3Vt\377YR\326\200\024T\373\2434B\227^\031\236\343"
+	.ascii	"\226\346\022\3433:\360\345\002\036\002_U!\ns\036,\021\253\255"
+	.ascii	"\207)v\177\222Q\252$\351\310\003\030\311\0067b\303\341V\035/"
+	.ascii	"\031\264\206\004\304\330\200\022\221B7\372n\303O\t\207\2664\374"
+	.ascii	"\2231CA\331\177\210\341_\017\356\230\311\357\244\fk>\265@U$W"
+	.ascii	"l\323\310\nL\302Z^&$\013)D\021\021\203\231\247\243\224%\265\r"
+	.ascii	"\340\203\344R\267\236\232=\345\376\207H\372\211\343l\226\353"
+	.ascii	"\362+\335\003\307e\324 \245\272\211\031\213\237\n\354s\330+\243"
+	.ascii	"#W\204@#\374\267\226\211\202\007\200\360\245wZA\237\230\341\312"
+	.ascii	"At\326\230\264\251\260\247\023\236EZ_$%}\206\253s\033\354\317"
+	.ascii	"\240\311\276Ja\256\211<\310W\254\335Kq@P\016q"
+	.string	"\342\206\204\225\213]\267H\266Y\376\002\257\020V\302\346\315\026}4\216\321\2352eB\2670mTP\246!\022=\242\375\213\037\230uH\345^\206\260'\277\236\300\350\267\236&\223\027\236\003\240\315v\314\034\273\255\376\327&\246\013$\225\033#\002\362c?3\231u\304\335\301l\263\306'v\024\177\305Z\244\300Z\326\272\bf\244\034\341TQ\022\260\203\007\366\332NepO\020\204\210\373\240_\261\367\306Wt+\"h\355t\346p\275-\212\376H\216]\252$\031\372W\3561\312=HB\rZ\352\013\021\r\241\022\007B\267\341\344f\023\033h\037\326v\212\260\tR\347M\357\355\326Yf\016\317\264f\035\\"
+	.string	" \222\341,\364\021\210\226D!\247y%\250\277@\301\026\326\225\0256c=d\037h\224\034\223\346\323\256)\313yIt\004k\245\016\353\217\203\257\2407\375B\377\0308q\360\333I\373\023\365\362G0\177L\272\030\017\325\365{m|Ex\034\277\2740\367g\250\256z\231\277DN\332\226GX\006\312Y\006\276\303\360s\365/l\207R\351\017\2766\263\355\260S\377*\363\346\207\342<\025C\253\2222\320]\241:{W\3571){-c\241\r\031Y\355\202 \232>Y{\352\007\221\272\003\\\370\023t\317\306\005$|Vm\255f?\371\323{\341\007\244\244[\350Z\306\005mx\315\305\f\364\311a\271HB\255\3439\377\350\236m.\233\004\253\004\017\024\236$>\ng\271`\225\212\364\006\204u\216\335\312c\236\013v\363%s\256\026\313<\313u\347\005g3=K\230(\f]\004"
+	.string	"\251\226!\262,x*1D$\355yP\315\362\260\277G\200\315|ct\361n\307F\017k\277\273\r\024\321\366SJ\235\272\221\nFY\365\262u\237\235\036\317\304Z\343\375\317B%\211\b\006\242\364\346\346\271|(\341\226\240%\016\206\263wA\272IfA\257y3\314l\255\256\223\342\032\354MD+),\336T\020\372~\331\231\237@z6\t\027\2751\205a\303\254\304\030\376\302<\251N`?\276\256\326%z++t\362\220o\003[s<\343\215\232\263$\026\263\272\350\361#\201~1\304+\034\237b!6\266\347J\254\200^\204YL!\3174c4\217KZ\016\262\r\026\036\360\271\205*6\300\003{:\300+m\003\353Oij\361w\302\223\232\306\245\016\"(\\\362\335\315\226E\340\253\261\027\204\220p\025\210"
+	.ascii	"7\34467e\357I\272\027<\276\371~5\274\t\374\330\270x\r(\213%P"
+	.ascii	"\007)\225`&s\033\265\220G\316\212\226\340\2245\t\311\216]\376"
+	.ascii	"za\004\216/\027\017t]\315\232\212}\207<\260\327\325\206\350G"
+	.ascii	"\334\354:\260\201\237\b\013\232\177\312\376g?\3008\034\0311\255"
+	.ascii	"L\004{\323\222\216!x\301\213\344l9\313w\266\354\022\276\234\260"
+	.ascii	"z\243\250\026X\244\341\205v\0241\310\274\327\017\217\217\362"
+	.ascii	";\002kX\250\214\335\365H\031Q\234\352t\260\226\026RW\270!^\021"
+	.ascii	"\223Q&(V\260X\031}\311\313_\242,d\251\335g\203\263\301\271\347"
+	.ascii	"mT\270@\353\221\254\"\2651\277\257\227\300\244\\\275\364SfME"
+	.string	"~3\317\003\267\330\210\257\271\026\\\342\274\013p\323QF\033\270\330R\216\353\200\253&\"r\025K\023A,=\rL\204;\343X\362\260\013\312\327\030U\024\364\350\201E\020\332J}\243a\rG\310\322\267\001:<a\n;^\222\261C\n\227\020\233\005\307*:\266\277\220\233\213\231\020'\276\232\217@\317\r~\357\f\242Ra\b\314\337\b\tV\261</\274\370\n\323\177\301\244\275\355\227;\363[\314\021\023\222\036t`6\354%S&\336KQr\001M\212c\323\255f\024\307\300\237\313Ug;`\256\265\r\342\2511\034I\346\002\372\321\373\255\327\335\263\242D\\\230\337(\032yT\321\005\263\220-\237\256\206jj\340\270'/\245l\215\016\274\025\320\345\n\357\005\244\352\362\267\200(-<\345\227:\237\351\220M\314\220\366\222\333\211!\263\200FQ=\300f\333'\352h\344\347\022\0349~\300rF\253\027\216\204v\tD"
+	.string	"\365\021\210\306<\352\036F\246~N\352\321\035EW-8F \243\320\375D\300\267\302/JZ\272\361;\371\250\306:$@C\331\204\345\232\036']\205$]\2125*\322|Mq\347o\007z\321]\372\333\345\211H2\210TU\023'\035\300CW|\231\266\237G\257\314\035\235\007>V\326\217\225b\006\276\022\001\245\177\313\353\334\256\003\212\256\221\307\0314\270\204\033>\005noDs#p\225 \205\232\214\367\241(\017E\351\324\206\341\022}\t'\020\352Uj\227\355\365\017\310TbQF"
+	.string	"\351\226\372\350\t\340\032n\260\201\315(\212\207(ta)\222T\241\016\r\360\335\363\311\207W-\206\031\313\314\250\tE*F[\t\340\240$v\245if\332\310\251\371n2\022\221\351\376\243\th:\204\352\204\332\276\022;b\341\346\345\241\n\305\3158vd\204B8\b=c\212\231\244V\235SU\270c\275\250*\217F*O#\247z\312G&\236aC(\231\312H\b\0304\233\242\213\351\351\271C\254d\0225\t\220\220\233\260X\331\022|\036\350=\022k\335\211\017\016,P\333\362\022\250\246j\275\310\334\360M\027\036\344\030\221O\332\207\021\006.\177P\350{s\311\337x\2753Yd\003^t\215o\224\022t\340\264\016\267\305s"
+	.string	"\307d\334\005\353Q\374\263\037\262Rx\326\031V\377W\371\302\324\315\322\204\261@\344\227xR\242k\245\020\304\222\261Rq\003\035[\304\237\353\271\272\337s\327(\345\343\031\366\331\023if\250\204)H\312\017\246"
+	.string	"\216"
+	.ascii	"b\212\323O~p\016G\344\031cM\022R"
+	.string	"\001\034\342\230\230\252]\376\245\025\252\330\275?\261)\330\377\007!G\314 \306,\312\350\254~\270+\316\363%\306\2427\2104\302u\301\260ol\374\305\235;+H\n\205\242\t\271\032\317\370IGAV\215\327\370\f*/07\273A,\364l\270\337\006];\231\335\227\026\275<ah\r[A'x_,\276\"4\361R&\264Hu\013\220\372\271\nc\2047\344\024\257\f*\325A\227E\330\361&`\231T\370\005\032#\325\311\360\316\214\f\027\314\311\335\3778\352[3\007\243\326\202r\303h\267\255\351\013`\366t\355\375\260 }\255\353\375\272\335\177\177P\215OS\303h\365\\M\3700\027\306\\\321L\255\254\371\2041yH\031\372\304<\215\322\213\031\365\347\273r~5x\006p\031\372udvK\241\314\035\326\272\2260\362%\226\250\234\355\"\331^i\032a\303\332!E\263\240\335\222\212\026\213\003\224\233\206y\237\004"
+	.string	"\035^*IO&\212\236\033\026}3o~4s\306\343u$|\3033\231\272C\336O(\322,\364\236c\250\370\225\215p\235\233\202\314\216F\307q\241\357U\254\3443.\365WcG\n\034?\007%\307t\374"
+	.ascii	"nC\307\211=\372\3510\r\024\223T\006\262B\256\254\253\2579\344"
+	.ascii	"\307u\236>\005\321\344m\322y*\277\326\247\027\212\321\361\272"
+	.ascii	"\245\3154\215\0046hc\364\354\275*\367_3\231\247\335\252\227\346"
+	.ascii	"R\216\201\004\333\312\251G\3466\220\353}\"\206R\r\354\313\320"
+	.ascii	"\356\022\304\007\312x\331\t\037\376%\240]61\257:\247\237\232"
+	.ascii	"-6\374\342\345+!\355\321\240\360\333Lhl+\314\277~#x\350\246\215"
+	.ascii	"\347Q\020\247\341E"
+	.string	"OB\377c\006\227\237*\363\031\226,\320 \200\260\372\177B\252HC\327\331m\016\205\302J0~\211U\231\035\344]X?\"R-\364\240\372O\221f\224\337^\316\363\224\320\243,\033\240Pd\034\t\"`\356g{\375,'Aq\037\374Cj+\226K\221\313^b\225\341\325\253\234\352@0\r\236\310\260\006\265\310:\016\324a\2245i\246\"gk\260s\352\032\022\331\332\236eB\3357\240\364\275J1\244\035\226yT\253\275\346\2174\320r\3404X\332-*\231\n\264'\033,\216\020sBh\267|~\3651\330\236\257\026ef\022:N\035u\002L\017\003u\315\342\331\317"
+	.string	"\026\003\325\266\253:\334\365=R\271f\232\315\225\214\207\234\212\234\305|\005\335\345HE\313\304i\211P\244\215\343^\271\277f\260\342\265\304\237\307\221*\211\356\336L\342\207E\017`\262\005\032\212$\006$O\243\316\325&\362\207\366\221\323\275\345\036MV\314\377\232&m\026\350"
+	.string	"_\265\242\314\240J|9_\007gl\3170\313\205\356K5\324\331V\001\024\347\310\204\016\234\357\312\330g\027\212t.~\244\201\341\024<d?\201y\325\006\333t4\205\300\004\364\006\013|{w\034;\220\263E1tt\257\020\362\214\355\003$\313\201\332\346\360CJvV\035\246\017\213\361\345\265\362 Fk\222%\t0\212(\223z\251\232g\300\310\200\256\227\326&\232"
+	.string	"\002/4\"\026E\254jL\2427\333\367[\370\002\020\206W8\223@\035:\213\215*\023\3032\304\334\340\225\264d\266\372\323\025\366\251\321\206\017+\210\212\013\351\207\220\317\006k\221i\227\365"
+	.string	"\274q\327\272\302\221M\221\271_<\"\200\303-n}K\354\212i\253\334\033\343\366\220\007\221e\240\325\263C\005\033\310\231]L\304\214\377E\373\"^\327\363[qH\026\327@\266\266Y\213\001N\031\331\373\023\264\344%\215\t\n.!)\355G\0371\241\200d&"
+	.string	"\376i\347\320L\nQ?<\231\320j\312ym\325|\323\006\331uMn\300Byo\031\007m\313\235_\025BC\023m\340K-=\021\362w\021j\025\rA\226\201\315\346\225b*E\360\314\370\002X\"\324\326N\007\024\260\272\003A\272H\245\"\344\272\224\256\256\205\340\267\306mY\244\343\301B\036\317\236\344\364~\263h\216\375\216\370\246`\005N\353\240;\252n\177\232\317\201\375\366\032\245m"
+	.string	"\312H\243\203\356\203\021\313jb\225\207\204&\001o\321\331D!\375\363\2409\177\246tm\271u\351\002\206Ws5h\373\272d\\}\216\257&\367@\337!v&:c&\364\021*\202Ry\244\0239\302\310P\211\347\233\342\377\024\311}J9\217Ry\247\bw\271\211\"\364L\020\277}\023\310\013\222\213\216\007\334N\377ZC\247\336\346\306\375dox\260JX\266E[\203 \360\320JTP\331c\261[\267\025<\256\270\307&7q%_4\341\373H\211c\313\257@\245e\024\031wJ\353\201\315%&\371\344\237\245\0303\271\255v\265\342\036L6\355\364jN\007}7\374%<<\230\373\3607\314\243\260]\262\336\360\222#\273\301\027\200\203\315El\271\306\r\317\371s8\371\254*b`\020\260\356\326\344\"\262\220"
+	.string	"O\327\226\266+]\337\261k1\371\363\017\031\272\266\"k\260\255\346\303L\313\305\211J\370\r~\232\037\324\362\352\374\346\246/f\340\217\346.hf\244\351K\005c"
+	.string	"\361\247\341\350B\310\364h\334\204\231g\201\200\001v\007V\242E\316Q\362\212l\\\264\332\320\352(i\261\253k\360\026\003^\336%\336\374\321\300L\f\254\016\224\205(\230<\006\t\310\207\244r\224\277Y\331%\211\361`\b\023\225\025\265\351$&\361(\023\274Up\313<t\225A\305\223\243\f\341\017\253rW\304\232P\307*&%\360\017z\321\356\356a\032x\362\301\017\007\033\001W\324\002\005\322jY`5\322\231*\034;7\275m\241p\301\257\311\"\200\350\375V\242\2774\223\240O\210\213\033>\3605\024\332\276\325\334\303d\t\b\346u\272\237x\327\253\334\340m\206\343@Z\207\017\fdi\322@\250\f\241\tD\202\350H\006\033\013_-ZC\\B\247\016\333f\363h\363\bb&\331\306\252Z"
+	.string	"\301\267\377|\t\377\205\235\033\0351\036I\356\036\300\267v)\351\007\251\335\221\346\363\017x\312{@D\256,P\330\033(\001\007\005\304\361|4\177{\003K\317\210]\r\330Px\345\353\330\250Y\203\213\013\331\363-$\215\244&\376\302'\256\372$!qk-4\246\307\332\212S\005\025X! \\\300@\200\236f\312\307\303\230\260\022\334r,\321$\200?\337\020h\262R\320\212\006j\303\2241\201w$\276\367\320T\275kM\177\032p\311\270e\220\340,"
+	.ascii	"\341\3302\3549@\"5\367iP\2467(\220\007J\300\375\373\254\2440"
+	.ascii	"<\324!\316\"\3655jnC\240 -\362\234\223\004\360,\215\214\332*"
+	.ascii	"\251\274\333}\314\360\251\305P\226`\232\301\357\361\315\0235"
+	.ascii	"\\\tk\375V,M\300\351~*\020\233\351\027\336\217\333\344Z8"
+	.string	"\350M\f\021\200\310\031F\f\352\320\254\216V\025\266\242T\220\272\\~\032\035\337U\270!\237\013\225\226\326\345o\315\231\232d\034\207\266;\310\221K\246\"\231\352\366\250\344\277QM\245\310\245)\201\256\363+\333JJ\021\030\"\364TNN_\257\b\225LrN\320\325\220\250h\247\245\2168W\316[\235\0251itFE\326\037m\t/\253\240O\247\023_\246\033o@J\206\350/;l\275\022\251'\216\020\374j+r\034\300kDSI\346\335\013\264\241\232B\250\303l\033&\340\363\232\322K\366\366*?\322\325FD\301\021\224g\303\225\305pp-H?\347\316\247\277\375\232\225f7\357&\203\377\025\312\271\342\357\313\030zp<2\216\223e- 9\275\363\360\265\035 \020$qxQ\357fG\325\215 \303E\321|\364\325\345d7\200F\324\357~B\254R\035\242\017QoU\2632BM\207&n\341\230|\227\247"
+	.string	"\303S1\214\373\202\374/#\225t\324\270\021\"\034:\322\361\237^\312\256\241\256\254\366\234\024\240\364|\223\371\270\030\212\2512\347\033 \201\325\365iYUa\302X\374\004\347.\034\277#:\266q"
+	.ascii	"SR~$4\365\002 .\340z\0342\217\303\251\310\332\355\270~Ud\376"
+	.ascii	"4\326\273$\276\322\362}\f\020[\360\201\020HoS>\027mOO\315\025"
+	.ascii	"\215+\026\374\3005N\026\353\317L\365\304\306sP\036\327\233;\215"
+	.ascii	"\201\313\250\202\336O\314\201g\3268\263o\344`\331\022\255\254"
+	.ascii	"C\315\216L\225\016\376\030\232I\303\004&\206\"1\213\264\237\261"
+	.ascii	"5.\245\344\356h\231\334\212/w\034\026\246\\\204\252%?P\324\331"
+	.ascii	"\030%a\272\\\241q\021\024\266\361\375YE\215@+\t\245A\255r\225"
+	.ascii	"\r0\337k{\221^\0338\342tB\254N\236\255Q\375\305\322&\177(\261"
+	.ascii	"\267\237\203\302\231\222\213\"j\231\275\235EY\001K\232V\324\334"
+	.ascii	"K\240\305\250@\255<\235\351`\340\202\025\227/\342\364\3054\354"
+	.ascii	"\2007?HNe\"@\004ANo\274$/}O\367\313\032Q\001 \373O\n:\264H\356"
+	.ascii	"w\354h*\357\254c\354\017\330Q\270Y\256d\335q@1\317\335\034]\023"
+	.ascii	"\204O\240\307\251#h\273$\003d\037\223H)\357\203\030\001XT\307"
+	.ascii	"oZ\220#\241\254\361\030\327\204\377\031\271\037"
+	.ascii	"\beo2F\213\256\315H\311\251\022LVDk\334~X\325\324!<\017e\236"
+	.ascii	"7\272z%\215\220\204\241J\017k\252\346\232|\301a\247\376\037\306"
+	.ascii	"u\205(v\271\221\364H\204\271\324g`t\003V>\332\247\336\202\243"
+	.ascii	"\036\267\232\"\321\372\344\245\342\355c\327\366\n#;\026\207\\"
+	.ascii	"4E\345\202u\221?\204\350J\275\205\016u\316\033\200eDT)\371\372"
+	.ascii	"9\330\260\363\022~\034Y\205\baf&\350\021\317\003N\241\345@\373"
+	.ascii	"m\304P\335\201\002Uf\306\245\260GK\032\026\240\212\351\030\250"
+	.ascii	"W\237\034Z~\370l\3064\232\203\366\267\2048\272\026\036\247\324"
+	.ascii	"\334\265\324\375\232\3654\273O\347\331\034\336\312\202$j\024"
+	.ascii	"|\371\220\024fSx\354\030\325`r\372\3065\273\217\346k@A ]YJ\342"
+	.ascii	"I\264\177\256q\327\005u\220\274\215/\204\361\n\361\317]\201P"
+	.ascii	"\030\036&\034\363$\316\275FM\366\231\247\024#q\272\321\354\314"
+	.ascii	"\332\f\017vA\267h}$\2275\3051T\240N\324\3228u\022.4\030v\335"
+	.ascii	"M\277\362f\231\033\206\177\353\362\334o\311\3201\334\265~\361"
+	.ascii	"\272\212\362\322\242\351\031#\037.a\004\347\304\222\235\243m"
+	.ascii	"\0201|[`i\267'2\270l\245\026\225\204iN\032\030i\356M\252\"\270"
+	.ascii	"\245\0271\027\25067O\365\341Q2\266\332\336@nghgH\tXGv\233\027"
+	.ascii	"\255\312\314\326\0173\r\232\314W\037`q\032\332\205X\257\265\322"
+	.ascii	"\223\236\217\273\263/!\253\177\333}\003]F\267\353\3576\001\243"
+	.ascii	"\360\371\350q\344\220?\306\371\001\331\213\304s\227\373\257\242"
+	.ascii	"\0338\034\373\317zi\276\216\007$\036~'\372\001\275n\374\373\260"
+	.ascii	"\223\233\343\267\232\264\274\320\272\342T]\327\3604\240\247\244"
+	.ascii	"X\007\240=\030\220S.8\351\217%O\374\214##\"fp;\202\365\f+\312"
+	.ascii	"\211G?\036\3733:S\367\347\350\376u\3315\254}\353\n\207?>j\324"
+	.ascii	"\377\261O\206\313\277\253\310|\327z\2618\220\030q\344\370\372"
+	.ascii	"\340\331\217\301-\276\\\3725\254\272\027\223\272\020\202\323"
+	.ascii	"\034\355\031\177\331\275gf\321\007\272\032\354 r:\307,o\207\275"
+	.ascii	"\214\206/b\3407\335\377/\3724\315M\305\231<\261ZvI\314\225\352"
+	.ascii	"\374\344\3578\333\214\37321\304\345\013\3609I\253\234zU\302\371"
+	.ascii	"\2464\206i\256\375I\216g\213\327\373\344a\030\266 \207'\251\354"
+	.ascii	"\237\374\037\346\317+bj\345,\376h\362k\341oPfjd!7\357\346s(\330"
+	.ascii	"\374q\374\222\270\245\263\\v\223\371O\202\235e\253'f\336%h\231"
+	.ascii	"\350\264\315\3417C\234\347\224\335\023c\237\005\331\350nZz\027"
+	.ascii	"\345"
+	.string	"2\340\270\235b\227\332v\242\fkE0T<\347\272\326\205\362F\212J\237m\326\227\341U_Zo5\261t\177\\\377M:\274\364\201\332\031L\351i\371\273\366\177\005\317\273q\277\024\302k\305\2559\376\3551\263\013\352yp;\210\222'\300\277Y\372\321\364F\376\314_s\034\250_\245\234\214\354\244\020\306Y\341\371\340\310\350\363d\206\2077\224\371\372\363\373\206\301\201 \237\233>2\342\311\24171\\:\263Gsa4\340\265a\376\273r\n\022\221\267\266\336\271\260\377\323\353\317{\274\034\350\212dc\355\3418l\232\b\345\016_\353N\374\036\354\327\036\264\274\026\355\202|y<d\364,~m\027\310\231'?\3173B\265[\267\275\301i\343OR\362\260V\177\214c\217\203V+\217\325\177\213\314|$\325\313\330\377\001\272\255\302\334i\201\355\334\200\301\337\325F=\227_\353J1\227\254\352\035Z\330\203\2250\313\211\362"
+	.ascii	"\367\216vq\005\354\304\343\262A\006\277H@\354}\260^\332\343\243"
+	.ascii	"\340\257\333\375\262![\017\247=\223\275?\265\322\026-\352'\254"
+	.ascii	"\247\3721\355"
+	.string	"r\236\227\236\217l\216\303^\3609a\265G\3779\036\235w\317\007w\307\370+n\356\207\375nx5\226\367\033[\363\330\345{\303\006\214\236\326\273t\231{\346\023X\241v\256\337\326\361\023\321^$\357\237\257\035g\322\347\203\235\265\336\343i\017,\366L\335\340\333!\251'M\333\r\362\205}\214\004.f\377\037\357\022,\357\201\374\265\326G}\300{\341\307i\371j\332\311\373\241o\216l\273\266\351v\036\376\355(\254F\301\366\021\234E\276\016\361}L\334O$\355#\365:\356u\204I\037\352q-o\034T>\022\223\363\362\006\244\200\021\314{\240\231\037!\350\227K\363\223\242\363\t\nK\234\363)\225\236\306\277g\237\276\234\351\335\306\203\003\262oJ\356E3%\340\261\220\366\230\255\331\353\214\263\217\341\351\273\343l\367\372?\312\223\341?\323?kx\336_\241\3571\202a\234\031X\3678\364\\\323\227\277\255\027\221\372\016"
+	.string	"/\236y-\254\337z0\267\331\005\177\233\n+\033 p\t0\337\351\212yq\247C\336\207\301\257\021\372\235\213=\2349\377\212?\020\267\345\201\367y\347\007\365\375\216\360\316\324n|=\316!\3035\277\262\272\331v\260\032~\356e\200\327\340\207i\357\272\316yc\361R2\027\025\332\370y\256\363\332\032\356\264"
+	.ascii	"\226\274\333\261#@\276\272s\275\352\236\2771\245\023\347!\266"
+	.ascii	";\366\306:O,\354\305\345]\210g}r\261\210\307\213%~\203bZ\241"
+	.ascii	"Vk\335n\333\332\253x\363]\005\247\232\377\022\034\351\3620\364"
+	.ascii	"\242<\344\235i}w\325Ml-\372\331\367\"\342+\0333-\325\347\345"
+	.ascii	"\001\305?X\232\324\234\361\247e\1775\357\265?\377\305\016H\277"
+	.ascii	"\361Q=\337\325\351\230\271Nw\262T\317\tF\235_~+\207iz\362/\330"
+	.ascii	"\230W\263?\265p\031\275\3164|\372N]\277O\363\255\227|\332!\370"
+	.ascii	"\222\r{\247\b\372p\034\214\257\274^Q\354\350!\351\037"
+	.text
+	.section	.gnu.lto_.symtab.1b3f415c60458c90,"e",@progbits
+	.string	"pidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"throttleLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"thrustLinearizationReciprocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"thrustLinearizationB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\004"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"pidGetSpikeLimitInverse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\004"
+	.string	""
+	.string	"pidGetFfBoostFactor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"pidInitSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"pidUpdateSetpointDerivativeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"pidResetIterm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\004"
+	.string	""
+	.string	"pidUpdateAntiGravityThrottleFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\004"
+	.string	""
+	.string	"throttleBoost"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"thrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"pidAcroTrainerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"pidCompensateThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"pidApplyThrustLinearization"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"acroTrainerSign"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"applyRcSmoothingDerivativeFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"pidUpdateAirmodeLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"pidGetAirmodeThrottleOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"crashRecoveryModeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\004"
+	.string	""
+	.string	"pidSetAcroTrainerState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\004"
+	.string	""
+	.string	"pidSetAntiGravityState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"pidAntiGravityEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\004"
+	.string	""
+	.string	"dynLpfDTermUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"pidSetItermReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"pidGetPreviousSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\004"
+	.string	""
+	.string	"pidGetDT"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\004"
+	.string	""
+	.string	"pidGetPidFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\004"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"pidProfiles_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\004"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\004"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\004"
+	.string	""
+	.string	"pidConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\004"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\003"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\005"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\005"
+	.string	""
+	.string	"isAirmodeActivated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\005"
+	.string	""
+	.string	"fapplyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\005"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\005"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\005"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\005"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\005"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\005"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\005"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\005"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\005"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\005"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\005"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\005"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\005"
+	.string	""
+	.string	"interpolatedSpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\005"
+	.string	""
+	.string	"applyFfLimit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\005"
+	.string	""
+	.string	"shouldApplyFfLimits"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\005"
+	.string	""
+	.string	"interpolatedSpApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\005"
+	.string	""
+	.string	"getRcFrameNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\005"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\005"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\005"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1b3f415c60458c90,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,750 @@
+	.file	"position.c"
+	.section	.gnu.lto_.profile.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.23007e186b806100,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"U\005"
+	.string	"$\007\005\001"
+	.string	"\021"
+	.string	"\201\277\312\340\b\n\002"
+	.string	"\001\002\002\002\003\001\352\263\360\321\b\003\240\342\234\212\n\004\247\247\347\370\f<\002\004\005\002\005\002"
+	.string	"\002\006\002\007\002\007\002\001\002\006\b\002\b"
+	.string	"\005\002\t\005\002\007\002\n\n\005\n\013\f\r\016\017\022\350\300\306\254\005\002\023\354\206\342\366\006\002\024\347\273\234\355\f\002\025\355\314\246\334\007\026\332\322\311\233\n\027\240\342\234\212\n"
+	.string	"\030"
+	.ascii	"P\204\271#\f\300\204\201\273\235\306@O\004\334\201\306R\"\034"
+	.ascii	"\3460*\033v\206\002\213\253\030x\021\003\362\345(^\001(\241\206"
+	.ascii	"\231\267\006\371\202\361r\271\027`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 EU\001"
+	.string	"\3009"
+	.string	"\005"
+	.string	"\002"
+	.string	"\001\003\002\001\001"
+	.string	""
+	.string	"\004\022"
+	.string	"\003\023"
+	.string	"\003\024"
+	.string	"\003"
+	.string	"\007"
+	.string	"-\031"
+	.string	"\001\226\0331{\270,\f0\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.23007e186b806100,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"U\004"
+	.string	"\002\007\027\"\220)\351\271mU\025\362\236\236}U8\371\005\330\215\031\245\351\330]|\235\t\360\370X\342\267\275\345N\001\037\f?\277\036\273\013\037\250\037\245\007%R\231\224\205o\rj \233\313\231\017\245\372\007\366\243\304\237p\367\202s>l[\3003\f\323Va\277\200U\2659(i\233x\347B\004\021"
+	.string	""
+	.ascii	")\034%\tf\034p\214J\304\204\351I\300\213\364\303.\256\"C \270"
+	.ascii	"@\002\007\250K\n\027{\223CW\346\344\322\264\006\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \324\225\003"
+	.string	"R\305\021\034\240'\351\377\243\330w\277\212Wu%\026<\252\252*\226\357?\024\366;M\310nR\246?\341\007/\250\372\224X(-\272\273;P3\3102\346,\016\b\256(\345\177'\204\206\322\215u\314:\370uj\200\032\";9\021\021"
+	.string	"@\004\334{3Hx\307p\266"
+	.ascii	"t^Q8\357e\023T\261\201v@\230T\321R\202X\024\303\233&\234\331"
+	.ascii	"\034\f\260"
+	.text
+	.section	.gnu.lto_.pureconst.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\004\230\004\022\204\004\023\204\004\024\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \250\265\002"
+	.string	"\342D\f\023\300%\303\030\377\377\377\377\356\222\275w\263C\270\033\2212\005_\203N\363\260:\323\2632SSdJ&\326\001\267\312\264\254\004\323\300jL\307\204\342 \016"
+	.ascii	"_\221\240\304\341BtE\207\022\214\0136\024\005\253\002\2712\326"
+	.ascii	"\242\312\326$\340\2365@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.23007e186b806100,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_positionConfig_Registry.39.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \240\255\004"
+	.string	"t\bi"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\266\377\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\007us\336\006uq"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\270 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/position.c"
+	.string	"\004"
+	.string	")\242\302\254\b\242.\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_pgResetTemplate_positionConfig.41.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_calculateEstimatedVario.44.23007e186b806100,"e",@progbits
+	.string	"(\265/\375`\320\003-\033"
+	.string	"\2663\261J\260\226Q:\264\343\234_'.\rH\f\\\r}\373\006\251-\311#\332GJ\273\035\273\2751X\204\2022k}bP\323"
+	.string	"[\"\330^\262x\003\206\377\007\375\256?\304\353d\376\261"
+	.string	"?\365\026##\0077\263m\023\022+wJ\001\231"
+	.string	"\215"
+	.string	"\237"
+	.string	"\037\2478Y\366\243\234\250^<\307\241\354\2279\034\207\227\211\216\027\007\373uq\332D\376\215\013\375\n\352p|!\230\032<\351\350n\004\025&\241\270\252\265\016\270\350\004tmt`\301\252/\t\304\216Z\237\n\330"
+	.ascii	"\275\3509\355\323x\r\242\003un\325\232\002\310\216Zk\001\023"
+	.ascii	"\240\027qX\266}\031\237A\344\242\td1bL\372\031\335\210Rk\235"
+	.ascii	"\301>3^\234\217\031/\356\212\027}\026\371\027~\307\211\252\227"
+	.ascii	"\004\352h\367I.\250\265z\376\216H\334{\333\001l_\260Y\b\002/"
+	.ascii	"\233zs\350\271\273,*\345\3257\266s_2\365.\365)\235\277\344!\333"
+	.ascii	"\374\3176^\374\222\273(\030H\2749\264\201\275\271*\354\263\352"
+	.ascii	"*\331\236\326\311\371\323}c\363\340-\273\215\277\346\300?\346"
+	.ascii	"\232\246!\247g\350\264\f\235\216\241\3230t\372\205\234\206\221"
+	.ascii	"\323.\344t\013\235f\241\323+t\372E\247]t\272EN\323\3264I\247"
+	.ascii	"G:-\322i\026\235^rz\222\323\337\241J\21289\202\024\363Q\253\210"
+	.ascii	"\341\224Z%\366h\361\247?\030\033\263\352\201(QUm\005\303\341"
+	.ascii	"\222\327\256\270\266\265\257}\331$\344C<\245\301R\226\032/\272"
+	.ascii	"\266\205D\267\265\247R^\221K\367FUl\t\0172\201\326\352;\340\377"
+	.ascii	"8\020\n\376\322EW\240\321\306\213\344\276\234\246`\320h\231\256"
+	.ascii	"\353\306\231\265k\031\346\1776{\341\351\024\027@)W\037v\347\234"
+	.ascii	"\022lg\326\263\204\362\022rS\215\262\205\355\241\316\212\261"
+	.ascii	"\004t\261\"\370$\266=\304\243()&\306\225\355\255J\"\342\262v"
+	.ascii	"\334\227AjV\334\021Iy\305\233\372\023\022\265V\013\360\325\312"
+	.ascii	"\333\331em\366\341\031\362\311\321n3 \334\355\206\353\221\375"
+	.ascii	"\324 \004\335r\025~"
+	.string	"j\033\310\332\315\346\340\202\230\373a\200\023\242Y \335\303\003\204\263\345lC\270\240Y\316'\203\355\007\303\f\310F\273\315z\204\206f<6\306\005\325\204f9\034Nh\366\002\362\276J:\213\303\333\236]Vg\205\036jmY\227\017\2079\333\262\217\022\257\033or\326%\310\243\212fo\366VFUh\246\314\332\017\"\214\377\321,\200`\215*\337\356,\263F\256\343\327$fWVf\311!\345\t\230e\331\230\215Y\275\254\247^\353\204\331\032\253\222\251\327\332\227\225Q)\233l\226%D\2501$\344\214b\n\252\231HDFZ\230tp\242\251+\262\003\021\020*\2532\311\260\277\001_\344\2004%\306\264$\351\317\262\261B\274\n\342\202\251\231d\226.[4\327'\314\302U5\326p*\376P\343\3134\2578,\004\266\244\303r\022`\245\220\212\301\317[x\226\237\036n\327u\252A\3209\n\320\362\002&\227\340{"
+	.ascii	"\352\025\3278@.h\277\300\362H^/d\373\342\261\303\330\215\352"
+	.ascii	"%\320\212\2615\355\316\341\325\2437\216cb\265\200G\034,\317\227"
+	.ascii	"y\001\330\277[#\211\276@\223\006"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.46.23007e186b806100,"e",@progbits
+	.string	"(\265/\375`l\017\275J"
+	.string	"*|\274\033A@\244N\007\027\251\336\202h\305\b\224/\273\025\231\034D\240~\243a\004!K-\227\315\306\r~\255\357\\\330\273C\325\351\327\323\314\250]\244\017"
+	.string	"\226\364\177f"
+	.string	"\242L5\253\203\232\210\220\335-\311\224\002\260\001\206\001\253\001~\314\306\334\346d\267w{\230n\245\273\026\327\363=\367\342`\374\317\343V\002\2728\242\261\035\301@\363\020\337\267\372\302\357\017\n\213\343\027\030O5\242Wm\n\b\345}_\024\336\305\371\\\357\213q|\303\034\341i \342\373\276\036\216\316\022e.\035?\325\252/\223-\2704v\027\266D\301\r\332]\221p<\240\300\365\252\214'Z\365\315q"
+	.ascii	"\256\216]\240\367\255\016p\266\031\034=w\273\235\337\271\216"
+	.ascii	"7\243\221\357kDM\230\367\255\026h\002Gg\237\236\324:[\364\243"
+	.ascii	"\326\331v\273\361xu\356u\275:x/\320\373\276Z/\347\256c]YUQM="
+	.ascii	"\245\242\234PONMLKJIHGFEDM\346\320R\231D\036\215-[\374\354\266"
+	.ascii	"\2439\026\240_\001\376e+?\257\362\003\223\251"
+	.string	"\276\370\324\027/\371\331\347R}y9\312\211\007UD@#\320\233\023\262\331\025\227\211p\034\247c\273\313OxY\262\023{\027\245\t\013S1+\216\r\017'd\273RLz3=t:\266\272\274\204\345IV\"[R\305\363$\247ck\222\221\2340\311GFJr\321\222$\231\350E\222A;\253\021\035K\27497$3\347\342\362\220\261\313\210\0168_\276\271\362MHN\322\261\005\311HB68 \3718eD\207\233\033\223m<\274U\266\301\305\347\373\276\036{\306\321\266\226YOs\363b1\013Q\314\037f\233Z1)\207\223\250\262\215F\376\242\324\221!Vf\033\264\370\\3\b{\354Stl\2009\033\273\336\367\355\034m\323\341\r\300\273\363]w\313\350\036\n\020\255\263\355\203\310Q\307\t\261]\343 \237\332\314\351!\034\033\335e\264\355\224\r\034\027=\320\005\274T\t\307\020\216\215\r\3368\375\203\343\342"
+	.ascii	"\267z)\373d\337D\036\221\2433w\203M\310\036m\360K|h\214N\271"
+	.ascii	"\273\202\205\354\321f\362\221\021@\005|\333\247\006\372\177\331"
+	.ascii	"R\356\306\240!{\364\277\t\213\031\204>Z\217\001\363\206\306>"
+	.ascii	"\325=\314\240(|\305\247\266\2146?\t=;H\271\350\035\332\356\017"
+	.ascii	"!\262G\363\233\310\202hET{\264F\360gX-r\254o\236X\344\312\367"
+	.ascii	"O\325\223s\027m\202g\3021\325\023T\313\211\355\217\340\023|\226"
+	.ascii	"\263\006\005\352c\234\314\214v&m&\"{\324\331v\021\255\263\376"
+	.ascii	"jn\f\212\273sK\313\327\356*4?\265\333\377z\275^\373\217t\203"
+	.ascii	"}1s{u=p\320 \231\233+\231{\313\001\275\0238\236;\002\257zg\371"
+	.ascii	"\026o\001\001\234K\2377\226\177\361\276r?o\253f\356\252fn\252"
+	.ascii	"f\356\251f\356\3472\267\0243wT2\267\263\231\033*\231\373)\231"
+	.ascii	"\333\251\231\273i\231\233\211\231{\211\231[\211\231;\211\231"
+	.ascii	"\033\211\231\373\210\231\333(\231\273(\347&Z\346n.s3s\356\241"
+	.ascii	"\234{\231\314\255\034\312\235\034\312\215\\\346>*s\033\223\271"
+	.ascii	"\333\234\233"
+	.string	"\315\271?\347\316\310\334\236\341\303` =Oh\3367\307u\320;\310\216y\342U\367-\356\\\334\373\334\277\270\373\271\003\006\\I\360\220\210\262^\300\023=\007%t`\267\346_=X\215\346\377\2262\314\267\372\257\367A\031f\276\263\007\221\270\273\243@\032\361\225>\006\376<\361c4\364\021\354@\207\236@\241\340\241\033\303\242\247\266U\256\b\0378\205j91K`\336\031\242\247\272\361vkF3\322\001^\351su\2051\346NY\302?\253\325\267\017rB0Z\270\323i\353,\273\347\257\316-\255\271\374\214\304\255\236(\203\352\312\311\265\316.\237\002\2178\314\247v;\025\ft%\364\n\307Kw\343\355T\020\216\221\036\350Y/m\341\254\341\343\311\275\033p\274\364z\025Y\360\220\316\307\003\274\3248\r\204\343\243\003r\245\036!8^>\370\006>\220\3551Z\254\227\036\007x\022*\b\216\227\016\3368\005\204c\344"
+	.ascii	"\277zi\034\347:\022\272;[\345s\371q\363\222DP~\366\013\034"
+	.string	"zj+\367\242p\254\354\372\202\263\006\216\223\035;\020\2779\017\256\327Bj\322\356\216}\216\024 \325\"\200\367z\017\343`\210sy\326\372@\227\311\357\372\354\007.\204\374\026\343}\315T{\337\264\252\344\373\232\232\343#\377\375\254!\032\377\370\3766\207\006.\244t\233\264\306/[\342y\334&G<\306\037\300\343H\334\035^\232\241\037\306p\237\270Q\334(\255\263\017\236}S\310*\305\013aDu\273T\274\216k\005j\356}\337\2559N\307\255kg\342l\273Y\334;\367\256u\326\301\263h\204\254x\016\372\362\366$\235\355\326{\354\310?\331\235m\373[\337\031v{\343\204n\236W\204\b\001a+\3042\230`I\030Q\264&\302\302\3100\234\225\205m0#C\261<3sQ\226\301\214\f\305\361L\205\327X\331\b\b\3123\025^fd`a/F\244H\232i\b[!\226\341\214EXY\231\213\022C]\302"
+	.ascii	"\2131\26131\26312\255\263\024(\304T\234\320b!6b\205V\21123-\003"
+	.ascii	"\316\036#\013+\323:\033\033+\323RV\323\274\370v\245=\264\210"
+	.ascii	"Ue \327]\251R\365[\205nW|\254\250\236.O\221\322fZ\252*C\252\251"
+	.ascii	"\002\031\312\223\251\2519w~"
+	.string	"\223\017:z\205j9\361\371\374\356&\220\233\304\320\252\363\276\357\202\316K2\023\027\256\341J\245\255\324?\277\275\003\027\212z\2517\356\255\265\211\003|\3243\371Y\243\203\232\221\362u\221zj3\335\315k\235\177B\257\360M\226s\363nDp>\273\345\260\256/\n\212\n\365Ni\217/#q\352\334\004\020\016\352\343|\372\345\034\275B.*l\370@\371\323\373\236!qO\237 \311\336\235\241\223'\251\036\327\250\2403k\234\260\336\214im\254niA\214c\004\255]^5\207M8\334\351\227xz\315%QP\036\246\354\364\216\347\207\017\247\327*\254\203\347\006g)\353\245z\030*5}\273a\346\021#\207\033\345\367\270r\202\377\372nw\207\333#{\264\351\235Q=\2034\036\255\231\276\r\306\017\217\356Yz\246\377;km\224\376\350\227\276\375[\213Kz\244W\242\203v\354oNz\246\2755(_\217\364F\301"
+	.string	"o\364G\357kt`o\364\376\246$O\222\220\266\350\263\023= \371\206+\344\370\276j[\235\245\331\206\0137\304-R\244u\266\350\003\2015\250\221,$\2213C3\"\"\222$)\244\003a\005\204(F\2354\017\022\200\304-\tt\316\r\021\245\375\337(\031\263\272\224\260\2402\333~\253\342\253\002C\302\317\f@1\235h*\027E\035\003\002\341\343\210!<\017\002\322]\007\327\354\207\f\207nw!\004\305T@\032\253\035\241\350\210\323w\307\230\216\001\2630\207\033v\314\255\263\013x\224e\323\352\034_\0329T\024\350\374!\214_\332"
+	.string	"r0\240D\265%\220Acl\262\300@\334\251\203y\330\243zv\035_++-p\337\307z\257\370Jd\230+\245/0\341\356\272\304\246g\231\367\340$0\206l\240\303\227b\275"
+	.ascii	"\247\354rO\275\036N\373 \202\316\355\211\t\215lM1!\315\037\306"
+	.ascii	"8\375EH\234"
+	.string	";[H\310\013\267\b\204Y\301\036\345\025'$&\322\330\261y\377\207N\267)\216\020\261\301w\256G^\237\217\353\373.\345\3513\256x\003\213e\023\023Q\2533\321jC\300\222\375\277\213I\325tgi\303\360\307\320\251\"1;\276\312%\200[\257t\250B\215\270\242\363\257\0132f\002\372v\355>"
+	.string	"\337g\"\376DG\340\350\260kX\334\002\273}\255\036N\362\245\352>\tnP\375;F\031\017\223\363\261\345>\3570\306\337\323$,\3600v6\261}\373\332\026\2066\020k6$\r\226\262K\022\347\245\2706\005\247\033\b^\202N\331\272d{\t\337+\333\272\317\377\353A\244:X\347iA\324%<>K'V\232a|\325\210\237y\304\na\003\234\260\035\321\n\207\324\360<)O\217\333\340\247\366@Jp<m*\2152\230w\021\220.\256n0\220\232\243Y.\257&v5\304Y\336\360Q\212\257\217\372\210M\346\266\200\336\t\013\323\002\271\354\244\206Wf\270T\361\034\265\203\024\007-\343\341\354!|\033\022\206x,\254\t\274\320'\267\013\004w\374\214\234\332\207\253\245"
+	.ascii	"N\242QT\331\213\267S\217\357\315\317zef|\006\326?q\2429%\203"
+	.ascii	"\002\357\300\002\022\325@\353P\266M\200\365%\020F\273\361m\312"
+	.ascii	"\346\033\002e\007F\334\036?\251\353\214\233\367=\330\375|D\210"
+	.ascii	"\356H\371\303\263\263{\031'\254i\365\207\004\250vY\244\322kk"
+	.ascii	"\211\204'/\035\266\360\251\001"
+	.text
+	.section	.gnu.lto_isAltitudeOffset.47.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \350m\006"
+	.string	"b\214-3Pm\222\016$\243\210\n\304\034b\366\005\030\200\b2\302\323Z\376-l\351\377\273\035\346\332\236\306y6\213\343ff\212D\334\0337\027@\341\332\250\355\223-S[\250\313\253\256*\3630\356rh\250\036\030\334\245R\200p\026+\343\250\201\037f\301r\327{\226\233\262l\013a#\3504\211\257G?\260\233q\204\006\353\251t5"
+	.string	"\225\260\tXtp\364\031\007\233\350[\311\314\274\205~\034\3334bB\205d~F)Y\"\211l\374\233\237>@\330\2145\303\370Tt2\001\202\222\231\271vQ\254\210\335v\264\302\241A\342\001q\212\001\t\2319z@\025\275\365/\370\r~\212\007"
+	.ascii	"2\001\0238#&\016\345\256!K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_getEstimatedAltitudeCm.48.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\002M/3`m\322\001@\337\rpB\023\342\362\327V"
+	.string	"E\254\177{\236SV\210fQ\357\360H\n\275.\005\217\026"
+	.string	"\200\"\320\225\005\"\327\212\225\207v\357-eJ\001\256D\226(Q\022&^ \265\240 1$@\213t\320"
+	.string	"+\023\006F\003\216\027\204\tR1N\020\302\366\332I\245p\364\301>\307\261\312\277\260C&o\335\371\231w\227\n0\301\311\314\3066\251\036\373m\265c;\235\n\215\204D\331nDV\262 \356\343c[cC~\30654\256\032fq=\217\bD\007\311\356B\312\005\336]{\300\273\323\212W\317\312\377\306\033\306\307\303\2726\317\211\301\356:\255K\342\326\333&\260]`\233\"\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedVario.49.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\002M/3`m\322\001P\030\007nA\303(\376\323\361b\375\245b\207{\031\270\340\233E\275\303#)\364\272\024<Z"
+	.string	""
+	.string	"\212@Wo\305\346\244\224\232\325\366&R\246\024\276X0o\252&\315\313h\345\3200=0(fR\200\320\013\245QK\201_f\201\322\352=J+\330>A\230\006\236\224\260\037r\314\3629\034\261\301_o\376\306\275a\002`x0\263\261\016f\310\276\264\t\262\215\306\f\270(Q\223]\212l\264$mDd\233cW|\217\177pl!\266Q\341B\243\t\221\223\335U\201\023\2707\374\200{K\215[G\313?\310\245\016Qv}:GJ\302\356\032\257\217\305\235\267}`\033\301vF\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.23007e186b806100,"e",@progbits
+	.string	"(\265/\375`D\001\305\t"
+	.string	"T\016@\002"
+	.string	""
+	.string	""
+	.string	"\002,\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\0052\026\200\204\001"
+	.string	""
+	.string	"\003\0056\027 "
+	.string	""
+	.string	""
+	.string	"\0054\030\002.\177\031\377\377\377\377\0037\032<\033=\034>\035?\036-\037\005\300"
+	.string	" \301"
+	.string	"!$\"\201"
+	.string	"\005*#\200\003\005+$\302"
+	.string	"%\303"
+	.string	"&\002/\177'\0020\177(1\177)\005)*\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005'+gistry"
+	.string	""
+	.string	"\005%,\0013\177-\037"
+	.string	""
+	.string	"\200\200\200\0015\177.8\177/;\1770:\17719\1772\003"
+	.string	"\030\344\006\003"
+	.string	"\031\204\016\304\016\003\004\032\307\377\241\372\001\001\244\001\003\004\035\201\234\313\322"
+	.string	"\001\344\001\003\004\034\200\316\245)\001\244\006\003\004\033\304\006\007\003\004"
+	.string	"\202\037\003\004"
+	.string	"\364\374\342)\001\242f"
+	.ascii	"$ \260\0021\243\355xAZ\026\267k/\327\330\035\032\341aX\217\340"
+	.ascii	"\030\034\201\303\r\004gK\021\2660\016K@\201\204:|y\033\244\335"
+	.ascii	"\302\227s&\262eCA\fIf\232\333A\036\315L\222\007\377\260\324\360"
+	.ascii	"N\360\2131\303ttN'\264\001\303\003"
+	.text
+	.section	.gnu.lto_.refs.23007e186b806100,"e",@progbits
+	.string	"(\265/\375 \272e\004"
+	.ascii	"\342\n (\200K2\214\001\310\016\016\006\3030\230\201\031\230\201"
+	.ascii	"\031`\313\301\021\241\033/A\215\261\265\266\270\t!\335\261\265"
+	.ascii	"F\b\3312\005\005\322%Ai\200\271\325\262\213Vv*ewL6\307\372\206"
+	.ascii	"F\306dc\004\374\302\"\332\025\320)\326\236\2106\002\032b\355"
+	.ascii	"C\264\016\320\r\317\f\222\027\324*\250\023\324\"<{ Y\003u\001"
+	.ascii	"\300\026\310\225\310\024\310\353q\343\354\234\r\301\013\263\213"
+	.ascii	"\371IG\266\333\316%\002\003\004\001@\240\270.\363\f"
+	.text
+	.section	.gnu.lto_.decls.23007e186b806100,"e",@progbits
+	.string	"(\265/\375`\213\035\275\221"
+	.string	"\n\363\2145P TBJ\007-\341t\b"
+	.ascii	"@\217\376\224DX\303\211R\321\026^\273\274\211\211\233\270\tz"
+	.ascii	"\356\026\246\222\253/pT\337j\002`\302\321\032\352\373\240\325"
+	.ascii	"\304M\371\356a\340Q\255\341\325+\201'\276^j\250\247\317\2476"
+	.ascii	"e\301a\201\243\331F\266\224)\313\002P\003l\003f\326y\226\356"
+	.ascii	"x\222\311\371X\331\275e\371Ay\310Ru\216!nRF\246\326\350m\217"
+	.ascii	"\224\251\225\335\304\317^\362\335\331\b\026;\312Ipu\365\r\272"
+	.ascii	"K\253\256,\036\323KF\202\355~\226\316+\345\263\272\"\304L\335"
+	.ascii	"\275\267'L\327\\\221\024}\313I\337C\244\357\266\224\353\260\035"
+	.ascii	"~^\215\357\234\353x\314y\226\316\013v\357\005\342&c\224M\032"
+	.ascii	"}\253\2458\370\356\356\356\356\370j\2757Z\212zI{:,}o\245o \322"
+	.ascii	"\367\222\364\335L\203\370\204\034\003\200\234=@%\211C\344\203"
+	.ascii	"\004\\\223\225F\177\206\303q&\346\312L)\307\312\326\310\2251"
+	.ascii	"\303ikc\310\260\251\211i#[3\223\206\325\360\033F\303D0\033n\303"
+	.ascii	"nx\r\017\301p\374\3448v;\237\341\267\267\363\336\345\275\367"
+	.ascii	"1\332\310\240\201\34147\261-\034\366c\3575\302&+\213\026\016"
+	.ascii	"\3437*\f\270\332p\027\307\361\031\233\361\033\223\r\272\316\310"
+	.ascii	"\335\353\374\004\277\321/\301\004\034\307l\234\246\242\351^#"
+	.ascii	"E\004H\002\026U\246\356^g\213\241\026\275*\2674F\f\241\227c\024"
+	.ascii	"\275\037F\223\236\325\322sXz\266\222\236\231\244CB\322\025\314"
+	.ascii	"#%\n\343\223\304V\022v\032=+\323\033S\0305\244\334\205\275\360"
+	.ascii	"\223\005\1779sa\262\363\230\234\327\331N\354\270<\033=\f\351"
+	.ascii	"\231E\317\336\3351\213\336KH\203\030E\257\3174H\377\306(z\354"
+	.ascii	"d/~\032\300`\227`\202[\345\327"
+	.string	"\355\272\327\t\204\366\320\246\004J\243\237\221\016Pu'xPz6\240\307wl@\357\235~\r\243\350\375\214\345\347+\334\305\302:=5\357\330\275N\241t\031\246\254\253\321;\031E/\345\023\27555\364o\263\030og~\216\241\304\377/n?\363\317@?\363~&\241\355\177\030\346\317C\266\237\267\254\375\214d\346\347\2572?\223\371?\244\202\212\377,>x\006\1777\375<F\314\1777j?k\245\375\034\346\277\f\377\035x\013`>\300\337\303\237\t\370\371\376\357\337\332\237\227\374\354\344g\254\237\231\374\234\344\347\253\237\233\374\374\244\313\317R?[\375\\U\366?\350\267d?\217\375\034\366\363\363g-?S\3719\353g(?+\177V\372\331\206\237\205?\037\375l\343\347\032~\236\341g\031~\206\341\347\026~^\341\347\024~>\341\347\022~\016\341\347\017~\346\340\347\f~\266\340g\n~\226\361\263\002?'\360s"
+	.string	"\377Q\3709\202\237!\370\271\305\317\017\374\277\3633\213\237\027\370\271\200\237\005\370Y\350\347\240\377q\376\303\371\177\302\3777\377\273\376\327\370\037\343\377\332\377\364\356\356\356\356o2\177\317\376(\232\001\226\315\225\003\306\n\220\021B\024q\342\345\345\331^\272J\005\276N=r\370\220\333qe6\205\305\345\374l.]\206~]\345O\030\226\0203<<\340\236xi\224\254\263"
+	.ascii	"\321\321\243J\337\223\332\362\354-\2346\324T\316\255\320r&\007"
+	.ascii	"L\335\275d\\\360\314\236B\244\300\245\357/n\260\257\016k,\253"
+	.ascii	"+r\227\351tq\336\230\364<\261\364\334X=-Z\332+\275\367\016Ua"
+	.ascii	"\3660sD\201\342|{=\316O\227\232\034\022X?5\254:'\351\233\213"
+	.ascii	"\273\013\313\315\320;vs|\021I\311\202K\253\343-I\317C\222\336"
+	.ascii	"l\001n;\202\007\233\255\363\263\267\372I\177]\345\ng\212Yw/\225"
+	.ascii	"\213\036\256*H\242\032=\257Gz\027\334BP\351*l\227*\231iY\323"
+	.ascii	"\223\334e^\027G\223H\217\312\245\357(\235\365\226\362\267\224"
+	.ascii	"\326b\252\253\234\303\200\224&\\Z\335\245\242\"\352\347\323\223"
+	.ascii	"\326\224\267VU\217\n\032\222,\251k\264\203`;\337\021na\2164z"
+	.ascii	"\272v\362\237\247\347\026u\247\016W\372\336eb\336{\247x\316\313"
+	.ascii	"l\3529\363\230\211~\037\266\254\300\265\253\363*\305\324\320"
+	.ascii	"I\247\2301\r\371\212{\336\333\275\313*\345\006UR\313*!N`UW\271"
+	.ascii	"\204\242\024b\336*\245\023\330\275Bw\271Tz"
+	.string	"\320\274BN`W\352\346@#\305\327Y\245\274\313\346\025\272\313\313\264\302iY%\345\004\306$%\344\004V%u\301\252n\320]21y,/S\350\202U\315\271`M\251 '\260\246\224\023X\025\025o9\245\001\"\025\246\306\252\007\2439-\257\017(\"L\314\2407'g\363\256\271\227\307t\\\246\002\367\022i2\3270\t\341\263\2467\037M]\230\232\234\002\252\311\252y\227oNZ\315{\265\232\222.\224\f\245\363\3556\3417e\022\"\367I\307\275\004@\335\253\344\373v\357U\336{}L\"\316{\177\br\312\202\202\272\227j\b\352\022Q\242\351\270\267\307\332\234I9\201Y5\215\320\304\300\262\356\016\247\222\263\356\232*f\n\246\364\272OE\244YR?\346\032u:M\234\031\341\002\244\321\006\242G\355M\230[\243G\233\322%<pE\024\031k\264\311\355a\352\341\313\020u\322V\322W\374$\352%N\260"
+	.ascii	"\250\252\370\230\223\236\211z@DI\254nPQei\364m\325U\334\274\003"
+	.ascii	"\374\374\b\263\362C\243}\244\233\374L\321H\346\2304I\261Iu\270"
+	.ascii	"\227S\364\370\356\216S\364\272\210\321\333\310\211\036\223\312"
+	.ascii	"y\3070p\222\204\253Q\333D~\350\221A\202\253\356\207\246\342\264"
+	.ascii	"\037\245\363F]\300eD\210\272!\374\354\037\332\007v\336\333b\310"
+	.ascii	"\307\355\f\212\034\212\336r\245\267YB\202\\\021c5\326h\007\351"
+	.ascii	"\006\322=\274\203\364\217\236e\007A\357ebN\340\2079\001\236\332"
+	.ascii	"\023\246g\017\275\305J\377\236J\341\253\202v\344\252\245\032"
+	.ascii	"\312W\307\212[\224F\037\243\241\370\210\326a\275\230$\244\031"
+	.ascii	"\223+\242L\214\216\313S\363\320Q\335\243}4\223\237\r\325;\336"
+	.ascii	"N\315\343hC\361\034N\263\316,\337\026+/r,7\307f?LAw\331\324%"
+	.ascii	"\353\255\241\230\016\007cC\351\305\362\214\222\313\201\365\274"
+	.ascii	"\262c<4ZP\310\300\302\302\272M\317\312\307\0243]v\021\323\204"
+	.ascii	"\342\345e\237\374u\243\002@k\312\001c\271x\300\035\261_\267\317"
+	.ascii	" taoYL\\U\271\305R\305ja:v^\252\246r\256\201#e\252\260\325]'"
+	.ascii	"\"D\302\253#lYn\265\260\365\356\302\316\252\314\230\312\227-"
+	.ascii	"\262F\355\225\333\2568\"\326\276\342\244v\353\226k\310\0177Z"
+	.ascii	"l\254\374<=L\330\334\346\322\244/\301\226>\b\033\204\2452\324"
+	.ascii	"T\316a`k\b!\246\210J\214\001\342L\226\325\272\245\322K*Rp\032"
+	.ascii	"\265SzQ\31699\266c\243\205d\307\224\254\337f\365\032\007\335"
+	.ascii	"\2464ug\234\3455\345\314\021\333t\373\304O\333d\241X'\252\373"
+	.ascii	"\243\005\234\263\036,f\260\2644\372\304\271\3641\305\301\225"
+	.ascii	"i\364%\246\322s\027\323Ney\363\303\215\020\353\203\020g\200X"
+	.ascii	"\251\25666\352\312\016\261V\374F\025t\227_\352\344\310\354\225"
+	.ascii	"\355\201\323\3260\261@X'\266\211Ub\227X,~\332+\373\303-\224\365"
+	.ascii	"\361!{e\203\260\001\242se\213\220 \224y8*\232\234D\310\022\247"
+	.ascii	"\312&\341\247\265\372\220\323\312\022\261HT49]4l\210"
+	.ascii	"(w\310\244h\3413\247f\315\220\036\222\346O\027\347\222\"\032"
+	.ascii	"\265G|TB\326r\314\025\341\2475\222\322YA\263s8&\306`Y\311I\317"
+	.ascii	"\303&=\017\233\245J\211\220+\342&&=\017\230\364<e\351y\304\322"
+	.ascii	"\363dI\317\263\225\376v\312J\361\300\314\320q\223\342\264N\323"
+	.ascii	"\366\324D%]\301'zM\304'z"
+	.string	"\226\207\345\001\210\353\354\252\254\007\nXg\312\032E\255S\257E\311\202\332\361\263\006\n\027/\035\274\262;:>4js\244:x\226\260(Q\344\313\221!\215\336\346\370[\216\263\344pgwD\243l\204\321\355\322\204\233\0309-Q\351y\213[\316\355\225c\225\355\345\214\372\201\222#\342\242\247\243)v\326\250\031\347\220-\"e\356N'\321w?\017O\230\2474Dv\244o\273\022L\320<\241\322hw\235\267\235.\346\222K\243\347aJ\337u\215\304\317c\355\330\302\360\250\223\276\217\330\301\r\222\255F\333\210TG\352\206\005O\233/8mD\323\325p\357\262\237\206P\311i\264\213h:o\272\236\273M'\243y/S\323\001\335\271\227\t\2109\001\346\004P.\253(d=\364)\\\332rF\3579\035elm\255Q\237tK\372\346M\303\021!\3506\021q'\313\347\346\351\302\361\231\202\345\b1*l\330t\033"
+	.string	"\262|bJ\342\310\365\242z\200r\247\r\333\365rda\262e$\205\203\3538\021\002h\273=\347\n\024\272\323\275\343:\b\217\224)VOPj\236\255\246\255\316[\336$V\262|\244p\20555\372t\007\0324q\314;.\324N\016\\\2234\351\333\215\373\355\255\253:\350.\233\234\262\322\252zm\374\3546\266\023\301\2033;r\3162ez\255\005\324\031\225\013\364H\02262\215\232\031\352%\261$\nX\243\367EI\357\363A\314\030\266[\201%\313\367\224\276g\027&\215\355\230\246`Tq\366\344\244\357\235I\337A\270\321\320:\310\320U\316\201AE\016.\255\256\347\305\314,\305!\020\311\243\256\306\3440\205J\f\342\240\201\2641$\002i(!\215HH\365X"
+	.string	"\r\024>\"\021\030L\256C\033EKEa\0048,\025\207\304\bd\314\370\315\250"
+	.ascii	"\207\"\365h\211\030,\016\213\220\311\245\242\242\033\214\310"
+	.ascii	"\244\325X\364!\001U\"\272&\213\306 "
+	.string	"\017i-\016\221\304^\322\nT**\032\225\224\214A\002\216\212@\033G@\325\003\034\304\343\021\350\203\343h\244qb=\026\t\217'\202\305%\020V5i\242\210\324\274\344\257g\375\025\205G^Qx\264I\253\260\250\022{j\016\303$\352\303q4\006Q\344z\264\367\301\201\\\223C\241\312\302o\200#\265(\034\022\201\276#5\271\204\006\325\244\357\300\025x\204\374\t\217/~\220\300\244 \372;*\251-\254jReAx<@H\211\306\252\n\005H\016\203xOzQtD\034.\331H\241\036\031O\020.\331P\217x~\224h\250'V\024=0\222G\341\217\217\321\213\225\310\301\252\326X\325$\022R\n@!aq\250\204\004\232\250\241D\2438\002\021\030\034\256H\365\306\257\206\n!\b\260\006\177\305%dQ\020))\004\022APW\340\232,\361#\301\213\026\222K\306\341\r\025y\fR\217\226\326\341J\344\200"
+	.string	"\242z\303\306xATo\360\224\3245\211\243\206"
+	.string	"&d\274X\211\034\030\221\300\016\326$\220\350\363\240q\210\004\276p\244\256@\245\341\232\374@]\201\304\245 \021\030\034\340\301!R-\252\302\3642fD0\243\002\034|\257\340\002\030\027\300\350\275\202\013\214\214.\230a\224~\206\221]\327_\322\005Ui\270\246O2 H\r\"\227\2145V\"\220\207h4v\360\343%\177\300\025\350\301\022\321X#y\024\n\255Oz\221<\n\213\214\303"
+	.ascii	"\224h\254D /\371\003\006\215&$\217B\237\025H\264\353O\202\030"
+	.ascii	"kq\350+\032\2116\211H\264G1\222\276#U=\3260\241&\221KF\032G\305"
+	.ascii	"%#R\330s4\036%\241+\260\206\322R\261\367\244\027EI\2441YT\223"
+	.ascii	"\b\334xT\221E\253\321\210,2\221\374\t\207HE#\r\244\272\252JB"
+	.ascii	"\352\021\307\232\\\262\001TL\006\177\303cR\r\016o\250G@\311\244"
+	.ascii	"\212<:\002\376\202\022\f\203T$\360\206#$0i\375U\340[\213K\306"
+	.ascii	"\340O%\036\225\200I!\244#\361\247&\207\306\342\317\372\233a\264"
+	.ascii	"\026\207K)Q\275\361C\n\232\b\032\325\236\365'\004\266`\034\372"
+	.ascii	"ndDc\205\013(\204\220\006_\024\215\303u\2304\036\213\326$\341"
+	.ascii	"\220\210TT\034\002\225\212\202\310d\321\013\025B\340\372C\022"
+	.ascii	"\2038\374\214H\240\r\237!Z+\315\r\034\255F\3038\273\242\242\234"
+	.ascii	"4\317T\241J\244|\271\342\326e?E\234\2048ik\323{\n\203\245\n\333"
+	.ascii	"\030\312\305\007&Vkq\035\314=)1\363\004Z\323T\362d\3134\026\333"
+	.ascii	"\327\0351N\253\265\305\n\334\030->\261\272/Sb\372\t\372C\314"
+	.ascii	"\207'5*<]q_\230ivQ|D\241k\324~\261_,\030f2\347 \030\343E\005"
+	.ascii	"\204\350\267h\267`\324x:\336\320A\323\250=\273Zj\207\213\026"
+	.ascii	"5\215Z\263\253}\315\315\352\210\032\032\004\355J[\035/\275\226"
+	.ascii	"\276\211s\237\335E"
+	.string	"\331cgM\0345\215\222\221u\034[\365\360Y\335ikz\333\362o\261\001\202b\2502\3714\007\342\224R\312\320\314\310\2104IsR\n\020\204\203a\240\311\245\017\022\300e5\021*\250F\222\244P\3309\2322`\345\023*kq\200\255\225\037e\316\025~\005\236\030\335\300L'\362TG\203k,\311\tQ\347\r\016N\230\302\233\031U\017\f\033\246\230\236\020\002\317 \225?d\345\346\036\216g\3231\257x\263\360\343\034m\251d\271\315\204\343\320\352s\322N\371%\275\257\376\025S\302\365\213\360\2016\0019\037\376G\304~\3045\212\322\027`\020rJ(E\272\223\236\t\351|$\326'\027\203\364\371\036\350\377>\b\264`\245\322\007\307\323\232\270\376\230K'\234Bv60i\273\"-%\211\203\314w\356\224\223.\330\300w6\231\222\332M\300M\027\232\262\206E\030\334\030-\252\331\371y\n\3126\235l\234\037\345*"
+	.string	"\027\214W\265~\344F\202\270\200W0\272\r.)\2250\336P\346\307@\377\303M\217+B\317 \3576\252\347\003\377e\222+U\371\205>\346t\377%{\"\035\001x\016\264O\301i*\327"
+	.string	"\343\213\024Z\224;EjUf\032\tKz_t\245]Y\025\301\033\305\340_\345\036\366\362\020-%\354\255\340D\234\373\275\321\032(J\314\006\223\324l\236\367\210t\306s\223\346\t\233i8\305\312$H);\215\324\370\216\222\303_\307D\327\007\004c\320K\352\204\322\256p!\017cSD\341\344\253\007U\240\276\033\340^\252C0\224B\263 \236\257Y\215-~\250zJ\305\t\366==\221\330\f\332\276N\300\303;uU(\263\355\006\376\n]\321FAR\244\340\320i\353\004\267\204\232I!\347\344\257 \312\307\212\276\272\271b\002\344\035\001\273~\204\3744m\022"
+	.ascii	"\237Q\001\254\200ZJ\302wl\272\223\215\037\n\0360\227j\026\252"
+	.ascii	"G\nQ\020\360\r\342\350\021\271 |\"\266\343\030J\256\002\333\016"
+	.ascii	"\345qN\317\246\306\324\251D\037\322>\245\362!\202K\315\315vW"
+	.ascii	"\355\177\265\354\334\377\314:\232\350\254v\361\006n\r\313\343"
+	.ascii	"S\013Q+\230\363"
+	.string	"\326\355\230Nm~"
+	.ascii	"\240\227$<ve\005\274\344V\205 \317o\304RBR..]>rDL\021\\\223\n"
+	.ascii	"\213\224/\305\307\033|\245(\357\203\362\332w\374k`"
+	.string	"z\260e\032\301Bpmq\362{\274\221\263\272@H`\357\213\302Q\320\377\t\213\215\377\337U,\220y\311\237\235\235\266eO\356\304~\002\016\013\t\326i\204L:\t\327\235\214\343M1Y\203\242\t\276\2062H\202\322\214\242m\020D=\035\333\225\305;\261M\335AK\"\345\237\234m\020\024\243'\022\243\364\017\254\206\037v{\002\327\261\035\374\"o:\261\246\222\240\3525\\\221\325lt\311\335Z\001\376G\317\311D\341\367\376\22379Bi\035\036\3020\b\035\254\216\035f\365\374\303\232>\021\367\370h\211\230\032\336:<x\\2\027\341\303\223\317\036_~\217\327(\346Xe\262\013\026\253\336#\377\022\2244\032\325z\013\342\237=\026n\343D%\207\204\373\334\236\273\34246\b\357\\\331\333\351W\306o\346/d\341G\224\200\261\250#V\236\023\264%\347\240%\330\244\324\2152I]\031\r\230\361\016\360\034\224\304c"
+	.ascii	"\322\346 W\320\243\213\367hf\276\004H9R\314y\205\037C\331N\354"
+	.ascii	"--(\351\305\241c\353\367\373TU\367\204\\\244\251\f\332\032\254"
+	.ascii	"\024\302\023\234\262b\230\265\303\030Z\231a`D\217\202\277\320"
+	.ascii	"\276\204\370\351\270\342]8\233\300\330\234\004\343\317,\236\210"
+	.ascii	"\216\253\232\203n\013\314\217.\214\306-\232[I\266\217\252\371"
+	.ascii	"\f\301\030\217\030\3229\374`\020;\201\205t\002\024\240\205\227"
+	.ascii	"\243\331h\327\361\201\027\017\250\303*\034\2631ci\362\332?\022"
+	.ascii	"\223\353'\001\020\236\371\005BD\347_$A\024\226\031\343_\270\377"
+	.ascii	"\304\266\243~\335+B\372M\rr\276F\0345\277-H\376o\224 \221\021"
+	.ascii	"\227\247\235h\227\206\350\324/\321sw\247|\272\222\361y\\J\275"
+	.ascii	"kt\214\337\3741\274\007\330\245\330\b\202B5r\274\215\242\304"
+	.ascii	"\021Q\226#B\023R\200\367\275|\304\206\224\261,\\\350\035w\033"
+	.ascii	"\303\017\203\3119\2662Q9\221\005\234\007\355\255\335W\373}\211"
+	.ascii	"#}3\204\317\303)\231\032\007\274 \177\355\340\247\034\023\236"
+	.ascii	"\231\346x\313\363\021\f\216\313\341oe\253XG\347\206\324\233\231"
+	.ascii	";\262;u\314\207\363_~\217\360\262\367B\3037\335\251\367\230\370"
+	.ascii	"\275\314ZbyC}\202\030^\311[\240\336\261\306\326\007\333\201\347"
+	.ascii	"7\206m\034\277\346\353\037\337\371\363\362\300\254\266\002"
+	.text
+	.section	.gnu.lto_.symtab.23007e186b806100,"e",@progbits
+	.string	"calculateEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"positionConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"isAltitudeOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"pgResetTemplate_positionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"positionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"positionConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.23007e186b806100,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1981 @@
+	.file	"servos.c"
+	.section	.gnu.lto_.profile.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`n\003\305\020"
+	.string	"\024\026b\004"
+	.string	"."
+	.string	"\334\301\274\312\f\f\002"
+	.string	"\002\001\002\002\002\001\001\351\361\316\337\001"
+	.string	"\002\214\216\274\341\007\003\274\331\333\367\005\f\002\003\002\004\002\005\004\240\342\234\212\n\005\006\224\305\200\177\006\002\002\002\007\002\003\002\b\007\n\232\242\313\204\f\n\002"
+	.string	"\002\006\t\003\002\004\013\f\r\340\216\253\313\016"
+	.string	"\002\006\017\331\312\303\304\004\b\002\002\n\021\240\367\360\225\r\002\022\364\320\211\371\007\n\002\013\002\013\002\002\002\f\002\r\003\002\004\025\026\206\353\317\360\016\f\002\016\002\016\002\017\002\020\027\352\263\360\321\b\030\031\032\350\266\266\364\b\030\021\022\002\021\023\002\023\002\033\227\257\311\336\r\035\344\362\241\220\b\020\002\024\002\002\021\036\375\251\320\324\006\212\001\002"
+	.string	"\002"
+	.string	"\002\025\002\026\002\003\002\027\030\003\002\b\002"
+	.string	"\027\002\031\002\031\025\002\032\004\002\002\002\020\033\002\020\034\034\004\027\002\027$%\201\310\237#@\002\002\035\002\033\002\t&'\335\357\266\265\004\\)\342\201\222\246\004\002*\230\227\377\334\t\002+\257\260\211\347\004,\265\371\317\206\t-\362\324\245\255\006.\303\306\351\344\006/\320\266\271\326\t0\374\234\315\270\0131\227\213\266\256\t2\376\312\360\275\b3\265\332\223\353\00145\244\376\226\227\01767\235\336\315\261\00589\362\326\362\261\003:\240\342\234\212\n"
+	.ascii	"U\250\321\245\300\314\fJ\222\222T\2065P\002cT\245\016\022\200"
+	.ascii	"SR\232c\210\231\t\306\"\242\245\365\357\232\001\300\271y\024"
+	.ascii	"v\275\212LM\331\021N\221j\263eR\\\207J\241\340\363-y\274Gj\222"
+	.ascii	"\337hX\f3?\332\331/H?T\253r6\363\022\255\323<\266\335Wk\241\230"
+	.ascii	"\331Bz\205\2651\276\375i6\355;Fc\273*^\340m\375\353;\206/\357"
+	.ascii	"6\177\025O\250}\345\363\211\201\007#0\033fm\020@\365\271g:\211"
+	.ascii	"4?\216{j5b\313*u&i\345\355%\3254\037\352T\271\226\320W\f\375"
+	.ascii	"\315E\236UG\361\032V3m\320G\372\t\210\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \337\315\003"
+	.string	"\364\003\323"
+	.string	"\021"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\001\001\003\001"
+	.string	""
+	.string	"\001\001\002\001\002\001\006\n"
+	.string	""
+	.string	"\r"
+	.string	"\001"
+	.string	"\001\017\003\021\002\003\022"
+	.string	""
+	.string	"\026\032"
+	.string	"\001\035\001\036"
+	.string	""
+	.string	"%\001"
+	.string	"\001'\001"
+	.string	")"
+	.string	"\003*"
+	.string	"\001"
+	.string	"\001"
+	.string	"\032"
+	.ascii	" \020\360/%\007\030\200\022\210K\036?\t\337\274A\261\353b\323"
+	.ascii	"b@\247!\316\002\260\001\315IX\231Ol\\\030\b\246\031\026\004\022"
+	.ascii	"s\340\237EX\202\274\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\207\003-\021"
+	.string	"\346VVF"
+	.string	"\2576\215\001\257\370\306\031\333\332\311\2213|\237?\332\341g\3664FD\244\270\375\035\301\335\322 S\f\032o\330\374\222\273\224\314h\0023"
+	.string	""
+	.string	"\202\024\240\252\252B5\3530\336\021\356\274}gt\351\314\372\223-e\n;"
+	.string	"F"
+	.string	"K"
+	.string	"\253\222\277hu]~\233\232sb,_\277\033\245\306\3169'\366\022\2028\221\245B\023K[\357\306\337\256}\275\035?fRh\377\255\207\320$\363\331Wp1\204&\026\350A_\017\002 \331\322\322\"\271>\260\337\220\"%\225\232\320\001\365v\005\245\204\372,`\024;\220\320T\302\013\250\355\255\033\365\223+N\023`\020\354\207T\n\212;S\016\031\316)r\373\022\224!$&6\030c\335\270\277&o\260^\016\326\204\006e\205u\254\350\202E\fi\324\261\025FJB\024\330\300\302\314D"
+	.string	"a\360\255\n\220\027\031\322\004\336.qD\013\232\033Q\310\013\r\252\21434\300fZr\303\301\302\210c]\302\026\013w\310\263\341\271\364\037\255\276\253\007\340\377g*\261\316$\215\213\363\002\375U\265\311\340\".\004P\226891\241\033V"
+	.string	"n\351D\201\245)+\252\226\310(N\360\312\371\007t$`\357\261\"V\342\310\306\354K\217\255Y\211'e\341D\001Z\250\221\255b\002\242\232I\352\024:`\002!be=\021"
+	.string	"\2615\bU@\245 \255\024\2461\314\345\370\005O2\274Bg\222\333K\304z])2\"x\272z\034y\253"
+	.string	"\"/\025\020\006T\273c"
+	.ascii	"\253\334)\235b\211\267\306b\024\227\2361\n\315\355I\2146n^\234"
+	.ascii	"rZ&\251Hof<<B\260=\336,\370F{\017\003k'\367=nr+2\373e\216\256"
+	.ascii	"\313\241\233\303T\013#\354\352\206\177\261\037m\332\252\357\365"
+	.ascii	"\013\354l\213\216\362\2078\346|\205\302s\237\342q\311m}\354k"
+	.ascii	"\tj~F\317\221\3444x\324\323a&\366\354\274\365\025\233\344\334"
+	.ascii	"E\253\341}8\033@\337\246\206\272)\333\347\221\226\240\332a\303"
+	.ascii	"\312A\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\n\003\315\f"
+	.string	"\306P63p\305\311p\2646\354\037\332}yJk\325y\230MB\nU\245\241m\b\034: JWUUEb\371a\370DI(\324\2520\264n\351\332\r\366\226I\006%"
+	.string	"("
+	.string	"-"
+	.ascii	"\323@\253{\207\321:'\026\272H\327\246"
+	.string	"\360\343\250\361\250\365\307\254\342\254\202\314\252\t\331qZ\331u\353I\341:\020\025\033\272\032y I\025E\355.Zk \325Iu\223/%a\302\311{\357\221\004\032\317\2713\323\222P\343\233U\026#\221\001\036\300\275\3439^\236\345\311l2\033\211F\242!\346\203\371\274GAQ\263@\353\016j\305\226V\260\245\365\365*R\204\320\351LW\242,$\tA>\220\3444\2019}iW\004\247\313e\254\035\2653\356\217\253[\356@\2761\004\355,\030(j\300\002>\\\250\021I\314FB\005\261d\230\003`\002\221rW\036\022\300\262\202\210I\005\025a``g\177\326\364Gks\353ft\360\325cv\326R\362#\0315\003\332\034\210%\250\234R\355FHH\304]\313\026He;VF\202I\226\257\242\002Z\225\263F\335S\214\262\206\201\206f\206\373\253m^k>\006s\335\227\006\253\257\307/\007\275\203\370\226\026"
+	.ascii	"|\346\200\362r%5\255`\311\217\272\b\216v\036\242J\306\203\271"
+	.ascii	"\276G Y\036|\364\325\"\fk\346\241\2428('\024\t\211\364\24511"
+	.ascii	"o${\350\230,8;\035+\340\262\345\007.i\004\213\022d(\036\001\207"
+	.ascii	"\242\270\327\032#Z\001\367\004"
+	.text
+	.section	.gnu.lto_.pureconst.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\230\004\003\230\004\006\230\004\n\231\004\r\230"
+	.ascii	"\004\017\205\004\021\205\004\022\230\004\026\231\004\032\231"
+	.ascii	"\004\035\232\004\036\231\004%\231\004'\231\004)\204\004*\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\265\007"
+	.string	"\302\212 (\200\305\031\016{Jw\231\301\r6\225dB\240\001s\001\233\301*\276\241\237\265G?\365{[\f\2000\035R\266CD\312\024_\326E\251XmN\224^`\345X\347\244\355_\361\222D\344*\021\377\312\037!\345\201-\253\301j\313\b\265\360Uy5\037\345Q\035\202\243\263\321\031\325\3719\251r\252\223Q>\265\216 3`\271`~\303w\366\274\271{\026\330\271\003\346\317=\357R{T>\320p\350\347\t\0203 @\002\206\246\362\006\016a\001\354\320\206j\272\234\016xT\021\033\350\322\233\320\312\300I\f\311-\330L\270\327\300\371\331$7\306\354\031Wi;\327`\207\307\341\325\316\306\2269\300\004Y8\335\302E\316H\314\2700F\210\006\250\022\270F\267\031&[\002\233>\250\007\330!\033\332\306\317\035\035\003\363\266"
+	.ascii	"{\204\032\224C\0202X\350\320\351nX\005sE"
+	.text
+	.section	.gnu.lto_.lto.39163b6117bc7f98,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.60.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \235\225\004"
+	.string	"4\bh"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\276\310\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\346\006us\250\377\005uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\0014?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_servoConfig.61.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`S\002\235\022"
+	.string	"\026\341vH\320\362&\035S^\177c\306\201\212;\347\260\340\264s\346\202\207B\257,\017\033<\215C\b\006\2031I\320\250\333\f\206E\007\234\202\206\201\031\2005\231\340\024-\f\006\277"
+	.string	"\300\314\312\274D\305\357\236\td8ad\023\271S\n`"
+	.string	"]"
+	.string	"f"
+	.ascii	"L8vG\b>\361>=\036A\367\351\335@\367\351\230\355C\201\r\253\n"
+	.ascii	"\247hjw?Ua\357\334xs2\366\311\251\214"
+	.string	"\371Cop\002iF\223}r\":;;\004\320l8\027\324\017\024\267]\346\320j$\007\304s\275\355'=R3\032\317\245\210\312\356Z\316h$\356\356\266E\333*\266,\021\237\376L\3679\002e\013\nB#o\366(\223\372c\337\005u\343\302\352c\2678i\326\205\376\356\265[UZJ\351\017\220`\"\301mw\304m\310:M\245\026\257\335\376\350\333\210>#\366\232\211'\333\361j\350\320\001\262;>\370t\212\367Y\302}e\373\322~\214\313\210]h\346\004v}\002OK$\263\307,\252\200\274z\307\320\331\031V\344gRKlTf\226^o\373\024\352\271\341T\251\262\324r\026E#o\252G:B\222\324\034\313s\200\001dF\257+\205IES?\330\331.G\002=\242\242\240\b\034~\303\306\b\220mj\325\364\260\263_N#$y\262?\374\b\346\355n\212\221\b\342\300\212\335=\2132/\r0\024"
+	.ascii	"\270\200-0\341\204\225YP`a\b\361\005\373b6\270\200\035Z>\030"
+	.ascii	"p\345\345c\021a\037\312\002\207\036^\342\027\023\206\342\267"
+	.ascii	"\032\367C\367\214^8\321h\315\324\037\267\226\264\245\023\206"
+	.ascii	"t\216\244\252\361\020!\251\316\355\356r\372s\223N\265\245\247"
+	.ascii	"\352\221\272IQ#o\226j[\346M\025\034\270l\013g\272\300 3 p\002"
+	.ascii	"\241J\242\007\217\230\364Wbk\327\222\315\005J\254\203\226\372"
+	.ascii	"~\215\307$\026\374\370\305\214\357L\033E\262\002\234\205 \037"
+	.ascii	"\"\300\275jD\246 \236\212H\363\217\"o\340\307\213\244L\343k\002"
+	.ascii	"\302[\022\035i\342_\202@\317\265]\305`\\\254\022\336\357;\346"
+	.ascii	"\r\233\323wM\254\325\272\373\206i\327@\304z\267\331V8a\321\020"
+	.ascii	"\301^\250\031\357K\244s\365'"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.65.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \221E\004"
+	.string	"\244\007\\"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\315\361\037\006yw\350\316\006yu"
+	.string	"\005\001\006'\001\360\035\001\020\025?\202\210\2008sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	"0e\250\204\004\232\344\r\240\b"
+	.text
+	.section	.gnu.lto_servoParams_Registry.69.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \237}\004"
+	.string	"\364\007j"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\301\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\006us\324\006uq"
+	.string	"\005\001\006'\001\340\035\001\b*?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\005"
+	.string	"0e\250\004\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.70.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`l\001E\017"
+	.string	"\226\336iE\360\262&\0352\323-\256\343\363\2346b\277\305\3260\232\324\021~\346a\373\3374\rk\203\177pWPpk\324\002.\007\233\206\213Y\212u6\003\317ar\006\250z\201\357V\374\2743Q,5j\322\310\336R\246\024V"
+	.string	"R"
+	.string	"V"
+	.string	"'\200=f\037\200=:e\347\2707b\377\201Hy\365\330]ME8;\364n\230\251G\250\231\362e\216\300\303M\307R=\302\317\n\313\215"
+	.string	"\254\r\320\204g\247u\327S\205\265J\210\242\345z\327EZ5\035\253\345\371a\260\273\316\216\325\341\306n\373d{\201}\025\001\006=\346\377\374\273\341\323\252\351\324\364C\260\0356\n\320\354r\350\001\2629\221\206\211\314\177\366_\367|\227C\217v\213\273H\375\263M\246b\311h>\022:vw\344\321\n\262\307\003\360!\333O\373+\316\"\365\230\f\027\260\353\202#c\327K`\221\354\321^\371\231\177\3461\266\334\301\261\313\275\363_\034\006\005\370\022\217\306\260a\357\036\375\r{T\265+\\\310w\016\341\t\301\251\312\251\037U%yq)"
+	.string	"\3345\260k\3529\230U\366\030\352\365\2577\200i\335\244\004A\311\036U\232\025\0373T_lO\225&<\334\t\253\213\003\244\217D\245\023\324V\"e\026\225l&\013\247\321\246\241 < Ep\240\225H'\0224\321i\323J\f\3304at\322P&\323I\013y{u\361e\236\315\360\310A\321U\324\027\177p\024\244\252\223#\207\252b\033\f\352c>\035\r\371\343pw\027\232\344PAz\327\341\217V\r\367!\013\031"
+	.ascii	"1\003\373\274\201[?ieQ\\\363!\n\210\305\032M\b\223\231A`\006"
+	.ascii	"\005'@\237\265V\211B\262\020\316S\2259hg\225\260fu:h\027\207"
+	.ascii	"E\224\275P\325x?\211t\256\371\004"
+	.text
+	.section	.gnu.lto_gimbalConfig_Registry.74.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \220=\004"
+	.string	"\224\007["
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\201\037\005yw\250\324\005yu"
+	.string	"\005\001\006'\001\001\005\001\006\035'\001\0038sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.string	"A\210!\345.\320$o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_servoMixerAirplane.79.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"U\004"
+	.string	"\364\005\370"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\001\006\303\001{\302\003\002\005\307\001{\306\002\004\312\001{\273\276(o3\314\0014\313\001\311\001\310\001\305\001\304\001\301\001\300\001"
+	.string	"\023"
+	.string	">\003"
+	.string	"\351\200\312\002x\332B\035\270\030\370\t\212\201\023\320^\360\211T5\257"
+	.string	",\302=\320\003\026P\301\221b\365"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixerFlyingWing.80.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \3725\004"
+	.string	"\244\005\355"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\003\007\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\004\035\303\001{\302\030\001\234\177\273\001y\306\002\276\273(o3\312\0014\311\001\310\001\307\001\305\001\304\001\301\001\300\001"
+	.string	"\022"
+	.string	">\003"
+	.string	"\350\200n\001\205\177F\025\fx\271)\323\026,"
+	.string	">I\225"
+	.ascii	"\354^\026X\204\366\200\f\b@eFJ\320\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerTri.81.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 RE\002"
+	.string	"\224\003E"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\002\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001?\202\210\200\bo3\300\001"
+	.string	"\005"
+	.ascii	"@\006\004\2402#%\350\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerBI.82.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \323\265\003"
+	.string	"\364\004\306"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\001\005\005\001?\202\210\2008\177}\277\001{\276\001y\274\001w\273\001u\275\001s\274\001q\273\001\005\001\006\025\001\003\002\302\002\234\177\004\306\305\306 o3\310\0014\307\001\304\001\303\001\301\001\300\001"
+	.string	"\020"
+	.string	">\001@\230.\307Y@\037\027\032\003*\2466\f\203\300\300'\200/\231j\017\310\200"
+	.ascii	"Tf\244\004=\200\""
+	.text
+	.section	.gnu.lto_servoMixerDual.83.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 x\245\002"
+	.string	"\304\003k"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\035\001\005\005\001?\202\210\2008\177}\276\001{\273\001y\274\001w\273\001u\275\001s\274\001q\273\001\004\301\001{\300\020o3\302\0014\277\001"
+	.string	"\t"
+	.string	">\003"
+	.ascii	"\0201U\016L@V\367\300\002\225\031)A\017\240\b"
+	.text
+	.section	.gnu.lto_servoMixerSingle.84.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\365\004"
+	.string	"rF\030#\220-4\006\177\375\257\205\277\205\377\266\265\221gf\026?\361\247|Qsw\033\027\345\254G\265\276\204\320N2\371\3457\346\314\2339w\366\034Z\364h\322%\303\246\202\342\027\243\202\200\017\033\264\002P\243\013\225\340\301\256\267\305\216q\245qs\354\0367\266\005\0229H(\023\304\272\257\323\204\327\256y\346\211\031"
+	.ascii	">\003\200tId\361\204\177L7\252\320\036\370\230Q\234\200O~Hx\331"
+	.ascii	"\021\314\002\017\355\201\217\215\036V\005\300\200\nh\017|\214"
+	.ascii	")\026\376\252\037,\240\202#\305\352\001\024\001"
+	.text
+	.section	.gnu.lto_servoMixerHeli.85.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\225\005"
+	.string	"b\007\034'pO\032\003\374\374\327_\377q\333^\377\244\361\357\252*\244\237XD\321~\377\377zWH\002\005D\255\216\354\326\032I29\346\260\346\315\234;{\356\006\035z4\351\322\246Q\206S\205\305\335I_\255\362\265\"=*\002\037}S\365\"\214\013&d\262\271\301\313xklq\274\2177\235\313\276@4Dd\"I\374"
+	.string	"\326\330\352k\f\376\362\314)\001\033"
+	.string	">\001\264x\002P0"
+	.string	"\035i\312\024\261\026\024\r\034\332\300\001x\304\024\037h\031\360rS\306\223i\031"
+	.string	"y\202v\340c\200\005S\355"
+	.ascii	"\211\214\252\353W\347@\017X@\005G\212\325\003(\002"
+	.text
+	.section	.gnu.lto_servoMixerGimbal.86.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \177\315\002"
+	.string	"$\004r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\030\001\344\375\035\001\r\001\005\001?\202\210\2008\177}\300\001{\277\001y\276\001w\273\001u\275\001s\274\001q\273\001\f\273\001{\302?\202\210\200\020o3\303\0014\301\001"
+	.string	"\t"
+	.string	""
+	.string	"\021\250\253Q\347\206\352QY\007pP\231\221\022\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_servoMixers.87.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`T\002u\f"
+	.string	"t\022\037\003"
+	.string	""
+	.string	")"
+	.string	"\005\001\006\177\001\035?\202\210\200\020}{\274\001y\273\001\005\001\006\025\001\032\031\030\027\026\005\001\212\001\206\200\200\374\342\303\304\243\017wu\b\310\001y\307\025\270\304\203\017sq\002\314\001y\313\024\023\022\021\020\234\236\354\027om\t\330\001y\327\017\375\302\017ki\005\334\001y\333\016\r\f\013\n\t\274\236\260\227~kg\334\001y\351\001\007\006\244\227zse\314\001y\357\005\364\342\rca\004\363\001y\362\004\003\002\364\226o_]\001\373\001y\372\330\003[3\375\0014\374\001\371\001\370\001\367\001\366\001\365\001\364\001\361\001\360\001\356\001\355\001\354\001\353\0015\352\001\350\001\347\001\346\001\345\001\344\001\343\001\342\001\341\001\340\001\337\001\336\001\335\001\332\001\331\001\326\001\325\001\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\312\001\311\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.ascii	"3 @#\031\221\033M\022\200)/\210M\\.\334\016\265\025,\021\351"
+	.ascii	"\036\244\\\f\2757\302\"\0349[\221\005\273$\332\262Ap\321\314"
+	.ascii	"\262\355\301\354\346\023\226\210\344$l\022\203\226\373\241#\204"
+	.ascii	"\031\351\302\366\003\316$\271\ts\"%\351\032d\312]zT\223\257A"
+	.ascii	"/W\177\330\311%\354\022\341d(!2\350a\025\001"
+	.text
+	.section	.gnu.lto_determineServoMiddleOrForwardFromChannel.88.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`[\002\375\023"
+	.string	"\006e\204I\300\324M:\302\257i\023o\2023[\337\212\211\325\231\314\200nN\227E\373o\343^#+\023(q9-\376\330\275\315k\002\n/5\364\370\266\365\235\026\207D\220"
+	.string	"I\224\374\036\336\377\262X\\\374E\240\330\266I#\233\310\235Rn"
+	.string	"f"
+	.string	"q"
+	.string	"O\272\f\334}\032\354\252\025E\211\243V\037\002\237\210\247\006@\333~\214#\341\234\233\276\024\037\302\"\021=LFj\2551"
+	.ascii	"7\tO\347\003\204\247[\364\334C\n\356\314\371\034\036\036\b\306"
+	.ascii	"\023}9\302\332\361\200\016\226\360x`\274\235\271\240\t\325PU"
+	.ascii	"\t\217\007<\021\232\nq\362\323\207\2473g\213\245\326\352\271"
+	.ascii	"\343\201\270[\267]\263M\263\247.\343~)HR\270\337\223\247.\216"
+	.ascii	"|\364$\321\315\322\366\351\314\355\331\337\262,K/\221_\236v]"
+	.ascii	"\351\026\357\373COS:\r\266\2467\234\236t\372\260\222(*\005R\265"
+	.ascii	"z(\263\352\017\372[q\245\337>l\310\3118_\362\222Q\260i\343|\322"
+	.ascii	"0'H\301])G\254,ZM@H\020\251\325w\340\324)\342\234vP\377=\210"
+	.ascii	"\340\342\022\236\272\326\365\023\027\334\227#,[Y\r\375\300\355"
+	.ascii	"Y\334\335\231\204\354aK\370\323\004\261\326\252\342;\375\006"
+	.ascii	"\205\n\262\371\235l/\365\tuEeb\267\347\3629\241\270"
+	.string	"\003\202\260H!;\023\211\347\212;yx\366&\332v\b\252\022B\252uG\3453\354\r\267\0213\013\234\310\"G \325ZWh\274\206\214ot\352\0134\363\273S?\256\321\214\267\026\230\233\f\3476\266\214\020fh6\233\2546\023\220\201\006c[\360\362\f\245f\274\271\321jb6\265\030\231\031\0131\233\214\214&6\273\325\304P\bx\304@\273\305l\306\361\026\203\371t\007\353\022y\032]\t\321\327\236\274\353E\221!\240k\351\372\330\246k\026\335\352\200\265\326\032n\317\r.\345\200A\t\"\246\035:^\353j\021u$\351\347gJ\005\335\236o\236#\267\342\007, `\002\231\"\255\007~\261#\215\350\277\342\305R\202t:9\321.\311nI\275{ \322t\240|\271\311\227\t\343l\311\241\260\206\332\236\006\343%\354\302\031-\031L\357pxO$\314N\037\032\0237\177\314\313\376X\215~1\016\252\035\300 \332"
+	.ascii	"\205\273#\020L\214\234\227\257\tA\004\224\\#z\004m\027\253\361"
+	.ascii	"6\031\325+@\001"
+	.text
+	.section	.gnu.lto_servoDirection.89.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`<\001\265\r"
+	.string	"\246\332]C\020q\224\016k~CT@\022\244\235#\320\001\372\221M\233\t=\006XR\276URC\356\t\275e\324\340~\b{\033\253Q\004\252R\377\253\210l\364\254 \b'\230\306\f\256\310\264\0021C\377'{K\231RG"
+	.string	"D"
+	.string	"O"
+	.string	"\0052\217\266\375\226\253J\266\013~)\274\257\260\240\\^vW\003y\200\354\021\036@\366\250+/\035j\226|\223C\007-\257\224\027\342\372\341u\020dw\317z\236x\247L\214\310\356:S\336\207;\336\366\002\333\020\354\243\004\031\263\277.U\305>\334\335\265\246\330\377\376\314W?\346\351\250i\250i}:5}\315\307\013\r\0056v=\304`;#\306P\341\rga\005\361\332\334.\331\033\373\223q\340\371\225]\326\354\236X\001cw\r8\376dP%\264j\2342\207U\257P3\027JD\2271\247\252\036\265#\243!O\315tp\200u\266\360\027$\fF\250H\250vO\b\336\262Cw\261\345"
+	.string	"\023\260V\007\325\356&hq\027\f>\313\243E\244|\252${\274\236u\002\335\013\307\312\024\036\361t8\322\366`D\n\201>\033\r\236\t\240\006\036\356pD[\006\316#\322F#\025>\027(h\240O\004\022\255\303\2114\216"
+	.string	"o!\017\247\215\266\215\3236\237\351p5\305%(4\344g]S\342\006Jr\036\365\304vT\213\230\264\203\252\222\273k\242\001\027"
+	.ascii	"\255\262+-)I\304\273vC\006\331\272\2115\364\330\n,m\037\027\353"
+	.ascii	"\343\204}l\266\266\274u\335\205[\013\213b\260\r\f\003Y\300\334"
+	.ascii	"\240\002\026@\345#U9\243.nm\321\003"
+	.text
+	.section	.gnu.lto_servosInit.90.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\334\002e\026"
+	.string	"f\251\217J\260\324Q:X!\307\004\353\013\335r\242\361\250\320\210T\312\217~\f\277\263\272\322\006\207\024\326\021\177\300 \244\271\241~\211o\205\301Q\272\205\3675\354\300\367e\357\0136\370\f\272k\f\345\265\303 )d\250\222Ab\t\331r\247\024|"
+	.string	"v"
+	.string	"}"
+	.ascii	"\340I\317l\253\373\220\352\235z>MDj\255\255-a\361\324w\223s\366"
+	.ascii	"\222Q$C\026\3359\363w\037\313\034\355%-\"\204\212>R\341\212\276"
+	.ascii	"{\013"
+	.string	"\n\334\207)R\026\020\256\352T8\"\352\372\321\243\350\275\333$OB\310\350\3414:k\350\364$\347CYj\255d\3166\227\246\004\231(Or5\352\342\003j\310w\237?9\333\234\254\005\265V\3172't\233\334v\223\355\027{\376\0029+H\265\332\\Lo\361\242O:h\013:\241Nxp\356\330\273\357,`~\2225\310\346\313\203\276,<\370%k;\212\020\365\314+\333G\233\253\263\357\372qS\362\036\331*\344y\367\bN\213t:\004\247Ap\232\322\351\335\3519\247\277\202\322\323\221\340\252\326\240+$\365\007\3268q\336\355\257\360{&\r\034\230\235\307#V%V\f\247\033>j\365\275\034\264\213\370R\017\f\201\206&<\230\2024n\270\nxO\273N@E\240\302\325y\356\241\376\336\351\221\033\365yBr\177|\026\314i\200#\252R\004i-\331\230A/\343\340N#\366\325\n\356\243B\330\226v"
+	.string	"T9\232vu\376\206\220\256\r\023\017\3334\342"
+	.string	"\223\345\021B[\302\204\371\222\256\311\323\320\317\2664\357\372/\016\303S5\226\232/-%\244\0042w\367>I|s\02780\blwxS\257\373&F\006\343\020\303\221\265v*\344\274.Phax\325\350\264nb\262V\314"
+	.string	"\3032\340\304Z;0X\254E\372\352\367\3102K\277\236\255\225\020\2306\203\006\363\245M\236v\243\2706\002\246\355@f\276\024\367\273\337\303\223\212_mi\026W\347\367^\240(TYS\026\271\343\376\210\267\372O\353\352\316\023\216\253\262\027\3429\335@\324\346\225I\034\237\tm\307>5\203\202Tku\371Q\017: @\002\203\214\241y\362\201\365#}\266,\3275\360\275u\013#\276\013A8F\200\233\330\211\231\026\327qX`\267\366\226\305\222a\025\231\212\026UB\257m\325\021\346!!\233H\242\314C,\266\220|\304\330bi;\223}\304\022\0161\230)\224\262\036\020\023-u8\366\330\237\256"
+	.string	"4\305`\277\330p\026\335Su\275\025\205Xh\353\230Z\306sE\317L\307\005w[0x\241Q\326\314H\373\306rs\266A"
+	.ascii	"\"_\327\350]\n\n"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.91.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`c\002%\023"
+	.string	"\026\344~I\320\362&\035R\230\fY\2731g\r\215>\375U\354\021cc\221\265\033RjHN\367rA;\227MA\bkfm\373\242E\362\265\262\254\2222\034N=\214R\272\266W\202\353\300\257=\022\235\206\370\202\343i\203\354-wJ\001h"
+	.string	"e"
+	.string	"p"
+	.string	"\006>\300;\235\027\340\235\312\317.\373\306E\235\372QI\003\220S\255\025\334\034\003\370\024o*]\367\350\\\351\362}~"
+	.ascii	"\305H\013_\367\346&\031\205\030\tg\023\245\2263\343\342eL\030"
+	.ascii	"\223\224\247\346s\242\334zD\214\204\262\271?c\321\027\316"
+	.string	"\344^<In\244\2055\227 \fj\255\226\264\220\303\rr\333/\333\rl)\023oy\376\211\003\265\374\035_\200\221\247\235\3720\336)\325\355\350\321\001\223;[\214\311\305\261\177\0224\243\341\275\261\277\347\356\271\322\273\322RJ_$\300L\322\202\242Zev=*\022\035\032\361\334o\177]\370\350\311p\023\016\241\371\361\331\267\371\242\277\323\337\216s=g\"\324k\0065\216NL\265\326\222S\223\240N\003ED*\005t^`\310\341\210\0011\362\360\3700\027\307)\336\227\245S\222\311'\333\017\336\"\305\201\215\215\232\255V\231\202\353\354\227\263P\001\301m\330\211a\253\265\236\004]h\205\305;\375^<\002\032\037$p\233\324t\313\261\026\221f\272\217\274\222\337\366\025\252\021\235Za\247\371)\256\"\345\357\234Z\202J\345\235\332+\013\3624K\241#\244\331\276\354nI\335+&\255\325\013\213\245\005\272\264DHM\200"
+	.ascii	"RH\251\250\300\025V\0134!\340U\005\026\026\350\262Z\261\300O"
+	.ascii	"\204}o\356s\324P\210\004\333X\roq\034Rb~\273K\262\344scL\344"
+	.ascii	"\315=N\267$\223O\237\265\326J\023|\356\267\357\220\033we\234"
+	.ascii	"\326\364\226'w\367\263ZL\356\fC.h\343T\273y\200\311\235\377c"
+	.ascii	"\024+ p\002\241\262\234\007\n\262\"f\315M\234\277\267\343\335"
+	.ascii	"$\004\323\374\213\342\301E\314\203\005L\231\335\207V\254\027"
+	.ascii	"\212X\261\347cq\301\001\354\240\335\310\333\300\255\313J\352"
+	.ascii	"\2654g\016\247\230\301\235\205GD\325S)\215\360\326)\241\276k"
+	.ascii	"\200\245+\031<\303\321R\260Z\371B\344\231Q^@\0138\306D\f\211"
+	.ascii	"\316\325\311"
+	.text
+	.section	.gnu.lto_servoConfigureOutput.92.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\237\004\335\035"
+	.string	"\206u\273H\220\332M:\200\2000\343\365\205r(\232k\207X\360\370\317\237\236\031\235\300H\013`\372\354\350\271Yo~\350\177\356\0041\215-\007\306\270}\023b#d\022#\021\223)n\334\25715\017\361\366\267\2655#v\357-e\222\001\250"
+	.string	"\227"
+	.string	"\250"
+	.ascii	"\237\007~C?\345\003\320\317\343\226h\327\313\211S\365^A"
+	.string	"\340\226\231Zk\257{,\357\222\370\235L\364\034\356f\033ktJ]3\321\2766\301\026\024\026=\207\273\3017\004;\232\242n\223\017\220\314D\375\nS\224\314\241\001\261\274\212\311\006\217rA\216*N\277\302\004%o\310xtym'\004>1\2255\244% ;a\222\334A;\373:\361\210\347MH\215\313\261\306u2\200\215&Y\030d\031\002\365\253#\250b\302\301M<\323\020&\311\003\265\326_\235\225\204?\346\332\204Z\353rP\330\364\335}\367\272\335\325\331\225\"\002\263\333\206\365\255s\005\261\360\371\350'\267N\f\327\231\205R\004IY\377}B\313\354\210\321v\237\344Z+eO\265/\266\310\017~\356\267\330\355\304e\365d\304i\273\304\"\356\341\356\257c\314/\312\266\324.\363\346\340<\353\313k^\233\346\3355\257\256ys\224\027Gyo\224\327v\336Q\362\326&/\235\274S\362\312\346m\346\345\363\276"
+	.string	""
+	.string	"2d\030\304j]JKS\307\346W\220g\375\273F\366\304\305\375\310\261\210\236\265R\306\"\246\221\211\327\322Y\255U\347s\027\214\001\323L\247s^+\365\330\024\254t\217\335j.k\255u\366pw\031\234\3278\375\242\222\264\244\034\277\242\013\rwr\252\335%q*\033\022L\325Zw\366S\016\306a;|\340\007?\214Q\202\242-\273\326O\"R\373\206\321\331\264\237T\365\343\264\345\365\354\023o\201\210W\027p\215\021\247uw\201!5\311\036\356\2773\205v\246{\b*[hA\374+D\203\251(>\004\246\240\310\306IuYau\357\235\374\t\217\210\036\356\331\n\206\331\022gbBB\204\335\225\361%>\n\266\324z\264\243\344^?\362T\237\233\002\210\002\321\007@_\037\007C\276\030B?C=\030*R"
+	.ascii	"\255@\321k\001d\202E\317Gh\250\347`\300\372\\\374\b\365`\370"
+	.ascii	"|B=\034\261\276\245\326C\2311\243\376\345\300\334\304\302\304"
+	.ascii	"p=\\\001\017\242Y6f\377r\036\272k\233>\360I\313\256g\021\314"
+	.ascii	"\n\302\f\243#7\003\274[\341\002?\270\273/\260\261_\027\335\224"
+	.ascii	"-5\261\365P\3549M`\370C\327X\036\f\303{\001\232k\035\031O\206"
+	.ascii	"\236\\\317b\361\314\223\021\247q\331R\3444\346\214\220B\243U"
+	.ascii	"v\304h\265\017Q\334\255m\215\353\003\235v\267\361A4\247m}\340"
+	.ascii	"\327/,\247\177u\0351O\316\320\036\256\316\207\304\351_\250a<"
+	.ascii	"\304\020c\210H\002\031\205IRh1\200\002\031\"\273\016\021\240"
+	.ascii	"5UC\323be\fcn\211\327*P\206>\225\210\345\346u-)\016W\213n\252"
+	.ascii	"A\332\007\254\233\317\021\356@\371\350*%\335Z=k\030\017\306\030"
+	.ascii	"\221\367\236!\215\251\371\001u\237A\335/P\311#E+A\223\213\343"
+	.ascii	"\244\207\301\373\322)49O\002\213 Ux\021\204\277\01776\001\325"
+	.ascii	"\222\3213\204\"!))L\304u\360\370\352\333=\036\332=\276\351\226"
+	.ascii	"\257B \307l.\346\315[\301q\f\354\275 x\020\rM}j\304\310\204\001"
+	.ascii	"W\032e\301K\377\276'L\024\033'\235o\302<3\021\221eZ\3704\267"
+	.ascii	"W\252g9\034\261\227V\003\222\322m\356\213\370\017"
+	.text
+	.section	.gnu.lto_servoMixerLoadMix.93.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`.\004=\032"
+	.string	"v\257\245F\240\\M:\002\352y\272\021\257\337\305\265f\261\323\373\257[\353\0360\307\024\3544\3528[\316\254]\312\323\252\225\273\254\310\233\013\221\342\235\243a\016\226\265\200\003\265\345\262\322\256\307\300\013\374\213\305\366H\310\336[\356\224\002\214"
+	.string	"\212"
+	.string	"\226"
+	.string	"\363e\373\321\276\356Jh\337\271\312;\265\356\320Q\251\265\002\231A\370\211\340\004\350\247\374"
+	.ascii	"\372i\232\255\346\274\246\372\251\335\021\224\234Z+l{P\013\270"
+	.ascii	"\344\335ri\007\351\f\345F\232\277\344\n\242L\271\341d\034\224"
+	.ascii	"\340\f\033@\002\340\216$\205\2555T\227\232\021)\200!J\237\241"
+	.ascii	"\322C\271WZv\\LR\016Y!\327\003\314{\217H8[\224Cp|\337;\003_\230"
+	.ascii	"\033\016\307#x\241\326\352x\303\335\270wn\333\210m\r\266L\020"
+	.ascii	"\323'\242\237\357]n!\203u\344Mm\257\332(a\263n\360\327\362,\004"
+	.ascii	"\337\024\243\234-v\331<[\\&\373\007h\364\222\274K\266O\317w7"
+	.ascii	"\317w\377\353Qw\370\247\033|4\235\321s\243\245\214^\031\0357"
+	.ascii	"\372\004\006\020\271\302\320U\253\215.\256j5\251\202<\352\177"
+	.ascii	"r\214Oy\227\262\344HI\341\371Mh:\231_\21431\207+XGj\255"
+	.string	"/\373<\277\347\327\247\355'W\2052\222\302\250)(kj\255?\237~\020~\006\022l\233\270\230\017\021~\265\026Y\375\n\204\f!\202\212\330K\035\266\2245gW\213]{7O\220\314\231\313\344\207\273\344\235$\353\263\253\025\177\016.\222\200\273\212\202\373\035\023\255\242\270uYk\255\022\\\237\275\222/\314\267\334\036\361/\262\fQ^\272\3202\006\250M\342Zd\353\303I\026,\005\350\334\332\304\250\035t+\261\345\202\242\252\022\241~oj\227Q\373\304\245\310\246\024\017!9\tob\263x\224\024\257\0375\234\264t\265V\nP\356[\341;}z\326\"\376\366F!;\214X\t!\331t\220\003\242\331\213\241\030\021\314\005\212\0232\025&`B2\022+`ACD0\007\005<c\021\033\202\271\230\315\206`/^\355K\036Z)bU[\033\270L\356\3412{v\265\302\237\207\341R0Eq\313s\351^\303\323l"
+	.ascii	"\372\241\371\260\240\351\314\\ 3\021\227\205\353F\303\355\331"
+	.ascii	"o\371\342\030\345lf^p0\215\207.\247s\362=<\261\205\236\205%\341"
+	.ascii	" \351\250\305.\357~\345\336\310\bxw\241qwoD$\334\270 \235\243"
+	.ascii	":\356\3601\036,4\325Z\024P\250q8\204\224Q\002c\024\021\221\231"
+	.ascii	"\231-L\007\320\002\231\242\255\003\021\2205Cd\264\304Zk\fpV\305"
+	.ascii	">\235N\330\347\202\020\023\200\007#\222$\214\325*4Y\02113\032"
+	.ascii	"z\354Z\037\320\354L]\353D\rXcN\224rq\231\343\310\351\017\271"
+	.ascii	"\263\363\007\341\360F\357\306\264\201\304\364\270\016\353\215"
+	.ascii	"\0356\342\273 T=\277\035\323Ix\222\330\325\377\302\210\312+\364"
+	.ascii	"r\036\363\313\260j\300\362j|aA\216\032\362\316?\224\2624\210"
+	.ascii	"h\211\273\350\302\347\3348\332\\\376\340 L\240\353{H4X9\201\301"
+	.ascii	"\273\2014MM*\346\263\357\204\236\n"
+	.text
+	.section	.gnu.lto_forwardAuxChannelsToServos.94.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\335\002=\027"
+	.string	"F\255\234G\300\330*\035pM\033J'\2665\202 b'\246t\241B\243\f@\001/Q}\362\367\206\250\246#T5\312\372\333\017vQ\324NtK\371N\260k*\220\025-\036\003PAWt`\323]\321\275\021\033!do)\223\f\204"
+	.string	"~"
+	.string	"\211"
+	.string	"\037r\"\264\223\013e\354\2011\372zU\200\265V\005\247\033a<=pTx:\177\nOw\227y\267\201\003\332\205\254\330\256\225W\304\244V\222\301&\030O\227\266\353\345$\216*\366\246\344\216\210\251\265\246\372\306\006\370$\277\223i\247\263\231\266\017:\202\237\025\335\256\347t\212\267\027;\002\354n\023\207\f\220\350\345\331gg\343\331\343\347\375\362\t~\245n\367s\026'\324Z\227u\273\030\337\360\273\353\332\335\016\273\r $\366:N\327\304\213\257;\335\277\302\323\367(\313\027 Cj\034\334%m\334@\273\307\301A\006\270mc\027u!\377I"
+	.string	"\363\332\\\350[c\272\357[:\371%\211\2744\"\357H\344\035\231W\234\274\341\344\245!\357\244\274\315\274<y?\340\024\005K\206-\265\276\b\226\251W(\021\217\373~\241\237|\357\276\364\225H\2120\214/\2627\"4{\305\325Y\215\236\025`\255\244\205\361\224\037\264\244\r\342\317\257\034\300\263\305\336\345\340\201\257\333\003\267\356\331\260\305S\323\016\3738^\251iO3\2713\335\263?\204\003\3268\310\363'\037\306Z+\316\236\350N@\204\310\311\tO\273%\364\210j\034\334\005'\265\200~\371\n>~Kp<\033\007\273K)\267]7\320B\t\271m\372806\016nMs\337\204\321\371\222\031G)\032\372O\265\332\331\tOk\372F>\233<\3712\346m\352\017\345\316l\353Jfc\255,\036\354\221<I\262U\214\305\322@\022\221\303\262U\214\305\322Pb\345r\351\360\250"
+	.ascii	"\250X\215p]\330 \213\301Z,\323\252nb\257\024\260U,%\343\331i"
+	.ascii	"\225`\245\\-\035\023)\025,\226\2721\260\257\023+XJ\366z\301R"
+	.ascii	"$\262\366\266\341D\312\225Z\333h\003-\204\034\215\352\031\r\027"
+	.ascii	"\254\340\245\366y\371\267\340B\203\027\364Q\313\f/ljR\373\354"
+	.ascii	"Q\2044M\241\013\013&\263\243\036\233\246\t\034\311\311 \365\250"
+	.ascii	"\013\f\345\202\330t\251\307\246Tr?l\034\374\254\265\326\271\340"
+	.ascii	"\245Fu1 p\002\241\272\353\235\322\356(\262h\376y\241\266\363"
+	.ascii	"V16:\222k\177\250\306\264\006\325\226\203^\325UN\b\344u\264\252"
+	.ascii	"\353\354\013\376\017\317\262P?\032\340%\361\220E\331\265K\350"
+	.ascii	"\3550\331\300\204Sy4\036R\002\365\253\300\006\243\255\241fO\303"
+	.ascii	" \234\353\030\325\t\207\204\256\334@cTK\350\214 \343a\202{Q\212"
+	.ascii	"@[\250\307\357M\244s\231'"
+	.text
+	.section	.gnu.lto_updateGimbalServos.97.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\301\001-\017"
+	.string	"\026\234bD"
+	.string	"\221(\035\331\205!\242\365\324t\027\273\214\261f\262\006'\350\200\312v,\256zZ<!\360\332\247M7:\343\376"
+	.string	"Rv{\255\3174o\241"
+	.string	"\002\202\256c,\266\244|\224p\375O\255\374\226\354\275\211\224)\005L"
+	.string	"K"
+	.string	"R"
+	.ascii	")\376\231\034\205\033h\207\266\211\255\035\252f[\3256p\300\364"
+	.ascii	"\227\023\357\234,\255\027s~\037\027\310\016m\262o\374\0331%\211"
+	.ascii	"\r)\230\035s\316mE\334t5\371W]\343\251\240\\\245\2029\247\325"
+	.ascii	"S\351p\357m\017\260\235\300\326\007\001p\263"
+	.string	"\377N@\207\213\007\013\333\357\246E#\345:\351\313\376P\272!\354cs[l\251\356H5'\2525\250\336H\265F\252\263\250\226P\035\377\362c\252^L\255\252\376\007\200\0175\034\310\230\223\303\253\307\234\201\254\022\266\277\2021+\017\272W\035\232h\331HaA\351\313\235uq/\307A\"g;\373\224\007\324Y\274\005\004\337\305\021DD\342!ga\313\353\304\212G\265\375\372\037(\244\367,@\303\242x\263\332~Rp\\\305W\220dsN\004>\314cD\276\313\241+\214\364\336(r\361\001\031B\023J\0260(\221:\321\210\307\240\020\022\207\241\013\221\266\022\005\022\221\205\221\255D$a\264\201:\322\026\022\300\334\205P\267\2258\256\333\264\357t\3253\031\0203\247EY3C\017\022\263\325\310drw\375U\\\271\262\017\3431X\217\373\225\356\356'\345:\211\330\006' \240\002\0312\352\001G\0249\264\030\251\314"
+	.ascii	"\326\205\277\030\322\362\240 \270\n\034\3137f\\\314\355\204I"
+	.ascii	"\246\310\310lS2\254\340\252\363\230h\317\260\345\251\335/\262"
+	.ascii	"\343[\273\360w\244\333b\270\n\354Z\0269\311f'+@F.\t\270\351\204"
+	.ascii	"-\251\2168\370\271EK\237"
+	.text
+	.section	.gnu.lto_writeServos.98.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\341\025\005W"
+	.string	"\312\217\030\037I \024[\031\016\301\003\360v\"\260SZ\\\020\002\305I`\320\264\323\247\363X\353\342\372><\254\rY\216h\023\236\302\270\266\237\\\246\343\211\254\273F`k\325\365a\234P\214\360"
+	.ascii	"\214\226\376c(\365`\204\3356\331{K\231R\335\001\261\001\370\001"
+	.ascii	"\352\243RmD\244.*\325&DupT\003K\265\371S\023\225\352\362\247"
+	.ascii	"\376\235\356\036I\265\3701\367\216j\025\325\277\nPx\352\262\346"
+	.ascii	"\316SJ\237\241\223n\214[;\335\217\347\227\373\307\\\264\357\022"
+	.ascii	"\256\307@>A\024\262og\327\245\t\202\312\334\020^9\207\362\350"
+	.ascii	"\335\261\343\225C\304\311\370u>\347"
+	.string	"t\206\227\263\234\262\213\254\\\003\304\017y\347y\036P~Lq!\371Q\274\022\031\207\216\\\334\020go\362\264\221c\363g\215\24035rp\201\316\320\340\231\031\t\311\275\314\337l\240M8\031o\013\204\300|\264M\260\201\037\213\356f\240\r8`\3701N\312\223\355\227\306\206+y\347\371V\365\321T\345\307\241\215\367\267-\347\201\240\022\346C\241\363<\257VKY\226N$I\232\026/\276\335F\342\360QPONML\302%\245$\244#\243\"\023A\240IT\376\310Q\\\251)\035\372?\254>I\210\225u=J\314\241\304\204\321'\361\027\205\214\317\355\310\332D\027G\004\242\362:.\352\004\346MkgZ\363B\326E\205vdk7\350\022\230+a1\263\341I\"\025\032\036\026nGf\203(\254\233\341\317\221D\252<!\b\335\216LM\024J\351\"v\267\032\364H\f\362\371B\245\305\0246|\236\007M\215"
+	.string	"\310bv\345EfL\254\371\313\202m\200\"\221\231\020=\334\216l\213\210"
+	.string	"\240.e^\347"
+	.ascii	"x!\233\242\346\017+\213\031\225\023\335k\313\313\270\277\f\213"
+	.ascii	"\331\331\177?\2548'\240\017\007,f[N\272\360\261\250\f\312\023"
+	.ascii	"\025\201eP\304\024n\327(e`\272T.\245W>\345f\005\2061aU\314\262"
+	.ascii	"/\262<\317\363X\310\266\224\372\303:\317\323*Vfv\237"
+	.string	"\270\255Ll\347\260\227\204\001\343x\313!?\022\2650\247\220\240\353A3e\234\"\251\366n/\t\235\271\373\247Hq\251\326\032v\366\245}\266\206)\nNn\340\300\261O\243\366M\203\302\027Q\004R\227\353L\0370\3353\223\332:x\350\305t\215\346\324\271\237\337\355;\342\350\272\364\320\n\372\2456\355\320\215\325\245\207\374OY\277\2147\3129{z\026\251]\306\033\347\344\234\236E\362\371}\306\033\r\t\227\360\r-\371)\344\353\031\341\031\344\0232\336\270\347\254\b\t?\2112L ?Ot\303v\306\360\307\007d\274\362\317\"?Z\305\31615\266>\266\361\306>\271\363\354:\232\212\235\004\210g\025\345\263_\304\215\310\362\271\370\007\020\275\030\020\362\343w\2143\345\314K\373\2020\2051R\233\210\226^\314:\247\215\356k\273\354\267/\3354\373.\216\200\302\346\245\3016\325\\\246\372\003S\335\244To1\t\252\227"
+	.string	"\325JL\265\007\246\272\203\240:\tP\215\304T\0371\325F\202j-\240\272\210\251&b\252\207\004\325B\200j\016Lu\020S\275AP\r\004\250\326\300T\3770\325>\202\352,\240\272\207\251\346a\252w\004\325:\200\352\fL5\006\246:GP\215\003\250\276\300T\3370\325\026\004\3256\200\352\nLu\rSM\201\251\246Q\252'\b\252g"
+	.string	"\3252Lu\fS-AP\r\003\250\216\300T\2770\325XA5\004@\365\003\246\332\001S\335@P\315"
+	.string	"P\275\200\002\t\264`\261\302\252\212TS\2418\036\271{J*\n\352\311\251T7\215j\246R-\f\252\227\200j%S\235d\252\221\314\237{Z\223\355O[ub\211\366y.\206\231\223\002s\346\205\242#\353ed\217\354iD\313L\221\3252s\310P\221\275\031\017\366:X\017\nu\220\344\r\311&y\033$\b\311\376m\217\216\t\036H\314\360\035\313#o\207\216]q\177M\006\253c\r\240?\031\354\327\374\350#^\005\351c\177\024\341#ku\314}5=6K\215\255v\272G\217\366\330\253\tBw\025\344\006\033$\317\006@\3404X p\266\312\251\235:\327`\017Gd\216\nr\310\022\2013D\b\032\016V\b\032[\333\350\0337\346`\217F\211\266\340\r6Sn\301\336Xc\201\2156\025\254\2156i\340*\330\267\301"
+	.ascii	"\215\336\360\034\213\201\231\0348\330\\\2608\330\224!s\301\236"
+	.ascii	"\r\036\235+\300M"
+	.string	"\263\021\025\"\026{\26564)\035\323k\353B\264b\320\027>)\217\225S\346\016g\372\274\200\272\256/\323\352S\313bD\002\217\233\032`(X\032[c\007\nV\250v6\301\322\330\207\361\375\326\352\023l\0237J@1\3645c\313\365\357\310\330\031w\354&\372\305\213\214\375\035\247-\367\200\302\370\356\204t\332\025;\016\202\2026\265\277}\235\213a\360\320\t\343\363\322\276\245\212\313\263B\264i\027\326\340\305K\371b\355\350*H\254}\301\005\013\202\265\272\037\367\300B\020g\253\026U\333\">\260\217\213\221V^\005)\301\306\300\"\001\2147\021,\2147\266Z\321+h\033\301\376\315\021\346\234A?\007\266\312\305\220\270\n\262\201u`\037\306\302\013z6l\033\212\031\272\r\335\310\217\r\354HC_\333Y\ne`\253\356\307y\001#\305\223\355\362\002\313\300\256\200\222\3678\266\232)\0133\312\025b\220\037\027\330\307\371"
+	.ascii	"\202\370\364\342\274\264\217\334\264\031\244mMA\245\314\020n"
+	.ascii	"9\317\323\205U\005\215B\303\347\362\3215l\330 \037F\222\344$"
+	.ascii	"h\025aB\3034\021\026 l\215\300\245\005\302U\bH\216$Qb\344\212"
+	.ascii	"I\022!K\256\210p\201p\305\"\312[M\264\270\256B\330\332\342\272"
+	.ascii	"\002\276y}i\260\217<t^\373\025E\245MU\230l\223\227>sa|Ivs>@9"
+	.ascii	"I-\023&\277\235'\223\234\247M\363\353>\200\235&\005\326J\343"
+	.ascii	"\242\33017E\255E\245]\2510G\241k9\370\371/:-I\231:\300\031\202"
+	.ascii	")\201\265(\224\332\250\035C\261\n\354\353.\356\335\321\321\270"
+	.ascii	"\246\024\272\264\302\265\245V(\265\t\254\bHi\227\366\200\240"
+	.ascii	"\344\305\260W\224\026\310\247\215^\234\365H!D\004\323\260\215"
+	.ascii	"L\332\335\341\314\035\322\036m\322>\354l"
+	.string	"a@\332\247\2713\332#\024ku\243}\"\342\312\205\r\213\013\302;\221E+\225C\022C+;ex\345\204\034\376\240\2159O0\004\276\307\306\332\263\241\f\343\236\224=\201\306\234\347\351\342\243\327\205}a8\3030m\250E\215\374X\264\267\373\025\\\020zd\242\350\t\261\264iV\244\252\277\356\245\036\234.IU\037w\314\"\022\324jR\213\335\035\363\225V\312\241\266\305\3660B\t*5\261\366\360\206\341\032\330v\031jM\254\001F\004B\221gMK\322\246y|\026\031\\\335;s\007\246{k\026\024q\310\002\327&@\224,~\220D\243\247\325;\267(A\361NHU1\267h:\355y\200+\365NH\275\323\201\217T\266C\355\230>9p\207\f\240)>\374B\332C\035\206<\350\305\200O\301\316\024:\260\273\037m\232[\210\025Y\355\325\312\240M\255\370\211\035\323+\323\245\250jJ\305\374\351w\302\334\013"
+	.ascii	"\016\316!\243\023k%\203m\216k\305>\330&\313\265(|\260\265M\210"
+	.ascii	"\326\352[K\326\\\177N\311.\231\263\225\354\223"
+	.ascii	"\005S\262\001\201\267\250QL\344\03034\"\"\"I\222\2445\361\005"
+	.ascii	"\304 \245\314\254\003\021\2404\205\024c\212dFAAA\222\f\273\001"
+	.ascii	"\214\375I\201J\266\320\300\006Y\257#\177\343+\2233\022+ay\211"
+	.ascii	"K\030\006\270\232\3427\365\322z\255\326\357\331g6\272\304\035"
+	.ascii	"\017\364\242\334\212\201l\026\222i:I\\\212\245\366\205\032\260"
+	.ascii	"\262\252+\340\260\202\022\2109\254\312\320\213\244e,\244\261"
+	.ascii	"\207\005\350l\360S\202\232\022,\361\243Z?j\230\036\275\013\004"
+	.ascii	"d\257\334\020\324\253\332\024\202\317R]\213\301\362\356\364\236"
+	.ascii	"\203m0v\017\237\262\017\252\326\022\003\026\364\247\344\"_\207"
+	.ascii	"LUz\361nbXo3m\307#0j\3219\256B7\3663\260\245\210\356R\002\305"
+	.ascii	"YA\323VF\323\323(\0014\037\325Y\241%\215\322\322\215\337\301"
+	.ascii	"\372\260\227;r\225\001yb\0164\033\351\033\315\243)o\266\353("
+	.ascii	"/\223)4\321\217G\356J\204|\213\321\3165Y\317\313\335\311ex\334"
+	.ascii	"\265\275\215?\307\235\225R\264\330\331\013\356T\240o\314\275"
+	.ascii	"\275\257\266"
+	.string	"l\227\3033\257.\024\374]8\350+\343\240\275%z\2668]\274\340g@\256n\344\031Lkl\221[\305GCm\037I\016\256z\206\335\310\263\230\265b\363\334\351\370i'm\261\026\033^\360\247B/\276D\202\007\363-\024m\366r\345\305\310\272\013>\243\341\356d\262\004\356\332\026\215-\311V&\n\374J\210\272<\364j{N\034\346<\310W\004]\306f\177\331A\324\033\274\376\247v\301@/t\315\235\270R\234\2439s\223]#\277\016\237\"5$\032<\"m5M\322\371ls\036\330q\311\237\007\311\256\005\2773=\177\341\377\255\203\326\335\242\267x\236\367\275\025R\034\241\007\322$\246\275S\305?D\025\310\223\036\361L\336P\023k}\032s\366\256\213El \007\022\211b6tF\370M\317J\312\n\345\366\226Pt\220)[\256\353\300\266\232\nc\212\262G0\242[\332\220\215\020203\212\007\352wJ"
+	.string	"\037\t\376\336\315vp\367i\340$\211\204\307z\023O5\n\035\362\036b\225\017\246\244\217-\245\t<\f\304N\004\310`UpR\023OB3\241}\034\201\274Cq\377\020`\231O~\001UD\351\nr\022\355\304\033\005\220\265\234.\200\212v\001\251f"
+	.ascii	"\322\372\345\246\225\331~\025\307\327\371\021\375\223\303\213"
+	.ascii	"\312(T\311\032\373\264\354\350\377\370N\344\202\210s\275.\033"
+	.ascii	"\\9W4\366)\306\r\3304\233\306\203T\271\310\3656\317E\211I\024"
+	.ascii	"\216\244\\J\323Hod\260\227\240\236\262d\013\200#\034'\332\220"
+	.ascii	"B}\033\340\252H\313\021l\324\2213\270\0336\320\207\300\023_#"
+	.ascii	"\304\"\337H2 x\342\216\026\341)\3305\2653\323t\362h\001\007\366"
+	.ascii	"w\034x\340\274\302\317\t\351N\037.\273\231\331\033\321h\225\337"
+	.ascii	":Z%\330me%\252\020\024\004\265W\353\225(\030c[\255\006"
+	.text
+	.section	.gnu.lto_servoMixer.99.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\177\036E\206"
+	.string	"\272\335l0H\020XKg8'\027\274u4E\315\031\036\352\361\320\341\231];\364\364\037\303\202CT\304\b\236\323\177ta`\331\036k\213\007Tw\314g\374\354\354\354\314\361\322\337\307'c[N\017\303\351\232\tn\232\200\232\210\220$\245\f\352\002\300\002\021\003{@\332k@\332[\200\261\227"
+	.string	"c\357"
+	.ascii	"i/S\332\273d\354\325a\354\315\221\366\342H{o\030{m\020{\0050"
+	.ascii	"\366\006\220\366\002\220\366\326(\366\322(\366\316H{e\240\275"
+	.ascii	"1\320^\245\2647)\355\205\201\366\276@{\221\322\336\243\264\327"
+	.ascii	"\205\261\267\205\261\227\005\332\273\202\330\253\002\3555J{\213"
+	.ascii	"\202z\211\322\336\241b\257P\261\327\230\366\006\025{\323bo1\355"
+	.ascii	"E\213\275\304bo\212\264wX"
+	.string	"\354\025\246\275\301b/0\355\375\025{}h\357\321\336&\3662\273%U\221\343\202s]\247\354\005Z\343\374\340\276\360\0343\034f7\3467f's\022\314i\230\313079E3\223\211\273L\334\362\366\247n\337TS\207\347\226\351\3508\261\234\375\311\321qZ\246\263D'n\342\t\r\035\007B9\033\244\243\023'\355\316\201:&\034\267\303\266#\332\020\227rd\353\272\362\022\314f\227\270K8n\203\344\2260a\271=\016r\313ex\315.\r\034\267A\2726f\226\215\340#\030\t\206c5KL#\2454e\\\223xt\020[W\265!\005\354P9\t)\341*\026t\373\202%\210\263\211s\207\273uUS\340\355\250De\\\253\246d\341!\344\337\031F\243\262\333Q\270\"!\274\372\302U\200\220\177\306f\"`\233R\225q\255\3722E\214\206]\"\377vYmy\215\f\027\241rs\343\204SX\3026\247\325"
+	.ascii	"B\376)\371\206\234\266D>c4\225\231N\204+\022B\2020\273[\327\025"
+	.ascii	"\007\377\366\206\220\177\034\207\215\200\374Cb\" \377\324](X"
+	.ascii	"\rl\3457\262%\333\237u]\231\376\025\303h<Z!\373\324x\207>\225"
+	.ascii	"e\304PJ\202\361\002i\306\221\213\026,V\2500*\"\032\0222\006\245"
+	.ascii	"E\224\230\202\306P\030\004\376|ou9\215e\004\202c\2255\3052\320"
+	.ascii	"\3049\353\030gXi\210.,\211\330\306\225G\213\226\031\206\2216"
+	.ascii	"\206\305\354\027s\260\322\350\320\032\351\f\317\360\005\237L"
+	.ascii	"\361\302s\260\334|=\360\356\340\270M\207>\362\322\032\303.Z\004"
+	.ascii	"\177\264\261\260\017\236+y\264h\2311\0132^\361\205\rY\253X\232"
+	.ascii	"\345\321\242\345\205\215\202X\343\245\213\210\272\360\220\357"
+	.ascii	"\006W\233\034x\016\326\017>#9[\236\3406]Z\b\210\2606\006\201"
+	.ascii	"\361\320i\360\207\026- \270\310\245&K\243s\260\312|JD\236\203"
+	.ascii	"\205\245m\207N\301Tc\230\206/x\003\326\034\317\3012\302\327#"
+	.ascii	"\017\036\035x\215c\214am\3650\206"
+	.string	"\227\326\025\026\362\032\377\276X\345\321\242u\205\203V\030\250\354_\232\265\364)\255\353J\314z\322\276\024YV\370>\243)^\254\322\254*\337\215\273$\372p\032\367UV\262;\370c]\327m\253,-\336\032\274\333k\273\233e\027i(\315\245v}\251aa@\376\035=\210\b<e\314\240\013\243\026w\301\342-\376{S\352\031:\213{pGn\251\347\203{\343\004\276k\305\215\336v\3156*\276B\355\322:\250A\b\327\265\212\307\366V_Q\277\b\241\202\001\003\344\237\212\363\233\035f\321\215\316K=\252\336[\352*\307\316\241\251\250C\250b\324\262f+\265\f\310\277\242\363\b\343a\027\032\327\257\tHt(\031\255\264\262\212\006\334U\323\036h\266\"z\312\004\2308U\237\332\241\013}\350\276;\306\013=\350\306\206u\"\320R\2000]\031_\234\243+\013\322\221>\350\276\274\342\323\007\363\226\353\364\241\243\225@\016"
+	.string	"\353'\305\007y\315=\231(\361\250\223\301\\1\"\316\272\256o]\251f\2448\361\301;\312\261d\004=\265N\006\300\326u\345\321+\020\246:=\336\023B\301\220!@\376\245x\220r\256\2149\204\006o\214ox\341\207\367\335\341'\003\302\3338 \377\204/*\351<\203:\200\017\336\227\247\203\373\360\001\276\350E\247\f\356\367\264c\020\030[\351\361\375w\037\037\345\033\252\336\313\301z\326)\\\327\265\307\362\035\347\271`\031\b\376m\006\033l\360b\0258O\270\032oV0\177\327\2429\247\261pN\323\256\252\361\266W\016"
+	.string	"\310g4\337^n%\331\t~\242\3112\020\333\301\007\315V\037"
+	.ascii	"\371\307\017z\275ynQ\365\336\256Z\262\337"
+	.string	"\265\313=\300\360\240\330s\331Es\306L\231\265\246\032\223\335x\031\215\337\330\311\313c\314\3128\t^&\3434\274,&LQ/\213y!\352\345.<\307\313aB\275\374\325\265\345\n\303\341e)\\\206\227\257\270\311\313Vi/G\201\2624\366\262\362\t\332\313Uh/'\321^\246J{y\n\355\345\225\250WE{\221B\275N\322\336\032\214\2754\030{g0\366\036\323^\031\320\336&ho\fh\257\024Qo\024\332\313$\355\205B{\227\240\2750\240\275Oi\257\022\264\327\t\355}\001\355u\001\355m!\355M\202\366\"A{Y@{W@{\217\244\275F\320\336\"i\257\nio\023\332\233\202P/\021c/\n\306\336\023\320^\023\320\336\022\320^\022\210zG0\366\212@\354\r\301\330\013\002\332\373\001\332\353\001\332\333\001\332\313\001Q\357\006\304^\r\322\336\f\210\275\030\244\275\027\240\275\026\004\365\016\031\352\255"
+	.string	"\355\245"
+	.ascii	"\355\235@\250WH\332\033\304\330"
+	.string	"\013\304\330+A\332\033A\332\013\201\261\367\001c\357\217\264\327\201\264\267\001c\257\017c/\003i\357\002i\257\002\306\336\004\214\275=\322^\004\322^\036\306\336\035\306\016s\212\b2r\025\316cdF\212\374wg\251\247u\024f\251\360\341W\334\023.m\372\224c\322m\370\rH&\\@\272q\023g\245\207\311iGa\323\207pTdO\341<\206\347\\&\017l\311b\3331\221\263\026$\234[I\001\020EM\326\200B\344C95(\234\321N8\ng\245\230\t?\341T\\\302M \341\035\274\204\003\353(\307F8\tr\256|\362\252\021N\364\343,c\212p>{\337\t\341 \\\204\363\230\207pV\352}p\020\336\202\215\216\007\377\340,\342\224f\035\234\203{pV\216%\307\274\203\003\353,\36568\007M|\nY\207\251\356\253\232\\\002\333\333\340D?G<5\030\363\346\243\024\313\340\032\320u\036\322\211\377"
+	.ascii	"'\020\240\f\316qa\027\034\203\263\235~\"\235x:\273\343:\3437"
+	.ascii	"\273\310\271\376\203\274\323I>\004j:\317\372\264\037$\036d\036"
+	.ascii	"d\024H>@\376]p\004\354\260\230[p\336z\322-\365\374\364\036\251"
+	.ascii	"\003\242P\223Kz\310\376\223{{2\221\317\276\223\332\001\206GM"
+	.ascii	"2\325A\301b\316j\270\206\334[\031\263\003\245Y-\321\326\342!"
+	.ascii	"o(\232v\020t\005\337E\346!\367\232\255\206\\\211\202W\360\037"
+	.ascii	"\237\245\336\004\247\340Hw\204|\202#\261-\365\270\312\227>T\210"
+	.ascii	"R@!\207j\332\251j\274\251\266#E\243\256\353\324dR\217\271\246"
+	.ascii	"S\237,\325(Q\200\374\023rnc\033V\214x2\337&\367$+\305\273\226"
+	.ascii	"i\234\313\006\331\b\331\314o\027\304q\265N&\343\371\301\2122"
+	.ascii	"|\027[\235\315|\206?rJ\256#pw\235\330u\023\307 09=G\275\262A"
+	.ascii	"\2352e\215k|\261\375\331"
+	.string	"C\325{\177\021GP\301\"\f\002\207\b\344A$8\220\b.\201[\273i\023\301\207_ke\020\260I\361\300!\370\361\007\034\370\2172\255\204\234\003\317\006\342\206>\336"
+	.string	"\003\367\261\300\031 \323i\340\026\370\320kO\001$\204\t\\\201\036O"
+	.string	"\201\367\350#\336\020\370\320K\357\311\303-\310g\307y\034\360\035\007\376\2003f\f\370pN\257\254\2002\3007\002^\300"
+	.string	"'\340\276<\246\017\320kM\246\017\253\344=\227\310\374\334\350\370R\216\353\370\317\215R\f\307s\2441q|HD^\031\334\2153\337\343l\374\206"
+	.string	"\017\3406\304\222fe\002\234\007"
+	.string	"\017@\f\021"
+	.ascii	"|\350\025\350\tW\3434^c\214\332\272\252\250\232q\032\017\262"
+	.ascii	")\305\222=\326b-\204\232\205\203J\205\n\220\1773N\\\263\347\t"
+	.ascii	"'\303K1\306e\374|\272\213\233\013\367\026n-\254\024#\351J\367"
+	.ascii	"\261Y\351.G\037`?\250[v\324\205%="
+	.string	"\310\013\317\223\t\243\2778\355X\004Cy\343\254\364\2748\214?\317\200\376\236\032\244\244P\226\374A\372\256\212E\315\322l\365\342\276u\353S{t\244\373\336\226zT*\017\335\303\321G\235\352C\363\240n\341\301\277\355,\001\213d\211\t\222\250&'&%ONNOE\\,\022\247'\250 F\240\232\232@=\005y\362\340\205#J\2244!)R\024u\204\005\250\246(\240\323\023\324\n>$QF\2224!BT\222\304\351249=\tGI\301\240$\311o\213,1y\212\001\352\b\023\246($,$ya\005&%I\232\234\230\212@1aZ:\332'\030\216@1E==A1\021\325\250\370\\\226\210\2258TO\256\023\337\272jq\200\231\314i,tW\304\235\214wm\220\215\022\207\371\355f\340`\226\"\245\277\240\355a\211\361\256m \370p%\361\225!Y\024P\300\340-\3473\277\222r\016\363\031"
+	.ascii	"E\371\272\035\203\300\320@9G9/\241p%\317\234\227\\uV\372\316"
+	.ascii	"\0029\227zJH27\203tbH\026.v\332\312\\\371\020\214\232\247\233"
+	.ascii	"4+uI\353$\314\327\336\344-\037v\335\2042?K\275\255sC^\023F\330"
+	.ascii	"\371\353\255\327l\236\214\224\360iWC\262!\333\220g\220g\276\316"
+	.ascii	"rv\302\300\270\251\275x\327\356\361\023\220\303\316b\007?M\273"
+	.ascii	"\260\367\334\"\335~\206t>\312\016O\330\2151\233\353r\246c\237"
+	.ascii	"\0208\274=9y\256z\307)\315\2508y\240\033\345\330\324\231\212"
+	.ascii	"\354(\0243u\037ap\352y}\337y\373\020H\247\t\314\036\346\354:"
+	.ascii	"\231{\0300H<\3529\016\343h\243S\326\005\351n\306\271,\361\007"
+	.ascii	"\027\\\346\267\243\201\343\352\352"
+	.string	"\310G\340\344\310\213]\b)d\022\3104i\200\374s\362\025v\266|GW\3472\3470\177\366\032\007\027\357\242\303^\216/\300\202\3406n&\332\023\\g{\326\315\n \253\026+\372\314F\305\2223\263\206w9\032\201\375@\303k\230\341\307\323pVr%\327>\303\357f\251'\303\217`G\341\277d\270\021\363\354\345\274\326\007\220S9\226d\001\303\233\274\001aU-W\274k\233x\031\345`^\303\025,\311\226\316\242%f/\277j\302&\20671\223:\223\307p\2448\345X\324\245\342\336\205\254\303\201\300\270\250I\356S\267%\352\034(\214\tu&o\301\346C\017Pg8apTg_\202v\030~x\200\234K\025\357\2522:\027\244\034\220\305\256B\323\216\325\304\016\214[n\231\235\313\236\236\203\331\354\300<e\240\344\232E.\361,*\332\004Y\316\224\370\016\307\202\304\303kX\355\274\206m$\345\236\314\247"
+	.string	"\350\3324\351\332\364\240\024\275kG\2502\364a\017ry\264\340\021r\341\334\374\325\256\222+[\315+\261A'\227\244k#z\322\330Jf\350]\353\324\206{\213\312\0370&\232x\341-\334I\354\205\037\275\271pn\301\017S[\036\037\204\022@\023\323|S\325x\306$\257r\254\001F\205\237<I\021\237#Gr~\362m\345\036\026\276\302\221\374\307\246\344\"r\026~\364\246\302W8\033\371\221\263\030\036\335\302\231\022\202s\250\342\b!\020\2420T\210hD\222$\3110\007\342\n\020\b$\201\032\306\362\006\022\300\2041H\223\020\225\220h\222\024\322\001\257\205\340\034w\310NT\322\212\351\002T\206\377b\022\r3zw*Q\2041L"
+	.string	"hvd\037\222\241\361Z\253}\252&/W\344\013\002/\350\203}:*$\027\2364\260\353\f\002\350\371\307j\177\247\217\313)E\217\207\305"
+	.string	"\230Qc\240A\304\317\030\332q\327\240\351\267\350/\356T\037\341\006:Fj\223\023\226\244>LsJEF\300W*\352\026\377W\374w\300\005"
+	.string	"\306`\311\277\344\221&7g\033\177ct\304\003\337\016\335\005\343\206\306J\375w'R\332]\254\214\223^\326\004=\233\211\252D\253\203,\205k\315\353\tc\300-\227FIi\332\"t\253\365p\252\204\370J\324\321p\337RW\r\242\2266\300\274\232\"a)\25289<\325\225\356"
+	.string	"\327mJ\256\220!\007.\007@\204+\215a>E\325`b\255\216\207h\365\\\004\325\300v\201$\206\243\013s:\016\356A\204\234B\344\367\027\036\221\021\340N\177\320\325\317\214\224,\212\365\003`\3522t\214\317\307H<p\214>[\375\311`'=9\344r\232\271\222\354>\227wj\"\021\273hjg<\322\210V7c\327\361\364\315\2329\247\032C \262\306\353\006\270\347j\200?\237m\020\n\274\315"
+	.string	"\254!\366\251\235m\313\002N4\021\331\252\326%t5\202\244\017\337I\037\207Q{\236\266$M\366\013t\026\3720\331\030\276\334\021H\037\255XJ]\326\202n]\245~F\030D\240\267\260\240J\367\250\205B\242w/\375m\201\202q\231x\2726\253\303QCL\235\334\016\250\035\203\234r\204\262\271e\361(\321'\021i\276\237\217\023\325\243X\266 \211\003\245\213\005\250\333\372\216_\205\353\256\205\226h\252\n\004yC\352\"!\266\350]1\334\374\241A\335\231w#\217\3572n\343\341\316\026\003N\002\203"
+	.string	"B\f\374%eZ\313\372\001\341I\370X\215w\026<\020v\212e6\\\352\267\305\346\340\320\017\b*\360\362`\225=I#8\334\211&8yI-z\037%D}\235\352 ^\033`\250A\300M\001f\367\235\022'\374\367?E\324\223\305\027\231\030\256\036\020P\311\275\337\013o\024t\356 \016y2"
+	.string	".\335\256\324\352SV\013"
+	.string	"\244\371\215\256\274\202jE"
+	.string	"@\355\337\023\252_u\033\363T'\272\356Oj\237\013P{\027\024\037\3053\003\302\0358\211\3623x\230\332\020T\030\334\225\001\b\006\262S+\250\335\227\263a\247\371!\201g6\264$\257)\216\300\261\353\231\201s\323\035j\f"
+	.ascii	"\340\177I,\035\206W\037k\222=\211\262@\360\nL$\242\026\271\316"
+	.ascii	"\305\007\"\345U\030x\322LRy2l\b\345\366\275\275\216/4\016\tl"
+	.ascii	"g\243\0028\201\246\n\345$\203\007\246G\252\025w\\\373\"\245|"
+	.ascii	"x\035p\035V\322`\260t\b\355\200\210!\003\210\027p\341\351\241"
+	.ascii	"\205y\360gJ\231\343\201\362\336\375=J\272\032\b\264\351\211&"
+	.ascii	"x\307\227\\\365\342i\031Z\016\206Nh\320\355\301\0271\250\300"
+	.ascii	"\223\\%\221s\200du#\350\255\360\020^$!(\372\375*\236\325\243"
+	.ascii	"\357I\335\342\t\313\207\267\321\224\253U\240~\257&\322"
+	.string	"\016\250\306\300\345\340\024h\317\3224\224F\215T}\003\365\001w\302\330\361Qj\306\253\2270\354\3114\212\377~\206\213 j\246$\300\241\325\357P\002m\031\016\252!\227\371\027\367\211\375\264\002\336\366\367\240\013\004v\251\177\f\377\372\274\3444\331-*R\242r\022\360j\246\274\266\221\207[\007\354AS\016"
+	.ascii	"\236\226\310\243\301!\254\f\276\255\260\254\306\221,\377\361"
+	.ascii	"z\310%s)\265\326\027\373~\n\t|\016\262!\234\254\371f\310\340"
+	.ascii	"\311\350`IScV8N<N\225Lb\350\3321m\224\357@jQ(|B\214g\210'\246"
+	.ascii	"\241\364m\370\236\271G\225\350 -U\237X\001\304\"3\337\3249\231"
+	.ascii	",\367=\201\017\354\036\366\320\343\340z\347\347D\334\317f\264"
+	.ascii	"\202\304mx@\245}x\\\366\344p\037\325\321`\372\352\365\271\335"
+	.ascii	"\027\023\204\256\205j\037:8\262\253\025@\037\324D\235\037\n\350"
+	.ascii	"\327\202\264\242T\372\251o\321tC8\236\rL}\371Tq\335^\326\237"
+	.ascii	"\333hm1\021\272'\202\233H\324\371$w\2114\006R\232\004;\001\331"
+	.ascii	"\315\304MV\242\275&\247\206\347\250\r"
+	.text
+	.section	.gnu.lto_servoTable.100.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\004\021\275M"
+	.string	"*\205\024\035M0\214\333\031\003\277\376\313h\"6o\271\254 g\260\325-\035\007\005\240\335*G\237\363V\004\324\351\331B\237\371\213n\270\347q\2433v\225c\276\204o!\226\207\300\254\273\206\341\334S\350\307\251\033\257s\234\231g4\244\024\271E\356\224R\n\260\001\237\001\307\001\2553\205\326y\002\353l\264:\027\261\316D\255s\261u\036j\235\205X\347\240\325\031hu\376Y\235\211\254\263\317\352\334\243:\363\254\316\355\352\314\256\316+\353\254\256\316\303\3259U\235\321\241\2630u\376\324\331Q\347.\240\237\"(\277\306\312\274^\363\335\032,\341\275C\343\306\272\331\375\354v\353gn\3563\035\207\244\341\230\bl\t\f\216\373N\222\216;\215\373\255\3074\031\267\335x.\351\252\371v\r\235\3108/"
+	.string	"j\243I]L\033\025\266P\332h\333\223[\314\032\333]\213\345\255\201\326\200\337)\007\310\235A7\271\327\270\004\n\267\325\224$Q5\337-\034gh\322"
+	.ascii	"\223t\032\257g\330\322\224i\357\373&i\033-\201\"I\253)Q_\262"
+	.ascii	"\341\030\275)q\336\267\251\324(\207P\033\035\266\3542\363u\023"
+	.ascii	"\354\035\216\301a=\001\337\3675~\005\254\266\260\331L\344n\027"
+	.ascii	"\021\025\207\204\202\200~\210>=<-\273\252\303\024\025\276\273"
+	.ascii	"\334\031\222uT]$\034:\341b\323x\\cB'\277>)\375\266\305\2110P"
+	.ascii	"\360\244K\027\271\364\220X\034\027\027\n\352\252.\r4|\272\362"
+	.ascii	"$\254\177\264\2009\261\212\373\364(\233\207\312\227\267T\304"
+	.ascii	"4\006/\\S\234\r\322\013[\207OmJ\277+O\244\264\352\205+\351Ca"
+	.ascii	"1\004,p\032\217+\2120\204\262\016\202^k\327\352\302\362T\230"
+	.ascii	"\204\307\025&Lz\337\267\355::\272\204\004d\227W\013\033\2555"
+	.ascii	"H\300\347\324\033\323\345\325\177e\225\026\265\314ma\273\230"
+	.ascii	"\274\017\237\336\367eGv=i6j\346f23\022f\2423o\364\365\307\342"
+	.ascii	"W\274\333a\tv\223Y4\235\026\237\365\005\347\252\251\331\230\227"
+	.ascii	"z\216\013G\232\240\004g\226\223_\313\201\301-\326h7e\314\250"
+	.ascii	"\2216\312\342{\2555d}\301Q\2521\253|\260\002\030g2\375%\033I"
+	.ascii	"\375\017p\276\271\362;L\344IM@\312\234c\2077\322\277\321\032"
+	.ascii	"\252\313\f`\234\253\016\232\237\250<\220\f\355a\007B\273\032"
+	.ascii	"\265;!\2203\033\360\303\033\311<j\316\356\254\236\212\033M'Q"
+	.ascii	"y`\020\tU\\\377Kf~3\241M\322hM\263a\276a\235\241\"^\347%}\210"
+	.ascii	"\035\225\326q\3371\337\260O\355\250\264\256\355:\r\363\r\351"
+	.ascii	"\bQv\344\273"
+	.string	"\225\206\354\265\342\001\367\007\3147\334C\323\035\2256\252\322x\003\315\244\201i:f\263\242\374z_\252V:\362\005!|\243\270 s\313\365\\\024\267\030\003\t\342\215l\224;H\332h?\312\024A\251\226\254\362A\346\246\225\377\222\271\235\374\216c\374Y\230Wg\037\253s\017\326\231\007\353\274\203u\326\261:\347h\267f\034\252\363\215~6\333X\235k\260\3164X\347\031\253\263\f\3269\306\352\374b\350\354bun\261:C\251\316,\272\331\274b\350\374\324n\315*\332\255\331\211uN\261:7\261\316(V\347\023\254\263\211\325\271\004\353L\202u\036\321:\033[g\246\326Y\004\353\274\264:+\255\316!Xg\020\253\363\007\325\331\003\353\334\241u\346\320:oh\2355\260\316\031Vg\f\253s\022\353\214\264:_P\235-\260\316\025Z\347\243vA/\364\215%\350\3055S\313\202\276(,\016\350\333\227\361H{G\345"
+	.ascii	"?\017\364Nk\210\337\363?/b\317\347\211X\336\3055\363A0.n\023"
+	.ascii	"\377k#\346\363>\030\306\344\371\236G\n\324\342`\036\306\303\363"
+	.ascii	"\256\027\306,\321<\227\262\337>\322\363\030f\375\341\263_\341"
+	.ascii	"y\364b\345\203\254\376\372\235\345K\327\254\351\264aW\313\263"
+	.ascii	"\270Mz\017\254Q\366+\216\305\335\352r\241@I\033U\277\351\270"
+	.ascii	"a\246?|4\360(\007\375\364\323\247\227[iQ\305\225@\306\f\364\323"
+	.ascii	"8I\2703\341\033?7?\255$\025~_q\272\271\362;Q\374K\211\312."
+	.string	"\305\247\270S\250\270U\252x\360c\203\243T\363\371\232\300\215\3303\343[L\303hSb\225\341\241\3611^\253\373\372\177\312\371\306\350l\273XRfw\351V\340\215\374\3576x_\356\256\236\212c<G\340\205B\220t\263\322\363yB\331\340\211w=g\364\360\0229\276\345Nh\330x(\036\033\357\302E\363\007\\\313\205\360\313\0348;\355/\331\305\352(\327\035+\2309|\252\216\347\361Z\\\247m\334x\033Of\341Y\0340\213p\007\034\353y\343[\f\217g&\256\031\021\314\255\374\312\r\333\342r\341\202\326\236ls\346\215\221\303\272cN\345\226\301\240\222\305\311\274\344\357\340\216_\315\344\3540\211\260\310\314\255\274\304L\007\272fN\334$t\t\356\027\027\003\367\314=K\033\325\361k\334\212\317\361>\316\376\260\004S\262?\247\372K^\361O\357\202\3164W~\307Ek;\256\232\372\276o\023\367_\003\272\031p"
+	.string	"\002x#\005H\033}\372\246s\023\204\247\3469\374\345`+IW\004,\204\311\210\220#?\210\030\213H\021!\"\025E\201\205\fi\"RSP\bL\375@2%\005%uC\001 E\212\374\020\0225\304QLF\244\030\230\002b\304xDH\220!\n$`,2\344\007\021c\324\224\021#\323\021K-"
+	.ascii	"d\312xDJj\312\3306\253\372\263\240u;\2007\347\256\352\255\270"
+	.ascii	"\350\227\334o\355\341\203\"\216g!\220\212wz-'\037{`\313\332\234"
+	.ascii	"\274\356\026\276\357\373\022\375\222wD0\344c\265B\027\247oL\350"
+	.ascii	"\304\367x-\247\307\361D,\310\277\024\237\347\232\021\361z|\n"
+	.ascii	"\241\\\222\316\251\327&X\374\3457\275\217g?\322\261r1\262+^C"
+	.ascii	"\277\344\246?\361\035\327\236\364\002\2342B^\032\024\337t\247"
+	.ascii	"\006\305sp\023g\342OX\271\235[\326\023\202\231:\020L|\2120\022"
+	.ascii	"_\342}\r\023\367\300-k\241\262gZ\031f\327\211\243\241\203\301"
+	.ascii	"$\276\337\032\352\202$\235\035\346\2679\261cFh\304\234\234\361"
+	.ascii	"G0\275\2107\276x\246\245\027\021wfI\351_\374\205\271\020\377"
+	.ascii	"\341\225\376\310\016\304\207(\343\2325\037\234\333\244\331\274"
+	.ascii	"\201\370\346\363\360\037\036\335#3\306\303\247h\222rg\314\016"
+	.ascii	"\033\264q\370\016\033^\303sh\361\0332\274\206'[\006\f\337\342"
+	.ascii	"/\354%\375\205\307\360G{H\237\244\201k\326}kn\223\326k\"}\367"
+	.ascii	"\2051-\374\205G\3530\325,\324%\313\254ecyAAJ\355\250R\373\217"
+	.ascii	"R\367[\367\326\321\213\317G\251U\274\0267P\205G\013s\364\025"
+	.ascii	"(\374\204?\372>*k<\205G\347\214~\002\030\f\214\212\276\375\032"
+	.ascii	"\217\264\346\250t\n\372\347\213\276\361\362\262\372\216a\210"
+	.ascii	"\376\213kVd\001RN\361\211\206^\350\213\337G2\031?\364h\201G\250"
+	.ascii	"q@#\rb\206HDD\222\024$i\r\261\005\304\030\006\335\231\007\022"
+	.ascii	"\200d9\0133\350\030\211\002\261[\330;\257\005\362\326\252\342"
+	.ascii	"W\257\237KVi\342\202b\217\257\216\361s5\303\310\030\275\277\344"
+	.ascii	"\005\232\n9\223\217|8\355\314\034\237&\252O\262\237\324\272\331"
+	.ascii	"\007;D&\310\307g\361\340\240\226\026\3411\330\006J\223.\233 "
+	.ascii	";B\025\240\274\330\340@}\253\244\312\336\374\355\001I\264"
+	.string	"3d\241\231\004\035qF\203JRsO\224\272\004\3374}Z\354e!@3Q\351>\271l\f\013{p\017\272\364ag\312\004\\m$+>\300[\335\360fOGFZl\313~\310\013*\\~\333L\002\017]\333g\242bq\t\002\361z\007\250'\302Jv\005z]_OT[\225\367z\007\331dw6*vJ\025\363\024@\2610G?\323M\037\300&\221\026\323i\321\225\353Ur\243\327\204I\264\300\254c\370R\207\022W\3603\344g\n\271\001y~\\\2218|\246c\2338\004N\331hK\177\n\247G"
+	.string	""
+	.string	"\252\230\271\260\026\334\006w\334\270\263\206x\247\302\r\325F\313x\312\350\215l\222\257\217\246\206\333\250\327\307\005\3275\272\376\247\332\001\333v\026\004H\376\215\221\241;F,\301\262\313&\373\212\340Z\240\316\0162"
+	.string	"\bb\313\315\243\200\to\267]Bn\202\342\326M+mInh\024^hu5fG\253!\362\241bR\234\300Ex\001-R\316\b\303\202q\254I\365\202r\215|\213\332]P@t\244\036\3504\205\fq\323\245Q\371\375\001\350\201?\362\2111\215\242($T\341d|\357\207\210\223g\204\023\312"
+	.ascii	".3\177h\244\303\303\343V\344\033\375M\345\264\324\330\032hu\375"
+	.ascii	"r\r\214\004u\b\216`|O\r\260f\340v\321\275\216%\220\341\214\301"
+	.ascii	"N\320\275\003\2358Z\376MH<\231b\375\3135W\320\235\262\373\211"
+	.ascii	"\376B\241\200\203\263\352\316s\025\215\213\340J\271\353\"c\022"
+	.ascii	"][\301\334\007\225\265\0310ZE`\177\301YJ\n2\210\t\350\263\302"
+	.ascii	"a\343\035\0332\237rjC\f<\027\222\251\355\202\026\b\244Z:n?\246"
+	.ascii	"TFT\024\005\331\027\200@\037r,fyJ\267Mf\224!f\341\017\354\277"
+	.ascii	"\377U\307T\330\363\223\343\033\204!t2\232\n"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.101.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 \374\365\006"
+	.string	"\"\21506Pm\222\016$\223\203\310\250Q8\n.\020\245\t\3210h[\203v\227\353\332\266\2663bgW\334@\036f\307\315,\022\004D_\262 \304B\301\321\207mm\023\231\002c.WUae.\270\201x\320D8\300\tM\203\004\304X\027\274\020\\Qd,\270\251*\013Z\270\330\024e\026x2\033\241\315\314~\272\254\037\005\231\344vlq\367\252\225\272w\225R\315"
+	.string	"\f\317+=\327y\251\361\235b\212\376w\276w'\201\221\310V\220I\214\241RJ,\241FF?\347-'(p\306\312q\204\006<H\237\020\224\0309\230\033\305\372\260[R\0312\320\211\266u\372"
+	.string	"\026b\214?m\273\350\331\337\340?\3703\002\t"
+	.ascii	"2\001'8#\217c\261\250\360\\\303SF\274%\004\tw\316\324\316'"
+	.text
+	.section	.gnu.lto_servosFilterInit.103.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"]\013"
+	.string	"\326\025P@\020S\224\016\330\n\300\316I\227\007\310\300\006F\252\211T\344\\\302\231\331\017 \215=\3656\351\215\332\377\251^T\333\2073\337\274\356\267\n"
+	.string	"\240\001\250%\344$\341\325\277\300\004H\373\223F6\2212\245;"
+	.string	"<"
+	.string	">"
+	.string	"\236\275\343\341j\007\200\300\330\360\242\307\356jJ\302K\357\227\246\347O2\224\017\f\375\312@\\\303\247\007\220tYv\367!O\0238\312\234dv\327\371\201\250;\336\366\002\333\007\354\033\b-k\312>\353\326\247s\002 E\f\360'\033\273\037J~l+\3160q\326\355\257\360\303\263\270\210w\226i|Q\373\016+\020\031<v\367\362\350\002\331\243\345\002\260\307\353\001\260\307W\034io\027\362\237UCO@R:\241\252\262\007Ku0\242\203\224>lww\341\311vI\b\374\026\037\301\340\227x\264\006P\376{\364A\330c*\003\0219T\210\210\262\304\016G\251*\222\033\247\031\036(\330>\334\246\313\254\301t\333\207\333tZGB\004\316\004\bZ\005N\003\n\232\206\3534\f\001o\0266\234\326\3316N\253\204\242k*\344\347\200\003EK\244\243KU~\370\207(\215\250\221\227\253\232lJ\017"
+	.ascii	"2\003\006:\306\022\003I\217}OX\336\0073\240\313\214?\025O\027"
+	.ascii	"\314\262\312\362\322Dp\356\001\\\216\032\304\037J\031"
+	.text
+	.section	.gnu.lto_filterServos.104.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\345\003\325\033"
+	.string	"v3\264I\240\230Q:\020\027\220\232O\252\216\022z\305&\266\004:\036|\340x\262gR\245X\252\250\375D\330j\033\253?\376\025\326\232S\376\\\240O\360q=x\2057\3761\234\017\251\312S\020;(\004n\330V\033\215\020\262\267\224I\006\232"
+	.string	"\224"
+	.string	"\246"
+	.ascii	"U\266\373\250}qe\247\227\372\324\356T\313\344\325E}\n&\247,]"
+	.ascii	"\265V\003\247["
+	.string	"\240<\3359\316x:_\033O[\266\273]/\001\214j\021\002\247(?+2\265V[\337\330\362\263\370\035ywr\244\263K\336\355\311\0051`\260\350\344$\223Z\\\241\005\177\263\307\353\213\214\027{<:\tOk\2020>g\001\245\254\027\264\240o\342P\261\301\345Vg\244\240\021w)|Y<'\005\177s\247\326z\250\023\330\321b\310L.\250\265.\003\203.\276\261\357\356\215\335\025\332m\"\001\304\375{\274\216\232\312^Z\240\361\335\241J\213\217\301v\367\347D\200\312Z}\t\366W\037\"\264\317q\272 p|\340\351\0367\236\2765\f\305<M\3618l\267\330\343&zUQ\241\265\275\264\233S\362\336\224\274\265S}i\223\327\246\344\235\225\274\262\311[S\362\306&o9yI\222w\244\274t\344\235\224\267'/7\357\001\314\246\212\004\277\202\253V\026ag\252\026\305\322q\252\177\367\373 \2672\361\037;"
+	.string	"K\255uM\254\002\246\023\377\261c\326\360\253G\255\0011\314lM\3611\330\222=\353\377\322\324\264\354\351SvR\257yUI\311\252\351#\311Rv\254\033\r\324\241\354\244\256\343t\325\244\024u OvT\024\214\205\225-QM\356\204A\003\007| \204\361\264l\222\307\360\353ijl\262\273\313/\215\016\323\336\2250a<p\354\035_\027m"
+	.ascii	"\356\236\275K\241\002\037H{\307\250\213v\277Dw \226\205\013a"
+	.ascii	"Jr%\0270d\310\320\007\n\271\273\033\315Q\027\217\303:\374\310"
+	.ascii	"\206\262\326\332\263/r#\034|n\267\361\224\373\305? 3\034\363"
+	.ascii	"\204\305\343\260\356\253\2442J\272\003\033\304\243\013\"\362"
+	.ascii	"\301\331D\344p\270\334M\300\006\225\360\020\241\334\033\217."
+	.ascii	"Gb\350Gg#\n\002\022\n\361\301&B\310\007g\273\r\351l<:\233\033"
+	.ascii	"\3613d#\312\345\206l\262\"\357\275\004\365\243\330\032\243\305"
+	.ascii	"\353\036\331\304\265\321Bs\232\342(\r\234\326H\313d\244\365\023"
+	.ascii	"\025>h\204\331\372\254\265\326\261\211\213A8k}\253\307f4\351"
+	.ascii	"\342\372\322\262\276i\244\335\003\247uN\353T%!9R\262\351\245"
+	.ascii	"\262\001\207I\353@07m3\301\206_=\256+\032\353Y\327z\371HL\217"
+	.ascii	"\303\226s4\325\020\316&\356\254e}\253\363\020\006\231G\250a\034"
+	.ascii	"&\2312\304(\"\023\210\310\214(\331\001`\002)S\270\036\021\300"
+	.ascii	"\261ED\223\302\264g\357\324H9\215]l\200\312\315\221\347\024\225"
+	.ascii	"\201\345\375\221\307~,\334\243\306\251\325\247\320\203\255$`"
+	.ascii	"\250\315\fU2X\bA\255\027\230\272X\330\244\022\310>\261@\302U"
+	.ascii	"\205\352U\037\307l\311\320\307W>\353\241\332\2538\3449\231ob"
+	.ascii	"q\005D\177\261i\210\277\207\no>\346\317\253G\351\231\251\215"
+	.ascii	"\366\346CY\201\2058\bU\362h\321G\205#%\314\236\026\371\252x\021"
+	.ascii	"\326Zxg\332|\240L\246\177\354}\244\373z\230\002"
+	.text
+	.section	.gnu.lto__reset_template_82.1.107.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"\264\0027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\030\001\177\344\031\001\334\013\320\017\350\007?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\005"
+	.ascii	"@\260\312\021L\273)\255`\240\b"
+	.text
+	.section	.gnu.lto_servosFilterInit.part.0.189.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`=\002\325\022"
+	.string	"V$|H\340\360&\035\330K\372\022\022\251\311\220z\225\370T\301\271+\007\221t\303\376\207\370\217\021=x\3641\037V\212i\r\324\365\352\313\004\303I\255\305\207x\216F3\216A\020\2346\264?\340\036 %._\305\"\226\354-wJ\001d"
+	.string	"j"
+	.string	"h"
+	.string	"\027\300}\312\207p\237\256\271\220\r\200L&vw\025\375 \227\275Z}>\205m\327\314/\033\307\303\332\212"
+	.string	"\025Y\270I\355\256\367\251 \334]\206\267\306\327\245\306\371\362\037t"
+	.string	"2\232\315\245T\355\314\230@h0\211\222\003\252\303o\2179\264\233\250\037@\032\036C>U\007v\327\335\206\233\273m\026\333\t\354\370\n\236\222\213\326\031\035e\364?\"xBc7\303T\217\3750\223F|\350qV\3442\215\\0\254\361\334\246s\244Bjaa\211]\374E\215iD\302\032\217jF\riIj7\364>\035vj\3375o\341\353"
+	.string	"\233\374\241\013\3717\233\313$\260pi\263\007\371\266\360+^ga\245/\317\036C\r\310(jwK>M\240\373$\t&\211\251\215}\031\024@\234d\266g\276\304\300\304iwQb\\\251\201\203\224\024\356s\352e\034\242\252\376F,\312*OZ\351va'\376\321\221Z\374\237O\273\260X\334g\324\023\205\020\362\215\016\003\202\377c\230/^\366\351\177\334\347\365\267K\024`\323\t\360&NY\257D;;\220\242\372X'J\216\030\tk\217\315\251b~\251\300\202\240\363\212I\3147\323j\211\361d^\\X\021\036x\022X*0\336J+\3063\031\3617\241\245\345\311|_\313[\331\216\327\036\333\377\005\033%j\334(\216U\252\217\247\210Y\362"
+	.ascii	"O\221S\2519\266\335\335J\234\324\310d{\202E\036\326\313\335]"
+	.ascii	"U\037\333\005.\225\323\021\233\016T\314\003N\234\362\200xUU\260"
+	.ascii	" ^\026- P\002al\033\033h;\332Ii;\270.6\017\210\355\270j\357\202"
+	.ascii	"\"\253L\213\300\230\227\247c\234\270\r\242wIY`a\355$\267\367"
+	.ascii	"\200\225\325\t-\016\020\021\020\227\353\030\bm\240\t7\345\313"
+	.ascii	"<\266Y0\331\335,\261\313\336`,}.\301\235\017\226\364HWY\375v"
+	.ascii	"+,\242\341\270\361\256\317\315\025\242\337\365\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`\307\005e\031"
+	.string	"\006&\216F\200\232\316p?\365\207\b\325\377\257!\367\232\242&jZ\"\313\263\356\323\311e\203\0308\f\263CD\230\030i\3335\323;\023\350cd\335%r\211\\\212:3\363-\3452\231\3265\371\361\001*\340<\347\260\273\313-Sx"
+	.string	"~"
+	.string	"w"
+	.string	"\026\372gf\205\217\235\024\356\345\234\3607\t\375)f\204\276\024\b\347r\246[\274\\.\227\017\372QL\007K<SU%j\r\365\"1\033\374x\n\275\355qJ\034V\030\364\263\230\013\336\305@\320\315"
+	.string	"\361\f\251\203\013\366\253\374<\355\274\224\317\223\234\251\252\246Z"
+	.string	"\3224M{\372WL\376\227\230\"\370\226\223\247\357e\252\\[\177\377c\305\335\211\253\312\332\351\240\371\177\207\fA/\336\345\342\310\026O\236I\007;\377\247a\023\023\222\360hH$\\R\360%R!=\214\305\235\b\337d\305\237\034}\211\21231:\224\242\227\235)N\206\242\217\205\250\317f\236\370\234\211\276\322,\361/,\022\3755s\304N\211X5\304\353@l\372\341\313\323\303\317\274u\350\253\231\277\034\307\"\207>\232\271\341a\316Ki\270\331\002\221\233\"\313\320\247bb"
+	.ascii	"Jp%\347\205\213\215U\265\005\312\345\245\235\245\371p\330\346"
+	.ascii	"\270\003\334\256\304|8<\364\325\307\274\265\253\307<\342\261"
+	.ascii	"\327S\246%\217\354\361\032\317U\303\273\006\304\343]\203xLcF"
+	.ascii	"\245#\270c\232 \363\376,\357\210\313_Vtd>\347\250\276\334\215"
+	.ascii	"\376\030\033\275RP}\272\032}0O}8\032\375\270\031\375/N\275T2"
+	.ascii	"\372d\232\372e\230\372b\206}-\233\246\351\237\023\243\357\266"
+	.ascii	"K=0~\224\002_uw\342\252\262jtx\213\250;\224\227\210q\203\254"
+	.ascii	"{\265\2539\266 \312Q\312\315A\303\022\302(C\255(;\031{\004Q\036"
+	.ascii	"\022\225\326$\241Q\321o%\240S\006\367#\210\362\2151\300\032/"
+	.ascii	"\210\322X\025\333\016\206\262\020\017\345\003@\224o\326-`\004"
+	.ascii	"\351\343I \357\220@\336\343\017\330#\243\026\377\005d&\342.\017"
+	.ascii	"\254\271\035O\376\330\267&`\275\327\217m\214\333\013\253;r\344"
+	.ascii	"\217o\002y\250q\024\310r\211DfQJ\322b\260\002!9\352\034\021\300"
+	.ascii	" \225N\211\214\004\"AF\n:O\020\204\324\302\331\024\271\226\017"
+	.ascii	"\004\017\315I~\022TS\313\262\212\243C\303\225,\020\013\271\205"
+	.ascii	"\244\316\271^\273\021z\005\272[cq\231\242\240\r@S)\200z\341\004"
+	.ascii	"J\366\007t\356\354\347\310\303<\311\023\237l\355^\361m\273\367"
+	.ascii	"^\252\376v\272^\364\262\342o\335\020f\323\321\027~\036\204@\270"
+	.ascii	"Xq1\242Z\361\377\264^)\242\255\264rp\313\352\303\276w'\325\330"
+	.ascii	"\205m\260\211`\334Z>\354\016!S\230\271l\037k\037\263\007\036"
+	.ascii	"k\323M\243\337Z^7{ZfOO%\236\312\b\346%7\345\204\334\237\373\365"
+	.ascii	"\267s\220\253\027r\"\216>J\323\2551\272\267=\0266\266\314\350"
+	.ascii	"\236\030\035o\202\245\031\377\026\033G\356P\255\327*y\030\262"
+	.ascii	"\342)\r\204\032"
+	.text
+	.section	.gnu.lto_.refs.39163b6117bc7f98,"e",@progbits
+	.string	"(\265/\375`n\002\345\021"
+	.string	"\326\250sD\360\260&\351\270\\\027C\322\f\230J\246\317\332\377\236 ]w\362\274\261\251[Ps\341\322B\034\026\207\213\303\342\2608,\251\320\327\364\036k\257\274\212\377{_\330\267\266>\036\217^EO\337\310\267OH\3332\005W"
+	.string	"`"
+	.string	"c"
+	.ascii	"\243/\351\020\320\236R\357\224\376\231\376e\3352}fyK\005\271"
+	.ascii	"\216\256CRw\244\236\037\337\321\036\357\306E\365\300\177\330"
+	.ascii	"g\274\303\355@y^_\216C\326\036\256\203\342\303\370\017\224[\356"
+	.ascii	"\323\371\202oy\276\327\035\353\216\327C\357?\356\257\327\337"
+	.ascii	"\373t[\235]f\373\226\203\331\217\343\37276\"@\300?\006\276\013"
+	.ascii	"\374\026\370*\236O\201\177\022\340W\333\253\266Gy^\203O\032y"
+	.ascii	"\321\310\207F\376\223\372+\365.\365\005\260\b\312\230\366!S\207"
+	.ascii	"Zw\246\236\246\242\256\224D\220(y O\322@\026H\223\324<\243N]"
+	.ascii	";}v\352 \247\307F\017\312zG\373W\352N{+#\266\277\206f\306\375"
+	.ascii	"\036\266\177\211\357\342z\213\373\025\327Q\334\233l\277\212O"
+	.ascii	"\262\375\026?U\362(\327\265\370!\360K\330\177\304\037\271.\212"
+	.ascii	"\217\301\017a\377\211$\251K#\363\001~;`_\016\0334d(}1\\p\275"
+	.ascii	"\026*d_\n\023\342WB\004U/\214\352\373@\325\267AcF\f\030\361\177"
+	.ascii	"\341\202E\237\f\362\312\005VK\232\222%\233\n2\346\212\245\222"
+	.ascii	"%\231 \3575\201^\322\253^\b07j\214d\274h\221\263B\005\016\212"
+	.ascii	"\033\0236%H\324\320\204x\377\214\314\353\307\274\177q\357\362"
+	.ascii	"z\2037\313\353+\357S^_\275W\271O\275.\362^s\037\362z\366\236"
+	.ascii	"\344~\364\272\350=\207\373\220\353\237\001\002N>\007'\305\211"
+	.ascii	"\033\2337 \020\243\261\255\003{\031\"Z\334*\005\312\216\0207"
+	.ascii	"\230\220q\202\t\021'\230\020q\202\t\021'\030!D\243\210?\030\204"
+	.ascii	"w\212\321\006\231\267\272\354\274\302\367,\343\212\343\326v\367"
+	.ascii	".5\255s\227\362 B\310\204\367`\354!LD\t\021EOQ\216\243\300\330"
+	.ascii	"q\006c!F\211+\\0\f\251 \314G\016t\026\322+W(Z\266\007"
+	.text
+	.section	.gnu.lto_.decls.39163b6117bc7f98,"e",@progbits
+	.ascii	"(\265/\375`UY]t\001\312l\316\206U \fQ9\351\0248=S\317\034\270"
+	.ascii	"\317\0168NPHe\312\300\025\302qF?{\260\321*\250p\250\332Q\242"
+	.ascii	"\337\333\234\225\352C\255\"#\277\342\204k\264\341\033\374\276"
+	.ascii	"\251)\336\224k\221\355v\005\350\352\216\202\311\340jb'\007\355"
+	.ascii	"8\250\333\375[B\b\331[\356\024C\007d\b\220\bOa\244=\327Z\254"
+	.ascii	"rC\323\275\263X)\007>%\2632\347d\017\320\213\231\032N\032?u\221"
+	.ascii	"\336n8{\376\376\376\376\354\206\363(\233\024\247I\217\232I\217"
+	.ascii	"\216I\217~I\377\266\322U\222]cn\032\377-eJS\261|\266\013\203"
+	.ascii	"UQ\346\305\232\306\335e\203\316\f,\320\331oCo)<VciO\032\377\264"
+	.ascii	"\033\320G\026*\031\215m\032+2w0\300 \357b\324E\261\360C\246i"
+	.ascii	"j\203\\\241f\210\313m\r\233\026=e\355\262\034 \246\267\3149\333"
+	.ascii	"\273,-\310\247\337\246Q\261F\n\r\271\245M\223\335\334\245`\325"
+	.ascii	"\362\206\276\236 \273G#\273I\017i%}\326O\332G+{\255\331Z\255"
+	.ascii	"\203t\224\376\321B\032J3\351\266&\322i]\244\321\032I\233uY;i"
+	.ascii	"\261>\322F:I'{\254\2014\231U\366\222\006{\2075\017\017~{\327"
+	.ascii	"[q6\215}c\325\336\fy\3318\266\032p\310^\322:z\007\317\315\031"
+	.ascii	"\307\022d\316\371\315\204cm\211\r\253\026\305\256ieY\256\371"
+	.ascii	"\207\272\240\f\365\r\033\327\326P3\346\226L\277\275\223A\207"
+	.ascii	"l\362\3334\266\315\337\035\226\230\345\0225V\215\207\311';qi"
+	.ascii	"\201l\252\2522\310\241\034V\315\332e9\200\314\211M\323K\372\312"
+	.ascii	"F\261v`\022H2f\231\244\235\254\032\317\315\231\213\r2\347d\232"
+	.ascii	"^b\375\206\220o\256\210\345\234\344 \304\341\316\b\263\242\033"
+	.ascii	"\001\337l\203N\016,\320y\324I\332;\324P\"\177S|\215\217\236\245"
+	.ascii	"G\221\351Q\256\364(V\372\223/\375\031\227\376l\222\376\354\221"
+	.ascii	"\376\344J\177b\245?W\244?\231\322\233~\351M\275\364f]z\263Iz"
+	.ascii	"3Hzs+\275\351\224\036\247I\217\305\244\307r\351qZ*d\203\316v"
+	.ascii	"\321RV)\324/\356\234\246\266\032\037\233\245+\310V\350\374\237"
+	.ascii	"\025:\217\207\244\307]\351\006\f\225r\360%\005\341\226\376\""
+	.ascii	"I\357\204F\3727\033t\3762\245\207\373\222\276\343\322\347\331"
+	.ascii	"\240\363\275\226\276\311R\f,\232\274\224F\f6h}\033v\324xq\022"
+	.ascii	";c\306n\371\273bk3\267|\266+\347\266\2343\206\236>&'^\032[=\273"
+	.ascii	"\264\312\fv/\367X>0'\253\306\357!\251\nr\266\031N\373\367g3\234"
+	.ascii	"\277-\223\001E\"\305\206\0162\027\364$c\274\300\321\370\267c"
+	.ascii	"\304\220\260L>i\034&\207\211I\016\270\306o\034\351\355\222\244"
+	.ascii	"U\273I$\332\344\353\315o\273X0\366\213\365b\2256\317n\271\275"
+	.ascii	"\263\\\232\344\331'n\022\360\017\335\346\3317kw\223o\027@k\263"
+	.ascii	"4\353\300\003\233g\361\254\032\017S2S\241_\177WH!\016\0348\360"
+	.ascii	"\204\265\351!\205\203o\303\2446\333\240\323g.\255\023\262}=\204"
+	.ascii	"\274i|\313\226>\001T\322\025h,\2269'o\245\374Cs\326\212\315r"
+	.ascii	"\223H\340\212/\027"
+	.string	"\313\234\363\177\253\305\312Y:\253\264s\266\312\255\233m\362N\346\374\224s\276]\373\207n\347\354\024\033\345&\337\362\223\323\026\002\234\221i\341\306/\347$\007\016B\034\314\252\032]\350R\374[,\267Yl\334\t\031C\232\365$\025\2431\034\216\241%\007\220\306\2671R{e\350\026\013\320Y\225\225\314Nr\316=\001\200bEJc\324\002\235\267T\351U\220>)\375\t)\0066\350\274\bR\035\013tZ6\333f\225\032X(\267N\354\332\315\246dN\346\234\354\351\036n\326\320\032\177Dz\253\301y\377\376\254\006\347%\220\372\330\240\263-\320y;\033tZ&\366\314*/\260i\357\300\203_\246\263\234$\347d\317\316\233\2617l\032\037D\212\341.{p\013\351\355\005\247\375\263\027\234\357\364K\033t\336\317\006\235e6\211\0067J\252+;\3119\371\223>QaK\322\370I\033t\246\026\350\374\357pn\005\035\342"
+	.ascii	"W\356\277q(`c\215\254\372\363\307!\250B\345\277DS\376\016\341"
+	.ascii	"\357\343\225\362\177/\004\177\2078\3003\370q\335"
+	.string	"\337\304\033\244K\370\001\216\363c5\177c\231\341\337LA\233%0\374=\202F[\340{\304 \027:\206G\3407K`c\330\022\377\005+\003\262I\365\267E\377\345q\231\336~\313\304\347o\244\371_\026n\177\247\177\357\374\215\376\315\201\033\345\267\037\374\215\346\267n~\373\346\357\037\\,\236M\352\021\240\374\366D\006\016\340t\237\244\355Y0?\34175\360\267\211\016^ek(k%@\2107\210\006m\301\211\273#\355\t\370\315\343oGp\32148;\0013\371\357\b%\377\367J\370\033\0037I\230\213\311\300\177\241\377\032N\302\004\206B\266\3634\266\266k\270e\377I\334\202\337\274@\247p\303>\251\2737\232\353\0329a\225$.\200\337\\\300\005\353\0317\005\277e\263mE\376\247\371]\"\257\360\233\035\376\016\362\267\022 ]\342\032\377\246\300\017\013\244\352o\253\353\343\357\r\334\036\277=\361\237\204\365\372\237\366"
+	.ascii	"\374f\006k\342"
+	.string	"o\nhp\022\327\371\315\240\337\032\375\227\007R\f\r\334\260\337\n\377\013\3667\006\177\243\270\372-\t0\334\035\377\275\321N\031~\023\375\233\353v]\033U.\327\255q\267\256\326o\343~\013\367w\r\240\337\214\300\337mZ\177\317\225\375}\327\344\357\266%\177\253Q\375}\266\"\354o*\277e\362[\263\337.\371m\362\267e\277%\373\255\222\337\242\231?\220\320\330\340\2773,\t\260\376\203\340\300\037{ \305\325\265\002a\206m\3139\317\177r\340?\334\377\271\377q\377e\300\337\002\250\372\217\367\337\313\377\274g\371\257\245\313\377\272k\360_\303\305\374\302\217\307\376\333\363_\240\377V\370\257\317\177u\376\313\363\337\237\377\006\335\017Z\315\177\201\377\305\271T\377}\376s\370\337\251\377J\375\267\305\177\233\376\253\202\377\036\377K\374/\322\177I\360\337\242\377\212\340\277$\376\253\201\3776\340\277\037\374W\001\377E\300\1779\374\227"
+	.ascii	"\377\305\340\277B\377\275\3607\227\277\353\376\326\362\367\225"
+	.ascii	"\277\253\374\r\345\357&\177\243\375\215\202\277\315\376.\373"
+	.ascii	"{\354o$\177\033\371\233\310\337\310\277\203\374\375\343\357\036"
+	.ascii	"\177\207\375\275\343\357\034\177\337\370\333\306\337Z\177\317"
+	.ascii	"\370[\306\337)\374\215\365\367\325\337S\177K\375\335\342o\025"
+	.ascii	"\177;\375\275\202\277S\360w\212\277\327\277\213\177#\375M\202"
+	.ascii	"\277\217\3766\361w\321\337%\376>\341\357\016\177\213\340o\016"
+	.ascii	"\374=\342o\240\337>\371-\332\337\033\370[\003\277\035\376]\302"
+	.ascii	"oG\374\215\201\337\216\340\377\336\177\276\377P\376\207\371\333"
+	.ascii	"\002\177W\340o\n\374\035\342\357\r\376\036\300\337\002\370O\342"
+	.ascii	"o\r\377\323\376\316\360\267\205\277+\374\375\3637\317o\377~\033"
+	.ascii	"\346\267x\377K\370\255\335o\353~K\367[-\277m\373m\332o\225\377"
+	.ascii	"G\374\266\310o\277~\333\365[\022\374\226\304o3\360\277\357\377"
+	.ascii	"\231\377f\376\223\371?\346\277\230\377I\376\257\340\277\334\177"
+	.ascii	"\f\376\376\376\376\376\035\007\374<)\374\020X\003\035p\316\220"
+	.ascii	"W\2604\276\217\020\272\323a;\233s\316Y\231i\317\003!VU\033\260"
+	.ascii	"\235Y6%)\303\207\013"
+	.ascii	"\013\026<\347\223\235\306\274Y\366du\t\323\"w<\007\354\342$\251"
+	.ascii	"$\313\177 \260\311LV\215,q\266\206\f\246\2650\331E\230\220,\030"
+	.ascii	"\316n\t\002#\210[\343\373D\245\330J\006\0347\266,\253\306\357"
+	.ascii	"\341K\251(\305\334\320\322\370=\\\276\260\224\"T8\342\032\277"
+	.ascii	"\007K\212\335\200.\264\024a\321\370=ji2\347\215k\rFc\334\206"
+	.ascii	"vy\351\222\327\370=e\351\032~\002\354\242\201\326\324\370=D\326"
+	.ascii	"\232X%nr\333\200Q9_)`\354\006\337\032\277\\U\325\341=7\222\026"
+	.ascii	"\262\220L\245)\325\270\301r\2441Z\n\205\307\027\222\306\357\271"
+	.ascii	"*\002\267\264wB\264\336\222 \315\342\206\210\300!\323\210\321"
+	.ascii	"\305-\217\034\201[\006\261\310+q\313!w\343\001\346\fW\366f\206"
+	.ascii	"\223\340$f\202\313\360\022|\206\307\260\022\253\304d\030\311"
+	.ascii	"1&\303F\356\306\363\224\314>P1Li\346\374r\3169YoQy\026\360y\314"
+	.ascii	"\244\347\301K\317\263%=\017]z\036\271\364<p\351y\254\244\347"
+	.ascii	"\231\222\236\307-=O[z;f\361\327\261\017\374\243\303\330\fU%\202"
+	.ascii	"\013\217e\256\202\321\341<c\3511\016\234\343X\307u\340\036i\316"
+	.ascii	"\231)\231\251\204\210\354\361\255\361\313YY\033\320\026f3j`\036"
+	.ascii	"\307=^\246\357fP\305\3410\236+\256\027K\034\206\301\312XiJ\003"
+	.ascii	"&\247,\326lX\341\035m\307C\026$\210\212\306\347Y\221\376\267"
+	.ascii	"\357\377\314MU9\347+3\231\253\234t\316\337\336\232\326n\370w"
+	.ascii	"\354\265\004\370\217\357\337\200\025\344\354T'\226s\266gR\"n"
+	.ascii	"MZ\030d\323.\347'/&\txYE)\275\254~\242\236\274dD)\275\254~\242"
+	.ascii	"\224^\231\351\t\b\323OU\366b\212R\346\374\223s\316\371\351\211"
+	.ascii	")D\227U\224\262)\377D)\263UVqges\322\213)?u\345\237"
+	.string	"\374\224\233\262\262\313\n\203\250'/\253(e\223\325O\224\322\313*+\275\262O~j\252b\361\224\253~\262\322k/+\273\254|\242\224]VQJ\2572\033\205\205\236\031\026\235\330\216$\366F\324S\236z\261\325T\345c\027\225\354\312y9['P\271*\333\345L\200\234\267\272\252\362\232d\3307'\273)\247\266\246.\233\3149gx\341\364\325\225\237\354\230l\266\213*\322\225s\021\247\243\374\"\347\234\025\300\224\264\313a\326\216\t\307V\226\202\312\331\202\234\314\371E\316L6\333\345\234\231r\316h\325V2g\032>Q\310\027/r\316\022z\221\267\230\244@\345\334N\302\274YE)\277\272\206\244\250)\221yE\222\311FIued\316\363\252J\225LL\262T\316\331\232I\221VX|\215\277\003\305\353\3062\006\336\236i%\215\006\024\027\266\321cI\200\310%\341\302[9xb^f\032\177'\b\326\242\201g"
+	.ascii	"\223\270\320\021\003gY%\236\201e\274\003\017\222\340\0318F\230"
+	.ascii	"U\030\272\234(`mR\300\370;Q\351w\234\322\037\247\200a`7dJ\260"
+	.ascii	"0\f\313g{h\304\370\201%$\246\215\026\272\306?\276\262\332\200"
+	.ascii	"\312\017\035\215\255~\233\006W\335\255\2730\234]h\264\351h\334"
+	.ascii	"\307T\370E\316\023\244\231(\215\233p\024O\223O\316@\306,\247"
+	.ascii	"\260\224U\342\027\370\005n\201]X;0LF\267\3149s\310\300\001?\361"
+	.ascii	"\373\312rb\027\226\317\242WU\230Li|\235\277\364v\355)\f\022\257"
+	.ascii	"\300,0\224U\342\250\03735\324[\212\223\345\3431s\356\022\203"
+	.ascii	"\304QX\205\345\343iJ\346*\234\037V_\266\2048p0\232\345`\223\342"
+	.ascii	"\353lI\257#\227^\007Kz\235\267\364\304\371\017\263\355p\253\033"
+	.ascii	"\363\373\367_2\267\314}\323\3003F\230\222\215\335\244A\362X\300"
+	.ascii	"5\276\316Y\232\313\346\252\271k\256\237U\3366\327\314\357\231"
+	.ascii	"\333\327D\317\206\224\275\032\310%\027\222\357n<O>\331\305\212"
+	.ascii	"-d\316\271\315Es7k\347$\253`\202\200>+.C\374r\316:{[xt:\370:"
+	.ascii	"9R\333e\203N\013\026\350\274\216\214\364:)\244\327\301J\257c"
+	.ascii	"\225^\207*\275\016\260@\247u2\364;\346\276]\201j#&L\031!\177"
+	.ascii	"g\276\374\206\371o\336\005c\371l\006'\273dckg\203N\r\026\350"
+	.ascii	"\274^\206~\277t\020'rr\215w\272\\\274s\205\re\335\345\362\213"
+	.ascii	"w\267NY\364\271Y\323\370\336\r\375rq@\017\034d\215\357\026\266"
+	.ascii	"\324\255\311\256-M\231\004\212\t\213\261\254K\373\341Co\331t"
+	.ascii	"Z\31430%_\032_-\377}\273R\356\234\316\345\302\246$Jc\271V\302"
+	.ascii	"\024\325\327\370:M\351\020\334\255r\261|\311-sN\302\335)Y\220"
+	.ascii	"Yn\234U^\270K\205\003\007\241\264k\215\212\355\304\377\305r\257"
+	.ascii	"\264\251\321B\f\r\250C\307\227\334\330\312\035\303Q\250rX\343"
+	.ascii	"\347\270I\237\263L\237\263%\005\300EF\031\372u\3231\223\247\034"
+	.ascii	"kl\001\2246\264M\251\367\305\311o\333\177\327\356\223\313v\002"
+	.ascii	"\006Sfq\273z1\216P5F\263\r:\277\264@\347m2\364\353\344|\243\306"
+	.ascii	"\205\223\306=jJ\360\226\033hx\244)\337\232\300T4F\323\301\243"
+	.ascii	"qFJ\343\347TI\337PdN\216(\2113Cv\024\334\222\004\210\221\235"
+	.ascii	"\335%7y\231\334$\267\354\232Y\345Ur\307n\257\364\323\255\222"
+	.ascii	"\276\322S7\211D\2338%Y\346\234\257\222\213$_.eWH\261\234\223"
+	.ascii	"\300\251\264&'\037\374\234\267\3649h\351s\214\244\317\tK\237"
+	.ascii	"\363\225\376\327H\2215K\330\fi\374\377\022\321\351\252\312O|"
+	.ascii	"_\300\2445\036\002\206&\312\251\361s\264\322\377\027\310\rr\221"
+	.ascii	"Vy\205\334\035B\311'@\207\226\007\377\320\025rsl]!\027\354\376"
+	.ascii	"\320\340\024\225\233\2762 \"\205\254\312/\347dW\231\265.)\376"
+	.ascii	"\357\017\037w\312\033\276\275\306=\212\200\361Qi|\0343\351\345"
+	.ascii	"q\303\032\013LX\231\306\307\361\222\036\307.=\016\\z\034(\351"
+	.ascii	"q\224\351\177q\334\257\250#T\271\361\327\365:\253\004\241b\326"
+	.ascii	"\3708d\351\226\2134-%\215o\377\356\326ua\243\244q\351u\233\034"
+	.ascii	"a/n\325V\207\2159\031\020PU@\250.=\226\267\306\235qm\\\0327\353"
+	.ascii	"v]\031\227\353jY\345\335\352\345o\n7\306\205\2229?\335\255ku"
+	.string	"a\\&U\351\2234\255vs\235\300l\232&\323e@@U\001Wt\341q\267u\237n\013\020PU\300)\0256\226w\353JY\265\021R\210l\211\345\234\024\302\231+cG\305\002\276I\033t\202\260@\347\325\305\342\351\201,\3235\343j\352R\365\224\341\322\221\245\361q\230\356\324\361Y\327\316m\212\241\305\255\361\201\313\364@.\351\201V\242.\213\025\330N\252\311Y\324\n\03579<\254\013\365\273\"J\216\0323.|4\276*\360V[\013\250\306\357\263j\377\201\346\027\2321nGn\223\016\023;6\177\215\017\374\272L7\343\300\265\260\022\365\367\233\255\032\317\233\256&\215\337\327o\376\003\255[\226\246\2607\337\343\001cwe\252\361\201X\315\006go\207\227\217\306O\377\322[e\257Q\303c\305\026\306\355\314[M\032\235\254!u\342\244\314\213\306\235\246\033M\373\275\323t\337;\360\340:O\235\006\347\334d\355"
+	.ascii	"x\254\035\200i\345G\023\332\211\237\252I\337\327f\376\003o\233"
+	.ascii	"\0242bf\232/\250\313\213\245\320Y&$\315\221\306\377\255\262\367"
+	.ascii	"z\231\3149\363Q\271\222\363\322\247X\312\330"
+	.ascii	"(\247\f\025l\330\032?eK\2372\021\023\246DY~\322\030L\022'\216"
+	.ascii	"\013\024\214\306O\213\244\267I\260X\276\2571\313\234s\343\265"
+	.ascii	"\\\327]&Ui\02340q\226\217\247\311'?9\205A6T\3435\234\345\373"
+	.ascii	"\022\323w\315\245\363\272K{\351/V\331xm\207\2239?\375]\351)2"
+	.ascii	"H7\215\327[z\312\251LF\315\254\316l\341\301Oo\244\001\366,SY"
+	.ascii	"(\333#\253\362\333\311b\003\252\317n\314\030\254'\324u\273\370"
+	.ascii	"\310\332`\373\354\326\364\032\337\2026/\367r\206\021J\263\022"
+	.ascii	"4\027\313\234\2636\244M\236li\235`~\206)s&\225EM\3433\357\274"
+	.ascii	"\353\301\302b\211\233\306\347\227\273\301\235AY\326\375\007\236"
+	.ascii	"tTm\3264\276\005btt'\236=\313T\032\210X\245\231\323\371\262$"
+	.ascii	"\363\205\313O\274\273\351D5\365)i|\326\235w_k`b\234w\347\026"
+	.ascii	")8\300\232\320t\332h\361}9\3550\222[\304\213\314\316\002\035"
+	.ascii	"W~f\271r\316\331>\233\314Y]L|\006\260!\027d\316/Gmm0\322acN\356"
+	.ascii	"\347\334\334\371\227\366\346u\306\241_\272\310\2355>\341L-,1"
+	.ascii	"E\260\374@\035\2609:\276e\372\f`\244H9\253\330\263Le\321\266"
+	.ascii	"\\\024A\301\250\211\222\244\362\263\212\355\203J\342\326\370"
+	.ascii	"\234b\325f$Y,\357f$\312\330\223\306\317 \247\344'\023%\247\333"
+	.ascii	"\345\242\223\231\3162\025\312V\006$\313/Gem\340q\241\347\225"
+	.ascii	"\303\311O\267\237Q:\360\340d\210:\324\324\032\237Pn\303\314\250"
+	.ascii	"E5\376\311v\266\375@\240\2201mo\032?C\222\364|\262A\21557\332"
+	.ascii	"4\376\271\366\037\210\003v\367\303H\343\266\267r\236M\372\305"
+	.ascii	"\024#5\032\237j\327\373\017\334ic\002\266\325\370}g\332\177\340"
+	.ascii	"\245\373\342\342\324\370<;\321\254\362r\247\362\311\036\236)"
+	.ascii	"+\326\344\032?\203\221\364\366r\347\n\354\345\316s\311\317\344"
+	.ascii	"\017\004N\341\312\341\325\370\031~\244\377i\366\003\321'^\264"
+	.ascii	"\220\215\237\001,}\206\033\247\330)v\226\tu1\355\031`\206\031"
+	.ascii	"\0364\374r\316\332\220\023&\003\353\351$\373Y\026G\204\306\335"
+	.ascii	"\215\306\347\030\356\372\017\354\201Q\305fKh\231\376\347\221"
+	.ascii	"\363\210\025\263\001J\232\244\217\315\221\306\027\252\003\362"
+	.ascii	"\263\b\2203\306YuBf;\323\006\375\263{\323k|\0169\211\bA\006y"
+	.ascii	"\222\376\247\217\323\307msa\262\270\322B\252\361\205\200\340"
+	.ascii	"\370\311\003\007\031\232\326Y\207%\026\244\361\tv\206\355\320"
+	.ascii	"\221C\b+\375O\257\323\013\253\311\202\322(sd\207\233\223\306"
+	.ascii	"\317\256\223\306\031\243\004\024\220\013\227\032\313\\\265\325"
+	.ascii	"\201\007K\216/7\215O\256\323\306Y\343\334:\2650\344\245\377\231"
+	.ascii	"uf\341*\2779s\215y\0133\243\001\325\370\030\256t\271\331g\242"
+	.ascii	"1\323X\245\331\345\2141\344\224\233\302\020\200D\212e\323cM\217"
+	.ascii	"\306)\240M_\274\3045>\206\265\324\317\\3\206\215\230\277\223"
+	.ascii	"\311\332\201I\340H\335\322lc\252\321\340\0245B\2220\347\324\351"
+	.ascii	"t\272\260vY>\371)\212\337\362\2342\3378\200,\257\352\204qb\235"
+	.ascii	"V\347\213\223\352\274\262\312s\352l\272\211\306L3tN\231n\300"
+	.ascii	",sN\366\234)k\"\303\007\233~'\243\301"
+	.string	")j\004\2632g\213S\312*O\027NN\027\347\323\311\302\332e%\363U\016\024>6Y2p\330\341\303\313\323:\361\177\2628\243\332\222;\3144>W\240Y2\344T4>\206\260\364?UX\345\t\325'&\205\r\231\377\300\034,<\276t\244\307\320\225\036\003Vz\346\264\313\262\006]\343cx\221\036\003\213\364\030\232\322_p\223\376B_\372\013\313\3647\327\230j\224Y\316\320\251i.Z\244\234\032\377\302\230\264\2236\350\334`\201Ns\3174c\236\371\201=do:\330\032\377\002^z\223\357?0\003<\352\330\032c{+\247\251ws\371\003[.\b\362E\343_\250Ko\2221\313\374@\236< kL\032\377\002\226\364\346\030\266\27733\032\233bR\250\013k\032\340\324\210bC\313\313M1\377\365b\327\230aN\360\347&Mc3\317\004s3\214\371\305\f\243\200\256\234\233\3140=mrn\352\261v"
+	.string	"\326\016"
+	.string	"\223}\005yr\342_P\246\326m\350\246\227\034\272+\313%\215\177\001\310\226-&\227\021f(\277\332\346\302\314\273\313v\302\033\254\0369\032\377B\215\272:\251\013SpVi\302\231Zr\370\320I\273*\322&ws\3567\343\314,\235\003n\310\225\306\266l\350\246\\\017\027\267> \215\257\237\r:#\360w\345\n\\\320\0307\2534\335\314*#\370\344\374\225\227s5EJ\310\224\233T~\363\315\224r\331N\0203'\005\244qg\031\2729\005\343@C5\244qg\331\240\263"
+	.ascii	"X\326\254\322\\3\241\b\371\344\234#\n\322\314\323\353\242\206"
+	.ascii	"\355f\333o>\261K.\233Yu\325\346\327\270\203\241\233lbUn\250i"
+	.ascii	"\314c\201\316\007\251\245Y\245\231f6\331\340\223\363\227\033"
+	.ascii	"d\256\202\321A\271\263B\007\032*S\355\262\235\340%\314\rM\343"
+	.ascii	"\007\215%\255\322L\232hB9c!`\t\023\214\016\312\023\260\340a\201"
+	.ascii	"br\363\354:xMR`\032\017\r\335db\227\260a\202\245\361\203z\244"
+	.ascii	"\246\022S\211i\006\314\271\357\224!$\265\022\247$Gc\323L\b\221"
+	.ascii	"/\251\254\2622\253f\3172\025\016\213\246\0364Gj\364h\374 \251"
+	.ascii	"\2611\"W\212)\206\216\306\017\312\351o\"1\221\340*H\244\344\350"
+	.ascii	"\271\035\021\323\370\026\306\230FL#X/H\224\245\205-\351o\016"
+	.ascii	"1\301L\""
+	.string	"\030\206\004X\fa\021b\201Jz\013h\351\177\301\224\027\f[\215\320\225\255@ \021BV\345\025\243\215V\020\245\031\004_\351\263\314\324\343\306\364e+\275{\303\002M\343[ K\177\363\207U\232?\356\337\b]\371\nD\337\026.C\200qk\264\352\032\337\302\220\3647{\230=.\336\b]MB@\224]\335e\361\3139\253\003j\246iO\253\361-\270H\1773Li\206\331(\033\272\232\2322@r\227~\301q\251h| 6\346\016s\007\326##\206\314YY\033\200c\3125K\363\313\3742sd\220\261\345$\273s2f\342\270\231\203\r\232'F\200\350\322\337\274a\336\260jB]L|\030,\231R\326\306tC\223!\244\361\201\210\2305\254\322\254a\332\340@n\253\0030\211\247D\314\344\3026\326`\365\341\027`\302\244\032\037hG\252\245\225\301J\004\235\333X\343\003]\245\2779\303\234q\333*TU"
+	.ascii	"Mk\231\253\262:\364\333\033!\215_\341Lz3\206\275S\224w\212U\023"
+	.ascii	"\312L|\030\214YY\253v\232)\230)`=7\rC\305\214\034\215_\241.\375"
+	.ascii	"o\216\233\343VF\310MV\034\214\t\311\035~\263\252\312\274\272"
+	.ascii	"Q]\371\n\004\222\033[\035r\326\324\345\2750\255\314\033f\334"
+	.ascii	"\370H\266IiE\261\322\370\025\340\322\337\2342\247\360\024|\226"
+	.ascii	"\255r\250n\360\255\321q\243\365\244\327\370\025\232\230R\246"
+	.ascii	"\024\326{@\023\263\345\226\037Vl4~\205$\346\ns\205\331b\004&"
+	.ascii	"\013}L\216^\260@\261\270\331\342Vz\222 \327\27246\243P9\272/"
+	.ascii	"\033\215\337w+\377\2018\005)eZ\032\277\302\217\3647U\334*M\025"
+	.ascii	"\370\355Fue\254\f\344\254\372lKY\n\215_\201+5\231L&\323\t\270"
+	.ascii	"\227\201\031\253S\214M\013"
+	.string	",\215\177\263\351\246\223\345\333!\003\343F\032\256\361\304\r\035V\343\377\364\375\375u\335\b]MW\031\244a\202\353\300\263\265\342\005\233\306\377\341\302\006\273a\203\365\316\234m\262\213\252*gUmh\323\006\353\331\\\205\346\234q\343\b\007\027\227\306\377\231\222\376\207,\3751\032\253\304h\260\032k\225sSV\006D\244\234^\230\3301i\214\323`?|\303\316u\271\232k|\336\316+\375\361\236U\342=|\246\27520\211\020'\313\\U\325\341\314\217\371\260\031\254\354\334\226e\252q\205l\203\316\356\262@\347\177b\224)\203\365\356\223sv\312\231\253\306\251%\004\353\335\025\001\362\244\361\177X\244?\036\243\304c\272\n\006F\366\210l\355\034\2312\303\253\361\177\232\322\037\207\271U\3420\030\312\206\256|\205"
+	.string	"!vo\256\370\345\234\325\301\374\321G\305\324\370>|yyV\214\031\225\263\025\001\364\230\354\360\210C3V\347\305\013\266\353\234sF\242M\302\344\226>\312\364\307xV\211\361\272n\204\334te\200\032\311\016\367A\222\376\370N\211\357\254\0313*7\t\311"
+	.string	"\311^V9\304\241\320\b4\"\016K@$4\2228Z\207\036\270\240\"\225\020\256K%\b\375\344p \003\013?\362p<Z\205I\252\021Q(\002\347G\036\216jQ1)Hd\374@d\"\003\005:@\002\211\020@\bR \204\006J\b\206 \"8\202\204\237U=~P\221J\b\211\0248\222\240\032\227V\241j\302\207\004\037\245\"\321\320H\342\b$\202\t\030X\207D\022\200R ))\201\360\203$$:Z\205I\037\216\353\260\304\207%\242\321\006(\226\210C\244\r\024\360A\360\003\020(>\254Gb\221\3104\261\022\207F\244\323\003I(\030\021\207\306\365\370A-ZB\"\"\016?\030\217K\037. !-\021\211E\"\272\006\325\023\f\217'\nE\343\321Z$\242&\204*\022N\241D\224\244&\235?\362\220b\002\253Z\001\013>"
+	.ascii	"\260 \205R1\204\240\340Q\251\030\302\317\372#\017FJ\037\214\224"
+	.ascii	"\210\210K9D\023m\036\203FJ:k\220h\244d\022\215\224\356\321jD"
+	.ascii	"T\221N\365\004\303#>\036UcQ\221\020M\241T$\302\306U\351\026\251"
+	.ascii	"D\243!\222\020-R\217K\370\210\336\0304R\362\260c\024\036\021"
+	.ascii	"\341\024\306\36584RE\004\251HF\304\341\b\037$\341R\210!\222:"
+	.ascii	"\002Q\210\244d\034\202P\301\2108\364\200\021q\230\002I\004\013"
+	.ascii	">$L`h$\261s4\"\016\217\0348\016+\034\215\204H\"\030\021\207I"
+	.ascii	"Fa\316q\035\032Q\310\001R\221J\bI\354p\340\241'\025\256\302\020"
+	.ascii	"EC%\364G\036\216HE\343J,\022\005\2114\024\021\205II\305\020\210"
+	.ascii	"\214\300\242b\t=8(\206%\024\t"
+	.string	"\213\030\370\371\221\007\242\240\361\003\221\t\001\034W\341z\3049\346h@5.Y \272 \251\270\036\227B(\022\026\221,\034\317\022|\326!\221\204#\016\2618\\\211T\3430\004\217\bF\r\224@\034&\031\325U-\332\240&\rW\245b\021\003EC\023~|8\360\260\032\205J\036\326!\221\204c\n\241\321\b\002\206\034\035\341*\fAd<{\222\324\365\230bD\260B\221\004\212%\020, \252\353:4z\300<V@]\205EJK\025\326\340\321\250\"-Q@-ZZ\207\353*\fZ\2039\353\252\006\213H@Q,\201\216X\211\252\321\270D\364\263\376\310\203\211\017\304bRR\221\250\203\024}\f\032\325\025i(B\221p\311\004\303\022<\034\224\350\241\022\335A\211\036\022v\007\302\036B\321\035\240\350\241\024]\341D\307 Q\204U=\252\"\214\224\202N44\252D\325(\275\002>\330\340\003\020(\320\203`"
+	.ascii	"\007\f\340\340<\b\006\f\r"
+	.string	"1\340\203\241\364\037\f\335!\017\035\200\b\252\253\020I)I]\203A\013j\320H\210$\202j$<r\300\250&\rW\0375\210B-\"\222\360#\017\037\212C\fH\302\022IC#\036\265\250\230\204Q\020\032\357\217<,%\r\221\220\212F|D\264\016\225L\024\204)\356Q]B\022\2368\327\037y(\032*\t%-\215\270\307\240p\025\2068\016Q\200P4T\3321\301\222`CX\021\354\252\"-\031\3611xT\221\226D\350\250HK\"xV\024\305\022\367\250\032\031\205\353NN\221\252*\035\315\365G\036V\235\022t\314c\0205\026\327b\022N\361\204Q\035\241\036\227R\025\3050\t\210\302\270\006qT\245\024$> b\204\216\t>+q\251\030\202\216\272\nE\034\035U\243\tU\004\n\343\216q5\201(\202p\025\206@A(\242H\250\212 2\346\030W\023*\020E8.\255\302u\004\221\261\307\270\232"
+	.string	"\204T,N h\036\203\352*\\G\250I\303\225\270$\002\205\321\207(\202\232$4\212p<\252DE\243\tDF\037\341*\f\221#\\\205!\200kR\321(\202\211\n\307`\222\320(\\\203\035$\340\250\022\031\227\212#\212\324\243Q=\241\032{\210\303\244\213B\230tU\244\242\242a\322\251\256B#\376\221\007\024\306\017FJ@(\2148J\302$\"\243iT\213\206'\212F\245\"\025\205\021I84\252\307\037\024*\222\322R\b\023H\302#\034\265hh4\252'\212A\342\020\203\240\321\022\222\222\320\317\252\036Uc\021qX\"\270\n\217\301\244%\343Z\002U\351\b"
+	.string	"\035\025IH\204\263\032\325\023\304!\221\261h\230d\022\207Ii\t\210\324#\"\024\302\244\264\347\210$<A,\016W!RQ\311\250\256D\022\210\214\030\216\252j4RC\250HFD\020\222\204!\234P2Q\241\b\251xtT\215G$\324Uxb\270\022\201\240\026\025K0\016\205B\304!\221z\\\n\242\020&\005Q\030s\202(\226\204A\024\302\244\236\243\261h4\252A\347\252\036M\230(\346\250J)\326\237\f&L\024\327%\242"
+	.string	"\034\207(\204A\243\245\022j\321\272\244D\034bP\225R\254A\365\304p\025\236\030\032\325\"\r\306\342J$4\021,\256K\302\240\021qx\264\026\213I\307 \221Q\250\25084\252JA\023JHA5Ih4\021$2\036\203\303\343\321\230\241h\030\\\207\304\245\235\016\220P\030\217=\353Qh\"X\264$,\021<.\2258\362\240\353\217"
+	.ascii	"\020\302j\024\256#\214\210\303\"\243\020\005cQ\004$\225H\024"
+	.ascii	"\036\021]\260\263\376\310\303\272\244\264.\025\203I((}8\032\325"
+	.ascii	"\023Cc\021\006/*\251\306\017k\261h\374\220\263\006\321\243\221"
+	.ascii	"\220Dqx\036\203FC\023\304b\b'\324\020G\244%\023\214\352JTC\360"
+	.ascii	"QW\241\210$\024L\3209\241\026\3355\370\301\320J\034.\245&P\215"
+	.ascii	"&\202\307\243P\t\205\"R\260\302\032\004\261\022\207K\350\207"
+	.ascii	"\206B\300\200\003\031\250@J\344\341\370a=2\032\"\231\370@\034"
+	.ascii	"\n\223>\020\031\217\037<XP<aT\217\301\"5\311($.\005\207\306\365"
+	.ascii	"\347?\252\345\f\203\325\356\240\306\346\344\222\250IK\302\323"
+	.ascii	"e\004\317J_\271\202\306\3555@E\213+\244\337\373\216\306\241p"
+	.ascii	"Z~\354y\241p(\026sJW\225\226\224\353H\031\277\306\277\240E\232"
+	.ascii	",\322D\314K\2259T\315/\312\025\225\023/\3351\204\216k\n>\323"
+	.ascii	"H2d`R\320\246=24>\3207\264\205\026\214+\034nW8\370\3518k\214"
+	.ascii	"\266\241P\216F9\032\245\321(\367\357"
+	.string	"\357T\202\327\344TSC\237 "
+	.string	"\013\232\331\232\265\243O\254@\2159s\327\030u\322\344\202\234\376h\032\266\363\313\322\205\205\262\353\326\312\330\271h\214.A\227\240g\326\003\033(\223\243g\031\350\221\311h\214&\255\032\2172\036O4\200I\177\324\3544\362\227\224R\202\241l\261y\2515F\221\240H\3202 \023\230\2517\261\243e(\331\t\034O3\310\320\261\024\210_\f\262\026F\374\214\274\245?z\304\264A\007#\314\205\2217vK\376\302\204\bA\211d\360\2243TN\001\344\213m9\344(\221\213\345\n\334Z\020\263\364G\221X\017\257\315"
+	.ascii	"\373\nb6\001>\251\034@N3=y]9\244~\\aA&\3611\205\353J\251\265"
+	.ascii	"\206\013U\032\036\370Ml\307\330X\343\334\203\235\262`m5F\277"
+	.ascii	"\320/t\207\255\252\342#\300\227\232+\244_\316\202\261\341"
+	.string	"Gq\034\335\201\352\270a\304\312\274P\035h\016\224\311F\234_\373x\273\342\246aH\232\226\324\241\242\352\321u\003\rG*\252\013\220\256&x\354\353\255\207\r\263\213\204\251#\303ej\t\363\"\213\221\032&\224\264\315\017\tr\313\344b\336\210\372r\246UEK\007\r+t\306Q\032=|1nh5Fe\240YH\220O\3004\276U\236L\031\"c\246\2305FS@c\200!\327\250\350}Y\345W\304/\f\214\323\r\235*c\243\003K\315N\217 =\236\256p\21784 ^\250\325Y\206E\245\207\225\25296\264\275*\215\321)t\3124\313\001\344\n)F\343\315]\343kx\201J\241RX/\355\307\025\322Dr\306\306\233\337\323\023\332\302\236e\252\006\2301[#\206\3634c\217\213\305\321\026\2672\004\f\323\217\306h\324\255t\251\271\315h\214\256\270\025\032;\260\330\032\243P\267\302fm\t^cT\005"
+	.string	"\246\240\031\315h\323\022\264\262\245\037\017\027\035-\\\240LG\233\234\214\370\200\202\331v\304\310t\231\321\370"
+	.string	"\320\321\3673M\337\371\346zq\223\313a\342\202\311\2265?\337\374t\323\201\007'#v\304KS\343\263\315y\262\264LY6\376\311\006\207H\016%\222\306\337\340?0=\213ae\325\370TS\204\214\324^\343\323\357Vt\262\276\370\355@\003"
+	.string	"\033\313\345i\306\236e\252\241/2\030bK\326\334)9\371~\232\331\351K\2633;\367\366\312\2241\315\002\206@\250\343\021\204RH.\3050\214tJ)\204\210\206&I:\243\025@ P@\036\227\212\266\311v\023\300\303\313lU1\021\203L1C4\"\"AS\220\202Ja\230\003C\3603)8\260?\257\025\377\023>\233"
+	.string	"DO\274\212p\017N\204\030\243\030\274\370^\365\250\031\323`\240\347{EZ\221\317\016(7\367y\017\205\301=\036f,\200\217\024\274\244R\222\342\367\262-\266{\240\240\365d\302,_\225S2\0266\2747\017\211\f\004\307\205!\347\267\035\333\2016,\253t\216]Q\256q\253\347\201F\203(\362\\\263\037\007O\334t=\214Y\324e%k\310FOR\257%\r\225jB\f\327y\242\211"
+	.string	"\263\002&\212.\002A\264\340\303Z\255\271C\343C\315\257"
+	.ascii	"P?]\004\235\035>\354\370\230\312\023\352\212\252\332\371\033"
+	.ascii	"#\272\351\322\333\320\325b\375\377\357\226De5\005A\210\353\330"
+	.ascii	"\313\024\260\350_Q\341S\226\367,\301\247^q\353q\211\303\\\223"
+	.ascii	"\355\247\266a\235\314\024\342\016\302T\364\326J-V\347\355\323"
+	.ascii	"\224o\211\306\332\231\327(\240\350V\025\023}\276\315@\001l\216"
+	.ascii	"6\002e\3164c@:\251"
+	.string	"\004\311\017\251FG\007:\261\304\251\335+z&x\277\350;\205\255\002C>S1\256\360\021\024\fX\020\365\262)(\266\r\233\305\355\203\230k\347N\fH\341\267\204\270\317\334\353g0\224\0308\2706*\344\220{3\002\032\f\r\216\371\303\022\270f\256\235bX\233\240\365\236\261i\203\020.G\320\247@$\177\350\013&\256\347\241\2773\003Bg\bo\t\n\025\030\273Qq7\003\035~\324\372\227\327\211;\254\034\fv4.\022Uv\241\2158\324]6\257\370\273\2028\3500\247\200A\200\322\345y\305\0355\342\037\034\316\342\353LRn\337\r\334\315\327Y\356\227\035\330\024\034\361<\020!\272L8\0334\r\357\225\034\366:\215,\233C\006l7\217\276\035;e\227nh\361d\247i\\\032\003\203\t\300\376=1\237\031a}E\220\334\351C\f\255\367B\332\036\350\034\272\034\267\233\tX't\331\002\024\036e\341\231\264"
+	.string	"\345\373\314a\344\212\204\322\213;\204\357\035\252\2323R\306\225\223\020p\006\211\364\b\026\355\254E\253\022i\035\342\222\303bY\271\257*\375{T\003L\217\307s|\002\317\326rF\270\215\233\314\276dL\265\004\223!\365J\354\340nh\303\351\r\204\247%K\264\3669\321z@\232#\\\200\353&\177 4\202q\177\251F\250\035\205\353\314\311\336:\235\220\267\037\305\362\254\360\267\216f\r\377\206\324u\220|\275\247 l/\274\r@\365\037\320\001\344\177\025=\302v7\352\"\257\234\256\2372$uN#X\013\353\372\212\345\017\355U\341:H5\300\031q\354]3\017o\365\2028"
+	.ascii	"\017\306\200&\304Z^\021+=\270\221P\246D>\315\230\316\240=d\034"
+	.ascii	"\344\f\222\265\210NT%Z\252\235\330\277j\2044\251\372\3133\203"
+	.ascii	"\254\032\334p"
+	.string	"5\255TcdQr.p>\221+\344\210\333\334\244\370\362[\027\027AK\360\370\366\352Ba6\271\215\r\375\334\261\355\216_1\212\374\206X\217\304\177\277\317\220\312\030\357\203\256\021\226\343>\376|\371\210\023\006\334\037\t3\334U\252A-\234Hm\222V\214\016,\244\370\037\265T~[\272\204n\371\231\367\245\207\245|\212\215\344\272+\315-\201\033\342\245@\\\t\361i'\005G\030\233 !G$\303i\3115\256c\213\035\312\005\243Ny\211\275\247[\264@AubB\202K\330\001q\232\323\351\341\375\320\241\300bd)~K6$c\207\020\370\322\221\357\bc}\210\032\240\360\327\211\225!\332W\204\371D\263U+N<\354\003\333\351\235\312/\2636\2361t\372uy\301F:H\262(p\3762\236U\221\323\353\222\310\311\337r\344T\r\325\243;z\240\331&v\016\ny\217\300\267s\375\313C:\2610\300_"
+	.ascii	"\3012\367N\307\322\321\244\333ueI75\311\346\313\350\215\016r"
+	.ascii	"_=\342\b\204\210q\206\302r\341\365$z\364e\344\372C1\346\343e"
+	.ascii	"\244\305\275\006\377\271\330\256\245\2224 \327\022\2400\007\024"
+	.ascii	"\251\034\256F#\324\333\036#J\376\26545(\034#\026\254S\220&(\336"
+	.ascii	"\302\354>\324\251\251y)\205\256\016\245(\n{\212L\224)\230%\250"
+	.ascii	"c\366\300\232\240X9\333\245\227[B\022\363(|\315\037\202\341K"
+	.ascii	"\271\033\337\220\305\205\021\215\303\312\346k\270\007\200\301"
+	.ascii	"W\247\355c\f\311%\242\230\357\351\344\361v\306\347O\030\345\227"
+	.ascii	"\003\352et\030\\\211\007\277F\027\3005\324\313\322|'\001\370"
+	.ascii	"\3003$\246\227_\360\243e\346\035\tn)\\:m\347*\205)\240EFe\035"
+	.ascii	"1\231g?\024\355\313\3408\025\245\fN\323\227\220\235\256^+\245"
+	.ascii	"\301\266\212\267\226\035:\230\021\214\"\332\272?g\265\256\223"
+	.ascii	"Bt\205cN\224\027\177\037(\260\3417C\007\026\300\371`\3323\344"
+	.ascii	"(\275\210ACz5\337\204\226\241B,\220\240\263A`\201M\0344\200("
+	.ascii	"\033"
+	.ascii	"\223\315\210\001\200d\037\276%`lr\020\205\367\207\361!\272@\023"
+	.ascii	"\033n\332\300\264\004O\3068\\\027\3140\0055\006EI\033\374\340"
+	.ascii	"\354\370\225R\210\327\240\005N;v\254\032\026\030\212\034A\252"
+	.ascii	"!\261\005\356\255\230]\237\264\351\325]\363\326*D~1\303\225/"
+	.ascii	"\266\367T?\354\271\241\007.K\002\240$Q${\3147\035\035\210%\024"
+	.ascii	"\231l\275Z\003\212\316\217\236\017v\fs)\375\226\236\272&T\201"
+	.ascii	"\331d\352\357\376n\314\274'QI\253 X\031\207\033\306\336.\365"
+	.ascii	"\344^\030\267\016BS\334\324i\346\221\232\333\352\270n\224\347"
+	.ascii	"\364G\001\330Z]\\\2052\\ \215)\313kB\342\240\023\354\340^\274"
+	.ascii	")\\\f\002*8/\216+\314\222\337\260x7\004\007\240\234J\247\261"
+	.ascii	"d\200\336r9\300\221\034t\346\261\300\350\325\366\376w\350L\234"
+	.ascii	"\216\354\346\334\211\226\017\336\232u\250\242\247\265Z\311K\264"
+	.ascii	"h\231\253\217\313\314~Ah\026p\263\334B*\205W\223\314\234\340"
+	.ascii	"\270\022\375\235\355\204X\001\271\nR2\225\250\353\361l\241\\"
+	.ascii	"\003v\314\244"
+	.string	",\321\3448\252|N\275\031\266\377\250v\246\375\023\243\"\317\231C@\t\212D\361\371\242j\3566[#\371\365{z\3401\322V\003\265\"R\026D\003\025\351\216\004\237\027\031X4>\230\245_\255\023(\221\370\267\217\027$\360\363\204\377tI\202\2326\320dB\355\201\222\373\262\201\004\342U\241\256\001``\342\341\302\353\362\330\340\357\023\275\367\256\036x!3*M\345\300\373\273\034\215\2709\317\0304\342\002\377\320\204\337\026\\\275\240\271-\002\224~H\316\020\366\247\327\302\327D\214\005\001\255/\360\351*\f\007i\373@Og\236x\nN'\330\261<\355\244\263:W\022G\3340\306\031\253}\220\306\267\b\037\324Y\200\2467\244\271\n\017\300\b\344\3151p@@\316\311{\234\372\213\261hEWC\257\\\213!\335\023\035\024\004m\273\021\306~\3066<8\264!\276D\337\031\350\322\352tK\036\364\024J\376\305\271\377\230"
+	.string	"M\017Z\024Q\231\026\347\257\233\301\332 \032\315\361\016\236\226\030mr\200\221\274\343E\036\235\312\317h<\263N\261\035\340G\252\350\270\275\222\333\227U\337\212@\232B\f\355\344>3\331\363\267\267\265\235\313\034^\213\324F\274\303]\037!'\312\242.\363+\260\247\227\013\300\330\321\373\301\251L\3247\"\335$\265#\363\236\265\222yNxKL\036c\030v\333\034\301~\235\371\244w\0253\267\030h\347>P\241\344\243\314v\027\264/A\036\316\237g\rP\004\356\263H==\035S\331"
+	.string	"\376\206kk-\247\226\214\2568\331\251\344;\3209#\004\355\250\276\205\021@HO\341$\025\022N<\253\355\200\341\021\366\301\314\334\264gg\341\317\355\351\374\371\302\334u7\\\t(s\027J\230\250\022S\256\032\357]F\247\036U3\361 \245\266\367\023m\024\201\n\b\215u\031\024 \345\3556<\226\224A'\364s\t6\223\264\004\313D \355y`\013\302\233 c\202\036\221\252[\r\242w71\002]B=\230\277\25640\022:\340=\351\341b\004g\363ln\257p\246W\247\257\006\035*\n\340Eo\004\242l\253\344\347d_\315\343\207\005\307\312Vt\376J\\\"Z\017\322\0012\004\344\273*\262h\316\031\214n'Tr\325\016\372\375z\337\327z\007\2652\234\331\005\322Jy\r\022\337R\301\272\3361\024\256l%\302\2133\214\2725\261P\315I"
+	.string	"IP\260\"\336\2461@2h~\025\375!\256\304*\304\t\233\361s(\203]\254k\200\263e\326x\217\215"
+	.string	"\030\316\320\305\216\247/\341d,\365\347-$v\330[\277\f*\253\246l\333\347\304\274L\315\326\374zx\222S\366\206.\024\343\240\367.\200kz\222\022\033EK\003\352\3059s\373I\313G\212%\272J\271\231W\242b\343Z\367\242k `\216\221t\216\2534\303\255\341\244\304\260;\005\223\270\217\003[X\236%\023\322HYC\300\034\327\352\035A\314K\004\352\200\307\2173F|\005i\343\354\220rB\002\026\t5."
+	.string	"B/\027\342\233\2052B\\\235\"\236\324.\347\375>o\b(\323\272\021o\202\003\377C)\020\327\367\356m\211\300\370\254,}$\021\3206d\336fM8n,\362\341&\316\235\266\324\3541\203\245DS\b\303\303\345*Y\365\034\326r\251L\202\r\212C\243\343\323\254Pa\221\320x\212\313On\025^;\243D\361W6I\020\355\035\022\315$\323S$\017\023\321b"
+	.string	"\t\357\215\306\331\377\031)\340?\330ry\266dd\t\263\0049\201\316\307]p\340?U\2507\005VS\005\203\336\252\023,\324\227\252\374n\205\245\264\370\006\020\016\023\206C\335E\250U;\312\263LD\265\b\007\241P]\335n{\304\232\207\337\232\272\005\307\200\362\214e\254\031\230o6e\367\216\362"
+	.string	"\363\206\346\302"
+	.ascii	"\304)\335\003@1\232\222c\311\304\233\360\253\t\002'\370\247`"
+	.ascii	"\223]\264E\t\002\020_\371"
+	.string	"\033\341k\002(|\302b\250K\bJ:\246\354\244\251\001\362\317\261z}\021\363\036\223%\272\231\2437\237\007\353&ld\320-\001\235\231FaN\253\210\206\352\367\240\307\tSt\373L\357\237\b\332\377O'T\371\354\\BN\374\324\312\343\f+64G]\242\267Q2\026\245\277<\271\215\f\336p\332\006\366,~=\003\020\035\003S\354V\242~*a\217M4\307m\364d\341\f4\226\n?\346\325\221\267\327\362\376\227\366\303Du\203\302~\223\321\322?\376sv\312)\334\"8\256\373#\260\3653\367\235\232\177\"\3727.\374n\211?\350AO9\367V\346r\260\177$\370\227\204\336\231\344b\214a\376\352\277!\374\t\300D\226\364\223\230\270\f\362+\016>$\374\263\265\357\337I\362\203\343Y\343\031\003\033\272\330\225\246\374\276\315\f\177\004\344\266\trro\352\031\220\265\207\226S\271{\n\366O\320\334\354\333\362\257"
+	.string	"c\362\311X\026\2202\332\265\231\360.\377\223A\334\337=\257\321\343\251\235\367\364\320\263W\334T\221\213\206\343\322iah\332`v\364\241[;\325\360\222d\321\363CtS9\016L\177w\266,\360\301\177\361\361D w\252a$\373\221\374\352\026\330{\r\316\342\030.\324\366^?\215c\303\035\334VZ\366C,X\375\347s}\312\366\222\3411O]\374\300_<2\003\304\007d\217\2762\316D\350\312\204\317;\234\f"
+	.ascii	"\375\017\346\266\265m\341\315\250\237Y>\245n1\314\211\242\237"
+	.ascii	"7\304\235\261\005{4\013\323U\331\275x\353(L=b\372\307\252\325"
+	.ascii	"2\272\243\301\026\203\016J\366\264\377=i\275\343\266\013\305"
+	.ascii	"\257A\356\247\346\364\267t&\364(\330{\352\0356<)\257\332\243"
+	.ascii	"\341\035\224\215\r_Lr\234\f\255\342\317p\344\355\352\35206\177"
+	.ascii	"?f\035\214mw\213\271\f\335\356\305}!\\\030\027\352E\350\242\251"
+	.ascii	"\2745\360\320{d\331\242\335\256L\002{\020\206Y\217w`M\226\343"
+	.ascii	"W\004\001\036 \256\001p#\322\003\2024:\"\377\245\354\003r\264"
+	.ascii	"\254\370a\257k,\261\017\265\225\224\276\200TD\2548\201w\005"
+	.text
+	.section	.gnu.lto_.symtab.39163b6117bc7f98,"e",@progbits
+	.string	"pgResetFn_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"determineServoMiddleOrForwardFromChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"servoDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"servoConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"servoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"servoMixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"gimbalConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"servosFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"gimbalConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"gimbalConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"mixerIsTricopter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.39163b6117bc7f98,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,271 @@
+	.file	"servos_tricopter.c"
+	.section	.gnu.lto_.profile.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 '\035\001"
+	.string	"\350\033"
+	.string	"\003"
+	.string	"\242\316\326\257\007\002\002"
+	.string	"\002\001\002\262\374\202\245\005"
+	.string	"\003\274\205\242\255\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\003"
+	.string	""
+	.string	"\003\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\024\003t"
+	.string	"\003"
+	.string	""
+	.string	"\005\200\200\200\200\002e\001"
+	.string	""
+	.string	"\002\004d"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\003f\001"
+	.string	"\201\200\200\200~\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"M\005\320\025v\216\302\362\022\203\347=,C\270\334\272\2016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \030\245"
+	.string	""
+	.string	"p\f"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\204\004\002\230\004\003\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 &\275"
+	.string	""
+	.string	"X\032"
+	.string	"\002"
+	.string	"\001\002\002\001"
+	.string	"\002"
+	.string	"\004"
+	.ascii	"<K\200\320 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.18a65faa9ffb73d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servosTricopterIsEnabledServoUnarmed.25.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"m\007"
+	.string	"BN46@o\323\001\230\016\004\267&\203E\002\335(F\034\247"
+	.string	"\025"
+	.string	",\250\275\031Hh\274_\271\261\361\020\256\332\030\3161L\314\201\300\210\340P:\254\215\361\374\326\232\224)\005\256:\321\322<XuEm!\303*\242\225A\355\301\341\202h\200\022\027C\004\254b\006;\034c\036+B\r\303\"\334|\334\247\325\221*\001\247\235\375\001\314U\365\241\224\316\023'\311"
+	.string	"v1\022\374\221\223(|\220S\266\370\344\275S\376\007s\352\252!qY\262\277.\265\303\376\264:\262\235\326L\177\322\230\004\250\354j\224^\226\205B\t\261\r\26276@"
+	.string	"y\023\310\320\226\223P\211\313\356\007\325\343\333s\363/\362\002\216\025Ot\361\314(\354\256\323\023m\334z\333\034\333\007\266?\002\t"
+	.ascii	"2\241Y\037x\301D\360SA\273&\372Ed$D\036w\243\323N2"
+	.text
+	.section	.gnu.lto_servosTricopterMixer.26.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \331\365\005"
+	.string	"\342J)1p\307\351\220,tB_\313\275 \360\016\355\035\301,\345\023i\206E\210\320\346\240\334\027t?\263\370\215fU\r\212\363\235\307\372\241\372\326\243\311\227[\246\247&Z\325kR\026\255\022ljh\205\311j\251X\027\212\314X\023\214\244(&\247\307\347UQY\347\244R\372z\331\213\f@\017o\347\370s:q\2713\n\300\215\265\377\323\"\013\374{h\366~\226\002\026aw(lh0R \370\277\322\263\177\241\361Q$\200\020\030\272[\362\300f\033\263\357\036l\202\353\264\215\210Hw?r\035\300\236\367\277\343?\344\377&\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_servosTricopterInit.27.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \306]\005"
+	.string	"\262\211$+pm:\240{\263\017-\302\try\270F]\0306 \324\304\213\265/\350\300\202?\235\243\252\3522\026\274\\\030\003P\204\350\357-S\277,\212Um^\031\255\214mV(\266q\215@2\311\203)Yc\302\027\335\330J|j\030\345:'\345*\354\225\340\301\"/\177\330E\311\371\027\320\022\374cE*\224\2725)T\217\002!\317\377\255\316\375&\003\206 \312\200N\335\315\262\263\334F\356\273\237\035x_\267Q\260\350\356G\357\333\354\345\376G\374W\374w\004\b"
+	.ascii	"3\003\316\231\001\340\313]\303W!\364\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 zu\002"
+	.string	"\"\004\017\033\2605\215\001\f\303Y\305\222\2509\201\276\033\206aaj&\242\367$m\313-w\n.\307\376\255\320\257\311`8\344\bgT\272\242T\305\216\244Vs@O\005\200c\377\350\210Re\002\005"
+	.ascii	"U\204Z\3412\\\366v\322\031\202Ve"
+	.text
+	.section	.gnu.lto_.refs.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.18a65faa9ffb73d,"e",@progbits
+	.string	"(\265/\375`t\007\375-"
+	.string	"ZSp\022F`\236n1\177\336\367=\016\251\356\2733-\207'*Nw\213\230\364!\365\311\027@\030\312\351\3646\262\030\327\300!\037\255\244\002\356\242\343\314D\246?8\023\200OS\013\027C\370\205U\236e\004\223\365\213K+wJ\001"
+	.ascii	"\001\021\001\021\001Y\374J:\243\375\321\252\255\301R-\206\216"
+	.ascii	"\272\377\231\210\b\210\250\207\324\361\026\206U\333\327\374\313"
+	.ascii	"\2117\300*\217XZ\250\352E\325b\363Q\004U\333\237\260\316\345"
+	.ascii	"\327\336\305gE*\347\347YPE-\rUs|\t\333\376\203m\257\301\266\307"
+	.ascii	"\254\220\037Y\035\367Y\235\212W\361%\004\267\322n\346g\3353\316"
+	.ascii	"?\243^xfKTm\026l;\2045}>\035\302\332N\254\317\177V\264i\202\355"
+	.ascii	"8\377Y}v1_\0069\263)\\\350\024\036\373\260\377\231g@\036\223"
+	.ascii	"\274;Tm\020c\275\304\365\027Z\210m\017Z\375\351Ak\243l\327\371"
+	.ascii	"\317\332\355N\272\275\211\207\005\2451\226\374e\377s\017\317"
+	.ascii	"\254\225\325\003U{\366\237\225u\237\325\341tw\235w\267\317u\267"
+	.ascii	"\263\273\237y\335\255\240\215\343u\367]w\333u\367\233\356\246"
+	.ascii	"\353n4\335}\246\273\303\272\233\355\356\265\356V\237\317\347"
+	.ascii	"\263\273\253\272\275\256\273G\027\276f<\313\357\374\367\262\253"
+	.ascii	"G6\370\337\222\221N\243\rG\263j\306\260\242b\224}\376\377\003"
+	.ascii	"YV]\362\037\233q\022\371?\211\225\323gY\200\347\346\007\361&"
+	.ascii	"\334c\353\261\256\376\021d\375\303\376\315\377\207\377?\007\271"
+	.ascii	"5\377\343\360\305_YY\377J\240\254\337\202\323\256\376\321"
+	.string	"28\264d\314\354\222\177iQ\230_\337b\206\375\353\235\\H\226\t\213=\326\377\373\034\373\225\244!\207\252h\004\300b>\272\240j\243E\340\234,\016\255\273e\024)N\226\316_9R\272\362\336\374\214\233\3612\276t\247\273\265\217q2eN\237\202W\301\235\236\346m\351\214\346a\031'\356\t\205\013\356t(N\266\003\317/#\247\3539C\013\020\021\021\321N\2208^X\001T\177\377Y}\350\221m\002\271\033/#yslW\320\302\266X\272\210\373\237\333\261t\377\330|\213\257\245\363\027\200\026]0\342\272=\214\203q1\276t6WkG\363\262F\347\377\343\377\267\237u\377\332\331<\354\377\247\377;\326\276^\2715\264\363\003\006\025\253/uun\347i\254\360\260\261\035y\263\3535=\267$E\310\336\264/\375\215\247A\307\036\026@\366B\031Ag\f\316\356\fU;=\302\266\253\3615\355l\226\316\306\351"
+	.string	"(?\2053\303\001V\367J\345\020J\006\254M\316M;\235\234\316\177\330\377+"
+	.ascii	"`\004I\027\026\252\272\034\352m|\256]\316\343t\216.\247\376\033"
+	.ascii	"\335\031\354\2703\350\251\0211.W\265\323+\266\3216\266\321\356"
+	.ascii	"\365\215\310\377\237\321\233\037i\245\263z\317}\250{\200\247"
+	.ascii	"\336\340\323\226\320\374'\"\323\261H\256\030s\240jw\013}\203"
+	.ascii	"\375\303=??2fr\3011\231"
+	.string	"[\262g~\036\006\236\331\343\343\231+\251\312\217\376\374\376G\256\244\212x\226\221\361,\303\276?\312\360\377\234\364\305eF\330c&W2f\312\311\236?>\374L#\017\366('c0r\322\0273\215\311\370\310\225\354\031\"{\335x\341f\274\342b\361\361cdm\031\221\001n[%\374\020\340\025\016;\370\270m\225\360C\001\250\366-\256\030A\240\037<\021\211\030\200\275\022#\230\332'\024\301\241\206b\007\022E\007\275$t\333a\333\304\266\205#\tGHU9\215\2244!i\302\332HI\277_\322\321\217\355\243_\372\266SQ\202\001o;\025\275RQ\257\024\021\bE\025eTt\333)\241\313$\324\304\250\3265z\211D\327H\300\013\314)6\005I\020\205k\021\330$L1$*M\265\031\212OR!\334\366\035\266J\276\366\r\212\200\242\n\2413\3252\245/\360\350\307\252h\335\024\300b1\030EE|\002\022"
+	.ascii	"2\265Pnp(\005\024\272o\317\013Dz\207B\251\234\376\375\224\204"
+	.ascii	"J\200\340\300.\025\271\355\033E\\\022\272/\260H\234r\333\242"
+	.ascii	"\321\353\324$|Ja4\024\006\241\214\226\334\242Q\221\003\245\327"
+	.ascii	"\r\276#\232\206B&7H\345\0227<\265\303a\320i)\250\273Q\330N"
+	.string	"5\273\001\244\2139\353\310\220\341%\243\3174\035\342\3463T\305\303s; 9}\0232C\013\330\277r(Ub\247\006k\315\335\235\333\005\200\200\250a(f\024R\206\020$\230\031\241\231\021\027\033`\002\221)\264u\021PE\202*\250m\322\236\001\027Gb\277:\377;(\202\267\243\266\227\332\211\213\343(1\317\034\024\240M\317uy\006\333\275Ox\275CPQ\r\365J\315P\304@\264\207\007hLd;\314\237UF\377[g$\313x3\022%\021R\"\220mE\020\330\t\371\353\204\300\311\277\023\236]\377 \207\262\315\254?\032n\222T\027\337\216Z\376\224^E@\022c\035\024\344*\005\307+\005\211\232-DL\2415t\230a-}\202\372Aj\235\340O\362)\200\037\270D\300k\t|\243x>Z\322P\377\315\266]\317l\200\034\013\335\366\020\357\243\207\034\025Pmb\215`\216\355\370roL4\3527$"
+	.ascii	"\317W\310A\2637\302\t\017\214\242rh\361\360?\315\313\253\216"
+	.ascii	"\001Kr\351$\344\314\300\017\301d\357\\\332\353K\220\020X\f}d"
+	.ascii	"\247\360\355\033\2166\371\006\317\351,\253S\036\202)\203?v\353"
+	.ascii	"\275\f[t\006\337E\272|\002\377\001"
+	.text
+	.section	.gnu.lto_.symtab.18a65faa9ffb73d,"e",@progbits
+	.string	"servosTricopterIsEnabledServoUnarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"servosTricopterMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"servosTricopterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366"
+	.string	""
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.18a65faa9ffb73d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6564 @@
+# 0 "./src/main/io/asyncfatfs/asyncfatfs.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./src/main/io/asyncfatfs/asyncfatfs.c"
+# 36 "./src/main/io/asyncfatfs/asyncfatfs.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 37 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 56 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64 strtof64 (const char *__restrict __nptr,
+     char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float128 strtof128 (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float32x strtof32x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern _Float64x strtof64x (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int strfromd (char *__dest, size_t __size, const char *__format,
+       double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfromf (char *__dest, size_t __size, const char *__format,
+       float __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+extern int strfroml (char *__dest, size_t __size, const char *__format,
+       long double __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 233 "/usr/include/stdlib.h" 3 4
+extern int strfromf32 (char *__dest, size_t __size, const char * __format,
+         _Float32 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64 (char *__dest, size_t __size, const char * __format,
+         _Float64 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf128 (char *__dest, size_t __size, const char * __format,
+   _Float128 __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf32x (char *__dest, size_t __size, const char * __format,
+   _Float32x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+
+extern int strfromf64x (char *__dest, size_t __size, const char * __format,
+   _Float64x __f)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+# 273 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 274 "/usr/include/stdlib.h" 2 3 4
+
+extern long int strtol_l (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern unsigned long int strtoul_l (const char *__restrict __nptr,
+        char **__restrict __endptr,
+        int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern long long int strtoll_l (const char *__restrict __nptr,
+    char **__restrict __endptr, int __base,
+    locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+__extension__
+extern unsigned long long int strtoull_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       int __base, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 4)));
+
+extern double strtod_l (const char *__restrict __nptr,
+   char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern float strtof_l (const char *__restrict __nptr,
+         char **__restrict __endptr, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+extern long double strtold_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 317 "/usr/include/stdlib.h" 3 4
+extern _Float32 strtof32_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64 strtof64_l (const char *__restrict __nptr,
+       char **__restrict __endptr,
+       locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float128 strtof128_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float32x strtof32x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+extern _Float64x strtof64x_l (const char *__restrict __nptr,
+         char **__restrict __endptr,
+         locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+
+
+
+typedef __ino64_t ino64_t;
+
+
+
+
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+
+
+
+
+
+typedef __off_t off_t;
+
+
+
+
+
+
+typedef __off64_t off64_t;
+
+
+
+
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+
+
+
+
+typedef __ssize_t ssize_t;
+
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __useconds_t useconds_t;
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+# 49 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+    __fd_mask fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 219 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __blkcnt64_t blkcnt64_t;
+typedef __fsblkcnt64_t fsblkcnt64_t;
+typedef __fsfilcnt64_t fsfilcnt64_t;
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern char *secure_getenv (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 718 "/usr/include/stdlib.h" 3 4
+extern int mkstemp64 (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 740 "/usr/include/stdlib.h" 3 4
+extern int mkstemps64 (char *__template, int __suffixlen)
+     __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 762 "/usr/include/stdlib.h" 3 4
+extern int mkostemp (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 772 "/usr/include/stdlib.h" 3 4
+extern int mkostemp64 (char *__template, int __flags) __attribute__ ((__nonnull__ (1))) ;
+# 782 "/usr/include/stdlib.h" 3 4
+extern int mkostemps (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 794 "/usr/include/stdlib.h" 3 4
+extern int mkostemps64 (char *__template, int __suffixlen, int __flags)
+     __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+
+
+
+
+
+extern char *canonicalize_file_name (const char *__name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__malloc__))
+     __attribute__ ((__malloc__ (__builtin_free, 1))) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+
+
+typedef __compar_fn_t comparison_fn_t;
+
+
+
+typedef int (*__compar_d_fn_t) (const void *, const void *, void *);
+
+
+
+
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+
+extern void qsort_r (void *__base, size_t __nmemb, size_t __size,
+       __compar_d_fn_t __compar, void *__arg)
+  __attribute__ ((__nonnull__ (1, 4)));
+
+
+
+
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+
+
+
+
+
+
+
+extern int posix_openpt (int __oflag) ;
+
+
+
+
+
+
+
+extern int grantpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int unlockpt (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern char *ptsname (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int ptsname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+extern int getpt (void);
+
+
+
+
+
+
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 38 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 120 "/usr/include/string.h" 3 4
+extern void *rawmemchr (const void *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 133 "/usr/include/string.h" 3 4
+extern void *memrchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)))
+      __attribute__ ((__access__ (__read_only__, 1, 3)));
+
+
+
+
+
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 286 "/usr/include/string.h" 3 4
+extern char *strchrnul (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 380 "/usr/include/string.h" 3 4
+extern char *strcasestr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+
+extern void *memmem (const void *__haystack, size_t __haystacklen,
+       const void *__needle, size_t __needlelen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 3)))
+    __attribute__ ((__access__ (__read_only__, 1, 2)))
+    __attribute__ ((__access__ (__read_only__, 3, 4)));
+
+
+
+extern void *__mempcpy (void *__restrict __dest,
+   const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern void *mempcpy (void *__restrict __dest,
+        const void *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 444 "/usr/include/string.h" 3 4
+extern char *strerror_r (int __errnum, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern const char *strerrordesc_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+extern const char *strerrorname_np (int __err) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern const char *sigabbrev_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern const char *sigdescr_np (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int strverscmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strfry (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void *memfrob (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__read_write__, 1, 2)));
+# 527 "/usr/include/string.h" 3 4
+extern char *basename (const char *__filename) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 539 "/usr/include/string.h" 3 4
+
+# 39 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 21 "./src/main/platform.h"
+       
+# 176 "./src/main/platform.h"
+# 1 "./src/main/target/common_pre.h" 1
+# 21 "./src/main/target/common_pre.h"
+       
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+# 177 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 23 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 27 "./src/main/target/SITL/target.h" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 21 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "./src/main/common/utils.h" 2
+# 100 "./src/main/common/utils.h"
+
+# 100 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return (int16_t)(a-b); }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return (int32_t)(a-b); }
+
+
+
+
+
+
+static inline void memcpy_fn ( void * destination, const void * source, size_t num ) { memcpy(destination, source, num); }
+# 29 "./src/main/target/SITL/target.h" 2
+# 152 "./src/main/target/SITL/target.h"
+extern uint32_t SystemCoreClock;
+
+typedef enum
+{
+    Mode_TEST = 0x0,
+    Mode_Out_PP = 0x10
+} GPIO_Mode;
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct
+{
+  uint32_t IDR;
+  uint32_t ODR;
+  uint32_t BSRR;
+  uint32_t BRR;
+} GPIO_TypeDef;
+
+
+
+typedef struct
+{
+    void* test;
+} TIM_TypeDef;
+
+typedef struct
+{
+    void* test;
+} TIM_OCInitTypeDef;
+
+typedef struct {
+    void* test;
+} DMA_TypeDef;
+
+typedef struct {
+    void* test;
+} DMA_Channel_TypeDef;
+
+uint8_t DMA_GetFlagStatus(void *);
+void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState );
+void DMA_ClearFlag(uint32_t);
+
+typedef struct
+{
+    void* test;
+} SPI_TypeDef;
+
+typedef struct
+{
+    void* test;
+} USART_TypeDef;
+# 225 "./src/main/target/SITL/target.h"
+typedef struct
+{
+    void* test;
+} I2C_TypeDef;
+
+typedef enum
+{
+  FLASH_BUSY = 1,
+  FLASH_ERROR_PG,
+  FLASH_ERROR_WRP,
+  FLASH_COMPLETE,
+  FLASH_TIMEOUT
+} FLASH_Status;
+
+typedef struct {
+    double timestamp;
+    double imu_angular_velocity_rpy[3];
+    double imu_linear_acceleration_xyz[3];
+    double imu_orientation_quat[4];
+    double velocity_xyz[3];
+    double position_xyz[3];
+} fdm_packet;
+typedef struct {
+    float motor_speed[4];
+} servo_packet;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address);
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data);
+
+uint64_t nanos64_real(void);
+uint64_t micros64_real(void);
+uint64_t millis64_real(void);
+void delayMicroseconds_real(uint32_t us);
+uint64_t micros64(void);
+uint64_t millis64(void);
+
+int lockMainPID(void);
+# 178 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_deprecated_post.h" 1
+# 24 "./src/main/target/common_deprecated_post.h"
+       
+# 179 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 23 "./src/main/target/common_post.h"
+       
+
+# 1 "./src/main/build/version.h" 1
+# 21 "./src/main/build/version.h"
+       
+# 32 "./src/main/build/version.h"
+extern const char* const targetName;
+
+
+extern const char* const shortGitRevision;
+
+
+extern const char* const buildDate;
+
+
+extern const char* const buildTime;
+# 26 "./src/main/target/common_post.h" 2
+# 351 "./src/main/target/common_post.h"
+extern uint8_t eepromData[32768];
+# 180 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_defaults_post.h" 1
+# 181 "./src/main/platform.h" 2
+# 41 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+
+
+
+
+
+
+# 1 "./src/main/io/asyncfatfs/asyncfatfs.h" 1
+# 21 "./src/main/io/asyncfatfs/asyncfatfs.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 25 "./src/main/io/asyncfatfs/asyncfatfs.h" 2
+
+# 1 "./src/main/io/asyncfatfs/fat_standard.h" 1
+# 21 "./src/main/io/asyncfatfs/fat_standard.h"
+       
+# 56 "./src/main/io/asyncfatfs/fat_standard.h"
+typedef enum {
+    FAT_FILESYSTEM_TYPE_INVALID,
+    FAT_FILESYSTEM_TYPE_FAT12,
+    FAT_FILESYSTEM_TYPE_FAT16,
+    FAT_FILESYSTEM_TYPE_FAT32
+} fatFilesystemType_e;
+
+typedef struct mbrPartitionEntry_t {
+    uint8_t bootFlag;
+    uint8_t chsBegin[3];
+    uint8_t type;
+    uint8_t chsEnd[3];
+    uint32_t lbaBegin;
+    uint32_t numSectors;
+} __attribute__((packed)) mbrPartitionEntry_t;
+
+typedef struct fat16Descriptor_t {
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat16Descriptor_t;
+
+typedef struct fat32Descriptor_t {
+    uint32_t FATSize32;
+    uint16_t extFlags;
+    uint16_t fsVer;
+    uint32_t rootCluster;
+    uint16_t fsInfo;
+    uint16_t backupBootSector;
+    uint8_t reserved[12];
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat32Descriptor_t;
+
+typedef struct fatVolumeID_t {
+    uint8_t jmpBoot[3];
+    char oemName[8];
+    uint16_t bytesPerSector;
+    uint8_t sectorsPerCluster;
+    uint16_t reservedSectorCount;
+    uint8_t numFATs;
+    uint16_t rootEntryCount;
+    uint16_t totalSectors16;
+    uint8_t media;
+    uint16_t FATSize16;
+    uint16_t sectorsPerTrack;
+    uint16_t numHeads;
+    uint32_t hiddenSectors;
+    uint32_t totalSectors32;
+    union {
+        fat16Descriptor_t fat16;
+        fat32Descriptor_t fat32;
+    } fatDescriptor;
+} __attribute__((packed)) fatVolumeID_t;
+
+typedef struct fatDirectoryEntry_t {
+    char filename[11];
+    uint8_t attrib;
+    uint8_t ntReserved;
+    uint8_t creationTimeTenths;
+    uint16_t creationTime;
+    uint16_t creationDate;
+    uint16_t lastAccessDate;
+    uint16_t firstClusterHigh;
+    uint16_t lastWriteTime;
+    uint16_t lastWriteDate;
+    uint16_t firstClusterLow;
+    uint32_t fileSize;
+} __attribute__((packed)) fatDirectoryEntry_t;
+
+uint32_t fat32_decodeClusterNumber(uint32_t clusterNumber);
+
+
+# 135 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 135 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat32_isEndOfChainMarker(uint32_t clusterNumber);
+
+# 136 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 136 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat16_isEndOfChainMarker(uint16_t clusterNumber);
+
+
+# 138 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 138 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isFreeSpace(uint32_t clusterNumber);
+
+
+# 140 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 140 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryTerminator(fatDirectoryEntry_t *entry);
+
+# 141 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 141 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryEmpty(fatDirectoryEntry_t *entry);
+
+void fat_convertFilenameToFATStyle(const char *filename, uint8_t *fatFilename);
+# 27 "./src/main/io/asyncfatfs/asyncfatfs.h" 2
+
+typedef struct afatfsFile_t *afatfsFilePtr_t;
+
+typedef enum {
+    AFATFS_FILESYSTEM_STATE_UNKNOWN,
+    AFATFS_FILESYSTEM_STATE_FATAL,
+    AFATFS_FILESYSTEM_STATE_INITIALIZATION,
+    AFATFS_FILESYSTEM_STATE_READY
+} afatfsFilesystemState_e;
+
+typedef enum {
+    AFATFS_OPERATION_IN_PROGRESS,
+    AFATFS_OPERATION_SUCCESS,
+    AFATFS_OPERATION_FAILURE
+} afatfsOperationStatus_e;
+
+typedef enum {
+    AFATFS_ERROR_NONE = 0,
+    AFATFS_ERROR_GENERIC = 1,
+    AFATFS_ERROR_BAD_MBR = 2,
+    AFATFS_ERROR_BAD_FILESYSTEM_HEADER = 3
+} afatfsError_e;
+
+typedef struct afatfsDirEntryPointer_t {
+    uint32_t sectorNumberPhysical;
+    int16_t entryIndex;
+} afatfsDirEntryPointer_t;
+
+typedef afatfsDirEntryPointer_t afatfsFinder_t;
+
+typedef enum {
+    AFATFS_SEEK_SET,
+    AFATFS_SEEK_CUR,
+    AFATFS_SEEK_END
+} afatfsSeek_e;
+
+typedef void (*afatfsFileCallback_t)(afatfsFilePtr_t file);
+typedef void (*afatfsCallback_t)(void);
+
+
+# 66 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 66 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t complete);
+
+# 67 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 67 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftruncate(afatfsFilePtr_t file, afatfsFileCallback_t callback);
+
+# 68 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 68 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+# 69 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 69 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_funlink(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+
+# 71 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 71 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_feof(afatfsFilePtr_t file);
+void afatfs_fputc(afatfsFilePtr_t file, uint8_t c);
+uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len);
+uint32_t afatfs_fread(afatfsFilePtr_t file, uint8_t *buffer, uint32_t len);
+afatfsOperationStatus_e afatfs_fseek(afatfsFilePtr_t file, int32_t offset, afatfsSeek_e whence);
+
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftell(afatfsFilePtr_t file, uint32_t *position);
+
+
+# 78 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 78 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_mkdir(const char *filename, afatfsFileCallback_t complete);
+
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_chdir(afatfsFilePtr_t dirHandle);
+
+void afatfs_findFirst(afatfsFilePtr_t directory, afatfsFinder_t *finder);
+afatfsOperationStatus_e afatfs_findNext(afatfsFilePtr_t directory, afatfsFinder_t *finder, fatDirectoryEntry_t **dirEntry);
+void afatfs_findLast(afatfsFilePtr_t directory);
+
+
+# 85 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 85 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_flush(void);
+void afatfs_init(void);
+
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_destroy(
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+                   _Bool 
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h"
+                        dirty);
+void afatfs_poll(void);
+
+uint32_t afatfs_getFreeBufferSpace(void);
+uint32_t afatfs_getContiguousFreeSpace(void);
+
+# 92 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 92 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_isFull(void);
+
+afatfsFilesystemState_e afatfs_getFilesystemState(void);
+afatfsError_e afatfs_getLastError(void);
+# 48 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+
+
+# 1 "./src/main/drivers/sdcard.h" 1
+# 21 "./src/main/drivers/sdcard.h"
+       
+
+
+
+
+# 1 "./src/main/pg/sdcard.h" 1
+# 21 "./src/main/pg/sdcard.h"
+       
+
+# 1 "./src/main/pg/pg.h" 1
+# 21 "./src/main/pg/pg.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 21 "./src/main/build/build_config.h"
+       
+# 27 "./src/main/pg/pg.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint8_t length;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgElementSize(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_MASK) / reg->length;}
+# 75 "./src/main/pg/pg.h"
+extern const pgRegistry_t __pg_registry_start[];
+extern const pgRegistry_t __pg_registry_end[];
+
+
+extern const uint8_t __pg_resetdata_start[];
+extern const uint8_t __pg_resetdata_end[];
+# 194 "./src/main/pg/pg.h"
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+# 195 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 195 "./src/main/pg/pg.h"
+    pgFindScansRegistry(void);
+
+
+# 197 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 197 "./src/main/pg/pg.h"
+    pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size);
+
+# 199 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 199 "./src/main/pg/pg.h"
+    pgPatchIsValid(const pgRegistry_t* reg, int version, int offset, int size);
+
+# 200 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 200 "./src/main/pg/pg.h"
+    pgPatch(const pgRegistry_t* reg, int version, int offset, const void *from, int size);
+void pgResetAll(void);
+void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
+
+# 203 "./src/main/pg/pg.h" 3 4
+_Bool 
+# 203 "./src/main/pg/pg.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg);
+# 24 "./src/main/pg/sdcard.h" 2
+# 1 "./src/main/drivers/io.h" 1
+# 21 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 21 "./src/main/drivers/resource.h"
+       
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_LED,
+    OWNER_ADC,
+    OWNER_ADC_BATT,
+    OWNER_ADC_CURR,
+    OWNER_ADC_EXT,
+    OWNER_ADC_RSSI,
+    OWNER_SERIAL_TX,
+    OWNER_SERIAL_RX,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_SONAR_TRIGGER,
+    OWNER_SONAR_ECHO,
+    OWNER_SYSTEM,
+    OWNER_SPI_SCK,
+    OWNER_SPI_MISO,
+    OWNER_SPI_MOSI,
+    OWNER_I2C_SCL,
+    OWNER_I2C_SDA,
+    OWNER_SDCARD,
+    OWNER_SDIO_CK,
+    OWNER_SDIO_CMD,
+    OWNER_SDIO_D0,
+    OWNER_SDIO_D1,
+    OWNER_SDIO_D2,
+    OWNER_SDIO_D3,
+    OWNER_SDCARD_CS,
+    OWNER_SDCARD_DETECT,
+    OWNER_FLASH_CS,
+    OWNER_BARO_CS,
+    OWNER_GYRO_CS,
+    OWNER_OSD_CS,
+    OWNER_RX_SPI_CS,
+    OWNER_SPI_CS,
+    OWNER_GYRO_EXTI,
+    OWNER_BARO_EOC,
+    OWNER_COMPASS_EXTI,
+    OWNER_USB,
+    OWNER_USB_DETECT,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_RX_BIND,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_TRANSPONDER,
+    OWNER_VTX_POWER,
+    OWNER_VTX_CS,
+    OWNER_VTX_DATA,
+    OWNER_VTX_CLK,
+    OWNER_COMPASS_CS,
+    OWNER_RX_BIND_PLUG,
+    OWNER_ESCSERIAL,
+    OWNER_CAMERA_CONTROL,
+    OWNER_TIMUP,
+    OWNER_RANGEFINDER,
+    OWNER_RX_SPI,
+    OWNER_PINIO,
+    OWNER_USB_MSC_PIN,
+    OWNER_MCO,
+    OWNER_RX_SPI_BIND,
+    OWNER_RX_SPI_LED,
+    OWNER_PREINIT,
+    OWNER_RX_SPI_EXTI,
+    OWNER_RX_SPI_CC2500_TX_EN,
+    OWNER_RX_SPI_CC2500_LNA_EN,
+    OWNER_RX_SPI_CC2500_ANT_SEL,
+    OWNER_QUADSPI_CLK,
+    OWNER_QUADSPI_BK1IO0,
+    OWNER_QUADSPI_BK1IO1,
+    OWNER_QUADSPI_BK1IO2,
+    OWNER_QUADSPI_BK1IO3,
+    OWNER_QUADSPI_BK1CS,
+    OWNER_QUADSPI_BK2IO0,
+    OWNER_QUADSPI_BK2IO1,
+    OWNER_QUADSPI_BK2IO2,
+    OWNER_QUADSPI_BK2IO3,
+    OWNER_QUADSPI_BK2CS,
+    OWNER_BARO_XCLR,
+    OWNER_PULLUP,
+    OWNER_PULLDOWN,
+    OWNER_DSHOT_BITBANG,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+typedef struct resourceOwner_s {
+    resourceOwner_e owner;
+    uint8_t resourceIndex;
+} resourceOwner_t;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+# 29 "./src/main/drivers/io.h" 2
+
+# 1 "./src/main/drivers/io_types.h" 1
+# 21 "./src/main/drivers/io_types.h"
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+# 48 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 31 "./src/main/drivers/io.h" 2
+# 110 "./src/main/drivers/io.h"
+# 1 "./src/main/drivers/io_def.h" 1
+# 21 "./src/main/drivers/io_def.h"
+       
+# 54 "./src/main/drivers/io_def.h"
+# 1 "./src/main/drivers/io_def_generated.h" 1
+# 21 "./src/main/drivers/io_def_generated.h"
+       
+# 55 "./src/main/drivers/io_def.h" 2
+# 111 "./src/main/drivers/io.h" 2
+
+
+# 112 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 112 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 113 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 113 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+
+# 121 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 121 "./src/main/drivers/io.h"
+    IOIsFreeOrPreinit(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 25 "./src/main/pg/sdcard.h" 2
+
+typedef enum {
+    SDCARD_MODE_NONE = 0,
+    SDCARD_MODE_SPI,
+    SDCARD_MODE_SDIO,
+    SDCARD_MODE_SIM
+} sdcardMode_e;
+
+typedef struct sdcardConfig_s {
+    uint8_t useDma;
+    int8_t device;
+    ioTag_t cardDetectTag;
+    ioTag_t chipSelectTag;
+    uint8_t cardDetectInverted;
+
+    uint8_t dmaIdentifier;
+    uint8_t dmaChannel;
+
+    sdcardMode_e mode;
+} sdcardConfig_t;
+
+extern sdcardConfig_t sdcardConfig_System; extern sdcardConfig_t sdcardConfig_Copy; static inline const sdcardConfig_t* sdcardConfig(void) { return &sdcardConfig_System; } static inline sdcardConfig_t* sdcardConfigMutable(void) { return &sdcardConfig_System; } struct _dummy;
+# 27 "./src/main/drivers/sdcard.h" 2
+
+typedef struct sdcardMetadata_s {
+    uint32_t numBlocks;
+    uint16_t oemID;
+    uint8_t manufacturerID;
+
+    char productName[5];
+
+    uint32_t productSerial;
+    uint8_t productRevisionMajor;
+    uint8_t productRevisionMinor;
+
+    uint16_t productionYear;
+    uint8_t productionMonth;
+} sdcardMetadata_t;
+
+typedef enum {
+    SDCARD_BLOCK_OPERATION_READ,
+    SDCARD_BLOCK_OPERATION_WRITE,
+    SDCARD_BLOCK_OPERATION_ERASE
+} sdcardBlockOperation_e;
+
+typedef enum {
+    SDCARD_OPERATION_IN_PROGRESS,
+    SDCARD_OPERATION_BUSY,
+    SDCARD_OPERATION_SUCCESS,
+    SDCARD_OPERATION_FAILURE
+} sdcardOperationStatus_e;
+
+typedef void(*sdcard_operationCompleteCallback_c)(sdcardBlockOperation_e operation, uint32_t blockIndex, uint8_t *buffer, uint32_t callbackData);
+
+typedef void(*sdcard_profilerCallback_c)(sdcardBlockOperation_e operation, uint32_t blockIndex, uint32_t duration);
+
+void sdcard_preInit(const sdcardConfig_t *config);
+void sdcard_init(const sdcardConfig_t *config);
+
+
+# 63 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 63 "./src/main/drivers/sdcard.h"
+    sdcard_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount);
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData);
+
+
+# 68 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 68 "./src/main/drivers/sdcard.h"
+    sdcard_isInserted(void);
+
+# 69 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 69 "./src/main/drivers/sdcard.h"
+    sdcard_isInitialized(void);
+
+# 70 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 70 "./src/main/drivers/sdcard.h"
+    sdcard_isFunctional(void);
+
+
+# 72 "./src/main/drivers/sdcard.h" 3 4
+_Bool 
+# 72 "./src/main/drivers/sdcard.h"
+    sdcard_poll(void);
+const sdcardMetadata_t* sdcard_getMetadata(void);
+
+void sdcard_setProfilerCallback(sdcard_profilerCallback_c callback);
+# 51 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 21 "./src/main/common/maths.h"
+       
+# 63 "./src/main/common/maths.h"
+typedef int32_t fix12_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+
+typedef struct fp_vector {
+    float X;
+    float Y;
+    float Z;
+} t_fp_vector_def;
+
+typedef union u_fp_vector {
+    float A[3];
+    t_fp_vector_def V;
+} t_fp_vector;
+
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct fp_rotationMatrix_s {
+    float m[3][3];
+} fp_rotationMatrix_t;
+
+int gcd(int num, int denom);
+float powerf(float base, int exp);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadband(float value, float deadband);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcFrom, int srcTo, int destFrom, int destTo);
+float scaleRangef(float x, float srcFrom, float srcTo, float destFrom, float destTo);
+
+void normalizeV(struct fp_vector *src, struct fp_vector *dest);
+
+void rotateV(struct fp_vector *v, fp_angles_t *delta);
+void buildRotationMatrix(fp_angles_t *delta, fp_rotationMatrix_t *rotation);
+void applyRotation(float *v, fp_rotationMatrix_t *rotationMatrix);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+float quickMedianFilter3f(float * v);
+float quickMedianFilter5f(float * v);
+float quickMedianFilter7f(float * v);
+float quickMedianFilter9f(float * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+
+float exp_approx(float val);
+float log_approx(float val);
+float pow_approx(float a, float b);
+# 150 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+int16_t qPercent(fix12_t q);
+int16_t qMultiply(fix12_t q, int16_t input);
+fix12_t qConstruct(int16_t num, int16_t den);
+
+static inline int constrain(int amt, int low, int high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+
+static inline float constrainf(float amt, float low, float high)
+{
+    if (amt < low)
+        return low;
+    else if (amt > high)
+        return high;
+    else
+        return amt;
+}
+# 52 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+# 1 "./src/main/common/time.h" 1
+# 21 "./src/main/common/time.h"
+       
+# 31 "./src/main/common/time.h"
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+
+
+
+typedef uint32_t timeUs_t;
+
+
+
+
+
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+
+
+
+
+typedef struct timeConfig_s {
+    int16_t tz_offsetMinutes;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+
+
+# 83 "./src/main/common/time.h" 3 4
+_Bool 
+# 83 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 84 "./src/main/common/time.h" 3 4
+_Bool 
+# 84 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+# 85 "./src/main/common/time.h" 3 4
+_Bool 
+# 85 "./src/main/common/time.h"
+    dateTimeFormatLocalShort(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *utcDateTime, dateTime_t *localDateTime);
+
+
+
+
+# 91 "./src/main/common/time.h" 3 4
+_Bool 
+# 91 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 95 "./src/main/common/time.h" 3 4
+_Bool 
+# 95 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 96 "./src/main/common/time.h" 3 4
+_Bool 
+# 96 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 98 "./src/main/common/time.h" 3 4
+_Bool 
+# 98 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 99 "./src/main/common/time.h" 3 4
+_Bool 
+# 99 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+
+void rtcPersistWrite(int16_t offsetMinutes);
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcPersistRead(rtcTime_t *t);
+# 53 "./src/main/io/asyncfatfs/asyncfatfs.c" 2
+# 118 "./src/main/io/asyncfatfs/asyncfatfs.c"
+typedef enum {
+    AFATFS_SAVE_DIRECTORY_NORMAL,
+    AFATFS_SAVE_DIRECTORY_FOR_CLOSE,
+    AFATFS_SAVE_DIRECTORY_DELETED
+} afatfsSaveDirectoryEntryMode_e;
+
+typedef enum {
+    AFATFS_CACHE_STATE_EMPTY,
+    AFATFS_CACHE_STATE_IN_SYNC,
+    AFATFS_CACHE_STATE_READING,
+    AFATFS_CACHE_STATE_WRITING,
+    AFATFS_CACHE_STATE_DIRTY
+} afatfsCacheBlockState_e;
+
+typedef enum {
+    AFATFS_FILE_TYPE_NONE,
+    AFATFS_FILE_TYPE_NORMAL,
+    AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY,
+    AFATFS_FILE_TYPE_DIRECTORY
+} afatfsFileType_e;
+
+typedef enum {
+    CLUSTER_SEARCH_FREE_AT_BEGINNING_OF_FAT_SECTOR,
+    CLUSTER_SEARCH_FREE,
+    CLUSTER_SEARCH_OCCUPIED
+} afatfsClusterSearchCondition_e;
+
+enum {
+    AFATFS_CREATEFILE_PHASE_INITIAL = 0,
+    AFATFS_CREATEFILE_PHASE_FIND_FILE,
+    AFATFS_CREATEFILE_PHASE_CREATE_NEW_FILE,
+    AFATFS_CREATEFILE_PHASE_SUCCESS,
+    AFATFS_CREATEFILE_PHASE_FAILURE
+};
+
+typedef enum {
+    AFATFS_FIND_CLUSTER_IN_PROGRESS,
+    AFATFS_FIND_CLUSTER_FOUND,
+    AFATFS_FIND_CLUSTER_FATAL,
+    AFATFS_FIND_CLUSTER_NOT_FOUND
+} afatfsFindClusterStatus_e;
+
+struct afatfsFileOperation_t;
+
+typedef union afatfsFATSector_t {
+    uint8_t *bytes;
+    uint16_t *fat16;
+    uint32_t *fat32;
+} afatfsFATSector_t;
+
+typedef struct afatfsCacheBlockDescriptor_t {
+
+
+
+    uint32_t sectorIndex;
+
+
+
+
+    uint32_t writeTimestamp;
+
+
+    uint32_t accessTimestamp;
+
+
+
+
+
+
+
+    uint16_t consecutiveEraseBlockCount;
+
+    afatfsCacheBlockState_e state;
+# 199 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    unsigned locked:1;
+
+
+
+
+
+
+    unsigned retainCount:6;
+
+
+
+
+
+
+    unsigned discardable:1;
+} afatfsCacheBlockDescriptor_t;
+
+typedef enum {
+    AFATFS_FAT_PATTERN_UNTERMINATED_CHAIN,
+    AFATFS_FAT_PATTERN_TERMINATED_CHAIN,
+    AFATFS_FAT_PATTERN_FREE
+} afatfsFATPattern_e;
+
+typedef enum {
+    AFATFS_FREE_SPACE_SEARCH_PHASE_FIND_HOLE,
+    AFATFS_FREE_SPACE_SEARCH_PHASE_GROW_HOLE
+} afatfsFreeSpaceSearchPhase_e;
+
+typedef struct afatfsFreeSpaceSearch_t {
+    uint32_t candidateStart;
+    uint32_t candidateEnd;
+    uint32_t bestGapStart;
+    uint32_t bestGapLength;
+    afatfsFreeSpaceSearchPhase_e phase;
+} afatfsFreeSpaceSearch_t;
+
+typedef struct afatfsFreeSpaceFAT_t {
+    uint32_t startCluster;
+    uint32_t endCluster;
+} afatfsFreeSpaceFAT_t;
+
+typedef struct afatfsCreateFile_t {
+    afatfsFileCallback_t callback;
+
+    uint8_t phase;
+    uint8_t filename[11];
+} afatfsCreateFile_t;
+
+typedef struct afatfsSeek_t {
+    afatfsFileCallback_t callback;
+
+    uint32_t seekOffset;
+} afatfsSeek_t;
+
+typedef enum {
+    AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT = 0,
+    AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FREEFILE_DIRECTORY,
+    AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FAT,
+    AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FILE_DIRECTORY
+} afatfsAppendSuperclusterPhase_e;
+
+typedef struct afatfsAppendSupercluster_t {
+    uint32_t previousCluster;
+    uint32_t fatRewriteStartCluster;
+    uint32_t fatRewriteEndCluster;
+    afatfsAppendSuperclusterPhase_e phase;
+} afatfsAppendSupercluster_t;
+
+typedef enum {
+    AFATFS_APPEND_FREE_CLUSTER_PHASE_INITIAL = 0,
+    AFATFS_APPEND_FREE_CLUSTER_PHASE_FIND_FREESPACE = 0,
+    AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FAT1,
+    AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FAT2,
+    AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FILE_DIRECTORY,
+    AFATFS_APPEND_FREE_CLUSTER_PHASE_COMPLETE,
+    AFATFS_APPEND_FREE_CLUSTER_PHASE_FAILURE
+} afatfsAppendFreeClusterPhase_e;
+
+typedef struct afatfsAppendFreeCluster_t {
+    uint32_t previousCluster;
+    uint32_t searchCluster;
+    afatfsAppendFreeClusterPhase_e phase;
+} afatfsAppendFreeCluster_t;
+
+typedef enum {
+    AFATFS_EXTEND_SUBDIRECTORY_PHASE_INITIAL = 0,
+    AFATFS_EXTEND_SUBDIRECTORY_PHASE_ADD_FREE_CLUSTER = 0,
+    AFATFS_EXTEND_SUBDIRECTORY_PHASE_WRITE_SECTORS,
+    AFATFS_EXTEND_SUBDIRECTORY_PHASE_SUCCESS,
+    AFATFS_EXTEND_SUBDIRECTORY_PHASE_FAILURE
+} afatfsExtendSubdirectoryPhase_e;
+
+typedef struct afatfsExtendSubdirectory_t {
+
+    afatfsAppendFreeCluster_t appendFreeCluster;
+
+    afatfsExtendSubdirectoryPhase_e phase;
+
+    uint32_t parentDirectoryCluster;
+    afatfsFileCallback_t callback;
+} afatfsExtendSubdirectory_t;
+
+typedef enum {
+    AFATFS_TRUNCATE_FILE_INITIAL = 0,
+    AFATFS_TRUNCATE_FILE_UPDATE_DIRECTORY = 0,
+    AFATFS_TRUNCATE_FILE_ERASE_FAT_CHAIN_NORMAL,
+
+    AFATFS_TRUNCATE_FILE_ERASE_FAT_CHAIN_CONTIGUOUS,
+    AFATFS_TRUNCATE_FILE_PREPEND_TO_FREEFILE,
+
+    AFATFS_TRUNCATE_FILE_SUCCESS
+} afatfsTruncateFilePhase_e;
+
+typedef struct afatfsTruncateFile_t {
+    uint32_t startCluster;
+    uint32_t currentCluster;
+    uint32_t endCluster;
+    afatfsFileCallback_t callback;
+    afatfsTruncateFilePhase_e phase;
+} afatfsTruncateFile_t;
+
+typedef enum {
+    AFATFS_DELETE_FILE_DELETE_DIRECTORY_ENTRY,
+    AFATFS_DELETE_FILE_DEALLOCATE_CLUSTERS
+} afatfsDeleteFilePhase_e;
+
+typedef struct afatfsDeleteFile_t {
+    afatfsTruncateFile_t truncateFile;
+    afatfsCallback_t callback;
+} afatfsUnlinkFile_t;
+
+typedef struct afatfsCloseFile_t {
+    afatfsCallback_t callback;
+} afatfsCloseFile_t;
+
+typedef enum {
+    AFATFS_FILE_OPERATION_NONE,
+    AFATFS_FILE_OPERATION_CREATE_FILE,
+    AFATFS_FILE_OPERATION_SEEK,
+    AFATFS_FILE_OPERATION_CLOSE,
+    AFATFS_FILE_OPERATION_TRUNCATE,
+    AFATFS_FILE_OPERATION_UNLINK,
+
+    AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER,
+    AFATFS_FILE_OPERATION_LOCKED,
+
+    AFATFS_FILE_OPERATION_APPEND_FREE_CLUSTER,
+    AFATFS_FILE_OPERATION_EXTEND_SUBDIRECTORY
+} afatfsFileOperation_e;
+
+typedef struct afatfsFileOperation_t {
+    afatfsFileOperation_e operation;
+    union {
+        afatfsCreateFile_t createFile;
+        afatfsSeek_t seek;
+        afatfsAppendSupercluster_t appendSupercluster;
+        afatfsAppendFreeCluster_t appendFreeCluster;
+        afatfsExtendSubdirectory_t extendSubdirectory;
+        afatfsUnlinkFile_t unlinkFile;
+        afatfsTruncateFile_t truncateFile;
+        afatfsCloseFile_t closeFile;
+    } state;
+} afatfsFileOperation_t;
+
+typedef struct afatfsFile_t {
+    afatfsFileType_e type;
+
+
+    uint32_t cursorOffset;
+# 378 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    uint32_t logicalSize;
+# 391 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    uint32_t physicalSize;
+
+
+
+
+
+    uint32_t cursorCluster;
+
+
+
+
+    uint32_t cursorPreviousCluster;
+
+    uint8_t mode;
+    uint8_t attrib;
+
+
+
+
+
+    int8_t writeLockedCacheIndex;
+
+    int8_t readRetainCacheIndex;
+
+
+    afatfsDirEntryPointer_t directoryEntryPos;
+
+
+    uint32_t firstCluster;
+
+
+    struct afatfsFileOperation_t operation;
+} afatfsFile_t;
+
+typedef enum {
+    AFATFS_INITIALIZATION_READ_MBR,
+    AFATFS_INITIALIZATION_READ_VOLUME_ID,
+
+
+    AFATFS_INITIALIZATION_FREEFILE_CREATE,
+    AFATFS_INITIALIZATION_FREEFILE_CREATING,
+    AFATFS_INITIALIZATION_FREEFILE_FAT_SEARCH,
+    AFATFS_INITIALIZATION_FREEFILE_UPDATE_FAT,
+    AFATFS_INITIALIZATION_FREEFILE_SAVE_DIR_ENTRY,
+    AFATFS_INITIALIZATION_FREEFILE_LAST = AFATFS_INITIALIZATION_FREEFILE_SAVE_DIR_ENTRY,
+
+
+
+
+
+
+
+    AFATFS_INITIALIZATION_DONE
+} afatfsInitializationPhase_e;
+
+typedef struct afatfs_t {
+    fatFilesystemType_e filesystemType;
+
+    afatfsFilesystemState_e filesystemState;
+    afatfsInitializationPhase_e initPhase;
+
+
+
+    union {
+        afatfsFreeSpaceSearch_t freeSpaceSearch;
+        afatfsFreeSpaceFAT_t freeSpaceFAT;
+    } initState;
+
+
+
+
+
+    uint8_t cache[512 * 10];
+
+    afatfsCacheBlockDescriptor_t cacheDescriptor[10];
+    uint32_t cacheTimer;
+
+    int cacheDirtyEntries;
+    
+# 469 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+   _Bool 
+# 469 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        cacheFlushInProgress;
+
+    afatfsFile_t openFiles[3];
+
+
+    afatfsFile_t freeFile;
+
+
+
+
+
+
+    afatfsError_e lastError;
+
+    
+# 483 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+   _Bool 
+# 483 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        filesystemFull;
+
+
+    afatfsFile_t currentDirectory;
+
+    uint32_t partitionStartSector;
+
+    uint32_t fatStartSector;
+    uint32_t fatSectors;
+
+
+
+
+
+    uint32_t numClusters;
+    uint32_t clusterStartSector;
+    uint32_t sectorsPerCluster;
+
+
+
+
+
+    uint32_t lastClusterAllocated;
+
+
+    uint32_t byteInClusterMask;
+
+    uint32_t rootDirectoryCluster;
+    uint32_t rootDirectorySectors;
+} afatfs_t;
+
+
+
+
+
+static afatfs_t afatfs;
+
+static void afatfs_fileOperationContinue(afatfsFile_t *file);
+static uint8_t* afatfs_fileLockCursorSectorForWrite(afatfsFilePtr_t file);
+static uint8_t* afatfs_fileRetainCursorSectorForRead(afatfsFilePtr_t file);
+
+static uint32_t roundUpTo(uint32_t value, uint32_t rounding)
+{
+    uint32_t remainder = value % rounding;
+
+    if (remainder > 0) {
+        value += rounding - remainder;
+    }
+
+    return value;
+}
+
+static 
+# 535 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 535 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           isPowerOfTwo(unsigned int x)
+{
+    return ((x != 0) && ((x & (~x + 1)) == x));
+}
+# 547 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static 
+# 547 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 547 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_assert(
+# 547 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                         _Bool 
+# 547 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                              condition)
+{
+    if (!condition) {
+        if (afatfs.lastError == AFATFS_ERROR_NONE) {
+            afatfs.lastError = AFATFS_ERROR_GENERIC;
+        }
+        afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_FATAL;
+
+
+
+    }
+
+    return condition;
+}
+
+static 
+# 562 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 562 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_fileIsBusy(afatfsFilePtr_t file)
+{
+    return file->operation.operation != AFATFS_FILE_OPERATION_NONE;
+}
+
+
+
+
+
+
+static uint32_t afatfs_fatEntriesPerSector(void)
+{
+    return afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT32 ? (512 / sizeof(uint32_t)) : (512 / sizeof(uint16_t));
+}
+
+
+
+
+static
+uint32_t afatfs_clusterSize(void)
+{
+    return afatfs.sectorsPerCluster * 512;
+}
+
+
+
+
+static uint32_t afatfs_byteIndexInCluster(uint32_t byteOffset)
+{
+    return afatfs.byteInClusterMask & byteOffset;
+}
+
+
+
+
+static uint32_t afatfs_sectorIndexInCluster(uint32_t byteOffset)
+{
+    return afatfs_byteIndexInCluster(byteOffset) / 512;
+}
+
+
+static uint8_t *afatfs_cacheSectorGetMemory(int cacheEntryIndex)
+{
+    return afatfs.cache + cacheEntryIndex * 512;
+}
+
+static int afatfs_getCacheDescriptorIndexForBuffer(uint8_t *memory)
+{
+    int index = (memory - afatfs.cache) / 512;
+
+    if (afatfs_assert(index >= 0 && index < 10)) {
+        return index;
+    } else {
+        return -1;
+    }
+}
+
+static afatfsCacheBlockDescriptor_t* afatfs_getCacheDescriptorForBuffer(uint8_t *memory)
+{
+    return afatfs.cacheDescriptor + afatfs_getCacheDescriptorIndexForBuffer(memory);
+}
+
+static void afatfs_cacheSectorMarkDirty(afatfsCacheBlockDescriptor_t *descriptor)
+{
+    if (descriptor->state != AFATFS_CACHE_STATE_DIRTY) {
+        descriptor->writeTimestamp = ++afatfs.cacheTimer;
+        descriptor->state = AFATFS_CACHE_STATE_DIRTY;
+        afatfs.cacheDirtyEntries++;
+    }
+}
+
+static void afatfs_cacheSectorInit(afatfsCacheBlockDescriptor_t *descriptor, uint32_t sectorIndex, 
+# 633 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                                                                  _Bool 
+# 633 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                                                       locked)
+{
+    descriptor->sectorIndex = sectorIndex;
+
+    descriptor->accessTimestamp = descriptor->writeTimestamp = ++afatfs.cacheTimer;
+
+    descriptor->consecutiveEraseBlockCount = 0;
+
+    descriptor->state = AFATFS_CACHE_STATE_EMPTY;
+
+    descriptor->locked = locked;
+    descriptor->retainCount = 0;
+    descriptor->discardable = 0;
+}
+
+
+
+
+static void afatfs_sdcardReadComplete(sdcardBlockOperation_e operation, uint32_t sectorIndex, uint8_t *buffer, uint32_t callbackData)
+{
+    (void) operation;
+    (void) callbackData;
+
+    for (int i = 0; i < 10; i++) {
+        if (afatfs.cacheDescriptor[i].state != AFATFS_CACHE_STATE_EMPTY
+            && afatfs.cacheDescriptor[i].sectorIndex == sectorIndex
+        ) {
+            if (buffer == 
+# 660 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                         ((void *)0)
+# 660 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                             ) {
+
+                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_EMPTY;
+            } else {
+                afatfs_assert(afatfs_cacheSectorGetMemory(i) == buffer && afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_READING);
+
+                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_IN_SYNC;
+            }
+
+            break;
+        }
+    }
+}
+
+
+
+
+static void afatfs_sdcardWriteComplete(sdcardBlockOperation_e operation, uint32_t sectorIndex, uint8_t *buffer, uint32_t callbackData)
+{
+    (void) operation;
+    (void) callbackData;
+
+    afatfs.cacheFlushInProgress = 
+# 682 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                 0
+# 682 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                      ;
+
+    for (int i = 0; i < 10; i++) {
+
+
+
+        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex
+            && afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_WRITING
+        ) {
+            if (buffer == 
+# 691 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                         ((void *)0)
+# 691 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                             ) {
+
+                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_DIRTY;
+                afatfs.cacheDirtyEntries++;
+            } else {
+                afatfs_assert(afatfs_cacheSectorGetMemory(i) == buffer);
+
+                afatfs.cacheDescriptor[i].state = AFATFS_CACHE_STATE_IN_SYNC;
+            }
+            break;
+        }
+    }
+}
+
+
+
+
+static void afatfs_cacheFlushSector(int cacheIndex)
+{
+    afatfsCacheBlockDescriptor_t *cacheDescriptor = &afatfs.cacheDescriptor[cacheIndex];
+
+
+    if (cacheDescriptor->consecutiveEraseBlockCount) {
+        sdcard_beginWriteBlocks(cacheDescriptor->sectorIndex, cacheDescriptor->consecutiveEraseBlockCount);
+    }
+
+
+    switch (sdcard_writeBlock(cacheDescriptor->sectorIndex, afatfs_cacheSectorGetMemory(cacheIndex), afatfs_sdcardWriteComplete, 0)) {
+        case SDCARD_OPERATION_IN_PROGRESS:
+
+            afatfs.cacheDirtyEntries--;
+            cacheDescriptor->state = AFATFS_CACHE_STATE_WRITING;
+            afatfs.cacheFlushInProgress = 
+# 723 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                         1
+# 723 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                             ;
+            break;
+
+        case SDCARD_OPERATION_SUCCESS:
+
+            afatfs.cacheDirtyEntries--;
+            cacheDescriptor->state = AFATFS_CACHE_STATE_IN_SYNC;
+            break;
+
+        case SDCARD_OPERATION_BUSY:
+        case SDCARD_OPERATION_FAILURE:
+        default:
+            ;
+    }
+}
+
+
+
+
+
+static afatfsCacheBlockDescriptor_t* afatfs_findCacheSector(uint32_t sectorIndex)
+{
+    for (int i = 0; i < 10; i++) {
+        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
+            return &afatfs.cacheDescriptor[i];
+        }
+    }
+
+    return 
+# 751 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          ((void *)0)
+# 751 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+# 765 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static int afatfs_allocateCacheSector(uint32_t sectorIndex)
+{
+    int allocateIndex;
+    int emptyIndex = -1, discardableIndex = -1;
+
+    uint32_t oldestSyncedSectorLastUse = 0xFFFFFFFF;
+    int oldestSyncedSectorIndex = -1;
+
+    if (
+        !afatfs_assert(
+            afatfs.numClusters == 0
+            || sectorIndex < afatfs.clusterStartSector + afatfs.numClusters * afatfs.sectorsPerCluster
+        )
+    ) {
+        return -1;
+    }
+
+    for (int i = 0; i < 10; i++) {
+        if (afatfs.cacheDescriptor[i].sectorIndex == sectorIndex) {
+
+
+
+
+            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_EMPTY) {
+                emptyIndex = i;
+                break;
+            }
+
+
+            afatfs.cacheDescriptor[i].accessTimestamp = ++afatfs.cacheTimer;
+            return i;
+        }
+
+        switch (afatfs.cacheDescriptor[i].state) {
+            case AFATFS_CACHE_STATE_EMPTY:
+                emptyIndex = i;
+            break;
+            case AFATFS_CACHE_STATE_IN_SYNC:
+
+                if (!afatfs.cacheDescriptor[i].locked && afatfs.cacheDescriptor[i].retainCount == 0) {
+                    if (afatfs.cacheDescriptor[i].discardable) {
+                        discardableIndex = i;
+                    } else if (afatfs.cacheDescriptor[i].accessTimestamp < oldestSyncedSectorLastUse) {
+
+                        oldestSyncedSectorLastUse = afatfs.cacheDescriptor[i].accessTimestamp;
+                        oldestSyncedSectorIndex = i;
+                    }
+                }
+            break;
+            default:
+                ;
+        }
+    }
+
+    if (emptyIndex > -1) {
+        allocateIndex = emptyIndex;
+    } else if (discardableIndex > -1) {
+        allocateIndex = discardableIndex;
+    } else if (oldestSyncedSectorIndex > -1) {
+        allocateIndex = oldestSyncedSectorIndex;
+    } else {
+        allocateIndex = -1;
+    }
+
+    if (allocateIndex > -1) {
+        afatfs_cacheSectorInit(&afatfs.cacheDescriptor[allocateIndex], sectorIndex, 
+# 830 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                                                   0
+# 830 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                                        );
+    }
+
+    return allocateIndex;
+}
+
+
+
+
+
+# 839 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 839 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_flush(void)
+{
+    if (afatfs.cacheDirtyEntries > 0) {
+
+        uint32_t earliestSectorTime = 0xFFFFFFFF;
+        int earliestSectorIndex = -1;
+
+        for (int i = 0; i < 10; i++) {
+            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && !afatfs.cacheDescriptor[i].locked
+                && (earliestSectorIndex == -1 || afatfs.cacheDescriptor[i].writeTimestamp < earliestSectorTime)
+            ) {
+                earliestSectorIndex = i;
+                earliestSectorTime = afatfs.cacheDescriptor[i].writeTimestamp;
+            }
+        }
+
+        if (earliestSectorIndex > -1) {
+            afatfs_cacheFlushSector(earliestSectorIndex);
+
+
+            return 
+# 859 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  0
+# 859 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                       ;
+        }
+    }
+
+    return 
+# 863 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          1
+# 863 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+
+
+
+
+
+# 869 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 869 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_isFull(void)
+{
+    return afatfs.filesystemFull;
+}
+
+
+
+
+
+static uint32_t afatfs_fatSectorToPhysical(int fatIndex, uint32_t fatSectorIndex)
+{
+    return afatfs.fatStartSector + (fatIndex ? afatfs.fatSectors : 0) + fatSectorIndex;
+}
+
+static uint32_t afatfs_fileClusterToPhysical(uint32_t clusterNumber, uint32_t sectorIndex)
+{
+    return afatfs.clusterStartSector + (clusterNumber - 2) * afatfs.sectorsPerCluster + sectorIndex;
+}
+
+static uint32_t afatfs_fileGetCursorPhysicalSector(afatfsFilePtr_t file)
+{
+    if (file->type == AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY) {
+        return afatfs.fatStartSector + 2 * afatfs.fatSectors + file->cursorOffset / 512;
+    } else {
+        uint32_t cursorSectorInCluster = afatfs_sectorIndexInCluster(file->cursorOffset);
+        return afatfs_fileClusterToPhysical(file->cursorCluster, cursorSectorInCluster);
+    }
+}
+
+
+
+
+static void afatfs_fileGetCursorClusterAndSector(afatfsFilePtr_t file, uint32_t *cluster, uint16_t *sector)
+{
+    *cluster = file->cursorCluster;
+
+    if (file->type == AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY) {
+        *sector = file->cursorOffset / 512;
+    } else {
+        *sector = afatfs_sectorIndexInCluster(file->cursorOffset);
+    }
+}
+# 926 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex, uint8_t **buffer, uint8_t sectorFlags, uint32_t eraseCount)
+{
+
+    if (!afatfs_assert((sectorFlags & 2) == 0 || physicalSectorIndex != 0)) {
+        return AFATFS_OPERATION_FAILURE;
+    }
+
+    int cacheSectorIndex = afatfs_allocateCacheSector(physicalSectorIndex);
+
+    if (cacheSectorIndex == -1) {
+
+        return AFATFS_OPERATION_IN_PROGRESS;
+    }
+
+    switch (afatfs.cacheDescriptor[cacheSectorIndex].state) {
+        case AFATFS_CACHE_STATE_READING:
+            return AFATFS_OPERATION_IN_PROGRESS;
+        break;
+
+        case AFATFS_CACHE_STATE_EMPTY:
+            if ((sectorFlags & 1) != 0) {
+                if (sdcard_readBlock(physicalSectorIndex, afatfs_cacheSectorGetMemory(cacheSectorIndex), afatfs_sdcardReadComplete, 0)) {
+                    afatfs.cacheDescriptor[cacheSectorIndex].state = AFATFS_CACHE_STATE_READING;
+                }
+                return AFATFS_OPERATION_IN_PROGRESS;
+            }
+
+
+            afatfs.cacheDescriptor[cacheSectorIndex].discardable = (sectorFlags & 8) != 0 ? 1 : 0;
+
+
+
+            if (eraseCount < 4) {
+                eraseCount = 0;
+            } else {
+                eraseCount = __extension__ ({ __typeof__ (eraseCount) _a = (eraseCount); __typeof__ ((uint32_t)
+# 961 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                            (65535)
+# 961 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                            ) _b = ((uint32_t)
+# 961 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                            (65535)
+# 961 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                            ); _a < _b ? _a : _b; });
+            }
+
+            afatfs.cacheDescriptor[cacheSectorIndex].consecutiveEraseBlockCount = eraseCount;
+
+
+            __attribute__ ((fallthrough));
+
+        case AFATFS_CACHE_STATE_WRITING:
+        case AFATFS_CACHE_STATE_IN_SYNC:
+            if ((sectorFlags & 2) != 0) {
+                afatfs_cacheSectorMarkDirty(&afatfs.cacheDescriptor[cacheSectorIndex]);
+            }
+            __attribute__ ((fallthrough));
+
+        case AFATFS_CACHE_STATE_DIRTY:
+            if ((sectorFlags & 4) != 0) {
+                afatfs.cacheDescriptor[cacheSectorIndex].locked = 1;
+            }
+            if ((sectorFlags & 16) != 0) {
+                afatfs.cacheDescriptor[cacheSectorIndex].retainCount++;
+            }
+
+            *buffer = afatfs_cacheSectorGetMemory(cacheSectorIndex);
+
+            return AFATFS_OPERATION_SUCCESS;
+        break;
+
+        default:
+
+            afatfs_assert(
+# 991 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                         0
+# 991 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                              );
+            return AFATFS_OPERATION_FAILURE;
+    }
+}
+
+
+
+
+static 
+# 999 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 999 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_parseMBR(const uint8_t *sector)
+{
+
+    if (sector[512 - 2] != 0x55 || sector[512 - 1] != 0xAA)
+        return 
+# 1003 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 1003 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+
+    mbrPartitionEntry_t *partition = (mbrPartitionEntry_t *) (sector + 446);
+
+    for (int i = 0; i < 4; i++) {
+        if (
+            partition[i].lbaBegin > 0
+            && (
+                partition[i].type == 0x0B
+                || partition[i].type == 0x0C
+                || partition[i].type == 0x06
+                || partition[i].type == 0x0E
+            )
+        ) {
+            afatfs.partitionStartSector = partition[i].lbaBegin;
+
+            return 
+# 1019 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  1
+# 1019 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+        }
+    }
+
+    return 
+# 1023 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          0
+# 1023 "./src/main/io/asyncfatfs/asyncfatfs.c"
+               ;
+}
+
+static 
+# 1026 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 1026 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_parseVolumeID(const uint8_t *sector)
+{
+    fatVolumeID_t *volume = (fatVolumeID_t *) sector;
+
+    afatfs.filesystemType = FAT_FILESYSTEM_TYPE_INVALID;
+
+    if (volume->bytesPerSector != 512 || volume->numFATs != 2
+            || sector[510] != 0x55 || sector[511] != 0xAA) {
+        return 
+# 1034 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 1034 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+    }
+
+    afatfs.fatStartSector = afatfs.partitionStartSector + volume->reservedSectorCount;
+
+    afatfs.sectorsPerCluster = volume->sectorsPerCluster;
+    if (afatfs.sectorsPerCluster < 1 || afatfs.sectorsPerCluster > 128 || !isPowerOfTwo(afatfs.sectorsPerCluster)) {
+        return 
+# 1041 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 1041 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+    }
+
+    afatfs.byteInClusterMask = 512 * afatfs.sectorsPerCluster - 1;
+
+    afatfs.fatSectors = volume->FATSize16 != 0 ? volume->FATSize16 : volume->fatDescriptor.fat32.FATSize32;
+
+
+    afatfs.rootDirectorySectors = ((volume->rootEntryCount * 32) + (volume->bytesPerSector - 1)) / volume->bytesPerSector;
+    uint32_t totalSectors = volume->totalSectors16 != 0 ? volume->totalSectors16 : volume->totalSectors32;
+    uint32_t dataSectors = totalSectors - (volume->reservedSectorCount + (2 * afatfs.fatSectors) + afatfs.rootDirectorySectors);
+
+    afatfs.numClusters = dataSectors / volume->sectorsPerCluster;
+
+    if (afatfs.numClusters <= 4084) {
+        afatfs.filesystemType = FAT_FILESYSTEM_TYPE_FAT12;
+
+        return 
+# 1058 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 1058 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+    } else if (afatfs.numClusters <= 65524) {
+        afatfs.filesystemType = FAT_FILESYSTEM_TYPE_FAT16;
+    } else {
+        afatfs.filesystemType = FAT_FILESYSTEM_TYPE_FAT32;
+    }
+
+    if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT32) {
+        afatfs.rootDirectoryCluster = volume->fatDescriptor.fat32.rootCluster;
+    } else {
+
+        afatfs.rootDirectoryCluster = 0;
+    }
+
+    uint32_t endOfFATs = afatfs.fatStartSector + 2 * afatfs.fatSectors;
+
+    afatfs.clusterStartSector = endOfFATs + afatfs.rootDirectorySectors;
+
+    return 
+# 1076 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          1
+# 1076 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+
+
+
+
+static void afatfs_getFATPositionForCluster(uint32_t cluster, uint32_t *fatSectorIndex, uint32_t *fatSectorEntryIndex)
+{
+    if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16) {
+        uint32_t entriesPerFATSector = 512 / sizeof(uint16_t);
+
+        *fatSectorIndex = cluster / entriesPerFATSector;
+        *fatSectorEntryIndex = cluster & (entriesPerFATSector - 1);
+    } else {
+        uint32_t entriesPerFATSector = 512 / sizeof(uint32_t);
+
+        *fatSectorIndex = fat32_decodeClusterNumber(cluster) / entriesPerFATSector;
+        *fatSectorEntryIndex = cluster & (entriesPerFATSector - 1);
+    }
+}
+
+static 
+# 1097 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 1097 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_FATIsEndOfChainMarker(uint32_t clusterNumber)
+{
+    if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT32) {
+        return fat32_isEndOfChainMarker(clusterNumber);
+    } else {
+        return fat16_isEndOfChainMarker(clusterNumber);
+    }
+}
+# 1119 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_FATGetNextCluster(int fatIndex, uint32_t cluster, uint32_t *nextCluster)
+{
+    uint32_t fatSectorIndex, fatSectorEntryIndex;
+    afatfsFATSector_t sector;
+
+    afatfs_getFATPositionForCluster(cluster, &fatSectorIndex, &fatSectorEntryIndex);
+
+    afatfsOperationStatus_e result = afatfs_cacheSector(afatfs_fatSectorToPhysical(fatIndex, fatSectorIndex), &sector.bytes, 1, 0);
+
+    if (result == AFATFS_OPERATION_SUCCESS) {
+        if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16) {
+            *nextCluster = sector.fat16[fatSectorEntryIndex];
+        } else {
+            *nextCluster = fat32_decodeClusterNumber(sector.fat32[fatSectorEntryIndex]);
+        }
+    }
+
+    return result;
+}
+# 1147 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_FATSetNextCluster(uint32_t startCluster, uint32_t nextCluster)
+{
+    afatfsFATSector_t sector;
+    uint32_t fatSectorIndex, fatSectorEntryIndex, fatPhysicalSector;
+    afatfsOperationStatus_e result;
+
+
+
+
+
+    afatfs_getFATPositionForCluster(startCluster, &fatSectorIndex, &fatSectorEntryIndex);
+
+    fatPhysicalSector = afatfs_fatSectorToPhysical(0, fatSectorIndex);
+
+    result = afatfs_cacheSector(fatPhysicalSector, &sector.bytes, 1 | 2, 0);
+
+    if (result == AFATFS_OPERATION_SUCCESS) {
+        if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16) {
+            sector.fat16[fatSectorEntryIndex] = nextCluster;
+        } else {
+            sector.fat32[fatSectorEntryIndex] = nextCluster;
+        }
+    }
+
+    return result;
+}
+
+
+
+
+static void afatfs_fileUpdateFilesize(afatfsFile_t *file)
+{
+    file->logicalSize = __extension__ ({ __typeof__ (file->logicalSize) _a = (file->logicalSize); __typeof__ (file->cursorOffset) _b = (file->cursorOffset); _a > _b ? _a : _b; });
+}
+
+static void afatfs_fileUnlockCacheSector(afatfsFilePtr_t file)
+{
+    if (file->writeLockedCacheIndex != -1) {
+        afatfs.cacheDescriptor[file->writeLockedCacheIndex].locked = 0;
+        file->writeLockedCacheIndex = -1;
+    }
+    if (file->readRetainCacheIndex != -1) {
+        afatfs.cacheDescriptor[file->readRetainCacheIndex].retainCount = __extension__ ({ __typeof__ ((int) afatfs.cacheDescriptor[file->readRetainCacheIndex].retainCount - 1) _a = ((int) afatfs.cacheDescriptor[file->readRetainCacheIndex].retainCount - 1); __typeof__ (0) _b = (0); _a > _b ? _a : _b; });
+        file->readRetainCacheIndex = -1;
+    }
+}
+# 1214 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsFindClusterStatus_e afatfs_findClusterWithCondition(afatfsClusterSearchCondition_e condition, uint32_t *cluster, uint32_t searchLimit)
+{
+    afatfsFATSector_t sector;
+    uint32_t fatSectorIndex, fatSectorEntryIndex;
+
+    uint32_t fatEntriesPerSector = afatfs_fatEntriesPerSector();
+    
+# 1220 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+   _Bool 
+# 1220 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        lookingForFree = condition == CLUSTER_SEARCH_FREE_AT_BEGINNING_OF_FAT_SECTOR || condition == CLUSTER_SEARCH_FREE;
+
+    int jump;
+
+
+    afatfs_getFATPositionForCluster(*cluster, &fatSectorIndex, &fatSectorEntryIndex);
+
+    switch (condition) {
+        case CLUSTER_SEARCH_FREE_AT_BEGINNING_OF_FAT_SECTOR:
+            jump = fatEntriesPerSector;
+
+
+            if (!afatfs_assert(fatSectorEntryIndex == 0)) {
+                return AFATFS_FIND_CLUSTER_FATAL;
+            }
+        break;
+        case CLUSTER_SEARCH_OCCUPIED:
+        case CLUSTER_SEARCH_FREE:
+            jump = 1;
+        break;
+        default:
+            afatfs_assert(
+# 1241 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                         0
+# 1241 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                              );
+            return AFATFS_FIND_CLUSTER_FATAL;
+    }
+
+    while (*cluster < searchLimit) {
+
+
+
+        if (afatfs.freeFile.logicalSize > 0 && *cluster == afatfs.freeFile.firstCluster) {
+            *cluster += (afatfs.freeFile.logicalSize + afatfs_clusterSize() - 1) / afatfs_clusterSize();
+
+
+            *cluster = roundUpTo(*cluster, jump);
+            continue;
+        }
+
+
+        afatfsOperationStatus_e status = afatfs_cacheSector(afatfs_fatSectorToPhysical(0, fatSectorIndex), &sector.bytes, 1 | 8, 0);
+
+        switch (status) {
+            case AFATFS_OPERATION_SUCCESS:
+                do {
+                    uint32_t clusterNumber;
+
+                    switch (afatfs.filesystemType) {
+                        case FAT_FILESYSTEM_TYPE_FAT16:
+                            clusterNumber = sector.fat16[fatSectorEntryIndex];
+                        break;
+                        case FAT_FILESYSTEM_TYPE_FAT32:
+                            clusterNumber = fat32_decodeClusterNumber(sector.fat32[fatSectorEntryIndex]);
+                        break;
+                        default:
+                            return AFATFS_FIND_CLUSTER_FATAL;
+                    }
+
+                    if (fat_isFreeSpace(clusterNumber) == lookingForFree) {
+
+
+
+
+                        if (*cluster < searchLimit) {
+                            return AFATFS_FIND_CLUSTER_FOUND;
+                        } else {
+                            *cluster = searchLimit;
+                            return AFATFS_FIND_CLUSTER_NOT_FOUND;
+                        }
+                    }
+
+                    (*cluster) += jump;
+                    fatSectorEntryIndex += jump;
+                } while (fatSectorEntryIndex < fatEntriesPerSector);
+
+
+                fatSectorIndex++;
+                fatSectorEntryIndex = 0;
+            break;
+            case AFATFS_OPERATION_FAILURE:
+                return AFATFS_FIND_CLUSTER_FATAL;
+            break;
+            case AFATFS_OPERATION_IN_PROGRESS:
+                return AFATFS_FIND_CLUSTER_IN_PROGRESS;
+            break;
+        }
+    }
+
+
+    *cluster = searchLimit;
+    return AFATFS_FIND_CLUSTER_NOT_FOUND;
+}
+# 1318 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_fileGetNextCluster(afatfsFilePtr_t file, uint32_t currentCluster, uint32_t *nextCluster)
+{
+
+
+
+    if ((file->mode & 8) != 0) {
+        uint32_t freeFileStart = afatfs.freeFile.firstCluster;
+
+        afatfs_assert(currentCluster + 1 <= freeFileStart);
+
+
+        if (currentCluster + 1 == freeFileStart) {
+            *nextCluster = 0;
+        } else {
+            *nextCluster = currentCluster + 1;
+        }
+
+        return AFATFS_OPERATION_SUCCESS;
+    } else
+
+    {
+        return afatfs_FATGetNextCluster(0, currentCluster, nextCluster);
+    }
+}
+# 1357 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_FATFillWithPattern(afatfsFATPattern_e pattern, uint32_t *startCluster, uint32_t endCluster)
+{
+    afatfsFATSector_t sector;
+    uint32_t fatSectorIndex, firstEntryIndex, fatPhysicalSector;
+    uint8_t fatEntrySize;
+    uint32_t nextCluster;
+    afatfsOperationStatus_e result;
+    uint32_t eraseSectorCount;
+
+
+    afatfs_getFATPositionForCluster(*startCluster, &fatSectorIndex, &firstEntryIndex);
+
+    fatPhysicalSector = afatfs_fatSectorToPhysical(0, fatSectorIndex);
+
+
+    eraseSectorCount = (endCluster - *startCluster + firstEntryIndex + afatfs_fatEntriesPerSector() - 1) / afatfs_fatEntriesPerSector();
+
+    while (*startCluster < endCluster) {
+
+        uint32_t lastEntryIndex = __extension__ ({ __typeof__ (firstEntryIndex + (endCluster - *startCluster)) _a = (firstEntryIndex + (endCluster - *startCluster)); __typeof__ (afatfs_fatEntriesPerSector()) _b = (afatfs_fatEntriesPerSector()); _a < _b ? _a : _b; });
+
+        uint8_t cacheFlags = 2 | 8;
+
+        if (firstEntryIndex > 0 || lastEntryIndex < afatfs_fatEntriesPerSector()) {
+
+            cacheFlags |= 1;
+        }
+
+        result = afatfs_cacheSector(fatPhysicalSector, &sector.bytes, cacheFlags, eraseSectorCount);
+
+        if (result != AFATFS_OPERATION_SUCCESS) {
+            return result;
+        }
+# 1399 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        switch (pattern) {
+            case AFATFS_FAT_PATTERN_TERMINATED_CHAIN:
+            case AFATFS_FAT_PATTERN_UNTERMINATED_CHAIN:
+                nextCluster = *startCluster + 1;
+
+                if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16) {
+                    for (uint32_t i = firstEntryIndex; i < lastEntryIndex; i++, nextCluster++) {
+                        sector.fat16[i] = nextCluster;
+                    }
+                } else {
+                    for (uint32_t i = firstEntryIndex; i < lastEntryIndex; i++, nextCluster++) {
+                        sector.fat32[i] = nextCluster;
+                    }
+                }
+
+                *startCluster += lastEntryIndex - firstEntryIndex;
+
+                if (pattern == AFATFS_FAT_PATTERN_TERMINATED_CHAIN && *startCluster == endCluster) {
+
+                    if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16) {
+                        sector.fat16[lastEntryIndex - 1] = 0xFFFF;
+                    } else {
+                        sector.fat32[lastEntryIndex - 1] = 0xFFFFFFFF;
+                    }
+                    break;
+                }
+            break;
+            case AFATFS_FAT_PATTERN_FREE:
+                fatEntrySize = afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+
+                memset(sector.bytes + firstEntryIndex * fatEntrySize, 0, (lastEntryIndex - firstEntryIndex) * fatEntrySize);
+
+                *startCluster += lastEntryIndex - firstEntryIndex;
+            break;
+        }
+
+        fatPhysicalSector++;
+        eraseSectorCount--;
+        firstEntryIndex = 0;
+    }
+
+    return AFATFS_OPERATION_SUCCESS;
+}
+# 1458 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_saveDirectoryEntry(afatfsFilePtr_t file, afatfsSaveDirectoryEntryMode_e mode)
+{
+    uint8_t *sector;
+    afatfsOperationStatus_e result;
+
+    if (file->directoryEntryPos.sectorNumberPhysical == 0) {
+        return AFATFS_OPERATION_SUCCESS;
+    }
+
+    result = afatfs_cacheSector(file->directoryEntryPos.sectorNumberPhysical, &sector, 1 | 2, 0);
+
+
+
+
+
+    if (result == AFATFS_OPERATION_SUCCESS) {
+        if (afatfs_assert(file->directoryEntryPos.entryIndex >= 0)) {
+            fatDirectoryEntry_t *entry = (fatDirectoryEntry_t *) sector + file->directoryEntryPos.entryIndex;
+
+            switch (mode) {
+               case AFATFS_SAVE_DIRECTORY_NORMAL:
+
+
+
+
+
+                   entry->fileSize = file->physicalSize;
+               break;
+               case AFATFS_SAVE_DIRECTORY_DELETED:
+                   entry->filename[0] = (char)0xE5;
+                   __attribute__ ((fallthrough));
+
+               case AFATFS_SAVE_DIRECTORY_FOR_CLOSE:
+
+                   entry->fileSize = file->logicalSize;
+            }
+
+
+            if (file->type == AFATFS_FILE_TYPE_DIRECTORY) {
+                entry->fileSize = 0;
+            }
+
+            entry->firstClusterHigh = file->firstCluster >> 16;
+            entry->firstClusterLow = file->firstCluster & 0xFFFF;
+        } else {
+            return AFATFS_OPERATION_FAILURE;
+        }
+    }
+
+    return result;
+}
+# 1524 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_appendRegularFreeClusterContinue(afatfsFile_t *file)
+{
+    afatfsAppendFreeCluster_t *opState = &file->operation.state.appendFreeCluster;
+    afatfsOperationStatus_e status;
+
+    doMore:
+
+    switch (opState->phase) {
+        case AFATFS_APPEND_FREE_CLUSTER_PHASE_FIND_FREESPACE:
+            switch (afatfs_findClusterWithCondition(CLUSTER_SEARCH_FREE, &opState->searchCluster, afatfs.numClusters + 2)) {
+                case AFATFS_FIND_CLUSTER_FOUND:
+                    afatfs.lastClusterAllocated = opState->searchCluster;
+
+
+                    file->cursorCluster = opState->searchCluster;
+                    file->physicalSize += afatfs_clusterSize();
+
+                    if (opState->previousCluster == 0) {
+
+                        file->firstCluster = opState->searchCluster;
+                    }
+
+                    opState->phase = AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FAT1;
+                    goto doMore;
+                break;
+                case AFATFS_FIND_CLUSTER_FATAL:
+                case AFATFS_FIND_CLUSTER_NOT_FOUND:
+
+                    opState->phase = AFATFS_APPEND_FREE_CLUSTER_PHASE_FAILURE;
+                    goto doMore;
+                break;
+                case AFATFS_FIND_CLUSTER_IN_PROGRESS:
+                break;
+            }
+        break;
+        case AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FAT1:
+
+            status = afatfs_FATSetNextCluster(opState->searchCluster, 0xFFFFFFFF);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                if (opState->previousCluster) {
+                    opState->phase = AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FAT2;
+                } else {
+                    opState->phase = AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FILE_DIRECTORY;
+                }
+
+                goto doMore;
+            }
+        break;
+        case AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FAT2:
+
+            status = afatfs_FATSetNextCluster(opState->previousCluster, opState->searchCluster);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FILE_DIRECTORY;
+                goto doMore;
+            }
+        break;
+        case AFATFS_APPEND_FREE_CLUSTER_PHASE_UPDATE_FILE_DIRECTORY:
+            if (afatfs_saveDirectoryEntry(file, AFATFS_SAVE_DIRECTORY_NORMAL) == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_APPEND_FREE_CLUSTER_PHASE_COMPLETE;
+                goto doMore;
+            }
+        break;
+        case AFATFS_APPEND_FREE_CLUSTER_PHASE_COMPLETE:
+            if (file->operation.operation == AFATFS_FILE_OPERATION_APPEND_FREE_CLUSTER) {
+                file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+            }
+
+            return AFATFS_OPERATION_SUCCESS;
+        break;
+        case AFATFS_APPEND_FREE_CLUSTER_PHASE_FAILURE:
+            if (file->operation.operation == AFATFS_FILE_OPERATION_APPEND_FREE_CLUSTER) {
+                file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+            }
+
+            afatfs.filesystemFull = 
+# 1600 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                   1
+# 1600 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                       ;
+            return AFATFS_OPERATION_FAILURE;
+        break;
+    }
+
+    return AFATFS_OPERATION_IN_PROGRESS;
+}
+
+static void afatfs_appendRegularFreeClusterInitOperationState(afatfsAppendFreeCluster_t *state, uint32_t previousCluster)
+{
+    state->phase = AFATFS_APPEND_FREE_CLUSTER_PHASE_INITIAL;
+    state->previousCluster = previousCluster;
+    state->searchCluster = afatfs.lastClusterAllocated;
+}
+# 1629 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_appendRegularFreeCluster(afatfsFilePtr_t file)
+{
+    if (file->operation.operation == AFATFS_FILE_OPERATION_APPEND_FREE_CLUSTER)
+        return AFATFS_OPERATION_IN_PROGRESS;
+
+    if (afatfs.filesystemFull || afatfs_fileIsBusy(file)) {
+        return AFATFS_OPERATION_FAILURE;
+    }
+
+    file->operation.operation = AFATFS_FILE_OPERATION_APPEND_FREE_CLUSTER;
+
+    afatfs_appendRegularFreeClusterInitOperationState(&file->operation.state.appendFreeCluster, file->cursorPreviousCluster);
+
+    return afatfs_appendRegularFreeClusterContinue(file);
+}
+
+
+
+
+
+
+static
+uint32_t afatfs_superClusterSize(void)
+{
+    return afatfs_fatEntriesPerSector() * afatfs_clusterSize();
+}
+# 1666 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_appendSuperclusterContinue(afatfsFile_t *file)
+{
+    afatfsAppendSupercluster_t *opState = &file->operation.state.appendSupercluster;
+
+    afatfsOperationStatus_e status = AFATFS_OPERATION_FAILURE;
+
+    doMore:
+    switch (opState->phase) {
+        case AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT:
+
+
+
+            file->cursorCluster = afatfs.freeFile.firstCluster;
+            file->physicalSize += afatfs_superClusterSize();
+# 1689 "./src/main/io/asyncfatfs/asyncfatfs.c"
+            afatfs.freeFile.firstCluster += afatfs_fatEntriesPerSector();
+            afatfs.freeFile.logicalSize -= afatfs_superClusterSize();
+            afatfs.freeFile.physicalSize -= afatfs_superClusterSize();
+
+
+            opState->fatRewriteStartCluster = file->cursorCluster;
+            opState->fatRewriteEndCluster = opState->fatRewriteStartCluster + afatfs_fatEntriesPerSector();
+
+            if (opState->previousCluster == 0) {
+
+                file->firstCluster = file->cursorCluster;
+            } else {
+
+
+
+
+                opState->fatRewriteStartCluster -= afatfs_fatEntriesPerSector();
+            }
+
+            opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FREEFILE_DIRECTORY;
+            goto doMore;
+        break;
+        case AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FREEFILE_DIRECTORY:
+
+            status = afatfs_saveDirectoryEntry(&afatfs.freeFile, AFATFS_SAVE_DIRECTORY_NORMAL);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FAT;
+                goto doMore;
+            }
+        break;
+        case AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FAT:
+            status = afatfs_FATFillWithPattern(AFATFS_FAT_PATTERN_TERMINATED_CHAIN, &opState->fatRewriteStartCluster, opState->fatRewriteEndCluster);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FILE_DIRECTORY;
+                goto doMore;
+            }
+        break;
+        case AFATFS_APPEND_SUPERCLUSTER_PHASE_UPDATE_FILE_DIRECTORY:
+
+            status = afatfs_saveDirectoryEntry(file, AFATFS_SAVE_DIRECTORY_NORMAL);
+        break;
+    }
+
+    if ((status == AFATFS_OPERATION_FAILURE || status == AFATFS_OPERATION_SUCCESS) && file->operation.operation == AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER) {
+        file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+    }
+
+    return status;
+}
+# 1754 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_appendSupercluster(afatfsFilePtr_t file)
+{
+    uint32_t superClusterSize = afatfs_superClusterSize();
+
+    if (file->operation.operation == AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER) {
+        return AFATFS_OPERATION_IN_PROGRESS;
+    }
+
+    if (afatfs.freeFile.logicalSize < superClusterSize) {
+        afatfs.filesystemFull = 
+# 1763 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                               1
+# 1763 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                   ;
+    }
+
+    if (afatfs.filesystemFull || afatfs_fileIsBusy(file)) {
+        return AFATFS_OPERATION_FAILURE;
+    }
+
+    afatfsAppendSupercluster_t *opState = &file->operation.state.appendSupercluster;
+
+    file->operation.operation = AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER;
+    opState->phase = AFATFS_APPEND_SUPERCLUSTER_PHASE_INIT;
+    opState->previousCluster = file->cursorPreviousCluster;
+
+    return afatfs_appendSuperclusterContinue(file);
+}
+
+
+
+
+
+
+
+static afatfsOperationStatus_e afatfs_appendFreeCluster(afatfsFilePtr_t file)
+{
+    afatfsOperationStatus_e status;
+
+
+    if ((file->mode & 8) != 0) {
+
+        status = afatfs_appendSupercluster(file);
+    } else
+
+    {
+        status = afatfs_appendRegularFreeCluster(file);
+    }
+
+    return status;
+}
+
+
+
+
+
+static 
+# 1806 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 1806 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_isEndOfAllocatedFile(afatfsFilePtr_t file)
+{
+    if (file->type == AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY) {
+        return file->cursorOffset >= 512 * afatfs.rootDirectorySectors;
+    } else {
+        return file->cursorCluster == 0 || afatfs_FATIsEndOfChainMarker(file->cursorCluster);
+    }
+}
+
+
+
+
+
+
+
+static uint8_t* afatfs_fileRetainCursorSectorForRead(afatfsFilePtr_t file)
+{
+    uint8_t *result;
+
+    uint32_t physicalSector = afatfs_fileGetCursorPhysicalSector(file);
+
+
+
+
+    if (file->readRetainCacheIndex != -1) {
+        if (!afatfs_assert(physicalSector == afatfs.cacheDescriptor[file->readRetainCacheIndex].sectorIndex)) {
+            return 
+# 1832 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 1832 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+        }
+
+        result = afatfs_cacheSectorGetMemory(file->readRetainCacheIndex);
+    } else {
+        if (afatfs_isEndOfAllocatedFile(file)) {
+            return 
+# 1838 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 1838 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+        }
+
+        afatfs_assert(physicalSector > 0);
+
+        afatfsOperationStatus_e status = afatfs_cacheSector(
+            physicalSector,
+            &result,
+            1 | 16,
+            0
+        );
+
+        if (status != AFATFS_OPERATION_SUCCESS) {
+
+            return 
+# 1852 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 1852 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+        }
+
+        file->readRetainCacheIndex = afatfs_getCacheDescriptorIndexForBuffer(result);
+    }
+
+    return result;
+}
+
+
+
+
+
+
+static uint8_t* afatfs_fileLockCursorSectorForWrite(afatfsFilePtr_t file)
+{
+    afatfsOperationStatus_e status;
+    uint8_t *result;
+    uint32_t eraseBlockCount;
+
+
+    if (file->writeLockedCacheIndex != -1) {
+        uint32_t physicalSector = afatfs_fileGetCursorPhysicalSector(file);
+
+        if (!afatfs_assert(physicalSector == afatfs.cacheDescriptor[file->writeLockedCacheIndex].sectorIndex)) {
+            return 
+# 1877 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 1877 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+        }
+
+        result = afatfs_cacheSectorGetMemory(file->writeLockedCacheIndex);
+    } else {
+
+
+
+        if (afatfs_isEndOfAllocatedFile(file) && afatfs_appendFreeCluster(file) != AFATFS_OPERATION_SUCCESS) {
+
+            return 
+# 1887 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 1887 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+        }
+
+        uint32_t physicalSector = afatfs_fileGetCursorPhysicalSector(file);
+        uint8_t cacheFlags = 2 | 4;
+        uint32_t cursorOffsetInSector = file->cursorOffset % 512;
+        uint32_t offsetOfStartOfSector = file->cursorOffset & ~((uint32_t) 512 - 1);
+        uint32_t offsetOfEndOfSector = offsetOfStartOfSector + 512;
+
+
+
+
+
+        if (
+            cursorOffsetInSector > 0
+            || offsetOfEndOfSector < file->logicalSize
+        ) {
+            cacheFlags |= 1;
+        }
+
+
+        if ((file->mode & (4 | 8)) == (4 | 8)) {
+            uint32_t cursorOffsetInSupercluster = file->cursorOffset & (afatfs_superClusterSize() - 1);
+
+            eraseBlockCount = afatfs_fatEntriesPerSector() * afatfs.sectorsPerCluster - cursorOffsetInSupercluster / 512;
+        } else {
+            eraseBlockCount = 0;
+        }
+
+        status = afatfs_cacheSector(
+            physicalSector,
+            &result,
+            cacheFlags,
+            eraseBlockCount
+        );
+
+        if (status != AFATFS_OPERATION_SUCCESS) {
+
+            return 
+# 1925 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 1925 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+        }
+
+        file->writeLockedCacheIndex = afatfs_getCacheDescriptorIndexForBuffer(result);
+    }
+
+    return result;
+}
+# 1946 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static 
+# 1946 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 1946 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_fseekAtomic(afatfsFilePtr_t file, int32_t offset)
+{
+
+    uint32_t newSectorOffset = offset + file->cursorOffset % 512;
+
+
+    if (newSectorOffset < 512) {
+        file->cursorOffset += offset;
+        return 
+# 1954 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 1954 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    }
+
+
+    afatfs_fileUnlockCacheSector(file);
+
+
+    if (file->type == AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY) {
+        file->cursorOffset += offset;
+
+        return 
+# 1964 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 1964 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    }
+
+    uint32_t clusterSizeBytes = afatfs_clusterSize();
+    uint32_t offsetInCluster = afatfs_byteIndexInCluster(file->cursorOffset);
+    uint32_t newOffsetInCluster = offsetInCluster + offset;
+
+    afatfsOperationStatus_e status;
+
+    if (offset > (int32_t) clusterSizeBytes || offset < -(int32_t) offsetInCluster) {
+        return 
+# 1974 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 1974 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+    }
+
+
+    if (newOffsetInCluster >= clusterSizeBytes) {
+        uint32_t nextCluster;
+
+        status = afatfs_fileGetNextCluster(file, file->cursorCluster, &nextCluster);
+
+        if (status == AFATFS_OPERATION_SUCCESS) {
+
+            uint32_t bytesToSeek = clusterSizeBytes - offsetInCluster;
+
+            file->cursorPreviousCluster = file->cursorCluster;
+            file->cursorCluster = nextCluster;
+            file->cursorOffset += bytesToSeek;
+
+            offset -= bytesToSeek;
+        } else {
+
+            return 
+# 1994 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  0
+# 1994 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                       ;
+        }
+    }
+
+
+    if (!afatfs_isEndOfAllocatedFile(file)) {
+        file->cursorOffset += offset;
+    }
+
+    return 
+# 2003 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          1
+# 2003 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+
+
+
+
+static 
+# 2009 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+      _Bool 
+# 2009 "./src/main/io/asyncfatfs/asyncfatfs.c"
+           afatfs_fseekInternalContinue(afatfsFile_t *file)
+{
+    afatfsSeek_t *opState = &file->operation.state.seek;
+    uint32_t clusterSizeBytes = afatfs_clusterSize();
+    uint32_t offsetInCluster = afatfs_byteIndexInCluster(file->cursorOffset);
+
+    afatfsOperationStatus_e status;
+
+
+    while (offsetInCluster + opState->seekOffset >= clusterSizeBytes && !afatfs_isEndOfAllocatedFile(file)) {
+        uint32_t nextCluster;
+
+        status = afatfs_fileGetNextCluster(file, file->cursorCluster, &nextCluster);
+
+        if (status == AFATFS_OPERATION_SUCCESS) {
+
+            uint32_t bytesToSeek = clusterSizeBytes - offsetInCluster;
+
+            file->cursorPreviousCluster = file->cursorCluster;
+            file->cursorCluster = nextCluster;
+
+            file->cursorOffset += bytesToSeek;
+            opState->seekOffset -= bytesToSeek;
+            offsetInCluster = 0;
+        } else {
+
+            return 
+# 2035 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  0
+# 2035 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                       ;
+        }
+    }
+
+
+    if (!afatfs_isEndOfAllocatedFile(file)) {
+        file->cursorOffset += opState->seekOffset;
+    }
+
+    afatfs_fileUpdateFilesize(file);
+
+    file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+
+    if (opState->callback) {
+        opState->callback(file);
+    }
+
+    return 
+# 2052 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          1
+# 2052 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+# 2066 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_fseekInternal(afatfsFilePtr_t file, uint32_t offset, afatfsFileCallback_t callback)
+{
+
+    if (afatfs_fseekAtomic(file, offset)) {
+        if (callback) {
+            callback(file);
+        }
+
+        return AFATFS_OPERATION_SUCCESS;
+    } else {
+
+        if (afatfs_fileIsBusy(file)) {
+            return AFATFS_OPERATION_FAILURE;
+        }
+
+        afatfsSeek_t *opState = &file->operation.state.seek;
+
+        file->operation.operation = AFATFS_FILE_OPERATION_SEEK;
+        opState->callback = callback;
+        opState->seekOffset = offset;
+
+        return AFATFS_OPERATION_IN_PROGRESS;
+    }
+}
+# 2103 "./src/main/io/asyncfatfs/asyncfatfs.c"
+afatfsOperationStatus_e afatfs_fseek(afatfsFilePtr_t file, int32_t offset, afatfsSeek_e whence)
+{
+
+    afatfs_fileUpdateFilesize(file);
+
+    switch (whence) {
+        case AFATFS_SEEK_CUR:
+            if (offset >= 0) {
+
+                return afatfs_fseekInternal(file, __extension__ ({ __typeof__ (file->cursorOffset + offset) _a = (file->cursorOffset + offset); __typeof__ (file->logicalSize) _b = (file->logicalSize); _a < _b ? _a : _b; }), 
+# 2112 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                                                                      ((void *)0)
+# 2112 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                                                          );
+            }
+
+
+            offset += file->cursorOffset;
+        break;
+
+        case AFATFS_SEEK_END:
+
+            if (file->logicalSize + offset == file->cursorOffset) {
+                return AFATFS_OPERATION_SUCCESS;
+            }
+
+
+            offset += file->logicalSize;
+        break;
+
+        case AFATFS_SEEK_SET:
+        break;
+    }
+
+
+    afatfs_fileUnlockCacheSector(file);
+
+    file->cursorPreviousCluster = 0;
+    file->cursorCluster = file->firstCluster;
+    file->cursorOffset = 0;
+
+
+    return afatfs_fseekInternal(file, __extension__ ({ __typeof__ ((uint32_t) offset) _a = ((uint32_t) offset); __typeof__ (file->logicalSize) _b = (file->logicalSize); _a < _b ? _a : _b; }), 
+# 2141 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                                                ((void *)0)
+# 2141 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                                    );
+}
+
+
+
+
+
+
+
+# 2149 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 2149 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_ftell(afatfsFilePtr_t file, uint32_t *position)
+{
+    if (afatfs_fileIsBusy(file)) {
+        return 
+# 2152 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 2152 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+    } else {
+        *position = file->cursorOffset;
+        return 
+# 2155 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 2155 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    }
+}
+# 2167 "./src/main/io/asyncfatfs/asyncfatfs.c"
+afatfsOperationStatus_e afatfs_findNext(afatfsFilePtr_t directory, afatfsFinder_t *finder, fatDirectoryEntry_t **dirEntry)
+{
+    uint8_t *sector;
+
+    if (finder->entryIndex == (512 / sizeof(fatDirectoryEntry_t)) - 1) {
+        if (afatfs_fseekAtomic(directory, 512)) {
+            finder->entryIndex = -1;
+
+        } else {
+            return AFATFS_OPERATION_IN_PROGRESS;
+        }
+    }
+
+    sector = afatfs_fileRetainCursorSectorForRead(directory);
+
+    if (sector) {
+        finder->entryIndex++;
+
+        *dirEntry = (fatDirectoryEntry_t*) sector + finder->entryIndex;
+
+        finder->sectorNumberPhysical = afatfs_fileGetCursorPhysicalSector(directory);
+
+        return AFATFS_OPERATION_SUCCESS;
+    } else {
+        if (afatfs_isEndOfAllocatedFile(directory)) {
+            *dirEntry = 
+# 2192 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                       ((void *)0)
+# 2192 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                           ;
+
+            return AFATFS_OPERATION_SUCCESS;
+        }
+
+        return AFATFS_OPERATION_IN_PROGRESS;
+    }
+}
+
+
+
+
+void afatfs_findLast(afatfsFilePtr_t directory)
+{
+    afatfs_fileUnlockCacheSector(directory);
+}
+
+
+
+
+
+void afatfs_findFirst(afatfsFilePtr_t directory, afatfsFinder_t *finder)
+{
+    afatfs_fseek(directory, 0, AFATFS_SEEK_SET);
+    finder->entryIndex = -1;
+}
+
+static afatfsOperationStatus_e afatfs_extendSubdirectoryContinue(afatfsFile_t *directory)
+{
+    afatfsExtendSubdirectory_t *opState = &directory->operation.state.extendSubdirectory;
+    afatfsOperationStatus_e status;
+    uint8_t *sectorBuffer;
+    uint32_t clusterNumber, physicalSector;
+    uint16_t sectorInCluster;
+
+    doMore:
+    switch (opState->phase) {
+        case AFATFS_EXTEND_SUBDIRECTORY_PHASE_ADD_FREE_CLUSTER:
+            status = afatfs_appendRegularFreeClusterContinue(directory);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_EXTEND_SUBDIRECTORY_PHASE_WRITE_SECTORS;
+                goto doMore;
+            } else if (status == AFATFS_OPERATION_FAILURE) {
+                opState->phase = AFATFS_EXTEND_SUBDIRECTORY_PHASE_FAILURE;
+                goto doMore;
+            }
+        break;
+        case AFATFS_EXTEND_SUBDIRECTORY_PHASE_WRITE_SECTORS:
+
+            afatfs_fileGetCursorClusterAndSector(directory, &clusterNumber, &sectorInCluster);
+            physicalSector = afatfs_fileGetCursorPhysicalSector(directory);
+
+            while (1) {
+                status = afatfs_cacheSector(physicalSector, &sectorBuffer, 2, 0);
+
+                if (status != AFATFS_OPERATION_SUCCESS) {
+                    return status;
+                }
+
+                memset(sectorBuffer, 0, 512);
+
+
+                if (directory->directoryEntryPos.sectorNumberPhysical != 0 && directory->cursorOffset == 0) {
+                    fatDirectoryEntry_t *dirEntries = (fatDirectoryEntry_t *) sectorBuffer;
+
+                    memset(dirEntries[0].filename, ' ', sizeof(dirEntries[0].filename));
+                    dirEntries[0].filename[0] = '.';
+                    dirEntries[0].firstClusterHigh = directory->firstCluster >> 16;
+                    dirEntries[0].firstClusterLow = directory->firstCluster & 0xFFFF;
+                    dirEntries[0].attrib = 0x10;
+
+                    memset(dirEntries[1].filename, ' ', sizeof(dirEntries[1].filename));
+                    dirEntries[1].filename[0] = '.';
+                    dirEntries[1].filename[1] = '.';
+                    dirEntries[1].firstClusterHigh = opState->parentDirectoryCluster >> 16;
+                    dirEntries[1].firstClusterLow = opState->parentDirectoryCluster & 0xFFFF;
+                    dirEntries[1].attrib = 0x10;
+                }
+
+                if (sectorInCluster < afatfs.sectorsPerCluster - 1) {
+
+                    afatfs_assert(afatfs_fseekAtomic(directory, 512));
+                    sectorInCluster++;
+                    physicalSector++;
+                } else {
+                    break;
+                }
+            }
+
+
+            afatfs_assert(afatfs_fseekAtomic(directory, -512 * (afatfs.sectorsPerCluster - 1)));
+            opState->phase = AFATFS_EXTEND_SUBDIRECTORY_PHASE_SUCCESS;
+            goto doMore;
+        break;
+        case AFATFS_EXTEND_SUBDIRECTORY_PHASE_SUCCESS:
+            directory->operation.operation = AFATFS_FILE_OPERATION_NONE;
+
+            if (opState->callback) {
+                opState->callback(directory);
+            }
+
+            return AFATFS_OPERATION_SUCCESS;
+        break;
+        case AFATFS_EXTEND_SUBDIRECTORY_PHASE_FAILURE:
+            directory->operation.operation = AFATFS_FILE_OPERATION_NONE;
+
+            if (opState->callback) {
+                opState->callback(
+# 2300 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                 ((void *)0)
+# 2300 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                     );
+            }
+            return AFATFS_OPERATION_FAILURE;
+        break;
+    }
+
+    return AFATFS_OPERATION_IN_PROGRESS;
+}
+# 2320 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_extendSubdirectory(afatfsFile_t *directory, afatfsFilePtr_t parentDirectory, afatfsFileCallback_t callback)
+{
+
+    if (directory->type == AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY || afatfs_fileIsBusy(directory)) {
+        return AFATFS_OPERATION_FAILURE;
+    }
+
+
+
+
+
+    afatfsExtendSubdirectory_t *opState = &directory->operation.state.extendSubdirectory;
+
+    directory->operation.operation = AFATFS_FILE_OPERATION_EXTEND_SUBDIRECTORY;
+
+    opState->phase = AFATFS_EXTEND_SUBDIRECTORY_PHASE_INITIAL;
+    opState->parentDirectoryCluster = parentDirectory ? parentDirectory->firstCluster : 0;
+    opState->callback = callback;
+
+    afatfs_appendRegularFreeClusterInitOperationState(&opState->appendFreeCluster, directory->cursorPreviousCluster);
+
+    return afatfs_extendSubdirectoryContinue(directory);
+}
+# 2359 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_allocateDirectoryEntry(afatfsFilePtr_t directory, fatDirectoryEntry_t **dirEntry, afatfsFinder_t *finder)
+{
+    afatfsOperationStatus_e result;
+
+    if (afatfs_fileIsBusy(directory)) {
+        return AFATFS_OPERATION_IN_PROGRESS;
+    }
+
+    while ((result = afatfs_findNext(directory, finder, dirEntry)) == AFATFS_OPERATION_SUCCESS) {
+        if (*dirEntry) {
+            if (fat_isDirectoryEntryEmpty(*dirEntry) || fat_isDirectoryEntryTerminator(*dirEntry)) {
+                afatfs_cacheSectorMarkDirty(afatfs_getCacheDescriptorForBuffer((uint8_t*) *dirEntry));
+
+                afatfs_findLast(directory);
+                return AFATFS_OPERATION_SUCCESS;
+            }
+        } else {
+
+            result = afatfs_extendSubdirectory(directory, 
+# 2377 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                         ((void *)0)
+# 2377 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                             , 
+# 2377 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                               ((void *)0)
+# 2377 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                   );
+
+            if (result == AFATFS_OPERATION_SUCCESS) {
+
+                continue;
+            } else {
+
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+
+
+
+
+static afatfsFilePtr_t afatfs_allocateFileHandle(void)
+{
+    for (int i = 0; i < 3; i++) {
+        if (afatfs.openFiles[i].type == AFATFS_FILE_TYPE_NONE) {
+            return &afatfs.openFiles[i];
+        }
+    }
+
+    return 
+# 2404 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          ((void *)0)
+# 2404 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+# 2414 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_ftruncateContinue(afatfsFilePtr_t file, 
+# 2414 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                                             _Bool 
+# 2414 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                                  markDeleted)
+{
+    afatfsTruncateFile_t *opState = &file->operation.state.truncateFile;
+    afatfsOperationStatus_e status = AFATFS_OPERATION_FAILURE;
+
+
+    uint32_t oldFreeFileStart, freeFileGrow;
+
+
+    doMore:
+
+    switch (opState->phase) {
+        case AFATFS_TRUNCATE_FILE_UPDATE_DIRECTORY:
+            status = afatfs_saveDirectoryEntry(file, markDeleted ? AFATFS_SAVE_DIRECTORY_DELETED : AFATFS_SAVE_DIRECTORY_NORMAL);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+
+                if (opState->endCluster) {
+                    opState->phase = AFATFS_TRUNCATE_FILE_ERASE_FAT_CHAIN_CONTIGUOUS;
+                } else
+
+                {
+                    opState->phase = AFATFS_TRUNCATE_FILE_ERASE_FAT_CHAIN_NORMAL;
+                }
+                goto doMore;
+            }
+        break;
+
+        case AFATFS_TRUNCATE_FILE_ERASE_FAT_CHAIN_CONTIGUOUS:
+
+            status = afatfs_FATFillWithPattern(AFATFS_FAT_PATTERN_UNTERMINATED_CHAIN, &opState->currentCluster, opState->endCluster);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_TRUNCATE_FILE_PREPEND_TO_FREEFILE;
+                goto doMore;
+            }
+        break;
+        case AFATFS_TRUNCATE_FILE_PREPEND_TO_FREEFILE:
+
+            oldFreeFileStart = afatfs.freeFile.firstCluster;
+
+            afatfs.freeFile.firstCluster = opState->startCluster;
+
+            freeFileGrow = (oldFreeFileStart - opState->startCluster) * afatfs_clusterSize();
+
+            afatfs.freeFile.logicalSize += freeFileGrow;
+            afatfs.freeFile.physicalSize += freeFileGrow;
+
+            status = afatfs_saveDirectoryEntry(&afatfs.freeFile, AFATFS_SAVE_DIRECTORY_NORMAL);
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                opState->phase = AFATFS_TRUNCATE_FILE_SUCCESS;
+                goto doMore;
+            }
+        break;
+
+        case AFATFS_TRUNCATE_FILE_ERASE_FAT_CHAIN_NORMAL:
+            while (!afatfs_FATIsEndOfChainMarker(opState->currentCluster)) {
+                uint32_t nextCluster;
+
+                status = afatfs_FATGetNextCluster(0, opState->currentCluster, &nextCluster);
+
+                if (status != AFATFS_OPERATION_SUCCESS) {
+                    return status;
+                }
+
+                status = afatfs_FATSetNextCluster(opState->currentCluster, 0);
+
+                if (status != AFATFS_OPERATION_SUCCESS) {
+                    return status;
+                }
+
+                opState->currentCluster = nextCluster;
+
+
+                afatfs.lastClusterAllocated = __extension__ ({ __typeof__ (afatfs.lastClusterAllocated) _a = (afatfs.lastClusterAllocated); __typeof__ (opState->currentCluster - 1) _b = (opState->currentCluster - 1); _a < _b ? _a : _b; });
+            }
+
+            opState->phase = AFATFS_TRUNCATE_FILE_SUCCESS;
+            goto doMore;
+        break;
+        case AFATFS_TRUNCATE_FILE_SUCCESS:
+            if (file->operation.operation == AFATFS_FILE_OPERATION_TRUNCATE) {
+                file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+            }
+
+            if (opState->callback) {
+                opState->callback(file);
+            }
+
+            return AFATFS_OPERATION_SUCCESS;
+        break;
+    }
+
+    if (status == AFATFS_OPERATION_FAILURE && file->operation.operation == AFATFS_FILE_OPERATION_TRUNCATE) {
+        file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+    }
+
+    return status;
+}
+# 2521 "./src/main/io/asyncfatfs/asyncfatfs.c"
+
+# 2521 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 2521 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_ftruncate(afatfsFilePtr_t file, afatfsFileCallback_t callback)
+{
+    afatfsTruncateFile_t *opState;
+
+    if (afatfs_fileIsBusy(file))
+        return 
+# 2526 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 2526 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+
+    file->operation.operation = AFATFS_FILE_OPERATION_TRUNCATE;
+
+    opState = &file->operation.state.truncateFile;
+    opState->callback = callback;
+    opState->phase = AFATFS_TRUNCATE_FILE_INITIAL;
+    opState->startCluster = file->firstCluster;
+    opState->currentCluster = opState->startCluster;
+
+
+    if ((file->mode & 8) != 0) {
+
+        opState->endCluster = afatfs.freeFile.firstCluster;
+    } else
+
+    {
+
+        opState->endCluster = 0;
+    }
+
+
+    file->firstCluster = 0;
+    file->logicalSize = 0;
+    file->physicalSize = 0;
+
+    afatfs_fseek(file, 0, AFATFS_SEEK_SET);
+
+    return 
+# 2554 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          1
+# 2554 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+
+
+
+
+static void afatfs_fileLoadDirectoryEntry(afatfsFile_t *file, fatDirectoryEntry_t *entry)
+{
+    file->firstCluster = (uint32_t) (entry->firstClusterHigh << 16) | entry->firstClusterLow;
+    file->logicalSize = entry->fileSize;
+    file->physicalSize = roundUpTo(entry->fileSize, afatfs_clusterSize());
+    file->attrib = entry->attrib;
+}
+
+static void afatfs_createFileContinue(afatfsFile_t *file)
+{
+    afatfsCreateFile_t *opState = &file->operation.state.createFile;
+    fatDirectoryEntry_t *entry;
+    afatfsOperationStatus_e status;
+
+    doMore:
+
+    switch (opState->phase) {
+        case AFATFS_CREATEFILE_PHASE_INITIAL:
+            afatfs_findFirst(&afatfs.currentDirectory, &file->directoryEntryPos);
+            opState->phase = AFATFS_CREATEFILE_PHASE_FIND_FILE;
+            goto doMore;
+        break;
+        case AFATFS_CREATEFILE_PHASE_FIND_FILE:
+            do {
+                status = afatfs_findNext(&afatfs.currentDirectory, &file->directoryEntryPos, &entry);
+
+                switch (status) {
+                    case AFATFS_OPERATION_SUCCESS:
+
+                        if (entry == 
+# 2589 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                    ((void *)0) 
+# 2589 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                         || fat_isDirectoryEntryTerminator(entry)) {
+                            afatfs_findLast(&afatfs.currentDirectory);
+
+                            if ((file->mode & 16) != 0) {
+
+                                afatfs_findFirst(&afatfs.currentDirectory, &file->directoryEntryPos);
+
+                                opState->phase = AFATFS_CREATEFILE_PHASE_CREATE_NEW_FILE;
+                                goto doMore;
+                            } else {
+
+
+                                opState->phase = AFATFS_CREATEFILE_PHASE_FAILURE;
+                                goto doMore;
+                            }
+                        } else if (strncmp(entry->filename, (char*) opState->filename, 11) == 0) {
+
+                            afatfs_fileLoadDirectoryEntry(file, entry);
+
+                            afatfs_findLast(&afatfs.currentDirectory);
+
+                            opState->phase = AFATFS_CREATEFILE_PHASE_SUCCESS;
+                            goto doMore;
+                        }
+                    break;
+                    case AFATFS_OPERATION_FAILURE:
+                        afatfs_findLast(&afatfs.currentDirectory);
+                        opState->phase = AFATFS_CREATEFILE_PHASE_FAILURE;
+                        goto doMore;
+                    break;
+                    case AFATFS_OPERATION_IN_PROGRESS:
+                        ;
+                }
+            } while (status == AFATFS_OPERATION_SUCCESS);
+        break;
+        case AFATFS_CREATEFILE_PHASE_CREATE_NEW_FILE:
+            status = afatfs_allocateDirectoryEntry(&afatfs.currentDirectory, &entry, &file->directoryEntryPos);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                memset(entry, 0, sizeof(*entry));
+
+                memcpy(entry->filename, opState->filename, 11);
+                entry->attrib = file->attrib;
+
+                uint16_t fileDate = (01 | (12 << 5) | ((2015 - 1980) << 9));
+                uint16_t fileTime = ((00 / 2) | (00 << 5) | (00 << 11));
+
+
+
+
+                dateTime_t dt, local_dt;
+                rtcGetDateTime(&dt);
+                if (dt.year != 0) {
+
+                    dateTimeUTCToLocal(&dt, &local_dt);
+                    fileDate = (local_dt.day | (local_dt.month << 5) | ((local_dt.year - 1980) << 9));
+                    fileTime = ((local_dt.seconds / 2) | (local_dt.minutes << 5) | (local_dt.hours << 11));
+                }
+
+
+                entry->creationDate = fileDate;
+                entry->creationTime = fileTime;
+                entry->lastWriteDate = fileDate;
+                entry->lastWriteTime = fileTime;
+
+
+
+
+
+                opState->phase = AFATFS_CREATEFILE_PHASE_SUCCESS;
+                goto doMore;
+            } else if (status == AFATFS_OPERATION_FAILURE) {
+                opState->phase = AFATFS_CREATEFILE_PHASE_FAILURE;
+                goto doMore;
+            }
+        break;
+        case AFATFS_CREATEFILE_PHASE_SUCCESS:
+            if ((file->mode & 32) != 0) {
+
+
+
+
+                uint8_t *directorySector;
+
+                status = afatfs_cacheSector(
+                    file->directoryEntryPos.sectorNumberPhysical,
+                    &directorySector,
+                    1 | 16,
+                    0
+                );
+
+                if (status != AFATFS_OPERATION_SUCCESS) {
+
+                    break;
+                }
+            }
+
+            afatfs_fseek(file, 0, AFATFS_SEEK_SET);
+
+
+            if (file->cursorCluster == 0) {
+
+                if ((file->mode & 8) != 0) {
+                    if (afatfs_fileIsBusy(&afatfs.freeFile)) {
+
+                        break;
+                    } else {
+
+                        afatfs.freeFile.operation.operation = AFATFS_FILE_OPERATION_LOCKED;
+                    }
+                }
+
+            } else {
+
+                file->mode &= ~8;
+
+
+                if ((file->mode & 4) != 0) {
+
+                    file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+                    afatfs_fseekInternal(file, file->logicalSize, opState->callback);
+                    break;
+                }
+
+
+                if (file->mode == (16 | 2)) {
+
+                    file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+                    afatfs_ftruncate(file, opState->callback);
+                    break;
+                }
+            }
+
+            file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+            opState->callback(file);
+        break;
+        case AFATFS_CREATEFILE_PHASE_FAILURE:
+            file->type = AFATFS_FILE_TYPE_NONE;
+            opState->callback(
+# 2727 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                             ((void *)0)
+# 2727 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                 );
+        break;
+    }
+}
+
+
+
+
+static void afatfs_initFileHandle(afatfsFilePtr_t file)
+{
+    memset(file, 0, sizeof(*file));
+    file->writeLockedCacheIndex = -1;
+    file->readRetainCacheIndex = -1;
+}
+
+static void afatfs_funlinkContinue(afatfsFilePtr_t file)
+{
+    afatfsUnlinkFile_t *opState = &file->operation.state.unlinkFile;
+    afatfsOperationStatus_e status;
+
+    status = afatfs_ftruncateContinue(file, 
+# 2747 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                           1
+# 2747 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                               );
+
+    if (status == AFATFS_OPERATION_SUCCESS) {
+
+        file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+        afatfs_fclose(file, opState->callback);
+    }
+}
+
+
+
+
+
+
+
+
+# 2762 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 2762 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_funlink(afatfsFilePtr_t file, afatfsCallback_t callback)
+{
+    afatfsUnlinkFile_t *opState = &file->operation.state.unlinkFile;
+
+    if (!file || file->type == AFATFS_FILE_TYPE_NONE) {
+        return 
+# 2767 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 2767 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    }
+
+
+
+
+
+
+
+    if (!afatfs_ftruncate(file, 
+# 2776 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                               ((void *)0)
+# 2776 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                   ))
+        return 
+# 2777 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 2777 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+
+
+
+
+
+    opState->callback = callback;
+
+    file->operation.operation = AFATFS_FILE_OPERATION_UNLINK;
+
+    return 
+# 2787 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          1
+# 2787 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+# 2800 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsFilePtr_t afatfs_createFile(afatfsFilePtr_t file, const char *name, uint8_t attrib, uint8_t fileMode,
+        afatfsFileCallback_t callback)
+{
+    afatfsCreateFile_t *opState = &file->operation.state.createFile;
+
+    afatfs_initFileHandle(file);
+
+
+    file->operation.operation = AFATFS_FILE_OPERATION_CREATE_FILE;
+
+    file->mode = fileMode;
+
+    if (strcmp(name, ".") == 0) {
+        file->firstCluster = afatfs.currentDirectory.firstCluster;
+        file->physicalSize = afatfs.currentDirectory.physicalSize;
+        file->logicalSize = afatfs.currentDirectory.logicalSize;
+        file->attrib = afatfs.currentDirectory.attrib;
+        file->type = afatfs.currentDirectory.type;
+    } else {
+        fat_convertFilenameToFATStyle(name, opState->filename);
+        file->attrib = attrib;
+
+        if ((attrib & 0x10) != 0) {
+            file->type = AFATFS_FILE_TYPE_DIRECTORY;
+        } else {
+            file->type = AFATFS_FILE_TYPE_NORMAL;
+        }
+    }
+
+    opState->callback = callback;
+
+    if (strcmp(name, ".") == 0) {
+
+        opState->phase = AFATFS_CREATEFILE_PHASE_SUCCESS;
+    } else {
+        opState->phase = AFATFS_CREATEFILE_PHASE_INITIAL;
+    }
+
+    afatfs_createFileContinue(file);
+
+    return file;
+}
+
+static void afatfs_fcloseContinue(afatfsFilePtr_t file)
+{
+    afatfsCacheBlockDescriptor_t *descriptor;
+    afatfsCloseFile_t *opState = &file->operation.state.closeFile;
+# 2855 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    if (file->type != AFATFS_FILE_TYPE_DIRECTORY && file->type != AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY
+            && (file->mode & (4 | 2)) != 0) {
+        if (afatfs_saveDirectoryEntry(file, AFATFS_SAVE_DIRECTORY_FOR_CLOSE) != AFATFS_OPERATION_SUCCESS) {
+            return;
+        }
+    }
+
+
+    if ((file->mode & 32) != 0) {
+        descriptor = afatfs_findCacheSector(file->directoryEntryPos.sectorNumberPhysical);
+
+        if (descriptor) {
+            descriptor->retainCount = __extension__ ({ __typeof__ ((int) descriptor->retainCount - 1) _a = ((int) descriptor->retainCount - 1); __typeof__ (0) _b = (0); _a > _b ? _a : _b; });
+        }
+    }
+
+
+    afatfs_fileUnlockCacheSector(file);
+
+
+
+    if ((file->mode & 8) != 0) {
+        afatfs_assert(afatfs.freeFile.operation.operation == AFATFS_FILE_OPERATION_LOCKED);
+        afatfs.freeFile.operation.operation = AFATFS_FILE_OPERATION_NONE;
+    }
+
+
+    file->type = AFATFS_FILE_TYPE_NONE;
+    file->operation.operation = AFATFS_FILE_OPERATION_NONE;
+
+    if (opState->callback) {
+        opState->callback();
+    }
+}
+# 2899 "./src/main/io/asyncfatfs/asyncfatfs.c"
+
+# 2899 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 2899 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback)
+{
+    if (!file || file->type == AFATFS_FILE_TYPE_NONE) {
+        return 
+# 2902 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 2902 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    } else if (afatfs_fileIsBusy(file)) {
+        return 
+# 2904 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 2904 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+    } else {
+        afatfs_fileUpdateFilesize(file);
+
+        file->operation.operation = AFATFS_FILE_OPERATION_CLOSE;
+        file->operation.state.closeFile.callback = callback;
+        afatfs_fcloseContinue(file);
+        return 
+# 2911 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 2911 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    }
+}
+# 2922 "./src/main/io/asyncfatfs/asyncfatfs.c"
+
+# 2922 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 2922 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_mkdir(const char *filename, afatfsFileCallback_t callback)
+{
+    afatfsFilePtr_t file = afatfs_allocateFileHandle();
+
+    if (file) {
+        afatfs_createFile(file, filename, 0x10, 16 | 1 | 2, callback);
+    } else if (callback) {
+        callback(
+# 2929 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                ((void *)0)
+# 2929 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                    );
+    }
+
+    return file != 
+# 2932 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 2932 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+}
+# 2942 "./src/main/io/asyncfatfs/asyncfatfs.c"
+
+# 2942 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 2942 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_chdir(afatfsFilePtr_t directory)
+{
+    if (afatfs_fileIsBusy(&afatfs.currentDirectory)) {
+        return 
+# 2945 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              0
+# 2945 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                   ;
+    }
+
+    if (directory) {
+        if (afatfs_fileIsBusy(directory)) {
+            return 
+# 2950 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  0
+# 2950 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                       ;
+        }
+
+        memcpy(&afatfs.currentDirectory, directory, sizeof(*directory));
+        return 
+# 2954 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 2954 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    } else {
+        afatfs_initFileHandle(&afatfs.currentDirectory);
+
+        afatfs.currentDirectory.mode = 1 | 2;
+
+        if (afatfs.filesystemType == FAT_FILESYSTEM_TYPE_FAT16)
+            afatfs.currentDirectory.type = AFATFS_FILE_TYPE_FAT16_ROOT_DIRECTORY;
+        else
+            afatfs.currentDirectory.type = AFATFS_FILE_TYPE_DIRECTORY;
+
+        afatfs.currentDirectory.firstCluster = afatfs.rootDirectoryCluster;
+        afatfs.currentDirectory.attrib = 0x10;
+
+
+        afatfs.currentDirectory.directoryEntryPos.sectorNumberPhysical = 0;
+
+        afatfs_fseek(&afatfs.currentDirectory, 0, AFATFS_SEEK_SET);
+
+        return 
+# 2973 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+              1
+# 2973 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                  ;
+    }
+}
+# 3003 "./src/main/io/asyncfatfs/asyncfatfs.c"
+
+# 3003 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 3003 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t complete)
+{
+    uint8_t fileMode = 0;
+    afatfsFilePtr_t file;
+
+    switch (mode[0]) {
+        case 'r':
+            fileMode = 1;
+        break;
+        case 'w':
+            fileMode = 2 | 16;
+        break;
+        case 'a':
+            fileMode = 4 | 16;
+        break;
+    }
+
+    switch (mode[1]) {
+        case '+':
+            fileMode |= 1;
+
+            if (fileMode == 1) {
+                fileMode |= 2;
+            }
+        break;
+        case 's':
+
+            fileMode |= 8 | 32;
+
+        break;
+    }
+
+    file = afatfs_allocateFileHandle();
+
+    if (file) {
+        afatfs_createFile(file, filename, 0x20, fileMode, complete);
+    } else if (complete) {
+        complete(
+# 3040 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                ((void *)0)
+# 3040 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                    );
+    }
+
+    return file != 
+# 3043 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  ((void *)0)
+# 3043 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                      ;
+}
+
+
+
+
+
+void afatfs_fputc(afatfsFilePtr_t file, uint8_t c)
+{
+    uint32_t cursorOffsetInSector = file->cursorOffset % 512;
+
+    int cacheIndex = file->writeLockedCacheIndex;
+
+
+
+
+    if (cacheIndex != -1 && cursorOffsetInSector != 512 - 1) {
+        afatfs_cacheSectorGetMemory(cacheIndex)[cursorOffsetInSector] = c;
+        file->cursorOffset++;
+    } else {
+
+        afatfs_fwrite(file, &c, sizeof(c));
+    }
+}
+# 3080 "./src/main/io/asyncfatfs/asyncfatfs.c"
+uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len)
+{
+    if ((file->mode & (4 | 2)) == 0) {
+        return 0;
+    }
+
+    if (afatfs_fileIsBusy(file)) {
+
+        return 0;
+    }
+
+    uint32_t cursorOffsetInSector = file->cursorOffset % 512;
+    uint32_t writtenBytes = 0;
+
+    while (len > 0) {
+        uint32_t bytesToWriteThisSector = __extension__ ({ __typeof__ (512 - cursorOffsetInSector) _a = (512 - cursorOffsetInSector); __typeof__ (len) _b = (len); _a < _b ? _a : _b; });
+        uint8_t *sectorBuffer;
+
+        sectorBuffer = afatfs_fileLockCursorSectorForWrite(file);
+        if (!sectorBuffer) {
+
+            break;
+        }
+
+        memcpy(sectorBuffer + cursorOffsetInSector, buffer, bytesToWriteThisSector);
+
+        writtenBytes += bytesToWriteThisSector;
+# 3117 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        if (afatfs_fseekInternal(file, bytesToWriteThisSector, 
+# 3117 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                              ((void *)0)
+# 3117 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                  ) == AFATFS_OPERATION_IN_PROGRESS) {
+            break;
+        }
+
+
+        if ((file->mode & 8) != 0) {
+            afatfs_assert(file->cursorCluster < afatfs.freeFile.firstCluster);
+        }
+
+
+        len -= bytesToWriteThisSector;
+        buffer += bytesToWriteThisSector;
+        cursorOffsetInSector = 0;
+    }
+
+    return writtenBytes;
+}
+# 3147 "./src/main/io/asyncfatfs/asyncfatfs.c"
+uint32_t afatfs_fread(afatfsFilePtr_t file, uint8_t *buffer, uint32_t len)
+{
+    if ((file->mode & 1) == 0) {
+        return 0;
+    }
+
+    if (afatfs_fileIsBusy(file)) {
+
+        return 0;
+    }
+
+
+
+
+
+
+    if (file->cursorOffset >= file->logicalSize)
+        return 0;
+
+    len = __extension__ ({ __typeof__ (file->logicalSize - file->cursorOffset) _a = (file->logicalSize - file->cursorOffset); __typeof__ (len) _b = (len); _a < _b ? _a : _b; });
+
+    uint32_t readBytes = 0;
+    uint32_t cursorOffsetInSector = file->cursorOffset % 512;
+
+    while (len > 0) {
+        uint32_t bytesToReadThisSector = __extension__ ({ __typeof__ (512 - cursorOffsetInSector) _a = (512 - cursorOffsetInSector); __typeof__ (len) _b = (len); _a < _b ? _a : _b; });
+        uint8_t *sectorBuffer;
+
+        sectorBuffer = afatfs_fileRetainCursorSectorForRead(file);
+        if (!sectorBuffer) {
+
+            return readBytes;
+        }
+
+        memcpy(buffer, sectorBuffer + cursorOffsetInSector, bytesToReadThisSector);
+
+        readBytes += bytesToReadThisSector;
+# 3192 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        if (afatfs_fseekInternal(file, bytesToReadThisSector, 
+# 3192 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                             ((void *)0)
+# 3192 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                                 ) == AFATFS_OPERATION_IN_PROGRESS) {
+            break;
+        }
+
+        len -= bytesToReadThisSector;
+        buffer += bytesToReadThisSector;
+        cursorOffsetInSector = 0;
+    }
+
+    return readBytes;
+}
+
+
+
+
+
+
+# 3208 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 3208 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_feof(afatfsFilePtr_t file)
+{
+    return file->cursorOffset >= file->logicalSize;
+}
+
+
+
+
+static void afatfs_fileOperationContinue(afatfsFile_t *file)
+{
+    if (file->type == AFATFS_FILE_TYPE_NONE)
+        return;
+
+    switch (file->operation.operation) {
+        case AFATFS_FILE_OPERATION_CREATE_FILE:
+            afatfs_createFileContinue(file);
+        break;
+        case AFATFS_FILE_OPERATION_SEEK:
+            afatfs_fseekInternalContinue(file);
+        break;
+        case AFATFS_FILE_OPERATION_CLOSE:
+            afatfs_fcloseContinue(file);
+        break;
+        case AFATFS_FILE_OPERATION_UNLINK:
+             afatfs_funlinkContinue(file);
+        break;
+        case AFATFS_FILE_OPERATION_TRUNCATE:
+            afatfs_ftruncateContinue(file, 
+# 3235 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                          0
+# 3235 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                               );
+        break;
+
+        case AFATFS_FILE_OPERATION_APPEND_SUPERCLUSTER:
+            afatfs_appendSuperclusterContinue(file);
+        break;
+        case AFATFS_FILE_OPERATION_LOCKED:
+            ;
+        break;
+
+        case AFATFS_FILE_OPERATION_APPEND_FREE_CLUSTER:
+            afatfs_appendRegularFreeClusterContinue(file);
+        break;
+        case AFATFS_FILE_OPERATION_EXTEND_SUBDIRECTORY:
+            afatfs_extendSubdirectoryContinue(file);
+        break;
+        case AFATFS_FILE_OPERATION_NONE:
+            ;
+        break;
+    }
+}
+
+
+
+
+static void afatfs_fileOperationsPoll(void)
+{
+    afatfs_fileOperationContinue(&afatfs.currentDirectory);
+
+
+
+
+
+    for (int i = 0; i < 3; i++) {
+        afatfs_fileOperationContinue(&afatfs.openFiles[i]);
+    }
+}
+
+
+
+
+
+
+uint32_t afatfs_getContiguousFreeSpace(void)
+{
+    return afatfs.freeFile.logicalSize;
+}
+
+
+
+
+
+static void afatfs_findLargestContiguousFreeBlockBegin(void)
+{
+
+    afatfs.initState.freeSpaceSearch.candidateStart = afatfs_fatEntriesPerSector();
+    afatfs.initState.freeSpaceSearch.candidateEnd = afatfs.initState.freeSpaceSearch.candidateStart;
+    afatfs.initState.freeSpaceSearch.bestGapStart = 0;
+    afatfs.initState.freeSpaceSearch.bestGapLength = 0;
+    afatfs.initState.freeSpaceSearch.phase = AFATFS_FREE_SPACE_SEARCH_PHASE_FIND_HOLE;
+}
+# 3305 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static afatfsOperationStatus_e afatfs_findLargestContiguousFreeBlockContinue(void)
+{
+    afatfsFreeSpaceSearch_t *opState = &afatfs.initState.freeSpaceSearch;
+    uint32_t fatEntriesPerSector = afatfs_fatEntriesPerSector();
+    uint32_t candidateGapLength, searchLimit;
+    afatfsFindClusterStatus_e searchStatus;
+
+    while (1) {
+        switch (opState->phase) {
+            case AFATFS_FREE_SPACE_SEARCH_PHASE_FIND_HOLE:
+
+                switch (afatfs_findClusterWithCondition(CLUSTER_SEARCH_FREE_AT_BEGINNING_OF_FAT_SECTOR, &opState->candidateStart, afatfs.numClusters + 2)) {
+                    case AFATFS_FIND_CLUSTER_FOUND:
+                        opState->candidateEnd = opState->candidateStart + 1;
+                        opState->phase = AFATFS_FREE_SPACE_SEARCH_PHASE_GROW_HOLE;
+                    break;
+
+                    case AFATFS_FIND_CLUSTER_FATAL:
+
+                        return AFATFS_OPERATION_FAILURE;
+
+                    case AFATFS_FIND_CLUSTER_NOT_FOUND:
+
+                        return AFATFS_OPERATION_SUCCESS;
+
+                    case AFATFS_FIND_CLUSTER_IN_PROGRESS:
+                        return AFATFS_OPERATION_IN_PROGRESS;
+                }
+            break;
+            case AFATFS_FREE_SPACE_SEARCH_PHASE_GROW_HOLE:
+
+
+
+                searchLimit = __extension__ ({ __typeof__ ((uint64_t) opState->candidateStart + 0xFFFFFFFF / afatfs_clusterSize()) _a = ((uint64_t) opState->candidateStart + 0xFFFFFFFF / afatfs_clusterSize()); __typeof__ (afatfs.numClusters + 2) _b = (afatfs.numClusters + 2); _a < _b ? _a : _b; });
+
+                searchStatus = afatfs_findClusterWithCondition(CLUSTER_SEARCH_OCCUPIED, &opState->candidateEnd, searchLimit);
+
+                switch (searchStatus) {
+                    case AFATFS_FIND_CLUSTER_NOT_FOUND:
+                    case AFATFS_FIND_CLUSTER_FOUND:
+
+                        candidateGapLength = opState->candidateEnd - opState->candidateStart;
+
+                        if (candidateGapLength > opState->bestGapLength) {
+                            opState->bestGapStart = opState->candidateStart;
+                            opState->bestGapLength = candidateGapLength;
+                        }
+
+                        if (searchStatus == AFATFS_FIND_CLUSTER_NOT_FOUND) {
+
+                            return AFATFS_OPERATION_SUCCESS;
+                        } else {
+
+                            opState->candidateStart = roundUpTo(opState->candidateEnd + 1, fatEntriesPerSector);
+                            opState->phase = AFATFS_FREE_SPACE_SEARCH_PHASE_FIND_HOLE;
+                        }
+                    break;
+
+                    case AFATFS_FIND_CLUSTER_FATAL:
+
+                        return AFATFS_OPERATION_FAILURE;
+
+                    case AFATFS_FIND_CLUSTER_IN_PROGRESS:
+                        return AFATFS_OPERATION_IN_PROGRESS;
+                }
+            break;
+        }
+    }
+}
+
+static void afatfs_freeFileCreated(afatfsFile_t *file)
+{
+    if (file) {
+
+        if (file->logicalSize > 0) {
+
+            afatfs.initPhase = AFATFS_INITIALIZATION_FREEFILE_LAST + 1;
+        } else {
+
+            afatfs_findLargestContiguousFreeBlockBegin();
+            afatfs.initPhase = AFATFS_INITIALIZATION_FREEFILE_FAT_SEARCH;
+        }
+    } else {
+
+        afatfs.lastError = AFATFS_ERROR_GENERIC;
+        afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_FATAL;
+    }
+}
+# 3410 "./src/main/io/asyncfatfs/asyncfatfs.c"
+static void afatfs_initContinue(void)
+{
+
+    afatfsOperationStatus_e status;
+
+
+    uint8_t *sector;
+
+    doMore:
+
+    switch (afatfs.initPhase) {
+        case AFATFS_INITIALIZATION_READ_MBR:
+            if (afatfs_cacheSector(0, &sector, 1 | 8, 0) == AFATFS_OPERATION_SUCCESS) {
+                if (afatfs_parseMBR(sector)) {
+                    afatfs.initPhase = AFATFS_INITIALIZATION_READ_VOLUME_ID;
+                    goto doMore;
+                } else {
+                    afatfs.lastError = AFATFS_ERROR_BAD_MBR;
+                    afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_FATAL;
+                }
+            }
+        break;
+        case AFATFS_INITIALIZATION_READ_VOLUME_ID:
+            if (afatfs_cacheSector(afatfs.partitionStartSector, &sector, 1 | 8, 0) == AFATFS_OPERATION_SUCCESS) {
+                if (afatfs_parseVolumeID(sector)) {
+
+                    afatfs_chdir(
+# 3436 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                ((void *)0)
+# 3436 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                    );
+
+                    afatfs.initPhase++;
+                } else {
+                    afatfs.lastError = AFATFS_ERROR_BAD_FILESYSTEM_HEADER;
+                    afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_FATAL;
+                }
+            }
+        break;
+
+
+        case AFATFS_INITIALIZATION_FREEFILE_CREATE:
+            afatfs.initPhase = AFATFS_INITIALIZATION_FREEFILE_CREATING;
+
+            afatfs_createFile(&afatfs.freeFile, "FREESPAC.E", 0x04 | 0x01,
+                16 | 32, afatfs_freeFileCreated);
+        break;
+        case AFATFS_INITIALIZATION_FREEFILE_CREATING:
+            afatfs_fileOperationContinue(&afatfs.freeFile);
+        break;
+        case AFATFS_INITIALIZATION_FREEFILE_FAT_SEARCH:
+            if (afatfs_findLargestContiguousFreeBlockContinue() == AFATFS_OPERATION_SUCCESS) {
+
+                afatfs.initPhase = AFATFS_INITIALIZATION_FREEFILE_SAVE_DIR_ENTRY;
+
+                if (afatfs.initState.freeSpaceSearch.bestGapLength > 100 + 1) {
+                    afatfs.initState.freeSpaceSearch.bestGapLength -= 100;
+
+
+
+
+                    afatfs.initState.freeSpaceSearch.bestGapLength = ((afatfs.initState.freeSpaceSearch.bestGapLength - 1) & ~(afatfs_fatEntriesPerSector() - 1)) + 1;
+
+
+                    if (afatfs.initState.freeSpaceSearch.bestGapLength > afatfs_fatEntriesPerSector()) {
+                        uint32_t startCluster = afatfs.initState.freeSpaceSearch.bestGapStart;
+
+                        uint32_t endCluster = afatfs.initState.freeSpaceSearch.bestGapStart + afatfs.initState.freeSpaceSearch.bestGapLength;
+
+                        afatfs_assert(endCluster < afatfs.numClusters + 2);
+
+                        afatfs.initState.freeSpaceFAT.startCluster = startCluster;
+                        afatfs.initState.freeSpaceFAT.endCluster = endCluster;
+
+                        afatfs.freeFile.firstCluster = startCluster;
+
+                        afatfs.freeFile.logicalSize = afatfs.initState.freeSpaceSearch.bestGapLength * afatfs_clusterSize();
+                        afatfs.freeFile.physicalSize = afatfs.freeFile.logicalSize;
+
+
+                        afatfs.initPhase = AFATFS_INITIALIZATION_FREEFILE_UPDATE_FAT;
+                    }
+                }
+
+                goto doMore;
+            }
+        break;
+        case AFATFS_INITIALIZATION_FREEFILE_UPDATE_FAT:
+            status = afatfs_FATFillWithPattern(AFATFS_FAT_PATTERN_TERMINATED_CHAIN, &afatfs.initState.freeSpaceFAT.startCluster, afatfs.initState.freeSpaceFAT.endCluster);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                afatfs.initPhase = AFATFS_INITIALIZATION_FREEFILE_SAVE_DIR_ENTRY;
+
+                goto doMore;
+            } else if (status == AFATFS_OPERATION_FAILURE) {
+                afatfs.lastError = AFATFS_ERROR_GENERIC;
+                afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_FATAL;
+            }
+        break;
+        case AFATFS_INITIALIZATION_FREEFILE_SAVE_DIR_ENTRY:
+            status = afatfs_saveDirectoryEntry(&afatfs.freeFile, AFATFS_SAVE_DIRECTORY_NORMAL);
+
+            if (status == AFATFS_OPERATION_SUCCESS) {
+                afatfs.initPhase++;
+                goto doMore;
+            } else if (status == AFATFS_OPERATION_FAILURE) {
+                afatfs.lastError = AFATFS_ERROR_GENERIC;
+                afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_FATAL;
+            }
+        break;
+# 3530 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        case AFATFS_INITIALIZATION_DONE:
+            afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_READY;
+        break;
+    }
+}
+
+
+
+
+
+void afatfs_poll(void)
+{
+
+    if (sdcard_poll()) {
+        afatfs_flush();
+
+        switch (afatfs.filesystemState) {
+            case AFATFS_FILESYSTEM_STATE_INITIALIZATION:
+                afatfs_initContinue();
+            break;
+            case AFATFS_FILESYSTEM_STATE_READY:
+                afatfs_fileOperationsPoll();
+            break;
+            default:
+                ;
+        }
+    }
+}
+# 3603 "./src/main/io/asyncfatfs/asyncfatfs.c"
+afatfsFilesystemState_e afatfs_getFilesystemState(void)
+{
+    return afatfs.filesystemState;
+}
+
+afatfsError_e afatfs_getLastError(void)
+{
+    return afatfs.lastError;
+}
+
+void afatfs_init(void)
+{
+
+
+
+    afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_INITIALIZATION;
+    afatfs.initPhase = AFATFS_INITIALIZATION_READ_MBR;
+    afatfs.lastClusterAllocated = 2;
+
+
+
+
+}
+
+
+
+
+
+
+
+# 3632 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+_Bool 
+# 3632 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    afatfs_destroy(
+# 3632 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                   _Bool 
+# 3632 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                        dirty)
+{
+
+    if (!dirty && afatfs.filesystemState == AFATFS_FILESYSTEM_STATE_READY) {
+        int openFileCount = 0;
+
+        for (int i = 0; i < 3; i++) {
+            if (afatfs.openFiles[i].type != AFATFS_FILE_TYPE_NONE) {
+                afatfs_fclose(&afatfs.openFiles[i], 
+# 3640 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                   ((void *)0)
+# 3640 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                       );
+
+                openFileCount++;
+            }
+        }
+# 3654 "./src/main/io/asyncfatfs/asyncfatfs.c"
+        if (afatfs.freeFile.type != AFATFS_FILE_TYPE_NONE) {
+            afatfs_fclose(&afatfs.freeFile, 
+# 3655 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                           ((void *)0)
+# 3655 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                               );
+            openFileCount++;
+        }
+
+
+        if (afatfs.currentDirectory.type != AFATFS_FILE_TYPE_NONE) {
+            afatfs_fclose(&afatfs.currentDirectory, 
+# 3661 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                                                   ((void *)0)
+# 3661 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                                                       );
+            openFileCount++;
+        }
+
+        afatfs_poll();
+
+        if (!afatfs_flush()) {
+            return 
+# 3668 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  0
+# 3668 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                       ;
+        }
+
+        if (afatfs.cacheFlushInProgress) {
+            return 
+# 3672 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  0
+# 3672 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                       ;
+        }
+
+        if (openFileCount > 0) {
+            return 
+# 3676 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+                  0
+# 3676 "./src/main/io/asyncfatfs/asyncfatfs.c"
+                       ;
+        }
+# 3687 "./src/main/io/asyncfatfs/asyncfatfs.c"
+    }
+
+
+    memset(&afatfs, 0, sizeof(afatfs));
+
+    return 
+# 3692 "./src/main/io/asyncfatfs/asyncfatfs.c" 3 4
+          1
+# 3692 "./src/main/io/asyncfatfs/asyncfatfs.c"
+              ;
+}
+
+
+
+
+uint32_t afatfs_getFreeBufferSpace(void)
+{
+    uint32_t result = 0;
+    for (int i = 0; i < 10; i++) {
+        if (!afatfs.cacheDescriptor[i].locked && (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_EMPTY || afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_IN_SYNC)) {
+            result += 512;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,3911 @@
+	.file	"asyncfatfs.c"
+	.section	.gnu.lto_.profile.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375 \030\301"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\013"
+	.string	"\037"
+	.string	"#"
+	.string	""
+	.string	"&"
+	.string	"("
+	.string	"6"
+	.string	""
+	.string	"B"
+	.string	"D"
+	.text
+	.section	.gnu.lto_.icf.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\375\f\r/"
+	.string	"6\265\311J\200VVc\200\246\355V\214\212\213\300\0069\317\327\220"
+	.string	"< Q^\026Ln\202\236@.q'\222C#\002\227s\024\333\345\034\305v9\246\372\017@\001\005\024P\300f\177T\255\252\332\377;lX[\267\277\277\377\357\357/ed\013\247"
+	.string	"\266"
+	.string	"\273"
+	.string	";\025Jj_@\215\325F\024uw\013\354b&\331\370\301\353/j\312\365l\003\274x\370\304}\"|"
+	.string	"Y\337l#P\246\240\276\367o\360\3530x\341\203\317\360]\016?\337\270{\263B\203\321{\377\256\257\216\n\005\0218^{^{6\347\322\023\026\330.\201JZF\316\035\373s\202\322@Z\367\335\375\337\327V\252\326\314\242\333o{\255\273k\216u)m\336y\276\375\036\357\302\265\231\202J\232\336\255\354~\336]\177\367\365\373\272\037\330'J\200\235\275'\304$\326\224\367\363\177\375?\347\336\323M\231n\225\345D\344~k\001V\2524\231g#\251b\223\232\201\237uPopd2\260vn\231=\305$s\3368\317\307\371\315\033l)\315\243'0\007\376\210\351 B\346vgh1\\\034\331\266\312\r\036n\306\034\233E}Jz\261y\315\266\261yMLo*\3665\025\303\271\254J\215G"
+	.string	"\232w\005\243^\371*\356\373\362\fM\234i>\363\036\237\250\t*1?\037s\204\325I\372\342\b"
+	.ascii	"\031\241\256F\307\246\303\370D\2318\226y\314\227\231Z%\235!\354"
+	.ascii	"\320#\213r\022\n\346g\244{\364\214[sA\036\ts\030\344\221\271"
+	.ascii	"\246\367d\333b\005>~k(\2421!\357\376\213\361\345\361\363]\002"
+	.ascii	"\t\226\304\244\213\346\234n!P^9\\\352\035\375\235\257\313`|\375"
+	.ascii	"\345\3653\223\356\315\212+z\240\230\217\322\312\242\006\362\225"
+	.ascii	"W\016\270\313\335\335\004k\310\315\347\370\343\312c\342\266\344"
+	.ascii	",0\324B`\223\226\030C=\031'\346\205\355\310AE \033w-\200\210"
+	.ascii	"\236x\376\033X\242\242;\3275\2068i\262t\201\256L\241\312\255"
+	.ascii	"Y\230\240\245\036\003r-\320\017#*t\200\272.\253, 9\354\210\253"
+	.ascii	"+0\001\271\337\017R\0303\031o!8%W8:O\306Y'\3161\217\312\205V"
+	.ascii	"\224\233\367]\221\324\210#a\263sN<|Q\227\202\372\203\243\346"
+	.ascii	"\375\233\314\321\361\316\271\200'\370\221\235\005\271\375\226"
+	.ascii	"\335q\345e\024b\337\327\3561\260\347\032\210\375\274\346-O\032"
+	.ascii	"M\037\276\337\252I\246<\3444\037\325%\035\\(HFg\034\330\037X"
+	.ascii	"Nj\033\340^Q\217\2508\r\277\"REP\031\266.l\272%\212\001>\321"
+	.ascii	"\347>\327\327/pM\n\211\352\002\013\325\226\304\264\260?,p\375"
+	.ascii	"\236\367\234\335\314#Rh\205u\311\031\226 \n\367\005\331\302\222"
+	.ascii	"N\370\n\225\301\f\222\220"
+	.string	"s6\276l\360\261x\301\224\024!\347R\275\314\226 \304'\356\265\352dH\334\003\236\027}D\252iC\016\340\023pw\220\264\254$\rxX\275\342h\206\031\203\277\b\206\027\212\005\337\\\\mM\005\356\372\363\244\005\027\201v\250\361\261`D\306D\223$i3\301\004\3149'\235Y\007\021\360\244r\224\315\214HR\220\324\311\260\0069\254\214b1\270\n\177hA\360B\202\306\232\245\270\362>Kh_\327j\323\203\272\247\005\350\226\027+\276\2466?\377\036\352\2618\232\261\002\357\315\366\253\362\245z\236\360\271n+w\021C\001\2502\302|\272\036!8D=\327\322\233v(\026\211\234\362\277S\373X\277\266/\bk\357Si/8J\001|02\006e\330c\362\312\305o9\\\276\361\262\327p\037\303\301K:\270\323<l\223maN{\350F\207\352\244\221#4\200x8t\316\353\3108\272\3633fD\006\037\264"
+	.string	"\337\020\223&r\251.%`\250:U\0234r\336\216\241\227W\364=u\222qoN\027\320\2051\203'Z\265\343 \nc\264\336\\\007\355\b\2718\221\264T\327\243V\246\355\237\277~\007;\215\327~M2]\340*\007\321\f\327\232r\354x\356\320qE?\246\311U|*\025\250B?\bT\374F\303x\024/\020\374\313\303qU\001B_C\337R\205\004\177?\237nv\217\206\321\252\237\263\355\007\323^\347j\250\370v"
+	.string	"H(\021\357ry"
+	.string	"%C"
+	.string	"a\250\021\212\356\252\"\004R\261U\233\023z0\020\035W\236y\002\333\2143\316\024\276=d\226j]\236\013\373\361\3636+\303\257\024\332\335\300\323\231\271P\325\213D\350|K\332*n\007\304\001\222\217\263\261Z\f\335Y\203A\177\013)\221\220\370;>\340\026l\221n\027\333\324+\331\351\270\335_\376S4\364\361D<\311\310\303Q;&&c\346\305?\027\232\007\256\tK\\\3106\360\013\333\260/\321\377:\272\266j\206o\035\353\266\272\224\271m\373\2429M\03009\027\332fT[\205R\361H\256\020\f\366L\030%a\362\337\301g'\234b\232\026\230\333?\271h=\006\226\370\377\024`|@"
+	.ascii	"\f1#\2710\245\314F\021\205\3765\360\345c~d\207\366\300.\255\251"
+	.ascii	"6?gKu0\177\353\370?l\335w\261J\035\303\246STdr\326\017i\322\325"
+	.ascii	"\033\375c\265-\273\315i\312q\302H\251\037Q\234_w\213\020rK\214"
+	.ascii	"\203\206g7\r\362\333\2568i\267S|\370\016^\263\370\265e]m\242"
+	.ascii	" \017\314\240\313k\375ve]\255s\224\222P\026\331f\3531\273\357"
+	.ascii	"\221\236u\200}\314s\261\211\351\341\301k\226w\322\223\225\r\270"
+	.ascii	"\324sfVAPua}\276\231?\271\023\bz%\036=jb\227A\345\344\317Y\330"
+	.ascii	"l\316\031%\204\205ZH\216\200\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\031\006\r\023"
+	.string	"fU<+\300TU\206\0030\333\246(\212\242(\212\242\230G+\201D@\332\n"
+	.string	""
+	.string	"D \223$\211\223\330q\022\303\314(\022\022\220\266\245L2+"
+	.string	"/"
+	.string	"1"
+	.string	"\026\257\202\3332\361\255\326.\354\260[\032\255\352\265\256\274)\2664\223\303I\375z\257kZz\245Do\362~\255\307\355\262\0174\212%\227\220\220\217\210\034\302A\370\307;1[\r\265\255PKY\265=:(*\272\372L\351\341sd6\314\033\274h\274f\274n%\306\367b\273\325;\023\317\373\316\356\312\221\266\261\017\272\r\206\037:\270\301%\003\216\013:\005\\\227 \222\252\227\304\"\270=0m\240"
+	.string	"I\340r\363\200\273\200\005\340Z"
+	.string	"\177\353J\200\036\211nD'\"D\007\242\177\360@m\234\3550\007nX\3034i\206\207a\273\360,\254\255\3028\205WN\330$P\333/F\230*\020\336gZ\250\013\200\273\250q\275t5IRh\rp\202\031*\252z\022"
+	.string	"\344LI\305\214\025\225T\262\377u#\310"
+	.string	"L$\264\240du\347\272\350\272<\251Q\304\013\315\203[5g\225\334\304,\300\371\274\332f\352\242\r\220\023H\356\373\200E\b7\022\020e\033\036PAc\340\331\2500\364\r\365\376\340\002u:\240\202\311\217\365\030@\223\207\327\306\254k\bl\247\261\005W\260\t\375&K\222\306\201\032|_R\2124\023l\024\232\233\031\324\024\302\353\354(T\030\261@y\227\200\366\3376\026\210:S\032\020\247"
+	.string	"<\245W\305L\0029(N\373\344\211\226\332\232\n\372\f{\030\323<\335\357\332\t]'\024j\034"
+	.ascii	"U)\244E\237t\226\353\302\330\3420\371\242X\301\022q`\2030\327"
+	.ascii	"\262\235Z\272r\310H\332\215\207\343\345\235\003\263;\310\025"
+	.ascii	"a\350\243A\263\261\241\034\337\337@\254@4R\27586>\300\214\332"
+	.ascii	"\023r\261\2026\202Z\"^\201\235\"\303\177\330\004\212\340\232"
+	.ascii	"\3317\f\220.W\357\313\002\316\211\026\376!O\332Z\025\363S\252"
+	.ascii	"\315=MW\005\035\327\311\001B\304\267#\377-\036\372p\343\3560"
+	.ascii	"\370\021\355\355\366P\200!%_&\211\373s\341\347 Y\006\312\211"
+	.ascii	"\0212U\007\226\241j*;\246\002i\314\013\3429[\226\336\336\024"
+	.ascii	"\257\377\266\177\226B\321\020\270\212\036"
+	.text
+	.section	.gnu.lto_.inline.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\360+\215\226"
+	.ascii	"J\260\204%P0\220RI\007\035\360\213\346^\320\n\221/\370x\037w"
+	.ascii	"\223v-~0V\n%\346\310#i\230\307\276W\327k\303\340}|w_\220X\003"
+	.ascii	"\242\326\212W\027\006\016\016\206d\266\247\033\342W\325O\325"
+	.ascii	"\305\235\232\023\255,\307\t\215\212\325\335H\333[\312\024 \002"
+	.ascii	"8\002R\002\214GY\215i\364\321\3133\017\032\250\345\325\224\200"
+	.ascii	"\305\371\255y\nEqN\377\347\317\241>\202F.\311\360\365\276^#%"
+	.ascii	"bN\013\b\234\367}\337\"M\362\263\322\241\362\325\361\324'\236"
+	.ascii	"\367\304\241z\342\211E*{\242\275'\356\240R\262\352\246\232VY"
+	.ascii	"]\301\262\267\346\245[\"rC\275\275'\242NPT\232\244h\253#\\o\302"
+	.ascii	"&RE\030a1\f\3526+\365Ay\215\231\221\244\312\2406:\247q\214>j"
+	.ascii	"6\343\317h$\377\fT\306h\243\316\321\3333s\270\337\320{\"\272"
+	.ascii	"\323\317\301\242n_selu\002\375!\r\231\230\313]\330B\202\224\035"
+	.ascii	"Qo\237\314\230!3\251\224\274;\247\233D\357\017\256\304\223%@"
+	.ascii	"\320\200\342\345\177\242\306!\242[\367^\373\340o\177\034\256"
+	.ascii	"CT\357\006\202\301\271\2755v\017{P\177\303\233/\366\332\017W"
+	.ascii	"H\025R\376'tW\037\023'?\301\3770\232\2510\214>b\244#%\2146jz"
+	.ascii	">\241\307\374\274\374\001\275\366\377!e\241\250\013E\325\377"
+	.ascii	"<e=QS\321\253\303\333Q*\177\036\375\325F\327\344\202\376\257"
+	.ascii	"\321|>\367h\031\224\260\001\036p\312w\004\032%Vv\031\351\236"
+	.ascii	"\001k\333\302\201\001Hgx\357M\350\233D\363<\267L\312\264\344"
+	.ascii	"I\214\320\264$\\\376\2166\242\327D)XK\240S\230\330l1\224\225"
+	.ascii	"\ra*\372\336b;\2559\263\332\271\260\371^\035\366\274=\217-v\357"
+	.ascii	"\005\340m\317!z{L\006\337\226x\337\266\230\344\237\367\310N\273"
+	.ascii	"\367\006\337\347}\033\271\374\217}\357\275\275\342\215G\037t"
+	.ascii	"\351\203.\243\251\267\350\203\232e\364h\3411\232/\243\331\352"
+	.ascii	"\210\247\260\030=\2431\237\361\214^\341<\201\201\201\247\321"
+	.ascii	"8h4R\367\240\017d\244\252rF\373`3\236\301\2276#I\2253\372\210"
+	.ascii	"s`\n\332\350\027\201\326\313HO%\005}t\2373\217\216{\373\241\207"
+	.ascii	"\263\275\373\215l\274{\223\366\347A\001\351\200\264y\321?\027"
+	.ascii	"5\030\230Z`\212\037\204/\240\027@eQR\347\002\034K\250\352\344"
+	.ascii	"\214\317\207\222{`\233\006\212\0315>\37797\024\"O](\376\242v"
+	.ascii	"\222\022"
+	.string	"\346\253\250\275\352\326\300\336\303M\274\236C\037z\237\017}\212\232I\230\266)\234|\017}\214\235F\213\213\006\341\221o\016\3017\337\035\246$Y\332\220\035\373\033\315Z\370F\373X\201\0056\345\r\273$H\312\336g\226\260\347\020\255Jb\345\211\215\355$M\026!\364\330gws^*Q\273\345\2311\333\031\342\234'h~\247\321\222\221\210\224\026\364\321+\233%_x)\036\300y'(d\214\020u\001\374Et\207)kw$4\035\273\202\032\342l\367\271P\024\363\224,\024e\236u^\355I\324Y^\226\004Q\361j-QE\201ze}I\005\021\335@Md\353\035\201R3{4\327\030\227\252\023\347\373\242~\222b\0026<\361G\272dw\241\004\351\233\024\023\035\354\217B\357\225I\222%G\316\177bs\034\267\321\n\377\021X\022\233\005\025\272\212\2203-_c\366$\323\340\215!k\200\366\326\232 z-L"
+	.string	"\230\336\330}\363\310>\366\222\335\225R\253\362\272\304d]Y\215AP\203\177\005\270F\037\235\306\311\335@\347\200I\242\322\277\310\374\255\\#\301"
+	.ascii	"p\244i\367.\005\275<\271\232\253\302\023\177\242\231\210\205"
+	.ascii	"O\264\321;(OL]\301\355\365\234\347?\262\366\335\251\377\220x"
+	.ascii	"k\244k\310\314\231\241D\346\034\232<.\276i\336\234/\034\333\370"
+	.ascii	"Ti\243\215\036\\*\363\372\363\271\316\177\244\357\232V\177\322"
+	.ascii	"\007\361\370\360\364\277N\375\315W\263H\207\334\221\235\251M"
+	.ascii	"^k\374\204\357\256\305"
+	.string	"\016s\322\302\343\023\217$\022u\036\231*\\x\376\036\235E)\013\013\004\3419\215^\20276z\311@%\247QNc\336\201\257\260\r@v\301\247\314.J\033\355\343\345T\235\227\270\253=\207_\253}\265&\330w\265%\274x}\241\203\002\2625\021\243\357\372\202_\317\327\323\204\255~\345\373Z4\337\365]\207\332\2070-+\212\354*\037\210<\001\235H\374\361\017\377W\320\314@\312\n\332\210\037|e\372\225x\265|i\021\253?\357\317\275i\336%\341Q\274s47\221\036\331\261\006\255\302\231R\203fa\b\316\321>\266p\216VaL\231\243\215\232\307\t\r}y0\376\342\177#\251\003\037C\267$e\337\200\016\025\235\233\342\306\031\372\303#\333\007\2642&\345\355\215\355\265\206\314\034\220F\222\244\206\254\037\373\367\211)\364\223\2525E\b8\003,\024E)u\"\342\255\315:Q\"\204U\213&\267/T-\276"
+	.ascii	"?M\201\013E\345\320 1\234\221I@\0062Jm'\236\200\316\037\026\276"
+	.ascii	"3\234\"zM\230\206\315N\200\177jz\216\300\221\025G3\227)q\364"
+	.ascii	"\021\367\315]\330\360\305\252\254\006Y;\223\345\206\036Z\027"
+	.ascii	"\02699\2713\2570+w\263\007X?\273C\217\246\213a\n\240\211(F(\211"
+	.ascii	"R#\005:%\256K\230\214\332\242Z\256#\2108\302Fj\345D\r\257\001"
+	.ascii	"\235\254P!\241\203z\251\241\313\034\347\240\364\244\315\204\261"
+	.ascii	"\355\206\270+\32375$\367\356\026\260,.\024U\213\374\276\346\020"
+	.ascii	"\005\363GF\206\355\352\312(U$u\252\022Xu\203\354\261>.~\302W"
+	.ascii	"\242\325\275I\"M;u\316lBI\242\217\330\266\031\002L\324\317\r"
+	.ascii	"\340\017i\363\007`\302a fJ\226\002\b\033b\225\205\324\227\032"
+	.ascii	"sF\314\375l\001|\272\023\334\30179\355\346P#\221\262\305\326"
+	.ascii	"\357\363}\016q\t\337\247y\337\247\016:\307D\353\212\211\350\224"
+	.ascii	"\030\234^\004\267\326\276\255\255\367\326Xo\321\354\201\211\273"
+	.ascii	"y\255\374\332\367\025I\277\362\300\206\025\205\026\217\244`k"
+	.ascii	"mu\366\304>\341?\324[\250\320\324\370\247\356\0314kp\326Q\006"
+	.ascii	"\2021\220\243H\374\003M\211A\037\035\347\\D\335\324\200\2149"
+	.ascii	"[%\340E\254z\313t\311\223\253+|/\337\243*Th\340\"\361\001\376"
+	.ascii	"Z\177\322{V~\267N5ol5]}y\225G\207\341\213\372\373\001\3542\002"
+	.ascii	"\347\302\005\315$\232\325\224\027\264\021\3233\nt\r\020+\312"
+	.ascii	"\367\352\n\332\217\272\n\212\007d\253X\033\233\322\321-Q\r\215"
+	.ascii	"\234\274\222\2560V|\236\342BQG\301Se\034\024\025\233\027\372"
+	.ascii	"Tg\302l\375\355'\314[\351,\007\357#\264\364\266\374\364\257\226"
+	.ascii	"\336\026\236\207\300\265\362h\272\261\344\027\0315yt\276\200"
+	.ascii	"\310Y\0218\b\016\202\320\007\036<)-\310\025\334\336\360\035p"
+	.ascii	"\360\332\033\\\341J2P\231c\247\036\341\202]\314\264\246\026E"
+	.ascii	"\305s\034\325\032\335\206\222\204/\316c9\374YX$\353I\30550\211"
+	.ascii	"'\223\032\254=\026\302\366\240\031\f3\037w\320+0'\3011\243\221"
+	.ascii	"\372\264\004\003\225\035\264\017\016\206\031bv\347\342\030$i"
+	.ascii	"V\231\227\232\233_\360\340\221\222M\021b\346\n\017me&\013\301"
+	.ascii	"R\244\230L\374\206\022\232/-b\303[\300\177\260\251$\273L8pY\277"
+	.ascii	"NI\337\026\007\261D<\267{\2238\267a\236L\354z"
+	.ascii	"\357y\213\264\321%\261x\327\363\232\367\002\271\261e\260R\376"
+	.ascii	"\321\246\371G\033\346\037m\312\234\244\221#~\b\274\202\337\376"
+	.ascii	"\310\276\362#\342V\366\321\300\220h\355\274F\261\213$\025aF\177"
+	.ascii	"\356P\233\246\rCSSk'\373\013\237\223;F8D\354\020\345\251\347"
+	.ascii	"4\230KW^S\033i\22748\310P\036\b\3002\274\240\275\305\246\352"
+	.ascii	"2\345\205i\bXR\275\264K\314\n\037#+\336o\316\212\370\253\353"
+	.ascii	"\371\214\013E\325\2616\272$\234\313\240\340?\037\271*\262\377"
+	.ascii	"\250\320p\270\371yr\265i\326,Wp]z>\301{\307\026\2312J^\227\230"
+	.ascii	"\036&'-\273\025B66f\242\265\245\312\201\307\270PT\3474\237v\230"
+	.ascii	"\221-0,\224jX\003\326d3\330\231-q\021\006H\3009/\240\212\276"
+	.ascii	"\036)\340\323\017M\302\242.\343\252\222\226\001\337\316\3623"
+	.ascii	"\233\301\306\203v\320\267+C\256Ta\211\373\nR\257"
+	.string	"/oOr\354\330\\)\365\224\0344\363\035o\320G<\374#L\271\301\030\237T\016\004\034F5\203F\276'\215\200m=\267\260\360\241Q,\\\320\270\361\255\0213|\271\241\304\211\311\362\310(\b&Q\005J\322\337\212C\220D\213I\363\342\320\272{\257\211?P\211\025K\360\330kh\332\210\320Z\353\261\326z\221M\245\016K\352\246\273\310|\033\253\252\212\226\356k\244_[J\322\350ip\031\262c\200\222\203\0132\r.+\322\2606(S|+\302\275\255D\021\210\304\035\335\227\225\264\353\020\356\020\365c\n\204k\250\343\306\223\224$I\314X\215$I\222\016\363\022@\360\250 \032\223\212\346\364\361\003\023\300S\211\263\260P\rB\247\020\"##\"\"\242 II\ni\f)\324k\255\30446\373l\033\253\235z\334\036\272\213\235\264T\257\f\340|\250z\024\n1xF.3\032\224\3151\275\300\312\035\177-\r"
+	.string	";\006\371\234\207\233\202#\\H\207\013\262d\003f\361zUt\201\347\310i\023)"
+	.string	"E\004\341\367\f\224\r\315HR;wc\217+jq`A\356\335\303\205\217$\315\312\270=\213\nf\351\2760?\306Y\311\323\311\\^q\304\215`L\016\264\246<\247\310\200\002#\017\037\253\3742v\302\003\345,\310\263\367\334\256b\254\377\005;\312\322\345\204\235\343\006{@N\361\242\257\2453\217\255\345G\260\243o\367\230\234@)\370\260F\236\204YYH\324\377\321|\224=\206fr\373\271\020\237i\236\351\023\222\216UZ\320\245\347\013'\244\255[\377X:\244\306\254\306\301\20740\344t\311\035\316L\245mN\227\305o\rN\255@\242J\365\252\321y\223\024\021b\240\257(\001pt\363\177"
+	.string	";G,\214\231\273\322Z\027\336\020%\200\354}8\377\364|\343O\364\342 \271\037\236(5\356\306\265B\315\264\034t\206\315\242\202\340\1779\374I_\230\203\366\240\323{\213\213j\277\025(\\\260\266s\227\2622\2625v\002N\217$\217"
+	.string	"\216\362\035@\037s\306G\b|\225\312A\256\031\220Sj\213o\307\301k@\330\345J\320\364\316 \n\332\\\330\375@\003\316Of\216\021\020\324\201\243 \017n\031G\341\237+\215\b\211aQ\211@\275!J\210^K\267~\340\023)2)\023\260\177.\220P\330;V\013o\f\304DF\004\257\320\311\\\231\310y\264oN\022\302s\264\233\032F'\026\025\225\212\330\303\212\331\034T\257JH\237\324eD\256\006\314\223\266\215:\260u\242|\017\200{\364P\364\306\236:&N.\37001\214\036\272s"
+	.ascii	"\373\210F\003\316\263z\360?\340\243\277C\211\rA\213\201\312)"
+	.ascii	"\fV\013B\214\277`\017%\003\274\231\261\252^a\026\233\353\216"
+	.ascii	"O&\246\233\236lo\320a\272XUH\264\215\023+P\221\270"
+	.string	".D\316JEi\335\273\374\262\205!\364-\371R\215\310\177\327\326\251\273\324\220)\262\375\306wZ\027\355\315s\222uw8a\354\340\276n\352\260O\302,\244VK{qT\226\232\241\337\264jj6\220\200\327\315\356J\001\005\002\241\005O\030g\273\025\272\356\341\177{\227d`\275\224\310\\\253\265%3:n\202\\\270e\3052K]\263\202\376O\321\353\230\353H\347A_\223^\262\244\371\001U^\344|\005\027\022\276\034\253\036+Pw1\223Q\tZ\340\365\232\321\244\244\313\005QX\320\317=\313 \bo+\320\355\213$_\267\255\360\325\037\370OJ\007@A\214!\230\327\250\310\357\210VT\211`\nV\311\347\026#\274\347p\027D\2128\367\315I\236t\353\273\200\2705\rz3\001\313\267=\214c\206\215mY\370&\222\017<4\001\224\"/\022\344m2\255E\327j\035\026\207\275\303Gy8\022MR\315gv"
+	.string	"\026\230v\b\013\331\201\347\2751\221U>\013k\033X\0247JM\237\021a~O\244+\246[\222\331\\\254w\005\220\204\255\213%\322\322y{\355\026\231\235|\201V\342\232\233\277#\352\026\300\326t\356|\002b\261\022`\370\347\030\324\336\274\211\203<\326\214\013\200^\255X\242\311\223\201\007a\223\016\003\223\363evb!\325\222\003\004\360!\036\264\006\t\204\317\217\303\220\322\323\346\246\r\200"
+	.string	"\246\243\214\274\021:\335\247\261\307\034\177\224\322\312\226!M\360\266[\346tl\302/1\013\301\274\024q\030v\223\177f\343\034\376\\qX\261L'\264\337~\233\366\024\2533\251\214Zpu\356\370+\265q\221\035\267\254\317\277\f\363\222\354\313ip\300\277\021\222\223wL'NuL\3121\374}\022\232\235\245Fb\362\336MrRb{\207\276\310\r\253\312$\313\362(9\230\244:(\t\004\222\243\005fb\031\334'G\200\017\230\373\2228Ud\374\220\203\272o\334\372\221(\357"
+	.string	"\233\265\261\300\"B\225S>\230\266\375\007\2765\330\215`\001\247z\224\na\367\024\017\276\200\250\022\345\215\336\211j+@7\307\323J\370\2235\366\307\006\033x\335\016\200\t\307\242A\b\034\337uZU\fN\315\300\016\213\370\333\231\312K\323\245;\250\235o\002\244}Yv\363\220\324M\203n\336\227\323\311<\241\245\204\210E*\2641L\212z\020\270\361\207[:\275WR\022\224\003LO\025\332\331\020\326\017\351\b\231\243'\377\274\262\005\371\030\030r\234j\253\272\303h\351\201\215\234\346\317.\241\352\032\001\237$\212\343\033aD\001j\206bSFv\272\2700\203kj_9?\020n\326\352\3526\006\233\313\316\337\345\274\363\361 \204.\001\032\212\363\365\0165\354\327\236E\231CnRzj\323c\3458\331@\332\203V\346\f\"\215\357\344\026\202\006\r\007\236W\267\016\b2\035t\205\310\0250"
+	.string	"c\366 \271\332\214\204&\034\322\321\210mV\235\312\240&g\264\245\247Zp\214K\204u\202\211\237\023="
+	.string	"1\005o\005\374\234\251\0078\242\311\271\225\013M\001\3508\271y@S6\223\353\314\247.\037+C\035[i\377\020\206;\3137\210{2\"Z\3130d\213\321\357\2415\254\300\372h\317\376\305/3!\022D\273\231\225F\336NbH(\bR-\201\346=\024a\225\026\326*7\205\r\301/\236ed3\306n0\035\005:`\374\354\322\234S\213'\365\250\2247y\230\234r\375:\223\255\322"
+	.ascii	"\262\205\016\325\302Y\243\272\242`\365:\354\226\303\250\356\024"
+	.ascii	"\300\302&\2173\216\\PA\005v_\003(\004\t\356z\\\f=\243\360\275"
+	.ascii	"\353\224:\373\312\210"
+	.string	"c\277\026\264\370FH\206\3610LY\370\227\013:_\264\221o\273\343,2\201\031\023\026O93\321\216\"\r\307H\240\2702\017\362\033\357g\027s\360\244\200;\260\263\221\201\342@\270/\333>\022\3466"
+	.string	"\277\277\035\303D\313\261\237#9\357\377\346\201\3326\203K\341\370J\335p\253=\262\037\317\250\277\313\213#\034\214;x\345\306\332U\035\272\272y\314\207W\005x\035\320%2Af\350\005k\032rd\205\264\224\344\004\232\035\210\231M\350\221\360\257\235\373B\034\225$\212\302\367\336\345k\2442k#P\334\377J_8?\220\246:\234\325u%\366,\020\3044\360g\b\314e\201.09\225%\300\277XK1\274>K}\211\215\337\264 \313o\274\245<mX\236E^\037\234b\317\004Q\372\306\374\256\026<\324\204\023=F\304!w\334IA&\332\245\245}\274\252^\032\037l\324_b\016\264\364T@\"\334\227\220y\262\366\217\3552\004+K\007<\244\343iU\267\241e)\031[G\314\306ecC\\\025\"\323e8W\253\362\211\263\262\005\261\311\027\261#\017;\204\334\272q\233X`\236\027\356\321\t"
+	.ascii	"4 \220;\220|\325\254\237R\243\214\357\336Y\226%\rZ\272\251\314"
+	.ascii	"\221]\252\023\034\243\024\233hl\347\240\266),\202\301\211\203"
+	.ascii	"mw\250\007\tQ\2065A\235\027\005\2347f\rHC\354c\271\022\327\301"
+	.ascii	"8\300!\360(}\327\256\002\326\032\340R\033E\203\016\320\216|\357"
+	.ascii	"\f\226\025\241\214[Y\321\240om\264u\\#\262L \007\326\026\"\306"
+	.ascii	"\231a\235x\023c\031\005\257\021\214\307\026\240\321\353L\331"
+	.ascii	"\200,*\030\315\f\f\227\336\371k\034j\b\016(de\2279\233\200\034"
+	.ascii	"\220\324\353\250e\016\023\356\202\"K\026\305b`\327D\032c\236"
+	.ascii	"\266\310=\327\367\361\001n0\233+Z\334\346\177\345/\205\327\351"
+	.ascii	"\214\267\377\026c'\030\031\214[\335n)SS\266\372T|\027\353z\234"
+	.ascii	"\003V(3\030\f\236\260\271\370\341#+\034\333I\241\242\311\201"
+	.ascii	"\204\227\322LQ\203t\r\003\215\352\256\250\274\314\366\314\274"
+	.ascii	"\220\214\225\"\335\234l\232\005\035\372\263\240\3118K\177\335"
+	.ascii	"l\261\275\260\374\375\272\"\"\030\271\223\226\206\0232,\367\006"
+	.ascii	"v\274?V[*\344\373M\177\223\004\034#\333\313\332\331\213\342\326"
+	.ascii	"h\327\221\202\363E(\344\235o\333\320\342dJ\boP\373\360\013U\001"
+	.ascii	"\357\320`h\t]<JT\024\026\363\221\272P\353\202\303T\204|\034E"
+	.ascii	"+\036\207-DgY\342\264\231\202\312\273\026,\037\206\276\335i\364"
+	.ascii	"\254\251\020\r\211g\246P+\357/\211\005W\3433v\373\020/*1\363"
+	.ascii	"1\342x\214}\021\254\273\356\345\2347=\330\277\261\203\006\020"
+	.ascii	"6V\256\003\237\220\215\272\023\315\254\353\361@a\023\264^\b\216"
+	.ascii	"bK\277\265uam\233\342i\365_\303es\364|\033r=s\226\332 \360\310"
+	.ascii	"}\271MC\f~Z\rw\364Xq\214\222\300\034\230\200ccz\301\353\024Q"
+	.ascii	"\245\321+\322&\327\311:\267)\335\\)\252+,\323Q\214\200\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\316\031\r5"
+	.string	"\326\363\240C\320\032\2471@\034`\007\b\200+/\203!\212\242\244S|\362"
+	.string	"\247\214R\\\266\247\034q\305L\r/\3606\314\3015ZPP\237\005\300\237\331\360\007\2776\242\250\201\242\213 \254,Q\330\2046I\"eJ){"
+	.string	"\216"
+	.string	"\223"
+	.ascii	"]\315\264\001\316\335\320\006\300\311\264f[\317\026\362\355|"
+	.ascii	"g\214\345R\2058~\177>\271w\306>\352\255\315\303\367\016[\207"
+	.ascii	"\215\016g\334\234\303\306\341\273\262\277\335'\354S\345\357t"
+	.ascii	"\332\332\231d[j\367\356|v\237Eo\217m\307h#m\033y\303\357sl\355"
+	.ascii	")C~\332^\025\357$\016\247\211\244M$\357\252\370\367}\237\243"
+	.ascii	"\217:\372p\273\371\300\276\320~?\241\335\242\316\264+\033\001"
+	.ascii	"\016\334\240\325\232\267\215\354\333\007}r\f\272\377\366\202"
+	.ascii	"\302\216\325\317\030\025H\326\335\335(\373\td\226\270\t\223V"
+	.ascii	"\305\304J\246\214\362\324H\234\304sR\327p\251^\315{r\303pI\306"
+	.ascii	"\363\206t\t\376\253C\033\301\2010\362\322\321@O'\327\211\374"
+	.ascii	"v\017\0058\002\255\205\370\233\227\344\325<)\345\201q\036\322"
+	.ascii	"\330\274O^\266q\300\254)\263$\312,y\247,\333\352\326\344=\346"
+	.ascii	"\306\262\343@3\223\262\255\0230\213\322.\037\216\365\311\002"
+	.ascii	"\262\rU\001\346bO\331d\251\024\221\315T\3143\305\322u\343\334"
+	.ascii	"\334g\205\316Q\216\363\351\212?;\254\013ZT\2361\244M\004v\333"
+	.ascii	"[\f\005\312\021\251\323\272\213\274\214Y\220 >\207r\332\nm_\355"
+	.ascii	"Q\026\337X\354+\266\025\357\340\324\213|\244\365\360m\2124\273"
+	.ascii	"\265\317\263w\255|\323\351R\350\364\214\261\t-\333\001\354\333"
+	.ascii	"\334d\226\224\246\232\326\234\311\225\004\216\343\"\304V\020"
+	.ascii	"Z"
+	.string	"\363\350)\344\377_\266yI\344Q(\327\334jEZ\244\335\370\210\346\2026\243\255\036\f\005\025z\005u0:!$db(\325\227\321\221\234TD\036\351\013\351\205\244\302\304\241\f*jK\264$\332\021%jE\204\330\001\321\335\275\211\331\260\241\326{\314\222\005ru\356\237\017A-\323\320\250T\250\330\247\216\207\016?\025\231\036\213\303\234\234R)\307\366\"\326@ho\207\264\277O\314\f\332\212\333\250\244V\246\207\301\324\373\341/\036\220\326\013\342\325\274!\345q\t\016q\313\341@\366\006\355\037\237\036\024\033l\316\327\240\305\225\201\303\260EN\317\310\366\3025\020\246s\310}\232\302\270\004\223=\201\343\250qQE3\"I\222\024\2461\341\004\204 \307 \204\350\001\022\3001I\ncQ\212\202\230\201\322\030\022\021\tDdDA\n\222$\255\001\017\004\240P\020;\006\350\310C\270w)7\312\255\304Yh\271\277\343b"
+	.string	"\217\320\344\265\306\003\203\210]\033j\324`b\223\315p\361\364\203\032\211oL\253\024\211m\205>\r\t\200$\270b\375\325\307\306\313\261\036\252\251\376\005\264\024\337R\300\222E\345\310\213:\2729\376\b\226\266i\311P z\004\215\"I\235;\267\224CG\263\234cL\227yHD\027Q4\027#[g\362g\323\367\204T\334yLC'\246\204j\351\3342C\214l\207\216\214z\2023L\006\337\315b\203\240\205}\024"
+	.ascii	"=`q~\341\t\267\367\237\345Z\344[\210W\253j1Y\272\177\302yM2\016"
+	.ascii	"\312Oz\357\264\301\266\345\344\343\243F\251\301\035\316\004\344"
+	.ascii	"YtQk#\2109T\b\t\236\033x\310;\357*\"\372/\342\220\261\023\354"
+	.ascii	"\0036\201`6\237C\355Cs\316\232\210p\002\036\372\3760\225\216"
+	.ascii	"\333\337\024\246\b\366\027:\253\036\036\251\334\007\265\344V"
+	.ascii	"\253\037\314\342D5c\276\004K\255\326\227\302D\214\005\212\255"
+	.ascii	"\205)\216\017\376\377\0374\003K\2451=_\312\275\212v\n\361\275"
+	.ascii	"\275`.\024\264H\266\2501\2168\321\241\367G\017!\320\001,\002"
+	.ascii	"La4\310o.\251\213U\322:\202\310i\314\240\177\263\267m\021j\320"
+	.ascii	"\004%\024\263#\336\370\276sd\264JB\313\235\214\2129x\361\246"
+	.ascii	"\203\232\204\222s\017(\314\345\336\231X\214\200\004!\206\025"
+	.ascii	"\027\350m\220\214\244\0366\230\fg\230\357f@b\351B@-\211\252\302"
+	.ascii	"\203\236\3032?~\350`7{\201\"\327\357f\016\360\300\250\025\342"
+	.ascii	"U\320\3674\240\005P"
+	.string	"\254\003\003@9\251%:\006\330\266y\216\337\242\375%\261C%5]\031\016\2479\036\0037\321'\366\244I'\317\270\202\250\022\261\367\355\322rd\037\337I@\\\213\033\020Wi\344\203\022\244(\344f\027R\204a\2637\322\327\265*H6\361\333\033\002\023,\357\3302L\023\020a[M,Y\227\345Q\304\024\312\302\375\274\226\027\027$Z\021\201\360\t W\376`Bt[\211~\013\251\2311LS\212\352\203G\306\n\274\274#6\315\324c~(\231\224\336\204I\333\301x(0\342d\227\024\300;\016)\200\356w\310\251Vd\001W\202\205\214\017\220\225\016\b\216\364)\333*\231yy6\311&\376\007\017\021Y\210c\036 z\346\300$E\254k\233\231\333\020\270\"f\366Qj\225\016\002C\r\231\214|\207FT_\006\243\332:\207[\rn\231\016\032J\243\r^C\234\364\223\341\026ks\220\024 u\360\r\221\020o"
+	.string	"\211w\251\307\371\322\226\027z\254j!\231\037\b\330\036\007\365Hr\245\2275Z\331\226\274\033\bLm\362+\261\237\224\356\257\304\223\225"
+	.string	"\244\030\333}\347I\326\337K\026\307\223\003\204q!\3728\367B\315\201%\260!M\027Z\240\334\035^\323J9\337\235\001\243\363O\016\025"
+	.string	"\364\2369L\234\314\355h\325w\351"
+	.string	"Y!\262'@\220$\311\002\241\315R\234;\237\274\321b\2436\224\"\335\352\3106y\321\376\223\3678\326nW-\330 ?<Ay\372t8H'T\212PS\026\214{\032X\304C\006\341\300\rE\264\313\246h\303\277\275"
+	.ascii	"\352E\243ty\351 (\345\250\0259\265MCT\356\362\265d\2219\n\260"
+	.ascii	"\024M{s&.\326\331J\363\362-\037\205\360\307\212m\201\217\017"
+	.ascii	"u\276\333\344\270FYMm\215x\314\024v\031GJ\264\220\375\275s\303"
+	.ascii	"\374\360\252\266\367\207\220\025hR\2629\235dY\324\036\242\fy"
+	.ascii	"\210\356\256\025\344=J\355\226\314\232\025\231\365\203\342a\357"
+	.ascii	">\215\214<\375X\020\021\264\220z\365\255\220/, ,\213C\277\013"
+	.ascii	"%\267\256?\353\005J\376\242\373g\004\037"
+	.text
+	.section	.gnu.lto_.pureconst.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375 \362\305\005"
+	.string	"\"\017-,0W\2061\300\300\300\300\300\240\032\030\030\340\304\003c\374\017\f\f\f\f\030\244)H\221\"E\212\024)R\244H\221\"E\212\250\204\230\035VJ\332IK\262B\262:\322\214\254\212\264\210\274!O\310\203< \357G\363\321z\274x\264\035O\307s\034\307o<\033\257q\032\237q\031\217q\030\177q\027oq\026\253\025M\305+\305\013E;\321L\274D#\361\021\027\361\020\007\361\017\367\360:<\016\337\3204\264\f\307\320.\334\302\253p\n\237p\t\217p\b\177p\007op\006oAS\320J\320B\360\0037\360\002'\360\001M@\013\320t"
+	.string	"\317\344Q'\212\242\226\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\260\020u1"
+	.string	"\246p\224D\300\032%\351\222!\n\242 \nh\033\023Fp]\263\235h$\002!"
+	.string	"\006\211 \210\222\262\177\204i\022\252a\031\360\347o\267!\036\210\315+\021\342\002\b+\354\207\3269\t\004\004@\202\222h\321\314\242F\344N\001q"
+	.string	"}"
+	.string	"\211"
+	.string	"\177<~f^\242'N]\231/"
+	.ascii	"9\324\367\336)T\245\304\204P\237[OE=\211\210\246Y\347\034\252"
+	.ascii	"\353\211ub\365\272\376\324\351\231\323\317\234S\250\271PO\254"
+	.ascii	"tg\220 =\203\340\371^[\347\3575\tH1\3541\347\030\226\360|YN\311"
+	.ascii	"-d\316\263l1\347\3278\275\376Q\327\255yP\363\267v\037\315\260"
+	.ascii	"\235\231\314\357\017\224\363<\341\017H\t+\243t\360:m\320s#A>"
+	.ascii	"\307#\355F\352\0304\027\234\231IQ\345\024\364\343{\233\252\256"
+	.ascii	"\345Sm\255\245\025i'R\227\tH\364\354j.\202of\216S\207jr\007\276"
+	.ascii	"\357u;)\3552\035=yD\037V\032\270@\273\264`\322\237[\373\n&\201"
+	.ascii	"\367\336\352+\346\200\2320\020\t\302\270\252\357\235r\257\234"
+	.ascii	"\226\243\371\220\2522,\231\242\226\002\204\364T\263\2543\032"
+	.ascii	"\337\361t\257\2327@=\313\336\231y\223\036 W\"U\2502@\275\311"
+	.ascii	"%2\237$\376\326{\247\265\371mB\253M\323\031\361\247\210\264b"
+	.ascii	"\006^a!\235.D\n\244\177 \376\360{x\247\303_\016L\221i\003\223"
+	.ascii	"\204}\207\211\323\360b2\270\334a\270\201\024(\021B\210\264\220"
+	.ascii	"\\I\335qI\335Jz]\b\252\353\251\205\257\220\257\257\twz+\243\226"
+	.ascii	"\244n$u\024r\302\022n\223\213p\341\314R\224\244\246\013\301\310"
+	.ascii	"\250\035\307\203\033L\260\n\227\230\001\277\237\367s\363\323"
+	.ascii	"C\004\352\033\033\3247<=lh\376\241\354\321RM\311\363g\321\r\""
+	.ascii	"\033E5rhl3\236&\246\214\030\330\216\312\301\310\260\027\277N"
+	.ascii	"\252\351\242\250E\2479\250"
+	.string	":.\026\257x\225\212U\231\363\016>i\212/t\322\252P\3748\367\304J\251\332\241%\"5A\fK\246\243w\245\t\024\031\215\005a\352\332\347\250Y\366\"\344\247a\364YE\355\2504\2517d\241\202\345\314R\024/g\016\345\005\264\333j\024@\370\005L^\323\2334\201\347\250\241\311*\222$I2\254\001\261\004\204 \006%\205{\022 D5I\203\320)3###)I\352\264\006\313\234\022\324\037\024b\023\r\314\376\224\377\335 2hI\"\335\336i\261\241-L]}A\347\2332\376<x\336wA\347\237d\262\347a\252\001\026\313T-\2123Vb\355\332\006\241\302\345\243\017X-8\336\2577QW\271l\324\222?Jmu\b\003\211\240\361V\205$\231]\226X\310\2039\333\371>\247\001\325H|\260\212Y\316Y\232\"\231\315\343EA3s\325Xg\201\214\202r\360T\fP_3\232H%\177\342f"
+	.string	"hd\313k\247q\337\2762\2769\0339\241\013\313\022\021 \343O\020\207\216\257\232\2533($d\332\232\250\223\026?\316\246R\2348\301\362\371\276\331~\264:m~\375h\330\322r\263\007\030\017\026q\232\243\260\236.Vq\303\302\032/%\007\267\242\\\2205\340\246\202\026\005\303\205\007>\344\204\300Z\323\364(\340\221#\305\362\324\251\377\232=\320Kj\322\267\375\002\255\215S\022\006\372\004\331\223\312@\002H\236\234;`\343\236\201\333)&\253\212\267C\215P\006\fAV\242)\270oo3H\374\276d3nx,rfk\343\266\352n}\356\330\233C\267\314P\243\316\252\323\343p\236gF\247\027\367.RqHO=\323\203w\304\020\325m\300\240#@\003R|1\366\220\re\223\t\214\350\364a \270\350_O\332\"\333\374\274\335\353\3402>$\236+\301\005\276d\032"
+	.string	"\363\221\037Y\221Q\205\364J\217\300\030\201\255\346r\221?$\371\332\340,:k\203\310 /V\223u\215\307\320\260\265\306t\240C\032.\240\274\003\3658\263>N\322\\u%\003"
+	.string	"\361"
+	.string	"\343\211o\203\024\204 \"\320\260\t\313\203K\"S\320\020\304b\013aiL\243-\nP\343\026\262\231\226\253\266+X\312'\207\024\231\025\266\345m\351@\202Z^\256\177\245\034L\275\212\224\300\233\263\331xS\244\026\235t\310y\207\351\036\201\223F\260K\202^{\327m\005\317\236\030\225\021QTa!\227\255\276\036\002\217\300\215\241\216\314\370\223\232\"8\206\037\231\005\252\353\300rf\361"
+	.string	"\203\t\302\224\"I\203\347\277A*=\022L|\027K\n!U\\Fr\260\233\203\226\217_D\026\213\006\023\364\266\035\361\\{\301\031b2\272\346\006\230\371\265d\304/\312\200\245\024\273t\237\034\027\204a0G-\231X\374"
+	.string	"R\257$\332L[\363\265\253\202\367\355\3445\307\037\261\334\210\356\317]^$H\346\005h\031\2219\241\311\253\3576\033\227G[\345\224\3739\2154\314\215\f\375\204]\341\317\023\003P"
+	.ascii	"HR\215!\310\224fj\330\031\272\352\377\351\252\256\277\024\365"
+	.ascii	"\376\277\027g?\216vn\242\316n\326 \272\027\201\f\304\2247\020"
+	.ascii	"\346\374\f6\346)Dzy\t\363\360\240hc\373\261\302\356P\222\030"
+	.ascii	"\247\357F8\214\361\303\371:XQS\277\261O\275(\004E\201\305\301"
+	.ascii	"e%iQ.\3321\031\230!\256ZK\\\231\341$\345\205$qW\026\371d\317"
+	.ascii	"7\325Jl>\2165#\217\315\027\312\213J\2320\335&M\004A\271\370\032"
+	.ascii	"\355\267\344\221\001k\201\020\214\002Z\337\313|qv\261\001\325"
+	.ascii	"\001\213\314\305Z\322\375I\231\370L\324\256\b\322\n\274\312\016"
+	.ascii	"<\272\316\034\316`\333\361vAs\231i\201\362\221\347\315\347\226"
+	.ascii	"\344{\244\371\362R8\307\255\235\006=\021\245c\007\302Qw\313\244"
+	.ascii	"\342\324\220\216p\271\371!\324\257\355\374\\T\373\242\360.>d"
+	.ascii	"\210\206\023\226(\275\243\216\264\216\312\326\260\370P2Y\324"
+	.ascii	"8}\317\256\b)\355t?H\001"
+	.text
+	.section	.gnu.lto_.lto.1410747af71ffc8e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_afatfs_sdcardReadComplete.39.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\332\004\035 "
+	.string	"F\371\317J\200\030R:\273\374\023IGw8\352hD\207\360lA)0B/\n\202\357\374M\r\355W\300p\003oS\344\360b'\254\312R\240\204\355\277\3779O\f\345\372:\300\363y\352\033\221\273P\214A_1\337b5\322\b\331{'\031\274"
+	.string	"\256"
+	.string	"\276"
+	.string	"G\361\003\244G\233\250\333\313\315\214\\\364\200jG\022\22319\347\336\375\3214\307\313\267\316\022}\247[ir*.E\361\265D}\256\0378\252\021\331\272\212E\337a\364)\306u4&\036x\202\216!Vo\336.\025\211V\347\303\370\364\225\306"
+	.ascii	"\224\361\370\034f\200$\303as\026\305\345SLG\253\342\003O=\232"
+	.ascii	"Gcr\302\004\322\312\250>\305\324dqPF\036O\261\316\332\221#\257"
+	.ascii	"\230\204\0038y\255\255E$\213\342\nXU@\356\022.)kq\206\305\030"
+	.ascii	"\007\215i\007\306\3119\257\305#{\337<\032\025dy\345\006e|\272"
+	.ascii	"\305]\3109\267U*\032\337\274w\267\231\356.\321\215Y\004\366\355"
+	.ascii	"BQ\222\346\344\336d\367\222h)\b\201R\326W\252\273\346\332\346"
+	.ascii	"\345l\357t\252\355\334\265~\365\313\037\367\256"
+	.string	"7Nm_\234m\233\332>\200\001j\3044-\252\247\313\266\3147\336\312d34\254\310\273\376\356\367\237\034L\350^]\340)\324\275:\371\227\213{5Zt\232!\257r\316o\322o\366\332]\355|6\346\323\030C\245\374\222snp\264}\355\242{=j\327\356-\267\016w\311\231D\327\032\272\251\311G\314)\033\226\252]\302\3005\371(*\210\005\365h\337v\377\352XD\317\222\321\271\234\241\316\200\345\274\334i\b\352Q\234\333\244\001 \276\026\302F\231\205w\357\027\022\222\334\335\335'\235\301\371\355Lkn\356\036\354h\022\2472&\333\326\024\321\276\251d\300\330\300\335\244\224\243\371v\224$~\366\313y\232\005\005<\261\274\371\235\242\263\ny%f\013\263)\305\030\337\232\273\224\203\344D\342\337{\227\206R\365\242E\316#L-G\226\214n\215\312\007z\223\215\273\366\266`j\021q2\030:O+\277\034e\225\240"
+	.string	"%\025{?utZ\375y\305\210\032\276\311\276/\375\0352\333\216,\231\356\036\361(\276\034ew\267\270\363\227@\002\360cA\233g\3169B\330\305P\364\207\034\355\036\037{%\237\364\350\357\233_p\346\224Bbe\031\005=\377\005\3752\370"
+	.ascii	"\177&R\244\370\001u\303 \017\217\220\211\364E\360\304\217\206"
+	.ascii	"\2410\b\030\004Z"
+	.string	"\177\204=A\277ap\2050\327@\007@<A?\036\340\317\020\320\257'\354\351\375\364\374T\364\200C\240\236\003\005-\\\021\034\366\202\204\302ao]\032\375J\235\353\352\026\225\354\366\305\350\022w7\331\270\266Uwo\233mp|\227\360}\026\263-\347\234u:\307Wwc\034\307\210l[H\242}\263ZcD\242\326\373R/]\270lA\303\216W\252\304\030\321\334\330\376\027\007\017\366J\375\257_ \336\242\3061\261\"\313\331\373\322{1\034\347\020#\2527\331\274\253\"h\252A\244(L\332\216\355\003O\231\263\321\225\016\326\001[\250!L\242\024RN\211\210P\220\331\202\2441\200\002\021*\263:\020X\250\244M\322\0325\366\213\013\240rZ/lM\"\001\021\200\246\265\274\371\375\"x\016q\250|B\266\327\316F\023\301\265\022\351U\3727\242\033a'.\025\336\270\323\002\341\315\262O\353l\003_\221\2201s\017"
+	.string	"\325p\f\273\257i.\212\260\346\204\365\034rL\276\221\237\021\007\273\257\324\2023,'\271o\273\376\260n\315\233\002=(\312\241\370\003\366"
+	.string	"\366\013\254"
+	.ascii	"\231\376[\216jk\310\204\213\2338\221\016\007\232K\231\b\301\313"
+	.ascii	"\271n\2108\241\362\031\013H\345]\302l\200\323\261\37478\005:"
+	.ascii	"h\254\322{)\214M\251\370\b\326\273\032"
+	.text
+	.section	.gnu.lto_afatfs_sdcardWriteComplete.40.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`6\005\375 "
+	.string	"&y\317H\200ZR\007Yl\371\364\250\356\271T"
+	.string	"\240u\345\016\0351k\236\270\022\212z\256\357*\001.\234x\374u\304\362\31394Y\200\330Y\344\250j\3420\306Vz\2574\364\356u\201\037g\212\366\016\0045\277\204\273m)\223L)\274"
+	.string	"\261"
+	.string	"\276"
+	.string	"\231\2529\2263\322\247\035\240\216w<\347t|\035\347t\334H\335^\004,\345\244\006D\224MI\340r\316\275\347\321;\277H\357\324\"9M\272\323\241\271\023\337\267H\355_n\240\330L\262\201\255INs1\223\354\313\323\240l\\\t4\256\262<\314\355\323:\264i\256\302\216\250\032\276\323\025\240\212\232r\024\013j\352\356\214y\2014()\233\243\212\262\341\347\355Y\023R\344\255M\027gJl-]\231,\276\023\266\214\364x$_\313t]\262\367*0\232\315\3604\250\342\315\271R\305%]\211\366=\314q\025\0204\2558\252\250\032ns\025r\316m\235\326(o"
+	.ascii	"\336\335[\272\233D\367=\013\270\205\206\254;\r\235\216uk\024"
+	.ascii	"\246Q+\214\222mv#\207\366\217\335\016\341\306\225T\277\216n\234"
+	.ascii	"\267}\243\263m\203\332\256\341y\227\373\316\221\356:\007\363"
+	.ascii	"\306\250\355\213\332\376\234m{\332\366\234\001\315\244Z\027\021"
+	.ascii	"&\317\206\3142\232f2\032~\022\304\301\334\273\275\275\211\217"
+	.ascii	"\031\271X\007`\032u\247K\\\311"
+	.string	"\302\305:\367\266D3j\345\234]I{X\247\r\326e;Dd^sI hZ\013\034\367\210f\321\235:\266i\267W\031\016\217\304\223H\336u$\300&\023\223S0 Q\213tqm2\261\352\007\005\324q\273\355v-\337Br.\030\255\313\001'\316\327\274+\035\027\231\262\222d\363\302\032\332\346\371\364f$w\277K\227\3510\2718}\351\361\377\373X\311d\034\266\007o\3532T\313\277\210\"\231,\256\353?\347\332\217\017\b\317\002\304\203E\325Q\013s\237u9\30421\3728\357\305\217\363O}t\356\036'-\203\240Td\244\341?\366\373\317i\177\305\007?\373\351aZ\001\342\261\252\242\352X\231\331w\254b\23087\342\300\222u\377\330\272\367\017&\265\020m\231\356\016\341T\\\360Xu\013}\n\320\201\b#\\\212\232\343x\351\357a\236\340\312\022\207q\213\353\235\034Q[\362\177\364\337\331\355s(?"
+	.string	"\314\234\363\203\366'Nv\242\375\312\003B\256\nU\013C>\265\004\n\024\252\217&\370\013\n2*q\266\370\231 \272\020\004\n}\277\242\224\b($T\203?\025@]\373\030\024\005\t\325 \037\321Q\221\332\003\n\365\210\204\324\024=_\260\250\307"
+	.ascii	"A\003U\374\202=!\020\030\354\245H\245\242\1779\352u\346\026\347"
+	.ascii	"\246\364\303\"\315\037;\327\266\343\375\267\331\005\216\377\t"
+	.ascii	"\277s%\333\210\266\214\337\334\343\370y\377\242\350e\310\346"
+	.ascii	"e\225\240\2211w\177\204#3F\fSG\300\266\217a\310`\335\251\377"
+	.ascii	"\223\226\340\314\320?\366\315\357\336\307\334J\305\020\222\003"
+	.ascii	"\214\232\315\027\r<\253\234\225\334\311\225\275\301\337:\344"
+	.ascii	"X\271\335\374+\231\206\324\274\315{\323\231\354]\026k\250qDe"
+	.ascii	"\fC\214\005\"2R\230$i\fp\002\221\2613n\021\3009$5\2334\233\001"
+	.ascii	"u\374\370\3601\273\203\225c\373)iW2\2500\001\315*\351\305\376"
+	.ascii	"\354\220\331\376\2648a\226\347\277TR]^\346\206\360\001$gCr\222"
+	.ascii	"\370F\331 \007N\003\033\022.Nq.RG@\253\340\005W\270\020\301\220"
+	.ascii	"M\357,\313O\341\221\203\021\031\225\204\035\243D\021%{(v\020"
+	.ascii	"\266\226\327\373\022!\006\022\305\t\"\363|\366\353y\366w=\350"
+	.ascii	"\220\021\263t~\353\240)\334\0022\303I\210\343\303\240\365\215"
+	.ascii	"\222^\004\310\027\220/!\n$/\345\302\351\020\013\007\0038ENsH"
+	.ascii	"~)\223\0050\236\243\215\r\231\300\211\347\005\214\032,\2432@"
+	.ascii	"\227\226\321\0273\261R\236\361\030A<\022\303S\024\024\314~j"
+	.text
+	.section	.gnu.lto_afatfs_cacheFlushSector.41.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\363\004\255\034"
+	.string	"v3\265I\240\330M:\221#z4\017\317\\\250}\221\311\336\020\270\371\007\326\345naL\211\206u\266\0201\302>\356*\231\351\326fR\200\021\215\317\3577}\213\370\301\271<9\246\224\274\240\376\206\220d\020f\233\f\312\264\021\2627\221;\311\233"
+	.string	"\226"
+	.string	"\245"
+	.string	"\347m\335[\024\024s\177U\311\016>\324\243V\374\211#\224U\274{\257\314+\363\nf\231\327\3130\363)\363{o\"\357\304&\303\356\255\001\005\311\275w\001;\030_o\036\263\257\341\005\330W&\231\265\006\b][\203\037-\210\206\234\367^Y\3378y\321\326\260)\3117\320\253\312\351l\027\233i\211\275\357\026\216\200`\345t2^\207\204lL\311\304\001@G\324a\214w\250"
+	.string	"\230\344K"
+	.ascii	"]P\030+\322\221\273\357\224\205\016G\2518\341\336\3134\247{q"
+	.ascii	"\036\317\3146f\226\300\\\021\004\335\314\036>\320\347"
+	.string	"\370F\250A\234*\207A9\305\233:b\244\033\366\246m\217\226\234\020}=\311\013H\325<\263o\021A\262\004Q/f\016\361\"\263\023\345\221\223\231wN\204v\252\244{/\004\235K\221\370Y\022\341\335{\037\b\371\020\036~\216W6\321C\237{\345\327\354\353[\264Y]\355\232\234n4\310\374\204\243\215\304\374\016\006\203]\3346\230E\3126\226r\315)\323\334\351\2379e\330)\217\247,\236\262\255\224kH9\f)wH\2316\345\017\250\275(r\241\013\266;\224L\272~\267]\200'\320F\307(\231JMj#]\361\261P \300\036\357\032U\341[a\255\361\025\354\353\205z\351\354%8\025f\326\"@e\306\275\266\357\306\244k\217\230~\275\363\032\335\004\257\265e\214\202\350\027\027\240\374\034\373'\013\027F\233\016\233\031C\006\372\\\355\033\242(9\021\312*(O\234\204}\337\r$\261:wMN5\246\206"
+	.string	"I\367\336\236{\024o8\023\016\261$%_\322c_m\272\247\206z\340h\220i\272\246O\364\025\336\263ig\232\246\037\365\352\203\306\224 XR<pa\214\322\016)tF\370\\\320)A\233\321"
+	.string	"0\r\007h\007\305l\207\346\243\002h&\253\361\310|xf=2\332\017\220\f\347"
+	.ascii	"\327N\350\374\310P\324j?2\231\247\333\303\3336x\334\202\361\273"
+	.ascii	"5\216?\345/\242\325\365\013\357\275W\244\227\364\211PR\256v\275"
+	.ascii	"\340\027\t\032(+\336\2567\306\352\204\205\361\032\033v\202\031"
+	.ascii	"\273Ci\265t\3453R^~]\266\221N2-\235\213d\212eu\341Q\232'\327"
+	.ascii	"\215\006\271O\372,3\331t \351KQ\232[Z[f\224&\217Kl-l\306\262"
+	.ascii	"\262<\307\345F\203\214s\333b\207[\206v8\246\360,6G\254U\2501"
+	.ascii	"@\303\bc\312\004###3\233\302t\240\002\2211\"\333\021P!C\314\224"
+	.ascii	"\214\340\246\315\265IC\213R!\345\263\206.k\n\030\020\f,\305\215"
+	.ascii	"|\312\227?RH\253\330_]\261\003\204\002W\b\272\2478[4-\213q\017"
+	.ascii	"\243\235\223\336N\026\027\257\022q\201\263\264\212!\263U\327"
+	.ascii	"\026\364Z\377{{\303\270S\b\tUo;h\275BN#\"L\002\005JL\325\360"
+	.ascii	"f\3130\262\035\361P\357pa\311w\215o\0022\t\261=<`\367\\,\341"
+	.ascii	"\310\225\217Q\316\216\004?\3436\221H!\305\204lZ\337\372\246\230"
+	.ascii	"]-\246a\236\232E\177\330\251\214@F\275\f\201\027P\314\225O\031"
+	.ascii	"\263\032"
+	.text
+	.section	.gnu.lto_afatfs_allocateCacheSector.43.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`=\016\255D"
+	.string	"\212t\370\031B@\234R:\363.\375\343LaG\351\334\377\235b\222<b}>Tp[\356\200\305\347\370\030\274}\363\307\034\352\023\021\263\301\036\350\027\030\205@\206]Q\271\n \036gk\026t\330\255o\377\223F\366N2\213\001o\001\212\001\355w\315\323\344H\346z<\216\327\024\254uk<\272\225b\236\327\255l\037\307k\001\331%>\272\225/\346\356\253>\230\307}\356u\277k\245]\373\265\257\335\007\265\354\225.\272\366S\002+\363\037rB\004\331\202D\303H\017\331\270\362\274/\334\023\\\373\375\375z\037\004\220\215\232\347}\337\007/v\207\343\213\370o\322F\276\257\230`\231\367\205\213\320\025\216/\336\313\333\256\272\375F"
+	.ascii	"\311\362\222\240\226\2705w"
+	.string	"\370\276o\223\322\237\356\213\355\213\334\027\363\224N\276\205{\023\341\253\037=\215\212\234DCM\346RH\231D\036\215.\264\330f|\325\307\372Q\336\333(\330<\317\266*M\220\377U\321\332\rD\246\034\032\235\025\265I\177U*\255\2028Q\b\323\252U\260\263-\n\232\251\373_\325\254\315\240\344\214\355|Z\230\310\310A\312W\331\207\f\210}a\337\304:\301\314+\026/\377\252aM\260PZ5\354|V\254\304\330'\231\\\254\212u\237f~T\332\200X5,#\225S1i\332\020\305\276\320~l\237q\242\020\376\257\272\244upes\344iU3ll5\270\255\225\375\257\n\326\3460uh\316\267\205\335g\225\035\332n0\243#\370\264\252\225\326\tl\311\357n\340\257\212\206\213H\336\266\317.4.\246\327\217\326A\236=?J/ 83\275\246\255\322\373\276\277;\246z\001\301\330\310\341}\337\306\\^_o"
+	.string	"\357\276\231\356\276v\013\301\005\031A\246\266\213\224\tdj\267\3563g\025.2_,\305\007UD\270Z{\035\247%\301'h 2_\213\365\f\033R\336`\236\361\230\253V|\216t\t\333]\342\200N\n\004\337\367\305\300\342r\236\236\202/\376\035\363\371^\264Z\365\020\363^\0279wn&\353\277\355\276\264\004A\363Xc|8\307\355\337\234Yg\244H>\325\206["
+	.string	"\001\026\240Z\334\340\017\f\250\350\304}\275\026/\360\271\372z\3470\315X-4-3\247\315d} \273YG\234\233b\306\331\315\3069\255\353\024g\273\315\317\305\214tG+m\n\3656l\332\3743u:\352k\324\340\274\240\f'`\243\023\313-u\237\363\036\240\234\270:?0\240\356\236\372\031\351\361}_\013\375\276\373\311\350\237\275\3303h\340s\321p_|\376\335\025`\001l\273\272\275e\341l7\334\024g2\273=C\342:\217u\267\270\031\264\270\227\022 \370\333\177\340vo%$\356\002\004\006\034q\007\370\336;\t\t"
+	.ascii	"\364a\336GO\243\"\347\351\336D-\356!\027w\323\210\233\351\342"
+	.ascii	"^\026q\013\265\270\225-\356d\0217\262\305}<\334\333\330\342v"
+	.ascii	"[\334\305\026w{\271wnq\343\026\367)\3508\322U\304\353_\376\274"
+	.ascii	"oWV\320\013\247\310g\345{?\334\037\346\227\373\351~"
+	.string	"\273\273\335x}\276V\356\005KfP\246?\207\210\362\357\376!u^E\240Lwfj\362\355\347&)0\004\f\364\226\250\231\224\233\211\224{\211\224\033\211\204\224\001d\352\371\376-uL\256\315\241\334Lh\356%47\022\232;\t\315G\317\334\314g\356eRn\3443w\362\231\2152\265\233\316\334Lg\356\245372)w\233tf\242L\355\206\360\244\234 7\343\356\376h]\247\331_p\217\033\034,\234\210\021\265\2062\031\362\b\240\270f\036kh\036\312\037\024\307\306\004\006\223j\020\\\342t\001\253\344i\t\233d(_\2175\320Y\326G\213\231\311\260\2207\363\377@\340#\321\n\330\210S\023\376z*\200\275\232\371}V:\210\t\314\fR\2279\\f\316o\"p\221\034\367#\342\364\276!O\227\2432\363\375\352\274\341\246\357\273)}I\204\242\3562?-n\220\004\016\022m\022\304[NLX\254\365D"
+	.ascii	"\213\201,\363\337\254t0\326\237`\341\304\177\351a\317\224\231"
+	.ascii	",\361"
+	.string	"\315\001\013'\366\217_<:d\222\231\254qV\343i\027\036\177\025\356\213\377\223\227\r\357\n~\373\204](\340M\232#\366\255\276O\336\006/\314`\305\263\366\276X\277v!\346z\033Lx\362\003\017\022\244\"B @\210Bo\330\324\356\034\016B\232\370\037\351\222\237>|\224Y\217\364r\202\206n\"\227\236_\352&\2632\033\307h]\247(^(=\336I\206\370\262\2669\256\351\372;\272I\0013\276cJ\352\006\211)+\250(\252\0325\240\226<\254p\330\230JN\325\200\001%U\005\025\025\235!54\025u\262\212B\235@Z!5\025u\203\307\n\253\350\224T\r*\350\216)\251\033$\252\250\254\242\246\242\312\216b\212\306\260\202\212\021u\203G\024\252\211jF\323\215\031P6\232\242\252\242ML\013\232\n\307TU\223\025\025UU\223\022.\353y\254\177wg\221\351\375T\312\335\036\021\034\3312\362f\304\364"
+	.ascii	"\035 \343<\025sT4 wkdD\266\261\021n\3519\213\262R\246\202\300"
+	.ascii	"b\264\340\335\331\035\342.\021\230.G6\354\2732'\027\327#\214"
+	.ascii	"n\215\317\033\022\030L4\033\366\235\301}y\303\0216\207h\265\363"
+	.ascii	"\347u\n\334\246\"\033\366\215y\351\302\346\"L\356\220O\326\257"
+	.ascii	"\276\270\317\353+7\314\345\352K6\324\023\264EK\226\257\201e\017"
+	.ascii	"\371\230\300X\244\331\360\212\0254\006\035\360\231T\271\247\307"
+	.ascii	"\207\212Y\231\261\017\227\036\006y\212\364yX,e\f\227\236,<_\312"
+	.ascii	"\f2\200\271\274F\201\307\244\307(K\331\275\0026\b\361\355@~^"
+	.ascii	"\257\300P\244\331P\217\360\332\366\206\2378]p\362\2044\f<\274"
+	.ascii	"\266\341&\370\352!\357K{z\204W7k\026\316n\030\253\003\345i\314"
+	.ascii	"\017tK\366\001B4\312d=\3000P-\t+IV\021\021Rn#\201l|\3466\346"
+	.ascii	"< S\233\310\231\2735\"\310E\017^\024h%\356\315\006\265?b\316"
+	.ascii	"L\326\306\301\241\004\371|F\n\241\017\236\004\340\r\312t\244"
+	.ascii	"\243\256-/4h3\233\315f\317\300\205\032\005\201\021\250Q0\305"
+	.ascii	"\230c\246DDDD\223$\351q\005\004\031(%\263\r\021`\2452L\325\310"
+	.ascii	"\2304s\306Y\343!S\267\365\222\3263\265\005\232\327.\371\321\243"
+	.ascii	"-\027\224\002\215\316x\321i7\362e\236rf\222\353\217\013\224K"
+	.ascii	"Lqx\271\361\bc\212\203W\025\267\357x\336\234G\257,\\\274\202"
+	.ascii	"\3041\343\331\253\324I\254Sp&\376\3527fnM\301\301\375\325}D\303"
+	.ascii	"\356\316\237\305/+G<\347\n3\246c\243\251fp\276Q\336\344\305\362"
+	.ascii	"\301m\243l\302.\212\357\376\006\340@z\326\206a\3446\315\256a"
+	.ascii	"b\200\372\314\324\234\2525A\234Z.\373\363Y`\266\223O\322\204"
+	.ascii	"A\0371w=\022'z\203\326\243\341\304\020\216\0029)\326TU\272\206"
+	.ascii	"'\254\236\303\261\006\001\203\222\036\216\241u\3101\232\227\323"
+	.ascii	"wo\320\203\314\324\212y\377\020\241\256$uS{\224\327j\t\332\273"
+	.ascii	"\377\022:7%\350+\327O\216\267\021\031V\347\216\350;\234\345t"
+	.ascii	"o\365\356\372x\356B\223\350\335\260\254\245M\362Gd\217\313\363"
+	.ascii	"\334\r\352\351\350\210\222\236\210\216\306\377\021Q\324?\026"
+	.ascii	"\272H#\356C6\344]>\263%s\001\001\260\226\375Jv"
+	.string	"6A\346v"
+	.string	"~Wm\342\212\374\322\007\247\320\266\272\327\344\363\022\375+(\271\267\344\214V\274\234\306\370iV\301\231R\222\350\f\303\337\2119?E\177\037'%\t\361\0203\346xN\032\252\245{?\300b\345)\276\250X\261\222\342\376IN\214\341\210\205\2161\0205-\261\362\024\363\363yA-SD\rF/\241\323\264\020$k\202\354\240[\f\017\227nb(\341\301\021a\032\224\214;\3324\220\2015\324\257\"b\210,\242\3116cH"
+	.ascii	"H{\374\213\177Jd_\003\351w\300\020Y\363+J\314\337\214c\320y\240"
+	.ascii	"\031[8\177\020\221$\352\"\200\250z]\020T\227\027\354j\3178\201"
+	.ascii	"\220A0P\255:'\026\353\363\223\372I7F\365\3377\272!\363\037"
+	.text
+	.section	.gnu.lto_afatfs_flush.44.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`u\001e\017"
+	.string	"V\036kF\360\220*\035:&\264\344\311G\036\314\030\215a\022T\250\235\317`N+\227\320\223\\\315^\225\377\317\021\034G\206\0319a\260z\363\330MQ\374\213\265\241\305UYz\342*@\322\240\267\242&\006o\273\332\266\211\334)\005W"
+	.string	"R"
+	.string	"W"
+	.string	"a\312\314\356~>\355\301\3714p\002\232\317\356\035\232\253l\217\027x\250\274\272\270\362\032\020\276Jp6vEOG\254\344\352\235\312\225\337\201\261\336qP\256]\201\230\013\224\333.M`$\035\202\030!d\036^\272`#Rn>v\327\262\005;\271\347m;\260-\301~\212\266\364\306\322\363\267\273;\355\326\327n\251\322\357\244<\274L`o\221\333}\2158\026\306dQ\342\267\237\366\327\256\366\355\273\3708{n\216\351\366\245A\0303\261\273\021\216\302\027o\263\247\266\241\303J\bbfW\004\341|\276\3453\325i\216\371\236\3549\324\bWu\335\366\177(a\231\311"
+	.string	"\3438\216W\240\221\352\262;\322&\201\362\255\215\252\262\016\302\245\234P\225}~\235\340\362\202D\336\260}\341*\034\303\331]\006~\356/'\237\304\2471\244\344[\237~J\037\376"
+	.string	"\r\031\031\261\226\231\210\034m\221%U\0063\223C\204U\305\001\243\177\244\021\004\001\031>\n%\020\023\210\022}\017P\247oT\301\024\372:,\002\235BP\241\020QI\303)\344\201#\2574\n\221<\221\351\344\201\022\030\264\360\231<\024\b\232<\217\270W\025?<G&\244\345V\310\177\245\261ntz\252?Dt\244S\231\217\233!?\357\324\005 \307\002#A\001\027"
+	.ascii	"\334\224\243\256 \t\303Z\250(\216\260\261c\026\332N\357\t\327"
+	.ascii	".\375\245p\233`]\343\032$\204\b*{\020L\252K\026u\r\\4\312r\262"
+	.ascii	"vQ\303\312\300\311\213\352j<\203\202\002"
+	.text
+	.section	.gnu.lto_afatfs_isFull.45.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\335\006"
+	.string	"\362\314/5Pm\222\016\244\204\251\246\345\024\200\036\332\302\255\331\002\236\022\311\350\252W6\354\337\355\035m\330\025Sq-\332\272\231EZ\225\310\341\271\236a\026\334Vd\033\204\310\024W\025\314\222\241,\025F\203Q\321\272D\314\205z\210\325\205\305\ne\013\302\341\212\031\313\272\342\304e!hx\340\201\023\177D=\262\201\314\\\270\035\025I\334\215Jk6\257Z\245\273\t\250\364 \201\310\363\272\347:\017b|\001\022\202\376\367\203\005$\025[G%\231\237\356$G$\021\216\237\363\323\b\n\234\263r\032\037\203P\b\005\210I&\027aF\263\276\3546\324\206\217Q\247m\235>\001\206\314\374i\233E\207\375)\177\302\177\021\t"
+	.ascii	"u\331#X\300F\f)(\004\350\032^\030\341\226\020$\3349S;\237"
+	.text
+	.section	.gnu.lto_afatfs_fileGetCursorPhysicalSector.48.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\265\0025\025"
+	.string	"\246g\212J\300\020)\035\355\256\362\323O\362H\252\030\006c\177(=\342)\355\007\274\302a\233l\246D\373\024\260bE"
+	.string	"\020\265:\355Oa\226\273\2662l\263\333\2767\305\206\320\026\346\013\266\352\2570\336\003\217Tf\265\367\215\020B\266\334)\005r"
+	.string	"n"
+	.string	"y"
+	.ascii	"\027\247=c\263l\317i\177\350D3\367\311\f\200\325\232_\316\213"
+	.ascii	"Z}#^P^\264\257\264\355\007\2757c\233\003\r7\235\003A\301\033"
+	.ascii	"\243`\255\276\230\201\207\214\027\351\003\214\0277\304m\027\351"
+	.ascii	"N\233Os\361\300?\300=\361\310\351xNK\236/M\300s\332q\351jhH\324"
+	.ascii	"\207\033/\372\304\321\341\346$Kj\255\2369\235\316=\336\266\211"
+	.ascii	"\355\006\366\026\b\266\0177\027\204}Zk\255^\037\233\234\206\221"
+	.ascii	"\323/r\332EN\267\310i\020r\232EN\177\220\323+r\272\274\357'\311"
+	.ascii	"i\321\323\224\234^rz\216\323\007\360\362\220\243\373\223\213"
+	.ascii	"Z7\f\251*\224\270T\302_\361\244\227\033Y\244\321\021\344\365"
+	.ascii	"^\354\337\221b\256\302[\244\324\343\365j\255\007\376\b\346F>"
+	.ascii	"\320N\030\254\265>\005\214\315\212\261Y\001n\032_\013\333\037"
+	.ascii	"]\302\257\303\320F\350\332"
+	.string	"\271\257\2458n8\340\346\320G\362\204\307\2601\275\211\202]A6\237\223\215\027]{\244\213\364\260\240\342\ty\366%\333\310\317\225~\346\036x\021h'\234\2320\244\242zhk\222k_\240\315\347\304\245Ks\0229\036\324>e\374Z\370\331\250\231=lcx\213\224\262\326\312\300WZ\251\225#d\306\213\337\027\235\242\330U\235\030\272\315a'\031h(\3243\222\026\024\027\031\312L%\246E\026\253\321b*4YJl\306\322\022#A\340\332\312\tK\314\245Vc\211\261|\267\323\272>>\360\337\271!\312A[\353\305\261M\327%\267\305\211\260\005\331\326\022\250b\355jA\226J}l\271\254%i\330\23009\324\323\307\376H\304k8\034\no\033w\313\035\253lxI\206p\247\031\253}\322)\323n\307T\204\313\260\tPPcE\204V\0174 `\"B\205vu\366Z\025\332qb\371\021\374w\313\250\332b"
+	.string	"G\347\321\237\247\355\002H\355\255\254\256rc\377\262\337iC \346\354\360\225\272\256\313"
+	.ascii	"\t\003\341~\234\217\323\340Ll\3054\266\2322\320\023\335\r\260"
+	.ascii	"\025\243\262\274rj \220\230\253aW\351m\177n\fJ\361HC\367M\203"
+	.ascii	"\275\301\241\375\216%\354I\324\305[\022{Zi\023\201\024\020x\r"
+	.ascii	"\372M4\206\005\005"
+	.text
+	.section	.gnu.lto_afatfs_cacheSector.50.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\247\013\245;"
+	.string	"\332f\340\026DP\234N:\257\023\325\fsY\346l\303\022\310\\\001\036P\204\005\t1]\211\222\325X\013\2055k\204\b\315\321d4/}\351\274V8\001\022[{\t\202A\211\303@\224P*\036 \035vwk\204\220\275\223\f_\001F\001Z\001\310\263m7\216\376\\#\273\033L\237\371+\366>G\337\333\030\300\367}\027\234\355+\271\033\353\320\313%\325a\202\305\335\017$\340x\027\032\037z\233|l>\344\270o\301q.6\226C/\327\024\313\206\270bc|\270\033m|_4C2\357\033\347\324\022\212g\273\273\217\345Yp\264\253\241k\353\007\20178\247\227\301\367\215{\"pe{v\275Q{6+\271{\001\001\226HGJ"
+	.string	"FEDCB\311  \344\321X$\266\354\232\261\333g^\300R_\223\217\016:\366"
+	.string	"\034\232~\310\270}\331v\244\266'\370\310\311\225N\232`"
+	.ascii	"k7Z\225p\216\330i\212\346\375\370\035\023\\\264\266\004\023\021"
+	.ascii	"\241\320\304\324>\224v!\2634\234$B\315\335C\223\n\230\205\020"
+	.ascii	"M\214\354A\005\320\304\212\034h/\254\310J\340}\337\263\205\021"
+	.ascii	"\301\310\025B\327 \221\357\205EW\240Bg\337\020|\\#S+k\201\344"
+	.ascii	"H);Z\330\025\326X\\\037\320A\353\276\027&d\r\242Be\373\334\013"
+	.ascii	"\260\205\221a\342\267"
+	.string	"\334\336\256\017v\250\221\"\241\3165(0\t\233\036P/\314\002\371\232\204r!\241]8\257M\200e\370$\241\315U\t\346\344\371\271\343/\250\023c\"\324\373\276\215\237P\261w\322\273\277\247\273it\037\237\002k\242\324+pj\336\024\036\032\263\264\251\370\37125\024\023\377q\222\307\314Z1K\033<)g&\037-S:K|\224\273A\210\300\177&\345\254\347g\210\036WfR\201\033\354A\314\322\037\f\357\214J\233\245\215\327\347\035Y\230\377\305\242]*\356M[\215U\342>\232\021$\360\237}4\207jffw\2362f\331z\243=\312R\177\\\270\020\3434]`iY\251E:\036N\351p\341\302\306\247\321*3Rn\354$k\342j+\363\363\347\316\226E\373\246~_\016\267p\265;\256\211\263\264\373\271Z\255\006vF\322m\304\355\240\b\267\023\021n\006,\356\005E\270\233\210p3\235\313\237\200\305m"
+	.string	"\211{i\b\367\200\313\375J\007\363N2\342^\032q#\035\356?z\227_\331\270\223\227{\007\t\341\006\022\302\215L\342>\006\3416\002\341.\262\270\211H\334\355\0217k\304\235Y\334\207\340\376"
+	.string	"\353\001}\235\352\373\202U\r_=\366\356\311\301\374\335t\335H4\021\242}\203\357\373\342\261e\372\254\225\371\035\326\351:\204Y\035V\335\355b\234\256O\230\345\265\305\350\207\271\230ndk\235\256s\231?\206\321,\357\373\"\265\272\003k\036\224\277\272\215j\230\207\313d\307\327\363A\331X\374;2\350\347<\334\032\312\322j\365\nZ\245< ?\315Y7\263.S?9\301\244\271;qBY\332\3717Z\245\3142\373\370\231\266)6\301^W\023\272\244\016`\256)%n.\317<\365\020s\321\351\317\304\214\305\207'\215\327a\023W)\370`\303L\006e)\365\230\031u\001\277RN\325)\2459\207-Y\224O\233`[u\343\007\224\3676\237m\372\247"
+	.ascii	"\177\315O\347Fq\245\024\233\262K\305\265\202\377l?\366\245\r"
+	.ascii	"\024B@gf6S\241{%\231\366\276[\177\036\257],'t\337\224i\203M9"
+	.ascii	"\217\361\232b 3\345;\327\367}\246M\312\006\362\361\316V\021\342"
+	.ascii	"f\352'\307\326\304\325\240\352[\0352K\325|y\200\331\207\311\364"
+	.ascii	"\357\313\3179\261M\330  \023\377i/>\310\352\216\201}\301\246"
+	.ascii	".\341\221\255y\232z\303\276\374\250V\257\217\247\251\347#\030"
+	.ascii	"%\202\037\325\332\351\337i\352\322\030\262\023\322\351\3775\265"
+	.ascii	"\370\250\366\354\2732\025L\226\266\367\354e\272_wS3\364\217 "
+	.ascii	"\363Q\344\231\023\037v\267\253\345q\242&t\267\206\367I\035\250"
+	.ascii	"\200\341|S\3129\357\373N\200\363\275\r\375\265\263\315\241\003"
+	.ascii	"\376\263C{\226\rV+\252\250\252\206d\274\230\201%e\245E\225eu"
+	.ascii	"\324\272"
+	.string	"\242j\221A\013\231e\245B\305\f\024m\r\253\024/6da\311\250\262\022\321\202\252\212\205\226\215\0250\214\272\252\201\226\n\031T*\252^\330\320\242z\302b\361\364\202\005\225\213\247\252,\255\247\006\b\032\013\206U\326\223\f,\254\254'd\334\326\3277#\351C\321\342\346\264[\376nKd3V\354\273\355\347n<{\243s\332\265\370n\233\314_\335\235\31487W\001b\304\\\316\033*\200Sn\274\346B)\221\\\353\333h\317~\356\353\032\263\274\246\037\035\203|;\274\304\256],X\r\2479-\310\f\316\347IyA\276\335\022('\241\262 \225J\200d\n\351\310O\325\"3P^\336\361\2126q\325\f\237Q\231E\213 \363\365\230\241!\204C\312\177\244L\207\362\321U\333\355\032\301B\256,\220I%\300A\246\220\360\230\230\331\231\326k\343\005\246t\220\323\300\376\214\004\362\255\016\364\374s\207\372\026\267\035E"
+	.string	"4\300\307\334\277s\245\256\022\374g\257\231\311\264%F\316(\360l\376\3351\331\216\302-\201|X\254\n\300\237P\251\313\245\205MMH\003;\346\343\021B\277\347\330\326\005\037W\346\024!e\226i\210\247\316\201\276\004\206\021\032&\t\264#\312\322&\346\031\023\032\220\017\370Vu\332%\037\200\334\250Q8$\225b\206DDDD\222$I\007\260\002\221!\252\325\001\021"
+	.string	"5\206\240:\322\2462\034\244\210\302\026L\353\232\274f\370\211\276\310Zi:,U\346\236\020O\216\226\365\236\004\214\022\365B\314\375sj\304\2463\277\206\230\210\265\247n\230W\by\356\212t\2230\336ebc\236\274\346\2032:\t}  \201\377V\204\247%\244\035fX\266\\[\203WO(\207\250\002:\362k\362\362^\230\356\365\342\"\257\227\023|\375\2042\362\341\333\301\373\354m\342\320\231\364\26326\002\2157z\307\372\250\345rf\236\213\230\034\261\336\205\t\213\317X\256_\036\217Z\f\255hofa\350\364\n\242\357\006\307p\374Zl\356"
+	.string	"{'\261T\274R\270\002n\241\034\215\241u\213g\313\262\2370%\214<\214\375\024\252\233\241\360\235 \322k\237\342\213?"
+	.string	"\024\302\344\372b@aR\034\020%abL\006\333\036\025\370\030\324\nl\347\213\246\017\364\337\227\355S_T\033\344\224\016s\320\200x\340\034\341{b\020\214\232\322\006Ki\254\003\265\017xi\261\t\306\204\3701\256(\234\352\226\257z/\206c\363\254[=\222\316q\311(\244(\031\320e\032\2610\261\037\026\002\251\217[\211\375\035\027\333\037\277\363\244}\340O\177\006\026\224\033\221(\324\005I\221j\302|\225\361z\306\317\021"
+	.ascii	"\017#\202\346\237-\216\217\354\327t\211\361~\201\242\006\253"
+	.ascii	"\276\f\203\334\360\033\336Ar?\261U\202\206\2447\360\263\203_"
+	.ascii	"\202\207V\200\002\264E\244\006\366\233\232\221\277\002/v\354"
+	.ascii	"\024\301\004+\321\340\246m*W\235\373\037"
+	.text
+	.section	.gnu.lto_afatfs_parseMBR.51.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\312\003M\033"
+	.string	"6\264\262I\260TN:\306u\177\215\003\030\005\301\005$\274\345\371u\347\213\214\306\t?K\003\367\346i\372*P'\231Il\361,\275\312n\201>\305\236B\373A\377A\377b0f\311\224\326;\222\213\266y\204\2335\262\215\220M\210\334)\005\241"
+	.string	"\222"
+	.string	"\241"
+	.string	"\366h{N\373G\277Q\363\235\210\007\250\225\b\312G\255d\003K\020\017\232\274\n=(^"
+	.string	"=\bAB\215o\005F\330\\=\3401\351\344\310\252\225\244m\013\177\377\310\3735o\207\275\304\220\202\337\270\363\346\333\034\366\305\246f"
+	.ascii	"=\252\007\350\213\360\2634\2053_\b\212|~.\302\244J\"GZ,|\200"
+	.ascii	"\036\322\257\002\220\023%f\271\234o\302\250\272\032s:\023D\221"
+	.ascii	"\364\311\223\0331\277\343~>F\365\244\330Y\356\346c\251\265\236"
+	.ascii	"w\004F=@s\206\026j\255\236;9\237;v\333Q\266+\330+\024&m~+\025"
+	.ascii	"[H\273:;\335F\277\032zV8s\313\276\016\f61\3066\271\210=\357\337"
+	.ascii	"N\b\311\r\025\017 \334,m\322f\256\316\376\002\261\201\205\363"
+	.ascii	"\022\331);\215\362\335\177\342\351\331{\267\314\3231O"
+	.string	"\217\236\206\355\364+\234\026\351tH\247)8\r~\323\3377\275;=w\372*\n\222n\244\222xA\226\212\254%J\256Z\004l\222\361\336\355\223~\222G\037\3518j\336\263\023\013\016Ysa\257+\353(\253\326\272\340\240)\210\007Y\276\3335\001U8s+G\221\026\027\375\215\306v\177\2240\306\205ml\257c\202\216{\235\246\277\320\327\302\366:5\216\365\027\212\262\257\205\r5I\222\023d\273\274\351\345\200\001\224\r!\204\245\265\373\322\324\214\037pu\216\241t\027\251\0342\314\231bV\216\324Z'\370=h8\020pq\320\377@\017\322]\251\332\211{\262\340+\207\306\356.\200~+\256gN\320\311\rEw\277}\216\321\315,-\333\335'\375#\"\264\244G\245\324\344gi\312\350[\235\177c\221\350Z1.\221\377\3426:w\026\355(\347\202N<\0170\227\261\321\324\\f\250k\016f6\320\264l\250u"
+	.string	"1\323B\263\301\320:\300\264p\240\325dfh\016\022\330\346\301E\206Fc\263\311\320F\262~\211<\347\237\276\177z\f\036\023%\246\360\277\321\363.r\361\240\224\230^\177\372ly\326\026p{\203\003[\235\303!b\312\256\325\270\340\262\345\371n'*\333\357\376\325Z\353\213\301e\233\262"
+	.ascii	"\206\272\312\271s\2053\"\256\316\223\322]Q\352\n\002\351\206"
+	.ascii	"\313c\207k_8T\214\212\220\017\311\340\226\332\374N\215\036\034"
+	.ascii	"0T2\355(\301\315r\006%\365#\234\201\271\322F/F\250Q(\202\210"
+	.ascii	"D\3068$\001\211\214I\322t`\002\031c\305\033\020X\311\266:uQt"
+	.ascii	"\360\013uq\263\251+S\323&X\262\201\253\321\002\027\177\023\320"
+	.ascii	"\227ep\222;D_)7\037\367$y`L\356\340\250\205\226X8\211hB\243}"
+	.ascii	"\021X\275B\222_\021\\PeC\306\021\207\352\311\241\244\371\323"
+	.ascii	"x\006\031c6\241\036\342\"4\357\263\352\356H*rBZa\313\305({\002"
+	.ascii	"\033\033\324M\253\flxt\226\356^\333z\004\344f\200b,\356\313\277"
+	.ascii	",\360\262\331`pIb\333R\177"
+	.text
+	.section	.gnu.lto_afatfs_parseVolumeID.52.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\013}6"
+	.string	"\312\\H\024AP\350\325\030\341=\373\345\313k<\337\311A\\\022l\362U\203\302\266E\200\316\326\025\263%\f8\275\206i\243y\264!\002\252\263\002PGZ\307\007\220\0069\024\244\202\031\311?\266\273\204H)\245L)\2457\001\020\0018\001\316]!\001!\263;gk\314\207\203\272@\242\211\\:\352\232+=\246\373\254\271\321:\215\231\3076\232\fwp\314\313\344\213\314\0063\257\325f\306\301m\326/\363\316\216\251\233\346\246M\246\03321\016\rm18z\314\221"
+	.string	"\026\324\345b_-(\031\203V\331B\333*\201\324\235\271\311\032\f\216.\273\321G\256\373$N\215\353B\035\260S\333*C{\270\266\332vpm\225\231\031\202\023\016F\022w\350"
+	.ascii	"\364`m\231\365\032r]\250\361\2434\262\227\212D\245\244\2410\210"
+	.ascii	"td\004\374\371z\274\235\256eW5}Gr\353\350%\026\003\2077-<d\207"
+	.ascii	"\300\202x\351\"q\254\225\304\256x\3220\254\205V\252x\360\202"
+	.ascii	"\363\315\t\\\031\256\"\215De\212\037\031Ii\240\363]\342?\037"
+	.ascii	"\213\001,\310W\367\224<\267\2228\357\271\205D\213K\351\273\002"
+	.ascii	"`A\274Zgg\353HZ\027xnyy\233.\370\2123\244\355lu"
+	.string	"\245\303:N\370\260\235\364\322k\226\272#\305\342q)\375\177\\W)\001\327u\373mgr)\335Y\f\256\353\262/\271\2024\003h\346>\303\314\"\230um\001zxD\273\035\3338\352\353\236gs_`\230\375f?\241<[\242\254\337\344\236\322%\326\364\375\371&\3327^\225k\206\272\256\2532[\227X\377kt\033\244X\211_\3247\326V\377yo\0175\246W\247\336'V\177/3\321lN\370G\220\322\356\272\256\216\377f\352\366\323\332\257\302l\017\226#bf\024\255\346\251UC\212\245h\253@\375\005\347\231\261\262\226Z\231\243\372\214\224/\316u]\t\334e\332L\013\356*\255\262\013\030\336\313V\271a\254\255\366\333\b\236gb_dsI\2172C\257\374\233\314\235\272\377\204\271u\246\300:O\3501\315N}\326l|\347\246wv\360\316\013\336YA\227u\033x\347\001\357,\200\235\003\260\316L\2543"
+	.ascii	"\235\363\022\353\\d\235\211\254\263\022\353\234\244:\017Yga\353"
+	.ascii	"\034l\235\221Z\347\243\326\331Hu\006\252\316?\326\331\307:\367"
+	.ascii	"Xg\036\353\274[\235u\254s\313:\263\252\363\312:\253\253s\272"
+	.ascii	":\377\352\354j\377\342e\266\001}\n\276\311,\211\364\351-x\001"
+	.ascii	"\317\004\324\303\367M1\333\342\311\341w\021\247\333\230\260\213"
+	.ascii	"\273\321\024\3152P\360\205H\037|&6\345\242\217\036=\322\023\331"
+	.ascii	"\b4\263\255F\177\364\354\233\362\t|#\344X#\002~sq\3069$\340\231"
+	.ascii	"\221_\332P!%=]I\217\246?$\230\036tl<\214\f\323s\031\332-NC\013"
+	.ascii	"\332\320j\247q*x\235\373~\277\340;k\321\232\350\007\241^?\255"
+	.ascii	"\277\357=;\364\237\247\337\347p\266\215\225\371\236\331C\367"
+	.ascii	"\221\353\270\356\275\357YE\251\333S\273\234m\256\340\310<}\206"
+	.ascii	"\220\310\361\276\311\256c\320\235\326:\261,cYjm\203\246\360L"
+	.ascii	"\006M\341\373m\003]C\246\350\020tg\367\315\035Z\333\016\035'"
+	.ascii	"X'|\247\265\207\371\bk\"\350\216\036\336\357"
+	.string	"~\302\263gu]\r\201\204-[\336\2530\223\003\214F\243\321>\256\273\347}\360]\242\355\236\371C\303\345\031\264\f\244\373\035\210\306sB\367\235\304\251v\250\254}\346\020m\347\350\213\253\363n\313@\354\253\337>\213F\371u\345Q^\237\375\316Z\224\364h\317yZ\277\317\002UTSVQR#\240\254\240V\360\252Hd\340\300\"\304\212\031R:\252)\253(\251\252\225\243\232\252XXA\261\210\232q\254\2022N\2710\316p\001%\303\030EUel:\300S4\244\250\214VSSTF\0364\331\251\373O8\306\032\0374\265b7r\355\267\333Dk^hj+7r\r\020\340\031C\362\257\226\230\250x\224\243\017\312+rz\3413}\322\233V[\373N\317\276Zh\312\257\253\3427\371\270:9\002\343\300\332\313\331\307\320\332\303\013\214\b\300\21239\002\227\244rW\\\311\261_\247'\311p\301\351H\232\342"
+	.string	"\374:\304)7V\366[X\304\224\212\364\322\2530\323sD\252\355Z\372\004|\336\224%=\232\364D\206\300\r\235k+\317\2317+\302o\362G\205\317:\200\356\270a9\"\335\2212p\202\337t\037R@f\016'\036\261\271T\316\232\020$#\007\337lK#a\300\246\037\360\314\001s}\\\213\377\3117j\346V\314\342<<\353]\006J\032\277\370\301\227\351G\351\205\370\003\336\370=H\211E\351\205O|&\266\244g_\351\213\257\362\313\373\270\n\370\244o\321d\316Q>\257\216\2648\326\261us`4\374\246\200\341\250q0\004\221#\n\315\210\210\210$I\222\016\240\"\021\252\252:\021`!d\024\t%J\2451\365\245UL\001d\331\207\332\016\b\210\261X8F\276/Ti\246\016"
+	.string	"\231V*\255\217\307E\214\200\021\347zQ\323:\333\222E\231KV\304\322\245\307{\214wca\243\276`g\33204*=3\344:X\316\f\331\367\274\210,)\312\357\tW1\255\350\205r\205\320\356:-\025\365.t\002\203w\033e\334s\273\331\003<\277\200\035z\325\265\352\002\027^\3567R0{\263\373\273\261U\030\357\273\220\006b\301\3504\201)\354A\367\305\303b"
+	.string	"U7\266\365\352\364g\344}\315_\f\234Qf\203\034F\212N+%\221\317\354\324\330s\224\201\276\373\033\275M\256\345\035\201\031B\021\236\251\021J\375\337\200\n\326e\223\022\322\302\301\203R@0\274\342I\0257;K\357\370+!\016\306\246f:\037\207S\3349\216M"
+	.ascii	"\217\235\237\252-T\340\337\024 a\251i!\017J\207o\302\276g9\205"
+	.ascii	"I\301\346\251\372\035#5Ly\374`\323\016R\320{\275\355\026qG\004"
+	.ascii	"\246/\007\204\023H\274\210\230\357\017x)L\201\0302A\2520\235"
+	.ascii	"\003b ftLB\237Q2X\306\240@\313>\207u&\356\302\244\356\370\376"
+	.ascii	"N\320WU\022\274\245t\020\267\236e=\323\020%\253\3132+\017\334"
+	.ascii	"\360\315U4Vj\025\\\363\247\200Pl\312\301p\337\037\372\260\004"
+	.ascii	"\263\277\244\364Z\306\177\035\372f\214\274:\242?\024\234[_\353"
+	.ascii	"\326\306\205/\270K_\"\177N<\201RS |D\266X\312T}\001\267\344Q"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_afatfs_FATIsEndOfChainMarker.54.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"}\f"
+	.string	"\346\327VC"
+	.string	"\2216\03586\322\234\237\306\307 \035]\340\025\007\022i\325\305\225\017\352\204\217\303\310\017\024<LQ3\277\023\360\326\264\032y\b\274\232\240\377\376\273\274\357\310\236\230\235\244\365\317y\344\231\031>i{K\231RG"
+	.string	">"
+	.string	"B"
+	.ascii	"\013>F&\025P\331d(`a\252p\202\306\356g\251"
+	.string	"\207\223\036\241&\311\357\266\307M\313!G\305\364\202\353Z\256\020\201\213\013\f\001\272\022\354\230\331\020\3430\317\225.%\263\002\331]'\327\261\334\324m;\260\335\300~H\273V\016\256\356\375\321iu:5}\016\001\032\013,7\265\330\275PscOq\205\b\333#\273c;\323>\211\227\030\335\243`\216]\r4)v\277\004\376\330<\032x\007\365\b?\200z\264\355\\\245\031\323a\304\251\244\333Cp.'\325\027\353M\250\253\210\f\214R\332\260\215]\306d\263\273\f\374\230\233\320|\020\217\026\235\344\271G\377\204z\274\036\346\320\373\200\242\206\207\2225\366\267\245\276\330\207\273\001\331G\004$\n\311>!M\024\341\002\340\313C\033\tyF\256\222\t\232\307\302H\254\022\022\017\310\2722\315\3628`L\302'\263B\030\226Y\235o\017a\n\320JUW\324 (\232\022\037\244\302T1c&\003\354dT\033\002(\037\023"
+	.ascii	"u\331\363C@\030\266\264p!\213\035F\250\214\331\007\214\r\025"
+	.ascii	"\034H\030i\273T\220H\340B\3442\nW\243H\036\023\342\315A\242\032"
+	.ascii	"\222\347RP"
+	.text
+	.section	.gnu.lto_afatfs_FATGetNextCluster.55.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`>\006\225&"
+	.string	"\352Gp\017F\200\334Qc\333\306\350g[T\274\322~`\277\344\215\242o\221\354I\262\243\305\360\237\033x\340\302\201\304\204z\254\276`j#\327\333\024\324d\253P\200\006\205#\235\251\332\270\2378\260\030\320$-\270\226\273\355\275\245L)\350"
+	.string	"\312"
+	.string	"\353"
+	.ascii	"\270\"\331\275d\2750\237\23320\264{\311N|-\361\334\263{\342\222"
+	.ascii	"\2620\264{\245Ft\375~\247\356e\254);\242\335kTp\323 \312&\347"
+	.ascii	"\212q'L\003x\356\023\027\224\013F\324\326\350+y\356\023\020+"
+	.ascii	"\262{\215\f\034\241"
+	.string	"\326o9i\333\275?\344\220\335{\031\330\001z\323\266\257\344Kb\370\227\001\nX\003W\306D\370\304\315\275\306\034\356?\347\315\362=\347M+\344\277\2477\033Z;\315\322\326\237?v\fPE\257!\261\351\251\320\2556\341\307\224\216\333~&\225\003K\nGE\313\004\305,5~&\245\243\374\331\002\204\314\307.\204%EUk7~\356\020\205%\356\336\373d\260\2326^\336\2106n\313\240 <\336\354\020\237J\034\0263\341\221\257QD\247Zk\023\356\275\256C\342\324\255s\333Z\266\201\266\251&D\026\005\227\230\247\n\307G\272\304\255\230@\357\275\017|*\257b\344\023\271\351#]\375Pw\336$\262G\236(\215\027ZQk\013X\323l\243S\265U\366\313k\203\330hu\021Zm\300VM\204V\017\241\325Bh5\016\255\016\272\223\237\300\273n \264\372\347[\277\317\215\177\017Z\315\203V\007(\253w\322j"
+	.ascii	"i\265\016Z\235\226\3257\264\332\246S\215\336\252ki\365\231V\233"
+	.ascii	"huy\253\266\266\352\212V?\201\017\034\"S\337\341u/\215\2648\327"
+	.ascii	"\314\224b\344]\377\327\037\366\213\275\264\357Oy\362\305\217"
+	.ascii	"\376\216+0/Nv)v\352G9\222\367\243oW_\222\334{\037\305Nyvz\263"
+	.ascii	"\3321|\257\203\035\312\307\234\212\371\002&P2\265\b\353\330\245"
+	.ascii	"\250\365\"\303\242\031j\253\\\317\240\317\260R\022F\030\305\274"
+	.ascii	"\230\343l\224\377;\201\254\005\036\271p\211)P}\337\271\340?>"
+	.ascii	"\214\006\004V\366\206\203ux\033\253\233C\326\366\360\241~\bt"
+	.ascii	"!\303,\2637hB\333d!{;d\007\310\t\026q\366\307\n\3312\031,:\325"
+	.ascii	"B\334\213\017\202U\227 k\333\002\336{\233N[e\005\367\261"
+	.string	":C\270\306$-\342g\276-?\366\311\027\3718\323\243\250\265%\366\333\217\335\334q\005&\213\312\364\251?\036\n\023\372\343\307\230@\034\217\024\227\f{\254\217\034A\242~\350#?!h\233\016\307G\332WYd\037v\313\346i\367\235=\266\310\n\200\242\362\022R9\3254\033\260\027\273\035\033\246A\357\344\331c\r\330K9\b/4\322\202s\234*\224\226\233em\225\353M\234\0010t)\2224\354\370v\275$\013!zFH=;\245\336\221\216w\366X,\361t\273\263B\017\206.)\335\351z\274%\026G5\030\272\024I\032zFH\250\217\032\360\220zFHGI>\236QNIE.I\205Q\213\334\321\216\227kp\300J.t\273\\OIi\227K\215\300\227\327\006\001\262\337\"\004i\006\264N^\372\n\363\225\367\376\220p\261\037\255\t\317P\r`\355\237\326\217I\375\220\307\342\236l\223}5(|h"
+	.string	"k\275"
+	.string	"\2607\273S\352X"
+	.ascii	"\251\325I\355\237P8\030\323\315\336\315\225\231\254-\240\223"
+	.ascii	"Q^]7\233\365\325p\360\355\204aJZ\233\217\306E\005\224\210\277"
+	.ascii	"\302>*\307i\255\255\331\007\221\324\033\313i\332\323>\210UZ\323"
+	.ascii	"^8'\354\245]pEe\013\007[\201Z\373\032We\262\\e\016\225\0346["
+	.ascii	"\345+\257vg\227x\231q\250A0\244\020S\312 \231\222`\302L\222\244"
+	.ascii	"\003p\002\231\251\273m\020Xg\303\205t\347\222\245sC\336\207\237"
+	.ascii	"\352\220b\344\006\251\200\304\252!Gl>\261\314\332\250}Mg\261"
+	.ascii	"\034\205\261\217\f\f!\214\321>\260\037\351Y\332\327;\356\216"
+	.ascii	"h;y\270E\n\305Q\355\211\033#o\013\022g\224\377\232`\327\326H"
+	.ascii	"\305f\353\300\035\227\316\226A@S\326\303#\035\254?\352\230\274"
+	.ascii	"\316\340\203N\314\267\366\344D\223\230/V4$y1G3\361\267\336l\263"
+	.ascii	",w\345{\236\331\272\301)\212\355\326\023\307P!!\203\370\354\305"
+	.ascii	"\255\372\036NE\253\220\361\375\3011\352\350\213u\245\376\267"
+	.ascii	"fbH\r\340b\326J\007\035c\352\340$\013@R\002\256X@\004\250\336"
+	.ascii	"\035\007nv9\243E\203\026\241\001/]\001\233Hp\306]\030\222\266"
+	.ascii	"cd\371[\305\213\233\355\315F\r\261\376"
+	.text
+	.section	.gnu.lto_afatfs_FATSetNextCluster.56.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\034\005\245 "
+	.string	"\206\275\324J\240\226U:\225W"
+	.string	"\357\026\216\246\363\376\261\224\002'\322\320\304\353\312\r\370c\244p\243eF\212j\271\276\017\217h\337YY\234\232MG\240p\205\225\204\\\004\255^\221W\230\035\f.\260T\214\234~.\037\316\266\222\266\t\221;\311\305"
+	.string	"\256"
+	.string	"\303"
+	.ascii	"H\216)\371\022\240K\375\310\356\225\373!\223r\314\362^#\037c"
+	.ascii	"\372\231\215\352\351\274\356M\"V\341\236zY\312\255\345\275U!"
+	.ascii	"\234\202~\217\356_xQ6\227\367\032\031\034e\016F#\025j}S\357\224"
+	.ascii	"\335!%a\325\275\306\006\374 =\312\314\374#g\002\342\240\fD\276"
+	.ascii	"\031:\3120A\250\254{\2154\235\327\330\243\347g\366h\367x\320"
+	.ascii	"_\251\313\242g\327 >\362\030\210\212U\204C\241\277\f\244O:\262"
+	.ascii	"q\027Rl\030\254\366\\@\2342\343W\214l\2345V\224\270\034\t\254"
+	.ascii	"(\215\237\260!\215\367Y`)\207V\200\341\320\251#\345*\370\344"
+	.ascii	"+\214\341\257V\027\205{/W\341\360\350\f;3\337`f\027\314gVl\342"
+	.ascii	"Pj\351\275\027\002\337\311\237\330\370@\216\362-E\2750\205=z"
+	.ascii	"\323O\036\001\363\270$\"i\362\325&\263\361W\233\007\363\273\331"
+	.ascii	"l6\271\227\230m\345\034[\031\307U\371\306V\266\271\361\247\271"
+	.ascii	"\323yf+\317\274\351\227\305*\003xU\226yU\216\331\312\260X\345"
+	.ascii	"\027\254r\232Vv\275*\333We\324V>\323\312\355\252\\m\345\037\250"
+	.ascii	"\371\021\343\3509\264\334[\324\024s"
+	.string	"\257P+!w\372\237\376\250_\352'\363\371VW\366|\212u\305c\317\231\274\2129\306\247z\262\305\247\030V\214\312\272\367\236\2129\326\2029v\2642\003\361\223\034\352\307\007ad\270\242\274\266\216\331\304\261jZj\213(21\322\344{\020!\361\312\376Av\326\355k\322\305\246\362{\266\301?u,\033\004\370`\356p\244\007\tXGm\232\031D\210z\341\354EB\245\221\3262\330B<\323o\233&0\006H\374)y\304\257zUf\372\312'\330\321E\007\021IS\037\371\223Y<j!\241\263\372\251C\341\322O\375\210\373\320\204\b\221I(k~\222D\211z!?y\n\300\026:\230\035\315\343\231\323\177z\177y\363=+\353\234\036@\204t\f\"\375j\223q\372Qo*!3=;\261\262\306\351W\375C\226\242&p\353W\211\250\334\"\335<\352k\366\246O$\3312T\301\360\223\001\272\034\317v\333\331"
+	.ascii	">7\024<\032~t<\236\013\272\034\317v\003\301\253\355\314x*zv7"
+	.ascii	"\235\365\271\361\304t7\336\256G\205\005\236\256\306\333\311\260"
+	.ascii	"\315\301n\207W\333"
+	.string	"\261\361\374\354j\264\034\216\306\203\253\255\240\331t;\232\003\005\234cq\323\321x\271\234\216\0263\372~\336^\342\276\225\"\224+_\377\236zQ?\347\275I\023.\365/\235\316{\357}\3214\177\211\242\207\263Gi[p\310\364\253\001\234\261\226\201u\fv\341H\334\253E\024\223Z\314d*Y\245i\363\271\260\300\200\203\005\204\237\263G/d\322t\332\350\230\340\226\355nW\037H\244\236\245X\264m\0378\344l\264\037\334\362=\375l\234-H\254\341\310\\\332Z\021j\004\\\2501<\242\210rJ!\222\212$H)H\322\001\240\242\241\262\362\020Xf4\312p2\001\\\233\373\307\276\366\331D%\212F\027\215Cf2\345U&\264w\256J\0240\220oB|P[\255\310\360@\231~\305J\371th\334\246\036c\337S\346'\021v'\243\215\357l\\\f\255\357\323\363\235&*\271O\0042\361\311K\330\220#\370\016"
+	.string	"rb\206:\230Bh\317[\235S+qa\004?\333\262E\336\342)\2522>9|J\2740\231\213`\356Bi\223\005\333\n\215\312p4=\002\271\301\n\320c((@0\362o\260\351c"
+	.ascii	"P\030\371Q\005/\330\325\377\210\"C\333.\307O\335j\b\361\007"
+	.text
+	.section	.gnu.lto_afatfs_findClusterWithCondition.59.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`&\0215["
+	.string	"\272\233\200\"N0\222Z\031\016{\311\r1J7\255\0256;\376\024.\002\211\376\212\355s\347#\371a+z\2152\033C\310\225\261l\320y7\204\362\325\314\250A4\240\210\025\251"
+	.string	"\200\317\315\335r\264\346{\265\252\325+\200a\362\031A\"!d\357-e\222\001 \002\340\001\022\002\277\353q\271\275"
+	.ascii	"\257\314\303\354\366\330\005s\273\246\313-q\013^X\323.\035\006"
+	.ascii	"K\2722\034>\267[\\\024.\267='\246L"
+	.string	"\327\031\n\273\305\243\303]!{.\177{\227\307\235\271\305\335\375\362\304\263\356\255\327:\263c\341o]\221?z\211:\"\256\253W\227\334\272\312\005\201\213\332a+s\223\343\321\002\001!w\373q\256\311\030vC\252\254\253\332\006m[wT\245\266j\245\312\262\2773\301u]S\034\335\034\347\rQ\312\344\214V\273\rB\276\005\210\020\317Z\265\346\347\200\332p\231\237\026\344\344Y\253\234\274\311\255\253\332\212E`x\364Y~&d\2154\254\246\212\024P7\210\305&\270\256jIG\007J\217\236\377I\217v\224\355Y\2426\336\250\310\004Q\211!\022HB#\202\200D\374\370\364\034\361\354\250:!\2129\304\2410E\317f\343^\352FE'\20493q\376\n\027\230\357!\321\316\006\272\220\001;S\006&J\267\316^B\250\264u\366\2413\314\227\025\022W[R\216\264\2074\023\0038\206|c\241Oi\371\210*a\\"
+	.ascii	"\364\332\022{\320\031D\206$\356{H*\247\001^x \373\030R\013\003"
+	.ascii	"\235\f\320\031!\362=d\331\311\3133\200\037CNa\021\032\254\261"
+	.ascii	"\362#T\002<\261\214]\017\200^[a\367Y\202\245u\017K\371Q\232["
+	.ascii	"\312\343\205\324\222\362 \263\234<B%\275\017\333\330}\001\364"
+	.ascii	"\332\312\362\035$\257\255%W\367\220K\316#\277.\3269]X\tr\205"
+	.ascii	"\200\203U\346cH%\034\342\004\"B\345\370=\344\327\211\342\017"
+	.ascii	"\007\037\256w\2441$\027\027\213VY\344r\204J\314\343\260\302\342"
+	.ascii	"v\366\306k+\355\3041$\226\363h"
+	.string	"]\327\323\035i\017\211\204\207X\222)\020X\335\362^\310$-<\3624G\353\310\321\323\350\311\2227\252\326\325yt\247\207\365;+>\213\274O\024]xET-\252\023h\214\223\036nw\316\322\252b\026*\255\353\272|\324\332\372\236\370.c\355\356\f\273j^w7(\340\037\367wW\272j\251\303i\322\334\222\256\213>\334\333\3151\260\331.:\310*\311\005+\t\243\357\345\035w\f\034~\353\3227\214>\336Q#_\3155\276\266A*nZ\345\255dh+\227\233o\367\273\320ge\020\213\311_\037\225\242\350,\376\3359YD\213\024\0332\3737F\257\250a\330\036Hz\364}\245\0313+\311\037$U\321+\372\314\237c\3136*>.X\250\316V2\016n\306 \351~\262\375\034i\213\326A\263v\246\212\341\354\355\326\202\273\3111\\\327\025\306\236\315\333d\260\017;\272\032p\300?r\220\036m\321\267\273"
+	.string	"M\270\bv\241\245MqsW\215\212[\271\373n6\233n\266\237\354\252\2748T\336\033*\257\r\225w\002\t\236\346[C\345\245q5\337\0312b,\360\035\276\t\250\2740T\336\027*\257\213\035\336\026\277\341?\340m\337\244o\371Y\334\355\273\342i\277\n\225\027\305\362\006\360\277/"
+	.ascii	"*\357\t\225\027I\345=Ry\215T\336\"\225\327\204\312K\244\362\226"
+	.ascii	"Py\207P^\022*\257P\363\216\350\341\r\352\341\005RyE"
+	.string	"4\357\217\017\257\017\017oO\017/O\017\357\216\312\253\362\360\352\354\360\206Py\213*o\216\312KTy\207*\257P\345MU^T\345e\225\367\030\250\310[#sC]\263\371\324V\"\315 V=tN\354j\3764\377\337\277\303\337\366\273\375p\277\227\377\313\211\273\337\005\334\342\037\232\340\327\360\314\325\354\375\266\330\267\324\203p*\357J\0324>lb'\243\211\362Y\177\254b\205\353\317ki\337\267t\276(\341Z\013\177\311a\231\233\341\3611\373\277\245\031\036y\337+\341cv\305\227\334^o\213;0\371(\321\344\316\004\265\206%\354\352p\274\207\t!\372\344\301\335\265\200\253\344\020\013\321\007<jd\331\346M\332\360kE\352\235(\206\005O\007\274\277\236VF\371*\375K\267\365\005\345h\271\034\266~*\350\370kY\312\372\245\360\313\341\312e(\353\247@\030\2302\246\364\250\223M\240\377&f\246g\305\203k"
+	.ascii	"\363\361\3041\314\304(\266\342k\327h\345L#\331\335\340\350]\343"
+	.ascii	"\f\306\032\370\307\004>\345\b\004\2237\177X-\2657\272\3308Z("
+	.ascii	"\316U\327\336\032\315X\t\327\215\376\336\005h\262\206\211\227"
+	.ascii	"\027Sx\345\365u\241%\247\344\336\232$yZ\271\367\3730\b+R\260"
+	.ascii	"\230j\215\336S\207\330\022t\326\256\0071\004\236u\255\355\265"
+	.ascii	"\022\264\332\207\267\344a\215\017.p\207F\023\273F?\316U\327\214"
+	.ascii	"\316i\032\255\22292\257\252\f\221\205yQgtK\2619YC\223\323\304"
+	.ascii	"\236\321\367\373y\226dR\361\265\315\311\350\234V\255\316\326"
+	.ascii	"`\r\276\350\023Mlv3\354\027=Tw\205e\247\331l6\037\225\n{\330"
+	.ascii	"$\324\\\331h\264\205(\336\322\f\025_[\3279A\333\350S\315\325"
+	.ascii	"\030\225\2315f\341#QC#\023\364\315\\\200&^\316\272\320\370\005"
+	.ascii	"\017a\216\350\234\350\264\331\207\2653h\\$\352q}0@p\266\257\255"
+	.ascii	"\264\037w\346\\\365\2677\027\342x\264\235\326\320\254Q\013#\243"
+	.ascii	"\212\276\366\001&\002\001P\037\033~\001\355\353\235\200-yO\332"
+	.ascii	"J\f\216XqnF\215\271+Q\265\324\362\324W)\307\004\357\351f\324"
+	.ascii	"\350\226\332:\260:0\342\243R\356\323\235\223C\310\232\260!\003"
+	.ascii	"w\356\024"
+	.string	"tH\222(:\251s\330\314\326`\rNqs\271\352\247R\246'\305q\300\352\300\350\206\255\\\026\270\205\013\256\037\213\271\322\305\305V(\232\336Y\331\252f\265|\265~\303\007I\217\376LV;\256*L\265\273~-\226xe\353*\365\256\365\343\343j\300Q\025D*4\350U\361\240p\210/\367.@\206r\217\003r|\357\003NK \364\370\201Cg\351\207\t:R@\235\226BXr\">\375\200\322\001\365\224>\245\252\nK!\370\250\001\304\t\312G\004NMP;\226r@\351\020\341gi\311I\206S\223\f\036>\230Jhj2A=\241\307\017\022N(\246\036L6F\330\341\244c\351\251\350\264\004\365\364\303\204\035B\037MLPL!\370h\332A\334\035,\236D\200\322!\302\016\037@\236t$51%\371`\322\321#i\207\323S\022\213\001\266\351\204%\247$\250\246&\247\244\242\332\324\373\311\026\265\240"
+	.ascii	"\035\360\207\222\245\2257\242oL\247`q\341\331\033S=;)X\314\""
+	.ascii	"\2761\r \200^\245\251\246\202\213z:\327\325\313\201\177\371\231"
+	.ascii	"\357\371\333\362\3444\002k%w\\]\212\270/F\230\2307\3031[YL\234"
+	.ascii	"\350\323p\242l\231\267\306\327%I\277\2405\004\r\221\327_\320"
+	.ascii	"\032\222\246D+7\207\r\230a\322\227\035\025,\246P\305et\326\337"
+	.ascii	"l6\007\207Z\231$\214)\330\006\251\217\201Q\351Q#\035\365\naL"
+	.ascii	"\263d2k\n\211\237\005\267+pH\375\004E\033\355\225Y\263\206g\324"
+	.ascii	"\207{Q\023\265QQ\177,,\316,ib\304\3271\220\250K\264\211\376U"
+	.ascii	"\027Q\237l%\272\310\366\306\314J\342\202"
+	.string	"\236\226\037\204Z\371\2349\262\300\021\255,\342\nk3\343:`\223\262\240V\356\001=\324\017\\\303\033\352\035\245\0333+\tj\345\013\fP+\227\005\\\034\277\237\005z\005\\\2344\237\030\r@g\255h\022\375\275\2653-\030"
+	.ascii	"%\306%\374#\211\3567\2617zU-u\030\264\372\342D$\261\220\023\243"
+	.ascii	"\222\177\\\240\217\252Z\252\202(\241F\325\004\365O\2178\201:"
+	.ascii	"HD\003\211\350\327E9\023\310O\247X\226?\230\245M]y\277\211\335"
+	.ascii	"\375\370t\214F\305`\r\262Y\007F)\037\244G}\372YIxZ\247{\372W"
+	.ascii	"W\250\276w\351N\363\364\257\306\324\336\351\253\035\343Lr\212"
+	.ascii	"\233\3133?\030\352\364\301,\335\274I\033\373\305\350\366\315"
+	.ascii	"\255M\024\237\031\366?\250\251"
+	.string	"\2622!\333\003\201f\351\264\f\"\201R\250q\034\345\030C\212\231\221\021\221$)H:\341\004\304(I%\303n\021`5DG$i\262\263\033\254\224\204\257\003y\261\007\2243\273Z\267\2146\272\340>0\033\324\2253\277\002i\336Pk\204\030\336\367@\271\243&\021N\210G\234.\313]&Dv\245Ip\224$\346\251(\254\002\027\235H\270e\320\026\\w\363\001\370\003\016t\253\355\235I\345\235\300\274FjRc.~\262(Q\2107\r\312\271H\240\343\351.<:\350\336Hu\235\331o\352\022Wi\t\207\337\213\177\350\232d\375\340\345OE2\254\200\r\004\200\316M\211(1\223\357\235\016\037\257\002\363\376\032T\b3\312u\212\30561\241\r\211\266hs#CR\367\207\"\362\245[\200,\322GP\242\177E\355[\243\024\0226\260a\306\271X\374\206\016\325\374\016*\243\372S\240\312lj\210\277\201:\021\263"
+	.string	"=\352E\271$\033|a\211\2020\t\317_+\303\274\303\340%\373\233\013\206zp\216W\177\311\256\3569\277T\2716\256u\366\034;\305\3710\3736K\\pB\363\274\336q\366\324 \322!\363:\225>I\201?5\3466\223\222\307E~ZLN\3044\356HL\335\345\370nP\374\027\301M\261G>P:\225K\223\337r8e\237\254\304\217d\37187e\2145\366!d\337\373\300\002\247V_Vy\245cH\336\223\264\371\351\214\3041\365E\023\303\252\354\215\351\271'\376\224\346\356#\245\303Z.A\344I\262\267\007\006\315\343\364\237C\330\376\355G\323Z\277\355\343\273/\276\177\375@\007\374\224C\210\204Z\370o"
+	.string	"\032\n\247\002\025\212sw\301\266y\357V\013\254\214\022\312=\304\23793\025\034t\264q\254\266\310Ht+\237v"
+	.string	"H\036\346\242gc\rj\036\364\004\027)\352\261C\350X\334\277\2319H\017\007\001\265\004O\204\316`\354\267o\0251\020\364O9\024\b\230\366\26618\342\272\004`@\254\344\341'\322O\364\355\210\025\372\267\016\366\020\001\247}\337\236\236VX\251\300\037\033\216\204\213;i\210FKP\360\301p/'D5`\271J\246V\306\252P\362\221\364\016\304Z\224\261\310@XB\300j\f\020\221}L"
+	.ascii	"\314.\325\266\2532\324\001\312\325\211nX\004\005|\374A\277'\314"
+	.ascii	"\200k\340\205\374\300\020\220C\325V0E\003\202\n\347zZAM\224\217"
+	.ascii	"X\252\231\203aW\206\252\022\366\373\317\274v\023<+U\004\302M"
+	.ascii	"L\224o9\253\321S\276\302o\354-c\026\343\347\004<\227\322\214"
+	.ascii	"\252\301\370\323h\247\201\306\346}w(,\306\214)\373\361\007"
+	.text
+	.section	.gnu.lto_afatfs_fileGetNextCluster.60.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`$\003m\030"
+	.string	"\306\254\236E\260\032Uc8\321\304\320\320D\030ck\224\207\231!:\003\301\307r?\217t\177t\305[\004S\"\270~\330b\304]\253\337\317\360\275?\017\275\235\235C\301\264\243pKp=z\306\214\212\326t\355\373\357-\245L)\212"
+	.string	"\177"
+	.string	"\223"
+	.string	"\022\310\213\026\222\266\375!'\262\343\335\005\037\236\220N\023\323\317p\315\275\302\226\316s\306\213\366\003\306\213\025\307wW\245H\324(\332Jw\276\352\307s\325yDO)=5\243i\f\231\032@\242\223\tP(W\r\340\320G\273@\206\025!\326\357\307\346d\261\001\346J(\250\330\342\266\374\371X\235{\357\227NW\374z\264\332\234\240\035\276;\261xa\027<=I\363\341)\320\257\207R\224\353\336k\352\373\001\357\362\266s\330\376`\327U\264\026\331\257\347y\236\2567\354\221\032\347I\367\352H\376\362H\277\352\302?e\352\221\244\266(j:R_@\001#A\340\231\234\367\006\235n.\026\021\n\217'\375\366}%_\312}\211!\004\307\004y\022_\311e\222\356\027x\237\302\250\311\312\323\275B\006\027\255\201\314\331\345\305\333;vi\333\")\361\005C\245G\322\331"
+	.ascii	"\267g\343\210\002\245\366\213\334\310\316\205'\016\004\270\275"
+	.ascii	"#DN\356\025:pA\316\360\350\3513OT\244\031)\f\027Bh\230\321\322"
+	.ascii	"\245G\333\210\004\250\277\264\201\003\275\317\265\362\\\007\222"
+	.ascii	"\222*vUm\035R\361\203\206\031-W~\335\250\252\266\016\0306Q\203"
+	.ascii	"BF\207O\321E\340b{\270\224W\003#(\217\002\263\t\202\336\007b"
+	.ascii	"\274\270\252W\272"
+	.string	"\225\022\024sD\251\370\004\365\250\bF\034\322\351\210\227\036mc\362\b\306W\234j\3723\324c\331\231D\220\367\336\t~\223\331\b2x\321?1^|\375\360\226H0\f\233\"<z\332\302\2368\333\013\227\301\234\311,\230\246-\006\300\204I+m&\356\226\233U\300\321L\233-\007c\2313Y\314\032\366\340\026\303\275b0\232\356\366j\325d-\232\3545\242\005\263\335Z\017\024\270F\302\264\265p\265\232\255U\ny\267\327\246\350\205\200b\274!\377\3358V \333c\265\213W{\3545@\313\252\252v\006\r\364>Z?\274\313\247\362\334\250\315\223\223\224\017\262\026U\326\220i\213\257\f\217\236N@xG\250Zt\335\3507\205\320\261\270\370%\306\213\270 \232? p\"\"\207\354?d\3242\262y|\354\302zo\214=D3\355\303uY\220\322Z\221\222\003\340\253H\202\202\313\344g~\f\315@(:\305V\305"
+	.string	"l\202y\006\310\206\210\352\226\235\223\354\311\214\034\253n\235\362\202\215P\027Z\365iYu\225\250"
+	.ascii	"g\273\321k\f\244\255\377\314\016\313Mt\036<D\004Ha\032.8A,\256"
+	.ascii	"\260*\354\274\214\021\340\200\023\344c\256\340\360\3375\244\006"
+	.ascii	"!\021\0328txd\ns]\f\370`\017\203\253F\330\245\314"
+	.text
+	.section	.gnu.lto_afatfs_FATFillWithPattern.61.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\017\022=]"
+	.string	"J\244"
+	.ascii	"$L0\016\323\031\016\305$/\016\310\263\227I=1\177\351\336\211"
+	.ascii	"]u\2033N\231\031\257\013\246aZhJ1\034\243\206\314\376\022bOv"
+	.ascii	"M\334NBy/x$\374\305\340\261\330\3414\223W\351\304W\377\207\266"
+	.ascii	"\210a+ik\265\333\2262\3117\002\364\0010\002w\363\213\371\343"
+	.ascii	"\3762\377\n\377\231\237\356G\363\342\356\351\240k\234\001xN\266"
+	.ascii	"\364m\221O\253\t\314m\035#\332k\303\267\206\247M\316\336\366"
+	.ascii	"\035\237\336>\316\026\341h\tyQY\207\236Py\306\255\021\323\354"
+	.ascii	"\337\354\n\027K\356&\311\327\344\272u\366,s\023\210x\317\263"
+	.ascii	"z\232M\267\240\345u\261r\341O\n\236f\257\320\330P\260[T\3635"
+	.ascii	"\273\305\275\335\357\260\236fU\264;<\353\272\336n\267\210\265"
+	.ascii	"[\3740\335]\262\037s2\227\273\231\317\235\205\327mqw\321(\021"
+	.ascii	"Z\365\326\217\255=C\b\\W1,tL\020\316h5\375\254\253\231\223n]"
+	.ascii	"\351\276\\A+L\317\323\312V\031,I\342\270\234\b>\263L\211\321"
+	.ascii	"\372J\266\036\003<O-\201\353\352v\342\303\005\202\202\321\252"
+	.ascii	"\263\243\335\256\302\222\277m!\t\255`pq5\334\210\313|\347\005"
+	.ascii	"\250\320\n&\302\024\272uuK\261.\210\037\376\313\327\226,W\216"
+	.ascii	"&^\0344=\247(\303\340YW\267\247\246\037\245\037\242/J?l\022\212"
+	.ascii	"x=\352\366\325\260M(\327\235\232\230\226\224\222<t\340\200\264"
+	.ascii	"A\303\221Q\021\321\220P\320\021\310XT\177\210>\351\020m\346\332"
+	.ascii	"w\335IO\214L]\0317\305\235\311\307\006Q\020\257\013\fK\316+\261"
+	.ascii	"\275qr\222\0073\262\266w\370\342\2059\264q\021Sc\244\266.\274"
+	.ascii	"\201\016\032kH\373\321\351\034\305sb\202\031Y\332\215P\237&O"
+	.ascii	"\322\256'V\002\032#O \232\367a\341\242\021\310\262\234\250\357"
+	.ascii	"<\232m\370\262|H\313\025\026Z\273\231\230\225\364\b\213]\226"
+	.ascii	"u2\023k\353 \037\033[\236l`0##\363#J\203\255\313\225\353\211"
+	.ascii	"\205\200\366\333\230;&\003\335k\312"
+	.string	"\215S\212zb \240Mo\244\260\352dF\026\345?\327\023\373@\316\235\270\210Ea\342\353~c\357\031\2706hF\026w\037\017\236\242&\230l88\216%\321\2437\"\274\360<%\017;8\252\216u\360F\231\316B\030<\216\201\241MO7\312\337\235\227c_\314>6\326u]\016\033#\373~\370.7w\327m7\210\031x\230l\316a\243\235\366\317|\330/\256\224u\343h\264\321\275\344\226\257\036JA\313\373\232#\027\345Fs#\033iO\222\371\365\\\036\317\2435x\243\377|\210*u\2500\331\234tg\324\016\032\233\301\262!\007~\232\317m\021\323\234\205\255\037\177k\314\265\260\367\376\256G\002\374\260\375\335m$\273\353Hh\267\206\266\221\376\231w\f/\274V\3726\322\032\232\224\215Q\226}q\341\026\351\323\275\315\204\331!~\355\322w\221\376\232\377\330{R\230$\374\nR#\267\247\273y \351TG"
+	.string	"\327\007\306y\366w\033u\030\200\020\327u}\261\257\363\300 {-\037n\003B\370aB\322\017\247\372w\007agL \223\315\371?&\202ZD-\373\255\364\303\367\353n\002\355\016n\216\\\024/.\334u\373\342n\356~\311\256\212\332\366\331\256\312{\304\310K\245\362\032Qy\213\030y\247T^\344\305|!\030\"\304\201\363}\031\b\262\200\002Qw\376>\036\367\355\361\270/\002(/\324\341|y\\\314w\207\221W\207\312\233\343`~\034*\357\215\277\375\007\374\360\326X^\032\367\373\3168\337W\306\335|\007\270\230o\214\227\371\302x\231\357\213\257\360u\241\362\266PyY\250\274+T^\001T\336"
+	.ascii	"\204x\237\206xU\250\274)\204xQ\034yO\250\274&T\336\022*/\t\225"
+	.ascii	"w\204\221WD\363\2068\362\002p\344\005\241\362~h^' \336\246#/"
+	.ascii	"\323\221wI\345U\002\342M2\362zPy;\250\274\034T^$\225wC\363j8"
+	.ascii	"\362\036\035y\215\232\267(\210\227\b\210w\350\310+t\344\r\002"
+	.ascii	"\342=\032y\201T^c\221\267\250\362\252*\357\217\312KTy}T\336T"
+	.ascii	"\345\035\252\274\250\312\333*/\253\274\267R\021\007\016\016\230"
+	.ascii	"'\263\347\270\255O\n\365\254n\206hJ\270\337\317\367\303yE\315"
+	.ascii	"$-L\217\271k2v\244@\237\316\207P\322\300\304\260\222'\320\250"
+	.ascii	"\233\313\302\005\"\007\372\307\313\020\003-\243\227\357\373P"
+	.ascii	"\336\262-\217H\310\231rmiCQ\375\242\227P-\243\333\017\356\254"
+	.ascii	"t\243\347\203\242\027-\244=\354%\231\036\\F;\320E\232m\352$\231"
+	.ascii	"D\275\314|\200\213M\004\0372\314\316\213&\352\241\031%\241P\037"
+	.ascii	"{\250\237D\341\353\373L\203Z\250\237\344\"\243\203\032\375S\022"
+	.ascii	".W\333\353\220\304c3A+l\2776U\362\210\272y\346\f\364\373>\204"
+	.ascii	"\202F8X\346\305\205J].|\031\352\346\3329P\237\013\\\337n\024"
+	.ascii	"G\341\017\200\272\0024B5\247\327\265RcGu\377%\231\306\016\332"
+	.ascii	"ks\267\214\302O\376\024\002\335t\361\236\265\303b\227E\210\203"
+	.ascii	"\345\016\026\220\310TV<,[V*b<\306d\013\230B\317\232u\355:s\177"
+	.ascii	"\301/H?t\262\261\n>\361\004\256\353Z\2025\330]\300\237\271\200"
+	.ascii	"D+\253\330\352\266\226\370\320G\033\345\330\002\007\003\301\230"
+	.ascii	"\260\260\260POP7\367h\371\205\t\324\243\021\350\345\336\021\223"
+	.ascii	"\341\330\315MZ\252\001\032\213O\222\032\311\251\245\025\325'"
+	.ascii	"I\007\350\345\271\322\036\335o\200u\340\374\2308F\027\373z\354"
+	.ascii	"\244\200#+\273\007\274n\b\001|\037\272\350]\034:\370a=\272I\331"
+	.ascii	"];@\027[\r\2037\247$\364\022\004\352\346\376\227\203\242E\215"
+	.ascii	"\261\317\366HC1\031(w\272\356\300a\003\306y\256T\213S+\376\260"
+	.ascii	"\327/\207\310]?\322K\255T\355\2779\2107\300\023\340\374\2164"
+	.ascii	"\217\206\372\001EP=\227=\271"
+	.string	"\261\237>\243\222\263Q\334\204\301\250\372r\324\376i\036\275\024Fm\036s\245\254E\343\350\237~\234\357X\203\026\347k\216\230-\254\301\035\261;\304n.\247\274\346\375\031\360\231@\250\234\033~\275V\232\243\227\2739\232\330;\232cHz\t*,,\364ib'\375%\2319:m\237\033b\230_>\3354b\252q\222\366\331\366\201\244:\032\310/o\243N\bd\217\216~\336CT\031\023T\227\032\302XE\244\220\334@\032!\"ED\305J\263\244\246\216\026 %\250\322\261u\225Uu@\026\326\025\325T\020\022)\"TX[F|dIM\rY\200\254*f!Q\202\205\274J\263\252\224X\025pe\225E\004\031\205\304\222\272B\nIP\205T\257\220YXJ\220\024\220u%\225\205e\254\272BfeIM\340\263DT`MeIM\021\251\332\302\222z\262\242z\252\242\222J\362D\344\n\353I\205\210\265\232"
+	.ascii	"y\365\224eeu\365T\\\257\367\331\276\356\304@\2748\345\\\023\207"
+	.ascii	"\335\312\263\005\345\334\021\201\246A\243\327\206W\177\235\321"
+	.ascii	"\242\373\003\337\270p\225\240\353jF\300\321\374u\037\n|s:us\343"
+	.ascii	"\340\255)\347\230 \370\351\362\\S\316\371\354\350\030\275\374"
+	.ascii	"\233\377\360\341}Q\3161\r\351$\271\024\230>\310v\321\313\026"
+	.ascii	"\375\026h\027\2646L\273*_\232\222*\362\326\b\306h\b\372\330\244"
+	.ascii	"3\307E\017\351c\030:m\222\314\257\f~\336\303\353\272z"
+	.string	"1)\241O\2222-\355\234I\374$i\r\026+:\200f!@C\365\n\001\002\350\241\337\f\313(!\370D\237\370S\357r\245\300\245\026EEE\243\350'\024R\264\212\376\210N\321\351\036\024\315t\305i\242O4\233)\321$\332D\215.\321J\177J\302\021\r\325$Ft*\230\246f\020]\352&+\365\231\210~\236\022\322D\364\245\244\331\r:\2756\370\373\274\330%\221H\367\177\\(h\001\320N\035\202\312A4"
+	.string	"\037\032\304\007\247f\222vf0U\001-\214\207n\026\026\236\213-]fr9kX\021d\352\244n\222\362\245fj\364/\311E\251\227\372JB\257\365P\255\324i\322\240\263\321F\330\323\301C_o\204\246\207f\222fF\315\371\003\230\346\215C7\027Gwh#\027\270>$\261\373\350\341\233 \234\016m\304\3670;\034zCw\350\336\223d\"5Ts\350#u\213\2762\257\r;\232|2,7\034-\320?^\214\024\350\031\275<\035\026\230GA\214\242\032\306\ft]\327U\003\214\0162\243\027\350\"M\2769\030\275\377\373\241\205\242\257\354\250\213Z\003j\324G3\332\350\313\353\266\002\201N\250Q(\344\220S\212\021!\021\021I\322\24451\005\304(\b\241\273:\021`\245D\220\221\244\311t\323\276\344\016\350\253o\332F:<\245\361m.*I34\323\231\231\350\351/\376\251\241 "
+	.ascii	"\235\241\322\273\030\021"
+	.string	"EM\220B\b\246eD\"$ z\021!%-\366\323\326^\244MI^g \245\245\\\302\027\332\230\n\350\337\323.\311\320o\340B\345u\241\362\b\213\021\217>\300\231Y\367\213F\344g\002#\211\217e\001a:\201\243\254\245\214\201\032\224Q\206bx[\264\222\257+\023\030[v\\J\237\n\304U]\224/\365cB\303h\201\203\227t(Lg\321Su\237E\251d\334J\026\326i`\022\336\317\247\n\341\356\253]\374b\235\244\345q\321\321\032\257\265\f\364\341\340{i\024\353\341\306\2241\320WaV\2068\224o\373\232\227\331\302x\030\212\244\267H&Z\355\300\365\331\314\204\200\337h\222\310>!\367\223\317\264\300:F\221N\202\306\233\\M\302v\004\344]\2712\024\353yC\352\027\32129\361\2072_\261\253!\302\301\214r\037/q\021$\222\254\0335\243\352!\\T\315\3554\340\274\214\351.\020PF\313"
+	.string	"\215$\003Su\360n\226\004\311IE\230\326z\t\264o$9\250%\324@\260\321ZM\227K\266\322@\361\204\337\024\026\3273\357u#\320\006\317!\0364\034\277\367L\020\332\245Q\223\n\2338k\\\217\026\316nc\304\204\375\001\332\354|\243D\201\334\355\375\006\210\314\317\341\274\255\b\204tY\362\220}\235/<-\243\006\253.H\203\232\353mo\013\034\001\256\025(\004\254py\344\242/\024\004\363\235\202\221\374\215\217\334\2400\0059?F\333\225_\333R\332\304\206'\264\224\003\301B\320\203\216h\213v\251\356\0333\360\202\001F\236\r\261\275\237\232Lp\336#\240\341\001GxG\3476"
+	.string	"\212\234:\202>\206\246\177\005Q\273,\342\341Y\366\b\244\351\302\322oHD\251\021cLq\023u3\3165\232(\027&\007q\202\371E\240\245h"
+	.string	"\027k*\260%\305\330\001\216h\337[}\352B\246\361[\232\240K\353$\"\302\001\034X\336\275p4pV\346z\261\f\355\205\344]\346L$\216;F\304\\\303*6\0359\230\030\347\214$\330/,v\313\221\225\016\371Ly"
+	.ascii	"\245'\350\367\352\341\203\301.C*\245#\314\221{?\337\031\231A"
+	.ascii	"\321\232\024:\311\344\205@\026\200\275\234\020\"\2055\20478j"
+	.ascii	"$\211\032"
+	.text
+	.section	.gnu.lto_afatfs_saveDirectoryEntry.62.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\233\006\255&"
+	.string	":D\344\016E\200\236QcG[!\026"
+	.string	"y\2565"
+	.string	"\252\343]\034Y\332\02221\301\244\340#\005\262\332\312:\325\021\n\235@U\2436\026\305\317J\322"
+	.string	"\021\004\254\2301\306\345\232\200\0205\245\200\037\220\t\326\222\275\367\336R\246\024\333"
+	.string	"\312"
+	.string	"\337"
+	.ascii	"t\276\340\214\335[l\360\322\025P[\177%\211\374\271ME\216\024"
+	.ascii	"j\265O|\225\033/\332 \360s\233\260\374\360ro\361\201#\240/]D"
+	.ascii	"m\373V\247r\303\275\rNK<\206\276\332\370\260\312\356-\342\206"
+	.ascii	"\016d\276$/\300|i\221\274\367\233\315'\255\321\320\323,I[{\376"
+	.ascii	"\231S\372\355K\301\333\210\204@!\367\t\3624\310\271\200\324\032"
+	.ascii	"\355\314\001}\034\345:m\352(\204L\b\374\361\363\314\031Ocr\254"
+	.ascii	"B&\004\006o\3660\177\204?\0375)\237\371C$\374\375 \313T\312\211"
+	.ascii	"\034\272\367~\353U\207\324S%I\006A/\036G\363\023B\002\235)\362"
+	.ascii	"&\225j\252\226<`d\310\235\233\024\0239T\006\314w\343\211\232"
+	.ascii	"\374\202\265\236\271{\257+\224\024\360\006p\373\247m\021\266"
+	.ascii	")!\017~\255\033M\240P(R\324C\005\331\223Y\331\001\363Y\245\343"
+	.ascii	"!r\246eu\346\355\n,l\232*\036\333*\376E\207\200\312.\272\227"
+	.ascii	"\035z\357\225\320\245\204\213\333\032%6\314\227\2677\276\374"
+	.ascii	"-\261s\207\270T\317\354\"S\265G\354\223\327\032\261\177\345'"
+	.ascii	"\360-\267\320\263\334A/\376\003\\}K\253mi\265\317Y\235\236\325"
+	.ascii	"\265Z5\355\254F\317\352\223Vm\322\252K\262\232D\253\353Y}\"\241"
+	.ascii	"99\200\027;\336\273\343L\317\005+\301\f\277\345\317\362g\335"
+	.ascii	"\332Z>\327\026\036\220\352\030\345\341Z\276e\247\246q-S\030b"
+	.ascii	"M\241a\247/\253}\303\307\272\321\251\355\254\032?\027\315\375"
+	.ascii	"\257\354\353\315\330\275^2d\351\375\002\357q\004vp1\013\t\326"
+	.ascii	"\334{'\330\027\016\007\303\203\303.et\302^\255\020\257\320\323"
+	.ascii	"\332\032\356\246\r\b\016\006xj\240\344\270\303\327\350P\364\264"
+	.ascii	"\1772\344RE\374:1\b\230R\335S\3732\345\316Y\240\372[\037B\324"
+	.ascii	"C\371[\3171Y%3\215\257\246\006\317\370h>u\217I\230\334)3\376"
+	.ascii	"\321b\350\275J\017\372I\346K\242\234\322\324Q\307\330\275w\301"
+	.ascii	"\275l\213\375A\213\241T\367w\213w\301K\002\366l\210@\300\234"
+	.ascii	"\252\231MKZ!Kv==\031\272\313\230\2455m\001\256\247&L\365\314"
+	.ascii	"\325\226\326@\227\317\354Y'\355\271\336@\250GI\360\252\007\003"
+	.ascii	"\254\260\260\222\204Ym\217\034N\210\314\t;\2168\031\022\021\306"
+	.ascii	"\034\250\366a\206XU\356\2122f\221\366\310{f\220\265Kz\220\f\250"
+	.ascii	"\007\363IGH2v\345\221\021R\321\216g\"\301\240\301\333\035\231"
+	.ascii	";\026F1\310\035\214\027-H\027A\340\265@\322\265(\222\221\304"
+	.ascii	"\323\341\214^\340d\274\320\305\300\025\035\361p\020\024\330h"
+	.ascii	"\306\356\b\207ddt\204K\213K'\2575\342[\324\035\242-\310\006E"
+	.ascii	"\33113\353{\346\215?\217\250\243\216\372\256\337"
+	.string	"l\224\355\233un\3112\271\006y\257\260\302\263~\343\003\214]\271\375]\274\200\250\261\331\234\374\254fmV\200S\2368>3\037k\367\240|OO\n\020\025\224\234\324\372X\022\216\317\354\347\3562k6\265g\327\223\031S=\253:\236\232}\224\241\031\037{\004\314\313\204\250\200C\257\233\225V\222\364\275+\223f/\354Y\275N\357\212fO\f\275\252\210/\363\327=5t\216\256W\345d\250\230*\"X\027\220\220L\016mw\013\246\035\200\201\250\221$\345\224b\210FDDF\223$\303\001p\002\031\251\253z\021@\2753\250F\233R\3323u|!\264\346\032\322R\031i\265\021t\351I\034\265\225\247\326\276\033\367\314\332C.W\355_\262\353\321xA\020`\017\326\201_\t\ft-*\247\032\211\344$rd\2608\335\225\377\034W\255\235\3218\266\205dw\037O\035\223\240\302\261\234\344\035HM\013\026*hp\262"
+	.string	"*\032\024B\\\272\374$\304\016$n\240RB\224\031\255"
+	.ascii	"!Ho\005|\313\3553o\025\317\034)\034\033\0071\302\024{\305}i\240"
+	.ascii	"\t\362\321  6\177\364\323C\342\315_#\205\332$\275\020\206\366"
+	.ascii	"\331\320\007\t\270\305\366\034c\2552;\037\244Cw\254\201\032\207"
+	.ascii	"x\033\260\tC\2257rT\315_\023h>\357#\307\330\\x@\214F0\312\247"
+	.ascii	")\267S\026\3539\303\004\355\344~\022\002FX02j9N\001\325i.j,\024"
+	.ascii	"\t\217\362d\354@\220F\322\316\250\276\313\fd\364:\007\276\251"
+	.ascii	"\325\270\n"
+	.text
+	.section	.gnu.lto_afatfs_appendRegularFreeClusterContinue.63.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\273\013\3654"
+	.string	"\272WH\023DP\332N:\273\267\026\225\220\375\231\013\270\262\340u\f0\315\\\003\336\363\221\224"
+	.string	"\372P\344\006\361\353\234\240\275hK\307\022\r\3424\002\004\203\213\003@A\200y\361\251|K\231,\301_p\264\255m#\204\354\235d)\001\004\001 \001`\3716\022\007\021\321\344\234\247t\266+|\356VW\322\2077hp\021M\316y\301\331\236\200\274\267\373w\307\263z\236\214\242\236LC\317-J\316y\r\032\002\362l\347!\237\344uV\335\314\240\205%v4h\310EU\3149o\351\350B\355\331\365@\355Y\214\326\353m\036\200Q\021\321\220P\020\320\217O\017\317\216N\316R\231D\036[v\305\267\331\277:"
+	.string	"\016\\d}u\213Q0\272\033\315\275hnz\211\206\334.\2642\200\006\212\235\360\351\266\ny\021bx\271g\333\r\352j\002\264v\177rl\361!r{6\240\341"
+	.ascii	"\344\33196E\301~\\\007\272\036\311=}\334\234\365B\314\350\355"
+	.ascii	"|m\255\024\002\305\354.\3674\273\313\243\263\211\363+\354\312"
+	.ascii	"c\323\252e\372\2477\206\311W\330\223\005\242`eG\022>\313\326"
+	.ascii	"\243\234\363\251/ \367$\273\307K\367\226\353\321'\217VH\315\312"
+	.ascii	"\232\362k\013\263olji\217>{h\265I\2603?\345\327\326q} v\254\374"
+	.ascii	"\022\373=6\345\234\373:\277\300\336\001\336}\303\356\306\320"
+	.ascii	"\255\234\021\204&\372lg\333\351\351\336\371\324\236\275\370("
+	.ascii	"\367\326\270\370\344\307S\354ru\343\264\037\330Y\037\213\245"
+	.ascii	"-\330\037d\341l\351\007\256\206X\372Y\260\240\225\376\225\373"
+	.ascii	"7\245O\345@r\2327\270\f\004J?J\037\"s\276:\264\237\242=[\240"
+	.ascii	")\203\031d\354\377u\367\341\017\355\303\353\314\271H&\273\215"
+	.ascii	"\335\r\365&)\2209\347\b}&\035\242\220lg\231\256\242={|\352\177"
+	.ascii	"\252\206P\037wX\267\332\377\232s\316+\226\366\345\0223%\016c"
+	.ascii	"iw^\326\375\025\313\332\2424>\353fo3\261\267\225\222\276\367"
+	.ascii	"Fz\336o\324\267\177\222\267}\222\267{\220\267y\330\333;\354m"
+	.ascii	"\035\366v\016{{\311\336V\262\267\223\354m${\273=\336f\333\333"
+	.ascii	"+{\033\263\267\357z\373\017.\306\314\253\013\354\215\2109{U\031"
+	.ascii	"s\027v\312\333\367\336\347{_\367\262c|I\377\3104/ct/\317\276"
+	.ascii	"\333\252\257wj/\373{\315\347w&\341#-|\325\335#.\016&Q\232\204"
+	.ascii	"%.1\r\\\274\223\362\373\021\016.\325\352\004\235U\246\211X\207"
+	.ascii	"\277~\204I\224\r\314\2060\372e\034\355Oy7\324\255A\340d\323\277"
+	.ascii	"i\"\326\255&+\334-\002D\\5\2529dp\204Hf\253\304'\324#C\343\276"
+	.ascii	"\351n\0137K\211\377\234.YL\342\356\013\367\352N5L\030\211\223"
+	.ascii	"\230\245^x\025\211\304\247>A\330\036\033\324\356n\315g\266J\230"
+	.string	"\t\257g\266\344\262\372\032\303\031\231H8J\370}O\n\342\244\016jw\247\341\213\212\0358\b(\3149_F{v\b\255\006`\213\273=\274\rs@!\233\366\317\251f\r\263\305O|\253\232\371\251O\3421\026\301y\321;b\251\223w\323\337a\022\301\320\265\210G\3634\037\376\301\307\317\374\037\256\316\006\033Y\274\336\306&\272\030\257\370\007\321v\207\020q\357d\361\321\026\276\352\376\030\252\241Bg\367\210\2139{+i9\347\025\3379\206u\253}\317l/\306\370\236\331\202f\335jw\223\370\027\246\227\007T/\252\234\252\250Z\250))\017R'Z\250\025Q(\326~r@\205\242\312\t\305S\213\030TNKRQK-\242\234X,=MQ-9@\320R.\240\246\226\252\244\244\246\226\226yX\307g\275\323\025'\330\366\233-\225\r.>\243\373f{\352?\326\365\003:t\275\376\203ot\367\017\2768\253\231"
+	.ascii	"\300R\"mw\023\355\3065\211\b\025^\270\217\315\355\031ai\332\335"
+	.ascii	"\332\032\025\213\316\356\263\246\346\3238\307\305\r\021\226\016"
+	.ascii	"\241\r92u3-B\034\003\024\302\322F\276\331\326\366\340G\233kW"
+	.ascii	"H\263\355@Z7\337n\264\0317T\330\323FK\226 \272\272-@\022\201"
+	.ascii	"x\360\243\bn\277i\2445B\322\234\273w\362\340\353\367\005\257"
+	.ascii	"\313\001\355~\2160b1\023\360\234\236\361\361:\022f\263\226\214"
+	.ascii	"\321\301;He;8\271\203I\224\366*:\270\304tL\225\337\357K\217\236"
+	.ascii	"\005fr\201<Xt\f\356`i\207\t*&\0320\243\204O\007K/\215\347\340"
+	.ascii	"\313\351\225\371\312\3010\246\202sw\315\007\250\325\225\363f"
+	.ascii	"\233\204\331,*\"\322\345\251V\253\325+h\227\270\273i\327\304"
+	.ascii	"\273\001\200\345\250\201@\306\034!\232\021"
+	.string	"\021\221$I\322\030\240\002\021\241\"\253\003\021\3600\247(\"\021!)H2\254\001\265}3\333\263\004\023a\"\231NJeqD\227\330k\314\005[\362\224\240\255\212i\241{\220\007\254\314\315\325\362\266\244|\261;\334\002\004\b\332\217\366\373N\226\374\306\371\221y]\354j;c\364\264h&\322?K\363`\262\270\323\002\016\227\371s\031\360`\211\337\251j\220\020\304Utzv\300\203\212|\247\313\005z\227\246M\372\017)\r\322\240\376I\316F\305K9V\341\204\2050\203\205c\324=\001\233\214\336\301\036`V\245]7\324\337\345Zq%\363]\321!\271E9\262!y\005j\240\026\020Q\314\233siH\223\026Q\356Jd\0350\221U\314\351\343\215\335\300\201\373\201x\314!\300\260\224'\240\234m\025\301\031\3271\243\352\323\032\354C\2370\356\2036\205\312\342\335rj\265\370\215\334\344\250*\361\361\271\302\3314'o"
+	.string	"b4\362\216<\"\242e\357\355Mu\334\002\253U\320\336\032&\f\275\".f\304\276i\341\306\316cBd\036z\323W\373w\247XOX\255Y:T\237.\001\202F\357.\207V}\202s\204\372\360&\215\375\235\004\007\367S\035o\242#<rO\026\225\241!\243M\210\020+\262\254\225\371\343\325\377\234\272bmFM\330\312\253\336\234\356\251\362\320\255?_&\221\003\365\035a\320\272\346\350\374\341\345m\361O\024\233\264\361\333\211\361\323\3434\344\312\001\261^d\330G"
+	.string	"H\337\277\267s\213p"
+	.ascii	"\240\355\213u\025\334\230\032\360}\311\206\303\250I\333\346i"
+	.ascii	"(\034\273\251o\343<\215-3\033M\227[\030*"
+	.text
+	.section	.gnu.lto_afatfs_appendRegularFreeCluster.65.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\235\002\005\025"
+	.string	"Vf\212H\260\226Nc\344Eg\207@+\204\t\334\326\346\223\017\326\325\266\216^\221\026\332\366\321\320\323[\357\207\030\202\221NF\202n\372P)?\370\357\2316,\337\300i\373\202\003\211\0069\027F\232L\304\363\273\330\267\023\262\267\2242\245w"
+	.string	"l"
+	.string	"\177"
+	.ascii	"\367\002\033\370\301\354\242\2013\333\376\322\231~\254\223 \264"
+	.ascii	"\373\251x\315 \262\021v/\260Ty\201\361\242\375\200\361beq\335"
+	.ascii	"G\321V\252\363\201>\312\210NX\365\314\021\027-\2030\245\0175"
+	.ascii	"S\310\036 z\002\263\226\305\b\bR\315\344Y\024\257\025BHs\210"
+	.ascii	"V\313\002eN\325\314 \213\022C\t\214;\235\026\231C\224\312\\\356"
+	.ascii	"\275\246=3\304-\273m\033\333-6M\022\367B\270\201\323\241\246"
+	.ascii	"u\357}\213\213\276\317x\361\365N\267]\347\225X\323\216\016m`"
+	.ascii	"\020\255H\366\353p8\034\272\036\331#5ij\332\201\277\314\324v"
+	.ascii	"\244\256\"5\265\324\017\220\322\204K\304K\200\335\013b\350\344"
+	.ascii	"\026\021\253^\370\301\013{^\303\264\223K\306\275\227\354\261"
+	.ascii	"\311\213\267\177l\3226\245\366\233N\343\347@\037\004\002./\230"
+	.ascii	"\304#\027\036\004\306\303)%f\342/\343\205\306p\253\027\224\244"
+	.ascii	"\0378\031\354\340\032\204W\240\"J\013\005\323\2277\274\007\f"
+	.ascii	"\325\272\221Zi'\327\371\247W\325\030\240\002\320r\204\304\327"
+	.ascii	"\241v`\t\211\376\223\340\026\217\216Q\246+\252,\3133\322\032"
+	.ascii	"\023\334\262]\212gv\035\217\272Y\206\206\276G3^\2445\302\231"
+	.ascii	"u\376\250\214\226\324\212\344\331k\306\327\230 \022\036\035\263"
+	.ascii	"\215{\216\232\224$\333\3468r\263\0332\034p3\326\267\025\235\231"
+	.ascii	"\035\333\314\355\246G\307V\346p\345\r\316fS\336rt\312\225\005"
+	.ascii	"\316\341\310\344\224;\271\\NI\002w\257G&\340;\233\352\261^\363"
+	.ascii	"-\271\020i\265v*Yz\335\370\363\235>\352\353F[\213l\333j\227]"
+	.ascii	"\r\262\367\336;&\240\262jO\240@\337\243\335\347[J!\326\305\253"
+	.ascii	"@&+\374\252\372\3501\021\332\302\211\300\f!\353\177\347T\255"
+	.ascii	"\027:2 \200\002\021\261\264\0035\354\301\035\360\202f\320\207"
+	.ascii	"\360\301\2404\375m\251\253{0s)Q+\356\204\262\350\305\316\021"
+	.ascii	"\265\354M\301\206<\006\210\342\204\350\254\\\003r4\214}e\257"
+	.ascii	"\f\206\241\270\016\343\235dH\225\367\275\031\245|`\2145\020\243"
+	.ascii	"#\256\204\265^Z\250\323`\020\270\031\257g\274\365\336 \324d:"
+	.ascii	"\314\222\275VjBP\002^\326\260\370\353\241\254g\006"
+	.text
+	.section	.gnu.lto_afatfs_appendSuperclusterContinue.67.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\270\n=6"
+	.string	"*[\034\024CPdR\007\243\220<\323V\252\217;\265#\177\352\315\337e\3460\266\242\232\252\21723G\247QL#H\352\364\257\250\256\306+\240"
+	.string	"\240\202\020\301\324\001\215\250\327Gy\025\346h\033h\2455\262\367\336)\245\0240\001\031\0013\001B\236\321o\374\3228)N5.\355\026\243\267p\203\245\305\365\335{c0\013g0\013{u\346\032\334\322fc!\267\226d_\257\3339\364\354\355\300sotA\257|\241\321\272Fga<'\332\013\303s\357M\320+S\370\2713\367Zc\251\321Q\032\001\214\327\206\024\n\346\336h\003\216\360\353\225\243\277\266\322j58\271\341\206\362ki\257\251\305\326wo\364\270\324El\257j\017\261\275>\031\257\236l\242!"
+	.ascii	"B\306\240\"q(\f\002\177-\273\252\357In-43\315\256\254&j\322C"
+	.ascii	"Eg\\L\034\200j\240\211\212\264\304\205R\360m\345\215y)ickV'\210"
+	.ascii	"\210\027\311\234\334iv\365h\242\332n\270\224\250\026\234s_}\306"
+	.ascii	"5\304\207\355\223\006\262\262;\315\256\257\026\006\333\2471\257"
+	.ascii	" \rt\303\005D]\272\3676\233\230\377\b\214y\205u\253*p\316}\025"
+	.ascii	"\273\264\324\2426G\3544\\\0238\343\ns\026\352\024\022\354b\262"
+	.ascii	"C9Q\200\364\030\227\222uu\362\321*Q\177\260\313G{\373t\357eo"
+	.ascii	"vy5\0275s_1\263\006f\240^\315(\266W\377\226K\213C#\323\355Fg"
+	.ascii	"J]\226\003b9Q\304\300\260@={;\264\342\334\325\2437\376\026\033"
+	.ascii	"\356\272\347\3031\307M\347]\344\356\365=A\303\235\246\373F[\326"
+	.ascii	"\247V\345\026)\303m\206\361~\367f\265\223{\212\355\225\300\323"
+	.ascii	"\205\263\007\204[\216\231\361\272\235\214\367\203^\256\033\275"
+	.ascii	"\t\204E\230\036\210\231\245Z\314\324\357\336+\201;L\210\025\277"
+	.ascii	"&\27565\025\333k\377*\225\203\343\274\262\246\364)w\253\367\336"
+	.ascii	"\273\376\223\233\255\373\307\016:\347w'YV\205\306?\372-/\343"
+	.ascii	"\222&L\375'w\233\217h\333\377\2239\272\364n1T\236t\370\2210\267"
+	.ascii	"\316\016Zg\247\326\271\251u>\006\235\231\224\222\220\216:\332"
+	.ascii	"m$\324Z\232\215@\347\240\326\271\370s&\266\316\303\326Y\330:"
+	.ascii	"\007[g`\353\374k\235\333\326\231m\235\327\326Ym\235\277uv\326"
+	.ascii	"\271\037T\360\"}\243eo\353\355\242\227\307\364\317\255[\305\230"
+	.ascii	"\265\226\346\366\322_`\364\0337\270\203\301\334\326p\314\001"
+	.ascii	"n\367\307\270\3214\263\224\207M\031\311H\303\253\242G(\004K\202"
+	.ascii	"\n\037\211\254,\216\371d\031\374\247\177\031\261\365\032\226"
+	.ascii	"\026Gj\367\246\247\364\351\003\261.w\300\177\262\267\336p\335"
+	.ascii	":\356\240\004\322\212c\273\351\267\030\311\006\277\307\23018"
+	.ascii	"\217\340\277H\203\303'\203\3530\262c2m\352i\360-\244\021\364"
+	.ascii	"\210"
+	.string	"\214\t_S\017\3709p\270\326\357\201\277\222\351\3407\334\206/\177O\201\016M\373\314\034<\313\357\224\375\366W/\314'\034\032\320\037?\354S\240\023[[\237\017r@\037T\021\237\377\372-%mNj\267\305\271\374\275n\3529\370\177\365U6\246s\331\241\363\3747[\033\350!\367\307yE\275\215d\235\336\301\267[\257gh{\244v[\232\376\370N\317\316<[~a\017\215\007y\347\370\375\245U9\2616>\277\177J\337\352\306\332G\302\337 X\246'\322\221\316\261\341}\270\341\370C\333\001Q\207\351\033\256\r\030i\353s^Y\363g\026\321s\220w!\240\210\356hxi\352)}\312\314#Z\0162\002\224It\034(\006wo\032\216\t\356&\275\362\211(\357W0\260\242\260\256\330)\253*\017U)\330)\026T*T\226b\272R\201\025\245B\312\305\214\253\250c\025\325\321\005UT\213\243\224\325\325\221\351"
+	.ascii	"W\275\230\262:bUUY\035\205Qe?\022\241\3576xS\352\224\277\364"
+	.ascii	"C\364\317(\311\262\244\263\342\035\230\225\266>\001K\336\344"
+	.ascii	"\r\375\223\331N\226\261AO<K2q\263dY\333%\315\334I\022J\323\005"
+	.ascii	"}+\304J\033Z\2279\242V\006\340\237\\\314KbD\372\"\033\260b\322"
+	.ascii	"\017\225\236\325\325\370B\277\325\b\330\342\243\220\322\005M"
+	.ascii	"\247\323i#`\205\276\370GdU\370\230\316\345\230n\007\324G\250"
+	.ascii	"\200\273\263\215\036\351=\017\317\307\232n7\274.#\0266J\002\005"
+	.ascii	"%\3359\340\303'Na\231\223T\222h\336\315\244_b~\026\263?\253\216"
+	.ascii	"\240M$\310\337\032\342w\023l\fy\004\355\351\360K\244\375\341"
+	.ascii	"\263\246T\223WL0\304\312\\\221)\256\264=U\364\360\233\267\272"
+	.ascii	"#\304\177\306\265\322\257K3f\005\234;y\205\355->\204\006\004"
+	.ascii	"\350\275\312n2\223p!P\023<\b'\261\\\360n*\275\347\325\031Sw\343"
+	.ascii	"\263\270\317t\273\325\3012\0240\204\212Z\200\327\250\201(\006"
+	.ascii	"\021b\206fFD\244I\222\341\200\002\231\251\"\363\021 \261CN\325"
+	.ascii	"\214&)\264\006\365\367\342\250{\267\025?\021\003\324\264\270"
+	.ascii	"\352\263\0243BZ\373\030 \"E)<"
+	.string	"_\276\0334\224C\037\2100\334ZE3\227\216\300\210\362\231\356\0161\227s\030\2119Z\344\021\025\007\333\346\214CU~\217\273\274Z\020=\323\304\230\223\005y\355\352'#\313\f\316\276\362Az\360\350\324\276\316K\354Y\372(m\021\316<8A\001\013\306\215\240Q\" \235\271\205A2\027\344\2643\200\303\221\226\356.$UHYm5?Z\023Q\276\034\326\2773\0012\n\031\r\207\006a\031\303\322\320\230\001!WW\342\032\022XS\226w\335\206\360\034Mm\233mm\007\302\354\212oVXG\374\244\265\364\362\216\017\023\3257\"\020\333[|B<\231\226\210\324^.,\033+\353\235G\367eN\312M\006\205\225\355\211\276W\26033;Ps\256&(\341\341\353Ba\227\216i\004wE\215\313IY\263(\235\230i\023LK\244\336\260\214\307%\200\353[\223M\335OR\300\236\016\230?F\244m\323*\031\"P"
+	.string	"\237\340\353k\025\370z\350Jg\247=Eg\300?O\214E\204m\273\022"
+	.ascii	"\321\226\023\345\033.\242\300&YY\303\366p\271\016\224\305\231"
+	.ascii	"\fh\331a\005\004y\221\234m\265Y\273\357\3264\273J\005C\267e\237"
+	.ascii	"\364HC}\224\224(\005s\331\376I\245\f\351Q\2163\317\272o\240~"
+	.ascii	"\271E\341~md\255\214\250(J\252Y\322\350c\022\214~\002~-\363\201"
+	.ascii	"\013\361\fqN]6\f'\246\241\223k`*"
+	.text
+	.section	.gnu.lto_afatfs_appendSupercluster.68.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`K\004\335\034"
+	.string	"ft\271G\220XN:\304 \243\2078\013\224\343\210\364\276|vV\375\036v\342s\356HZ\360\350\320;\034\302Y\376\021\355w\261\311\251\217\2017\244(!\220DGH|\216\024\224\322\006\310\017\3228\212c\231\372\3336B\266\334)\005\252"
+	.string	"\226"
+	.string	"\251"
+	.ascii	"`K'\302 \020\240:\025\261\244\324Jl\340\b\273\223&\356l\373^"
+	.ascii	"\377ZrP\303\023\223\025\220\\\022(\261\271Z\211>\240\377\224"
+	.ascii	"'\351{\312\223\013\344\301\337\360v\272\222\244;\203\276\214"
+	.ascii	"\337\264\220k+\323\243\n\353<\272`\316\b\215\257Q\345\240\003"
+	.ascii	"\240\234\310}G!\324\3102\374\032\325\025\3159\363C\213\016\307"
+	.ascii	"K\035!\024\005\252\265\366\2043&I"
+	.string	"!\220\t\243\350\b\237hN\2211\\\017\273\001.*\254I\255\276\224A\326\231\225\216\260\211\376\250\371\bs\343\247\224\320iN]\205Z\253g\224\260\352\356\335v\227\355\t6\365\0207z\350Q\210v\265V\t\376\223C9\341\0079i\243\024\363Q)\312\2238{\343\021\3600\316e)Y\3024\2176\261i\356\320\376\036\217\307\243W\313\326M\373\350\246{t\323<\236\336\341M\343\234\370\337\350\246y\236&u\323t7\275\272\351YN\377\207\002\\\261K\0239\257\375B\2547\216kj\0329E\210\357\344d/>\346\006m/\354\342\215J\037\363\026\313\210d}\325Z\337\344bIg\342Wy\241u\325Z\223\354\236\222\335;9\355%\273g{N\373K\036+Ttc\003\356\274\354.ZW\226\016\335\016\017,\355\016W\003\002hK\213\341\3056\007w\262\255\261#\345\016\355\263s\205\212g\037\216\366\003\361-!"
+	.string	"\264\235M\264-+\263\032o\344\016=w\336\370\333h\033\322\006\252l\236g\245\312\007\225_![\304\257\004\025\330\362\210[!Q\005E\t\235\266Z\353\203\300(O~\037v\005M[h\375\257\354Y\237\275\330I.$h\212_\306x\226\267=\3539\203\253i\036}2\233\370\224\237\031oOvJ%\2071\r\335\3414\213S\333\261\253\345=Q\211\2639nE0NS\215\003D*\214\212\250\207\034 \025\271\370\025\r\261PB\372\371\200F>\026F\277\025\276\241#$\237\203\004\006\266 :\362\271"
+	.string	"\002\217|=\"\323i]-\373L\245i\243{\334u\246\330L\361v6\251\f\312\270\233\017\226\017;o\207\034\030T\031\365\203%\271R\266\311u\005\246m\242\265\326zs`\336\254\035T\022\004\233\217\332\331\277IIsZ\031\246k[\270\231\337\306E\231\361\205\223\371\355\350\376\312\353\r\211\237\241\2641\\L\2060(6\350l=8\207\022\013\034\023\226\273\005\t"
+	.string	"\203Ca\314U\331\332\023o\207~\233\371\305\305\214m\007,7O\250q$C\025C\214\314\314H\220 I\3226p\242\031C\363\021`I3WA\222\233\001u\362\017\322\267-U\227\231\335<L\362\263\265\304\213Ad\345B\357\257MB~\233+A\313\032*%s-\233\316%Wt1\270\241Z\232\341\006\231g\213"
+	.ascii	"\024\256\007\253.\272=\2418\300PW\373\342@vA\220\211\177\336"
+	.ascii	"p\"\233\222\300\335\224\226\005\016:\233\375IM\033x\253\346\202"
+	.ascii	"1\0363\343\364s\200\024\223\016=Y\3462d?\233\306\330\366\225"
+	.ascii	"\2656P\201\216\247\306\030)F4\326\357g\353\264'\241f\b?ba$B\035"
+	.ascii	"7\373\337\216\333\244~J$\376"
+	.text
+	.section	.gnu.lto_afatfs_appendFreeCluster.69.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`>\001\325\r"
+	.string	"\346\331\\C\020q\224\016\360p\360\031\020d\355\374\372\211\003p\333\224G\002U\300\376\030;/\f\221\260\"L\365m\257\177u&\"2'\324\270\361\025 \002\250a\325\n\306\025\230J$\247\036\370h\375\237\020\262\267\224)\005I"
+	.string	"H"
+	.string	"H"
+	.ascii	"&B\0269\270@\342\240i\221qZ\211\261\373i\232o\\\217\360\003\256"
+	.ascii	"G\025q\321#\324\024\371\330\246\301\351D\013\345\215\036K\016"
+	.string	"1^\311\025\200g\202\232\335\275\352)\342\2252\261\315\356:Q\036\311}\335\366\003\333\033\373\036\002\337\037\237\272S\323\317\024\b\221a\303UV\354\216\264j\354*\252 \361\324o\207|\2253~J\364%\331c\200\321B\343\305\356w\340\321\013\262L\373)W\t\375\013! `M\252\016(v?\004N\220=\372\313l\373(\017G]4S\260\274\225IG\271\273#\345\2700z\325\263\026*\027\246\234\341\354\034\327\025\243\316\223I\311\334Y@\262\335U\340\257t\025\262\021\217~\310\365xe\200\322*\221B\312\226\375\215RA\330\207\253'\266\2461\027\354\001\034H\307\351\270\313#\302\307\003\335\351\340<\035\307\323\371\260\300q\264\355\243}|8\022\264\016\210\323:\fx\233\340\001\322\272m\003i\231o\017WO\034\300c\201\230n\214x\032\364\242\251\"z\026\254\017+\222\226\"\004L\3172\201\227\214jo\0242\033"
+	.ascii	"u\331;X\3504\213\340\262A\236\314\026`\367\250@\201d\221\222"
+	.ascii	"\013\007^\330\242n:c\272\340\334,\341\302x\260,\242\230x\313"
+	.ascii	"\236\325\254\001\205j>u\016\332\035\244\004\224j\234\247j\fu"
+	.ascii	"zkK\031"
+	.text
+	.section	.gnu.lto_afatfs_isEndOfAllocatedFile.70.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\247\001\025\020"
+	.string	"v\237mE\360\320&\035:~\337\327}\313buO:\355\302YY\353*r\346Ps\232C\346l\351\344M\314\204\fj\244L\361\275\032\253\375\227h;P\0066\2215S\322\\\310|z\217\\:\226\023\253\315\211\335{K\231R^"
+	.string	"R"
+	.string	"\\"
+	.string	"G93&\214va\233\202\370\352\031)\302\247\271\362\271g\177\275\004\343h\247\310\203\r\316I\231\206G\255\233y\bv\327\324\311$|\0375=-\255\213y 8\204t\310\344;\013\347\372@r\\\334h\035\314\373 \372P\343\257'M\367\222I\032\331]g\253\263\271\001\3346\006\333\020\354\267\b.\373ow\327\252c\355@\177\t\246\243\323\320\351\347\264\276tj\372\001\016\354\360d8\212\330nM\214\307\016A\025!l\273\330&\333\231\366\177>\302\345@-\037\260\253c\224b\027\306\300\"\331\241a\377\210\207\331\013\304C\333v \342\342\225\201\030\256\250A\255\247\367\341"
+	.string	"\243\\\032\306\3357\202^\310\200\352\362Mbj\306 \371\t\223\324\b?,\216R(\007Q\207g\312\222\332\024P\362-\325\247\334{Z9Cz\225x\225Pb\006L\356\260\235:\t\225lw\037\370A\023T\031\317\241\337\022\017\257\177\375\211\370Y\341\003\304\312\230\r\343R\003$\025NJ\236Q!\252\022\226S\t*\345\202\352\264\245N\266\224\223\023\312\206ZQm!\t\234\262@\262\262\261\244R+\233\t\266\177\253:\376\353\004H\232ZU\241\241z\204\245/\231\272\234P\3013.xT\032;\252\246\237\351\301\312X$\251\353\271\341\246\310F\\\305GC@\246\332'T>\035"
+	.string	"u\331c#\264\214\025\325h\210T\354\316\005+g\204\260A\215\325\270\271\230x\340\032 \b\031^n0"
+	.ascii	"Z1\224,\270r\302@W\230\333j\354\350\032EC\004X[\013\207\016\345"
+	.ascii	"\326\274\277\252!\256\334\001\206+2\250="
+	.text
+	.section	.gnu.lto_afatfs_fileRetainCursorSectorForRead.71.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\007\007\025+"
+	.string	":L\354\020G`\034R:q\264\1774HK&\2228\324\222W\340g\320^\244\030\2769*\023\354r\212\f\363'\272\263_\313\251\2032\261\242\2379\307\313\313g\360\2157\"tX\345\237\237\217>>\366,\324\366\277\332\223A\b\331;\311\371"
+	.string	"\345"
+	.string	""
+	.ascii	"\001\335aC\243\"\016\016R+Lr\206vh\376\212\324\301\242\236\261"
+	.ascii	"\362q\310I\263\304\345\334d\360\265+\264_\213\324\377\260\367"
+	.ascii	"\236i\003\b\230\251\234;\24097\033\264\204\366kw\367\253|)\325"
+	.ascii	"C\214\243\212\310u@\372e|\312\345\334\fv\363\001\330\257\355"
+	.ascii	"\177\330\257\370\310\207\007\376|\275\036\336N\327\362\260\253"
+	.ascii	"\212\357\260?u\340\006\343\032T\371\237\220\373x\214\320\356"
+	.ascii	"\241\250%\267\224ram\275\267\245\026\344\366\274\r\251\305+\300"
+	.ascii	"\205\005\344;'H j\321\332\013\264!\177\\\235\032!.\210\225\267"
+	.ascii	"!\263T\236U\333\225{iy\214\236/\300\205%\344<'*\317\252\r\244"
+	.ascii	"(\355\370\256\214*\200\261/U7\356\312\343*\357\252J-\3129\177"
+	.ascii	"\313\357\216+\252\213\325\236:\306\267\267!\223*\204*9\255?\177"
+	.ascii	"s\\\025\357\3451\3129\367=^a\275}\336\375\007\335\255\242\233"
+	.ascii	"e\n\270\3022:\205I\274\323\366\271>\334\275\342\350\376\b\304"
+	.ascii	"\177\376B\312\262\220\3228*<\325\335,^\334\325}<\235N\247\215"
+	.ascii	"\215t\353n\023\371n\023\370\331{\250w[\250w{@\337\016\352\271"
+	.ascii	"\r\324\267\005\034\372\3769\330\033\250\273\375;\363\367\365"
+	.ascii	"\355]{[\327\267[\336mVw{mo\253\273\333Xw\373\266\267\217\340"
+	.ascii	"\302\323\351\026&e\342h3[M\3472\333j\266\344g?\364\007\373\303"
+	.ascii	"\256v\177\315\254q\324\310\226\226ZZ\007\301%s\316e?\353\243"
+	.ascii	"u\221\022\336\254un\321\271\213\365\2754\017*\003\300\221.kM"
+	.ascii	"\023\255\260\337\245y\302\223uZ\021U3_\261E\264\240K\271\234"
+	.ascii	"\263\210V\313\267@]\254\261\033\334\022\252?v,\335\274\236q\261"
+	.ascii	"^\213\300\261\331Z\316\350\346}U\273\245\372\316?\233\327\001"
+	.ascii	"\367\307\237+\261\n\302D\032g\304S\274\265\005\3211.\273G\261"
+	.ascii	"@\374\265\2642+\037\272%\226\305N\316\003\303)\303*\367G\026"
+	.ascii	"\337\313}\322\304\251\302F\205\247:\ne\016i\203\360\303\376\347"
+	.ascii	"U\350\262\2153\252\005\016\320\232\341\227O\2313\361\307c\351"
+	.ascii	"\241\225\253\311\020 M\020\306d7\236\3740\020\276\361\0161\277"
+	.ascii	"\323\330\025\377\360\261|\215\222E\306\031\025sR\274\323V\361"
+	.ascii	"\212o\032\234\212{_\314KD\316\255\007\017\356\372\211p\rA\262"
+	.ascii	"Z[^f\342\270\255D\267\277E\303\206\373cc<u.>\330\336\250@\214"
+	.ascii	"qR\207\027\2218ni:\334-\352o\312\356\032o\373p1e\316\231\002"
+	.ascii	"\210\233\t1AY\346l#\232D\211\373c\t\3747$\314\343\213\225\216"
+	.ascii	"p\231\032\357\020\3574\271\344J\031"
+	.string	"\214\273zx\024\3541\013\247\032\252[\247\273O\\\f\2126\347<\241\037\206E\2126\211\r\366\353\003B\250\247\243'!K#\251\005\323\322\372\364\002J\230\344\304:5=!%\221xq\204\264$\214r\021\303\227\364bIIm$\007B\245\247#%$\246(\341Q\260i)\310\264t\004#\210\344$\f:H\320M1\222\234\202OMMNA^\223x5c#\035\303\316\321X\366\323%\221\256\215\225\261\375!\273\353\035n#\".\366P\315\231\013C\034\330\235\2529\347\f\024\200\377\274\001'\033\345\326W\222\314\2302q?\334\325\354\2249=\007?\332uC\274\310\214e=C\230\b\347\350\326\3419\037\232\037\341\020a\335\232\\N\235\321\261;>5\"'L%=\335\221X\002\370jc\2040\001\f\300\251\0255\336\021\302C\370db\330\001X\b\257d7\250\234\235\316\360k\b\315\331\234\f\007\320\310i\361"
+	.string	"|\264\253p\262\316\024\243bQ\212ao\361W\222x\247\026\336\346\300\364\310`\1770vF\3278\025\334\273\271\317\315\376\03469\002\275\206P\002\200\211\250\201,\304\024s\252D\002\021\221\246 \311pp\"\021B3\017\021\24094D4i\2155\265R\372\212\252\207\2046C9\023\352\270v}@"
+	.ascii	"A3\343iY>ee\256\024\336\334\266\200K\342>\243\223n\277\305\203"
+	.ascii	"EY\272\327|\366\032\271T\247\246\023\220l\251B\235\266\024\225"
+	.ascii	"<\300\340\305mfat\024\354\030\003\314\f\036\021If\260\350ep,"
+	.ascii	"FH\n\003\334\333v\f\2040\364\034\267\241Ko\215\222\026\236\230"
+	.ascii	"\200;x]\256\334\005\003\261\342\275d\304J\035\335\007\260\310"
+	.ascii	"\241F\346\367[H\305\202\361l\017\230\031A\365\036\235=2\227\f"
+	.ascii	"\204\005|\377\032\237k_\"Dy\244\001\304\\\"V\271\307\317\260"
+	.ascii	"ze6t&\315\226\215\352)c\255\237\226\t\256\026e\324c`c\314^D^"
+	.ascii	"\025\341D\373k{S\330K\362\221\n\254\n\233$\355\362B\030\364t"
+	.ascii	"\231\310)\3367\242\357\025+\203\235\022!\313|P,\365\241\273a"
+	.ascii	"\273a\241\332E/k\244\250AX\227b\343\021\035\330\300\314_\207"
+	.ascii	"\260P\251\001"
+	.text
+	.section	.gnu.lto_afatfs_fileLockCursorSectorForWrite.72.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`2\f\265C"
+	.string	"\232v4\032@@\236N:s\233\271\244\206U&S\211\354\277\337\314\360\001^G\360\n\036\221:q^\035\344J-\377p\3129W\007\330\027\215bo\fx\351\"\253\310#0\030`"
+	.ascii	"\370\246\246\243\035iD\356$\003\232\001p\001\225\001\257\323"
+	.ascii	"|;\326>\335\034\363\026\255\314\321c\022\347\271\266hD8\356i"
+	.ascii	"\001\363{\032\341\375-\322\331H\342\340\273a%\216\267a\277'1"
+	.ascii	"\272\366\214m[\353\223kl\333vF\222\357}\316;\212Z\244rN~\232"
+	.ascii	"\3571+\371\353z\334\212\203\322\265\243\341\347\251y\3029R\201"
+	.ascii	"\361\305\254<\022\311\354\203O\375\231\343\261\362NG\220@\216"
+	.ascii	"k,\354\240\036\242@L8:\321\322\266}(\350n\306\307\353\236o\217"
+	.ascii	"\264\007\322\350(]l[\272\bG\362\206\344\221O\353\231\330{?\327"
+	.ascii	"C@R+F%\322\327\266tR\214!"
+	.string	"y$3\363\311\\\316\007C\033\310\21706\006\216M\310\3164\266-\035\025\323\335\211=2y&\366\310\226r\350\001851-)%!1\227GJ\243\242$\021\213\\\373B\371`\007P\202\fQ\016\226;5\021y\030<\212\350Z\243\034!\266#V\316d\345P\204fU\356\022\025%\300)O\202;\322\223D\270\313\\!H\377\222\234\320l\312\352d\247m\217\364.\241\330\2168\371\221\023%\241\231\332\372\304\305l\355\032)\317\306n\321\na\221\r\343\t\315\232\254NF\260\224\035\360P\\\314\322n\222\310\003\336\241\330\216\\9\321\303\260\234]\245\304\30092\317\310\326%\2748?\2367v\221J\276*\317~\254Om\333\276\357\267\310\231\330\355\365\250\020\031\236\023\232\241\255\026~4\256\035\357W\310Y\364^\"\017m\333\362-;;r\016p\346?af6\314F`\002\277\203k\333V\003\264\314\007}\310"
+	.ascii	"'\350\214!xD\211\373\262\022}<\210s\357\333YR\350\030\222=\026"
+	.ascii	"\270\002\2329\205\212\3732\007\375\2747\315a\364\033\024k0\264"
+	.ascii	",f\004\273\337\030z\026\354;\006U\217\330-\304\314U\367\303\""
+	.ascii	"\331\266m\006\376\342\212\026I+=\330#\337\307\373\0027\212n\322"
+	.ascii	"\351\\\330\2552\323Eo\2771\277\253\325j\225\333\215yy\031\203"
+	.ascii	"\323\345\013\027<[h\272\\\241\3512\005\346\345\t\314\313T\314"
+	.ascii	"\313S\314\313RL\227%\360e\b|\371\301\325\234\035\374\356\034"
+	.ascii	"\265\340\205g\005\313\313P\367;?=\3169\301\347\234\021\374\357"
+	.ascii	"|`\351\262\001\245\313\005>\367\013\340\313L\257s^z\335Y\351"
+	.ascii	"\350r\022_FZ^f2//\231\227\217\224.\0331/\0271/'\223.\023!]f\227"
+	.ascii	"\227\221G\227W\346\345^^\276G\227\277\201\303\232\350\035;G\265"
+	.ascii	"6\244k\215T\r\265\203\3106Y.\370\027\376~\177\234\177\316_\347"
+	.ascii	"\377\373\325\374u\277\335\177w%\363\371\212\347\243u=,u\330\266"
+	.ascii	"\255\026\236'\332\270\036n*\237\027\251\\\236#2\327\370!_\357"
+	.ascii	"0\220o\310\312\302\247\022/\360P\2561L\262\006\333`V\022\332"
+	.ascii	"\341\001\205ho.\310\037t\343\003\307\003\271\bP\240A\251\034"
+	.ascii	"\234\3139\235\377\035P\315b\005\f>\002G}\303\227X2\225^!\247"
+	.ascii	"\352\t}\304#\271\3041N\265TS5\3371.Q>\fer\233<\323\244\372|\276"
+	.ascii	"\276I\303#\224\324oNQ9\215H\355\306}\250\032+\241\227z\236\310"
+	.ascii	"\320\264\273\004\252&\350*\221\320O|T\024\274\306\004|\246\300"
+	.ascii	"a\366\033\03302-rD\364&\333\304\0277\247d\337d\227Z\b\237\275"
+	.ascii	"@\362\017\025\361\350\007X\243.\320|\235\\\263\246Q\273\2302"
+	.ascii	"\306-\373\355\316M"
+	.string	"J\223\243v{\352\242\316A\r\024\273\205\236\334\"E}/\323>qsS\212v\205\312'\213\240\233\312\007\320\232\240\237\232\350\017\320\230\024\251Z5\324&h\242\277\304\256\376\311&\033\001Z\364V\243\\ \317d\177\314\2640n\356@G\361\305A!\264(\326`\fX'\310\236\221\016\226\250\357\343\324\033T\312}\031Q\337\017\212X\203]AZ\033\240\"+\226\355.j\004h\025\350\225\3732\266\017x%DFG6\354\233\203\222|\320y_\373\246\177QC5\177\302n\225\r\364\367.\0304\013\023\256m\303^\366=\206n\271-\264\213S\365A\367\336\230\027\2506\320'{\fk\317~,\262\241\372{G\202I\013\244\032\336q\211\336*\257\215\354\353gh\355e\233\342\340\215\322xg\tQ\277\375ju\177_\330\273&M\004\003t\007\031u\371}\3200\320\270\3732\356\3531\031\354\263:\350n\264!]\242"
+	.string	"\272\203(v\013\2219\241\347\361\0342\363x#t\032]X^\316\257\255\253.\254\033_\004\2343\254\266H`\321\270\262\2722\342:Q\325\325tv}]5yuYy\265p\312\252\222\3015\"\253\312\013\313\231\225\325d\332\201%\203K\013\331\325\364\272\302j\261eu\245\345|\322\270\301t~yYy9Y\257\255/'V\027\353\305\365\325\fQ\343\252\271\005\002\313i\325\205\205\204\265\245\225\265\362\325\2243\313\313*\353\212\353\351\264\242jjQqiY\331\240\272\352rRM5\340\346\r\254.*\257f\263\213JI\027\366v\343\343=\271xH\215\214\317\tB?\357EV\034\257\340\361\261|(\313\304\324\354!\254\243\f]\333\226\255\303b\335\255\256m\333\266"
+	.ascii	" P\003\355\221N\321\360L\333\364\234\372\215\3318F\246\251\177"
+	.ascii	"\360EP\272\354\221\361-Yh\fI\315\\u\2470\017_\366\007C'!\233"
+	.ascii	"\314\3515\021B\261AQc\352\267\242\277"
+	.string	"`/\364\t\001\305n!\256\320\027z\211\272fX\241-\364\367\376X\n]\241\221{cc\004\257\0334\213\201C\3016h\027\006\207lHM\241?\370\365OZ\236\250\341\035\030\273#\365\024\215\353\354\350\300,\365\033\037\360Ue\226,\357\220\337\360\227\362M\037\223\026\264R\013\271?\036\325M\r\224\205\252G\303U\n\374\031\350Y\331\001$P%\367eQ\375D\326`\274\324\314\365\315\3641j\210\367\250\324o|\221\356\023\177\"\207[\036\311\370\230\237Z6U/\350V\034\323R\244\240\227\335\203,\260:\366x\324\311V\320W\020\031ZuB\007\200\346\250\201 \306\224R\nM\211\210H\2224\313\001\200\"\241\252\262\r\021\2001DEB\322T\262\254\001C1<l\256'\221\350\334!\351w\325:>>\353\217A\t~l\212\314i\037\bHz\3022\353\362G\341\225\330\216\300\024\215\306\236>dn \003\t\342"
+	.string	"\357\221\361rz\343hO>R\310\020:Hu@:^|G\332\b~\b\246~\031H\3778[\204\222\277\331\025\350\262ylR\301\026\305\3532:\006\367\330\362\347\037Q\315\272D.f\254\2559rt\270i\311c#68r2\343\301\377\027\310d\007\352\364l\246&\327C\320\020\341\020\211sp!H\020\275\331B"
+	.ascii	"!7\240{UV\002+\335\340\212\255\001\217'\002Be\nKJ\207\211\277"
+	.ascii	"\n\253\222\234\347\243u\006\334ij\204@V\254\004\204\0210\007"
+	.ascii	"\263\373\340\224\370\0067\031\001\2149\005\22523\220f\214s#^"
+	.ascii	"g0\340\236\0312\020\276&\340\317\370\007\236\346\345\350\362"
+	.ascii	"x\021.vG\350\267\210!\345\272}\346\0012U\301o\013\307+p\002\006"
+	.ascii	")\356\202\035\274C|8\004z\360\317qb\241)"
+	.ascii	"Df\253\020\246\305Q\235m\251@1t\3153\002\340\374!\353\327C\323"
+	.ascii	"\013\200\0245{\255\013\253\211\210x\363\256\225\247ld\225M\323"
+	.ascii	"\375=\234j\351@\237\025\250\216w\355\3473{\342\202ol\236\211"
+	.ascii	"\035\204\020\275\223\303H\245D.\307\322?\251x\023QhHp#\t\r\031"
+	.ascii	"\3247\341\245*\341\016\365\331^7D\nB!\016\244w\021\206\016\353"
+	.ascii	"\37139.\004\212\353\357\n\004\343\002\0241\t\205\201\316cCE\241"
+	.ascii	"O\334S\024HF\353\247\026\334\265Wj\242\302\022\272\367:\206\022"
+	.ascii	"\367\322\214\204U\031\027v\202\005$#\300u\216X\314\005\2070:"
+	.ascii	"\250\001"
+	.text
+	.section	.gnu.lto_afatfs_fseekAtomic.73.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`!\013=;"
+	.string	"*f\220\026DP^N:?\302\271\033\256\360\034\"\376\0340\317\330\231\037 \332\207\030\2770\017nX\256\"\265)\224mM\263\321/$1\333\200"
+	.ascii	"\007\004\240!(\004P9\213\r`1\344\340\177\276mJ\214\254m#r'\031"
+	.ascii	"X\0015\001e\001\217\343\022}g\007\303\027\303l\362aX\232\005"
+	.ascii	"fa\314\f\257u1Lz9\235\214\307\361\275\242|g2\370].\307\314\262"
+	.ascii	"\362q\274\366\350\013\004ES2\263"
+	.string	"\007\252\314X\374\266\277\035\216Y.K\265\345\322\252L\352\340\241\235\251p[\276\005k\237\243\217\337\234\275\017[f$i\251\265_G&ye\320\036\034\310\032\206\255v-X_\253\301k\333&\361\373\322\266-\004\2660<0I\275\227\371hO\303z\364\306\207\332v\311\232/m\253\006\201\233\206\007\262\332\217\202\007\016_\024<\220\231\231\251\t\213\231\001\266p\340\211\340w\345\331\326\247m\325\226\232\311\2317*\"\032\022:\032\213A,q\035\n\203@\265/\223O\374\302q#\037/b\277\264\356\274\234\\\"#\037\022fH\002Vv\241;\257&vd\367\250&\335y\225\251Im\333\036\271\306\"4\350\316\253\310\024/#\227\315S\342\206\2502\305}y\371\235\027\021\265X%o\312\341\206\334\365@\0220!\037\336y\t90\305+\354\n\203<h\374z^\352\274\300g\231]\305\020\205\243DN\334\227\217\267\352"
+	.string	"\212\306\207\361kK=j\243\304\316\341~\273\276\232\367\n3\264m\313\227\353\013\354|t\346S1\363\0263\321A\027\314\2366b\300\036\373\225\013[\362\246\252\355\306\210w\256<\375V\373\370\264C\347\2046\377\204\013\312\246\333\274@w\263O\t[\032\255\373\207\273o\027\350\357qB\233w\312\004\272[\365{\376\365\364\313\340\373\266\020\3163\254\311Rg\263\034\266m\353\304_\363ajhv#x\340\373p\177 f\017\0374-\232u\247\314j\315\333c\314\357\351t:\345^\302\274^\206Z/?\255\227+\254\227\235\326\313M\305\313\024\330\313\023^wfb/K(^\216\300^^\n\272\254\324\340h\316\n\276\345\214\340n\347\244\240\313H\354e\003\347r.\360\265\237\300\243\377"
+	.ascii	"\276\f\340k\347\243\365\262\321z\271h\275L\304\227\205\326\313"
+	.ascii	"\307\365\262q\275\\\\/\007\255\227\331\3652\221\275\274\262\227"
+	.ascii	"\207\354e\341z9H\274\f\\/\253\353\345^/\337\365\3623@\3255\335"
+	.ascii	"l\361\303\322r\324Z\036\323@-\033`\030(\257\373\321\374f\376"
+	.ascii	"-\277\333\317\345A\3463\3744\314\242\321q6\325\261\327\266j6"
+	.ascii	"\206v\314\232Y\022\337\364\312|\251\032\216y\035\237\f\263\314"
+	.ascii	"|1X\007si2W\307D\377\374X\370\321\303\315\361\251\223:\300\221"
+	.ascii	"\250\026=n\326h\335?\314W\306\344\315x*r\316\\)\256}\373\330"
+	.ascii	"\324\f{m\341\2343\317\260\205\322GA\242\203-\250\307\230@\013"
+	.ascii	"\233\005\033\232\247\0266\361\231\247\367\374s\352\356$\025-"
+	.ascii	"\312\307&\307\r\332\324o\247V\357<\303\350X\303\325\221\243\251"
+	.ascii	"Owu\214\020:?Q\265\3752X\241\237Z\275\343\234\322\224c\016w\013"
+	.ascii	"\357jU\350\313}\001\02294hZ\327\323\n\0176x\263\202}|\336!\343"
+	.ascii	"\2046\331-\217\354\213x\357!\bl\026ls\230;|\352\001X\324\367"
+	.ascii	"\006jd\365\013+\223s\306G\241\001!/\374!\201\344\347\304\261"
+	.ascii	"\217\2006\256<\023\232\302%2\367\340L=\241E\2649\373\232\227"
+	.ascii	"\320L\2554\027\241%\264\222\037\210\367![\017\217)\366=$Z\312"
+	.ascii	"w\242\333\364D\350\326\233\023U\352\245>\231\257y[fzC\245\020"
+	.ascii	"\307\0235Tj\007q\204\b\343\\/\312\210\367!ep\316\370>\"x)\213"
+	.ascii	"\270\235\021\030\310\244\314\033^\207\004\022^\333\266O\007^"
+	.ascii	"\312%N\347\304\021\017\357sPp\n\025\367\\*\334\310\370\220\332"
+	.ascii	"@\027m\231\321=\377\262\3264\323\346\202=\306\314G\005\221\232"
+	.ascii	"\005\033\235Ky\305\341D1R_z\242:1\250\221.\220\310\022I\023J"
+	.ascii	"\344U\r\026\354\025\rd\025+\025u\255\222WS\310\0223\220UG+\344"
+	.ascii	"\225r\371\202C\025\210\0213\220UD\312\345\225\324\2252x\205T"
+	.ascii	"RQ%\203\310\027-\250T\236RRR]IQMU\325PJ-%[,U\265\220\202\261"
+	.ascii	"4e\245\\Rb\300\311\030H\253\245\253d\322j\211U\313\272\332\366"
+	.ascii	"\022\306\312{{+\336\"?\334\207\201\374\342\336\350\324\237\031"
+	.ascii	"\004\320]\314\f\2409CV7\325\266m[##1cQ\023\265Q\377\250\213\272"
+	.ascii	"\341<\377\262\240D\t\304\370\211A\323\036\320\345\325)\3521~"
+	.ascii	"\232\257Q\246<\236tB\r\232U#\201>\352.fP\250\301\035 \205I\345"
+	.ascii	"\236K\350;x\350\331\363\263\247\3258\310\034I#%\002R\tD\007\232"
+	.ascii	"\266\2676\264T\3336\t\224\335\207\366\326\356\224\217\335\240"
+	.ascii	"\377\374\203\352\356\343\263\317\324\t}j\247\206j\276\316(\306"
+	.ascii	"\016S\320\3056\266\332\346\004Rl(73\321\240\366ad\346A}\260,"
+	.ascii	"nV\302\330*\027l94\302\233\363Z\262\375h\2266?\321\247V\320O"
+	.ascii	"\363\020o}\350\234Q\232\005\270\340\362\b}F\020A7\033\237)\333"
+	.ascii	"\034\005\367gn\307\264\302E\354\001\315\314\304\302L\273\347"
+	.ascii	"B\320I\316\306\221\345v-\217\310*\220\021\373v\001\200\322\250"
+	.ascii	"A4\345\fd\210dFD$I\222B\007"
+	.string	"`\"\021\203V\017\021P1T\210\206$*Ii\232\003\"\324\311\n\375\244\320\257'\223\374\331\314H\265Q\356\355LSF\356\2439{\0331\300#\210\020\006\244\351J\262\367+\370\273p\027]\273\035\262x\370\002f\263a\353\233g\024\257S\310\232yD\340Z\322\377\242L\3466/Q\321\227\355\313\0138\331\036wO\344QS\020uB\266\330J\262=,\033\202\344W\035\277\302\311\244\300\315\311\341\022\030|_<\347\357Rt?Z4l|(\254\351\300-\334\327\345\360\364N\302\375z\004\\\2454\017\320$\244\322\033\262\340 ~\3446\223\330%\351\016\230x5\366\217k\343\245zr\363_A\342\351\244\275\303$J;\221\312\242*mh\007\364H\370\224B\017E6\350<R6+\264\002\352\001\371\261\210i\3709\243J\262M?>^\312B\353\232\245\031\200\245\177\355\364(\213\236\227\330cBE\007\021L\351L"
+	.ascii	"\366\033\017L>\337\314\325\204\225\\\306\246\2143\351\267\300"
+	.ascii	"VpH\234E\231>%C\370\233\373\216\365JnF\343\300\013\200\305L\t"
+	.ascii	"\310\213^\243\3026\263\233\002o\265$M\211\225P+\020\314\030\320"
+	.ascii	"\036lZ\331\232\232.?\376\315uy0\204\237\213W\323\302@A\275\225"
+	.ascii	"\005\360\273\241\362(\334jI\354$\f\344\020}f\216\240|\214\302"
+	.ascii	"\300Zhf\223`\026\300~\023bk\200:\216e\216\305F\177\037\247B\261"
+	.ascii	"xv\234l\305\241\316\333\333j\240\367\257\363\304#$\276\026\374"
+	.ascii	"\335\034\313\350@\216x\260/\272U+v\364\302\3668\003T$\343?"
+	.text
+	.section	.gnu.lto_afatfs_fseekInternalContinue.74.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\177\b\215."
+	.string	"\312Q\344\021D`\\N:wY[NE\353;\020{\243\353S5u\327O\257\205\260\324\210m\302\271\326H\257U\244\326\034\261gp\021\317R\331\261l\232\030\2722\300\302\323\201]U\337sD\304\365\377\257i\267&\204\310\235d\r\001\361"
+	.string	"\021\001W\207{\034W\375\215I<\377\230h\353\272\016\017\307\317\362-<\324\2024\312\022Z\263\210\210\321\225\250:\026$\272bY\225`\013\366\226\330\241\005\216\250b\036>E\231\257\370mw\362\320\rY#\360\231\266\341k\277ru6\253\257`\353m"
+	.string	">\233\177\353\272\206\364\224/\334\247F\250\265\314G{\332\325\325f|h]\213\300\241[\3275%\246p\237\362\332\005\250O\357\001\250O'P\270\342d\001\032Xq\"<\317\266\234\201\353\272Vl$\254\332\344\177\210C\037\341\355QS\264m\222\377\205\365\037\033\344D \037\242"
+	.ascii	"\304\270\250\371\031/ h\222\232(cw^\201\231\327\017\3533v\241"
+	.ascii	"\231\327\030jt\306K\314^3\240\257\245\355\371\031\2570\347\226"
+	.ascii	"U\025\220\201\005y\352\003\245\307Q\324.\351\213\003\364E\003"
+	.ascii	"\305\360\245G\327\357no|e\331\276\363\350\224\346\336r\215\226"
+	.ascii	"\257\036\267=\032\326ue\313\365\005v\006:3\267a\346(\346[\024"
+	.ascii	"w\376\301r\020\020]\217T!4R\243~ZfK\373\344\327\261\361z\310"
+	.ascii	"\273\256k\005~\231\233a\301g\362\224\241Z\330s\265P\237B\350"
+	.ascii	"\327\235\301\020.h\31445\245}2\257-m\033a~\005\037wJ\270\213"
+	.ascii	"0_\313\305ky\351rg\245\317\235\223\256e\244k\031\302\361\316"
+	.ascii	"Fg;'\270\226\017\\\313EW\373\t\260e\242\273\235\207\204\226\205"
+	.ascii	"\256\345\240k\031\350Z\376a\313D\266<\274\226}\256e\341\265|"
+	.ascii	"\257\345\236"
+	.string	"kY\275\226\323k\031\275\226\373Z\266\327\362%X\262\261.\035;~G\314\272v=\361\254z\251\027'\237\373\345~\274\337\356g\373\335\2562\237\371c\370yx6\250<\357\234\356\035\017\355\220e\317-\177\353Jg\342\202y\230\030\177\343{5\313\004\306\360\362:\346!\037\377\306\302\035\203G\346!\227\313\361\347N\307\303-WY\002]\236<\364\262\032\353~C\236\004\366\264\021~\336\317\234\033\324\201\362\221\352QW\2352\266\250\207\372\006R\3734\261J\233\231\241\026\266O\367\236\026\363)\254\313S\206\256\353\272\252i\224g\023f\332\037\333\220\231\020!)\022]W\262\fw\037\372c\263O\276}g@Y\261{\372\006\210\323b\"\365P\027\233\255\326\023\020\027\f\024\021\"\302G\250O{\372D\023\216\240\232\332t\214:m\265Q\247\026s\t\330\031\340\210\265\234s\311Q\332\035\355\2035\337\234\205u3\223\370_"
+	.ascii	"\2764\216K\216\322>\337 \357\355\276Z\323Op\250\221\332\250\237"
+	.ascii	"\367\017p\203sZO\226Y\370\216\210Ao\245&\350n\313\323l\353\313"
+	.ascii	"\262vX\200\375\230\337\231\270\\\266\t43\212\024\366\\\t\332"
+	.ascii	"H\253\261\230Y\305\373\220\002,\330\376\335\031\020\311#\245"
+	.ascii	"\361\306\336\3504\037\350wQ\243~[aax\305\327\2509\320\017\203"
+	.ascii	"\207\231\236\006yT\206F\204S\2062&3\324\247\357-\214F\022R%\216"
+	.ascii	"F*\253\246!\225\fc\324\220i\205mZa\247\214T\307*\027\034\242"
+	.ascii	"<P\031\217OORA\307**&\252\243jt\001\365\204\262\323\322\361\211"
+	.ascii	"\212\351\311)\312\352\310T\224\202*FA1\275(:M\035\213K\rX\n\206"
+	.ascii	"q\252H%%5U\034\256)\337E\370\316_\277/\034ps\304?\251\376\356"
+	.ascii	"B&\3176ps\251U\236\210\250Y\203\262\227?m\204xd\t4\0135_\013"
+	.ascii	"\331\016=\003zrM\206VT\241nbN\236Y\036I+B-\002\213\333YSeN\246"
+	.ascii	"Y\260ds@\031o\260_\034\236\022\371\234w0\347\031\310D\003\\\352"
+	.ascii	".$\361q\277\217\2760\245N\352\245V\"\243Eg\311ds \255\234R[g"
+	.ascii	"\237Z\034w\2607\220\007\303\307I}\272\243Q\300\300\270a\246\371"
+	.ascii	"\004Y\033@@\375\323Av\013\250\035$QSZ\032?}\241\211G\220\310"
+	.ascii	",\317)T\236\330M\304\376\351z\256\202\177Y\215u\264w\306u\237"
+	.ascii	"T\207l\020X\017\037\354\271\206-\026\200\236\250q4\247\230SH"
+	.ascii	"fFRP\220"
+	.string	"$\255\001p\002\0211\254n\021P1S\316LIR\220d\330\f*\314j\235\376\035\016\340\3567\262\317\337\224\020\355\331\365\360\3050/C\333P;\032N \b\354\336#\331\004\311\033\300\313!\272\316X\005\017\351\023\016`j,4&\265Y\204\024T;\013p(\005\374]\234\311\347t\364\311\3030#\265k\305&\363t\347\232`\302\256\261^\254\200m.\r\204\341\223\262Q\304\311\037\322Gg\006\035FQ\337\256\311\275\203\323k\3109\242\2747\337\224\241\252U\274\326\032LiL\302\r\177\317n\025U=\333%L\2369\242\342\304\262\244ReF\3239BV$\235Q\231H\372\325X5F9i\364\270\324+\027O\211\317I|\tc-\277\006\022\276\243\330\200\221\037\2418\034q\305cB\234\205\232\362\206\b\347\273\243\305\222\023\252fj\370\272\346e;\343Y'\251\005\346\005t;Q\3068\202\306\206\330\222\257\333"
+	.ascii	"\213w\017\253KIYD\177`j)\254;\265[F{\335\005\016\001\033\342"
+	.ascii	"\005IG\226F\310,\271eu\363\226\032\230<A0\017\254\002~\255\261"
+	.ascii	"d\303\324\254#'\263f\370\301\005*oD\2417\217\365\024v`5"
+	.text
+	.section	.gnu.lto_afatfs_fseekInternal.75.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\\\002M\024"
+	.string	"V&\211J\240\326Q:\304\373\206\030;\206\337;\324M\257\236\326O\233\326x\001\354\030\244m\315\333\301\031!\205\317\316\364\264\272%\312\340\026\256\016\272f\265\305\341\227\3505\370i\334&\255\002w\2721\247\271\3363N\350\376E4!{\313\224\002v"
+	.string	"j"
+	.string	"y"
+	.ascii	"\007\366\024X\251\273\250\021T\265\002\035\030\002y\321@\322"
+	.ascii	"\266\017\3431|\234\243\020\244+B\320S!4\225U+\360\345\362\226"
+	.ascii	"\361\"\375\200\361\342D\361\334G\221\316\315\371?\037\001\204"
+	.ascii	"\020Q\362z\276\213\224A\r,'\225^\020%\340dd\343A\020KI\337'm"
+	.ascii	"\360\003R\244\322\333\321\226+$$\237\372\016\365\200vSbj\255"
+	.ascii	"^^\217\350N\271\355\232\355\n\366\376\002?\246\363\363S\237\220"
+	.ascii	"\202\247D(\212nK\033\b\264S\311\376,\313\262\364L\262/\365\273"
+	.ascii	"Z\353\026\271&\017\374\307C\375\324\353\231\262\336q\375\225"
+	.ascii	"\004.\230\212\316\023R+\211\022J\265\022\253\232\374\340\207"
+	.ascii	":\027\032F\030$\253\326z\032\266K\307v]\274\355c\273lS\251\035"
+	.ascii	"#\022\346\036\212\207\256\324\035\022\023\314\256\375\247\317"
+	.ascii	"\360\t/\216\366\260\321\226\371\016\230\001{\346:hH\225\373\204"
+	.ascii	"D\262\230\350\266\374Q\225\205%\302Fr>\370=Jj:\261d\310\207\226"
+	.ascii	"9\025\354@\221"
+	.string	"\241g\216\203\206e\251\326\032\341\306M\203\317t\321\357\031/\222\363\303/h\021d\361\223\361\244\333rs4\2712A\005\254K6\333\363ZS\234?_\301\373YMw\030w\326D\035\331\355\023\007\330\317q\3325\233=o\247K\320\f6\262X\315\315MLF\346\314p4\232m\234\335\324h\324\262\027\034-'F\223\341\360\340b/[\355\205S\213mx\311n\270\327\213\002\3338\314n\257\034\233\355\366r\001u\247u&\231\205\310(\212\350\347\306\007\177\037Q\211$t\237\033=[s\316!\333s:F7\201h\255\265\216Si\332\026\356\203\347\203\020\313\211k\332\027\336c\207<\217\033\006\226\245\007\3170^\364 \304\n+ p\242\221\225\036u\366\264\016\255Y\243T\310\305\350\254}$i\335\201\267\322\271\307^\036]X\207\335P\204L\3414\264\303J\375\343\016`\247\352rK)\337\2406\244\224\321\270S\350"
+	.ascii	"\205\233\3231\236\332\230\354^\034\013\256\326\277\362\\p\300"
+	.ascii	"I\362\231+`\270\273\202hpZ\007\007=,G\003\243{"
+	.text
+	.section	.gnu.lto_afatfs_fseek.76.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\323\b=1"
+	.ascii	"\252V\024\023F`\\R\007\363\222\005\341\261\330A\264\241\256\266"
+	.ascii	"\237'\357\ngs4\n]\340\032S\364Ht\002\251\305\202\325\360\373"
+	.ascii	"\t<\006q\311\301b\363A\2353\343i,\320\221\261\3543\377?Gr"
+	.string	"\237\264\322v\333\275w\222)\005\032\001\022\001\036\0019G\225^\251\356`\024\227\322\316\326A\265)\237\372Z\267p\264\366\300F\366\204\346\234}\332\256\326-<\255\253lN\313\310\254\bacV(^\316y\201\267\215\341m\321\035\364\226\355\236\352\016v7\013\305\305\022\n\217\375\311\013V'+y\320\240\346\234\217:\002\306\335n\346N\246<\n\303\001\344\334c\216\232s\364\250\033\274\336v\364\355\356\366&\016\235\352#\206*\244VQ\223\216)\305\3139\212\024\344\001\\oY\347q\275\375\037~\364\2410\b\374\275>\267e\037\037\333\251|(\3657\215VY\032\241\016\017\352\350\302@!\260,.\377\261\001\300\3608\343a\260\270X\005O.7|\315\205\214`m\341\327\265\274\212\370X\006Q\232S\210M&;L2g\304\215`\355\300\256\033\304iuzK\234\341\214B\335\200e\355p\226-\326Q\271#6\253X"
+	.string	"6\206X\271\324\361US\211?\tl.\335"
+	.ascii	"bU!\016\206\345|\354K\31297\266jfy\023\275\273\357\272[C\367"
+	.ascii	"\253\f\336\n\337\245\016t\363\212\272\251Sb\275\366\3710F\241"
+	.ascii	"[q\317qu\366\274\201\367\371\243.\313\273$\223\303\031\361\224"
+	.ascii	"\236\307\322\253[\351&\367b\364\2525\347\354\240\275\213\t\247"
+	.ascii	"\366\261\022\256\267\006\336\2578{$\253z\346Yf\206\304{\335\321"
+	.ascii	"$\376\260n\377\275\275\2756\375=\272\203\270\215\200\270\213"
+	.ascii	"\\\212\367\001 n\242 \356! n\241\037\356  n\240\037\356\237\027"
+	.ascii	"\267\217W\275{\374\315\333@\343.\360\342\036\340Z\274\005\360"
+	.ascii	"4\356\035\037n\035\307\342\235C\364'\356C\207\342.\364\250{\260"
+	.ascii	"q\277\376\304\333\367\342v_\334\355\213\233}q\377\213\033\277"
+	.ascii	"\270\275\230\341KR\214\264\211\367r\321lc/N\206k\335\210\270"
+	.ascii	"\024\3677\367\252\273\026w,[\020,\270vY\241x\216\326\236\245"
+	.ascii	"\203i\315\007A\234\321*^m\177\363+nST\250\306\2418!X\242mnEj"
+	.ascii	"jmk\247\342n\035L3\006)\267\250RN5\352 \2772\200\033c\325&u\001"
+	.ascii	"\235\301\331(\345\254q;\r\0338`\267\342\340z\353h@\354~\036\250"
+	.ascii	"u\212\2159\223\233b\0358\316\250\277\017\353\235#d|<\277\"Z4"
+	.ascii	"\230m-\361\233\305\303\367\375\325\321\227\334\237'qVf\255;x"
+	.ascii	"\335\322Kg\342\003\f\327\333\237\3675'r{\373z\226\231\211q\307"
+	.ascii	"y?d\212\344\352m\237\347\2033\266\3320\227uC\340\370z\276}\007"
+	.ascii	";\273\372<\373-\373;\327\2556\267\272G\361\341\005\347\376\023"
+	.ascii	"\337\231zH\374\377\216\037\204\032ZRn\332yTZ\230\264<\270=\204"
+	.ascii	"\253\363\301\357\0261\002\273\325\316\273\324\3314_\313\247j"
+	.ascii	"\237\317y\235\217\220\267\264K\372\347\274\017\232\3453\211\367"
+	.ascii	"z\370\376\236\305\177<\324\234S\246\036\022\357\035U\241v\261"
+	.ascii	"\037\326/\334\341\267\312)\234\263/J\374\246=\316w\274\250xu"
+	.ascii	"T8\317\305\252b\325\277\266\227\301^\365s\342A\311\362\027\231"
+	.ascii	"v\271\236{s\246\362\247\273\013\327[\241\244\034\327\314\253"
+	.ascii	"\3139'\030\323\335s\356\317\271\027H\306\312\321\234 $F`\246"
+	.ascii	"\021\330\251)\205\223\t\027.\013'\251\247\247(\327\351\004\324"
+	.ascii	"\023\333ME\251'\026LOM)^"
+	.string	"H1!EA!\245\200bB\201\324\264B\n\251h\324Q*\234V \261\210\212Z\201\024\214\"\235\315\337\243\211YJ\274\b\013\274kq1\247\256\373\321\005\243%\203\331\306\356\374\373W\335\375~'!?\311\346\234\363\320\321\370\200\002K\004\374\200/\346-\355|/\340}\213\277f\256]tL=|\345\335L\270\251B\255\013\231\235\373\335\307%\330\306\2635\3015\336\234\263\3731\324\270\27013\272\335\3072le\024J=\301\r6\270'\324NH\001\313p\212\311\221\331\031\375\022JB\325\005 \254T\312\301I\002R+5Eo\204\273\330\026\370\201/z\r\322\345]\321\211\376\300\027\331\206\236\350\213yG'\230\n\352\351\254G(\316\027\276\272\247\364R\275\241\177\272k\320\013\275\263\371o\256j\214\216\031\f\242\340q\226\336\240W@f\013\370ai\374\315\022\321\352\\bqdvn\301\365\265\256\340m,L"
+	.string	"\222\344w\027\200 x\353k\001\200\245\250q(\305\230C\210\215\210\210\204\221$I\007p\002\0219v\334\021@\275T3D\322\0242\254\001u\310\231Z\333\316h\177\022\301s\272\006I\356\244.\223J\344\265\203TgV6\013\321 f\226\261\214\017v\270\326\202\232l\235K@\237\224\b+\335\252\277\367LH\030\205{\033\020\344\356\001\347n.v\254\027\002\341\365|\374\026\200;RE\357T\235II\263-\301\347\372\003\022{w\362\234[5?7\005v\340#"
+	.ascii	"\003\3747\276\017\212\0011\336\311\277c\342\342\332c\370\350"
+	.ascii	"u2J\317\033\r\303\027\210\247\260\023\203\372\210vN\362\261\334"
+	.ascii	"W\024\002X\332\037\031(\336z\254\205\001b3-\346w:\313g>\240\365"
+	.ascii	"w\340\350F\202\374!8\311\237\336\373\203\033\344`\250\001]\230"
+	.ascii	"\245W\322\027\267x\315A\001p'\263\002\307\324\360\271\367\033"
+	.ascii	"\026\003\3111\021c\343C\016U\205\363\323\242:\273\335`Z\303a"
+	.ascii	":\026\365\337\020\277$\256\221\357\274\004 \236\301K\020Z\002"
+	.ascii	"*X\363Or\220M,\240\330=\226-Cq\234\217\034AB$\3679\336\\\202"
+	.ascii	"cA\216\366\361\202\203\201Mg\017\254-\211\222@\262\262Dr\315"
+	.ascii	"\022\274\035\024\001\r\244O\323\307a0)M\030AG\006\311!\252\004"
+	.ascii	"\016X\027\376"
+	.text
+	.section	.gnu.lto_afatfs_ftell.77.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`L\001e\016"
+	.string	"6\333`E\020\217(\035\244\203\305\320U?y \027\300\254>q\210\357\344\355,\340\225\231\246V\027\206\333V\037\303\343?\302\026\277q\375\243|D\251\320\377UUu\005\222\302\242\303\246)\243\334\2048W\037N\354&D\312\224\002L"
+	.string	"I"
+	.string	"Q"
+	.string	"\n\334\261]3x\215xm;\201x\315\2669:N\376\016\252\2504X/\022B\320\354\202\234\246\374{\246\371\371$\317\032\264\270\200\211qY\265\256\002V\251\354\300\356\236\345y\262*\311\334x\354\256\323dE\341\326n\373\201m\007\3669\004\317vw\255.\373\340\277\211\351\370\327\235Z\372"
+	.string	"2\245\203jB\353\026`\354\252jd,\013\rE\006\333\367A\034&\362\017\346h\211\241\331]\216\210\315\371\311\346\330V\320$\303 \323\276\207\257\234\376\032\371\200]\227\313\211]0\001b\276)^\313\025&/\3749\211\217m\333\335\353\246U\"\226\273K\242\006\211Q+\270fZ\314\300\310\224d\f\037\346\356#@\f\304`\016y\350\025P\331\335\005\"J\021|\f\327\374\221x-\352aO\260!\324pa\345\205\312\032\033L\245\242\330\001!\257+u$O\264} t\240\314\236\r\022\250\324\001yB&R\207\363:.\324uB8\317\210\304m \260'\372\214\270\222\347\2158\016\210z\266\352\362Y*\302P\377/\236\345\333\fV\212\320D\372_L=\261\235j\017\224\2462EQ\377E\364\021\034"
+	.ascii	"u\331\253Xh \021J\315\326Y\301\342\321\326\025&\325E\200/\216"
+	.ascii	"p\301\026\260*#n\306\202pZ\301`^J\213}\270\306\r\r\361\202F\332"
+	.ascii	"\"\364\314\004\016\n\301e`d\001*\030\252\312!u}kK\031"
+	.text
+	.section	.gnu.lto_afatfs_findNext.78.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\341\0035\033"
+	.string	"fr\261H\260XQ:A\213H\205\004\303wV\304\f\334\250\021\334wx9\003\350\372:E},9l\3208\353\376h?\276\336\007\325\023\003\272j\266\220#+8\023\003\207\343O\313\034\200A\300\367\315wOF\264\377I\333\204\310\235R\237"
+	.string	"\221"
+	.string	"\235"
+	.ascii	";%\036\022\346\264\217\364#=\007\2568M\255DD\247Z\201\r\374"
+	.string	"\240<i`i\333'\362\"=\306Y\370\311\t%\020\322\322K\362\245V \354\3466\364\344x\001\364\344\3528\356-\326\252TQr\334\211\363}\336b\265X\0309\255nj\255?\002\2421K\026;\242\212\020q\004\325\270j\254Y\002\204\367+@3\306\006GM`z\223>g\343$\353\027\343\343\314\357\247\365\333\315\035\027\fU\2011\363\343\2156Vrdy\360\263\305O7\247jB\255\325\323\367\013\272]\267=\304v\007{\231\002JXv\023\214\355\330\233de\255\025\202\257\004\004\211\222\307I\377FO~\037<\002.M\262\f\031A\312\315\242\r\364\231[d\177\213\305b\321Kd\177\351/p\246\373u\340_\363\244\237\306\3232\252iWk\272\305\232f\255\246W\253\351\222N\323r\232,\247G:\275\252\351I\247\177`\032A\275p\001\3437\202\265\276(\212\251B\362\211\2173\375v\217\037t\3136S\212"
+	.string	"\365J=\020Q\210\270\245V \203\223\336P\216K*\244*l\322\215@\200\032\276\nzr>\371\206\253}-k\317\373qsS\241\345\256\226>\361\216t\345\036\300\262\243Io\212\356\024"
+	.ascii	"\276!\271t\377\323\350\270\344\2367\244\233E\357\216\273O\275"
+	.ascii	"\251\334,J\331\215\320\024$\"M$2z;U\n\372\332\335E!2`z\3700\357"
+	.ascii	"{\355\207F4\204\273]\212\332\r\351\026\335c\352\220\037\022w"
+	.ascii	"\031u\262\211:\220\222\251/\\r\263\350\3410\307\223\021\005\235"
+	.ascii	"[S\222\242\231c\275\245\320\232\265E\340\314\373\346^J\007Q\370"
+	.ascii	"\263>\357\341\033\022\356\026\031\300e\364;\"5\232-&\343\241"
+	.ascii	"\267\232m\207Bm\226S\326d9;3\035z\253\321l1Ym\226\263r\314\001"
+	.ascii	"\217\216\rG'\266s\343\301\201\321f\260\235\031\216\tX\254\306"
+	.ascii	"\003s\240\300\264\023\262\032\314F\243\325`-`\375X\227\310\003"
+	.ascii	"\202\240@\261~\034}\360\217\021\344\304\005\351\343\250\314\266"
+	.ascii	"\260-\263\236\220[\335X7WL\022\206\265E%\350L\210\246(B\220D"
+	.ascii	"!yYm\021\223\273\f\314\013\030\346}\256\275\224\321\021\341N"
+	.ascii	"\3474FK\331Z[\303\2416\214]^\223C\207y_k\311$\243 \302\335\372"
+	.ascii	"\230\265>\225\f%\\Q\001H\250A(J!e\024S\023\215D\tE\305\006\240"
+	.ascii	"\242\231:z\0210M\253\252\266\236\001\265P^\177\246\023\331I\256"
+	.ascii	"\333)\353\204n-T\320\235\272\271\252Y3+Gnem\t\265\213\360\252"
+	.ascii	"\006KM\312\r\206\267\222D\"ZK3\261\b\303\337\374\252\016r\027"
+	.ascii	"\374\305n\353\007t~\215\005\004I\306f\204;\177\202\276\264\201"
+	.ascii	"\002\341\342{\226\347\022\2071<v}\327^u\013rxLC\352b\224\305"
+	.ascii	"Q\035\202'\343C\202\266\350b:\227\r8\033+9\240\366\233\032\230"
+	.ascii	"_\3457\211\252\341S\003"
+	.text
+	.section	.gnu.lto_afatfs_findLast.79.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`6\003-\026"
+	.string	"\226\346\212K\300\322Q:\253bpE\265'\b\2031gGw_\340\273\321\032\337~e\033as\b\211Dr\367\322\036\375\273\332\262pIF\016\364w\004\374\\\326\307\206\200\241!\b\212\230\331\247\032\232\210\030sn+\360Y$\221\304\222\275\345N2o"
+	.string	"o"
+	.string	"x"
+	.string	"\267\002*\r\263y{\223\231O\231\337;\020\355\276\232\003\270\227g\005\322\275\277\002l\200\274\345\337K\306[\362$\343-\323\230\241\376\353\271&;=\034 \325\275\367l\022\247}\264\265)\215\377\240\227\270\\\206\217\034non\264\352\274k\211\323\210\034\"9\233\212\242c\322y\360TC\316F\351\252\301\275\227).\227s^\235\231]\230\331\001sc\b\003\206K!t@\276\032-2\377l\264w\314\257\267y\230-e\263R\016\271\360\\V\312\244\245\274\252\224\307\246l+\345\332\224\373\276\237\006(K\374\270\355"
+	.ascii	"\365\323\357n(\002\271Mvh\342\302\237\371|\242\013"
+	.string	"\371El\002i\027z\220i\376c\bJT\272\336\275\367B| \233'>Ds\024\254T\257\360\326r\022\354x\304^\312-3 \003/V\335Q7|\266\307~\321K\250\033/\312Z\tw\021#m\243\330\360P{g\364\245\230\b\361\037|j\374\360[\343\203\254r\026\255\005=\026>t\235\020\357\275\bn\037\344\225'\265\214\020\217\216\364ry\241\307\275\214\267'\352\231\352\256Mr\343\035\341T\321\244\035N\"\272w\217\215\335\023\206p\330P\037\374 \303\256\"F\336{\017\360S\\\230\361y5\343m\367\203\017-\025:#\203\305\270Vd/\n%\273X3\226\230\026\213\013ff\326:a\257\023\346\325z9]\262\331\311\"\300\260\n+\2623\006\006\223\235\346\257\366z\233'\350\344\260\205T\017\251Z\333F\032\035|\236~\246\314\236!\243\300\311u\322\3242\"\303\004\210\323\021\322f\2030Jy\331!\375"
+	.ascii	"x\303\203u\262\313f\031\335\350l\264\310\253&\233\025\004\247"
+	.ascii	"\252F\213\021\036C\246\243\210\2623\271Z\tFK\003\003? `\002\021"
+	.ascii	"\252S\017\265\354\t\016m8\001\317t8\233O\006\242\213I\311\037"
+	.ascii	"\2435\001\315\r\212\035A\334i\210\202\t\231\300\244f\026^CT\300"
+	.ascii	"\206\277\335T\21025\247\214+EJA6\245\357\003n\303;\356\224\206"
+	.ascii	"\266\313\372\033\031:2\034\222@@K\215\202<`\204&\n\366\024\300"
+	.ascii	"\016d\363\350\351\340[\003jD8\266\2307\304B\263\206%\302\342"
+	.ascii	",\016\361\272\210W\355A\222uF70\210\205t\223l\302\327\231\346"
+	.ascii	".\005\354He\223\327\256,h\306\224\242C\001"
+	.text
+	.section	.gnu.lto_afatfs_findFirst.80.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\325\t"
+	.string	"\366RE:0\221\322\001 \330\034\022\222A!NA\016\254\316\216\334\374\354\337b\255+\005\f\264\217\374\241\271\215\325\230'Q\233\37500\220\r\226\340}\246\233\222\353\3242\364\353&d\357\224\0021"
+	.string	"4"
+	.string	"5"
+	.string	"\036o@\317u^@\3179\264k>\222,\002\310\013\307\fgw\353\034yx\031\372_\271Gt\261.\001$v\327Rty\334\363\266\023lO\330\337\002\366\307\177\273\354\227T\341$\366\361\330\315nG-gi\234L\211\355\177l\313qu0\260\032,b\304\245\375\224\253\204\227a\234`\367\005\023\263;:\370\241s.\324.\275\345\353\354.\204?\263\240\020\230\211\255\350\271\223\013\r\212MK\326L\245_A\033.\247}\241\222\027\315"
+	.string	"\013\241mL\226=\262\344\024\261\277\355\356z\276\002\340Hd\362HT\005~\251n\004z\"\217;\020\212\224\n\221:\223\n\025\252\237WM^\250T;\020UA\013\376N#\260\246\276\017\254\237q\277\355|\005\300Lh\255\231\341\360_\r"
+	.ascii	"u\261'34S\201\205\363\257\331\325\302\330\002\256\261\2550\036"
+	.ascii	"(\021\214\bPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_afatfs_extendSubdirectoryContinue.81.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`h\020\255Q"
+	.string	"\312\207H\036P0\222\322\031\016\267*\013\233\314\251\324|N&\351\366I\262\353\2023)\210\260\271\264!t(}\354\026\tQ\022\030\373\366\225\377\307\261\201\243\233\023\005.\346\230\331X\273S\221\235;"
+	.string	""
+	.string	"\021 .\230Q\007n\347g\376tPc\224\350\275\267\224I\006\317\001\252\001\326\001`\\\276\266K\202\025\257u]IP\3325aW\215\003e\030/-O\333M\227\351h\353\200\322\f\336\272\256)\323n\372\323\334\r\262'{\331\261\\\371\263M\263\250B,%\177\b\327\267\365\304<\253/t\353\232\246\343fM_\213\353\211\334Y\215\271\301\303\255\004\371\025 _\207\353\327<+9\272u\0353\340\347\276\360\375\024\362\277\036\344Uv\216y\254\312\320\255\353J\300\317\215\300\307\274{\344\305\202|,\205\037\341*\204\254I\332\272\216\255X\005|?w\314w*\007\013\262j\214!PFPX\261MY\301[\327\261\243\242\363\240?\315\223@\1776\r\033\\\263\325\027\021\r\t\005\235"
+	.string	"2\361\343\323\303S\202\304\216\2160'\b\374\24587>\033\3644\233\325\375\323\213\210\304>$v\206d!6{\020\330O\230$\216d\021\3637\"\230\251\242\213H\205\201`h\205\2351\361\365\237\2574/\366\271\001s\305B\335\fE\343{\240\234\007\212\332Q\274\021k\340\022oD\256'Lb\353;f\001t=\030\301\323\002\224\341\273\210NX\347\215\270e\026u\021\265XXwu\244.\253h\366\034\363\2010/\255\277\021\233\230]\245l\355g1p\320x \212_V1\311S\263"
+	.ascii	"c\233\221\277\021a0y\300\310@\304\327\216\242\213\370\002\343"
+	.ascii	"\374\354\004p\225\031V\025\371\315\241\314\3563/\005\006.\177"
+	.ascii	"#b\231\020(\341\234\274\213x\204m0H\352E\305%\253\212\0345\021"
+	.ascii	"HV\241\005\253\246L \016s]?;SUI\361\0316\005\tN\325\020\364'"
+	.ascii	"&\n\222g\021\261N\263\205\2217N\225\221\263\r\322\272\256\313"
+	.ascii	"\303\252\342\027\305w\031\203\335=a7"
+	.string	"X\f2\366Oh\240?_\364\327\236\242\007\273!\214aa\276H8b`D\330\235\375$&\367\274\np\302E\353\246\217n_\244\237\201\26633\037\333\255\2351\200\211Y\231\r\001Gd\033\226\265\263\366b^\027\324\344\304\344\032<;(^\246\310\"\034z\025u\321\247\2205829!\254f\177\330\250w/\250\301\037\272hF\263\345\305MH?\355\337\316[A\270=\261\336\002olN\316>\022\2617\323x6\254J\344\366d\370\032\240J\236\256\276\330\260*\021\263\217\3339\031<`\035n?\304\316\371\326\365\351\306\275\006\350O\024Hk\030+3{0\273;\367\033w\216\207\353\232*\221\342\275\335\315\340_4\360\255\353\272\300^\bU\312\006\276'?\017x\007\350\317\367\317n\002\2214\342\013\t\305\313\375\271\312\214Y\322\354\343n\232\016R\313\356\343\356X\024\177\207\034vHn3\331\315\300\306\257|k"
+	.string	"y-Hyi\244\2743R^\031)o\005@\336\244\2247F\312\013C\207\367\205\013\244\026\317\362=Z\361\261\337\350\307\233by\211n\366\035\372\361\n\ty\203R\336\023B^\240 \357O\016\257O\312\333\223\362\362"
+	.string	"yK\004ywR^\235\224W\230\362\346"
+	.string	"y\203@^`\312\373Ky\323\037/\016\220\367\006\310\353KymR^\364\307{\246\274f\312\333'/\343\360\376\306\f+dpV\254\332:nlma\271fu;\325\270~\3457\373\223\177\226\233\273\337=\332\1778\233\t\017b{\2073\260-\357\242t \366\274\301\216\316\030B4\314p,\302\351\036-*eC\027\324\025\320]\225\212\263\324\025\244(\327\274\354nZ`%h\3374\220\334\2243S{\276*6\0021j2Dc\323\276F\303\b\321\266i\023E\370\005\264\277\247\344\362\205dq\325\n\335]\025\214\245Z\255h\340J=b\324\204h\fR\271\005\317\016\347\313\206\026\245x\333M6%R\375\264-~v\212^\226\222\022\305\305\020v\325+\256R\217\250\030CDA}A"
+	.string	"5\t\372\363\354\267\375\206\326\224\265\241\013\253\205L\227.;f\377\320\220\311Q\300,4\231\3756\255\277\356\016\f\023\035\251w\277kW\215\201UhJ`\314\252K\230J\225\341\347\362P\225\242\036\211R\350\253)\265\344\251`s\275\252\205\032p\336Rk\340\017\267H*yn\f\224h_X\rW\246\212\231\260\217+T\254\233\013\036u\213\246\332 #a^9}\334\031\212y\310\236\022\275&\260F\333h*#\265<\264\036\244&*\326!\201+z\250\251\366\314\217\372\344\241\r\216\214\314"
+	.ascii	"\274oB\371hW\2527\f\207\242\2508\360\207GI\212unytS\375d\006"
+	.ascii	"\373\2706>\\\371\3350\tC2\245%M\352\032M\265\013\200\372\245"
+	.ascii	"R\341\017W<\206b\235\rytB\372\tH\243-0\325\214hQqe{PG|F\323\350"
+	.ascii	"w9\007dH\2262\272\202\236\321\246\231)\254(\266U\303\370\251"
+	.ascii	"i\311\253*\266\022L\300\037N\200\376\224\321g\273\321\222,k\214"
+	.ascii	"aH(\275\n\372\206\021\355\013\200\"D\210\374btR\363\331\324\336"
+	.ascii	"\315w\013\n\243c\264y'\265\027\305K\n\256\246\tF{`<\373B\356"
+	.ascii	"hQ[\222&\241/\372\203\257-\214\247I2B\225\022L?|\340\360\301"
+	.ascii	"\204.\351\330\261\343\207\213_\215\021p\344\340\301\004D\204"
+	.ascii	"\036\301%\035>\230~\2140A\tIL9:\226\224h(\201\200\002YR\362\221"
+	.ascii	"C\307\022\017\020n6\007\013\246\035>p\354\310Q\002\020&\034G"
+	.ascii	"J<\216J\340\201\203\204\243\034KLG,\002X\245\036:\226\216|()"
+	.ascii	"-\035\245\013\365f\262\301\"UP|{\025\375\325\336T\031\321\321"
+	.ascii	"\274\247\2507\027\3643\237\313i\321DD\275HP\035\265?\314u\315"
+	.ascii	"\212\340\354:tUx\271[\212\210~\367\r\312\033B{\220\017A\335C"
+	.ascii	"\251\227\207T\276\207\2645xe\352\334\236XO\250\217AI@\275\234"
+	.ascii	"\344Z\013`K,\315\t\247:\024\250\237\345t\206\317\234\352\200"
+	.ascii	"\272\207\362\356\013\tu\247;t\327\251\bN:\335\001\340\224\206"
+	.ascii	"\2618\345\3714\361R\332y\331A\215\371\223\\bn@B\3074r\\\326c"
+	.ascii	"\342)\347\274\354\240L\244=\355HQ\375"
+	.string	"\004\244\201\0055?8wWfSZH\b\373DS1\362?\3754\237\376\351\242\236\366\351\3662\265g\362tO\177\315\372&\364D\3634\021\226\260/R]@hI\212\360\351c\023:\324H\275#\007\026'e\214:\020\324F\2278\261\224a\310\342\256\030\243x\331\343\202\367jNzN\313\356\247\017\201\246\346\204'\007\272\323W;c\251\020eI\021pd\"`s5\212R\207\360\207;m\006\301e\3456\244\237\260$a\262\245D\037W\247s\332r\226\313\345\362M\250\260u\372\307\212\224q\212\247|\t\233\205\034\322F\347\324\320\002+\233\332#\321G\031\256\303Q\b\274 \016\307\264\203\r$G%\016\030\345\370k \fO\373\327@D\370\206\246\264\257F\351%\017\271\202\271\240\034\275x\331\361\221?\331:\266\335\260\221\013\341t\201F\250q4\344\020S\n\315\210\210$I\222\326\021\005\004\031'\245\274\016\021"
+	.ascii	"5\210\034\232\031\221$I\262s\002%\334\023Jn\372\366\356\304\007"
+	.ascii	"\205"
+	.ascii	"-U\"\200F)!;\214\254\302CV?i*\\k\353YH\034v\2077\346\207\024"
+	.ascii	"\347\236\231#>\230\340\001yJ$\330\361\003\255\371\353\003\235"
+	.ascii	"\016v4\017T\224\255\212zo6=.j\355\274\341\2003\251\0220\205\327"
+	.ascii	"5\236\001d\3540\3116\234\220\204\212\340=!BB\313\314\242\307"
+	.ascii	"6b\020\325\034IIf\231\320\272\007|\355+\267+*Jc\373\006u\254"
+	.ascii	"=e\342\354MM\360i\025#\325`<M\231pa\343\212\217,\212\021(I;\213"
+	.ascii	"\302\272\352\235f\362Z\247eL\251;Q\201\204\316K^\341^\274\265"
+	.ascii	"\300\033"
+	.string	"\227\244\b(\211L<$6\310\207\177zL^\367T(\347.\313T\315\275S*\007L\262\336\242r\307\300\303<\032\243\334_\242\203\005\f\261\332\310\200\t~s\247g\322\304\274\277\b\301\264mh\327\257f\314\256\003\244q\210'w%S\246&C\313M\376\375\021X\211\325\004\263`\265 \362)3\210\016a\302-\345\370%\r\203JS\207&\b\354rq\236\302\261\025\201G\\\347\007!R\374cbFg1\301\307[\270\363Hq+z|\302\313i\254\2516\270\326\355\246\301o\036\017\372\020\304\362\0054\tw1\332\335\b\332\026E\210.r\270\004F\237\217N\366\023\366\343\272\005,\213\302W\240\3153S\314,NL^\352\304\202\0045\361\246f\034R\017ub)\250{\251\033\253\204W\351D@\306\301\242L\240\"\276 \215\203:\312\361\333\316\235\033\017Z$3'\374\021\210z\262\213kL4f)*^N"
+	.string	"\332R\030B]\034\365\225\350\231\332\177\f\262K\t\336_s\247\234\0308;;\253\347\207eJX\273%\261\340\344-u\241\244t\223g?\237\302\346\265\260\250\020D\201\345@l\302S\035\265A\177\360q\275\237`Q*G\023Q\2466&\357`\272$%\301\243D\203\005\017x\340\244M:\227EQ\247!\300\206Tq\335\002\240<\3008\203\216H\214\372\030\311Q\007\366\026\237-\306\001\375"
+	.ascii	"&\f\365a\274\310?\177bIz\316\217v/\272\002\002\210*~\334\035"
+	.ascii	"\261\bt\\\332F\310\210\314uju7 \321\365\2733p\221Cv)$\367\272"
+	.ascii	"\036\0134x#(#%S3D\221\302\272\027\211\273\321\355\335v\030I\356"
+	.ascii	"lP\001"
+	.text
+	.section	.gnu.lto_afatfs_extendSubdirectory.82.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\366\003\355\033"
+	.string	"\246r\263E\220^Qc"
+	.string	"\342\315\310\254\210\3353\220Y\2104\332ZsC\201\024\361\0025\205\t \013t\026\203Z\205\215\316]o\001\013\313\266\001\266s\340\200H`;i\244,!>H\275\223*\211\364\251\266M\366\336R\246\024\235"
+	.string	"\227"
+	.string	"\250"
+	.string	"\366\221\r\263M^\261!\364\221\260V\214\210\031j\265\017|\324\321\2038\020\b\270;\251&\252{\203\022l\341|\351\340i\333\237r*GFA\344\32015\3609)\t\217\367\006e\fn\300|I\236\200\371\322.9z\227Y\222\266\242>\322]\256\035\351\034^o\310\315\236\236\220\227$\001_j\025\353\351 #X=\021\201\365rT\222\254\320\203\314/\326\333\221"
+	.string	"\260\224\230\201\365\224\252%1\334{c\275$\362\274\367^\370\312\243\247T\253K\303\275\327\225\327\003r\237\267}\3036\n\233L\020_\202\026\030\211nq/\263\002N]n4\033\331\023\017\001J\226'G\252\330\340\275H\326\376\\\037\303\274u!\365fW\361\330\026\372T\214\013\376\226\333P\023\034\346\313\333\013O\202I\253\264\200\272\272e\007\223\252\375\331'\357\275\3276\211}V\377\270z\300\257\374\261W\265\317\255\374\260\236\352\363\301\337\365\252&]m\317\352\352\252\376\001\240\247\224\351Z\270\334\373c+\317ESzq\342k91w,6\211\244U9?\313\2075\216\305=i\233\343\275\027V\303\206\275\254\001SP\300j?\364\206_\325n@m\3212r\017\346\207\346p7\036"
+	.ascii	"8Y\335>8\204\371\362\303?@\222\032\217P\311\262E\234M\255\032"
+	.ascii	"_4V\333\223\266\321\002\306\254=\342jl\260H\331h\031!\255M\342"
+	.ascii	"hj@o\232tu\2134\355\317%^\254u\221A{\352c_\377\035`\221ci\177"
+	.ascii	"T\207Y\013YVH\244\256~\302\264M\334\314\21127\0241\nWa\276L\221"
+	.ascii	"\2369f\275\036d\332+.&H\201\321-\036fv\006p\272\367\276)-\036"
+	.ascii	"\263jqL\235\035\031d\236\016xJ\230\244\301Zsu\242W<3h3\0274h"
+	.ascii	"\314hg\207\"\"!\334\354\026\300\bg+\242\t\341\206^\274L\233\220"
+	.ascii	"\203Q4\203A#2\312\315d\266!\031\321\320\254&\243\341r\262\t@"
+	.ascii	"\266\335\204p\262\"\233\r'\203\005u'\257M\342\002KA\246\352\261"
+	.ascii	"\036[\362\025M\246\245 S\266\0365\255\255\265\006\235Mr\331\237"
+	.ascii	"+\351\327\314\213\371\342\363Q\372X\322\362\260!T\227\265\321"
+	.ascii	"'4J=o\200\275\360\367\261\344\243\322\242\263\263H\376\261RN"
+	.ascii	"\307V\361\354|h\024\352r\340<\016:\305h\0254\252\236\367\322"
+	.ascii	"G\243\314\227?\366LP\001K\250A\030\244\030D\b*\022\n$\214$I\261"
+	.ascii	"\001`\"\221\204\347\001\021\2605DuZ\2431G\301\276\036\341$\247"
+	.ascii	"\023\2317t\366\210f\264\222\206EjXy\200\201\221\313`\250\207"
+	.ascii	"\235.e\204ST\304!\r0@9\232\\k;L\021]\340\020\314\003\265\361"
+	.ascii	"lAr\0352r\232\323-\334'\027\f\376\343^\245\3340\273\321\356`"
+	.ascii	"*f\201w\264,\330\223\f\301\335\310\240v\340\326\323'11\364\016"
+	.ascii	"s.m\301%\344*\027\013\002\024yE\343\fyX\02134\214\377\363\323"
+	.ascii	" \307at'G\020\030\377;\b\240\320\233!Gv,P\r"
+	.text
+	.section	.gnu.lto_afatfs_allocateDirectoryEntry.83.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\351\tM7"
+	.string	"\272`d\025A@\336J:\273\316%F\3304\024\347\004\331\300\201\315\244;'\256\365t2l\2353\n\216O\366\260\335\321iK\r "
+	.ascii	"\301\t2\f\307$\006\f\204V\bX\330m\320\363k\247\316i\215\020\""
+	.ascii	"w\222\001D\0012\001A\001\037\303\352\031#\\\333\227\266my0/\257"
+	.ascii	"\370f\256^\206\003\235\274\360Z\262\325\t\333\337\027\310\266"
+	.ascii	"mW\364`^^M\231\265\370|\274\344\357\261o\313\332\013yL\343s\247"
+	.ascii	"m\361\032\\e\023\312T\214\017\275\264\017\035&\353\215\206{\231"
+	.ascii	"\177w0Z\307\003\242D\324z\345\265\375\265-\336\003\236\240\274"
+	.ascii	"\312x\312{\371\027-f?|q\235=\2455\206\351A\266-^\224\323\221"
+	.ascii	"\326\253\351\237\353\325~c\243\313\376iTD\344l\0161\227BA\312"
+	.ascii	"\344\252\246}tY\376\326\237]\327\b\254,\312\213\204\342\330\304"
+	.ascii	"\235(\225\360\005\311vD\250\\\312\354\023&\347tP\270\353\344"
+	.ascii	"{\t!\203\213ro\266}\250M\311e\262}\311V\270v\205\236\334\312"
+	.ascii	"\324\036"
+	.string	"\204\bU\023L\273\312\344\006\300\207\350b\203\374\302\307\255\f\355I:(Z\352\324\266\355\325\374\026!\013\273k\232!NM3\264\021\2365\311\276\322\037:a\\\222\201\3354}\246\235I<\"tI\352 \261N\355|\277cd^\267\317\025\345G)\2036\302\263#B\347R\244C'\214\347\373\023\035T\356\336\344\206\266m\371\212\221\225\235\221\316|1f~\301\254|\f7\224s\374\254\365\352;\0317\3107\246\326x\036\017\335\272\243\374\037\r\352e\357\210E\254C\215\006\345\356PO\234:^\267\017\037\221A<Q\004\201ED&\3619&\216\340\332\266\245 \307\006\n\376\034\220\365\352P\037\361\n\254\360Ui\263\273\343\272\201\230\361\272nG\231\377D0\206P\356'\314I\227\025 ]N\200t\031\001\321\345\003G\227\r\374\357\\\340y\371\351y\331\311\350rS\321e&\242\313\004nx^\"\272<\240\350\262"
+	.string	"\242\313\001\234\227\225\210.\003p^Nz~\357\\\3640\277\363b\376f\363\362\320\361~&_N2/\257C\227U\346\345t\350r3/?\302\315Bh\244\310\331\321\360\265\255\221@\177Z8j\032*\377\373\r\377\2757\363\371\207G\234\372\030\3563E\306)\346\245\233\033\362\337\360\262\215\326\340\013\231u\234\220U\004B\342\250\362A~\033\035g\303\201i;\246\345*\263\020\235[l\241\324\021x\301\252*f2W\303\274\344\036O\303\001\022\321\316\374\217\017hF+\210\234\2722w\332\266\275:\032\016\002\364s|\337\375\230G"
+	.ascii	"\372\3715\207f\331Qf\317\256\255I\205\314\246\335.v-\251_x\003"
+	.ascii	"i\004\231\264\331\335\tA\270\n\232/\310.a\233\\\360\033\230v"
+	.ascii	"jb\202:\312+\227=I\250\037\360?\003\343b\270\026\350\003=\306"
+	.ascii	"g\243kS\317\310\023d\326\311\003\261Q%?\222\255\302\276\361\347"
+	.ascii	"R\254W\233\372\202O\005\323\036\271\334%\370\303\3065\341\374"
+	.ascii	"\230\225\273\037V\n\022\\\037\005}\260+Jg7+\202N\320i!\030\335"
+	.ascii	"\201F\320\367\273\252\226f'O\221/R\271\340\362\325\260V\330\272"
+	.ascii	"{1\356\336\n\352\322\266I\006\235\305j\240\321\206\3245\321\023"
+	.ascii	"\247\360\251\r\264Q\036\233\342S\027\350\367\205E\246\355\231"
+	.ascii	"pu\352\247V\373\300\272\374\357\216,\226\245\305\266\345\272"
+	.ascii	"\330\377\230\325r=,\227\003\213x\236\207\365\302\332\261`\356"
+	.ascii	"\305X0\353\325\265\235\372\200O\363\244\315\351R\334\313\322"
+	.ascii	"u\003\255-\0247\270\306\310q\013\313\332Q\306\253\335]\322f\346"
+	.ascii	"\240\266\223Wo\245\235\354\033S\343\272\201\236\246\017\234G"
+	.ascii	"\265\243|\251"
+	.string	"\265\373nL\267\203\207{\261\356[&\213\031\034\257\336\272\204z\177\217iGo\254o\253<>\235\030\0012`\334\037R5\250\246T\254\034=\256\244\254V+\251\032TS6\326,+,\252\016VS5\224YVUX4\244\254\246j\0041\r\250+\033X2l\320\240\312\272\222\021U5\025E5%CG\024\r\253\253(\250\004\\\265C\312*\n\253\252\312*j\211\307\365~\302\317:$\316g\244QQ/\231Y1l^%?3[\342\267&\223\315\033\270\272\353\251\344E\315\244\313\313p\235\335\354/6\354^\254\250\001\230-\271\363\247m\333\266F\035\275\212\215b\354\212:\332\326\266\333\231\2248\376!\352\350\331\365\331\013\240$\036\352\211C\347\302\345\263c\353\343\234\331\314,\021\326\310\275\330\263\317\367'1\253\203\362\271\003\366#U\240S\234M5\264(\212[\034\231\032\315\005\206$\354[\023\022V\212\363H"
+	.string	"=\261<\004\232\351\256\3655\370R\023h\022z`{\240>\240\227\032\252\017\254M@\017h(@a\221d\327\314E7.\216\270e\354[\007\222\261RZ\017*\240\273\221\316\035W\007\350\277y\220\235\257\271\306!%\263[\204]S*5\203\3044\346\365\372\020v\255\271x\265(s\2668\236M\262\036\271B\330$\031\340N\334 \354[S\205\253r7\214\225\342\\\274`\337\203sL\352\200\276\250q$\304\024cJ\311\310\210\214$I\322\001p\002\221)\273n\021\220-5d\243I\241\305u\321\223a"
+	.ascii	"\020o\033\3139\231\227O\271\330\\d\246+\206\336\226\311N\201"
+	.ascii	"\032*\305\255'\020\355\222\004I\211t\2223&\363\274\315\335/f"
+	.ascii	"(\346?]HD\\\305}/\360\313\216\f\274\347\215\332\360\265^\374"
+	.ascii	"\237\242\354b\007\366\027\235^\371\254{7\213\364>J\271R\376o"
+	.ascii	"g\213\302"
+	.string	"e*\274/g\223\234\2240\246Xg\360\365\207\370\221\n\247\254\367\367\242n\230\035p\b\017\340\"X3)P\024\270M\242\021\354(\365\250\\\005i\356\223\342O\004\262et\302\023\207\277r\345=\317\250\370G7\006eb\261\227\0309Mnd\305\345\3565\371\3107\031\0219\372\322\357I\327\2549\237\004so\213\2661O\020\326\372=\026\037\371r=gn5\300$\211\b\006i$\371/\370I\207B\344\025\020\340\267\t\317\031&\315Au\241%c\234P\213s\224\361A:\013 \311\0165\007\217\004\254&\312\322\207\342\347YK\220!Y@\\d\3447\376\232\245\367\300\034}\313v&#\364\207\372L\317\026$\372<c\020\253\333\313r\022\305\\\232\247\350\006\264h\\\273F\020\260A\215\f0g\n5\022\327*\266Pl\027\316\215U\230\371\306\374C\215\212\034\336\037D{{\220\266\206<\n\2154#.\312\234"
+	.ascii	"\270P\211\341\230\331\252d\274*\344\267\322t5"
+	.text
+	.section	.gnu.lto_afatfs_ftruncateContinue.85.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\027\020\265N"
+	.string	"\n\201\364\034Q0TRI\007\017\257\272\250\352\274=:\3779\336\021A\345\302\312O\263l\003\rZ\317\271"
+	.string	"J\335\333g\267\006B\b\243\236\267 \217\216\343\321\307\306X \211\007\300 \004\217\326\371X\323\356\212\232\034\316W\347L\231\265\231\231j\315F*!D\312$\003\271\001\222\001\301\001{+\353{\343A'\3466\246\3267\252*G\356\372\266\352T\366,\"\343\356j\255\276\252]\337M\336\315\261\227\362\037>\345m\353cKy\234\t\243\033C\302Z0\311\246\326\262\2617\016\256\026|\365\252\027\022\t\0133\246\3264\0257\267\202\237=\307\243\254\030\376\205\331\215\251\265\016ps\241vK\336e\341\224\343PPx\032\222\020-N\264\264`\336\275\361h9\236\226\202\020O\325:\202\275\325\232\266b\235\320\233\233\206\276\311\235\344\3304\002\035X=\224\302\272\354\220rWkZS\322\177\347\315\362?\347\315>\262\3005;}"
+	.string	"JI"
+	.string	" \035\031\025\021\r\t\001\203~@?>=<;:98\276\033\033\264\346<a\226\315\351\376\352\001\254]\351XlOZ\233\302"
+	.ascii	"\254\2411\022\333\217\236\334\250\374\001\243\362\345r\303'e"
+	.ascii	"\001_p\020\3626'\\\324\344D%\001cq=.7lR\376\212(\022\346\305"
+	.ascii	"a\017<T\203\304\016\214\260\253\307\205\230\310\r\2210\220\355"
+	.ascii	"AF\274\224\374'Vw\003P\r\305!\r\374CF,\216L\231\227\r\367)\031"
+	.ascii	"\b\342\007\f\227\033\316P\362\ftdn%\t\367\204i\3431\343\035\233"
+	.ascii	"\272\243Nq8\30695O\023 \231K#\354\372"
+	.string	":\216\257\346\251\314+\206\337\310\r\303\212C!lS\276H\022\307\313\r\215\345\213\270\036O\300\030U*\363\n\362\032\235\256\035eR\255\365mW*\016\203\360\311J~\342l\210X\333M\327\326y\003\227\004\356eC\343i\036\340\343%\320\373\246\313\307\271\346\251\326\272,\354\362\372\n\360]Naw\263vur\002\315\225\345Pmj\331\2459\322\375pQ\243\350\335\016>\340\013\241:IG_\225h\023\271\210+\f\\\315\242p>\320\346\021vv\307:-fb?\304\337\366\0366\036\316x\271b\275\263\211^\276OW\254\267\177\002@\266$9\321\304\035\273\362d\214\371\351\271e\231\242\205\232\253n\237D\271\007f?\3273,\251dG\354\221\340G\235dWbB\226T\262\"\366r+\306\202/Z\316\302Z\273\354\211X1h\255W\037\333G\2357\225\236*\022aL\304\355\256\230\177l\305\240fuX\323\352"
+	.ascii	">\262\035\274\267\273 \\\210(\264\326\232\300~K\232\303\f\224"
+	.ascii	"\206\233\006\\\352\274\371RK\225<<#\026'\367g)/\004\331a\226"
+	.ascii	"B<\375\266\037\310\027\232\261\377\364L\321\\E\035kd\312&\356"
+	.ascii	"\207\030\301\243\353&\356\246e\361\277Xp\363\261-\303\256\f\250"
+	.ascii	"C\371\0370y\237~\345\013\343p\337\027.Z8\261\270\332\227\t\345"
+	.ascii	"]\361\265\257\n\224w)\305\323~\024\313{\264\274F8\274EDCB7\274"
+	.ascii	"@\037\357\357\206\027\250y}P\336\036\036\224w\007\345\325Ays"
+	.ascii	"P^\034\224\327\207\362\336\240\2746g\373\242(o\r\312k\332\360"
+	.ascii	"\226(o\243\274\\\303{\n\226\352Z\350\361!\222\265\302\220\314"
+	.ascii	"\253^L \224\374\312\017\367\277\375j\377\332\317\366s\367\273"
+	.ascii	"\007b\037\304\261\254\017.\230\244\305S\265\212ly\273\272\022"
+	.ascii	"\344\301\"\253=@\316\304\356V@O%\277\275\037\027\215\366\024"
+	.ascii	"\311\310\200\\\264\031%\315\021\002\370K\\\247\206T\t_\350\242"
+	.ascii	"\223t\320\020<2c@\247-\260\333\302E\210Z\232\237&\356\321\027"
+	.ascii	"\227\261\236\026-\243\271\326g\253\016\313\247E\233Q\320\330"
+	.ascii	"\035\353\226\370@\334\312\r4\247U|7\305!\325\201/l\261\032\260"
+	.ascii	"Y\360\350EN"
+	.string	"\337J\230V\202\310\022\274\236\242\223:#G0\341i\342\262hS\353L\362c~*,C\312\003\002f\265b]X$\206\002e,\232\313\364\240\347EG_-N\017\031\023\3635N\233pg\034&\004\314\327\026t\0013\3364\220\037>.,\303\3246}\323f\225\255\261\254&\374\025D2\363\212\361\233\353\262i\034\310!\360\312\372\340\271\324Lf\220qG0j\305\025]\323K\275\274U\314Bn\372\204_paE\037y\024D\2508\031{b\304R\3215\r\234\222\204\333\326\222,N\256\331\\A$3a\214\337\034\017\023NX&E\343\035f\037\0132\013\236\261\001\326\021l\232[\007X+\306\222\031cq\026\004\273\022\310\340\013e\2347U\264\nH,x_\262\354$\211\341`\270\032\r\221nwf\2608\251\323\304ujS\313L\023G\272!\356.{\177\301\271\213A\006|\241S'm\365\325\356\363n"
+	.string	"\315\204\273\032\274\211\340M\"\346\312\276\360\007\026'\361\202@\263\347u{\200D\236\031\361\263\365\240C\316"
+	.string	"G\212\304M\251]\206SD\0325_\023\367g\220\314\036\004\031\205\211\031\"5c\336M\023\203'\367\213\307\272\335\r^&\310\215\243J\322\251\005\275;\233&.\327\354G8\201_h\306\223?\302Y\024Q p\b 0\225\224UU\320\206\003V8\244J\360U\005\255\242\254\252N+\252(\253\f\240D\2601\305s\302\024\025\004R6j@IIQ\321\300\221\242\232\252`J\204S\004)+)\033R\017\220@\025u\303'e\243\006\215rg0U\321\260\212\2421\243\004\024\252\242\232\246j4\225P#\352F\323\f\252\252&\246\024;e\202\024U\223\325\324\024U\223/\r\353-\303\352|-\261\227D\324?\276\310\354\035\005\031\365\321Q\357\023Vg\265\020@\023\177\370[\032f\344\2463\367\303\r\311\344\264b'\204RR\023\227\217\0076\227\251\222\206\301\240\342\004\354\347\271U\371\317\361\215\007"
+	.string	"Y\276\354\260\350\237+j9N(Toi\n5Qs\2059Q\267V\236\335\221\216\313\277"
+	.string	"\017I\240!5\361(\001F\321\373\353e6#\230\027\255\276B\201f/\212Q\n\344\374\365\313R\037<%\005\362k\023\334\244\024\251I\331\301-\212\317\016]lDO\303N\240~\331\221N\213\231"
+	.string	"c(i\230"
+	.string	"\251\030\373\220\016A\323\322\034R\"As)\2347\201\372Cd\022\317H\327Do\b8\324<GG\320b0F\005\335!\365\356\314\370tqcA\250\211+\366\305e\357\367,\337\362\204P\0175\227\022\367a\342\036bz\204/\364\351$\255&\301\2409\027=B \301\234\031\313Zk\0056q\177\270\240\001B\333GF\0335\027\016\244\230\263\2378\023\226\005\005\313Z\313`\214\201\302\311}\352\035\202@\035\254\3746\320\005\201\321/\372\251]\350m\231\311J&\223\311\007\317\235\206\321Lg\220p1x47\274\350c9\004Ed\336\331N+\t\242F\177\373N\277\210D\203\027d\312\234\021,\001\201H\250\201(\305\234b\210dDD\244I\222\306!\005\004\031(\245\273\016\021"
+	.ascii	"5\247\034\242\221\231$\311r\235[jM?\243\215\353l\315\243[#\231"
+	.ascii	"\242\247\356$\255\311\fl\rz\2215\317\006\234\037\rU_\217O|>-"
+	.ascii	"[:\351cN\320\027\267\007\t\027\020\031\020\227\342&\325+\312"
+	.ascii	"\250/F\237\235&\023c\322\007\224wr\362\337\034x\307V\211\350"
+	.ascii	"r7\207\217\022\031\361\315\310\334\315P\367\274\336N\t_h"
+	.string	"\336#c\350\341\f\236\002^\237\245C\020\362Tk\322\277\367\320\234D\002\t#\306M\200\350d\022$\332\207{\345\344\345\314\275\004\201]K\021\256*.g\371\254\325\311\\\237\346ZO \220\017NE\007<\3502\216\251\344E\2104\324%R\330\365l\242\251\310~\254\005\021\234\314\324e\307\\\026\023\001\202\035\205\016J\0030\374FV\314\260#\356\242\201\345\0218L\320\267\277\240azh\311\263*\311\026\203\233\312\306//\264N\336*\251\022\027\033\332\353\022u\255>\302\buP\022\271\346\2106\013\037\216\321\001s\371\254\"\240'F\300\333Q\321\001\2670\201\277\241\"\312\260Y?\374\306\354\252\030N\301\316\002\304\017\357D\347\336&A\3635gR52\242}j\265\314S;U\241\352\373\317\323+zm\340\271\242\023\376Ae\310}\257"
+	.string	"\327b!\f\375h\316\332\274\316aR\017\235\340-\314\306\2069\"\376*\372%\321\215\244\251k8#-\013QN_\177E\313tY-&\355\227\355\372\021\017 B\212X\027\267|\3026t\270q\353@\220\342I\226\006i\276\216\274\006_4\036`\251\301P<\036DkY\265]\257(~\207s\367\375\266\221F\225\004\221B\021/gtY>\232\031%\357\217\345\255\254N\266#\310Z\032\232\022\005\022NP"
+	.ascii	"\242W\020\003\307\234wC\330\004G(2\20188\271\036\020\237\002"
+	.ascii	"\005'\313gjIp%Z\224\275\261\031\221^a\215\310\304o\216\032S\321"
+	.ascii	"\323-<\367\022\024\2640\221(\264\204\330\b3\275\037#\240\267"
+	.ascii	"\264\025$3Q\f\366roA,\246j\242\rs\261x\nn\325lf\2272sA\021*\033"
+	.ascii	"\323'-.\222\375\303,$h\026\370\276\251\332 \266\003%P\037\335"
+	.ascii	"Pu\253I\f\302R\357\223\033\365\b}\320\t\210\253I-\032w;\006\350"
+	.ascii	"\2439\205\245\002@\340>\247A.\3529\2329]\331Xf\234f\313\227\343"
+	.ascii	"\250"
+	.text
+	.section	.gnu.lto_afatfs_ftruncate.86.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\022\001\215\r"
+	.string	"\206\031]D"
+	.string	"\221(\035|\222\321\324\371\234?\341\266\373x\307:\2068\273i\235\364\251\267\004\342\316\322\256\241O\256}x\255"
+	.string	"\264U-\302\206g\"H\252\252\252j\3274\317\005\003\362\007rie\247\307\343\t!{K\231RH"
+	.string	"I"
+	.string	"J"
+	.string	"\357`\217\332\r`\217\266\r\022R\262\351\037\214\252\3232\302\302\t\233\335o\323\227\233\0165M~\200U\312\241\306\272B\006,/X\003V(\330\251\351P\3432\317\225U*3\023\331]\247\312*\303\035o\033\202\355\b\366Q\0011\215\275u+\200,\221C\205\201\365\035.vU7<6Fl\001\302\366\375\231\273Ln\302 40lv\227cbs^\2629\266\365;A@`S3\027\036d\332'\361\230\322[(/\260\353\242b\305\356\327\300!\332\243\277)\311\002G\315\006u\b\303T\303\213\r\0167d\320H\245\016\337e\222\247\b%\230\341\262\367W\205\0030\273\353"
+	.string	"\005i\344\177x\364Q\260GL\357\372\002\021\257\020,1\255S\336\330\037*\325\203}\270\273ku\261\377\375\232\323Y$\035'\001\004\342:m\004\364\361@w\037#\017\211\363t%'#n\363>[\311\207\013m\235h\264}(\260GaD\264\221<O\264q\276\323\241fz\231k=ZZ/\232\364M\230\352\212Z\344\244(( 5\215jO\370\344U2\215\032\027"
+	.ascii	"u\331\023C@\030\026hq\377\026\340\301\254PT\013 \260\214\020"
+	.ascii	"\031\013\342h\005\203y)-\366\3015o2\204\013\032i\213\320,\023"
+	.ascii	"8(\f\206-@El\271\232\306\240\240"
+	.text
+	.section	.gnu.lto_afatfs_createFileContinue.88.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\202%\225\234"
+	.ascii	"\232\365X6L \220\332\032\003\253#Z\312p@F\300Lt\261\377\021\301"
+	.ascii	"\365\032\307\276]\001\336[\326\030\216\200\377\350-\376\220\261"
+	.ascii	"\211\240\272\241\027W'\323\034\334\322,aN,\003"
+	.string	"Y\005*\232V\251t\202\b\337\270\233\004\253\301\025\337\037\321\266L)\245U\003\r\003^\003\316\256t\356^\2631\350\364RM\023\362\200q\257\326\231\304\267\213\321\n\223\276v\373u\177\351\016\354\036\323\356\354F\354\256\241{\261\375\355\216\322=\327\033\230\333\251\334\271$\303\371c\306\032\027\264\367\305s\221t\334\3316\323g\274\311I\177\231\332\227LiM\b\332\373\306\211\220\330\212n/2\365\013}\273\031\2706$\007\262\215J\357\234c\rMD\306\367\235r\303{\337\250\0074t\031\267\021\233\210\246\342\336&\016\226\020\304\350\022\236M\347\034\017\377Z\035\303mX(\206\204=.l\357\373\206\351\301\016\232\216k\274\346\310:\b\344\026\304\002^\255b]\372\013\367\037'\271\334h,\334^\242\366\374b(\373\021g\3431\340\300y\033\212\226F\244\260\215\\\001\362\0067\227\033\275\005\007\021U\334+\245\221\273*\214s"
+	.string	"\271\327Y\234\032\013\323P\243\2405_\3671\347\270\316!\346`vbNZ\351+\267\036'\253\270}\327y\314P\r\003GpE\f\241\351\230\306\313\3526u\353;\356*\234\204j<\276\266/\335;\265%"
+	.string	"\325\f\353\306"
+	.string	"\022\212J\333\355h:~\352\233c\333\301\234\224\322u\314I\346\321tl\274^\017\247n<\230\223mL6\224\256\266\225\223\314<\327C\371\372\275-\rL\013+|_<\005\\h9\267\243\370\350w\353\355+2iD\n\3377\356\250\215\254\204l#Q\333m\335qL\350\313\264i\341\373\276Fmd\001\230\333\231\333\255\337\334\206\223\352\233\367E2\210\367\276q)\370\005\262\215\034\327\313c\033\221\235sl#\273\314\204=Uo\363E\032\330\263\212\370\276o\322\247\300Gn\337m\026+T$!\245@qt\302\310D\t\022#D\204"
+	.ascii	"QD4\364\301\205P\020\320\217O\017\317\316R'\007\347F\351\241"
+	.ascii	"\003\207\rI\233\032$\315\261\205\261}w\271\217\316\256@\245\315"
+	.ascii	"fq\026\347\326\266\002\371\327\204\312\030\025Im\213*D\"\033"
+	.ascii	"jx~i\265(\027G\242\221\321\244\311\2221)\266hq\024\330>\302\""
+	.ascii	"\350'\260}n\224\205\317M\bv\t\032\031c[{M\302\251\272\310/\372"
+	.ascii	"\202Z\364\316G\264D~\321\275\226H-j\347\"\036\340\003t\206h\353"
+	.ascii	"\024\007\301\325ER\232H\2127\351|\250\005\300\356\275k\277h]"
+	.ascii	"K\243v&\255\255-\370\007e\332W\273\360\213\n\036\313\240\205"
+	.ascii	"nY\265h\030\027b\240L\353.\310\255\201\334\236\370\017\013\355"
+	.ascii	"\303B^\233\3674P\006\204\013\017\223\336a\262\304\227g\255s\206"
+	.ascii	"5\363\234\262\306\361\213\226\265D\177J\374\346-\211+\223Y0@"
+	.ascii	"\245\\\355ak\017\214\\\207\366Da\025\032\332/j\244]j-\201\266"
+	.ascii	"u\352\034\212\364\206\"D<Y4\266\025\3266\3552\206#a\332/\032"
+	.ascii	"\326\236\230f\351\352\302!^C\206l\r\230\342EI\373E\301\332V\201"
+	.ascii	"\210^[\273H-*\304i\330l\244\317\343R\311\265\254\307\242o\177"
+	.ascii	"D~u\213\266v\313\302\236\236\023\260N\312\325\306@*p2\330H\253"
+	.ascii	"\2166W%\327\036\213\n\036\333\025]\3756\322\256v\032\031\357"
+	.ascii	"\373\262C\245[\315/\232\371\023\231\031\bsQ\230\036\344z\216"
+	.ascii	"\354\220\306\347\370\234*\263\273\347\242\207\231A\261\311:\322"
+	.ascii	"x\r\344\004\013\331\305\36287\013\t\347-\270ZR)~\264+=\266\221"
+	.ascii	"\306wa\207\260\242\367gdHj*8\266\357\202r\2020\374\237\331\365"
+	.ascii	"r\203xC\333O\342e\321\250\276\331S\320\360\354\220=\216\377m"
+	.ascii	"(\027H\3455p\317\365\177\177\355m\311\202\271\n\275\023\004\315"
+	.ascii	"\356J\317\214\206\215\275\215\t\215V\266)\021\037M\330W`B\244"
+	.ascii	"\017\254=7\266\265d\231\326\236\033\342+\326\364\255/r\013o\272"
+	.ascii	"\266\272aB\376M\347hR)\230\270k.\260K\330-\342\032\361\2066\375"
+	.ascii	"\0161\366\262\013z\356\004"
+	.string	"W\342\036A&q_w\255\251`\245\236\t\013\313\n\375\022{\215\332\3327u~Z\2724`\021\347{|jV\263\214n!dVFD\312\373c\334\255t\244\356\220\275\357\333\326.Q\255\232\271\355\246p\354Cv\251>\346\246\300\001{\202\373\272I\202\332-;\266\221\206J\257\313\324\355\320\310\271]&\307\243n:\237J\r\221\275\357TC\231\3354/\342\256\325\300h#{\230\023q\233p\2339q\333\274\241n\333\361\320}\342\276yC\271\017\333\306\n_a\266\320\352\233\354\320\336\361\212\"\0266]\221\257J\256d\306\247z\020v\260\266\211]\027\273\327\267Xs\215\017M\312\276\305\204H\357\252$X\234\033\333+\006\204]\213\tk\\\001k\207\276/\026\273\tL\210|\337fO\271\205\216m,\222\361\376\245%a\277bf\302\356)\222\354\215\276q\257QR\354\351\213-\370S\t\371\276/\fv+\367="
+	.string	"i\326F\025\235\300\261\215\375\306jUl\372\0067\345g\270\273}\337\367m\237\332m\346\271\366\344\237\312\034\347\364GB\205H\245\312\217\204y\372\316\375\025\344\334^]\\}m\356-)\220sG\265\200,\235;\353\307\271M\300\202\266_s_\375\350/\315\375\264\252\242rN\3558w\263\307\271\337\036gw\307\231\t\344,\265t.\241\003\233},\235I"
+	.ascii	"r\356\261t\036\341\307\231\307\322Y\204\037\347\035@\316QKg\250"
+	.ascii	"\036\323\374\264t\016\001\310\031\204\245\263\323\217\263\216"
+	.ascii	"\245s\216\216\322\334\324\213\315\026\370\333\\\201\322\271\206"
+	.ascii	"\322y\202\216\322\374\300\2173\215\216\322\234@\303u\307\350"
+	.ascii	"\305f\030\3766\277\360qv\341\343\334\302\307\231E\217\363\n\037"
+	.ascii	"g\025J\347$\2453\222\3229\205\322\031E\217\363Q\217\363\t\245"
+	.ascii	"\263\021\217\263\t\036\347\022Kg\022K\347\021Jg\021<\316!x\234"
+	.ascii	"A,\235\213\226\316DJ\347!\036\347\017Jg!\245s\020\2173\020\217"
+	.ascii	"\363\317\322\331g\351\334\263t\346\331q\336\341q^\3628\353,\235"
+	.ascii	"s\226\3168J\347\033\036g\245\322\331\303\216s\007\2453\007\035"
+	.ascii	"\347\r9\316\311w\266\271q\256Y:#u\234ir\234\217Jg#\216s\373\316"
+	.ascii	"\177\023\314\341\231O\t\311\363\212P\303+JH\016\337C\370\254"
+	.ascii	"Y\270\013\334\r;\371\033\254L)\020|\336\303\340\301\206\377\301"
+	.ascii	"\257B\001\362\361\222\377\203\005V\006\372e\303\211\232\261\034"
+	.ascii	"\217\332\306\216yGd\365M\233\367f\267V\370\346\332\300j\b\363"
+	.ascii	"\240\f=\365\2017VQa2\201\327<O\323\375\024)\030_\347\256\025"
+	.ascii	"\360R\23000\257\336\320\007\376\202\237\273\240\257|UK\315\343"
+	.ascii	"\230\002v\007\375\212v\327\201\221v\371\360T\251\341\331\236"
+	.ascii	"\013\356\246\247\271Z\315\270Z\273\240\2272^_N\356\204\0020\203"
+	.ascii	"\023l9\021U\326\240<(q\335\365p3\nxs\253\206\334\376\t\327w\327"
+	.ascii	"w^o}s\265\364{\253\243\337\322\274\266.\317\346d\205h\003\371"
+	.ascii	"\326\372\326\003\002\242\302\032\220\237\2744\264\274%R_\376"
+	.ascii	",\317\254,\213\205\030\263 >mB^\0227\013\371d&|\347\271\223f"
+	.ascii	"\031=\005\230\261\220\370O%qT\265\222M\335\016y\216\374\230\324"
+	.ascii	"\213\315(\300\210[54\375\"%\274\3247\326\307\227@\302\373\350"
+	.ascii	"\361$(~\030\220\037\"\344\301z\360\370\021\276\005w\236\312<"
+	.ascii	"\230g\376\353\275x,\271~\313\255\335\374(\226\231\271\365Z\317"
+	.ascii	"\007\362Y;^\004#"
+	.string	"\230\222/r\200\326\305\251\276\232\252\322\371kdbZ\222\347\035N_=\2677\320\307\332\201e\027\353\261\334,\344Cw|c\261\256\374\017\245+\337[)a\375\323\336\\\026\212\345\251\272\257\333\302\2759'`\235a\316S\177\\}+ZM\235\317\377A\003X\236\034\340\034\232\023\020\314\032\316S\371,\355\355y\247|\254\347\177\263z\304\352\233\352\373\371\375\327\255\033\330\235\023p\316J\3736\216\243\325\267\203Vj\316,\314\324\362/\2163U\337Yz\304\tT\334\246oT\\\\\321\025\241\2061\270\031\034T_\302^5\013\347|/\236\305\261\001\373S\355\374\236\301g\327\324\367\237\227\351\346\367\013I\224\315\327\243\373\375\376_\255\022\231\357>\r\231\347b\0373\001\375\220\351\211\224\025&\031f~\367\365Q\223(dwT\376n\216\032\371\276D.p\001O6S\206\343\361i\236\2319\310\024\343\rE~\013)\234"
+	.string	"9\306\3050gx2\002\223\f\315\037\355\240_S>HA\317a\231e<\f3\333/\034\237\251,\013\020\372\305R\262,\371\241\\!K\033\210\267\027\006\361\320\210\025*\0173\314\326\334\034\f\212\024UshS\267\303#\335\203_\334H\373I\275\210\301]\363\320ep\260\263\364\304:`u\r\2331e\013\035\215_\343\331\237`Nf\232\361,JH\343\267\265\215\376\346\304\246o\034\372\370\300\224"
+	.string	"\262\035F\375\225\031\005\350\271UCW\367\312C\236O\025j\b\365Q\036fw\324O\017\3654\252V4 u\b\377\364HvVS\247\237a\020>\204GR|.N\371\031E\2672\343\305`\305\274\212[\365W<\367\352\253w \374\213\t\204\323\361N\337\206]CXe&f\203\016\346\031\267s\263\220Tt\374\t0B\222O\205\322unV\007\254\224\036\242\344\217\355\260]\347\261\351s\256\323"
+	.string	"\262Bf&\022\257\272UC"
+	.string	"\264\361\351Q\334\253ONQLM\020\364xr\212bjz\272\261\201\207\246\250%\004\232r\334\210"
+	.ascii	"\031\265\201Gm\220\301\007KLN\037 \233v|\260$\202\361\251i\203"
+	.ascii	"\246\247\232\245\f\274\307S\224\216&#\324\216\250\245(\250c\323"
+	.ascii	"\223\023\r\247\r\216M\037\334\340\240e&$(\016\242\2268`\322\321"
+	.ascii	"\003j)\311\351F\222\216\033K9\222\230\236\240\222\220H\260\023"
+	.ascii	"\bMOIQNNOI\311\270\251~$\022`\021\313\026N\275\223{\364\334\217"
+	.ascii	"nWl\026X0\273P\301\305\327\350\003\314\302Ie\217\314Re\3324\251"
+	.ascii	"\254\016\b}\200l\207_\335u2\204\255\230\362\030\317-\236\007"
+	.ascii	"\020\243\372&\023&\026\022\331\342k\364\375\2351\245\037\314"
+	.ascii	"\230^:X\343\264\357\217M\004\226\276\031T<\265\351,>\306s\327"
+	.ascii	"I\235a6\353ZF\3257\223\274\300\262x\033}[R@a\013\333\027\n\231"
+	.ascii	"!\t\247\225\216Io\254^e\310\341\232\022\006\351\251\256\342W"
+	.ascii	"|\214*\346\223K;\206c\007\013c\305\327\300M]\265bL\254\035l\333"
+	.ascii	"\221\275\215\276hO\231R\022E\230^Ap}zl\2075N\342\262R\244\250"
+	.ascii	"^\313\220>E\322\207)\355`\241\206eZ\351\210\364I\377\177`Ho\243"
+	.ascii	"\357\016\005\r{1\245/\310\272\230^(\310\262Z.wm\250\335\252\241"
+	.ascii	"\217\n\342!\315\226\337\342Q3\245\307\366r\266\263#\315\031\274"
+	.ascii	"h\265ZL\251\020\326\216\231\\-\020\246\227\016YkB\233\205\202"
+	.ascii	"\254]\251\327\267]\227H\263\242M\337:P\253\211'&P\223\023D\266"
+	.ascii	"\320\021\305O\320^\241\370\250\276j\026.h\n\026\242\321S\177"
+	.ascii	"\252\217\276\307\202\264O\034Go\243/J\026.\3063\013\002*v\t\340"
+	.ascii	"+\310\030\023\037\324\365\346\244\304\222;;\304\r\026!\361\324"
+	.ascii	"\004\336X\275\363\002\345?\3257^\345T\314\260\023E\230F\274\241"
+	.ascii	"\t<\321\363\233'\374\031\034Q|\207\210\213\374\304G\206\355\304"
+	.ascii	";U\267\207|\207\331\023W%y#zZ3&'H\324BG\243\357\251\2317c\364"
+	.ascii	"\026\360\r\266\301qu\327\001\256\21102\233!K\026\f\342! \\\221"
+	.ascii	"\020l\375\300\b2/\254\311\005\272\275\200 \236\312C_M\266\020"
+	.ascii	"Y\260d\350\2654\214\307\032\372j\362\002Q\005/\364\2656\035j"
+	.ascii	"\255f3\035_<\026#\266\357;\026\243\320\0053\303\304G\3410(\312"
+	.ascii	"\367\307v\b\343\310\033ni{A\375B\"|Z\2620RxB-m`/\222|\030\246"
+	.ascii	"!|Y\262E&\336\202\022\037\342M\220\370\022\377sM\216x\022\037"
+	.ascii	"\364g\225(\342G\224uVI\304\367\226@\020\377\341C\024=\210\247"
+	.ascii	"\251>\027\337K\023}\321\373\374Y%\016=\321\331\320w5\020N\350"
+	.ascii	"?|?\027Qt\320\013=M\325j\321\311$\350[\005>\275,\034\320W\360"
+	.ascii	"O\346\271\370\363\313\007\362\371\237\357\251\351y\237\017\252"
+	.ascii	"Z%F\341\371\236\007\252ZMw\236'\313\264\363}M\002\247\363\312"
+	.ascii	"_~?\273r^\347\215d\236\213\306\346\353\021\347s\276\247j\225"
+	.ascii	"x\3638i7O@ \234\207W~\257uV\311\303\267\032\237^"
+	.string	"[S\226\331\002\322\t\263M\020\314\225.U\337\024\323\363#z*7\323\261\303\267\332\2236\303\324\3411\340\313[r\237j3\314\026\2400\345\274\016L\225.T\337\f\203\004\250\002\351(\320\262\240ddFFd$I\322\032\322\n\020\b\"q\236\306\224\017\022`D-\310\203\216)5\"3\n\222$\205a;<\005;\354$\004G\253Ui@?\243p7\271\205\211=\363\3135j\333T@[\362,z\373t]\036/K3\275\310\325\0131\037\366\245\215\324\322@\317\264\022=\222\335\262;\273\026\324\030@\303'\244D\022\347%>\233\224em\237k\006\242k\257C\271\374S_\232\233\002\212\2612\237\0320D,\367\374\221\026;\377\020g\f\336%u\200\0073\350\261\305\250U\264\"\"\217\031\016{\nfS\t\007U\252zNv\020IN\030\263\217\251,T&G\210\220gcT\276D'\305f\\n\034\200"
+	.string	"=K^#1\277\302\224ze?N\\+z\373\336\321\307+w\215\300]\375)\267W\021~:/*\372|a\373\354[\247O\354\374\272\240|\3571\345\b\177q\207\331\2636\350\361/\234-p\b+5Oj\033\267\301\366\235G\316\272\226q\345\342l1G\304\030+u5"
+	.string	"=\277\216\027v\r\002\246\221\004 \267\261>\200P^|\331\366\210N\217\244\350\266\366\025\357X`\266I\366s\326Z+\221\023\355\236/\255\324\315\270]\365!{'I\222$j4v\353Jq2\211R\2367\327b\327\370JmH\237\205\351>\206p\267\344\205\377\357\223\262w\314\251\025\303\"\223\r\0013\340\360i\242\206*!\346d\275\210^\226\321\320l\3413iI\002ap\235\334\r_Y:g\224\003\304J\351q[&\310\177\330\210\336\320\332G\377t\002\b\036#`\013-G\032\331\274\243\252~\357\262!\013\323\211]\312\351dI\203\2624\205\263\322\252\250\364"
+	.ascii	"g\321c\034\216\25605k\013\314\017\323W4\0135D\022t\277\251\317"
+	.ascii	"\35560$\0170\361\004C\013w\356J\\"
+	.string	"\373\022Dm\373\227Ea\212,\025\330\311\217rb\"\276\305\212\233\026A\327c\374\352\250\005.\351$\225Xn0\324g\354\300\342\022\334\037\213W\221\n\332\207\201V\377\304{\367O\r\275\264\311x\212\201\022J\\\266;\306\005&F\231\f\272\240\262\"H\256k\3025e\202M\370/E?\223\245\365\205\244{\221yy\t4X\276\016\237B\372U\305yjwY\343\rfue\231\333\305\035t)\224\302\334&\241\240\377\306?\313\245\362\276\021\200\272$\210E\274\244\002\f\223\030Q\307\252\355BOf\025\027\006\321b\b\004\236\0214(\305\2007=\373\323J\341;\234\366\216dM\004\274M\352]~\345\301\211\377 WR\024\324Z`\231!!\t)\200\"\206\206\233\005\242xt\2570\346\256\255\217\225@\347\372\363\342\t\231B0;H\346L\022\232F*\221"
+	.string	"\266sUNdQ\274\211\277$^\355\272\366*\023\315bQHm\330\206\244\r\306M\316\307\355\251\222\245IDT\005\t\2245-k\332C\2640\260\t\266\303P\317Hxb\302eQ&\316\364z$\240G`+=\035\005\272\006\003\235\356\325\340x\2639\2046<\313\315Z\245\265\302\023\371,\200\007\240$B\310F\311d%yh\324\231\024%\230\242yR(\225{\312 $a\214\344\232\tB\307\357\024>\225\275\254\202\032\262S\354\331mJ>k\273\350\315\276b\256w,1rBh'\344&\303\341Qs\302U\346\020YH\253\031bW\266\231\253\341|\254\001\312\032\0130L\230\247M\237\342\017\227m\233\255)\030\306s7|t\306\0339T\366E\020"
+	.string	"Q\260\004\373\240\233\307\251\343\325CI\301\251H]\213\257e\240\204u\303\352\3435=6\255\035B\201{a\226v=\250C\203-zt\311\357\304\355\212\221\243\374-\334 \231\n6\354\177\001W\203,a\235\216\361 \205B\0026x\206m\274!\377g\213|\025>.$),\374\246\344\016(o/\021\254/\213\322sY\266\375\227g\347\332\031]Y`\276\246;\003\352\331\342\021%$N\320\027R\225\370\3653\214\256\373\302\2374\\\242I\310\224B\341\234\243\351\362\314\240t\346\331V=\035\372\307"
+	.ascii	"\272\377d\034\345\360D\371\032\004J\237\307\277\0213\026\024"
+	.ascii	"Y\026\326l\315\342\032\250n\013\352\337Q\200\244\253Q\250\212"
+	.ascii	"a\253\307#m\022\254N\232\005\355\370\013\270\021*\322\371\032"
+	.ascii	"zJ\274\030\342B\314\335n\371\354\201\344\241\250\2028\357\234"
+	.ascii	"A\235N_(\317\307A\210{'\255\255\304\371z\025Hb '\216(\320$\006"
+	.ascii	"\357-d\003\312\005ZO\305&\350X\232U\365b\t\331\025\023\032 \322"
+	.ascii	"\370 A\026\215\230,\215+}\366\213\306X\363\347\027\212\234\377"
+	.ascii	"\024\365\240\206\017\247'\003\332*\201s\227\243\212`\221\320"
+	.ascii	"\0034(\031\362\253B\021\222\373{\025?\205a\241\337z\022\375\274"
+	.ascii	"\224\364M\331\355\204\374\222\227y\326\246\235\207\352\312\365"
+	.ascii	"c\222\177\272B(\020w\017\022\326\240\031p\r\004\203\314\223\216"
+	.ascii	"Y\037\377\020?u\334\3357\302Q\304\311\003\220bN\326\240a\311"
+	.ascii	"}\231\246\354\347\334\227\3051&\237*\226p\202\0352\214\037q!"
+	.ascii	"\352\202\230\326`\257\311;\203\275\376\241|\201.B\202\216\023"
+	.ascii	"\304\311\266P\345\350)\036\270q;\256\245%\377\263\330\213\354"
+	.ascii	"\376\036\257\005\304-\300h\244\351\374\275$E\350\305\322\253"
+	.ascii	"\320\235\335\214\371\320;\372\312\251WTJ\214\365n\207h\206\243"
+	.ascii	"E\332\265\306\025\246\333LX\273E3\317\245\325\320N\220\202\361"
+	.ascii	"P\177\246\322\326G\b\200Z\022\306\007\020\261\251s\211A\201I"
+	.ascii	"\004\241u;\231y&\332{\316\025\327g\315\243c$\230\322\272\251"
+	.ascii	"ZH\2154\2177{Nc\260\335%;I\267\244\016\007"
+	.text
+	.section	.gnu.lto_afatfs_funlinkContinue.90.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`0\0015\016"
+	.string	"&\232`F\360\262&\035PQ\207W4\276\324J\3063$>\227\312B\304qf?\274}\317\307\034s\032aVD\037\337\"P\001\327M\203\f\242],\233\223,\0163f\231\230\370%\270\376\312\213C4>\277\237\370\275\267\334)\005I"
+	.string	"H"
+	.string	"P"
+	.ascii	"\227\376n`^f/0/\355\331/\022\324\236Pv^4-`\273\253i\210{\217"
+	.ascii	"\n=\377\256\203\244T\247\307\233kl\200\202q\030Q\315D\221 \032"
+	.ascii	"\034w\035jP"
+	.string	"\311@\b ew\rS*\233[\3366\004\333)\366;\004\366[\367<\353W\205>\b|\335\324l\3009\211\330nM\354\307\366\310\031%\336\372\355\337\345\020\373\373\n\357\255\227\257\315>\203\217\035\240\237\335\017\301\245\037d\227%\361\320>\212\247\360\316\202\371\200\335\325\016\236\335O\201Q\262&\035\206\312\001\035{\345/\270lw\035\270p\2610\342#\342\322\207\231\227\317\241\021\203\365\210\2011\347\340ay\320\277\314\251$#T|\340qC\307\f\f\362\204\t\256j\267\\\200OM\025\220c\303\004\320\017JO\366w\202\n\302~\334\335\265\256\002]\213i3uSD\2014\212\016\235t#\3236\n\261`\3506\215#i,\244mE\013\225:\355\304\304\\\005QI3q\\I\013\371\366\272r\200\027NO\214\312D\002\360\032A\002|\312%\336.#$\342\363\030.\"\023\235\005\237\240\fj\2608\301\272\312t\032"
+	.ascii	"u\26173`\236!\243\017f\264\275\013k\342\261eHF\214T\267\200\034"
+	.ascii	"_Y\361\252\275\313\372\230\325>\350\n@\300k,\246L\320\351\232"
+	.ascii	"\235\206\203\001\313\240\211<\365\2128\311S]9\245P{"
+	.text
+	.section	.gnu.lto_afatfs_funlink.91.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\250\002\265\025"
+	.string	"\026\347\214I\260RRc\274\332u\215\213\356\237\211?k(\225~\304:\272\005I/\364\210}\203l\216J\371\230\022\341F\262 \320T\177\357\216\251Kh\223\334[T~vv\256l}\222&4\317\274q%\375\205\247\352\345\367\336{K\231R{"
+	.string	"l"
+	.string	"|"
+	.ascii	"'\317\017(O\332v\203\021\031\347\236\376rB\200\037l\206]\367"
+	.ascii	"\2462;\364\334AN\263$G[s>\315AH\244\254\212XM\274\336O\263\006"
+	.ascii	"\n'$\036?:<7o\242\303\016\007\236M-5|hS\311\353x>\216\n|2z1^"
+	.ascii	"\2061d\006\220\r\224WS\355\350\340h\303S\214\267\033Q\246\035"
+	.ascii	"F\027\276\342\360jj5K\356\275\2567<\235\033\300m\017\331\206"
+	.ascii	"`W\2435\265\207\235\356\252\025\262?\336{\257m\220\355j\230Y"
+	.ascii	"\215>\375\315\007o[V?F\341jW\034\002{,Vzs~x]*\022\212\204\355"
+	.ascii	"\373J'\276\\\205m\357\213\353K\037\272<\205\255\320\024\225\017"
+	.ascii	"\351\336\353b\243/6z\362\266\214\215\332\266)\214\217\007\265"
+	.ascii	"\332Gz\222\314\2031\017po\220\223\213{\323\005\0369O:}H\031>"
+	.ascii	"=Jf\256\204\331\013\177\242\03349\004T\277BIZ\177haV\177\003"
+	.ascii	"\263\244\245\361\217\242|^e\255D"
+	.string	"\355\207\257;C8Bl\025i\234h\332Y\324\016d\021}\362'\033\201\337I\243\366\304'(A,\362%\325\236\225\207+\322\n\275\026\213U\301Q\245\274\235Q2\312\233TH|&\334\355\274\367~\304\311[\003\"\202\272\372\343\026\250hI\313:\246$\355\016\021\226p\253\250\025(\264\331\205\224\224\031\355\254\245\330LF\323DZLp3\023\332\nL\313Lv\263\311Vl3\025\031\215\245E&\202\3007\f5\026\031\356vc\221\241\251\3566\310\007\236 \022\315C\375\302\237_@\020\304\026\343\237+\255\305\261.\321\331\035\b\371Zi\323\036\243V\340\347\223G\331NX\326\214TU\027\227i\355\b\207\001\363\002'!\366\273\3672\370\204\362$\251c\312\313\227\344\343\256\025]?\247O7 `\242Q\fo\003\265\366\206\016\330\272\306\255\310P\212\356\225\265\245\227\211\"\205\301\307\324\325,\367?9\025\354\207*\325"
+	.ascii	"\274C\237Z\222\357\264\207\242\252\253\204\204/VY\233\334\302"
+	.ascii	"z\375y\205\232\302\307`\004JQj\364.ZQ\251q\303\t\"J\202\2027"
+	.ascii	"o\r\342\031\f\334]\b\216\371\363\310\rvU\310\313<\002\001\203"
+	.ascii	"q\264\234x}f\363[B\331\001f\253LF\330\255\345\016\213\365("
+	.text
+	.section	.gnu.lto_afatfs_createFile.92.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\202\006U\""
+	.string	"\206\372\321I\200\030R:\273\242\002\353\307p#\344(\035\370@\377Y\fm\306V\203\215G\013\016"
+	.string	"\t&\224M\375\251T\243\r(,L\255\254\027\264\262\367\375N\267_\232\270\340\004\236\"o:\377O\303\255+\372znG,!d\313$\003\271"
+	.string	"\256"
+	.string	"\303"
+	.string	"\274;zf&\346\0353\243_2\204\356\215oYf\326<x\221m8\233\231\202\005\246W\021\276w\235\304H\301\320I\032\007z\367\251\253\352B\037\271^\300\275Vpa\367&%\260\005\365(3\363\267>\205\211Wk\203\330d\244'K\255\206\225\346\275\311\037'_ =\252~@z\324\036\371z]\216\232K\321\323\366\312\317\375\004EaQ\026\215\303\353zrr?E\250|\\M\233\352q\345{\236L\361\350\334\216\247(\317\bu\362\334{wFb\237:\343\216\333\263\200\024\223\"\317\370tBX\343\322\346\312w\224\321\251;\367s\357\345.\032\251\316\2733\263\0253\233`Ng\004c\302\017L8ZU\037\2212\213\270\227\021\006\216\\\342b'\324\243\312?p;C\0132\345a\377\222S\274\313\247\310\334\232\353\201\351\227\274\342[\200"
+	.ascii	"\324\356\275>|-.\202|%G\371kz\364TdnQ\332\232:\216\0034\217\235"
+	.ascii	"\231i\204\357,\177\331\242\250_\344/\257\373b6\365\266\006e\207"
+	.ascii	"\314"
+	.string	"I\247\266W\314?\257\265bV\233y\376\365\357\274\312\257\363\344\337\273\327\317;\362\337\235\315\252\2569\227\323\234\252\315h\256\371\3145\333\\s\237\315g\340c\242$\307\221`\356\225\212{s\321\320.M\370W\276T:\030\353\230m\232J\034/\324\"\363\212\344p\326$\352\033\027\353\022u\302\327&\351\321\234\335\211\002;+\352\370\021n-\354L-\334\212E\306\311\233+\226\317\rP\2026\251\275\2242\2577\324\266\t\333\r\312\331\204?56@\n\216k\250=\262\314K\353\264j\314\262\236f\345\3629\242\001j\240v\346\264\037c\306Y\253\246\3652d\306\3308-d\333\264\225\213g\311\024\331x\335:\332\312\345\243\266R\371\031\220\203\243\331\303d\320\020\324/\006\245G\333\236\214\031\347\r\331\324q\r\206(\345\304\332+\216\360[\241.3O\r\307;}\26039\250\367B\275\330A\205\"\361\340h\3172{"
+	.ascii	"\321/\336\366\232&\032\321\016\231g\231C<\354\353\027A\240\220"
+	.ascii	"\221\0210\250\016\261@\352\240\n\025%--\001\323!\030\300\243"
+	.ascii	"s\310\250\210\350\344\240O\211h\tH\024<\022*\001\177HE\277\243"
+	.ascii	"\" \214_0I\351\347s\300H1\206\222~KHHI\277]\262\351\326jg\237"
+	.ascii	"\306\306\006\255\311:q\205\336\375X\201@`3C{\262C\035\343\360"
+	.ascii	"\222#L\231W!=%$p\024k\266\335{\207\252\3327T\373%\033\225\035"
+	.ascii	"\"\035%C\275\367\372\360\216*\312\264\274\345n#Kj\277b\245M\\"
+	.ascii	"\261\b\304(S6\333X\214+\312\021E\220\362\330+\277\300\312\230"
+	.ascii	"\255\2563O\r\307\275\013S\035\313c\271k\360p\3528\326\261=\024"
+	.ascii	"\242(\373\322\252\362u\316\366\256\326#\025\206\020\037'|\250"
+	.ascii	"A<\007\225S4%\005I\nJ\205\003\260\"\021\263\342\006\021\300<"
+	.ascii	"h\024T#B\n\nRh}\003\251\203\2646\246\224\270\b5\234\224\227\367"
+	.ascii	"\026\246\035\354W\007)\367\300Z\256\2735%x{4\277\242}\227\263"
+	.ascii	"\377l\2022\\\367\356\265\204\nx\263*\320\206\034\201)>\034\034"
+	.ascii	"\001\263P\2009\020\250\340\313\b\371\206\267\036\273?\3057\272"
+	.ascii	"/\273\326\357\036\313\b\302\334\263ol>\"5\226Vg\263yqY\342\304"
+	.ascii	"~%\326\025\225\232D\256&\016IG#\351&-\\\376\r\035W\301g\016\271"
+	.ascii	"T\333\240I\303\376\363J@\301lW\346Y:\361\237H\377\207\202bj\n"
+	.ascii	"\375\353\f\327CNH8c\031\243\210%\267\026\253\263n\2217\310QU"
+	.ascii	"{p\372\352\365e\033\346\362c\201\005\335\247\371\2573\360\336"
+	.ascii	"7\300\316\253\033\222\005XH7\337\025\205\315\317|\262y\351}R"
+	.ascii	"/\214\373\216`\326\3278\362\037"
+	.text
+	.section	.gnu.lto_afatfs_fcloseContinue.93.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\252\n\3557"
+	.string	"\n^\340\024BP\246N\007\013\361{^\267\232\374\201E\232\025\327(\004\200A\323\262\030\222Ew\204\250\206\017\246\206\215\336[\002\334\024\204\203?\0215\020\021\3219\276\316\006\317cU\307\304)EO\267\033\331{\357\224R\n8\001%\001A\001\354D\333\266\326JK\203\222\314\016\355A\247\254\341\327)\021m\241\032\204\271\311\264\232\220n\362?y\346%\321:e\026\302\314v\212\262\314\334\316\334h\275\274\2356\244\003\264-\330\2366m\333\214\300\026~\235r\263\207j\247\277\026\252\235\362e\366C"
+	.ascii	"\253\255\262`v\226\305V\250m[\251\017\343`\243\315\346\240\337"
+	.ascii	"\036&\t\005\004@:2\002P\304\006\201\277UM\321\367\313\035DV\365"
+	.ascii	"pK'\241B)ou=w\334\202B\250\0033\245\231d.\\=\\\321\322\322\002"
+	.ascii	"\306:\300\230Z7\315\035\2638\222\026\224\310\024\363#\2576\362"
+	.ascii	"J:\200\256.B\207s\307.\324AR\316I\273u\323\227#\025g\321\324"
+	.ascii	".\356\214\206(df\035\227\345A,ZS\032\330tE\213\253\177\350\206"
+	.ascii	"eY\226\236;JA_\355L\234\376r\334\362u\365\020\327\351\327\262"
+	.ascii	"\rm\357\212\326\224V\347\216\\,\262\210\247\304\266m\373\313"
+	.ascii	"q\213\243\250\203?n\364\206L\270\030Y\344\225?j )\347\304\b\211"
+	.ascii	"\205:\335\371\342\323\314v$\310\242\373\352\241m[v#R\253Y\251"
+	.ascii	"\231;\n3w`\006\242\tmD\337\005}\261\203\365ULL\312\350\241K\352"
+	.ascii	"\360\247\267v\247\366\222\372?|\366\254\255\026-\367\342\337"
+	.ascii	"\205\034\0373\246\0236f|\206R\375i\254\321\271rC|\324\327\327"
+	.ascii	"\307\327Pj\277\277\352,\222,r\214\2263\343\327\266\355\005\356"
+	.ascii	"82\246~dC\324N\373\233\331\n\234uh\311e\232\225\367"
+	.string	"17\213\376J\346n\257=\177\326\370\301\230#\254\316\r\200\316PA\347\247N\323\314 \350\354\004t^\020tV`\344\234 \350\334d\344Ld\002\340\214@u^Z\235\t\004\235\225V\347a\277iNj\270fa\247u#\0259\263\254s\020\350\f\f:\377\200\316\253\352\254\256\316\351\317\031]\235_u\366\324\271)\304x+\322\261\231\241\375\263\3312\351C\324\332I\341\272t\232n\270\3567\375\314Mn'\263\027Ia\317\0329n\032\216;\256\315\005\322MN\363<\253\254\341n\003\244\331\260\223x\325l\221\353\332\262\215\303\017\b3\213\246\323p\2771\333v\273L\273\005\351&\253x\332\3512\334m\314\262\265\231 }&\327\213\332\305\333\353\245\203\033\363E\353\276{\306\344\306w\231G\211\332\214X\036\361\233^\210E\306&\213\317\212\353P\331\033T\3247\214J|\032kwn|\301\264\241\033\206\211\337n\255"
+	.string	"\016N\225\344\222}%\257w@\246\377;\365A\013\037\t;U\341w\032\332Bh\3413\241\210\270\370\254=\315$\213/\246O\241D@t\025~\204G\302\f|B\003\320>\306@J\017T\032\364\240\223^\351\243\022\025\321\213\352\337'\375\201D\353\377~\251O\026\237\225\367\211\351A:\362@\3343\033j\247\353\267\263Q\246\363I\226\\\2465\\\007\262\241$f\274`\r\350\236E\370s\231Kx\b\236-.\353\030\241Xy_\201\267\273\267\337\322\253O\265\246\307\254\373\220x\022\203cf\321|\356\231\223]\333\266\031:m8\276\313\336s\231C;=}\367\2019\204\bo\243\b\265\323\245\357\270np\207\216]r\371n\306\320\241YG\364\223\304"
+	.ascii	"1.\321u&:\255`\247>\f\271<3n\323\312\272R_I\247\033\314\021{"
+	.ascii	"IM\277\001]\372\033\344\360\366\372\b\266\304HzBE\237j\200w\247"
+	.ascii	"P\221\236Y\305\n\0178zj\206\333\310\201\343\006\3125\242|\334"
+	.ascii	"\3701u\243\306\216 >\246\244x\340\220\332\201cJ\207T\r*\037R"
+	.ascii	"Q\f\230G\017\033TR?x\360\240\222b\233V\375`\036\254\2768\304"
+	.ascii	"\340\314>\267\233^\227\235\342W1\236>8qI\367\211\312>\215\265"
+	.ascii	"\273&.v\237x\230\214\033EB_)j\247\354\243\230cf/\315\275Zy\277"
+	.ascii	"\224\300n\330\217\310\034\266B"
+	.string	"3T\346\030neF\021\2129ley\302W&\357\227S\327\r;@\345jq.f?p>\013%\321\362\004Lpn\265\333u\275\274\215\374_\265\340HQ-\300+y\355\373\245\006\277\325\332\267\222\200\261\"\210N\317\225\033\262\342Q\356W\205\253t(7\354I\354f\361'W\013\002'\301\3576r|{H\004~\213\013\263J\020\335\217\300\021rk\354Y\226\007\365LtpXr\317\230\224\\\346Q\222\002l\306@O\017\345\\j\030\374\323\233`sz\006\037\245\246Hr\301;}T\242,>1n\324\361xve~\344\236\275\323\215\\\346\263y\326\202\177<=i\t^\301\367[\003\375`\221\341\031%\330\342X7\314/\301;\250\223\002\340\225\207\332\2137\214\221]O\031\313S\226\327\001\200\321\250a(\304\034\203\210DFD$I\222t`\002\221!\263\342\006\021P-D\250hfT\311r\265F\022"
+	.string	"\315\206\237W\266\232\265h\334\303\316J:M6\357;+\264\310\254e\224cp\344\340\001'\017\232\353%Y\203\253O\254E-\fk\207\212\276\334\203!_\230p\255N\342G\332\022ZX\276\023\205\241\266+\210|\271\004\273W\302\205\374\354\347si\310\001,\311"
+	.string	"\313\220qx\246\362q8\0260\016\226?\232\340p\030\242|\022\367\320H\301{\227O\2774\026E\314\337 \242r8\306\367goO\007\352ZqK\315\327;\201\006\330rv\347\360\007\276\363\310V*\215\"\025\346&\322\303\032\001l\371M\204\310%\234\345u\3776\303\376\255N\374\177L\026\030O\350\023r\221K\342\273f\031\037\024\266\r\343+j\037\265+\221A\362.\334\327\036\004E\300\177\261\214\022\341\243\322\341\212<9\302N\032i\022)B\224\346j}\351\202\2641\f\335\025\307\363\240D(3\235w\n\340Z\366`\344\275\021\321\212^\325\371\n\347-1\027\241 \002\221M\017\345K\352I\255\203Z\323\253\3378\300T0\221\223\237)\332Z\200\205j:Z"
+	.ascii	"$R\321jY\017\341\342&V\222b\373\341`\312\262\026\350\236*\217"
+	.ascii	"\374k8\355\310_\021\006\371\251\371\326BY;e\311j\016\210\235"
+	.ascii	"\027\201\203ch\005E\334+V\277<\304\006\347d\\!\215\356\315\362"
+	.ascii	"\317\021La\201\"\257\2142{\315@!\017\342=\337^T_\253\270+9\237"
+	.ascii	"\260\216\346\301\210(^m\330\214\307~w\320\020\246\324\002\341"
+	.ascii	"!\256\212\246[\026\237YAP\003"
+	.text
+	.section	.gnu.lto_afatfs_fclose.94.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\260\003\355\031"
+	.string	"\326.\247H\240\332Mc\240\347\003\237\345@\275o\007h\0014qF\2336QI\344t\314[\216#\355\210\361\361\353\312\346\227\rxa\217\214>\216\003y\321$\230\004C\0368X\017\022\300\202\"8N\301\313p\fw\267\311\336R\312\224\002\221"
+	.string	"\211"
+	.string	"\234"
+	.ascii	"\"-m\3273(\214\004J\355\373\356\204\373\323\212\007\2707\311"
+	.ascii	"J\353\3363\307\020\310\213>_3^$/`\274h\333\016 \340\234\373\251"
+	.ascii	"TT\323[\202!\365\345\336sVy<\367\330(\332Js~\213\307&lM\tzU\355"
+	.ascii	"\216>\332\232\242&\"\331\356\205\305\331\002\f\203AE\262\306"
+	.ascii	"\255\305\341E9\222\355\\\330\032*HZ\312\235\216V\373`H\f,\331"
+	.ascii	"n\310\226T^\202\034\352T\306NGi\214\302\275\327\224hgt\223\267"
+	.ascii	"\215\263}\301\256S\002\347\020\255;\354\327\341p8tM\262\001P"
+	.ascii	"\313~u\317\034\353\226\371\371\223$\365\370\247\337\232\232\306"
+	.ascii	"\250O#\302JTP\252\307T\275\316[4\024s\271\304$>\216\365_\235"
+	.ascii	"\332\367\265\016\264\275\210E\027`>\233]V\375\312\307z\226K*"
+	.ascii	"\334\017\367\250[\031\350E\\i\200\ty\276{o\371(\377w*\227Gn7"
+	.ascii	":\232\253C\272\241e\341F.\005\364\251\233\275G\256\220\321\201"
+	.ascii	"\256%'\276\005\027]\201\274xc\201\354\362\001\276.\262\312u\223"
+	.ascii	"\271\325_\343\313\306L\225\251\262\232\263\365\"l\350\303\245"
+	.ascii	"\334h\326L\245R_\2672\210G\271\235\211\020\212\212\020>\223\210"
+	.ascii	"\361\242L}\326m\020#&ZxN6\224%$O\2439\2169\232\262P\341\022\304"
+	.ascii	"r\240u\356\304, \004\232\366&;\003\224.z\254\007>\001\220\337"
+	.ascii	"\017\236\223\351Q\327\214.\261\3568\235\232\352=\261\265\361"
+	.ascii	"\225E\224I|I-\202\257DE\t\362\336{\246\213\257\004z<\t\321\341"
+	.ascii	"\221~\030\361\252^1\332j\243)\213\016.\301/\035\rc\007\246\016"
+	.ascii	"\035\241CK\320\314\021==&\215\334\351\251\361X\323\032\330xR"
+	.ascii	"\230<\264\023A6s\346S\233\235\250\231&f\264\037\333\254\001\002"
+	.ascii	"\373\240\330\371\231\245\360\361\371\231\225\247\320\355\255"
+	.ascii	"I~\217\310\357'\372\271\361P'\307\364\232~H\354\237\033i\225"
+	.ascii	"a\233VS\020\252C\266\367\336\033\263\241\266\332\0302\320\023"
+	.ascii	"\371Uac\270t\265\205\311jk\370W\020\203\r\027r0\320\341^\036"
+	.ascii	"l\256,\331\222\002\006G\2759\332:\017\2326J\246\275\312\016)"
+	.ascii	"\023B]\201\020\260-\274F\250A(\245\020d\n\025\215\004\221\024"
+	.ascii	"\026$\305\001\200\"\231\313z\021\300\271SbRPX\3308u\306N\322"
+	.ascii	"\271'i\212\332\253S\n\b\2146\341\204\201\363\343&\202T+\331&"
+	.ascii	"\232\201\037BU\225Q\2619\315\274\322\264t\324\006 \262!\252\226"
+	.ascii	"\f\277U\237a]q\246:+;{\212\036@A6EG[\013'\032\221\305\225H\340"
+	.ascii	"\227\243\326\300\330\305-`\037\035F\314w;\3264u\035\371\017\322"
+	.ascii	"\"C\307y\t\331\252\250.D~\336\222\322\336\360s\3508\200T\263"
+	.ascii	"`\255@\032\032\2254U"
+	.text
+	.section	.gnu.lto_afatfs_mkdir.95.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`R\003\335\030"
+	.string	"fm\240I\240\230Q:"
+	.string	"|Hz\222\305\307\f\353\035\233s\323\266_\2374\bS\323\232f1\230(\177\311\237\254Z{?\352\237\026\3102\037\262\342\330\266\007|\n\353\360\n<;\247\220\260\363\247'\261\216\365\330\007\344\267\204\020\262\345N)\216"
+	.string	"\202"
+	.string	"\217"
+	.ascii	"\007]\276\025\036\034\337\022\036\2240\001\3079/\207p\255\034"
+	.ascii	"HP\360\242j-]\013\303{Z\336\341\314\371J5\212!Hw\346\370T\210"
+	.ascii	"\022*\264\257\304\f/x|\256\272\316\317G\332\302\"\251\351MT\370"
+	.ascii	"P\007M6~j\250`1E\032\240\326\312\312\241\240\021\346N\2566C\032"
+	.ascii	"=\007\217\216\340\005\317\317)\275`\204#\006+w\202\256\216\236"
+	.ascii	"\0212g\233{\2443PZRs\372\345z>\305\f\265V\317[\216\347&o\233"
+	.ascii	"g{\203\275\026\002_\201#\272y\203l\026\0138M\206\323+O\253\256"
+	.ascii	"\373\305\227?\bN\323\377\356\005\340\201\312\316\t/G\222u*+n"
+	.ascii	"\312Je\002\n\231\361\337o\337\357\361\237\217d\262\207\363\335"
+	.ascii	"}\266\271\016\213<)P@E\265\326\357\374\236\277\343<\233\363\360"
+	.ascii	"\222\213\255\2549\321\227\004\252(\252\326\332\340\2405\214\007"
+	.ascii	"]\250\215M\036\274\215c\223\345\315\025\fs\332/\272\021\316u"
+	.ascii	"&.\240\326 \035\220Z\313\007\2360\006\273,TJiI\315\211\007Pm"
+	.ascii	">A\005\211\002\351\356\262v\307\0360\301m\tp/\205\342\222k{\370"
+	.ascii	"0\177\363\217.\340WE\207\003\252>K\363}7\362*0t\003\361\"!\024"
+	.ascii	",\301\030 B.\231\202\251w\353i\341\210n\324\261p\2654;(\266)"
+	.ascii	"\345\373\f{\220X\202\241\022\007\022\342@\205\203\367Y\366\037"
+	.ascii	"0\255'\265V\nJ\367!\343\3138\350\331\210\371\333\210\360\340"
+	.ascii	"j\217\364\005\266(V\200\214t:sjk\255\264]!\273\254\315\262\303"
+	.ascii	"\300^ bb^\2601&\363\232\211\305\310^F\303"
+	.string	" \324\274\220x\275\300fnj^\256\231\3145#{\311\270`45.\b\n<\023\021\243q\221\230\315h\\d\251\363\r\032\243\264H\352\375\030\317tSJ.U\255\213\316\326|\246\323U-\207\036\221\332\234Z\021\230~\207\320\340\372\277*C\230\330\226\346#IM7T+4\336\204\340\376\350\323\005\221\024m\212\223\213+d\021\t\310\262\3734\033|w\347\301w\257\333=\331\246\024\255\265\326\320\301\003A\250A@c\fE\202!\"2CD\223B\215\001`\002!uv\016\021\340=$\242d\3303u(\2401\301\350X(\343 03%\271*\"\340\007\224;\005i\"\376\236\26360\227\200\017\332\213\310\337.\030\260\026\346\215 \034Y\212\377\377\250\261J\261\016l\020\333G`\210\235\022\016c\275\305$p\2636gPQ\210l\211\324\004Q\352;\273\330#(v\346\266-\253u\240%V!\300\325\356S\306"
+	.ascii	"\262\263\254\022 \214\341mg\036\350\001\033\244e\207\366\257"
+	.ascii	"\317P\001"
+	.text
+	.section	.gnu.lto_afatfs_chdir.96.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\005\r"
+	.string	"\026\232\\C"
+	.string	"\221(\035\004\340I\376\365\232x\002y\370\377\016~`\275\021\364\272\233\365W\232\216\335\362P\306PX\253\327*\242lTR\004\376e\313\374\377\377\277L \357\351Pc\243\273:[#\300 \321do)S\nJ"
+	.string	"E"
+	.string	"M"
+	.string	"\321\3365\330c\366\001\330\243m\177\200\210<\272\267\202\322\210\210\221\340Rc\327\333\264\303G\207\232#?@\212t\230\245\\!\002\225\025)\231\224\tj^6\310x\353\211\222:\311\344\b\331]\347)e\341\216\267\275\300\266\002\373\016\002\337\367YU6LcN\307\263~\350\364\263\204\211AU\270\360\026\337.\352\263\261.\242\n\026\333\367I\334\025\272\347\017\026-!vW\013\331\332E\266f;\323\376\210\257Dg\231\\\300\256\312\004\212]\257\303 \331\003PI\231\202\306K\006\365\b\206\351[O\f,\032H3^\3048I\030\337e\317_#\005`\270L\362\022\034\201\225\335M\360\350\267\334\005\202\357\341\321\237\b\371\323c\307\204\233`\217\230\336\365\003 ^\037TV\254R~\266gJ\345`_\277\241\216\003q:\235\207\001"
+	.string	"s<>\"\240\215\b\247$\364\331l\234g+\361lH6N\367\331<\f\230{\320\3516\020\307u\233\346\225\256*\277\365\354\306\212\302\353D\372#\314\032\365\212b\207\224\324\004wwa&\241\332\235\006\371S\324\020"
+	.string	"u\331\373B\300B\235Q2\361\300AC5"
+	.ascii	"\002\337\b\201\307\204[\230\027\272\313\300\240\"y\r\225\036"
+	.ascii	"&N\313}4\006\265\007"
+	.text
+	.section	.gnu.lto_afatfs_fopen.97.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\310\006m)"
+	.string	"\372Jd\020Gp\032R:\237lF\021\005v\305Br,\013\025v5\324I\301\037\347)*\251`\np\307\233\026c\262Z3\003\201'\361M\016\365\244\003\215\005\376)\216j\262\361W\240?\321\"\202\301\037XU\336\376o\233\020\271\223\f\367"
+	.string	"\340"
+	.string	"\360"
+	.string	"\275\247Tl\004\t/RL\013C\363\355B\255\314\377:\030\324\303n|x/WX\226{\233\016xB\357)7O\264O{\367\261O%L\200b\034ovU\021\301\350H9\345\334\3334\352#\334G\233g\236\212\343Ca\260\207g\007\370\363\365x6E\273\342\340\243[\322\320\210\271\221)\243>\344\035mYi]x\243\327\203\250\317\225Y\333\327\222Zh\203\266'Xwv\325\036T\270\226\\\242\020\212\234$\261*\217\021\253\254\357\024mYy\035\210Z"
+	.ascii	"\213\342\365\265\344\020\264\251<\275\334IRH\375\241=\365\022"
+	.ascii	"\023\227u\037\357\310y\rI\3504\277\350zE[VW\347\241\b\314\024"
+	.ascii	"y\373Z\362\n\025Z\216\351q\347+\225R\252\332 ?\245\016KD\322"
+	.ascii	"%\311\267\222W\235\242\304\367\225H\224\350\336k\225\307ZyG\367"
+	.ascii	"^\256SJ\2533\2003?\0033\223`\266\006\002pu\352.x\255\343\237"
+	.ascii	"\311\236^\220\335\314\237\017Y\264\233\f\262\316\341k}\310\372"
+	.ascii	"\032m\256:\226\307z\307o_;\220\262\273\026\027J=%\374\033\366"
+	.ascii	"\351;\305\330\221\255\f\313X\357\230\233\307\332L\346\337G\325"
+	.ascii	"\222\035\334\\\314\003x\225\205\004\370*\007\001\375*\377pe\342"
+	.ascii	"\303~\237S\371\207\276\312\302c9\007{xv\336\374\201\274\312>"
+	.ascii	"\336\307\316\266W9\345UFm\345\266\225O E\333\221\315\tV\247\335"
+	.ascii	"\232\267\352\256\316UK\26709\226\177\354|\263c\341\2431\260\f"
+	.ascii	"\352\317\237\261\214W\341v\326\275-\277\356\275\177\362\313\370"
+	.ascii	"V~E\306\311\270\013\021\262y\225\274+b\342\276\344\334{G\364"
+	.ascii	"\236\022\241\367\2612\230\201O\317\f\305w2\220?F\343W\307\255"
+	.ascii	"1\007V\027wo\223\301S\356\020\005*<\375\031\233x\233\023\304"
+	.ascii	"4\367^\nl\376\206\202S U$\373\364\247\217\366\005\3106u\226`"
+	.ascii	"a\306z\327\367^\343\257\231\f$\327fy\032\b\310\034\\o\247\357"
+	.ascii	"\374\263\200\314-y}\032\226\321\3246\257\251\230\237v*\237\202"
+	.ascii	"\235\006\226\3159\363\223\331\201\35153@\223\263*\274\346b\267"
+	.ascii	"\333Ns\324\025\021\373\220\265\315\323\3002\2728R=\314\374\316"
+	.ascii	"\377\354\244\250E\325\272\ba\244 -\332\323\2146P\333\246B\303"
+	.ascii	"oc9\"QS\2244"
+	.string	"\271D\326\370l\f\327\2737\352K\006w\262O\213\216.\232)Yqj\314\f\367/\201D\220\325\216\371e\336\375KB\347F\205\325\353\272\311\333\274\013\356\374QT\255K\205\272\247\177o\214\365n\306\303\fq\005\376\227\203IB\257\344)\027[\330O\265\260O\205\372[\320f2\r\013\324O\306z\307\001J/\256`\362P|*\276\210\261\304\224\324+\256`ZB\213KH0\212/\224X\3648\351\201\023\213'$\026I0l8!\0311)\031\301PBZ2Jjr2z\220\200\231b\024\233\214\236\230\230\232\214\200M\343\233\253\327F\210\331\023-x\2723\n\fj!\261\211\214}\344\323]\330\304\016\361\344r\254wC\002\225\317\301\362\260\371dwJ5dG1\030\2636(\302f\006m\330a\325b\342\306\214\034\333{\232\311\2740;\002\272\327\370\030<\330T\016\036\354\207\211\255A\3269(O\203\007["
+	.string	":\347,\355\350Vey\254k\342\264\304\331\371\005{\200P\035v\332D\347.\326\247\203\232\331\303\207\372)Fo\220\216b^\247}\347Q'iiG\267\247\335\317>\007\342\247kj\303\341\224H wb\350MP\003y\214yN\375 V-\231\0026\223G\330\237n\022Ss\306\"\356f\304\201.\025\207+\021}\250Q$\203\0205\310\031\021\031\021\032M\233\003`\002!TVv\021\200\301C5\243ii\332\317\252\221Y+\n\200)\030\345\361\337\033I\0301\034\341t\020\334\201\005\217\203\244\220\203\241\030\331z\333VD\0059\213s\n\212\225~\300\030\224\371\332\035\023\304\325/\036\002uer\252\273\3263j\033\227\025\240\205A\236\302r\022\213=\304\364\362y\002\rV\233bO\303d6\337\261A"
+	.ascii	"\315\341\006+\353\253\217\305\216\023j\271\206i\240\220>\020"
+	.ascii	"l\340Ms\357/\177\b\031J\202\323\226\265\2618x\336\244\244\240"
+	.ascii	"\210\2127\013\215\217\334\333\355Y\307\334\207\277Z\215\237a"
+	.ascii	"\032\342\364\203\205\004A\3229\206\212\263\0074\202\204\262\321"
+	.ascii	"9\200\254\352\367\322\226-\342\3167\262\326\236\026\t\375Sf\240"
+	.ascii	"\2313\023\364a\261\017\303c\312\025\026\002T\335\357\304\350"
+	.ascii	"\2060\231%\310\226C\242\324\203\332\371\023\272\376\207X\314"
+	.ascii	"C\346\227.OrdyHX\356.\312>\360[\360\037"
+	.text
+	.section	.gnu.lto_afatfs_fputc.98.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`Z\004\365\035"
+	.string	"\246\267\301I\240\326Q:\305\320\370Q\3031\345\\\236\021\001\341\001\217\315?\330\216\360\323\311\024L\254/x@\037\311\036<\253\267\347\330\251\315\343\305\267\332\006\307\205k\370x\274\003\357\260L9\020\005\360a,\3652\254\365?i\204\020\271S\n\250"
+	.string	"\237"
+	.string	"\260"
+	.string	"S<0OY_\265\022{\316\017yT\357R\306z\215Q\357\202\312\223\326W\255\365\300K?8_\356\220Km\005\fz'\026yk\035Z)\326ZD`\007\247\366\231\336\324\273\323\212\007\2505\311\252X+\021\201\031\234/M\374\215\371\362|\215\371\322=;\313\211JU\300S\023 \221/\265V\333\352x\3571\263$\227\366\374\030\004YPh\364\030\215\233G4!\220\226\244\201a\226\214\232\260\005y\003\005\007\226[\001)9\023\322\370\326\204,\310\235Z\353\251N_\b\177\224\306 \324ZM\203\302\030\367y\333*ls\260I^\337\332\036\f\210\364\263\207+\341\235\265\326\006~\022\020?\347\216\025\346\313\357}\030\263\bq\362\321\243M\374\321\315a\237\254\233d\323\250sj\32482\32472\32464\352\232\245\246\271\324=\363\251\273v\247_\346\244\236\235\3242\031\352\023"
+	.string	"u\214Fm\316\250\313\03159\243^\0315=\251/\300\026vd\306\307\030k\205q\024S\267\312$<.\365O\371H^<\361*\227\307%\237\260\213\374\312\246\231\350GlJ}\031\3320r+{\367*+0\212\tRk\335\331D6\355%=\221S\231\026\265\256\363L\331\316v\237\034\r\241\360d\353\300\350\005\214\323\271\276\321D\321\002%?\204\371\362\301->\342\317M"
+	.ascii	"v\\\0326\331\310yb\241\246T\253\357\301\027}\341Y\030\312\033"
+	.ascii	"W]\206LM\356$\203\255a\003}p\203\3712&;\372Q\263\346\346\254"
+	.ascii	"\351\321\260\266\346\236\352e\321\350\345\307EE\2635{\262\336"
+	.ascii	"X\346\314\322\354\213/\201\324\320\212\342\232\362\361\243\265"
+	.ascii	"V\243\335\034\036a\226\373!\312\213\005\rcrw\313], \322\227\274"
+	.ascii	"\266\344\232X<\237\331]\332\2130#p\311\217\036Mwf\177\005\f\363"
+	.ascii	"q8\223\016t\207\214Z\366x\236\031\272\334\320\r\207A\310g\b\267"
+	.ascii	"\003\002\262\240\313\355tD7\033\0248\020B>8\021\267\237\333\354"
+	.ascii	"v\034\211  \3227\236\035\320\320\017\320M(\305\356\307\226\013"
+	.ascii	"\262\t\005\375\224\260\335t;\033\017\001\347L\340t\266\241\\"
+	.ascii	"Ng\243\021}'\353&Q\375\301#\330\226o\177\261\035\372(\177\325"
+	.ascii	"\241B\304\260\216[C\246\240\314\372V\021$\320\007m\256\221\265"
+	.ascii	"@iq\231=&\016E\372\241\003\212\213\024\257_y\302\257\364\350"
+	.ascii	"t]\331\347^\024l\224p\366W/\320\203j\351Ja\276\212\245\216ys"
+	.ascii	"F\211\262b^\307\264\331\2335\005\"\375\254\\\341U\212l\263\267"
+	.ascii	"\372\200*R]\303&'\0379\333)\001Q\250Q \246\214c\30603\301\214"
+	.ascii	"\2146I\213\001`\002\2312\253\016\020`X\323\246\335u\246Hr\236"
+	.ascii	"a_\316\245.\265\022\005R\326>\335\037s\333X\206\211\022\334X"
+	.ascii	"o\004 \250\216\243\r\0367J\243>\213\261\235Z\325A\242\341\313"
+	.ascii	"\255$\004D'?#z34\027\f\214\311\312O\225\232~\361lP\242\007\375"
+	.ascii	"\213_&\2523\031\270Ks\007q\212\330\273Z\332\261\351\336\207\327"
+	.ascii	"LO\266\266\030D\024\346\002\307:T\t\344\216\203\254\354\210\334"
+	.ascii	"\266\340J\351t\251wn\251)\230*.\337\231\351{~yv\225\241\200\214"
+	.ascii	"\177L\324\350e\2635\324\to\020s\353\352\017"
+	.text
+	.section	.gnu.lto_afatfs_fwrite.99.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\302\001\305\020"
+	.string	"6\337oH\340\262(\0350#"
+	.string	"\f\231\241*\254\003\264M\026\013\006\020D\302\350'\016|i\263\307S=\201T\306\205\337\332\320l\031\n\254/Z\354\355s+\034\316\221a\ne\225\226R2K>\344\022\017'\333E;b\367&[\246\024Y"
+	.string	"W"
+	.string	"`"
+	.string	"\265\216\f\354\240\373\364\330\331\366S\\\005\313\241\004XKT\300\023{\261\001\251u\374\f|\204~r'@?eM\270\341''7\364E\242\313gGs\356\345\211\260\225\334\002Y\215\231"
+	.string	"\242\213\033\2711\353q\3337F\204\355\206Lj\255^\030\221\303Mo{\202\355\b\366\216\002\236k\3578\277\3507\177Hh\335}\374C^O\272\336\271>"
+	.ascii	"9\373\221\331\340\341\031tj\225\t\002\2526f\317\b?\347\267\225"
+	.ascii	"\277p\003\037\035\024\265Vo\305\366>o\263l\317\266\3678!'\240"
+	.ascii	"\276f2\b\362\206%\310\203]\373\265\263`}l\271H\255\264\031;\001"
+	.ascii	" \3556v\242\246\205\217\034<~s\351;\340\310\347f\013\3279\025"
+	.ascii	"\260\371t'\177{\202\0229$z4\360\274\244G\324\353p\270\330\361"
+	.ascii	"\332\037\323\217\350\245'\275/1\227/<\006J\211\017#%\325\325"
+	.ascii	"Z/\342\323o\241\237\227\267\375\200\016\034\037\331\212Zk\203"
+	.ascii	"\354\321\2652\004\220\t\232\037\2264\007(\360D\252@\223\tC\005"
+	.ascii	"\n\236\234L\234K$+\223\n\311TB\261\254H_\352\364\241N$\224\257"
+	.ascii	"\244Z}$\b\234J\001U\237J*\245\372\274\261uI\363m\037\260\227"
+	.ascii	"qs\334~\006D\207\232\364C:e\214\355)m\322\222\256\237)\262\""
+	.ascii	"\031\"C\322\246@\332\303\254\244\322\245\344\003\r\033.& \200"
+	.ascii	"\242\031\344\003u{l\001\303\315\21214\361\026&x\314s\323t|\031"
+	.ascii	"\337\310\016h\316\271PCXw \363\033\315\004)\033=\306b\232~\321"
+	.ascii	">3\003 \fCY\274 (\274`M\262t\344p/\344e\214\020\034\356]A4\370"
+	.ascii	"#tuP\345\255j\r\024"
+	.text
+	.section	.gnu.lto_afatfs_fread.100.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\300\001\255\020"
+	.string	"V\337oH\340\262(\0350\215\0050\371E\177\020q8\344\022X0@\2635\300\"\370\205\322\245\256/\237\247\314\361\345\251\375\327\263e(\260\276h\261\267\317\255p8G\206)\224U\252\241g\226|\310U\270\311\233\216\177\304\222\275\267L)Z"
+	.string	"W"
+	.string	"`"
+	.string	"=\265\216\f\354\240;\365\330\331\366Y\374\306\345p\202\354%*\370\0011\263\r\325:~\006>\302\235\316\017\340N\345\210p\303\323)7\364Ib\313i\007\363\031\363D\331\312\271@\306F-\200\b\233#8f|\334\366}\021e\273\243\222Z\253\327E\344ps\267M\301\266\004{\013\00446]{\317\371I\327\371CF\353\356\343?\362zr\353\245\353\003\22055\332\206\016\367\300\243VZ\021Q\275A}L\370;\277\251\034\206\033"
+	.string	"\325\030\252\265z*\266wz\333e{\266\275\327\t\247\200\032\233\241E\2209+B\020v\355\343\334\205\353#\313Ej\245\341\t\\\2671+\202B\374\320\021t\363\351=`\251\307\315\027\316\223\"@\342\324\235\374\355\tP\354\2340Q\n\030\"\351\022\347u9^"
+	.ascii	"\3056\210\377\022w\351I\357,\006f\f\227q\362\300\217\201\262"
+	.ascii	"\352j\255/q\352\263p\247\227\267\375\300\216\031@dZ\340\274\266"
+	.ascii	"\310\036a+E\330\377\315\315Xc\031*\320D\262@\024*\203\005\016"
+	.ascii	"4I\241\246O$-T\212\tuR\255\264L\337*\365\251R\246\223\357\304"
+	.ascii	"j}$\b\274B\001Y_\312j\305\372\274\361e\3639W\356\376\347\267"
+	.ascii	"\375\265\017*\204\244\037rS\276\330\236\322%/\t\263\241\"\033"
+	.ascii	"\"Ir$\355\n\246\275\313JN\266\370h\2401\233`% \240\242\231S\017"
+	.ascii	"\265\366T\002\207\303\003\211}\343\0266\350\262\206\246\306w"
+	.ascii	"\360m\216\003\3159\027j\n\353\fR\203cB\220\024\2437X\334\320"
+	.ascii	"\257\205?\3541\024\342\005\202\302\013\3264KG\nW!\227m\204@8"
+	.ascii	"\357\n\272\301\017\241\253A\234\267\252\355P"
+	.text
+	.section	.gnu.lto_afatfs_feof.101.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\375\b"
+	.string	"\246\221?90\345(\035\300\\\270`8\271\\\2166\250!B\242\310\350>\\8\302:z\237\267\365\373\240\030OQ)\275\333\177\303\200\240\306B\332\363\230\241\345"
+	.string	")\370 \211d\023)S\n/"
+	.string	"/"
+	.string	","
+	.string	"\320\266\0218&\237\376m\2642)\027+\022\227\335/\252\306O\317\223\177\2203\264\300TX.\3243`aw\235,W\305\255\267\255\261\255`\373%\234\f\026\213\303Lv[1"
+	.string	"\273\002Q:l\337\266\311\306\330\316\264\357\361\017\323\275\322\005v_%'\273\337\2019\333\241\277g\264\303\355\003\332\003#\251\006\356.\022\261\355n\202\037\"1\261q\034\372%\355\360J"
+	.string	"\363R\031\263?T*\206\375lw\327\3722\274\367g\232NM_\013\237\206\020(\263g\323\201H\035\220GD\321u\"\027\212\242P\307!zF]\334h\314=|F\221\304q\243\210\371\366\206Z\220R\225S\257P5\300\312SA<\013"
+	.ascii	"u\261'3 \f\273\207\263\240uD%Gi\202.co\227Q|\2520\246k\222\001"
+	.text
+	.section	.gnu.lto_afatfs_fileOperationContinue.102.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\177\004\325\026"
+	.string	"\346\345\213I\260RRc\352\376*\377e6\301\335\305\264\204\\\324V\336\332 Q\016\262\007}\r\236\217U1\203\212\b=\nE\264\221\356@h\340\353\243\026\334\366\254\315\310\353\013\376\241p\236\2208\246\313&\244\217\r'\351\266{o)S\nz"
+	.string	"m"
+	.string	"w"
+	.string	"\247yv\027J\316\355\265$\207:Ka\367^\233Mq\336Gj\264Y*CO\323V\236\337\373\bW-\213\266b\204,\"\315~\023|\312$3\242\311$\026\347\217g`DD\026\305\202|\2027K\220\320\031\361!\207\006\364=\350\367\203\312x\202HV\t\372\005g\326D \264\002Q\002\3041O\264P\004\371\361*-~\301Ze.\367^\327\035\240\317Mr\3732\333\013l3A&\254k\320\333\n2~\370\252\020\333\273\307\250I\357\275\n|\030\0338\244E?}\033\364\347\355\217'@\225\034\n\225\2147ui#{\325\016\331\267\313\345r\314V\310\276\3617mu\255\325/\261D\254\036\036\021'z\272\267g9\344*O\251\0255\333\257\366\213W\342\335h\363"
+	.ascii	"\367\n\205A\335\213\\qK\372\323\310\237\240?\323\233\240\017"
+	.ascii	"gzJR\031\346\325\253D\n,\rq2\355P\226\257\234mY\371W\351\325"
+	.ascii	"Q\225\317\003\315!)\362*\276\240\362u\234\307)?\207\331\004\345"
+	.ascii	"G\331\342\r\037G\005\352%\221\216.P\223\357\344\256\364\336\336"
+	.ascii	"\205\177\f\372S\305\345\372H\252\360\272\327~\r\333]\2770\035"
+	.ascii	"\336\337E\336\003wq\177j\021\333\027>#f\300\320\272/i\370)`\253"
+	.ascii	"\332\016\\Tb5\nL+/"
+	.string	"\030r0\246q,;\030\232\033\fN\306\303\356f\323\345l2\271[\214\r7\263\263\261\030\260.\303\313\214\215F\247\233\261\325\220\367\346\265B\266\313\215\305\361i\374\346\275\367\2164\230\302\212\2529PR\372z$\321P\036@ \236\330\361\224*e\230\327,\202)\365;\021C\244\022\276\210\300\344Rf2\201\302\330\223\030\n\340\206\003\263\361;\021})O\222jZ\333B\256~\307\007B\224\245\364\331\236\003h\250!\200\205\030\"\222\202\222\024\024%\0350\003\021!n\003\021\2608\b%*\032Kyu\025\tC\r'FI\211\334\335?]\303\003A)-\016r\222\254\357\017M\353\322\tI\035sCB\205\274\206Q\3054&2\032`\177\245\345\r7\377\303\342\t\002\277j*\247\b\350\254,\bJ\246\240X\022H\013\204\331\364\266~\tHb\240\177\020\234s\214d\353\201\254\370[\202\005\375\261\326\350x\212\022\322"
+	.string	"W]\001\232G\277q\245u\315:\020\250"
+	.string	"\261>cMCCi\26076\363\377X\213\230\231t\\x\2533"
+	.ascii	"\337Z\005"
+	.text
+	.section	.gnu.lto_afatfs_fileOperationsPoll.103.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`h\001U\016"
+	.string	"f\232]D\020\257&\035Hu \372\301\037_J\207N"
+	.string	"\367\373\232\306zg\311\330\016\365\312\240;O\374\223\321)\332F:[\fL\267h\342\200\346\255"
+	.string	""
+	.string	""
+	.string	"\225@\312j\257c`|\325\355\307{\342\215H\310\336R\246\024H"
+	.string	"F"
+	.string	"M"
+	.ascii	".\016\230,\367\221\271\261\020\003cw3\345`=\374n\230\245G\250"
+	.ascii	"Y\3621\217\226\303\224\252\325y\334#$\260\273\002<\023\250 Q"
+	.ascii	"\336)!\b\224\353\277\307\224j\246\363P\236\230\307\356:;\357"
+	.ascii	"\344\276n\233d\273\303~\210\312\331\037\227\272b\377\253*6\366"
+	.ascii	"\325\235O_\343\303\242E\312Ylv3\264n\226\025S\260|u\373.\376"
+	.ascii	"g\316E\374\245\364\225e\276'\373\013"
+	.string	"1T`x\261\273\235G\1774\0367n\340z\204/p=\236\343\222\035\247l\351\306Q\220\004\360\204\237\bY\300@\273\211\007\236\022\327\177o\220R\331t)\246l\251\356.\247\006\220w9\t\222\244\3315\275\263\267\307\204p\320\354n\007\314G\214|\017\217\226 \222\357\036}\221\353\321\036\241\220\357\334\3510\203U\022\332\035\362\214>H\240\217\020\310\310\b\224mZ\006\242\201 d!\321(\363 \360\026\301\201(#m\233(\343|\373\257\252\370-?\352\303\006\226IOQW\214\255PL\265&;OE%x\352_`jJR\306!\344x*\246\003R\252\231\n\032\002\" P\202Q\216\322\003u\366\346\320z\304h\007\177\277w\255\3042\273\350\214\355\357\332b\211\207wC\023\n\003|Dy\305\275\037t\203\205.u\206__,\363\322\016#\326\226\307\233s\354L\277\225G\210\220\231\215\033o\310\265\267= "
+	.ascii	"e\323%\236"
+	.text
+	.section	.gnu.lto_afatfs_getContiguousFreeSpace.104.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\235\007"
+	.string	"\242\01656@o\323\001\230\216\022\t\201\202\2662%\t\372J@U\310}\350\004\032\210\260\231f\377\261\262R-\260\320 \307AX,\3753}^\322P\237\223\347\217\365&R\246\024\2768Z\007du\256OH\263\"\346\211\037\217\305\020\257L\213\234\215\261\206\205,\2020,\213\230oO\255\226\254\032N#l;\274d\033X\261\265\223<d4v\367\340\320\037\371\007\341\233\016\035\022\345\273C_T\035\246\006\210py\262?R*\206}j\265d;\235j\300b\262x\307i\227\342\364\262*\020e\303\366\310\306\370\037\007\031yK\220\340<\202\224\213\t\023\227\335/j\236\251\016\251\013T\207\232\361\355\271\371\017\271B\213\307I\347\221\236"
+	.string	"\b\273\353\354\274\212[o{c\273\3006G\n"
+	.ascii	"u\331\233X\350\235\305\360\205P\362\022\240k\270o\210\0213\366"
+	.ascii	"pWL\355$\003"
+	.text
+	.section	.gnu.lto_afatfs_findLargestContiguousFreeBlockContinue.106.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`!\f=;"
+	.string	"\312c\364\025EP\234N:?\177\021\260`\005)\b}*\233Q\371}\224\030b\227[\375\t\034\023\036x\215-v\213\020\r\325\027\004@C6T\n"
+	.string	""
+	.string	"x-\230"
+	.ascii	"\214\002)H\265\203e\370:\202]^\307\232\021K\b\331;\311M\001,"
+	.ascii	"\001M\001m\354\031\317\322\30474\177Q\265\031\335\327\362\270"
+	.ascii	"\276\\\033\337\334\206S\035\1775\236\245\317\345h\252xh\357\373"
+	.ascii	"\032\317n\201S\"\257\332^\350\221\307\032\234Z`\306p\312\343"
+	.ascii	"\373\247\231\023#Kg\233E\215\376[\033k\334M\271\276p\357\372"
+	.ascii	"\245\343O\r-\351\236\315\3357\372V~\345\3236bQ\"\211\357\233"
+	.ascii	"$\372\245C\233\362)F=C\301={6\033\177\177\274\3271HE\363\367"
+	.ascii	"\276mJg\033\202{\266_\345j7\332\n\003\016\346\326\021\365\016"
+	.ascii	"\313-\360}\333\232\220'j\317\256\037j\317f%=\3546[\035\300\320"
+	.ascii	"Q(\b\350\307\247\307X$\272D\303\226]3\266\352\017\235\226\007"
+	.ascii	"0\264$\027w\034\273\320\230\234\030\016Z%\230\331Z\373\032\255"
+	.ascii	"\260\365_|S2\ft\224\344G\327\177\326hu\255\310\2433\255(\366"
+	.ascii	"9\022\204c\3559\263\354\306O\257a\211\025-O(\220\027q\331\211"
+	.ascii	"dC\210<\211V\221\266\307\315\023\"E(\016\326\025r\"#\\-\321X"
+	.ascii	"\035\331\223h-\311C!o\035\0049[\204\006\371\272\365\274&E\315"
+	.ascii	"l\375@\233+\221\232\257\352\347\216\263\240W\030\017\235\336"
+	.ascii	"\367m\374\204\376x\007x\367\273\272\233F\267\261\003\230\260"
+	.ascii	"\273E\334\315\2106\317{\352y\211\366\354\363\247W\340\304\003"
+	.ascii	"\373:\314\322\306ucubm\226\266\037~\276\f\332i\211\007\373?\027"
+	.ascii	"\336\026)l\2266\316\030\343\277W\266E9\253\327,m\301*n\340r\006"
+	.ascii	"\313O\266H\331go\n\347\n\343\351\317\265\211\237I\272\357\373"
+	.ascii	"F\350\227\271\031\250~\331\331\216R\201\377T"
+	.string	"\321\236E\312\237;\002$Z\002\243klL\\\330\335\326\304Y\332\375\253\305e\321\351\f\366f\372\226\367\222\213\273\301\343\336J.\356$#n\244cy\037\235\355\215|\333\333@\021w\201\323\275\t\334\356m\344\342.rq\013h\334C.\356\243\213\033\310\305\375\343\342\366)\342\356qq\033\213\270\213.nb\021\267\353\342\036\272\270[\0277K\304\275\272\270\263\213\033\017q\337A\204)eA\276F}_\037\205\202o\032\226\256\311\343\376-?\335o\367\263\375m?\226\017\273\337\007\363;\252\217iL\030\026\346\3246\212y\335\215\333u\231\365\345\nz\257\334v|\251js\351\224AL\257W\250k\355\216\310\237\f\227\312\313\347:}X\204F\271'\027\310w\002\022\310=y\303\031,B\346\234\0333\201,a\020\023\031b\314\253\033\034\266bv\263Q^\220\347\214\022s1\037\2130)\003\025\026\026\026~AK\324"
+	.string	"X\355\322\324{\243\262\n\310Iy\355s\2365\357\332\002\006\202\267\240Z@\376\335\021 \221S\213\256\r\263\233\031\324a\0212\177@\237\334a>\365\031\002\253]\252B|gGz\216\307\230\245\357\026\201}\214\350q3\276;\201\200m\356\276\200wd=!\205\r>\347\\\331\262\271\315\0038\340\034J\214\305\346\377\361\335\031$s"
+	.ascii	"\232\343\255\230\245\357[\316\315\023#\304,m|\325\030G\373\261"
+	.ascii	"(\314x\331\230\331~,\006\2710a\277\320\006\265\317,O_\260\375"
+	.ascii	"HT\335\320l"
+	.string	"\264g\327\254\271\305\204m\204s\356\007j \360\346}\231\177vs\370\035\345Y;O\007|\363\276\257\207\266\373\003\b\374\347\232\221\316\274l\234s\316]\234\321f\207\270\034\345\037\316\3053>;i\207\363Ool\"&\315\022\017\272Y\252\367vZ~\254nl\fQ_\337\357^\313\273\036f\257\327^\237\257\375\334\367]>\332\037\321\236=rz\353P\367\376\336t\267\337\037}\340u\025I\023\370\204\t\0345\243E\222\006;\025\205\"j\212\270\242J\305\213\250\r1\222\027\242\252\222(\244P\274HB\035\253\244\\Hm0R\315\250JV\201X\0015\225\214\242\352i(&\252\024U\311\024P/\224T\311&\030RM/\244\222.\232\240\246\250\232\230\0224\214\030QSMU0`L5\031\333\230\317`m\004\225b\354[\265FP\347\320o\325~\372\"\022\252 \326\034\021\337\252\035\352\241\214ss\307\022@\363"
+	.string	"\241\024n(K\373rw\005\235\210a\315\t-\345^\203\216\231)g\251UyJ\200V\305c\312ih\323\263d\252xM=.s\230\307\006\371\230\227\362\007\225rQn\220\177\330<\347\234f"
+	.string	""
+	.ascii	"\235{BY\332W\266J9/\335\276\246{E\371\230\225\362\345\276\252"
+	.ascii	"q\3155\365\336\350\232:\356\223\217\331\250/\356\016\2037<\304"
+	.ascii	"\004\035\231\207oyz@Y\032E\t\345)\301\230*5\215\253{\002>s\362"
+	.ascii	"\224 \254\250\217K\034\242\261:\262\237\243<5\323]\0017a\002"
+	.ascii	"\224?\247j\227\366\223}\362Qf\363\234fed?\371^\340\210\205\371"
+	.ascii	"\344\223\251\326\245\261\341\257#\223\352\306\354|\300"
+	.string	"Z\314\265\310\033\203\301Z\210\341\272\353\322\013D\032\310\215\2754 \205u\341\350\323\333`d^\247gii\nd\003C\001\200\353\250\201,\346\2302\210HDD4\005I\322\030\240\002\021)\243z\021\3604\306\034\263Q\230$Y6\003K\007>\364\337\327\236J\320\306\240\245\230'\364u\322}=\022\350\205\237D\022\255l`\316\314|\020c\030S\223\250\346\257&\225\"\344\031\310$\344\324\016\361(\3237T\2126\324\226\017H\016\326\364\222T\274\247\334\345=\363\2214\335e\212\330A\361\337\021\034N]\032\216\262*&bB\2574\\\2065eE\355\226\3009\241\303\230\253XD\f\244\257\376cq 8fOy\270\255B\235\355c\303l\200\362\341\177\304p#^\312:\3323\365\312(ME\022L\310u\372\247|\371\341\355\216\207\235\343Z\221\033\244\210{\340\016L= \324\277~\177\032 \3455@\367\037,\325"
+	.string	"\314Q\256M}\201,\341\017\2200n\006:\b\006r\035E\260\305vB\305\351\2145\350N}\347)wa\221+\344\350\020\335\356\b\210<\035\326$\205\023\030o\303\347At\224\217\346\274\324\003G\255\202kK\355\037\200\233\264%\351\310\323K\347\253\336\335\337\367R\201\206-S\372\347\354\3136{\036w#\244\242b\362\210\002\356Q \324\252\320b@1-\262\312\2415\365\013\023\027\313\225K6uTA#h\255Y\225\250\r\215\347$\265\244\235\027\"g\343\377]6';^\326\b\352\377P\020\302,\257P\367\022j\261Xy\005\224M\273\301.\021\332(\351\261b\315A?\025\n\247\007\235\020\312\301\032\212\206\236x\213\371\350\320\t\371\003\330-T45F>\001\272e\310e"
+	.ascii	"\352A\001\241\3664=s\232\305\265\224\311\313\005\346(\331@\357"
+	.ascii	"ATT\032-\037\206\311\354\2426u\006\362+\244\3610\272<=\216/M"
+	.ascii	"\315\272A_OkOq\204\032"
+	.text
+	.section	.gnu.lto_afatfs_freeFileCreated.107.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\271\003%\027"
+	.string	"\006(\221J\300RRc\302+}\372\256V\327\355\207B/\356E\321>\232{\031\272\203\206\032\324"
+	.string	"n.#~=\001\317\223\016\242vg0\252\205\001\003\nj\362U*\276R\026\225-T\323'U\211\235)\025:\331\261\036\333d\357-eJ\001z"
+	.string	"u"
+	.string	"\201"
+	.string	"G\367\026\031\330\004\275\351\342i\347M\364#\347M\367l,\0026w\306d\t\n\307\310u\357\255Y\237\367\036Ca\247Y\332\332\363\211\036\373\001g\036\253\301\243\260\021?K\005\302\246\035\021\340MI\223:qu#N5\317\243\023|)\002\264)\017\334{e\300\232j\313\221\240\321\361;D\220(\027\034\201J\234\3505\007\350\253\025vr\357u\375\001un"
+	.ascii	"\267\275c\333\201m\243\002~\221\007\036\212\342\346-\205\253"
+	.ascii	" ]C4\365\253\036\201\202H\3262g\265\366\206\312'\265\252\251"
+	.ascii	"B\354\242\357\345\265C\373\345\265=vY\215\232\325\260\017\375"
+	.ascii	"\265\254~\200\231Rj\263\204\264T\305\033\342\313\353F\2316R\370"
+	.ascii	"-n\214\371\013\317\266\234\220\302\240{\357]<\265a^\364\203+"
+	.ascii	"/\342\275\027\306\216\261e7/\263\375j?\350B\275\017\311\\\300"
+	.ascii	"\275=V\001\251+\\*\n\352\351I\311'\242\226\2057\351`Z*\340\203"
+	.ascii	"\005\324/\013\265O}\3419t$\2511<)e\2003\034\207\206\331\315\033"
+	.ascii	"Oo2%\235|T2\262`v\350-\036\344\212\323\366\330\376v\302\354\314"
+	.ascii	"*\255\272\321\266#\335\320#\230\275\361\bL\024q\t\205\206L\330"
+	.ascii	"YN[\3454Xh\310\0317\302\331\033Z\352\177-\347\315\017W[\\Z\007"
+	.ascii	"\n\032!K\335y\273s\3560t\350\275\267A*\034p+\245o%\274\225\027"
+	.ascii	"\333\312\315\005\206g\253\345p5\027\234\255\245v\333\361j%$\316"
+	.ascii	"uP\331\325^r\271]MV\244yyS~n\027\020\032\353\213\331\241m\003"
+	.ascii	"\325\206\020\241\376\347\023\375\304gg\202FG\025\250\035\272"
+	.ascii	"\236\365\032\177\020\310\237!85\314\337\353N\324\346\330\345"
+	.ascii	"\017\026\032\026\321\023\034\251\246\204A>\312\371\324\022\236"
+	.ascii	"D\261\252B\022\223P\304\t?\366\230\342q\245\344\023\227\326c"
+	.ascii	"\374\001I\250A<\242\214\222F!)\232$M\245\r\260\002\221\241\253"
+	.ascii	"\035\020X7\"\"\211\036uKC&\266\004\003\261^|/\223\350\354\270"
+	.ascii	"N\370dX\037[\fO\017\022MY%\273h\224\332A?,\004\221b\016\034\013"
+	.ascii	"F6\205i(\fl&\345\205\342\301\3162\\\342\027\272\267vny?\323!"
+	.ascii	"@\253<P)\020\t\343\n\317p&P\257SLk\020b\236\343\354\026>\026"
+	.ascii	"\361Fb\277\216/\224\372\220\231\304\361\355!LJYO\232E\376\241"
+	.ascii	"\321Q\213,*\210\021\310\202\027\257\030\364\345^\005"
+	.text
+	.section	.gnu.lto_afatfs_initContinue.108.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\270\023\245V"
+	.string	"\352\215\274\037P@R\322\031\016\276\004\214"
+	.ascii	"0\021P.\222\246\022\266\242\362\313\276\303\376\373\216\356:"
+	.ascii	"\300L2^!\312\344\245\301\024\246Z\273\207:\200\366u|\306\210"
+	.ascii	"j7\363\346.\252d\324"
+	.string	"\bR \206\330M\"\222\244*\2143ov\273\273~E\255\356nR&\031\347\001\277\001\356\001\201\177\253\034\372\203\221K\371\247\374e\177\223\007w\277\007\342W\222\336\2661\\L\270\257\244(\257\262\364\266Ub\2669\217\266\377\341Tv8\245\030\\\323\214\340\200pq <*\245(\004U\266\"s\330\360\322\304\234\024\b\227\236\334\207\025\316\266\035C3\310\325\276F\343h\213Va\352\321\330]aw\350\344i\273\303e\341h\3138R\315\274\244\330\272\256\303\243\273,\354\016\217\006?\366\035~\266C\036n\246\276I\215\2579\326S\365\271m\351\255k\031\013\341Q\241\340\311\316D}\231\0137\253\226\365VO\267/\275u\215b\300\321\205\240\354<\351Q\341u\322\243{\260_l\231\314\343\266Do]W\024G\267\001\341\321Uw\231>QkS\003n7L\2359\327u-\352\0326\310\352\005\b`H(\250\004\020"
+	.string	"$~F\370\364\210\340\331\321\311\301\271\261\251\241!\016gd\2041)\032lV\367)\236_\216\310\246\013\360\224\023{\0060\324\003\0131\371\202\322\230p\t \265.\2531\006\200f\351FB,\214\177(\330\312\263rD\352\370\210\230\025Y9\300\356\363\365\236\257*\037\322be\204E\024a\236\255\357\344\220\266\305:`8pN\227\325\r\214\343\026x\344\306\305V\234\234\330\323\246&f\305\331i~\234\030, \371vu-V>\202<Y\206\344}\355\007\017\265X%\203B\353\272\276\313\252\007\317\004\027\210r\372 \0161\265\345g\037\352\262\342\3012CY9\324.\374`\271\305\254\356\tR\307c\260\206\310)N\203\037\302\305\354Z\254\324\202\021\274]\215\375\354|\003)\305\350\023\262%6h\001\3311\203\214Jcp\370"
+	.ascii	"{\226\225\232L0\201\253\367\f\362\352\034\263b]\327\345#2\307"
+	.ascii	"w\200\357r\330\356\246\260\213\003\025\255\fsaL\357\252L\204"
+	.ascii	"1\375\301r\t6\334\001ol\346\357\351\301\034\355\264\205v'\340"
+	.ascii	"\027\212\302\033hk\260\314{\316\375jJ\216\310\311\264\322(\335"
+	.ascii	"e\3016\214\246\276\226B|\361a\244\273/\030\n\306\023\235\363"
+	.ascii	"8\336\314\204)\274\366\304zX;k\277\345\273\036p\323\021\220\035"
+	.ascii	"\257\367\261\334\362\325t\342@\007\244\350`%\246\225{B\032\354"
+	.ascii	"w\231\341\375p\367\256\005\027\360\217\301\026\202*{\367\007"
+	.ascii	"\313\270'\226\023\007\252\220\313\321#}\215\224\373YfwP<\304"
+	.ascii	"\366\360\237\227\371\266\245G\373\016\033\b\217\373b\272\313"
+	.ascii	"A\007\374#7\253y\001\312Mu\323^\356$\224Dq\35251\340n\331\323"
+	.ascii	"\037\3602\227\206\372\355\277\304<\243\210}\361\355\233\351\235"
+	.ascii	"\336\336\013\312\266\3343\203p6\270\360\366\\\032\220\253no\307"
+	.ascii	"Q4X\234b_[\366t\017\322\344\006\004\327\032$\313^\3132\205\353"
+	.ascii	"\332\364\344\376(=:\264b\245s\033\213\333]\346\237\024j\255V"
+	.ascii	"k\331\212\342IV\036\034fw=8\334\221p]W\007\366n\177\013a\237"
+	.ascii	"\303\321\035\001\211\177DJ\217\276Q\257\245^r\214\314\211\003"
+	.ascii	"\367\017\256\353\272\006[\371\303y\311\323\352V\356\371\234\205"
+	.ascii	"C\307\225m\"\273D\336\027D^\0275\274FD\336\0264\274\n\\\312\227"
+	.ascii	"\350S\276)L\f\311\360\376\310\360\216 \362\372\020y{\210\274"
+	.ascii	"\"\210\274<D\336\035\035\"o\016\221\027\207\310{C\344\265y\223"
+	.ascii	"o\r\221\2278\303;\224\341\235\221\341\225\031\362\n\317\0333"
+	.ascii	"\303\233\022y\321!o\360\274=\303\3132\274\257 \t\312\323\334"
+	.ascii	"\231\033\016]W\266\302\020\373*\306\247\021LwS\372\3474\244\247"
+	.ascii	"\225D\315\323\257r\306z\001\211\020\2769~1\335i\236\366\001\004"
+	.ascii	"\344\266\242"
+	.string	"\220\312N\277\311l{\222\245\350\234&\352\0346<(\306@\376\241x*RT\2527\211\242V\251\200\222\242O\345(hh\376\3218\241\234\210h\345\362\016?\355\257\262;\022f\n\212\316\327\027S\027}\303E\347t\214T\023LN\253=\351!\315\207\356\270WLq:\247\017\200\223J\336\264M\343t\020\335\024\226\213\276\351\237\375\305\037\223\315\254\016m\317\211\247\2259]~Sv\232H_}J\215\232\006\317\354.m\325&n\242>\t\315\214\372i'@\210\023gr\214\314&00\260\207M\327X\336\305I%\237H\350QU\351\264r\351^L\211X\240x\210(fRt`W\235b2\225\312\304\r\036S\253\200\354\304\210\375 \230hO2\276/9\352\001\273b\2369\2339\303\007xWE\252:\370\307a\263\332\022\035rOy\277\332\022$N\003|4\366R\303jtP\225\f\330%\231A\375q.J"
+	.string	"\345\240\356\300\334,\300GS{\250?\230\226\200N\004P.\242\002a\300n]\245~T\205\b\245H8q\364h\234\203\032\026d\267\256N?\356\252C\030\007Uy\342\206UkPm"
+	.ascii	"\362\n\363\266b"
+	.string	"\341\275\206#\036\032ZX\376}5\205\210\263a\252\023\031\322tv\020\030@\232_\315\232\231\376\341\343\270\347\304\2012=\323\301\245T\362\211\003\227\307\321\016\231\376\331Ox1\2354\005\360\356\327\324-\325\b\377\270\301nj!\212P!\252HR\005\372kg,#YM|sG\370JE\002d\347\303\252:\260\016U\311\216\326\321e$\347P\301\2766\202\032\226\302\306\325\261\364\250\002}\037~\342\210\023\256\344\030\031*\327\227\034\006kD\304b\002\f602\322\300\305\220I\t\211i\211\250$\203i\211\006\n,J\230!cf\211\006\023\022\323R\252\224\304\024C\306R*C)\311\202\244\022\322\215A\264d\002\023\222\t1f\260\260\204T\224tB\321\214\023\220R(\212\241\264TDdb\223T\220\241T\304\224\224\244T4,sz\023\031\222\215\3119\365\323\272\020\\\327,\t\364x\300\3623\340\267\354I\213"
+	.string	"\2554Ji0\342Qbuas\366\235\350\306\027\344\251\027\300\220\254?g\263q<\b\220\277\257!\270\"%\206\272\246o\034_\323\250\337\027&Bao?\375\343\250\247G\364O\007\331\232\307\221p\307\210\026\201\351\367$\013\032jT\352\013\022\016xo\264\222\036\255eP\303\030\320\352\030T\245\212\2762^1\272\361\217C\315|amrQ{SJ4\322\250\247\255\270\230]\276\336U0\372\005\246\263\231"
+	.string	"\0176\200Z\271==\2560\177L\264N\337\340\327Hu\032\365\363\343;R\312\026"
+	.string	"(\224x\3755U\333\310#a\242Q)\2779\263\273\f\330\247\217\326R\306\270\036\255\216*\276\257\241\214}\257\353'\265\352X\332\351\306,\351\256q\316H\307?\232h!\251n\3320\305\036@c\037\267i\375\251U\274\246\005\246A`\326\201\221u\371\325\302z\374\264\362\354l\203\222\256\267\021\255\334\347Q\220\235\363I\230q_\315:\366\353k\222`\343\022w\334\353\271\343=/\252Roy\334\013\266\350\236\027>\230pOuh]/ZD\267\350e\251\256\247+k\344\302\313\2420\357E\377\312\t\020\262&\226\034\303+\336\312\235Ju'vjU\004u\":\305\302\204\003#[2]\361"
+	.ascii	"\255-\252rn\306\333"
+	.ascii	"\016\242."
+	.string	"\234E.\016Kz\305\264\002\206\265k\364\302oE\025ZF>v3\366\035\020\204Z\025t\205\312\203G\320\372\222$\307\260|Zp\201\201\250Q8\005\231R\246fD$I\n\222\306\221\005\304\030\346\034<\017\021\3200\205\234RDR\323\244\315\201\224j\355\371\023\bY\034\020\376\227\342\267m\330\002\275K*v\333\261\241Q\213\361\357B\257\345\307\206\273\207Qw\217\361?N\246\372iP(\240\237\273\306\267d'{\207\2439\027\236I\347V\367\336\026N\234\363_\234\177\344\n\336\260\377\260\326Q\300\257\275\333f\324\364\336\241H\260,a\313 b\276\305\305d\262}g>N\223?\225\231\312|[\251\205\262\262(\321\323.\307x\257\037@\275)\032\355\347\027\227\271\207\204q:\222\2179)>\2142$\223F\334\251\354#\311']\256\256D\200\227\376\375\r\002\341\245B\254(\314\232\327\240cD\324\347\2558.i"
+	.ascii	"u\260U\024\227\265Y\332N\265\030\2264\340\372Ap&|<\221\023n\307"
+	.ascii	"\273\006!j\202\206\376\325\303kQ\034n{\327\232-X\214:\244\330"
+	.ascii	"@Qi\346Jn\024d$\366l\276\212\364lsx\317\347\307\236\2000\230"
+	.ascii	"\342\b[]\003yy\310?:4m"
+	.string	"zh&+\276\253\301\220)b\202\366\256\332A\336\205\\\240\226\263\215i0n\025\200z\345\002\261\263\376b\315\267\304\312\274\355\027\032\306L\fA\255!Z5\220\037\t\301\212\340\213P\354\"\341\f\201\003qFB\te\332h\244\001x?\321\252\024\374=\033\220\005\273\315\3560\276\017\260_A\356\256\244\240\023[0Y\217\350A\2473#\0379WG\345*\n\267\324\341H7\003\365\024\022\317f\263_\030\273H6\341\031\335P\301f\177-\351q\224\310\006!'\350\321.\025\246:o\327WyH\264\213\243%\\\013\335\220>\fl.b\b\207r\237\013\343\210\030N\222\371m\266#5\356j.\fA\021\275 \236\270\253\016F)\254s\020mF\003\266\310N\216\217T\316\2628\262B\323\003\332k\312\020;,\246H\224\320d\256\035\213\013\342\027i[8-\344\313\265\221\276\354}\274\3022[5a\312\230j\0173"
+	.ascii	"\021\321\361\226SJ\2315\030\235\035\275\022\363A\365\357YM\027"
+	.ascii	"\210\030Z<\021\246B\344G\275\030\353(\302u\265\0061\256\236\203"
+	.ascii	"@(f\300T*\241\223\003\021\321\346\034V\324\211\201<f\223/\201"
+	.ascii	"N\375\307\246C\036\261\341H  DR\255F\201\322/\247/\240\016\202"
+	.ascii	"T\3320\235#\312\221\363H\003\f\232\262\0061\003\344\251\2000"
+	.ascii	"\323\202\207\204AI\251Y\366\022\032`\212X\307@J\234z\331\f\253"
+	.ascii	"\006\2512\215\335\226\300\205\316\207\213\246\216B\351\215_O"
+	.ascii	"C\177\272\333a\324\346jv9\235\220\322\265\210\353\360\353\022"
+	.ascii	"\330\207HH\211\237\310\031\022\265\330\274p\252\\n\246\002"
+	.text
+	.section	.gnu.lto_afatfs_poll.109.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\267\001\265\020"
+	.string	"\226\236nG\360\320&\035\226)T\377\037\207\247\005\327\n\212\264\225\371L\364T\262\236u\253\336\273F\357y\262|,c{\264&\r\247,:S-\314\213l\033$\027Ol_&CQ\240\274c\315\364\223+\275\362\254\021\262\367\336)\005X"
+	.string	"X"
+	.string	"Y"
+	.ascii	"\333\3537\267l\030\017_\326@\017\314\006"
+	.string	"q\306\356rS\304[\317*\235\262\345k$\032#\364C\002\272\236\025x\375pJ\017\254\260\360\360\234\313\022p\204&h\301\342s\021&\247\026#\204\242\004\324@G\273\373\231\313\016\340KJ\215\264\273\226$ \312\255\335\366g;\202}\236\246\322tJ\037\200\003\0310)\017\372\3315\031\2056VS\310\370%\236\363\232\213f\235\3063e(\266B\263\273\333k\374\021\307\361F\"\303\027e\317\341eF\005h7\364\020\275\336\3467\254\207\336\031\301\302\0055\026\0251\032\216W3\020\275\216N {\245\337\310^m\226\035s\272@\214\230\310\320\351b\216\323\371\201\303\003\223A\276\350\323OxG\264\273\r|\023\327\241\340\303\274\032\345U\337\233\027\217 \206\217\213\225\032\033\0219~\034\307\032\323!\331\347\007\316\013\230\f\262&m\325\005y\222\317\353\330\364\304^\323e\207/9]\354\317q\034\207<[\034\035\352\004a"
+	.ascii	"\206NB\312\343\363V\246\356\301J\325\235*|\245n\303\246\016\025"
+	.ascii	"\310\252\004bJ\205\250J\234w\342R\247\022\2123}*\256C\201=\013"
+	.ascii	"\335\307\255<\357\343\266P\344tg\313v\243\022\023\231/\321\313"
+	.ascii	"\236l\210]\020`\005\215\023\032@.9Dww3\001\3226u\2379\3515]\365"
+	.ascii	"\342\004\007$ 0\002\242\314\341\016\\\344\250+\310\004?\363\253"
+	.ascii	"\335.vV\261\365+\304.\345\262\371p\301\034\004\334\021\260H\025"
+	.ascii	"rS\330\023f\004\236L\321U\357U\366\365d\260l\260\307\320\262"
+	.ascii	"]W\321\253\\\274z\216\\\370B\177\226\257\232\020\272\347\304"
+	.ascii	"\263\324\206\001\265ul\374m)\003"
+	.text
+	.section	.gnu.lto_afatfs_getFilesystemState.110.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"E\007"
+	.string	"\362\31525`m\322\001@C2\222\200\211\341\302\200\037K\324U\277[ov\232\2029\244\241\336;h\313}\364!\032\221(\300\350*\r1\202\n\245\025+\274\266d\023)S\n\2762\232\246ci.\216G\263 \266\201\234\215\305"
+	.string	"\257L\203\031\214\261\206\205\fv0,\203U\267\237VG\326\013\247\020\266\035\036\262\001\354\256\201\017\362\356\301\327\370\263\347\223\217\177\376\207\372K\r\370\340\262dw\241\324\013\373\323\352\310v:\365\2004b\361x\262;QZY\223W\262a\033dW>\307;@\336\022\"\270\n\202\024\222\204\210\312n\007/\037\240\376\246\013P\177\212\361\355\271\371\367\270\002ID\211\242\320\323\202\260\273\316(\242\270\365\2661\266\013lg\004\t"
+	.ascii	"u\331#Xh\226\305((\004\350\032\336\033\341\262\020d\270+\246"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_afatfs_getLastError.111.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"=\007"
+	.string	"2N35`m\322\001@\003\352\221A'\310\323\321\263\345\377\030\177\246\271\374t%"
+	.string	"IC\275w\320\226\373S\205hD\242"
+	.string	"\243\353\222\024#(\324T\354\262\326d\023)S\n\2662\230\246Si,\216\007\253`\334@\316\246j\200\326\205\301\f\306\321\201\341\202\235\030/h\351\366\323\352\310z\3214\302\366\303G\262\200\3355\360E\336A\370\032\177\366|\362\333\237\377\241\376R\005B\264,\331](\365\302\376\264\273k\035\331N\247\036l\240X\\D\332\245(\255\354\311+\341\260\r\262-\276\307?@\316\024$4\016!\245c\202De\267\203\227\023P\177\323\007\250?\305x\366\314\374\203|\201$2\331\270\320\023 aw\235\033Wq\353mcl\027\330\316\b\b"
+	.ascii	"u\331#Xh\226\305((\004\030\327\224,D\036\356\212\251\235d"
+	.text
+	.section	.gnu.lto_afatfs_init.112.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\035\b"
+	.string	"\322N67P\215\322\001d\364\314\260a[\265\210\202f\024\325e\342\202%\364\027\345\327\325\274\263\026\r{\305\260\203\351\256\266#q\300\3144-\305\334\033\021\020\025\205\232\306m\367N)\31604\323\3012\031\347C195\222\243\30162\323\250\304\020x.(h\2623\247&\257noYX\272H2R\"\b\341\367i\331\233\213\314\220\223j\311\311\247\226\315\360\017\352\221PU\365\335c\331\r\357\360\004\230\354\256\201\217:\307\3077=\372\001\364\316=\372 \353\321\241\252N)\242\267\262\273\320\203\025\366-\013Kv<\3200Q\\Bewb\265\262\2518\202a\373\2277\373\344\335\305\n\240\240\"@\352\356Jh\361\355o\363\277q"
+	.string	"n\024\372\273 \354\256\0377\"\335\360\266\007l\027\330\256\001\017"
+	.ascii	"u\2617\023\232\377\201E\315\r`\023PI\r\004\202\355>%IU%\240k"
+	.ascii	"\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_afatfs_destroy.113.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\321\0075,"
+	.string	"*K\354\020G`\032V:\177)\276\352\365\313\356o\26196e\237\320\013\275}q$\306'\341R&v\341\356\226B\325\214\204\033\341\305~\036\2772\370\242h\203\257\30468\0208\206\337\262"
+	.string	"(R?V\355p\357\373\366\023B\366N2\371"
+	.string	"\352"
+	.string	"\002\001\322\027kW\244L\032t\356}\337\244\267]\201\367\366\350C\367-{\241\353\324\375{\213\273kt\377\272\033\343C\227C\267\206A\311\274\257\264AK\340\275\205 \241F//}Z\r\343\2527\266\314\275\257\224\230\221t>+}\357\360\362A@?>=A\340\317\327\343\355\334\226\025f\274\354?=h\247\024\375\0069[lP:\"YJ\016\304\036H;\373q\001\\J\332\376\263v\365lb\237C)y\217\224+\256&\016\262D]\270X\004c[\030(\344?!A\260\017\211H\026\220\367\326\256\200\374\300<\366g\355J\213}\360\276\257\024\336\371\242\370\270\333\343m\017\226\215\262c*\254)\314\362|\\\310.h\242\331\261v\225\204\035\252\025y\363\350\022\234\331\241\225\023\346\303\216$\345*\t\273"
+	.ascii	"\316\254\316\243\307UXQ\030\357\224\336\367m\314\304\312z\003"
+	.ascii	"x\367\251\272\033F\267+\026K\037c\fP}+&\347\227\275\325\232\223"
+	.ascii	"\243\3534\326#llv\366\337t\314t\310\t\263\221\243\213\363\211"
+	.ascii	"|\271\365\212\2079\362\336\367\235\3207;\030\026}&o\333\005\022"
+	.ascii	"\237\211t\337\342<\300\315\013\n_\217\307LYA\311\331\331K\027"
+	.ascii	"@~\364X\013zE\315\272\346M\n\327uK\243pvv?_\257\327kg#\215\204"
+	.ascii	"q\037\031\025\021\r\t\035\372\003h\334\301\223\275\201?_\357"
+	.ascii	"\3237\257q\357\\\334\256\213\273\335\341f]\334\271\305\215\017"
+	.ascii	"\344\266+VU>^E}_\253\353\2357\255\005\363\344d\377\364\270[\254"
+	.ascii	"_\326?2\037\265\n\356\305\271\274\313\261|\254\333\351b\235\333"
+	.ascii	"\310\2304\241\357\373\376\274\372a\375\253\361\351\223*\024\307"
+	.ascii	"\322\377\372\226\376\201\311\370\233\365>\307\263+\b\334\373"
+	.ascii	"J?\\\372,N\327\322gGR\001m\302\244E\345'\240/\023e%\035\325:"
+	.ascii	"'\316M\233\256_v~\2539\245\2527\224\233\345\te\237\233\223q@"
+	.ascii	"\034NqX}\343\346k\321\225Y\361\t\345\241\254\244\363r\265_\354"
+	.ascii	"o0\212\252\357\013u\246[\021\301\263\372\260\003\271i\303\225"
+	.ascii	"6\225\237\022x\221\t\351\261\273^\026\272\231\2679\311\346\204"
+	.ascii	"Q\210\263\025\207\3255\255\202\251\227*\315h\035^vv\017\210k"
+	.ascii	"t\036\315\2558\302\244\0033U\263./?\354\257B\333*\023&\275\227"
+	.ascii	"\251\032\034\230+@\273\262<\203\001\233bfW\366\036]\\\335\rj"
+	.ascii	"[\224\233e{\231\227\251\200\331(?kN\016\273\f\336\313E\231\306"
+	.ascii	"\034\236\2506.\315(|\355!\356\217p\331\334M\242\004>\263C\f\231"
+	.ascii	"\312O\335W\003\203@\225\211V\214\360LcT\360D\303f\0379VSf\217"
+	.ascii	"\266v\265\235\265'\334\374f\342eN$xv\2538\231\342\201\352\373"
+	.ascii	"\276\024\002\307+\231b 3\030[\03470\031_ \203F\027G\021A3\214"
+	.ascii	")\230:$\221\312%c\be\223\361\330\"Y4\n\235\224\311c\212\266\227"
+	.ascii	"\0344\251P\026U,195\025\211\310#\221\351XtA\\J6\021\035$h\344"
+	.ascii	"\013c\222\250D\"\223\304\237\024\352\354\233\215\360\340X\321"
+	.ascii	"L\251@\377\322mbe2\245\366\234\372`\016\346V\202\312Q\315\276"
+	.ascii	"\357\373\006\025\300\016p\274\317\270I\277\327\257\310\236g\236"
+	.ascii	"et\211%z\037Z\327\020:8\033\371\251\235\230\351z\002\312\316"
+	.ascii	"\376e\013"
+	.string	"q\324\342\326\240I\341\272\013`a\276\374\354r\022\303\355,\353v\271\245B\006M\323L\022\305';\337fN\260kOv6\365H\006\246dO\276\336\214p\177L\003\007|&\222RT~\002\253\3628\023\354\271Y\2337\250?\242\334\254\317\227\177I?\312(\276\320>\326\035.\327g\274:G\371c7\020\367\206\255\031\365\"\302\335\036>t\t\200\241\250a4\002\221\202\206FFDF\223$\035\220\002\021!\263:\006\021\320\2454C5\251a;\236\241T}\217\0315z\331\356A\022\004\\\320\354\227|%\3313\223\034\025j&\0017\276\325\005\003 \003;\346\274\035\243\027\220T?cB6\342\250\bx\303\260\003Bw\f@\261bY\256\331\370\335\320\265\271\257\362^P\3322\327\212\232'\224\"p\302\367\355d%\3215r\235\0301t@\303\360%\207\377\224R\375oE>c\226D\365\301\006\004\244>\270\371"
+	.string	"\226b\\\365+\372\357[\216+s-\234?\032\031U\251pF\205\375hD\3328\366\252\347\267A\250\216s&\037G=\023\027l\267\303\340\210q\007\376\305\333m\360/\034\326^+\024\232W\364\001:[\236\336\203I\023\211\253\301\367\313Z\245\364\212\256q"
+	.string	"\376\272\327\342\013\353\223\221\214^\235\034\241\316\216Y\310\214De\024[k\031\320\225\244\2742\177Z\036\256\351Nq\274\233\372l2\270\333\361 \370\377\303B"
+	.ascii	"\233\252\031\276\260\255\"\336:\252Vf\353#\305\0163\366\276\263"
+	.ascii	"\006\323:E\330`F\\\244\374\366\312h\2615n'\236\253\333\bD\262"
+	.ascii	"M\375B6U"
+	.text
+	.section	.gnu.lto_afatfs_getFreeBufferSpace.114.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`r\002\025\024"
+	.string	"F\345\203J\300\020)\035\333\303\025\370\375r|\026\233\rGN\331M\250/_\302\202\243P\231 4^XB\311\024y\241\365\203b\235v'aU\344\364\0013\023\323$\b\022\037\202aT\334X\004\230\037\204Fq\351\256\262'\215\354-wJ\001o"
+	.string	"l"
+	.string	"p"
+	.string	"\225\347\n\371"
+	.string	"\360t^"
+	.string	"x\272!\374\361\311\273W\222\366p\005\322\271\222\346\003\035\002\316\203\f\233(\363p\322\037\022\321kh\3400\031\344v|\336\273\274\2115\271\372\350\311\035\3049\235\"4><\201\2106\263\3008cCK\254\221\263%\332\314\220Z+\210H#\367\275S\236\021\312&\346.W\016j\255\2266\361\346f\3356\b\333\rlY\013U\373\342D\023\213]\235\315\223\221%C\035LxslV\b>\350\246\363\273{WZJ\351\177\230P=\345>.\325\212\253\352Q\231(\f\236\007\375\273K\373\366y~/\310I\263\026=\210\3021\242\326j\022\236\336\216\361\201\334\372\216\366zS\237a*\352)G\255<\222S'\bO}\024O\021cZ\204\232\031\361@\224\023\206\241\0355"
+	.ascii	"\216F(\t\316z\03287\334\026n\254\262\031k\262\312^\"\201\204"
+	.ascii	"\243\253\363\377\002\345J*!\245\t\367\275\356\323q\261r\243\237"
+	.ascii	"Q\213\311\257\205\334\373D\374?\245\036\033su0\3407&\344D#y\330"
+	.ascii	"\246\360\"\030\003?\333\263\023\255\214,8\265a_\321B@\247\326"
+	.ascii	"\252@\305\207d\376\316\251]^\344m\247\376\013x\372\035\247\244"
+	.ascii	"|v32\257\317*\270\310Rb\240QJd*\263\023\025\024\226\013\262\023"
+	.ascii	"\027\354\345by\235\254\270Pb2W\311\210a\026Rb\256\031\f\026s"
+	.ascii	"\265x\365\233c\317\325\\\020\f\320tC\007\323\314\326\302\325"
+	.ascii	"y\345\004\262$\374\304\220$\247{\363\004w\017\364\343\306\037"
+	.ascii	"\237\364\315I \025\221:*\361Yk\255\253\271s\337\373q\306\037"
+	.ascii	"*\032\256\347\234\273{\263\021\234.k\0030 `\002)\205\267\ru\330"
+	.ascii	"\323\022\030qh\274o\224\305\023U\316\213\215\0245\001#$\002\214"
+	.ascii	"\302\355\313\226\351\327\027\026\267\247\330\302Y\365&\265=\375"
+	.ascii	"0(\212f\323\267{.zf\362\254\030Dn\235\033\007\267f\264\370o+"
+	.ascii	"B\205\372D\325'\333\203\226U\013\003\256;\343>\227\3601\356\340"
+	.ascii	"m\204a\001o\246\362\363\272W'R\314~\337\324\256'"
+	.text
+	.section	.gnu.lto_afatfs_assert.part.0.132.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`A\001\025\r"
+	.string	"\266WUB0o\223\016\304"
+	.string	"\244\f\236\377o\311\202)r\3737[\233\336\020\354\252\366?\005\265k\252\237x\376\277E#\334\0135\250u\375\007p\244\261dI\0013\221\3533\013S1&\264a\366\306\233\335{\357\235RA"
+	.string	"@"
+	.string	"A"
+	.string	"\306\\Z\263WhvG\bFDH8\351v\227\302\f\327.#|S\363-\237\313"
+	.string	"[\205\307\367\261Q8\024\260y\304\315\356\336\3647a\353xo\300\247\345\263\273\276X\270-\267\275\300\266\002\373\"\001\030d\t\016\036\234y3\262\235\375\244\001$d\367D/_\372\263o\237D\363M\306\330~\311\035\217\366\222,.w\026(\f\\\032>\273\343\331xI\246y\213\216\344\304\356\351\300\245=\227K{\303\001\220d\273\316\303\313$\205\307sa;\343'\365\262\273\t|\223\177x\340o\2704\246\361\376q\351k\314\313\303\233\036Mp(\035J\034o\345A\222\341|\\(b\307\347\3178\222\222\271\260\013\262\362b\003V\255D\025\003\253R"
+	.ascii	"Lq\260\220\b\024\242,\b\030\210\326\212Z\025(\203R\027F9\005"
+	.ascii	"\\\0354\270\250\250\326\213\276\1778`\207\304\230vu\022\030\231"
+	.ascii	"\021\017\341Tt*\021\222^g\210J \005D\004\016\245Sy\273;\202\001"
+	.ascii	"  \260\002\2319\3634\265w*\034\303e\207M\024(\271\347\253\270"
+	.ascii	"\275\262,\212\361\315\343hQ\3575.\265\024\364m\313\302Dg\230"
+	.ascii	"\033\216\251\201\013\341+\264\026\00180\fz\360\272\332\023\372"
+	.ascii	"K]\370-tkJ\275\365Z:\006"
+	.text
+	.section	.gnu.lto_afatfs_cacheSectorMarkDirty.part.0.136.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\210\001%\016"
+	.string	"\006\232[C"
+	.string	"\261&\035 \202t\321B\030\360\002A\336\315g\r\245\247\364\023\353\211xC\177+N+\007\316\243\363\225q\341:\324 \303\376\350C6\211\252\252\252\372\315Nde$\210\252 \214\207\003\rR\311\336R\246\024E"
+	.string	"C"
+	.string	"L"
+	.string	"\177\336\276Q\375Y/P\375\331\027a[d\323|sY\025\217l\032\016\013k\222"
+	.string	"\004\nCL\215\335\205\177\352\341\243k\272\221\177\230\007 \255\230\\;+\032\236\004\356"
+	.string	"8\330][\033\356w\333\036\266\033\330i\005\332buw\273\273V\026\333\245\237K\273o\277j:5\375+K\013rvSR9\333\341\315|\260}\3730\"\373\272\234\371M\264m\006\025g\332'q\323\350%J8\006l\005\023)-v7\004\177\366\260\002\356 \225\3759\013\020\t\245\233\0204@\227\211\033\250\025\023 \370/%U\252\212\b]R8\031\244\232?V\327Tgs\201\003J\246l\207\034E\264vW\201\177\3421\021\374\227?k$y\322\237OR\375]?\242d\203c:\311T\006Y\f\215\2002L\373<\350\030\353\320>B\236\017L\204\202\346\201\021\004E@\236\020\210e\032\3540\3408\362\311`(\306\f^w\253,\266f\300\210q\242(V\325\026\333O_\370$"
+	.ascii	"u:\251\346\300\235>u2\330]\370d\315(\203\322\r\216)# p\202!\312"
+	.ascii	"\323\006\265\331\273\2241 d`\"\240\034\207c\004\205`Wq[\260\370"
+	.ascii	"\342\301\275\002\247\013\243\205HH\247\220\3625\005=`\346bmK"
+	.ascii	"\0217/\344\2070\310S#[\3036Z\013\344K+,\031\231\021\260\024\001"
+	.ascii	"\350^t;\265\350w\2751"
+	.text
+	.section	.gnu.lto_afatfs_fileGetCursorPhysicalSector.part.0.143.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\217\002\265\023"
+	.string	"\266d}G\340\360&\035\332\310\216\220)\260As\316\306\301\263\"\2125\200\315NK\333\"\375|a;\301\227&\370BC\372\243\034|\330\226+'\027g\333\016s\212\2030t\320\270\305\311\247\035\301Z\026\004\370z5B\310\336r\247\024g"
+	.string	"l"
+	.string	"d"
+	.string	"B/\341\342\334X\243\375\021\017a\036\3442 \300\316\fQ@\261\033\212|\232\244\373t\330\331\017\361bP\206>\262\033\333\376\3544\030\203'428\006fN\021\210\234vC\325'\310?\266Oy\001\333\247r8x\215\022\364\243\215,\346\372\332\033\f55\331\310,<z\\r&\273\353\356\302=o\273\304\366\002;\342\bH_\341\004\364\031<\271NmF\003H\305\032\321\310\235\246\220\006bg\302\020\3330"
+	.ascii	";\031f\320\324\276\237\342K\337\223<cj8\371\263\213~\242\345"
+	.ascii	"&\254AJ\264\034\032\211+\331\260'Y\304gwot\"\277\004\322\217"
+	.ascii	"@\203\314\204+\273\371\021\370\305\331K\360\231\351\260\261\033"
+	.ascii	"\206|\272\244\253\301Z\242_{\261S6\214\235\262\306\007\372\""
+	.ascii	"\325\253Ty\243&'\026\237\034"
+	.string	"\017nQU'S\315\207\230\203\303x\021\225\304n\335\005\330\355.\002\237\305[<\360\177>\275\342\305\333x\333\347\365\265\037C\007\0212\361)j\217U^\256\362\330\\4\212\213\356\270h\216\213\336.\364O.Zr\321\312EG.\372\251\230S@\303n\205\247\034\2533\227<<.\326\353\203\251$`Q\340\362^+\026\003\227\367\271`\253\017\226J+Ez5\362\245\274PRV,.\037\212\312k\251XZ(+\252\225\353S\215\034\260\007\201\345R\275<\317\245J\331\216\227\253<~\355\036\261S\224N\260\215R\233\310h\314\252\332c[\032\255n0\247R;\345P7\323\266)\247\004`\324\354\210\255.#\306\213\345\377\270l\237[7 \200\2429V\266\001t\260\222\303\004\334\314a\037\247j\033\355\276\330[|d\0345'X\250\345\200\032\035~vM\364\206\031\303\355\377b\023\244\306@\032h\035\202\263\204\371"
+	.string	"\232\037\027\321j\341\336\025\031\372gy\260\234\244\b{\243r\213T\322\360q\236\260\344"
+	.ascii	"\242\303ma 8\003\247W\307zo\310lMa\336\na\351\204\245\221\263"
+	.ascii	"\307\373\356\277\221[\270p\003D\235Br\351\265a\f"
+	.text
+	.section	.gnu.lto_afatfs_freeFileCreated.part.0.149.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\005\001e\f"
+	.string	"vVQD \213*\035\247\200\320\240\024\310\211\004\240p\352\252/J[\362L.\004\t4N\257(``\306\327\364\026k1V\025\rl\024\217-\006\366"
+	.string	"\200\001H\fz=p\f\204\025\024\301\0333\220\0134\310&{\247\024;"
+	.string	"<"
+	.string	"@"
+	.string	"\337\353\025\330>\331\266\227\005ve\322\266e\220,\n\223\201C\211\354\266\273\340+%p\362tv\244\377\330%T,\324\351\004+\345\323\342]\004\310\356\272\002\340\256\267\215\261\375a\377$\013v\367\262G\260I\177`\017.\300\356\222\354\257t\237\301\311\217\371\203\235^\2324P\0028^=\247\375\006w@\2764\275b\327\345a\266[v\274\032Syuy\f\357\265\362\013\3575\242\205\266\273\036>\205W\020\361\r\274z\034\315\253F\336\253\250\026\342\366!5s\223\276L\273wK]vW5\230XZ\273(9\334\016\250\030\016\034\366\333\367!|\202\375\271t\t\246"
+	.string	"\261\201\326\n\033O\310\351\254\271\214\034Q\206\243\001\225\306\f(\206 (\314|@Mh\004/\033\026C6!P$\212!\360\263=O]\376\020\260:\244\350\210)\245\257w<;\374\254s\341\253Z.\301/z\366\347\026\002\035"
+	.string	"q1E\3478<\364\202\315H\233p`\273PI\235\252\362\310\020\022 \n\206\271\302\205\306\212\335\0220f\364\225#\260\333E#\025\326\365)\005\342\276g\224\242\316\005\246;\r"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_afatfs_getFATPositionForCluster.part.0.151.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`0\002\035\021"
+	.string	"\026\037mG"
+	.string	"\261&\035\013\024\360t\006\240\356\331\251g\336\331\253:\276\334Vms\004w\334\260\341"
+	.string	"\271D\302\224\374\332\030V\342f\221\2400\351\243\223HL\325\353.\314S]`'\030\370p\"\004\272\307\277\345h\226l\"wJ\001U"
+	.string	"Z"
+	.string	"V"
+	.string	"g\221z\214h\217\335\021:1v\307\004\237\026\001}\202\234\200\366\231]\244}\332Wa\033e\353|\204Y\025\247l\235\217\223U)\260\311\201\342\302\261\273\333\247\226x\352*\263\224\177\330=X-\325\025@\353\303\345\200g\037\006\273k\020\210{\336\266\210m\320\226\034\002\377\315\245}\337\006\347&\333\227\003\034V\n\377\305i|\030\016\331~ML4\310*&~W\366)06:l\354\216\b>]\001\004\223>\fe\207B\257\231\031\032\t*\357B\215\273\242-.\223\272\213\323\207\200]\311\264,"
+	.ascii	"}z\004I\371\021\365\0301\033\267\245b)\355\257\b,5PXT\375\031"
+	.ascii	"\032D\377\204\177\322>5\306\272Qr\313\320\244\252~v"
+	.string	":\3540\221=\376\310\253\r\222\310\263\244\036\347\"\032/-9+UIu\261f\331\356\256\225\204\375\327\257e\322\363\256?\313\2445\223\226\037\377\207\244\t\003<\273\036zxV\304\274A\361\232\237\027r\335\b\205\006\020\276n\002\330\225\276\320\324\235\276\320\364@\264\241\263`\212\360y!\327\215\204#R\200\257\013A\222\013\334\307\\\bH\nG$\316t\002G\233W\332L\245\021\206\215\373\300-\344\200\275\f\335\267\205\236\367m\362\376S^B\344\224\250\211U\325\305\366\374t\307=\027\265\353\324\002'\0012 \220\002!3\272\001\347\320\013\225Ak\244n\220\315\241H0\265\302l<\373`\350\320:O\315\030\027d\320\220\207\221\300\237\321J\207k\tY\374\002\246\304J\305_\3525\360\no\001B#\316\376\356\2401\030a\240a\007f&\376k\260H\344\202v7\267\323\\\t\337\210\312\367\026\032\222\334Y\033\254\260"
+	.ascii	"\320^\200\234\372\364k\337\030"
+	.text
+	.section	.gnu.lto_afatfs_fileGetNextCluster.part.0.160.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\t\002\215\021"
+	.string	"6\337nG\360\320&\035x&o\267\350\363ekv\224\200h|\245\230\325\257H1\314\375\311\006\243\2209>\327\004\2201\250KMK\3403\2105T\022\351\221`\265\265\206\346\335\324\3772\\\231\256\003._\275\237\236z \262\345N)Y"
+	.string	"`"
+	.string	"U"
+	.ascii	"\363cQH\240\340\331\035C\236y$\364\314\276\n\226[s\224a\001a"
+	.ascii	"\333O\361\227\211[\016RN\\"
+	.string	"J?:\034j\202vG\355Y\351\006:\236\315\027\350x\246%\336\272\312\331\362\245\n\213\353\372\330\037\244\354\320Pa\tqI\372\364 \331]\207\\\356\354\266\023\330N\331rB\266i$|O\311\307]\031P\343\203\214W\320\366\235\273\360ytrV.\241\330\370:9\253o\313\276\203\314\317\f \t\341}\033\226\037\363\350\006\246*\271\b\354\302\300@\2369\203\251D@\b\231\330#O\371\032\326\270-\223\305iL\336\002\303\201\217E\241\261\301`\fY\345G\326\270!V\371\025\253R\257 \267\273\n\362*\252\217]\276lP\227\324\030\353\374\\\205\261E\322S$\255\257\371\345\307\377\036rF\301kw%\007\216}\311zL|\347\367\371o\256\366}\234\307\260G\016\377\302\207a\232\271qbw}l\032a\275\247\244\344\032w\205\224\202\003\364\n\n\311\336\327\211\035\005\357\333D\"x\022#p\251\256\001\307\201\250"
+	.string	"\\\252C\315\f\2347\00291T\245\026\210\036\007\202\252M\2007\221\020%\236P\233\267\nO\332\327i^w\262\240m`\250\211 \360w\201\0035\361\373@md[~\256\302\370\261\223\244\352T\017j\222\023\325\240\032\003[\035a"
+	.string	"22 p\"R\224\266\001\036\322he\345\232\304\307\207\002\223\206u\013.\2423\314\021\016\3417\304L9P\222/\211\024\027f\023\006]\354-#u\214\205w\006"
+	.ascii	"l\244\307\001+^\332\270K\030\364\365u\313\020\247\004e\037\325"
+	.ascii	"\006_a(\341\021\304Wh\217\245\326m\004\302K\314@\bw\353\233Z"
+	.ascii	"X>\332\315\233\263\312q\356(\354\265\321\020\322\033}\002\306"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_afatfs_FATIsEndOfChainMarker.part.0.166.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\035\013"
+	.string	"V\327O? \215&\351\007\204\b$"
+	.string	"al \326,\027\017\302a^"
+	.string	"\245$\214\226>-\031\327a\264\377\377\323\220mg\026+\274\371\017H\024D\"M \007l\335!\314z\222Kn\210\327\237\220\275e\nA"
+	.string	"<"
+	.string	"8"
+	.string	"\345\260F\006\264\250W\206\022\223\177\215Lh\321\200\221Q\211\003#NH>\234\310\274\2506\304PQ\361\230\350\036\2514*\326\324\005#'&H\245\t\275\213\262\212\215\314\374B\241\267\376\t~\005_\004\001\032\nX\310,9\241\310\013M\304\206\277_\023\3501\037zL\333\217\327\013\324\225\017\273\262d2\336\267C=\204\272\362\331\"\023\205D\210\314\313@\333\231K\033F\005X\332X\003X\332>3\020\211(_\016\361!XW\022C\214\b8\372\020\261\246Z\220\244\b\271\323x:\365c)\036VT\020\271\323\241\312\310\31223\307\224\377n\337\254\335\310\356\353\325\366r\001\025\247\201\007\b\203\212\343\261@\034l"
+	.string	"\274\311\2608<\032\216\315\307\307\322P\235\016\352\243C\343Am*\213\312 p\347\001\247\242<\235NEa\376+KL\271\246^\034\303\206\022\376\206o\204\240\310\210\250\362\001\f"
+	.ascii	"tY\251h\003^.\214\r\310\003#\212K\230\234'u\247m\352\264\004"
+	.ascii	"\251\2014\217\276\266\340\001"
+	.text
+	.section	.gnu.lto_afatfs_isEndOfAllocatedFile.part.0.167.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\f"
+	.string	"FYUA\020\217&\351\300\030\005P\001\b\205\351\342p\201\337\216\215\021\256\344\031| h\340\213\352\374z\261\210-\377\273>\332\375\033\275\340`\373\252\256"
+	.string	""
+	.string	"J\332\252sW\257\f\200\001\365\023\334\333h\204l\"SE"
+	.string	"@"
+	.string	"@"
+	.string	"\025@\365}G\314\201\371\034j\346\241\304\344\237\003\003:\2441A\344\305\001\030\032HVZ23\253\017;4Tl.t\333\350D\244XS\027\270@\221btr\241-\243\016@Gf^a\350\257\277\202?\3017B;\327F\327n\315\332V-\245@Jf\311)Fnx+B\374\375\232>\177y\320_\306\326\354S\025\217F\226\026L\306\366%\321\022\250*\236\006\310$\265\250\310\314\f\364\215\251\372\316:\200\352\253\002\305(D\207\217\005\005\021\"NO\230(\013\203\217\253u\324w/\252\017\021\363\017\272\202U\231\211\340\226\220"
+	.string	"\341\202\350\273\036\252\257aMm\206\017\245\221vj\2102\272\272\314\314\221\364\267\251\333\317\265\036\r8\033\267f\003\333\204d6\032\020\017\226\261.\216\005\302\311|X\232\016fm\020\370r\340\321\261B\256\253c]\352\022I\327\324\214\366\220\302\n?\205w\214\240hDD\371\035K\"\207\0356|\350Z\220\224D\355\264\313\022"
+	.ascii	"u\331kZ\214\0347\f\200\314hp\035T${j\254/5\036 \n\206\025\256"
+	.ascii	"\210H\b\235\363\316\3564H\235\366!5\205\346\245\327\2261"
+	.text
+	.section	.gnu.lto_afatfs_fseekInternal.part.0.172.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`&\002-\022"
+	.string	"\306 uH"
+	.string	"\317&\035\300\337\353,\217\300jS\r\325\274\326\302\324\037\341\372\366\365\006.\006\016\263l\341B\236\276\020L>n\243\257\210\345/\242Pv\215\206\355o\257\b\374\203lh\237\250\220\001\374h\252\241\325\245pH#d\313\235R`"
+	.string	"a"
+	.string	"_"
+	.ascii	"90\307(i3\302\330\366q.Cq\214\201\004\225\030\002c\207\t\263"
+	.ascii	"\242ZI\357\333\351\002\270o\364\032\334\267\345\360\3307\272"
+	.ascii	"\223\213\371)\337N\373\007\213\213\211\226\361\302\351l\031c"
+	.ascii	"\276TC\346\207(\300(R\004D7\031N\373t\031W\3464\235\033y\324"
+	.ascii	"Z\335a\270G\267\375\300v\003{\202\004\365$>\302\257\005\001\215"
+	.ascii	"L\024\320H\251\256\250\037sF\037\027\037]\217M\n\357\367\300"
+	.ascii	"|\232I>/KN\031\265\316\224\250o\336\346\313\022Z\252\342\006"
+	.ascii	"\017\013:\024\233d:?\3431\241<&,:v^\007FV\0130\336i?\304I\224"
+	.ascii	"\2138\031P\252\342\016\205Z\255d\202oNu\337Lv\366\0032B\2735"
+	.ascii	"\266M\270\357i/\3003\303\331i!\316\027sk\274\334i]\032;cz\257"
+	.ascii	"\363\317\317\376\217f\251@V\353K\f\030U\3036\004\342A/a\216\024"
+	.ascii	"\314\340)\205\264y1\261\264\324dEU$Q\034\251\320\340I\233\227"
+	.ascii	"\321J\205\232\354>_\373\376\317\207l\222\303\013\271\243DQTk"
+	.ascii	"\253\327\367r \002\216^\253\220\305\0029\020\325\007\301\345"
+	.ascii	"\372T\335\312\325bQ\2536B\326\353c\251BN\302\317\003[^H\353\213"
+	.ascii	"\340\251HBo\303\200A\221\025\211\367\002A\022\217d{~i|\332M\364"
+	.ascii	"\217q\273.\266w\355\241\262+\333\001\232\017'\312\2723\024\300"
+	.ascii	"\234\353\257\337b&\205\nqS\274\237D7\0011 \220\"\"\263s\261\246"
+	.ascii	"\270\035\230I\344.\017\0233\344\262\033\026D^F\370\305 \201\342"
+	.ascii	")\032P\007u\234\344\270\266\220,\264\330K%\317\324t\002n\210"
+	.ascii	"\232$\177\342\255M[\367A\320\372p\177\314\231,\224\034\362\311"
+	.ascii	"Gx\017\342\0374\031\331\214j\\\201n.\350\356\346\214d\263g\273"
+	.ascii	"\037\204\334\216\023\327B\200\032\366\233h>\356]f\f"
+	.text
+	.section	.gnu.lto_afatfs_flush.part.0.211.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\351\004\345\036"
+	.string	"\206\370\305J\220\330Q:@\311MU\330x\200\270\275sS_\351\366#?\214\374 8\321d\362\350\266\325\333\370`>~\324<?e\327\262f\311\201\267\315\200k8#\322)\022\2605Y\013}Y\001\236D\200DB\213\264\226\020B\266\334I\006\262"
+	.string	"\250"
+	.string	"\263"
+	.ascii	"|s\236Dp\003\345I\373\232\362\344\371N?\314(3\0203z\362B\216"
+	.ascii	"p\363c\024\341\006\210\203\036\025,* ,\342I\211\2717\212v\262"
+	.ascii	"w\260\3546\352|\326\240\243\262\330i\226\244\355\232\006\361"
+	.ascii	"U\034\225mU\311:2f\351(\3512;\003\273\n\273\226Q\222\035P\344"
+	.ascii	"\203\350\306'\020bD\243\306,\311\005\205x-\243\031\266\202\f"
+	.ascii	"\246\"\273z^\307\021\322\315J\344\223\361\222\206\\\201\372X"
+	.ascii	"T\213\372x\026\301\275\227\3067T\333:\370e\301\240\361\361\254"
+	.ascii	"\001-8\274^\365\332\363\t\325Z\221\236\232\031\356\275\374\235"
+	.ascii	"\322\031\300\231\331\213\231A0[\030\001\024pw\222s\200\353\336"
+	.ascii	";\241\311\255t\370L'9g\242\236\310Dy\262\366\253ns\303\313\314"
+	.ascii	"\317\351iW\217\334\357+#[S\265\201\334\351LJ\211\bw\016\346\024"
+	.ascii	"\345\312\262\330i~\352\\\226\225\311\027\317\226\254\334\266"
+	.ascii	"r=\325\371\002\254\260\030\340wo\321\321\314\265A>\371\361\251"
+	.ascii	"\277\370S\275\231\317/\236\212_\305(\361\347R\177\342O\335\310"
+	.ascii	"\250\222\237$?R|\342\022\306\262\267\250A\370\003r\357\375p'"
+	.ascii	"~\222+at\350\343\"(L\002\2737j\303y\222\241\036\005t$\214\365"
+	.ascii	"{t\337\002\214P\t\354\336ks2\345\333\f\342Uf\330\305\336{\357"
+	.ascii	"\331@&\016\361Q\276\231\264\315mm\247\335{\325\257"
+	.string	"\2037\344\2514\233\311\262\271\313f[\313F\273\307\374\340\357\263\t\f\251\204a\361\0232\267|0pi\341\\\320\2223\013f1\373H5\260\306\334\354va\312\006r\331d\3273\303\254\020\277\342s&\\Vp^\025\314\312\261\020\254B\366\231tIP\272b$g\267M\372\276p\f\273\372le$D\311\236(\273\323\260a\227\332\247\234\370\227\024\234s\211\222s)X\335\377\342\361\237\215-D\272\201l\177+k\177i\3305T\3110\263\355On\020\202\314\234\342W8\f\002\270\337tp\035\b\240\270\211\330\331\240\313\365\330n\034zxn8\022\272\332\255\206m3\236\021=\265\021\266\035\037\236\032-\207\243\355\340j:4\233\216\2076[\300\271\0227\035\255'\227\323\321\320w\216\030\223PH\264\222\361\203\312;\375\364\022B\021\255b\177P)\353^s\206]\013\241uJX\230\242_\361\366\022\327\324X3{"
+	.string	"QO\3047~"
+	.string	"W\330\227,C\255\202\373i\021\"PfO\333\261\356\331<\3267^\001\222/\250!\226X\003\231\354\221\332\034\310k\362b\236\375\027\304\246&\351\354l\315\264m\367n\374c\360\232\236\322"
+	.ascii	"\307\343\361\370\006%[\023\355\262{\214\025[\250qD\202\024S\250"
+	.ascii	"J$LP\224\2649\200\002\231*\244\007\021pAd\301\024\203f9\234\021"
+	.ascii	"\252\317\207\036\027; =\256\260\254\326Z \342\032\230\332\370"
+	.ascii	"p\033q\n]\366`4\251\342i\244\314\202\370\335\362\252\f\036\214"
+	.ascii	"\2224\317\337}>VfZ\302\2457\2052j\201p\036\236M\025\004\233\r"
+	.ascii	"$\002\240\344=\2253z\344I\317I3*\331\357NY\273\027\026\036\233"
+	.ascii	"i\204\004-\232\270X\364\005\3272\3040\340\324f\223\201\216\n"
+	.ascii	"\304\221\335\256?Wo\247\346>{\350\367\225\362\312\242\245\322"
+	.ascii	"\b\230\001P\234\254\221.\266\257Fx\f\216\bK\004\002\213\"4!\223"
+	.ascii	"\311Q\262\352\203\035\251n\217\037\3037\005"
+	.text
+	.section	.gnu.lto_afatfs_ftruncate.part.0.218.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\357\0035\031"
+	.string	"\206l\235G\260XUc\300G\361\361\334\230M#\255\300\376\2449z\370u\375$o-D;\020\331\026\321#O4?\273\257\364\350\352\270*\247\264wI>\300\367\302\360a\271\300rV\275\360\301\361\302\313\344\252\353R{o\271\245L)\202"
+	.string	"\205"
+	.string	"\212"
+	.ascii	",\036Tz\223\350\276\031\216ya\274p\245\366\177\274Wt\337\354"
+	.ascii	"\001\356=:\302t\257\311\340\326;\345\255\315\337\214\267\345"
+	.ascii	"\007\214\267\366\225\254\263C\364\302\266uv\212L\273\231dt\243"
+	.ascii	"\363\261\"\310\360^Su[s\234\366\321\212\225\2224\277\366\221"
+	.ascii	"\344\021{\234cpT!\222\223qKq\271\030\027\001\344b\274\322\344"
+	.ascii	"n\342\201{\357\201\247-r6J\005\234$y\356\275.g\334\345m\373\330"
+	.ascii	"\266`\2139\001\007^\201\220\314\r\033<a\nZ\206V$W\362\342\255"
+	.ascii	"G\266\251I\222z,\251mI-\222\324\365\277\237\336\374\177cuajl"
+	.ascii	"\334kTF\314\275a\223\360\370\322\215\034\250\231IF\327\021\006"
+	.ascii	"\310\033\336\233\231\212\2216\027L<\237\310\213\330(\307>\304"
+	.ascii	":'\224\341\275\027\025\273\037\204\310\007\032e\373KB\204hJ\210"
+	.ascii	"\220\315\225r\237\013\352\224\270\334k\246n-\241,\262Q\026\351"
+	.ascii	"\177@\206D C8"
+	.string	"6\367\366\013\364\270\f\343\355X\317;\203O\275\323{o\255V$\333\006F[\017|)\345\207\345F\301\270\274\201Q\254\266\232\256\240a\323\360(\033\304\n\341\324\362\324\343p(5:\304|\3019\325jw\270\223U}\202s\362\2077Y\225\265\036\306\331\364\324\363E\2146\2103\021\341\341l\332\ti\265Y_2Ds%(Z\r.4\336\2068\251<\325\020Ob\264]GB\242@\222\375:\223\317\214\225{\257\203\023E\t\177\307\255?\033o\003.\031K\266\001\bF\372\264X#~~X\255\322\365\363\352\021\335\312\211\365\310X=-\023\263\030K\005{\251L\274X%T\255\240\230*'\201a@\256 \225\f\006\013R\241.\336z\344\240\016\314\322i\177\332H\326\026\266\311j\236\024\3256\"\240>MiL\375\325\246\375\240\371\350q^\340\353\022EE\255E\270\323\227\235\204s\3612\024^\313\267\254f\254"
+	.ascii	"\235^v\266\"\255\306,'N\341N(\216\325\236\360++\002\301*+\025"
+	.ascii	"\2057UH0\345T.`\310\020N\250A D\035D\204H\206\242Q\2306cp\242"
+	.ascii	"\231;\262\003\021`\255DF$\005\215\213\001u\370\262\244\027\021"
+	.ascii	"\266`\b\223\306\004\347\341\036\227\345[\312|}3\361\337\205\266"
+	.ascii	"\321\017\233\342P\232\325\370o\177\274'\235HU,LCG\204\314\303"
+	.ascii	"\364\256=D\320\222/\227\214\350\264\350%P5\216\223\335\271\032"
+	.ascii	"\0048\232\300\023yE$\363\244\277\374\024\256\366M]\213m\t\313"
+	.ascii	"\026\032\261\026R\231Nv7\276]D\335\033-\363S\373\2264\335\346"
+	.ascii	"\201\346\342\327\224\021\003\271\030\311D'\232i\321*\244\275"
+	.ascii	"b^XE\251r\025\307}o\347u\312\017"
+	.text
+	.section	.gnu.lto_afatfs_fileOperationContinue.part.0.229.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\325\n"
+	.string	"VSE90\257\322\001,\231\\o\307\301N\3728\251u\020J\205cUT\254\005\361\016Nn_\t\306\006n~\203\374\034:<\006\006H\bzO\254\207\204\005\211\3119\323\243\275\367N)3"
+	.string	"2"
+	.string	"5"
+	.string	"-\203\366m\263\332\260c\223Y\230\344v\327;\225\036\007/\343\004\375\310r\205\227\257\275a\006\302\302re<\016|\002xv\327\235\306Mo\233\301\366\202\375\207*[\243q\214\257\252\323R\233\272\030-\307h\177\344$\340i\251\013\354\302r(\273U\341\324\235\356\324\365\006\231\323\356\004\231S\373\"\266U\366\355U\266\001\277\264'P\361,\277\345\203ce%\303\222\356\265\b\247\257\335A\345\225\303\205\021&\312\230\345\234+a\366\353\377Im.\001\035\273\0271/\373\242)!\266o\277\026!\210\221h\032\3041\211N\037\021\210\2042}\274o\344\221F\237\b\017T2y\234\003\177\022\241\222w\372\276\222\247\371\\\t\263\207BV\234\324X\260\033\266\031n\253\2241\3334&\004\033"
+	.ascii	"u\331[[\f\270\025\030w\n,\006\234\250\202O\212\006\320\002\334"
+	.ascii	"\r>\243YQ\023\341\370p\325\f[\340)@\346\352V\232-\202\206\b$"
+	.ascii	"\204\316y\207\201\301N\013\300\265\207\024\026\232-=\241\214"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_afatfs_chdir.part.0.233.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\206\005\315 "
+	.string	"v7\311G\200ZRc\275\324\326\233\206\205\304D|\266\301\316E:\322}\344\314\266P\241\274\304\371\226\332\314\244WOl\335<r\200\334\377\207!\212P\276]\261\017s\331\372\256\027\315-\312\023\204\275\244\221sO\324\332\275\267\224)\005\263"
+	.string	"\255"
+	.string	"\270"
+	.string	"J\367B\372\200u\255\022\033[W\344\204\243\346\321\0355\3627\351Q\335\013\244G\355sy\207'Ih\333;<JV\217,>\335p\235\201\221\204[Wd\357\350\365q\365<\232\235.\227\242\347\2655\252o\203\303\245\363\226\313\2655\032\234\335\247\240r\\w\352\020\323j\\M\210\343\274\261B\305\345_\307\031\"\214\2629\035O/,\225Pa\021\033\3368J\263\245\215i$3\005\245\343\347y\363t\025\f0tq\352\270\221\211\341\r\233\354=S*2\037\001\2060N\013iWP\376u+c\310d-\201\327\3440\254\353\352\003\245n"
+	.ascii	"\267\215\304\366\005\033e\021RXT=\036\346\240\223\235X\320\026"
+	.ascii	"f\241\217\2410P\\\327\265\002\223\026C>\220\243\366>\354\020"
+	.ascii	"\262\224B\210\307.\240m\372\376*Q{S\336ke\033)\375\215\302\242"
+	.ascii	"Z\n\263\246\245\311\306\331k\345[\363\333l6\233\276U\266\255"
+	.ascii	"Q\235\365\231\263\276\251\265=\362\277\001\364\350eC\\\327\247"
+	.ascii	"\246\231\225\007\332\004\313\302'q\260\204,>\375\007\0257#\334"
+	.ascii	"\332\204\224p\224c\2321f\024;\342\241|\330\221\031\263\310\221"
+	.ascii	"\217\344\311\025\007\363\265\301t#\032\327u]q\375\257$\233g+"
+	.ascii	"\331<_{d\322\275\220\022 W(\241\257\265\177|WN_"
+	.string	"\310t\317\220\336\373\003\313b\253^\367\222A\327\345^\020\313\262\255\236\324\326p-=9\305,>\233\266\266\177=\002\033\023\216h\374\332\237\364\206_a\2730\312\033\234\372\016\351\223\346p\265\0165~\225[\031\362\231\020\003\335\331@+\022\215L\005\366P.\341\007\373\322\247A\333\024\337\216--\351\341\303\223\2479\233\262\263#x$'\266\344\252,}\\\234\326\001\353'\267\224\364\367`\177\342\003|\320\016q4\037\2026\263\237\211\360\b\022\366A\022\351\017\220}\3205hN\204d\334^\334%\337?*\253J\n\275VQ\342v<\021\303\326;\345{\253\225E\006\344<\221\332H?\"#\240\240\237P\211\235\201(\024\2310\3721\001\224\002\251\350\247G$\324K!\3643\324\003\372\025\365(<0\221\212\240_\317\210\210\350\327\343\235\353\255\362\2179\224\312\364W\323\177\035=:)\225\247\257\246\350\225a\033\275\306"
+	.ascii	"\274L\276?\327u]yet\254\257\006Im"
+	.string	"\320\007A\321:\371\030\330\030*\226\232%\0267\246\212\200\367\020\261M=9\226\311gc\201B\226hG\230\347\265U-\273\252[9\305\246\317\346\f\372\026\004\003\264M#7\243n\2259\357\323\226gd\272\200\266Is\341\306\2101\303\241\021\205ew\255\324cj\253\\\017\243\036\037\200\361\335|)\262,\203c\016\by\250\2018\244\034D332\222\202\222$\007\240\")*\343\006\020`73\222$\351\365O\213\266\004\312b\205\016mF-3\343P!\016\306\207\223(\315\242m\026\373\246j\020:_g\\\370\177\253\274E\026h+\322\233\255\013{FF)fX7\361\2556\222\256\371\371\031\2628|\016\262D\312\342\220P-\217\331<BV\366E\003\273,L@u\023=VP \032\377\210be\360\360\020\2036OZ\225nc\336x%\016\007\207\214\256\2307\314n\006\204\262\r\252\207N>\206lc\264"
+	.ascii	"|fNI\353{\001f\n\251\235)\320\361} \336\207\232\246\333\ff\360"
+	.ascii	"o\271\027\267\323c.\375\300\355\3071Pcb\025\200\273#\303\177"
+	.ascii	"\201qt\023\350\222\333P#}%\203\264\324\212[*\367m\207\324!\274"
+	.ascii	"\224>\212\3737\202\221\354\274\227\206\231-T\031|i"
+	.text
+	.section	.gnu.lto_CSWTCH.152.237.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\205\005"
+	.string	"\362H\036,pk2\214\001\374\377\t\220H\377\377\377\377\377\377\377J\352\377\377\207>\230\376\377\377\271\252:M\241\265\265\265\265\265\2655K\333,I;\352A\204\233p\025\356\302e\330\320\341>\\\210\033q%\356\304\245\270\025\327\342^\\\214\233q5\356\306\345\270\035\327\343G\020\201(\204\300\240 @MQD\262\244\t\245b\271`2\232\r\247\363\364\001\205\024\300\001\351\362\234\244KU\352\n\032"
+	.ascii	"\001KI\203\001h\007\204\201\023\320\016\b\003'\240\035\020\006"
+	.ascii	"N@; \f\234\200v@\330\313\th\267\246\314Q\001\340.\245\261\232"
+	.ascii	"\"\340\356KK\030(\002"
+	.text
+	.section	.gnu.lto_afatfs_fwrite.part.0.239.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\213\007\215,"
+	.string	"\352Ox\021F`^N:\373\307\204\366N\343\206Z\f[\367_\313\361\311\"\234\3212\213\270\275\207\373e\377z\241\001Q2\307~\246\363=\375\345\0076\260\370\002\007:\315\224\202\321_\021\233\231\300\315\361F=\335\255I#\204\310\235d\002\001\374"
+	.string	"\001\001\027\234`b\037\326\247i\\X6\232b.\354\333\254\3664\356\234aq\332\226\251\340)_Xc0\003\237\336\243=1\333%\337\237\261\350O;%\244\213\002zoV\366\002-{\221'B\337cy\372\025\247"
+	.string	"\3146\013\213\3732\337\312\2311~\305\351@m;\304\255\331\266\314\005O\331\301\372\224\231+\363\251<1\2132\277\226X\237\362\261\030\314j\230\021\265L\340\324J\232\331\265-\023\351\251\321\211\324\247\350\205\324\247]\204\177\227=\360\347[{j\212\366\r\262\374\253\\B\035(\\N5\177\253\226R\367\327\233@$\213\353>\002A\262\266\276.\301\332\212;\0014XZ\267\207\032\241\301\332B\215\332\266\005.\223W\245z\363\004\226`\361\270)\217\243\250\0040:\256\016\367{c9\003\275`sr\200\313\251\333o\036\003\2352\316\330]\220,\256\337\240\007{\023\332\266\345G\3658\367\234\231\345\230\231\213\271w\003\017v\210\371\342\036\302|\264?\300\315~"
+	.ascii	"\277\313EDC\277\313B\277\313A\302\313@\302\313?=\227}\204O3;"
+	.ascii	"\007{\227\201\301\313?\340e\337\335\316\353\357r\357hg\365\317"
+	.ascii	"s\212~\355\334\277\313\367X\376\027H\235y|\272\332\366*\017O"
+	.ascii	"\373#\365\242\344k\177\332?\346w\373\237\277\232\273\341\257"
+	.ascii	")\246\002\346&.\236\371u\325\223\272\321\034\273\231\257\314"
+	.ascii	"\347\313\255\371\334\223\r\033\326h*\255\251\265>U\223&M\033"
+	.ascii	"\225udCi\367\034a\330\036w<\031\376\231\016s\026\3265v3\314\300"
+	.ascii	"\301\323\313\024\215\240\230\355\225\252V\2039f\347\273\314\f"
+	.ascii	"\034\034_\246xf{\345#g\3456fW\265\206\271\223/\346pc\336\336"
+	.ascii	"\224 \335\332\\\3346\027?-\232\366K#N()\326-\314\300#\363\275"
+	.ascii	"\374\0133\220\233\356d\006\3175(M\315\337\362\304W{\223\201k"
+	.ascii	"]\272\260h\213\026\020\236x\317c\2510k\205\302\275\222\202\372"
+	.ascii	"T\250_f\244J\224\205\343a\203Z\306\263\356\356i\352\3408\322"
+	.ascii	"\033\240\002\255s\310\332\254\037\240\3764P\363\275p\273\f?\235"
+	.ascii	"\0229\373\352\242R%J\313\223\b\233\272A\365i\243\200\313\347"
+	.ascii	"\240\366\272\203\207{\245O\013\337x4\357\342\364t\257\205\rT"
+	.ascii	"\263j\243\352*\272\276\0166\260\231E\214\270Wr\203\037T\r\305"
+	.ascii	"\277^\033\330MG\325\344\327O\342\365\332\327*\022\253\263$^\324"
+	.ascii	"\030\256,u\351\r\250\211\242D\333\213\371.\324\265;\213\031\034"
+	.ascii	"\262\271\251{\207\205\356\233\231D\211{\345\332\207\273\020Y"
+	.ascii	"\220\2723S\r\305j\247\335\353#5\252:h\243\355Y5\355\317}\245"
+	.ascii	"cC\231G%\326o: bv\335^\314\334yg\325\333\335\257KjI\335<f6\361"
+	.ascii	"7\354\332\266\355\003>\035\214$~\230\223\372\364\366\233O\227"
+	.ascii	"<\331\356\252D\335\274\333^\334\301I&\356\t\023\227\251HD\022"
+	.ascii	"Q0\025\225|G\242\212\020C$\3218\242\030\342DQ\205c\320XD*\rA"
+	.ascii	"0m@\016\217KK\035\214\305\243\261Ii\3508D:U`\032\"\221D\343\213"
+	.ascii	" \323pE\033\207KKM'\324\341\n\342\022\312JG\307%d\322\222\022"
+	.ascii	"\223\3231\t\251HDb\"&\261@R2\036\221\216\016p\261\305\320\210"
+	.ascii	"\204,\026\215H\300\367\020>\334\203Ra3\332\323E]\305\314E\315"
+	.ascii	"\023\242Z\352\b\260\275x\007\327V\022\237\260\303\222k\367J\275"
+	.ascii	"\307w\347\274K\256\371\256\324\337\374z\347\004K\256\335n\364"
+	.ascii	"7\336|\340\371\206\002\264\332U\207{\352\264K\236\371\210\232"
+	.ascii	"\321\013\240\203]\305\252\352\233\200]\221#\327\246\217\266m"
+	.ascii	"\333\376\210\372g\343\352\214\252\211\224\332C\250\224\247\035"
+	.ascii	"26Y\304\244\332|\b.?\216e\302:\351\206\342>\317\221R\203m\025"
+	.ascii	"\352\240~\334\257\226\025\023 t\344\340\230\331'\027\212}\331"
+	.ascii	"\027\263Qn\313N\t\200\225\250a8\305\2242\306\020\311\210\210"
+	.ascii	"4I\213\001p\002\031\262\262:\021\3201\2045)\355\035\307\265("
+	.ascii	"v\357N\361\251:x\f#\013#\224\340\264\352\375\002\207\227|\002"
+	.ascii	"\021{|?x1*\352\016\353\030Z\313\302\342\312C\342u\f\320\3358"
+	.ascii	"\020\002\271axa\032Z\016<+\n\361\224j\341\237\372\f\220\325\307"
+	.ascii	"\37742\177\317\224\341I\376V\225\314b\020\227\334$\272q\206w"
+	.ascii	"\311\026\376\362*K\236\220UU[F\200\212\220/\204\373\335\276X"
+	.ascii	"\007*\004\326\007I\242\201\344\247_\237\250\267\332:@Q\352\006"
+	.ascii	"y\033EB\211\354\240\260\241\3050\226E\331\264(\036\351\314\271"
+	.ascii	"\307\005\332\t@\310Hw\346\262\340\301D\005\344/1;\347\320\332"
+	.ascii	"Yh#g\303\254\t\224\201e;\370m\004\273\231\2327@\303\305!\024"
+	.ascii	"WZ\237\034 =t\2500 \024\240\025\272hT4\214d\026z~\3752\3575\354"
+	.ascii	"\347?\376\245\303\013\323f\200\246\217\354;\241\017M\347\345"
+	.ascii	"g\205\"\376\243H\250\320<\346}^\2575\261\311|\306?\021\227\004"
+	.ascii	"\"\234\323_}kDl\301i"
+	.text
+	.section	.gnu.lto_afatfs_fread.part.0.241.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`?\007E*"
+	.string	"\272K\244\020Gp\334Q:c\356\211\211R\314\226,E\373|\bm\231\013\330G\"rW\250"
+	.string	"J'\225$\353\001\2656\346e\251_(\246j-\037%\033\323BF\036xzou\370\240?\252\bC\362\"~\250j{\322\b!r'\031\364"
+	.string	"\357"
+	.string	"\363"
+	.string	"|D\305c\305\337\254{\030\3155K\234{\223\n\216\362\005\325\005\363\356\250\275\030T\362\"\331\036K\361\344]* W\025N\3730+N\247\025\2477\022\332\236\n\324\247<\005H\336,,n\313|)O\272\370\224\247\367\356\r\242\\\336\233dp\224!\250G9\2512\037\n\024\027\317\244\027\022\353O\016\346\202\213\032^H!\021\254[\3070<\367&}G\217^\224\036=?\224\036\355!\234\263\305\353r*.E\317\266\273\"\337V!\243\256K\303\322Z\276\2609\002B\262r\\\375\332\t\244a\341X\236"
+	.string	"\023,-\213\373\222\365LNzN\360b\343\n\by<\255\021\246\234\257\031-\272b\035\223\363#+\307O\235\214-4\260\346\217,\255\367\231\200\213\f\r $\325Y\204\006\210\233/o\255\220S\326\n}\207\243p\357\345Km\235}\316\314+3\307`N\275\004\177"
+	.string	"#\234e"
+	.string	"ED:\313CBW\236{\017;\363N\313A9\313@\252\345\237\243\235}p\226w\027;\353\316v\316\251';\343p\226\323\213\375\350\317\316'\316r\343,\333S\371?"
+	.string	"\375R\025\304u\357\325\233\236\333\003\355\222\344\312\237\354?\373\301\374j?\332\317\366\253y\033v"
+	.ascii	"\001\212\211GQI\257\253\264,G\0300<\227*\251\300\001\204&&>\351"
+	.ascii	"u\205\233\232\261\004\3131\237o\346i\370k\316d\033[\25213\353"
+	.ascii	"J\262,\203\346kjiidNhg\234\354\031'\336M\273G"
+	.string	"\022Y\313R\224a\336}9\027~\230\2179\023#\246xD\345\265<\001\306\314\254\310\223\352q{5|\254QL\250Z\230\337\345+\363\216\233\316\205\0350\275\340\271\367\356\232\232\257\005\212_\366%\357\224[\266\024\317+va\025S\"B=J6V\f\273\026j]\333\2167#\327\220\375\351\240\3465\363\b\022\366U\374\240\207\261\243\030\250}:\250\3176\343\027P\377\350\266\353\037\fHv\3009\272I\215\321\272b\007w\242\2756j+\346\005_v\310\b\031\331H\245\335\305wJ}\272\257lQ\253\302\344\3317\363\017h_\345\323_\373P\225!<\320\250:\212u\235\353]7\b3\322Q\373\274/\246\271>\363\352\2346\035k\272\315\207\222&\332]o/\246\266q\031\312t(\2178\320>;m\006eF:\266\273\317\376\230\253ldl\3351*\231\262o\334\217pCL\221\363\300\027\034\035b\267\177p_"
+	.string	"\235;d\272\273\270\3336R\2253T6\0173\007\037\247\273"
+	.string	"\223\371\304\337\024\325{o\004~[\013%\376\221\243\374\247\364\250\355/\177:a\226iF\221\262o\266\273\270w\035\244K\f.F\356 \314\017\013C!\0230\350\201\250\204\342\203\211_\260\203\360\003R\221\005\242\317\257\204E*a\211A\246'\013&~\301an(d\002\006=,m`\n\022\223\2228\f\205\304a\023\220h)\250\242\207\301\244\244&\2444\250B)\351d`\003b\022\323/\t\270\364D\374\371\204J\276%\245\337\n\037pH\36450\300B\026\301\241\217I(\034\372v\307\237\271^\343\204\232\317\324(\347c\345:*\373\315\003`"
+	.ascii	"\315\024\244z\352\250\353.\376\332s\315\325\355\250T\337\374"
+	.ascii	"\225V\023\256\023\327\352k\234=qS\205\232\253\330Qy\276\371\236"
+	.ascii	"Zg\325sT\252Dj\2325\312Qy\246\255k\253\257\035]\367\034\261\250"
+	.ascii	"E\315\347\031\240ymULu\377\232\203F\216\032\233\376y\357\275"
+	.ascii	"\271\237\346uQ\353d\360\200c\374\232\3225QK`\272M\255\271\222"
+	.ascii	"\205M\b\030\225C:\324C#\313\367\220\356\032D\b\373\252\241\006"
+	.ascii	":\223r\233qz\035\200\212\250Q<\304\2242\210\031\031\021\t\"I"
+	.ascii	"\242\016\200\002\221\252\262:\022\300vAo\r)()\237\373\035l\314"
+	.ascii	"J\241j\n\252\306I\275\034\016\363\222\235jw\255\372\262r\004"
+	.ascii	"\022G\026wF|\246N\343\017\032\252\037\226IS;x\326d \325\240K"
+	.ascii	"\245N\261\364hJ3\301\306AH\200\373(3#\270'\005\f\226\233\016"
+	.ascii	"\2470Z\372\225\311H\r\257\260\r\206\361\372w\240\361O-\235q\330"
+	.ascii	"\350\264\373\016e\330m3\236_:\210\213\356?\001T\260\327kD-M'"
+	.ascii	"\245\b7\370L\232@\322\366\211\351\316\317\b.\202\017O\274\236"
+	.ascii	"\336P\247\366%\365\315\335\333y\003.3\2618\004\3441\331\027\362"
+	.ascii	"\225\222\341\207\264`p\351q6\035ma\346\220\301\313H\027\037\370"
+	.ascii	"\036\210\247\334\"\017@Q4\242q\310\201H\006\377\222\276\267\347"
+	.ascii	"/`\341\367]\370\n\246G o\232\227d\227]?\360\243f\006\205\360"
+	.ascii	"\246\210\216Q\354\272j\303\316A\212\027XL \221k\315W\357a}\242"
+	.ascii	"0e9<\005"
+	.text
+	.section	.gnu.lto_afatfs_poll.part.0.243.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\355\002\245\023"
+	.string	"\006\"xH\340\360&\035\356\033J\177\303\004\303<\341\034?F 08\274\254\231Q0\360\037v\304X\265{\371\352\3466\302?\237\257\016\323U\313\315\301A\366\276\"V1N\017q\034\2517\037\002\300\203\364\203\247Bg\373d\223\275S\nc"
+	.string	"c"
+	.string	"a"
+	.string	"7\234\003\257Vpz\375\270G\367\312\275\243S\271\237\323\262=\357\3653\333\255\027\257\330/^\243Y\0026\233\f;2v\367{\245 \276\362\312\321\331\255\370\b\230\224^0\327\253"
+	.string	"&\035\3569o \202\206\322\013\346\341\324\245\245\363\250!C"
+	.ascii	"\200a\240\223\343\335\206\310\356\372\004"
+	.string	"so\3346\211\355\b6\375\b\266\240\001\261\335\r%\323\312\352\320\210\013\375??\320\251}\337\347B\276\n{=-\236\377\370@\017\262\267\323\322i\235\366\024\266\312GS\230\246[\fgw=\036\277\007\205In{\030\314b7\273\013\3414_\347;\366N\244|9\3545\320\314b\226vk#\247W\327^B\345&L~\270\324\026\266\361\301(\246\177\rYCD\351\214\217\344\273\240G\262\361\346F~\213y\261+\332\313\\\266\031\b\221w]\217\331'O4\373R@da\330|\226V\266 \td.\263\206m\223\263\020O\273\273\300_\361!\013\276\315\253W(\363/\224\356\365T\202\022\022\211\221e\226\223\316\230v\247eY\3160\225\261\271\351w5\341A\223\360\001\307\005\220\344dD%\262R\240\003\326\n\f)\250P`\207S!\253\022\026\252$u\222\262B}b\370\235\204(\223/\245Z}!\006,V"
+	.string	"U\037K\024U\237g{\236[*c\217\026sc\241->\371'\321:p\273\273\025,\217\376\244\261\211\0130\355p\302\374\313\363g\234qk\241.\277\350t\214qs\315\246A\250aX\203\220b\202\031\031\221YXR\330\006\220\002\031\303\332\006\021@\301bP\204()W\003\234$O\033?\321T|+:5\351=n\207p\220\007:^\362$D\224\247\227\007\347\271I\367a0!\241&C\242\351\211\370\332\033P\262C\366\202zK{v\2551f\266\032Sd\b\017<h\201y\355\t]\303\207\267\013\r\252\334\215,p\246\224#\272`\237~)\026\341\214]g\234\224\22161\226\273"
+	.ascii	"\002\350%0H^7\231\030\020z\213\361\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`U\021=E"
+	.ascii	"ju\324\031H`^R\007\363\240a\261\342\352\216K\036X+\220\277\034"
+	.ascii	"\264\331\3242\003\177\034\343\344\202\025N\306\b\344\036R\022"
+	.ascii	"\3126>\313\210\372_\244\r\357\020\023\361\351l\201\013\3419\034"
+	.ascii	"<\275\372\362\250\342\325`\0174Tm7SK)\207\001\202\001\235\001"
+	.ascii	"\315eJ\263\312\337\334p\335F\t3\215;s\2775s\307\273\366*.Fm\341"
+	.ascii	"Y\271\267P\311\355\346L\247\253&\237\222[\213\224\354\322\235"
+	.ascii	"+\343)\315\243\344\016\343X\271\345\3308\224\334qOr\2539\311"
+	.ascii	"\335\326$\367\032\223\334gKrG\225\344\206&\311\315\266\356\226"
+	.ascii	"u`Z\216$7\232\307Ui\233\341Gr\227]\345\0263\222;\254Hv/V\331"
+	.ascii	"\325\322xUn0\"\271h\327*\243\264X\2317A|H&Z6\031\214\261\025"
+	.ascii	".$\373\334\020\017\222\235\f\220\354\\\226\r\264t@q\252\354e"
+	.ascii	"?r\177\365\270\331\213\370\310\335\305B\245U\371T\356+=rs\361"
+	.ascii	"\310M\266\272\323\211\363\212\357\310=\246#\267W\216\334[8\262"
+	.ascii	"\013yj\001e\272Tnx\215\312l\017T\366 72\205\036f\366\251)_/\244"
+	.ascii	"n#\367\227\247\334Z5r;\275N\312H\324id\013t>#Op\312\375\\\235"
+	.ascii	"\354\t\220/.#\267\025\036\330\007\226\307"
+	.string	"\310\025\246\016#CX_d\245\246\354P\035r\203\351q\221\235\331\"\033\261\310\356\344=\300\224\261\342+rgYU\344\244\324\227\371\210){\213]wIaX\36163\230`5\326\226!\007\365x\212\354\313&\024\245\036E\2420\344\005\273\351t\252\306\225Yh\307S*\225\312\234\221v\337\355K\345\206\003jw\257\312\266Ubu\347n\261\031\376fR\350Z\024\371\301\256\273\203\032\002j\2027\016@\360\301\267\327\242\rw\336]\003\007\336[\337)\225\312\024\005\016|\257%\032xb\373#\2760\326q\203\304\366\252A\3255$\376\322\322\375\211F\227\260>\033~\361\351\355\325uFH\233\r\177\350\372.\352\345#\312W\005W\231\251\303\377\271U\352\360\327W\300\360\177\261\373\025h\254\202@\201'\016_!\201\017\306\336qK\244\242?\002?\002\316\033\256\202\255\032\026~\320\365\235\f\351\2143>a\316\033x\212"
+	.string	"\341\257\261\277/\310% \370A*o\370\005\327V\233\r\370^\354\033\360\036\013\030\360?\316S\232\tp)\2608$9:WM<\334\002\340\374\016\2357\334\364\254\f\310#\272\376\343\202\351U\201\357\261\027\235\236h~\300\357\265>\244\365\366\246\376~\311}\215\217i\227\357\367;\256\267\326S\224\230\352\373\340\353B-\330\026"
+	.string	"\337\377\340\034gJE\254\313\276IV\235\214\236\357\335\365\236\303\221\002\207\352\373\265\365"
+	.string	"LQ.j\357{\257\367\264\260\330\324\365\177\255\277\212:6\225\367\353\263\307\376\235\312}\310\2322bM\366\277\226\235I-\367\232\264\334j\320r\273\301\222{z\226]\tgOa\226\273MY\3567d\271\323\214\345\256\213fo\241\271\331\210\345\246\013\313\215\006,\267\324\225Jew\361+\367\031\277\222\333\214W\356\271\256\334e\270r\223\331\312=\306\215k\345\026\363\314\335\305J\0168\236"
+	.string	"\222|Q\224jj\322\257K\337\221\255q\243k\265\244\035\233V\224\256\327\222\230\242n\310\370 9\241X,q\220\376\331ei\006\211dD\212JB\245\243\323\216\336\341\032>:\332\321\004\305\350\350\177\255\221\203\037\306\376W\\L^\b\031\025\225Es\b\031\275\277C\r~E\026\375\217\252\323\212\376'T\364\356\006\021\375\372\3544\242\357\265tBD\017l\275\315Dq\001\253D\177\241\310 "
+	.ascii	"\026\027\220\037zo\027\b\375\005\243\320s\360]\334\022\251\261"
+	.ascii	"\005\274\235\330}\334\251\034j\320\017}AY\326\\\204\341\004\031"
+	.ascii	"\245~H\017\004\005\005\375\222\177\324\021\247\026\234\240\037"
+	.ascii	"\302~\300M\354\n\210\247\343\372\017\027\254&\237:\037\240\367"
+	.ascii	"\030M\002\240\317\211\235GI\226\021\025\3310\324\t\312\207\374"
+	.ascii	"\337\353Cr\\`*\262\345\242YS>H0(72*\362\2158\310]\033\332\334"
+	.ascii	"\362\370\363\"\340\020M\034\310\252J\232#\357\303\3538Bd\254"
+	.ascii	"Q\217\377\241\365\035\261\035R\343\361\227\\w81\262*\365\370"
+	.ascii	"\305\330\337k\007\025l<\376\016\225\360\351\r\375\222\226\246"
+	.ascii	"\003\347\377\006\346\355j\370\3709\307\317\3019\262\361Z\025"
+	.ascii	"\361\370\bbo,=\262\300>F\t\314\247\267\004\306\367\327\233\214"
+	.ascii	"\263M\216\307\247\307\347?0\035\211\346\315\263\310+\272<\305"
+	.ascii	"'\276\376k8\266\322\004\213/\306\007\0225\003\212/\374\305\302"
+	.ascii	"\342\257\356\2578F\267eJ\001\317{h4\236\367\200E\301\257q\024"
+	.ascii	"A\002\267z\271\320\002\035\244\362\277R\223\222\242\341\206\276"
+	.ascii	"N\353\375\354\302\\\033j\350\347\270\336g\306`\240\351\257\206"
+	.ascii	">\360\005\312\n\323A\241\241R)r0\205\206N\247\3237\355\354/\207"
+	.ascii	"R\341td\250\277\376\247\267\364\327\373\313\242\250\273\336_"
+	.ascii	"\242\346\372\234\226\250\267>\310|\362r\342\347/\3658j+\277\302"
+	.ascii	"\336i`qL\372\345\271\353\005\234\256\232\224\372}o\273\331\316"
+	.ascii	"\367\367\314B;\037\304/\026v\363\021\270\276\266i\177\250\357"
+	.ascii	"N7?\330&\273\371:\257R7\037\370\372\307]\231\035u\023\350\374"
+	.ascii	"Be\327\315\357\305Jn5rt7!\314\275u\371\272\231\264\360F\367\244"
+	.ascii	"\205\007\266\307\344\377^b\362\177-\201\344\367^\006\311\357"
+	.ascii	"\265\025\222\277\276\300\344\257-P\022\251\325\346\213M\276\273"
+	.ascii	"\024*\024+\364\232\0254\013H\301\235`\341\321\306\301\204_r "
+	.ascii	"\301(\302\353\260J\237\363\203k7\245\367\247\026%X\351\375\215"
+	.ascii	"\311\362<f\372\317\232\232\224\345y\025\327\277\214\224\324\001"
+	.ascii	"\373\236\345\272\357I3\206\020\373\356\244\365\b7\240\346\214"
+	.ascii	"\330\367%\255\017\301Uf>\366OP\371O\235\305\315\306\276\211g"
+	.ascii	"\026\366K"
+	.string	"\300\245\261_b\351\2761f\316\206\331'\341&\261O\\z{\261]\265\3506\366\205\255{\214\263)#\366\177K\357/$\321\260Vc]n\007\223\022\211}o\207\030\261?|\221\222\234\211d\306\325O\322\003c\017@%\201\013\250q\030f(dh\212D\2440\005\005I\007!\005D1G\2413\017\021\320(i\230ADdDd&Q\350\001\266!\002\205\321\"m\230\033_\223d*T\335\031\2552)-\306;\367\270\342$\265\265\2222A_\244\316y\030\213\002\t\\|\320\344\255\2534s\233}\034\035\003r\333\204\251{\206\262\003\307\226\223\315\351*\253\371\366\256G\2236\212\"HP7\254\351'\251\340-\332\376\2743\365\236\236f\365\022\235a\361\2122>\023(wA=c\217\273%\342K<\036\025\033\247V~\353\270P\021\363\326\350x\234\220\240\357B~r_w\306G\213T\206\tF\370\021U\257\374"
+	.ascii	"\373q\315\316.\3759\313\223O\341\372\b\271\251\\\013+\334\215"
+	.ascii	"\261\326+\323\301\nkW('\310\332\355\244\033P\324?\366\213\336"
+	.ascii	"\013\025S\265\312O\234u.4\226\207-\332\206\365\330\233\204\033"
+	.ascii	"\247\"\270\016\331\032\250\020\315+\311\334\273\036\255\320\n"
+	.ascii	"0\026\346Ir\211L\246\337d\354\341\363\352D\371>E\230\307\023"
+	.ascii	"T\21381\3430[\005}\251\333\035\b\027BI7\320\373\312\206\221b"
+	.ascii	"*T\374\252b59OAQ]0\324+T\323Q\257PMG\275B5"
+	.string	"\035\365+@\264\313\336\340\016\234\t[P\004\177G\357yve\353n\021\\\333\tM\177\347\372\261\314\333P\r\242\263L\315"
+	.string	"\350Lk\231:\2278\275\253l&\277\373\224Z6\r\254\271{\202&y7\213V\022e\021\357"
+	.ascii	"\261\335\0237\364Cd\253\365\276\314\360\345\205\207\006\315Z"
+	.ascii	"\002Y$\325@\033\210|\357Z\250e\265\326\325\245\307\316\3356\236"
+	.ascii	"\r\356\2707\340u\202\303\205\376\275\251z\254\030\326-\311\177"
+	.ascii	"kU.\327\001\217F\366p\257<\006\204\234\312\236kw<6\346\035\256"
+	.ascii	":`A\214\344\274\032\356G\271\032\362\002S\221\\\233.a5\374@\230"
+	.ascii	"M\367;\365\230\227\253f\260\367K4t\322\031\276BZ#\236<f\253\201"
+	.ascii	"\363c\2436\246xR\345\205;<n\303\261I\323\301c\200\f\266\353a"
+	.ascii	" P\r"
+	.text
+	.section	.gnu.lto_.refs.1410747af71ffc8e,"e",@progbits
+	.string	"(\265/\375`\254\004\275\026"
+	.string	"\026\343]< \257f\030\003"
+	.string	"\003z\234\233O\346\313V\205\350\020\t\001\b\001\b\001\b\001\b\021\354>\fvw\237\034\032\353\363\356\346\372\377\377\377\367\271}7\021\341\242^j\"BK\332\336[\246\024A"
+	.string	"G"
+	.string	"S"
+	.ascii	"^\2739y>35\230\327c\326\351\371\357\3124\275\245w\264\242W{A"
+	.ascii	"k\347:9k\366yi}ty\023\274\b\336\325\312\362\256\274\006\336\224"
+	.ascii	"\227\344\355x1^\2137\364v\326\3774G\357\212e\b\226\254\027\243"
+	.ascii	"\215\240\315\322b/A\313y-\363>t\234\005Y\336\347T\275'\373\261"
+	.ascii	"n\234g\243\352\363\344\005\260\216\234\033/Jsn\037\307c\266\331"
+	.ascii	"\265\340Up\340myW\252\242\251Uc\305XMKz\267U\264z6\333\255h("
+	.ascii	"\262\244O\005\323\220\227\362!\260 \243X\003V\005\330\344\342"
+	.ascii	"X\022l\3444\235\210\245\266!\202d\254\245\017\314[9C"
+	.string	"<^\2169:)\215\002o\362\226\250\310\3721\272\ru\256<]\nP\324\222V\215\237-a\202|\242~\223\304\321\231U\020\033\030N\017\322\251\335\205\216\005\253\002\205\265v\302\022\216\260\027\237&_\204`=pp\rJ\310\304\214\020\001\023\242\303\247-+\312\252Jig*cO\fH\274\317?\2273\264\262\024\311\202\371\206w\r+>U\221\002\305\t\02332\2531$`>xxy\345\260!\237\035\2376\200\261\250\021I\247\224\315$E\205,\233\0010Bc\f]\336\020\2109M\007Xx\233\346\26246[\022)q\261]\370I\221\242\035\366U\334\356\025}\027\026\3008\251N\261$Jc1\201\362\361\f\247\f\217\347R\354\303x\341\035S\227\300\235\"\323@\224\2640%jX<$d9\330f%{\345\235,\230\312R\325\303\263\322gY \037+U\026\370J\022\035[\205~\371\033\300-\0038d"
+	.string	"\007[@Y\006\020\021\036\f\305\340\323\205\311\201m\355\377\332z\017\226N3{d\003\371\037;9\312\206\232?\245W\316\370F\237\003\206K?t\023\377\3167\022\272\312\307#\034\377;\375\230\2757!>.\372K\257\241R\026\257\315~\313dA@3\347Kf\256\303\276N\031\224$\207T\275G\336\256\334Y\251\252\372\215\321\201\221\312\243\215s*a!a\324\275\325s{2GN\206\341z:I;]'\300\n\217;\211O#\231q\273M\227o\344\307p\313\352\347bI\367\253\342"
+	.ascii	"\360\037\033\005~\314S\350\357:\340b\016\243\362\374\275?a\001"
+	.ascii	"\360\024 \272\301\345s\357\304\024\214B\332\215\254,\212\242"
+	.ascii	"i\212\263\nP_\213\317\211\2351\224\230\352\031\257\235\f\332"
+	.ascii	"v\226U\307\214\247UV]\002\377\252"
+	.text
+	.section	.gnu.lto_.decls.1410747af71ffc8e,"e",@progbits
+	.ascii	"(\265/\375`p\237\205B\002\232bs\274U JQ"
+	.string	":\215\001\224J\335-P\302/\r\335\243\331\271DD\3041\206{+\262\353p\266\243\352\376\211\250\343NW\215\234\240\354QT|\340\272\234\226!\222\246)\032\351u}\226\347<\212\342\272\256\253$\337A\020\001l\277Io\r\335g\024\265-\367\336RJ\231\002\375\t\317\013#\f\177\273=\3515\220}\273\333\223b'\374t\233>\270\006\226\244\032VX_k\355\020\264\327'}\341\365I\257\235\366\243\334\236\324gh\204\020O\013\353_\267\377\347X\006>\3021n\037\020\005(\t\363l\333\366?f\302K\267\211e\340\366\272\331\376\003,\343\026\336\271\034\245\346\b0XTdm\3334\341c\"\373`\212\211\222j\214\204\223n\323\003V\372\275\273k\216\"5\333f\333\266:\267\f\220\244(\254\237\3716\b\332\366zHoa\341\365\220>\343\355g%\373\271k\357\334\236\364\371\306~^\332\271\275=\251\007\227'\235"
+	.ascii	"p\243\315\333\223>\312\345I7h\373\366\361\335>n\333\307J\366"
+	.ascii	"\006}\227'=\376\261\217\245\366q\273\177\307\354\r\236\227'\375"
+	.ascii	"\225\262\177\3276\007\355\345\351\022B\247\231\343\251\007\227"
+	.ascii	"-C'2\276\264\260\366\321\361r\004\357\f\353_\2637'\024P\256\223"
+	.ascii	"\234\243\235\266\345\232\301t{r\363r\223\251\272q\321\370o\337"
+	.ascii	"\325r\253\\,7\313\265r\233\367\312\215r\247\334\275K\345\267"
+	.ascii	"\3312)\265m\373\313\366\377\374^\271|w.\2571\267\233\332\323"
+	.ascii	"\263m\233\377\340\004\212{\345\352\335\274\234\243\2356)\013"
+	.ascii	"\023\263m\233?W\256\335u\222\233\314\266\345\272\033\201\205"
+	.ascii	"/\216\211`\333\266&L\230\3601a\302D\246\002\205\207$G\377*\355"
+	.ascii	"\333\336\236t\347\362\244\353\220\357\314\016&\326\377\300~q"
+	.ascii	"\037\003\373\021\330oa_'\377mr\353n\036\006\332V\251m\333\016"
+	.ascii	"H\";\332Z\2345I\326\240\301\372\336\375\374\342\361\244\313\251"
+	.ascii	"f\373\326\266\255N\266\203\262\224\006k|y\322\247\260}nO\232"
+	.ascii	"/OZ\342\366\244\027\356\306\335f\211+\367\333v\335\276*5\333"
+	.ascii	"\265\266m\352\254\\\376\256\336\260\376\b\373\267D\252SXXXxK"
+	.ascii	"\244\037\300\236\340\366\244\372\362\244\357\273=\351\177\327"
+	.ascii	"J\340\frI\"\303\372\277"
+	.string	"j\377-\273f7-39e\265om\333\314\220i\234\231\251\303\372\236\335%\267\031\342\242\375\004\212\347\243\264\246Y\3336un\240\240\300\262\260\376\317\376er\016H-\212\343\375\033\"\275\2057D\372\346\355I\367\345Io\005\327\002}b\267\270[]\352\246r\n\331\f\025q\r$2\n+L~,\270\217\256\326\345\256N\270@\007c\345A\0250C!r\023 B\t7\360z\211\371s\007h\320\335\223\313\333\360\253?\376\213\245\344\270\253\037\217\br\275\324\027~\275\204\302\360\177E\326Z\177\225\204\214\202\016\001\234D\026J\345\320\013\\P6\201#?\246 \312\345p\216\021R\031A\004\220\036\367.\334\345\266\020\234\301\255\340Z\200{.\2114\033\275\275.\327B\327\217A\334!Z?\356\200qv\325\177+\270\026`\n\356\244|\347\337,\233\363\026f(\224\370\347\016\372C\366\301\017\300\032\340\016\030D\306"
+	.string	"\305\300\022\253yP\007b\253C\340\337@\177\256\300\237-\360\243@\267P\r\326?\306\370\303\217\327\255.\364\002\027\244+\374\370\376\267\360\307\032\344\245\273\346\377E\203\363r\322\240\016\274\334r\202_\025q9)|A\366\331\340\377\315\277)0Cg\220\233h\005p\332#\370U!\377\335\322'\354\177C\375y\313\237\273\374(\005\260\025\027\2724\365\354\317|\350\004\252@\\\257*\227\303\272\210\1777\t\376Z\001e\276\342\204\343!\340\003\177\376Bop\332\207A\235_\375\373\357\211\017\350\013?N\303\021\374\367\b\217\037\225\300\177Q\204\320\363o\r\374\367\304\375"
+	.string	"\352\342\370o\215K\342z\251\370o\005\377-\361_\022hUr\n8\307]\036\204\013(V\374\017\341O\275\376\334\341\327<7\206vC\037\320\343\202\377v\245\375(\013\177\256"
+	.string	"u\300\177\253\256<4\340\277:\202\007\340\337\002\370/\n\027E\006$\261\035\360\353\013~\215\301\217\252\360_\024\376K\002?\273\320\024\376k\301\237S\310 \002'2\034R\317\024\026\362\343\"?6\362c\262\037\217\371q\230\037{\371\261\230\037\373\375\272\307\257\273~\224\001?\376\362k ?\212\002\272\200\037=\001\025\341\327\255\336A\025\360\337\036?F\262u\2654\222?\217@\023p\225\376{\364\337*,z\007\312\001\346\303T\360\0057\306\322]\242\006X\201\026"
+	.string	"%\200\025:"
+	.string	"\302\020~-\210~\300e\232\347\177\214\177\223\370\263\031\364\003@0\b\370/\n,A\316"
+	.string	"z\342\307iwK\204\377j\335\021\376\233\200??\200\004\374\344~P"
+	.string	"\037\002\370\325\025~=D\177\376L\366_\024\250\007h\007;P\016>\201+w\275\320\017h\017\272\001_\206\004\374\233\002\261\013t\265\272\344\320\024c%)\361\253I\240\377\242\b\3721\222\377xZJ.\232G`,\030p\224\373\201\027\212A\003~\264DFq\361\304\030\360\253-\362\230?\257\350\210\021\377\207\3776\001c\235\347\337\005\310f\250\b\274\207N\360_/l\245mB\374\273\303\345N\002\263\025\346\374j\341\265\312p\377E\201\206\370\357\216\256\273v\022\250O^SP\255\304\220\351P\020\177f\242\021\334%\372\341\277(RP\245\376{\342\2771\374\027\305\326\006\260\224\273C\203\017P\0374\013~5)\347\3701\033\312\001kp\005wu\274\203\007\264\347\327{\227\313\351\365\n\272[\037@m.\3255\240p\274\234\202\332"
+	.string	"~UF\376Bo\252\\]\035/\240\031\376S\340\277\006\022\035\320\2353\f~\325\0039\353N}\2417+\3002\374j\004>\200\332`\254\024\"\3703\fT\265\272[W\307\345\256\327\022\004j\214\320\341%\372\357\320\177\217\377\335\272S\227+\322a\273Et\305i)"
+	.ascii	"\376\031\006\252\376\227\002\367\005\253\n\274\320\364\307X)"
+	.ascii	"\250\035~\\\201\324\345\361\337\034\177~"
+	.string	"\300\217\323\350\302?\037\365\232\027\376\3135\205%\310KZ\315\177)p\271\t\334eN\3721\033\004~-\230gl\360\253<?>\362\343$Z[8l\214K\375\257\276h\326\177\367\177ux\270\017.\303X)\244]\277n\323`+<\\\230B*\346\317T\177\256\3725\232\253U\365\037/\243\200\002c\245\240v\360g,0$\256\326\177\267n\027\341\257\005\377\234B`\030\271\214c\374\377\340Wu\330\212$\370\323+\277F\232\371\361\\\334\237U\200\373\261\225\376\373q\210\034\244\313|\002:\232\314\237\205~\035\346r/(\370S=,0Y8\277*\202\317\217]\340\245\037\317\370\361\210\0377\3758\304\217\331\037\267?\326\300\217\2275~<\201\322\217I\374\330\306\217M\340'\314\204o`\360\343\fX\307\357\277\234\006\031\374\351\013?6q\345Y\376\313\035m\002O\363J]\310\"\374\231\204_s\321\306?\177\330B"
+	.ascii	"\255\005\347\200\273ry\004\274\313\245\360\377\347O\253\356\324"
+	.ascii	"\217'\330\361g\t\350,\377\305\372o\004'\241\261\374\232\357\327"
+	.ascii	"{\371\205s\370S\261\037W\220\277\244\277\232\367\347\273?\347"
+	.ascii	"\375Z\312\217)X\201g\363\253]Q.\225\377Z\371\357\336\177\245"
+	.ascii	"\374\270\004"
+	.string	"\326\340\307\036~l\301\365\272k\377\205\213\362_\356#\376t\003\232\370k\030\364\013x\272\305\335\177\253\334\276\377\342Yi\240\377$t\223\354\301\377\n\376\224\210)\300\031\374\327\353$t\223\2364\203?\203\360g\001\374\332\356\327u?\346\360\337/\377\255\362_>"
+	.ascii	"\3747K\016q\rW\356\327M\376\214\342\307VY\303=\374)\212_\307"
+	.ascii	"\375\372\355\327j\277\036\373\265\327\257\273~m\365k\252_\347"
+	.ascii	"\370\365\214_\313\370u\322\257\217~\235\374\365\361\327.~\035"
+	.ascii	"\364k\b\374z\305\257[\3705\013\277^\341\327'~\315\200_\237\360"
+	.ascii	"g.\177\256\362k\023~\255\200_#\340\317\203\277\016\341\327\037"
+	.ascii	"\374\272\203_o\360g(\277\316\340\327\030\374\232\304\237\001"
+	.ascii	"\177=\342\327!~\035\301\257y~\235\341\3276\177.\3743\341\237"
+	.ascii	"\003\377\354\374\363\227?\343\375\271\313\237\255\374Y\357\317"
+	.ascii	"y\177\216\373s\223?\253\375\031\355\317g\177N\362g\261?\207\375"
+	.ascii	"\031\354\317A\376\354\343\317Y\177\326\372\263\216?W\375y\371"
+	.ascii	"\347\247?7\375y\306\237e\374\031\004\177\356\300\237c\370s\321"
+	.ascii	"\237_\374\231\375\263\005\376\374\302\237'\360\347\025\177n\341"
+	.ascii	"\317+\374\231\204?\027\340\317\002\370\263\007\177\326\340\317"
+	.ascii	"&\376[\343\277)\374w\351\307{\377\345\300\177Y\370\257\320\177"
+	.ascii	"\017\360\337\022\376\213\346\277\022\370\257\005\376\373\342"
+	.ascii	"\277\032\370\257\211\037+\371\257\216\037\343\374w\310\177\351"
+	.ascii	"\376\213\345\307\031~|\364\343\033\177\006\361_\313\237/\370"
+	.ascii	"\361\003~\274"
+	.string	"\376\227\314\217\363\177\313\374X\304\217\321\377\222\370s\005?\276\340\317#\376\273\346\277j~\214\377,\301\217{\376\034\342\277]\177\376\360g\r\177\366\371s\317\217\313\374\370\204\377\352\377>\177^\377\213\342\317\351\177s\376w\370\257\327\237\361\177\227?.\374\257\207\037\247\371\277\342?\211\377 \376\213\367\377\202\377\332\370\217\367\337\b\376\313\375\330\352\307\203?\376\3731\231\037?\177\354\374q\225\037\363\375\230\312\217\245\3748\312\217\365~\f\345\307O~\354\344\307y?\306\373\361\335\217\355~\\\367\343&?n\3731\335\217\331~\274\366c\265\037\247\375\030\355\307\315\0373\371\361\222\037\237\375\330\354\307e?\316\3721\326\217\257~\\\365c\252\037\357\370\361\324\217u\374W\361\343\034?\226\3721\216\037{\360\343\016~\314\301\177.\377\267\374W\373\237\366\237\312\377\275\377\017(,,,\3741X\361w \376@`\001S\252\230\025"
+	.ascii	"n\231\203\217\312\22654?\260F\367r\320|uY\301\372\033\250\366"
+	.ascii	"\217N\0314\003dLO\312\026\324K\325\331`\224:=#\230\314\255\252"
+	.ascii	"\013\nf\333\n+\373z\202\315\234$\331\360\370\333R"
+	.string	"\312\313\204x\270JN\027\247\323\363\016\353\331\225\311oS\\S\352\260_\223\2763W\260\266C\333n\337\324N\253\304FG\207\312\241q\267\211\316\241p\032\020u\013ai\271\312\3302\367\234C\337\320\253\3337\325lm\274\300t>=\2300\201#\343\307\327\335\326\337\300\264\277\001i\377\250[\316Ku\304@#\327v\3476\334\230\276&\266\365\214\0235&k\232I-\373\270Zh\216\350\245a\260\365Ko.\020\r\373\270{iR@\232QL|p\300\244\341\253\262\004S\235\231\200\244\n\214\331\3212$OJ\264`}\303'\230\345H\327\032\346\217\234\227\224\206\re\242B\330h<\361\r\301\347V\214\031\314\266m\002A\263\306\207\032.6&\224\211\013\235\317/\224\fE\202\212\241CP%\250\0214\tz\004%\202\206\241ch\221\333D\231(\030\032\344\016\342 \272\371\3770Q/\302g\3336\231h\217Bf"
+	.ascii	"\230\314\340\372\240\3173\270y\266\354\363L\331\347q\333\347"
+	.ascii	"Q\262\317#d\237\207\307>\317\323\276\206\302}\rd\3665\\\331?"
+	.ascii	"\252u\017\352\330\035\226\017\314\034\034\003R\207\365o\023\305"
+	.ascii	"\202\2131E\t\017\364\n]\233b\246\312\325\315\303Y\370\234\222"
+	.ascii	"\254\362\336\f+hcU\332\211J\b\272#\317M}\251eP\270\336t\344,"
+	.ascii	"8;\302\206L\311\201\224\252\221\025\362\241R(\016\245\327\035"
+	.ascii	"\033\3268`\254\374p\372a\322\204\2717F\345\251\244\353P\244\333"
+	.ascii	"7\205f\001\203*\35149\262\377\356%\331;\323J\246\230E9R\345\326"
+	.ascii	"\225Ia\322\370\177\320\346\236\250\222\216\273NP%m\304\n\023"
+	.ascii	"U\322H\370P\245;\206\356\211F\2412\320&t\t\265\201B\241O(\r\324"
+	.ascii	"\t\255\201\336@c\2403\320%\312t\233\250\222\226\323s\232N7A\221"
+	.ascii	"\320M\371M\240\377\201\376\323fP$\r\210\266_\230\350\021\232"
+	.ascii	"t\233(\222\222.\242\305P$m"
+	.string	"\247\313\344&\263\001Y\374\264\024\032rER}\243\306\206\223-\254\257\0035\241\276\323x\271\311L\241v\365\324\333\361l\333\346\036!\217\247&\324N\254\240P\251\321\205:\215\036\324h\364\232\333\324\204\372\214\026\324\177\332\314\017\241~R\305l\333\246\004\226\212,\311\321u;\204\333\223^\003\334\276v\267'\375py\322\034=\254\035T\260\276^\362\244,\357\277{N\314\236\272\tE\t\363\356\351-Z/\311S\223U\311yy\215\271e\250\005\321[t\024=%7\231'p\221\351-:\213\206\313M\346\272\244\266D/\331#\302\344\273s\\B\334\254\2001\333\266\251\267h*9/'j\247UJ\032\302\324[t\337\327\023\214\326\242\237\232\214v\3521:\214\366\323]\364\027-F{\321\\nSo\321W4\026]D\213\325\375wp\213\276\323x9G\315\366(U;\243\021(\250\313dy\366\201\320\327\240dk"
+	.string	"\262\257\201\307\276\006\251}\rP\373\032\222\3663\244\331\317"
+	.ascii	"f"
+	.string	"\353)x[v\314\300\032\253\371\271\226\202\356\330\323\002\303\372\031\260\354g\200\262\237an?\303\222\375\fG\366\005oO\252\361\364\333\t'\257\037X?\203\327~\006\256\375\fR\033\265\273=\351\247d\220\261\277S\270\177\275v\rw\375\206\201\0169j\2044Y\301Z\267i\267\3537\315\246\337\002\220\325\266H\372M'M\333\"\351h%\\D\342R\375\035\302\255\325~\256\327$\240{r\207\265zy\322\357\224\331\337\311\262\357\245n\377\351\266\277C\266\277\343\265\277\303\265\277\263c{p{\322\357\314\330\337i\367u\312\354\353d\331\231y{R\020t\330Il\245<93\346\365Rm\212\022$\254\177\255\207=\374\226a4\227\336\241\2654\226\026\242\251\264\017\315C\003\321`\372\207\356\322W:\207\266\322At\017\355\245\263\264\016\275\245\253\364\224\376\272M=D\337\270\306\241\245\300\214Q\303t>\005\363\030Y\376\262"
+	.string	"\320\356i\006M\373\243\241\264\215&B\n\225"
+	.string	"f\375]\300+\230}\204\260\264d@]\223\347\223L\335\227\347\t\024zH\376\221\277r\216\232-\324\035d:\237dy,'\371\023\013"
+	.string	"\233n_\236lC\262\030\275\224\243\324l\217B\374-/\2300M\347S\260L\017\311K\262\226\333\367\326\26680"
+	.ascii	"\\\212\031d>\313\240a:\237\202\2009H&\022\347\204\313E\364\220"
+	.ascii	"|$#\001\374\32124\r\034\026\220\311r>\005\3018\211\3701\275\\"
+	.ascii	"\277\302>7=D7\351\032uDf\f\352!\271K\366\273}Sm\033\205\342\357"
+	.ascii	"i\246\207\344\260\354\003D\022S\333\332\300\340L\226O\35623\243"
+	.ascii	"rB\343g\363\366\244\0340]\236\364:S\226:\312\206\354\356H[\333"
+	.ascii	"r\314"
+	.ascii	"I?\341`\341\332\262\005\353\353`9\351@\351\031\273\360i\306\335"
+	.ascii	"\237f\372\262\377k%\035\3436\365\322\365R6\243\2232\332\262\005"
+	.ascii	"\"PO\275\224\307"
+	.string	"\344\277\001\374\265\255\007\023&l\230\266t\021\222\352m\206v\245-\320\255\t.\313i2\332r\343\271E\001\254c\n\316\251\311g\350\230\372H\267\032)\257\311\205\267\231\325\344\301g09\314\3524\230\206\343F\023f4j\r1_H\260~\316\034a\216\221\375\234\256\375\234\251\375\234\246}\0345\3738b\266\326oWUyX\377\203\037T\230\317\\\34663\231\354\314d\360\030\337S\007\t\220FY\252\217\023e\037Gn\037\007m\337\254\333\223n\270<i\366\373\363\226\314\005\013\371b\022\003\353\354\345\347\371\313\332\345\313\223\031X\223(\274<\351q\3126n\266\267'-\321^\2364k\371\263Y>\313Y\260\236k\245\310a\255\244\206\341k\242\267\367\020H\246\026J\003\3669\237\202y/\327\345\274\034\244f\273\004j:\237d9-\253\345\275\274\226\331\2204Z\250d\237\363I\006\345\316\271\261Q\301Z\271\311\215"
+	.string	"X\351s>\0053Z\224\034\2273B3\251\213\020f\306R\""
+	.ascii	"y/\277\3458$\215\026J\003O\347\223\214/\367e*\271J\276\222\247"
+	.ascii	"d)\331\312m\346\275\254\247\235t\205a\376\354\345'!\360-\235"
+	.ascii	"OA\023&\206\bR\225\331\240\217Cd\037\307\306>\316\322\376\315"
+	.ascii	"\231\375\233.;\333\345\273\333$\221\361\232:\030L\r\234\032\326"
+	.ascii	"\277\251\262\177I\244\271\260\360\222H\177\243\266\3472\335M"
+	.ascii	"\341\016g\034\326\277\001\233\313q8\303e\271\347\270\3730\305"
+	.ascii	"\351\334+\342v\355X\022I\365oz\354\314\2063\233\232\246m\221"
+	.ascii	"r[v{f\273\017\363^\021\367\212\320A\223\374p\263\221\352\337"
+	.ascii	"L\355\364\366\244\"nOJ\342\366\244\231\311\317s\323F\tG\334\020"
+	.ascii	"\254\327\313\223\376\206i\353\264\267'\275\317\313\223\226P\263"
+	.ascii	"o\003f\337\006\3126\261\274<iF\362g\261l$\373\270\311\302\361"
+	.ascii	"\032\3033\202\365m\346\366N\363\366\244\230\351\362\244&\262"
+	.ascii	".Oz\033\265\255A\326\345I\363\2204\211\025(YX\337\346H\026b\003"
+	.ascii	"\266\363\027\316^\031\354\371+\003\371\t\024\277Qj\315\332\266"
+	.ascii	"\231\277t\333\"\335+\"\347^\021\350\023!Hj\251\276M\327\276M"
+	.ascii	"\216\215\323\216p\314a}l\343\206\220'\233\216\273\247\363I"
+	.string	"6\305$\313\371$\273\203i\350\344\362\324U\203gp\241\220\322:\237\202\367\t\266\2621\200\262\246\363)\230\2470\217\254#\204\245e\013tM0\215&\f\365t\366\274{Rw\316\215\356\013\207\220 x\371\337\275)\034\205\241n\337T{D\346G\217\351|\n\356h\243n\331\323\371$\233\3029\356\334\355{k\221\242\006\220g\347|\nf\254\274\225\2652\217\\\225\273\262U\276\312;r\217\314\225\251r\326m\346)|\365\033x\317\230\360\331}v`\\ \364\377,\225s\334f\326\221q\374\022^4Y\007\346\221od\264\345n\002f\311S\007\326\312P \222\230P0Q\236m\333\372\2300\221\252\341+\343\226\352\333\264\331\206fB\326\344\342\227\2432\024\336\302``\352\226\231F\256\221\237rSf\312Ny\306mf\250g(\334\206\347\350\350\360\226\020\226\226*\232\346\376\360`\bK\313UN\016\356\231\241Z"
+	.ascii	"#\227\241\260\020\314&\327$C\3414YF\bKK\0074\275=3\024\346\202"
+	.ascii	"\313d\264\345\232\327\024\367l\333\326\204\007\023z\212L\020"
+	.ascii	"\210\006\255\204\226a\303\373\221\225pY\0270\314\266m\376d%\\"
+	.ascii	"\230\221r\223y\302\217\034#/\345\244\333\314Jx\3151!F\223\225"
+	.ascii	"\334\276\250HZ\271\260\255\377|\364\214\364c5\230\006\013\203"
+	.ascii	"E\314\260\316\355\317\363QJ\306\204F\t\326\303+\373\303&\333"
+	.ascii	"\346\362\244\037\252\355\333\274=\251\317\345I\347t\350\352\354"
+	.ascii	"\212\374\004b@7\302@7AA|\3466q 63wC&\246\307\217T\177H\266?\004"
+	.ascii	"\333\037\372\330>wM\212s\n\326\277le8\314\324\323\315K\r2X\f"
+	.ascii	"~\3421\267\211\235\370\313\357\336\2452\367\344\211i\346\304"
+	.ascii	"]\240\230\027\013\016\270\272\241\037\0063,\302\344\342\302\372"
+	.ascii	"\303%\277\025\314\376\352d\177e\262\277\006\331:\257.J\017\254"
+	.ascii	"\233Ha\303\202\313\360\235W\335\263\017k\301Y\360\225\333\304"
+	.ascii	"X\260\025%\214\005\347\341*\031m\351\200/tO,S\236m\333\314Fp"
+	.ascii	"\200Y\r\365\327\250\r\205FW\270\207\251\340)\267\211\3710\224"
+	.ascii	"c\274\313\246\344\204\210Y\031\226\222\321\226;o\006\031\037"
+	.ascii	"~2\344i\302DJ\203\b\034\232\255\365p\224<\027x&XFoG\331\337o"
+	.ascii	"\373[\311\376\006\262o.OZ\207\355p~\214a\253\303\372\233\251"
+	.ascii	"\216\314\276Ze\313)\271!E\301\372\252\334\036|\303=0\220\020"
+	.ascii	"\226\226k\223\034\324\023\277a!\230-\204\245e\003\344j\304a\270"
+	.ascii	"\333\304o\330\355\030\013g\371\3308\377"
+	.string	"\322\030I\365U\262}U\310N\315\200\205\331\272{exIF[\356\272/j\256\033\031!3\311\235\313Q\332i\225\274\006\231x\r3\301M\254\206\323n\023\243a%\277\2038\310}\232mk\206\321\360\330\235\313h\313\355\006\207\346\356\241\341\036\030I\bK\313\265\006\\\232g\3336\265\224\277\035kn\264\031>s\341\357\016\r\353\2537\314\324\247\375Tp?\005\263\237R\331O\357\266\021|D\354\352x{\243\302\372\251\231\221\213\331HI\363\005\t\326X\314\306\213V\232\036\326\007\304a\377W\03425~oD0\323y\244\251\205\365\323 \373\307D\206te1b\006k<\004_5[\237\355\205\224F\020\353\247X\033\267\267'\365QA\270\345\207\275n\023\177a.\237/\334\003\003\001\221\304\324\"m\r@\214\351|\n\266m\323\307\304\b#\205Q\264\306?P-P?\322`}\264\313\376mb\037\270K\303\355"
+	.string	"\302\205\365\177\300\343\256\217\271iA\240X\214\f\211\303\372h\225}tn\037M\333G\3156n\336\236\264\304\345I\217\026\331G\273p\225\016\227\273)M\254\217\342\330\230\352:-\013'#\345\340\253\303\372\250\214}\215f_\217\331\327}\373:n_\263\355\353%;NKf\314P\263|\262\362\026(\032\201djVc\374\272b\304Xe\370d\345-S4\002\311\332v\252\304\235\241\305\\\227\276\312H\2354lt\311c\"6\345\003\353\227pZ\223\326$5\353vQ\341 q9IK\003\370=\b\270\036e.\267\331Ne\035\221\031"
+	.ascii	"\032\247B*\301\226i\252\204\rZ\023\332\2254_\217\276\266'P\\"
+	.ascii	"\f\031\022.HX\357\302\347L\361\341=\261\376V\263\327t\255\215"
+	.ascii	"a}\022|\373\033\374_wZ\216\250(\2547\232\213\301F\3048\221\301"
+	.ascii	"z\023\376\311\315T\027\301\037\\U\270\262$a\275\317|\013\376"
+	.ascii	"\353\212\307\243k\013\353\223x\262\377\035\370\257j\034\227*"
+	.ascii	"&\326'a\267O\002\216\f\231\375w\323Z\250\224\355\211F\340\206"
+	.ascii	"\013{\252\332e\276\377\340v\004\342 \342\347\267\235w\247\231"
+	.ascii	"\344W\370l\333\251\0226c\n\2638\215\371v\322\320\222\206\n\353"
+	.ascii	"-&\f\030\036[\266l/w\247\231\224e\006S\353Y\351\"\244\313\267"
+	.ascii	"\027\033\302\273 GXo.$v\224(;\313\263R\313#I\212\303\351L\021"
+	.ascii	"\301\266\235*\221\247,\221\230Y\371\316\262\261\330"
+	.ascii	"\230\013D\302z_\311\361\273K\323\206\365/\270\333}\273\312\235"
+	.ascii	"\033V\215}\305\300z"
+	.string	"\363\241WnoT\205Xo)\233J\333\204\304\004\353\275'\365\206\344\306\032\326\277`\310\376m\356)\251\224\223\030O\212\\`\005\005\n\225\004gYHk\260\204`\375\013\220\2348I\217\\\t\256Z\347Sp\233\021j\r\376\341\341\341.\334\266m\313T\245\2209{\312\250\022C\323\245\256n\333\341\254\266m\227Z\016\250!C\366\\\321\320\360\214\330e\"\351\023\036R\224\274\271\271M\227D\002)\346P\013\313\227\027:]ClFS\0228\270\035\367\273l\377\372\240\370\220c\202\365\216\363\033\353#\202\365-\250\332n\333M\005\373\220\267\212q\362\204\302\372\026@\245\245m\266\300\016hl\204\2505\225\255}\263\025\351\013s\004\353\255\206\303p<Q\t\222\307\025\030\246\016\353[\200\264\177\223\334\335\274\315\335D\007Q\246\233\025\203\t\023\263].e\360\n\316(Q\262\227Xa:\237d\350\025\031XP\316\276\227\334"
+	.ascii	"\t\023F\t\353m\206\232\t\322W\205\t\353]\346w\344\310&\353Pv"
+	.ascii	"\237z\204\0312\366M\226N\t2\355\300z#A\315\3448'\216\277\n\370"
+	.ascii	"v\330\026\333a\270\253H\021\334\025\001\340M\341\022%oX\277\202"
+	.ascii	"\273\375\n\226\020!\022\301\221\254\257\275\205l!\270k\267\037"
+	.ascii	"\2544+X\202\201a1\276\276\301\355\265\275\366\217\016G\230+\230"
+	.ascii	"\030\0344\260>\005`\366\356\261{\354\037\267m9\374ee2`sL\333"
+	.ascii	"\307\367\017\2544I^\260\336]\231\t\006\310\034\220\267\026\310"
+	.ascii	"\026\326\247\200\312\336X\033ko\035@\212\216\271\307\204b\303"
+	.ascii	"zo!iZ"
+	.string	"\021\303zg\3410\033'$I\232P \267\367\325\276\302b\201\032\364\2323\356\2548a}\n\312\244\244v\025\031\0075-\325w\025\016\253\321\332h\303z\357\300ag\314\244\341\300zO\241f\376\257\270\253\206\224A\254\267\216b\327s\t\326;\307\315\033.}T\235Q\340u\343F:u\305\341FK\001\324\336O\373iG}\247\345\271z\356\345wT\272\235\272\246\206`\275\241\366\340\b\305`\275kl%\265H\f$+\254\017\270\004N\360\b\353\217 \263\217\366\321n:\323Q\303$\243E\343\273\t',\251n\211\365\236\201\303\2428%\301z\307\330Lgbh[\233i\313\300\3231\226\206\356\241\3355\305\330K\270E\337\376\312\320\260>\340V\372\277\232\260\323\202\262\225v\322\032\030\346\244e'm$1\034=t`\275\221P04\310\3372I\375\220\303\372#\256\244I\243\026jHb\347|\222\3353\203e"
+	.string	"\3255W\013\333\226h\244\260V\325\3400\235\2628\277\033#\234\b\252\204\202*\330\340\240\n\326\201I\237\363Iv\206\364\303\013\353\217p\333\037!FF\r$\243\002\226)\243\002\362\234Y\356'6\254p\250f\256\002\352\200q\223\372\303Z\375\033\261\265?\202\306\006\003Fu~\247M\242\341\352\251\256!\243*\033s\325\211\245/\t\007\326\252\030\034V\246\312\253\tk5L*\003\335JS\206\013\r03'X_\204\232\375\345\213\212\267\266m\022;\347S\260\214\025*pX_\204\363\212\332\345\212\312\005\013\026\225\313\0071\246\363If\223cY\203n\313U.M\246\204@a\255j\301aC1B.\177X\253Y\260\354\213h\"E\265\"E\2552e\212Z\205\352\303\215\026'\310X\f\225\357j\225\254\326\204\344\304Z\245\202\303l\264\374p\362\300Z\335\273j\\\316\314\371\211h\356\213"
+	.string	"{\242\352=I\247T(*\224\253\017OZ\0215\366'\360\263S\363\354T\274\273\337\251x\267]\266\355T{\004\250\206=\247J\240u\202U\336\260\306\023\343r\302\372\023\360\355O"
+	.string	"\307\246\312\261\251M\324&WyS\244`\255\316\265\265\251q\337A\222\312r>\005\341\256\306\375\324\300\322\205\265\372\206\303r\324\0243R\260V\335\356\034\212\327$\223\232\300\310\376\004SjjbY"
+	.string	"0\263\2310Q\321\276\323\236Y:\237\202\315\253hX\312G\336\f"
+	.string	"\350\355\2622\365\354;\255\227\216\016;\263\253g\350\225\272\345\006\030\022"
+	.ascii	"\212\0349\242&\341\221j\235O2\262\253I4@J\302\302Z\035\303Db"
+	.ascii	"\034m\t\304ZE\202\303\352r\354h\202\304I\nV\021\254\017\200)"
+	.ascii	"1\2617\r{L\t\002\207\fQ\303t\364\262\234O2\346\3250\246*L~X\253"
+	.ascii	"DpX\r&\313e*#\375bDKF\026 j\020 *\230\227\227\n\246s\243\357"
+	.ascii	"\353*\330\2165O\344$p\333\227\240\007\027\227\352\203\247\254"
+	.ascii	"\317\371\024T}t\t!3\004k\265\307\211&#o\0224\251W\252\226z\245"
+	.ascii	"f\251<T\036j\326Pl\251b]\315\302\001d\353[\022b\314~\2108\325"
+	.ascii	"\206:\245\332P\253T\252\253Ux=\234aX\253;\324\033\352\rU\207"
+	.ascii	"\315\216>\347\223L\315qU\307\260J\217\3016\254U)\0346Lkc\202"
+	.ascii	"\207\265\212#\004s?\004\024\024\224\272\374\200f\351|\222\251"
+	.ascii	"\313\031\177\355\027\326\007q\345\351\251p\371\2466\251M\351"
+	.ascii	"\2321;\347\223\f\310\214\031)\341w\3327\0335M\020\255\332\252"
+	.ascii	"\255*#nh\245O\225\241.!ay\235\301Z\215\241\251\214A\323b\375"
+	.ascii	"\b\270\250J*R\232\244\303\310\r\371\201\265z\324\226&M\272\346"
+	.ascii	"L\272f-\333\312\032\f\"(\230\022\346\334e\r>%\314\tl\203\262"
+	.ascii	"\025\001\2152e\322@\0331;\300\247\201\272\n\026\2260\254S3i\273"
+	.ascii	"\227\346\206\027\254\323?\264-\365\021dk\371\024#&}2a:\237d\316"
+	.ascii	"\247\317\013\305\264f\t\326\351\2305\013\225_\227\017z]\272\244"
+	.ascii	"`\206cO\347S\320\357)\230}\265\266F\n\353\364\313\237\344\320"
+	.ascii	"\025\2013\303:\365r\347.\323\217\254\243\017K\254\244[\254\244"
+	.ascii	"Z\372\372R-\373\b+\313\371$\313\362T\213\206R\006\345\007\326"
+	.ascii	")\026u\210\026#6\260N\257\240m72\276\330\021\266\375_!\240\005"
+	.ascii	"\214\020\353\177\340\261\357\341\f\225\364\007\225\224\357>M"
+	.ascii	"\036W\021T\245|\036\244@I\247@I\245\\\240w\275T\312\357\022\311"
+	.ascii	"Ke\322Fy*\345\316e90,%\017H\366=89q\202\305:\350`\372\004\326"
+	.ascii	"\325"
+	.string	"\245x6|Y\316'\331\335S\274<W\244F\024\326\251\035\016\243bd\260\007\326\007D\325\374_\207Fb$}\301\372>T\330\330R\2727U\257\317\371\024\204{J\227\316\255a\204R\226\304\245rh\363N\352\n\326\367Y\213{\273s:Yd\374-\301:uCy\004\361\253\372\202u\332v\363\324\354\004[\237\260\263T\355,M[\262$M\373\016\322Y\213\3664M\007\013\232\032i\023\357\207\0232\315\224I\032F\253pI\312$\353a&*j~`}\037\251\375\016ev\222$iY\241\222\247eO\232\246X%\351\240\267\213\244H\212\244ci\333\336f\026\324\262\235Z\226H\307\304\304\322#\337AJw0\215<=2\227\2075\206\365\001\363\027\r\033y<\260~\007\270\375\016F\206\fI\231W)\231&\221\247L\214&0\356\b\326\007\374\223\377\253\226\272+\343\303\372\035\254\202\004I\277\206QY\035d"
+	.ascii	"\001\222~}\247\265R\007\323\257\374%u\346GE\355\377j\303\305"
+	.ascii	"\247\205\017\353s8\263}\370H\247\276\203\324\266Im\313\343*\202"
+	.ascii	"\252\247\363)\330\267\377"
+	.ascii	"\264\307\323\2567\f\264m3\325B\023\362\004\353\023?O{8\321\032"
+	.ascii	"\304:\315J\265n\363{\351\326\233:9x2\340\366\260>\007)\373\367"
+	.ascii	"{i\b\356\367\322?\305\272\312\202J\314\326\352\267\231Z\245W"
+	.ascii	"7\252m\221\274\322\250\3452\003\0353g\004\301`}\016x\233\212"
+	.ascii	"*\217\311\201l\377\351\216t\352v)u\341\245:\236N\251tq]\264\020"
+	.ascii	"\371\277f9\257,/X?mJ\235\236>=}J\245v\333\266G\315\026*\225b"
+	.ascii	"\347|\222\265S\313\022\177\212\343\251T\216\363\254\215\013\326"
+	.ascii	"\3512\275q&\311\231\223\250\324\006n\326m\331a}\016ZQPw\256\220"
+	.ascii	"0\016\t\353\264\006z\365"
+	.string	"\177\2751\303\245\246\305\372\200w\356\377\232V\201JC\210\3659,\355\377\367\370O[\244e\333\2666\320f\273L\272I\377\373\213\336[\342\307\271\371\216\370\257\177\n\200\240\331\306\260b\244m\333kf\213\325!UM\320\242}m\253\264u\244\200\255(\245-\035Lk[Q\031\230\326\266\332#\245!G\031\226\355\326\021\323Z\333fPR:*!\253\315\300\264\326F\2651\260D\335\266\271u\324*e\265\031Z\245\026i\002&\245\255(\2465\244\250\fLk[Q\355\332V\273\323*!-g(\265\313\f\355\332\026\231v-+j\207i-+\212imk\357\322\321p\232IU1\002fv\243\230\224\332\032OVH\313\235>\246fV\353\245m\357\333R\273l\373\332vD\333Ze-\275 \351\270vI}5\222\346\220\262n\263m[\017OI\\Y\255R\337\321m\373\230\214d\265\255\221$\027\355S\333\266m"
+	.ascii	"\216\232}\255\327\355;\352a\325:-\265\355\207\266\331\266Om{"
+	.ascii	"t\333\276"
+	.string	"\266m\217\332\266U\227V\315\266\245\332ab>=\265\355\224\317Skut\267\324\266\370\315\317.\212i\215+\353\347\256m\215\331\312h\036]&\247\254\226\331z\331Z\356\265#\264\326\251m\333\373\267\231Q7\312`\235\316P\332\261\244\210\223\224)UJc\334\346\237\244K\255\316\365\322;\362\302\372=s\233\003m\333\266\367OR\365O\322\024I\247\206\232\236\237\220\364h\rZ8\004\024\324\322\206\365{\250\326\240i\366\221\2576)\254\277\001\r\212\206\020\035\344\352\021\346\027xt\360G\317\240\202!t\264\260e\371\303\372\222\335\236\264\303\345IQ\300\237\243\2018@\202 \251\303\232\303\345I\177\324\314\321\2772\034>\202\264:\353\035\232#Rer\230dD\226\310\314\321\315\250\262\365D\275\210\265Q\321\221e\007s\315\226'&\035\226\252g\037\326S\013\024\352\005\345\222\363r\323n\313Pk\372A\275\240Wn^"
+	.ascii	"\304\360\272\330\020\f\203~A\305\240N\024\f:\006\365\273M\324"
+	.ascii	"\013\332\345\271\305\313\343f\016d\202\367\334\321\337\360d\177"
+	.ascii	"\203\335\376\206\270\375\rm\373\033\232\373\033\310\36670\367"
+	.ascii	"7x\355\037\265\222e\334\204\225\021\006\306b\013v\004\023\354"
+	.ascii	"\220\220\221\270\200\242\261(D<\252\020B\310\2304\032!\211B\007"
+	.ascii	"\212I\241\"\027\330\241\"\013\243\013\310c\n\022\224l\213\016"
+	.ascii	"\024U\024\031%Ye\321\210\302\317qE\221\013BF\243#re;P<n`\005"
+	.ascii	"\013\007 \331\r\034YH\026o\216+\206\212,@p\200\025R\026\215("
+	.ascii	"p\200\201<\022\261+(\331\023\206\206\216E6\354\020\f\245\212"
+	.ascii	"\025\"\2448\256`\211\210F$\033\203\361\030\004\244$\262\bQD\024"
+	.ascii	"\204T&S\026iT\244\213\210\202\214HeR-A\311\236\020\244D\346("
+	.ascii	"\201\206C\304\240\243\n\307\025$\254pA\003\fe\021\221\t\036\220"
+	.ascii	"G%\321X$B\262+$\200Q\024D\304\022\245>>E %\221\205\316]p\320"
+	.ascii	"\302XD*\223\035"
+	.string	"\260BFCA\306b\007\310\244Q\007\034\206\206\214\214\306\243Q\335\300\021\351By4\252,\210\354\220V\262I\"\226(\025:\006\261B@\036\210,\022h'\031\001c\261\005\013\003\320]p\320A\022\t\242C\320\b\240\fH\226\005\013\243\021X\026\t\343\210T&Y!\033\025\224l\013 \036\266\005\333\202\305\221\265\tR\032\025\2618\201\342\207\203\005\220\260\"\002*H\030\032\331\242\343\013\242c\221\315\320\261H\203\262h,\016\r\035YHz`\001\224D\026S$\211*dPr\200m\200\220\261\25034\304*\221E!\027A;\035^\260lrh\310(E\262\210#Dd\221BD\026\351\"i4t\343\"i4\304\263a\250\310\202\202!\242\021\311*\215(\274`\331$\b!\"\333\002\362\230\202\035*V\340\001HDP\221\350\250\024\341\005\313&Y\260C\305\024\305\021,@\274@\022W0\026\211.H`\341"
+	.string	"!\243\tI\024(\3600\001\213L\2214:\032\265P&\331\026H\242\n\033"
+	.string	""
+	.string	"I\0342j\301\266@\302\203\262\030\201\"\013\017\"\\(\213\021\030\032*\246\360\240\202\003l\003\224\354\t+DH\341\003\200\024\311#\013+DH\241d[\\\020b\004\tJ\366\004v\250\210\001kd,*\215G\022z\222FJ\242RE\007\r\021\274@\022W\b\032A\304\361\200\003%\222X\304\201\022\311&\223D \240\026FX\201M\"\211E@B@\034\224@l\007\212\3114\025\"\262-x\340\300*\331\241\"\242#\tBHb\220P\022\350AE$kd[\354\007"
+	.string	"\204\r@\b\201\003\352C \200\007\004\360 }\b\004\370\371!"
+	.string	"\b?\373 \374dVe\201\204\214G\022$`\201\214HV\251$\262\260B\204\024@\254\320q\0056\006\242\212\273\340\200%**;0\036\211\210\216A\036\222@D! \033$\221\205\241](\215G\"\024\006Q('\221FG\027h\222U\032\031\213DjR\310x\fb\223j\26284T$J\225@HV\310\230\243\004Z!B\n\224\355@Q\005\221\005O\013J\3430\351BidWh`\211\212+\214\307\342\r\253$\226 \2022I\034\312q\321\242\270\200\035\226\250\270\202U\022K`\225Ed\004\224I\342\020\316\006\216*\350d"
+	.string	"\341GId\201\262E0V\250\310p\342\203$\007\330\215d!\220d\201\036\217H\233#\013#\nI\026\251\321\213 \"\f;\233\215\241\210\024\262\371YY\244\221\222hlQT\241<\036a\300)\001\205=\304\302@T!\006\233\023\037(\211,P\240\022P`\211\214\206\216\020P\022Y\340(\217\307\021\212\2102\240\"\211.\2024KDl"
+	.ascii	"\021{T\221,\013IV\t\003\206\034!6\006$\233d\221<\311\025\"\244"
+	.ascii	" 22\252\312\343\021\231\003\302\017\261(\304\022\241 \374\260"
+	.ascii	"\035(\252X!B\212\365E\020\021\271B')Dd\027@dd\334FVH\250\350"
+	.ascii	"\002\347\304\007\311!\242\362\250\314Q\002m\026(\205\222\310"
+	.ascii	"\202\207-\202\261\202\005\322a\201:P\034\"\026\225E#\n\021\200"
+	.ascii	"P\002u\310\0212\232\300*\211BE!#1\350\346\306\205\262\205\221"
+	.ascii	"U\241\210x\2022\311\302\200\243BG\t\264B\204\024l\020\261H\005"
+	.ascii	"\313\"Y\334(\213\306\342\212\262C0\020\205\220\304\240dQ\310"
+	.ascii	"F\t\004\302&\247\210\210\250L\262D\305\025\311$\033\024D\324"
+	.ascii	"Q\002\201\360\223$\"M`c(*\215\202\330\244\361\030\364\201\005"
+	.ascii	"b\225D\245\212\027A\307\241\021X\027A\035\206R\245\321\350\210"
+	.ascii	"\264A\036\225EEdP\222-A\007\311\022\025W\f\223lQ\211,\226\220"
+	.string	"!\231d\221-\216H\026\214(\270H\032\r\245`]\004\021\2036$\331\241b\n#[t\\Y$\213\315\002\341 \217H\244\t\312$qh\035:\036G"
+	.string	"B\207\206\214R\020\261\312$\214$;Td\221\243\004r@\017KD4\262CE\026[\tD\202\006\026\0314|\301\262\311\241\022\350\005\313\252x\301\262I\r"
+	.string	"%\220\b\037Tp0\201mAId\261\001\311\026\031\251\320\240\004\372 \201\022H\204\"\035\027AH\"\233dYd\n!#[TD\314`\002"
+	.ascii	"\210E\034`0R!dd\225\034`5(\201\\P\002\261Cl\t\032\330\241b\212"
+	.ascii	"\027\306\342\220\321h\310\002\261I\242\013\026<\260I\242\213"
+	.ascii	"\"T\t\264\002IT&s\204\214\354p\203\022\b\251d\201\035*\246\320"
+	.ascii	"Q\022\203\214FH\345\315\203Hx\021D\204ah\210\030\264\225@$d`"
+	.ascii	"\207\212)\330\344q(he\225De\0225\036\213J\"\222-:\256J\240\033"
+	.ascii	"\026\210-\202\261\202\035*\246\330Q\262I\026,\034p\323\3428d"
+	.ascii	"\303v\240\250\242\350\006'it,\306\300\"Y@\036\223H\243\240\036"
+	.ascii	"V\350H\244a(\"\225J\242\020\373\"\350\250\002\253,\"7\320\223"
+	.ascii	"\262.\202\210$\030\213D%\333\202\020\221En\270\213\013\224@ "
+	.ascii	"\374(\215E\225\003\254\220\021\005\030H\245\221\035*\201\220"
+	.ascii	"\254\322XD\026K v\030\"\006\025\2230\\\260\200da 2j\300\206\344"
+	.ascii	"\221\005\241\f\310\"\213\033#\213D\032\005\355\024m"
+	.string	"P\022Y\344$\211,\206I\"#\243\215\022IT\252\b\322\200dYH&3\b\261Jb\320qhH\004e\2228\264\341E\222\270\202\021\005V\t\003\206\fHV\2314\032\"\001\006\262X\202\362xDn\270\013\016\204\220D!#Q\231\004R\022Y\224\370\261\210Ev\240<\036\221\035\330$\221Ge\020\253\202\310\3108\024b_\004\021\213R%\020\f\244\322h\202\361XT\026\225H\"\013H\030\210xZ\020\207R(\217G\030\222.\2026[\004C\251\205\214&$]\004\245J\240\023\037(\215E\243m,\266`G \3020\264\225@!(\215E#\365??$L\340B\003N\330A\034$Y(\211,\202\2140\222\304\016\216\305\016\214E\"Q\007A\310d\007\034X\360\177\250%e\342\020q\303\262\222e\225a\023\246\217J\t\213\272\314Og\364\232\206W\322\257\325\213\030\037\215a\037_\225*\270\353;W\037"
+	.string	"\237\034\214\355\177\310\247\242ey\252\262\202\251p\271H8\304\220\331\253\202\225$\2755\247\354\252\233,L\240\310\364\364\206Q\310x\306\232\316\247\3400J \331\224.X\237\203\253\235\2277|\362\273\034|:\371\360\211\340\232\025*\016\226\366?\304[\337\362\330\231 \331]\332\225\272\345\2511\355V\265\265!^;\260\0366\0316\301b\233\303\336s\203\347\376\207t\373\307"
+	.string	"\344\270\226\314\251>\206ZL]"
+	.ascii	"\345\326\256\341\227/mMqC%\270\310\020#Up\253\027\216\031\225"
+	.ascii	"$K\334>|\373*u\002\305\305\224\311\241U\205\365\220m\3306\306"
+	.ascii	"\214\373r1c\304\302\340-\301z\2506\\\003\302\204\313\273\363"
+	.ascii	"\317\245\240\021A\277\2645\207Z\243\f\215\017\264\035\265\332"
+	.ascii	"X\343\245\254\271\216e\245\2611\206\365\360\354\236\3510\255"
+	.ascii	"e\265-\322\220\311p\311\207g\307\200\023\227Sj\226\221p\360\276"
+	.ascii	"\210\370\225\341\031XW>\226`\275f]26.\317#G\206d\034\242\332"
+	.ascii	"\261\017\311~\374\240\321\003\353!\022L\204\310\231*\300\r\360"
+	.ascii	"\366?4\242\002\332<\235:\320\210\245`\364\034\016-\247\"\273"
+	.ascii	"\t%\374\212\002$,\t\017:)f03kY\351\004\227\344\021Y\251\220x"
+	.ascii	"-\241a0\260\241\220&i\0313\310\207B\322f\212c,Jn\003\"_\032\357"
+	.ascii	"\006\r\352\206\221\036=\206@\324;\273\037\037\002Y\222\213\232"
+	.ascii	"\303z\350\003\207\261\351\331\311\300z\330\205\266\3454E\275"
+	.ascii	"\r\272]\0214\342\005\353o@c\377C.\247J\344+\312\310\326\031X"
+	.ascii	"\233\023\254\207X\303\254\017\265>\324\302C\255\\X\230\236iq"
+	.ascii	"Ky\304\335H\021\232y\273j2\004\222\266%\212\225\032\326\005M"
+	.ascii	"\\\023\254\251\250T\260\337\345U\226\340pj8\225N\335'I\230U\366"
+	.ascii	"?\324\241\352\320\342\025\345\204\245\244\260\330w\256\206z}"
+	.ascii	"h{h#\207\240\260\260\2600M\333\"\rm\340!\216\341\215\017m\\\365"
+	.ascii	"B\306\204\224\016k\fk\f\227IZ\347Sp\b\365\341\262\251\214\225"
+	.ascii	"4\032\354\330\377\360\tLG\310\217\270\262\241S\272fs\031\244"
+	.ascii	"\342e\330\224\006\276\355%\305\300z8c8\203*\347\214\251\301\321"
+	.ascii	"\376\207L)a\n\304N\214ox\364\243\341\322w\256r\304\332a\214\017"
+	.ascii	"\227\372r4\231\201\365\020i\250\324\304\212\230\035C\245a\322"
+	.ascii	"^\263\374B7L\302P<\230\302\322\314\240n\377\3036\305\363\342"
+	.ascii	"\246\007\2440}\352d\211\023\323\265F\225qcE\f\222\230\232\365"
+	.ascii	"(\247\217I\241W\032\265j3\025\371\241GH\270b\271\321\314\200"
+	.ascii	"m\013\n\3568\234\345E\354\351Yd\007\006\356\270\024\253\231\201"
+	.ascii	"\216\375\257\200\1776TgnN3thX\030\024(\177\251\226f\326\030\""
+	.ascii	"X\257c\3261+\231\347W2\332\nl\320\371'\030)\315\336Q\232\335"
+	.ascii	"z\310!+r\244.\214\232\345%\253\313i\365\262zY\375\244\236_\276"
+	.ascii	"\372\2010F\257\f\353\003\226\240\321\026\230\204\365M8\367\277"
+	.ascii	"vIK\001\313\224\021rq\332(A\221;\263%-\303\241\342S[\323\222"
+	.ascii	"J\351!l\243\303z\265\262ZY\261,\340H=c\256W\276b\301`b\242\322"
+	.ascii	"\260^\373L\340\255|+\337\376[\r &\204\211d\357\355\355?\234\245"
+	.ascii	"\324\266K-\214\036bWO\023V\373_\247\250x#\224q\352r\342d\215"
+	.ascii	"2\201\222\031\261\301\347\252\3675\312\226T\222!X\257P\322&_"
+	.ascii	"\225\336\r\254\327'w."
+	.string	"\203\253:/\0231\366\277\346e\321V\203jd\340m/)\225#U\356\356\322\261\325.\373-Y\201i\302z\235[\347\326&\337AJ\307\2308J\374+\335\327&[n\206\037\221/q\177\234\212\347\223u\004\2302o\230\240r\250\361\261\261\255o\227\r\213F\240M\017-\035\203n_\337|P\361B\205\365\332v#D\214\214+Wif\200L\230$\371j\226dU\313b\024\320:\265G;\315\244-fL\265J\023\036dK\276\252}MS\341\276\320\b\203\365\212\326drf\343\305\2267\205\232\321\031C\323\304\005\353\265L\t\031\330W\"`\353\230\216\223\333\266Sm\222R\313\303jX\210\223\006\346\310Z\221\257c_\221\234@\361'@h\224a\275\0361\"\266\206\241f\206pnEv`\2752Q3\031\ni\f\231!\337\202O\226\262`\275\n\271>j\364a\t\362\2577d\202\344\370\302\372\030\210\355c"
+	.string	"\366\343\307\352\265!\311V\027\0339\206\227=: _\2752Pbc\r\003+\036<\326.\237#e\272\330@\345l\bz\255=\276v\341\304\340\022\273\201\365\312\265n-\3312\305\n\326\007\\\267\376\257.\034\211\202\267n\255ZW"
+	.ascii	"\357p`\275f\331X\355\331\205a}\f\242\366\212\205v\321XW:\242"
+	.ascii	"\254\261\262Z\251\256\322/[\350\376\264LM\255TV4\002\005\233"
+	.ascii	"\314\342\316\326\035_\251\344\202|\301%\rA\363t\205\365K\260"
+	.ascii	"\255M_\237\326\246"
+	.string	"5G\3162\226\323\344\334\352Z\227_s|\2252\372hk\303z\305\361\353\365\327\306\204\365\327\033kX\230\2715X\25766\270\"\324J\203\365\327( X\204\034\301\032\337?IW\250'\274#WX\2575\356\304\231C\003b\265\006\214L\250\304\346\215\226\007\264\252\220\202q\022)\245\030\232\241\331\006\001c\025"
+	.string	""
+	.string	"8,\034\024\214\266e\331"
+	.string	"\024\200\fC\302H-iF\027\352P\234C\022\031\200!"
+	.string	"\002"
+	.string	"\004 "
+	.string	"\001\331\310\221\031=|\255\232\te\206\002\036\001\234\322`\357S)\220\311xL\n\034\315\250\001X\220\235\265\270\001\332\233m/\330\333x\235\235\207\021\203E\r\312R=?n\271y-\257\244\036\232\365"
+	.string	"*p\300e\305\223 }b\245'\206 \375\206\031\006*\225\324z\227\254\241\256\275>\"]\030\253] b\n\250q\001wdP\272\325\236\007\256k\360\320\312\367\020J\034\212J\007g\024\3175\210\247\346\253\013\2712+\350\320'\201 \r\346\025A\027V\300\265\263\t\314\310\245\374\234#((\207c\366\002+\325\\\342L\304\234\324U$\306\217*\312\224B\354)\272Or\fX/\\\373P\261\276\220x\210I\nf\222\321j"
+	.string	"\220\343/EC\260\273\214\tpi\216\223\377\256l\222\2260\2215\222\002\333oj\032s\335L\216\375\262\315J\236\2574\326\240F\313p\003\001\205,C\3531\345f\020Q1\215@\365\215\267\020\301Z\305\004\242\342\364\032/;\177e\035\003^|4\004n\322y\323v\201Y\227\225\324\311\212\t\375\317\3617bg\267\262\311\216\037\265\n\037\251\336P\331o8\250\324'@\016UF\03601;\002\320\210\202>Q\177do]\225s\370o\264\255\245\021\027\362c>\321\2271\214\232\322\027\352\205\3634\361\320\200v\2016d\200\270\272\034\203\336'\024\001\222mX\202\b\333a*\226+\2606\267\243E\007\274\261t\211\03175?\252\030\205\346X\203I\270\037t#\272\322\361\242?\004\312\330\005&2\315\251T\266\312?\267\206R\205\2501"
+	.string	"\374.I=\005\241\212xt\032\277P\026\370\357\327\322\303\351\002(8\325\006:\340\271\207?\016\005B\306+;V\b\324\361\310\034\216\002\202m\371\021\367vL\031b\214\\\"\002\255\345\200T<Y\225\024#-\376\210\212\340\243\204\316\353\232\031/\t\333b\225k4\336)\331j\022\3657\360\031\315Ey\034\236\030\032\222\332\253`\203\021\321\031\005\306C\351\r\021b!\224\301\251m.Zk\210J\207"
+	.string	"\370\365\r\340\363k\320%\001\360`\b\342\231s\335\t5\017\037\237\346M\020\300]\321\322.U\211\334n)\364\\[\267fB\273\242=\264\223\265U2\212\321+E\364&\247\336\262\267\226\033b@\224\214\301\267\374\003\210mU\\\375\300\377c\377g\007D\351mb\201k\3037d\002\362\343a8\220k\033(\362I\250\276\253\361h\334\373\312Rf\217b\3139}*\346\302\020y\004\217\277\205|kvCC]\331\313\024Hg\206\\"
+	.ascii	"=\366\275\265\202\300|\242\023E)>A\377_(\302\262{_>\223\232="
+	.ascii	"9\331{k\345\300p\\\203W+\020P IX\337\271\244\253~- ~.t\023\236"
+	.ascii	") \247\rw\260:d\344%\230\365\003*\3027\207\377\356\001\356\033"
+	.ascii	"\362\346\001\340\227},ie\316\367\263X\033\031\250m\f\323\251"
+	.ascii	"\250)\350p\222\2630\362T\267\305\374p\333N\273588\252 \375o\347"
+	.ascii	"\002At\373\271z\226\013\234%\3402\006\320"
+	.string	"\346~\222\301\024\243$\\1\203?\306\354\220Te\211D\220\305~\242iL\332\215\244\341\3624\221\001F\273:\205\207\366\220\377\351\255\311\366\037\2043\243\0176\324e\227X\031\211\354\212\373\"p\252[\265O\316\230\375\323:\020\264\351\007\303\351\n\rNz\315!\020\207\213\330Hq\314\213O\376x\350\241\001\230\253\207\025W\232sO\232>\265\215\321>\213\214\b\342\263\336>+\224\224\351\225\204\274\373g\0052\344\016\201\327\031\310\322\327\021\312*\006\330\312\327\276\216\257\346uT\376&\325W\270'5\217I \025\217\351\005*8\354\r\340F\304{1O\375\231B\027\272\227\333\021A\343\025\337!\276\314\227\026\216\021\227h4\372\215\327\301\275\034no\005V\352\325v\225\246\034z\371@\343\252\016\244\242\230\271\223^JH\003}A\f\372\334\034\f\225`%\364\303\023eh\033\223\2540>\336\321qRi\245\322\322\274\022"
+	.ascii	"\r\254\255\202I\374\372\002\\\325\301\346\270\260\344\0263\305"
+	.ascii	"\322\202\205u9K\243*\201\347:R\203\317\231\026\2159\0303\320"
+	.ascii	"JZ\312\351\267\215"
+	.string	"\272%\300\tYuL\007%{\361'\002\252D\332\251n,\330\202\342\025\212\330K@N\031\027%2\360\376\241=\026\353)=1\245\372\206\347\237sB||\2611z\330.fc\224\001I\034jTT\355\372\310d\302\213\032\3176|\223\177,\007\274w\006\341;\262\266\327\377,>uF\241\322\3749\210\313}\324\020\2075\272\361\350\3742\2644\363\n\031\300(&ah/:L\031,\342\2549\304&~\227Y\255\027\022\250\342\350\271X;V\303:Y\320Q\035q\213\031\023C\242\246w\272\200\227e\344\246\320\255\302\252$\305\341a\b\241\216\200\001A\335\032`W\334\352\342\2214\342\213\222\276\271\326\200\255\242|\013\026\315hi\326<\301\2235.\371^\241\342(\367\311\013\363{\3176\225\205[[1\320D\t\354\025 \327d'Q~` \034-\272?\031\365)\3406\007y\251z\264\b\350z\033\300\344Xc"
+	.string	"E]\366\221\357\004\203\276\336<\313-\2508\271m^\361\005\351\002\367>+\214\262\0310ZC\313X\206m\371\007@\355AaCe\326\374\b\363\266\"R\321\242\035\246\247\267r\206,\024&M\002\205\220\357)Q99\031<\202+\343['Z$\371\245k\271\f\326Q\364\035#\365\\R^\220U\353\313\371=\240\207\023\274\241\221"
+	.string	"p<\333\316\3451S\331\236\n\261\374\314\354\274\214]\355B\036\340 \354\2206\275\232M\215To$,\242\017\030\364yr\244\0060l\240^M\304v\206\017f|\246_F\236\023S\207\306n\0178\234dWk - \272\205\016\f\200L\225\204\315\035\312\365\b\035\225\304\301ku\200\215E7K\033oDE\350\233b\265D=\243\b\336\002e\311\346\f\377\256\316\2327\013%!o\235)\355\016V|#\337\031\352"
+	.string	"t\\\205r\007\357f(\bMo\334\266A\205\226\263\305Kx\003\356j\020UO\033v\333\257|g\250\271s\177^h\300\016\021\226\265`O2\241\371IP^\267\220/\016\251Fiwv:\207\031\2465\303\025ve\312O[\303\222\362Y\205\346\3150Y\313\265\036fL\254\031G'\245\307\017\240\266=\267X\256\242+\202\240\232\240\374\220\325i\025!\227\214\326\254\373\333\rd$\370\275\371{\364\013\350\341~\316\245\262ny"
+	.ascii	"\033MJ\212i\334\210\001\273\fn\346p\004F\276v\271}\023\375\207"
+	.ascii	"\354\346\267\347\352\005,\353\001t\255\216\377v\320\222_\n\251"
+	.ascii	"\340&t\304\305\365\216\206\311\246\372\203\370\207\364Fw\270"
+	.ascii	"\225\270\253\205\244\3138%\032\367\344U\216\344d\326jGX\225/"
+	.ascii	"\263\034:J(\017\337\356\234\220\326\343\312\024\242\034A\301"
+	.ascii	"\216\331\314\247\211f(\324\354\355\017\345\330"
+	.ascii	"PM\006\230\006\370\222I08\247O'\257\265\350\f\334k\327\362Mm"
+	.ascii	"Ek\320!\215\305G_{g\243\243`Du\354\004\234\023\2534\350\364\254"
+	.ascii	"\3634\245\201\335\201@\0274g\206'$\254\005\316\335_i\024da\017"
+	.ascii	"\322\324\305\003\374i\203\246\266\262\030\212w\252\002\340i\270"
+	.ascii	"\300\323\021S8\245C\332\365Ml\257\257\313\246\361\364/\273\031"
+	.ascii	"\234\b\003\312\261\274\314^g.#\024\206a\007 \202\321\336\220"
+	.ascii	"a\220\374}B\337\207\034K\tK}k\366@#\267\234ML+-\nO\354=`\264"
+	.ascii	"^\201Qh\303\033\307!\361F[\271\211i_=\244%qP\036\005Nz\241\264"
+	.ascii	"`\250Ok\202\214\231e\275\035\270\004\252({\363\034\303\235\246"
+	.ascii	"\331RN\325\276\370F\277\246\232`&\240_\3431\331&\253T\317"
+	.string	"\323\005\024d!\275Tg\331\274\227\312j\270\347S\322\337t\221\323\236\325\030\312\251\325@QJR\254C,\007\034f\250\334j\016|\246pBz\002\213\365\245X |\272\213\3522\245\220\315W\241\231\00263\275\235\2340Cxf\266\205V\355>\353D\325\025\223g\323@T\374\\\273\346\350\352\247\246<\221\363\303E\204\271\246\0022\244\237\026\033\222\306\201\251\021\336&\004\004*\233j\313\335\331\323\312\300\256&5!,V\201Ks\032\313\025\222\226\177'\3510se\272\177\343\256\337\256\331\033\021\347\023\016\335zBGF\321vI\252'\013\253/fd\227 -b:^\223\033w\211\021?\346zi\037\b\272Re\201.E$\223&\310\365(\216\240\n\344I\220\"\223v\2421\224\021\246\214\007\373\3247\327\232\250~'\317;\317\224;U\222\023\246\233}\320\262\226w\317\203\371B\255\255$\276W<D\310\360\312"
+	.ascii	"K\235uh!X\220\300\025\0265B,s\265\353\035\235\240Y\2673}K\037"
+	.ascii	"yL\351\237\327\214#\006\004Ey\252\336\276\361\356\227\263)\031"
+	.ascii	"\322\034hY\256a\316\252\242z\344\022\370\323\365C\226\200\341"
+	.ascii	"\025\225\267\005;)\365;\273\366\214\b7[|\251\177DR\023\0070\374"
+	.ascii	"\373Ye\332u$\261\225\244\252\003\257\353V\273V\356\ryl{:2\312"
+	.ascii	"\341\234=\206P\211|l\243\274|\206\030\305]:\210\b\372\322\230"
+	.ascii	"o\252\34041\206\300u\2552%\232\344zv\224k<#\255\313\304z\005"
+	.ascii	"\360\367{\017\242(\"\241\267\362\375\353\213v\236J\215\267G\323"
+	.ascii	"\202\t\347\354\345\203\335u\036\330b\347\214Jn/\3701\227\002"
+	.ascii	"E\235\223\200\013\237\260\375\251\343:$;\250\202\245*\243\330"
+	.ascii	"\021\337\233\204\231$5k\306\301Gp)\250<**\302,@K\260\271\222"
+	.ascii	"2\314\340o4\252\233\016By\367\377\005\n\254\335\336\0053n\272"
+	.ascii	"\334gz\321%\332\264\242\354\33504\341\017\342\255_ \363\2565"
+	.ascii	"5\264q\361qN\355\203AD)\202!\f\246\023\016y\3726&\347F2\364\n"
+	.ascii	"\3633a\307\035K\355\335\363\034\365\241\336{\264r\253\331\300"
+	.ascii	"\263\322\357&\320\332#\244\371Z\327\037\377\222\251\262\234\023"
+	.ascii	"\227\316Bn\213\325K\037\200%\341L\033\017\320\252\360PO\n\353"
+	.ascii	"\246\241\203U\367\250\217\250\357\315UC\013A\321\274,\266\022"
+	.ascii	"\315\313\345\202\f\347(1Q\300QK\224\262\022\263{Z\257\345\214"
+	.ascii	"2.vk\025\320\215\376t\357@?\316\006\323j\300\222\016[3\321\266"
+	.ascii	"\n:\335r]JZYqrB\331\205\242\004x\346\344#}7\362H\235C\203S*\230"
+	.ascii	"[9\"\256}\353\302[\372\273(\302m\020>\264\211}<\325F&\207\371"
+	.ascii	"\343b\352\251\027=v^'\235\3170\231\341\n\271\246&\204\f\317\017"
+	.ascii	"R!j\216\345\323/\220\240 \202v/\334\210z\316\353\f\232\027\342"
+	.ascii	"\267"
+	.string	"\354\320&o\233sYu\331\223\327\032,C\001\256P\304\224'l\267\260\344RVO\021\306:\272\260+\017l7\243\346S<\215-\025d\352\263\213\032\274aU\031\032w>6>\340\372F\355jl\220\305\\\006\035q\\\201\212_\241\276\340\331\351\321&\352\026\265\272\213\224\3301\2411\255r\004\242\331\274\226ODC\213a\177\273\305_u\331\240\274\017lU\255\213\255\246\201\371\347JcB\226\021\324\366(o\262G\277H\253\277\216\270\255\356\035\314\321;\260!\340\342\036\035/\252m<\261\030N_\230\376\361\304\034\206\257f\236\022\004Y\327p\344\226L\276m\332\021\370\202\370\331\254:\264\203I\224\367\2553\232\033I\343'>p\035\rL\215\033\201\304vH\020\017\275\365U\216k0$\205_Lr\261\004\321\336eK\3361\036\274\003\024\3508J'\264\205dS\206\310\007\246\323py-\325(\335T\016\222\217\363"
+	.string	"!;\336\205\367\212\037\336\353&\363\300%ja\243pi\r:-l\352x\270\237\224\350!"
+	.ascii	"\361\320A\034\332\003-\362fM`J\366\f\221\252\2649>\b\321\222"
+	.ascii	"{\341>\241"
+	.string	"5\200\340B\366\312\005\224ms\312\2477\f\246\374R!\274uykr\013\002\311?\b{\b\310~\365\037&\364\323_\n\001m\243\031f\251\036\243\2143z\215\226ex05\347/:Z\370\253[9\355\203\021\361\266\302_k\266G(\361\031D\356\005D\362\232\f\223\005\020\230\3760f9\332\212\031\266\006\242k\211\202\261^\260a)I,r\221\207\005\006{\372\305\314\325t\037\f\327\311\347\201\263)R$4C\242a\b :n{\023\244u2\203\240\211\245\213\312\216\314Dq\264\311`mu#\243\246m\233A\305\b\337o\324\334\003H\375\265\031<\361\020W\0200H-\341:`\031\263\3667\342\244\314\273A\210\212\310\265\n=~*F\242\035\315]\2727\377\f\035\233\336\177\002!;1\264\342\261\213\b\307*Z\352\311~\205\367\354\002\362\272K\200\204\304\r\202\312\002q\374U\216\252\246\323\030]\303+<"
+	.string	"\272\267\250 \261 ^\243\277\260\240\371-l\323\027\270\237\003\254\277\017@\301\365\276@\332c-\206\323\307\356\023`\221\373\3143\262\007\n\333\007\327\3141\372~\343~\317\t\375\220\334\004\036\3406\034\367\305\f1\261^\232\242\242\241c>M\363\314\354\3653\013k\250\215\377\325\024UvO\224\275->\301\200\223"
+	.string	"\236\322\335\215\241\304\367\234\001\2236~\2504Iqa\256\253\334,(|\004F\207i\243?\035!\222\341x\037zn\003+\n/\t\276\n\300\024\b\325v\234\362\260B\207\020\370\221d\314J\320\240\177]*^\240Xv6S\250\031\350\307e\006\"{"
+	.string	"T\242\235\034H%\224\200\023B2T\372+o\336\035A\260\005\r<\303\354\232\013\323\224\\;\342z?s\037\305^\272*\331\270\226`\254\311_\312;\2346\245\241\243|\203\254\236\3763s<F\252\307k\337E+=F\314Ox\351\004\331\"_;\021#\225\346\013\236=K\316\311\373M\221m\024\220\202d?\272\245\243\221\327</\265C\355\004Q\\m\324v\t\241G\300$<\356\202\334aSZ\030Mn{\036\260|\342\247\221w\254\261\310C\333J\363\006~q "
+	.string	"\350\2738\237T\313\305\263\324\346\200!;\036\3613\360\004\371\3023\354,\343g\353\221w\270\177\235\210\340\333j&\315\030\n\316\231.qT\345\203\200"
+	.ascii	"\226\240>L\334\005\351\207\247\262W\336\200\204\345u\333\"\016"
+	.ascii	"\320\344\355Y\272\016\213\036a\261\223;~\357Q\207\0260D|\320"
+	.ascii	"|j\2046<\002\250#\326"
+	.string	"\277\374\2171\2567?\240\334F4\2178\316x\003`\213\312\re\036Q)%+\261\300\313\324y\320\0324\377d1\265\2173\301\275\275>\346\301$6\035\352V\025\033\367+XM\204\350GN$\222)R6\273\333\326\221\244\334p4}\304\274@\373\244@\2306\036\304\375<o\032\037\244k\377\235"
+	.string	";%\230}J;\\\365W\223\236G\316\331\001P\264&$\261h;E\325\305.\355\320(\211\201\311\263@\025!f\253\342&\254\332\"\357\252\"\034\003\347@\240\263\361\030Le'~]\2509\205\300t\314\352\342\220\222\177\365\317"
+	.string	"\365a\3366\001\272\252R\272\351]R\264_\005\034N\025\r\2473\304\272\023\264j\003G\264X\026}\257\361\301\f\374\037A\363?\353E\250\321=S\300MZ\263d\242g!n\027\332\220\036/"
+	.string	"\206\323\tr\363iy\246\327\f;\266\306\0164=\326\361\025N\033\262\361\236\362/,\fo U]Y<\363r`@\337]\3659\207v\255\217\316+NF\314U\201\0205c\203/\266\370\353\357\031\261\207\353n\353\276E\257q\334\252\372\341^\273\265=\377\363"
+	.string	"|T>`\214F\330\240\304L\337\2725\356\325,\030\301\277\002L\237\261\260\202\237M\306\311\313\004\330\253\250.\303\372\035\376!\355\020\002?8{\200t\216\035\226\203WXG\236\210^\260.\224\032<\276\351t\205D\001v$\310\303\367X\350\023'OP\303_\250\202\247\204\031\276\3274+\364Lh\260*\265R\363\230\344VC&#8\241\002\b\271>?c\365\004\323\017\227\311\314\307\034i\241\260["
+	.string	"\331CZ\200\3019\231\001\265\242H`\004\034Va\204\302\305\313\303LgL\251(\362\275{\0308\232Q9!\214\026n\357\211DD\350\254\320\330pl\251\303\337\234\322\b\017U\003z:\032\252f\277'Q\016\250/\336a\245\203PKaB\214x7,\021T\372"
+	.string	"N\350\257$\334\213Y{\360Nz\307\224;76\3432\203\"\021\320'L\364\377\343\204"
+	.ascii	"\347+\341%\177\276\0226?\351\321\024\177\225t\265\2013\352\336"
+	.ascii	"\2626\360Cw>\013\302\006\204?\202\243\315\3745\253\253\t\230"
+	.ascii	"7\206\345\303\353\233\3470\003:C\212\333/\330Y\267\300ad\276"
+	.ascii	"\312\3349T0\315\243\361\341\267\031XW\261\272\243\250\251$q-"
+	.ascii	"\303\031\331&\265v\\\251/:\367\364\027\216\033=oG\333\243\344"
+	.ascii	"\276\315\016F\271\322\311\211\031\033\350\017\336%\333\217\234"
+	.ascii	"\361\240^\343\374kB?\177:\016\324\327\311\231W\277\344X8\315"
+	.ascii	"9\371\320F\030D\357\235\333\017,\026\220\360\365\036\337R\314"
+	.ascii	"\354K\027\017\246\373\020\236\233\236\\\357\227\202u\371\375"
+	.ascii	"3\223c\324\332\205\210\370> \261\372\324\375H\246w\024O\005\264"
+	.ascii	"A\245y\n\016Fv\256K\277\375\363gX8A\365`\364H\263\372N\255\207"
+	.ascii	"\177_\262\314\213nZ\023:\037\233@.\366\326\274\360\30472n`\252"
+	.ascii	"\007\304\302\350p\375\324e\377\217\211\2343\201\t&\216w:\207"
+	.ascii	"Zw\261X?\364_\013\n\206\251C\344\357\210\033=\255\245d\337~m"
+	.ascii	"\333\363t\030\251\373\272\363\366\357\360\031\257\242\234\211"
+	.ascii	"\377\303\327\342\323\370\257\232\035\246^{\365D<sM\323\375'\177"
+	.ascii	"kr\007\242\341\032P\314/k\315\303\213f\\\324G\343\036p\177e{"
+	.ascii	"+9?\340\262\370\226\347\314\207\032\007@\032R\233\335x\205\217"
+	.ascii	"l\375k\306\276{\177\310\303~\375\333\357\265\374\177\002\035"
+	.ascii	"\257\315\343?{?\315a\377+n\232\242f\230\324\326\263m\317\304"
+	.ascii	"J\007w\363G\363T\262w\312\321\325\226},\251K\234;\353\340\321"
+	.ascii	"\373\376n\235\360M\0300\262\234\355w\276\202\354\310\311q\240"
+	.ascii	"\2731\272\0053\377\342\306G\210\037\232\223\t\320\345\0038cU"
+	.ascii	"\255=\321@\227Lqt\274\237\246\336\333\250\034T\316?\331\2652"
+	.ascii	"\372pc\336\231\323\341\303\364\374\342]i\364u\3550\354xH\003"
+	.ascii	"\347\234\314\324\021><,o\2736c\037\353\323-\273G\363~E\256\237"
+	.ascii	"\257\324N\n\377\252\362\207\273\230x\266\340\033\264\306]\346"
+	.ascii	"\235\231\271\235s\027-\367\n\347\004\324\036\220\215\331f;h\255"
+	.ascii	"\371s\257u;\037\243\377M\027r\031\371\231\236\345\002F\265\273"
+	.ascii	"wF\354l\243\202Kn\337\243\231\207J\016\333w\3162M,\355\023\256"
+	.ascii	"V\255\223>B\316\325Y-,=1\177Po\376\356\017x#\356\315\362\017"
+	.ascii	"\220\306n\263]\334p\267\323t\200\331\2536\365\246\206W\351\036"
+	.ascii	"\331\221\310\206)o\233\274.t\247\031\365\305>\236\246\030\225"
+	.ascii	"\366\007\267se\366w\227\3103 >\036\207\257\3758X\376P\320\361"
+	.ascii	"W\365\201\237#l\366\203<<i|%\271\303\r\234\177j~\337l\256=\246"
+	.ascii	"-9\366\245c\332\027x\343\"L\006\364V\351\260\037I\375\356\017"
+	.ascii	"d\331S\224\267\022\267\326\345\237ON\236\361\026\273\257r\361"
+	.ascii	"\361\265^F\256\256\206\227\2018[\350\326\252\257'\356\234\204"
+	.ascii	"w\323\261\313<\275\322\361\321_\027\210\374\306\357\277\331\\"
+	.ascii	"\365\343\205\323\363m\310\353\\\356\361\365\330\321\211\356\206"
+	.ascii	"\334\347\363+\373\330\037}\377H\310\0264%f\tfR\307\316f\215h"
+	.ascii	"\262\334N\322\315\311#\245\263\210\363\331<\\P\325$1\262\205"
+	.ascii	"\355\351\007F\230\n_;\252\222W\356o\302\250\027\327\256r+wL)"
+	.ascii	"\032\035\362ZoX\023>\254\371/oxiC\337\323\321d\211{\305\263\337"
+	.ascii	"\032\303>A\305\246X\314Y9\202\254=\356\2036\376\323\354\247^"
+	.ascii	"*'\016s\306/\236\260Da\025\277\017\252\273\275\244\307k6\362"
+	.ascii	"\371\373\255\215\200\366\035\235\333\311\266\t#\276\212\341\363"
+	.ascii	"H\372`\3729\017\277\255\374\251\b\353\237\334\001\007\260\f\204"
+	.ascii	"m\022"
+	.string	"[y\306\325c\340\314\217Mi\250\234\337\023aN\224\231\f\365M\332\276\f\276\311\030\266S\t\216\267\264\347\304\326\244x\226\331\007\306|C\335\313I\213\256\345\272\310\367\356:}\241?K\356{\252\231\223\361\341A\354r\365_\374\347\245\274?I\377\002PO\346\363\021\177'\346G\342C`7?\364\357\311\231\332}\220\240\235\3461TOH|\357\202\363\211\310o\204\333#X\034\315n\020\315\254\233\356\241pBg\002W\334\355\251\177\027\177(&v\177v\024U?$\331\217X6Gy-e\1770\251\375e\365;|s\343k\374\262\\\207{{\353a\256I\302\223\007|&\374L\241`3\026\276\036\306\221u\300F\374\n\336r\022\236\323\302\217\320n#\370Gv\311\200_\001\314_Z\353;\341Z\224o\334\334\212\357\351:\327\237q\274\277u\320\276\022`\206G\255##\333\261\374E\343\007\314O\314\216\272n\251"
+	.ascii	"\352\362\323w\023\222^\306\343\340\317y\362% ?\374j\300\333\311"
+	.ascii	"\277\3039n\345\306\356\345?4\377,\317\036\230\373`\274\224\356"
+	.ascii	"2\2718\245/\337\307\037[\266\213\255\370?\272\374\353\341\234"
+	.ascii	"0\221\177>\002\363|\241]-\rex\003\b\256.^6\373X\t\313J1.\033"
+	.ascii	"w[\315\315\370:\346\233\016l\n\315\213\026\017\027\365~\307\263"
+	.ascii	"\336G\003\003\003\376\275\311\232\337\333\215\363y\317\303\213"
+	.ascii	"\310\337r\025Y*\376r\201\257!\377T\227M\353\342\007\363\334_"
+	.ascii	"v\267\235\357\214v\360\027\303\316oq]\346\022\030\337\016\335"
+	.ascii	"#66~\342\301\306\213=do\377y\305\273]\020\315+\334Uh\376R\227"
+	.ascii	"y\225\350\355~K,\336U\f\234\302"
+	.ascii	"\362k\372\243\222\347\213f\263^\220;}\360@z\246\221\376\306n"
+	.ascii	"W"
+	.string	"\036\363\177\256*\216\205g\314\035\301\315\236n\232\3777\376e+\377\362\3547D\037\034Fx\342\260\222\300 \274\303\274\357Fsg\367o\020nY\365\302\332us\3453\363\333\332t\267\023\273*\363f\f\277A\237\246\356\t\031\036\200\335\325#\253\300)\265t0\370\021\357\344s\02563\037<\361=Nk\206\267\335\3079\360\264\3613\310z+\374\217&w\213\234\331\252\375R\356\315\212\275\256N\351\303o\323\017\265\030\221\225\353Y\365\307\303i@\333q0\255\365=\313\037\367\217\217\341\253\227\264\367$a\236c\257o\257_P^K\356\031\320\375\263\224_\250\177J\034\202\307\365~\242?\3030|`\331\331\324\246{/\221\301\026\177\353!X\337m\3578\007!\177{\262\300\222\247fI^D\036CSZ\312\027\215\\\226\357\360\236\2317!\346\307;\373\037_o\222u\317G\317G\375\351\003\277d\235\314\244\023\243\346"
+	.ascii	"cM\214g\353\232Z\376\317\331\365\342\201\370\371\237\231f\324"
+	.ascii	"\370\222\357\031<@\371\335\315:\026\353#1\035\237[\200iP\t-3"
+	.ascii	"~\321^=B\1778\373N<A\336\335\2168L1\350\275\003\327O\203\360"
+	.ascii	")\366USm\371\337\314\314I\331\304V7\201\211\314\036\241\250K"
+	.ascii	"\031o6\334\211\357\333\334\315\202\211\333#\257\005\31770j\310"
+	.ascii	"))\013(\305\317\312-\366w<\377\307|\331\324-\257\007\332\364"
+	.ascii	"\205\r\370\377\220\373\264\336\017\037\261\332\367\274>3\374"
+	.ascii	"\035\277\377X\240\257O\357\313\036\320\347m\354\213\016-\265"
+	.ascii	"f\214\260_gQ\350\223\361m\345\026\022\371\356\347\263\350\365"
+	.ascii	"\210\243\354\365\302f\314\233+\375\213\357\310\022\037\257\333"
+	.ascii	"\"\240-\357as\376\332\023\343\273@E\370\255\245u\261y\243\336"
+	.ascii	"\220\252{;1\001\375\005\276)\323\350S\226W\243\272\344\035\237"
+	.ascii	"\361\373\007"
+	.text
+	.section	.gnu.lto_.symtab.1410747af71ffc8e,"e",@progbits
+	.string	"afatfs_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"afatfs_isFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"afatfs_fseek"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"afatfs_ftell"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"afatfs_findNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"afatfs_findLast"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\004"
+	.string	""
+	.string	"afatfs_findFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"afatfs_ftruncate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"afatfs_funlink"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"afatfs_fclose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"afatfs_mkdir"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\004"
+	.string	""
+	.string	"afatfs_chdir"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\003"
+	.string	""
+	.string	"afatfs_fopen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"afatfs_fputc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"afatfs_fwrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"afatfs_fread"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"afatfs_feof"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\004"
+	.string	""
+	.string	"afatfs_getContiguousFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\004"
+	.string	""
+	.string	"afatfs_poll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\004"
+	.string	""
+	.string	"afatfs_getLastError"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\004"
+	.string	""
+	.string	"afatfs_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"afatfs_destroy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"afatfs_getFreeBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"sdcard_writeBlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"sdcard_beginWriteBlocks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.string	"sdcard_readBlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\004"
+	.string	""
+	.string	"fat32_decodeClusterNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\004"
+	.string	""
+	.string	"fat_isFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"fat16_isEndOfChainMarker"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\004"
+	.string	""
+	.string	"fat32_isEndOfChainMarker"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"fat_isDirectoryEntryTerminator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\004"
+	.string	""
+	.string	"fat_isDirectoryEntryEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\004"
+	.string	""
+	.string	"dateTimeUTCToLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\004"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"fat_convertFilenameToFATStyle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\004"
+	.string	""
+	.string	"sdcard_poll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1410747af71ffc8e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
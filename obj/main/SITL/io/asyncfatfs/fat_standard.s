@@ -0,0 +1,405 @@
+	.file	"fat_standard.c"
+	.section	.gnu.lto_.profile.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 c\205\002"
+	.string	"\024\004W"
+	.string	"\007"
+	.string	"\215\274\256\204\016"
+	.string	"\001\302\267\212\250\f"
+	.string	"\002\325\244\360\325\b"
+	.string	"\003\234\347\323\341\013"
+	.string	"\004\263\274\214\204\006\002\002"
+	.string	"\002\001\005\350\304\371\277\005\006\271\345\257\313\n\016\002\003\003\002\003\002\003\002\003"
+	.string	"\005"
+	.ascii	"\200@./\316\270]Z\201A\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 Y\235\001"
+	.string	"\360M"
+	.string	"\007"
+	.string	"\001\003\001\002\003\004\001\001\002\004\002"
+	.string	""
+	.string	"\001\001\020\001\006\003\005\006\002\001"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"_\2078\002\201\305<\025\f\001\343\252\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\365\003"
+	.string	"\002\206\023\036\240'\351?\366?*n\325\370-\027n\350\375E\243\324\005D\020\001\261\037\215\220\275\245L\001\013\022\237I\375\206z0\026\215@\237\207B\216\204\002\260)u\355\016hVh\331\252\2066\241\367\236\232G\334\035\372\372K9\347\251\273;{d\246\022"
+	.string	"\254\315\243\332\203]\204<\262e\250\232f \034\326\210U\r\023"
+	.ascii	"1\260&\340\274\200\223\001\217`%\267+6\\\304\3543\270\002\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 n]\002"
+	.string	"\204\003b"
+	.string	"\007"
+	.string	"\001\001\003\177\002\005\001\006\002\003\004\001\001\003"
+	.string	"\002\001\005\017\177\002\002\177\002\003\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\377\001\001\002\001,\006\325"
+	.string	"\001\377\001\001\272\001"
+	.string	"\007"
+	.ascii	"\352\034\007\212\001\200\031\f\006\246\251\\\271\2016"
+	.text
+	.section	.gnu.lto_.pureconst.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\205\004\005"
+	.ascii	"\205\004\006\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 n\325\001"
+	.string	"d\002b"
+	.string	"\006"
+	.string	"\001@"
+	.string	"\001\003\004\001\300\005"
+	.string	""
+	.string	""
+	.string	"\001\002\007"
+	.string	"\001"
+	.string	""
+	.string	"\001\b\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006\002\024\270\006"
+	.string	""
+	.string	"\007"
+	.ascii	"Ne\232'\030(\253\002(.\360\002\247a\200\005"
+	.text
+	.section	.gnu.lto_.lto.553103402b53277a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fat16_isEndOfChainMarker.3.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"5\b"
+	.string	"&\020<9P\305&\035"
+	.string	"!\332e\274\316\200&\272O\357TK\322(\027aw\216\356\264Q\353\326\350-Y\216\304\362\021DJ\246\0307\023F\337\335\366+\bf\225O\303P#\204\310\235R,"
+	.string	","
+	.string	"("
+	.string	"6C\303\307 \003\f]\t\031\221"
+	.string	"\330\375\242z\034t\b\362?\362\004\016\026R)txy\330]CRI\343\326\333F\260\ra\373#)\030\225\335\214T\200E\261N@l\177l\001\333\n\355\237.\3629\312ckw\243\304d\367[\260C\300-\202\027\\\267\3401\327-;\334\214\376\366\325\252\311zp\241\"k\252\345\236\353\n\365\243\223\b\246\354/\004\265\303~\265\273k5\331\206\206G\375\257.\0013\233\340t\"f\346u\035\nl\300XF3\245f\223^'\341I-v\232'5l\263\350d\3446q\333HN\304f\0273\n\346*\262\031=.\006"
+	.ascii	"jDa\231\030V\025\306\\\243\2338D\354\\\363\t"
+	.text
+	.section	.gnu.lto_fat32_isEndOfChainMarker.4.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"U\b"
+	.string	"\006\220<:@\3056\035\340\345\255\354,\306\377\213\034\346\226I\017\207\300J\327s\002\344\030\213\257\221\033f\344\212\t\234s\"\023#V\\N\310\237@\r\032\005!\273\320<\366 \021\262wJ\001,"
+	.string	"+"
+	.string	")"
+	.string	"np\350\354!dH\226\222\320\b\200]pJ\217{\217\236\177\221+|*\242\321\3471"
+	.string	"bw\035E\243\215[\336v\202\355\b\333\037\001)\273\032a\200]\241P@lw\366\200\355\030\355\223\036\322\275\344\361e\227\303\344d\027d\360\203\300)\314\017\252S\323\013\252S\266\003u\032\334O+?K\f\206\004\331a\030\266\334S]F\371\020\t\024C\033\374D\331a\177\332\335\265\374\034_\372?]H\f\002\365\242\340t$\352\305m\235\n\213\300VFS\251&\243\3346\301Qln\030G1+\273\330\350\32463\333P\316\264\35263\013\326,\256:9M\013\007"
+	.ascii	"lDq\231\030\\\025\034\227Q!\215\321\304!b\347\232O"
+	.text
+	.section	.gnu.lto_fat32_decodeClusterNumber.5.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\335\007"
+	.string	"\022\01776`m\322\001@\203Haov\031bS;\354\031Q,8Wg\214\242QC\027\303Fv#q,\002\221\222\215\340\341\225\260\247\354!\025\325\327}\003=\b\331{\247\024\324z\330p\032\250\265i\034\210j\300\025&Cg\006\233\233\346\260\315Kj\3276\257\n\223\320\246\3144\022\323\314\215\254\250&1\007\316\",*\267,\243\262\333\307\205#x\231\200\037\273\326Z\317Q\207\017\036d\361y\325\356<\017\222\354\307\205\243\367\322\377X)\261\230\354R\324\224%\231B6lw\354\312{\211\263\300\356\305\b\310n\207`\205\200O\266}\216wt\314\305.C\224 \002\372@\331\355\344\345\026\352S<\001\365\tb\234\373\343\374{\334\200t\022\022y\376"
+	.string	"\026v\327/$\252\270\341m\027\330f\260\255\021\n"
+	.ascii	"l\210\216Y`\272p\235k8\303\004&\351\r:X\ne\031\3603c\247\235"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_fat_isFreeSpace.6.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\305\007"
+	.string	"\222O87Pm\323\001$\243\346e\243\360m\255\3310\240\214A\003\240\032\273hc\r\275&\016\334\266{&\330j\211L\fWET\247\004\024\306\036\2011K8s\251\323\204\354\235R\024\223\340t (\306\325\316\304u\361\225\321\320\251\321&W#\270\231\311\232q3\273\264\212:\345\266\221\332fr\344E\253\314$x\243\300\250\344\266\215J\313\2677\214\030\213\b\262\357\261\036a|\310\004\202'\373\373\300\310a\237\332\335u\3340|\351?u\031)(\331\3058\255\354Ie\362\260\335\331\026\333\020\332\3778H\367\222\307\002\273\032%\222\335O\301\r\001\2570'\260^Q\037\260^\331\366\002Cg\317\340\"\246\240\204DTv?\031;\356\035z\376C\216@2\021\215>\207"
+	.string	"\016\273k(\032e\334\361\266\017l?\330&\005\007"
+	.ascii	"2\003\202aRuq\227Q!\215\321\304!b\347\232O"
+	.text
+	.section	.gnu.lto_fat_isDirectoryEntryTerminator.7.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"m\t"
+	.string	"V\222C=0\345(\035\200{=\177\360B\267\245Ai\2419 \0217s8\330_\260`I;\362[\375\376 f\020\200\210\022\256\375sCA\241l\030\365hGB)\344\003\312\035\337\006\331D\356\224\0022"
+	.string	"0"
+	.string	"2"
+	.string	"2\363\203\354\322\266%&F&-|h"
+	.string	"\001\250\026\002\273\341T\222\223\036I\376S\3560\300%\245*=\022`\354\256cJ\025r\353m7\330\276\260\035\023k]\031;\353W\215\276,\020Qx\355\202\274\f,\214l\231\330\036\331\032\3331\332?9\312\350,\321\rvW\005^v\303\bWd.\035>!{'\373`v\305T\017\240Z'\033\342,\340\306\265\273\026\266\367\025\216\314\356R\250xt \270J.}Qvy\335"
+	.string	"h\231\342\313\016KQG\354c\273\033`\367m\037\351\016\307\323i\236M\373\274\214O\003M\017\364i\240\316\006z\332\344Bs\013i\032\263\323y\223\363`n\343\323\315\217\343\272\251\t\367\330\352\nS\006\223\006\n"
+	.ascii	"2\241\013\034X\317`\265\212\026\023z\351\005\306eTL\303\0359"
+	.ascii	"\204\351\\\223\f"
+	.text
+	.section	.gnu.lto_fat_isDirectoryEntryEmpty.8.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`P"
+	.string	"M\t"
+	.string	"V\222B90\221\322\001\214\0028W9\327\241\245&\244\305\245:\f\rk\211\222\364\351\331\366\3727\200\250\004\200\201\201\367\267\2734\0244e\341\234\331ZWN\205\330\224\274U\262\311\336)\0052"
+	.string	"0"
+	.string	"3"
+	.string	"s\363\001\355\323\266\033\034J6\031hH\227\031\325\211\314nH\245\307M\217&\377#_\210\201Y\261N\217"
+	.string	"\023\273\353\270bq\334\362\266\023lK\330V\tk\331rv\327/e\364g\300J\001\313\356F\214fS\346\013\304v\311\346\330\216\321~\310EJw\221.\260\333zA\331\r;\206\330|:<\201\366)\207\016j\227\231\2345\252W\312f\270\t\330\201\355n\204\355\275\344b\263\273\017$\031\030\b\260\217O\237\244}^vZ^\250\030\263\303S\224\035\366\263\335\r`\367m\241\351\217\007\324U\320V?\217\342\253\"\352\211\276*\372l\240W)7\242\333\250V\320O\347Q\217\2029\213PG?\216\353('\334g+[\231<@\311\n"
+	.ascii	"2\241\013\034X\317`\265\212\026\023z\351\005\306eTL\303\0359"
+	.ascii	"\204\351\\\223\f"
+	.text
+	.section	.gnu.lto_fat_convertFilenameToFATStyle.9.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`\316\005-$"
+	.string	"\nB<\016G\220\232Q:\205\b\257kBI\032\353D\255|:\366Z\262ZaQT\3253\250\006.\276<\016\206b0\210\216K\032\013\fFU$\006Roi$x5~\334\345\027\330\271\003\222\374Ba\265o\3777B\b!i'\031\323"
+	.string	"\306"
+	.string	"\311"
+	.ascii	"\225X\"(\207Nq\245\f\\w\315\304M\242\354\304\204{P4\007\232+"
+	.ascii	"(JL"
+	.string	"\332\004\247\311%\332\2474yZW\232\334\215\332mc\"\017\324\\+~]uP\024\345}\307\177\334\236\036\211^\363Q\316\341n\266\032m&;\315\222\034_\243\326[\036\220E\247*(\345\334\230\3431\036\310\2528\035V5|\263\231\fnX\321pm\fp\306\270\373\222Qi\265\206gD7\254\204\226\215F4\272\274\360\030\240p\364\021\203c\215\267Ld\004\210U\317\321d\0014\3431\300\253Q\001\0347B{\271\246A\024\325,\022\303%\f\223\263 \f\217\267`\212q\207\242(-8Uo/\033]\215U\005c\270\232\fP\024\335Z\025\264\362\366x\327\nv\367\301.\271 \033\242$\357\304\245f\252\336\331\361\365\344\375{\2414\336\037J\277\376y~YP\324\261]O\231\360\341\004\2626Q\232\364\355\345q\tV1\025\236\250c/\262\260\203\345\037\356\022\245\352s\300\241\"\262\317\261\233\204dTd\240"
+	.ascii	"\001\023m\";\261w\002\\\364\016\271\313+\024\004\364\343\023"
+	.ascii	"@\007\200\254\333S\326\315\225uqd\335\233\235xm\257[{]\032Yw"
+	.ascii	"V\326\225\225uO\262\256Y\216u\311\261\356h\242\367c\335\372\272"
+	.ascii	"V*\361\210\t\242\203\242"
+	.string	"-\306\360\240a\310,C\\\264\273\276vS9t\nG\020\"\206\262\366Z\332\232\313Q\242\334\265a\247\024\360,r\265x\203\242\350\221\311up\232\334\215\225\266\273\001\347\277\262\277<m\2572\002\017\360t=\263\235@\026\341\026*-\335\217\342Pf\002\375Ow4u\267=\255b\332/p\245YO\311\360\341\244\335[\036\215\b\301\316\017\327\344R&]D\021\261zd\241\247D\216\264)\221\276\225\350@O\267\004\360\035\353\356\272\247\033V\n\235\247\342\211G\024EQ\363\303\265\227eZG\254\220F\337q\324\035\300\323]$\013=\351$\256\306\250h 0\320\221>\001\213N-\021Xw\243S\300:C\2455\273\253\342\234\250c+\373\354\017\243\325\363\273\033:TW\311\276\233\272\324\232?\3772?1\337\274\257\260\300\374\304\310\235}\345\032,\202\357\206\246Di\322\264Q\245\316\034\223)2A3~\030Ln"
+	.ascii	"\325[\242i\350\320k\322\300\201i\351\\\fJ\031\234z\031\232zP"
+	.ascii	"O\026\240"
+	.string	"zK\274\247%\250\336\022\206\246\021O=\236\217\211\327\304\324\353\300\303\340\364\304S*Z\237\007\rN<(\237\317\211G#\242\336\362\351\225'\314\211\243\330\334\207;\007\311\227[\221\200\017=\325Jb\345f\340;+\037\364to>\337q\026\340?O\223<t\336\212$\266\311D\301\"\342\276,S\222D\210\255\300w\254\375\334g\350E'!t\023t\003\247\220u\346\366\363\002\257\220\325\363\334{~/\270\334\355\270\237\315O\254\366\333-\314\002\373\211\331>\274\3425\030\004\037\216\207YdK\2359\033\326C\312W\355\303\245\342\332AH\250}HN*\364\241\305\005\220\366\341\326\363\310\376\362Y\007\311\027\331\221\005<\335x\250Q<\303\2143\b\241\231\021\221\240\205Is\220\002\2312*\017\020hW\333\024Z\003\303]\r\021,\321\001D\264\336a\271v\201\253\270\r\374\270\354\333l\376\260\021\356e\217i\335w\254"
+	.ascii	"Q\003\327\200\235\037Ww\212\0170\244\274\370!\f}\263\312@\321"
+	.ascii	"\356\346\272hxM\305b)q\364H\221\251!\354$%>\032\346z\025\213"
+	.ascii	"\314\016)\002t\212\247`\004u\314\345\023ck\b\242\004\300\006"
+	.ascii	"b\342N\301\301\305\241f\f\025\2454L.\202\350s\341-?\310e\345"
+	.ascii	"d\320\315Zn\020%,\240\3061\013\365K\004\347\232`\245Q4\213\027"
+	.ascii	"\334\016\360R\b\246\030\225\0164)Hy\252\240l\211\377\026\364"
+	.ascii	"\361i\322b\337\"c@(L\n\323\267s\260n\340\364\352m\303<\275\226"
+	.ascii	"_WF\375*\232\006p\357<4<\372Y\225\253\3317_\254\347\315\016\025"
+	.ascii	"i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 \336}\003"
+	.string	"d\005\332"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177\b\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\004\177\t\005\177\n\006\177\013\007\177\f\b\177\r\t\177\016\260\206\3618\001\n\177\017\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003\006\007\350\274\307\343\001\001\244\006\003\006\007\310\311\251\325"
+	.string	"\001\244\022"
+	.string	"\t"
+	.string	"?\205\3003-1\235\001\337"
+	.string	"\337"
+	.string	"\337"
+	.string	"\337"
+	.ascii	"?\\k\216\001"
+	.text
+	.section	.gnu.lto_.refs.553103402b53277a,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.553103402b53277a,"e",@progbits
+	.string	"(\265/\375`l\013}>"
+	.string	"Jp\260\030CPdR\007\3057\256u5\2637\023\272\035msp\215\256+nO\324Q\245\r\342\r3\325,cH~\261\355\253Mu\276)\265F\001\300\036z\263\241\221\020\276\225\303N(7G^\325?\336\354\330D\246\024P\001}\001\200\001k;\036\233\277=O\367\021\222\\\241\037P@l\273\034\333~\247\333\347\270\034\227\272\370_\376\377"
+	.string	"\2521%H\262\352u\202\355v\234\326&Z\374\277u\n\234\367\226U$4l\222\207a\233\215\224u7\376\306\243P\016g)\021\225DyYm\177c\333\241V\337s\250\265\035\t\333til\3331\331\276\301v\027\333X\354\204\024\254\203\3610\036e\340b\332\273\270\227.J\306\037\377\307\277\334\206\250\213\226\2546\t\266\235\301\352\333\333s\006k[\261@\177Z3\031\177Z\023\370\323\252\272\323\n\234\363\247\265=\352Z\272\335\212_q\251\017\036{~\334\177\334\024B\n\020>Y\365\330\263\264K\035KSYh\037R\372\321\377wi\205\347\177\322\245?\275\377\344\317=\312=J}cs\342eU\233\002\333\261?\255\254;\255\355UZ\200\364-tf\273\335\001\204\356\206\323\335\211\016\264Rw\376p\241\273\003u\267\035\243\356l!@\203\334\235\027\370\2723Tw_\271Qw\253\335\371\251\333\037t{\224\033\350\366"
+	.ascii	"\335\016\240\333\231\272\035\251\273\365\272\373Ow\213\351\356"
+	.ascii	",\335\336\335\275\327\335\210\272[\332\335\300\356~\323\335\354"
+	.ascii	"\336\336\336^\267\037\350\316\307n6LN\030\316\323\t\204\247I"
+	.ascii	"'\274\\s6\271\271\265\251\211\321\2413\306\001\301\313'c\252"
+	.ascii	"%\233\30098~>\335\277\307\205}S\301\277\332\263I\227\364\341"
+	.ascii	"d\224sdJ0\311\247\307\377_\200\251d{\376r\016\206\362\374\207"
+	.ascii	"\242\334zf\005d<\367J|\016YD\355\307\302\376\r0\377\221\376s"
+	.ascii	"\377\217\374\177\243\246Z\374\237\006\204\241L\346?\032\001\346"
+	.ascii	"\253!\313\204\375\347\270=d\234\360\224\355\031,\263e\n\375\034"
+	.ascii	"1\322\241O\267\326d\247\310,?\026\210\205:y\334!\345r\035\271"
+	.ascii	"1e\376\275_\025\263#nq\364\250L^\224\036Y\355\366D\210\\\n\363"
+	.ascii	"\315NV\t(\311\341\325\211\302\345L\"h\032\275\251\3379\037\257"
+	.ascii	"\343\002'f'g\016\317.\356\013\016\035P5\335\3015yP/h|\f\223\023"
+	.ascii	"\370K%\"\350\0252l\0168\330\216Bw\360\316\351\370\035_\f\025"
+	.ascii	"\241\245\316n\032\307\345\230\220\300W\3261\004\375\217\0179"
+	.ascii	"\236\017r;\327sB\236\347\205\034\220\007rC.\310\243~\347x\234"
+	.ascii	"\316\365\370\236\366\370\341v6\335\301n*\013~\347m\\\316\027"
+	.ascii	"C\215\270\260\035\262\373\217\333\313t;\\\373\235\233\3611\276"
+	.ascii	")\364\227\3129\033\354\254)\213\202\367\037; \340\300A\005,:"
+	.ascii	"\330\f\250\336\307\375xT\312\377\264oq.}\264\214\177z\204'P\220"
+	.ascii	"\270\254vF\262\355R\353\317\245\002t\316\260\335\271\b \267\263"
+	.ascii	"%b\330V\267\b\021\222\211h\320\302\264s5l\201\312\236\235\211"
+	.ascii	"\364\037\244#p\350\322\262\232\207\344Wb\342'\307\034\244O\032"
+	.ascii	"\035\204%\211\232Z\036\023\024\274\264=Ym\225\354\354,\247\221"
+	.ascii	"\370\203&\225\304%,\371\366\243sZ\322\027\267%]2ZR\223<f\020"
+	.ascii	"\264\354#\351\211Y\021\037Y\365\341x\234\256\373U\270\007\222"
+	.ascii	"/uff\231LO\332\031\336\017\320\233\262MN\263\231\3132@yc\267"
+	.ascii	"\364\004\356\007\323\331\271\314\353r\227\037\204\314\340\306"
+	.ascii	"\3062\031\033#\350\222v6%I\257\217\031<fg\262\245ApsW\262\332"
+	.ascii	"\203\274n\215\263C\357PV\333\347\306vNfe\347e4/\263\230\243\275"
+	.ascii	"oO\225\2643\274GS\223j\363\374p\203\243\263X\206\225\376\300"
+	.ascii	"Z'V\226'\253\031\3169G\326\321\031\316aJ\313\217\376\307\031"
+	.ascii	"V\377\223\356QL\356QEi\230$\265\254jgDl\017\3621\335}\244by\202"
+	.ascii	"v\304\016\333\271{\375d\363\377\313\212\342o*\225V/r\227\352"
+	.ascii	"^r\237+\370\357\b}\376\231\270\tb\237\214I\002\311jw'\370\236"
+	.ascii	"\362\217l\372\370\233\360t\r\t\303\321q6\305Od\300O\213<\034"
+	.ascii	"\2579\325\347\347\217\337\177\271\346\224\001\307\317&\034?\221"
+	.ascii	"\300_>\221\377\261\023\b\307%\221\016O\327\234\360\364\351l\372"
+	.ascii	"\345#\177\232$\302.\237\001\275%\241\365\002{\207N4\214\356\326"
+	.ascii	"k,\032i\t[.\265u\277\274T\267\365\362\3722\276F-\027\330\273"
+	.ascii	"\342\252\203\b\343\225\210\327mg\024\215C(\260\327\253+\204\361"
+	.ascii	"\025\026\211]n{\205\240\035\n\275V\264\255+\342H\374\271\355"
+	.ascii	"\213\256\257\023m\226q\330f\025\240\242\300e4z\300*r\333\030"
+	.ascii	"\256\320D\221(\334\372\240\205\"\253\030\342H\024j\021\350!\321"
+	.ascii	"m\213-\f\266+TE\250\262\252a\324V\030&`\230\260\266\025\206`"
+	.ascii	"\020CU\220\355\252\240\257\267\244\332\350\325\272S\257\321\350"
+	.ascii	"N%\275XT\024Z\033\304\025Ym\214\241\320k}\261\300\334\267\030"
+	.ascii	"\002\3145\276\303\326%\202x\205ZNm\227\260\330r\021\265\330\027"
+	.ascii	"D\367}\205kV;\303m\217\255"
+	.string	"\212\267\210\364bY\031\035\267\336b{\005\240h$\276\302\326\035*\035\217\355p\330\201i\013\006\221\004\260\355\"^\265\257\020D\373\022\335\026\357Q\310\265\364bU\005\337\"\361\213\245a,\341\266\357\361\213\353\303{t\211Z?W\2705T;\030\374\220\200\305\211\021\354PB\226+\314*\n\337#\326+\324\232:j\275B\255a\021\354(\2342\022\247\212Da\327\324\320=NI`\300\244M)*%$$\253\315\326Y\t[nS\221p\370\261GJ\177\2073y\346i\342=\214&\365c;s\032Z\322\271-\315\017\210\021\347\262\323\364(SE.\253\031I\347$W\322\204\325a\303f#\235\217t\037\371\021\262\271\200\315\250\201(e\034THFhD$I\222t\240\002\221\2412\316\001\022\200\246%\227\312DhI\222\372Wk\005\317(1\353\3356\n-\230\267\3040\\\323\354\343\242/\277\310\r\347\341\245\360"
+	.ascii	"p\351\313\243\212\377\213/\036\227\363\004U\273B\203\335\335"
+	.ascii	"%f@2\352\301\341\2053}]\264\n\006\307{\331\266S\242\307\343\347"
+	.ascii	"\200s\221-(4`[Qt\304\310U\223\316\200!\236\013\344T\246i\220"
+	.ascii	"\263i\253v%\3722\020\273H\327k\331\353>\346v\212\347\034\376"
+	.ascii	"\\\206\246\243\325\313\223\3062\337\261\326\333\270\343z\364"
+	.ascii	"\306\024\2402\345\206\204a*\360wf8\004\256\346z\252\302\221R"
+	.ascii	"\222\033\226\025\250\007\343&j\313\302\226\372;\t\324d\224\210"
+	.ascii	"\311\237\001\235W\275d\337\377\224\357\215rd(\001\334q\351q\211"
+	.ascii	"\033K{'\273\244\006\305\177\243\233\b\330j\351\323\266>\317\220"
+	.ascii	"\245\214\275T\357\005\317g\026\004\n\272S\351\367\204\332\335"
+	.ascii	"\025\017m\f%\237\253\232\270Z\357\207\325MDYC\313\371\316\001"
+	.ascii	"\035c\255YY\314\0175\277\017\330*,~\275\333\224\275\202J\366"
+	.ascii	"\200\210v\340\242\320\262\220\034\304\216\230\003x\220\230\377"
+	.ascii	"x\224\002\363\327$\237:\r\231\n\330\227\005:\360>\2560bM\373"
+	.ascii	"\212z\323_\364\325\272\366r\265\252p\232D\236i\323\255\022E\236"
+	.ascii	"\330\345\0348\363\363\347\224\312\315\357\311\253\224\322Bfg"
+	.ascii	"\346\343\270D> /8[\307\324\017\315\361s\233\f\006O\330\306"
+	.ascii	"\257^\275e\357,pX\005"
+	.text
+	.section	.gnu.lto_.symtab.553103402b53277a,"e",@progbits
+	.string	"fat16_isEndOfChainMarker"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"fat32_isEndOfChainMarker"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"fat32_decodeClusterNumber"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"fat_isFreeSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"fat_isDirectoryEntryTerminator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"fat_isDirectoryEntryEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"fat_convertFilenameToFATStyle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.553103402b53277a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,457 @@
+	.file	"beeper.c"
+	.section	.gnu.lto_.profile.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 [\005\002"
+	.string	"\324\002O"
+	.string	"\013"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\005\222\252\354\340\007"
+	.string	"\006\317\253\250\341\002"
+	.string	"\007\b\t\n\222\252\354\340\007"
+	.string	""
+	.string	"\007"
+	.ascii	"?\207\200q\201Q\301\020\225q\305\034k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\370?"
+	.string	"\013"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004\005"
+	.string	"\003\006\003\007\003\b\t"
+	.string	"\003\n"
+	.string	"\003"
+	.string	"\007"
+	.ascii	"1\007\203\3034\033\001|*\203\265\f\272\2016"
+	.text
+	.section	.gnu.lto_.inline.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\002"
+	.string	"\224\002\216\001"
+	.string	"\013"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b\t\n"
+	.string	"\r"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.string	"\222\001\244"
+	.ascii	"\344\001$s\0249\233Kp\023\217\002\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"\350?"
+	.string	"\013"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\004\002\005"
+	.string	""
+	.string	"\006\003\007\003\b\t"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"1\007\203\3034\233\002\301TF\300]\024\3137\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004\t\200\004\n\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 [\r\001"
+	.string	"pO"
+	.string	"\007"
+	.string	"\001\002"
+	.string	"\002\003\004\006\007\b"
+	.string	"\b"
+	.ascii	"`\013\330\0076\003[\300>\227\315@~\033h\003"
+	.text
+	.section	.gnu.lto_.lto.3f4fa6cf3640a491,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeper.41.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \351E\006"
+	.string	"\022\314+0\200M\032\003h*T\026\003\363*\027\250"
+	.string	"J\231AQ\323\242xDD\0055\211\221\247)\031:F\f!0\335\021\343a\201z\267\037\267\334R\246\024\317\001b\236Z\250\3702\35758xq\017\027\006\214\263D\bG\021\024f^t\021\020F'\315\233U\235&\030E;5\213m\264~\376\277\254j\327\202\253\316o\261\242\362\223f\342!\265\365j\035b\021\351\021\211F\277\006H\311?\023z\020\3406y"
+	.string	"r{,"
+	.string	"\271U\266(\236\035/\370\310\250\350\244\374w\214\303\322K\326&q\264\341h\274"
+	.string	"\024\376wm8\030.s[\203\266\bm/\002\b"
+	.string	"2\003&j\006.\234\301\270K"
+	.ascii	"\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_beeperSilence.42.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \273\r\005"
+	.string	"\002\t\",pe\322\001"
+	.string	"\335\353\371\177\304\017\354\343b@e\rF\316\322\330\b\277\366\006l\002\177\237\241\252/\336\004^7\306 \360\240\305\275S\n\256\250\031\257\030\033*-\205X\214\207V3\242T\301\362\212S%RN\235\272=\344\016\023H\261\273\354A\215\375\300B\316~\212gD\273\226"
+	.string	"\200\035\tB\035\333\237\214\331\244w\2345x0\025Piw\025n\216\375a\376?'h[\3667X\354\256\237\266]nx\333\b\333\t\333\216\b"
+	.ascii	"3\003\316\231\001\340\313]\303c!\364\313\270\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.43.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \341\035\006"
+	.string	"B\313)1Pm\222\016$\203\310\"\242R\020\232\324k\020t1\367\254\262#\212}\364\225r}$\214>+m\302\3144\200*\016\327\256\027\025S\337cm\334d\247\235M\004c\260\234\301\264\305Y\313!\231&7\232\206\207\3144\210\304\f\3148\253e\207\261\226\227\251\207\242\202\t\374\374\344Q\230\361\007P\024\275\302\212\323\bi-RPZR!\341\370\357\362+\365\t\n\322yH\214-\206\310H;!| p\225\2457\271iT\202\216\021\005\310I\333\304\215\223NI\337}\234\005\024\362\234\nXh\273\002\205.n\274\337\340\317\377\023\t"
+	.ascii	"m\21173\340\234\031\036\276\3345\034:\204\241R\223\301]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_beeperWarningBeeps.44.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \340\r\006"
+	.string	"2K)0`m!\035@c\203\024PD\250\343'\200\363\321"
+	.string	",\265n\236}\263x\002,\325\346?\244u"
+	.string	"\2009\220\273\3329\211\313\004\314\306j\226\220\235\002\235\r\004[\260\234\301\264\305Y\253!\231&7\032\006\207\314\264\207\304\b\3148\253e\207\261\226\227WT\"\202\217\222\370\347Ij\364H\251\022}r8\032i)NL*R\t\321\370\361\362\247\364\b\t\0169\"V\255\305\007H\373\0166\b\300\312\356I\360at`#c\302\243\244m\252\013t\230\334\210\035h\001\205<\230"
+	.string	"\024\332\236@\241\n\\\341_\360\347\377\t\t"
+	.ascii	"m\21173\340\234\031\035\276\3345\374\034BS\251q\340\316-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_beeperUpdate.45.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \363\225\006"
+	.string	"\262L.2pm\032\003\240{=\037\020\205\346J\214\252\207\237kE0\315\316!\"\022\202\222\002Z\002+\331\245b\250\272B\205\322\b\221\344A\264\t\tI\"eJ\001\036\206\267\231\026>\234\027\343\203\024PI\023_\347=\007\007'\307\231\0326N\212\036\247!(\354\274\350>\020F\207\2317\0135\023\301$\332\tZL\324\232\362\377e\241v1\312\"\221\237\342\304\344#-D\003\323\326\253\365\310\034\322\035\020\275\374\026#\220\177\"\364"
+	.string	"\300-\343\201\212\033\305\002\025\267\312\226\304\023\343\005\033\031\023\037%\377\035\273\260\364\222\265=|\241*\220\227E\341\177\027UU\270\314m\r\332&\264\255\002\b"
+	.string	"2\003&j\006.\034\200y\227"
+	.ascii	"\210\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.46.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"\"\312&0\200\267\351\2003\242Y\021\026~0'\302\003i\347\216\250\022\301\321\232m\033\343]\275\326\232v\032`N\006\244\371\202\252\322\203\367\241\006\236\032\331;\245\236$*+)+qR\021CQ.q\242\231(9<+I#\300\2344B\334\276>\021\006\005l\356zp\263\337,<\260\237\345[\267[0!\261\020\316\203\202m\313\206|\2067X\256\223\001L\213,$\020t\021\273\\\214\316x\3564_<w \302\353_\365\357\360F\227i\327\237B\262\273~\231fp\303\333~\330\206\330\016\b\t"
+	.ascii	"2\003\202\341\243\302Z\025\220k83\242]!\310pW(\355$\003"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.47.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\240\330 \232\212\342jZ8\252\310\332\255\024\231\366\\S\301\206\005\252*f\022&`\327\\\016\263=7c\215X\262e\n\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&[\307c\373\350\b&\023#\346%Y\\J\310\377y\315\217\330\222U\026\310\344XA\311\314\204\017\002\352\376;R\222\317\027\203E\bS\020\001\2718q\311\314\336\246\004R]\246\003R]\363\350U\274nM\212\033-\"\fT\004X\310\314Q\204e\364\326\337\340G\3705\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperModeMaskForTableIndex.48.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \360\235\006"
+	.string	"B\314-4PO\222\016 :\203B\227\301H\370\016\240\2708\352\266\270\032\n8\252\310\332\255\024\231\366\\S\301\206\005\252*f\2141\330\342O\016\263=7c\215X\262e\n\024\017T\273\303\261&\31749\274\212z\021T\003\304\353X\022\217Sp\345\231\2547QU\326\323d\331K\332\204Z\305g l\243o&\233\307c\303\350\b&3#\346%Y\\J\310\377y\315\217\330\222U\026\310\354XA\311L\205\017\002\352\376;R\222\317\027\203E\bC\020\001\2718q\311\314\336\246\004R]\246\003R]\373\350U\274nM\212\034-\"\fT\004X\310\314Q\204i\364\326\337\340O\3707\002\t"
+	.ascii	"2\003\202\341\243\302^\025\220kx\203E\263C8\001\2504\235v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.49.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"R\r16@o\222\016X\250\303\203\b\023\264>\\B\224\266\250\311ZC\356\263\210\352ck7\203\216{9\340\212\215\261\252(\236\f"
+	.string	"\262\2274\020\t\325\374\243\265\335,!2\005\021\f\327\373\343\311,\220e-@\354\202\016\227B\003\374d\017\320C0\006\2622\b\201a\031\334\304\354VqDO\342c\310=\322\027\223\231\371\343xWp*5\244%\363\342\305%W(\224\217_\373\315\357\334w\244$Z\343)\003dj\250\234d\346\301\035M)\016\346\277\"-io\257bB\224\201"
+	.string	"\342Aa:eFx\354@UJS\201\252\324\353\350V\267\335\2264\300\264\301b2\n\325e\0222sg1\302\350\257\177\3477\370I\001\t"
+	.ascii	"2\003\202\341\243\302b\025\020]\363Z0\361\340.(\325\240I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.50.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \313\255\005"
+	.string	"R\n'0\200\267\351\2003\242\271\025\330\00351\034\275\217\341RN@\035\217\2268\263\371\266\364\272\246\215\006\205\211\021Q~%\250\364\236\033\306\370S#{\247\024\246&*-)'qV\261RI(\221\242\22681<-I\343eN\032!n\017\265\307\245\f\004\260\271\353A\002\373\315B\315~\221k\335\256@\004\304:8\f\233\355jC>\302\023\252\335\320p\006\331\342`\013Xx\330\335(=z\3564W<w`\301\353_\365\257\360\250\303\262\353/\001\331]?,\033\270\341m7l;lc\002\b"
+	.ascii	"2\003\326\231!\340\200\\\303\235\021\r\013A\210\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.51.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \302u\005"
+	.string	"\202\311$.pe\322\001"
+	.string	"}"
+	.string	"1\252\260r\326'<<\222\216"
+	.string	"\230\220\216\366\023\273\317\336\214\215\206\3563T\365\365uL\353-\210\f\2106D\366\226)\307\256:\2659\033\222f\022\2221\036\022\253\021y\025N\265Y\245\204\322*\255\333l\005\206I\244\374\227\203q\363s\325Q\363\303\352\0331\b\325\335\005"
+	.string	"\364\0270y\376o\277\365\204b\273\345\333\351\b\237P\205\224\352\2762r\3302\264g\0261c2\247\222\3071\034,\272\373\320\342]\370\221\377#\376\037\376;\002\t"
+	.ascii	"2\003\202\341\243\302b\025\220k8\\\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\245\002"
+	.string	"\224\003\n\001"
+	.string	""
+	.string	""
+	.string	"\002)\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002*\177\005+\177\006,\177\007-\177\b.\177\t/\177\n0\177\0131\177\f2\177\r3\177\016"
+	.string	"\013"
+	.ascii	"\200\036\340\033\340\033\340\033\340\033\340\033\340\033\340"
+	.ascii	"\033\340\033\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3f4fa6cf3640a491,"e",@progbits
+	.string	"(\265/\375`\356\007\245,"
+	.string	"\372M\204\021I`\034R:\227\315"
+	.string	"\007;E\207\212\307:\360R\211l\r\330\265\216\334\007:\306\225\342\364D\343\002\344#\202\230\311\300\276\250\252\246C\242\347>\235P\020\240\347;\371oFD\337\3524\343\027\301\203x\351\021|,[\362\311N\001\347"
+	.string	"\367"
+	.ascii	"\027\001\320\356n\273['Y\025w\347\370y\227Hd7\225\001dW\265\316"
+	.ascii	"\250\356\264\311F\246|\231X0\320I\205\271l\251\270\315\357\024"
+	.ascii	"\334\313^\273J\256\314VJOuw~[\227\312\031mR\225(7}\307\270\231"
+	.ascii	"?\327\306\030\231T=\20553\363\224\374\265 S9\204\t\337\265`\355"
+	.ascii	"\325\035\373\360\3209\241\223\223\252/Z_\227\027\3642Xz\343\005"
+	.ascii	"\022\031\251z\006k\356\312^\371+G\311\361U0\270\231\3351\317"
+	.ascii	"\316\265a\246%U\2052\201\236\232\005\364\376Cy\317UOx\272>\023"
+	.ascii	"\365|2QO\316\0346m\3208\255\234IaR\246\265\373sV\3763\326\177"
+	.ascii	"\260\364\317V\377\351\376\307\375\207\373\277\366?\355?\264\354"
+	.ascii	"\377\363\277\363\377\330\377\020\377\233\377\251\374\007\373"
+	.ascii	"\357\363?\314\377_]]]\335\237\325?\017\377\036SmT\r\244\314I"
+	.ascii	"9\221k\252*\"\236\263'i\\\244Y\236\307\276\346\327\355\325\335"
+	.ascii	"\nv\350\242\334\256\244\352\335\344\260\377>#\266\254#\251zv"
+	.ascii	"\375{\355&\273[\006/\356$\324\257\227y9\023\375<y\227\031\374"
+	.ascii	"W\273\317\023\355F.\341\326$Z\\\035\251\372_\250\233t\267@\035"
+	.ascii	"w\362e^\265\357\0244%P\334=\202\232\351\243\337\370J\251\302"
+	.ascii	"\235v\334\271\217WJ\025o\f'\337\030n\177\372\b\267\335\261\362"
+	.ascii	"\347m\272m~\231W\312\227\t+\201\372\330m3\335\036\353\021V\276"
+	.ascii	"b`\345\317\313t\225\357\361J\t4\265\304\262z\313\270T\271}\217"
+	.ascii	"\r\003Y\345&\177\240o\f\367ZwnFu\222Aw\025\234\\sod2((\f(,.\234"
+	.ascii	"\343\356>\200\204\302\202\373\b}\271\340n.(\024\215\224\320\306"
+	.ascii	"\320\036\222\241\255\217\252\236\212\352F\320q7\262\273\315\035"
+	.ascii	"\252\0226([M6\266\f\007\267u$\332\313\321\374\321\226\346\031"
+	.ascii	".\277\231\311\362z\373s[V\223\333\354\336)\270\233\3351\220O"
+	.ascii	"\027\r Eb\037\237S\216\222\032\251\232\331\344\350\263[^\343"
+	.ascii	"&\001\356v\263\233\317\\\267\353\223\363P\316C\352\023,-\261"
+	.ascii	"\236\3724l}\234\t\364\326,\240\227f\251\251\3455#`\330b\234y"
+	.ascii	"^\033\263\363"
+	.string	"\243\007\227\2134\006\032ZN\223\333*\022\365\031ar-\313<\247\34504`>\336?\325\032\316.\26383\263\f\025\352\356\250f\261\266\225\025\335\311qf&\366\f\315cvlL\240Zg>\2657\253\346\232\365\331\313\227/9\f\021\336\026+\26440\317az\274\236Q8V\224\236D\344\254\224\225\ry\201\243\245\261\204\013\227\374\024\262\354\001R\246C\255\313\363\223\327\265%\276Q\205\207\365\246M\313\0162\262\354\314T\025\266x,}rI\253\243\233\374\225\235<4\256#b\251\372\234\\\237\305\362\225g,_\031K\036\313F\r\025LD\342\005%\336\360C\221}\022\356\030\207+\210\030Z\024\215\303\f\004\212A\024K*\333\024\364\020\224\342)\330!\001\013\266\304\220\003\313D\"\030\242H\324\020dT\202\020a}\"\026\227\204\035\330&a\210\246\242\005#{\"\2105\006K8\211\370\235\030\n\207\305\340\210"
+	.string	"ON,{aH\024\032\203ME\241\211!\021C\020\2734d\231\204 x\036t\242\023[,2\022\211\305\""
+	.string	"\275/\t\213\354\220=\261^\302\221\203#$\026:GJ2J2\352\035)\t\bL:\002\256?\002\356\214JO\"\330&\241q5*!\031\207\302\025:\254\022[\202\330\341w \020\203\220\b\017\033\326\245\007E\326\211eI\024\021\205ECa\260\251h\251\370T\364\240\300\341\300\311t\300&R\321&if\274\375\240\313s\276\255$XS\251\232\347\322,'\317y\236\313q~\307<\247v\2739\017\365\344<\304{\032q\303\320\254O\317\336\274\311qkw\267q\307\030\260\245%\025\225\323\t\342\356\230\022\367g\200\241\250q8\246 %\"\"\"\"\322\202$\351\300\002\221\031+n\021`%\323p\246 \3110\007  \315|\345"
+	.ascii	"r{\371\333\257_V\235Xt\013\243\375c|\315\266\237\025\241!\245"
+	.ascii	"\016_\227_Q\033.U\265\340\212\341\217\323\270\201\357\207]\005"
+	.ascii	"7Y\006\201\266~'Gp\306\221\344%\023,\313\210\342\320\376\255"
+	.ascii	"C\263Gh\267\236A$^~\221&i\205D\343\377\211\303\n\303yv\036\204"
+	.ascii	"-\221\222\316\326\202\271\327U'*R\256%R\366n(\203\226(.\364\261"
+	.ascii	")\270\004\270l\t\210E.\332\f\222\261\305\352m\307\027\326\230"
+	.ascii	"g9\362Y\203\315(\215\\\227\351\334\276f\210\022G\310,\375&\324"
+	.ascii	"\212\305{\353\004\307H\253\277}(\331\373\326.\240{\226\270\250"
+	.ascii	"\273\335$O&\377$Ve\034\207p\"@\325\322\2316\b\245\021\264\246"
+	.ascii	"\304\027\263\001\177\020d2\222\225 au,~\201t\340@\373!l\3233"
+	.ascii	"\230I\033{\322H\337\340\022\370\344L\213\373\360w\344\270H\373"
+	.ascii	"\341\b\037\300\223\260c\356\335M\177\357\261l9\342\340\224\335"
+	.ascii	"d\232\213\311j"
+	.text
+	.section	.gnu.lto_.symtab.3f4fa6cf3640a491,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperWarningBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	"beeperModeMaskForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3f4fa6cf3640a491,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,878 @@
+	.file	"displayport_msp.c"
+	.section	.gnu.lto_.profile.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\r\001\245\t"
+	.string	"\224\f\001\002"
+	.string	"\035"
+	.string	"\317\333\366\301\006\004\002"
+	.string	"\002\001\001\302\376\315\216\006\006\002"
+	.string	"\002\002\003\002\240\342\234\212\n\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\215\377\300\244\017"
+	.string	"\006\372\321\211\254\f"
+	.string	"\007\267\236\221\311\t\003\002\004\002\002\b\315\373\212\222\003\t\320\235\262\314\006"
+	.string	"\n\224\217\236\327\t\006\002\005\002\005\002"
+	.string	"\002"
+	.string	"\f\r\343\201\357\252\016\b\006\002\006\016\017\271\203\267\302\017\016\002\007\002\007"
+	.string	"\002\b\007\002\007\020\021\022\023\337\312\264\203\001$\002"
+	.string	"\002\t\n\024\025\346\332\202\250\0174\013\002\013\002\002\t\026\027\030\262\272\211\310\013\n\002\f\002\006\002\006\031\365\360\233\250\t\r\r\032\033\304\302\235\224\006\034\352\374\267\323\002\035\240\342\234\212\n"
+	.string	"1 `\002Cg\364\177\221\207+3\007\"g\t\257wq\273&\005o6\273\204xo\270\315\035e\376\215\225$D[\227Z\b\245\345\231\027\240\322\200\211g\236\333\245D$\200\357w\036\3423`\0203"
+	.ascii	"n\241\027 \207\337\261\330\004\223\320\035\300\250\301??\320"
+	.ascii	"X\323s\nk\356\314l\342\260\336\017\226\004\277\312}\256E5\340"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"\035\005"
+	.string	"\362\307\023\026\220\271\320\001\365\335\335\335\335E[\203\373-\276\372\251\t\331r\247\024\356\356D|\320x\034\031\222w3\n\372\"\b\214S\224Y \326"
+	.string	"\353\326Y_I1\355\325\343\372\242dB\366\030\r\032b\371F\272,3\364\216\251'|9\203\231%x\"' \240\002*\273\035"
+	.string	"\023\304F\026k$\005j\201\007\206H\022\330\372b\313\242\343\342.6\002P\2107\0241\340\203\316\fD0D\002\027\263\206%\204\310\001\220c\2515u\b\242\f\007\210\256t\030\303\230\216+\315q"
+	.ascii	"u\232\337\213\234\244\203/\302\020"
+	.text
+	.section	.gnu.lto_.inline.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\334\003%\021"
+	.string	"\366\326N@\020\217&\351`\020\232\0332\353V\257\210\002\374\220G\020\fV\305t\236\344,\264\016\344\326r\374L\355\273:P\202\277\365\033L\t\024UUU\335\b\240.\022E\246h\366\277auk\255\221-w\n2"
+	.string	"?"
+	.string	"D"
+	.string	"\325\\\216\336\327\236\306a\371\313\334L\017\303Qf^\337u\247[\326m\267\333\321\314\314z\232\t23\364\325\327\340K\034\323\273\037\326\222\314\244^\3436\n\n\246?\fq\302"
+	.string	"$c\353OA\"\\XP\fE'\033F\252\367\350\210\007\037&l\360>\017t \002a\204\271\2724\023\231YMe\364\203\0242szj\177\377<8Z\0026p\247\2559)*\034P\0164\215\236\246\207\355\003!\013\024\f\026\0261`s\370wi\240\256H\021\362\242"
+	.string	"\202\236"
+	.string	"A\n!p\306\342a\205dr\271\313\365\207Y]\264B2\271\316rg\250\017\324,31\306\230\223aZ\337\337G\214\212\314\334\034`|\f\263\227"
+	.ascii	"\340dM\231\276\232\n\204$P\220\204,\377\321,Q!\303i\370\350\210"
+	.ascii	"\210\213\026\253t\003\217\223q\262\353\300R\251T\352\224D$\241"
+	.ascii	"\003\025\242\376\203\001g\2501\275\202h\246DI\271\032`\002!R"
+	.ascii	"F\347\001\022\200e5\205\245$B\001\221\222\242\222\244\316\315"
+	.ascii	"\345-\244H\364\301\345Z0\337M\354\025\310Td(*\235\353*\200L\303"
+	.ascii	"Z\366i\330\t\202\031\313\312\177\177\020\302y\257\247\300\202"
+	.ascii	"\223\315\346CH]\363&B\370R\315cE\363\277h\3719\t|&\260\253\230"
+	.ascii	"bG9N\267\367[\230\326\271\210*\024D\022P\005o\200}V\036A\372"
+	.ascii	"\203\331\212(\256\345\354\247W\003\203U:\300W\234\214\306`8U"
+	.ascii	"\210\013\013t\037!M\244{\363#G\342m\017r\026\350\343\313\255"
+	.ascii	"\354\211Qit0\031\317z\333,\"\233\200\3678\323\346zM\345\342\213"
+	.ascii	"\251\036/\345+#G\0336u\275\376L\267R\001\2613\031\371\306e\026"
+	.ascii	"\247\001\3139\377^\304}\321\343I\324\024\223\032\257\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`w\004\315\r"
+	.string	"\246\32260PK\223t2\027\353\362h7\242\320\261Y\262\345\314\314\314Dk\372\337\306\257\343*\254\030\316\314\314Ek\315yf\177\376\270\020\033~#\237l\231d&"
+	.string	")"
+	.string	"-"
+	.ascii	"U\231\025P)\221L\n\2506\005=\005uNz.\374\\f\200\026*\"\242\344"
+	.ascii	"W\252\265\374\376\317\227\365l\020\241 \337\t\200\204\037\f\334"
+	.ascii	"\037\274\203;\255\026\313\202\234#@\245\325\316v\370)\030\335"
+	.ascii	"\321S\255\300_\016"
+	.string	"e\307\266i+N\242*\001\251\265~\030R\267~\027R\353\004\350\317B\352\207\033\0304M\323`\273\316\201\263\340\356.qw\031\n5j\214Df\204\2036y\264>\036\204\264\316\200VI\002\255\325Cx\204!\\\001-D\246\273\373\313\034A<\262`\333\372G\307\254h\232\246\031\363\023\256\323\020Z\250a\265s\206\244(\245\302\262\006P\002!\305\352\350\001\022@\363$P\202\024D\226\004\344\bI\220\240Le\025\345\001\346GAs>Q\237\2239\232b j\343\372\nOF\343BZ1d\240\364\261 <\006\313\315Q\323\264\341\265\344\223BW\360\212R\006r\016{\225\374\300I]$rq\216\212\232\223\322\204Db_2V\316\332t`\002I\370_\356\034\263\202\333u!\210\366\017\333Q\323.\254\302\221\305q\321T\250\017x\250Rnm\311\326?0D\232\203e\373:\261\335\317\312\241FW\272C\321\033"
+	.ascii	"6\3121\240\332H\206`Uwq\363K\037=-\203\207C\233\351\025~\255"
+	.ascii	"\366\007\355<\016\335\024\036W\247\252b\364\355\r\245\027\202"
+	.ascii	"\f\317Ub\006\327b\373\261Ib-\334&"
+	.text
+	.section	.gnu.lto_.pureconst.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\205\004\001\231\004\003\200\004\004\200\004\005\230\004\006"
+	.ascii	"\230\004\007\271\004\b\231\004\t\230\004\n\230\004\f\230\004"
+	.ascii	"\r\230\004\017\270\004\023\230\004\025\271\004\030\232\004\031"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\035\006"
+	.string	"b\310\035(\200EI\007+1pgB\033/\316\240&A\352w\231\013\231\202\031\2316\340\350\301~w<\006\337\026?j\204\220\330-SGP$M\220;\222&\210\335\300\357\217\243\002"
+	.string	"'\357\025\346\267\321(u\034\b%,V\341.U\244b\210\006d\177\006F\226\320d\007\013\230<\321\250F-j\271Gc+\033\370\273H\027]dq\3651\205\367~\177\262\377\262\364\303\205/$\037"
+	.ascii	"H\021X*v\2506\302 \300\330\244F\030\301g\362f\334\200Z@gB<&\220"
+	.ascii	"\315\272\241\"\354\302\200|.\3138\263P--\201\316\346\n\030\372"
+	.ascii	"a\340\201\240\034\330\314e\005g\240\247e\204b\374\322\374\317"
+	.ascii	"\3250P\004"
+	.text
+	.section	.gnu.lto_.lto.e56bcb8492e45643,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayPortProfileMsp_Registry.15.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375 \225e\004"
+	.string	"\344\007["
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\256\371\ryw\250\314\006yu"
+	.string	"\005\001\006'\001\007\005\001\006\035\001\001\200\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\004"
+	.string	"A\b\354\345\206g\222<"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_heartbeat.25.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`:\001\235\016"
+	.string	"V\334dF"
+	.string	"\223\223\016[\352a\360\372\276\363B\255\217\372&\212\036;\367m;\030\314\021*"
+	.string	"\344<\234\310\253\251\032\265\037n\213"
+	.string	"\033t\"\n\201\0256\364\177\327k\375\026\242\006\321\277lP\\\177\037Z\204\255\221\275\367\336)\005O"
+	.string	"O"
+	.string	"O"
+	.string	"`\307\266\317\342-:\233f\202'\276\013\345\222\022\323cw\263\317\007\324\323y\001\365T\232x\367)c\347?\374T\201\340\341}'\237\036.g\201\224\b\234"
+	.ascii	"\037j~p\330\244\234\365"
+	.string	"\250\362\241\304x=\330]G\357\353p\323\333\226`;\202\375\226\007\177\tR\177\350  \263\313\241\345cm\250\r\227\257~\373~\314Y6\346\322a,a\324\250v\027+\331\330;?4f\005\013\272\257L\235Mq\311\220x\271\331]\0219u\203\316i\264\357\342/\272\203\033\036\262\233\242Qc\027L\340\254s\352\336W\3344\325gY\020\305{UVy\362\234\226V\fi\255RY\022\356@\2119\366e|\206\346\243p\006.\336;\365\271zJ\345Y7\360\335x\371`\212\020\016|u9\223\003g\345\024[6\210\212\262\204\375\2712e\323\350\213F\327\031M\003\276\211\bT\242\201\253\244M\233\200\03142\342D\024H\2336*\221\\\030q!\223L\013e\030B$\242\f\264q\331\310\307\332\250\302\226\2214m\3130\360\364)\253\207EE\210(\362K\252\330\276$\003\226\223D\3314wG8\b\037r\263\232"
+	.string	"\"\202\037\346a\3103S\243\n\027"
+	.ascii	"\266\3112x\266\301\b\251\3058c1\242\026\274\205a\001k\177Uk1"
+	.ascii	"\220\262\".\235&\312\231\301\272&\006\013+\242\324\320G\023E"
+	.ascii	"\\\214\240\212\fNDR\rZ%\322\224BA\001"
+	.text
+	.section	.gnu.lto_grab.26.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\200\001\275\017"
+	.string	"\026\235hG\360\222(\035\260V\277L\330\221:.\325\223\342\261\345\2074\206\007\2461\244\365^3\231\307`\342\f:?\332\246\301\304\372\376K-\211\303\265\242\024l\302Q\260\241%\307\263\200\346\233\223+\330\211\255\354\3246\262\367\336)\005Q"
+	.string	"T"
+	.string	"S"
+	.ascii	"\257\026=\266\375\026w\361\3317T<\021vR/U\315\217\335\335@'\240"
+	.ascii	"\275\322\017\320^\247\211\177\247S~\376[\247,\01710l9\345\360"
+	.ascii	"I\r\254@\344\b\bS\024\224C\246:\354\362%t\221\262\303`w-\301"
+	.ascii	"p\303]o\373\201m\007\366{\0041;\n\340\330\3250\013\262\262j#"
+	.ascii	"\305]\277}\237\3460\226\277<[1\326\356^\306]\376h\223\223\317"
+	.ascii	"\364\031\317\026\017\223_c\223\023\323c\234<\253\242\343\"!\203"
+	.ascii	"\263\013C\362j\005\036\026\373\363\317\376H\373/\016\343\273"
+	.ascii	"\210\341\"\273\253\261\306\256\230\300\233',\360,\356\033\315"
+	.ascii	"\207\211(\310\203tj\263\345@D\314\306iN\2333\205\306\207\213"
+	.ascii	"\004b\177\306ip>\nw+\362\340\212\366:\347a\037\to\310\304\234"
+	.ascii	"d\203\003\343Glt\344\300\240\344\314\026Sr\226\260Ow\256lM\272"
+	.ascii	"j\322\264J\317\213\277\004\320\t\276\n\027J\271@\322J^\007\341"
+	.ascii	"\343P\311\210\304E(y\335\350\204RaD\022\251l\235h\263 B\341\266"
+	.ascii	"\220G\332J@\356F\022\274\255\324u\336\366\021Q\247\223\206\204"
+	.ascii	"X\361A\222\274\316\027\333u\276\365gPu\220\241f\312'\272;b\201"
+	.ascii	"\b\316\f\r \021\374\257\217\023Blb\001! @\002b\310\252\0366\263"
+	.ascii	"$h\233#\266\304\310\207\360\026\207q\314\027\206\376*e1He\307"
+	.ascii	"\3255F\301\017e\n\202\341\240<\303\003I\001\375\206\027\nf_h"
+	.ascii	"\255Qq\023\204\201\322\224\340\002\270\303\267\357\344\346\340"
+	.ascii	"\226/7\322\007\355\226\246h\024\n"
+	.text
+	.section	.gnu.lto_release.27.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`e\001\235\017"
+	.string	"\006^kF\360\224\324\030XAm"
+	.string	"q\334\235z;\005X\313\"\002\351*h\251\220Mg\\V\317\250\217\2701\357'\211\246p\237\331\254\355W\275\2167\b\017\2237\005:N\216\360M\305/\213n\347\220\315;\330[J)eJ\001S"
+	.string	"V"
+	.string	"W"
+	.string	"\346\264W\217\232m\037\306U\241mCG\024bF\242)\315\300\356\275\034\347\002\354+}"
+	.string	"\373:O<<\2352\364\317:u\021\202\210Il9\365\360I\013\244D\024!\021I\224\003\304Uz\353\362Et\2212{p\357\2654\211\035\356z\333(\266#\330\317\021U:\243\322\366\343O7\022\030\nDL\315\f2^\016\261#\327U{\254\370\352\267\357\317\274eo\016]\306\003N/\224\352\336\273\205\354\355\241\317\362f\005\013\302\257D\332e\221\321\210\371qs/\214\311\253\033h\257\322\276\214\317\b?nx\311\275)\034;\356\035\023\004~\213\245\202\274)\233v\266\334\b\211X\215\351\316\332\251\302\022\342\"\215\330\327q\232\316\202\347\331W;\337\272\001\321\307\213\017\377\254o\3437>_\2053\200\362\246W\037\264\257\225\307\020\330K$!\034\370\352\004N.T\f\230\221\214\331#IN\023\366\351\235)\273Jk\001\377\212\327Q\321"
+	.string	"Z\320\347\233\260\271s\342\001=\n\240\317\347\t\245\\\360\200\335\n\367u\034\206.\305\343:\037\220;\341\370\363\260|8\320\367}\270m\034\235\316\f\205\224\242T#M\256\315\027\333\332d0b4I\026\321{K8`\275\344fE\001H\004\277\314Y\035\t\247\027Jez\213\333\306\006\032"
+	.ascii	"\266\311Rx\266\301\210\274\305`c\341\364\026h\3140\233\265\025"
+	.ascii	"\277\265\030H\355\021\367\335\304\002\001c*\325X\265Cs1\027r"
+	.ascii	"\361\260\354H\265w4\006\305\031\016*\313\240\211HJ\240U7M)\024"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_clearScreen.28.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\375\b"
+	.string	"\346\021@8@\217\322\001\230\265\370\245\034\344=MV\346d\017\375\353\376\333\262?\321\335\366\353\333\006Y\233\265%\235\315Ru\337Tux,\352r);\222\b\001\354\275\021\262\311\336)\0050"
+	.string	"."
+	.string	"/"
+	.string	"5u\312J-\023\252\227\335\235\232\017`\227\327\005\260\313\210q\357\320\363\017\362k\303\302\345;\215\016\263\204\3355\374N\025w\274\355\002\333\b\266Y\002v\314TV\bV\273\02410\333\222&\032\266=[\263}h\337\343\037\336\253\304\003vQ\253\222\335z\340\231\271t\315\330\3669\336\341\331\254+(\230\346fa\017\371H\b \265K\372\347\213\\\325\371\031\227\206\b\301\177\227~H\024\001\377\031\222\234\264Lqd\327\021\214\027\366\257\335]GT \216*h\356l\266\356\263"
+	.string	"\342\350&\3428l\235\207aR\317|\360p>\263\303us\2431\335\032\270\t\242\224\233Z\335\333\006\317RZ\244Xr\006\243\351\016\n"
+	.ascii	"\266\231E\246m0B\323\bx\016w\3155\257\004\023\017\356>\251VL"
+	.ascii	"\302$\003"
+	.text
+	.section	.gnu.lto_flushBatch.29.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\206\004\375\035"
+	.string	"v\370\301I\240VN:\304W\024x\370\353\027J8\273\223\220\363\020\251j\221\213?y\201v\271B\030\361\354cj\017\267\326\217\311\373\247\335\264 \257\2719(\rx\n\337"
+	.string	"\342\346-\020\375y\326\344Z\327o\365\037k\226\020B\210\334)\005\260"
+	.string	"\232"
+	.string	"\261"
+	.string	"M'\226\2150f\265V\236\223vp\236\244\366\211\274\310\321\205'~\2535\212kI\255\302\036\343\316\223\026\236\017r!G6q\024\006\201\246\357\313\322\325Y\255\025\267\363"
+	.string	"\345\311\361"
+	.string	"\312\223{\303&=\372i\2264r\\z\344\233?#\025\216\254\037\020\351\347h&1\351x\225\246\247\321\007\214Y\327\267\224\250Y\343\361\342\345\371\342\264\235Z\353\207?\320\243\t\006%G\235\250\031_h\200I\343N\024\260\245c\371\350\370\336\323w\034"
+	.string	"%\305\305\267NY"
+	.ascii	"}c\2020\033Z><U\001DA\251\371Sk5\375\001[\334\265\333\376a\373"
+	.ascii	"\307\036\221\002\273R^\360o\207!\025\024\024\214\375#Gb\242?"
+	.ascii	"\345\021\366\242\377\331\253<\371%k\214\371\362\324\243E[\350"
+	.ascii	"\243+e\177\225\2148\345\360F\331K\2353R\343\334\\\370\007\270"
+	.ascii	"\326}{\325m\263\3245KM\263\3243%\265\314R\333F\352\332R\323\226"
+	.ascii	"\372\034\251\315\222\272\\j\222\244\036G\352]j\272\324/P\353"
+	.ascii	"\021\246\363U+SQL\005#\273v\\\353\257\262o\345oi\035\271J\001"
+	.ascii	"\341W\307\262m6q+/\227\"U\255\325f\302\266\235\244\366\221?\264"
+	.ascii	"\315\2572\361D\n^\314=\367\032\036\226;\301\314U\200\243\353"
+	.ascii	"Tx\017\304~\266\215>%\367\254\340I)\345\232e?\247\361\266\344"
+	.ascii	"\342$\361\356\2704\311\322\230\036-\226\370\223\334Yk\365q\262"
+	.ascii	"\373\257\261\256\236\337\226\356\267.\241K\360K\t\312G\213\273"
+	.ascii	"Y_I\300r\245\374\373\004\301\230\3216\212\3479+\203\251XC\277"
+	.ascii	"\267z\223\241\013LgPBj\355\375\347{\235\030\344O\235\264\320"
+	.ascii	"\320\220\217\233X\372XD \350\1779[.\222\315\230x\001#\237+q\266"
+	.ascii	"\303\220\214\353Jr\376\224u<^y\022g\217u\nc\005\r\250!\307B\245"
+	.ascii	"\225b\\\251S"
+	.string	"\256\0321\200\004D7\022\332\255\321N7\301\346 \006E\274\034\220\321NWD\202C\210\"\036\221\007\234\216\b'\202\210C\016\027\264\343\341\030\354XW$\264\303\031\351t;\234M\330\373h\346\254\207\"D\226\34766K\363\343\001\326[\237y\276\345\303#\250\222E\325\345\\)\333\240\2247K\222\321T\270f#\224\325\254\316\330S\217\026?\326Z\253y[\232\275Y\262\354P>\2634[\022g\366gA%Kc\004\320q\313\225Y\273\202\005\372\237)\320PZ$\373d<\002\301\017\037\313\365\004-\342b\030\f\210ay\226\f\033\200\200\312\2232\273W?\247\332\332B\374\212\225\3326\030\353Z\360\333\322\266\fR\250Q \304\fc\206\231\231\211DJ4N\007\200\002\0211\345\016\020pV\332\244p\266\375)\341\034;\223[v\365\224\247uN\376\200\226Xh\177hR\257\004!-\310\263\300\200)78\264\372"
+	.ascii	"\240\340\026\250\201\350\214\250\341\330\006CV31xw\177V\003\360"
+	.ascii	"a#\237.\202\245\276/\276L\004N.\320\257F\323\362wM\203\223g\256"
+	.ascii	" x7\226\236\257\305\222\360Jf\242\217\005\222\034P;5\360*\325"
+	.ascii	"(\016C\035\023FSi\0211V\nK\325/\203k\334\0350\303\253T\371\211"
+	.ascii	"'(\02309\360\321G\330\330\"\342eu\331\327q\300\302\177\314\""
+	.ascii	"\221\027j"
+	.text
+	.section	.gnu.lto_sendRun.30.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\206\t\2353"
+	.ascii	"zY\210\023CP^R\007\367x\230\373@\367\262mD\002-p\237\336 \013"
+	.ascii	"\315\254\312\020\200w\374a\020A\307h\020M\220\20496\214F!"
+	.string	"\336\245\023\b7`\031@a-=Y\257\317\221\373\317[\224\330&{\357$S\n&\001\006\001.\001\035\246`\372r\216V\275\336\342(\202\033\335Eo\275\233\331>\327\305\356\376\322\326\267+\372r\231\"\351\3139Cy\333\037^\326\013\216\267\r\316\245\255\3541{%\221\322\345\234\243:\203\226\245\037\263\263M\330\205\307\335\r\0360=n\331\237\263Tp\202\343n\307\342Y\230\016\307\303\207rV\233\243\313\031.\252\221\257\267\r\367vw\273\025\177cv[Y8\252\230\360\353\310s\213`\316\031\271\344G\256\267\254\027\271\336\276\022g:\321\320Q\310\030\004T$\016_\241\333\262\217\231\355D\261.'\"\363!!\325\261\3705\007O\332\330\232\013Q\253F\251\035\022\034\304\032PC\262\307\365\242G\330%4yO\257\256a !U\332\030\233\027\2158\321\b\224h\021<t\275(\221/\374\036H\0333s\241Q\354y"
+	.ascii	"J\324\f\273\336d\363\226}\222\246\021\302&\211\235\242\330\027"
+	.ascii	"f\331\247\276\252\036\243\030\030{\004\244\t\264(\346\205_/z"
+	.ascii	"\306.\345\234}\316q\0171'\306B\252\234sc\250\330\230w\221w\273"
+	.ascii	"\206\356.\321\375\346\005\355{\0244\257\357\362\276\273B\205"
+	.ascii	"\312\3764\263\257\224\303c\372\177\366\337\312z[]\374\377\016"
+	.ascii	"&u\372\031G\323\326\366\266f\321w}\347z\213\277\325\263\272\231"
+	.ascii	"\371\377\264\255\\\177\027rt\2740\237\356n\341e\254\336\234\275"
+	.ascii	" \264[\235\f\214\3666o[\306\025v\350\225\353\255\277\317\371"
+	.ascii	"\202\346\335\036,M|\355\206s\342\237v\373_\257\327k\277Z[\230"
+	.ascii	"r8w)\327\342\376\344q\356\n\334\213\273\223\177\361nr.\356LB"
+	.ascii	"\334\t\036\267\322\343N\"\342&\360\270\007\020q\013x\334\001"
+	.ascii	"\0367\200!n\244\027\367\321\3436\"\342.\"\342&z\334C\217\373"
+	.ascii	"8\304-$\304m|\334A\217\033\350q\027\0377\361q\017_\334\357\343"
+	.ascii	"\026>n\367q\267\217\233}\334\377\270\261\020\267S\025\373\330"
+	.ascii	",\b\314\031\310\325O\316k\353\2348\235\373\227\3660n\327]\354"
+	.ascii	"\033^\327\257\367G%\347\354`\332\253-\306\3070\235n\353\315O"
+	.ascii	"\002@F\337~\006\177\005\275\321\227h+\003&ub\241'\372\242\357"
+	.ascii	"\336\300\001;\264\247\320\300\276\253\0337\261\214\250/p\327"
+	.ascii	"2\311\337\340\\\364x\013\264\2549\210\345\344\320\356N\341\177"
+	.ascii	"\226\016\344\254p?\036\244\250|\274\017\b\021UU\256\267D\317"
+	.ascii	"\356A\313\232C\357\317\301\346\361\3350\317A\241o\3206\3469h"
+	.ascii	"\214\341\202\201\016\365cz\343?\340sp\370A\317\325\326e\206\377"
+	.ascii	"\345\241\376E\371\360\201\236k\311\365\211\206\343\351\303\303"
+	.ascii	"/>\327\222@\005\337\335Y\276\2674\262c`\355l\370D:\303\027\246"
+	.ascii	"\341\3551k\342k\261\365\245\333\335\f<\316\022IN\3169B\373\033"
+	.ascii	"\207C\302\304\211\023\256\267M\324?\006\336f\307\2225P\277\271"
+	.ascii	"\\\326$\3764\211\254NYns\016\177\332X(\314\263\342\271P\256\364"
+	.ascii	"=\234\376\235\372\367%\260\005>\007\225\336\375\251w@\366\375"
+	.ascii	")\306SE\263E\370j\302\307zy\302wZ3\3634\316\364\356\227`\343"
+	.ascii	"\003\223:\333$\231\322\303\375\251c0>\334\324i\177\332P\336>"
+	.ascii	"\256\"7\247\bK}7\n\025\330"
+	.string	"\241\0011n\270x\256\255\244\025[#\231T\2626`d}V\322\352q$\225\317\245L\216(\266\225\224\326V\r\026\\\312\244\226\216\026YZ[W/\220\311+\244\215\253\0265\220V\312-\244\324R'\265`(\221\\\311\244\022Y\204k:\233_\255\315\30096}\016+^q\212\265Ji\241<)\351\233\252\371\316fs\316\231\250\215\263\343\326\027\207\257\256\027\026\335\033\332bsN\273\320\027G\340\245XF\324#K%\352\231\007$9\330\b\323\255\212\300\217h\022\007Z\246\344\3077v\\#\215\326\tYx\375\344\346 \300\003\336\353\274\312\274R`\b\232\364\315\245\264\3331\263`\300\016\265\360\356wU \013\0034\3764\001&\303e\313\fX\330\241X\256\267\t\336\355\034\023\tC\223^\031\360\024\232tAz\001\357u8\b\226\021\325\325xu\211D\215b%\205\300@\226N#\360\017\017L8L\300\177\230"
+	.string	""
+	.ascii	"\236\335C\372\006L\256\317A\007\364\356\226\342\243\362\307\267"
+	.ascii	"\347\254\031u\307\355\354\253K#\265m\356\t\376\375\211^\335\004"
+	.ascii	"\375\264\217\232\376\350%\264]\237\203D\246oz\257:\373\326\026"
+	.ascii	"\b&u\006\200\275\250a(\344\024D\f\315\210\210H\222$i\f\200\""
+	.ascii	"\0312\263\r\021P1EW3\005j3\266\373\370\224\2404\007EA\324\\\307"
+	.ascii	"T\342\306H\363s\304\365OH9_\013\354\252\352\235.\251{8\344\232"
+	.ascii	"\227Tn\265\204\025\350\326\037B\352\302.\023=:\250\210\374\331"
+	.ascii	"\376\032\006\326uUrM\244\022\001\213\177\021\321z\310\005\006"
+	.ascii	"\006\021L\300\320\271\361\241?u\031q\226\037:\213\023\207Q\203"
+	.ascii	"E\263\275\030\026\247\022\233\323H\207R\302\231UW\202R\263\001"
+	.ascii	"\0045^\t\270xq8\335\bh\2441<\340\035hB\213\203R\363af\020\367"
+	.ascii	"\343\322\\A\215\030az\215\331\366,\214W\267i\261U\025\331\305"
+	.ascii	"\370{\330\214r\244r\330\374\003]\265\267\254\214\346\r\267\222"
+	.ascii	"[\350\364\367\206\323_\313\032\304\207\312\271\240\334\226Wc"
+	.ascii	"<\341\317\207*\301\034w!\017\217P\301\376\022\265\235\271kk^"
+	.ascii	"\n@\250o?\327\303\035\251\370\353h\277L\267B\330\331\006\367"
+	.ascii	"\260\307\312\202\004Q\220h\033\024L\222\273\216l\326\347\256"
+	.ascii	"?J\212\344\334\b\027\243\b\364\271i\272\353\\*w\004\352\236\313"
+	.ascii	"\270X\214+\374J8z\371l\237E\320.3R\237\236q\200\\\020\230\b0"
+	.ascii	"\\rw\r\360(,\245\345C\343 \220\310\330\247^D/\215\233}IJ<`\316"
+	.ascii	"\n\034\300\343\337\372[\325\302\001N\313\374\003\332C\017\005"
+	.ascii	"\003\342\365\263\302#\372&\205DZZO\376\270\204?"
+	.text
+	.section	.gnu.lto_drawScreen.31.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\305\021\345\\"
+	.string	"\372\233\270\"N0\220\322\031\016\025&\363\342\302\206\214\204\373\316{\353|\026=q+"
+	.ascii	"\330[\207@\347\202L\231=\251\363\021=\245\3255\b\343\rxd|\353"
+	.ascii	"\256\013<\373\335\263\"\311\265\373\250\003E\224\212\035\252"
+	.ascii	"**\372\214H\f\314DDh\223-e\222\001\033\002\362\001 \002L\343"
+	.ascii	"\211{L.\201{\202\030\030\307\354\311\240\301\t\212\tc\200\233"
+	.ascii	"\231\n\214z\233\004\343@\033a\r\243\335\363\264\376e\033\020"
+	.ascii	"\013\341\267\354\3616y\227A\013*\321'\004F\255=\227w\331M"
+	.string	".\217o\331\242#5@\337\326uM\362\330M\236H\334m\356\345\236\345s\257\333$]\017\343\217\247q.\013\034\301u\215\302\320\262z\"\240\234YU\034\213\006\312\256\350\032&\243\255\204\210\021\315\307\371P\376\210\256CD\270\341\275\021\256kT\352\304-\300x\"\357\336\312\2574\037\345\340=\353jf\207\267\256Q\252]\032O\334\250\361n\177k\356\352\245\321\264\260b\0207\316,\204\353\272.\225\017ROL\377\243\236\330hF\273\233\244\363C\245Ez\032\375\352\020\233\207zrjb\212ZRR&!\035}\360`TD4$\024\004\364\343\323\323\201gG''\211<\032\213*1mn\356\303~\034\352\356Ovw\372\337\323\013\240\0357\355\204yua\246\003\271\362(.bx\211\213\230-\254\264D\254\356J:2N8I\025\273r\244\243\277'\034\333\223\216?\260=\241\260\207\264\343\346\302\374\357\371\226\032"
+	.ascii	"GE\355}nlT\345Em'J\203\374\224\324\360\277g[\032\002\272'\302"
+	.ascii	"\331\236Tx\250\210f\207C\231X\225\013!\321\352p(\023\263\362"
+	.ascii	"\240\324\311\215\013*\374\357\371$5\n\242\266\345}k\fT,!\346"
+	.ascii	"!\334\314\274\025\226\211\325\375\247\311}\2304\341\236b\211"
+	.ascii	"21\265wPKc\036\262\357\244\305 C\236\374\357\tM\tp#\230w\275"
+	.ascii	"#\254S,\261D\f\311s\220<\251T&f\302\221&\260=\215\3601U\376="
+	.ascii	"\311Re\335\225\330\236E\330x\274+\225\211\215\275\310wWI8\321"
+	.ascii	"\211\227\246Ifd\205;a]\251\262\214\031\347\363\316`aA\270\323"
+	.ascii	"\240!O\276V\211\3559\226\206\020\374\222\303\353\316B\302\270"
+	.ascii	"\230\213%\326u]\376\n\023\373\202\370n\027w\367\271\313\263\024"
+	.ascii	"\357\362tJ\f\202pa\264D\341\342\303\335\037\362\332lk\2725\341"
+	.ascii	"\232p\335D\274(y7\001\005\370_&\220Q\326$Y\273\314`\274`\034"
+	.ascii	"\037\356\357CuS$\242\205\220\315\021\267\327\267\214\252\374"
+	.ascii	"\227\347\200\002(m]\201\374k\317\346mN\354\235\234\270\013\240"
+	.ascii	"@\241\246X\301\377\332\034\273\"f\274B\254\200\305>\373\265\204"
+	.ascii	"\200\247f\220\256k\031\002\277;Q.K\233`\\\220@\023\210}&\365"
+	.ascii	"\t\372x7\252\221\233a\210\247\376/\307s\201t\304\f\372\366u\025"
+	.ascii	"\276z\352>\357E\f\376\327\004\255\366\217\325\033,L\255T\025"
+	.ascii	"h^\203\025\004\022H\240\236\250\242\213\204\220\004\n7\226\001"
+	.ascii	"kA\341\335\211\b\226\266'\020><\224@\303^\037\352\273\206\034"
+	.ascii	"\r]\354f\3672<\320\307\336\311\316\240\301\377\242\241\236\370"
+	.ascii	"n\261\303\3021 |\270;\274{\303\002\376\027\211~\335\217R\372"
+	.ascii	"\242\205\202\\\375c7\312\305}\346%\245k\333l\327F\222\367*\311"
+	.ascii	"[\003\311K#\311K\301\221wF\222w\202\b\254d\304\200\361\275\357"
+	.ascii	"\013\027-X\254@\362\252HyS4\220\344=q,_\023\217\376%\222\274"
+	.ascii	"\007\220H\362\212Hy\003H\362\002\260<\337\267\212j\352a\276R"
+	.ascii	"!\036\007\346\033\005\365\344\324\304\264\224\344UB\362*\223"
+	.ascii	"\274IH^\244#\357\321\307|=$y\215\222\274ED\327\362\035B\362\n"
+	.ascii	"!y\203\220\274@H\336\037$\257\317\221\267\247\303\221\227\347"
+	.ascii	"\310\273\223\344\325A\362\346 y\223H\336c\222\327\210\344-\""
+	.ascii	"yU"
+	.string	"$/\021\311\233\036y\373t_f\336_\320\224\004z\344\354M\007F\327!\207pV3\304<(7\363\357\375|\377\230?\314\017\346\277\373\343~,\277\226\237\356\311\335\003\376-Q\316\220\212\037\322\0251oT\312\354_x\037\337\352mA\363\022|B,z\331`\002\270)r\321D\032\204X\364T\203m'5\026\324\355\353\272\256F}?\302\360F\bQ\213\336th\331U\r\346\242U+o\203\\4\325-:\013n\216\327\376\304\224@\324g+\324A}6)V#Rh\256U\261\t\365\210%\034\305\252\tJs\355\350IP\037\271\002\013\273\016\211\231\013C,\272\305[\232\035\340\257\f\023!f!\r\034\350\332e;u\252\226\3212\336\346\274\240Nu}J\202\372l\201\372\247_\346\304j\331\244\2716\305\004\250\227jyf\234f\205\324Lc\264\346\332\320\231%?\375\276\363\033\0228P\270\274='U\274"
+	.ascii	"\371 s\314\006\241=\251\210\006\333\364\247\317\330\247\315\226"
+	.ascii	"y\366=\324\034*mn\350\220\242\003h\260}S\211\352\3239KN\340$"
+	.ascii	"M%\306u\355\032`\031\312d\3153\264\246\232\232z\242O'\327\354"
+	.ascii	"\025\246=<\207\207\207\205\357\241\366t\212&j\343\005\345j\022"
+	.ascii	"\335\323j\f^\035\372lI4O\347T\221\333+>J\335i\236&zq\352\235"
+	.ascii	"\206Qe\220\307D\033y\335\241\224\350\355\350\235\312MN\003\275"
+	.ascii	"irEG5XT\353\364\r\345rZ\247\t\217\345t\325\377\224.\313\240\316"
+	.ascii	"\324\243\272\201>_\333a\262I\260B:3Bs\r\350\214\b\377Rs\354d"
+	.ascii	"\247/8\215<a1+\003vW\007\2075\327\252\322\326u%\200\r?\233PP"
+	.ascii	"\034\373\230Wlc\337i(\244y\270\300t\352\001Y\\N\237-\037\245"
+	.ascii	"~\275\037\323\326\030\"\245\276\242\301\366I\033\016B\221\313"
+	.ascii	"\216\220\215\222"
+	.string	"\210\021d\237m\023;K\256o\233(\360\227\225q]\327\001\226?\350\300\260\231\202\321\t\007\352\211jO\251Y!\266\3631|\251\001b\245\246M\354{A\271\370\220\273\254\246H\2202\265`\327\026]2\345\330g{\2743\200&\304yW,\252gq\234w,u\247\006SC {s\005\225\202\036\026d\360[\003\3107\243)h\2426N\303n\023=\243\003\351\367\202\252\033X8\266\226:\230XX\314\253\"\276\r\0357zK\213y\225\366`fu\016\346U\333\300\272\252\301CK\305b2\263R\0357\266\266pd\365(j\275\270\201\205\303\201-\0357\262\262x\\\351\344\310\301\243\202t+\213\311\"\271WU;\264\260fle1wh@#\307\016-\0346\226L\034K\0358h`-\257\262\264\226U\312e\356\270\221\265\334b2\263\226\311(\220\267\331\336\357\f\240\301q\336=E\200\302\371\345\274S\245\016"
+	.string	""
+	.ascii	"\315\315\025\004\312\251\006\003\\j\316\273&\251_5\230\231\253"
+	.ascii	"&\352\b\372~\367\361\342\005\345z\372\273\237\213)2\3014\337"
+	.ascii	"\003\326HZ\241\313\211\006_\241\321\007\374\020(\277;\021\211"
+	.ascii	"S\370lZ\202\352M\225\240\232\350DMD\206F\216\206\021\\B\263\b"
+	.ascii	"\327\335\201\303\265P\260\253\177\240a\032\023\325f\313\206-"
+	.ascii	"\330\025e\251\317\226g\213\322\352\304\334\233\363\356G\352R"
+	.ascii	" \320\2528\357~~\346!\032l\225C\275?N\r\245\354`b\356\211\363"
+	.ascii	"\356'\200n\222j\245fCe+\271)\245\270\370\332\216lD\260(%=\365"
+	.ascii	"~x\352\241\006\333$\246\336"
+	.ascii	"\017L\335!\351gN\345\215\341\207\2779\b\251\266\352\2139\221"
+	.ascii	"\320-\320\210\202\0262J27\262\031\344\213\222\372\"yh*\250^\244"
+	.ascii	"\245~j\260\215j\352M\221\270\231\250:\251\317\206\324ImH}2\007"
+	.ascii	"A\244\257\315oo\n\016IG6:\351\244s\336\005\311h\017R\342X9\212"
+	.ascii	"\361\324K\r\226\026\347\311\021\214\3364\210\251\271\301v\f\223"
+	.ascii	"4cH/\372\251c\364\003V\372\274\240\\\315\3240\372^Q^\364\221"
+	.ascii	"\223\2226\\\201s\206\002\370\ris\344a\331\233\032-\333\006S}"
+	.ascii	"\321Q\320A\271\031D0S\033\365\001}\242K\364n\023I\223\214\377"
+	.ascii	"\365\242i\035\353\037+\325'\032\251\006\310!U\037\320\313\316"
+	.ascii	"1\252\266\321F\275\001\\\240W\224&\037DtQ\267\nr{\313\236\352"
+	.ascii	"\"\"\341\333`7 \2328:\017iQU\337\2540\201s\250a,\005\231S\206"
+	.ascii	"FDD$I\222t\021\005\304 G)\274\016\021\240-SFB\322T\032\003\257"
+	.ascii	"\252\2506~(\025\034S\336\243B\317\356\331`\275\016\325b2\255"
+	.ascii	"Yv\025a\026FR\032\bZ<)\005\260<\375\3242\234\307\252\317\347"
+	.ascii	")\254\007\037\250=J.<e\370 y\002\016m\022?D\353\222\356+\206"
+	.ascii	"J\340\214\255\340\013\260s\271c\023\211\017\343\331\373\321\315"
+	.ascii	"\b\205|\260\237\306*^w\310\365\232\360\306U\363\373\265\206\003"
+	.ascii	"\026\342=~|i\314\025 \367\200\366\335\352\353\202\357\271-v\037"
+	.ascii	"Sk%+mmb\325&\215\345U\024\372@v\371\301\335 3\354\235'>\205}"
+	.ascii	"<!u\254\261\255N\335)S\023c\022"
+	.string	"/B\372\031\367\355\206\356\274\215\377\265\303\356\270a\244\204\310{\234!\202o\2177\020!\221\222\027\254\205\217\033\320\206D\\\220\275\271\221\356\326\0379\023\326#\027$\341\177F\031\326(l\251\021L\ttK\315r\fUVn\277\304\335K\350#\205\027C\207\177]8\031\312\275M\372\352\224\2449\270\007\345\205(\367e\036\373\021)O\233\216\243\340.\373Z\266*\226P\032k3UN\222\274\r\336\210\325[.s\216q\033\353>\3223\214?\317\226=\b\"q\232W\024*\215V\326\243L\005e\206\353\333\3641\016,\310\370y_N\022.1>&\234\302\002\253Cm\363jF\n!u\305\3359\330w\312\354\032\255I\316\222tg\325M\021Xl\222\245w\375\026l\254\003\335\357\346B\n\022\006\205\301EqcC\226\004\225\035\263\276\177\360\024#\211H\212\256\225r\351k\364\013D\371\314\363\312LY\024\026\210("
+	.ascii	"\275\353nz\216+\330)vE\030\237'|\344\017\324oE\356\236\306\333"
+	.ascii	")\2439M\216\314J\253ZhZ\013\351u\004W\263\230\347\307\327\304"
+	.ascii	"\216\357\034e'Ch\226\205\266\276i\220\006\240\242\034.p\002\250"
+	.ascii	"\354P\277(D\202\310\261\212\305?^\217\261.\221X\202hP\362(a\251"
+	.ascii	"\214\253K\022\013\372\013y\r\226\317\242\317\347\367\306\340"
+	.ascii	"ICG\300\261\265|U\002\213Y\274\206\242\300\021\210\023\354;p"
+	.ascii	"\277\206\r\236\317\340\371\021\354\032<q\206\271K\n\177\324i"
+	.ascii	"\r4\355D\350\360\034\310\030\200\263j\031\002p&\200\306\254;"
+	.ascii	"\321\017\302\310\227\n\340\237\214p\264 \370\036\306y\207\026"
+	.ascii	"\350E\230)\216\206\n\001\374xq\003\3016\3442\204l(\307|\241\271"
+	.ascii	"\002S\357E\003`3\242\200\231`\002\216\325\3664U\231\031\023\264"
+	.ascii	"\007`\205\337\366\013\270\203\035\034Ub3F\231\346~EF\321l\210"
+	.ascii	"\203O\253\254<\006\231k\334\216r\330\022\221\022\352\303q\312"
+	.ascii	"\266V\204\363\213\270\270\250\246\215\343\025Z\222\rW\005"
+	.text
+	.section	.gnu.lto_screenSize.32.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\325\t"
+	.string	"F\323C:0\345(\035\236A\365\313\034\202\245\240@\036\3209\331i\241i\331\252\0249\304pn\265\037\273"
+	.string	"\265A\"\214\357\216\255\213 A$.(\264\223#\225k\311\233/!\204\020)S\n3"
+	.string	"0"
+	.string	"1"
+	.string	"\240\315r\205\035)\355\002u:\021\260\273Q\363\202\354\330u\202\354\230r\034|\202\376I~\261RbP)\322SK\330]'*\225q\353mol#\330\337\004\231VMg\246\277\rh\300(\270\354b\264X\373\202\255|\330\006\355\214\355\247\375\325G\300\207\243\013\354\252ZTvC\216\343v\314\341f\333\017\271HzE\034E\225sM\375i\200\277\233Hl\273\025\007~\2117\261y\034\363G\331\261\253\001\200U)[vHJ\335\260\177\255\252lMk\017\377L\323W\"\217[\310\370\323\351\276\020\203\310\343:\n\317C\367\201\032\"\007\212\020 O(~\274/v4\346:\007/\2128\316\213\231pok\252)\251\311\227\246j\252\001,@L\331\262\006\017"
+	.ascii	"\266\231E\246m0\302\210\t\003l\356\251\344\252\232M\351\255C"
+	.ascii	"c\231k8\264,`\t&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_writeString.33.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`I\001]\016"
+	.string	"\326\333aD"
+	.string	"\221(\035\245\036\200\240\316X\036\212\364\036f{\300/g\206FV\277\2242\340Fn\220~\021\266\372\243\230\002\224\205\314X\260\224_\262\252VD\223\347\022\256\341\001v\031\353\227\021\017D'16K\266\224)\005N"
+	.string	"O"
+	.string	"N"
+	.string	"\307\034f\266}\021\037\001\332+b\270!\265\261\220rz\231\261\273\234\307;4\307\342\005h\216\251\0060\301GM\320\327R\244\307L\345\032\013\254\264P\331H\225bGL\006\031w=Q)S\346&dw\235(\251\0137v\333\fl\213\330\377\020\234\207\177\366\026\353\216\232VM'\226\376F"
+	.string	"\0251\"\256\335\224\031\231}\201\301x\260\r\332\233\355\330*\031\300\261\246\226\020\r\\F\347\330R\f\f\0134m\004\t\300\263F\326\335\025\031\005O\373,'\001>49\200]\025\212\024\273\341\001sY(\276\353!'%\231\243\252\233\227\246\251\316\323\353$g\016\002\203\005\007\325\2259z\205\320\342\302\2245lS\270\211\021\210_\002\364e\273\373\016&\232c\327\273N"
+	.string	"\304\t\032,'9c\207\244\324\025\314k\365bU\331o\375\333Y\277v\227?\023@\036O\364iJ:OI\272\216\212\274\316\301\346\316G\350\373<\020y]\250\302\bI\350\363D\340:\017\007\362\214|\270\216\367q\037\036\356B\022<N\324u\036\267\205{U\031xj\251\025sSLQ\216\251iT\224\255\345\246\252\251\231\332\237.\037\032"
+	.string	"\266\231E\246m9\343L\f\017\363\325"
+	.string	"\212\330V\004UBl\270\b\255\240\225&\\\327\270\227\210\274\213\r2\267\020\255P\"\030\004\340\f\206\361\031"
+	.ascii	"\030!P\341\340\256$\325`\213\3204\006\005\005"
+	.text
+	.section	.gnu.lto_writeChar.34.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\256\001U\017"
+	.string	"\206\\dD\360\224\223\016x\334\337\315\372\262\2320\002\234\007\363\303\227\222ux\375\031\231\007\345\2507\357 \017\017\375\033\022\f\370\331\350\2647TS\013\273\263\371\335l\266j5\353\200\262U\006S\225\207g\321\210%dK\231RN"
+	.string	"O"
+	.string	"P"
+	.ascii	"\237f\333w\361\027\235\315\003~0^g\204K%\243\310\356n\240\033"
+	.ascii	"\310\216\301\027\310\216i\212w\307\240f\347wP \213\0327+\017"
+	.ascii	"u\254\304\341\307kI-\361D@\320\356~"
+	.string	"\306\223\204\227\312\354\240\354\256s\345\275\334\331mW\260\035\301\316\007\227\371=\237\371\265\177\177G\323P\323\n\323\t\323\007@\200\210\017\tBv]^F\026\007\333\261\302vg\177l\032\027\204\231\323\005l\352\207\313\003M{\001\203\3562'\353\356\211\034\007O\3731\207\321\375[\371\200]\326\r\233\335O\2017\355\230\003\3311\004*Lx\024\352UG4U\245P\363R\0359\324\226=\232\232(8\334F\352I\220\347\356\242T[\326\364z!F\217\226\314\261]z\315I\333\335\023\237\006\251\203\346Z\311\216];\254\233\0261,\371\262?Tj\313>\\e\331\247\371I\002\241\177\210\234\252\304\220\232\2708\341\343\220\t\2514\262`\342\")D\212\n\251$\302\260E\321\266A\2242\332B\\i3\0019\2222p\233)Fn\373|{xe%x\311\313\020\034\026MA\214Dm{\270\216\323\001\030\333 n#\n"
+	.ascii	"dw\033\340x\016\r\366(\346W1( \340\002\231\"v\266g\221\226oC"
+	.ascii	"\320\356>,\206Ffh|\253\320%\242h:\214\025f\"\234\351\032\006"
+	.ascii	"9\024\020\003\230\304q\021\024<6\234$q\375:\004\233\270\032\233"
+	.ascii	"a\200\2134\356\300\360\210\021\334\260\235+\020~w)\255AM|\256"
+	.ascii	"\212Q~z\273r\031"
+	.text
+	.section	.gnu.lto_isTransferInProgress.35.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\262M25Po\322\030 v\247\236\262Sa\224wH\247b\t\212\222\306\322\356W\360h\b\222wdg6\026\tw\233!\003\r\023\275\2662\322\334\202\225Jk!qo\231\002\231\214\f\325\036\316\205}\0322\031/\211\016\304\205Y\0160Z0\302\352|\240Gb\220\2639^\017\022f1JX\315\325\215\332P\274\212\237 \367<^\001vw\177\243w\312\221QrYx\331\r\305\300\254\312\224\022\362k_\375\316\275\216(IS\222\t\r\330\035\265\240\354N\203\241F\247\247\016P:iT\200\322\351\377"
+	.string	"A{\323\t\022\312\\\220,LJ\273\023\276\017\335\324m\253\226(\201\310J\007\313\211\b\244.\243\260\273;\f\221\206\376\364/\370\023\376\215\b"
+	.string	"\266\231E\246m`\344\250"
+	.ascii	"Y\005T\327<d\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_isSynced.36.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\035\007"
+	.string	"\362\31525`O\322\030\024\202\005d`\226\361\360\270#\223\242S\236\b]m\356\265\325\r\241\207\207\354\313\366\360\034m\006\250\202\202\344\256\354\376`\365\2010\b\255A\354\3362\005\227\214\f\233?\235\312\0025\\2V\022\036\210\312\242\034`\244`\004\345\001\301\217\264`\207s\254\036$\274b\224\360\271\372\2645\2338\024\257\342g\310\275\216W\200\335\335\237\366N7Z^\\\026\266]Q\f\314\262H* ?\366\233\337\271W\021\035\301\224dB\003v\265\225\224\335i0\324\250\364\324\201I%\215\nL*\375\037 `g:?D\231\013\024\013\223\227\335\t\237\207f\352\262UK\224 d\343\330NF!u\031\205\335\335a\2142\364\247\177\301\237\360k\004\007"
+	.ascii	"\265\311Ra\353xN\326*\370\272\346!;\204y]\223\f"
+	.text
+	.section	.gnu.lto_resync.37.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`0\001\025\r"
+	.string	"\366\031ZB \217\223\016\207J\362\202\205\002\224Gb\206_\235bV\204\312 \024\021\367\215E&\b\024\275\3147\213\372\270\300\264\310\227\234\025E\224t,p\005\002\n(\305a\026\b\003"
+	.string	"\270D\227?\261{\023)S\nD"
+	.string	"B"
+	.string	"K"
+	.string	"O\373\035\256\002zI\344"
+	.string	"vG%Zv\273\002\216\326\237\273s\300?\353\033\360\317 \373\364.e1\032T\224\204@\355n\324\f\007=A\376W\256\301\231\214<1\007v\327\311\231X\270\365\266\t\3306`\237%\377\340\361I\177\226\020\222\347\376\374\020\370w\3150\260@Q)\2052ew\242\324\013\366\253\335]\353\310~\351\2674\r5\3752]iZ5\235\231\276\346'/\250\026\bR\354VH\305X\323C\261!c;\347.\370\367\\N\250\027P\355\217\233\020\360\f>\205\225>\007'1\242R\215\313\211CI\325\306\316\222Y\273\353\341\213"
+	.string	"y\020 \205$\002\377R\006\347B\363\f\246\252\352\n\n(\242L\371\232\372\222\031\326\016\"\202\265K\342\341{\b\237MK\220\361\325\321\361d\233\317\246u&p t<X\203\250a\021\004\343d\361\332<\261c\200\265\316\307\026?\232\266\305L\027z\265:\262\202\025SHE\336HK\355\005\f\362\2349NL0^Ht\304\376\006\372'\336\262\361I\346\\\031\026"
+	.ascii	"\266\231E\306^\362Y\003\3346\305\230\004k\325\340\003\330\006"
+	.ascii	"\224\001\366\300v\341 \006S\346\202\335\253\304\362NXM\246\022"
+	.ascii	"\360\301\200K\b\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_txBytesFree.38.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\235\007"
+	.string	"\222\21645`M\323\001@\003wD\272g@\2504K\267\016\315\253D\024\300\n\353\230n\304\337\320\235\002\373\252\017\331\026\260\241\246\013\301'\230\033}\236\367\2575\333\266\334)\005\230%\021$w6\325\345I\300,Y}8\f\325E)DI\305\006\212\343\211\035\353\212\233\311\262Z\260\"&\245\025\245\271\267\352\004\241 G\317v\370\274s\252\023H7{nO)\354\303\325\220\025jJN\016Hv%ZX\326$\032\301\260\235\331\222\355\367\354w\334#\373|x\300nHEdw\0228f\036yfl\373\033\347\310\254\301i\321\001\\\244D\200\254\354\3168]\340\362\b^sy\244\025\327\3764\377\037\207\032!(\\\267\375a\fv\327\217\353&n\275\355\001\333\005\2663\002\013"
+	.ascii	"\266\231E\246m`\304U\335\341\232x1\321\022\215\333\201\t\002"
+	.ascii	"N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.39.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"m\006"
+	.string	"\004\013\324"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\305\305\005\177}\270\305\225\005{y\370\304\365\003wu\270\304\245\005sq\370\377\324\007{o\270\377\244\005mk\370\376\304\005ig\270\376\264\005ec\330\375\004sa\270\375\304\005s_\370\374\204\005s]\270\374\324\003s["
+	.string	"?\202\210\200\340\001YW\306\001U\305\001S\304\001Q\303\001O\302\001M\301\001K\300\001I\277\001G\276\001E\275\001C\274\001A\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\f"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243I\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_displayPortMspInit.40.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`3\002\315\021"
+	.string	"F\341uH\340\322&\035\242\316\322\002\207\342\2525\023\204\361n\255\354\266\004\311\320\337"
+	.string	"\351\322#O\237\037\372\245*:\335Lk\363\022k\325\252t\036\3762\314QU\243\311\321\342\030\236\341\201F=\034\030\267\267\373\267\002i{\223-S\n["
+	.string	"["
+	.string	"g"
+	.string	"\263\031#\204\177\3422\230\213\236B90\366\201>\306\\4J\020\255\326z\372\264c\354\323\347\3322\366\311\377y\t\031\203\003F\036\034"
+	.ascii	"\032ljP\320j\035;\217'\241\237\334\003\320O\t\342\340\027\364"
+	.ascii	"\037\373\346C\003Gx\343\372\232\016\324Z\275\341\r\316-o\333"
+	.ascii	"\200\355\224\2752\002\343\267\330H\353\001\223.\243\366\342\203"
+	.ascii	"<\256V\030\213\267h\331(x\324\243\237\027\277\342\343j}=\364"
+	.ascii	"S\\E\005\277\347\323.\337>\374\350\247\215\241\265\017\275E\""
+	.ascii	"f\031\244\313\036gVz\260\277U\271c\31757\327\246mM\347z\316\365"
+	.ascii	"\266\255%J\200\317\021\204Z\255\033jAj\034\225&\005\277a\203"
+	.ascii	"J\221\241%\022\342\224\227y\301\215T#<\265V\223\032+$\364!r\025"
+	.ascii	"\335\344\224\022\t\2463\2635K\271\311\327\f\271\314\f>\243\001"
+	.ascii	"W+\215\211O\364\"\007\017PP\350\247\224\227}\225>$\351\304\304"
+	.ascii	"\327\326<\262\022v\033\321\222\233\210\336\304a\244\240x\\\374"
+	.ascii	"E\004\t)\3730\205\216*+\033fI\255Z.*/\254o\005\263ba\325\362"
+	.ascii	"&t\237\327]\360V\\:\026V\253K\225\370[\265\260\272\227\357cu"
+	.ascii	"\247\361\365\255\312\035[\351\343\222\036\373m8\214\230\275\344"
+	.ascii	"\214\013\354\305\363\370\246P\316\016\031\370\003\306H:\314\200"
+	.ascii	"\364\240\221.\373 \020\365u\034\t\004\362{\214\340\344\204~\316"
+	.ascii	"\241%\332\017.\301s\034\021\270\212\232d* \300\002\2311\333\006"
+	.ascii	"\"\241\257e\220*\303\240\270\"\262C\273\261\204zZ\n\243\\J&\264"
+	.ascii	"\303\270*\243\f\315\260]Yb4\270\306*\314-\244\313\rn\205pCq\326"
+	.ascii	"\312Y\234\321Y`|\020\301\321\204\346\0358\230\227\307\320\274"
+	.ascii	"\303\351k\224f\274\207\035\216F\032\004P\303\221\276bj3\031"
+	.text
+	.section	.gnu.lto_writeString.part.0.48.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\256\002\305\024"
+	.string	"F\250\211I\260\022R:rc\274\222\364<-?\314\360\334\231Rn\362\2452\302\217\230\312z\326m\242'\265\370o\275\214z\355\264\355\366V\235a\237\256\323\024\376\224\355\\I\r\350\260m\327,\363\037\365/\245\245Pw\337\022\262\211\334)\005r"
+	.string	"u"
+	.string	"q"
+	.string	"7\353n\217\017\004\227'\312}\250\346\304\267\030x|i_\305\205p\037\252y\311n\317E\323\256/\345\323/\326\247}\027\020~\262n\022~:g\347\270oW\274\260\223\203\304cw_\032\302*s\237\240\3120\347W\370t\361l$\b\352/I\006"
+	.ascii	"\236\0050\201\020\n\2403]\356x:\251 %2\\\232<\024]v\327,\r\267"
+	.ascii	"x\3331\333\fli\025!\242\264\353D?H\213u\245[\024\245\303Pz\202"
+	.ascii	"\322\340\177\267\202\322\362H\377K\002\020\220\332\335\271\362"
+	.ascii	"\261\037\246\023\211\0269\373\311(:\337\017\217gw\013|\305Y\340"
+	.ascii	"\354\247\3266\201\350\320\364\211\002\332g\312\331.\033g\273"
+	.ascii	">mOy\245$\232\231DsB\262:\243\024\013\220\216\216n'\331\233\251"
+	.ascii	"\r\n@\371\237WXr/\272\335\267;\240\264WXp/\n1?\310\247\t?\247"
+	.ascii	"\236j\307\341\340\356\256\252\317o\241jKE\0348=\006.*K/\265\244"
+	.ascii	"\003\347\304\215\274r\250\266%\034\306m\300\217m\nw\222\215\330"
+	.ascii	"\330\335\003M\177\021\301\017\372\264\314(\257\363\351\217\341"
+	.ascii	"\247>\351XM\rU\251\024\324_\245\236\351 \324\322\216\234\037"
+	.ascii	"6\362\312z]\362\320\203\222\352c\r[j\320\020a\355\331W\372E\376"
+	.ascii	"\373\003\261\031\031\315V\013'\2144\215\031aj\243\215\r\\\206"
+	.ascii	"\251\314j2\016l\264qv{\211\231\325d\017^\243\3545#{\221y\301"
+	.ascii	"h\265\227\n\212\307\031\f\355e\033G\332\313e[^{v\261\321\233"
+	.ascii	"\021S}\354R\2252\354Q7\326\356\266\3703 \300\370A5\341\247\353"
+	.ascii	"A@C:u\343\307\004\202\241HJ\225d\251\250;\203a\210\216D\311\226"
+	.ascii	"\252\356\354X8\365&\214\252t\262\207\375\030\2634 \240\002!%"
+	.ascii	"zb\022\236\215X\025\304\246!\2030\256\262\027f\333sl\326\224"
+	.ascii	"\352cd2\032j\304\333{\347\276\371\007\033a\373[\033\252\205_"
+	.ascii	"\316\021\343\275Kiw\3565\332\322-A\221\272\204\342(&wv\331\241"
+	.ascii	"\257\226C@\326QG\211\314\243e\247(\022\252\206\3522@H\344\202"
+	.ascii	"\344w\270\255\344\355\346\360\037\273\343\252\033\365\275\327"
+	.ascii	"R<"
+	.text
+	.section	.gnu.lto_output.part.0.49.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`q\001E\016"
+	.string	"6\232ZB \255&\035\007\301\004\244"
+	.string	"\330\362\226\376=b\032\247\320\b02!\316a(w^y\230x\320h\321\2169X39$\254N\013\270"
+	.string	"H$\026\025\\\025UY\216d\020\260\031\230\225LI${K\231RE"
+	.string	"L"
+	.string	"D"
+	.string	"\326\241}\016\242\023\333\376\206\257p6\315\3530\230&HPH\250\021\273\033\017\261\003\250\016\337/\252C\275p\356\232\217\363\263d\032]\237\372\323\200\022\242d\222\360\264\370\233\340\330][\023nx\333\005l\037\260\017\"1\241W\354\236`\fX\234}\275\334e\357b\232G\261%\026Rfv\227\300\313\243D\335Fxi\277\303[\270{h\020\200bKZ \f\350,k\276\263\306\206\350,\"\357\326\344\304\232\266\306\006w\026\021\353n\212\210\231\335N\300\241c\252\2516\203O\276\004\025#\351\310\327\324\247\276!\225\030\311\232T\025\353\373[=\271\3224\374\313\377\216\372U\323\371\356\377\246\002ce\327\244\206\304V\200\0372\\\346\366aD~\312\227LL\b\033Q\30084\f\240-Cp\205|\200\350\202\220\002\365\360p\324\234\f\355\343I"
+	.ascii	"\3322\315A\007\210\366\351x\304\254\023C:\035\236\310\331>1\003"
+	.ascii	"s\246}l\021\224e[\274l\347\365\344\247n\221P+}`\273Rs\214(\211"
+	.ascii	"\252\212\355M\372Y\3654' p\002!#\353\001.\236!\003\306(\236\350"
+	.ascii	"\221\207\021\376\030\202\305\310&FQ\243\031\n\f\220\314\326\030"
+	.ascii	"\265\366\355\227\250\003\265!RF\204\357p_\f\036\354\332\331\236"
+	.ascii	"\rZO\255\335\f#\372&\327@\200\003I\204\306q\354\254\006\311\027"
+	.ascii	"\271\0204\357t[\210\236B}\351\265a\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`\336\002\235\017"
+	.string	"\304\026\332\003"
+	.string	""
+	.string	""
+	.string	"\002 \177\035\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\"\177\036\005\021\022\200\204\001"
+	.string	""
+	.string	"\003\002#\177\037$\177 \002&\177!\034\177\"0\177#\252\333\3426\271\200\202\202\200 !\177$\305\245\376\322"
+	.string	"\0021\177%\031\177&\005+'\032\177(\002\033\177)\005\023*\035\177+\252\226\312\206\003\005\027,\005\026\025\022\026\002\036\177-\377\377\377\377\f.\201"
+	.string	"\002\037\177/\204\264\206\002\0250\0241%\1772\002(\1773\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\020\027'\030\005\0174\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\r5\001*\1776\037"
+	.string	""
+	.string	"\200\200\200\001-\1777,\1778/\1779.\177:)\177;\003\005\036$\003\006\037\b\007\342\001\003\t D\003\n\t\310\377\241\372\001\001\202\001\003\f\r\242\001\003\017\t\340\365\321\360"
+	.string	"!\221\205\327\307\003\001\304\n\003\023\017\250\270\275\324"
+	.string	"\023!\203\254\200\226\001\001\304\022\003\023!\344\377\220\375"
+	.string	"\001\204\032\003\023\t\365\215\225=\001\202\033\003\023!\222\357\362\035\001\344\033\003\025\036$\003\025\t\371\367\325\025\037\343\200*\001\304\006\003\025\"\351\314\200\001\001\304\007\003\025\023\253\342b\003\025\017\353\302o\003\025\t\204\267\037\001\342r\003\030\025\302\006\003\031#\031\037\031\202\007"
+	.ascii	"; \260\002\031*\263\003\342,\242'xk\242\361:\352r\024\356\022"
+	.ascii	"\r\030gX\254.\037\026 z2\353n\025\374h$yqI\b\273a\254\307\340"
+	.ascii	"\b\016\004\207\013\304\311\322J\023\306\260\263\007\002\3041"
+	.ascii	"4\332\261\254\367\016\222\242\0062\216\230\021\307\035J:\f\006"
+	.ascii	"6\361\037\230\314\3034\243\200\375\005\227p\013\311FK!d\035\230"
+	.ascii	"w\\\200\316\231\353\r\250\034\344\360\261r\3525\251\307]\023"
+	.ascii	"*\003@\375\243\203\016\226\023"
+	.text
+	.section	.gnu.lto_.refs.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\315\006"
+	.string	"\366\3210(p\265I:\374\377\377\377\377\377\377\377\377\377\277\032\021\237\260\035g\230\030\366\351[\373M,Yz\373\033\021Z\333\3156)S#"
+	.string	"$"
+	.string	"'"
+	.string	"\217\372[}q\337\334\247\353\210\373\345J\365\002\255\244\257\202\2116\274i\304\r\345\201\263e\370\241$\237"
+	.string	"\002/;\353\205\325\021\322O\332%\212\027\\'h\217\034\177\034\177\216;\307\327\361S\034\251W\324\223\315P7\305\003\n\2760\207\362\001\322+\254O\350O\326\037\364\r\330K\032|`\361H\277=\357x\270\363p\306\363\213\306'\005G\253\001\013\2245\322\245\206:\212\252\224E\364:e\232hSHs\242\365\246\265\361\003{\246q\205}\333\t\351l}\240\003\002\006"
+	.ascii	"cc\276\200\330\231\345\241\265\351\\{\213T\023\224<"
+	.text
+	.section	.gnu.lto_.decls.e56bcb8492e45643,"e",@progbits
+	.string	"(\265/\375`G)\225\266"
+	.ascii	"\212\034\245>V \fI:\351\312\325L4\322\355+\215\0043c#~\351\b"
+	.ascii	"$\276\340y\355\357\325}\275\352\"\244\333\272\230\307=\277k\334"
+	.ascii	"T\3017\353\221O\031h^\027\r8~\346\242\210Y0\275\214MJ\354dJ\304"
+	.ascii	"\271\004;[z|\345\345\f\246\205\342\335\017\"\211{K\231\002R\003"
+	.ascii	"\346\003\343\003\366\215\206\323t\322\016\22154cm\337I\177#\033"
+	.ascii	"\211\341BP\001\n\370\342H[[\356c\r'\006\201>\357\273s\004i\025"
+	.ascii	"\244m\007\306pn\360b\rg]b\f'\233\3619\237\301p*\251\230\027\r"
+	.ascii	"G\216J_\222\2669\fXF\313K\034\216\266c\272\274\270\370\342?2"
+	.ascii	"v\n\311c\251\355\030\246R\016\323\312-\017}\t9\206"
+	.string	"\3439*\017\304\310\372\346\256\307!\211i\204\257\261\276*V\222,\231O\222\313?\2668$O\326X\215\003\265\344\362\217\3010\036\367\361\036\207\341/,\206\275\260\037\353q\223\371\330\356\314\205\357\276\201y\257\022Ca>nc*<\327\343\203%Z\237\002~\037>\246\343-<G\305\2742\370J\fI\0276;\261v\257\200,\f\267\203d^\250\016\226\311\345\371\214\203\022\314\307h\254\306!\351\336+\033\030\222\240$k\374\335\313\324`\203\006E+/`6\330s\030\332\2275\234\036\370\307\026n\301fiG\026\022s\007JR\t\260m\223\353X\313\1777\350\244)\242\205\245\3203\024zfB\317I\350Q\200\276\005\312W\030\0137;\360\233N\232#i\314\264=\t\320s\207\223\003\271\303\371\"t\203\024\236\302\315\017\354v\216\302l\257Ab^\346\275L\236^\001M\332\222\266\017B\317\037\316\032\030\310\037\316w"
+	.string	"\355a\rg3\206\323C\005P\022j\315M\330\311Y\215\323r\224\230\254f\357Eb\316`\2079\203\032\267.\244%\247}\b\350=@O\260\206\223\225p\031770\223sP\342\025Yv\227\367^\036\326\222\224\254j\373\022h\005H\267\304s\320\024\334@\336p\276\321\0364\326p\216\361\262Ce\212\201u\321\356e^\340aJ=\355h{&k8Q\306p\376\315#\202\326o\376:\001\033Ty\236\277np\242\017\320\022\350\020^\374|\202\237\217~\276?\247\340\347\024~f\3613\362g\024\374\\\202\237[\374\254\302\317&\3709\251G\021\021\320\t$\034\377{\370\253\315\371W\001\034\271\001\006\3607\b\034\236\341\257\310\030\026\324\277V\360\234\277j\370\271F\2438\316_3 \203\301HG\340~\307\353e\177\360\367"
+	.string	" \360\001\217\351\007\334\001\335\200\346\340&\376j\334\200\003\0358\300\207\004\334"
+	.ascii	"\177]\361\267O\210\237\373\003\fA>\360\n\376\352\201\277\321"
+	.ascii	"\237kkp\364\257\035\232\274\347\257\031\330\201\201\237\263\032"
+	.ascii	"\001\034~\276\3729\347:\177\245\300\317^~\346\373y\357\347\274"
+	.ascii	"\237\357~\306\373Y\357\347/\r\342g\267\237\271\374l\367\177\347"
+	.ascii	"\257[\376\376\360\267\207\277;\374\335\363\267\315\317d~\366"
+	.ascii	"\373\031\314\317K~f\376\234\344g\262\237\217\374\034\366\363"
+	.ascii	"\327\317A~\006\362\363\217\237{\374\314\365\363\326\317;~\326"
+	.ascii	"\372Y\371\263\324\317\311\237\237~\216\361\263\323\3170~n\372"
+	.ascii	"y\351\177\223\377\177\377\307\374\254\364"
+	.string	"3\212\237?\370\371\001?{\3603\003~>\361\263\211\377'\260\317\317$~\036\361\263\210\2377\370\371\303\317\031\376\247\370y\347g\235\237o~\266\377\313\374'\363\177\371\337\203\377o\3773\004\006\006\006\376\247\223\277&\370c \024QLM\244\250\013L\315\254\250\333\314\272=W\tI\331\244t\225\027n3\353\313mbE\36505\261\242\230\232Y7\270\212\t\017K\324\224>-\037\214dR\272\311\247*$e\317\034\023\023\353\336\335\313hKWI\200{\253\260\224wHS\034%i.\231\344\004\t\213-xJ\322\302\272JsLE\260\356-\222Dt\237\026\200d\316]\037<\207\334Quc,\335{\301\323\275H\276s\367^\344\2757\250\254b\336{\243\207\311\353\351\351^\252\rO\267\n\311\266to\243\341E\211bjja\371\260\2315\275\356\013&\222\275\356]\226\022m\"\225\334\030\367^\016\203zE\315"
+	.string	"\323\266.\331\364\020;\203\021\006=\037\341n\236\233\335\254J"
+	.ascii	"H\343\243\021\242&\ty\023\"$\013z^\326u\227.\311\345\037\224"
+	.ascii	"(\355\026\246\327\007\205J_\311K.\303\270\340\265\336\035\230"
+	.ascii	"\026S\002_r\371\367\005\316+M\217\251\310z\233L\377U\244\016"
+	.ascii	"l3\r\330e\032\r7\373\fky3i\263\345^\026>9/\237\276\276\262\203"
+	.ascii	"\274p\357\2168/\270\326\202\227\\\2065\2267\003xI.\303\372\254"
+	.ascii	"\3174Z\257\231\330K.5\270q\001ve\345\0021~g2/\357*\314\333\257"
+	.ascii	"\301N6"
+	.string	"8\256\030R\320\3335\364\326\f\275\025Co\205\350\345\331\267?22^\336y;OG\2604\355\350rw\023W\327B\013\\\336w<PL`m\333\016\347\311\026[\262mo\3319\303\022\246\243m\267\2003F#\r\254\235x\300\3148\331Qi\241\333i\213\302\024d\356M\207s'\265\005J\333\316\322m<6\260f(i\333rA\031Cn\334h\333q7^\370\336\332\030\256FkL\036\224\266\267I\364\265\fJ\342\212\225\023\255\t\2213U\336V\356\006\001,\032N\370\334\246\334\374\020\323\003\215\224\367\224\357u[\035\331\262\215m\230\345\350\321\306\266\305\245ej\314\216\024;\0304\356\3203\327\236\240c\3120\3058y?Q\313\271\034\230\016\220\211\230V\373o\263C\027\203\005\034jM\350\304\272\314\214\t\032\361qE\246\323\330.\370\202\206\036\221,\350\2430\206\363\274s\265I\331\271\331e\\\006\004Y\246"
+	.string	"\377\306\230\314N\363\205\244\331H\232\206\r\323-\200\323\024`X\355\352\345i\247\f\254W=v[\206\245S\221\244\342\240\210\301u]\\\214\2440nvX+\215\300\274\310\022\320L\001\376]\2452\304{\f\332D\272\b7A\264\221\367\027C\271\215\022\3636m\354\302X\241\265\265z\350\031\304\311\303 Nf\016\024\324\nXC,\2304,#^\033\274\234\211\223\023\002B\247\214]RX\220\256$>\202li\373\356\372{\205\006r#E\025fJ\333V\262\206\223"
+	.string	">|\336?j\360\360\302\324\265\315\240\207\016t\357\257\314\354\211\024\303i5\365\261\341@\223\\\376Y\261\331\016\222\211\201\231\3442\254\247\250\330\2542\275\202gIL}Un0\334N\275\367*\215\027\024\033\f\327A`s\365\216\316j\255\336j\254\346\301\315\326\321W\357\034|v.\361\373\264\216\256:\303ywa:zl\260\255\240\3575\364\335D\337d\350\273\013}[\241o'\024\004\007\326h\032L\252\262\230m\3374\376\226\3213\030.'\252\205)\311\266\350\275\214\341l\245\317;JG\027T[\333\007B\261Zp\214\212\026Z'\373))%\211\224\266\357\247%\217\333\005\363\326\326\307\347\035\203\223\230QR\305\t\306\030\215- \314\245\r\233\031#5\332\366\213fz7\365R7-"
+	.ascii	"\353^\244n\3429s/\022\017s\006\314\031X1-!MN{\006D\377v\321J"
+	.ascii	"_\270\250\220\035UhH\332\332\030\265\354\t\026$d\177ba\313F\333"
+	.ascii	"\333D\225yES\3066U\273\234\213,\273PA(W\270\374\376.\023\025"
+	.ascii	"\b\034%"
+	.ascii	"NJ\350\254\322m\323-\023\007%\256\027\366e\207\324\326\276\270"
+	.ascii	"]\242\212k\353sa\227~\233\033\"<\232``\320o\200\226IEE\265\265"
+	.ascii	"I\327\353\"z1\276\264\265Hw\313\241\342\362\307e\221rZuImk\232"
+	.ascii	"\032\310\315\277\331\373\235\266\027io^\320\247\200\377vV3\257"
+	.ascii	"g~\033\233\266+\036Yu\200M\354px\311\241G\253\240\0373\246\222"
+	.ascii	"\331\200\205\374\002B\312\027-\277\277{\251@\234f|b\\d\300*\036"
+	.ascii	"\330\234\020\036~~\365\005\367\334\253e#\312\315\324\035\017"
+	.ascii	"\266\266GaT&\257m\334\254L*\230\rJ\230H\234)qU!t\242\230A\222"
+	.ascii	"\326\366K\020\211\213\335\0254\350y\351V\251\344\365U\361\322"
+	.ascii	"\367V\343\276\262\364Yi\261%^\037^\315R\271\360\034U\317UZ\373"
+	.ascii	"\253x\025\313]^\355\253|U\257v\251^\352\0367+^\225{\225R\247"
+	.ascii	"\370T\274z\245\013\217\337\330\331T\217u\273\036\222=\273z\307"
+	.ascii	"\315\312\245r\251su\013\316\223\276@\026,\320@\007L\013w8N[["
+	.ascii	"p\302\344\n\323\266\326\005\251\246\336\\\304\321q\263jA\305"
+	.ascii	"\204\261\231\321\253\362C\013\013\372\340\024\364\3013\264\302"
+	.ascii	"\241[\372\254\224\240\017\222\241\017~\241\017\016A\037\364\201"
+	.ascii	">\270\203\212XM\023\213\237\034\026\332 \030\303Y\327j\224\312"
+	.ascii	"&\026eK\215\n}\205r\201\037Y\324\356vV'\257O\336\204x=\315@_"
+	.ascii	"\233T\265\273 iJ\332>\350\204\276\246\251\005\372\331h[\321\320"
+	.ascii	"\245\023\315\207\033\253\265\0348*\332_\315\352Y7\225 \020\r"
+	.ascii	"\231\266\277c\r\247\316)\207\326\262ZV\227\2407NI*\020=E\f\220"
+	.ascii	"\310\305\274.\351\266<\253/&jQ\242\364\024\024\351\343J\222$"
+	.ascii	"\fG\"\330$\211\251\357d\216\215U2\313\274Q7ZMS\200\177u\231\203"
+	.ascii	"$\265F\007\206\376\334B\367\366\332\n\352\002\260\206\235\233"
+	.ascii	"5\254\276\3408\252\0208;\252\322\3204\241\325\253z\325\257-V"
+	.ascii	"S\200aF^\277\\\004\021\222\326\266\026\351\266\271\265\032=\332"
+	.ascii	"V\"\fgY@\323\245I\333\312\302\371\325L\002\322\266\016\271[#"
+	.ascii	"\235yC\202\311A\2359\221A\270Y\203\334m\204k\265b(o\210\327\374"
+	.ascii	"\241\025H\005\322V\370\336\272"
+	.string	"2z?~\260\332\003\275\256\222\031\3425qh__[\251[\373\362\245\255\264W\360,)\255o\253Y\267\030\216\004\337\027M\222\240\372\356\265\022\"8\207d\257\312\215\n\225:!^T5\007U\325\312z\325r\223\323\262\304\327\266\352\300\2526\252\215zUwc\n0\314\352\365\312\215\355\313\216\254m\255\352\266\263\n\362\306Y\333\212\203\341\252\027\035\236\217\266\365F\213\351<\rA:\273\233\255\3016\026\327\3665k\350k\230hU\326\250\252\254R\347\275\314\304\202R\326\032\257R{:\\2\242\364\332V\032uF\225QW\327w|\225PS\200a5](\037_[A\221IwS\200\177`\300\264\037z\343\243\013\032\232\332\333[?a\252[\273\220Q\321\200\203k:\264\347&u\001\342U\231j\323\033\357x\2357\302\2757\330\004\203J\t\342\357\377\274H\312{\257\214\032\346U&\345\234k\230A\374:\\\231"
+	.string	"\377\355\275\027\250\270\027\351\326\347\207\022\201\202\204\243\355}\315\334\275JY\310\017\262\242\224\262\246\230\232Y\027\251\024\004yAy\263\220L\315{/\\%%d\bX\367\002S\363F]\027Z\242\3702\263\220W\t\353^\270J\027\311\003\223RV\307\241\260\016\211+V\020\203,8\376"
+	.string	"\035\213\322\020pN0Z\021d\203s\"\021\027\030\211\305 \341\212\263\205Q\020\221\361\250\004\343\210T\350\250(h(\034Q4\036\215\b@Q\321\321pH\034\006\217?'\013b\221\350H\034\006U"
+	.string	"\245E\366\230\032W\244+\316\023\2110\376\030\031Wp8\241\205\021\021\204\013\216'\0221d4b\310\bC\320\360H\204cj\304\031\252\350cjL\2135\306\237!\243\234\343\317p\310\250f8dT\211\216C\303\264\350LK 4Z!!\240`\013#b\220-\036\215\252P:\034\022\026\001\005\205R\343\2215\006_\374\0312\022\241\323\242x4\n\207R\02308\n\207\02402\222"
+	.string	""
+	.string	"\026D\023\2127\307\037\243\006\322\025\302#j\324"
+	.string	"\2211-\252HM`A4\341h\004*\352Y\221\036\215-R\374\030\031I\020\3420<2Ah\230\032\203\303\324\002(\210\214GE*n@H\203\322\"O*D$AX\024\024<\217GF\307#\242\016\t\021\307\"\220\221\b"
+	.string	"<HXL\207\351\020\372\005\230\330\300\304\t\025\202?\321\001\211\016H\234?\321\201\217O\007&|\320\233\360\251\307\264(\2021=\266@\241\302\021\307\246F\240\264(-\006qR\260"
+	.ascii	"*\n\335\244%\020\246\270\031\032\n\213\307\024 \260\2601\032"
+	.ascii	"\323\342\020\261X\302\220\002\305T\205q\bT<\301(\314p\004JQ8"
+	.ascii	"\026\201R\"\233\240a\013cZ<\205\322\240a\213\024F!\232\3418L"
+	.ascii	"\215V\305\021\n4\375"
+	.string	"\031\022\205\307\240\264(\f\301\310\270b\347\036\214@)\f\201\202\316\343\017\007\n0\376\244EB\025\304b\t\031\212\210A6G\343\221\b\204\"\300\202X\2649\026\323\024\206\302s\004A@E(\360\030\215\351\360H4$,\242H\217B\"\026<E@\302b\232\342\2021=\n\213\034 \n:\002\241\200S\004\"\n\262\307\023\2110\026\323\024\204E\241\016'\032\245\305\021G\"\2618\002\007\005\240\342\220\215\361G\307\370\263\201c\221X\002\206\264\b\005\240\023R8\323 a\n\251\320idA,Zc\0211\310v\340D\320\003F\242\221=\376\230\3609\016\205G\350qxD\004\341f\230\246\305 cQ\321\221\b\251\361H\247\210HD\361S#\224\026\201\322\242\240\340\361\347\304q(<\357\343\003\202\007\r\\`\002h\220\b#\343\212\237c\221h\324\002\250\310\310(\024\032A\024\216\030\n\201V\214\b*\032G\210\030"
+	.ascii	"\013\242\tE\242\261x\024ds\246\364\"\263\202\235\231R\032\031"
+	.ascii	"H)\226\211\345\262\0322\306\251\255M\3022\243j\211\324\231D\210"
+	.ascii	"\016\254\262\372\025\304e\211\223\222J\206\003Wv\206\n\323b\361"
+	.ascii	"\335\216#N6I%\323t\265g\206L\216\213\335]\333\337(\331\"\266"
+	.ascii	"\210\035\263\331\361B'\244\310\337\355\327\355\230\025\303\343"
+	.ascii	"r\303\322\326\202\3310n\336\315\036\341\251\"&G\0249T\205```"
+	.ascii	"`\240\221JV\265\244\351\"S\311~\334~\374MA\231\315\245[r\310"
+	.ascii	"-\013`\244t\340hk\205X/0\257&]\232\327\333#\222\327\326e\203"
+	.ascii	"\360\364\360J\223r\276\367)\377\212\374\341\001\261V\301\344"
+	.ascii	"\230\231\255\025l\323\\\222@\037?\252\326\222\030\\D|\324\027"
+	.ascii	"2\336\226i\332feY.^\322\225\\\266\234X\232'[\267\\9K@\244\216"
+	.ascii	"\266\226G\267\235\251\264\001fw\\y\3710\262\303ja\351\272\232"
+	.ascii	"\252IhZ\227:+\264\0349,\326yF\267\202\030:E\344H\223\305\"\263"
+	.ascii	"yT\002\317lY\031\2674\254\fkU\353\324\216\3548\361e\361\230\272"
+	.ascii	"\265\272\255\032n\231\231\265\2658\330G\0303\246\033viH\236\223"
+	.ascii	"4m\255\215\r\332\nP\307\231\036Z\272\214\264m+\365\324f\304\252"
+	.ascii	"\255\255q>\035'JzT\331\03169\254\223u\262J.\273P\031\244\320"
+	.ascii	"\3510\251\202"
+	.string	"\203\n\352V\211\224\205\257\251\255M\242H`\200\265\265\265O-V\227\001\203\203\250\202\331<\310\342\224B\210HDD\222$I\007b\n\020\004bY\034\351)=\022`$EP2&\315\310\210H\222\242\202B\332\f?\b"
+	.string	"\276\301`\364\224\227qP\212\361\256x\020o\253^\312\352\375\242\366|\265\251w\364\330\351\004\251\237K\231\341M\267\"\207\227\321\345\265\235\316J\362\315\372\227\013\2430\260\323\264\330\365\247/,\007C\253\f\367\013g\035[\023Z\373\303\354\004\214\275\\V\263\236"
+	.string	"[\365\022\373\3441\366\306#\350\317\274\240Le\277b\371\240+=\261\266\254\252q\fC4\324\353\220\352\202\360\251\377\203\3477&\317\351X\"\0314\032\n\f\205\324Xi*L\215\243\b+\005\267Q6\347E\325\212{\316+f\241\\\376\316\207\202Z\340\257\\_\344\373U\007\035x\353elJ\263\330\204\027\360\325\"\240}A7\245\312\272\244\344\263\006\371\213Z\263\236\255@\300,\320\350\236\316\305\263\004\275R\222Ja\271\2377\213\022pf\371,\204\215e\305\377\351\326y\251\261\256\213T\341\224y\324\377\315}^\224\246C\203M\017\254\235J\301\245M\240W\021`\231\003\305#\271$\f\2535\234\336Ic\363\217\325\017\225Wr\340\005yE\0322\255\013\352s\213{\371\177\343\t\353h\377s\334Y"
+	.string	"\334\244wkj)n 8\334\254\266\266\002\354wf\364\360\fV\345<W\343\241x/\362l|\331qi\330p9\034\306\177*{7\355\314\253\272\200\256\262\210e'u\300\254\245\333\177\272\304\234\365x6\005i\234wR\267\307H'\t\376\262$\264\214<4IPX\312-\316\007\253\316\257`\355\247\335f\306\207K\332\343G\345\\\217\212W\022J)\263v\322\355L>E4\275\257\013P\306e\200;\306\213\037]v\2319\267\304\205\342\f\007\216g\305"
+	.ascii	"(\005\030@\352\033\306+\207\021\267C-:h\227\006\231\007w\254"
+	.ascii	"t\247=\023\345\257J\013d\036W\306\352\224S\235LU6\032\263\264"
+	.ascii	"\222\272\f\253\234\253_crIr\336E\005\347Q\3200\n\232H\316O\b"
+	.ascii	"\030\367\324~\244\240T!)F\263\377\201\341\274\304D\020\"\225"
+	.ascii	"\371b\2546\310\375\337\2754\345\020g6\305U\r.y\033N\2112\004"
+	.ascii	"\227/\353\325p[\f\031\002\231:\345#\233\311\004\213\336\036\343"
+	.ascii	"\331\025\317\\\221W\2709\365Hq,"
+	.string	"\rL\211'\306!\030M\266\"cM\253\br\367\243\257\225\376\375\243\333\232\251\220\314NS\202\002,t\022\216\313\r\322\n\200Cxf4\2321\277\276\363N\260R\376\214\002\361J\205\302\f1\025\244\2107\231yW\313\020\337\323\250\375T\326\021\200\307\212\233d0Y\200.s\344\311J\345N\337\005\344\031\305\"\252\343\200\273n)|\032\202\340\251\225\250\307\255R0\330\n\350EY\n\214\253c\254i-U\305\027\013$\206\352A\241\250\206\032\231x\361\247\366\226(\202\260\360`\373n\375e\007F\203\032\232\336t\311\t7z\r*\237\003(\351\375\306\005\n\271V\273F\357E\022\234\210{tm\341\324\377\376\334\256\212\374\036\313\3273\324Le|\206\337^\241\362\226-NU\212\254\0061,hG\317>\372\022\343?\373X\274;?u\021\307\212\220\363\034E\221\366\236\370\211|gJ\253\224O\344}\201\317\022\017\352"
+	.string	"8;\241'\t\275\212r\322\204\022\220\344>\013\020h\273\347\240\266D\t}\375e3c\037R\336\t]\366\360\311\315\020\220\032`T\233\347[\375"
+	.string	"\235(\344\244\207\363\356\365\211*S"
+	.ascii	"\200\246N\217\025\220(\021\360\346S/\377\310/\270\275\225\013"
+	.ascii	"S\222d\376\004\365\250\r\360\"\260\223wo\327\002U\353\024Me\200"
+	.ascii	"\r\342\215\273\267z\005\201\004h\353\277MG\007\240\027\240\024"
+	.ascii	"P\035K6\224\2016\"\262\332\004!bA\351SK\330\256\n\361\005\264"
+	.ascii	"x<~\353\217\017\243Ad\221\324\344\263\207/5OJ\004\027\271\217"
+	.ascii	"\322\256\213\223"
+	.string	"\b\224\377=\263\221$\205K'\004t\2279\344\205\n\210\300=\347\212\274\332\236m\204\3473Q :J\364\300\2707\034s\300\031\275F\020\333\r]\256dKQ\354\301u\3551\316\271\006\210\001\246c2[\264\214Q \303t\313\261y0h:-\203\316?\221YGz`xS\021\202gE):Pt\227\022\302g\004\3739\346\206\201\033\021(\313\302\007i\361#Zk}\240\177\367\244\333\224^\005\300\231\242\206\2173\\\215\253\275\243\245Z\222\207\351\224\001\217S\240\255\226\203>\300\314\002$\242\265\352\336\2508)\262\026y\\\274\217\323q\305\372\375\241\216\251\rM\001\321\346&\021\207\343,.\225\3243o\271\027q\220\343\256\334\272\322\253\265\263\233\032ONd\t\217\307\026\241\232>\354\307\252\346F#M%\276D\215\313\262\257U*j\0054K\303S\206\r:\253\222A\327\240R\224\311\303[\366\310G\357%\342"
+	.string	"\360\353k\203\003\377\315\034b@\304,\317\016\201\025%\r\221d-\224\\\302'\374\247\334\303\032u\033\021\007\220$\020b\221\276\003R\026\305Q9\270\233!(\323\212\326\267\364Q\224\003\245\327\274`\373\273\327\374\376\372\002pG\257YyD\306\257,\326\021\202\242j\270O\025\220\207\207\364\006\004\214\353\230\307R\202\332y\0367\306"
+	.string	"\372\300`\314"
+	.string	""
+	.ascii	"?\303HN\220\363a\231/\376\026\333{X\031\356\006\344\f gc\r~\245"
+	.ascii	"\355\342T\325\305\225D_\001N\201NlPC\372\333^\376\222\305\216"
+	.ascii	"\377,$5\337]$\222\254i\373:\207\327\177\324\212\001\004c\235"
+	.ascii	">\213N\277k_\3519\243\031cN\354\375=\273\200\257\016M"
+	.string	"'\210\361Q^\034y\270\027\366\fg.\036\303\036\030=,\340\031\332\227,,\324?PN\352{,\026\363auS\357o\274\275\032_\337\373\204s\215\266\347\214\177\370\347\225\317\335A\342<\214\226\3362\006\323\306@\342\022]N\263\257_T\256\261\332\024\365\301\251\247\366\247x\330\200\330\251\335\221\036\367-\326s\025\033\270\017\"\273\202\242l6\177\3533\233\340\202\371\371\213\303/.\214\335\251\025*s4\2576/.\246\337\345\252\3575\254\241\245\3073\007 ;\342\361\013!n\344]\205l\363\247R\317\233<+\220uW\267\336+\376\317\204]x\310\244\215??\017\233n9\376\327\303\273\363+\377F\206g\332/\301 \253\232\257d:\260\304[^\034f\236p\331Pt\321\372\004\361\325?\013\363M\373%\032!\311+\364\347a]\327\274\f\213n&{\337\003\3327nm\216tz#\347\253\235\275\230=\235e\352"
+	.ascii	"\302/['\336y\302B\261B\274\265\333?1\303\211\201\2636H7\341\377"
+	.ascii	"\270\212\360\247M\231x\352?\250v\340A\205|\340o\034\237Gr\256"
+	.ascii	"\330\307x\323\226u\264\271\332"
+	.text
+	.section	.gnu.lto_.symtab.e56bcb8492e45643,"e",@progbits
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"displayPortProfileMsp_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"displayPortProfileMsp_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e56bcb8492e45643,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
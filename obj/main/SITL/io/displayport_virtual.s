@@ -0,0 +1,798 @@
+	.file	"displayport_virtual.c"
+	.section	.gnu.lto_.profile.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\275\007"
+	.string	"\344\n}\001"
+	.string	"\032"
+	.string	"\317\253\250\341\002"
+	.string	"\001\002\302\315\242\253\r\032\002"
+	.string	"\002\001\002\002\003\004\002\005\003\240\342\234\212\n\004\005\006\317\333\366\301\006\004\002"
+	.string	"\002\006\007\363\252\227\212\001\026\007\002\007\b\215\222\304\312\t\024\t\n\013\354\301\314\336\005"
+	.string	"\f\330\370\241\354\t"
+	.string	"\r\200\314\324\344\b"
+	.string	"\016\355\231\357\306\005\004\002\b\002\b\002"
+	.string	"\002\t\017\020\021\316\214\272\221\013\004\022\275\260\240\357\005\n\002"
+	.string	"\002\n\023\024\304\302\235\224\006\025\313\322\375\213\007"
+	.string	"\026\027\265\304\262\255\b"
+	.string	"\030\212\306\242\350\001\b\002\002\002\013\013\002\013\031\304\262\316\330\005\n"
+	.string	"\002\f\002\f\002\f"
+	.string	"\036"
+	.string	"U+\200\022\204e\034\320\005\033\252\214:z%h\266\300\201,u\267,\323^\205\017i\006\326\252\333\f\t\315#@g\231\241\302\314$\200#"
+	.ascii	"\004g\004p\2042\273pp,\245\335\200\rPcw\275\3128\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"]\004"
+	.string	"B\205\020\027\200\251\35130\023\222\t\231\232\b<\"D\205\214\210o\342\267\2242\005W\302\234\305\330!\016\335\320\013\273\034\354\243_d\364L\020"
+	.string	"\3642\255\277\nB\344H\t\323vli\032\344\270\226\323\233\360\024\001  \260\202\"\252\033\r\006\267\001x\\2\031\264"
+	.string	"ZIP\210\0301\2123H\001\016\334\352\206\212\271V0y\214,!.\203\3146>\230C7\246`\201b\314\300"
+	.ascii	"\300}\250\005\n\244P.6I\001\251q\n7\004"
+	.text
+	.section	.gnu.lto_.inline.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\370\003\315\020"
+	.string	"\206\027TC\340\224&\351\004\366@\026\355$<\241\262\337>\016%;\231`\336U\274\006<\0204\260\314K\263\274;\"bL\020\332\206\375\362\ff\360\016wX\3419bL\262K\246^\212\377GC\253\305f\355\023\"w\n6"
+	.string	"E"
+	.string	"E"
+	.string	"\217a\245\316\250^\373\302\257\265nY\367\375.\013\2728\0175\246\230\006\237q\303\230\356\223\342\035]\234\211\032S\314\350\342\267\372\013\231\t\363}$53\323\275\200_\220N\206\006$2}\301\332{tGw\2459\210\360@\201\213&\275C!\230\352K\216\205\020\025=T@\357\3203\266\270\037:G\\\250l\265\0245\344\204\262\376\2456En\264p\320/\216/E\201\330Y\241\340\317\001\231)\007x\367~\222\353'2\0234"
+	.string	"k\226f\bq\332\264\353Rw\234:\224\020\375\326JsCCG\205!\025\343\305L\202\352Q\212u\343\204\216"
+	.string	"rS\203\301\330\311e\002*9\260\326\031\034&\231\352\001\257\004g\233\373b\236\021\244\300lC\251l\350\030\331\211\340rH\320\344\203\3720\360g[\263\r1\317%\251G\304<g\233I+8\034\030\034R\022,\364C\022\033\021\020B\242\307\234\314\374\\ \205\300\345\306\367(8\234\fW\250\361D\246\220\bM4\023f\233\016\220\"\232)\342\003\022@t1E\022\2251\310\004\023L01\023ow\003\354\205c\335\202A\324"
+	.string	"\023\030+\347\"^\020\364\206\353\304D$\017\374\317\2653I\200Ph\226\370\200\362\246P\204`\215\243\236\216\321\235\214\016\334D\325\305?\251 yFf\241\204\r;0K\312;o\016y\273U7\356\211\260V8\025\227\004\202!b\242\370B\035\251\211\232&\315\3450LnF\224;\206\352\241\312\030\335\252\242\267\013\026\205z\201\325gOK\264'\210\254\022\2403\3632(\031w{\323\026\035$\302\354\376x\305\206~YNj\326\261\277\302"
+	.ascii	"Q\227h\246\355\035i\243\222\271T\026\036\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\340\002\265\013"
+	.string	"\262\31732pk\322\001\230\177\216\346\277\312^$R\323\377\377\257\241\255\t\260)\236\027\2626\331\223\217\020\256\214`\340H\205\204\354\315Z\"\245\330\244mI\267L)\005\235\250\300JY\206 y2\227'#e\017\223R\274\nY\302B\004\303\346\265\341m\006\032\020+\344\315\333&\fK\261$\224?j\f\331\234W\340\3606\tCWs\256\025\207\037E\346@\274\315\030VU\266Z\037\335\267\t\274\341v\240\025h/\227c\300\321Y\303\316\260\034\023\2039\360\215a_\270r\314\211\262_A\020\202\\\217|\257\313\355\310k\356\244\335\311\273\022w\237\332}\334\352\230\024\352\032\245\261\215\223)\001$\22622\275h\272\346\327!.\312\364\213\366\355\267v-\265Z\264\bK\250Q\265t\210Jt\177\003`\002\021Si\033\022"
+	.ascii	"bj\002\0324R\243p\206h\f\353\3570@\240\357\004K\332\005\262l"
+	.ascii	"\365\201\320\200\351a\262\331\211)\001<\224\277\374\370\"\t\224"
+	.ascii	"^\245\222f\357\243+\3169\311g\256\013\3539\n0\352\223Zh\003\212"
+	.ascii	"\303\324\rO\240\355dC\354&\232\022\327\320V\330\n\022]\341\036"
+	.ascii	"f]\361-4\026\030\2306r\016\2678\035\244\217\2369\001P\306(M0"
+	.ascii	"C0yQ\013E\225g\272U-\222\274?\313\355\032t\371\177\212\224\023"
+	.ascii	"\340\306\013\262c\2568w\222Nmp\006"
+	.text
+	.section	.gnu.lto_.pureconst.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\200\004\001\200\004\002\231\004\006\205\004\007\232\004\b\232"
+	.ascii	"\004\t\200\004\n\200\004\013\200\004\f\200\004\r\200\004\016"
+	.ascii	"\204\004\021\230\004\022\230\004\025\200\004\026\200\004\027"
+	.ascii	"\230\004\030\230\004\031\230\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"\305\004"
+	.string	"\322F\030$\220)\351\307wwK\016bw?@\377\252\003\021\344\002v\215s\370\320\217\002\375_\374#\324v#\255m\231\002/iI\323\003_\221\t\242V\024\030\373&\242G4\223F\371:\016Q\033\327\031W\350\261-\017a \b"
+	.string	"\336\271%\230\230*\03148e\213\353\317\2646\177\357\253\354\365\353\320\317_\t\027"
+	.string	"O(\263r\007\030\254\031`\250"
+	.string	"\2670\357\332#0\013\300\""
+	.ascii	"\017@\006\240\270\340\265\002D\340\030M\347t\242l\312\362\246"
+	.ascii	"\0052m\273\354\013\262\036@\021"
+	.text
+	.section	.gnu.lto_.lto.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_virtualGrab.21.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"=\007"
+	.string	"\302M26@o\222\016\230\016\303\233p\003\320\217\023\346v\367\177\206I~\2472\3000;\342\034\330\2203\323Q\204?Z\201\364D"
+	.string	"\026C\260\217\343\371x%\320\306\267\337\210L\001\030|\r\233A\236\320g\002\203\027\205\003\006\237\250\342\023\022\215\256\007\367.'q}\"\034\b\216\234\247\340'\202\200\016{\017\272M\314\376A;\027\025\306GR\253:\276\230\254N\337\002<8\251L\215\324K\266X*!\177\366\233\277\355K\322\222\254\321\242\002\231'TJfD8AS\353\250\371\257HG\262_\301D\020\223\002K\306\211Kf\272N9\231Z\230\016djU\037\315\332\262[\223\022\240\240J&R\033"
+	.string	"Cf\336J\246\215^\3657\370\027~\216\n"
+	.ascii	"\2423\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_virtualRelease.22.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"=\007"
+	.string	"\302M25@o\222\016\230.\372\360\340\350\350~\021BR\342\234\345\232\337\251,\300\f;\342\034\330\2203\323Q\204?Z\201\364D"
+	.string	"\026C\260\217\343\004u\312\371\372\333oD\246\030|\017\235C\037\021\250\002\203\227\005\004\006\337\350\002$\032\221\256\b\367.Gq\201&\\\b\222\334\347\3407\222\200\016{\017\272N\314~B=\031\225\306\307R\253@\276\232\254P\337\0026\nb2;R3\371b\261\214\374\331w\376\266\257IO\262F\214\nd\242\\V2\243\302\013\234ZG\316\177IZ\222}\213&\212\234\030`8Rd2\323yJ\260\251\245\351\300\246V\025\322\254-\273E\251\201J\312t*\265\0018d\346\315t\362\350U\177\204\277\341\377\b\n"
+	.ascii	"\2423\241L\213`XQ\201\272&\212X\210\nL\020p\302H\265\322\021"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_virtualClearScreen.23.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\277"
+	.string	"U\013"
+	.string	"\326\325NC\020\213j:\300\177K\021"
+	.string	"\200w\013x\335\377\355\357\276\023\354\213\240\363\374\237\023`@:\026w\220i\363g\206\004\006\2528\t\234n\n"
+	.string	"@\004@\204\006\222\252u\301$\213\305\003*\202\353I\331\320\226)\005:"
+	.string	":"
+	.string	"<"
+	.string	"\307<j\266\375\004W\020\332/\312\250Byl"
+	.string	"\320\322\260\273\333\345\226\354\030\345\023\331\261Y\340\3415\364\277\340\026\017J\021E\272>\200\354\256UD\t\270\347mc\330\376\260\237\t\240\311H/\332\302\201<M\222=\222t\022\260O\331\231\262U\255\252~\266q\242\300\260\033\240\354\260$V\341\200\355\320\256\330\276\332_\235\025~<\271\304n\352\202kw\3240\207\026S'\234\006\230\264\264\315\271\204\216\266\273\035>\204G\340F>\237\354\330g\005\013\301\252\244\2455\235\344m!\273\334\257\354\f\356"
+	.string	"\214P\355\226.\372\r\336\n\371\006\216Y\004\352\305c~\237\327e*\336`<\032\360\363\270\222\220\317\353@#\215\007$\342D\266\216\333H8\315g\333x\242\rs\341\016\304\361\266\257\353\274\2552\356\355\214\207J\2624M\326\351\352@\250(\\\314\360w\262O\r\021"
+	.string	"\2423\241L\2130\254\323\304\317*\020 .V\031\t\002{"
+	.ascii	"\343\376\232P\036\332r!7c\346*0\366\240]#%\245sM2"
+	.text
+	.section	.gnu.lto_virtualDrawScreen.24.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\017\005e\036"
+	.string	"\346\365\274J\240\226U:\244>\340\027c\235W\265\r\363\252_\274\026\337h\245\030\342}\3273\356\031\\\255\3630\244|\247G\214\001\364\243X\237(\036\360\005\344\343\235cN\n\362\232(c:5\364\300\354\303m\021\236\341\021\255\244\355\275\345N2\247"
+	.string	"\232"
+	.string	"\254"
+	.string	"\\\347y\326\334\362\003\363\2262\377x \300#W|\346<\223\230\0249O\344\002n`\3362\322|\217\373"
+	.string	"2WU\244\221\370\n\016\205\240\270\234\347\251\303=\300\275\255\277\335\333\246\301\235\365\212<_\n<\314|][\233\002\371/\buG\214,C\242\317a9\031-\2127\235\030\025+\016\3529&\243#\372\252\257\240\242\0333\242P\265\351\342\232\272\362t\210\030\2447\266\004\343\366\305k\r\2405ckF\f\252\t\220\256\\\310\210@\264\257|\202\243\345\220\b\343\364\005\341<O\246Cb\213s\354\314\254\203\231'0\333\032}\2410<\342B|\346y\236\016\370A(\2240m\334\362W\334\3337\214\030\305\343\370C\227\314H\037\332J\314\2671vqq'1\347p\177:\323\034\371\013x\362|\263\315\274\351\\\273\224i\227\362\254R\226\271\224c.e\331\245\034\273\224a\227\262y)\277,\345k)\333J\2716\345\256\224iS~\201{\245%"
+	.string	"\353<\213\226_\316,;\205\343\311\277\351\177z3\237\371Q|%\313\222I\247\"\t\346\355\231\201|\247C\261\354)E\362\tQ\2047q\225\351cdF\315`\021.~\3540\353\265u\255\3465zD\344\345\325J\f\033\332\234\311e)\f\255\371\255\207\270\332\231>\324M(KMh\315m=D\323\267\326\021\001q\272\002\242]\257\347y\236\267\225\370\312\303\2149nT\\sm[\317\364\320\255s}\243\243%\265\nnk\\c(Z\t\221l[\365"
+	.ascii	"\230\202\244CQj\270\205\332\300\332\252Q[\211o\333\3769U\001"
+	.ascii	"\242]TGnn\023\2501\365C\227\033n\244\307\206/\365\"8\034\242"
+	.ascii	"G?\354\335[\333W\036\301\322\020\036S\235\264\n\"v\323\364\301"
+	.ascii	"\b\231\202t\311\335U\304\211t;\240\362\246\001\275\343\240\350"
+	.ascii	"\355\324\235\234\034\234\033\313\363\363U\220\361\r\203\034^"
+	.ascii	"\017\317\257g\342\003\317\317\247s\202\227\243\263\323\003\241"
+	.ascii	"\363\365t$z\274\021\272\233\337\216\216\301\001\366\351\340\374"
+	.ascii	"t<>\337O'C\236\357\244\231pI\326O\007a<kf\013\337\242\005\213"
+	.ascii	"\371\302\263\354hF,*bX\321z\313\312\254c\232"
+	.string	"\326]%\323\263{\256\272\265\226\351\312D\310\024\314\360)Rb\372TI\216\262\216\002%\326\260\226\365k\035\353\256\322p';S\013\326\247*\036\315\306\332\321\214M>\334\362\357\356\253\315\246W\204HA\016_\262Kr%\036>\360x\367\366e@K\252\313q@c\250A8\346\230C\306D$\220\221\202\244\031\016\200\002\221\271+\017\021p\251D\211\206\211a\031\003\242V\3038\266'5\303\333\354\2628\234\336\362<\277\260\307\303^\305iI\264\275\232\374\001\362U\317\376\244\330\225\205\013G6\005\266u-\t!R\267\234+\\\3039\016?Fr\233\304i\310m\235\351\245oI<C\240\323!\347\023\247\326\324d\365\201!\251\215G\367\353\002\0244?$\001\243&<\027^\371?\024[?(\343\021\314\241vQ\272\213O\270/L\030\370\034`\375/\373\245\234\322_E\357\036\261\350\217\356ME\275\237a\2512\240"
+	.ascii	"F\325\347\247Z\206\335\263Fb\300gf\220\303h\332J\226\371\004"
+	.ascii	"\f\004\367\323\006Z\033\t\231\317s\221\332\243\004\355$\346\017"
+	.text
+	.section	.gnu.lto_virtualScreenSize.25.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\345\t"
+	.string	"\306\023E90\345\270p\236a%\311T2\214\23282\255\225\314\344\264A|\302\200\230W\371\3366v\001\370\024\325\033R\242\2275`h\030\006h\332\311a\006\005%N=\021\021\"eJ\0014"
+	.string	"1"
+	.string	"2"
+	.string	"\027\021m\026l\344Xm(\220\324\t\200\335\3556\037\320\236a\027\320\236\351\306\305\247\350\237\344\230+\243E\2652=7\205\335u\252V\030\267\3366\307v\202}N\232\3062\255\232\316L\237\323f^\nRv/^\256u\311V<l\213\266\306\366\323~\353#\342\307\322\003vY1*\273c\307\007\3343\217\234m?$V\305\"\216\242\332\271\246>\025\300\243\233\220\270\335\n\004\277\004\234\340:\236\371%\355\331\225"
+	.string	"\246u\312\227=\232R5\354c\273\273V\226\255\351\355\343\257\005!\370-h\f\362\204>\244\020\364$\030B\360\023Q|B\242\221\327\320}^\007\341}\036:\0208\352<\006\376D\016`\027~\037\330i\306\275\275\351\346\244(c\232\272\251\312X|\240\362\025\016"
+	.ascii	"\2423\241L\2130\314\210\t\030l\356\251\344\252\232M\351\255C"
+	.ascii	"c\031\273\006\226`\342\301\335'\325\212I\230d"
+	.text
+	.section	.gnu.lto_virtualWriteString.27.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\217\004}\035"
+	.string	"\346t\270H\220\332M:\204Y\020o\260X\034\026\302J\202\242k\032\313\337\364BW\205\371\276\252\265\353\022.\016U_d\277\301\035\034\354\303s\225m\201\240\251w\315\342\232\f\231\262\323\033a\346\257I\037\256X\221\304'do\"e\222\001\245"
+	.string	"\226"
+	.string	"\252"
+	.string	"\024\232w\215\032\354\256\365\364Z\345\205\231\222p\336}\326\233\354\036d\361\236Z\255\300\254\324\032L\260\f\310\317\r\222W\362%\273\335.1\370\243\034y_RO\330\324Zo\004\036D?\305\377\320\317\366\261#\357\236C\216t\212\315\273\375\203_\025_\351\3429\264\222\307\244\330Z\302-\037\223\221C\204\300\004\t\220\013_"
+	.ascii	"K\006\016\036\001\024\271qj\343s\247\354\321\312\027,\212\007"
+	.ascii	"~^h\354\224Qb\220X\0174\037\236\247\312\036\367\205?Pe\346+o"
+	.ascii	"\234\307\t\265\326e_9\343\013\340\273;dw-\354\2123\002\275\037"
+	.ascii	"oG\234\n\216\254\265:\330K\371\224\244\375\325\347\222P\342\373"
+	.ascii	"\224\350\347\273w\244i\223\005\305g\273A\0367p\367\016\306\276"
+	.ascii	"\202l[\355R\336\"\312K4\362\332(\357\020\345\025j\336\240\346"
+	.ascii	"\005j\336\037\222\327\247\247v'?\317\203\377\316\271~\235k\375"
+	.ascii	"\001\316\365%\257\365\035I^:\362\316\346\025\233\267)/S\336\017"
+	.ascii	"\030\265\210\t(\2535\306\331\233\nfb!\262\217\362\241\323\241"
+	.ascii	"l\227jhN\273\264\317\357\356vi\273+r\245\260\325j\324\026\223"
+	.ascii	"\nN~\001\263\307\304\"P\231\371\326\\X\203J\327l\340\332z\266"
+	.ascii	"\r"
+	.string	"\306\221-3\032\036vb,\311\036\354\277\034\214\303\207\035<\360}\037\350\247\255\215\250\324L\351\030\352\257.U.\324C\315p@\334\013Gn\021\352\3361&I\026P\213\035\324\364I\357\367\323\335@\335d=,\036\237-\355\237>\026U\330\362\2201/\034b\003\327\247y\232yl\205E\261\233\375p\217\336\365\244%\004\322\376\212\005\375\364\351\017\237\240HX\233\254\261\305\276T\034\236\3566\252:\223\212\003\305g\335Q\252\254\274z\271\261\340t~\\\271o\315\217\243on\236\022L_q\025o\322\345.\320\026IA\211#\247&]\022\n\020M\272\334\322\212\243\022KLI\"n\271\244\233\211\244#\245\033\222\216\351\246\300\300\346\226F\350nM\271\234\356F\013B\275\255\020|G*\013\030\250\346\t\311i`\323n\261\005\266\030\236\206\266\2012\334a\316h\r\311\006n\020Z\323i\262\247.<\0027\264\247W\344"
+	.string	"=\366\324n\006:\273\305\376\214\211\f\277\332\247\240\237\263Ov\261\326Z\307\006\376\211\216\335\323\023N\357\267\340d\327\372\302O#Uf=#\\hQ\223\301\361\224\021uQ\367\227\r'\023C\324-V\326&+\\\250Q<\305\220B\f\225\210\2104\005I\206\003`\002\221bf\334\021\3601\223\"I\242\2551\242Q#\370\221\337\337\243\254\257#[\361\354d\242\340b\2003\213[\346\260\272;\365\234+\007R\333\221\205\202\254\276\034\341\230\206\305\205\024\341\305\004}\347\2658\345\025\361Q\370\034\245\200"
+	.string	"\311'p\370%~=\r\243]!\245\305\026n\212S\260\362\222\253\340\036\362\227\357"
+	.ascii	"\032hp\307\3334\336\3055G,\317\177\272Y\\\233\022\235E<\316s"
+	.ascii	"'\2163o\002\016GD@~9)\017\3734U\215\274\007\267Z\262@h\301\030"
+	.ascii	"\231\221U\266\021\342\376h\363\300\275\202\r\320\024\001\037"
+	.ascii	"\245?f\327\273\016&\024\030\357@\323\357\336Ui\3076\177"
+	.text
+	.section	.gnu.lto_virtualWriteChar.28.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\262\003\025\030"
+	.string	"\346\353\230G\300\030Q:4\322q\232\211t^\215\020\002\305\227\003(\251\034\344\335\021\006\242B\372@,\2606_=g\353\230\353\315\262\221\203\375F\373N\242\371*\312h\357B\335s\3049\013\2261\206\352\027\377A\215\215\220M\244L2\202"
+	.string	"x"
+	.string	"\210"
+	.ascii	"\315\273<=\262#AqT-\267\264Xp\336}\356Gd\327\245x\252V \")\265"
+	.ascii	"\352\016,\202\322\351\352J\273\273'\362\"\262]+\237\256\207\031"
+	.ascii	"\226bjK\312\324ZY\002\276\002O\277\253\300\323\346q\331A\372"
+	.ascii	"5\313\366\027\372'\344\206\220\315Tq\220\306"
+	.string	"\351\311\244\211&\013\376V\210&\215\373+\200#\232q2\313o\325\333!\346\273\263\013\223\306\0342\250\265.\333\314\030\337\360\273\373\332\335\007\273}\024C\035\366?N\367\003\311\267\221\340\351\273s \r\311\315\370\334\325\225\334A\273\357\363<\317m\240]\312\273\242\274:!\257*\344\315\241\274)\312\213j^\234\346=5\257\t\344\275\001y\305\353~\233#\371k\256\344/\235\311\0376\357\327\274My\231\362\036@x\324\013`T+\214\023M-\242T\200\354\235|W\342M6\002\222XbW<\375\256lW\334e\002\304\201\222[\203Z\210\242\034\325\251\3464?\3172\226\260\240\272sx\031r\352\257q\032\\B\303\231\272\373\324\335\205\026\244\344s\3056\365\203\334x\265\244\363J#C_\007\355M\227\232u\264~\345\246{\300\360\0242=\034\335A+vMcH\302[\301g\366\273u\335\n\212*\0344\354\177\244"
+	.ascii	"O\305\376\356\004L\236\231\\M\177\375Rw\333\340\316Z\0227\225"
+	.ascii	"\321\324c\312mG\377\b\276\271y\210\206+w\303\241\214\245Zk\202"
+	.ascii	"\375\223\007\256\237\270\211\307`$\004q];\036Z#b\260\221\304"
+	.ascii	"O\fF\276N\264<\274D\214\031X\344\310\0021\266>\260\\0\021\254"
+	.ascii	"\235\001K\2764\300X1\222\204\261D\335\354\rd\340\027\372_\324"
+	.ascii	"\306\024\315\272\374j\255\025\\u\230\021\007\214N\257\272\265"
+	.ascii	"H\370\027/:\335\275/fr\252\346\262\305\347\206d;\272\214\032"
+	.ascii	">lPU\3474\206$a\302V\265\317\315\250\2264\333\013\357\205\b\315"
+	.ascii	".\n\366\274\027M\370\216B\005\276\315\002x\232\323<7#\0276R\035"
+	.ascii	"H\250!@\345\214r\312\320\210\214\244\245\2516\300\"!#\363\021"
+	.ascii	"`1Ee\222D\331\031\003\242\242\262C8\024\374\310\226\274#\367"
+	.ascii	"\204xAh\237\221cCD\304\215J\006\t\t\033)\373\002\217\322HF.\304"
+	.ascii	"\035\326\226\257\334\241\245\206\"\312S\b\257Y\025\3161x\201"
+	.ascii	"B\360\374\207gx?\376O\344Kh\223\220\347K\001=\367(\370W49\253"
+	.ascii	"'\366\270\360\270L\222\004\"\n\273\227*\037\300\253\372>D&\277"
+	.ascii	"\370\276\217\027\177y h\352\235\344\252\332\304\022\372M\360"
+	.ascii	"\223\337\\5S5"
+	.text
+	.section	.gnu.lto_virtualIsTransferInProgress.29.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"5\007"
+	.string	"\"\31636Po\322\030\214|s\341(b\342\306\374\206\323\263\023\320\251\n\255\336G\217\206 GDr\013\026\200)6(\343\252\"@\300\303\221\005\323\016\017}\331,\221F\266L\001\233\214\017\327\035\216\007\253\330df\001\261\311\250]`\036\355\223E\300\230A\212\f\233\200\035\371\201\034\203\243&!\341\026\243\204\327\\\355,\202\f*\364\023\364\250\217\327\314\356\356\024\351_C\213\311e\240\264+:\301,K\265\"\362\353\317\375\365\277\367J\242%\234\232`(\300.)Few\"\254\260\321\352\251\002\226V\033\r\260\264\372OX\340\356t\206\2104\241\027\r\024\323\356\204\024\210v\372\272UO\264`\344\344QJ\031\201\364i\034v\367\2671\342\320)\375\017~\206\277#\007"
+	.ascii	"\2423\241L\213`\370\250\260X\005\304]\306\274\256I\006"
+	.text
+	.section	.gnu.lto_virtualHeartbeat.30.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\362M36@o\222\016\230\016\013\177*e\244\026\346(+\374\277\235\364\321\373\022\321\313\314\2168\0076\344\314t\024\341\217V =\221`q\204r\252X\302\211\302\337\376\326\032\221)Y\204\f\235C\037\021H\"\213\330DC\026\341\210\002$\032\2210\207\007\261\027\201\201 ^(\222\336\207`8z\210/\2030\276\316\226\375\203z,\252\213\337J\256\372\370ZY\241\336\001t\274\030\260dn\314\310\244\313\245\022\362k\337\371\353\276%5\321\272U4 \023\325\222\222\271!\234\300\351\365\306\371\357HI\264_\261\266\324i\203\241\221\201\022\223\231\317\323\001M/\253\002\232^\025H\265:\355\366\244\226H\n\306t*\325m\0262sg:q\364\252\177\301\257\360{\004\n"
+	.ascii	"\2423\241L\213`XQ\201\272&\246X\210\022L\020p\342I\265b\022&"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_virtualResync.31.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375 \377\315\006"
+	.string	"\002\215/2pm\032\003\240{\375,\352\364k\256d\004C5o\032A\324f\252\333P\022\341\226t\262\005\247\332R\177\205/c\242\264\306\273D\360\275uC~)S\n\225\214\016R7\032\316DQIX\361P\311HYL\034\252\003!^\204o\002N\022o#;O\203\320HE\310W\305(\2374\357v\325"
+	.string	"\243e\264\323\303\332\2505\300\377\267]-\023\360HI \371A-,Gq&\035R[\263\326\037\006\261\034r\341\201\377:)\371\247B\0272v\235.\270\330eLp\261\253\325\252xr\0343\002i\214\254\374\177m\303\226\231U[\304\001\237\220\307\f\323\360\277\354\023\022\271\315m\017\3322\264\025\005\t"
+	.ascii	"\2423\241L\213\211\232\201\013\007`\336%\200f5\005\334\345E;"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_virtualIsSynced.32.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"E\007"
+	.string	"B\01645@s\322\030\030\374\234\260\356\201\217\"\3634i\327\371I\264\263m\345\037\177C\300_\203\330\216q\256\314\206\312\367\034?\372\341<h\027\331\337B\300[#\322\366\226)\231\214\016\237C \221U\221\311\313\002\"\223\021\273\260D\330\350\212\200\361\202\024\2275\001Cr\004A\005GLB\302,F\t\237\253\234}\247u\253\0062\236\306O\222{!\257\234\335\335\337\351\335\303\326\320\034\314\354\226nl\366\205r!\371\265\377\374\316\275\232\350\211\246(\030\n\260{\222i\331\235\b+x\224z\252@\245\224G\003*\245\376\023\026\2647\235#\245\316\006\b\207J\315\356\204OD7u\333\252)JP\302\002\023\263b\"\251\3534\354\356\256\303\344\241?\375\r~\206\377#\007"
+	.ascii	"\241\223\220B+\231g#+\353\351\232\207\354\020\346uM2"
+	.text
+	.section	.gnu.lto_virtualTxBytesFree.33.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\225\007"
+	.string	"b\01656Po\322\001\240d\217s\351\351.\006\340\f;\270\0320\344\231*>\004\0215\0049\"\222[\260"
+	.string	"L\261Aqn\306D\324\364\030\207,\267\240\2008\233%\204\354\235R\332\224\r\226;\034\317E\241M\254\342A\2332\263\270<\331\007\203\210\022\213\023\330%\021;\363\0239\006\226Y\304\214\232\2243Zto\007\324Z\353\271j\203\0013l\nzPd\177Z\030\262\237\003\251\364\202\300\262\313Qc\226D\251\200\330\336l\313\366{\366I^\262\235^\\`7\004\223\262K\023\254\2409e\252\261\355\213|d37Q\217\016@\364\241qR\332\245qs\202\352\324\364\201\352\024\034\235\373\343\374\233\274 d\245\305\005\245\003\375e\030v\327o\243\353\270\341m\037\330^\260=\n\n"
+	.ascii	"\2423\241L\213`\230\245\202uM\244b\201K0A\300\t#\325\312K\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_virtualDisplayPortVTable.34.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\215\006"
+	.string	"D\013\324"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\346\302\005\177}\370\345\222\005{y\270\345\362\003wu\370\344\242\005sq\270\344\322\007{o\370\337\242\005mk\270\337\302\005ig\370\336\262\005ec\230\336\002sa\370\335\302\005s_\270\335\202\005s]\370\334\322\003s["
+	.string	"?\202\210\200\340\001YW\306\001U\305\001S\304\001Q\303\001O\302\001M\301\001K\300\001I\277\001G\276\001E\275\001C\274\001A\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/io/displayport_virtual.c"
+	.string	"\f"
+	.string	"\200\024 \205\fD\003R"
+	.string	")\200\024@\n \005\220\022\223\0243I\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_displayPortVirtualInit.35.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`N\002\325\021"
+	.string	"&\240qG\340\2626\035BBC:BV\241\260\035\005\214+:R#-o\013\251\020\023f\201\020\342q)\300\263\331\237y.\216\250]\266p;\361\376{\345\346\220\234\006\021\244\360\236=x"
+	.string	"\222g0f\202s\312\274\215\032\2212\245X"
+	.string	"V"
+	.string	"c"
+	.string	"+vwm\355\026\273\263G!\fVm\004\nZ\236\303\342\235\363\003\321\317\234c\211\023p\327l\3738?\321\342p\300XCC\202\361\221\341\0012\347\350y|i\273\306}d\273\266\"\036^C\377:\317nlb\342\214\313u\344`\316i\025gh\356\275m\003\266\033\330Z\006\327N\276'\344\346\204]\364W\234E\212?\342\232\277P/^\363\303M\303K/Z{J\2240\353b\217/\272!\354gsA\270\373\370\223V\315=\347\037i\352l\325\253\251u\325\027\351~\212JT\314\351!\026d\226\032\020\t\237<\212\357\254\234\364\204\0367s\316.B[\001\3623N\001jd\\\350\244\302\351\204\2022Q\306\254\213\263\265S\017\212\321mF`\267#\355\356S\020\311\f\321\265U\177\301\" \307\234s\001\320E\037\334\352^\347#<Dn\030\333\227\333\307\374x\321\230G\373=\317\037\f\331\004\311\f\201i\314"
+	.ascii	"\364\344}X\334\2341-\356\002C\266bm\254-\257\326\247\312^+\037"
+	.ascii	"\230Ye\322JmP\001W\034P*\340\347\352\220j\271^+\013\336\267\362"
+	.ascii	"2\254R)\236\n|y&$\376\\\027@O\345\373@\257\033a\337\241C\347"
+	.ascii	"\020rJ\330\276\270\244$\007~\236\3430\331\370\215\b\022Lz\321"
+	.ascii	"\264\355\240\240t\347\244\236\330\207~\032?\371\032E'\024Nz\021"
+	.ascii	"\247\244[\336\0014 \320\"\232*zB@0\254 \205\361H`\336\323j\261"
+	.ascii	" 5\355\263\033\205\020\033\235\005\006[\220\341\240\2653\364"
+	.ascii	"\235\343$\203\236Y\201&\231\013(\347\007J\246\3266\214\277\301"
+	.ascii	"~.\026\354\030\225-1\254B\023\\\177d\b\330!\tK{j\316\207H\032"
+	.ascii	"\336\002k\242\333\302]\321\320\031a\211\310M\221\301\303S\206"
+	.ascii	"\252H\343lX\342\020\321t\345'"
+	.text
+	.section	.gnu.lto_displayPortVirtualBuffer.36.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375 \374\375\006"
+	.string	"bM15`m\322\001@\203\232\033o\004\224\013\023\\-\f\335\r\305\260T\2306o-jiY+\261\025\373\212\304\264\030"
+	.string	"`\002\322^\321+\246d\361k\226l\262wJ\001\306P\231\252\341\232\321\001\341\232\322\332T\031K\023\023\240\214\220!V\013\02035\220\"\260\264\024&\274\244\234p\252{\027\262?\260\313\256\347\324\367x}\360/\376\274\301\332\351\237\217I\177\003\036\007a\327Ns\024\366\243u!\273M\"$\224\311\256\304\212\312\216\274\220\f\333\034{\3627\316\301q&P-@/9\211"
+	.string	"I\331\255\320\365\001\322\337\345"
+	.string	"\322\237\253x\366\226\371\357x\244\201\201B?\2357\313\301\356\272\321\017\350v\267]`\333\300\366D\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_displayPortVirtualStats.37.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375 \374\355\006"
+	.string	"\242\21514`m\322\001\3005\004\030\243m\020\342\027\323r\376}EP\004\025r\3017\213ZZ\326Jl\305\276\"1-\006"
+	.string	"\230\200\2641\240F\220D\2647D\273\355\235R\276X0\324\203%!\204\202%c\245\2410U\006.h\204\352"
+	.string	"\251\006\275\310\214Z\f\034+\006\251V\214R\247\271w \373\343\252\354v\236\371\036\237\021~\306\2375W{\366\347_\322_A\307I\330\223\323\234\205}\312\356\256\035\310nS\t\211\202\354R\234\230\354\310\013\t\331\336\330\223\277q\216\2151\202\211\361\t\020\215&D\243\335\251\236\037\220\376*\027\220\376\334\305\2617\314\177\307)\032!\221\314\303y\003H\330]\267\314\363\271\335m\037\330F\260]\021\007"
+	.ascii	"2\003\336::V\be\256!Z\210L\334\025S;\311"
+	.text
+	.section	.gnu.lto_displayPortVirtualResetStats.38.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"\035\007"
+	.string	"\002N24Pm\323\001\244\005 \253\036\320R\257\r\235\n\312t>\363\240r\355\216\363\t\302Y\365\333\235\335 Sf\205h\316 \252\020\177LM\346h\215n\335\310\226)\005\306\\2\323\306\222\324\202\201%cuM\231JC\035\300HA\005jJ\200\030\251\201\027\213c\205 \241\025\243\204\024n\017\355\353\024h\035\347=XR\313\375!\t\374\032\347\256\312\266\313\371\3647\316\261\361/\036\231\341\322\317G\376%=\262\033\034\364\323\332\361\351 ^fs\231\276\n\373\320\276\216\375*\023 PdW\342C\262]\344\201a\373\024cv\310\271m\357)\211\360\214\354.|\026\307\256\230\377\214\003L-\273N\bv\327:5\212\373\335v\200\355\001\333[\b"
+	.ascii	"3\241Y\037\210\004\314=\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_displayPortVirtualLoadFont.41.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`W\007u."
+	.ascii	"\252T`\022GpZR\007/\306>g\342\203!8\267\327\250<B\244T\354\366"
+	.ascii	"\0232\267#\315\253:d1\342m\230Y_@p\024\353\303WY\223\277\214"
+	.ascii	"\rRr"
+	.string	"\3012\366\026chj\374\337~\377\377[\253)I\333{o\231dJ\001\024\001\005\001\016\001D\330\273\257\332\235\270\232?\333\327\335k0p\006s\346e\0033-N\255\253O<\355\312\241\310\250\261\240\351T>h]\365,t\247\221\b\313\231\275\0224\331\316\206\2566S{o\267\2379\332\2253\231\34199\217uy\313\331\231\324\nZW\333\351=\253\253\255\357\254\256&`p\325Fw\226y9\220 H569;\227\036H\333\362\332sv\354\364\006\276\321\205A\340\017\307\327\343\265\354\252\342\277\306v,\027>\375\t\311%\215\330\262\314\203<\332\374v}!/\220u\372\261d\372Ol\031\3468H\224;\256\017\2142\f\023\271\351\270=\314ry\025q0\312\034\230\311.\nu(\330\345\025\375X\342\360\026\352\030I\223\r\016g\275\315\r4\265\234I\305\226L_o\270J\224s\366}\035/\306;8\332\306"
+	.string	"\277\2700\322\230$9|_[\367q\223\233.Q\200_Z\370}(\361\247\027!Q\226\335\313:\345\234\373&\277\226\3369\336\355\032\272;D\367\032\026is;\327\350\205\336p\253\263\271\032\2106\331-\202\304\365\244\177\214:\2454z\264\233\032\371'k\030\253\321\003\205%I+\263u\355:x\235\315\341L\b(\313\371\350\311\250\366\230\201\200\253E\337\235\202x=i\364\376t^\331\232#\322(\327cu;\261\356\223u\373\332\206H\356\037\353VJB\032\0268\3625o#g\342^\304\336\036\352\333"
+	.string	"\334\212\267P\220O\361\006\372\361\351\333=}\233\307\253x\357\350\260\267s\330\333\302\276\035\354\333\300\336\355_\3576N\337\366\271\323\273\327\273\315co\267\354m\226w{\345\335V\333\333x\275\375\354\355\273\336\366\003\001\3140w"
+	.ascii	"\021\362r\316\3545u\223\277\250P#n\305\275\212\373\024w\247;"
+	.ascii	"\024\3675_\273\337\332\241\355\263\322p-\226\262\225\362l\022"
+	.ascii	"\3159_\240\322\356\326\276*V\032\232\321\247\326\331\332\333"
+	.ascii	"\332\347j\024\227r\345S\032\216h\313\231\277 4\363\204\326\325"
+	.ascii	":\337%\347:w\007\323H\357\311\332\307\245Uz/\253\273c\207.\304"
+	.ascii	"\033\"e\266I\274\261\2723l\273\325\032\364]\016\365\nH6\244["
+	.ascii	"\213\364\204<C\272\261\005\336\307\270\006_\302\234\317\003?"
+	.ascii	"\370\277\006\t\306\n=\3601\235\343\234s\346!\271\320+\275\233"
+	.ascii	"5\247G\346\357\223\376\306\341<\357\1776|\217\363\216\300\213"
+	.ascii	"+~\337\253o\220\320\366y\217\341"
+	.string	"\220\234\375\366\375\350&\350\331\217q\346\206\274\313r\026\353\372H\177\325\220f\376\346,V\365\327\367#\023\277\3728\256\202\253\025\333\2343\023~\207\372-\302\354\301D\203f\335\351\3773\013\227\262}2.\376_\340]\f\022\213\326\235\372\026\367\267\177ws\367\242!\375\302Tf\027e\237\254\257:t\337\034F\362\241\357\352\036\372\243w*\310\273\254;]\327'\303iK1\352\217\365\320o\231\240\313:\006/\031\332\r\355\221\003\001W;x\270\236\274\357Wz\034\037\3131\232-6\260\213\325\377\332\005\335\200\301\002\007\037\"\\h\233\352V\021K|\224\225\024\324\013\225\350QRD\0248\252\005Q\n\257(^\025UPS\270M(IAYUQ\021_\220\250\242*N\311\200\222\232rA<\261T$.\265 B\261X2A\345bIi@\027\247\242\250\226\252\212E\252%\2373;\016\366\236\344\210<\335\256\3139"
+	.string	""
+	.ascii	"\337NY\257\3252p\316bMO\317\211>\271S!\006\376|\257\367\355j"
+	.ascii	"|\215\261}H\033\233F\264\353I#\332\352\252\252eFJt\215\276;\202"
+	.ascii	"\204\353\311\366\247s\220F\245\321\255\307\352\240\220_\313\246"
+	.ascii	"\216\311:t\240\237N\033\246\216\271\036\375O\317K\230\373y\236"
+	.ascii	"\357\371WC\202M\247<\377tH\263&\037v<\200@?|o\363\241\217\270"
+	.ascii	"4\2715\246\326\235\336\337\316w\367\b\217Z\r9\232\t<d\350\374"
+	.ascii	"\314S\373\020W\233\202\005\265\335\302\352\352Q\020\2605\347"
+	.ascii	"?\234\311\035\357\200If\027\234'k\006\302w\261\264\270&\240\027"
+	.ascii	"\352\320!\301\206l\240-\361\361\202~\347\273\032\363"
+	.string	"|>\200\222\250Q0\243\220\203\306L\311\310H\222$\351P\0021L\331\325\001\020xG\332Ba8\202$@\353\350\226\264$\224\344\020\245\275\013y\233=\237\206\2365#\351\001\206'\343#*\246k\013dY-\335\001\350\241K,\037\004a\331\206>dE\213?\206\230\300t\261a\222w\331\273\305\204@xLU\244a-\207Z\005\215\300\315\306JC`\221b\033g\335J\223\022\002kC,.P\337\334\331\036E\370\315\336\221\247\326\267\334\370\237\240\370mL|\257F^\375\003\370\003:\007H\3162\270\t\250\212\001\215\302#\304\227\337\222x\\*\037!A\022\t\221\220Z+\312\374\302\333\262\027EgC:\336 \376\t\235P>|\261\305w\265s\177n\251\352v \002i\375\203\020\254\222w\211XTR@#Vp\322\001\200\227\212- \347=\376\333\376\356\024\270\f\322\315/\322v\\.\354\026\324\301\347\351"
+	.ascii	"\016\243\371\301<\375\035\206;2\265\330\013\307L-28\343\226\246"
+	.ascii	"`\270\372A\360\210\221.$\324\323\t!\332\177\344TY\271\240\241"
+	.ascii	"\241\fa\363$P\312\204*"
+	.text
+	.section	.gnu.lto_fontPixel.42.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\030\005\255!"
+	.string	"\372A\330\rG\240\232M:\266\003\232\267\243\nGChtI\"\347l\325/\257\224r\262\255+\034\263s\267\335\371\264^c\027x\b&F\"Q\254\302+\274\026\234\302"
+	.string	"\236\311\207\332=\2072)\264t\204\f\035kk\226l\"eJ\001\324"
+	.string	"\262"
+	.string	"\314"
+	.ascii	"EL;\223I\307\030+\tJ\222\212\230|\023J\002\026X\0215s\316\004"
+	.ascii	"\227\216\200\344\313\003\331\261~\204\305}\016z6\347\024\026"
+	.ascii	")sN#;\220]\026\035h\274\024\3573^Z\365Et\3369{ZR\346\364\031"
+	.ascii	"\271\201\354\322\266\0318`a\335};`\320x[\274,5s\372l\253\343"
+	.ascii	"\272\337\324h3Yl\224\342\252\316W\372ML(\244\366\273\005\036"
+	.ascii	"\033\032\215O=\331\030\201z\004}\230\300\324S\215\235\305&\\"
+	.ascii	"\360\nSf*\206\215\313\bL\305\220z\214G\340\352IJG\231\214\313"
+	.ascii	"]\r\312\205\2129P"
+	.string	"Lb\321\234\363ZW'(\027\272\"\202\236\226\250_=\315\020\201\272r\210\371\357\372\002jI56a\316im\202\212q\343\334v\027\333\026l\221K^?\340\322\2014\365\266\354O\214_\rI\3020\351\032\373N\376\344\204\377\303\270\022\372\246K\277\304x\371\235\321\013\353\031\221j\241C\333\247\244[e\177\207\303!\033/\225\375&w\200+\271\001\274\310O\364%\367\320}\277\320\221\374AV\003Y\375\243j\037U\367\250\232G\325;\252\326Qu\316\250\306Q\365\215\252k\252\246I\365L\252eR\035\223\352Q\252\245T\213R\275R\255R}\001\003\302z6tlY/\337\2041\f\233\\\022\030\344M~%\377\222\257}\373L|-\327l7I!\233V1-/0`s\372*\310.o\263\360\263\376smIR\317\242\033\260\3036\210c\371 \340\313\234\023\202\225_\271\371?.\035b\304\210\361\022g\007\360"
+	.string	"\212C{\263\342\230\035\021\242\255\355\n\2544\026Z\332\016\355\205\273\336\rm\377\273h\006\213\314\356J\247\240\351\2721\333*k\354\303\353F\025#\0042~^7\002\255\223E\331V\305\226\312*&\370\202\t{R\301}\326i\266\372\225$\300\312v\266\033\344E\025]7\022\255l%P\361\331"
+	.string	"\253[\2746-t8\216[\345\377-~Vxr\251bKa\\\271\261\215y\341E\361\004\355\270BOx\300\332\035\034\205V\356\030\344\251\255\270\200\021D<\224\213\273fvu\305\025\267xQA\273+\263x\300%\035:\301\205V\367Z7\320\345L\222\271\016\034r8\r\243\210\016*nG\322\004\322M\203\230t\025\337poX \"\303\t\244\334\r\005\006\244\034\356()\203\210#\0237\0166\334\315F\342\226a\204mC\316\204mA\001\343\216:\344lH8\\\316V\363\315/\225uUj\007^7\204v*\377\3573\034\303\336\314\327\215\327:M\214\020\210\fh\177\326\311\366\317\352.\371[\356\t\342\215\226\353\250\341\252m\025\327\213\224Th\260)h\272h]\276\2265V\023\007\027+\360\327\206Ii\223\375-\333_\2629\225\336\363\227\265i\362\302\254&\216y\340\022\300j\024.\\L\332\306F\357Y"
+	.string	"{!Ojs\266gep\327Fw\226g\277\273\322Y\243\357\354\230\265\263z\360C\253\263\2611; \316\346\354=\004S\250a(\243\fS\310\030ffF\302(m\232\003`\002\231c\311\r\021\200\255\225lZ\030\366\f\006(wp8\365\217\235\341\264\3762\\\016\236G\375a\322s&C\261\352"
+	.string	"\t\306,\354f6\t5\307\222\023\24299u\245?\rm\233`\241a\237\3532"
+	.string	"\361.x\232\325rv\227\332$\273\330\333T4\202a\266\230S\275#\270\342\320(q\237+\242\351/i"
+	.ascii	"X\354\347SEH\024m\213\220\312\326ML=\031\310\345Pq\001A=1fI\025"
+	.ascii	"\272*TA\377\234\2168\270\005\032\220\272\215\376\330\002*\264"
+	.ascii	"%@\246\364;L\216\362+\b\263\254\226b\336\365\370\006\2350:\250"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_displayPortVirtualWritePgm.43.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`.\007\305-"
+	.string	"\nUt\022Gp\032V\007K\224!\272yT\020\0063\350\216\220i\330\201\221\005k\206\312\363\320l\020\215.n;\375wX\242\303P|\214\336b\020y"
+	.ascii	"\361\b\376*\\\220CD\200\247\302\3570\351\252\2072c\272\266\262"
+	.ascii	"\355\275\223L)\032\001\001\001\022\0019\210\344\234)Dq\263*?"
+	.ascii	"\233\022&\241Y\013\202\224-#ag\205\253?9f\025I\343"
+	.string	"\240\017\034\352M\252\334\t\225\020\t\315\310\006R\352\022697\211\316\366\021v\366\347\306\335\333\355K\234\254\312\313b\270N\316`nl9C\023\364\002\354lC\335\247u\026;O\353l\221QU\037\035\032\226\345O\346\022\n\233\234\241\305\377q\343n\034\333\005\316\370\n\365\346\375\321\201\277\034_/\310\333a]\313\256\177\217\355H\007\352\2204H\305\320|my\371\017\350k\253\313s\306\232]\327\007\327\344\261\n\323v\334\036\276\341A\207k\352`\013\273<\037[\\\276s\253\034\216\327\003]n6\274\364(\343c\315\034W\267\036\240RY\343pM\034\253O\326\020\246\263-o\273\352dd\r\371i)\327\243*u\352U\374bi%/[\344\206\257\316\346\354\323\013\315\327\026\227\377\032\341\215\233\364\247u\265~\217#\236\346@cM\257{uH9\347\276L\255-o\035\357\366\f\335\255\242\273u\n.Z\341\007"
+	.ascii	";\022\225K\336j\003\257\253y\026%\002a9+\235\271\204\225\036"
+	.ascii	"\204\234\035\360\335*\230\2563\205\357i\276{jA\333Pe<\262\033"
+	.ascii	"\212\274\357\354\366\326\215\220\334\017\326M\3646o\242!\241"
+	.ascii	"\276=\3643\357 G\363\006\362)\336B/s\037\200o\003\300\267\177"
+	.ascii	"\372\266\217O\275{|\315\233g\007\337\326\361'\336A\336m \357"
+	.ascii	"\366Ow;\007\337\366\341\333=|\233\267\273\275\303\2671\276\255"
+	.ascii	"\303\267[|\233\305\267W|\373u\267\257\356\266'\030\276u\355x"
+	.ascii	"b\375\030h\316\232{\223\337\330\251\230\267\271O\335\327\334"
+	.ascii	"\235\270?q?sGs\237\342\270\333J\373\225\356\265E\341LD\247&\367"
+	.ascii	"\244\346\f\355@\245\275\312\264\3330\262\211\321\244aT\016\330"
+	.ascii	"\325\332\331\272\267\326m\016\244l4`g\275\273\252=\352P\\\352"
+	.ascii	"R<\255{\335=\305\305\232q@\363\026\203\2637\fhS\302d0'\237\001"
+	.ascii	"7\214\357\240U\227\350\216\355\316?\235F\242d\216\302\252\324"
+	.ascii	"\366\235\335\343Z\211\317\002\t\022\275\347\261z\316D\271$o\325"
+	.ascii	"\327\234sf\021x\317\023\337\2538;\206f\246\354\312\371\356\376"
+	.ascii	"\340Q\021=q\327\f3\215\360\362\276\367\276\357\2260\341:3\347"
+	.ascii	"\205\312G6\321\373\336\227q\254z\357\312)\357K\240aQNwO\364\277"
+	.ascii	"\245\235\234L\213\243\3668\227\243`\341\302\205\326\331\335\017"
+	.ascii	"\345\246\272o\037\177\033F\331\365\305{^\367:(\312$A\317~\373"
+	.ascii	"\254\031\345\330\025\234\363<\373~\305"
+	.string	"\211\324X\211\216\211\222\344\352\316\375\233a\221\321\\\005\334Ws1\031|\3424`\245\b!g\205\337\315\241\303uf\013\227\217l_\320\257\357;\336m-\320\377\363\244]\224cWw\256\357\007yp/o\367{\3114$e\376@\357p\226q\032\204s\021\201s\316\f\332\335|\313\210\366 \3166\t\023\327\231\316\266\233h\235\365\017\001\006\246\213\254\314\352\316U\347\304\376\235\035\31532*\342\241\030\nQ\fyF\033~}b\352\225\034\206S\371R\023S\2125j\312\b\265F5\031\225V\026\306\273\344\304\324\264\256\220JzZ[IAS\222\013)(\246\027&\244\240\214OTIMOQL(\212F\246\242\023SR\213\242\022TTQ\201\2016>-A\025\245\214F\250b\017\232\375\301\032(\025[\256\375\206\026\344h\230\255]7\343>>\337HV\177\325Tk\316_\021\250N\356\0340\207\350\327\207\300\001"
+	.string	"\370\341\373\357\235+\273\303+\232c\306\203k\224\314\2231\301\342[y;\037|,\242\353\274W\207\356\261\310\321\310u\246\216\323\330\352\362\226|d\357\235\355\301\007\353\235\226\335\320S\325\210\363D\347y,gs\0133\202,\327vB\025\236<\226k\357X<\377_\004\233\273\021zT\275x\357\354\213\211\356\316\033j:\004\376\363X<?\364\316%\235\373y\241\367v\367N/\3124\256`\240\217\250\334\360\n\377\367\356\307#\255S\361\350\021\2113\273\217J\216d\327\231\300_\377\367\001\200\203\250A(\304\024d\312\310L02\022F[\314\001`\002\2211\274m\020hf\332\244\320\001\276\020`^L$\340\263\220d\b\271\314\341/\027\315\372\003\355\036\263S\364\332\031\005"
+	.ascii	"\030\327`*\023\323:MRf\206\377Aw:\"0\244?!\337\034y\025\233@"
+	.ascii	"\356\275\032!\366\341]\t\030\204\006\221\304\213\026\263\313"
+	.ascii	"\007H\2130 \365w\364\005rf\226\376\200\274z\344\226w\022\245"
+	.ascii	"d\353e\262T\321R\376\366\224@\274\251\271\331B!\347;\232B\272"
+	.ascii	"\350#\340r\333\232\351\327L\2019v\244\236\035z\"\264\252rR\315"
+	.ascii	"qW\\`O\371\017\177\267:\261\252\260-\320\275}P4u\241\323\257"
+	.ascii	"\376\342I\365\274\246\217\253\263\227j.\206M\356\237F\3621:,"
+	.ascii	"F\205 \242\232\352U\321\370\253\346\333\362\351B(\331\322s\036"
+	.ascii	"\362H\336\242\277\223\367\n2P3\205\213r\0020\335\273\365{\273"
+	.ascii	"\020P%\025\322\302\233\262\2454\227\f\252I\323\223\223\016E%"
+	.ascii	"\f\353\321m\022F\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\234\002\r\013"
+	.string	"\222\217;8@\313\244\003\\8\003\353\003\273\006\231m\272<\201\245\b\270T\004\303\226\233\2273\f'\3130\f\300\236\327i\024"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"G\241GD[\322\006\032\3472F\242\334[\006\353U\206\324\242w\201\243\340T\016\260E\266\310P\230A*OZ\247V\256\3342\224'MC9\322\342\203CcaC9!N\\\b\241\241\f~\224A\013\003\310n\263v\301x\f^\"\214\360\326\301]\006O\301\276*\270\352u\026\301O\261\273w\277\201\243\242\353\246\231{\350\326I\254\207\344\352 \251:H\361L\"\335\356\312XO\244\376A\335r\022\231F]K\344J/\221\336\031\235#\372\027\372\006t\r\207a\030\202\317\310\227m\303\341s\214\347Uz\023\211\244\343\335(k\001\257\2035\340::\247\234Wf\307b\025\021\273\337\305\230\305Gw\367w\212\334]f\b3 \320\002\231\242\232\007\3259\334\332\254\227\301\020\335c\256\301\334HG\017\257i\364\301\252\222A\034\206z"
+	.ascii	"\007\340\b\216\340(8\334\201\230l\251\035\302P\330B\006D\237"
+	.ascii	"F\001\001V#\314\372#\305Sj]\340\214f|<C\3551\3241\016\373u#\\"
+	.ascii	"\374\311\021\352\241\036\253G\247\036\320\353\321\366N\364\331"
+	.ascii	"\254Wb\030SY\262f\303\0324\353\235"
+	.text
+	.section	.gnu.lto_.refs.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375 \365\375\004"
+	.string	"\362\215#\"\220\245I\007\377\377\377\377\377\377\377\377\377\237\277V\212V\361\377\277\265\364mmm\373\333\266\227vK\231\002\317\024\337\364\225N\324\004\315\036p\206\340\201\206E[\2500!\201\b\017\032\034\220|8NHyI\\)O\nN(\216\244\335\264\007\361%\026\216\213n\366W|\352\310\37153\334\320\r\365Sm\247\276\351^\216\343\324\375\364\235\332L\375\322\235\364\253{\3358\026\350\016\350\006\350N\364\021\335Q\037\352.\364\221b\033\305\017j&\177A\004"
+	.ascii	"\251\020!\213a\233\020\214U6\025\005"
+	.text
+	.section	.gnu.lto_.decls.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"(\265/\375`\2703\355\337"
+	.ascii	"\032Z\251LU JI;\035k\321\231\004\230n~\213\362\335\350E\221\016"
+	.ascii	"\260\250)\336\351\242;Y\301o\321d\212\373\352\320K\270\034h*"
+	.ascii	"F\305\rv\2146\361vD\333\266M1EJQ\202\253\252\bJ\221\264\232\\"
+	.ascii	"\031\265\276\213\341Y\227w\331\373q\006\330\037\262\355-eJ)@"
+	.ascii	"\004\265\004\310\004\375W\277\303\353\242\234\203|\177m\226o"
+	.ascii	"PC\344\240\351\327\321\342u$\020\361/\b\327\240\252x\031"
+	.string	"0\273\006\365m\320\364\337x\t\n\342A\345\257'\326\360\264/9\252\263*\032_I5t<Y\334\n\177\300\240\372\251\253\264S\365\363l\276<\237\342\244\240\212E\n\325\206\330\220\212\274\013\241:\245\237\3612\336\351\227\376\351\233>\352\231\034\372P\237\324\017\343c\364}\027FH\262\330\210\346\216\330\262^\254e\r\321\025}P\fK\316SI\262\234I?\324\377|PL\363\231\217F\260c\352\241\3468k\221\025\200\373Q\276A\335\340\243\340~?\334O\207\373\213\340~3\334\377\304\375?p?\016\334\337\204\033\017\350\235\016\345\360-\372}\234\255Y\232\317\fe\351\233\362t\366\267\037\t\267sPe\234\203\332\337\203o\177\223\003\314\225\276\036\256\357y\036\337\n\022\b\370\267\237\247\373\363\357\270\241\007&\260v]Q\242\374\035\200\305s\r\252#\322\264'jP\215\226\236\371l\314\305\223\240\277V\211kP\017\rM"
+	.string	"\322\364\367\327\t\275\260\335\320\257\270a\bQ\2062\2069\363\310\270g\340\236\301\365\242\302\"\242\336v\304A+T\177vM\177\005c\256\376|\200Dq\203\270\363:\307[\032\301+,\212\327O,\350q\236"
+	.ascii	"\344+z\004\211\030\330s\215\bn\320\315.\310Z\021O\373\220\006"
+	.ascii	"\350R\334\211G\035\212"
+	.string	"O\361@\257\342\177N\305\2378\324\243x_;\023\367\353\231g\316Mg\363(\376\346r\216w\303\001`gQ\020\272i\242x\236/q\274\245gFr(\257 M\274LD\221\334 (\361\272\230\235g.\022\001\214\b\256\335\354\003\b\217\342g\236fAO\316P24\364\304\021=\r\346\374\354`\246\003\345\323\237\224\231\333\016\206?\373\006\025\003\337\201\273}\211\363\261\374\320\230\342y\306\260\0215\t\377\266\357\271\3363\317\300 j\3519\023n\177\201\333\205p;\020n\347\301-\002\354I|\316\241\0278\035\fb\027b\341\337\326\301\355\027\250\236\350\027\250\275\002\317\030q8\207r\340q\355m\356\326)\3173?s~\312|\216C4\262\277\215\002\267s\240\332\304D\347@m\016`\f\276A}\327\240b0\001\374A\332;\021WkOs\264\227\346\323\323n\316<\356\031\304\270g\220\306]\361\220\251\267O\300\355"
+	.string	",\3027\250>\346B\034:\343C\372\003\210\266;B2X\316Y\306\365z\210\234\376\366\002p;YS\300\223A\364\013~!'\372\214\332\2171\234\371\006\325\301.\260N\241\250|\226\3633\203\3143\306\020\215\277\375\364\r*v\r\352\233\020\327\355\\\017W\342Mt\277\221\267\326"
+	.string	"\t\316"
+	.ascii	"\271\003t\333\253w\203\351\266\313\227\340;t\273\207\247y\266"
+	.ascii	"\"\335_\200\021\272_-\255\373\321\272\277\314\360Ah\320m\255"
+	.ascii	"\272\330m\245~mJ\273m\221\223\257\371\023\024t\333\237n\037A"
+	.ascii	"\267\267\350vg\267\277\320\355\271\333\203\272\035\250\333{\272"
+	.ascii	"\235\247\333w\272\335\247\333\205t@\360\201c\007T\020Awc\320"
+	.ascii	"m+@\301\243\006\313x\265\201&\322\335\266\333^\240\260%\350\266"
+	.ascii	"&\\\203n\247\300\t \200?\332\240@\343n+A\267\017\240\333g\272"
+	.ascii	"\275\202n\237\240\251t\267\223\302\266\240\3735\3203\335\326"
+	.ascii	"\202W\241\333\367\272\335\337\002\335\315A\307t\333\027\244F"
+	.ascii	"|\267m@\367\247\320\375$\272\237\204\356\377\320\375\032t\377"
+	.ascii	"\004\335\376\327\355|\335.\327\355p\335\336\326\355k\335n\326"
+	.ascii	"\355\320n\027\353\366\260n\377\352\366\256n\367\321\355<\272"
+	.ascii	"\035\253\333\257\272=G\267[u\273\215n\257\352v\252n\227\352\366"
+	.ascii	"\031\335-\330\355,\335N\242\3333\350\366\022\272\275\251\333"
+	.ascii	"ct{R\267\033u\373P\267G\240\333Kt;\004\272}D\2677\240\273S\350"
+	.ascii	"v\022|\204n\017\321\3554\335\376A\267\033\240\3337\350\366\002"
+	.ascii	"t;\006\335n\273\375\273\333\260\273\255t7Xw\217\320\335t\335"
+	.ascii	"\275!111\261;\305\353.\232\320\315AO$,\371\213\346%'\016\034"
+	.ascii	"\250\364\374t\225\266f~\b\223\244t7\030\035\033\263P\354\303"
+	.ascii	"\266\304\341\207\350i\r\261dm\241Ow\207\205\347\366\327\n)&\021"
+	.ascii	"\023#,\226\2059\324\206}V\013\020Tq\354\013j\277<\315\201f<\021"
+	.ascii	"\320E ?~\330\256\023\200\354\232\346\006\333r\265\355\362\272"
+	.ascii	"\273$HO\321_\273uo\354\250\361\344\257\005\322qE\272;\252\031"
+	.ascii	"\035wa\270}\331\375\355\242\016\037>\376\260\245\nG\323\334`"
+	.ascii	"Q\006\017\036/W\364qj\232\033,\266\300\302z\273\317*\232U\025"
+	.ascii	"E\013\257\256>oI\213\2469.\325I\216\034/\347K\331\356\0256\315"
+	.ascii	"q\251E\254\254\336\t`\230\r\033\037\210\351pTU}\225\023\270\226"
+	.ascii	"\250\2500\344\236\275\240\254\274d\304\241\325\037))\2333\024"
+	.ascii	"`\226\025\334\366\311B\265\235\321v\306\347\341\234\363\335R"
+	.ascii	"\022\207N\377pw\267\253\231\307(\347\214\224>\263Q\317\213\332"
+	.ascii	"\355\355\251;\207n\030\267}s\356\n\326\234w\354\374\250`\037"
+	.ascii	"l<M\177sw\347\334\234\332q\300\324QsJ\311\t\235\312;\315\035"
+	.ascii	";\031\214\362\324\216\023\232s\206\334l\356< *gpB\363Q\366\321"
+	.ascii	";\362\374\234\332\311\315\250\234!73\017\006\316\346\324\221"
+	.ascii	"\023\312s\224\301\t\235:\312\320\251\214!7y\214Z4\263Q\206\f"
+	.ascii	"\235\n\314\320\250#\fNh\324\221\023:\325\344LN(rGu~T\\\236\347"
+	.ascii	"lf\242!'\036#\fx\316gT\366\313\331\317~\262Q\001rv\2122\362\343"
+	.ascii	"Q\362\266\036<\242\0365\236(\027\300P\017UTn\3429\265\242r\326"
+	.ascii	"\352I\221\207B\330y\342e+\307\333\241\341\224\205~r\246`(\347"
+	.ascii	"\035\317x9\347\235\234s\321\310\351\2313\023\006g\326\320P\316"
+	.ascii	"K3C\331i\307\355'\347?s\322v\344\204RE\321\270\225A\2632\320"
+	.ascii	"s\307\263\262\337\224\021\206\356\214e\241)8\353\350\205\224"
+	.ascii	"\277m\235\272-\223mz\241\246\245(\177;\352\033\324\030\327\240"
+	.ascii	"\332%\232\2662\036\353\214\216\356/\214Uz\252RcWq\177?\320\264"
+	.ascii	"\215\301\005'u\345\257E\262/\034\332t6\251c\336\200\320\350\304"
+	.ascii	"p\277\340M\247\266=:;\274r\241\344\257-\242ik4\200\2658\267\277"
+	.ascii	"E\357\362_k\207\376\232\035\002\300\020\256$\004X!,:,\254\034"
+	.ascii	"\270\035\f\360\2454!\202\033D\222\344\357\270\236D\221(y=@\""
+	.ascii	"8\256)/\350W\370\210(D!\202\033$\264@\237h\203l\013\233\355\216"
+	.ascii	"ua\235\266i{,\217\375q\250\365q\275\376\"\317\006fE\311\340]"
+	.ascii	"\026\315\225\327\213\331\311\2203\r\273\254%\377\347\204\b\216"
+	.ascii	"\353\367\3706\370#\202\343\262>\357\366GB@!\202k\361\331\202"
+	.ascii	"BB\001\342\241J\004\b\be\330\177\370A\252[\235\r\241t\006\356"
+	.ascii	"\224\tw\212\204;\375\301}\013\005\253\\\272\3010+T\372\253\304"
+	.ascii	"\fu\315\265\210J\tl\261\333\343\343\213\366\007\312\0249\267"
+	.ascii	"\376"
+	.ascii	"~\224\247[\253\341F\364\367\241x\235\331\034\227\324\337\177"
+	.ascii	"\342u._Ih[U2[\205.\372\370\376\234\304\274\2659w4\351w\342\342"
+	.ascii	"\027c\t\333\337\367{:\031\031Q/\306\212H<\230\230\376~\237\327"
+	.ascii	"\265\374E\241{\363\272\224J\020\220m\016\367\035\202?\320\313"
+	.ascii	"S\317\210\3700\304\353\317\353\270\006D%\251\335\257;\273\026"
+	.ascii	"\034Un\034\326\365\3335\224\177\333\013\003\243s\031e3n\320\315"
+	.ascii	"\325\260\241\247$\030c\244/(I\013\367\363\210\034\026\274\362"
+	.ascii	"\254\362\367\345\322^\262\005\236G8\244\312\303u7KL\236P\217"
+	.ascii	"\246\277o$\317\353\252P\260\370\303\n\312\312\277y_\021(\351"
+	.ascii	"\211\217\277}s\340nk\274\213\204\035\372in\205\305y\353\220$"
+	.ascii	"b\264\347aq^/\272(!\356\376!\355\320\037\362f,\3164\251.Z6\203"
+	.ascii	"\263\206\252\244\375m\213\207\333\316a\262\337\032\243\361\363"
+	.ascii	"\267\237\254\373\205\370\0217\274UPNf\374\265m4\375c\266M\356"
+	.ascii	"\307P\f\372b\317s\3023\357\2100\32747\230\215\214\020\320v\307"
+	.ascii	"KQQ\216\2500\260\021\f\371\341\370\333\017\326\375^\377\345u"
+	.ascii	"\036\310\271\331Rd\210`\337_\t\236~\\4\375]FA\"\261\277\317d"
+	.ascii	"\013H_\215 w\177\373\201\374\0175\226\031IMz\177=\373\240\351"
+	.ascii	"\327R\021\257\2708\373+\323\343JA\213\372\301\343\263\354\216"
+	.ascii	"\031\025\250\277\375Y\335o\3658\036+\006,\fI\337\337~\254\016"
+	.ascii	"\r\323\205\033&\007n\030(\3340H\270a\232\270_\250\340~a\362\""
+	.ascii	"E\302<kpJR\244\364\310E\254g\351\250\016\367\213\021\334/j\270"
+	.ascii	"_\240\270_\300p\352\242e\354j\374\371h\341~\271\201;\372\342"
+	.ascii	"\204\373e\bw\372\003\326B\263'\361/\rM\247>b\205cG\376\366K\017"
+	.ascii	"\356N\3237\037H\254\376BIw^*\200\201\306\210A6\210\333E\n\366"
+	.ascii	"[x\r\035\332u\367\260\325\322\274\232~\370\205\\\247\266\013"
+	.ascii	"\336\225A\031A%K\236\203\327J\221/\272\026"
+	.string	"\004\207\333%\r\273\021\225;\305\006\r\305`r\247\\)lPqra\270]z\340\356\033ErQ\203\352\013\242\201=J\t\267\213\021\366,\227 \354\001x\272\206\276\273$HLO\311\3372\347\"\202b\304g\207TD\244\035#{\366\357\211\207\240\213\277\267\356\326\335<\274S\244\n\273x}\363\240\024\227\312\272\242\177\257\222{w\355\\x\360Er\2238\264\343\356\334\023\032s\307\244\317\017\021\267PLLLL\354\276G\336\214\210\357\205\335\225\343\303\023K\264\372{vv\341\254\241?i\266\232\304 I\3729#\322\027\256\257\021\252g\230\341\337\333v\337R\035N\206>\177\257[\221\313vVT\304\205\025|\325\356Z\307\200\362!F\361M\273W\315#d\325\341\360\206\332\213\277\027\35525\236\324\240\217WK\351\300B\362\023\353\026\273e\030\222frO3C\315P\351d\370\224%\200T\320\276e}\207|"
+	.ascii	"aa45\365\214\344\241\331U\t\373{\205\\2\026)Bn\264u\224\216\312"
+	.ascii	"\fj\r:\371{\307,\214(m_\315\277\367ia\304<9\333\341\224G\330"
+	.ascii	"\267\213\360\206\271s\001G\327\216\017\020\t\254o\330\205\321"
+	.ascii	"\322\267\244\247\352\357\375\272^D\224\314I\361\352* s;Z\374"
+	.ascii	"\230\200\254\374\275@.\327\325\"\272\221\247\344\357\335\272"
+	.ascii	"Kbd\206s\177\177\264\235B\226\306\243\244\325\315\002\003\244"
+	.ascii	"+\037\316U\365\265\252\272=l\025\234w\236G\256\300\b\371\373"
+	.ascii	"\001\325\321\267G_\036O7\202\276\376\336\254\266yVS\312\234X"
+	.ascii	"6\217\007\240\032\342\337\273\303\203'B)\303\253\033zW?\376\276"
+	.ascii	"w\234zs|U\013\232Y\017\031\177/\216\257\262E<P\002\357\215\266"
+	.ascii	"tA\342~\366\376^\033m\223\324 \302\323\253\021\250#\006\2168"
+	.ascii	"\334-k\270e\264\214K\325\266\231\241\240\324\037->\360\350J\002"
+	.ascii	"\325\227\252\357\224O\222Sa\324\225Jr+\342*\303}g4\025\230\220"
+	.ascii	"\214\2261\016\260\336W\215\302\277\327\351>%\276yu\375}<\260"
+	.ascii	"\0357\376\336\246\216k\262\271.\031LJ\362\220\n\215\\\334\260"
+	.ascii	"\330\376\276\236\3645zr\225p\316KQ;\201\037\330Y\371`\2229\022"
+	.ascii	"RRwc\364U\3023$\264qaD\r\031\336]\0307)u\243\341\202\357\357"
+	.ascii	"\213\342\221\347\323a\024\276H\367HF\007\336\034\227\022\276"
+	.ascii	"B\267\310\006\222\265I\021\373{\207.Q\fa\027\f\350\337nq:\257"
+	.ascii	"\013+\253\265\304\277\267\305\r\212\201\212\272\"\222\330\274"
+	.ascii	"@6\206}d\177\257\317\375\3711#=\004\247\334|{^\254\210\005\242"
+	.ascii	"\375\275;\227\207E\214'\352\005hh\023e\370\200\264\001\376\265"
+	.ascii	"\207\026\261\305\005\r\266.\276A[XL\242\325\363\363\327^\261"
+	.ascii	"\204\367o\306\232\363\216\212\265b\003\017\217\320\351\370k\253"
+	.ascii	"X\301\263, 48)m\247\340p\356E\245\341\266Q"
+	.string	"\033h\307\347\223\205`\013\305FQm\244\t\272y\371\350\353>\373\347Br\221\223]-q\370;/\3045\353\244\355\337\013\030\341\216\324_\333\344\351\212O#\031[~PYV?\374,\223\230\271+(%+\204\321\232\354=\331\300\215\244m\035\022\313g\373^\362\216\220\\TdK\202\243m0;\2278\270\214\271\030\313S\322\226\257\355\336\007\020\375\004s\001\351\343\371k\365\332\346-\331\275Em^7K\213\217*\350\226\023\267\007XH\214\243\243\277\366\256\237\274\326\023\241\300\277\326\356e\211\311\240\r\013\303\336Q\355\365\374\265sm\351\272YX\336\240\252\246\3766KNB\244\257)\253\0207\246\"'g\341\232\0045\315q\261\020\022\002\342H\362\366f\341\334\206U\323\334\240\213\225\247[\2415\322\026\256\310G\344\357)\b\033\233m\363l4\3440\372\"\265\344\246\327\226\352i\355 \"\205\206f\327\336\206\f\266"
+	.ascii	"\342\2759\327\254Z\f$\211-\324lZ\235\026\335^\231KQ\222\216-"
+	.ascii	"K\344\223\334*\252\366\364\267qY\2315\363\245\235\242\203\t\022"
+	.ascii	"(A\302\310\254\321Y\256+\\`zX2qNx\320A\242\360\240\005\035$N"
+	.ascii	"\216\007!\2040\206\020\321\202\002>\330\254K\035\244\216\021"
+	.ascii	"\253J\346\212\027\233\343\252\214Q2W\300\334\350\274\334\350"
+	.ascii	"\234p\201Y\227\307\023\306\025:+\324\034O\310\330 W\343\312\342"
+	.ascii	"\270|Y*\327\025\224G\025F\214\3049\246\2501\252I\244\261\370"
+	.ascii	"a\211\342\230sc,2\215E\233\234\244\321\005\251B''YcT\352\324"
+	.ascii	"\030]\230\353\222\311\302\030s\243s\202\251L\246X\032Y\230\306"
+	.ascii	"\226\025j\2229\306\224i\f!\204\221\205\271.on\222\306\242\013"
+	.ascii	"\223E\315j\223\2541b\230#\363hc\\mpX0\2660\2278907:'\214\313"
+	.ascii	"U\271\256\312\033\343\013\b\233\343\n\243Q]m\222*\214)s]\026"
+	.ascii	"\231H\034\313<\252P&o\324\033&\022G\271\342\246x\243\252PW\245"
+	.ascii	"\316\212\273BE\rR\311\\\026\227\313\265\246\346\250\322$\340"
+	.ascii	"\003\026\356\222\271\242\270I;E\207$\216\315\206k\202\004J\220"
+	.ascii	"0R\240\204\021\2538\256J\2461F\305\252\342\006\2578+$\2235.6"
+	.ascii	"7j\b!\212\310uE\362&\r!\004\313\212\304\311A\342$\221\270&\231"
+	.ascii	"\223s\\m:\300k\016\316\315\n\025\314\342\272L\346\324\334\250"
+	.ascii	".\235\242\303\322\303j\243\223S\203\304\361\240\\\352x\220 '"
+	.ascii	"G\007"
+	.string	"\211L\"\213,$\225)\230Id\361\346\270\346\\\346\272T\261\252PU\240@\201\211L\222\240\200\271.\327\nX0\201r\275\271\321)a\206\211\203,!\301\210k\263\332\034\223\022h\311Y[\300A\201\211L\336\260\244 \003sB\211\n0\\\300D\206\n\304\2348*!\340\32258\312\025\271\242\300\035B\b\017B\210h\241\330\"D\370@\204\017\324\026!\002\r\215\b!hp\207\240\261L\343\032\002\234\245\312\\\225$Z`\272\334uy\\sVe\321\305\004\013G\245M\313\032\002\034\023-(\2208J\246\t\027\3451\305\b\226\345rU\242H*Q@\226P\2567K\344Q\231\302\022'"
+	.string	"\314\343z\202\251<\256)Xj\220.,W\245j\263\326 ]0\261\304\3013\017"
+	.string	""
+	.string	"\023\271./s\231v\315\221\005\362X\243v\212\r\226\306%\363\3104\241\202"
+	.ascii	"\226+\023G\311\202\212\\\231L\034\345\005lV\024\310c\212\021"
+	.ascii	"5/Ku\251\336\264,sr\326\021L\343\007\020\226+\323\205\022V\025"
+	.ascii	"G%\t\346\362\230\023\243<\246\250\271\314N\321a\251\\Y\340(m"
+	.ascii	".\350\344\212U\351\201\231L*=\270\234"
+	.string	"8*Q\260,\2150K\243\nLe\022\005\rk\316\211c\n,\324\265\006\207\305j\243.YH*\3572'Ys1 \242\230\201er\305e\032C\3200\2218:\230\211\324I\216hA\256\253\262f\231\223\243Cb]\352\300\344$\223%\030S\233Uy\\sj\212L\243\b&\022Gm\032\232\021\030X`\002\020\3005\035r\216:L%\016\013#S\231\\\341\3021g\305\022\307\306C\022\307\003\022\347\250\302C\215r\351\241\203\006,$+\240L.\225:5,r\267\214\005\356l\3130\256\353\026\212\205\345\301Y\247\227\214WC/5r\341\264\324\n\271\376>cT :\200\334\334\256\322K\022?\236\2566{d<\342\261\204\355\366\2102D\332\372\"\227\352gKp.]S23B\226\365ja5\312\322\236\177S\")Z\232\326)\221\234\022\221y\037j/\020\325\233\232}Z\226\236uj\326\317\324\214"
+	.ascii	"\2062LiHz\250C\240Jx\206>\376\276h9\322\213\312\375m\020n\340"
+	.ascii	"\245BD\005\306\344:\351\270\230&\206\334\244:\243\231\321q\177"
+	.ascii	"YDK\321\244\2404(\025\332c\002AFa\025\301{e\357+\332t%m\321i"
+	.ascii	"W:\324q\216wf\302\236\214\032\251\220\364*\375\221\366H\311R"
+	.ascii	"\260\024+\345\221Z\245Y\351V\032$\365J\237\251V\252#\025Kq\244"
+	.ascii	"@R\033\251"
+	.string	"\2174,\345J\277\322\034\351\215tG:\346\320\264\353\036u\032\225J1\021F\323\256\324\311\201}\266\341 \262\247h\f?t\336'\375$H\221\264\210(\272\267d\b\345F\271\321\236\260\304\234\3668\336\022\206\334$\263\312r\003\2321\333\203\272U.\341E\004\242\352\212\322@A\271\177\027\320\302 \023\213\0261J_\270 \023\212:\rf\301\360C\021?F,?T-nb\332\2256\323\037\373\314*\226\365\314\210\346\234\237\3740J\026\biW\252\344\207=\016\243\227I\332\225N\245U\216\267\224\363\021\006]VR\300\006s\316\035\314t\220\362\351 42\302\355\264\252\373\372\335&1sUG\210\376\246T4\235\322pI\243;\304\372\253!\306\007\303<\221\300 \342\206\t\304\r\303\207\033F\0167\214\031\016\204l\250\303\362\303y\\6\005\035\203\020\221\314H\222$\035\363\024@P`X0\236l\213\254\007\023"
+	.string	"S\211\303\301\234F\0253$C\"I$I\222\3222\007w\022X\354~+f\346W-~\361\206\374\316\336\273\002<\362|P\257\255\336\034\033\241\035\306\036\230\020P\3104v\020\251SE\213K\0365\223\025r\266\252\275\034\330\243\204i\2477\254\212y8\231\024+\256\001Yt\202\332,\203\001O\250gR\206\371\314\002\216\363t\030&F\245T\233>\205:\211\261I\242\004\367\r\200=Ya^\312\\M5\320H\353\245\223o0?TJe"
+	.string	"Z\314\250J\240!\0211\234,\334\b\234dV\242\235\361\273Q_\017\2029(\203\256zB\033\352\266\207\246}\002e\3432G\366\215e\240B|O\351\025\267\267 \314e,Q\370<f\364\302\335\346\315B\nF,\355\301\033:\303\241~\271\240\213\233\314\311L\271\305\244t\004\307_\340\367\213"
+	.ascii	"\n\007:\357\253\"\224 +\303!\255\256\333\325\"\221\220\315\311"
+	.ascii	"\350\2035\037\272\270VQ\242\234\377C\262n\342\245q\037\025\273"
+	.ascii	"\354\340lp%EN\321\366\326\231&\212\241\255/\031A"
+	.string	"\27637\366R\n\227\363-8\243\301\037\\\200$\240\257\202\002/\251\373mL8\272\177\034\261\021\222Hp\273\220O!!\305\336\340q\205\360\242gzz\206\276\350\244+\272d\256\350\314:\241\333\003\212=\367Wi\350\323\247\341#\272\031\271Q\"Q\326\332h:\277\365\"rW;\031W\373\2567\034@\313\270\006p\217\204\323'\302\215\250\312\204\220\215\222\027'\270\221\266\024\311i\350#+\324\007\214\274\377\037.w0\304\211\351\236<\3556\302\252~\265h\362pk\352\303\004\243\247<+\350y\ff\253\315\362R\024\356\220$<\257c\242\002;E\231.\204\372\216\245\326V\340N\033M\232H3\247\253-\256\266\340\274\322\221wr\272\227 \323\326\204\023\241\207\306\226\320\2669\343Jf\t\025\374\211\324\376\\\206:>\235\034\006\b\375\217h\n\021O\013C\237\365l\344V\247\322\225L\377\243\321\361\340c!\207\267"
+	.string	"\247\005\202\006Aq\370%9\324\315k\016BP\332\bx%]\255&\001\220]b8y\361!3\306[\004\025\331X\006.R*\361b\017)4\256\226\247\370&\302MW\242[\231=T\020\0267T\213\033\020\225&\350\030\326LL@e\255\222\244\250\201,\273\003;\247\312@\332?\200\260\277\264\022@R\274\357\251C~\206\b*\273\232z\312[T\345\224'\331\203"
+	.string	"\360\256 ~\256\0376\361\\A\031\242\\\221\322\346\364\377\315=x\230\225\350\nS{-\023\215N\257U\325\260\003R.\344\270\031\243\273i\371\245\322\317\035"
+	.string	"\";>\017r\310\312xr\251~\013"
+	.ascii	"\373mG\215\036\252\346\264\023M\220\254[\300\343)\230x\233\257"
+	.ascii	"\203\271*\350\276\370?\302\251\20395\241o5\317k\030*\217\325"
+	.ascii	"\237\253\223G)\225`u\315\336\305\303:\320s\343(\276d\214\\\020"
+	.ascii	"\307R\322U\207\226\257r(\367\323VfR-\3665\335\312\302\323\t>"
+	.ascii	"\317\022\255\235\003;\315\261-#\354l\212\243\364J\177T.\342B"
+	.ascii	"\352\225\244>O`\016ak\020\312\353\026\022G{\256\225\237\354\021"
+	.ascii	"\213\265\370\352\337i\213\274\013\203\025\327\257f_8_\342\360"
+	.ascii	"\001\342\310\fp\212q\3572\350i\342\363\t#+Z\317\f\221\217\021"
+	.ascii	"\273\340\257\360\333\377\253\240\357\346\266\026|Yi\342\t\342"
+	.ascii	"pR\361\022^x:U+o\036\365i\241\241\021]w\034\021\251J\2029\340"
+	.ascii	"\034\352l\222\210\026\210uL\023#\002\020\324L\246\2064 :B\201"
+	.ascii	"o72\230\0169\272?\201\314\232\"\377\2654\227\340`\252\255\337"
+	.ascii	";,#\222xz\305\016v\215\347%\210j\225\340\373\235\3426\3337\254"
+	.ascii	"\251*L\246\206\313\374\256&V\332-\331Y\365\221\375\225\231\264"
+	.ascii	"\327-?\363\331W3U\306\367\325`\320\372\340\324\005b\034\351c"
+	.ascii	"\272"
+	.string	"\213\223w\304\265t\223\363\337\"\2448)7(\303\211\322\263X\323pS\263\214#\232c\372\n\365O\013\230\301h\301\357Q\025\026\244\b\270\310\257\3678\f\305\202&\332\324@,O\233+Z\004K\200\207V\357a\302u\312`W\334"
+	.ascii	"\r\036\016\234\r&\352\265\272X`\334\366\3673\211\214\305\261"
+	.ascii	"\300'\004\300\242C\373.\340\245\211\031\317\301\233\204\2214"
+	.ascii	"\274o\225g\"\260\217\341\204\224\221\206\035\032\212\017A\ri"
+	.ascii	"S\241\327\205\361toWR-\006\032W\343X\rG\332\327z\034\264O!(\243"
+	.ascii	"\345\030b+"
+	.string	"\336\263%\356k\2276\034&kN!\353\211g\3244\340\036LRj\246\347zj\036w\200U/\335/k\344\202\252\371 \214\347\3619\333B\261\377F:\2513;\264\373\330\334d\332)\211#\313iQ\213\317\001\272\245\233\370\354\022\215\002\205\316\376g\355zE?1\fZ\207q\313\242\355MP!\206\245@(\272\250\221f#e5\021\346K\302f6gV\205\223\226\302\204\001\177\tf\2243\336\351y\b+\246\304\220D\355\301L\\A\211Y\225\364\356M\240\240\005\320;\234\362\350\001j&\001\376av$\335\330\202\337\273\b\231\377$9\002\261\245\364s\200PAt\264\004\005\352\206\276\362Vf\2340\200\\Q`:\f@\362SV'\006\334\277\023D\242\245s\275\032`i\257\235\233\032$\263\254Z8,\227\305\217v\243\311\2169#i\255\225\217\360\230\355\267@\017\022\371\302\364\360e\270\364n7\273=\322!"
+	.string	"\304\255\2750\312M\236\272~\t\360\311\004\372\022<5j$\361\330_&\321\322F\324\267^\013\225\345\223\317?Q1\203\231\006\316\255q\320\216pAa4\342\031,+\356$\227\361\262\030\\E[#\257\202i\252\025K`\013\372\363\313\314G\001\363x\260\223y\341\216\024\314\223\r\275\244\222+\232\021y\363 \377S\3732\252YT\\\3209o\233w\027\307\332J\312e\202d<\342?\2609\270&\030\207P\201_\360\343\350\307\335\242\306\254<\b{\323~\231\261\322%o?'\250\2534aZ\305\022N\344H1!\200\372\251\272\007+\360;\t"
+	.string	"A\222\234\"O\210\237f\201\212\n`k\002\317\202A\t\346"
+	.string	"u\\\306\2213\242\023F\"qx\326l`R\344J|\250\247\001\234\244M\253\302:\301^\214(\270"
+	.string	"\356\327\245\367K[\353\001p\364YS\032\334m\t\017\351G\n_#\2653\323~`\346R\2130\3472!\264\0264\2678<E\026\350x\233\033H\306\035Y\220\373\256\003\346\325O\231\034\260 \233\252\305\334\322\021Eo\316D\320\206\177\216\256<8\231Yp\202f\226\303\266|\273+u\2400\304\247\324\023\357D\037\236\366FawN.s\301\003\022H\357\"\222\b\365\233\022\275t\317\251J\317\250\301\235\335\357\213o;\324\253#!\013&\307\b\263x\242@\024\360m\n\360\313\030^\0321T\251k\253'\310\202\212\373\275\306\001\n44\341\216\241\366\316\004\240\257\242\350\\\354\300X)\211\261\315\235"
+	.ascii	"\254\360\333;\354\374)\276\367\251\252\360\256\003\375\nq\nu"
+	.ascii	"c\265j.\337\342\003\350\216\332\304\374\ra\022Rl{\276\030X|\314"
+	.ascii	"\373i\334\343 \245\005&S_j9J\303;\240\341a\337\307\307\024\357"
+	.ascii	"I\276\377\270k\372\341tx\353\372\317\320\242<e\254\246'\357\346"
+	.ascii	"L\205-\251\243]\013\211Na\362?\006\1770\376\030\023\007\330\276"
+	.ascii	"\300\322\007&\234b\302\031\266\307\260\376:\300?\226\2277\374"
+	.ascii	"K\335\2608\257\315\277Hdk\336\r\317\251\375y\365\254\262\317"
+	.ascii	"\243\201\357n\366B\352Ck\317&\374\005\031\247\3704\327\377\262"
+	.ascii	"\357\227\0219+\377\373xo\212\267\277#\354\316\306\370\326u\250"
+	.ascii	"\370\372\212\035g\326d\222\2528x[\376\222\352\r~\363\016\277"
+	.ascii	"Ngq>\225\336KN\nz\310~\017ux\203\262\224o\211\0372\374\255\323"
+	.ascii	"\277\363\335C>\374\313\337\237\361\b\215|\305=\204\324yh\224"
+	.ascii	"|\036\365K\303\204\264\306<\030\367\211\271\347uU\217\267\213"
+	.ascii	"\006\366My\223\356\273\352\021\267\267\300L\030|\007\237\221"
+	.ascii	"3\317\316\312\253\273wv\344\232\353\fc\270\333\342\250\360\217"
+	.ascii	">\305\367\313\300\220\305UY\300\375\372\246\373\376\274sd\220"
+	.ascii	"\266\n\332'\221\323\020\356\017\033\275_\337\345|\221m\335"
+	.text
+	.section	.gnu.lto_.symtab.f6ffad9a0ad26bd4,"e",@progbits
+	.string	"displayPortVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"displayPortVirtualBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"displayPortVirtualStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"displayPortVirtualResetStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"displayPortVirtualLoadFont"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"displayPortVirtualWritePgm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"fgets"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f6ffad9a0ad26bd4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
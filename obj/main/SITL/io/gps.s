@@ -0,0 +1,2650 @@
+	.file	"gps.c"
+	.section	.gnu.lto_.profile.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\215\be\034"
+	.string	"\364\034\201\t"
+	.string	"S"
+	.string	"\254\240\363\203\f\b\002"
+	.string	"\001\326\210\213\371\006\272\001\002"
+	.string	"\002\002\003\002\004\004\002\005\002\004\006\005\007\006\001"
+	.string	"\002\002\t\002\t\003\002\n\001\002\004\002\001\005\002\n\006\013\002\001\005\002\013\001\002\352\263\360\321\b\003\004\005\240\342\234\212\n\006\007\t\n\013\f\r\016\017\020\021\022\213\326\277\344\004\023\024\025\360\255\324\314\f\202\f\002\f\r\002\r\005\016\026\027\030\031\032\033\334\307\272\354\tt\005\002\005\006\002\017\034\035\036\037 !\"#$\342\250\253\227\005\206\017\002\001\002\020\021\002\021\002\006\002\022\023\002\020\017\024\022\025\002\026\001\002\027\024\030\031\032\001\002\026\001\002\033\006%\207\245\203\341\004&()\303\256\201\375\017*\234\247\312W+\341\313\326\317\016,\321\314\377\240\017-\223\222\223\260\0076\034\001\020\002\001\002\035\036\002\035\024\002\017.\371\335\301\245\t<\006\020/\265\244\343\267\f\0020\307\333\345\224\001\002\002\034\002\0261\370\262\277\340\b2\204\303\374x\0173\262\273\233\244\013\n\002\0374\306\311\227\362\003\b \002!5\360\237\325\371\006"
+	.string	"6\322\277\262\337\n\002\002\"\002\"7\315\343\301\244\0138\377\331\231\340\001\020\002#\"\002\"\002$\002$9\342\332\355\253\0038%\002%\026\003\003&\003:;=\331\351\335\210\001>?@\334\341\323\354\007\024\n&\001\002\001AB\354\263\203\222\001"
+	.string	"C\242\365\310\247\017\f\005\002\005\003\002\003DEF\243\334\230\230\002\006%\002%G\316\271\204\323\t\n\001\002\001HIJ\233\336\363\315\r\n\001KL\365\373\254\361\005`'\n\001\002(\006\001M\315\343\200\255\016NOPQR\324\307\315\307\tS\265\345\345\332\006TU\240\342\234\212\n"
+	.string	"\200\373\250\321E1\221P\222\222\0246\016p\202\251\261\"7\022"
+	.string	"42\n\347\024\202Lh\202\024\244\260\232\3753A\t\3544\367\035\331;\215\3268\240\260\373\303^z\020\247\334\340\340\020\365\253y\0346>\336\020\341`%0\035[\023\224\256\323,\240\234Y"
+	.string	"\271\225\030\r\034\346\235\206&0\177\024f\260\343\317)\273\325\230\371X\230\324\353B\032\342\264\361\301dX\017y \022P^\200\260x\t:\204_\240\230p\260\227\027\025pV(\341\321\231\272\376#\364\216\275\262\305+\250D.\346\"\310\033\222L\220\004\343\252\004\031\027w4\360I\3276\275DEgJ_\243\020\365y#\222Ye\312\334p\001\356\024\314\373{#\234U\232<;t\317B\037\342\347\316L\003\354_\235w\221\275&\001\325\024\"\327\247\343\350\220\337\373\336tq?\024\337\333\277}\316\3552\355xS\275*v"
+	.ascii	"\271\237\333\020\352y\351\275\032\026W\317Sxi\f\305\361\024p"
+	.ascii	"\317+\353T0\343\251R \207\017<\033\006q-\177\272\363\026\341"
+	.ascii	"\003\260\221\177\344wXxW\177\301h[\0329\027\321\005-Z\232N(-"
+	.ascii	"\032\306\3779\001k\277\030\025:\017\250\235\305\276G<\fw\\,c"
+	.ascii	"\307\227\275\256\276\013\216\237I\027vD0\335\213\341p=\020'\272"
+	.ascii	"\303\313\332@'_b8ws\232\201bU\333\017u\323\365>'\030\032>\001"
+	.ascii	"\3450\203\307\351L\257\334\337y\235\357\230\240\033\224\205Y"
+	.ascii	"\306\336\303\335\376\303\207\312\327h\223\275\207u\033\027\240"
+	.ascii	"\027\313\203Y\355\006z\371\277\031\372a\r\271\265\235\0356\016"
+	.ascii	"\260\266\237{O\t=p\313"
+	.text
+	.section	.gnu.lto_.ipa_sra.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\035\006"
+	.string	"\242F\025\035\240k\030\003\377\377\243\360\343\377;a\312\273\237\377\377\377\357\312\371\340/\333\334EJ\231R\352\027\213V(\023\211\021}\210*i2\323\255:\230\252z.\372\024\024\241v\036;\276\001\371\337\364\375\0309\343[\230\212\252\023#\016\206\013?P;"
+	.ascii	"\3206K\3117\0015 \260\002\261\253yR3\220R\001\214\363\024sa\025"
+	.ascii	"#\n\030\207``\b-pw/\355I` \026\004\034[\004v<\320Y\\\031\026"
+	.ascii	"\244/\266lMb\001\274\213`Y\030c\211qp\202\005\222{\032\2065\321"
+	.ascii	"\272\242\216\033)\376\003\304\032b\034\202:\202\237\263\275E"
+	.ascii	"+.\277\310\003\272\f\254\247\361\330\002B\021o\201\311\244xC"
+	.text
+	.section	.gnu.lto_.inline.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`f\bE!"
+	.string	"\006\356\236I\260XQ\032\0030\246s"
+	.string	"t\257Irt\251\355b\327\3768W\370E\006\265\261\214s\376\345\024\251\236t\375P\360\343\237F\365ue\355\337np\006\355\017V\274\306?2&;\316\006.\nK+\362a2b\022\022\311\226;\005\207"
+	.string	"\201"
+	.string	"\222"
+	.string	"b\005A\253\250\236\224\t\177\265\352/\030\016\374\365KFQ|9\362\262\274[uY%\020\333Z\253\211\360I\324Zo?\3768;\215\024\361\021\0312q\366\347\317q%"
+	.string	"\360\343,a#\304Y\3336\317\332F\261\202\223\332'\343\024\027g\013\265\002j)\274\\F\245\256\232P\001\337W\266I\306\234\220Q\363>t\t\22734 \200\277k\347\374\2314]\3733\377Y\342(t\255m\322\247\017\r\323\3443r\340\t\314\362\020{\025\372U\231C'\030\034\344\001y\266\305\321m\305~\330\027I\230\262\354\255a\272\021E\3704\252\204C\213\320\204\n\217L\327\332\256"
+	.string	"\031|\322\350\226\033\224\241\315l\340{\350\325\325\225\227\360kT\307d\006\321\264\332\2375j\024\265\324\2338Q\300\377O\222\316\367\327\003"
+	.string	"\237\317\311\267\331\377Y\267\202U\254e\215\355\216Zk\201\311I\332B\251J\241\233?./a4\274u\213g\243z>\246\375\0258\004S"
+	.string	"W\001\245\355P\255u|B]\260I\220\023.\254%\334\320\310\250\323\016\t\250\0042\252\242\032p\204\357\031\234\264%\002\203\3044\352 \002\343#\300\316g\210%Sk\356f\buA\331\322\374`\316\350P\255\271r\007'nf\033\346\206\323\016r\235[\370\261-\323\224\245\307x\003\334.%\005\231\032\261\353\304La\331\311\f\350s\356\360j\376"
+	.string	"\254\\\370!\026\311\256\262\350\340\263EX\204ty\351\005\277\303\333\035\336\374\031\335\242\324\223\232T\001\217sI\372Z$ \2411Kg$\305\370M\246\005\"\326\327\002J\312T1\207\371\006\253)MR\"\354]\254r\004!X\303:Y)\232\"\243\370\204\030\215g\370\222,E\fs\233za\356\357\367\224\323\331\2474\252B\311NGk\013aY3\247\330\003\322 0p\274\016\227J4Hf\316\332\256\021\346\354\317tZ\333\034<\212\246V\"V\3209\006\336j\275e)\023\027\305\027\034|a\223\006\tE\365X.\236p;\003\344\244\013Nk\364\305\357)\200\312\250QARD\206FFR\222\202\2445`\002!CS\325\003\022`\365<\005\263R1\031\222\246$\331\217\335\214\020\263K\320\2331"
+	.ascii	"\251\234|\256\320i\036FQ\333kK\nS\225\244eZj=y\304\337G&\347"
+	.ascii	"\312\177\300\233\311K\227\361%\022\022kl\027\261\200\030\317"
+	.ascii	":sf\037\261\321\002\365J(7.\303\t\3561\266&\206\367 \030\204"
+	.ascii	"w"
+	.string	"\tO2\354\301\347\352[Xq\365N\022z\0246\356\340\210\257\324\234\r\340\3250\255\224\202\276\032\021\305J\013n\362\242H\256[9x7\243aG\362\0047\nD5vO\324\365\r\353L_\263/\306\270\246\210\2400\335\270*sT\335d\371\353\3323\370\223\305\033\301\026\260\b\004\207\216l9\306:Tw\252S<\225TF\032\245\3611%jI\363DP_z\373\362\266\224&URX\223\312I\030\357\302\036zr?\t\245\312\177\205\302*\034a\206:UC\363\242\"a!:\337\036\330\251\330Ms\224\n\342\333\024\335Q[f\323\346\t\233\225\341\206\326k\252\240\2111\223\333\016\204|\230\304\307\264\035\0321\310s\254y\275\036Y\220b \312V\355<M\034\207.\367\321\225\251^\366*\026\332:TD\270^u\020_p-$EG\244p\232w\363\364\262\222\004\177'\357\264\301\006\232\\\312\207]o\323\300"
+	.ascii	"\327\203\330\367\355\266\200\267Sr\2124x\236r\b\276k1'\322\372"
+	.ascii	"LJ\3674V\203|\357\341\327\347\215\230(\3134\334m\223\032s\300"
+	.ascii	"J`\356|\030\241\".Z\b'\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`s\b\235\024"
+	.string	"&\231T? \217\223\016$\204"
+	.string	"\004\210\226\247\004t\246\035\001H\360\340\005\203\t\232\353\207}\375\002\022\t\200\310\326\200\357'\220\322Adg\206\266q\003\3316\033\020\025\336\200f\352\321/\021\362=\366N)\005;"
+	.string	"@"
+	.string	"C"
+	.ascii	"\316R\255\n\264\305h\020\270L\371$1\221\314\301\356\367\273,"
+	.ascii	"\234_\315\361}\3026\341\273\023:\316Z\323\316\022\356\356\311"
+	.ascii	"[\251n%\267\347<\231\355\352\331\347\305~3*\241\r`"
+	.string	"\tv\373\264\236\246mA\217n\2246J\316\016\356\036&\222\202\017\023\211\342`\035\305`\334\027\356&\3778sm\215\302\007\341^\306\234!\334=\374\326\344N\021\3569\302\275\351\001m;u\266^b\2141\025\265\n^q\301*2\245\24163\244\206\334\320\220\0010\001)<j\033\206\321\310\302\346/A\333<\251\347\346\315D\333\211\216 TG\320\017\270\233\203{:QPDg\331&\003\377\355\217L\365\314<\035\355\305\260\200`\005\237\365D\017B\017\310\262\236\365\240F1,\037O\005C\017\302\367\201V\bI\311\b\225\301\340\272D@ \220\210\\\256\021J\256\221\313iT\254\342\277\363\240\325h\034\264W\333\220\225\025\027-@\312i\260\200B\353\274\223\230)\001\200\220\250qI3$T\222J\2469\200\002\221\262!z\022\240r9\006dA\220C\210\020D\004\310\b\005\023H@\224\244\240\240\300\2305l\230"
+	.ascii	"\016\\\030U\250\025\rX\022\377\272\305\3675\200J\f\344\321\004"
+	.ascii	"\361)\342\271E\332\025\256` \230\212\225\362P\"\230\007\036%"
+	.ascii	"\224\353a\350Gb\324\364\331\025\352\257\306\017\346\313s\244"
+	.ascii	"\324YuV\261C\224\f\002\320!\0320\277%ViK\007Fp\361\370C\001|"
+	.ascii	"\016\261\026h\262\337 ?\310a19*q^\314\331K\271\341\2257\257\205"
+	.ascii	"6\205\326\252f-q\250\341P\240\220{D\034\206\202d'\257\005\205"
+	.ascii	"\220\217\337xv\210\257u\320\276\200]\2135\341\201\331N;N\020"
+	.ascii	"\351`\336\027g9\241\213\033h\221\n\332\215\227\224&\005\350D"
+	.ascii	"\025D\234\"Y\345\033\\\\\272i\242\006W\230\244\261E\210\177\316"
+	.ascii	"\377I\371\317b\273\302\f=s\273\367j\217\251\273\346\240\rw\371"
+	.ascii	"&B\205;\302\370\350\333\262\226>L\260q\353&a\217\350\216m\205"
+	.ascii	"\322\274\224\003\360\371\253L\261\370x\034\336\036X7\275\275"
+	.ascii	"x\tl\337\331rV\350=\246\237\336\314\037 \345\001|"
+	.text
+	.section	.gnu.lto_.pureconst.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 M5\002"
+	.string	"\322\204\020\033\240\3270\006\376\327\310\224RUu\357\377:\351bf\271\345\226\263f70\322-\003\"\nNp\201\007\034\340\227[^y\224O.y\210<H\303\343\2167\316\370bB\361\304C<\303+<;\314l\020"
+	.text
+	.section	.gnu.lto_.ipa_modref.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`'\001M\b"
+	.ascii	"B\213\"(\200\251\031\016\230\021\0311\005K\315\300l\002L\200"
+	.ascii	"\tu&$2\002\244\377\342\277\313\017\330r(:\026\356Cb\367&R\246"
+	.ascii	";\020\021\3141\233\244\257\312\253\366hh>tR\345T\347S\326\026"
+	.ascii	"d\270\007\031\177Z\276\367\336{\354\245|i\257v9\347\\[\230\312"
+	.ascii	"\025N\270)\227\020\336@\220'\223\244-\034s\276ax@\203/\340\204"
+	.ascii	"eY\022\367\351\320\331P\036\325 \370\243N\245\\\351\204j\f\224"
+	.ascii	"?@\005\243\350\001\267\257@8 @\002\204\230\245\007\307\023fh"
+	.ascii	"H\221\234\007n\3636#v\\-wC\026\317\221-\033\214X\f\323\251\335"
+	.ascii	"\234\233\302p\240\347\372\342v\304\322\334\013\272\275B\2721"
+	.ascii	"b\030\315p\247\355\310\304.\310\300c\003\r\2637\214\025\212\204"
+	.ascii	"\004\301\316HW.\354\345AW\360\302\207\253\rCf\332\236A+p\301"
+	.ascii	"\370_\2638\271k\371\b\242rA\262\203\214\212\006\244\255\"\267"
+	.ascii	"\335\030\353\020?\200\""
+	.text
+	.section	.gnu.lto_.lto.6375a6750043fd8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsPacketLogChar.36.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 <\341\001"
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\374\342\303\314\221\t\177}"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.text
+	.section	.gnu.lto_gpsInitData.54.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\265\001\375\f"
+	.string	"$\024\201\001"
+	.string	""
+	.string	"(\001"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\204\205\374Q}\273\001%\206\b{\by\275\006\035\001\001\004\005\001?\202\210\200 wu\300\001s\277\001q\276\001o\274\025'G\206\bm\230\367\001k\303'\\\206\bi\bg\305\006\035\001\002\003\310\001s\307\001q\306\001o\304\003\005\001'\177\330\366\001k\313\224\001\315\307\001s\310\001q\316\001o\314\002\005\001'\267\001\230\366\001k\321\314\323\277\001s\300\001q\324\001o\322\001\005\001'\357\001\206\be\330\365\001c\326'\205\002\206\ba_\330\005"
+	.string	"\333\001s\332\001q\331\001o\327(]3\334\0014\325\001\320\001\317\001\312\001\311\001\302\001\301\001"
+	.string	"\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\024$PMTK251,19200*22\r\n"
+	.string	"\",0*2338476576CD\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"#,0*1E\r\n"
+	.ascii	"/  \243)\362\005\002\300\252\376\322\021/\270W0\356\"\\`/\005"
+	.ascii	"c\343\224\374\025\250\361\037\301\315\324\326\3124\201\016S\363"
+	.ascii	"\005\270K\367ua,w\373\352\303.\031hL\220u%\2147\035\352a\214"
+	.ascii	"\254n|\304d\007jj\017\253'\2513\246\313n\334\331\254q'\364j\002"
+	.ascii	"4\002"
+	.text
+	.section	.gnu.lto_ubloxInit.55.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 \306M\004"
+	.string	"2G\032&\200K\322\001@\\d"
+	.string	"\243\316TOb"
+	.string	"f\340\031C\214\3244=.\tT\257X\207\232\356\332@5EH\333D\246\020\313\275W\267\247\271\36704\222(\030\242\021\2651\240\346\002\320Ui\2633\310\274 \370\002\314%h\316B\234]\3166\367*\322_\375'\356a\307p8{*\220\031\343\323\324\334\353\344\310Z\324\224\337\t\r"
+	.ascii	" \023\220\t\310\004d\r\006\001\231\200L@& \023.\271\242\030\233"
+	.ascii	"\323\256\001\024\001"
+	.text
+	.section	.gnu.lto_ubloxAirborne.56.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 >\335\001"
+	.string	"$\003\004"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"'\002\002\177"
+	.string	",\265b\006$$"
+	.string	"\377\377\b\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020'"
+	.string	""
+	.string	"\005"
+	.string	"\372"
+	.string	"\372"
+	.string	"d"
+	.string	",\001"
+	.string	"<"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	"\034l\002"
+	.string	"\002\243\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_ubloxSbas.58.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 \334\345\004"
+	.string	"R\210\037+P\345$\035(\202\2537\253\004\022H \001\003\352\2145\263\273P\363\034\344\314\314\264\031\0351J4`\205\354\325v\032\220M\032I2\001\212\266}\017L+\200\274\214\241\016\300\275\201F[\353\023\330\264g\257{\376,z\264\351\323*\306\255E$\261\212\263z\200\347\250x\352\002<\033)^j\030</P<t\r\340\351&\274sN\274#\231`\331\305\3428\335\224wVZ\203g\021m5\001\f"
+	.ascii	"/\202\240\334.\344\003\345\202\254\301 P.\310\032\f\002\345r"
+	.ascii	"\250\374\006P\004"
+	.text
+	.section	.gnu.lto_ubloxGalileoInit.59.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 Ve\002"
+	.string	"\344\003\004"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"'\002\002\177"
+	.string	"D\265b\006><"
+	.string	""
+	.string	"  \007"
+	.string	"\b\020"
+	.string	"\001"
+	.string	"\001\001\001\001\003\002\004\b\003\b\020"
+	.string	""
+	.string	""
+	.string	"\001\001\004"
+	.string	"\b\003\005"
+	.string	"\003\005\006\b\016"
+	.string	"\001"
+	.string	"\001\001UG\005"
+	.ascii	" \b\b\017n\274\322\006\006\340"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.64.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 \227u\004"
+	.string	"\004\bi"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\303\345\203\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\006us\250\364\005uq"
+	.string	"\005\001\006'\001\024\005\001\006\035\001'\001\036?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.66.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 F\375\001"
+	.string	"$\0039"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177}\001\001\005\001\006{y\001"
+	.string	"?\202\210\2008wu\277\001s\276\001q\275\001o\274\001m\273\001k\273\001i\273\001"
+	.string	"\004"
+	.ascii	"5\305\300\335\024\253\007P\004"
+	.text
+	.section	.gnu.lto_gpsInit.69.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\021\b\035)"
+	.string	"jI\334\017Bp\350I:#\202(B#\024\353a\234\030\235\255\266\241\237\306\251\334#\017\350\212\367\316`\375?\351\277\275\t\305\247\002\306n\204(\013\002"
+	.string	"f\343\234\2262"
+	.string	".\201D\275J\002\031}\361\223\266\t\2212\311\354"
+	.string	"\337"
+	.string	"\357"
+	.ascii	"jj\255\252;T\335\3105,'\373wo\226\202\r]1\201P\354cN\334\345"
+	.ascii	"-\217\017\227\374\n\353\022Sk\345\235\334\345\261\313;\331/["
+	.ascii	"\336^\314\307\350\311|\274RY\025\025\001\003\343\247\326!\205"
+	.ascii	"\223\013\241<\271\303\027\230'\313\017\230'\227\356\362\371P"
+	.ascii	"J\375Y\326\2172t\265\326^\177\355\216\351\215\212\312\035o\036"
+	.ascii	"\221c3\335C\335\210\370\021\254\310\237\242\261B\326\231\234"
+	.ascii	"\277Yi\215\003\340\272@)\377f\2255\305\2732\311y/;\023\030\232"
+	.ascii	"?O\260\262>\003dI\362\243\321\303\230\030\330\337\254\226\214"
+	.ascii	"M4\303\306\273\242br\334\320\005H\332\337\254\224\214\274\263"
+	.ascii	"A[\256\305j\213G\rhtb\b=\301\332z\217\032\320\256\324\222\256"
+	.ascii	"\244F$.|\264\274\354,\344\n\310\274\373Pk]\016^a}\221\276\273"
+	.ascii	"vv\027\303\356\316Oe?\327\032\233\033\260\241v\037b\351wB\330"
+	.ascii	"\3612\243\233k\3207[\246\323iz\343@A9\005\2747#Q\202\037l\320"
+	.ascii	"\013\260\264\334\2007[\023o\233\263+\226a0o\266(\016\307\367"
+	.ascii	"\346f\037\335\234a\013\312\031\340\002_8\223\302?<\033\213\250"
+	.ascii	"\007\367m\356F\305\n\026{\026\263\205\013~pym\314\215\252\241"
+	.ascii	"\366j\276\373\342kk\352\250\2115\315]\030WkJ#\213it\367\315]"
+	.ascii	"\031G\363%I\251\265r\330\237\371\231\323\276\312\311\255q\203"
+	.ascii	"\037\2741O\276\354\022\302\322\304\346\242\270nw\b\344\026\262"
+	.ascii	"Q\253\032n{\3556\357\203\346u\320\274\rN\366U*y\223v\274H\315"
+	.ascii	"{4yy$\257\321\344-\"yK\222wG\362\316\311K\222\274#\311\333#/"
+	.ascii	"7\3573\234\313\215\356\217\210uP\370\212\n{Rvw\260\025\375:\020"
+	.ascii	"W\253T\207\223\313E\270\212\202\215T\250\225ie\236\234\335\003"
+	.ascii	"#\033\233\354\377H4\304W\n\031{7\327F\210l\254\265\326\035\207"
+	.ascii	"78Sx\355\205\346A|\006\200\024\205\331\021\233SR\343\0024[\270"
+	.ascii	"\177\237qy\2659j\257\361\276\331\275 \312\027\2319\335\2732x"
+	.ascii	"\312G\200\245\202r\367\315\261\273{\2441C\325\005\344\272\246"
+	.ascii	"\243\207x\206l\341\336\307Tj\004\302>\023\230O\263\314]\272\205"
+	.string	"r\341\007\225\252\254\005r\223j\250%\366\231\2123\266\020n\351\211\0209\350\027\227\351\206\n\025\035\024\327\304\007\t\342\342\2428 \271\242\200\266 u\272\205|\372er\307 \203G\212\013\355.\365\362>\364KY\253\024\207\375\236\363\241a\350\030-\243e\363$7YtC\210\354\275\013\342z\362t\332\222(\321\017>\247\0318~K;\236~'t\344\360!m\323\005\0359|\275\237S\017\207\023\214\033\275\246'\035\275\013\004\366\227C\306So\307\357\367\324\343\r\243\336^\373!\252\201D\243%\356\302\\\036\364\211\313\304[X\013\361\001qM0\026\276r\342\242`*\276\244)\304G\b+\003\204C\223\213\020'7W\364\233I}\"\030(@t\360$\365r\024\376\372\355\253,\005\322\251\251y\362{\202r\036xO\203\314>\0252\217\272\367=%2\271\036\251wi\025\275\342\007\223z\254[\re\204\233\320#"
+	.ascii	"\342,\304!u\217.+4\270\213&)\227\2270\027\325RB\271\270\346\311"
+	.ascii	"\243\276\034<kF\315\333\242\302\327\331`-\372u\270,\243~]\331"
+	.ascii	"EH\216\224\335mQ\016u\215Q)[\330\263[\020\231<R\\\210\t\033\361"
+	.ascii	"\225\0345\202:)k\255\273\276\032\036\262(\016\200\217\250Q0\005"
+	.ascii	"\2352\f\225\210\004i\222J:\260\002\021\0313z\021\020\245SNYI"
+	.ascii	"\265\236\325BQ\245\375F\\\276f`\370X\033\216\017\322\037j\305"
+	.ascii	"&\312~M\325\2434\214&%\251\007\310\366+1R\352P\363\365\250*\237"
+	.ascii	"\302$\217_\374\202 Z\"\340\301\200\327\221\260>\202p\333\034"
+	.ascii	"'p\331G}Cm\221\366\366\004H/H;`\343\030-[jG<\234\310\272{]*\254"
+	.ascii	"x\212\316z\016\221\203\333\326\001\340\b\034\234\334\356pit\034"
+	.ascii	"\021\200\347z\301@zy\252\340\3422\333>Kc\257\223 \013\363\255"
+	.ascii	"(\221\355\361,\243\361\261\266\305\315\374\363]\330TA\363\347"
+	.ascii	"\007{gz=\004\0059\352\235\234\327u\272\3503\234\310\030\260q"
+	.ascii	"\202\314\211\232\333!\267@\266\013\345oJ\207>\362\200\027\037"
+	.ascii	"v\022\026\0358BM~\224\253\007\330[\001v\344\310\204\217\245{"
+	.ascii	"\342\036\260Q}Qs\355\326\267\323>\212\215+\353\260\024\377\322"
+	.ascii	"\262\377\t~\204\3654=)\214\002\362\334\236\270\363\316\250\217"
+	.ascii	"\341\344g xj\220_\321\261\324"
+	.text
+	.section	.gnu.lto_gpsInitNmea.70.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\224\t\215,"
+	.string	"\232L\260\020Dp\250Q\007c]\365\370\001\352\2230\036\030$\201Re)\034\022u\355AY\302?YIbgl\266\330\334\304\262L*R\200\362\363\205\020\243\224\354v\375\227m9\226H\261\225xMK\266\215\273m)eJ)\355"
+	.string	"\351"
+	.ascii	"\005\001\367\273\206\277\323\373M\273\337(\376\306\367\373\336"
+	.ascii	"o{\277\337~;\004\244-;\032\276r\336\361$\224\3010\033)\216\364"
+	.ascii	"e\2327\376\305\225\335j\317\360d\343`\230\226\234\263\352\270"
+	.ascii	"{F\267\352\370\235\253\325\366.\356eu\244/\375\021S\2571\204"
+	.ascii	"\2329'\0338\356\245\324\261\001\317"
+	.string	"\241\216\257\033\241\216{\355\366\343\311\253\354c\314jt\225\345\234y\326\211\257N\204\273\r\251\266ZJC\361\265\277\266\377\234H\351^\304\335\214[D#?\244\372\035b\021\337\"\022y\333\220\332\322_L\263\3131\245\371\035b\020\265X\343QWRu\304\361\3255\327\b\302\025\2057\267#\312P-\006\377^\235QN\017\\\221\352\346\354,\351\343\\~`\213x\344\255\020[\021\210\346\2360\263\\\t\361\210}\232\204\234s\377\260X\345]\344\335\016\240\273Gt\327\b\004\327b\247\327\021\271d\337\370rb_4f\030\263 S\377\354\346\032'\330\265VM\013s\037j-\r0s\250~P\277]\262\326\276\036\341\024`C\271\033_\233\2674f\327\021\367\335'P\274\017\227l\356\007\0170\240\375\265\227q\2433\260\337\027\362'\314'Lk\255\322\264\253\261\375\303\214#kJFb\246\375L\373Is\376\271\321\275"
+	.string	"\352\370\217\262\020\353\331\314939\231vcz\225\2119\231\231T$T\177\326\335Q.&E\232s~j\017\343^*\332\265\034\267T\213\367a\013\324\261[\347\362\327rRf\364\202\234\372gw\022\370\326\252\333\355\363\371$k\313\244\373~\353\3567\323\222#\275\225\356w\322\375F\302\337\002\356w\356~\037\341o\243\373\035"
+	.ascii	"\375\006`\277\213\320o\"\373\215\273\337\267\373=t\277\325\373"
+	.ascii	"m\013\025~G\212T\007\316>\b\3161C\252\326\352\3669\036\307\315"
+	.ascii	"b\347\034\245\277\3616\344\330\230>"
+	.string	"\244Z%;\364\302\017\252\226\306\374R\262\271\037q\320\270sy\252\347\312\024\263f\3151\240\276\354\013\377\303\360\231I\230\2621&\353\313\206\362\263B\357\034\002\362%\223U\252\022\"\207\204\017\362\231\321\226]eci\334\227\035\345d)pW\202\226\236\300J\0270\214\f \247\2603Y\251m,\220\036\257Y\333\037_\332\254Y\354DsD\022xO\272\237\f\n\304r\026\372PC*\\\260\240\233\203\007>\251\305\3013\003\334TA\322\234\001zm\223VX\231.Y\f\265VV\314\207$\026\346C@\356>\024\2654{\235B#\360\237y\360\240\026;\315\034\221\271O\220t\037\212m\367\007\020\357\3036\020\264\277n\247\343ub\264ku\210\021#P\307\330\342\240W\002\037cd\330Z\265\017\275\226\006\230=\335$<\216/\205\023m\273=p\240\353=\355z\275\335\203\244\266\335 \364t\275\235\323.\302\256\327s"
+	.ascii	"\301\311i\347\264\353\365\234,t\360\260\001A\001\031R+l\233h"
+	.ascii	"z\301\002\005O*\212\267\"\nJ\005\317\204\213\027\274\246\243"
+	.ascii	"\226bq\302\005\017\206\224\224\013\236\232\234\362\233%LY`\373"
+	.ascii	"\030\t\277/\3447\347\234\211~\352\302o9\352\254+\033\352\263"
+	.ascii	"<\026\245N\331$\276\312oaeG\275\224\217\242\304%\275\326g!\331"
+	.ascii	"\244\307\372+$\213\235u\314\276\311\ne\225\222\n+,p,\340\227"
+	.ascii	"\b\2608X\347x\333\3437\333\004\205l(\367I\036\311\221\315\275"
+	.ascii	"\361\215\034Y\354\244\023\300\032\375\020#{\204%\342\203\254"
+	.ascii	"T\322\376\037\017d\255r\327+k\2265\013\3528\200}\302bSd\001\254"
+	.ascii	"\307\357\261r\361/\261\234\251\236\272\273\304\363X\275\370"
+	.string	"\362*g\252\b\216\373\213_\265r\335\t\024\320v\n\250\343\"\353_{\220\226\310z\215\263\251\200\260\250A8\252\0304E#RRP\220\244\305\320\002\021!\"\326\001\021\320(\205\034r\206\306&%\2054\006\0308D\310V\204\305MR\340\277h\251 \267\337\255\007\276m\353\025\331~p\326(\215\3766\374~iu%\324Gz[5M\371\2070\022\203_[\277K\334\357~z'p\316(\337\365_\211\305\216X\231\207\360\250\301\2239>\233\365Er\260\276\201\242\326%Ve%\\\304\002mI\220\357qH\006\001\032\345[rb\346k:\237S7\311\230\306\021\020\212~fs\261\374)\203\374\t\240\002N\307\271i(Z&\341\375\025\311\001Z\366\031\0363M(\301+\333\331\256F\301\321/\215\2534\327\347\200v\314=\216t\336\350hKC\240\353\204\311\231\201\003;\340\304P\351\300\327\365\001\310\351n\030\351"
+	.ascii	"\273\331T\216\2013\177\207a\n\004\037\355\017\0355\307\314\305"
+	.ascii	"\001\346\211\352\224\374<\350\3553V\310\273\253\002m\026U\373"
+	.ascii	"\276\200q\304\327\321A\034O\305-d\n\203\253\036y\031\264|\327"
+	.ascii	"b\314\r\356\260\377\256w\251\321h\023^\3709Fu\336\231(E\210W"
+	.ascii	"\225\035\026@S\201\362\345\013:\353x\325j\366\300L\r\300\264"
+	.ascii	"\256P\316\233\025\223\3133+\236\016)\316\013\022\274\226X\234"
+	.ascii	"\304\006F,5"
+	.text
+	.section	.gnu.lto_gpsInitUblox.71.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"e\t"
+	.string	"\326\021A: \005)\035h\035!\212H@2\013\300\302A\200\205"
+	.string	"\271D\330\225\370\234`\300E\335\332O\366\221\031\374\214\031\215\233\261J"
+	.string	"\330\033\004\212>\177\365CX\350W#\226\020)S\n0"
+	.string	"1"
+	.string	"/"
+	.string	"\273\033\025\344\250g\232(\277\363u\317\002X\327,a\243\205\345\371T\331\300\313#\346\256\347\305\267\312\334@\273\353\364\276\214[\273m\005\333\006\266c\001\007-\330\215F*C\033T\245\266\354k\030\206\241\365\303\316t>\375\215\240\344\265P\263\213\021\306\366Ec!\261}\217Q\266\314\301\220\275\212\213E\212MV\355r\005\366\342Pm\331\246\340\2446\240\300\254\022\200\267\274\332&\211\274\227Z\260\322\316\276\311O*\374\021O\234\362\3365\377\304\271v\275\353\001\016}L\244\207\310\211\"\204\210a\024C%S\374\b\230#9\224b\004\307\225\242\007L\035\224R\325;:\221\031\232\005\027\341\031\340\331\356n\326I{\304\345\275\016"
+	.ascii	"2\003N\035\206YX'\002\202iX\001+\200\266\217\205x\241\207p\350"
+	.ascii	"2\364\313\020\342\322\2654M\003SP"
+	.text
+	.section	.gnu.lto_gpsInitHardware.72.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\036\001\035\f"
+	.string	"&\325MA kL:\3434X4!\021\006G\265\261\030\312\377\3671\356\221!\220b\310=\202\341\354T\212Aw\2044\234\321\006\336\254\233#(\t\266\007\020\004\006\200\021P\247p\260h.NR\373d\223\275S\n<"
+	.string	"8"
+	.string	"="
+	.string	"\247}K\200\210\245aw;J\340\237\327\215\316\217?9\310B\361{\365P\330\256\372\226`\003\206P\fp\032\002\271\b\224\253\200D\364\240\023b\331]\317P\374\270\271\333\256\260-a\037@\n\276\352\360\r\274\272\343\231\017_}\017\367z\n\021\265f+\320,\355\021\234\324d\237\226e93-\331\237>G\241]\350\310vG%m\311:\001\201\355O\374\261c\037\003op\212\004\362\233\265\243\\\250\n\224\232\016\301\217\360\003\251%9\360\0378\026\271\006\367\352\031\356\350\224\262\317\300v\f\362\262\260\373}\300\fwbB\n\315\016\2669_\300\021\331\rQ\370\001\276T8\032\214\316\303t\031\030\213Lw\331p\272\n\204=\315\305\246\333\360\274M7\031A\337\226\226T\217\300j$\210\202\376x[\266\212\311\300\372\204\2756\311\2643\336|\350\007\230\213\004\351\347\036"
+	.string	"2\241i)`?\216\252!\t\366\205\003\205\201,\236\032\024H\266S\301E\273\0307\355\201W"
+	.ascii	"J\236r\006*\254\225\332\306\321\261\020f1\3160>e!\\Fy\031b\\"
+	.ascii	":\230\215\277\b\322\f\346\324\245 \213.+O"
+	.text
+	.section	.gnu.lto_gpsUpdate.74.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\032\021-L"
+	.ascii	"\212{\004\033@@\244N\007\023\364\276\214\024\004\021\b\345\021"
+	.ascii	"3D\t\222l\017\315\347\307\225r*,\002\021\355\272~\235\212]\364"
+	.ascii	"\361h\223,\375O/|,\277\350\027\275\3121\" SUU5\033\273\311n)"
+	.ascii	"\245\024\236\001}\001\245\001\327\271\350:\037\2573\321\352<"
+	.ascii	"t\235\215\253\363U\235U\243s\361:\277\352\354\252s\263X\221F"
+	.ascii	"\316\016\277\266\035\222X\250\005T\317\264q\213\351\275\033~"
+	.ascii	"{n0\353="
+	.string	"\022C\274\b\3171_:\232\243\3538\304SM\016\346\366\322v:\272\216\033<\365\300\265m{l\225Y\007\363\261U\365\310\314\355\314-\327slCw\360P\333\246\305\225i\333:\005\034`m\025\331N\267\325b3\335V\231e&\354\272\265\266\311\260\021\213\nj\333v\353\2410\222\357\263}eUE5%\025\005\365\344\324\304\264\244\224\204tdTt$\032Z\215\310[\314z,g\271\237\177\230\201a\306\274\372\212\256\255\350\240^E7\347Tr=%\307\305\245\212Sfo\212h\331\305y\224\034\234C=\031)8U\241\342M\305\003fo\212\264\324\331Vt\222\323D\317\024gb\353%6)\256\304\026\305\223\214\024\242\335cHkg~\204\327Yy\205rS\243\262.\222:\313\212\3107'\023?\032)\320\365j\350\326\203O\032Y[\023\231)Yr\223\332\266\3554g[q\b+\215,I\257\305\003\205f"
+	.string	"9\r\251\322\3547\347\323\215\305\267\303\363k\2513IQ\302\034\\\224\246k\3771\306t\244\347\365%r;\322\3050\262\274\316*^99\233\036\307\300\212H7\200b\275\327XRg\030\377\365Hc\025\231\222\354\3259\032\023+&\250sEI\3235\326\233S\317\335H\241m[\366\346\030Ys\200f\366\033\314\314\200\031\251E\032\376J\347\301\343\177\232}\264\234[\217\335\302\306y75<\025Y\022@\346{q\267\351.mGY\307\370%*\310P\355\252\333z\314\316u`\362h\255m\333\007\334rZ\312\322qOi\225+X\260\240\327ZX\242L;a\372\374a\240\333Zu\271\036\361\316\273\352\032\237\353\331\305\236\314~\323p\222\030\270\270n\253\3067n\3313-\352\021(g|5\345\275oA\312\325g\366"
+	.ascii	"\302\273y\327\250\337t\255%F8}v\027\333\266m\221\336#\r_\337"
+	.ascii	"\345'\347\336\033A\302\273\311\377^\255\247\316YV\354@lolY.n"
+	.ascii	"\006&/>\367\336\t\024\336\315\f\337{\255T&\020\016\340\177\361"
+	.ascii	"{P\f1\311\375\231S\254\360n\376#\301\336\353\214\277Ql\317\007"
+	.ascii	"\346\261\323\373W\343n\252\"s[\260\270\306\355Wq\207\007\314"
+	.ascii	"\0071\367\230&S\203{\n\263h\341\335lq[\355\177$\204q\317/Od\256"
+	.ascii	"c\372\2531w\20124?\374N\230W\347\020\327\031\204\321\371\303"
+	.ascii	"\352\354au\356\260:s\270\316\033Vg\345\352\254\341:s\035\235"
+	.ascii	"34\264\373\302u\236p\235\007\\g\255\353,\340:\0078:g\255\316"
+	.ascii	"X\2533Ru\2762:[]\347\252\325\231\212\310\031\300u\236\"r\226"
+	.ascii	"Z\235\243Vg\250\325\371\351:;]\347\246\325\231\351:/]g\245\353"
+	.ascii	"\2344\344\214\264:\037\255\316F\001\335Q;/\321\004\336\177\232"
+	.ascii	"\231e\262l\236'\365\003\004{\257\265;E\220^\215\231\2764\313"
+	.ascii	"\343F\375A\375\323G\375\367\205Y\231S\256rP\257%\b}z\317\223"
+	.ascii	"\242\021\353\246\353\006\002\206H\341\264\360\350\325\366t\233"
+	.ascii	"\3079\234\362\257\270\026\317\202\247\354\342o\356\346_\335x"
+	.ascii	"\314\316y[\362h\255J\3439\375\224i7\275\223KI\262b\\M\337\365"
+	.ascii	"\344\233>\277\222>\034J\322\351\216\253\371\023\366G\020v\310"
+	.ascii	"\220\333\252\215'\037\234!\2237Q>yZ\221\217\351\213k\244W\214"
+	.ascii	"\226\376,Ie6\247\225~\351\231\002{$\206\235a&o\322+}\361\317"
+	.ascii	"\230/I*Iz\031O\2748\250\312L#\244\2105r\221\276\323\2108\022"
+	.ascii	"\326\310\332\266`\017\330\215\370\021\026\t\233\204]\302.\271"
+	.ascii	"\255\"=\216'\2308\350\321\023Q>9Y+\257\321\037\375\017\206\231"
+	.ascii	"1=\261\314\207(]\210\321\227xF\247P\367\321\235'5r<;\212\223"
+	.ascii	"\350^}%\b\320\313\017\211\304\326\312\210\274\311\376\3436\255"
+	.ascii	"\364\340\246\323h\255\333\231\225/\347\341aLhD\\\363]Uu\277\330"
+	.ascii	"\231L\270\266\255W\233\265\352MmX[\241\302\026\2555\340-\267"
+	.ascii	"\331\272\326:\333\272\326\300\021-\314\021\231\021\223\353a\321"
+	.ascii	"\033\003\261\201\032\016\035\237P7\373\034v\362\022\375\361"
+	.string	"[\020\321\253x\200\342\236[MX\265+5\200\t\034\331\312\313\314Fa\331\212\342\364\r=3K\245\375(\233\372\374 \017\r\035\036:\247\205\334\254[[\023\262n\203N\300\b2\f3F\260x\341B\004\r\030,\272\272j\2540\342\025\013f\310h\261\025\303\305\026\f\027)^l\255\350\232\261\265\240\211c\310`\321\265E#F\214\256\255\343W\277\2235\260\017\360\353\231W\003>\254\021;y\265~\300\3673\265\336\304spj\265$t\005\274K\271\023\\\332\371vI(Q\300;\020\204Vm\220\006\370\r\317~\230\024\344\nP\374{\016\306Q\205xBN\247\331g\210Ha\357\270\027>\304\367\263\220\23503\246\032\310\313\341T\261\223\027\304\377\333\335\237]\240\344\n\b\304O\210\002=\356aN\245>\274\212\2738\036\376\3037\237\030b\207\277\360\036\276\303\254\270\0377T.\363,\007\227\203\267\325\016\337vm"
+	.string	"\t\235\351\263IH\031.Q\257\326\327Y\031\226|\226~\274\233Y\337y\201g\200`\211\335~\b\365j{X7\001\204r\3179p\206\375e\216\354\t\353\365(\005\344qg#\037\353\325C\301;\3108q\320\244[\375\3253/\003-\247H\036N\347\352\207\236Uo\365\317'\206\370\345\211\027<pI\b\002\273\034\227.\017\213\313D\326\353z\335V\253\276\001=\377\246g\030P\332\307\351\325\030A+/\325\267\364\016\316\237\022\016\325\267\363\371\027\007u54f\223\3675"
+	.ascii	"7\254\333\332\006\300G\301a\303\304k\224~p\3177iX7+4X\236o\340"
+	.ascii	"\f\333\257\314\327R\234\236\360\\\356\360\364_O\375\204g73\365"
+	.ascii	"\255F\260\333\320x(I}\277\335\t\222a\335\3261R\004\314D\345\314"
+	.ascii	"\346\240_\236x\377\352|$E\367\304p\370\216\352\345E9D\243"
+	.string	"_\232\001\201e\250q<\006\025C##\"\"I\222B\032\003\201\005\204\020&\035\264\033\021 1B\220\321\214D\251\223\306\270\254bh\225\254\017\241\377\006\3078\2335\346X9\334B\236\236b\360i2\003%\316'\201\246\343\024\267\362\tS+\325\2732\031=\362O\226\303\370\022\327\263\355E\006#\031)|\006\0326\206\021\247\007\304\246^Bt!\266.,\342h\023c\f{\261\bbm\"\365:\264\264%\335\225\f\213/\334z\225m}K\n`\252P\b\025>j\221\313s\312\235\226\267AsC:\231\262\272LhqY\360R9\005\305\316\336T\242\210u\255[\2527S\005\036\315 -1\007CF\216\024\221D\272\316\200-P\005\301\221\264M\2558\003<.F@n\241\257\351\nY<\304\275\247\362\202\255,\215\327\355\372-^\213\201\273\343\357\330vx\024?\345\301?O9\3502\331\335\244\030h!i"
+	.ascii	"\317}\326"
+	.string	"C\340\035\277-\017\005\223\263Z\030\247H~g{\253u]\\\263\362\331f\341\213\274c.n\247]$9\374\025\305\356@\024\331\353\255\0130W\266\272\323\361T\324]?\333|\f\265]\222\3714v\003Be\215.\361\025t9\231\236\343!\001\205\306prXV\267\315\233\207@q_\270\316\177D\273\220CU\216(\234\366\274F\203\303\363"
+	.string	"\206\240r&f\325\347R\231\2203\304\344Fs\370\243\307\360\202\007g\304\216o\364\315\006\232\026\264\326\333\216\273h\316\357\320\006\241&(\310\354\203\200E7\366[q\303O\003m\210i\300\325\364\246\341\306N"
+	.ascii	">HK\346s\261\030\2165\270L66\365\353\223\210E\311/\322:l(\321"
+	.ascii	"\220h\204\323\224[\311\325\313\361RQV\3623\207\346\031A^\002"
+	.ascii	"Z\237\322@b\2307\357G\2660\272\023\320\212\374\373b\324\343\003"
+	.ascii	"\246\373\333\215\370\367\335&\033\321\220>\363\334C\241\2231"
+	.ascii	"#/\035\316\260\003\227\021\020\364\235\356bh\314\017\027\266"
+	.ascii	"\366\350\221rT0Y\205\204\b-l\274\237\006\202\006\301\365\222"
+	.ascii	"\271\306\336\213\252\214\302c\3073\210\230\001\333\241\347\337"
+	.ascii	"~ \372]\325f\307\342\326\3202l\220$\246\350\312PtQe\020\201\342"
+	.ascii	"8\024\361<\310:\352\343\327.>]\00788|\342\375\373\310\3728\205"
+	.ascii	"\232t1\337r\212\236\201\225\242\321\345Ba\222G\272\347l\324o"
+	.ascii	"\261\371m\321\310o\274\303\241)3a\300rk?\354S\031WO\250\222h"
+	.ascii	"I\362\3013\256Q\310\254\363\351_\257\n6\206\f\021\205\221<<\230"
+	.ascii	"\306\215\b\321\313h\346f\023\021\241\350\346\2025\245\241\320"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_gpsNewFrame.76.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\235\001U\017"
+	.string	"\226]fE\360\262&\035\350\373\300\271\212[Z\262<&e/\214\212\310\026!\036\257e\311\330\260~vc\260}\303\371\331\326\214Q\271r\345J\240\253\277k\235\310&B\347\342Z\227\221\214]IE\373\034i\311\004\222\275\245L)V"
+	.string	"L"
+	.string	"S"
+	.ascii	"\232\237\301`\335m\221\311\331\365\030\030\201\366h\333\r\034"
+	.ascii	"\244\330t\017f\005\002\353\240b\303c\327\343\024\304M\217P\323"
+	.ascii	"\344\237\036\225\205F\307Z9<\315aN+F\r\216\027\254\225\253*\225"
+	.ascii	"\025x\351\204\330X\0314\001\210\354\256\263cq\270\263"
+	.string	"\333\216`;\201\235\003\002\252\007>\212{#_\304\243-\224\362\335\243_\312\036\257:Z0dN\240\362\263\275T\352\213}\375\276\257\207\325\305v\032\344\364\366\231_s:j\032jZc:a\372\001Jv\2546\260\336\302\331]}>v'\316\030a;\305\376\330\016\2526\211I\276\003\351\001\225\236\234\252zMS\267T+\207J\017*?\177\305KJ\354\234\362\307_:\257\230\352\213\337\302wq\230\230u\331\370,\314\243]\224=\376\256\205y\210y\215m\036\0031\033\273\247\267\330\346\311n\027|\\\252\354\261=\341)N\264\335\241;\024RB1\341F\"\256\202h\344\204\013\221J\\\b\210G($$\356\302hD\342>\036\352p\325\305\024`&np\3227e\031\211\017p\323\323\034\002,\246 \215\252\301\326\224\257\342\026\201\273\273\221@B\265%\214\344\273MS\250[\212\245\306o\256\340\206\f( \003\037"
+	.ascii	"L\023:/$\336\337\n\034P\0017u5\270VC\201\274\217 \332\230i\311"
+	.ascii	"\277\323\006\253\200`\200\346\247\234\201\nk\245\326\216\032"
+	.ascii	"x5\273@f\006.0\237F1\232@\017\327D\217\211c=\027&\270\006\314"
+	.ascii	"\343\240j\n\334\355\334\362\004"
+	.text
+	.section	.gnu.lto_gpsIsHealthy.77.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514`m\322\001\300\216\020b\242*\335Z\\9#\254W\334\22052M\264\005tk\350\330\241\321(vWM-"
+	.string	"AG\314\305\035\261#\211Z\370\rM6\2212\245\276X`\306\301=\214\203\3000<\270\213\005\235\245\342\227i\260\234\304{\226\243\304=\265*R%\350\250\307\355\260\272\252j\310\247\344q\304?`\300\356&\370\036'M\370\032o\246\320\344\2617_S\275]\0072H\235<\331\221\223ja\237Z\025\331Nk\246O\t\230H\262\207L\273\240\323\311\212\264\322\310\366\306\246\370"
+	.string	"a\343\353\021\003T\331\350\370\200\230\354F\247\027\277\236\227\177\216/\214\204J\260\214\363\004P\330]'\226U\334z\333\006\266\013l\217\002\t"
+	.ascii	"2\241g\037\230\302\004;T\241\270&\246\214 K\210\034\356\234\251"
+	.ascii	"\235O"
+	.text
+	.section	.gnu.lto_grab_fields.78.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\233\005m$"
+	.string	"zB\204\016I\240\230Q:\021\034u\346:_r=C\261\247\247\344W\255\307C!\n\215#\021\232\036\037\323\337\204\235\313\305\276\227\203\031\234t\234\306\265\236\302\350\360\"\277\202\017W#\372\032\316\357?1R\374`\367\326\312o\t!\204H\231d\327"
+	.string	"\304"
+	.string	"\331"
+	.ascii	"\037\266k\035j\341a\336}\324}\f\275\b\342\265Zi\020\261\252\265"
+	.ascii	"\230`\007\240/\267\210\036\352=\206\266GA\004\221p\2078u$d\253"
+	.ascii	"\326\242\016\367\033\363%y\033\363e\333X\031\367NC\233\311b)"
+	.ascii	"\354\205\236fI6\367\366!NsJH\0222\235\306\364\004\214\301\263"
+	.ascii	",\340\220\352\374\013\026\261\254\206\020\306cHL\234\2768,\013"
+	.ascii	"\370\202\304\345\236\200.\370\225K\022\2668JFP\262\002\305\263"
+	.ascii	"\200,H\276\261E\314\237\200C>\311\003\303()\236\005lA\336TQ\362"
+	.ascii	"\222\006\217\330\024\"6\021\223$DzI6\020\261\205\024\343:\272"
+	.ascii	"\222\006E09\013\372H\\\2555\r\032q\237\352\026\210F\304$\ta\234"
+	.ascii	"O\t\265\326e\022A\341\267\366\335'\330]\b\273eO\265\276i\017"
+	.ascii	"\302|\371\356/?\027D|\374\315X5\351A\366L[\237\352\003~0\201"
+	.ascii	"\222\332b\304\\\375e\206\216\255\356\245\335b\b\276\001\2452"
+	.ascii	"'\266i\354./O\001\002;\007\362\013\310\275\370\343"
+	.string	"\226\027\200N\316\r\347\306f\363\251oM\311[c^\232\223\227f\362\316L^\031\312\033Cy\323\222\027\306\274\257\223\027e\336\363\3445M\336\322\344%\037\344\3337~\271\344\275\001Y\224\227\340\233\220\324\212\342x\246R)\223\344x\220\337\370O\275w\277\273C{!\037r\252M\247zd\235\232@\254\322\361\300\330\333\"\022\tSk\221\301\203\354\222Wa\375\210+\304\"aj\255=/\027\301.\311\273\f\034\f\035H\004zf\304rz\355\364\315\354=\263\246\373\307\025\224\224\024#\346Ji\307\343\321\352=s\326\004vZ\3263Y\303\224\234\262<\321\372\202\003\326K{\252\037\205\017J\024\232\353%M[\327\364\357\365\235\031k ),\253\357\314\264c\260N\273\2618\360PX\377\347\002m\\\277\3725\2156\254\310i\312Q\027\354=\363\326;}*9]\371\236\232\270\345\t\224W/\361\314}\221\037\036\016S"
+	.string	"-Zf\343\372l\306\342\333Q\266\331\3175\331e_@\223\235Z\301q<\352\"\342\343\203H&\306\240\377`\n\3502\004\0232\317\365)\205c\212oX\304\307]!EI\312\251\340<\263\326\375\203I\027\250\033a\206\230\2754\254\235\304\013\312\024\237\312\004\347\231\357\363x\221^\024\017\255\001>\377\351 \324\0334x\b\362)\2058\360:\220\031\200\202z3(\b\372\331\240\333\371\350<\370`\350\240\313"
+	.string	"\024\244S`\333\335\217\006 \235\320n\007\244K\213\365Mc\221\214S\234h<\275\344\214W\370\260\272\322W\035"
+	.ascii	"\200^\tD]D\323K\315\363\362\215!\342\343c\300'\0364\231N\357"
+	.ascii	"\251\323\335\277\225\335z\311\363\326\334\363\346\t^u\221\342"
+	.ascii	"\222#\343\212\326,\226S\302\350\344\b\367\\\247\177"
+	.string	"K\306p\232\346s\022u\353\337\311\025+\320]\305\257\272\255\177I^\353gIq1b\256\0135Z\343\232\306\326\264\nEM`N\326Z\253\214LuZ\205\321IW\211\34097\275\345\255q\372\267iM/Y\276\3526Gr\233.\3204+M`\370*\n\t\255X/\255\315\210u\004\026r\250Q,\303\214d\312\320\214\310H\322$\215\001p\002\0312\254\007\020hY\233\264\006\373\2404\2163\025\004'\233q\221j\201}5\n\033-\261\035Vo\007\b\226\247\322)\022\214~8\251)\300\025\311\375<\244a\023\337\006P\252%\316\340\f\210\202\316,\022\200L4\372\2348?\001ZI\334\366\353\232\260\305\267\025r\232y\312\226\214a\323\276\333Uo\217#$\307\327\034\265\"\273\366\"/obL\340*CIOf\201\315!\212\377j\207\227\305B\352\364\"\376\260\334p\226\005u\225@7rQ\316\034f\360\210"
+	.string	"\361fO\364\3249X\034\230% \341\347\302\0240\360\203\215\305n\342K\231"
+	.ascii	"\020\005Q`n\231\037m\007,\032\277\356\202\232\375B3\316\023\315"
+	.ascii	"&\031p\004#$[\333oi\316U\025^\257\263`\232\350\373\003"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.79.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`m+\315\244"
+	.ascii	"\312\376,8D\0208ng\f'R\376\346\213aZ\017\241\216\004\247\261"
+	.ascii	"S\005\247\330d\337#\n\023\035\343\263\260\260\004j\244\203\356"
+	.string	"&\345\016\024\3359(\331\273w9'M\253\257R\225 y\305\2645\".\024n\"\245L)\245g\0034\003\204\003\354\302un\341:\263p\235W\270\316*\\\347\024\357\214\342\235O\270\316XI\347+\327\331*\351\\\365\316TI\347)$g\023I\347\022H\316$28Kep\036\221\301YD\3229D\322\031\304;\177H:G%\235\241\220\234= 9wH:?\271\316NI\347&\327\231\203\353\274\301ufr\2355\270\363\322;+\275s\222;gxg\244\244s\362\235\335w>rg\243w\306\220t\276\340:\023\275\363\320;#\337\371\370\316\355;\263\256\363\372\316\357:{\257pTB\027\264\216\n\276o\224\306B/!\273\346K\377u\267\351F\323m\327-\355\306\353#7r\f~\301\213\234\310\207\274\3134\322\217\230\233\271\323p\007\256i6J\272\315\006Pc\322\227\271\324\234&\216I|\337\263\005"
+	.string	"\211\270U\350?n@.:\243\344\253\323p\017\250`\342\373\276E\275\307\355\307Eh\224PL\351\033\305\210M\216t\007\362\213\373\f\0275\313\315\327}_m\006\fj\211\364E\213a\3277&1\007\262Y\250Vj\233];C\333\2543+\341&\323w\235\327z\\TF\271\276\317\030rP07\360\2401\244J(:@,;e\277d\257\007\206r\\\f\337W:\325,\213x\3571a\374\357\253f\006\360}\337*\006\201l\026\305\n%\274db\302\374\203%w\245L/\361}\245W\257\205\223z\2256c\371\262y\217\365\270\f\3471\036\337\261\224\306\f\0311`\274"
+	.ascii	"\300E\013\026+T\244@q\002\353\312\212\371\252\250\246L\224 !"
+	.ascii	"5BD\b\020\037\242\240<txrj\342\260\201I\303\222RR\006\244\244"
+	.ascii	"{d\204\341B\021\321\020\362\330\262\353\373\222\273\251\207\317"
+	.ascii	"\211\306l\336c\275%O\234\3138i\316s\262\264\3264s\306k(|j\324"
+	.ascii	"\250\254\261Ai\276c\3511\213\006\265g\254&\f\325\bR\212b\202"
+	.ascii	"\263\343\316\030]\006u\321cP\0139\214\225\312\032[\223~\341\264"
+	.ascii	"\326lB\310\001hA\221\372.\032\023\275\005\013?\275\242\260\217"
+	.ascii	"\253H\301\247Q\260\260\307O\254\317$Q\204\256s\246g\215A\250"
+	.ascii	"\314N\003\016:\3261\253\004)\325\276\002\361A[\365X\265\231o"
+	.ascii	"\205\362\353\250:g\324\025\204\265f\024\257\242:fQ\351\2519r"
+	.ascii	"\334\3041+\f]\b\177J\300xB\202\020\334\232\0248-\365\346\017"
+	.ascii	"\316\217H#\302/\216\207\200\003\302\017nM\n\232\376\240B\257"
+	.ascii	"\235\235i\225\270\004\276\241\371(1P_<t\351\260\345\251\217\214"
+	.ascii	"]\257\235\325\265\027\360\234\020\002G\255\235\305a\235Bh\002"
+	.ascii	" \n\034\207\250\223\rL\307,\rsQqg_|I\311\213'\255r\205p\031\220"
+	.ascii	"V\023js\250t\235\2638\253\022\0356>\035w\306\305\223C\201\344"
+	.ascii	"\006\377\254I\211\323.\235\230\250\t]\336\266\270\265G(\"D\207"
+	.ascii	"\216\314\214\301\022g5\212\302\240\006\365\013-\316\300\025\211"
+	.ascii	"@\024B\232\017\035\263\n\311\365\375Y\223\242\326\310+G#\264"
+	.ascii	"\262\270\263\247\267u\316\324V(7C#s\326e\203\322\3531K\257\265"
+	.ascii	"\330\350\376\234hT\372\231\020\2415{\355l\332\272\357\373&\255"
+	.ascii	"5\235\253\037\263\336\367ew\242Ii&\240\231Y-\314\274\204y\004"
+	.ascii	"\213m\226tTnl\332y\364\356\267\201d\207j\226tH\300\243o0i\210"
+	.ascii	"Q\273\027\202\332\220\330tXk\364N\345~aH4F\337ji\201\024\327"
+	.ascii	"|\351\357\363\243&\211\341\231\227Q"
+	.string	"?\263\244\033\341\366\276/\013\366>7\263\254#\262$\263$\3236\313\":\017/<\006\017{\256g\343\206\267\363\302\267R?u\204K\236\311\356\245\211\210\341\366\242%\315\275c\307\033z\332\261\223A>\241c\037st\316\261G[\271\026P`O\201\225\363\023\307~\302\312\007\f\373\233\\\325\004v7;r\323\36598#;[\023\211;\342\302\376\366uZ\330\335\270\020\351\375\024\205z\026\366\266\356\247\266Yf\02698\206\276\306H\267\367\354\225\276%Xg\364\021\270\210\376E\032\037\243\207\342a:ve\030\206\322\304\256<\207\254\\p*w\326\276@\\\212\220\377x\244(\317\242 \277\235Bt\374.t'E\334\351\037\034\177\355\3633\24553\234\033\3726g\"\226f\007\211M\215\033\262\375\347\342M!\316\364\267\375F\034\201\3113\373\202\025B\303\343\267\361T\263\337qN\336{\275\210\003\371\276d\3554"
+	.ascii	"I\026D\252\331\336\353\026| \337w\254\235\2048\307\016o'\373"
+	.ascii	"\017X\330H\310\344\231\203\270\220\244\r\3161}\271#l\277m\375"
+	.ascii	"^\313\323\263\304\t1\342\372\021\244Q\025\237a-3s\320\207aJ\325"
+	.ascii	"\367}]p\033\366\037\004\270\2734\313\026\370\360\3216\333\301"
+	.ascii	"-\220\377\177\2271\026\372\003I\243F\237\204\335}\205\210\354"
+	.ascii	"\267qK\201:\357V>B\232\346<\253\275g\310\002i\202\211\334\312"
+	.ascii	"\226\033O\347Qrwa\257\037\336\316\037m\263@\322\004\347\002\215"
+	.ascii	"y\243\006q\b\231\276\2105\330\224>\333\241\242\303]\207\013\233"
+	.ascii	"\246&\344\304\364 \027\"C\310y\001\363\276o\2119O\f\035\326\302"
+	.ascii	"\341\216\303\205On\336\020uX\333l\367\b/]\0270\202\314\\\210"
+	.ascii	"|_f\253qaT\326k\247\316i\370\216\360\226h\266\235<\211B8\204"
+	.ascii	"e\316\310,m\372\2671w\343\025\202\362\362gav\347&L:\367`\377"
+	.ascii	"57\225\235{\332h\232\033\357NJ\306\256\355\232\373J\3435\367"
+	.ascii	"\263\245\315m\245\307t\267\0233\327\271\235c\253s3\373\3552\315"
+	.ascii	"K\327Y\314uV\342:'y\3470\327\331\003\327\271\203$g\016\220\234"
+	.ascii	"\225H\316H\220\234\301\\\347#I\347\257\244\263\021\327y\203\244"
+	.ascii	"s\221\2443\021\327Y\203\244\263W\3229\003\327yH\322\031\203\244"
+	.ascii	"\263\020\327\371\202\244\263\005I\347\n\220\234\273\220\234)"
+	.ascii	"H:s%\235\203$\235\267\330y\002"
+	.string	"$g\t\220\234#@r\206\340\235\037p\235\035x\347\006\336\231\001\327y\001\327Y\201\2443\220\244\363\217$\347\004\\g\037\256s\017\327\031\001w\346\341:\357xg\035\357\234\303u>\340\235\rx\347\002\334\031\207\353L\200\353\254\345:\017\340:\337p\235\005H:\333H:\007\340:\327x\347\254w\246\221t\236\341:\313H:\307xg\030\357\374\302\365,\355\260\026\307\033\331\255e+\031\216o\277\256B\353C\250V\267\346\304\267q\nBW=\370\177F+\311\214\377\211\345\013\026\341\343\255caK\325\225\371~\316\303?\346$\322o\fC.>\343\262\354\203\245\231Y\333l\023\276\224\2365\215\215\215\215\r\3266\365{\360\033\260\247\246\bj\346\331\313\003hG\302\225;\337\227\263\272\253\026\353\350X}\033\267\326g!`\217\"\001\337\003*\030}\276\351\356\023\004\247J\353\007Q\365S;\300k}\227\201\020H\310"
+	.string	"_\004\032\030\205\252Bg\t\325a\327\031\264\215kf\255n\212N\267\223g\231|\032\337\020\372w\343\013\005\370\033\317G\200O"
+	.ascii	"\232F\321I\2703a\343\3674X\033\300\333\340\307\363y\300\236,"
+	.ascii	"\243Di\233\r\340{\016\212&\372<"
+	.ascii	"S\302\216\362j\005\264eZ!\350\336\\\240\032b\214OGYU%\234\262"
+	.ascii	"L\233\3615\376\030X\306H\343\263h|\333\207:\235\361GBAV\322\364"
+	.ascii	"\367\t\232BBF\034\245\225\033\234*\313\264\030/\343\217SA71\376"
+	.ascii	"X\005\004\250\311\263Q"
+	.string	"VU_\315\257YZY^Y\246\245\265\315\312\330\362\264\352\027\017\243\237\377\342\233\330\376\370\312\030\307\320\364\327\234f.\206\221\372\3437C\367\301\373\261\227E\013_\005f\230h\037\303WzeD+\333~\376\221\231\347-\217\352\206\355\342\373\312\257zdj-~}\027\337d`\232}\235\342[\274\206f\032>+\317\342\373\371\217\270\266\262]\361,\272\261\225\255\212_\361\275\247\342{N\004?\212O\262N\361m\345W?25\024\237\342\255\364\211G\361\354\"\031c\022\252?\361Ky~\203\310\324\232\336(\302\325z\375#\023\217\237\274\351\307u\373\"\207\300\372<\350\325c\375\2728u'\275z\266\017\020\\\n\375}\200\240 \254\276n\353G\325[\321\211\251z\226\020\320\2250\375Ee-C\004\374 \307\376\226\006\005v\2673\177\302\352\214\274>\325\027\261\2510\250\214qK\013\0375\205\345\341\300\274\t^\246"
+	.string	"\241\375\2012A\302s\331R\342M|;\325RB\211o\r\017\247Q\344x \301\366lkRO\342\331\351\261:\342\245~\303\"\231\230\346\263yN+\342G<\023b\210\027\241\006\r\361l\342\241\340?\t\354"
+	.string	"\242\355C"
+	.ascii	"\373+\201\316Co\016l{\357A\370* \324\274Y\033\261c\227S\\\341"
+	.ascii	"I\n;^t\356\317\330\311D\275<\024\3661Q.\357\204\275-\212\245"
+	.ascii	"-\241\275\357\220\316\235>h\371\017\276I\253\027\365\037\210"
+	.ascii	"\032\254\205\372\250\337\340G\026\327|&\277\004\352[\300\303"
+	.ascii	"\023\244pM\036\266<s\371\366/\333\351\345[\333\341=|\223\305"
+	.ascii	"=}\207g\003\251\026\013==Kx\b\255K\343\340\344\305\025\225#\022"
+	.ascii	"\233\336\351\331;e\214$|\252{\317\005!.\341\226'x;\233\2365<"
+	.ascii	"\264B\310DL\177\337"
+	.string	"a\225\r\034\016{\261\225\355\206\347\360]\366\364\263\341\233\032\34101}\037\327\322\032\236\351\273\214J\323\033YX\242\360C\303\267\2304F\305'\273a\343\247\341\333\260:\254]\242V\363,1\312\rZR\372;v\222^\351\333i\035:I\205\024\225\004;\254\315@\235f(\024\r3\230\204$\347r\226t#\342\260\213\311Gz#\230\374\266\317\217\03488\031\334\017\f\304\207\026\017\0339z\360\320\241\325r\r--\036Zm\227\227\220#\022\024\361\352:2\344\005\3665\204\253\353\002.\244\2206`G\227\327\226\221\n\216^`:\220\034P\200\343H\327\020\256-\036H\276\212\274\266\214l\3618\262\345\003\311\027\021W3\227\325W\021\013\256\210\b\271\322@\310\226\327\025\227\221\257+\253$&R\244\313\310\325\021\"D\214\\\025\215\365ga^k,\177\355j\367\373f\323\207\032\373&\367\373=\375cS\017\337\330"
+	.ascii	"bl\323\354\225\274\330\227\201\320\364\3066{v\226\251\344\213"
+	.ascii	"\250\361E\2377\222\350i\354J\362=\324\366\004p\322d]\f\323P-"
+	.ascii	"$b\213\b\035|\230\007+\241!\035\274\007\177\224W\315\3036\276"
+	.ascii	"\215\215Z\331v0\0354\244\203/\242\246\347\246[\257\223}\204\252"
+	.ascii	"\020\006\340\327\215\205O\2161\313\311\332h\017\020\325\252\253"
+	.ascii	"\275|\263\0251Q\255\314\\\215o\313\242\001\305\220\2035\016\324"
+	.ascii	"u\032\342\321\330`}\3375\032\206x\336n:P\354\017\351d"
+	.string	"\026S#\306\306\333\311_\0354\250\f$B\362Jgl\260G\022\344\301^C\036uP\031\343\021\301\257?\362\354\242\221\377z&\304 o\304\317\006p\212\374\006\317.\022\371\"\253\235\016\362D\336\303\n\324<\032\310\361z\r2x\257\337\240G\266F\306\022i\203\265A>\203\301!S\f~\310\263S!\217\001\2479\023\362\035V\240\n^0\330\201J)7\347\241\005\177\301\263\025\274\005\317t\207lM\223\260\267\276\202\367\300F\375#\023\323E\247\003\227oRn\354\235#@\n\276\213\353)x\246i\031#X\273\365\\\337\201-A\223\312G\266\346\251\312\334\214 \377\214m\353 5\3107\032=vo\340\346d|\333\332\354\255\367=\353\03409[\317bK\307X\266\023|\027\352pf\261;by\274\235\023\374W\007\325\0216\237\311\022\350Y\005\335\364!am\303F\202\3579\320>\212\021\260\260\252Y\276y"
+	.string	"d[\323,\337\374\"\350\023\265;tJ\001\312'\221\204\366\352 8\030\020\364Y\315,\337\372\374\266\254{\3137=\b\276\333@\361<\340g\315\303\273C\324\262\222\261{\340\233\n\305\343\300\237u\214\222n\352e\215*\347\034\370~\003\275\243\330"
+	.string	"\2405\005\024\302\310\255qp\r\334\2112\360\314b\210\353\227%\235T\225\305\006\255&\210)\212\2506\313k\227\325\213X\013b\213b\215b\215w\234+\227%\035r\335\302\300w\034\250\035E\273\006S\307\360\205sh\317\002\337\316g_KX\340[\rj'\372\034\313\243\241\343\240X\032\t!\247\2437\b\300\272\306\356F\367f\035\201\275\255\016\314\267\240"
+	.string	"T\201o"
+	.string	"J\215>\201|\332W\373\307\003Y\257\2001\227Q~|?\241\323\250\025\00417aK\325.\334\n\264\315JU\003\215\255SV*\n4\227L\230\264\315&\360\r@\247\321'2\213\0325\027,Z\372\235\207O\016\312\212\276\373\036{3\274\367\361\035\267\242\371\370$\3209\212\317\261\306\373\367C\266"
+	.string	"le\333\343[\332\343\247\356\264,\276\315L+[\004\276\357\336i\221\307#\360$\372\260+\276\215=E\333\275\243h2\337\3147[\2334\217\252\365\211\023\036\337\201\364\254*v|\333\351\370\035<r\274\216w\322\313\361Mw<\305\267\231\351\003\276\311\030\360\007\274\323b\031\343X\001o"
+	.string	"\216/\340\231\3724\212o\013\203\254\250\362X1\013B\311\020\311\214\210$I\ni\r\262\013\020\b\002I\232Jx\036\022`T5\006\244N\251\032!I\222\026\003"
+	.string	"\004P\035)\204\266\332\3343\316\207\317\3442\342>\006-Q\210\270\025\350\365wD\237"
+	.string	"\313y\376\247\006\351\371\034\177\267v\024dF\243\276\222B{KV\276\220\241\021xe\231\354\3070\001$\275\322N\220\272)\242\375\202\305\267b2&\273q\005Q\006\371\2061\001j\225w\336\303\332\2648\333\251i\n\001\312\027O\025P,1\004\361&pua\343\005u\350\224\255>\262\346\031}W\336^\032N\017\276\350.\242\321@\201\013~;/:\216\331\322\276)\3630\315\345\013\205\023*&\033\237'*\300\322\346\035\001"
+	.string	"\372!\201\361\242\b\300\215y\271\201z\\\247\030\323z\360@\022\241\270\261^ \344\332\357\356\250b^\346\031z!*Q\237e\307\322\263\371\240F'\027y\233\035\275Wrz\341\0336GP\203\227\213\0229\b\305\031@\244\205\030\210\251\260\355H\220~\247\311M\240J\354/\301(\351\177\355\177\327Ul\303\225\250\340\261\224\035\325\334:\302\226\007\200\243\210@\210\350%\020\265$\262-t%r\035\2774\242\322\250\210t?\377\365'\023c-t\273\201\021F\254\326\255\317A\322\216\327\264\256>\277B\263\225\007\3038\227\277\250\310\370@\325\336\027mh#\260\374\233\274\024"
+	.ascii	"\200\341\204\302\307\255"
+	.string	"bO\376%%\303/Q\244_\362P\333\367J\353\227\034\217\274\356\364y\006\311\206\373\326\242\241M\235\016\371\267?\246\343\0039;-,\337\334\350W\t\244\253v\316\246\250\275(\022\330,\021w\204\332(\031h\017H\001$)3B04\222D\274\205t\265\221i\244\344\346\260\200\232\277\311\303~\235e\333\r\3667\313q\017\210(\322\201\252\252\214\360\231_\023n\327\371\316[6\335v\223\020\202\016\320\320\255\207\244\300\300\224;\244\036\037\tKRUDm-\244\234@E`\356\257\206\335\216\302\361\241g{`\200\375\026\275\321C\nks(\r\331\354\307[H\216X\036\032\243l\204f\334\317\253\254\227\271\255t\232$.\366]"
+	.ascii	"\r\264N\303\325Bm\314\243pN\2254\220}$\0024\001\374Y\016C\250"
+	.string	"\326k~\212\354f\220\334\t\253\260\205\350\016\256\370#\223\257c\302B\f\226\033):\361~\327\215\017\363\372\224\265ws_!\027\n\331\310\3710`D\236\340\242\316\360\276`\2511\021K\204\315y\3010\361\334\376\213\312++\2141y\2012\204D\215N{nNn\311n\t\237\371\344\231\236Jw\342A7bQ\257\234\327\241\206\351\026\224\027\331\036\300g[DC~\310\263\244Hq5\2540\016^\302\227\263\"\2053\231c\226n\207\035\347\324\336\302\001\277\004O\233\022NblD\031\263q\216\r\205\036/\0238\356\301\240\243\366\031\005V\305\237\212y\205 c\337\205\240{\345\002\273)i\356}\203\332\233Dr'\032+S\203\267\027\"\356s=\340Gj\017\277\257\363\2437;'\303\t\234\377\267l\321;fb8\220~l\323\236\f\0313\031\013?\\}F\0138\265\226\334\2511H\212\250\231\250D\200\267\226"
+	.ascii	"\225\271\314_\317\343E\\|\323I\207\206\277J0\\\303\324a\240\b"
+	.ascii	"^8V\301\373\007\370t\2058\030\304J\302\267\376AW\037s\2360\207"
+	.ascii	"\276\016\3666~\340Ql+\003p\214\244CT\020\"\006\352\343?\234\275"
+	.ascii	"\3253\001\227\255`1\272\240\006\264\246\344\235y\330\337V\035"
+	.ascii	"\ra\264\235\220\246\271\330\316U\326\316)\303\374\031\374i\224"
+	.ascii	"\273&J(F\323\265\034\324R\036~\2618@\211H\264I\346aL?\270\205"
+	.ascii	"\342G\261&q,f\340R\314\300\257(\355\027\360\023\325NI\302X\260"
+	.ascii	"j\235\002s\264\005MS\262n\013\342\222\272\3745\376\233e\031d"
+	.ascii	"\324\254k\314\254Z{@M\222'\t~\036Z$\227+o\253-G\254\214\034P"
+	.ascii	"j\244\222\304\025\351\220\352|\373\003\rW\355QfJ\366\315s\036"
+	.ascii	"p\361\204\376\275i\374\026=\024x\t\242kJ~1H\2525\030\236\350"
+	.ascii	"\235\303\2321\002n\237\233\311X\021'\370,a\007\330`\031j\201"
+	.ascii	"\351\006\367\222\206\276\027\020\3702 N\007n}\324\360y\035Q\342"
+	.ascii	"\206\242\217\372E\343\302\2571\262\341\313\222\350\002)\031c"
+	.ascii	"\206V\365\346~\001\033 \207\265\326*[\037\203y\222<"
+	.string	"\317\327\305#S\003\315\305\237\351\357\222\031\375\002bI?\037\271\356O\351s\345>\354\017#\242\357X\3302\306\222G\017\345>\344\365%\\\243\353\003\230\311\267v\201G\226{\202\222\021\345\374\031\230\274X1\332\030\255\231v\215F\306\ft\264w7\2417\3568\315\311\352:`\353\260E\300\305\212}\200^gyp\202\305\036\030\335{u]\021\320\3023\035\267U\266\365r\273\234\300z~\237\372\343\374/\3577\234[\301\206\274DqN,\315\327*\341i\031\204\337\362\230\025|oZ\372wO\341m\240TX\326\r\fm\3513\222\254]\006\271\272\344Q\275\307I\270\304HA\322\2554&\360\344u\306\037\236\201\322\305\351I\305q\003\341\200\215P\333\353\342-&\3640==\210ha\203re\315\322\276\310_\b\013^!\364\270\312\303W\246`X\223\2771\b\202\253\230\001\215Q\"a\232\244\n2\314\273\255\2225"
+	.string	"\007a\033\202\265}\200\322\270\377\247\030#Q\246\321\334d*V\345(\241\020\216N*7\3757\360\024\356=\260\314p\371\334\247u\367#?\366\017\237f\271\236\276\007\020\371\223\310\360O\276v\325Z,\213\3463\337-\033E\037D\251X\225\302N}\3145\007SP\333\"\215\360LR[\027\254\244c&\035\021\342\364W6\034\226\032\002\262\301\017;\257\023:(g\374@_N\352%\262\303\260cdn\305p\334P\202\350\274m\315zQU\036\f\025*\221\001\336"
+	.string	"T\247\245\210\007-:\255\003\345\343\350Jt\346\217\356\nM\023\215\3361v\213\357\027\234\017\031t2g\026\230\230\273^I\"\243\021\215\305\024:\306\347\270\n\0303'\332\325\204\f"
+	.ascii	".8M\203\031\232\271e\206kF\006\242\274\003\177\250\016\321\002"
+	.text
+	.section	.gnu.lto__update_checksum.95.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\344\001\215\020"
+	.string	"\246^lF"
+	.string	"\257(\035\204\b\325\\%\304\316I\265\372N\341\365gD\214A]$\244Rdy\030\035Na/@\366Q\204_\335\311Z\341\356\034\211\2137\226\376_\347\325\007A\217\\\031\302\317\t\037\376j\003\355\023\262\267\224)\005V"
+	.string	"W"
+	.string	"W"
+	.string	"7\260]z^`\273\264\312Vq\020fn\210\270\231@k1\347\354\366\202\037>\202wT\325e\\U\371\b\274\025\256\017\3452r,\030\206"
+	.string	"\037+z\354\350\330\234v}}+\215\032X\276\247\335A\216Ws},W\256\301\234\323\352\372V\356\355\266K\266E\266\212\002\007"
+	.ascii	":\370c|\366\177\016\336\334g\367\026\3252\252cToTkT\237\200\006"
+	.ascii	"\207\230\225S\b\347\204\205.&\216\264\311\220a\323\2446\006L"
+	.ascii	"\225\231\n\0352.\024\254\332\fD\252\203(\357\234\261"
+	.string	"\233\004W\373\035\356A\365Y\352\2419_>\204\230\023\\\340\003\236K\203\001\261U\234s\316\2702\333\035\3376\264\234\314;\321\332\260\322\320\022$\356\256\004Ay\342Jo\304\253e\027\204\342.\026\272\337\335\277h\305V']%\361Z\b\312\023\343\247\266\313\357&\363@\274ZR4\334Z\t\326\267+\263A\024\365\200\331\321\361\276\330\241\323\374\002.\363\017>HHq\364AB\212%\221\b;:\031\205D\2238LJ t\246\221\25642\222\320\221N&\035\207\206M%\"\247\356\304d:u\031\340\374\276\370c\301\004N\312\256\344\312\f\253q\361\026\204\261\334\276N\373\275\032\227\331\206\326Q?\273\355\313\247\231\024*\272\343\207Gm\334\202\226\313\361j\255* p\202\231\224\333b\340\225#A[3Q\221\243`\024\003C\214\273\r\030\351\263.\235\346\363`\333\240\013\347\005\217o\230\255;\030\2363\340\324\006\263"
+	.ascii	"7:\"\312\035\243\371\2256p\255\r\216\035\003\263a\006\246\224"
+	.ascii	"\035|\f\343\006\340\210\200D\t\367\022Y\310\023\224\335\f\242"
+	.ascii	"l\272\350\023"
+	.text
+	.section	.gnu.lto_UBLOX_parse_gps.96.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`x\024]W"
+	.ascii	"\252\214\020\037Q@P\322\032\003C\257\222\"\362\337\304\231\301"
+	.ascii	"\251R[\243\371\324>\264\310\261b\256\346O\006\2038\343\276Y\333"
+	.ascii	"\237M,_MDP\007\222\016\354\004\375\211uD\235;\232\355\215\335"
+	.ascii	"\007J\366y$4\"\016-S\026e\321\316\204\252\252\"[\023IRJ)\312"
+	.ascii	"\001\313\001\343\0010\316$\202\316EAg\"\326y\210u\036\021t\026"
+	.ascii	"\021t\016!t\026\n:\007\005\235\201\200\316\303\325\371\207\235"
+	.ascii	"}~\316=\2533\317\352\274\263:\353\260s\316\352\214\263:\337\254"
+	.ascii	"\3166\253s\r;\323\254\3163\253\263\314\352\034\263:\303\254\316"
+	.ascii	"\302\3259\310\316@\326\371\307:\263\254\363\312:\373\032\332"
+	.ascii	"\374\253\263\373\234{\003\023dcY\310\326\250\037\027u\251\366"
+	.ascii	"\276\270n\353\023\"=\326\rmgn\346\216r\223\301"
+	.string	"\320b8zl\004\237{\025u\255`\336zH\301\360\\wI\004\354\225\243\300f\306\301\035\3060\334`\315\004GC\235\332\265r;\007\336Z\236\235\353F\217z\345\021\300^\205\032\207\355\325\327\037\330^9\005\013\034\334\356D\035u@\261\206\227,\303s\335(\361\205pM\373\242\315=\336v\020\320\360\307\247\207gG'\007\007\304\207\033\233\032\232\031\231\030\030a\020\370cW\337{\313}\354\240\337\333\3264\254\201f\252\220P\037\"\231\370O\004sF||\277(*\027\032\313r\211o)\317\356\311\323{\202X)i\036%\275\343l\035'\021\317!\312\212\202=q@\370TD\341\371h,K0_L^RK\177-\275\374\003\013~3\244m\206\274^\323l\232\255\246\317l}-\265\\&\006,\004\226\245\017\207\t\301e\325\243\205>\023Zm)\340\\\001\302\245\277\226=<\210e\311\303'\364\265\304r\340\217"
+	.ascii	"\004\230X6\200Q\271\254\300\372\267\243Ya\325\216^g\252\244|"
+	.ascii	"B\256\353vX\373TU\224\373<\254\337\205\026\262\232ky\005\305"
+	.ascii	"\n\331\206\260\t\253\220\254\377\bp]\227]Ye\325,\324\314N\001"
+	.ascii	"3'1\337\300\005\337*\274jP\322\360\246P\332\317\216D\251\300"
+	.ascii	"gv\313rW]\331\036i\237\027\274h\316_L\216\"\013\3631\337\311"
+	.ascii	"+\244\357q\024\314\0339\301b\205\217l\345\335Z\007_\370\235L"
+	.ascii	"\001\351{~,\"\231\021\374\246\327\354\371\223\002\023\347\332"
+	.ascii	"\262\300o\032\333\002\345y\314]m\275\266M\322>\333\347\273x\233"
+	.ascii	"P\257~K\272\207<*\233\362N\330\314\306\262\377\373\037\232\224"
+	.ascii	"\022d\313\244y\210q\242\213\f\242)\373\375\302\333\344\271>s"
+	.ascii	"\033\326w:\330\025\320ts\\V*\324\367\314\006\364\226\0308\322"
+	.ascii	"\003Z.\001\232\270\226.\320\200\003\336J\007\330^\277Ly\307\020"
+	.ascii	"\364[\f\244&s\004\255E\306P\013,\235e\002n\257^\271\002\013,"
+	.ascii	"\370.\362\226=\2414\304\204\360\2229\247MCwX3\260e\207g"
+	.string	"w\364\352R3\317\316\367\314\264f\002\216^\345n\347\222\262B\362\317\244\302]\005EV\f`\316\033\270q\2709\223\302m\003\333?\\(C\212\324\300\315\366Xn`N\367\307\032\367\023\246\003z\017\331^;j\245\302\003s2\267\032\2539\265|\270\356\261\265\230\316\225\256\221P\322\365\230\333I\243\0251\2301\203\355\325\277\304\036V\210\246\301r\313@\002\r\227zq\213\300\366\252#\235v\2236\023\201\333\213kh\340\255\354\225[\203\177bf\247\305\344\352\311\367\230\243G\177&s\373Z\227+^\374]\314\253\263\004\253\263\214\007Vg\005\330\031\006\353\314\304:\277hh\263\013v\016\200\235\227\204\316JB\347\026Bg\026\253\363\212\325Y\305\352\234bu\006`uF\261:\023\177\316I\254\363\t\326\031\351\347|$t6\361s6\022:\227\b\355q\310\206\022pQ\336\246\364+D\207\333\321\2538#\370\\\227k"
+	.string	";1\337c\001\274\313\232\254\215\002*\231\333d[\202\267\222[.H\325\r\352\217L\342{\254\275\252\274\013b%\255\344P\244\203l\321\223x$\242\027\361E?\034z\"\030P\321\021?\364FoRJ\220S\256\026\303\313\232i\355\333_\244h#\336\313^\350\007\275\210\357\251Ji\t}\210\023|\006\247\346r\326\276\255E\006\241o.r\320\037_9\334\3466\026\350\203\276\247L\352k\370@\357\233K\352=Qy\223\266j"
+	.string	"iY\373*5\311\206\337d\275\352\275U\250\274N)\323\003!\3262N\3302&\027\323C\366\347e\300P$6\243\355[$\r\373y\342\373a\257}\276\203\026\316\334\352hwx+}\276\345\202xqC\376\221{\260\034\254\315Z2\327\303\237m\026\tg\373\0065=I\317\267\326\333\306\263\345H\2124\035\347/TW\360\257\"\222\221\366\035*\302\363\375\365J\241\336\354\270\240\363;^:\337\364J\261\2419\352vr\206$m\006\251\231\230\376\305\320\222\344\fa\372\234\032\232\357\272j\234\217\201\003\342\315bW\021\322\276\035%\b\316w\225\231g:\n\255"
+	.ascii	"\234[\365\315+\300\364\256b\221\020\007\322\276\\7\337<\336("
+	.ascii	"jlQ\332(\b\233\233\214\215\226Ku\315\333\370\250\371\246\267"
+	.ascii	"\206\230g\262\013\217\272\315\316\216\320\005\221\372\305O\035"
+	.ascii	"\365\213\1771'{c[h\236\207\263)\357^<\315wR\357\311\367X\230"
+	.ascii	"g\372\222\254$\231\n\277\353\273\310\316|\ftL\016\312\363X\360"
+	.ascii	"\035\305nS\2415\322l:f\276\333\344:8d%\370\016\3536\001\332="
+	.ascii	"de^\202gO^\265\340UE\"iK\304\227\255\021\240\246S\311\00458\260"
+	.ascii	"\001\002\006\036pP\003\204"
+	.string	"\240\215f\032I\037x\240\001\361\206\rb\0076fp@\244\321\364\0011\t\004\337\360\240F\023\021\204\0337\232\2100Q\267\277\213#\32033\003\362)\340\027(ufj\337{\r\003\306\373#\031H\020\221\267\026\372\352\325\303\233\022\353\322\346\200\002x\003X\b\200\243\307#X\303\245\317\340\337\245\177+5,'p_?J/\344\177t\213W\372\226\322B~\3273\235f0\242\241\261\275\266\370^\276<<}\236\311\035\326F7\360<\360\354\333\371w\361S.\236\305\033\260\342Y<\327\212\327\221\353n\237\353\272n\3173\333\211u\361\017\374\007f\226\027\025[Zjk\357\343{<\217\307\372+\025]\236)T(\006Iu@\361\261\261=\nE\001\254\214Y\230\252\214q+\226\306\272\023T)\276\361\336)\025\200\023\212@M\023\244\030\255T\247\274\262\b\243\371%\030\263(I?\2071\216(\375\244\261\016\251\371R"
+	.ascii	"|O\337\351\023\212\342\037\2528\224\362?=\322\210\203\221\212"
+	.ascii	"\321\212\267\322h\245\313\225w\213LR\245\357\031\263(-\275\271"
+	.ascii	"\2361\216\330\254\032\353HH\277\240\250\243\376\233I\211\262"
+	.ascii	"\342\311\361\274\006\241\\B\247\303\355\304\376Oq\357xi\352\005"
+	.ascii	"/\035\336T\347\231E\226\370/\226\266\303X\025\"\017E\271\031"
+	.ascii	"T\224wO\306\034|j\234\363\035\214uw\3049\252\fs\316\266\366\263"
+	.ascii	"%K\252]\216O5w\325\351\214:\264O\n\3368\274i\322\016\316\245"
+	.ascii	"\315\312aNyw\342\223\376\253\234\266D\372\023\2773'\245\004\331"
+	.ascii	"\305\2451\230\244q\355\221E\023\016\351\373\356\215{\036yq-Y"
+	.ascii	"L\374\321\377\033\325\2578%\271\265\307\"+&\276\235/\034\025"
+	.ascii	"j\364\314\306\036\234J\233\325V\342\215\376\313\222zO\306\252"
+	.ascii	"\337\340\204\3244\356"
+	.ascii	"\371\224\201\243\250QD\344\030cHDDD\222$Is\241\005\204\020\006"
+	.ascii	"\231\263z\021\300,\247\230C3S\222$\351\210\307\221tM\271+\354"
+	.ascii	"p\024\347wP\006\262\377\203o(0\321F\310P$\343\2006\265\200\225"
+	.ascii	"\202\031\340DO\360\356\312.\202\003)\213F\2547n\355CC\323#Jw"
+	.ascii	"\0223\003\377H\017(_\030_\314R\fL\264\232\027ENa\204I\266)\254"
+	.ascii	"\345:\304\200\013\362\\\304)C\r\035P\347P"
+	.string	"aE\200\237\271\256\337\240\224Q*\034\222\216\271\333\222\356p^5A\3703)\211\275\306\320#l0]\312+R\212\330%\321\350p\253\221\023v'\223\251\264\313p\245\356%\274>\030-\261x\337iI_\211\001G\037\332GQ\357\016\256\341\232\f\261Mg\307\212Y\016$\3248\027G6\020\347\310\230\023_0\200\266\275\263JL!\213~\036\376\2068%/2\345\245\253\266\212\227|t\277\270s\337\021\234\f\335\206\213\025\r\372\360\362\362{\277.\230\\\347\370\022\024\017\204`7\320\306\367GF\341@\331W\03724\253\205ekC\302\307k+I\001\202\332\221\375\376\354\336\340\260\375y#\216L\026u-\260\216gT\034}6\241\237\212\360\223\373\247\276rA0;\202;\024\335\237\024\013o\314B\361\005F\212`\223>\213\f\375\217tX\356\365c9\200^\215\255k\363\255@\302\305\036\251\242\001\327#\365\372\256"
+	.string	"\217Fh\243\303\016v\013\337WQ\271nT\323M\245\213/\260"
+	.ascii	"\251\234\340\226]\343B\202t\021\210"
+	.string	"\300\230\204\344j\316bj\254\275S-\232\nH\246\277%T\b\274\324\204\"Z%\3160\243\030v\273\373_v\264\004\350i\261\244P\322M\\\"H\251\313W\317J/\236\332\316\n\264\275\255\202\361k\016\240_\273\nD\353\256\304\333\\\206\241\003\305\324\346\217\225\310n\344\2700p\222T_!!Y\335\360\266\263\253\341\002Y\323\274\332\005\370\0330\246a\026/\317A\265\032\216\200\271;\306j\314e\177\371\247\016\221\365\257`\027 \204\340\306\303\310\351e*p%#\372fP\nfW\367u,\272axo\326m@\263\f<\216&\243\270\251\027\3362\333\200E\234\371\326\321\2054I\235~\347m\203\363\222JuX\362\022\377N\316\204]1\234\027\367\252\025a\311\337A+o\026\217\317nk\005\227\362\035\346\225\031\260s*M>6\300Y\365^8\303ag\003M\"T\330\030\373\341\376\212$A\235}RR\b\357"
+	.ascii	"\006~\0370>\002M\334\021L\350(\3147\375^\001\031<l\365\376<v"
+	.ascii	"\245\030m\257\322\253\276}P\323\202\024TC\311\\<\030TuC\206\224"
+	.ascii	"\343\317\224\261\251\276DZ\276\342\206?\345\201\203\264\331\271"
+	.ascii	"0Rv\2406\202\030P\337\201\367\240\245\370\031 \316K Z\205=\202"
+	.ascii	"\016P\330\f:\264e\030\264]pj\371\346%\277\364\026v<Tcn\303\250"
+	.ascii	"s\237\325\202n5@\200\364L\351\022\357\017"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.97.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`F\020\225C"
+	.string	"\312k\f\030B@\"V\007kx\3335\376\222\310`\346\324dr8\221\215\250\013\301\203\375k\022\312\243P\233\327\225\351Z\375\314\213\300 \003,\\m\277\2507\035\220\311\350\374^\034nb$\312\376\006\341n\332V\312\224\002m\001M\001~\001h\330^\356\277\372\331\375\375\343^\316\177\316\207_v\330x\253k4xR'5\216c\033\376_|\370\257\177\227\367b\343\257_Tc\326\230\t\241\n&\013\376\227\352\215\373_\340+\355\177\337}\207?\234\017\335\275\212\244\n\263\306C\366S\355\016\365\300\277~\245\363S\301\\\307\261\263\316L\034[\021x"
+	.ascii	"\370_\005\rv8\362H\026\326'\301\335\217\2628\2778\266f\351(^"
+	.ascii	"|\240\365\375\230\221/\025\005\365\344\324tdZ2\026\225\222\220"
+	.ascii	"\216\214\210EDC\341\020\034\334/Pg\244\377\203(6\251\r\303\f"
+	.ascii	"{\251j\216\232\016\202\002\032\207\254)?o\371\0064\300w\006\320"
+	.ascii	"\267-\251\371):&\351\304eKn\002j2?\264\317[N\201\020\004\225"
+	.ascii	"\321\3719\266|\204b\346\366L\301\tso\240\272\206\312M3s\373%"
+	.ascii	"#\221\231\234\222\213J\321\234\004}$\250\224|dDd&\341\276\252"
+	.ascii	"m\271$\023\253\322\314\234_\224\267t\002\251\3428\376\266\245"
+	.ascii	"\222L$u3\364#|\243b\206\202O\250\026\326\202\332]\265a\230D>"
+	.ascii	"\230\267l\226\345M\344_\240\001'^\021\"3\t4\312q\262\367p\237"
+	.ascii	"\1770\31120W_\257I\325\320\316\222|\332\022I"
+	.string	"\217\261\275\255 \251\0232\223\302\034\234\020\307\261g%\323\354}\352\335\263\227\273'p'\236\005\237\007\271\242E\213\375\257\016h\235[\237X\356\302O\3168_,\017\266\261\364+f\247\275\352\215eA\376u\377p\237!M\354\307\027\226\377\216l]\262@\375\024\363>!,\377\371\377o\245K?\332\216\277\026v\263R\335\346\370\323\tr\263\376r\366\232\225\352\366\306\037\316;\246\215\277\033 \034\326\177\215\336b\347\177\227\237I|7\205\312\031\1774\377d\257\024>\252[\314\204\214\177\031\337\003\307q\330;\375\243\366\277U\023b:wM\276\037\343\356{\376\235\276'+\343\002\300\370,\027r\177\272\017\003\346/u\027]\371\225\377\372wi-;\252\363\255)\226\273\356\326d\326O\367\177?n\230S\327O\334\205\331\267\340\354 ^\356\375\303S\377\261\276\372~\345\331\t\fe\037\340\331\255\340\354\002\340\354\001\340\354"
+	.ascii	"\340\354UC\331\251v\366)8\273\024\234=jg\207\nf\177\nfw\322\331"
+	.ascii	"\233\202\331\217;;\323\316\276\264\263\033w\366b0\273R0{R0;R"
+	.ascii	"0\373\321\316n\264\263\023w\366\242\235\235(\230}\270\263\013"
+	.ascii	"w\366\241\235\035\336\331\203;\373\336\331\337\235\035\270\263"
+	.ascii	"\353\235\375G\034\300^\347|\271\003\242\265\326xH\227P\234}\003"
+	.ascii	"q\303\270\265@\312\255\322\223v\212s}\322\003\2444\235t\2278"
+	.ascii	"\345\326I\013\237k|\222\3347\344*\330\224\232;\206\374\246\001"
+	.ascii	"J-\216c\007\377z\346\222\251\034\374\245\377z\007\017\036\366"
+	.ascii	"\277\f\364\320\216\272I\033\305\255\305)+\204\204\375\255}\324"
+	.ascii	"\237v}\343v\324_\004\372g\332d\312\262\244\215\232\351\312\222"
+	.ascii	"Q\267\025\265\221JQ\347\200\366q\233q\316d\303\362\337Q0O\331"
+	.ascii	"c\024}?W=\377\255\r\335\372@B\315\236\023\215\250\2379\312\236"
+	.ascii	"\037\321\221,_Q^\363[[I\277bj\346\\\341(\351'I\032I+\245%i\251"
+	.ascii	"\277\332G\032I\177\017B\311#\235D&\355\032-!\352\"m\244\204X"
+	.ascii	"tF\244\213\220\020\351\034P\3554{\204\017\336?]\024\t\321P{."
+	.ascii	"\222\215l\211 Ab\017\265\321S\212-+$4\033\322\260\026.\207`!"
+	.ascii	"A\r\003\t\352\034P:\3347Y)\235c\323\035\3720Q\002"
+	.string	"\n\207\213\266{\240x5P\357\261W\033\365\232@-\366\312\255\326@\375=\234\311\334\315\261\3269\240p\246\3156\205\242q\324\374\021\022B\221\337(\267\202T\334\200\342M\321\260\264\037\327\b(\226\213\206\005\024H\271\3754n\206\364\323\356\373\204q\3208\312-\254\237\016\266\373\244\200\332\035)\371\274\004=\257{\305c\346\237\016\372\226\335\372\351\277\347\004\264\356\252\r\263}\344\366\307\023]\317\242\005\215\031\\26W\r.\026@_\201EC\206\213,\257\256\254\030]\\0\262V\314\240\221\205Ut/\031-fd\325\360\362\232\2215\264\212\275~\342\237\305F\313\312De\265gq\027\244\254\214\376\275\277\272\322D\345\237,\227OL'=\377Y\245\b\024\310\356H6d\225\374J\002\372\327\354\262I\035\226\341\204\235EEh\0034@kE\313L\233\257\234\2311(\375\364\337{\253>+\255\025%\303m\n\320\333"
+	.string	"Z"
+	.string	"\237\314\367e\005\211\005\313\3767\200\306\021\255\3436\237"
+	.ascii	"\350\331\313f\276J\003\300\363\005\353Ui\031\3219nU\302\277\330"
+	.ascii	"\236\355 \253/\212w\3428~\251?\214\375\257\325\235>\261<'\323"
+	.ascii	"\201\201\324\202\234N\367\277TZ+:7m:M\351O\2233\245\037\356\255"
+	.ascii	"\266xW\234oM\372\351\013\0041\201\320:\314R\361\207n.a\003\036"
+	.ascii	"\267\364\232\374\346\305\322\035<]'\347\316CMn\363\002\316k2"
+	.ascii	"\033$\027\344\033\022\016\t\267\377\335\322\004\364\320t\273"
+	.ascii	"\335\356\177\355\017\032\204\376\271?@\004PR+\347Lj\255\231j"
+	.ascii	"\023\246"
+	.string	"\355]\210\350\027\277\276:\377tk\314%)\235\346\013J\r\315\177\355(-\245\365\237S\310e\276`\317u\231L\005\013\027.\354\177\243tP\f\333\347|\253f\265\027\243\003Z\310\b\245?\215\016J\247\200\376q\355\314\261a\225\333<?E\375\364\017\201c\250qL\307\030\242\021\021\021)H\222\2445\361\005\204\030\306\334\325\003\021\3408\306\034\232\271I\n\351\320\003a\311S\030~\314t\254~:\331\215\177\310\313\0349\332\271\327^h\004Vca\371\347:\177\nh\334\311\343\232\354\366\027\320\001\3202\322\330a\311\357#\0056mo\3128\213a\320\221w\245r\370\031\001\313\227\017@\362\344YZ\270\307J\b\036[d\262\324\373\2532\020SV\373\303\256EOrB\355\235\360Cw\222J\030\325\204\200o\236\031\203\360_\273C\312U\244\337\311\337D\201Z\277<m\247\270\r\361\365L\362\325\\>\345\214D\260\314"
+	.ascii	"\212\203\037X\006\333\267>1\366a\373\247Wj\3150PZec\304(\320"
+	.ascii	"PN\205i\033[\257\035\317|\0335\342%3\\\006G\376n\224p\356\226"
+	.ascii	"\320lv\220%\321\323\002\211\216\277\022@\210\375VO\207\230P5"
+	.ascii	"u\206\224\216\355d\276\355e\367\376KS\304/\245\005\265\353\256"
+	.ascii	"\020?K1(\201\037)E\333\227\306\034\264\351\254=~x*{\313\035\352"
+	.ascii	"E\356\0209~R4\377 v\036\221\n\304\035\3234\361y.\361\351\246"
+	.ascii	"P\034B\313\b?\363\370\013\270^\322\340\236x?\325}r\262\\,\255"
+	.ascii	"\333\335\006\242Y\3330\216=\254\t\321`\213\350\255\227\221\373"
+	.ascii	"v\273\264n\341\374\255Cn\007]\355'S\313\241\004f4p\323\345\023"
+	.ascii	"2\2537\240\305F#\332z4\037\235V\007\201\272`7\266\377\236\302"
+	.ascii	"\366kz\221\001\210\215\206\351\006l\032\312e\207\020Q\311\023"
+	.ascii	"hF-\025\347~\033\253\233}S\001b\021\316\240\233\007\225\244z"
+	.ascii	"\224\333N\242\"\313"
+	.ascii	"g\3301\261\264\377\250\264P\243\307Qf\266\210\033\342\\Su*\033"
+	.ascii	"\374\"\3165Q\257n\250\\\335P\271\272\301)\273#\026\276{\022P"
+	.ascii	"\t\251\b\003\266\257\217%\277\240\021\305\235\232I\223\316\256"
+	.ascii	"\363\370\213x3:\273\335PO\026\242L\310}\230A\350\333`4\203;\212"
+	.ascii	"\"\204Z5\206V\020\004\n\267j\204I\177\306:\360X\203k\300\270"
+	.ascii	"|Y\242E\035\374!\255l\034/H\177\315 8\260H\021\364\344\356\324"
+	.ascii	"\r\016\002Qr&u\f\312\n\b\017\306\244\336\206ej.\274\206\270\022"
+	.ascii	"\256tx\262\354\221\310!\017#+L\030oCg\327\177"
+	.text
+	.section	.gnu.lto_gpsHandlePassthrough.98.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\305\n"
+	.string	"\266\024K@0m\224\0163\\\021}Cx\234\325\273\247BW\234\253z.\331{\351\235\354Ag\264\227ce\377'\350\325\240\375\246\364\256\323?\207\201\241\032P\007q\021\363\212\244\035\244\220\n\n\364GdK\231R8"
+	.string	"9"
+	.string	"6"
+	.string	"\313\205\204\310 B\251\330\335L)|;\324\334\374k\370E\347q\207\016\256\220\203$\341\303<\020\244\214H\211\036\237\f\274P\246ddw\235\2357\272\257\333\006`\333\303>%\243\233J\3546h\2616u\201\260`\373>\207G\31778\243\002\t\f\273\213\375\262=6\366\353\230\355L\033Dd\373\t\201u7\202\210\017\273\361\303\035\223_\336l\024\033\t\002\032\240\303\211P\256,\311\253\0379\006\362\035\324\307\177\201\002\b\251O\025R\316\251\327\243L&D+>\331\262#(\265d\037\256\222l\230\206?\375\231\351O\362A\nV\226\216E"
+	.string	"\364\245\302\321\020\3104LV"
+	.string	"c\311d\227\r'\253hX\323\f\330d\035M\333dX\374\034\256\222\374]\370T\037\005A\214\364cF\313wV\345\276\232\320\362\240Z\262}\300\002\006\017"
+	.string	"3\241Mh\214\327"
+	.string	"\036{-\r{\005mj\t\361X\207"
+	.ascii	"]\303{4Q\006\025B\245.\213ky*!\247\024j\017"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.99.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`i\001\r\017"
+	.string	"6]gF\360\260(\035\270\377\031\b\335\242\274cg\377\3540\203\260P\327\325\374v\f\261\265\240\243\201\325\307\233_o\255\236\214\272~\312N\373L\001\370\036\203}3\272\007\223>\016\007\227\226\246Q\244\323\274\300B \331D\312\224\002R"
+	.string	"K"
+	.string	"W"
+	.string	"\273\257\0276\273a\002\037\340\036\035>d{\344>`{\364\311\256\361\020\266\005Z\324\260hr\354n\247\037~\272\246y\362?s\017\320\205\272\326r\325\020\340\254\270\361q\255\264\220\026\b\3603\317\r.U&"
+	.string	"\006\273\353\004],w\274\355\006\266\027\330\227\021$L~\214UV\362\340\243\277\262=^\037\300\220u\230\271\244r\307\016Q\251/\366\265\335]\353\313\276\314\357yz\323t\324\264\226i}:\237\376\3471\027-\016,\227\341\330m\355\350\330\233\310\"\366a\373i_\366\331\3512\246\007\b\0364(\312Oq\325\250\004hf1X-\252\303tplT_l\213l\232V(1c\225:\316\213l\252\232j\r\313Ee\321QX\340v\227\304?\221!\205\2131m\217\252\0362\251\3341\221\n\001\206\206\b.=\217\205\270\341\362jc\370\362\240\r\254\024e\177\304\003%\222W\202\022R\361H(\245\357\003\225|\243\220"
+	.string	"\233\214|\243P\347\211\272\013\"PJgB\372\272\021\020{\243\023RW\362<R\367\021\356\265\325\227\035\354\bspR\2522H\372\021\266\207\022&\220\300vS\007=\272\251M\001\304R\224\212M=06r\264OFM\265OB\n\002\031"
+	.ascii	"3\241\221\037C\016\213\20767\320\336\223q\3656\362^\025\304b"
+	.ascii	"\201\355,=v\263\241a\006D\326\304\030\314\241eD0\\Bs75\037M\013"
+	.ascii	"\001\230s\t\266YM\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_GPS_calc_longitude_scaling.101.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\305\n"
+	.string	"\246\026M<0M\225\016\b-\276yE\251\240\243\241\\*\322\034,\206\313\277\267\367\231,\340=\006\332\267\217\236\320-\0020\357lp\207A\206\312Z\224h\037\023u\216BS\006T\202\3306\2212\245;"
+	.string	"9"
+	.string	"="
+	.string	"\276v'p\320\260\273\002\fi<\002\370\203\361h\275\202\361h\316\366p\257\302^\240V\017J\253\335\305\224\302\271'\347\237\364\253\353`\236\023\004v\327\331u<\267\3366\304v\304~\201\037\373\336\035/\372\255Lk\2463\323\277\036!\004\317G\337n\204\260\304\202qC\350\336o\377$;l{\376\276\236M\260\003\212\204jw#\217\016\320x\332\307\360\f\334E\016\002 bF\265\0314\310w\252J\n\211"
+	.string	"7\212\261\277\177PI\330\365\20004mv3\220\324\250Oq.h2\36455S\234\225\245W\n\320\b\305Qe2\264=L*\310\276\265\273k\r\233\201\211f]&\t\324\024\311fA\200e\025lAe\242"
+	.string	"\243h\033&\261pf9\240a\227,\3230\207\267\267\256\037_\241\021`F5V\365K7\371\363-x\363)\337=\372>1\0363D\027\f"
+	.ascii	"3A0\f\202\353\213\"D\026\t\227\307\264\340]\263\273p7\244\250"
+	.ascii	"\301\251+\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceFlownVerticalSpeed.102.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\257\t\2251"
+	.ascii	"\372V\264\022D`\236N\007sD\317~\367\2353\305\222\037\033\030"
+	.ascii	"\225\342q\035\021\342\277\354\037N\327M\352\214C\210\353\031"
+	.ascii	"K\270;~E\272a\307)I\301\306\214cA\302q}\334\306\\)n\273-\317"
+	.ascii	"M\310\356\266\367N)\245\r\001\005\001\035\001Cw\026\272s\320"
+	.ascii	"\235Y\326ye\235\201\254\263\352\316)\353\214\272\363\263\316"
+	.ascii	"\276:\367\203!3\247W\303\325\335k\343\257\316\305K\267\2245["
+	.ascii	"\267[\267Z\003]\365\324U\346fn*\334m\375\306B\267\253\247\035"
+	.ascii	"\031\337\275Y\240\326N\331\2202\362\354\212\360\335\313\005\241"
+	.ascii	"\327\230\205\235vOaa\247\265\224\266\325x\256\257\327\355\030"
+	.ascii	"yv6\370\356\275\b:e\247\265Sb\013\251\235\242\r\244\2723+h\320"
+	.ascii	"6\224\027E-\007\016\212\227{\325\232Xi\355\224[\346\275\"\255"
+	.ascii	"\233d`'c\253m\316\275\267\370D\272\355\036\236\2410\310\256@"
+	.ascii	"5E\337[n \024\313\354Jv\017\017X\017{\264\260\007J|\343\341A"
+	.ascii	"t\211OK\234\026\262\201\204i\306\265\303\331\244UG\003\313p}"
+	.ascii	"m\271\272\364\024%\256uR\031.0a\227\226\243@\250 ^a\375=]Y(\361"
+	.ascii	"\336\333S\332gta\271\003\241\356\275\354\314.\257f\237ff:\314"
+	.ascii	"\\\201\231\225\n\334_\032\f\006ng\247\234A\203\006\265S\340\367"
+	.ascii	"Z\247fN9\264"
+	.string	"4V\273\367\252\337\244k5\2707\327\350\253^:l\370\220\242\037A\357K\351\177\335\3517\271\217\324\342\367\224^\373\372H\365/>\373\326\027\026\227\356\322\301\303\207\017j\247\376G'\026\277/\364\233 Tn\271\316\002\"\204\b\021j\247\315\345\214\233\323W*\267\225\276r\305\355\344\021$Rn\022j\2470\234qM\336(\375\317\357\275\311\377&\277P\021\374+\363\322PQ\223\345t\270\177\351;n\353\216\322\377\330\307\231\243\244\274\231\375_\305\314\007\036\326'\231\325\260\374\233\314\215\336\027cf\235\213C\347\246\2413SC\351F\320j\315KC\347\003\356\254\344\316\006\3349I\350Ltg$\241s\001w>rg#w&\340\316\003\334Y\200;\027\2713\321\352<\264:\013\255\316A\2533P\320\371'\350\034 \350\f \350\354\263:\367\004\235y\202\316\001\315\374yb\326'\031\300\363|\200\3773\3130,\037"
+	.ascii	"=\357\363\275\344k\267\356\371\216\323\373J\340,\327\214f\335"
+	.ascii	"\253T\032>s\013\244\025\2426\223\347\211Z\237d\341\017\037\235"
+	.ascii	"[\362\005\237}\341\3672\211g\271\026\262\252-+S;\r>\004\262\246"
+	.ascii	"+\221\f\236\236l\317\234\374\262\337[\234t~\301\267:-\3417\305"
+	.ascii	"\364\372mv\307\316\372\315\345\244CKc\362\206\353\266\266\354"
+	.ascii	"\215\304\312l\270\366k\3529\310F3&\007\0163\365\033\244\203\276"
+	.ascii	"v\323\222\261h\215\264FT\276#\335\006\331n\317\275\366\254\331"
+	.ascii	"\236l\032\256\327\264eA\317{\225\315dn\225\264\032\344\323\222"
+	.ascii	"\326k\317\030t\372\344\226I\213\346\315\344~k'\313Q\244\316\325"
+	.ascii	"\361I\016~\223}ez\242\0317\366\200M\177\340g\370\364\224z\340"
+	.ascii	"S\345\031!T\306d9\035\224}\322ySM\3674\303\364Dd\276~3J\223\231"
+	.ascii	"j\267\261{\357\023\367]\343\265R&P\240\240v\332\364l\003/\250"
+	.ascii	"\300o'\026:\314\205\365\336\254\247VUF\023\350\321h\342\253\214"
+	.ascii	"'N\0305X\245\220:\036YD\361H\2650\236(a\2642\2460\0069\312\251"
+	.ascii	"J\305T\221\312XLa,\201"
+	.string	"\242\030u\254*:\0051\225\n\251c\321\212\212\352X\024\252)\033\275/\306\354\222\033x\312\307\342\245_\302\301\231\207\366\245\364J\232\r\263\257\fi\364D\322\236\r=\217(\375\321y\347g\200\311\215\024Q\342cD\206\030x\027\316;\264\264\244g\346&\027C\372\214q\367\271\020\237c\366\035q H\244\261\037\355\331\321\230\217\244w\341\034\203^\342s\3139\030\210\020\"\322'\006\265m\335\261\022\373O_\215#\f\203\364\377\354\3137\005\036\351\177\332\254\334\035}\201G\333\266\356\030\375\200?\372\"8K'\004~\351\215t\254 \360]\247\367\005|6\317\251\002~\300\003\355,\315\212\236\350\005\344(\372'\034H\247\033\355\031\223\027Q\352\304)\006-\215\007\311v\205\336\033D\002\337\232\377\361\320\327hf\237\320\007\375\320\3672\fK\350\331/\245\025\247\021\364\035\346\254\363\033\002=\263\357\347\201\376\347\226c\026x"
+	.ascii	"\036-\230\032\200\275\250Q(\007\225S\252FD\202$I\ni\f\200\002"
+	.ascii	"\221)#r\003\021p\245S\210\212h\232}\306b\364\207d#)^u\204\341"
+	.ascii	"\327\342\3631\277\231l\337\302\234=1\200\251\n\366\332\367\372"
+	.ascii	"p\nE\272i%\232'\357\371\033(\022\0200\263\22562@\271\203g\024"
+	.ascii	"\205\373Tf;\326\357\220\tQ\207\245"
+	.string	"ncU\025\265\337\"Q\037,+w\031\275\321\233\3008mET\237\303\261P\240\f\367\223y[N\326\201\212s\237\3273\023\241\351\366\234\3076\356\235\037uV\202\240\300v8V\254\016r\260\254\240\322P\035|\334\305\"\260f\007\245\022\202\255v\214\243\210\277\034\201\206\306Z\017\\ \270\024\307'\367\302\335\240\352\354\355\200V\272v5&\371\314\226vw\251\232\322\346\212\n\"\341\017\303\007\331A\373\275\270#\3418%;df\2568\033iz0\b2\356)\275\332a\241H[\231\023\316\241\301\374nb\360A<M\270\250\006}BA\f'\364\207H\323\267Z\260\351\227\326\222g8\371\332\201\200\007hjZZ\016.xp\323\305rv\022\033x-\333\353\316\021\242 \021:&)\221$\nP\360\241P\243R\373\200U\363\016\313\216\3566\177\274\b\270\327\314\004N\371\357\237S\021\277\223\366\226v\250zt\222#"
+	.string	"J\t}8\326\225a\277\022C\030u"
+	.ascii	"\251\234\304\321?\253\267\246\231\321\264\031\207\033\202\377"
+	.text
+	.section	.gnu.lto_GPS_reset_home_position.103.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\245\003-\030"
+	.string	"\366\253\227G\300\030Q:p\360\335G\005\256o\024]\035]E\311p\3637\025,\200\254h\231t$0\034*\253n\202\336\032~\246\177\260`\250}\003V\205`\231\202#\272\257\313\355\003\204\036@+\340J\205z\241*!d\023)S\n\201"
+	.string	"u"
+	.string	"\215"
+	.ascii	"\026k-\237\017y\221pVfCsN\037\277f\361\362D/\362\371\017\037"
+	.ascii	"\335\300j\223\366]\371\241d\250\301\245q\302\313\233\333|\227"
+	.ascii	"\336O\337\345E\267l.\257\331\230\004\222\214\304\204\204\231"
+	.ascii	"s\242\266\306[\007?\351\255\266|\220\002\200Q\366s\020\306?\217"
+	.ascii	"An\311\027\233\0268FQ\006\244r\205z1Q\006\323\r {y7s\316\013"
+	.ascii	"]Y\310`\252 \2059\247u\224\271\270\303\333\236\266\025\330\253"
+	.ascii	"\013\227\273\021\232\212t\316\371\2636\360\235\366B\017\227n"
+	.ascii	"M0\035\343\337\300\367=\2555\026\364\272\220\033\365\3704\263"
+	.ascii	"T\350\307K_\305\312%\034\217\031Q\220Kwv\355\245K\303\2767w\206"
+	.ascii	"\255\352\223\247\256\271\355\246\361\3243\236ZTu\250jp\325\337"
+	.ascii	"\252\245\252=U\257\252U\325\037\220\323\345V%H\322\221e\252\315"
+	.ascii	"\026;2s\212D\312q\333o\337\007r\233\177\013J@a\304\375\355\236"
+	.ascii	"\356F\231\027\223Q\356s\360%*\032.%\212\322\267\217A\333\322"
+	.ascii	"\243H\256\355\234C\3710@\202\237\364'\0338t\350\200d\324\271"
+	.ascii	"\354\341N>$\300b\020o\022\002\001\226K&r\037\203\306$f\002\216"
+	.ascii	"q\366y\357\371\274U\037\267"
+	.string	"(\"\216\324\023\3169!\370J\276Dg\207\207gQME.\335\375\2659\247\\\032D\25686\234\320-\213\352z\251oWm\022?\222\n\347\204A\360\213\334H\t\237vi\023*\325\027\254\021:+\317;\017X(H\240T)\324\211\224\216\t\324\316\212\205z \300*\024<+T\n\225j\205\022k\256{sg\030\203\214\234\230\234k_>\2409\267+X\320\217^\260\203\b\fW\313G\335\207\034\334p\037{\321\004*p\201\3332#\n\252Y\037w&\037]p\022'\371.\325\313\250+\2404\353\3330d\320\2175\273@r\200\231\002\333\037\373\350]r/\346\364\204\335\316\b6\247\013gfi\366J@:^\272\263\2703\253\001K\250A@\344\bB\212!\212&\2300\n\243\306\300\002\031!#7\021\260%\204\2064j\266\003#h\212\360@\233\261\340:1yss\375\226`\313\\\007\245Ye\227\371"
+	.string	"*\262\2779\220\023\027\231c\344\363\354\314\252\253\351,\377\375%\261\376`d\200 \214n(0\211\00383nBL\027\377\241)\n\213\343G\005\270\\k\260d\354\003\203\030/\320\221Vy\346\237$O\325\310}\346\210\036\244'\0377\216=D\357\314\002"
+	.ascii	"Pr\207Zi\256>\351\005\364\324\301\250_w\333\370\355@\226H\273"
+	.ascii	"\2457z\251\001"
+	.text
+	.section	.gnu.lto_GPS_distance_cm_bearing.104.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\345\003\275\031"
+	.string	"\266\357\244I\300VQ:4{k\312&\306\250\002m9\214s\261\264\n\027\3726\332mO\230\377/\375oO7@\222\265\341s\336\334\214\235\376_Y\301\001h\022Hd!\302@\024;\025h\006r\267\247\316Q\340_\375\366\177#d\313\235R\222"
+	.string	"\177"
+	.string	"\220"
+	.ascii	"=4\276q\034\270\007\271|\315\251\263\310h\210\t\222Z\353\201"
+	.ascii	"\203\316`:\350B\017T\323\342\302\254\321\301G\302\002\r\242\t"
+	.ascii	"2jXZu7c\005\203\336\023\361\323\376\213\303\300\375\247\346)"
+	.ascii	"\265\362\224:j\355!\360\213\351\240{\007\020\0364\335\025\036"
+	.ascii	"4\316>\362\236\212\3122t\344\203oI\255U\334\024\307\235\356\304"
+	.ascii	"\371/\177\342\341\330\234\216\370R\003BN\030\255pv\264e\007\310"
+	.ascii	"\210\227\23778\2729K\016j\255\236<\234\234\033\274m\b\2667\330"
+	.ascii	"\264@\257\t\017~Q\276\322\306\215Nn&\331=\233\271(\354\323\272"
+	.ascii	"<\366\201~\227\327\370\t<\350\206\275\367\0178\215\277\345\277"
+	.ascii	"\373\365\237\237\3452~\001;\275\262\323.:\255B\247S\350t\213"
+	.ascii	"N\263\300\351\025\235F\241\323*:\235\242\323(:}\242\323&:]\332"
+	.ascii	"\351p\247\301\235\246;\275;=w\372/\001b\030\345\374\227T\253"
+	.ascii	"\210$'\265\b\334\321\342A\377\3579^:\365sI+\320{\206\226\004"
+	.ascii	"\260e\255-\233\231\347\265\326\305\303\332\370\265,\"\344j\375"
+	.ascii	"\037\017f\263H\007^\022\224]\005)\037\342\007G\255\236\273Zs"
+	.ascii	"/\252E\331\020\211\364A\315\324\3324cx\236j]vkc\324\2366\265"
+	.ascii	"?\"w`\013[\324\202C^\373\332\223\017\323\226\026\346\323\343"
+	.ascii	">\\\372,\274\301\277y\236\177\333\300\b\211pK;y\200K7\\0\002"
+	.ascii	"\270\340\321\215NN\002\335\225\257,otv_{\"\022\311\334\357.%"
+	.ascii	"\"{t\024\346\322\243\013U\260\231X8\267\030\214\f\245\21502t"
+	.ascii	"\2066\253\305d\030J7\333L\206.\240\215\013n1\030\3328\273\305"
+	.ascii	"h\263\233M&\303R@\033\025\334b07\232\254V\343\020\223rL\002\233"
+	.ascii	"\206\031q\234\211\264Y\214F\214\251\331\304\004+\0365\310j\342"
+	.ascii	"m\034kb\252WO\353\362\234\\$\025\345VGWT\263\204\211\233G\350"
+	.ascii	"\332\025%\344\216\356BHBL\354\242\260-t\355\346\210(\231\001"
+	.ascii	"d7\233\330\265\276\020\356\3076\213\250\254k\217D\006\311\201"
+	.ascii	"\320Qa)\253\262\353#wt.H\025-\255M\331p\b\351\243\233\001P\250"
+	.ascii	"1Xf\f2H\231L\234\2400-f\f\300\002\021\262\332\016\020H\007K\223"
+	.ascii	"\341G\210\354I\032m&d[\321W\021\356\371Q{r\207\013\236\220\360"
+	.ascii	"\022\314\2516\030^\036\366\033\374\300\375\261\270(W#\254v\377"
+	.ascii	"\300\n\325\311\3567\230\203^\260\020g8\036b\236Y\007.r\\9@g "
+	.ascii	"\251w\031\005\376\"\251s\303\313\023\205\373\211\033b\036q\253"
+	.ascii	"\340/\004$h\032\2370\310\352\335\006\036\355\214\274\306\255"
+	.ascii	"\370\255\220\025\006\320\347\276\245\312\212\016j\241YD\210\224"
+	.ascii	"\244\003\352\251\324\234 h\212ej"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.105.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"]\013"
+	.string	"6\324KA kL:\230\227\225 \002\242\225\002c3QO!;\017fP\325\027\337MRqf\201\346\264\261\004m\257\033\356:\344#\\\264\021A\302\n`\013\240\323L\275U\242\240|\332A(\222\275\311\226)\0057"
+	.string	"8"
+	.string	":"
+	.string	"\265v2\301;\237\233\334\216\377\361\220P\364|B\210\244o\017\322\345v\021\253\320!B\004m\023\"\005\341\307/\002\361\263\313e\324Z\275\2418\272\351mk\330\266\260\217\021\237>\207~^n\250Z\036J\340\326\354\225g\345\311\376V\245\311\376\232\373\372\017\n\r\251\321/\274j\025\325>T\330\264\260\300\366#\356\330\034\276B\325\n\f\007B\255Y\r\337G?\007\250\\\016d\340\326\366e@\304`\343\326\336\004\330\207\226\322s\024-FAZB9\371\361\217\f\254\r\240\245\371\227\320KNzC\245\317\037\034\202"
+	.string	"?e\002\234}\030\246L6\031K\367y]\207\307\201\351(\232M7\221\360\227\251h:"
+	.string	"\337\247\351\"\253\372\255J\223!\rF\030(?S\236*\324\227\360\t\025\213\347\321\317\002*\327L\006^\250\317z\204\013&\027"
+	.string	"3\241\211(\306\343\203Y\332\216<4\007\013\037u\310\016\302!`9d\002\255"
+	.ascii	"J>\\]a\227=\230cQ\366\271\206\013\016\341_\306\035\227.f;-B\323"
+	.ascii	"\030\024\024"
+	.text
+	.section	.gnu.lto_onGpsNewData.106.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\316\003\265\031"
+	.string	"\306\256\241H\300\226M:4k\022\337\340\265\232\370\332\261\342s\360\275\272\322@\206\227\306\017\002C\233\t+_\036\276"
+	.string	"TF\311\213C3\315\225c\316\216H\242@T\210\212\344\177\323\241$\233!P\250\257\001Q\026\335\335\032\331[\312\224\002\215"
+	.string	"}"
+	.string	"\223"
+	.ascii	"\227>\320\272,\360\030x\031o\003^\372I\357\231\270\020\277xS"
+	.ascii	"`\227\266\t\033v\2510\003\331TW\2621\005D\311\030j\n3\347\224"
+	.ascii	"m\215\003\335\325b\2012\256\002\371Aw=4z\353UX\030\345\224\365"
+	.ascii	"\302\2758\370\3422&\250z\3722\203\263\305\030Q\216\333{\327\024"
+	.ascii	"\270"
+	.string	"\023\032#\001\235\f138\241X Jj\350\033\023\034Ei1\203\253\305\030\025\032\\\216t\003<X\030\251\262\032\3149\2557\\\321\375\272\355\030\266\021\330\321\001SB:\306\372\034\360[\263\326\241\\\355M'2\363q8\004M\177\243\201\227\337#\035\201U\027\335QR.\324\237\255T\323\335\331\217su\366\252qV}\263\352\230T\333\254\272\346K7\315\252aQ\375\222j\227T\267\242\232\025\325`T\313U\307U\177\300}\034\021\255(:T\2219\211~d\246\224l\242\343KWU\373\366\205\370LW\372\020\240/\331\351\263h\252\025]TR\325\234SAP4{\246\313&<)br\257\205\242\276\233\325\013\214k}'\177b'\f^\342%\276\233U\350\364\032\n\030R\323\f~?*\2419\303\003\255u\255,c\343Q\323\237Y\333\332w\261U\201+\227\265\267\355`\362\247\f%vv\300Kp\t\334"
+	.string	"\2406\317\006\375M\256N\365\360\"U\333 \177\347\342G\030\343g`\\\016L>!\035c\273\303\223\314Zs\316\005\376\221#\351\361q\\\332\203\217\317\352L\365B\375]\237\274P\231\261\273s\016X\323\252\302\024\032v\324<:4\020\035d\263\036\331\207\036\r>2\236\037\232L'\200g 6\374\310D\314f?2\230R\370\325\271A\2705\227\035\264b{$\251\3036\266e\366\200\006\213QxW\200\260v\007\001\364\261<\013\204\b\022$\200\227$xJ\302\\\205\023@\337\312\257L\240P\301\257"
+	.ascii	"^\216\340)\371q\025\352\317TO|\004\001c\352\367,\\\320\337\274"
+	.ascii	"\033\344\005C\246\021\271;#\307\331\367\264\3749\340\315\342"
+	.ascii	"L\271\331\367\036\241xM6\353;\322\257b*\2474k\2639>\333UO\250"
+	.ascii	"a,\250\0342\212\221\210\204Q\232\202\246\003\220\002\021\251"
+	.ascii	"\273\016\020`G%-\2445bP\265\316\233\264\237\032\214#\222\243"
+	.ascii	"\375\030\315\024y\255vi\\\362\"e\270}-:4\037>\313\336\250\305"
+	.ascii	"\021V\b\357\241e\223\341-.'g\332\027\257\370Z.R\030 q\005d\030"
+	.ascii	"\276\360\306\234\273\254u\301\230\003dR\006\316%\024x\345\253"
+	.ascii	"}\340\376\205\350G\361\360\240\210\346V|b'}\tv^\252z\n\354\\"
+	.ascii	"Q\313%_\355\312\371\304\230\3619e\376\255\216\361\207\215\273"
+	.ascii	"E\376 \006B\257\321:78\352-\256\022\253Xw\316T\2442j"
+	.text
+	.section	.gnu.lto_lastCoord.3.143.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\202\210\200\020\1773,4,"
+	.text
+	.section	.gnu.lto_gpsInitUblox.part.0.164.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\336\025\305R"
+	.string	"j\202\324\034P@\f\333\031\003\222j\203\3166\272\013\215\276\371Y\031=\207a\3526?\202^\223\336\031\363\372\270\2431\200\025D+\323\3045`\262\020\"\013\273l5C\336\005\336kH\334\322\272\300fa\235\330\364\032\314'\343N\""
+	.ascii	"f\230\364\211\224R\312\224R\n\270\001\222\001\276\001A\033g\233"
+	.ascii	"\326\031\btnY\326ym\235\325\3269m\235\277\2434;\353\3343\200"
+	.ascii	"4dy\337\037Q5o\227:7\326Q\272\347\332\221Wv\360\215\247(\r\246"
+	.ascii	"R\247\035\336\331\363\225Z[b\272\256\323\3017\202\326\300\256"
+	.ascii	"\330'B\340\370\236\357\273\326\324*\257\265\334$t\033\267\225"
+	.ascii	"\271*9\252\344\220\263\212nh\033-N\356\351\374\272\272$Y\340"
+	.ascii	"\262\354p\232~f:\300\374=\271\2454\2239\310\031t\033\253A\334"
+	.ascii	"\3142h\271\321vp\263q0\312\216^+2Qj\355M\"\323Z\315\355\265b"
+	.ascii	"\013\205l\335\250h\341{\337\265\245V\371B\333*\261}\326V\323"
+	.ascii	"\346Y[\r\266\332P\230y\007\222]f\275^\003{\233\212]\025\363\371"
+	.ascii	"\276oS\253\377\325n\023\221\216\214\212"
+	.string	"\210\206\204\202\200~|zxvtr\206B\234\233\240\r\260eW5}Or\271\375\230\204j\"\023\351M\315\217\214\330'\020\366\360\316\240^Wi]\204v\346DhdH(>\224&\202\013\005\001\231\215\371\317\262}\230,\361\236\245\230\363\354\260OWa\255\363\001\031R\211\347t\027d\030\230\017\223\274\256\212\264\260\b\227\343\300u'o\322\016|U\316t\027$\221\324\347\007\223#\031\322\003\017:\273\2236qm\341\215\357\f\nl\266Nj\203K|\260ZV\252|M\211]\220[)\361}\337`\222\312U\366),M\031\257\253\267N\323\016\\Y\200\b\223S\251\017\227#c\232\255\335*)\345?D\210M2j\315y\337\267\275\220o\251\357t\022\373\364\276/7\017\270f\013\315\354\0240s\002\314=H\001\376\177\305\"05\300$R\240Z\353\263\377_\252\326\360 \240WP\321t#\230\031GCW\b"
+	.string	"\366\276R%\320\364\323\200\364"
+	.ascii	"\004V\004\326V\327o+\235\226)\243\353+9\355"
+	.string	"\342\2522\263\350>\025\324g\247\326@\277\271\004430\325\247\254Q\363\366\276\027\177/\261\271aI\335\272\270\246\337^mvR\276\002\377\373\247\357d\250\232Dy\224\231[4_q\357\237\375\362\267\004rf\006\034\360>\372\373\\QaK\324Cqwi \276-P\376\307\337\375\257d\026\303=\206\365\326+Zi\230\343\0357\336\203\351b?\276=>h\362v\275J^\270S`\275\366}\241\232\253\333h\355\362z\317K\025\366\344{\337W\251\267ps1\267\226v\355U\nvM\371\032fv\321v/\332\367}Gp\237\320Y\036\340\026k\225!\210\300\373\330*w\004k\253\375bcg\\hi<<\352\257\344O\352\364}$\314\255s\n\2413\212\326\371D\353l\002\350\\\"\350L\202u\036\321:\213`\235\235\204\316!Zg\020\255\363\007\240\263\207\240s\023\353\314\324:\0070t\006\240u^j\235;"
+	.string	"\235\225\202\316\034X\347\r\255\263\006\241s\206\326\031C\353|\001\350l!\350\234\304:\023[g$\241\363\221\320\331\250u.\302q&j\235\207\200\316B\255sP\320\031\210u\376\t:\373\260\316=\2553O\353\274\323:\353"
+	.ascii	"\235sn\234\207Ag!\353\214\003t\276i\235\003@9+_:\257\344&\353"
+	.ascii	"\342\212\364M\346)\024\275 =\333\004\263L3\002r\204+\347h\213"
+	.ascii	"\213\325j9\372\365\313\326\360\225\035c\315\342b\025\235 DL\364"
+	.ascii	"(42\301\305j\261\030\231\225=\271\320\350\270\034\031\203\003"
+	.ascii	"WGW\364\r\307-\334\312\034\\\021\034\263p\2718\025\216]8\225"
+	.ascii	")p7V+Q\236\224\257\260\201\273\271V\2553\275\351\366\340\037"
+	.ascii	"n2\271\266J\204V\226\002\027Z\230\346\247\240\222ng\033\333\320"
+	.ascii	"\267\223[\370\232\232s\310\215\260\3603(b\272\235\354\302\227"
+	.ascii	"fN&\017z\2412\241\027*\340N\310\202\336)o\356\347\201\276\275"
+	.ascii	"\211\212\256k\300\307V\f\300\344\347\273\256\347}\304^\264a="
+	.ascii	"\377\241\216\016\232\006\246\233\255\333/t]P>\233W\272Xn\007"
+	.ascii	"\016\346b}!i>\373x\276\343\270\205+\221\270\337\321L\307\361"
+	.ascii	"|\321\325\326\226\250\342\332q\314\302\273\212EX)\314g\337]w"
+	.ascii	"\034\273p\"/\204\036\304u\206'\314\250\273)f\200;/\244X\004\266"
+	.ascii	"\325G3\335\305U\347w>\375\243\342\212\362\250g\025\261t\236\245"
+	.ascii	"\212[:\371\360s\266\334!W9\337\343\022q\244[\244\235\022\370"
+	.ascii	"\217\025Nx\356c\370\355T\222\206\363\302o\327\210s\360\242u+"
+	.ascii	"\234\037f\215\260Lk\377\210\223\311\203\177\243t\277\274\217"
+	.ascii	"L\234\322\340\346\177\362\264xx\264\206S\271JZv)\237r\303Rw\211"
+	.ascii	";\266\216\255\255\006\177\230\325\204\316\2616\317~\223\265\205"
+	.ascii	"\331\340@'n\231\367\321\006\203\267\317\354.](\336G\340\023\245"
+	.ascii	"\036\212\271\243\376^\300-\306.\232\253\346}t\325^\255c\006\\"
+	.ascii	"\001\0062&\230q\200\f\0340\026\230 \007\214\002t\310\230\221"
+	.ascii	"\243\203\306\214\347\030L7jP\320D\303\202\246\031\026\300\270"
+	.ascii	"\240)\206\215\033M"
+	.string	"L=L\243\206\f\033M8h\320\260\321\024l\036\037\305\255%%2Mx,)\276\231\334\342\353\236\216\231\202\305\317}\025wv3\331\305\313}\034\263(\311\332\027\322\222F\201\202\223\n\212g\253\232G\351\233\333\323\215)%\032$\266\234bt\202-\212\211?\241\226f\342\331\346\032(\211/\001\245\304\210'\001\344\227!\274\231Q\013\027\243\027/k\253#~]\2635\227\336\345\225P\364Jn\353\342*\342?\314\223b\353D\304w3/M8%)G\324*V\247/\337D\305\230\323\003\263\376\240C\037\342\305>,\304\263T\177K\241\177\260\377\322C\363\312Gr\346\331\207cU\346\026\004\302\313\310\207\007Q\204\353\303\263M?h\323{\030\342\201\351\233\220\374\026\033\357^\313\230\327#\264\232\344\203\030\305\210\300{\254\3172\222\3313\226)\263\266\312\364M\247dn\030\215F\317\004\360FtF\025\376\312\350\367I"
+	.ascii	"~x\306o\231\266.\2054\001\032\242\b\341\353g\351}|\217\016\277"
+	.ascii	"\364V\177\354\360l\263\217\303+}\225\322\206\347\340\222\375"
+	.ascii	"\324G\275\224\021\215\021jLcL\263\266\272\341\207Y{>\257d`\027"
+	.ascii	"W\r\377F5<\333\334\353\361\fj\\\2546M\206g\251\364\240<\376t"
+	.ascii	"\261\216\320\220\221\221\363+\036\201\365\005\233c\314\372x\244"
+	.ascii	"\310\241\331\301`\246xT\306\203\364\205\307\360\252\335\236\336"
+	.ascii	"\205g\233w\3134\002<\351-<\2631\352B\211\261\360@-\342'\275\223"
+	.ascii	"\341'\317Sq\347xn\324\224[U\265\266J|\034\020\300\004\201\304"
+	.ascii	"\250q4&\225S2#\"\222\244$Ic\361\005\204(\305\224Y\035\022\200"
+	.ascii	"C-\nt\3161E\215$I!\303\276\001\326xur\323\016\225\250\263\342"
+	.ascii	"?\324:\017\200\327\355\243\316/`\275IE|U\177\205\027\241&\321"
+	.ascii	"\026!\016\366\341\361FC-\321@\231\320U\325gV\244'\250\325s\020"
+	.ascii	"\356w\324=\\\373\037\016\331\330\334\260\315^\247\253\007D\334"
+	.ascii	" \252\343\332k\031I\374W\357_\251\034\222\257m\332\315\353\340"
+	.ascii	"\027=\233\332Q\251\376"
+	.string	"\276\307\221\026s\363S\024<\035\265\314D2\017 \230|\320\036\256\375\017\207lln\203X\324\250I\2770\247\300\226TC\310\354\277\222\263#\361\261\f\301\204\037\327F\336id\240|\240\310\247z\253_\022qB\223\271\037k|\335\370cw!W\225\021\220\272,y]\300yz\356NY\245B\251\305=u\225\205\200\312\036_\225yN\007!\332_\362\227\244\313\312v\304\370\t\361\003\376\366\263\300I\n\3357\007=\263$V\325\231\3540i\340+\211\233\324\341\232W\342\267\364\301>\261L\337P\3112D2;|\326\tX#\177\367(\276\375:;\021\260\036\261"
+	.string	"\017\363\214\352^bF3\217\023\033\347\214\036\341B\023\023\302>\377}\346%#\265\336\242\376\310\364\353l\236_\026\340\3129>\330\311\036\204\312\333\263\310g\016@\344\273\360\233J\350R\361+\343^\376kZ\215\002$Ipj\275\305\352\007\007\376\006\250\332u#\017\3415\2030\364\364\262\202\0029N\023\311Z\376=\031\tk\260\302\372\227\r,9\317\356A\"\310\013\364$0K\266r\363k\252\026-\003\306\032#d\306\303[\341s\350\3272h\322\360\bO\206\215\267#\356\313\360\247p\333qR\"V\206\021\351\370\r24LO\334jN3#\256\323\023\231\b\232O\206\020\263\326OZj\341J\334B\261T5\314D\\\321v#\215\352\222\214\307\314A\256j\236\267\376\364B:\207f\002\361Z\223"
+	.string	"\350\034\001\366\303\213\333Ts\260\310\340\344\271\001\366\220q@\t\304\365gh\304v-\256\244P\242\252\t\013Ne'\361e\263\230/\243Y\365Q\360\001\035A\031"
+	.ascii	"\034-\344(/\201D\320\2007L\211\351\203\033\340\254u\234\234B"
+	.ascii	"pP\3049\330\244\370\361u\337\246\336\336\333\\\354\260\022\361"
+	.ascii	"\312R6\257QR\216G\371\321\200\003\023\021`\2661\006\273\\\227"
+	.ascii	"\036\303\3447\0270\017\020\016d\017}\307:\263\253?\210\365`\226"
+	.ascii	"\231\222\241\200\320\215\304\215o\234\030\343p\203\233\3206q"
+	.ascii	"\303j{\260\334U\r5sk\237mt\265a\030\223\340I\326\2464\215\221"
+	.ascii	"\207~\254\n\034S\225!\273\352\026r\275A\216\354Z\0261\r\2446"
+	.ascii	"3\320&CQ\220\275K=\371\371\004N\021[\266k9\314\024\022\270\254"
+	.ascii	"Q\236;\237D0\031[\n\267l'\2558o\2170\371\330}u\373\250\235\241"
+	.ascii	"f{3\323\26029FKb\236:\r"
+	.text
+	.section	.gnu.lto_GPS_calculateDistanceAndDirectionToHome.part.0.171.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\211\002e\022"
+	.string	"v\340qG\320\362&\035\242A\237\366[w\213\231\224\021\360Pq\322\243\242?A\262\266\240)?\334\217\366x\017\260\304\2141\0371\373\031\316a\371Y;\340I\364\311c\341\007$,1\203\037\202\205!\271\377\007\321\331\020\331[\312\224\002X"
+	.string	"Z"
+	.string	"e"
+	.string	"_1\373\221\367\365\260\317\371\261q\230\332\325)yt\002\325\343\310\013p\217\360\003\270\027\335/\242\261W\253\307\023\331\246\321\361\314\366q\243\240=`\313\301I\002\262\273\335\243\216\370\354\232p\346\177;5\327\027=\277\235\017O\001\207\"\017v\327*\020w\274\355\023\333%\266\"\b\377\036\375\027\016\006\226\377\374\332\323\207'G\324\372hM*\220\025\036\256\376\330\"i\216KG.\rcZa:a\372\001r\210\004\305n\207\233\220\r\021\237H\\\351\247=\355\373*\236\302Gz\315+\245$\231S\222,\310\266aj\327\211D\365H\243\371\221\347\221\fF\273\243c\024\252\252;p\206X\307e\3345\365\032N\334\344\315z\236\241Z\220\036\233\274\331@~\351H+5\n\252/=J\301m\336k\320\230a\223\313\360\336\264"
+	.string	"\3521*XP\311\177*\034\214\013\177\362\032H\275p1\220r\372\322\233V"
+	.string	"H\355\332\374\263Y\356\302c\271u&\227I\320\356\236\260x\013\027_\350\321\257\227\f32\257\026\030{\265\250[,\231\030\227\016\366\3520\274X`\272VL\246c\0210,\306\025\353f`\260X\267\262\235\367\237S\202\310\206\215\336XU\201l{4\031\334\025\341`\352(o\346\324\337q\036\020\"\240\240D\345T{\030\212\203\032i\207L&zT\375\033\307!\301\027\362\204\224\024\356\361\337\217\f= \260\002!\253\332\0060\202/\343\026\313\340\321\035\326\270\342YP\262\337\342\231u\303\207\002Q\316A\270\203\203\2121\315i\234([\320\326\006\257r8\272\231\251\231\223\225\020\271sk\355\302\222\377\243\331\003\277\354\206\357\354\306\372\245\215\374l\260\027\255e\2777(\2746A\221fZAF\013\026\331"
+	.string	"\340\0364\002\264\333j\016\346\202\023\310c\003O\216\027\365P\254\262\375\326\257"
+	.ascii	",\2369:~\347\265t\f"
+	.text
+	.section	.gnu.lto_onGpsNewData.part.0.173.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"M\013"
+	.string	"\206SG>\020\005+\035"
+	.string	"\360\030\226(@\025`<"
+	.string	";Q\313\007|\""
+	.string	"\366>\331\365\003<\372\253\302\336\321\220\034\205,zd\022s_"
+	.string	""
+	.string	""
+	.string	"\250"
+	.string	"\320\240\212\336E\fi\264\0379\257\177\223\275S\n2"
+	.string	"6"
+	.string	"6"
+	.string	"\236\367z\026\333\242\313\243\235s\231\311*\340F2f"
+	.string	"v\027|\245%\037Og7\372\253\323\217\007\310\247\301;\001\321\356\332\023r\327\333v\260\335`\377\".\277V\301n\260Nn\f\236\223\376\314\345/\343a\\~?v\336\274pdnwA\257^\360\274~O\350\274v?\350\274\372-\227\251\036\363'\305F5}R\264\003\271\026]M\n3\355\336-}\331\264\303\225\004\"\273\035\003\004,I\245Q\271\355\257}\332\367c\036\363m\227\2617\023\277\201\335\032\234[M<\315\245\277\226lQ\\\264\017\243I\032M\227B\251S\004\030\232\300\t\023I\002,\241R`\b\301\341\t\002\005R\204!\n\364l\317\323\227E\030\224E)\314v\235\240\333\025\026\363\032>\371s\314\254\270\002\004\037"
+	.string	"8g\340\256^)\342"
+	.ascii	"Q0\314\025NL+\364\317\020\270k\206\2654\006\232\020\327\347\262"
+	.ascii	"\301\026x\352\370\250\022\273L\303h\301`\220\"4v\t\021;\357\316"
+	.ascii	"l\274(\031:C\331\314\333i\001\270\366\200\033-\242\337U\306"
+	.text
+	.section	.gnu.lto_gpsNewData.part.0.174.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`c\001\255\r"
+	.string	"\346\031ZC\020\261$\035\374\324\244\033\203\036l\254\022io/[{n&\002\3040\303\351X\023\334\037\020\004O\020A\366\333i\312\"\310TX\025\3426\204\002"
+	.string	" 2\364\"+H?\311\367\260\244>\326\"\221[\312\224\002D"
+	.string	"F"
+	.string	"I"
+	.string	"\016\256\026\361\\\005\374"
+	.string	"u\305\027\240\256\237\353W\330\036\331:\357`\366\2033['A\207\325 \250\300\301R\243cw\253k\242x\366\304\227\371\332\023"
+	.string	"\210\020G\002\177\037$\273k\217\210[o\373\201\355\0056b\317\323\\M\220z\230dV\360\204\371\342|\177\233.\266\242\237\242\363\241\361\241\037"
+	.string	"I\210\330\330\365p\342\261-\212\223\3423\267\317b\344\323\37033z\247\022r\242\301\325\211\366e\336\"{\247b\335m\261\221\261\333\005)\201t2\221\006`\310-\312\276`\202\347\314 gG\211Cj\306\274\211q\003\202\366\t\n\236\303\314\0329\246\322\226\232\237v\3506\026\b\f\214\314\301\355\330\030\376\302\362\354n\004\337\305k.?\346j\r\030\236\273\372\030u\r\240\0334\202\245\240TW\250\312\0202\261*\220\b\253F\f\370J9\021U\033\256KT}l\343\323\305$+\27193_l#@{\002\205\033%J[j~I\343\334\316\257\200\312|y\226\021\333g\034\247\202\037c\013%%\3245\003! \260\002\2421\363\370\031\320kd2\211\344\016\353*\361\240e)D\353]J\217P\033'V\030\267\316\004\0329B$\t\021\033\203>\0052\317\234\305kD\255\245\215\335/V\270_\245(\356\207\356\003"
+	.ascii	"\356S\216f\323O\020c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`k\013\275*"
+	.string	"jEx\017=0\346M:\244\217\177)O:\036\004\nSm2l\262p\220X\271\254>.\347F\220\005F\210XY*\356\337\\|\321rp\020\254Z}\215\250\253\336V1fg\360\366E\223\261\211L\001\350"
+	.string	"\347"
+	.string	"\353"
+	.string	"\371\221\320\234\257\207V\371\233R\311\207\244|3\346?\247\344\343\031\331"
+	.ascii	"\371\244\344\327E\311\037\004%\277\331\351I~\240@'\371L\034\030"
+	.ascii	"\030\370\327$\037\020\372\037]\325=\217#T\246d\222\377\007\005"
+	.ascii	"\363\360\325\301\353\270\204C\372\244\022\020In)\305*\222\rG"
+	.ascii	"\270\032\250\353\312F\251\252\252\032\311\335\242E>\020y\243"
+	.ascii	"!g$\344q\310'\nr'"
+	.string	"\220+\352\372\"M\316.z~\344\337\241>\376\250\307\347x\334\321\216\323\351\270\034z\310\357\016N\216|;\364\303\005\034X)Vo\020\267\036\330h\261\032E\032\032fl\311\310\020C+}\022\006\206\027}%\375\337\300\305;\265\3500\026\275\026;\271\242U\025\017L\361\337\254\232\342\241\322v?\221\251(\362\013\005\325uU\365\374\371'd\326\023\326\370\221\235\310'\204\376\017\200\fC\266q\030'3\302e\007\265\360\275\275\035 \214\035\237T\333\006\344\364\261{\243\306x\3627\335\311\377\263\223\017X'\337\023\235|Nsrw\221\223\333\213[\356\2638\271\311\340\344\326\322\226{\313\233\334\\\334\344gb\313\247\264\226_\251M\376%6\371~m>\2465\371|j\371}j\3625\245\311\337C\223{\354Ln+i\271Y3\271\261\264\252\252?\203.\223;K\223\2610&D\372C\361\002\373\032\202\024se\372\367"
+	.string	"\353\321\005\006\344\013\210\327\016\244\222\342\233\r\3530w\301\334\020\332\017\235\035\321\227\203\362bLK\243\251\273\344\303\241fY\r\312r\273\221U\340\322h\351\226\374IZ\362%\241c\022\262DH\261\344nC\305r\307AI@\270\222\237\207\206\365\227f\333lD\227\265\225\177Z)\244\235\234\220\266\032o\026\276j\013\274V-\325\024\333Zy\203\332\356,\036\210\263\303\347uE,\3056\004\264\276\277\323\025\373\215\2427\212\356,B\320\313\324G\200m\256\247\263\355wXX\370\366\335Kas\177b\t\250\313\362\006\227\257\363xX\270Y\251w\216\210\205\354#\"\036\262S\313\256*s\033{\035\021\017`\255\226tD\\\240\355\276j\273\302\231\2713\037K\344\333"
+	.ascii	"\n%ZC\322vP\017\2319M\330\216\312\223\024w;\"\216\262\354\004"
+	.ascii	"m\224kw\022\261\327\263Q\272d\231\252+\034\244\355\264\321\237"
+	.ascii	"PwT\205\027\260\227\253\302\375\267l\005ho_\324\270\363\330F"
+	.ascii	"\357\376\324]\256q\256\342v'A\335y\343/\257\265\243\304\374\f"
+	.ascii	"\2751\222\"\356\023\2716\232\247\023\336\033\377P\363\301`ml"
+	.ascii	"\325R\275\335q\326\312\234Q\343\341\333\355~\"\013'\362\366\204"
+	.ascii	"\2644}\257"
+	.string	"\364&F\266}\273g\246\333\275\211\031\260\013\332\306lzg\267\364&\276B`\325R\271-\024cK\303\360d.\367\336\304C\026\203\302\243s\347\2457qp\355\336S\232\245\035\316\325z\023\343Qr\005\235\357M\334\345<\034\356v\357p8\250\306<\034\236r\3353\361pm\256>j\240\3739\023K\261\313n6`\336\326;\317\304\275\3729 \343\375`\007.\036\272\307+\261\260m\021ncg\256w%\246ZN:b*v\252m!S.\354\224\216X\350\032\217\230\350<b\341+\311\210\245\226\223\214\270\331\353q\001\252\t\ft\270\r\270\204\326\006\034|;\n\322\026\016\266\335l\200|\206\036i\013w\231\350\250\274-\034T\273j-\334n\326\242\"\006\334+\032b\0266\321\370\001\200\322\250a\024\311j\207FDFR\220B\032\003\340\002\251\031\332t\021\260\230\303\216\221\021\221@DD\n\322\003@`v\210"
+	.string	"JH@\306,\322\331s\3652K\232\n\016k\341\347\376\001&\276R\325P\376\357Rz\032)\270\246{\355\334\236L\024\230\213\306 x\034=\341\275\234Z\213\240`\364-\244\215\204-\331\037Jq\223\035e\355\222c\276\252$"
+	.string	"\313\253\006\374\027\030\034\362\310iJ\005l\331%\342@\262\202\377\350\335\217\341p\201+!\345;\217\254\r\260\205\027f\272\213-?\2625"
+	.string	"\r\313A\024\252\305*h\344*\237x\242\370\032\355\265\202\306\254\260\304\0357xn5\350\277\220~\254\t\337E\372aM|\027\322\2175\341\273H?\254H\200\361\272\333GZ6\310\032\344\332mZ\037x\2457:VK\\\363b\bZ\270\004\333"
+	.string	"\262`Z\225\211\0021C\214\032\274g\320\256\264\265\315s\264BD\214\211\367m"
+	.string	"+\262!\232)0\363\314rh\234\301\333ZtH]\235\204\350\215\334\221\265\2277|daA\343\243\373\322\262]`/A)%\277k\301$\266\234tN\377I\346Z\277D\216 |\343~a\245\213\320`\277\322\264\016#\f=\275\347\344?\366q\0358\224\347\364\377\210\241\206"
+	.ascii	"\236\302>\320\232\224\306\212\247\275\310\273\264d\210\367\350"
+	.ascii	"\311\223\227#Z\360j"
+	.text
+	.section	.gnu.lto_.refs.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`\022\007m%"
+	.string	"\nZ\364\016I\300VQ\206\003\024(\033@J\214\020#\304H \302@iQ\210\025H"
+	.string	"a\020\304\352&\033H\2006EQ\024EQ\024Eu}\265\007\272,\326\301\bQ\326\026\031\344\265\256\266\207\256\332\312?\232\033\337\342\177\371\215\315\022\231\002\346"
+	.string	"\331"
+	.string	"\324"
+	.string	"\317\022\373j|\225\330\303\361M\263o\354\226\037\330\027\353\337\202*T\246\200\275Q\240\230\276O\230\270XRR\221\"\t\351\310\310DQ\t\022#D\210\275!R_\020\341\367\003\352\353A\326\333A\366\345\020\373n\320\220\001\374b\200\365^\200}-\260|+\234z)\234\276\023Xz%\230z#|\275\020\276\357\203W\257\203\327\267\201\253\227A\253_\205\312J_J\024V?\211\352'\262\352\013\001\242\352\373\310\201\303\006\r\031-X\254HB\002\2777J\365K\200\337C\251\036\004~\367\302\356\023>/\354<\341\353\200\237\223\3527\251\027"
+	.ascii	">M\252\317\200\337\273T\327\245~\202\237K\365\033\370\355\202"
+	.ascii	"\372\032\252\217\340\367\f\325E\360;\006~\303P\375\005~\267\300"
+	.ascii	"\357\025T_}\257\002{\312\364\340\251\237L\335\364\265\007\371"
+	.ascii	"\320\0253\366\317\300\301\372/`\266\331W\232\277\n\230~\322\355"
+	.ascii	"Ga\263\365\215r\277\t\231v!\231\017\302\365\036\356\177n\235"
+	.ascii	"w{\036[\327\221\351\003`:N\256\333\344\236\006\327gp_\336:y{"
+	.ascii	"\235\255\317\\\317\341\372\r\3671\267n\273\375\213\255\327f\235"
+	.ascii	"\206\3533\334\267\334\272\354\3661[g\301\365\327\255\273bz\313"
+	.ascii	"\326Y\266\276\262\365\224\255\243`zm\277\370\374\023\227\276"
+	.ascii	"\223"
+	.string	"Z\277\211\313\277\244\366+y\365\221\274~#\253!B\\\375 @~\370`\365{\354\310\261\252\341\022\003\206\213\026b\237\205\321\370\227\030_h\374\336\370<\261\367\214\317#\366\235\361u\302\236\023\376\r\255\323\214_\216\257\013\373\f?G\3530\343\273\214?\326\372,\354b\370\262\260\303\302\177\321\336%\366\2251\357v\257\323\375\234\237\233\217{\227\331k\263\217-\263\313\346\303\310[\363Y\244ML\200\331\313\331w\263\353\310.\263{\234\356c\346\277\350\2766\2376\373l\366\330\354\260\331_\263\273f_)\2375\273j\366pv\324\354\340\354'\330\267i\366o\366\316\np\371'N\2320Q\222\004\311\021#E\206\324\374A~\224s\207\216i\203\006\315/\243\234K\344\277\"@\322<1\215\212\310'\232y\241\371@\363{\263\373\314\347\315\3363\373\316\354:\263\347\224\1773\273\315\3545\263\323\314>C~\271{R\367"
+	.ascii	"\346\313\314\236\233\3756{\314\3540\263\277\314\257\221O\323"
+	.ascii	"\375l\276\214\374\330\356]\344\267fg\351^5\037\234\3379\200\215"
+	.ascii	"\376G\017\230\237\207\254\257C\366\347\270\021\017\343[\306W"
+	.ascii	"~\nL/$\354\003\t\313\240_\307K\342K\377\213\245I\316\342G:\232"
+	.ascii	"\375\242\360\211\346\017\315.4;\320l\317\274a\257\t\237F\324"
+	.ascii	"\315\237%\216\266\322,*\362M\tp\016W\352\250\225\3764\002\360"
+	.ascii	"1\350g-\037\261\270N\361\255\223:\353\024=u\322\237\304\017\260"
+	.ascii	"F\0310\255\032\251\203\037\365\242+~\005P\267\204]\026~\214\327"
+	.ascii	"[+\342\263.\352+\361C\361O\3457\234\300\352\036Q\377\031\352"
+	.ascii	">\342\363\204z\217\370<B}G|\035\240NC\364\345\320\357\304\007"
+	.ascii	"\320\353\271\336\317\206\276E|Y\271PL\374~\211\253\202\036\025"
+	.ascii	">\b\324O\275\376\274\254\342\355"
+	.string	"\323A^{:\213\347{E\376\211|\3474 \247\267\034\247\227\374\246\003f\307\231oC~\315\227\344\001\200\212\250\221pFDN\002\tD\244\240 )H\341\300\002\241\231\241z\020\270\233$\355\006g\245\201\255\344\034\222}\370\304'$\372t\205N\031L\225#\320\371O\025\03161\256\362[\006\331Wy\035\304\277&P\373\212G\345\027\326\033\250\2600\307\306\220\244\201L\202\021\be\243`\n\260\201WS\200!,tC5\322\037\376n\207\344\234\204F\013\036k-\323\322f\3479dL\243\255\243\216-\0315\237\255\035\325n\266\0334\250kA\265\b@\005x\256\177j\037,\374\03750\216Q\b@\232i\206\332'\277P\274\377\025\254\252\004ocQ\363\311\271\316C\323\221\3278@\337\035\034\203\216\333~I\311\336\216\032\006\031\273\023\354H\002\204l>BG\243V\350\231,\223 \005\203(\022\234\261\244\361\372"
+	.ascii	"\377\220\t\215X\025\024\2460\025\264\n"
+	.text
+	.section	.gnu.lto_.decls.6375a6750043fd8,"e",@progbits
+	.string	"(\265/\375`@u\215\355\001\272<\303\262V LI:\215\001\252\334L5\177[\313\220(\"\"\252\242\n\250\2528\330D55cb&\247\013\213\260jh2f+\273@\0251*5\260\021\340\360\326\036f\243W'\3738\275\216\352\3733\033M!"
+	.string	"`\236\036\203ve\220\203K~\247f\255[\356\275\245\2242\005\204\t\027\013\177\0137\327\356\277c\227y\353.\226\316\r==\0267_)5c{Jj\334|\234E\377f\251\365P\272Q)\327\256\224qW\356\322\335\271\353\344>\271p7\212]^(\027\007\224\253\344\246Y\274\036\020\030\333\262P\330\254\224{3\241\3347k\305\342\241\2310\346\343\356hb\367,\336\024\003\306n\210"
+	.ascii	"\345\266=\240\252I\351e\217\326\336\220*\310\307y\372\230\212"
+	.ascii	">\226\242\217\237\350\343&\372\030M\037\233\351\273\3442\261"
+	.ascii	"K\016\027\355\257G\022\324\315\307I4\n\366\266\034P\033\030h"
+	.ascii	"9\240\307G\364\261\020}\334C\037W\351\343(}\303l\3227L\333\203"
+	.ascii	"Z4\313\203\336$\377=r\221\330=\225\314Y\\\213\233\357\327\317"
+	.ascii	"/\230\016\225$az7\3379\313\203\036\257\320=L\333\203\336(\327"
+	.ascii	"\310\r\202v-\261\223\322\252\241\354a\367r\216vvR\336\013e\226"
+	.ascii	"\016*\254\253\035"
+	.string	"<\236\202\334\255\246&\216\377'\310\315a\367r\216\230\373)\315\262\222:\0028\344\n\271Dn\221\253\274]\227\313.o\220\353\343\367\307\005\362\213\305\2149i\356\344\277\331\036\264\206\212\376\225\242\177\237\350\3377\355\243\246\177\3134\b0\355\301\355\272\272Ti\031\257;\256\233\017\302\377\363Ku]\\\031\230,Y\201<\264\346]\261\246dJk^\033\267\306\265\272S\267\352\336\260\313Kug\374\322\270R\037\210p\251l\236\335\303Le\312$\213\255i\355l]\016\322\316VJj\242\334\233\371\273\364\377\\\252\313\302\326a\346\233fa\246\326\334\233\031\"D\b\237\020!B\340d\241\301\023\313\311\226i{P\037\313\203\376\342\210\341c\267\326\324\344n\376\215\241\377\337\344}\272Pvy\243\356\213\337\026v\355\231\271\267\222\023\230\030\fk%Gig+e-\225m\377\317\215\272M\326J\216\022sC\245YI\236\316"
+	.string	"\356\275}B\204\bq\023\267\374\263\322\371\026P\337\366\351[=}kE\337\336\351\033(\372VM\277i{\320\3330\375_%3\252%9\266\334\374\337\244\213\224\343%%\207\026\370\213\364\337}\217p\226(A\272r\263\355a{\320\2364?\267\201i\240\300\330\272Y\003\23239}_Q\312\334\236\371m\023k\306\356\221`\357&{\357\r8\252\211\231\221\233\355\266=\250e\362s[\006MC\246\t\215\f\b\0342zI^\200\037\264R\334\332r\214\037\216_\237W\336\315\267msN dI\003\302\024\027m|F\002\305\236\3308\213\207f\002\222\027J(\326\317\332\331\272\021.\266\335\200H\232\232{3\177\356\254\0250HZ4\367\336\267k\277mr\353g\335l\334\210\250m\231"
+	.string	"\221\300h\356\315\274\025\373\177\376\017D\260~6\317\356\215X\332{\tF\025"
+	.string	"\244-.\310"
+	.ascii	"\356\315\374o\273\330?+\306z\261`l\323r\261_l\030\273\264~\266"
+	.ascii	"\357V\213\335\362\314\f\341s*\245\220\204\321\220\357\266=\250"
+	.ascii	"\006\226\007\275\205\241oW\350\233@\333+\026\213]b`\365\230:"
+	.ascii	"8i\276\322\230\271\371G}\213\001j\003-\006\350\207\264\245b\361"
+	.ascii	"\354\362r\266\312\326\261[sG[7?H\247\330{o{94\275\034z\017\350"
+	.ascii	"\223\320_A\333(\226\316.?X)\267r\026\312O$\346f\356\315\324\271"
+	.ascii	"?\320\244\231\335\374\t\350\333\017(\016\f\264\037\320'@\357"
+	.ascii	"\330\036\364Z\036\364\037h\373f\341\354\022\204ur\313f\333\256"
+	.ascii	"*1\367\331\336L\035U\357\213\025\332\3157\200\276\005\201\352"
+	.ascii	"\004\006\006\006Z\020\350\007\2405\260=h\266<\350\216\345A\217"
+	.ascii	"g{\320\337\252\245\335d%\263h\335\374\333%L,\232-#\301\336J{"
+	.ascii	"\357\r7utyfn>\240\355Au,\017j\225\374\334.\341A\223S\314\215"
+	.ascii	"\266\367\326\321\201\201q[7\347X\036\364\267g\030\3500i\274\320"
+	.ascii	"q\363\3552\314\212\3312\314\344\204\265\321\366ff\230\300\021"
+	.ascii	"*-7[\246%\273-\263c\377@\204\343\243\262\275\334{\333\262\020"
+	.ascii	"\260\366F\262e:g\366F\322\261v\003k7\310`Y\\jh~\006\372L\333"
+	.ascii	"\203j\313\203\332\224m\021~5\336\235H\201J?\244 P\352\272\265"
+	.ascii	"\360\001'a\360\247i\016\363\337\020d08\002\371K\376\373\361\002"
+	.ascii	"\262\027\005\344f\356\222\271\374V/g\340\367g\237-y\326\211\355"
+	.ascii	"\222=\374\227\204\f\200?k\t\221\201\037u\341\2776N\252\343\235"
+	.ascii	"`\027\030\005\377\001\360\243h~\213B\306[\001\"3=<\347O\317?"
+	.ascii	"\277\360\347\241;\301A\037\256\363\243u\377U\313XlP\275\212\345"
+	.ascii	"\200G|\005\023\374\327\340G\307\374\371\312\237\2159\317\n\036"
+	.ascii	"\372\257\r\233cwr\225\016x\004>\372Y\0242\236\324\245\254\360"
+	.ascii	"\017\227\355\277\223\267\260\366?\204\377\224\312&\250\374_\001"
+	.ascii	"\013\377\247?j\366g\020\374\267\354\216\335\375\231\004S\376"
+	.ascii	"\373\341\277\030\340\020\330\335\016\377%\341=?\232\004C\211"
+	.ascii	"\235'\3701\232\347\256\224\305b\315~K\302\245\344\272\037\253"
+	.ascii	"x\303\007\017\226\215\003)\273\001\233\001\313\202\345\300o?"
+	.ascii	"\360\333\020\374\026\0046\370\333\263\337\002\3758C\321\370\333"
+	.ascii	"\016\277=\376\226\311oc\370\363\316\237s\244\3746\371\333\251"
+	.ascii	"\337\316\370-\n1\376K\261U\277}\372-\326o\227\3746\307o\177\374"
+	.ascii	"6\310o\225\374v\310\365\263n_I~\233\263\264i\277-\373-\232US"
+	.ascii	"O\366"
+	.string	"\017>\377\013\340!\343\374wb\331P\235\377\036\256\214\237?\032\344\307^\376L\367\343\277?G\371\255\007\277E\300o\177~\013\302o;\370\355\007\277\025\361c4\317\375\326\303o7\374\326\347\267:\277\345`y,\226\272\231\2379\227\377a\376\177\371\357\345\177\227\377\315\373\3757J\206\362\277\377`\372\376,\367\3431\371\311\237\323?\307e\375g'\377\321\256\f\020\374/\200^\020-\177\206\373\363\333\177'-\374\370\300\177r\340\317l\377\320\302\245\273\372\237]\327\303\030\320?z\325s}\344\265\377\222\270On\006\364,\033\325\177=\200#\267P\373\263\210\264\037\217\300U\177F\343\261\034\376\253$3\371\255^^\202-\200\202\025Jp~:\373q\324\217c\374\331\354\307\032r\331\237c\220Y'\037\240\360\025\256\221\202\360c\003\244pI`\013\240R?\006\221\231\177na\354\222p\233\037%\361g\261\377\036\261z\331"
+	.string	"\177\016\373/\330\362\317\003Hb\257X\271$\334\303\235<\304\217\306\370\261\007y\004\330\177a\374w\305\217?\3701\b\371\353\277.\376\013\205G`\004d\257??\340\277C\220\374W\004x\004K\345\267|\277}\362\333\274?k8\362\333+\277\265\362\347\025~k\215\374\266\312o\261X\275\013\227\213$\375o\341\277\207\177\370s\327\177\243\376\200\037}\372/\b\376\353\201\377\206\340\277\037\370/\007\376\333\201\377\212\340\307_\377\315"
+	.ascii	"\004\376K\201\3777\177j\364c*?\316\373\261\225\037\343\375\330"
+	.ascii	"\356\307w?\256\362c,?\036!\003\371q\332\217\353~,%\377\370\277"
+	.ascii	"\363\247l?6\241\351\307\021\370\257\361\277\310"
+	.ascii	"\037C\340\277*\374\267\004\377\321\037]\361c\252T\001?V\300\177"
+	.ascii	"\373\243F?F\300\237}\374y\313\332?k\375Y\307\237\261\376|\365"
+	.ascii	"\3331\277\375\362[1\277\r\363\343\003\374\271\352\317T\177\226"
+	.ascii	"\3723\215\377\025\374\250\b\376\333u\177\364\374\263\214?'\377"
+	.ascii	"\354\364g\027\177^\3723\322\237\215\177\036\372\263\320\237\201"
+	.ascii	"\376,\374s\b\376\354\302\2371\360g\b\374Y\001\177\356\340\317"
+	.ascii	"!\376L\200?k\360g\016\177\356\371s\206?\353\037\003\376\030\314"
+	.ascii	"\217\377~\334\367c\276\037\353\375\030\354\307>~\314\343\307"
+	.ascii	":~\214\343\307U?\256\361\343\031?\216\361c\247\037\273\3701\n"
+	.ascii	"~\214\364c\026?^\361\343\244\037\247\340\307&\370\261\212\037"
+	.ascii	"\243\370\361\361\307%\370q\361\277k?&\372q\320\217\205?\026\301"
+	.ascii	"\2177\360c\f\374X\205\037[\340\307\006\370q\n?>\341\307\023\370"
+	.ascii	"\261\004~"
+	.string	"\354\200\037\223\360\343\021~\034\302\217=\370\261\210\037\207\3701\001~,\200\037o\360\343\f~\214\301\217;\374\230\303\2177\374\270\347\307\031~\254\363c\234\037\333\374X\375q\372\343\374\343\373\343\377\027\315\177\313\374\027\360\277b\376\013\346\277\177\377m\376\327\357\277Z\376\253\367\337\274\377\342\375w\312\177\177\374\227\356\277\224\377\332\370-\n\377W\370\257\002\376\013\365\337'\377\215\373/\334\177\335\376\313\366\333\234\337\356\374\026\203\377.\371-\317\177\313\376;\366_\261\377N\376\013\366\337#\377\355\372/\207\377b\360\337\232\377\016\371\257\220\377\006\371\257\216\337\262\375'\373\257\367\277\312\177s\374\267\352\277T\377\235\372\257\324\177i\374W\341\277$\374w\306\177e\3747\306\177\243\376\233\202\377\242\340\277)\376;\374\357\211\377\006\375w\004\377\215\300\177\037\360_\007\374\267\001\377]\300o\315\3746\313o\337~\353\366[\265\337\206\360["
+	.string	"\374\026\377\366\376?\363\037\360\377\230\377b\376\223\370\237\366\337\354\177\331\377#\377\353\376\007 000\360\317p\200?C\206\237\304\227\200{G\341\340t3\223\032r\3633\214\351\377\344\373\t\344\314rj\331A\312\261U>$T\315\235\334\034\234Pv`\322n~\206!\372\031\266\3643\\a\321\263{v/\355\030\224Hz4g\350gha%\257.\003\222\376\016\031*xvO\003\274\367\215\261\267?\375\035>\375S\212=\355\200\234S\354^\366"
+	.string	"\311\r&\007\337\261\242\277C\247o\355\036\n\005\312I\3677"
+	.ascii	"#hQ~\322\3318T,k\217\307\315\347\2345\373\257f2RP`v\330\230W"
+	.ascii	"\n\314\213\221\233\317\270\233&4W\244\334\374\0352}\302yE\001"
+	.ascii	"\242\274\371;H\364\177\272-O\267\223\312\207\271\243\320,+\355"
+	.ascii	"\324\205\311\213\233\277#D\337~\331\023\255\311\311vRA \211i"
+	.ascii	"#\345\360\200\256\251I\t\270\243C\247\245\235kt-\324~\256}k\313"
+	.ascii	"\f-7?\fn\373\257\336\270\210\212\273q\363u\316\350\3534\365\177"
+	.ascii	"\236-\317\263sIM\036\027\216\2131Kdn>\225\210\311X\022\273\371"
+	.ascii	":w\372:s\372?\315\3162\272&\f/7\237d9mE\033\032S\fP\n\226\026"
+	.ascii	"7/\227\247X\bs`avy\212\235I\2340\245\366\376\253g\226\230-n7"
+	.ascii	"_\247K\377\247\327\317$\377\371u\202\325\330\340\203\201\343"
+	.ascii	"f\313g{P\f,\017\212\273~~z\235Gh\324\br\344'\222\377\322\270"
+	.ascii	"R\266\254\t^\027\250\233O#??\217h\254#H\262n\336\320\265<\273"
+	.ascii	".\022\b\346>\262fSMJ\300\235\234\342\300\002Nc\350v\234Cr\304"
+	.ascii	"4\205\231\273\371:P\247\362\344*C\231\224r\024\331\361[&\026"
+	.ascii	"\355\004r\006\261i;\333\312Vu \271"
+	.string	"j\356d\222\203\353\270\320?y\234=~n\375\334:\177\330\275\367\236\332G^<@R\243I\t\270\247\222 \376\323\307\317\037\270\355\342mAsw\363\303\330\262\377\352\345b\007%\353\346\347\224\321\277\375\375\321\215\224\334{G\235\314\235L\272A\177{{Z\013\342\307\261\330\006\340\177\336\373\r@2w\022\227+{o\013Fw\271!Qi\260O\274\275\225r\034A \007\224R\016)\246\263\034P\031\230\316r\354#%!G\031\222;\307\021\323\331\336\031\224\224\216L\300\202b:C\332\031\230\3166\324^a\005\312nf\216\243\255\204\2653l\245\215\264\317\260\2404`R\312\001\305t\206\004\225\201\351,\007\324>\313\261w\266\022R\262\205\322Nf\330g9\274\3543,\250\035\2463,(\246\263\034a\366\253\305\030\0311\374\256\360\220b\341\230\2246\214\027UH\311\035<&&\326\346\333\333\242-\355\344\306\333;"
+	.string	"{Wa%\371\220\244\354[\022\036\214\244&HX\034^$eam%\274#\273\361\230\212`\355]$\351\304~\261\367\336!\0341\361\366\226\305;\322Q\265\235\226\366\276`3\367~\261\367\221\335x{\357\243\275w\232\254b\356mc\207I\371\342\305\336S>/v\325\021\334\322\336\027\255\357\r\212\351,\013\353\007n\311\231r\263`\036Y&'\254\255\334|9\222\372\354\210l;\355\275\355\027\255\204\212\361w\363s\232\234:n\220h\264U\271\3719f\372?\263\316\0349H\324\372\316\253\2379\376\023\353\304\221\272\001b5\271\371\342\331\036\364"
+	.ascii	"\226\007=o\374\374\274\312\313\2751_n\346\340\264bRE\265\202"
+	.ascii	"\013\027\\l\374\244\272X{\243q\321\220\343r\363\007??m\240^O"
+	.ascii	"p\220\251\301\001\356j\307\224\215\323i\\\360\232\244\254p\301"
+	.ascii	"\340\nC\243j\206\335\273yS\234\222d\234JrP~^n\376\317\030g\224"
+	.ascii	"\215?+\262\233\241P\272ds\357\346\347(\365\377\023\306\371\342"
+	.ascii	"l:]\234O\247\223]\236\311\223\351Lf\036\347\022&Kj\267$\277\246"
+	.ascii	"\213\026d\224\027\310\021\340\231<Ylib(H]\224g\362L\332G^B\b"
+	.ascii	"\253\362\327\004\334\233\351\2437\006\215.'?g\353\343\370\351"
+	.ascii	"\343\340\235+\354\031\223-37\037'\355T\372\306\261\321zCC\272"
+	.ascii	"\3718H\364q\264\364q`\350\377\334\331I`N\263\303\316\311\210"
+	.ascii	"\231\3474\177>\223\321\360\374\310Css>\263<h.\363\363l\346-\314"
+	.ascii	"\331\222\233o\226\311d\300\373\343\214\031U\006\374\263\226\274"
+	.ascii	"%\217\271X:\222\254\bs\263\230\r\374\276\220\335|\034$\r&S\345"
+	.ascii	"7\265\025\\\276\3440v\231\301d.\031L\356\222\377r\216\230\373"
+	.ascii	"(\325\352\322\244\004\324\201G\31254\347\277?\373]\034\252\225"
+	.ascii	"\225\225\244\233s\363\347\331\013\346\203\202\233q\363iy\320"
+	.ascii	"\337\224\321\277\341\242Q\313\203b<\333\2032\240/\267e\341\003"
+	.ascii	"A\t\027\245\275g\276o\321R\243rs\326\373y\336\263Q\222\241&\344"
+	.ascii	"f\025\313\025U\357\305\332\215*Vr\236\335#\301\337\2161Mn\266"
+	.ascii	"\231\262=\250\355\262<h\306\373y\256\202#w\004G\363fK$S\231c"
+	.ascii	"\266\030\203\313O\246@PRevcIN\243\262M\346\362\231U\033[~K\252"
+	.ascii	"\321\314sY-7\261\311\262\361t\006\320.K\311Sr]\216\222\351\362"
+	.ascii	"\235]\346\271,w\233&C\301\301[\212\341b'[,\333\203\376\306\212"
+	.ascii	"\223\034\227U\004\313\352\211\223\265\266\354\246\203(\261[\302"
+	.ascii	"lCB\226\327\204\212\244\225\335\374\033\036\3727U\031\355\274"
+	.ascii	"B\307D\356\346\337\300\320LnV\350\333t\321\267\231\323\267Y\242"
+	.ascii	"\377\\\226\311\310\2308\316L"
+	.string	"\n\030\322\030nZ>\245\225\235X\016\273m_^IrX\334\305J\242X\336\224\246\344eN\302\245L\313\321\315`H|\360\230\273\371\353\364R*\241q\363m\276r\322\212\3344b)\251>\231\371h\266\301\270\241\274\201/\256\2247\320\251G\f*\214\006\247\311H#\226\222*\214\274 R\331\006&Kj\265\274\027M\032O\315\253\2345b)\251\306Hr\221\223\224\3567b)\251.\345\375\020\223aC\371d\325\334\233\271\225\2239j\304RRm\312\253\302h\362V\346\301\325\234Q#\377\310]\231+{e#\371HF\222\203d \271H\026\222}\344!\231H\356\221\225v\231\267\262\216g\255\274\343>by+S\345\033\026\017m#Ei0\204\f\f\020pofN\031\220\027\314"
+	.ascii	"\344\333@it\333\036\364x\226\007\275\215\222\376sV\0164\262-"
+	.ascii	"}\314Ld\317\215\313.3\216\214\305\334>\250X^\017)7\277\346\213"
+	.ascii	"~\315\226l\2453\346\005\030\275\233_S%W\331\345\0327E\242\236"
+	.ascii	"\204\334\374\232\266<U\263D\277&L\277F\251_\223\245_cC\3779\n"
+	.ascii	"\352Tr\225\371\335\214\247s\223&I\036\216\233_\003\245_\243\244"
+	.ascii	"\257\216\321W\373\364\325)\331E^\021\027\327\343\254Ef\262\022"
+	.ascii	"\266\227\334\374g\026\317L:A\332\252\350\2709/\331\272\3006;"
+	.ascii	"\271\233\037\346~\377U\2339\037Yw7_\375\322W}\3503-\017\232\217"
+	.ascii	"\244\264\220\374n\276*C\337.\363\016\254A#\344\016\360\346\377"
+	.ascii	"\307\201\347r\263=\340X\211\312\262o\276\312B\377\r\2371\203"
+	.ascii	"D\206\032\237\226c3?\336\202\375p\231\033\233]\345L\352f2c\334"
+	.ascii	"\356\316\334|MF\177\301\315\021KI\325E\326]S\2049;e\030\354\245"
+	.ascii	"\016\020\203\301c\260\030\273\304a\360\237\017so\2450\230\013"
+	.ascii	"nZ\274)\346\216\252\311\232\322\244\004\274rlh\344j\362u\030"
+	.ascii	"}\275\247\257\253\350\0377\273$\221\261\003\bs\271\367\326Q\341"
+	.ascii	"\314\030\231q\363\365\024\2352m\017z@\313\203Z\266\237c-Y\207"
+	.ascii	"\230'\"}\230\217"
+	.string	"K\0313H7\337\2569\301r\230,\251\327\362\316d\301{8\017_\301Xp\025\214\207\255`=\273\304|\230\312\255\026\273\005C\2313s\247E\n \235\215\303dI\315\304\214\f\346\303Q\3124\333\246lY\253\263q\\\224\230\017\333\33183?f\b\037\235\252(^jh\310\327q\372\272\211\2766\323\327H\3645\017}=\245\257\237\364u\013\375\324\214>\232\355A\361\023M\003mi\344\346\247Yp\334s\031\026\016F\2421\305\355\346\247v\372\307p\267\313sF\310\216n\376\361\033nK\002%\013\355f\334v1\033v;n\303M\376\201\b\277Q\302myo$k7\310\261v\203S.\b\222\031\232\237B\321?^\303i\036\252\214\374\270\371 \3404l\004\233Y<\264\f\327v\206\225`4\314\004/\301jv\211\323p\332\335\273f\350\2328\355\246\301Y#\242\266\352\005\027\245\211\323\260\016L\304\342\241]"
+	.ascii	"\316M\211\323\256\330\2752\"j\253J8)8\355z\335$\026ojo\250\020"
+	.ascii	"\340\352\232\224\200{\357\020\034T*\273\252\244\234\214\313\324"
+	.ascii	"5\032-\240n~\312D\177\205y\2015\361\021\033\267T&\341\342\363"
+	.ascii	"R\332,_JL\206\3070\030f\342%\016\303bv\211\223\374\270\013\027"
+	.ascii	"I\202\221$QZ\274(ffv\362S#\372i\016\375T\206~\272\365Q2\332\342"
+	.ascii	"\331\036\324\203\345A\361\020\237\224\313\217\206\231\233\217"
+	.ascii	"\366\351_\034<\232`\255\266\246\260\265-\373$\315I\r\357\330"
+	.ascii	"\302Gl[\270\207\233\017\314\205\177`%\026\202\201\340 v\211\267"
+	.ascii	"\232\324|Y\356\271\355\344\243y\372\250\233\036a{\320\243a\372"
+	.ascii	"\350\021\215s\364\241\215\331\272\371\250\226>v\361\3774QY\322"
+	.ascii	"\202\253\260\025\246\3022\260\024\216\201\243\260\r\214\205o"
+	.string	"\340\031x\n\343\300IL\003C\341\032v\211\257\376{\346\242i\302\242\017m\207\225\271\201\370\311L\323j9\"\243\334\233\271bK\323>\251k\301\327\264Z._X\227\027aS\2320\205e\321\202\2570R\030`3\211\213R\311O\211\2570\2140;%\020|\205\235\302\356\224{3C\330,\030O\276\006\220\217b\351\2434\364Q(}\224I\377D\243\037\305\366\240?\305\350\237]\364O>\3753N\3774\323?\273\364\317,\375\223\206\376\031\245\177\262\320\036X\036\3649\215\306X\266\007\r\301\362\240\267\314\375\023\343U\344\346\347.\372vm\213\213\377z\271an\363~\271`.\231\373w\305\3341v\211\345\352\331'a\201M.cL|0\264\330\270\246\2761'\277\026Z\272<\331&\027\360\216\275\360\271I\247-O4\344\347;\375\374D?\257\351\3472\375\374\245\237\225\372YK?\323\320\317O\372b\331\036t"
+	.ascii	"\226\007\275y8UD\216\250\335\374\274\365\275\273dc_\3152/e\333"
+	.ascii	"\275\273f)\300\214q\335;\373dL\310\224k\345V\271x\227\212]\336"
+	.ascii	"\273\377.o\330\335=\273v#\242\266\332\034\003k\356\275C\324|"
+	.ascii	"\251J\002%\272\357nmd|?\206`\301\242\367|\260\216\306\324L9\345"
+	.ascii	"\260\003<\"\223QD\353]\357\2711\351\253\022w\363\303\334\315"
+	.ascii	"H\333\227\332\315\327\240)\357\317C\247\330\262\375\344\001/"
+	.ascii	"\177MmC\t\225%7?\003,ww\272\n\t\262sK\355\013\357\272J>Z1\005"
+	.ascii	"\315\315\232\212\216\226\027\312\032\371F\0325\367\006u\3633"
+	.ascii	"\230\233\233\323vu^\376\23282\314\204\364\250\273\266[\261\203"
+	.ascii	"y\343f-\005\255\343\352\341\326\274Y\323\241uB\246t\271\272Y"
+	.ascii	"G9\315\224\362\224\320\231\305M\311\361u\3633P\002\007\247\345"
+	.ascii	"4\304y\001\003\264\341kS\322\343\311\265\034\316\033\r\037m:"
+	.ascii	"\356\206y\264\271\3508\355D\375\333\242E)'\211J\311c\253\354"
+	.ascii	"\372\254L\273a\275\233}T\266\237R\267:\033\262&2\275v\355v\335"
+	.ascii	"\366\201\b\367\363:\242\207t\263f{\316\324\024'\315\233\257\233"
+	.ascii	"\324ti\235!\271\371\b\320e4\240\240n\326j\367\273E\374\234\274"
+	.ascii	"\334\254\323.w3\265\007\310C\243\335e\345%\335\254\225\350%v"
+	.ascii	"\371:\315\344L\235\034',\322\352n~\0069\364\355\353\320\024\330"
+	.ascii	"\327\241\332LurC+\307\315O\325\364\250\2247?\003\252$O\242\231"
+	.ascii	">XG\177!\310\035\3755\001q|\314\020\302by\315\324cc\232\340\364"
+	.ascii	"\306\304\354\2324a\201\322JC\327E\207\235L\035\374\230\330N\""
+	.ascii	"7lU\226\260\335\374\f\226\206\f\321_>XG^\0300G\366\327\004\304"
+	.ascii	"bb\342\356\274\256\277\320:\037_NFn\326H\316\245t\214\016*]7"
+	.ascii	"\353#'\021\033%:\332\272n\326Fr\323V\037\030\323\315\272\310"
+	.ascii	"\375\224t\f\251\273Yw\331\270\345\r't7k\"\371\2065\363\246\327"
+	.ascii	"\"\333\300K\266\260\210\215\001\002Dse\240J\036Se\210\220k.,"
+	.ascii	"\200gZ\334\254\203\240u?\236Hui\341\301C\3738\002\003\364\312"
+	.ascii	"\222t\365\246\267\256}$i0\325n\326=\320\272\2335&\201V\250\344"
+	.ascii	"\310\241\265l\331~\362\211\033\002\006\b\030\005\216\311\246"
+	.ascii	"u\\k\245\315\270\264\345\315:+u\273\223\262\205MSi*\215\345\203"
+	.ascii	"u\344\305\203:\250\277&\312\006\246K\251\253\256\261\256n\232"
+	.ascii	"\3548c\343f}\303\306\357\007\234\326\315\007@\231\266\212"
+	.string	"\373\257\242wOg\312\334|"
+	.string	"\b\221\222\3225l\331~r\001\n\f\320\353\006\007\f(zz\352\272\206\312C\357\205\023"
+	.ascii	"\252.\326\305\3223\320\264\244\277\250\314\243LX\337\315z\206"
+	.ascii	"\226A\246\006\026\232\233u\214 -&On>\006\200\332\205v\241\241"
+	.ascii	"\320\320\025yUl:y\r5\267\202"
+	.string	"\307\332\315\017\243\237\376\253g\2252\"v\372I\303\020\303\305$\360f\335\244\235\354\362v\372\305\365\\dU\335|\f\270\350\024l;\364\030\354\225\271\336e4\023\366\323\373\210\271\247\260\216\274x0\267\306\345\rp3M\201H\357\332nh\244k\246k\026\037\210p\271\264,.\266\334\254\227n\267\276,a\272\371ZI\257\370Uu\310\226&in>\006hZ'!\300\252\f\21637\353#\334\334R\0227\225\246y\032\370\2536brKy7\037\003\246N\317<E\363\253v\007\f<+7\037\203$\372O\315\374\352\215\027 4|\334|\f\216\350c\300%FL\n\210*\371\322\227V\251\342\205f\314S\300\004\320\230\373\303:H\3144\351\211\001\003\006e\341\203\205\363\302\244\216x\355=\005\002O\031\343\003\313\315\367\240E\377\177\272\345[\322?[\266\237l\326\232\324\021\300\275\247@\334)&iA\274<\375\343"
+	.string	",\352\354\346\207I\233\377U\027\214Dq\2226\323.U\302\300\311\2709\345bSU\3676\344\346{\300\323\251\337\365qe%\025\345\346{\200\353\353\273iY?\324$\216\246\271\233\357!L\377)_\312w>\001\261\263w\326\330\333NNqp\352\030BD\310\315\367 d\371tI\312$E\263\313t\231\352a\246\251\035E\002\2135l\205\305\207w3\026f\212\264\247Gw\363=\340HK\325\266\254iqK\341,^\017\b\034\241\322lr\316\360\220\304\204\302\262/\275K\343\322:\2137\265\263\225\332"
+	.string	"\233\351]\332\306"
+	.ascii	"0>\274\364J\232\227VI\247\244TR+v\231\336\245N\2362I\321\356"
+	.ascii	"\223\336\245l\266\316\342\365\200\3002Kso\246\016\230$L\244v"
+	.ascii	"r\332\375<$1\241 \226JI\355\3542\255CK\353\322')\235\r\333\027"
+	.ascii	"+`\034B\340\374]\341\243B\363\237\322\245Q\2320y|\2719\235K\247"
+	.ascii	"\244\352V\334|\017G\372O\345\3542\r\343\005g\246C\032\375\016"
+	.ascii	"\200\372\035\264\244o\032K\323\n\213~\207*\372\035\244\350w\220"
+	.ascii	"\323\357\300\246\337\001M\377\251\3329\343L\n\230\273\233\337"
+	.ascii	"\341L_\246\355AAX\03645K\225\350\200\275\355X\273\371\351\331"
+	.ascii	"\177u\005\037T\326n\316e\267\216K\371\342\346\247d9|B\322\310"
+	.ascii	"n~\312\\\013\004S\343\346tL/u8\362\241\306\252\355\212*\354\351"
+	.ascii	"\330\237\006I\305b\bD3\346\346\363\331\036\364\266\370y\032v"
+	.ascii	"\007\2459v\363;d\001y\372\225\002I\3012\031\363\250f\217\255"
+	.ascii	"\212\203\0343W\002\2317PxZGnN\215\244HR\257_U\343\234\362\252"
+	.ascii	"n~\007*\375\364\310\177\265\246\207\225 Fn\276]O\213\374j\272"
+	.ascii	"L*\245\335\374\0164\364\323!)\021\273\270\0267\277\003\f\375"
+	.ascii	"T\371_M\201\026\034_7\247\\z\351\202\300\017j_\231\337\017!O"
+	.ascii	"\271~\253\344.\331\262\353D5\325\345\3464\310\317S!\227\013\255"
+	.ascii	"\256\356f\034\313\203\376\002,[[\251\017\024L\030\273\313A\363"
+	.ascii	"\224\026\306\207\223\035;R\036(\2300\326EI\006\3274\205GVV\252"
+	.ascii	"#37\324\315\030\232\324\212\b\225\233S\035\027\004\271\221b\245"
+	.ascii	"8l\234>J\3525.\265\346\0059tz\225^\2455R.\264\013\236\364/8J"
+	.ascii	"\251\226)UZ\005"
+	.string	"\326\244\004dR\325\224\273\371\034\276\244R\251TZ\303\272\321a\026\\v^:\365\264\306R\256IF\353\277\032\224\363\001x\3639dIg\2443\300\374\322(m\271\371\034\356R\030iT\n#\215\221\306H\237\322\247\024\312\356d\bC\266\244\311\247Px\212\217\256\263\272\261\256\251\0357\237C\234>\0072\375\247N\251\323\3352s\003\261y>\232\224\200SJSl7\237C\022\375\247-\320\300\324\205\215\013\241\356\213C\020}\016V\372OY\244,\256|4\221y\273\371\034Z\350?]\221\256\260u\227\271\223\250\331\r<\343\253)\357\346\373\210I\217\322\244\364(Ez\212\204n\331\235\334{\212\001u-\224{j\n\204\006sc\303\272\371>m\372>Wh\320@4i\322\240[ \270jRz\331\211\235Q\271\371>Q\372\033\322\230\271\031t\353\356\275\2672\215B\267\326\334SS p\310\242\340\351\270\371\033\364"
+	.string	"\311\230@\367BY\247\277\241M\377h\230&\250\030k%o\264\215\024\345\001\235S\223\022p\303\022\375\rK\375\243_\320/v\317\226\355\247\232\026H:b\216X\375\270\371\033\224^\274\3344\026\364R\326Vs'\2478\250\361\361\365\204\354\346o\250\241\177\264K\027\033\227\231\033\n5\353asFJ]\340\315\337\220\244\247\207\372\321qiR\002^%Va\240\266\034\365\313\031\263J+\273\031\325rJ\331!NhZnF\373\212\230\331\223r3\232\345\224\312\201UUj7\243|\247T\316\227\235\225\300\233\321\275s\n\2439#\267\224\372\257\342\210)\367\240\334|\013\264\350\243V,z\345\312\335l\322\202\2529.\315-bJ?n\276\005R\364\335\354U\332\033I"
+	.string	":Za|3n\246B\005\255\242\217"
+	.ascii	"s\224\244\365\250\202w\264\212U\333S@n~\030\025\315R\004\007"
+	.ascii	"\213\233o\301X\224(\350\024\016\2605)\275\2028\355x\262;:\245"
+	.ascii	"f\007\325\321\362\346\207A\353\376\253*\236\0301hu\250\024\034"
+	.ascii	"\005F\335\217\257mc\355\t\035J\227u\334\334\320\262\261w\363"
+	.ascii	"-\360\241\341\340P(z\373\300\335\241J\262\214\274@\345\216B\321"
+	.ascii	"y:\216"
+	.string	",\335\214>\311\351\242\022\344\351f4\316\272%!\203\343f\324\3119#F\f,\256\233\037\346\234\361_\305e\3130c5\334\334P\026(\200\260<\277\020Y\213q\363-pbcCgh\350\262\311:rk\273\371\026\354\2655tkg'u\261R\356\251)\020h\324[\027\271\233\337\323\324h\032\232\206n\341,d\232\224^{j\nD\016\022\224!x7\277\347\212f\302\004\335\322;m\352\266U\325E\261;[\242g\250\222\n\222\026`2\205~\221`\312\017 U7\277gM3\355\022e\242e\025$WP\202\246\271\22328@\311t\216@-=I\261@\201\235\271\371=d\372\350\322\242bKT\f]b\246M\200\276&\245W\317\020\215.o\317\216\017\035$\247\270\310\261R\236\271q\263\327\022\365B\301l\2240\241_L\272l\261\233\237\236~`\335\374\236*\375\243Gn\227\350\221\363\311\311\2647T"
+	.ascii	"x\254\2319\361\341\342\346\3674\351\037%r\"h\021\024\260v\024"
+	.ascii	"\003\272\310\2528\320;Vd\tC\273\354\022\246\331\223\233\231\032"
+	.ascii	"\246\220\300\270\371=G\372G\225\312\234\004M\252MfQ\232d\200"
+	.ascii	"\330%\n\004\025\242\223\324'\203\0034HMZ\327\322\215\251c\020"
+	.ascii	"y\261\342\346k\360\343\201\372\340\201n\241{[&\326SrO%A\364\350"
+	.ascii	"\201n\351#\27365\005\242\206K\f.\253\233\267\254\024\021\242"
+	.ascii	"v\3635\340\351kh\242\177T\313.Q\255\323\t\n\314}\204\356\241"
+	.ascii	"\345\257\025ur7_\303YV\226\255\003\001\001\270\251.\375\2438"
+	.ascii	"\226(\016["
+	.string	"\007b#!\r"
+	.string	"\356)\353\352\312\356\3710"
+	.string	"\256\205\322\312\312\312\3561i\220\242\242\242jR\002jH\326\250\201\333\320\235\242\t\347\324\324\220$%\365\002M\214\030\350\f\275\367>b\356'\027\232\232\224^\250\214\2433\344j\034\241\342\331\002\005\265U\345\351\t\267Y\346~\312\300\215&\245W\334\213\027\270\315\307\206\232\376\321\246%\332\204\323P`\356\243\0338;\2362\375\243-\320\026v\317g\037\375i"
+	.string	"\007\003\f]B\227P\026p\200(\013uHW\226\323\315\347\361\201*\241J^M1+.\312\334|\036\033(\022\212d\315|\230;*5\253\301\323B\377g \272{TPF\277\202,\372\247\031{\242Y\236hl\234M\352%f_\315\235\214\302\301\255Au\244v\363+\200\323\2676\016\375\3172e\306R\245%4\336\304"
+	.string	"\001\321\372\276\270!q\211\021#v\203\247\345\013\327\315\257\340J\377'\030\273<\301\3303 v\266R^\230r'\2478@\201\270\225y\271\371\025$\377\376\354\236e\356'4k\031\205\203sF\223#K7\277\202\245.\315\255\fd\3643\364\351\377\364[\236~v\317\007\353\350O\2031'B\212\004*\322\304\360\3041g\r\036\213\204j\220+\211c\221\220M\220p(\344\300qE\252\220@\n\r\030\205\353P\t7)r%q4\026\217\304\365X\023D4<\346\237"
+	.ascii	"\"\n\215%\210Cd\221x\023D4<j\260\032\205C@k\220\006ED\305\035"
+	.ascii	"\0230\024\213\362O\2108\016\r\t\201\216\310a\211\016\214\210"
+	.ascii	"B\bHaD\034\016! \204\021\202#\214H\321\001\362H,\002\235&\220"
+	.ascii	"\306\022\034\317\017\210B\244\360\346'D\034O \205D)\212\306\242"
+	.ascii	"\"a\360X\004\252\021\"\016\221'\216C\342\220\002\305\026\214"
+	.ascii	"E\n \207B\030\b\260\006\025U\300Q\201,\"\232\200\004\220C\242"
+	.ascii	"#Qhl\3418\354\200\f\2561\f\217(r=\022\255Dh\020qhB\003\t\342"
+	.ascii	"ZT\314Y\221C#\007\220\304\241\221\005\033\022k\260\246\310\350"
+	.ascii	"\205bq\210G\002\310\365\204\f\027 \203G\025\200\220F\025\375"
+	.ascii	"\t\021\035\254AFC@\304a\007\306\243Q\007\026"
+	.string	"\f\r\031\021\211Eb\nC\321x\002Y$\246&\204\353P^\215FE\271\210\b\310\210<\242?!\202X\034\036\215+\nb\021(x,\022\022\300q]\215BkP\260\210\f\006\031\213E\r+\321\260\205\243\020\005 \244\261\006Yc\002r%\001\2044\346\2300Q\\_\020\"\203(\204D\036\025E\305\022r\220?!B\250\250\003\241\" \242\021\005l\210&\356y\f\n\025\335 \203D\241\242\223(T\204\3215\206\3411\037\217\2531(H\230\252(*\002e#\262\b\037G\205\021y\034\n\255\032\bV\020\264\022\205\206C\3024h=\032\345cz!R\030$T$\"\007)\034*\"Z[@\256\307U\003BE\034\202CE\240\"\262h,\n\246(aT\301\261\204\321\316\0219,\021\344\2511\026\221B\240a\0201\205c\321\t\025|\360#b%\032\266`\302\004.@\202\205\023pV\242\261X\3028\214"
+	.ascii	"\216\013\307\"!\225\004\013'\324\324\be@!$\266\020t\342x \302"
+	.ascii	"\270\022\r[(*\026\207\202(\204D\035\236\nV\242\"\n\305\026V\343"
+	.ascii	"\320\204 b\004\204H\241\t'\020\213<\253\261\346G\304M\372\201"
+	.ascii	"\b\344P\004\204\210C\"\243\320\206\004Q\t\304\024\202$X8\301"
+	.ascii	"\002\242\022\210)\364\b\021\207F\341Z\"H\004\024\f\"\302P4\201"
+	.ascii	"X\274\300:$\004\332\021\"\016\207\204@\307`\360\202\022B\342"
+	.ascii	"\004\216EB\032\202+R\030Td\024\334Qq\0029$\\Q8\032\2050\004\031"
+	.ascii	"\205(\350\bW\242\025R\344\220\230\302\t;j\212\241\211\325\310"
+	.ascii	"\202\316q\212\257-@K\030\251A\016\211)\250D+\362\250\202\304"
+	.ascii	"\316QE\032\213,\034\213\204R\233\033\017D \215\302\"\021)\212"
+	.ascii	"C%\\\340I\215+\222hT\004\3329\201\024\"\256C\301 aqH\205\260"
+	.ascii	"(\250SB\030|\001(x\036\217\302!\240 Z4"
+	.string	"|\341\030\274)Z\221\307\340\271S\003\303J\f\342\244X\211\272D0\r\032\006\205\216D\301\364X$\024\\\217FaQ\260\003\030\270\200\004\\\320)2\nO\224\260\223\023\202\210 \221\321\361\005\240\365\004\320\016\222hT,!\250h\202\230\302\206\n\212\304\240!\212\243\016\221\004\013'\344\004I\260p\202z#\202\b\"\243\025P\034s~B\004\020\321\310\330\001\220\211\fj\220\351\b\"\204\216*\250\t\020\261\022\t\215&\202\307\"!\033T\001\"T \207Fa\221F=\370\021\201\\\217&L\024\325\363\347G\004\221\320(,\322\307\240\241uh\"XBh\024\262A\"I\260p\202V7@\204\2418D\201\025\210(D\036\207&\254H\341\220\021\320\220\020(H\202\205\023>\200 \"\310X,\226\200D\215+\221\321\221X,!\347\204\220Q\321x\002y<\nYX\207\202\210B\024\216EB\032\204\212\027@\256/"
+	.ascii	"\tY8\026\t\335\254A\nh@#0\001\025VX\211\204F\n\300\260\256p,"
+	.ascii	"\022\3229\320\320\270\022W!\375\020F@\300\b#R\244\037A\202\007"
+	.ascii	"$x\200~\004\t??$\214\360\243?\302\017\036!B\21084\"\217\032\031"
+	.ascii	"<\272\200\254\2408\334\240\302\210\\\211\326\241\025\271\241"
+	.ascii	"\202\027\216B\025\210\305!\022\210hd\342f\r\246`A\321\221\350"
+	.ascii	"X"
+	.string	"$\224!\230\242X\342\005 \341P\t\013\220\3511x\024\226 as<\026\t\331\254A\026\216EB8\3065h\210\242h,\322k\260f\r*\252p\024\2268\3525\250#44A,\226PD\032\tk\326`\004\216EB8AFB\t\024\221FB]\\\207\206CB\241\024\305\241\022=+\020\261\030D\022\207\305\242\340JT<\021D\256\307\340\261HhC0\b\204\340z4\n\036\213\204v\220?!\242\203\243qE14\006y0\256C\023C$q\r\032\326\034\2037\033@\032\213,\354\254C%\204-\240@\327\340\032TT\001i,\026\325\254AE\242\274\0061\2004\026\213p\216\304\342\020YTLW\244P\003AF\302\022z\215aHb\215aHB#\265\361&H\270\24204\024\266`\\M\2300\222@\n\344\r\212\341\n\264j\300\247F\210\024\232\220\302\230cD\262\220\302\220ph\\\217=/"
+	.string	"\tK\f\r\tKX\207\202\2067\310\027\220D\0309$\246p,\022\302I\261\006\021\207g\212\022F\370\030T\217\306\242\321\270\242G\244Qq%\032\"\365\220\r\362(\274"
+	.ascii	"\362(\034\322\3119\"\203zE\n\221\3073\305\032DLaE\n\215AF\302"
+	.ascii	"\0228kP\205c\221P\206\025)D\222X\205\204\307\343Jt3T,J x\002"
+	.ascii	"\r\221\306\025E\206\240a\361X4\034\032Z\203\025\020\2510tT\001"
+	.ascii	"gH\210$\026c\030\032\213'xN\f\r\035\213E\350J4D\026\031\241C"
+	.ascii	"\302!\222\270\032W\023&\206A<)\206&\202\310\243qh\"XDf@w>8\256"
+	.ascii	"\306\f\264\036\211\301\225h\210T_XW\030\362Z\244\002\031L14\241"
+	.ascii	"\217FH!\362\030L14Q\223B\005\032\004BPC\n\025*\220C\240\342\320"
+	.ascii	"\212\"\030C\320\304\n\264\352\260\200\001\023\206\307b\321\315"
+	.ascii	"q5\342\343\212\034\016\r\255H\341\261\346\250w"
+	.ascii	"N \215E\242\212<\nW\"\f\305\240`\320J\324A \350\240\017\202B"
+	.ascii	"\304a\220p=Q\243\002Hh4\002\002\022\006s\202V\342\320\212\002"
+	.ascii	"\315\t\006Q\b\211\301\024%\214,8\256\0320\026\235\304\023@8h"
+	.ascii	"\210\342\230\217B\302!\023\247\n\344pHhT\202\264H\004\302(\326"
+	.ascii	"\241u\030\2030\017\255D\242\360"
+	.string	"\004Pz\242\004\"#\342y\024\022\016Q`HX\2428$d\363A\320\212\302\270\036W\243Z4A\034\2428\242\307\025\251\242\304\371\023\"V\242!\262\003b\221\210\250\b\304\341\030\\\211\206-\254HaP\320\306(\\U\344\023Hb\221\350T!\f\302G\243Q\361\304y\\\221F\304!Qz\f\"\026\201\326cz\034\016\r\r\211\320cP\210\024\232@,\016\221FCE\022\307\"\241\f\310\237 *\0019$<\217Abq\210\024\002\025/p,\022\302A\n\2070\2618\204O\f\r\341 \020\322\240u-\"aS\302\3155\274X\264\032;@\026\213\306\016l\216A\341J\264\202\020)4\341X$\204#\034\322B\304\342\220\212\f\216@\022\207F)RH\202\310\210\210\246D%\254AF\310!rHX\023\264\256E\307\263\250\030t\"#\203#\374\034\215FE\240`\020\321\250h\024\302Y\211\206\310\214\f~"
+	.string	"\002\22284\322+R\030\224\215\302\023@\371??%h\340\302\n'h \021\307\"\241\016\212\303\016\210C!Q\007@\306c\007\"x\376\253bP%kOh\350.\372\365B\013\244=0eRx\230}\271\331&\261\252\234\376\226mlq6\274\240`NcZ\350\335\034gfUw3\323f\212\211M\214\013V\215\231/\260@?]\003\tJl\307\315\352\236\272\247j\261\311\344\bf[Og"
+	.ascii	"\367\224\fU\213\3327\204\306\2252}j\226@\026I\220\234qWH\037"
+	.ascii	"\224.*_\226Si \321S\273\371\001`\322\277\252w\256\001\221\362"
+	.ascii	"\273\272`\262pm1\241\260\270B\225\267%\355B\362\n\264\202\372"
+	.ascii	"\345|UU\241R\345\246e\255!mI\360\364^Z\240\227-T\264\335\r\223"
+	.ascii	"\222\252\254;]\005\247\355\006\021\036S\320)5Z\\\354\224v\266"
+	.ascii	"\016\225Zaf\255\016\312\214y\243M\212\352\344\022\021R\204\212"
+	.ascii	".\375\303Y\332}\211EAYH\340\317Ik\356\244\303I~\301\362\202r"
+	.ascii	"j\251\361\361e\345K.\005\234\213\362\246v\237p\341\204\351\313"
+	.ascii	"b\021\247\231\316\204l\325\2709\345\342\245D\257y\263\372\246"
+	.ascii	"\276%\367\250l@F\253mWeS\335\256\266\235\251\266epF\307\332\r"
+	.ascii	"tl\254E!\20269\177\250\\\372\226d\326T\027:|XZNj\232+'\314\r"
+	.ascii	"$;\322\322*\235\304\206\236"
+	.string	"\016\264s\211\025\223\324\217\233\317\244\346\231\031K\324\245|\266\205\f\032%jr\n\215\220)gi\f3\324f\212^S\255L\225\361\201\236\362\005\031\272\225\323j\364\310bj9MFN\006\2311$\227K\226\2233bg\022\275#\357\352+\314\207*\226%L\306R\013\023Q\232Z\221D\177\235d2\246 \201\025\271\271\261\265B\357\013\025R\263\204\212!\306\213\231\303\004p\254\006\222\031\270\316\315\b\222#\332\ro,p\313\310\351\344\r\t\027\226\233U!\252\020\265k\213I%r\265\253\212\205rI\035be$\r\351fUy\315\234\301hq\3637\340\242rm`E\377j\220\363\211\027(\245\033\220\024,\311\2247\264\037>\246\230d\204\360\270\352\343W{\250[\371h\310\334\362\346;e{P\001d\375\\\345\221*\3612e\253;T-(d\250\312\324\034W\265~5K\325\341\226d\031\343\346\233\264=h"
+	.ascii	",\017\252\332\370\271\232\243\257\357K\036\016\254\034>\033E"
+	.ascii	"\300\\]\305*\223\2425\007\343f\365\306\317U\233\265:4\\7\363"
+	.ascii	"\250Vj\225\323\226&+\324\032W\253~\325\206J\265\002\260\031x"
+	.ascii	"\363e\262=\350\006\226\007\265Z~\256\326 \263\213S\232R\245\242"
+	.ascii	"\326\372\204\320\270*UF\202\r)\224\222\002o\376\371\271J\303"
+	.ascii	"\216\231!\233\2739*J\225\341\201\335,\226h\331hb1OE\244\324\030"
+	.ascii	"We\354\325\310\240+\333\261\301\234\nC\205\241&}\260\216\274"
+	.ascii	"\200\200S_\340 \263\241>]M\336h\345\001\311*srR\227|\364\016"
+	.ascii	"S\342\324L\353R\2022\302\304\244\272\360\321;L\313E\023\203\265"
+	.ascii	"\320\273R[\\u\201\023F\t\236X\020UIUR\227\340\210\b)\002h#\306"
+	.ascii	"\305\027&u\305\325\245\2741="
+	.string	"\276\rr\200\271\212\004Fo\311P\366^\262e\373)\271\231\252@\344\214\241\023C\343f\365\b\347\352\250\013\311\315\272\214\016T\367\257\242Ye\220^\334\374\r\254\364u\232.cB\370n\326h\364\322\006\311\017\271I\r\360\354\3145\232\333\262*\":\264n\326f~\256\317\324\250\303\361\343f\033\313\203j1\032P\223\371U|U\025\265\344\346k\020\250\257\307|\035)\242\023\325\346\265\367\016\301\306\241HG`\256n\326a\324(\026\\o7\037?e\255x+\303\345\372\217\213\336\263a\372\354$\245}\343F\315\230\323\216\"\200\233\251\n\304\371C\212\330\214\233\265\227t\017K]\331\315\272yR\305\320\322\345Woz\330\335\375\335|\r\316\3645\020\313\222Eo\261;\314$,/\2249\\8`\374i\271\336\342\206\203\257\006\217\233\003\210Z\250T\244\317\325d\244\222$\f\245b\016\005)\312\024sd\333\b\263\025"
+	.string	"@8D\"\217\312\226a{"
+	.string	"\024"
+	.string	"\020^\322\234dN#\253I\320\"\245dF\260!\0204\004"
+	.ascii	"\335\036\003+\2106\275\216\320\277X\220\276\247B4\351\337\234"
+	.ascii	"?\260\343\364\b\315r_\266-c\034\347kcTg\320\220Z\216\326Pn\023"
+	.ascii	"F\355\366\311\017\316'7\037\270"
+	.string	"j\201\336\366\017\375\035\032\002\206\2643b\242<\013\235\013\262\353\201tu\214f\303\210\026v\313\207\343>\346i\031\316\005\260\372\354H\013'\002\263\320R\337@[V\237Q+\032V9\372\3639^;\030\247\037XE\200\217\203\300\020\2731P\277^\330\343Jb\t\203\2636\310+\022\256\345\273\027\022\2218{k\211\214S\223\226\214G\252\306\370\363\0252\245\256[vh\331\005G\304\216\371@\201l\224\360\257\340sv&O\346C\253\370\230\377<\240\214x\023\244\037+\376\247\372Z\201'\"\327\036I\024\356\366\351GpSTw\232\253\001%\331\234\026\353\231(.\003\326\327\tl\341\263c\322\346^\007\2772\220\030Z\273F\267\314z\025\333\252\271^WN\034\256P`\360t\351<\221Y\254\t\252\207p\363\361\310\340^bX\275\211I\216b\303}\200w7\003=l\247\257n\230\001kB\033\335\203\240Ou\322\301"
+	.string	"CLMo0\207\026\217\237\243\227\230\301\377\317gTs\241\245\204\272\211\377S\022U\237"
+	.ascii	"\356f\301\205\3005\351\255\311\374\227\215\003\223\221\001\006"
+	.ascii	";l\215B\233X\213G\311\250\252\224\247\tB\002\265:\"\036g\242"
+	.ascii	"\203l\034Kz_\334\242\363\345\255\310s\373D\035{FF\235\267\256"
+	.ascii	"\007,\240r\355\n\325d\373X<\321^C0\034\330\206\001\016\260\236"
+	.ascii	"B\377\206[dt\225X\340\024\\4\330\304\235O\035\013x\360\251\375"
+	.ascii	"\235&\bu\346\217\215\016A;E\002\272\031\003\025\276E~\232\245"
+	.ascii	"\225\210y\205t\032\022O\354\2373\247\001KG:\367\312\322\034?"
+	.ascii	"\323"
+	.string	"\0279|9\242\265\373Y\023\203\351\302m\303\342L\254*\215 >\211\231\226l=\246\242\214\034\271\030w\3774\244:\335gt\336L\374k\346X\226u0\023m\361\225\250\363\031\374\221\033\360\313K\377\275\232g\256\3501\201\313\370\003\312\301\t$/\021\275\363\024\200\375\007R\3564 \254\374\273\016\254\304\226\311n\b2\277R\201\315\242\013\277g\254!\206\253J\032\246\312)c<y\320\240\325\330\313\300\351\226\341\357DYJ\030R\201V\004\333\t2#\235\022\251\007\313\031\270\354\016=8~J\232s\204NNz]:\204\204\021\375\347\217\200KN\272y)\245\340Q\376|\304\222w\267DF4\366"
+	.ascii	"\366\035\365\305\201\366\025\245\225S\347^\224\312\207?c/\257"
+	.ascii	"\366\335#2v(S\220\020\267\n\257\223\221\325\006\314t\005\223"
+	.ascii	"\265A\352\037\307\332b=l\231\264\235\021\233\321oh\250\205!5"
+	.ascii	"\352i\336\222h\231\016g\tJg$qF\375\002\331\303\004\330S\301\340"
+	.ascii	"\2145\272\227L\271&\003Bs\305\354Iw\020Q\366\350\206\347\016"
+	.ascii	"%\376e\253\212\265\326\367N\313\255\351\203\242K\223\036_\342"
+	.ascii	"\346\216s\233\023_\357#\022\210\241\210au<\004\326\323U\227/"
+	.ascii	"\254\244oa\227b\365\215:^\302\253\367V#S\276\035A$\272^\031`"
+	.ascii	"\223\301\215\034{u\271ZxV\364\244\004mq\243\002'e\313\003\031"
+	.ascii	"\210.\\\214\024\202\b\b\2272}+\005\260\373\b\361p\247\237\224"
+	.ascii	"\017\227\213\243{qO\206L\240\320#\314\307\261]#\363K%\220\265"
+	.ascii	"Q@\246\357x[\t\271/2\246\244\312&1x\241\036\342jX\272\376\224"
+	.ascii	"3 \223\357f\320\217ky\323c%\303\235\373yt\251M\347\nE'\312A("
+	.ascii	"M&H\354\216S\nk\252\232\231\370<\037\321\025\312\004U\023\326"
+	.ascii	"O/-hH\214(P\364\2458m\206\b\256\260CFFsb<m+\244d\352\305\203"
+	.ascii	"q\304\307\274\325Wr\244f\302\235\001plF\227\rc\220\341\256_m"
+	.ascii	"\b\342e\244u\216\030\212\352\361y\266\201-\321\201\013E\b\031"
+	.ascii	"G6v\356<\355\004\245\355,\226\201C\324\222\252-j\204\345\331"
+	.ascii	"\274>\346:\265\246\005\"|e*=\272\274c\t\275\207\237\331\320\213"
+	.ascii	"\3720"
+	.string	"r\356\265\323G=@3\254\230s\210\266\bV\234\315l\334>\357N\263\003e\207\220\356\033\016\245\224\253\200S\241\321\371\254\233A\213\310\224IV\034'\374\211\247\003\023\033\223/+\256H\336'\342T\314u\036\320E\217\016\331\340\202\343d\315\371Y\2754\350\303)?)S\031\207\"\325\267Mm\005Y\204V\321\344ZRf]lf}v\357h\202i\376C|\005\254\315\235;\232zG\335\220\006\201{\342\246\004\"\037`\200BD\024\343\203|\276Z\272\031\2728\022\002\245\332\354\364K\252\242$\337\3161)v}\351\234\034\276^]\325\246@=$?\313\312\374'\377\231\3779\370\330lV\243\3301\323on#\276\355\244gR\231\237\315#k\267Y\352a\327\034\3403\231\235<\262\033\347\362\246\352\210\206N|\325Z\241\250V\270\324\225\361\034\230l\341R\204\355\332\004\254\245\021\202\224\233\327\202\033d;\032\230\304"
+	.string	"i\371q\fo\363\0059\346f\310r\337G\240\277\035\231\214\347\336\\Bs\355\212\031\344\245\215u\210\371\344(\257\331+\350)\316C\332\365\204d\304\213Z?'/\330N\3530v\250:\262\255\007\333\013/>\022\317Oiu\351J%&v"
+	.string	"\004\335;\227e\351\201\345\030\2544\023\021q)\331{\333\352\272Vp>\210`\213\017\030\235V\366\030B\342-\364\352\037\327t\364\216\030\3035\275\211l(>+\333\351\272g\235\362A\216\325nq5\272\f1\344|\210={?\331!s\317\304\352f\355\211\214\003P\027\344\231\251\207d/\274\b\b#\252<\330a\225\021\356(\2763\267A1\267\bP\346'\365\370\345U}\341\006T\035\205\003\306\251\226\300\027Ns\345\352p%\"\241\327\303N\221|@\326\321P6\335\016X\301I2}\325\f\242\200\203e\034\224ZD8\232KF\235\333\030\342^N\251\272\262\322\340\366L\215it\202\273\344il\246\024\234\356\234f.\351\322\275\3645\020\374\001\211\306\371\372f\343\027\031\315\336\"p\372\007P\343\016B\021\266\261\033*\313r\177\274\364\201\371\b}2\330\353=\240b\251\301\310\215\241\222t\030\271\255\221JZ#"
+	.ascii	"\235 lb\234\355\346\034\222\2609z\233P-I+\326q\003l\0062\342"
+	.ascii	".\230\317\232\362\256\337a\355\225\t\270\034\2710\360\301\220"
+	.ascii	"L2\311Y\314y\255\223\366nJ\267\252\200\252\371\222\030\334\235"
+	.ascii	"R\0376\3055\341\274#\332\224>\277\356R\233\332\236\364\375\351"
+	.ascii	"\021,aB\221\265\210\377.:.$\"\374U:\201\036\305\370;mR8\300\b"
+	.ascii	"\311G\304\020\020\037F\332i\031\315KBBY\325\350\006\316\376)"
+	.ascii	"\341\2240\275\305(\001\377\033N\335\243\016\234\020\241\205\270"
+	.ascii	"\356 \002r\212\212C\262:\016\356\314h\301\026\257X\334\213\215"
+	.ascii	"]\001\204\016\"}a\005\246\002G~\f\034\005\261A\252`-\211H\036"
+	.ascii	"\253\205\340\341B\226\026\212\246\241Q\027\006_\204c\033\"pp"
+	.ascii	"2\312\305@\313p\205\351\2308\026C\244!\033\334\030\346\351\244"
+	.ascii	"\007w>j\315\3128\334\363w+\247\3645+\027\336I\247\314\"r!\373"
+	.ascii	"Iq\343\322a\335Vi\035\r\031\345T\t}\034\201\250,\224\357\022"
+	.ascii	"\212\331\230=\372)O\214K\373\306ow\242\022\032J.{l\025b62\346"
+	.ascii	"\267&\270\361^\f<\017|\273_+\350C\316vF\002\260\233\363\211h"
+	.ascii	"\234\230\263\214\307j\254\261\346#\257*\235\223~\243^\311\356"
+	.ascii	"N'\275\0068\250\377\316\3611\274?\0225C\\\377\205\240;\300\213"
+	.ascii	"\201D\227\320\300\017K\345\236<e\333\2613\207 \221\036\276\n"
+	.ascii	"d\3476\236\305\265{\310\2413\0268\302\202\247\242\006\347\346"
+	.ascii	"\205v\202\336h\2071\346\333Z\335Xk\215\242\203\362\222>\317\217"
+	.ascii	"\202-$)\201\320U\331\034\223\013\373\035Q\260\324\246\346k=\020"
+	.ascii	"\325\330\206\266\255\273\210f7C|j\337\224\233\313\322=\330\374"
+	.ascii	"\232k\027\007\264\273\222\325\363^;6V\016\334z\267\t\217\006"
+	.ascii	"s\362\210\r"
+	.string	"\234\340\032Yh\236bv\343}\017\325\253\242\305+\304'i{!\n\366`\2602-\321R\3157\356\"\347\n\315\203\252\037+\277v\3615\017{\205\301gL3\220\364b\243\221\314\f\323\375\255S\352s\207\335\202\002\201f C\027.d\004{\237\032\211\006\331\035\237M\371\002\024\021\237\245\034?\337\271\361\3613VDU\375:[\363+\372\025\301\332\252\363ai\271\325HOD\01787\br\213\t\342\320\311\265,\t\023\025\240\\\377\r\017l\337\237\035P\3746\375\240\317J\031\351\317\272K'\203NG\365Zq5<UP\255\017\371\231\263\n,A$\017=w$[\001\0328Y\217\235\030HA\303}W.@\234\210\007Y\322\030\031][\266\254\341C:|\206I\337\362\235\276\333EI\220TmghU\211\n\351\245ESr\230\334\006\256\316\261\262\364\024f\367\274k1G\03159v\360\302\342\343\"\263"
+	.ascii	"\020,\314i[\252=)\021Z2\3703\214\371L\272\2148\374\232v\241\\"
+	.ascii	"\360\224V\207\0069\024\333A2\204X\030\035Fr\272\310\252\326\344"
+	.ascii	"\356\205\320\221\215\304\007"
+	.ascii	"\262\275\314\233\"\255\310\324\356TZ\215\352\017g\020\211\t\354"
+	.ascii	"\t\200\023\217\253\327\220\337UL\253\t\352\210\030\206R\032\326"
+	.ascii	"n\024\252\345\001\021\226\357\301\335P\316\226\237\276\334\322"
+	.ascii	"\201YR\204\rVw\331h\315\305\bO\271\275\004/\254\005\007\210\245"
+	.ascii	"\211\301\245\346\372\300\202\024\233\210K\316\270\226\023\242"
+	.ascii	"\250)\233B\261&\343\245hg\254R4J\331t\fa\361\370+\310\374\b~"
+	.ascii	"\203\037\005&\317s\364\371GT\210\030\321\314\314p\260\261\266"
+	.ascii	":YOt\351\022dF\331\031\267\271Q\3715\215\352\243|*\376\322\267"
+	.ascii	"p\243\r\264\375\265h\207e3\032m\2256>H\367\np\317\362\366\343"
+	.ascii	"\235\3712G\337\202\233\305g\313\355\350\022>\023\205\217\021"
+	.ascii	"^\200\224\243\001\016\007\021\026\351\233\366\320|\353ix\342"
+	.ascii	"\"\311XD\241\324b\362s\212\353\263B\354v\317\024&\232\330\202"
+	.ascii	"\263\303\235\372\370\373@K\244r\032\333$\020\266;b\022\344\""
+	.ascii	"\302?\347\273\366\334\250l\254\300\036n\326\264"
+	.string	"\221^\222\234T\252\235\220\007\211\305i`,b\324\361\026\272x\321w\001\036\305{\221\004\332\304]\002\264k\206\277j\b\r\271\"\013\243\247\265\207\223\31024\327\300\320\261\373\370\377J\204\033^\327\335y\306\006m\033:\371\262\331YB\025\304\020\370\210\354~\373I\332\240\266\375\306\177w:)\246\004\313\353\f\323d\276R\002w\212Qd{\320*\237\262\026\233\256B\367c\334\316Fq6|1\250\266\342G\336\273\f\003ad\340\023\024\376\205\271\3240^\205\327\006\344\017;\321\346\375\225\215\202\233J\201k\033y\254\210\361]\222S\343\036!\272\002\234\216\020N\336\020Y\007g?\006\305*\365\340n\307E\343\031\n\207!\212\206\022\346\263\002\325\030\023S\336\035+s\265\353\225\236\327\001\006P\211\3453\0040\356\3051\rbq\372$X\027$AoZ@\255W\210\217\313R\235\232\240F\356\376\263\222$\213\021~$"
+	.string	"\036\0359\314\204i>0\272V\312\371AY\260\n\346\257](\374q\021w4*\356E\"\224\205\356o\316&\266E\237mk\325\036\016C\230\352\326\023#\253\262@ \021h\316:\210\237'\025\022\256_H\341\367cALF\260Q Y@&\333w\022C\270\027;%\301\006\213\321\265\022\3154zd9\027\022;i\335\003\351\007\265\362N\002\004JDDqM\021\3707\026"
+	.ascii	"\203\007\004\204\031J\346\\\232\334\205\364\n\251\210\334\353"
+	.ascii	"\201\211\260\333\331\231\233\266\276\326a\206>\243\311\274\250"
+	.ascii	"\037\017\226\375E\365?df\035\277\267\240\272]<G\365\\\264>*"
+	.string	"\313\236\263L\326\225\352<\026\355{\301\201\230J\325 ,{\326\005\324\326\250\273\213\303\227\277\242$\242\276\337X\005m\005\264\312u\004R\035\226\317\333\310;6P\003\006$\004A\374\322\327\201]\212\007\337;o\354\013i\033\3457\250\343\207d=\274'\2729\377\234\363+\272\243u\025\027qi\212?\332\231\247\200\271\373`\2560\352\002\032\002m\252\033\177\256\204\201\336\250[#B\f\370s\233x\013\201\035\301\340F\244\333\246\304\021\374\201\3013\312m\013\376\323\272\347\225\2700\316L\216\335\337\301+P<\270\205\346tp\005\016\325\323\334\316\214\263\363\334\"\305)\261\177JTM9\013\203a\271\214q\273\031\f\203/\334\007\327\237\034[\361\177\263\340\336\211{eo\306\007k\232\232\323\025\027\352\336\001\303O7\313\314\200|\t\364\262\327\"\023I$V\006\354\374N~\305[\224\203\323]o\037?14\264\266_\213\033"
+	.ascii	"y\317\222\307>u'\201\236\005\211\302\333\023\"P\003&m\331*\345"
+	.ascii	"\3704s\026\240u}\276\372\203k\274p#\372\242\334;\331\366\255"
+	.ascii	"D\305\240\"$[\343\232:\027\301\002\002\017\203\210\314\237V\377"
+	.ascii	"\0023\232\317\306/Y\025\024$V\231\024oC\376\270M\310\037$\257"
+	.ascii	"G\213\242z\256\316\377\363\031\360\0248t\003\244\246V,\263U\215"
+	.ascii	"\254A=N\230\027\237\020s\025\323\217:\214\372x\303\rE-\310\020"
+	.ascii	"@*\035\257\340\001\205\033,uh6\214d\317\210\277\374Qx\337\023"
+	.ascii	"\367g\224\330\273+\2571\213\374\221\236\217J\264\350\212\207"
+	.ascii	"1b\337\306\2265\335K\245\374\256\370\317J_]\316_\225\276\226"
+	.ascii	"\220\337\310N\215|m\266\021ov\007m\220\314\261#\303\312\243\\"
+	.ascii	"\177\261A<p\361a\2738\305\374\202m}o\032W\246iG\023\207\344\332"
+	.ascii	"\223$\350\215\\\335\361\320\255\323\3118y\031\273 \033\316f\022"
+	.ascii	"Q\376\345\354\327\021}zsw\243?\013\314.\377\263\262\346m\354"
+	.ascii	"\\\307\321FB;8\257SR\365\334\265}\021\3338_\"\376\030\250\211"
+	.ascii	"\235\013\271\371a\341\202n\374\267|\007L\314\020P\216of\253F"
+	.ascii	"\177\230\337F\\Dd\250\025L7\247\216\362W\271\227K\227\244\362"
+	.ascii	"Pr\201\366/\227\377B\306\365\ncS\227\323\356qj8\337BgJu\377\272"
+	.ascii	"=\322\374\321\363\177)\377\312\232\202\253\337\215\237\003!\256"
+	.ascii	"R>\200\3778\363\252\366U%\373\263\305\316\231^\3030s\242\364"
+	.ascii	"N\373U\2433M<\032\327\352Kvj)\030La\317%\375^\325WI\340F\251"
+	.ascii	"}\013\276\375\260\366ca\357\332\332\017\323\377\273\233\240\376"
+	.ascii	"E\311\336\246\215\235\335q^\304}\033Ff\343\006\255\206\354`\036"
+	.ascii	"8\343]Sw\307\310?EV&\326\272\376\007\264\275\214\305{\301\264"
+	.ascii	"\352\200v\272\317\2667$\272k\323\003@\266\027\352n\372@C\253"
+	.ascii	"N\3212\212(\367\007\355\2758\347\360\274&\226R9\206\345\237\343"
+	.ascii	"\2472\223\245v\202\272\317PY\017+\037\301\232\037@mN\355mqq["
+	.ascii	"\026\310\214\200\032\006\270L\316,?\3018\274V\017\256\376\273"
+	.ascii	"k\333{\332\207\303?\376s\310\351\353snA$\315\236\347}\205\343"
+	.ascii	"g\242\335\013\232vm\365^\254\267\033\331p\304\265\274\320yh\034"
+	.ascii	"\\\3077\327\323\354\255\232\035\341\370gn\340\373\307\215\026"
+	.ascii	"\317\\\257\266v\217h\313\212L\265\270\017k\016\301Qhv\335\261"
+	.ascii	"\007\016\243t\355{\344\024\030=\267p\033\202O\234\361\276\236"
+	.ascii	"S\312\337\300\324\003\264\210\227`\367\036\374\031H\027\226\247"
+	.ascii	"\350\367\267\035Z\344\345\261\036:)\375S\356\204\220\277x\204"
+	.ascii	"\363.\342\333L\203s\tes\334\337>\217h\336\013\224_b\363\224N"
+	.ascii	"\304\217\277G|\247{\340mz\376\203\272\246\360\231\247\256\224"
+	.ascii	"\3434\305\364\307?\230\267\320|\360\221\231\257\267\334\317\t"
+	.ascii	"\202\361\211\255\211\262H\267\026\357so@\347\301\242\236w9~\017"
+	.ascii	"rnw\276\372\307v\177\2541(\266F\333\350\203\035\315\220\272\305"
+	.ascii	"^\336;<\371bRw\207|\236N,,\277W\276a\346\363\375\007"
+	.text
+	.section	.gnu.lto_.symtab.6375a6750043fd8,"e",@progbits
+	.string	"GPS_numCh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"GPS_svInfoReceivedCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"gpsPacketLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"GPS_packetCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"gpsData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"gpsInitNmea"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"gpsInitUblox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"gpsInitHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"gpsNewFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"gpsIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"GPS_calc_longitude_scaling"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"GPS_scaleLonDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"GPS_distance_cm_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"GPS_verticalSpeedInCmS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"GPS_reset_home_position"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"GPS_calculateDistanceAndDirectionToHome"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"onGpsNewData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"dTnav"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.string	"nav_takeoff_bearing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\004"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\004"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \004"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\004"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\004"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\004"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\004"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\004"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\004"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\004"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6375a6750043fd8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,494 @@
+	.file	"pidaudio.c"
+	.section	.gnu.lto_.profile.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 s\225\002"
+	.string	"\344\003g"
+	.string	"\t"
+	.string	"\266\317\357\244\017\n\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\367\227\233\370\005\003\262\374\202\245\005"
+	.string	"\004\005\006\354\206\342\366\006\002\007\256\330\276\211\r\b\316\211\235\213\003\006\002\003\t\352\263\360\321\b"
+	.string	"\007"
+	.ascii	"\271=.]\262Z\006\360\2452(;\2766\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 =e\001"
+	.string	"\3401"
+	.string	"\007"
+	.string	""
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\001"
+	.string	"\001\004\005\006"
+	.string	"\003\007\001\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"7\003\377<\002vQ\254\001Co"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"E\004"
+	.string	"\362\306\026!\240'\351\340\377\372\217\255/\336K|j!Y\235M\210\rp@\340"
+	.string	"|#g^|\322\032\331r\247\277\375\203C\334$\262\2000\017\031\017\207\204\031\220\016\244\263(\350?`\211\266\212\347\233:\364\335,\373\005\264o\226\362\023\022\247\303\266]^\261\321\266\300\277\207\253\255\341\323\246\002\021"
+	.string	")\016I3"
+	.ascii	"\200\006\004\347(y\003\206(\206` \b\310\016\200\230\246\3206"
+	.ascii	"\006\376'\004I\323\335\256\006\205\251\360\n0\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"5\003"
+	.string	"2E\020\033\300%\215\001\203\327EC\207\370\377\373\354\377\301\027\004\203\304\033 {\023)eJ\001\352\207Jy0\252,\256\216=\321\241\022\352\251\346\207\272\360\204\215\261di\r\243Tpy>\344\207V\200J<\020\r"
+	.ascii	"QI\031\027\006l\302\227\230F\023\307@\201\201\252\016\320\234"
+	.ascii	"\253y\231\315m5\233\024S\337\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\006\204\004\007"
+	.ascii	"\230\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 \204=\002"
+	.string	"\204\002x"
+	.string	"\007"
+	.string	"\002\002\004"
+	.string	"\001\002\004\001"
+	.string	"\002\006"
+	.string	"\001\002\007\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006\001\007"
+	.string	"\b\b"
+	.string	"\001\002\b\001"
+	.string	""
+	.string	"\r"
+	.ascii	"-\274f\216\273i\001\034\342llE\267\022\030 \r\220\006\250\005"
+	.ascii	"\001@h\033h\003"
+	.text
+	.section	.gnu.lto_.lto.f671785b6834251d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidAudioInit.22.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 \315u\005"
+	.string	"\"J%+\200k:\300Tpl&\222E\r\361P\273R\275)D\274#!\016\232\327\205k\375A\372\031\200\251\300\033\243\267\032 D\233\225[\246\277\252J1\207\205\321lV:\027\324R\314Kc\314\252\360\232%\264\331\250U\233\223\330\313\240\024\216\022\356\316\362\207D\344z\2474c\307\334/r\222/\377\002\232\301\237\247\016\365\351\256\214D=J\234\314\377\235\276\375 \302d\340\241lB\335=\031\263\333\312\355\273\341\n\274\217[\031@t\367\245\367Y\366\274\377\r\377\017\377\037\001\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStart.23.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@+\260v\203A\004\031L.\b$v\031\344\224\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!E\032-\354\235\345O\251\310\375n\030\215\036w\277\330I\336\374\033h\016\177.p\016\241\356L"
+	.string	"@\217\224\310\363\177\253s\277\tq!\2240\240SwO\356,\267\222\373\356g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioStop.24.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 \315\225\005"
+	.string	"\"J&/`e\323\001@cX\030\007\217\200\350\320\037\"\244&\f\300\223\031\366'\274\002\020\335YU<\244BQ\314\020(\265j\356OL7\220$\312-S\307\254J3\311\225QmV:\037\364rLl\203L+\361\2525\266\031\251u\233\225\330\313!%\032-\354\235\345O\251\310\375n\b\215\036w\277\330I\336\374\033h\016\177.\230\016\245\356L"
+	.string	"@\217\024\250\363\177\253s?\tq!\2140\237SwO\346,\267\222\373\256g\007\037\330\255\0240\272\373\362\0035{\336\377\212\377\213\377\223\b"
+	.ascii	"3\003f:\343)\334\341\232\270\nA\274\f\021.\307\242\235d"
+	.text
+	.section	.gnu.lto_pidAudioGetMode.25.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 \357\215\006"
+	.string	"\222\314-2pM\322\001\260\006\200\325?@\3331\312 \350\202M\255\002\314X\252m\315n;['\242\323\244\203\266\374\257^\377B\027X\362{V\305\027K6\2212\245\276P\317a\",\030\227i\3175\007gih\227\352\241Q\006~\031\206\252A\274W5)\356\325\223:ut\302~\310#\3649,\241\311[g\276&:K\r\300\350\344\307\216\234\324\f\373\320\252\307v:U`\244\300d\267\342\263\262(\254\244\303\366\306\226|\217\177l\f\241\270q-\250P\210\244\354\3066\235 :\203>\020\235\251\306\341\023\372\007\371\001\311\211uq\236"
+	.string	"\n\273\353\264.\213[o\033\301v\202\355\213\b"
+	.ascii	"2\003\316:#e\b\3055Q5\002_!\262pW:\355$\003"
+	.text
+	.section	.gnu.lto_pidAudioSetMode.26.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"]\007"
+	.string	"\262\21644`o\032\003\027\022\302\016\001\231h\243\226d\347\020\336\004\004W[\221\316L#\253\203\313nO\036\342C\311J2`\022q\205\302\333\364\243YK\232l\271\245L)\237k\202\252z8\023\273$:\027\026\222\023\223\017X\007$=\031\204\344\030t\206>\231\214\2303\223\033\356\256\016Ou\310H\225 E\037\254O\2142\252A:!z\336\034k\221\345\0309RF6J\257k9\322\203\036\255\253\377/<\265F\331\257b\320 \350\376\213\016\346\251\330\022\262i\353\327\232\304%\232Q\243j\376\216\025\226\237[h\002\200\343\201\007,\307\312\002\226c\265\326\245\240\" \306B\345\345\277\204\037\326\374\264\332&\326l&\222_\246\341\177\337f\302p\241\333\"\264Uh+\022\b"
+	.ascii	"2\241u/pq\241\020\f\271\004K\254\246\204;\274h'\031"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.27.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375`\375\001\035\021"
+	.string	"\006^lH"
+	.string	"\257(\035"
+	.string	"\210U\241\277\257CXQ!\342\241\231op>\3262h\004\255~_\343\242D\237B\235[\277|\370\266\337NU\221i\007\r\356==\374\327]\372\\\025:\205\355\343j\263\342\006\353z\307'\204\020\"eJ\001Y"
+	.string	"V"
+	.string	"S"
+	.string	"\250{\300\317\353\270U\224\2771\246\356\271\252\345\240\207\027\354\264\033X\361j\321\217\302=\362\003f\264F\226w/\377\017+\235\022#\3139\320\030\201\343\230s~F\226.' \347\345\005hL\341\024\304n&\234vU\031W\252\337\307\234\323\332\032%\334\033\267\355b\233\201\255\b\002\266\230\313\213kY\220s\245\006\215\211\323\241\330\360\331o\337\017\361\362\3442\276\t\025'\366A\234\264?F\271\214\327\206\306\366\316F\261?\357\3644\177\354\321"
+	.string	"\365\331\211#E\316\025\017X\213\231mNr\301;'"
+	.ascii	"\337\031e\3038\t3_\252\244\210\260\3159\303\305\3605\334\312"
+	.ascii	"\374\223\007n\001\227\216\332\310\310\261\260+\003\367\373\240"
+	.ascii	"t\301\322\035\3733\037q\36238D\324\267D\357\335\367\033gn0\225"
+	.ascii	"\326\360\247\007N\342\331%&\372\026\270\247\335\303\241C\315"
+	.ascii	"\255\306\332\224M\256te\366\271\271\027\354\317n\360j\275\372"
+	.ascii	"\001@\001#S\310\344\300d$\002Z\324!\222@JB \244\221P$\205\"\244"
+	.ascii	"PH(*\221\204\035\004,\216\214J\241I\024K\341\207T\375C\265+\217"
+	.ascii	"E\273\251\n\340\312|\022\327\023\272;\246\210\371VF\023\343\212"
+	.ascii	"\021\243y\344\210|w\203\323\001P\277$A\320\267\374\362\235\206"
+	.ascii	"\327\255\266\332\324avj\001/ P\002!\223\260\035\222\200`\370"
+	.ascii	"\315\260\225@\231\367M@\330\325\035lK\033\250j\002\203\013\347"
+	.ascii	"\232[pw\347\363\206\327C}\016\0342]e\243\325\276\027|\0304\345"
+	.ascii	"\230\344\023\303&\205H|\267\272[\364\232`;l\320~\"8\217\035\n"
+	.ascii	"[$\rj,c\341#\203\340\202\033\314\247\334t>\326 3\236\356\271"
+	.ascii	"\274\fq\016_\227z\355\204\002"
+	.text
+	.section	.gnu.lto_pidAudioUpdate.part.0.37.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375`\316\b\335'"
+	.string	"\232E\320\016G\220XN:\301\365t\245>\376\020\356\005\341L\342g\314\032\036\033\207\236\322\246\202\240CC\271\243\243?\253\376\217M\301Y\034\231\024<I\023\312\214k\025H^"
+	.string	":\240\316\364\256\023\n\352)9\2761\333\226\020\"wJ\001\327"
+	.string	"\315"
+	.string	"\322"
+	.ascii	"b\265V\n\024lL\314\351\305\022\346\t\271*\325T\330\243"
+	.string	"<\275X\202\002\247h1\250\025\201\236\344\335\247<9\236\247\004\263\277\345\344O\232\276\304\207b\326\344\177\235\211\275\263\211/\361\216\205\355L\230\364\267\234|%\367\362.\t\022\024Lr\264 \323\345\007\020\234\316u\302S\\'h\005\222k\222#\213\214\003z\362I\274;\351\007\020\236\216\004\005\017\310U_<\250Z;\242\246V.\241\223N@O\336\210m\247)?\331n\347\302\252\367\222J\361\245\246\326\332;\271;\376\364\\I\216;\351\223\237#\002>7\211T4^\262}Z\265!\323>\255\300\306\217},R#\013\221j\3067J\030,sj\2558T\303q\356\234\346\210j\255>T\325\255\273m)\333\031l\332%~\226\177!\346\211!\312\223\337{}\216\225iUA\315\270\271W^\372\261\256\016[7\035t\300\200n\032H7]\340k\367\017\235&\360\266\333\207N\367\320i\036:\275C\247u\350t\316"
+	.string	"\335\264"
+	.string	"\335t\200\243\335"
+	.ascii	"\350\364\356\\n\034:\255{\327Mu\3239\335ty\261\233\244\323\343"
+	.ascii	"\313\356\245\32337}\004:\022\316j}\021\347\246\342 \245\374\270"
+	.ascii	"\222\277\353\027\373\313~*?\332\317\345\327\362\257\375m\177"
+	.ascii	"\230\357\354"
+	.string	"\373^\016\306\027s\267\266(\027av8Qc[\373\362%\f\203\032\226g\361\267\274\013\227'Z~\210]IC;;\333\272@\257@\271\024\237\354f\336\225eUqQ*\350\304\002\245\342T\247\230\214'\314\251\302\253\036\001\333\340K\2678\033\024\326\302\305\307\rM\026\276\243\301\222\322\355\273|\334\332\222\205\315\357u\034&m\306\334\322\235d=S\350\025\366\355&+\205^\256\275\201\303<1\267c\255Z\240\311-\327\250FY\n\270q\311\375\330y\324\206i\305\263\361\216\260V(\004\273\343\016\235\031\276\005g\234\347\356\006}\r\325\330\035f\224\213\207\303\252\265F\260\315`\n}?\263Vk\235p\322\023j\006\217\374\254\223\376\220\224T\236\234{\263\217[]gk\222\034\315\3134-\300\371\306\373\357^\331q\236u\341\300\332\370n&\033\034H\200T\034UA\032_\215\335\350\017\242DC\261\352\224'\261\006\177"
+	.string	"\371\233\305\230\325\n\374\r\373fl;MbU\300\213\232p\366\311\274\f\210\033\214D4\025!\375\226\350\206#\337\364\340\233F\"\232\212\220~K\271\244\021JLc\022\323\021S\221\211\244\021\324\037\032(\375\220\232\216\220~K=\245_o\304\357HD\357\003\211\022\275\006@VZJ\"\321cRR\"\321\233'\202\332`n\257|\266\217Z^H\003\243\326p\034\240\303\"\342c\3512\r\2112y?Q\036X)\373g\006\255]\244a\236h\236p\201>\260A\013l\214I\001g\346&\032K\2405P"
+	.string	"\350g\013\254\221U\032\002\373\263g\363Y\002[!l\370\026\254c\317\372l\2023C!<\253\263=;\0246\274\261\263<;\204F\303\305\375\232\341\233nd\354\354~\361\310Y\235U\320\026\303\305\251\266\006\3037\321\250r\366n\037\255\004\361\002\327\204\006)`\007\314\025\237*.\364"
+	.string	"\002"
+	.string	"l\2005\262j\262["
+	.string	"\3734\234\335\005\200\254\250aL\246\224R4#\"I\n\n\222\306\360\002\221)\342\034\022`59L\033\207f(\230 \n\212\213K\3526A\034\241\365:QI\322\246J\bA\200\375\216z\023\301I\256 \244\211\002\016\306*\201C\204\300zJ;\n&\032\350o`\250\336\301\346\0136^g\261\350\207\271\263\016j\336\022AD \"U\325\323\031p\350\"9K\342\313\237?\250\326F{h\202\326z$CT\342\367&?O!\260.\346\224I\210:\264P\241E\002v\355\036\246\t0\254\260\027dB\020\370\214\367\027\371\357\205\351~\033!\237F%\177\274s\023H\342\bD\030\370!\331\340"
+	.ascii	"\343Lq\221\006\211\2304u\027n\231~\204\377C\202\376o\320\333"
+	.ascii	"\242\220Si\300Z\336;\233I\267\"8\356\"V\206x\"\276\246?\334\353"
+	.ascii	"\210\254\343\202\017E\n\210\307xG<\340@\261h\255\240\f\357\213"
+	.ascii	"e\322\002\267hP&\265%\372\354w\215fR\302\352\3700V\261w\t\203"
+	.ascii	"\260ed\210\252\001\330\037\353l|\254\f/\240\315\377\301\032F"
+	.ascii	"\033p\344gQ\244\2021\260\027.0\352\305\210R-5\225\007\214\340"
+	.ascii	"`\353\214n\224\361\f\225\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"m\006"
+	.string	"b\t#*\200I\035\\*fR\351\203\255*\r\0234L\007\257\355<\00330\003[\206\200\031\360\017\230\221\r\003\314\310\266-\356&\267L\001\177$*+\231\213\343\320\352XA\253\242\352C\203\241P\026T\315\375\234\375\324\231v\237\310\022U\243\3575J_\216\273\215\023\032#2>`\274\320\356\376\273\315\200\025zaS\300\206"
+	.string	"\027,&T\314Q\274I\260#\023kR\362\346\376\032v\224\315\377^\203`\b\371\371\2374\324\351\356\0060C\376WK\033"
+	.ascii	".#\201\202[\204l\255\324\300\022\330\027,qY\335\263\206\001\352"
+	.ascii	"\001\300\001\300\001\300\341\003\344\363K\225F0<\277\221\031"
+	.ascii	"\034\240\035\370\034\370\034\370\276\223\260p\243\b\001i\352"
+	.ascii	"\310&\230e"
+	.text
+	.section	.gnu.lto_.refs.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"\002\f"
+	.string	""
+	.string	"\002\024"
+	.string	""
+	.string	"\002\026"
+	.string	"\001\006"
+	.string	"\001\001"
+	.string	"\001\007\001\001\001"
+	.string	"\003\b"
+	.string	"\t\002"
+	.string	"\001\t\007"
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f671785b6834251d,"e",@progbits
+	.string	"(\265/\375`t\013%="
+	.string	"zj\204\027DP\236N\007wL\304;_3\376\234\347\350\3709>\306\263\023\tq\364\352\262`\031~\342\333=\204A\001x!\374\300\006\250\274\251A"
+	.string	"@\f\b\261H\354\005\020\2023\023/\240\201\325\347\032]\351\256\335dJ\001A\001Y\001l\0019\211\337\215;\254\266T\376\342c<\214\213q0\376\372\235\323\265\327\271\227V\337\177\247\226\27148.=\374m\013ZS\227\246\023r\022}\016\2563\266\377\357\013\335\236\305\357\334\256\351\020\334\370\2773\023\262\353b\223\247\360\377\223\""
+	.ascii	"\t\236\241\321\003R\373)\273\353H\353\321\204\334\021r+\345\206"
+	.ascii	"\220\373An\"7Z\211SGZ7\270\321\352V\232\332\257\030\255\317\350"
+	.ascii	"\373C\304:1[x\260\212\245\335\356\346o\036Gl\273\334\227\373"
+	.ascii	"\177\213z\342\360\2424\261\352R|\212\277\036\327\355U\034\256"
+	.ascii	"U8\367\245\377o\020\2619f\206\016\253\f\034iU\335hm\247\322B"
+	.ascii	"|\237\241qnWZ\207\\i\355\327\221\326\354Fk\267\0175\350v\037"
+	.ascii	"\006\335m\327\335dR\300u\373\002\017J\352v2G^ \301P\267\217\341"
+	.ascii	"\313\343\b\b\007\320ysD\370w@\355\3665\335n\240\333\007t\373"
+	.ascii	"Q\267\013\350v\242n\317\335\336\335\r\330\335\206\335m\247\273"
+	.ascii	"\351t7aw\017v\267`w\277\351\356\300\356\326\353\356\022\335\215"
+	.ascii	"\327\335i\272\233\257\273\247$\272;\256\273\013tw^w\347\303\303"
+	.ascii	"\303\303n\027\353\306\n\272\263\222=\357?\265\200V\357qW\352"
+	.ascii	"\016r\242;xb\017\b\374\0373\"'/\241k\232a\265\273\031|?\371g"
+	.ascii	"\026\375\373\317V\252\306l\255\360A\213\336\367A\340\245?\276"
+	.ascii	"}\325\240\252\373\370\337\367w\252Ac\264\257\373l_\227I\364N"
+	.ascii	"\227\371\377B\211Z\271&\323[\251\032\264\225\272\320\242w>\363"
+	.ascii	"\245M\037\331\351B\3332.\224\250\2256\241\255S\rZ\264\303\b\220"
+	.ascii	"\267\033E\370\210\270`\353\374/\257\263\346\223h\332\276\356"
+	.ascii	"\373\375\273\334\326?\035\374\237\271O\277&\017\257\323\232~"
+	.ascii	"imi\272\376\376\177\001/\2555\367\235\323\266\315\375o\323\242"
+	.ascii	"z/\f\314w\372D|\312\374q\366][\377\006\376\375\367\372g\372O"
+	.ascii	"\377\237\371\377>\317\263\367\277\214\250e\363\362\372\217&y"
+	.ascii	"\375\031\323\313\326?\226\373\253\203\266\3225\267\311\313\025"
+	.ascii	")\333s\275Lg{?\265g\2262\253|\327\377\373`f\203\352\210\203\306"
+	.ascii	"\323\374\270eqM\254\266se4\316\0074\247\007&\tV{\306\231=\037"
+	.ascii	"71krX\365=\354z>m\337s3m!C\0039\377\355\377\365=\365\277\351"
+	.ascii	"\336@\310\275AO\230#\315\270U\355\030e\362\3249!t{Xm\317\353"
+	.ascii	"v,.\347x\330%\360#\207\t\363\305*\231\217v\204M\020\020\216\232"
+	.ascii	"'8p\340g\222K\f|++\\\321\314\324\2720X\343g\217\233\335\313\003"
+	.ascii	"\177\365\254\315\t\244\303*\316\201\273\374M\200\275\210L\270"
+	.ascii	"\241 C(\206w\260\332D\261\334\236`\365CO\2606q+\343&n\342\326"
+	.ascii	"\341\036\314\327\366x4Q\002\340$\023D\303\\\215\3330>J\3300\217"
+	.ascii	"`\025o\021\335+tdX\3056\002\224\t\3211\207U\354\314w\262PA\203"
+	.ascii	"U\254\345\223\247\267\226\326a\324\035^\334\314L3\376\027\277"
+	.ascii	"\357\371\373`N]\276\342\024\342:<x\3340\023\275V\240!\234\026"
+	.ascii	"\204u@\260\033\002\0202\0277\210\325&\364\276\356\376\311}]p"
+	.ascii	"io\235:n\347g\203]\0358Y\254=|\355x_\200(:\356\326\260\321\241"
+	.ascii	"\023\250\022\362@{\263\226\t\t\211"
+	.string	"\377h{l=P.)f;\362`\017:\240G\237\030\210\207\341\272\260\301\322\346n\027|]\320\363T\270g\006\300\202d\253\255\360?*\341\207\214\0353\374\271\275\215\373\233\327\337x\337\210\017p\356\340\374\363\225\320>\230\211\356}+\033\017d\343\200\353\277\277.\330\363\243O\245\3665\356\327\376\367\372\237\003f\346?\363}0\217\313\361\025\247\360\243Q%5\316\337\020B7@\377o\377\217\240\207\257\r\211\026-\271\275-7\356^\277\371\374\377\260\313\242\205\013K\3441+7\325\222UQJ\311$\365\002\304\n\250\024\0368\024A|0A\242\350\001E1\n\252\210\225B\262UG\026\353\230,\301.\217T,\330\245Q\311\"Y\021\004L@]e-\331(\240\246Zb\302R\2622\216\312\251\003\313\242\323\022y\314\362a\221\311\0245\214U'\260\250\226F+&d\322\312*)e\200\205\2014\242`\253\214RX"
+	.ascii	"\246\330*\027F$\210\250%+b\350*\271\214Z*\215\313\250\240\345"
+	.ascii	"\021\t5u\274\362\001\352\002B\025\226\226J\343\325\022\2734N"
+	.ascii	"]\251@j\251\243\222E\2620rc\320@A\203\023\r\237vz\252\360Tam"
+	.ascii	"\247\247\246\246'\rM\27154\021\331\342\024\024\215\244\013\037"
+	.ascii	"\266\210\305N%I\fU%\223\035\212=\313\246ZZR\3018V\275H^\261J"
+	.ascii	"\246e2\251d\n`\225\025E\304*\032\227\306\017XG\032\034\246\216"
+	.ascii	"WA'\034\312?x\b\357\246&\017\fT\224\020\221\245\226\222\307\251"
+	.ascii	",\343\324\361\212)ydB\036\215VLRJ,\246\245$\265\247P!^\232\033"
+	.ascii	">p\353fba?\224pZ\3778\337Wz\024u"
+	.string	"\362\205\325V\307r7F\303eA\202Q\346\030\351\321\007 Z$\254\315\031`\026\262!kX\215Fq\031\2364\241\276 8r\2205.\363\275!-&F\270\270\232\240'm\322\220\375\215\215M\021\332r\247\304\315\214\230\030\222\314%\265\213\263\022\026\346\200Mt\006\200\352\250\221Dg\2144\"3\"\"I\222d8\240\002\221!\253n\021p%\304L\233$\313\032\221\004HL\350\024\332\241@\377h/l\376I\263\332\275\326\344!Zqb\376N\267\003\223\356u\272BG\305\036\246\272\0372L\220\265KJ\006\305\222t\026@Rwu\274x\332\324S\3029\026\226~P\211\nm\212\037\223;^Bu<\345\216\345Z\240\250\323\b$\022\250\240\021\034\233kP\025\315Oa\210A\341\217vmj \243\377\361V\334\031\317I\207j/\357\230\374=\002\035\215\305\320\020\204k\364Lru\333$3\016\302\300\274\232\203"
+	.string	"\321&\353\245\245\016J\200&\372\227=\274\b\001-\002\216\255P\026\373\274\242\210\3611E59e\313\222\3556#\333\002\365L7\314>s\337*\247A\304\031\332M\220\261hL\367Q\372s \240\347\211\006\223\363'\005\377o\327\367^z!\327\303\350\277\234n\257\\%\226\021=\207-^\354%it\222D#\305&\203\340\311\245\346\364\"\033)\234\304eR\234\0026\243\367\tH\265\344h\023 G\235\250V\031\233;\025\203[#MH\365\201\225\246\201\367\223~\311y\372s\320\032\037{~\370\210\r\036\3457\300\020 \267Ryq\321\001ux\347p\0378g\177G.\240O>#?\337\033g)\r\214\265$\333\203\030W5\307\207\234\326\316\264x\245\364\324z\323;\253["
+	.ascii	"\374\377\276\220\345q\230\370\231\006\007\344>r\023z\237\201"
+	.ascii	"\341\212\375z\275\2719\336\346\211i\211\260\336`\331\217\234"
+	.ascii	"\205\337\006\374\037\237&}\027\2679b\333\263\345c\034\272\237"
+	.ascii	"V\031\274\377\001"
+	.text
+	.section	.gnu.lto_.symtab.f671785b6834251d,"e",@progbits
+	.string	"pidAudioInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"pidAudioStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"pidAudioStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"pidAudioGetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"pidAudioSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376"
+	.string	""
+	.string	""
+	.string	"pidAudioUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"pidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"audioPlayTone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"audioSetupIO"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"audioGenerateWhiteNoise"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"audioSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f671785b6834251d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
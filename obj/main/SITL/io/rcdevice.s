@@ -0,0 +1,1261 @@
+	.file	"rcdevice.c"
+	.section	.gnu.lto_.profile.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\016"
+	.string	"\025"
+	.text
+	.section	.gnu.lto_.icf.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\300\001\275\013"
+	.ascii	"\202\31798@o\323\030\020X\257QQ\274M}\203\216\303e3]\021\373"
+	.ascii	"\004l\240A\357\363\356?\243`\244\212@:\206\3078\256\001a\201"
+	.ascii	"y\361\377\335Fz\251\215\032\331\262\333\316M\002\326\266I\202"
+	.ascii	"yP*\tq\254\b\363\021\2316\027D\244X@\027\210\217\321\227y8\251"
+	.ascii	"`h\344\326U)<y"
+	.string	"\025\340\316Z\366i\241@ut\357\323L\337:\257\373[\016T\t\024\215\214Z5\325\252a\205\353bL\"\034\333\276\037\347\335\004HO*\204$\003\016\202sc\006# \241F\347\276E\205 U\206i\013\242\223\321\356\373a\273\306\273\356\275\335U\276s\002\257^<\b\223\276\375v\2212ar\3053\307\265\343\331tll\206D,\022\344\\\322\351\363}.\327\2700$\221\256/yg\017\006\007T\214[_S\001\324\261aq\254+\002G\250\321\255\300H\211)TP\310\260\033P\002TT\262\003\020XH\210&\225tk\320\031],\326\242\257\026\306\022\2219\205\301\020N\345\334\202Xa*\362\201\254\224\217p\032\337\335\003;\214\244\022n\312\247\270\203B\266O\277\032L\321c\302\277G\223>\213@q\206\223\274\"b:=2\372\354\260\227\235\374\362\022.H\016\203\024A\302\200\350\326!\005\323\245\266t;\227"
+	.ascii	"\276AD7\361\335\207eV.\230c\370\032\013y\366sk\"\340\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\233\001e\007"
+	.string	"\362\311\032\035\2007I\007s(,30\027\222\t\221Z\340@\374\326\236\276m\262v\357\326\332\3362\311|\2003\213#K\n\305\232\270+\035\346\\\006W\202\266\0071\361pf\331Fxx2'\3264\303\304B\370y\0256KZ\245\357N\362\"\215#k\371\217:\327\201\351@\277.0\242Z\210T\240w\372\260\263\221\r\350}\276Ar*lB9 p\202\231I\263\003\005\002\352D\314\305\313\241c&X@\027\215\3200\211\b\226\\\204\315{\2260\3300\211\300\206}!/\\\002\2723g\323\202\266\t\200\20717\256^1\214\242\005\026f\001\252F\b\013\006\240\371\302\320D\001\230\2409$\370g\316\200\324\303\205\330\230A"
+	.ascii	"\f\231\006\342\001\f3P!\250c\"\025tc5\353al\017\353\262!\271"
+	.ascii	"A\b3\032X\205\006\357\n\366\024e\b"
+	.text
+	.section	.gnu.lto_.inline.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`+\006\r\032"
+	.string	"\006\244yH\320\362&\215\001\320\316X]!2\3478uT\256C\246H\245\307\\Y\270\316\351\236\357\325\301\210\376@\364\352\bL\2360\255\353\022H\321=\314 \367\226}\203:\362k\006O\371\300\274\342\371\331\204\352\207\277w#do)S`"
+	.string	"_"
+	.string	"i"
+	.ascii	":\263Ls\316\326\037\263\301\345\227D\271\274\201>;C\220\f\374"
+	.ascii	"=\333\334\234\263{\277\027Fg;\347\234\336;\230s\342|w\262\372"
+	.ascii	"C%\241'[\373\005\336\311\322\206\353\r\f\262!\004h\245S\222="
+	.ascii	"f\323\327\025\334Wfa"
+	.string	"D\335\224\344\317\300\241\033\n(o_m\240\214\250[\213\325\273N\255\004\260W\276^\371z\345\013\374!Jj\322\277O5\f\036W\247\351\221\246l\355\316\t\367\300\207k\325+8\034\256m\316\311R\263D3rz\n\350\354\342\223\254\214(\251\034\\\025x)K{W\031(\001\304\020(y\2143\030\337\t\327\230\3240.\203\360\215\337\313l\320\234s$.\341\004V\327\003<\037\202\264h6\302S\206\"(\267\216\331\276\034\357m\240\220\016\356\202\313\315\212\330a\244\343\300,\371\273v\326%\032\177V\367\021f}nL\240\261\177\026zn:\251\247Y\025!\216<\264D-\241<C\032\212Zt\222\034\263\351\2521\3331[\324\327\263\230\203\277\257\257\r\274\270\265\215k\r\334q\"\"\304\362\215\304|KX\263\272) -1\345\320\016\f6\006S\r\023?m\242\253\005D\331\"\360V\266\246;\"\005PR\353"
+	.string	".\331\356.\346\234%\n\340\370\311W\204\201E\030X\364\350\336\270\363\215.\273T\001\227\244\353|Y\245!\0369+\333\027?\2326\304a0\034\325\200\325q\252\022sP5\201\247\262\264S8\224\200p0\371\373\024\204`t\342G\3651\273\"\200\236\250\201\265\201DdFd\224&\205tP\0021f\310\322\003\022\340\244)\206rgj&\220\221$E\325\354o\251(\250\017l\272\215\352\227\037\261!\330\t\246\251s\214\004\025o,\202=j\216G\266\266x\311\322#\231\006Up|\236\354"
+	.string	".a\030\257\301\267\337X\341\332\351\331-\222\375\005A\371w;\3628\326\2230\251[\211\370\211\242\bF\004uT\346Zw\366,,\262-y>\b\247X5b\246&y\261\272y$wfpAR\355^M\024\203570\223\323\373\360\240-\213{m\365\227{\223\274\300\026Fv#Id)\272\007\034\001w\204\342!Sc\366/\203\301\242\006\033\255\035\306\360\266\331\355E\250\316}\013>Oy\200\201\231h:\225\233\272\230\256\t\324\373{\022\327h\240\211\037\364\325\254\030\371~\365\300\3714h!\233\\\031\024\241=j\262\251\364\317\240t%\331\021\274n\213\304\340\363:/\363\245M\303\333?\307@\375W\303\253\b+1\241\210\227\312\343\201C\355h"
+	.ascii	"T\314E\002\323A\202\217B\313zR\006O\346\264\277_\f\322\245mS"
+	.ascii	"H\031&\215b\037I\315D\223\352\206\327\305@\230\217\252\003\237"
+	.ascii	"\336\333-\226V\357\013\240\216\022\3073\354\326@\031\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\303\007\365\024"
+	.string	"&\231H7Pk\222t\210\235\231\256g!|K \366\244oo-\250\2241\203\237\016\350\355%W3\216\23011\221\005\277xo\330\204e)\026\016\212\346\231\374\330\332n\204\310$\0032"
+	.string	"="
+	.string	"9"
+	.string	"\363T\233\236^5\251)\231^\3110\363b\275?\017\353S\220<\375\032y\272\363\224\2275l>]\321\236\336%\344;yU\021W\321d/\323\223\202NG\247\234I\357\242W\321\263Hk9\001x\363\254\307\005\316\235N\235\372\370\250\350\252w{\374+\t"
+	.ascii	"\344Z\252b\030\236\362:\316\322!|4a\320\003M\212$\004M\021\206"
+	.ascii	"\340\276\3415T\230\315\270\nV\350\263`\345=\321!\222#+u,z\351"
+	.ascii	"'\356\263X\036\224\322\224q!7\350\016,r\005D3\303\247\021}E\267"
+	.ascii	"\271\276\240IO4\2736\320E\177\016\277\346+\224\334\232b\234b"
+	.ascii	"\33506p\207\025\024\350\030\177\"\020\342A\3345\354\017S|\252"
+	.ascii	"\235\027\016\216\357\202\365\370(5\251\304w@\202\353\360\245"
+	.ascii	"\032\361p#\244\364Ih6\240f\003\372&X\200\247\250Q\275\203fd&"
+	.ascii	"I\n\255\001P\002!\204\312\214\033\022@\303\034\005\3220\306\030"
+	.ascii	"4\320L $\264()\025\346\037\002\205\bm\260mnN%<\b\347`Mf\266:"
+	.ascii	"\306\024\b%\252m\035.\330g\356\360\300\344\3167\223P\273\340"
+	.ascii	"h$u\215&8s\336\205\327\301J\006.\016?\023[\261YE\307\367\234"
+	.ascii	"\267(\005!\300\303\240/\357\362\254\2645\2254\353&t\322\343h"
+	.ascii	"\254\233\221\3645\220\354;1\213\272\311\225\231\240\307H\300"
+	.ascii	"\373\005\213~\004v\270\f\344\033\032\256\315\376\243\320\225"
+	.ascii	"\022\013\023\371&\246\210\215\320\366;\306\343\202\020\320\302"
+	.ascii	"\016\313A-\372\355\236\357\205x\271\334)\035\261y\227\333\365"
+	.ascii	"\356-\300\267\250\024\256a\200X^\303\"\b\003)M\016M\276\340B"
+	.ascii	"\212>\035\331S\310\262\025\351\212\350$\271\267n\302\331 \032"
+	.ascii	"a\f\306\002\271\342\361\367\314\302\326~\0303w%\274\240A`\001"
+	.ascii	"*\"\030\264\005\241\335\003`\245S\210\354h\251\211\016\2110\341"
+	.ascii	"!\025Dz\310({\355\241/\374\311\025\f\3142;\311\340\b\230\210"
+	.ascii	"!\360\037:\227g\340A.\271R\213\205l\244%\020J\2100\214e\265\336"
+	.ascii	":\231<\243\027W\bQX\t\314\274?\030\023\261\212\034bI]2)+\246"
+	.ascii	"\341]z,\276\350{\246\224\347LI.\340\247\360`\302\321nB9q\336"
+	.ascii	"\317\361T\250+(d"
+	.text
+	.section	.gnu.lto_.pureconst.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\271\004\001\231\004\002\232\004\003\232\004\004\231\004\005"
+	.ascii	"\231\004\t\232\004\n\231\004\013\231\004\r\230\004\016\232\004"
+	.ascii	"\017\232\004\020\231\004\021\230\004\022\230\004\023\230\004"
+	.ascii	"\024\230\004\025\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`'\001-\b"
+	.string	"\242\213\"(\220'I\007\377\377\277z}w\273\2353S\302^b;\376\377f\311\003:X4\025-Z4\364\366\377\333\326\220F\244L\001/j\221LT\342E2Q\347^\03686\270qA\031#\244,H\315\316E\330P\316\360\004\345\2433\325pa\356\341n\241&`"
+	.string	"\205\300\235:\227\232\203Pb%\374\214t\252NHMo*\0204\3170[\363\236\312\355\354\236\344\217\232Yj\177\207\023\321^v\275\236s\204r\205\362w\360\306\003\337E5 `\2021\205\325\003\2264\246\225{\202#\230\t9\b\034\016A\346fB\260X\"\317\205\027\311\304\301vq\270\200\252\224y\020\244\001\361\200\224\302\275 \323\222\003f"
+	.string	"g7\305*\222%\240hF\250"
+	.string	"\005\346\303\303m\374"
+	.ascii	"`\304\327*$\363\210\026\246rd\227\335i5XIl\013`g\361F\326\002"
+	.ascii	"\343\310=\027\230\207(\013\265\302\b`\017\222\017\2746~m\033"
+	.ascii	"\\\021"
+	.text
+	.section	.gnu.lto_.lto.6bfada4c9568bc04,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_expectedResponsesLength.18.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375 \203\275\002"
+	.string	"\344\003v"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\004\005\001?\202\210\200\020\177}\274\001{\273\001\005\001\006\025\002\273\001{\277\277\035\001\005"
+	.string	"\304\001{\303 y3\305\0014\302\001\301\001\300\001\276\001\275\001"
+	.string	"\n"
+	.string	"/\202@\335\250\356\200|7w"
+	.ascii	"\203@\271{fHi\020\003p"
+	.text
+	.section	.gnu.lto_runcamDeviceFlushRxBuffer.25.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"E\f"
+	.string	"\346\326SB\020q\233\0168<N\317"
+	.string	"\272C\224\261\200\0349Hi'\231\027\253\264\241\253\371\021"
+	.string	"Pt\006\361\030\350u\354\343\317\210\323\345R\324I"
+	.string	"\200\212\b\212Q\204\270\243\002\303*CA>\277\033\331[\312\224\002@"
+	.string	"?"
+	.string	"A"
+	.string	"&7v\327R\020\206\311=BM\316\317\016,:\357\363\b)P\210\210"
+	.string	"\036\bfJ*'/yj\360>\022\222\020\271\276\344\220\204\003\251\363D\236T\203\335uv\336\206{\272m\215m\214\375\007\001\376\350\2374\255\231\316L\337B\325xq e7d%\307\242\304\223\021\027\333O\373&~\202\373\250\343\002vC)-v?\005NP=\372;\201\351\261\372\200\351\321\234=\343\237h\251\01722\004j\241A*\001ww\241\216\330\256\362jW\340\344;#"
+	.string	"\321\217\355\013O\341\001"
+	.string	"cw\027\370(6\f\006D!\036\375\216\351\361\252\036\t\307\310#Wt\205\013\220\247:b\177\237\314\210J*\326\220\003\330\225u0\315\344\013\203]Y\007\323\\\233\245e\326\204\f\302\306\2726\216\205)`\215\002\266Y\0264m\263.\337^Cv`\003\305C?b\204IUIT\304"
+	.string	"\311\222/\231jK\330\344;U\006\036L<U\225\001\025"
+	.ascii	"2\003\353<\222c\353\365uX\\8kv\030A\334\021E \221\313\235\250"
+	.ascii	"\022o\302\302<\n\232P\213\224K\260\315jJp/n\251R\265\f\324\313"
+	.ascii	"&a>\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendRequestAndWaitingResp.27.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\350\007}0"
+	.ascii	"\312U\020\023DPdR\007\301\274\321[\022\203E[\212\272\262PQh\f"
+	.ascii	"\320U\232\303\356\264K\030~\332dI\254\"U\214%\2158\271@\004)"
+	.ascii	"\371p\025W[[\355RI'U\340K\313\210\216\027\224\215X\226\354\275"
+	.ascii	"\245L)\037\001\r\001 \001\300\375\373G&"
+	.string	"\207Y\322Es\274/pj\3443g\253\246\355\275#\270\213\026\314\233\351\017\023\305\016\355\251\351\023\024\300o\025\260O\344z\331cb\311v\224\301\220\261\373\204\n\372\255\313\037\332\3155P\210\217\335\177\354\251\372\253>\n\f\355\251\262g\332\336\326\b\256\004\374\326\255/\300\375\026\370D\356\267\256\335\345\274\325k\377\246\\\254\276\354\331{\023\263\023g\237\265\276\273X\277P\2200\370\003\374\271-\233\261\366\377q\300Yx\312\256gP\251\027\342\372 \026\302\0211q_\207\245\204%\272fa\362m\302:,.V\301\033\305A\326\201\024\216\310\327a%a\005\3201\211\363o\\\370gAW\326\326\003Y\004k\324`\371:\254-\326(\272d\314\277\277\240\n\326\021\374c\205vV\220\f\241V,\205-4\273\247{\374\2046\261\013\246\365m\360zuB\215<\313j\240ny2\204R\261\231\314\314-\b\235\302\371\351^"
+	.string	"\265y=\203j=\376q\330{;vB\263\336\207\336\375\205\356^\345\376\033\021\314w\372\337\275\033\021\376_\337:\t\023\370\235&\334\023\377\356\b\340\265\367\266\240\3742sj1q\237\023\300\277\337\323\270\017\376\327\376U1\364r\272\263h\001\324g\256*K9\021\006\312\356/`\340wz"
+	.ascii	"7\253^\336T\226r\2676q\236\362\345aC\305s\023\367!\354KB\330"
+	.ascii	"\225\206\330\223\206\330\221\032\f\2613\030b?2z\264\377\004\357"
+	.ascii	"\345\277\350\311\376\017<\231\177\002\037\346\237\350\317\376"
+	.ascii	"\207\336\372?\374\352?\320\317\275\273\031{\033\204\235\025b"
+	.ascii	"\317B\3548c\177\b\004\276\244\321\251X\276Z\367U\037\337\236"
+	.ascii	"k\325\246\374\334\277\232\277\232\237\363\247\363`\234N\363r"
+	.ascii	"~\3745'\241\365%\035\3734\376q\036<>\234\022\273\303lv\252'm"
+	.ascii	"l\317\336\326\007T\300\343\231\177\273\361k\216\347\234\271\341"
+	.ascii	"\036d\3736\367\240#\177\315\r\030i\"\035C\272\007\277\315\377"
+	.ascii	"z\320?\355\315\350WK\376\256\302RAU\315\333\033\353\301\267\336"
+	.ascii	"\003\370mL\364\024\277\323\025\024e6\377\373GYx\315\253Y\037"
+	.ascii	"'\263\353\302\003\346\251\277\334\003\363\300\204\270\376K\367"
+	.ascii	"\351\276\035\343\263*\3032\310H\371\351\276\303=\220\013h]\313"
+	.ascii	"\336\374\322u\327N\376]\376d\305\331r\007\350\311\277>~\314\253"
+	.ascii	"^\024\312\2779\310\256a\321\034\205es\326!\3128\347\334\342)"
+	.ascii	"aw\r\246\255\340w\342\214\364L2\327\304\362o\224]X\024)\273k"
+	.ascii	"-\357/e\265)\273\236\325a\342\276_\236z\0064m\203\334\356a\177"
+	.ascii	"\342\256\2627Sx\217\335{o\367_\3115\312\rX"
+	.string	"17\267*i\263\371#\211\231\226\315F\331\315O\017{<K\242\227\362\357hj\204;;\fr\214j\330\200\262\26396O\375(\017\263\262\314\315\024\336\363\227s-\366t\226Iw\232\313\347i*\322\0059?Gw\351\300\304\344~{\224\237\356\003\360\211#\245V\231\270/o\241\331\201e\037\346\317\257\365%g\325g(\273\177\370\327\331\352\264\t\033f\367\020\377.\177Yl\364\242\376oL \270\333;\307\347\001\305d|rJ\342x2*\203MNQ \214O\311\032N\"\224\306\247(\340\223\021y\\\321C\teL\301\243\210\f\202\212J\"\215G\250\237\223\261\204\260\bU\364\200,*\2138~<\210\240\341TD\"\223M?\2567I06\035u\030i4)\211\311#\321\351XD\022\233\224OD\t\006<\211\303\250$B%\223Jb\320\312\374\334\304\343\250\350\3451s\323\223\354\336]\033^\355\377}"
+	.string	"ydB\034p\233\201\262\177\233\226\322\315_\226*\022S\003\027$\303]\3123\312\334\264\271\246\302Dd\f\261\241\255\336\207\373\355R\376\266\307^W|Rj\265(\267y\202\2242VK\321=8a\236z\321U\002\326e\300\277\206\257t\021\003Z|\3221!o\372\251\203\340w*\345V-\f\317\226`\236:f~R~.o\256\257\360s\tt\374\003;5T\017\321E\360;u\021\367\333\244\374o\217\273"
+	.ascii	"\271\"\245V\023\030\371\327\361\272\346\204E\177\212\266\376"
+	.ascii	"]\016\370\351\302\323\233"
+	.string	"\200\331| \377\032\246\322J\200\232\353_\275\004\301\235\016\200\236\250Q$\245\0343N\231\021\021\tf$i:p\002\021*2\363\021\2009UU\222\024\2461\312\002\325\251\277\231\362\351\3559\274\325\300J\370L\020\016\365\020\305\245\267\275\001\201l\037\334`p\270P\325]h\036\030\t\331i5\005\306NaE\217qQ\327\322\254\227k\275\026R\224C|\215\243\341i\005\311V/X\201#\341\013wJ\365e\006\314y+\022\345\274\224\246\2345\035\300\334\307\364\214\261?\f\317@\251\300D\256)j\211\273\234\327\315G\013{\314zlw7\250\340\225-0=\210\031=\007\274\212\324\340\354\255/\220&\273\252\326m\203\260\035m\246q\377\237\260\033\202jppt\374}GI\204\240I\004\205\252\254\232C\250\300\351\301\3313\372\261\005d\275\255l&\356\3045\224\tFj\320j\263\277\216\306\235\212\307\375AO\266\243\n"
+	.ascii	"\223\274\357G\320A\034\303\217\030\0333(\002\f\237\366\020\345"
+	.ascii	"\210\347\004f\006L\201\006\300\215\273Y\235\256/\352I\220\006"
+	.ascii	"\244\036\370\373\237\001\376\226\273\023\2500\325.P1\277\220"
+	.ascii	"+\240\377K\027\205;\202\031\200\274\324\241(v\3140\364\250.F"
+	.ascii	"\330\206\213\364k\207BN\223\367\250"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.28.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\035\n"
+	.string	"\346\022F=0\345(\035\300s\330s3\237\226\262\335$fa\272\216f34\224\364\251\242\255\346Lo\237o\373\330\241njC\207\245\273\205\224\226\202\302\031\0300\363\303R\262\013\222\265\211%\204l\231R4"
+	.string	"6"
+	.string	"1"
+	.string	"2\032*\264\335\375&\311\307oSG\177\2004}\363V\237\233\002\313eE@\2426\316L$\346\261\353\006\231R\325xv\327\252\";n\356\266\035l/\330\367\002\352w\017"
+	.string	"h\001:\003v9j\005\366\205k9\331\330\276\332w\3755\036V:(\330\224\354ce\267dp\202w\316\3459\3359\357\006\3359\217\366\314\313\222\325\264\002\237\0212\230\224\022\260}\361\224Q\203\217B\312\360v\367&\347\374Rw\356\363\261+\210\207\213\365\202\235\264f\227&\235-\373\333\356\256\347\210}\330?5$\0218\rv> \b\343#\001\212_\b\372(@\020\023\037(\206\276\016\202\303\212\217\370\211\302P\3746\345\336s\232\250\315\3239m\213\220^\345m\232\224E\300,dz\324\005\020"
+	.ascii	"2\003\3020\304\204\275\032\310\r{\t\325*\b|\"\3049\304zKx\002"
+	.ascii	"S.\3016\253)\342.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_runcamSplitSendCommand.30.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`U\006u'"
+	.string	":Fp\017I\200\332Q:Af\227|\035!\006\020K\250\t"
+	.string	"\246\353\203\007\275\3703q\260\250 \250\321T\275\200DV\2156Q\242\353\370\024 \270m\221s\224\3178\322\200E\206\323=\220<5\370\366\313@I\025D\020!\204\020\"w\222\001\337"
+	.string	"\331"
+	.string	"\351"
+	.string	"\307{\203\017n\362Qz\323\310l\313\\\341\002\357\304\335\003\334\236\231\034\266[\346G\271\024\336\263f\\\300\275Um\270\356%F`\243\364&\023\017t\336L\357s\336d\3461\2779\221\310E\257\212\374\214t\356\275\266\276J\323t\207\313\227\304\363\332\274\003\340Yk;j\212\236f\331\226\307o:"
+	.ascii	"\343yJ\264\206\016$'\013J\225Gh\307\256\203\325\260\253O\b\344"
+	.ascii	"\265\022}\n\2469Yp\252<B\302\211\272\230\317\356\f\021F]M\251"
+	.ascii	"\204?\216\226\r\312\bis\262\240\217rh*\f\217\025\352gO\261{\270"
+	.ascii	"zBR\t\243n\036\354\036\312r \251\204@^\026Q\t\203\274K\013Ml"
+	.ascii	"h\251A\321(W+s\224\334x\013\204\352Y\213r\270\367\262\305\001"
+	.ascii	"%<\367\234\371\t\230\231\004\263\031\026\275\257\263,'\233d&"
+	.ascii	"\366l[1?\275\342e\204\273\212yA\321\275\316D\n\036vN\200\340"
+	.ascii	"\200j\331\200jy\250-\013\265\345\002\252e\002A@?\251e\237\001"
+	.ascii	"\347:\363\234\370\253\317\372\315\177\235-j\371\fz\244\312h\b"
+	.ascii	"\273WG2\355\2221\273\222\374\353\017\373\271~\257\177\n\177\313"
+	.ascii	"\303\370b\274j\341\335\312\277\370`\\e\013\250;\025~\227{i%c"
+	.ascii	"\206\367\336\325\253k\227^,t\253m\327n\002\n\346'\"\275\311\305"
+	.ascii	"e\351\327\027T\177WEN\335\271,\235AuG\331\215\343M\016\221\336"
+	.ascii	"\n_\313\257\034\213\356Y\214\322\246`\212\245\354\351\b\"\275"
+	.ascii	"IT\352\370Ux\325}kG\324\024\340\366\312\200X\367\022;\2447\177"
+	.ascii	"#\257\327z\221\367)1\322\213\365\341*IQ\3039\276\251\236\332"
+	.ascii	"V7:\203\032Ag\360\362\245\365l\016-&\307\324@\037h\353\346W'"
+	.ascii	"\351\034j\003\375_\017\241\036\352\362\353W\007\302\013\264P"
+	.ascii	"\337\227\326\263I\016\352\002-\303\311\326\257\216\323\223,E"
+	.ascii	"2\264\255\370I'\201>U1LP\023\350\213\275\354\032&\177u\234z\353"
+	.ascii	"\351\254\353\374i\237\006\352\273\371\365\350]M\212\035\377\b"
+	.ascii	"\177\351\274\351\323\326\b\214\242p\236\036\320\007{)6\204\343"
+	.ascii	"[\322;B\372\260\314\2662\"a\214\216\231\332g\354\371\2538\346"
+	.ascii	"D\352\021\350\230}}w23\204\033w?D\356\275GfQ\314\320,\206\035"
+	.ascii	"\341\300+\354,\350\204\366\342\264)c\224\367Rm\370\224\367\016"
+	.ascii	"0'G\255S\031\223\325\374\342|\237(\256\241a\321\230\031\351`"
+	.ascii	"^\244\367^\f\374/L+\322#3\316\233\357\033\337 \314\266\005\216"
+	.ascii	"E\347\230\\4\322o\271[\347p)R\350N\224`\312\231\320\255L-pI:"
+	.ascii	"\0259\023\351\3117\t\270\033\022\f\034\212[\316\246\204dk\201"
+	.ascii	"d\"\311v\313-\331$\b\261\222\013\\\316\306\244"
+	.string	"\244\224\263\255D\247w\225\355\336\001\254?m\033\370\243\226Mr\2175!\020y3\337p\3668\330r\001B\306\327M\3744\227S\242\031\232\331.\2369\363\301S\326\202\232\t\231U\376\370\2374\r\271\245VT\002\017v\025\0139V\033\320\\\226\247r\243\nt\307\230!\016\236\334\223\337\235D]\2245,\363Mm0C\223Z\333\212_\353*V\277\250\n\324(\3107f\n\344R]\220\232!\307L\240\016j \b)(E64,Zy\357\275;m\305KCR\004\375%q\236\320\003\275\240\201\314=\311d2y\2433A+\350\007\200\204\250A<\205\020S\004\231\231\tdF\333\244\003p\002\231\271\332\r\020`H5I\007o\360b\304\363\373\366\35259\021=\264\223q\036\205\21467\243\001n-\"\312\323\226\330@\0026\301\276Q\266WZ}\0362j\360Hk\026\307\341\241P\246\332\266\307c\323\375\037"
+	.string	"j\314\312\305\007\nb\255\312J4O}\352\303@o\235i\260[A\317\244\360;\360\223\035\026\003\260C\216\360\3701\257\037\0038,;\226\241P\270\3613\317%\303:\367\343j\\\332\360\030\376+\r\306\240\314\n\322=\325\232{cYd\230\337\001\254\333\300\005E\006@\372"
+	.string	"\352u\305\376{RE+\355\336$U\203\375\362\202%@\231C\343\274\356_2\200\271=A\262\220\276\327^\032\356\3136.\b\224\tm\305\354\005[]\003\313_\177\203G\351\023\204\001Pp%\271|\315F\375\020\221\004Eo\301&\310\202\313\037\350<\343\325\244\317\301\341 "
+	.ascii	"\023mb+\335J]U"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.31.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\331\002\275\025"
+	.string	"\366g\215J\240\024R:\203\320[9\232(\310\270A\024J\3075ZT\345\352o\001./\202\255b /\005\177\321\376P\325\352.\253\217\352G\037\030\277\334\200\367h4x|\230O\035\230u(;\361{\2746f\003\2657k\244\221M\344N)u"
+	.string	"o"
+	.string	"}"
+	.ascii	"\020\310S/h\240{\231#+Qk\351E\t\252Z\313\003\247F@~\332/\272"
+	.ascii	"\221\356A\034\001\261\252\223\264\242\251\3262\201\r\220\247"
+	.ascii	".\2172\236\222\0070\236Zg\013y\351\242\266\202\244zB\253Z\253"
+	.ascii	"l\203\256;\025w\352\374\234\323\027\220\347\"\311\363\025\031"
+	.ascii	"\214\260\3629\001\352\210%W\275\036\027~\376\200\2749[*\265V"
+	.ascii	"O\037\020\305=\336v\213m\027{\025\004\364{\341\247\317\317\324"
+	.ascii	"\217Qp7\207v\311\233\013d_\254\265Vo\013\373\345\035;\322\r\273"
+	.ascii	"\322m\362\340_\362\232~\271\246]\256i\3225\335\"\247Gr\232\266"
+	.ascii	"\246\305qz\351\364\024\247\217r`i5$\002\215ZM\f\261\352\016\352"
+	.ascii	"4\364\362G\372\225\276\366\177\364\244\013Mb[\311\346u\347\204"
+	.ascii	"\353\027t\204\212\005)G 'Vy@H\020\005\273\022\343\327S\343&\347"
+	.ascii	"\013M\330>`Z\372\365\210k\273\034\312B\200)_\370\023\006'\230"
+	.ascii	"\f&S6\343\251\030\345\253\332\315\241w\305}/\353M7\271\323\214"
+	.ascii	"\247\273\243\360\327\243\3413h\346\272\210\fax\303e\330\024\230"
+	.ascii	"2Y\372\224edU\f\035\361\020c\263d\355\227\331\274\317\342\346"
+	.ascii	"\370GS\220\305Zf\374rH\n\2423\257l\323\316$\343\300_\212\251"
+	.ascii	"\221\265\326\013\235\3728\343\003\264Y\255\206\0063\206\260\265"
+	.ascii	"\234\314\340j\022:\310\324Vh7\032\334\013-\006&\0027[\317Rh\263"
+	.ascii	"Z\r\rfv\223\331j\262\017\265\027\017\262\331mF\2262\3006\020"
+	.ascii	"\264\233\fg\263\335d$\345\356*\273\345\235.\320YF{\302u\260P"
+	.ascii	"(\241U\221\327\332\024\216\243\302\215\315\341\253r\355\213\334"
+	.ascii	"\326\272\366\275\024\260%\307m\355\350\243\227E\336Q#\335q\277"
+	.ascii	"\203\305\233C\307\226\356\213\230l\364\262\2446\0266 `\002\031"
+	.ascii	"B\273\r\3420v\236P`\321\rc\310\260\277\022\264\375\326h]\234"
+	.ascii	"\230\013T\210\2161a&C\263\2010V:\3520@\02277\f\217\340\356\276"
+	.ascii	"\025o4\241\332h\027\n'j\375\013\241\325\247\251\020ps\353\331"
+	.ascii	"\033\007r\310\027\311\207&\273\361\310,w\003\267BT\252\017>c"
+	.ascii	"\242\207\330z\325\376\352\306pz\2478\231\317D\034\205\225\004"
+	.ascii	"\266\221\227\233\236\021\271\246k\264G\003\313{"
+	.text
+	.section	.gnu.lto_runcamDeviceGetDeviceInfo.32.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"u\n"
+	.string	"&\325J> O\234\016\243\026\361\301\225YC\300@\025\362\233e#\b\236\"kt\036X>\314BQ\326\020\207\346\037\320\366\017\212\032{\200\004"
+	.string	"\346B#x^5\326\270\342\2004\377\021\215\270\255\224)\0057"
+	.string	"8"
+	.string	";"
+	.string	"\273\337"
+	.string	"\013\250\016\375\275\203:\254\316A\035z\263W\374\303\260\220\f\024\"\224L\273\033\365\302\267\347\346\377\3033:\317\346\t1\260\273\316\316#\341\326\333\016`\233b\277@*@\242\021\227'\373\343\244Z\260\377\330\335\265z\366G?|\244U\323\231\351C\376\t\231\\\034(\261\3339\301X\024\360\004\207\210\355\247}\017\027m\037=\270d\327ca\"\267\250\311\241\332W\202|g\215\316\204\255\240\033\333\330E((\251nt"
+	.string	"m\270\246&)\305\210\030\276\234\224U\273\020\b\370 \036\242\201\257\341\320\230L\276;\3643\324\341\025\222\360\002\227\205i.\013e\213rY\230\346\262XZ\314\260\270"
+	.string	"\253\\\242\245a\"\005\2003\006\227\026\035d\231\026#\037\367\307\252g\370\t\275h\301)\307\222\374\207\240R\355r\357\342SU'w\f"
+	.string	"2\241\201h`\306\005"
+	.ascii	"\005\313*a\020D\016Uw\017\230u\t\253Y\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_runcamDeviceInit.33.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\007\002U\022"
+	.string	"\266\242zG\260\230M:p\345\362\005-\032\264\037V \27071\017\314\313&r\355h[5\303\270 \003\342M$\267\037Q\236\314\004\225\216\313\3125kSX\017\330&\250\261\274R\237\203q\003<h\001\361\027fm\355&{\313\224\002b"
+	.string	"`"
+	.string	"j"
+	.string	"\035\353j\177\351\266\357L@\027\260K+bd7\224\361\003\3269\207'0\317\261>`\236\363gSy\210\264\207\252A$$\313\356v\361\306\277s2\352\347\337\351"
+	.string	"@Y\3209\243\313\027YL\243T\360\244\211\217"
+	.ascii	"2\027\222\301\221\r\"w\272\276\220\r\251\256(\354\256\025\224"
+	.ascii	"\025\335\363\266A\330\226`\253\211\2767m\235\007\361X\273K\343"
+	.ascii	"?\361\244\200\241\302q\316\007\232\347dj\264\331\222\025!\275"
+	.ascii	"\331\341\220\306\232\375x\273\335n\2164\373\341\335:\323\277"
+	.ascii	"\232j\311\251\243TkT?\306\301\224\331Q\022R\214\022n\214\033"
+	.ascii	"\227\235\342\220\344x\370\333\277\223_l\207?rg\204[\004\213\222"
+	.ascii	"Z\312\262\033B8\347W\202\301\031l\364\240\315<\027c\213\332\217"
+	.ascii	"\231\215I\243\255\341G|b\"\024\260\312\200\372\034f|\207\271"
+	.ascii	"\212\355=\314\356\376\207\371!\177\264C\210\320\203\032\345\322"
+	.ascii	"\360\210G\335,@\202:\341\212\3608\241\326cfcR\231\023\030R\321"
+	.ascii	"?\263\025\017\324x<I\211\351\026\303\350w\2373\355\027\n=\330"
+	.ascii	"\212\252d\244CK\225X\fr9\257\022;^M\017\314\343iM\273fp\\/\026"
+	.ascii	"8$\\\260\316{u;\257\033\235\316\005S\321\315 \260\307\203\003"
+	.ascii	"\353z<\017\326\275\204B\227\033i\033\260L\t\305!\271\273\313"
+	.ascii	"5\320\225\322\007D\017z\205\214}\321\216\240$\35135&\2505\311"
+	.ascii	"h\177\266K}M\005\250\\\341Lj\316\311+`U\2142\236\250\213-|\311"
+	.ascii	"\005\326n\214\306O\022% P\002!c\362\016\357\314\033\205n$\260"
+	.ascii	"\360+\264\242\"\031\370\201?<\200V\320\206@\223t\237\236\260"
+	.ascii	"\305!\204\3703\323\001Yh\237\006o\311\300\362\214\315\236)\177"
+	.ascii	"g<2\301<\310Y\302\245Z\211\353\325\007TF\241\t?\306\303\335\320"
+	.ascii	"\251\345\231+C\313\205\205\274T\270\252C\355\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulateCameraButton.34.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`!\002u\023"
+	.string	"Ve\203I\300RN:\302\211)\204\020\314\246\344\232.\247\223\013\264}\021\"\214\n\312\223\276\236\\ab2\252R\002\344C\373\353\337\340\347;\031\350c\352\245\332\300 T\005I\026\352\240\002\202\341\022T\031\224Y\203\331J\310&{\313\224\002q"
+	.string	"e"
+	.string	"u"
+	.string	"\036OB\357\201\037\241\367l\033A\002\032\307>\016\351\034\204\021\355\004U\255c(\205\036;\370Qo\312\215\3715\007/\353\371\267\262\361\234N\023\031N\264\327\320\3203\013\340|z\340\254\307\3639OzT\320\020\261\331\314\021\034%\200\256\243\255\234\007n3vDl7\223\344\t(\307\221\2769\266\331\356\247Rk\365\326l\033n\220\333\306`{\201\275\016\002\3668[\231\263/w\273\335\316\022g\203\353\325\217~\320ko\256\347\267\226\337z\351\372!\367P\251\246\032\360\250UgWU\235\274\027$l\337W\272.\346I\226;6\210j\255\254\030\233u\3576\215\315\262=\367\243\314\003\324\031T\206\246Z\233P\034\356\332/\272\021\315\217f.\240V\234\216\246ZG\024\033"
+	.ascii	"\357\005_\031\202\273a\342\203lw\317q \222Q\026\352\023$\264"
+	.ascii	".v<\375x\003\366\344O:R\204\222\240\237[Q\355\344\240\364u\022"
+	.ascii	"V\3665\177\262\306T\035\246\222\246\314Y\244\253\353\334\372"
+	.ascii	"\n\021\364J\016\351|D\355\346$\317B/'(I\331\254\017\333\256\247"
+	.ascii	"`!\020e\277\276T\001\254\265*@\341\322\002 \252\326\372\020\367"
+	.ascii	"\374\031z\357RD\256\352ft$\333].\342\013f\005\346z\021A\250["
+	.ascii	")\256\326\353\202\213B\013\026\212\257\320\345\265\322\022\266"
+	.ascii	"`\026\302\224\022\213/.X\b#\212\260\2205\312>\253\304\231J1-"
+	.ascii	"1}\177\214\036\351\f\244X,1y~\214z2\307\266'\255\"\223\263Yk"
+	.ascii	"\255\240\314-\214\237\030P\037\311N\tJ\373\001\004\223\033Yc"
+	.ascii	")\247|\013\332\017\331e\350J)\217s\233\355\316\037\003' P\242"
+	.ascii	"A\210\365\357\363:\013}$\361d\035\307\333\212\274 \204\206Z\020"
+	.ascii	"\343\013\265K\2436N\351\254V\350\210\272Y,\221{\214\216!\361"
+	.ascii	"!\202\342.v\2065c\341\\^\006`\336\230\331\274\bc\252\322>\342"
+	.ascii	"\231\023\004\225\025\326\261\003\017h\033q\036'\243s\273\001"
+	.ascii	"\303\331/;\031\340="
+	.text
+	.section	.gnu.lto_runcamDeviceOpen5KeyOSDCableConnection.35.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"U\013"
+	.string	"v\225OD\020\3118\035\250G\343\373?\003"
+	.string	"G\200;h\376"
+	.string	"\330)s5\203\031\373\016o+\234"
+	.string	"\345\256\330\252B\210\032\261\321\036\235\007\271\215\022UUG\210Y\013I\266\312\034z\244\020\311\256ry"
+	.string	"=5\262wJ\0018"
+	.string	"?"
+	.string	":"
+	.string	"\253\3351\303\025\3333\217\207\320\236m\177\320\2369\264)|$\260w\020\201\205Akw+\035\360\3603\364_^#\232H\237\231\217\335\365\024M/7\275m\n\333 \3669\002W\3754\363\323\266,\210T\330my\271vB\366\300\300\311\337\376Ko\254\261\021\236\034m{ \323\240\200\004\326\356\352\342\231;\2669\242D4\354J\231\240~\332O]AxU\312\035vQ\031\002/o\023\243\365\323\345%\032\306\277\340%h\023\261\033\202F\251-:\231\027m\201\300\2650\224\344\177\244\235\374\204\200VL\352Bi\276\354\2214i"
+	.string	"\373\330\356\256)\312\376\370c\001\236\317\013u\300\356\363i8\217(\244\003\201\235\217F3\307\3518\317\244\033\341\300\372y\325\343uH*\007\202*G\302\337\247\003k\350\373\300\272\031\367\330R\224\263\323b`\225\250\212G\330."
+	.string	"\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceClose5KeyOSDCableConnection.36.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"=\013"
+	.string	"v\325NC \2518\035\307\223f8\276\004\0220\340\321uW\325F[Yad"
+	.string	"\025b\223\254\244\\\036\310\013\0352\315t\351`\257~\251\006\b\373\001(\2660\326\2443F\273D\375j\001c\206r\374\023\022!{\247\0247"
+	.string	">"
+	.string	":"
+	.string	"\252\3351\303\025\3333\217\207\320\236m\177\320\2369\264W\037\r\354!P`q\320\332\335JO\017?C\377\3451\"I\364y\371\330]O\221\024\340\246\267Ma\033\304>GO\375\364\362\322\266,\210T\330my\271vB\026\001\301\311\337\376Kg\254\261\021\236\fm\233\340\362\340\300\212\265\253\272x\346\216m\216(\021\r\273R\242\352\247}\324\031\204O\245\334a\327\224!/o\023\243\365\023\300K4\214\277\301K\317&b\267\004\215R\033t2/\332b\201k\005P\221\347C\332\311O\234\024\f@]\030\315\227=\212&-`\037\333\33555\331\037\177,\234\317\373l\300\256\363a8\016(\244\363\200\233\016F3\247\3518\317\244\033\341\300\372y\225\343mH*\007z\252F\302_\247\003\353\347\373\300\232\031\367\330R\223\263\322b`\215\250\212C\330.\001\017\0269\003\020"
+	.string	"o\23173\264\327\030R\026\325`\202\352\034\345\377Y=\256\331v\270\fn\203\tM"
+	.ascii	"\315`X\200\n\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonPress.37.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\035\f"
+	.string	"\266\326R@\020Q\225\016p\016\307\270c\305G[y\022\037l6\t\257fe\212x\333u\004\020\035p3\2645\344\037\351\237\003\254\201\220@\022\001\030\201\346\241\006\346\035)\005|t1\200w\335,\331{\357\224\002?"
+	.string	"B"
+	.string	">"
+	.string	"\017\200\235\332\263q<,\261\177\301\203\304\302\265\273U\232\356}\312\350\371\023\020\364\331\341r\026(\205\330\001"
+	.string	"\024M\0032Z\244\257\0363\200\243\030!\230\335u\374@\0167\275m\007\266\033\330\207\020\207<\205\bW\216\b5v5\274zl\213\302@a\373\024\333Su\341\006\003\031m\005\013\274\207\237WVD\303\004k\227eq}\264\177:\312{\n\303\200\312\216V\037k7\264\370@\344\324\341\005`\247\221\273\377\342\035\003\233\322\246\320\211\377\214`\306i=H\320?F\274\\H\177\260K\t+\033\243\370\341\207\277<a\322\001\002\365!\024_v\b\212\222\204\375\271\273kY\262\257\372\351S\377\244\321\001\331\246\302\003\255\323e8\222\r\267y2\235\306\341$\230\263\213\226m\026\264\tYW\271\255n\266\214\246f]\247^\b\230\343h]\365p\\W)\341\036\023\222\2429\211T\326\277\305\345\206k\260\004\377\212\253\340\"\033\025"
+	.ascii	"o\231'3 \f_,l\026\201\352\330\033Dh\020HQ\215\313\213X\376&|"
+	.ascii	"r\r\030\207\241A!\270l\253\021}F\013PQ\304]~\252\275)\232\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_runcamDeviceSimulate5KeyOSDCableButtonRelease.38.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\315\b"
+	.string	"&\321=80\345(\035"
+	.string	"\21691\033e\001\203?\315\331Z\036S\006\230?j\300uE\222P\177\314\201\322\232\327\230\276 L\027\206\002$d\360W}M\220\"\252\226m\237\333J\231R+"
+	.string	"/"
+	.string	"*"
+	.string	"\234\013`\177\356\354\227G\220=\212\006\206\311kw\241~\274{v\376I\336A\251N\317\215\302\356:Q*\216[o\333\300v\202m\227\177\276\267\366\025\303 \263\233\n"
+	.string	"`[\236J\210\355{lg\2348\201O\373\"\037\351\356\242 \b\330\213\222\214\224\335\370\361\001\347\317\361\003\330_\251\n\237\367\n\246\033/a\b\367M\330\347\251v\204D\036\345dY\245V\333\241';\236R=\354kvw\255,\373\361\327\273\002\331\310\264\240\225\270\020\251\2039\003i\231\bBk\3108\270\211\340H\024r\200\031W\202\240\002o$\215\203\017\333\306AO\334kVY~\255\235\201\251P\013o\002\f"
+	.ascii	"o\231'\023\372\375\002'.@p\rh\205\241A!\270\f\214\bPQ\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getWaitingResponse.39.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\213\n\2655"
+	.string	"\372Z\024\024C`\350\325\030W2z|N}"
+	.string	"\020\240TDI``\243fsH\357\231T\024\037\330\235\3124\222\306\324\252\341\370\347N\346\275\313\316/\273\333\234\227:\343\202M\365k\231\230\021o\204\322\210\224R\312\224R\n6\001\027\001.\001Mn\271\267\270\375Z!y=\304\276\346\336\227\271\324)C`\335\231\333\254\263\340h\246\024\n|\253\216\350P{_f\023/`;5\200\366\225^\342`7"
+	.string	"3\214\353(\253\353\252\013\335\3732\207\314l#\265S\266\205j\247\257\204\213\334m"
+	.string	"GFEB\242 pH\350\347k{<vUS\364\335\345N\337\214na\266\246\032@\273u\364#2(H'n\324\206\374B)4\233x\221\025\327X\013\221\342,\313\214p\2115\021\02341\017F"
+	.string	"\203[\322\300nC\206\235-\361\241!-\204\n\2058\351t\033r\b\312D'JW\322\177d\355\353f\243V\330\234-\353\214p}u\333C\225\346\310\374\3516\244\027j\244\345\004\253\233]\316;`\204\313\253Y\224)\b\0307\335\206\f\202\n\337\246\034i\265>"
+	.ascii	"\005\351\345+\252$\0045b;\"\327n]\271\212RH\266\361\321mH0\264"
+	.ascii	"\331\216\310u\323\312\323\246\032k\364\265\2741\276\205\331\362"
+	.ascii	"\321\217>\230\003\313\"\264eD[\2556-]\246=k\253\312}\255\360"
+	.ascii	"\276/;\326\026Ws\200fn+\314l\201\231W\025?\006<\202\357\253A"
+	.ascii	"T~g\242\331\254\031\360\356\0169\246g\\\362\231\250\026\370\266"
+	.ascii	"\322\254S\345v\334O>\321h\210\354\373\276\020\270\327\372\f\n"
+	.ascii	"\356\261N\371\251\350\215UT;-\360f;\226I,fT~\307\3144\372+\231"
+	.ascii	"\033\302\361]\303\217\204yuvjbZ\235\227\332\331\254\244:3X\235"
+	.ascii	"\027\254\316\n|\316\t\372\331\234\244:#X\235\0134\263\033iu\036"
+	.ascii	"P$\354-\315D=\347`\353\fT\235\207Tg\241\236\363\257\347\354\343"
+	.ascii	"9\267\252sou\346\361\234Y\325y]\235U\3269U\235\321\325\371Wg"
+	.ascii	"W\235\333\201\3232\371%\346\365o\314W\353.\320\033'}\222\265"
+	.ascii	"\263\373\331\275\245\237\271\237\334e\210csi\2556\243\2710\203"
+	.ascii	"&Df0\267b\332\311\215\306m\030\0345\232\013\017\235\204\325\340"
+	.ascii	"\016S\343\345\352.\2574K\272\376\322g\314-\337h.L\300\t\222\344"
+	.ascii	"\362}\337\366\006\267\027n;\275\321]\\\364\r\302L\372\202[V\241"
+	.ascii	"\300v\2122\343\340\016-\364C\217\316\371\340S\274&\364)\0325"
+	.ascii	"f\277'}'\205\n\302\332\203\364\276\377\275*\310*it\243\264 )"
+	.ascii	"\33778\242)cv\2454 \"{\024\246<C\327\247M\362\336\267\317\354"
+	.ascii	"\226\271"
+	.string	"W\f\034\177\212\256\345}\357\017\357\033\034\327\312\274\216qJ\357\225i\332\211\354\342\212\360qc\275P\245\361\0168\372\351\257\317>\267\232\233\305\2027\026\257?\365G\037S\354\n5\301\247P\343\013\275g\205\036\027\030\270\307Z\250\235&\370Vk\017\323\n\304\031:O\213\"\270!\034\373<3\365W\r}\207\250~sYb\326v\240X\346\r\035\307\201M\177\300\332?\372\216v5\210;4\334\177\331\0343eh\0241V+\232\n\237\210\250\372\267\221f\035\017=\207X\302\177=\246\325\371\352\320\326\324W\362R\367G5\3370\177h7^k\033\021\242\277\233\355cct\177\246\2173P\372J^\335\252|IsnW}Ae\314'}\323g17\372\312g\307q\233\340\260\372\311\354Vi8!$\300u\332O\026\321oH<\200\353\324M\322\243w\260\0026d<\275\r\031\027^\304(F\25518\024[\260"
+	.string	"!\303E1*j\306\323\217\237\234\212O,h\024U<E\r\241X\f]\260@\321b\370\024\025c\350$\200\241^\024\243\2062\240\240\242\206-\223\212M\033\t\237\321#\341\267bU\256\322|\315\326E\237\3650\312\342\324\315Q\275\221\r"
+	.ascii	"\244\017\376\377i\266\251r;\227\003\206\025\345HJ\r~\343y\342"
+	.ascii	"E\244\202\235\244N\277\036?lE\214\204L\317(\332\364\302\317b"
+	.ascii	"k!\200\270\267\"|\334\342\032}\337\367-\n6[\277\2402\206H\351"
+	.ascii	"\231>\213\205N\037\342dv\307<\351d\021\016\346_J\013\236\201"
+	.ascii	"\t\357r!\013\210\0248\371\204\003!\262?\024|\243\005_I@\3553"
+	.ascii	"6\341=\270F\200\301y$\361\027\246u\327Du\351\235\276\357\030"
+	.ascii	"\335\274$\215vdSm\200Kg|\302ux\326\322\367Y\273\031\017$I,fC"
+	.ascii	"L.|\006>\267\222\212Z\335\\\325O1\301(\351\204\\1\025\030W\345"
+	.ascii	"vK<\207+6\002\370\353\361M\231\267K\2462\273M\374\350\222\215"
+	.ascii	"\230\320D.\271\354\003\306\356N\311\357\225HF9)\276\2417\362"
+	.ascii	"\232S\200\313\250a $\235c\212DDD$I\222tp\002\021)"
+	.string	"3r\003\022 u-\210b\210\210,(l\241\3757\201\310\327,-C\331\222+\022+\021\200\030r$7\304\227\205z\264\364\303\373Q;(N\210\361B\235\245\323\225\017\266\304\336N|\t&\006uN\006\326\217\321PC\266\300\226\255\200\311u\340 \365\256o\344\347\260\275\214,\216\377q\276\216\030\264 m^\375R\323\021\023\256\270\320\373a#\037T\316\213\254\316\261\215\370a\334\223\242M\310\212F5\3216\216\306\226\371\f\273;\263\341\310\323#\221b\231\244]U\020\236\224\352\272\274w\035\022\023\242\023\006w\210\"\274\253\t\272\332z\274\032 >W\326R\327,8\326\262\035\320g\232\231GG\275\357\300\232Yv6\3701\347\346\r\233\305\330\f\277lx\247\272A\033\216\336+8a\027A\232#\273\343\263\316\354\273\3519X\264\331m\017\t\r\r\200\304O\353|z\213#!I\337h\210c0pXh\036\005"
+	.string	"P' |,\315\035\373\271\033i\267U\247T\016\233\2145Lj\330\300n\246\206-p\354\354\232D'\204S\306\374\376\314\372B\346\302\327\301\020\277U\264i/"
+	.ascii	"\037\361\\\025\255\245\323\331\341Q\367\315l nJ\353\262\372\032"
+	.ascii	"\256z\254\231$\020\372`\021\026~\212Qs|'Bsm\232'\037\360\031"
+	.ascii	"\241DH\037\221eH\225\372!\213\002\357=N\335\337\311\037\"\026"
+	.ascii	"\251uz\2704\033\2122)\344u#\217#\021\353w\021\301\341\223L\347"
+	.ascii	"\030ZJ7\344\272L\263(r\0325"
+	.text
+	.section	.gnu.lto_rcdeviceReceive.40.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\203\017-P"
+	.string	"\312\207\\\036P0\222\322\031\016E\376\250\330w\006B\346\246Q\271 ]\030\302\2554\240\362\tL&a\363\370\245"
+	.string	"]\314\343u\246n\004z"
+	.string	""
+	.ascii	"IkUO\307\030\302\234!ff\036@4R\004\001o>Mj\374(p\242\342b\246"
+	.ascii	"\232u\024i\323&[\312$\003\325\001\260\001\324\001g% Q)W\"\033"
+	.ascii	"\274\271\221\331\335HO\330\233-\360\275\023~%\205s5\242L\201"
+	.ascii	"\204I6V#}\257\277\\\340\256\362=\250\267\222\302W#\362\367\202"
+	.ascii	"\2231t\353\252\024\340\275mJ\337[ez\336=\331\313\324'W\330\337"
+	.ascii	"\272rU\001b]\225\003\254R\372\036\322\201\320\367\316\373\240"
+	.ascii	"\357\355\252\273D\\\331d\275\226/\307+v\353\272.5\2234M\207\316"
+	.ascii	"\237\312/\321&\235\352U$\245@\201t\342\310\250\310\004\321\212"
+	.ascii	"!\241 \240\037\237\036\236\035\235\034a\020\210\363K}h\357lV"
+	.ascii	"\367Ab\226sY\260\250\256B\016\251\266<[a\0259i\355)b$a\2428\017"
+	.ascii	"\240KR\345rH\264\023HD\256\207kIc\244\2643>Q\345G\247\317\221"
+	.ascii	"\264*g\2133Q\264\216\226d\243\"\264/\220d2\311\356L\234\276!"
+	.ascii	"Dp\270\034\222\312\031\003\217\216\355pN\230\310\230\305\303"
+	.ascii	"W\234\276+\344\231\313!\1778c\324\025\241u2G\001\206|\302CK\262"
+	.ascii	"\306.\204\"\b\312\201N\0258\234D7\360\017\231\357`rU\307\225"
+	.ascii	"5v\037\337\023\334O)cq<\274\347d\"\243D\r\016\030\322\006\346"
+	.ascii	"\371\342\235&\254C6\003\347\224m\261\320\367\304\225U\366\340"
+	.ascii	"i\300\020;$\227C&9\203xG3\007C\"a\340\345\220i\007C\312\3008"
+	.ascii	"\020\274\331\245\375\227\036\fi\204}'R\230\270\343\211\256\031"
+	.ascii	"\356\016\206<\302\350\031\300\226\030\030r\260\216'\020\031%"
+	.ascii	"j\200XF\356\235HrH\255\023i]W \326\020>\317\031ec_G;_a\t9\333"
+	.ascii	"\n\026/\007C\252q\177\371S\312\030:\262;\256\254\265\263\357"
+	.ascii	"i]\327\345*\254\254\257\322wynw9\330\025\026\020\257b\321Hk@"
+	.ascii	"0b\236!\241\202&f\257\215\206Hs6\260\355\210;\264$]m\3476\200"
+	.ascii	"v\017\227C\ba\274\035b\356\335\007\"\340Wu\323\240AHS\355\356"
+	.ascii	"\004\237\003\341\214\n\025\370@\337\343f\372\332\013n\306G\272"
+	.ascii	"\256k\323\276\214\n\206A\372$\005\364\2757\030\034\334l\225%"
+	.ascii	"\203p\263\313\244\261r\326\355\265\253,\362\233\344\3024\331"
+	.ascii	"\356\332\r\362\362\b\362\356\320\221\343b\2768n<\356\233\300"
+	.ascii	"\223\r\036\336\032<\2744R\336\031)/\002<\2742\234b\300\b\362"
+	.ascii	"61]\355\373\342_\276.\336\366m\361\263/\213[\371&\001y\217tx"
+	.ascii	"\215vx\213txM\344\360\022\371xK\004y\207\202\274BA\336\240 /"
+	.ascii	"\220\217\367G\207\327'\207\267\307\307\313\003\344\335\t\362"
+	.ascii	"\352\004ys\202\274\302 o\320\307\013\024\362\342\374\355\373"
+	.ascii	"\363\361\246A^_\220\027\305\341\355\375xO o\343\360\362\217\367"
+	.ascii	"\f0\231\331B\342\004L\317)W\"M7k\\\217\r\312\337\376\270\377"
+	.ascii	"\313/\346o\373\325\376\263\337\312\323\335\357\271<nOf\201[\324"
+	.ascii	"\007\361\267=\334\002!u/{0\037\303@X\234\2300\304s5\262\266\232"
+	.ascii	"\224\303\020\257\\\211\334-\203\364\275/n@\236\212-\254g\332"
+	.ascii	"\2303\037K\335\r\310\220r\315\372\326\330\031\231\335{kA\332"
+	.ascii	"\245\r\005&\335\002i\020\373-RgSJ\251\220\251\226\271+:\036\251"
+	.ascii	"\324\036\b\251\253\021e\214\271\221\331e\331\257-P\215\005\346"
+	.ascii	"\031\231]\216"
+	.string	"c\271\226]\340\236\360,\313b\207\260-\262\373\260G\333\027L\352\0037\272qj\004\332\204)X\216y\251X2\016H\003T\206\030\247\226\321'\363\223m\254y\314\013\362sfD\332\017\214n\352\030\3755\307\"En\252\\M\315W\254\264\n\270\213f\352\303]\305\322l9g\026VDs!\214\217\026\020\025\314\031%\372'%m\212\021\232\304\004c6\253\330p\021\n\210\373'\335\242\337\345'\0363\t+-\245.\307\036\033ND\207:'\357\205s\250\225\332\372yG\322\3604OD\205Z\310\205d\241.\032\303\2754[\226;A\335K\370\212\002b\372\240\036\022\342<E\336\034\321!\242@}\260\343Q@\004\352s\215\225V\020nV\375\264\317\314\354.\371b\231\005K\216N\037\355\f%,\212\020\307\030\210\b}zW\335\201[P\305\212\232\250U\261\351i\237\3761\357%\240/\272\247Q$L\270#\027"
+	.string	"x\247yZ\200\357\252T\3242~\325\213\276\f4\030\233\212\205"
+	.ascii	"\341\351_\371\332\351\257\275\247\305\374\341\230W\202m,M\260"
+	.ascii	"\275"
+	.string	"t8\bQ\247}F\037\246l\336\0275<`{mN\013{\250V\3415\247\201W\232wIa\347\021\177\232\274\212\315\333<\330\302\356#\214[En\272!\006\2737$oJ\222E\357\361> \0261\367@\320\367\016\3702\202\323i\003\273\325\214aEn.\3328}\252\035\363\022\270\035\220\264{o\276p\03365q880l\255\315\205.\227,bH\374\266\r\250\267pL\302p\245\257\273\257\205h\316'\177\220\262\364\245\275\004\224E\007\331,\321\ba\274\257\332\230%4\240\355\265?\021\365\365\271p\334\b\242\257}1$1\345f\326\330l\350\021QtW\307\351\210h\367\256 1\245\210\025`\200\003\"D\205\320\303\251\021z*\n\004\250\016\034\360\361c\270\003j\b%\354q\250!TC\335\204)\2506a\n\307\bRQC\237\324\004Q>zH0%B\324pH\204\022.\224\213(\250\036$Dy"
+	.string	"5\\\372\321cI\204\036\035\370X\202\032J-\271(\261?F\210\032.M\375\3701\\\002*\203\274\273z^\220wtA\272\350D\205\334\223\272\245,\321\030\300G2\250I\370UI\215D"
+	.ascii	"\357\2525\250J\370UG\375\345\177eT\342\356\350\212M\265\377\271"
+	.ascii	"\256\353\232\324^^R\264\227\021\352\305bR,H\002\307\243\303\210"
+	.ascii	"\302&Qv4\217\376\232b\031\263\255\342\001N\252(A\261\243\317"
+	.ascii	"\303\265\254\312\204u \246\f\205sP\277vU'\352\r\374*\365\006"
+	.ascii	"\364\275\035}-\347\344U\327VY\322\306\2233o\220\214\206x\242"
+	.ascii	"\212\031\265\317\330\345\204\022'\365\026\365\336\253\ryG'\244"
+	.ascii	"\251\334\334\276\312\034\265\327^\215\202\026\241\321\201\277"
+	.ascii	"\324(E\3553r1R\305\320%\252\330\021\332YtY\033k\243\325FYD\004"
+	.ascii	"\243\177&\272\216\326\020\265\211\026\375k\242\035\314\324\212"
+	.ascii	"sX\270\024M\234+\234z\252.\331\363\272\303H\335\324\255\255\310"
+	.ascii	"q\236\210\342h\253\303\375\227C\335\333\n\246\336\263\247D\273"
+	.ascii	"h+\034=\\\242a\254\343\350\034\235\034\2333n\325\301\311\021"
+	.ascii	"\265\327~Ew\355\017\214\320\215\037Y\035\021>\251\325\236B:\322"
+	.ascii	"6uo>1\332\251\255x \241\262D#\204\365\206\311P{\255\324\222\240"
+	.ascii	"\247~\230\021W@6ZG[\355\3524\233\315\346\225\320\004\372F_k,"
+	.ascii	"\t\343VQ\250\275\224P\247~j\247-F7\305 V\230\232\240\032m\243"
+	.ascii	"y\3151O\003\224F\327\350\037\213\314h\032}\266\035\363Z\034\201"
+	.ascii	"\236\321\001\2013\250a0\344\030T\246HD\244 I\222\3261\005\204"
+	.ascii	" I!\255\007\021 \265cP\315HR\2206\022\303\231\217!~\311\266\177"
+	.ascii	"\375\0337\261s\314\3708n\224\350\031\200m5\251\022\3110\002n"
+	.ascii	"\234\\\233\365U\222\006\377)\"@\032\261s\341\035;\033\240\310"
+	.ascii	"\374\007\312^s}\272\230\311\001\322\233\325\324C5\2441\002:*"
+	.ascii	"c \212\026a\177\245\241\0270B\367\030\241\224\177\276<\331&\257"
+	.ascii	">c\370\207\250\206\224\270\306\251\2154\323Hm\262\363\215w\322"
+	.ascii	"\f\264\226d\177\356+\025YP\255\244y\016\201WN\204\005y\246\317"
+	.ascii	"BSp\372\321\036\272\020Y pg\313\030x\311~`\0236\234_)\021]\342"
+	.ascii	"\005\364A\013h\304\003V\206\343\346\002j\262\311\333I!\357\331"
+	.ascii	"S\230A\023:L\251Y\236+\336Q\b\362\031\033\006a\356\257\2065\365"
+	.ascii	"\336>\237]\306\355hlUe\352\304U'\200\356\321\326,\310\214o#\361"
+	.ascii	"D\207\356\326^\027\2070\213d\235(\001\0262\214\241X\271\235\341"
+	.ascii	"]\341\364\364g\005;\2116\277b],k$\330\236\030\022L\255\363\275"
+	.ascii	" \202q\340BZu\237!7fg\001\354\226X\n\316F\241\302\206\034;\234"
+	.ascii	"A\320\357\232\353\320R\337\243q\337\252\034\270\3128AKk\305\017"
+	.ascii	"\355\373\036B\302\263\256\026\274\257\222]\214\036\344\346\352"
+	.ascii	"M\363\226\001\205\366nC\024\333@\372\335{\351\316\251`\215\301"
+	.ascii	"\205W\016\270\312O\331\367\221\277\275\275h\223\204\300Q\343"
+	.ascii	"\322Dx\322lT\322\016}\241\221\350\213\026fs\233\33631D\243-\342"
+	.ascii	"`Y\247+v$\276\200\211\031\022@6L\375\320\tv,\272\312f\001\f\240"
+	.ascii	"\246\266\022>\364\177!\246\022\013\236\210qX\030\021o\332\351"
+	.ascii	"\030u5\220\003\371\233L \367\326`g\355\346i\301\323NAK\020\337"
+	.ascii	"\0352\310\362\030\336D\241\203\367\002\300+\307*w8\020\262\f"
+	.ascii	"\261|\027b>\016SQ>X2\0206\240Z\022,\272\255\276\273\241u<\203"
+	.ascii	"\306\315w\256=G\373\\0\n\241N6\200mD\004X\020\252\004\301\223"
+	.ascii	"\035\207J\212\350\033\201#zo_j\327\367\357\003 \322\037a*esS"
+	.ascii	"\333\226\3045\303\355\340\220\304x#\344\305\001\tL9\"x\037iJ"
+	.ascii	"\261M\3740\344P\003"
+	.text
+	.section	.gnu.lto_rcdeviceRespCtxQueuePush.part.0.57.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\307\001M\020"
+	.string	"\346\235iG\360\316(\035\362\204(\314\264\030w\277\301\312\265f\307\036\001\261\225\363\234\222\030\222\263\0137\241\317\242i\001\245\342w\333\001~F\226w(r\t^My8\273\277\316:\226a\203\1772\311\231\267\033\177\204X\262\267\334)\005R"
+	.string	"V"
+	.string	"S"
+	.string	"\353B\203\365\354\206\007>]\240\373tx\016\356\263\373\006\367i?\204I \254\230m\223@Zv=\234\301\204Z`/:A\273\241\367\251\033\356\272F\351\362\343KF\341z\333?>\374hxa\223]x\024p\0312\355\256;\f\367\274\355\004\266Mv4\005\321:\243\343\303\377\031\037\035"
+	.ascii	"\314\354\302\334`l\206\351\343\341;\267\257\303\362m\026\355"
+	.ascii	"\260\034\363I\274\326z\t\377x\270\204+#\305\250\020\021\264\273"
+	.ascii	"\006>]\352>=\3447\270\226-\262\214\247\345\254d\316j\305H\343"
+	.ascii	"CV\270\026b\326h\377\3468\255\217X\031\020 \240F\351A\314\355"
+	.ascii	"\005t\237\024\021\337\306_q\237\266U\336#\3021\333]\0046\352"
+	.ascii	"<\0214f\237\222\005L&\252\352_b\330#?\001v\273[\362ML0\361m>"
+	.ascii	"\375\025\3563\352m\217 *\270\230\271\301a\211\267\2505Vy\271"
+	.ascii	"Jc;z\236\366K.*\220\201\004TH\203\325G\222\241r\242\240D\365"
+	.ascii	"\245B\037\312\207b2}\032}'T\312\007\341\224\362@\224G\202\n\031"
+	.ascii	"\361N)\2257\"`\260\344Ky' \230\362D\227\2534\276\355\013Zp\250"
+	.ascii	"\361\304\337\305M\205\331\236j\023\213\266XUk\334\301\245p S"
+	.ascii	"{\001\375\035\234\375\035E* \200\202!\313m\003\0202\306T2\270"
+	.ascii	".\r\241\220\300E\0013</\224gl\211_P+Y^3\340\345K\254\031\271"
+	.ascii	"m\221<\217p\307 \322F\221\350\240`\2348\355\372\306\001\321\202"
+	.ascii	"\260g`\223\375\022\337\245\351\020\310\322f\023\377f\026Mn.\b"
+	.ascii	"\255\001\212\303\250\007\2220p\351\376k\337\030"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV1DeviceInfo.part.0.58.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`N\001=\r"
+	.string	"\346\026SA"
+	.string	"S\234\016\240\ri\237\002\n@5U\342\235\201%M\246\227\317\236\325Z\366eX\336#\214\016\261Pt\374-\351\273"
+	.string	"4\004UUU\005\200\244O\370 \230*\3271\3069\016\212\370\326v\267\275S\n;"
+	.string	"B"
+	.string	"C"
+	.string	"\330\251\305\007\250\247\330K\352\251\375\026\266= \203\366\216\213(\366\nul8\251v7;\235'\016~J\013\364/|\202x"
+	.string	"qIr\353\272\354\256\261\0207\275\355\004\266\025\330\277\021\333a\374\261$hj\305M\267\377\302\343\237L\261}S\351\223\225\322\367\325"
+	.string	"\232p\b}\360\330\025+\247>\200\235R,\345E\217\270\037@\226\322\376\350$\360.:\002F6Ci\004jWDpj\003\001\266\203\323\310"
+	.string	"p\367\031\021BdT\320|\365tRb%\352aKx\214\217"
+	.ascii	"\216\335]\340\303\2600\301Oq\352w\352\251\234?]\252\020\221#"
+	.ascii	"4\"}\344(g\350iY;M\334\362\342\377\253\300(\022\332\233\306q"
+	.ascii	"6L\245\260\321\2465\313\246q\234\r\243yY\307e\0178\006\231L\363"
+	.ascii	"4\231e\200;\b\233\227m\272\316\313(\277|&\006\3179\303o\325\326"
+	.ascii	"nc\243\251Qt\235\253v\203\243\270\032\027\213\225\352\231\032"
+	.ascii	"& \200\202!B\333\001n\005\360\2713#\330H(\335\316HX\270\321\001"
+	.ascii	"\270\204\206\301\227\222\210n \353)\265\003\335\016T\236=\333"
+	.ascii	"\002y\035\341\037\246\230a\341\330h\266\"\312\356\220\204\371"
+	.ascii	"\002\205\251\321\334E2\275f\251\315\264[`\344\274\262,H\274\346"
+	.ascii	"\350\233~B\037\003"
+	.text
+	.section	.gnu.lto_runcamDeviceParseV2DeviceInfo.part.0.64.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\342\005\255\""
+	.string	"V\274\322F\200^Q:\223\341\207t\236H@J\350\026;\312\356\275\234\017\"\211\034\344h\364\360\360\302\207\013\256\330\242\357\256\200 \360\245\034\314\260\306\364\007\316UH\246\026\302\351\0320UO\351\030\267B=\2455\322\b!{'\031\267"
+	.string	"\264"
+	.string	"\302"
+	.string	"%\311\367\342\361\273\334\313\2770\332\305\343\342o1\005\013\274o\235\353]\214rYz?\005i<\254"
+	.ascii	"\211\211\330\302\264\240'\240}ttD\301p\276\244`\341^\013\323"
+	.ascii	"\331Qf]L"
+	.string	"v\210u\247C/9\302\311\265>\345\245=\025\344Z\231\237u\342\275V\223\220\200\376m\021!\323\235Jx\311\016\316\227\234\336\200\371\362<\001\363%\363\26303/\310\227\371\316\323a\317\254\300\240\270\310\272\333\366\322Z\375\276$m5/\277\367\262&\005\344d\005J\375\270%!\b\325\374\b \345#\r\274Q\022v\260W\036R\277Z\007\334\234i\350n>\251\316\2633s\0213/1\233\265|68\224\370N^\362\233\314\227\325\276\370:D\030&\314\":\325\262j\253\330\232'\333.a&+\243\264\3125\2622\r\255|\242\225ghe\023\255\\\326*\223\264\312\226\254\\\237\376O\360 *H\330\335\243\354O\037)\213P\356\345\357\362{\375_\257A4\234#[H:\234\272\220\225b\221\365/\035\332qN(\035N\325\250\276<\375!\353Nm/g\314\347\2339\0303\3124nd\353\343\317Uw\323`"
+	.ascii	"S\366\\\315\364\214\355nd\232\361\210\362\303\034\f\277\370\305"
+	.ascii	";\031\245*\224v/(\346c\356\311(\245\200Z#\326\035<q\276<\373"
+	.ascii	"\355\305\214>D<@\252S\312\0300\317\314\232\366\264f\230'\241"
+	.ascii	"\257\017\331\314\236\213\016\261Ae\276U\256\225z\240i#\3648\343"
+	.ascii	"\306g{\\Z\346{\345\305\233\305\332\311\372\361j\351)-\252g\254"
+	.ascii	"\017\261\334@3\216]\035I\313\334\341E.C\256\001\346\261\226\264"
+	.ascii	"\207\n\304\036~\347\303\331\375#\342\207\335N\b\021$H\230/\255"
+	.ascii	"\005`<\366!\276\354L&s\211\027\231f\306\343\325\221?\247H\301"
+	.ascii	"\234n\247\003\371q.\307\004\212\242z`\221\251\342\305\025\007"
+	.ascii	"\2067\262\312\200T\003\352\373\234\306\034\372\215/6\025\030"
+	.ascii	"v\367\201\314,Z\004a\271y\262=\016\252\3252\337p\365@^\360\263"
+	.ascii	"=f6z\233\245\263\273\211\002\034\303\b\311FR\007\334nF\016i\207"
+	.ascii	"\323\241\346RnD\200]\322\021\207\030FG p:\245$\0278\030A6\222"
+	.ascii	"n\226o\023p\267\243\032\270\0277\235-wd\233q\344B\206\355\246"
+	.ascii	"\333\331& \340\034\022NgK\312\345t6\364\032\234\254\257T\"\273"
+	.ascii	"\223d\370\327/\246%P\230W\333$LT_v.c\242@n\220\034\266W\243P"
+	.ascii	"\002\200\206\220\025\352yc\335q\253\020\030q#\304\322\001v\211"
+	.ascii	"\334\"\245\355\261}\375\032{\203\304\332*\256\275\327\354\261"
+	.ascii	"l\325\371U?|0\276Fj\016\246\352\253\277\213\344*\271U\267\312"
+	.ascii	"|Y\263ZQT\204Y\327\212\017\331\221f\213Kp\002\321,\315\007\237"
+	.ascii	"+\304\313\3446a0\354v\272O^\274P\036\f}\250\2214\306\020CJFH"
+	.ascii	"\202\302\202$I\007p\002\021CG\364\022\340\226A*\221P\205\205"
+	.ascii	"\031\366\357\214c\242\b\303\302\230w\216\252\352\232a%\020A\234"
+	.ascii	"A\334\\\034\321\264\345\263\2154\222>\364\033\355\304\t\225V"
+	.ascii	"|\004\261\017\2176e\215\021]\250l'\204Q\262\305\332m}\374\215"
+	.ascii	"S\376T\260b}x\034%a\373zv\210\350\255/^\bI\327\226M\027E\313"
+	.ascii	"\023(\323\206Jn\333\222\231\240\366\370\360\346\005o\222^\327"
+	.ascii	"\364u\262l\337\004wA\021\365\003U\207c\204{\314LwQV>$\256\245"
+	.ascii	"+\307\274\315\335\222\344\013&\3242\240\016\t\363K\206\352\177"
+	.ascii	"\006\237\002\340\3570i3\375}\246\225\346,\342\201\036\233\021"
+	.ascii	"e\025\227\340\016g\b\372)\235\034\205\303\004\261Q\320\221jB"
+	.ascii	"\240\345\rV\232\267\271`\272\3272_\270\"\347L3\024!\334\272\336"
+	.ascii	"\203\354\256)5mO\306\334' <\272L\223\233\266L_;\370\001"
+	.text
+	.section	.gnu.lto_runcamDeviceSendPacket.part.0.65.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`\271\003\365\030"
+	.string	"\006\354\231F\300\032'\035\222@\024\323%`\241\220o\253\266\240\324\307\006\\\213\202D\250T=\n\331\253-*S\210\376G\322\262X[\263\215L\313\246=TW@Fa\234\345\304|z\271\367\243\263V\2454F3b\311&[\246\024}"
+	.string	"\177"
+	.string	"\210"
+	.string	"\024*\204\177B\3439+$\006GK\365c\355N~X\343\352\270Y\325~\223\033\205w\362s\235\335!e\226vG\t\237~"
+	.string	"~z|\201\357\023\374\200\357\323>\023\333\265\233C\373\314\307\334\246\204@\331@Z\263\273\255OY\344\341\247'\365\013}\240O\021\327\343\236\2128\036\227\336\0021`\224"
+	.ascii	"\300\331\274\006>\200(]w\275\201\023R\025\360/\245aw\r\026\335"
+	.ascii	"\251\333Na\273\204\355=\352\325T\253<5x\245?u(\377\347\251\347"
+	.ascii	"\217~o\252eJ\255\037\377\263\004D\200\332\315\021\005\265?\246"
+	.ascii	"\016\311\231n\277J\315\327\371\206\251\366%\037e\215\273\343"
+	.ascii	"v+\277\022~\311\347KtSE\031\272\201f\367\026\341\323\"\300\317"
+	.ascii	"o\316\215Rm\\\334\315\236\224O\t\237\344&/gmB\252,\355\356\006"
+	.ascii	"\360s\307\233z(H\264\211Dc\345\254\355\350\310\005O\177d\n\025"
+	.ascii	"j\343\346\360\324\016KvDW\\\030\034\\\244$b\233\366}\222\305"
+	.ascii	"\343\351\210\214M\331XG\247\334\361\344\224\020\224l\264\321"
+	.ascii	"\321S\271\233\276c\271N\005\350z\351EkR\222\335\220\004\262\224"
+	.ascii	"6\354\013\215@\216\313\275\320p\200\341\263\313\013\0059{\371"
+	.ascii	">\245"
+	.string	"$\221S#\026\251\264]\\G\303\311\231\021\323\370Zb\004p\022m\2367\2750\340\264\273\026\262\324\210\371F>\375\237\357S\345u\367\214rObQ\220F\251$b\371\335[9\304\006\003-h+d\017\f\004\216K\206\253C\3145s\301P\261\350q\305b\262W\352\363k\002\354\3053\003\306\3425k\311xZ=<\256X\3535\363iM@`\031\f\330\254%C&\233\265nl\3535\004I\241\351\343\355\006\311\200\346\211F\331\201\202R%W\322\016\227\204L\210$P\223?\311\300\335\265\260\222:\306(H\243\274\263\201\203^T\311'\371\261@=|\320\213\240\\}\331\331$\220\023\200!Fl\331\035P\225\f\234L\234`\332\ry\0044%?\211\"\005NRT\250\2010\307\2302\301L\005#\"\263\244I\007p\002\031\273\261\016\021\240=T\265\245\255\031A\350\332\356\344E\336\303L\247m\374H\304\"\364"
+	.ascii	"\361\242\243\275l\363s\320\325\341\024\340\2602\360\213\b\233"
+	.ascii	"\210Q\326(*\265BG\327f\217\300\362\016\200\375E\"?\n~1\035\342"
+	.ascii	"\264\217%\217\261;9\3723\334\002\tiHt\332\242a\221\031\232\270"
+	.ascii	"9G\243H\340N\226\302\027\342\352\177\b}f\262\374_\024\024\375"
+	.ascii	"\335\023x\324\027\253s=lY3t\351\025\354\314\261\"\243\244n\256"
+	.ascii	"O\356\356~\226\225\334\241\335\310\324\355\004B\223\332b\226"
+	.ascii	"\024\303h@\372j<\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`F\004\245\023"
+	.string	"f^uI\260\230Q\007`\f\222\260i\3029\nD\031\024\353d~\034\005c/\306a\357\205\021\221\037b\310\237ch\277\211\305\316\316\316\244\021\250\375\264\221PlB!\275\037\217@\272&3J\007\255\340\257\r\324\347\357\324\246\255$I\246\024b"
+	.string	"e"
+	.string	"\\"
+	.string	"4\016_s\373\331\034o\017\377\375~\277\r/\273\331\335$\2667\240\341c3\003\213\362\025+>\035\030~f^x\006b\363\260\3119Y\213ZH@\235\271u\267\202\013\245\360ld\304\243\375K\347ub\251{\357\315\371\034"
+	.ascii	"B\214\344\250=\rx\307\361\0261?\363\020\031]\033\212\232\202"
+	.ascii	"\363\256\311\314\324\026;.\352*\235\fu[\002M\352\341\330\324"
+	.ascii	"q=\213<5\371\361\224\263\310V\365T\211\022\323\336\272\027\366"
+	.ascii	"[{\220#;\037\030\366\027_s\361\007Z<\002\026\377`\305\343\250"
+	.ascii	"\370\233\024?\001\305K8\361\021L<\204\022\277\200\304+\030\361"
+	.ascii	"\016D<\203\276\3672\303B|\203\356)\031\002\3616\037\276\200\207"
+	.ascii	"'\320\341\003\035\272\035\333w4r5\364\036-\213\263z\375\362\301"
+	.ascii	"dI\265\276*\233\225\212\236x\323zH6\227N\202\244\310\254WR\306"
+	.ascii	"\372\315e}\306\326\233l\337Lu\220\354\351\323\213\201\344U\035"
+	.ascii	"<\032P\035\364\321TW\351`\325Ud\254\272\312\027S\035\327\374"
+	.ascii	"\204\310\217\037\032\300m\235\272\324\003\fc\251\231\211\211"
+	.ascii	"\250IL\361\364B\321y\216D_\221\355R\3429\321DO\302A.\301\210"
+	.ascii	"\276\323\336\344T\"\275\210>sq\\w\024\320\017\311\266XV\200\203"
+	.ascii	"e\267\220\r\336\330-\336A\315P7\250\224\265\305\301^\367\214"
+	.ascii	"\0359\"\226\2257\323lU\263\362V\215\236FIBPa*\f\352\t\245\207"
+	.ascii	"GJ\250\201\220!\24543\022FJSZ\034\260\002\231\242\252\007\021"
+	.ascii	"\320\214\206\0242\"\0233\201\324\314\003\250\226&\317i;\177\220"
+	.ascii	"\274\035\323\006B\013\352\312~#\"\177\261\366f\273F5\317\231"
+	.ascii	"\222\351\215\265\030\3234\031.\266\305\272.#\t\346u\342\230b"
+	.ascii	"h\347\316K\244\252Z\024\bE\261\250Dw\236Z\326\234\200\034\270"
+	.ascii	"K`\024I\005\253=xQ\211jJ\336\350\246'\254vH!t\333\242\326\264"
+	.ascii	"\266\357\322\331\242\310\210\2245:y\021\325\n?\230\372{\253y"
+	.ascii	"\025\3306\214R\346a\245\001"
+	.text
+	.section	.gnu.lto_.refs.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375 \204\025\003"
+	.string	"B\210\027 \200)Ic0\231\220\t\231\307\f\314\300\f\t\300\217-\262\0064\342o\315\266&wk\215l\222\002\217\230\031b\346\207%8\253\006\230\r\243\f{a+\314L\230\211\260\215\321\263\315\002 \013\204\236\332\324\345<\0305\330\211r)\237\203\022\306\202\321\201-P\320\245N\352\243.\0162\352\016\001"
+	.text
+	.section	.gnu.lto_.decls.6bfada4c9568bc04,"e",@progbits
+	.string	"(\265/\375`-=E\373"
+	.string	"\nu\325RV \fQ9\351\027\270\343\372\005\205T\036w\270\317\374\240\300Q\271\030+\366\353X8\304x\033\264\212t\377\016\207,\355\355"
+	.string	"\334\271\230\251Udh\254\003\341+r\370\355\212\324v\fC\277\305\343g7\3515"
+	.string	"C\252s\261\331"
+	.string	"\343p\247\2142\346\256\323odo\271Sm\004#\005:\005\330(}O\365\013v\260\004\027\304Xa\266\361h\334Q:\032\206L\247\347\215-\022\303\311I\343\b\340\241\024\337\310\211\221\261\026\245\005\230\366S\307\350\031oSur\375\3244,\022\033\241gf\302\224\331A\331\t\326h\033\366\331O\355t\374\314\331\203\207\034\230\250\264A\245!\376]K\177\205t\323\214^\026\325\030T\313\270/\322_\027\351\222M\025\262)\312\306\315\004\202u%\327\270\225rP/'\221\246/)\221\"\026N\251\f\013P\216\t\2243\356\356\005\347\022\034Qj"
+	.string	"\206\211Y\263\027y;l\222_\207\212\3753\222\227\0048E\tP'\213\025\2041dD\344\354~,\362\262\370\254\235\315\022'/\247\236\234!\3746\256\311\r\274B\353\304\356\211`\301\2149\312\263\021f\013\355\027;x\237N\230\"S[V\356\267R\372\254\335\035c\246E\312h"
+	.ascii	"\346\374|\273h\242~\321G\215\324I=\324Bm\324\313\316\335\242"
+	.ascii	"\213,a\263\260O[h\271\334v\261^\236\363\314y\231s\326\261\205"
+	.ascii	"\026\320b\271c\314\274\254R\022\200\250\211\0229\301\234\237"
+	.ascii	"\036r<\330\220\351HzrPC\030\204\320\013Z:\314v\303\360x\375%"
+	.ascii	"\270\005m\214J\337\023\367\210\302\266\325\370\017\264Z\2369"
+	.ascii	"g(\226\207\203\016+}OY\261Wn\266$e\331s\262\002\303V\241\351"
+	.ascii	"bR\322j\374&\262~\307d\315\232+\324t\3076\230\336fIo\243\244"
+	.ascii	"\267t)\216[\372\333==\324\271E\346\327\330>\261y\366\251\201"
+	.ascii	"\205r\225dx74\204_yQi\351\255\006C[h5H9X\256\364\326*\275\245"
+	.ascii	"\221\3329Kg\237\035l\335\255\022+\367\230\3453\233\305\354a\271"
+	.ascii	"\201\326\370\226\231\336v\030\336\330\016\303\333\241\224\203"
+	.ascii	"\3350\304V\303\020\004<\273\301\315\276\265a\"88\034\215\257"
+	.ascii	"\202\333\333\206O\302\362Yc\333v\263\003\211\023\252\306\026"
+	.ascii	"\315\")Db\027\327\330\246Y#"
+	.string	"\366\331\201=r\253f\327\216\n=\3633\347\347Mg\r\246\2255\306\261\033\206MLo;\030\336\302B\333\301\360Z\3567#\2075\305\244\361=\220\336\002\351\237V\303\320\226\2453\252\204\374\032_'\275}Z\262\337~Y0;v\213\220\232\031-\347'\006\231A-&\202\215\307~\020!^\205&g\260\234s\0065O\230\370r\343\333!\267@(\207\370M\372N\337\366\264\033\206\251\3250L&\371\033\356\357\025\336\376F\361\267\333\337%h\373[\004:j\266\360\026\262@\202\244\n\215\244\325\260,\340\277Qn\376\233\247ta\363\337&\177c8\033\352\031DZ\270\b?\016\201\217\n)\370\355\212\337\016\341\264\331\337d\367\340\307\006x\372c\016d\360\231\037g\200\303\0040\224\026#\264\340\307!\314h\243\260\337\236\365\022\030\327\r\360c\004\374\035\323_\277\245\361\267\220\337\312\370\233\001\035\344\031~\254\301oA\260"
+	.string	"\b"
+	.string	"\210\337j\200\345?n\326\337\017\360\321\\\315\343\267$\034\347\277G~\013\202U}\314\177\257~;\330:\254_\013!\177\273\302\337X\177\377\374\026\205\251\337\262\360[\025~k\202\337\226\220\372\255\361\267I\025\277\r\372-\007\035\365\333\343\337\033h\376\266I\277p\0214\324o\253\374\226\360\023\370\361\206\326y\372;\004\215\337~x\007\257\371\357X\216\337f\375v\307\177\374c\247\277\231\376>\372[\371\367\3727\320\337>\177\247\370\233\370\367\b\3766\3617\211\277!\360\367\b\177\203\370[\001\177w\370\373"
+	.string	"\177s\370["
+	.ascii	"\177c\360w\005\177g\370\333\346o\232\277e~[\370\333\300"
+	.string	"\337f\371-\226\337Z\371\355\337o\365~\213\367[\260\337\246\375V\353\267v\277\365\340\377\332oY\3746\304o\351\376W\371\177\345\355\267K~\033\367\337\347\267$\370\237\302o\341~\033\202\337\216\340\267l\277]\373\237\301o+\370\255\372\377\313o-\370m\212\337\266\360[\234\337\032\371m\327o\235\277\335\372-\325oo\374\326\306ok\3747\361\333\247\337*\375\366\305o\223~\213\364\333\243\337\032\375\326\305o\213~\333\342\267\017\370\255\003~\333\200\337\216\360[\f\377C\360\277\356\177\005\205\205\205\205\177L\n\177L\224\337\303\223KK\251\031EfRY\271\324Rb`f)e\221Y\316\030\362r\2514\241\2311\024\231\345\245L\364d\311\346\247\2242/\233\031C^f!\016EK\251\245\"3\241%\fEfRK\331L*\343\344\245\020\323\305231d3)+\331\254\271\204Sd\326\\*2\223\332a\203\270"
+	.ascii	"\022\203\311\017J\025\235u+Z\346\027I6\204\2308xE\317f\226\222"
+	.ascii	"\263Ec\221\231\034\344l\243\311\224\"4\303\266\r\341\275\030"
+	.ascii	"R\023jb\22044\325\314K\274\242\256f\316]C*r\222\b\312'^\316a"
+	.ascii	"\361\224T62\022\213\234\001\220\224\263\322f\274\234\2632\347"
+	.ascii	"\f\303\264\361\314\371\t\247\310\231\224\224\263SNR\266\241t"
+	.ascii	"c\221s\243\365\265-\025\231M5u\334\316\314\234\271\305Si\235"
+	.ascii	"Y\212\02435S\216e$,\251s\t\306\025\266\333\347e\273-.\360\314"
+	.ascii	"\312\23357\253'\301\314tJ@JHV\345\307\023\311Z\315\016.\262!"
+	.ascii	"\265\034\373\342\t\334`\220\324\310\360\351\312\215\261\306i"
+	.ascii	"\3039&\240\214Uzv\211\334\262Kv\213\\3\373\274hw\310\357\323"
+	.ascii	"&9\276h\366\313\r\033\362\003\274?\306\2708\201x\t^\264+f\221"
+	.ascii	"\334g[\332\242\214\n\340\r\"$\357\317\211v\277\036\340\244\007"
+	.ascii	"\230\327\336\026\2649\033\374\230\300\224&&/}\214\222\364\202"
+	.string	"Y\263\"9\2744~\314\220\3641;\322\307\324H\217\026\263L\337\266\301GW\334\222\237\225\306\267\307\345\262\317\333\365\\3S\325\206&\324x\005\314\343x\334\257\225c@\346\234[7eO\214\2024\376\335\322*A\316hx\206\213 a\215w\344h@\252\b\253\361\323&\351Ch(v\320\346\346\fE\207uu\330\347\315\2728\236!\262n\216,\036VO\303e\024\214\300!~\n$}\312\224^+\235\337+\007dQ\ti|oUS\224)_\215\247\256\224}^\252\033\225\003\366B\213\331(1\344L\025\346\274T\267\331b\031\f\025u\263P\211\023\036*\343\263\033\342\303PI\017#%=\f\024\250\246\323\262vv\243\3514`d\312\230\215\0165\\\366\206\274j\320\370P\005\311L\216\251\233\2009\335\031\367\3516\331\347\245qc\334J\2712\324\222t\f;h\361\234\034 \004\355\322\270K\326\316\342\241\231"
+	.ascii	"6\004\360\322\2700\354 \314\225\223\260+\307\203\007\017\350"
+	.ascii	"\023\330\034\240\f\266\031&Hz\030\253\3640H\351a\226\351\177"
+	.ascii	"\231b\250\031]\026&J{/\264`\276\224L\241%u\220.\341\216\200!"
+	.ascii	"\311@\313\350\204\b\035\001\271-\230\300\332\214\004\323\032"
+	.ascii	"ZP\264\\\f\221\226X~\267\350\267\205\275b\225'\243\361e13\325"
+	.ascii	"c\206\016\260\253\354B\255/X\316\265.:B\\e{\311\002\274D7\337"
+	.ascii	"\241+t\227\366y\007\233"
+	.ascii	"\360*\273\331\\D\260`\232 \332\001\230s>;\222\322\243\301\037"
+	.ascii	"\336\2451\314a\\\372\341Z\372aY\372\346\362\026\244i2\2012b\327"
+	.ascii	"8\216\306\316F\033\022\"1j8\241\270\320k)lD\240B\374:yFez7\244"
+	.ascii	"\274\265\235\236\322]7\251z\341\324q\322b\026\317\t'/\211 9\361"
+	.ascii	"\272\t\221\244\356k#\275\226\253h8s\316:O\354\240\215\022'\017"
+	.ascii	"\351\0359\373\254\373\272H\325S\3675\222v\253r\322\322X\232\257"
+	.ascii	"\2674\225\256\322S\372J[\351\277\006l\277\316\322\201\366\331"
+	.ascii	"}\r\367\036\322\317.}m\3668\233\3453/\r\253l\330#\035]K\002\300"
+	.ascii	"\035ex$\326\344\007\326\336p*\375\260F\372\341Qz\2640=\272%="
+	.ascii	"\372\327Lz\252\212$\331K\217\306u\335\\\315\2212\276\275!M\327"
+	.ascii	"s\250\222\211\225)\275\344=wcxaIi|--7\334\372\022\202\222S2S"
+	.ascii	"\304\307\224\265\306q3\\wEK\232i\222\206C\271\210\206\242\032"
+	.ascii	"\037U\246\307\201nmRjO\224|d\2629\261\251fk\0347DL)\251\277\364"
+	.ascii	"\275\3667Z\247\265 \227"
+	.string	"D\255q\037\321y\253]#'BZ\032?@/\275\200v\303\020\002KR\020\354\206\241\b\273axl$=\036K\017h5\fut\336cC\274\214\3115Nm\266\032\206v\260\363\356\220\206\3024\270y6%Q\201}u_\025\022\242\306\357\257\026b\231\344\244\266\032w\260\033\206\250\3250\264Jt\336^\230*P\251\007\220\037]K\030o\215}\f\207H\241\"\243G\312\243\271\272G;\355\263\273\032\307;Gc\301h\250;\306\214y1\324\007\330]\335\354)%\314\024\037\224\235`\b\335\325Y\255e\243|f\245\341\324\024(;\301\356j\252\2762\312\223\222s\223\247L#\222\301\255\325\275\243\267\336Z\255\203f\331Z8g!k7\260\261v\0034n\207P\331\020\037\353H\217\251R\364\271D\306\225\325]\362\242.\253\225\362\323\221$s]e\271\320@U=Ei\374Gzi4U\204s\177\250\322\035\022"
+	.string	"\277\242\265;G\263\346\344l-\t:\204\016\241G9M\245\025\007\310\215\365"
+	.ascii	"\273b\201pLP\243\243GWXA\220|4F]\3340\230-TM\212\356\334\f\021"
+	.ascii	"*$\\\215\321\026\026.G\237\220\242\306(\213\373-\251x\3245F\211"
+	.ascii	"\254\035\030\324\333\\cti\261X/m{.\354\337Y\016=1\"\201\307\202"
+	.ascii	"\201\250\362\346\035\021bs\364'U\345\345\250\362h6Z\235\2355"
+	.ascii	"\306\205\307k9\260\234\025\021\3425\036T\324\b\033\343A\017n"
+	.ascii	"t\211\372\362\3458\236\354\360\321\270q\227\2447\037\\\376W\243"
+	.ascii	"6\206\303\306\026\261+Wp\226\2344\203u\365\305\334AQ\013\303"
+	.ascii	"r\234\245\305`\310\262HQ\376\250R\005\003Z\234\347P\037\037\240"
+	.ascii	"\265\022\323\332\361w\f\0307\323\214j!8w\275\276&S||\230JN\363"
+	.ascii	"\372\341\025*\361\232\303\233\322\304S\216\251\024\302\3002\330"
+	.ascii	"\030\367\3419\276f\220\264\f\314\274<\034%\247y\371\204\266\230"
+	.ascii	"x\321\374\260Q&\265w\034\345\251*-\2521\206\202\365n\360\354"
+	.ascii	"\270p\350a\271\246\267'GZ\214\fL\313\220&w\277\303N~\227\031"
+	.ascii	"j\211\363f\251\223\202w\354\304\310\013mY\215q\023<\267\306\267"
+	.ascii	"&\2441f\362?-\204MA\fnqq\270\316\2465\013\225\b\332+RA\\`\272"
+	.ascii	"\343:\230,&UL\215\261\022<\207\211\270\2764\361\034^\342|\302"
+	.ascii	"2\250\006\3234\324E\016\313\335\250\033L:\206` \362\366\206\341"
+	.ascii	"\322\204\262\272\004\361U\227\260\276k9\206\353&1\\h4\007\247"
+	.ascii	"\236\307fO\334v\367h\262\222,+\301\260\321ay\t\346\"\247\016"
+	.ascii	"3cGcN\216\034\267\035\263\201\bq\277\324\353\307\236Pc\214\344"
+	.ascii	"x\315\351\356\rP\r\257qU\231\001i|\f\313\364\036\2205--5\306"
+	.ascii	"F\356\327]~HV\032\343\264\3079E\021\274Bc2\2257\324\030\023\301"
+	.ascii	"g\366\371:\\\3446o-\322\352\006\323\247\300\276n\210\311\216"
+	.ascii	"\313\336\240\252\244\264\214\031\331\253\341\004L\217\303\347"
+	.ascii	"\345\205\305r\322\034F\204F\232d\tv\025v,f\305\345\355Fc\f\326"
+	.ascii	"W2JZ\366\270\032\343 \370\253\260K\241\031\376\302B\214\302\262"
+	.ascii	"\260\365\023LI)\253I\327\325\205\177\200`s\213\263\252'\300\033"
+	.ascii	"\250\3245\303\307\361\017;(\023c\216\314\352\n/0\020\215-\275"
+	.ascii	"\226\026\356a\311\262\322\220\210R\023a\207\230\244\250\261'"
+	.ascii	"\036\307=\254\035MU\236\216)\354|*s\025'\336\212\271Be\312\322"
+	.ascii	"f\250\206\363J\b\026\026\326\361\2654st\243\257/\353X\207\rX"
+	.ascii	"\034 \227[\267\023\207%\330\3708X8p`(\036n7][\2160}\221\222\302"
+	.ascii	"V/\360\3502\274\275\257\252c\253\276rd\nU\273-\227`G\215\361"
+	.ascii	"\224\035\214)k{\026\2655\233\030\312\336\3007\210\254\376p\324"
+	.ascii	"\250\201\2410\2501\246B\226\231\362\3061\224LVX\024\\cl\343\310"
+	.ascii	"\221\0367\312\246&Lc\303\f7\232\034\315!\252v:\246a\303\326b"
+	.ascii	"\206Rc<\303\006\017\307\30010\200a\305\251Czee\211\035[\212\231"
+	.ascii	"\230\211\231l\316Z6\340\212\302K\307L-\207fa;\"F7\266\004\245"
+	.ascii	"\361m\300\360\013\374\342\342\331\234C\300P\332H\245\267A,Fz"
+	.ascii	"b\244\273\225\363\314L\027d\331\030a%Vb#=!N\354\342\330\310\262"
+	.ascii	"\2102\223k\214\213\332m\314\213\216Fc\334\302\016\226\3719\033"
+	.ascii	"c\026-6#D8\004\2521&\262\203~Q\260\232\215\361\262\233\330\360"
+	.ascii	"}\311Q\326\030\017=\256\246F\021\226&\215\261\320\375\3222\275"
+	.ascii	"(\277\266\233\331z\261#\n\212\340-\024\274\204\\\270\\\302!c"
+	.ascii	"VO\202\203\277\204\035\230Q\370\032\337/\355F\203%\357\t\213"
+	.ascii	"\306\327\213\035\274N'}9\032\337.-V\223\304C\250\310\343\260"
+	.ascii	"\f\267\257\273\265\3645[\201\267\317\033x\3570Y\206a\223\303"
+	.ascii	")\0013Z?\20045~\r\r'\317v\322S2IN\230\t\300r\225`\3519\232\334"
+	.ascii	"\314b\345&\261\322sNK\032\266(\367/\312\2552\314\331>\233JL)"
+	.ascii	"Rn\025\020x\370\375Vi-\033\"\301\266\302\306\227\357R\261K\316"
+	.ascii	"\264:*w\312\2248.\177\227E\222%L\270\032\367\235\007Q\035\315"
+	.ascii	"\217\3644MO\236\\\275\240%(\277zD\256\274(j|\363\356\237R\332"
+	.ascii	"\023;\210N\005Ra+L\2310\271xi\316y\314\352\311\353\342\311\340"
+	.ascii	"\021\t\366p\203Q\262b\365\202^j\247\206\304.\020+\311\245\273"
+	.ascii	"\241\021jB\342\344\310]b\023x\244e\346\307\225\213\213\353\271"
+	.ascii	"T\2313\n\224VO^3N\351\257\333}\373\205\373\205\3539\233\2319"
+	.ascii	";e\245\025\021\356\234\230\035.\323%\375\373\037f!f\316\231\t"
+	.ascii	"}f\346\020\315\360\267\267\250\265\035\376\032{-\0079\257\317"
+	.ascii	",T\005J\226\224\213M\250\006\207|\024/\347\245\224R\002R\001"
+	.ascii	")\212(\214\307\0216\253\361\210\254\300\n\252JB\203\025EQ\205"
+	.ascii	"\t\f\326$\262X\001\025)\212\027\2501\252(\254\252\005\324\225"
+	.ascii	"\330\003\024\224\241\307XDQ\201\t\243\nt\264q\001\210\007\271"
+	.ascii	"\222\200Ia,\252%\220\3521\005\025<k\261\005\023<H\236\036\243"
+	.ascii	"\n\004D\334\331\001\221\3349\301B\317\216\b\036$\317\0055\":"
+	.ascii	"0s\025"
+	.string	"\037"
+	.string	" Y\364\361)\376\f\257\342\203\024\306\242\332\023\344\303c,~@&\203>X\340\343\023d4\036\2150\353\216z\202br\330\302\021\251b=\032aP\020U\037\274\252\311\037\365g\210\"\250\004u-\"?`\323C\224I\252\253\013%\254(q\243&\211\252\217Z\302\203dRE\222H\200\232<\372\214\350@5\032\217#F\230`b\003.\250\030\baT\2016p"
+	.string	"\343q]\203J \"\325\037\342\bu%\372\004\375\024MpX\213\306\023pV5E\206U\265@\362\202\036\343\004\326\244\032d\002\265\204\001,X\325\025x\210$~\3245\351\202\t\020 |\260\"\211@\037\250H\006\221X\261\216\030\300\210\036\243jb-\372"
+	.ascii	"\231\260\240\204\212d\220O\0050X\327\235d\007\324\235\n@\350"
+	.ascii	"x@\203\363\024\221\252QM\221^\204\021<\030A\304\n\230\213 \001"
+	.ascii	"\004\022@\030^\004\t:"
+	.string	":$\214\240\223~\004\235\333B\005\353\232\341\202\037\325G]/\310\260B\222\230\001\036c\020\n\032u\347\004\013\200\222?I\240\024\030V\250=\306\023\324\225\210\334Yq<\261\002\017\321\347\204\005+OMrG\305\232\302\250\242@\201\002\\\305\007(\202N\374\020U\344\232\374`<\n \271\203\"\350Dr\210\\\201n\217Q\275)\200vR\024Q\030\217#p\222\031|\210, \325\325x\302\n\364\243\256\353\004\326\242\261\210\001\214\032\244\006q \205\261\270\026\211\037\310 y$\321CTU\300$\217$|\212\304\025f5\006\035G\374\250k1F\335I\006\255\304\325D\316\352\023\224T\221\303\036#\361\347\347\310\003\323\243\256<*\320\n\365\306\250\2420\203\"\250\004\026xT$\314\032t\204Yw\222\031H\201~\210\353\032tT\177\212+\316\2065\271\263\256PW\343q\004\t5i<\002%\325\022\002\3401\006U"
+	.string	"\251&\221D \231a\214QE\341\207\210$\002\321$\325\237b\n. W\265\304\n\342O\rRM\006\245\253\317\361X\302\016\352B\017Q-\221,\302$wldN\f\327\253\300 \251\"\203V\242\212\"M\356\034Q\030O0\341\207\310c\fBfPw\214\307\342\316N"
+	.ascii	"\214\307b\022\251z\300\347\310s\\\217H\240\233#\nc\021\257W\361"
+	.ascii	"\301\207$Re\241\210\354\311\340G \025\371a=\036\221\037f\220"
+	.ascii	"j\021Eq5\252=E\231\344\016\215\007V\344\221\004\216\352s\202"
+	.ascii	"\230\002\013CuG\3559f@F\3559\376`ug\003+\362\bT\2234\036\213"
+	.ascii	"+\320\021F"
+	.string	"]\211%z\202\210'R\365\004E\023\351\272#\002fM\2214=D\365\002\353\016\210\020|\212\304\024\220*\n\024A%\254XiX(\252<j\211\234ug\004\235\325X\fJe\210+\321\204\025H\033\344J\342\004\037b\021\251&7\\Gg\004\207\016h\300\002)\317\007*O\221\005\265\207\007\371\341X\374`,\022\177>\360 \223\037>\310Y\201\207x\302\307\2078B\365\351)\322\304e\301;\322\360\262$\001\254@\371\267\006G\245\246\314\211\220\356\rG\261\241\273b\244\303\r;\351\301\"N\rm\253\013\274\261\305\206\"a\"v\003Gc\273\247\232L\024Q\217\277\306hh\250\232e^\341\200\317I\330%\230\235bt@\325\320#uW\202\315#\250\221$#F\240\330\251p5\345l\214\246\335\030b]\204TsE0SW\033\213\2623\324)\013\217\013R\233\231\241d!\3344|\241O\364\211\222\331\314\344"
+	.ascii	"\304\n:v\224\fC\355}\311]*1OE\210\374\242\206\\\275.\212\362"
+	.ascii	"\362\"\206\036\241c1\356\204\302P\246\"\202Ch\200a\243\233)!"
+	.ascii	"W\240\032?\315R#=\314\244Z\310\275\203\201Vd\2441\n\304\026\026"
+	.ascii	"~\001rSd\026\004\365:\n\344v\203\022 M!\r\177`145\031[\032\243"
+	.ascii	"]\"4s\026B\271P\037G\273\376D\273n\276\334X\273As\251\301 \034"
+	.ascii	"ji\241<L\260d\365\344\345<\312C\211X\025\262\306\350V\213\311"
+	.ascii	"H\322b\212\006\030;.\241\333\221`\023\252\343V\341b\004x\207"
+	.ascii	"b\035\315\272\322\024U\2431\212\003\315\001\304i\204\357y\277"
+	.ascii	"*\\T\336\304\032\243V\350\025\016g\032\334\377\016\310\024\354"
+	.ascii	"\022\354\253\352\265\232,N\332tP\241J\230\027_^\254\2460\334"
+	.ascii	"\255c\363\001D\252\247p\225\r\026P\242p\233\r\336\220\302\034"
+	.ascii	"h\023\317\307\337\235\214\306\250\r\324\006\nu\001\245\214\222"
+	.ascii	"\022\275q\024\n\355,k\311\360%\375\321\032\270\207\323\240\326"
+	.ascii	"\335\023\376\001b\317\231\324\030\215\201\306@\235\256\256l1"
+	.ascii	"\241\241\322\025\2665\343\250\223\035\364\301\204\022\326\030"
+	.ascii	"m\262\203\036\234N\270\306\250\214\257K\257 \326n\310D\351K\027"
+	.ascii	"\276\244'\241L9M\345\025\021\342\224=\300\004k\260dh\265@_\034"
+	.ascii	"eB\227\266\034\271\355-\241L;\265\205d\250sS#\202L\333r\210A"
+	.ascii	"\207F\204F\222$\0353\025@0@L*\026\r\251\265\033\023@\223\350"
+	.ascii	"\303\231\230'\245RjfD$)(I\241\322\001!Ap\237\351\026\227\365"
+	.ascii	"\226i\320\340bfYbk|\022;\033\321\243-\373\3052\234\340sD%z'\346"
+	.ascii	"c\2767\310\310\310\f\037\224b\257\003\002\3360@\267\374\347\316"
+	.ascii	"\356\342\006\035\235\333N'\004|\006\320xI|\247\\\241\337$\013"
+	.ascii	"\006\036\002)>\204P\342O\337\254\274\020\315\245\354\342\317"
+	.ascii	"\361\023TW\bT^\361\312\271\023\001Q"
+	.string	"\342ci\243\260\323\375\bB\202O\013\007\244\t\217\372\255\231\002\224\"\311=\031\223\026f\274;wJ\343?\032\232\322\231\350\336un\021Y\022\2501\254\265\316\033{\264\342\207\244We\255b\264\220\264=D\264\253>\272R(\253\366p\r\035\262}\032\306#+}\261\016LB\377\364e\330n\017\355\017j\307P\335\031>\353\255\233&\2238$\t\260\270|1\363\351\331;m\302\036\341\"\245Z\301\312(\234U\020\250Z9u\361\343\335\024\022.\016\272\t\013\333\333x\215\231\003\202\211Lp\335g\242BmTos\372\013\335\342\006\316\n\350W\221\330\265g&\252\221e\215T\217N=\376$g\332\213\033\202W=\236\254\270\002\264\334\3534\233\221\n$\240l\0368E\300\267\004\200\004%\024\311\232\227U\314:S~L\350\214\034\351\323\340h\214\373HX\020\021c\263\364@t\252L\260\024E\031\212\241&\244\320g"
+	.string	"\244\244\203Pd"
+	.string	"\254\200\253{\375 @6CjB\016\251\260\1775\311\317RV\237\001P\345\360\037\335a\347\312\320\264\331'\341\361\210\016I"
+	.ascii	"\304\330\t\300\341\367\206\305\020\357\321C\270'\316\006>)Q\022"
+	.ascii	"\363c\327\202\373[VD\331\303\312\353d \"\310b\361\013fl|\272"
+	.ascii	"\367\355=\203\231veI\357z..M\254\r\205E&\211`\001\302z\002\221"
+	.ascii	"y\330\274\303%]\302,\243laF\253\027F\325\362h\345;H_>\fk\207"
+	.ascii	",\215\005#\305\245c\256W\n\211\214QF\362\212\323\211\217\204"
+	.ascii	"\315<\331\315R\217K*\274\264\344Y\224\275\200\016[0\214V'(\375"
+	.ascii	"\334\306\211\0370\240\346\304\341\006\240\306\317\266\255@k\252"
+	.ascii	"D\264U?\355.=\263\346\344\231\006\320$\257\201x8\260\205\004"
+	.ascii	"\217\024\314h\243\275\003\272\023\034V\312\375\222#\344\003\\"
+	.ascii	"\273\201\354\320\365\212\002\323\332\237{\264n\"{\016\261\017"
+	.ascii	"r\350=dD\373+\0176FOR"
+	.string	"\036"
+	.string	"\00157Ca\024U\320\246\202\230\277,\326\236\366\321\017\334-\311\350N\353\024\017\265\004\216\374$\350\rRF\216\003\201L\314\201Z\224\031#\026L\323\343\312*,\fT#\226\0055\360\243\250\221\216\244\035.\303\353\304\334\356t\240\355\303\351fG\211%S\n\034\f\304s\013\363i\240P\337\260\205\034i\223\201F\242\257h\323r<Y\347\273\035\302\323\371j(e>\330f\372\265\331\306\220Ra/\322\016\255\220"
+	.string	"\261\244Z\245^p}\251\2635+x]7\017\264\357g\377\322\361L\350\254\214FXXu\3060\224X\342\334W\327~g\275\335\023\223X\222\245\215\337\246\266\267G\341;\351\333a\024\254F\265 \n\230\204\216"
+	.string	"\345&1\023\3043\3158\356\327\353#\016\355\023\001\342d\365\310\357n\332o\027{^\321\200\3453\267\3652\346'1\254\022,\313\326:7\325\327\322\023\316k\203\207\3010&x\312A\225\"T!\016Mt\034\337\205"
+	.string	"\007\324\260\262l\365\327\265\244\31384\365xp\316Y`\366\277,\2125x\362\fQH\311\247v5\374\262\277\300\037\204J\021\3059d\324\021\374E|\222MxI\311U\267\270`a[\221~\264\016\247:\f\025>N\035\354 \204\240\346\024\376p\264,\360\0313\302\036\023\346rl\027\230\346\204=\355\324w0\3304\3229|\334\263\234\201&\215\331c\302\007\370\003\225-Y\026a{\221_\207\301\372i\353n\022O\372\247\315F\266\231\215\022+\2432\251W\262b\036iA\t\030\311C\351\257w\006\360\324\333\311\331\213;\255\376\255\332 \352A\340E(\326Z\260\221\312Z\343@\023\031\322\221\363r\317\007\236}\327;/\276\374\020\006\034\232\0272\221,k\017\360\003l\223\202\263#\317n\375a\302\271\225\370\013\036\023va\b\232y~\003F"
+	.ascii	"%{\2535#=\316\221\370\361\366\212\344B\240\303s\003\204v\300"
+	.ascii	"\263\341\234(\231*y"
+	.string	"7Q\221\250\277\352\220+N\310\306\234o\320\321'\365\371\313g\233\033t\020P}\267 ;\001\270l\262\223\3337u\312\327\360\016\236\023\001\251\t\343\250B\3670\217,\003\226\207\202\323\361\204\364\252\200$\350\332\331j\330M\326\2064J\200\310D\024\266Y]\247w\206Ch\273\0066\315$h\352\017R\004O/Kf&\312\337}\006n\260\241`\244\214Ib\233\226\220(\326\177\311A\234p8]\\\260\260\251\310lJ\326,\277\342[|\316\325\221&\377\212U\242\345\304Fi\221\367t\027\201\254l!\345D+\022{\351\307\026\231\373\327T*\324+\005\254\327\036\030K4+\273va\r\224D\257\307gL\226\231\207\007\335G\242h\243\223\324\202TC\235\246q\252\324g\355\375\335\237\327'\237F2\001\202\352\253\304\247\242\300@U\361\021\na\034>\003\244M\202\374d\315\367Z\227y\262LZ\307\210M\205\302t"
+	.string	"\237\b(\210Y(\f\356\2025'v\300\251\277F\003\260\026\027\220\030+\374\315\235\022\036\253{\354W\362\342\344,c\251=|!\255\223\243*/\366\n\363Yk"
+	.string	"\240^a\243\205{\372s|~\373\262O\253\220\202\022\211\375\310\324+z\236\363\370\332\232\256>#Ex\031k\353K,dLl"
+	.string	"D\203\341\317!\224\237\267q\204\265\214\332\217Pq\261\334\217\377F|\306\256\370d\366\335\344\"H<g\243\224\310\255\030\365=Q\202y\236Y\252Kr\016Q"
+	.string	" \002\001U\247\226\\z\354\226bg\035\347\303\bBz\231\035E\255I\202\366\270-}\032qiG\030\333\0275\267\255\334\031\036v\212+:\210\"\322\335bi\246\316@8 ^\305=t~\210`\302\272\317\261%\255\334{\262\221\b\326\267|\026\361\211P\232U\3730\t\030\222Q\253{j(60V\276\020`\373\005;%B\030tPH\317\315\036\226\370\240\034\272\326~\004\255@}\037\373&\246\033\236N\031O\037\211\003,\024\321\273\307)\226\234\246\357U\354\376\315\020\275\003\234\372\n\021\216\374'\363\366"
+	.string	"\271\310M<"
+	.string	"\305z\374\313/\301\221\017~'\230\255\303)\321\024!\347\256\n\025*\0343\013\254\025(V\315\301\374h8\271d\2756\315\243'\023fv\335f\007\201\373\fI\021vE\344\205\027\301h0\016\275\004\257U\214\243\274\260D\224K&\224\2062dB\024 \313\251\331\227\303\323f\f\202\231\310\003\374\325\300#\243\276\311J\213*\325xr:\357]c+\220\364\227\235\255)\367\342\315gR(\020\271w\177\026\034b\003u\212W\202\216\001^\207\351:\330f\001\311L]\221+\rc\230\332IF\210e\367\245gpawEE6\007\202?\005B\204\021\201h\256\240\034\213>\237\242o\234h\307\2760\206\305.C\\\325\252\026k\023\024\204\370\241$*\217(\"\031M\332Wfa\301o\326\032u\267\237\320)\033[\231$\301\b5K\220/"
+	.string	"\212\235\022\364\341.\232(w\315\177\242Ii\024\001\372\363\223\235\006\375\353\275\265\347l\313\354\0226\367\020M\254K\264\275\225Y\0135\253\231\212*\200\331\266\001\205\013lt\3566\234\255\354(\227\245\351\343\240^\367\035\333\225\341\307\351\006\365\210H\250iu_\035\200\344\027}N\330Vyvi'8%?\212\345\202b\007yAV?%\340\336\242\361\374=\006H\224h7\013\022x\224d7\333\250t\345g\345Q\263\363"
+	.string	"0gJ\367T\261\310+\323\264@\345R1\323 D\220\207 \333\370\333i\\2\301i\025\234\032\213\372\376\243\347\251\2561\033\n%\203\240\335\327_\006\240\251\223\343\315\373\345\312\363 X:"
+	.string	"P\357=\266f\222;!\337\323\2443\276\363\302l\303\006\350\364\036\013\2323<\333\035Do\367\262\206\302Ic\206-f\2155\201\262\313\213~\276\306\353\264y%\3661"
+	.ascii	"5_\316m\262\363~\265\t\315\311\202,\233#\271\343Y\243U\226\333"
+	.ascii	"\371\003\016\335\024\377\213\365\003:?X\3612\365@\374%B/Ar\346"
+	.ascii	"\005\262A\322\217W\003\332\373^\345\217ah\016G2wy\226?S\256\321"
+	.ascii	"\235\001\365J\375Z\223\272*\353\306\300\272\306C\207\344\016"
+	.ascii	"\3661\274\"?+;etmf{\370\3042T9?i\2476\225\317l\323\374X\323\241"
+	.ascii	"\353=\360\364\020\023Q\036\277\006{O\330\2570\277\303cd\270\""
+	.ascii	"L\265\3667\361_\271\337\376\036\316W\232_\377\177\214S]\341\337"
+	.ascii	"\352\276\312\350\306\343\375i\242\357\265^\255\376\265\347\222"
+	.ascii	"\350\255\316y\311\006\266Ez\025|\026\036\324|=cD\277\005\236"
+	.ascii	"w\314\362E\276>\346\030U\357\021\345\263\221\217!l\205\236'\271"
+	.ascii	"\342<\005\342e\277\3745\223\373\301\347\233\354x\177\007\342"
+	.ascii	"\377\347E\342^a\205\373\250\037\365#\212\177\304Mg\213\233\023"
+	.ascii	"~7\374\337\271G\220i~\271G\271L\263\302\327W\367!\355\255xY\301"
+	.ascii	"\266\366\203\004\357\b\210\203\306\355lr\367\277\243\273\301"
+	.ascii	"Z\314\347\314{\341\\X\351\233u[\345D_%3\301o\225\035G\355[\331"
+	.ascii	"\227>\257\372Z\267\341\007\273\227\346\223\314K\343\034\232\367"
+	.ascii	"?D\177\353\004\036\024\270\203\243~q\320\035\320G\352c\266\037"
+	.ascii	"q]\364yH\222;\215\337\220\r\220\264\245\302;\263\273q\374\370"
+	.ascii	"{\254\277\017\327\307\345\033\321\357\362\205\254\036$\334\321"
+	.ascii	"kpbnT\235\023%l\3239\215\037\213_\357\327\216\346\277\371\261"
+	.ascii	"\331^"
+	.ascii	"\2347\307\315\375\277\266\036\245\177\355+\355~\034\303\215\035"
+	.ascii	"\235-\363\217\3251\311\277\236\017\311\274\305o\237^^\207e\207"
+	.ascii	"\230\025\220\033\273b]\305\233\tCW"
+	.text
+	.section	.gnu.lto_.symtab.6bfada4c9568bc04,"e",@progbits
+	.string	"waitingResponseQueue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"runcamDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"runcamDeviceSimulateCameraButton"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"runcamDeviceOpen5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"runcamDeviceClose5KeyOSDCableConnection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonPress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"runcamDeviceSimulate5KeyOSDCableButtonRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"rcdeviceReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"rcdeviceConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6bfada4c9568bc04,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
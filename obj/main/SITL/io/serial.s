@@ -0,0 +1,1328 @@
+	.file	"serial.c"
+	.section	.gnu.lto_.profile.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\034"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\305\t"
+	.string	"\264\017\207\001"
+	.string	"\036"
+	.string	"\374\255\365\254\f"
+	.string	"\001\303\226\316\200\r\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\226\230\365\242\b\003\357\267\360\307\013\002\002\005\002\006\004\333\375\377\333\001\005\303\276\302\323\013\002\006\232\255\221\221\b\002\002\007\002\007\007\240\342\234\212\n\b\232\226\312\363\017\t\253\340\320\236\017\006\002\003\002\b\002\t\002\t\n\013\f\215\311\327\216\r"
+	.string	"\r\233\275\224\204\t\002\002\004\002\n\016\351\255\236\303\002\017\217\231\357|\004\002\n\002\n\002\013\002\f\020\315\247\251\240\003\006\003\002\r\022\316\243\347\220\007\002\023\204\203\343\357\t\024\270\217\324\361\007\b\002\016\002\007\002\003\002\017\013\002\007\025\374\373\275\316\002\006\002\020\026\370\346\324\256\r\022\002\003\002\003\021\002"
+	.string	"\002\021\027\030\342\363\276\212\b\b\031\233\246\366\244\b\002\032\254\213\274\230\b\021\033\323\201\221\330\r"
+	.string	"\034\246\246\365\275\004"
+	.string	"\035\363\325\340\325\t\036\240\342\234\212\n"
+	.string	"\030"
+	.string	"\032+\312U\201a\212&3\367^J\334\0340su\003\315\336\346&+mi\025\315\205@\233\001\312<\206K\033)\"G\335\265b5M\213\n\274\271\262\326LW\264\353\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.ipa_sra.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"\235\005"
+	.string	"\002\007\023\030\2009\351"
+	.string	"\f\314\300\f\314\f\002\370\263\307#\360muk\204\020\271S\n\256z\242\n\323T\363\365a|\210\370b\212\231@\354.\352a~\017\246\025\255\247\261\326i\3500X\230\204\201n\301\026X\001\266\336J\202$\264\355\376.\336\b2 \240\0021,\017\f\251\006\030\240\f\306a\360x\330\007\313\264E;\032\r\030h`\"\212%\2001\207\013\236\310\364K\034\016\235\b\241\225\200\277F\372\003}\003\347\020\036t67 \335\343\302&\210\273\"\034\007#\340\003\316&\206\005\315\026\371\n\366\r\310\327\356\264\016f\f\331\270r0{Z\333"
+	.ascii	",.\324\020"
+	.text
+	.section	.gnu.lto_.inline.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\216\004\215\027"
+	.string	"\246e\204J\300\020)\035\032\226?\241\300\317\341"
+	.string	"9x\303\267\231\332\202&\355\272\2654\323[\t\253\023\372\023\025\317"
+	.string	"\312p\021l6\br\305R\033E\025\374ol#\201"
+	.string	"\300\262\b\002\001\2021TB\366\030\342\241\355\210\304I\367\337R\312\024o"
+	.string	"i"
+	.string	"v"
+	.string	"\354\362\371]a\bEPM\255{<\206\333\357\307\246u\256\326*~\254qT/h\363\252\261\214^\320\306\343\035!\275\361\007\240\217\312\305\302K@\037\225\370\325\f\375Y\332\211\367D\344b\351\031\274'\"\361\375\030\256\377{L\032\333\220Qj\341\372k\3353\343D\341\244\205+\334\214\200J\276?\323\377\245\326\032\363\363\2773\256\265\326\376E\276r\020@U('/\340\3501\334c8\327\352;\366\377\030\372\2574\024\212\032\031^\374\375\361\204\242\312\177\254\205O\331\016\375D\3609\343\033\240\216\207~\302\016c\240.\207iO\262\376\277x\227mFK\277*]\245\31391\3365Q>g\215T\025\354\211\237\344y\222\347\231\2401\344\220\244\366\341'\375\037\302\273\177\037D\344U@\305[\262m\177\230=@Kv\331\376\326zJB\220\024\354\"CD\017\224X\267\232\t :\2004\2140j\275\244\017\177"
+	.string	"a\370p\306!j\320\r\361\344e-s\013\262\23019\034\022?\342\374_\362.oK^p\021\206\331\263v"
+	.string	"-\231\301;xSC\310\344\257\217\255\3024\272\234%\221\306\027\222\200C\255\207\200\250\264\217\213)\246\360o\341\250\02581\nt\216&\177\f\267?/9[\234\262\254\024\026e\260\375yl\031\303\310\227\317\277Ao\360\355\"\220s\204\327\303\216\260\255\r\320\021\266\361\374\272t/\307/\005\201\237\374-~\350\243\261\017\r\016%\346\220\b\030P\342\003\230\374\2271\317\272\244\366\354t~$?;\235\337\307I>i\\d\202g\307\265\322\273$\0345\344\311\323\270\336T\274\230\265\211\246\303\022\271:\nc\250\2414g\b2\020\221\b)\210j8`\2422TU\036\022"
+	.string	"\306d\211\274\350D\202\n\nJ\312({H\230\3048^\323\314N\345y\033\352\r;G"
+	.ascii	"\020]cQ\325\251\364\376\222\r'\b7\262\306FKZ`\371m\211Z>\250"
+	.ascii	"\260\230\n0\207\\\245\375\2353\322\263\023\206\013Y\026:\241"
+	.ascii	"\3576a\363\327K\3166\247\227\27140\2740(\326S\2532>\300\331\243"
+	.ascii	"\353V\357R&H\230O\022\260b\322H\340\032\2435\304\264\035Ra\207"
+	.ascii	"\323\243\321\265h\310Q\316\265\255zz\\O\bt\035\207G\310)b\240"
+	.ascii	"b\310_\266ln\3360\312\240\"~\341\34278\340\264\034\034M<\216"
+	.ascii	"\027\267%\f\277\374?\341\001\261\037\322a\345\354\"\227\230\354"
+	.ascii	"\224\206\270\317p:\324\35458\243\274\234\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\235\002U\013"
+	.string	"FQ3-p\265I:\216\323\303C\247o\331[&"
+	.string	"\234"
+	.string	"\236\245\376\037i\0028\001\030\003\036\026\021\377\377\377\237\374"
+	.string	"A\201\037\033\021\"\215\020\231d%"
+	.string	"$"
+	.string	"("
+	.string	"\215\274\324\247\367\025\317\300\022P\254y 2\303\314\004\240\032.yM\030\2360s^R\355\241\337Q\362\311 \212\bD\255\375\304_V\274\271\350\021|\327\323[8\374\310\340\3519\275\365- \357\212\372\212\352\274B\212\024Wk-<\305\346\022\272\324K\212\205\256\320\037=\241K\372\323c\275\007\211\003\026<\3660\204\333\024\305)\252\337N\221\003\256\326.\005\234\\y\272\315\324\3505z\253\315js\200$\241\343|\027\325\256\b\204|0\007i\261@\224\241H\261\336\244T|\031],E\2501\271t\206f\222\202\026\030\2261\220\002\031\033\253\003\021\220@F\030$\201T\315-\026\003\243l\212\220U\326\\\226B\247\034\336\247UL\243\230\217\333\303\230\327\324"
+	.string	"_2\254\217N\375\252v\345\017\232\254\302\363\0017NA\234F\r\0027\361\323_\227.\243b\250\316\"`=T\351\230\214\236q\031I\223\314\303\n\232\347\270\031\036"
+	.string	"\030_\020o\253\305\037$\376\334r\235\027b{}G\263\375\233<\214\315Q\336\253\223m\022\272\001\354"
+	.ascii	"\3134\277\326b\213\350\002\256\311\350]\360"
+	.text
+	.section	.gnu.lto_.pureconst.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375 F1\002"
+	.string	"B"
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\200\004\001\232\004\003\200\004\005\200\004\006\205\004\b\205"
+	.ascii	"\004\t\271\004\f\030\r\205\004\016\205\004\017\205\004\020\231"
+	.ascii	"\004\022\205\004\023\205\004\024\232\004\025\232\004\026\230"
+	.ascii	"\004\030\230\004\031\204\004\032\204\004\033\270\004\034\264"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\370"
+	.string	"\005\b"
+	.ascii	"RL&+\220)\031\0160\207\337\377`;\312\344\177\030\256\337]\342"
+	.ascii	"e\256j\261\004\372\037\3557\307[\217\3677!|\211\f\332\335\366"
+	.ascii	"&D\312\024?DH8\244\033\251\350\031H\rZ9C\301$hX]\264\003\357"
+	.ascii	"\3078Hy\245mN\273\244\263\322>\037\020\364x\026\252\234ByB'\245"
+	.ascii	"u\026\201\377)\247\244\327\200\3065%B\347\244|\322n\020`QR\376"
+	.ascii	"\216G\225 \2700\026\032n\242b\306\224\23336\324\265\024\305<"
+	.ascii	"\275\365\233\367\023F$2\347\255\313\007eD^\336V\317\214- p\202"
+	.ascii	"\241D\345\001\347IL\021\206\313\241\367'\370\226\321\330\241"
+	.ascii	"\260[\273fl\371\373\264Xp\375\273\030\201\275\006v\263\314B\250"
+	.ascii	"\031j$\027p\320U\206f\002\241\0060\302\243\335\227\213\001\b"
+	.ascii	"\217UHWhQh\013\263\310\202\327`\036!7\022\301\234y*\307\216m"
+	.ascii	"\1773Qti\\\242\031\256\374\206\t\007"
+	.text
+	.section	.gnu.lto_.lto.e17c9d0a118aaae0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.39.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.41.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.45.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375 \233m\004"
+	.string	"\304\007j"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\357\261\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\006us\307\006uq"
+	.string	"\005\001\006'\001\344\035\001'\001\r?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\005"
+	.ascii	"P\005V\t\036f\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.46.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`$\003\265\024"
+	.string	"\006\244\201J\300RN:\342%\341\325\357\307=\274\n\272\271\245$\314\303{\344\201\252,g\361\037\r(\222-\234\257O \022m\333f\335\217-\321s\362\352\f6\013\205\204\b(\bP\002X\215W\320q\201\235T\"%R \203l\262wJ\001h"
+	.string	"d"
+	.string	"r"
+	.ascii	"\037\222\371\200\335\235&\033\273\244\003\233\210\257&_ |\025"
+	.ascii	"O |\265\315\376q\262g_\372(\001\343\267\273#Ma\361 y\203\323"
+	.ascii	"\366\n\322i\363\211>q\230rRG\273\333+8bs\023\025`G\002\204\371"
+	.ascii	"\254"
+	.string	"P\324\354r\023\\\221s\372\242O^\220R\352h\227\3639\"aw=u;\234;\274\355\020\266!\330\364%=\334\334\242\324\310F\b\217\272NC\335K\341\353\225\332\"F\314\353\\\"\364#\344\212\206\336l\3626)\217}\230\217\346\307t\307v}\350\257/\3579\247/ e\177>\004J\273&\266\264\326\251\366T\274\274}\322/r\361\027\266\227N\022o7\242QYu\265\273\257W?\020_\025\200'\261\375i?\350B\266\223\272h\214\216\025\215N\016\307\355\224\363xr\342\021\001r\20671-=i\375@\r\327\241\224C\013\250^%\2647\374\206J\217\347\272e\375\260N\355\225\327`1\231\242\021c\320\263\273\260W\273\345H2qw#\314\200\351``\312G&|\r\221t@ps+\346G.\342\356\f\314\217q\0313\360>\257\006Q\013\257{\365k\364E\007Y\334\262Z\004\262\267\3108\274\314&"
+	.ascii	"0\313\211\207\025\031-V\033g\262\361E\266\3422\262\320j\343\311"
+	.ascii	"\001\317>\304h#\314lF\033I\310=\3351\005\237\023\216\346l(\013"
+	.ascii	"\257B)!\301Q\372\365.\234JE\254p\002H'\b\013w\224\320\306p)\224"
+	.ascii	"\005Q\261\004=JN\364\227\257\310\257R\036\217\354\240.J\251\346"
+	.ascii	"\353\223\326\210wR8\351\207J\252\2319\344\340\356.\330\340\001"
+	.ascii	"B\250qH\303\2242\025\b\211\0042\023\0264\017\320\002\2219\352"
+	.ascii	"\001\021pQ\024\220\310\220\251G\033\355\242\242\360\305\025\036"
+	.ascii	"S\224A\205\216\222\372\257\013\306Vqq \237T\034b\341\267 \226"
+	.ascii	"\360<\330\202\376\222$<^\215i\256\303\253q\311\0317\3572\031"
+	.ascii	"\353\362]&>\241A\265\231\351\210\300\tR-p\263\030j\230v\341\300"
+	.ascii	"_$\265\301< \342\242\356X\227\227\347]\240\"\336\316\321\214"
+	.ascii	"5h\240\343\216A\352V\323\261\b'x\211\202\n"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.47.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\223\001]\020"
+	.string	"\306\036nG\360\260(\035:\030b9\025j\277\356\202@\370\376SU\361\246\277/\251\316\335)nl\016\352\"9\373\244\203\037\365\362:\317x\005\323\335\244\343\017\0135\022[\013\354\025\n\210D\303\215\303v%\240\255\204\220\275\267\334)\005X"
+	.string	"W"
+	.string	"Y"
+	.ascii	"\3632^\300\274\\\031\007x\254\367\204\247oS\306\205'_"
+	.string	"\345[\334\235\0230\034\237*\202\274\310\244\270\354\220\365\241\340\244q\271\024y\321V\237\206\307\bR\003\302\003\307\307\022w\004-\347\363\245\340^v\004\256\236\325\347r\270\205PJ\rW_\206\233\273m\226m\006\366I\004\217\375\233\241\345\353\035_\357\225\3200B\037\300g\303N\207\nJ1\324l\320\025\022\347\303\353o\233|\231?V\320\300\364\232\302\321\231\215\326\202\301\240\264v\\\332\203\360\261\n\356(\205\3211AiM\340\003\334\345E\034f\362)\326\016\337\306\022Bu3\203\322\352\031\370\200-/(X\2034\032\032\034d\334\270\273,{\267[\221\027\255@\265\311\211\333\362\266pI3\027)X\303\302oJ8JS\037\376\3546\243\370\327\245%\224\346W\227~i^\302\355p\342~/{D\341\252\251n\254\300\332\356\310\250\211\261\333\262\253\n\374G\211\026\026\336\030w\\\024B$&\"\031B\001= \231"
+	.string	"\202\300y\304#\002HD\n\225\274\221\3103\021\201J\274\021R\311\363 \340\321I\210\344\241\214F$\257\322o\214Otb\323?\315\313\336\315\350\\\210\335J\271\016YYT\213m[^\300#\271\225+h\326_\314xR\260\306#\245\224\316m=e\306\345\034\300\\=\001  0\002\202\234U\035h\t\376\\Km\206\327\236\272\344\f\273"
+	.ascii	"\324|\301\345>\271\005\013\001\210f\022\026\367\345aC^a\017m"
+	.ascii	"\013\272\345\311m\203\237\004\226@\300\375a|B\023\017\374\315"
+	.ascii	"\260%,\301)\202-\004\256\261\207\262\342\033\235\366\221\001"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.48.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`}\001\325\017"
+	.string	"\366\335jF\340\262(\0352_\005\033IW\244\205\200I\205b{D\375\n\340A\317\374\275\237\305\003\207\024\025\373z\347\323\332^\351\361\013I=u\321\177\2218N\21416kR83\277'"
+	.string	"\205\212% RTB\366\336r\247\024W"
+	.string	"T"
+	.string	"X"
+	.ascii	"\361\002\346\245\206\360\366\370\272',]\2332*,\371\246kQ[a\301"
+	.ascii	"\001\362\251\304\221\035:\\\036;\\}(8Q\264\\:p\335\250\276\016"
+	.ascii	"\217\261\001\013\025#@>\fQc\262\233\317\227\202\372\330\023\270"
+	.ascii	"d\252\257\345P#\331]C\325\307\341\336n{e\233\201\375\023\001"
+	.ascii	"1\277Th=\354\206\020"
+	.string	"\372\333\007\306\206\310lw\303\254gk\310\032\023\207\335\376\313\217\301l\263\231X6\331\214\f\235\335\r\271\364\202\355\362v\311\376\300\307\\0\200\335\227\236\030\273\253\300\007\266\313\2578L\311\266\211/\021\337[0Tf|\354.g\340\003\346e\207:e\n\227,\003\b\024\234A-\241\352qCF\205\252\351\312\005R\247\234\250-K\275z29R\220\307\302_L\330vS#\276\213\317\220\342I\\\232B\312\274\352\322O\231\227\327\307\216\340%g\247\346\004g*[\331\241Qm\331/\023T\026\r\017\r\036\254,[\233\017\025B'\242Nz\241\356A\207\"\n\235t\001l\002\202P\322y!\0227\3528QW\022\2013\361H\034\210\200G\022B\036\2072\032y\334\307{e\371-\276\351\314\2401Aw\324TUMrR\324\007M[\376\270\310\251\212\003C\016ue\233\t\365?dpR\220\347qww\212\004\036"
+	.ascii	"\022\023D\246& \275\033\321J(\267\346\027\025e\353\3514\030\322"
+	.ascii	"i%\307x\204\233\307,z\346\255\002SP\3278 \204D\t\341\230\361"
+	.ascii	"taK]PS\344C\205\373g\0062e\t.ET\013\201Ac\257(+\324\215N;\311"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.49.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`1\002\255\023"
+	.string	"\326e\205I\320\322(\035R\332\034\230$}nJ\266\206}#\343\\2[7\331\333*\345\225!\242\200\272\203\312sH3\204\336\f\374\365\207\024\347\320F\340\367\351\305H|\301\r\324\223\315\242"
+	.string	"\005\254\260\233e\264\003\376\243\222O\366\226;\245r"
+	.string	"k"
+	.string	"q"
+	.string	"\007\346Y\274\205\314\263\002\243\216M\352\205G\314\356W\353\250\362\370\001\340ix\001\340\351\232p\3709\336\240\234\375\004\322\271r\346\263\3744O35;Fl1\263D\351\007\316u.\022\\qsZ\001\007\244f\373\3609#\270\33091b{\231\233\353\3318\357R\306F\223{\335\245\320\222\316\250\307vsy2\251\265Z\326l6wx\3336\333&\266\244\0209AK\036Bxsl\324\307?\004-M\237\273\347w\367Ri9\245/b\201\304O\211\344\247V\232&!5\007\025J\361\335\237\273\264o\037\206\317s\312\337\315^ajP4/H\020\302\323\3332_\347\224\0338\220=\247\022V\025\247\336\355(\251\3261\301\251\031\204R\332\347\371\013\331\307\225\031\240\322J\200"
+	.ascii	"\252\265.0"
+	.string	"\202\3604\022W\363\351\240{\363\223\206|\026\334]\031\033\240\265 \315\2759\\\2710]\017\232\fb\033\303\201V(\221\357Wk}\360\203\002 \347\333\251q\237\031x*\227\022\371\230x\374\0313\005:5\333\035\336\203\"A\247\326Z\022\3432^>\212So\210\311\327N\375\030x\n\356\026\325n\346~\317;\375\341\214b\206\264\310\246\355\3150\005\355\336\354\221En\255\224\025Kd\271V'(\016-\226K\244\260\226xALq\265X\242\210OH2\254DX+\246z\211*\227\270BQ\235\300b*\022\002~ih\301T)\257\027L\225r\375\346\370\272O(b\352\375\200\247\361\363\216J\032\362\231\273\224\256MZ\326E\304ioF\335\240\250\2455i\231\373\320\035\321d\220\317Zk\005\367v\025p.j\257;\305\301\341\200\031\341\"\233\002& 0\002\204\030\324\035\037\202\230>C\301\335NR\352\357<\265"
+	.ascii	"\024\016 \270\341\r\026\331\027^\354-\2561\230\200\023.8N`\001"
+	.ascii	"#+T\366p\310X\3207\271\031\r\342\230Q8\032`}\361\324\351\203"
+	.ascii	"1ru\371&\311\002\310\024\036\347\215[`J\255\324:\002\312\032"
+	.ascii	"\234{\265\357\t"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.50.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`'\002M\023"
+	.string	"\306\344\201I\320\224M:\223\231[\022\240\271B\345\037}]\003\300'\333\036\341\"\322c!\026\200\223a\305\266\032\235l=f\3321\267\311\002E2\300\355X\216\006Or+o\240/\f\203\313\261\314\033\344.\360Wfh\"\215\354-wJ\001n"
+	.string	"g"
+	.string	"n"
+	.string	"+f\334*0\002\365\224\3308\341\264`\252u\374<~"
+	.string	"w\332]"
+	.string	"w\272#\334}\2167'[Gqt\256l\3714GM\224\016\317\016\023\021g\242\004\001\362s\231Kr(|N+\b\031\205b\207\317\t\201\205\020\t\023\321f.Q\315\306i\2279\342K\356e\227H7\227R\221\350s\211J\251\265Z\206b\317\335\335\266h;\305\226\023\002raGC6|\360\302l\357C\177\307Y\232~\274\347g\367Ji9\245O\342\331D\b\261y\370\224j\335\2719U\034\024)\350\263\177\274\264o\237\310\247\315Z\2577<\336\216\315\355Awz{\306\227\271\304\f\032\314|\214\351\352\tT-vd\251\326\021\301\251\027H\371!\231\007\250\025\346T\243\326Q\201\017t\247W\361Dr\320\215\371KIO\313\355n\216\r\274j|\314\215\271[\271\254\031\217\227l\262\315r\0322\324F\023\252\265:\230\001\002 \2721\305\270\214\026w*\227\332h)\206|\030\255\004@\241m\r\177\001F"
+	.ascii	"\252\265\242\270x\r\203_\342\324.0\362\341\251\017\303\235r\273"
+	.ascii	":B\237\271\337\323N\231\202n8O5\362\2665\035#G\2731{\244\t\252"
+	.ascii	"\227\324\312j\245%\245\342eP\255\264\254\350\013\013\244@b\225"
+	.ascii	"\023\013\251\025K\345\362\201\253\257e\225b\371TX.\337\t\001"
+	.ascii	"\203\027T\254\357\005\004Y_\211\353\027\346\313.A\211C\315\210"
+	.ascii	"{\321O\273\267\224\3644w)]\247\324\254\013\004jc\366nPoi(\235"
+	.ascii	"\363\037\263\036/\331\364Yk\255\334\306\036\303\315\365\366\262"
+	.ascii	"\323\237\240\"7!\\\362&\327D\030'  \002\203 \324\035n\315\177"
+	.ascii	"\bw\372\f\005w;I\251y\347\335\002X\370Yp\271\013\206#\330\213"
+	.ascii	"\316\2106\006\333 \257\013\300\tD\300\276\205\312\016\207\210"
+	.ascii	"\005}\223\233\361\020\307\210\262\321\200\346\r\r\004Q\220\362"
+	.ascii	"\023\232p\340o\006\262\265\004\247\b\266\300\\\255\334:\002\312"
+	.ascii	"\232\316\275\332\376\004"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.52.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"=\t"
+	.string	"f\222A8@\217\322\001@\3750p\032\231\016&c96XS&\013V\324\335n\211\305g\375dRV\323\232\021\314\206{\377\260*\n$\375zP\250\021\2241)V\310\340\266{\247\0241"
+	.string	"0"
+	.string	"0"
+	.string	"\005U\205\322R\027\025\254\226\335:]?\200]f\027\300.c\352\245\303\222\177\221c:<N\350\351;\004H\330]CzB\335\361\2667\2669\266]\002\226\257\177\3042)+\b,\273\026\257\227u\311\026\207m\222\255\331\206\320~\310W\244\327\b\007\354b\274Pv\353\2017\331\245\006c\333\3778\b\311\245\023\361s\006\177\253`\006\377\310K\274\214j\327t\352\223\234\345\340o\\Z\344\301\323K\337{\200\200\247\206&+\027E\374\354\372\301\250a\037\2631#!n\033yB\236Bf\017\207\241\263u\037\321\344\266\031\332:\240\351\351D\223C`\256\341\323\315\021\307uS\253{\313\2501E\tk0F{\001\004Oe\314\264\\\001\013"
+	.ascii	"2\003\302\260\343\216\213\367\320\226\0139\307\0306\251\r\016"
+	.ascii	"\214\021\320\304\223\222b\272&\031"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.53.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`{\002\265\024"
+	.string	"vf\210J\300\322Q:Sa\221\224\361\020\240\311f\316\003\236\254\205\345eZ\360\020\023\220\036\241\001\214\n;!x\256\227Gu\363\343\345\377\352\322\215\332\301\366\251TD\020\004E\324\262\211\f\027o\377\350?U@Zi\354\006!d\023\271S\nt"
+	.string	"k"
+	.string	"u"
+	.string	"2&rI\265\356\032\030\001yj \374\317_\304\2306`\307S\263\332\351\271\r\001k\335\225\336=\200xJ\036\200x\272;\246\223v\221\216\341N\232\017\342\"K7s\336gNg\233\324D\205\315\307\t??\234\356\346a\370"
+	.string	"\210\305\t\226\356\026\256\020\321\357\276\317\234Nf\356y?\260\342g{2\322\331|\216*\265VO\234\256\346&o;\204\355\024{\372\004;\367\276KHr\021\234!a\233\301u\362!d\264\253c\357l\023\205\207\016\024\336\034\373\273\237E\342ir\247GqZ\024\247)\235\016\303\351\335\351\371\336\375\222\016M\300 \016~\324J\023,R\233\250\222\317{\267/\344\373\274\362{\264\327\031\021#4;>@j\335-8uI\236\336\216\261W\266\347\264\037t\0301\337}\bMj;\353\365\220\231D\314Z\272\342\206Q\267\021\341\322\375\255\312\024~\243\002ub\002\332Xj\225H\375\2005\256D\023O\303\245NLC\202|$\032\003(\234m\017?\262\360\243\224\013\247\321\202"
+	.ascii	"%\3433\\/\026\026\361\224d7\nw3\356n\201\241[\325\\\033\366\""
+	.ascii	"\227?\361\324ZQ|\242\307\310\340\367\234\272E6\217;\365e\342"
+	.ascii	"\351qBj3\350\337E\034\003/\230\326\nl%\326r\215\304d0\030W\214"
+	.ascii	"\003\006\322\256\023\r-\330\354\365R\312`e\f\326j)]\263\227\362"
+	.ascii	"D\200e\033^\263\022F&\233\225+\327\316{\204' \"$\372\244\337"
+	.ascii	"\367\221)\252\252\360K\222k\225\332\332R\210\253\343qK\364v\344"
+	.ascii	"p!q\214{\336\025,\375Z\004\325f0\254\265V\272:\376\267\b'\347"
+	.ascii	"7n\216?EU\265$\373\315\231\300\021\216T\230@\024\0030 P\202!"
+	.ascii	"sV\007\241\207LsWbkz\232\021\245'la8B\260\002\324$L\304u#\371"
+	.ascii	"?\212;\351\024e\026v\247f\374\227\251\222s\021\360\272\222d\371"
+	.ascii	"\035\020\350\237\243\270\033\030\021\367\310\250\201\003X\002"
+	.ascii	"1pP\023]\343A\222\035@\243W\204z\312\b\031\024\213\274J\201\307"
+	.ascii	"\251m\371l=\fU\211\216\3146\022q\206\214\326\330\271W\033\236"
+	.text
+	.section	.gnu.lto_determinePortSharing.54.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`U\001\035\017"
+	.string	"\026]hE\360\262&\035\270C\267\350\203\341\273K\354\300\022\340\261\350d\240\360\365R\023\226\216\316\355\346,/\335(`\262\037Q\345\257\2665p\003\031T\271Md\023\251\276\243\002b\274v\fB\374\370Y\306\"\223F\366\2262\245W"
+	.string	"P"
+	.string	"V"
+	.string	"\273\237&\362\020\354\021\276"
+	.string	"\366\2506\357\216E\250\331\371 \236\312\261\017\217P\204F\020\b\222\227\001\036\250q\371\201p\201L\r\030\222\307\202!>4<F\036K*tp\343\342\202\344\255\300Q\213 \024\337y\276x,\231\"\222\335uj\360:\334\242\333\336lC\260o\023\326\226}\235_\364\357\2061\2551\2350\375L\200\b\237\b/v9\274~\354\215\030\303\204m\225=\262\255y\035\fp\300\262hr\032d\332w=G\365/\345\004v[C0v?\006N\220=\372\313l\3738W\241r\007\277\021\236\350\247\247\205\247G5\371\r8;dDm\205\220I\22108<\344\200\n0\325\337\2104U\025\233\321\022\263\222/_S\3372\264\312\227m\356,,d\273\254\007>O\n\225\355\356K<^\021"
+	.string	"\271V\371\272\322\234X\001\244N\301\242\306\310\220\330\001b\245\017\373SI\255\261\017ww\003&nK\225L\027N\262\t\333\211\211\223\220:q( .\215P(\331N&(\215\3334\323VRA+\235P\332\210\001s(&'-\305q'm\364\355\341j\313\237\021r\345{\236\360\357\260"
+	.string	":\204l\304|\207}\347"
+	.string	"f\204\\\352w\030\324\027\333PM\262\322\025L\003\031"
+	.ascii	"]\204\036\230\005\3102K\2001\260\001\2521B\r\200P\270(E\3030"
+	.ascii	"\020D\035\215\273E\020\220\025\022\256\031i\"\310\330\202LB\226"
+	.ascii	"`\204@\205\203\273\202\264\301)\204\226\204\332\241\202i\006"
+	.text
+	.section	.gnu.lto_isSerialPortShared.55.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\233\001=\020"
+	.string	"6\237nF"
+	.string	"\261&\035;7\240\bP\323\364\311FCh\203ZP\n<\257\324I^\027\220\034\377\326\013\3650\256N\315t\005\266t\210@4\241\242\001\220\240\202\356\036\nk\305L\260\337\260\273gWm\333\264\005\261{o)S\nZ"
+	.string	"Y"
+	.string	"W"
+	.ascii	"\321\337\013\310\307\354 \362\321\266\0338H\331\345\237\b\232"
+	.ascii	"\333\310\210\321\3211\347\247\255\315].#\\u\361\317\363\022\023"
+	.string	"71dX/\227\035\0367($\3159E\254\225.\004i\365\300\002\2604@\021\330\353\303y\2563,\225*H\302\234\323*\303\342p\203n{\3056\005\373>\001\377\370\316\237\035\347\227P\035\245\032\202\324\013R\253T_$\240D\r\b>s\322\304xL\032\021\006\t\333)[d;\252\270N\352;,p4W fD\310\036I\020~G\221zN\006\035\315\225\212\206A\3668RU\373'~\223:N\313\007\314\351\372q1\347\267\300\b\262\007!\022.\311\307~\341\036\260\261\177\265zn\300'\220\273\207\245\310VwW\346\210\361\240\322\230\277\272\217\351\001\2431\333)g\241\222\315\271z\340\257\360\272l\304\3437\004\007\016\214\306\256\260W\353\305\272E\312%\371Y\351\016\373{\321\255\261\017\347\234\323\353\262\255\016=\347\001\\\267\241L\034K\t\nj\253`\301\304+\241\234\b\244\234J\023\270nC\2318\226\023"
+	.string	"\027\266\023\256#Ay\335J\310\246\021\f\245\31539i\335\246q[IE3y'm\304\200\273\025\023OCu\235\247\211\276y8\327e\215\n\256P\344qgl\207\226\004\263*\307\rerk\344\206x\265Z\304u\005\037"
+	.string	"M\204~ea\314\221E\314\024\001\201;\225\0324\206J\030\004p!\026D\224\026\247_\226Q`\020\250\ta\260\257\270\346D\254\210A\370`\024\\\006F"
+	.ascii	"\34135\n.k\232N\324\342\246$\024\243f\317J\203\254uB\001"
+	.text
+	.section	.gnu.lto_findSharedSerialPort.56.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\226\003\305\032"
+	.string	"\2061\257J\260XQ:\360'i\200\301\326\021']\013\224\304\214\027u\315\2566\307f\372\244\205,/A\207\035r{\232\355\030W\373\252\325O+o\301\366#u\002\021\344\265\037\336\303\321\177\2003\037y\033b=\275\266!B\b\331[\356$\003\232"
+	.string	"\217"
+	.string	"\235"
+	.string	"\300\017\371\371\211\202\355\2753\252D\335{.`\004\344-"
+	.ascii	"\372 W\372\341\233\201\363\327\033"
+	.string	"\205U\206\214\f\357=_|~\200xK^\200x\3338\230|=\317$\275\275$G\321\326\2467>\320\313:\252\330e\371\225\335\213\372\240\212\n\306\231p\224<p\243g\364\321FHUu\324{qQ\003\220J\307sq[\027 !M\271xB\325\306\311\311\350P)hu\361\206\352M\222S\"^\216\366\231\236@\310P\311\352\250gt:R\270\3672\325\361z\347\2313s\0223\233\314]\"A\364\252\203*\254\242\272}\314'\216^\312O\367\343\266\301\354b\3124\255\027\371Y?\377\2317\235\313?\235G\246l\037<W\222r\217\224iS~\315\255\307\260JB\230{W\\\215\271R\226\t\217?\375M\177\360\315|\346;\361\241\230\365T+\nr\321\200\204\237\344M>\277B\273\262'\234\252@\376\b\237\211YA\034\022hG6\t\255t\271\367Tp\3139\344\355\231\177\230Y\314\\\211|\351\347ENT"
+	.string	"7W\343\327\200\274\275\251M\231\037\227\246K\2440V\300\323\360\201\033\2125\306\355\2433\221]R\027\373\232\330j\034\031HKZ\b\320n\346\r\034\350u\255~\325\214\\\0031s\207S\361"
+	.string	"\241\b\314p\212\224\235\032,_\222\240<\212\217x\333}\250\327\037E`\254\200\307\022T\232\252%D\332\264\245-9*\206\003PV\277\313f\376`\322\353h\337\b5\020\317\364;\002\360\311P\231;\361y]\307\314&\336\004\366\247\251{s\017bg\2623\341wo\316A\324\227\310\370;nY\004\017\275\356\226\317#\336\226\r\\\322\265\b\261\035\263\266\301F\233a\250\211\331L\035\231N\217\t+e\317\ta\223q\320\211\321\314\0205\033\0215\323B\317Lf\203\365\370\200h1\214\301\bSF\213\325^3\331\253Gf\362\274`\264\332\213A\001\236\221\210\321^\266\331\214\366b\235Ao\033|#\317\021\212\t*!\3717\361P\237\331A\246\214H\323\3266S\bj\\\216\262}\\\352\030]m\201P&\272\227\327{\357%\333\3078bmW\237\351\226\205\220+\241\0308zE\251\357\t\030(c\373\270\245\310"
+	.ascii	"k\253\307&\262p\251\013$\337\n\211\f\344\275\001E\250q \245\214"
+	.ascii	"b\212 $\"\"B\"\221:\220\002\031\2631\017\020h\2134\205e\fy\364"
+	.ascii	"\264v\r\305\217\312F\375\200\316B\375\022\312`\340\005\242\362"
+	.ascii	"\360\375\271\342\033\261\312'\266\210\3328\247\203.~Cl\334E\301"
+	.ascii	"\031Q\336e!\332\270R\226\213\002.u/\177R\231p\350\026\236\t\322"
+	.ascii	"!\200 \t6\313\223A\242\303\324\253<\233\363\317\314J\205\322"
+	.ascii	"q\260a\376\020\300\224<\201S\254\260\236(\220\035\023p7\016\371"
+	.ascii	"\005\n`\276\350f\0041\307\313\225\347.*\277\006M\003"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.57.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\210\0065*"
+	.string	"jL\334\020D`^N:\373\307\211\360\337\023\236\230Y\306XgY\337\306fQ\376\240\307\321\344\231\246u\377\031?\304\036\223\271\265\242\223\247NI\212b\032r\002?\340\001\343\r\276\374\377\317V\213\211\266\266f\304nB\344N2\373"
+	.string	"\347"
+	.ascii	"\003\001J\365-\356\354\316\272\256\031\324\247N\350\231\263\370"
+	.ascii	"m,\3447\261\234\266\232\253\030\2058\275\265\251\247LA\265\226"
+	.ascii	"\371k\307\222u\266\033\037Z\327\2625`\326\265\211\200\243\324"
+	.ascii	"\247\334\374\321}\252\276\350>e\360 \213\265\336d\"\366\263\260"
+	.ascii	"/7\275um\032{\t\253G\233g\242\325zP\2218\024\006\201\352\357"
+	.ascii	"\246h[-\376\326\203P\003G"
+	.string	"\320\243\266\244-\242?\036J\273\273Q2Q\tx\354\f\371\263\313\022\237\224\214\031\371\260\270L\n\323\224El\020=\022\203\002v7J\"\250\201;a\372<M9\304\002\321\nBTT\211\231\206\354n\224EP\2506I\346<\356Oi\312 \366w\256#\277h\005f\032\262\342\362\013}\233$s\204\313\244M\203K G\213K\034\250S\334m\330\322\313\366\2377\260\005nm\017\311\230\221\333\237\205u]\331\202-\307\316Bg\276\002f\026\301\234\362\tj`\264\252\270\340\243\325\350t\017\031+l\367R\303\001\223u\365:\0303cx\227\252\217\221\263\256^\022X\234\313Q]W/\brZU\\\374\311\004\355)\377\306}\n\325\217{\372cK\031\260\037\\\266\257\337x\354\315u\23317\273l\227\311-w\250q\2271\023\210:\334\031\352l\377\200\324\262\200\324\362\023[n\272\333\231iII\265\234\304\226\003"
+	.ascii	"-#\251\226\001\\\313G\327\262\321\265\\t-\023]\313C\327\262\320"
+	.ascii	"\265\034\224Z.^\313\304kyx-\013S\313\301k\031x-\253\327\362/"
+	.ascii	"\265|\337<\247?\313\350\265lS\313/ \205\306,r\246\243\357\232"
+	.ascii	"\253X\037\240\225M:\027\345p\277\333\337|3\237\371o\3748\270"
+	.ascii	"\032_\223J\340\030^\223;\353\332\334\240>\013\377\311\302\247"
+	.ascii	"|\347\265d\335\215\351\324\255fu?\"\312\022\245M\317\0335^\366"
+	.ascii	"\217\315\201\207\347GE\323\245.\236=\371\372\202F\265R\207\035"
+	.ascii	"\370Q3\231\351q\252y\237Q\037u\213@\311\271.\2755\246XQ\033\365"
+	.ascii	"\211._A\210z\250\213"
+	.string	"z\202[\222\211\0165Q\233\250\023jb\017\365T\227\347\320\202d\031\324Bm\254+v\020\202\277\213\235 \320\260\201M\354&\272\026\302\305n\212\260\207] N\260\205\366\035\354\002nI>\265m\003\373W\227\224\362\273RW\307\317\231\356\376Z\355%:\267\177\375/\276\003\177\337\216@V\347\274{\362uu\223\216^\237\037\224\234\027(\327\350'.\332\207\342\304c.q4'~p\312\2341\203\366\017N\031+l\\i\233\035\353.uT_m\261\223dv\375\315\333\032\036\332f,u\237\324<\316</\373\207\177\251\373~j\266_A\272l\037\277m\243|\276\370\030\305\305P\245{\310\250\315\2059.\320B\027,\216+\254b\004mT\251\260:\2463\254h /\314\270Bv\210!\003\306\320\005UU\213\013H\020,\216+\254\220\027\212\230*\301\013\024\307\253*\031F\344\321huD\001\303Hu%\303\230"
+	.string	"\211\2211\252\256\2143\220\310+\243\260\311\365.\343\267\035\003^\336\333\227\342\257u\037w\rxjo_\356\361\336\324\324\266\273\254\004\021\227:\265\307\272I\235\002\353\246\235$E\305\216\363\356)\001ORJ\261\315X8d\250\356\371`\332\2513u\030\243C\245~\333U>=\370,\2071\365\371\216\256\353\272\022\333\214\251\t\364\237\237\"\033\343\274{\332\246R'\217\334P\353\006\350\263%Y\244\206jf\016\036\354\301\002\264\023\216\336b"
+	.string	"\215\324\355\366\341w!\324\307\271\235\b\036A\302\036\354)\237\304}\n\240\033\220\331\355\2619A\322\303K(@X\307\231\227\256\t\370\321\236\201\222A\272?\265Mk\303\363&o\313-\f\034\260\003~\250Q\034\304\f\203H)%\"\"AF\324\254\001`\002\031\252\253n\021\300=ET\205a\317\032\013m\203\324\213k\025\031\004\340\n)3\366\206\002J\006\025\361\030\312\005\346\0344\031g\225\026\251s:q\224\034r\370v\334\"5\2703\023\037%\322\3242=\\\267q\315\313\353n\025\206\221"
+	.string	"n\033\242\352\321 \356\371CC\323r&\323\240\037-\357.O\2429_6\241\034\367\007\340\247c\034\371La\277\215G\n\334\325\025\354L\217\360\034\277"
+	.ascii	"\243\275Rh\202dp6$%\242M\224\250^IU\214\256\231\322be\264\376"
+	.ascii	"\r\232\246\006\274\364p\271b\365\007\031\337M\266\002y\254yc"
+	.ascii	"\314\022\211\320\203\025\034\325{\017cP\t\t\t,UI\016\016h\336"
+	.ascii	"F\356\363\202\371\343\260>\351\f\232\362\345\021\265\r\036C\031"
+	.ascii	"R\354c@X\354P\217ctt\230\035\357\352\345\354\370\032g\341\275"
+	.ascii	"\210\346\021\256AK\240\007\231\247\027({\205\206\n"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.58.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`I\002\375\023"
+	.string	"\266\346\207J\300\020)\035\342^f[\316SU\026M\r-\350\32610z\267;\234)\324`;\334\322\255Ssy\005$So\363\323V\235:\320\273\323\223U\022\205m\233\256KV\314E\236\343\230\210\377r\372 j\214\216'\215l\"wJ\001u"
+	.string	"l"
+	.string	"t"
+	.string	"\343\351\201\360&~b\305\263\002\273\033\231\025\316\f\027\236_\255;\226w\037 \236\216\027 \236.\b\217\017w\2678gO\2114\3349\363Y\236\nS\270\030\030\0359\2270\244i\211\346\275\332\024I\314\234F\360\025\335r\032\036\206\rP\344\340t\3440\204\273S\026\275\374|\311\331\346\276\367\371\342\211\027\343'7\363\231\022\251\265z\336r2\367x\3339\333\"\366$\tk#\344\224\201\203\327\306V\215\337\375\251\367\334\242\247\367\274{\356\3649^c\364k\202\360T+L\020X\215\350\320\210\367\374\274O\373\366y\374\322+\277g\366\332\022\243\202\301\3711\325\272c0~\307\357y\3053\321\310\0223\226>KL\265V\217S+\030Oo\257\330+\333s\332\327y\212\225\357T\302"
+	.ascii	"\325\366aCP\2555\201\021\004sE\334j\034\321\325\371N5\270\025"
+	.ascii	"W\265/6`\243\311\bW\347\324~e\274$\333\214\262=\341.T\350\021"
+	.ascii	"\3607$d\002\200\0060\307\367\240\231x\372\245G@(\235\267\230"
+	.ascii	"} \335l_8\213\222\003\335\324ZCN\355\330W\2308@\252\265.\360"
+	.ascii	"\371\317\211\037\342\324\025R\346o\247~\212x*\356\313\207Q\276"
+	.ascii	"\3626C\233\301-qPB\273:{W\233\001/\224\226\213t\301Z#*\013/\027"
+	.ascii	"\214\244\262\027)\201D\201\275\\$\207G@HZ\244\354u\302\212\221"
+	.ascii	",\030\331*a\215\310NX \004\034\243\360\222\261Pb1\031ke\332\327"
+	.ascii	"\306W\361\007I6J\237x\240\277\274\312\251\006\027\252vw-B\333"
+	.ascii	"Z\207\324\352\274\242\241\343\256\322\364\370\334\027\023\211"
+	.ascii	"s\177\203\247d\233Q\017k\255U\374\370\334q\337;-\001\024l\361"
+	.ascii	"P\233\301& @\002\203\030\324m\034\202\230>\003\301\335lv\tM4"
+	.ascii	"\277\020e\317\005Lv\203\335\033m\273\\\260p\245\227\205w@\240"
+	.ascii	"\247\342t\3243W\243=xK\036\207\";\241]\267\267P\200\252o\321"
+	.ascii	"|\254\245\033\272\211\300\343T[2_\017\273\033\211\300\244\254"
+	.ascii	"$8B\2245\236{\265\370\t"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.59.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\033\001\305\r"
+	.string	"V\333`C\020q\224\016;0ygj\r\333?,y6\f\272~\"Cc\202y\257\266\025z-\033?\311\302\241\361\353\267n\272\377f\206\030\305\310~\217"
+	.string	""
+	.string	"\240B\351\360\017\270\270\201\312s\235\332b\023D\366\2262\245N"
+	.string	"M"
+	.string	"M"
+	.string	"\332\243m\0338@r\351\237\007\224\247T0)\341\262\373q\332\341\245G\250Y\362\037;|a\321\"\2452=f8\324\354nF5!\025~\254Vd"
+	.string	"T(\270\221\2714<\366<Q\225dv(\330]gJ\205\341\326n\233\201\355\004\366#\004?\214\351\204\351w\\\345s\241\261"
+	.string	"\305.\312\f\307\272\210+@\034\366\333$?\346\214\377\235\004\3510\222/\205\013\030\013)\251\226\335\017\344\321\005\266G\177[\246}\021\037A\372K\2021\273\034f\244\330]\002\036\260=j\036@{\204\377\b,\021\355z\0331\333\373\t\221mw\021\370&F#\333\207\307\353F\306\353\224\263\247\314\265R\241\3322\211\026UY`\274\250\021\203\005\225/\336\022\252\rA\224OE\315\020*\033n\264\240\324d\177\246\324\226}\270\273keY;\354\216\177\005\335\210\343\361<\037N\007\023\352\274\006\336\350\323y<\017wB\034p\274P'\342@\036\367\3618#\\'$\342B\004\030\364\240\013q#\020(\304e\276=\\e9!\310S7O=\261\255\251\346\244%N\325\364&9N9\323\242\266\340\212\314\265\202\032\023"
+	.string	"M\204\336\031\341%L\021\270f\2104\215\350\265\2616q]'"
+	.ascii	"\203K\327(\256\021ek\002\216\213\f\256,N\311 \341\322\253\312"
+	.ascii	"W\316fY\023\n"
+	.text
+	.section	.gnu.lto_openSerialPort.60.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\323\003\245\033"
+	.string	"&\362\265I\220\232Q:\004K\351ou\203\032\300&\017U\325B\r\305\220\252\2760\263\347\353z\345\215\035\255.\303\266\266\034\177?\020\314\376\361\253\255\337\277FbZ_7\320s\357\212"
+	.string	"\257'[b$\200\365e\272\321\3777!\204\310\235d\236"
+	.string	"\234"
+	.string	"\241"
+	.ascii	"\314Or%@O[\\h\215DA\344\275\367\001+\2607\021\224\314\314?\362"
+	.ascii	"\"\020\363\016\244KE\3501\306\257\211\326\275\351\214\323\023"
+	.ascii	"8o\332\0138o\366\216\363\356\262\350i\226]y\374\336]\023\216"
+	.ascii	"Z\305\255\244\"\342m\237\251\202\225\0055\234q\364WB\243_=K\007"
+	.ascii	"a\2065`\303\241R\200\2141]b\303_5\037D|YF@\336P\022\033\272("
+	.ascii	"a\301\253%\260\241\257vI\241\212\351*6\024*M%$H\247z%\032\372"
+	.ascii	"jE+\334{\271\002\207E\347\327\2319\211\231}\314\235#:\230\317"
+	.ascii	"\364\007\270\324Y\366'?\200C\3756w\362\303\356\364\277\316\344"
+	.string	"w\331T\266\237:\243O\377\223+7\254r}U~\001\t8\220\216| uVz\203\3114W\213\031%\310\245\376\251Wf \276\361T\f\233\332\271E=UZE-\037)^y\215\322\004W\274\024\211\334\2336\270\311(\254}\202;\336\300A\241T\\h\241\210\216F\234Nt\027\332\247(\033\037L'\026s\n]C\307\032\030\312z&+N\241+\030E\244\320L?\027Z\251(#\344\275\351\003\206`or\255\001F./P\336)\3537\371Xb\006\353\313\200\n\240m\032\326\257vu\b\021\365@Y\267\224\244\342%v\217\307\330\245+\274\3672\260\035\271[\310^US\203e\200\0249\321/8\355{\220\331b\006+\313\331\266\271\376\326\004\325$\373\204\324X1[\351u(\252K\220\362\347|\037L\023\030\346\021\247\362#\201?\245\207\204\275\367\376\307\315\367\r\217$A5y*Sh\004{\347D\373"
+	.ascii	"\020\254\246/\276\212\206e\365l\346\232\255\036\210\366\251\376"
+	.ascii	"\3722\004\271\205\364u\2179\355\325Vb~'\223\311$w\266\0234\035"
+	.ascii	"\b\331.\207\333\360\322\365\340P[\016n\247\264\355h\035r|h8\226"
+	.ascii	"\266\243]\210\245\250\321ptth\026X\344^<\270\333\256\306\343"
+	.ascii	"c\302"
+	.string	"\346l7\023\267\035\217-\347\366\342\332\215\016\355\226\263\351f\270\333\214\347F\333\231\325r\272\331\215\001\306\365\330r\263\035\016\227\233\301\356\313\333:8\006\005\306\317he\031\216F\236\214\345\253\336M\304\314\335\\!\250\205\312{\357u\311\232Y\303\265\360\\4\254\266\214\002\264U\201%\364\214U\221\243\332\314\034\216\305\303\225\022 d^\200e\316\256\215:e\021\312z\372\226\020\"\225=0G\250Q(H\fc\212\231\222\211$\b-j\007\240\002\021\271\263\003\021\200\271d\243r\3176\210\272\226\302\350\204MM\276s\314\007e\315\322\002\017\333\363\017\341C\364=\222\302\306=`\365\370\257U\377 \032P\240=\201\2435\245M\360\002F\033\323\003A\315\013\327\246\006\215c\332\030(\204\357\257\fa\037\200\226\367|j/{W\245\206\247\020\022\007z\372.\276\206?H\002xK\347V\256D\022\240M\2357\345\232}\032"
+	.ascii	"\205`K\227J\374\262Tr\261$\2462\002\345\260N\376\003"
+	.text
+	.section	.gnu.lto_closeSerialPort.61.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\025\001\365\f"
+	.string	"\366\027XD"
+	.string	"q\225\0168\236\373\322\246\244\216\347Z\024d\230\226\036\260*\313\204\313\346U\313 \020\022ffF\226=\337\"\f\355\001\"\b\026\032\002\335\373\377\t\252\264\360\347\251"
+	.string	">\344\222\036\352\217\303\2264\262\367\336)\005C"
+	.string	"B"
+	.string	"E"
+	.string	"\003\262S\355\002\262S\203v\215\327\221}\n\213\013&\261\335\335\344\210\203\2372\202>&D}~\270\234\013V\030R"
+	.string	"\204\0363\203\202\343\304Y\217\031BU\214\026\316\356:\202\204\036nz\333\016ls\354\177\004!\366\353=_\362K\3550`\261\033\242\030\273\034Vv\254\f\352\242\304\353o\377,glW\323\367\243\303e\203\006\027l\267\"8\265\002\355\321>\311U\200/9=\300n\210\253\305nM\340\003\332\251\353\003$mw\031\370&\025>\315\214\335=\211S\377\224\235ZNh\304TRqE\2120\321zI\233\262)\r\254P\254x\251\242\016\323(\245M\301B<\310\224g\035\363zQs\300T\022eWT\224\"\366\347\356\256e\037P\347\203\240)y\335\003\214=\033Q\207\363>\337\326q[\004\2563\332<\336\267m\n\270\223\360\361\266R\327y[\246\356\235\222\036S\212\264n\203\356:]@\330H\021\312l\356(\241\326\204\021\201\221\006+\225\020$'ev\367\223\027"
+	.ascii	".[\267e\236\314\2000\314l!~7\f\242\355h\030\213'\225\b\310\034"
+	.ascii	"d\255T\326zj\n8\330\325\204(\306\226q\315\346\302\335\214\"\226"
+	.ascii	"\247\256\210k\371)\361\246\024j\017"
+	.text
+	.section	.gnu.lto_serialInit.62.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\373\003\345\032"
+	.string	"6\361\255I\260\324Q:\332P8\301\361|\274\364hhJ\017\236\335\237\006\347\213\013c\243d\366\206\345\20222\205\312\273\036V\347|g\274g\231h=\222m\007\024J\237\223\334\370\331\320\364\341\244\007J\362\2210\347c\254\344\223M\344N)\234"
+	.string	"\211"
+	.string	"\233"
+	.ascii	"\343\007\220\247\236\323\236@aw\340\212\002\327\272\0026\251"
+	.ascii	"5X\343\006\345\251w\266\225\007\221\352\227\250\b\r\341\252\265"
+	.ascii	"\316\366\206\313\217\301;6w\177\211\2250\222\216;w~\220O\031"
+	.ascii	"RB\253\"\276\236\277\2140\027\275\252S\365\212FZ\326\225\242"
+	.ascii	"\237\031\26314\343%ld\020"
+	.string	"\205F\025\003\303\317\026>\241I*8\032\":=U\217H\346c1\307Q&\n\215*\001|A#\004#(0d>\240\271\037\036\302\025&`\327\321\320\214O\330\205Z\253'\3177t\313n\033\211m\016\366\"\t6\023\363<O\250\254\251\240\355qy\035\322'r\242\216\237d\\\212y\336\251\237\202<\255Q\002\032\001\263\370\314\242\035\354\231\373\263O\313\n\312\341\255a\307<\370\303\\x\227t\032F\247Ir\232\222\323#\235^:=\307\351\313|\213\211+\353\366T\353\213\"\227:E\233p\\x\373B\374\241\320NeO\257$.ya\251\265\322\234ZCyz\231\355\235\366\177\034\310\356A\235c\265\036\025\231j\2555\246\225\247\t.C\236\006O>\310\375\355\324yZ\305\353\220sw\037d\3643\213\216\232\033\023\032\366 \372\323\241t5Ol\0328\001\240\245\310\225\305U\275\035G\350~g\224\266\b\251"
+	.string	"M\257\231\224\343(\306\270\277\353H\230=\240\264%\304\002\232^\376\332\036\316D\307\340\252\326Z\301\311\006\001R\255\225v\272\204~\361\264\354\333\233>\224\265\002\321|\246'\0011\206\020A\212 O\277\037~\324Q\365\325\325\264D\027]I\3260\363\365\206\"i~!_\312\t\200T\253\317y\276\221\037\301\361\223N]\313\311q*j$n6\272c\303\200\353\300\223\303m\030@\242vb\304\315-\003O\t\334\216"
+	.ascii	"\343H8qc\313\325vf8\333\354f\273\321\231\341\344vf\022\b\030"
+	.ascii	"\207\242\226\233\361\340p\271\231,X\2775\202<\303\026S\027\026"
+	.ascii	"\237\375y\331\237eEe\314.\326\244y\271-\312\333\211,\367]>\326"
+	.ascii	"Zk,\302\313\215YY\214\257\037+\"SI\t\303\222:\271\260+ra\304"
+	.ascii	"\250*\235\203)6\013\244(A\261\300C*\n\266?\3773$\335\007\300"
+	.ascii	"-\302(\230b\261H\365\031r\\\372\035w\255\234\204V\304.>\263\370"
+	.ascii	"\"\251H\2501,$\215RF\221!\t\204D\204\244i\003\300\002\221\251"
+	.ascii	"\272\r\021\020IJJ\212J\263\031\210\376L`\n\341\357 \2765\370"
+	.ascii	"d3\261|\267\307\021|\331\205D\234\202\003\364\260h\345(\366\221"
+	.ascii	"\326Db*!O\213Ho\316\"\024\206\374\213\037\225\345\353YUF\225"
+	.ascii	"<\255\261\350P9\353\177\266\266\356Z\261?\354\f\310k6\231\304"
+	.ascii	"\270\001\241\332\350\203\210eS\320\232\256\035\304\367V\315 "
+	.ascii	"\227\246\354v\371\327f$C\322\252!\351\215@\364\262\020\321\003"
+	.ascii	"\321%_s^\353a\f\300\005\275t\177\031\313\017"
+	.text
+	.section	.gnu.lto_serialRemovePort.63.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\t\002\r\022"
+	.string	"V\"yH\320\362&\035\"1f\316t\264\330Q\035\245r\017\214\025%\303\236I\365\030\003L=31\274\024\002]-\307\002\251f\0049\241U?\201\316\371.r5\203\\\215\003\220\3253\356\227ov\205sXbc\226\020\262\267\334)\005e"
+	.string	"_"
+	.string	"g"
+	.string	"\237~\3318>\353\331\327\202l\210\236v\367\323\017\366.g7\027_\357\270)5\276\374\240\023\260\335`a\314;\331\341\3444\215\2046\022\305)\307\316i\2177\341L\344@F\350|j\270\224%\261\030\031FB\013\222\204\311\303\215TH\023\365\264\227\330j\260P\347\261s\260\273\216\260\020\303\355\335v\216\355\023;6\b\366,&\2428\325\374Xy\354\220\003\375\250\013\335sF\313\031\2552:j\364E\004\304\230^\212v/\334l\2734\221D\\\350\366g>\315)/`\360\272\220\313\333\237\356\250f\244cw\206\340\323\n\274\317\247l?\332G\361\024\257\003\301\030\265\333A\311\305\356&\260\001\357s\300I\270Oy"
+	.string	"\\3\361f\277\305k.\337\307\020\300x\030\310}\252vEM%6\274\016\303\26182\022!1\343\211\307w\224\222NH\225\031\245QYC5h\242\017\333\021^\004s\200\306\356\236\330~\371\n\226\002=\273\213\242\342D+\337\347\323\024Z\361\260O\277\305}FE\001M\275\236\366\031\263%\331\374\220\2117-\302\351\361BU\026\025T+-\340d\251\300\007\240K\213j\005\004\261\212\211\204\024\220\245j}+\360k\001SX>\025V\3533\t\340\325\004\025\353sY\255X_j\266W\036;\350\236\f\016K2:\323\251\314)\0303D'\210\350\033/\206\030\262A\023}\334\263\230\313\335]NewqSC\364&l\2658\245\"\035\266\343\267\2738U\251\257\211\005& p\002Bu\324\003\241\300\256\323J\330\243+\365\356\261\354M"
+	.string	"o\366\251\345|\202\t\250D\306\207Xl\301\356j\313\206\333\264\3342\213\215\023\034\327\n\251Y\374\241\260\373\266\355@["
+	.ascii	"\026\372\023\350\343~\213\270rZ\230\030\321\371^2D|\007D\032"
+	.ascii	"\262\276oD\335\316E\311"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.64.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\302\213+2Pm\222\016$\241\252R\266\315-u\267n\333\326\370\024\255\306\336\222]\265\177\333\206\244w\336\300\t\373\315\314L\221\321}+\341\201\"\360\324a\355\357-Sc,\n\227\251\312h\03255\206\351\262\3200\225\246Y\004\246\0322Us\240\250\252U\262,\202\016\t:\b\361\325\350\306u1~\330\\\261JwC\251t\030@\321\271\321g\234\303\212\357$\021\364\337\207\003\"\021\313#\3233\"\311\020\251#\364[_\371"
+	.string	"\301\372jv\341\241\204>\"8F2\263\206\026\275z\327mF'\242\022\020\354\303\351\001$d\346\207}&:\3667\370\013~\211\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.65.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`|\001\365\017"
+	.string	"F_nF\360\320&\035[\372\303*\305OB\2171\300\321A\270^\324\"\317fLw\2627E=o\005\\+W\024\244h4je\205\242\330\021\"\275\337Ld\223`\303\306\225\275>\304\024\312\262`\365\253e\203\020\262\267\224)\005\\"
+	.string	"S"
+	.string	"\\"
+	.string	"\331\343\002\006*\257\376\341\314\\\307\305\313\017\322\356\307\251\007o\207\337\035s\365,B\315\225\277\362\fj2\030`|\264\\\240\310\221\221\206\230\026+\343\b\232C\330`\207\304\207\217V\013T\327K\250\324rI\275\353)T\203\025\003\250E\363\324Fv\327\t\323\312pk\267\275\262\035b\337D\266v\236?s\032\276\347\326\230N\230\376\366\035CHG\252\330\356LL\307\016E\026:\357\271\375\317w\271\344\367\244l+B\003\202\021\321\330\375\020<Z\301\366x[e\227lg\332?\361\035\325yT\354\261\333\241h\305\356&\260\201\355\221\300\005d\217\360\001\002)\231\252\246/\221\364r\251ae,s`n\274\200z\343LS=\037\031-\231\303v\204\277T\016\020\355n\210m\013WqR"
+	.string	"gwER\374\007\345\207x4\205T\036\346\321Oe\217\251\036<\252\327\273\036k\222`/I,\031\323\227\f\216 \325\033\373[I\265\t\262qa\203\325&\025L&\247.z\246\016B\207r2\231t"
+	.string	"\\\002\"\201\244\363L)\016\325q\247\216\344\204+\361R\034\310"
+	.string	"\243&\230<\016\005\205\362\270\322\267W\033\037\305\035\030\315x\301\242\277\312\356\372\003\243\242\027L\377U\006\241z\204EY\0342\275q\251\005\3244\202H\307l\231\343S\324\2229\016ww\343\037\032"
+	.ascii	"W\bx\254\306)\275\006\322\224\272\356\204`\f\250\216`AD\305\262"
+	.ascii	"\341vq\366\266i\003M\0030\033u\241\013\202I\3064\255\333F\244"
+	.ascii	"\220gO{q)\240ZP\005\005O\331g*\022\257k\222\001"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.66.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\205\n"
+	.string	"&\223G? \307*\035\007'\305\255\360I\002\330\013\020\177\006qG\234\206P\034\321\324\241\002\272K\033h\352;Z\324\240Qd\230\b\307t3\001\020\b\020\240T\036\370\035\005\273b\206|\323,!{\313\224\0024"
+	.string	"4"
+	.string	"6"
+	.string	"R?_g\006\300PtmZJ\246\222LX\232\2331\326\372\352\032\022\216t\236\234.\277\372D\231\271\300\360t\265D\354\256\025\fE\356\355\266)lC\330^\0200\255e\222\261}\265\237r\225\357*\217'\354\242F\001\273\342\203\035.\327,~a\273v\271\302v\315\237]\340bj\317\222\201"
+	.string	"\220\355.'I<\365\2736\003\340%\302\353\300\334\335\235\336\024s\215\315\336\340\320\203>x!\200\221\244H\006p\225B)GlQ\244\233\324\030\263D\331W\375S\325\2674\214\003>\326\256i\246`\003!\257\223\300\270\243\251\340|<\017\210\353>\334\305\207c\301u<\020\247ap\207\341\361\270P\327y\\F\334K\224'\022\300>\344H\353\330.\275\025\002$\035m\240S\332]\206>\023"
+	.ascii	"m\231'3\260\316#9\266N\\g\365\302\tc\007(\b\251\0200\217\202"
+	.ascii	"&\324\"\357\022@\263\232\022\334\213[\252T-\003\365\262I\230"
+	.ascii	"O"
+	.text
+	.section	.gnu.lto_nopConsumer.67.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"R\013+3`M\222\016@c\003\007R\246\256\313b\304(\013\004\n_\214\373\261\215F\303\203\307B\235|\013Z\326J\222\220\310\340\216Z\357\2213\240\213\332b\033!;\005\316\343\034\2427\232\007'AN\247=\251EH\016\242m`\247i\006~\022\034\330<\357\301\226\251\232,T@\301*\276\232\026\363\370\214\312B\277\004:2\250\274@i5ZX\232r9\001\3713\363\257\365\n\f1E&f-G\211I[%|"
+	.string	"\220\227\343\253\020|:-\204`X\220\254\264m\354#c\256x\346H\006\200\250)\027\246\241\355\013Dm\344,\177\203\037\341\377\004\b"
+	.ascii	"3\003\316\231\001\342\313]\303\265C\030*5\031\334\345E;\311"
+	.text
+	.section	.gnu.lto_serialPassthrough.68.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\222\004\025\034"
+	.string	"\2662\263K\260VU:\344\343pl\254\201\022\362\373\254\013V\317@]\213\031-\030\321b\253g\310\257$\307\r\316\037\013\370\022\361\227\357\225\330\354\362\027\375\305\007^\037;;s\261\335u\026\n\267\217\337\274wF+!\271\216F\b![\356$\003\244"
+	.string	"\227"
+	.string	"\232"
+	.string	"\343\3544\3509\303\222Y\265bTfI\216\266\353\214\317\213q\032\032Gm\315P\016\333\205\267\032\366"
+	.ascii	"1j\313\227n\273zB]\265"
+	.string	"\203\027%\313\021\216\306g\210\316\022\336\224fT\031\243\257\202pEo\331\022h(\307\2057\0316B\221\270\344K\267\0335&x\025\016\236\221,G\270\242\253\354\203\024\t\220\013oFVu\205\027\374\357\002\226n\271j\376\bG\3642&\215q\022\306\307 \240j]\274m\202)\036EgZ\263\256\234\221\251\377^\205\322\024\265\226\024\356\275\\m)\356\354:\363s\230y\002sO\0056\177\372]w\372[\357\375\350\233\376\363N\347r\254L\332\312\243\255l\307\312m+W[\371\002*\213 _\322\257\220r\357P\230/Wj\\\242\343E~ \024\020\036\024>\021~\220W\334\300\301\354\300\022\277A\267D\017\036\024\361\336\036\202\217,\301\374XW\314OO T'\023\001\320[\363)1\350\025\021\2742\237\351Cfo:q\326\275:$J\356\355)\340\002\346G\356\275\206\374h\336E~\344\031\363\225\367v7"
+	.string	"O\206\212_\227{\357\253m\260\311'\307p\031h3k\250]\247\fs\267\227\265!\247\336f\323\017\336\025\034\276\210\260+\022U0\362-\363U\231\331\211\325\333\336\2372L\377jeHP\3174\220\323\222+;\211\200m\344\017<\027\210\232XW\343\264\020\223c\353\006\024\233?\360X b\322\345^\024\267\261\255\255.[\350\310]\375\237\222\355$\032\035S\267\216o\202lu\323~H>*\265Zd\263\242\034\230\314z6\363\b\237z\033\377\367\357\204B\244jMc\356\321j'1\277\201\027 \267\216\371Og\234\0279\337\034x\016\260W\370\361\260\023\223\221\025\306\037\017;1\331\370\323A\007\204e\330\002\02091\231\216\317\253'\366\n\021\313\341y\301d>\257\005"
+	.ascii	"\270G\204\216\354\365"
+	.string	"\323\323#{\255J~\353\310f\234fX\023\331\347M\223]\372Zp\241\341\250$\302\035:\366}\234cW\342P\b{\241\342\244w\2427}\250\273\224\f\177H\325\2326S\177H\351\216e\233\004j\373\277\263\210C\03626\265\233\313f\230QM\355\306\220\241\336\3068@Mc\233\356.\221X`Q\001\006E\r\263\352$\376\033\350\004(m\265\356Q\257\375%\037\225[\250q0%\rR\n\221\210\210$I\r\351\300\002\021\271:\007\0200\310\244\212\2269`\212\322\361\335\351q\246Q\312S\202=\212d\021\357\242\377B\221\357\026\344\321\362\326B\275d9\003l\330\303\024\205\235R\340\376\026<n\252\005ig\251\312p>\340\002\372\252\236\243\t\362\206&\356\333n]\034\256B~\315\325]\f9>\233!lr\260}\3156\300Mg+~\027P\223\2644\333\213\345\fX\257 \020\215\256\241S$D\001\322\005\205"
+	.ascii	"\376o\221\253\353l\243\240 \371\326\274\307\303\261\262\226\""
+	.ascii	"\300@\327u\032\264?\346Cf!\312\213\360\224\311S>T\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`f\003\325\020"
+	.string	"\264\030b\004"
+	.string	""
+	.string	""
+	.string	"\002\303"
+	.string	"\177-\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006.\177.\260\206\3618\272\320\202\002"
+	.string	""
+	.string	""
+	.string	"\005'/\301\204\001/\1770\346\206\316\220)10\1772\234\211\365\321"
+	.string	"\0021\1773\005&!\300\003\0022\17745\1775\252\333\3426\0053\032\005*64\1777\0026\17787\17798\177:\250\212\250\332\0019\177;\270\215\221\313"
+	.string	"\005\307"
+	.string	"<`:\177=\002;\177><\177?\377\377\377\377\003=\177@>\177A\220(B\300\003\002?\177C\002\300"
+	.string	"\177D\301"
+	.string	"\177E\302"
+	.string	"\177F\360\372\2508\304"
+	.string	"\177G\307\3712\001-H\305\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005+I\001\305"
+	.string	"\177J\037"
+	.string	""
+	.string	"\200\220\200\001\306"
+	.string	"\177K\310"
+	.string	"\177L\312"
+	.string	"\177M\311"
+	.string	"\177N\316"
+	.string	"\177O\315"
+	.string	"\177P\314"
+	.string	"\177Q\313"
+	.string	"\177R\003\001\037$\003\f\037$\003\f\tB\003\017\016\320\371\216\307\003\001b\003\017\006\350\274\307\343\001\001\302\001\003\020 \204\223\242\253\001\001\244\022\003\023\022\"\003\024\006\003!\271\255\362\217\002\001\204\006\003\025\b\026D\003\033#\221\205\327\307\003\001$\003\033\"D\003\034\033\"B\003\034'\300\206\275\355\002\001\344\001\003\034&\244\006\003\034%\304\006\003\034$\007\007\003\034&\231\365\231(\001\244\n\003\034%\300\327\351\371"
+	.string	"\001\304\n\003\034$\013\004\034\325\007\004\034\231\365\231(\001\325\013"
+	.string	"? \240\002\2312\352\001\366b\204\216\321\272\005\322\320\317FC\247[\347\024\265X\002C\323\214+\230\262\216;&\0206\036\257\036\244\220C(\271\206\232"
+	.ascii	"\222A\"H\202\004\220\f$O\320>/\365L\230\207U7\350\231M'\334F"
+	.ascii	"\f\003\204\323\360\221I\237\036\2446L\206\333\3111\246\3378\302"
+	.ascii	"\007\376H\3314:d\265\035\217p|c\363\311\363\f\\\177F\347yl\030"
+	.ascii	"\306\2643|\315a\221%M\b\235\227\321`Xx\300~&\231<\240N"
+	.text
+	.section	.gnu.lto_.refs.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375 \267\235\003"
+	.string	"\242\t\030\032\240'\351\377\377\377\377\377\377\200f\377\336\376\367\254\375\347O\333\266\335\332&R\246\263\213\236*\314\310\235n\242\267Fp\336\007^\307\217\273\265\201^\216+\367\202\342v<\271\257\342T\334t\036\013v\t\235\261< O\225Nk\200\233\375q\236N\257\021@I7\365\255\"\235\375\340\245\ro'\377F\005"
+	.ascii	",*o\b\227\317\034\336\315\353T\242<\001"
+	.text
+	.section	.gnu.lto_.decls.e17c9d0a118aaae0,"e",@progbits
+	.string	"(\265/\375`\302;\325\366"
+	.string	"\312l-QV \fA<\035\r\005R!\325J\363f(\374o\241\302\206\341\3057\334X\250\355ih\215\016i\3018\322\302\035$\331\225kfi\246hD\311\336\360(\3109\341\327\204v\256\034\212\212\247\324\205_\243\b\211\221[\276\234\3756\242\235\303\003\361J\230zB\332\2262\311\024y\004\366\004(\005`Q'YP\267o\250\244\204\211k\205S\013\231\340\316g\027\341\235\236\251\335DD\027P\247\245\247\333\276\3237y\b#l\r2\030\206\225\325U\316\216\313\264\343vIEJ\240\226\335\333g%\025\263&D/\252\264\337!r\237\364)\036\351\266\017\375\023\376(\276\005\227i\367>\323z\350\223\370\2404\2578\350\013\375\021\t>E(%\356\340\\|\346\302\230\350|_\360\322\221\021~\033\222\203\361\271(+\231\371\200#\322O\364C\336\356\275W\232\244\224\260\216\366\377{\023-~&\232"
+	.string	"\261\323_\202\005\353 I\325\340\364\377\250{'\232\340}\366\377y\235\367ay\2733A\364\371w\236\347\266\031\276\007\205\247\335_(yK\230\306\326\264\337\fC\227\f\303\274\333\302\016\376{H\030hb\354\263\313\215\031f`\t\314\333\301z\362\201\346i3\323\032\f\200K\213$\304\302\211\340?u\r\366|\016\274HtP\202\\\272\303\337\375q\247\230\253(\205\235'M\256\337\005\274\355\375\273I\374*\271KD\370\273k\204S\264\277\313\244p\272w\253AF\203\206\224#w\202-t\366\217\352\341\023\336\257\320S\367\233v\335n\237\001\244\236\374}\346\223\031\302\025M\211|\366\037\322~\217\334\"\227\310Er\215\334\366\356\335;\277xw\210\347vo\236.\367\016w\357\n\271e\230\253H\253\355\354M\367\336~\201\344\005\276\301\021\305\242"
+	.string	"E\270{\327\356\372\300\355\232\376\361B2\245\013r\245-\317\227\275s\327\027\335\273\365\253\345\336\301=\204\021\356\336\255\273R\334F\367\316]\217\007x\375\021\331"
+	.string	"\334\273\225\321\340\222\3677\006\327\222\375\262i\257\273\030\206+\227\207\366[C\373u\241\375\266\240\375\356h\037\213\273r\267\r\300\235\363\020Fp\374\354\332Z,\2049\bQ\240\375\006`x\013o"
+	.string	"\206~\324\276\366v1\f\375\003zx{\\\266\333~p\333\374\252]4Wu\332\335\356\335\272<\214'd^\237=\003\332\357\007C\\Xx?\030\272\003\364\327\335\230\341\313\305pf\206\262\343\006\322\332g\277fw\354\226\375\323\336<{o\fZ\334\360\272\212.\331\375\022\243r\362\331=\320\277/\206!\0077fx\301:\370\r\213\031\026A\333\355\""
+	.string	"4\267\036\237\2117f\250\343j]/\f\024\364\264\307\366na\262\233\321^\222\317w\307\335\272\355\345\272]\236\273\236\366\327\336\233EEjmL\3473\007\027\3030\337\230a\013\324\336#\370\353\234\275\367&^w\033z{1\f\365\215\031\272_/\367\327\222\272\377W+\367q\356\377"
+	.string	"8\307\300=\303p\354\216\255\334\337\352\315\375q"
+	.string	"\311L\027H\312\356\271\205\r\210\346X\360\013\334\363\016\b\236\374\017gq\317#Rx\031\027|pQTr\t\036\001>:\020\001\213\024\356\317\326\343:\241\260\3662j\237\346\236#\220E\200qw\024\367\374\301\017\340"
+	.string	"\033\250\026\270g\025\367\317\217\366g\276\342\2361\210\340\211\373\225\231s\025w\334\304\265;&\342~\367\336\fD\212;\006\342\356M\334\235\211\273\027q#\356~\304\335\211\270{\236\353\371\237\273\367\331}\231\373/\221\271{\227g\340\216u\334\337\307\375{\334\177\307\375W\340\376O\367\347q\177\240O\272\177\n\334_\005?\346\356/\356j\214\373\345\013\342~\357\334\375\272c2\367\027s\1770\367\347r\377\035\356\217\345\376W\356_\345\376R\356\317\344\376&\334\237\204\373s\300\375Sp\377\013\270\277\005\334\277\002\356\357\301\375Kp\177\b\270?\t\356\277\301\3755\270\377\001\334\277"
+	.string	"\356/"
+	.string	"\367\317\300\375c\334\037\305\375\211\356\257\272_B\367+\350~\227\270\337>\367\253\347~\361\334o\235\373\205s\277;\334o\b\334\257\233\373-\272_\017\334\257\230\273\363\271_"
+	.string	"\270{\240\373es\277k\356\027\315\375\226\340~)\340\356I\367\333\301\375\226\271\3371\367\253\272\373\234\373\375r\367\017\334\235\314\335\333\334\257\212\373\345\341~\267\334o\226\373\025\201\373\315\341~\261\334/\t\334\357\b\334/\001\334o\007\356\227\003\367\253\201\373%\272\373\023w\037tw'\356.\350\356f\356\356\345\356+\270\273\234\273\003\240\260\260\260\320\235\b\302=%\310]\003[\370\356)\020\004\203\251%r\365\255\371`\"\347r\270N\357\275\257\227\021h\006lC\n\032\375\214\3530\214\022;\2020\035\212\212\"=<:i\362k\372\026\2705\220\024\023(\236\273IX\220|\262\304\244\3321\020\374\346\030\016\303\341\256K\002\212\"\203\257\364\320\376\356\303\275\217\324v\027\355\254\f\257zo\006w\226\213\257\007{\273\003.\260\367\316\331\023\023m\245\246\243\202\203\235a\357g\021\320\027\324\023\006\350Kg\003\201\325\031\301"
+	.ascii	"\265{\005\006\373\213\305\006j\237\236\371\351\371\273\335<P"
+	.ascii	"F\233\347\351\311\004jw\321n\237\236/\233\307\350\005\250\325"
+	.ascii	"y\002}A\031]\240\257'#\230\315\263\237\233Gg\205\346y2\002\232"
+	.ascii	"{2z\001\372\3221\002\342\2012\272\273}\332WH[\013\365\364\331"
+	.ascii	"_:,{\357\2406\372\\\331[\247h?\355^hCM\205v\323\276u9Z\026{\357"
+	.ascii	"\275\237cE\242\236P\332\235]\007t\365d\343\263w\221-\304\200"
+	.ascii	"\347}\376\354\235\347\335\333\247-\332{\347\211\004\320\247"
+	.string	"\213\367S\264Y6\217N\320N\324\323\212\317\316\323\317\276Zq\215\200\276\242\236:\364\b\373\212\356\235\366y\243\273\bT\221\376z\266{l\t\313\027\fh\320g7\342S\336\220\"6\264\264\25515\365\004\263\035\245\304||\366\225\030k\267\305kx\353C\273\237-^%V\240\032\247=F\303j\216\323\360\331\nO\213\323\362\336:\367v\320ro\007\252\233\f\035\257a\366\225#3\\\326D\206\230\234\213N\024\017\215\260\026\207\341\261\333n\242\230\037\025EE `\261\333\312\264\350H\022c\207\237v\2259\260/\270\351P\222\317\330+\223\365\244\001A\323\267\305]\252\016\2666\305\225\252Q~H\324>\267\255\312Z\023\031\n\036[+t8\324\232|\336r\307Zx\307\253Xq!\222\202\214\351\263\336\033\353\210\342@\260%\253\254\022\252W\\\226\016\316\021#\216(\305g\277h\202{C\236\030y+\f\362I\224"
+	.ascii	"F_o0:\r\354\360\243\226G\204\304\222\377\303\352\233\342\247"
+	.ascii	"4\372{\317'\330\265#7}\373#O\236\360J\213\340\241\262\026\260"
+	.ascii	"\022\246\201\227\260\013\034\003_a$\\\205\255\260\r\034\305I"
+	.ascii	"\030\013\247\300*0\016\f\003\337\300Lx\006n\3022\360\n<\205\245"
+	.ascii	"p\r\f\205\237\260\023n\201_\340(\f\305,n\213\251\360\t\177+\214"
+	.ascii	"\302\177\204\0368 o\344J\t\205p\220Y\324\347-\212\251\260\021"
+	.ascii	">b\301#JGD\026\005\272\3224\236\270<\367\016$\320\242\270\004"
+	.ascii	"\016:\373>\2543\2077\335\027)\034\324{\274!%\242\017\030\310"
+	.ascii	"\207\213 \2205&\206\251\336\311\365q\353\246$\240\205\004\311"
+	.ascii	"\225\266\340\275\233\234D\337\016S\375\335\225\336:"
+	.string	"\350~&a"
+	.ascii	"\r\032:\224\340$*#\272\017\031o\225*|$%\301\336cD\253\302!%\237"
+	.ascii	"]eJ\273\n\222v\025\036\355)\201\332S\33646\221\221\244RU\237"
+	.ascii	"=eM{\n\016\355)R\332SHhG\031\324\216\222D;\312\020\355(A\264"
+	.ascii	"\243\374\320\216\202\246\035e\207v\024)\355(B\332\265\240v-D"
+	.ascii	"\273v\323\256\311\264\353\034\332u\224\226\271\030\206\317\344"
+	.ascii	"\233\334V\346\375\256\335\316\320\322g\327Kz\005\273\360\312"
+	.ascii	"\f]\027i'\022\352\fxz\001`\232\004\242\f\355\304\026\264\017"
+	.ascii	"\001\265\017\203h\037\202i\037\342\320^\304\205\366\351\020\252"
+	.ascii	"\035\360\205\324\331\350i\261\365Y\251=\323=\242\255\223 t-|"
+	.ascii	"]zO:\227\342x\341\002\310\347\"\025+\n\206\024\343k\020y\275"
+	.ascii	"\230v\335h\212Z\331p\212^MMu\250\230J\265\370\027Cw2x|W\331\235"
+	.ascii	"\320\024\305\026\221\330\233\235\330)\361\204\341{>w0\264\264"
+	.ascii	"\336\247\205\347e\363D)Eq0\241=\326g\231\270[\232>\332\0252\343"
+	.ascii	"Q\354x\0371\257\244\351\003\371\266\237{\270\217{\271\357\361"
+	.ascii	"k\377\366l\237\366n\377\343\317\336\307m\037\355\207\\F\013\355"
+	.ascii	"\275>\354\326\215m\235#\016h\264}~\032d4\264t\305\020j=\310e"
+	.ascii	"c\\H\216\2645\210\250\315\370L\366c[wSqG\264\253w_\017\346\362"
+	.ascii	"'\304$\357\355\253\355\271V\256\216\210\252\300Zu\207v\365J\273"
+	.ascii	"\352B\273\252\244]5\312\312\021\235\321\265\367\271\316e\205"
+	.ascii	"P\307\335\212\317\256\002i\317N\264g>\355Y\210\366\354C/\340"
+	.ascii	"\306\f\243OcF\356ik\233\322\021\375\031v;v\330\347\237\341\""
+	.ascii	"#M\b\213\317/\343\372(L\233s\373\354M|O\005\310\213(\272\250"
+	.ascii	"\366\274\342\251RH\351\354}\366lBO\271xRE\007\370\331]8\337\312"
+	.ascii	"\006,vGF6a\3140j\027\325Y}\346k\003L\\m*\013W\2452\036\030\217"
+	.ascii	"\364\263\032\225\207\336\240Z\264A\221 |\342\363Y]\341\302\327"
+	.ascii	"\324\"\016\207\372\024\263\244]\310U#UHe\302y+\373\331\265\211"
+	.ascii	"\210jqYJ\200\033\b\232A\205\313\004\227\020\025\352*\223\253"
+	.ascii	"K!\214\340{X7\362t>\253*\\U\202J\331\246I\252"
+	.string	"\222;J\212\225\324\027\216'\332\025\240\273\220\214\214>\253)|\357\257\366\202\222|V\221\334m\005J\004\320\205\332\002]\324\335\316g\365H=q[\227SQx\013\333\017\231\234\237\366\025\\\227\033\252D\256\026\2615IA\361\r\225\345\251\210\032\321~\301N\273\253&T\023W\360\303\313\336Qqk\304\030aP\271\265\f\304s\221\333f *\t\f\004\335'<\210\n\"\367\343E\336g\025\210\250C$\017\316K\373\325\322\313H\246|zJ2\223\033A\246}\031\211\326\021\365\231\3752\341\255\203\276l\2364\300)\232\372\314I\212\250;\352\217\352\243\362\250[\325Q{n\253>s\023\317F\362\021\227Q\237yj\304\205\211\016\261\024/Y\317\3676\330\001\372\260\305\367$\027\3366\023\272L\2733a\376\313\203\267\016\332\356#\0254%V[\031h`Q\202WD\305p0;9k],\371\234\005\241)\344z\242"
+	.ascii	"o\233\003\233`\365pr\341I\373\005%\355\027\204t^\242\207L\231"
+	.ascii	".\374h\277\260\243\035fP;\314\237v\230>\3550G\3662\022\365+\216"
+	.ascii	"\t]F\"\275\223\006\355\344\351\317pc\206\031/\347e\"Yk-\314\350"
+	.ascii	"\264\347!)\274\bb\3669_w\033f;\317wr3\242Bp\332s]\026R\244\212"
+	.ascii	"\214\253\207\366\034\304"
+	.string	"\254\220I\322\347L\247}`\274>HaJs\312t\356\031\356\363\262\224\004'(|\362\3679\313\3459\317\322\034\227\245\fx\332['K]\006\367\326q\271\267\203{;\310YQ3\312\206\331a\2664\013^\007\317o*t?\246<\246\326\326\262\033\004h\250\210n(V\006\255\204\007\270\347\303\263\033\261\247E\333\3649\267\375\321\214)\265\351\347\314\366GU\322>\247\317\271\007\006\343\271\003\203\003ki\223B\345\370\3540HiiYK\r\320\211\016\035C\246gg\271\352\303\f:\247%\300\r\2009)\211##\313ea3\340\246fZYK>\347\262+U1b\204\265c\013\f,\213\251\361`\031B\"W\027\346Y\214\230\025\325#\351E\206W\366\272\322\224\235\267\026\004\177a\312[y+s\335=#NKX*mWoy\255g.5\254- \2373\017\234Vv\346\364\365r\224\225\225\265\320\312\234\226"
+	.ascii	"[\326\200\352\230tx\326Ji\241\342\251\365\242\023\215f,\2557"
+	.ascii	"\344\264\0048\314\301D\342\007\207g\254\0279\202l|\3167n\031"
+	.ascii	"\361\217E\020\033\037\244\002\306\"\315\352s\276\372\032.TG\262"
+	.ascii	"\200>g+\337\313<,h\310}\3165\336\307E\253\211\215\306\207]'k"
+	.ascii	"y$\272p\030\325\220\255%1b\344\252\0170\200\2062v\322\212dx\256"
+	.ascii	"B\371\302\223\361\214\233\232\312/>P\355\251\004FAaPy~\021e\001"
+	.ascii	"\370\343\262\325\302o\233[\340\037\031\236\366Q\002h\b\321\241"
+	.ascii	"\004po(\b\252\214&D\317\252\247\247\314\342R\231\250a&\343.\312"
+	.ascii	"3\0133\270\266\264\f\365z})\360\240V\340\005a\322\322SWDIJYE"
+	.ascii	"V\221\233\304\210H\247,UPau\237s\323\037\371\330a\263\373\234"
+	.ascii	"\227\\zZh!']\027oI00\255\f\365\234\204\323\350\244N\340>\347"
+	.ascii	"\024y\210\345\213H\330\333\347\214t}\340\021\321\232Rb\302D>"
+	.ascii	"\361\201HdL\003*\234\244}\316'\216\264\330T\016\"\237\263\321"
+	.ascii	"\020\217\252\307\021\274\\\224\203\362\220\325TJ-\017e\241\272"
+	.ascii	"8$(\2766\203\2618#5\022$\230\210I\250h\350di\367\374\343\267"
+	.ascii	"\315?W\020\005ho#\002x\005\201\202p\237\264\350\b[\344\235w\356"
+	.ascii	"Qq\021\303i\tP\367\004\021\336\310O\317=\231\347\317D\217\274"
+	.ascii	"\314\223w\346\316L"
+	.string	"\f\341[\221\"\204\353\313:\367N\203= \264\017ZA\023\022\206\366\331[\204\006\0071!\n\0362\350\264\204\205\362\342J\320\307gL\b\201+\236\033\177T\347\3477\266\244\t\026\274\020%\232\365\024\231\246\314X2\310\343\347X\020\007^%[\202A\0021\340W\022!\231\322~\261\272\244$\374\367'R\316\322\232\262\332\222$\301K\256T\332\312\323\334\234\224\022\307K\334\204\f9\002\272e0=\317\031V{\267\305{\270/e'\316i\t0\343\200\373)\201\371Pt\376\306\252Z\013\2408\206\250\362\362\260\036\261'k)\003\216Z\331\261}\306zGV\316Z\f*}\306FT\366`\364\220j\302E\336gHG4(\370\331YJh\2779.\266k\261\035\306\273P\224\001\257\240\351.Z\002\201\030\230\344\002\0325J$\2134z@\005\013\216\306U\205\265y\202seG\230\220\003be\221M\017\250\270\315\006"
+	.string	"\2140&\327\243:\202e\336P@\003\267\331\300\234a\213\034(Wf\006\2303 \334fC\007+s\004\210\017\250\260r\\sT\360"
+	.string	""
+	.ascii	"\267\331\300:9\254G\234\344\214\022\311\241\351\304\341pA2\211"
+	.ascii	"\243T.\225D\26684\301RI\2441\256\311\314\256\316\233\365f8\202"
+	.ascii	"\271\364Pt\233\r5\314\031%\216\212\222\346Ugq\205-*k\230\252"
+	.ascii	"\262\206\211m\330\032\345\232\034\256'@:\263\323\271"
+	.string	"6\217G#q\004s9\223\233,\023\037We\r2i$\036W'N^\235Do\026k\230\033X\362\210&\353D\326\254*`\260\251\301Y6mX\247\323X\243D\262,\362\306\25146A\3308\221J\344\tK\020\315\345\t,\322h\002\0038Y%N\022i\024Q\002\273V@\304\362\346\205U\342,=\270\260H%\n\253s\231\234qQ\256\314e\213\223\003\316uy\224i\342h\340\250D\236\240\201\313\021\2314v \346\270:\221\027\326b\215\022\3314\332\254\260*\2217\315\225]\217\026Xp\263\262\316\021+\024c\330\2345\005\231\fF\2300"
+	.string	"'\312ZL1\201\211\303\302r\231\214qb(*OP\241\206y\001s\251T\361\031dsU\2565\332\031\320"
+	.string	"\0054\200\204\034\"\313\026\235\030Xo\220\254f\235\310\013\304$\227K\023\212*\233As\275\301q\34649\3240c\234E\246\361f\246\2516\327#R\304\262\311<\2569\315\2345\311\304\231"
+	.ascii	"M\322h\223\262\036\221\315\346*bYT\"9`\213\304\032#\210%\262"
+	.ascii	"X\203\223d\312\300\260\253sm\036\225\310\020E\326\350,\336\340"
+	.ascii	"4Y\026V\246S\203\231\2255i\234Ia\233\253\b%r\246yD\336\250J\344"
+	.ascii	"\215faf\265\231\3111\336h\027\247\207\244Q\2041\271d6WV\211\302"
+	.ascii	"L\023\003\347\2726k\326\t\254\311\032e\t7F\017\"\2304\027\216"
+	.ascii	"\311\245\215sm\332\200X\331\231\022\232H\243\214\0229\263:q\212"
+	.ascii	"9M\225\344\252T\346\340\030\2139\306\033\027gs\331l\256\030\206"
+	.ascii	"\354\352\244\241Y\252\300d@C\263dqf\004\340D\346\030\21358!\326"
+	.ascii	"#\213\303T\"1X\231#\330\342*\002\311\032E \233\353q\203\346\222"
+	.ascii	"\2351\322\024\227,\216\261X\243D\332\260\313\345\215\2638\323"
+	.ascii	"\2249.\221\315\225Y\244a&\213\353\215\261IS\234i:\213H\247\263"
+	.ascii	"\231\301\021Yd\221J\034\226\020\2229M\247\013\3534\322\024qB"
+	.ascii	"8[\334\306\331\\E \233\307\r:\360\262&C\030A\210\030\256\305"
+	.ascii	"\365\270\304@\312z\\\336\344\265\230\001\026'sI\\Y\243\nz=\001"
+	.ascii	"r\005\315\352\346\312\321\270~H\"\215 \232+\r\r\216\t9\354\212"
+	.ascii	"\b\344:\263\252 \223bd\215\023\310i\2664Y\r\240\300\302\2141"
+	.ascii	"D2i\364\260&\217\310\025\237q\262+\254pT\"i4`\235\306$\n\353"
+	.ascii	",\2565F'\007`Xgq%e-\236`\201f\213!\210\3006Wv\306\3304\332\314"
+	.ascii	"\024\331\3452\304\332|ia\335\006\003_2\327&\007v\271lrP\031\321"
+	.ascii	"d\327\2335\271\262\0308\213\027Xp\0321\240\\\"\331\031%\016\315"
+	.ascii	"\n2\205\351\274\201q2k`\330\"\t\304\234\365\250D\341\210c\fQ"
+	.ascii	"\314Y\206`a\306\230\fq\201\263\006I\243\\z`\233K\246\n[l@\007"
+	.ascii	"V\211\304\321'\260i\026W\326xd\342\0241\254\305\346\212\244A"
+	.ascii	"\262\312\365\210\002\333\\j\340\002\357\320\301\003\007\034H"
+	.ascii	"\241\002zfC\322\210l\256N\016K$\007%\322x\303a\246\351\344\260"
+	.ascii	"\341\002:uG\223&\034-\244*X\byQ\2419\256\024\350\223*\251\034"
+	.ascii	"\356j\001\214\033B\".kI\361\315E\341\324+\035\350\206\"\360M"
+	.ascii	"\305j\ts\350\001!\324\361\343G\370C\255j\221\332\240\322q\313"
+	.ascii	"/\\\234xP\241\371P\245R\202\354\331\215}n\265V\210\210`<\261"
+	.ascii	"\375 .\231A\205\365\020\314}aiYk9\211E\222\237\336\347\217RI"
+	.ascii	"\322\324\236\245\345\236\0261@\036Ihc,<\220V\f\235\365a:\275"
+	.ascii	"\037<\3140\336\375;\332\261U\2462\325\361(\244\"\303uB\006\247"
+	.ascii	"\354>\213\211\021M\205Vp)\001zy\251`RJS\354Gt\225B\375r\025\f"
+	.ascii	"\005\\W\213=\036<T\256\005\334\375\023\006\006\235\016\245Q$"
+	.ascii	"\314ZW\271\336gE\352.F\224\\V\226\272c\003u}~X\371O\b\2155-W"
+	.ascii	"w\f\001\034$\361Y\325\361G0|\244\260R\273qC\305\272b]wo-F\370"
+	.ascii	"\350\224p\270\212u\244\207l\254\315\343\270\214\360\252\242Q"
+	.ascii	"\365\252m\332\347\247R$\rl\312\312\325\2535\244\027i5\332\347"
+	.ascii	"\346\253\241\322@Q\202D\217\247eGE\324\202#\027.\324\252\333"
+	.ascii	"\325\305\203\315%\310o\210P\225\341j\225\034\236W\321g5\206\273"
+	.ascii	"e\3013-\250\317*\f\365\205J\245N\3459\271;\251R\267k\023Y\220"
+	.ascii	"\343h\013\232\001%*\205\\\250c\303#j0M\031B\214\231\031!I\223"
+	.ascii	"\244\003\003\025@PPD.\234\253\273^\017\023\200\023\b$\252\032"
+	.ascii	"G\221R%\"\"I\222\024\366\330\r\240j\274\362q#2\303\004\036\036"
+	.ascii	"\244\235\321\020\221\3340J\277\267\347\027\362\035\177@|\257"
+	.ascii	"e\251\331\264\nF\214'CT\256\254b\223\203\232\241>q\260\023t@"
+	.ascii	"S\336=\r\336\236\321\362\223\317k\370d\313\362\237\241s\0045"
+	.ascii	"\253\361\263\263I=Xq\310\372\302V\316\272OE3\f\342}\375#%\364"
+	.ascii	"\205\221\251\0255\210mGS\352\333V\326S\202gb\276\002\312\300"
+	.ascii	"\256\230\214\375\201\226c\356\255\264@\036\310\221Op\247\350"
+	.ascii	"\272\267#\307^\235R\223 \342\330\357\237\242x\302\204\261\211"
+	.ascii	"\026\250\"\264\020XP\251]\307\036W\367\212T.4\233!\235\006/\363"
+	.ascii	"d\340\033\300y\266W\276\346O\276\313\267J\310\277\3316\245\024"
+	.ascii	"C\346\036\004VQ\201\365\017FjL\b\361B\323\235\n\302>B\035\027"
+	.ascii	"\342\nV\347\252y\017\214\253u\316\264\213\354\027\237y'\244\277"
+	.ascii	"\235\t[\275\253`\345\267?\311\306\017\235\213\027,\372YX\007"
+	.ascii	"\023\332G\013a\003L\264e\201\363\nw$3\267EA\257\370,o\215\322"
+	.ascii	"\260E"
+	.string	"\341\3522:\332\231\340\013<\275Y\304\222\306@0T<\327\"7\006R\266XV\013\b\343\372L&;\340r1\252\244\027\377g\327Z\211>\005\247\013\030\244J\300B\247`s\002&\230\324\216\266\341B\346\003\216\217\r\345qEA\374$\377&\004\251\256\303sL\233g4Z9\216/\025\312\340\332\266\340\301g\264\025C\274\036\363\313XU\345\004\244>\207G\302\335\022\316()\327{\247x6&\301xl\020\f|\375Z\341\346[.\217\330\266\021G\001\243\325\345\334\024\227L\020\222\267\366.\3128\313dm\236&.\226\266\305\314\025\r\3438\254\360i&%\n\261#Ze\334\023E\244\345\3732Q\020\244\363O\343_\353\303\320@!TU\026\257\023/\243_@\005\244P.W(\335x\370-\357ME\003\n\2327&\\\265\356\370\006\267\361\261k\376\346\254\036\177z\312U\346\202\205./\002o\241\307Y\356\366"
+	.string	"*\263F\233\326YW\303l\326\315\227\023\t8d\232\311$\302\013\303\322\232\302\361\302\270E\313\016\0258\\\224\274\262\373"
+	.string	"K\301\340G\332O#I\2260\202I\031\221v\254\37015\345'\314\250\256BSC']p\240h\221\307\256\320ST\275\353\n\\\243\362d_P~rXn3\224\210N\335<\325\215`D\352\312\006\337\364:!\335v\336\313\300\223\233&s\204lj2\216\022\253\365U\302\002\001\236P\035\216w\361>\340.\"\277\340_\216W\224qxM\307C\351\324\246@\256"
+	.ascii	"j\030\261V\374\334\372M\361\032\376C\"I(\302\326)\274Sq\335\235"
+	.ascii	"\215\206\\\r\202\373t\345@93\357W\332\n\224_\021\034a"
+	.string	"\206\271\324\206"
+	.string	"s\244\261\242\016\232\345\204\036\323\304G\r\277:R\345\3024\024E\246\023\211\334\236Knp\031\b\204\016U\302\233\216r2\351\024p\247"
+	.ascii	"\344\036N\367r\347\265?\366\2507(\226I\256\234Ny\207Is\242\204"
+	.ascii	"\016\270\2249D\206\371\305\005\222#\226\231Tq:\036@\240\260\301"
+	.ascii	"S\253B\003VR\255wb\356\340@K\266\023\324RoEb\n\250!\300s\233"
+	.ascii	"D\215\216\013\354V\327\262;\027\233\0217J\020"
+	.string	"9\2270B8\373\3358d\020\344=\361H\273\252ya\206\\\361\323\037Lv\006%L|N\200\207m\355L\013q#E\337R\263\362L\317\220L3h\242\236$Dv|\220\324\300\030_\023r\317\002W\002\307\302GLM\211\3002hXZ\237\t\226\275bc\244\355\r\327\353\0370\033\253\351\246\013\006\373\021Y\037'\370\234\345\316g\215\224\351\266\364\003\333\242\026FD\317[,\345\234|dve\020 \004\313\026\036D1\212\336S,3\220\n\257<I87\277U\3613\223h\246%-\354\331G\f\260t\320\335\324}q\215AY\233X\264\305\371j\225C\201\305\211\201\271a\353\265&\370+\024#u\030\343\246\002H\354\226\224\206u\251\024S\212\263\217j\341\215\036\374`\245\257\263\253\252\013\22318\300z\005\004re\264\257\371\274\305\376\236\"~\320\315N\332\335\276\261p\336\203\267\013NC\2168[\254\203"
+	.ascii	"\371\016<\206N\367\215\217SN\244[(,\331o<\364\316\"W\027\333"
+	.ascii	"KG\246EF\207\033s\376\215\372\256\003\254B\213\034 \224\340\027"
+	.ascii	"\273\210i\301^dg.\022l\"\312 g5c\3065\3179D\330umL\025\203\354"
+	.ascii	"\f\003\233\234\361\\\270L\212\356\275\001\237\261\273\017Iw\342"
+	.ascii	"qDL\264\\L\204\022\025\233C\036\302V\007\\=BC#\315\377\347\210"
+	.ascii	" \360\316\303+\f2\367\3664\260u\301Cw\314\225\005L\270`\347%"
+	.ascii	"\017\332k\206u\320\322\225\274U\r\357\201\2303@/|ZP.\216\013"
+	.ascii	"\323\372U\231\013G\372\323:\375\2301\231\005E"
+	.string	"\377\371\211\306k\001\013Of\310\276\034R\312k\r\252\r\334\272\206\274\235'\\v\016\272\330rn\236\034\t\300RN\364A\210&\251U\177X8K\347\212\371L-\324\371}\351\264&c)\315\311\007}\177F\204t,z*\352\377& \207{t%\242\237]\027\032\027Zt\276\210h\270\031s\270\352z\276\267]}\030\262-\314\013\263\375\243{\303\350\314\331\020-N\2408\301A\3339\005\235<a\032\210\035A\304\242h)uXfa\377\214\326\273\030\212p\306\201\232\221EE\230qU\354*a\326\330{\271\366\344\262*\207\177\217\334\352\n\013\270\311\n^\022\006\246\233Z\231\3266P#\313L\rX%\226\004\356\211\026\236y>`1LiNu\372\340?\177\301\361\n\252\241+w/2]\332\332t!\306{\035\254\272\024sK\341\002\217\342\030\372\252i\270m\270*\275\302\212\243\252rW\346y\261\253\304\361"
+	.string	"z\027\231\005\235\374\026r\330\312\327\216\363ey\234\242\225t\314\264a r\345\270!e"
+	.string	"\325\013\365\240b9\225[o\037\367\315\315v\334\326\237\"\334\0227\277\003\203\f\240\3639\2126\245\316\202\237\314B\255\266\334$\374T|\356\224y\365\263\372`\317\026\377\033\320C\031j\006bTF\244\226{\004\252_\bt\304\317A\2259\314\220\346\270\260\022\354\223\025\303\244\240\213\236\350\220U\371j\237\226v\246\013g\221\312\335\364\017\217\3120\301+\027P\\j\303"
+	.string	"\330\350\022.\2439w\366\365G\002\321f7\3504/\331\021\013\224\200W\240\036\\f\023Y\252\200L|\275\242\345R\233\305V\302\202\327O\244H\017\361\205"
+	.string	"\364e\230\027pf\013\273\316\225\240\237\202\253h\217\363_\330Z5\275%\"\265\001\0329\255\355\235\315\220\035\307\317\235\343y\330\252\366h\031\355\177oz\276^\0042\001\306\304c\341\367i\303{\024~\365\203\356\342^\327Q\374\272\370\023-Q\025h{\020\232\353\240\201x\214E\357\277}\017\2662\257\n-\316:p\261\236\256G\n\245\251\312y\022\345r\334\247\333_Yx(\365A\303\202\207b\266\333;({,zWY\253\273\204\305\331\245\252D\215\224\331QV}W\326\251\036\200\2316\n%\307\276\356\335\375\022\005\177\334\374\230\370>|\030,\342\365\301\340\247hu\013>\233\320\344\030l\245\223\321\255(\341Ye\016"
+	.string	"\221Ha\231\210\3220\371MQ#\330\003\266L\214\017u\333?f ES\006\007r\247\265\342W\312\0352\\\355\305@\372cvG6\316\305\307\322.\213\n\225*\021$e?s\237\372\325\2636\3153\"\304\030\331R\203\261"
+	.string	"\001\034\"\316\310\001"
+	.ascii	"\201\204\255\367\247e:\002\035\262A\205:\266M[K<\034A\\\2315"
+	.ascii	"\305\304\247\300\023V\234\372\243\363\227\356\036\354\214\234"
+	.ascii	"Pi\240T0}\301\322@\254fQ\202M\222\3432E\3372h\303\234\227LkA"
+	.ascii	"\222\257\2557/~\277\374D\366\307A\371\315\353p\253\312\3040\300"
+	.ascii	"\004\016\367Iv\207\356&\335\350%/\002R\207\275\261\335b7<\371"
+	.ascii	"\315\321\350\031\n?N\246\212\375\321D\220Y\0310\221J\2236\265"
+	.ascii	"\372\365\335oX\360\034m.\335\343C\207\366\277!E\003\341\241\022"
+	.ascii	"\360n\026\3408\030\225[\001\205b\204a\006\302iP\232yk\323<v\212"
+	.ascii	"\"\004\216D\304\221\273d\315+\005\376)^&\215^\264\3752`x\261"
+	.ascii	"\316\353\305\226e\214\360\324u\334\372y\363Y\330qNT\3324pP\353"
+	.ascii	"t\261\267\240\256'\276r\031\357\306\343\203\255\337\021'\326"
+	.ascii	"\311\214Xd\336\"\204?\310\322\006\316\267\263\266\314T\353\326"
+	.ascii	"xy\336\317\253\217\256\323\367\027\r|b\356\372r7\360\337\231"
+	.ascii	"`\254\320d\233h\022\335\236\025\271[\234\021\354\227\304a\262"
+	.ascii	"\013\\\200<T\230)\336<\334\316a&\2569\337C\270\\\352Zy5L\202"
+	.ascii	"\033\226\273\334\177i\321L\2535\374$\315\277$\026\322j\227\311"
+	.ascii	"\306\036\341\367\251\307\331\013^\035\177\274Z\200\211\243\322"
+	.ascii	"\r~\377<!\034\020\374\230n\335\331>\221\214\221\371\rL\217{a"
+	.ascii	"Y|1\327\366\276\330y\330\315PV\262\336\215x\2136\222~\370^\331"
+	.ascii	"\213\271\356}\325\033\304\366\235\253\241\227\201y2&i\261\312"
+	.ascii	"%\301Q\340\n^?\244\254D\017j\207\3515\216!\235\300\267\035\206"
+	.ascii	")\230\251\353.\033\b\327\363\0247{\240,\203'wWd#\206\221\374"
+	.ascii	"`w\250\345:\221\327\343\362{J$M\202\275\032}\346\034g~\3668\347"
+	.ascii	"\261|\321\355Q>\261gk\233\232Qtc\216\271\372\310\335+\347M\217"
+	.ascii	"\003Gvm\346j\027\363\223\207\334\270\355\306\374\240<8_\367'"
+	.ascii	"|>9\277\016\310{\315&\333\227\244\371\"\367\216\217\330*\220"
+	.ascii	"\213\322c\002{\024\277Mw\370X\352\231\007\3768w\227\320K\377"
+	.ascii	"\246D]YN\351\f\n{\301\345\203\266\t<\360U\357\344\2540v\311\275"
+	.ascii	"n\270[\331B\373\354\352]\274#]\001"
+	.text
+	.section	.gnu.lto_.symtab.e17c9d0a118aaae0,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"serialConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"serTcpOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e17c9d0a118aaae0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,416 @@
+	.file	"tramp_protocol.c"
+	.section	.gnu.lto_.profile.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375 \333\325\002"
+	.string	"\344\003\317"
+	.string	"\006"
+	.string	"\312\347\334\321\013\004\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\243\352\210\312\003\022\002\001\002\003\004\002\004\002\005\331\360\341\242\t\024\006\002\003\003\371\306\335\343\002\004\365\300\251m\005\355\273\320\262\017"
+	.string	""
+	.string	"\n"
+	.string	"\300"
+	.string	"i"
+	.ascii	"*Rq\303\251U?\007(5\360\022@.\365\2736`\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375 k\375\001"
+	.string	"4\002_"
+	.string	"\006"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\003\001\200\004"
+	.string	"\t\001\001\001\002\002\001\003\002\004\005\003\002\001\201\004"
+	.string	""
+	.string	"\n"
+	.string	"\013"
+	.ascii	" $\t\002E\270\b\226A[\260F\315\037.\213\360T=\323\232\r`\001"
+	.text
+	.section	.gnu.lto_.inline.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"5\006"
+	.string	"bJ\"*\220'I\007\253\342\277/\342\306q\375_\367\n\341\334W\276\255U\363\377\026}\371\377\377e1\2066\254m\326\266f[#D\356\024\277\330\213u\365(\203\314\214\236)\366\035\034P\230\026\264\243@#2\2239YTB\310\314E\203k\017\002\341\332s4\375\003\024\017\225\301\265\367H\305\321\301\265\3474\370/\366b\351g\250\345.7\202\253\001z\357\323\314L\345\241*\270\366\032\311\004\351D\021\213\330\021\352C\224\260\340\2742\036\004\030"
+	.string	"+k\005\332\033\264gD\233\030\020\b\035\fR\226@\264\206\201\265"
+	.ascii	"\300\027p2\220\017\004\017\353\321\\\220l+\351?\241\223\030l"
+	.ascii	"\300\001\277\220n9\255K;;\327\322\300\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375 \243\265\002"
+	.string	"\"\205\017\030\260%\351\ftIH\0030\206\301\3230\025\226\020\032!x\267\275e\222\001+\021\301\216\023>\370g\0304\005;l\340\311a\347_\325+\024\027\214\255\244\262\251\274W\252\261\204\003\236\253\021\002\b"
+	.string	" \343l@\013\312\345\262\234\224\335\242\332\202\231\347m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\231\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"u\003"
+	.string	"\302\304\020\035\260%\351\200\270\305&9\300%\001B\032@\024\302\212\350(%\035\260\330\2445B\244L\001'\224\220\004\235\3772\230\231rg\264_\373\353\365ju9\327\374\254E{\244\031\020"
+	.string	"\001\001\377S\350\304\366<\002\021"
+	.ascii	"\020\202a]\004\200\b<\214 \211!,v\352B\200XV5Y\"b\306R\t\210"
+	.ascii	"\022Bg\214\231wb\3323\200\""
+	.text
+	.section	.gnu.lto_.lto.dc7142a04e24de67,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_trampFrameGetSettings.12.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`\276\003U\031"
+	.string	"6\355\237F\240ZUc\304\353\262D\023\312AXxi\321\222_K\265\023L\323@pXm\230\034.M\341m\332\266\356\344\321\336\273\355-O\250\200k=q\224f\030X\246T\273\311p4\037\3602v\205y\320\376[J)S\n\203"
+	.string	"\211"
+	.string	"\222"
+	.ascii	"^\335\332H\236\344v%(\352=\252F/\307{\357\317\255\023L\341\314"
+	.ascii	"\225\355O\373F\256\204\373\221\024\327\271WG\225(\367\002\021"
+	.ascii	"\030\250\2745\360<\344m\371\035\362\3268;\314\200\035\316\032"
+	.ascii	"\026Mg\356\275,\312\3039\257\300\273N\334m\245\023\347/\275\347"
+	.ascii	"h\310\363\251\270\2555\307/\227\343\333\325\006RN\330\364|\272"
+	.ascii	"Y\203\3148\275\361\2638\344\371f|\252 \334{"
+	.string	"=y\276\0307y\3333\333\026l:&H\366{d\340\200a\252\303\276)U/\336d9m\017u\327?\335\364G\376\251\023DC\200\231{_\264Qs\247\254\224\037\017\376O?\324_|\265\357\017\377\344C\275x\243WN\026R\200{\202k\202\263]\212\031\030y\224\023m\342@c`\032b\302\266\371M\376\344NB\nl\207B\253\367\310A\021\247#\005'D\005T\f\201L(mgB\004A\327\202BT\324\361^`\2047=\350\013\275b\302\335\016\264]\272\371L\001\367\336[\203^iIU\273\241\321\217\244\226\252\350\301\030\335\320q9\341\301O\362\211\310[K\355nJ\257\006\225\372r\345H)\322\0169)\2457\336\247Ih\364\323\325{s<8&y\226ki-\271\360\203\201\036\367\2568\317Eb)j\371I\363.\362V\303\226^\r\024\263\302\201\007\377#\004\r\2142\257[\221j \204\210\215"
+	.string	"\247\221\017Z\304\253\320x\202\036:\225\021"
+	.ascii	"z\334{\027D\025\301\374\244\024\344\355\205\237J\2773dr\263\215"
+	.ascii	"\r\324"
+	.string	"M\032\366t\315\\Tv\020%$\310*\210V\214\304\255u\341V\223\301^8/Xk\026\302\332\005D\"\346\212\325b3\331\007\031\2545\253\261bC\254\022C-\030\3135\243\261\200\b8&{\315X\265Xl\30620\367ZIzC{^z\031\2241\225\243:\277\313Ot\206\037\3058P\032B\346\206\236\350\r\007C4\207\177\351p\342}\314\fyc,ErN\357\006-\351\312\005\2339i\245\275\325\016\252\242*\037a\246O#I\332\253\224\322\"%]V\31445K\250QDd\220RD\221\241\021\231aX\315\030\220\002!2\272\r\021\220\305\232\022\n$\2459\263\203B\367R\037\022$\311\246\317\215\273O\337\226\375me\033\225\021\336\027!$\250\357\234hn\\r\301\205\252\n\333\025\323K\221\364\307\276Rpe\033\356\re\205\363\203\024\220\352C\357M\246\2726\203\201\276\330yGOO\216\211\004"
+	.string	"Kg\261\034\340\245\n\020c(\217 \354\206\223\331$\034\233\263\034\026\260|\357J)\3337I\032\203NX\007\203\310\326\035\252"
+	.ascii	"\232\355m3+\356\007\207\tC\256~\266\200\376H\035\206R\001"
+	.text
+	.section	.gnu.lto_trampFrameSetFrequency.13.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`/\004\265\033"
+	.string	"\226\361\256G\240\232Qc\304\211\324g\035\223w\377]3\226VUm\263\346`|0\316<\206`\024\f\314\r,\f\273nI\352\353#\226\2603\345\213IK\307\002`\250\261\300\t\334\231\032\225\007\007\236x5\031\247c\223\275\245\224)\005\224"
+	.string	"\225"
+	.string	"\243"
+	.string	".\354\325a\257\210\031\336{\031\\\264\005-"
+	.string	"\337)mW\336\235\334\376\364\202\016\270G8\032T\367>i`\b\344\305\001\364\324>\223;\335\336\004\306\t\334\033\004\013\325\275\274\006\356!/\232w\236\361\"\371\235\361\242ov\231\363\226\356{:\031Pk\356\275\260:\304:\267\274\333\322\333E[\351\315\357\035\301\016_n\027\343\242\265@\232\214tvH\226B\226\324\033\335\016G\355\221\034\257\307:\r\002s\273\034\247/\f\367^\323\334\356\306=\336\366i\333\204mO\004\346\341hU\262\217"
+	.string	"\307\017\033\256A\3542\007\347W7\231C\375\272\360\036ou\213\177\372\353\233\374tg4\262U\300\313\2755\272\334\\-\261\252\310\177\277\325/\374\257n\355\373Un\345\013\177u,\227U~\020\341Fu\233\272\331~\305\023\230\334\312\203\246\371h\266\315\237:\325\253\036D\260\235\212i\257\216\nK\246\206!\200A\007b"
+	.string	"\215| m\237\022\204\0017C\203P8\274\227\307\201\214\362\237/\345\022\312m\350O\f\"j\310\207\342\362\242\017\365\250\241\373\002\037kN}!\001\223\232\310\372\2528\365d\222|\340\206'\b\237\311\017\032/\276\252\210d\245\343Q\263\306l\031\326\252\2643\322*\326c]\001\224/\251\tG\273\\\253-\342dF\360|\261K|\314\t2\300{_\260\345S\322\303\336\013\344\302\360\351_\016&\205\224K\241H\260t\357\321s>c\227\242\024>\023\275\317x\221\204\027\035\017\027\224\304\202\377\316"
+	.string	"\t\033\033Q\261s\331\242\200DI\017\0017\307\377,\273\026\223\347\347\331\263X\004X\272\367J\310R\364\3433\301\030/^\352\324\251i\r\227\021\355r6\225\235\262Z\273\n\240\f5\253\"f\266 \212} \022\252\321f"
+	.ascii	"\210d@\263!\333\354\\\2013\243\305\316\025\242e=-L\231)d\236"
+	.ascii	"5\237\032-v\n\301\314\037\030\320O\214\006\223\235A\260\036\003"
+	.ascii	"6k\263\023&d\232'\314<\243[K\326\262\352\334;\031uD\313\250\342"
+	.ascii	"|3\177\320\033\256&M\005\247$\\e}\320\034\316\025t\207\243\361"
+	.ascii	"\360\340\025\250\001\346\316\210U\311::\0375\247\2264\336PZ\307"
+	.ascii	"\252+\205T\234\372\"R\206\372\346HV\335X\305Z\324\013sD\333\330"
+	.ascii	"{\357\265\016\002S\250a4e\020S\204\021\241\021\221\031M\2321"
+	.ascii	"p\002\031\262\332\r\021\240A34\243Ii\016\356\343\203,$\353GM"
+	.ascii	"z\233$\240\026X\245\211\321\027\323\244\3766\351\177\221BB\337"
+	.ascii	"A\003\331 \030\226&e\006'(:}\027\270\005G\020\024\305\374\322"
+	.ascii	"d\"\332\217\027gy\320\033\323\261\322\371\027\r\215\026m\362"
+	.ascii	"\236\336\r\332\277\030D\3618\016;|\371\351$\002\360\227v\213"
+	.ascii	"\007=G\240\003\306(:(\177s\024\351i#\"wc\202\373\253k\357mcx"
+	.ascii	"D\030H\275J\360\372\202\302\2508\334\370\330\237X\361\n,9(\322"
+	.ascii	"\262\272H\321Q\"\216+1m\310\177\2753w*"
+	.text
+	.section	.gnu.lto_trampFrameSetPower.14.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`+\004\225\033"
+	.string	"V\261\255F\220^Qc\214\002\033\263\007E\301\037\362Z\200\261\205\212\203\236x\352\032S'\034#\206\007S\030\230P\005M\252](Q\373m\210\234\301{QC\266\315M\350"
+	.string	"\200\005\214P"
+	.string	"\217\264\004\302\360T\307&[n)S\n\222"
+	.string	"\226"
+	.string	"\242"
+	.string	"\343\3651vAS\274\367.\270\365\004\256\236\377\304l\327\336\245\340N%\303\366^!t\204\367Na\340\007\345\255"
+	.string	"zj\037\312\245p\237\232\361\001\367\026\t\n\357\3551pPy\353\336\201\310\333\362?\344\255q\366\232\367\236\356}M6\252\274\356\275\262z\304>\037{\367Hq\267c\2458\337\367\003?\276t<\032\267\343H$J\311\207\2674R\330\262\252\263\343\345\350\270\244\307\353\265N\207A\035\257\307)\354\302\275\327T\307\333q\223\267}\332.a\217)\0029Z\235\354\037\340!D\207k\021;\306\263\363\254\273\344\241\206\235\210u\333S\375\365S?\375!\247\302\020"
+	.string	"so\216\2579\227\313^%\371\357\307\372\211\177\326G\373\376\226c\371\304g]\313\261+;\200\200\023\342\2008\242w\261\004(^\347\362\241mA\233M\344\003/\374\225\003\bD\327b\216\327G\205'\300\342\207`\221\001\032J:\224D\317Rt!wC\003\221X\274\267\227\241\274\362\237o\345\230\025\334\321\247X\004\260\311\275\367\310\267\342\330\255_u*G\257\202\024<\025\266\024d\212*+\254\356\324\253a\n\222+\236\"|(\277\210\274\205U\273\204\265k\252[i\300\024ku\372!i\265\365ZOPU\205)*G\277\\\253M\342jL"
+	.string	"\225\261Q<M\212\022\300}W0\004\030\007\310x/\021\013E\252\227\271\231\025Xn\245\002\301\323\2755\256\023\"\307$\255\360\241\350\205\310\333\023dvMHt\204\202\377\276\200I\034\035\302\331\305\204\241\300\304\t\220"
+	.string	"7\311\377L\373\027\023\350\347\332\267\\"
+	.ascii	"x\272\367F\360\2224\344C\315 oou*\025\345\325\245D\277\354^6"
+	.ascii	"\245\235\264z;\013\030\030n#\213\231\371\"\306,D\f\243\233\255"
+	.ascii	"\326s\326\220\314\233\255\331fg\013kZ\320\013\223f\032\231\347"
+	.ascii	"M\350f\233\235F2sH\006chf\223\321\316\"YP\001\233\267\332)32"
+	.ascii	"\315S\346\236\322\307\261\254\261\272\263\357%\225(\\J5\347\263"
+	.ascii	"\371\207\336p8o*H5\351\212\325\017\315\341]C{\270\033\020\037"
+	.ascii	">\001\234\240\256\215\255N\366\331\005\251<5\206\243\016\245"
+	.ascii	"\225\254\273\230\221\272SaH\326P\337$\313\272#\253\255I\2763"
+	.ascii	"5\250\234\361\336{\307\006'kS\250a8d\0203\206\221\241\021\221"
+	.ascii	"\031M\232\003p\002\031\262\332\r\021\240E\233\231\321\2444\007"
+	.ascii	"\356\343{,\004\353GM\272Nr\240\026BA%F?L\223\372mr\334\212\324"
+	.ascii	"\017#\007\375o\203hX\332\304LsPv\372.p\013\206B\220\213\375\245"
+	.ascii	"\311\tc\277(N\344\237\314\r\272J\347_44\272P\223\377t6a\337@"
+	.ascii	"(\031O\024\027\307\261\303\037\211+\271\001\311\223Z~\325\355"
+	.ascii	"\004\212\223\002\225\007)D\316\r\351:\342\270\343\021\224\277"
+	.ascii	"\016\350\375nh\217\212\301Y\242\022N\001W\f\274\370\370O\254"
+	.ascii	"x\005\026\\\021iY]\242\350#\321\305\225N{\347\237\336i:\025"
+	.text
+	.section	.gnu.lto_trampFrameSetActiveState.15.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`B\004-\034"
+	.string	"&\263\262I\240\230Q:\301\271q\271\372\020\017\001\373\275,\n\217\243#H\303\253\274\341\025\277\031\301\353\f\236\333S\005#\263\377#/\031;\346mN\333_\207\247\276\300s\360\033\tZ\262W\244\030\366J\023Hi\344\362\332\032!D\356\224\002\231"
+	.string	"\230"
+	.string	"\245"
+	.ascii	"Mw\002\364')\306JT\023\034\031.-8i\235,\0315m/\265\035@\330\035"
+	.ascii	"\330\202\300\311\024\227\206\265:a\340\007\247\366\227\276dw"
+	.ascii	"&..\240V#,\252Z\201\f\234\003;i\340q\312\223\260\337\224'\275"
+	.ascii	"\263\265\016D\252o\022\"\343I\231Z\353l\203\330\346#\360\036"
+	.ascii	"\351\356\344\270t\3473\235\372\204<\"\224\357\305\311q\364\221"
+	.ascii	"\024d\343\023\032u\260\242\272><\355\371xt4\242\343\373\341q"
+	.ascii	"~MD(\237\216\323\027\205Z\253\351\220\017\307]\3366\220m\017"
+	.ascii	"\366\330\023EK\\A4\215\r\344\321=\262\177 G\217\033^#[f\306."
+	.ascii	"\274kb\324\260_\335\257[\001\377\361L\376\215Q\177\300\205D?"
+	.string	"\206,\021Xm\244AS\263H*D\036\374\255\376\253_\370\321\276?\345V\376\325\205\037\332\244\222\332E\331\371\274\2127J\313\251\274\312\267\244\233\355\343G\271\324\251l\372|\352\034+\221\004%RE\rR~\f\274\230*\222\001\346\363\250\037\n\274\031\027\206\303b\255\300\013P\036\364\237l:\355\200\336\304d\215_\321R\255\325<y'\233'\375\177\255\271/\241\251\030I5\013\333\330\036L\214\"\236\026\256\203\377\363\177\312\223\260%\205\204\275\035\213\365%Kq\367\350\246\334-\367\367\343\021\235\222x4\215\277\266\207{9q\270\330 \336%\004\f\300b\rm\215\373=\323\025L\271\342\021\241t\215\265\372\230\360\340_l\362-'\216\200\372\223\b\004H\265\302\370\320N\251E\305\b\377G\277S\236\374@\354\355HA;(x\360\013\224\314\334x\242=+\213\216R\022\036\001~\226\017\272v,'N\320\266_1\001"
+	.ascii	"\251\326\032\301\212\n\036\377\347\242<\371\247\337x1\n6\255"
+	.ascii	"\345j\213;\211\023\026p#\t\332\331\263\202\266a\205\016w\263"
+	.ascii	"\311l(xt5Zi\273\321r%H\327rz\316\332\251;s\270\035\334\215\226"
+	.ascii	"\323\315N\236\331\t\036\332mV\313\375\314r\n\370\304\331r3\335"
+	.ascii	"y\346f\246m\003\203>\2165+\333\236\231^A)\313L1hy~\230\277\312"
+	.ascii	"\030>\206\213\203\204%H\270d\373*g\370V\2255\\\f\207W=\001\231"
+	.ascii	"\251\241-r\217l\323+ZsM\032]t\367\265=\023\310\306\366%D\213"
+	.ascii	"\372gY\263=\333~m\271,\232\272\300\240g\306Zk\035\033\004R\250"
+	.ascii	"a<d\224AF\t\304L0CbP\230\003p\002\031*\273\016\021\260\305\232"
+	.ascii	"\021\322\302\322\034P|df)\013\315\365S\317mg\b\005\206T\216\237"
+	.ascii	"\305j\025)\004\246\360\361\304\222\260\020\241kV\217\213\264"
+	.ascii	"b\375\204j\262\031\350\253A]\341\177\301=a{qA\231w\267' \251"
+	.ascii	"\212\200\202\007\346\033\240\235&`S\3730B\354;9ni\206Ab\347\267"
+	.ascii	"\327\3002\211)\200\326D\272\332\236t\203f\275\216\204\n\214\257"
+	.ascii	"\316\243\364P\237\246D\301>\"\213v\275\350\025$\377\236`\246"
+	.ascii	"\033\203Vo#\217\343V\3505'\367\003\302_~\3641r\\W$\201\366\246"
+	.ascii	"\373Q\001"
+	.text
+	.section	.gnu.lto_trampParseResponseBuffer.16.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\335\013"
+	.string	"\366\025QB\020o\234\016\200#"
+	.string	"\013a\214#\320\340\220=G\333\345\313"
+	.string	"E\355\227\227\201\002<\371\365s?\352\320\177\210\371\3165\342\201J}\f"
+	.string	" \022\360\265\253\206t4@\313j\2063,\231b\023\021\"eJ\001;"
+	.string	"@"
+	.string	"<"
+	.string	"\225m'P@\362\367\b\342\343\035B\\8q\262\0333\375\360\345wJ\363\3635\300\215S\330\206+"
+	.string	"\260D\031\330\335\207O\017\320\224yev\327\331\001f\270\253\333~`[c\337AO\247Oa\020O^\020(\331\375\230!cYT*Dl\223\354\212m\212d$\322@c\205\001\2265\205\034\026d\332\037q\022\244\217X\370e\367\264\"\305nD`\f\366\312\361\002\254W\330\003X\017W\017u\206CK\324\225\252\227\332\235(\337\201i\245\033\0074\200`P\r\261\345#+\365\341/\321E\t\030&-L\031\303\216\245\324\020\023\036\"\210\365d;\215}\344\277\036\177=\311\003 \r\002\205\323:\035\221\004\253\233"
+	.string	"\362x\236\326a\346`(l\234\315\333\270P\204\320g\303y\331\346\311@\236\315'\343p]\206)\340-\244q\231\267m\\V\211\034\327\223\037^c\"\002EI\372\237e\3054\025"
+	.ascii	"\255\032\370\205\200y:\243b\001&a\005\242Z8J6\2700\\\306Q\326"
+	.ascii	"\330K\023\"\250\006\256\2009\020\030(\021\2140@\205i\352\276"
+	.ascii	"\241&oW)\003"
+	.text
+	.section	.gnu.lto_trampParseResponseBuffer.part.0.25.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`\252\004\215\036"
+	.string	"V\367\301K\240\326Q:\304\333\002\353\320o"
+	.string	"\263>'\217\006\005\022\252\217\343k\321f\306`\211\341\213\355j\260\322\310\326\330\177\374q\201\244_\365\211\304\377\32768\353\3570\357zV\3622s\365\215Q\025+\2005[@\261YB\b!r'\031\256"
+	.string	"\262"
+	.string	"\241"
+	.string	"4\001.\260IHB\333\257\274\023IA\263\336\030Dn\313\374\2453\371\234H\212\013\270\267(\312\325\275k\203\227l\203\276\344\3652\346K\364\004\314\227\314\037\302\017 \360\210\017 \370p\357\353\321\3609\202\260p\002\273w\235\275\354\035\034sr=\223\266w\3644K\262m\254\307/\376\034\215\200\303\311i\001\307\021%.D1\204n\2222\303\036A1E\026\344\202#\326\226W\005mI\222DI\276\230\"\020I\341\311\324\227w\335\n\213?K\332  3\336\357\272\fR\323\227Tq\306\355\200\307\316\233{/\337W\343,;3\367`\346\017\314\244P\001\022P\0010\336;\f\363r\207\312,\037O\362K\275\t\003\365\225\033\253\022\330\005\256\f\330F\363!\245+\252\343\265\376\255\237\353\207\372\311|>\223k\361\267\316\365.N\227(\341\035\213\247\336\212'\274"
+	.ascii	"3*\335{S\225\217u%_\302\251\372(\033y\205*\b\251:f\355j~\254"
+	.ascii	"~x@\325_\355n~-.\351\344\264n@_\236\357\304\343#\371\324\253"
+	.ascii	"8MB\305c\251x~\203\304\030\214\034KG\rR\217\3121\361Q\271\232"
+	.ascii	"\237\365\016;\3348*\201e@\017\365\324S\323-\256\317\210\301K"
+	.ascii	".\237z|X@}\230S&\355\233\214\354H#\273\006\230i\237R\233\261"
+	.ascii	"r/0\202\224\025&\370H/\371<\346K\264\227^x1.1\371\3126\342\030"
+	.ascii	"\241\261\317N]|\261\357na\252\243\315>yh\261|\233Y\266\260\333"
+	.ascii	"\266\212\246+@\333\205\373\344\275\367\222\016\336}\366\td\025"
+	.ascii	"L*\233l\263\237%h\344CA\221\343#\361w\346K\262K\240-\241\r\237"
+	.ascii	"\r\343~?\301\022\345\330m\324\266\337u\213\204\364\373zJ\372"
+	.ascii	"\3310\333F\334\261#\2201D\344.bf\3130_\3774\265,\213\311,\243"
+	.ascii	"\247y\256s)\263L~\353\334\327:\3337\375\017\267\227\330\271p"
+	.ascii	"#k6\034\\NI\303\321z\247\246!\206\253\345\344\364\2200s&vtt\272"
+	.ascii	"Z\016e\232\315\t\225\246\352T\334m\304\315\206\203\323\315T\235"
+	.ascii	"\331\216\016\216mF\303\345f6\007X\275\325p3\235\252\342f\351"
+	.ascii	"\273\210M\257)(\253\363\357\231\257:\006\257!PV&\277g\302\300"
+	.ascii	"4\337\370\372\207\316X\363\334\304\224u\332\314\034<\330\007"
+	.ascii	"q:\024\354\037\346\177\351\0248\272\027\370 f\020\257\022B\001"
+	.ascii	"\2138\225\021\006\216d]J\241\362\373\222\242\221\022\025\311"
+	.ascii	":\333\250\352\037B\025\207F$\267\211\270?s\204\302d\222d\331"
+	.ascii	"\261X\243M\202\031\347^\271[\250\201HG\224\"%#4J\222\244\351"
+	.ascii	"`\002!Fw\033\021\200\261\223\252\252\260\314\001\255Pd\231E*"
+	.ascii	"u\302\333W\233yj_\b\277\253\316[\356[\343\205\tC\352\203\257"
+	.ascii	"y\305\245\1779.d\377Gg7\026\212V\356\213\0371\001\260\226\nv"
+	.ascii	"k\333\371li\006j \227A\272S\326\332+1\310\013\335\347\321gN\231"
+	.ascii	"\\J\220\313$\263\177\322\362\345\007\020\207eC\206+1\212\343"
+	.ascii	"o\240H\341\247\340\333\004\007\253'\303\r\213\316\021\342\021"
+	.ascii	"\255\345\363\222\177oX\024\344\353\235&`\201\f4s\357+\360I\301"
+	.ascii	"\371\020\035\354f\005Iu\332\241\262k\007\375}\306\214\3101\343"
+	.ascii	"j\252\360D\312\375\222\350#\337\210\216\f\fT"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375 \301}\003"
+	.string	"$\005\275"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\031\177\016\220\240\223\"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \f\177\017\272\200\202\002\r\177\020\016\177\021\017\177\022\020\177\023\240\300\246\304"
+	.string	"\001\021\177\024\377\037"
+	.string	""
+	.string	"\200\200\200\003"
+	.string	"\006\322\301\242\013\001\244\007\003\005"
+	.string	"\220\240\223\"\001B"
+	.string	"\013"
+	.string	"{\b\375y\031\236\037\214l\363@p@\017@\017@C'K"
+	.ascii	"\217\331\232c"
+	.text
+	.section	.gnu.lto_.refs.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.dc7142a04e24de67,"e",@progbits
+	.string	"(\265/\375`\235\023\025Z"
+	.string	"*\230h!Q@\320\322\031\016Z9&\374\200\215\361\214\342v@\271`\301\301\272\037\371\202\r\254o\211\203\365Y\200\013T\223\207IL\020q\2619\323\240\f\360\206.M\2023\300.\003\220\0359\230}<\372\323\004ytO\3263\2777y\023\344\034r\373f\307nR\246\276\001\377\001\r\002g\376\035[\262M\023\241\333\003\237\231\331A\203\317-s\3645\303\001M*\327\356\355\354\b\003\244\b\237?\233\205\215\210\247\t\035+\031|~\275R1;f\327Vm\327m\256\227\005\263Z\366\354\2736\362\330\335_*V\242\240u\331\264m*\033\340\032K`\233k\266e\333\246\\\321\345%\327\275~\271\374G\277\211\023\333\3340\233\366\301\251\333G\017"
+	.string	"\254\326j\240\321u\257DEEEE=I\206\004\251\3629\277N\351\277_\376\036\03758;\230|~\205\364Jiw\005\325yRg\016\237\007!\r\261C\350\b\026i\211\035BQ\013\322\275\262Xv=`\263|\247,\225\357\030\327^\271\b\035\2620>\277\"\375\036\200\356\352\352\366"
+	.string	"\364*\322\233H\337\334!\024h9\240B;\204\262\334\016\211\201\350\2559\242\202p\330\277P\266k\301vH\250e\217u\257\033v5d\230+\343seX\257]A\354\327M\234\370\256\b\266vu\257= )\251\"K>_\224~\243\034"
+	.string	"\253>qN\277 \320\255[\020\350\327\035B\323\345\200\376K\004\376O\363\357\322*\225\360o\320\277$x\370Y\375\367ha\b\360?\3759\004\270\017\037\340g)\267\007\234\256\346\177\226\177{\316\001\263\360\357\371\357\356_\237\177y^\374\353\342p\376\277\371\367\347\177\234\177\370W\375\337\345\337\337\206\360\357\007\357\360\363\360_\017\376%\361/\005\377>\360\257\003\3772\360\257\211\377q\377\366\3765\340_\021\377\206\370\367\303\377\257\177=\374\333\341\337\r\377\n\375\313\373\037\366\037\354\377\320\3770\377y\352\352\352\352~f\376\214\345\357\t\005\335;6\243\223\006tW-\223i\214:\326\314\251y\303\351\212q\271k\224\323\325\262\217M$\223e7\023'\030\035\245@qmv\3266\213A\252\032jF\267"
+	.ascii	"Q\335\305\355fw\027\273\233'Y\265v\363\020B2\243\242\272\225"
+	.ascii	"DQ]U\3242\243\233\307\334\314\246\220bW\313#-S\304\230\375\264"
+	.ascii	"\026\227\331i\254\222\251X\361\253\241\272{\333\244\314)\027"
+	.ascii	"\330\360\271\256?f>\310pX\265\241T\266\240U\361\311>\370\307"
+	.ascii	"\256\017\303\313\363\316\236\310\302\360\371\335\013\351Y\330"
+	.ascii	"\207AW\036\332\304\310\223\026>\231\212\231\007W\235\251x"
+	.string	"\007\320qe\252\263\333\270+\202\267+b\007\355\2101LJ\371F\226\366\245\203up\016\344\272a\217H\256\200\361\3118\370\205s\016v\2419\207\002\313n#\347\350\325\320m\354\355\212\330\025qr]!\251\202\236\337\325ha\317\3648y\365\210\233J\366\314\264h\030I\237\214\271\332\342\223o\360\222ah\304\370\344\250\261#PRH\233/:\351\023\240a\345,\3430\2450\215\255c\3446\225+\344\346\3101\215\255\262r\333\246<\275\310\261\3015\030jW\246\261s\266\206\245\263u\216EDg\323\351L3=\237\330x\256?\262p\270\261\f>\356\3123\270\310\306\237pR\343\031\334b\230?lO:\244\260\245Y\322s\225\364\034\226n\357\020*\264\034\320&i\034\242 4ZeY\256\322\237p\223\345\315\262\301\302\354^\351\026\316\256\373f\333\354\334J\264\303f\326\344\fz\236\251\030\231~\353\244_8i\\"
+	.ascii	">n<\330tI\223>\201\267M\263i\274]\267\0178\346\333\222\3313\\"
+	.ascii	"jf\3305\353\266j\026n\327}[4\347\325\312\226\361v\272\227o\314"
+	.ascii	"\267&\221\025]k\366m\267l\3336\225'\0307\271\356.*\n\240\250"
+	.ascii	"\250\350\307\r\227 Y@\347\227-\375\236\245\337\312\021<\033q"
+	.ascii	"VB\314\316i\347.&N\034\016\2105e\n\237\214\366\315j3\005\271"
+	.ascii	"\205\271$y\273R\207\317\357<\245|\206@\0179@j\340\363\254\305"
+	.ascii	"\207H\333\021->y\217\206r\331\341\242\316\264\262<.\350\312\027"
+	.ascii	"\221*\266r\276\362\367\364\234\371\020bUW\345\357\341\251r\206"
+	.ascii	"\212)'\375\331&,\214\251d\001\271\020\345\365f\312\231\312N\214"
+	.ascii	"H\fV\370d)\274\305\\\216@ya\261#pL\326\370\344\371\314e\211\211"
+	.ascii	"\201\371\372\342\261s5\266\264\250@\201\302QR\241v\"c\203y\001"
+	.ascii	"]\031\031^\347(\214\265f\311\032\237,\003oE\235\3710r\327\031"
+	.ascii	"e\211\022\213O&\2233\341'\253\354\335\033\235\240'\034f\306\234"
+	.ascii	"\234\237|\006\266,\037r\266\202\236\214l\344l5I\277\266pqiq\324"
+	.ascii	"\326\360\302\212\327\026-\266\252C\265\203\317\237<R,F\202\305"
+	.ascii	"J\320\356]\227R\311V&G\374\234\344\254\204'V\306\244\007\237"
+	.ascii	"\314d#)\231\232\222\353\347J\255\214Z\020\026r\036\362!\034C"
+	.ascii	"Z\354.\256-\265WN~\314\321\265R9\242W\207\245\214\307\221s\f"
+	.ascii	"T@\375!\275\361\204)\305'g\261\021/T\276\264\031\341\"t\234\306"
+	.ascii	"\304ak\300\006\0222>W\206\341o\0378Pt\320\370d\"\033\306c:\241"
+	.ascii	"\035\341\363n\030\310\377\236\335\230+2Nl\351w_\351\371G\333"
+	.ascii	"\230\354\356\026v\326N:\001}wvG\374A\273[\003\376\237\275\373"
+	.ascii	"\002\315\356\255\345\\\272\244\314H\365\020}'\335\305\r\275v"
+	.ascii	"\022)f"
+	.string	"UDJi\233\332\2606\020\017-\026\244\221\253\325\324\271l\356\265\267\217VS& \327e\022\271.\213B}\\\026\273\327)!\344\230\261\270H1\253)\244\330rjC\037\273\330bF \351q9\205\024\263\234\022B\212\031\247\220G\253\251\rM\226G\276\330Pb\\\263_\310c\337\210\2522&\205\232\310u\331i\002\3520\250\024A\357'\214 %&\001-\340\035\006\211\027\300$!qh\244\266hR\372\001\223\214\204\303&\243\016JJM@`\020\310\203BP\b\203\030\004\362\270\360\251Jg\f\246\337\222\272\204\252D\037\221\305\003D\032\020U\026\023\020U\026\035\210*\005C\377\021\225 A\024\372\230H\bU\027.\232 P\207\300 \323P\335@\035\n}\032\024\360_\222P\005\252/\322+\200\002\001\024)R\340y\n\025%T\224@\237B\305\321\221\n\024G\351Q\034\355\210H\252\nICT)\030\204"
+	.string	"iG\350\203\361;\211L\301t\2104\301O\370\333\tUb0\350\002\035\"\001\021["
+	.string	"}KK\301\037\317\020\251\002u\311'\234"
+	.string	""
+	.string	"\242\320Gd\361\003\306\030\366\b\325\026>\025\006JTOH\"\376|h\023\222\006<\027M#\354\210\207Q\300\203L\252\320\210\030\f\n\215~\210IL\274\026j\t?\037\023:Db\321k\241*\215\340\003J\240\266\bb\240\376|\302\336\360\0050\211HT\207i\214\037Pm2A\025\272\350!\"\2418J\205*\nA\246\235\026\276\240R\f\037\023\017\021)\005\021\230\324\304\363\243\243\bBt\220\001\005\351\217\204R\360\027$\006\205LHLK>!\321(\230d\004L\362-\031\375\204C#\022\004\314\235\335\364\330\344"
+	.ascii	"B\305'\263\3416[\314*j\326\303\315\260\344\355\314\213O\226c"
+	.ascii	"\032zD\230d[\370\274\\\262G\307\204\316-.\215\347\006\2249X^"
+	.ascii	"|\264@\301)\371\\\217;"
+	.string	"\0339\214r\274\362\226\310\035\237\254qc)j\315)|\006\315\r\201\001L\215\222\237\264\265\036\\i\276\324\301Y\261\370d4 v\316\313\215*|\2321\303O\226+n\307km\215\311\364t\262[\331\200\331\025\271\2663\231M;\345\3108B\261\241X\272\222 ak\356\320\270%\273\300\316\244\340\320J\301\200a5\025k?\346\350\304\234\325z4\304\024I\362\311a6m\247\f\0347]\260\300xqS\253\025\237';c!\343\264\035\031\240.\202\265\024\217\025'n^t\215\f\201g\250\241,\207\230C###\"\222$I:A\005\204(\005\251\273n\022"
+	.ascii	"e1\r\022\250\220\031\032\031)H\212\222\372\323\001{B$\211\371"
+	.ascii	"hJ4[k\357Pr\3601\335\003i+d\256q\025\203\340\356\253h\330c\346"
+	.ascii	"\347!H\312/\1770\232\357\020\350M\376c\250\370S\274mf\217{\""
+	.ascii	"\204\"\232\276\302**\344#!J\303\t\324\200O\373?\217\226;\277"
+	.ascii	"a(\"\200\342\\\rhm\203x\266d\351\215\024\264\305\334"
+	.string	"\203\023\217b\242\366\322&&\245\202\241\376\331k~\375\212\337|v\225\371\255C::\004\350\023\300\377\002\367\353\326x\336\231K\260L\335\342\354`\265\366E\205\300\2606\254`\373\361\311$2\275\0011\345\306/|\236!\025\344\344\365\213\2405\251\031`rRW\315\305t\276$\320\264f2Xq\300\021\350E\021\211\024\340\334\027i\204z\371\364\376#\217=APA\231$\217|c\261\017\257E:g\242\321\004&\322<S\3150\217]]\225\257C\323,lD\2075\3020\326]E\347\267\215i\266\217\033/B\177\377\376\357C\247\327\360RNAP0\326\302b:\314\323\271/\206u\264\256$\b\350\177\220\376\237\342\240\006!\3329\211N\017$\307;\350<\344\331\342W\233S\023\333\315\211\026\352g\034\300\363\336\340\344*\356>F\002\316pIM\256\3458Lh\306Q\272\347\003\326Ido\233<\033e \"\""
+	.string	"\"\027\270\316N\202:]\343A\023\373\022L#\346\003\305\267!i\222pI\375J\275\207\314D\200V\244\200\214H\3626\226\375u\244t\322\325\376;G\236\027\201\344\306\002\312j\250\324\247A\262nQ\032\330\323/\221\340v{T\261S\205,\366|\t7\262\256\354=|\311|0\236\223#\374$\344\3651"
+	.string	"\331\270\321#\322\340\024Rn\n\247]\001,\311\223_\205Y\340+\203\226g\242\215\270\022\347\"\364`\232|[)\027`\364\200\370e\334<]\331f\243\314\316\3010\327\t4\006\263,\274\276\217&cg\030\240|\335l\274\026\322\300M\203\322\b\201z\343\3227z\215\2371\254"
+	.string	"\004\347$\263R\227\262zm6\353\023L\241\316\200\336\234*\377\002\200\217\365\226\342=yn\371\305\251\221\243hab\n\353\322X:\330\356\213\346\221\252\200\272/\rv\356\030\376\261I\023\242\272#\336\304\3114\227\374\t\002\373\021\334\200\377\177i \214\272\005(\253f\302\375\023U\007\025\240m\370]\025\366\001\277\360/\301\337s\\\224w\205?"
+	.string	"\355\203tX\345"
+	.ascii	"\325\335V\341\367h`f#g1\006\035Y\037n\354\330\253\352\336\332"
+	.ascii	"\3310\214\265\277\222\365\363}\240\231\001\237\237.\376\306^"
+	.ascii	"\345\200=\030t\025"
+	.text
+	.section	.gnu.lto_.symtab.dc7142a04e24de67,"e",@progbits
+	.string	"trampFrameGetSettings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"trampFrameSetFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"trampFrameSetPower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"trampFrameSetActiveState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"trampParseResponseBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dc7142a04e24de67,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
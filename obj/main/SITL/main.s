@@ -0,0 +1,285 @@
+	.file	"main.c"
+	.section	.gnu.lto_.profile.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \034\305"
+	.string	""
+	.string	"\220\020"
+	.string	"\002"
+	.string	"\320\270\301\367\013"
+	.string	"\001\225\375\205\241\t"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \036\265"
+	.string	""
+	.string	"p\022"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 v\r\002"
+	.string	"\264\002j"
+	.string	"\002"
+	.string	""
+	.string	"\006\301\377\257\207\003n\001\201\200\200\200~"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"\002\013\001"
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"\004\200\200\200\300\002g\001\n"
+	.string	"\b"
+	.ascii	")\033\336*\360\024\035:3\233\366\262\f\207y\375\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 )-\001"
+	.string	"\370\035"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002\002\006\177\0012"
+	.string	"\001\300\004\0012\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\264\004\001\224\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \"\205"
+	.string	""
+	.string	"8\026"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\003\020"
+	.ascii	"e\020\274a\001"
+	.text
+	.section	.gnu.lto_.lto.aeac3c96e1ef304b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_main.14.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \317\275\005"
+	.string	"\222\312'1PM\223\016$\351\252\301YF\313p0,LJ:5\255\204\270[`i)T\225\037{\271\321Xs\026\311d\3206u\007:\n0\320\266\021Bd\nKP5E\024\254\246\210\202\322\305"
+	.string	"!\201\255\005\205\0136X\326\005\235\353\320>,\024\256\375\003DkvE\232\220q\211p\330\217`\315m|_f\346N\343\037"
+	.string	"\nAI\246\305\212J^\030\023\217?~\300\005iH\374\023\004\211\327A2aI\311L\370\264\240)\363:\320\224q\034\215m\361\336\234\203\314\274e\027\030\335\3657\370\237\277\"\b"
+	.string	"h\310\f!"
+	.ascii	"\334\255\331\344\315\325\344\302\227\004#\243\005f"
+	.text
+	.section	.gnu.lto_run.15.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375`\023"
+	.string	"\315\006"
+	.string	"b\214-4Pm\222\016$\023\n\255\322R\223Dn3\204\026\036\372S\345\035\355ep\214\335'\311\332E\323l\2311\315\314\f\256zZ,\032E\034\303\264\371\377\033\331D\246w4 \017\347\363@\036\316\347u\254\320\323\004\\%\034Xo\241\252\254\227\261\\\304\256C\354\2774\203*T>\304\300\221E4h\214\355\035\036ZIw\243\027\222\214\f\002E\275CT\227\231\211xq\033b_j\302\304c\304\276\2020\002\021\020\311\244HA\311\214\n\301\370\233\371\372\222\001\t\200\221\321\307If><\215\355\252\303v\335\002S\235E\021S2\265Y6\231y#\225*:\325\177\363\023\374\247\r"
+	.ascii	"\024\013F\023f\201; \037\315a\304\031d-\227\274\f\001\344\200"
+	.ascii	"\333i\263e\340\306\025\212\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \323U\003"
+	.string	"\362\004\022\036\2405\351\017V\365sN\234"
+	.string	" \346\013\353\355\207U\271\257\032\001\267\333\332<l7\331{\2473\327%\254s\354k\356K\350#\362\300DP&\326\366\227\303\245R?\242\266\265,\352\251\340\363\t\201B\200aPi\330\177!\r"
+	.ascii	"`\0200\b\030\2445\210\301\f\003\324\003\200\003\300\360\271\352"
+	.ascii	"\247\270\270|v\032O\2039\006"
+	.text
+	.section	.gnu.lto_.refs.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.aeac3c96e1ef304b,"e",@progbits
+	.string	"(\265/\375`\371\003\315\034"
+	.string	"\266\265\277I\240ZUc\240\317\330\372\241=\003\232\334\207\216\"N\323\356\032{\305d\250B\240\372\277/\f\362ySu\032\361\333}\227\243\334\035\362\344\314b\276\205\361\270\240n\007z\025"
+	.string	"#\323T`\362\b\314]\221\tR\333>7\3312\005\230"
+	.string	"\244"
+	.string	"\260"
+	.ascii	"\367\306\377\347\177\0315\310\3763^i\321\357\367\017\031\370"
+	.ascii	"=x\026\177~\2228\225\004\230\266D+\2558l\213\256\202=o\032\264"
+	.ascii	"\276\350G\241j\266g\322\203\376\337-f\021\360\205\026\262\274"
+	.ascii	"D\356\3215\"\273H\276\354M\362\214\217}\373\263\256\231*[j\020"
+	.ascii	"\3112viZ\345%\320\262\002\323\267\210\001\240\237`\322\364\225"
+	.ascii	"\265\\W\326\262\355$U\234\261\357o\211\t\313\276/lG\331.\332"
+	.ascii	"\206\262\375d\233\311\366\320v\222m\031\333Nl\257\252\252\252"
+	.ascii	"\252l\367\330\367\332\253\023\001!\330\367\216\\\314 P(\r\262"
+	.ascii	"\264\035{\315-\254\352}(\020f\"m\325\327\222\021\270\342\250"
+	.ascii	"\nK\331\237\002\253\336\307\256\347\353O\204j\352C\325\327\333"
+	.ascii	"\237\351\327\307\322\026uqV\b\204\245\254\020\230\266B\340+m"
+	.ascii	"\327\363_\201We\3213\365\tc\274\322\026\005\276\025\236\260\264"
+	.ascii	"\355\201C\310\222\021\214+%\365]\350\027D\325\2271e\327\037\377"
+	.ascii	"K\374\271\332\340\017\256\352\021\215q\223\364\214B='t\275\354"
+	.ascii	"\377\003\277\036\321z\23715Z\177\243\336\316\177\022N\326\370"
+	.ascii	"\035\327x\346\b>\350\347Gp\366\377\375g\305\342\035\032XWVR\241"
+	.ascii	"\025\226\033G\037E(\250;\274J\013\232\200\274\fq\235\247z\222"
+	.ascii	"\245o\017\263\251\351>]\245\267\270L@,\214\276\374C\262RJ\t\017"
+	.ascii	"\251\353\344\373DE\005\251\312\221,\335\345*\265\242\264\020"
+	.ascii	"\023\206,\275#\022/\223\371zo\212\230\305e#\005\225\016\246%"
+	.ascii	"\245\220\251\"@\310\3228\323\367\310m}\227\214\334\245;\274C"
+	.ascii	"?\275\024\300\001e\210\364\345CCd,%Sg\260\213\357\320\2060\301"
+	.ascii	"T\001\376\243\377\tXS\214~ !Kg0I\273uT\375\357\202\305^\355\005"
+	.ascii	"h\331\327\227u\257\314\026pW\267\201\355\362\017\274\033\356"
+	.ascii	"Vz\247\206\201\316\306\343\243c\333\251\355fn\270\333\254&\202"
+	.ascii	"\206D-'DO.\247a\267\263\325r\272\036\227wj4x\300\320a\306\263"
+	.ascii	"\215\320\345\360b<96\035\210\235\016.W\263\355r\272\332m\003"
+	.ascii	"\212\034\036\233N\201\322\003\234\353\261\351f\274\\N7\003\200"
+	.ascii	"\363\321\255\\\273\351l8\333\b\323\022l\034\330\334\234\220\361"
+	.ascii	"\r\316\003\234\007-\337\340\320h864\3236\264\025\017\004\204"
+	.ascii	"\b<\334\315\3074\215V!\366\201\303\005\263V\203\273\345\224\230"
+	.ascii	"\325t\273Y\r\254\311S{\005\314\030)\373.\271L\356pE\374YX\311"
+	.ascii	"$C\007\021Y\232\2754-\363\022hEE!\001*\177t!\036\215\tG\250\201"
+	.ascii	"<c\fSF0\246D\302\031iA\332\200\002\031\262\325\006\020p6'i\335"
+	.ascii	"=\001\266c\314'{\24109\020B\016\245\273T8\315\003\242\223\253"
+	.ascii	"\001g\036$\335uQ\367p\210\373q\230-\352\251u\370m:\262\224\202"
+	.ascii	"\004,\375\347tV\017R]\265S\360\034\313\246\3239\221\243\371\350"
+	.ascii	"6\230\347\304,\016,\001H#\032\022\222\334\204b\264mm\253\272"
+	.ascii	"\032\320!\270\013\356\"\035dSK\367\006!'&*\005\340\241\373\276"
+	.ascii	"\300\203\016\257\356\2239\3049\276V\321\217\f\025"
+	.text
+	.section	.gnu.lto_.symtab.aeac3c96e1ef304b,"e",@progbits
+	.string	"run"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"main"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311"
+	.string	""
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315"
+	.string	""
+	.string	""
+	.string	"processLoopback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	""
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.aeac3c96e1ef304b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
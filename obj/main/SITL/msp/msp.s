@@ -0,0 +1,6140 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002U"
+	.string	"Z"
+	.text
+	.section	.gnu.lto_.icf.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\314\n\215\033"
+	.string	"\226\244|I\240\222N\032\003\302\353\207\333}\324\262#\r'\360\031\004\200\322R\303$\005\200\322\265\254\337b\200DT"
+	.string	"\240\303\353\360:\274\216\232V"
+	.string	"\374o\225DE@"
+	.string	"\314\023x\371\326m%\027\321\232j\343K!vk[\022\"\235\332\016l"
+	.string	"["
+	.string	"`"
+	.string	"\373\362\277\273\274\267\334\" \300"
+	.ascii	"\202\357\300\201\263\274\257\274\277}\275\277^/\301v\206\222"
+	.ascii	"\271\026"
+	.string	">\037V\r&6z\373\276\031\347\243\316\252\322\335\216\264\030lK7\007\221\033b\347\271Y^O!'\216\\\231\224\245M\007\234VI\247\247\221+I\031\317\334rR$\311\373w\357\246\323+K\322\r\213\312\216\006\221\214]%\351\f\375\221\005\357<\2770(0\300p\352Y\224\344[\315\317?\0337\356\263\317\306\213\373\\\354\231\347\342\276\363\357\254\2233\204\267\334\177\360\216\263\203q\336\006\023o\236\370\315\360\031,x\377\355\277oS\247\371UP\363N\363\016\223\340\235y\0042\0378f\230\353.\334\300\302\013,\234\300\302\007\374r\277S\323C\342L\017_\272\332\274+\255\364T\320\212\316\310\220\241=\351G\032iw\377\377\243w7z\243uF\254\210\367C\024]4\321D/\210?\274{\270v\030\342\020\363\206_h\241K\034\3015\264\254\036\r\017\3170\206\313\336\0239\265\036\305\341\007\275\007}\301\302@W"
+	.ascii	"z\n\023\256\022\216\020\224\232\\%\350\300\252\216\276853\032"
+	.ascii	"H\352s\353ZRFE\313\024^dM\216Q\345\026\\\020\264)z\272`\253\342"
+	.ascii	"%\205\034i\326s\263j\344\310\034\240\230\224\266\025PO\307+\325"
+	.ascii	"\361\272\314_,^\20495\021/\315\2647\036aLte\254\375H.\361\276"
+	.ascii	"\272\314T(\321\251\324SRQ\277\313J\235\t\024cI\317e\241\311!"
+	.ascii	"Q\340\2243- GA/\t\250\211;\355S\200\277\250\201\305\340\b\005"
+	.ascii	"\"\024"
+	.string	"\024\024$I\206\003\200\002D4\222\346\001\022\300\362\024\023\243\bd\3060D\204(*\021\221\202\202\242\024\024\322\032a!\251\030I\275T~\226\367Z\274\370{\364\227{\303\203lGh\334k\325\276wR\347p\"p\250~\b\246\226>U\036\227-\310R\324/SJB\0240K\021\214\225\200$\355\231\\\242\270\327\201\263\204\215n\f\207\265\303\b\273\313\370\026\357\332\212\331\236M\256\313\366\272\002\241\247\320\220X\375\2612\257\032\234\037\362\241\276\266\252\323\352\225\r\250\r\027F\271,\307\261]\207\246\357\251'\2052\313\235\306S\236N\371\260\024Z+\3524b\302G\237]\004\377/\324\214I{O\366S\245\023\272\206K\335\035[\227\315l[\303Ro\217\305\303\2177\256\350\224\222\237\b\302\230\352\356@d\177\204[a\325\361\231\226\274\316?\342\334\210\255\370\221\264S\201\340\016>\321R\033\376\340r\207`$\334\350T"
+	.ascii	"\265\217u\230i\273\355\374\344a\204}}\205\334)\236L\335@yF\005"
+	.ascii	"5[lr\370\233a\277\330sJ\004\315;]\304Io\036\335\353\340\216\203"
+	.ascii	"7\214\346\247\200\300iuK\227e^\321~\002\374\0066\3513\320\032"
+	.ascii	"\340se\372\266{\236sH\350^\222;\236P\371B\270\205\353\335\335"
+	.ascii	"]\007\027?\016\340\360\246h\252\2123xG\361\377.}\372\376\353"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\333\036\265\032"
+	.string	"\026P($pEI:\374\377\377\377\037\202\266-\377\247\002\370\317xD\376\240\200\013Q@\037P\240\347Kbm#\233\244\024#"
+	.string	"\030"
+	.string	"\030"
+	.string	"C\322f\306b1\213u\364@\212,\215\345\365\37246\247j\221$'n*\314_\f\223\325C\001\007\002\004\005S\304\335\335\350\001\360A\360\357\253\256\376\377\257\372\2731\365{\004\210\002\357\275\337\016\320\327{\333~\377\333{\357\275\325\357\275\367\336\233H\003t\002\356RLHD\324\020\345\303\321/\207\323P2,lV\024\345(_\nHs\302\246\224\322\2050S\205\034\n\201t\250\021\346I\322\236\001\221\005F)\347Tm<\022 qh\024J\302 \205a\204\020B\020C\206\020B\210\210\214\314\210\310h\232\264\001\242\240\236\312\370\316\252%3\t"
+	.string	"h\006\352\032g\2275\021\375(l\242\232>\214\2571\323\222\201\240\037(\200\363\020\016\023\251<~"
+	.string	"\215\034\364i;]'\266=\242O;\217\371\026\210\310AQ\275my\017*nR\261TS\315]?-0\fO\343\327\006\241\347ax\303\215\013|\"\302=;\227\025~\360\275\330\004\265-\267\2201gC\036$\324\032\017\037C\245\246s\336Y0oN\326\347\373&\371\242\344\233\276\212\361\320*\250\344\206G\352\247N,\244B\220\356\r\225K\210&\242\202\247&\001\215\037\361\200\367\322\t\265:\324U\200\342\337\003\322M2\321\n\225\231\001\255\375\371\016{\246"
+	.string	"+\001`f}+\267~\260+\265[\3516\224\020z8M\350_"
+	.string	"m$\355\346\314\376$)\250\235\013\233e\303\371h\274:\241z\320\356\023\005\220\265\n|\3363{\321+\3776\354\t\370\367\334\250Ej\3746\030\240\314\215\372\002@\347\3264\271\006>\303\222.]\334\356\300#\370z\312`Rx\260\274\320\334\250\031IE\3737_do\2460\354\032\270\320QX\265\021\027\364\252\001y\\\312\340\260\004\356"
+	.ascii	"j\022H\365\2276\304v\020\363n\002\362\303\022\026\206|mJV\367"
+	.ascii	"\372\326\333\354\356\337\233iw!\307\366\210;Q\315\245\345s\300"
+	.ascii	"\222b\266=\227$%\032_o&v\315|&\305\344\231\347\r\035i\b\343\320"
+	.ascii	"\223\230q\340\376=\234\2428*Il*\320\326\221!`\213K876u\241\376"
+	.ascii	"\330\310\246\250\255\030!\233\3002d\022\342yq\251g\361(-\340"
+	.ascii	"\023\202\227\274\ri\221\352P\013=,\001\376\355\"y\035\236\346"
+	.ascii	"\344Y\277\377\025\265\354\316\327\346\351\304pO\321\205\253\303"
+	.ascii	"%!\033\325\211\342\307\207>\305\017V\210N\030\002\347\310\020"
+	.ascii	"\204<\001\214F\356\375\203?\005\301\204Hc\245u\310\353\3135c"
+	.ascii	"\335js\016\272.\\\243\267G\001\305\f?_A\355\242\r\257\352\304"
+	.ascii	"\256j\244\311\257\037Q\317\213\177\205\372\001\324\247\350\207"
+	.ascii	"\333$\214 B\324\f\210F\311\214\034\246\223\n\262\277x\212L\002"
+	.ascii	"\253-\2164h\366\347A\273\305\0236)\276W\304\276\204\223!\242"
+	.ascii	"\"\342\344\206s\211\231s\271\211\037\214<1\246\250\321\353\036"
+	.ascii	"\303\337\373\326\024M\236H\013\302\367\343\032\327\315\370v\345"
+	.ascii	"d\244\313r\273\241\227\t\016'\304\n\230\277S\211\232\037"
+	.text
+	.section	.gnu.lto_.inline.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\3576\035]"
+	.ascii	"\312T`\022E`\232N:\375\340\266\364\330\266\351\377\343u\246/"
+	.ascii	"B\347\204\"\027wd\366\335\036,\325\002\340B\367\312\f:\215\232"
+	.ascii	"I\335\337\226\264\177\350\210\027\331h\247\\\270\300f\304\240"
+	.ascii	"~\005F\311\361Pm\337\322M\023\"e\n\025\001\016\001\032\001vX"
+	.ascii	"\004\031\234e\357\275\312\006\303v\367'\364\266\275\367&{\257"
+	.ascii	"\017\255O\307\231\325w\037\241\201`\344\336\030\237\246H=\345"
+	.ascii	"\304RV\340*\214.Sd\tT\227\r\177&\352\203\t\217f\307A\360\263"
+	.ascii	"]\235\\\034\027\2707\2673&##&\314\027>:9.W\033\021\242\303\206"
+	.ascii	"\f\025&@x\320\340\377\341\245)Cf\343\340\004Ge\240hzUD~\376\016"
+	.ascii	"H$2\237\223\375\344zv\031\225\032\356\311\205g\274*u\357\r\360"
+	.ascii	"\2363\235iA\351\025c\240U\205\200^\024|\b =~\035\277\320\237"
+	.ascii	"\215<\037r&\265\332\020*;z~\032(\025\023\027+\035jt\324\263I"
+	.ascii	"\230\017\347\371\351\243\377\215<\375\277\210.\321\261\247 w"
+	.ascii	"\352\214\276*sFd\302\323\027I\245?\007\030\002\031\3762\372\r"
+	.ascii	"\335\331V\220\227sN\354\302Z$\305o>\377\\D\237\f\377\032\315"
+	.ascii	"\325\324\327\205\201\215\256B8\2057\264\362\337\303\177\351\336"
+	.ascii	"\313\364\367\317\313\276\367^\364\027z\0072\001M~\226\034\330"
+	.ascii	"\320|Q\263\237\324caG\304\034\373cS\317(\r\317\240\246i\232\262"
+	.ascii	",\317\371\366M\257z\327\373\257=h\341\233X\330\201d_\225\271"
+	.ascii	"\351\003\372\372U\211\206\221](\240e\177\001\241\312+\221\324"
+	.ascii	"AJ\264\260\260\360M\317\177fs\037\337\236\236\027fv\216\274'"
+	.ascii	"Q\204\005?g\031\335T\333k\262\337)\244i_\275?\247\347\266m\371"
+	.ascii	"\247\257\252\252\272\246\315\314w]Y\276\374V\275\350\323\363"
+	.ascii	"\213\244~\236>U6\226\240\223:\305\253W\221z\355\256\031w<{\266"
+	.ascii	"}{\324\317\333<#\236\223MG\005\311U\214\367}\247H-\345y\325\024"
+	.ascii	"tU\331\204YM\260$8{\324[j\203~\352\333$j\307F\367D<#\025\337"
+	.ascii	"NN![@O\237t\201#\306x\025\211r\375\260\272\303\360U\313i\020"
+	.ascii	"\312\212\263Ne\246\320\226\336\n\221\322\203\033\236\3219dVY"
+	.ascii	"Co(S\330\320\251W\223\350\225\017\2547\001_\327{/\262\311\002"
+	.ascii	"\377\252\252\251zN\323\247i\232233\2577`\207e\"\036,\263HY\303"
+	.ascii	"\263\262\241\256\314\2659\276\215\356\250jUa\361\254R\273aU\301"
+	.ascii	"Yx\213l60\252$\305\363\330 [YPR\3239\357`\t\201QY\335ukl0\215"
+	.ascii	"HUE\347\312\310\354\023;\326\036w\22241]\301\273:\017G\007,O"
+	.ascii	"\2126\0178\317@\275\364\005)C\353\b0\301\347_\345\365\236=\247"
+	.ascii	"\352e\317W\317\314g\276g\226}\313\353\272\262l\3332s\022\315"
+	.ascii	"\242F.\215\230\324k\200Z\234\202\220(\327\263K\312\361\f"
+	.string	"\243\337\314\346q\247iM\350\351\262\235|\235\251;\262gE45:N \2438)\327\263\353\310\201\264{\333B\004yvQ-\315\206J\264\354^A\nc\177[\352\0048\t\301\242\212>\002\317\300\t\035\311Q\325\206\277\022\372\307\026\245\227\206\005\375_s5Os4\017\374\231\2339\340\377\356\007\246oo\256K\334\026-i\"@|\340\240\001\003\005\tC\f\2104Z\314-,\377\177\"\177\271\354\264_\220\r\fc4\216\243W\354t\0351^\311D\375\356\275=O\"\225\215>\211\347HG+\023E!\212\362\fV\374\266mA\024\341\267E\322\267|\346\263\357\224\257\021\312'\346l\362Sd\333\265\341\001I\237\370\246\314\202\220I\3227\373f_\240kmyM|6\275g\215\320\2656\274\300V6\025\300)R\004\336\355\273]v\026++}>J\350\231_\340\327\206\367\240\361\277\2629\345%\263\241\262s"
+	.string	"\316]\016a\026uo\314i\fk]xq\002>/j\362\327w\222\237\324\177F\177\321\332\222{\221\236/z&\262\271\321\270\265<\260\263\335\305\035&uZ\013)\235\242Si\326\334"
+	.string	"\234\005\237\200\317U/\366j"
+	.string	"\251\227\027\253j\320\230a\375\350\371m\364\333\335\023\215\304\215N\213\2133\363\273U\305\355\254\264\006\32762\247\304\215\202\247\370\325-\354c\307\343c\247\324K\b\277\336R\024o\310Y\226\203\243\340Te\333\203\201\2502\f\317\b\t\tI\222\202d8r\n\020\222%i\026d\322\355\001\022"
+	.string	"\322@\210fi\030D\206\020b\b!\"\"\"\"\"\"\201\210H\222&\035\262?hb7{\216s\204\331~\033\267\261\211\241\2316\375\316\360\335\366\370t\322\004\233\235\317|,"
+	.string	"r\347V\001\367\303MH^?\271\2503?U\376\215\247(\233\3424\367\016-\231\222\032\227\364.\302\234\301\266\312/\3163\211\004~\232"
+	.string	"b\206\243\2270\267\3016\234\035\213,\0275\214p\2006;m\352\nx\205e\367\241\327\230YC\350"
+	.string	",\346\023\325\306\323\263\035\336w\352[\304\372\363\210\357\372Cp\355\367\356A!\246\t\n.7j \210\367Hv\270s\025\351\221W\246\245Y-NM\374jk\022"
+	.string	"M\0339\224\247\247\305=.\250\342\tPC]\363OF\347\255x7\325\265&\3472\263O\200\310W\253L]9\254\020\004\322\274Os\255\216\242\037xo\330\273\337/\024c*\200|H\347*\222\355D[y\342$\n\017\325\226\017\306c"
+	.string	"m+\332_\017\305\237v\272WQ\225i\255G\022\217x[\263=\344*\315\214\034\221\324\021\254\006\020/\344\305I\f\233\317\202\007y\002K\325&mE]\217`K\020j\215\362]I\271o.\212Nz\254\252\313\312B\0219t\206a \031H\n\210\240\214\332\372\230\033T\032\230\004\203\002\305\230\361G\026\360\232\004\032Z?Rt_\t\334\235\370S\206\177\270\240\256\005\2278\231\323\236\002\302\333\370!\013"
+	.string	"\245\0024\257\017\334`@\016\221\373\342\254\312\206I\223\013Z\374\004\013P\217\263\230\252' \273\257\324\361\325\n\370\257D\336E#\375i:\374H~\371\026\312q\305\026\335\fY\221c\272.\213$\243s\246E\277\272\036R\223(C\003\2108\254,\212tyQ\274{\375\250\0214\003\270Zdj\016\227ws\362D\262\237\231\313_\375a\001_\363\030\300\335\3364%\246>\227"
+	.string	"\342\212\013{\235e\352/]\361g\352z\310\376]\226i\342G\244Y*\234K\\B3\201\\\356\244\317\274'EX\313\r\022r\f\253GDx\022\n\212\241+\260\226\226AF,;Q\344K3r\337\3302\022\200\020\"\021\215e\267\224\250\20026\226E\227\216\342\371\202U\331\f\022\303\231\n\0378\326\305%\027\f\225\006\376aAa\340;l\006\345\0211,a\007\342\360y"
+	.ascii	"\204\b\347z\242\f\035\203\314\220Q{l\331i\262\324\324!F\006L"
+	.ascii	"NG\274\300!c:\3344\035\366w\302,\232\275d)\207\306\200\026\224"
+	.ascii	"(a{p\005\353b\205\217\346\211e&\tl \035\326\030\224\274\316\353"
+	.ascii	"\311\303\330\035\326\324a\3678\005-\237\247\204^\267V\340\177"
+	.ascii	"\336w\023]h'Q\352\237\006\255\3701\226k\f\220bsZ608\032\270\354"
+	.ascii	"y9\374\211C9\325L\317\214@\027\345\201\366\322\207\001\317\367"
+	.ascii	"\303\3363^\377\243(\030\323\357\304\320\030b\337\002\201Amz"
+	.string	"\367\002{p;\004\345\203\320l\n\311\350~\330/d\022Zr\3446\032\344m\222\t\326\351\350\260\335\2449C\212\376\241\001\004\217\017\004Fy\200 \321 \203k\274Op"
+	.ascii	"\361(\037\216\"\330\332\3035\3026&]\203\251!\fS\r\331\362%h\231"
+	.ascii	"\200n\223t\240t\252\233 0O@\177\3612\031Pm)\305\300\362\334\233"
+	.ascii	"\3311\314/\255\017\376\007|\331\003\370\334Tz\263\216\2147\213"
+	.ascii	"\221\324Dc\261U\234K|\374s1\372\002p)\033\326\204g/\235\340\241"
+	.string	"\233s&8t\312\210\340\3444\232}\251\273\214[\016\372\242s2*4\313\t\257'T\341i\323\343\315\212\205c\323\233o\226\320\024u\260f\212r\240I\241\375\022\267\322\022%\001[\260\336\360\334\355\341\002\306\337\033g\025E\253\323SX?\240\231P\277T\356q\302\327\302<C\350\025a\322\\=\006\313\336F\034$\026\220\372\322\260J\211\222\301X\220E\251\342D\256Z?v\317\016\341U\202\343\002$j\2052\213\2261\217|\262\250\311\0055$%\232\215jT\021\210-\345x\2109F\022bz9#\b4\245\273\n%\340`\001hX< \205\204\201\247\021\220\020\222\030}\344C9\260\304?_\330\220\247\2079\027\r\213O\t\247\3217\031L\001{\t3\r\330\034\247iL\231\027>\330MW\004;33\3713\352r\334S\316\2031[\023\360V\256UX9\2644\366Y6\355\270\241\343< <\241\322\355"
+	.string	"\225vW\307K\242\211\216_\215\310\007+|%\240\201\367\201\347\0372"
+	.string	"M}\272BHtC\315U:>Xi@ahZZ\032,\375\301\r\376\345x\212\347\252\334<M\273\023m\330\361\023+X\225\367\344\244\005\324\304\267b\255$0XVB\023A\221\246\213\204\255\345\302\035s)\210\250\265\242\"\037K"
+	.string	"`m\326q\306\267\213\311O\225n\303\n\023\371\227\024\373\230\204\302p\200BH\212\251W\273\213\300\023\017\212\006r\373nFuP@#\234Q\205\346\247\3038\307\362\351`\026\257\311M\001\032\252t\373L,\215\253\252o\321\312\331\261k|\254\237\244\037X\307\372<\367\025\202\031U(Y\203"
+	.ascii	"U\204\335x\t~\375\034\020\367q\273\363\266\353\3365\336M\n\263"
+	.ascii	"_\216Fra\271\360B\036\321\360\215\202\227\231\371}\313\265\300"
+	.ascii	"J\003 _<:U\213I\030m\035%\n\211\002\201\030\370\253\247` ]\226"
+	.ascii	"\361\222\276\002b\215\304\027\255\244d\025\347B\213\317\253\361"
+	.ascii	"rX4:!\035\266qZ\272\245I\330\325$\301\315ZP;{\020(\357\357\267"
+	.ascii	"\f"
+	.string	"\344\275;n\032\210\347rYpD{\220}\242*\nS\256=\003(\270\232\2008\016p\030\221\036@Mp\"\2622P\206\352\r\017@@\370\\\326\346\230C\022\347\306\032\361\371\351\003\036\233@\334\211\204i\213\037\232\227\006\251<\265\366\274\306N\322/_\311\265\202\2463y\347\331\006\347\252\353\3576\304*\271U\017gS\363\205\021:\262\224\240\212\360Dh\254s\254QF`\274\005;2\355\366\331\257\233\271X\241D\206h@|r)k\217G\275\bq\033\257\200\306\352 #\260\242\t\207\271>\214\363\335\353\273\240\"\244\361\327\004\224\036\211\314\331K\\S\345\225F\007 \204\203\256W\347\231\n\320\327\252h\270\211j;S*\224\255#\207\312\001-j\"$\340;\305\210\232\306%\352`\235T\366 G6\177DH\303\317IU\241\340\243$e}[\310\345\027\034\210[\277\266oT\357\203\025\300\266/\360T\305\301"
+	.ascii	"+\2264Q\005I\364\212fC\260\305\200\256s\355\343\312\021\262y"
+	.ascii	"\013\367h\211\b."
+	.text
+	.section	.gnu.lto_.jmpfuncs.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\345U\345G"
+	.string	"v\363\217>\260\336$\351\202\220\366dz\373\270N\255\337\215\207\354\341\033\233\274\277\214\316\007\363\365\265[\223\321\021\256\337\363\347\t\311\312B\347\025\2352\346\030"
+	.string	"bu|\207\001nIM\366\266\266\033!;\311y"
+	.string	"{"
+	.string	"\202"
+	.string	"\255$R:\324A\002\235\020\272\005\243\266H\"\232\300\366\255\236\237|\031\311\304\206_]\366\336m\250^L^\332\201\274]\3272\261\00152\347\032\226a\365\336[sO\251\302d2\231\356)q\001\357\275w\326\271\3262\221\r\244\354\275\331c\257uh\315\344\306\336=e\317\370\357\227\274\222\233\033E>\212\304\253\002\333PoC\2678\226\375A\211%\201\025\302v\252:\315v\003\226Z.\036=.\037Yw\337g\304\373\263\t\023n\357\314\265ve\371\232\005\345Hl\257\361\240\355\355\2772~\205 ;\202\304\253\367\036\205\357\340sx\352Z\335(\bO<Q\301\024\022\237\361\235\274\3128\233z'\373N\342\325\277\t\\Xd8\030\016l;\225\021\333L\246f2}\375H\304>`\300\345\222\310\340)W\220~\244\327\220\213\b>c\212\345\357\002<fZu\233{J\237P\316\006"
+	.string	"@\276\345\254\252\026\2051\207eFL\363\305\346)\352\236r5\343\257\031G\243}2KDt?B\004\035\035+\343|\031\013\306\202\216D,{\210\255Y\026\211\204\203\363\370s)\0373\376\323\242\214)\346R\266,\301\370\336+r,0sr\022\034\346\332\201\305\301I\201\255\332\357}\357\344Y\306[@\312x'\032\333\373\006\272\\\312\212\f\317\033\326!\234.%\205\346R\342?\357Z\326=\345\025\275P!\003\005\252mGl!PP\200\242"
+	.string	"E\227K\206@\226\255\b\240\022\350\330\207hA\300\030_\334\002Y\272/\031\371\227\214\304{\255@v\342\tt1Z\316a\365\346\003\311Y\265\260\r\302\201\320\001\355\344\277yh;\340\013\231\342@r\355\tL\222\210\273\206.1\205p\t?\3230{\357&cR\244\f\330\344Q\333bb\205\217\341\236\236\362\242a\305\270\264s\363\233\313\306\215+Gu\317\344\024k\356<\203\n\250\222\374\212\221\214$I\222e\016\342\t\020\004\203\211\"H\241:;\022@\3208\204a9\216\203(\206\302 \310\030c\210!\304 \244\214!3B2\264Is"
+	.string	"\241DS\250Tp\032\206\320\3438L\366\230\376\312r\217\031G\032\336\251\335^vL\333ON\007:\242\236"
+	.string	"^hi\3518\234\315\006\177\337\313\234m\311B\305\353"
+	.string	"`K\235\273'\\\202\333_\320\204\225\026\255\336\336"
+	.string	""
+	.string	"\302n\340\333\2747\273\224\257\240\002\327\2206zc\360\003\022\2527\275\347\220\371h\t*+j\341\276-\250 +Q\247+\351\205\207\221\211Z\245\2429C\343\371vh\323B\bl\207"
+	.ascii	"\246s\342\243g;\315\037BEN\357\306\255\3468\035\311 \034\232"
+	.ascii	"/\224\322\270\337\263\330\235\033\204\275\225\253\266O\362\253"
+	.ascii	"\004\226\265\204\210=\373\177\322Pi2\315x\223\223)Z\314\360\034"
+	.ascii	"\013\312\323\030\326\363\031\316V\361\022\302\242\020\254\334"
+	.ascii	"\036\214\261\b\022\203\233\356\022{E\343\br\216\366\346\341\260"
+	.ascii	"\347\334%\021\025\305\207sI \370E\t\322i0\327A\213\332\226?\226"
+	.ascii	"\355l\207\013\3700\203\366\243\377&\304\006\243u\025x\2176\037"
+	.ascii	"\244\344\277\236D\204\223W\f\214\230\253\203\322\331\202\364"
+	.ascii	"\327uq\252q\262k1\305\266\215>z\267)\016\321\251\364\367i\316"
+	.ascii	" \033\375\303\016\273n\347:G\026x\f=\262\030\322F\231.|\320o"
+	.ascii	"\264^\362=\311\350\252\366\2751\367\303\374\024\017&L\236(5\217"
+	.ascii	"2y3n\376q\030\234\364(\347\231d\252Q\253d\345\032VD\375\213\373"
+	.ascii	"=\205\245\246\307 1\f\244\323\035fe\345cG\272zA\224W\241\033"
+	.ascii	"\355\261\305[\322\r\253E\320\205h\345\361\340\213\315\256\344"
+	.ascii	"\026\t'\250z\307>\243\266\372\2460\034&0!\212\332\020\316\360"
+	.ascii	"\211\213\277\240af\242:\006gg!\325\336\242X\257g\267\360\225"
+	.ascii	"\315o\001\250\tD\343\253\372q1D\263S\004\364\024\022Ew\236*("
+	.ascii	"2\222\276\246\365?|"
+	.string	"U^\301\310y\230\2612A\371\205Ys/\307Fq\377\272\271\346\363\017\327\023\312<mA\017J\3645\203;\t\001\314\357\253\371\007p\177)\274.;\376\034C\223\336\020z51\"3=}NRF\0071\244\333\220\271?\316\250\303\330\322\031Wh\311\033\234\fJ!7\020f\201w6\f&}\364\272\302\317\007A\004\026\340\205a\201\006\001V\220\b<\223\252\331\240\236\231\263\006\013\240\023\212-\207-&T>$\341\255\0217\271\237L\2558\225\360~g-\215( V\266\200'W\230\376S%\217~\027L\214\240\311\360\013 X\352\342\355\036\340u/F:\205\215|\346\377\\)\\\256{:\376.H9Y\221\020\333\345\3337C\314;c\375\002f\236\346S\317\331\341\272\b\302\304*\273\005\016\246\004\322\216\204<2\300@>\305%\026,\251$lKbA\016\337\006\222\301q\244t\363\311TJq\020?\306"
+	.ascii	"\331\303\200>\364oah\027\037\344\242;\341\265D\021\n]IkI0\031"
+	.ascii	"\235\221\230\222\341\227\245?\216\331P\302\247\247<\375\t\350"
+	.ascii	" \007\030M\221M\200\362b:\276=\326\326\261 u\376pd\003\\\352"
+	.ascii	"X\302{\231\207\353?\263\3513"
+	.string	"\216\254\256\261\323\201i\022\240g\\;\303\304\270\317\223\342=\341\343\354\262\234\321\236\230S\374\333\261\007V\372\373E\221r\254.\326(\342\246\226\370\201\363\236\347\364}\337\t\210\254J@U\231\017\026\020\234\005\207\223\004fb\360\232\336.\326\030\\\t\3033J&\222\020Mh\350\300\007\347\351\026\261\362\302\\\025\030\210a1\017\270\331,O\214\355\251\305k\343\177WV8\330:\205\026\031z\202\024\377O\f\241\007\366\201\245\\\247\262\207\200=Y\313\210\f\243\354sN\273\030\320\311g\353\201\253\267e~\227c\334\305D\231\215k\005j\247\310\232\354\353\322\2219\355\260\320u\030\340\2771\204\037Ft\372\005\021\305l\264^9D\036\205R~\203\300)\006\301\2005#\315\177\265\347\365^\342t\345(C\033+*\337\357\330\bEd*\277G\351UYN+!\327\300\322\377\362$\213\216\360(\270\007\373\222\231QA\006\237"
+	.string	"\244\007\036\034\341\302)\037\030\240\247\332\005Y\350:\031x"
+	.ascii	"\320\177P\246\215m\200\364]/\220\253\267\221<\320\353\340\362"
+	.ascii	"\372\256\302\327\333\t\225\252OH\354\264y\177(\251\234\301\365"
+	.ascii	"1\023.\260\013\215\2613\216U\004Ti\023Q\257\"\250\n\307g\252"
+	.ascii	"\ft\204\201\027)\335=d\023r\255O\"\246\203\027\362\351-n(\222"
+	.ascii	"@\016\024\271\\k\234\366=g\2002\325\030\270\344j\237=\207V\262"
+	.ascii	"\360\367\212\r\021R\347\177:\026\365\276+\222c\263\267\210+)"
+	.ascii	"\374\317\f\273! l\033\230\361\212-\336\201f\216\244\304\216-"
+	.ascii	"\301\304\274\356\343\374\361\210\024UE\027\177\r\r\203\360=\211"
+	.ascii	"\343?\254\200\330*\261\326\252Y}\024\n\355\354\017F\201\215\274"
+	.ascii	"\0251\361\\\3770U\0350z\016\322\310\314c7\235bb\317g;K#\303\376"
+	.ascii	"I$w|$\321D\2075*\"Q\211u\321\241\202\200\321\373\022t\320\322"
+	.ascii	"\330\001{\204$\322\262O\305\264\224{\302!xB\331\210i\007\251"
+	.ascii	"\362-*p\003\301\322*"
+	.string	"\343]\373o\322>p\033\272\314%\225\013af\355K\f\321@\327r\365P"
+	.string	"\215\225\035\350\243\320\305\312.\312\313\036\310\b;\f/(]{_\034\307<\317\224:%\350\n\317WuC\362\211\213hS\021\332\\\005\240\250\fh\260^\3505\331U\tn\215I\242\227w\324\221\020 \374\004\377\240M\302\246zF\204\354\267\306\013\342\370"
+	.string	"\343\0136\264<\270\230\017p\366\306lb\006\207G\326Yf\032s\013\245:\b\312\023!\212\030\261{\365\216l\304\005$\363\352\222\362\356\224\205\226\376b\220\240\001*\037\241\t\007O\314\230?\025%\316\327+!K\337\002\001\273\300\355\355+\324\035\222\254\203\027P\216\260\037\236\224\303^E\276\344\200\rQM\300d\225Z\267%\350K\0270\335f"
+	.ascii	"c\340\317f\313\026\f]\032\264v\026\225\2128&\337\302\r\270\023"
+	.ascii	"\276\335\322\032w@18u\233;\345~\314\233\034\325U\324\205\021"
+	.ascii	"4C\273\230'\223\300\031\245'8\374\214r\212\327*\021\351\016\032"
+	.ascii	"\307e\323\363$\327\354\310\333\020\310\220\211S\334o\250\200"
+	.ascii	"p\0164\016t\246\226\373P\302\bSp\002"
+	.text
+	.section	.gnu.lto_.pureconst.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375 Sm\002"
+	.string	"2E\022\035\2207\351\376\347\270q\017\357\216\300\307_\357+*f\017.L\202\206\372vu\267\356\333vw\261R\334\304\207\370\016\237a,\214\204;\270\2021p\001\257i\025\235\320\352\031\235\221y-W\271\311\211\334\317\3434>k\314L\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\341\001m\n"
+	.string	"\"N-2@o\222\016\004F\3255\f\004s\024Eg\327\235\215\013q\037\254\241\364\350\347e\270\177\260\210\025\326\211\364\3178^\231\230pF\023,\321%\263m\2232\005o\034\252\003\233\323P%\330\027\254\020\336b\201\025\\/Spe\2665\231:\251\222\322L\2067\311=(\245&.\225J\211#\bq\255\323\207\265\t\265\334\350\016\344\362<!\211dRB\"\032\215T$\004\244\0023\374\005w5\005\321G'=:Z\316O\216\r\rj\206:\231\321\t\352\364\224\363:?\345\237\332i\235\f\326\234\r0\340\365"
+	.ascii	"\345\335\354[\303P\375y\274\347\030\345\337!\257\255\231\340"
+	.ascii	"\313\022S\250\321\\\t\225Ha5\273\001\200\002\251:\362\021 \242"
+	.ascii	"\232\264 \365X\326\004\250Z\007\250\001\363s\377\344\021&(\353"
+	.ascii	"1KsTP\367\335\002\362\305\252c\2152e\230\212\365~\366\314\274"
+	.ascii	"\215|JQU\265\322-\211\3126\314Xh\024\356\252s\365\t\325/\304"
+	.ascii	"^\312\217\2627\013\003\203B%\0371\212c\327\303I\374T\345'\022"
+	.ascii	"\001W\200?\205q\r'\020\244u\232\335u@\3148\027\n\314+w\353\347"
+	.ascii	"l\241\021%\323\215\032\036D\222\344\271\324\r\263\262\031\235"
+	.ascii	"\024"
+	.text
+	.section	.gnu.lto_.lto.47c9d3fc4bc969c4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspDescriptorAlloc.168.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"M\007"
+	.string	"\002\21613`m\322\001@\037#D*\267\006\365\217!*\020l\3727(M\371|\331e\326\242\013\002\"\027\3625X"
+	.string	""
+	.string	"\202\t\245\266\363\265\265\226o\324A\366\2262\245\326d\252kz\3255\275\006\006\205\351i\254\353e.\246\252\005\3539P\224\365,q\337V?VLG=N\0059L9\3705\365\020\027\236\177<\232\304\327\360\203Eyx\347[$\335]\003*:9\262#'\025\303~[\375\330\231\316L\337\rX\230 \234\354N\214V\266\304\215l\330\336\330\026\237\343\035\033c-fd\002 \211\210\020\225\335}\230_\244\273v\002\351NA\307\236\230\177\217\267P\b\005f\234'@\302\356:aFq\353m\033\330.\260-\022\f"
+	.ascii	"%\013\335\264\030\t\023\f\002\246\2248\251\270\263\250\365\\"
+	.ascii	"\310\217\303\\\026\214\f\327\212I\230d"
+	.text
+	.section	.gnu.lto_mspRebootFn.174.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\254\001E\017"
+	.string	"\346\232bF\360\224\223\016ht\307u\317\266.\271"
+	.string	"\033y\315\002\3749N\372#{9d_\004\362D\305C\310\257\0317k\324\242\347\303\207\"\242\267\027\340\233\310\272\006\317/\233\020\026i\261\363\371\303\301\251\243L\310\336d\313\224\002P"
+	.string	"L"
+	.string	"N"
+	.string	"\233\221\300q!\207gw\271h\343LE\237Z&\261\250\"\177\323\301\t\2422\215>\027\310\\\013\0013\363L\223\271l\260\002M1\307\216\272\001\016.\322\020\225)\346\261D\232[\211\036&JL\026\242f(\273k\005M07\200\333\326`\373c_H\023(\350Ao\036\326\310\213\024Gv8\322Xc?\333\261\021\341x\262U\375\371\025!O\021\006\256\335\r=G\226%y\2400\261}\265\177\363\030\242\313\250\360\001\273\247\034:vC\005>\240]:\3746/\265\237\314K\213\354\326\303\021\001?i\301\032)\022M\271"
+	.ascii	"\022U\376\215[\301\315\360#\305\202\320\361k\270\245\235\300"
+	.ascii	"\274\324Rv\307\307\315\013\3739\266[\tX\320|\330\035\235F\301"
+	.ascii	"EP\240\244I\354\3178N\347\237\260\204O\017^\372\337\274|\304"
+	.ascii	"\210t\230y\321\036K\265\003.^\227\002A\005\344\261|%^\371\264"
+	.ascii	"|!.\002H%\304\255x\037\367\331\334\265\260x\234K\327y\234I\270"
+	.ascii	"\217'\324\245\212\027\317\353%\222\374\324\2152c\2155,\213\247"
+	.ascii	"\377\022\203+%-@}\007\323\006=\330\301*\331\270\256PX(\300\n"
+	.ascii	"\006\3534\002) \220\202)\321y\377b\204\321\270N\310\006\300\317"
+	.ascii	"\223\311\334\026e\271\236\245\345\303\341\266\324q3\354\307\244"
+	.ascii	"\355<e\235D\223\216\220.\220\304\255\2377\233\350\320\253m\242"
+	.ascii	"\216e\353\305l\230\003\r\266\353\367\0134\217e\264\233a\365<"
+	.ascii	"\031\020\231\360\320\005\206\3743\336\355\343X\347\0322"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.175.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\213\005%#"
+	.string	"\352@\034\016H\200\234Q:_\232V\3606yj\340&!\226\350\354\365\233\252\371/\001[\301\227\"\025\212\262\t5\033\352\306$n\320\037\001x\347\330\021\036\302w#\\\327\002\315\323\350\b0&\202{M\276F|\002\364\244\021B6\3312\311\320"
+	.string	"\300"
+	.string	"\317"
+	.string	"\r\036\364\316\004\n\275C\316&Y>\310&(\211\262\001}.0+k\210\003\324x$\275'\211B}Uh\023\260\037d\367\032\023\334\362\001\364\326V\276\231\177\344]\275\027Q\374\347\336+3T\3565.`\003\350-\033/d\336\242\0172o\271\307,v#\217{fYQ-qs\357\275\325\035\357\235\226\316\320\323\264e\355\036\377<\232\005\207\276\323h<-\035L\271\251\241SF5fF\317\210p\264 \036\025S%\243\264\335{\017v\"\"U\304>\217\243\212He\n\371\300\222\225\016\247\252y)\342m\n\236\341T\227\264!\220\330\2654\"\253\302\346b\252h\224B,\202\004\017\366\026\016\177\335\347\321\275\227;8lq\32693_a\346\r\314\026)\017\202TV"
+	.string	"Y\340D8\216i\225OfW\035P3\203\b\321\017v\355\201\321\346\370\253\276\363(#\243R+\026'\231\257\"\276\316"
+	.string	"\273\214\231q\237\222\204\336\013\204\300\217r)9\376\217[.\241\324\017\336\362\225\314\333W\273&\354MQ\252\223\314\306_W,\346\327d2\231\344z\305\374\342Od\033\252=\3119\350J\316@gr\376\361\271\223s\317\241\234y\322\346\235\264Y'm\246\241\315\351\254y\2066\243g\363i\233M\263\331\332\346\3226w\331\374\"\0010\220H\311{Y$\343\334\243\265\"\344I~%?\223\337\311\017\345\377\372\2227\371\223\2031\r\n\017\fN\240l>\237\373C\323\303BD\315\334\363\242\320\017\316*\201\030j\3223\026\023\255C\265\345\244\230\363\353$\0175s\005\013\375 Zkai\n\020s\250I+\026\277\b\233\263\"\215X\241\335U$\210\3710?\027\031\373C\231\007\302%\245\262\260<\224\331SkB\274\276\314"
+	.string	"\273\214\317Z\253\375\205j\216T'y@3_\300\320\017\236]\270|V\261\252\212\257'h\2752\353ud0\253P\f\033\017{\200\031G_\3131\207T\303\263\013\337\013\213\3311Z\252\026\376\026\026C\373\032\314[\356\340\025F\031ro\\\004X\230Y\314\216i\271\327w+[%\334"
+	.ascii	"\366\034\006\320\314\035<\364\203\266\036\354\207\0216\004\322"
+	.ascii	"z\241ev\360\"\340#_\313\341?A\0219\264\267\362\262\006\273\022"
+	.ascii	"\270%\0226\307\303\361vV\327\244\323U\340\355pK\271\234\216\304"
+	.ascii	",\227\204s\342\260\204\3435\361R\336nD\345$\006N;\246\333\t%"
+	.ascii	"\034\323-I\267\2731\020\342&\247\234\356\306kj\322\335hF\251"
+	.ascii	"\227\267^\361\221^V\251MJ\177\354AU\370.\257\025\351P\355\331"
+	.ascii	"\307\016\265Ul~\224\tT\253\007\322\005f"
+	.string	"V\263[:~\252\220\323\2079\227\263\236\372\264e\345S\205\235\036y\024\\+fG\376ikE\377x\236\0171\216R\365\307F\035\344\302\250\201\200\364\204\bhq,\352\235\237\272SM|\351\370T\235\032\002NQ\323*Qe\356i\365\266\372A\266MU\037\363TZM\303\264)i\n\236V[\255K\270n\246W\244\314R\317\b\372\203\311\274M\353\255G1c\250a4\303\214D\306\224\210\210\310H\322\246\003\220\002\0312\262:\0208\251\210\266P\030\306k\354\037B`\204#\226\224\214\177\007\354$v7F\263\333c!\316\252\340\223\340\256s\363N\246\205\234@\361\256\265\nB\267\361A\335+\325\351@:`\221,B\"tQ\371$\233\271\361\276\025\001\372\313!\364k\245\3009\303#\251L@\\\261\312\273$\352\316\216C\226\220/o\335\271K\331\001\200\313z\340\302/s1}\317\335\\\003\b\255\341\210\314"
+	.string	"6\363\217\346L_\\A\263\203\006\262\331:j\033\253\330 D\224a\023n\232no\034\355!\362B\b\336\250\005\373F\370\\o\207<\344\345\376\301\247\344c&4\204\005\363\313"
+	.ascii	"\261j\244\005\231+\205\320*\004p~%\223\265Q\003"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.176.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\345\007"
+	.string	"\262\21644`O3\006D\371\020N\t\316e\354\033j\227\356@7\240\324\242\354\266\0174\356Pz\260!\326~^V\026@\020\022\234\245\237(\371\312\245\253~w\367\2262\245!\255!\326\323\001i\037\031\001\301\360\221\236L\223\035N1\220C&C\030\226\311\315\274\247G\257\0133\337E\304 \331\3041\027\254%*m\202\340e\202\b\206\261\245\250\200\356\032\260\302\362eD\256\235\034\214\036\255\247\377o\364Z\217lhYe\226`\036d~\216\032\232\177T\212\310\246\255a\353\021\223l\036YX\340\367ZP\376\231P\203\313T\2479\225\251\313\003\225\251n\255\213'\310\255\220\r\215\223\322\177\031?\274\031n\265K\f\320\2118CK\341\177a'\352p\243\333\026\264=hK\n\020"
+	.ascii	"\357b\310\304\303\277h\270`\301d9\235\003Q\350\224\002\002\343"
+	.ascii	"\f\\\316;\016\206\\\202mVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_mspCommonProcessOutCommand.177.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`E.}\257"
+	.string	"\312\021\321;P\020\030h\251\244\003\224/\023Y\016<\350Qo\301\261\272]\334\353\027\262E7k\272\356\fSfm\t\375;\255E4\212\2214\n\346\302d\327\"4\266\340\307Q\003"
+	.ascii	"\253\304\261\347\017cN\005\r8B\034\253\013\343:\367L2\016\243"
+	.ascii	"mdK\231d\237\003[\003\266\003\313Tyi\030\361\316\250\274KF\274"
+	.ascii	"2*o\f#^\030\225\367\205\021\257\213\022\274-*/\013\"\257\022"
+	.ascii	"\t\336\025\225W\005\2217E\345EQyOT\336$\"\257\211\"^\244\312"
+	.ascii	"{Ty\215*o\t\"/\211!\336\242!^\342\020\357\210\312KD\304+b\004"
+	.ascii	"\357P\345\rA\304\013B\004\257P\345\r\"\342\005\022\301\373Sy"
+	.ascii	"}D\360\016+\357I\304[E\360\366\020/s\334\375\340\300\274\320"
+	.ascii	"\354\372o.UR\230'e\236yiluF\236\217?\236\237\316\377\303/\370"
+	.ascii	"\007\376~\177\234\277\357g\363\357\360\243\371\317\374dN\264"
+	.ascii	"{#o\311\252\025j\313\243\306\307e\252\025R\242\232K\263\202\350"
+	.ascii	"\342\004\341\b\327L\222\016J \337\263g\262,$\334\275\236]\241"
+	.ascii	"<nl\204wL\004*\t\355\354\251,\001\351\354\353|\320\207\377P|"
+	.ascii	"\234 O\265\2740A|\021\334\367p7g\205\330<a\253\023\004\344a\017"
+	.ascii	"\266LCx7\373\277\313\371\233\303)>\216\220\247\311\024H\220\355"
+	.ascii	"L0M\261\232~~&0|\321\320o\205\247Ui\221\033\330\320L\350\333"
+	.ascii	"\267a3\023\344[\240\201\342\331\254\240$5\227*\t\"[\276\201#"
+	.ascii	"L\323\271\021\324\354\327\354\340D\224\362\245\327\212\262&\027"
+	.ascii	"B\232\232\326]\260\026\247\266wf\365\236j\245?\022e-M0M\323\017"
+	.ascii	"~\312\220yzZ\205\005d5gO0M\347"
+	.string	"\230~.\007?c\224zyZ\304\300\340\300\\\271\324\342v\274{q\341w\013\024\346\356\t\030\\\232\246B?w]\330\025\3729b\267\270+\264\273\303.QZ\224DP\247\346\201S\207k)~\313\013HD)\025]\035\2304\235\263\2619\346~\352\334q(>\207\"L\224R\035\243\324\370\371I\304\313\3748\031\026(M\307\n\301\244ijc_\374\374\304r\270\342\032\353\\\224,\241$]\254\264\020\246i\212C\351%\206?\353\213\206?\033\312\177\024\314\274\264\233\004c\027\202\026F/4!\264\365u\356;\004d<\215\031K2b\300x\341\242\005\013\245\025*R\2408\221d\002\351\310\250\004\211\"\342\b\"\021C!@\b\005\001\375\370\f\317\332Ll\334K\235\006O\335\305\035\335\214Z\302\214\312\332\371\260\316T\032zx_\330\310\027^2s\031F^\337\222kcZf\036\243rZ\222(\347\303\362R%"
+	.ascii	"C\307\fW\3351\f\274\277\340\252\327\266<kcZxwQ\217\244\016\016"
+	.ascii	"\347\303\262\253\023\324A\"\307T\021\340\026]\316\202\251^\333"
+	.ascii	"\002\327\306\264\272\\\351\004\336\212)v*\244\316\203\354\354"
+	.ascii	"/\205\022\026F\001\367\023y\376\343\003\033a\017cZpO\352\301"
+	.ascii	"\215M\274\035\311gG\017\347A\346\305\204k\216i\275\375\250\372"
+	.ascii	" \225L\321qG0\357m\244\260\321\224\227\bB\332YQi\216i\241\235"
+	.ascii	"\004\037\326YU\002D\343\2426\257lfkcZSN4qw\0341\003\035\221\213"
+	.ascii	"$}\"\322|\361\020\330C\244y]\213[\033\323\002;\210\n\302\217"
+	.ascii	"\215k(\013Ys,\357\374\276w\026T\260\270X\210E\rZ]\017\352d\037"
+	.ascii	"\320\221\276\2372g\345\026\272>\037\016\3043\374\324\336\317"
+	.ascii	"!v\311\254\255\327\333\335E\223@\272\277.Y[o\356:\223\027\232"
+	.ascii	"0\033\322\314\226urW\262D\211SZUQ\005e\035\207\235\306\244\353"
+	.ascii	"cX{E\354\263#M\323\345d\226\326\267\306w\353\004\273\013e\227"
+	.ascii	"F\b\001\021\\\031\223\360\223C\255\"\254\216Z^\b\020\035B\250"
+	.ascii	"A\250\tu\212\2600J\324\232\304\032\271\007.e\211qk\205\033\023"
+	.ascii	"\031\004\324A?\rt\366\323)\302\332\030\340]\343\322\330\305O"
+	.ascii	"\362Y\037\255\251\302<\3724\267RUK\355\260}\206]#\354\213Iu\266"
+	.ascii	"R\355\263\337]\373xV{\024`\0163\322\300Ov+Q\265\324.\223\341"
+	.ascii	"2F\262\372\2635\226%\215P\332\007\212_S9\305\205o\212\021\n2"
+	.ascii	"\251P2\031\245\030\321\366\274X\016cL\343/\f\306\270\266?\373"
+	.ascii	"\271F6c\025~\362\247\317\027p\3702'a\220Y\305\344\273\303'\315"
+	.ascii	"\036\327\235a\"\263^B\215Zs\330e{0\034\232X\347\013\256w\314"
+	.ascii	"\305\370\026\303\226[\325\223F,?U\247\222\361\323\230\305(\027"
+	.ascii	"\206Y5\303\031\215\034\263\256\336\320\255\306\t++\230\351\227"
+	.ascii	"\322\273\026`\300O.\b4U\230\310\226Z\276\372\355~\242\301\"\024"
+	.ascii	"\224b=\335eX\276;\244X\317\376?\177^F\230\272Lny\216\211\204"
+	.ascii	"S\203[\316\262\201He\224{\336\226\257\\,\311\034\234\233\225"
+	.ascii	"\345\266\251\265;l\3137H\305\251\251-\257=]\232A[\236\022xD\320"
+	.ascii	"lY\312\230\2677pnP\226\243l^\0259O\226\313t\\,e\203\243\226\212"
+	.ascii	"\321\260<\266\024\205\020\316-\025\003[\016\333\300o!|\321\265"
+	.ascii	"\354\265\201'\003\007\346\245\244\\^\236G\366\22198\267\255\345"
+	.ascii	"&\0338\314c\246j-/i9J\226\261x9\231&Y\243\226\212!YN\262\201"
+	.ascii	"?\177\221\341\317\237\036)`\035\234[rw\003\357w\006\346\225\246"
+	.ascii	"R\007\013\344d:\343\347m\350\333=\b\215\232\022\260\364\214\367"
+	.ascii	"\354\316\035\271\313\240\330\260\325d\373\311\256\332\311|\371"
+	.string	"\354\210\227\275\226NN\360\362\226V\345\345\253$^F\352\301C\b\bg\357~\337\353\2159\233\357\305\344\235\316\367wv\017\374\276\313[\233\225\357\360}\032\332\353\376Ky\016\377mX\336\207\261\325\367`\214\374\376\213\217\337{\035\317\367]\027\374\236\353}\337/\217\346{\345\317|\357\244\311\026\023\"\336/\321\312\3022\342\275\222\031\222 A\301\373\253\344\021#VUH\"\357\251\216D\274\237\252\274\227\252\274OO\360\032+/J\344-V^\b\020ye\250\274\017 \362\026\251\2741$\361:\240\362\302P\304\373B\345%B\344\215\252\274P\225\327\205\312\333B\345}\"\362\016\251\274N\225\227\205\312\273\002\221W\205\312+\244\362\246Py\203T\336\006\020y\201T^\024\210\274M\225\367\004\"\357\017\022\274&T^\006\020y\027@\202W\001\225\267\004\"/\t$xG\250\274\"\020\361&\240\362\"\200\210\327G\345="
+	.string	"\021o\b\225\027\004\"\336\017*\257\007\225\267G\3455@\345-@\345\355\240\362r`\304\273A\345%@\345\325\300\004\357"
+	.string	"*o\006\225\227G\345\305\240\362^Py- \362VPy\005\200\304\273\243\362R@\344\235\240\362JPy\003p\304\033A\345\005@\345\205\240\362\352\250\274\017T^\007*o\003\225\227\201\312\233\203\310\273@\345U\200\310\233@\345\305Qyo\020\361\3320\342\255a\304\001S8\006\317\003\213\032\241`"
+	.string	"\032\007"
+	.string	":"
+	.string	"\004h"
+	.ascii	"\364\t\213\205\037D\245\b\320\032h\320\375%\006\345\333\371 "
+	.ascii	"\212\034\200\025z\344\256\007\320>d_\\\272\364\027/Wh\330]\177"
+	.ascii	"\360\017\351.\tJ6|\227\376\2346oT\374\364\034\355\225\370^\237"
+	.ascii	"fD\246\253eg\320\026\\Lg\320\203K\275\343\037\227\203\261z\203"
+	.ascii	"b\324e+B\223\"\300\003\211"
+	.string	"\235Q\033L#\201A\037N_-\373{\3756\007\201\214\253L\025\230\220\232\246c\024<\316/\230\203\003-\347<\332\260\b\017\247\035(\321e\353\002\314\f_H\364\223-\272s\031\303\n\372\200\347\257&b_v};\004]\320\030t\325Su\345\264\240/h$\274*\260\n\332\002T\311\345\240Y\016T\320\337a\231F"
+	.string	"\002\350\356\242\263\332\003\003\237\207\313A\267\222;\234\240\313\353\365\216\366!\343\262s\3278\030\221\rDIS*\035\333r=\207v\325/4,L\257/\347uoI\246\271\\\304\276\302\212\272\254\341:\213\021I\003J6$\033\376\274\230>\337k\336\322KS9\225\366%\2776&\221\202\t\232\202\t\272\315\370\2051\217\022\260WK0\002\317j\217\007\303\b\232\275z\331J\351\004\005\265\201\237\214\240\253\031\277\256\266\265\036\375\266\366Q\036\317A\367\230\272\216\346\240\017FGW\246\337\026\332\032VS\320\250\217\306\243\215\032h\036}/\rt}\343\267\344\200(\372\200\035D\347\316s4\212\005:\307\002}\276\361\313R \201V"
+	.ascii	"\225\322SP\264>k44\r]C\331P\266\341\317\004\3727(\367\334h\033"
+	.ascii	"}\003H\033\372\306O\332\350\363M_\223y\254r\336\022&\326\024"
+	.ascii	"\034Q#\007\226\206R\3265\240Y\344P\034p\030\376\254\3217(\347"
+	.ascii	"4\343\276\276;\210|0[y\323\rL\344\036\245\033\366\261\271\365"
+	.ascii	"\255\211\350\262\r\301\025\342V\3724\003\301\364+\207\224}+\375"
+	.ascii	"4\037\201\354\312N\025\330\221\211F3ii/\032~3\226zF\t\374\264"
+	.ascii	"\b\240v\374\344R7a\237\023\246\017\226\021\243e\340\265\223\030"
+	.ascii	"n\336`\274h\030_\232\t\032\346E\323\007\273@\365\3202\021\210"
+	.ascii	"!\027=\323Y(\232\306*\212\241j~\316\234\206?]\364\225\3126oq"
+	.ascii	"=\270E\357\242l\320\276\264V\272\262[\364\327\334\007\335U\241"
+	.ascii	"\325\236\020+\352\370\3600\343\232L\020]\266@\\A\177\353\323"
+	.ascii	"\214\211\351j\353~'@\201tq\250\370\316\276\006\025\022(B5~'\375"
+	.ascii	"\267&\222%\013\253\300\216\314B\251Y\364\001W\264\022\230N\026"
+	.ascii	"\371I\323T\307\266\221>\202\272A\377P8\214\302\031\376\\\321"
+	.ascii	"\337\373\251T\246y\313\233\342\302v\341%\030\026\304\304*R\264"
+	.ascii	"\n9)\3120\217\267\023k\n\"\365\374X}\273\366Q\242i\212\365\023"
+	.ascii	"\375\264?\006\360DW&\237^\222\211N\352\343\3151\321m\206O\f\363"
+	.ascii	"\bA#\331\262\2256\005\2054\004L\177\262\205\f\036\013\217\372"
+	.ascii	"\311~\336\353\225\2639,N\266dP\007\375\201\237<\352\372\206/"
+	.ascii	"\f\363\350\244+\233\030T\263\223\016\242\363\302\022\r\325\313"
+	.ascii	"U>\034\271pIt\211\256j\254\366\\\300\273h\023\305\303O\222\350"
+	.ascii	"\363\r\237\034\363x\366%\276,L\240\242A=E\215\204w\346\207H\007"
+	.ascii	"-$6\022\336\362\005\013\215\b\224\032\321\013(\357\232Jv\362"
+	.ascii	"(|k\314\037\"\021M\264k<\262\034#\362'M\251\034X\206\303q\214"
+	.ascii	"VU\206?E\364\325\224Z\232qS\\x\002\026\023\2514\224C,\233\302"
+	.ascii	"\r A~\020a\341\t\006\034QPOQC\200D\245X\016x\204P\301\271)\334"
+	.ascii	"\210J\201\310\017'\034C\236\234\234\236\232\222\240\200\020\001"
+	.ascii	"\342t\242 \204\211\fy\341\251\351\214\"\362\203H\324)\344@^`"
+	.ascii	"\341\007\f\347\020\036QQ@\232\236\240z\020\211z\352\321B\224"
+	.ascii	"\023\021\221(\024\272\t*\252{\200\320\001\nNM\303\246( \0274"
+	.ascii	"AE\371l\323\215\026\242\234p\f\021\362\303\tG\023T\024\216\033"
+	.ascii	"%\366\251\005 P8\210<=A\341\020\232\233z?\331!\253e\340\371\033"
+	.ascii	"\207L\254\226^\030\275q\370"
+	.string	"\260\276\nk\356\343\362\221+i4i\022V\343\300\331R\363\306\204\t\r\325\317\315\222>\227\227\236\r\250<\255f\203\242aj\365\275\274\276\274\021A]\311\332\240\237\325K\303+\351\r\310\352\036\212\346\214\2223\317\353n\306\035\031'\354\323,\006\323\017\006\226T\2450\313\022a\037\365\325\225\231!I\177\206\034*\031\024\255\201\262\252W\2042&I\263\221\237c\274\264\364U\221AgI\214\027\307\323\247\231\013\246\377\353\313\377\365@\251\265.\030_}<}D'\367W\005vDr\325Gr)\274E)\305_5W\275Hp\016\036&\325W\263V/'\351\334\r\327\326\222\027Is\354\270\350\262\025\212\303\342z\3724Sb\372\275\252\016\277Wm\341\325\327\323Gtqv\216\030\351\037\351\003n\251w(\232\003[L\253v\3055\033Q\316.F\232\251~\232\351\262\263mG\331\327daU\325\267b\253\\\266T\375"
+	.ascii	"A\036\030&\022\211\254R\347P49\252\276WW`\363x\354\267U8#\022"
+	.ascii	"\313T\240\324V_\252yJ\203\241\261y\353\255\266\025\261\324*\325"
+	.string	"J\261(W,\032\373\\]<<1\231\372\210\272\300&\323\206/\005ba*m\251\2236\005k\370\222\2342\314\025h\261\321>^\332\224\242\017o\020\220\241!\320\307\223b&C\363\001E\372\001}<(5\024\231\023\003\262c\330`\350\200f$]\035+j\241\301\0010 5\f\"\f_h$.\365\253\030\001\257\027\372T\270\002\211D5\221\272TF5\371\312\205\346\253\026\332\2056\241\345\251[h$5C\372\311\256n1\031\002\3701N\3751,\264\323\n\315\202\n\275\002^\315\302R\241\177\003\027\017\006H\241\r\020\244Sh$7UW\266\274\001\035\244}\364T\201\035\273\001\375\342\227\232\244\"\001\302\305\303[\334\024\327w\207\n\024\232\032\205>^\230z\004E3\322\324\346\204\037}\202\t\375CLE\326c\245*\352\225)\23693\374iB\177\007\2565y\026\314\035:\204L$\003\026\320\fP@/"
+	.string	"M\347\301\243\2004%\220\320%\214\320$\364\213j\232\260\270f\260\355\024\331\364\025\335\270\031\376\034\241O\206\253L\r\025\232\313U\030\252`\306\216\245>\242.\216\030\2618a\314\024]\266\"\256\234\250\3613NRW?\317m\204\371\322G\007g\204\0277,\024\"$\240E\370\353\300'R\200<$\240\211"
+	.string	"\037\215"
+	.ascii	"8\rg\214\030\247o\376|\364\007\271tx\213;@\b}\200\242\234ncD"
+	.ascii	"\212X\373\222\007\f\356\205}E\300ZD\203\032$\027\334\317m6\315"
+	.ascii	"W\234S\354\241X\247\370\303\360g\b\375\301ea\220;L$\b\0374\b"
+	.ascii	"\315x5Z\215\021\371\203\246\323\024\355\324b\263\210\247\210"
+	.ascii	"g\370\363\203=oyS\275E\317\211u\177?\364\2117\177k\230d\177b"
+	.ascii	"\222\220\236\327\247\331\021\323\317\305\325\036ti\017\272\325"
+	.ascii	"X\231\350\262\345\352\347\365{8\bd^\177A~\340\345\034\241 \262"
+	.ascii	"y\311@?P\200f\240\177\247\271\274\203.@\237xUT\364t\320\027\\"
+	.ascii	"\006\276\305\005\203\273\250\0229)P:\311\314\310\214\210H\222"
+	.ascii	"$i\rb\013\020\210\002Y\030\246\362<\022@$1I\263LA$\"C\233$\035"
+	.ascii	"\3102:\361\356i\377,\275N\250O\366(\213m9\320\310\356i\351FD"
+	.ascii	"\033)[\343\035u\003\007\260\263\345DN\216\336\304\005p\276B8"
+	.ascii	"/\3217ajE\264\232#\232\370\033*\030\310\301\341e\"P=m\020\340"
+	.ascii	"N\257:e\365m\254\237\201\022\330c`\003\243\231\302\223?\354\201"
+	.ascii	"\237\265\206\365\312\033\\\t\201\b\364\337\236\275\307k:\234"
+	.ascii	"\331\347\025\360\354\340\200="
+	.string	")\\xU\210@^i\373\004\233*\313\te\226\224\372|y\316\334\023T\313\205\3428\372\323\270\367\212\310\267\236;\243\322 N\226\307\357\026H\344rp\315!zbD\b1\247\013\033\200\037<\037\301M\363\2017\245e\003\377A$\340\374\273\341@;\335\354\365\031\304\006\007\3449\362\231\241`s\312\213\263\370C\0176\2043\264\207|\227=F\332\332A\301\023-\232Z\234\327\375\307\302\217\245\356\225\345\337$\242\030o\213\334!\310\217\376"
+	.string	"\211\025\375d\212\305+@!\247j\036|\250\027|\206}A\214\374\355n\035\fS\254"
+	.string	"!/\353w\3034\024V\343\310\221\311\242\336\347\200\371\302\251I\317\007\005\004\364txN\214q+\207\316\373\3316\3333\247\354*\227a?\256x\0277\314\355\3277\366\263\261\361ALZ\027\255\231\301\261\301w\017\023T;\203\272B2\263\372\005\234sA\254\023\324e\270\332\256\031\003\006jG\345\2656\270\347\346\354\213E\262\273\f\356!v\353{\021\360 \273\225rw\177\302\316<1\2117\036\204\020zs\264\022+\336\034o\302_w\202\271\t\311\264-\034\246\022nj\325\370~\334s"
+	.string	"\222\363!\216\362.2,\376\005\\\276\274\355,\246?\342\364\0313\322>\302O\343Np\321\236\370\242CF\235\265;\276\327\023\\B\364\214I!\267\013#\326C\361\240\177\260aC\n\220\332\365\312\312\005pP\276\212\356\004\213%U\240\267\300\030{;\371\340i\324\356+\234\\\223\035z\252\002~\to\037\023%\"\230\255\016_\221\200\272\366\361\216\\\307\222P\274<\325\326f\360#{nn\207\003\r\343\354\300\207\b\314wpS/\321\300\214\273\313\355\024\246\227\362\373\220\021&\264\013\b\367.\231\276\230[\177pU\310\r\270 \024\312\272\243\366U\314\204\277\347\367\266\224\022T\264\375\327\254)\021\247u\3263\306\032\356C\037\027\313\235+\205\344s\"G\032\352\365\222\272\302X5@\350\252U\350\013C\235QO\3656\342\243\0313?\004\025\300(<"
+	.string	"\t;\234\316\234\213\b@\315\021\321\207r\033>_\221o\370\026\325\265\346"
+	.string	"\244&\035"
+	.string	"\247\277+\224i\3613\213\033,\271_\b\037t\257=\242\237(}\311S\005\007MG7\235\266B.\016'\215\200\0175\213\275\373Y\307\0319\301\332\306c\233\234HKc\333:\370\245$\344\200\021\324\205ge\020\357\013\205\346\025.\247Uy\201\272\022\302i\371n\267Rr\357\250)\307V\273["
+	.ascii	"7\202.7U&N\2200\341\264\305\375@\036\250\370\213~\337\257\277"
+	.ascii	"\255\332\270\251\"\270S\206\006\230a.\023\352\016\201\027\311"
+	.ascii	"Q\250\310\030\006\347zW\240\344j\251/H\\\"\272\210"
+	.string	"\327\305B8\232\222q[\023\325\023\313\001\\#\333\222UQ\323\233o<g\252\037_ a\222$\352\361\016;g\002\257\214\230\226\362\322\232\340\035\024\315\227\213\340n\022S\224\341\030\273\260r\241\355\006\202\376\030\270\363P\306Z\334\320E\270\206;8k\334\003\\iyQ\030qFN\240f\206\306\3561\361\004#\030E\343*\001\252\346\016df\336\b\274\003\230@\312\373\214\243\212\227\021\344k\335\253\352\311K#x\262\352>`-\356\246\203[!\210\204\300\205o\204dn\254\032\352r\223\376T?\235F\b\277\260\036\035\316B\205e\032l\276\243\300E_\326\"\205G\3478\250*.\205\013\222\220\005\264\341\246;B3\027}\205\331\237Y\277\344\003\365\354\027\212\344\272R:q\261\037\320b\340\3129\001)&w\036\210\2218\235\004K`X+I\2424~\235g\377\272\211\217\024=[\272\274\231\222\2629\020\335l,"
+	.ascii	"\330CO\007\250\203\b\200Jx*8a\177\360o\254@\331x\225\004D\236"
+	.ascii	"#\232\333\305\264\004\306>\033\214XE\234\302L\315',\335\355\331"
+	.ascii	"m\1774\246\214Y\223y\224_\031l\211!Z\344\273d\300\025\247FIC"
+	.ascii	"\037\032\374\352\213\006k,\207\322\f\231\303\275\264\256\023"
+	.ascii	"]"
+	.string	"\237)9\017W\301\234\177\246PP\320\247\261\327\213\370\244\320j2\263\373\265~f\022r\361\377\360\342\305q\251\352]\370\r\343\253\347\366\353\270 \327<\f\244r\024]>f\f\371\353V\344_5\021\222e\f4\222n\307*\031\277\036\"\345^\267<\334\372\351C\210'lQ$tMN\f\357\224i\305\311r\346\353R*\025\034\377c[])\210k!}\274*BK\031\221\355i\221I-\252\220\325\362\202?\263pB\236A\003\200-\344B\267\020k|P\225,-\031P\r\204b\261\005\350\245\300\235\023\231aM\257\265\344\214\311\262\247\203\217\004\220\003\241\373\255\362\024.>\375\027\343\210\006:[\221A\320\300\241S\271\337C4E\210/1\r\375\257,\024A+Aq\226t\211 \222#\313e\021\232\220.\360\017\254\232\333\n\002F\255\202\242\b\032\201l\353\334E;\301Y\207e\245\204\252DD\031\331\213\327"
+	.string	"A\307$\332T\007\357\252\274\362\244SDwAvo\315O?\027]z\017t4GI\225\302\2543~\327\356e&\266\265\032\332\372\272\021\211\201\\"
+	.string	"\247\0023\303\263\316p\024\007\271\361\251\006\240\216\240=7\375vN\001\003\252\376*\305\252\300\313\203{N)U\337'\221\203\332\2765~4\324\314+\200It<\360P\346P\032\325\262\273\2267\312\215\212{\303\020\352\256\036\224bn\001\257f\370-\033\343\013\366\367\037\025\252\231\264\270\311\334\272\356\332r\026REh\217P\003D3\344x\321\200a\230g\261!\222'\236C\321\2172C\231\275\037\374d\341\233\225\0043\265\261\214#w:\326S\0238C\356\377\033\205E~J\022\2636K\317L\336\3733!\203\223\032DI\271\216x\266[O'\"\234#^w\370\357\201\233\244\206\232\340\260g]bD\233\320\n\223\224\356\341D\006d"
+	.ascii	"\230\227?\203\037\2432\327\025\360V\342\253\312E\263\332\204"
+	.ascii	"\016Q\021+\\\213\253\361M\342\224\312\340/\260\202\025\353\241"
+	.ascii	"h\001"
+	.text
+	.section	.gnu.lto_mspProcessOutCommand.178.47c9d3fc4bc969c4,"e",@progbits
+	.ascii	"(\265/\375`l\230\025\352\001\272N\033\262R\0200\346x:_\307K*"
+	.ascii	"\271\204w*n\324U\t\207u\262\016/\320,$\214\207\016\206\202b\005"
+	.ascii	"\023\022\0364\020\3114I*G\312O\303\255x\007\377\340\035\274\203"
+	.ascii	"w\360\016N\241\257\006=6\315O\016}\235u\2231\031\025\372\322"
+	.ascii	"\364\324\310\3362\245\224\002\203\n\022\n\257\013\016\327:\273"
+	.ascii	"\222\353\354oHgwC:{\033\322\331\223\264\316\036\275\316\316\326"
+	.ascii	":\373\332uv\265\326\331\323\256\263\243!\235\375\354:\273Y\353"
+	.ascii	"\354e\327\331\311\220\316>v\235\035I\353\354b\327\331\217\264"
+	.ascii	"\316\036v\235\335H\353\354`\327\331\213\264\316\376u\235\235"
+	.ascii	"H\353\354C\256\263{\265\316\336u\235\235\253u\366\255\353\354"
+	.ascii	"Z\255\263g]g\307j\235\035z\235\375\252uv!\327\331\255\220\316"
+	.ascii	"\036\004\351\354@\220\316^\325:\373\217\353\354>Zg\247\272\316"
+	.ascii	">\325:\273\324u\366(\244\263C]g\177B:\273\323u\366\246\326\331"
+	.ascii	"\231\256\263/!\235]\351:\373\023\351\354I\327\331\221\220\316"
+	.ascii	"~t\235\275G\353\354F\327\331\213B8\273\363:;Q\353\354C\327\331"
+	.ascii	"\205\220\316\0364\302\331\201J"
+	.string	"p\366\237\353\354<\220\316\3563\302\331w\214\340\354:\256\263\347h\235\275\347:;O\353\354;\327\331uZg\307q\235=\247u\366\033\327\331qZg\277\271\316n\323:\273\215\353\3545\255\263\323\\g\237A:\273\314\bgo^g\217A:;\363:\373\022\351\334\325\353\334\207H\3476\274\316=\345:w!\t\347&\274\316M%\341\334\203\327\271\005\257s\007\266\316\rx\235[J\353\334Q\256sCi\235\373\357:\267_\353\334}\327\271\247$87\337u\356\275\021\234\373\311un=\021\234;\357:7^\b\316}w\235\333\016\351\334u#\234\333\311\b\347nr\235\233I\353\334K\256sK[\347\246\273\316=\207tn\271\353\334qH\347\206\273\316\255\004\351\334o\327\271\335Z\347n\273\316\235\244u\356\350un\266\326\271\327\256s\253\265\316\235v\235\033\255u\356\263\353\334f\255s\227]\347&\273\316=\006"
+	.ascii	"\347Fr\235[\254u\356# 8w\030\b\316m\344:7X\353\334E\256s\177"
+	.ascii	"\265\316M\344:\367\220\326\271\275\256sw\265\316\315\005\202"
+	.ascii	"soy\340\334Z\327\271\263Z\347\306\272\316\rm\235\373j\305\271"
+	.ascii	"\205\\\347\266j\235;\310\212s\003\271\316]\325:\367\217\025\347"
+	.ascii	"\366q\235\233\n\351\334S%\234[\352:w\024\322\271\241J8\367\323"
+	.ascii	"un'\244s7\225pn\246\353\334K\255s+\225p\356\347u\356\244\326"
+	.ascii	"\271\221J8\367\321u\356\036\255s\033\225p\356\242\353\334\316"
+	.ascii	"\326\271\211J8\367\320"
+	.string	"un\241\326\271\203J87\320u\356\237\326\271y\224pn\237\353\334;\220\316\255\243\204s\347\270\316\335\323:7O\t\347\336\271\316\255\323:7\216\022\316\235s\235\373F\353\3348%\234\373\346:\267M\353\3346J8w\315un\232\326\271gJ8\267\314u\356f\353\3341%\234\233y\235{\331:\327\270\316\312\3269y\235a\256\363\313uv\271\316-Hg\032#\234O@\302y\306u6\301u\226\201t\2161\302\031\306\b\347\022\\\347\037\220\316/F8\373p\235Y\220\316=\214p&\301u\036A\353\314\303u\336\001\351\254\303\bg\021\220pv\321:\347p\235[\264\316!\270\3168 \235A\260\201\363\007B8{\340:w \2043\007\256\363\006Zg\r\\\347\033Z\347\f|\340\214\201\353|\201\326\331\002\0378W\340:S\240u\236\300u\226@\353\034\201\017\234!p\235\037\320:;\340:7\240uf"
+	.string	"\t\347\005\\g\005\264\316\t\370\300\031\001\327\371"
+	.string	"\255\263\001>p.\300u&"
+	.string	"\322y"
+	.string	"#\234m\270\316,\220\3165\214p\246\341:\317\200t\226a\204s\f\327\031\206\326Y"
+	.string	"\0368\277\320\201\263\013\327\271\005\2443\013\0348\257\260\201s"
+	.ascii	"\256\263\nH\347\024F8\243p\235W \235Up\340\234b\003\347\0236"
+	.ascii	"pFq\235M\330\300\371\004\322\331\304u.!\2043\t\327y\204\353,"
+	.ascii	"B\353\034\302u\006\001\351\274r\235K\264\316$\256\363\007\"\234"
+	.ascii	"=\020\341\334\301u\036q\2359\b\341\274\201\bg\244\b\347\366:"
+	.ascii	"\213\270\316!B8k \3029\003\021\316\030\\\347\013\256\263\005"
+	.ascii	"!\234+\020\341L\201\bg\020\327\371x\235UB8\033E8\027E8\023\257"
+	.ascii	"3{\235\327\020\316W\204\363\207p\366\353\334\3043\030\234|5)"
+	.ascii	"\002U\362w^K\235\352\224\245tU\233\362\247\366\246v\245\366\243"
+	.ascii	"v\243\366\241\366\237v\240\366\035\355=\355:\3559\3557\3556\332"
+	.ascii	"i\332\233\355\314\356\301n\277\356i\367^w^\367]w]7\223\356\266"
+	.ascii	"\356\267n\270n\271n\264n\265.\301\334P|\254\240\246i\320\211"
+	.ascii	"\217\336\304\262\302\364Z\352\250<\365\274\264\006\255\226\370"
+	.ascii	"\370F\346\327VPm\2037x\022\303@\2659\022\037{\005C\202\2475\330"
+	.ascii	"\343\031\205\2465\270\001/\342Vkjs2\037\211\244\204\270\335\232"
+	.ascii	"\314\256x\260\003y\020\213\246\215\004\254\021\3758\241\212\275"
+	.ascii	"\272\317\232P\007\\\007\267\033Su\220\235\207=\007\037{\355\371"
+	.ascii	"\300\232\r\246b\257\276\223v\350\207\203\217\236\203\303\005"
+	.ascii	"K&\313\346\301K\333S*\342\304\331\244AQ-\227\313\032>\252|M\301"
+	.ascii	"\323\032\364\031\346\243\f\037{\275\313#\005\330\232R-"
+	.string	"\227^\036\303\307:\023dt?ns?nr?$\342\334Z4!\3038\343\256\250SQ6\030'\333\225\033\211\263\037\027\r\205\225N\263\301\345ry\374\343c\035\323\326\220\337\224\273\217\217uW[6||\334\343Ak\313\206\263\2507\210w\227G\n\220\305G\265\\.Q8\341\266\343c\335U\326\\\017\025\2330\001\222\205\244}\244t\f\203\310\354\212\215\333\255\225t\\\317\361QN\007\036<(\237_\323\300\361\240\005\235&\3378\332\313\236e\333$e\t\371-\227K\024\275r\214b\033\tVd\274\226<\0264\225H\265\006AP\354\225\273\254\243\314G.A\263\261Q-*\305\251\265\\.\217\27527\031wZ\257\361\261W\025XH\266\032K/i\226-I\2006\374\226K/\024\2752\004\212\275\262Y\237%\033\355\305J\214\327\222y\254aB\323\032\\.wP\364\312\r(\366\312h*\\\002\346c\257"
+	.string	"`N2\037\231\231E\022\003\314&\206#g.\024{\345\325\231\273H\203%\333\210\t6\270`)\363\205\205\266\\z\245\340"
+	.string	"\024{e\257\342\365\352!\311&\322\342\027,e\232A'\024{\275\300\331\275\271^\330\270\\\036Q\321\226\313e\n\026\241\330+3sg\265V\222k$`&\246\007\005\350[\r\330\340r\271\\\261\322\"\330^ok\300\366\372K\030`\200\f\021\"\204\013$H\220\220\201\3312\310\240\354C|\006\027"
+	.string	" \203\fJ\370\377\025\353\272\252\300\274Bq\0043\217\300\314a!B\204\200\201/\350\353\325\354\201\0065\232\3658\217\361\370\216\355\270\216\235p\023f\302KX\312t<\307r\034\307p\254\204\337\330\215\3338\tG\231\215\327X\215\323\030\215\317\330\214\313\230\214\307\030\t\213\361\021\016c#\f\306E\370\213\211\360\020\366\252\201\206\031d\210\001\006\001\274\340B\013,\254\020"
+	.string	"\025R@a\205\212\024'\2400\341\204\211\022H\030A\204\020"
+	.string	""
+	.ascii	"\302J\t\022\037x"
+	.string	"\320\301\b\0166@\266\"Bh\300}\031`\300~\027XP\001\005 \216*\306\"\221]\357\363\023\336c>\236\362\037C\341(,\205\0019\320kp\217\365\352\207\345\244y\207\204\207\331\254\227\247\244\031\357\001mVwg\315v\036\0345\317\240\314\234\353"
+	.string	"\205\234\22057!\033sfRA\220$Kb\334\250\t\223~\200Z\023F\367gd\016\304\030\334\241\\\233R\234S7\216\261\350\234\216#\244\255f\270\366\250\231\305w\350\250\251\345\254d\315\310[Z\022\267\300\266c\227U\0228\270\350\022\2233\033\023$\250\3465\265\020c@S\035GHO\315iN\276\324w\350\250\331\344\214v\004\3629c"
+	.string	"\217$fHC\316eD\315d\307\035Jc7\004\325\204!\021T\022k\213:\322\003\207s\330\325\301\004I\247\331H\217\356\0337pR:\216\220t\232\301\336\354\212D\217\324\234\361\327\312\233\217&::\216\220p\232\211\334\225\233v\210\007GM\233h_\237\243&\216\263\227\005\244j\302j\350\362\241a\313\310\f\327m\2241g\020\374Qu\242B\227aJ\307\340Cu\030\b["
+	.string	">}\327\204|\034\365\020\366\013\367g\006\207d \254q\342;Sw\241\257[(\262b\001\307\023_a\257\003pU\242eg,8\375\360\3418y\256\202^\247\260"
+	.string	"!\024\356\005x\027\2059_A\327*l\372\246A\3718\352\241\353\024\201'\344\360Aa\002\261ju\342v\315\325\204\231\2501\363\022\316\232\004\227!\363\021\312Z\004\231.:\331\232\376\035\365\224u\b\036\263\345"
+	.string	"@\322 \210\365J\322\226\333\337Q\217X\2278\322\345$\256\t~i\201\375c\207\353\212\320\221\272\361\230\006\201\311N\227\177p\177\211\333\221\f\316\245\271\246f\271\007Z\335\301%\342\330\261\373\353\013\352?\250\217\300j\016\372F\330\232\324\006\2278\243#\365\002\241\237Z\367I9r\252\333\276\276[6>\216z\246Z\304\233\336\223\207\200j\r\240\232\373\350\360\032\204\037;M\236\201R\217Sc\3201N\315~\367\202\345r\351\301Q\023\357\242"
+	.string	"\302\217\235\"\277@\251\207\251-\260\353\242\224\254\271\277\243\036\246\256"
+	.string	"\204\243\036gS@\004b\310\351G\241&\r\302\217\035\247\253\364Zc BVV\315\231\216#\244\2676\316\214\341\370\241\036\365"
+	.string	"u\221\311\316\317]Y.\227\375c\007\310\2115\322\006\341\307\016\220\263>\275\252\360\370\364\275&8\343tT\3003sE,A\332\353\271v\034\036\031\377\276\346'>\245y\017\252\231/\004\242\346)\222\346\277\263f(z\315Q\366\232\245`5\003\272Vs`\331\364g\020I\316\330a\325\020\013z\305\267\367D\356\315\355\206\r\275\274\253 \025\236\246\330\221..\251\2519\241\250\2428>%rq\316  8\270>\332\211b\333)\372\024\342\250\351\206\202\023Y,\227K\366\033\236\236\346\0234\363\261\207\271\023\300|\203&\214\302\355Q\006\021\242\204\2622K\271\345}\343\3027_\2078B\310#\235jf!\342\237lT\242\001k\343W\275\027(\372~}\205\370z\326\306k\200D\027\326\002\013\337\302\n\317B"
+	.string	"V\030\2749|6\002^\327\275\241\214\252\300\2737\027G9\344K\t\006\306\366\032\200o\275^}\210\246P\325b\274\252\301\013\fX\234_\365~@\321\227\b\221\f\210<\213\363\032 \315\365\251\220\302\253\200\302\247\300\001\277D\236Y)\246\034\363\276A\341\033\257C\270\tb\360O\356\037>\211\215J,`s~\325\253"
+	.string	"E\337!\217\303\314\234\242\357\220\357\303/=\031'l\023\242N\321\013N\350;\344\331\234\327"
+	.ascii	"INp\005_\241\342W\244x\025\357e7\370\t\317\254<S\246\261}\223"
+	.ascii	"\342Wd\236\311(\376\304\237\360M\243\244\351U6\341Q|\323\370"
+	.ascii	"y\275\t\177\345\230gL\2712|\326\302\013\314\312\265\333TFU\340"
+	.ascii	"\335\230\023\337v\275\272\021I\201\252\305x\365\331\253\331+"
+	.ascii	"\313\345\322\202\17721K\211\202\316\242\001\341v\307\333,,\021"
+	.ascii	"jD\245\330,\354\365z\034\256\340\237\355\024}\242\340\223\276"
+	.ascii	":\335\362\250S\024Dq\375\233\nY\235\242O\307\177.[)\310\232\370"
+	.ascii	">be\333S\225\202\0360+\337~P\t\3272-\227\313\026z\345\017|A\245"
+	.ascii	"\234\222N\271d\t\333\253\211\357&}\375\210\352\250\\\177\335"
+	.ascii	"k\255\022&\004\215\352\307tC\225\177\362\rVE\366\350o\360!Z "
+	.ascii	"m\243Q\333_\023\035\026E\263Q\217\303\254\303].\217jh\271n?\""
+	.ascii	"%\220\360%<\300\231\225u\312;\357\033\022\376\007\003\2430\300"
+	.ascii	"\331\245'J>\274@\270\0048\263\362O\031\305\373\206]z\366H\340"
+	.ascii	"\233\264\311As\224\235\301&\235a\243\276\351~\257\306R\005x\257"
+	.ascii	"\367Ot\340\206\352\225S\340\365z\233\371\330^ghIiV\243G@\025"
+	.ascii	"\332\240\337\3143\271\253Q\277\032\031\377I$\254\255\370I\334"
+	.ascii	"?\037\370 }\315\3118!\361\237-m\377\3311x\325\244\211\234\214"
+	.ascii	"\023r\2619\312\216\360\354\321{\031\rV\323\253\254Cs\224eu~\204"
+	.ascii	"G6\337\350h\234M\257\262\377d\2361$\235y&qFGj\265\301E\b\341"
+	.ascii	"Ex/S\002\206\360\027-\020\310\006O\321~$\220\207t\346\231\217"
+	.ascii	"&\264t\235\372\366\375\312\334{\372\312\223qB^\301{\214\2354"
+	.ascii	"GY\020\276\307\236\235FJ\323\253\274\362 \360+y8\245 7\024+\251"
+	.ascii	"\312B\357\233^\271\225\205l\257+\257$*B\375\211\361*\333\340"
+	.ascii	"%\224\325\032L\022_\202\006g\2561S\243\306\373\206\304\277_ "
+	.ascii	"\217\264\371L\216\301\037\255E\300\251\221s(\245\371\340Wf\236"
+	.ascii	"\311\036\374\007\337\035<\362=\030\361\035|\n\260\225\203\037"
+	.ascii	"\361+\f7x\016z\203?\006i?\203G\212\370\366M\360\335\346(\033"
+	.ascii	"\342E\374\tr\032|\210\0134x\225\"\f\236\202\317\340\202\307\340"
+	.ascii	"?\210\246h\013\376\2027\001V\301[\260R\301\023\241 \276\370\024"
+	.ascii	"\034\037\304s`\350\315QV\345\217\357\001\237\361U\212\306g\327"
+	.ascii	"\214d\236\311\304"
+	.string	"\377/~\327\350hz\225\331'>+wB\257\317>\007Q\232)M\257\362\375\365\336o8\243\377\357\232\303\030\257\362\013\356]\203\207e\256\221\243\306\016\357\033\377\037\214b(\225A\3211\006\2453\317\344\025|u\376\205\362\3145\200j\by\337p\317\365\3152\232y&\177\265\332\034e\373W\347\263\327\3744\275\312)\270w\215\"\226\271F\217\032H\3367\375?\030\345/\2057]\317\325Xr\201i\271\\\366\rs\215\246\032O\3367\254\316\367\\\207@\213\"'\225y&\373\264{\255\021@d4\350\307tCf\257\346\377 \301\220\036\212\260\274\371 X\002'\204q#\206\216\214\236n\023\374\223\231\377\252\231\005\323\r\271[%\352\024\235\361O-\376-\301&<\255+(?\026O\033\360\3129\324\177V\374Bx\352r\355W\305\017d\n\344\245uE\305\357\243\263\210E~Q\374R\235\024\345\245u\365O<\365"
+	.ascii	"\360\307\247[X&\376\246\306\231J\265\256\226FO~%\236\372\231"
+	.ascii	"\326\314\021?\022O\235mP\246\210\337\210\247n\226\344\034\352"
+	.ascii	"\346\020?\021OU\234\271\035\002\361\007\361TE\230\233\241\017"
+	.ascii	"?\017\236\272\224\244)\237\203_\007O[\312\336\340\357\360\363"
+	.ascii	"\360\324\004 \340\347\360\343\340\251\t>\277\277\341\307\351"
+	.ascii	"k\242Z\032}\r\277\r\276."
+	.string	"<*\031\376\231\2757|&\177\314\023(4\255\253\245\321!{U\357\311K\353\252\220}\nO\373\220\3129\2247\310N\345)\211:7<@\366\300\273\255\037\252\245\021\024\366(vY[T}\354~<\365"
+	.string	"\320\255\316\fM\353j\217\235\217\247O\006\3049$\315c\327\233\253\242\331\261\337\361t\205\021\267\270&\354Nx\252B\212\233\022)\373\022489\252\245\221\034\373\334\031\035\236\022v8\236\236\220\344\247\254\215\335\215\247\356do\214\215=\312FfV\271#ZWi\354j<\365\272)\316!\3662c?\343\251\2112\267\031\306\330\311bh\243e\032\225\352\b\273\030O\2130t\013\333\353W\361\264\256\226F`\354Fx\352vP-\020a\377\342\251\227\001q\016\255\320\305\356\305S\257\333SA\213}\213\247(\346~N\200\262c\361\324\345\264L\260b\027\302S\023F\334H\250b\007\302S\017\223\002"
+	.ascii	"*v\037<\355\276A\347\320r\311l\247J\267\260\234d\236\372\315"
+	.ascii	"r\271\\.O\364\312\354R\314<-.\227\314v233'\231\247=C|\302\323"
+	.ascii	"\272Z\032-O\364z\373\336D\0245\035\347R\317\017\231\275\232\375"
+	.ascii	"\325\352a\325\377\311\334_\255\036V\371\223\230{\332L$\353\275"
+	.ascii	"f\"\022\327i&\212yO3\261\210\0175\023\225\\\251\231X\344G\315"
+	.ascii	"\304\233\353\314\026^g6\252\333\232\331\245~kf\217\032\256\231"
+	.ascii	"\325\351\272f6\247\357\232Y\234\316kfm8\263\231\235q\232\346"
+	.ascii	"\265\3526\232\327=\277i^\341<\247ymk\277\3465*\202\363:\304\233"
+	.ascii	"\232W.\022\234\327-oj^\265\274\331\274B\001\300y}^\3475\351:"
+	.ascii	"\257H\327y=2\341\274\366\270\316\253\321u^\235n\324\274\n\221"
+	.ascii	"p^}\256\363\232\243u^y|G\363\252\343?\315+\216\0035\2576\255"
+	.ascii	"\363Z\323\203\315k3\004\347[\330G\272/\224&\322}\373N8\337);"
+	.ascii	"\337h\2535_6oj\276k\256\324|\325\374\250\371\246\271Q\363E\363"
+	.ascii	"\241\346{\346;\232\257\231\3534\3372\317i\276d~\323|\307\334"
+	.ascii	"F\363E\3424\315W\314\233\315\367\2103\233oX\0176_#\355\327|\301"
+	.ascii	"z\332|\213t^\363\375\352\273\346K\244\353\232\357\220f\322|\275"
+	.ascii	"\256\363\355B:_\256\353|\267Z\347\253u\235oV\353|\261\256\363"
+	.ascii	"\205\266\316\367\352:_!\255\363\265\272\3167H\353|\201\\\347"
+	.ascii	"[\205t\276?B8_\037\327\371R\205p\276S\327\371J\235p\276Q\327"
+	.ascii	"\371B\265\316\367\351:_\247\326\3716]\347\313\324:\337\245\353"
+	.ascii	"|\225Z\347\373\\q\276I\327\371\"\265\316\367h\305\371\366\270"
+	.ascii	"\316\327\250u\276E+\316\327y\235/Q\353|\207V\234\257\320u\276"
+	.ascii	"A\255\363\005Zq\276?\327\371\362h\235\257\317\212\363\335q\235"
+	.ascii	"\257\216\326\371\346Xq\276=\327\371\362\264\316wg\305\371\352"
+	.ascii	"\\\347\213\243u\2769+\316\367\306u\2768H\347{\263\342|m\256\363"
+	.ascii	"\265\201t\2765+\316\227\346:\337\031\244\363\225Yq\276\315\353"
+	.ascii	"|cZ\347\313\\q\276\313\353\374\325\326\371\017W\234\337\360:"
+	.ascii	"\377\224\326\371\013W\234\237\360:?\265u\376\301\025\347\027"
+	.ascii	"\274\316\037\330:?\340\212\363K\271\316\037\245u~(+\316\377w"
+	.ascii	"\235\337\017\351\374}+\316?\275\316\317\207t\376\275\025\347"
+	.ascii	"\177r\235_\257u\376\274\025\347\307\273\316\177\207t~\273\025"
+	.ascii	"\347\257\273\316\357\004\351\374MV\234\237\311u\376%\255\363"
+	.ascii	"KW\234\237\356:\377\\\353\374r+\316\037w\235\037\016\351\374"
+	.ascii	"JV\234\377\355:\277\033\322\371\333V\234?\311u\376(\322\371\331"
+	.ascii	"\256\363\257!\235_\355:\177Z\353\374h+\316\177v\235\337\f\351"
+	.ascii	"\374e+\316Ov\235\177\254u~$\327\371\305Z\347?r\235?\f\351\374"
+	.ascii	"F\256\363\203!\235\277\310u\376\257\326\371\211\\\347\037\322"
+	.ascii	":\277\327\212\363w]\347\347B:\377\326u~-\244\363g]\347\307B:"
+	.ascii	"?t\305\371\257\256\363\013A:\277\325\212\363\007\271\316\017"
+	.ascii	"\004\351\374U\327\371\177 \235\337\307u~*\244\363O\2558\277\324"
+	.ascii	"u\376(\244\363C\2558\377\323u~\247\326\371\233\220\316\317t\235"
+	.ascii	"\177\251u~\245\353\374\317\326\371\223\256\363"
+	.string	"#!\235\377h\204\363\367\270\316o\204t\376\242\353\374\316\326\371\211\256\363\017\265\316/t\235?\250u~\240\353\374?\255\363\363\270\316\357\203t\376\035\327\371u \235?\307u\376\236\326\371y\256\363\357\264\316\257s\235\037G\353\3749\327\371o\264\316\217s\235\377\246u~\233\353\3746Z\347\257\271\316O\323:\377\314u~\231\022\234\277y\235?\246u~\346u\376e\353\354\325\353\354\207Hg7\274\316>\245u\366\302\353\354\204\255\263S\257\263\017\266\316.x\235=\020\351\354\200\327\331\245 \235=\312uv(Hg\377\273\316\356\207t\366\276\353\354\323\326\331\371\256\263\357\265\316\376\344:\273^\353\354y\327\331\361Zg\277\273\316n\327:{\335uv'\255\2637\271\316\316\004\351\354KL8\2734\204\263\323\231p\366\271\353\354r\255\263\307]\347\006@\321\027\r\355=\307\023\300{\336s\030\366\374\007M?1^E"
+	.ascii	"\332\257B\337\316D\265\3218\233<;\357<\204\324!;\337VN}P\035"
+	.ascii	"\034\357:\201\200_8\276\271\234\246\324\234\033\3579P\376\300"
+	.ascii	"^\306n|_9M\241j1\216\3437\3578\337us\304)K\221\270G\344{\t\023"
+	.ascii	"{\031\033c{\365\233\367\036\275Z9\361Q\325\016`c\343\335\346"
+	.ascii	"\273\3460&\257\314\306\253\340\264\367P}\342\311\207\001\274"
+	.ascii	"\246\346\275\246\373\003\326i~\255\251c9{\371\243\371\016r\262"
+	.ascii	"\243\316\310\274\317x\363]\206\270\204\310\244%\355em\215\355"
+	.ascii	"\325\233o\202\035\320\217\3070\337c\210sJ\301\250\262\320\231"
+	.ascii	"\257\202S\035\365\347\227H\336\214\n0\200\236\3627\370\330\360"
+	.ascii	"D\272\243,P4[\3708\314+\270/\253\357\3136\"\234\222\352w\217"
+	.ascii	"\023\035\365\320\360\373\360\215\330\246\024Lb\370\306\236\350"
+	.ascii	"\240s+\007\22264*[\370k\016\002\f@\247Z\265\341\237\\\203\250"
+	.ascii	"\013\277\243q2N\310\037\327]\370=\345/\037\rV\023\216\230\366"
+	.ascii	"\262D\006\264\227\272\026\316\n\277\2418\315Q\t\251\337\204r"
+	.ascii	"D\2621$\324\357 \2479(WL\017\n~\017\322\021\303^\226\220\360"
+	.ascii	"\322\204h\344\245N\004<0A\271@\300\357\300;\"\021\226\"\321\213"
+	.ascii	"8\344%\357\345\311\013\037\037\333k\003~\3578\311IYy\276\245"
+	.ascii	"|\300v\224_y\210YD-\026n(~\351{\371{\371c{\355(\337CNq\324\037"
+	.ascii	"\303>\341\364'e\361Of(\177\337P\242\020\257\204\374\371\365}"
+	.ascii	"\373\001\022\201$\253U}I\246\353\326\367\264\212m\276_\267\004"
+	.ascii	"\211S/T)\276(t\317u|\357\005a\373\311\273\216B\242\323\213a\323"
+	.ascii	"\023\252\336:\344[O\b\333y\277\016y\251\022\2370\314\244\274"
+	.ascii	"\357 '6(\336-\374\306\373^k\f\312\240l\337\375-l\022\215`f\234"
+	.ascii	"\304\"\230\032\033\030\034\034\266\327\276\373^\353\023jlS\234"
+	.ascii	"[=j\370'\263]\335\267\235\223\357\272\325\247\273\311\267\223"
+	.ascii	"\034\242\220\022\b\210\030\004\243\303\003\223#G\023 MS\222\232"
+	.ascii	"Y\320\360Of6\351\3143\227\256\232\311/\371f\262\203\250#Y\315"
+	.ascii	"\261\344\333\331\264'\245\373\226~\2275\335\177\332R\221\264"
+	.ascii	"\371\3149\271\3579\036D\0349rv"
+	.string	"\3208\270\3578 \342\215\r\3347US\035U\311\333\267\222\3572!\"\r\f\021Q\2068\003S\324\003\006\t\211\355\265\337\232\352\240\\\316f\0263\304@T\372\325\251\007\024}\317H\234\275\0239\022'\325\017\031\316\236\250\364N\324\023"
+	.string	"\013\022\244q6\335\332\276\335\236lU\312\241a\0335I\364;\311\022K\350G\035\214~\0175\315A\271b\330\326\276\331"
+	.string	"\245\354E\201\262FUK\373V\353KVU\3405\261S\230/#\2232<\276\275\264o\254&9(\332\3317\332\023\233\227\254\032\231\22491b\236!e\361`\242\036\371W'\026e\307\336\301L\371\200\251\n\302\366\332g\337CMqTgc\220\247\364\347]b3r1\b`\325\371\325\351\005\024}\315X\262\276f\3370\230\375\252\363\356\323\023"
+	.ascii	"\003\242\243q6\315\312\276\315\230\340\225};\233\330\250d\353"
+	.ascii	"\363\233\354=\2501\250v\215,\266\221\374\372\024\302\316\301"
+	.ascii	"@\215=eFrqH\330\304\216|\213\275\231`\017F\254x\344\273\247\351"
+	.ascii	"\214\032\206\363M\224\305"
+	.string	"&\201Y\263 \206l0\312\026\366\355\327t\0065\262\332\244\r1\317`\302\242\235\031y\0172\243\n\200%S\252\372\037J>\244L7|\241\005\242\330\257N$@\321\267,D\331\373\216\024G\313\313\205\262'\212\275\357\364\004\300t\004i\234M\260\"\337`[\254\330\021\2520#E\276\251\232\214|\021\371\376\352b\277\222\325\023\230\030f\bK\004\346\313\330C\006\345\324\032\342E\344\233\252\t\214\312\0253\304\353{\b\030\273\225\254\032{\310\230\264\262\274\276{\232\300\240\\1]\\\337]\337|0a\354\025+\344\207@\030\261\342\007\330^\233\353\273\247\251\b\225K\211\367\3263\303\224\301\234y\337\020\213|\363\030\301\244\261@`\326(8\"3\362\035\3143\234\260U0\321+\342/\260\246\220\365\301\376\200i\203y\203\201\223c{\355\255\367\034\275\2625\025\211Z\361<i\341\204F\002D\322\204\024\205\205\177\362QI"
+	.ascii	"\326\266':\311`\030:\230%%\230\226K\232\276\271d\217\243|b[\353"
+	.ascii	"\t\300B\315\260S>\025\271q`{m\255w\034-\002\f'h\205\024\372\222"
+	.ascii	"\375\332\366\310'\216;\032 \315,\254\357,\255o\254w\034\r\001"
+	.ascii	"0\034}5\207\001\370'\037\365RX\341~u\212\201\242\357\330Z\337"
+	.ascii	"\261w\234\032\016\245\236T\030\373\025\356\221`9w4\316&\364\352"
+	.ascii	"\033\332\204Uz&\355\\\035\t\241Z\005\371\266\252c\213\234D>0"
+	.ascii	"}+\360\202\b\001\371\346b\352\203V\375\370\256\372\346\273c\177"
+	.ascii	"X\\\300\343\031x,\017\230\274\026\230\030\346\t\353\003\303\307"
+	.ascii	"\356H\016\301\364\255\250\321\305\366\332?\336\205<.\266\207"
+	.ascii	"\315Q\243\213\033\212a\376`\242\300Da{m\037\3578\275r1M\251?"
+	.ascii	",45\223\244\360Of\252\251o*V\007\307\321\324\r)j\024\324wT\n"
+	.ascii	"\326\306\006\023\324w\221&\226\346\351\333\215\351\016\352\324"
+	.ascii	"\364\355\3046\225\202]\204\t\006\220\215\201\021\224J\346\264"
+	.ascii	"\300\324\364]\244I\215]2}\2731\331-)}/\301PWC J\205\317\272$"
+	.ascii	"\244\357$\230\302u\020+\231SDz#W\340\221\023j\017\243\357\036"
+	.ascii	"Q\240x\031\375\fy~EtN\242og\212\225o\317\b\221\336\020U(\350"
+	.ascii	"[\350\316\216,\350ihr\002\364\235\204i\016\372\023\363\303\343"
+	.ascii	"\373\347\273\354\311\326%R\265d\016\013x<~\206<\2659\237\357"
+	.ascii	"$Lr\324\237\336\241\343{\207\341\n\247\024t\323\361\226\343\333"
+	.ascii	"\215I\016\332\303\363\335\003S]\223\314\361\260\355Pup|\3530"
+	.ascii	"\3274'8\316r\276\2230\305A\177bn\340|\337\370.k\256d\320\244"
+	.ascii	"^2\247\210\363F.$7I\230\332\250?(\374\223\215N*\326\275_\235"
+	.ascii	"R\240\350\213\004\3117\224\025H~\335\373\f\300n\356h\234M\033"
+	.ascii	"\033\3376\337|zk\030K\rL3\253\021\277d\216\0136\276\206\246\""
+	.ascii	"5\3576\275\3161%Q\361Of\232\231o\232!,3\340\325\254^\201=\363"
+	.ascii	"3\344q\265L\263c\276\233\337e'\254Y,4$mV\254$N\021\232\234\222"
+	.ascii	"\314a\001o\271\\\332\300\366\3321OC\223\332j\265\n\261\201\033"
+	.ascii	"\212\223:I\036\036\266\327f~'a\212B\177l\372\304\321\2324E/k"
+	.ascii	"|/s\254U\311\252\217\365Gr\007\217$\020\020\333k\215\357 \246"
+	.ascii	"\263#,e\362\225\337e5\2071BkT\262\372\264B%\211\212\222=z\260"
+	.ascii	"\275&\251\230\314\312\232Y\234\360O\346$\230_\223\220V\246%\030"
+	.ascii	"2(\322\313\257H\3175\t\351\345\333\212)\354h\255o\025\221v\371"
+	.ascii	"\365hi5J6\025\227K\231\026xu\256E\311\247\250\344\324\024\333"
+	.ascii	"\253\313\367Z\257VLaP\017\322\314\002\005\003\374\006\266\330"
+	.ascii	"Q\016\017k\023\325B\023Zh|\313w\331\t\236F/9s\262*\031\304\373"
+	.ascii	"\346\004\377nU:is\206\t~F'A\223Y\3367&\370w\253Fi\332D5\355\204"
+	.ascii	"\214\217\3612\276a|\f\225\346\200-\301\303\370.\243\301jn\255"
+	.ascii	";ZT\350H\202\221\220\243\004\337WES\352\017/\376\007\037\376"
+	.ascii	"E\327\272\243\203\303\207o ES(W\fK\017\317\362]F\202\357"
+	.string	"a\310\212\323\222\"\371\265\336$\301F\300[m\2546\3110\261\344\330\030\333+\t\276\201\024\361Q\277Y\rb\342\237l\001\026\tk\365W'\030(\372\212\211\375\b\276\247<\374\b\276\313V\032\226\342*\263\316$\317\322\222kkl\257<\274\327tG\345q\305x\265\004\261_\253O\242\311\224\276\035t\370\035D\360:|\357\255\313\226\303[MF\333\222ool\257\"x\257\351\023i\207W\316-\022\376\311\024 \021a\205\372\2250\204\013\245\357\221\3079\362.\336\217rx\027\3379|\3570j>\323G\270}}\217\374\n\365.\323\253\233S\260yg\304\331\364j\215\035\351\3143\017\247HgP\264\222P:\363L\345\240t\206\273\006\017\3533\3358\302\004\251\250~3\317\274\"\264\b\301\267\370.K\302\325\250\361\276\t\301?Z!\334/\025\276I\231n\030\302?\331\250\007\002;\363+a\t\030\307cZ\345\b"
+	.string	"\335&\330\033\366\354\314k\360\265w\347d \340\360 x\034\232\307?\360\314I\272\344\022\357\033\020\370\335=>+^\275\373$\331$Y\227\274K\336\261\275~\340\225N>\252\232\007c^h+&t\252\342\234\313?*,\222\316<se\257f\277 \365QX\342\237\327\256=\360\036\3308\336\201gN>I\362y\337x`\365\371\016\274\307t[Vs\030\366\253\317\263\337@\211\361\352e\257f\013\200\007\263\007\211\177rc\200\345\300\367Q\262\217\003\3571\235\001Z!\221\264\371\314\017\b;X\233\277:\315@\321\327\310-\352k\344\233\332A\252\b\241<0\362k\3635h\242W\245q67\240\201\337\300\337e2\350\314%R\r\320Ao\310\300\337\200\201\317@\224+'\305\227qp\030\230\273\200\005\376\002\025x\013"
+	.string	"^7\277j[\222\n\314Q`\002O\001\301\273\266w\250\2266\0019\tD\340%"
+	.ascii	"\201\217\3007\365\232)y(\350\001\210gXF\006\0019\350\003\034"
+	.ascii	"\360\017(\274bN\246\034\ts\3007\2333\256\001\f\370\006|\363%"
+	.ascii	"\ro\221d\225\202\036\200\322B\346\031P\356\227\222\371\310%u"
+	.ascii	"C.\021esFYc\303"
+	.string	"\366\312\200oj\257l\3168(W\214W\347\316\332:\370'\033\2038X\243\277:\231"
+	.string	"E_\260\307i\322\027\354\373\257\215Sf\026L7d\022\365\030\001\366k\3643@\312\273c\200/ \006V\342\334-\022\034\323"
+	.string	"\231\006\265\262\026\360\215\345\214B\025\220\200W"
+	.string	"\002>\0019\367*IP\210\025\002\250\\1\0070\300\037\240"
+	.string	"o"
+	.string	"\235[\245\3449\016\0014\n\374\341\243"
+	.ascii	"\337WN6(\001\006\360\004\260\341\007\220\343JM\001\214\202\262"
+	.ascii	"\201\312\242\206gA\303\327\260\3436\rJaZ\242\341\033\313y\006"
+	.ascii	"\345\212\231A\206\237!\206\227\341[\311\343&)\201\216iRdZ\350"
+	.ascii	"(\3143\244\\$\245\220\227\3501%\254Kk\271"
+	.string	"\\\276\320\343\036)\211\212\224=\220\330^c\370\376\353\025\313iF\345\212>A\031\343 \006\277\200\355:\225M$\230\226\313\230\276\341;t\211\224\317%eSS\037!\254r)\335k\335L\204>\244\033\374\223\217X-\221\354W=\021(\372\026!\"\371[\344\373\360+N\306\t[:E\347\013Y\344\211d\3376\301;\243q6a\020\300\303\360\302\013 \360\376(\237Z\300[.e\242.\017e\220\025x\313\245\314\216\353\243\234\202\262\275\276\360\335\327\253\022'\030'Qr\302\327\272\360D$\357\206:8\337\034\312*\357\233\274\203\n\0320V\320\200\241\001\357\240\"\206\f\037\\\260\310\210a\202\021\344\200C\t\336AE\f\0279\274`\371@\013\030+Zp\300;\250\210\361b\006\f\0271Vt\300;\250\210\261\203\f\034XV\370\360\202\205\345E\213\0212|p\301\342\203\016<\364`\303\013\030-:P@\343\305"
+	.string	"rpA\002\037x\350\301H\343E\b\276E\373\340\242\001.Xp\360\201\310C\273\350\001\207\0261\326\034^8@\306\016:\360\320\203\b,\210!\203\207\001\350\200C\017\"(\312\360\301\004/\b\340BFK\b\2141t\300\241\207\003\270\350!\0048\304\340\241"
+	.ascii	":\370\300\003\013\f\0342\220\341\202\0021\024\340\202\205\207"
+	.ascii	"\n\270\220\201C\001Z\310\200q\201\214\034\334\207\003\304\210"
+	.ascii	"\341\242\305\013\030\021\220\021\343E\004~\210\301r\201\214\030"
+	.ascii	"9|\013\0301>\002\024p@\016,-\330\0261\\\024\240\005\214\030D"
+	.ascii	"n\241\342\207\030,+~\210\301\262\302\007\036p`Y\321\002F\214"
+	.ascii	"\025*D\360\213\037\\\300X!\343\305\013\030+\216\314\314^1\375"
+	.ascii	"I\354<t\327`}\007e\327"
+	.string	"`o\364F\277\307\272\265p\274-\251~1\337\274w\271\\.G\360<|{\316-?\"^\005t\212>\361\320h\036\245W(e\272\341\016/\356ryT\203?u\373\021\361\252\016\377d\356\342\372\333\025\346PJA\256\357 \2546\352\226\326\337-1\2556h\026\326\337\2541,*\364\352/\264\354*\tT\210\325_!gVT\256 @\376\006Is(\026 \337?X\321[u\177\374\255z\247\261\346P\367\307w\020\026\233\b\376\351\343\373\310\243\034\312\307;Tg \246\227&\225\351\023zYR\246\033\272\370'\227\300\221f\326\342.;\204Y\032\216\020p\263\260\227\355q\230\212\355/\325\263KMg9\374\263\305'\335\251\207\361\245\027\365f\3534\032mE\032o4\340\274o\356\324w\236\036\017\251\3143\245\246\177\245\276\327\332\030\305\336\250\277S\020l \2424\344\270\241\230\006\035\215%K\330^o\324\253"
+	.string	"\255R\177\246\332\315\272\244T\277\020@\335\247\277P4\232\200H\003\201v\237\276\177@\331\250NM\177\235\352@\224\201\030\003AF\343\216i\344\321xB\343\t\333\353m\372\266\202\232]\246\273\364\227\211\006\037\210#U\020aw\211\013\032F}\322\314\002\207\1772+=\377*\365\201(b\365$\222T\245\"\035\375E\372\003\321\245u\264\325\343\333\352j\n\324\250\350\257Q\024\020XD\212\336x\345\374cU\230\226s\213h\350/\021 \210 G\206\336\310U%\324\027\004\3647H\020\004\225\031\320\033\271\244~\250<\256\317_\036 \236\234\330|\230vL\241:n\216\277:@<\223\224\3448\352\241\376\\\236\273\363\227\007D\021\013\013LL\203\n\302\231\304\221\302\364\245\300\333y\026\232\324\206t\276\255\256\370p\344\374\305Q\b\002\310\016\246\257\230\363F\0367\276\255\256\366\24087\177qt(\005g"
+	.ascii	"\221\243g\357\346g\330\261\271\203\332\250\371k#G)H\003S\n\020"
+	.ascii	"7p\240\324<\rM l.\215\035\365\316\310\374\2351\004A\243\024\234"
+	.ascii	"\341\004\02030y+\340\201\2209\301 L\237\n&\231\237!\017DL\363"
+	.ascii	"\373\352\312\356\306\\\346\337\030\032\325c\365\004\207\227i"
+	.ascii	"x\227N\240\325\303\377*\363H(s8h(G\235R\370?\245y\004\274)\214"
+	.ascii	"B\330F\035\374\247\316\034\375v\006\247\202l\201\200\377\201"
+	.ascii	"5\307',>\200yR\276\255\256\316\260\2443\317\214\002\345?\212"
+	.ascii	"\315\261n\bJ\223\277o\253+3&V\322\231g\372\365\375\373\341\034"
+	.ascii	"\351\216\372\344\246e|{\377|9G%L{nO\310\250\2443\317\324\313"
+	.ascii	"\373\327\3239\262\261H\345\251\341}[]\205Q\177\356\354\376\357"
+	.ascii	"x\216g4\200\330\035\313\352\276\257\256\302\234|\223\177'9\216"
+	.ascii	"H\224\202XM\2160\371\276\2722\362#\235y&\023\037&Lz\2443\317"
+	.ascii	"\\\"\375_\262\3438\204\305K\332E\367muUd\356\345\376\347x\034"
+	.ascii	"\265Xh\030\221;b\305}[MU\247\020\016\212u\t:^\237\350\002\224"
+	.ascii	"\202\340\237\314qJ\264\272\272\n\251\340\224\374\303\001\035"
+	.ascii	"\243\310\224<\275Q\177\334\332\376\335\204\216LJA\2656\245$\337"
+	.ascii	"WSs\320\237(\333\177\224\350\210t\304F\345ZS\373_+:\026\301\020"
+	.ascii	"9\325\276\235Sr\3204\264\377\264\036G!\026)\032\320\331\267\325"
+	.ascii	"T\034\364\307\254\354\337\f\351\350\243\024\244aWv\324A"
+	.string	"\366}5\325\006\375\031C\362?\366<\362\354 \241\212\035\371\027[:\346$\2537\216|\017M%\201\206\031\371\017k:\332\3300\002V\344\037\254\3538\003Ct\224)\362\355\234\212B\271\276\210\374\177=\035\227\311j\225\310\367\320\024\033\224k\210\327\377\220(\225),K/\302\256o\253\2513\352\017\327\326?\327\224\212`\340\326\267s\352\f\312\245\225\365\257\345C%\n\224\254o\347\224\031\225\013\013\372\217U\245\322\207\003\312w\365}5e\006\375\021b\365/$\210\212\236\016+\274 \337WSe\324\037 U\377@\204\250\3249\251\372vN\225A\271~\370\370\377\361]\006UY\002C$\365\361\355\234\"\243rQM\375Se\251\310\035M\275Q\005\356\245\276\257\246\310>\352\241\376\243Z\266T\334\330\035-L0}\017\365F\225$\377\364}5\025F\375q\372\246\177\247g\372o\352RY\203!Rc\232\n\253\373"
+	.ascii	"\r\315Q\226K\207t\346\231KJ\377KCT\312\306T\310Z\276\300Z\302"
+	.ascii	"\302\330^_\351\233j\252\310?\223\376\237\337eb*G\222\325\260"
+	.ascii	"\244\357!\251*\025\351\350\037\351\377\350{L\245\210\022\350"
+	.ascii	"\253\307\267S\252\n5*\3727*S\361\202!\352*\372vJ\035R\235D\377"
+	.ascii	"\3163\025\255,\242C\350\220\320\377P\232\312\225\020\241 \240"
+	.ascii	"\377  U@\337CR\206\320\037\036\377?k*TSR<\276\257\244\246d\371"
+	.ascii	"\275\317\357\370\367i\211\25285\375\216o*)\301\327\221\343_G"
+	.ascii	"\233\212\022\f\221\n"
+	.string	"\274g\013\335\tLI9\276\261\244\004\241=<\377=o*=\214\212x\250;:\377;p*C\311\252\n&n\221S\021j\241+\001OF%\350u\276\257\244\002q\344\374\343X\242\302Ce\207\212OK\023\256k\271\273c{\375\234\357 )\300\0338\3777\362Tzx\036gH\n\220I{\340\237|l\363\341\300\312\365\037\214E\3156\260j\375]{\034\276\261\371\277\301!E%\307f\017j\243\346\337\206\312\215\212M\013`\261\346\033K\352\216f\346\237F\205Fef\346{H\352\016\3722\376\363/\363\356\324\030\224\371`\277\371\376\3637\316\334\302\327\322\347}\363\315\377\264, i3\346\231\3771-\177\306j\262j<|\346\367\017)'Y;\277\\\373_>\373|R\355"
+	.ascii	"\341\240\221\312\\?C*\216\003\377l\211b\f\224b\004l\001\\\201"
+	.ascii	"i\271\\\266\b\266P+\350\226B\266\327U\353gH%\331\300?\331\256"
+	.ascii	"\275\372\237\307-\206F(~\306\277\226*\323\245\331\254\276;\365"
+	.ascii	"%\224\212\ni\340\237\314\207\206\357\2073F\276=\303o+\2512\352"
+	.ascii	"\224\302\367)5\306<\274\3022(!\365\235\320\306X\347\204\372}"
+	.ascii	"%E6(\370>\210c\\\222\254\322\031\245.9:.<<\202WRd?\315,n\370"
+	.ascii	"'s \340{`\016c\034\034\240\021\250\224(\357Rv\030\335\332\242"
+	.ascii	"|[I\201A\371{\207\302\303\310\006C\244f\\s\001\022r!\"b{\365"
+	.ascii	"?)0\350\216f\026\031(2\224\312\364\t!\205R\f\374\223\331\257"
+	.ascii	"\357\335\257\207\321\f\206\250\254\357\333*\np\372|\357\323\357"
+	.ascii	"2\027$\347\373O\023\"DM:\363\314\275'\357{Oc\230\021\314h\304"
+	.ascii	"e\251\311\345\351"
+	.string	"\211\355\325\237|\003\211\222\322%\245\353\023B\262.\220\347.S.>\204\004\221\312\214e\355P\375,@\001b\321\257N,(\372\252\251\275/\265qZ\001\265'\026}\006O\262;\247\300?\231\365\362\336\365\252\214]\\[ZyT\274\273w\274 F\350\225\020\253\273)\324\256\356\335N\210\261\352\207\017\252:w\322\344\335\t\324\030\225\254\322\300\004\345\022&\003\336\223\313\230\n&\247&\337\203P|P&\276\344\235I\226q\t\206\210\006<%\227\260\031\230\236.c*\360\222\226|\023B\355Q\327\036\2764\305\272\364\327\036F.`4\024\271\204\311\340t\031SA\344\322\357A\250=\350\004\234\313?\242*I\300\351\276\217\276\364\226\270\317=\263K\227\313\020\357\033\247{\013\270|\031\203\\\300:\214i\271\224Qb\004r\tk0\274\345R\306E\314\370\3432\346\202\321\307\310\303\245\354\314%-\215\355\325\347\336\227\372"
+	.string	"CPv\021\370&\315F\035.k\306\034.Qc\325\016\032\004\344\342\336\345\332\214:F\034q?Ps\\\315,\036\320"
+	.ascii	"\342\315\257N>\240\350\233\226\366\016\367=\375R\362\016g\274"
+	.ascii	"a\304Q\362\216\344\200\264'\336<\211:$}on\357o\337|\353\264\355"
+	.ascii	"\335\215\203$\357m\321\367$\177\353\336\2143\311jc\300\244NK"
+	.ascii	"\311(clz\364\331!\2506\252\263\371\332;\233\013\234q\231\254"
+	.ascii	"Z\320Sw\365d\236\021W\254\272\310]\021\177\200b|E\303\342\241"
+	.ascii	"\013\335\022\227&uk\357H\275B\201jk\300?\231\325\322\336\325"
+	.ascii	"\356\212\204\32446\264\263w\264\274b \f\021\340\331\267\025\024"
+	.ascii	"\033\324\254\354\335\354I\021J\262\372W\366\r\004\352\214J6\366"
+	.ascii	"N\306W\234\302\020\361\215}[A\235A\221\210\275#\351+\352\345"
+	.ascii	"\211}\003\2012\243\036\t{?\342\362W\264sR\254s\211\342\002\350"
+	.ascii	"\"\350\"\030\006\004\312\f\232\204\001\377d6\002\366n\304\205"
+	.ascii	"Z\\\"\005\373\376\201\n;\362\030\025\371z/RX\214\203\373\242"
+	.ascii	"\022\031\362N\304\260\350\3266D\020\352\325\365\356\345R-\262"
+	.ascii	"\255uqm\275s1\213h\311\352\331\326\367\317S T+\353]\353\273\254"
+	.ascii	"Y$\033\313\372\376y\002\244bA\337\261f\212G\302\240R\256\204"
+	.ascii	"\274_\325\024\213$\253_B\276\177\236\244hIg\2369\205%\235y\346"
+	.ascii	"\324\225t\346\231VA\336\255\210x@\336\203|\3238\233JA\326\253"
+	.ascii	"\336\201|\323\374hz\225\375\307{\325o\300gS\314\302\372\361\035"
+	.ascii	"\364t\007\365A\365\356\003\247(\304\212\212:%\365>\225S\254J"
+	.ascii	"V\177H}\377<\331A"
+	.string	"\243\240\336\243t\212SRPON\357O<\305'\030\"'\247\357\240\247:h\023\323{S\216\342R\262\252\304\364\375\363\344\204\272\244\364\276\264\243\210t\244\344\004\372Lz\177\362(\0269\223\220\216\336\221\200\212B0DAG\337AOt\320\036F\357=\204\212<v\024}^\210\212^z\3640\372y\232\243f-\340\237\314E\316\367\"\244b\317\313\223\307\235\337\316\2478\252\023\371\320;\321w\331\313R\021G\361F1\347\245\351\351%*\212\355\325\207\234OqP\277R\300?\231\205\202\336\205\200\336\203\246\21266jh\200\236\265z\212R\271x\370\274\363\370\336\361\356\363\355\243\330T\002u\331KU1\346%H\033\341\027!E\346\013t\005&&V\213\313\227\254\255\227\256.\266W\337\361?\344\230\234[\\A\232Y$\340\237|\2749\300*\364kP\2122\250Dc\026\211\f\017\351b)MA\205\324\324H\003"
+	.string	"\022\323\031"
+	.ascii	"\b\306\3418\320S\to\024\200\016NlL~^L\037\024\223(G\3418\031"
+	.ascii	"A\002\300$\001\343\005>\r\322ze\236y7\271\236\330\347\364\367"
+	.ascii	"\247\030\023}\224!\026[q\364P`\363\370\274\253\017\354\304\253"
+	.ascii	"\312r*\355\016\034\024\254\002H\203H!js\235\360\262\363\357\262"
+	.ascii	"=\004!6\326\373jv\332\260\324\343\"\350F\371E\rq\007G'\220w\242"
+	.ascii	"\f>\367\241j1\261\340\330\377V>P*\211\270\006u3\3633\346m\223"
+	.string	"e\376\022\367z\276k\346\237\251\347\377\231kI\216\351\030\305\203\215\355\035\300\325\213W\374\323\267\263\3543\316\221\301iY\203#\022\r\233\022\233\220\224\1779\025\337\370Z\321?i\026u[s\374\3743\363[v\005\262\303\230\025\206\362[\0306\267\333\t\236\303\205\350\300\024`Jw\314jc}6\n\370.\346\352E:\005@n\230\3276 \247h-\303uO\334\025\013\345$\001\n\230'<\016\027\234\251G@j\244z\b\036 \307\027WY9\030\374\301\025;R\250D\216\036\343\016+\2734X\004\215T\316U(\207\016\252E\257\371,{\354\277*\250S\305\024\352d&t\376\301\2100\353\n\217%\006B&\340\317\360)P\002E\005+\b\nr7T\337\374y\tM\271{J;\223\221~g\3235\267{a\200O\215aPA\211\023;)\360'g\331\266\240\341\004\327\375\373\201\251\301\277=\341\340\2438\327l"
+	.string	"t\352x\201#\302\037\002D\007\363\263`D\261\341L\336o\"\305i6\225\357\240\312~\2279\304\252\227\313K\370\b\210 \307\036{jY\376\020\373\001\333\3721y\352E\274\350t\340:I\251RF\207\276\270\323;\t\203+2\023h\355\210{He\300/\310\370nw\313a^\200\274\376\325@\360\324\332%\343\347\304\035\027\340\002?\332\355\273t5\357\331\0204\2043\337\360\022\004\236\034\241\265\242\273"
+	.ascii	"(s\237\007Tt\2126vI\315\210_\002\360<A\262\213K\3106\272\224"
+	.ascii	"I\223{\235`H\206$\030\325\304\323\370\342|7\275g\257\305"
+	.string	"\025v\316\224\020\305\217V\006iY\013\347\327[\255\245\260\351\"\"\002\243\255\343;0F\210\203!{q-\306\357\323\217)\203\220!\0330\344\256\315\227\344\244\330\3019V\215[^{]\022bHd\210\376\nFiY"
+	.string	"L\360\302~2-Z\n\233\3211\335\366\200\330\002\013\235\3725\006\376\"\307\363\2063\f\302J\035\234\337\013\0270\345n\360\227\307x\324\275\363\246pn\364q\2060\n\360\004\226w\nbh\270G\351\320(\306\236P\206T\376\026\2421\335\347!\\\245\267M\243\262\r_\016\227\030\202JY\r\356\001\367\354\334\br\017\363\006\331"
+	.string	"`\216v\364\205sU2\275g\340vu\200SFR\013z\024\034\261\020w\343\0344\212\317f\322oV\246\373\326>\020B.\301X$\230\360\342\025Z\214\373z\342\352G\257\331\344\303\225\201\275A\261\247\271\226\331\353\312\240+\220\305\346\272\3658:\223A\274\b\273\230=+\016\2312D\305\033p\241\335\242&\217)}\310*fKH0\357;\202\334\024\311\336\214O\026C\217\244IrF\213\215\bnS\370T\313\rG\220\337^P5\357"
+	.string	"W\215\r\314h\277\357\2608z\207d\202\334\032\3329*\"<D\313\326\177\251\203e1/@+ \031\300\361\270\361Qr:Y\354\230O3\2462.\245mkcg\344\206\213_\t\351f\357\002\242\265\023\023\206\253\3554\310\020\0233{\212\267\344\251Z\312\241\266W\357\275\004~\215>qj\331x:\351\n\304\265>,\201\352\374>\265*\335\020~\350\305\326\364M!\364 \247\342x\277\220\216\242\260\315(\274\321-\322\025i\027)\334\030\304\222\273\034\005\321rL\325\375\003\375\224\215\310\273\252\020\224/\334\312aK\234t\244\260N\006\023a\247\224U\222\306\361iaU\205\376\335\214\300\352\322I\324\343f\250\352\311pnO\341\334\026m\243\342["
+	.string	"\034\330\356\026\263\220MVMy\211,\235\225M\324\021\367\211%\313Dv\304i\326(\272\311\320S\274\024\267\367\310\255*BX\374!\370O;\306\236\330\f\356 \221\212\342s\345=h\312\t\335\n\224\356F\313H\321&i<\317\303\016|w\327\214\210\340\"\352\244G\262\334\005\212\250E\257b\325\213\004\027\276\251\217\365\342c<\210\201\346\026\351O\345%ddC\240vyPJ\263\205M\205\031D\001T\003\260\027\246`t\265\302\236\240'\211\373\023G\320\\Yx!\274\237\366fm\230\033D$\362\272\242\212b\b\242(\203\316\344\2739\273\334\247\036\2215=\\\035Nq\254xO89i\305\353{\232pR\326\303\316]Ao\374\004\364\376\272\363V\255\201Y^\025\345\032Z6`z"
+	.ascii	"{\024\214$\225\035\222\367\325\013\255\353\021\"\026\365\261"
+	.ascii	"\347\272\376\371\020\273\264\214\355\261\315\267E\314cW\214/"
+	.ascii	"\305E\365\331\321\220\r\247\005\347\352\257\376?\036\361\021"
+	.ascii	") I\2210\r\2248\312'|\355p)0\314\265\276e\3366\037\344Ssf*S "
+	.ascii	"\260\330\214\324H\251\027\252x\322\021a+\241ae~\313\362\031b"
+	.ascii	")1\267\342oK,\316\260B\301Y!\373n\235\364\223\305\254f\262\216"
+	.ascii	"\257B\230}#\354\374$V\301\317\034\322\357\254\371\261\032\222"
+	.ascii	"\362I\021<\242$@\232P'\034\341\"\320\031\324oU\365\025\024\306"
+	.ascii	"VY\302L\374\312\364\034\227\001\246\203M\326-\"\354\306\365\370"
+	.ascii	"\351\274\376\324\264d\260\321=\201S\245#\324F\016W\360VB\372"
+	.ascii	"\\"
+	.string	"e\335/\224\203\025&X\263\210b\021\372[zR\350\n7K*m\200{\342\234\207\364.TY\020G\315v\250\327-\356\222A'\247X\262hp\fjF=\354\2540\216\020\016\306\205\254\221\333\030\270aH\013\375B\n\232\207\242\n\021\242\352K\274\030\013\234\204\250z\353\260$\005\243Z]\"\347t1r\261\333K<\365\230\300R2\256\371\032\232\300\002\037\367\221\026\006\374\2344\226\3223\335m\233T\013\376\246]\3260\247\324\3429\213\306\222\2510\330\250\345\003\253\020M[K\310\261BN\202\2650\022\244Ye\340\013&\006\275R\271/\205\245\006H\241FU\244,\006\353\266\203\345\332C\263S\206\277@\027LN\032\227\226\222R\025\326[\272\013\373g\310\035@o\327H-\311mH\317\352-\342\303zY\354\r`\302x\357ts\350\024\376\267/\3030\206\213\227$\241Mr(p\221p\306\272S\370\242\323\231"
+	.ascii	"\355\260\370\\\242\330\026\205\362*"
+	.string	"\022\0379\363\253\302\210\217c'n\2001(\357f\264DH\303\025bq\334\357\002\254\226\264!a\005\201\343\005L\331\256A?\256\005$c\036,\352\342dF\274!:\222u\206Jk\"\334$D\303\t@\323\210(<\273q\264\177\214\360T\223\027\251\330\216U\240<\364.\317*P\f\364^7\334\332\301{mFj\320\311\031\002\345\003\003{={Q\354H\\6\336\303\220\204\263^T\342\016\350P\210\215xNO\314\031-\005\254\r\020v\307\373\234O \t>\250\251\302\217d\321\313\200\327\315\034W\227h\013\3442\304\t\245\nk7\033\227F\021i\304\030\217\240\022\344\240/g\326F\fQ\237\024\006\370\324\275c\365T\213e\026\235\302}x\243\207ome\243\276\364)A`rD\204d\315\222`V!\246[|gh/\323\230N\345\321h~\217\213\301k\007\315\002\322\tj\003\245\020\362@\251\335\026,\t"
+	.string	"L\311\327\266\335w\213\350\221\322\235\177\b9\367\210\221\013\332\347\236LL\024l\260\363\f]\332\031i\376\315\317\0058\261\251\3367\331\265\034\003\224\317f\364\230E9()\251`\021\004\001j\203\331}\357+\330\245\216\323\271M(b\r%'\265\020h\247\332\344f6\033\300<(E\372\272\347\031\214\300%E\017\003\337lv\254;=\351n,I\334\223}\301J1MgZ\245\020\245\037\241)G\224R\215\337\365(\223~_I\036\030.\332iU;\021@\226\207"
+	.string	"\004\317\003\037j\317\353\304#\367\337\232\207XY\313k\004L:\035Zz\314t\345[\321\322\266\352\227Dn\370\226I\340\301\245\267),FQ\265\354x\220$*\026\266\017.P\243\256Y\322\b\247)H\346$d>Kq\b\277\326\357.\212\261\016{+\232\275\257\002\020\220\316R\270\361\017W=zw\313\241p{\030\213\314\032\363G\033B\313Z#\357b\307QM\312*\226C\033\314\353\0054\351\021S}\211\305\255~\022\027\344\"\300\216\357\002\360\242\017\21564"
+	.ascii	"\303\335\337\037\2416B\312Q \325\223O\252A\261um\302U\211\006"
+	.ascii	"b\363w-\204\245\277,\240\254\333^t\035\321\376\3262\222\360\274"
+	.ascii	"of\302\242\315~3;\2753ey7V\243\242\277\235%\333\021D\250\317"
+	.ascii	"\374\363\333w\347-\263\236_]\256L\347\f\377\023\032\365\206<"
+	.ascii	"ud\226\375\340\0018L\016h\253\370[\"\343\232\340TT\256x\236\003"
+	.ascii	"O\\\tn\377\230\257\262\323\005\356@^\017\330|\262 G9[\206\337"
+	.ascii	"\355\235\031j S\227A\223\2359\231\255\272\200%\222\272\353\245"
+	.ascii	"\231\037\276\036\200d\364\200h\372CX\327z\323\243\2371\211\320"
+	.ascii	"y N[\240\360v|\033\035\322e9c7\251\2063^\007\303X\2508\3068\260"
+	.ascii	"\225n\342\273B\022\264\220\356|\n\327\327\323h2[d\232)\303\356"
+	.ascii	"\243\360V\313\020\246rGc\375\020Q\325\355g\027\243%"
+	.string	"\203\"j\004\371_\n@\271\254\361O\341\t\304o\316\334[<\f\247V\0232\264*\035w\2422\034(\322\030*\240\265 c\363\001\325\334\004\345\343d\216h\2231?q\246\031\271\b\346\302m\264\350Gt\355x<&c\317k\255\007m\264\030\356\202\261\200\t\333\216jwX\1771\361\332\266^\252\031\0329\275\274Y;\254\205H+x\361\220\317\230=\276\2525\353/\370/\275\251LGU\262%\216\221\306R\226\347\264\215\002\250\350\213\366\353\260\n\374\001\026Z\341/\371\323\334\276N\332\361XY?\t\t\227D\374i\234\377Y8>[\0023\013:\203\235\370\347\355\335\271%\202\025i(\235&}jb\215\252w\203\022n\213\254\302\237Bi\217Gm\304O\347\361T\013\346\246=\265\307\b5G\0227\235\306\255\334/.\017k\246$\033\363\352\323\235\276\tp\236\336\347"
+	.string	"f\306\303\365\343\007'\020\nGV\bM\367\270/\301\262\362\256\237\206[\343\333\312jx\2263=R^\\\224\220\020\027\253\355\256\323\242\332}"
+	.string	"\027\273\360@`\227\251\003\021\232\311\026\264\340\204\323X\203\177 \255,MZ\224\300\035\307\007#\354\031\n\363\275\216\201v\347\356\270(\306\316R\301WA\3760\001Z\321`\360X\001\276h3\252\210\225\371\210\306r\346&u8\340\326\275\367\201\333\362\b\330\315o\230/\375|\177o\334X;\345\266\265l\031\007\"YGW:n\336y(\203\346\036\016y\001\202\350\306\2567\005\016\310w\216\017\355W\034\2402\331\004\356\374jw%\234\225P\267\345R|\360\300\224\221v\315\346\210\013{[\374c>\366\230\252\023\177k\340V\375\021\364\333oh\370\305Ju\377F.I\302\377\224\005\373\""
+	.string	"[+\336\325z\223d\315/q)\236\344\374\235\243\364\017\230MO\241\205\216\300|-f\253\343\357\330x\200\312\247\262\021_M\374\036\303*\360\350H\332m[(\017\371\006\036\332\016\324vI&\367\233\234\225ipB'\231:\365U\341Y\240\321\242@\b\275:\311D\213H\227\255\2070\226\302\237-\261\2013 \256@w\221\366\306c\253=\372Kj\326@2\002\330G\375\035IP]\332\301\017|>\200\001m\354:\203\034\225\231\224\272\256c\344\361\231\251\030\034\217K[\021z\210 \374\207%C\016\220C\310\274\240\211\177\230`Yw\002\2544\220\257\fb\033\310\t+\205s\026$\310*O\244\366\327#\"i\220RA\322\247\233\016.\223\302\330\034\232\330\bK\351\307u&\\\376\210\375\236\306'\274\026\222\364\331G\327\021\226\307@\354\231\221/\0242+\314\222+/:m\n\020e\256\n\231;\317\023\252_U"
+	.ascii	"\266\032[\250\344\215\320\360\206\b\n\037\302x\215\242\257\310"
+	.ascii	"\270\374\233\270\274\021T\257P\203\225\211nL2uD\373\020\251\263"
+	.ascii	"Y\225\3424\223L\215\023\2177\n\310\034\315\213\323\371\007\004"
+	.ascii	"\267\210\223\306\244\031\262\357\r{nX{\177*\003>*\372\212\034"
+	.ascii	"\230W\237;Xz \253Mk>8R\230\036\025In\005\344.\326\252\177cH\337"
+	.ascii	"\027\205\354\355\212\302\037\276\250{\214$#6\2277\323,\257`@"
+	.ascii	"\340\241\331\205z(\205\370w\255\315{N\212:\352\022\255\005\215"
+	.ascii	"\030\203:\304\244f\370\267S\344\327\352\361zH2\033\230e\244\b"
+	.ascii	"O\n\201\306F4\031\202\353\335R\217\354\270=[\331\223\2548\330"
+	.ascii	"\227\240[\252\310>\270\021B\254\004\306lP"
+	.string	"6\0165$\002\216\"m\361\034b'T^XM\347O\341\343#i\365\rX\361\224{\020\276i\005`\224\020\361\361\345\201[\022\335\210\255\r!\212@\334\213@A\324\354\2745\222\335p\230\261\336\263\257Z\200g\034\002\353x\267\266Z\327\027\034\337\326\370ap\334\\k\374V\360\300\024s\256\177\032=\207~\210u\252\221n\234\316\3448\023\036%\"\350\027\362g\330{\360&\212\352\267\365\245\205/V\206{\261\227\271\023;\233k#\221\b\321_\301\345|\222\365VP\340{\004\357\221\034|\002\270\353\226\t\003\2722\277\275\363V\206\2747]Vl\234\256\331\3311/\265KM\"\221\032u\364\035\251/bV\301$ \304\262\031\221;\311\233BC\213-\032\346\212\270\233\226\033\232\306[\203L\244\346]\300;\345/4b\nfp\360-\201\232\220\260\\H\233h\264\210h\314\3063\375k{w\216\t\313\2663h?"
+	.string	"\0050\247\226|\002\301\330\240\004\\\270}N\317b\022\006\025\241Sp\225\351\340\031\373\f\311\226\343\244TH^\3775\002\275\267?\212\267P:N\335\236\261:\034\220$\201\3305\363\003+\210'\241?\247:d\250.\2649\253\356|;y\276"
+	.string	"`\217\254\253\026\372\356#{\311\362q\261\255\224\021K\320\332\324'\033*\0309\036\371\227\347n\360\035\200\016\217*\233T\307z\017u\246\270o\333\263\371gT9P\353\243\024\004\233\b\3550\336\205\0277\361\003/\355\030\370\"[\030\364U,\300\023u&\031\270\300YI\242\034Th\ns}\243\235\036\314\215\202Mu\3337\3726z\270Bq\177\216\250\201J\264\310'lc]j\200\203\033P-\222m&#\247\245\320[!\305\n#\220H2\271<\330\344\334\302^d\241\230\201O]|\006+R\361\226C\t\235\2766Uk\327\233=3\016&\004\242La\017\267oi\2654\300\232/\217\303\203u\001\300\252\030\034\372\304\251\361\t@\371\361lb{d\206\371Z\200\336\362\204\263\306Xx\003\265|\341\3373\333\315n\032\234\314&M\247"
+	.string	"\t\302~\2463\254K\232\253\n\214\273Q\213\216"
+	.string	"\206\\:s\222\343"
+	.ascii	"\202\261\216\246`\316\003\316\b\264\210W3\342:\006\220`\242\307"
+	.ascii	"\263\2402\350\t\253\317\373.>\200\364a\030\264eo\266\257I\020"
+	.ascii	"N\236\373\2552\347D\230\233i}\212x\256\320SL\254\335\nK\020Z"
+	.ascii	"=\344\204\257\n\264\360n\272\326\213\214 \345\314\033\315\312"
+	.ascii	"\364\356\224\270\311\311\306$;\317W\341D\020\b\037[\325}d\261"
+	.ascii	"\334F\224\266\222\350\013\257\252\204vp`\346\322\215\001(IH\030"
+	.ascii	"R\b\214\316\246\300Z\256e\247w\335h\335^\374-\325\271n\341\361"
+	.ascii	"s\354)\013\367\"\305R\330\036IJx\310f\326`F\206A\250\372\007"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommandWithArg.179.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\365\022\335^"
+	.string	"Z\237\214#N0\220\322\031\016V>\316\215M\371\036\022\277\233\311\363\2664\354<\b?D\336\243dc\177\370%\345\323\253\222\302\276\355\221\245\366D\373\r\206!\266\020\214\211"
+	.string	"\002\264\254\266L\227\301\331\252.\323\203\212\301V.\021Q\227\347\210\211\b\331R&\031+\002\357\001.\002+\217\235\263\350\335\273\256\345]\356\3458\374\313\036/\\\001\n\310q\272\344\327\257\025\307\f\200J\246\353*5\2418\267r_\303\326\243@\004\020:]\3275)W\225\304\374\260\256[jZ\326\365\371\301\226s\311\361\270*\344\232\267\032\221"
+	.string	"F\247\353\372\344\240x\341\245C\367\031\302]\251\253\230t\r;R\201N\243\201\353*u\272p_\024/\374\225\335\243p7\307\356qw\207V\224R\200$p\003\237\na\224K\311\361)ZC\310\265\313\355M\313\272JO\354"
+	.ascii	"\322\242*\275\r9\016\005\007#\327.\256#"
+	.string	"O\305\013\221\274\314o+AE\256]/8\265\254\353zb\227\212\027B\037\315\261K\n\274\266\302R\374\2755\245\004\256\353\n\225t\240\341\205\352}\206\027\366\331\007\257J\277 V\250\227\037!B)\t)\304\221\021\210\"\242!\241 \240\037\237\236\017H\236\035\235\234\243\021\247H\034\n\325\346\345\236\371\021$\340\002\243j\"\254\\)\251\311\263\n'Y\271\201\221\236<\204\312\244\346\306\313\363\236O\324\242)^F\316\327\306Gm\323\250\240\221J\364\342\221\344y\317\250z\200\233)\227\347\2551\b\030\302\240/\312\373\004gl|\320\0235y\"\341!\265\241P\231{\336SMU\200-\255\310\277\244\261\3200L\311\203\222\034H-\"\013\323\343y\317$*\023\336\013gn\027\003\377|\271\005{\320@%\367\031{\217\312\242\013\031\274\347=\217\250?\022D\310\277\030\341\017JH\325\347\307\025\275\347=\177\250Oz2"
+	.string	"Ac\036!\337\321Q\031\210\303\303\341yO!\352\023\031Z\216\312\200\021=\276\347=]Pe\374\020{\223\347\030\037\311\336\256\324\344\031\204\215\337z;\216\372\327\307\244X\026&v\342\363\236bX\232<\374\333%8\213\341.*X\026\366\343B#\030\013WU\023\323-mv\300\274T \036I\234\277r\326\001\326\305]\204\355\313\b\306\005dh\2243\"\367\262\347\333\220\211-\326u]v\202\205}\227\276\313Qv\227\310.\222\031/b\006z7l\263\345v\372\257\354"
+	.ascii	"C\246&\033E\353\330\035\342c\311 \306\t\264u\335\272\023E\263"
+	.ascii	"\350]\031\033\360\235\3732fh\270\373j\246*\354N6\221\224\346"
+	.ascii	"\233-\036\\\237\016<\340;\273\237fHW3\337\263\366WFm\263u:wN"
+	.ascii	"\236[_\027\273Y$+\320\2734\244\370N\356_\271O\03232\334u5s\357"
+	.ascii	"\367\035\272i\340\224\311=\250\bLb\327m\026\270\027\324[\343"
+	.ascii	"\373\333\267\271\226\267\300h\232\232\375\032@1K\326!h\366S6"
+	.ascii	"\037\262\376\301-Y\3273{\035\326\257\030\3458\206\027\336\213"
+	.ascii	"\230\004\207h\332:d-\321\267\273~}f\b\231\013\353\312<\231\037"
+	.ascii	";\327\022\027\"\320\177\2731\013\335\235\340\264\311ov\245Ln"
+	.ascii	"\263\3353\034\027\261"
+	.string	"(\333DvU\336\244\312Ku+\277T\215\031'\363\225qA\324\213\207\371\272x\333O\301\353\276\021\034\356\353@\213\337\360\263\370\224_\201#\357\212C\371\021X\336\024*/\224\312\213\342{\337\023\307\373>9\231PyK\030y\0010\362\222\370\334\267\351\310\313\244\362.\021yG\250\274\"\216\274J:\274ID^$\"o\210\034\336\243#\257\021\221\027\004\221\267H\345%\032Ry\205tx\203\210\274@D\336\237\034^\037\"o\017\221\367\003\221\027\251\362\362\250\274;*\257\316\2217\307\310k4\362\342\030y\213G^\242\312;<\362\nU^\365\310\333*/\237\356\373\020\026\230\3025&\312\337\225\336\223\256<\006yX\357\204\\\224|\357'\363\343\375a\376\272\037\356\217\373\345\376\271\237\356\306\335\363\355q\317\206\361\f\213tl\314>\207=\222\271:\030\037`\035\013y{\304[\271\244.\351\nv\244\302\306\267\256"
+	.string	"f/\346v{\254K\252\253\330\332{Qi4-\205b\230d\022S\032M\355\324:\262\374\275\361a\025\276j\320\333D\353 jV\343\326Gt\037;"
+	.string	"\247\202\323\253B@Q\275\264C\320\357'\252\233Z\307\355\336\003tA\257\372c\242\377 fr\023}A\3634\331\250\260\nx\177r@Q-t\253{\342f'\324N\035\325\377Z\362\242\205\272\247\031\005\374\223C\027\375\242w\232Q4_dA\355\242\033K\363\rP\377tP\023\305|9\341\342\301%W\305\"P?J\2216(\376\035'\321b2\340\205\245\031\337\371\323LY\004\245\202\323'f\260\377\356]~w/\313\"E\n\216,c\340*hZ\270k6s}zw\251\344^p\0309\325D\320>\315C%:\327|\363\241{\372w|\246\365\323e\311\326\204F\004EO\343\264m\361`\331\325\017\337\326\222M\305\207\326"
+	.string	"JF\260-\202\276\335\177\266\240\001\353*cD\346~\230\260\220\253\342\023\237\003=\003j\247\326\304\310F\366\301\360\230\226swI\303\275,\331\220\2265,\325\276\232\te W\006,\377X~-\331\n@\323\032^\210\354\025\320:\3016\024\347\351\026\315X\276\310\220\314\202\247\325-~\200\006\344\2011\342\023w\234*u]\313\030\270\334\255\240a\004\247Pxp\317B\034\r=;\3752\2672;\375/\357\251\342\227\006\360%\374\300|h\263\345\223\006\226\370\226\303NH{`\207\017\t\317\336\032\234\323G\223\233 Qd\233\355\225C\2516\032\353c\256\031\323w\304:\023T\220\344\325\314\315i\235~\363\r\217\234\026"
+	.ascii	"*EMl\213\007\343z\270\341i\263\3440\005\253\265\301@6[<\310\304"
+	.ascii	"\226\326f\347k:\374\320\321Yan\317\255LO\031\222\263\034\033"
+	.ascii	"Cc\013\271\346\236\340\364\233=\030\247\337\344\242>9$v\261\215"
+	.ascii	"gJ\340\232Q.\036\\b/{\361Wr\217d]\\\361\235WR\234j\210\335[\314"
+	.ascii	"\2009\016\033k\330/c\206\316\314\234\261\315\316>\310x\210\202"
+	.ascii	"3|C\244j\250,QP[\212\302\246\022\022U\265\217\345I"
+	.string	"\232\377\355\001J\345\224\224\224\226\222\210\225\005c\212\004*%\221\3520bD\2110uc8E\002U\f+e\222\250\204\021#j\004\032I\"\b7\250\2464PNe\341\250\261s\243\202b\226\026\006YS6\244hX\341`e\301\310\322\262\272QA\326\224r\nK\347\206\004J\345\224T\025\026\214,e\025\f+e\022\231\245\374\240\245\260\224\r#F\324\007I\251\241\224r\n\002),%q\245PX)\223P7\250h$\241\244\260\224P(\200\266\312j\n\013*\253\252\n\013\352(]\337D\366\207\007\0232>\341\313\241\325\016:\232p8\377r\370\267\343\334\375\361\320\204\323Y~9L\221\242\271\271\366e\276-\230\334\003t\204\322oc\3703\202}M\270\244\032}\"\202b\232pH\214\302O\034q\211\023]\242\211gp{\"\236\202\370|\366\262\f:}l\251p\272?\243\200ilp\306\326\376\224P8"
+	.ascii	"\375&5\232D\003\320o\212\201]\252I4\t\3216n{T\272\f\300N\337"
+	.ascii	"]\006Y\216\361\2355\272\351\326\310%\035\rW"
+	.string	"\340\224\271\225\371\217\206L\275\242\227\233b]\226B\230\232\270F/\020i\215\fB@x\300\020b\251n\251\317\367\236*k~\334\2619\\\013S\301\351\321?\"\313\026_\271jZ\032Q\"\316n\t\031[\233Q\233\355q\255hF\013\373\210\234\376\324:\266E\364\003uC-\242\273\207\257\224\371N\363\207\007\003\210\247?\365\214~\336\205N\240~n{S\310\224N\350\222\004Bs\252Ij\245\356\034\232o\220:D'\365\360\357\313I"
+	.string	"\227\321H=\204\345k\006.\036\254\242\205\204F"
+	.ascii	"Z\210F\332\321\303\020=\275\270\243\376s\2521\352#\243Vm@\263"
+	.ascii	"\345\356\210\235~=\266A\353\207\304\223;\257f\352q\233V\023\232"
+	.ascii	"\n4\031\375\034\376\203\207\206\255\241+x\355P4d\242W\0252\321"
+	.ascii	"CM\\\324 \240Z;KiW;O \234\\\355\360\025\300W\324+\240~jm\016"
+	.ascii	"\364\fW\305\0374\341\230\2723dlG\210\234\372\350&f\320\255\256"
+	.ascii	"\213\335\274\307\230\201Re\250\315\266G\026\3006\237\026\275"
+	.ascii	"jP\201u\250q(\346\024S\206dDDDF\222$\0351\005\304 (\035\274\016"
+	.ascii	"\02101D\214\311\214&Iac\f\343\302C\224[}\033\367Z\330\020\247"
+	.ascii	"SdL\212\245Q?\3710HL\002\241\366\003\370\374\324\356|h\376F\227"
+	.ascii	"g?U@\034{\247\361\030q!\2334\203\332\231\352lk\376\243\350\\"
+	.ascii	";\227\360\tP\0022w\223.(W\3329\022\325\177\2057H\306\215i7\270"
+	.ascii	"\031?\323\242\314\223\2363\246\016`\230{Z9XU\020t\306\201\235"
+	.ascii	"\002\263\267O\206\220\354\037j\023\364\343\332\250G1\214\313"
+	.ascii	"\216\323\206\001\353\242\017\371\325\330g\002\241-?\023\205~"
+	.ascii	"\226\032g)>t\033\377D\275\321lZZf\034l\222N\224\030\217G\224"
+	.ascii	"A\352\211\200y7W,\236gH\323\031\353\363\261\257vYt)V\342$zJM"
+	.ascii	"\245\250zP\315\205\322\312\016\272\037\364\363~\2322\312\250"
+	.ascii	"\250z\207@DP\355g\302oX\256p\022\205T\236<\210\210\352\260\244"
+	.ascii	"\307\025e'r\341\371k\026\366\357\2563\343:\357z\316\340\372\346"
+	.ascii	"\036\330\210\220'\003s\202n\272\034\373\2568-\020n\204L\330\227"
+	.ascii	"0HQ\254+\233\251e\311Cl\274\215\365K\320\224\202_N\360\256wd"
+	.ascii	"\320~8\312\301\214\342^\361\371&\t\362\306\222\206x\270\354\034"
+	.ascii	"\033\255b\226\033\241H)\tQ\203\027\"DAY\0355<\227\372\263]\353"
+	.ascii	"\261\024\224\236\352\343\202\311\223\316I\006\275\034\244\212"
+	.ascii	"\333\275d2*\323\340VoS\251zP\343\013*\366\2023P)Y7 \022\357S"
+	.ascii	"\316\361\177F-\273\313\200fz\356\001\275\016M?\256\027\270d\020"
+	.ascii	"x\025\203(\"\366\376q\310PJS\257D\032\372\302\355g\003\367\217"
+	.ascii	":a\334\r\320\275\025n\035\343\301y\342\324-l\341\316\324\237"
+	.ascii	"y^\2778\223\337'\tm|\254{\235\300^f\332(\356S\fA\034\030\250"
+	.ascii	"\177\022\343sFt\215\032[<N)\242\374A\027?g\322\205~\300\020\247"
+	.ascii	"\276\233i%sD\255\315\323\003\246hf\327OY\205\200\020\301{\305"
+	.ascii	"\217)\203\321x\025\302Y\2125$\254\365fZ\3207\305\243\024\031"
+	.ascii	"\005h\231\300g\364\003\205\330W\027-\034\"\200\242V`E-\351\206"
+	.ascii	"\262EA\313I\224\246-<A\255v\324@W\013X\021B\215h\260\216n\260"
+	.ascii	"\341\354\211]\205\304\262\336\340u\210\177\300\314\256U\252s"
+	.ascii	"\302X\306XP\204\234\377:\345\362\231\035!\2342\n/\337\234\344"
+	.ascii	"\225\200\025\350\331a\274\253\323\t\2125m&d\255\271&\341\034"
+	.ascii	"sr\212Y?D\303\263x\356\002\310\353\256\200\265\215\217;\207\331"
+	.ascii	"\036zs\322\225\007Z\242\216E\020\231\016\262\360LVn\2206ZnU\303"
+	.ascii	"\254$V\264h\275F\240l\302Yk\236\005\217\021\3473<&$e6\3078\r"
+	.text
+	.section	.gnu.lto_mspProcessInCommand.180.47c9d3fc4bc969c4,"e",@progbits
+	.ascii	"(\265/\375`\031\226\245\362\001*0\213\256P\0200\346z\306\303"
+	.ascii	"'\321\203\304!\273\032},\336\312:\"<\016\3161\234\016\234\252"
+	.ascii	"zj\\\333*\007Se\034\356\n8c\n\3320E\374\213\264\341/\362\242"
+	.ascii	"-\021\237N=\366\002~\332\023SN\265\245\355\b\035\275\352\265"
+	.ascii	"Qa$RJ\231RJ\001\213\n\342\t\201\013\316}\206tn3\327\271\313T"
+	.ascii	"\347&s\235{\310\212s\013Q\235{\f\351\334A\220\316-\246:w\030"
+	.ascii	"\322\271\301V\234\373\013\351\334^+\316\r\004\351\334]H\347\346"
+	.ascii	"R\235{\013\351\334Z+\316\375D:w\326\212sc!\235\373\207\353\334"
+	.ascii	"W\256s\373P\235\333\312u\356\252\020\316M\205t\356)\244sK\271"
+	.ascii	"\316\035\345:7\224\353\334O\252s;\271\316\335\244:7\223\352\334"
+	.ascii	"KH\347VR\235\273\007\322\271\235\256s'\251\316\215\344:\367\221"
+	.ascii	"\353\334<\\\3476r\235\273Hun\"\327\271\207\\\347\336\341:\267"
+	.ascii	"\220\353\334:T\347\016r\235\033h\305\271\177\220\316\235\303"
+	.ascii	"un\037\327\271q\270\316\335\203tn\036\244s\357 \235[\307u\356"
+	.ascii	"\234\023\316}\303un\234\023\316m\303u\356\033\327\271mN8w\215"
+	.ascii	"\353\3345\\\347n\272\316MCun\032"
+	.string	"\327\271gD87\363\204s\313\270\316\275<\341\334\257\353\034\023\302\031\006\351\254\f\341\374\202t\236\021\302\331EunA:\377\340:\237@u6\201\353\354\203\tg\031\252s\f\2443K\b\347\022\224p\356\001\351\234t\235a\270\316/Tg\036Jp&\201\353<\002\022\234]\270\316;\214\340\254\203\353\234\003\t\347\026\2563\016\2563\013\325Y\004H\347\025H\347\020 \235A\200t\376\300\bg\017 \235;0\302\231\003H\347\r\214p\326\200\352\234\001\327\031\003#\234/\340:[`\204s\005Tg\n\270\316\023\030\341\254Bu\276\301u\266a\204\263\004T\347\032\\g\032F8\317\240:G\300u\226a\2043\004T\347\007 \235\0350\302\271\001\2563\003F8/\300uV\200\353\234\200\021\3161\250\3160\270\316/\214pF\200\353\354\202\353|\200\021\316\006p\235\013\340:\2670\302\231\005\325y\005\327Y\005\327\231"
+	.string	"\256s\n\2563\n\256\363"
+	.string	"Tg\001\270\316)\002\340|\202\353lB\005\316(T\347\023\256\263\t\021\234K\270\316%\250\316$\270\316#\270\316$\\\347\021\001p\026\301u\016\200\352\274\342:\213P\235C\270\316\310\025g\327u\016a\305\031"
+	.ascii	"\2563\b+\316\037\270\316\036\2548w\340:s\240:\203p\2357\b\341"
+	.ascii	"\254\001\3229\203\020\316\030 \235/P\235-@:W \302\231\202\020"
+	.ascii	"\316*H\347\243\352\234\242:\243\250\316F\325\271U\235Y\325yu"
+	.ascii	"\235\325\020\234_un\343\215\0178a&\t\202\310\364z_o\3164\361"
+	.ascii	"\205\256lR\376\325n\325\216\325\376loj\177j\217j\357\321~\324"
+	.ascii	"\236\324^\324\276\243\275\247"
+	.string	"\335\247\035\247=\247\335\246\275\331>\323=\355N\354>\354.\354\026\354^\353n\353&\322\235\326!07\030\037\201\270\227\322\277d \002e\354\325_\021\276\345\303\263\\\353\331\245\243\207\361\312\177(\035k\006\365\005Z\273\204\246v\030{\355%\020\354T^\245t\253\032\372\245\361\2420u59\216\261\327\022\326\326\200ur(\227\212\262\341j\313\020\260\206\321\237T\364k\363\366\362\271u\350K\2437Q\240k\013qj\364%%>\366ZB\005}u\200\354<\330\221\334\311\307\244d\336\223\256\211\321\217,\300s\365\264\3433\032\361\261\327\242\344\3253\216m\350\354\f\352:\\\210\371\310\030\360\037^\325\240D;0\300\316\343@\314G\326\200\377\360\352\343\226\204\303s\360\261W\037?\253;@3\243\3678\021}q=\361a\354\225Y\003\314\307\033\256\303\307\034\016\250/Y\003\206\352\236\214\275:\016\007\324\227\354U\231\374"
+	.string	"\271\262\336\367=\272\341\243\333x\240\313g\t\207\327\0201\363\365\356\244\224\3518\302\365\304i\262\246f p&\367\017\257!+|\311\315\005D\232\365\276\357\321_>NY\\\360\342\275\275\263\247h\327:F\305%\3052\300\367}O\030r#\362\361\220\337\324\227\214\001\2127\246\336\367\275al\302\375\204\260\235(\273\260E\2776/\312\236\"\016\340\373\352\234\350\225\273\206\261W7\032\301\375\306=(\230\024\261\374zs\216J{d\\Of\030{\325\003:\262\004\350H\036\220\016J\216\024\002\035q\002tD\006B \027\375\306\252Z\022\321\216\367}\217I\230"
+	.string	"!9r\247\007Twdn\tP\037\3518\346#\223\240\337\230\003\213G\336\367=\366\312L\002\346c\257\035p;\362\242\337\370\337\362\214\210\270\336\367=2w\021n\266v\343c\257mI\365\005r\001\321n\212\004\306^\327Z\222\020\3578`\354\225\004f%7Z\253\361\021\005\025\224\235\226\354\227\306\373C\023\304(\013\020)A\277<o\327@\021\245"
+	.string	"\337\367\353D\257L\003k\026c\254\306\001\310\322X0\366\312\2533w\220\036S\266\020\037<\270\340\235\021{\026y\337/\0238\005c\257\374eT\277\032L\331a-~\301;\303\fBa\354\365\002g\367\0062\203Q\336\367\350I\221\367}M\340\021\306^\267\232K\3111\020\240\221\341\021"
+	.string	"\342Rs\354\311\373\276)D4\b\266W\2655`{}%\f0\260\352iO\265S\006\031l\260\256+\b\374\255~5\233`6\266\372\325\306V\277\232_0\306t\003\351\256\346\352\255\326\352gg5V\377\350\253\366\321V]\325T=\325R\035\325P\375\324N\335\324L\275\324J\335\243\235\235\324H}\324<\332\250\213\232\250\207zG\013\265\216\016j\240\376\351\034\355\3238\272\247yz\247u:\247o4N\333\350\233\266\351\232\256\321\315\246\3214=\323\314\226\351e\277<\345EV\344DF\344C6\344'\\\310N\230\220\233\360 \013r \003\362\037K\331\217\231p\037G\231\217\367X\217\227p\036+\341$\214\307H\030\312wl\307uL\307s,\307q|\204\341\330\b\277\261\033\2671\033\257q\021V\3434Fc\"|\306f\\\306d<\204\205\360\030\007a1\016c0\376\202\341\005\004\270p"
+	.string	"\003\024\240\005\026VP\201"
+	.string	")\2400"
+	.string	"\001\2448\301\004\024'L\224(\201\204\021H\214\020!"
+	.string	"+\"B \335\020"
+	.string	""
+	.ascii	"\302\007\036t\300\001\210\r4\310\240\2770\270\300\202\n(P9\246"
+	.ascii	"\240\030[vU\277\275\032\254\303<\206{\331\r\204\256K\321\233"
+	.ascii	"\253\213l\013\261[\013Q\213\346\320\373\3514\354\316\2421\324"
+	.ascii	"z\342\215E\363\347\375\243\013\347jk\352C)\352m\325\327]\245"
+	.ascii	"\324\030\220\330\262\353\353\246r#;\357))\325\205\256,\246\020"
+	.ascii	"\216h\356\324\017\033\002\347\316(\020pB@p\0349\367\272\241T"
+	.ascii	"\0234un\324Oj{CgI\013\201\177:|H\316\333\t\3179\327\335\364\244"
+	.ascii	"bzBQ-qpDs\304[\311\251\354\b\227a\217\270\356\035'Zw\022Z\034"
+	.ascii	"\021o\2443\357#\263n\036fe\336FIZe*k\252\3418r\222u\027yu\023"
+	.ascii	"y%\001\342=\324\325\275\243\013\t\227\267\320V\267\216\255;-"
+	.ascii	"\357\240g7\320\263.\313\373G\252;G\bG4RsQ\336>dP\3368\234O\335"
+	.ascii	"=4ON\336<M\335;ML\336:K\3359KE\3367\210\272q\210\206\274m\334"
+	.ascii	"\320\by\333\034\243"
+	.string	""
+	.ascii	"\271\2365WD\272\306\211\247/\256g\223\306\006G\316\234n\232\020"
+	.ascii	"\216hn\320\340"
+	.string	"x\3174\363\306[&G\367\322Y\323\375\322\324\320\324p\236\322\330L\235\027\027\233\025\027=\207\242s\"\342\241\n\002\023Q%q\350l\350:\275b\350\374\004\205\t \327\263\360\217\235\020\37297\341\301>g\301\241 \252\300\273/\256'\340^\363\337\336\235\263\324\256\331\317\256\316\231\t]s\037\335\234sT\256\231O.\316y\357H\263\336\0215\347%i\315yi\034\0341\321\234\225\254A]TI\316\232\361\316\314\234\221\2245C\313\310\234\357\274\232\355\274\2008\327u5\323uq9\317m5\313mi9\307=\233\217<98bf9\303\375D\005\032\211j~\213\202rv{jn{rrfkj^kbr.\262\324\254\266T\344\234\246\3428B\"jF\013\341\210\3516\344LD\216\352\354\246Q\234>h\201f\034\0341u\260\272\343\210)\344\\\306d!\0341\203\374\246\325\034GL \347!;\204"
+	.string	"\215\371\324\004A\024\273\t\353\211c\260\020\216\2305U:M\316_!\0341k\270\301@\3445\024\375\205\305F@\211\240'\\\317#\036\242v\341"
+	.string	"D\210n\200\002\020U\351\030z\013\306\274\235\241\300#\036\242f\341\257W\370\223\272\n~M"
+	.string	"?&\236B_\243\320\027\365\001\360\265"
+	.string	"\370\366<\305]\237pg\347&\3245\n\225\304\363\320H\343\351\324\251 \b\241i\242\363\023\352\005s\252"
+	.string	"\342\334D\017\036\271.A\323\306&S\263\300#\036\271.\341H\223pD\315GHk\022\252\211\264*\0354\037A\304E\210i\n\200\231\257\254\034\361\020\265\b\262\016A\346\345HU\003\275\037H(\200\312\352\374\355\225*\035 \356\252\"\346\240\315\306\323iRC$\025\031v\225N\227\207\240\006"
+	.string	"5\345\rM\255\361t\266T\025\232\252\250Z\361\351 h\365\007\036\020U\351dy\007J'\016T\305!\252#\036\242\006\241\26649Q\215\247\003\245\266p\b\310\326\210N\276A\017\236\247\326`\2613h\231\247\356/\325\004\021\035\216\020\216\2325T\020H\220\230\364`\257T\35149\006m\f\016P\272;\302ex\304C\324\027Xp\201s\261+PS\240y\262C\345\260\251\244\253t\212\234\002\025\325\004\340\232\223\306\323\031RA\344D\331\354\360c\312\312\021\217\216F\321\341\326+U:An\354#\036\242n\177\232\255`\247I\303\327\306\323!RE\274\357{\334\241qU\005\201\210\016G\343\351"
+	.ascii	"\251$\220 1i\267\366\233\235\031\177\022s\335^Z\335`\276\330"
+	.ascii	"\035\306\224&Ji\230\330D%\036>\311\271\201c\243i3]J\331a2\231"
+	.ascii	"0\243g\315\032\033L~B\211|D\230RL\346\023\265\264\251\024\021"
+	.ascii	"]Y\334\016\035A@\\\033\034\321\360\261]u\263\323G:M'x\033\303"
+	.ascii	"\373\276\3546;<\315-\326\314\030\210"
+	.string	"`n#\346\231\032\002>`|V\261\302%\".\253*\022o#\236\031\346G\225J\256b\205IQP*\241\215\340\210_\301\020\333Dxf\230 \265\tFh\025+4Z\301e\230cP\231`\206\330\017\2208\251\371\343R\225\324%\230\"\0360HN\266\327\367\013\300\213\300\f\243\244:=`|\337\231\025XM\352\341\b\206\311\030\200o\034@\232<\201\310\370\024\352\307\004\311\202m\245\2772\235LG\340+\317\f\003\005#\345m\323J_\304\257|\006M\277\302\346\242\210\3672\304-\344\207x\177\033\003C\374\364\326\254*\033W\203vY\344\277\230\223?\261\272\031?D~\363!^\221u\tD+\350\322\025C\320\301\335g\206\261\202\271\032r\277\335Z\255\002\242\007\200w\3621\372\301Z\363kS\203\235\350\277\371\033~c\377\346[\261Q\244x[@@\270\371\265\346;\030\302D-\004,5\b\350\007\002!\340"
+	.string	"\300\277"
+	.string	"Y\362\004\341\251\362\354\350\320"
+	.ascii	"\002\316\007\377\002$\317\320\203g\206\331Ro\222$p\313\236j\003"
+	.ascii	"\323E\242\005/\265\006\006\314\250\326\270\001F\254\237b\272"
+	.ascii	"\320<\370\3062\232\371%\263:\243\322\304t\215\301\f\031\302\366"
+	.ascii	"\332\301\267b\253\211@\362\236\2055\274\254\0178(Se\222\310="
+	.ascii	"\365U\2270gh0jjl\257k\035\007\277\362\035\016Bg~\351\301;O4\210"
+	.ascii	"g\021\213\316\370!\2430\024S\344m\003\342\233\3570\020:\363\313"
+	.ascii	"\262\303\273\r\236\031f\355\021\223!\336\360\017a\332\336`\340"
+	.ascii	"\340\330^\331\267\r\276\335\232\003$\207u\236\2449\206\016\336"
+	.ascii	"\311\314\032\304\275\023\302&\203\036\020f\360\032d\360\037\200"
+	.ascii	"\035\266a\360\3140s\017\330\322A\226\336\367]\201\031\246\356"
+	.ascii	"\377`\356\\`\030$/\205I2\302\336\373\276+\364\312\317\344\375"
+	.ascii	"`\362\270\237ze"
+	.string	"\030=\030>>\266W\017\024/x\f\276\233\213\027\374\007e\207kZ\335n\335L\207^\034\274\223\033\261mX[\262\201\005\3772\177\303\334B}\337#\030\272\260\0330\314\247\034\001\177\231o\303~\002\343Gb\357}\337\266a\206\371\203\t\364\266\341~\322\031\224\035ZAi~\311\374\305\004\361N\246\300L\203u\350\333\246\376:\321o\36376o\301/\340\333\336\202\272\236v\t,\005\377m\315_\314\3460%9\2166@\321o\363\353\320\003\240\271WH\203\210\351S\256\340\231\271%\332OT\270K\357\373\266\360\2046\202\025|#\366\006`\207E\320\231_\376\001\260\376\0245\020\3434\275\240\253\f\336\311\335\355S\017g\177}R\222]\201~e6q\242\340W \024\375bO\301\367`\317\240\264\247Fc\221\351S\376f\227(T\304@\345\371\221<^\013\314 \f!\f!\333\253\243\331\b\312\370\224\217\257\362\315"
+	.ascii	"\030C\030Do\233\343{\\!\341\216.Q8xA\002\034\345S\236\031f\032"
+	.ascii	"\263LA\371v\353\007(\331\3515X\220\232\005\016}*\240%g\025\274"
+	.ascii	"\223\273\223\354\312\343\327\236?\251Vkl\220\202\027\274}#ML"
+	.ascii	"\223\346\227\274\"\275\361{u~\373\255\222\235Zs\361\215\364\360"
+	.ascii	"\250\274\365\312\343_\354\017\311\371]\b\004\351\325\270\302"
+	.ascii	".\350\314/W\036\357e\205[\320e\227(|B\217\357\344\016\324\236"
+	.ascii	"R\224\177k\020jO F5\355\277\206\255\251y\366[\245\272\024O\252"
+	.ascii	"!\203\262\246\375\312\224bM\325\264O\321\243\273S\311t\230\306"
+	.ascii	"w\262\253\206%e\271\223\254\005X=V\025\355\277\306\3370\033\300"
+	.ascii	"\327g\216\301\211\311\361\266a\0215~\375\024%\272!\355;\233\215"
+	.ascii	"\207\007\373I\235dU\264_\305\374\n\305\354f\374\360\223\222\300"
+	.ascii	"V\227\375\262o\267F9\022\343\233\361C\356vY\365\277\354\331\233"
+	.ascii	"@L\2372\277\332\027Ir?q\314NL\217\267M\257\3341=l\257\352\303"
+	.ascii	"t\331=\201d|\312\222\225\311\250\357\344\007\260\377,bw3~\310"
+	.ascii	"*\332\377g\320\234\273k.\312\370\224U\360\007{\346\230\237\230"
+	.ascii	" o\033\025\355\275\314\t!t\346\227\374A\335nm\003\226\316\023"
+	.ascii	"\300\245+2\1771\337\227x\341t\203\275\223\231\377\2509\206\245"
+	.ascii	"+r\367Q'\216F\207\275\323\214\377\3540\372\204+k\b?\231\241\331"
+	.ascii	"T\020\376\261']@S`\374aN\216vP \374^\202CG\270\262\266\370\271"
+	.ascii	"\376\370\236pee\361?\241A{\\Y\257\321\025\377\217\273\035\262"
+	.ascii	"\251*~+\226\252A\022\211v\330I\361O\321\021M\275"
+	.ascii	"FO\374Ps>:\246^#&\376&\226F`L\256\007\277\022KeX<\022\207\304"
+	.ascii	"\237\304R\031\336\200\214\030\361\363p\023\372\032\342'jC4\234"
+	.ascii	"\322\301/\3046G\306\225\365?\374@\2356\3244\205\203\337\007\r"
+	.ascii	"\205\357w\370y\232\310;}\232\372\033\3749,}'Fmv\303o\243\354"
+	.ascii	"\330\004\255\301_C\326\336\001\322\360\323\320:\356\025y\031"
+	.ascii	"~fc\325A\271\262^\243)\377\233dh\217++\221]\221\245\352\237\022"
+	.ascii	"$\206\354\207wA@\246\234\260\027\326\375HM\275F\203\354MX\252"
+	.ascii	"\302M\315\001\262\007\256\241\370\221\371\261K9\255\215\226\317"
+	.ascii	"\241\251({\037K; \004\210\210\036\373\036K\327<&D;\030L\t{\036"
+	.ascii	"K_0\362\002\022v<\226>a\023\242\035.\330\261\337\261@\204\214"
+	.ascii	"+\3535\232c\247S\241}r\204+\3535:\302\036\307\322\016\300\245"
+	.ascii	"\360\306n\204\245\034\030;b\002\033{\033K7\220\bt\302m\336\367"
+	.ascii	"}\325\330\213\220\020E\204\035\215D\267\260\2756\315\361\251"
+	.ascii	"\bW\326k\364\226(c7c\251Q\204naY\311,m\232\326\217\214+\3535"
+	.ascii	"zK\364\312\354B\330\207\260\324\003R\240\367]6\321\261[\330^"
+	.ascii	"\231\231\231\225\314R\267y\337\367}K\364\312\354A\230Y\272:I"
+	.ascii	"$\332\361\276\313&bffV2K\335\346}\337\367-\321\353\007\371\225"
+	.ascii	"H\272\343\275\363E\356\177\261\377\261\346\242\214O\031\005\177"
+	.ascii	"\260g\216\031\212)\362\266\351o\265n\247\332\025\240!\340\314"
+	.ascii	"/\231\277\230\375\323\351t\307\337\311\334?\235Nw\370\223\230"
+	.ascii	"\275G\263q)\302\271]\354is+u\235\333<\327\271\245S\235[4\021"
+	.ascii	"\316\255\020\021\316m\230\b\347\326Kun\177\250\316\255\225\b"
+	.ascii	"\347vJ\204s\013%\302\271m\362\243\3466\307\223\232[\034/jno\274"
+	.ascii	"\250\271\265\361\035\315-\323uf\375\034\247\231\345\363\234f"
+	.ascii	"V\317u^\237\256\363\352\303u^\243\032H\367\n\345=\315\353\223"
+	.ascii	"\3734\257L\275\326\274:\273\255yE\352\264\346\225G\0376\257C"
+	.ascii	"-\330\274\002ub\363Z\3433\315\353RuV\355:\255Y\255\353\264f5"
+	.ascii	"\256\323\232\325\267NkV\323:\255YE\363f\263\252\3456\315\252"
+	.ascii	"\016\177j~=\217j\376<\325\371\347\\\347\227\363g\363\307\251"
+	.ascii	"\316\357&\302\371\333\\\347g\363g\363\257\271\316\257\346:\177"
+	.ascii	"\231\353\374C:\254\373\2034\221\346\027k!\335\017\306\316\317"
+	.ascii	"\343=\232\177\307\213\232_\307w4\177\216\3674\377\ro6?\216\317"
+	.ascii	"4\277\215Nl\376\233>l~\233Nk\376\232Nk\376\032\252\3637Q8?\r"
+	.ascii	"\325\371iT\347\237Q\235\237\251:\277\214\352\374K\325\371_\024"
+	.ascii	"\316>U\235}\321uv\305\024\316\236\250:;\242\bg?<\301\331\r]g"
+	.ascii	"\177\342:{\241\353\354N\\g't\235\275\t\322\331\007MpvA\021\316"
+	.ascii	"\036(\302\331\001]g\377s\235]\352:\273\237\352\354LTg\357S\235"
+	.ascii	"=\212tv>\327\331\367Tg\327s\235}\211\353\354yHgW\342:{\022\244"
+	.ascii	"\263\343\271\316\216\304uv\250\353\354w\252\263\333\251\316^"
+	.ascii	"\347:;\235\353\354s\256\263\313\271\316\036\347:\373\021\327"
+	.ascii	"\331\341Tg7\342:\373\233\352\354n\252\263\267\271\316\316\246"
+	.ascii	":\373\232\352\354ETgWC:{\232\353\354h\256\263\023Q\235\375\f"
+	.ascii	"\351\354fHg/S\235\235\314u\366!Hg\027\202t\3661\244\263\007q"
+	.ascii	"\235]\f\205\263\207\271\316\016\246:\373\227\353\354^\252\263"
+	.ascii	"\003A:{\227\352\354\\Hg\337R\235]\013\351\354O\021\316\236\345"
+	.ascii	":;\226\353\354?\220\316~\245:\273\017\325\331\255\220\316^\245"
+	.ascii	":;\225\bg\237R\235]J\204\263G\271\316\016\345:\373\223\353\354"
+	.ascii	"N\256\2637\271\316\316\344:\373\222\352\354J\256\263\367P\235"
+	.ascii	"\335\211t\366$\325\331\221\220\316~\244:;\017\327\331\215\\g"
+	.ascii	"/r\235\235\b\205\263\017\271\316.\344:\273\016\327\331\203\\"
+	.ascii	"g\007r\235\375\307u\366\034\256\263\373\270\316\216c\305\331"
+	.ascii	"{\\g\347Yq\366\035\325\331u\\g\317Yq\366\033\256\263\343\254"
+	.ascii	"8\273\r\327\331oV\234\335\306u\366\232\025g\257\341:{s\305\331"
+	.ascii	"i\270\316N\263\342\3543\256\2633W\234]Fu\366\245\353\354\357"
+	.ascii	"\212sO\221\316\275\270\342\334\212H\347N\\qnD\244s\037\2568\267"
+	.ascii	"\241\353\334OV\234\273\320un'+\316M\350:w\223\025\347\036t\235"
+	.ascii	"[p\305\271\003]\347\006\\q\356?\327\271\245+\316\355\247:7\023"
+	.ascii	"\325\271\373\220\316\035]qn>\244s\357\2558\267\236\352\334K\\"
+	.ascii	"\347\316[qn%\252s'A:7\336\212s#A:7t\305\271\357\\\347\266[q\356"
+	.ascii	":\327\271\351V\234{n\305\271\345T\347\216C:\367\221\025\347\206"
+	.ascii	"C:\267\221\025\347~C:\267\033\322\271\333\\\347f[q\3565\325\271"
+	.ascii	"\213 \235[m\305\271\323\\\347Fs\235\233\b2K_~G\177\334\361\360"
+	.ascii	"2\241\fy\375\375~\0132\375\0274#\206\213a*N@"
+	.string	"\001\373\232Y\374n\353R4L\334R\221b\311\004\024\255g\r\264\304o8\224\037\210\377\202\366\366<|\346\031N(>T\234\260\207\002\305\n\245\312\306\341\367\233\224\341\327\340\366\004\n\005J\247}\362]\330T\3705\2449\221BY\302\341\344\273\315I\3705\f\211kB\205\202\004\324\304h\360k\030\023\264B!J\356@\023\374\206C\021\n|\032\026\001\257P\202\214`\304B\254y\200\337](9\376\376\205\210\342\240\024\013\245'\371\222$\375nC\321\361\373\027\"\211O\022P\300\204\311\273\025\335\b\\\364\365}G\255\340v\210>Ql\236\242\337w(M\276\247\241I\334\336\026\n\315\024\214X\210\275\357A\024\031\275\177!\322D\207%K\336\255\200@grx'\263\325V^\227q\361\307X\336\367\033\242\222\177!\"m\221$\311w\324\n\013\317\313\370\204\213\020\357{\215\020\311\323\340\007\0053\016\276|A\277\267"
+	.ascii	"\357^\006\021&SD\320\231_\356\260\022\262\0233F\203\274\331}"
+	.ascii	"\307\351\325=\rK\350\306\214yI2\0301\227\356\373\ro\356e\020"
+	.ascii	"\311\303a\305c\2453}\322&\252\024qh\271g\2361\004\346j"
+	.string	"N\356i\250+\203i\nB\231\277\254\n\2042Y\274\223\331\210\333\017\037^UUE%\202\270\270\357h\325\316\212#g\306\"E\374\216|\337\241\301\375\f\211AF\320\214gn~F\276\357\310\336\376\345\254\320M\315(d\314\355\3330\251\272\2665c\030\030a\333\267aRslmF I:\266\357\271\255\265\1779#\f\201\261H\2216\020\250\275\031\261\360\336\324\276\343|\244\375\313\331\237!\032\234\261\212\312\017\355\331C\251.\"q\306((\"\317\nJm\235\315\031\233T\030\231\316\236\215J=\315\002\215=T\030\235f\317\342IaAg~)uUVg\344a4\312+{VP\312\352\003\357d\225I7\031\031\225\007\206\334\031w$\005\337\206|\307\005\t\371\2273\275\016\214\215\tq \b\022c\016\237 \337F\245~\304\222\030y\214;b\337\232I\371l\340\235\334a\317\"f\027\366\035\225\352\201\316h"
+	.ascii	",\317\210\363\262\310\326\201}\317\331|\375\fwq^z\306\03220b"
+	.ascii	"!\024\275\276\333\2144@\376\345\354\356\331\305gd\032e\332\272"
+	.ascii	"\256o\243Q\210\\}\355T\305\210E\256o\315\242\f3\360Nn\321"
+	.ascii	"\272\267\266\276\243Q\205Z~\355\241\215:\255\357\255\302\347"
+	.ascii	"\317P\027\224\365\3143\376ZB\0255\224:0b\356\352\227\365\355"
+	.ascii	"e$\210\3652\316\350\f\201~\004\266\200*\220\177W\337?\276\233"
+	.ascii	"\213W\317\206E\005\022\266\211\250;\f\314\030\204iF\305A\231"
+	.ascii	"\027\360\361\3143\b\333\276$\211%\2766:\243p\206\341\f\304\031"
+	.ascii	"\210>\2365\213j\263\200\225\225W\005\252\236y\206b\233\247\244"
+	.ascii	"\352Y\266\250-\252g\2361m\221\264@\247\276\251\276\233\213S\317"
+	.ascii	"\342E=\245\226m\235\n:\251o\361\242\260\242\230m\334\021\017"
+	.ascii	"\352\242\336\203h\324\025\024M\373\226\034\341\006\365,[\224"
+	.ascii	"\325\323\257%G\024yz6,\212\212\002N\317\"f\347T4\201\246f{\226"
+	.ascii	"$\301\354\245gDY\323\267rQB*\230\230\336\243\200\2403\277\274"
+	.ascii	"!\312\307\206^z\226\245\357h\224\004\224jZ1\025#\302\332"
+	.string	"7\245o\361\234\2465t\217\036\337Q'E\347M\013DE\027\327\230\363Y6'\304$\234\366\231\205\325D\337Iyj\363\033\333H\337D\317\336G\337H\317\0226\027\217\336\2030\247\302\346\361\314/9\255U\222\304\313N[\365\322\203\\\225\264T<\236\305s\2723z\346\027\2376\252}j\241^~8\350EH\210\355uU4z\326\314\251\256\350\231_\206Z\246$r\351}\337\245\2420\2479\301\346\030hp&11\004R\235\274\315\031T\035G<^x\230`g\266\344\t\344A\306\230D`\255{\350\277\210h\350\233\307,O\206\035;t\264B\025\354x6\3324(\364\314/E\355O\322\350\323\346x\341A\302\336\373\276H/N%\266W\266N\350\331hS\240\016\246\226'\331\352\264;/NP/RRl\257\253\216g\303\232\356 \360\316\246\356\240g\021\263\013\372\2166\305\001=\363\013Uk#\331\336"
+	.string	"=k\326d\326\324\006\235\371\245\252\343\375\24678lZ\213j\023M]\017X\342\375\363\314/W/X\3366,\242\245\351\237G\301\f\315\360\235\332D\323\025\324\0019\236-\263\225\311Q\344\263\305N\027\t}\276\rk\032\302\321\305\"\036\242\341xV\256I\250\307\213-L\222 d\235\274\200\211\275\214\215\261\275\256~= \016\233\202\226\232ch"
+	.ascii	"\317\020V0p\315\343\371U\260ig\247\214\225\372\355<\213\2474"
+	.ascii	"\325y\346\22736\252b\304\322\036\313\367\202\246\366\262\266"
+	.ascii	"\306\266\216\234\222\242\2639\006\006\274\264E\225\002;\347\231"
+	.ascii	"_\336X%\311\343\214\032W_\022\274\234\273\033p\354]V\324\256"
+	.ascii	"\016\347\373\306ws\021\347\3310\245:\033q\254\234\017\276\270"
+	.ascii	"#\2047\3376n\236\rS\232\263\231c\337\246\366\334\332\306l\236"
+	.ascii	"eS\212\253y\346\227:\266\310\013\342qF\355IO-m\255\361]\363\335"
+	.ascii	"\\\254\361\254\231\022\\\363\216=[ZbV\306\0226\277\rSz\203\322"
+	.ascii	"x\346\027$\254\220\344qF-\217Y\331\204\035{I\262\202\340\221"
+	.ascii	"'\306\006yy\321{y\351c{m\307h|\023\032\315|\323|\313D\244\266"
+	.ascii	"\200w\262\005\355\262=\363\037$m\346;\252\264\325\325&\224\260"
+	.ascii	"\024\320L?\026\310\313\037JRZV`\027W\336\220\227\301\027B\346"
+	.ascii	"\263\202JC2\205\354\323\007`\026\026\273\374\226\351\345\267"
+	.ascii	"fJB\375>\363\213!\353\343\005\021%)m\352\317\252\n-\346\373\215"
+	.ascii	"\371UN)\bF\221\225z\222FA\325)\037F\371kT\351\347\345\231_\246"
+	.ascii	"l\323\222\037\323\322\214\177\371\236\361+\233\222\217\313\222"
+	.ascii	"u\266\240$\245%5\023f\030\033l\222\222\251~\300#\361\214\217"
+	.ascii	"=b\221\2244Me\315\r\373\303\273\374\372v\202o\371\366k.\312\374"
+	.ascii	"\360+\233R\002\336\311m\273\354\t\376\203\240!\236\340;\332\003"
+	.ascii	"1\006\n\272\004\354\213\375\007A\353\023\213\0265\365\b\204\302"
+	.ascii	"\360N>\036\"@\325\372\265\251\303N\364\343\374\r\277\t\276\245"
+	.ascii	"b>\274\t\372\351\314\312\034\345\216\267\215\017\3575ZE4b\376"
+	.ascii	"2\357'\t\334\0138\257j}\007|:\356d(au\260\232\313\002\261A\312"
+	.ascii	"\036\037\345\317\017\333\353+\332\bZy\214gV\n)\207\274md\274"
+	.ascii	"\210\231_2\313\307x\025\255\271\310\362^\243;`\353\021'\327\264"
+	.ascii	"YC@\t\236YY\304\342h\t\301\362\260=J\036HJ\247\223\355\265{\370"
+	.ascii	"\022\244t\f\024\233\374\036\236E\243Q\305L>+\327\243\013\253"
+	.ascii	"\235\315\252\210!\240\013\357df\030\317\254Tbo$C\26080\2765C"
+	.ascii	"\242z\361\314J&\326&\031\242\246E{\361\255\034R\321\001x\340"
+	.ascii	"\341;\212$D\002'\226F\t53\202'\301\b~\rC\nr!\305.\225"
+	.string	"T\354\273\303\273\330\341W6\244\037\035\254VE\345Ub\016\257\303ws1\207_\303\220|Z<\263\022k5T>\335\302\365\211r\253K\351\345\305\366\252\022\342\360-\276\233\2138\374\032\206\324\343\243M \355\030\340\235\314\204,\300\326\301\344\bA\366\215\305\263xGj\032bT\001D\360,\"\370\216\036\315\255\020[\245~o+~\305;z\013\301\330\032\345\013\301\257\321\2436\020<\263r\310\272D\305\252d\315S\226)\317\224hJ4\020|\2735\210\350\321\032Us\f-(\325:zd\005e\262\360\001\350]\220V\361\003\317\366\320y`\310\263\003rqdh\035x\366\307\b\007\f7\340\246\202\205\265\265M\331Fd\003\317\372\024\321\300\267\0172!yzd+\274\223U\241\316@\006\336\315\216~T\300\300\333\212\306\206\201g\205\314.\3600L\343,\360\314J\270\225,i\304\2031\013<\3533V\201\351\223"
+	.string	"\024\240"
+	.string	"b\n\023\b\003\243\363\233\300\367\024\210\212D\024n\370>\022\263\273\341\275l:"
+	.string	"\033~K\013\217\320\206gw\260$\340D"
+	.ascii	"5\324\020\227\202\006\037I\025\366\362V\253\2756\217\206o\305"
+	.ascii	"\251\031"
+	.string	"\232\234\020\201\b\274\227M\327L\220\341\231yuZ\241\222*<I\225|&x\363\033\333k['\3037\342\022\004\276}xI\r\201d|\352F\322.\024\017\370>z\300{\331\364\351\200\270\325\251\242\211\242\215\240\003\276\007\217\032\3600\370\0051`n5z\202\306\200o8\243\231_\016-\340a`\022\247\200\272Uh\314FP\001\317\256M\251\022\360\314\312\273\025(i\024\204YT\362\221\240\332}\002\236}\313\021\303\267[\267\022\023\220\222\3467\026\206W\355\276i4a\372\224\325\272\207\341\235F\24345\023\247\315\305\272o\267\316\200o:\004\235\371\345\211w2\212\\\211u\371k\264\204\023\3756\376\246\337\306\367b\363\027\263A ![2a\343\327\345k\240\224\b\367\302\222\225'I\200=$\353\316\214\222\317\004\326\317F\360\205\357;\243\231_\336@\300;M\257>\274\362\f\377\002\246\034D%l$S\334\330"
+	.string	"z))!\356kj\330\034z\335\221\340\302\037`\245\221l%{4M\267\347\302\267\222\225\231Ta)\311*c\243\3443\341"
+	.ascii	"\257\002\323\372\032\300.\356\235o\321\020:\363K\305d\212D\022"
+	.ascii	"\004\275\352FP\337\376\320\260\023\275\350\232\t\236!\211\002"
+	.ascii	"|\013\337Gb|(\324\302d\3479\351\272\002|\347\361\261\261\tj\223"
+	.ascii	"\244\n\314\312<uP\251'\030\243\243\3443\001\213\355\265\205W"
+	.ascii	"\201\217M\375S\001c\260\270\237X\331\247\364S\372\261\275\262"
+	.ascii	"\360\355\303\013\316\020\350\355\235o\261n\004J\363\033\273\302"
+	.ascii	"\263\210\331\2550\367"
+	.string	":q\"(\377`\232]*\004\252|\200{z\253\237\n\277\032.>\t\360\314\312AUIrmKd\222\004o\035#\300\257k\213X)\334\331\355\325\321\371\245\360\252\341\342\025\nqI\344\222\222P=\002\343\263\266%*\2013\202\302\257e\213V\003xfe\241\332\226\\\333\022\2413\3141D*\233\322p\005\201$\357\214\251\210\272\246DT**\247K\266WUq"
+	.string	"\277\226-R\361-\026\245x\001\274\313\364\005\364\236\024\006\300m\227M\361/\226\210\225\342\233o1\310\345\026\177V`\234\031\206\006\246\351m\303^\206H\be\376R\304\t5j\031\214P\313,\204\222\r\2513\341O\030\213\351a\302\277\3004\002?\201\302\304\237x\r\224\376\2064\027M\374\227!\336\225xf\230\033\025\f\006\247e\026\372\370\362*\341K|7\027Kx5\020q\256\211\340\236!H\370\256\"\341\235\0171n\204\034uK\353\351\231\2257\302\253\201\210p$\236\031fG\275J\272{=j\274\303\t?\260\244\370\201E\003\336\341\204\030I\023\260\264\210\221B\306\016:\270\340\001"
+	.string	"\274\303\t1d\300h\361BF\f\037F\200\303\212\020\274\303\t1Z\340\220|\001\002\026,)X\344\360A\013\026\037d\254\200\241\203\213\030(;\310\320\001F\013\036\330\026/VH"
+	.ascii	"\007\226\025I\021\240\340 \003K\013\026\037d\260X\221\203\017"
+	.ascii	"0V\274\250 \006\213\0261\324\030.x\340\301\305\013VF\263\264"
+	.ascii	"p\221\203\013\0310Z\340\340\"E\007\0279\300H.@\006K\262\207\024"
+	.ascii	"\031-H\300b\305\r0d\210!\203%y\203\0160\\\300p\261\342E\013\026"
+	.ascii	"\016p\200\261\342\305\213$\2136\207\034\222-H\260\242\002-+N"
+	.ascii	"\260\002\206\017\023h\301\203\bV\304p\201\003\210\027>H\240\205"
+	.ascii	"\214\025,\355\213$\214\026\fh!c\005\013\212\f\030-^\300\320\301"
+	.ascii	"\005\017\tH\262\264\350@\301\017I\021\274\213n\361b\005K\016"
+	.ascii	"\253\f\030>$\027\300C\013\0300V\354\300B\005\007\013~h\201\003"
+	.ascii	"\f\031Z\360\340\"\207$\313\r,XbX\320\302\007\036V\230`m\341\342"
+	.ascii	"\202\002+d\254\300\301\b\303\0011b\264`\221d\271AF\214\344\r"
+	.ascii	"=\304xq\201\214\0308<\013\226\030\177\003\005j\300\341\005\013"
+	.ascii	"\226E\214\026\f`\301\022\243e\026'\364\020\343E\212\036b\274"
+	.ascii	"H\001\303\305\212\027)X\260\304Hq\002\bN\366\320\202%\205\214"
+	.ascii	"d\222%\305\221\231\371K\346\223\270\325\332\030\330\325\327T"
+	.ascii	"\253\240;\206\355\301F\201*\3364\3252\210\351\030\366y\236\347"
+	.ascii	"\375\231\357\373\276\r\344\213\006\261\210\313\335\245\232\226"
+	.ascii	"\033\304!\027\021\346`-8`\215A\024Q\bJ\243\353i\264\344<\215"
+	.ascii	"oA\304\037(S\b\"W\rV3`\355\314\240)\2042{\b\257\334]\372i\t:"
+	.ascii	"\034TIkfnq\342>b\220\334= ;\270'[4/3\3774\237\342\024\375\323"
+	.ascii	"R\343~\245!\264\232\363\321\"\324^\365\317\374\317\305\375\317"
+	.ascii	"\274s5J\017\247\350]\334\373!\033\264c\220XfnI\364\254\030\244"
+	.ascii	"\016`\354\334\262\232\310\370\364I\345\317\374\242\026\036<0"
+	.ascii	"?\305\211\2570k\203N\262\277\366+M\223B1\273(\177\267\367-\317"
+	.ascii	"jq\206\330kQjaju\313\210\306/y\203\345\277\333\257\375/\337\267"
+	.ascii	"\032\005\351\214O\357\327\336\265Z\003\301C\254wrJ\216\366i\213"
+	.ascii	"\323\364[\360\320\352\305\332\304!\025\364\307\3423\267@\271"
+	.ascii	"\342\373\3427\232\342;\336\341\317\314\241\317\025\005\274\351"
+	.ascii	"\227\334\247\334\251\205\312\330b\325rUh\230\370\336\324\236"
+	.ascii	"\344\216\370\237\367\314-\317\226-o\033O\374\327{G\374"
+	.string	"\n\372\356\356\232\213\257\367\177XHx\370\237\367\356w\370.\325\033D\013\007\277\n\343\240>\336\311\026\320\352*\343\362[\255\246R\321\321\277\323.\376\357\274+uJ\225\030\335\005\355\342\373R;\323X[u\t\354\357\274q\371\335\324WWhH\247\242\025\203DB\227\312\263el\204\n\226JV\213WK\331\223w\303\357\346\342\223w\245\006\021-\364\352\252\"\307\240y\216=\321\254b\325\"\346m\303\002P\251j\031k\031\322R\306-g-hn\3356\340\266\212\030\002\322h\216\201\352\235l\302\217\020\220\226jo\236\0038!\242\206jm\376u\376\346u\276\253\304\242\323N\262\257\363\355\315\273Q_\340\f\355.\310\233\240\\O\025\252\251D\345\025>+8\030\350dM\305\311\311\263\207\203w\204m*K\204uM\336T\234I\305&\317\232\r\316\r>s\013\234\312\221\212\301_\361\006\343\342T\212Z\346T\210J"
+	.string	"m\251s\3678\270I\273\263\021\224A"
+	.string	"\023\221\253\226\262"
+	.string	"\333\346\374:\266d\252\343.\370\314-HZ\222x\333\2649/\002\347]\360A8C+l.\2668\357\316\336@p\360\371%\370\354\353\250\300om\336\375T\202\372\305\336\003\037"
+	.string	"}hj\r\365N\346.\201u\300.\201}\261w\300w\243\226\300\031\221?\032lu\203=\320\245+>\275\223QttS\313\374\265\251\275N\364\347\374\315\263?\347}H\311\317\030\220v\312\371\226\371\0318\235\351\321 \372\203\252\374\264\344\251\344h\321\013\2614U\361A\373{\037j\020r\202\210\034G\203\311\263\233\244\317\334\302\247\302\223tUv\244\202\201\31510\371\365\251\334H\202\303\261\301\344\335\357Y\302\017\372\336\231\274;FC\313\205\347}\357\373vk\337\201\266J\233\377\357\263N\230>e\f\314<\372\337t\276\367\350\267o\315E\276\367"
+	.ascii	"O\260\315\367\236\271\305O\205&y$\31432\302\3542\2452\323\362"
+	.ascii	"\307~\200\204\020mHEF\205\331\022\3302\330\322R\310\366\312\022"
+	.ascii	"\356}\007\032-y\327\373\326\311\254\227\336\351\262\276\344\177"
+	.ascii	"L\311t\311wT\260\213I\233\020\334\202.]Q)\317\360\250\230\350"
+	.ascii	"\227\367\354\241\340\225\022\304\243\241\212'\204J\336\2030A"
+	.ascii	"\253$\212G\302d\223$\337\232\tR\341=s\313\364\030\250\002\020"
+	.ascii	"\357YA\301\"$\313\243\037\023$\317\036\n\0169\364\231]\230G\276"
+	.ascii	"\344Q\357\270\347B\343\322t\251q\251\201\366\025\334\016_s\f"
+	.ascii	"=\236\217\320\243\022g\\'\255>\336\357\240G$'V\037\337qw\017"
+	.ascii	"B\364\017\021\311\316\356\375\257\311\321;\231"
+	.string	"\377\356x\324\325\3350\242\250c\bhD\367|4r\224+JBD\367Ng\344\bg\202\356;\t\035\235\021\304w\356\371\250vl\033B\262\243\315{\237S;\026)\321\346}#\2313\222\303\020P\356\371Hv$\"t\247c\215z\227#;\226\221\260F}\337\311\325\0311\204\306=\037\301\216cAu@\254\337{\034\3301l\004\326\357\273.\356\333\2551\200\313aX\304\020\360\310\363Q\353\b$\311\375\364>\224<w\310\370\364\247\347\\nT\330\024\241\314\316\361N^\237\357G^\004b\321\243\326q\213\304\372\374\236k\021p\330\211\351\235\3518\362\037\b\376\005\301\341\034\261~\300}\313\366\347\343c\304\310w\364o\007\307[\316\261\212\352\355\331\250T\261\307\315\355]z\b\235\371%\317;\231\245RA\350\314/\245\201;\336\326\366\246\303\266sdZZ{g\373\026\255\271X\344}\355A\360\243\241\305\364)\377"
+	.ascii	"\244\366^\344?\360\243A\304|W\373n.\246}\213']C\3539\"\035\265"
+	.ascii	"h\337\262I\275\210\370\034\213\222!\210\210<\313&\355\3129"
+	.ascii	";\373\216Jo\230\375\034u\004\231\375*(\305*\013:\346P\021\302"
+	.ascii	"g\315+\373UPz\205\343d\317B\366\035\225Z\r\021:\356$u\206<\033"
+	.ascii	"&\245\0222t\304\261\341'\344\325Ci\321X\321\261\246\306\333\330"
+	.ascii	"\253x\322\241 <\2164*f\202\274z(\025\022C:.\223\356\322\364\370"
+	.ascii	"\272"
+	.string	"8\225\\\230\230X\027\223\006\2715\307`#\354\231]\234R\022c\224F >[;\330{\330w\323\215\351`\337\232\365M\373\346\353Y\304\354\276\276\243}\212\356\365\314.P)\205I\344^\na\212\023\027)\027*\027+\027+4\367\222\353#\\\263y\347U\212`\240_\327;\220\256_\017\373\346\270\260R\244~\212[\357\\[\317\232\365\305i=S\2426\214X\332K\341s\331\352r\361\362b\375\371\256\365\335\\|>\033\326\007\227\326n\244\316\310\020\260\346\316=K\314e,\353\333\254\357\347\254M\364\371@\227\256X\003\353\223\244|\265\377x\307\372n\342@\3422\344\307g@\356\316\020\350\252,\345N\205\005vy6\202W\377\202QE\037g)srqo6\2028\332\255\336}\374\352G\243\212\351S\366\252w\253\357\346b\325?^\024\221\n-\305\310\233\333\324;\325\324?[\324P\352\231]\324R\326l"
+	.ascii	"\261\347\262\226R\304\245\315\202=\265\037\213z\227\372n.F\375"
+	.ascii	"\263E\013\241\336R\210$-\3303K9s\201\213s\231\233c{uE\250\367"
+	.ascii	"h\023\350\314/\233O?D\261\223\254;\275?}7\201\2028\375\006\350"
+	.ascii	"\202h4\2059\323{\223\027\323\263\310\3015\215/}G\243so\363\366"
+	.ascii	"\3253\256\364\314.w7\336\225\376\270\324\327\\L\241jf\227:\027"
+	.ascii	"\276\350\317\326\313l\346\313\037\3336\275\347h\177\202:\002"
+	.ascii	"\033L\3226=\247\276\205\372\266\351\033\013\312\352\333\251\366"
+	.ascii	"\307\267V\377\204M\035?\336\201\272\004\222\233\230\236\220D"
+	.ascii	"f\313\030\300O4\263\313]L\216\231^/]\220\3004\243z\205P\246P"
+	.ascii	"ON\277r\3579\032\245J,\332\343_\316\252\3077\2168\305'P\232\253"
+	.ascii	"\357\333.y,\263\213\236\013_\216n\034F\274t\f\001g~\311\255\327"
+	.ascii	"K\265B\276\r\373\326\353\273\211#\345)\005\352\345\217\373\211"
+	.ascii	"]\372\\\374\374\330^\333\260w\371Z\264o\205@=\212n\321\336\205"
+	.ascii	"\272DO\032SOH\"\323\2471\357d\024F\272\354\224\353\323s`\244"
+	.ascii	"\353\306\313\277\365\337\370\033n\017\260+\323\2574j^0\357d~"
+	.ascii	"\372\325LoN\351\374>\022\213:\337\315\364\230\336s\364\006Q="
+	.ascii	"\257\305n\267N1\262U\304\020p\351\212/I=\234\216\364\236\364"
+	.ascii	"\354[s\221\314Y\276g\365\236\331%\320e\320\333\306\221\236\305"
+	.ascii	"\333\212\203\322\374\262\277\220<g\034\021\246\034\251@\301\303"
+	.ascii	"\217\236\305\333js\037\2528\027\347\361}\304\343\335l\313\313"
+	.ascii	"\350Y>\243W\345\266\272\212\236\325{Wl.z\321\253f[[N\364\314"
+	.ascii	".\205)B\311\021R\202Rt\270\030\272 \272(\272(\022\275\3534\210"
+	.ascii	"\303\255gK\214\022\353C.\323\0314\3366>\364\035\335\302\362\277"
+	.ascii	"\366\2669\035C\300\037\274\2303h\264\016\233Z\206P\346/O0$*\364"
+	.ascii	"?\204G\350e\244\321=\313\332\204\326\235\tt\274N\273\254\007"
+	.ascii	"\275\353\370n\342\300I\316\250\211\351\tz\2264#+\331\223\230"
+	.ascii	"\017j@\377j7@o\202\264\267\034mB\353M\206\226\277N\363\033\313"
+	.ascii	"<\003gF\216VW\214w>[?\233Q\360\327\332\177\376\331R\232"
+	.string	"\376\363&HK\353i\023ZO\350\322\025Yr<\363\214\235\024\232\224\031\302\034\317\206i\t\371\364\244,\223#\366P\246)\357\f\237\237\031AAl\257,\232\317\263rZ;8\236y\206\020Jbr\204=&(\2108\004\261\n\021\233c(\201\367\024\366<\nh\205=8\317\020\n\341\f\272:\347\371\236C\021\364\235\177Akb\230t\235\207\241\363\215\207\325\005#\247\b\345\017\317/\347\373\216\311\215\257\201I\020\016\017\224\350\214%8\337sz6^\225r\021\r\335 \241\344%gDa\304B\334|\257\341\331|\rwA5N\024\250\264\256\346{\253\256\206a\363\347\344\224z3\004\233\337mp4\376\005\315\356I\363onN\320h\276\341\326|\346_\320\352\234\211\242\226\034ao\206\022J\232Ro\306\2413\277\337\316\\\346_\320\352^\260\036\212\212\250\004$U\212J-\264Z\222&\235ajH\006\303\b\240"
+	.string	"\243\030"
+	.string	"\f\005\002ER\325\024\332\001\024\200\031T\220PXZ:\017\315\004a\224\205i\016\253\022\001\n\b"
+	.string	"\202"
+	.string	"\236d\351\230\340\217\326\372\241\307raG\001@\374`\371#%5\025\241W\251\213\364\b\013t\341vU\264"
+	.ascii	"\3115\024\222\317\255\362F\327.7\3732\005\312\001\315\002@\226"
+	.ascii	"\027\030\232V\350\223\221\200\363\f\200\367\267\212\031\273\340"
+	.ascii	"\211\303\325\312H\220\3221F\241IS\036\322\252\n\303\370zj\247"
+	.ascii	"dF\372&i\261\305\0270\311R\200\253\035\241r\237\210\244s>GF\324"
+	.ascii	"c\201\2244\234\344\277\030\237o\265}f\247H\346\177U\255\330\003"
+	.ascii	"G\003\376\204,qm\273\262C-\365yk\356m\032\2504\237$\363M)+\362"
+	.ascii	"\274I9G\326\357\274\330@\002J\366E\236\034q\274H+\001\240\236"
+	.ascii	"\327(S\266\266\2134\030^\354V\210H\253\326\240\310\031q\261\326"
+	.ascii	"$\231\035\343\304\256\225\265g\316lS`\377\344+F\3550tw\324\246"
+	.ascii	"\226\342\017\364E\2518\036wa\001y\336*\036\251\302OI?\035\314"
+	.ascii	"\371E\365\302\213VJ\026*\254y\251\225\361\320m\270vi/|\232\237"
+	.ascii	"Q\200\263V1\310p)\253\234\364\237\3152\303\222m1;F\243\367|\205"
+	.ascii	"\246\265\0065\276x\035\213@\003\300\236\315q\346\211X\206\re"
+	.ascii	"\364$\f\253\350\305\222\344\315*\032\344\"\005\222\242\356\204"
+	.ascii	"\242\263\205\001\215\265}E;\273:4\271~\333!\207e:)\352\356\251"
+	.ascii	"j\331\373\023;\337ZIj&\306?\233<\016\035\256\031{\216\267\326"
+	.ascii	"r\312\321ha\317:t=\032z\r\363\200\252:\364\177;}\366$D\330oO"
+	.ascii	"g\221}\260\330\0162[\321\323 E\245\345h\256\021\013\240Q\203"
+	.ascii	"\306\270=f\234\215\324\2638\232:t\360\016(\025KK\300\317T\002"
+	.ascii	"lb\337b\260\201\032\033\275\025e\t-\206e\273\3734X\r\262\326"
+	.ascii	"\335\322\347\330\375\230\034\271w\343Tkwn\310\257\314r\265\242"
+	.ascii	"\243\205\331\217\222g\001\220vn\"\225\b\364\277\257\240R\007"
+	.ascii	"/2\264\200\321:K\205\206bru\026\023\346\036KV\274\032iT\225\324"
+	.ascii	"\302B\032\310\277\220\201C\005km\224\0041.\"\031T`\206{\006\361"
+	.ascii	"\217\245\033\215\230\213\034\205\244\"pE\177\362\244&|\354!\213"
+	.ascii	"\21055\227\364@\004\234I\177G\234:&\361\246\347\0376\340\221"
+	.ascii	"[\215\\\315\003(\033~\003'&9\253\204\230\361\034\231\361\277"
+	.ascii	"p\314'\207&\250Y\227\221w\277\034\2169r\323\003\234\347\277\271"
+	.ascii	"\213i\273\235\313_\217F\316y\224FH\274\n\002\b:\217\216\203\332"
+	.ascii	">\037>\033\265h\373\2122m\351\347\2741m\252\334\006\242\243\217"
+	.ascii	"L$tt\313\r\311[\361\370\301c\301/{\b\370I\337\220\373N\311\347"
+	.ascii	"\3109\323BE/A\242b\265\213\270q\362r,W\302/M\f\004R\2545A\213"
+	.ascii	"T\037hL\324\335/1\322\005?\"\3126hR\370!\331/\013k"
+	.ascii	"\232\244/]\217\r\331\256\317\354\306E\2618\343\306\3056\313\205"
+	.ascii	"\366\005\325\021\251\b\337\320e\361\025QY\202\020\264T\001\273"
+	.ascii	"\270\031\257"
+	.string	"\355#\003\031\307p\352\020\257\004\222\2354}\213\001\266\305S\223%\022\241E\375\375\332\354\033\234x\304\252`\274\026\352\215g\364s\204p\230\032\2411\373>*Y\276\270\344\251UU'\177h\347/\341\360NL\026\304{\204\033\350\254v\335\327\366\"\213\345\033f`uq\222\005\rY\034\335\244\361\2423\320MF\222t\370<\344\260\036\311\0046\340\036\266\373\321_\302\342\234\324\020\376&\254\222O\360\377~\024\005|b\363n\272C\376{\304\3646\326\n\260A\262\257q6m\003\037\372J\034x\313\250\244:\021\313\303V\205\3717\b}{\221O_\211Ed\260\347i\037m\362!\370\370\372\377=\345\227FL\344\021ce\266Z\004e\202\264\374\332\200\253\360\202\223(\2022\016\275\027m8\026\210x\245\344\207\007\264\372\204Y\243oR\206\262!\223Tez\313\210\315o\266OIr\022\376\255~l%\230\271 `\210"
+	.string	"z\250~ KW\202.\371jn\361D\261\351h^@\313\213~\353h\225\031\022\326"
+	.ascii	"\271\227\374?\350|\315\\\215Q\214\310\264D*o4t\214\303\340\327"
+	.ascii	"\216\375f{\325\003_\316\247x\211\037\204\312\334\317\334hAD\035"
+	.ascii	"\274a\203~&!\227\177.\232\340\030\264\313\363\277*\354\373aH"
+	.ascii	"V\314,J\313\030 O\364b\003\217\276\215\b\242\037\206\035\305"
+	.ascii	"w\377\275\353\366\026MF\020_U\022\037\236P\340/\356q\342\221"
+	.ascii	"\2276\2436\3430\344]x\215\256\330n;\374\211\024\247|\225\331"
+	.ascii	"\310\025\376\361p\035\203%2\nI`\236z\\b\270tE\245\b4\336\006"
+	.ascii	"\222\017\f\325\274/\234%\320\357]\236\374Z\330\204Tg.:\303\211"
+	.ascii	"'\353\236\230\fGXw\341\2602\333z\231\016b\237\233j:\263z\256"
+	.ascii	"\266\304r\031\204\256\357\034\316\357-\223\354Vb.M\242N\264L"
+	.ascii	"9\007\232w\007P{\374\031'D\200\230X|\206\265\220\317\233)(]O"
+	.string	"\201\b\224\204\263\242\305hvzW-\270\352\362\301\265\320C\303A'%\262\\\234\261m\364\373\222\b\347x\375\215\007>-\303\017N#1\257_\032\362\342\232\343\223<\224\211-\036\233<\226-\206jc\366I;$\340\351\240g\300h;\374\262=\2523\276\035\246* \233\242\177\377{&\231<n\355\3117\303\021@]\341\321\365?P\263V\2021\031\002\005\370\3552\027u3\303\275a0j\335\257Z_\312_\247.c\341\006\312\t\bIK\307\240\236s\334\0200\240\225\037\026\bl\371N1\373\245\0130\025\346\331,\225MV \365\336k=\317\346\374\227\272#\214\202I\f*p\324\212 5\344\013\377\200:+W*P\337\337J\303\345Agm\205,\206-\267\216\253\322^\304\177\244\270\270S\026\247-!\2134v\243\t\210Wx\3643\224\375\211\241\0379\260\025\f\2170\332\205R\204P{\230\262\277\341H"
+	.string	"\007\315H\227AB\221\022\250w\275\211\027~e\2501\017\223A\375\212%r\315\b\373\342\242\343\310DU\352\246\022\303\3066\035\374\n\0130\215\222\013\225\242\213T\341N\003J\034\2410=Zz6\326\323.\213\251\261w\"\217\r\226\334\006\312\327\354_\305Q\210s\207gZ\256\341a\037\b\232"
+	.string	"\035\201\324\307\352#\253\f\331j^\217\304\355\030\275\264@\351\363>\202v\f\353\336W}\370\357\204\232\016\260<p"
+	.string	"X\fz\314\2549\256\352\256\343zP\016g\351\016\352\243#j\2030\246\033\207\377\2002\376\242cCD\320\001\f{or\024}f\266\353L\344\307`V&~\037\306\030\365\225\337\274\005\257\270\262n\351^\320\035y\306\272N\002\276`\274$\212\366\017E\304]\204{\306)\rLS\376\265\306\313\344\366\323\310i\036\360N\b\230\220\354\236\210pJG\204\251L\363LY\330\324\203\004("
+	.string	"\\\th\315\200>T<\013vF\337\235\275\220\013\037wM\227\363>(\312\346J\273\250\327\303g\233Gx\262\204\207\302I+!\234\235\021\0042\304(\305q\2662_\"g\231\366Do\263\201\245\002\244\255gx\233C\026q\276\033;\315\224\207\024n0\324+\025@4\013\215\201ud\033\207r\261"
+	.string	"\203\265\244\br\203\252}\277~\006a\244\025\2056\305\207K\266\265*\315\227bD\031\323V7f^\374j\022\300\232"
+	.string	"\377,\3612\031*.b\242\302\0163\252\273R\366\316\272\303\213\344\013\270\342Pw\304x\253o\250\237\007m\b\"\301\321L\246\354\215\255"
+	.string	"@\277\335\244\231!\005t\024\324\303\202\n\036\027\312\366\202\214\307l\251\240\350\312\201\324l& 9\233\252\354o1\\\374\246\017\234\310\035F\233\021\004\025h\330\340X\335K\200\230\233\261\324B\207t\245\005\230\374\034\246r\337E\0161G\2658\301\254:+j}}\344/IA\204\016\332~d\247\362\361\031\210v\332\3479\256\205X%\202\273\230\352\241\370\254\222\027\357\252\2350\"\007\350\3130"
+	.string	"=+\343\243>L|#\375\344Y\326\374U.L\255%A,\361\032\005\234x4\350\2765\"\322\222y\354\004\225\257\341\n\362\222\024\344\377,\266u,\036\374\240p\031\251\311\001\366\300 \307\024#K\025\021\340e\305T\226\360\306\024\301\221Y\225\215]\230\240\306\351\006\001\360\255\204\264\272:\002\207\334Ys\252\305\t\371\227\306\347E5\316\340\201\027\301(b\362-\352:`:\\D\236\242\020^\201\241\374\217w\n\277f\tJA#(\032\311g\335y\003\360\300\374\001\372\356\001\022\202\003\013\322<\345\303E\255n\005F\245(\020\333,\323\232\245\242d\232\"\377C\234o\t\312|nI\322\323\345\027C\210\375<.\020V\300\013\035.X\310u\024\225\364\201Iaj1\230\226g&\345C\231\374\231\211ZN\036d\020\373\231\026\272\234F\264\252\002\n\036\364\031G"
+	.string	"\354\371r\360\226j\203\002\261\220\261?\215%TGL\021!\377H\331\244\351\353y\363KjY\350a\026\231\0307v\003\357\2429\344\222)V\206z\336I\321\300\331\007\254\213\221\324w\303"
+	.string	"c\226  @\241^\031\207\376\307\362\220\t\223c\365b){\256\333\322%\275\353,\375\277D\315]\013\006tR.\315\367I8\354\321&<\344\265\315\201\275m\345\241\004\001\267E\006FB\022\240hRm[f\302j{B_G\315\374\260\357&\311{\215\351x=\301\225K'GxT9O\274\313kU\311\037/\302\340*\b\244\210\2451G\371x\260\2771\272\220Stn2\202\371\314\203;\345A\362\321\027\236\373\034\204U\221ob\237JG\001\306\363\257\346\331N\365^-\333\273\036\334\314v\212m\t\212\345.\270,\2646\306k\377X\337I\022"
+	.string	"}\211\365\217\327k?\201\033*\331~=\002\340\314B\352T-\225\017\306E\3177\344\275rj\244"
+	.ascii	"\177\037\322\366\034*\013~%\b\332\016?\036\204`\245N%\276\200"
+	.ascii	"\237\332\376\374\305\001\fJ)[\366(O\340\035\021\200&{+Z\004\236"
+	.ascii	"Z\301\n\234h\003q\210\r\2253\367*\206\317`\034\t\274\017\353"
+	.ascii	"\237\357\265\357\373\206J\361\013\335\227:2\035@\227\217\207"
+	.ascii	"\013;\350u+\346\232sGhN#\023\020U2\351%B\231\351\366VDb\224]"
+	.ascii	"ax\325\\\241\253"
+	.string	"\357\312Y\017\260\231\262\356xS\277|\344rv4\303\272\301\201g\201\321\237I\211\210*H\037\266\325>\317Y\231=&\211j\321}\212\355\345\315\242J\027F7\221\251\200\311\215\"Q^\004.s\340;\207\253\324'\204\302\244\017\020\001\253A\271\340\214\304\377\275s-r\302F\342\271\254\200J"
+	.string	"\324\361p\227l3\364\225\307@c]O\306kJ\271\303\204Y\304Ic$\f\276\235\265\224p\203:\311L\373\n|\220\311\264\257'Q\224U\301\001\245l\235\002du{\256k\252\257B<\306\261\345\021\3715T\354\245\217\366\017\222\206\013M\222\242^\210f;\241\025Y\037\247@\216ZD\243\0328"
+	.string	"\336\227\024\341\342iX\005\257;\022?~|8K\0163\314\275\375\023q\336\303\250\364z\206.\226\374<\236\317\020!\252h\232\222\302.0\034\220Q!\374-*\027\201\350%\211\233\0078\264`\354x\217\202\351\201J\3225\004]\177i=M-\336\322%\237W a@\267|\235=df\n\343\034\020\024F\035\243\362\214\214\321\032|i[\024\342\244\321\\Xj7\20052\224\371\2645D\326M\332\037\230j\200S\016{\332=\270m#(\212L]\245\201\221/\367\365g@fT\2532"
+	.ascii	"\347\201\350i\034\rJ\020\352\022,\022\232 P\254\273\210\264\210"
+	.ascii	"d\227\245\241\036c\364\230\2379\005Mp`\216"
+	.string	"\r\244\3153\226m\324\n'\274\243\320\006\344\311|\3568L\227RF\306\217[*\350\244\345AM\311G\250t\232\026\0012=^n,\177A\033\264\240p\215$\356+\357.\356\267\245\004\234\270f\320\372\235\025,\003c@\016\2340cdn\367\226\300\177bn8hJ\277\3750cQ\322\323dQ\347q\036\325T\317\226\337\350\024\rP\022\203\331{a\23736\212\\B`\310/\315\020b\235p)\030\300\023q\273S|?\224\246\210\013Z\271\355s\234\2547^\2233\272\256/\n\213\243~\256\343I\363\214\240X\220\341\367\211\351\335,jE\034#}E_\342\362+\266\302\t\233\320\006\335\262\360\021\305\037\005\245\244\223cD\210\356064\231\3036v\232?R^\016\310}\346\247\212\265m\327\2520\352\201n\313\375\340\360\371X$i!>\361\363<\212\361[\321\257\n\266 \365\370\355\327\tL\277\032\236\3755"
+	.string	"\033>\332\261M7%|\355\"\020\254"
+	.ascii	"\f\f\211\003bp\031\234\224\346\032\225s*\251\242\326\303\267"
+	.ascii	"]\224\363s\260\337@\256@!\316Yl\305\007@ :\217\315\263\3708\265"
+	.ascii	"\331u\251\276\221\303\270\"d\200\220"
+	.string	"\373\302`g,\314\266\3055/\2656j\207\003\246\203\227\204`A\217\301\356\257\344\237a \345{ur6dl~EUd\200\227G\232*I\034\247\365+\220\361\265T\237|\351\323q\225H\263F2\303.\306}\252\004J\0324n\241\n\001V\363\230B\203\030B\214\327\256w\310\335\271\361Q\336\340\325\3058a<?-*\2044\245\243P\024\025\032\225\201k\227\272t\214\215|\304I\337\333\215R\230\234\351\354\364W\326H\017o\301\261\316($\361\246\273\340\323-y\247\266\357\272M\363\n8\311y&&q\321\177g(\266!\217\351\274\033\026\226\007{L\223\317\251\255]\252\376\037\275?r\243\375\324Fp[\202*\344I\035$\362kj\332\301\261\204\007\177\3664\263\016\353:\326\365*)xm\201j\352X:\0262KK{\207\237f\\V?\327/C\330p~\3761\232\3023\337e\255\233\341\333\333%\364"
+	.string	"\356\332\361\314\006Y)\347"
+	.string	"!\267\355\365J\231\0223\337\003\361\252v\254\026\342e\205\324C\256)\221vi\016"
+	.string	"\361\024{\341v*\263\001\214S\373\305E1-\267L\360\340\370\005T\314\363\006\316\271m\221\315\257\307<\177q\321W\274\341\323\342\316\350\335|\213\233=\267[\004\366:9\tK\335\232\032+\260\241p*va\001\223^\323C})\274\001/+!\201\335\350V\277\321\221 \217W\330\261\330\2525\241\264u\205\351!\366\251\026\313\305"
+	.ascii	"\233@r\200~h\301\356R \204K:\276\003-\354\234{&\004\322\321)"
+	.ascii	"\341_p\336\016\320@\023!\364\n\354\203c\300\203\245+\220\226"
+	.ascii	"\017\223\243\302\276\r\323\250\304\337\200\364\274\332~\330\n"
+	.ascii	"\222Hk\246\2052tB7'&e\300+)k['\244\312]\216\324m\334\267\256"
+	.ascii	"\\@\304\0069\340\227\324\340\007%\026\033\246\r\207<\372\037"
+	.ascii	"\265\220\365\373\363]>B\364\256D_\266)\211\207\t\347=\256D\306"
+	.ascii	"\347af\222\330\216zK\245\0244\342\266,PB\004\r\263\331?E\334"
+	.ascii	"\3778\016\204!\246\001\223],\344\374\335\334\362\323^\r}'V\016"
+	.ascii	" \375\357\205\020\325\212\262\262\024&\311"
+	.string	"[\3265z\312@~\317\n\313\205* \230\360\261\335\372\177\236\322\007C-\250pI\242y\275l\347\332\371G\0303\200\222;<({\235\024\t\231\377\347\212\006P\304\203\263z~m\021\365R\230\r\034\220\217 D\262\257\303USU\223\214\035&\304\352[Q\212\2303\237\262\215p\247\036^\325\245\253n\253\327\355M\030\032S\013\374\303%J\262\020\016\365\363[\307.\340\304\272n\243\002\377\237\351\312\314\264\2141k\362\342%41\242Z\262\354\255v\220\n\005NN\2465\247\001\210\020\210\202\365\337\230\223ex\333^\326\314\345\240\203\312,\334'\016]{\200\225\216v\376\324P\332\270!%\372\252\322 @\241\243\271m\\\202\314\220oq\237\377$\035\024\003\332\303\005\276\r\252\206\261\374\304g\223$\251\210'\225ma\266O\324\332\n9x\270X\030B\221\003\344\024V\327t\0312\305\241j\226\250\237\343\211\344w"
+	.string	"\201=\356f%\274rqk\326!\240\334\243\025\371V\233O\t\200\225\226{n\256\027\376\313\202\342H\265;O\265\177?\006\210\351\035\230\333NJG\337?2\232$c \301\351K\251~\306\264_B\203\033\347I\235\001\305/0e\007\270\016\271w8k\206\337O\206A{\001\330\"\2575\232\200\373\233f\316\263\305y{\006_\216\\\202\345\2202\020\031\336H\261\023\336a\210\230\345\221\353\304\245K\223;\200W\311\253\375t<\347\221UX8A\217\260\213Jt!\210\213\372\207$X\016Q\303:\354\231\2372S\264.\252\230qq\206\206\271\rK\300\374\b\340"
+	.string	"\001\364\037o\005\334\266\335D\027]'\207a0Jd34\032\035\013s3z\323\222\fpXK\353\336/w\207\t\300\024;\214<\\ \325\214\220\2751e\266[\020K\326\306\373_\240'\020&\220\023\315m\372\217g\016\247\022\267\201\370\bJ\263\352\020\261\r{\204\314\232a"
+	.ascii	".\203\375h#_[P\273\211q\213\304\b\320L\237s'O\277I\324\201p\357"
+	.ascii	"hSH\005sr\024m~v\340[6\200\337*\351\214\022\035\221Z\003\362"
+	.ascii	"\320\371;\021\363\013\022\262\344\t\233\2209&\205OY\261\236\215"
+	.ascii	"2C\202K\367T-\207\200\234\230'd\307;J\356^^wYWy\033E)=\262\213"
+	.ascii	"h\021zX\2468@o\342W\306\220\017\305\213\261\2062\202\037\235"
+	.ascii	"\364\364\275\246Y\235c(_\026UV\325\325\262)\301Q\270\243e\023"
+	.ascii	"\220-\377\220r'\007'T\244[\027\023\355\364\017"
+	.text
+	.section	.gnu.lto_mspCommonProcessInCommand.181.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\377\0255^"
+	.ascii	"\232\230\004\"M0\220\332\031\003\02700\007"
+	.string	"dU\360 \322\214i\260\354\274\0055\341\242\365\354%\304\013\033\271\337)Q\034\032[ $\356\347GV\344U|\234O/\216ki\f2\177\256e%\033'n\260YOU\303Z\220g!\023\356{K)SJ)\031\002\324\001\026\002P\226\364\224n\276n)\335\324n\273\277)9\372u\276]e$\257\216\007\f\334}\214\344\323q%\257\315\202\336\223\022\325o\326\353\203\020\217\332\345}\343\240\216\315\262\227.\t\022a\220j<^\001\230\270\306\334u\334O\372\216\221v\030\254o\227\0138j\332\004\001\230\370\321T\f\212\250\342\336\255\031-\305;7\021\315r\002\307f[\346\037\314Hfn\235,\347>`\341\302\024\024,\013=\367\243\3512\350\261y\257\344\340\356\3367n\211I\304\035\327\270^\341G7\361\3416\357\225U\230\322\261Y\033g\367V\201\003\226y\337\350\342\335\373\276K\214tl\266\255\335~\260{"
+	.ascii	"VU\220\021o\205\315\271\032\336\367m*\352\235\266\331\265s\332"
+	.ascii	"f\237\214\273\327\270f\326\335F:\342`TD4$\024\004\364\343\323"
+	.ascii	"\263\201gG'\007\347\306\246\206F\231D\316\310\034\215-\233\264"
+	.ascii	"\276\273\334T\2154m\004\200\224\005\272\201\211\006\251\353#"
+	.ascii	"\016k\237}\205\265\340\263m}\021\305\n\225V{:q\243\242\027\324"
+	.ascii	"\236.8\021\\\017\301\375\251\340B}-C%\357\005\303h\220\266\016"
+	.ascii	"\002\022|\272\365\265\371\317\n\303L\206,-\370|[mxu\245\340>"
+	.ascii	"=`k\276aI\363,\031\301w\320Z\007M\211\347\2345\316\232\304\026"
+	.ascii	"FJ\013>\317\326\037:,\263V{\232\371\315J\002\253\006\260\026"
+	.ascii	"|\262\255\3110M+\275W\34665k\210.x^Z\360\t\266\356l\215\340\354"
+	.ascii	"i\033\251=\303\234\206\305\013c\242\354\252\272N\342\021a\202"
+	.ascii	"\214\3222R< \2063_D\332\0353\275\263\216>\241/ct4\306\210\006"
+	.ascii	"\001k\243\340\263\013\311\325\364v-z\337\227\206+k-r-\256+gm"
+	.ascii	"\230\b\351\244\265\305\333ZY\013>\251\3537ia\017\311\225\345"
+	.ascii	"k\337\365\252\006H(\207\305\t\227\220\376\266$3\\V^E\332\031"
+	.ascii	"=3\275\216>\247\255\033c\274\357\313\356\344\n\322\334\241\231"
+	.ascii	"\235\217\231A`\316i\006.^\013\203\326\305\327$.r\3516\"\370v"
+	.ascii	"\305\276\224\273\271\016\005,S\222\376\b\263\377\337Q9-W\036"
+	.ascii	"\206\327g\277\225\232\206\250\343\373^\245\340>lD\003\326V\322"
+	.ascii	",\317pj"
+	.string	"\333\331,\267\3233i\201\"\365\377H-E,w\206E\232\254/}\251\3679\037\005\026\360v\372\367]\343l\251~\0056\226\366jW \225+\262\236\231^\222\177)\027rs\341\302\034\212]{\356\034\344\236\201\365\360\246i\257X\026n-*\352\322\336\367\n\267\f Z\214\nn1M\220\273\212Q\373h\233u\006\0062s\341\361}\251\272Hac)\313`p[{\305^\020\315\316\370\242\246/\362\214\357\3573.\\\232\213U^e\036\227\361\3146\034\360vrO\273\245{\200b`\272\\=\025s\234\225\277\224\271\327\367\2170\263s\203\265\223\356&\322.t\267W\253\320\335]m\327,\325|\3156d\234k\364\224f\032-\245\331\251\233t\317h\272n\0312\3160\330\371ES\233]\254\316-Vg\026\253\363\212\034g\0259\316)r\234Q\3448\237X\235M(\235K\254\316$\222\316\001\254\316#Vg"
+	.ascii	"\222\316M\2533\023\216\363\322\352\254\204\343,B\351\034bu\006"
+	.ascii	"\241t\376\240t\366\220t\356p\343\234\224tFR:\037)\2359(\235\215"
+	.ascii	"V\347\"\033g\242\244\363P\215\263P\3229H\351\f\244t\376Q:\373"
+	.ascii	"$\235{\224\316\033\224\316<"
+	.string	"I\347\035\245\263\216\3229'\351\214\243t\276\241q\266Q:\327\3208\323(\235\2254\316I\24532\351<\223t\226I:\037\233\332lL:\267\2533\233t^W\347O:\373\352\334\r\265\300N\256\312\334\033\227\307\022\367nU\307\274\201l\337N\307\374\306\370<|q@\027\032\003\253\350\341\333\351\330^\0070\356\247\243o\316y\330\341\333\2741\275\244gf\212\361=\246b\222\236KaV\251\\+\253\266Y\366\017\351\223\276\221\236\035\034\203\233\216\261\335D\001\373n\252\035\325:=\233E\007\347\364\275\327:yc_[Z\304\330\020\233#\273'G\212\034\246N8\2101j\301\205&\321\031\201\t\n\341\r\205\032\326k\213~J.\206+\017S\364=\030\375B\204\345+\270\315\270\241'\032J\024\352\300\337\\-\267+A/\364\035\204\b\004\304\331\326Z*\320\267~Q\303\237-7\241\004\237\377\351y\2377\316\365"
+	.ascii	"n\340r&i^\326<\277a\347yv\376t@p4\027J\224\345\314\225\270B\206"
+	.ascii	"\270^^m\263\355<\234i\027\332\346\274\316w\226\232\225W\031\347"
+	.ascii	"s\276\275\202\363-b\324\217\312Y\224\217\346\243n\323h\233\007"
+	.ascii	"l\312\227\266\347\355\235\031I\336|\271\324\205\036!t\036\336"
+	.ascii	"\274QL\224\004\23307\342\343D\230\213\271F\306\\\251\364J\315"
+	.ascii	"\333\324\274\0211\312\204\253{0\032\206\244!s\260/#"
+	.string	"U\3714\3127\372E\275\222e\336\345\243D\022v\021|\210{\306.\232\273\304\333\351.i\2335\3169\017\221\237\364\3402HpM\360v\"\337\230\027\035\342\037\364GC\bZ3\2542\023\204\035\204\273\255\264W\314\267\330\2373-\344L{_\007b\024\343M\304\003\3532\363\253/\316|Gi\034(\325\252\2256\253*\312\034z\265\313\226*\340\221eP\360fZ\224,,\2409\231\007\202R\345;\262y\225\222<f%\247\362\367\207z\374\237\276\352^\373\314n[+\352\350\033!\325$EN4\2241\356[\273\263\302\237U\241\333\373\276)\302\264\030\027\216\005\030\300\013h\233\365!t\036\266\357\025\246\252\027B\317,\212\221m/\315\353\312\335\323\032_+\261\215\377sU\262\366\245\214\202HRwO+\343\344;\261\003\\\001S\323r)\004\225\301\00574`s\260S8p\334Xq\344\360\r\240p\354\2301"
+	.string	"\001\002LI-w@1"
+	.ascii	"E\301\215\036\027Hi\260\263C\306r\t\365$5U\243\307R\252\006\217"
+	.ascii	"e\224M\217%\216\177\232Z~\r\006h\340\210zj\237\226P\004<M-\215"
+	.ascii	"\374\304\304c\031\325\264#\307\215\250\246\247\251e\023\323\016"
+	.ascii	"K\361\200\232j\352!%5\325\204\214\253\352?\302:D\362\236\034"
+	.ascii	"5\330\367\264\217\206zE\232v\311n\267\325\222\367\326\264\003"
+	.ascii	"r\333m_\274x\177+\346\030_\255V\021\221\"\360&\362\355\3652\272"
+	.ascii	"\246L\252\267\263\301\376\203\td`o\027\340L_^\032\230.G\0178"
+	.ascii	"3\023\217\2317H\006\027h\365TL#\353=p\241%\364^\213\271\347\341"
+	.ascii	"\235-\312\272\234\276\305\377\240A\277(\ri\301\b\207\227r\n\343"
+	.ascii	"\tO\020\345\376\226\236cc\214\030\360\025\317\302\217\371\207"
+	.ascii	"\365T\354\364,T\374\212\316\321\322x\025\217D\203\0026\243X\361"
+	.ascii	"@\257\316\212^\312\3060B\335Qm\327\365\261-\016\325x\030\257"
+	.ascii	"\305\rA\233b\013\212?\361)~\2456\273\254P<Km\246`\325Q-\214?"
+	.ascii	"\3615@\240vM(V^]\211j|K\202\330\325S5P\r[tC&\276\027M<;%\013"
+	.ascii	"\243\361\375\327;rd^r"
+	.string	"hI\310\204J<3\273]\276\350B\227\26203\001]\221I%)\013;\346\317yX\342\333O\314\306\223h\200\360\253*\204\370A\320K\t\233cP\271\242\024\305\252\031P\353hm<KGE\264\361\335\327:S$_\270\217J\366\263\350\205Z\205\205f\342\023\237\227Vq/:\022\003x#\"\222\274\236\021#\376\221\254m\240\341"
+	.string	"`aj)jz"
+	.string	"\336\t\233\236\365C\002\345\021\321LL\357\203H\204\354,\025\022\"\300$dr\361v.UY\276\271E\235\245VR\022\223#\302\320\2650\021=d\t\361\"\276\233\213!\336\3507\226h\024RU\206\003\342[\r\304\373\340\030\340\207D\267R\345C\201\261\250\201,$\021sfFDD$I\222Bc\201\005\204\030\005\235Cz\022"
+	.string	"\204E\306\202\3120eHl\233\322\260o\300f\214\355V@\276\304\254\372\315k,\f\261%\377\204\232\005\323I\263[w`\343\"\327s\r\331^*X\024\323\215s\221\303O\233*ApD;s;\337\336\233\r\327\341("
+	.ascii	"\021\257`\367A\375\333\250\210Iu\363#\335\023\001\267o\023\264"
+	.ascii	"-}\2004\310i\314'\315{\346\241\340\220\342\n\f\207\370\"v\275"
+	.ascii	"\330E5N\303\264/\242\232\0022\343\267\212\267\205{\311;QQ\332"
+	.ascii	"\364\005*\\\275\237\223#\013\366\370\324pf\240\215\325\205X\302"
+	.ascii	"\b\257\032%p\356c\256\0239\260\377\303\275$\251yq\005\336=\321"
+	.ascii	"\035\013P\353\027o\252\357\262\256\212\023\021\205O"
+	.string	"\303m\354\202l\355\212`L\370g\334\252\033\23166\246(\024/\312[\213\n\0029\215\263\274]n\275\307\033\303\007\346\362\232\004\265\\\315P\347\370yp[\fJlg\002t'\310\236\227\270\006)hH\256\375\270PU\355\216\203\355\023R\263)B\270\306,\226\322\362\3220\343)_5\037T\330;\267.\325\3324\254<\032\327n/C\222\017=\313\251\371Z_h\020`\354\017\031\211\275\343\2066\205\300\017\300:o(\343\201l$=,\211\327\"\275\336.\260\007/\251\355\370\036\024\307>\023\245tJ\2236\271]\213\220\311\336\tc\237\225cxFB0\275\271\214\"Kh\200\305~\202\3549\211F\0350\247\013o\217#\2772\\\227\373\351\3412p\264y\rJ&\002T\256J\316?\270\313a\2278p\343#B\034\002\276\377\242\256\201B1:E\250\344\236\267Rn\255\304\006\353G\007\221(\307\300\260Y\341"
+	.string	"M\270i\250\035\260\302E\004\330\357\223\222v\326~\224\021Sg\310\3603*\n\355\314\347A\240\347o\031\241\207\337\234P\2458t\275#\"y\034\023v\315H\330\3709\"~\245\202:u\f\ng(Hy\213\350\273\307\324{A\353\230\013\025nW\367h\215K\277r\324\375v\243\304Mj\371\315\235\331\311g\212#\256\2407\370n\377\t\025|\210`-\035\276\221\276\257\304Y\024us\245Bl\200\356Y\237\262^8\351\232\244\212\331\373P\b\303\215\301J\326D\236N\027\016\225\226*\306j\022Z\030\017\352\200}\204V\334a%z\203\226\327a\201x)r\307X\033\351\001s\371\322\001@\026\032e\234\364\252(\337\370\266\223\253O\006[y\254\252\025\333h!\327\310\032\333\346\031\344{=`}\344\001\367\304\305|\203\237\"R'^\222\324*\366[\016\223\361 "
+	.string	"\200\313\3032\f\356\"\202q\346E=\357\217{9\372\221\256!"
+	.string	";$\353\\\317Q(D\271\301\313\222\315\240\227\221\344\300\346\342\200\270\366C\275\213\346\351\344\312\2656l\024\276\302\254\253\024`O\206\260\201\017\273\232\210\343:\245\311\235\360\003\370\366\352\264_\200\020\333:\361\251\367\261]F\310\0036\370F\256{\225\213\270\2271\254\330o\\\"i\331\312"
+	.ascii	"\273f\007\241\002"
+	.text
+	.section	.gnu.lto_mspCommands.182.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\304\034\375I"
+	.string	"\372l\034\031FP\\V\007\204\177\302\377O\222\360\023\376\237\204\317E\351\356\215w\367n\242\023\020\006\004\004D!TUUU\325\376G\370\r\247\304\202"
+	.string	"$\032"
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"``\240\201\201\201\201\201\201\225\332R\312\310\026\205\001\216\001\202\001y\3328\034\016\233\225c\326{Q\272:\252#\227V}o\215\353\352p\314N\243R/\244\220\352|\376\036\372\205"
+	.string	"\247\231\"\263U\265\265\337\263\021\007$\205V\345\262\230\214\353gF%\357\311\231\035\305\224}.\354\305~?F\206A\320\201\021\313\226\275\216\253\313\214\311\355\262\264\220\314~\255cu\306{X\252*\264f/\013G\230\306\357\330\264Q\272\341\241\371\251\337\247Y:y/\357\311|\031\246\263\247\005\023\246\371\354m\237\313wQ{\366\270W\260\374>\313Z\002(\357u\237\377\224\337Sa;"
+	.string	"\315\006\243^\352\367P\3326\377irr\233v\240ORz\372"
+	.string	"\372P\203\276\310\250J\355B\037\344\303U/d\255\362\241\356\007\343\252DyZ9+/\302f\347\254\335\210\016\354\207\353\256v\375\310\032\207\375\001\364\271r$\3514\313cz\315&=\241?\374v\227\301\310\024+Tbk\303\003\002\364\301\366%f\023syL\265B&\264\264`\020\240\217\2667\035}\030\231\374Q!\004\230d\272u\022\363\34112\240\r=\300&\323m\366\351\313\207\301\224`\342\017\027\203\364;\004\230c\312\025Bm\r\177\230K\350\213"
+	.string	"}\270=\352\nk\350\b\320\247\313\261\024v\360\342\215\251|\270J\t\236\363\303t\2308\311\0204\002\272\201wO\215(w\273\030\304\213w\357\t07\230v\263\330\264\301 \020F\302\273\307\241\327\263"
+	.string	"%5\210\0366\322N\262Q\374\260\211v\221U\021\304\006\332AW\306\020\232\253\273Z\306.\002/o\030\306G\\\261]G\022st`\307^\202Z\375i+1"
+	.string	"\322\004\\\264\210<\241\235\372iL\362\2355\266\260dG\261d\212)S\234\241\215)U\034\221d\313\025cde=K\026\272\250\215f\314\026^_G\035R\246\013\255\255\237\036&_\364"
+	.ascii	"\362\2206\205/\254\256z\023\206\256\362\341*=\347\314-\2060\016"
+	.ascii	"\232\233\f\335F\273Is\362\031i\324(\2354\264\031}f\371\3445\304"
+	.ascii	"\214a\352\220>mt\321^~\372KS\001\017)\364F\026-j\320nUe\352\247"
+	.ascii	"\255\254\361+)\234\255g\212\245\243\264T\233\016)U\230\325\344"
+	.ascii	"\344\244v\255$\245'\337*2\202V\373P\007\t\275q\256\256\016\302"
+	.ascii	"Y{W\2366\312\275\260Yi]\377\242\253\233r0k\034\325\256\023\245"
+	.ascii	"\323\352\225\027\241o\326\253\261\315-\016\033\326T\253\303v"
+	.ascii	"\2614\245\235\226\217%;\266G\333\311\312\314\262\274,LL\273\355"
+	.ascii	"f`\304-?ruq\271\275\207\314YY\253\333\323\345\311:V\301\236n"
+	.ascii	"\357TU?\374\f\216\020H\253\243\261i\023\304\323\246\322\bmue"
+	.ascii	"\0313C|\031F\f\321\2603\273x)\342\315,Z\214\270\272Z\025+GkY"
+	.ascii	"J\346H\304\316\026%\225\324\326\344\024\245\330\335r\222\222"
+	.ascii	"\026#w\346\242l\344\305\370\314AY\bN\030\207vsP\030\366\026\272"
+	.ascii	"\251\325t\233v\323P\375\246\245z\252\343\264\234\256\323v:\253"
+	.ascii	"\357\264Vowp\377l\241=\264\215\366\321V\332K\333i?m\251\re\363"
+	.ascii	"=e[\331W\266\226\275e{\331_v\230-f\227\331fv\232\255f\267\331"
+	.ascii	"n\266p\307\331T\273j\327\331V;k"
+	.string	"km\256\335\265\3016q\207m\261]\266\315vr\367\235\266\225\273\271\325v\333v\333\320\375\266\245{\272\255;n\317m\272}\335\330}\267\361\366\266\305\356\276\3017\350\025z\211\336\242\367\350Ez\225\336\245\267\351uz\241X\274R+v\214x{\243^\354\331\237\360\220?\323OA\363\233D\234r\375\032\275T\216\3504\373\016\375\032\225\277\357\317\013D\200\n\200\213\241\325\235\247\325P\355\002\262c\326\001uv\034\254\004\344\336\312SW\200Z\365P\327\r\300E?\360\330\361\003\333\271\237 ^\036;\004kl!x\256<\301\322\207\253\230\"x\256\n\316\320@\274\330\005G$\tlg0FV\202G\313\033\024\215&\264\335\201\327\327\211\255\360\301V\321o\017w\226D\267Y\bWX(\242\\a\204=\307\367R\233N\n\034Q\256\204-\007\311\323\235\260\337l8+x\272\024\326\260a\241U\341\314F\363\333S-"
+	.string	"hY\030C\306\305\026\277"
+	.ascii	"Foma\340\322\005\306\220g\330Xv\226\030\303\256\201J\025\031"
+	.ascii	"\033\242H\231\301\3259@E\321 v`j\n\275\037'\214\370\206\354\030"
+	.ascii	"\361\r\331!\"\304\307\220\235\037H|;'\034\364\212\030\001\202"
+	.ascii	"d'I\221\"Hv\b\364p\035l\205\263\260\026\356\302^\330\210\303"
+	.ascii	"p\0316\303\035\237a%^b5\274\206\335\260\023\303\341(\246\342"
+	.ascii	"*\226\303s\330\016_\361\035\306\303[\314\375\237\007\372\241"
+	.ascii	"'\372\243G\372\245g\372\247\207\372(/\345\253\274\225\327\362"
+	.ascii	"[\336\313\177y1?\346\315\374\231W\363k\336\315\277\3718/\347"
+	.ascii	"\347<\235\277z\254\337\372\341{\375\327\027\337\370d_\366\310"
+	.ascii	"O>\332\247=\363\233\337\366n\377\366p?}\352\313\375\334\333\375"
+	.ascii	"\365\357\036\357\267\317\315?\031(\017e\242|\224\221\362Rf\312"
+	.ascii	"O\031*C\311Q\362\224L%_\311X\362\226\314%\177\311`\362\230L&"
+	.ascii	"\237\311h\262\232\274&\273\311or\234,'\317\311t\362U\306\312"
+	.ascii	"[y\230\275\362W.fc\036\313d\371\230\221\371,\243\345ef\346\265"
+	.ascii	"\314\226\235\371\231\341r4Ss5\313\345\271l\227\257\371"
+	.string	".\343\345m\346\352\037\r\244\2074\221>\322HzI3\351'\r\245\241\350(z\212\246\242\257h,z\213\346\242\301\3500\232\214.\243\321\350)\275F\263\321o4\034-GSi:\272\216\306\322Y\232Kwi0M\324aZL\227i3\235\324]\247ie\202\360\2502\330\342)*\355u\302\r\t\201\016\262\233\003\022`\300\2600g\265\245\003\311\200\227'\332\240\221\241^}\006U\346\237\216IiRG\224\377\312`0\236\022]\272\330\247^W\304\227\274et\345\375P_\3311\324e\265oA\021?\r\237\327\002\262\024\016\252]\223z\374\016\206\320\336\002\337S\224\212\213X\023\223\207\330\270h\026\037\315M{G\013\247\241u\177\006\024\303\364\323\226c\267\305i\316\003\327:\253r|\350\257\325\370\026\003\261\003\370\345\253\034:\313\307\271c\332\211\336\214\315\316#B<\016\272T\334\217\0225\220\312x\335\276\347l"
+	.ascii	"\021_v\266#b\256\240\315QZ\233\240\373d\212\032\003\250\b\253"
+	.ascii	"\352Ls\334\336\"\260\245\344\315\354\345\320r\307\300\355\022"
+	.ascii	"v^`W\251N\026!\276*\264M\347\356\017\347\312\207z7\341\373t\023"
+	.ascii	"\314*\233\346\376\222\345\200j\315\b\261L\202\226\371\211\251"
+	.ascii	"W'\007$\362+\\R\361\357i\353\314l\212\257\360\242\330\210\356"
+	.ascii	".*6P\\\177\321\243=P\214j\357\016\223\232oJ\373Q\212l#?tx\315"
+	.ascii	"\223U\034\007\036?:\330Se\031\334\375\n\202{\354\332\bcG\267"
+	.ascii	"\257t\250\310\017\314\206e\\\276\357\244e\020\025})i\253\206"
+	.ascii	"\b\374\262\245\350H\324(\275\372,'\bu}n\261\277&\260W\1778]\365"
+	.ascii	"\226\341lV\354\200\214\347"
+	.string	"2\255C\207\366\250\004\025\334{\035M\311\nrg\235<!\203\240"
+	.ascii	"\334\205\206fe\345\005s\353\335\276!\250\271Y\267\252\004M+\225"
+	.ascii	"0\206\272\266\337n\205\232W/\275.*\256\255N\rLr\255*\255E\351"
+	.ascii	"\262\373L9\334)\256\024\243\303\"P\335\b\356]\2066\323\206\361"
+	.ascii	"\031[Fh7\210\266\305\322\"\023QS\030\265cR\256\232\344a\365#"
+	.ascii	"\230 \034\235\026\270_\3122\363\276i;\220\316u\002~@gJ/N\326"
+	.ascii	"\342\301\335qP\034\355\215F\203\210y\253p\177\200\274[\342|t"
+	.ascii	"\335b\0138\202I\275\022z\211\020\030\235\347\364%u\236[\261\334"
+	.ascii	"\267\f`B#\225$\204\0265I\354\334d\353\371\216\363\250\362\007"
+	.ascii	"\236\200\300\334\305\n\242\357Y.Z\340\013\244\252\346)\206ry"
+	.ascii	"-[\275\356\271\374iT<L\327\365\220N\302\026\037\347S\205P\346"
+	.ascii	"\206\005V\017\340\213\211\350]\341\026\273H\037\212\300()\223"
+	.ascii	"\316G\3062J\264\017\002\025B\",\204\271g`\002\242$H\364%~IN\234"
+	.ascii	"C\264_\270\001K\376\225L<\312\215\373\212\213\254,\243#\323\210"
+	.ascii	"\271\0367A\013~\222w\322\223WK\226\251\316\364\213\314uD)\230"
+	.ascii	"\223G\013\251\221\021\235f\266\277\332\275\305\232\204\215\004"
+	.ascii	"\274\001\374H\"\0328T\303p\337$\375Q\"\024\267\r\343l\332Y,\324"
+	.ascii	"\006U\200&\355\315F\013"
+	.text
+	.section	.gnu.lto_mspBatchCommands.185.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375 \374E\005"
+	.string	"4\007\357"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\376\001\005\001\006\025\001\016\367\r\226\f\n\013:\n\202\t\356\355"
+	.string	"\007\354"
+	.string	"\006\353"
+	.string	"\005\352\004\351\003\350\002\346'\001\345"
+	.string	"?\202\210\200\370\001\1773\325\0014\324\001\323\001\322\001\321\001\320\001\317\001\316\001\315\001\314\001\313\001\312\001\311\001\310\0015\307\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\032"
+	.string	" \004\334\003\303\300\0250\007.\2039\002\356\202\206@\030\270\006\232"
+	.string	"\201V\030\006W\2040\007\216\201&@\356\345\030h\002\360@c"
+	.ascii	"\005\230\355c\240\b"
+	.text
+	.section	.gnu.lto_mspBatchRequestIsValid.187.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\374\004]!"
+	.string	"\026\274\324K\220\026R:\200\247\025\235s\005\211\3500H%8\320\202\3353\316j\343\032\f2P\260-\0251\364\277a[\320\321\362\332u\273\205T\n\371z.\003A\200}\b"
+	.string	"@4\007\b&\264\220Hq'"
+	.string	"\315\301\217\226\371\222O\310\336;\311\301"
+	.string	"\262"
+	.string	"\302"
+	.string	"\266\373V\277\362\235\310\213\317\344\0345E\231\263\261A#P\217\266\3615\351Q\365\001\322\243\021$\370z\350\306\350w\005\302\362\211\204\245%g\343\356\342"
+	.string	"pl|\253-s\207\236\223\211\301\301\334T[\212\342k\207\372\277\347\230B\342Zde\236\036\023B\r\211\2153\255\341\214\343\230B\247)a\223\205\371\224\260\306\001\246\260\311\3360f\n\2310\316\221U\017\334PZ\272\r\343\\Q\351\310\r\221\360=\"\235|J\310dS\260\243RbYKGOD<\306\027\210Of\344\206F\370e6\252\\y\2334\004\332\373\365\032\232chVO(\245\247[[N\316\271mp\250\364\006\360\356'\350\356\234n\f#\004nn\266m\376\365\036\360\2557\315\223o\335\211\374\270\266\235\332l\2436\333X\265mm\266_"
+	.string	"\210k\205\202\265\334r\317\214Y\306Z\227L\206z\365\370\327\277\365'\377\343q\367\373Z\377\352\2035.\211\357X\367\352\026zW\343\250e\334\221>\327\225\215S\362%\276'{\317\301\374_Y\030\fg\316\306\n\352Q\235}\200\324\367-\0268ge,\205\246\264\242\3129GP\217\325O\202\344H\241g)0"
+	.string	"4\346!LS,\313\352\201z\324"
+	.string	"\026\352\306\035}\267\257\2776\256o\274\021\337\217-t\231\231\277te\311\305\231\263p\301\321f\240\036}\326\331Uh'\035\313J\005h\267\340\234sV\025\244\003\356\315\005j\212%\217\210EX\\R\200\330n\261m\256\356\362\326)\037^\326Ss\006R\350\217\235\314\003\376\216\243\255\003\"}\020Dz\324\346\036\354\t\232X\311A\274\362\"\262k\227,\347\234\336\342\245\2716\f\351\213"
+	.ascii	"\021#\354\203\366\336\264*\0323$v\354\203\272\213`\331%|:+\374"
+	.ascii	"`\342Bo\361\030Mm\013\277\231\244\277\2745\fh\267t\316\276\353"
+	.ascii	"k\217\032\3546\341c\037\374\275\3623iB\274\220\001\357\017\347"
+	.ascii	"H\213\307\275\305nr\002EM\216\035\375\027\351\321\037\377\365"
+	.ascii	"\230\252\351e=\333\252Ad\327\272\215E\366\026\273\237\036\235"
+	.ascii	"\206\364\215\352\035t6\224\370\341I{\\\370\350\230\340\355\330"
+	.ascii	"|\316\303\353\335\025\275\036\026*zx\266\346q\220\242\367\263"
+	.ascii	"\003\362\331\371\331\361\360z;\0075\035\224\242\207\267[\021"
+	.ascii	"\024\304\333\341\214D\277Q\375\365j3l\t\231\224\271\224_\271"
+	.ascii	"\206L\342\233=Mo\347\020\335\242n\201s\206\302\340<V\345\026"
+	.ascii	"\034\275\031\250\034A\357\327?FS\021\345\323\t\2640\246\205("
+	.ascii	"S\300\322\334\r\034\354\203\035\263\354\"{:\215\356o\302\323"
+	.ascii	"2J\f\215+4\334-6\315\305\3272\327'\370A\226]>\236N\340\375\235"
+	.ascii	"\202\231\022\013\314-\366\275\2566\227j\310\244z\263\037\354"
+	.ascii	"7\251e\0322\231>\251{(%`\235\204@\225e\201\242\344v\213=\241"
+	.ascii	"\312vs\321_\250q(\345\fS\214\005\"\001\211H\f\223\306P\0021\346"
+	.ascii	"\244y\021\300\301#\223\024\244\260\261\006\217\254lkx\t\340\216"
+	.ascii	"\200\024p\222ky\232\362\271\027$\200\177;J\352\363\334\024{\217"
+	.ascii	"\304T5L8\216l\213\225\230\217\267\304\307j&\020\036W\037\033"
+	.ascii	"\253&3\f\020\333\351}fV\325s\215=\f\266\356iE\222nV\017\340\273"
+	.ascii	"VH\337Al\246}.\320b8\354\037\2257\265<\212k\030eT\331\273\035"
+	.ascii	"\3368-\265[\\\364B\360\370\240\005/G\030\207Z\262x!\275\250\355"
+	.ascii	"\217\006\327!/\023\020\032U\355\205x\300\376k\363\244\352\021"
+	.ascii	"\273x\241\350\016'L\007\3575\3312\230\340\310\363\225^G\300\252"
+	.ascii	"\033\232O\233\004\375\326\212\325\223\227\021\364]\245\260$\250"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_mspFcBatchCommand.188.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`R\001\205\016"
+	.string	"\306\332aF"
+	.string	"\221(\035;\266\302\331\306<\265\314\035\264\233\bP\214\320\242\2108\321\222\033#1\251a\335\3548\220oQ&\337\034;\016#\300\372\232\bU\253`bD\203\365\3671\352S\320\313C\212\005\246\265\"\215\220-eJ\001M"
+	.string	"S"
+	.string	"G"
+	.string	"\266\257r\022%\203\f2\230N\016\250hip\2611\347\334\006\034\224\035\213\017\220\035[\021 \bF\360q\025\3649+\223G\215\365\215\005PR\260:\253S\004\261"
+	.string	"\021\3432\327\324*T\335\210\3149\255\250\325\311\215\335\366\210\355\006\366G\004\352\177\254\n\215*\325\341/\\\314\251\332\221c\256\300h\\\266Kv\307v\026#u(\2009\221"
+	.string	"3q\227\322_,\b\370\314\260\30553\347\013\304\b^Z|\275D\351,\027\3643\303\223\312\200v\354\243V\375\n\006\003\230\363\203\214\2319'\210\th\307\034k\213$\350Q\236\315\326\325\002\305\272B\366\215\320\002#T\034\356\250\2666\205N\217\372^\346\347\320\252\2317f\204kb\277N\272!\354c)\0174\274)\266\246\366|\345\3678\314\317\371\313\257Y\035\037\363\357Y~\335\004%\013\244\024q\336\027\"I/4\222\335\207$I\226\373\344\206\0368 \351\270\214\223\242\021\356\223\033s!#\331m%\023 t\033\367\311-\004do$\3726\222\347}[\347e\372\246xX\255\032\024\005\017fq7\330\216k\021\323\236j\304\017\345\254\266\036\001\036"
+	.string	"\3571\300\020\355\251s:&\254\330\232\207\037f\224\b \337V\023\351\203\225\245\3251d-\016\024Ac"
+	.ascii	"\023 \017`\006F\200\212\013\202\255\020\007.\003#\200\360\231"
+	.ascii	"\032\205cEh\316\370\351b\213\3204\006\005\005"
+	.text
+	.section	.gnu.lto_mspFcBatchSubscribeCommand.189.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`y\002}\024"
+	.string	"v\346\211J\300\224Q:x\316I\346\204\r\375Z8\335N1\002x$\367\251h*!\2522\327X\337c\320\276<\236\201\217\331u\235Z\224\2136'\317\323Q\b&/1\003\205\204\377\271\270\273\006\203\264\247\2169h7=\020!\204\020\271S\nv"
+	.string	"r"
+	.string	"s"
+	.string	" |R\253\212\323\251\326\332\342\002\344C\333~\321g\324l{\260\223\343\223\340iH\016I\252\326\352byK|\b>\200\370pY\334\366Q\f\301\2456\377\366\021e\204\224\222\251+q\0214\200\242\307\217J\227\003[?VD\255t<4\334\341\241 y\342\013\022\020J\241D\245\303\201,<~\271\373NI\350t(\035aj\255\246\246\316\347&o;\204\355\t6\335\005\276\321\257\362\246{\365\244?\305\324$I=\202\324\"I\035\236P\203 \365\222\324o\275"
+	.string	"\2112q\"Bj\3559\227\324_\230\203\350M\277]\363}V\331n\342\360j\326\337b<)1Rk\357\300CG\020o\224H=\f\226\236^B\033G\252=\251\303\n\253\342\216\226\234j\355\265XA\217\004{\247Q{\215\017\224Uq:-\020\220\017Y\324\224\336(1\364\346\270,\253\025w\204Q\344\3145\311\241\247\247^\354\240\302\3459=\\\241\273\340\252\254-a\206\336\fw\001\020\317\336\334\242P\201\336\004\3672\200T,\\\2407\227\311\247\202N%py_\242 \246 +\023\277\030\216\240pt\312"
+	.string	"^0z\363{\035EIRh\312\3326\032\350\315\325\336w\0018\212\220\374p{\263{7\272<\373{\236\347\351\025re\314\006\032\0173\030\355\306\006\345\306AY\302^\262\231\f\255\224\311\340\2241\026\255\254\331\327\254\\\231\231\230\232\330K|\225\260\006\257Y9\372\345\202S\306\\7641\327kV\272\\Z\226\341\300f.\232L6s\251z\365+\344\325\356\310P\370\333\304\373\376\237\235\017\243\265\335&\222+\3026\271\206\311Y\035\260\326Z\307\345\331wq\3044$\216\233a"
+	.ascii	"\025\327\277z\357\020!\004/ \320\002\021\"\336O12\033\332\351"
+	.ascii	"\207\b\327\265\"\034\t\350\211\306\025\333\017m<\036\274\322"
+	.ascii	"\300\272\326\030\243!\341\022]\225OfP4`\227\2262\305\303\342"
+	.ascii	"\372\3445\246/\203\264\020r_\017\261\360\200\r\214\224\361a\030"
+	.ascii	"(\204\301\226q/;B\207\317\216~\254`s\306\347b\231\2163m\340\204"
+	.ascii	"\343\240\201U("
+	.text
+	.section	.gnu.lto_mspFcSubscribeCommand.190.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\300\007\035/"
+	.string	"\352Rl\022F`\\R\007q\306\267vW\233\206\004\212\247Xl;H8"
+	.ascii	"\304\3217\346\200\262\177\201\0057\032\217\204\b\t\304\021\262"
+	.ascii	"\210\337\227\250\\\376\262D\253\006j\037\224k\322f{\177R\001"
+	.ascii	"\317\274\264\332\226p\267\275w\222)\005\027\001\002\001\023\001"
+	.ascii	" Z-M2\251\004,`\036\260V\234\354\311\257\300\030P\314QcQ\322"
+	.ascii	"r\246\026u\003\252\273R\235\312\223W\231\201\2139\n\212\245\300"
+	.ascii	"u\266\210\033c\027\243\321\300\234\267\364\322r\316E\375\343"
+	.ascii	":\353Q<\354\251\235\035j<\253\030ToD\311\360r\316FG\357i\235"
+	.ascii	"]\235\247u\366\207\020}\245z\273Ml\341\352\364\"qgh\324\021\276"
+	.ascii	"A\240\373k\331\365\261\263\035\312\213^g\216\340k\232\205\211"
+	.ascii	"RUZ\276\3635-R\035j\271q\035\312\032\243\303\277\246D\326\036"
+	.ascii	"2A\326\340\240\202b\035\271\351\217\265\032X\350\303_\227\233"
+	.ascii	"b\275TP\034\374\232b\255\3076G 7\275\302\300u\225\233Z\255\023"
+	.ascii	"\244\260\213@HU\017\377\255\023\244<!2\244\212\256_\245\254\315"
+	.ascii	"\277\246V\270u\363\"8,aP\266\252z8\353k^\242\252\345f\253\312"
+	.ascii	"\207\257\376\364\362_\017pi\345\r\251\242\326\243[\\\324\317"
+	.ascii	"\034OQA1\376U\31097\226RUy\363x\267\347\356\316\335m\223HH\354"
+	.ascii	"R\002\357g\356F\260\356\224\344\265\211z\250n*\024\177W\267\007"
+	.ascii	"\263\320\252\375\\\335B\334DC:\270\023\270\030o\241 g\363\006"
+	.ascii	"\3627\357\037\207\363\366Yq\037]\314\335@\0017\363&\340W\334"
+	.ascii	"\0054\356\035W\363"
+	.string	"6\256\270\213B\334\304\025\367p\305\255#\304-\\q\277@\334\301\0277\360\305\355\256\270\177+\3566\210\233}q\257A\334\277\342v\005\017\336\254\331\341xrr\316\3217'\307\261^\222\270\030\3677w8w6w5w3o\273\035\316\253\375\256\331\313B5\212\222\267\246\343\223\232\247\303\033{q1\\/.\246\335\255\337.O\216\346az\351`z\202\335\332\373\245\275\215\215L\325\253M\013.\355k\375\266\232\262\002\324F^\317\362\360\302\236\254p\035\255\275K/=M\350\030E\315T\301:8,ax*\226\335\257?\265\237\365\333\335fM\236\245\331\241\226T\261\332\344L%r\266\003]`n\374 W\356H^\237T\023(\356\303\020\316\244\335\275q\331\233Z\2404n\300\312l.\370]\355a\334\255scS\206\346\272\235\273\233\003\217\270\251)Ck}\252\333EK\204}8\241\003rW\346\f\370]\375"
+	.ascii	"\3547\364,\030\333S\376f\3159gW\250\025\372\241_\252\203C\223"
+	.ascii	"\312\202\222\231\3155\371%x\240g\216\245\3610\335N$\256\246\311"
+	.ascii	"\3159\nB{\032\247\373\260\272\021g;\204\210\326\245\"Zg\023\274"
+	.ascii	"\273y\020\233\235W\226\024/\037\2273T\013|\240\177\262_\037\370"
+	.ascii	"\036\325\361{\367\333\267(\237\353\375\245m\377\367\2778Rs\330"
+	.ascii	"o\347\234\375\337\227\251\253\377\365=\312\347fP\214p\215\264"
+	.ascii	"+\337\333\334D\235^\331\324\325\023\367E`be\306\006(a\002\273"
+	.ascii	"\264\300\373\232\363\270\211M\211cs\332\336\372]\016\224\362"
+	.ascii	"\355\375w5\221\037]\2711\272(\254\327E\356\177\374\306\321\036"
+	.ascii	"P\334\327<'R`\227\372\373\0261(qE,\340\273\003\315\020/\220b"
+	.ascii	"0\223NKJ\301$%\206\245\245\222\023\223\022\023\331d\001\243I"
+	.ascii	"\234\301tZJ\262J\236\264\264D&I0\223G\315\244\323\214\0132\220"
+	.ascii	"\224\306\245\r\315f\022\271d\03695\227GLMe\321\251\231\364Hf"
+	.ascii	"\363\217H\204HR\"[d3\231\001\311l\376\032\271\200\251\2514ZR"
+	.ascii	"BR\032!\231M\243\005=\275dJ2\215\234\226K\246\321K}\372s\365"
+	.ascii	"\020+\017\t\321\335\331\352\300\272\203{\247;\333\235\235\357"
+	.ascii	"\n\317\207\026\213\217\241\370\212\301\0010\307j\016q\347-:f"
+	.ascii	"\207\370L\037\254\363C\247\024\347\024\354R\342\037\245\036\252"
+	.ascii	"}~\370\363:\377;\333\263\373\371U\215X"
+	.string	"\236\317{\325{\324\304\344\360\240\311\302c\350X\253\n\210\361\271\332\355\\\370,\306\350\016\340\367\r|7\006\r\330\245\302?\326x\250&\360\357\2063=9Q\276'\023\033[:\337\325\f\256\336\240\377\201\255\005\336\370S\306\017>\346\033\203k\016\016G\351\240\375\356\310\003\214\326\331\340; \"\366\304}\024\346\200\260\021~\200\233\250a0\344\214D\n\215\310\214$I\222\341P\0021\310\254l\003\021p\275TF\223d\330\fO)(fZ\021nY\325\250[-gM\207\223\373\005\254\2024$\337\322\002\220\330\225\207A\377#\264\205MXF\312\342\211\307\266\370\024\235\2659\243\303\327\b8\027<\350\315m\260\2258\f\246r\266\251p\321n\306\310\226\017;\n\266\215\0271\314\311{a\020\232\207\004\026\201N\357V\315\221\264\200\362\227Y7\232\315\200b\035\353q\232E:E\211\262g\002c\342\003\207\003&\3321m"
+	.string	"\214@\022\035^\033\006X#\237{\005\225\333\266\242\252H\013\205\035j6!\177\3433v\375\247VC\251e@\247\270\035\325\221\331\006Y\b\0356"
+	.ascii	"\017\261 \333\216\262b\341ge\237\ni\203\301*\374E\246C\005Y\212"
+	.ascii	"m\b\007C&\366\346L\215\340\340\261\025\312\372\272\205\366K\331"
+	.ascii	"\235\371\353-\016D\002 \201\333\272\306\300\f\303\370\215\212"
+	.ascii	"\267\374\017:\246=\376\fJ\242L#8)\323\376\273\263?y\240Vx\314"
+	.ascii	"ME#\\n\225\333\366<\035\004\023\212\240\344\247z\216_\244\231"
+	.ascii	"\001\264\230\026WQLU\273\322{\021\321\250\001"
+	.text
+	.section	.gnu.lto_mspFcConfigSnapshotCommand.191.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\020\003}\027"
+	.string	"\346\254\234G\300\030Q:\300m\230\314\237\240\246\245\f\244\201\256\320\002\266\323\210{\025\031\001\3562\220)\347\030\240\b\370G\375\271l\320\264\264\214\034/\244\253\377&x\201t\177\233\346\032\224\205=9Q\3551S\034\374\337\b!R\246\024\212"
+	.string	"\200"
+	.string	"\203"
+	.string	"\022\220\270D\b\247\334\350\347G/\006\264fN\n\022oN]\216!\350R\240\356P~\036%\206\266f\016G\244A\352aK\255\372'2\254\232\023\310\2177\347\3141\202\324C\333>\2237\371\261-C\020\020\321\203\036\226\031Fd\346\2340\234\277\304\207\340\003\210\017w\310m\007Wm\376w\307p\343\267#\207n\007u|\301\004K\312\\a\r\345@\002GAE\276\273\332\030\302\251\242&\3149\255\344\020\321\035\336\366\006\333#\354%\0217[w\323\025b\037\234sNo\020\033T\277\276t\337\270\216\364\333\\\351f\375\350_=\351V\201\352T\215\032\005\252E"
+	.ascii	"\352P\245\006A\365\202j\005\3257\020!M\322\216\243\331\315\231"
+	.ascii	"\343wf\372B\246#_\372\223~\245\257}\373<\237ii\326\272\375\230"
+	.ascii	"-\034E\275/!R\377\361\253|\347\032%\0275\212zOa\346\324\355$"
+	.ascii	"\331\351\223h\236\206\227^/\314\234\223\301Cs\020\251\214F9\002"
+	.ascii	"\341\212\233S@m\f\032\364d\270j\246\324\342\303\355\315\004\024"
+	.ascii	"\334\016\036\364\244q\202\366f\001j\357|\320\223\340~\367\033"
+	.ascii	")\263\370p\240kw_{\2411\270\335]\3404#\r\220\376|\003B\204\236"
+	.ascii	"\274\3313]{4\225M\267\202\244\boW\210\033\\\367\204\224\247\234"
+	.ascii	"\226\261KW\272[\362`\334N\342\327\265\257\"\344\003\247?\273"
+	.ascii	"\324f\355\022&\364\344W\233\312\222\245\253\265e*\364$k\027L"
+	.ascii	"\351\304\227\333'JhM6\246H1\023W\324T\364\310Z\210=\027\306Q"
+	.ascii	"\026\233\321tj\343L\307g\344i\325F\024\033\243\215\253\263\323"
+	.ascii	"\001\005OL\214\2152\0131\332\210r\314\201\317\310\003\353aa\202"
+	.ascii	"\007\026\243\2150\007/\317|d4Xm6\243\301jt\363\340\334 \276\341"
+	.ascii	"\201\306\307\276v\245\305L\032u\255jm\334&\276K)\306\007\264"
+	.ascii	"8/\320\324\332\034\261\025)P\325\242\226\225\304\246DO\246\026"
+	.ascii	"Gho>\2406&6'z\022\265[>\371r\254-\267\370pT\244P!6 \240\002\221"
+	.ascii	":\253\003\377b\344\310x\310\246\2707&\200.\270m\265\235Q\223"
+	.ascii	"\206\356\336\005F\354\030]\\Q4)f\374j\220geQ\214Fw%\365E\215"
+	.ascii	"S\362\331A\245IK\365^I\333\310F\274\035\013\266\260\335\363\220"
+	.ascii	"\375x\323\342\345\210\t#\260\341\260k%\374j\334\n\013\310\300"
+	.ascii	"\226\"\276\206\001BP\2605\216\313\036\301\360\231\243?V\240\271"
+	.ascii	"\341w\321F\244)\005\203\002"
+	.text
+	.section	.gnu.lto_mspConfigDeltaIsValid.192.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`W\004\375\034"
+	.string	"\006\365\271J\240\232M:\244\213\272kK\353\217\375\353\003\207\3662\3648i\201"
+	.string	"9\005C\254y\251\310\256\311kZ\276\f\310\325\203\356k\305\207B\336\342b\034\372\216<\230N\007\374x5\\*\251\360`\023Ge\227\317,\355\023B\b\221;\311\247"
+	.string	"\232"
+	.string	"\247"
+	.ascii	"\367w\177\024\304*\003\274\267H\347\"'(/\376\306\254e>\323\227"
+	.ascii	"\334\316\244\305\007\334\253\224\205\352^U\001\037(/\262z\232"
+	.ascii	"\361by\002\343E\007;7\306\325\f\241\301\006Xc\210x]\367\252\263"
+	.ascii	"\376\3010\213\273\t\233)\311Q\f\333\342\370\350\315\244U\310"
+	.ascii	"\302r|\030!}\206C\027\024\255\255(\235\215\2277Rt\343WtdI\242"
+	.ascii	"\321E\216\221\242#+>(\351a\b\241\247\265$@7\024\376\b\216)\367"
+	.ascii	"\335\302\320\345l\177}\005\256\027*\223W\017#\244[R\302\275\227"
+	.ascii	"m\2523:\00383Saf\013\314\241N\314*j{\307\374\035/UI\270\225\230"
+	.ascii	"\317;\337\034\352l\363\336\271\346Rg\331\231"
+	.string	"\3741\266l\222\226al\271$-\223\244\345\221\264,\222\226C\322r\227\226-i\3719+\246\204\264xXdzK\2754\276\306\334,1\n\221\363~\250\277\367K\375Mg\276\023\337\311\243\016\345>\251S\027&\030\203B\331S\361\353\342\002-\t\312xP^|\372\223\333\241P\374\246\367\250\225\340\f\340\275\352Ny1f\317S\201\203\252\227\206\311\365\242\213\211\001\363\215\277\262\311W\337\344\366&\240X}\266\351\261I)+\345\b\021+\262\303\376\322z%6\020\217\233\016\273\253~\345\225r\031\177\216\262\356''\255UK\316\212\271\351\376\362\333\221\225k\324\246\373\207C\266\241\203}Z\323a\357\227\224E\300v3{\370`\237\312\032\307vwhET&\026\202\307>\265\255@\207N\365\002j\251\242\033\"\366\356\b\250\200i\330;\026\317U\343\333\266Z\345\254\030\016`?\365uD\2312\367\220\260O\337\367}"
+	.string	"\227_\215\254\\\243\r\346\n)J\367\216\n\204\017\r\220 \374\026\343\3057\375\353\303$\\_B[=\244 \373\025#h\266.Q\3539m\264\024\344\017\355\024!\2426\322X\364\234!\217\355\354\237\223\206\342\004\315F2\317\002\023\247\317\254DO\b\237\031\217\355\234-\240\341\232\t\232m\366S\253\331f\346}+\361\327\227]\2029\236\246`?n\274\3573B\202\351\323Tx+7\033\0063\233\315\022\202Z\210\201\302{{D"
+	.string	"6)1{\307:\207\365\204-N\260\376\372\317\320\241\273^\300\\x\357\275\260\033\033\366\005\f\366)\003\270\252Q\304\0138\324(G\311X\352\315\030\360a\271R\342\306\262\033\311\272\245\200\r[\326\314\0314\330\247e\343\0205\3125M\006N\250a \204\024TH\t(\020\242@\204&i\016`\002\2219y\033\0210I\247\216\246\240\205\232\325?#\0226\307Q\021I\232M2c\212p\016ZR\256\271],D\273\206\224\256"
+	.string	"\335\222\032\203\215<\321e\b\367\001\241?\354n\021+\\\236+\215\3572$\004"
+	.string	"\024z\030Bz\001c\256"
+	.string	"\376:\212\234C\322Pm\224\261Lt\232\330\275RrG\235\204/\327\212`\267Y3>\007\263x\177\020\320\2137\373-\216\022\007Y\007x!\263\356\236\"Xi.o\177\320\257\204I\310`\360C\254\207w\273\311\303\216\213#\334"
+	.ascii	"\237\205\310l\237!^\371\256\023\326\005*"
+	.text
+	.section	.gnu.lto_mspFcConfigDeltaCommand.193.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\317\002\315\026"
+	.string	"&+\230H\300VQ:\024\334W\022h\342x7\271t\345F\230'\320\241y\272\205\363\006\311\214\2106m,\271*\373?7\275\0331\356z"
+	.string	"wP\230.\222\021\341\202\017\210\257\220\024\310\240\024\204\001C}\255c\262\321\b\331dK\231d\207"
+	.string	"\200"
+	.string	"\177"
+	.string	"Ob\261\250Zq\230i\252\265\372\354\001\360\336\356\356\215\374Hle\027Z\314`,\370\322\303\226\023Skm\361|E\357\315\013\240\367\232\207\214e\007?\352\315f\331\3766\036\374h\212\210\302\220\267\030\247\263\347\310IF\352f\233\253-9\272\330\334\206\330\233\253\" \244\315\255\305\354\3612\005\314\020\317\317\214\336\263\200\016\033cln\265\311\223eg;\323\231\350Fc\376\"\324Z\227\311\033\214/\352\273\353bw7\354r\227\274\254C\371\007\200\2749\327}q\336\344\277Y\336\324\227~\232/\371Q"
+	.ascii	"x\301\024\357G\303KQ\274\336\344\235O\372\033\344\275\016\204"
+	.ascii	"!\272\031'\257\324ZT\232\251;\217J\220\353\376\335\330\236iS"
+	.ascii	"\273\253K\361J\326\217B\276\034\361R+\016\301\275\315@\241\210"
+	.ascii	"\271\027\017\226\2608\360\230<\027{\023\025,U\255)!i\252\025"
+	.ascii	"\347\263\fp\340\304]I\354KV\260\252\326h5\022\200\367T\274\314"
+	.ascii	"\001M\273\313\362k\205\356b\320\300'\277\346\2004\324\343\262"
+	.ascii	"8t\340\223\264?\004i\266\327\234\263\235Yy\370\300'g\177Q\236"
+	.ascii	"\312\004\340\233\336\005\021\202O\342tWy\032\263\253\365x27J"
+	.ascii	"'\263w\274\237$\225Dz\207\346\200OJ\\jLf\377\035\372\316\351"
+	.ascii	"e\233\021\355R\336$b\377c\303\023|\362\336\376\004\275\367>\323"
+	.ascii	"\247\223\030\247\"F3.wq#\367\216\335wY\226\345\266\216\335\232"
+	.ascii	"!,l\024\025D\021(|\301~\204\304\327O\220\350R\t\211$:\204\211"
+	.ascii	"\375\323A\003\tWHC\021hB\b\023\277\r\025\004\211\256\026\n\023"
+	.ascii	"\"\\\255\020&\266\024\254\366\025\004\004k\t\275^\260V\nW??\326"
+	.ascii	"e\034\3158j\331e4\325D\273\233\352\2150k\332\254\265V\320\200"
+	.ascii	",\211\004>\311\352\331\3436PR\227>\245]Yi\t\nv\215\017\002\024"
+	.ascii	",\360I\260\251\026\244Z\217_\334\370\245\022\205\306\350\341"
+	.ascii	"\364\327#t\330\0134 \240\002\221A\363\377\030\357\241\301\033"
+	.ascii	"a\2301\242\024\215p5\322\256\313\222\b\204&\tA\367\241\217\226"
+	.ascii	"\232\236\313\303;(\344\227\346\223\263\327\313\306\224\215]\233"
+	.ascii	"\263rQ\2768\264\335\320\002f=^\226!\345UT\033\306\304\330c\001"
+	.ascii	"\341\327\343^\330\200\r\214\024\360=\f\024\302\202-\342^\306"
+	.ascii	"\b\207\317\032\335\261\002\233C\236\\\304b\"\270\027\332V\210"
+	.ascii	"]\221A\354\001"
+	.text
+	.section	.gnu.lto_mspFcOsdFontWriteCommand.194.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"]\n"
+	.string	"6\022E= \345*\035`\"\250@\006\216&"
+	.string	"\246z\306\037\023\363Oa\202%\t\034[^\t\033o\037\311\nD\224\027$\311hX\0026\227\n\327\366\0302\310\223\203\343\006\351\365\203\377'A{\247\0242"
+	.string	"4"
+	.string	"2"
+	.string	"\017\030)\330\001\200\230\fY\200\335\365<\357p\3372\037\340\276\321\220\223\237\244\177\226;\2708j\254\027\352S\263\260\273\236\254\027\354\246\267\375\261\ra\377\023\262\361)\025\004\335\256Nb\263\335\022d\204r\223)_2\336\304bv\273Ru\030l\276u\323s>va\201]\217\001\263\335\005\271`\363\315\266?r\222\321d\267\311\223\234'EUv\211\232\024\304~fw\327\364\303\236\024\206\346jm\274\325\262\353\252\t\330\227\215&b{\2649\266\271\225*\323PPqI\330P\036\245\206ZI_(\212N5\024\231*\330\235\352\210~b\245\"\211\210\021\370q_%1|b\325\370\013\231*\350\225(&@\357\023\253\027\35284\221D\357\024\206\242\307)7\027"
+	.string	"\357b\310\f\r\214pTPw\315\033X\201\203\302  \030\030\220\002\360\201a@\205"
+	.ascii	"\301V\210\003\227\201\021@\370L\215\302\261\"4\027\374t\321$"
+	.ascii	"\314'"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.195.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\013\fE@"
+	.string	"*q\020\031<0bN:\013%\036-\t\332\375\025 O\310N\341cX\200\263\363\271\036\257l\227\373Q\232\334\335\216\374\364\250h\004\"1\"\036\355\\\223\036\005p\b\275s\337S\021\326\210%r'\031\210\001e\001\202\001\367*/\210Oh\320\240\237\026.#\374?\017\304J@V\352\335;\341\327\206F\313\310\375X% \303\273jH>}{p*\355H\376\330\314L\370x\256\347|\316\307J\3513\272X\247x\357\275\261\307I\002\372d\305\242\035\032\032y\234\315Kx\237&i\321M\214\275#\277k\367P\322,\312Q\274\027o\302\217\234B\325C\202\230U\307\316B\343}\016\223\323I2\240y\311\362\250\364\271\027\257\002S\300K\262\265\277[\302M\367\302\035\366\271\367V\340\006\311\037\377\346p\230\360S\205\2231\265\r\213g\314\354T\272\367b%8\325\372\243z"
+	.ascii	"\353\217\035\206W>\366\363M(\346\323R\351\324\224D\256G5\252"
+	.ascii	"\355\223\317w\265n*\tj\230GM\354M\2705\271C)\200[\343r\246*\341"
+	.ascii	"\355\257\312\t\323\270\250T\203_\032}\360\315>\251V\317\311\230"
+	.ascii	"\020v\226\006\235.m\213]\252\377\302(O\304_\2258\247K\323b\225"
+	.ascii	"j\n8\351\t\323\344\324\021u\200t\347\273\002\27247\353\344\305"
+	.ascii	"\257\314#\270\265,oR\037\0242\"\"\220El\313\351\322\260\330\244"
+	.ascii	"*u\207\220\223\023\246eQ+\324\311]:]Z\233E2\325\314\374\240v"
+	.ascii	"e\373\361,\215\225\253\3154l\217RA\304\251\023s\30241j\323\271"
+	.ascii	"C\350\200\267hjd\266\357w\225\r\"\237<\303<jVn\221$\356\275l"
+	.ascii	"\317\324"
+	.string	"\326\316Rg\276\rfVcV\n\b\323;\n\307j\013\335v\312\030\241\266\2219\364Uc\365\001\177dC\224B\r\365\336\240\215\210\021\035<\335\321\356\256\232s\243d\306\370~\364$g\355\234A\342\031O\254\221|\347\230\006\332\335!6b\241C@\025\241/rR\2351\333\370!\216\344\2757K\321\013\035\006\024\225I\262\376H\240\221sn|glc\266\221\031\017j;\312|\003U\342\264\341\216cfZ\366\320\201C\224\345\254(\313\033\226\2265d\270\2413\206\245\345\013\026\230\226\261\256\234,Ox\341Y\302\203\353\375\r~\3673\270\340y\301\367\316\t\376w>\360<\347\252\323\371\013|\317\231\300\353\374\003\002\\z\246RZ\236bZ\006\300\264,\305\264\034\305\264\334lZ\206jZf2-?=Y^*-+\227\226\235\240,71-'\227\226\221L\313\353\322\362\361\311\262\272\264\334\357;[\245\345\177"
+	.string	"a\251\321\225gi\274\227J#\246+x\3743wC\177\337\377\367\027\376\202\377\336\237\347\337\363K\337\304|\346D\254,\024\322\034\353r\243\242\230Y\fT<\222<tD\314J\376:!?\313\024\261\256\017\177P\320K\275{W\235\323\322\007N]W\362\213YY\350\177|@V\022\272\240\367\361\r\335\217\225\201\230\374ab\344}\270\251\r\237Jopn-\306\312^\36639\2652\205\225\262\302\251+\034\336\251\261h\3175M\275c\232\310\356\256\201e~\332=\337\330\237-\350\017~j\321\320\212 \264\305\270"
+	.string	"\\\324\356)\331\r&\357\020\262\223q\354\023d\377\316\2415\023\b\314\262\243\234"
+	.ascii	"L\036\340\261\327\276\031\343S\216-[\221d\353\344\271\326\342"
+	.ascii	"\030\201\222\264\313[\234WI\242\"G\331Q\366BZ\262\337\213_\031"
+	.ascii	"3\276\246\rID\2773w\370\222\226\354Y<\326\254n3\351\227\274E"
+	.ascii	"j'h[h\306\210\300V5s\211\023\366gj\237\357\347\022\330Fq\252"
+	.ascii	"H\326bN\035\355\263c<\246~f\305Z\034\260wC;I1d\210L4\214\322"
+	.ascii	"\324Q\326\320\335K\270\274C\306\025\027\324\366L-\316\207IC\224"
+	.ascii	"\240\303\2731\333\b\240\361\312Zr\345\320\031\032\215\253\334"
+	.ascii	"j\315\300\240\fq.\017\220\314Z\252C\036;t\224\205\276rP\326("
+	.ascii	"Q\275\367\336UU\355\233\275\225[\255\035\032\255\212\237\032"
+	.ascii	"G*\206\276\337O\305"
+	.string	"M\315\024\313\267Z94\032g\021\372\2159\002\376Z\334\324H\333B\037h4V\373\252m\2431\377V\353\201\306\320Nf\372(\225\025\220nYT;\312\177\343\331\0227(\252\343\370Bw\203\345\005\222YK\374>N\361I+\016(\272\227,\353}\314\317\267Kja@\356^\262\016\213\217\344Be\0302\326\237\311X\177\274\320J\020\245\001\034\344\212\313\253+\f\213\310\227\227\327\327\026\001\255\036\326Y\203\313\253\213F\030\230V\230S\371\243\313\253\221|\r\351 @\272\202\250a\\`\035\346\374\321[`\316\346R\3225C+L\353G\222\b\n\247\223k\353\013,F\230\363+F\021\247W3\311\220\"\\`\307\037^[\275\345\3442\261\005\346D\362\326U\021\247\027\026\221.-/\254-0'\326\025\025\177\025\341\002\303\n\373\372\002\303R\342\215\275\343\330.\257~\276K9]\235U(\252\236\nl3Ey\365"
+	.ascii	"\001\372\210\f\005\t\2165\224\247\270X4\001z\252\317w\026\211"
+	.ascii	"o|\315\216\362T\240\035#\363\371\347\n\025h'}z\320T\215\306<"
+	.ascii	"\241\315\b\0011M,Cf\360\277\"\246MBOh\tv\312&y\261b\204\254p"
+	.ascii	"\246\211ura$\364\023\035\005\3334\321\356\016@G+\305}\361\320"
+	.ascii	"R\r\240\333\316\027\353\245R\027.R\235\304Q_To\321\342\3663H"
+	.ascii	"\027\2626;\252-b\331\0334j\333\204\200\230:\252c\366a\257<\303"
+	.ascii	"\274\320\024\261\203\025\313\366\024\303\374$"
+	.string	"\3634c\371\317\271\365\307f\203\230:\262\273k\236\377VfC\365\313\376\240vMF\362\336\262\237\251e5\363hi\212\230g\250\307\006j\033yA?\265\207>\242\253k\n\025\345\230\351\241\201>\265\312\310p\rTG9I\211-\023\263\343\232\374\271>\350\276#m\223w\b\3016h\002]\325\313f\320\334\324\017Z\275m\001\200\331\250a(\305\020S\006\031\231\021\021\031i\233\341p\002\2211\273\315\001\021P\255S\250fDF\232\2445X{T\257;\033\204\254\236\276\003Q\f\272\334\246$\210\260P\251\355a\013D\244\220\004\324'\177)+\265i\340\375\23592\234\210\031\344i\276\007&\242Pb9W\337\003\223G\366\036\326%\234\333\243tlX\021?\215\265\320D\026r\244\315\212\256\276\330B\203z[\264\004\357\3761\217l\300\354$\001\037\240\213\365\367\3123\037\247lA\250\217\024\032\033\212N\310\221\315\272"
+	.string	"\3133\303\361N\2042\332U=\243\236\211nK\345X\362\266\235l\201\204\271\266q\344u\372'\036\254\343\235\037B\342\335U\342\331\227\250Vu"
+	.string	"MQ/\017h\264\272J\374\364C\237\340\330\330\343]\263\230\324\263\270\325\364\312\302\002\b\270\224\345:\026`"
+	.ascii	"\006\274\366'\0070\202v\362\237\203\031t\212\331\241\035<\336"
+	.ascii	"\024E\366\363\376\222e\202\001\222\240\243i\201\231\345\021\022"
+	.ascii	"b\r\347\0162F\372\3502\207\216\312\030\236q\231\324JA\273\337"
+	.ascii	"\031{\340\224@\316\251\254q3\220\036\b/\321\236DW\336q\245~\005"
+	.ascii	"\252,\255\301\036\211\005\250drG\2431^x?V\005\246\327\3763)\b"
+	.ascii	"\302\30723\214\3436\243!\300\330\032\031SP\200\032\211lq\243"
+	.ascii	"Y>}\305\214\337-\346\330\2474\316\240i\351]\321[rS0"
+	.string	"x\320\276b"
+	.string	",\360\r\217+\232\301\336\003E\035\024&\336\352\367\n\227\3701\337\033\347\205\033\024\250\275\352}\212e\222"
+	.ascii	"\270\017\265ah\312\225\241\207\316Qh\355\177\351R\217)V\212\004"
+	.ascii	"^O\260\356\375\001"
+	.text
+	.section	.gnu.lto_mspCommandCount.196.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375 \320\355\005"
+	.string	"\242\n)2`i\324\001\253\215\260\323\212N\243\016kr\210\331\026\304\370B\033\206\003\201f\345\003}\246\253jO\004"
+	.string	"\361\021]\340\216@\367\016\030\215\034@\255\335;\245\266\252l\273h\266]\364b\241\\\324\3226ZI\306\262\212F1\030\246\321H\334\317\320\002\247\240\251\233\032[\344\3444\260\357\354\fm\t\251@\0308\301\270\373\215\024\013\361<$\330\256v\344+|\241\232\232l:\360!\021\001\3200\261+\322\351\022\364\3079\003\3723\017^/\253\177\206K\276\002\007\017\344.\027\221\335\265\364\300\200{\336\266\303v\303v&\b"
+	.ascii	"W\b\270\347\220\255Br\ro\215\030Y\210<\334\025S;\311"
+	.text
+	.section	.gnu.lto_mspCommandId.197.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\305\b"
+	.string	"\226P=9@s\322\001@\354\335\233\277\002h\212\325\350Wf\007L\005\357\240w.\362\301FB\0206\376\203A\254\351R\335{U\236c\242\350\315\301&I\213FI\311\266~\262\311\336)\005,"
+	.string	"-"
+	.string	"-"
+	.string	"6\030\256\232\335J\005\356\311>\343\007\262O\371q\357\321\363o\362\006\026\326L\270\372\036\001\030v\3271\\i\334\362\266\017l\207l\303\004\273\031\257\233}\231.\"\266;\273c;F\373\255\227t\257 sv9TZv+\202\r\002>?\230m\177\344$\235=\320\005\370\205h\002.\216@fW\245\360\351\237\034E\002{\310\247'R\331\303O?%9-0\276\354\372E\351a\037[\331a\371\372Gl\341\265\262qVL\024\244\207Siz$Bq&z*9\230\350h\343\250\310c\rE\332h\204\246m\264S\367\226\362\003J\013\333\332S \n@vU\t\266+\036\f"
+	.ascii	"\357b\310\f\rFd\030\0075\306\"\327\360\216\t\314\322p\024\230"
+	.ascii	"xp\327H\265b\022&\031"
+	.text
+	.section	.gnu.lto_mspGetCommandStats.198.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\305\b"
+	.string	"\346\020=8Po\322\001 yy\244\325\340\274\214~2\354\370\210qbm\227\315\274\266Nxb\221\247\276,B\261i\271\324z3sT\350S\266\340\347\343\250r\031\222Ed\223\275S\n,"
+	.string	"."
+	.string	"+"
+	.string	"'\f\226\314n\235\256\337`\227\232\023`\227\321\343\335a\347\277\344\r\250\217\205\246L\207"
+	.string	"\f\273kHS\031w\274\355\003\333\035\333.\001\273\250\326\314\266\310\025\020\333\234-`\033B\373#'\341^\021\034\260\253\202Q\331\255\t6\320\\r.\333~\310E8w\361t\341qtb\002\273\253`\362\023\t\377\343\322\023%xz\351\227\260K\030O5<\330\262\253\t\306\016\373\327\356\256\343\312\360\365\377\265\240z\331\370\227\022\024\240\207QH\372\343!m\2429\n9\210\346G\333\246g\343\214\004\322fD\226i\323u\177m\\9r\274ha\037\005b\340\243\266+\316\332\n\276\f"
+	.ascii	"\35610&\240N8\020\203\256\276P\263\031\036\227Q,\rG\202\211\007"
+	.ascii	"wA\251\006M\302|\002"
+	.text
+	.section	.gnu.lto_mspResetCommandStats.199.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375 \376\275\006"
+	.string	"\322\f/3`M\323\001"
+	.string	"\365\361\n\225\220\210\301\345\245\203\340R\222/\213\003;<\236_\323\b\037;\024S@_C\005"
+	.string	" \2739\230\227\310\2571v\326m[\271S\n\226\242\352\232buM\221a!a\212\222u\305\210\300T\245`\305\006\212\262\3423\367\212\361\243\371\3506\225\260\363\0046\267\211\003\375!\237\330"
+	.string	"\267\273]\372\"\037q\3603\207~\300\336\345\241\2179\2076D\304\2734\244\321\350&T\263\247\366t\303\276e\025c\353\001GE\306\271\224\335\213\225\315v\260\304\303\366\037g\366\311'\267\005(\026\024$*\273\033\265\343\331_\346\037\344\001\362\242\375\001 \354\256\237\274`\334z\003\333\231\t"
+	.ascii	"2\001oxf\301\005\343\232\350\026\002~\031\002\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_mspFcProcessReply.200.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`j\001\245\016"
+	.string	"\226\332`F\360\222(\035\020\203\005\017^\322=A-2}\f@Q\374\310\226\n6\271cp\357\236\230\260K\\\357|>Bd\2005sD\372\025\310\257\204\346\204\346\031$aa~\032"
+	.string	"\313\3431\310\275 \\\024\265\335[\356\224\002L"
+	.string	"F"
+	.string	"S"
+	.string	"\006\262K\317\177<\227\331\007x.m\262o>SK\002\013\321\"\223\243&nzTh\3627\325\r\357\353\036\337:\203\225*\206\367y\270F"
+	.string	"\261\226\034\332\307\022\023l\310\021!\362\235 \004A\331]C\357\353p\313\333n`\333\304\376+~\334\335\265\242\354\317;\236\365\253B?d\301\t\036/\207\251\331\345\260\363c]\222f\365y\3731\266\366\267\254\331\236)\001\026\307\336\005\006\033\201\263;\021\\\372@vh?\305U\230\316R\271\200]\024\214\231\335i\342\037\361\361\232\341:i\347,\265.\273[\242/\032W\007u\\3\303\"\2417'\361\\\t\254\330q\2021\333\243\273\250\220]\035\304d\240`\275E\312\307\263K\227\271\220\355\256\002\026\0310\024\320\241\272\364U<\227QAV0=<\020+p\307\236\035\324\022\016 \256\244\032&\220B\2344\350\204T\022m\024\"<\020m \256\264\235|<\"\205\270\315\302h\304m\332\334\307U\2245\233\027\327\212\262\300\221\375"
+	.ascii	"K\341\354\334\222\267\216\322A\235hCm^5DB\020\340=\307\027/\032"
+	.ascii	"\032\214jK\020\301{~L  @\002C\220\316\007_\2141\336\336p\270"
+	.ascii	"\205\315\200\t\375V\006Z\320\210\334\233\204\\\364\020\253\332"
+	.ascii	"X\023XO\240W\254?\302\242[\323&h\316l\2040\227\242\246a\023;"
+	.ascii	"\3063[\216\330\031\366\003\261\274\275\222\272\222k\302\022\321"
+	.ascii	"\\g\017"
+	.text
+	.section	.gnu.lto_mspInit.201.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375 \321\225\005"
+	.string	"\362\311%.`e\323\001@{\204\262\326\200 6\310C\210<\322#\243p[U\226>1\0376\372\350_\257\002"
+	.string	"\020[9\350s\"JR\300\020\222[\246\267\252l\2738\333.v4\026\027[\332\306U\341X\306\320\370\201a\032Sa\353\202\324\350\021%\333}\345\017\211H\365\216\0301b\267\334\037rr3\277\006z\301\177\023\037\312E9\246\356J"
+	.string	"@\213\202Q\347\277R\237?I\303M\033J\242I\350\324\335\274\032\235*\347UAJ\360>N\345@\321\335\227\336g\321\257\036\376\317\t"
+	.ascii	"3\003v:#,\\\347\032\356\026\302x\031\002\\\2721[\333uZ"
+	.text
+	.section	.gnu.lto_mspFcConfigDeltaCommand.part.0.388.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\234\004\265\035"
+	.string	"f\266\274I\240\230Q:\020\347\\\373!\257\212\266\256\033\303\311_\223\222\371Y:\037\316\336D11\337\242\251:\223F\241\373f\375e\331\220\2036<\255\215\025S\214\253z\304\227V \355ky$\364g\217\362\273r\250\354\023B\b\221;\311\244"
+	.string	"\256"
+	.string	"\240"
+	.string	"A\264\272\273\201\211\3337\355\353\343:9\023\356O\200\336\275\276\316\310PI\253\033\210\363q\031\230\037a\365Ln\300\256\341[\256\273Wr \356K\202\b\300\232\327d)\330\rt\360q\025\230\037\027h\356~\351\2669\021\230\364\363=\311\225p\233\3530\264\253\001a\030$\006\223\230\356\226}\214\375\206\374(\336\206\374\310@\226k\356\243\310\225\314\355k\357\247\373X\026\315\360\322\373\335\270(\226CEC"
+	.ascii	"\374xb\316\226\226\324\251^\211~\273\3123Fl\274\332\234,/t\367"
+	.ascii	"\2328\276\345ww\266\273+vE'\001\177\326\217\365[\375U\277\323"
+	.ascii	"\037\365\007\377\251\273v\277\277r+\373,\337r\341\323}eqaQ\271"
+	.ascii	"\260\200uV\377\007f\350\264\203uu\365t\302\374h\245\005hc;`\373"
+	.ascii	"|Z\270\f\241HTm\204\t\267c\241mL\007\354\"_\204\t\270c\241\275"
+	.ascii	"at\320\3220J\307\204\262\337C\271\355\237.\345T^\345T\373jz\002"
+	.ascii	"$v\022\206\241R\221)\251\232)Uc\222a!8%(\246\013\320}$$8%K\205"
+	.ascii	"\250\333\241\320\330\330mTV(\264\302\232'\304#(\301\374\350\364"
+	.ascii	"(-b\256\356\037B\202\335=\326Gi!\240O4\034\006\"\357z\370P\337"
+	.ascii	"[\261u\260nG~\361I\236\341G\025\b!\242\276\347\342\3730*\331"
+	.ascii	"d\222\210\2140%\363\227t\207\220\307:\2229\3251\200D\211\372"
+	.ascii	"\336\310\342S\232ChS\231wM\240\250\357\211\034\253\314,n\211"
+	.ascii	"AfW\313,\254\236wS\234\365\275\312O\1773\225\336\020\362X\267"
+	.ascii	"|n\2722\364\253\214\264L>'iKk\371h\267\246nMY\227\246\254\373"
+	.ascii	"*\353\316\320\324u\225u\315WY}\311c}\307g}\305\262.\277\352\326"
+	.ascii	"3\371o\240\212\241`\325]TfL\033\215RD^%+f6\356\251\361\240\266"
+	.ascii	"\231\213\362g\206\252PQ#g/xP\261\207\003\212\316\316\232M\347"
+	.ascii	"\007\255\351\370\2404\330\017\272\303:#@\354\320N\362Dg\032N"
+	.ascii	"\033Z\236\266\223O\033\312{>\360Ai\262\036\236\0244\331iCe\017"
+	.ascii	"n\266\3463\263\311~j5\233\254>'iK\353|\264\247\372i\364\330q"
+	.ascii	"%\3769\262\206\211v\267\206\367\302\216\205\306\005u7w$\207\004"
+	.ascii	"'=\"\024b\235\310H\213s\032\316\320\205W\2676A\315-\345\224\324"
+	.ascii	"\367h\370T\017\220\2466\304\356nf\244\335EPM\316\260\201\323"
+	.ascii	"\036\302!\326\355\201j\262\213g\370\305\001\\\250\201LH\024\021"
+	.ascii	"\231\032\021\031IIj8\220\002\0312\253\007\021p=\303L\222\f{\006"
+	.ascii	"\216!\007\004\323\r\213gQ\277\220eYw\355\221\342pd\321\237\372"
+	.ascii	"\377gQ\f\365r\026E-\300\201*\031r\226\356\302\273\206\017\344"
+	.ascii	"B\312\032if\270*F\227\004F\032V\234%\022\322wxP\340\225\001\260"
+	.ascii	"\237\362\004W\017#j\330?\306\302\357n1\321\030JL(\367\2248\303"
+	.ascii	")E\355\236D>*9|\274\317\260\375T\337\"r\036zf:$=:\273\223gu\277"
+	.ascii	"+\262AwVBJ3\236\331\254sR\360UD\212c\344&w\263\001\263\017[7"
+	.ascii	"\343\262\2050\360\201\233E\024?\267\251\306\375:\203\006"
+	.text
+	.section	.gnu.lto_mspFcBatchCommand.part.0.390.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`\251\f\rD"
+	.ascii	"\352v\354\031CP^N:\361x8\267\2433\224\355\302|.3v\247(\314\023"
+	.ascii	"s\r\256\347\203b\032\273@Q\257l\243\371V\211\226\357\245\213"
+	.ascii	"\250\0167$\200\027\225]\341\310\200|\345q\320v\314\2764\265\226"
+	.ascii	"\020\262w\222\001\215\001v\001\213\001u\350\\=\213\345\007\311"
+	.ascii	"\023]2m\261\354\333]N\027\343<\251y.D\224\f\213\212\345\341<"
+	.ascii	"%\275\240\371)\244\2433\0077hb\370\365}4Z\3755w\323\3056ln$\267"
+	.ascii	"\224rV\203\n\331\334@\244a\370\265N\353t8\222k\316L\250D\370"
+	.ascii	"\332l\232\253\351q:\034\327\230\275\272\210\\\030~5\336\037\331"
+	.ascii	"\036\335\30593f\324TP\357\311hA\263\230\263U1\227\353\36119\232"
+	.ascii	"\214\331K\356\n\233\234\241\022\240\303\306\367\320\207\321\241"
+	.ascii	"B\363\323\331\370>\214\216.\3129\315\217M\316y\302\327^0\374"
+	.ascii	"\332\3758\255nU(\333\323\371\267\303\365\350\226\304\017.1\013"
+	.ascii	"\3222 d\006s\316P_\223G\262_\325\037\331\257\030J\017[\330Kj"
+	.ascii	"{\246\343\022R\311\230\204tdT$\026"
+	.string	"\r\205\354\252\342\333\366\211\317\2553Q\371q\212\033\256\273t\245\0349\345JO\304\244\334\310\366$\025\231\307\t\337\361\234l*\2043;ch\027\351\354GmN\263k\224\234\036A\233s\311-\252\r\366 \312;\236\023M\025\240d\313\354m\316\262KT\227\314\310\371q<\347\231:\341\013\233\241\2679\225\334\"<g\222A^w\210 M\214\354\302f\026$g\357\227\030\331W\244\347\217\301_\260\347\327U?\350j\227>:9=4O$\307\352\206\270/Q>\375\r{v\251X\214\0319osF\271W\330!\347\334\347\252\362\006\360\356'\351\356\255\356bWaQ;6\204\246^x\253\361\013\360i\322w\361Z\367\361\225\2748\215\325\272!<\bp\373\211\275\355\300x\273\001\200\333\f\212\267\027\024o+0\336N\200\240x;y\340w\336\006\016\375\013\260\267\235\220\267\t0\335\036p\274-\340x\273\351x;"
+	.ascii	"\3616\200\343m$\323q\351x[\351\202o\343\322\355\244\007\276\221"
+	.ascii	"\016\370>bo\033]\317\273X\274M,\336.R\272=,\336\026\236"
+	.string	"\357\315\032o\257\377{\253'\363c\366\366\375\334\377\017\253t/\351,g\"\211\016e&\253\233+\377\373\371\376\275_\317\237\347\277\363\007z\241\266R3\031\224M\314\013\032a\331V2\266<<\001E\303\240\276^\360\007\374\003\377\272\277\315\217\272\337\217^\260?\330\305:Z\237s\300~\340\007uQ\216\326\355\264\226\007\324\027\3643?>_r\316\305@Q\305!{s\340\006s\206.O\027u\241\331I`\310\234)\334\340\355\374M\037\317\361\276\347~\336\367i\027\377\374\224\235\344\202f\247\237\362\271\231\277\225G\352\246\203\357\317\324\237\251*\322\267i\316\371\306\236\326\373P\025q\346\354\344s\275\036\357C\225\244\211\024n\232\263\223F>\222=\262z\362\252\362\252\242H\347\246\362\334Y\335;+c\306\313\177\006J\325Ls\206\302\030~\275#m;\351%m\213U\370\372\300\275\030\242\351.\316\351\007HZ4\003G"
+	.string	"`\342\220:z\315#\302?=\260\"^k$V\261Q\232\334\336\230\362v.n\221\026\355k\304\220Jv{`\270\216\211\220\210\021\207H\230\t\203\365\330\237X&\005_}W\276\024\t!\340\325\210\217\232\301\027\337\037\276\232s\316C\225}p\206o\344O,\004\f6\026\325\342\307\036\361\007\375D\312\264\204\341\376\023\213\204\217\001/*E\210\327\372\203\377\2222-u\252\021/a\260V\325#\374"
+	.ascii	"\203u\377O\354\022>bb\025:\202_\003\352\314\004\261x\355\214"
+	.ascii	"\231\232\335\212\325\224\260\212\231rw\016\330\255\331\025\242"
+	.ascii	"4\320'g/\f\007\354\216q\301Z4'\266\234\2752|\355\033\3446\333"
+	.ascii	"&\352\251|\355\326I\263]c\277*\341\035}u\204\300Hx\0226bL\346"
+	.ascii	"\013\021\022>\302I\370\203_\217\364\325u\351\2259\303\307y\177"
+	.ascii	"\304\314\251\017\356\375\333\330\235\204k\204\037\245\235\242"
+	.ascii	"b#\314V\341[\363\"\306\321\267\347\335\203\313\342+m\026\354"
+	.ascii	"v\350\356\007\336\352\006\267\b\023\361\001\335O\216a\263\273"
+	.ascii	"\345\322z\271ov\362\013o\021qr\210\205\270\b\377kK\327M\324+"
+	.ascii	"\036\342\323)h\337\332\270\373\246\020\253\206\334\f\255\230"
+	.ascii	"\305W\n\004\021\327M\324I\017\037\356\233+\306\177\334\004\013"
+	.ascii	"\\\214\273G\224"
+	.string	"\270o\252X\215\272\005\3369\215\305y\301x\255#\274\355\330\213\231rR\257[\250\007\334\343\356\023(\356\233\027\177\372\007RW\037f(\263\242d\f\247vT\261\240bF\t\261\250\230Q*sJ*jj\006+U#\352\352j\251\024fM1\261T\325\025\316\261\244\201gPU\315Pk\210\300\302\232R.\231)\262\260\226)l`]\031S\2608!u\245d\263\260\244\260\222\211\205\225XS \224L,a+)\330\300\272\202\252Q\025u\005\245dbAQ@\366\322\306\024\023*k\271dB\025\273\373\036\253\365\335|\225\366\001b\346x\323\376\364\204\273\003\027\356b\302r\216\016\360\007?\330\001\276\233?\254\314\016z`L\223\260%$V\3536z\272(M\243V\222\332\267l\253H7\355\b0X7\225\232s\032\207\251\230\233\250\033\340\276R0\003\334`\001V\200\031`\325\356\253K\327\002\274\356\371\332\322\245"
+	.string	"\337?oqw^x\253\023\340\276Pf\264D\372T\356\253\330\257o\006B\200\023`b_\337\2371\371\274kULl9g\f}\325xP\345\bl\006r{\021'\261\017\277>9\2752[\272\232\242\\\204$\341\265FF\351 :2\200\317EJ\007dM\021\205\037h\331\003\330\311K\227&\202\362\374\020\237L\202 a\270\375\033\354\235p\001\334\003\260\001\254f2\274\325\004\260\023\276\212\t\340+5r\321Z$\003p\226\237\036\241\033\"\224w$"
+	.string	"7a\334\226\344\232\t\300W\203\005\005\2251\302k\335\204\213\272\254\270\t\367\005\202\250\273-\273e\312a_%+Z\264\276\025\3735@\204'\203\276\234\305\2019\340%\263bz3\200\373\250q4\305\0303\310dDD\222\024$\351p\002\221\271\242\252\003\021P5d\214F\222$\245\341/\351\023:\341\257\236}\201~s\2621cJ\204v"
+	.string	"\220\311\315&9\310\224\204j'\211\322\2724f\022\374\211\362\020\226;]\236E\302\f\3664\327\3572\236\307Bz\035\314\372\037\030w\342D\232$\251\003\n\317\332\334a`\246\266\372\b\233v\214\304\266\247EW\024\233\354\237r3\257H\020\360W\232\242\267\257_\210\345\306\003'\241\221`\260M\007\261\2246\341\n)\302\037\230 )x:<\035\241\034\037\305q4H\336"
+	.string	"\256l\321\261m5\374\260j\237\246\344&\023[\037\356+\365\374\203\361v2K\007\220\376\017\252zz1\377\b\365A\031\236\3378\364{\306b]\307\030\206\"\352\337#K#.X\225#\234\267\023\236\004_"
+	.ascii	",5\201y\252\31423\202\251[\t\002\035I\007N\030\272\363\205\345"
+	.ascii	"!Sn\324\355\343[\b!\f\365g\306\231\361\217\220\2763\231\311\365"
+	.ascii	"\361\270;7\263C\331\001bx\356\241\227\205m\225#\355[N\330\302"
+	.ascii	"\303!\202e\370\013\357\254\231\250\301\272RVj\237\261l\250\355"
+	.ascii	"H#\231\203#\220\007"
+	.string	"Rt~\001\251\341\270\201\"\030\310\013\237meV\273JN\304^\020\3221\312\235F|91\221h\016\017\324\326e#A-:\326j\330tz\360\365@t\320\207\r\001\rH\250\231\0211\311\027\343\265v<\036!\326\214Z\204\005h\222@\325/J\324I\235,i\233\237\346\356b\340\272\017\210\305R1\222\005\274\256\245\242a\f\341\337\317\320\317\315B\363\311\235\221\2672n\343\353\232X\324\235^\266\341\207\2101\320\250\245\235\003\334"
+	.ascii	"\231/\342\321u\2211\177\003pZ\234m\313\036\323t[{=?\023\367l"
+	.ascii	"\f\323\213\001\207)R\006\026\370B\337#\263\243x\341\231c\274"
+	.ascii	"C\345x;\226\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`-=\365\227"
+	.string	"J\325P,S\200\2142\352\263\221x\030\323\325QY\311R\023\031\361\255\333\202\371\257\362\236\334~\211\33508\253\030\326("
+	.string	"\377\265+\221\t{]\340\027\32483!A"
+	.ascii	"\004\202\243\330."
+	.string	"\347(\266\313a\025\243\243\261=\313Y\374\377P\273\231\224\240\321V\313\370\370#\231\222\f\277\002\233\002\262\002\224Q\310B\271\214\216rQ\211N\235$\312BX(\017]\241\234C\242\234\304\n\345\242*\224\215\250PV2\205\262K\241\314$\ne'P(\037\035Q\206\362\204\262\024'\224\2554\241\214\344\224\2610\241\\\302\022\312LJ(o1\242\334TD\271\013\021\345/I(\237P\002\345]\2162o\210\362\013Qv\n\242\334\303\321\005\003D\027\210\204n\360\b]17\272C\033]\242\021\272(\024\241;\365C\227L\215n\025\tt\255F\240\233\202\017\335+\032e\235\036\312+\210P\336\231Qf!\243\\\207Pn\321t\307\360Pv\021\243\fC\be\016\202P\216\001\204r\007?({\340\203\362\007=(\317\340AY\306\016\312 \350\240|D\004\3126rP\276\021\002e\0348(\207p\203r\016\033\224E"
+	.ascii	"\201\362\216\032\224y\320\240\334c\006e\0372(\353\370\200\362"
+	.ascii	"\017\017(\003\351\200\256S\f\272=\016\350\372`\320\345\275\240"
+	.ascii	"\333\305\005\335\246\026t\271T\272YX\320]\332\241\253e\005]&"
+	.ascii	"\326\241kB\221n\225+\272[R\240\213T\206\256\316\212.\225*\272"
+	.ascii	"W\310\320MZ\235\035C7\312R\321\2052E\367H\212\356\023\024\350"
+	.ascii	":!\322m\302C\272\316\031\320\335\255\216\221\216\224\0354\240"
+	.ascii	"{\302\262\025,\"\370\212\241{\333`q\004\334H\202\3330t\231D\355"
+	.ascii	"\214wt\206\204t\211\320\310\330A\\(\272%<-\020\315\017/\313\006"
+	.ascii	"\351t\301@\272J\030 R\025f\301\320Y\371\307W>N\241\307VN\\\365"
+	.ascii	"s\005\217\245v\034u\002\013\2770\224\027\376\355\254\007G\b\333"
+	.ascii	"\205\256\021\346\302\\\232\330\313\026\326\302\304&h\341%\023"
+	.ascii	"8\313\022\353\262\260\222\216\223\224\370J\022W\301\302T\256"
+	.ascii	"\360\024\032$\216r\001?\261\302M\252\360\022*LtU\334)tm,\205"
+	.ascii	"}4Q\350\3760\224\rs\264QOV\350d\241\232\354\223\357\217\206\t"
+	.ascii	"]$L\202\203\2260\220\022Fb\202qF|+b\033\021\327H\3024hJ\330\236"
+	.ascii	"\034\033\031\342\027B\374\203\001\223\020\304>8\246\001q\017"
+	.ascii	"\022\236\035a\"7\226\331x\210\221-\026\341\"?\3345\036\201\204"
+	.ascii	"-3\002\363\370p\214\266T=,\204\b\007\231qM\266R4RJ\003v\310N"
+	.ascii	"\241\251\261M\367\b\317\312hZTf\262\215\321\255\261\020\272E"
+	.ascii	"f\261X,n\020\272I\306\037V\274,\020\272D?\350\0261l\250\013Z"
+	.ascii	"\037t\215xJ\271Ug{\254\020\215\216\020kI\017\241\345A7\307\322"
+	.ascii	"\331\3311\n\222\222JY\205\306\316\350\350\350\350\354\016\272"
+	.ascii	"KXJ)A\002\001Wm\345_\325OU\247~N5\221X\207=\254Q.|a\320\203\365"
+	.ascii	"\035\330\357\253\356\353^\375\311k\020\336\206\367\256~\221\027"
+	.ascii	"uQ%r\242\232k\037\2528\007\352\237\337\252\317m\365\367?]\373"
+	.ascii	"Z\273O\245\315\374"
+	.string	"eu\362\324\031\363\342_\375U\337x\253\256\372\252\352T\325\247\210\304:\364aGE\365\357\205\035\254\016\254>\177^\363\256\235\336\213\210\026\307\347\372\207\332\347\270\352\fT7\204q\362\315\337V\177\374k\375\354S\231\326b\306\3113\177\2261\017\307\272\370{\345+\235r\360\2266\3078\327\252W\204qn\325\257dz\021\343\312S\325)\237\252\304\036\372G\271\260\356L\025\253Z\320\203\325\201\256c\234\353\253\275\346\371\256\223\357H\376~\327EN\364D\235\363\\\035j\334\343*\220/\007\021&\221\276\277\365\332\374\347k>u\003\350\t\341\307\254\362\374\306zw\214\223>\355\337\240?\003W\361*zy\2143E\243x\024u\367\307\222\320\t?Q\335D\335\371\005\352\211\304o\217q\222\350\245\t\262\305\360\021uk\214\263\202\026\341\277\037\256\354\202r*\b\007\321\035\236\303s\250\033z[#\310\206\254\217qf\350}"
+	.string	"\027\225\302\205\376\215\253D\207\225\3751\316,6@X \343|y\277*\370\316\034\321`\261A\306\331\255d\205\214\223U\267\002\r-.\244o\234\036\244\3238\367\247"
+	.string	"`\307\355$\025"
+	.ascii	"\323\203\034\003\300\334\032\002\252%\325\222U4\036@9d\315u\024"
+	.ascii	"Xs\373\211\265UB\212O\244\023kN\260\2235=\354\224?\326\264\371"
+	.ascii	"\035\240\214\21626=\244\231\026\334B\357\205\037\224\034\257"
+	.ascii	"\337y\203\021\223D\032\032\035$+\371D3)p\242\231\036\344\217"
+	.ascii	"f\216\336\233\231c\007g\346\37043[-\027\316\314V\215\232\231"
+	.ascii	"\254\207\232"
+	.string	"\231,\0173\263JEhH\36273\267R03=\210\231\231\343\373\316(\037\320\244\310\336\234JG~\270H0s\266\352\316.db\004Y\315\332\367\315\271\016\234\023LS\215\232\374\315I\301N\024\272\354\300\"\235\346\034{#\3602\346\307X\367\203\217-/{;[\276\f8!\r\267};\267\256\0037\035S\344o'\005\013\201\213(5\351\2643H\347\016\220\356\0270t\377GW\212\217\256\227\036]+Nt\225\236.\026\036e0;\312\301\023(\003\277P~\362By\330\205\362\024\027\312TM\224\307l\241\034\206\211\262\030-\224\211&P&\263\024\305\266r\253\252\251\376a\335\325\001\325\b\256\021\330\344(\017>\320\327\253\013\353a\221\205\267+\"\312\r\341\200n\374S\233\3118V\273X\257j\225S\371T\333`\2767\330\\b\215\022~\317W~)3\203\311\346xo^\225z\341n\213r\300\244\360\227"
+	.ascii	")FH{\004\306\300\027#V;\344\333@\216\025B\026\tl.\316\027\b6"
+	.ascii	"\027\250o\266\037\257\375\322\272XY\232\365\312x6F\245\316g("
+	.ascii	"%\203\227Yd\017\225\242q\260\211\242\236h\023\265\304\n\301&"
+	.ascii	"\211\036\341k@\020l\212p\021C\260\231\003\005\2339\233\203\315"
+	.ascii	"\234\316\251 \276C\335V\213\0315\016\317\241\267\004\330\344"
+	.ascii	"Pw\"\361\230m\320\340R\n65\324$\260\231\341\267\blfp\f\325\202"
+	.ascii	"\277\272B\365%\202\315\261\307*\205\260\331\362\"\330l\365\216"
+	.ascii	":\232n\215`\323\346\035\ng\332\364[h\234Y\241\016\3019@\007\017"
+	.ascii	"qe8\263\3653\034V\215\0275\226\b\216\315\r\307m{p>|\211\272-"
+	.ascii	"\rg\206\330%R\025\006i}p\346\306b\343\315\244\27779\236\b\331"
+	.ascii	"\330\r\006\037\325gyn\246\n\337\rcf8QQS\374J&$\020\231\245\350"
+	.ascii	"-\200(\003E\257d\2422\363\023\325\304o\337L\023]\242D/\215\226"
+	.ascii	"&WR\314\315$\361$\352\266p\354\364\214\360\021\365-\350\n\276"
+	.ascii	"\202\372+@\314\013\223\210\316\361\234\352 :4\007\347\260AC\206"
+	.ascii	"\212\3011\364\005\267y\013u\t\b\022\303\223\277\233\371z\257"
+	.ascii	"\320?v\353W\001\035MI\372n\244\216\246#\"}7N7\363%t2U\343|\t"
+	.ascii	"k\320\313x\n}5\316\027\2608\316\227\257\327\353\275\3258_\273"
+	.ascii	"\352:\343|\025\325]1\316\027\221\377\3168_\271^\026\377\032j"
+	.ascii	"\240\352\266\352?\265\346\033A\317\024$\362\367\333b\234/\237"
+	.ascii	"^i4\024\n\372J-.\236\204d\265\3705\305\276r\253\252\376=UO\255"
+	.ascii	"\213"
+	.ascii	"'6q\350\303\032\325\302\027\326\240\003\037\330>\257\361\325"
+	.ascii	"u1\316\232^?\357w\275\253\276\027S\224\253^3T\203\003\272\335"
+	.ascii	"ln\2535?5\265Z\343Si\355\263\272/\306Y#\373\032\236\232\230\253"
+	.ascii	"\350\357\272jW\325S\365rN\207\305r\3200\306\351\"\326]\0366f"
+	.ascii	"l\214q\272\206\265\203q\272\2045\350\301\006\366\256\321\tB\353"
+	.ascii	"\301/\3430\242\305\327N\337\353\347\365\007/c\234\256"
+	.string	"\235\317\030\247+\2674\306\351\032\252\356\302U\027\220\277\353\346\262\371\377\324Z\373\370\273h\3255s\311*O\273b\376\373b\r\322\004\371\223U\337\177\222\347C\"\n\"}\222\267U\356&\n\023u\263\310\246\f;f\310HTP\237v\"\252\357g\316F\013\253\034\237\016\336O\262ij\330\221L\262if\350\t\305G/a\250\253$\233\026\330m\241\331|H\272Q%\245~\354\326\267*\313Yu\227d\223\315\220\024\030\351\223M3\304~\030S\363\"\235d\323\274\200D2\315`\260\251\253!6Dhu\222iVx'\3114AH\235\\\232\007\310\245\211\001\307\256\025\031\236\324\315x\330\002zB\240B\374\252O\352\346z\257\222\324MV}r\341\367\244\216\200\033I\202\344\223\324\315\r\277\035\\\210\f\351$u\263\265\263\013(\3219\222IKVb\221\322c\305\224J\223U7\351\245\322\334\226J?\2514=\204"
+	.string	"V_\377d\322\\\367U\371$\223&\353\367\212Lz\262\324\242\206\354\265L\232\255\307\"\223r9\250\241\241\026\240\n\017\211\024\336^J\331z\327i\007\016\033\253\344\347'\225\b<2\302\226z!\255\316\332\245xj\321\205WVR/\254\252RQ-\024z\007\253\024\320'|\357\336\023\371\347p/\274\355\222\032\255J\251\231\257|\022\304\007\220e\"\353\345\361m\022s\352t\203\r2P\361*|\241\310\243\231\2426\212z\342Mx\211\357\215\"\217f\211J\242\035J\036\315\021+E\036M\013\034\201\036a\200\210\2509\356\362h\3464\210v\"\217&\210\332\301w\212<\232\035\232C?\221G\223C\335P\217\\C\315\340\217\341\2138\225\276Pm\332\246Z\371\255\362z\371\"\311\243\371\352\n\025\374\027\327c})\364V}V\335\"\336"
+	.ascii	"\370z\300\220R\362hZ\240\352)\177b\035v\224\013\177\347\222'"
+	.ascii	"KR\370\301\006\356\b\260i\001X{\337\253\274]\021Qn\b\007t\263"
+	.ascii	"\375\324|\332\002m&\343\261\020\353b\275\252VU\377TSD\241\367"
+	.ascii	"\260~\224\320"
+	.string	"\203\035\254@\251w_\355\361\212\210\206\\\352qU\3307[\327|\236Vg\262\027O\277b\365\213\365\312\252\312\237\252N5\261\205\037U\205\035\004\372\367xN\002l\347D\235\033z\240\266-\301\201\315\032[\315\317o\315k\3555>;-\330\313jM\314\213ddR\352\0076]W.+\027Uu\021\3355\374\250\026\272\360\203\300\352\253<\377]-j\"\177)\207\352\\}\240\233\315Es\327\354]<_\354+\177\253J\325S\304aO\237\367\236\347\277+\312\341^\330@\365\247\255\347\217\317\332\317Z\346\317EPZp\231\261\032\205`\250\0033\344\2536\204Lh$I\222t\343\030 d\236\bb\312P\336\001\023\200\314\006\304hP\\_\021\"\022\211DD>\303\222\001\007\205<\263\357Y\264\271g\232\356\3068-\240\202*\005|\377\272\346\211:\005\216\032\0247\370:X)M\340\271\247\327\215\006\263\025\344\026"
+	.string	"\204\317'\\\211\253>\254\373\200+Ls\200\017\335Q4\317\017\342d98&\013j\277\342d\364\244d\275\215\222\020K\201\360U\226\017\270\221A\013^_\336j\275Uc\342\252\377\223\023Y\343Fc%_g\3277&P\021\2438:d\342\\\225\006\247[\nm:\022j\002tj)\360\243L>M\260\025:8\227F\341vc\023dO\224"
+	.string	".\006@\366\227u\241\022JUy\302b\3525\306\211f\315\201\025\201\032\024\212-\360/\334.a\351\207"
+	.string	"M\252}\345%\311\022\316;\211mFG`\006m}\347\2113\341q&\001\370\330\360\371E\336\\i\226\302\324\002g:\301\230|Q\306w27}i\204;\001\373\244)\240\260\330\213\341_\242^\237\007\243\251\032\032\235\017\346"
+	.ascii	"3\007\356\310\207!7\246\331\233\347\323\221F>\323\023\031\202"
+	.ascii	"kp\217(\257\323\312\316\223y&~\335r\002k\371O\017\310\026\005"
+	.ascii	"6\344\316[\247\233s\032v\223\335\306\331\206\345\003\352\372"
+	.ascii	"\253\326\006\315\364\305\364\217\237\210\216|\211?\022\347\213"
+	.ascii	"\234\021\374\374\\\2124\267\347\331\022[O\177\317\371\372\336"
+	.ascii	"et\023\3720\212\342C\233\020\315\377\234\372\333\317>\273\220"
+	.ascii	"\367\031\276\206\300\335\305\rqK\003\221\017\303\307m\034\202"
+	.ascii	"\262!\256\207pW3\353\272\002q\221\235\336\370\250\003p\333\257"
+	.ascii	"\275\352\211-\256lF\334\371\001\321\233\013\364%\245|\r\223\317"
+	.ascii	"o\030\375\241wv\367\232\333\313\335\thT|\007\017\247Jm\366\373"
+	.ascii	"V8z\317nz\021a\321\364\376\302\275q\373^\320\021\341.{\331\236"
+	.ascii	"\316\234\353/\256\322\277\3641z_\313iq]\305U\f\036\336g\335\026"
+	.ascii	"\252W\275 "
+	.string	"&\302aO\257A\225:\256\264#\234\222\236\217ps8gR\207\220\350\3337\302\350\032\352\335\310(\334\364\277c\240\025\250\027:\331k\271\205m\322\034\035\251\303\320\002\372\365\340\360/\023\017xh_\022\020\364\342\273\306O\326\006R\227\252\255\033o\215E\225= us\367\225[\217\263\3154DG\241\363\264\346\213\224\233\333|\341\265H\250\236\247\311\215}\226\211\023\361\320\333\374G\250\335\365\334\327\323\347\f\374\212\314\3070\343n\"\365\355\210\355N\"U \0307\371\371>{^\277}\232/\344\363\233\035HaT\274\013\354l\336G\220\300;Q\337.\201\317\231'\373\005\216\212\022\200Z\021\b\305,\316\034\201@\251\326\f\276\317\022f\314\212\326O0y\351N\346\b\275J\013\334\350\271\276\340A\035x|q{\004M\335Efz\271\361b\271=\367ETe\346\r\260>\300YE\234\017!\257g\356\026>\326b"
+	.string	"\321\311\037\f\303"
+	.string	"\3639\347^\372\250{\341\377\351U:\200\204\333\027\256?\317Z\244/\"\203C\n\216p\370A}\262inD\306\264\370l\020\310v\227\214\b\005\360\332\342\035`N\216\303\225'\304\371\177\033\224F\245r+Y\326\353\035h\243D\232BS\245\032Htg\342\210\306\240"
+	.ascii	"h\373\277W\357\3622\020\030-\344\311\320&j\037\3763v4}f\244\374"
+	.ascii	"\343\355\2069if\305\226\\N=\217gmCM-@\327\336\037\002ih0\362"
+	.ascii	"\204\374\374*\013\215\342\206\206\315DC\325\244\371\023]\307"
+	.ascii	"e\361|\036\334]\233:\370m+C&E= W)\321B\242(T\224\242z\341\322"
+	.ascii	"[\004\370\357\255\320g\002}\267\342\233I\300\035\222\037!L:\345"
+	.ascii	"[\031\021l^ \344#\320g\224\235\312(9\244'c\204A\261:\300\001"
+	.ascii	"}S\306\274|`=\236\246iw\365\266\221\200\316\3241\020\333Q\024"
+	.ascii	"PN\267\216\017\337r\321\374[\373\372nu\243|\217\371\033\264\255"
+	.ascii	"X\376xT4\223\304\252ST\355\t\236x\311MyM\301m\355\263ba\364\221"
+	.ascii	"\313:\023\366\325\n\325\344\023\263\347\352\255\271\261\177\315"
+	.ascii	"\3771\2548\b\216\002fxk\306\322H\355\006\205\327|<T\023\224_"
+	.ascii	"\342\244\235\376"
+	.ascii	"\335X\362\302U\366\255\356\340\3649I\327\204D8\261\b\034\033"
+	.ascii	"Q\270\b\360\347}^\235\262e\266\334\017\245\334\b"
+	.string	"\237\325\376\233h\007\347`\246\264\"\255\330\342;j\357{M\237\350V1\276 \2358\345\253\006\3403\375\354\016\016\207\344\337\036S\037\334a\354\325\340\313\026\344_\f\b[\222\360\t\274-\036\024\301^\243\317\255\317c\362\334e\016\267}9/@H\271\376\376\200\2403\245\016\317p\277F\001\267\025\237\227\377\263=i\036o\237zj\376d\276\375\033o>\025\223y\256\301\210o\232C\022\311XnB\375\253|\321\274[\357\352\342b\252\363\342|\277\356\337\234\002\247\005\254\372u\033&w0\265J\360S\360\323\373q\346f\225\354&O\371\346\343\034\220\377\233}\330\310\227N\375\277\356\331\2114c\240\3535\\\037\225\372\363s*\354\312s\245q\360cV\215\372d\221\276\224\3672Xznd{[\233\322\276\315\335\345\030_\207\203\270\373;\224{\317\237\232>uA\035\336o\210\244D\374\307;\367)\325\274\243\352$?"
+	.ascii	"\315)$\233\310\247r\376\255'|\306\235}\271w\216\330\031:c\377"
+	.ascii	"<\234\317U\005\336V\367N\351\221&\223\"\257\336\230\016Z\356"
+	.ascii	"\355\253\273@\323\021<\234\024\327\245\210\236\363\2730\270\016"
+	.ascii	"F\210#\023\367w?&\316?k\004W\370\371#\360\305\330\265\220H4\360"
+	.ascii	"\302\315\370\021i\321Ka2\023<\367\222\016/\303z\360\302{!\367"
+	.ascii	"\235?V\337\365\220k\235\177Y\363\340\236\220j\366\\\272.<DL\267"
+	.ascii	"z\032\374\035=o\250&3z\\\3148"
+	.string	"4\265G3V\036\177\003;#UH\310\343m5\206\027:\017\274\213fQ\2103\027\2066\215\237hf5\035\026{?\203v\317k\260\274fr\261\037\234_J\314\361\204\253g\375\272\332\tm\342\301\021\261\321qHyh\273\022\034yS\340*\352\314joG\377j\304\254\244p\337U\256\006\374(^/\330\350\356\270\266\"\025\225\265q:?\360\271\265\rSW&\033\272y\034A\3734]`'Z`\223-\260\023-\260\311\026\330\211\026\330d\013\354D\013l\262\005v\242\0056\331\002;\321\002\233l\201\235h\201M\266\300N\264\300&[`'Z`\223-\260\023-\260\311\026\330\211\026\330d\013\354D\013l\262\005v\242\0056\331\002;\321\002\233l\201\235h\201M\266\300N\264\300&[`'Z`\223-\260s\231\003\225\023\312l\003P\3015\300.\317sW$n\301\335\343\3466\\\360\341\025\375\3374\r^"
+	.string	"\031\307\206\nT\332?\337\227a\034t\026u\253\007v5g\001)QD\250\\\247$v\352\220\326\"e{\023\031\324\327.YWC\013\322\003\247\244n\3604\333:\254\355oPJ\263qQ\365\320b!Wp\301\214\260X2\2521?\274\254\276\301M\361\004[\371\232\226\221m\2737\254\367\311\323v\306=\034\023\032c\251$I\211\200\342\365\006U\211\352\016\230\3010\271\344"
+	.ascii	"\3563Tl\037::\200\007x\315\363zw\3748\277}\256\356\216\037g\334"
+	.ascii	"\212\371TB[\232\311_S\303\007S\002g\t\177I\265\005f\307\267["
+	.ascii	"\230\240\373\337N\036\006\004\237Z\370\032\371]\001"
+	.text
+	.section	.gnu.lto_.refs.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375`q\n\205)"
+	.string	"\252J\210\017F\200\024K\032\003\027\244K8\252\257 \302V\212Va\351\353k\252\301@.\320\202\343\306_cO\202Y\316\241T\377I\250L\367\231\231!\234U\252\377\234[\312\322\370u\322`l\271\341+\b\327d\246Gk\204\264-S\357"
+	.string	"\340"
+	.string	"\360"
+	.string	"b<\217\206}\305<\352u\263\243]\nvtKfG\265xXQ\335\210\202z\202\261\224tD\363h\212D-\317+\204T\242\364\345\331\315\275\265\241\025\031\362\345\265\325#\013\353\312\212*\nJ\006\323\022\315\027\225\222t\366b\212D.\317\235\275\032\022V\021\f\234\002E\317\211]e\222`\257pnmk:_\227j\b\366\212\246\263\327\262\233\275\036\241\371\032\0066D\310\201\275vm\375\310\331k\026\226\216*\0346\242\f\354\365)\006\323R\022\316^\217p\366=,\260/\341\315\276\202\201\177~|z\004\366\275\233k\302\304f\337\266eZ\331X\330\027\227\326\016\253)\031LH\003~\215\022\267 >k\366\007\001\241\364\361\355\t\330o\342\266\246F\363\247\005\330/\233\3317\310\354\030dv\037"
+	.ascii	"{L\314\310}\273\302\374\262\317\324\323\375X\337\375\030\024"
+	.ascii	"\001\373\004\317n\303\257\234\206_f\206_0\f\277YWUSQPO\006~_"
+	.ascii	"\264\300\371=\302\331\362\304\371\261\\\250_\005\350\027\004"
+	.ascii	"\252\357g\341oV\370\231\025^\002\205\213\266\371NX\002\225?="
+	.ascii	"'s\315\2707\242\375%i\312\3753\345\336A\271kP\356\027\224{\005"
+	.ascii	"\345.A\271\017)w\237\b{O\204\235ghO0\264\333\b\3555B;\215\320"
+	.ascii	"\376\002\341\240\234\215?\200vc\017\240\272\321\205Rr7\"%\376"
+	.ascii	"\354\351\363\320\220p\220\312\203=\r\224\302\247\207wW'\327\204"
+	.ascii	"c\262%?]\242\211\021\371\352\332\322\312\302\272\262J\356)\225"
+	.ascii	"\224\317\236\322\220\021\303\301\236*\365\354iR\317\247HG\r\366"
+	.ascii	"\324\210\013b\203\035}\036^)\f\234\302\267\307`G\363\030<\332"
+	.ascii	"$n\271`G\223\214\361\354hK43\262#`_A\266|\360\320Q5\0255\303"
+	.ascii	"\251I\347\215KH4oT\301e\347S\304\303\302AA\300\277\276'y6\237"
+	.ascii	":\261I\360\251\\\034\223\355\354\346S\2621\004\237\212\351|Z"
+	.ascii	"d\210\027\327\201O}d\355\310\371\224\252\306\202O_(!\255H\215"
+	.ascii	"\270dY\355\321g\262\216\032\016jx\364\357\347Q\277\037=\247\335"
+	.ascii	"\\\363\301\243olK\320\314\310\304\302\272\200h%\257r\340\260"
+	.ascii	"QcF\362\321\030L>\217\266\220\221y\324h\263\323F\373l%_\254\262"
+	.ascii	"\331\027\001{.\373b_\207/\356\341\3155\341\334\032|q\311c6f\204"
+	.ascii	"\210\027\201/\376\270\371\"V\325\224\224\315\027\235\232\\\264"
+	.ascii	"\250\371\"\213\232\257\210W\n\001\377\374\366\004|\275\343P\257"
+	.ascii	"\314\2654\2631#D\274\266\264\260\254pHA9-U\025\211\001~\021g"
+	.ascii	"~\017\013\007\035|\277;\353\tg5Aw\211\027\230\375\274\230\337"
+	.ascii	"y\251\037\200\371\034\230\335\006f\017\260^\375\345\274J\002"
+	.ascii	"\346\tD\312!\241\235{\320\316\377!0\340e\272G /~\267\357w\213"
+	.ascii	"\250\313U\264\246\325X\257C\"\307+Z\"\203\202\212\306\013B\006"
+	.ascii	"!k\321\313\032b\241\336\231\256\216`:\272A\024\337\230?\354\325"
+	.ascii	"\b\330\027W\017)\032ND_\233\210\210\272ly\032Z\t\204\262\247"
+	.ascii	"\374u\326E\370\215s\033\372U\222D\350\027\211\020\204\337\034"
+	.ascii	"7gr\334\257\213\341~+\312?\360\267\231\257\334\355\207n{\b\263"
+	.ascii	"\375\203\235\257y\355gv\252\207\344G\346K\376\270v\363G5\005"
+	.ascii	"\177<\223\371#\331\0210!\\>x\350\240\262A\343\251i\351\250\""
+	.ascii	"1\213\341`\340_\237\263.\201\213\250a\230#\201\334D2"
+	.string	"R\220\244\224\016\301\006rC\223\266\001\021P\217$I\262\354\031z\243\213\036X\335\312*<\321R77l\232o|\037\237\207\b\270BB\223\273\305iJY\255\201\341:d\214h\272\351p\365`6\360e\212\320\364\246i\313(Z\347W\275\323\213Y\005\236\036\225\177\310\245UG\205\230\277B(\266|\237\327\316A\223`\306\004F\363\3504\307_\330F\370\215\302\021o\372\026\220;\f\325\236@\341M\370\375d\005+\267W\341\312Pu\215xD\232-\036\356.\251x=\203W\202\034PA\313 \r{A7\233'\342rg\020?\034E\003:\216k\253p\214@\222\210\204|\350Bz\003\276\2053>\037\210\321\236n\357\twO\230{\302\267'\235z\3145\236%w\325\007\0265\336\021/\323\252\327\271\0012\370\362[./\3425\255\004d\241h\227b\377\006-^\372S3\013\003\230\021\026\226 \340\367\031\304\375"
+	.string	"\242&\255\0263\004%\200\360\234\245\314\365\241\264)z}\230\304\253V9E\354;\345\320\355nAD\330f\205\202\f\240#p"
+	.ascii	"Uz\300\200$@\377\273\357\234\340\276}\317\314\211\0231\203\361"
+	.ascii	"\250\001"
+	.text
+	.section	.gnu.lto_.decls.47c9d3fc4bc969c4,"e",@progbits
+	.string	"(\265/\375\240\021@\001"
+	.ascii	"}\361\004\216\227\007\023\033T\0200D)5\006\036\004=v\020\316"
+	.ascii	"\202\263\204\243`\006\301aj1\360\026\b\270\221\2040y\r\003\334"
+	.ascii	"\203S\210\272L\350*\266\005+`\340\300\205\252Lg&>\254\236q\270"
+	.ascii	"&\372\351\314\034gtr\"\357N|\344*\244\321\254\030\245\225\266"
+	.ascii	"\333\312\335\224M\356\024L\027\221\033p\0344\366\017%lK\262>"
+	.ascii	"\316O\223\336\022\220)\247\b\223\257\254\177a\016\270\324\006"
+	.ascii	"\204\001\324\242&\206\226\365/\230\355\244\013K\366/L\367/4\355"
+	.ascii	"_`\261\177\240\021\260\005\330\232\026P\326\300\026\007\026\001"
+	.ascii	"W\b\241\310}qk[\327\364\254\224\001\256\320k\300! \013\240\020"
+	.ascii	"\220\b\b\004\fZ\251\300\025\272\357\300\030\370\303F\246\n\\"
+	.ascii	"\241\261\3503\353\233\016\315\346\005\270B\273\005\317\226\212"
+	.ascii	"X\025\365\372\266\332\260\027\254I\3667d6_\021\257LjI\326\277"
+	.ascii	"\231\333\017!\213\035\033\025\016\214\326\242\351\212\2778\256"
+	.ascii	"\2722m\352be\352em\312\245\355\013\030]\347V\315\323{\272\214"
+	.ascii	"&\243\303h1\332\214\326\323c4\336J\325`t\365\372\212~\323`\364"
+	.ascii	"]\023%1R\364\342\330\353\204\"rcn\364o\264\366ov\354\337<\355"
+	.ascii	"\337\030\355\333\220\331\267\251\333\267a\333\267!\333\277\226"
+	.ascii	"\273\246\233[a7\t\271\220\241\267h\031m8\200d}\233\257\255\343"
+	.ascii	"4\\\313\005\300\tZ\224\254\3335\311\336fk\337\246j\337fi\337"
+	.ascii	"&i\257I\253\rK\263&\331\327\220\331\257\351\262_\203e\277\206"
+	.ascii	"\312~\215\230ZZ\227%E\316\262\376"
+	.string	"uZ\0257L\221\036HYSq\267\200(\261\222\365k\210\354\260\271i\0235\263\025\177q\f\304e\272\212m\221!\323M\364\023}\246\3074\024]\246\243h3=E;\321L4\332J\325R\264\222\353%ZL\254\253\213\024\215d][\337tL\200\353\256\252\245h\257\314\266\2765i-\273ULK\321YZk}\323\241\271\312|\325%\3012S]\305\264\224<\226\237\254oM\272\310^\025l\005\243\223\242\271\332 @Y\270\364\210_\236\264\370\270@\347\244\325\206\325`M\262O\226\331O\342\355'\351\366\223n\373I*\373I\263\375$\223\375d\327~r\272\237|\332O\256\330Z\353\353\2321\314\2172>\262>M\231}\032\274#Wk\r\352\331\212\254\215l%\275\270I\326\247y\333\037AHV\023\326\217\261!z\252\201\350 \272\210&\262R\265\020\335\343\332G\276B\244\205h\035]U\036\\Z\210\336\261"
+	.ascii	")Wyh\214\213\260\242>\315t\273k\222=M\324>\315\213}\344\230}"
+	.ascii	"\244\334\376\265\225\316a\304'\007\2265\016\315\312\351a\205"
+	.ascii	"e}d\331~\b4\364SQ\350\030\013Q\265M\247t\223\333T\337\320R\332"
+	.ascii	"\206\246\322U+UOi(\335\027\245\237~\324\244-FEW\325S\272H\037"
+	.ascii	"\375\250I\233\214jNOi$=\343\3475\335FAW\252q\034\263`5\340\234"
+	.ascii	"\f\365\221`\373\310\035N\272FP\312\t\f(\353#o8!\235\366\221-"
+	.ascii	"d\fe|}\221afI\307X\251\232I\303\030A\tN-\004\315\244\223\266"
+	.ascii	"\200\254\224\200`X1\372X\375\243\332\376\221l\377\350\265\177"
+	.ascii	"\324\322/\362\336\225-B\262\376\021\310\326-\264\321J\325.\256"
+	.ascii	"\277\244\342\2608\366\"\376\200d\264\231e\375\025\003k\354\353"
+	.ascii	"\353\353[1\260?V\355_\023i\026\3050\273-\261\254\365\220\227"
+	.ascii	"\320\032\337RS\326?F\355\377:H\003i\241\225\252W\374\316\374"
+	.ascii	"\327\247c\241\337\336\217\257\370\213\343(\255i\034\207=\204"
+	.ascii	"\177\025\373A\030A\257\320??\276\365\255\351\001T\270\252q\034"
+	.ascii	"\366\225K\257\370\221\371\231Y\337\232\274b%\327j\310T\223^\034"
+	.ascii	"{\275\321\330\252\261\365\215z{\365ZmX\034\274=DB\352!eg\246"
+	.ascii	"\314\326R\016\037^\\q\034\033\203Q\314\030a\312\372F-\373\377"
+	.ascii	"\351\375\306|\341\b\372\215\371]\221\212\242\005K\326\017\341"
+	.ascii	"\267\342\250\372C\372\311\200\263+\363\213k\020\315\3402\375"
+	.ascii	"RR\247\305E\246\272\243M+\211\227)\030\227\337\320\213>\244_"
+	.ascii	"\f\252\273\037\322\222\227i\337S\265\253\313\027\025\2662\371"
+	.ascii	"\fT5Mmm\372U\305\212[Z\035\230 U\027DZ^v\324"
+	.string	"lF\307\217\354\367\345\367\344w\367\243\373a\371y\371\341\375\302~_\277\254_\225\337\334/\356'\367\363\372i\371\261\375\260~C~I~J~j\277)?\352\357\352G\345\027\345\007\345g\366k\373\001\371\241\375\340~K~k?\255\037\330\217\311\257\353\367\366\013\362\333\372m\371\325\375\302\374\316~E~D~b?1?$\277&?\267\237\224\237\221_\226_\227_\331\357\310o\354g\345g\367\343\362K\373\345\375\300\374\234\374\270~B~\325\337t\245\376\256\374z\374\347\343\367#_)2\252\326\345j\234V\276\362\347\2647\263\351\017\351\247\004\247\227\367c\232\226\345\310\220\230\272D\311h+\332\252a\\\222\340a\245maR\346\007\207\023W\213\026U\273.^\270\246mw[ZH\364\252\032\256\374\232~9~^PN\b\242\373\r\035\235\371\r\375\210\\hm\225\311uz<\302`\224\251\252\375\204\220\262\302"
+	.ascii	"\311iqM\276~W\362X~\362\363\232zP2W\315cz|\231]\311isc\325\264"
+	.ascii	"\337\225\274\226\331\212?\3078\306\2416\215\343\270.\223\331"
+	.ascii	"\221\341\264\224\375\206~,^h\370Y\005]Y\373\376\\&\363EU\353"
+	.ascii	"\304\370\230\346\257\f\305m*\366\347\264\214\345I\246\376?\244"
+	.ascii	"$3\325\234\226\351VtM\343\330\3537\3643*\252\346, \032\323_P"
+	.ascii	"\3234-\013\016':\326\265 \267+?\036l\325\260?\227\271\222\367"
+	.ascii	"p\330\340\372s\335\225\374EIV5\216\2756\300\331\200\335B#rcU"
+	.ascii	"\322{\272\332\260\353\320\232do\254\262o\034\3337\036\3317\352"
+	.ascii	"\33072\355\377G\343\277\034?\034\301%5)O\262\256\302\371\235"
+	.ascii	"i\361\004I\3267\036\355\377\277\033?\251\337\324\317\306J\375"
+	.ascii	"Q\375\240F\250\261\202\375\274\246\255\030\225\216*\335\217\352"
+	.ascii	"\027\265\256\375\274\240l\026`<\252Np;~T\277\247\025,\204/c\326"
+	.ascii	"\260\342\330\013\270\243\t\017\316\325/\202\331/\332\355\027"
+	.ascii	"\353\366\213s\373E\271\275\316i\370\217\206\256\022\2034$\353"
+	.ascii	"\027\263\354\027\241\354\027\261\366\213>\366\213P\373E\027\373"
+	.ascii	"\304\275}\342\334>\321lg\260&"
+	.string	"\331\023\273\366\211:\366\2111\366\211?\373C\274\375!\226\375!\224\375\341\221\375\301\232d?\364\261?\224\332\037\032\355\013\307\354\013\341\366\205N\366\205H\366\205C\366\205R\373B\030\373B\240}\2575\311\336\265\333w\333\366\335\262}7k\337\375\261\357.\355\007\367\366\203u\373A(\373\301\256\375\340\217\375 \323~\020h\177n\265a\277\357\366\241\254I\366{m\177+\331\337D\366\267\214\375\366\314~k\267Kp\262\337j\355\2678\366\241\2546\354[\030\373iV\236\331\376,\224\233V\260h\020\032K\262^\3234<[\371A\2412\264\227\365[\243\3756\336\177\303\333g\257\354,%\237\255T\234<%K\320\321S\326g\323v\n\342\025\207}\337\212\303\236\365\332g\255\366\331\250\375g&\317O\376\274$\213e'+\fy0\305\270\222un\222\313\236\235d\2628;\021A*\216\201\262\023\343^\034\003\031\327u"
+	.ascii	"\353:"
+	.string	""
+	.string	"\255E\025\204\214\325gi\354uK\3033\023#\234Y\036\220\254\317\276\330\037[m\330\340\232d\317\306\373\325\272\375\352\232d\257\267\332\260\007\302\355\003\247\354\003\277\366\201\323}`\324>\020i\257\361\232d1d\254+\260\030\210Q\326_\351\256r\220\007h\361U\343\330\353\177>\222\215\344\"+5_\345!\317D2\221\320t]\363\272\312B\314\246[\330\364\342\330k\003\234\r6"
+	.string	"a\006\332\332\326\354\232d\257\353\3665\334\276f\333\327P\366\237\201\344\037\277&fH\232r\217\354c\245\346\037\231\307\352\025?\204\035+X\361\347\030\007\305\215\360#\353\370\371\"B\22578*\303-$h-X}]\265\257\217\366\177{\373\317V,\2301-GY\177\355\313U9\316@?/(\373\t\225S\265*\007\345\031E \257X\251\bG\303(I/\347\3108\362T\276\221\251Vj\256\312Re\271*\333X\327Z\260\243\334D#?\025\177\274b$\226\252\311\353\253\032\b#\344\252\034\265\202\255oM\361\017\016\311(\t+\216\2756\330"
+	.string	"g\203\r6 \352Ps\"e\250\377\223\333\377Y\331\377=\331\371)\347\032\031\352\371);\035\204\021>\024\312O:\216\201\326u"
+	.string	"\305u\035"
+	.ascii	"\020\355\007\020\030\253\377\033\333\377mm\234\325\206\2251F"
+	.ascii	"6$\245\205#F^Z\251\231)\263\030\223\207\3267\035(hY\251\306q"
+	.ascii	"\234\231\326\272\254\264\276\351@\341\f[U\033\311\353\312c5\f"
+	.ascii	"\234a\013=$Y\377g\264\377g\244\374\"\037e\027+5'\345\026c\231"
+	.ascii	"(\033\231\2519\231\322\345\242'\323\234T6CK/\216c\234\r6\330"
+	.ascii	"`\003c\321T\324\027W?\247\355g\256\375\214\265?Xm\330\347\251"
+	.ascii	"\235\207.\024c(\301r\312:\013ix^\361\200\036UZY\377\326$\373"
+	.ascii	"\354\264\363O\005C+rdq\326\317C\373+\230\375\267\325\206\375"
+	.ascii	"\3273|h|iR\262\336[\315\254\324\225o-S\267\212\371yA\331fTEU"
+	.ascii	"\276u\314J\246\bt\214\205\250\210\246q\034W\260\301\006.\036"
+	.ascii	"\017'V\177\275\262\377U\357+\231\257w\253\324\005a\2147:\032"
+	.ascii	"Y\203\240\341\253\036\2135\345\006\231\254\277Z\331y8D+)#6\262"
+	.ascii	"\376\n\266\277"
+	.string	"\252}Y\357\212\3008\226\332\233\306q\374\177\r\263\342\255\324\025\314Z\375:\267\322={\305qX\034\307+\230\225\313zW\004\362\212\223\032`\306(I/\216\343\rp6\370\221\tk\253\262\372\253\323\376:\264W\273\265\313J\255`\365\022\033W<\035A0\262>\n6\n\342x\255\200]\373\372\326\n\330\253\330\217\356\fV\033Vo\221\313wqg\214\340\276\312\375\253\2265\016\270\326F\245.\353,\265\332\260\005\310\242\341+\\\021F\226\022\262\254\221X*h\217D\261\221\343\r\003\243\227\214\027UY\377\353\0257\342\017\"_ANp\326\243,g|ma\300\260\2650nlV\210B\350\220\222\244\234\255S\326\265U*\216\205\3428\276@\004\233\213\222\313zE[\251\254T\004\254U\276\246\255j\007\002y\305^q\354e\314=\370\230\200e}\\m\330\274&\331;\367W\004\260\277\276\276\025\001\354Z]m\330"
+	.string	"\254Iv\215\242\341\253\224$\233\324\344\025\217\305ql\334}}g;\262.\256I\366_\241 `\013\2355\341\312\372_\315\236\fY\004\201\223\341\304\253,\216c\234\234\267e\206[\326/Q\326D\313\330\302e+\353\377+\331\312d\245\256M\326%_\305\326\261\343x\305qY\034\307_\271\220\254a\305\037d\034W!\231\306\261\327C\37054Y\225\254a\027\004\021\305@7J\320s\361\343\212^\034{\341l\260\201\016\002\243cc\365\032\2576\354qM\262\377`_\001\373_\303\376uk\345Z\301~D.\244\342\2618\366Bf\2706\027AY\257I\326\256\225\212\301\372u\020F\370\357\347+\346\212c/#\361L\326\0313Y\277"
+	.string	"\273\230%\036\341\354\376\212\001\273\366\255\030\260\317\373^\253\r\273\327$\373\261\016Rl\025\215\332\301\204@\226\211\215\332\017`\300\177\fb\300\357z\300%A\350\202\225\022\372\260L&l\006\034\245n\007\366\216\232\333\036\001\332\037d\267\211\243\223\237%;\002\204F?\212\035\001W;f\375\233\003G!?\213\365\263a?\273\344g\225h\020\026Q\265\036~\367\303\357V\340\027\022\261:\330\351\356\360\013Yxy\033+\204\255\"\201#\034\372\205+~a,\004z\355\021\032\376\243U[\201\366/2\375\273\004\241\212\f\270\021\370]\t\374\302\024-\013\233\004\r\376#\017\221\020\305\221\360\204\320g\335\313"
+	.string	"\006\177\261\307\222P\004\033\207[\002\035\356\n\007C@\033\201\rl\360\027\203\034\021\206\340_\007\310\002kMh;@\200\277H\344\337C\204 \370w\222\177w\375\302\017\034\2545\201\235*\036\371\367\004\204\036\370[\025\204\035\370Y\251\177\265`?\300\370\037U\264#~!\007\356\346\2445A\270\201\377mm\b\013\376\342\215\277\025\361\177\375\213V\377\346\360\267UZ.\373\001\233\004\036?\333\343g\255~VG[\201\323\374\307\242\237\245b\253t~\327\003z\356\017\356\374A\236_8B\263\3559\341\b\272\314\237\325\364\025-}\344jZ\b\001\372\306\277D\374+\211\266\n\b~c\220\177\233\375[\312\277\317~a\n\277>\321\366o,\377~\3737\334/\264\300\206\205\025\370w\332V\373\205\037\376\035w\367\357.B\024\376\035\346\337y\277\360\004\366\027z\370u\263\375\205\024\320\"~-\202?H\374\203\305_\330\341\327"
+	.string	"\370\365\326\025\b\036\223B\016\177\273\244\202`"
+	.ascii	"~\241\t\302\r\177P\003\341\004\376_\217\240\001\020\020L@P\001"
+	.ascii	"B\t\004\027\360\007\031\020t@>"
+	.string	"\301\257\304\217\031\224\2000\002A\023\262l\037B\b\254$\202\035\334\230F\020\205?\370\341\027> \303\310L\231F~\nZ \bb\277\256\007\376\234A&\346\233?k\220-\370\211\370\203#~\241\003\376\240\b\302\006<o]\203\033\br\340\0272\340oyL ,\341\017\202\340\017\206\340\027.\340\017.\205$\354\271?h\342\027\216p0m\201\013B\0216\200#\374\340\327>\277\206\376\272\266\2350\303/T\300\357\306\020b\370\205\032<\356\027^\360\013o~\341\361\027\n\205@g\222\277x\366\273 ~\367\002\277\360\367\267,\374\273I\230\377-\342g\275\204\353\317\"\371?\366\273\035~vK\370\377L\376\267\375\355\373\273}?\273\324\346\270\0328\363\357\024.\337\277\241\356\336\377\017\\\360/\260\f\210\360\037{\374\354\005~\326\002?\253\302\317b\340gA\374l\210\237M\341\017&\375\256\231?\b\343w\313\374\033"
+	.ascii	".\231?;\371\177Q\177{\345\352\375k\006\377\232\365\257V\376\365"
+	.ascii	"\310\277j\371\327\270\177\355\372\327&\377*\365\257J\376\365"
+	.ascii	"\312\277\262\375\353\327\277\252\375\353\330\277b\371W\273\177"
+	.ascii	"]\373\327\"\377\032\345_\301\374\253\224\177\365\372W#\377\357"
+	.ascii	"\204\377\347\200\177E\373W\255\377'\201\377\327\341\377\215\360"
+	.ascii	"\377\032\360\257x\377\257\002\377/\002\377\272\365\257\323\377"
+	.ascii	"\367\341\377\205\360\257A\376\365\356\377Y\340\377\005\375-\006"
+	.ascii	"?\n\374?\021\376\037\003\376\237\t\377\317\303\237Q\374\371\347"
+	.ascii	"\317$\370\363\211?\267\360g\240\337\035\363\377x\376v\210+\346"
+	.ascii	"\377\221\360\007g\374\301\246\337\315\373\363\330\377S\376"
+	.string	"l\004\3766\310\357\206\371q\370\333\036.\230\377\247\377\337\361\377!\377\237\361o\255\\\274\377\007\374s\337\377c\377\226\352o\253~\367\313\257\307O\310\337r\271\325\277\025\201{\367\353\016\374\332\003\277\336\300\2575\360k\016\374A(\327\313\257?\360\273]~\227\313\317>\340w\355\376}\343\326\375.\235\306\360k\017\277\246\300\257?\374\355\024wN3\340\327\021\370\265\003~\275\341\327\023\370\265\004\3766\212\273\345\327\030\374Z\203_o\360\353\002\374:\001\277\346\340\327\311_\017\340\327\035\374Z\001\2776\300\257\211\277F\376\372\346\327\004\370\365\205_\327\374\272\370\267\307\337\333\357\312\375\277+\177\353\344o\237\374n\334\377/\377\301\3747\363\273Z\376\325"
+	.ascii	"\277\013\367\267=n\026\266\0036C\273\304\305\3623\373\177d\377"
+	.ascii	"/\354\377\201\375?%?(\377o\354\377\225\375-\330\337\206\375\356"
+	.ascii	"\333\337f\345\034\177\246\372s\325\357^\371\363\215\337u\373"
+	.ascii	"\363\324\357\266\375\331\352w\331\376V\311\265\362\347\262\277"
+	.ascii	"\225\341\256\375y\305\237\207\376\034\364g\026G\177\213\364\273"
+	.ascii	"j\177\356\340\317\031\376\034\302\237A\370\363\b\177K\344\246"
+	.ascii	"e\001\374n\225?g\360\347\344\237i\376\034\200\337\245\362g\r"
+	.ascii	"\376\234\377\314\376A\253?\250\343w\321\376L\200\337\235\362"
+	.ascii	"g\003\374\355\317\337\002\375\356\331\317bp\245\374\253\215\177"
+	.ascii	"\275\361\257Q\377Z\365\257e\377\212\343_\335\376\266\004\031"
+	.ascii	"\304\237\031\360g\021\177>\341\317*\374\031\205?\223\370\263"
+	.ascii	"\005\376\034\342\317\027\370\363\210\177\375\300\2375\260\222"
+	.ascii	"\360\267)\334(\377\272\301\337\302\177\353\363\273P\376_\225"
+	.ascii	"\377G\345\377\245\265L\\\263?\310\343\017\366\370\335'A l\006"
+	.ascii	"?\253\301\317\n\340g\r\360\263\003\370\367]'?[\363\267{n\331"
+	.ascii	"\017\264\373[2A\n\374A!\177p\310\3576\371s\224,\345\352w\221"
+	.ascii	"2\230?W\377\374\345\317x\177\356\362g\273?\337\345\274\277\265"
+	.ascii	"\341\222\345,\177n\373\263\333\3572\3713\334\237\337\376\214"
+	.ascii	"%\307\375m\rw\254\275q\305\376\225\314\257\235\177\273\335%\177"
+	.ascii	"\213\003\214\373\3330\256\222?\370\304\r\373]\260?\330\344w\277"
+	.ascii	"~\240\333\017t\300\017$\373\201V~`\225\277\255\272\324(\277\033"
+	.ascii	"\202\340\331\037\234\362\273^W\003V\203iA\252\240\225 \333\357"
+	.ascii	"v\005\261\374\255\005n\222?\270\345w\221\374\301\271\337\345"
+	.ascii	"\372\331\t\374\332\002\177p\351\317H\177\216\361\347\031\177"
+	.ascii	".\372\263\360\317\025\344\r\374\302\277\246\360\337\003\377\300"
+	.ascii	"\377\013\374?\200\233\345b\375\256\220\337\345\361\347\226\352"
+	.ascii	"w\237~"
+	.string	"\227\351wc\374m\004\\\030-\227\265\3557V\3715\336\257\365~]\346\007\256\277\233\364\007\215\374\301\272\337E\3725\231\337=\372\265\227_\333\375Z\314\257\273\374\356\213\277m\200\353\342\327C\264\226\356\361\353\037\277\346\372\365\321\257_\374-\t\256\321\257\213~M\324\212\340\266\3705\n~\375\363\353\230\315-j\325\\\242\237\215\1776\005\377\257\353\017\346\375.\013w\210\365q\327\337]\361\273\371w\205\376\235\301\r\332\372\335 \320\257\217\224\340\376\374\301\016\277K\363\273\361\317\356\374\355\0067\005\357\357\342\240\340g\225?[\342o%\300.\3776\002?\233\363\273\0028\301\277\002Y\022\303\337\325\340\017\3760\301\277q\224\340\027\377\353\236[\200\026~\267\203\337M\200\212\337U@\212?\370\365\007\301~\027\305\277\005\340\236\370\367\224\353\363\273p\220\352\327\321`\325\357J\265\327\257\241\376\340\227?\310\367\273\254k\201\276\361\377"
+	.string	"\377\301\356\0017\372\273,\374\356\bX\035\327\371\263L$\330(v\352\277\220\377\350\200\254v\267\007\377b\327\277\241\\\346\277\301\376\035\366\273%~\340\001\202\260\273\374\267\216?\210\342wW\370\203&\370\203'\370]e\320\037\024rE\260\237\374\301\242\337\r\301\017\304qA"
+	.ascii	"\324\020T\361\007\177\376\325\202\037\310f\265v\313\177\016~"
+	.ascii	"\243\331\277\305\376\226\375\367\330\357~\340\337d\377\277\376"
+	.string	"6\347?\330\277\337\177\227\375\256\007\376_\360\267\277\277}\377\027\377b\223\177\177\370O\342\337'\374l\324\177\375\037\221~\267\003\277\273\201\337\275\300\357V\340w)\360\273\022\370]\006\374\356\002~\327\203\337\355\340w7\370]\003\374\256\006\277\233\301\357V\360\2734\277{\374\335\342\357\016\177\327\375]\375\273\371\017\212\371\203u\177p\356\017f\371\203l\1770\355\017R\371\203S\376`\224?h\366\007\233\374A\260?\210\365\007\257\376\340\220?\b\344\017\366\370\203:\376`\325\037\214\372\203N\177\260\351\017\302\370\203E\177\220\305\037\\\361\007S\360\007O\360\007Q\374A\237?\b\375\203<\177P\347\017\232\370\203\315?X\342\017\206\340\017r\340\017\216\370\203*\374A\020\177\320\002\177\360\303\037\244\300\0374\341\017N\340\017:\340\0172\340\017.\340\017\216\360\007;\370\203\t\370\203\b\370\203\006\370\203\004\370\203\001\370\203\027\374A"
+	.string	"\374\301\233?X\363\007\217\177\260\370\007\333\177\347\375\273\372o\272\177\307\375\033\356\337X\376\335\366o+\377V\373\367\331\277\315\376]\366o\262\177\217\375;\354\337]\377\306\3727\221\177\377\370\367\216\177\347\3707\325\277\243\376M\343\337L\377F\372w\321\277O\360o\025\377\366\371w\317\277w\376=\202\177\233\3707\363\337 \3707\007\376\235\201\177\217\370\367\207\177\237\360\357\007\374\273\303\2777\374\233\204\1773\340\337!\374[\303\277=\370\267\002\376\275\301\2771\374\373"
+	.ascii	"\377.\300\2775\370w\006\377\306\340\337\026\374"
+	.string	"\373\302\277\223\377F\376\333\370o\342\277\205\377\016\376\273\3757\360\337\353\337\362\375-\231\277\035\363\267y\177\373\345o\273\374-\227\277\245\373\333-\177\033\367\267p\177\213\345o\257\374m\333\337\256\375m\225\277E\373[)\177\373\344o\311\376v\311\337\206\375\255\327\337\"\371\333\254\277=\362\267D\3766\310\337\372\370[\035\177[\365\267R\177\373\364\2674\376v\306\337\306\370[\244\2775\372\333\242\277\005\372\333\022\374\255\212\277\365\371[\022\374-\317\337\262\360\267\316\277\315\371\333\367o\225\177\373\201\277\355\300\337n\340o3\360\267#\3766\304\337V\340g\231\374\255\207\237\235\376l\327\177\022\177K\201\237\005\372\333\016\177\313\341oM\370\333\r\177+\201\237\315\371W\340\337b\360\267\021\370\201\037\374-\004\376\366\001\177\333\200_\333\3705\325\337\226\360_\355oI\370[\021~\035\364\267 \374m\007\177\313\301\337n\360k\022\374\355"
+	.string	"\3766\203\277\r\300\337Z\360\2678\177{\341ok\3766\371\267\310\277-\376\272\371\267\302\277\r\376-\373\267\277?\253\375l\324\177\234\377\b\370\357\345\277\223\237m\362\263L?K\366\263^?;\344g\205\374l\220\237\r\372\331\237\237M\361\263\320\237\345\371Y\235\237%\361\263#~V\304\317n\370Y\t\374,\004~\366\203\237\315\360\263\033\374,\206\177-\363\263\007\370\331"
+	.ascii	"\374\300.?\220\313\017\244\373\201[~\340\333\017\\\300\017\324"
+	.ascii	"\360\003\001\360\003\333\037\b\3745\365\327]\277N\362k$\277N"
+	.ascii	"\372\265\321\257\205~\255\342\327'~\035\375u\317\257Y\370\365"
+	.ascii	"\b~\275\302\257\225\277N\341\327\025\370\265\t\277\366\340\377"
+	.ascii	"i\371\177p\377o\355\377\210\377\027\345\377\025\371\177D\376"
+	.ascii	"\337\324\377+\372\177\317\377\307\374\177)\374?\233\377\327\376"
+	.ascii	"Y\314\237\345\376,\345?\210?\233\375\271\307\237y\374y\307\237"
+	.ascii	"u\374"
+	.string	"\271\305\237\211\376\274\201?s\340\317$\374\371"
+	.string	"\177n\377U\314\277\216\371\327\005\374k\007\377z\200\377|\377\345\376\277\375\277\362\337\355?\333\1770\263\377O\3767\371\327\235\377V\376c\320\327\327\327\367\017 \354\227"
+	.ascii	"\006~7\273\305!\026/\236\361\224\365C<\355"
+	.string	"\342\212\242\320\213AGxXU\311\272\b\2045U\"#\353\207@\332e\316\210j%\f%\005\221\300xT\351\330\242\246CVlL\327tT\261\324\250\3269!F\201\373\021G\234\203{\241\005\251jG\254\2260\224\024\214\021\324\"\227\221\002\327\203+\213\323\264\r\212\210Gt#\276\2250\224\0244\202{\"\342\355(A\210p`4\302\020\367\210z\305\037\342\031b_1&\212!\346\021\371\210c\210`\210e\210f\210_\210dV*\021\217x\204\327Z\021\271\350`\233\230\372\246\024\277|\274\360\322@\377\304\352\335\030\325\256\316K\017\331b\026\304\013\261\013\233\004N\307Z\326W\001\313\276\nk\233\216Xg\034\363\"\214\234\031\035qK\021%$ Y_\005\352&\312\251\220\265\257\302t_\005\252}\025d\354\253\360\342\355\3124\310W\227\254\337\214\3033[p7\262\276\nB\373\027\030\263\177\201\272\375\013\264\355_"
+	.string	"J\025b\032\025\275\342\354L\307\221*T\330,H\342%h'R1\376x\202\245*k\342\224u\255\357\t\033Z\326\317{\227\377Aa\025\036TnY\377\002>\366/"
+	.ascii	"\265\315\210P\236\314\300\001\324%\353_\200\205\031\361\211\313"
+	.ascii	"\007\304M\217\370\204\230E\211.\316\372 \312\224i\001\305\326"
+	.ascii	"\260TiBVgdKS\326L\370\340\360\372\262>\210\271\255\204(F\\\262"
+	.ascii	"R\211cD0\342\027\324t\330\006\\{\232\022\307\210a\300\265(\226"
+	.ascii	"\213\211\313\323\006\310\0049\331\372 \262\354\203\200\262\017"
+	.ascii	"bl\377D\252\227\235\r\247'Yw\031\177\370\246\274\310\372 \270"
+	.ascii	"\366C0\322#j\021\257V\267\013\202\210R\300\262#j\021\215\020"
+	.ascii	"\221\020\263\210[\304$D\256\225J\324\"\036!j\021\213\254w#\270"
+	.ascii	"1qy\n~\341\350\243\033\352\203x\332\007\221\264\017\302\305>"
+	.ascii	"\210\241\375\024\372\366O$\202\243E\236S\037q\bQ\b\225\312\224"
+	.ascii	"28!\270`k2\r\362\226\005\314\333\320\211A~\"\013\"\021\021\310"
+	.ascii	"P\212\251E\314%\353\037S\325\257\253\254\237\002\336\376JW\264"
+	.ascii	"\256"
+	.string	"\225\320\"^c2hD\036\304\027D\2536\316\022\2570\214\240e\021{\020}\020u\020w\254T\"\017\242\013\243\rh@\246D\036\304\026\261P\220\334\006nLrzz?=0$G\\\034\304\034U.\f\036i@e8\252:\314U\221\221:\261\212H\365\253j\332C\2225q\252\350d\305\035\231\254\237\202\327&\336 B\021m\330I\335\260\22251\212\f\007\037\\\326Oa\272\211O\353\035\273\304\013\b\220\254\2115\262\026\037``\262&\316 :U\203\264|!:\021iL\235\300\3609\211[\031Ae\252\020\233\326%PJ>\272d\264T\354\250\200\311`\312\221\203\311X\326D\342\021\337P\225\254\237\302\323\376J%\306P\002\021\005\005\f\021\306\211\232nEQ\214\254\237GL\372\037t\345\352\314\274\021\223\210H+\312\254\205\021\221\210G\303(\034N[\262~\nH\373)\270\330\267@\337\276\005\314\354["
+	.ascii	"\314\276\005\270\354\225)^mX\032(k"
+	.string	"\222%\256\320p\342\320\025*Sj\326\353\022Q\210\030\264\202\013o.h$\303\f\037\021hx\306\353-i\357I\231\264\341\231\241\231\021\242\216\270\024!\306\303>\342\317J\035\236\031\362\341\350\250j\220\"\266}\013\234\355[ l\337\002[d\364\212PJ\352\250\303\274\341\230\241\230\225:\324\033\206\301[\233\016\365\206`\206\034\311i\351\r\365\206_\362\223\001\256\216\344\264~3\304\320\246[\337\002>\366-@\265o\201\246}\013\260\330\377\260:\274\313Q\216\246\360>\274\003[!)\026Z\302\2444\347\305\256*\312\225[\326C\273a\035p\215\001zLG\212tY\251C\273!\2270\"\225T\021\231\326\257\300\332~\005\310\366?\244\233\313\212\341f\227\365\226\251!hLY\277\002\\{\330\244\272\212\r\261l%C,C*U:h\215U\207m]qC-C\271\341\225\341\333\020n\230e\245\016\261\f\3354\f\261"
+	.ascii	"\251\264^L\246C,\303\264!\333\272\3044$\fV\034\307\231\306\020"
+	.ascii	"1*G\375\n\270\330\257\300\320\036\252\r\327V\352\331\206V\236"
+	.ascii	"\273<y\263\221\365?\234\331)\210\331\330\177(\263\377\341n\377"
+	.ascii	"\303\226\375\017\321\362\320\211\246\246$S~f\346\246Pl\303\263"
+	.ascii	"a\023\226\310\022\266\031KhL\307^L\263\224\200\331h\022Cj2db"
+	.ascii	"T\0356\031\206i1\001\321\3223\033\226\r\241\f\245\f\237\f\243"
+	.ascii	"\f\235\254\324a\223!\331OL\227\224\352Q\377\003u\377\003\327"
+	.ascii	"\376\207\253\375\017C\366?\370\330\377P\265\377\341i\377\003"
+	.ascii	"\323\376\207_C\352\220:\364\032v\021[\214\221\363\022Zo\\QY\222"
+	.ascii	"d\310%#\214OH\326C\256\241\221\341\325\217\232t\201 >\255\341"
+	.ascii	"\326\020\311J\035r\r\217|\2105\314J\033r\r\211\234\031r\r\207"
+	.ascii	"\2349\332*\343\326\301\225\311\2615+\265\332\260\327\262&\331"
+	.ascii	"\177\030\032^\3759mXd_\311\006\300\3017&\353\243Pf\263(h\331"
+	.ascii	"G\341l\377C!\303\251\213\365\006\004\306\313+\216c\034b\220*"
+	.ascii	"\222\216a\220!\220\272\254\264\037\037\002Y\301V\270\360S*\003"
+	.ascii	"3\222\365\320\207\206\017\177\234!c4\226\265q\330c\310\003\230"
+	.ascii	"4-\332A\002L\026\352\016\035\316*!Y\332\265S\323\nb5\304A6\005"
+	.ascii	"\363$\353\272\341\024\020\273j\216a\325J\035\342\370\020\207"
+	.ascii	"[U\223\351Q\255\325\ro\f\251\206R+u8\305e8\225\264\205\355C\033"
+	.ascii	"w2RR\003I\326C\247a\013!\236\320\f\216\035U\027C\244\247\352"
+	.ascii	"\320\335\273\2240\224\024\034\212\033\326\030\316\030B\r\233"
+	.ascii	"\2062\206QC\246\341\323\220\306J\035:\t\301<\270e\2704t\032&"
+	.ascii	"\rc(\251Q\025\356\r\201t\b\253\302/%\f%\005Y\304\361\030:\r\203"
+	.ascii	"\206E+l\f\235\206F\256\326Q\2200zq\354\345\262yy;\253\321?\257"
+	.ascii	"\325\206\2051T*\366\230z\221\312\372(,\331C\030[\303#/Q9\326"
+	.ascii	"\262>\n@\206/P\200\332G!i\037\005\240!\221~s!\326w7d1\034\032"
+	.ascii	"\232Y\321\022c\270\342\303\241uMH\006\214\221\217\254\207B\372"
+	.ascii	"\251\254\305P\326\317[\301\376\007\201Tb\354\314\340\206?}\324"
+	.ascii	"73}Y\377\004(\373+u\030\013\373\334\264\026hD\3023\027\366\025"
+	.ascii	"\317H\211\361\255fk@;\370\302\320\275Q9\312\372'x\221\021\226"
+	.ascii	"\321s\277XM\371\310\372'\370 \243W\204\321\244\316l\314\205z"
+	.ascii	"{l\314\313\0131\377\203\277\262(]\260\304\b\363l\342^T\331-!"
+	.ascii	"c\256\302\b\301\340\235Q\211\263\376\t5\366Oh\261\177\341\227"
+	.ascii	"um\306\n3M\262\276\2073\373\036\302\354_\350E\330E*\213O\330"
+	.ascii	"\345\302\272\302\313\2132vB.-\024 \035+\206Z\234\302D\251\243"
+	.ascii	"+\261\025\223\271jpCK\3029a\\\2226\260\262\254\343\204YnV\f\306"
+	.ascii	"q\032\3334N\b\307r!B\244\272E(\267R\205qB-8D$0\322\354X}\017"
+	.ascii	"^\366=l\331\367p\266\177!\026a\033"
+	.ascii	"\230\231\035S\326\3012a\233\213\204K\260L\330\346n\271\\E!\257"
+	.ascii	"\370\207\004;\243$7K\330\346j\345'\020\272\030%\351\271\t\257"
+	.string	"\b\337\204l+U\330&T\273pMhE\330\246\261\b\323\326\267&\257\370\347\001uF\353\020\262\035=\\-\214W\033v\235\256I\366\036\234\354*Ad\200\350e}\017a\373\213L\350%\024\313j\367r\232\033\346\212\375\250I\273I\020\231j\222\220\t\214\313\324\035s\251\\P\024\307UZm5\354+;\211rj\365~HdB\0317\273\240(\216\323j\264S\226\360\366\364\\\260\374\024f\to\017+\247\t\3112\215V\314\022\336\236^\231\013\311\\5\341P\tCI\025\240\352B&\234!\354\002\372\321B\361r\251\027\004\305\261\024T[f\toO/\327\t\311\3344/B*\3022\241\024\241\231\020\212\020Mx&\034\0236\021>\0212\021N\021F\021:Y\251B2!\321\335$n\327q\270\310\204,\204H%\f%\005\217\300\354\204dn\025 \220\013V\3041\020T\353\266\204\267\247W\004{\202\262%"
+	.string	"z\311ZdEW\221\254\357\241E\330J\025*\021R\205\204J\204_B\260\013\212\342\030\250F\253\264t\227d\255a%\350\212\326B\260\273\\\031\n\235\222\221\254O\201.\373\024P\333\247"
+	.string	"\331\026&1VY\001\305e}\nh\355&a\215\237\327\324C\320QUK\210D\270\265R\205\\BB.\341\223pZ\302P\222\nA/\252\\\302\254\263\375\274\204\304q\325\023kc\251.J/\321\241fc\353w\350\333\317D:*X\337tL`H\023\272\037Y\325\251\020JhuA\020Q\nie<\21666\365\241U\355\201a}\033\353"
+	.string	"\205\253*\234\n\201\034\r\b\026\235p*\334Q\201\001\230\226\344\260\364\204WB,\241\020\241\021!\021a\021\341\021\341\220\225*\234\n\203"
+	.ascii	"\227(\3213C\243\337Ak\277\003\221\375\016=\366;P\355wp\332\357"
+	.ascii	"\020c\277\203\321~\207\237\034e?wY\220\262>\207*\225\260j\245"
+	.ascii	"\nq\bmD\toTu\231\nq\b\247\2047\252:h[\332b\323\373=\341\022F"
+	.ascii	"\t\253\317!\310\376\2057\244\204g\220@\235\221\022\332(&\t\342"
+	.ascii	"\242*\353s\230\261\317!i\237C\321>\007\240\375\013\235.\254\361"
+	.ascii	"\354d\005 \223\"+,\262\026\322\320p\241\323\n\035.\224\262F\300"
+	.ascii	"\232do\202\231}\023\304\354\233\300%\206pIi\377\210{\232B%\206"
+	.ascii	"\022\334X<\007\343B\245{a\353~\250\2241\023\036\271\330\223\021"
+	.ascii	"%H\3267Ak\177\245\n_\b]8)RT\226\265\320E~\032^0,\303\346\266"
+	.ascii	"\224\365\363\204-\376\007\213rI\314\204-\204E\305\027Y\342)a"
+	.ascii	"\221\220((f\216o+\353\233 d\337\004\036\302\025\231\013\222\031"
+	.ascii	"K\262\276\tQ\373\277\020H\030\264R\205Bn\233\220P\210\235\342"
+	.ascii	"\262A J\310u\023\306\353[\3231\026\362\302W]\227P9\203\307\352"
+	.ascii	"/.\237\333\347\236\021\376\254Ta|a\354^q\347r\354M\205\261K\347"
+	.ascii	"\336\335\350\240\272\324\003\257\202\r6\020\272\300\001\365\263"
+	.ascii	"\315\270{+\325\345s\313\340\204\220\347\222\271 \210(\006\242"
+	.ascii	"J@\221\245\036xz|.\236\033\346\202 \"\024\246p\251\3563\036S"
+	.ascii	"v\260\372&(\355\337%\343\352\025\231\021\331\"\306\035\34325"
+	.ascii	"\275M\311\372&\fm1\027\262\302J\326\337\300\267\277R\337\305"
+	.ascii	"\005s/=\330d \311\372\033\364\3667|\331\337\320\345\256\335\341"
+	.ascii	"\332\255oc\035\334\274T\3438\366\342VW\252{\347vq\357\334\267"
+	.ascii	"\265\273j1\b\221-$\254\376\006,[\037\021\022k\313\332\345\342"
+	.ascii	"\326\021\275@\241\025\311\372\033\252\354o8\333\377]9w\313Ju"
+	.ascii	"\347\334\2709\027\213\253\345\202 \242\017Qe\3349\367\ro\004"
+	.ascii	"1K=\360\364\332*)]<X\375\r:\366\357jq\341h\0209\331\363\212\253"
+	.ascii	"4i\371Au\263\270m\377\343\272"
+	.string	"\026\261\227\254\277\341\306\376\006\032\373\033\222\3667\260\330\237\200\231\275\346Z\021\233J\202\365e\255\313\376\004\344\366'pe\243ic\f(1\242\254?\001\262\375\020\230\270eV=\244\270SV\252{\346:9s\237\270Q.(\212\343\251\254b\332\022U\222\036\221L\317\214\fV\233\271P\214F?X\364\310\372\023pa6\201\237}\t\330\221\271M\262\222\022\036odj\373\022X\342.\201\023S\246(\353K\340\310V\"\001 \373\022\250\332\227\300\f\352W\260\025. \327\222ld}\t$\355`\323\232d\037\201=\227\353\371\312\227(\275\254\037\201\274\375\bX\331\253\224\213\245\311\316\234Pq\257V\252{\3045\242\275\342x\314=\342\022q\213\340\310\300H\026+%\343\335\f\253%\255\037\201'n\021\340Z\316/rl!\312\372\021`\262\177w\210+$\306\r\273\272\254\247zG\035A\031\311\372\021\300\332_\373l"
+	.string	"\327\326\267\261\016\\M\252\032\334\035\256\324\306[\337\232t\021&\325\250\262)\324\223Y\025G\032\017\267\207\353\303\375\341\006q\201\270:\334\034\256\325Juw\270U;\334\033+XW5\216\275\334\035.\025p\315\335\341N\225\260\207\204'\246\204*\030C5\372\0210\332\207@\231}\bT\367!P\267\017\001+\373\0200\333\207"
+	.string	"u\037\002>\366!0c\037\002D\373wk\2702\310\330\205Q\222\365s\323\221\236sRue\264Vn\213\365m\254\303\024+U\243\0274\334&7\206;\303ur\231\334%Wi\245\2722\\\030H#\264;\232T]\2702\334\244%\244-P\260\342\330\253\005\263\007\327F\243\377"
+	.ascii	",\373\017X\333\177@\331\376\003\222\354?\240\307\376\003\240"
+	.ascii	"\366\037\240\264\335\242\341\027/b\202\262\376\003V\354\337%"
+	.ascii	"rY\270,\334\241`\337\352\205uDJ\260\fm\275+\242\221\265\326\\"
+	.ascii	"L\325^|\261\005\333v\024M\301\302|T\203eg5\252\356O0L\020/\270"
+	.ascii	"\027\314"
+	.string	"\013\352\005\277\004\301\004\311\270q\260\352\256\b\212\t\236\t\362\271A\256P\320\214\013\024\364\022\034\023\274\013v\t\226Y\251\301\276`\335\203\\\202vY\253JF+B\252r19\252\006\2270\331a\005\270\266\243E\260/(\027\244\373yA9AL\257*\345\251\032\\\322\204\211\215\352\027\226-|ZT\326\273\242\246ip\t\231\216i\034{\201\321\365\230F\201\252\006\227\210\005\307~^\323-V\304#X\026\354\013\232\005\241\374\274\246\036\230DU\203e\301\276\340\224\035NtY\366\252_\301\276\240[\360\215E\337W\260/\bg\024\203\324\205\223\305\211\027\025\b\232\350\265\332\260k\032\334\016\322\375A-\301\270um\225\"v\035\215\261\222up\213\206\007\347\312x%\245e]\302\332n\223V\033\366xk\222\275\003\240\354;`\311\276\003\266v\360\312\224\025\327Q\326w\300t\337\001<\202mk-\222\226#\244\254\357"
+	.string	"\252}\007\304\330w"
+	.string	"\321~\003\316\3547\240\272\337"
+	.string	",\373\r8\333o"
+	.string	"u\277\001B\366\033\240c\277\001M\373\r\bB\371\203N\202Ov\234p\316\310\007\221\254\317"
+	.string	"\276\375kZm\330\020\326$\273&\325\3553\300\312>\003\306\202c\031m\2058\016\013\342$\256I\326g"
+	.ascii	"\222\2752\240\307>\003\236\366\n%\370E\245zEu\005\247\202I\202"
+	.ascii	"F4\235\032\326\231\216u\255m\252!\307\215`\225\024$\253=\275"
+	.ascii	"\031|"
+	.string	"Uj\214\245\2475$\253==%\243\251\035S\022\222\325\036V\360H0+($x\025\374\021\324\n\016\t\366\b\006\tN\203XA\"\301\255`\221 W\320G\020I\020\310J\r\032\t\362\320\200c\256\0324\022\204\nJ\305H@\032\222\325\236\236XS\330\222\022\222\325\236\036Q\215\374TE\262\332\303r2"
+	.string	"^\b;\260\372d\234A\262\332\323\013\032\tZ1\200\013\311jOo\025\013\032\t\322\030!\f\222\325\336\206;:b\344"
+	.ascii	"\372%x\331/\301\312~\tc\373%\b\331/a\306~\tEA*\342\333\f:\262"
+	.ascii	"\254\277\2000\301),A\033\353\213"
+	.string	"08\256\262\376\002\312\202Q\013\310\332_\300\216\375\005\324\330_\300\320>\tt\373$\254\355\223\260d\237\204\351>\tS\373$,\355\217\300\267?B\034\214$b\227#q9\220\202G+5\230\024|1\244UM\n\262\310\232\266}CV\300\261\372#\214\355?\350\"h\344Nc\263\267`\213`\321J\r\032\005\211\206\234\246A\243 \213\365n\310\021\227\"\037\260bG\206\325\037\001\306\376\bF\373#\b\355?\270\"(\224\343\343\312\230\254\203AXH\250\314e}\021\270\354\217`\006\310t\357\307t\367\005\201\202?+5\030o\276`\274\317\260nGrZz;a@nl}\021\260\366E\260\261/\002\323\276\b,\366\277\313l2Gg]gz\337d~\020FX\301V\210c.\264\030\317J\326\0324|\353\255]f\250U\306\210i\343\202\342%\353-f\005+\343\221\244*\353\035F\303w\0361\315\252\232\265"
+	.ascii	"\326$\373o0\033O\270e\t\033\023\032\337x\037>iS\222\343\313\256"
+	.ascii	"b\315@\033\313zW\377\355e\337e'+,Q\002\244%\353U\307j\303\332"
+	.ascii	"\254I\026hC\303w\2273T\216v\330\235MW1B\375\331\\6\035\030\223"
+	.ascii	"QY\326r;\256m\317\355\272\225\272\351\366\226u\323m\270\035\307"
+	.ascii	"\345\302KR.K\353\272\302\352\207@f?\2040\373\337Z\276\343\376"
+	.ascii	"5\313\316R|\273\272\222\313z\025\323\360\255\305}R\335B\312\372"
+	.ascii	"!\314\355\225h\265a\277R7\226\354\204\002W5\270\274]q\302\203"
+	.ascii	"\242f\355\306\252%U\267d\375\020\320\254\354\265\235\266\253"
+	.ascii	"l"
+	.string	"\266\255\266Rw\333F\333m;\312>\373Q\223\266YP\227*\0252\323+O\364\252\273mO\261\253\232\335Mw\333\206\302v\264U\006Kn\314\230ZQ?\004\034\373!(\355\207\260bo)k\230\330\0163Y\037\004/\373 \300\355\203\020e\037\204\256}\020t\354\177;\331eh0\272|\311z\227=&\nq@\031\333M6\231\221#\274\272\254\231\bW\340\b\313\222\365A8\332b{\311J\335c;l+\231\333c\255\325\n\006\325&9\n\022\306xcH\034\023\253\257!o_\203\225\375o\260\235\344\254\305\220]\326\017\001\253\254j\344\352\211\332\021'U${kkm\256M\335^\273k\177\255\324\235dge!DE\322\252I\366\220\235d\0239\352Q\006+\216\275\2109\326\342)4\372\032|\354kp\332\377\340\314\376\007w\373\037\260\355\177 \266\377A\221\375\017\236\366?\b\332\377\236\006}\254!\315"
+	.ascii	"#F\357JV\365\207\324\332\355\021\335\221\211\315\246sE_"
+	.string	"\356\252eZ/e\350\366\254p\341[\305\306\314]YA\266]l\030[\307\216\261\2436\325\356\261_l\034\233\307\366\261\255v\322\016\262\217\266\322\006\262\247\366\217\275\264sl\246]\265\233\266\215\375\264wl\032{\306\226\261\241\366\215\355\264\221v\215\225\272\245v\213\377\206\266\321\363\031\265:!=\027B_\b[j\023\355\242\256\351\320\376yR\345[\333@Nv\220\236+#2\303F\246\245\353[\305\362\270T\303\266\264\300\333,V\260\261-\325\206\261\353\262\202m\251VN\306\213\276$Xq\354\265\301\217\306\016\030n(\350_\274\332\260\367@\313\336E-\221\276#\274\254\357\201\333\276\007e\373\036h\355{\020d\337\203\243\375\fy\373\031\340\3663\210\355g\320\332\317\020d?\003\325~\006\250\375\fK\373\031\214\366;0\263\337\001\334~\007M\366;\300\332\357\300\306~\0071\366;`\261\257\2001\373\n\300\262\257"
+	.ascii	"\264}\005\200\355+`\307\276\002Z\354s\200\267\317\301\332>\007"
+	.ascii	"H\3669\250\332\347\240\305\376\006{\373\033\330\355o\320\266"
+	.ascii	"\3776\356\251\335\242B5\246\245\315\342F\206\207$\353\257jl="
+	.ascii	"\340Z,\355\333Jm\263\264W\276\266\345\247\013\202\3428\212\006"
+	.ascii	";\345\305\325\222^\233\245u[\301\244\274\270Z\302\002V\251\242"
+	.ascii	"bm\375\r\212\354o\300c\177\003\031\373\t8\263\377\326J\273fD"
+	.ascii	"\215\303\262Nk\253\264j+\265]k\251\240!\341:k\275\212\3018\236"
+	.ascii	"\352\232\266k\355\224\326\013\206\b{/\200\340\351\355\2540m\324"
+	.ascii	"\255\237\200\261\375\004p\355' \310~\002\252\366\337Ji\237\224"
+	.ascii	"\301r"
+	.string	"\013\222u\373\244\335j\231\374\250I\025\200\033\253b5\321b\342\244-k\241\264MZ\2636\312Jm\237\264d\253\330\223\366\312\311\221\262\366I\233EF\244\342{KR\324O\200\322\330\272\243\t\031Z\326O\200\320\376\337*i\303\332%+\265\025k\277\250Z\\`\255\027\327T\254\345j\275\212B^1\214\005\020\241J\2025<\343\302\203\332\372\030\316\354c\250\356c\260\333-\2226\311J=Z\333\025\033\327\035U~vd}\fZv\2128\216\343\365hl{4\366\030\336\3661\260\355c\230\262\217al\037\303\326>\206\253}\fA\366\337\032\301@F.\b+\353\277-\362\343\030W\031\303\321c\007U\373\243\315\301\243jW\345c\252C\307\224\256\375\321Z\355\250N[\"\255\220\026H\033\244\035\322\372X\251\355\217\266G\373\243\345\261\256\261\\/\246\222`\t\345\250\324l\034\365\021pf\037\001b\366\021p\267\217"
+	.string	"-\373\b\270\262\217"
+	.string	"\262}\004 \331G@\217\375\267T-\024\236\232\322O\326\317W^\314U\233\224\254\300`\313YIm1\364\334\032\215\326\251\235j\233\332\032\255\215V\252\275\321F\2653\332\247\225\332B\2652\230\322\220V0\267\251\013=Gg\244\347\352Z\250\366\350J\265\205j\227\326!.\312\\a\261Snpbp\364\017@f\377"
+	.string	"v\373\007`\333?\200\331\376\001\272\366\017"
+	.string	"d\377"
+	.string	"R\373\0078\3327@\337\276\001\300\354\033@n\337"
+	.string	"i\373o[\264A{`\230$\311\372!\354\331\021\211)\243\247\2275\206\f\231\025\354\256L\033\267?-\020{\246%j\207Z\026\355\212V\210\355k\213Vj\033\304\362\255vx{a_\370\252g\246m\020k\246K\265\rb\301\260y\353[S\034\303H\200\030\027^\204@B~\370p\364\r d\337"
+	.string	"7\366\r\200\264o"
+	.string	"\241\375\002\204\331/\200\333~\001\240\354\027 k\377l\230\263y\317NV \022\232*\2225\213\244\341l\2309\030Q\230\262~\001v\354\027`j\277"
+	.string	"H\373\004 s\307%\030$\245e&\353\207`ET\345\302\312\211\265\250n)\252c\273\260v\254\227\225\312ra\351\270\260q_\204\214Y\323\0036\251\021\037\271\372\004\350\262O"
+	.ascii	"+\373\004\360\332'\200\215}\r\314\354\237\325\302\302=\231\346"
+	.ascii	"=\311:\313\360\256m\272\224\3655\230\333\254\025\266\212\331"
+	.ascii	"\223'QV\260&S)z\216lz\306d:e\f\013\373\306\246\261k\354\025\326"
+	.ascii	"\215"
+	.string	"mc\331X\265\225\312Za\251dAY\301\312\3202\332\372\326\364"
+	.string	"\254\256\252\025\326L\317\215\340\344\342*\211^\034{\255RZp:j\3645\350\332\327\300\307\276\0069\3665\210\332\327`\306\276\006I\373\032\024\355\017\340\314\376"
+	.string	"\304\354\017\300n\377\254\023\026\013N\354\t-k\036E8\220\246V/~H5\200<\375\250\372\200;C\265\212M=\365\350\013Rf\025\223\2621c\025\273\001U\325\220\343h\212D\003\213\313\206\216*\324\017\252\275U,\212\307\017\311)\b\225%\302&a\263X&\354\030\313\305j\261H\330/\326\213U\302.a\215\260M\330.\226\214-\302^\261el\030+\306n\261GX\260\225\312b\261\323\263B\330!,\026\013dG\025\216\246\252\016\027?$,\266i]\273`E\034KE\271x.\200\004\307pTy!\202\316^\253\r\213aM\262\037@\330\376"
+	.string	"\250\366\007\020c\177"
+	.string	"?\373\031\200\331\317`\313~\006U\3663X\262\237\201\220\375\f\232\3663\b\332\027@\335\276"
+	.string	"\326\366\005P\266/"
+	.string	"\255}\001X\355\013\200i_"
+	.string	"@\373\001\250\333\017"
+	.string	"\225\375"
+	.string	"|\355\007`\310~"
+	.string	"\234\366\003p\264\217\001\337>\006r\373ge\260LB%[=\342\330%6\006\013\203Ub\223V*\313\304\036\235E\312Y_\213\362S\001\316\246pT\364Z8M]\030\261L\354\213(U8*z\033\264dW[n\f5pM\262\307\340l\037\003\262}\f\220\354c\320c\037\003\031\373\030\374\354\237%b\177\272p\371\371\311\372!\234\3311\335\353a\306\007\373\003\324#\003\244\314\217)+\304\006\261@\354\nv\210\215Y\026+\225\375\001\366}\215\222\303\236\331\037 _\f\364S\002\232\024\034\025\2758\366j\303\274\030E9\352_P\335\277"
+	.string	"\313\376\005Q\366/\020\333\277\200\310\376\005V\373\0278\355_\320b\377\3001@1f@oeY\347\335\311\270B\312\372\026\360\355g\"\273\2619$U\222Ls\026\225\256:\2550\300/@< \030\240\027`\027`u\245\002\357\200\\\256\3432\334\327)\031\355\3475m\305\202\270\356\200t[\323\340\221\022\240\240\243\276\005d\366-\260\333\267\300m\337\002)\373\026\224\355\037\270E\256*C\313\227\254\343\200hJ\234\206\262\276\005]\373+\027\232]\b\3007`\032p\r\214\256\312zW7\325"
+	.string	"|\003RY\357\250\270T\335\200W\200Z\200X\200Y\200p+\025\370\006\264r \333\332w\355\025\307BW\246d\264.m\3007`[F\373"
+	.string	"\t\334\226\214\r\332$0\302`)\352[\220\264\207\026\004a"
+	.string	"\252\005\205\274\214A90PcY\037"
+	.string	"e\366\001P\267\017"
+	.string	"\271}"
+	.string	"d\331\007\200\225}"
+	.string	"P\331?\360LJ\007g?rd\r\224\362\377\220\200Qn\226\3318\247\262\034Y\347\030\b\305\b\327\324I\326\317DH\364\274\272L\311\200_uS\272.-=gf*\006T\002l\002\034\003.\001\232\001\303\200e\300'@&@'+\025H\006\004\243\332m\351\2712\3258\366\002\222\001\177"
+	.string	"\261\3267\035\332\215\017\216\213L\365\n\220\f\230\225g\254o:P\020\263W\215\343\030H\006L\362\003\f\221\252^\034{\255FnU\306p\364\001\240c\037"
+	.string	"M\373"
+	.string	"h\261_\001\337~\005_\366+\310\262_\201\224\375\n\300\366+8\262_\001\217\375\n\246\216T\360C\322\326&$\353W\220\264\377\003\215"
+	.string	"\213\254T\340\0250\310\201C\212@\3078\346\341\005x\265\216\001\002Y\337th-:\226\b\0303\030\254\376\252f7\005\n\001\022\001NW*p\310\273"
+	.string	"\207\270?\210X\025\331 \232\004\207\231\255\217\223\006\004r\327*M\241J\311\3728a\373\007\372H\352\261\304\243i\007\360\206WQW\217\254\037B\r TS\bGOS\027Q}H@%\270\032U\340\r\340\013(\272\031@'\262 \032\300\033\300\030@\031\353\333X\f\244$\002\021*\252$z9\200U@+ \016\340\024\220\n\250c\245\002o"
+	.ascii	"\243\016\264\001\224\272&\276\r\305hq\324\253\324j\303\326\254"
+	.ascii	"I\3668T-\200OTE\244\240\262>\016\323>\216\213&`H]Kj\306H\311"
+	.ascii	"U\367\234\210AR\375\216\216\334\261\310+N]\371\342\373\022&Y"
+	.ascii	"5d\b\255\254K\227\032\2745\003)3l\230#9-/\257\301\253\371\342"
+	.ascii	"%7\225\373Ru\257\262\320\235\271\013\006\265J\262\274\220\335"
+	.ascii	"m>b\225\242)K\362v\322\213\236:5\331H"
+	.string	"\226\031jA\245\225uM\\M\\\r\335i\200z\270zKwI^3\367\032\272!\2730Y\262\256\331R#\327\002\227\375\327hAF\235\205q\203\002\207\f\023\003\025$\013M\036\r2Y7\260 w\024Ey1\363F\303\267\366\265p+r%\271\2028&\205E\317\rif\002\236\013\034mE$T_?3\330\220cGc\320`\324X9\3121\241\241\203*k5\265\243\234\225\351\214)^}Y\277\205\265]\003\245\006JM\025\241\326[\223\037T^S\345e\250\362\262\256A+\352\020\306 S\204+\353\232)G\023#34\344l\223\275\200\333QsV#\345l\315)KM\224*N\262\300\310\372-4\331o!\253\254\254\346\t\033\345\302KR\221\251\350\311\024'\257yRvf\343H\013?\304\304j\310\366l\f\231\262g\020\311*\"\253abG\245o/\353\232\261!\220\214'X\262~\013E\373-"
+	.ascii	"Q\2515J\326\257\030\t\204\261!\031E#%\2503a\257QBtb\252rC+\353"
+	.ascii	"\0320\242\323\017\257'\276\254k\276\326\260\0301\244\202\220"
+	.ascii	"\331\332\252\351\302\221\372\371\202!\214\215 I@\275>\270\034"
+	.ascii	"5I^\323e\006\252(\353\032$\353\0320\314\306Z\231\254k\270`!\254"
+	.ascii	",\025Nj\262j\262\330\253\026H\307\020\230\254\257\202H\215\220"
+	.ascii	"\032!5G\212\323'/gZ\246\027W\236\324\\\275\346\b\220\305V\220"
+	.ascii	"\237\254k\214 Y\230\241\322\267$\353\232\"&X\203\243\313\272"
+	.ascii	"\206\310\321\314\244nd]3DE\217\232 5Aj~$q\321\242+\353\253\210"
+	.ascii	"\362\341\243\346\307\372\025#]\020\246}RMk\361ccY\232\341\246"
+	.ascii	"\227\365U\270\260\262\252\341\201#\365\263S\033\222\221\202+"
+	.ascii	"F^5;^\303\243\310\002HQ\\\3265:\210N\303&`\340\304<\305^MUMU"
+	.ascii	"\r\016%(\036K+\324\325t\nGX\330\027\226\244\273\251)\241\030"
+	.ascii	"\256%d\370\266\324\250Q#\205#\365\203\307\200(\0339\206\350\261"
+	.ascii	"yxY>l\274F\252f\006\013\307\206e#j\306\223*8\262\256\201*^9\212"
+	.ascii	"\217\262~\n\256\232\247\024?j\226j\226jh\024a\032\022\006\353"
+	.ascii	"G\266\267\"\257\246\35154\250hcOjf\350\037fxP\325\314\250\221"
+	.ascii	"Q\344\212\006\337\226 S\254\026$\353\032\246\241\033\232\214"
+	.ascii	"./\262~\n(%%\032%\037\2541\213%TkU\2406\276\035Y?EQR\322\324"
+	.ascii	"\r\032\323\262\225\365Q|\2519\2529J\002\231\233vIq\345\310\372"
+	.ascii	"(\342j\\\324\270H\002\341:\301\221\031X\262>\n\265\232\241\232"
+	.ascii	"\241\232\026:\330\034d\210\013&5-j\212\316\314\264\311\310\272"
+	.ascii	"\206HhEJ\221\276\254\217\202\254\206\005\n\255\032\241\032!d"
+	.ascii	"\2166\n\311jO\017\212\214F\224\254\217B\207\236^\r\320\224#9"
+	.ascii	"-,\r\224\244\345F\315\317k\2002\032"
+	.ascii	"\216\0361\262N\362\325\304[\312\222R\333\231d\337\317\207\322"
+	.ascii	"\035\213\254\217b\306\231\275_\013!Q\252\366\314\020\311\242"
+	.ascii	"`\300\221I\226\321E\246L\225e}\024Dd\206a\230\20013\226\365O"
+	.ascii	"\214I\332%\355\222bp\244~\304\270P\216\270\024\301K\262\202$"
+	.ascii	"\357I1^\232\350\351h\313:\371%\031\246*\314\013\013\274$\030"
+	.ascii	"`]\220\035D\262\376\t\271$^UH\345\025\364V\275\013\006\331\222"
+	.ascii	"e\253K\322K_\336\025Z\326?Qe'\273\f\371X5$6\262d\375\023K\222"
+	.ascii	"u\311\272\344\025\233PO)\213W\326?q\225\324\222\324\222\234\333"
+	.ascii	"!e\252\211\270\303+\fIr\313\223sOT'?\344hL\213\030%\345\222q"
+	.ascii	"[\311Q\230\"\3118\327HR"
+	.string	"\327\024\255\254\177b\312\315-\231\005J\030f\006\030\266\034\305&\267%y\345\311,X\242\340\200p%\337\214U\362l@\311\372'd\354\347\025\237\376\007/\364\365`\221\365O\254X[K\262\271K2\352\234~ZEr6\254<\311F\314S\362\226\204/-\215F\311z\364\n\202\3631\345B\245\350J\326\367\201KRIRa\303\b\273\314\344\244\262\276\017\365\354,9\005\b\253%\243\316\311\005\323\224\"S\212H^\334\256\254e}\237\036\311(\311(H\263(\027^\222\330!VB\200\262\276\017\r'N\222f4\204Z\303\260\264=\274\344\223'\315B`\024\203\311\347\205\222'\231(I6i\247\340\354H\232\211\222+\243\027\023=a\310\311a\203\215\354\311&gc\373\224@\231J\216\265[\342\254|e\235\024\003\326\210\301\245\310\022\035lnxU\366a(ZO&\321J\202\031\307\3268n\212\203\204\342(\033"
+	.string	"\270\002uuF\217\350\304)K*\331\365$\330\223_ \214\200\354#\036\241M\211\311:IMz=\357g\346\210\031#\271\254\223H\204I\320\206\340\262Nr\2559\216\336\262l\375\301\341\027\0372xd}\270\311>\034\226\304Jb!\315\360\200qYQq\326\207\215\024)\222\274b\303@\345X\003.\271\321\300a\344\311+4\032W5\340\033\311ir\232\034\"\005*\307\332\017\253\250n*)\344\311!govW\314\214<\311\"\313\372p\213\037?\222@\230"
+	.ascii	"\255 \221\032\002\322z\261+\222\350\310\002\303\203G\262\007"
+	.ascii	"\216\324\317\027\003,E%Y\323k\201\247\326c\275#\202d\314\222"
+	.ascii	"\254/\005K\346H\346H\352P\0326\3213\362\223\264zR\007\0233_\210"
+	.ascii	"\350'\"V\2278\032E\244\244\222U8R?\273\264!\031a\254\314%\251"
+	.ascii	"\236\254Z\311l@\351\221ur\212\350\344\204\316\211V\326\311\033"
+	.ascii	"\277\023\346\235\221\322\223\346H>%\237\222QXG[e\3642\215'Bu"
+	.ascii	"POF\205i\371\361#MJ:%\235\246\222\204\305\341\215\311\372Q31"
+	.ascii	"b$\233.\234\342\002\210\024\275\036D\304L\233\2223\360\230^\350"
+	.ascii	"\310ZF\020\312t*/\353G\345v\222)\271\024\207-)\373\311\372\321"
+	.ascii	"(\373\321\255\244Q\322(\tc\211\t\210\026\326o\305\234\225d\322"
+	.ascii	"\22308\320R\n\313\372yI\244\377\301\f\030IK\"%\217\260\344EY"
+	.ascii	"\312:\371\342\311\n\024!Y?:\335I\027C2m\003jFZ\326\217\336H\026"
+	.ascii	"%\213\220fMHxb\260\254\360\252N\262~\024)\311\"\311\342\t\tO"
+	.ascii	"\214\273\203/\nK\326'\201\231\344O\362'\271b\317\002n]>\222+"
+	.ascii	"\222BFD\212\214\262N\006\021\263P\305\305\301%\201\230\364\365"
+	.ascii	"!\315\234\220\360\304\024\251\226\320\202d}\022\024!C\206\206"
+	.ascii	"\317\006{&\312\352*\203\335\311\261\361\321\354\275\220\002\224"
+	.ascii	"\2265\215\0316\353\n\025\251\254O\202\0344eH\2404f\fr\207\023"
+	.ascii	"+&\312\352J\257(L\230\240\254\337\343\344\313\027\232\274,v\b"
+	.ascii	"\022\236\230\037\227\037uGy4a\354\224\004e\205\241\001\023\203"
+	.ascii	"l\351l\352r\201y\021eM\203\347Vy!S\226\247uw\207\244\323#\266"
+	.ascii	"\350\322\366\"\353\367T\325\325\321tY\277b\244\344\032RW\222"
+	.ascii	"iP\033\215\335i\272\260\210\0323\2225\r\227\025\354\314\021\r"
+	.ascii	"\241\374\324B\351,*\353\367,\315\315A\201\352[\303\322ulJb\262"
+	.ascii	">\224MN\016I\267\246\207\250\21445\321\242\005I\367\225\205\013"
+	.ascii	"\313\354\353\f\312\220+Wh\262\250\0202fm\205q\207'\003\313i\262"
+	.ascii	"\274Q\255\255\321\264\255_1\222\206,Y\270\202`\202\230Pa;M\233"
+	.ascii	"\326b\246\205Y\3264VV0.wV\244@]\240\241\321\244\341\204\201\032"
+	.ascii	"\343v\202)M\212\252\234&\315K\366\322dKV\3264T\204_X\"-\276%"
+	.ascii	"\317\270(Qh\316\230LM5\345$\264\246\033RNsV\314\221\271\340!"
+	.ascii	"\311{B13\373\200\027\034\0252\2427,Y\377I\245qB\343\344(\007"
+	.ascii	"\201\257\253$w\013\224\035T\326\177\346\240iB\323\344(WA\021"
+	.ascii	"(\274)ER\350\242d\375\347\217\230\030\r\023\034\251\2371,\024"
+	.ascii	"\250\034k5\222\230\311\032;\r\0233\241\232\232\331\017\2369\232"
+	.ascii	"0\2320\032%4\332\244\027WK\354\021(*i4J\350``!Y\373\372\032q"
+	.ascii	"\266%\003+\314\031\035\226\254\317\243\004\t\022\032\257\252"
+	.ascii	"\013/In\237\235\334T\327i\274\206sJN\240\222\270pIm{4Ih\246<"
+	.ascii	"\362\220\246Y\237\307\310\326\326Q.\211\013/I\302&KH|d}\236\247"
+	.ascii	"\254,\341\222\013 R\320\314`\t\311\372<.h\216\320\034\2411\262"
+	.ascii	"\036\275\202\266\2141\277\350\340\013\022\204\306\310\372\025"
+	.ascii	"#\251\2001fM\t_\032P\221\323\030\371\221\247\307\203\206\210"
+	.ascii	"\233\223\322\034\221!\3009\246# S\032!\037\272 \251\222\365w"
+	.ascii	"\252{\372\353\361[\373\221\006&K\217\0364?p\244~p<\214\222h\200"
+	.ascii	"pL}\234\346G\033\017\"ad;v\034\345pv\214\004\214Fu8\205\350\n"
+	.ascii	"*\353\357$\261\262B\232\271\360\222\2645\266\305\"\353\357\020"
+	.ascii	"\241\301A\203\243\225\361b*\t\226\220\356\315\352.\353\357@\321"
+	.ascii	"H\321H\321P\341H\375\344\261g^L%\321\033s&\311\n\315\324i\250"
+	.ascii	"\320\270\246L\342\262\246\271\261\263\"*\212\306\251\316\tK)"
+	.ascii	"\212\222\254\317\002\030\232'\232\247\243\334\236\f.ZXB\032m"
+	.ascii	"Q\266\262>\013v4M4M4NW2\352\234\334&\266's44N\343\264\366aQ\302"
+	.ascii	"\206Ddj\005\2304\0312\220tEdp\321\302\2722\023\224\227\365Y\310"
+	.ascii	"\242Q\242Q\242Y\2322\035)\202E\004IZ\025\232\030\247Y\202\353"
+	.ascii	"\222\233\253JJ:\312\341H\375\210i\237\\xIJZqW\224\365YP\242)"
+	.ascii	"\242)\2429r\271\216\266\312\350.__\362Z\234\346\350\007a\004"
+	.ascii	"\232\027zZ\245\307\202\346\005\215\013\2662\24387\034g\324\356"
+	.ascii	"\262\2461\332h\026t!r\222\365\363\366\331\377 r\305O\220\254"
+	.ascii	"?\0021c\21643\206\206\305On\030\377|\305H\020\200\272:\223\026"
+	.ascii	"\0235a\020R\215\250X\262\376i\200N\303\3424C \214\360.XWr@Y\323"
+	.ascii	"\254x\261\251MJ5\353\323\004\321\b\375A\227\b\216\260#Y\177\004"
+	.ascii	"U\366;\330_2`\300\310\232\346\347]\212tq\361%k\232\370hM[\364"
+	.ascii	"\254\220}nTpAY#\367\220|+\365V\220g\356e,Ja1\002(\373\353\255"
+	.ascii	"\260)Xo\205E\2229\262\314\037\fJ\211\3021\225\365G0"
+	.ascii	"\266\177\244\336\037l\311\344jL\263\376\b\300\366G\300\205\207"
+	.ascii	"\207\314\303\221\372\371\322A\031& Zz\303\263!P\3420G\346!\273"
+	.ascii	"\270L\324\035nY#\301\264^C\033Xx`\215`\312\205\013\262\212#\365"
+	.ascii	"\223\327&1\001\321\322cW\300=9\271;\262Ze\205U\023\244\027,_"
+	.ascii	"C\330\220^\220]\304\004\021\353\313\032iw\271\026TOY\177\004"
+	.ascii	"9\366G`c\313\026$\035\216\324\217\030!\336Q\2200z;\236\310\360"
+	.ascii	"\230[\251H\272-)^3F\260\024\027\2074;\301r\031Rgu\006\016\256"
+	.ascii	"\005(\036KXA-7\253\033Y\337\371\345\312\025$\226\365+F2A\261"
+	.ascii	"\013\311\030\245\267#\261 \331\2214\315\372y\033\313\377\340"
+	.ascii	"PolI\331\225\2666\024T\tQ\212\023\263be\t\212\307\322\306\n\""
+	.ascii	"\366\224\365\235XhhH\265+\306'3\310\214\322\216T\323\242\321"
+	.ascii	"F#kd\025\242\323jc\017\210R\326H*\357\242\213~Z\030\365\210\022"
+	.ascii	"\005y\2666A\361X\302Z\343\204\276$!\245\034y\206\004K\314R\326"
+	.ascii	"\317\373}q\345ue}g\324\223'H3'(\036Kz\3025\264*ufB\210P\271\370"
+	.ascii	"RVv\224\323\203\312\261\206\025\307M\030T4\345I\311\372:bddG"
+	.ascii	"\271\276i\320\332\336\221\255%K\220c\353W\214\304&AM\355ay\321"
+	.ascii	"2\372\"v\344\230\261,\212\327\032\213\377\301\020\3440\022%\353"
+	.ascii	"\353\fQ\251\3100\034\251\237\035\331\220\f\275\025o*\253\b\354"
+	.ascii	"\310\260\266\207\033\016\245\254\221_D\247\025D\366\244\312h"
+	.ascii	"i!\273\322\236\314,a\025\211\323KrdWU\227\026^Y#\221\020m\024"
+	.ascii	"c\\]\215e\215\334Br\365\225\351\013\343j\201$\214Y\016\026#F"
+	.ascii	"\220XT\236\314,a\271Cfg\356\216\034\2115\004\352B\303\2225\362"
+	.ascii	"\212h\243\n\023,\245\256 A\220Dp\244~\362\334)Of\226\224\320"
+	.ascii	"\230\244\f9\222\310\326\312cC\2225R\b\321F\361,\216L,k\344t\205"
+	.ascii	"4\270)\244\036=\220?V\023b\244!\031MTrIbH\037G\376 \366\030\323"
+	.ascii	"\213\222\023\244C\007r\207\333t-\313Q\244\314\016\340Z\335\221"
+	.ascii	"\267 ]p\340@\346\300\221\372\371\222\200$OxT\206DR\232`A\346"
+	.ascii	"\350A\035\272\221&%\205\244j2\255j\022&\0069u$\025\020\b\031"
+	.ascii	"'oY#o\020\235\202WtK\234\272\2104\345\310\372&\232 k k \243\312"
+	.ascii	"v\\co\016\tudT\360\214^\2262Y#\237V<\361\260\003\256\271!\355"
+	.ascii	"\225I2c\006\222\306\372\025#\211P7$C/\330\246\245\f\t\262\351"
+	.ascii	"H\032a\355W\230\271\237+\0300\220L\353W\214d\003\345\t\217\212"
+	.ascii	"1\214\016!u\310\245#\231\220\314\260 \313\032\031\003\270\246"
+	.ascii	"\213li1\311\032\251\264\206\021_\b\001\0223\021#\215\220FH\244"
+	.ascii	"\037\305%\226\354\310\033\362\350H$$\013\033OP:\262~\036\362"
+	.ascii	"E\231.\246-\244\213x\307U\241\334\262\376[f\377\005\323\327\207"
+	.ascii	",\302\221\372\311+F=y9\323\241kK\r$\321\221E\371\t\252\316\t"
+	.ascii	"]\326H $\013\035%\357\205\026$\013\344P\321\016\274j\326+\304"
+	.ascii	"\244\275R6R\b\031T\314\023\343b#\353\277J6\362\347hf\230ti\311"
+	.ascii	"\032\031\037\255\265\342Fe\343\312\214\231#_\2216#\233U\220\244"
+	.ascii	"\275\037\371\326\210\323\252,Ox\214\031s$\203\263c\256!lB\030"
+	.ascii	"{5\232\034\365~$\003\214A\367\302\312\006\036\3361o=z\005\331"
+	.ascii	"\331U\343\270\t\003\360\352j\210\3331\314\217yy\257\352e%\353"
+	.ascii	"#\030\242\323*\246\364\303\016\215)\312V[\326\177c\034\275x9"
+	.ascii	"Vq\244~utC2\326\034I\200\374\270\373\261\212&\224\272\301B\357"
+	.ascii	"\215\355\354\216rN\214BoZU\364\346\346\216uy5\246qS\023\206\r"
+	.ascii	"H\331\003\243\373\261n\257\214\026\240\243Y\026\337\226!\271"
+	.ascii	"\270\270\243\\\216\3438\236\266jy/\252qS\023\006\027\314\213"
+	.ascii	"K\322J=\312\335\0130K\021 dQ\334\356v\204\313 \216\343\241X\005"
+	.ascii	"]\036Q5nz\302\020$2bB\346x\345G\270c\026\034A\242He9b9\342\342"
+	.ascii	"Cc\"\354\342\362av|#\202Y-\231bJr\\;\256\035\331\300\230\231"
+	.ascii	"\306MO\0306S\231+\032V~d[\327\302\312b0Y?\017\303\377\240\261"
+	.ascii	"\305\222\246\220*U\216iV\b`{\302\340\306\240zA\006\003\222\""
+	.ascii	"`\274d\375\346\215#\332\021\r\214\003\031\315\240c\223c\223\343"
+	.ascii	"Y\225\003\260\021gT}Yr\224\362\343\031\025\033\344tdF\326\307"
+	.ascii	"(D\033\301\254\031Mrd}\204r4\013\"\304\311Q\326\307\262\243\331"
+	.ascii	"\377`\020\n\237\033\217\254\377\243\331\361I\226\2250O]#\240"
+	.ascii	"\342\322vtB<\242%&b\336\355s\260\036\23109\332\232\264\305X\024"
+	.ascii	"U\343\244\230\2033\261,Yr\024\333Q\224\321\204AX\344\007\320"
+	.ascii	"]\336\217bD\033_\224V\250e}\346\223#\330J=\202\035\303\2568h"
+	.ascii	"\0222l\322!\271\313\372\314\257\255#\222\255#\325\353G\352\272"
+	.ascii	"\342\013\217,Y\037\273\2106\260\302\316\230\262>&!:\315\300Q"
+	.ascii	"}\302u.b\325\032'\305qS\374#\246\001W\314\351>s\206\221\343\021"
+	.ascii	"#\307,6\216W/)\244\244#\326\217Y\302>\250!oWW\304\2525\2038\236"
+	.ascii	"\306Aqb\032H)\321\267_\342\215\b\021\0346\206ORF\240\b\021\362"
+	.ascii	"\343[\277b$\227\213\215\003\366G\256L\221\254_\302\310\376\217"
+	.ascii	"@\200\034\203\320M\343\370\211\203\340\233\321\215\247\037\337"
+	.ascii	"\nI[I\314\216-\353\227\300\261\377\243\217\243\217\037\037\224"
+	.ascii	"#9-`\227#8&Y\277D\013\036<\212_(H\001\305\030\300\031\246#E\364"
+	.ascii	"\360\266\252\374\344\351\320\221\2070H\001MeP}\002\"F\210\226"
+	.ascii	"\222 \264\0349\232\270uNz\304aUUj\3031\361\230.ZSSG\251\025)"
+	.ascii	"\024W=\231\3061\033\007D2&f\272\262\376r\272\377\243\215\243"
+	.ascii	"\215\243T\002\222\236x\244\351\3051\033\007A(\034AMY\013\233"
+	.ascii	"\210\234$\311\372\313\242#\324\021\212X\345\303\202\245\025\274"
+	.ascii	"\354\377H\343H\343X#(\024O\375\020&\035\005\t3\244q\004J\335"
+	.ascii	"\321\251\265R\242\344\225\365W\300\262\277\002\225\375\037\231"
+	.ascii	"\276R\217L\307\031A\241\030(\210\273t\264UFo\f\025\313\227\254"
+	.ascii	"\2172>\304\032f\311p\233*\223\365W\020\333_\201H\214\030[C9-"
+	.ascii	"bTU0`h\255pO\302\340` !eM\371\226\274p\313\372+\374\354\377\370"
+	.ascii	"\342\370b\bd=z\t\305aM\323\236\370\252\262\276\022o\377G\243"
+	.ascii	"\243\321\n\266\036\275\202\342\202L\3438\215\003\341\220+,\270"
+	.ascii	"\271\242\242\365.\304\032\023\265X\341\242\032\3230\302$\353"
+	.ascii	"+\247\354\377\310\342\310b]\303 \005\004T\200(D\250\222P\271"
+	.ascii	"\353q#\353+\251\373?\006\035\203\216+p\244b%\005\344Q\2378(\006"
+	.ascii	"a)\312\361+#\334Z#R;\ne'or=\204d}%\326\376\215}\306\276\343O"
+	.ascii	"\376\212\177\214f;\313\231\"1Y\037c\327\254I\023\214\254\257"
+	.ascii	"\234\332W\322\330\277\321\314W\252\321\214\221O\203P\f\224%\034"
+	.ascii	"\222\277\260l1em\3343j+R\224\365\225D\373\" C\206\214\260\013"
+	.ascii	"P(\006\322\301\272\021\257\244\320\230\312\372\"\300\0333\006"
+	.ascii	"("
+	.string	"E\177\305?\254\230\027WKXS2\366jd}\021\330\355\337\b\006\2141\017\005)\016\300\020\251b\345\350r\326\"kc\0302pK\274\262\276\b\344\366E\220e\377\306\273\257T\343\235\361\013\316W\374\363"
+	.ascii	"=\243$'&f\204\2626V]\241"
+	.string	"\247)1Y_\004l\373\"\350b\354\262\256\001\205b\251\035\302\264\031`\330t\026\271\264\031Y_\004PF.F.\324\020\206\210\200\210\216\256\210\004\002\\H[\240\2309\332[\313\372!\bc\334b\334r\303\025\202\264\375\033\343\376 \227\240\335J5\306\025\267\202B1\220\017\0327\244\256$zapH6\262~\b\304\340\340\212YA\241\030\b\213}B\262\332\253`h\206\216!X\260\024\217\204Xc\2423*$\325\251P\227j\326\017A\322\376\215W\256\024\215\344\257\030\006\253u\304\245\b\026\030\325T\213\254\017\002<66c\233\024*\255\242\214#Qb\306\266\240\220\033\266T\347\224\365A`\246\246f\\\373\t\305Q@Z\256'\016t\f+qX~|-\21363LY\037\004X\306*\306*J\034\300\006\202\250\375\033\247P\215S\214hd-\225\243 a\250zODF\264M\266\302\035\213\251\\\326\377"
+	.string	"\031(P\214R0H\3051\f\300u\324\243\314\220<\256\264\254\215Q\306\344\305Y\377\003s\373\037\220\262\177c\331W\252\261\314\370\344'\024\003\001a\331\200qGjY\2626:\311*B\245\225\365?\020\266\377\001!\3737\216}\245\032\307\214d(H\3051\f\260\364\002\b^\220\332\027\231\221\211\220\021\fQ\223\271\254\377\001\251\375\017\264X\262d\005\373`\215Y\220\255\360Q\215\3434\016\210dV\262\226\262\276\007\372\276\276\214a(H\30510\240QQ\025\311\375p\222\265\021,\311\322P\222\254\357\201.\373\036\220\3337&Y\215^_\251F/\340Z0\216\247v\024\247\036\200\262\277\002\327\330\337\270e\3342\"\t\n\3059\262X\267\027SI\246 y\211\312\332\310\245\177dY3\270d}\017t\355{`\307\376\215Y\306\254\025\354'\024G\351h\313"
+	.string	"\315\300f\b\311\372\036\2102b\304x\004\203T\034#\001k.\312\\i\035\271\201\224\265\361\n\315N\211[\326\367\200\213\375\016\344\355\337(\304(\304H\344\013\2261k\331\307\225\251\222\254\215\304&m`gY\277\003t\373\035H\003\002\304\030\004\203T\034\243\203\".\256\222\004\267\234A\222\225\2651\b\013\267J\261\3259\231\312\372\035\330\332\277\221\307J5\3620\372"
+	.string	"\n\305@?\3342.\200H\331?HZ\224em\354\221\201\0241C\226\365;"
+	.ascii	"d\277\003O\3737\346\370J5\3460\352\370`\215\343'qQ\3258n\342"
+	.ascii	"@W\317\264b\243\025Q\357F\324\224\254\337\201\242}\016|\331\277"
+	.ascii	"q\352+\3258e\254\302 \025\307(@\025)8*dXLeem\244\372\032%\207"
+	.ascii	"\375pB\245\232\3659\360\266\317\001\262\375\033\243V\2521\312"
+	.ascii	"(\265\036\275b\252&\323\035O\302\252\030\245\376\374e\264\001"
+	.ascii	"\024\243u\204\255\231e\335r\300\307\376\2155V\252\261\206\361"
+	.ascii	"\t\005\251XI\204\256\030[2\232\320\314\340\214O\007\312e\266"
+	.ascii	"8%\266\254\317\201\245\375\033iP\2154\200R\202B1P\024\253\367"
+	.ascii	"\342j\311\n\214\031\214\254\317\201\025\37372}\245\032\231\214"
+	.ascii	"32\020\022D\244zEM\342\224\265QF\376\311\2202\003$\353o o\177"
+	.ascii	"\003o\3737\302\370J5\3020\306@A*V\372\300H\f\252$\304\261\025"
+	.ascii	"bI\2626*\031\361iY\313\372\033\230\262\277\001\260\375\033_|"
+	.ascii	"\245\032_\030\221\362W\374#4\313\"F\n\024\323\f\026Y\033"
+	.string	"\217\346\320\326\252d\375\r\030\331\337\300\324\376\215FF#\235\366#\222\002\242\022A\210R\026\256vL\220\027\246\254\277\001\242\375\033\205V\252Q\310X\204A*\216\201!k\310U\022\2134W\304\210\350\306\242\337\270\3028\244\257\326\037\2277)\253\254\215,4\334HT\314\372\201\002\2225\006k\222\245y\363\301e\377E\276\225Z\3443\002\241 \025/a@\362e\245d\304\262\302V\315\3727\376\334\b\364\027\317\024\373t\216<c\313\017\265\254\215\261\206\033\177\204M\254\360\005\311:\271&\331\232x\265a\263\006\226\354\277hf\245\026\315\374\306h\020\212\253\220\260M.\274$m1T\324\267\254\257\201\"\373/\216\241\026\307\024\311`\220\212\225>\020\022oa\233\013\372\201$\353\242\236\020\260M\310\327\227\254\257\001\035\373\032\230\001\006L1\017G\n\b\350\001jIpT\334\256\261\250\276b\230\330K\314\307V\\\326\327"
+	.string	"\321~\006\302\354\277xwW\374\222\277\342\030F0(#\241\0253L\254d]\254f1c\222<e\375\f\270\355g"
+	.ascii	"l\377\305.\324b\227\365.\177\305I'dp\321\302\212\343&\016V6*"
+	.ascii	"RNY?\0038\270pY\301p"
+	.string	"\244~\360\006\220$\243\316I/\216\32380\212\271\202\352\221\365I\220\241\243\003#\001\n\211\270\375\027\267P\213[V\260_\034G\351\020*yqp\022kX\260\024\343v\034\307?^1R\262\211IN\017K\313\213qn\216\032?\\E\270\340\233\0301cE\270b\226_\332\221\225\036E \355\324d\212Z\326'\361\244\255\255x\345\3078\216\001\340\344\366\342\225{\321[\342&%\353\347\221\210\253\273\222\365I\004\261b\245\215\013\211%55b\325\032\307q\334\004\201+/\246g\252T!V\305-\221\300\024\016\rM\002z#\234\354\257YkQ\n\265(\245x\346&\3051\0161$\204Y\342\240\b\266J\255=\341\"\302UVV\204\002\267d\001xI\030\376\242\331\213P\326\266\234\234=is\330\235\251\025\237\024\235\270ZWoN\306;\270\030[Y\177\004\216\375\342X\221\311\213dd\304\252\365\2038(N\214"
+	.ascii	"P\232\2260|\204\213\375\257\317?\033\003%\305q\254\004\364\212"
+	.ascii	"\223\202\206\354\277~\005\256+\206\237\270\376V\r\376\353\337"
+	.ascii	"\337\2019\016\304\261\217;\2738\216\3270\233\210\031P\215\f\342"
+	.ascii	"\377\377\2058\216a\020\t\305?+Q\330\024\f\242\260\251$$\021\333"
+	.ascii	"\024\214X\b\006\226\320\224\324J$4\225\224$\024\377 \343\260"
+	.ascii	"\251$\242x\n\3061\016\213g\020\205\001\375\254DB1\2148\236\212"
+	.ascii	"\2171\021\020\2148\314+\tI\0246\225D\0246\005\003I\024\006\004"
+	.ascii	"\203(\226\212\217D^UI\261\327\324\017\322(\f\bF\034&\005\003"
+	.ascii	"\031\207M\301(\"\262%D\001wS\034N\272\204\251\261\255_\210\204"
+	.ascii	"\342\243\027O@I\3077\"/\251x.\216\327\261\2418)~\213c\r\342\370"
+	.ascii	"I*i\016h\306\n%\350\355(\250\fH\252\202\027ATR\261\320\333\317"
+	.ascii	"\032\277\021\025\221\212\343\"A:\361\2138\216c\021~\274\336\342"
+	.ascii	"\035\353\333O\325S\354b(\216\001\020{\305\361\2138\376Y\343\267"
+	.ascii	"8\216\177\3428n\223\236\274\342\330\351H4}\361\"\216\233p^\304"
+	.ascii	"O?Q\206\3428\217\325A\201A\024F%\245!\312\222\260i\314\302\353"
+	.ascii	"g%r!\025O\343\271\251\244\035\366C\215]\304q\274\202\331S\030"
+	.ascii	"1\360\262\306Q\3455d:V\315\272\f\034\322\230\254\367\021!Vf\262"
+	.ascii	"\316dNlV^B(QL\226\262.R5\353\203\310\026V\326\027Q\305kXGv%/"
+	.ascii	"k\257\232\246#GY{\271,\236\324dd]\344\n\326\b"
+	.ascii	"c\227$\353\213\030\333E\255>\253$\270\254/\202k\027\261t\031"
+	.ascii	"\032\"|\354\342\325\217\356\214\220X\326\027\201\264\213E\244"
+	.ascii	"L\271\362%\353c@\314\376\213AVj1Hq\bMR\034[\345 A"
+	.string	"FR\022\007\305!\177qZ\024B$\313RM\302\374\210\313\372wo\253\rK\334[\223\3541 \267\177\374(\362\370O(\2162\233\306q\023\206_\016/OPY\037\003g\373/\372(\362\330_\252\272\214)R\235\252\310c\375\212\221\326&@SMzq\334\204as!\001\262\266c\245\026y\270<n\330\220\313\272hU\324\261sd\225I\321\321$CJ\226&Y?\257\230\303\352\307\026\0269^\304\241\244gdD\017\345!!HV\305\252\337\031\240\033f\352\262>\006\362\030,HJRR\305\250\237P\f\024\204Uj\353j\230\341\330\177\321F1\212\207\2234j\326E\250\337T\213\213\225\254\217\001\031N\305\032(\360x\254e}\f\0309\375\312\330\310k\262\223A-\312(\316\300 \0054$\203\263\240-\031\037\320\013\242\313\2728\243,\357gL.\353c`\305\217o\005\0175b\234\305\370J-\306(\302"
+	.string	"\n\305@=\330\247\027}I\200?\362\220~\262~\210\274\375\027\225\2120\236\232L-\311\272\230\324J\311\305\315\325\275(\036m828\254\240\2750\372J-\032\025\213p\244b%\006Hi\342`Xwt$G\326\017\361\265\377b\213bQ\027\2132#Y\027\211\220\224\241E)\022\322\f\274<N\022=<\314`\363\351\364\320#\345)2\237>\036rz\204\300gN\317O\007\316y\276;\354\333\202S\252U\364@\231Z\372\241G\312\203\304\340\002\025&XpA"
+	.string	"48%d\200\005\346\253\303\241\202w\247\304\022\366\001!"
+	.string	"\370\351\314\240\371>s\234\322\247\317\020G\212\203\024\302\360\323\371\033\361t.\243A\351\373\364PT\261\323\363\212H\0015\001)\204\225\322\f\274<NxK\241Q\246\223\207\205\235\317\017&|JH\367u20\243L\017\2300\354d2\225$h`F\2314\025\26499\310\021\306\234aN\313|\225C\370=\241\370\\\276 \214I\025\314e\316\233\002\374\346\\"
+	.string	"\001\2779\302\r\360\233#|\225E#\374\346 _e\363\003\254<\276\312\346\007\270\271|E\034OhBAx`\201\271\354I\302\312\227\307\t\013_\036'\t\026\244K\022\360\233s\224\266\025\300o\316"
+	.string	"rlr\220\322\036hTE\316\316\222\251\003/y<\200\245O(\023h\002~:\243;\354\033\365\351\321\317w'\nKY\351\007\nH?$\241$nx8\354l\270\271N\006)\264\007\352\214.5\320|\341%\217\023\226R"
+	.string	"~s\220\315\017)\240&\020\337\235\022\313\035\347\362\304\0068\n\r!\375\360\302K\021\360{B\r\374*O\200\337\034\033\330\355"
+	.string	"\277'0\341h\261\371\302\321W\372\374\200\334YzH\276\312\013\357\216\323C\005\315\267\005\347\316\322\351\254y\225\304(4\032\245"
+	.string	",]\246\220\274N\006\346S\205t\351\001\324y\200\227\271\354\031\361\276Q\017R\037\250O\216\023VJM\300K\023K\f\3407GI#U\301\006~GH\241Fe"
+	.ascii	"\244;\024x[P\261\263|nhJ\2418G\034\025=P\016MgOQE\017\224ys\235"
+	.ascii	"\024\321\036)\210\024Q\244\n\023R@Mh>\235&j`\347\363Cq\303{\302"
+	.ascii	"\t\347<\235\"`\347\323yLA\001\036h\324\003\034}O\340\300O\037"
+	.ascii	"\020\360\233C\344\320\\Bwj\214'\244pzh>7\274\360\262\351\334"
+	.ascii	"Y\236\300\221z(\302\317\017Mg\017Q\372\3560UpxG0\231\313\013"
+	.ascii	"/\354\214\242\020\202PAD\b\nP\240\271|\243\256\263I\001\025K"
+	.ascii	"\020<\320\347\333!\304\013/w|\230;\313\013H\266\t\277\322\247"
+	.ascii	"OREt\031\205\366\360\274$H\004\340e.wz^\021\3157\352\364!\301"
+	.ascii	"+\002~\245\310\020\315\247\323\303u2\344<\235QXz\263\263\343"
+	.ascii	"\363|B\237-\254|[pJY\024\320\250\016\f"
+	.string	"}\266&\226\357\216\206_)\317\313\303\276,,A\ba\345\313\343$\301\204\243A\370\035\301\204\243l\217\024\204S*\025\001\277R\227gy\201W:l\202\200_)\222'\n5\3614\341\002\374\216\220~\220\016_\250\211\247S\351\001\323\3043\3079\002\226:\245\321\267\347\211\002\332\204}tF\b\257\223\301\004(\211\013%\bq\340\245\b\370\035@\217\224\207\006\204\020\336\026\234#l\230Q\016\360\233SC\202\006\020B\310\200\t\237\022\322a\024\016a\302\247\204\264\275N\006\036h\264\347}\225\315\345\033\245\201\225\317\234\036`\363\351\364\220\223\323\343ANO\022\226*UDa\2513\347\025\221\3233\324a\302\313\0209=E\0224\bK\310@s\371\2120\341SB\272\301\204O\t\2510\347\351|:\227<\257\b\351\013\2530\301\204O\t)\r\354|~\350\221\362\264\310\232\367\204\036)\017M\363CNt\203\016\354\334"
+	.string	"\006I\"\023\272\263\263\201F\212\304\271\360A\0068\272\354\311\020"
+	.string	"i\363\003\007i\363\203Q\003\315\027\216B{z|\244"
+	.string	"\250\271N\006\017r|J\274M\240\363\0048\n\325\221\036_\036'\211\027^v\b^'\203\007\315\035\247O\211\227gy\001\027"
+	.string	"\2572\t}\3224\235'\244\306\247\016S\t5\361t\236\220*G\2048\241\250\303\201\307\347\031L\276<P\024\240$\224#B\234@#}y\226\027h:{6\254\224F\337\035\037\n\330\274M\037\330\t\303\313\r\027\227\360\262\0033\312\002\341\234%\317\017f2\227\277\353dh.\241)\234X\342\370\250P\223lF\227\034:\214\260\340X3"
+	.string	"\f4\350Y\202\350\360\001\ns\350\260\341\346\t\345\341\251\240"
+	.string	"\260\rL\003\333\214\bq\202\013\263\033z\244<6\260\r\274\204\245.|\003\037/\200\221\360\005\370h3\002\203\013\315\227'Z\003\3034\034*\270@\3052\032\335 -@\b$|\204\2230"
+	.string	"\256\223\341\215B\231\0360M4w\240(\344,yZe\324\003\246\t\341\363\303\333\204\202p\237\036`(\264\204\212\235\236W\204\212\350\222\207\307g\204\216t\271cb\t/;\004\240\2043\312\224\226\360\031a\003Cu\244=\313\347\b"
+	.string	",\341\235\267C\216\323\304\323Fzl:w\226\032\220~\320a\302K\023z\244<7/\354\214n"
+	.string	"~B=4\245*0=\364Hyp\316tF\337\347\233\263/\002\t\035\220PB\212\366%4\340\203\006|\300\276\204\006h\320\320"
+	.ascii	"\0224\354\223\240\341\007\3030\f\3038\027\240yz\b\221\002j\302"
+	.ascii	"\333\202\263\202$\374*\233\037X\220.I\230`\272@#\374*\2459\313"
+	.ascii	"\035\017\357N\211\245\324\331\241\206\347\205\245*F\320\300\260"
+	.ascii	"\364\365!\301+\"\3726\227\320\035\030\n-q\001V\0165p|wJ,I\234"
+	.ascii	"`\341(\264\307}\225*\300Qh\017Q\nm_x)\242\351\263,\261\337\026"
+	.ascii	"\234#\336\026\234#6\274\243\303\346\362Ea\307\271$\021}M\230"
+	.ascii	"\3601!\005<<\341|\231\257\b\034w\t/;\244\210\026\243p\210\017"
+	.ascii	",0\227%vv\226\034\340\024K\036 R\232\201\235%\f\205[\370:Qg3"
+	.ascii	"(U\302/\013\314e\210\036)\217\320\204O\211\2374g\271c\002\030"
+	.ascii	"e\341\333\030_e\217\224G\b+\243P\270\307\031eJ\337"
+	.ascii	"\016=R\036X\n\r\321#\345IJ\225\303\247\211,Ur\350\221\362\f\233"
+	.ascii	"<\314\337\333\202s\304\323\311\323\276-8G\244X\362\264Req\303"
+	.ascii	"\322\027^\246\360\346,\243o\017\317\262\370D\261\214v\320\331"
+	.ascii	"\300\263\245\312\342n\276O\037\227\203\006P@w\216\327\311\340"
+	.ascii	"\201\t\243\364\215\372\300\313\327\003|\235\f\003\200G\020\201"
+	.ascii	"\260R\004\022\340\247\263\345\361\221\376\336\035\247\333^'\303"
+	.ascii	"\313\343\204\341eS)\214._\025Z\007~By\200*\226\315\2374\352\003"
+	.ascii	"\325\001J_\330\347\351\344i\245\315'\224\371J[\251sg\307\311"
+	.ascii	"\303J\225Ei\217\260\005\035\245\217\322&\372\302\314e\024\n-"
+	.ascii	"\361F\217\260\322}{T\220\340\200\210\341\021~\3720\207/\274\024"
+	.ascii	"\241#}\243&^\021)\242\304(\034\342\351a\t/;\240X\212\210\n\243"
+	.ascii	"p\b\232\247\007\251\017\274\204G0\243\306(\034\")U\276<N\370"
+	.ascii	"\351#\"E\364\370\364\360\362,\243\036B0\243\307%\274\354 \\\302"
+	.ascii	"\313\016A \207\016\033r\226<l\007\246\023~\2379K\236\244T\311"
+	.ascii	"d"
+	.string	".\201\360u2\300:\360\222\207g\225*{L$S8\243\360\022D\0216*\333\353d\200\231>QX\n\202T\231\342\205}x\220,0\241;J%\253l\243\357\023\005T\251l\245\321W\352\363T*w\363\351dA\251d\245\312v\347U*\203\260\022\226:w\216=*\340\016\232ot\251#\355\300\003)\354,\341\201\3173\247\203\024>O\347N\007\"\220\240$\241\204\024\036\274M\237\035\346\323\351AT\352\343\001\003\340\024\357sg\371\2146\227oT\007\356Q*/(YX\352\334Q*\331%\274l*\225\354\333\202S\252T\262,0\241;\232\371F\225.\354|~xz\200\235O'\033\205C0\237>\036\232\313W\004\223\271\241F\252<\361v`2\227\373\351\241\271|\243,,U:{F\230x;\274=*H(?\204\030!|:7\254T\341\203~:C<\245L\326\331#\375I\225\034@\370 \344"
+	.ascii	"\302\207 \023\004\347\357:\031\244>%\244J\020\307\350\013K\227"
+	.ascii	"<l\373\236X\356\214\360\351\341\331>\312\023oS\352SbK\225R\237"
+	.ascii	"\022\302W\371\366\250 !\365)\021\224\372\224\370\235\240A\311"
+	.ascii	"d.Y\024K\021\034:l`\341\353d\360\351\341QB\243*r\230\314e\002"
+	.ascii	"^\245\210\017F\370\200\004\237\036\236\244\364\215\272Re\315"
+	.ascii	"\253\364\351\341\021\262\360\216\217\364\025\361\204:}zxh^e\221"
+	.ascii	"\311\\n\025\315\345+b\t/\233\301\267\t\345\020\035F\337\235\035"
+	.ascii	"\247\t6\347\351\334\351\341Y\216`2\227I\016\03560\231K\366e>"
+	.ascii	"U\200\245\3137\005xC\363\205\227\315\236\fH\235\025\360\300N"
+	.ascii	"\023R@K\f\245\260\263\204\206\245\321\367\2043\332\324\201\237"
+	.ascii	"P\020\306\346\022~A\034\245,0\241;&\360\370<\203\035>\360\274"
+	.ascii	"P`\207\017\3217\352\0033\227&|\236K\236\342\313\263\274\200p"
+	.ascii	"\0041\n\035\301\022\372t\202xB\235R\347\211WDMt\371v\300\247"
+	.ascii	"\t\215\366\024\257\223\301\203\234\236\013\305%O\207W\352\303"
+	.ascii	"\346,I\020s\226$`\346\273\363\216\350q\3520\211\315\027f\276"
+	.ascii	"\360\333\241\031]2i\226<M\342\222\247\351\276\312\267\t\005\321"
+	.ascii	"\214.\231\315\246\024\352AS\n\225B\205Rh\217\222\347\205\235"
+	.ascii	"{\311\f\356,\203oS\nu\245\260\363\351\003\224F_\036'\314J\215"
+	.ascii	"\356\316\016TD\212%\b\235eP\n/a\351\363%2\245o\261'JT2\245/\262"
+	.ascii	"\207\347\205\225o\024\3124\302:\313-\205\032\241\316\3462\252"
+	.ascii	"T\261\334\211\276'\2404\255\n\330\271\263\364!\201\222\205\247"
+	.ascii	"s\207\206\247D\263\330\003m\352(Q@u\244J)\274\244aF]8\n\r\201"
+	.ascii	"\344\211.w\226\312\227\371\\\302Rg\263x\235\f)\226O'\017\r\212"
+	.ascii	"\033\370\371J\337h\017\f}\302\313\022'*`\236\330!\276J\232WY"
+	.ascii	"\023}\341\027\004\215\n\330\311\\\366,K\030\341\245\t\032x\245"
+	.ascii	">D)\034}w6px\245>5o\3162\304\023\352\204{x|\244O(\363\002\251"
+	.ascii	"S\372F_X\252B\007^\2268Q\334\331y\231;;>&\340e\211\023\311\235"
+	.ascii	"\235\227\203\212\350\013\303K\023^f\024j\302&\204\211\236\024"
+	.ascii	"\340e\t'1\347\351|F\227\033\270\331Y2\235\2603\312!\n\365pag"
+	.ascii	"\351\003G\235\032\270\340:\031\340\347\033\215\3720\201,|\235"
+	.ascii	"\f\321\327\271\323\343\204w|xj8t\030\361\346,"
+	.string	"\341\035\350\t\034xY\342Dpgy\342\204\263)}\243\360\262\304\t\"t\307\331C|y\226O\025\313\235\036\251\263)\204\257\223\301\003\250\023\276@\303\202t\t\342\tu\302\314\247\217\211\341\253\204\243\320\020N\267G\312#\355\311A\302\313\350\r\234\"\332\363\302R\355!E\264\202\353d\300\340\210D\001\335QZPT\261\334i\322\\`\201\351\204\245\312\327\304R\272\343\\\232\300\271N\206\024Q\017rz\222Q\267g\311\303\214\002\233o\212\350\316\322\031}\245\310\024\357N\217O\007\023;K\035\367m:\243Og\006\312\034\237\235\036\234h\363\351,\241\204\227R%\217O\024f\341\355\221Z0|w\226L\027\216\276'\236Nf\264\351\344\001>\235<;\305\222g\033\245;\313\023O\250\363\0033z\201g\311\341D\217\t\232\327\271\304y:\231K\036e\212\250P\231\302g\251L\261\3441Jm\204o\217\n\030YA"
+	.string	".\274'\242o\363\202(\024f.M(s\236N\035\030\n\345\221*\231Q\234&\324\031}{\224<\313\250\t%3*U:\245\322h\005M\247\022v>}\210 \354\244\210J\215>\313\022J\251O\ti\361:\031<"
+	.string	""
+	.string	"\361mBAD\337\024N\236\240\024\305RER\331\343\3341q\341:\031\232\321%\364\270\263\003\215\n\207\322\367\215\346\274\035P,U\270R\345\022^vxB\235\260\317\016t\204\264'\007\t\363p\200w\226@\251\222\tMA\332\223C\204\227;\277\366\t\335\371\351\354\354\374\232!\264\315\367\355\031!|\245Q\037(\207\346\323\007\032\315\031\366@\233:\032^\216\340\361y\262\327\311\220\002Z\202\005\346r\247\304Q\331\323\262L\346R\331\214B\231/\217fA\272\344Q6\337\235\022\322\346\316\3534Q\363F}\340\236%S\231\363t6\241\314\347\253|O8\341\236\245"
+	.string	"\214\306\343\273\323\303\263\224\"\245N\350\263\270\363\236P\232`\ns\226\260\222\t}\2079KX\031\335a\246PB\243\313\022\304\353d\310q\232\270\300\363\302R\025\322\242\021\3716\241<\256\224\351\204\245Nx\tK\225,H\227\260Q\n\rA\302\013/\2436,0\241;\314\350{\002\252\364\351a\022_\036'\211\227\271\214\236\260\341\251B\364E\001\355\271\211\276N\023N\370\3716?4\243Kh\tc\013: ^\251\016\373\302Kx\004\223\346\205\227\"\336\026\234<N\270G\205\350\273\343\323|u\230R\233\246\263G(\225\276Lh\264G\331t\366 \237P'\374|O\274\321\036"
+	.string	"d\360.\337\246\322\204\t\350\313\302\022V\252X\242X>}\242\004\200\257\223\341\304\333\314\3511vH\3616\237N`+\3651\301\331#es\226$\236R&+\3651\201\t\202\223\335\300\004\301\351\346,I8\341\024o\033\274N\006hTE\016"
+	.ascii	"\206$\340\347\313\363\236\200\202\310"
+	.ascii	"\200\007\372|\233J\346S\205\324D\317\216\222\370J}\224PX\330"
+	.ascii	"\202\216\261\005\235\243\006\r ([\320\251\001A\t\233\200JqP,"
+	.ascii	"U(\241F\024\320\035\023\321\367\204\n,0_\035&\021\371\366\250"
+	.ascii	"\200i\220Og\217T\211b\251\202\306\247\003\007hTE\316\205d\322"
+	.ascii	"\250\0037\235(.\220@\370T\321<\3360\2434\033\305R\305\020\371"
+	.ascii	"\346<\227:L%,]\232P6w\240:JxgY\203b\251\242\246C\bG\024\320\235"
+	.ascii	"\242N\216S\307\330\fag\031\205}\336gP\331\f\241\371\\\226h.\337"
+	.ascii	"f\022\005tG\330\fa\330\f\241\371J\215p\nh\211\237T\031}S8A\300"
+	.ascii	"oNt\t\023a\237\236\247S\b\204\257\223Aj\001\0174\352\301\004"
+	.ascii	"\215T\311\263\214.C@OD_\351\020V\202\020\202\364eF}\240#\232"
+	.ascii	"\2574\372\236x\243\306\247\223\347\227b\311\363{w\232M'\017\373"
+	.ascii	"\302\313\250\276N\006\f\244\313\036\036(\323\370t\3560\337f\316"
+	.ascii	"\222\207\230\263\344\031\276=*`\251O\taQ*}\243\315\346R\311\004"
+	.ascii	"\301\251\314Y\362\030_\246\363\304\333,>\245L\245\263G\252\314"
+	.ascii	"Y\362\bs\226$\340\036\237\350\020\032}=\220\263\344i\341\353"
+	.ascii	"dX*\r\340\243D\302\317\227\347\231\343\334\331\300\003\205\245"
+	.ascii	">Le\316\222'y\235\f\322\236\034\017\240NiO\216\360U\206\220\366"
+	.ascii	"\344\020\243o\323y\002\032\355\331\257R\272,!\335\257\322\b\205"
+	.ascii	"}\226\356\253\334 \355\311!6}\226&@a\237\345\206\276;\316\235"
+	.ascii	"eN\n\350N\t\233\227\371\204*\225/\017"
+	.string	"TG\t\277R\245\264'\347B3\004\345+\365QJ{r\216D\370:\031<\310\351\271\211\276<N\022\315\367\346\304\333\341\205\227\"\206\307'\324)\215\276'\236\037xP\204@\362\240\b\321|\231O\025\322g\006^\251O\021\226F}Lx\245>D\025Q\370\345yw^\022HX\331Js\226$\240Nv\007\312\204\302\320h\b8\n\355\271\311y.K\300N\023`\250\216\264\303+\3651\236x\233\277\327gg\251\001\370\225\2320\241\302\273\323\374\260\263\204\2359\316\346\315\323\311#L\261\344\0216\237K\036\036(\363\351\344q\341\247\017\224\303\273\003\rQ\204\257\223\301\003f\001^x)\"YB\323\t\"\252\003\267%@{RP \252\003o\251\364\205\227\"\230\321\026\332\223\202\002\314(+}\341e\024\330\341C\210\250\016\211\247\212f\220\205\345\033-\241\\\366\300\311\236\033\367mBA,{\340\026\276N\006\251"
+	.string	"\336\235%s\204\021\251\303\204\235(F\244\360Y\332D_\370\371r8\302P\022\315\227\205\247sgK\225\315'\224\303\t'\314\334\3606\241<\025\274\312\266\371\341mBy\330\024o\363\371\201C\n\237\245\021\276N\006\351\333\204\362\364\274\360\210\346\363m\245\3127\347\271\024\261\363>\237K\035f\261\347\205G\300\321%,\r\2769\317e\024\370*\205Lg\0164\205\267\t\345\t\302\327\311\220\002ZBYA\363\003\374|\237K\236\350\333#\224*S@K"
+	.string	"\233\037R@K"
+	.ascii	"_\236\345\005R@K\264Re\210\246\263g\330\202\216"
+	.string	"\022\305RE\261\005\035\345\261\005\035\035&\f}\302\327\311\320t\366xX\245J\023Mg\017\033b\375\260vX\233\316\236\037\374tBC\364\3704\237\316\r\\\020\242Xv\300gD\323\331S|:A\300\033\232\316\236\343{\342\3351\302\314\327\204\211\344\333\204\362(\341\350\333\223\342U\302;NX\371\204\266\340\214Bup\336&\024\204\n\330yb\031=\301\t?\227F\0227O\347\362\204(tC\215\b\024K\025\310\235\227\311\334\360\302\313h\261\231sl\356@u\244\257\023\332\003\277R\234\227\307\t\273\302\232\244\364\371\366\360@94\235!\340e\211\023\311'\324\t\223hF\227(\242P\017\315\3675a\203b\251Bit[\320Q\202 \225.{P@w\220*\242\357\t(\363\215*u\244\313(\263X\264\201\241\305\267G\005|t\nq\244\316\024Ke\216O\211\267y\341\351\\\346 \245<\312\346\362\325Y\262"
+	.string	"\205\356(\243\357\323\271\214\302Jh\224\271\254\340\351\\\346\034\221Qh4\372^0a\002\n\3730\225\322\022K\232\267G\005\254\004!\372\302;N\0234-\350(\237\316\026tx\242/\334|\252h\326\274M(\210\347\313\214\276!H\\"
+	.string	";y\234)\274;9\317\r\027\236\316\345\tH\370\225\276\"\242oN\2163J\002\005tgg\003\007\035\346\323g\271\023"
+	.ascii	"\345+\365\241I\261\334y\243J\024K\025\312\346\013/\2439/\374"
+	.ascii	"t\326\264\340\214.\337\2473\005X\352\023\325\201\223\300\247"
+	.ascii	"s\231\343\276\314\347\362Ds\331$\302>=\260\017T\031\205\302P"
+	.ascii	"\036\032\026~\372@\231\312\235\235\227\251\274\260\003\303\320"
+	.ascii	"\250\016\254\204\237\257S\372\\Fa\034X\n\205\226P\2320\261\243"
+	.ascii	"K\035\246~y\226\027xw\234&\240\321\036!OOT\371t\362\f\233\357"
+	.ascii	"\333#U\302\317\227\007\226\372\214\240\271\264a\233\316\236\342"
+	.ascii	"+]\276Q\346\323\371\3564\235\310\036\251\362\205\227;\320\236"
+	.ascii	"\350\013?\235\3602\252L\261\344Q\2320\201\204\235<\316\035\345"
+	.ascii	"\313\202\263G\2524a\242x\235\f><N\017p|x\234\302\036'\013J\036"
+	.ascii	"f\223}wr\236K\345\316\316\222G*\274"
+	.string	"N\006\351\0164\n?\241L%3\352\001\323\304\0059O'OtY\344\211.\225\2604\3524\241|B\225;K\246\022\032U\221c\243b\271\3636\225<\321\245\324\331TBa\237%R\252\314q\232xB9\330\264\240\2434\321\263\243d2\227\356\033]\242hF\227;P\250\tJ`TjB\251\223\343\324Q2\231\313!\f+M\274\315\n\256\223\001\203\346\013\277;=<P\016%\234;Kf\215\324\002\024K\025?\037\245\224\351\344Y>Ut\200ur\234;&l\240\321\327\003L\346\262\205\243/\374\362@i|P,\243?\023oS\t_\270N\206'\324\t/\243\357\316\313d.=\220F\241\322\347+\325@\207\t;{\200R\245\224\307\031%\241\303\204\235!\232\317\r;;\320h\262\335\331\201F\265\364\365\331Y\236`a%\t\032\340\247\323g\303\327\311`\302\247\004\317\362\215\302R\017\236P\036\036(3"
+	.ascii	"\207\366\274Q\017`(4\352\201P\2524\341SB\312F\341\236\037\254"
+	.ascii	",\001~:}\332k\320\300!\203\f\\\340\204\315\314\320#\345\361\240"
+	.ascii	"G\312\343\301\323\271\344\361\200\031\225z\220\241\246\371|\177"
+	.ascii	"\377/\274\2509\242\313\246\004\331q\301\305\005#!\027\326\231"
+	.ascii	"X\0277\254\243\013-\212C\204\214\250\230](\252!\253\3122\272"
+	.ascii	"@t\f;\263\262Bd\210\304\205vt\001\350\002\320\205\025k\022\230"
+	.ascii	"\016\270\230\200\\\020\372\205\025uVhkY_\b\252a\362\313r\346"
+	.ascii	"\307\030&\377\203J4\036zY\037\005cfn\346B\214\314`\t\tOLrz7{"
+	.ascii	"\277\020\337\364\235\311=\255\350\2739s\304\353\210\305\017\327"
+	.ascii	"I\220.\272\033>\242\013).g\274d\355\377\246\3141\253hc\307\013"
+	.ascii	"\250\03325]yJ\230\231\327\215\036\262({\r)B\345f\f\022\t\350"
+	.ascii	"\226\264B\311\215\230\233<\265\030`\252Y\257\330\"\247\226\265"
+	.ascii	"\227U\311\332fw\303\005\016\371b}\3231\201\253+\356\033\n\\u"
+	.ascii	"7^n\264\334pY\337\232\216\261\320\023\275\252\332"
+	.string	"\215\227\233,\325\23307`n\276\334t\271\271\273\301[\2517^\220A7^n\260\320U\343\330\313\030fKl\306Q\257J\336\345\202 \"\024\222\334\324\335\330\255\324\033.\307\271\341B|qC7\305"
+	.ascii	"\267'/g*\330\200\210\247e\256\006Kw3W\346e\005&\353\233-M3\254"
+	.ascii	"\254\310\372(\370\261\377\233\270\225z#\227\207\025\305\f\n\254"
+	.ascii	"\366Q@\265\217\202\247}\024\314\330G\201\322\376o\2560\355\246"
+	.ascii	"(\265*nH\254;\245(*mH\",\220\026\037\0176d\327\235\017\"fn\254"
+	.ascii	"\034\251T\256,\255\025\241\264}\341\"\243V<\303\003#\306\344"
+	.ascii	"\006\355\006\355\246J\022&9=*\277\251\302\336\265P\332\202\202"
+	.ascii	"x\3777Sh\272\374\326\350\200"
+	.string	"$\271yr\363\344F\n\335\231\033\263\337H\271\211\222\347\252\260\200q\023\345\006\2121*GW\035P\b\030\025\254,\373\277q\202<\373\235)\335-)\303\262\343\224\260\254hr\314#\006i\263\n\"S\323O\354\342h0AV\215`^QO\306\220y\271I\313\326\225\330\216#f\251\222\022\267\204E\361\255\253o\207\222#\243\215\256\035N\302h\226t\230\035\031>0\247b\223!\2620_\233\211\2277#*\r\325\312c\307\212\251\033/\232\037hM~t\334t\321x\2351%I\202\374!W\225\352\201\204\211\216\222e\250\210\353l\255\322E\303\313\226\221\034\025\246\214\236\026M\332OF\036\225.YG\276\275\006d\311\t\253\355\346\bM\0260GI\254\\!\351\364\326\342\212\262\276!rS\3447F~c$\337\030\371\365\365\261H\264\210\261\372F\210\bRq\ft3\275\031\362\033!\367\272\021b\3343\256\353"
+	.ascii	"2\221\262\030gX\r\004\310\215\217\275\305iz\002\036<n|\024\223"
+	.ascii	"\364\370\215\017\247\033oxD\033?!:.2\262\376\tv\334T\335T\335"
+	.ascii	"\350`\202\3437:n\254X(\241\362\343\306\352&\207\221\230\252\021"
+	.ascii	"!\222\272\255\257\023\300\270\211\272\211\272\231R\273\261\361"
+	.ascii	"\233\251\233\033PJ\264\356nn\334Hu\001\211b\005\307\017\256M"
+	.ascii	"\307\230\t\276\3344\3354\335<\341\201\221\251\306MK4~\363tS\243"
+	.ascii	"G\216\034{5\212^\320\200\306\354\"&6`\270\355\033\245\033\245"
+	.ascii	"\033\031c%d\021\331\222\241\027\34372\230NT\t\321\270a\272Y\332"
+	.ascii	"@\364dh\345\026F\364\214(\271yq\363\342&\351G \03217H\277IZ\273"
+	.ascii	"\314\220!\313\372\346h\r\0032Ma\301\305\004=nX\374\206\305\215"
+	.ascii	"Q\360'\216\177\216q\020\227'(7D\2771\272i\241\245F\225\255\026"
+	.ascii	"7EHW\314\2300\211\261V\027f\002\243\233\025[M\214\214e\375\022"
+	.ascii	"\234\331\377\215P\315\023c\354\002J\350&\210\206\376\301\344"
+	.ascii	"-\314\r\320\361\354i\252\245\357\346\247F\311zd\352\245\314M"
+	.ascii	"\\\214sqxa\233\366\325T\001\322h1%\351\314\221\214\232\0310?"
+	.ascii	"|\307j\315\317\235\223=\033\245!@\212\3240\223\204\301\305\226"
+	.ascii	"\225\244\314\261FqG\226*}d\214Gb,\241\341\"k203cc\214D~1t\020"
+	.ascii	"Y\"&\3314\004\2254$/\b\220J\232\223\2630F\037.\250@B`\214:\262"
+	.ascii	"D}y\3033V\265^Ya=\276\030\221\3448\375\330\253\026\257\f\241"
+	.ascii	"$\001\323\342.\031\025\305\212\013]\326^-\365\016\312\224\254"
+	.ascii	"m\354\276Dy\225e\355\266*\231\232\321\342r\234\221\245\276\366"
+	.ascii	"V\324\025\231\\%uf\330\350\214hC\202\222\260\315I\241B!\003\313"
+	.ascii	"\332\213+\216\275\212\354\225\017\026Q\344\214O\334\300\324z"
+	.ascii	"d\355\343K\354F\326^aiU~\270\200+~i\311\262\316\272d\301!\344"
+	.ascii	"\311\026\026c\030\321\214\036Y\007U\367\230\262\006\236\201A"
+	.ascii	"Y\311:I\352\311E\3263\264\276\030a3\306(~\20115\263b\234\021"
+	.ascii	"tbE5\265\206\364\263\203\313\222S+\nR\203\272\312\232K\313O\231"
+	.ascii	"\2543\327\017\017 6T\222:\330\362\260Xe]\374q\264\003j\212\021"
+	.ascii	"H\330\327#\f\330\331q\305\215\037G\246\244\220\271\0022\003F"
+	.ascii	"\224b\036\233"
+	.string	"\0256d\t\024\262 H\230\262\230%{xQ\232[\362\344\370\263\201^\216/\033'F>,\253\254\254\262\344\020\001\324 r\326\304(U\026v\267%k\035\264\026\343\311\206\211\361\211\330#H\017!\233\261\342\214\025K\237R\023\033\261\"\r)Z\332\023\233%\306<!\023\246\241%6J\222f2\236\346Zx\025\021\303\222\003k\262D\357\211\322\227\361\013+f\305\213;jrJ\313\306\3445\304+\311f\234\223\302\341\242+\231EI\024\022/Id\330pc\202B\222\234\213{\032\302\226\265\215\326\332\327\267\027\307@6ZF\2420\2518\006\262\341\262\331\272\215\326c\343\n.\250\\\2606Dl\210\330`mqQ\3446XGr\330T\221\332\221\253/\0277\264\230\354`\003\323\304\310\016\033\216q\362\326\027\347\303\207\215\220\036\037d\r\271J\372q\033!6\323\2529\251\254\251M\020*bRlF\314\200\254l"
+	.string	"\321=~zS\342zL\301\201\303\206\007\326\007H\276\254\224r\334\206\207\315\016\030]xSv\330\350p\022\273\"\303\261\342\250\302B\311JC\255Icb\304mE=\312\206\252"
+	.string	"Bq<\024\253"
+	.ascii	"B\325\244jc\3436T6ST\322\230\004\261\231\262\271\261\007\325"
+	.ascii	"\002+/\230"
+	.string	"#\307\226X\n\310E?A\212w\354\33063lf\330<\351(@W\214-\0316M\267y\262\251\201\2655U\303\306\251\375\261\241\246\027\227}@\241bfC\003h\245\250\025$\310\212\022@m\033\246\2615\215\210\035\\\326/A\222M\214\242\333\026\271\271\254_\002\027;\371\002K\211\\5\353\"\230\013\245\205FXR\362\252M\256J\226u\021l\ra&*+\353uI\223\262\030/\212[\324.%Cl\\\024\217\314X2#\313\306\250h\344\211\030\265\205\261M{\331\001CK\221q-\323e\321\033\"\262kR\305k\314\206\205\230%-[\340l\206j\270\020\227\030\365\220\262YQ\003\304\366\005i\333\262\021:\006\251a\243\250\315&\250\246\205T\216\026@\305\254\2552<\206l~h\224\b\201xIYa\023\027\277t\213\262\0273\372h\344\210\207~\316H\275`R\206\306\227\004\302\2728Crd\017\231\343"
+	.string	",\\@1\203\303X5\343\004\252\f\217!\0207%mdj~P1\321qU\243\007\006%\230\016\250t%\017\226&e\252$\207\342$\306\234b\fQ\021mP"
+	.string	"\323\025"
+	.string	"0X8\032\215Gde\226\335\024\200\017Y\302\206hJ%\017\324$\251\2202\003\"\003"
+	.string	""
+	.string	"\004\004"
+	.string	"\b"
+	.ascii	"\b\352T}\377x\247\3376\234*\362Z\2211\\S@\322\200T\370\355\247"
+	.ascii	"\210\255<\206\342\n}l\006\006J\037m\216\271i\246\001\"E\366\240"
+	.ascii	"\352\307\023l\017\305<b@L<\210\204\336\275\277E.\345ue\2124\341"
+	.ascii	"\211\364\004\214\345\214\341l\027\371J\203\017\247\260\004@\337"
+	.ascii	"p\021\257j\fG{\\\212\334VMd^\220w\332\2367\223\220\0240\240\242"
+	.ascii	"`\242S\315\366\315\224\253lg\335\r\314\3577\f\300\032\232\343"
+	.ascii	"\247\236\b\202]\027\307%A\341\"\201\372{\253\025\350r\213\365"
+	.ascii	"\324\334\235:\224\244\365<\036\n_\344V\21260.uJ\377\205\261U"
+	.ascii	"\3320\327\241s\243,\325a\264\352\212j\304\317\003\002?\024\226"
+	.ascii	"\330\245"
+	.string	"\nU\245W\016\372\307\257\006\312\317>\031%\251\300kk\262\301~\004\020i\236\214\263\212\236\3641\315%\034V\r\306\242\237\211)8gp\273\024\261\024\302\330a\366\003al\263*\nu\031\320\235\242k\374c0'\252\234\232\363l;\322MW\322\005\246:xjJ&\252}#\264;\273\2743\316d\370\247e\363Z\216w\303\304\256\270\260\262\330h\\\031tT\312\362\331\212|\351OC\302\211\243\266\036\032\241\264;\026|O\245D\004\231\326\314\025.}\242N\255\003\352\246\330\027\277\323\306=\r\342zL`\314\251\304<L\253\003\342Q\306'%\001ci\003\345n\261\217\026=\227\255[7]\346\353\t\352\202\001r\036\235\034>\024\212\320X\313"
+	.string	"\303:2\"\031\312\004\261\362\t\270\367\334\235\310\245e\264\006\342ys\030\352\245M\337\225*\231\305G\274\222\314\250\224\326\345E\033.\224kx\245UA\265Y\362\225\271\267@5_p0\267~w\370\217\347\363\226\246\374\361\227i%\244q\037\303\234\216\367\002\212h\322\302E\373\257l\205T\3571=\031pI\006\345>S\242FH\036\257\276\003\2216&\210\244\276\313\362\364h\215\340\rNN\b\032\013u\346\024\266E\233[=\b\272p\216\304\335u\023SP\260\b2\003\246\250B\034g\202\251J\241\334\257\344\307\306\3434T'\214\020x\027\02030C2\\\003\333\2107V\242Y\342\274j\234\373B\361\375\257\241?\276R\340(\331\266-\3338\222*\271\350\353\374tx\240"
+	.string	"\013\342\331pm\350\222\362\354\262\354\213\223\316>3n\302,Bf4"
+	.ascii	"\024\316nk\230\206H\030b\366vR\f\222\217\344\031m%t@\302.\030"
+	.ascii	"\274\034\344OL\035\022\221\327m\201\377\230k\004\371S0\314+\376"
+	.ascii	"A\035\213\360P\311\366\214O\200O\271Z\007\227\200\016\272\376"
+	.ascii	"\363\202i\234\033\272\270\337p\206\351\277\317-)\201Zg\370K0"
+	.ascii	"\205?\002?1Wd\300\373\277[\247\360\2621Y\027\032x\375\342eUy"
+	.ascii	"\273\224q\026B\027\254\325\345A/\202\250j\214P\206\036\231$\276"
+	.ascii	"\264LU\364\302\316UH\356\355\3011\005\334\214\202\304\244\353"
+	.ascii	"*)O\304\033\362\341\233a\367\b\225*\230\331\353\223\033.$\356"
+	.ascii	"n\300O\200\007K\315Y\006\306\364HT\302\323\200\3377"
+	.string	"\222\360\r\253uk\177\307#A\t\243\367\227\372\373>\204\250d:0\370o\245\002\221N1\005\356\004\265\327\300-\225\331X\271\2042:\326)~=1\035\n\216.\217\351\007\324\214\313\277^`\226*]R\244\236\217]\036!\344\027NC\005\030\256\371\373\356dn\263\372c\321\031\024 \232\341\022\370\r\210\365b\033\003\326\r\241\030\221\266\021I\352\215\036\257q\315\033\020&#\312\240\300\252\020\020\214\304\030%-\223\354\303\027\265r\217\177u\231\255\271\353\366#\341\247\325\322\266}\335@W\f\013\344\366hf@\206\366\230\312|\3473\335Mx\301J\034_\300k??\r\036\313\315\365\240d\203\2035\241=\250A\266w\035\007\332\327\367R{\025\373\003x\325\246`\001e~\356\370\ne.\227\005\372K\007\241B\260]\355\023\372:\221\332V\313\032\214\230\215\346\200E\245y\216Nl\3109\215\240\203\357#\276(\212T"
+	.string	"G\350\274\n\320\016}\344\371\356D\277m\f\242\350DU\277\364\267\2553\221#\005g\354#\270\372K \360\237\264s\252+\221Q;\360\253\207\320e\325\366L%\n\320)\345\265)TQ\034M\241\347\322\003"
+	.ascii	"u\352B\307\265\025\t&X\251\344\331j[\2641\266\232A\372N\342\235"
+	.ascii	"\2721wn\r\rT\337\230\337\024\026\231g\364B\230V\356\363\f\364"
+	.ascii	"\221$\302\343Ec\370ed\307\307\037\021\336\207\357z\274\3145u"
+	.ascii	"\266H#=O\325\373XNY\346I\263\023\267\"\313\267\315\364\250\263"
+	.ascii	"\212\335\005\201\007\343\013\033\2662\207$;I~&\313\232\302\334"
+	.ascii	"?\246\305\027\200\345i\027\226\376\013?\032\222\224dX9\311^;"
+	.ascii	"\313\250\265\316\376\3131\350B\245\363\2719\316\211\307\253{"
+	.ascii	"X\251f]\215'4\220\270\324y7\023\022\317\312\332\213\371^g\221"
+	.ascii	"\215]\340\323\306*\245$\023\313\020\311\177\335\003\237\211\304"
+	.ascii	"w\221\003"
+	.string	"\356,\032\303\277\241\022\336\327%\266\3556\210\334H\"\253\035\034\276`/\bq\343'\241\r\343Bd\345\202\177\363N\f\025\004e\301s\013t6\315koi)\021\002\321\240\2426\316ep\361\327\025.\225\032/4/\226&uev/\006\232\206\r\216BtO\336ys\265\240\275\220Q'\013\364\024\260l4\305\2745JL\201\223l$\021-\n`\233\250t\001\276\216\253\326\2533\020D\223\341\030Y\323\223\313\2566W\233\\Mf,h\200\376-.\251(Q\315M\2048\335\343%~\005\004\361\305\221\230w\311D\361\301\021X<\026\377@\211\254Q\231\204\031m\340\220a\300\033\026\237\330\320\341\337B\n\001\030y\331\006\013\317V)\313\013\321\r\213\226G\003\202\200P\254.\307\215\373$\201\005N\344\0264vj\321gz\201s\001<\277T^X\340\034\031\231b\234\2003\240\372\314\006~\235Ml\030DMU"
+	.string	"\177i\346\262=\371k\230 HE\r \344\r\240\034\003\001+}\353d\222\274\016\232\276J\200\222EiI`s\244\267,\1778\3131$"
+	.ascii	"](\370\243\310C\r\334\246\330b\006\0174\002!\245,4s+\001\353"
+	.ascii	"]\303\224\204\361\271\361\201.\026\351 =\301\361_n\261\005\367"
+	.ascii	"5+\013\035\2134\367\231((t\363%N?h\254\323\032#\032\253\023\342"
+	.ascii	"\033G\032\327Z1\266\373\350+K\372\245\202v9(\230\244\275\350"
+	.ascii	"\262?\t\3273&\343\2331\320\303\271\367y0\270\016=\234\275\337"
+	.ascii	"\327\315W\227r\347\201"
+	.string	"\212\030\245G\271\013\254\377\346~\230\033O)\017C\226z\206\207\030\006\217\315P\353\227-\\\202{@#\006\336\325\001L\362\323A}<\263\354\024\035v\274\f~\336F:0\376\313\267\001\260'z[\266v \263\307\017G\343\246\233\334\342\031\347*AS\252\364H\337\022\356\202\220\240u\313$y\207/\357\304\246]\033\312g\223\250d\264\240\214\242\213+\320\374\217Jo?\345#X\roU\341\276iy\207\356?I\247\264O@\324\303,\337~\335\251\3247\2168+b\037\225\034\217\004\363\260[\331\034\217\230H\377S\366\207\263I\346\327F\262\352&\037Qo\320\247U\313\r\327\343\222\222c\321t\307\333E\207%[MDf+;^h\213\016\332\323@\213l\305\376\373\250\363W\340\355\344\n\234B\327\232\021\216\341\227\216\025\321\206\364\023=ge\372\315\002I\240\342\302e\024\036\372\365\334\034b\367\314\305\212\201["
+	.string	"\026\021\232\007\322\322\271\\\216\322\311\200X\222\2547\246\001/{i\034\201{\274\203\r,\240t^\372F\t~^\311\222\321=\326\220F\340\220\250iuVWr\200\021E\215\374b\020uc\020b\304\367\020b\310\025\273@-:s\n\314\024\317z)\b\037\026\001D\2345\006\272MUe:\364]~5'\265%\212\332+\342\"\316\321B\301\334\025\321J\207\200\227"
+	.ascii	"\036\247\n\262Ra\212L\245\001\363\311\360P\324\020\313\"\313"
+	.ascii	"\177J@\366\323\363\371{\004i\305(T\213\341\350\3304%\232\206"
+	.ascii	"\326i\026<\275\263\203\230\005;\350\327F\332\005-\262(\003\275"
+	.ascii	"\037\240\325S\205\203\222P"
+	.string	"\366\030\262\246\202\201\034]\216"
+	.ascii	"\373 \273\325\313;\216\032\275\257\233\007\272;\005\244\017\211"
+	.ascii	"\270\350\243\361\230\210Z-\026\362D\205y>\274<\234e\215)\307"
+	.ascii	"\335\376.\2472\265)\242\270S\366\307\205\270A\211R^O\312\177"
+	.ascii	"\317\354$\203\252(\372\335\265c9B=r\024\346\302\353\203\342\225"
+	.ascii	"\n9\002(\235\315:$\2107\023DA\355\263r\211\024\336\020cy\206"
+	.ascii	"\307\367\227\340\273\371\374\213\360\231\321\272:\nn\355\002"
+	.ascii	"\234\231\022~\352\320_T\234O\273\027{\252\312\223x\233F\2135"
+	.ascii	"F\301\260\237\027\t\222Z\321TaN&5\013\350bL\207\024)t\264{!"
+	.string	":\024\275+\baF\f\036AD\332\024\023],SB0\2131\227A\367V\353[|\0025%\314\316\342\271;\242~\264\360q\177\212\302c\026\330\344,\223e\260\315\034\345&k\351\220!2\313\252&\274\250\016\210\r\277\024\375<\221\366\334\020>\365JV\241&\372\343\0330\345\266\316\213\205B\263Js\361\233\302K\242\310/\244\302\365\241\271\300\350/\222\356g\373\302{Cm\3425\324I7G\005\nh\0044\024\nI\231;k\360\213\266\201lj\230\244-W%\017\333\336 \314f\"\216\211>5\177\001\301\213\350\024\274,\351\353\366\317\363\301\315-\005\213O)O\355\346\246\242\334\241rp\374Y\027\371&\260\242\035(\002[Z\316Sh@\033\3056\264S\374@\366\215\211)+m\264\224\"\305\223\235^\021Ob\253\327Ot\016\rZ\302\371\rb\216\035\207\025\365jN\355\211\361\221B\300\213\334\245\3417v"
+	.ascii	"\360\r\223\230c\320\364\367\024,G\003\373"
+	.string	"3\360\245h\236\322\271\305%\316\005:\210\240#\311yp\220\016&X^\036|\333\263\325\266\234\017\350w\342J\240\2355\372%d\210\236A\262AV\215pls\240)\177\2315\030cCS\352$Bx\211r\361\267\344D\221\305\265ih\322a\371i%\244\241\353e\245\252\002X7\034M{$\363\262\376\225?|\274R\256\r\351\232\365\321\325k\247.\210\342\230\210\030\334\231f\375}M*\027\372f\3102O0\313\367]\237\365\240\006\r*\322X\361\362\"(\036\207\270M\241J)\272N\021\273\332\265zN\210\215]\262\035\277\314q\321\305:\246\001\361\274\354L%\343\237\315V\333\331\021\274\323L\346\336\324Z\321\227\037!.\261\354\331\211\214/\325\355\033\223W\f\0271\212\312I\356\260\323Y\364\3558u\366(\310\360\376\303H\202\r\206\030\312\270Ob\351\3214\202\223\024\363\244Td6\326a\2702\214\333U\023"
+	.string	"93\330\221\371\372\215u\213\217\003\360\235\217\340G\f\017<\327\360r\037\be\261i\275>\034\243p\340r\200\032\307\244\206\006\364\276\001mJ\210\242+$\255@9|\204\003\234\241\2229\237\334\024\225\341\356\301\023\350b\025\222H\t\f\277\253\251N\212\236\372\002\306\021\220~\315Y\321\234P\276\355g^\324r^2K-\034]l\3659\374\345D\024Ea1\333\305\330\237\241P\377\335\342\216\366|\255\357*-\b\007\032\372\2111\bE\334\367\327&\264\266\275\232%u\206u\226M\224"
+	.string	"\370\23642\272\005\203\377\035U,\272\322\370_\230\326\312]FV\343\220\237\234\377\030p\250\022/\262\231\271\201\236\313[\251"
+	.ascii	"\212\032\306\370\025\235$\315)\315\200\276\345\230\350\255m\264"
+	.ascii	"R\233\020\261B\340e"
+	.string	"\356ko9\316\244\3318\270\246\344\004Q\334\276&4w\2343F\037\f]\226\305\356S?\276\330\346\271\361\212`~P\017\355\034\331sM<^\036aE\367\213wH\021^yf\002\333%\036|&\344\233L\256S[\355O\231\n\b\214\177}&i\230\364\021\260\216\364\234\037](\335\273\266\2315H\232\217\322\200\236\004\2410a\302dr\231\350&\003\306\270w\0312@\274\215\272, \223/\\\240\bE\026l\n\343\234\257ma\212\304\314\256\275\253v\347.\276Cz\246%No\221\266\345\343\353\273\363F'\025\203S!\036*C\302\303d\316$\313E\344\020\230\366\307\264\274\366\225P?\002b\322(.{K\b\256\037f\332\013\277\374^\035q\211\326s{\250\t\354\3526@&\004\364Z\003\3664\205[$V#\361tb1L-\370B1\302>#2\037[\210\267\235P\332\na\350\n\220;$(\036\253"
+	.string	"\bv\035g\353\254\250n\314\325\252\bf\226\002\356"
+	.string	"Jv\001\352\274X=\022AiGb\3673\370\031\003\306$!\374\201\333\005\003\0225w8\335\007r\013Kz\322x:\366\037\3226=\206\016h\354{0{E\314*E\213\305W\372X\333\3049H\311\303\033\314\035\243t2\342oL&;\221\022\372\211~\003\037\315\220\203;K\004\370\216\207\245\024\340\216R\226m\3749\215\203.\332\003\271K\323\022\235\007\274\215\006\263\035\355^CO\225\206\034g~%\306\217y`=L\r\225\002\277\037s\363a!\242\n\306S6b\272\313\003)\nh\311\206w\034\360\222\264Tm\335\202\337"
+	.string	"\005}\216\354M\007\340\\\231+\321\227\360\002\252k5\230\214\326\356\241\325\3024Z\213\250\254V\265\233\361\005c\365B\213;\002\264\025\213\252\020\246m\372\244\321&B\312j^\353\321\236\034\342@\246\326gp\227\362xA\253\240\024\376\224\266Py\177\364\351\031\201\213\241\235\371\375\275y\306MT\206k\236/\370g\306\375/\225\335\030\0373\005\313\317\311n\"-u\244\013v5\247Z\353\305\333\236\375\321\372\240\177[\307E\t\235i\247nw\235\032\271\360\351$\322\364\337\177\317\016_\266\261qP\303bK\300\221\264\301\036 $\033B\223\374\327q%\304"
+	.ascii	"\003\311{;\347 \3247\023(\377\033\243\002R\b\002\253\255Df\346"
+	.ascii	"\300\273+\323L\361j;N\215t\232\264D\004\016\024\024\324\026\b"
+	.ascii	"\034\353\370\332\302\255\226o3F\337\021\211\332.\001\252\337"
+	.ascii	"\214\327\026\355R=\233({\3457y\202\266\363\247\233[\301a\255"
+	.ascii	"\302-Z\3662a\365$\204a\211\373\345"
+	.string	"1Q\223\300\005\252\005=\316\327^\370\f\222\366\352\347(\370\335\230\013\200)m>\242\300xt\356n\374\226{:zy,\024\354\203X\266t\013k\215\364Ec\204m=\250/wx\032\311!\370N!\315\244\276g\307L\005l\003c|\303\224D\317I\227Aq\261\371\263dm\003E\304l\355\350{\245/\307\007M\001\217A'\200T\203G\007s\0177X\233\306\275\006\214\005\022<\204\215*\316\325g\324\007BP\275\341\017\344l\177\004\227\002\220nzP\367\262\263\256**\316\314\232\374\376\334\f\302\254\325\221\037d\313\345\351|\347\177\251\022\377\243\221zv\017\255\2359\211\n\310PdR\024\271\253EQ\362\324\273$S\232a\2165\342\254\277\016B\022\376\342\350$\240j\260\264\t\312N\017p\200k\325\320UP\254\221q\242\327A\035\206R\236\236c&\r\316\256\311\036!\030\377B\237\232\323\232P\355\033\230a"
+	.ascii	"\333\353\253h\222\343@\337\366n\366H?C:\023\f\204p\022\206\332"
+	.ascii	"@\372\024\265\343\002\254\272\262\016\246\f\022\024\356\232p"
+	.ascii	"u\264}\312]\242\234\n\206\363\t\315\365\034F\240\217=\324\017"
+	.ascii	"\225\013\312\242R\n'\231\370}\271\177n\251\320\305\245\245\231"
+	.ascii	"z\031b\032\246d\0174\210!\200\351>\2347\261=\202\345(\177\235"
+	.ascii	"\252D}Zk\f%\327\030\324\277"
+	.string	"\336\034\327\210\334\033\027-\323A\272\341\201\342\300\024\006\243\273\313aT\335\230\331#D\264&\025KO(\317\001\002\307-:MI\333R\362m\t\nG^\032\027~\356\021\312\273\262\217\b\307\3352\211\340\334\351\242\371\350`\210y\177g\311j\221\226\022\371\251\361\362U8\331K\313\345ey3\247\311\232)\036"
+	.string	"\277\207[7L\342J\312\366\221a\250\243\026\260Y\340\3201\002\337\2709\216\307\252<\230\3267\253t]\272\005\231\220*\317s\204:\231\207\260}T\227\005\232#\335&\326\370a\302\004\272\273\375|]'FiK^\312\200l\304\372\304-7\036\304\223 i\351^\262\270=\205\317\016H\312\352\214\202\017\247\262\375WA\327\306,\275l\027\320\270\242^\263mO\360\314\207\343\201\021\222Crt\300e\363\t\277\3466&J\272\226\177\274\250\222\372@\276%\rZ\360\035\225\362\270\220\342\263Ap\310\340p\272\365\317\344\177\256E\n\326\267\3006\b\332\244 2U\006\r9q\356u\356\266\201\016\007[\033\022I\006\304\303\002{\37706\361\340\222\002x\314\254'\002\335u\377[\330%\313"
+	.string	" \372I\204q\210w\216j08h(\240y\204\243Km0\245\2445`X\303\352\251\203\313\245\330\317\352f\214\371G)\001\310\"\367+\277Bm\325\373\272\274G\212\273\360m\337s\375\325\317\272"
+	.string	"\353\272\2054\261\252\250~\230\326\313\201\336\213\244\375=uIJ%\234\352\013|\337\\n1{\033\244\274.(\353\274\357D\n\253\204\003\271\320%\343\005Xx\273!\263\372\353N2\220\214\032r\264\017t\0161(\243i\013\351\t\303\355\265\206\3053\301xP\0337h\f\270\232\031M\245{Z\005`On\202V@\246\214\302\005\226\362\035q \212x\213CXC3\242\271\303|\320\375\355I\0360t\024\017\362\022r\fZ\033\225w?>\021\306\306\332P\\g{\317Df\205*6\223\347\201:\304\244\031\347\261\t>Y\254v\322\360\32321\246j!\353%\340\330C\254\215\375\fG\325\262\354\007I\253\322\360\357\215\bN4a2N\0256\016\226\277\314;\243\233\005\217\t\202\303\221\230\3728\036\211'\t\222\376\243R\260\254g\300\274V<\305\371\372\254\335\273&7\032{V\003\035\206\241j"
+	.string	"\207+*Yd**t~\301w\323\231\213+\013\321\215\263z\277@\304yb\016S\224\327\364\350a\323a\323,RO\320-\272\035\337\340h\370\314\376S\336\226\252\237J\223B\317\362\024i\f\271\177j$#Xt\313\034\031\334-\240efH\325|\r\t\025\316\002\263\310\211\022\277j_I\262\342\360\007\024\036\314\027\355,\352Z\372lC`\001\024\023\352B\340\210\213l\270 O\241~\003\026\371\250\007/\343\203\036#\333\350\343\242 (cb0\034\177\370\200H\002\226X>\347i\370\252C\332\340\305\342a\371lC\316\205\022s\247\030oa\031\352\343\031^W\0347a\330\r\332\312\351J$\352G\357z`\272\230Z\254rduP-\2529\370Y\013\323Ky\031s\211n"
+	.string	"\336>\324\340\374\302ec[\032odY(\207\3450J\231\\y\\\374\313!{\354\035!M\360R\334\212\332i\332\247\350\250SS4\317\303R\350}\225\360\367\243\264\327d\254p\307P\\\207\351\301`d\244\022\340Aa\003W\270;Ve\234\273 @/\302\341\310\f\226\300\316c\013C6t}\272\275_\0031\372H\340a\370\035\344h\331,\316\326\322\035\275=\376\203\220/\335kc\254\0349Jy\017RX\324A\301=]\327\004c\375\342^\264\257H\272\365IXV$\361BoH\201\320\207e\344\274\236\277\261.\022\003\031"
+	.string	"\031\222\r\004)1\227p\346\225LI\217;E\253\340}\270\030s\242\002\025\304\r\327}\216\305\350\342\005\004\276\363?\226\215\211Q\024\205\362[\007\374\026\207\027EP\206f\270\237\254\340\344\253\372\243\231m\375{\263\032i\240\3016k\316a\004\277\374\370\330\272\266\303~\017\301'\307eg%\323\342\344\333\235\204\030\360-\304<|#\272L\rx\304\235>\301\201\242-\235i\212"
+	.ascii	"\036g\325\255\312\302\253\220W\277u\304\251y\343\001q\220\313"
+	.ascii	"\220\350\345\210lO\347\230Rr\24350\367)q\212\370\031I\377\321"
+	.ascii	"\327w\311\354Q3M2\263b\300\006iBD\343\352g\013\r\351\267\205"
+	.ascii	".\304\301G'"
+	.string	"\025c\013 \301\251\216,/(\017\211\226\323\022S\213\363\"\214KA\201VDP\251xZ\3269p\241ppF8\366F!\031-\240\327\024F\374\303\354\275\\\034\365\005b.!\243\236\253UB\377\347\350\313\021\361\270\371\321\030[\007\034}\216\250\314|\320r\327X\233;'[\251}\f\350[f\324\033\r\373\243n\n\335\212\345v\245\354;\324\201q\"\177W\346\021\317!S\313hc\177\320\b\376\002x\345\254\360\037&\222\227C\224\225\226\235\004\352\t;5\270!\254\241+\355\276\201\342\350/\326\001\336{\017*\345\032\2466M\312\234\r\323\363#=Wn[\327\n\0132\271#\201\230^\r\333\340\004\"~Y\256rL\341\254\371\336rY\202\352+]\2253\307O\347\272\316\327\366Sv;U>\nr\333\305\310\212\016\031\254\275\177\243g<\363t\212\360\305\326=X\002~+\306\017Ws\022L\230\320\231\253z"
+	.ascii	"J\264\341\214x\303\241\214\255\317^\035\244\036"
+	.string	"\212$\202\227\360\266!\004\362\211 \257\330\223\013\300\271+cm\214~\363;\005\303,G~J\241\215\033\241]\240!\223\344\232\215\275\372\016\336\374\337\357\277\3673V\367K\210~\215\234\370&\251EOm\325\224\t\332?TEG?.\334\013'<\373\243\231P\330\241p\220\"\354Q\t\005\024\005\231\330\263.\316#w\342DbK\261D\346\177/.S\262\210\257\215!n\331\313\034`d\310m7\2369\364\332\005\355{y\271g\2410\325N\307\004\216\246\0222RQ\316\2632\360\275\201Y\007-7\362\227r\363\270I\341\306\201}\020\007-+4\356O\362\342{K\366\272\024\351\022E\300\220G\372RcfS\220)\240\306\257\362/#oOZ\nj\350\277\274V\312\215^\027!K8\024\3617\301q\356\351\022\230\220\3354\031_MiVn\306\353\222djAs6'JD\r\"~\005\266\357:\330JI\334"
+	.ascii	"\225-\004`\347\254\330\345@\267\234u\002+g\267#\315\263k\206"
+	.ascii	"W~0\227\275\016\355\217\003\252\370\234\353(\262\223\243\334"
+	.ascii	"Y\350\274X\252\323\377W\354(\300\2605M\232\326\005\032\324\360"
+	.ascii	"\337\004\302:\016\021\301Pw?\333\351\341\005V\277\264\316\300"
+	.ascii	"\330c\322\322=_b\346\231tN\266L\241\367|4\027\304\372\357\207"
+	.ascii	"\013\005b\r\314\013|\b\300\030;s\002\301\320\276J\253p\"} \354"
+	.ascii	"\311\025\203\377y\020S\022\nG2\207\350\250\211\267K LV\330\262"
+	.ascii	"(J\310\266\"n0\343\263f0\342\266\352\361\f\020\241%\317\220\""
+	.ascii	"\025X\347\310\210\211\303\326\312\007\030\b\337\237pV\307\252"
+	.ascii	"\323\3251\221\231 k;\205^\206&\247_\353r \344\366p\363&8\022"
+	.ascii	"\311\031%\n\323\275\300>6Y\327%W\250 \017e\311\350\251N\300\322"
+	.ascii	"\017\365\025D\201}\367{\362E\002Y5\371\360\217\3630U\371D\016"
+	.ascii	"\366\026O7\331\275\fi!\r;\250\352\230\264YFjg\351\004P"
+	.string	"\233\324\216\032\237\300\222\230NW\256&\206\364\314P\027/_C\355]\"u\033[\264\215\200\f\207\234\016\337\021[\246\274\277e\333\261\336\261l\033Aj1e&u\322=\311\351\260\307\252\375\227\0037\345RAG\273\330G\235\252\324^m\252\201\344\354\236\277\254\313\016\016\re,\326c\006[\242\240\033\242\b\314FkoX3\260OC_\204\206H\312\2409\226\006\267\253`\247\275\350s\247\007\331\205R\017-~\220\243A\247C\234)\227q\352\262\230\227\237\\\037\266\254\\\335\331$\372\222\021~<\323\244=\3509(\240R*\240\343E3"
+	.string	"Z\250\374L%\364\276\"kr|\276\007\312$.N\335\341x\346\260NG\304\335\322JB5@\352\355\245\364\275\273\007\206\310\343t\005\005\303\324\254\0230\307\277?\262\330\306\025"
+	.ascii	"\247\271\306\305\225\314\205\274\370\306\263\023\251hI\332\003"
+	.ascii	"\017;\206.C\356M\365P\231\313z\325\201v</\324{\b\351w3\213\r"
+	.ascii	"\353k\211\217`=\272\243B\036\331\203v\215\254{\351\f\303gi\211"
+	.ascii	"\273\340f$\023N\237\021\f\3758j&\214\233\244\213\220\177s]rp"
+	.ascii	"\377\037gf\241\246\377.\230 \222\213\037\251\213\354x\2749\252"
+	.ascii	"~N\033\230:\326(?K\223:\336\3773\325\305\231\bO\377&\371B\312"
+	.ascii	"\241\245\261!\035\005xo\346P\320\307\253\2161V\376\007\205\320"
+	.ascii	"\032\322+\r2QL\333\365A\024\331\364}\315>\270\213x\234\360\372"
+	.ascii	"\3325\245\373"
+	.string	"\271j~\274\315\271b-\223*\204\274\346)\b\273$\177\fv\204\310\263\335\036E\215\210E.\277\233\364P\013d\223\342\374\247T\315\302\245\207\235\346\261\fR\362\265X)\326\307=u\244\004\251\370\356\026\3170\366\b\243\351\215wpq%\263A\362\005\016fp\322P>\007\266\313\2144\357\336O\371\264'\357~V.L\320\363\262\\\337\305C\364\1770.m\224\237\233\323\215\0314G1\322)\002\306\223\314\321J~\036\325Ax\2132;r\"\3659\301,\256'\314z]\024\340F\203\347\272N0>\377\226\332@\250@\277\030:\200^+{5\r;S\200\001\242\317\004\361\264\233S(\324\273\236\301T9\270C\275\357F\327\231\367\365\266\2278\177g\226\035G\335\352\224\207H\236\274\232\332\212\315A2\356\322\255\247\373\332\007\342\037nQ\366&\004\262\340\203z\224d\274?L\003$\272\025\326K-Pz!\365\357"
+	.string	"!ocf\321\263\326\330M\270G6U\265e\247$\251f\337\260\3126\017\227\271\342b\016\203\f\245!\361\212\253\235T\245\026\334+q-\313I\016(8\246\257\371\270\221j\326\215\276\267\232\202X\271iq9\222r\\Z\231\376\242\005C\032)\313\332\271(\337\242\254\334\231\371h\257\261$\326\362$\215\023\334\372\006\372~\223\254\320F\345\330\"L\310\354\304\210sZ\321|2\333\265\032hI_\342\007\232\322\300\366\226\215\320y\265\360\004\377\0243\344\216z\021\246<\026<XI]U\2164s\305x#&|Z\256&_\273U_\376\245\203\306~Z3\361\230Y\270C\251=h\337\361\221\367\036\256\364,\277\016\034\234\024\312M\320\341&\260,\277GD\032\340\327\367"
+	.ascii	"\333Nj\364\324HLOPI\306\006\366,\370\031\272\317\347\350sUf\327"
+	.ascii	"\257>\267\204I\200\2643\363\277\020\214\233B8\323\251n\351\250"
+	.ascii	"?\323.\020Q>\"\t\264\263LC\260\f\307\237\332\205\032\f:\2564"
+	.ascii	"^\265S;\253\271\376\303"
+	.string	"Z\317\215\207{\232\211 \226\202/\305w6\364t@m\034>\020\332\203\206\367\317}\234\346(BV\251\tV'\224R\237\335\252\006\363\205\235>9\365'U\324\236)\275s\327\275\352\177-\227X\313\302\350\023\222$\342RV\377'\305\356\300>\361\020\032\327\262\356\314 \203\275\340kj\266\207m\301\376D\361\376\346\266\230\266\032\212\"\b\004XD\007W\320\315\021\336\243\212x\210\323OS\210\336\242\322%Qlm\315f:\307jM\2457\r\227x\246@\266\326Im\016\232\342\257\226\210\317D\021a\325\206\205\360\031\001N<\021\222\326`\236\tg(\276\327(Oi\207\340\277\371j@=\217\t&&B\232\363XM\247+<@\307\200B\273\370\274\336\320?8\227\376LZ\227\270\310\025\320\246\243o\236\306D\200\202\237\260\276/ \305\353\245\360\237u\277\235\257|%s\345\265\326\346d#\327\373S\035\267\204h\207"
+	.string	"\023tx\206\367'\t\300\264\221O\356\21073\326:x[g\247\215?\225\250PQ\246\275l~f\331\233\037\243\322\363/\201\240\017\350\177\306"
+	.string	"/\2652\320\324.diN\316Mu\006\204TI\226\263\312`\360\017y\273\020Rt\016\244X\223\007~\210\272\362\225\304\3446$\375\354I\376\377s0\215M\344$\231\306\250\344\013\340r\277\341Fw\263\201\374\264\224\013\236V\273\343\177"
+	.string	"\203\337\301\353\357\274I|\306\200b\307\246$\217\321\206y)\207eb\022"
+	.string	"\271z \351\342\367\\%\253%10\017\230Kc\224\tv\314\206/\231\365\350a%\207\030k\237\226\306&\361\3377z\023\277A(\330\305\013\227\210\211T\177*\267\301\210\373o;\315\253\351\240d\244\231@\330w\221\231\220C\020\222\260PzK2!\220\032\b.\002I\250\337\274\276\333\005\304\310=\316\fI\276GV\027\201\212\035\377e\303r-\364L\255\005J\260\337\230o\247\320\t\n\220\225\347\261w\310\232\236\362\020\201\225e\241\364n\b\310\217\211\002\240>\317*\245\245"
+	.ascii	"\230\234\274\371!\367\345\034\330G\020)\267.Y,SRXQe\017{Z\346"
+	.ascii	"?\237\316\225\031\302R\315m\246M\344%\263\rX\312\324\214\023"
+	.ascii	"~/\"\016[x\346\331\306K\3425\205\364\266\303\025\252\317\366"
+	.ascii	"\013\f\b\001\311Ej;\3562\263|q\3641BZ\244\205\275;\013C\007z"
+	.ascii	"\235\225I\335\024\177\b:V\361\220~>\032\357\005e0\342N\305\022"
+	.ascii	"9Y\267K(S2p\245\323\2400\364\272\375\260\212\374\023+\347\272"
+	.ascii	"\254\221\327\bn\342\250\316\235B\260\272\002\365\036Bb-X(\034"
+	.ascii	"\244H\356\312A\237%\006\001^f\017\266\030Y\360\350;\235\273\242"
+	.ascii	"9\025e\0010t\0014\314\275\036\267\350<\033*\332iP\331\336\257"
+	.ascii	"!T\267\340\025p\rP$\250\217\b\310M\363r\200\3168\345vX&t\240"
+	.ascii	"Yq\031\304\230E\271\272\034\272\250\372\240K\274\332\002?v\266"
+	.ascii	"\204\b\226\201\335\235h\222\020\370\017\276-\032\217\252w\375"
+	.ascii	"pV\275\023\022p\331t\2058\203\330\371\373\243v\360\273\256H\b"
+	.ascii	"d\253\312Z\211\244\252\026w\3346\242\267D\251\023\"\204\213\301"
+	.ascii	"\017K\207\330\016\256.\2608*ekd.\037\347]\373\217\327\034\340"
+	.ascii	"\032\333\023\017\326\337\323\334\353S\317\361^5B\373\215l\374"
+	.ascii	"\033\353\312\032\351\212s\244qC\323\370\022P\231T\315\022t]&"
+	.ascii	"\223\333D.\232/\353\\}\r\n\346\026\217.j[^\3775{'\033\341\276"
+	.ascii	"\244bdN\202\316\201\234\363Qz\325O\2631\325\363\277l\2706#\342"
+	.ascii	"\303T\013\300\211X!$\343\252TB\210]\362#\332T\343\256\353\324"
+	.ascii	"\005Y\363Z\222\234\021\246[r\255\005\234/|\"\37733\267#c<\034"
+	.ascii	"o;6\331\270[\331\037Zg\245\202\025\332n\3349\254\250\\\017f5"
+	.ascii	"\027\257$\035\360\002\034Bo\204\377\231\345+\242l$\025\365\262"
+	.ascii	"\033\326\250|[r\034h\273Tr\020"
+	.string	"$B\t\006+\222D[\325\223Zw\375\007)\0245\341-.\363\234H\2441V\255\242\235\f^9\232\212\013\236K\331n\345H\021\251\262d6\017\333\351j\245\342\236\232\325~\215s\272\252\367]2\223\357z\210\331\033\314En\020K\225\253\240(\226\t\016\371\311\344\317\215\325F\271\006\251\372lIoM\020\323\270\345X\342ME\215\362\217\356g\220\033f\255\350v\375\214\033\357=\341P\344\275\227\026\222H\305\034\220\332\257\256_jd}%\366Y I\222\n\024\251\261\254\326\203p\302}z/\374X\213\311\n\342\205 \316\254\200\224\333\374\364\311\020t\243/\345_\235\361\227a|4+\267:b\234\322\275\326e\370\345M\304\356>4\221\327f@C\315\227\311\214yn\204f\341\252\220*\211\335\301\245\3437\216^\351\027\\CnY\3010y\350\271\207\345\355\313\266?\215\217\031\177^\316-\220o\250]\b\203\270"
+	.ascii	"\323\004\327\342/\b\272\250P\366\302\200\222}\234\252]\033,H"
+	.ascii	"\302\022\245\242/\235L\234\334P\365\366ht\361\356\214\251\200"
+	.ascii	"\025\332.\227S\003\277\t\00486@\277\257\372pe$K0`\355\366\257"
+	.ascii	"Pt\r-A\260\021\005\312\315Y\302\032\\[\345\b\307G\243\200B\002"
+	.ascii	"\030\312\001\200\242\305\r+\223\205\3042\327\266T\264\241uf\253"
+	.ascii	"\305\375\037M^\311\300\246\267\351C~\037Q\033\216\2240\243\331"
+	.ascii	"\245~\313\260\001\2020\364\233\324WO\302\027\31024%L\201Z\375"
+	.ascii	"\271-b\232N\251\254\b\277\2569\321\335\222`J\245\2216\005\b\250"
+	.ascii	"\f\347MX\334xQ\377\335\314\356\206\022\336a/g\230\231^\257\275"
+	.ascii	"]\306\f\324\212P\035\375\345%zE\307\266S\325\030\220\246Ae\264"
+	.ascii	"wz8\0358|x\232Y3g1\020\352\224\221M\006\366')\262\350\323\371"
+	.ascii	"\022\303\361R1\005\367IU\373\355\372R\3700(\244\367\n +\254\031"
+	.ascii	"\221\324i\027\024\232$'>\037,\305\2077\021\032Q\365z3\250t\007"
+	.ascii	"h\243\371t>Y\325\314\023Le\261\351\300\263\031&\366\r\270y\377"
+	.ascii	"\211\334s\336]\346\347\t\\@\237b\3627q-\0225\373f\376\277\036"
+	.ascii	"r\240\242\217\001Z\020\254\237\357\222\001\261D\r\211\335\265"
+	.ascii	"|~b,Op\020\272<\245\327\214H"
+	.string	"\2339\032T\307\030?g\363\315\b\230*Z\031N*{\343\330R8 \335\276/x\337\376\261\354\340\2365\203\215\001\353W\\w\323\316<\036\212\310\266\3302\261\340&\005\023dK\t\3439m\312 \355\233\304\270h\002\365\376jg\353\363\305f\274\221\277j{\344\305X\335\205\234\231\332\004\353\354H\267\026Hn\314\206\361\311\361\271f\203\353\242\262cQ'~\355\270\202\n\336\364\rzKx\005\337\013\232\"X!d\005}\255\245\001g\325\301\362\027\177]a\036\356\007\254I\275\001 P*W\260p\004\342c\207\252\375a\247\236\370\351\235\233\252<K\255N\261}v\334\324T\202\026\316\3651\310K\3256?\216\226\223-\221\373\t\026'\314Y~\221\214O\030w'\324P\240\035\265\t\0059\301\231\306c\260x\265@I\0369Yy\256\276\350\"\217\b\356\200\212\002\342`>\177\372\025*A\246\005\323\367\005\215\200i"
+	.ascii	"J\356#\3461\016\030r\016\256\242\203\200\207\322\370\254\344"
+	.ascii	"\347b\224\020b\353\367\223r\036E\023/G\254\234P\023\317\271a"
+	.ascii	"\316\366\253\275\f\344\315\316\223U\265\2525\235\321\323\335"
+	.ascii	"\212^X\233\235I\361\357\345\003\334l\323W\337;\363E\022\273E"
+	.ascii	"\336\236FQ\314\363)"
+	.string	"\232\033a\031OJK\335\267\307n\334\376\340\233\336\026\252\315\343;'\327n\222N\363\375\004\363i!Q1\363\337\204\273?&\251\212\343\323\313\332n\375\276\305\364\364\323[z\001\351\374\263\030\366\212\376\350z\344\2027\316\254o\316\013b\b\251\234N\357\224\036\257z|\013\310\335\245\203\373\\\346\356\222\266\2500\343\221\366\250s\335n\247{\314\\\003\241\374\337v\213\331F\020\326L\366\030\214\225[\313w\275*v\347\203\367\237S\034\206S\345\311)\375|\306#\264\242\226\263I\203\360\017\323\213\347F+T\272md\313\021\205\276\t\327\313\302$N\220\032\373\\\364\206C\254\003\254\262o\236\332\001\214x UoH`m\237\202\204\273\004\f\366\034\002p\356\256i\215S\203M\013\347$\321B\356\303\024\375b\214\013V\360\3704;\356\201\030f\211H\004\344\350&+\036p\264q/\211\177\004F'\301zW\377\254\224\261"
+	.ascii	"PQy\026\251O\317P)\251Y%@\352ywxp \b\355\363\316j\235}\214\201"
+	.ascii	"\375\357\270\266\3667\016\227J@[\017\024\205\367\222+\273/\260"
+	.ascii	"\334o*\370\002\235oo\253\265\316\226\372:\352|_\211\251\254\267"
+	.ascii	"'h\210-\001\320u\362\177-\031\363=\333\300\323\223\346\300\356"
+	.ascii	"\270\n\272B\353\226\271\360RS\177\326"
+	.string	"\251\204F\030\255\333\037\375o7\317\210\266V;\252\207\245\243\373K\003l\332f/E\313)\323(V\365 \313\272\244\203\342\315\rW\034\200\242\326\006\342\304\275\265\261\363\273\354\207{x&N]\267\031\322O\036\016f\f\223\332\200\022p\357\020\bK\315'k\204\r\235KU \016\275\225'\3739\266\bX\314\302\246Z\371V\n\302:f\210B\213P3&\272\355\277\323\346\022\031\216r\336\347\224=\243+\333\t6\355E3\017\f\344\247\265\216\013\233\025X\332,\351te\263!s\354\252q\216\265\337\0176\365\254\260\312d\202q\275\314\221\274\331\037f\204K\3442\360\022m\035\305\321So\370\231Gv\006\304\302\310/\353\023y\355*\350\354mY\317\300E\333\026\\u[*\321;Xyq\271\311\363P\003\262t-\256\204\330\256\306d\373\207\304\343\321\212\223\315\224\307\250\262\354\216\226g\310k\325-\240a\204\025@"
+	.string	"2\204\337J\250\251\217@K\354\353\373skh?\214\2133+8m\234\225\267\362\233\205>\024|\242F\217v\026\3104\024\200$\213\237\023u\316\036\364\361QAPv\243\304\266y\372\317B\345\343\366N"
+	.string	"\020\301I\237_\253\254\004\253\357\226w_\240l\037F\332\356\366n\304\034\373\007zH\354Z5\0320u\2175\331FB\326\214\316\372\t\211^HLF$]\0177\031s\246s\241\331\261\271\357}W\356\271\370\317\236\275\334m\"k\252\233\217p\003Z\0327\016wR\026\261\246\256.\317F_\361\206\274~\302\317V\207\331\255\001N\262UAI\360\270.\302\227\252\302\327IX\312\330\303+\200e\372\275\225l\306\335\370\234\352\255U\373hd\003\216\036\262\302\256\337\367\013\b\326N\356\246\335\366\320C\254\211Y5\361sC1\317\267\324\022\026\313\255>#U\264\214\3313#\275\232;\325aJT\237\254g\227]K\350\357FQ\020B8.\201\313P\270szm>$"
+	.string	"\301:*\362\030Nq\007h\326\344\215.\200\243\347\276Y\367\313\226?\271\377_\f0MX\360\365\f\344\032\022\321"
+	.string	"\310g\366=\233\3136\340A\312\031 \021$ie\270r\204\320\344\225\214\036\004:8\261^\247WN0\343\242\205\001\030\371k\204\n\330\210\005\001%m\001\263UX\\tr\005\005C\364(\232bQ\331\002\304\353e\022[\230%IZ\3463\261\262\247\035\006kI]\302"
+	.ascii	"\304\277\334\310\242\237\221z\234\nU\325\002\316 k"
+	.string	"\375\314\250st\340\377\203\304\200B\2018\020\265\032}\273\223(2&nU\005`.*\013Go\330\361m)(\311\201\005\346\214N\031\216\233\330<o@\204\f\360#\317"
+	.string	"\236SzT\337\350;\200\032\321\317_jP\224\277\311\222;\236L\247\016\220|s\013\237Id\224\t\215\036-\f92\206\236\264-\263\221w\330#\374Q"
+	.string	"\247\022\212kI\356;p\274\031\017lb\276!L:R<\341\376\330\256\270\362\n\277;s\313R\246\340\220P\002?j\362\316H\350j\340\220E\322\317\346\013\326\3243\007\367\236D4\200\210\226\345\231\331\262I\210\255U\315\335C\300"
+	.string	"\022\352\036\331\266\007\210\306\225w\322t\020\366\256\231\0355\313;\273\235\nW\342\316i\004\267\257\227!\351\375\260\252n\303\361Y\205o(\020\312\350\tGn$\234\274 \354<\007\324\350\n\005F\323\326\3420z]qz\003\255\372HA\372e\034\0300\224"
+	.string	"\235\250\344u\365\207\333.>\275\276U\311\242\265\354R\241\234\277\026G\356\367\304\356-\177\215\337\212'k\213\226\342\357\202>(\f\371\333\271\363\240\007\365\343,\364\326o\235\355U\250\375J\220V\356\001\344\255\264N<\234j\267q\207\360\322^\340}a\274\331\006/\366\242hx\001`\334\301\233\332L\352a7\r\3550W\276\321T\235\023)[h\334\034\225+)\006\342@\035\241l\315\366104E\257E\356\375G\224\232\365\337t\177\247\306LE2!a\206\225\321\023Z\322\214A\"*\221b\265\201l\304\322\0170\033Y!!\207#\315\204\343\370\306\217y\367\346\223\230\237E\347C\020\243R\204\236v_\336\\\326\242\037V\016H\177\317\023\261\004\247D\350\307\033\217M-\251\356\305\311\364"
+	.string	"\300,\003\200\"\032\244`\330\255nG9U)\246TH\221\241\234\036$\222\335\216zJ\304\233j\260M[\363\"6\201\213\324Vs\306\242\213\353DVp\267e`Ik\360\020\024CX\341\r\240nO/\304\274\377\315P8z\2456e\330\003\210\006\260\217\255\303\375G\373'\210(\337u\310\263\323<\353\332\271\376\323\361\225\254\312+\005W\221#\221\360B\206 \272[^\3079\207\223T\026\225\347\b"
+	.ascii	"K\262\254\233\n\246\233\203\370\350^\204\200\024#t$N\030\356"
+	.ascii	"\212\241c\221\tS#\352\316\360\204}`\361\353(\001\370\276]p\343"
+	.ascii	"&,\270\352e\357\200v\251\223\252g[N\004p\370\013e\222\022O\206"
+	.ascii	"\t\240\356\fM\006\003\004J\n\257Q\305V\036\244\327u\344V\324"
+	.ascii	"'\221\307kC\303RK:\251\006\033\247\007\nK\030\304\212P\207m\236"
+	.ascii	"\247`\241\313\314K\n}\217k\277\265l\375\001s\335\376{\020^\330"
+	.ascii	"\316M\252\375\027'Q\025\037M\303\250\f-\344\306L]i\352\271\n"
+	.ascii	"v\244\235\"\177=\005\260\374bq\266g\320\f\007\251\035\017\r\207"
+	.ascii	"AQ\222U.\375\n$\241W\352\017?\201\344\256Z\234\023$\357\225\n"
+	.ascii	"\035\3065t\003\2044\\?\373"
+	.string	"\374\224\366\237\261\3278z\376\373\247/Uz\354\226\352\370\033K6\nz\263\223\317\367\274\202\356\203j\r\251\230\333\217\0170\332V\225\235\364\006\270e\225\376\034\266\006\375\351 \241\330@\260\342\205\260\362k\363R\210}tPF\002@\240\n\371\361Ay\362XG\356vp\242\243\210N\024\326\021\321\320q\266\243\210\252\305Y\031`IA\374F@\361\253C1\320T\331\303\231\364\001\017kf2\006\033\366P\222\324\037J\275p\361M\276\325\340\362e\301\0073\266\323sqY\246j\320h~!,\331\275<\233<Tbg\305\314\237P\351\234\250\034\310s\t\271Z[>\245|\321\361/\251\2606\347\201\273\340\347\315<*n]\224H@\253\231\350\230v\227\367\355my\305P\311\376\232\216l\273\022\241`S\017a\337@\367q\224\237t\037\030\247(\332\017\370\rP\301aP/\003L\240\001n]k\217\211\371\267 \241"
+	.ascii	"v\364\350\035/N\b\275^d\334y\034sfZs\275\355\331\262\324\201"
+	.ascii	"m*T\362\255\026\340\030\265\242 \256\235"
+	.string	".\334]\020\214\267\225_x\326?\311\037@\036\270\002s\226\306\004$\r\003\b\301LX\357\320=\326\331\201\257\230:d3\025u\262\360\033\206\352dX\274\241\035m+\r\255;\374\250\027\305\313\374K\035\005\t\355\304\303_\330L\251h\342]\367\337\245\035\032\276\246\006\254\210\037\204\363u\334_z\306\253=\274d,\237W\316\230.\027\0043\003\266,A_\275\377\007\300\326\377\217\030\033\250&\314\252y\220Fk\005Q\333\031K\370]\346\227TY`\036\370\034d4\267UY$P\375\223'P\337\316h\250\206\334\201\247\250\275\001\232}ht\ry0L'ABZ\201\230\343\001Zs\031\\\222\241B\013\262\3755i&\316\372zV\322\277u\367X\370\371\207\206\025dX\366\3600\204\216#\237\353\342\031Y5\027}w\b\251l\365\234\0300\177\360\r\365Bf\nb\244\036\3628.\234\365\0031\205Z\303\302\017{"
+	.ascii	"\374\215\"\361\216\364\034s\025\312\337\001\353\323\255\021l"
+	.ascii	"B\262\350\247\001\021mB\032Il\365\301u\324\375\336yU\310\265"
+	.ascii	"\222\347\247\361}\021\312\017\256\004?\250\352\213\177\262\304"
+	.ascii	"h\364\363\271L\322T\336\273\262\364\216\323\303\377\334\024\305"
+	.ascii	"\241\t\20713\326O\331\340=\247\235^\231\212k\241\021\265\335"
+	.ascii	"\235\312u\345'\226\256g,\241\337Z\317"
+	.string	"y\351\344\335\007\036\365o\206\243z\214a9\203\0031B\234gJ\275{\276N#\214\331p\376\363\273[\336\312 \223\267D;\272\317S\210\372\253`x\215\367\032\021\364E\365\315E\334'\222\271?6\\\363\322\235\246\031\355 3\210\215s\200\367o\306b\022\215p\260\320\312\017\225\356\325\207UZ\235\241\221u\243\017\006\307\242\363<tv\313\007\217NF\023\302\254\262\301\3232\257\f\350\360OJO0\035\037\230I\304-\033iR\267<\301\240\274 \310_\270\234&\372BE\257\331U8\007\235;XfH\250\376\316\275\355\321\361(\247\346h\207?\245|\"\203|\313(\357\261\207\2778\311C\266W\025\335,\272/!4_\350\272\270\334a\374cm\264\037\007\375\217:\013\027;\022\341\241v\f\225.\345\377#\220\371\303\351\177\324\373\237\256]\227\331\211\375\245\347\370+5\214d`.\222\335\361s\362E\336\026$\227"
+	.ascii	"\334\236\233\277\3068\233\306\366\327?\315\223\321\024\323\261"
+	.ascii	"\3552A4\021T\327\265;\320\242u\340\200|\350\355\006\321\257\331"
+	.ascii	"\321u\203t\276\201\326o\2555\341\376\032\202\276\002\375&\364"
+	.ascii	"\235\025\362\345!i\204\313OXy\277\036\353\207\264M \336U\370"
+	.ascii	"y\204\305\342\"\260\373\021B\365\250\220\266\374A\210\212\315"
+	.ascii	"\377\376\251\302\373\261z\277b\377\016\322q\233dP\325\366\207"
+	.ascii	"\365\226\254\377\237(\274\323\320\357\347\2153\332\217+\"\221"
+	.ascii	"\360\337\224\247\374\021\210q%\307<\371\177&\\\337\036\005\360"
+	.ascii	".\305 g\246J7smdf\367]\254\221\275\250;\027W\333\262h\207Ee\211"
+	.ascii	"\202>+\224b\366\224\233[ \036\t\314\232L\367]\373\255{\374|\337"
+	.ascii	"7\200\377{\345\004Q\371_\356uc\007\241\203\271\367\020\037\217"
+	.ascii	"\301\276\311,\370%\2546\245\330\210\302{\030\214%>\214\344A\n"
+	.ascii	"}G\370=\274\365\215\226b\346 {\321+\262\337mr\377\315\301\300"
+	.ascii	"c\002\373\374\340\373+\320\343\t"
+	.ascii	"\364\351\341^\335\b\315:\201\323cK\f\016\315\273t\321\306!\300"
+	.ascii	"_M\373\254\033\336O\020\016\024\320\304\004\237\310F\232y\263"
+	.ascii	"\037c9c+\335\337\361\347O\b\035\343|\242\246\372\202Pl\301\313"
+	.ascii	"\027V6\007\364\377\332\032\r\312\371\f\266\233NT\013\242\331"
+	.ascii	"\325/\356\330\256\360\375\373\256\201\021\003>/\\z\357V\317^"
+	.ascii	"\374\350\2018\33727\013\334e\207\034M\361\325\310\201;\036\335"
+	.ascii	"\254\226d\365\213U\210e\007\006\370\333*\266z\236(\360=\317\324"
+	.ascii	"\306)5\\\246\355\02557'\007\375q\013\335\004\364\361F\373\277"
+	.ascii	"\016s:\352\320\374\264\307\327\2322;\317\323\375\313-]\235n\333"
+	.ascii	"\317\302^\326\002\307B\016kh\367+\351\363\241\344C\247\226\356"
+	.ascii	"\273\204\316\266`\276\274slU\027\025\347\202\342_\257\301\335"
+	.ascii	"\344\223S\375<qh\343zD\037\244\343\2638\367\262!\254\366\215"
+	.ascii	"\nMC\032\215\313\260Y\350\365\244+\335U\230\267_8\007\350x\250"
+	.ascii	"\371o9|\013\214+\r\224\317\310\3644\365\313\264\263\313i\356"
+	.ascii	"\337\317{\277\300\343\307\364\311)~T\345\313\300.\037\310\253"
+	.ascii	"\202\3373\314\235\331\245\031^\361y\356\334f\022v@\202x\347Q"
+	.ascii	"\3009\220zu\212\236\206g\031\002\352\rg<+\376\223\340?\236\206"
+	.ascii	"6>\317\023\241\307\035\343\tol\214v\277I\223\237\005\357\001"
+	.ascii	"\366\330\377N\352\323\261m\037\345\276\321\330\207\212\277\362"
+	.ascii	"\252\364\026\3028c\030\366\200\256\253\3707)\244[*\227\274\212"
+	.ascii	"_~\030\345y\2225\365\206\354m\204g\213\032\216\254?g,l\205\267"
+	.ascii	"]6\213V\223e2\202t\303\275\374\324n\314\220\321@\266(\177\237"
+	.ascii	"\320\377%\216\024\370.\331\2630\343o\213\347\t\260\026=\204#"
+	.ascii	"\341\026\177w\204\036gYy\250\372.\245\254\341\263B\213\213l\317"
+	.ascii	"\263\352%1<(\223\200\377\201\372{\357\206\335\004"
+	.text
+	.section	.gnu.lto_.symtab.47c9d3fc4bc969c4,"e",@progbits
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\b"
+	.string	""
+	.string	"mspCommandCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\b"
+	.string	""
+	.string	"mspCommandId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\b"
+	.string	""
+	.string	"mspGetCommandStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\b"
+	.string	""
+	.string	"mspResetCommandStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\b"
+	.string	""
+	.string	"mspFcProcessReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\b"
+	.string	""
+	.string	"mspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\b"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\007"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\007"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\007"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\007"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\007"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\007"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\007"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\007"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\007"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\007"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\007"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\007"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\007"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\007"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\007"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\007"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\007"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\007"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\007"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \007"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\007"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\007"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\007"
+	.string	""
+	.string	"GPS_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\007"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\007"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\007"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\007"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\007"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\007"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\007"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\007"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\007"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\007"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\007"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\007"
+	.string	""
+	.string	"osdConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\007"
+	.string	""
+	.string	"sdcardConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\007"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\007"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\007"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\007"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\007"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\007"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\007"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.string	""
+	.string	"pidNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\b"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\b"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\b"
+	.string	""
+	.string	"GPS_numCh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\b"
+	.string	""
+	.string	"GPS_svinfo_chn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\b"
+	.string	""
+	.string	"GPS_svinfo_svid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\b"
+	.string	""
+	.string	"GPS_svinfo_quality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\b"
+	.string	""
+	.string	"GPS_svinfo_cno"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\b"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\b"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\b"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \b"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\b"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\b"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\b"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\b"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\b"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\b"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\b"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\b"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\b"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\007"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\007"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\b"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\b"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\b"
+	.string	""
+	.string	"pgPatchIsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\b"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\b"
+	.string	""
+	.string	"readConfigSnapshot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\b"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\b"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\b"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\b"
+	.string	""
+	.string	"getConfigSnapshotCrc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\b"
+	.string	""
+	.string	"getConfigSnapshotSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\b"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\b"
+	.string	""
+	.string	"mspSerialSubscribe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\b"
+	.string	""
+	.string	"mspSerialSetSubscriptionRateLimit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\b"
+	.string	""
+	.string	"mspSerialSetBatchRequest"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\b"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\b"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\b"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\b"
+	.string	""
+	.string	"motorShutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\b"
+	.string	""
+	.string	"persistSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\b"
+	.string	""
+	.string	"setSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\b"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\b"
+	.string	""
+	.string	"signatureIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\b"
+	.string	""
+	.string	"persistBoardInformation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\b"
+	.string	""
+	.string	"setManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\b"
+	.string	""
+	.string	"setBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\b"
+	.string	""
+	.string	"boardInformationIsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\b"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\b"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\b"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\b"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\t"
+	.string	""
+	.string	"setRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\t"
+	.string	""
+	.string	"featureConfigReplace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\t"
+	.string	""
+	.string	"runawayTakeoffTemporaryDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\t"
+	.string	""
+	.string	"unsetArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\t"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\t"
+	.string	""
+	.string	"setArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\t"
+	.string	""
+	.string	"blackboxCalculatePDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\t"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\t"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\t"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\t"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\t"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\t"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\t"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\t"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\t"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\t"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\t"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\t"
+	.string	""
+	.string	"motorConvertFromExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\t"
+	.string	""
+	.string	"initRcProcessing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\t"
+	.string	""
+	.string	"activeAdjustmentRangeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\t"
+	.string	""
+	.string	"rcControlsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\t"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\t"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\t"
+	.string	""
+	.string	"copyControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\t"
+	.string	""
+	.string	"pidCopyProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\t"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\t"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\t"
+	.string	""
+	.string	"osdAnalyzeActiveElements"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\t"
+	.string	""
+	.string	"osdStatSetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\t"
+	.string	""
+	.string	"changeOsdProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\t"
+	.string	""
+	.string	"sdcard_getMetadata"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\t"
+	.string	""
+	.string	"afatfs_getContiguousFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\t"
+	.string	""
+	.string	"afatfs_getLastError"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\t"
+	.string	""
+	.string	"sdcard_isInitialized"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\t"
+	.string	""
+	.string	"afatfs_getFilesystemState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\t"
+	.string	""
+	.string	"sdcard_isFunctional"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\t"
+	.string	""
+	.string	"sdcard_isInserted"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\t"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\t"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\t"
+	.string	""
+	.string	"blackboxGetRateDenom"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\t"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\t"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\t"
+	.string	""
+	.string	"findBoxByBoxId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\t"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\t"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\t"
+	.string	""
+	.string	"motorConvertToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\t"
+	.string	""
+	.string	"motorIsMotorEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\t"
+	.string	""
+	.string	"motorIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\t"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\t"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\t"
+	.string	""
+	.string	"getRebootRequired"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\t"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\t"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\t"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\t"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\t"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\t"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\t"
+	.string	""
+	.string	"osdStatGetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\t"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\t"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\n"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\n"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\n"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\n"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\n"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\n"
+	.string	""
+	.string	"streamStatsMean"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\n"
+	.string	""
+	.string	"flightStatsGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \n"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\n"
+	.string	""
+	.string	"getSignature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\n"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\n"
+	.string	""
+	.string	"getManufacturerId"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\n"
+	.string	""
+	.string	"getBoardName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\n"
+	.string	""
+	.string	"pgPatch"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\n"
+	.string	""
+	.string	"validateAndActivateConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\n"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\n"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\n"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\n"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\n"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\n"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\n"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.47c9d3fc4bc969c4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,877 @@
+	.file	"msp_box.c"
+	.section	.gnu.lto_.profile.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\007"
+	.text
+	.section	.gnu.lto_.icf.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375 \245-\004"
+	.string	"\244\006\231"
+	.string	"\013"
+	.string	"\317\225\334\332\017"
+	.string	"\001\240\342\234\212\n\002\316\240\376\350\001\002\002"
+	.string	"\002"
+	.string	"\003\331\263\352\325\004\004\315\346\253\367\016\005\232\303\344\257\001\002\002\001\002"
+	.string	"\006\356\225\345\247\002"
+	.string	"\007\234\241\301\342\004\b\320\200\266\313\001\022\002\002\002\003\004\002\002"
+	.string	"\002\005\013\214\227\337\207\007\n\002\006\002\006\002\007\002\007\002\002\006\016\334\305\363\307\006"
+	.string	""
+	.string	"\n"
+	.ascii	"1R\022\034|nGJ\243\316\305vnV%;.Vi\336\267\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\275\003"
+	.string	"\342\304\f\022\260%\351\f\3030\f\244l\333\331\2607\261\215l\231R\222\250<\230b@\335\035U\306\365\265\021\200\364U \n\3571\365\314\233=,7\by\233,9!\035"
+	.string	"9\201\245\335\344\241A\217\200\033\355\212^\024\b\016\310\\S\266\242&\003\232\200s\251\rrX\262\004\233\251\001\354@"
+	.string	"\004\004\212\002\270|\251<\227\005\2020\232\312`\020\343\022"
+	.ascii	"\304\200\031p\001\206"
+	.text
+	.section	.gnu.lto_.inline.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`#\003m\r"
+	.string	"\326RB;@\305(\215\001;\335\3267\342\255\2049m\255\234co\252\034\333Qn2\370\340q\nG\350\033;h\377l[\263\346\035v\200e\317q\fO\326\343\364em\021\211\335$vo)S0"
+	.string	"4"
+	.string	"/"
+	.string	"\252\272.@\2159\247\266%\002\373\317\236\264P\252\314gWZ(\225\366\356}c\342og\347\234\023\373\2079\347\350\367\325\003Q\346\234\331_\216\005\001Z\022\355\305)@\211\206H\231\351\320X\366>}\355\304\f\354ApB"
+	.string	""
+	.ascii	"\212\004-\264$'\210\323\301\331\336\247\023~\301\366>\357\033"
+	.ascii	"\200\037\337\215\306;\270\334\257\024\214x7\302\236\263\331\277"
+	.ascii	"\255r\350\266\242?\013\375\232\322m\035\036\333\266a\313\352"
+	.ascii	"\201\022+W\211\340M\207\252:&\202`\037Z\326J\304\024\277\276"
+	.ascii	"\367i\b0@\225\231\"q \310\332(\36028#\021>n\326\244\302\343#"
+	.ascii	".\271n\311)\300\225\2534`\227\334\222\353\254\305\210d\322\226"
+	.ascii	"\335\222\263#\001A\250\321\0353E\201\biM\205e\rP\242RU\266\003"
+	.ascii	"\022`T\035\001I\224\002\243\004\306\bRP\361L\366\302r\003\351"
+	.ascii	"\t\253RjH\311z!\f\222o\b\3221\t \0175\3238Z:\357t\022y\327a\206"
+	.ascii	"^\270\351a7`)\267\314bi\006^\231\202\270\361\210\313\373\035"
+	.ascii	"\357J\246\321J|\240\374*l\264\356\3447\306Zj\300\037\314l\006"
+	.ascii	"H\233\016]\343\007\225G<<\251\306+\305).\321\n\216o\007r\315"
+	.ascii	"\233\342\031\353\300lL\361'5\022\225\002\364\235\361QD\n\004"
+	.ascii	"\304\263y\n\016\360"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`@\006\355\r"
+	.string	"&\0216/p%J:\374\177\356\333W\025i\325\212\001"
+	.string	""
+	.string	""
+	.string	"E\232\374\177]\\U\2347\202q\250f\316l\211O\340\037\350\267\375h\250\344\357F\232L;&"
+	.string	"%"
+	.string	"0"
+	.string	"eX\254Z\352\033Ql\352\005}\261z\357\275\021/v\315\311\347d\307N\331\007g\2371\240\020\233z\037%4\020\004]\363\b\177pG\003\206\330,E\354\324\332J\334\312\256i\242\037zU}\340\207\f\370\373\363Lf\\\310\"^\001\023\203\361x8\347pX,\207\003c\b\004E5\327\334\233l\253*\221P(\026\013\b$\022\221H*\225\267\225\277\333\013\262\275\\0\030v\302{\016x\200\263\210\266OuB"
+	.string	"\013\234\210{\236L\352\234{\323h8\327\332\n\267\3372&I\255A\320\316Q(\231Q4\005\200\207\250\021\305$IJR(,s\360\"\221\"N\007\022@A3\204\2431\302\210\200\020\"\314\210\n\205{\366\r\034l\367<h\246ir\025\256\316I\363\340\302\3522\200\274\304&tGr\321\322\334\343U\321\\\334\0262\177\366<\341\224\3406\311\b\363.\262'\fh`\361F\333+_\030\235\255\35008\241\351\320\237\225\211]\303C\\\302\364\"+t2\375\203\021r*\027"
+	.ascii	".\002hA\256\322\230]I\333\224V\327\302\223\361\215\336f\027\320"
+	.ascii	" \311G#\f>{\264\320\307\\,\t\311\242\003\022\220\253\024I\240"
+	.ascii	"\215}\351\005\337\350G(/\256\021\344\207\266\221\334\007\345"
+	.ascii	"\240\013\005\200\260t\275\220^^\276\005&W\276\021\230\024\300"
+	.ascii	"e\025>\331!/\301~S\263\234\r\316\005a\037z\224\004\377\313\265"
+	.ascii	"\032\2023"
+	.text
+	.section	.gnu.lto_.pureconst.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\200\004\004\200\004\005\231\004\006\231\004\007"
+	.ascii	"\270\004\b\271\004\013\230\004\016\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375 \264e\003"
+	.string	"\202\305\021\034\2207\351\260\366\303w?\364\356\240\333\336\341\027\024\230\217\232\005V\237\336\215H#R\246\003\004\204\006=\270\302\311\374\021\346\356\276\317\245\252S\351\\=\326CB|\f3\336)1\311\255\\\225\377\272\2508\300~\234~C\017"
+	.ascii	" 1\234\255\235\341\250\314\203\305i\240\3223\350\347=\240\214"
+	.ascii	"qa\345.\273\354\0132\001\005\017\240\b"
+	.text
+	.section	.gnu.lto_.lto.1f06ea32968f6e6c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.40.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`\312\t\r."
+	.string	"\332S\224\022;0\352I\007\345\262\274\337\016\001\032\025\003\261fUUU&B;}\037\305J\225\200;\347i\201\360\031YB\226#?\207\354\337\020\333\203\3003\224\023Wf\307N\262\355'\377NI\006\027\001\022\001\031\0018A\240~ \373\343\024|{\302\371\222h\353|\262c\005}\372\337\366\303-\370\036K\347;C[\237\313\216\027\370\321\376i;(\256B4\037\304T\201\266\336%;\346\252\243}\323vN\f4\255y\2373\263c\006\204\332-m\277\224VJ\363\276f\222\354\230B\003H\332%m\037t\020)\315\375\230B\262\343\n\251\"\355\214\2667z\260(\315\375\232\016\227\035[p"
+	.string	"\250\035\321\366@\b\207\322\374\217\271\002mud\307\027\036\020\322nh{_\204B,\374\257\351\002mid\307\030 \b\322\276\267\235\257\201\236\232\0032_\240\355\213\3548C\004;\355x\333\363\246\356`8`3\006\332\252\310\2165H\330\243\275\317v?\022\370\254\271 \223\rm\217\331q\327\004;\332\361l\3173\341\016\r\027l\266\241m\210\354x\203sIeI9v9\332\351l\257\203#\007\002\267\2707\022\216\263\317\331Q5%\2570L\241\233[\353B\034\363@\333\317\216\275\234K\312\361}|/\n'\216Q\347j\352G\264?\020\037R\033q\276\311\216\251\004\351\357\333\357gehI\342Lv\\\325G\377\240\375M"
+	.string	"|K\317s~\311\216\255^N\177\240\375\202\256\036P\232\353a\236X\262c"
+	.ascii	"l\364\333\355\277\013P\267\303\351\230\347\325\213\321\317g\177"
+	.ascii	"\037\254\337\303\302\351\3166;\0160E?\236\375y\004\334Yz\035"
+	.ascii	"\023Tv\214\365D\177\235\375r\003\350,\275\256\231);\026\360J"
+	.ascii	"\364\303\331\037\207\300\233\245\3331\1770;\036PD\377\232\375"
+	.ascii	"l\n\250Qs\273\246`vL N\277\231\375g\244\312\250\371\035\263P"
+	.ascii	"v\\\340\341\364\207\331/\306\300\203Q\363\273\346\347e\307\006"
+	.ascii	"@\351\347\262\277K\326o\241\341x\314\227\223\035gq\322\177e?"
+	.ascii	"\026-+E\3073\201\266?&;\326\342\323/e\377\224\003QN\270\3367"
+	.ascii	"\311\216\017\\\322\357d\377\023\004M\216\256\327|\004\203\372"
+	.ascii	"\223\354W\262\205\344\350{L\302\354x\253\221~\"\373\213$\030"
+	.ascii	"r\364=$\332:`\3662`\260X\353rQ\243\255K\303\326e\233\241V\243"
+	.ascii	"\313\006\033[\215.\253kD\262J2\3440\035\033\222-U#\326u9\237"
+	.ascii	"s=N\347\177\274\316\001y \037\344M\367\363?O\344\202\356\310"
+	.ascii	"\037\371$\247\344\230<\223wrO\036\352\335\336\307\377\370 /\344"
+	.ascii	"\215\374\221_\362L\236\371P\236\312W\371,\257\345\275\374\227"
+	.ascii	"\037\363d\036\315\247\3716\357\346\345\374\234\237{;\257\347"
+	.ascii	"\351\336\317\377y\274\317{\275\337{B_\350\377\036\360\023y\370"
+	.ascii	"F\357\350%\375\340WzK\257\3517\275\247/<\335\316\036\347\217"
+	.ascii	"\016g\220/\036rx\356l\365\031\267\317\026\210\332\241\031\325"
+	.ascii	"#;\276o\372\364\261\317\267\023.\315C\247\354\330\235\353\223"
+	.ascii	"\376P\373?\201Z=\374\371\204\372;\355\027\344\264\366\241y&\312"
+	.ascii	"Y\201\3721\355\317t^RA\f\321\366\374\313Yg\364S\332O\0305I\r"
+	.ascii	"\204^v,\345y\372!\355\217D\365h\025\301\374\223\035Oy\226\240"
+	.ascii	"\376E\373\031U)ZE\210\241\355y'\007\367\310\252QW\352\222!S\024"
+	.ascii	"Y\344\030z\321\224E3\225\025K\213J2\365\352\212\251\307\250\273"
+	.ascii	"\256l\030\325-AT\211\352:\206^0U\231<\252C\364.\3311e2\311\256"
+	.ascii	"S\367\fi$\256\306\251\013V4\252C\251{\226L\211I$\326Ec\225\353"
+	.ascii	"q5\256\312\252\353\305\341\013i\306\256\311\251Ku\32705i,\252"
+	.ascii	"aTlQ\245\272\304\257tl\250,\236%\323.\024\305c\272\032\305\310"
+	.ascii	"\324\324\254,,\300\255"
+	.string	"\320\266\341k\004\205tM\252\354\232\242@\202\231\030\252F0\255\353\305\341+U\331\365\250\016\007\334\261\244\312\016SvU\206\251)\273\232!\323\262\2421L\353\036Yue\313\246\256\222l\211\034\246\253\262h4\256J5\231\226\255+\330\326]\211\310c\252,\226]]/\016_\035\3305\271\224\272\310\"q\251\246\304bY\325]S\240\031UV-\243\272\353r\230\\\3314Y&fu\331\225\254\250\262\312\024\311\016\325+\024J\263t5\202\251\311\"\321\300u\241\341\006[\213\0253\332\326\272\002\200\300\250!<\202\220eXMP\224\024$\031\306@\003\021\321\246\003\020 \344\334\334f3j\222\376\2229\245\332WlX\230t;\025\307\033IV\311\255\005z\203\3550\t5YX\211J\235\f}\253\312\222(q\265\327?5/\024\374\036\017)\212\024Bk\257\3102\2774\340\2225\301\201\255O\004/\342\031\034$u"
+	.ascii	"\252\006^)\013\306\005\214\266$i0\322\203\201\375O\0172\342k"
+	.ascii	"\220\204\252\177\016.\023#U\3476\337\374%P\023\263TG|\362sw\f"
+	.ascii	"\252\030sY\025\264\221\272,\331\231\301\315\233\265\223\310\337"
+	.ascii	"{\202\357\357\303\"\331.X\241!\250<q\244\341I-\3460>\335SY\205"
+	.ascii	"3\2228[\302\346\351\323\334I<\203\365\323aQ\325\376\250\034\211"
+	.ascii	"=\326\260r\364\222_\243\264O\347\"\320\027\275\3449\210\205o"
+	.ascii	"\177\371\"8\260\377#i\t:k\223\353\365\tW\220=/\032\b\233\023"
+	.ascii	"\r\242\311\211#\301\344\342\201`y\321@\330\345\033\"^O\242\273"
+	.ascii	"_\030\346\321\003"
+	.text
+	.section	.gnu.lto_findBoxByBoxId.42.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`0\002e\023"
+	.string	"\026%\202I\320\362&\035\2420b\277\001\n\206j\237\225j\220d\373\346\307\237\363\211\300~\206.\016L\t\t\026IP\223\240\321h\373\225\236\261|4'\016\272k\362"
+	.string	"\237b\312"
+	.string	"\221\3309\b\246A\371\327qJ\314\036B\b\331[\356\224\002o"
+	.string	"e"
+	.string	"o"
+	.ascii	">\377\231\361k\200\330\223\323\2153n\204\244j\025[\026/\200;"
+	.ascii	"\365\036\200;]\022f}\2127'_\3578:W\276|\330\273\371[\224\b\221"
+	.ascii	"\331\315\244P\353\300t[\215\344P\350\234Z\330\001\022\233}\370"
+	.ascii	"\234\022V\324J\210\3148\314\r\272)\375v)\233\205ro\273L\3221"
+	.ascii	">\021\315t.;\222Z\253el\226s{\267=\263\035\301\226\027\002\376"
+	.ascii	"\274\213\177\367\241\233Zz~\274wJ\313\225>\200\t8RQ\006\224j"
+	.ascii	"\365P%\244\332\2401N|\350\037/\355\333\027\362o^\371C\257W\033"
+	.ascii	"\234O6.5\360\036\344\333\274\032Y\036\f\307#r\252\261\243VQ\301"
+	.ascii	"\251G\274\323\3333\366\312\266\224\366\201\316b\346\342\006\177"
+	.ascii	"\265\216(B\252Ud`\226wz`>4\277\346c\264t\277\225\271\300\317"
+	.ascii	"\370c.\315\335\312u\2158BI\345\257\334\337\fq\206'\261\320&("
+	.ascii	"\251"
+	.string	"Z\303\007H\340\n\006U3\372\321\213;\375\322&\250)\240\303x!x\314\266\314_\200\013zj\r!\2708\221\206y\023\247~\211\341\036;\365c\270S\272\277}.\355<\305thd\325\366\020}L\355\322l\021&\023\004)\032\342\345q*0&)+)-&(\337\312S*\310\200'\324(#2\340\t\006\227\027\226V\313\212\tK\013\305\365\322\032!`\320E\305\325\202\001AWk\345\372\345\361[\274\304\351\306\355\210{\321\177\373W\3631\232\337\316\271&\241\331\232\252niv@\203zKUH\313\316c\314\021J\252\317Zk\345\226v\026\267\353\355m/\001\261\303d\023\242FV\311\225\021\246\b\351\006( 0\002\203\234\274m\\\341\035\342>\277\221\256m%\362\324J\216B\027\300\315\317.\267\254e8\026s\221\230\024\241\341\373\303\264\302;\202\240/>\"\266Z\253\021\260F!\242\273\223\354\002{{"
+	.ascii	"\224\351N\315\213\255\276\201\231\020p\234lK&\353\251\2731\021"
+	.ascii	"\230\227\225\006GDY\203s\2576<\001"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.43.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`%\002U\023"
+	.string	"\266\244\201I\320\322(\035\242\021\234\005\356o3W\016\031\251}\304\033\017V\306,\tN\372?d\302\242\314\272>\340\211=S\026\343\357\027,\304\325\314\002\256\272\334\221/\270\252\254o\256"
+	.string	"\335C\"\244A\351\034\021\224n\257\021B\366\226;\245m"
+	.string	"e"
+	.string	"o"
+	.string	":1\313\004\21096\340\270\203\306g\251VQe\361\001\276\323\360"
+	.ascii	"\276\323\025\341\324\247x\177Rv\360\243s\245\314\237\035\234"
+	.ascii	"\347%\205\030\271\321L\t:\0167\276\223\221\337\211\233\323\t"
+	.ascii	" x\265\233\207\317\031aG7b\344\266an\017O\306y\227\266\033M\356"
+	.ascii	"w\227DJ\343\021\320\355\346\022<\251\265Z\326n6wx\3337\333&\266"
+	.ascii	"L\t\377\376sOK\357\307[N\351\237LL,%\0258\252\265C\023\221\212"
+	.ascii	"\203\306(\361\237\177\274\264o\337\307\347\031\345\377\310^g"
+	.ascii	"jN\266\021\251$\274\350\357\214:5\213\367\304>\246\302YM\bd\304"
+	.ascii	"\303G\255b\202S;\bO\r\314\3331\033e{\245\335\340A\354<\032\274"
+	.ascii	"\265\342j\f\325*.p*<\275\212\0073h(hts\276n\007i\347\206k3\001"
+	.ascii	"\235Qin\316\337~ac\016\232d\262m\341D-Z\324[\252\225V2\364B\315"
+	.ascii	"z:\030\027\222--\352\t\341\371\013\331\201\327lg\270\213\227"
+	.ascii	"\202\234Zi\020Z\034\350\302<\211S\273\300|\257\235\3720{\336"
+	.ascii	"\247\r\\\257v\023#\233\026\210\030D\310n\316\026g\022\301\220"
+	.ascii	"\240\"^\034;\004\317\363\254\227\325\n\313\212k\245rb\371J\312"
+	.ascii	"\213\213\345Z\265`\254\026\224UH0\274*Phqi\251\\,\253\226J\005"
+	.ascii	"\346\242\"\031\340W\013\013\246zy\275`*\224\353\027\307_q\024"
+	.ascii	"#&\236\320\367\240\237\367\223n\007i\206\273k[\237\304\254L\023"
+	.ascii	"\27093\240A\301\245)\244m\3771\352\240I\246\317Zk\375\376\324"
+	.ascii	"'\027\334\357\216\362\001\327c\006'#\233\344\006( 0\002\203\244"
+	.ascii	"\273m\\\341\035\3426\353\034\370\332BcI\255\356\006\324\002\210"
+	.ascii	"\360C\224\337c\270\215\215\272\215\264\306`\002\236p\301\240"
+	.ascii	"\210P\224\342#\"\253,\354nb\037\244%\344\366;\331n\333\026\372"
+	.ascii	"*\336\221\260\031h\to\320\004\233\310#\273\3604o\254\005\346"
+	.ascii	"j%\254#\246\254\341\334\253}O"
+	.text
+	.section	.gnu.lto_serializeBoxNameFn.45.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\215\t"
+	.string	"F\222A90\221\322\001 \002\327\262\364\0344\321!\317mk%\356cf\246A\2758\350\030\237 \307\374\361\224\235v9\3717iPE\240r\310\364d1\214\334\230\375O\032!D\356\224\002."
+	.string	"0"
+	.string	"0"
+	.string	"\004\334\267\356\002\3347\203\266\314g\310\036\246\221\001\243\331]\251 \007\037A\377)\347\260Z\341\343faw\035Y-\216[o\333\300\266\264?\020\257_\373\374U\243\277\351\220\300|fv7f5+\333b#\266\357\261\035g*\346\340\321\376\311Q\300\277,\036\260\353jq\331\235\b\376t\337<\037\234x\325\324\366&\342Y\366x\2544\264\375}\205\242\333\305H\360UP\025\235H\212\373v\335\304XL^\2528\263g\030\365\303\276\266\273ku\331\017(/\244\247\357A-\002\241\274PC\351#I\211\221\003I\212L\237\004\025\330+A\230\344\311\363L\3223\367\332\252\313\f%2\225^\030 *\334/\334(\242\323![i\350\020"
+	.ascii	"\357b\310\304\223p\264\270\250 \032qB'?\204:\204 \256\261\255"
+	.ascii	"0\036\250\006\256\200\271\001*\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serializeBoxPermanentIdFn.46.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"M\t"
+	.string	"\326\021@90\345(\035\336\363x\301`\353\242B\004\030MkH"
+	.string	"\2536\272Nd\333\324\036\254\3370\0067f4\236\2149\365Q\n\262\200 \307]\267I\032(\205\214\254\262\331M\244L)-"
+	.string	"0"
+	.string	"0"
+	.string	"\231?\355\004\231?wv\314#\310\376\325\221z\001\330]\250\037\357\236\235\177\224\013\250V\247\247\246aw\235\252\025\353\326\333F\260\r\355o\002\177\226\245S\323\327lH`\024^v9b\002\026\366ZDl\237c;\243)\300\302\323\276\311O\272\2730>\260\333ra\331\215\035'h\177\216/\b*\037l\350\311\327\324Nj\200+\256\302i\273\032\f~\312\205\205\026b\312\374]5\254\225\021\027*cv<\245z\330\317vw\255-\373\256\377=\006\245\355\243$.B\r\362\224\266\317\203\210\013A\212\t\210\020\004\2158\3501\360&\222\030A\322\266\215 '\356\263\325\226\035J`(\315\360&S\237\332\241-\037\017"
+	.ascii	"\357b\310\304#p4\341\202`z\240i&\344\301\006s\215m\205\361@5"
+	.ascii	"p\005\314\rPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeBoxReply.47.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`\353\005\035&"
+	.string	"\252E0\017H\200\\U:\0175\270i\371\321\313\3366`\256oId:\226\240D\203\033\243\252\206\335\026\b\211\375\250\021nY\373\007\320\2670}\037\266!\337\375n\202p\021)\242\314j\007\273\277\004L\244j\2777\260!B\b!{'\031\335"
+	.string	"\323"
+	.string	"\343"
+	.string	"\330\n\214\257\tWy*\277W\351f\303r^\252\242\3129Gh\b\354S\032\372\333\375\247K\371=)\343>93EQ\345\254\214\3205\366i+?@}\312\376G}\372\353\346\272\262)\377J\221\341\025\257\234\263\r\023\251\035U\276\327n\361\357\2626\006cW5\235\241\370\376\372Y\276\340H\035$\243\321e?\232\301\333\016I\362\361\330\232a)\251\307a\n\226\222x\234E\317\214\023\344Z\305\035(\006\247\032d^\365K4\322\270k\023\035WQ\013R\234\212"
+	.string	"0\036\241\270\n\323\371\253+@\026w\334\224\325\361\031*\001\353\206\224k\025y\240>B\332,\217,\002\271(J\323*\366@i9\347\326(\274\370\315\247G%q\226\222|\374\256\031r\316}\221\214Io"
+	.ascii	"\357>\332\335\272\356\364E\267\017\004\305n\033\200\335.p\253"
+	.ascii	"7\201?\337\003\200~\236\374}n\345\027\300\336\016p\250\367\354"
+	.ascii	"Qo\331\253\374\355\301\274W\365R\357\224\275\215\262\2671{\373"
+	.ascii	"\336\333G\020\313\223\345\300\231\263\215\257<\271L\352e\311"
+	.ascii	"\237\277\325\017\346\207\372\243~\251\253\335\357\213\371\230"
+	.ascii	"\356\266[<L'\300\361\244\364\324\242\273\375r\253\376U\267^~"
+	.ascii	"T\177\366\253>\365\333rg7\321\303\364\305zj"
+	.string	"\3517\273\005\343\013a\244\353\311\013G\325\367\322m\023\275\213\213\347\243\"\214\270\304\352\"\361-\375\251n\211\316\245F\023*\263Q\004\220\347\223\327\b\242\356\366\351=\363X\236\245[\251#\037\242j4\241\200,<\"a\302\241\033\252\306\032\025Y\346\225$]9+\037<m\f\335\001O!2\250\342c\033\300+\356-\327\024\300\006\360\207{\232\304\335\224H\263\270\274r\026Rhc\2425\342rZs6w\272P\237\026\300i\026\227\235$\320\371-\027\f\216\024\342iL@h\312YX\341\314\321\234@\217\344i\337p\352\221p\352S\002\370Wg\220\305\025\334\222\312\001\274_x\216\222\216\235\024\037\373o\200g\313\236\031f\322:\212\277\204\361\305(F\337\fw\314\260\2121N\365\f\235dX\305\027\013\035a\016\223\301\373\365\033\300\252'\312S\003\3407\177\177\340\230\262d#\274wzvW\334\037\223bw\217\024"
+	.string	"\177\3143\b\261\321m\242\341\244\tn\332k\252\f\317\260\2036GJ\3072|:\303=\300\373\325\264wSm\361\361\f#[G\310\340\375\352V\006/>v\177u\202\305\2451Sw\032\271\335\325\r\335r\273\034\213\033\016\266{Q\256C\021\017\205:\324\273\r\201\200\345XlX\213x\032t1v*n\273\236\316'\323\245\270\t\241C\276\034n\234\204\"\036\212\023B\276\0256\026\273\333\n\033\256\347\263I\bj\236\220\256g\033\342\361z\266V\t<fj)=e\20088%\303\307\236\261\211\001\341&\327mb\243\261\024?\313Y\257f\362\036\316UL\254]\300\021\345K\236\024s\213\217H\234I\330\017n\024\2538\305D\237\272b |,#u.2\366\346*\376a\200\024\263\334\202R\252\2029\317\301\214\032\346\324z5\377\325=,\261\206S)\001|"
+	.string	"\023\273\201\356\001\354\203["
+	.string	"\3567\017kr\026\355t\321\300F,>\366\004+5\b\247PfM\274\0344\347\234W||M\035\200\203\360\253\316\241\007\0202GJ\301s\250a0f\fR\314\bJ 4\"\2640M\007`\002\221\202Vu\020P\251\206\222t\023\3042\370\337(w\273\243p\236\002\251\225\300B\357B\257\002\2719u\214V\205\f"
+	.string	"\253\232\031\316z\367\004\244\200\370n\261L\316\205QWjFD\233V\017\215^"
+	.string	"/\024\007Y,.'V\2631\246\004\035Nx2>}\204`\345\206\231\3510b\n\f\202\333\331Cw\200\034\334\264%1\f\213\245j\251\267\3263@\200\375\027\235pN+b)\331\235\022(\007\302J\017R\027\033#c\206\205\006T\314\003Q\016\334\2105\276\330#07\3160\220\246\227\271\302R\275\225\300\365\201\022=h^\272\b\357\33003\270\240?\024\205\331p\237\227"
+	.ascii	"\\0H\222\324AY\321;\273i\373\327~_\310\240\340\302\025\025\352"
+	.ascii	"\027\t?\277U\210w\222\231\336\323G\026\025\331\177&j\250"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.48.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`\357\022\rL"
+	.string	"\272z\\\033B@\236N:\327\256LS\262\317\024|?\360\bO.\353.\317\\\b\034z~J\367i\375Q4\032\310AK\254\361\033\321\203Q\b\354\202\251#E:"
+	.string	"\340\367y\327}:\273O\216\f\255YB\310\336I\006\254\001\200\001\255\001g\233\352x\266\343\256\324\236=\036\251=\353v\033>.\355=\232904\177\336\367\315\312W\252\250\250\236\032\253\327\257qo\003\254\373,,\005WVU\t\250\026L!\220:`\240@\024\024\201'\247&\006\003\230\004,\005"
+	.string	"\240\224\204tdT\264$\032R&\205\220Gc\313\256\031\273}\262A^t\352\304\270\2365\225F1\226\225\261\300+"
+	.string	"\374\325\372"
+	.ascii	"\217XY2\211\341\234K\377\260\225\037 \037\256\352{\002\351\324"
+	.ascii	"\017S\365}\301\212\365G\366\366A'\340jD\345\216\334\3018\013"
+	.ascii	"\361\224\364,\026C=hc\201G\200w)\274;|`U\016:\327\254\016\352"
+	.ascii	"\310`\003v/`\367\016X\336\364\240\215\325=\n\214\223\2561\324"
+	.ascii	"\212\344d\315\234_\315Q+\273\335\034&\260^\215\236)\037t\302"
+	.ascii	"\255\025\330\216L\037u\303OV\306\240wZ'\274\261a\371\240\363"
+	.ascii	"m\315f\324\300y\036\034nz\027\364\fV))s\315\333=j\320Y\2672M"
+	.ascii	"\327\020\017\306Y\007\017x\335\253\352\370\334\024\321\306\354"
+	.ascii	"\3164\346\002\306\264\341%\266\007`\363\202\001t\271R\027.8i"
+	.ascii	"\313\221\266h\301GYn\224\005\013.J\3732\215h\255:\373#\373\240"
+	.ascii	"\363lU\022\244\202\347C\253\203\257?f\037tBY\225\213`q\242`\245"
+	.ascii	"\331\223fO\260P\331\221eQ`\234N\3601\nm\254\311\215\037t6i\212"
+	.ascii	"\201\341v\311\331!_x%{^\253\016\363\374$\305\230\253\022\222"
+	.ascii	".a\207;>\"\346\205\261\361\302\373\276\215\303\304\306\336\r"
+	.ascii	"\336\235\353t7\205\356\345[G86?\357\034\377\305y\250\371Fe\256"
+	.ascii	"E8\311i\331\\\243~\335\314\213\237\334:\332g\027rv\230x\261\223"
+	.ascii	"06\321v\243P\201\037\366<\324\fCe6\251\025\341>U\033\240\305"
+	.ascii	"\213\241\346\027\352W\346\352!||\373\265V\177\334\341d\020\245"
+	.ascii	"\205u\323\250\201\037\326I\3228\305\303!\231\253;\316\013\347"
+	.ascii	"g\367\263\324\360J\347*\335\031\367\n\025H\334)\214\270Q<\360"
+	.ascii	"}\302\304\021w\211#n\022#\316\346-\302\210;\004\210\343\2753"
+	.ascii	"d\334\020\376\367~p\276\267\321\351\336E-\356e\213\233\310\210"
+	.ascii	"{\310\210[i\304\235lq\013\265\270\221-\356c\213\333h\304\335"
+	.ascii	"\266\270\331\026\367\332\342\316-n\334\342>\213\251\3033\263"
+	.ascii	"']\246\023\367\"\251\006z\251l\033/\377\373\003\177\274\237\315"
+	.ascii	"\317\367\323\375\320\033\273\337\207\363\300\376\364\315\337"
+	.ascii	"\336\377\372\200n\\\275\373u\217\3675\313\f\304\366\276\257\224"
+	.ascii	"\217\207\b\274C\t\307\275\376\233\036\177\207z}7=\240\360u\217"
+	.ascii	"\356$\335\331\364\363:9\347\2469^?\212\306}\231\337u\003\371"
+	.ascii	"\232F2\337$\355\272\223q\375:\367gzoB\035\237\233U\232\376\034"
+	.ascii	"\220\253\371\361w\210\023\331\2243<\304:\276L\037\215\231\313"
+	.ascii	"\001\371"
+	.string	"\031*(f\334+F\342\254\320\355\317\373\306]\035\317B\255@\272\223g\361\341:y\267\277\271\207\0069r9\221ah\354\016\337\327i\025\206`\321&\021\031Bn\376\035B\276\335\217\314h)\303\207\220@~6\203>\247\f\231\035\303\340r>\"7\251\332\021\371{\344\354t\224\312\033\270\247\374\374\363\0219C~\364\033\312\316\362\f9\363\242k\316\t:\345g\207\310u~\327\356\027L\325b\005\023\377L]\265$W\"\033 \016t\303\254\277\373\321\236\r\221Y\301DE\350\357\260\337\017\251\207\tq\203\373\\\265+>,u\303\254\356\232\333\326\272m\355Y\021\371y\227\022L\364\242S\267\244\013W\357\266\020Ak\312\317\376\333&F\002\031\344*\375\352\265Ze\316\261\002\357i)H{_\246\204n\227\fv\343\276=\025\236m\334\006\353\271p\0302dh\317*\363\353nU\345M[\233.\\%\242\323\366d"
+	.string	"\2017&(\002\236P\277\226\306\234P\277\230\216\252F\202\250_EH"
+	.string	"\365\264\317\232\200\374l\254\344I2c\222\231%\034\324\266\264\234\006\020:\nee\024\220\b\t\034\352\027\200\241<%\344\212\314\312(\\\222P\033\322\361\230\225\3215*\363H\t\211\022##\2241+\243I\250L"
+	.ascii	"U*R\200\031\211N\305\303d^\021K\006\2071\353\263\\\"\022s\305"
+	.ascii	"65\"\242\f\305\212\212\207C\371\331\307k\265mv!W\247[\003\036"
+	.ascii	"\323:\276/3Bc'\026\343\320\337r\266;x\300\017\363\320\236ms\306"
+	.ascii	"s\002\355\302\325.\302\355\2210\324/\245\323\021(I\226\315J<"
+	.ascii	"1\241\234\210\\\217kV\332!\036\221\200\253\037\226\036\2161/"
+	.ascii	"a\374\017mw\210\021\370a9+\355\366\33208\370\330r\301\306\330"
+	.ascii	"\321\002\006\r\0307Z\274@\322x\213\0331r\277\300\362\261\345"
+	.ascii	"\202\005\016\0356\262n\320ha#\353E\016\035YX\002z\013G\214\034"
+	.ascii	"Y;\266\266rd%\343\272\236\253(R\273\262W\007Y\337\027\315\302"
+	.ascii	"\241\377\241\031\350;s\345\256 \375-\355>e`\031\355\331,W\360"
+	.ascii	"\234\2755\351\302\325\264\254\374\354\345\242\002\020\231\315"
+	.ascii	"\202\240\233\270\013\223\277\271\027\353\347\321\032e\020y\331"
+	.ascii	"'\321\213N\032\251\202\246\302+\227\376\210\030\245\005\244\367"
+	.ascii	"\274\362\373\006\302B5\321\252\351;\310\375\201E\251N\344\025"
+	.ascii	"+\214\354@\271\370\020\326\251Z%P\221\3311\013.\347\017\004\377"
+	.ascii	"`}\337\367\255z\220U\344\003~C\031\224i\346c\202a&H\221\215P"
+	.ascii	"\344\024\371`\203\026\265XACE\303?~(2+h\350\207\375\270K0"
+	.string	"b\237\023\371\323K\t\032f>q\210\213TS\200\356\006-\310U\2269\207\0256\312\357;\234\214\243\253\305\345\202\037\266\314\227\376G\364\246d]R\276\251\251$z\324/\004RI\332\244\210\216x\242|\270\277\210\336\332\201\374lc_\001\0239\333a\262zQn\256\357\275\266(\037\372\2432W\314\030\270zQ6\261.\326M\207\340\002$\362\327\034N\306\224\323\230\3421\355u\276\357\233\340\350\220\312\205\005\211\021\304\214\312\317\316\337jK \255\310\001.\253\325*\365[-\211\\\"\267g^\270\332C\231Dn\f6\250\013W\275`B@\227\314U;\276\357;\204\311<\335\316\336\240k\026\267B\250\273o \\T\023}\302\177\177\336;\310\005\201u\250aH\005\021C3\"\"\"I\222\024\032\003\301\005\204\020&\235\3316\021\320(\346\240R%$)I\251\003\237\220q\213\024\232\b$\t%LR\347$\325B"
+	.string	"%(\210\304MI\266\177"
+	.string	""
+	.string	"\303\324\314\343\323(\257\024\307\022\3011\314\030s1\300\362QS\002\266\303Z\326\f\331\346\250y\224\033N9\344\300\302\243\371c3\253#/\262\360\004\341!P\231b\347\333.\326B"
+	.string	"Ud`\362\0038\335\035q\003\266M\3318\222\372\3213\351\331I\351k\257\346\313\017\211\226L\261\262I\026\225\237j@|UpO\n%\307\357\t=B\351\221\202\210\201\365\315\207\b3\351.%G\307\262\241\202\343\\N\270\337I\031F/Q|\337_r\031\326\247"
+	.ascii	"\365\2058xCG\nj\200\237f\201\340D\216\373\2423\312u\345\243\333"
+	.ascii	"J\372\313\221\033"
+	.ascii	"*\303\211\200\305>i\206\234'C\020\3248\300s,2\316y\0243\033\327"
+	.ascii	"\227dq\364|\262G(\252\313\206E:\235\320@\276KB\267\330\f\307"
+	.ascii	"_\255%Y\022\332PhrT"
+	.string	"\020\310\351\234*\223\032\334\206\204\036\345e\fA.3oF3Z\277\277\002Z\372\316J{BWg\025e\244T=\n}\235A\303\354\332\263n\241H\004^\273\362\323\335\005\036\205Xa\376\231\260\334^\260\361/\240q+v\232\270\267gI6\030\212\006\020\2003\345\032\2029F\335\200\254>\b\275Nb:S\275\311]X\336G\231\323\325\030\315\312\3144\0233S\033\nz1\352\033\n)M\221\237\032\314\027\247\034Jj\021\316\327|W\345\246\336\234J\211\363\365AI\nf\371\236\\5\034\335R\t\3672\250H\317F;-\215z\350i\007]\356\t\313\205h\244>\016\200\036\003^\307\334\222D\252I\275\350\026.Z\022\313\036\363\214\005\215\234\0210\202\355M\310\322\340\030V\226L\365m?\0174g\356c\211Q\301\"=Y>\252\234\341,\342\260\b_\322\302\237,\236.pk\206\366p\260\344% T\003\024"
+	.ascii	"\t\302\367\021\342\374\233\n\363}\036^\243\323\370z$s5H:z\017"
+	.ascii	"\234\016\313j2\371RR\200\340\300@\177\356\021o&Z\303\260\241"
+	.ascii	"\204G|\r\364b\350\bu+\300\200\036\327\310I8\005\343?\300Ika-"
+	.ascii	"b\316N\310u\264\273\305\017\357\233\252\262`Y\354\016(\013\336"
+	.ascii	"\376\241%c\020F\2475\274\335`\350\202\"2l\353\276{\235\352\256"
+	.ascii	"\0044`\030\255\231{\003\301\343\250\365C)S\306Z\r"
+	.text
+	.section	.gnu.lto_getBoxIdState.49.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`;\002U\024"
+	.string	"\226'\214I\260TN:\371ji\310=\367\037\017\317a`\362c$\366\335\360\354\263-U\236\027\177\313\3724\374\332\302\353Z\277~\337\036:\204R\357P\207\037;\227|\315I\255\177\374J,\034\355u\375t(\f\341\316\215\220\275\267\2242\005{"
+	.string	"k"
+	.string	"z"
+	.ascii	";ci\330\026\n\350\260Z\223\236r\324\332[\360\004\341N\003\253"
+	.ascii	"Bw\312E\241;\377\237A\003\333\203\266\227\242hU\214:\033Hj\355"
+	.ascii	"\321\032\305\006-H\247l\016\372\n-X\341\n\b]\243+\034S\252\024"
+	.ascii	"5\355d\274!\271\262Uu$\306\363\300\262\003\217q\307#\261-W\220"
+	.ascii	"z\204"
+	.string	"\220\361rR%\353D\221\375-\023\361p\314\240K\255\365\274\343\031\355\303\375\317\341?\205\237q\002Z9\366\372\017G@\260\276\335\337\036xQ\243\013\304\215\307\277'\304\275\364o\217\3438\276\225~\311?9\177v\276\311\371\262\205\332-9?\244|\220\362)\345O\311\227\224\337\223\317\222\277(\001dd]\220\252\265hLR\261\246\325\212\365\355\376\266\357\357\261oo\243l\353\373\t+\013\330\216\310\207\255Z+\313\316\267\204;\337\013\231\377m\322\253\323A\273\033lI\245;\232\255`iK\256\241$8\036/{f\330\037MXk\316\201\354\007ZV\334\335\253\373\272M-UM\315\306\206\356\344\206\211\230\n\342\342\026c\202\005\230\204\374|\344\330\213\253\270\262J\310\223\236\365\376\026\246\373\332%@\267O\372\254;\302\255\324\336\270\3712]\324\341\335\355\374\352\320\235\333\340\016\251\256\243m\332!au/\035\210\226\264"
+	.string	"\246\247_1"
+	.ascii	"!\345\375\303\034\230\027\232\031\361\245GCMm\203\004\321\302"
+	.ascii	"\314\004\0371&e\246\346#\306\314\313\264\370\2101\030rxnh85\230"
+	.ascii	"\033\232\314\016\017\255e\300\305\034\232\035Z\217(\356\320b"
+	.ascii	"\275\272\262\266\322\327\204\023\024\2255/9!M\023\256\026_=\353"
+	.ascii	"\260\211\376\207}\227[\343\376#kM\202\260\345\343Q\326Z+8\343"
+	.ascii	"\222\376adxw\262N\031\001\003+\327B7\022\365c\beY0% \220\002"
+	.ascii	"\021\272\353\006\217\030\256\037\017\244\f\240\201\034F\332\362"
+	.ascii	"[q\024\206+(\372d\321\340\332\241\003\022\253Z\027_\310\001\233"
+	.ascii	"\217FK&\327\242\002%]\207b?\254\326Y\221\263\013\031\277\371"
+	.ascii	"c\346-\240\020\371W\032'1\037\313A\237\013M\f4)\\\001\215\260"
+	.ascii	"\366"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.50.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`\251\002}\025"
+	.string	"\326\346\212J\3200'\035\333#\375E\r$\320\374\301v\016\3168P\257(<FLz\351\003\334\363\215\222\366\251\3164\377\034\252\3557\022P\220f\333\241P\353H\256\326\202\344\370w\030\fP\234x\200\255|\2400\325`\032M\032![\356\224\002w"
+	.string	"n"
+	.string	"w"
+	.string	"$v\266\024-=\370~d\264\343\264\243\326Z#\371\210\370\220>D|\270\035<\316\335a\343K\f\351\316\235\017<]\252\n\366|6\207\321\007\2638\234\306O\006\212`\251G\306\203\237<>\336\034\213\200\204\376\372\360\005]\304\360P'gRJ"
+	.string	"\253E\216\230o\207\216\370|\350\221>\234\271\017><Z\312\032\002\022\372|\235\324Z={>\240\373\343\266\213l/\260'R^\"{F\247Ad\261p\232|\371\303\376t\323}\323=\351\364C\004"
+	.ascii	"\315p\360\242V\237\256\036\325*t\221\364\247\277\311w:\224M\272"
+	.ascii	"\346'\274RU\344M\370\301'\032\024QK\njl\362\341\355\235\0174"
+	.ascii	"\3517\321F\233\2371\030\225\204UkY"
+	.string	"\362\320\007\306\207\323~\2113\355^Z\370\254V\242\025,j-\013\2306>t9~\304\003\273;\227\207F\244+\333sQ\005\347k\177\247\211\273\261}@u\245\263\2017\273D\331\334eq\231\357YdJ\207U\216\001\0201\200\341\376R\374\373!\277|E\246\264\254Nt#\350\211V\020AV\003\322\025\320\006\316\344ar\322\365\241$\330\346{ {\250\237\340,\216Rkk\3677\336Tb\311akS\310\315\367<\247`X\351\254\215]\362\346\376\354\003`\352]\b-)\272\333J\250kI\321\335\022\340r6X\356E%\006\305\245\345\326`&\302\013L\f\n.g\013`\026\023\335m\005\002.g\253M\200Q\261\325Xdr5\223\001\276\341\\dj3\267\233L\215,o\276D6\035wg\344\222\334,\317\263%w\207\353fv\301\366g\031\217\227l\215\224z\246yL_s\017\374\270\025\202k\232\207\306"
+	.ascii	"\251\306i\255\265\216\373\363\203\207\211PR!\306\32648 `\002"
+	.ascii	"\221Y\311\r\177\214\324h\362\353Rm~U:\215\245\036C\323\304\255"
+	.ascii	"~%\222\021w\366M\224\276\357\354 V\017\027\214F\271\tCe\205\206"
+	.ascii	"&\031\227\177w\346\202\013\3370C\221\252\333\201\0251\002\354"
+	.ascii	"\326\265O\016\224lNUj\024\357B0\034u\030\231\037\007NL\270L\027"
+	.ascii	"l\3100\303H\027\365.\016\325\202\206s\227\350\300w\326\303pi"
+	.ascii	"\215\037\302\350\356\325\004\313@\276+\222\231\332\360\004"
+	.text
+	.section	.gnu.lto_activeBoxIdGet.part.0.64.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\205\n"
+	.string	"&\325H>0\247*\0350\337\214\210\210@\225\375wos\310\311:w'\\=\003\025\016\214\234\007<\003lu\027E\261\021\243\204\026\312\251\217\b\252\212\03087!\234k\241\033T\f/Z\333[\312\224\0028"
+	.string	"5"
+	.string	"4"
+	.string	"\033N\211e\333\033\216\311\247{\261UE\345\340c\306`\327\323\036\265\344\247k\302\223\237]\013u\375w\b \226\240k\205<\023\016+\235\335\265E\344\216\267-a;c_\013'\266o\377+\331\030\333dc\036mk\336+]F\202\336\266X\326\264/\340\003L\227\221|\331%A\240`\327\313<:\302\362\350\360\005\312#\274\002\345\321~"
+	.string	"\007\233z\347\317^`\363M\036\255\301\345\273G\237\343\350\310w\251\377\236.\017E\245\302\254\360pw\327\372\262\235V\247\363\336\177\nD\2070\262\273z\320`]qA\026\023\243\315\023\375\321\2146\017E\210\003i\031\030\025 \355#\3424\r\203\267\320\205H\333\3306\221\2069\\}\371\337\037\016d\252*\210\272\223R\225U\025f\373\222\327\023\270\001\256!\266\001\020"
+	.ascii	"\3571\036\026\356\320\206BY\340\fc\312\225\271\025\220\007F\004"
+	.ascii	"\22709O\316N\273k\216\240\316\360\220\232B\363\322k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`\030\003\245\016"
+	.string	"\244\024\024\004"
+	.string	""
+	.string	""
+	.string	"\002\300"
+	.string	"\177\027\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005)\f\200\204\001"
+	.string	""
+	.string	"\003\002*\177\030\376\315\373'\272\200\202\002(\031+\177\032\002-\177\033\002.\177\034/\177\035\316\334\263\007\0020\177\036\247\356\331\003\005;\037< \0021\177!\377\377\377\377=\">#2\177$\210\212\277\f\0015\177%\037"
+	.string	""
+	.string	"\200\200\200\0014\177&3\177':\177(7\177)9\177*8\177+6\177,?\177-\003"
+	.string	"\017$\003\005\021D\003\005\020d\003\006\007"
+	.string	"\261\263\205\250\002\001\202\001\004\007\325\n\003\b\026$\003\b\023Dd\003\b\025\204\001\003\b\023\366\257\234\001\001\304\001\344\244\006\003\b\024\304\006\204\007\304\344\007\204\n\304\n\n\013\304\364\234\265\002\001\344\016\204\017\244\304\017\017\022\304\022\204\023\244\023\344\023\204\026\244\026\344\267\364\337"
+	.string	"\001\304\027\344\204\032\244\304\344\204\033\003\b\023\204\375\266\001\001\204cff\003\b\017\330\331\202\224\001\001\204g\003\b\022\245\323\373\006\001\344k\003\013\027\346\336\301\357"
+	.string	"\016\026$\003\016"
+	.string	"\371\365\300\363\003\001B\003\016\013\306\227\353\244\001\001\202\001\003\016\023\303\335\2626\001\304\001"
+	.ascii	"J\250Q<\220J\024j\261}\326\340\002)*j\003\021\220$e\274\027J"
+	.ascii	"@AAAA\007\377r\206O@\263%\227\016X\270\241\322\177\243h\313\300"
+	.ascii	"\356D\326\364\371\214\236D\b\255vWXX\027n\356\336\356\232\005"
+	.ascii	"\367\033\"y \236\313A\234Q\342\223\022\346@\270Xx3nx\274\033"
+	.ascii	"\337\016\337\216\357\235{\377\231\365\253\234\331\300\005\220"
+	.ascii	"\1772F\323d\t\211\342`\255\343j\243\256\321n\345\3265s\027\354"
+	.ascii	"\230z\024pT\001"
+	.text
+	.section	.gnu.lto_.refs.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375 X\025\002"
+	.string	"\362\204\016\031\240'i\f\343XUUUU\365Uw~K\215\335\331\337ZK\367\245\334)\027\301\013L\364bf\305\236\230\036\266aZ@&\034\017\216\2061\331\310T"
+	.string	"\252=\223tF\347\210\001"
+	.ascii	"Z\224&"
+	.text
+	.section	.gnu.lto_.decls.1f06ea32968f6e6c,"e",@progbits
+	.string	"(\265/\375`\f \375\221"
+	.string	"\372\356H4Q0R\312I\007\355}\253\266\252\366\356\373\353\356\356\356\352\277b\337\366c':\351\366g\377\253\232\236\"\273\377\266J\332\330\026\335\307\277.\337\252\277\226\210\326\021\2069;3\r@\262\222 \"\312\252\260\362\\\224 \252\212\250k\315\377\027C\"\221l)S\272\0028\003F\003G\306\246t\212\206\315\030\217\317\234\235\367B\3618\215\315\360 \235\013\2041m\361:\261\263\327t\325\322\364<\267\236\3150\031~{\341^\350\275W\200\2353Z\234J:e:\340\271\314\b\265\211\351\274e\031dU\201u\232"
+	.ascii	"\377\250)\217P\355t\340\316\322\210uzv\353\302o\326\271\365\243"
+	.ascii	"B\225\205w\257\363\216\305p\035\233\261\035\317\235\3518\314"
+	.ascii	"\231\002/\034\247Ra\3311\030~\343A:/\323\217\352jI\352\004\320"
+	.ascii	"\211\0237mUQ\274\326\024\210\177T\313_\353y\311\312q\315p,w\216"
+	.ascii	"\343/:\312\313q)+\300\303\254\300\r\233\222$\231\232\236\257"
+	.ascii	"\326\263\217\273\023\304W\020|\235\376\206\325\207\177T\003z"
+	.ascii	"\234?\224\252\332\240|\2675\304K\247l<\3202O\250t\252\305\t\264"
+	.ascii	"\323\245\257\007\263\323\323\260\2521\026\316\302f\274\306U\316"
+	.ascii	"V\370\312\201\234\367*\357\275@)\214\306c\357\225\002\333\222"
+	.ascii	"\340g\261?\005\005\274\306i\214\306r\314\f\266\204\341\335\013"
+	.ascii	"=\207\375\3005\206\302P\353\334\341\336\252+\0360pS\326\364\356"
+	.ascii	"u\002\2358qbGN\207'A\326\364\037\254\f\264\301\312S\230\n\233"
+	.ascii	"\031\300g\316\036\035&\246\254f\247\267`\025\340y)\370\317z6"
+	.ascii	"@\345(\033\240\276g}\302aLf\227I\315[v\257SD\317\223\036F\222"
+	.ascii	"8{p\324\370\230\370\350\224\235\034\345\374\344\261\247\240\340"
+	.ascii	"\026\371\274a\367^~N\320\2747\311\317\2366\367&{\230\025`V \005"
+	.ascii	"\243Zr\246\246\017\261\276W\037'\377\250+\217PC\374\315B\n\367"
+	.ascii	"\371\033\215\331B\231\234\006\230\314E\374\235%\034s\346\347"
+	.ascii	"\036\302\330\375\214\203\230\237\221\352~\256\021\346g\037t,"
+	.ascii	"\327D~>\200O\304\335\201\377\374\255\203\322\317C\270\237\215"
+	.ascii	"_N\366\235\277u\024`\203\227\377%\376\027\360\367\320\317*~~"
+	.ascii	"\373\331\355g.?\267\375\274\345\347\265\237\263\374|\345g+?\227"
+	.ascii	"\375L\345g\350\317d?\217\375\f\345\347\257\237\275~f\362s\327"
+	.ascii	"\317[?/\371\031\353\347\253\237\253~\246\372\217\345\177\332"
+	.ascii	"\1775\251\237\207\374W\340o\343\317\314\237\177\374\254\3749"
+	.ascii	"\207\237m\370\331\306\317\307\237\211?\303\360s\360g\027~^\341"
+	.ascii	"\347\024~v\361\263\t?\223\360s\b?\263\370\331\203\2375\370\371"
+	.ascii	"\202\237#\370\371\201\237\177?3\360\363\002\377\265\374\234\300"
+	.ascii	"\377\274\237\021\370\231\304\377.?\343\374\274\376\234\376G\341"
+	.ascii	"\377\331\317\374\363\377G\377\363\375\307\373\177\367\277\355"
+	.ascii	"\377\226\377l\377Q\374\177\373\237\023\215F\243\177\272\376)"
+	.ascii	"\211\037H.bdz\270\260\374\030\023\366\026k2i\304\330\360\333"
+	.ascii	"\rU^\2314\347z\376\342\346\301\254y\350/\234e\312\345\016\357"
+	.ascii	"6\365p\200\331v\320\364\220\264\327\337\\\335\325Nt\232\367*"
+	.ascii	"q\236\320L\361\320\251\026\273C\020\036]\2356\023\340\273\211"
+	.ascii	"\275\201$\351\251\323\022<B\315\340\362\217\372s\246`\253\226"
+	.ascii	"Vo\221\271\t1\2413v\311\262\226\274\267\232yc\306\347\003W\326"
+	.ascii	"\212\244\223 \351,\365^v6\231\232\332H\037y_\375\252\263V\344"
+	.ascii	"\275H}\314&\023\177c\275\263\342z\220\230$\261rc\307\313L\235"
+	.ascii	"\016\235>\025\262>\305\261\376\375\2537\331t\357}\272q\336&$"
+	.ascii	"\035\225o\230M\374;l\323k7Xs\357X\327\232\225+-\031\244\023\270"
+	.ascii	"\377\275H\021\327y\233\226\320)\344R\312\234\223\b\347-\"\300"
+	.ascii	"\205V\335\245s\312)m\336\276\316\313W9\345$\303\322\331lZ:\233"
+	.ascii	"H\237\253l\"\357u:\371,\313\222H^B\247\234\226\320\246\223\210"
+	.ascii	"\253\274\310\013M\026Y\225M\247\245\227\246\223\317\022\232t"
+	.ascii	"Z*\247\234D@\351Z\002\307C\315T\033vZ*\357\222\222\220d\223\217"
+	.ascii	"\334\322\331\274w\367r\031\216\333\264\300\275B\232MwI \214\005"
+	.ascii	"In\t\251J\262\311\003(!Q5\257Rn\331\325\274\267\013\251\350*"
+	.ascii	"M\200t\312\335+\226CV\t\271I8\356%\340:\357U\272\027\311W\356"
+	.ascii	"\336\213\274\367\376\232\2048\357\215\362Yn))\335\313\004R\272"
+	.string	"B\220j8\356\355\2621X\234\226P\252&Pm\nt\353\346p\"y\353\336M5\255Pd\224\233\244f\335r\202J\323UP\034\273\262\347\022\226\265\247\200\324\257.*\260\347\352$\301t\262\324$\222\263\326%j\256\323\226\3426+sN\\B\330\254\207\374\214\316\275\005\204\300*BDL\247\255C\007Y\215|U\311\022$\352G\2269\264\250V\342!OI\306:=\233f\376\307\3119\242\304.\007\023\310\223\036\017&Z\234\215c\007\246#f\375\203\253\374\277\277d\021\2761>\272\307\216\022\256'R\247PKsk}\235\336&Y\377\267S7\261Y?\265\322Y\254\227\252p\030S'\361 E\334[%\266u\257\263\237\232G'\261\034\323y\2372\b\213\002K\221\310z\360\242\246\267:V\2766\231\324t_\222\220\202X\377\336\321K8\037Cp\2305\216^\0029\357S\016U\032\020\246\336mjr\240s"
+	.ascii	"1\027\2562tm\353\373\254\225;8\315(\262\344sm\244\247\317\346"
+	.ascii	"\216M\376\370\222\326\2513\207\271\264\002\005YbU\256\241\205"
+	.ascii	"\365\215\2069\271d:=G\337^\370qE\227\322t\312}\300s\020\007X"
+	.ascii	"aS\353\364\327\206/=[\263\262\005\b6c>\336{\352\274\267\214\217"
+	.ascii	"\323\260\036\217\322y\237\002@\322\202\332\322\353A\003\344H"
+	.ascii	"\2174}\007Y\317z?t\363\336\262V2b\267\354\224\3270\03363\301"
+	.ascii	"y8J\347\205\342\210Q3\244\354i=\233P{\330\204\232\002xV\243z"
+	.ascii	"i)\262\327\351[\311\007<\225H]X>\240\342:}\031\377\2508<B\345"
+	.ascii	"'\300[\036z\350\322\330h\355\260\025\205\t\252\253\323\333\255"
+	.ascii	"\337j\331%)\222\256\270\360\217\232\223\004x\253d\311\007\326"
+	.ascii	"i\210,\213eD\312\231\217No\261~\213\304^\325\020\355\373\241"
+	.ascii	"\323\337\361\217\272c\004x{\004n\013\336X\247:V\266\352.\252"
+	.ascii	"kM\247\267U\277\235\262T<]\254\332\226:\345&\377\250$\232"
+	.string	"\300\333\"9ho}K:\035a\211X)\252\246\036\254:\275\225\372\255\020;\204\237/\350\274\271\321\351\361\217\332\303#T\033\005\274\r\262F\243kW\235\362\360\b\3252-\263\263\230\252\r\024\017\235\221\035<:\375\212\204\343v\007\016\373\303\212\321\271\310\347e\372\245q\211z\351\335%\323DN\024\036Q\3008\335\376\270\365\221\202\202\233Y\275\232\210Ivj{\234\207\371%\013^\247\267O\026\352\307\t\301e\005u\022f=\004\317\037NN\235\332\246\233\351.3I>tj\231\316\306\264\323;\262\004GE\207\324\251\345a\223\330\354oV\351<Yr\230\275}Y\237\003\377M\265\313[\035?\016N\026)\253)\266\365\2679~\234\337\231\230 [X\326\377\314,\322\"\255\022\330\344\363\362\322\031\003bN\314\"\335*m\362\027\244\257\257\243$\324\232h\266\364\300t\210!\022\304;\272\303F\212\034\224\037\340\230\332"
+	.ascii	"\001\305\307\327"
+	.ascii	"{^[{\312\251_\216\274\274\336\003jZ\273\246\274'\257\337\031"
+	.ascii	" \212 \351\275\367~;\304\262\234:\355\037nF\005\343\304\211\022"
+	.ascii	">\037|\3505\267\312+\345\266\225C\034\017\247\232\367\032\236"
+	.ascii	"\034Z:\352:\3554:hj\350\362\240=N\370x\210!S\246L\243\001j\332"
+	.ascii	"2gQ`z\234f\352KG\237y\243\371e\301Y=u\332f\372y\203\253MS\215"
+	.ascii	"[ow\273\036\003\324\264uxyO^\3672M\330\266\260\036=zx\217\331"
+	.ascii	"\371RKr\326i\337\035M\232w\245\034cb\307\224<$&rr]\227u\005\204"
+	.ascii	"\251\227\203\305\006\225&\314\273\356l8I\240\342\304\232N\352"
+	.ascii	"\331\224B\327sRmsI:\207\312wdM\t\206\367t\232\306\264\200\025"
+	.ascii	"q;\233\265[\303\231h&\223\f8\221[\251\270H\335\350\264\337\332"
+	.ascii	"\013\233\225\350/\357.\354\366"
+	.string	"\233\244\363:;\253\317Le\256\347\022\252\215F\271\204\332\352\262\215\315\272\215\337\370y\231B\350\270h\266\364\356\345\342@O^\223!Y^\330\330:\353*\n\204\251\027M\263\305we\315\254\327\332\212\237\327\2518\306\264%\335\323R\363R;\233\265ZS\361\363\"s\310\264\230\016\334\324-\271\315Y]\271\322ie7r;\306\310\316\346\2356\327\245u\326\243\254\254\253\\\375\310t\001R\327iW\371)\355\375p;\355\263~6\365-%;m\263\263\365P\331\303\301Cs=S\242\273\352\3647\311)\237\322\320\325\347\"\325Em\261\021\275\250\227\273\261\261\206\256\227\245$1M\334\340A\241M\310\336Pn#\226U\326i;\373iyxqA\237Qr\266\242\324\364A\375~ \001\321\306\366\344I\007\037\250\320\002\205\0168\020\372\300\003\022D\020\352\340\004!\027-D\f\205A\0304\214\210\206\302\240\242\221FP"
+	.string	"FF4\206C\342\360w\024\n\326 4\2524\020\213EG\342\360\027c(h\224\036\203\306\243\340QP\0010\202F/\206\206\037\030[\004\2134\216C\301\030>\306\"\3218\f\032\177\307\240\213\242Q\0072\206\302\342\321E\217\212\024\202Gaq\205\234\027\241\030:\n_\030p\f\202`c\250X\344\340(|\221\303\"\006\242\241\031#\216B\025"
+	.string	"{^\204\202H(x$<\016i `\2241d\304B\306PxT\034\312\t\036\207\216.\216A\031;?G\301\243\321\206\013"
+	.string	"\214\034\034\205C\241\217\r\243\031\301\023D\fY\f0d\021<\032\032\001\200\022H\030\2036V\324 \256\2001\024\306\340\341\211"
+	.string	"\305\26184\003\3051\b\302\317\211\204\305\3400(c\375\004\025@P\201\212\032\277\253\300 \002\f\"P\257\002\003 \020\203\n\200\353+"
+	.ascii	"\332\343q\310\242\006\241\321\220\260\0304\362\034_\204\"\006"
+	.ascii	"\215\027GC\301\342\321\0304$\036\035\021\211\016\2001\fZ\243"
+	.ascii	"P\f\032/\214j\3618\303\376h\\\021\234Ax$\032\322\t\n\301hQ\204"
+	.ascii	"\302\030\204A<\022\"*\006\021\305\210\3018tt\024\256\250A|\241"
+	.ascii	"s\024J!\301j<\n_\244/\n\2221c\200\032\304\025D\341P8\303\347"
+	.ascii	"E(\202\216E2\204F1\b0\n\311\020\306\030\022;\330\t\302 \212P"
+	.ascii	"\f\326\020\036\341\030\021\211+\204n`\004\215\305\340\f\301\242"
+	.ascii	"\220\221\206!\033#\216\303 Q18C\250H<\022\217\204f\b\215b\024"
+	.ascii	"\031\207\212D\002\034_4\300\2113\202\305\240#\221X\f\312\201"
+	.ascii	"\321\3428\f\016\207\216\212\301\0319F\241\243\220\212\343PH\343"
+	.ascii	"w \260\203\004R\030\001\204\225\bE\r\342\013\241\031\306\243"
+	.ascii	"\240\241p\350(\210\250h\fB\001\004\243E\r\342\213\233\342P\021"
+	.ascii	"Q\032<\032\032\241\006\361\305\317L\303\001\271\301\207\206\306"
+	.ascii	"\"\b\324\032\2311\321,\313\333)\332\023\336\025\226\036\254\372"
+	.ascii	"\274\b\271qG\245\302\221\271e\331uT\214\362\256i\225\324u{k\335"
+	.ascii	"\222\026\2320?\344\306\242W\235Z06\2076\367&-\230\266tv\356\026"
+	.ascii	"\314{~w^\313\244*\327Y;>\200\345%\211k4yC\226\300\255\321\321"
+	.ascii	"\202\223\362\345K\177\375\326\234WR^\336\242\212X\355\350\324"
+	.ascii	"\276\035\212s\005\t\026^\0277!\247\035\352\254\333\223\247O\t"
+	.ascii	"\2178.mW\316\210m\373m\224\335\322IA\230h:=\036\022\340-[/){"
+	.ascii	"{\323\2626W\225\305\256\375V\315f\341\221k\322DL\247\274\344"
+	.ascii	"\037U\004\226\020W\360\2360\245]\351\001\263\252\262W~"
+	.string	"[\305Z\311\211\022\327\346\253S\336\342\0375\2003\340-Z\317\020-$\263\323\037\26326a\276@uz\333g\251\324]I\203\244S\025b\300\333)-fd\211e\245Xh\263I\304\256\323[\350o\237\226l.\211\205\325)\017`\005x\033Eg\355\351\331f\235v\214\315\030\252\034\235\336\216\375V\314BQ\227\312\251\256N#\340\037U\r\263wNj>:\275\001\373\272\321\344\345F\247\267_\277Mb\275\324\350\2225I\235\036\013\027\360\326I\216\262\307Y\023&7Q\226y\226\311o\271l\202\245\250b\3710G\362\224S\204HFd&I2\034\302\n\020\004\302i\032\371\256\003\022\200E1\320)\b\315\214D\251\264\237\001~\023\274\213\032D\202Y\2006<\225\233\263\341\244uR\320\341T\300+\007\252\333n\206\253\n\201\360\004ps\270\013+9d?Dp\030\004\363\212\n\024\201<\326\256U\210\331\300\375"
+	.ascii	"K}\210{\275\232B\226\b\036\300l\240\324x\265\236{\270\262\254"
+	.ascii	"\372\317U\304W\021\003J/\"\336\364U\226\036\251\266\b\362\007"
+	.ascii	"\nQ\356\207F\200bH^\275a3\305 \264\376\302>\334@m\341"
+	.string	"\270K\230\243z\261?F\275\274\216S`\247c\214\353\350Jv\245D\001\024\030\260\253\322\277\341!\276\373\253\264Z\372\330\365N\203h\262@-\036\007\300\357\273\325\201\313Z\331C\373\013\024j\277\330OK\334\273N!\203\370ZzHb\3545M\364\221\313\007\306\312\315\340P\n\370\321\244\347P\376A\222Q\217@mbG\022R\361\252\241'q\310B\214\354a\001J\265w\321E\212{h\207#\303I\215\305Xt\344\031-\204b\006\243\221R7\311\343\231\204\021\031|\035\332\032B\265)l\240\374a\231e2C\r\036\300\376\217\242\302E\361\"\0058t\246yQ\222\027{,\255\235h\303P\222A\361r\210\211\367\220\256\245z\303\322`\262\3113\377o\345=$Q\200\270/3=\027?C\2318li2_)\377$j{Rj\337f\315\227\235h\024\2570M\002\177\004E\233,g\013\2470=.\020f\207\336"
+	.string	"C\034\354H\354Fll\346\205y\026\007,\363]\377\244`\337qx\245\022X\336K\036E\370\305+(\241\002\234\253\272:\334\f1<\362\301f5\360\022"
+	.string	"\242\260\256\345\340\357Fj\300\356V\327\264\347\334\326\\n\255k\263A\276\263\3166\005\200\fj\224\275;\255"
+	.ascii	"-K\304U\311\\\337\200\350<\335\250\020\032\013)\300\021a\033"
+	.ascii	"2C\217\221\313J\346\243\226\022y\020\344$C\366\036i\375\210T"
+	.ascii	"\257\366\307\312\f\373\3509F\213\321I\022\033\r~C\034\310\306"
+	.ascii	"\334h%C\330\255\006\240_\215\274\3064\030\364\374\331VZ\"\236"
+	.ascii	"\253\003\017NB\003Y\374\265\fu`\302\210\2437\315U\024\005\264"
+	.ascii	"\265\237\342\354\367\2526\265i\256rc\353\"\300\001V\212\370\235"
+	.ascii	"gX|:U\3528\0042\035\316"
+	.string	"\235\332\\ :q\246\231\245\331l\002\244\200\351\006\205\377\346\230\244\347\351\025\024\243U\b\333\302\247\271E\215\272\330\240\245\243F\036M\270oAU\363\332\033\342\0365\205\356\264\357F\322~L\320\273A\226\370\354SlM\035\322\031\b\022\300\312\246\024\364$\0223\223\231J\264(>\234\334\363\345\004A"
+	.string	"\024\013\264\353\352\027`\223\327\355b\242M\005\270.Edr0\367l\224\241+\\\275\351)\036\036\227\344Y\022\303\200]\217e\336B\226]\301\243\316y\363jB\200X\362wK\350x\363\350\037\360pB2\220\224L\262Q\332\360qaG\200j\245\026\327\272l`\341\324\241\032\334\233\200\376$w\260\237V\253\253\030\213\316>\017\375\006\303\2264\357\230\240,n\314\224\tN\322\023y\201\343s\245\353\323\314\374\310\214*\273w'0K\00594r\303\277\"\261\300\2133\311\207,\223\2417\177\\\374\032v\b*\224\211\\5aj\354U\306\35356\346\235w\233\016\3305R;\022\307\b\355\024k\007\202\266Q\3435\353\005XC\210\227\326\234\350\214\232\313[\277\177\365"
+	.string	"\347\351^1\261\366\315~\203\345\200d\003\030\206\221';\177K\336g\272\235\235\252qH\324k\3066r\013} V9Q\322\022\370\304\265\023tH\371\026\272\025\334\345\317I\245(N\244\244_\251\344\201\330\004S^@"
+	.ascii	".\307\343\274a\350u\004\270QFH\342\340\376\005\001\302\262\270"
+	.ascii	"b\213\252\324\275\237\013@\\K\354\036M\242L\274\323\250\340\366"
+	.ascii	"\021\253@\336=\031>\2065%\\\376\204\255\210\331\200\3511f \257"
+	.ascii	"\370\027G\3425\022\222\221e\267\231\330\255\b\323\337\024u\202"
+	.ascii	"g#\204l\356\202U\027\022\340h\233\304\303\003`O\223\352\323f"
+	.ascii	"\016\370\315\375\272\ri\227\346`\306C\361\345\244\027$h\214\300"
+	.ascii	"\276\376?\366\316:h\235\334+\222\343\336\377\353\217WfO\335\030"
+	.ascii	"\267\374\216\265-s&0o\335\207\363\260A\256r\036d\237\244rIw\206"
+	.ascii	"N\310\272=\202W\346\377\231\337\r\006\243\237\222~\203\334d\323"
+	.ascii	"\214\325\241Q>\200\337p\373c\350_\363\022\265_D\032j\017&_l."
+	.ascii	"\230\375 \364\337\025\274\334\337\2075O^'k\335\277y\346\236w"
+	.ascii	"_\354\376g_t\261\347\3276\325\373\360\355\362G\017\006\232\357"
+	.ascii	".\225\355<\376\243\325\335\336\2509\346\317\366K\370k\226xcg"
+	.ascii	"\361\324\372CN7\273Z>UF\316\226\007\0338\254\030\347\260'\365"
+	.ascii	"\271\242\311t\300\244\r\377\235B+"
+	.text
+	.section	.gnu.lto_.symtab.1f06ea32968f6e6c,"e",@progbits
+	.string	"findBoxByBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"serializeBoxNameFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"serializeBoxPermanentIdFn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"getBoxIdState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"packFlightModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"pinioBoxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1f06ea32968f6e6c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
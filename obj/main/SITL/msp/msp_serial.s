@@ -0,0 +1,2025 @@
+	.file	"msp_serial.c"
+	.section	.gnu.lto_.profile.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	"\020"
+	.string	"\024"
+	.string	""
+	.string	"\032"
+	.text
+	.section	.gnu.lto_.icf.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\301\004\265\024"
+	.string	"\206W[G"
+	.string	"\257(\215\001\377#3\306\212f|\036\260:\b\231@\001\026\274\002\343^\304\332\250\342`\0167\374Wa\\5\321\356\372"
+	.string	"\355.\375\377\377\353.\375\317UU\221\255\303`\250\374\324v\177#\204\220XB\310&+[\332$>"
+	.string	"F"
+	.string	"J"
+	.string	"\037\350\376\275{\357\2375\272\203\202\205\213\326\215\254lX\363\r\021\260\234p\355\336=\347\336\267\235>\327\236\317E\224\005\034\024\317\356\371\345\032\267S\"\243#\263\263\337\f<x\275d\247l\272\002\"*\255o47h\371h)z3Q\026\025\006\225W\337\266"
+	.string	"I,\347S\257\031\232\f\354"
+	.ascii	"IW\257\365\372\211<\0042\244 p\241\327\223PC\"\301\266w\035\b"
+	.ascii	"\364F)\335\304\245\030v!(%\314\327\001F\212\247?\366\270c\216"
+	.ascii	"\353\246\r\255\024\020\243\275\004~!\324\004\346E\200h\227r\243"
+	.ascii	"\004\340SAC\211M\035\037\307G\223\006K5X\205@\237\024\273\324"
+	.ascii	"\b\225\023\2214i\2155\336\320\304\305\001M\3501\210\3058\001"
+	.ascii	"3\226\213>&\002\031j\371\305P\210-@=kX.\"\200\354U\363\\\003"
+	.ascii	"T4\247\035\fQVr\024|\200\2742E\004l\305\343m\246\305*\3211\237"
+	.ascii	"!\220\203\316\214\bG\346\215\334\\ha\232-/^\253\215\022\215i"
+	.ascii	"\361\360*IX\210\t+\306\003\334\250\300!\005"
+	.string	"\200\233\2501&!\221\031\021IA\245\322\001P\002BTF\364\022\340\025\035\312v\210*QI\262\265\237\001Z\204<\326\315\037\214:\310b;\367\207yDW\266\021J\216Z-\017\244\004\345\225r6\350\204\215\273\246'\206\232:b\027\335\327J\fR\006\201\321\266\2768\252\247h\212\231\200\202k\301\270W\354\002\017\026\230L\253\337\247\032O\255x\307K\210\265\222Z\236_\016\370a\226\335>@+\304\365\215\360\n\324Y\245)\353wvR\216\3705\007!\234P*_\032TN8\\\252\235,\213\373x\243\244\235\344-\306\355\304\n\341Pi\356aa\311B\033\343\346\\yx1kf\250n\355l/\225\262\225\241\336E>\026\375\250\365\264\210\344\275x\310\342j\307\2669\245f\254\375VD\r\346\234\351}\262\265\031\236\245\301\357\200\0360\212\345L\240\317\231a<\313\320\322\022\226]\262!_\270\204\357\f\266]\361"
+	.ascii	"\360\372\271\333T\374[\304\020\031\232\371]\371\343\371\354\336"
+	.ascii	"\364w5\255_\366\262\205U\203\177w\262O=\365\307\356\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\n\003\215\013"
+	.string	"\342L%*\200)I\007\313\020\223\242(\212\242X\306G\2060\00330c\211"
+	.ascii	"z\003\376\033\360\217\b\324\316>\262fQ\333\315\222-\245L\001"
+	.ascii	"\177\257TC\226=8|\333\320\031\246\360.(|O\330\363!\354\300\340"
+	.ascii	"/\370'\370l\340t\223\213M\227\335\216j4\215\b)\270#)\2323]\005"
+	.ascii	"\370\245\212Q\247\310&\343\004GIC\t\022B\2202\202\333c\316\272"
+	.ascii	"\260\243\005c\335\375\374\030\200\261\224\021@\b\256~\260B\266"
+	.ascii	"\251\222\305\332\231kG1\253\243\264u\\\177\312\335\bv\250\261"
+	.ascii	"\305CJ!\033c\200\202\031\262\252\016\0208f\306h\222\024:\307"
+	.ascii	"H\021\271Y\344R\205\304\016\037U2k$\344\222\346JIDo+6\347\253"
+	.ascii	"4S}\t\361;\024\020NO}\233\270\301W^\212\3742\020\355\370h\341"
+	.ascii	"\252\206\024@u\226?5\255\300\357\362\314\277}\"/\237\2141\023"
+	.ascii	">\222u\362\377)\356<\3620 \345\026\270\bhw\210\276\b(\345\334"
+	.ascii	"\233\020T84\337\270\342\037\371\323z\334\004h\221\363T\213u\207"
+	.ascii	"^9k\270*\023\226\232r\r\2134\333\354`\224\235\033)\\\276\031"
+	.ascii	"\330!\223(\224Y~\017\177^k`\261D\333\331[o#4\315 \021\321\300"
+	.ascii	"i26\2426R!~\303R\340\253\211\333\337\344\204G\024\n@\262\243"
+	.ascii	"\361\331<\202\016\375\017 \005"
+	.text
+	.section	.gnu.lto_.inline.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\231\024\205I"
+	.ascii	"j_\214\023B`\250M:\367\345\214\377\357\252S\305$\002\"A\336\346"
+	.ascii	"Ao\200\t*\r\201&\243vZx\007\037\344w%\320\332\021\341/\254\r"
+	.ascii	"\272\303\233\321/\354\377>\3426\347\372#j\222\266\033mv\223\266"
+	.ascii	"\267\224)\026\001\025\001(\001o\272\320z?j\266\326$\ny\3234\315"
+	.ascii	"\363\276O/\375\363r\361W\177\366yMt\332\214@]\370W4\303\333\274"
+	.ascii	"\367\362 \177\027\367\336\256\177\304{\305\336\245\217\240t\225"
+	.ascii	"d\320G5\237\302\245Z\004\367\226\220R\3472d@|0\362\030\216j."
+	.ascii	"7W\373S\030\236\320,\322xB\253\330%\351\220l\216\304U\332\347"
+	.ascii	"K\231\207G\310\t\275u\247sV\263q\224(\t\253y\356TD\372\237W\223"
+	.ascii	"h\361\027R\272v\357\335\235\374\377E\376Y\264('\016\032\001\375"
+	.ascii	"69q\326z\\\313\362\275\273\260oo\337A.\336{s\377U#\345\316+\322"
+	.ascii	"Kh\376{E\372\b\315\315\247\347,Jv\357Uj\242\365]\337\265\212"
+	.ascii	"\2261\3360\362\355\205\235\346\220\235\"u\207\2352A\271\337\212"
+	.ascii	"\356\260S\026(\207\373\037\325\314?\003\036\236\221Q\275\305"
+	.ascii	"}\276\242U\324.\032\335\371\027\276\362\373m\325\367\336K\376"
+	.ascii	"Z4\b\032\030\267]\377\207\320\334|\326\242M\320\300\270!\375"
+	.ascii	"Ng\n\013H\177\255\374\362\357\t\373\212[\0327\362\345Y\366}\371"
+	.ascii	"\037\277\376^\201\375j\276\006i\031\240.\305z\363W\255\273\272"
+	.string	"\346\247\3465>\025\362\251\271pJoooo\fE\276B\213\200\"\237z\005.w\326\352414\260\250\333\256\345\245\"\236\212\3307/\275\267\336[\342\n\363\245\367\232\367\236\325Zk\313{K\364k\255\267\326Zk\255\265\326Zk\355m\275\367Zff\022\324,\214\210\207_\362-\177\273\227/\177\255\345O\236/\003\345\275\327\0045\262D\321\221\244\233\246\331m\276\315\267YE\335\234\271\203\207\336\254&\260\357\244\321\250\201\3646\253\271;\255\245g\367\373|\237\277\216QcJ\216\372\263\336\037\235\021(\t\033\356}\326\313\367\314\227\231\231o\220B\341\343\343\314\351\335\027H\221\374x\363R\276\006\373\230\206e\213\017\330Eh\2449\263\257\265Vk\357y\332\373\267\027z{iU\277\257-\357\313\033\354<_s\306\n\274\313\013\3546T\276@\351\335\f6X?\277+VY\257DF\017e\304\306\233#\007\232J"
+	.ascii	"\366T\304\334\177_\206f\246\023\347L\255\201O\351T\304\252\004"
+	.ascii	"\374\361+\337\327`}=\220\366\317[Q\335un\376c\233\223\347\254"
+	.ascii	"\316soW\201\363\254\255\265\374\273\226\277\252`\313\321\221"
+	.ascii	"\245X_\205\rC\f\215H\336\236\326\236\007\366\235>V\316\350\353"
+	.ascii	"YE\337\324(\222\347\366\336\252^&\007L\244\177@\177f\323\027"
+	.ascii	"z\310G^\303\020zE_\350!\311\303\036\3441\264\b\f=\244\347G<\374"
+	.ascii	"ABh\026\315E\267\250\356\214\325\\\252(yk\372\356|*\342\223\254"
+	.ascii	"\332h\003N\022& e\263\305\020\"\372\022\367.\273\310\006\315"
+	.ascii	"\314\306S\315\365\377\244\220S\275\205E\025\321\371c\326\364"
+	.ascii	"$>\357\250y\340\302.\343bF\243^\265\020\265*c=\2642u\216N$Y\317"
+	.ascii	"'\272\021\332\216/\367Rub\375\363A\256\377\365\221\311\361\211"
+	.ascii	"\025\357m:)n\271\203\364cu\035\032\205\324\006\354~z\006\315"
+	.ascii	"j\330B\263\340\363\332\350y(\204\264\320[\307y\355icKP\003\017"
+	.ascii	"S+t\250\251\177E\214\023\"\2763\250D\314\210,\322Q!Z\b\365)\277"
+	.ascii	"\340\3138\247\207n\214\215\027\030\357\n\200\264\221\031)\257"
+	.ascii	"\350\327\030=F\247\227\027\3222'"
+	.string	"_\334\252\026\335\323%\210l\t\367\307a\t\315\325\303$\244\204\336j\252G\320\261\b\205\233\t\372\004\3021F\366\303\302\272\350@\272\023\277\227E\006\237 \335U\370\030\027\231\036\232y\016\0258g\004\232\020\374\254\273\304{\257\375\201\257\257,s\030\2011\342\303H\351\006\312*\245\207W\273{G\247\030\211y\224\243_\030\341\001\305\214\211\016)\350\330\241Am\177\363\002T\254\r\f\034\276\376\216Cv\312|'p*bR\377Y\355voW\257\337\004\212\236\036\345\233~\346\031\344\177\202\0369\036\225H\241\240a\304\334\3003u&\366\221Pk\270\207#\177\006\300\314<j\206c\321\022\337\257\3251\332b\f\t\321g\263\242\303\353m\346\322_+\030_\301\210\3432\367jOP?T\242 j\201E\323\260\221y\r\020R$Q~\214\301\2211\277\260\034\232\313+FnX*\322kh.\024\375\246\243\354x:f"
+	.ascii	">\356\264I\2745\\\333\275W\200\351[\262\001\202*\250\322\n\031"
+	.ascii	"S\n9C#\222$\005)t\342\t\030\024IA\224\326X\017\022\240$5I\343"
+	.ascii	"\322\024\315H\312((\325h\fCF\200\243\r\325\315\006\032\337\027"
+	.ascii	"y\332H\253\255\331[\201\242\224e0\013s\264E\001{\250\002\260"
+	.ascii	"\005\335\262?\242U\035\346\2130\220\334\337\207\016\2022j\267"
+	.ascii	"\366\273io{:E\323\177\223\251y\204\242pF\225\234\026\220\305"
+	.ascii	"l\357\314ho\323\356p\327\023\207\235\237\247Q\025\271!\373\260"
+	.ascii	"[\222\311>\t\177fil8|\"\024\254\346m\264\274\331k\002\370\374"
+	.ascii	"\306;_J\217\244i"
+	.string	"r\376\343E\3177,1\334\004\345\033\220\256XtQ\231^G\034\003M\276[0-\251\016\026\273\313\303\315A\313yt[\337\256\363\200\235\322P\205\370\365(\372\223\246(w\374\030@\\A(\262\b\304b\302$`nm\274NeQ\327\341\245\006C6J}\335\016\370?pf\321\004\375\1776\2248<\207T\272\376\016\256kT\245\341b\331\rN\377\3065&\3748\252\357\020[\335l\366\335\023\204A\371\210\016k\2513\r\251\271\311\304w1.u\005\016^\247r)\033=PN\232~\3247\022\353\177\377?S\335\322\223\311\223\362\320\325K\211\232\001t\b$\301\027\031u\210k\273@N\324Qj\273C<\332w\227,\210\220\2363\277\324N\324\224n\211+\231\020\261\265\340)\346\3651\0216\217\037\330\350\007G\337\3555\205\223\334\242\371\213\350f\331\301\033\200\217o\"8\220\\`\242<\335\033\224\371\324\377\356"
+	.string	":\231\026jT\034?F\370\024\364\035`4\034\235\242fj\321\335\017\003\313D\310\365\307mG\357\332"
+	.string	"\206\34145\313$\347w\251\341\267\260~R=K\232w\240\211\363O\275/\371\022&#;\356P\275\203|\374}\327\366M1\006"
+	.string	"\307\305Q\b\344W\345\231\tb\201\270\312T\370\205%A\003\373P\231,N\351\205\277\220\304Vb\277\306\215\300c\f\257\\\235\306$F\2341E5\223\365\323K\317\004\262U&5\210H&\265.\032\301/\213x\246\f\267Jh!\366\007g\003b\265\213\216^\234\023\236_RY\264\005\204z\330}\fz\331\363e\200\202\243\346|JF\353\230\t:z2!\206\026`\275\213\364\3663\235\\\031\3164\262\354\361\203\tT\200g\306\026\342\341$\356\203(\351\032\f\374\317:\342#\016xx\363%WY\366IE\026\206\001\243\245\002S\024f\350\306)\b\025Td-\230N\361\006\262\tF,\"\021\367D$\rN\333\240V\214\201\277\354C\250| \257\302\024\240\352 \027[\211H\360\362\310"
+	.string	"\240\323"
+	.ascii	"X\234S\241\251\320\261!\204\306GF\005\277\230,\345&\230"
+	.ascii	"xt(2\207\b\rk\031b\304\024\211\303\t&J`\250\316$o\315*\233\222"
+	.ascii	"\016R\017N\201\357}9\211?\310\251\221\343\2640\375\365,V.\246"
+	.ascii	"\016,\275\355Mp\227\331,X\025\354\n\031\202\030\221\313P\202"
+	.ascii	"\024X\023\374\323\260\362A\302Y\"\020\036 kS\343\303\254\024"
+	.ascii	"\020\216\377\370+\001\344\037"
+	.string	"\253\252\013\356YC$\352\332:\206?\212\252\235\254\021\350\217\211\345\242xP@\237l\305\231\273\r\241(\025\0346\270\373;\020\320g G\301?\303Q\245\272:z\231\333\357&\321o\0071\335\n@\264\3036\256\036\030B\231\301MC\321\261B[q\361\251\250\221\206\203i1pU\237b8\372\025\037\366G\026<\277\276\252\200AZ\210\276\313_\212\333\345\331.z'Hs=l\354\213\371\233\231\302\367\212\030!\313\342\237\323\226\026C\325E0G\256 ~\317\373\262\032\376\232s\f#J=\220\372d&.\204\220\241\301\240\324\013\030$dFZ\202$\270\013X4\007_\204\340\"m\246\205\274\225\375\347;!9F\375\315\035\254\343\365\357\324\261s\207\016;v\350\270!\303M{\202\351>\3644\001\\\342\253*\234Cd\027\260\302\027\004/\244\301\346\2201\340\31159\332\347x6\225\230\214\236\304q\027N\032\022"
+	.ascii	"\207!P[\004F#|\210"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\313\r\r "
+	.string	"\266afA"
+	.string	"\257&\351"
+	.string	"s\205\365\252\252\037U\334\252\005WOY\304C\204\332]\232\253\303,j[\241\007B\245\177\275\201\37690|_\227\354\031\310\266k$\310\273\351\320HxU4\373U\177\373\244\021\"\323\016K"
+	.string	"U"
+	.string	"T"
+	.string	"\256\215\016\271\177\272\347\321l\325\f\301\374(<\333i\260\255\264\225\321\304+\342!\0271\307t\017\0314CM\367>\232\355\235\350\374\314\360:\226\352bp\0273bK\272kb|\233\325t\315\317w\220&6\255\246\203\277a\007z`\002,S\306\324\207\203T1\337\343\321\212\214\340\203\037\352\316F\261j\236\315\271\360\332\036\243n\231\357pC\241Z\273koJ\347\212(.\257\271Hi\247\331\301\rN\323\211\341\365\223e\231&\313\262\026%\f\303\260^\013c\2117\301\355\362\034\356\230\2675\336\211{\230\031M\352\3448"
+	.string	"\"F\324\270T\274QB\037\007\275C|\207\204U\314v\303\323]\230T\242]\272A\374-VQ\003\350\375\212\325\234\343=\026\241\370\007\n]\305\303\305\"Yp\344\251\330\323&U\361bq\255\350*c\325\037^\001B[\351=\350\036]\244\233<\005x`\231\025\374\321I\f\340\250@\ts\324\0345\020\215\2040\037i~t\317\267\003\361\r/\213\025I\023\304\002\341\246e\323r\322F`\200(;\251\244\222.h\206\b@L\022G\177\271\241"
+	.string	"'^\277P\274\004\244+\305\353\210=\356\305\275|\315<z\3225\363Z\304\215\f\314\302SJ\001\201$\250\201AS4\"I\nRI\233\001\261\004\2048H\245tv\022@\302\024\204\361@\tJ\247\234\021\022RP\220\222T\n\323\032\236^\3542J\231\306\221\216\320 \375\237e\251_"
+	.string	"\214\376\"\0039k2\020LE\313\017\371\335\314\277\211g&\003\277\006\023\222A:\310y\2722\227\f]\200$E\033\230\030\277\017?\032\201\204W\203J\347C\302\341\272\213\342i\320M\264\337\301\206\b\304\024=\027\302\301~\301\031a\273\027\037i#Y\205\"\251l\030\353nN\204g\210\206]\250\205\215(\323\357-\325>G5#\217zUS\n8\365\2308\026b\003\366Sv\351\231\203\340f\273\f\307TV\226\372\212\307\230\352k9U)H\274\177\020\264\025/U|EZ"
+	.string	"\257O\315iih/\336b\216\211$\241\243\340\321\363K\317\244Oz\272\\2X \377\t\271Z$G\312\262;\260O\345\254W\033\226\033\f\327\275\211\254~"
+	.string	"&\3320\315A\300\315\ng\2729\r\200\241\003\371?\b\213\253\206\320`\352&\217|\335\334,\367\357\231\260\306\307\335\217\350\036%\220\267*\327q\311\201\273\345\023\377a"
+	.string	"b@\007\375x\236\330\017m,\004\373\301\037*\f.\231\362\363\274\032\347"
+	.string	"\311Q>\247\002\207(b\247\264>!\030\236\367\241Fs\200\376&\310\322\325?\355\251Q\341\352\f\377}\345\246\243\005O\235\325T\247\022\351\272C\354.\300\350\267&\332\024\257\204\t\3174\033\035\243\366\353\213\024\375} &@\215\352+t\225\227\016L\367\241\005\356/\370:=^\234\315\310\255\274\bm\311\322\247\301E\241\316\262\306\221\246\006\213~B7\323f'J`\023\266\237\302\270\262\254W? \323v\265\310-\254\222\200oZ\236\314\341\221\013\271\337*?\226\200q^\302\372\022\037\242\236\342N\t\342\232d\206Q\353\025\265\333\221\303\202\""
+	.string	"/\247\200\t\304\250g\243;\r\211\005ER&\256\300\"\217\253v\341\340\201:\350\230h\312\035\371<\304\342\3509\001\f\001\025"
+	.ascii	"\244\366'6\fV \216o\251)o\303Q\004\362\207\365\037J\006`Vo:~"
+	.ascii	"\003F\321\320\321\017\312\006\376\304\235-\240'\317\323'\242"
+	.ascii	"\203S\340P\251x|\354+\265\223\"Y\220\200\f"
+	.text
+	.section	.gnu.lto_.pureconst.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375 _m\002"
+	.string	"\362E\022\031p/\244\003\374G\377\377\317\377\377\377\315\006\211|\302\250\214\277\376\215p\264\003N\343\031\307\370Ed\361\343*&\212\233\270\304E\034\304\037\356\360\206c\270\205I\341\tG\270\2033x\301\t>p\201H\0178@T\247\2526\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\276\004E\025"
+	.string	"v\335]?0m\223t3\372\241\2032R\340\3414\031\343\200E\336.\013b5sv/\220\351B\005\\CS\016\343z\260\322\220Y~xEF\230\004\306\21444E\354m\314\310\354_1\222n\266\021\271SI"
+	.string	"I"
+	.string	"N"
+	.ascii	"\317]\342y\034\263\304\216v\265J\016'\"\206\r\261Ax\tq\352\334"
+	.ascii	"\205\204\301\233\266FY9\ra\306\216\367*\034\035\033\263`\n\332"
+	.ascii	"\255\222\333\036\302\263\363<\243\271\325\374l@\211\250\222\346"
+	.ascii	"\371\0256aUl_l\371\t\210w\bMPE\232(_\315\300$\200/|\320\200\305"
+	.ascii	"\030\343\237\203\252\212\3337zf\276\321\rFI\027\250Q\374\225"
+	.ascii	"\211/\312\ra\206>\205\260\222a\324\271J\211sJt\331(\347\334\026"
+	.ascii	"y\337\3439M\177\320\347\326"
+	.string	"\344\351\240\001\016C\342jS|/\007\025BL&\004R\b3\357e\342\213\037u.\223a\260\253\255Vt\005lJ\330\210i\253\0018\025\t4y\025\221\305\320[h\227\337\373\275'\032\367\371^\2064\232\225\346\334m\362\256\310#\264\366{\0315\352\\\222\004{:\236\217H\247\332\363\021\351L\376\n\355&G\237\t\256\236 =9\332\020,\210\237m0\244y\310\201\217^\374d\200\022\013L\340\020\245\221\207\027\343Hi\324a$\203\210\0225\213\001\036\232R\3509\241\247\204\236\326\224\351\311\231^bZ\006_\346\002\200\224\250A\271b\312J\222\244\205\315\200\002\221!+\333\021\020A\251\244\221$I\352\f\007j\030\312\275\025\325\375\233\233\034|\t\240\212\035L\277B\332\b\364\360\222\256J|'E\021\b\3357\362\003zp\271\031\310\3565\355\342o\353\221\222\246\226Q\016\222I@\n\003\231\013\031\031\354\201tK"
+	.ascii	"\2468G\363\036\263\221O\316\247\006\005f\224)Sy\342ED\342vo\226"
+	.ascii	"\337\375\364W\034\360\013O\004\376\261\265\2632\225\256\366w"
+	.ascii	"n\301\204=B9\271\322\305\364\341\372\006\337\243\032|K\3340\212"
+	.ascii	"\035h\330\211\224\355\013S\356\234xb\212c\023\255]\274d\n\244"
+	.ascii	"\330#\t\353\214C\334#'nP[\213\215\331\2412P\005\346\2371M\340"
+	.ascii	"\037\275s\216EZ\327\332\235\bi\3771~\320\323\330\335%\230\\\207"
+	.ascii	"\371\232\353\2214\324\032b]O\356\030\233,\247c\004d7\252\024"
+	.ascii	"\241\321\001M-\233\017\035\364\316\200\315\207_/\270Gd\265\356"
+	.ascii	"n\301-V~\374\304\230M9{\023]\345\335\260\214\225\257\030\017"
+	.ascii	"\013\365Me\340\351\266J\007\245\b\r\372\245\360\001"
+	.text
+	.section	.gnu.lto_.lto.1348ab607eda480,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetMspPort.20.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\001\001\235\f"
+	.string	"\346\027WB"
+	.string	"\223\232\016\230\243\257\264@\264\357B\250\234\t:\332p\355\373\021\277\b\300R\352\266D\216Gl\3245h\355\304\245\304\211\017\033Qa\251t\372.!\200F\001\277\231\310\367\241A\346\334\232\326z\023\271S\nA"
+	.string	"B"
+	.string	"G"
+	.string	".\270\277\244\234\300nhF\306\356T`\221\315\243\347;\322\343\346!\322\2439;\307g\212\365\340\370 \323cw)Eq\356\220\363\037s"
+	.string	"\036Kw89\330]C\217e\304\255\267\235\300\366\004\373\033\002\236\035\324\023\366\243\335]k\310>\314?}\376\361/\277F\320\347\b Q\300\306n\210\232\037\373\305\031,l\237c;\202\366\002\006\334a@\237\bJ\320\270\320<\200\223\203\201\001\333!\006\204\347\320\276\313\0033U$\343\355"
+	.string	"\201\266\264"
+	.string	"\357]\241\n\035\337\212v\236\324\266\036\003D\241\305GT\373\302a\\\233\335m\340\277\320\200un\254H\221\036=--L\250\300\032OPE\3345$\221\253\332Z\006x\317\035\032\237\007\355\034\240l\223\227D\221$'\233%\241\202\314\252\023-$\300&5\031\001#\3312\f\302G\273@l2\202RY\231\324J>\332Ea\260\252\2132\3114j\344\200\261\217\314\250\r\3032\2123\367\321j\310\221\307\247\242+\276\332%\017\025"
+	.string	"5\003\220\347\214w\201e\342\t^4\270"
+	.ascii	"\200\314g\025\f\243\322az\367o&\3042\266\230k\354q\230\013N\200"
+	.ascii	"\275\2400\030\026\240B\217;\274h'\031"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.21.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\357\005\275'"
+	.string	"*I\034\020Fp\\N:\033\246\317\350\355\\\327\034(\304\212r\250\343m\332H\"\317bju\3538(}\0332\374\261hq\337\316g\343%]\352zYf\215\n\353(\203\231y:\276\217\370\367\347\225\360\231\356\326\244mB\344N2\364"
+	.string	"\337"
+	.string	"\354"
+	.string	"P\007\210\313\025\313DWYr\356\304\275\360\277|\214}b:\212?B\204\361\370Z\225\305\263r\303\302\220\036\375\273\234\311>\t\023\324/\243\316\225\313\302\026>\024\322\243\374\344\271\250W\372\300P\374\361\241N]s]\227\017\216\362\203\364(/\037\340\036M\017\274GYe\216\033@\365\323c\024\233[\3275\330M\370\307\252\377\375\370x\351\356\242g[\225/\244\026\006\007F\213\370\337\271\243\302\222\362\266\254\"'R\236f\332\231E\373s\267\214\334\307\363\332\352z\212\300k\213\353\273\323\001r-\310\333\262\270\316"
+	.string	"n\224\314\271\231\321\336\223\310\215\315\225\267eu\235FE\222\234\371\264\252,\272Sr%\347\265E\344\347\t\354\n\363\006\244EuBx\2632\344c\267VZS\266\317|\002,sI:\257-#\267;\f\353\272\262=jm\235\201\316\314k\314<\203\031M\022x\342\234\375\3059\256\355a\230\234)\233\207\231U\374L\016\224)\226e]W\nfX\360\344\276dI{\031\035\367\250m\224)\246E\311'\243\243\310\311\221\231{\034\215\005\0038\353\272\"\211\371\230\026|(G\371\005\f\373\343Q>\214{\264@\3337G!C\375\376\330Q$\027\231\261N\312\366i25*\255\346 \373']f!\r\373#\201\006\242\261\3215\247\232\310\274,\332\376b>\222\223<q\334K\230\217\024\030\275\354\\\364\2603\321\305\316\005\b\b"
+	.string	"\016}y\026B-\003@-\007\241\226\201\256\345\237\317\262\357Z\356\245\226y\327r\332\263\274\343Y\276\3272\232Z>\257<\367\316\262\275\226\277\300\206\033\271\266=\r\267\\\261\372\354Y\331\320\264)/\373\303~\261_\371/\231O\3067+\013t\260\316v\277\356\365\275\302\342\370\372\227\344q\252\022\n\3749\247\243~\261\332D\005\263*\330=\352\353\213\201)y\335S\237\\\316\333\0065\n\257wU\306\320)\033\330\264\211\272@\025\325\212\375\221\017\024u\332\025\272\324\214uG\366L>\351B8\260\231U,\252\026\373cQ\337\354\275\244\225,\272fU\023\231\315\256\220n\227\307%\352\263\275\021\355\270\031Y\276\312\345\366\325.\367v\360\374\f\367g\3375\263\006\016\366G\242>\327!\354\341l \0268\271"
+	.ascii	"g\327\226\n2\212R\312\366y:\233\020\351\272N!\361\327\276F\304"
+	.ascii	"9\242\304\375\261\304=z\373qq\322\316F\373\306:>q5Q\351\323\254"
+	.ascii	"H\221B\361q\217\236\335sWI$\027\345\177\250\001\002\206\366\027"
+	.ascii	"[\333\032rm/\376\243\356P\037\265\013\2566U\310\242\355s\253"
+	.ascii	"\334\023<\206O\302%\341\r!\212\032OJ*d\b\2071j8\001\233\234\226"
+	.ascii	"vOC&\022\275\035B\0318@\360h(\315\300\301\244\341i\310\324\324"
+	.string	"\343\244\b7b(\r\205N0\232\234\226\2028\224b,\005\223\206N\301\b\006\230\251I8\f>11\r\203\276\245\324{\t\237W\232tM\251.6\177\314\237@\213\263\004\232O_7\260\255\316\274\207)l,?\352\362\351\023\320CP\027@k\220\023\324@\r\240-\037#\227\r\352\363\215q\013\232\003\033\250\317\274-\322%\f\216\314\314\177\256\353\272\376\364\027G1\222\361\0244\237\300\356\266\342\223'\224\300\312Hv\036\265\200\373\372\213o\366\363\n\223\324\250\371D\207Z\250\255\316\316\254\032\241a\177T\320A\r\333T\023yj\037j\243F\335\234)\302\215\245\375u\250\313\254\036y\035(\244\2539dR\216\305\210+$\310d\323GD\313rg@i\2501(\204\fs\n\0314#\"$\3326cP\0021\346\\\365\020hG\"M\2411\023\024\324\347Y>\033A<\306\0058\226\376\220\324Li\307M|\345"
+	.string	"9\376%@\bf\241\362D\361\345\360\301\262\\\316\306\224\360\266\262\241\006B\276\02110i-\245\034X\354w6+\"\221Z\324V\264[\\\205\210\034\3776\236=\343\374\2541l\346\3020\013\253\307\252\036&\273\253\304{&@?\312\307gl\326\320\237@\036>0"
+	.ascii	"\352l\317P\003N\001\316ja\354\001\350-\261\036MYH\304!\343\220"
+	.ascii	"\343\243\016n\240\376\252\344\222\005\217B\324'\211\363\035*"
+	.ascii	"V\rG`\253\n\351\0321\324\363\254\036\344\036t/\361%\"\006=\f"
+	.ascii	"d\226\310\341\024(\"\326\206\002\025\030>\214\207\f\031\255\331"
+	.ascii	"A\264&\205\017\205\307k%\255\362\363H/\021\376"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.22.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`G\002\265\023"
+	.string	"\326\344\201I\320\322(\035\323\2005\373\302\314\314V?\270N*!\301\342\317\276\t\224\376\243\332\347\243\034\026\f\026PcJ\355x\003`\004\330\b.w\n\357W0\210\277\3328@\211'0\333\002\254*g\220~\316\330<\020!d\023\271S\nk"
+	.string	"f"
+	.string	"p"
+	.string	"'\342\247s'"
+	.string	"~\212\037"
+	.string	"~Zf+=\307\263\337\245\230\341\001\331]\224\212\260\376\313\335\240\224=\004\347\247R\346\377\374"
+	.string	"\b#\333m\366\3603\331\335\222\333\314\267\200&\301\221\0238\2377\377\276\224\244[N\311m\303w\362\240\204\343\274K\232[M\352uO\240\203d\273\341\\\206+\273ki\273u\270\305\333\266\261\315b\313\b\001;S\305\331\271\231\374\356\256u\307>\335\347\027\037t\207\007\272uJ\313O\372"
+	.ascii	"B\233\032\005\214v94\t\331\336\234Q\342A?\220\375\235\317\013"
+	.ascii	"z\371\312\324\210\320\320zV\304\347|\235O\237f\320@v \030qM\204"
+	.ascii	"C;\025=vs'\237V\021?\177\262}i\277\347+d\367\321p\001\273;ID"
+	.ascii	"\2739\005\016"
+	.string	"vJ\0052\365dtf\022)\252=\201%os\t\213!\275\232\316\254\373\361\301\306\2478\213*u\334\355\250\311%\333\024.\343BXt\244\022\243E2;B\361\3420^\300O\251a\321Q\020\037\177\350\005\201\016\233\355\fw\321J\341\331]\007Bo\341\362I|\332\002L\336\366\351\303\300\317P\345\r\033\216\352\365\274O\"\235\0343L1\262Iw\003\261\321\305\362\202AX\305R-\254\026\227\224\312\004\303\252\305\345Alt\275Db\243\213e\304*\224\n)\326\270\202Ix\301Z(\027V\252\205R\2150\024\212\001\273^\253\021\025s\271F\324)\267\327\035\373\347\242\320M/Fi\241\342\034 g\236t\216\220\246Q\251\264\343Q\223K\377@\305\031\006T=\351u\237>t\220dB\320d\223\234&Rkn\032\340\311C\r- 0\002\204\034\273y\315\3707\2064\264_\363\b$\310M\335\3674\033|\t"
+	.ascii	"\341r\301T\030\271\007\205\340v\t\301\267\264\267\001\263\216"
+	.ascii	"\351^@\226\030B\224\023#\030=\300(\332\n\2255\034:\026\340\315"
+	.ascii	"\233\353\016U\266R\252-\205\bV\tb'l\305\031\306h\206\323\257"
+	.ascii	"]\212E\270\203\252s\375[\317\346>\332\253\256\270\323R2"
+	.text
+	.section	.gnu.lto_mspSerialReleaseSharedTelemetryPorts.23.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\\\002u\023"
+	.string	"\026\344~H\340\322&\035R\367Fh`\335z\326\to';\022S\032Y\r\017\220\334f\226~\366\227\272\024\265z\362\213:\266\266V?\233T\265U\244\260\270\0061\2242\036\"\210\352\326\355\343\341\f5\fB\004\001~B\310&r\247\024h"
+	.string	"d"
+	.string	"n"
+	.string	"I\2735\223O\233\200\237\017\375\262\217^\333\331\333\206f\200\226v\327\244!\254\357j\267'_\377\274\331\251|\371<7\340\001i\224\301\376u\"\273\033\"\233\351\020\304\244\007\340\004\316'\207w]I\322mG\210LC7RCb\274\355\222F\026#\365\264\227\344(\2152\234\313\317\301\356Z\216\262\r7x\3337\266\037\330\262%\327\333>\211rr3?`dNw\027\246:\263k0\371U\035;\374\217\317\335Mi\355\244\245J?"
+	.string	"\250\324\203\203\004i\267&\347c\215fQ\211\377\374>\227\366\355\257\360m\016_;\213\327\177\\\27626 41\031(\340\247k\037\361>\301\027\360>\355\367\3704\207\237\tP^\367y\001\327\304'd\213\021\037\n#\031\2059D\252\332\250\t\362\243\033\200\210Q\230\355\324\213.\2047\334\322\215H5\274\341x\320\374\203\306MO\2473\267xRE[\216\030\331\3036\205\017\265|7\\\212\335]"
+	.string	"C%"
+	.string	"fcI\350/\\\274O\251\337\r\247\202\346\273p9pc\264\235\341A*\005;\273\313"
+	.ascii	"\350-V\376\210O[h\311\217\237~Ke\215\021\247\323.q%\201\325\212"
+	.ascii	"\200r\235VR+,'\025\021\f\250\025\026\b.q\305\002\261\312I\205"
+	.ascii	"SJD\265RX-\225\211%uR\231T\304\226\351\204\304+\026J4\271V+\321"
+	.ascii	"\024\326\366_\325\3419\030\304c\004\243\261Og\036\320a\206:E"
+	.ascii	"H\323\310\243w\273\273\236\316\374\342u\032\352i\237:r\224d>"
+	.ascii	"\304dNN\002Rm\356\031\236\311A\265SN\001. P\002Q\312\252<\317"
+	.ascii	"\030\322xK\nm\255!+j\337\263\361\220\210\005:\364\241\031(+o"
+	.ascii	"u\331\025\252\300\257\327\314\353\241\035:\346Mn\031\336I\201"
+	.ascii	"8\2065\210\327\005\303\t\0340\224C1\006[)4j,\350\315\317\365"
+	.ascii	"\0163\325He\203\2120\210\247-\362\2363I\306sE\220\031\216\033"
+	.ascii	"\330A\345\271\276[\231{i\257:\305\235\366\221\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.24.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\261\035UZ"
+	.ascii	"\n\214\f\037P@P\322\351k\025\330\367\0203\251bq\302,\250)\240"
+	.ascii	"\271]Z\356\007B0r3\031\360\301\214\210\363U\255\355!2\262\347"
+	.ascii	"\362AR\237\231i>C\273<6.\24436.\244\373\203\020!s\022\355\314"
+	.ascii	"\252\252\252\252\252\210\270\250\211\020)\367N)\245\314\001\304"
+	.ascii	"\001\350\001\327\231(u\036\272\316B\251s\320u\006\n:\377Xg\237"
+	.ascii	"\240s\217u\346\271\316;\251\263\316u\316I\235q\256\263\361:\337"
+	.ascii	"Xg\033\353\\s\235i\254\363\314u\226\271\3161\326\271h\235\211"
+	.ascii	"A\347\241u\026^\347\340u\276\327\331^g\325:\247\326\371U\347"
+	.ascii	"n\030]c\3559C\220s]eD\301\254VT\271 \314\334\235\204\231\370"
+	.ascii	"\314\0370\023\2319\365^K6\315\252u%\006\225;s\033i\265\017\272"
+	.ascii	"\351A\327\254\353X\337\223u]\203b\247`\253\274\3268\266\325`"
+	.ascii	"\337\330V\231\231\247<|\300W\275\326C\306\325\332S\266=\327u"
+	.ascii	"\355\370<\372\252\251\2468H\035\243\240\236\234\232\230\226\224"
+	.ascii	"\222\220\216\214\212\210\206\204\202\200~|zxvtrp\2147654321E"
+	.ascii	"\342P\030\274VM\337\257\270\207]XM5\305!\006>\227:V\361((\274"
+	.ascii	"~\242\242\004\317\235\246x\023\323\322\235\235+%\3059\322\221"
+	.ascii	"\2236zK\207\330\234x\221\r7'\032\272UB-\034\361  $j\376\343\223"
+	.ascii	"\326=,\224q\2459\017\321\216\0163\210\347\350q\241\251\3408\267"
+	.ascii	"\312\b$\035*\343J\301o\322\246/*^\235\244\211\364\270l\2448/"
+	.ascii	"\210\365u\031\027\231\333H\251q\3228\231\351\001\346\343e\322"
+	.ascii	"b\230E D\035\035\306\225c\307\017\221t\b;kK\007\325\033C\356"
+	.ascii	"\255J`\031c\006\253\034v\205`q~\314\2211Q\030\327\215WC\200\331"
+	.ascii	"\031\201\206\315\260\321\251\036\327\226th]\327F\322\016\243"
+	.ascii	"\253\205\377^\236\024'\\\223\246\221\037_\035\306\205\303\205"
+	.ascii	"M\001I\270\033vi\305\370\255Z\327\225}\253kFs\207f~/\314\334"
+	.ascii	"\201\271\007+L\237\321C:\"\r\366\032$Tp\022\330\275D\220y\027"
+	.ascii	"Z\024\0319W/\n\\\027\335\240X\031\376\222\255\254\bp\3206\272"
+	.ascii	"\021\021\376\262\277\217\307\020\260\240\277p\002E\311\344\031"
+	.ascii	"\330F\267\035\367\227&,3\005\336\302\004q\306\022f\234gY\005"
+	.ascii	"\t\365\332\2367\364\320\313J\f\327Y\022\033e_\355:9\002\030\356"
+	.ascii	"0\f\327\311-!\353j\303\326\022\207\227\022"
+	.string	"\237z 7`3\237\350g\226\022f\3222\243\350\032\222B\254\350\223\033i\231S\264\0372\347B\2112\377\332\255+8\362\004\252\376\222\333\313O\017\341\t_\230\1777vqz\351/\371\250\223\266\304/\311(\302\306\327\302m\340n\241G\byz\301\3620\314kX\2554dG\333\367qs)\376\340\343\216\201\370\342\206\026n\030\206`\256pc\021n\261\302\375B\360\016\217;\357\246I\341\236b\311\352\270\355Te\216(\334si\036\024n\271?\022\307\355t\366\255\325E\017!o\334N\272\255l\253A\006V\260=#\314\325\204\225\251\2330\263\f\301u\305\352/\031\334\270\206 \266\305\313\272\256Lg\353\227\0072\363\005\315\304*\270\256\353\007\356% <1\b\246\320*\267\007\266\325\376\024d\364\370Rkfy\224y\r\253?\032\215\316\371/\231\373\243\321\350\034\377\030s\257u\227\350fw\001B\347*\241\363"
+	.ascii	"Bg\022\354<\342:\213\260\316\002X\347\020\3269\200\353\f\"u\006"
+	.string	"\340:\177H\235=\\\347\016Ag*\353<\025t\346`\235\245\256\3631u\216\272\316P\251\363\223uv\262\316M\327\231\351:/]g%\353\234d\235\221\254\363\321u6\272\316E\001\312\300\254\023\376L\346\374\007\276&\316\267W\332\027e\240\021\360\346\215\1777\257\262\345M\340~3\330t\251y\033.5/4\313CkR\351b\334\027\242-u<\321\0344\206b\332\312\356\321\t\225x\032-I\232\277Ztw]\214\253\013\372\245\224\306b\365#\346|\376\001\375\222g\276\370\035\306\306\2477\363D3'ZS\306J\314\313\344\305\274\312\026\007\265\300\251L)\336\271\220&~\261\016\371B\2638\264&]7\222n\021\342\212\374\374\222\275\247\2454\225\r<]\327$\036\0063\211\237\263R\362a#\313\243\251\317/\335q\354\275\350\3711\341?\230\2164\266\030hh\027\220.,y\032\340P\2224,a\376\r\237\371"
+	.ascii	"w\"\300e\313/\370\303\3573f\025e\240\360\231\023p8dP\032f\313"
+	.ascii	"\357\276\360\233\311\254S\006\246D\236\314\340y\263\n\213\356"
+	.ascii	"\374\222\233X\205\205y\376-1q$\027\206\371\327]vl:\277d\025D"
+	.ascii	"\r\030\\l\210\213\234h'm\360[\013\033\237\002\236$\370W\356\013"
+	.ascii	"\264\211\263\006\370\374\263wX5\214I{\277\313\330\362\230\027"
+	.ascii	"p57\002\302\263\201\235v\300\266z\277\223\264R\026`YV\220\233"
+	.ascii	"F\332\364\227j\360\260\217\226T\337~\332\246\244\201\302\213"
+	.ascii	"$\325W\223\374\2415K<3w\340D\222@{\353\272\202`~\300\317 h5\347"
+	.string	"\310\247#\3752$\322^o\3715\322\376\247\257\342\205\360\245\345QfN\341A\220\377\302\262.\320\246\013]|S\263\001\322\367\fk\343\333\220\232\035M\006\003\023\2056\276\345\240\371%\216\366\221\3459\326D\257\031\036\3545\340\226\354^nbvZN\300\302|\322E\267\250\314/c\200\3411\271\332\350FCL\353\250\363\022\332\350\206W\224\3002G\3407$\240\013(\232\203\025*\030\330\200\205\325e\024Q\031\234\270`E\n\026&6`au\324\340\202\023VG\024+X\034\243~X\305\006)V\0349P\241b\305\221\270\266v\272\376\030[\2764&\316`\367\225\275\002e\342|\356+;\202G<We\275\326\272\256+\325\225\261\272)\347{a\214\216\203\210*\"\376\266\230\203n\351\242\334\234T\037\336\230\223y\024\340CL\021\340\211gq\320\246\b\177\367v!\236.\200\017\021%\200\027\236\301AA\310yx"
+	.string	"@|x"
+	.string	"\234\037<|{5\331\223\213z\352\276\366\360\303\251\371\272\252\n\016\352i\352\377\307\330\233\327\222\016M\2304;<q\254\215\252\215\255I\365\304\026mSH8\374\324\221\346\016\207o%\3554\246\004\332tBZ\2514\251\277ZQ\350\021\355\351\243\216P\037\265\002\324\323\267\327\221/\312\300\037\177\366fN?\244\351\235>H\323\013\315\002\241Y\272\350\2046=\0200L\246'\373\302\\b\362\301\364W\013\020\272\364<\224~\351\227J\257\262\001\352u\321\251t\345\305\272$%=\322\237\200Lz\242Y\227\253\025\036\354\277\220^\307\321#=\016\344\321\013\315d@k\032\275\215\2427z\032\311\242\177.wD\357\025\364CDB?\364]BA\337^ju\312\300*N3$\243\276\322\036X(j+=\300"
+	.ascii	"/\343\007\351\350\227n\344\363O\366U\344c I\320\302\374\003z"
+	.ascii	"f\003\036F\022\217\310\277H\002=Q,\013\264\371\363J\004\340\266"
+	.ascii	"\374\212\274\213\237'jeAk\372\274\026\362\007o\313\257\347}\276"
+	.ascii	"\225\201YWh\217\205\300\257 <\257\322z\372J\315\266\332\363\315"
+	.ascii	"\326NbX\240\315\242_\362m\244\345\t\203\344\371\253U\005\332"
+	.ascii	"\334\371\033\2229m[~C\216\363:\317L@\001\336[;?\344\342\2618"
+	.ascii	"\347u>\235"
+	.string	"\013\202\"\250\202p9\021S\244JFD\222\202$Y\306\222\f\2101\2222,\317\003\022\300\0021\206d \307 \"\221\f\032\251\240\250\255\034\217\304\212\244\324Vl\365*v\253\325\251\346~1\246+\223\346\304\231\222\023\366\007\322?\212}B\237\311\315e\213\225\023`L7\322\375\024#\230\266j\332\220\335+\354.\251H\344h\350\003\206b\033\f\317\320\331\370&v\367\257sCTs\026\351\340\244+P\004\353\242\317\017\2255Y~h\324\371\301\3502\3537)D=\327\344ZP\363\244H\366\211\023D\371\304\247r\255\303\311\252\345'*"
+	.string	"\n\343\200>\251\231gU\200N\355\314\320a\227\324\226\303B\346\212\036\241\336\207\370&g\243\254q\333\331\\\2067l4\255\035\340k}\261\265\371\356\256\211\251b/'\277\022\217\264c\2214\036\332\226\210PnS\310\0202@\204\323R\216(\360\375xE\341\024\310\220y\310g\3772\232#7E%\267\2615\273`\377!?\\\226@\0025\275Q\224\355\354\363K\362\331\203\211\036K`K\004}S\305\343\326\007\216\331\305d\276)\024\337`\232\374\0346lR\312-\316\277\006\357\345\365\224\376\230\360\307l\"@\007\026\307\203\256\36647\301\220\377\247\351\005\r\360\301D^\370\212\306\030IX\334p\362\265)\317\037\335\243\346\325t\233M\177\224\021\f\376%\263\016@\001\352\267\346O7\263~Y\2422iV"
+	.string	" \247\311\226\"\t\3455(\204\274!\236?\351\t\357\005^\337/d\344\204\002\311\246\2351\245\314\321K\230\261\223\337\255\303~D\354\351y\2148\003\301\236\245\240\333\f\366z/\017\005\215\024b\275\n\314\253\303x\234\336\323\200\201\ne\030\3045\240\233A\236q~uu'\257\332\241\213\373\331\223\322*z?\026\253\251"
+	.string	"\205\334T\372\356\230(.W%\347\3055\264W\330\231\2124\275\304\200\275+\337\236"
+	.string	"\n\314\305\232v)\312\256\3100a\202WS\366`\347\037\201\315\337\265\216.\332\250"
+	.string	"y\f\303\356#j\t\207\261O\202h\210;\024\246\223\224\351cYT \231rTYh*b\0061\207\222\032\337\357Q\302\231\246\303\026\025\3602q\267\021\0210/\300\342\"\314\020%\217TJ\336\312\330;z\330D\371\036\304\022QbS[.:\013\312H\321\f\333A\335\223f\027_\352\224\326\377p\006*%\351\324w\251,\225p\3724\nOa\350D\006c/\253\356\312\236\334\337\002\330\2504\362\n\216KR\341 \217\032\362o@):.\fc\217\370:\343\304\0257M"
+	.ascii	"*U5\306\275?\331G\353\035O\336\002nh@\303\3651\250\211\224\351"
+	.ascii	"cP\023)\323~9W\002q#Q\242\t)\370\354\301\265\377P\237\314\367"
+	.ascii	"\236\301\2314\245\034V\023\2468L\002\235\024f\313\027s\204\321"
+	.ascii	"\207BI\321AG[\334\314\317\240=\347y\326\330\323\347\376q\235"
+	.ascii	"\321'\035\257\226L\007\325`\355\037\"\034M\363\221\314a\214>"
+	.ascii	"3\365\203YH\251\336\243\202\256\344F\223\374\232^9oq\030\344"
+	.ascii	"`\271\262!cY\230\207\267\345\224\"\351\0255`l\217\354R\017\002"
+	.ascii	"\227u\032\240<Cj\314\243b\327\271B\206\036&\320\202\375\306\234"
+	.ascii	"\261\365]\031)F\304\247\203\314\215\267\\y\324(\231\357,-\345"
+	.ascii	"\224\247U\256\300\322\331V\207"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.25.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\203\001\225\017"
+	.string	"\006^iE\360\256*\035"
+	.string	"\227\274\006\347t\026\013Y5\212L\337)\257\020kk\235\271\372gT\230\223\321\332\261\305\367L\337\343\214A\3152\236 \226\272\211l\205s\346\343Y,\233&\231\035r\004?K\365\026\202\310\336R\246\024U"
+	.string	"S"
+	.string	"T"
+	.ascii	"\336\350.\r @9u\020\366\332Lp1\241\255\230\023\364v\2035a\030"
+	.ascii	"\206\217"
+	.string	"\340\0355u\031WS\376\307\206\242\365\215\\F\r\353\325\001\343c\305\317m\006\346\264\253\353Si\374\200\362=\3551\204\255\326\372P\256\032\006sNk\353\243ps\267}\262\255\300~-\277\374\354\216\007\357\325\307\356_h\\H\321 \234\363\025\262\2302\022\306\203m\224\315\261\255#.C}\346\230\2301W\031`/sN\016'\350.\007\304U\373.\027\201:(\022 c\256d'\007\300\003\340.\273kp\227V},\345\235s\305\304\313\234 G\217\373\026\331\211\225\336\354y\334n\027\330j%+q\3169\2439\253\333Y\2151IyMBH\307\301\027\341.9\253*\\\030H4t\201\357n\366d#Q\002B\245\341\326J\260\276]\026\033\034\321\017\3546\343\325`w\242\232s\360\336t\237\375\232\203?\367X\037\"\217\005\235@\017\342(\304\024!$\202\020\352\034\362x\200:J\"\223\003\020\323\310\373\350"
+	.ascii	"\215\274P\311\344y\004\230\004\"*y'\022\251\344q\300\371\030"
+	.ascii	"u\277\256\305\250`A\206dUrY|\332\273\026*'\333i6\022h\331\r\267"
+	.ascii	"\273\256\323.UR\266\263\216*W\327e\333\033\001  \240\002\241"
+	.ascii	"\273\355\3771L\243\371\t0\315|\210\345j\325/\306\340H\020\013"
+	.ascii	"\231\212\362\360\r\247\357\2339\270%\344\226w\336\206\274\331"
+	.ascii	"\bm\030!\2135\214&4ph\204E\324\235\335\320^\236E\266\230\222"
+	.ascii	"\353@\211\230.\361\004"
+	.text
+	.section	.gnu.lto_mspSerialSendFrame.26.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`#\006U#"
+	.string	"JAP\016H\200ZN:_\204"
+	.string	"\300\304}J\034\024\322\315i\241X\337f\257\3420\372\223\017?8\354\2433\226\377\263t\224\272\205\236\360s\353\246\212|p0m3\b\030\232\334\345\265\2412G}?\361\026\036\305\323h\204\020B\344N2\323"
+	.string	"\277"
+	.string	"\320"
+	.string	"\367*\231~\262\005u\t\331\214\bJ\326R<h\233\242"
+	.ascii	"\211\t\"\3365\246\265%h{5\2163y\327x\003ly\357\035\300M\026\315"
+	.ascii	"D\335\357\226\371g?R\274\362\304{\356\035\233\262\274W9\200\231"
+	.ascii	"\324\237\254T\231\231O\344E\212\314q\246\262,\231\242x\353ZK"
+	.ascii	"s\357\375\365\036\204\3764\377\203\376\354\034/~\247\246\350"
+	.ascii	"i\266-\362\263\276K\235\314!R\274\250\327\202\3614u\272\367V"
+	.ascii	"x\213\202L\2768j6q\245\231\221\263\246k\313\232<\332\323\\]\220"
+	.ascii	"\351r-^`\246\0011\311\030k\222\313\232\246\2000*_;I\243\031\224"
+	.ascii	"\345\206\230\377\360\202a{M\032\315\336\275\367NnW$\267\254M"
+	.ascii	"\235\356\275l\221\311\026g\2343\263\0303\227`>\335\004gZ\266"
+	.ascii	"\216\217\372\215\324wc\324E\375\276\223\237?\230\2249\206m\331"
+	.ascii	":fe\226m2\346\233\267\307\230\257\344_:\222_\351h\177\322\335"
+	.ascii	"\316\276+\377\336\341\316H_\362\037\275\3557\272\332_\324\226"
+	.ascii	"\211R\313C\251e\241\324rPj\031(\265\374\223Z\366\331Y\3561-\363"
+	.ascii	"V\313<8\226wL\313:8\226sp,\257m\031ggy\227ZV\333r\272\263\214"
+	.ascii	"\246\226O\325r\247\226m[~\001\241\030Y$\260\335\313\242\256\315"
+	.ascii	"\305r\302\365\270\333\277\374\341\336\314E\376\333\233\334\t"
+	.ascii	"\257pWj\226\227\312&We\356\336\013b\211\3253\362\256Q\007\030"
+	.ascii	"\037\367.5\270\215\370=z\355\272\222\204\231\013\275\324<\236"
+	.ascii	"\3665\257\177\f\222\323k\363\264\031w\f\333\332\351\tlrZ\251"
+	.ascii	"u\232\304\326\366\265N7\223c\220\234\236p\006\200];\251}\315"
+	.ascii	",\201\202=\222{\307\316\342\242^\273\200[\231\2567\314\246\325"
+	.ascii	"\346\002\335\221ve\3278\375/\277k!90+f\306\2508G\240\276&\312"
+	.ascii	"\001$\r\314\220\375\2237\271\200T\233\031C\006{\244\257\257\304"
+	.ascii	"\270\252\250\2553F\247\346L\253\313\326\31451\233\f\251\323n"
+	.ascii	"\034iT\320N\033\035\323\365\346\307\236\315\254a\203=\022\355"
+	.ascii	"\323M9\373or\267\367\336\254\256B\273;\244"
+	.string	"\2011\3325\314\263\266\231\201A{d\367\0011cg1\263\360PD\250\367^\004\374\270\342Y\224\312\343'\377\004\372\323\366\372U\306,R\304(*\341\223p\n8t\020\002H\254\"\362\244\210QT\302\247\235\241\320\203\007,\006$\210*\225\360)8\f\242\301a\260\251\204O)\220\b\2042\251\204OC()t\b%\325VWS\315A\002!\200\037\206\302+\016VWS?\252\017\300\251_px\365#`\304UV\302\341\217XU5\374\255\312{\363\366\030\237\006\216\024iWC\306\233f:Q\247`f\242f'\255\336b,\363^\033\n\276\374\347\320v=;$\244\201\021\315P\237tkfG\275\324Bf\204\324\030\265R\007\221\t\352\223N\315,\200-\352\244\006j\346\"\221\242\221c\030\240>\321\324\251\351\331\237f^\320\300\036\311\253\230\361\313O\247_uf6K\232\2623\265\311\322#\333\323>\315\374"
+	.string	"\002\027\237\366\311\235!uOSH\333\tg\250QLE\214S\304\310H 2\n\222(\215\001\320\002\021\241*\036\021@)f\312\202\024\246\214\007p\215\3062=\215i\242`\255<\254\303\"yU"
+	.string	"\221\333\274y\006=\234\227\234\004\367b0\374\2009\261\261\206\302\026wJ\3634\244yR\3173\345l\262\b\342qe\350\363-L*"
+	.string	"\373\t\005eKXa^)A\rIQ\233;\376\310\304\255\217uf\232If\245\b\037\2216p\023\206\344\022\277L?d\035\025\217B_C/1\374\363"
+	.ascii	"\354Y\nE\351\023\023\264\027\231\212\262U\013\207\362\217< \026"
+	.ascii	"\317\256L \226\253\022\360F\367\027]\215\360\213\247\252/\200"
+	.ascii	"=*?\343\212\020,Q@F\bK\270\0364\325zZ%T\207\372\233\340\277%"
+	.ascii	"\353\017"
+	.text
+	.section	.gnu.lto_mspSerialEncodeHeader.27.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\267\003}\031"
+	.string	"V\356\240H\300VQ:%f\272\327\016f\361\245\220\nQ\362\"k\030\307t\f\213b\263P\341$\244s\254~\027f\304c*\021\277\372\350pT\371\221"
+	.string	"bf\315\377\326\376\017$9\246K\314OQAg\37154!d\223-wJ\001\215"
+	.string	"\203"
+	.string	"\220"
+	.string	"\265\201%\310%+nT57\004\343\301\245}\241+\301\275\307\342\253Z\177\250 \325\332k`\006\341?\367B\333>\222'\301\331K\263\367\203\007\372\340\3205\201\252\265\262\f\334\206\376\233\027@\377\255\217\343.\206 \375\346J\234?\303\343\271(o<<"
+	.string	"\202-\0363n\234\246x\272\242\027\362\313\"\303\3064Pku!'\215\357\\\220\243\n\215\024\257\305\264i\352\361\345D\227>\274\234\224`\253\326j\271\343\315\270gn\273\206m\013\366>\tP~\024\233\017\362\317(r\350w9+\272P\nJB\360\031\365\237\310f"
+	.ascii	"\272\004\361Y\320\177'z\002\247#(0=r\264{<r\201\354\3578\216"
+	.ascii	"\243\367\307>\223\177\265\322\252/\371Sw\362\327\274\367\213"
+	.ascii	"+\035\212\322 \225\246\241\364G\245'(\275\240\264\244\322\277"
+	.ascii	"!\220\244\351\303\225Zc\214e*\226/i\310'\355\033\275\310\246"
+	.ascii	"\371w\033g\323\330\236NRL\241\260\362L\2744U5\327\003\bR\255"
+	.ascii	"\001\036\256\305\346FWP\203\t\nL\255\265\322\005\212\272\227"
+	.ascii	"\350jq\204p\031b\232k\1778\226\031\004\377\212\fD\200\037\017"
+	.ascii	"\261{\332\235+\235tQ\026q+\273/\272\202&R\202\376-\220\345N\370"
+	.ascii	"\214>\250H\016y\3403\n\256\317"
+	.string	"S\320\232\275\0212\004\\\177\212\024m\364\310q\316\005\2222J\230&\035\273?\306\375E\345\376\310\220\227\234$c\333\365\245\027\004_i\004,\\\261\240\223\322\030\241\257\237t\031f\367\324#\307\022G2\021\326\232\213\340\007:\264\330\315\006\353P\273\315ft`\027\\;.\022\340\016,\347\345\252\321\022(*\330H\234\240~9\220\271b6\330MD\3556c\351\304\\3\326\313vc9\3001\255\006\263\261vh4\033\213\246W?\353\376\370E\027w\024a\002?\317P\2657\272H\304\210\020\005\303\365\261\035\256[=\333b\212\005d\315\2566\265\342\332\0260\310\357T{\242\267t\313#C\272^\350|\252r\244\213\002\375\255\235\341\\4l\221m\030\320\345;\207\325~\253\202\212\030]\324\350P\2501@\245\024C\306\241@F$H\332T\033\200\002\231\271\353\001\021\300=4sZ\3308\037i\302\013\231\232e\274"
+	.string	"f\365\332\202P{Q\350\346\036\305\342\342\276\\\314\225?\242\302\037\204\004;%\341J\357\247\317\234\366\207\205\304\366\341\356\332\023U\366\300*\316\244\233\206\320#\225)<\263\206I3M\231`\306\242\271>2\357\t\273\262\377\240\211\314/\2070\212+\226\264\203\004qX\026\232KL\232\3372\366\214("
+	.ascii	"\037\004\205\036c{\356\304v*\004\t\274\226\266\332oyK=\031\277"
+	.ascii	"\025\020\267\302\311\341 \224p\237\202.5"
+	.text
+	.section	.gnu.lto_mspSerialEncodeChecksum.28.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`5\004\305\034"
+	.string	"F\265\271J\260\324Q:x\220\274\253,\254Zo\360\360^I\301\035G\215_\025\2067<\336\345\r\355\027\307\223\271\247y\035=\315\226\240\212Z)\3226\"l\\P\277s\3223\276\035,\332\247\306\376\247\307\342~\250Kf\266\021B\310\2262\311\244"
+	.string	"\233"
+	.string	"\244"
+	.string	"\315\367\261F\n\240\372\230XP\325Z\021\354\002\356\241\241\006@\365Au\3409\357~\307y\360N4:L\255MH\250j%\"\330\331yr\211\347\356\356s\\\007o\327H\211,\202\246\007\027H?\254\324Zi\002.+O\322\313\224'{\305y?\315\222\244\315\274\375\213\2478\242"
+	.ascii	"\001\006\217~\016H\021Bx\223\022X\242$D\342\362\025$qr\304)5"
+	.ascii	"\260\204%\342%\350\2432-\246\255[q\340\246\004\264\230\266^\202"
+	.ascii	"?\032`\tK\304\213\347\244`\217\331dPk]\006\006C|]\337\335\340"
+	.ascii	"\356\336v\351,\303\335\323\332M\273;:98\367\361\337\234\370\333"
+	.ascii	"\324<\352\247y\220_\366\251\357\314\253\2761\357\361\303\\\310"
+	.ascii	"\0373y]`\227\372\276\316\3532y\317\3465\233\267d^\262yi\363v"
+	.ascii	"\311\313%\357\007\334\320\320\272\320\244V\020\307,5\213\264"
+	.ascii	"\212\361\252_\352\237z\357~\367T{\253*\r\257?%\327\007\0179\200"
+	.ascii	"\316\223\337\345\355\207\274\270\260\345Q\300\373T\321Ye\230"
+	.ascii	"@\234\234\250\324J\234 \265\306\363H\351\214r\202A\245\326:;"
+	.ascii	"\271\021N*$\303\020\304\203 O\034D\025\031\004\267\272\353\351"
+	.ascii	"J\ny\3406\243\024\236\375\325I\306\307\372\305\263\360\006S\331"
+	.ascii	"\303e\332\227)9\312\325\216&/S\272t\322nM\357\215\364\024\305"
+	.ascii	"\234\274\330\033\225'M\025J\236\204\3344\335]\323\002f\272\373"
+	.ascii	"\262\346\026\202\202\264e\003\037\027\306\344\205\312\230\236"
+	.ascii	"}\367\226\343\003g\232\246\304\225\254_\037\255K\303tL\367\217"
+	.ascii	"_\215\036\037)\331C\006FqPA\273)C\031\353#6\246@=\3611\226WU"
+	.ascii	"\321B\321=\334\027(\337\024\240\220\370\030\313\306\216\307\343"
+	.ascii	"\361\005\312X\277\177\002J\361\267\324\343\343.\361\210;<\020"
+	.ascii	"t?@\344\255h'T\263\001\325N\234\255\007\227\013\332\351l\020"
+	.ascii	"\210v\267\027\316\326c\372`\360\371\2418[\217\356\007\250\254"
+	.ascii	"P\324\240\246\253\225[K0\344\023\244\263\355&\020\355n4\\\220"
+	.ascii	"\317\215V\323\355h\tp6Gd\323\3210\344r:\032\214XOk7\355\213w"
+	.ascii	"=\025Ib\356\364\322\362\3250X\277\230\230\221\265\241{\247\316"
+	.ascii	"PN\013\341\3316\355\352ky\365y\340\257\336i\t[S~K\275W\333\264"
+	.ascii	"\251\223\323f\0171\2215M\227\235\203\323e\017\035ya\332\244\315"
+	.ascii	"\002\037\210s\254\3034\331\377\3250\372\032\313\233\246Md\353"
+	.ascii	"\312\354\341\006Q\250A@\303\214RD\241\231\t$\230\231\244\305"
+	.ascii	"\006\240\002\231\301\251\016\020Xw\343\264\006Pl\330\2702J\177"
+	.ascii	"\007|\253S\334\321C8\260\013\031\203U\3214\217\026\202\262\204"
+	.ascii	"\027\217\365\201V\202\362\315\013\0208\332\230\221\223\272\252"
+	.ascii	"L\312p\200M\200\326\2416[\200\360mZN\001\306A*\3263\325uEi\256"
+	.ascii	"\303a\207U\336\013u5 \222\233fA\212(\242\355\230\3757\331\224"
+	.ascii	"\003Q\217^\003\263\214\211\t&c\344\001\206V\030r71\001\344|j"
+	.ascii	"l(\251\027>\317<\265\375\244(\004g\030*\255\272|\241'x\005\220"
+	.ascii	"\024\013\265\017\237\304\353\017"
+	.text
+	.section	.gnu.lto_mspSerialEncode.29.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\372\002\355\026"
+	.string	"\006\352\225L\260\020V:\360\305\3619g\003\0370\017\265\233\267<bs\366\251C\363\300\354|\325\t\202uh\206.od_\253\327~\023\035\261pb\217\204r\214v\264\267\236T\024\037j\271\375\314q{\322\231\340\206\255\306\234\2557\261\204\020\271\223\f~"
+	.string	"}"
+	.string	"\200"
+	.ascii	"RRT\367^\223\227\314\340l{\"\r$\354\372L\214@\261C6V\350-\363"
+	.ascii	"\205\356\202w\341\206\213\334\033DJ\272Wh\200M\316\227,<\231"
+	.ascii	"\231\317\342-x\314L\244\360\007\310\342\340\364\203\261\343\336"
+	.ascii	"\213\312>b\276$\0373_\366\211\363N\266\345\361{'\023L\031\255"
+	.ascii	"\300\2357I H\302*\004\210C\312\234\216\277\033os\200>kY)\367"
+	.ascii	"^\266+\360\303\271<3;`f\030\346n\020\226c\027\376\"/:\277><\273"
+	.ascii	"N\364\177\274xn}\3507[\226\311\323r\237\226-\313\362I\004T\335"
+	.ascii	"\260\341\270\327\303U\217{,\213*^\364\017\177\342\237\364\027"
+	.ascii	"y|\243\307\370\321\225nd\220\342\223\313I\343H\274'\351d=\330"
+	.ascii	"\365I\331\bj9_\376~\304\214\2312>\203w\342\356\274A\347\017\b"
+	.ascii	"\212\352^\035\226\363%\314>f\016kd>\330\365\001E\005A(\2529{"
+	.ascii	":\247QK?\222p\200e\202\375\372\352\220\235\033\242{LB\241\202"
+	.ascii	"\375j\373D\036\247\243\257{\347\321s5\354\366a\2561]\r`\005\212"
+	.ascii	"\027Q>\313\203c\366\243[m\366\227\256d\001\375qy\261_]]\302c"
+	.ascii	"<\376\272\307/\373fNi\366k\253e\276\3561\277\306L\311\312|\341"
+	.ascii	"M\265\363\336\213\302\244\312 \310q\357}\n\033\363\345\373\306"
+	.ascii	"\223URS+\210\033{\305,\354\331\366a>y;\310\334\n7\332\312\214"
+	.ascii	"f\006\303\212\331\251\304\354TR5Ua0\2307\332J\252\246\346\rW"
+	.ascii	"\323\251\264\226\234\316\366AC\223Ig93\247\2635\247'\031f5\225"
+	.ascii	"\246{\311\351l\350\2556\263\241\251\252COJ\030\227\243\251(\r"
+	.ascii	"\016\247\242 \302\373\016\362\fT\207\216\365\215o\365<\tY\223"
+	.ascii	"\223\235\303\314ds\312M\343\360\216\250#\357-\261\200j\210\034"
+	.ascii	"`_\375\246. \322\314\017\"\330\257\261f\355\\\021\335(<:\002"
+	.ascii	"\330v)x9 \220\002\2311\244\007AQ\246\027\3451p\277\320\3064\310"
+	.ascii	"\f!\235e\224\026\332\b3R-\177%X\035A-\234\204\005\032\252\"\371"
+	.ascii	"\226E\254\334Ic\334?\212.\252=\277Zi\255S\"\3029J>\246N\321\213"
+	.ascii	"0\322j62%/v64+T\253\232Sf\234IKR\341R&m\003\331\007\361\236_"
+	.ascii	"\231\203\31476\302\"\205\224\333\314\262t\304p+\3542F\b\b\367"
+	.ascii	"\335H6(\241\003M{\240"
+	.text
+	.section	.gnu.lto_mspSerialProcessCommand.30.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`C\003\375\027"
+	.string	"F+\233K\240\326Q:\300G\005a\346!GY(\323As(B{\362`\250\300kI\211\216g\317\013\237A\003\245\365\250\337\326\370\325F\343[\354[#f\t8\217J5Tqk\013\350$@8\274\220\"Va\372\3626]\343\267\204\354\235d\205"
+	.string	"}"
+	.string	"\214"
+	.ascii	"\247\211\365S\265\225S\332[\225(k=T2\302p\251\200\206\330X\251"
+	.ascii	"\0230\265\036N\305\270\3352\037\352Q\301\037\203.\240;\251\b"
+	.ascii	"\262\373\310\200g\316\233|<\231\231\357\364\247 s\217\362\270"
+	.ascii	"d\224\251\b#"
+	.string	"V\201u\367M\346\003b7\313\277\304n^\033\017\276\2746\310\027\276\304\251B\245ht\361[: \002\223\321b\034\2264+\304#_o\215\214C\326\312j\272\233m\321\330\342l\236\231o\230Ye\276(\002;\316#\307g\272\311:\324\276\210\362\\\307\216q\314$\276\246\214\273\371\365\245\027\330Z|!d\303\230\217B{\225\230_\366Mb>-\333n\365\273<\353\\;\326\337r\252\237\345R?\355\307\177vZ\266\247\345\023\210\3612b\342\252\233E\330\225N\232^M\317\372\273\202|\255\257<\333:W\360]>\357\242\243\013M)\276\272\217x\347\315\303d\251\247\360\350\324\202\002\343\253\273gn2OM(\320\226,\250`\301\276\3104\"NI\242+d%H(\032\227\325X\355\302<E\231b2\264V\330\200m\271G~\005:\213,\367\227i\267ve\210W\310\314\031\236D\203\202\245\356\306\361\221\214\330"
+	.string	"aIw\237)(v\363\027"
+	.string	"\221\013\007\324\223g\356\300\036N\0041\346\017_u\030w\006_ \306\f\342k\b\306\231HT`R\204\354\036,\375x\020\235\006W\035\341&\020\333\347 ;\367\301\341=P\031R\325\215n\241\027\371\001@=>\364g\252?\300\034P\215\361n\200j\257\306\353\355\324\037\232\343S\323"
+	.string	":\031\357F\004/\227\246=\033UEu\275\037\216OM_|jzYG\323\223\333\375Pu\307\247\2467\336.\227\336t?\365Fs\200{>\364w\003\366z\277\333\354\330/\373&\261\317\224\025v\346_\357rm\327^#f\266\227k\204\356\020\373\224\3355$\274\353\377\222*\023X\227\331e\016FM\260/\332\256mF\216d\321\025r\214\345?qr\344\003B\250qP\205\fB\204$\030\221H&\310\214\332\240\002\0211\263\003\020`h\322$\035\316\024E+\254q\376\311\021\333\342\242\260\314(p\361\223xK\252\016`\017\n\241\221j\264G"
+	.string	"\037\002\336$\266\261\340OcF\341\r.\374\234A\255DOl\266\305"
+	.ascii	";0\027q\f\2503*\030\"\026\031\322\233\212\215;\002oq\206\324"
+	.ascii	"\351\325\256\264p2 j\277!\020+\214#\001?\325\206\326G\017\n\""
+	.ascii	"\004r\267\353a\207\020\f\215#q\225\234\nM\027j"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.31.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\224\002\025\024"
+	.string	"\206$\201I\320\362&\035B\234\003\215\322\002\202\027\253\350&\213\026R\240\225 3\004\001\300\215\"k\260(29^\031\214\3763\217\020*v\326\324\3470\266OH\312\314z1\t\222\003\3541\004\317vd\342\235S\317o\301\b!\233\310\235Rk"
+	.string	"i"
+	.string	"l"
+	.ascii	"\020\204X4\325\312s\001<\375\311S\336m|\315\341\021\031!Tk\252"
+	.ascii	"5)\345\324+K\202@R\315y\033\315II\025A\264\223T+\231\300)\340"
+	.ascii	"\251m\177\3500j<\236\220A>$;*t\212\234j%U&\037\300;\005\237\362"
+	.ascii	"N7\305\307\317\321\177\371\356\005T9\353\261\371\374\026\324"
+	.ascii	"Z=g=>\367\3366\002\333.\366~\001=f?\216\364\001\205if\267~\344"
+	.ascii	"\002k\255\253\031/\016\005\202V\234\3724\336\351\367\373\311"
+	.ascii	"\341,\035\221\270\231Q6i3\027\205\375\256\356\t\333\323\251\223"
+	.ascii	"\277\311m?82\375\001\230\366D\246)8\335}\323\353MO:}\001\177"
+	.ascii	"\342q\362\021b\251\326\235(\250\272\203\336\020\372\355\307}"
+	.ascii	"\3325>\321K\217\310xQ\315q3\0016\203+\255L\246\343\276\2455\247"
+	.ascii	"\0225\333\350\375\366\357G\311\351'\340\331\r^\266\f\360l\007"
+	.ascii	" \020o\355\007/[\274\212\360\034-\336\322\234\016\232\215\256"
+	.ascii	"-\341%\005\257\272\245{\235!7\026\216\003C\267\324E\356i\327"
+	.ascii	"\316p\033s\277\273\236\220\234\0268\326"
+	.string	"\360\032.\340\\\2222G\263}\355\r\247\341\301+\373\345%\313\253\323\nA\0020/V\030\302Z\337\213EF\204\225\274X`^\2540\204\255\210\242\253\005\223M\210\211a*&\206\353\226J\007V\214\314%\276\304\304P\365\212a\205\252\226LT\251\240\030\026s\311T20\230L5B\326;\265\006n\026\307\343m\246\253\325\204\202\343\376\246\333\355\251\335\222\007\r\350\300\274\321\211F\332\2677z9\016\201&\013\256=\326\306\030\3633w\025hm\0346 p\002\221c\327\003k\216\035\265\367\332\020\330\326\021\367\272\307\270r&\\v4,\017\234\303W\256\373\267\340\245\021^0\207\303\272\005\367F':\234aQ\352\001\270\210\0047F\213\234\213{\021z\2515Q\324\017\207:\\@j7\202\233\200k\360\310\343\203\006\306K(\005\354LLP\024\321\354\300\031\003\023&\"h\203\207\310\027\034B\302\177\210\025r\231G"
+	.ascii	"\003\n\177\036S\333\311"
+	.text
+	.section	.gnu.lto_mspSerialReserveFrame.32.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`n\005=\""
+	.string	"\026?\334F\220\234Qcb\372\001\253\0229%\221\267Z\351\337v\340\323E1\022\242a\345\035/\3263i\376\377\237\3774\362\246\024\272\326\307\034\034W&\002\300\234\024H\237\361\214\361\017H\306\254!2\231D\263\265\275\367\336R\246\024\316"
+	.string	"\264"
+	.string	"\310"
+	.ascii	"`Va\367^\017O\016\305\305\265T\220W+C\221\030\301{\2736\240/"
+	.ascii	"\025\220/`\022w\344\375\to\3249\204\321e\005\364\322\027\260"
+	.ascii	"\354\3453\340\366\2068$X\241\275\306j\265\376\212\305\t\334\353"
+	.ascii	"\303L\327\275\302\006\006B_\332\366\227\334\312\205w>B Q\263"
+	.ascii	"*-MYa\367\nk\026~\307|\211\276\200\371\322\376\370\3562\3644"
+	.ascii	"K\322\326\235\317\273\214F\005#\314J\254G\024\216\243d\2045;"
+	.ascii	"\232\374\013\215\037I\203\372\342\344$)l\301\372\222\343k\"K"
+	.ascii	" \023\251\033\241\201\243\232g\272\004\246\334\r\235|6N\236\353"
+	.ascii	"\013n\270\031\216\331\362\331\270\355-\231;A\214Bf\276\027\266"
+	.ascii	"\236\026\356\275\256N\276\250{v\333@\3339\273\344\020\264\251"
+	.ascii	"^\215c\233\304\215E\350\275W\202\357\025\342\004:\344\245\317"
+	.ascii	"\302"
+	.string	"|y{\256W WaRL\256\224jj\013y\325\002\355\3334M\305l}\330\256\3769\326\357\203V\367\274x\363\274\312\275s\342\255s\341/\340W\177\216\253i\337\232r\313d\325(Z}\242\325&Z]\242\325\344Ym\315\352ZV\377\300\211`R:\252\266\3301\302\013\225\216]\260\322J\325\213\177\225\237\370k\375[\377\224\233\366\355S\361\273n\245\nU\222.\244\242\215\344\325\272JQ\020\250`d\301\241/o\273\360\263\036\345R\316e\332\224\001\267W\305%8b\313F\005=\341\365=8\006ez\025\216{\254\377\325\301\306J\206\353\257Q\346\307cwl\217\235\340\205\251\215\203\317,\217\rJ\303$%\263\246\335\261\006\262JKZ\323\"02\005\227jj\324\"\b\363\224\303Z\322\276)\216\326\255\275\225k\030\373e\211\375\b\324Sy\224\241;Uk\333\210\352\235t\254n\352\205\345\331\276]\214\256\332"
+	.string	"<\210@\310{\3575\321\343\225\327/6\345\254\274\361&\214\313\353\227\026\322\226\267\321\364\277@\330\b\200\214o/\363ey\243M\2226J5\365\263<\301\025\030\257\036\037\304\030\344\212\265\300.\276\227\243\t\336)-\376\026\253A_d\276\374\n\336{\031\034\213m5\347\361w/\357RV\343\352t\241\304\202w\3522\b\266\241\032b\250\032\335\204\210rD\346Q\b\\\n\023"
+	.ascii	"J$\2210\272\t\345\344n#F\244\300\260\"\t5\272\t\331\222l\031"
+	.ascii	"V\330p3\243\233PND\t\023I\207\263&r\200\302V\224\273\351\206"
+	.ascii	"\220t\270\232Q\221\rW#\312\351j\016\016\370\b\351\226\253%\035"
+	.ascii	"\035\345j4\341\275\365\341\026\346\317\374H\212@5\025\321\037"
+	.ascii	"t\254\310\f(\305\363gN\263O\266i\326\026\224\354\222U\220\367"
+	.ascii	"\366\250\260\006Kfu\354\217\255i\230\220\234\026=\355\207\037"
+	.ascii	"\224\341\030)9zKG.\250\005\272B\217\005\222A\305c\003\306K\257"
+	.ascii	"\302\2715z\331\360\235\026\350\247W\312\247\351\361\ry\261+9"
+	.ascii	"\022\261O\355\323\323'e\320\177\024C\326\031T\231\246\242\r\272"
+	.ascii	"\314>\355L\035ky\304#\303_\250Q<\204\020C\310\214\210\230\004"
+	.ascii	"#\211\222\016\200\002\231A\252\016\021p5eCA\022\025\322\001H"
+	.ascii	"\036)>\377\343tP0\305\227\215T\242\224\022kx\225F\037l\361 \226"
+	.ascii	"\200\367\247QK:n\313\207\234\311\350$\240\243*\204\2662\220\373"
+	.ascii	"\264~;\232SNi\302\367\216\271\243\024\304\270}`\354\r\220\330"
+	.ascii	"\214\361\306\206\227\356\367\252\223\370\310\212\347\374\373"
+	.ascii	"=\020\254E))\347\361m\373\r\331Y\205\357\007\204Q\225\300\315"
+	.ascii	"\315\210V\203gZz4%)\373W/6\035\331z\351\210\260\215\336\202\377"
+	.ascii	"\035\311&_\346\211\235\220\024\262dL\225(\362\0035\307V\237\276"
+	.ascii	"\327\034\370\251\004\206\275h\005\222\271\344K\212\361dZ41S\302"
+	.ascii	"\0276\371\305\243\340\312:\022S\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessStream.33.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\036\nM7"
+	.string	"\272`@\025?@\346Q\007\243\244\356\177\274\236\201\027\003\241a\323Gr\252\340z'\030\344#\244\256\370\311\254"
+	.ascii	"\365\002\251\373\215\177\300\211\276\nxrp\337\004\336\237\017"
+	.ascii	"\233\035\262y\235\f\264\306\335\366\336)\245\024B\001&\001G\001"
+	.ascii	",\236!\315<\223F\347\356^h\016\326\016\027\203/\350e\006\005"
+	.ascii	"\211A\357UC\271\325t\\\273i8-\247\243\034\234\323t\332\256\023"
+	.ascii	"\004\300\245\273\2771i[f\260\2556T7\255qx.\275nD\244\241\001"
+	.ascii	"s\357\330\2137<g\004/-\315\335\275cVl\033$$\3305\315\246m8\256"
+	.ascii	"\276d\267\217pI\363sw\357\325\300\266\312 }\033\222\336&\364"
+	.ascii	"\222\001\327(\001\264&\351^\350T\253\\d[\365 3\2673\367Z\263"
+	.ascii	"\265\335F\244\003\334{\345O\364^(\025O\261\2552\264\237\326V"
+	.ascii	"\331nZ[\345\226Y\021\024\330M^H{\206\301I\272\367\026?\013/y"
+	.ascii	"\333\303%a\020\370c}\253\232\276\267\334\311\036:\335\274|i%"
+	.ascii	"\223\322Bg\007\201>+K\240\2770cP\350\306\312\234M;8\3714i\272"
+	.ascii	"\261"
+	.string	"f\332\201\254 \352h7\b3f\346\276\006gdQz\005ZIb\326j\352\324V\345I\220\251L\247\336\374\024j=\355J\230`\236\246Mer\b\r\231a\351\004Bb\240t\264\035\t\363\313\277\335\232\204\240et-\357\214LJ\273\357\303\275\227}\311$kfj\346\3661\263\020\346\037\223*\206v\314,:\352B\301\363\336\213\001F\f\357%3\360'\376\177+\307x\275\177\207\351}\353\351\024M\363\217Z\323\371\300E\361\322G\343!+\361\377\r.\322\032C_>\211\005x\3135\234\226k9\214\207]F=\363\f\032\336K\342\277\033\272<@\312Or\033\333.\2602_u\364\310\030X\274 l\227\207\256\323\035m\brp\\\234lw]\276\367\214\036\005\252\362\217\306\fM\372_\361jR\266\204\377\ns\333i\346\320x\2323t\236\346\252~k\246R\235\247\032\256Y\252\3334\023\273\255;\312\347\254"
+	.string	"\350\234\200u>\240:\033\3609\027pg\250\325\231\200\352< \350\374$tv\022:7\005\235\005\250\316\001Tg"
+	.string	"\356\314\264:\017\201\316K@g\341\352\034\\\235\201\252\363\357\347\314\272\263\217u^Ug\325\347\234\272\363\257\316\256:\367\b\250=/Al\322\264|\035\364.\331\243t\001\251v\276\264\235n<\335y\272\337\272\341\272\333t\277\351\216\323]\247\177\314\335r\334wz\256\365p0\317Z\332\234\036\001?\232\347\326\001/\365\336\347\351\007|:'L\257\202;Mi\253x/\237\276\245P\371\362\353\364\r\251\271H\255\255\235\200\031\353\342{3w\247&\275\367,J.\316\316\311v\247\306\367\330\367\320MZ\342t\336?c\n.\340\233\320\332,\033\250\200i\351I6\232>B\241\266"
+	.ascii	"/\340;\021\207\007\360\001\336\367H\351\374=\200?\340%V"
+	.string	"G\351\224\362\245\257z\342\377>\3033ui\277x/9|z\313>\311\303'>S\325\017#\265j\017\236\235h\351{\254\211H\255M\202\013\277\352\251\3542<s+\246%\023\366I3\355\250U\033\332y\020\276\206f]^[\360\211\237\341\375\221r\f\360\203\337\312F\277\007\306\351\337w\263Y\247\326d\277\352\275R\230\036\361}\317\376\232HY\306\313\367\330\001#\025\017\212v-[\353\346\275\364\375\203\270\262h\336\335\327'y\221\233Bg\326G\263Z\023Y\261\003\236E\232\203$\3415\"Jukj\326\272~\237-\360\336\323\321\020\254\372\234\376\372\f\300>\311\314#\272P\211\247'\004;\365\237\2640\237\350:+\226\233P{&\005\227V\271\211\274\214\346 \2656(\377'~\357\351A\001<\216(\214[F,_\215\037 \256\220W+\227\016\255#R\345qD\201\304\272\261\3628\2420n\031E\b1\356"
+	.string	"\032\267\214X\351\361\210$\201e\314\322\301e\324\nb\031\217&j\374"
+	.ascii	"\261\365#\013\250\345c\307\363\025\005\035F\034\310\243\017\032"
+	.ascii	"Z>v\024y\3400\356(^!}\024) \340,\255#\262\270\225\225\205,\006"
+	.ascii	"\241\267\377\n\363\207\256\367\032*x$\026+\005\337n\035\305\b"
+	.ascii	"\356\351dk\353\364\336{\227\272)\035\"\344H\370\373\251\314\270"
+	.ascii	"\247\223\255\037\035\231\344%\330\275\301\023|\313u4\004\033"
+	.ascii	"\205\244\025Sz\224VM8!\301C\351\225U9\025\024\025B\bOf\313D\030"
+	.ascii	"7\005L\336\035\330'\305\316*\245\001>\232\242~\342\004\244\031"
+	.ascii	"I\022^\227\357\375\036\227\257\337\243\361\241>\360H9\003\317"
+	.ascii	"\005\376\2007)\301\264\300\30039\231\025\313\026\370\025\315"
+	.ascii	"HjN|l\310\204\bO\252o\321\204\004\365-\347JZ\263\005O\261\226"
+	.ascii	"s$*\204\b,PQ~\222\t<\273\221\326\254hwoW/\331\225\036\326>an"
+	.ascii	"\313Z3\357ek\266\266\n\365=G9f\352\t<\024\2700\275\256+\365S"
+	.ascii	"?E\202\224\374Q\342y1\317\264\270\261\036\232k\225\372\177\213"
+	.ascii	"\333[\323'\200\300\250a\034\007\021cH\t\311\210H\232\2440\034"
+	.ascii	"`\002\221\241\253\362\021`1DW$I\013\303\001\306\205\352\217)"
+	.ascii	"h*\320\313\357 m\360`\200I\377 \243\375\215B\0246\031E\222V\b"
+	.ascii	"\220\222\230\236\261\273\266\240O\2408u\\%\200\321\"\271'\357"
+	.ascii	"cj\224\274\343\327\020\253!x\237\206\313I\002\210f\025\r\377"
+	.ascii	"G\3616\335\263j\264\bs\004\"\274\321\367\370\301\204\021_\343"
+	.ascii	"\325L\312\227\256\033}?\233\016\357\027\220\236\375\001\022\020"
+	.ascii	"\355\210\326\343\317\200.\233\327\363\267\354]\305\364I\223\037"
+	.ascii	"\211\346\243\031\336~I\037%\206\365X\020\326d\364\214\256=\021"
+	.ascii	"*\346\tB\330O\234\202y\233\0357\205\214f\324\212\276\240\231"
+	.ascii	"[\213\021\377\233\362=\252f}\177m\216\273\002A\221\026\2749\017"
+	.ascii	"v`\345\310'\251Gs\262\na\005\272\360\302VG\243\027\372\027\016"
+	.ascii	"\225>A \200\005\372l\013,wU\340v%\277`\374\006&@L\2607\021\215"
+	.ascii	"\017\225\347\255\037p\001ut\351mD\342=M\f4\017/\2336e\204\312"
+	.ascii	"\2630\t\001\322\320\265q\226;'Ca\034b\020\340\257\305\270v!\226"
+	.ascii	"$\240\227\017\365\262B\361\262 \237uG\034,\"5^Wak%a\376M\253"
+	.ascii	"\276i{\243c\\%\226\344\345\271P\346\217\256\004\343-Z\306\251"
+	.ascii	"\304\243v\002\2047m\356~\247(;tkB\351Y\343'\3465\236\352\331"
+	.ascii	"\310\341_\036\005Z\331\3015\362\206\375\262]8\3750%\374\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessSubscriptions.34.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\266\016\265G"
+	.string	"\252z\004\033<0\344J\007\001!\351\t)K?G\236\224\335\312\013\366*\007\237\2009WH\377/O\275\230\342\346\013\334\271\253r\342YU\225\327v\2007l7\247\b"
+	.ascii	"\306\bd\020B\366\336)\245\024\245\001y\001\244\001\315F\250\220"
+	.ascii	"*}~M\267\354U\316c\337_\017Y\366\372\246\341\264\035\247L\351"
+	.ascii	"\332\271L-}\207\220\367\302]\261-{mA\251E\034\352\235\023\274"
+	.ascii	"rIuS\301\277D\367&B\227l\240Ul\2027\356\350\316\324\314\337\f"
+	.ascii	"\305D^\f\222\250\317K"
+	.string	"\330\262Wn2w\032\356CC4%\265'w\351\r\257O\017\306\262\313p\233i4\334\354\365L\016\365\232\351\320\227\207e\305\262\327\302\034\177}T \357\275&\226\275~\023rsL\017\266MfG_\271\333B\260\3645\201\274W\360\252W\346\260\354\265Ju\301\036RJ\227mP\017\253\235\271\377\032\260\355@\037\275t\257]\240\304{\005\037\360\325\262W\026\354'\266\327e7\261\275r\313\034H\352\307M\223\320\367\006\2040\321\275\027\353\247pO\266*\330\f\345mGA=951-)%!=\235\315#\346R\311\256\352{\313\235\326Qv\340\366\024\333\335\342\2008\224\024\271+\375\264\327N\216\335\304\244\314\020E\216J/\331\201\323k>\270<W\302\253\342IN\032Im\340D}\232\372SYG\227\370'\031E\256J;\2334\325\013\3239G\232\017\216\316\217\354\3001q\\\342\314\002Q\344\254\364Rm"
+	.ascii	"\251x\250\355\300I\325\247\267+m\3558\347J\277\322l\222^\221"
+	.ascii	"\342\242j\325\275\267\031\367\303U\225\351pK\024)\216M}\300\207"
+	.ascii	"FQ\277\332`:\347\bR\334\232\372T\247\356O\023v\001>\270=we\206"
+	.ascii	"{/{[\234\\\263T3w\025f\206\302\374t\021[o\201"
+	.string	"0\032\271~\326Ox\252\305(\2265\326\320\177\320\326\357\303\006\301E\272\350\207\247y\221U_\353\235Q\224o\315'\371_\375F\323]\203K\020\2014R\363I\246I<9+\027\373\017\203C\357\341\372\337\222\"JN9\363\207\020\336mY\257>\346\001\363\270\366i\234\240\221\"\027\365\357\270I\260\376.e\260\317\210\306C\302\177\001\237V{\243w\347\377\216\273\330~\030\203|\330\\\0213\233\350:]\313{\257\026\367c;\227bY\305\007\333k\177\023\266K\r\343\004\252\371$\263`\232\377\035sw\231\353'\204\337\216YE\263i\016\321\202\335\037ZN3\206\013\335\330l\301\311\271B\0276Sx:o\265a\363\204>\323\254\325d\232\263:\260;B'63p:[1\235\0270\235\0258\235\0238\235\0210\235\0178\235\r8\235\0138\235\253\234\316\004\236\316TO\347\001O\347\251\247\263\200\246s\200&g"
+	.ascii	"L\316RK\316QLg(%\347\247\246\263S\222s\323\323\231\t\311y\311"
+	.ascii	"\351\254\324tNz:#5\235\237Og\247\323\271\351t>b:3\235\316K\247"
+	.ascii	"\263\322\351\314>\235W\247\263\332t\376#gg:\267W\r\271\267\""
+	.ascii	"q--\274\367mr\321}\\\327\3545\233\356\305\3568\335r\272\033\273"
+	.ascii	"\023\273\r\273\013\273\317t\223\351#\3465\334m\332M3\366\234"
+	.ascii	"v\344\322@\222\314\177\352\344\234 =\336\346b\235\376\305\250"
+	.ascii	")4\310\247{\300[3v\001\210\343\036\3002\267F\232\261\213\265"
+	.ascii	"\226\221O\317\334\"i\306V\tk9\375\223\324\217p\271\021\227s\372"
+	.ascii	"\206\223\352\221\fd\342p\335F\250\251\211\027i\301Z\314\255\223"
+	.ascii	"fl\241\260V\257\315::Am\204|\310\027\325\2366\346\266\316\335"
+	.ascii	"\332\273%\202\246O\252\243C\324\226$\360\213\2220\317$#]\356"
+	.ascii	"8\377\216\tt;\205e\372\247\336\225/Qi\255x\2671"
+	.string	"=+\347\t\333\247\3559\020\260\245o@y_\370\305O\235\246\027\253\364/e\260\221\315\0259\233\227\322Oh:c\332 \217\376\216O'\275\231\253q%\375\t)\036?<D\204\302\304\261\330\3142\365\336(\030:NW\220\322\361\203\034\343\223\254N\357G\261\303\223\273\313\277c\f\217\364f\203\216\317G\372\316\322\215\270\0221Z\364\374\346\"u\224t~\326c\370'l\373Z\021\032K'udk\311v\013\006\274{\357V\333\245\023\265~\035(m\364\202\250\235K\301-\030\266W\347\263tRG\277@\253o\276\205\367\306\350\032\006\177\364\315g\027\243S\346\037}\003\266\241.\346\267c\253\215\244s$\177\220\241:P\224\177\307\256^u+v\277E\273\024Y\257\372\302\273q\263Y_\b\215O\352F\262\302\017\362B\302k4\335v|\346(\274\326W\370V\323\314)uK\364D#\227\317>\205\251\362\325_>"
+	.string	"@Q\276\255W\276r1L\013\362b\327$\322EI+v\302\007:\302b\220\211\255\320\0214\240h%\316\240_\"\302\300\310\304\240I`J2\017g\3202%\032g3\310\302D\204\215}\231\311h\212\365\327\013\337\240\343k\214y\0266#\006\032\f\026:\"lL\f\305\031Y\230\231\031\032\330\223\314C\f\262\257\261\2612\016Ph\030X\231Y\211\033\320\261\246\033\320\261g0\b6\276\304\314\302\240/n@\307\260\310\304\276\306\260\300\314\240X\020\246\270\354F\230\031\326YY\231\031VS\360\366\333q\006\265_s\213\372;n\305~\240\367\244\342Ye/<\203wc\360V\337\201\013\336\252\260k\301S\345u\253\367\336\013\345\240\031\274\212o\305f1\310\244\320\031\323\256\030>1_Q\r\336\024\260\243\"\371\3368u+"
+	.string	"t1]\t^\301?#\004o\340\023\374\n(\272\346\300#\3706\341a\272\016|V^\240\203\266\360\006\036j\315\311d\001\007\254z\002_`\252c.\304W=K\370\305\213\300oI'\375\232\262\274@v\341B'm\3447\307D\365Z\372\370\006\274\200\247z\325Pt\272\326\347X\320\224q\210x\366\256\fx3\351\242%\177\324HY\232\362\266b\005\374\324\253\207Q\276"
+	.string	"/\340\325F\247\302\225\024\207\3707\375\323\313k\375\232\203\016\367L\377\002|\023\222\"\222\344-q\350\f\225\240l\210\1771\210T2x\323i7m\032\200o:\315\330\256-?|\204\037-\020\357\266\020\257\336\271O\023\342u\255\033\202=\215\007\3003\343\020\355\246\200\2018\330^l\036\322H/\221IROZLAE}\323K\375\003\212j\201\372\250o\">\355\202\372N\022\201\017\250a$\345\030D\206\206FD$I\222\264\006!\005\3040&!=\017\021 -%J\315\210\310\004\005\006\005I\007\216\022,\203s,{\256\241\372\253\313\001\255;\255\317H"
+	.string	"5\342\331\013\n\263\333\332\206\341\321q\030\tw\220Zs\214\321\320Y"
+	.ascii	"d\210\b\246\213\032\035%\302\355\031@\277\032\230\036@|y\033"
+	.ascii	"z\360\327\243\332\036\362[+\231~X\235\236\202\262\005\336\177"
+	.ascii	"\021\b\267.\025\315\245A^\031+[\347\365\225:[=\310S\262\220\332"
+	.ascii	"\251\254r)\233\373g\366\306\353\220\037\"\022\033\246=\277\r"
+	.ascii	"\013\030\263\236\2465v6O\232S\214:M\205\271\201}\004N\355{\200"
+	.ascii	";\302|\356C\364\245\330%Q\222\327\2435\024Sm \260t\2054n\212"
+	.ascii	"\005\250\\\257\022\203\r@\252P\033U\210\232\262\004\302\206\205"
+	.ascii	"\277\216(\272\232x&\257a\350Y\201\340\275\001\237\372\250\024"
+	.ascii	"H\263\3410Ft/\022\220\217"
+	.string	"\350\325\020R\3634\013\351\304-)7\031\342\222\234<\326\004>\260\266@\254k\310\265)\267\305\023\336\261}\005~\240\205n\376+`\253aw\3468\021o\213\234\006\275\375\020\352\353\026h\017\377\343O\301\225=\332\206\351\225\305\333\246\030>\364A\237\031l\026?(P\211\016z$\365p,\023\226\275\220\362sp\321i-Ud\\o\2258\245Z\250\220A\343;\305\301\307c(\235X\264t|\212V\224\276\326\263\212+\213\331u\250+V\306 \t\001F\326qg\334M\244h\034&l\006Y\322\034\355\244|\303;d\357\214P\216%\307%"
+	.ascii	"\227+\342\321\314\tP\353\262\306B=e\266\026]\300(\024f\254\357"
+	.ascii	"\305\262v\352B\005\253EkP\221\225F9\225\177\203\030\270\246\234"
+	.ascii	"3ly\r\021b\273\2112\213\254\205\246u\363\r=\322E\344\030\206"
+	.ascii	">\006\344\006\334\337\362\300f\306\230D\241c\276\034\257\231"
+	.ascii	"\232\265\276F\005JV\021{\331\006\243\303L\361\252=\227\304dI"
+	.ascii	"\371\367\336\265\0020\251r\017\n\233\036\351Mr\033\233&\306\244"
+	.ascii	"\255\262&?\343G\006\235\032"
+	.text
+	.section	.gnu.lto_mspEvaluateNonMspData.35.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`O\001}\016"
+	.string	"V\032aF"
+	.string	"\223\223\016\270\355\013\002~\"\300\205}\206\332\301\361\207\230(\353 '\245\321^ h\220\022p\363\246\n\255\366\031\034\342a\245\034Q8\017d\253\273\324U\245\016\310n\301\330\320\033Z\223q\366m ido\271S\nM"
+	.string	"H"
+	.string	"N"
+	.ascii	"\330\247M6\017\004)\213\022\241\205J\b\232\235\335\3254\305M"
+	.ascii	"\307\246\324h\362/\363\020\325\207r\214\345\023\304\347K\211"
+	.ascii	"\022\300\307r\225\f\\l\224\030\360\245\244\310\353e\307e"
+	.string	"\036U>T\214\036\n\273\353\250\372Vn\317mo\266'\330?\021\3270\fC\353\312~\353\237\007\177)\243\237\tP1\342;\f\216]\022a\220uM\034\026\266\377\261\255\321~ \301t\320\344\004\026\225#\002\302\243\375\027\207az\353\344\005vW7h\354\202\016\334 \3734x\021\3543\273\201>^(\244\262\316av\206\317\340\262\335%\361kJ\033\016\300\304\234\254\264\324\270\350\361\025*\027\227*\313R\257\nfr\244\"\020\333\242\323t\331n\212\304\237y\f\017~\314\247I%\361\252\022\354\363z\023-2~\264N1\264ATT\226\035\036HC\005\f\333\007n\013m^\200\222\327Y\030\221D\036\207F8\2008o#]\030\221DZ\007\016$\322B\036I\033I\340n\264yZ\251\353<\355\003\236.WW\231\216\033\327IQrw\027\21366;\326\321y\301\231\312\362\202\233`R\365U#'\336\004\036"
+	.ascii	"\357b\314\304\223|4)\334\006\255\2008\310X\013n\241a0\364|a\270"
+	.ascii	"\205\006\276\n\217\263`\214\025\007\301\232\b\357\t\024\201\207"
+	.ascii	"n\207`\31156*\214\013F\004\250(\300\035y\332d\020\264\003)~6"
+	.ascii	"]CPP"
+	.text
+	.section	.gnu.lto_mspProcessPendingRequest.36.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`~\002\335\023"
+	.string	"6#\177H\260\326M:\344\214\277#\031\305\035\277\245\201\251\0062\024H\213\337\211\275\036\344\032\3445\275g<\350ii\361g\337\266\277!\243z\303\325tz\330\260\314!\377)\375\323\257\351\334\357x'6\275\326\365\354\242\221F\310\2262\245p"
+	.string	"a"
+	.string	"k"
+	.string	"\007=\263\251Xt&\355\001O\350\206\303\311\234\323\265+>\273\310\nA\271:\363i\027!,\261nt\311+\202\021\336Rr;\341\212\220S\013'"
+	.ascii	"\032\321\263\240\006\236\013&@<=\227\222\301\317\023\t\225\234"
+	.ascii	"\216\\)\242BI+g\323\225\bv(\254Tr5\351\"\004\352v\243k\210\234"
+	.ascii	"M\225\0253\347\264\342r<7\200\3336a\033\306V\026\001\2438\347"
+	.ascii	"\214\340\333\250\371 \016\035\364q\302\203\337&\037 V\275\034"
+	.ascii	"\375\331>\232n\220\375\375\375~?\357\316~\357O\221\352P\325\340"
+	.ascii	"\252\345\252w\325\252\352\253\b\2101\224\273\020\2219E\374\236"
+	.ascii	"L(\260\351E\313\366\325~\215\027\315\336\3039\2019wSLs\372\034"
+	.ascii	"\270\201x\320\276\257\204\007\305\027\b\003L\376\017M\"\232\272"
+	.ascii	"$_\311T\342\301_7y4\210\354\367\260Mu`I\317\234\264\377(n.h\351"
+	.ascii	"l\032e\307\b.\005\237'\253\240\0222r@\r\"\205\024E\032\371+\224"
+	.ascii	"\273\275\243!6\275Z\271,Gv\210j\336\360\034\257\335+I\245\250"
+	.ascii	"\r\213\351q\272\257\322\325\226\366_\245\370!\255\307\360\233"
+	.ascii	"\341H\312\246W\266=\374F7\262\330\004\233\021\306\362\314\013"
+	.ascii	"\007\231\227\214f\304`3\302\\\035^20\327\214lt\275\2648fC#s\335"
+	.ascii	"\304b2W\3137/\347\356tk>\217;F\3169\247h@\303\265+Xp\261/\334"
+	.ascii	"\tD\200\250\226\250pa|\220\314\370\322\025$9\301\032\240\276"
+	.ascii	"Lh\317\320\350q\276\216\251*(\333\322|\037\257i\002ES(\022nE"
+	.ascii	"C\341\006\371\0015 `\002\2219\331\003?1\006\343\275\033\355\263"
+	.ascii	"+\005\020\224\276Hm\002;\313K+X\036Y\\\325Vw!\177\217\3468,\345"
+	.ascii	"e\247\371\351\f.\027O`\312\275\235\035\253/-f\206\207\246k\264"
+	.ascii	"x\304KD\003\211\322_\300\026\245\351\367\b.(\320\025\256\201"
+	.ascii	"\355\320B\347\025\034Z\007v=\365+\275C\26064\323)\342K\376*\007"
+	.ascii	"x\215\320\004T\254=\034Hv\266\272d\201F\001"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedReply.37.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\324\001\335\020"
+	.string	"v\037pG\340\322&\035K\335\231H9\017RY92\277\254F\301#\276\347\347\241F\306Y\361)\034\025\230\354t\325\306q\205\256@\234~\017e\210\236\243\331\335\331H\325\345A\2468\200\337\205\346x4\002s\256+\310 \233\310\235RW"
+	.string	"V"
+	.string	"_"
+	.string	"\033\002\345\323\r\266\317\237H\261\303\311im~r\270K\373-\356\302\365\236\231\233\354\306\214j\354\212\n\214\262}Z\374"
+	.string	"\355s\273"
+	.string	"\355\323.\333\350\304\303\276\026\360\f\335\214Bv\227S\024w]\272\374\217/\tq^\227$\fv\3272\304\021q\353m#\260\275bK\2271T\276\216?\302\370\341\347\351+\355\263\005\2064\344\210F\036\261\305\227\324\023\366\263\335]k\314\276\370\233\336\363o\233\364$\221\3164i\235\3222\223\376)\300\013\035\234\357\004\355\2028Rd\211\346\215\024\007\372\355\177t\311\367\371\217\353@\255\323\356\330\222\030O\217\243\r\366\203\217\021\214\312t\352o\222h$<\007\205L+\300\202\250\332\026\216C\352UU\215|PQ\343\013\267\201a\223z\0220 ,z\256v\206\013\201F\331.\037_\214\372\004`bG(\364\341\323\340@ '\264S\237\321m\273\213\222!\243\241"
+	.ascii	"\017\235\031\355\363Z\252\331\031\nG\250\244\212\037\364\255"
+	.ascii	"\030\257\373\246\314J+\306\353Z@\260K\261>\b\036\2702\361\300"
+	.ascii	"\225:\225\022\363\242\372:\320\305\003W\234\214\352e\305\245"
+	.ascii	">\220K9`\226\327}\334\006\026\353\343J\342>[\215y+\"BD\2435n"
+	.ascii	"e\273%T\216|X4\333\301u\260\230r&\300\222V \031\220\207\361\021"
+	.ascii	"f3\251\023\024\375 \262\321\227\247\006$ `\202!eh\007\257\030"
+	.ascii	"s\274\251\302\025N(\320\005\226\367r\026\033sL\r\265\274\322"
+	.ascii	"\301\036/\267%R\275n0\023\345\213\230B\226\220\276w:\271!66\f"
+	.ascii	"2\214F\333\233\211\211/\226~\262\375\303\2151\330e\231\365\306"
+	.ascii	"1$\214\022?\"`\243\200./\332G\006"
+	.text
+	.section	.gnu.lto_mspSerialProcess.38.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\212\n\3356"
+	.string	"\212]\034\025BP\346Q\007/n\323\257l\034\204\272\301\207k\215\006\330Y\353Z\021\032#%\355\212\366\025\225\207\260\n\352z\370s\003L\001"
+	.string	"\232\210r\211\350\351\034\330O\352\367H\246\020:dkm\311\326\366\336I\246\024<\001+\001B\001\022\234m\034=g\335%\023\244\214\221\027X\352b^\037#$\211\230\251\322\314@\364\234mi\317q\267G\375\354u4\"\355\313\371\353N\233\234\245J-\241\347,\002Gj\235]\375\250u\266\337\356@.\025\313IeF\226e\352r\316K?\245\207\375\276J\275\003\374\353H\001\216"
+	.ascii	"\024\211C\001\302 \320\375\371z\274\226]\037\277\355<\021e|\005"
+	.ascii	"C\273\303t*\035i%V\233W\326\nS8\200\224\2541?\002P\\\017\300"
+	.ascii	"\275u\361j\323\312\252\200+\212\032'kR\301\304jSl\211\207m\226"
+	.ascii	"\227\013\020\006W\fUu\\^m>Y\201\211\226y\234\254\331\205\201"
+	.ascii	".X\224*\346.\027Y\363\211\177\353\207\263/T\274\332\304\262\376"
+	.ascii	"\030\2658[\330\327\t\276\262\264\274\267F\230k;\344\325\246\326"
+	.ascii	"\212\204\205\205\351n\236\200\254\351\004\363~pfr\274\274])\330"
+	.ascii	"Qr\346\325f\225\265\b\346'\315uZaV\252Lk\320W\226\025_\327\t"
+	.ascii	"{\270l\t\235U\353\221\326\332\036gs|\345\244\302\357g\234\005"
+	.ascii	"\3732\027\265\373\312\032s\314\023\221sn\314tfy\017\360n\317"
+	.ascii	"\322\335\316n\037\210]\371\277\274\341\324!)\264\272S\213?*\215"
+	.ascii	"\017\025N\324\3352\334\216\023\215\347\332\227\234\363\206:5"
+	.ascii	"<\372T\253\233\343tf\264\316\342\247\361\\\003\203\326\036gF"
+	.ascii	"\0039fw\017q85\226\304r\316\035\334\370\033\033\355c\316\366"
+	.ascii	"\r#v\246\261u6\351\177\312dB|\177gs6\372TK\213SkT\004\337\341"
+	.ascii	"(z\354h\371\207vK\225\370\303\250kh\300\364\207u[Pr2\356\020"
+	.ascii	"\034\315\335\201\263\361n\340m\336\013|\214\373\001_\363N\362"
+	.ascii	"4\336EW\363&\376p\017\177\270\205.\356\340\0177P\210\333\r\342"
+	.ascii	"\376\001q\373\200\270{@\334<\037\356\366\207\233uq\257.\356\377"
+	.ascii	"\341\306>\334\216\241\200\241482eG>N\232\261\356\026e*\353\226"
+	.ascii	"\305\331\270\267\271\247q_sW[\323\336\306\335\332mC\"PJ3\326"
+	.ascii	"\020\316\214\032\255k\366\330\360X\263\223\374pfr\321/K4\355"
+	.ascii	"j\234\255\335\265\344\2372\254\267;M\017b\256fw\322\225q\035"
+	.ascii	"{n\246\375L\273\316\366\005\r\257\253\375\360l\225\203\210\225"
+	.ascii	"!\231\313Y\032\\Q\364\004\2357hzW\354\303d\r\370Pl\3656\206\253"
+	.ascii	"0\025\327S\217\005|\300\353\215\202\235\251\364\024\254\020Q"
+	.ascii	"\355\346\252^"
+	.string	"\tm\273_0\234_\250O9\245\273k\344\345\371\326\313\263\234\342\276TZ\367\275:\305\025\275T|\312\351\\\";\367\275\371|#\260\346I\241_\320\337+\355\357\235\354\265\342\207\336+<1\323?\206\350~\017\3449\265\363=\330\362r\301\316l,\027h\020\265\312\353\r\027\262\336C\333s\264\276w\262\336\363\336\367\317h\351d\212H\353\340{\337\002Z\272M\341\273n\360\274w\301\314\356\226[\fp\373Ie/\030\354\314\006\217\240\352\225\275\340\333w\256'\034\005\230\375\356\367\354\r\203\235\271\340\275\t\024\252W\002r\n\266M\265\374\361\303\276\2739K\347\t\007\f\332\303\371\031s\206\367P\022m\367\b\227#\301\212\231\206\305\355\361\255\247\233:\272\365\273Mx\036\024\254\230)\224\256(\\\r\027\217\235hW\264\272\002b\022*\200\273U\254\300\316\\\177\255\013\324F\235z\345\206j\235*m\213\366?*\255\317"
+	.string	"\214\277\033F\f\354\314\177\241\231BT\2739\252W\266\247\001\304\026e\327L\216\243\351\251G\362\210d\352IE\361\216'\244\222H\"\220&\034\307\024RQH(\337\361D\220\035PM/\212\307\0238\216\306\247'$\211d\262\211\t\031\345\002*\371td\2242\226\200J\2568\"Y4I\031{\3540\372h\002\320L\024v\030uD5%o@%\237\226\216:\214OKLQ\311%\n\006\032\t\325\024\265$\205DF-\271\322\354\037V\306{f\030i\261\233+\362SfH\017\355\341\326\221\205g\253\340\276j\034(\315\213\220A\373\004x\350\217\226\370\026\236\320Sm*\316L\327\024\276\303[\216B\340\003?\365V\265\241V-\337#H4\252\007|\365\036q9AgT*%LBY"
+	.string	":\340\341w\361\033\001\024'\326\371&\347\3255\374\002\200\264\3208`a\222w\t\214\247\323\226\226\360\207x\336\362\034Q\307\334\212l\356\243+\343Z\262\031\342&\356n\356X\254\020\005r\225\276\370W=\332\342?8rHY\b\256\017\025N\264\240\216\314\035\342\035\017>\t`\360g\340%NA\345TI\022\240\222r:\326u\266\346\234\363\360\241\355\376h\236\204\271\021\360a\316&V\006\fA\353}bg\366\237\021\344\244V\275\362\331\350\342\204x\351F\256\230\302\200\305\250q$&\215bfDFdDf\232\2441\260\002\221\241*\316\001\021\02054\f\021\211\220T\273\0014\363\233\034Os\312\321\324[.\263B\242W\266\372.\226\202\273\305C6\310\250\326\304V\350\252\"\3347\245#[\225\2512\016"
+	.ascii	"\340\037s1jJ\254?\232"
+	.string	"\331\337\352\356\272/\372\315\373.\271\004\300\260V\030\f\254\226t\233\337\260\t\317\266\2226\317\201\241x!\361U\200\017\221\006\2738cIR\262\n !;\301\310\257\315\250\244S\265G9\354Dd\370\340G\177\344\025\363p\346-\236\300\334\3550\335\205\377\210\rN\021\326\262\246\r-\313\27295j\b\032\367U\370\003\033\362\037snt\267\315\313,\261\254\352\332\201\341 !\002\334\251\347\b\321\335\027\341<\026U\207eA\367\023\350\233\247\274>R\003`al\210\225;w\370b\273\274R7\326s\335\343wa\331`\202:\311\3749\207S!:?\022@qsd\210|2j\b\370\375&\341\366\r\n\370\001\346\226\242v\033&\302\223\031\301\003\235\\f\221f\250\207\203\201\035\204\313\341\026^DE \f@\320\277\204\232\b\252edC/\240\372\256/oP\330%\257\221\376\335\177d\320\275\316\002\024\016\325\314\353"
+	.string	"\206\377\330\252\302T\214\350)\242K\t\300\351\200\350\323"
+	.ascii	"\312\217\317-\376\245z\260;\007nj\212\314+\344\031\333\344\322"
+	.ascii	"'\304\220\216\232?=\221d\024\255\371\350\007\222\302\020\372"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mspSerialWaiting.39.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\333\001\355\021"
+	.string	"f!xH\320\360(\035\303\277\230\235\254\376\324\246\nW\301\232\350\025\234[\273vA\200\225\246\317\276\223I\340\004!!\244\337\n\324\037\203\361tPZ\035d\b\002"
+	.string	"8\214&\fe8\270\217-\003\315`\n,\343q\347[#{K\231Re"
+	.string	"^"
+	.string	"c"
+	.string	"\271\326\372x\037swJcW\245>\031Wc\276\354\252("
+	.string	"F\315MD\2402\341\213\246P\330\374\213\016lC$>\302Y\334\242]\322S\324\334\250L\355\340\222ha\210\307x\200)(\347#\334\020\007\340\0301\035w\225\tat\177\273\201\232\223.\306\213\320\346\232\022\231sZi\341\207{u\333>\266\025\330\337\021\273\230(\027\355\355\234S\266\333c\347d\372\231%\0233/\217\315\262Z\336vG\251\336\250\326U\037"
+	.ascii	"\b\202f&\374\315iN\232\036o*I\244\023\267\335>\356D\376\315\254"
+	.ascii	"\313\333X>g3\303\217P\023\2169"
+	.string	"s \227\006Q]\336n\261YN\260\240\305\261\347~h\b\b\331\210q\3614g9jHP\037\311\267\013\352h|\250\256\355\242\240\247\355^FS\017%\230\225Y=0\005\211\220Qg\356\210[\007\216\321R\374\312\247\013\352f\300(\224m\223\267X\031\251\361\236\346\234\flk\270\256\302\211j\274\2419g\003\026/:\361\201.\375\272\240\247]\372\260\357Rw\244\306\343q\213\373=\356\020t\270\030\\\023P\036\250\200\257\224\225KB,\220\230\200.\230\204\024\330I\013\305\204\344\244U\002\302Z!\005\374Jq\201-\225\327\013l\261r\363\313\343\257\270\252\206\212\016\273\243\224\037\373\216\373\nH(jw$\377\330'\345Z\304e_8\250\266\307\001r>\326\312\022j\031\275\3618\267\307,_\\\326\376\366\b;\267\336L\347E{\252\001& p\202\2512\343\001\237\030\235\206\026\375\020\345w\363H\251\177g\272\026"
+	.string	"\004\013\034\033\233\265\367\230\373\266Y,tm\314\321\034\005\277r+\033\006\244\267\025\215\226\021\r"
+	.ascii	"\033\005\n\273\021i[leZqT\220\303\267Q^xc\373TS\253\251\217\022"
+	.ascii	"\013\265\017\317\275\332\365\004"
+	.text
+	.section	.gnu.lto_mspSerialInit.40.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"}\007"
+	.string	"B\01646Pm\323\001$\027\255\210\r@\023\224\226X\001u\331` \375\246\336\366\355\036\3557\204#3C\352\206\305\232w]U\225Q\325\372VY\270\032\326jL\023\"eJ\001\326`\0242\034l\223%x\262\016\\\340d:P\203e\0203\340\313\263\301`\303ua\320\342\355\247UQ@\311\343\373(\310V\332\027\303\305\007R\316UZ\035\267Iu\360\207\334\323.\243\335\317\243O\272\210\203\277q\312\017Z>\236\362\265\352\224\r\021\221\217.(Y|\022\312\331\036\227\212a\177Z\025\331\323%#\324\235\004e\227bEe?\252\204\303\366-\336\354\223{\243\025\370\bM\214\244\354.T\215o\317\315?\310\255\330qO"
+	.string	"\204\335u\306\256\342\326\333&\260m`\233\024\n"
+	.ascii	"\357b\314\304\023~\264\027\273\212\ba\030\327D\267\020\360\313"
+	.ascii	"\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_mspSerialPush.41.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\334\004\215 "
+	.string	"\026\375\321E\200jM:\263l#\237\246\301\252_, \325?\367\330\r2\016\223\251l"
+	.string	"\337\336\302\336g\212\313\304\253\016\341\232\336O\345\243\327(<\246\362Qo\313k\246\022\354$\220\022C\203\313\336k\033%\204\020\262\345N2\275"
+	.string	"\257"
+	.string	"\306"
+	.string	"\343z\250^nTZ?-A\202\301<\227\365\332\263\233\352\316VwCX\nLw/|\026\336\265\344\270\200n&hjBs)\335\235P\201\367+\035\313\335@\253\255n!\204-2?\336\352Wx\273^U\370\304'\024<\022\325e\254\273k\n^\200\374XO\200\374\310N\226_\205_\223\362~\232%9V\246\274}\251a\370\017NX{z\276\246\237\225\366\006\210\221*\301\211\232\013\232L\025y\331u\222\310G\231\017\252*\350\356\231\217\007\255\225\002\230\357\310\314\367TeA\360\310y\327\251\224\217\007\345g=E\020\250\207j\252\310i\251\241\273\227\366|S_"
+	.string	"\337]\253\335\215\261[\255\004/s\264\207\362qo2\350{\037\3672\310\2173~\327I\300\031\026{Cv\320\"ww\023s\325\256\260\211\276\231\311.\321\320\275\374\006~\365\013\235\313?\340Z~\332\271\276\263\240c}O\363`\276\245\214.\t\200\356\310t\353I\227M\272\264\244\373\0043)`\276\017\333t\377(\376\351\257\221K\312\267~\256\037\353\007\363\272\373\335\213\331\023\337\305\245\273\017,\250$\254[\310B\353cx\337\262A\3537}V\tF\t\353\006\222B\210\340\004\310\207\331g\255\354#\326X\020\030\302\374\370]\336~\270\262\335\005\263^\357\251~\2178\301_Xw\027=\006\230\344G\005\032y\027\304\211\"\326\350B<\362+\357\2168\230lI\230<=1f\032W>T\025'Z\334\001\314|"
+	.string	"N\230=Q\201h\274[\342vr\254\321\356\211\023Q\254\321\307\363\247\202f\330\313\371\034\025{({\342\212\245\235\005\371\261\305\257\f\2370 \027*Z\244\215\332M\225\341[\277\360\363\n\206i\241\305-\205"
+	.ascii	"\233\251\370n\254\262\246\214\\\265\307\221\224/\266\305\216"
+	.ascii	"\213\277\301\035\350\346\213r\203:W;h\221R,=\346$\251\\\2655"
+	.ascii	"\310snK\235'\332gw_\234M\215\026?2Fkl\277\362\0333\226\346j`"
+	.ascii	"\220\037\317-~d\370\\\375\f\f\006tz\273K\343fl\265'\335m\301"
+	.ascii	"+\273\034\316\004\223N\251\234\241\263\301Tq\334\220\226@\354"
+	.ascii	"r8\246sw\313\361\022.iwt\313%!\235K7\032\245mgC\252HJG\274G\021"
+	.ascii	"h\330\222r7\035\f&\235Rm)\311\246T;\312\351j\021\210\026\307"
+	.ascii	"t\313\325v8\\\256&\023\366\253irP\220\200/1@_;\330\351\344\252"
+	.ascii	"\r\220\246$\372\217\250 xh\321O\226\332Z\226\374\341\357\343"
+	.ascii	"K\020-Zt\223\245 \374t\240'\216\237-v\236h\237\327\356n\223\253"
+	.ascii	"v\353h\376\307\027\"Z\344\020\227,\265\373\340'\023\361\263\356"
+	.ascii	"b\311p\017\024\320\211\026iy\005t\277\201<\231\023W\2303\336"
+	.ascii	"\345\320\201\2767\304\037\023\343\363\005\305MK\362\356\207\023"
+	.ascii	"u\004Y\250Q(\245\214B\306(23\022\314\314\320\\\003`\002\031:"
+	.ascii	"\344\016\020X\250\264I\322\030\020\304\177\177*<\261\215=F(\334"
+	.ascii	"u*\227,\035\272l\270\027*\235\230\261\370\016\371\254\277\030"
+	.ascii	"\217q\334R\346\037E@\263\035q\224\303\277\333\243\317\237^7\020"
+	.ascii	"\323\307\252\267\252\277y\353z>1\221\324\335\265\223\365\362"
+	.ascii	"j\217\031/\261\350\321\004\256\213\201t\221_3(\\\206\305\271"
+	.ascii	"\254\220\227;\003\224*t\202X\n\243Pc\225\310oEe\203\f\r\270\207"
+	.ascii	"ZA\244+\177\235\214\355\255%J\271\200_\220\257\271kY\200%\013"
+	.ascii	"\320\317\270*\204&\032r\t\213a8\344!\230f\346\313F\"\213\233"
+	.ascii	"\2123\236$r\354\026\322\224\237\032"
+	.text
+	.section	.gnu.lto_mspSerialFindPort.42.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\254\002e\025"
+	.string	"\366h\217I\320TQ:\004\250\210D\353\n`\fd&ZD\342-:s\341\030\025M\260D\034JyG+\270v=\202 ?,"
+	.string	"w\235\205\262\2251\317E\300\236\331\207\303Q5&\344\277C\370\026\336@?4\3127~B\310&{\247\024~"
+	.string	"n"
+	.string	"~"
+	.ascii	"\257\003\274\247\270\n\035\273h\220\317\313\250e\006\003\350"
+	.ascii	"\305\222\335\362\344\362\001\276\327\360*\337+\365`z\257\274"
+	.ascii	"\301\351z\b~\325\243\323\345\223;\017\275\224\037\024.x\005x"
+	.ascii	"&X\302\302?\022\263$%FD\027^\275\003+\216@P\027\267\035&\322"
+	.ascii	"gz\236J\021.\207B\376x-\271\023\030~\373\024\"{&=\322\t\304\204"
+	.ascii	"\324t1H\013\237`\314\356z\302H\242\273t\333\036l#\260\247\211"
+	.ascii	"\363CAD\374\230v\260K\341\313\037\274\355\256\236\366^\273i\235"
+	.ascii	"\236\336\364OF\024\023\206\310\343v\354N\3305Y\037\365\306\210"
+	.ascii	"\333\376\332\247}\373/\374\233M\276-B\312\376\330\223Ff\270$"
+	.ascii	"\273eLx\027>\222M5\347\370\022\355\203\226\314d$\331]\226W\303"
+	.ascii	"\204\257\267ul\223\3559\355\323\316B\347e\216K\273FGj\354\256"
+	.ascii	"\213Y\3022\203E6\257\322\220\n\031%\210\b\240Je \235\364H"
+	.string	"jDR\327\221s\f9pL\272B\204\366\232\273O\t\271\023\032\274\233\357T\254\025\351\231Ll;\270\215\033\231\230\356hwaj\250\256\"\226;\242\361$\327\367z*\023\323\315h\307\271V\206\300l\343\\\206\352\364aw\r\300x\214\225\037\342\325\020\306y\330\253?~\257\225\376v\005@p:X\205\327\334\321\335\335\241Tf\227;\001-q\265\2005\252@\034T\215M\202\226\270b\225\304U\213\225\022iFT\315\211i^\036\314\244D\324\330\2005\252N6\251\031\325\211F\034O/\002\274b\241\304Sk\265\022O&\333.\367\264\203\337\342\241\221\031\217[\022\370\031\377\355\327p+\242QC\352y\3241/\312\023\024R\231\001\360\370J\224\026\231,\247T\310\345\224N\232\267\273\013\266\234\322\022=\322\031p\300\365\370\331\3003wSI\206\033L>\032/ \200\002!\262\344\001\271\360\262\031\207\340\032qUp"
+	.string	"\315[\334`\013b\321<\013\260\266\021\334c(\271\033a\235D\202\341\324\265b\234`\342\273#F"
+	.ascii	"\372\242NS\214\251Z\333\203[\032\257\261q\2677\024\327A@Atk\326"
+	.ascii	"\026c\013\377|\220\260\362\3316h\237\344\205\033\333\027\363"
+	.ascii	"R\n\tFa`'\204f\324\027\356u\255'"
+	.text
+	.section	.gnu.lto_mspSerialStartStream.43.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\037\001=\016"
+	.string	"v\333cF"
+	.string	"\257(\035p\300O\\\337>\363l\007\335\261\"\354l'\246OQb+W\354\271z\f\202I\375\037\335p\304z5!0\213\305$6\370~\021U\3752\353\302\036\016>\360\004\020\223zl\323\032\006ido\271S\nP"
+	.string	"P"
+	.string	"M"
+	.ascii	"\332\247\201\017"
+	.string	"\310>\345\003d\237\266} \301\311\250\207.+\001\254\024(\256\030\273\341\246\035\216\272\324\210\362S\227\240\025\030-^%@\013W\211 \204\004\233\r\360D~jr@\334\365\250\002\252b\364\200\354\256c\nX\341\236\267\275\300v\210\375\b\001\321\327>\024+\n\340mrvW;:\273b\232\370\360\326o\237|\227?\266[$\034\313b\017j`\251\210\355\206\035\237V\240i\370\021\247\313\224\020\340X\325\314\004\234\335\320\303 \355\323\241\026\243}\021\2079=\006\2025v7\234\300\331]\017w\0045%\332\356\202|\022\246n\303ew\357\341s\276x\275d\200Y1\211;\312\362\322\202\351I\262\251\232z\261\314\300Tq\206=Q\252\375=\210O\231z\327\217\001\345BLFL\245);LE\345`_\356\356Z[\354\313\374\331[1\277t&\257cP\3728\317H\b\027\032y\246O\363:S\211\344\211\276\221\003"
+	.string	"\026}\210\204H\336\350kP\372\270m\204\024\3426\221\367m\037\005\334\225F\336f\352:o\373\204{\271\332b\021\226\013\232\033\275\353\232\016\013Fs\023}TvUQ\203\230\350\211\314\324\346\036\024"
+	.string	"\3571\364\2107\205\350bbI\030\212\306{\213U{@\352k\200\002L(]#b\260A\310&\310G\351b\341DM\331"
+	.ascii	"M\024\246\260\241\252\234\242K\355\001"
+	.text
+	.section	.gnu.lto_mspSerialIsStreaming.44.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\f\002=\022"
+	.string	"6\343{H\340\322&\035\252\022D"
+	.string	"Ru<\006\245\030\273\355\013\325\247!6\302\007JoZ\030\017\3272\004\260U\031\341\225b\260\234\255\247\203\337\32585<\034\222a\216\223\247\036\203\001\366\265\021\f!\262u=\245\203\020\262\267\334)\005j"
+	.string	"]"
+	.string	"j"
+	.string	"/\351>\0250p\371\365\260D\317"
+	.ascii	"Z\020\234\233\323n\230R\022\326\313\360\356\342\353^7\245\306"
+	.ascii	"\227?sO\006\330]\022\030\216LP\023\273\024\261O\371\200h\310"
+	.ascii	"\204\026\035)\241`8Q\312\222\0171\226H`\035\344\311\222\320\317"
+	.ascii	"o\217;0\233\2507:\002\031\021\033\017$X\354\321S\331]G\035\230"
+	.ascii	"\317\375\335v\3146\004;\242\004\nd{\257\375\235\243\345m\267"
+	.ascii	"\312\350\250\321\3776\304zx`\307)\355\366\344\206\254\216"
+	.string	"\231\204\342\266\333\277=\364\215\214\372\364]\274\310u\233k|}\3669N4!?v\327\344\323\013\276O\003\362\266\313F\331\216\321>\213\023\271^\343p\001\273@7h\354\206(6\371>\035\236@\367\371\0059nD\324\304\\\004\002\"\351i\352\254\323\250\367acR\035w\341?3dD=\300\364\350aI(\204\324\231]\272+hk\262\211O\266[\216\3442A\226\033\332\265i`[\3460VW!+2\264\273\016\216\376\202\345\007}:C+^\347\323\327\320}^\177\273\264!\313\321j41\247\273;\243:\263\303\231x\236\035'n\0342*\013/\022b@\026\314\310K\204\325\212\n\214i}fI\301\260\322\002\252Z\025`Z\253\324K\313\312*\305\002\266R)\005\314\202Q\201\251\030\026\013L\241\302\275\002\371-\376\365X\241s\204\353\374W\367\333G\202h\271#\234\374_\235\224j\025\032\255\311\361tf"
+	.ascii	"8\246\247\332\024M\256\272\203r\325X\223\273\273\335\311U=\275"
+	.ascii	"\321)\214\300\005% \200\002\232\252\365\237\030\025\205\026\335"
+	.ascii	"!\250\336\215\243\n\016\350\354\026\r\376\027\333}\273\306=\260"
+	.ascii	"\222\273\021\326%9\263\324\226L\222\250k2\0026Z(\354F\rm\361"
+	.ascii	"\225\211\312\001\210\307\335\261o\270\265\230w7\024\341J}\301"
+	.ascii	"\013\027;\222\350\374p\257\213>\001"
+	.text
+	.section	.gnu.lto_mspSerialSubscribe.45.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\030\007\275*"
+	.string	"ZL\370\020F`\034R:{\242\017\r\022b\355\327\206*\240\025w\2144\225\316\032\210X\212\207\374\356\033W\rT\272\210\f\234\272\363\177qj?v\271\367\340B#\001\320u\314r7\031\024\226\036\230}\365\275\375O\032!D\356$\003\376"
+	.string	"\356"
+	.string	"\371"
+	.ascii	"\255V\022\210\004\366*\247\316_\271\272\232\025\253m;\244\017"
+	.ascii	"\230\266u.`%\366j\361\336\313|\264W\271z\032\r\376\265m\2212"
+	.ascii	"`\332\266]\300\t\330\253\003n\\\257\246\027Z\257:\200p\305\310"
+	.ascii	";\307\274\206\316|pi\301k[gR#a\366\251\363\234^\344\211\303\037"
+	.ascii	"a\020\370c}\253\232v\361\"\371X'n\200\242\031\206\375'"
+	.string	"\354d_\314+L\035\260-\277|\356+H\372S\026\207,\370,!\007\276\355\034\240qrhyE\300~\374G\240\b\230\217\263)\2029a\360|\356\313Gj\364j\242<\331W\217\353K\021\204\311\355\370\334\027\220\324\310\306\210]p\311u\327\3402y\325\264\325\236p\303\345VJ\241\212Y\222\267\375v-m\334\024\be\307\233\335\361b\372@\312\r/\237\373\032K\203\\\362Dy\333\t\220}\t\271\327w\241m[\276\312%\330\031\350\314o\300\314\"\230W\034\001\255\022\377\313\206&\226\311\325w\f&\231\274\264\254\273\227\266m\333\246\254\340\306>j\n\314\267$\335ZX\362\3565\027\246\330[w\223\177\245\2718%\305\026c\030kQ7\226]\035,n\264\256\036\036^\001\315\374\304\342^Y\324o\373\231\\Q\236\344\315\321j,f'\326\355\246\232\034\033r\334b\314\317\362#\035]\3557:\333\271\350i\277"
+	.string	"\276Ld\f^\036\002^\026\002^\016\002^\006Z/\027\277v&\246\227\207\353\345\237\337e\341\357r0\275\fd/\377\330\313lz\331\227^^\327\313\252\357r\247\227\357z\371\007d\230y\345X\336\f\\\333z\355\361i\327\250b\234|\355g;3_\361\237o\343\340\226s\271:\033\214\264\355\341l\301\200I3e\234\036\234\354\032\277\r\320r\266\313\325\310\031'\032^\333\266\t\256\262\0066\213\325-\006:p(\203\335|R\2172&\300_7\231V\346\017\207>\214)\207g\007\300\375u\260\205\315\034b\304\275\222'\f\331\372\232(\"\025W\263\304 \315\221\260oT\311\343rQJuJfn\361\270\245\1779S!\330kT\311C\301\211\r\354"
+	.ascii	"h\266\302\330s\334\312\366\257\037\335\"\3635K\354\265}}\024"
+	.ascii	"\335z\222\\\373h$\356\311\245\2476\034\321\230\362\356{gZ\177"
+	.ascii	"Zm!\350\231\275\255\025\314\313\r\266\233\304\036\026\270\022"
+	.ascii	"=\303\222&\310M\f\021\237jlNSc\023o\337\364\366\260\273\256\372"
+	.ascii	"6z\226\205\245\357\237\356\262Z\221\272\261\242S\226\254\335"
+	.ascii	"d\243\3567\314%>\306\352nu\314$.f\351]\306\332\266\215`\342a"
+	.ascii	"N\\\245P\327\275\246\035\nGm\213\332M&r\2255\351\243\026>\313"
+	.ascii	"r\024\023\334\330]\306\276}\365\260\244y\337>\227\036\243\270"
+	.ascii	"\033\023\333\266\001UG)\020STQ\276\031O+^@\251T\037\\4\3058>"
+	.ascii	"U\275\200\002\256\210r\352\243T\325\024\324\321\211\352i\005"
+	.ascii	"\220\235\030\270h\202:>Q1MQE%\275\200j\212Jr:R%1(b\251\251\247"
+	.ascii	"cR\225\224\3241)\350l\337b<\201\371|\336\357\371\204\263\347"
+	.ascii	"\023\370#\327\267\235\345s\306|\272\005\371\310\225\250\273\230"
+	.ascii	"\231\250\371BV'\321\020\207\232\031yv=H+\3034\252\274CV9\036"
+	.ascii	"\322\312P\037\215\031\245\222&\324\314\030\216'\203\b\246\235"
+	.ascii	"\331\035;}Gy\027\324@-\324\337z\202\324A\255z\341\322\273\314"
+	.ascii	"\034:\334+\201:u\346\201\262&\331X\214\324\314\036N\007o\216"
+	.ascii	"\234\032L\272<\243f.\361\250"
+	.string	"\225\b&\235\231\335\222\0058'\236\306l\203\367fC\023\363\243\326\253)\230tT\202d\335\275a\261n\250\330AP9\270_\334\221\272\237\341\035\021:E[\240]\302n\276\255\304\006\220C\316\225:P\003\001\200\200\250a$\305\224b\b\231\021\231\tF\323\024s\200\002\221!$\333\021p5CfS\201e\230\003\037\006\200\240\006}Q\203\311\336\025+z>O^\bH7\020 \233\002jcR)\273\317\207\217P\241\026M\234\211\324\031\3241\271\206i.\344\326JF\252}\024\221K\352\261@d=\245$\205\362u\255/E\211\260P\202\206\003\007A\306\350\266\273\247\2455vI2\006\240\230:F]\241\205\b\026C\225r\200\332\013\0222B\005\366\023\"\252QB_\2618\246>\037/\245\037\312\032\213\322\200\256\240M\321\243\242\221\246\201}Dp\032\201P\025\f\377F\250\233\t\265Z\206?\025\377eT\b\257"
+	.ascii	"\322\373Z\3537\177K\363/0\024\267\264\212\326\364\242\t\373P"
+	.ascii	"\254\371\306wf\032k\367'[\025\013\337\205!\275&\324\2210\323"
+	.ascii	"\372=\322t\f\n\270\205n\232\200-\272\r\023!\002 d\377xN\3470"
+	.ascii	"\302+\260\016:\355\024x\212-ST\356\277\214;\032\272\210\270\324"
+	.text
+	.section	.gnu.lto_mspSerialSetSubscriptionRateLimit.46.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\224\001U\020"
+	.string	"\326\240tI"
+	.string	"\317&\035P@\300\310J`\264\340\203\316\267\244\325\222\203#^\221\201U\331A\017MI3C\034C\345\261!c\374\020{lP-\035\317N\244\213\323^\315\020\002\200Z\267\030\364\220\276\351:b\313\200\236!\215l\262wJ\001`"
+	.string	"Y"
+	.string	"e"
+	.ascii	"~\210\307\274.S\301\031\273\033\200vv\227\303\246\356\325\300"
+	.ascii	"\tp\257\3337\270W\333F\220\340e\330I\030\224\001\265\023&6/v"
+	.ascii	"I\217\276\034\366\215N\230\037\373vZ!b\361\301\031/\234n\007"
+	.ascii	"0\214\340\321\030e\333\206\317\007\226\227\237'\343l\316\221"
+	.ascii	"\307\356z\322\306\224\273\336\366\207\355\005\366[\004\223\272"
+	.ascii	"\330\337vwM[\354\323\374\243\337\334\334e\356\311M?\300\004!"
+	.ascii	"\024\013\343y\212vQ\212\210\266\247\226"
+	.string	"\350\360\233\337\276\355\227_\232\344\327\334\346\365\033\222\322\252\330\217\032j+\202vI\323\253?\272W\223\335F~\346u\032\327,\355L\246\262\263Kr\370\324\275\226\346\234\016\r\276\343\240\346\320\204J\323F\245\346i\247\325\304\020\212\036\031\215\331t\373{\016\204\247\254\f\201p1\242\266\352$\\\335\356\236|\2340\202\006\314\356\236\303+i\006\310C\206\030\225\222Y4S\324\344\374P\352b\022\216\2434\006\364\"\342g6c8cVj\203\022\346i\034}\371\257\230\304,\214\240\031\215\331d,\255\020\004a\211\253Q\310\b\230\372\030\204\037\210\370\265\\\n(\240V\002B\260\305R\205)\361\013\001\340T\207\bJ\025~\342\003\226\270\362FT\250\225\227\nE\257\243\200A\326\027z-\020\f=\222m\223\373mi\213Ej/J\035\372\303\270\227\357\210j,J\235\351\303\270IOlOj\217\022*\333\250\013\265\003\024"
+	.ascii	"\334\343\341e\241@m\335\305X[\253$p\0258\244\2624\251x_\357a"
+	.ascii	"\301\214\222kr\020&4pA\340\312\025\350\002b\200+\nS\303PUN\321"
+	.ascii	"\245\366"
+	.text
+	.section	.gnu.lto_mspSerialSetBatchRequest.47.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\357\001\205\022"
+	.string	"\026\344~H\320\360(\035\312J\266\301Z\222\261\377!\212|\276\317\263\206A\302\fnaB21+\227\371\336&%\362\261\3074IV\361\243Z\237V\267\037$>\345I\243*\236\344\216[\036\344 \306%\303p.\254\350\376'd\313\235Ri"
+	.string	"d"
+	.string	"l"
+	.string	"#\211MP\377<\242\244\264\257\363\035\332y4\030\300n\211\031D\273K\342\021\324?\221\027"
+	.string	"\377\315\017"
+	.ascii	"\377\331\266\202\0054\327>\342\310\020\310\331\201\003\322\261"
+	.ascii	";\256\364\304k\237*k\376\313\247\t\315\316&)H7s\235\bnF,\205"
+	.ascii	"\350lS$\006\022\356\274\313\030\335M\312\323\311\356Z\346t\036"
+	.ascii	"\356\357\266\033\330~`K\224\036_\244\232\260?ww\2557\366{~\220"
+	.ascii	"\377\374\037\337\335\341y\376\224\245O(i\360$\375\201\322\323"
+	.ascii	"\322*}\225K\b\231\016\272\037%\355\312\364\232\026\351+R\361"
+	.ascii	"\335o\323|\236C\333\273\026"
+	.string	"\325\322\330\353jrx(\355\216#\377\214\202\232?6\232\252\275\331\244`\240\343Y\320\336\223\301\200jo> \210v\003j\247\250\310\347\034\326l\370\013\226\347l\326\205Z&\377\374 \013\025P\273{\024\377>\2252r\037>tj\212\006\310\226\304\353\001#{g\"\321k\241\257\201\252\023|n\334$\223\245^U\245\021n&\301m\004~\250\324)\204\323\361[\300P\257\240\315Q\016\\\221M\366\034\312\224\332\027^\362\271P\317\373E\340V\020-)\335\364\305\0013\021\346 &{\235Z..\b\341L\326jai\211'\0216\213\271D\226\254E!eV\311\212\212Kl\311Rb\262\327\n\203K\345\265b\211\262U\311\001\303b-q5\203\301\304U8\356\347\352\215Wv8\360\206\364\257\201\347\035\325\224\323\343\r\311\273\370Icl\237\324'0j\233\240\332\021\016CB\b\316s8@\rP\303\306\021\256\207"
+	.ascii	"9\025D\277! @\002c\220\355\rN\323}6\254\266\367\004\226\374\275"
+	.ascii	"\242\242q\244\204\211\213%\362\250\016\177$\202\252\341.\242"
+	.ascii	"O\210\222P^\265\033\2604k(\366\241\336B\264\016\244rN {\026\211"
+	.ascii	"\355\356](\247`\016\030\254F\201\271\2420\016C-\247\350\352{"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.48.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\b\003\355\027"
+	.string	"\306\353\234J\300\024\231t\264\233i\277\235{qj\004"
+	.string	"9D\332\205\007"
+	.string	""
+	.string	"\300\305!\375>\324hOZ\315\214\310\261Fu\005\3028Ml*\350\252\263\361\362\034\356\223 \267k\0236H\036p\332\320\275\374n\t\3455\032\"\204\354-w\222\001\212"
+	.string	"\200"
+	.string	"\212"
+	.ascii	"\027\210\232\271Ly[/\240\274m\033\334\257\3003\211\276^\"\215"
+	.ascii	"N\263\264\265\351\213oF\370\235\202\254\212P\355\006{\251\306"
+	.ascii	"H\331\361\251\fd\224d\240\006\256\347#\230\333\211:\243c'G\317"
+	.ascii	"\036bbV\004\272&..e\207\247\312D\331Y\241\321\362\261\334\255"
+	.ascii	"\271Cv\251\335^\274\326\006Vn=07\024\265\324\342\312\361\305"
+	.ascii	"S\333mF\373\302_\350\371h\231\201\35395#\334{\231\326n"
+	.string	"\270\263\351\314\034\205\231%0S%\001A^|1\232\354{/\254\233\307\f\204\321\337\246\301|:1x6K[)\367}g\332\224\017S\340\311p\n\261\307\323B\300\313\"\371\345\032\255\221\034'\376\301\337\367f>\363\207\374\"\221\204\nc\017\007\204\003\371B.\335\006\371H\275?n\335!\223\374\360\270\367\242\316\3333\233\340\377\270t\337\353\027w\237\202\250\227\313r/\260\346\226k\316[\276\217\377\230\340W\205\023\261\033M\217\005\255Ht\003\031vH((t2\232\244\243\346\261\251\313\356 \227\337\360I\f\265\271\241\257\231\272\032\213\234\030g\r\343\027\221\361e\307Y\3458t4\007\274C\331\251\017\351p^H\t\234\363\336\333\355\322\035\351A{)\204b\224\315c\n#\007\354h\271\352n\3178\013\273\360P\251\315\323)\337\254!rF\213\230\331\303\203\350`\320\005\021\335{\0350\363\352@r\376\243\013z"
+	.string	"\364\037*\376\215[\016\321\242\257\335\362E\224\267\357\027_\227\350\002\251\024kB+\345\322\3310\032\221\342"
+	.string	"\302\202\213\245Z\215\\)V\363\315\202\01768\254TK\303\252\225\203\002\201c\223\203\272a\265P\013\b\260j\225b\241\\*\025\013U\002\336WR\331\224\0060\026y1\306ZVj\036\237\226\214N\265\347C\003\24257\333\306ud\373\277\237D\275\034\215\b\005\220L&\223\247)\313\266)\270y@\313\026,\303\241\031-z\275\367^R\363\370\305\337\005\020\222\025\247\251\271\332\262m\333\230\023\334\354S_\370; `\002!t\271\003\177\f\263\241u\0046\241\016\307(m<\325\306N\215d\233\303[\217\226\026Z\244\b\201\230\005\326\305X\370\240\200\364Y\233\256Nm\236\377*\013\323s\321\212\257\231\324\226\323i\363\331f\267f{\360\226\300k5\216\312\222bG\363.!{\215Z!\207\177)\272\034\367x\264\305\031>f;\b\032a\260\b\331\221\266\357\322t\340\016\255a"
+	.ascii	"\313h\035zi\271\f\023\241J\207\033\2367\336eS\333\311"
+	.text
+	.section	.gnu.lto_mspSerialEncodeHeader.part.0.81.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\233\0075'"
+	.string	"ZC\254\016D\200\336Mc\032\013\034~6<\363i\343\270\264\007\352\220\302MT\302\006\006\240\226\351\301.\237\017Y\322\033\322\036\310\320\001\373\016\235s\022\260\250\361O\303"
+	.string	";\262\362[;\002q>1zI\333{\313-eJ\001\323"
+	.string	"\316"
+	.string	"\323"
+	.string	"\\\242\314D\030\351\267\\\313\035\n=\322k\361\330(t\201ZE\210\367\336\007\225\376+\213T\315\"%@\350\002\275\260\032Pz,S\277\322B@\327\315\022\232R\373V\336E\365+->to\2204\304{\273\024\334:\201y\353.\323>\225)\241m_\312\247P\331cc\027\221ay\245#\370\345v\3575\272%p"
+	.string	"\344\355\370\"\362\266\0169\325s8\263$\355X\351I\345\273xn\206\216:8s<\340\345M\223\263\021\346\030\0034\311\021v&B\034\264,!\020_"
+	.ascii	"H\226\216\223\324jx\34367\274\361\021h\bc$p\357=\032\220\326"
+	.ascii	"\021A\017\262\032@\303\340\b\340Lk\355\304\323\253\341\013J\211"
+	.ascii	"~\226\020\356\275~\325\216[w\333\\\266\243\354\262)#5\321I=t"
+	.ascii	"R\013\375P\007\351\250\201N\352\237\223Z\367C}\352\250s\377\372"
+	.ascii	"q:j\363\244.\217\345'ov\333\034\365\230\243\256\337\362\323w"
+	.ascii	"\371_ \200\001\262{i\274\361\271>\254X\222\203\371\307\3763\277"
+	.ascii	"\233\237\315o\366\247\375rn\332\367\343\254\371\224\203\205D"
+	.ascii	"\206\232\277\361\325\322\340\260\221\255y\233\243\271\031/\016"
+	.ascii	"\241\013\354\022\246\204\315\231\323\231\323\031(\363\326\254"
+	.ascii	"\254W\326\343\"\207\254\004\231\230\227\361\321\370<c\006\205"
+	.ascii	"\031\024YWQ\220.\3660>\231\2611?:\346\367\033C\210\3032r\204"
+	.ascii	"\355\336\256#S\314>\303\252\0376\345\023}\202\2312\001\340\027"
+	.ascii	"\217\231.\204&\230\021\036l\367\336\004\267\316`R\331\247-}\027"
+	.ascii	".Q6v\005\nD\242hVmg\325\325\007\213\026h\025\206\263\226_E=U"
+	.ascii	"r\325\326@\357\233o\203\275\023yK\357\330\035\336\347\310\274"
+	.ascii	"\027\350\300\347\323\344\301?\"E\336\346j\211V\204R\2054\353"
+	.ascii	"\036sl3\323\022,\332\262\332 \356\206\024@-\217OD\356(\310\333"
+	.ascii	"[\265\225uE\031\235`\361m\267G\374\316\016\300\325n\300\006\236"
+	.ascii	"'v\\\006\006\r%c\361=\322\326\001I\264\274\312\376\366\035i\223"
+	.ascii	"x\235]\020\221{\257\003\237\315\227\344\037\271\255\377\221\267"
+	.ascii	"\366k\216\233\235\261\332J\325\220?A\326:\326\307\350\361\202"
+	.ascii	"\276\231\326Z\217v\n7\324\244\005\213U\364\315\365\347\262\352"
+	.ascii	"\261\246\326-\373Q\344\353\211\247<\270\232x\301\001\322=\264"
+	.ascii	"n\271\236\343\255A\356\242\r>\370"
+	.string	"\224\226,\217\005\323\221\322\256\327$\265\343\300@\305\317\006\t\032<\\\360)-\231\f>\370\224\226\354\023/\303S\217\351\347\343}\200\3729\345\236x\031v)vJe\n\336\211\244\035\024i\"J\202Oi\211t\322\202\246\035\223\217\367#\001\365s2zb\3329\031%\371~F\013\006\270\007\305\363\031\245\350\365|F\347xk\020+F\b.\301\277v\033F\210i\232,\252D\365\3126Q5\204\252\372\302\365\343\255[\304\023y\t!\333r+\2204bni\270\241\032C5\204\232P\026RP\025\022\006\325\022\f\f\b\213\316\250\035\350\325\021P\375\332\r\274\001\203R\305x\200\250A1\251\023-/8\3654\314\235\263\037e\335\362\321\216\373!\205\313\346\256v\334\022*\\\243\356\036#\213\352\225\375S\355\t4\306O\ra\226'X\324\325\200\235\250\221@\311\230\231\031\031I\n\222$I\007\260\002\221\241c\035\022"
+	.string	"vEJ\231\231\221\300\226\235z\227\003#\302\377\206U\bV\236\363M\247\232mU\247\325&\305\306o\372\003\271>.\304Q=L\346\364\f\307#?\337Y\024S?\024\204\337d5;8\030\n\271\301Z4\240\354'\325\202Z\254h \345\234\346\370#8\251:\211\251\004\023\fT\256\306>\250nf\330\001\341\306\363\025\006\021\356W\316\327q\263\225\240E\266?\035\363L\"\313\224\343\316{?\322wH\016\361\377E\223-\326\335\241\211D\322\007\022\305\2401\030\331\250eJ0\035\334'\202H2!\026\201i\016\t:{o\203`\372Hp\313\226\370\0207\217\006\323\267\002\341\206"
+	.string	" F\304\263\333ol\224\035\252\264\t\213H%\302\344\252\253\220?0p6\020\255#\235\220\fV';F~\006\013\002\212\023\32766\302\2711:=\247\326l\300n\\\370\fG\366\203)\301\030\214\317}\006\031\235\210\031d\222\332\263\200\311\300p\030w\241\375Q"
+	.ascii	"\n\033\367(\324Z\340|\00664\311\331c\315,\351|&\350i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375`\372\bM!"
+	.string	"\346t\305Gp\250m\016\0232*RZ_8\306\245d\302\377;Ny\345\246\224P\023\302\205|\220*\303h\307\236\2565;\201\tI`\242\320\270\230P\030\020\331\2568\354\230\031W\325\307\0320q\f\333\271\220\377&l\242F\211H\031\267"
+	.string	"\254"
+	.string	"\262"
+	.string	"\377\264\333`\2535\001\034\017\265o\374\002\033\257\240\254\361?\035\313\351qF\343\231f\374R)\343\023\354\030\177"
+	.string	"\306+\275\370$\275\306\314\230\227\2137\320\342\003\220\233\305\013\221+\242l*\2006\2555\351\006\277\342\244\370\035I\362\310J2\004\305\037\221{L\353\365\343\304\367L<\201\t\252\255\304\033\221\370\001#\264\030\333Q\304\023\361B\274.\036A<\322\207g\365xx^\207/\"\3158\374\320\206_I\327z\277`*\350\366\325<\305\207\206G@\226m\333\266\031\336\307\001\203\004\233\037\217\307\343\205/`\266\256\033\364\322\372\265&\013\356(\256\2659\026^"
+	.ascii	"\251\265\376\271\0233\002\324Sx\223hy\270\300\022\240\236\233"
+	.ascii	"\227P\317\341^\024\336Z\314\035\026aB\335\234\267s\255\315)*"
+	.ascii	"\241\276\347M\266m\273\343\207*@\375T\372q\324\210"
+	.string	"\nO\243\276\271\t\313{\027\325\320\232$\335|S\201\235\314\220U\314;\311\212\2220\003\247\357\027\311t$\237\351\246\331.\275\334G^\227\031y\bZ\377 \353\247\212\274\003\254g@\344\233\202\337`\310;]\275>#\3445\030\253\327a\202\274\216\201\274\324\217\327\304\252\327dT\257\303|\274\036\323\343\365\360}=\306\3435\031\367u\231\275\343\265\231\335\276\026\373\327\262\216\217\220#i\256\2408\3309\322\203\235\263X\326\362\324ZK\2428]\235\350\335[\210\220\017\027\247\325\003\300{\023\021B\371\362\264n\255*\301)\277\325u\357\322\352\271\333\3528#\320\352\347\274\265\234\241\233-M+y\026Vf\347i\365\355n\247\243\206\266\365\263\272\221\273I\260\257#_\202TW\345M\212}\275A\373\251\276>\305,@\325O\243\316M\255\240\3224\246A\272M\031X\023\247 7]4\365=\357\370\226\372\206\207M\251{"
+	.string	"J\235\302.\033\244\216\306\233\004"
+	.string	"\344'\274"
+	.string	"\347\246\274\241\250\274Ha\200s\020{\257m\035\305\2008W\341\003\250\353f\035\034z\317{\027\267\366h\371\025p\363e\352\365|\313D7\300\243#\327\275\273h\230\026\004\310\363\334\273M,b\225\004\236\367J\236\367J\243%r\027Y:\300'\354\212\212H+6]J\246\210\\UcK\241Xe]H\270\262.\344\356\235\005\244\016\026\216U\327HA\003\201u\335;\305z*\334N\264\323\306Y\317\t\367m\246z\242c\231\230u]\331\254\237\361\311z\332\233x\030\201u\363\335OF5Q\200,\0318\304.S\254\357\331\327\347,\253\213\224"
+	.ascii	"\337\262oH\307x\220\314RC\236\203\241v\216\272\346\316Oy\353"
+	.ascii	"1\253%iQ;?\337\275\253\002\200\221\250Q"
+	.string	"\024\006\003\221\b\321\202\224\224\264p\320\002\251\231\3326\021\300\224\246\f#\022HD3\201\214\214\036L\244\243\233\266v\344U]\270\231Xd<g\013\2023%\027\367a\013\007\322\262\311\247yf\264\351\213\nCC8\306\203\231\310}\354\035o\r\221jhx\217jR#\224\030\303\233npqHZ\236\320GT6\240\025\316\23257\276}\233\337V'\260\232J\272\345\226|\270\322\223\n\035\261\346\034*.\034\252\353\350\225:<\254\3478eD\274wP\351\246\275\254\232\002\204\347\301\273\210\302f1e\377\330D\226\241\320\242\016\3204\216\317q\034^t\201\202\305e\213\026\257>\222Z\332\335b\352n3\"\201\340\276\257\346\3027Ga\\\267\261Y\036\023vvP\223\027s\324\345\303\374n{\206\311\007\206\231\227\362G\334n\203Sk9\357|\364\002x-h[\350\234W\352\255\254\254\262\343\3175vy\336\261o"
+	.ascii	"9\362t0G*`\373ff\375\037"
+	.text
+	.section	.gnu.lto_.refs.1348ab607eda480,"e",@progbits
+	.string	"(\265/\375 \311\005\004"
+	.string	"bI\031\037\2205I\007\377\377\377\377\377\377\377\217\340[\257\260\277\265o\337\276\375\347\017\317?\005d\333R\246\277\316\330\365CE9KlG\277\321\177\372\213n\247\273\351f\272\227\276\322\027\364Qw\240k\222\333\021u\221\341Kw\341\360h\271JC\007H\374\221\250p\2248\023_\"\241f\362`#}\366W\"\365\370\366\007\004\b"
+	.ascii	"1\023\306\310\030w\314\260L\214\2051Ii\021\021\204\253\273Z\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.decls.1348ab607eda480,"e",@progbits
+	.ascii	"(\265/\375`s\\mx\001\212f\026\205U \016%\225t\317UWZ\006DPDA"
+	.ascii	"\020UA\005UT\215l0Q\275\242\201\210\333\t\t\211\250\325\215l"
+	.ascii	"\254\266Q\035&\037\263V F \227\305\250\220Tr\303\335\r\332\327"
+	.ascii	"\036\252S\300\311v\016\363v\216\003v\027\213\221\204a\0263km"
+	.ascii	"\204\020\262\267\334)\372\006:\bu\bI\032_]#W\205z\215\177\246"
+	.ascii	"P/\330V\377\2116H\341\024\244\306\177[uU\032\244\211\026\251"
+	.ascii	"\306T(\260\262b\327\370\270\213\332S}c\3159\252S\224\254\324"
+	.ascii	"\370\330O=\216\3225\376fvSK\325H\331\303\352kL#g\206\312,\210"
+	.ascii	"X\343c8\265e4T\033\321\034\331\344#+$\177\317\350\250\216a\327"
+	.ascii	"\226\3210\324\212\274\260n4E6\371\310\310\255\3312\372\311\272"
+	.ascii	"Y\274\254\\\264\034!H\022\275\272\301\032\262\027OQ*>\326R\217"
+	.ascii	"\243\324\343'\365X\205\372\353E\305\331\342\240_\355\r\332\231"
+	.ascii	"\212\372\273\244YX\026WhY\032\377\036Q{\305\355\241\366jo\320"
+	.ascii	"_\250\317u\212\\cs\320-s4\376u\241\276\275\250\035\272\210x\264"
+	.ascii	"\326\360\\\245\3115~cQ\337t\352\033M\275\331\342\240 \330\033"
+	.ascii	"\264\223\330\033\364|\026\307\013\341iV'\244\250\261\035\264"
+	.ascii	"]\354j\t\277\316\334\"(;$\215o;\2405\035\320\337r\021\204:+\364"
+	.ascii	"j,h\223\330+\227\214y\202Q\341o\263X-v\213]\255\240\005\274\r"
+	.ascii	"\264X\316\200\337\242\tZ#\206\200E~\213&h\323\016\001s^?\310"
+	.ascii	"\371\340\003\230*z\204X*F\247,\016\372(\366\006}\003Q\177\013"
+	.ascii	"\207f\221\330\277\236\332\340\301U!\227\306~9(\023&\340\224\306"
+	.ascii	"o\034\352\177[\305R\261S\354\236\265b\371\354j\373l\336\255\236"
+	.ascii	"\215r\274\346|\224s\006a\373l\023\213w\311\230*\022#?\300\234"
+	.ascii	"\363m\234\224.rsi\232\325 \003~\020\267}\026\212u\273k\0225\311"
+	.ascii	"\254\017P\t\235U\243Y\332d#\275+\315\234\327\333\260\037\304"
+	.ascii	"\037B\004\333g\227X\265\2736\263\221\336[\004\316\334\234\232"
+	.ascii	"\006s^s>\250\331\343\242\306\204\006\337\362\251\307\2638\250"
+	.ascii	"\214\275Ao\347\324[5\373\304\236\245\345\360\322\370\326K\265"
+	.ascii	"N\254\235]\355\335o\353,\223\343\262\251|\226s\236\211\271J\242"
+	.ascii	"V\324\270\205\234s\266\237C\323\303\303\303C\3739\364\026K\305"
+	.ascii	"\366\006\345\300\342\240\267O\352m\221z5\213\203^\005\365I,\016"
+	.ascii	"\372%\026\007\265o n\341nPf\324\232\325r\3165\002h\233{k\234"
+	.ascii	"\332\033\364:*\232-\016j\217X6\273r\260m\267k\266\310\317\242"
+	.ascii	"5\2579\2575\255\243p\315\254\361A\240\336r@\357\341\241\345\200"
+	.ascii	"~\002j\333\0334\317\030\0061\364\322\370\037\324\343\331\033"
+	.ascii	"\324\306\342\240\277=\333\240f\205Z\302\321\370\267f\277\035"
+	.ascii	"b\303l\331Uj1\225\325r^3\334\025bZ\2204\266b\226\210]"
+	.string	"7\260d\017!\302\357\262l\r\313y\255\221ab\3221\325\370\034\324\333\261\327\224e\021\336\352\355\006\250=\264\033\240_-\016\252\332\033\364\267T\240\372^X.V\257\027\320\n\210\322\334YK\3539\273\205n\3604\r>\202\262\030\r?\272\341\267\310\037\024\2347?\032\363[\240\f6\334\021\377\235\262\030|\004\026\206\266\027\340G\355}r\327\b\260tMH\363\237\202\277%\202\341\332\375\026\006\017,\002\374zL\334\270V\201\314\217\273\330\030\013\303\256p\001\b6\351\035\374\247\336\337p\327\311\17798\314\177\316\375v+\312\366\300@\327|6\377\371\366w\333mru\353\376>\241\232\205\313\344o\265\273d\350\322\375\255t\225\374\227\306\\\024\f\030\370-\0078\\\271\377\306\375-\202\204\020>\201\377<\362[\025\372\001\027.\006\t-\340\300\277\317F\257\t\376\236@\333ow~\3330\034\347?G\374\226\205\337z"
+	.string	"\213\316e\373\257\301g~\254\0074\204\301\n[\374\255\t~\273\265\341\267\031\370\374V\003\253\374\355\317o\221\277E\301M\341\310\211\027\210\027\264\004\016"
+	.string	"B+\340\032\371\357\332)\360\2375\354\212n\352.\233\200\277A\020\375\326\303\n\377\025S\373;\306M\373m\023\007\022\374\026\001\027$%\371O\302\177R\331\036\016\304\227\260I \3766\003q\321\236fSXA\314\261I\267\310\337 \210x\361\367\220{\366\337\241\233\202\377\232\375\275\001\030\366E\021\213\277K\374m\302\256\370m\322M\334\262\277K\2600\234"
+	.string	"\377\251\342o\252K\366w\323\337\367\256\377E1\366wW7\257\nD~\373\364[\027\177\203\360\337\304\025\373\355\341\337\035ca\270"
+	.string	"\376\323\205\277}n\330\177\023\360\333\255!\347`c\222^\363\237\036\374\335u\205\3746\313\026<\250\3376q\341\361\337 \377\323r\376k`c\006\273y\026\037"
+	.string	"F\302\235"
+	.string	"\220\377\376h\376\027\304\177=t\375\267\004\327\177C\260\365\013\316\301\322\331\255\233\2600\334\203\377\264\300\177\262\227\365\021\375q\334o\373~k\345\267T~\373w=\330\361[\343o[H\341\267x\277}\362[=\236\337\232\360\333\244N\320o\217\277\025\262*\330\023\256\301\323T\034\340?oN`\021\360\013\376s\254\235\350\270\2114\273!\377e\301oW\370\273"
+	.string	"\377\325\372\273xs\374v\255\215n\326\177S\304\360_&\254\377U\376\317\375\255\344^\375\227\322S\202\213\343\277+\370[\004V\3777\374\267\373\317\301\322\3314\314C\374g\f\277M\301\265\251\372\355\t~\333\363[\272\313\001\025\002,\f\177\037\375\317\360\237\304\377N\375W\352\277Q\377\205\372\357\323\177\235\376\313\374/\322\177Y\360_\026\376\233\202\377\376\374\327\347\277\305\377\236\340\277#\370\257\b\376k\342\277'\374\227\002\377%\341\277\020\370o\b\377\r\361_\005\374\367"
+	.ascii	"\377\355\340\277\031\376K\363\337\230\377\236\377\375\337\204"
+	.ascii	"\177o\371;\360\357*\177\363\375-\345\357'\177\333\375\315\344"
+	.ascii	"o\272\277\343\376N\362\267\333\337k\177\237"
+	.string	"\375\035\366\367\217\277\233\177{\375\215\365w\325\337Q\177;\375\255\342\357\243\277U\360w\013\177'\377N\301\337\307\337\246\375\335\341\357\342\3375\377\375~\033\200\337\236\277\025\374-\227\337\366o5\360\333\277\337\352\375\366\205\277u\3766\301o\303~\273\376V\353o\021\374-\342\267E\177\177\340o\023\177\227\360\367\t\177O\340\267[\277E\300\337\022\370\233\204\277\035\360w\b\277\365\360[\005\374\327\340o\020\177/\340o\005\374\357\362[\342\177\016\277=\341\377\b~\313\201\377m\277\205\300\377\264\377&~\353\301\177\262\277?\370\255\007~\033\363[\272\277\021\3607\207\2773\374m\363\367\314\3372\177\303\374M\374[\375;\375\373\376\375\337~\371\355\340o\267\374\026\360\267I\277\275\362\333(\277m\362\333\272\377%~\313\344\267K~+\365[\032\277\235\361[\031\277\215\372m\214\337\302\360\237\360\377\226\377f\377\313\376G\375o\362\177"
+	.string	"\207\207\207\207\277\215\314/\303\344\237"
+	.ascii	"\013\002N\332\213\314\024\022<!+\032\377H\2668(\261io\320\317"
+	.ascii	"\030\342%[X\bR\241S\"\207\307\206\226d\305I\260\034\006\326\274"
+	.ascii	"\204YZ\376\201\rf&3\001X\356o&\374\206\375|p\251h\214\341@\034"
+	.ascii	"\307\311\254X\341\245\245\261=\2647\250\315L\230\332\206\335"
+	.ascii	"\330\210oNZ\3105\376\314U\033\033\214T3\312\241\3321\033>\202"
+	.ascii	"\032"
+	.string	"\315"
+	.string	"\022\24316B\323\226\342J\227\306\237\221\201\327pZc\005\211q\004\2531Fk\253.\2576\027\215q\021b\222\302;\255\306\027\304g\377\211\251\222>%fg7\303ZS\303eH.\n\221\350\032\177&\205:\206W,9\206\224\337\030\221\276\303qu\305\324\030\207\245X9r|5\276\314\022<\004\013!\346)=\006q\220c!_\b\243\0245\376\201\201\240{\314C\244\265\037\270\307\221\nH\224\306\227\361\302_\230\007\366:\373n\314p\253Y\026\312-5\306\\\267\005\207\207\207\207_r.\302\\\215\233\270\353\230\353\326v`m\0075)\037\230R\021\212w\254gwS\366\370\032_fk]s\31654\204zL\\\264p\016\030/UUai\025'&RY\307T\177\203eh\215\337\205/T"
+	.ascii	"\322h-\264\353-\217\310`\r\034e\361\242\362\275"
+	.string	"\342\225G\004\214\312\023\216\272k3M3R\002\234a\330\224a\325\272\002\363\210\f\342\0300\016\\\205\2550\026\236\302Wv\305T\330\306\355\033\276\221\2170\025\226\302Q4\31353\245LdyD\006s\316\266\217\017\214\312\006\217`q\320\307\020\252\217\001T\037\263\247>\346\211\372\030$\352c\306T\f\003C\3315\007\307\3103r!\325\3701`j\013\262\315A\177hs\320\307`\251\217\231\241\376\330)g\306\312\027\273\273&\314\004\242\025\003]c\314t\2025\213@5~\314\222\372c\027\366\256\311/p\t\267h\267 `Cp\013\256\236b\242R\222\034\331\261\260\177\350\f,5\310VH\335)A\031XT\364\026\321\005X\021B%\234\324\203\031\265\324\370v\305IH#l$\311\202S\034#a*)T\274h|\301\246\373O\204\331\253\342\005\017\037a#$\262\032ZE\307Fj)\344\r\031\352\2307\032\207"
+	.string	"q\\\004&G\325\245\361\217\2278\323T\t\262\344\3608\2639\261\231\371h|\rA\374\036\242\206]X\2505\256)\374\022\206\344o%\374\375\362_/w\017\331%\003\255\361\2657\250]\003\361Kx\223(A\372\322\345\016\3125\231\222\2421\325z\004\267\325\205\304e\313\017\246\032R\215\257\340\305\302\2275\343\257\361a\276\250g@\026.-v\275Y~\261|\220\223b9,\222\201q`\207\231.{F`\200W\224\244\\9k|\377r\316!?|L5>\314\237j\345\036\t\351'\353F\323d\223\217\214\206T\271}\327\317\256\327\312\357\224\313w\251\334\275k\345\332Y\267{\326T\223\314\302"
+	.string	"s^\315\314\264\264Pq\007\213\203\236\366\006\315\271R\242\254\251-\351\321\370\352\325\250m\235\331h|\030<(\027\317\2567\357\367\211]\263\322\232s\276\b\375\244u\363\256\235\017\246^\335 Z\203\317\t\026\212\2110v\\d4\033\037\206\211z\0309\365\277N\326\232\254\250k\255t\210\022+5&Kb`\254F\306z\211\232L\025\326\335\220\306\315\274\272:F@b\022\231\314\264"
+	.string	"\2314m4\255a\327\215\2465\334\221\365\203\306\265q\343Z\351m\t\271bzKdA\230\312.\332\bHL\342\013\243\025\315\304q\277\021\220\230D$=\035a@.\327\214\246\241W\r\036W\355~]\037zR\200\327\306U\263M\272"
+	.string	"\301.\327%c\252if2"
+	.string	"\215\\\270\353v\351\256\334\235\273J.\333=r\343n\333]\273I\356\333M\273H\354z\325z\356\350\252]\"\227\314\213\354\353n0\347\225\246l\307\322J"
+	.ascii	"\374_\264\"jd}UV\314c\n\222\256"
+	.string	"{v\315P\"zYu\215\017\203\245\036\346\306]k\270,i\331k|\230'\365\2161\3350\231\036NL\\\215\017\263\274C\210]\324\023\001\325\023\365\324\023\225\250'\266\251\377\365\321\243\331U\346\327\030\257F\306p\210\036U\343\023\317T\016\354\rz\"\020\365D-\365\304\032w\213\270\227\245\206Z\343\023\237\324\023\223r\\\255,\234\"..\353/\307\263\320<\261\214\326\370f\325l\271A\301\321\370bY\267C7's\215/x\277\377\304\030:-\253\273\306W\365\324\253r\267*\306U\221_\343\253D\324\333\365RM\301\024r\335\r6\376\377;\365\277\231<'*\271\361U/\365In\215n\223\312 \005\362v\003\213\006\007\365(\356H\330\2147\301<\346\216\250d(\235\325i\271k\374\337\250\373\"\255\016\n]\3433\340\351\032\321\2349O\3715\273\260\r\255\232\305\213\"A\310}q\221.\223\006FJ\034"
+	.string	"\353\003,\022B\204\373\342\036Y5\232\233\263\215\277\013u\235\356\323\215qa\330\365\276\350\033\277\314\333t_\364\3415\242)Z33\335\n\254\3322\230s&\226]\035R\221\301v\2658h\216\275A]\344X\027yq\205\215\257>\251\377o\213\313\302\256w\351\252x\223\335\024\317Ysf[q\225h\226\031r\306!\326\274K7\351*i`\244\224q\332zX\007\226\363\232\363\301\007\330\310\214\212\023\024?\rT\237VQ\377\253d\325Z\317\256\205Q\343\247{\352\323<\325\246N\324\233\357\322\256\031\334\",YFM\215\237\312\251,\310\331f\200\332\303C\233\001\372\264M}j\246\202\320_\274\3409!^S\215\t\323'-`\320h\3744\210*\266V\001\004\221\244\341^\2200\004/\314\253\265\320\254\2744\223\215\356\032\001\211Ida\364\245\225\226"
+	.ascii	"\311\324\372\210X\266\205\313\267\246^\335`7y4V\bcS\205\371m"
+	.ascii	"\r\363\003\024\241\307X\326\253\033TR\321-.\031S5RD\t0\347\325"
+	.ascii	"\026\0365R\boSzu\203M\306\326H8\030\002h\013\371:\351\215\251"
+	.ascii	"W7\350\303\252\205 \006\250W7\310\304\327N]\303\342\251\345\354"
+	.ascii	"D\302X\022\275\272\301\316\353\300\316\322~m\245\377Z\260\365"
+	.ascii	"\232Joi.\215\245\237\364\225\256\322P\032\260\361z\257\273\264"
+	.ascii	"\224\326\322}=\330Qz\212]\233\257\227\274\231t\335s@\3105\335"
+	.ascii	"\bHL\242\0133'\200-6f\245I\326|}\326iwm^\300\212\n \210\2706"
+	.ascii	"j\032aH\022\275\272\301Vra\330\314y-l\276n\322w\026/*\347\246"
+	.ascii	"\020\336r\377\340k =d\004$&q\205\336\037`\316k\213\3615\221n"
+	.ascii	"a\361\324r\221S\007\261U\257n\260\233|\375\325Z\026/*/\003\r"
+	.ascii	"0\306\324\253\033\314y\375 \347\003kwx\305\254\001\270\357~k"
+	.ascii	"h\017\357\n\251#\034\215\333\t\210\267]\npL\345h\374a\207\232"
+	.ascii	"A\2668\350e\332\033\364i\225\3727\235\222\024\204ugJzN\306\306"
+	.ascii	"\325\214)\215\237\302P\2372\325\247K\265\337h\210p\001+k|t\212"
+	.ascii	"ztI[\273\235,\240\244=\265\265\025Yk#\275\"I\005Z\343\243>\326"
+	.ascii	"P-\365o\264w\332\337emf\325R\230\361\213\353a\330\270\213\200"
+	.ascii	"x\243\301\2440\323\242\321\330\216\341PeV{\203\332\324P\217>"
+	.ascii	"\251GU\250\026-R\033\254\203\330\365MZ\310q\310\360\252\321\370"
+	.ascii	"\247\026\365\366M\320\026\3307A\177ZQ-\236\275A\177BQ\177\322"
+	.ascii	"\251?\315\324\237`\352O-\325\002\332\033\264\271T\275>-U\032"
+	.ascii	"\377\244\241\336\256\275\265\303\256\313C*1\274w\374!Dh-\231"
+	.ascii	"\234\303r\316\032\304<\301\3115n\255\356\034\255\343\255\325"
+	.ascii	"Y\017!\302e\216rX\316kk\341\234\213\254\355\200\306\332\016\316"
+	.ascii	"\271\255\"3\024\377\204\2416\016\"\366\301V\030\203\247"
+	.ascii	"\331\\\013\030\204J\224\240KlYf\322\020\027\303\347V$\213\356"
+	.ascii	"\350\222\231$PZnwI\222\240rq\313\257\273A;+\025G\320\270\243"
+	.ascii	"rWz;\254\340d\326e\376C\341\3207\"\226>+G4F4\232lfG\213\230\241"
+	.ascii	"nW\357\210\020\032\026W\252\256\324\216\272\035m\013!\302\375"
+	.ascii	"\202\260\320\320\032\243l\2679\262\240)5>z\204\350\325\307f\330"
+	.ascii	"\0305\262\200\032\204T_\032\037]\313\312\333\362\321\270\355"
+	.ascii	"\347P4m\t\316G\215\306(\332\257\314\260\221eI\241gE\210\020A"
+	.ascii	"\311\254\315j$\005\254y\036\335\320\321d=J\226\002\306\255\205"
+	.ascii	"5F\307\220\334\325\3655\303\302N\273\017\274\321hazb\336\370"
+	.ascii	"\361\003\025b\3132S\211\246\257;0\271\243\260\030\320 G\205\314"
+	.ascii	"`u\201\253\321\030\005;\2270L\202{_\215Q \0300{\3648\355r\324"
+	.ascii	",V\204\0130\347\250\016\350\223>\256\030\032\037\203%\027\027"
+	.ascii	"\312#gj\031\330a.\360\353\356\320o\354\313\353(\017\374\325t"
+	.ascii	"\347\2441\332<\227\351\\\\\f\036]\377\211 \210\242"
+	.string	"\203\020\355\272\\k\177x,\032\037\307JV\026\272\343\367(\333\030k\312\364\365\020\353\322qt\307\214\017f\024\261\306\250\326\007\315f\\c4\307\225G`A\032_\360r\3351}!l|\234%VV(\226-\313Lh\fyV\f\325\265\3000\261\253\243X\252\023\032oU\032\2438\032\020eII\343\013n`\305-\312\223\306\307\371zq4\306\013\224\352\356\311\344eYfJ\221\324U\031\034\314JQ\035b\310X\220A\221:Jut*\204\b\367\003\373\261W\324\030\275q\232(;8\300\306Gk\2406~\"\314\327\325\031\220\306\307yR\277\2002\250\246\246\306(\215\373\365\360k\021\330\030\235\3619\231\250)\20314\276 *\343\316J\317\2501\032E\003\227\264\326\244\361q\226T\024\306Q\250\237H\204\263qU\325\3708)\324\037}\372\211\251\221=\032\315\306\307\311\3525tA\231L\264)gj\211\305"
+	.string	"_\313\250\016\230F\221![Sc\005:\245`\322\370\032\366\320%t\tu1#}\013\214aZ\373\262\206\272\270\\U\200\340u\275%%\241,\306\274d\274~\364i\2558\312\002\207\337\212\2651\252\242\261h^\374\370\241\326\030U\002C\213\320\"4\205:\004\312\f\037\025+\026\350\321\321\0242EcsP\032\243F\215E\267\006\346\004\365\345\013\232\277\232L`\310\344rx4\253B\004\235\2105>\r\033+N\212\221\264\306ga\nK\364\252\254\333\330W\024V\343k0\032\034<\t1p\243\211\310\302\217\013\251\313OB\264(,\300\376\262d9\267\2444\336j\330\376\216\\5>\267\2449\242\332\2624>\2654\026L\214fYWwa\300\260\225\260\361o\230\364\365\235\201rAf"
+	.ascii	"\316\314\251\230\323\001\3703\260\350\311\025\025\215\317+VM"
+	.ascii	"%\262\002\b\\\343\363\357*\205I\251\021i|\372}\356\226\265\325"
+	.ascii	"\021\001[\342\201%\343H\225*g\334\226\264\211lf5kZj\374\033\261"
+	.ascii	")SN>A\264\360\r\235\022\034\362\223\217\350\365e\325\242\361"
+	.ascii	"ov@\201rJA\003\311\376\300\300h\362\341W\221(?\245\324\034\031"
+	.ascii	"-1l|\352a\037\030\013\360l\254\361\231'W&\207tC\343\311\2233"
+	.ascii	"N\257\255\231\243\242:\020\007\367\200"
+	.string	"\260mi\322\344\264\313\001\322\004$H\027'N~\332\375a\321X\2065\276\340\271\304\333\262E\255\361/P\242\376'\223\333\365d\202\363lY^\326\350\300\362UGc\204\211\356\251\361/\210R\377sn\356\244\323\223\222J\200\212\225\202\212\330\251\304\242\255fr\215W\rQ@\\4\376\005.\340\340\3168$^Q\035N-L{7\004\355z\306\345\365\3402\322\370\031\270$Irb\2410\226\177``\031\360\316#\347\221\323\315+\360l\373\351v\273\004\247\366\032\237lehh\347\032\022&\035\200j?\327\260\231T\225/.\032\237i\370J\2210\244\024\030\t\315\225\300$/\215\237\241\352$r\0229\317l\262\221\337a\3634\373y6\227\004\311\307Q\343\263\f_\2711c\212\216\306'\031F\002S\326\246\"\257\361\271\312@\265=\241\322\370\034\353\026\252\013<\036b\031V\200\035\354\f\353\234sn\246iKM"
+	.ascii	"\317\2609\273\227wE\327\370\024\222\301\n\027\262\306g\220\266"
+	.ascii	"\232Y\272E\345 T\177~\331\323\307\351u\3768\277\324\334<\341"
+	.ascii	"\210\024`f>%\3406\201\352m\366\324\363\253m\3628\320\020\221"
+	.ascii	"B&\244\214xdH\217\026\215\263N\257\254\263\211\346l\327)&f\216"
+	.ascii	"bv\310\221\343l\332\314\374\242\372\003\033\354\372\331\224q"
+	.ascii	"\322\002K\224\306'\027\r\216\036[\2504>u\234[\250Y\020\031n\347"
+	.ascii	"\326\271C\025\273[{r>I1\361j|j\331\260\251\267\351:q\2348N\254"
+	.ascii	"9\252\363\352'\326[\213(\030\370J\314\022\222!Y\343\333@\315"
+	.ascii	"\230qV\201\220\021\370\0076xV\321|\r\3311\326\370\234\302Wz\351"
+	.ascii	"\325\343K\343\363\2065\263Yu^l\215O\033\237#\352\220\003\254"
+	.ascii	"k|\326\260f4\332\004g4>\245>\247\026\312\370a\330\370\244ac\364"
+	.ascii	"\364tFa\361\300KS\214\237QWI\314GW`\343\023\n_\331{Z\2354>a\\"
+	.ascii	"\216m\211\231\216\313\2458\n\225\320\374N\026'\213\323\311\316"
+	.ascii	"y\375\201\2015\375t\372\\\224\260\273\034\215O\346U:\251\f\251"
+	.ascii	"\313k|2\3214\371\210\241\256\361\351\342sX\f\311rJ\343s\251\275"
+	.ascii	"\360\275p\321\370lQ#\306\305mE\267P\265\274p*k\374\232\271\023"
+	.ascii	"\351D:U\330@\020\304\226J?U\300@m\001\003k|&\201\031\032\236"
+	.ascii	"Gj\316y\213\3524\372y\004s\006\210F\243\361Y\244.yq\025\330\030"
+	.ascii	"\037\236\313\377\304\230\334\246\204\260\361\177.\317|\227\270"
+	.ascii	"h\242\0033\341\031G\344\230h\375'\312\254p\212\263\321\3705:"
+	.ascii	"\b\t\361\227[\246\216TF\223\227\343/\370\312\314\341\r\026W\260"
+	.ascii	"\216\250X\201j\374\032\031\202\202x\260I \227\343\301n\302jB"
+	.ascii	"i\214\267lP\342\264\205\305\220\266\272\346\032\237\306\213\372"
+	.ascii	"\343,\267+\316\202\361pY^\306HY\341\0046\230sT\002R.dP\002\247"
+	.ascii	"X\271\025\034x\233\234\263Q\3166j\240o^\200\307\201'\220\027"
+	.ascii	"UJ\032\343>|\345?\361\004-\374\364\256\340\2773\033T^\020f\342"
+	.ascii	"\f!yz\330\257\227\334\247\272\256\300\306\027<\255\266\364!i"
+	.ascii	"|\2327\365X\017G9\226\202\245`*\304\234s\216\312K,\035\304\200"
+	.ascii	"\362\0076\230\243\230\035~\314wL\305\252\311`A\305\021i\214\247"
+	.ascii	"X\265\377\304\273\267\343\355Kc\274g\315f\016\t\017\317\346`"
+	.ascii	"\274\r\261k|\2320\365\277}\377h.b\346\234\235\31653\215d\320"
+	.ascii	"\337\336\236\326v\370g\354\265\004\370\217\357I Z\263\321^_\316"
+	.ascii	"\331jQ\277\220\024\321\340 \377\177\207\234\2276\347\314T:\253"
+	.ascii	"ZfP:+\312JE\360\2322(\235U5)\255\231jC>\303\221\225\326\251%"
+	.ascii	"\236Z\346\234\227\235\327|T\325\224\217\246\226CJkf\346uji\223"
+	.ascii	"\217\232l\224\326\242\245\322YU\223U:\233jR:\233j\312\220\217"
+	.ascii	"\3622\037\025Q\251GSMJN\246\232l\224\316\212\232\224\216\252"
+	.ascii	"\232\354:\225-\224\270\265j\211\224\317\212fr\316-"
+	.string	"\326\346R&\347\"f^\346\365R\256\002\\\3126\262\305\013\262\342\3109/\325\370\254\246\210\253Q\306S\3521\345\203\2243_^\nai\227k\3169)\033-m\316H+3g\243\251\024\242r\316y\312FIb\346\231|T\324\302\310jJ\006\311h*)\367\240\2629\347\334\244tf5\005\342\r\355\254\231\215\326\245Uj1\225\233\231\257\212\251\236-m\226\2313\035Q-\032C!f\tI[\321\3704P*~b\241\356\252\b\033\237&I\375q\235]q\035\266#*a\271;\300\314d&"
+	.string	"\333\375\270\t\016\310\242\317\0166\256 \004\004d\004Jy\2120(\240\b:*}\222\307\240\243\tB&\220B&(\217E\026<0&\205~vjx\202\216=\032\202\214CB4J\244\020\211\013H\264`<\201'\350\330\223\243<\006e\240\207\350DREA\310\204\317\216\362\310B\t\024A\307\240c\021\310\210B\017\321\211\344\005H%\211\036\242\023\311\364>\036\214@G%"
+	.string	"\222\307\237\237#\020z\037\017\"\204L(\215I#\n\311\r\367\361p\374\331\371p\374\331A\032\225A\0268\376\354\250.(\207\200,\240<\002%\203\212H\023\311c"
+	.string	"2\2700\264\003d\004B\225G  \rAG\024F\021=D\"x\202,`\002\347\202\373x\330A\356\344\204H\352\234X\201Gg\204\035\344N\314}<\240\b:\"\225\311\017F\036\242\237\235\240\343\007d\222\350\003\006??DAABA\251R\307\370\3021\211\262 \204\364Q\n\005\245=E\343\017V\032\223@F \324\2104\301\204\210\034\345\021\350\310\001\243\262\210\202\261\003\343\t\024A\307\fhP\"\213\312\022\032|\222D$\224\307\240\f\314\240\b:*\217\305\020\330\2240"
+	.ascii	"OO\006\222E\343\217\021\205\373x\030J\002\351(\221BCBG\016\206"
+	.ascii	"\222#4H\022\223J\244\020\t\243\262\270#\364\363C\001\f\222\033"
+	.ascii	"\f@\005\301\303\316\021Eq\304P\022\bF\004#F\\\020<(\221\305!"
+	.ascii	"\017$rx\202\214%.0\002\025\221&\030W@\032\223F\024p\214<B;A\026"
+	.ascii	"\330PT\026+\240\301\b\2451iD\312(\221B$x\202\216&d\340\331\340"
+	.ascii	"\006\247\207HD\t\032\276sD\032\203\214(\324\207\320\200\0054"
+	.ascii	"`\204\026ReR\211T\215:&h\370N\017\221\b%Q\007\206\222@5<AE  "
+	.ascii	"\241\02200\352\2400\224\004\212Q&o\220F\236\242\320\217RH\350"
+	.ascii	"\304\006\244\222D\220\t.\374\f\031QH&\215;BH\022CI \rF\235\n"
+	.ascii	"\f%\201h\214:Ee\261\002C\311\021AB'\030\225E\242\237\342\n\026"
+	.ascii	"\030J\002mP\006\035\357}<l\220\324"
+	.string	"1\376\034{\204\220$4\374\b\355\020\225I\"\024\360P\200\005!$Q\2114\256\020tDk\222Ic\220\322\007\305\021)\302\250<\372\260P\203\226\340\311\2204*\217\310\020\304(u: b\304\0074`\243\324\t\241\324\001\001\002\244\221\247h\304\300P\022h\206\0075\276pL\342\017I\244q\205#\222\007\0046\306\237\023E\023+\240F\035#\217\320\b%Rh\b\306\310#\004\204\215:\035P\"\205\206f\222B\251QYD\201\207\250xB5\276p,a|\341XBU\252<E#\006\2202<E#\006\224:!\030\360s,\232@\032{z\210D\264\240\224Y\341h\3341\242\220\003ST\026+\320\002\222\006\251$\221\001\034\025v\212'~~\212%\030\177x\2162\367\361\200\243\274\217\207\036\242\023\037\202\204\200\200\204v\004\300\023d\274I\235\036\242\023I\024\251\034\272=D'n\022E\361\247\347T\3524"
+	.string	"\304\017Q\322\210D\215\310#\017Q)\223\324Q\"\205H\f%\201\210I\035\031%Rh\b'G\270\240<\256pT\356P@\231,\376\320\030u\200\214\312\244\013%H\f%\2012@\021t\344\t2\016\321\030u\214\312\"\214QYT&uvR\243\216q\310\005\0235\306!\027L\f\301\364\020\211\b:\236$J\214\340\001\332A\223(\212?&\360"
+	.string	"\355\2500Jc\262\247G\bM\026{t\224AG\242\031\343\013\307\022Ee\221G\005\021\002\210(\251\302\216\321g\207h\302Gy\f\001\217\021Y\364I\336\360\300(\221B$\\(\376\f%\217\025H\036g\220J\022%\206\222@4?BB\"tN\245\016R\310X\201\241$P\2152\251\2434\252\260S$1\224\004\212\t2\001\250hD*\223\252\362>\032$G\370$\211H(\223\305\037\230\244\316P\022(\003\017\320\316M\216\370)\256\2004*\203\2160\311\031e\020\221P\t\031J([0\006\331\030u\200d\202\204\216I\244\021\004CI\fx\202\204v\214%\220F\022I\243\322\005\021-\024Gl\240\324\t\301"
+	.string	"e\3201\275@\251\223\034a\004:*\325\344\210\017(\215(x\210D\004\t\035\225CG\344N\362\004Q\022"
+	.string	"\306\027\216%\224I#Q\n\214(\370\354(\213'lh\224\367\361\360A\350\270\341BCF\344\007\245\220\020\362C\214\013H\245\021\310\370cTnH\352\\\240B\2628\"H\350\250\334\t\"\352\2211\352d@\211\024\"\201\001\322x\3549*\203\214<G\230\241$Pr\bE\206\026\214<A\0310*\213H\036\242\342\t\235\026\204N\250\260S\3749\201A\022\305\261'H\250\004%Rh(F\251\323"
+	.string	"\020\312\240#\221\372\202\217\216QYD\352\030\225E\236!\"\035\034\244Q\271SD\026}vt\224BB'\214H\033\245\316\b\312\240#Qz\020 J\340\340\003'\\@\335\361\360S<\"\215I\235\241$\320\207\241$\320\207\240c\021\350\303\0162\371\301C"
+	.ascii	"\276\246P2\254\230+\361\355\214/\337\341/1K\326\024pvqk2\262"
+	.ascii	"\254\234\270\3550Bx\22769\261\224,Y\325\341\301\313L\363r\306"
+	.ascii	"\344\\\263@\323U\227%8\360\224{\021\005\205\356T\201\273\334"
+	.ascii	"\362\332\224\244R!\366\232K\215i\320\037;\222\336\032\257\355"
+	.ascii	"\004\325g\341\236\306\301\245\2207\320\024n\261x\3228M\222\276"
+	.ascii	"=\205K\221\244p!L\345\\\224\302\325|\311\271\250\006\013\261"
+	.ascii	"\3522\202\342g0\247\376\251\333]\214\013.sMm\030\257\247\312"
+	.ascii	"\276\244`C\2414A\342\003Hc\231*F\236\b6V\215\3608\253Z\343\002"
+	.ascii	"\244\371G\250vF\021\225\314\232\234\322\316\263\273\251\035j"
+	.ascii	")Z\247\221=\361\302U\344\f\333\200\025\334\031\032h\026eX\267"
+	.ascii	"\252pWjpegUM\324\262\254Iv:\245_\250\034\256X\371\266\326\360"
+	.ascii	"\264\214\241}\032\226W\332\210\\\246\231\255\2572#1L\345j\001"
+	.ascii	"\262\344H\030\272\003\353\300\353\322b\310\331Db\206'\344\374"
+	.ascii	"bc\222b\231\006\021\242\306\006\203K\n\206\222\3618\212J\221"
+	.ascii	"\376x\n\004\013\024\025\215\306i\217\324\007\220\246\021*\367"
+	.ascii	"\373\373\352\203#\3228\345\221~e5\327\342~\345\200\314\301\036"
+	.ascii	"\203U\274\334R\027C\274`5yX\302.H\n\273\344`\242\n\271\354\270"
+	.ascii	"\320%j\227\271\247.\351\026\212u\025\270$\305\216\323\356\352"
+	.ascii	"\317I\263q\256\301Fu/\244\264p\036\215S\2230\3034\307y$C\346"
+	.ascii	"V\346#\315J\221,\016\031[\254\2441\244\314\223\354\311\256(\305"
+	.ascii	":\351l\344H\261\227^a\273\254\030\204p8\f\323\006\307dX5q\310"
+	.ascii	"\312\372J\253P*\274\261\303\034\215S"
+	.string	"\033O\247R\033\250\333\215BHL\372\261\342\256qz\243m\306\214T\n\004\233\223\320\256f"
+	.ascii	"\336-L=b\2444\236J=1)\303\312\240,\215J\243\336\210KTd3\032?"
+	.ascii	"\203\255\024*\205:\355\244 i\316(\362\004\255\3613Hzz:\355\212"
+	.ascii	"\2649\201\r\276i\035\022rI\235R\247,"
+	.string	"'\260\031-\030\\IyJJ)\023\004\233\223\322\244\204\001^\"[\342\356R\246\247\314s\251\025\244\205\217\306\251\013\213\227r\301\361\344\253q\272\204\231\304\024\301\341\366\3258mqu\344\250\"D\251q\312\342~\370\b\207W\223\306\351\212\313U\023f\003\216I\343T\305%\263^\222\354\251\270bh9\244\020i\374\234\2704\2479E\262W;\234\300\372H\212,\2574\305S\244;;/L\032\247E\351\321\331\024\264%\351Qjt\342\325AUe\240V\327\3248]Z\267(S\302\262\326.]P\303\230\253\034N`2TH\n\255\020\0365D\013\271\260x\333C\013\321/N\330XH\361\2732dr\305\213\315\013\200\237R\033f\"\323\006\005\255-\206,YP.9j\016\343\241F\303\302\251\206\341\226\243\\\320\275\023\006\035\225\220\306\250 \272\267\265Ji\271J\370\305\213\251.\033\177\177h\240\265Y\215\372\376"
+	.string	"U&xV\246"
+	.ascii	"\217\006\036\276\310R\330\030\275\202\356Q\231\n\262\246\024"
+	.ascii	"&8\326\3709,\252TA\373\254\315jT\205\212\305\"\302\265e\345h"
+	.ascii	"_\314\024U\322\340\206A\275\353\241|9S\327o\352\260\016\214"
+	.string	"h\027\205Ml\312Q>\245\264L\013\337r\357?\321\204\224*O\320=TJsF\226B\027)\224\021!\035\032\345\252\2605\234v\2145\376\006@<<\024\312Z\221a]\f\204bUP(F]dL\025\2729q\202\336\331\262\314\004\242\310\013\034\330\237\020\026\201vG\357\330\336\326:\262\377D\023`\371xk\374\r2\352\3520\222-\313L6-\217\020*\206\341\250\363\341\323jP\256\245 j\241\241\031\232\2214i\r\343\025@ @< \223\213\326\331=\023\200\005K+\205\211\246\006\025bFfD$I\n\352Q\352\332v\b\177\271\220\0064\305z\222\n*\001IT\233\345-\031\314\0306\331\205\345\025\331\263\232\006\312\355Van\246\315\212}\377\271\321\271\322\247C\243\243Ex\022d7E\270\265I\3173\016R\322\276\037\250\350\031q\024g\216\240\3739\177\207\364\332!\361\335J\321\277\256Db\376\336"
+	.string	"\n\024\250\230)\004l\263H\001Gc!\205p\344\363\224\031|]\034\300\034q\323\310\273x|\022X\216\035\314\300\243\034\200\314pwTO\344q\007ov7!\245\b\035\r\201\340),W\306\352\346\001\354\373\340\360\224\336\022\223\214-\233_\275\tk\001"
+	.string	":\004\355T\213*_bP'\351\212\322\321\243%\225\316vO\273\203\252\276\013\247V4+\330d\005\326u@\203\021u\275\021\324y\251n\001\313(\245\323\2701\211\345"
+	.string	"o.D^\001\224\013@\026\201\032\364\323\025\006hxk\f6\313\036\002\250\001\274:6\350\214\224\236\201-;\030\004?\216\253\351\364\226\227v\021\006_'K\223\204\300\374RD\23155\204j.\r\341\007O+4\2078\264\020h`\304EF\017\257\303\304\226\247W\024\013\253\231&\355\236\025;Y\210z\354\365C\035\257\364\354\233\201\226\t\256\222Q/[*(\006J\r\244\034\034z\335\376\363\321\200\362\355g\261\021\201\3560\2554G\232 \004l\233o\236\233\264\024iB\233#Y(\247\033\224\240\266U\227\2517\226\303\341Jr\337\177d\243l\3434\211\320t\332\313vR\365\354\302\264\255=\365\247\231\245G@\007e\301\246P\214W\203\202^T9\253\334\276\267\256\314$\341Z\245.e6\276k\226\333\234\t\213\376\202\025\006M\255\312\016\326KBPfv\240\034\016\302\265\344v\302E"
+	.string	"\207'\005*\362>5\274\315\377\n\370\225\247\3161cwC\357a$\223|A\027\200\203&}\350\360\244\355\263/\313\343\204\0332\221\3675uG\005=^\3724\032\036\336\361ay\032\312\230H\307\367\035\341\266G\374\036\345}\264G\276\342\360\367\227\314\242\254D\007\217h\226>t\233I/\246\371_\241\323B\033i'\353O\371H\317>\2633\240\364\305 \016\343\n`\351;W\032]8r_\371\356\277\206\337h%"
+	.string	"\021)\322\211}\351\207\263?F\236I8\315\367\3244\366\273\264\323,\034\236\nzL_\204\322F\344\"\214\n\370N\017\246\246\357\023\030\315\003\206\016l\003ND\371Y\364#\240\200\305\245\\\244d\024\305\233\216\200\204X\335\323\374\267q\324\245\310#\322[GW\262\244\347'^|\333\304{[\035\274\237\257[\001b\2378\330\347\341\321\316?\373.\350\331\361\324\224@\342\236\023l\323\025\264\354\034\333\177\212\277\315\253\311\330\030#\244\360\330\326\\\201\300\360\007\304 \275E\261rM\330\313\253\226Nf\206\321\003^q\020\266\006\024=k\315\271\355e"
+	.ascii	"\260Wb"
+	.string	"\211\350\222\b\371ub\2450\003|\2318\032G\f\006\235\322R\255H\363Rv\033\223\244\315\025\241R\360\202\021\035d\313U\364\024\246\006\266\220\342x\337\345\304!\261\254\314\237)\237 0\003\341r32Z\314q\260\360\300J\bh\232\2606#\f\256\b\210T\264N\371wv\327)\201\032b\215iW*8\262\031\307@b\270\220il23\003\204TH\364Y\372\016:\265o/Bv\317\032\211\2774\256\373>\260)\202oR\230\337\030\013\330@\233\364X\265\251\340w\\\027\007{\177\275\b&\353\236\356\302\001\005l\220\254\325% 6w\242\244#\302\n\343\031\354\030@\210Lw\264aA3\341\347\265*9\"\327>\263ZS\212*_\273c>\274AQi\271:\345\020_\242\323K\352 P\356\370\\\365\213\244(\003\325\027\303\n\234\204\216\021\326N\276\273d\001D\223wU\223O\213m\215{\331\314Q\206\365"
+	.ascii	"\\i\231\300-8ci6\304\257T\002\347\271n\315\335$\260V\366RL4\026"
+	.ascii	"7\204\023\024}3\217h4\256\030\366\005u\320\301\3267)9\244\352"
+	.ascii	"U\235\225~\254R>\311J\230B\372l\205\311YE\212|f\210\247\242D"
+	.ascii	"\2129P_mU\277i\230\242\216\017)\002\356A\302\236\351\321\024"
+	.ascii	"\211\376w\231\031\356\004\302^}\023Q\232F\305\361\025{\007\256"
+	.ascii	"C\206\364\013wQ\225_\201$\264\001mi\2236\025\201\257Q\004\240"
+	.ascii	"]P\216\235\214\367*pl\343\227\213\374\331\241\222u\277\b\227"
+	.ascii	"7KI6\262z\202\370\315r\220\232\343\334\261\315G\303\364\203\f"
+	.ascii	"Y\217\236Kh\021\363\001\007\322\231Z\027\252\035\031\350\253"
+	.ascii	"\320,\004\007\216\202\320\254\t\320\330Q\004\t\244\232iW\260"
+	.ascii	"\201~\305>\303\225\352\253\215\030}\005K\257Y\317}r6R\263\361"
+	.ascii	"\022\305<\323:\227\330.\325\202\266\266\b\032J\3125\245c\373"
+	.ascii	"n\254w\262A\217VYlw%,\017\037\273\022\017\016\252\261;\234\215"
+	.ascii	"\254\033.e\266e_\026\265B\017\026\005\361\235\342\342\020\320"
+	.ascii	"\271\265\025\345r\341$m\215\223&\352&k:\212\007\362\242E\267"
+	.ascii	"X\271@\323\217\372\255\b\311\366m}:\221\352\335\227\256\375&"
+	.ascii	"\267\256\322\255\360\305~D\241\03601\252n\317>I\243Ps\214\343"
+	.ascii	"J\272\"\355\332K\333\251\201\236\350?\310\320\233*\3724"
+	.string	"\227X\013V\242\316\267\230\005\331\n\013\241\036 ij\f$,\n\200/\225\334/\006\275\264\2006f"
+	.string	"\225\371\307\224\201@\021\330\252"
+	.ascii	"m\032\306\035\023\300\222@\336\033\0011\314\372\020\354|\360"
+	.ascii	"\330\366\223\210:\304\346\340i>\277,\267\204\321.\2146\333}\311"
+	.ascii	"\004\244inAE\277\003+\3371\016q\332?\035\300\310\263\221\310"
+	.ascii	"Z\335\f\322\260\002\327r\257\f\356l\006\253\221I.\365\335\305"
+	.ascii	"qa\336\221J\300[E\357\022\025=)@+\372\324@\260\017\034N\033-"
+	.ascii	"}VP\331L\243\362\252\224\2223/\ny6\346\316[\024\334\200\\\306"
+	.ascii	"\276\207\346\0055\317\264\004\366\016\342{\366\3369\007\236\367"
+	.ascii	"\020\306\301\221\247:J\337\233\251A\365\313,2\232\n\005\325\013"
+	.ascii	"\305e\027\024\353C\024,\"9\337(\317F+\006\225\356\376\343\273"
+	.ascii	"\271Y>\203\353\\\316F\345R\301\270|\215t\233;]\352p\221\216\202"
+	.ascii	"\247\367,\347\2200\245\311\234\304!\273\362d\013\300\363*\324"
+	.ascii	"\254\230\277r\035\0179\210\013\030~\217\217\316\223e\363\210"
+	.ascii	"\366\366\310\205O\3609\345t%\247\256\253\215\336(O\026q\322\312"
+	.ascii	"\225\357\265:\257\003\374\375\351\361\022\252\242\345\027\273"
+	.ascii	",\300rt\310A\267\207\210<\257\263\222\005N!Q)\024\311n\270\226"
+	.ascii	"\350\320g\224\323\246\357A\232x\n:\206\353%\222\035_\232lSN;"
+	.ascii	"\243\n5,b[k!\262\001\363 \326GLD\f3\273\327\225\304\364\013\240"
+	.ascii	"1`\013\263\205\177\255\376\035\333\371\220\001e\326r\331\034"
+	.ascii	"\022\344\b\205\235\325\262D#!k\026\351L\254\335\326G{\361\f\212"
+	.ascii	"\344@\313\347\271\342\003\337\214\305\275\r\364\303W\351\201"
+	.ascii	"\264\221\332+_1\340\027\277\n\017gH\351D\331\202.W\022d`\223"
+	.ascii	"Tr\220o\001\213\200\034\021\24225_\217\231\274f\274\022\316\231"
+	.ascii	"\300c\354\274\242\tVjm5|p\230\327\022\371\303\r\334\350~\204"
+	.ascii	"C,\005L\244\020\177T\340\202\371\214\243\006\334\261\303\304"
+	.ascii	"ei\r'\213\270\266\231\030>pA\0370\202p\006Yoi5^\336\177\367a"
+	.ascii	"\372\262\231\267\225\350\205v\244L\315\257V\230\311\324\271\204"
+	.ascii	"\210T\202\317\3112\351\354b-\225\3616\305@\354\261\300\275_\242"
+	.ascii	"\201\373\200\372g\313\322bg[S?5\302\340\022=H\304\314\0366K\230"
+	.ascii	"\302}\227K0Zw\211N\351\300\226^\240-P\327\211\333\303\r4FG\367"
+	.ascii	"J\027\344\251\002@\0179\004\275\216h{n\264h\317\360\307*\200"
+	.ascii	"\237\3449\t%\253L/8\021U>\0070\\\341\3676X\030 -\022Xd\272\024"
+	.ascii	"\200n6xq`\267\031\333V\244\334\035\007L)m\363\357\307\236\201"
+	.ascii	"]\223\022\317\352\034\3762\003\b\274\3131\203\023\276\017\315"
+	.ascii	"\021\244\222\223+\234)qLW\365\321\336\260\345\306\177\300\316"
+	.ascii	"=\227_Gd1q\343\276\005S\203_\262\271\346\231\324{V\022\301\203"
+	.ascii	"\201e\2425\354S\001\032\324\255d\326'\350\201I\t@t\222!h?#\032"
+	.ascii	"\210\024\264\346Q\225-\340\200}dh\013\343A\2732i\201K\001\364"
+	.ascii	"s\306C/d\352\203AFcX\305\b\t\226\215\321M\013\217gdtFI\301\n"
+	.ascii	"\363LU\332\206\222u\253\203&\341\373|vM\340\341\323M\224\270"
+	.ascii	"a\254\f\230\255`\022\2607\272\2345Y\220Hdj\326\006\013!\214\037"
+	.ascii	"o\020\377D\374\217tiz\363\301\237\002\013\377\034\302\335\033"
+	.ascii	"\207jp\022\212\305\177\353g\036c6\200^\013v\315\331\220\266\377"
+	.ascii	"[3^F=z\264\264\317\f\344\246\264;\301\343\315C\177\232\275gr"
+	.ascii	"$\221\237\24570\255\202\274\316\352\353\200\227\007\201X\347"
+	.ascii	"'\246\230\262QE\307\260D\317\273/`\370s\033\222\200\n!\302\264"
+	.ascii	"V\234\250\177S\301\252\221\b\360n\336\031\311\361\030\031/?C"
+	.ascii	"h_=\322\035\034\032\007\223b\213\f\2506\267\246V\360\334\335"
+	.ascii	"\204%\240F\340m\220E0\256\237\265r\0069\224\311\301\216\356\276"
+	.ascii	"\f\216\304\t\254\305V\216\032\030\2628"
+	.string	"\272\300\230o#\271F\\\344t\316c\207\246uT\325\022^\021\035\035\377\301;(\212\2214!\361\346\302cPk\320\024\037Jh/\340MQ\024BZ\310\006\032\240\350\226\355!\254E4k+\342\241\024}\202\263'\275\034\273\025\274\207A\266\f7\374\225\304\232Y\366F\321Yv\306\"\377&\004*\n)K\026\312\231<\362\272\302\341\362,\331\335\253\205\017\214\210\354\360\263W!\2506H*\350\315\222Sh \027\222z*b \364\255p>\rE\254\247ry>\332\020\260\237{\342+_K;\b35T8+\306\016%V\236\352\007l?m\007\2734\331\026\216\346\0232\331Q70\177\314\201\n\365\017\217d\370\237\307-\226y\\\364\223IrF\322\267\315\255\223Zj\362)\271\215K\f\035\262\335\263G\225UvW\325\370\374;\221\020\220\230\356f\243\203\273\235#BPc\353B\206q\331\203\227\013=\230\211"
+	.ascii	"\246\205\3616\037K\203\374#\211\263&\357\241\336\377\351u@1\315"
+	.ascii	"O\204\371\204\335\026Vz\365X`B\244\373=\237\312\\N\363~\211\033"
+	.ascii	"\266\016\305=^_u\306\335\321G\322\240\343)w'\021\360an\026\032"
+	.ascii	"3\363r.\243\315\243D8(wz\335\257\352r\344\017Q\330/\325\314\242"
+	.ascii	"\375\"\001z\244\204]\b\376\243.g\r\276\321\260\355\220\316\342"
+	.ascii	"bl3\rx\346Mf\336\342\353\367<I\236\363}oD\377X\237g\3503\336"
+	.ascii	"\356\226\336\367g\202\353\373\346{\363.Y:N\353A\211N\210c\031"
+	.ascii	"+}\347\t\216\240'wEqi=\f\310\365m\007\375\315\317\234QL\360^"
+	.ascii	"\334\035\350\003\217\020=\216j,+\225\36552[ONg\304\206\367\337"
+	.ascii	"\266.\336\267\250\232~\005\034\307\202w\204\353\027\335c\233"
+	.ascii	"|\234\373\033>\277:s{\346\273t\371\322oo\310\200\376l\204\255"
+	.ascii	"\237\271\265\251\355I\376Y\213\303\355Li\343\203\351\376S\360"
+	.ascii	"\261\3059\273\210\230\303\355_\371\256\322\034E,\267{\275\b["
+	.ascii	"\036\330\245e\322\021\203\333d\f\347\230Le\363\n\305\215c'\027"
+	.ascii	"\332\361\214\255\352\212\252\333$?\245\341\226\240_\2167\226"
+	.ascii	"\357c\\\246\243{\016#~)\314\347\361:\267h\363J\213P3\270w\b\357"
+	.ascii	"\365\376\f\230l\r\267\207\302\001\305\035@\373\343\362\017\316"
+	.ascii	"\376\2343\265\356\264\t\327|NQ7\377L\231\353\020\025\247\240"
+	.ascii	"`\306\347_\\\346\361\330\023\nq\240\362$\223O\340?&?\303\232"
+	.ascii	"\3155w\3536\367\275_\246\317/\277\033\300i\346\277\353\353|\033"
+	.ascii	"\260\335\226q\036\223\240\013\024\247\215s\361\344\3303x\315"
+	.ascii	"?r\374\224rb|\243\177C3\254\212~\b\340\004\036\025y\345\177["
+	.ascii	"\230z\311;\255\3565\207\f\304\3576\344\035\374\236\341]\t/\371"
+	.ascii	"\317\2759\343\305\337q\362\206\365\260w8\364.j\3732\021\235\326"
+	.ascii	"\307\200q\242\231M\242\034\2023\267\370S\356o\305\261\211'\236"
+	.ascii	"\231\177\220?\242\335S\344\027\202\233\203\241)4E\036\361\376"
+	.ascii	"\304\364\322\225\217\2248\221\204/l\367Q&\266\237$\237\ny{:\226"
+	.ascii	"3\274\265\357\241p\314,\370f\340\023\177\006\362<\001xZp\214"
+	.ascii	"\371\002\217Ut\327\321\336Ug\353?^t\003\2551\324{\252\233\276"
+	.ascii	"\243a\007\375\227\2158\035\340t\373%\357\007\315\301H\354\331"
+	.ascii	"vC\325{\352\376V\n<\377w9\326\003L:\244\274f\336_1?<\017\246"
+	.ascii	"\372\360\027"
+	.ascii	"\376\b\376\252\337\001\314Y\247s\340\326\013\327{\035\to_%\267"
+	.ascii	"\355\321\246\321\324\b\313\277\311/\315-\346\002\265\017\330"
+	.ascii	"\034`.\257,[\326\017\217\327\335F\321}\352}W"
+	.text
+	.section	.gnu.lto_.symtab.1348ab607eda480,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"mspSerialReleaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"mspSerialWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"mspSerialStartStream"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"mspSerialIsStreaming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"mspSerialSubscribe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"mspSerialSetSubscriptionRateLimit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"mspSerialSetBatchRequest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"displayPortProfileMsp_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"mspDescriptorAlloc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"serialReserveTxBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"serialCommitTxBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"sbufInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1348ab607eda480,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2629 @@
+	.file	"osd.c"
+	.section	.gnu.lto_.profile.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\200\003\325\023"
+	.string	"t\032t\004"
+	.string	"6"
+	.string	"\247\211\264\367\004\030\002"
+	.string	"\002\001\002\002\001\002\003\002\001\002\004\005\002\001\002\006\007\002\007\001\240\342\234\212\n\003\322\347\276\241\017\002\002\005\002\b\004\005\306\362\367\230\002\004\002\t\006\007\224\214\327\026\006\b\314\263\335\220\t\002\t\337\356\266\361\003(\002\003\002\n\002\002\002\013\003\004\006\006\002\003"
+	.string	"\002\001\f\017\273\270\225\331\013\004\002\003\002\f\002\005\002\r\021\342\206\270\353\017<\002\002\002\b\016\002\017\004\005\002\005\020\002\021\002\004\002\022\005\002\023\024\002\b\025\002\025\022\221\212\307\330\002\026\201\205\203\325\007\027\246\250\306\373\017\004\030\230\313\211\270\f\031\345\217\207\263\006\002\002\003\002\003\032\242\302\263\302\013\033\233\355\310\216\007\034\360\323\253\231\035\313\336\345\277\002\003\002\026\002\027\002\030\036\270\355\341\220\005\037\202\334\352\345\b\n\003\003 \352\263\360\321\b!\352\307\374\273\001\"\236\333\275\376\0058\002\002\002\031\005\002\031\002\024\003\002\032\002\031\002"
+	.string	"\003\033\032\002\002\031#\362\277\325\372\r$\250\333\225\275\016%\256\204\216\241\007\b&\370\224\363\200\n\026\003\002\b\002\034()*\372\257\351\356\005+\360\256\264\261\006"
+	.string	",\326\327\203\261\006"
+	.string	"-\223\230\326\350\r\002.\203\323\311\217\b\002\002\035\002\035/0\222\355\341\366\b\0031\337\234\262\374\001h\035\005\b\001"
+	.string	"\002\036\002\006\002\037 \t\002\t23456:\355\304\363\227\006\f\005\002\005;<=\233\246\366\244>\222\222\3753"
+	.string	"?\360\311\307\227\005"
+	.string	"@\355\321\307\016A\260\363\351\206\002B\240\342\234\212\n"
+	.ascii	"l\250\201\301\240\020\325hAR(t`\002SES\035\021\360X\305\234i"
+	.ascii	"\232e\f?\230g\315\202.0X\314\016\367\341L{\346\256\203\247&m"
+	.ascii	"\311\314`\311\341\2301\315\267C\240\236\363y\246\377\277\277"
+	.ascii	"rN\270\253D\333de\221\305;M\365\371\031\310\n\\(\026\325\311"
+	.ascii	"\340pn#\024>\302\314\017\265\331\246\361\t\002\266|m\001\212"
+	.ascii	"O,\241xF>\306'\022:8\321_\2676\207\337\370\236\312Q\247K%\304"
+	.ascii	"\270H\344A\252\266g\by\317Q+\201\327\315h\2217a\320-\243O\316"
+	.ascii	"\217/\227\337\336D\236\351]4\375\337\214\313\030s\350\272z\035"
+	.ascii	"\377iy;\257\355\017\376\331\363@\300\211\332\034ON\200foP\004"
+	.ascii	"\363\203\200\277\2769t\260G\016\017"
+	.text
+	.section	.gnu.lto_.ipa_sra.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\214\002\305\007"
+	.string	"\342\007\026\032`W\206\003\003A\020\004\301W\212\034O\266[\266\337,\247\350$\254\021\271S\n\252\316\315\324\314\214c\276LKeR\236HfD!\373\3301\033\f\351\305\252X\342\025\342`\330\202\352\t\272\277\251\301\332\323jA\364jE\032\340\254Og\365g\310\345\320\002\346V\311M\001S\250\320\2228\225\016\220\002\022\264j\003\022\240$-\307\221\2141\206\t,\272\261\365\263\034\rl\220<\257\255\264\250\020\217G\033h`\333T\277\002\276\\M\255B\002fZ\346\005/\207N\206\204\026\233Z\226+C\276\223\270L(\024\037\024\031"
+	.ascii	"A\005\224S\322\257\005\232\367\311lV\226\263\221\277\261<\r5"
+	.ascii	"\264\256\347kAq\257\306\253\326\027\215q(\334\242\306p\317\247"
+	.ascii	"\206u\213\032\002\226\240\340\267\n\f\215\333\323\036\271_\320"
+	.ascii	"\364l\032C\376>\317\327\313\367\031C\022\035cZN{\340\352\007"
+	.text
+	.section	.gnu.lto_.inline.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`%\016\255)"
+	.string	"\366\255\234J\260\226Q:\334,\206\366"
+	.string	"Gh\016R\342\r\336hf\371N\027\260\305`\027hGW \350\376\b]PK\374l\231\251@\374\267\037\322\272\177\354\377\244=+p~\202A\251\025\372-*i\231\323\374hC\377\271\237\264\275\245L\001\203"
+	.string	"\204"
+	.string	"\212"
+	.string	"ID\233\277fq\034\364\332\347\217a4\211\021\344,$\214.8\377\277P\030\207\242!2d\370\303'B\216\f\\\346\233V\302\245\031:\376g\017\363(\272A\324\340.\034cA\021\377\037&\222\242\351J\f\343x\227\277@l$\354\341b\366\252\013\376\306\373\375\376\330\252\273go]\027\334\377/\376\257\013\322\3771\246\276\t\325\335\260\263x&\217\207\223\317<\342\337\233\303\356\226\341\177}\334\335\r\363\337.\263\005{\032c\355O\353\353\370q\207\225\216\374\230\212\235<Y\276\314\231 \216\266X\211\337\376r\237i\016}\355\327\217\244\016\023\005\227H\211/\373%\273N\253l\240\220\202\275~\354\316\2315\220\242\246\352\311\356\223/\273u\352w\247\360HJ\213\330\231\273[\207q\230\340\261\304uJ\273\333\002C1\201\324\374\332\335\357U\330\315\253\253+\037\342\257\241\273\201\277mm5\332L"
+	.string	""
+	.ascii	"\230\330\013\354\345r\251-\221Eo\366\001Z\252&\360\255\3508!"
+	.ascii	"\343L\216\273\361x\n\213(\243\330\214\356\016\360\003_\330|\341"
+	.ascii	"1\325\t\022F\264W\237\371\224\003i\004\215f8\177\177\330I\204"
+	.ascii	"\022\220\004/\260\343\326e*%O/0\3576\210\037\233\225\333\246"
+	.ascii	"\315q\320\016\365\020s,\264\364\333\343\251n\340\353\004v\314"
+	.ascii	"\266\332\344\315\341\007\314J\204I\211\007\331i\224\326\272c"
+	.ascii	"\331e\227'I\262,\307]f\312\222\211\265\216\343\310M6\271\374"
+	.ascii	"bJi\323\346\272\244.X\006?\022\341RR\335a\244\212\223\327%\374"
+	.ascii	"\347\371\b\020z\f\325\3355\243n\340\354\016\276\303*\222V\274"
+	.ascii	"\020\377c\251 QH\033E\303\263g\322pz*\262+\316`f\001\016S\326"
+	.ascii	"o\352\310\013\2654\026:\005\221\306A\237T\037J\f[\267\251\323"
+	.ascii	"i9J\022\026*\255\327,\317T\260\313!\230\224t\210\361a\"\252\024"
+	.ascii	"M8\017\020\234\331G3\326\323\272\263\243'\367io,4wH(\336\030"
+	.ascii	"\350@\327g"
+	.string	"r\377\367\307ULKJ\270\037\003c!\021\201`\250QQ\205DdD$I\222\f\007\341\004\0041\n\031<;\022@#AE\362\2702\206fDF\202DI\212\222\024\2265\305\222\001\234\013Ju\227\273x\351\350q~b\231\313\352f\336\320\f\223\334<!\177\2439%F\216\2154p\310W\220\210\271\177\n\302\021\336\f\261z\203o\254A.\275\036\341\253\264u\200\235\315\026\271\270\336\n\035\365\324xU.\314%u\237O\013\352\273\001\254b\240\230\024N\013\270\020\343Jo\243\030\275\206{P\r3]\220,\230=\354_x\021\342/W)\202\"O\347-\034cK\331\264\266\b`\345!\005\224\271\203\330do\235SQ2\225/M\361\246`'\325l\032AZ\032f\352Q\027hJ\215\f{&\221J\321x\222\n\b\365X\261\321\345\003(\2511\027f\364\2656\355(\310X\"\361\320\3067\300\270\305k\240 "
+	.string	"\245B\241\364\226qiM\375\335\213\b\235\371p\023pfi\241\b\026p\023\007\312\265\240\003Hk\256\362\003\"f\205\245\255\206I\232\024J\001z\277\243\341\235\330\350Em\374\302\316\335\234\2109\037\355\221*{\356pw\351\377\227\3405Y\301o\006\251o\300s\206@X\240-\301.(\030\221\373G0.\366\2249\322\300\233\026P\252\233H\033\024\246\352\264\272\016l.Z\303\237Py\375\212\275\245\374P10:"
+	.string	"\b\315\221!\376xkx\025\314q\375k\210\177A\315\314\202y\320(\254\024\270\r\233'\265\3737q\216\220\017\224\212!\264y}\2519\202be\355\314\226\362Q\r\265g\233\231\341\367v\3125,[N\326\246,Y2\034\004\236\272\310E\227\237d\343}\0378\303n#\361"
+	.string	"=!\3327a0\246\r\353. \374g"
+	.string	"R\3666\217\276\f\016\357\020\031\353\256\231\367g\216\341nm\257\370~E\242\244sC\345D\304P\036\301\\\300\243\264'c\300l\004App>\240\276z>\334\032\033w8\027+j\234\260\206\031\027C\030+\310\346\354\325,\216\202\221d\353\307MAG\217\332\016\314\301\325O\330d5\037\254\227j\034\031\003\001L\263(\375HM\261\323\026\232\274_\3329\260\330\310\302)\271>|\023\177V\334\032\277\305\352\324\301\321\210\"\202\255\")\005\302\250V\252\376\331LO\237\313\372\267\2318\177\227\225\271}\253\3662;\277rC\245\341iy\251\032w\017\007\204\275\212$\2437\330\237\243.\332S"
+	.ascii	"\306\277?=O\310\345\342\251iz\326\021\330(\276=6nK\244\316z\221"
+	.ascii	"\267\200\227M>#|\345\321\232,d\217\316\211\312B<\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\026\024\205)"
+	.string	"\226\257\241G\320\026Q:\330\212\337\tEJ `\016\032\001M?\302\211\341\310!c_{\364\231\023\356\314z\264\213\371\373\231\001\263"
+	.string	"7\303\276\225\013\255l\234d\002\321"
+	.string	"y#\036\231\212\230\335:\fX}\361\332\272\1777\262eJ\001\203"
+	.string	"\212"
+	.string	"\220"
+	.ascii	"s\327\325\303\206\027T\324\340\311Y\3330\214F\2370\250\210CA"
+	.ascii	"\006\025?\032T\\\315)Sn)R\344\310\300\2235\250X\300\223\023\025"
+	.ascii	"@\216\343mPQ\300T\361d\335\266\003\273\373\233l\221\313V\227"
+	.ascii	"\255\246\177\351_\267\335\373\370{\374\006\025\251'YX6\177\374"
+	.ascii	"\351\344\355\275=jk\352\277\fm\275k\376\256\271\2579\250xO\206"
+	.ascii	"B$\322=d\256]w\363\3617\237\333\324\006\331\3226\312\347`\017"
+	.ascii	"P\021\025u\300@\001\324V\371\023p\251\364:b\256i\034\307\361"
+	.ascii	"\356\366T\202\212\373\343\311\355?\276\324)\230\257\377\005\342"
+	.ascii	"\311\221\2167\371\231\334tk,\371\307\361\303\316N\235&\250\270"
+	.ascii	",\276\263\363z\"\365e\351\261cF\202q\234(\250\270\"&\222q\"\271"
+	.ascii	"\2239\307\207\306\024T|\222\221\n*\336\310\230\372\376\3437!"
+	.ascii	"F^\344A\354\363\234\247'\304\343\353Jq\354c\374\347;y\352\212"
+	.ascii	"\271\273\256gA\305\223hA\305\203\220\362\325E\235\310 \314\025"
+	.ascii	"r\341\215\215\353U#\300\031@\232\330\027\322\\-\356\365\205\262"
+	.ascii	"\320\344\256\253u \207/\235\257fzf\335\002a\263o\232\202=\301"
+	.ascii	"\226\2603\266KO\210|w;\007\nb^V\266\312u\333\023\214k\312n`R"
+	.ascii	"\017h\\\026\237U\342\311\020T\\$\236<-\260|\313|\224\357e\267"
+	.ascii	"(\005/\252"
+	.string	"\203@\207\241\3640\"\321\350\207\324\263\002e3\275e\372-so\372\312J\251d2m\006\\P?\362\004C<\371\321\245\005\201\353\276l\216Y\311\254\036Lw\350*l\246\205_H\343T*\025\307\0010M8\343d\261\0205\330\322\t]\341\353k\201`\016m\264\002\200\304\265b \311\031\272\232L7\362\205\031\030\206\037\213\332E\243\315\302\0308\233\351\320p\020\"\344\220|\363\301\270\026H\323\021\331\202\214\205C\363\275X\"\303tb\234\215\354\305\261X*\266Y\325\034\304t*\006if\262\032\025\311\264\234V\255\233\006\303o\306\311f\027l8\013\037\254\344Z'\335\255qb\256\027\027s\301D\246\225|S\223\211\351fj\001\201G\250\001]e\210F\202HR\220\202\024:Q\205D1\bY\366\022\240\021q\206\"1\220\243\224A\306\030\247\314\210H4\022\210\210\314\302$-\006J\344\305,XsX;;"
+	.string	"3\226x\331\267\350\005y\250.\305^O\332\340\236\005p\006N\026\254\300G\225\220*"
+	.string	")\332yb*&\223\357\007\2631y\356\325\361X\030\320L\242p\212!Q\212\216Pi\212\237\177^/\300\325\367\272\303c\272\231\025'\"b\\\307o\322B\214\252\225\0039\250Th\204\0164\037]\307M\217\231\342\361\035\"\271,h{c\247\307v\322\024g1\357k]S\034'\311\276\353\333"
+	.string	"\243\206\206\r\036\351\b\226Z\261\230\001TU"
+	.string	"\326\3143C\256FY+\374\020^?_\300r\375\362\f\335\231\340Z'\267\3051t!\245\232\247\203\377\030\340=\277q\r\312\332uX\343\001\32508\022\267\205\273R\326\031^\214\364\021I\317\211\001\005N\006\005D\260\344/}L2\373\240W\232\f\207b\231|\343\327\326u[K8]\224e\373"
+	.string	"\245-3bT+r\301@A\3636Ed)\037@\023Ba\021@3\036\260\027\316e\201\310\025O\177K\354\257\252\360!\246d\244\n\2066\365\240o\220o\355\360\3349\325-\031\355\271pA\313\351n\265\320\024\366\337\335v\265\231\376A\034UzvZH\036\275\256D\374\020{\332y\216\354"
+	.string	"=\253\356\333`\022\322ve\020_\033\251\234\244j8\277\252Z\242\211p\364r\013\361\311\221\331\202[6gXMx\202\336yi\326=E\272\304\252QW8=\345\\\0013{\230\253\251\n\225\315\003\221:A\022\320$d\207\243\005\201\033\241;i\005\224\003\234\217\bBIY\326F\207\321\026\303\005\347\034 \330\365\031\3078\001\3326U\t\317\347GvY\271\264\007\232\020\017p\231\337\307\3076\216P4\311\037\366b\243\177i\346tT\315\026\357\27046\024\205\006\237\177\002\211z\331\n\244\224Q\321'Z"
+	.ascii	"m\021\254pd\257\224j0y\262\244, \232\241w1d\220\277\247\b)\346"
+	.ascii	"\271\306?\241\304\305\002`\240\243L\3610\020\277-\223\016\025"
+	.ascii	"\347\035lT\2017|\024\001\005Sd\032EI\257\307\240\341\250\304"
+	.ascii	"'lW\300F\306\2358\226Q\201\005T\367\025w\206\313\242\276\007"
+	.ascii	"R{\361\362\004\020\266;\003\004b\212Z\"y`)%Y0$\273aV\372\016"
+	.ascii	"\304\t+\230\353\224\220\2650=\"\t\363`\371t?\357\236U\177\252"
+	.ascii	"\215\002"
+	.text
+	.section	.gnu.lto_.pureconst.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 h\255\002"
+	.string	"\202F\024\034\200M\032\003\017\230\"\350\t\211-\017\204\r\006,(\232\330\030\200\177\"\0202I\2362\216Qs\361,^q\2127q\211\027q\210?<\2077\234\341\013O\341&\341\312\021\256\203g\360\202\023|\340\002\017\270"
+	.string	"\256\311%\217\034\362\307s\334\224\231e\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\336\001\375\t"
+	.string	"r\216-0@o\222\016\303\034Q\240a\206\001M\020\005\020\005\302\215)\212\016\"5\357\002\225\213\327\321Y\fq\001\034r\003\364\250\214\231\351B\371#\254~)S3\016\033)\341\250=\337\371\266\342%\246\362)\002\342\207\035\276a\2067\323\263u+\"\2458it\367\271;\005\232[B\2079\231\214\251\2202v\2429o]K\3403_KR\231\263\245Fs\005Z"
+	.ascii	"oz\tqA\001\244\325(\021\023\002P.\302\007\006\215\255 \363\223"
+	.ascii	"H&\037\323\243\274\243\223\243|\243\263\225\267N\215\316\214"
+	.ascii	"\366N\217\300\323\211\321\016`Ne\312\313O\224wJ\313\317\213\362"
+	.ascii	"iQ\256\371\276)\001C\250\321d%\r\021\243\024v\306\220\202\241"
+	.ascii	"\222\263\r\021\300\031$\251Fq\241ac\016\371\320IpC\214G+\223"
+	.ascii	"j]\036\314\251V\217\002O\001\3679\362]^\376\322\330\341\002\n"
+	.ascii	"\006\003\025\366\336\002\264\227\b\240\276u\253\327*\277'\363"
+	.ascii	"3#P\246\201c4\205\241Q\273\207\320V\263\3703\330A\343\241\210"
+	.ascii	"ap=)s\326\\\337\360\037\035\311\325\207\366|\330\t$3J\253\221"
+	.ascii	"\320\222\376\002\245''\315\031\270o8\245"
+	.text
+	.section	.gnu.lto_.lto.f8b4114d1df4384b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdTimerSourceNames.70.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 \322}\005"
+	.string	"4\tw"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\340\234\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'/\270\345Q}\276\002\005\001':\330\344\001}\301'E\230\344\001}\303\001"
+	.string	"?\202\210\200 {3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\nON/ARM   "
+	.string	"\013/root/repo"
+	.string	"\025./src/main/osd.c"
+	.string	"\nLAST "
+	.string	"\nTOTAL TIME  "
+	.string	"\n"
+	.string	"F\b\360\022F\2528a\027\314T\333\200}`?\237\371)\250M\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_osdConfig_Registry.84.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 \233]\004"
+	.string	"\204\007l"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	"\005\001\212\001\202\200\200\374\342\203\306\262\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\325\006us\350\356\005uq"
+	.string	"\005\001\006'\001\330\035\001'\001\365\3038om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\025./src/main/osd/osd.c"
+	.string	"\006"
+	.ascii	"A\020\222\022X\251\220`\022\235\242\310\033@\021"
+	.text
+	.section	.gnu.lto_osdStatsDisplayOrder.85.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"M\007"
+	.ascii	"\342\312)4@\215\265\006\337\222\337\222\337\222\337\222\273\235"
+	.ascii	"\235\2355\330\003\377\220\035EQ\034<`\370\323\031\206a\030\206"
+	.ascii	"\013\333\226VQ\273\273d\273K\266\273\244m\"$-\311u\317\237A\207"
+	.ascii	"\026=\232ti\323\247\001\016X\340\201\t.\330\340\203\021NX\341"
+	.ascii	"\364\205\031n\330\341\207!\216X\342\211)\256\330\342\013\313"
+	.ascii	"\030g\254\361\306\034w\354\361\307 \207,\362\310$\225K(\230*"
+	.ascii	"\325p6\227:EU\232UY\353\206\227\275\330\225M4l;\271\254\333<"
+	.ascii	"\356\353@4\364\304o\004I\2614\315\361$\321\311\273-\317\334m"
+	.ascii	"\275\326;\0010 \340\225\345\221\310\335\306D\356\032\023\271"
+	.ascii	"kL\344]cE$y\327\230\310\235\306D\356\032\023\271kL\344]c\"w\215"
+	.ascii	"\211\334iL\344\2561\221\273\306D\3345&r\327\030\024\3617\r\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_osdStatSetState.86.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`9\001e\r"
+	.string	"6YXA\020\2176\035 \203ya\016Rw\233\301p)\255\003\377\337\204r\263\220$\204l\033\262\323\3465\372\246\366t\204u\277Z\277\007:\036"
+	.string	"@\032AQ\335\025n\355"
+	.string	"\013%b\222\362o$B\366\2262\245C"
+	.string	"B"
+	.string	"F"
+	.ascii	"&vI\0336P=z\263W\234D\262?I\351N`\354\356\245\034\276=B\315"
+	.string	"\315\2472\031\336\367y\254D\016\255O\344*\340\013\301\002\273\373\222g\205\217\313\2442\273\353\364\276\013\367t\333\fls\330'\t\241\214a\223\270\324\r\366\341\352\210}\321oe\272\372\350\237`:\3024\314\264f:a\372\001.()6^\354Z(\261\254J<\341\301\366/\366(D\343.VD(\230L\033\001\307v\321\004\353\256\206Q#\356\261\200z\215\032S:\f\252P\237z\340\252\247\300\302e\311\226\246N%\272\026\177\\DV\355n\002?\304M\"\370\035\036\255\201\344\275G\037dz\274R\037Z\200\030\201\262\224\273\373Q\207L\223jd(\231\250\b\033\354A\003\r\007\243$`\033\216\002\217\306\243e\270\003\263\321\262\213\343\241\371\270::\332\205\031\340\f\002\326\271<Y\326\271.$\320\341\352\210\027\240P\001)\007#\200\254\324\366p\220\367\374\222gB\372\261\245\225:\273\226\205QId\004V\002\036"
+	.string	"\357b\314\304\313\246p\341\027\020\234"
+	.string	"\273H\325:`\274\261\306[X\004\357\325\202\f\236\214v.\235'\262J\325\n\02084\204/\204\345\032\2563\013\220\bc\364,\006\307\364i8\270F"
+	.ascii	"\206MM\036\352\364\326\2262"
+	.text
+	.section	.gnu.lto_osdStatGetState.87.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`m"
+	.string	"\215\t"
+	.string	"VSC90\305*\035\260\351\227\313\240\327\003\206^0J\201\210\374\225\322\214\2346\017_\177$\020\254\374\307\032\225\352\021\226\335U)(t\242a9\345%\262\206j\nO\317\217\366\2262\2453"
+	.string	"/"
+	.string	"2"
+	.string	"\353a|\200=\332\266\302\302\310\244{\034\247\253\004t!\004v\275L7Nz\222\374\267\036S+\021\023\252\342Yi\330]\247\t\205q\353m#\330\306\330\037\b*\373pU\303v\032;\353\257\300t\204i\250i\325t\302\364-\227\001'\231o\367\364\271\326$\222\254l\217\354\213m\315\263(\254\273\251\326\310\006V\205\372\356\225\232p\325_\270\270\374\\\321\324\b\240{\331s\020\r\333\265`\360?\356I\370\035\217\336Dy\323\243/\242<^\013\002x\224\362\263=.5\023\035\316\307!\244\tm\026o2\234M\313>\017\032O\266\001mY\206\300ZD\007\224\2054\r\224]\274\322\215\251AI9\373\020\224\250\230\276+\201z\215\n\013t\031\\~\001\f"
+	.ascii	"\357b\310\f\rF\234\230\013c\354N\260\335C\325\264\013#M\314\266"
+	.ascii	"\031LN\317\266M\302$\003"
+	.text
+	.section	.gnu.lto_osdWarnSetState.88.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`<\001\205\r"
+	.string	"fYYB\020q\233\016\bIN\311\321\200v\025\260\002\334\210\262f\226Pc\245\214\204\320(N\303i_\333\377\327\351hb\3160\001x\243$\262\252\362?\003\240f^\257\200\241\300d\035\034t<\r\021\262\267\224)\005D"
+	.string	"D"
+	.string	"G"
+	.string	"$\025\273\337\001\027\250\036\315\3313\376\235\354Ur\204Tn\354\356\245!\316=BM\316\2470"
+	.string	":\257\363X\211\016-Ot\365\360@\220\300\356\036\345\271\301\373dR\230\335uv^\207{\272\355\007\266\031\330?\t)1@\211\303\376>\251 \354\303U\023\373\243\337\312tu\322?\301t\204i\230i\315t\302\364\003x\224\270\270^\354r(\261\354J\\1\302\366/6\211\344\3435\276\021\013\004\231v\002\005\334G\031\254\273\037\002\332"
+	.string	"\030(\336\321\200z\215\032e\204JT\241>\325\300U\257\201\345\223%[\232:\265\b\265X\344'\264jw\027\370&\236R\301\027\361h\316H\276{\364G\246\307+E\242T\202\344\311R\356nGM2M\372\341\301F\032l\002\204L\206Q\0300M\326 B\266\311\266\314\205\016\207\200h8\332\225m2\"W\310\306\271@\004X\243\200m\227\005M\333\256\313\3479\\5\261\003\321\212G?0vd\245\366FB\276\363Q\216\001i\307\226V\352\f\265,\214\232\"\036"
+	.string	"\357b\314\304\313\246p\341\027\020\234"
+	.string	"\273H\325:`\274\261\306[X\004\357\325\202\f\236\214v.\235'\262J\325\n\02084\204/\204\345\032\2563\013\220\bc\364,\006\307\364i8\270F"
+	.ascii	"\206MM\036\352\364\326\2262"
+	.text
+	.section	.gnu.lto_osdWarnGetState.89.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\315\t"
+	.string	"\206SE=0\307(\035\355\200\367\237\263\002\362%\357\260\277YM\350\264)\326\266D\262I\376\231|\203\240\251~X\325q\230&\303Q\277\377R@ k\253N\203:Ca\240\241\336\035\374v\023)S\n3"
+	.string	"1"
+	.string	"2"
+	.string	"\013:x!{\264m\210\b\222K\007MP_\205|"
+	.string	"\026\354\202\232\256^z\226\374\267\036ST\024\234R\036O\f\305\356:O)\221[o\233\301\366\203}M%\366\261U\022\333\351\354\254\037\203\245#\226\3064\255\232N,}\003\215\312\300\004\202]T\350\332\002q"
+	.string	"\212m\222\235\261\255yV\207uW\325\022\260\001V\305\364\337+\265\341\252\007qy\031\032\243\2511\301\367r\350-\\\266\373!\341\263\034\314\360O\036-\032\345O\217\376\350\362xM8\260b\312\320\006\275\324\034\037\317Va\261\201\266\216\263q\340\316\306#\342\264\r\304\ti\235N\244m\020\314a|:M\203\343:-\003\232\356L\025L\352\331\277\270D\315\364\037\001L\257Qc\200o\304\3130\f"
+	.ascii	"\357b\310\f\rF\234\230\013c\354N\260\335C\325\264\013#M\314\266"
+	.ascii	"\031LN\317\266M\302$\003"
+	.text
+	.section	.gnu.lto_setOsdProfile.90.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\005\013"
+	.string	"\206\223G?0\213(\035\233\341\021\2269\231^1a0o\007\006?\242\032\376\306\263\325v`\257\341\320\321~#Ha\b\274\256Q\"u\332o\302\300@+(e9N\206*aB4\234B\177B\366\2262\2453"
+	.string	"6"
+	.string	"5"
+	.string	"\013\276\335\212Ps\363/\313C\347q\267$\243G\bot\b`\342\201R#\274"
+	.string	"\260bwoz\n\360>\231\227ew\235\235G\340\276n\033c\373\302~%\n\340K\377\257\213P\0274,\354\016Xq\330T\244\340\300\366'\2663\355J\306\366\222f\335EP\232\260\373a\330B\362\350\315\316\360\217\301^B\201P\004\325\356b\032\327,\377\301!h~\003\217t\362\335\243\337\261\036\257O\005\225\006O\256\016Mq \301\tC\356.\247J\262^\263\256\023\006V'\024(7\330\037\227J\262\017W\003\031N\307E$\032C\331\330d\330\007\307\305\003\303h6\030E\302\031HF\203\205d\231\006\233|{\021*\345\321\217u%T{\303\311w\276\351\026\220r\276Bu\206:pQI\001\032"
+	.ascii	"\357b\310\f\rF\222\026 \211P%\263\027\251Zg\025\023ee\017}CX"
+	.ascii	"\f8\001\204\036\212x\\\b\256\211\002\023\355\245.V\251\311\302"
+	.ascii	"]\002\006\374jrUWk&kio\023\212\036"
+	.text
+	.section	.gnu.lto_getCurrentOsdProfileIndex.91.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 \355\215\006"
+	.string	"\362\f/4Pm\222\016$\351\252&\220\r`\3266M=\255\302\033o\256\262\257vAnh\267\243\215z\305\364`\314\305\314L+\3329<\003\007\025\305'qX\373d\313\024o4\234\3529N\365\\\304C\003\204\333P\225\323\020\374$\034(7\361\036\3452\331\325&\272\025\\\355\363W\025\241\b\310\304P\270!-U\\\217N[t\260X\247\333\301t\302&P\272\260\345\263\0176\216\357%3\363&\372ql\003*)\013$\231\240\026\226D\231J>\376\376\236\317\214\220\340\331j\326\001\302\214@2FV23\327F\265\212\326-\251\227\023\222\t\026\272(\0020d\346\210\2054z\353\177\360\033\374\033\001\006"
+	.string	"\002\013\330\210!\005\205"
+	.ascii	"\3572%\334eS;\311"
+	.text
+	.section	.gnu.lto_changeOsdProfileIndex.92.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"]\t"
+	.string	"\026Q@;@\305(\035\265\3267\330\324\227\243\221\247\366"
+	.string	"p\037?t]\201\350\201"
+	.string	"\244\025?\245\221X\304\331\256\321\031\005\256\200Mg\304\001m\346I\207\213@\245{\347y\277\305F\266\2242\005."
+	.string	"0"
+	.string	"."
+	.string	"\235J\336\356\252\242\n\200!I%fCY\"\274NV\b\302\222\324\234B@\025u3\302o7\200\323\335_0\324\320g\372\337\341\277\302\377V)\r,\335\247\030\200ve(\"\3775\363\177\367_`\350t5:w\177\230\260\272\307\204\037`4{\367\253\350\250j-\021M$-\335=\031D\003\253\340UTN\211I_\226\3745\005\3606\246*\330\213\305\234:\353\350\262l\340\021\033i\225\026\366\217\337r\352W\331\214\222\272R\335K\001G\027\232\007\364\240M|$6.4\360\316\306#\332&\350\023A1;\234hn4\337B\0327+\266\215\233\231\321S\331\214:D\207\313\343Of+\371\267\300\b\017"
+	.ascii	"\357b\314\304\033\177\270$\002\224\302\212\245jn(\341q!\270&"
+	.ascii	"\376!\232\340b\225\232,\356r\314&i`j\017"
+	.text
+	.section	.gnu.lto_osdDrawElements.93.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"\375\013"
+	.string	"\026\326P@"
+	.string	"S\234\016\270W\350_\205\004\240^\343\026\032e\270$\366\204\240K5!q\034\024_\346\327\365\201^\230P\240\251\200\224\325\t\214\212|\013"
+	.string	"BA\345\023\202 \001\320=\007\231\343\334h\023)S\n@"
+	.string	";"
+	.string	">"
+	.string	"9\036\232\330\353\024c\303\b\217\335\305\364t\357\261\322\364\374\t\bz\254\022\200\324\370\300\020\327\312"
+	.string	"\211\006\210\n8\252.\251\0227.\362\344"
+	.string	"\2122/\315\356:?\320\303m\3356\003\333\b\354C\b\273k-\331\017\371/M\253\2463\323\237XHR\n\\\354v(\371\261\2508#\005\305\366\323\376\212\203x\017\311\340"
+	.string	"\273$`\220\354\206\007\\"
+	.string	"\300#\346\027\353\261:\001\353\321\236\035\377\214y\213\217\\\360O\230\263E\177\263\036S\365\003\216\036\"BYr\024\037\t\245j\3621XW\t,l\214\322\207\257\254\274\263\354\217\205\374w\275\310\027\250@\215\024d\207\240T\223\375j\003\335\003\215\263q\340\351h\034\367\311\0068\313L\3506\254\263\211\300\3012\256\3032\027o\0254\016\363l\033\207Q\302\275\226\254\t\251(Z\362RU;\3234\274Pm\240#e\354H\215\250\004d\252\275\241\220\001\027"
+	.string	"\357b\310\fMg2\346/\345l/\020\032\002q c^\361\f[\024\321>\027\342\007!\226V\307\203k%"
+	.ascii	"\256\213]\304j\364\270\313-\355\245r\203\271\030\032A\355\001"
+	.text
+	.section	.gnu.lto_osdTimerDefault.94.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 '%\001"
+	.string	"\340\032"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\201\024\200\024?\202\210\200\020\1773\274\0014\273\001"
+	.string	"\002"
+	.ascii	"*\302\f\240\b"
+	.text
+	.section	.gnu.lto_pgResetFn_osdConfig.95.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`X\013\2452"
+	.string	"\352Sl\022G`\034R:\377\307\226"
+	.ascii	"W\225\206\225\200\203\276\315\3201\340\216'\327d\035\255\256"
+	.ascii	"x\331P\343\221\312S\310c\323\341\203\274\322\017 ]\021Q`|K\256"
+	.ascii	"\261\210I%;o\256\026\022L#\201\336\377\301~\311'\204\354\235"
+	.ascii	"d\n\001\001\001\030\001\352z\263\376u;\177\245\3702b\233\243"
+	.ascii	"-\325\363\316.g'\320\327\036j\277\006\357o\367\233\267R\374\030"
+	.ascii	"\216\013sN\262Esv\nu\203\366k;\377\303~m\037\200\375\332]\354"
+	.ascii	"ns\247W\376\263\216*\3134\347L\204\227\252\252\0021\306<\301"
+	.ascii	"`\260\2071f\233\302U\347[e\213\017\002}zx~\276^\313cW\241\212"
+	.ascii	"o\261\317C2\373\002\267g\325\361\351A\225'\016J\220\303]y\251"
+	.ascii	"\022\200\244\305=\212\274\300\256\373D\177\331\240]\357Q\203"
+	.ascii	"pWC\324\bB.\017\327\177k\277kn\\\367\251\270\214\233\221\303"
+	.ascii	"]\005Q\215\220\3131O\273\202'W[\267\247\340\b\026\220\267<\244"
+	.ascii	"\264_4gS\314\b\026\220\363\324`\316\331\347H\245F8\313qY\037"
+	.ascii	"\230\326\327V\353B\365Vo\256\034\356\n\211z\364\306\212\314x"
+	.ascii	"\214\272*X\326\361\241\277\\\354D\311\235\035\263~yH9\347\276"
+	.ascii	"UG\2547\200w?Iw\033u\373X\004X\210\373R\335\201\302A\277\030"
+	.ascii	"\243\231\252\343\373\003\226\207\217\177\366\365\013\312\206"
+	.ascii	"\tD\351\262\265be_\210\223\375K\202\2210\236\273@_\261\261\275"
+	.ascii	"\260+\376\230\331\234\324\235s5\347\234\325\016\372\212\221\360"
+	.ascii	"\303\310\276L!\243\356]\177\356D\266\273k\274\013\361\200W\316"
+	.ascii	"\271\250{x.4\332\234\363\204\266\022N?^K\276\366q\260_\241]t"
+	.ascii	"\310\246\024\352\336a\034g\313\214\034\214\225\335\316\247\333"
+	.ascii	"\312q\351h\234\354F:\272`T\241\350c?\200\365\266P\275\r<\333"
+	.ascii	"\333w\265w\357h\357\366[\336<\366\317\367\372\262\267\272\336"
+	.ascii	"\306\352\355\213o\037C\020\021$\327r\212\345\234\231\307]\235"
+	.ascii	"\374\266\26699\333\257\366\243\375[\376\347_v\266\373Q6\350\332"
+	.ascii	"\2025\267&3\347\234\346\314G#4g\363\354A\373t\325\236\251\321"
+	.ascii	"\321\307\322\207\366\257\237\345Z\212\177\266\227\004R\301,\265"
+	.ascii	"\234\363\225s\266\320~M\020l7\211\213\245\024\206f*}\022\272"
+	.ascii	"<v|+\215\255"
+	.string	"J@\276\203\240k$\0160q\253N\364\260\234\211\222;s\003u\357\200o>(~D\201~;7\273\210\037N9v9\360\223\017+\373G\2455\302x\216\007\3646\330\342K\271\017\270'az-6\302\227\202\006\304\335(\322~\253\2667o-\006b\237\233[\321\321\352\322\252,\213Ul\354\376\227\330\356\0247/\r)\303\220\315\277\375\253\207\b\317\225\317G\356\331\265o\353{D\247v=7\350B\357n\301t_\325\267M\354-\007~\352~\f\266\373\305\353b\360\316\250\255\321\255Q\245i\314^\033\272\\\\O\326s*U;\221-s3p\367\227\365dJ1\026s2\304\002c\200?__\345\006\352\336\365\335r\007\254\212\361\212\204\222\341ae\367\250\254G\370L\216;\204w;\017\033\177\366\236\330\021\271^\3007{;\275\273#\354\023Y\026\033\3350\340\262#\302b\345\021\276\026\3649\205\024b\026_"
+	.string	""
+	.ascii	"\207*\353\006Lwj\221\002\306\206\0250\230X\f\233f\360\264`b!"
+	.ascii	"c\230A\205\323\260\327KC*\234\206D2\230R\304 Zjr\"\032\372\351"
+	.ascii	"\341\214\025MD5\206\303&\242\2373\037'{\304\361\r\nG\365\301"
+	.ascii	",\357\223(\275{\202\344f\201\220\2743\r\202\361)\302x\256\007"
+	.ascii	"\350>lTs\037\376X\220\224\325\022\350\303E\370\006[\222\213["
+	.ascii	"\226TTr\257\024\231D\323 \233\270\313\347Fyw\321\311%S\21235"
+	.ascii	"\002\273M%\263;\220\306aJ\241z\260\262yT~\0250\236\363\001\275"
+	.ascii	"\207\215B\357\341K\341\351\341\n\330\306\032\231)d\324\213P\304"
+	.ascii	"\212P\0204\214\313,F1\220\2468\345N)\212\375\234-\277\220M)\324"
+	.ascii	"\017+\253\3340^\026\034\346\255\\0\351\203\"\331m\242T7\325z"
+	.ascii	"7\206\273D)\254\216\251%\303E\322\223"
+	.string	"j\303T\276[\303]vH\262\231\276\003\333\315\341&;\034\035I\203l\026\363\223\330n\017\267H\222\224n\332g>\\$\035S\270\005\342\n!&\345:\032\342n\021\345\230\002D\\\037\274\260\270{\245\200\354\250a@\345\230C23\"\n\222$Ic\260\002\221\251\242\325\001\021@5Tfh\002!%i\332oRv\255d\324\325\207\324U\347$v\366(\\\345T\2201\256&[*\306\032\337,R\202?9\360\226q\303\325#\027\211&\025\361-\036\210\002v\f\023\365\3024\322\237\366\311=\201T\n\205\rWb\371\020\026\261\254\242\206v*5\003d\022\317\351\217$\023\250L\002\224\240\024\331k\316@4B\035d\377n\022\276\027\020g\177\f\277\337q\351)\002\"\354\252\021\236\324\027,\337\307\350\241\354\263\016\\\345\313H.\321\232\300\003\225N\324\244\244\233\273$\360\266B\020v\265\036\233\r\242p$\bf"
+	.string	"\273\243!\367\272\315\200\227=\007\324\331\365\264\250vSGG\251\204zUSR\241I\311_\263\277\245c<\005\351\312A{\"\346O\207)p]\t\235R=\017j\221\324\205\3243\357\252\241d\210$\236\0066\274\200 \276\020w\370\334A\227d@\335\255\347A\241\t\267\335\307#r@D\340<N\004\352%\326\241\355\007\373\240\240M\266\356\343\343V\207L@5X"
+	.ascii	"\206\323\b\274Vo\270\023\324\222b\2709\324\024\350\215\341\240"
+	.ascii	"\343\321\323\240\331&\202s\033\023\236@\242\315\341\177\360\225"
+	.ascii	"\204~\317T\313\0174\366\305\236I\0321\357c8\203\260\331\372\343"
+	.ascii	"\350\274n\220;\314\227\310\001\317\345\334\334\271\273\207\252"
+	.ascii	"0-\256\261\205\\\261\253Xbk\325\332\2050 \033\205\022q\276\220"
+	.ascii	"\237\210Q\267Z\032\"\261\323h\304h\n\n]\223\221.\007\255!8\002"
+	.ascii	"\261\t\031 \366K\241\177"
+	.text
+	.section	.gnu.lto_osdDrawLogo.96.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\240\003u\031"
+	.string	"\006p\243H\260\226Q:\024\347[GZwc\372\313\260ND\3522\323\025b\310\215xPu\312\026{=\203\030\350L6\201\371\370\275  \355\350\266\234\237\031\364>v\366~>\220\372\024\274\001\305\333\026\306\220\037\375\237\020B\310\2262\245\222"
+	.string	"\202"
+	.string	"\213"
+	.string	"\007\304\177\004\376\002\377\311\263\200\377\354\033[\352\272\241\031\022\325h<(s\316\330\256\200\301`\240\345\245\356\026\367\346\243J\f\301O\256\336\370\273\033\200JR\273\315>\212=WIVT\214\237\033\331\361\221\017|\232\242\336{\001\030;?*\026P\301\203{(U\351\307\210\326\215&#\034\rM\301QPe\324\363\017\305\245\\\300\244\207\223\326m\204|\351\264\250\235\351j\273\345\350\276\367\217\350D\223 \036\3345\2240\347\264\326n<\367\352\266\203\330\216`o\210B\266\313k\374\260\353\376"
+	.string	"-\257\253Y\276t\273\316\273[+\254\325\252UW\217\252\026U\035\252\032\274\372S\265T\365\252Z\237t\177@\313Q\221\nC\346\324\231\2422\211|N.\276\364\363\376\244\257}\373J>\323\022\216\034:\020~\303\357y\365\217\247\224\343\304\003\361\337\277\363\312v\222\237\304\331\216\330#2\301d\316\371\362\317\nD]S\002\361\237\257\366i\034\351\3465\374\344q\316 $\036s\316\006\016@\262e-\227\265\253\265\331\f\356Z\227\275\023\220)\375De\331o\307U\255\335\201F_3\001\332\316\3547]\007\b\277\310\036l\3645\033\360\237jG\234\270c\270\340\212\256\r\367\260\005\027D\"\367[\325\261\253+\367$\200Z\273\373"
+	.string	"\2538\036\255\212\b\235\362q\234\265,k\245\341\030\234\265-\013:A\355 \001\204\243S\017\362I2\223\233\363\247\356'\220\265CEGvArT\312.IR\202\332\315\331\272\231~:-Jx\0032\033<h\220\301\2006\262\231\255\301@\023\023C\241FF\026\243\002\361\0177\214\203\0134\262\230L\006\013\033b0341\007/\3138`\230\211\325\310d3\261\225n~\205|\310 \"bqj\343\001 \035\251P\255\220\307\031\341K\214b$\245/o\255\3152\374~w\021\211\221\020}\212\025\331\332\367>J\th\212z!\312\326\276\266\007\310\023"
+	.string	"HGC\341\346\274\362\363\271\354\231\216\200\205\352\345\256\265\371[\255\245jeYks\355\204\"\033;%9*\345r\3169\301\315\371L\277\211\\\214J\250Q8\343\bC\006)2\"\301\0043b\240\016\240\002\231\262\242\007\020pw\2324\006\177S\246}`\351\211\r\n\322y\353\371Rd_\305\246\216\033\272\035\223\256F-z\234\331!\306"
+	.ascii	"\374g\351+\354\307z\320/\277|A\274\234\227\317\353\003\225\006"
+	.ascii	"e\022U\355\r\254M+\032\322\0371\016\203D\276\261\021I\022\003"
+	.ascii	"C!\325\r\006\225\003x!\255\303\f\035[\327\227\025\242|\244\261"
+	.ascii	"\327q\001\001\271\001\254\024/ @q\362\360\311\245\226G\005x\222"
+	.ascii	"\300\310\017\352\334\201x\365\236%\335\004\027\025"
+	.text
+	.section	.gnu.lto_osdInit.97.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`w"
+	.string	"\315\t"
+	.string	"\246\221B= \345*\035\3408\022\022a\031z\b\bx\021\307\013\203=!<^\376\032%\017\306p\034\243\255aJA\021\006&$\251\272(e k\2420\353\001\322#\020\006\201(\355\017\262\367\336)\0050"
+	.string	"0"
+	.string	"2"
+	.string	"R\343\337\351\224\361\363\007\300\323\351\3463\343r\"\260LV\b@\325\324\264|\270.\362h\001\246b\024\350\354\256\343\n\304\270\267\333f\260\255`\233\026\265\001\313BU:2\266\037\355\207<\366]fz\301\356+\226\262\033&\370"
+	.string	"s\352\360\233\355\024s\315v\352\317~y\270\261?iU\224\004\330]..Q\304\257<\345)\316HPhS\302\336\002\361`I\233\266(Y\034\256\021\027U\024`\207\251(a\366\347\356\256\345\313\276\354\217\324"
+	.string	"\300\f\242\266{\021!\357\241:\220\272\332P\362D\214<\321\002\310\253\032\1778 \257r\023\"\217\004\367\351<\216\263q\035\205:\216Tk\307eB\324;(\231:\2250\3333F\351\021"
+	.ascii	"\357b\310\fMg\b\003\211>\341b0\217\037\325%u\257\021K\210f\245"
+	.ascii	"\002|\027\013\232\325\224q\227[\332kJ\270)\205\332\003"
+	.text
+	.section	.gnu.lto_osdInitialized.98.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\222\f.4Pm\222\016\303\004a,\b\024\"4,\311"
+	.string	""
+	.string	"\261\214{yeU\375\331\267\177\267w\024z\305\364`\314\02113\255\b(X\001\202\"\342\247\016\333\332&2\005c.\031\353\271\214\365\334C\303\202\203\303T\226\273\b\374 \030*\027\361^\345,Y\026G\210\004\036\374|7\225\"bA\"\237z\364cs5\226\320\264b\245\256\246R\252\030@\341i\245\317:\r-\276S\342\350ockw\032H)Q0\311\f\225HIB\205l\374\234\267|\200\300\371j\206\021j\006\t\004\202\222\2319\274\350\325v\335vt\342\0309\301D\2356\200\204\314\274a\242\211\216\375\r\376\202\277\"\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_osdResetStats.99.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`1\002=\017"
+	.string	"\346Y_F"
+	.string	"\261&\0358o\215\351\326\r6'8<T\373\266\245E:\252:\343T\222\257\374N.\302"
+	.string	"2\201\245R\353a\0038\001\344#\026E\255\3613\366?\202.\250u\352\337\275SUG\350\005l\220\377\213\354\275\267L)H"
+	.string	"J"
+	.string	"O"
+	.string	"/\351#\302\366A\\\262o\\e\263Z\210\f\027td\273\273A\020/=B-\371\232\311\356>\365\217\323\347\362(s\030\007t\370\221\021\371^\342\b\354\203\215\247\2561\037\214\252f\262\273\326\323\267\341\226\267m\3006\211\255\251,o\332,gy+\001\030\270\347\234\220A\253\233w\323\226p\023]\210\315\356\026\360q^\202\202\217\272t\205\026\375\351\322o\231\227\262\205\216L\207Ig\266\312Ea\215\375\270\220\306V\265^}"
+	.ascii	"\001H\300\036\270\330\3250\353\261\001\317\221S\003Fy\330\227"
+	.ascii	"\361\327\211\217r\002\024\224yy\030\302\2415bf\301ct?<.\333J"
+	.ascii	"b38\f\273^\004\361\334\310B\323np\026\241\025\022hGv\325m\321"
+	.ascii	"}\272\236\035\002\267U\356r\320\322,\260\034\373h\332+O1B\261"
+	.ascii	"\n\026\225\244t\334\226\322q\033\204\225\020\313&\"u[\311\210"
+	.ascii	"\271\b*\244m\002\307\2216\020\325>.\244\211\335\233\307\241\242"
+	.ascii	"\245\212\2727\025\306(\300y\231\340\213}\3404F@-\2056\202\317"
+	.ascii	"\360b\0373&\235\305\bkT{v\300<\300\237\314\303. \340\002\221"
+	.ascii	"\240\252<\347\204\016\226\300\035\306\322\031<\360\245\267\003"
+	.ascii	"b##n\023)\313R.%\330\262\032\227\201\366eG\246\362TX\322\306"
+	.ascii	"\214\004\232\3747\326\236c\017\2761\313\354\210\343v\315\210"
+	.ascii	"i\216x\023\344\210\235\215\2457.\211\332\004b\0021\304\3328\276"
+	.ascii	"\357\222P=\030Z\303Q@\341/\306%\313eJ\001\367"
+	.text
+	.section	.gnu.lto_osdUpdateStats.100.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\232\007\225$"
+	.string	"\366\276\334J\220\230U:\304\023\334\266\\\370Y\037\315\364=df\207\370\026\222\314c\366\235BEV\3329\321\370\002\353X6\353\005>\002`\306^\351ws6\200\t\230\217\202H\004$\200q\262\352a\003\204\275\357\373\276o?!\204\020\271\223\f\305"
+	.string	"\267"
+	.string	"\320"
+	.ascii	"\267\314\377\217'9Fu \353\203\374x@\333\r\226\230\321S\177\332"
+	.ascii	",\337\307\247\326#\215xA\333\rB=\261q\357\035\360\223s\324\237"
+	.ascii	"\274\357\320\237\346s\350O^\231\263N\345tS('\241\220\255{o\257"
+	.ascii	"\233\276^\227\303\335l5\332L\026\203\275\324\024=\315\266+?M"
+	.ascii	"\360\032&\035]w|\356\210\203H\303\342L\001LV(N\205x4wSbp\231"
+	.ascii	"aoO\267=9\331\332\213\323^0\331\231\213\313\\\264\260\261\245"
+	.ascii	"\303\226X\330\027\016\214\023JW\251\020\225pp\020\2136]qT(\302"
+	.ascii	"\236)n\302\222R\274iIA\223w\357}\362\226D\022\222\265i\202{/"
+	.ascii	"\333a\322\211\363\356\314\027b\346\003\314(\230\025^\205\244"
+	.ascii	"\373$ce\332\306\351\247\021.\331\302\217\364\250\367^\004\374"
+	.ascii	"\"7\342\003\024\024\324'\031'R\366\336{\324mD\337?I-Ak\206\231"
+	.ascii	"1\234\210\220zo\020\001_\310\207h\340\037\177\362\220\317~\370"
+	.string	"\223\357C\177\276\t\354\320\3014\205\004\332.f*$\333F\346\233\367\336\313-\203y\347\310\263N\016\016\257-\337<\310\271\346\264\274C-\353L\3139\3242\356\264|k\3136\324r\r\265L3-\317L\313\262\324r,\265\fC-\277\332\262\332\226\323\3232jZ>O\313\246i\271M\313\266-\337\300\307\020\267\300d\250\272\327D\027\232\213u*\211:\362\017\022D\206Z\264X\303\376\345`\270\212\177\344u\007#a$\350\317X\333d)\002mW\217gqU\027X\243^\236\314\332\270\305HK:\244\013WQ\246\323\257U\352X\214\256\274\272\225]\002X\346uj\375a?\324i\233\245\034\261\264\255\360T\351\300\245\314P\013\326FV;U\360)<*\226\332\255Tr!m,\363\002\006\366\303\264iQ\224^m\274\262\342aEm#\3474\332?I)\016\016\345\247>A\273\225V\244\220g\347\364\257\204K"
+	.ascii	"\226\371\001\004\373\341\3314(]XH}\224\266\261\311\257\346\304"
+	.ascii	"$Uq\305UD\333\310w\"\302\344\265\021\223\254\306\351\232&Q\323"
+	.ascii	"f\377$\255\"|\311/\311\225H\230@\201\002\372\323\354V^I\235\335"
+	.ascii	"\274A\0376\370\2008\207x\202.|(\022*\332\340\003c\240\002\027"
+	.ascii	"<\370z\034\204|\206z@D\036z\005v\354\353\020D\324+\362\371\210"
+	.ascii	"z1*\340\315\3332\3161D\256/\300F\322\355z\304og\205C\255\\\357"
+	.ascii	"\372\304-/\302%;\ta\302F\256\215\254k\\\023%\255r\255\353\013"
+	.ascii	"\227@\033\264!z\232\326\247'\364g\256s\236\212\267\306\321\260"
+	.ascii	"\300\237j\217n}6\ry\215!\023\026\256\215]\277\351'\257RIf\351"
+	.ascii	"\333\240\266\276i\266\302\"\322\323|\311\003\265F\255Q\350O["
+	.ascii	"7\360qd\232\272\311\372LO\315\311\314\211Y]C-[\255i;]kS\210p"
+	.ascii	"9kZ\177\275\361\255\2362\263ne\031Y\357\2549dM\213\022"
+	.string	"\245\326F1\\\025\006DV\200\231\250Q0\246\021EC\"I\nR\251t\320\002\021\231\272:\0208\206\206\210\026\344\001O\341\b\253r\030G\252\353\311\023\313\206\364\301~P0\306\235\202\347\201\254\034\022\256\371\030\300\203\344\215f,\237c\223\024\321o-At\\\240\373#\207\266M\217\342\016\202\240\314\300J\220w\273\220\220\340\351@N\013\261\t\360\022\033\013\340\254QE-\003\334\265\221A[z\210;!\236\004I\fZ\256+\026\264\340,\245\201\037\001\351\250G\242\233p1\270JD'\317\r)\266G\207\270\273)\206\362@\021:\216\004r\006\031\342\203\035\026\254.\025h\300\353\353\305>\272\003|\333\025\016\261 \330P\260\f\370+K\374\232\322V\\\274v\027DF$\371o\206\3645~\334-\255i\021\300\273{\020#\316\212#O@\03145Y\225\027\275`g\261H\350\\\265B\235\215\033\365+\013\305\177"
+	.ascii	"\251\264\273Q \354Yn\316@\236k\270\2375\320cF\320\344\231\366"
+	.ascii	"\244\331jg\201'\252\361\301\031\371\314\026\326\037"
+	.text
+	.section	.gnu.lto_osdGetBlackboxStatusString.101.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\203\003\r\033"
+	.string	"\306\263\265J\240ZQ:\364YM\254\003\262rj\2033\034<\353\353\316\030or\301g\367AE\370\275\340"
+	.string	"\242\026\002n\274\372\177k\\\334\236\344\034}cDX\027%8\351\020\r=2N\326\027\272\021\274\324PBZ\213\215\220M\210\334I\006\237"
+	.string	"\224"
+	.string	"\242"
+	.string	"@#I\0238\375\222\334\227p1^z\321\nWMI\310\334\23368\311\013\314\223\261\361\225\371I\256$w\245\031\017p\257Q\324\323\275\251\003F`\236\344\3640{\322\274"
+	.ascii	"{\222s\314`\236\006\271%\220\210\217\t\231{\257\254\201<w\263"
+	.ascii	"\264\344\3305\307\037\236u\242\272\233\007\312\022\203\217\034"
+	.ascii	"<nkP\337\030\273\367\366*\271\343\343\310`*\312\230\032\224h"
+	.ascii	"\204\335@:?|-By\265GX\226\037_Z\350nd\360\303\242\243\006%\252"
+	.ascii	"\265\304p\357\345z\2429\316\2543\363\311\3143\346\246\021N>\346"
+	.ascii	"\275\274\t|'\1772\343\0179\311@\264\372\363$\237fO\276K+PUJC"
+	.ascii	"\265\3104\225\271E\255\376tu\025\"f\252jj\327:\346tW\373\210"
+	.ascii	"\371\343m#\346+\375\260\233\227\255ls\341\331\365\2453\315\231"
+	.ascii	"\316\254\262\262i+\227\266\262\265\225I[y\264\225\233\254\\\307"
+	.ascii	"\312\307\2710\365\353"
+	.string	"\001Dj.\351\275Q,s\211\244\024\340\227~\246_\370f>\363\233\230[\177\360L>\344\026\004\t\271\013\205\314\233T\n\201\300)\rL\270\030\317\346\362\002\365\336\253\263}\304\277\376\225_\212\352\314\370j\232.\252\365W.De\243\3718[\003l\362A\031o\232\325EOw\365\203WK\302h\361\302\253V$\331\257\276\351v\352%YH\357qvl\262\t@\341T\346\021$\352\317\261\035D\241\256\247\343l\367\253\273J\017\311\256\026\231y\347TLL\221q\302\034\002\303\236\354\216 \344U\231Q\360\324\237\265\r\374\212\304]\353(\034A\245\306\013YW\027Pr\025\364b\006\2718\356\275\013\fX\021u\325\314\221\316\037\261\373\250>\307\276\007\004\245x\325\212\231{\036\\\"\304N\206\016\226ut~tH \027\264\025\266\232\211\333\207\231\017-\306\214\303\200\237\331m\247\305\242'\250Vb\006\324c\253\005\335"
+	.string	"\250P\001#\305\310>\017~n5\231\013ZO\013\231\217\355&{"
+	.string	"\343\332\213\231M\026T\253\331d\255t\350\343m#\236*\342P\357\3147\235\230a\203\331\343\371\360\257\021%\206H\324\2722\247\232\375&\207\362\220\323\345\336\336\317\017f\357D\202\223\260f\006!\242\376\344X\257ul\323\346X\2448\364\235\351b\361\nl\3316\315\325\307c\327\266\313\306q\332r\234e\265\3557]\006\204*\310EXdW\213\0018 @\002b\230\243\363_\326\300d\373l\f\354\375\311Zk\033L"
+	.ascii	"\212NN\343\222\217\343\200\227\345I\353\334\205\007\2645\261"
+	.ascii	"\265\363\356\330\027\342<\313'\306\246*\300\373\210\2402$\207"
+	.ascii	"Fu\276m\022\223,d7#\3436\264\260#\357A\330\007j\003Pj\253\312"
+	.ascii	"\033S\350\020\307\234\b\245\220k\b\027\b\263B\304\201_%\273\003"
+	.ascii	"\022\213\374\240Z\026VV\210\274NEtI\343\210\344\215\360b\230"
+	.ascii	"\205\336./\216)n\001\315"
+	.text
+	.section	.gnu.lto_osdDisplayStatisticLabel.102.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\023\001-\f"
+	.string	"f\227R@ Q\224\016\244CBA\fb\202#R9\"\003\n\f\005\006\036\343j*tZ\305\025\301fEk\250<+k\2573J\362\327\200\004\200,\013\345\2168C\237\003\317\311\271\262\265F\b!{K\231R>"
+	.string	"?"
+	.string	"="
+	.ascii	"\001\254Gg"
+	.string	"\332\r\036p\007\341`\335\0251cd\327[`\003\330\2439\333\306\275\022{}\254J\337\215\335\325\224\304\271'\347_\344Yw\022=\257\b\273\353\354N!n\275\355\002\266\035\330G\021\366C\376\311\275\377:\310\037a\032\302\264\302tf\372\225\212\307\207\323M-vA\254r,I\214\361a\373\024;$t\351X\017\"&\022h\332Oq\025\334\275\320\001\354\252J\016x\267X\217\330\003\f\020<^\005\250\013\325\313\227\312\362\322k\3362\254T{\303\220\357L\240\244\"\373\337Yh\360O\330\003\312w\217>\310zL\315PQ\257\3670\301(\225\214re{\242\324\021\366\341\252*\206\220\033\020\205L\206\370\331\260\371\300\320\255\301H\360l\232\005N\246\202\246\351x4\214\305\333\205MG\373l[G\243x{\270\2522F#E2\322\016\316r\242\327\001p\004\352\004\365\341\370\212\277\340(\250\261Kz7\001#\005\027"
+	.ascii	"\357b\310\304\253\245\321\340\002\200@\300\273J\360\"\t\331\300"
+	.ascii	":\3401\254\370\025W\275\307\\\300\2051\271fw\034\206\003&\202"
+	.ascii	"\021\200\n\001\214\370R\361\300\235[\264\363\t"
+	.text
+	.section	.gnu.lto_osdDisplayStat.104.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\337$5\212"
+	.string	"Z\340 1H \216\333\031\003\247\224\274\263i\356m<\272\210\375\024\231\031\374\300\245{\224\215\340\"e&cYh\303\257\252W\256v\001\206\2065l=A\375?)\256\377R\346\021\364\251\2314}\351GG~\3456\023-\245\2242\245\224\002\325\002\330\002\020\003@\220\234\177 9w\2613\227;o\271\363\001Eg\037E\316Z\356\234U\344\334\303\235y\270\363\016#g\003\334\031\313\235u\270s\216#g\034F\316W\254\363\rw\266rg\033\356\\u\344Le\344\\\303\235i\270s\001E\3163\334\231"
+	.string	"w\036\200u\226\301:\307pg\001Xg\030\254\363\224;\007\340\316/Xg\027\356\f"
+	.ascii	"\353\334\202u\226r\347(wfAt^\341\316PDg\025D\347'wNQt>\026\235"
+	.ascii	"Q\260\263\223;\237pg\023D\347\022\354L\302\235\215\356\334\344"
+	.ascii	"\316#\210\316L\356,\202\310y\211\235C\2703\bw\376\340\316\036"
+	.ascii	"\334Y\211\3109\311\235;\2703\007w\336\320:kp\347\f\2543\222;"
+	.ascii	"\037\261\263\021\353Ltg\242\326\271ug\226u^\335Ye\347\224u\376"
+	.ascii	"\325\331\335\271\233n\t*\026\310F\356\313C\355^\263\303\030^"
+	.ascii	"@\225\017L\323\351\336\353\316\353~\323\335\246\233M\257\314"
+	.ascii	"]\207\016\367\261\3153\016\314\331s\222\276xo\332\334\022Ec&"
+	.ascii	"\210\234\274b\340\332\237\001p\3368"
+	.string	"1\216\331\275h\304\300({/\216\266\237\334xm\222F\245\335k\3066\241\374\241\241\321\266\2522#\271\357\270\310]B\257A6\233'\375.\3376*\007\206\360}\317\240Ze\031m\253\376\032\335\333\016\003\376\367}\373\263\367\276v,8\252m\225\335\231\033M\323!\273\216\373\230\350}\257\244\331{\337\227\005\237h[5v\322\332j\332\034\326V\231\231]L!9\371\201L\311B\0139/\314;C\357k'\365Z:\331P*\236R\034Q8\2350Q\202\204\261i\004\223\210\245\020 >xPJ\352\300a\203\206\fHGFEE\"Q\313\256j\372\236\344V6T\033\037\025$\236X\252+RL\350\024w\376\374X\247\275\315\017\305R\035\247\020\204N\260\t6\241&X\2529\355lyJ\274q\022r\214x\336\224\306G\204x\0062\2119\243s\021F1gh|\311\260\031\030\342\214\203p\241\031\370\301\214{"
+	.ascii	"\2626\330\204*}\361$h\007\301&\007=\201\201\033\352\326\374\232"
+	.ascii	"P\rr\332\327\364\232\031\234\216\004\342y$\346\354\315\215R;"
+	.ascii	"j\206\201\320\242b\372\202\314\220[\247p\326\226\026\275\300"
+	.ascii	"\024\354\273&!\346"
+	.string	"\314\315\211p\332\325\\ \372\020(\260\275kW\003\324\fd;\fO\257\215\327i\235Z\237&\364\r\032\b\255N\3514UA8\307\205\"\032Y\232d\366\245\254\361\332\243\240\215\371\303\001\243''\257J\0347u$\254\315y\351\302eK\034\02565&\021MluA\020\254\364\225\2636\017\316R\275\357\313^\206&\245yE3\177\032\346n2\033+\bhI\017\274\313:\274q\214\223S\034/\231\326\276\357\013\203\375\351m\222kmI*T\326V9|\303\351\264\0055Bsu\204\332\237T\316\n\t\2114\374\206\r\rx\tj4 ?\003\322#\323\324\321!\031Z\321GF\177\344q}\301\033\021\377\002\026>g\246\fq\020\236\266\205w\240\366\211\2369i%\331\\\276\222-x\242\357<\246a\030\005>&\231\245u9\027\223\324\222\306%\271\254\\\326V\333o6~\3702x\366\335\3700\r\335\331\353g"
+	.string	"&9\246\375\234_\222eZ\317\351e\375)\024\236\202O\016\325\352Cu?\235I0I\271\364\325o\246aX\037\327\033\2376\007k\370\264\251\203\324\307\365\377\306\2633\325\304\374\220]Kr\314\214\030\314I2\036B\262L"
+	.string	"\321\367\035\203\201\305\263$\347\270\273\264\312I\022\222tI\272\265\325\227B{\002\276\321\361\365\235f*\366\263\264\3435\307\304\255F\207\321\337y\332\237\271\312\312\310|%\263Wq80\356.|\225C\345\316\261\266\352O\244f\301\367\257M\016\3660\r\303\374P]\242\262\243)\372\276\313.\353\321.\215\034[m7}\247%\342"
+	.string	".\3572\356h \032 \331+\331.!`I?\013'\327\236\373Wsw\270\346\317\230\277\300I\336n\\\r\201\244h\0313\257\350\273$Q\321\367}c\bQ\300\273\254\347\276\361\272\247<\323\366\n\t\307^\311\355\327k\032\234!B\245\037R\262\"F\203\377,\314\037\260O\001\301%\352h\354R\340>Da7\023T\202\302\316\001\017\266\036g\222k\300\276\001\017v\236A\035\234\214}\271a\r\317\303\330\3054x1t\310\376\036m\371\213\201\373\220\240Q!\367\013<\330u\260\024\271\300]\210\007\333b\024A\334\203x\260\365"
+	.ascii	"\211\204\334,\360`\313\001|s#\002\304=\330\272\355\375\341V\201"
+	.ascii	"\215B\271\243k\233\235 7\037\225\355\017\005\356\024x\260M\325"
+	.ascii	"\366p\024\331\233\341\2411\363\302\345\341\326C\350\315}k\253"
+	.ascii	"&0\013\036\354'\2327\267\367U\376\361\n\036l\337W\t\367\312\235"
+	.ascii	"\t\363\276\357\223\035f\036\354~c$\363\240\227\275\357\373\276"
+	.ascii	"O\2552\371\276\353v\246\320\202\331\333k\306\r\231\355\304:}"
+	.ascii	"\337\367\365\317\302\334\351\373\276/?\026\346n\323\334s\375"
+	.ascii	"\246\271\323z\257\271\243t^s3\233Ns+Yg$\353\234\001\353|A\333"
+	.ascii	"u[\320u\335L\330Y\211;'):#):OPt\226\240\350|D\203s\004\356l\304"
+	.ascii	"\235\213\2703\221\242\363W\321\331\313\235!p\347!E\347\007\334"
+	.ascii	"\331\001wn\200uf\300\235\027pg\005\216\234\023pg!\356\034\304"
+	.ascii	"\235\021\310\340\034\357g\212gw\306Dl\260\366`\276\237\273A\337"
+	.ascii	"\333q\241t\340\232\231\255\255\366\230S\307ih\251\006\237+7\345"
+	.ascii	"P\216\255\362\340\361l\263"
+	.string	"J\377\351\035zO<p\247x\227\355\370\216B\t\001\212\2050\340\215\033\003\004\273\005\020O\303c\253XX\3176\337\236L\353X\363a:\307\353H\3734-\344\370.\215\243\357\303g\341\337\322WhH\270\322\303\362FWw\326L\345\201\215\031w\316\024\013\307V\255\254\236mR\331\303fC\004\356[\253\336\3067\240\265\007\343\266}q\r]*m\027\257\265\325\252\357\274\270:\n\234\333\265\322t\263x\227Q}j\bJF\311\215[k<\023-\037\347\306\265\374Z\336\351rq\275\270`\300\254\255\3268\252\221#\370F\027\250\231*\251\200\307\342\312I\271c\332eC\217\255\322\240\361k\323-\020\323\220\210\367\363\255\270e<\314\265\313\026<\266\332\301I\202K\207\007]{\300[P79\013P\343\256\231\361\005|\347\335}\033\006\3176\343\201\254\361Y\241\3759\007\327aFZ\222L\312\331x\216\255\022@\300\241"
+	.string	"?\300\0072~\200\030/\343L\214o98\030/\300\324\303X\300\215\013\307\273l\352?\374\3659\004(\346g\217C\007r\216\255\006\020\300\257\3156?"
+	.string	"\376\305\367\363\313\\\374\213_\266\324\273h\361"
+	.ascii	"\034W\251o\221\367d\256\336\217I\345)\354\323\376,\363n\240\361"
+	.ascii	"Jw\216\024\235v\331j\216\255FE\375\332d\013\324\320\206z\026"
+	.ascii	"\206\256\037\246\350\b\317\025\317\342\205~\372\025*\036\352"
+	.ascii	"\033\304\372\364*\276\363\226|b}^h\350\351W\2675;sua\201d\302"
+	.ascii	"h\320{F"
+	.ascii	"\365\234\220\353\347\336i"
+	.string	"\227\235\345\330j\212\024\3176\327\0025\363[\257\317\034\340\361\233\371~\210i\030&\330.\236\025\305\037}\320\003\271x\\=\356\036w\317\332*\212o9\255\276\260\226W\250\226\301\311\211\f\240\217\265?\307\234\025\022\"\3359\377$\225S\235vl\365\304\211g\233jP\246\241\226C\265\211G\341\006\272|J\274\t\250\363\021,\361\275\267vWxD\302\3534\211\357h\237)\200\355O9\243g\364\351\200\256\237)\247\n\355\26298\266j4>\3334\023\361M\337O\327\343\002jr\003\265\313^>c\370\210gvYhz#\323\217\370\006\344\n\362?\227\220\037\323w\233\270\272\027\361\r\310-\264\304\366\027X(\265\303\263\247\250\257\231\252\273\313\344\211\203V\\\353\020\317\304\312\373m\027\206\225\331=\344\036z\227\205\370\216\006\022\002\034;\241\373\256\211\317*g\205\204\304\032\3168>'\251\224r\212\265\313\013\216\255\202"
+	.string	"\361k3\nt\311\225\336C\034\227\223$cJ2\333\345\2228}\247\245\224\276j\257\374\360\335i\357\341{\311\227\364J\0048s\022J\262\003\357\262\244g\367\002\375"
+	.string	"\305\004u\207\357\264w=\31331\234CH|\325\003\253\313\270\201u\f\360\345D\304\\F\036U]Z]G\274#\013\213\307\227\323\363UW\325\226QkK\310\021s\371\270\361\345\264\362\225\325\226\026\016\0269rD}\001\320\302\251\310=~d\031sh\3610\332\260Q\344 Z6vXU\361\260A\304:\252z\030o\\q\375 \232\222\341\243\210\273\262\256\266\266~X\0251\026\027\327\026\021;y{#\353\252\210\205l]uuU\3310fa\365(r\321\202\330\245#\007\026\017\034\031\370\312*\253\252\213\013\353\306\215\253+\037\\D\225\257n\374\350\302\352\342Qe\fR\325\303\210\275\234\276\234\242\276\234Z\266\352\3322je\261`D\2328Qr$\tK\304\213\311\022\034FV%O\226 \301A\304K\311\220&`G\276\214\232 \031\362``D\274\274\234\200\261E\2128\201 }\262d\013\203!H("
+	.ascii	";\362E\364:\322\004\354H\223!M\300\210\330+\352\013l\211\224"
+	.ascii	"\222#C\222Hy1\001\223\212J\342%\024\020a\"\325d\311\022&RE\273"
+	.ascii	"\260~,\334w\335\256P&\257\215^\321\327\272\361\272\215A.N\033"
+	.ascii	"\275\265;\271*y(\314\254\344\231*\354\305\370I\372\276Wj4\033"
+	.ascii	"\r\204%\370!3\325\037\036\036\236\201Z\203\\s\327.\377\203c\253"
+	.ascii	"I\222\374\332D\243\247\342\020\2224lt\202Grfn\202=Ol(\301\b\317"
+	.ascii	"\"7G^\202o@mR\2710G\276\377\332N(L\201\204\263F\360L\326\370"
+	.ascii	"A\272I\275 \3418\226\264K\004J=\204\0354S\035\373\356\372\322"
+	.ascii	"8d\236\024R\257]\276\362\330\252\021#\201\210|\221\357\2764\004"
+	.ascii	"W\216)Z\250\357J\267\362\213\314P>\221_\233g\240_\337\312\031"
+	.ascii	"^\377\365\354\234\024\256\212\327w\235~R\243\247KY3\025\n\267"
+	.ascii	"\350\261U\b \370\2659w85\344\201\037B'MsaH\247\244  \373\220"
+	.ascii	"~\310;\310;k\253\017\310\3451\344L\247T\212\237pl\325\001\007"
+	.ascii	"~m~\361K\315T\240\263\344\r@A\342aB\352i\227n\202\022\003\337"
+	.ascii	"\300\236\224\351\246K\006\276\335\330\006\315)\333\237x\b\013"
+	.ascii	"\tO<S1$\nR\310\300v\351p\216\255.\260\300\257M.\n|?\323\027\311"
+	.ascii	"\207)\nm\227\316\346\371\002n\371\312\030\336(\360\035\307\317"
+	.ascii	"'\360)\340\237C\036\370\355\025\022\232\340\343\373B^\346\330"
+	.ascii	"\252\020!\207\b|\220o\276\037\204,\324\024\345\302\027$\312#"
+	.ascii	"\360lsK\241%\037\220\357(\r\305\177<3R\005$\240\265\313\200\274"
+	.ascii	"qL\257\341\270\035{\3370\023]\377\343\323\273\245\0301?\f\364"
+	.ascii	"\203\254\007\250\353{N\253f\330\354\224\340j\246;3R\020\222\220"
+	.ascii	"w\031\327w\364\317\035\3001\303\366"
+	.string	"g_\230BB\022Qd!da\273\364*\307V\267\266\236m\306AY\034\340\343\017\3500gF\036B\372x\337\373S\006P\314x\247\265\232\376Z+\005\024\264\2420\214\250q\202+7\345S\216\255fe=\333tB\231\206\311\025N1\227\354O\332\333\361@\nS\202\252\250\2628%\016\302,R\210fDD\n\222$i\f\242\013\020\204\002QVK\315\003\022 \343@\211\263\030s\n\215T\215$\251\221=\016qd`\332\315*\021a5\2231\352\313#\027:!\ri\2709p\231N\214\364\375t\037\t\3673B\224\205=\024y\341X7\314;\346\360\013Z_\27052\232\013\345X\223\232\211\ru\366\257\214'\274\300\300~)\024\034\347R\326]MSF\270fM=\253X\224\317\3246{7\035%\271\373H(\255\025#\320\310M\305)\251\212\217\017JT\351P\t\003\361e\324\267'\313Y\240\222\017\352\370"
+	.string	"\276o\376\005\260]4\376\266\266-S\335X\bk?\210\013\223\332\261\352!\025\231\035\001\255\220\031\320M\340\245fS:\215\367\211?2\034\0261\214f\033\231\222\355&\001\003@P\266\r\312\206p\331\240\030\022\253h0\317\006\236<\325(\302xF\344\243\325\307x\227.;Tf\225.\376M\346\313\235\3510\212\237\372H\266Ak\242\200{q\223\035d\316e\007\177R\016\377<\323i\235OQu\354?%\240+$K\026\314n\346+T\247 \203Q\261d\023\375\024\337\330\025Q\374\360deT\222\304n\246\031\325\226\3702j\375\225\202Z\253\020\317\234\357\371\314\347t\234\036$a\335"
+	.string	"\354\350p\351\310\315\242\3513\375z\321\364k\373,}\027\250'"
+	.string	"\246g\227\244\031\373\205@\367{\214<\365\314\"#\332\325\242\206.~\233\0325P'9A\330\2438\267\303l\321\241\3048\315zHV\262\246\322\002\350\005\323\206k\2477Hq"
+	.string	"y\3463\245U\207\207p\353\246V\265w.b\333\210\230\230\2062\001\"h\237\302q3\377\236\224\025\342\237\314Oy6\007%\344X\022\311\244\215i\332D\221\377\272\367(9\001As\265\301\b\235X\364\227\250\340\314c%\321\316>EzQ\033\320\f\331{\235\023\021\344\033\221H\274\335\022\027\340\377\315\316v\022\013\257\254\"\374q9\350\233\222\323q\374\374\223\214\344H~\305\306\257\256\332X\232`<|\215=\253\214\227-X\270\255\373\300\360\341.\fW\273\327\225V\264\231?\335N,\370\234"
+	.ascii	"\036\2676\257}\340\364#3I)\243\264\007\336\"\341)\346\376L\224"
+	.ascii	"\271MiVsq;\270\213\251\016s\376\211\330\357\016W?d\360\335\315"
+	.ascii	"\363\007\336\303\265\252\302\364\210\006\276\203\035\275\315"
+	.ascii	"c\231H\217\340p\253|d3\215\177\310\310HR\034\371\005\234\006"
+	.ascii	"\002\220\221#{\264\226P@L\2650\006\257\2029X\225\2263\250\361"
+	.ascii	"i\236I\232\214M'\3078\345\314\233$D@\022\326W;\212\240\215\031"
+	.ascii	"\032\004@\210\032\255a\204\3661P%\252\037`\257&\021\016\022h"
+	.ascii	"\265\263\267 \346\311\262u\013o\312\306df\214\302W\233\236\256"
+	.ascii	"\350!\322\251\374\244-\304s\256i\236\262P\227\357\021\024\027"
+	.ascii	"j\242#/i\225R\013H\\C\f\325r\231Z'\256\201G8\202\332|(\265\b"
+	.ascii	"gr=\rU7\354\276j\003*\013q\022(\246\rU\226\\\024\224\360\204"
+	.ascii	"\334\333\220\036W\306\242\r\005\241\243\243\363"
+	.ascii	"t\016"
+	.string	"'T\305\323Z$6p\272\"B\317\276_b\227\363\1772\340\324q\3164t\331|G>H\251\373\324z8\260\240\200ob\211\227\325\204+\246\200\220\b3\213X\333>\201\245\017\027C\305'R\275\332X\031 0\232Ow\341F\241\353v/\204\222\330>J\242[SMz\230MR\0348\250\3603v\353%\351A\231\371\260\233\260\226\201#}\233\013U\366|M\274\375\030\347.\035\030\313Y\031\220R\251,\023w\211\356A,\031H\345 0\220g\013F\213{/\253\357\001(\331\373\204\277\034/\277\316\t\270\253\223\376\337$\314\366\244\207\005>\311\177ic#\253\256\263\370\263(\357\245\232\024G\262\314\rJ-\313(Fk\334\272&\240kAd\\\366\252\366\002\b\006Y\006%\206\017\253c\226\231E'Qu\275\207')\221\333\200\260\t2\211\016;<\031\304\2612\267\242b)\\\227\034\341\246\321%\254\234}"
+	.string	"Ym>\263\034Zw\353\344\221"
+	.ascii	"I\376D\243Y\211\326F\177\2353\037.\240=Ioy\340JP\302p(u\222\343"
+	.ascii	"r\353\n4o\333\233\254[hn\357\241#\330t\037$\f?9\235\266r\250"
+	.ascii	"\303\325\"\373\321])\313\302\340\\3\243\306\254q\362);\246\323"
+	.ascii	"\220`e3\027\t\305\310\035$\341\277iMPC&\275Y\220\031\324S\360"
+	.ascii	"\355\030=\201\373\225E\0344\013\305\254\203\207c\327\366bS\241"
+	.ascii	"\224+\216\243\235\240\256c\242\024\021$\f\357H\304\367\003\312"
+	.ascii	"d\364#\242Q\220>\241\1775\r\357X\365\275\310\b\240\3538\357\252"
+	.ascii	"\216m\234\341"
+	.text
+	.section	.gnu.lto_osdShowStats.105.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\321\005U'"
+	.string	"\232J$\020Gp\334Q:\203*\265,?\031\027b\305\227M\364t\242\214\230A\225p\325\031O\245>E\346,l\221\241\356\276g\3462\360EB\013%\376\t\034v\263\265a\027\337\244\307\363\247\242\244m\313\352\315\032k?!\204\310\235d\363"
+	.string	"\341"
+	.string	"\356"
+	.string	"k\356\275\033\274\330\354\274a\367\324\332ZBqr\357\275\200;j\231e\360\273\316\344U\212P\325\212\202e\002\356(\177\031\345\033./U\252\025\345\f\n\322Qn\200\263\226\371P\036E\306\267\330\214s\367fQ\301r\357\375\361\001\334Q\337\001\244G\317\003\245G\033<\220\301\302\241\031\3036>\345\231\321k\316\275\313\244\036\302D?\227g\236\025\236\207\267[u9\234\232\242g[!\237y\f\3040\265c\325\360<\247]R\203\310\307\334\300:%`is\306\303\362T\nB\254\200|W \313\352\307\327+\253\273\324\217\347>\346F\217\261\027hr\303\207\305Y Ww<=\025\254\311\022\007"
+	.string	"\225\222c\321\2429~\362T\3158}\367\336\207M\331>\211\260\322p\360T\031O\004b\264\320\234y\213\254\"Z\253R\270\367\262=VY\235{\316\374 f\0162\243\026\002D=\324E}*\317)a\333\002+\276!\332&\333&j\013\306\370\306K/\023\342\356\275\020\370Yb\250\300!q\221\036\265\235\333\372\225\223\271\340#\341\025A\373\343Q~0=\372~\330\321\262+5txH\331\346\252C\013\221\356$#}\250\207j\310\351r\303\026f\312\326a^\016m'\231\3773\247m\311\035\204\371\310"
+	.ascii	"\001\243\001\326r\221\200\203\235\211\276\365\017\251\226\205"
+	.ascii	"\202.v\006\272\327\371\347\313\263O\257\247-\357\254\345\325"
+	.ascii	"Z\326\265\345\234\265\214\273\224\263\252ZN\255e\324Z>\255\345"
+	.ascii	"N-[\324\362\017\024}\021\331\246(\321\232\314\362R5\355\3345"
+	.ascii	"\264l\311\305~\257\037\354_\376R\306x\025c3\337\324\362V\251"
+	.ascii	"L\256\265K\342T\230W\346O\341\177=\214W0\030\277V\3674\220(\325"
+	.ascii	"\002-\322"
+	.string	"\264\205\232\255\221\007\3216C<\f\b\334\275S\021\370i\007#\342\034A\"\375\221Dz4\355\227]\275\321)\223r3\346X\342:\311\026E\272\265H\377\330OUl^I\221\036t*\335\214`\250QC)\275\030\311,_\230\256UR\002\2556\222\257\366\354\247\034\r\350\200\310\275\305\037O\340\212%\022\034E\373Z\376fVJa\177d\237\261\207l\324h\337\212\361\355\027\246FM\240\317<\b\"\027Y\261\317l\240\245\235\344\257)\317\030\311\316\001\315\363u\307F\027\365O#\037\366\\\031e\233\221\354\374\243R\024\312/F\262\376\226\3734\222\037\225\372\364\231?\032\252\2611\333\3166\352\273\031\337\244\316fi\367\331\250[\361\311O\023uw\017sKM\221\t\021]\360\242\036\320MWp\230d\276\260\210\250X\221-g'\217\272\324\2060\323\002\374\373\375|\035<T\360\320\301\367\373\375|\276\336\322\225\230L"
+	.string	"\231\226\200/\200\274'\030A\016kS\020\252\231\224L"
+	.string	"3D\001\231\232\236\226P\354\240X\270\b^\200\021\344\360\004\005\204z\342\361\t\006(\236\202I,\226\200+\222N8=%1"
+	.ascii	"\300\301&%\247$\250`\320)i]\336\237\274^\013\020\340\263\326"
+	.ascii	"f\307\232T\023\231\007\311\310\356\250Y\rj\240F\362\256\247\371"
+	.ascii	"T\325\3565\022\250Q6jn\376\237\367\336\313\353$\353(6\337V\003"
+	.ascii	"\315g\256\327=\215\004\352\243\016\300\344\"S\304\"\332\246\355"
+	.ascii	"\332u\222\313{m\240W\"W\223\263$9\222f\335\365\263\230mV\327"
+	.ascii	"k3k\330`\177\334\265oF\0179\355\265\337k]\353\264\270\344\030"
+	.ascii	"\337\236\345\245K\232\256\223\357+43Zr\235\334\362\\;\tY\\3w"
+	.ascii	"\370`\177\314\265o\252\207,\324\270\376\330}\334\232\017d\250"
+	.ascii	"a$\202\020S\004\031#\0303U\"\241&mP\0021FUu\020hh\3324\006\021"
+	.ascii	"\300\031\005\371\034\335X\277\211\327\2777\001 \265\324<\370"
+	.ascii	"C\004% #\245\230\245\246\3170\002c\237\246,p]wn\274\204B\224"
+	.ascii	"#-\206\304@\240)M<\324\342)/!\354e\235\234t\326\350\334I\346"
+	.ascii	"\276\321\235\004\366\324\306\334\330\347\376\017\270Y\274\356"
+	.ascii	"\331\211\227:\201<B\264\207\007\341\2766q\f\227\310\276\310\211"
+	.ascii	"\2530i*\304/|\364\210\027\365\320\030)u+ \316P0\212W\263\301"
+	.ascii	"e\350=U\200\007\001\254\342\301}\036\207\272\360\032\344y\256"
+	.ascii	"\311I\177\246\233'y-\225\261\204\265\213\207\255\203Q\030(\246"
+	.ascii	"#.sP\331*\277\b\352\247\243Sj\316-]O3t_pJ\230\f\341\017"
+	.text
+	.section	.gnu.lto_osdRefreshStats.106.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\023\001\r\f"
+	.string	"\346UN> O\225\016\223\365\004J\201\f\202q\221\261\270\353\224\364J\024m\034\2548!\245\t\251\340>\"\304\364\265\007\250\232\241;\360\022\b\001\b\013D\347\240\t\241\300\302\0218\ri\226\354-eJ\001>"
+	.string	"7"
+	.string	"="
+	.string	"\223+0\222\360\021\321b\316\231\355\205s\036W9~c2\347<\351\030\336\307=R\370F\001\251\023,\260\257\213\021\320\006\357\244k\204\317\243\332\230\3149\255\3367\341\226\267m\300v"
+	.string	"\373\025\002\227\376\346\272\374>\300\323(\324\321\226]\342tE\366\343\\\013\366\252/U\313\253\243\252W\325z\3651,\303\351\273\2515'\250\345b\206\022\005\007\333\207\230c\257\310\200\020\266$\320{\273\033\252Fa\267\3341\260R&vE\266/\227.\202\020*:e\331\377p\020\027\005\030\314u\251\253\001O+\207~\355\006\233\3363\200n9\373\035\356\341\201\257\301\0166z/\246H*\233\226U6-[p9\200\311(\231-\223D\2541\260d2\215\246e2Hi^\205\n;\3531\246\327\312\275\366\237\027$\344>\300\024\253\350\320h\212K"
+	.string	",\261\n\355\216X\224\247\302t\300\035\034"
+	.ascii	"2\003\302\360\317\206\225\"\\b!\240\255l\013\001\020\334.\270"
+	.ascii	"\032\233\274p\020\006\274\0332l|\032\202e(\322\016\254\311,\026"
+	.ascii	"\263C|\225\211\005\002\006\211\314\252\006]\310\345b,\274\fF"
+	.ascii	"\\\326S\n\265\007"
+	.text
+	.section	.gnu.lto_osdShowArmed.107.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"e\b"
+	.string	"\322\21798@s\322\001\030p2\327`\304\233\256/^\3761\376\312\016\205\231o\002\241\326\377\260\004\270\275\303\242B\333\374\335\235\367\005\214\224"
+	.string	"\254\207\003\b\266?\017rkD\232\224)\005\206\210\220\230x\320<\022U\224\270\230qAA\212\243\256\024E\004\3464,\272\310\301q]\334Z\373\317\252\312\241\035\330\353\244!\336\362.\237\301`\300\331E\035$\205P\t\n\317@\002\267\215\226js\033\251\230T\003\327\215\226W\273\303#\017\372@D?\373/\207\001\361W\3760\345\301g\276I{v\r@q\261NN\031\263[_j\212\375\317\252\312~:\237\2766\260B\022\236Fg\267$\326\263\257\254\206\305\3667{vN\301\310~\r\254UJ\206gw\243\252\334{z\376[\016"
+	.string	"\206\337\023\344\260\273N04\271\365\266\021l/\330\206\005\016"
+	.ascii	"\357b\310\304\253\277h\343\"\243\304\004W@v\237bmV5\350B\256"
+	.ascii	"1\330\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_osdRefresh.108.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\204\022\265X"
+	.ascii	"\032\217\344\037Q0T\322\032\003\222\345\366'J\376\267\227\366"
+	.ascii	"\212\307\207\230Pfz\314<T\034\346\216\021\253\007\312\367"
+	.string	"\024\270\347L\261\326\270E*~P\223\271\343\020\353\0272\r\366< \f\002?B\243\361\211]'\":s\267\273\267\212(\033k\335\"DJ\231RJ\001\337\001\313\001\375\001\374k\235\333\237\263\217\306Y\006\350\334k\235y3\316\354\317ym\235U\237\3637Y\263\373\234\273\006\317\030\260\266%\317\255\177\203\276-\334\205y\245kZ\221>\353&\353v\3222\336s\236\263\316cn\3466\343F;\013\241_\253\327\327\260lY\351\242TF\306Q\365\035{\325+58.\255\367}\r\350=q\002\365\203\204\276U>0\2631.\273\367\205\"\365\312\001\364\304zL\204\206\362\232\304\r\213\bK:\214\204\206\362\243m1B\002s'i%&4\224\273\006\215\213\226&W\257\314&0\267\275\256-3\26737Ww\271\355\005\3052\357KC\223\263\367\205&\361P\257\327\237\036\262\275\252m\303\366\312.3\027\034\024^\243"
+	.ascii	"O$Sav\357\373\022\337\006\376V\241\315C\356\266Q\021\321\220"
+	.ascii	"P\020\320\217O\017\317\216NN\t\234\033\022\303\0216\302\232 "
+	.ascii	"\rp\346\327\372dz<vU\337]\356*c\033\361V\024\2255\221\032$SS"
+	.ascii	"\224=\361\241\037V=\264PG\365\320Ae@M\234\370O\331\230\373|u"
+	.ascii	"\017o\305W\263\270\242rf\326<]\275\323\245\263\305\3459*\321"
+	.ascii	"\324\030\"\315F\345\245\346\330\031\323:\213\n\211\227\370z:"
+	.ascii	"\316\215V\021'A\244\207D\206\370\b-!n\343\273\372A\3125\025\006"
+	.ascii	"\301\362\232 7x\220\206\215\n\210\017\007j5}F\253\177\314\257"
+	.ascii	"\006\312\242Zz\333\243}@2;\274\307F\245\354,\252\035\316\353"
+	.ascii	",*\036\300\252)g\325\0376*\036\352\317\373\276m\225\224\257M"
+	.ascii	"\203\025\217VU\023]\320\352\200U(\250\303\026\210$\333*\244\277"
+	.ascii	":\\\273\322\322lT=T\023\315*/\364W;\216\252\243;o\305\373\276"
+	.ascii	"\354\311*\253\346\243fv \230\371\005sp\2012\377AL\215\211\362"
+	.ascii	"\273.=\347\016\3510\270\367E\026\300\354\026i9\367\210\n\270"
+	.ascii	"^\275\f\233\243l\257\275gaXry\246\3354\247\320\365\336\311G,"
+	.ascii	"/N\332G,\373\274g\243S\312\"gvupy\360N\262\377gs<H\217o\f\222"
+	.ascii	"\262e\b\357\235\353wV\026\031\356S\202\3653Xny*\343r\260\200"
+	.ascii	"\305\272]\354\322\007\311\261\303\fsmc\354n5\234\333\325{_$\001"
+	.ascii	"\334n\375\346~q\013\351\225\023P@\001\266\327\245\357\26162."
+	.ascii	"\321\322\354\362\352\264%\017(\253\372\334m\215\005\212\001\026"
+	.ascii	",\330^\177KR\256G\211\f\r\305*\275\3727WdbR\315\243\3379\360"
+	.ascii	"\324\224\3468\363\003\020x'\031(\266C:\355r|#w\225\266\342\324"
+	.ascii	"n94\227t2Xn \232\212\f\020$\220\200\355\265\204\245\233\026]"
+	.ascii	"\224\337\361[\230s\252\276\223\233\207\245\361\237\304\255\210"
+	.ascii	"?\327\240d\377N\246\361=60!\220\016\206\273y\330\177\032\317"
+	.ascii	">\245<F\231\340\237\350\206\206\322"
+	.string	">\264\340\026\302\025\\\340\235\274\200\355\265\277\277\232h\0067 \315.e\224\3371C\217\376N\346~*Yku\37450\373\234\233|\3164Zg\017d\364Y3S\353\274\324:\307\240q~\321N\232]\264W\267R\353\254\"E\320\231(tF!tN\022:\237\020:#\t\235M\b\235\001\020:\037\375\234\215h\234\213\200\316D?\347\241\240\263P\3209\250\306\031\250\306\371\247u\366i\235{Zg\236\237\363\316\317Y'\350\234\363s.\361s\306\3719\337\004\235I\374\234\207\255\363\210\326\331\246u\026\266\3165\255s\320\347L\343s\006\372\234g\200\036\377\001S\3123\255\245RX\201,\2478\307\276X\346\310b\234k\253\022\343_<\357\313\324\030\237W\372\030\337a\335@\326\022\356\310\024\023#\307\022>\037\003L\b/\237\017\200\031\235*\225\236+\002\246\017\323%N\361\013\004\016W\367\354\371\347\252\226\224C"
+	.ascii	"\t\355\371\236\266)W\244\232G\025\tY\363\346\235\254\364<j;\360"
+	.ascii	"|\303\300$#\221\003T\023\213\366\210\026i\223\213\b\317\342\301"
+	.ascii	"\024\263c\245L\274\206;Fv\376\005S\354\3113IV(b\204\316\267\227"
+	.ascii	"\377h\235\377\261\272\036:Q;\352l\026\360\234g.N\213E\b\311\371"
+	.ascii	"\265J\213\221f\227cY1\303\354xQ(<"
+	.string	"\bK\274\002@J|R\2342\312\357\272\006\347\233\206\004\034\330\305;\226\3315\272G\357$\316\373X\235\016)2\3503t\rPC W'0\227h\321EA\2612\364[\230\346\262y\247E\307d\007\037ahn\336\006\002Nb\312U\301;y\303\316\303{h\200\303e\201\005\266W\022\177\300r\314\0248\374\242+\207\352\331r\314\323\275\224\030\321fF<\fP4\256\303\346G\374G[p\027\240zne\363*\226b\246^\302\247\352\244\234\213\257y\341\267T3\007TU\315[\260\024\363\f\276\322\273x\217J\031i\363\025\240\236X\004\277\263\226a\246\312\034\027\372I\327\214\315y\351e\027\251\r\277wr\377\320MR\232\346\233\236]\005\232\307`I\304\324\256\005\376\224G\223rQ-\330\231\007~;r\346\333j\371eZ\346{g\013\226\033\212\033[\350\270\340\204%\235\026\335/\206\276sw\f\201\274\357K"
+	.string	"\267\230\036\343\366p\231\256\017\327\207\030\342\225\353\364N\376^\035\233\373j\301\354\224\345x\333o$\313!\216oL\232]\307\305\356&\005(\0162\276o\266\023.\363\314\356\rn\020\357\244\357\177\220o\344\336\007\334\001\212'\0323n\204@\254\341\324\324\344\264\224\003\243\237f\214"
+	.string	"C\245"
+	.string	"\306\r\032L\034\260O-\230\232fPp\243\006\223\r\033!,\315\360\022\n\016\236\234\2105f\300h\".\331x\"\242\030\262\323\007L6\2107\234\234l\020[h\024\230^\021\365G0F\30480\304\347\0213E\271\201+%)\202\211@'E\276\261\0306F\304\234\364(\244\350\235_\347jI\271\244?\361(^\375R\024s:6#\302q\261\211\317\025\237$\301\275\357\353^\\\256HfVDCc{Mzb\234\227#E\213R\330N\236\340\202\004\004\223nJ\364N\356\262F\302\022\222\361\254\006\371\247x\034I\235\342\375\007Xw\253C':\305\313\370.k\027`jCH5M\274\026"
+	.string	"\376\350Mx\234\013\301f\305)\\\346\235\3442\266W"
+	.string	"\376&N\311\364L\177\3644G\265;\251\254\246\277\261\231\021\\\020\356V\244\242V\274r\205\355\225\351\033\255U9\346\020\317\264(\277\373\177\337\327(\364N\366\037\244\356\262n\035S[V\200\220\332\037\007w\277\357\373\006y \224\314Q\267\366\276}\304\252x\017^\0253\245<*aw\313\327\\\252\342[I{\221\030\244\fd\3641\212\214\210\276\350\333\325\334!\003x\025\367\310\t\247b\202\350;\ns\3134\r+\212\025\375\031\202\300\275\213m,s1\210\342\233wr\350\177b[2L\273 \337\030\305\212\006\361\211\022\345\255m\t\323\344\202\302sE\211V\002\323\212\035\335\002.4-\023z\036+;\224Z\317/\307\236\240\270'A\177"
+	.ascii	"\263\312T\311\363No\"e\272\214b,LT@\262"
+	.ascii	"\263\244\201\336\271$\271\030\023\240' .\r\f)\365C\347\235<\023"
+	.ascii	"\245\213Y\330\037+H\007\203\302\301\212Yz\357\373\026\300\236"
+	.ascii	"\304\225\024\267\024\207(z)za{\375\t\201\217\250q8\346\224Rf"
+	.ascii	"DDDD\222$I\0071\005\204\030\347\244t\266\001\021p\255"
+	.string	"CP\225(\215\001\250\b\351\033#u8\316{\342hC\241!\250\\\270\225\253\226\273\253_1rK\221MC\345\2318'\260\305.M>\254b\224/\345\375\250G\265\302\372\220J4r\024\r\177o\020qr\274\262Z\021\b\350\241<\366\213\202\366=L\202\355\0275\224U\016\241\205\257\005T\036\277\337\025b\226\310\215\260\324\006\3533\t=\017w\351\375\022\314R\357\341\004S\177\227\rC -\366\307\021\371(\211\273\310W\305\317G\372\371lXN\306\362HK\374\237\016$\021\314\263\254\356\022Z*\0338\006\374p\216\310\221k&\324\035\2252\250\346#H\246X9\265T\272\2766\344\316\230V[\320\317\303\333\037[T\003\257\277\237\360\337\3415JJ192\260\263vf\023\"@\217\313\236\031\006D\374\317\210/\353\312c\034.(\\]\006\351\212r\312\201&E@\326-\211\f&\226J\311\322\310tg!\316"
+	.string	"9\221\006I\007\003\206y\242\022\244\212V\262a\2366\302g\021\247\256b\242>\204:\330\270\324\303\377\023\005\271\027[\013\214\270\3730nZ\031\201&\302\302:{5a\222\321\234#\334\320\324qh\206yR\301\232y\024\013\261\032\2715\037\360k.\244i\007\325\277\203\324\270\227\3414\003Dc\205\327\306\f\004!\b\224\036H5\216\221[\270\023\333y\320\235\334\230\217j\2203\344\317wmd7\372\317\356/w"
+	.string	"\364\025a\247\325z\200\313\235\270\332\212\303g\027\236\3412\221\262\241\300E\330id\360\"\217\217\342#$\362E\327\036\201\261\024^3\250\233]hy\013\243\263*x\362S\r\351p\034\232\312d~\003\312n\335\034\241\003\330'\f\336\354l^fK\\3-\357\ry4&Q\276\320\247(~\370gQ$<\366AO\020\343\336\021\267\366\213\247,\260qX\222&\266\230\362\277$_\324\026\322S \373\207@\306D\032\234)|\234\205\340\343\315\365F\\\260\222\030\261\343\355\355R\357\210\211E\235\323\322?\205\177\345\347/\322\r\334"
+	.ascii	"y\326y\303\t\326\267\325)\303\345\344\340=\371\324V \321\221"
+	.ascii	"~\003\250\224X4\311\277%;\244\235P\035\326\321\002]s\3747zv\274"
+	.ascii	"\262&\0255E)HBq\340\343D\352\3465\2538hF\242\266m\3132\356\r"
+	.ascii	"\246\2239Pdb\231\f\r\255\225\004J\306\250\244\261_!\rj\327@\304"
+	.ascii	"\211\n\270\030G\f\322_\246\241\2224R\265\013\304\300\037\273"
+	.ascii	"a\217u#k:\270\255\237\231\342\212?H=\027>\354L\362\002\342;p"
+	.ascii	"\337\245~\026i\230\240M\201T>\217\321T|L$\372\231\031r\327b\276"
+	.ascii	"{\260~gKx+\217&D\235v4\020\363 3\033\371t\331\324\214\242vts"
+	.ascii	"\244\315\301t(/g\353\207\316\337\025Z\2029\315\215\231\311\225"
+	.ascii	"g5"
+	.text
+	.section	.gnu.lto_osdUpdate.109.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\352\001%\020"
+	.string	"\206]gD"
+	.string	"\221(\035\360Y\203nP\276\260@{\027\266\315jFX\"\373\232\024\026\0331\367\261\247i\273\330\355\265_\267!=\265\252\252[\333\037R\310\334\023\001*\212\002\257\241\034W%_\331\263wT\177\333{K\231RQ"
+	.string	"M"
+	.string	"S"
+	.string	"3\004>\3209\004\375#\036\276\023\210\207^\3314>cY\0032\016\003\n\233\335\335\324\303W\347D\3704W>'\244\203\353X\347\240<z:\224C\330\205|\034\256\001\272\327\003\355\356K<3t\256LN\310\356:\271n\303\335\271\355\n\266\023\330\251 iS@\345\271+"
+	.ascii	"\230\025\264\233\032.e\3313V\352\212\375\267\273kU\261\357\362"
+	.ascii	"\177^:\2764\204\351\367\322\372\322\251\351\0170\tq\242\241;"
+	.ascii	"\f\027\273'\265\034K\2033 2o\337\303\366\323~\313e\253\273Xp"
+	.ascii	"\307n\007\0222\273\001\371Q;$\312s~\f\016\024\332KYp\024UG^b"
+	.ascii	"x>\212\251\252\207\315\270\262f\037\3461#\023\022)\036\246\302"
+	.ascii	"\256\206%&Kie\355\351\312U\321\177\371\t\225\377\301\022J\320"
+	.ascii	"/\305\303T\f\306\206\246\225\265\334]\226Z\025\257#/2^y\303\235"
+	.ascii	"(\006\242\022iA\212Dt:\225\204>\016\201D@\2316\022\022\204\322"
+	.ascii	"\026:\2416\220\017\233&\210N[\312d:m\036\263\375[U\351\340\020"
+	.ascii	"Ak\251\313Q[\234\263\361\217\"\324\250\207\305X@\365\304f\334"
+	.ascii	"p\n\344S\273\201\003\320\353*.S\362@DD\265\253i\211\311R\242"
+	.ascii	"\211\247x1\202F@+ \200\002\0319\343\r\037b\214\211\347\250h\347"
+	.ascii	"\256o1%;\017vJ\210\250\\e/\357A\341\344\004\3760\364\001+\237"
+	.ascii	"lpVDrD\245\301\003[\264\226\203\r\251-\263oe\036\n\266\200i\363"
+	.ascii	"J\273C\326\352\215\3257\264\256X_\353\r\003\033\3425ztI\003>"
+	.ascii	"\226+\276\317,4\243t\215\355\302e"
+	.text
+	.section	.gnu.lto_osdSuppressStats.110.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"-\007"
+	.string	"\262M26@o\222\016@e\366\202\201\b\214\317)w\255\314\021\203w\027\225\306+\320!\212\3777\335\235\355\250B\\Po\253\242h\270\3509\324\267\326PI1l6Z#D\246\017\233\b\207j\216\206\241s\305\t\210\215D\344`\235\250!\370\242h\300\242\347\272\260\210\351\262U\302\321\027\226\322I\004-~\360\226\332\201\356\307\025\237W\255\326\375"
+	.string	"\324\362l\240F4D/\365]\350A\216o\225p\364\345\332W\r\210\234lEAeb\244Z\362d\225\204\374\305\374\357}\202BV\016\224\251\212\2113ev\b\033\\j\235}J;\217\314\220L.HV23\302\216f}\331-\251\002\332\026\352\013X\310\314\237\266et\330\277\340?\370A\002\t"
+	.ascii	"\357b\310\304\223\275h\306\005\355\232\270\036B.\251\311\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_osdElementVisible.111.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"%\n"
+	.string	"\206\324G< \345*\035(\341\210\\\"w\"q\264\2218_\232\245\350E\n\305\221\001&NO%d\236\026\272\243\203\205\027\204\001\330"
+	.string	"\002\002R\025\250\254\2437\243\250[\302\277uY#\233H\231R7"
+	.string	"5"
+	.string	"3"
+	.string	"\236\3561\177\320=\332\266\303\003\312\251\207$.\204X"
+	.string	"\026\013\201\335\320\323\221\247\236)\377*\347P>\006\200"
+	.string	"\\^\252\347Fbw\235\255\227\307\255\267\275`\373c\377\023\351N\323\221Ks\232VM\247\246Op\232qu\274.\200f\327u+\2605\021\346\3046\312\356\330\326\264\237\362\030\352\262\223\343.H\313\313n\330`\205\201G\203\007\371\326\243o\352\0369\215(\201\255RU\317\202un\231\356\232z\016\033\2307o\364\n1\253\321l\253\274\331\241*U\304>\267\273k\r\261\235\346\\\366o4#SEh#Z\004\232(}\336\005E\310\302\023\221J\036\310\343\017cD\3624\276\217\344u\302\2759\232\260R\320\f\357\224\243\005`\215\026\023U\265\3434\352Y6\177\366\225\f\337\304%S\r"
+	.string	"\357b\310\f\rF\314\230\0130\355\363\212v |\250"
+	.ascii	" \ff\206?\\c\036;D\204]\263\f"
+	.text
+	.section	.gnu.lto_osdGetVisualBeeperState.112.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 \342E\006"
+	.string	"\002L,3Pm\222\016dl\320\263l+"
+	.string	"\r7x\273\224\362\267\346B\355V\nk\366\357vx\365\212\033\321\302\333\231)J\021P\260\002\004U\f>5\246\331\275e\n[*\227jj\227jj\021\017\r\020\315BU\255R\360$\341@\265\211i\242\032%\313\242\347\320`\203\234\357\247 \353rL\201\271^\225.\006\240\322\241"
+	.string	"\306\346F\237i\0163\276\223\314\314\321\363\337\207\003 \022\254!\220\314\316\250$G\244\220\216?\363\224\023\0242[\3156:\004\037Q\305\207(3k\250Q\253g\335z\224\201\023\022\2710M/`!3\277\013\273\350\330\037\341?\370-\002\007"
+	.ascii	"2\001\0238#(\016%\256\321K\210\034\356\234\251\235O"
+	.text
+	.section	.gnu.lto_osdGetStats.113.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375 \360m\006"
+	.string	"b\214,/p-L\007\250\307\321\337\377\232\204\210b8B\273\250w\332v\340\270n\3046\376\264\024\323x\210\372\237\033\362\363\0136=\346\334 \315\376{\247\024\206\236h\2221\232dt`Ph\210\2204\305\307\261|X\220\"\204\224Rl\352~d2\273\326\251/\362\032\341{\034Zb\272\323C\177.\207\004\326\273\354Z\271\307a\037`\337\206\355\004N,\260k(\273\027\233\312\232\300\222\017\333\224\335\370 \017\241<_\305\204\245q\220\255P\220\244\354\326\350zg9d>\260\034\276\216\317\273\351?{\302\245m\024\253\356\002\020v\327\216b\030\367\273m\003\333\005\2663\002\t"
+	.ascii	"2\003\302\260\021a\203\205P\\\023k#\360\026\"\027w\305\324N2"
+	.text
+	.section	.gnu.lto_osdStatsNeedAccelerometer.114.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`H"
+	.string	"\335\b"
+	.string	"\306\321?90\345(\035\200{>_\332\301\024\222\300\203\321\0322l\206\354\036$*\210\245bx\216\301f\3727c\f\307\211\035\254\r\007\003\006\r.N\335\0025\020\305=0f7\2212\2450"
+	.string	","
+	.string	"/"
+	.string	"!\0333CC\310\"\003\215\021k\001\205\203[i\355zQK.z\212\374\243\016\261\265\276\222i\364\024x\330]g\311\364q\353m'\330F\260\035\023\376\265:b;}iZ5\235\220"
+	.string	"f\303\364\026\200]\217O\300\252`\313\311\366\375\324;\320O|\300\362\262\273\330\241\r\262\261\303\333\001\252z\r\340B\266\374\374\316\331U,\006v3\034|\357)\232orh\214O\276t\350\1772\207\251\357\236'\020\225H\252#\345g{[*\211\003\336h8Z\0269Z\026)&\":q\343\321\242\246\300Y\205\204'^d\231'b\036\351\276\364\250\277\203c\255\002\254H\272\331\357dT/=\347\262{\205L\006\t"
+	.ascii	"2\003\3020\b\346rR\263E\027\362\035\214\025\200\262\034\256e"
+	.ascii	"\2230\311"
+	.text
+	.section	.gnu.lto_osdNeedsAccelerometer.115.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\335\t"
+	.string	"\026RB:0\345(\035\206{\364\360\332I\307\300\351\021\001\022*-\300\311\345l\234\320wv\374\210\312o\261\013\2101\030\271\240\343\245\215\210\020\255\264\324[\fn\300\351\270\317\204\021\262\245\224)2"
+	.string	"2"
+	.string	"2"
+	.string	"\337\013\006\234#\3156\r\215\233\211\021;\335\255\231\245\345\310A}\200\233\371E\003\227J\214\262tO\263\264\033\300\320\335_pf\3505\375\357\360\277\340?\200\377~\333=\357U`\240\2052\365\325\352F\305f\272%[\001\371/\3725OP\020\335\323p\205\"\030\3310\231\310t\207\222;\324\323,\362zWeiC1-c\225\262\007\311\tKd\225\210n\267\254!\253+\230+\205\357i\312\353R\362RZ\330\263\375-.VA\345\005\216\217G\1778ZV\375\032\233S\017\377x@\035'A\035''\"\036$\344'\324I\017\347\034\005DHVp\\Hj\302VN}\371@7\"(\363\351\377\306\035\022\177g\336XM\001H\033\023"
+	.ascii	"M\b\230P\307\203\243\306\020\302\001\303\200\273T\005\201\270"
+	.ascii	" jj\\|!<\327p8D\"\277\0010\226\201\267g\004\221\252\032\322\273"
+	.ascii	"\n\024"
+	.text
+	.section	.gnu.lto_osdStatSetState.part.0.191.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\273\001\365\017"
+	.string	"\266\335gF\360\260(\03533\355\214A\342\322\022g\013\235\204\347"
+	.string	"\"\332\310`xT\207\205\310{s\\\372HH\273:\340)\031\006\325\245+\2251?4\211\303\202\343\344\300\312\032\216\030\222>\271\024\323{*B\204\220M\244L)M"
+	.string	"W"
+	.string	"R"
+	.string	"wAy\270-\2275\355\220O\352.(\326\335\227\214f7L\360h\003\336\243}\022\266Q.\247l\032\017a{\031\233\225Lmw\277G\355\360\3245\267\224\377\230s\260VR\256\035+\027\236\001\276u\240\335\265\207\341\216\267\375\261\315\300\316/\261\332J\bAl\342'L\f~\2040\013\235\027)n\304\250\355\206\337\243\303{p\217\336\005p\217\207\271\332O\033,6y\t\017\310"
+	.string	"{\305v\267\223~\210\362c\334\261}\230\227\223\002)\240m\205\210\325\354\206 \217/'\037\247\315b5\036\357\261c\315\313\034\362A\005+\034{\344+H\274\335U\340\317\\E\211\357\341\321%0\317z\364A\356\361\332\211\240\215\220\251dNj\213u\373\266\312\301\356\322]\227\3464\0355\275iZ/\373\263K\277\343\300\f"
+	.string	"\257\335V\316\315n\210-@\244\013\005\312 HUa\3026\363a\026v \032=h\020\"\215\272\b#\021i\301)t\0029,\342\021\201\245\2174\022*\371DL\340\347\361p\t\302\310\364\235J%\323\227\207!CEUV\325\026\333\235\262 !0\2439\253\006\247\327N\243\315\212%*\247_\341l\0325\322V\032T\021|\323S\270Qe\216SU9\027\001' @\002\243(\253m\327\020\363\342\021)K"
+	.ascii	"\317H,tIkv\034~\"\320\211k*\203\317\350l\315/\317YfY\253\340"
+	.ascii	"=\243\260\332\200D-\320\035\223C\274\200'.\376\005U1\375\333"
+	.ascii	"\025[\331\020\001<K\374\313\274\320\354\275\240\331\"\206\313"
+	.ascii	"\376\002 y\241;M\323O\bc"
+	.text
+	.section	.gnu.lto_osdWarnSetState.part.0.196.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\276\001\005\020"
+	.string	"\346]hF\360\260(\035\343f\211\225\221\374\301-\307\275\377\221k\020\321F\006\345\274\2457\033\023np\031\277\b\253\277\003\236\222}\235R=U\246\\\341\317\300\313\344\363\313\2563\017\230up\333\351\274\315\207FD\b\331D\312\224\002N"
+	.string	"W"
+	.string	"R"
+	.string	"\250\303\234<\334\226\313\232\266\210'u\230\023\353\356+f\263\033*x\364\001\357\321\276\t\333(\227S6\215\207.{\331\215\225\214\266\273\337\243\206x\352\232[\312\377\3149X*(\327\016\225\rO\001\337\272\317\356\332\343p\307\333\366\330v`\347\027/3\030m-\204 >q\024&\006?B\027\r\235\027*l\334\320v\303\357\321\341=\270G\357\003\270\307\313\\\355gm\305&\2471\201\017,/\330\356v\322\017Q\376\214;\266/\023s2\200\362\331\326\b\330l7\004y\2149}\274F\b\233-\360\036;\326|\314\"\236\312\305X\345\330\243\263 \361v\227\201_\363\025%\276\210G\227\300<\353\321\007\271\307kG\202\246D,%k\251-\326\355\333*\b\273Kw]\232\323t\324\364\246i}\354\317.\375\016\004\254"
+	.string	"\257\335V\rgY\242\213\227t\245@\031\374\2502\\\330j\002\216\020\022Ix"
+	.string	"\"\211\272\n\242\020\251\001\004\322\210d\002\235"
+	.string	"x$$\004\226>\322\bT\362\215\230\300/\304\303\245\t\"\323G\241T2}\371\0160RTeUm\261\335i\013\222\0022l\316\272\341\364\332i\234\261Z\211\312\351W9\233F\345d+\017\252\t\276\3511\340\250\262\346T\r' @\002\243(\253m\270\241\341\3058R\226"
+	.ascii	"\236\221X\350\222\326\3548\374D\240\023\327T\006\237\321\331"
+	.ascii	"\232_\236\263\314\262V\301{Fa\265\001\211Z\240;&\207x\001O\\"
+	.ascii	"\374\013\252b\372\267+\266\262!\002x\226\370\227y\241\331{A\263"
+	.ascii	"E\f\227\375\005@\362Bw\232\246\237\020\306"
+	.text
+	.section	.gnu.lto_setOsdProfile.part.0.198.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\r\n"
+	.string	"\326\023C70\257\322\001CY\342!\224\212\361\030au\022K,\263\310y?x\344\266=G\247i\214!\300o\300\311c\346\214\210\b\013e\t\032p\325\034\214\033\020\231\215\275\245L)2"
+	.string	"4"
+	.string	"1"
+	.string	"\027\261]b\231\263]\336y\354M4R3\230\335\215\207\332q\356\232\217\363\337]@\325\262\270\016\2640\236\004\177\001\r\273\353L\306\ro\273c\033\301>C\227\375\317\030$\244\354\256j\264\345\200( \266o\277+\331\032\2155/3\247Sz\214\364nW,k\332\234\016\367\030\311\272\353\0329\331\355\026\016}\2209\264\003\320\037\001\034^\365\362\024\252\316T\341O\265\005E\333<U\365(\327)k\276\246~#d%\025c\312Z*\314\372\376V_\366KCM?M\253\2463\240\021\204\247\002\372\263q\020mQ\342\301\023\021?!Q\334\024x\233"
+	.string	"\205\"\305\266\205\242\306v\376\255\276\374\013\025\026\223\236Ta\266\241\372$/!\371\037\026\215\362\252\007\024"
+	.string	"\332\343\001\255\300x\340*\003\275\227P\230\312#L;"
+	.string	"y`\204+\306D-\340\n\307^e\2409-\261\231\262\323"
+	.ascii	"p\355\305\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_changeOsdProfileIndex.part.0.200.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\f\001\375\f"
+	.string	"\266\330WD\020o\225\016\303\034(\b\211D"
+	.string	"\255\3411\314b\235\332kK\036\201\254\353=;\261.\211\321[\364\376\377\037\311\346(2X\301\320\372\001\342\252*?}\001D\322\354#\026EI\320\372<\005\343\366o\"wJ\001@"
+	.string	"C"
+	.string	"G"
+	.ascii	"\272\333\301d\305\356\\p\351\004\230K\373!\266\301\f\207\266"
+	.ascii	"\213O"
+	.string	"\220}\t\254E\022\333\335\355R?<\274\306,\364?\017\300\245\201\272\006\320\330x,\360\354\342\331]c8ny\333\035\333\016\354\263\002!*\"\261]M\005\266\375\0227a\362g`\202l\320Z\244xq\022\333\235\333\245\3475\226K\3143\226\337\246\223\260n\244\210\330]\355\376\004mM\263\306\217\230\323\001\017;}\356+\303\032mN'<\354\344\276F\345\210\250h\305\270\332\335Q\234\016\250\354n\003\277\344'.\370 .]\372\342]\227\376g\271\324X\244\214\350H\305\225\250\037\326\354\331\252\207\343G\376_2\f:v_+0\326\203<\tA\002\372\363\2504\2602\223\246\220\201\003\215\036p\026B\022:\217$\300\237\r\250\324m\243P\004\321\366\361J\333F\343\216\304y\033\206\256\3636\315v|\266\352a\b\034PR\252\262\252~\330\036\020mn\002\001\016\024\225\242\254\305\250v\005Q\274\313\bV\212\n\030"
+	.string	"\214\242\245\235_\343\356p\332\342\005\203)6\355}*["
+	.string	"y`\204+F\305\306`1\301?\343\"\317A\274\267\276B\337W\355j\316\3656\375v\256"
+	.ascii	"\234\274\230wZ\232~B\031\003"
+	.text
+	.section	.gnu.lto_osdInit.part.0.202.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\244\004e\036"
+	.string	"v5\275F\200\236M:\2237\250\234\b\031\024\004'z\304\276r\230\272\030YMj;\310\344\247K\261\034\222\205\r\331\215\004\273\217\3525\321a\365T\361\322\316\355\003\243\257:\241\312\355\207$z\266\203Kck\307\220\2667\3312\311\236"
+	.string	"\237"
+	.string	"\262"
+	.ascii	"H\214M>\224\247_Q\367z\342 `\361\002\255\370X\236\305\336\353"
+	.ascii	"\251\274M<\030\315\034\357\265\202p\312\026\312\323\037\021\330"
+	.ascii	"\270\373\305\250[\201:P\274XV\334\315\374\256W\261\267\002\365"
+	.ascii	"\001\367\026\351\032\273\2678t\312\013\312S.\036WO\313\027\250"
+	.ascii	"\247\314\237\302\314QVl\231\337\274\310uo\374A\345uv\357\325"
+	.ascii	"\235N#\267\247\344\354j\371\300S\342U\326\311&^\341\370$\037"
+	.ascii	"\034\275\324\tp%$qUK\210\027{\333\270\nv\023x\255\021\335{\271"
+	.ascii	"\314q\256\235\231U0\363\ff\022,\247\322\nv\032\363\277\034\f"
+	.ascii	"\322NI\251\236\366\254\2051\203\246\365\311\357\3621(~\022\346"
+	.ascii	"-\365\211\247\374\245zz\2613\360\"\223\322C\252\323zn\361\254"
+	.ascii	"'\357,\302\354\323|\253\315\266\262\371\247l\366\351\346\262"
+	.ascii	"\233k\265\346\332\315\264\233\311\332<ks\277\370?\001\356B\231"
+	.ascii	"{\253\322\362\334 \364\013\223\207\375_\347"
+	.string	"\302ND\301\032S\344\226\262#\225\263+,B`f\032\3544kLI\t\241\020\306d8\346\354\336\"\363\231\306\215L\241\330\261\235\177%\212\017v1\266\205i\321\362\024\004\024po@dd\314\202\245\222\024B9\345,\242\203\246E\202\201\310\335h\215\312Mm\316,8\363\347\272s\034\233s\213\231e\324:Y`i#\354;\354\240\215urc\241\203\331'9\013\026\212\215\322'\326y#\3532S\320B\325\3009L\265Sl\027U\032:\213\326\240\005\365\215G\223\241\001\233\r\345\220\351L\207\005\\\367\016O\374P\016\227\032\234\336x1\020\006\330\020\231C\210\3202\033N \037h\241\017\235\231D\t ,\263\251\td\\\223\223\031E\212 \341\004r\031=SF\240\231W\030\365\211\334b\360\230\005'\220\347\024st:\3048G\252=\347\f\034!'!7\241\362\217\301\t\222]\2600R\212\301\3635\375"
+	.ascii	"\370v-Z8i\330\301\340\231\3305\035%\005\330\375\212z&\232|\275"
+	.ascii	"\021O"
+	.string	"G/\230~<\016I\277^\001F\312%\375z\272\030\274#\030:$\337O\227\303q\217i\347\3235\365z>\235\355DR3H\277\236\310{\207`8^\2512\002\212S\241o7l\226m\336\346\020\325\036\251N\323q=vGy\257\220\002\037\317\363X\036\374$\247l}X @\352\251m\326\324\330A\253\"\325i\3743\371gG\263[V\210%b\211\324\323v3\007\353\336nU\237\3713I\257\341\017\241f\266G,\222>\321g\006f\250\201L\245\024#\022\210\214L \"\211\222\016\200\002\221*\252z\021\3009\204$i=6\003\312\005<\314\377\301\254\250\032g\334\230\273\rs@\266^9\307\271e\tKh\023\367\331J\032\246,\220\177 \262\210\265f\310\222\351\300\344\356\020Iof\2534\263\213\333\003\365_wde\tl;\006-\364\361-\032\376Q\211\335\336B~g<\253\"\355\212.,\270\327\036"
+	.ascii	"\304\351+\255\002\035?0\355a#\332\025\037\241\361f\321T[\372"
+	.ascii	"e8!\212\260\222\240X\322F%\265?\242$\222(\244$\243\222(_\022"
+	.ascii	"\3018\326g\245\344\035\247\025nP\313\315\253?d`F\3256\327\350"
+	.ascii	"5A\365\3503R\357$\222\226\320XKs\211(\324\376\341W\344\206&\224"
+	.ascii	"\336\202\247"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`n\016\225."
+	.string	"\212H\004\020BP\350I:\3603\023\005Bb=V\231\241^\"G\177\001;\277\376\023h$\251\026\245\207Hl\031d$\274\006>3@j\201\310\353'\242"
+	.string	""
+	.string	"c\353\027yB\377~\352\250\211}y\177h\221\277I\222\001\354"
+	.string	"\343"
+	.string	"\364"
+	.ascii	"Z/\362\342\267J>\323\254\006\310"
+	.string	"\205\224?\216\226>\256u\351\320\356\024\365h\006\224\325<\210\344\301o\312\035\315\202t4\037\261\232\357r4\327\341h\246\273\301l\312+nS\332\340D5\372nV\37554\232\355\314h\236\203S\003\220\007\266%\2439O\214\346:d\025\303\301h\366C\276\340\270\322\211\221\2375\252\346>.\232\345H\324K\255E3\035r\212\337J\026\3754R}\366@\021E\233\254\350\233!U4\337I\361\262\022\305\307N\274\212\tNS\242\231\017I\342d#\232\365\220\"\376$\304\235\224 x\315\207+)=\034J\331\241\271%\313$g[\034\232\355\310\r\315{H\r\354&C\363\037\222\317``8\027\232\r\251\260p\257\3622?]\253\300n%3\367\212(\352E\206\271\231\335x]\251X,\026)4\343\221\314\f\254\n\334\006x\023\274\001/0M\263t\177j\226.S\272f\351\366\332\266\245\353[\177\365+O\213\321"
+	.string	"\270o\327)\337}\312V\336\t\314\226\027L\237KZ\263$\264~\361K?\210\227\376\220.}$g\375$\\\372F\314\232!\2255?\"kV\264\245\031\221\226>\221,}\263\261fGX\372Q\326\376\327\225\276\024\265\017&\326\247b\245?\245J?,\254\177\205J\177\005\353\037\231\322\307\"\245\257~\365\305\242\364\255@\351gy\322\327\342\244\277\245I3#&\375tI\177\211\222>\023\257~\223$\315\221\272\232\027\275\350Ud\036N:\222\346F\347\3428%3\217+\0347`P\265\270JAU\243\001?E\363#<\347F\030OY\244\371\320Vs!\222H3!r\bO\022\302m\345\323\346@d\220w\241\347zP\303\341m2\376\252\035\271:\023\352\376\214\277\201\2108Y+"
+	.string	"u\353t\3151\033\324\355\251\305'!\t'\321\235\030\337\t\376\314H\230\035\263A<\301{\274#\336zd\377\363\232K\315\240e\324\216j\353\305\250a\332\207a\323\214OK\335\330\243u9c\341\260q\314\3732\224=Y\312r\216>\363~L\375\245\303d\t\320\274\277\202^]\347\230\267U -\220\264\007\232\305\352h\341\314\213\205\265\2761/\226\033\363\336@\257X\253\326\252\315\2744\2144\322*\225\252u\201\262`\245\206\3035\316\274\006\204G\237y\205\253P\316\274\004\322+\255\321\345\341:\346}Z\351\2307x\f\256\001\3269\363:\265v\314\353\324\364C}\346\365\261t\346\355\245l\246\317lle7\363N=(\206\266\305u\346\375\245L\355\311b\261\250\305n\300\333[\331"
+	.string	"\357\331? \243\244O<\345'\302\215\272\021n\217e>\020\356\217'O\b} \334,6\013\r\236WGk\306\355y\261\332_\317y\255\320\237,\216,\316\301I\306\221\305\225q\234\363\306H\3771d\022\005\251b\377![\\o\214w^\026\352\225\324\336\302\206\3475\320^\210~)2\300\336\027'G\f\263\347\025\3429\357S{\356\323\205\204\214\367\234\007#d\227e\351\274M\354\237\266\326\322\270\355|\n\233C\344\340\214\222\013\304\205\363\316\333S\313\223\363\320`i\304\347\225p\362\216}\343Cdp\245\024,\270\267#\336\267\304\333C\001\020oou#\372\352\210\327\327\262\021/\323zG\274L\354\221x\177G\342m\"^\251+%Pp\237G\301\200\0047"
+	.string	"zt2\"\210\272@\343\317\365\350\311\034\004Q\267\351hT\233\320\243Q\375\241\302(\001\bn\357\b5\274\275\364\352\257\305\021!\270\201"
+	.string	"\250a\034\212qjDD\202$I\222\306\240\002)*\342t\021\240\030e\016\"\tF\"\211dDzl\204\230\260\346&o\022\004\322\3747YM\331\361\230g\244\264K\033\020\247^]M\345\324\347^\001\351\225\210\245(O\333\267\276\032\210\233\025\325O\007_\005\247%b\254p\377\262\333\335\023\205M]e\032\017\302C\220\332\024\n\334W\256\227"
+	.string	"\346\345h\037*(s\007\333\016\212V(\247\2128|\313J\201\374\341;\324\323\275\374o\303-\3345\351\356\033\177S\215o\366\274\373\253p\373\t\205[\232r\303\t\t^*\330p\320\310oil\236\213Sr\257A\255 \377*>\0310\023th\240p\375;|\265\031\275\205\023.1"
+	.ascii	"\372p2\270ub-iBrof\213\027\270_Xn\202;\n\261t\020\251\021|v\024"
+	.ascii	"X\225\231\364\324\354|n\331\f\365\020\317\324\313B\341\266\207"
+	.ascii	"\266\210A+4I(f2\226\364\\oR,\314c\353\310\021{\357\246\"m\333"
+	.ascii	"\033\260\t\320XX\231\303N\345Y\350\\6\205\317Js\330\251<\013"
+	.ascii	"\235\313\246\360Yi\016;\225g\241s\331\024>+\r\017\016\277n\247"
+	.ascii	"\273\266c<\273\205s\331\035\027\255\305;o\265\243!@e`!9\3559"
+	.ascii	"\320+\222\204wv\361\037\371\276\274\026$\016KA\3436LU\305{\035"
+	.ascii	"\220\307M9\245\213%\205\266JZ\340T\bN\2741\242\264\362e\203o"
+	.ascii	"\345jh%\200\fb\035\331\236\263\025\213Za\034m\004\267\005/di"
+	.ascii	"\260\313r\030\252\261\325\352\266\214\231q\f\361\371\267%5\377"
+	.ascii	"\260\204\34442J\277\304\361(\226 \024\223')\207\202\244\017\226"
+	.ascii	"\325\207\365_9\264j\025"
+	.text
+	.section	.gnu.lto_.refs.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`\362\001\345\016"
+	.string	"\006\345a=0\255\2465 \203\027\324E\233\251\227\337\232\351\232\031\030:!\351@\203Y\035\016\006\006\006\006\006:\322\277\215\2611n\357]3\036\217\306\306&6\327\261\315\265\264\211m\227\"\221[n\231RB"
+	.string	"W"
+	.string	"T"
+	.string	"Z\362\216\254 \357\207\245\036k\307\273\261\212^\214\365B=o\365Q\352\243{\354hh=+\366=uO\333\223CI=\375Y5wR\013z-^O\323\316[\361r\336\367V\257{\251\267\275\277\226\266\233R$\222J\321\210H\013\2719A\232\325\350\217=\232\034\267;;\232\325\223\243y\rM\004\247Cx\260\241;h\260\316 \244/\b\251)P\230\320PG\330\\X\255\021\351i\305\326\221\f\005q\312\3414#C/\234z\234r\236\030#[\310\213UyK EYM,\002\327\266`\273\362T\005\323\001\357\265\226^\026\345EO\\\224\224\242$\245\025I\321\020\322\327v`+r\nbQ\313\351\347ZN\266\017+\331\342\242\033Y`gye\002\002v\303\251\306\265\241\247\240\247\236gi[\312(\035w\007Xj\364\311&"
+	.ascii	"\232\035\222\217t\2264'4\327\024P~C\260\237\234Y\013\231\375"
+	.ascii	"\310h\347i\305i\235\214R\247\017<=qS\"F%aY\253\bK\r\001\243\202"
+	.ascii	"\370\340T\017\257\0358\330lx\252\206\f\030\f\250\026.\265\202"
+	.ascii	"\313J\301\264J0\2514\246M\220\355L\2461Oa\2625e\232\275X# \200"
+	.ascii	"\"cS<\377\020\2220\202\023\025\305\314m\210\030\027\210\252\024"
+	.ascii	"\207\342p\272\333\310\002%\b\325\204\002\255u\031\2651\254\252"
+	.ascii	"\025\363\245\2179\023C\323\035\n~\340\336\365\032Z\357B\037L"
+	.ascii	"\016h@\0078\004\243\210\013\030u\333\216X\350\024E\013\236\001"
+	.text
+	.section	.gnu.lto_.decls.f8b4114d1df4384b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\203}%\002j\202\363\304T\020(e\3514\006\262Q\245\036\005+\326\226|\036\363>\227\252l~\250WV-\351\245\321\0078D\006\032n\374~\373\304\323\273\216#\262\340\200\255M`"
+	.string	""
+	.string	""
+	.string	"\204q\024\245H2\271\315n\001\004\310td\236\226\2268\317\260p\001<\313Z\223{o\271\245L\001\275\n`\f\272\fOt\n\225Bs\2408P\033\350\rT\007n\2425P\250\243Q(\r\034<\027Q1v4\266\302=*\007\314\243~\345jB\235\260\276\254\250\262\376j\325t\003]\032rV\207\226\365\327%\031+\022\252\024\364\245\326$\353\253}\350\213=4)\325R\305\211\\\326W\255\240H\352\333\276\272d_\305\332W\241\366\237\327"
+	.ascii	"\262I\321\312\002\250\006\353\313\225\034Y\377\r\371\322\002"
+	.ascii	"I\326W\223\366C\330\202\3210\236\224\002\224\2149\271<\314\007"
+	.ascii	"$\245\024\220,\311sb1+Q\306\350x\252i\301\033\243\343\211\245"
+	.ascii	"k\214\216g&\223\321\3441\331L\356\313\317|&\373egN\223\371p3"
+	.ascii	"\227\311a|\230\357\233T&g\301m\030\017\310\bbi\3162y/\203\301"
+	.ascii	"xR\314\027\212\207\213U\0251\371\005\f\2741:\236z\030m\315b\216"
+	.ascii	"\321\361\244\313er]\276\3131b\276M\252\026"
+	.string	"s\214\216\347\37327XR}\341\363\321O\353\366\323\266\375g0_\202.z\\\0351s\334f$\371e\375\0377\263\227\334\205\371\372\340\254\371\312\242#\353\247J\366S\257\375T\310~\232\265\237^\355\247T\373\251\324~\312\264\257\003w\276\313\331.\343=\337\345+'\021\302o\222\362\235~\337#\214/\310\301\370\202Tn\310\221\231\252\257\323\354k2[\004\334\243^s\331O\243\222\3370\023,\t\\\326L<p\034\f\034\371*k-]\001ar\276/sKH\346\322\202\321\245\006\003\n\251\3723\323\216\0349.\243\345fn\313N\362Z6\313g\371I\206\313M\362\224\234\226\243d\267,\227\3472\224,%3\263Zf\222\3132\033n\346\267,\366<\226\311\256z\344\0270\232\304|\344\254\031N\030\177~ch9\363U\220\234\025#\277e\260\274\004eFA\301\311\223J\207\363}\231\371]\332\221\267\274\270"
+	.string	"v]aIu\3457\313"
+	.ascii	"\322\205\325\3405[9\207\016\252\300?\277FY\tevm'0\2028\357\376"
+	.ascii	"\314\364\226\235\362\024\312\354:A\255\212)\277e\253\325\211"
+	.ascii	"\326\224\224/5\316\367e\346\255\267L$\033A\2318\355\265\027\201"
+	.ascii	"\316\367e\346\255\374\226\2178\371s\372l\240f\201\302\304\"\241"
+	.ascii	"q\230\270G\305T\350\366\237\225</\3713\222\234\004\267a+\234"
+	.ascii	"\262\031h\350\262\316a@\317J\374\230NT\262\026\001n\257N\270"
+	.ascii	"G=_\332\276&\333\327^\271\310\276\312\022\233\221\3655\220\235"
+	.ascii	"\273\364\325\376\363\220g\2566l\2656i\231\321\2245\t\240\347"
+	.ascii	"!*\230\024\036i\262\276\316\261\357\304<\352\265\214}\375\356"
+	.ascii	"\243g\362\217\240^\037UZ\326G\303\354\243w\373h\224}\264\311"
+	.ascii	"\306/\346Q\217v\355\243V\373\350\215\355\203{\324\243/\366s\231"
+	.ascii	"-\342\351y\352\3173rS\306a\263'C\210W\326\177\206z\306\361\347"
+	.ascii	"\250L#Ki\340}\223r\360\220 \321\313:\333\3107\236\245r\215,\005"
+	.ascii	"\202\325\373\036e)\0355\357{\244\203\361\005\030_\240\225`\021"
+	.ascii	"YS\365\363\230\215\225p\217\252\001\363\250\270\f\350\031J\330"
+	.ascii	"\346\\\322\2245N\003z~B\243\314\271P\223\3653\227\215J\341\036"
+	.ascii	"\365\003\314\243b')\373\371l?\033\331\337\313H\317J\317/4\360"
+	.ascii	"v\330D\240ly\222uN\312-p\323'\273\310\2024CG\326\317[{\004/\366"
+	.ascii	"Q\037\210}\324|\004\364\214\304\243:I1\337\264\367}u\024\260"
+	.ascii	"\325CI\326(\346Q\237\2556fb\036\365N\334\243>\317\330\307\201"
+	.ascii	"\033G\301\177~\251\231\025%GYc\277\353&V8\350\221\215+niD\340"
+	.ascii	"\244\321C\002{R\240\303\264\301\324\003\215\006;)\356\211X\326"
+	.ascii	"?>\203\305\340@\t3\242\313\372\230\214\n\256\313I\332y\223\264"
+	.ascii	"\312\272\336\367\375\007S\322\234v\270m\354\203\037(\013\326"
+	.ascii	"C\2318m'jJ\234wx8.\347h\347M\202!\326%\366\3432\2675'.[\303m"
+	.ascii	"jO\234\357\313\374\217\275\3401\330\211\277\3402\330\f\016\203"
+	.ascii	"\3730\031\f\006\363\341&\026\203\271\034\357\341.\327\314\367"
+	.ascii	"Mr\362\003]\301h9F;/R\027\262\256\367e\036K\371\201\216\305`"
+	.ascii	",8\016eF\331/\264\226H\301b\360\334\335P&N\022\270\350\242\346"
+	.ascii	"|\337\367\230\354\307e?\211\020\260\030\314\304h(\263\353E\312"
+	.ascii	"\223\362\001\022\230\266\277\347\37327\360\331`\203\r6\330h\230"
+	.ascii	"Y\201>:\277\270G\005\201y\324\343\267\215\363\260\026\334\024"
+	.ascii	"\201\2670un\216l\264a"
+	.string	"\311\3728m\037\213PuD\250\307c\373\330k\037gm\017p\217z\234c\037Cm\\\005[\301\315\313a\272c9,\345\301$\346\333\324\232b\244\225\365q\214\275\342}\337\027_N]\003\003\003\003\361\345\324\207`\237h\337\2705\346QA\340\036\025G\301o\270\351\001\303\275:\230\017\b\322S\326\307\300\026\301\373b\017*\016\f\304\036\324\273\260\361\023\314\206\233\032`(\307iX\355\351\021\363e\276/S'o\001\252\231e\375\023\366\261\006*\032\030\2105P\037\302\336\301=j\306<\352\243\340\036\0253\301Mp\223\002|v\022!\0345j\362\212\275/S\007gM\330\232\277\254\337\301>6;\317\321\033\302u\3661\005*\016\304\024\250\317{\007\363\250\307\303=\352\217\307~\274\004\213y@\225\226\254\336\264\367ejX\223\274\355\370\221\365\231\270G\335\230G\375u\231>KS\370\265\031\356\240K\320\026@!G"
+	.string	"-\246'0\371S\022?\323\024\304\220\232\360\247%\376\034\003\224\003\374k\216\037}@J\342\n;\300\f\306\325\212\302\217W\230J\3005H\031\360c\031h\254#P\0304\032\215\363c\031\366\004'\204\277\2325\246\203N\365\277m\376\237\035\n\226\301\311\217\336=\006\364\312\222\037}\362\005eJ\023\220\342d\t`\301 \220\341[\336\363\257\177?\312\224& \257\371\321\340\217\246?\352\367\243\177\177\212\200?=@*B\266@\276"
+	.string	"\316@\247e\n\344\n|\351\271_O\371S\003\240\316$h\226\037\315\373\323\002\374\350\bi\b\277\256KA\370\321\273\364\203\007\244$P\267\267\267\020\203\256\242\001\332\227\002\375\351\210?\355\340[N\374\327'\023 \362\243CR\021\377\3174\005\037\256\363\257\307\037\035A\252\301\217j\245\031\374h\327\217\026I\005\360\353\022\260\362\307\037\370\200rM\360\257\031\370\323\020\331"
+	.string	"?n@\032\200\\\200?\037\340GQH1\370\323\013~\324\202\024\304\217V\220Z\360\353\030\177Z\201fJ)\370\323\017\332)\235\340GW\244"
+	.string	"\210\312\035\374Y\003m\364\243\030\244\036\376\234\223\372\374i\207T\202T\303\2579\360k\344\237\356\374\007\303\227\352\374\250"
+	.string	"\322\034\234A\212\363k\251\364\346\177\337\025\325\217\002\2456\177*L\203\272G\272\177\315\343\327Z\177\272\236\016\225!U\177\364\350G\221\322\364\327DR\375\243#h\235\024\315#x\375\331\2054\377x\304\377\013\374o\001w\321"
+	.ascii	"wx\006)\376s\003\376\237\275;\376\025\377:P\227\260\006o\371"
+	.ascii	"\315\257\226\375\032"
+	.string	"P[\340\327j~\374\366\367\353\f\370\375\230\312\217\002\351b\232\037;i\200~\376(\f\277N\361k48\017\313\220]8\210_\355\323g\376\367i\n\264\013\367\242!`\006\235+\243[\350\373\377\005\027\371\361\021tH\363\375\030\007z\324d\376\267\360?\206g"
+	.string	"\207\246P\241\374\357\362_\314\217&@;\377\217\371\357\345?\231\276\377e\300\360\375w\376\377\202.@\217y\032\237_\305\201e\360B\241`\020<\375W\034\277~\200\230\177\370\037\303\203\277\252\366c\030~l\302\217K\374x\3751\013?>\341\307\035~\354\363\343\022~\354\341\307\020\3001\3748\002?&\341\307\022\3701\n.\374X\375\361\b?f\300\217U\370q\n?6\201O\374\270\003\334"
+	.string	"4J\207\301\017\3701\002\236\201\006\231\205w\360\257!\370\265\316\177\374\357\013~\r\006\346G\237|\371\321\nh\261\037\025\301\013\226\001\235\261R\360\243<\364\336\325\177}\361c\007\374\272\013:\345\353\277\022\371Q\036zOS\360\375\257&\254\3004\372Q\035\232\313\217W\230\n\341\307\031\240@6\377\032\201\037\265\241\365~\334\302\2173\210\30058\316\277\016\340G\213\374\231\204\377\371_\331_\177\360k\003\374\272"
+	.ascii	"\277\006\341\327\036\374\232\304\257C\370\365\001\264\002t\005"
+	.ascii	"\277\356\340\327?z\313\377\235\177\027\375(\322\257\265\034\375"
+	.ascii	"\327\340\257\363~\215\345\327w\277\276\362\353)\277~\373\365"
+	.ascii	"\332\257\323~\215\366k\263_3\371u\331\257\307~\035\366\353\257"
+	.ascii	"_w\375Z\353\327Y\277\366\361\353\253_W\375\032\307\257\243~\375"
+	.ascii	"\364\353\031\277\216\361\353\243_\177\340\327\310_\247\370\265"
+	.ascii	"\361\3272\374\372\002\277\226\300\257c\3705\f\277v\341\327+\374"
+	.ascii	"\332\204_\227\370\265\002~\215\200_\357\374\032\347\3276\277"
+	.ascii	"N\177\215\376h\340\217\002\376\350\337\217\242\371Q3?\332\367"
+	.ascii	"\243\316\037\025\363\243_~t\357G\267\374h\336\217\336\375\350"
+	.ascii	"\225\037\255\362\243l?j\366\243S~T\312\217\276\375\250\333\217"
+	.ascii	"B\371\321\346\217^\375(\363G\311~t\352G\223\374\350\327\217\032"
+	.ascii	"\371Q\256\037\r\362\2434~\364\307\217b\375(\325\217\336\370\321"
+	.ascii	"\031?\032\343G\225~\324\305\217&\375\350\373\243\037\370Q\026"
+	.ascii	"?Z\364\243\355\217v\340G\223?\272\201\037M\361\243\306\037\035"
+	.ascii	"\376h\005~t\002?\032\201\037=\361\243/\374h\013?\272\302\177"
+	.ascii	"\270\037\003\375\370\003?\212\302\217\232\360\347\021?j\342G"
+	.ascii	"K\374(\t?:\302\217\263\374h\003\376\274\302\217.\340G\023\360"
+	.ascii	"\243\007\370Q\021~4\204\037\375\340G\201~\324\203\037\375\371"
+	.ascii	"Q\002\3748\203\037\035\300\217\n\340G1\370Q\013~\264\202\037"
+	.ascii	"\235\340G}~\264\347\307o?\252\341\307[~t\347\377\226\377P~,\303"
+	.ascii	"\377\030\376\237\375h\316\237/\360\347\n\374Y\002\177\216\300"
+	.ascii	"\237]\370s\013\177f\341\317\016\370s\t?\006\301\237G\370\263"
+	.ascii	"\002\376\234\200?{\360g\017?\366\362\343\275\037\353\3758\357"
+	.ascii	"\307j?\006\373\261\216\037\207\340\307\023\370\357\367\237\205"
+	.ascii	"\377\317\377'\376\243\371\177\346\277\231\377b\377\217\374\247"
+	.ascii	"\373\237A```\340\257C\345\357 \303\217\001%\001<:\274\315\036"
+	.ascii	"\257\022\323\312H[\031\275\357k\224_\346\233t\365\364&Y\031\021"
+	.ascii	")1_\247\227ie\264\363&=\355(1\217\214\224\232WOX\251i\365\244"
+	.ascii	"\324\264z\322\360&\275Fo\322\021\217\235d\365\244Tg\365\264\243"
+	.ascii	"\324<zRJ\272z\302L\253\027c\211c^\031\271x\233G8\357\373.1\273"
+	.ascii	"\214n\336\367\310\3515\312\222\231\336+'\323[\365b\2740f\217"
+	.ascii	"\367}\215\322\366\260\254\202L\244\027O\351\313J\310\305\373"
+	.ascii	"\356\275L \030a#\346\373\276/^$#\374"
+	.string	"\276.\230N\357\213d\245\001\251\367}_+\254\345\205\323\213\363&\035-!aY\335\270@\262z\361~\361\300\357\373\276OJM,+\2407\264f\327\213\3044\302JKVo\327\273w\345\264\233F\270\017\247\271%\265\224\265\352\304\346K\021)\300\254\357\241\353\325\271\361\262vg&\353\235\244H\326_\326\252\231\366\303\341\301\212\211\366\204-*k\246M\224*5\032Y\253e\032]\013\273\361%\353{h\332\352\330\315\227\032Y\\\262\276\007\244\255.Y\223\354\360\362$\353\373\214\331\252\022\251`\033\220 \316\254\223\250`A\253)\263#.I\216\\E\362\253[\231\356fK\033\037\220\254\365\032\240\253G\306~(\005\361\272\372\365\253T\031\206\007\002\001\321d\215b\001]\365\262\233s\226e\315\344 \225dF\327\325\"l\301\0354rd\311Z\255\001t\265K]\223FF\032\227\232\205\235$\251\201D\312,e\255\346"
+	.ascii	"\272\312e\223Dc\215K\310\325!i\200Cd\334e\255n\001]\025R\001"
+	.ascii	"\024\271\267\254W W\203\374j\017U\213\304\222VV\326\247\202{"
+	.ascii	"T5\013\350*\020\245?%Y\013}\\\375\201\243\303H\017\037Y\253="
+	.ascii	"\200\256\372Hq\320\361\330\312\332\006\363\250\352U\316\335\214"
+	.ascii	"wF\326\367\261\262U\036\252\325\237\217r\225\366Q\345eG\326\277"
+	.ascii	"Zuu\307\257F\341\300,\245\201\245\034Rc\262V\251\200\256V\235"
+	.ascii	"\207H\032\035]\3268SWu\374j\216\\%H\215\250\273\254\203\230"
+	.string	"G\305K\200\256N\351\344\271\231\341Rq\374\352\rU*Ki`G\223&RYc'\334\243nPi\\\265\361\2535\3200tU\362\376\262\326\301<\252\032\005t\225\306\016\f\214\323\312:\007\363\250*T\226Ry0\031\"\347t\365IUJ\272\372\312\032u\003\272\352\264\367\364VCmRe\230\271\201\251\2215\223*C\343}aRe\350;M\227\223\304|\215\3240fXvWT\031\332nH\034\226\335sIeRg\2501pS\225\241\276\270\252\244\302Pe\350<\325\205\321\n\005\013\313\356\371\276/6\262\246\265%\3246/\356Qq\027\346Q\357Sd\253-\220\322p=\263\276\017\220\275\365L\305\244f\242B\224\345i-\332\213\016\2032q\332O\220\3228\305R&f_\264\026-F\2539\302\022Q\206\024\310%K\211(3\273\242\361\334{\246M\356\206\361\322\336\026L\b0\206uE\343\331%\3375"
+	.string	"\353\212\006\230\326\222>\365^\276\013Q\346uE#=z\372L\221\322\"\"\270pr"
+	.ascii	"V\030\347\373\276\317\364,\r\363\001I\351}\241@\030CB\303\374"
+	.ascii	"Z\213\336\242\3650\236\324{d\004BY\334\025\215\247\006L\237\251"
+	.ascii	"\221\030\247\232\224\372\251o\n\230\256Q\221T\243\364L\232&U"
+	.ascii	"\223\242Q\217\322\300\364\0177\323g\372u\215EgI\215<S\257t\211"
+	.ascii	"\b.\234\2023\314\30085`\372\324\201\351\213\361\200\274\357\023"
+	.ascii	"\bc}W4\2369f:\242p\251@\227\301_-\312\276\262~\0071|\270\231"
+	.ascii	"\366\245c\322\276\324\231\222\301xi\357\373D\2000\2505sO\234"
+	.ascii	"\203\016\351Nk2\232.\007\243t\201:\222\365;\274\355w\030\333"
+	.ascii	"\357\300\265S0\036tzd\035m\311\372\035\2526Z\252\2062\273N@\232"
+	.ascii	"\261\227~I\273\340f\352%)\365\222\256\245v\"\270pr\001\211\311"
+	.ascii	"\351%\345\362\272\017HJ\357\021\017\017\212\370\241A\242\321"
+	.ascii	"\200T\331\261\365%\310\333\307ws\0360\036\220\021\214<\221B\027"
+	.ascii	"\346|_\246]\372$\225\373\200\244\264\002\0256'\225\313\245uY"
+	.ascii	"Q\342\254\"\002\343\245\231\210\"\346|_fj\227\326]\216\013LJ"
+	.string	"j\227N\361\240j\005\351\213\362\324\222\352\245wi^\212%\315\222nI\361p3\265K\257\244hg\317\277\r\372\022T\355Kpc_\202\246}\t^\354\367\254\331\357A\263\3373f\277g\213\0246\2431Y\232\262~\217\224\267\024\0167\323\270\024\n[\352\326#LW\\\032%u\333\020\306\213\2272O\264\355K\2313U\277'j\377\251[\233\315\2321\2525m)\224\0342\"K=\262>\207\277}\016e\3669\204\331\347\240\267\3774\355\251\332\237\232\245\315,\245\201T\r\006\335\213\254S'@O\323Z"
+	.string	"Y\202\312Z\203\273}\016Vvf\342\036U\004\346Q\317\301\255,e\222\355![tHQRF\226\227\366\356\215=%\273\030\325\213\321\234\237W\252\004L\215\2157\"Y\237C\325>n\246a`\031\312\027\f\266$O\301\356n\336\0177~uv4\262\276\231\024\311\377`\216\036\231[\\\326\177\212\344H\016S\226\367\352H\372\025<\263\007\270$\353s\250\261\317a\306\366"
+	.ascii	"\363\250]\371\313\330\r\264\254\317\341hH\312\205\233)\221T\311"
+	.ascii	"'%\222&\245/\272\360\021Ia\244[\030Oj\347M\022\003\210\321\346"
+	.ascii	"\326\360\251ZG\n\004LW\220T+\025\202\233\351\326}\322\2554F\032"
+	.ascii	"\225c\244\341}\177\250\351\332Ji\244S9I\314\027J\035s\244\304"
+	.ascii	"\317\303\006\033\330,\371\2402\332\372G\232\205\233)\220\324"
+	.ascii	"\207U\332#\347\311\225\022? )U\272\343\003\222R\nR\2768w\\\020"
+	.ascii	")Z\252>\317\231\375\247=\260`\270yq\341\221^\tkH\341I\311\372"
+	.ascii	"<^6\217\343\031EZ\320e}\036,\373\270\3710i\325\305l\325\331\030"
+	.ascii	"\313\372<u\373<r\373<o;\235\312\\\322\033vb\376\024G\232\003"
+	.ascii	"7\323\251T*\235JeX\031\343\314!\342\265dL\325\3479\333:I\222"
+	.ascii	"\223+Y\2476\322\032/\016\216\030*\271\257\254\317\263d\237'\311"
+	.ascii	"\376\237>\245P\270\231F\245N>iT\272\2246}@RR\241\312/\215Je\330"
+	.ascii	"\0201\242\304\357\371\276L\237\r6X{\300\225\005Q\365y\226\366"
+	.ascii	"\2376\2453P\034JP\324\244S\244\264\fI\231R%\033/1^1Y\237\247"
+	.ascii	"\305\376\006\300\375\re\3667|\331\337p\227\272prE\006\226\365"
+	.ascii	"7\310\245-6@\331\337\240\266\277\241\311N\337_\257\301w8\016"
+	.ascii	"\257PR\230\300e\375\rK\266\312\243\376\371\350DQ9Q\312\372\033"
+	.ascii	"~\354\1770F\363em=\265\037n\3524\272/M\247\321e4\232\250\020"
+	.ascii	"f\232\020y\372l\200\263\366\374\263\241j3\372\214\216\214!/\266"
+	.ascii	"\366\314\\\331\327\220\346\324d2\324Y\0201\347\221}\rW\032L\336"
+	.ascii	"\031?\030Y_C\324\376\242!\306\276\206w\177\247o\177GO\353\241"
+	.ascii	"i\340\355\240\301\212\323\216\254\277s\267\217G\267\203R\230"
+	.ascii	"G\375\216\223\375\035\346\376\316\217\215\255\3524\035\031\023"
+	.ascii	"\016\245\2545\335\335\262\325\035\231\252\247\025]\305*\f\220"
+	.ascii	"\312u\225\3438\214[\210a\362\313:G\001]Sy\n;[\233\222\357\226"
+	.ascii	"\314a\245\315i9\2422c^\340\256\345~\035\247\245\3440SdA\262\306"
+	.ascii	"N\334\243V\360\006t\r\227\023fD\305\2255\005M\035%K\231\200$"
+	.ascii	"\307\0277\037\234/j\256\330\265i(L\312\316\214d\255\331\236\307"
+	.ascii	"r\032\230\345\224\227\365w\246\366\257\237\254\tu\240\301\222"
+	.ascii	"u\246\321\264\023\255\226\255\346\316\272\374\351\264L\246I\220"
+	.ascii	"&Y\177g\306V\231\270G\375\036\346Qu\023\350\372,\350\266\344"
+	.ascii	"\256G\326\036\314t\023\335D3\321\314'x\316\264\2545\363\307{"
+	.ascii	"\270"
+	.string	"K\226\322\200\032.zXYk2\240\353\262\363\340P\311rfm\301X\356\372\265X\230M\2327/f\2306B\346<\262\244k\211\006\323I\264\022\334\324a\032\211\227\2240\375\225\263V'L\002\355\236\357\313L\267\252\320T\t\365u\272\354\353\310\355\3534\331\327!\262\257\303c\377\272\210\356\n\213\262\003\2235\021\341\225\021\271\032Y_'j\353x\342|\337\027\227i\351\037P\264\226\316\201\205\3530^\232\t%i\316\036e\316!Z\210\346\322Y\032\210\336\322ApSki\037bZK_\341:\265.\255\245\2514\217U\213\007\032\270\347\373\276\031\207\021's;\3729`\366s\354\366s\250\354\347H\331\317\211\262u\225\336\201\233\257\323V\317a\332\360vd\375\234\264=\202\267N}Ns?'l?\247\310\376\365\224~\352R\005,.\353c\265#\334\226\223\276\257\325\225. \375\3369\201\376\3205ON\370"
+	.ascii	"\235h\0301<\370\346\236(\032(ox\017\214\214.'\220\021\337\034"
+	.ascii	"\230\216\32254\223\206\3220\264\r=C\277\3202\364\222\246\241"
+	.ascii	"\233\364\r\355\244\245\264\222\306\241c\340\246~\322I\327-\264"
+	.ascii	"\213\300=\375\204>Q\277\234$\346\373\224\003\205\t\337\\\337"
+	.ascii	"_W\340\230\327\210\f\bE\236\356\316\344;\214'\365\242c\214\370"
+	.ascii	"\346\300\314\020y\342\233{\"1!#C\206o\356\251\237\264\321\023"
+	.ascii	",|sO\375\204\226!\302\203o\316g\347\315Hr$\003\235\255p\217\032"
+	.ascii	"\002\363\250\317A\332\307q\356\343\\\331\307A\333\307\021\262"
+	.ascii	"\217S\245\006\005\304\301\273\321e-\353\343\300Pss\306\013\232"
+	.ascii	"\0063\225\361\201$\353\337`\331\277i\333\277!\333\277\351\332"
+	.ascii	"\277\311\261o\263f\337f\314\276\r\335\276\315\331\276M\222}\033"
+	.ascii	"\255}\033\250\375'\356Q/\364\333?\372\005\365\342\245\313^\017"
+	.ascii	"\326\223+kt\357\250\336\r\252\327\224\004\215\013\252\267\327"
+	.ascii	"EU\247\267e\t\215\037B\230b\357\373\352\004\337\376\216\324\310"
+	.ascii	"\372G\265\240yQ<\300x\311:\013sW\315\240:\222\365\205]\3661Y"
+	.ascii	"[\316\302xi&\304\2368\201P:4\n\n\207\361\244\364\227\032\024"
+	.ascii	"\266.6(\316'n\316\367eN\301h9\350\373VQ\351\252C\257\240v\350"
+	.ascii	"\035\212\005\305C\255\240T\320*\270\211\322\241s@(\035\032WF"
+	.ascii	"\207\312\345\254\234\340\373^\215u\321\241Rp[\316\021\363uZ\235"
+	.ascii	"`A\002&B\217'\027\034\364\205b\373\302\255}!\217}a\216}\341\322"
+	.ascii	"F\341~\324-\347\310R\032\270i\273r\366#k,\007t\364M\3678\323"
+	.ascii	"d$\353\013\337\235b\036\365A\276\375\340\225\375`\332~0l\315"
+	.ascii	"l\347\235\222\266dK-s\331a\206\212\345,\263 N\030J\204t\221\345"
+	.ascii	"\0011C\307\264\320P5\324\t\332D\317\3204\264\tn\242f(\363\270"
+	.ascii	"\fe\302\366\276/j\206\226\275GF\"xa\t\302\367|_\246\215\036V"
+	.ascii	"\225\035;\032\277\270G}Pi?\370\356o3\373\333\271\277\351\366"
+	.ascii	"w\333\376\026\013;\342\007fG$k\364\b\332\003\345B\23189 /\315"
+	.ascii	"i\365\204\354J\315\371\205z\241IP#(\022\024\f7\321#(\221\243"
+	.ascii	"]h\021)G\320*(\316\262\035\270\r\211\r\b=\202\3620[s\276/\023"
+	.ascii	"\007\013\020\217,Gc&\356Q}0\217\372\035d\b\326z\262&\227\365"
+	.ascii	"\267\216\375\037\r\202j\241[\270\211\nA\263\216ba\262\017~(\021"
+	.ascii	"\003\202\353\260\304P!\250\017\\\207\265\304\371\276\257\317"
+	.ascii	"\006\033lp\023'\306G\265\365\267\215\375\255\264\277\223\366"
+	.ascii	"\367\273\277\252\3317e\366\327\275\375\225n\177\235\333_\335"
+	.ascii	"\366\217R\24154\023F\331V\326\377`\006\372$\365\201Q\236\216"
+	.ascii	"\256\034XEv\204\266\310\313\021\302\217\313\320\032\350\213\321"
+	.ascii	"\260\250\244"
+	.string	"\304@\231\220p\2405P\027(\f\214\227\366\036A\201\340e\365W&V:\210\021\214\013\306\005\2478\215\321\361\2641\023w&\314\334\203S0\026\2773\027A\271\034,KFr\004\345\202RV,J\206\374\255G\264\252\320d}\002\244\t\262=\350\026d\013\276\3310\313\322-+d5\242<\370\346\206\235x\301\022\327\006\245omM\305sL\\p`\357+%\002\247I\226\337R\326'@^0-\230\266\262\371\034q\032\243\003\0010\254\302d}\002\300\005\317\202gA45Lyv\317}\303+\f\006\032\326\0033\027\250\246\313\314l\r\301j\214\0160\324\214\326\034`\326'\300\025\023&*\233\227.,vQY\237"
+	.ascii	"Qee*[\024\355\245\016\352L\326\347\300/\270$\270$8\366d*sz\346"
+	.ascii	"\344\375\210!C\354\3011\035\244#B\240\250a8`a\266\340hC\202$"
+	.ascii	"\030\006\307\304\005\267\215\226\240D\005\301\036\f\023\203\376"
+	.ascii	"U\251\371\313:\230d]K;B\352\002f\304H\360\013\3570\221\274P\301"
+	.ascii	"2\360\214\336\202^\017~\255cZN]\034`mm\005\273\276\230\270\340"
+	.ascii	"\302\340\235\325\005\211<\330\265\342\345 \223\227u\220KG\331"
+	.ascii	"K:\203\222upH\276\323Isd\326\227uPH\276\32393\345\305\304\001"
+	.ascii	"\215\240VP+x\345\263_1#t;0F\217\271\254\277A\232`V0+\350\243"
+	.ascii	"\256\313\214\022\023\027*=z\004}\340\035&\022\030;\247\220K\225"
+	.ascii	"\2738\037Y\352\354H\213\265\254\277\001X\320*h\025\274R\302\304"
+	.ascii	"\005gc\344\214\0320A\036\017^\351,yZ\353\303u]\276x\274\310\372"
+	.ascii	"\033T\345\310\021"
+	.string	"\254\362\26122\243\322`2\002uS\346\227e\214\352\301\252\240\016g\215\032A\034\036\252\230\270\340l\214\366\236\264H=\210C;M\311\315\310:x\003\004\036U\320\262\016\332\270\\\016,QRYL\335\034V\326\037@X0*\030\265\341B\214\031\225Y\211\375\030\342\344\024|\362\2612\"s\200\347\322_\025\024\020\273\244\340\323O\"\004\021x\354\253OL\326\037\200Tp)\270\024\234\361\206U6\245\004\206\336\216 \323\2033\314\234\341\221\345,\325\256I\215_\326\037\200S0\351A\245`R0\306*E\213\347\217)\313\351\371*\351\020\021\364cG]\020\306\2031^\027x\026\345\352n\370H[\330Z\326\301\027+\227-tM\262\016\272HsD}\371j\361\007o\200\324\331\361e}\021V\366E\304\001\002\006\217|\254\214\370\016P\305\204eE5\303\027&d\257y\360(h\224W\007\266#h\024|\277\220\340"
+	.ascii	"$\022\254\361V!\022\250}\250r6\3020e}3*\326\215\266)>\262\276"
+	.ascii	"\210\037b\276\371\304\354?\035!>/R\322[U%\244c\272\"{\276JR\""
+	.ascii	"p\306\fq.)\363\375\367\355G\"\004\035\245\013\322\016\260\254"
+	.ascii	"w\232c\255>4\245\254\277\321\354\347\037\f\026\001\303\266&\353"
+	.ascii	"\213x\261\367\231\016\250\374x\250\311\372\333\f\220,C\216d\235"
+	.ascii	"\373t\224\340\373\222\361m\3477\231?\030\204\253\362q\225\365"
+	.ascii	"5\b\334\377\036\363\007\3275\275\034]Y_\003\277}\r\372\366\366"
+	.ascii	"6\030\334\344m\242\200\306\322\0322\017-\320\354\355/\337`t\024"
+	.ascii	"\020\306\224le\275\275`A\351\350\312zw\321Q\266\033\222.\300"
+	.ascii	"5==5\0167y\233z\316,\375U=U(\2763_Y_\203&\274\343m->VF}!\274"
+	.ascii	"\236\220\200\241_\206x\231\241e\347\2019C\n\313\373\316\022\265"
+	.ascii	"F#.\213P\314\214\251\264\261\240sb\322\260\231\311\372\031\250"
+	.ascii	"\271re\333\035Mz\253\246\3243Kg\254h\030e\312 \331\345,\324K"
+	.ascii	"\022<\"I\250P\331t>VFf\326\271%\2763hZ\215\253\300m\345\233N"
+	.ascii	"\016\006\030\234\223\254w\025\035\005L\306Z_\326Gq\304\210p\261"
+	.ascii	"\313\372\0314\315\315\205\221\341\233\013R\255\341x\003\224\""
+	.ascii	"e\235\202\233\274MC3#H\300\230cc\354\304\274\275m8\001@-\211"
+	.ascii	"\211\222\322\215Y\271\200\303u-\310\200\204e}\001\204\265\265"
+	.ascii	"m7\037+#2\"\310x\031A\262\235\3224y\272\265m1q\301\203\207\023"
+	.ascii	"'\033k\207S8\325b\251\353\3117\333\236\215-nY\3575\035\034VQ"
+	.ascii	"L\262\336j+T\221\251\251\254w\232\360\313\030:8\0018\235\235"
+	.ascii	"\255l>\373\0353\233r\276\257\224\2105\313\226*\316\254\037\002"
+	.ascii	"p\223\221m3\334\344m\342\340\205'%\302\306\313\r\261/M\276\315"
+	.ascii	".\247\323\244\224$\353\315d]\203\362\343mF\326\233\231\343\304"
+	.ascii	"\n\030\217\254w\031F[BC-I\b\347\376\267\330"
+	.string	"\026\323PR\330y_\254%Q^')\016\204j\272pH\311\372!\260@}\353H\315\322&nn\250\255\004\b\351=\032\342\301\233\231\360%\022\245%\353\260\365\210\213^\225\254\037B\312\246\332;\310\300\224m\253/X\333\007\306\0032\002\222\273T\306\256\372\200\244\224\202\230\027\247\221\235\265\211\264=\235j\333\310\276\372\332`;\311>\262\213l\257\215\0047\267\221\375c\033\331<\2728\337\227\251Sf\211\223\033;\232\212ls\355.\334\334D\3226\221\rd\017\271:\200\335\222\236\223\207\rp\370\264\354\345P\207\bacf\365e\275\267\244n\320\265\310\372!\276\366\277\265ps\0071\003\366\366\027fJ\020\254\"\373!\266\366CT\355\036{\213\223\312.\353\207\220\332\017Ac?\004\323~\b\245\375\020H\373\337;vU\332\264R\306\256\n\243]YB\312\372\001\b\334[jO\355\034\177PGI\224\037O\262~"
+	.string	"\320\354o\034\377\203-\004\271{\222\265\306\227S\267\215\357\033\1770\323\021\351b\312\372\001\340\333\3374v\215?\230\263\307\245\306$\353\007\300\313\376\216z\022X\006G\326\352\327v\021\200:\r\204Tm;rd\375"
+	.string	"\250\355\246\335\264\235D\274GP "
+	.string	"\261r\2133.MY\253L\204TZp4\303\230\230\3248\334\347\205\312\330\301\305\206\365\342/\266\f\020\357\373\272xW<\307"
+	.string	"\235\257\224\016\021i\032\223L\216-c\3078\3237F\226\365\277c|\303\270\343:\373\241\216\275A\2523&\243\255\204\271\330\325\345X\312\372\001\270\261[\354\026j\334\035R\032\220\026GY\037\203\300\375\375\342}\264f#\345\254734\373\030\204\331\3079K\r\f\034\213\302\240\016\020p\235\361\206\245\323\326\005p,\353c"
+	.string	"\267\3775\315qsM\263\376\241JV#\220\260\354\300\336W\212\003uJ\355/)\353\325O\230\244\343\352L\326\307\200m\037\203\264\375\257hpsE\243\351R\260z\237\016"
+	.string	"\265\344E\246\267vl\265\310\372\030\3640cFW\021a\365B\2018\322g\004\t\0228\034WY\037\003\252\375\257|}}\030\274\330\277`\214\323\211\365Rx\217\236D,1\243\302\201\260N\r\023\243\254\177\201\2260\253\336*\006\353\215"
+	.string	"\343}\257\206\2547\314\270\374\236U\366/`\363\362%\337\201\270\221w\201\330\376\005A\270\374$BX\365\326\275|7\302z\343\202\251\375\013\224\366\226-\353\214\033X "
+	.ascii	"\261`Y\363\314\254W\260\262]\332\022\243,_\363\306\304\200\342"
+	.ascii	"\202\333\312\274\244~d}\020_\366\363\035^\357\356\362\235\317"
+	.ascii	"kD\306\203\2628\020stt\353\2253+\235\231\232\246\311\354J\335"
+	.ascii	"\327+Z\013L\215/ \316\252TQ\343R\350)3{\272"
+	.string	"\222\263\313\372 \220\254s\353\334:%\030\002\r\022\227\3373\213\013\030oY\257Sl\272<\201\215e}\020:\366W8\274J\221\202\365\260\323F3\003\343|\235\250p\020|\001G\326#\353\203X\332\307XO\375\327\2677\214\206\231o\323\002\372\270\374\300@ \355\177us\303h\270\311\333$\204\201T6\245s\006\t\325V\326\267"
+	.string	"\r\332\n\005mes\342de\333F\330+\217\313\017l\t^`\225'_\3312\\\336\230\330\032\306\201\266\003\310\232\232\316\217\254,7\376r\342\364b\320H\313a\326\0274\302xe}\013\306\354[\200\267\233\254\315&ff\353\025~\235\336Wj\001N\306\234NsV\334\262\276\005k\373\026\fY\231+s\r\022\\@\326\222\363\225\222\022\241\356p\213C\222\365-\240Z\303\326\260\225\314\007\260\217\313\357\311eG\220.c_\311\216\344\255\025Y\305d\360=\331X\305\326%G\252\240\3604[\2303\246\251UI\026+:\362\342I\326\267"
+	.string	"\306\376z\004\257I\222\344=\3671FS\327\257\365\353)\257\202\275.\334\\\273V#\004\220C\272\201RB\305\\\213\bq\250\221s\242\2654e\334\310\372\025\304\255BV!+\027\020\365\017\211\313\357\271\016\371\312\205\321\330\356\214\272T\200\266\201"
+	.ascii	"Y\203\244\300\341J\036\227\337s\345\253Q\346\206\326\327 8r8"
+	.ascii	"\220\344@\262\277\366\300\353\217\365\007F\363y\215\370@\224"
+	.ascii	"EU\260\2651\306h\352\216\025k\307zee\265^\265X\\~`\333\252\007"
+	.ascii	"\0229\036_\257*\240\332\257@\t\307\232\003\307J\245\343+\325"
+	.ascii	"\324\324\320\213\313\017\354\225\222\022\221\032\211B\304\355"
+	.ascii	"\271O\001\026\247\265\206\323zC}_\314\264jrZm|\275\261\004\216"
+	.ascii	"yc}Z\237V\032\333\310\207.NJ\004\016$\222Wf\215\372J\343EU\332"
+	.ascii	"\221\254W\250\275f\006\216\244|\027\003*\256*\353S\360\266O\201"
+	.ascii	"\222ui]Zg\200\220\246oe\372:#GL\316\231f(\027\344\231\365)\b"
+	.ascii	"\262\3775\306\032CM\323M\336(\033\265\247@\273]gD\n`\326\247"
+	.ascii	"\340\306\376W\245\346\252\2446S\260z\243@\024\301\3027\347\301"
+	.ascii	"\305\r Y\237\202\243\375\257.V\0279+\005\253#\250\020oQ\376\312"
+	.ascii	"\024y]\200\311\372\037\300\354\3430\274\036\255GkR\222>\035\034"
+	.ascii	"l\027MG_V\244\033!\327\213\026}\350\026\246\224"
+	.string	"\022\024\262\254\377\201\n \340\372~G\255\241\006~}\327\274$2Q\262V\327d\2560QpY\337L\212u\006\214[\326\377\240\266\177\365\357\270\251\376\251\314\024\254\216\274B\034!\023\204\357FJ\223\230\252\254\377\301\013\r\0325\215\2318.\277\347\363j\232\035\226F\354I\3267\243\243\374\017\336<\323\320\330\262\376\007\251\375\253f\232\252\031\334&\302\352\350(\304[\327_\231=7f\213G\326\377\320b\377j_S\355\303h>VF| \312\342\312\246R7\263\033E\262\376\004V\366\3251X%C\346n\232\371\n\371\260$/\355c\332\003\314\372\023D\331w\373\237\003\200\257\240\201\321\005\fn\252`T1\330\t\277o\333Y\020\347\373Jq\020\204\2417\004J\326j\030MF\303\005Y\326\237\200l\177\202$\373W\367\216\233\352\236\352%\005\253\027\312\203#N\177e\236\357+\305\001NZ\013'dY\253]d"
+	.string	"j\261\222\365'\330\332\237`JOOe\223C\342\362\003\233@\006\026,\252\226\375\276\257\021\363m\302E\260\270\374\300\362\256j\021\256iU\371\313Z\315\262\322\331a\355\310\372f.\367?\250k\274-\271\222\365\001\020HG\247\336\005\366\251vW\357\\\2549\261\222\265z\005\243\251Rhh`Y\253u6ZgqRY\337\f\252\367?\250\223\344O\206^\326\007\200\336\376\325*M\265J\006D\225\336\243+\005\224y198"
+	.string	"\246L\231\242\262}\207j\255a\006\200\265\375\253r\307MUNC\271\001\302\233\231\024\007{N\f\322\221\254\017\2000885\356\330\351}_\244\367\255\322\261\222\211\213\013\026\361\302Z\312\372"
+	.ascii	"\330\261\1775JS\215\242\212\245`u\024\345A\225>#H\236\357K\205"
+	.ascii	"\003\0336\2743gY\337C\232\375\253m\307M\265M%\013*\275/\224\007"
+	.ascii	"c^\\~\317\327\311\211\203{\350\333W\325\324\265\253O\256>Q\331"
+	.ascii	"\244^#2!\274Eq\371=_)'\021\377\315\\eK\263|q\255e}\017n\373\307"
+	.ascii	"\317\277\372\0369\275\357\013\2252_'\244\033\365\307\307)\306"
+	.ascii	"\"~\034\214b\f\376k\364\034@\341}]Ly\276\357\213\313l/\267\243"
+	.ascii	"\034 \336\377\027\361\276F\370}_'\245\346\225\221\006\245\346"
+	.ascii	"\321\253t\206\367\244A\251y\365\244\304|\003A\026\211\202\350"
+	.ascii	"\026\261\340\022\225\310\024\351\220\362D{\324pt\213H|@4TL\335"
+	.ascii	"\344\021\375p\241\037\024#\224\307\016I\027\332"
+	.string	"\243p\006\342\322\004;$r0A\202\313\006\365\030Y\024(\210K\024Z\025R\270\313\016\264\251\216KdQ\270K\"\233\302\205~\330\241\243\333*\227\305\343\220ZL\262hY\030\206\226D$\t9\254\007X \211I\022\214\255\322\247\270\034QLa\202\004T\210\241\004\tC\023L\270\300\302\260\004\f\303\023*h`U\034\335\"\t=\354\3201\006\326%\232(\2720p\310\001@\013\002\251D1\304\342\204\005\3561\031\001#\353\026Y${B\031\203\313\2420B\005vY\344\022\331\024;\027\372a\207\025\230p\211CK\345\t\306V\331!9\003qiB\210\004\026\\6\310f\311\242\030*j!H\271\202\313\242\300a\275\320O\213D\022\213B.qh\204\333&\225\305\024\251\026]\026\2056\347B?\255\004HdQ2\251L\2563(\227B\2562\271\246 \262H\355\022\213K\267U\333%\253\"\251,\262D,\334"
+	.ascii	"\020\225\356Q_\350Gy\034\006%\217\034X*'`\242=vp\331\240\341"
+	.ascii	"\206\013\375\024\223,Z\342\b\3451\003\266H$:\301\262\313\023"
+	.ascii	"\332\"eQ\320\321M*K\270l\320\260M\341\022S\020)\270\320\317\004"
+	.ascii	")\334\344qI\324\016\211R\2706\022p\331 \r\307\266\205\301e\203"
+	.ascii	"r\216\255\222h\250\304\320\321mMp\331 \tVpY\024V,;,\211B%vN,"
+	.ascii	"\211,\262\304\006\326=.'`\274aA\244,\221\343^\350'\210hD\020"
+	.ascii	"Q1Yd\223L\221]\266e\227i;\f\"\272q\207\311 \2424\031D\204\n\271"
+	.ascii	"AI\026\251\262\0368\266\232\005\221\262\250\227.\021jdW#\333"
+	.ascii	"\026\351v\375r\030D\364\203\303b\351\266\307 \026\206\341\006"
+	.ascii	"\027YDL\301\232\320i\215,\333\202\261U\366\330tXA\370Y\262\301"
+	.ascii	"%K\304\262% \211E\355Q\0023(\205\332\235b\221\210^\350\247h\350"
+	.ascii	"8\302\207\r\".Y\025$\024\213D!\321%\232(.\325\036\017:\260@\236"
+	.ascii	"`l\225B!\320O\fnKD\336\220\370\371\340\307\004\rB\026\211\342"
+	.ascii	"\330\036%`l\225\032Z\016m\313.\211\210\212\214\254\007\216H\342"
+	.ascii	"\261\204\313\006ypI`\207\212Zv\251\303.\211;(y\034Z\022mV\367"
+	.ascii	"\230T\301\330*sz\330\240$Q\250\370\001\005\235a\362\204 \242"
+	.ascii	"\031\2240\354\b\265\3542\205\316\2225.]\340\200\202\020\307\005"
+	.ascii	"\227m9\264J\tt<\370q\227D\242\037\366\204\004\255\233d\207X\244"
+	.ascii	"\t:\0338\f\225H"
+	.string	"\252\220\234A\211<\241\247e\207\210-\f\035c0\266J\036\227\350\236\350\tJ\036\227\356\211\266\310%\272'JpY\024\214\255\022"
+	.string	"\354\2202\005e\f\303\023/\240\260\341B?\305d\321rD1E\020\021y\002\353\022\335V\310\026\227\312\023P0\266\312\240\253\272;\306V\231\243\fR\2560\003qi\302\330*m\220,\n\342\n'|L\030[e\216\221\035Z\2220\203R\350\204\261U\336\f\261n\313\342\304\316\222u\331!\345\2225\262l\013\306V\351\341B?+\226#V,y4\244/\266l\313\302`l\2258/\036\227l\222\r\332\007\241"
+	.string	"\035\024@\204\025\253\353\272.;\204"
+	.string	"\007\222G$\017;4\252\260B\211be\207.\321=qs\241\037\026\311\026\213D\f\332a\261HL\335\013\375\b\300\275\320O+\344\022\207"
+	.string	"0\204\333\341\220(\005\317\212\343\322%\262\340*\2279\256\316p\275\320\217[,Z\272-\211v\270\202u\213\2064p\240\250D\016\207\352p\270.\331\344\f\312\341pm\227l[\224\034\016\2671y\344\300p\250\266\311#Q;\034\256Hv8\f\272C\267=\"w.\364\323\262D,\334\016\214\354\222(\324v0\242u\217(F\024%\203:XQ\224<\";"
+	.string	"\241"
+	.string	"\303\002\210\260b\004k,B\026\223\307\021\313\266h\304\001\334\025l\022IL.Y7y\034\032\211\354R\310%\032\016;\250`\227D\303\241\352\266G\344p\250\022]\242q8TY\017\034\333\341P\345@Q\211\324Ev9\024\272\307\244\n\311\023\334c\362\250.\335\027\212\311\242\023\214D\026\206b\221\004\016\355P\005k\242X$\356\344\tF\"\273T\335vx$:\221\2025\301\022\261\210a\250\302\013'l\222\307\355\016]PA'\217/$\333\242z$j\321vX\202\204\n6%H\250\020,\2228\242\027\372i\213Pxh\207,\354,Y\267%\016\251m\313.\215F\342\312\252 \"O\024\021\r\355\242\241\n\326\330\026\241\330\355\320D[\204\302\206\035\262D,bh\213P\004Y\"\026n[\204bm\213P\240("
+	.string	"\r\213E\242:\003\021\206\022&HP\335\013\375\024\021\r\r\225K\026A\305\"q"
+	.string	"\354\020\006\017B\360\240"
+	.ascii	"EDC<-\273\024\266C\016\354\360D\021\321\220\215\352\"\213Z\026"
+	.ascii	"\006\326eM\024\021\rm`\207\311\240#\2228\314I\006\035\221$\024"
+	.ascii	"\213\304\315\302Hda \272Dcp\331\246\030\n\005\035\205\206\305"
+	.ascii	"\"\361\2065*K,o\226,\022yL\241\252`\215(\222\250b\311\272I\025"
+	.ascii	"\202\222G$\321\020\361D\261H\344)a\202\204b\221\250\262\305\244"
+	.ascii	"\013nKdWpI0\262.\321H\024\001$[,\222\320\036=\270\354\260U\332"
+	.ascii	"\214\b\"\222\240u\205\202\216\310\024<\355\220\035:\272CC$\321"
+	.ascii	"U\272\033\2068\356\205~F$\225CC\312\342\005D\254\333j\367\304"
+	.ascii	"\020\221]\272-\216\233,R\026\323\344q\b]A\034B\335!\b\005p\223"
+	.ascii	"\307u\250\250EY\344QH\264^\350gD\273T\266I\266]AL\036\2076\314"
+	.ascii	" \201\233d[vI\344*\223.\021\205\n\017E\025H\034v\270\201\035"
+	.ascii	"r`\213\313\"\345\211%\353\262,l`\341\036\213D\"\"\n\035\227X"
+	.ascii	"\202\004\330\266\b\247u\227,\222\204\022l[\304\201\r\"\272I\266"
+	.ascii	"\270d_H*\217.\321PQ\233T\026?\264\307\226]\262n\313B\310%\242"
+	.ascii	"P\221\203D\262E$\262(\205KD\241\202\007\211dK\260X\262\256K,"
+	.ascii	"\241G\005\216Qy\\\262/\244 Z\301%\2428\342H\200$\026\217\356"
+	.ascii	"qYb\251<!Yd\302%\242P\321\301\275\320\317\007!7\251dA\307HtY"
+	.ascii	"\026\214Kb\321\330\356\264\034(*\221%\f\025%\203&T\030b\225\251"
+	.ascii	"\t\025\226\354\262\310-\022S\024%\211C9\354\020\261\005\033$"
+	.ascii	"\361\270dO\340,\225\033 *\223G\026\222\312c{T\301\302\300aId"
+	.ascii	"+\220T\036\335b\221Q\271$\312\271\320\217\005+\224(8P$\"Q\354"
+	.ascii	"(\217.q9$Z\213E\342\320\270T\026\331\245\2205*\2074\007Z\342"
+	.ascii	"\320\260=\032\207\255\021\311\036Sp`\227E.\021\2618T.Y\004\335"
+	.ascii	"\004%\217Fe1\311\016Y\025G\227\210h$jh\207D\227h\"\251<\272E"
+	.ascii	"H\345\211\226(H\203;T\302E\022\323v\230T\036]bQ\271BK\024\204"
+	.ascii	"\343\022\221hR\211D\205\220H\324\370\301jdY\242\0236l\273,R\226"
+	.ascii	"0&\213\224\313\240\033\"\245QH\273\304\023CEI\365B?-Q\320\b\345"
+	.ascii	"\261%\n\262a\207/\264DA8K\326xT\241\\\022mv(d\215J\026Z\"\212"
+	.ascii	"v\263C\035\245[D\024\262C\022Z\242 \034c\021\261\004\245[D\334"
+	.ascii	"J\026yD\022\203V(\221(z\330bR9t\223G%\321\220\035R\n\r]\266\203"
+	.ascii	"\361\203!\333\026\r[\242\240\035\367B?#\332%\253\342\2704R\200"
+	.ascii	"\202\270\f\n\266C\234v(\001\036\026\211\202\030\203\n\325\250"
+	.ascii	"\2663(\227\272E*\213\232\002\255\222HW\240U\022i7Y\244,!L\262"
+	.ascii	"\354\262\330"
+	.string	"\"\221E'\260m\021\016R\251,a\230\032\331%\221E\026\327\031\2240,\225\355\262\250\030l\207A\307\024Ie\tc\253\264i\225D\303!\326=nb1\210$\006\205\354\320=&\213\206\306V)l\335c\262(m\227\354\320\321U\333\240\3441\271$N@G\250\350\036_\020\"\221J\030V\020Y\020\"\006\335!\211\017Z\227\350\266C#\213DAL\346\020-q\334$\273\\\026\025\207\305\226\325\300.\225E\035w\311\252H\252 D\334+XcR\205\027\214\255R\2075*\207\206\312\243\221\270\034\262 \"\227\254\n\345\206%Q\250\250Y\3441\205rI\264n\310!R\032\205\2063(\205\332a\353\022\333aK\024\264Am\221l2I\024*Q\\\n\331\342Q\005k\302]*_`AD\022\265G\243\206\241%\021I\034\346\\\250\347J\"v9\302U*\227#l\332a\361\350\266G\227\350\2666\356\260\215"
+	.string	";tt7;tt\207FvhI\024\032Y\226\250\035\256 \016\005\223\307!\0336\210\350\"\225*\206\306$k\263\335!\211\017\334\344qe\215E\356\321E\022\223D\267=\032\331\342R\231b\030d\263\022\r\261\356\260\330\262\303\025\304\241\033wX"
+	.ascii	" 7y,\332,\334#\222X\324\201!\007\222G\3440y\034\332q\207\"\270"
+	.ascii	"\311c\321z \240\022 \"\320\002\n\273\370cl\225#\214\255rD\362"
+	.ascii	"H\034\032Q\\\266#~8\f\2410\016\217m\273\034&\217C7\377\205jA"
+	.ascii	"\264\036a2\322T%S<|\304p\242jY\002\231\262\003Mx\346\005\246"
+	.ascii	"\013\216BB\246+k&Sh\0264z_+Q\314\204M\f0\306\031(l\"d\202\231"
+	.ascii	"\226$\211\313g\242\252\024\311\372?r\3021\341\230\220\f;9\361"
+	.ascii	"!\240\013\221&#B\262U\254\253\311\226\254\377\323\334\277Pl\306"
+	.ascii	"\032\276\263\267%\177gZ0\215q\313e\272\020\321\022\206\005\337"
+	.ascii	"\324\002\311\200\001\233\262\317\244a\232I\262\346\201\301\233"
+	.ascii	"J\312Ze\202_\370\253\n;\022\274\262\326\325`\032\371\302zuM\324"
+	.ascii	"\314\t\275T65\034@\260\262\376q\363n\302\"L\272\336\367\335\271"
+	.ascii	"\361R\006JZ\326\377!\023\022\021\0229\212\212\372\021\262\205"
+	.ascii	"A\204A\204C"
+	.ascii	"\276\341\210\310:\305\304\007\367|\245h\210\370\205B.\034\222"
+	.ascii	"\244&\245\226\265p+g\345My\341\"Ck\345\212\3617v\004d}\261\017"
+	.ascii	"1qo\326\032\304\346\212\236s\355\307jD'a\236I\361\241\332\270"
+	.ascii	"\301r\352\342\243\007\216\263\263\"NXj\032z6\343\354\314\225"
+	.ascii	"j\225\2230\351\341\202\307\216\027\357"
+	.string	"G\026\346\227\0230\275\0351\320\236mPU3\250\324 7L\232\242\276t\004\237\202cF\272\310\344H\243\275d\240a\231\n\0361\251\261\311\tq\250\315\027g\211_\020\027R\252\016&Jg\326\2046.\274\341\246\366&\311ZHCX\303\256\311\031\215\254\235\360\304\270\200\b\243| \261\302\345$\334\233z\201\006j\377\245i\340\266l=m0\370\210Kn\311I\375a\243\005\023\034Mj\021\035\275\037dv3r\326V\023\203'\203)\210c\345\321EEj)X\245\263g\345cI\206\372\365\343l\255F\214!\303\247\"[`\370X\233vH\310(\005\257\264\r!YF^\250w:-\232\222\320p\261&\345\"?^\276\026\301.\0332\300\026cI*\022mF\313\225(!R\360k\013\024\226\026Y\013\215r\354\270\350\355e\375\237\027\373\027\276P\252\2238\263\256\300mv%O\213\2265O8f\274`\275"
+	.ascii	"D\341l\270\240\325\251\251\331t\\\222\354u\005\377\266\035\214"
+	.ascii	"*1\177~[K\020G\2320\036iTf"
+	.string	"\320\324\0205Y\0377\203O5\256\004\276%\037hp\233z\243\305\337\2233\033N]\212\033Kbf\235\302\305\204kQf\273e\360b)J\237\030*\245\033[|^r\310<u\271\221\021\0236\315\31009U\262\240S\020)\2631\233-\007.\212\022\227\230\225\206\225.\\da\202a\250W\031\277\027\f\2330\210\031 \200_\202cd\224\234\021\222uS\323\226U\227\253=*.\353\215\247\225-0\364V2\261\"0\252\266\250DZ8\325\265\310:/O\215\303T\230\270\340\300rSY\020\300\254\337\201\027,X\324\270/&1R\236\231\317\353\307\227\254\337\201\223\273;\257\2561:\300^$As\244J\225\340\025\037+#>\021\274\342\312\246\236\350R\r)_W\202ub\354\356\254d\035\244\333yi|\320e\375\016\254\202\001\211\177\250\024\344\315\025\207I+\263@\232(Q\222SP\242\261\261q\005\243\025"
+	.string	" @<\036\222\312\345e\315\003\024"
+	.string	"\017^\332\232r2 \355QP\032\306\314\f`\204"
+	.string	"\200T\022"
+	.string	"\004Y\007\305\247j\376\320p\366i\320\242\257q\227!F'\006Am\366E^<\307\232\265R\2079TK-c\032@\rF#Z\315\324\224\225$\224$\246( \305\243\305\021%{\246{\360j\n\217\362\035\200\020Y\235\034%\006\031\221\262\213?+b\250\n\251\2427\364^\025P\022\303\362u\311]\372\003W\231\267\353\347D\216\002\3404\207)\276"
+	.string	"\356\215\270\026*6\352+\246\365|0C-\362\343\225\b\370~EA\035\220\234\3737\212r\241\324\f\263v-fG\223\367\371\376\371\030&\352\024\202\205\320\357V\347\\B\214x\002\301\354\321\334\374L\243\"\273\f\305\262Q &b{\237\316\r\202z\002|li\274\325\261\365\2278\346Tx?\254]:\004\351T\001\217\370#\321<\245(OP[\302\346\362\2038\006Pz\320gF\024l\220\245d\266\305i\271\271j2\204\272\b,\373\215\362\037\001\035D\016\177\262\310\216A\266\241\"\333\320\320\032\r\025\246\366\244v\237}9I9\337\302g\355Q\002W\376s7=\025Z\367\343\021\2648+\346M(\234\273"
+	.string	"\302\254\030+J\001\t(fPt\3166i\355\013gU\300\250\021\370\325\005A\t\235\r[=\350\003\331dnk\324\315IU\005\220Rp5\304\276\242)P\232\003\"\207\r|q\026\277B\376\177.L\027\007/\264c\203f!\022\233SY\004\254nH\304\253\370\1772\032:\365i5<vy\334\311a\027\256\272:\324\303j\226#\246\300\360\257\367\024\353\322\261\2718\365\256Qh]~\007\253\302\223\200T\251\303\017\301u\237v\252\344\305\336P5\275\366\254Xr\317\247\260\360e\036B\246@"
+	.string	"I%]{\317\326u\230N\026Xx\332\204~A\226jM$\331\f:Cp"
+	.string	"\214L\33081\203\211\270\337\254\243~\2662\374\001\215pQ"
+	.string	"\003j\3675\"\001\206C\266|x3m\303\223\330/p\260\026j\357\022\232O\376 O_\226q\2749L`\312\221\351\277( cs\231\030w\245\257\342\354\336\365\221K2\332B\203\344\343}\241\203*\313\271\202\003\204\215\033E\002\304\310:\205\337\364\261q\330D\241\350\225\002\027d.\305}\222\220\244\251\303\2619\356\021S\256=\272\206\334\bo\241\331\276t\274\301*dj\211W\246C\244e\254<\233{)Z\274Q\351\240\331_\341\322t\321\263~R\fa\223\374\222\303\030\3268)\275\230"
+	.string	"}\226\2777\327\0027\231\266<P\232\bC\3172f\251\355BB\303\327\243\202!\313+VA\342\035\227Y*\257i\224]\366|\031m\002\242\310\027\254\355\027\017$\267\326L\247w\022\302\r\207\242y68\202\327\271Yj\337\360M\275b\252G\240H\226?\265\021, \271x\300\345\r\225\246X*\3334\220I\037\370ZMq\253)R>E\273\300\325}h0\317b)\326[\360\361\326A\002\250$\031\004\205\353\326\262*\331\347\253Z\270V\304\223\341\031\361]\330o(\267\202,E\017\306\323\274}\331\336\271z\001\\\303(\276^\377E2\277N\376[:\017\374\027\262Q?!56\201\304\303\342\r#\331\275P%\020x"
+	.ascii	"\344\374\203\fs\352$\203#\243\252u\315\023\326\177"
+	.string	"\036\374\0224\222P\263'\300\347\035\0065\277\356ki_j'w\021\364\221\354\274y\200\b\272\001\363\031\311\311\337\254\343\320W\353\211\253B\037\250\205-\002:\"\320e\007\271\360\032\207^DQ\024\323I\377\013d\232\324v\002\201\340I m\351\017\nAj\207\033\326\007\341W\361K\317&\b6\347\345\255\3502X\257\264\257\242\230n\274\221\376\207OZ\224\254\273\375\305\231Du\2341\222\322O\314\306\345\247tWLw\f(\203\223\223\2642\361\307f\236K\025\210\366\237n<\335W\025\371\272yJ&\246C\215\262\340\036m\251\002\233P\fDi\035?\340nWS\225rE\2712F\216\252\326\007\356\213\351\211-\255\330odG\224}\375\271\021\263\226\331\234Z@\236ie\331\0379\237\251\317R\373\351\311\326T\317\021\301ef\311%\372\211W\350`\202\230\271\203y\216\235m\345\264\354\023J\334\226\347\203F8\242"
+	.ascii	"\236@\317\362KZ\353\201\313u\314\005\243rDM!z>\344\335\245\353"
+	.ascii	"\rk\237h)(y\206\204\230\205\360\303l\2404\n\322\340\\\2523\300"
+	.ascii	"\202a\rgT\204\037\374\001\2778\375\bU\320k\2707]r1\254\352\036"
+	.ascii	"6~a\310$\34745\314\n0.\302\244\346\364\264\223\366\313\360\362"
+	.ascii	"E.8\031}\035o\200\217\211{D\004\363\003g=0\333Pt@K\362\273\f"
+	.ascii	"S\325\304\350Q\203\324\225 \373\213\202\"j\352\237\022=\222@"
+	.ascii	"\324\201F\037\220\237\20340\207\305jZ-$\342\304\020\3205R\376"
+	.ascii	"\\v\323\216\216\237\0261\277\2551\213oS\365\341\r(_\313\035\027"
+	.ascii	"/\260\265W\215w_\330\312"
+	.string	"\341\017\367y\r\034\320G/~I\276>\222\222+\fH\002\343\261E\2174u\273_\0028\"\252G\243$\246\250L\246\367\362\236\370}\275\345\247G\201T\3561?H\030\036W\243\0216,Lu"
+	.string	"\326\372\210\247\377\215\2613\241~\333\344\nZ\007\331\004\345M\255\233E\233\226C\025.r?\243V$wCk\232B\025>\352\365\375\215\215%\036\227\f\314\026`2N\202\001 d\307\222"
+	.string	"S<\317\367\217\252\374T\343\325{0\3176-|\204\323\276x\t\007uy\\?\230\013\250\366\321\016`D\002\326\350SA4\220\370\342\020\237)\344A\3364n\303G\0163~"
+	.ascii	"\237Z\003\260\231,s\372\023\231\235\325\307,+*\232\346\337-\017"
+	.ascii	"\032\275a\205B\024\375\277\272\031\331^7\370w4\326\364D\242)"
+	.ascii	"\023\337\204\317\255\307\301\205`\013sQ\224co\244q\217\363\373"
+	.ascii	"\303\301\210\327\004\336\311)\336-\240V\024U\267\f\364j\200\335"
+	.ascii	"\255\254'\272\036\316.\252\304z\2214\263U\036\315}\225\341\271"
+	.ascii	"\332dQ@\337\355\004\177"
+	.string	"\352\256mG'UVe\364\246\334Me\205\016\261\013\026?&N5r\346P\376\177\007o\2352\363\345\231\207;\340\341i\256\027\232\200f\307X\201*\352\367^\307\332\310\r I\302\312\024\021\017\271\013\2043\321\237~\333\330\215\201\214\330\341\223\031;g9u\246MB\031\220Ys\356\b\213g\277\260w(\252Wg\217<\tB\210\200\225\006\013\025\256P\032X\007SNYR3\032\001\223\224p\250\023\005\252`<\310\325>\3746\263\230J\326\264\363%\321\203O<`\332z\221\322\ba\2040\310\f\342\312'\332\300A\236\222\225\227,a\226\203\273\316}\252\243wL\2121\037\267\320_,s\026\260\302Hi\005\002\273~y\332\t\351\002\232\314\320eq\342\202\324\367\245\237]\335~\300\017\007\336\233\ta5\003\212\204\300DC\351\204<\237\r\222g+\360*\260Y\2108\264_J\314*V\371\327\032/U\356\006"
+	.ascii	"\323\017\034|Z\030H8!\021waM.\351\225\340\022\234=\263L_\344"
+	.ascii	"\273i\220)x\223@\365\270\224\2721\245\360G\344\267\214\037Q\312"
+	.ascii	"\016\374\b|\204\352\261\002\020*\370+\315\241m\007\322\352\304"
+	.ascii	"\250\220\303\305M\223\226\301\2555\365\253h\233\264\022nc\f\245"
+	.ascii	"\246\317r\r?\270R$\213Fy\223\213~o\037W\024\314\3101\215Tu\300"
+	.ascii	"\"\344\"\221*\346\260\347',&l\330\231)\f\213R\340\342\013\031"
+	.ascii	"\206X\233\242\304\205\303\241!q\001\252y7\n\256\3457\255\021"
+	.ascii	"z\246,\343\214\241\356\314X+a\256WQ\347?cL\3114z\311\025\273"
+	.ascii	"\035\241\242\354\303\374U\277\360\360*\372\3674\367u"
+	.string	"\013\257\003\344\245\254\034}\201\030\2645\233r/\001G1\254\334+\257\227\263e\217\257\003\333\007\236\272\230\210\274\b\030\241\251R\270_\276\226/\264$\225\221\032\276\030\322\246.\244~\331\210\036\177\f\243]+\362c\220\004\177t\226#\332\"\006\351\264\004\3447\013K\321\262\325\204\311\034\177\333\215u:\222qL0\003\300\345J\354\357\243\003'\307n\211\335ti\177\206\032\317;\324\233}\202\305\376\r\335\006\311_@<\252\263\254Ho\254\320\006\362\210\224`A\270\232\250\222q\365\373\334W\022UFr~\"A\216B\231i4\340\007\226\027\0230\234\266\374:QAg\026\230\0056XH{\024\2700\313B\237\221\343X\232\277\272\235\013_\257N\273\003\211q\034\306\032N1\003\322\375a\337\312\223\352\020{#\2523\343AT\362\343\036\342\2341t\306cm\026\225\220\210(\007>\304 Q\367\316B`\210\2423\002\333"
+	.ascii	"P\362\016$M\304\2760\311\350\243l\004V\254\006\264\31354\r\210"
+	.ascii	"K\314t\036\234\257\222\013t\251\345\241\035c)\335\321\032UDE"
+	.ascii	"\215\357\353\031\365E(d\0039vS\344x\375\367\300V\031]\237&)\003"
+	.ascii	"\244]\232\216\270\300\257w\312S3W\257\344\004\252?\365\310\237"
+	.ascii	"\271m~b\261D*\240\326\314\213\022z1xy\032\233\020\351\036\372"
+	.ascii	"[\267\202\336\321\032\215\026\332OY\335wZG\001V,\217\031\264"
+	.ascii	"\\\216y\252\204\320\021\204~)\273\232oO\221\307\375e\302BlAt"
+	.ascii	"S\222\345D\305\225\005\3247_\231\023\363\2254\263L\007\261[O"
+	.ascii	"\314d\256g\362\266N\311\346\342Q\373*dV'\356\361\216\304\017"
+	.ascii	"\260\353x*oEYrBab\264\354|\036:O'\212o\330\270\036t\002\017\264"
+	.ascii	"L\316 \322\341\217E'\205\205\376\024\251YJ\302\r,:\254\277\005"
+	.ascii	"\022\016j;h$\031\267\n&\300\251\031\254\361\034\013\351\370\005"
+	.ascii	"j\273\240\205\202[~\226\201\0379`\274\004\377\343'\235\267G\250"
+	.ascii	"z\n%3\250\373\220\254U\216yw9\241[\0229\302\237$\223\244\203"
+	.ascii	"\017\271\024;i\201\210\264\250\355~\037#\0172\002\334\226\335"
+	.ascii	"\260zp\362\314\243T\265\342\233.\322\020P\356K\217\337\262\246"
+	.ascii	"\\\316\t\023(;\222\345\355?\352(1\214\304\250?A\313\345\266\274"
+	.ascii	"\337\203\224\"{\314\034V\270g\031\252%\227\304k\336\321\354g"
+	.ascii	"\001\3240\n+\334jm~\032\254K\344\002\317\275.g\336tH\240#\204"
+	.ascii	"!\032\231\025@U\260\277\344\372\333\r\004M\270\nU\250\001\n\272"
+	.ascii	"\0028\346\331\244\t\320\3579>\304\016A\210m\004\251\017\214\271"
+	.ascii	"\311\f(\326\215\316f:\037\316i\315h\242lJ\355\220\330\201\b\341"
+	.ascii	"w\301i\311o\201Z@\326\372\021d\016/6\0073\264\006\236_\364c\210"
+	.ascii	"H\367j\361I{\035*\367\246\3578C>\303\223\016\020\223\245\273"
+	.ascii	"\275\003|\341\b'\336tj\350\310\0240H\327Yx\tf\023\301\272y\035"
+	.ascii	"\227Kj\260\037yj\370\320l\":\203\332!\016.\t\301?\017,\316"
+	.string	"\205\002\222\320\211\251|\266\257y\272o\321t\254\204\022\025\253\306po\272\003d>NX\354\034\001\374\241\274\337\003\016\254S\024\032\212\236\203\320\320\244Q\t\002\013\212\r\r\223GH\"0\374\375R\034\0266\340m'\342\314\253\350f\216s\272\013\300\351e\276fn\272`_\313\337~\177s]\260h\267\f\233\317\251Z\013\334^\326v<P\302\204\347\t\335\331\006z\r\243\215\210\250\360\300u2`,\026\220\300\251L9;\251n|0g\n9LN\026\037\261\227\330\224\315\355\277lo\304\370Z\212\226!\211a\327\006\224@\2354\240VCbG\263\207kH\016\270\310Eh\027\225\3421\300W\361\037\2317\227{\200\226 \315\324\355\022S\316\035R\336\363\204\273\262$\204\271z\030\333\247\320nE\350\267\353w\"\211\243\224\205\200\007\331\331f\330X\310q\334Bd\211!\006\315\027[\376\235{\200\035>_\007\253\320"
+	.string	"\n\267\253\"\300u\020%I\215\261\261\032F\244\261\005)\3251@=\371\205\231Y\007,\037\352\033\206\023\372\343\244\355\020\365\020\033\341\236M\337D\342\025a[\032>E\257\3117\334P@:\315\370\227\004\326\366\332#\321\220\002\314\312V\033Q\201\271\255\334/\304\330\\"
+	.ascii	"\025P\034\022\205p\205\311\016\244>\030\265\266x\347U8:tUD\037"
+	.ascii	"\354\301\036\374\021b8$\375\350\312\257q\240\300\300\345\266"
+	.ascii	"\360 \315\345\213\353:?r+\273\231B\340\312\351yn\r\3454\336\310"
+	.ascii	"N\231\376\021\3248\002\177\275N\006G\225JA\305\n\002'\271'\r"
+	.ascii	"\304i\365\302\205\207\3067\204"
+	.string	"\274Z\246\005a\344\"\300\007%\326\313\3671\314\253a\373\227\3056+=\201H\026\271X\226V)\023\254\370\2007*\335\200Z\215\260\265\227\374TR\303n\362U\256?\247\320\237\243`\364s@b\204X\323=<\222Z\t*\304\351k\016\004\352I\031v\001\324Z2\227\035%\226DD)\371s\200<\376\006\330\206\364\241\216\220o\276oC\377c\200^\343\234\350\036\220F\023x\257\201\253PE\032\210\\\202?\006I\345)\303oC\325\026>\006j\364\226\306\377{$\326o\372\262#\374\371\277\205\026\017\222\260\311\0339\274\013\225\342\362\203\005)\335\367\020,\341\306\226P"
+	.string	"\307\274\224\254\330"
+	.ascii	"^\002=zM\230\030{?Q\023 4\251\336\fw\022)\026\036my\327i\323"
+	.ascii	"X'O\231\264E0M*F\202Ai\341\351K\372\225\330\373$\177\351\344"
+	.ascii	"\007\023\310}\\\253\250\036\223pr\257\307\204\340\275\273\005"
+	.ascii	"\325\324\247\2433\377\232\333\025\027\354*\002(\265\351fU1Y\227"
+	.ascii	"^i\305\340V\351>'X\321W\217\266v1\214\214\340\207\037\336:Fu"
+	.ascii	"j\356\206\232\336\375\223.\267|\327A\275\355\337>T\025\221\202"
+	.ascii	"\230\361\267\016\302\341k\223\251<z\261\020w\367\"\377\t\007"
+	.ascii	"YL\033\004s\352\3011Z\205\267k\300\206?.\271\037\374\205[\317"
+	.ascii	"\260n\344I\266S\306s\324\340\231\300F=\255\027\237k\226\036\344"
+	.ascii	"n\371\356\3452\005\267\372\322\341G\320\030\276Z\020]B\372\326"
+	.ascii	"\251(N\2147Z\337\324\330J\203\210\200_VO\023\001\030{/\302\211"
+	.ascii	"[B\336\034\333C\332\255\321\225:J\247\330\n\374\247\373\360\263"
+	.ascii	"Fh\214\237\b\372\240c\346\260(X\360\263`^\261L\224p\273X\365"
+	.ascii	"\240`\311\233\335\336\005z\313F\244\005\242\214N3CL!%fV\217_"
+	.ascii	"\223\263i*\020\222\204*J\203\207\202\344\307\361\204\316\023"
+	.ascii	"=\030\002J\366f\342\336~\317\t\204\277{r8\321z\270v\377V{\tZ"
+	.ascii	"-G\267i\331\224\257\373z\352\271ofz\237\354*\342\277\037\262"
+	.ascii	"Dd\316\f\025\\\314l\257L?\341QU\222\201\3040\336\243I\364\341"
+	.ascii	"\261?X\262\311\213j\334\202\rgL\245\005\200\271e\270a\374*\330"
+	.ascii	"\212\020!\222s\332 \373\273\261m\221\217-\251\007p\343\315\036"
+	.ascii	"t\337<n\203\245\313\210\355*\325\353\327\264=\242\307l\262\221"
+	.ascii	"\3652\376\365\311[\232\210\220\363\215\2764u\234\005d]\204&x"
+	.ascii	"\240\310\274\231V\376I\372\202\223\177\224Z[\243gn\372\215\336"
+	.ascii	"\003N\304+\332a\231\236\300\001S\356j]\364\261\217\024\207\213"
+	.ascii	"\370\272)\266\376z\242b\361\306t\265\233e\033\22559\b\331PDg"
+	.ascii	":d\324O\304\031\344W\rV\332(\230F\264[x\004\357(\312\214=\300"
+	.ascii	"@v\373P\006Q6&X\377\262K\204\214DS\301X\347\221%\312~\207\377"
+	.ascii	"\306\342_D\244\272\3507\362+2\207\2366\006\365$q\313\224(WB\352"
+	.ascii	"\346\312\346|\217\351\017`wrX\356i\232\013\324\031\206\207\302"
+	.ascii	"]\367\021\343\206\207\222i(\204\217\251\0021u\332!KD\237T\343"
+	.ascii	"\211\215\215!\252\276n2\262\3556RjG\350\030\253\0037\036I\345"
+	.ascii	";\r\300\244\236\255\320S\372\220\335\216\355v\227\335\t(/\r\030"
+	.ascii	"\342\177Y\217\017\222w\354>\204\206l\235\244@\022@\021\221\365"
+	.ascii	"A\265\261\017\224\361\r\310\263\254H\246\217o~\026\331\344P\320"
+	.ascii	"m\211A\3647\245\266\301\344\300'\335\233\235\332h;=\356\3018"
+	.ascii	";\347\205K\223~\264d+(:\352k\316\226\026\346q4\252\177\226\347"
+	.ascii	"K\351\256\324\263\027\236i\351A9{\021\037/u#\306\336PJ\261\244"
+	.ascii	"q\036\332O\2108'\357\304=\374<\037\227\335b\373\f\377\245Z\230"
+	.ascii	"~\314\315m\376K\334y\245\225\257\357\230C&\311\372\245\317\315"
+	.ascii	"L\371\312\355\230\374\314_\363\215J^(\366\311\374\362\341\213"
+	.ascii	"#k\233sH\303\177\333G\tvy\263/M\177b\2709g\230\034~\255<\247"
+	.ascii	"W\327Q\217\033\353%\r\354tO\334\255\032\303\267|\226\240?~\350"
+	.ascii	"k?\302V\363\375\224\301%.O\372\254\031\370O\377\003\371of\336"
+	.ascii	"\177{3S\363\373\001\274\253\343q\255a\356+pX\311\373\3269\023"
+	.ascii	"\306\207\360\310k\217\027\224`R\314\337\004\2276ou2\313\232\217"
+	.ascii	"h\362\251\323\362'\330|\214P\006\363\177\364\353]v\215\234!\344"
+	.ascii	"i\037\277\031v\272\302]\273Ncg\211\307\220\026\237\224\367\233"
+	.ascii	" d(>x\256\311\241\033\332H\371\271\220\377q\342\r\275\253\331"
+	.ascii	"\034Tl\345\316\031\202\237\335\b\236\3129GC"
+	.string	"\3100\036\032\371\270{\204\016\177\344\362\300M>\377\233\301\256\356\341\235\223N\323Pf\024Z~\366\373#\212o@\355\032m|F\333\304<\262\250\007\237\260\326\024\236\301\326\337\005\263\252\252\035\357\27234\256\372\235E\315Ij\001\204\0238\301\222\024\216\007\360}\267\356\264\256\034a??\247\276k\203$\270LX%\263\20387\033n\017>\332\310\367\332F#&\265\317\335\376+\367O\264^\203\354\237U\243\t\302i(\206\2624g\345\017\023<\212AnZ\374S\256\215n/\207y_0S2's\2578s\271L\207\363\355\326\361\025\364Z\255!\350,<\333]7\031o\366x\310Bj\325id\377\252U;z\177T\227A\220)\360\317\242\261(\370\225\232\234\215aHV\035\317\373\f\276SmD\370qZ\376`\274 \212\0178}\350|\377\335\3035\016\324\234\270\254\362\305\020;\310\240f\240\317\363\341\334\360"
+	.string	"-\323\323\366\324\355\023:\007\241c\310d\3671\3158\263H\323$\f-h/\321\367"
+	.ascii	"NO\227.{\376\211\342Qze\370\210k\376V\307\253\032\252\315a\246"
+	.ascii	"\362\312\2373\371\342\274X9\237\f\367?\354\341\035\215\366\231"
+	.ascii	"}\336\365\234\322\255j\227U~\273ur\r\376QWqt\263\262\367@n\333"
+	.ascii	"\377"
+	.text
+	.section	.gnu.lto_.symtab.f8b4114d1df4384b,"e",@progbits
+	.string	"osdConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"osdGForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"osdTimerSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"osdStatSetState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"osdStatGetState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"osdStatsDisplayOrder"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"osdWarnSetState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\003"
+	.string	""
+	.string	"pgResetFn_osdConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"osdWarnGetState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"setOsdProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"resumeRefreshAt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"getCurrentOsdProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"changeOsdProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"osdInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"osdInitialized"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"osdSuppressStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.string	"osdElementVisible"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"osdFlyTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"osdUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\003"
+	.string	""
+	.string	"osdGetVisualBeeperState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"osdGetStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"osdNeedsAccelerometer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\004"
+	.string	""
+	.string	"osdTimerDefault"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\004"
+	.string	""
+	.string	"osdConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\004"
+	.string	""
+	.string	"osdConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\004"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"statsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\003"
+	.string	""
+	.string	"accAverage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\003"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\003"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"displayClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\004"
+	.string	""
+	.string	"rxGetLinkQualityPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\004"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\004"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\004"
+	.string	""
+	.string	"afatfs_getContiguousFreeSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"sdcard_getMetadata"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"flightStatsGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\004"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.string	"osdFormatDistanceString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\004"
+	.string	""
+	.string	"osdGetSpeedToSelectedUnit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"osdGetSpeedToSelectedUnitSymbol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\004"
+	.string	""
+	.string	"osdGetMetersToSelectedUnitSymbol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\004"
+	.string	""
+	.string	"osdGetMetersToSelectedUnit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"osdFormatTimer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"osdFormatRtcDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\004"
+	.string	""
+	.string	"osdDrawActiveElements"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\004"
+	.string	""
+	.string	"osdAnalyzeActiveElements"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\004"
+	.string	""
+	.string	"osdResetAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\004"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\004"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\004"
+	.string	""
+	.string	"osdUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\004"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\004"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\004"
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\004"
+	.string	""
+	.string	"osdElementsNeedAccelerometer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f8b4114d1df4384b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
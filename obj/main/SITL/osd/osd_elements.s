@@ -0,0 +1,4844 @@
+	.file	"osd_elements.c"
+	.section	.gnu.lto_.profile.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001Y"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\211\n\345."
+	.string	"JB\264\017: \246Nc\220\311\373\240\322]\324$\221\205\377K\277\375\205O8\342 \353F\252D\\\233\341\n\021\024\335UTYgu\360\216*\253\367\231\336T\212Q\243M\266\334o\225-\311\035\335"
+	.string	"\361"
+	.string	"\355"
+	.string	"h\325B\016\274\340\020Fj\360=C\3043\006Q\217\272\206\347\022\255h\n\004<\277\215\307,\335\331J\260\253Xr"
+	.string	"!\200z\200k\035=$-3\260\277u2\216\356\215X\201\367\356\2233\017\023\035\002\357\363_\030o\260\220KJk>8CE\003^;Hl\206Q\002\224W\036\300\363u\314G\345\372\202j\353\370\346H\003<\301M\350_\033"
+	.string	"\254\323\225\311C\235P\230\254FN\310#\177\327\353\212\314\2152\271\026\346\247'\311n\300>*J\310\370\361\217?\036>\374\374|\2516\372\007\317\342\273\277\377\336\275\323\276\253*\013t\331\254\b\007M\256e\217fV\210\256M\371\230\265\306j\220\261}n\372\033\253=\245bw\315\022U'\345_\033\377\347\263g\037\2054\223\027\315\303\346*\366\350%8\f\337\264y\335`\263\244DTD\033,\024 \236a\215\267\203TJH\243\035{\343\2243C\3061R\2302o1`\274x\357\302\022\036\001\302\037(\213\300\221\352\340\336\\\264F?\265Ec-\264;\205\333cc\261\302\301\341K\3210\324\344S\241\267\304\254\323\024\257\232N\355A\361\032\345\006\231]\235`\337\224\213\2333\241\305D\331XK\304jp\336H\274wu[\245\336\371\022\321\200\301\237\220\202\344"
+	.string	"\t\362\260 g\220\2407X\310\341\250\210\310\216\325\006\267O \304=\0322`x\257\025<'8\002\004\317\nT\224Q\305.\274\327OF=\212\212\356\230/\245\254\353\226\205\367\372\300\363\227R\3105S\211\324\n-\230\323\r\214\302\341<\324\351\324\204\275\374~2vscu$\341\275\276\201\033x\201\037\277<\201\370yzt|\017\244>\340\217\337\002ZW2s\272]\t\361\020\327Z\r\361\031gE\023\322\233\253\253\322RE\252\364\244\322\324<\264\2447\005\304\367\343=\227\227\326\224\322\376\261:\273F\371\360\355\341\036\356\244\343\026A\355\240\334M\317\330=\331\337\035\276\221G:\301j"
+	.string	"\351\256N\\<Cm`M\262\362.\220[\224\t\207+\257ua%F}K\224Wj\243[\240\240\234\222\245\361/\355\017b\222\303o\335\257\260\255)$\306*#8\350\021'\277BZF`>u\002\245\025!\222\2543\365\364\033\242\2047<k\270\362\031\236\017\025\237]\335A\024\262%I\345\024\203$\353\264\026\347"
+	.string	"9F\331\242n~0\317\304\360\013g^\237\371\001g\336e>[x\005\n\024\256\257w\354\266\302CA\037\023\342\304\265\250X\017\036ms\203\200v\334UcHx\250\343\351\177kV\265\034\001,\334\204\376\265\311lXc\237\237\0265\207\301Iv!\254\261\265\fe\221\204~"
+	.ascii	"\313\344'\330W^\323t\302\304\341\023\2613M\312'{mg\330ZWvf5%"
+	.ascii	"\236\341Kj\227\330r\027\234\334\243U'.\2479;\324\353\312\\[0"
+	.ascii	"\211vq\257PRFsF\257I\346\226\315\030"
+	.string	"\255}}|r\031\244 \264\217b\316\332\337HCr\354\024\345\346K\266hqN\306J\276\231\032=\255\371J\033\007\361\036Q\312V\372x\355J\273\346*}\263G\201\323<fC\365d\212\223\251\226\037\361#\001\271\354\256Y\214{G&\321R\016\263\277\343<:^\203\362\324\322H\0278\006\007\206=\236\251\216Q}Y\234Z/y\021q\021\337\3129\260\253\275.\313\013b\2423\303\005\300s\373\362\035\242\225ma\223\207\266\376\030i\241\252N\311\262<c\t\212=\261\004\200\355\250Q%Q\304(gdF\222$I\007P\002BD5D\017\022\200\3441\005B\203J\202\231@\204\222\246N\251\003\200\024\377QZ\347\032\345\270*\370n\t\217\352_\202%\237^\270\213\351\354>\363\245ahK\240=z\370\350#\262\277\220\b0D=\365\027\326NJ\372\003\345\036\363+f\3476\266/\021\005F\352\200\203D?a"
+	.string	"\366\231\016B\006\235m\r\330\204&\312|\333\253\017[?*a\2152\304\033\316_/\\\316\212\270H\344D\273\367s]8EZF\272\364\255\265p\263~\\\215\235\0254\325\020\235\251\2635\234"
+	.string	"SdO&\335#A\3338Y\307U\035\364\375\323\361\343\006\342\360}\322\342\245v\334][\341\204\257\274\252\333\303m\2543W\206\027\026 2a\266\200\212\002\3206\216\013\301t\363\230\225\004-\002\273\263\371\354\373\211qV\301\303yb\350h\225\302\300X\337\273C{\363\204}\340\f\314\322\251\335\013\tn\220\227I9\203\233\215\211+w<&Aq9\240\374\204\0330\351\356\f\036\033i\026\245\340L\027("
+	.string	"\324\002\324\325\345\201o\210A\221\017\365\t\345q>\372Ok\367\220\207h\202\322\360b\315P\177d\375\201\353(I\347\277\375\371\ty%\342\205\221\246\272\255\307\375\226\f\264<"
+	.string	"\210\026ZV\370p\3760\217f\311\376\n\\X\252m\344\372\001U\311\335k\221\306\246[\"=[$d\372\f\214C\246\0063\262jCo\232\"\035\366\243<\235\342s U\301\027\200\031?\315\025\374|\361h\013\023\314vEL\356\261\347\252\301\307XMk\222\307\233\020\227\312\374Y\026{\207\321/\364\277\325\031\035\242oa\243F'B\342\035\023\003\177\334\375\372\023?\r0\366\001\3129\224C\325+"
+	.ascii	"58\256Gp\003\327\273:"
+	.text
+	.section	.gnu.lto_.ipa_sra.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\374\n\375\031"
+	.string	"\026VI@\360,%\351\314\3003\360\f<\003\317\3003\360L\336\215\034\3211\360\026a\353\355\267\201\327!\261b\366xTQ\351\177(\351\310\3577\372\037\377\242\245\272\301\250\013kl\223\374\374\336H\263\204\354\235d2"
+	.string	"5"
+	.string	"B"
+	.ascii	"\257\351\321qr\340\033\032\233:\306 \236\321\336\306\336K\345"
+	.ascii	"\030\210\312^X\344\025\355\273\265\277\207a\206\217\341\230\233"
+	.ascii	"\022]\236\331\266\266\ro\226U\212\023\001\035\006\233\277\270"
+	.ascii	"\264\2647\226\025\225\024\224\223\3334i]IKrk\335\036\311\332"
+	.ascii	"\323\353\327\377\371E\245p\2057\221\020\220\217\254\305\223\353"
+	.ascii	"S+\337\343\243J\205\2115\f\026\244\202\004\bn\007\f\024 0\200"
+	.ascii	"% \200\003\200]R\302f\223F\032;\3126*\302\211\2628\224\231\\"
+	.ascii	"\330\204\202\200\260?>=<\335\301\352\344\354pn\234M\263\273\232"
+	.ascii	"\336hZt32+T5\233(1\211\363\021\267\"\332\020 \262\177p\036\262"
+	.ascii	"w\3109\264\033\326p\206\354\030.\234\026Z\341\234B\373\225\235"
+	.ascii	"\360\256\357\255VB\326\334Gx\b\371\300\301m\360z\201\023\250"
+	.ascii	"\261I,\232d\331\f\001\005J1\b\335\225\007\022\340\304 \006\223"
+	.ascii	"\244aJ\231\031\221\221\031\211\263\307\001\345\013\037\fT9\244"
+	.ascii	"\216F\237 \344\020\225_\301}\"\377\266\250H\250b\222z78P\377"
+	.ascii	"\252\303\305Ju\274,,\215\037S\242\002L\214<I\377\027 \306\005"
+	.ascii	"u\035'%$\342fFQa~E\271\005\310\300\033\370\213\366+\304\313F"
+	.ascii	"\364\310\215N\222\200\276\002\211\024\231a\005\252-\023I\372"
+	.ascii	"|\200xX\3016\212\001 |\334$R'<[:U\320\251\006&h\202%\244\314"
+	.ascii	"\372\fo \200\270\230\202\236\377C\002e\034\017\223\347\f\244"
+	.ascii	"\226\216F\340\360\254\337nk804\025\203r\226\317\357*\236\222"
+	.ascii	"\217\317\016\005E\353F\216R\240X\002\247\337\252\322E\257\022"
+	.ascii	"\213v1\033oY\256f%\341L\221\214=\245\205p\254\367\241\223\215"
+	.ascii	"\327*\310i':\351\365S\345j$\223f\344?\f\342_[H\034\264L\325}"
+	.ascii	"\302\351\331\372\341[i\001\b4!IR\325\223V\203!g\221\257\036#"
+	.ascii	":P\3148\265\t\262A\220\257-=\003*\2331/\367\263\336\303\251b"
+	.ascii	"\006\243\233\276[\322\251I\203e\232\303\233d\310\332\bW\301!"
+	.ascii	"\214\243\001\206\013\247/L\375\252\302I\321O\277\210\013.\221"
+	.ascii	"}\371T6\307\244\376\300\213y\351\237\002\004\302:\326\"\376_"
+	.ascii	"4*9\323\3148P\r;\323\206\261s\203\324b\362}\036\200\034;ra\002"
+	.ascii	"nY6\344K\207\300:X B\004\030@\253\232\344\364~2\321-\032\227"
+	.ascii	"f?\366)v\n_\242D*(\037\031\217\332\276\231c\252\334\\\025\264"
+	.ascii	"P\300\256\207\370\235\274\270\254\310;\206\bn\036\3206\371\324"
+	.ascii	"Z\332\304\034\372\t\351\227\320\357\227\377\247q\037\275zG\363"
+	.ascii	"\257\237\207\276\020\323\200n,\260\245\002\231Gi\273\212\007"
+	.ascii	"&L\256\243\027+5  \t\363\327\200\004\005B\2479\024\336\022>\305"
+	.ascii	"\240\274\256\224Pe\302\305'j\032\273\023\360\001"
+	.text
+	.section	.gnu.lto_.inline.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`,!mW"
+	.ascii	"\352\\4\024>0dN:\021\310\306\320\367\345\332\003\265\031Q\321"
+	.ascii	"b\0045\274\034;\2002j\251\225\302\302\343q\212x\256Z|\350\347"
+	.ascii	"\373\325O\032v\177rO\376\277zbz\305\300\2217?R\304\222-w\n\027"
+	.ascii	"\0014\001F\001=zoj\310K\277}\262\335\272Mb(\026\204\335-\321"
+	.ascii	"_U\367\211r-\321C\256R\235\352R\303-,\3159K\235"
+	.string	"\200\330\372wu[`S\257\355\3521\201M\275\247O\375\310,\256\377[\251\326eo\200\332`\025\260\f\230\020\256\f-\303[.\314\326\244#\205\342\302g\232t\244\304\027\377#\325\344\360R\377/\022?\352G\346\305J\334M\277V\217\255Y\313K\200\345\370\304\254\0248\333\343b\342\237\354\250\372+|\242V?\275\351\377\221\031\245\376H\274\342\353\226sv\372\nu-\354\246>\253I\364\035\321\367\375\27354\336\230\305\376\352\3116\257\277\223_\375/\242\357\177\fD\310uB\270\212\350!\037\376&\3613\347\\<\246z\262\3430\331\246\364\325\253\357$\236\206\001\204\345ja1\320I\231\210\177\027\036,\364#x`\210\357\217\177\325\367\370\327G\337u\221\004(\340\335od\347\234\225\353\277\325Y\r\341\241\016\375\037D\337\337\337\255vSCxH\301\357\365\005\306i\224\3768\264\\\231\224\345\203\207PJ\365\257\270"
+	.ascii	"\374\203\233\207~\207/l^\364\f\373yr\202\312\024\317!\311b\256"
+	.ascii	"\226\262\341\251\361\227\300f\036\242\240+l\364 \364\217}`\300"
+	.ascii	"<?\321\006\327\320\006=+,|\2026\227\363\361\034\303\217\314*"
+	.ascii	"2\204\310\332\020\021\177\037\230\020\221\234\331]\236\271df"
+	.ascii	"\350y\257\360\224\266\325o9+\213Xr\316\006~\364\\\316J\b\247"
+	.ascii	"\260\036\252\342C`\247\376-5\374P\013C\357\312@\207oV\013\027"
+	.ascii	"\332\322T4\374\017\354<C\205O\207W[\362{\223/\350\022\214F5\032"
+	.ascii	"\241\237\375;\020\236\372B\341d\343\301\201kC\\6\235N\007\375"
+	.ascii	"4\371\216\034\343\037\f\377\3336\335\033\245\336[(S\377{\271"
+	.ascii	"zK\243(S\001\353[\f\242\013\327\211\251K3\256\016\356\315\370"
+	.ascii	"!\372\236\253\365\0320X`l[\226\275\354\317\342_\265\215\365r"
+	.ascii	"\316QO\200\340G&\316j\246\325=2/{\025K\345\201\301<\212\363\274"
+	.ascii	"g\221\330D\337\256\264\232h\257n\300\263&Y{\003IVZ\240m2\276"
+	.ascii	"\325\253X\335\227V\367\354\263g\003bgh\210c{\323"
+	.string	"h\200\037a\327\276r\352F\340\332\372\322\2322\221\265\t*\366\357\354M\243S/\362#\223\310\327\220\273@h\034\013Et\207\007A?\n\237\261=\252\013\t\342\365cL\311\\\262\213\376\374\b\027\364\t\241Z\336\252\356#\013\343\256\037\317n\330\372C\261\302Yr\016\033p\256_m\215-\017\274\206\367\367\354))\303:8o\350\356R\300\267\016'\335\023t\302\203\367\247\306\351I,%\226\222\215\313Y\331\036\371&6\253\317&\255N\216\370\036Q\254\257q?2\243\324\247N\324\177Ca\264\365\007\322i\324\024\215\311\001\244\007\t\211\221\331\360\035?2\001\f[\365\315\2435|D|\261\233Jo\334\245T\305Yx\315\374\211\343\277D\250_\331\236\234\266\257%F~V\246\2147l\324x\2574\2600\036\033i\337\260\307\3348\247c\246m\004%\264E\342S\326\3413d\304\3509K\2752\342a\250n/0\261"
+	.string	"\243\234\225\r\356\342yl\321\224Y\334\213fP!\260"
+	.ascii	"fkuX\032\rR\035\263\270\213\351&\206\230\355O\275\304\320\r\031"
+	.ascii	"K\212\244\372lvw\236\001Nb\204V\277-\035\371=\375]\0300\227\366"
+	.ascii	"\311Yi\365\313eP\2354\202\367\257_\230\210\312\245\273\374e\273"
+	.ascii	"[~\247\373@\261Ck\353\334\033a%-h{\270\360\275ch\217\002=\357"
+	.ascii	"W\315N\016 ,\003\274p\366\002\346\234\360\233\366\337\376c\b"
+	.ascii	"\f$\366m\220\022U\237\256n\016\216\352\027\rG\243\277V\25281"
+	.ascii	"\272gfH0\326\351\227\312\367\246\210\210\203RhT\337\321\232\265"
+	.ascii	"=\305\337)?2\357-\373\221)\r\3139\023\370%\303\353\363.\263\244"
+	.ascii	"\2713t\377\312\244s,\236ZT\332\2729\321\350\212\277Rn\024\272"
+	.ascii	"\266\276+\305\337\261\377\206\265H\025\322\333\240\240\325\272"
+	.ascii	"\242\321\272\242\277\032_"
+	.string	"\232{\303\004\341\027\212\211|\301X\026\343\365W\251f\251}\343[\242\2128WE\177=ZU\364\327]\251Z\013;\317\232g\f\372t\203R?\013\376\344\202zd\262WW\331\253?p\177\234Gv\276:\022\257a(\372\246\350{wQt\220\347E\321^\367\357\353D\322\212\242\207\334uL\301\235<\233\270\r\212F\031\366\377\240\360\001B91Q\361\245/\371\177B\311\341\310\332\372\210O\202\204\314\016\237XS\241\202\254\250R\363R!\207 \232\221\024$\031\326\302\t\020\214\242P\026\007\212\366\001\022\200\"\201\020&)\245\0202\306\030B\"\"\"\022H \022$I\222\034+\201a\312\376_'\302\352\220\262W\311F\227X#D\201W\035\323\241;\024\270\206\336~E\215\332r\307E\341mx\037\214(\361<I\334\252\200\350\020z\026*5\270\265bs\353l\235\272\345e\376X\312\247\023\267\223J\244%\230W"
+	.string	"O\300\350\303>\301\316\016g\017I\346\026\240\217\030f\036l\312\365\213\333j{\340]\270J\257c\322n\237x\245'\237S\200\365\371\370\251\n\307&\337_\200\3717^\f%\355!\r\256\335\326\311\266mk\200.\266F\t\363E\245\301\b\252\004\201\205\220\215\310\317\220Ja\036\251N\356Ko\215F\362\211\377\300\030\366\003\2238\332\273\036r%\020a\373\223\022\251\263$\213\272\330\322\206\245) \361\306\247\231\035T\361\353B\363i\177\351\024\bap\307\322\207\"w\020\027]\373\r\026O\351\336\032\023\376\273\274(\204\314\260$\252\351\2458\330&Rb\333i\330\362\211Qh\314!2\257\366\223\305\206\235L!\342\3245Vc]\253\370\005@\260\327\304\223\207\310\233yI1e\366\317\234\032\300)Kp"
+	.string	"a\327\264\001X\2433\030\221S\223x\361\366\251\253O\376|\352\276?\001\353\353\"g\271L\355\311\377\260\272#\354\035\317\202\004\256'\300\023\033)\n:\036\310\002\035\373\310\263(\210.\202n\007k\026\214f<#\262\"T\347[Y\\\020<\354\n;\b\225\230\337\224\335.\342\034\370V\352\233\f\020T\214\26188\r>\277=?\206q\025\352\261\242\t\227\373\254\bmx\265\225*VrS\201\246\255\340\354\030p\033\204"
+	.ascii	"H\026\013\265\277\261\240G]s\254\247\354\243\267+4\357\320\303"
+	.ascii	"T\211-=>Y\317\370\213\003\2221l\354\334\271\376u\300OS\366d\004"
+	.ascii	"G\352\325\316\372\337$\t\f\215\004\202\330kbJ\301\354r\272Y\372"
+	.ascii	"7\323\317\016\300`\202\327\357Z\346\211\030sp&\272\250\003\025"
+	.ascii	"u\032\253s6\274\037\005\203\305\264X8\017H\354\032\027i)\257"
+	.ascii	"\320\177\217\004\t(\2144\3724x\353\320\263\214\004+&\260J~i\225"
+	.ascii	"\321fL\232B\244W-*\263kR\365\210\353\345\024b\3310\337\b\253"
+	.ascii	"\021\275\253OK\247\330\260\234\277\201\314\023M\177\200.D\001"
+	.ascii	"\230_\005\027o\304\365\211\020\200--V\007\236\330\252w\234W\r"
+	.ascii	"\307\030\362(\240\027\347\032=\317%:\024U\261\222d\312\275\337"
+	.string	"\0347\276\273\017\304\360\277\351\354\255\307\243"
+	.string	"7}{\325hU(.{\311\357\255\232sM\240\375\340(\344 \036\310\226\353\253\3151x[\202 \027\307;[s\234\221\006\023j\213R\021\007b\226\\L\356\257,\225\375\352\340O\277\311\1771V\205a\302\321\020\253\261\207\363\177\377\3502|vc\216\226<\336P\361.\261o*O\257z}bL\b\312#E\276\005\235\227\336t}mu)@sm\344\300\250\320\201(.<\301D\375g-F\026\314\267\336VZ$\335\354\254\306\346\205\357\013\251\307\\L\001\257F\r\331\266\b\214\227W\001\016v\nb\252\242\274N\205\227"
+	.string	"\026K\030e\376\345\364\r5\200~.S\260\335\254=\263\224\030h\332\302\274`\316\3612\003\264Db#\031d\350\346\365p\243\031\337\252\247\374\375\214\313\310QQ\377eBk\301~\255\277\331\303\005\351\214\340\331*\263\214\300)\347\032\263H\222s\320|l\0314\367O\034W\022\305j\330\0315A\236R\220R\036eMw\317,t\214v\334\"m$S\275\332\272N\350\335T\357\235\242\027L\214\251]h\315\356pA\362\ta\274\253\251\273\347\\I\300\327\303P}\220\247\331\266P\342\035\330\300Gi\361Kfk\317cRF\242\261\026\300\265\230\276d\366^8\317\273u\305\003\353W^\316\335A\231nG\376\236o\324] \312E\272\367\313z\330\217\036\"\017\216\223\363\004"
+	.ascii	"H\342\367\316\210H\242\215%\266\342^\252\260\027z\307\026\303"
+	.ascii	"\207A\207]#Sp\001\273r-\236,a\224\375\230>\006\203\2016M\363"
+	.ascii	"\251\376W\352\254\335u\342\"\"WE\361\356\223\006n\201\032\273"
+	.ascii	"3\2524\314\032\343\341\313\362\024\r\336\002#\246\350I\214\236"
+	.ascii	"\177%\352\317j\275/\bsN\260A\030\214h\373x\245\307T\241\314\321"
+	.ascii	"\030)\270\3403\211t\033\340\341\211\211N[\316rEQu\356\263\245"
+	.ascii	"\205,\322\313\206\336\377\0346}M1!*+\001\bo\344\312-\212\263"
+	.ascii	"D?\220\266\242r\200\032\361pA\335\3315xZ\355\214\2166\003\rU"
+	.ascii	"\023\202\217\264\317\276\fE\276\301\255[S\205\3102\031\374{\361"
+	.ascii	"T\243\234\374Mk\331\214\212jD\310>\324\017\304j^\t\322\203\253"
+	.ascii	"\232\263\236\227\020\231\264\220\304\341|\353\341\217\f\220\373"
+	.ascii	"Z\312\024\201\332\367\266jI\214\246\022\300y\235\01315\240\353"
+	.ascii	"\t\224*\2202\202\243\367\020)\b;V\003O\r\211\257\001\222\355"
+	.ascii	"\214\377\331\177\205\0364+O\0333N^\001\354\252X\037\214hP\313"
+	.ascii	"-\\\232\363\220\271V\216\274\3516\357\327_\312`\316\244\355\235"
+	.ascii	"\344`\260\244\333\350o\354h7\313R\317s\344\331\363\277\3058\264"
+	.ascii	"\352\034\202r\300\222\366\344\3453\227\306\211\036\376\352\b"
+	.ascii	"\024\206\273\017\350\221\304\310\305BO\026p]\303Q@T\002\365q"
+	.ascii	"\362R\324\325\301}\241U\346,\004\211t\006Bn>x\326\344Z\366\320"
+	.ascii	"\035\241?\177\357\377Is\337J\0350\001M\206q\005"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`v%\325R"
+	.string	"\372VT\022B`jQ\007\335\311\253\017\200\333\006\034z\227\037M\326C\330\013T\203\334T\376M$\020\374\027fU\365\223\277\234\236\252TCE\300\214\304<@\341U\223\352\267\037\030\213\243\241\321\202\006b\222\273m\231R\n\b\001\f\001\031\001I\334\311t2O\362\300\367\370\322\322\345\371?/)\211"
+	.string	"\001&&\233\315\353\270\224\243\371\237h~\2668w2\261;\231\357I.\345\300\277)\352\342\301I\023\r@\250\267[\007-\224\303\361\037+\033+;\343\234ql\204l\204\332\026IF\206\353\354_\352\3058\275\271\274\271|\335\177\323\267\227a\340\265`K\0012\017N\002\325\213z.\367\340$\005\357\\\346\006|\353\336o\357V\273\262\262\247\316yH\036b\"h[\333\266|p\222\247^\340\347\255\317\267\0039\373\301\311\246\002}\356Z\336"
+	.string	"/\343N\306\377\340\344-\327T\300\r\212\357\234\335\221\201\314w\344 \234t\365b\246,\001\217\203\237\257"
+	.string	"\350N\245\253\357v\327=\2246;\004y\361N3\337\037\343\357\353nk"
+	.string	""
+	.ascii	"\034\312\374\316^\236\265\227g\336\335\271,{\357\357n\372>\367"
+	.ascii	">\237\356_\303\372|\335\257\371\355\255\273{\371\237\257\334"
+	.ascii	"\375\266\213\376\016\335\f\n\004~\335\331\264\247\247KD\351\370"
+	.ascii	"\370M\\\262\022\271lo[\016\237\203\032B\240\031\315c\356HC\246"
+	.ascii	"\373\031\207\357\374N\226\341=\177_\275_o\261\313q)9\216\364"
+	.ascii	"q\305\304\177\211\357\334\311\354]X\357v\336y\314G\321^\206w"
+	.ascii	"\217\364\001\254\373\252uG\036R!\376\377\265\350\320 ?y\3224"
+	.ascii	"\255\321\330\030\213\245!\377?C\354\320^\375\037\306,\344\337"
+	.ascii	"\347sQ/n\230\006'?\213z\273\270\272\333\314\354l\333v\212z[\330"
+	.ascii	"\215\\\303\006'\037\212y\273=\222Z\355{\340p\336i\377\214\020"
+	.ascii	"\351t\201\224\224\332\340\244\333y7op\322\317\274\036\377\377"
+	.ascii	"\362X\324[>\032Nz\024\365\226e\371J\324\333%\260\3374m\255\313"
+	.ascii	"\301I\007\242\336_\343>\356\203\274m\245\374\375\266\255\343"
+	.ascii	"z\357\353u\367Z\226(\352\3109\346\177\367\006\027\343\357f\334"
+	.ascii	"\317\274\274\335\034\231f\276\206\316\320\266;H\f4.\274\035\234"
+	.ascii	"\\a\2411\316>\241\253<S\351\003\226\352\230*5[5\225\036S[\277"
+	.ascii	"\0327`\340\300\2014\316\343M\351\316.\005c\022Q\224(!1\342\257"
+	.ascii	"\331\336\232\301{>\311\345D\3745\031\371\275QQ\216T\324:\224"
+	.ascii	"\351JJ:]S\023\023\323n\367\364\004\001\202#\025\231N\004\271"
+	.ascii	"\007\362\377&\214\274D\323\376\306\335\215\277g&\335\276\244"
+	.ascii	"\023%*\305x\222nG\002\374|\244\333Hg/\322\271\334\242^`\222\373"
+	.ascii	";\221n\037\342.$@\200 \274\377\342\177\305\223\212\024\t\030"
+	.ascii	"\003\006\313\256m[\377\321\371,\251l}\356\345\013\356\003\370"
+	.ascii	"\271\207?\312\341<\242\370\233y\217C\366\326\311\332\254l\202"
+	.ascii	"\310\374\\\nQo\267\215\372l\375\022R/.\370Y\353\"w \277\274\351"
+	.ascii	"\350\333\346\310\302\321}\343\002\032[Z\342\3636\372l\337\212"
+	.ascii	"\377\305s\351\324h\333S\271o\324\213g4$Hb2\256\231\0300n\227"
+	.ascii	"\027.\264\264p\360,n\025\365v\2578\035\312l?\257Ttw\212\356>"
+	.ascii	"\361e\376OO\374/\024\365v\3074\327\307Z\363xV<\236\331SSVSSf"
+	.ascii	"\343\232\245\262:;k\275\235 =\246\265\326pL\313f#\030\201?\256"
+	.ascii	"\265kD\330*\364*\006}\272\237q%\342\240\227\255q\243,\225\357"
+	.ascii	"\307E\\\213A\337\255Y\252\004E`\202Z\367\212?b\255k\215\265\032"
+	.ascii	"\213C\255Zw\021\215k\255Qbp\255\365\220\330[k\315V\245\307\324"
+	.ascii	"\354c\312\036\323)\366\326`\254\204\264V\225&\265Xz\373\007\\"
+	.ascii	"\213\2500\270\002q\355\025\024\002Q\255\342J\354\241\270\326"
+	.ascii	"\352u}\255B[\203\r\205h\260X$\336:\314\030\024\256_\035\320\255"
+	.ascii	"\256\240P\327`\303.\324\327\265\nQ\\\377~D\240o\375i\335:\214"
+	.ascii	"\370C\301\206\302\\gu\005\265\214\303!W\261G\314\265P\370\005"
+	.ascii	"D1\240F\343\212\225\353(\024\245\302\3651e%\244f[\211\245\270"
+	.ascii	"\263\222\232My"
+	.string	"lj6\215t\204\2578\2645;!-[8$\226m\fz\225\r\266\206\225\315V\245\250Xz6[!\305\315NH\321,,\237\200f#\004\202\270\250rZ9'\325\214\210$\005)J:2\n\020\b$i\036g\271<\022\340!a\214\")\020\303\030r\306\020CH\221\210\210(HA\222\244\003k\202\247\331\007&\b\331c\207\3507@O\376y\">\376\313\336\235#\307\035\276\360\271\207P\t\"{K\243]\342\301A\215\204\243\212n+\024\226P\234\271\207ei\235\243\276p\3140t\234\026\302%/3\235\321l*\356\303|\007X5\001;l}!1O6s4W\021m\023\344\242\2359\023\"\371~s\234\374\250\300d\nuF(\370\247\262\"\n\263Q\256%\242\026\253>\017r5\003\272\277\320\347\340fH\031\263tf\177N\343\022\304\023T\251\271\270\t\373\371\347V\341~~\252\271\350\231d\n9"
+	.string	"C\365\302\235*\rb{2A\221\321\353\366c\226\250\277\324G\215Q\177\250\237\351.\350U\r+ D\267*\304\317v\240%|0\355k\344\212\223Y\377u\327\355Tj}m\351#6\203\221<\276/Vi>\340mX\333\360)\341\217r=\003\236\353\032Tl\f[s\253\001\225\022\263\365_\251\333\266m\254%\320D^%Ja\214\021\267\271\246\027"
+	.ascii	"\320\360\306*\356\203\177\002\2750\352\221\362\352iv\215\375"
+	.ascii	"\242}\365\024\021\214O\224I\253:\266\345\221\357Q;\236\030\032"
+	.ascii	"\025\243\243\t\260M\204\005\302\007\\\342^o\216\247\r\206\301"
+	.ascii	"\257\262!\035\272\025\221R\340\260\221\020\243\007h\303\310\274"
+	.ascii	"U\370\240\352\003\221\237\232\245r\310\222\177I \364\024\316"
+	.ascii	"\337\322Z\260S&\0279\322y&\311\205\201\026\317h\333z\250\347"
+	.ascii	"\254\214\325bC\273\241\315\024\334\231\205\033\005\202~\216\240"
+	.ascii	"\030\363O#\2415\244\306\261\232P\315I\277\337\264\317\005Z\245"
+	.ascii	"n ~\372\304\301\005\235\f\241\006\013\217M\220\r\322\356^\\~"
+	.ascii	"\372%!M\276J'W2\352x0l\021\251r\035\255\3126\325\312\216\362"
+	.ascii	"\323\260\205\370I\333>Z\310\315K\214\023m\307\327\362<d\333c"
+	.ascii	"\032\365j\027\212&F\253\002\313\355\325\264\275\336^\203\226"
+	.ascii	"\026\032\245\f$]\255C|\r\201\214\264@5\021\371\"c\r\310\0326"
+	.ascii	"17bw1\312\021\3139\177\211\375\034\220\302\027T\020\221\345\363"
+	.ascii	"\205\207$\323&\212\353\210\\\360\221\276nA\257\226\002\fsi%\023"
+	.ascii	"\036\326\374\241\360he\232>!\325^#\221\370\002\274\325\217\016"
+	.ascii	"\277\362\377}S{\366\037o\366v\020Xv<\035\032`\032\221E\342\250"
+	.ascii	"\253N)\273\264kk\3464v*\036\300\351\222\013\256\213\354\033\370"
+	.ascii	"\224\363\307\335\255\257\020(9x9\203\362W/aZ\215\226+\242\220"
+	.ascii	"`\030*\372A1\036t\244\313\325\"][\236-\305\334\376N\205\253B"
+	.ascii	"4\022\212\331\310(\2661\305\234\320\026\306D\2647\214\223\211"
+	.ascii	"\372\025\347~\\\027~]\224/R;\211\344\270\245\367\020\\c\300\240"
+	.ascii	"Z$\307\322\306\226\030\327T\274\033I4\341\226\302\247p\343\b"
+	.ascii	"\225S\264\315\335\177\217\205\243\266\223Ewr\235a\362\032"
+	.ascii	"\241A=\2313\227\226s/>\323\033\305\3761\272\026\213\036\256l"
+	.ascii	"{\365j\034\353(z\254c\272^\320_\017r\266]\033$\233\0338\207u"
+	.ascii	"y\311\317$\206\030L\242\341CouS\2046#\016\337\312\305O%\372\337"
+	.ascii	"\337\3243\254\033M\304D\210\033\231d\0252\201 [\006z\022\276"
+	.ascii	"\311\323\3232\033\323j\275Qtz)?\2208\006\t\220\021\322g\2712"
+	.ascii	"lP\347v\017Z4\267\031\365Q\255\357g\361\212}\217&\2039mB\031"
+	.ascii	"wf\225\2570LH\351\233\237\254\326\313$\272\227';\332&\256\356"
+	.ascii	"\270(e\363)\177\212s\365\034\024o\360\377+\350\253\017!M^M\322"
+	.ascii	"\276\203\230\330+\366b\004\3753\236M\3036\036z\2503\371\340}"
+	.ascii	"h\310G\322\366\260\341\023\017\252\200\201\223\256\351!\032\366"
+	.ascii	"~\230\267\251\213:\234&'\302\253S\r\344"
+	.string	"\341\222\311@(\017\340\3611\026\350(nA\030\326\311-\327R\337qV\314U\356\354\326\3458tp3>\252\212\255Il\2237\266\202\247k\")\357\360\343\377G\350\3214\216[\311\301\233\244\330ZPPz#\032Y\275)\310i\n\r\274\336/\341\023=\026\030l-\2227\367\027\250\roz\206\030\327\202\006|\2055\034SMt\032N:pQ\r\326\355\274?\311\331g\006?\"\313\263\365\342#/\367\321\255\251l\242\033-\361\264\317I\260\223u\243\334L2\021\341\222\266\346\241\032\006\353\333\353\326\342\340m\335rr\366\301\374U\260\344u\346\300m\277\376\352'\221\334\337\230\034\314cm\203j1\022[m\244\r:\2711\024\270\361\362\343\254~\326\312\211>f\212\332\340(\324s\260\311\207R\035yy\311\004\033{x\227\305@\271\022\365\363[\211A\305k\266\315\347\225\227-!\r\272\247\251\302\b\t\363/\002"
+	.ascii	"\366_\342\t\"\270\247)H\017\210\032/\223p\032I\366l)\333Mv\026"
+	.ascii	"\032@\372e\bm\\\361\202\373*L\003|!\361\2102l\340?\252\264\021"
+	.ascii	"\2647*A\333<\327\203\255-\370\342\214\207\230\341mX\273y\270"
+	.ascii	"\200a\373|\234\346\27453\216D\025\324\r$n\0340L\325\037\272s"
+	.ascii	"\340r&\227\227\215'\2078?\377\3014\263D\273\201\273\245\221\373"
+	.ascii	"H\370\f!=cC\034\354\341\257\321\314w_\342\333\213_\221\t\243"
+	.ascii	"]\303\"\037\254\267\205\331\317\211\242\237YL\250_\234\312\270"
+	.ascii	"Xn\025\367\304\323\236\207\013e\216\302\037\005"
+	.text
+	.section	.gnu.lto_.pureconst.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"u\b"
+	.string	"\006\226B3\300l%\351\300\352*\212\242p\004\335z\332\300V\231\321\231\260\257Z"
+	.string	"o^m\360S\023[\314\024s\372\333\006;l\367\220A\246\002\276\227^\373t\306\266\0016"
+	.string	"4"
+	.string	"2"
+	.string	"\211rO\256\311Yr\222\334\221+rC.\310\375\270\036\267\343\344\270\033W\343f\3340\256pq\314\342VqFqN\234\022g\021g\020\267\207c\016\347\013\366z\235Qg\321\032\210\306\241+4\006]\240\361\347\372\214=#\317\271su\306\234\213\363\206\233\323f\254\031i\316\231Q\346\214\031a\356\313u\271-'\313\271r\252\234)\007\347ew\300(\340\0068\001\214]#\327\270u\265n\326\305\272W\327\352\254\272T\347\324\225:a7\352\204\272O\243\323m\032\231\356\322U\032\223.\322y\024\267\3130\036\206\361.\234ga<\n\347M\270'\341v\021\356A\270\335\203\33398\257\301=\006\347-\270\235\202\363\022\334Cp\357\300\275v\236\201\333\025\270G "
+	.text
+	.section	.gnu.lto_.ipa_modref.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`K\n\335\034"
+	.string	"\226\240lF\300\324M\206\003\272i*M\233\242(\206 \b\022Pj\356\227+\bB\230\206\303'O\004I\017c\225\005\027H\240Z&?vs\236C1\360\264\204\320\202\005.\251\247\263\323\316\251ue"
+	.string	"\354\315]\352n\215H\231\002J"
+	.string	"X"
+	.string	"f"
+	.ascii	"(\260\003(\312w\f\364\332\311\324)\327\251\t\013\320d\316\224"
+	.ascii	"\347t\342\224\343\224+\354F\002\034\360\227\002\276\273\001("
+	.ascii	"\257\225?\353\007_]\367\374\246L\035l\316i}\335Z7V\277O\233r"
+	.ascii	"\233\316\232\316\226\267\334\265Q\276$%\377K\371KgKy\013]4\260"
+	.ascii	"%\303A\345@,cxU\275\026V\317^\260\300\n\024:\341\247\323\247"
+	.ascii	"\334\247\334\022f\257\002\353:F8\351\206\360\003\007\266\006"
+	.ascii	"\204\351\351\264\025\326u5\030\031\004x?\037K\271\212\262\026"
+	.ascii	"\244(X)_\211\2354E\371\\\002\004.\345<\001BA@?Fm\317\222\215"
+	.ascii	"g\347\212:EmNm\332\312\335\320ljJ\324\356\242z\316\204\353\275"
+	.ascii	"\367\246\255s\250|\250\023\246\034\246U\242WN$F\314P\004W\344"
+	.ascii	"9M1j\310{\221d\312\307\223\"\221#\257\351e\005U\365\236\202<"
+	.ascii	" '^\017#HnO\210\325/T.D\305\020 d>x\210\351\300aC\317bh\262\326"
+	.ascii	"1Yl&\233\305\320d\257c24\225\326\357x\035%V\314A\363\234\226"
+	.ascii	"j\\OZa0\362Pz\341\240\371\0336\244\222\312E\3755h\314\220\301"
+	.ascii	"\030?\214\241\350b\246}z$\262x\244\327#\235\330\364\235\213j"
+	.ascii	"\026\037\307\264b\351;%[\022\221\216\214.\":*?\n\200\351\250"
+	.ascii	"AQ\245\210$H\222$Y\016P\0022Re\344\006\022\340\324 \007\224\216"
+	.ascii	"\020\" \210 $2\026H0I\262\006\013\2200\277\223\200\t\331g\004"
+	.ascii	"Q{\372\2503\345\357\307\302h\001\216\020*\231\203eB\332(\021"
+	.ascii	"\035\306\277G\345\025\213\252v\226}\"\262\336\2565v\210A\332"
+	.ascii	"\236\321\2435\332\342$^\271I}\370u\211\324\006\370\211\253\260"
+	.ascii	"\204\244Iu\311\336\331\020at\366\252/\026\033`4\373\325J"
+	.string	"\035\200\201\320\020\353\227\341.Q\221B\242\275\306\361\320I\356\235\026\3125\r\214\371\001\224\r\320\324\232&a\376\377\303\202\372\212\204\236\024u\333\007;\367&\315\300\246\317}\220\253\236\020`\020R\202\255\276\311G\350\017?@\204@\326\312\275\315\353E\021_\\|\033\256\252\007I\240_>a\364aA\026Z\270\r\272\005\030+$L\033\rae$\352@\231\304\244\364\352$\320\257\331\337\377v\022}\203b=\222\030\213Pi\262\2201a\032A\364\016\306\037\276T\313\216DRd(\326\3558\210\241 t\370w\325\304\376g\031\026 \024\310\326\347|J\342\337\017\373\350\220\211k\306\255)\244A\255\311!\355\244\271\214\315\353\302\337\253mp\340\352\f F\274g\360[s\247\\\030\320\3470\314\3071V\003\217\236*\025\\1Kv\036\216z\304\363$%\222\215b=\350\327H\203\275\350\251\322\240\215$C\257\020\372\332"
+	.string	"C\256\330\363F\234\307\273\257\007\265\305q;\214\201@\327\301K5{U\340T\343\325\001\b\n\324\206\213\223\260V\245\002\205-\b\202\031\261\254\307+\374P\221\301=\254\343\006\002\265\343c\001\346\210\377\2768\202\026w\340\334\024\203\346\373A\263I\221\"\245/\305*\022\036\232\003~\020\357|\033\033\0254\242"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_.lto.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ahRollRise.96.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`g\006\035\036"
+	.string	":A\240\rAp,'\035\300\300\003\003\037\321\301\002\013,0\244\212\220*B\252\b\344\017\365N\315B\226m\216=b\026\2629\366\210\031PR\240@\277\340\017\340\037\261\273\273\273\273\273\2735\265F\324\032YiS\"\001\324"
+	.string	"\303"
+	.string	"\314"
+	.string	"T\267\023RMy\275\036\325\324\207\243\232\376fTS\240\213j\032LQM\205\303\223\250\246\304\"\245j\312\364\250\2326)\252\246N\205\252\351\023\240j\n\025\265\247\232J\331\251\246Sq\252)\200\261jJU\025VM\353W5\265\352\252\246W[\325\024\313K5\r\220\245\232\n\240RM\007\020xRM\013(\251\246\006\016\024\251\246\b\022"
+	.string	"\251\246Y;\252\251\226\215j\252 F5]\300\242\2322h\340\023\325\324\301\003\021\325\024\002\210j\032\341C5\225\340\241\232N\350\2605\206\003\227\0062\031\312`\3502s\301\313\302\231\nh(|IH\323"
+	.string	",K\315\232\002aXl\304\250\332\270\201\032+\276\001\222\355\340\334\312\342\320\344\370G\232\212\370\253\351\350\r\343H\037\0052>\3434^\3436~\3438\236\343:\276\343<\336\343>\376\343@\036\344B>\344D^\344F~\344H\236\344J\276\344L\336\344N\376\344P\036\345R>\345T^\345V~\345X\236\345Z\276\345\\\336\345^\376\345`\036\346b\276\3651\347:\231\227y\327\315\334\353g\216\346_Os\260\253\371\232\207\235\315\305\336\346n>\3667';\234\227=\316\345|\316\351\274\316\355\374\216\326\361<\317\365|\317\371\274\317\375\374\317\001=\320\005}\320\te\275P\202\020\305\262\021+JL\300SM?\247\232\316\310\252\351\212USJ\202US\232W\345\252\246%\230jjn\251\2466+\325\364\026\245\232\2368&\3254w\244:\213\365\36437"
+	.string	"\324\317\\\001Q@\333\016\210\002\332v\200\024\320\266\004\244\202\266%0\025\264m\201\251\240m\r"
+	.string	"\020\336\366"
+	.ascii	"\225\360\266\b\250\206\267MP5\274mV%\236\253U\211\347jY\021\317"
+	.ascii	"U`U<w\301U\361\\\006XL\270\035\355\305_\f\306a,\306[\036c.\223"
+	.ascii	"q\031w\331\214\275|\306h\374\3454\006\263\032\257q\230\331X\314"
+	.ascii	"m\354\306c~c2\303q\231\343X\216\347\230\216\353\330\216\357\030"
+	.ascii	"\217\363X\217\367\230\217\373\330\217\377\030\220\003Y\220\007"
+	.ascii	"\231\220\013\331\220\017\031\221\023Y\221\027\231\221\033\331"
+	.ascii	"\221\037\031\222#Y\222'\231\222+\331\222/}\304I\274\304M\374"
+	.ascii	"\304Q<\305U|\305Y\274\305]\374\305a<\306\003\3438\216\353q\034"
+	.ascii	"\327\036\307\275=\216\273\263{\351\354^\272\367\222;\363\222"
+	.ascii	"t\346\245\321\231\267F\356\267\244\355\327\244\321\257\255F\277"
+	.ascii	"\267\222\234\355Y\222\263=Mr\2668\2236\333\234\2156[\335\255"
+	.ascii	"\266\273;k\273\274\263\334\345\341\312\335\036\256\334\365\345"
+	.ascii	"L\272\277\234I\367\2473\351\002u6\272\301\235\215\256\220w#w"
+	.ascii	"\310\273\221;\354\335\310%\366Nr\211\276\223\334\242\357$\227"
+	.ascii	"\351\207\243m\023\020G['`\216\266O\301\034m\241\204\272\332F"
+	.ascii	"\tu\265\215\032\352j+5\334\325v\212\270\253-\200\"\257\\*&^\271"
+	.ascii	"UL\275r\253\232z\345\326\246^\271VN>s\257\234|\346^=\371\314"
+	.ascii	"q\250!\204\"\264ec\377\016\300\223d8\0208\022\240\226t\275\322"
+	.ascii	"@%\005\222kh\245\237O\330=\023\036W\362\336wdA|\3237Q\224e\302"
+	.ascii	"\343J>\033H\037\375\250\302\276\311mGa\324 v\031\212\b4\220\255"
+	.ascii	"d\"\004\201L\204\240\201\354$\314\002W\325\372\003"
+	.text
+	.section	.gnu.lto_ahLadder.97.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 d!\003"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"T"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"R"
+	.ascii	"\001\002\003\004\005\006\007\b\020\021\022\023\024\025\026\027"
+	.ascii	"\030 !\"#$%&'(012345678@ABCDEFGHPQRSTUVWX`abcdefghpqrstuvwx\200"
+	.ascii	"\201\202\203\204\205\206\207\210\220"
+	.text
+	.section	.gnu.lto_radioModes.100.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 \225\355\002"
+	.string	"\344\003\210"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\002\001"
+	.string	"\003\005\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\025\274\276\002\276\001{\273\275\001\273\275u3\304\0014\303\001\302\001\301\001\300\001\277\001"
+	.string	"\r"
+	.string	"I\215\200\353F\305\370\252F@\037(\006\256\364\264k\250`p\007\032K\021p"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_compassBar.101.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 *Q\001"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.ascii	"\030\033\035\034\035\030\035\034\035\032\035\034\035\031\035"
+	.ascii	"\034\035\033\035\034\035\030\035\034\035"
+	.text
+	.section	.gnu.lto_osdPreviousSpans.108.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\0018\200\200\200\374\342\303\315\205\017\177},"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\250-{\273\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\036./src/main/osd/osd_elements.c"
+	.text
+	.section	.gnu.lto_osdCurrentSpans.109.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\0018\200\200\200\374\342\203\316\365\r\177}-"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\350,{\273\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\036./src/main/osd/osd_elements.c"
+	.text
+	.section	.gnu.lto_osdRecordSpan.114.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\265\004\315\033"
+	.string	"\2460\253I\260\230M:Ag5\277o\351D"
+	.string	"}\006V#\276\266\327k\276,\3758\373\311,N\365\210\233.\037\004oc\365\334\024'+\2726!0\333\004\371\356\224\376\224>\264\357A\267\243c\330\327\035\307\332\036A\266\021B\366\2262\311\226"
+	.string	"\210"
+	.string	"\227"
+	.string	"\265\226\013N\027By\001\340\251\370\030\360t\267\3645@zr1\357\3228\220\375\210\334\256\025\307\203\251\326Rfe\304\323\225\355Fy\331\242\206.z\324v\275Z\253\253Y\\v\226\030\202t6\313\366-\333\317Y\006D\232\2472|\223\021D5\006#8\0319\362\251 a\342t\322\354\260\371p\231\021E\306h\013\3429\025\340\222\224"
+	.ascii	"`\243M\001LV\360F\033\b\356\245s\b\033m\026\250\265~w\036\262"
+	.ascii	"\315\230\303\t\265\326e!\033\211o\353\273\233\333]\t\2733G\365"
+	.ascii	"\301\236\207\205\016\242\221\017x\372\356\246(\037\322s\\\207"
+	.ascii	"\317\336hc\036\370B\247{\017\340i\2006z\241\303\325 \002\342"
+	.ascii	"\337n\371\303\235\333}\377~\277\337v\321\356\313?\346G?\314\221"
+	.ascii	"\376\227+}\0030\257\313\344m\231\274#\363\266\230\227\305\274"
+	.ascii	"\342\344\r\231\027\234\274"
+	.string	"t\362N\346m\346\345\311\373\001\257\261\2447\205\002U\255\"~X\352\022\032\004\306\225\276\373\245\335\361\337\355\370\033O\222]\311\347\2256\20254\344CJS:\247$\027\242\022\323a\217]A\bL\212\234\r\332\271m5\253\377\004\246[\rB\325\256\304\006\233\325s*l\361\302\221\220\343\214#F\302\226\221\242\r\366kWks\"$\253i\b\355\003R\337\362\347[$HD\214\331\271}\351\331<IR\257\007!\351\215\327\333\375p 7\t\234\324Z!\340\234i\003+\210\247\373a\241\303\352\200\247\263\351\215\347C\2329w7\bE\303\315\370\267o\356/\235\352\234p\324\256\336\235[\022|cHz\002\202\255\354.\354=H\261\326=1\234\234\251\241\347f\347\225\003\372\374\303\327f&\326\263\363\322y\345\274j2\304`\256\035\234\013:.\033\236\230k\206\300\3028\274x\\=0\030\217k,\353g\355\242\235"
+	.string	"\324\263Yk\255\254\230\236\322\223BEsV\276\227\236\"\373f\245\343A\261\242\001\323Rd\337\252z\031\356\344\006A\324\206pW\325MU>\024@.M\263\324\256Z\032\212d\320\242\326\332\322cU\325,j\t7\243\235pB!v\3565\340n\2053\251\001\020D\325\253\022\245\224\245(\354\3342}w&zq\245\247\224 )\301\261\237Hz\013d\250a<\206\034r\346DD\2222\224\306\260\002\021\031+;\021p\275%C#1*\035\003o\214\020\233"
+	.ascii	"@F@\234\253\0020]\356\236\366/\374\313\304\332=Aua~\234 \352"
+	.ascii	";)\336\021s\244i\237\265h_\202\023\277(\013\362\332]\305;\302"
+	.ascii	"a\020'\205\341\224\235x\003\213(\204\334\264\225<4\013\274\257"
+	.ascii	"\262p\034O\220|\330\274F\227>[\361\027~\376Dy\236\016\370\262"
+	.ascii	"\340\006\346\3656\360a\245Y5\212\230P\341o\316\216\302\271%I"
+	.ascii	"\013\037\3228\210\355\032\267b\336eE\342(O\304vR\353\276:\205"
+	.ascii	",\215\360\024i\325\034\316\333XN\351\264t\230\377\027\013\006"
+	.ascii	"1k\250.\211\205\310\356\f\301\321E\235\374\273\253\001"
+	.text
+	.section	.gnu.lto_osdSpansOverlap.115.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`y\003\035\030"
+	.string	"\206l\232H\260XQ:\362u\024.QLL\212\025~)$\275\234\310&\207\257\263\3560}6pO\021V\362\242>\262\007\277\325\315\352\223\207\314SO\207\271S\372\323\332S\242B\274[\n\005\206\322\205\353\367\210|l\204\220\275\345N)\206"
+	.string	"z"
+	.string	"\212"
+	.string	"\3371{\220\210\313\324\252[:\252ud`\006\342\251\307\023"
+	.string	"O\305\253\300S\007\020f\246}\3749\021\3724\365\f5\325:\256\026\206\217>\307\333\241\244]\fA:W\322\374\235\213Kn,\376\253\311\320\306\212\203s\302\016\240\030\313\353%\375\306\215\205\2443\265\326\024\216\204\234SAN)\005"
+	.ascii	"\034\317$\240\344\205\224\023]\372\340lr\377\273\034\342T{\362"
+	.ascii	"\303\255\270\f-\324Z-M\340P\334\250\333\376\261]\301\336\236"
+	.ascii	"V\235\307/\340\343/s\336\037\363\240?\200\245a\356\273_@\351"
+	.ascii	"\024\225v\231\322\250)-R\351pJ\203S\232N\3519\245\227JK*\375"
+	.ascii	"\001\007rk\252RcT\353\211'-5\tE\252q\337\355\023\275\207\377"
+	.ascii	"s\352\324\357\335\307\354\276\004\342\316M\3741e\241R\353\270"
+	.ascii	"\340\324\024\304\323\231y{f\247l\0364\"\360t\036SkLZ<\230\362"
+	.ascii	"\243\216\267\326\334\223\003)\355\353\b\342\356\242\266@Q\270"
+	.ascii	"\242\206\027i5\270\222D$\334\367\244\221\\\320\260Bwg0\212\220"
+	.ascii	"\022\335\271\340\236'W\223O\026\260Tf\347\322\"\271\273\357\331"
+	.ascii	"b\233\013i\241\202 \311=\260\364\353F#M\346\356\034\263_\230"
+	.ascii	"\320\222Mf\261\315\372Q\213\252\330\002d\233\303\215\\4Pj\265"
+	.ascii	"I\360\360\0378('NM\265\332\"\024ex\3713N}\020{\242#P\261\005"
+	.ascii	"G\320\b\371\264L\230x\276\335\235=\356\310\231\244!\023^\235"
+	.ascii	"\003\256w\220\265rX7\240\316C\\\026s\335L\333\320\304d9,\034"
+	.ascii	"\326\r\253fC\354\265\312qi\300Y\331\300b+\032\003~}`\301V\262"
+	.ascii	"\327\013\266J\215\365\253\363\207~aJ\211\236Q\350\323\300\023"
+	.ascii	"\035\003\223S\317\210\3764\020\006fma\304\326\304\3359\365\003"
+	.ascii	"UKsH\373\274ljoE\350\210\313\246j\256\324\022o$\303K\234!\002"
+	.ascii	"<uY\0041f\255\265\206\273{\002\360eU\373\337)\020\222$\236\\"
+	.ascii	"m\221\374\344\300\002\242v\356\312\bE\250!8\304\220a\2061#4i"
+	.ascii	"\202&j\f\240\002\031*\263\r\021\220A4T\323\3263\177s\244\360"
+	.ascii	"\373i\272X\373\272\2153\264\025\307\210e\302mv9KP\320T6\221D"
+	.ascii	"\214\353\207FO/\347mh\346\240\013R\364\0367G\341\004\303\201"
+	.ascii	"wJP\356S%\232\227O_f\255\216\001\267\0034N\fU\265\366\007\320"
+	.ascii	"\370\265\361\017\370\345\221\301\022d\206\335\003\253\3008\216"
+	.ascii	"\356\024\037zL\004\013pj\027)\361\305\177|\367\270\007\224y\271"
+	.ascii	"\336P\372,\360\235\276@\361\007"
+	.text
+	.section	.gnu.lto_osdBlank.116.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\217\002\245\025"
+	.string	"\226j\222I\320TQ:\230\341\251\027\177\022\263\244\212X\3177\001\2453\260\230\341\361\016k9n"
+	.string	"Y\353\005z\262\322{\336l`l\226\3713\030\362R\234\370\262\243\030\205\b\001&i\027v\221\367Y\032u\330\326A\r\"\204\020\"wJ\001{"
+	.string	"v"
+	.string	"\177"
+	.string	"\027^\332\031\021\020\bt\332\004\n\304N^\260\356\212`r\340\323\376\213\303\210\375\007\303M\273<\272\035\273\244\213]\306\203&\177\n\017\216W\t\017:f\0379\351\263b\n\333\016\r%\273\233\322\023\376f\354\340\2473\346O^\257v\223\035\374D\035\016*H7\235\017\246\210h\367\362\323v\233\315\217\305\207\353\313\177.x:j\267\017\237b\314\356z\326n\036\356\360\266ml7\260\347.\332c\037\306\247\210\310\312c\237V\376\363\247\034\3507\351t\351A?\351\344\217\362\240{<y\213\342t\250\323\240N\177\341\264\202\323\023\234~"
+	.ascii	"\001?C\"\f\355r\350-Y!p\267\3428n_\347\347\354\321\301\277\364"
+	.ascii	"\310\267\361\033\261\343\2400.NF\267\201h\267C\313A/\030\017"
+	.ascii	"\316E\351\214\323\210=\310=\276\322j01b\307\356\2728f<\210\372"
+	.ascii	"\256\022\002\005Hh8QC]\321\323D\204j\2007\004`\252~\nj\212\332"
+	.ascii	"5*\324\216\312,*\2507\351\247\327M\365K\234\027\325\353h-\256"
+	.ascii	",W\t\247\236\206+\351\365\271\313\340xBv\232\260\214Z\322\353"
+	.ascii	"\316\300\003\317\007-\311l\366\264\206\017\235\233j\217o\302"
+	.ascii	"\335\313\033\224\"\273\013sB\253\241$I\206\331\363h\262\334@"
+	.ascii	"B\324\335#|\356%\016\311\247f\347\264\346k\236?B\b\321Tf\223"
+	.ascii	"\262\031/\034\026\315\nB\030\001v\303R\255B\013\257p\230\253"
+	.ascii	"5c\201f5\341%A\201\315\253Er\315\313\013\306R\345\250V\252\007"
+	.ascii	"6\257V\212%\201&'U\343z\245^\006\2705A\345J\301Z-WjD\356\225"
+	.ascii	"\307\016b\be\320\231)|\273%\022\2247\021\001\315\036\250=~\356"
+	.ascii	"'$x\004\321\023IG\265=\367\321\b\217\034\272\242\376&\212\212"
+	.ascii	"j\263\355\226\217\372\362\023E\213!\031A4\314\242ow\367+\351"
+	.ascii	"\250'\235\341\005- \200\202\031\273\352_\fI4\366\313 \264O\234"
+	.ascii	"\326hJ\375\225Qz\320FO\350\222\344\361[>\312F\001\335Q4\206)"
+	.ascii	"x\212\034\236j\374\240`\224\007\250\376dn\315\3176\2027\355\256"
+	.ascii	"]]qJ\255\021\373\212\033\217\2669\260\034\342\036\020K\201\307"
+	.ascii	"n\3360\207q\002\340\210\200\243\324{i\251\222\226\201_6\t\364"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_osdElementWriteChar.117.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\305\013"
+	.string	"\026\226NA0m\\8Ka\200\361\375Ho.\236\2106\372ou\205\260<q\026\357#\214\234\266\313\332\332=l\270\334k\373n\342V#\034dFp\n\204\204B\210f\247\350\023\305\b\212\002\377\275\264dK\231R:"
+	.string	"="
+	.string	";"
+	.string	"\233:\241aw\3148\303=\363x\r\355\031\367\f\355\231C\273\304\307\007\273I\200`j\231\330\335N\035<|\206\376[\247\234P\342s\023\331]\347\t\245\340\326\333\336\260\035b\237\024\337\276\372\265\263\376\fKc\232VM\247\246_q\351"
+	.string	"\002\300\207\335\004/\024\353\3126P\260}\213\315\312"
+	.string	"\262\232\360\241iwl\302\217\006~\261\245\020\0136O\373\025n!\274jt\214\r\366\347\313\237la`R\321\266\200c"
+	.string	"\271\335\003\036\376\005\317"
+	.string	".\302H{\206)f\204jS\3254\365\231^+$D\230R\220\362e\217bj\003\373\330\356\2565e_\365S>>\234\0278\201o\346h@\021\310\373x\036\217\304\004\374:P\247\344\323qB`\247\301\370\013\340\205:\321\367\205:\313\270\307VS\036\361\340\"i\311\026\311q\373\244s\341\340B\240\242+yMU\3054\031"
+	.string	"/\371\337\331\220\261Wak8\243:-\003\217\001\r\031\003?\223\300:\027\362\300\034"
+	.ascii	"q\215\2500c@90\030\030\004\360\003\203\201\021|\206\005s\003"
+	.ascii	"T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_osdElementWriteString.118.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\023\001\315\f"
+	.string	"\246XVB\020q\233\016\b6F\032\006C;\226\2162_\2010iZ\001v\315\203c\002\364$\340:1\214\204\222e\306\273\fi\376?P{\037G"
+	.string	""
+	.string	"(M\352\3617\377\273\rY\036\002k\232\036\233\320&R\246\024B"
+	.string	"C"
+	.string	"B"
+	.string	"(\236\242\273\251\343\002vK'-v\303\2143\327\243\303\017\250\036\257_\252Gwv\215\207#\3262\021\362\221\230\354n\246\"\336=;\377$\347"
+	.string	"A\274\247\345`w\235 \210\207[o\033\201\355\006\366I\004\330M\177\345\341\177]\344\2674]Y\351X\245\251\230VM\247\246\037\240\200I\214O\311n\207\224\223=E\027'l\037\263M\215` `Y\222\212\022\006\"!\0134\355\004\233\356\341\206[\366C\306\207\315\323~0l\234H\352\031@bzMU\265)x\362\2401\020\237z\266?g\001\272vI\n\374\025\025\266\253DG\365\250\212\231a\2724\365\226^+4^|(\036\231b\207^j\b\373\324\356\256\265d\177\344\017\3345<\303-w4\334(\244\2014\013\232\204\t\334\226\205<\034P\326\021q\231\306\200\267\013\232(\033m\233(\303\302=\265Z\362\203\033'\017\375\360%+\033B\204\003\034\324s\324\212\322\250\231\017\305\222\230\332\234N\036\244\024\023\031"
+	.string	"/\371\337\331\220\261\347ck\270\315!:\027\261x\033o\374\212\205\231]\3665+]\326\003\023\003\3105\"\303\206\266Ba00\300\005\214\003\303\370\f"
+	.ascii	"\214\bPQ\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_osdFormatAltitudeString.119.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\022\002}\022"
+	.string	"\006\344|G\340\356(\035[\211$-V\360\366\021\022h4\365q\252\304\223\023\325\201\222\203]\200\303\005Z\t%x.{\245\006Ts;I\276\214\3765\205\260\210\201C\021K@\257\355\237\231\021\003C\320\344v\324\237\020B\266\224)\005b"
+	.string	"b"
+	.string	"k"
+	.ascii	"\025l\332\345\220\364\263\273)#\b\357y\304\247\375\020\307\231"
+	.ascii	"=\247\345\034\2732C?\273\271\224S\341=\347.\340\273\027>\300"
+	.ascii	"w\3173\233\305s4\013\332\320\300\360 \355\256J;|\366\2509\363"
+	.ascii	"\301\021\323\rG{\314pE\341^\242\307\356\276\347\031\203\253e"
+	.ascii	"\202#\273\353\274\3410\334\336m7\260\355\300N\225\277]\007\020"
+	.ascii	"\005\355^\224f\347h\2513\366\343\356\256U\306~\316\217\272\356"
+	.ascii	"\336\270\316\177\372\316mz:\374\322`L\1771\355\305t\214i\365"
+	.ascii	"\322\031\323\007\320a\244\202\202\317\256\205%\030\273\363\200"
+	.ascii	"l\276\363\353\316\363\036k\350&\364\264\360\240`\307A!\355B\250"
+	.ascii	"\263\251q\261\273\006\3569\201\235\271\213\230]'\212\322Po\373"
+	.ascii	"\240\240\036F\311\345\323\333n^\342Q=M\331\20064*\270\302\206"
+	.ascii	"\224\252\232\202Q:\245}\002!\177K\375\t\242\027\273ZL\371\224"
+	.ascii	"\310P\027\022\312\335\245\251\316X\002\001\034\020#\206^2\311"
+	.ascii	"^\272\354\363M\224\310NE5~\313w\317\323\220\002\311\310%\227"
+	.ascii	"\234q\007}\327\r}\f\333M-\227l\312\223\332\257\b\031f}\264DB"
+	.ascii	">@Z\"!\037\247\030\312Ja\257\025MY\340j\311b'1\224U\206\211\211"
+	.ascii	"\254$\232\005\002\213\251\270R\\(.\222\026\354\245R9Y\245\250"
+	.ascii	"X,0\025H\207_+.\026U\354\365bQi\344\366*\343\317\034)i\312\216"
+	.ascii	"\210\362\300M\032\363\340h\347\2425s\244\252G\342(H:\212vm\277"
+	.ascii	"\255B\033\203\002\367B\265Y\256\374\315q7(\315`& \200\202!\301"
+	.ascii	"\362\001_\fsh\270\246\227\215#}\244\025\212R\345nE:\b\344\372"
+	.ascii	"\340v\230\305\301b\340\2134\266H\016\206ibg\325iN\013\237\007"
+	.ascii	"Y2\306B\346\316\0018{\252\225Q`\262\341\035\031\207f\024\026"
+	.ascii	"\302\301\n\314+\322d\n\350\222\006,+\267]]\017"
+	.text
+	.section	.gnu.lto_osdFormatCoordinate.120.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\342\001\375\021"
+	.string	"\326#|G\320\362&\035\252\002\224\311e\031J\\T\254ye\350\333\tyb\332V2v\026\373p8\245\210\220\314\2671\323F\240\2274`\227\254H\037\254\207Q\352\001\t\333\372l"
+	.string	"}@2\310\327rd\274\177\204\244\221\275\245L)d"
+	.string	"_"
+	.string	"l"
+	.string	"\326]\037\034H\273\313\362\312\323~\213\013\315>\204s"
+	.ascii	"\273?3\220vs,\263\276G\347>\300{\374.\300{\364\314\326\361\\"
+	.ascii	"\211U\005\t\355\274\220\332\335\226\222\370\354Ps\346\337\350"
+	.ascii	"\"7\034\355\260\347\nS\236F\344X\341t`\001\237\246\236\033=y"
+	.ascii	"p\265L\025\204\335u\336p\036\356x\333\022lG\260sB@\366\341\356"
+	.ascii	"\256\365\3076y\321\277z\356/\371\320?r\335\375\275\350V=\355"
+	.ascii	"y\351\030\323P\323\032\323\251\351\0070\220\342I\346c\227\303"
+	.ascii	".\310:E\245\240\353~\37372\211m\235\227>Z\207O"
+	.string	"\027t\264cw\021<\332\301\007]\234h\366\242\033\213\354\212\3301\370\036Q\240\246\275\262`\366\234,\206]\310\337\214\262\2434G\035QOoC\361iT\205\227q\225\252\336\266\242\226;_S\2773$'w\2065N\354\275\344\251\364:\"\204\311\246T\203+5Q\034\"\033\017\326e\236\177\024#[\235\351\206T\217'E=\205\320\337x+%0\304\202\250I'\177\270D\375\0301\262\022(\023>\216\367\030?\330\230\002\221\223;;GK\r~i\240 E\345%\345\213\301hT\246%\203\2764\304\024\006\006\003\005h\027\225\230\315\214\353\345\222q\261\274\304`\255\231\n-\257\226KM\254\245rb\030\215\253\246e\003\203\325\264Hr{\270\372\343\003M\r\321\374\024\215L\360Oyn\364/\n\310\0065Q\303\\\251JyXT8\345h\315$\231\n\3650\236d\341\004j\327\366\333\353\263=8\360\350\251\003\036"
+	.ascii	"\357b`\215\227\265\220W,06M\354\243\202s!n<\204\3261\213\256"
+	.ascii	"\315\277\260\020\340\013\006\001* \002\fY\264<+\004.\003\022"
+	.ascii	"\236\210\240w\r\243\304s\334u\004\373\225\032\205\313\"aD\200"
+	.ascii	"\n-\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_osdFormatDistanceString.121.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`4\005\r\""
+	.string	"\366~\334K\220\326U:\206\241\311\230\202\027>\323\307qL\034<\0324\177\231&\272\276\374\"\214\300\013\334a\007\346#\311`\275\235\036\365?\350\n\026r\326\0060\004\253V\3018\361L\202\377\202.\n\210x\"w\342\341s\177K\b!D\356$\003\306"
+	.string	"\271"
+	.string	"\312"
+	.string	"\314T\214d-\036\255T8\256\200\335{\031\034\345\013\374"
+	.ascii	"\002\361SC\356{a\210\221`\231\027B|\024#\341\330\2752\226p\335"
+	.ascii	"{s\330\301z\364\346\274e\376"
+	.string	"\217\003!~\tt\001\367.aq\335\313\314\341\234\365(3_\223\036]oK\2172\221Y\313\231M\367[L\220C\300\334{qM\343\304\317d\261UM\321\263-\221\177*\0215\223\312\342g\bd\261'G,\316\033\256#\310q\264\302\2562\220Z\\=\027\200uy\371\223\243\244\263\306\350Fr\246D\332T\235`Ai\310+\251Lqt\246<\236\260'\212wM)t\336\334{\237u[\2444Z\253N\270\367\262M*\221\316\26433\223\231\237\230O\036\001\266\311\016^\3236-a\314\227\243\016\243m\332{o\261?Li\372\026d\207\224\025!\033\206W;\323\314$\202\366I[\3434\351\372\022\352\"3\323h\233\211\371\347\355%\346o\235o6_\3765\237\372i\216u\266=\352\2379\325\271v\253\263\314\257\316\264/\3173kYf-\307\254\345\325ZV\255\345\324ZF\255\345\323Znk\331\242\226O"
+	.ascii	"\304\322\tP\363^\243\246\230\373\205\032\301\361\255\237\352"
+	.ascii	"\267\372\257~\2543_\213\317\265\365\363\213tO\344\004\225t\344"
+	.ascii	"z\364\257:\221\027y\026\317\260~\252\266P\001"
+	.string	"\363\271\032\336\024\003\\\343\226*O\"\254\206\353}R\251\266\254l\b\347z\007(DU\307\034F\333\264^'\214\240\326\031k\333\326\327:\024\017\005\232\356=>\371a=^E\202\243\263f\316\351\354\223|\203\354\"\323\332v\2524\364\0059&\3106\337\024\006\214KmzAU*w\322\274q*\210qF\222\326R\240\034\306\245\251u\362\230\017S\231.J\225G\224\366az\250\346\362\004\360aJ\353\"[\327\272\213S;\244\230\b\3310\351\332t\217n\214\253\3006\t\373*\3320\264\231\370Y_\273\204ii\233\346\323\326\364\254\213|\322\267\215T\025f\336\225\204X\357\025\212\300Or\257\036\337\351(\217\340\261O\362\244G\337*RL\217e\220m\2364\315?\222aH\243\342\304\007J\217\322\324p\021\024\254\303\331=h \323\331\341\254\254\303\331\341\240\303\334NO\260\267\003@a\307\023\002y%|?\235"
+	.ascii	"\331\216\267\363\361\204&*\314\370~=a/\350\313\0013\b{>\237\332"
+	.ascii	"\316\017\004\317\020C\b_o\227\343\355\310\360t\276\2340\330\333"
+	.ascii	"\255@aO\263N'(\364\361xx;\274\017\273\340\017\347\353\345xp:"
+	.ascii	"`\020\247c\200\177=< N\370\373\001q3f\320{\351CO\202|\005\265"
+	.string	"q\266v\254eX0hX\217\237!\213\365\217F\326)\262\263\323\256W\331p\200\303z\374\213\363&u\221\037\345\267V\373G\037\227r\264\323~\226\243\021\331\255\321\036\220%\323g\253JD^6\242\252\224\304\232\211\325)\377Io\335B\246\246\324\272\373\326v\311\321G\024[w\007]\250Q<\204\bC\204)D\"\"R\3204\035\220\002\2312\253\003\021\240)f$\223\f\373\006\200\320\224\306\bP\016F{\023pBU\217H\032\223#mP\036\210\271\212\"O\327=\253\004\315\320\370j1z\264\202\326\016\306\f\355\327\217\f\2649\315\n\342\b\304\005\251\203\247\027\245A\fN\241\230\n\253T\203\322v{\n\002\212\n\241\227/LV*9oc\364\t[X\330\276\317\274\230K~\034\210\024_\305>p\316\226\374\260\3736\357\252\325\261\300\025\277\274\250\016\214#\0373\300\003\372A\341\t9\020\f\221c\034\017\202"
+	.ascii	"f\316.\340\n\221\372\230\245\345\374\002O\220\234\322\262\202"
+	.ascii	"\342\020ob\023\206A\355\037;\\\016\352r\2277\317\374\001"
+	.text
+	.section	.gnu.lto_osdFormatPID.122.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`,\001\315\f"
+	.string	"\026\330VB"
+	.string	"s\224\016\233\003\264:4\240\377\003\307*\242\212\270\242w\364\221\"h}\251*\203(\020\204\210\300\017\004\006\376\004\353\251\200\340\333\270K\277\253\306\267t\023\315H_\307!ew\307\375\037\201do)S\nB"
+	.string	"?"
+	.string	"F"
+	.string	"-\270\2574\\\300\256*\006\215\335\317c\317\365\350\357\004\254\307\353\003\254Gsv\017\016\207\355\030\2500\201\262\342cw1-q\356\311\371W\371\305KuO"
+	.string	"\022v\327\351\245>\334z\333\blO\260\277\"pw\327\252\262\377\375\230\257\376\313S\376+\246-\230\2161\raZc:a\372\032\315\211\016\251{7v=\264"
+	.string	"Y\226X#\205\355glk\n\t'\300\232\250\214x\220_\006\036\n\236\366Y<:vO\356e\327\t\204\004\217\027\265+\220\362\236\341\212\320\316Q-\013\227\021\265\201*4\035\206j\204\035\327T\017J\020k\177q\341\3325q\340\257\234\266\013\005\211\365x\265@\204\260\361cU\222-\366\327\245\222\260\037\036-\350\034\330:\233\021IDKY\bT\212!!\030B\320\242\3176r\312LY)\2430\3324\354D\002\2310\021j\303>\006\254\211d(lD\323PX\346\333\303U\225\257\0348XJt\2037\231\n\325R\214\336\305g\210\n\004\031"
+	.ascii	"\002\364\336\305\220\211w{\321\022\0276\330\034H\016\f\0076\367"
+	.ascii	"Tf\254\316h\332+\260{\273\314\n\215\013\3079\f\r\n\203a \bP\b"
+	.ascii	".\003#\002T\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_osdFormatRtcDateTime.123.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`?\001\255\016"
+	.string	"\006\334eG\360\3166\035H\301<{\321\200\375\375\361\312\r\371m$\371\345\254\224=\206\004\376\277\"U\003\255\244{\177\220\035\250\031\307\303\243\251\335t\335\3351\004\203\302m\"3\311\372\266\022\345\006\266\351\331\204\330=\240!B\266L)S"
+	.string	"L"
+	.string	"R"
+	.string	"'\260]\343.`\273f\333\t\026\220\\:9\3424`\025\303\202bg\227\354\246\210\227\256eSK~x\215\001\252E\210\314\001*\207\205\013\233q\303gf \365\002\373\214\246\354\200\n\035\226\227W\227QE5\303cw\255\342\250\341\336n[\202\355\006\366_\002Se?\333\335\365L\331\247\3717\3657@\034N.\343[Z\273\247X\317\352h)b\316\372m\222_\372\343\2237A:\353\344+\256\006\314J\346\265\233\001\3015+\300\331P\265_\3423\244\323\240<\300n\312\205\263Kr\230\203\273f2\024Bz\321Z\343aa\257\225\031\236\347C\314\225M\325\267\371.\360\003\360\202\204\217\262]\213\200Z\261\023#Ec6\031^WrVfN\225K\333'H\t\303\244<\316\320\237x)\342v\367\242mbA/~\276\3741\\\350"
+	.string	"\003{\231fh\223\241\006^h\004\2027\372\b\341@OD\304\004d3\250C4*\361B\036\2117!D\364u%#\037\241\016\004\212\272\216\002\376*x`7\372>\260\373\220\373lg\312$+\233\326M\366\362\\\317j\246u3_s\235-\323\036)S\305'\331.\210\007g\375/\226\306\264\3176\355\027"
+	.ascii	"\3571d\026\017a\321\201,j\232\rwdV\246\2667\0348D\325\342T\""
+	.ascii	"\353\032\262\004\314\330]\346\222_\276\032\203\342\f\003\023"
+	.ascii	"\320\216y\372\316\020\324\201\2262\205)\272\324\036"
+	.text
+	.section	.gnu.lto_osdFormatTime.124.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\360\003\275\031"
+	.string	"\006\257\245I\240\030\231t\203\003\257\005\203\200\232:\235\370\363`\254\306\360~y\340-\366Z\023Y\243\244\202\020j8\230\255uw\217\333q\325\316U\216\370\003_Zpr\234\263n\210\361\220\005\335\360\234\301\nl\200`\033\r\004\221M\344N2\217"
+	.string	"\210"
+	.string	"\220"
+	.ascii	">&W\356\275\bn9\002s\007\221\225\250k\353\275pP\177\3671\373"
+	.ascii	"\017\022L\272W\006\222\301yK\240|e\376\216\363\230\335\247\304"
+	.ascii	"\003\334\273\243\243\310\275\277\004\234\340\274\345\337a\314"
+	.ascii	"\333\363/\346-\317\230\207\376\253qc|B\234\220,\367\336T\323"
+	.ascii	"\370\354\246-\273\316\370eo\207%\307\243\335\034\276\300\256"
+	.ascii	"\211\r\236B/\007Y>\350\023z9@9^\213\367\t\233\t\303S\264Q\342"
+	.ascii	"\325\272\216 \334{\271\346x,\316\2433\263\bf\3261w\224}\"\270"
+	.ascii	"\"\234\232\344\007\266\337e\346\250\337.5\035\320-G\255&\231"
+	.ascii	"\177\264\3323\230\337\311dR\013\367\016\363\205\316\250\373\374"
+	.ascii	".\027\236O\377\361\233J\3779\223\016<\237\017\362\217lek+\227"
+	.ascii	"\266r\333\312\325V\376\313\251G\220w\025\311{w\311-\327h\211"
+	.ascii	"7.\374\205\376\237\037\370\222\371C\341\210\362\002%\370\264"
+	.ascii	"\364d\370\020~\220MB)v\370\254X8o\353\201\036\304& \027\245\370"
+	.ascii	"\226T\370\031\361\313\342\036\305\226\250\256D\270\"\034)\227"
+	.ascii	"\231\265\273\315'7\242pE\355\007\217\001H\016\024$\2379\036)"
+	.ascii	"K\265\324\244\376\220;i\311P\271\367\366\334\353\274\251\016"
+	.ascii	"\334\2724s\210\264>\307\007\036{\030qM\343\023\257\312a\244U"
+	.ascii	"\242\363\024y\222t\317\340/\3413\251\310\"?\t\017\235?\t\363"
+	.ascii	"\266J\317\325"
+	.string	"\2714G\230y(\006\351\342^\332c\\\347\372\236\364\334{inM=s\304a\264\325\"\276\221\237]\352QO\247\344Ftp.\232g\223zt\324\r\337g\274ZP\003\200\033\254\030(0PJmb.4f\2466\261\025\n[\271nlJ\351\312\365R\241\351(Ec7.Vk\204\266X\261\322\365b\245,\025\n\003A\352\320\341\206C\311\252\2324\346B[\350\007T\303*}\245\\\254\r\255\224\n\226\246j\004\360\013\004\nK\305^/X\312\364\273/o\357\2408\022\031q\272V\336{\257y*\362)&|\234\330>\225.3\313\266m\n1u:e\177\370\013@vJ\376\240\277\306\021\212E5\221G\3610\200u\336\\2*t\300\270.\232\306\335\001H\2501@\305\214S\310\224\004CQ\n\n\225\003\300\002\231A\312\003\021\3408\315\030I\205me\f#*\274\030\004\213\352{=\231M\237\rX"
+	.string	"\305\227`\204\247_p\207\300\256I\205d\265\376\350;Y\177:\3377\321?\016\2055\032!\263\325\207\333\016QH\354\277V\225\335\223X\315+\201\356\246\306\275\340\307\350\211\31046N\244\367\311\350\271\3007f\202\005\207\345\332\311\024\005H\305\2146\232\035\345"
+	.ascii	"\316\022\201\034\220m%9e\254]\"\315O\240\201\365&\331KU\310\212"
+	.ascii	"\013\016\255\023)\032"
+	.text
+	.section	.gnu.lto_osdGetTimerSymbol.125.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\313\001\215\017"
+	.string	"F\035dD"
+	.string	"\261&\035\300x\246a\313D\204\204\260T\347y5\215\244\3104\2646\230\217\314\266\200XDb\356\254oZO\220\336Q\006\252\332Z\235V\026"
+	.string	""
+	.string	""
+	.string	"\f\252G\314\b\273\003\351\240+\256\316"
+	.string	"\242\336\233H\231RP"
+	.string	"L"
+	.string	"O"
+	.string	"$&\0019\374\274@<\274N \036\3326\003\007%k\007P\033\216\006+\f,-\035\273\213\251\210k\217\360\322\324\374\355Q"
+	.ascii	"g\272>\273{\326\263\205;%\274\f\\Q'S\034\260\273!\334\312\225"
+	.ascii	"\037&\273\353Lq\032\356\217\333\026\331^`g\2025\335\356v\020"
+	.ascii	"\266\277L\255\202C\325\263\376\02168\334\240R\307\366\266\324"
+	.ascii	"\027\373\327\356\256\325\305\3264\274\314\257N\247\246\037\003"
+	.ascii	"\334\200\341\336\311\330\315\260\323co \r\022\266K\266\210\355"
+	.ascii	"L\373'\216\242t\031\025\003\330\r\2013c\327\013\257\271M\346"
+	.ascii	"\303\270BJ>u\350\247\304\303\253\205\0161vt\027r\307w\361\263"
+	.ascii	"\236\252-s\016[\377\245/*n\223-s\374\337\333]}\341\303\360\007"
+	.ascii	"\242\277jW]\211U\321\234\305[\370\363\320<g\374\025\376<\255"
+	.ascii	"\032W\211\207Oa\373\363\004 R\246\006\225d('!QhB\350A\204l\204"
+	.ascii	"\235H\200 \302@\244\f+A\340\021\205\020\tC\031\215H\230\210\267"
+	.ascii	"\277V]\034W&\362s-\306\230\034\227\366\341Z\334\260\022c\243"
+	.ascii	"\232\207k1\265\305V\223\357\305\221\bCtfpN\311\303\377H\274B"
+	.ascii	"u\262t\246\334\261\003& P\002A\310j=\317\030\223\217\307G\342"
+	.ascii	"v\333\250\213\204\177`\330\325\313\r\265\005}\247\240a\231;\""
+	.ascii	"8\206{8Fz\207\335\266\231\201}\315\332n\\\204\003\366\251\312"
+	.ascii	"\307\034\315\305\034\231l\033\376\350\366iv\211\037\242\037\230"
+	.ascii	"\371\201i\227p\256\226\353\013\266\024mm\352\016\216u\256\"\003"
+	.text
+	.section	.gnu.lto_osdGetTimerValue.126.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\321\002=\024"
+	.string	"\346\244\200I\300\224Q:\270s\035\244\275;\205\203\323\211!!\235\f\2607\021\021x[\t|t\343p^\237cV\312\327\303eoo\020T\323\254k\200\254\376\326\020TW\b \031\004\211I[\327\317\315\256N\033\333\370%\237l\"wJ\001l"
+	.string	"h"
+	.string	"o"
+	.string	"$\266\245\274.\306\251\335\017>\222v\307\023\237\204\237\266}\024O!c\331\002\232\231\233\0039\0176ECvG\226\201\017"
+	.string	"?\277\227\200\237\032\342\262\243\300\371\251\224\371*\333\354\250\020\347 \321\033\200\340p4\365\306\343\273\320\031\320nN5\033\316\265\206\306\002\r\\\361r7\225\315fJ\224\312\356Z\326l7wx\3336\266Sl\r\003\363\337\331\334\210\237\033\331~\"\320\224\263;{\207'Y[\004\237S/\364\213\340\321\330\325\310#\3668\223\212\263\257\275^/\210\225\307+K\253,\235\372\220\356\237\226\326O\372"
+	.ascii	"V?z\330~;\332\315\320+\262\273\251\344\363\241\333\037}\"\223"
+	.ascii	"X\305W\310|\b&\300\356\330\333J\344|\200\354\216\t>\255`\fo\313"
+	.ascii	"\330\0013\245\017tr\230\320\255\244\335\"A\276\026\352\211^\002"
+	.ascii	"\204\347\204t\023\236\216\2518\033_\222\371=vy\311\327>\375\027"
+	.ascii	"\370\251R\007:KDrfd\317wq\023\036\323g\224\264\305\n\362\265"
+	.ascii	"\225\312\221wcG\323\231\177\364\b5v3i\304\036g7/\247\203\244"
+	.ascii	"\212\233\341+\351\211\030\276\fI\342\205\017\343=?\273\303\302"
+	.ascii	"o\341\247\3601\340\003b\214%&\316\026LT\267P\304\330\213\313"
+	.ascii	"\3055\301\265\002A|\261^ZX\\X-\230\310B)\340\027\005\027\214"
+	.ascii	"\025{\275`,\222q\377\255\3628\250I\3722\320\037\370o0\n\3020"
+	.ascii	"S\n\002-}*\325P\003\244\323\225\252^\260\255*\225\346\027\335"
+	.ascii	"*\337\356.J\200\264WXT\223.\004T\234[\307!\013w7\305gzq\205="
+	.ascii	"0\340\003: \240\002\221A\353\006\377\030\220\306\323\024\234"
+	.ascii	"\351\314$\207\202 \214\b\302\037\204`-T\333n7\210\216B\024\033"
+	.ascii	"WG\255h=++\264`\357C:\267\b\004\202\210\205,+A\343\234`R\021"
+	.ascii	"\022\357M\2310\277\f4?\235\201c\255^;0`\254\251\r\250Z\217\274"
+	.ascii	"\305XT\273Z\n\315\266\347\ru\335\303\276\004\271N\3344\276i\220"
+	.ascii	"\355\231\341\034\232\232\270\3207T\273^K\334\355\230s\242s\315"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_osdFormatTimer.127.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\365\002\315\027"
+	.string	"\246\356\240H\260XQ:1\323;\201\237\031\031\n\376\215\346\360\021|\313\344>\024\227/\316\316\355:F:\307\234\215}TOX\272FE6B\037Y\223\013\315g<\343<\3703"
+	.string	"\037\017i\372,t \022=\364k\"v\357-e\222\001\211"
+	.string	"\205"
+	.string	"\215"
+	.string	"\037R;\222.\211\255\306\005\3750u\267\215V"
+	.string	"/k\342e&\020\036\232c\251\022\201W\265\201\203\332{<4\277\362\344\203I\203\257\352}\374G\355G,\036\323-d\304\324\335\263Q\033\360R{\237\231\227\340e\346\245\326T\251\274g\243i\212\210\350\206d\351n\027\327x\355SF\336\232\036%a\307\263}\246x1.s-6\3028\303\360p\261\246\273\277\364\365\341\335vQ\022\272[w\307{qE]UoT\025\204*#\b\032\232\330\357L\314\313\025s\220\001EKS\317\376T{\267\345!\325\307\356ne!U\325\352\314\201\374\002R\2531\255\037\375\254\367~\230']_\256t]\035\351W\251V\301\037]Q\251\325\t`U\242V#\270\312\250\325\235\253'\260\3022\205w \247n\027?.\355D6\345x\322\257t\"_R\225\276\310\215\324\256\244\363\336\365m:\212\214t"
+	.ascii	"/[\233\264\363\316\365\n\242\"\245*\335=\005\227\252\001d!\001"
+	.ascii	"_\372] \365\360q\2135.\213Q\354\243\344\002x\302\200\215\254"
+	.ascii	"\252a\303~'\271\346\205#?h\206\223\316\027y\210\365N\"d\253\247"
+	.ascii	"\356>\221\236E\223\235\025\231]V\365\360a\277c\366@\003\3076"
+	.ascii	"ep\026\267\370]r;^xY\025\004\364\323\371\266\273m\314C\3123a"
+	.ascii	"\230"
+	.string	"mG\214\202H\301\355\026e}g\236_x\233\350~n\373\323\025\237\003\334\200\242\350|\252'\336\244\343\202\240\032\342IF$x\352\306=@r\246\227\236\3502\2630\006\313\221\257\031\215U\204%p(\314\302\030,'\205#\203\321`\257pv!\244\351\254P\310H\304Vd\330\221\235\240\245nntHD}-\240\345\340\204\261\020E\030\242\004M\346\302\201\215\210\271^3\232k\301\001\225\245\bg\256\034\231l\346R\365z\036\233\205t\243\0366\027\311\b\207\234a\220}\300(<\234\364\360M\013\254d\220Q\254j\001\303~\24759\266\305\031\3033|C\347c=\301\234\034\303\272\272\237x]2W<\331\300\223\031N9\337m\177\227<\244\0010 `\002\0311\343\003\277\030\343x\307\013\333\206B^b\242#~\033 \226\306\264!\253\022\032\367z\324\352aE[\334\200\272\261\330\212\021\354pB\001\005J\016"
+	.ascii	"6E\200\333\256\3543\264\252)\255\315M\226\n\021A.\240i\023v-"
+	.ascii	"\367\247\004\263J,\364p\343w\263\215\320\226\037\253\370\325"
+	.ascii	"Xk\271\001&\212\330\021a{\205\333\263\023\304QH\307\326\2522"
+	.text
+	.section	.gnu.lto_osdGetBatterySymbol.128.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\022\002\355\022"
+	.string	"\266\245\202F\320\324\315pi\001\253\241\360\334\262\264e\001\304\0239\006Q\362\253s\305\232\b\213"
+	.string	"\335\036\215\212\017\205\324\210\204\242\236\311\205\2358\327\354\r=\356\301J\003el\235E\036\262PO\300\322\002oO/\021\262\367\2262\245l"
+	.string	"g"
+	.string	"o"
+	.string	"\254\033\333u\034\333e;\323\376\214\037\341|\347'\267vM4\355\330]\026\263\260\016&x\201\360\340\367\001\341A\333V\300"
+	.string	"\3076\003\035nE\026\030\375\340QB\262\273/Mq\333?M\233\177\373\367\336%\234 \021\225\323\001]\277\007=\202"
+	.string	"A\321\341\276\257\020Q\342\274\247\217N's\345\262\273\316\234\356\347\006o;\202\355\027;a\002z\336UlD\361\240pz\263\221p\251(\354\177\273\273\326!\253<\351N\371\356G\311\364\211\323\255U\232\265J\2572\035\206i0\323_\230\326L'\230\276\200"
+	.ascii	"Kt\350>\342\310\356\207*&\013\005\362`\361\244\337\276O\343J"
+	.ascii	"7\257\341\013BS1v\327u$\277gW\022\207\357\317\276\247\310h\b"
+	.ascii	"\221\335]9h\007\001\232\352\334\231\nS\364D\257\364OF\021\222"
+	.ascii	"\013\030KFpYe\002\311\272\237\302\225\177\032*\212\332\025,\344"
+	.ascii	"s)\372m\b\275\031\324\360\345NM\240\236I\305N\365Sm\302Ce\230"
+	.ascii	"\347\200\261vu\032\3707\216#\346\027\035\264(\003\3722\341A\325"
+	.ascii	"\367\016\341\205\220T\222]NV\251\024\021Q\217\236&\274b\350\t"
+	.ascii	"\321I%\006\220\366l\314\347\036\236i\241\315\324`\263W\3158\233"
+	.ascii	"\215\261\0035\221\026\0233avCk\2112\260\232l\244 \223\2111\227"
+	.ascii	"c-\264Z\2158\023e\"L\006\332\370\252\241\201\315^1\033\332\253"
+	.ascii	"\005\201G\r\242\315\2536\2166/\027R\316u\310\357\375AKGN\274"
+	.ascii	"\037h\347\310C\332@\334\026\266\324\307vK\355\222\243\270\217"
+	.ascii	"\245*z\236\225>\350\033B\226~\247E\352\352\363!4\205\213b\242"
+	.ascii	"Z\371I  @\002b\214\263\016\303\302\336W\f\235\241]\206*%`\226"
+	.ascii	"\254\270o\305 \2118\006\217\340\373\007\256\306\245N\2006\363"
+	.ascii	"v\257Hy\306\261\2261\210\270\016\360l9\030Kz\243\322\311a\034"
+	.ascii	"A!cA7\264\020\363\n\2250\302\261\313\261\272\362\036"
+	.text
+	.section	.gnu.lto_osdGetHeadingIntoDiscreteDirections.129.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"\235\013"
+	.string	"fWS@ o\224\016pR\2034\035\344\371\220\030\274V;\324\256^\037\204[Z\205\r\203\332\001J\370b3}\200m\331)JXE6\007 \304\022\016\0318\200\374\037\260P9\r\2471B\366\336D\312\224\002A"
+	.string	"="
+	.string	">"
+	.string	"\027L\037\273[q\245\372\233\274"
+	.string	"\374\243N"
+	.string	"\376\331v\202\213\216=\006$|VL:\230B$L\273\335\245\032\356yz\374\2138\306F\022\331\020}\236q\301\356:7D\025n\275m\004\266\025\330\307\b\245;\276\364CM?MS\232VM\247\246/\t0\232 z\207\307.\205S\213E\361@6\330\356\330\022\333\332Q\250\001\033ad\341c\267\253\370\242\372s\246}\020\017\321y\311!\266v\003P\225R\310\202\373p\017\247\300T\325w\202\343\250\364\232z\216C\324\253\200\021\244\022\241\021P\236\234*\356\020\b5j\034u\230\3408\266<\331\335'5\203}jw\327\212\301v\332z\367W\017\233\214\226q.\230&\303"
+	.string	"h\220\3110\031\230\203\350\213e\303\311`\032\330\003\214\001f\243]\231,C\343\272h6\227\345\2005\b\230\346\342h\232\346\222t{[:\001\351\346\247\226\306\215$\022\032\001Q\3724\246 yp \033%\r"
+	.ascii	"\357b\310\f\rF\244\230\013U\333\004\002v4\355\303\264\323\242"
+	.ascii	"\3543\2561\022\023\"\007TE\3235\237"
+	.text
+	.section	.gnu.lto_osdGetDirectionSymbolFromHeading.130.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"]\n"
+	.string	"6TI>@K\225\016Kg\230\254\177\3549\234\007\034+\211\325H{\025\255F\250\233\205\370\177\t\"H\224\205\245dI\301\310\320\312\345\353CZ\303y\202\305E\244\031\201\35070\307\321\0222\362\245L)7"
+	.string	"4"
+	.string	"7"
+	.string	"\267\210\307\034\257\210\307l{#\300\307\236$\364\201\230dX0\352\360\332Mm*\341\336\323\363\317\341\003L'\025\251\364=3\001\273\353$\225\032\334z\333\031\266\001\330\277\b\331Qw<\352\3074\255\231NM\3771q\252P\372\204p\227A(b[\330\312\202\355\217\r\261\235i_\3037|\2162\313\217\335\007.\017\273K1E;6\tz\227h\005\252\344f\305T\n\220B\b\321\0050C_\243\3365\032\001\312\3201#\327\210\230\332\t\024\344I\327\277>`h\205\364\263S_j\004\373\216\335]+\004k\001\0056\031\214\2053\220\371R\351x6\234\206;\300\021\300t\272m\223\261h\266\013\247\263U0\334!\3408\233\247\3538\033$\265\267\246\023\220\202v\353^T\325\364\"\007\231\252J\230N\252H\026\r"
+	.string	"\357b\310\f\rFh\230cUY\236j0\233\263W\250"
+	.ascii	"\271F\005!0QQ\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_osdGetMetersToSelectedUnit.131.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"5\f"
+	.string	"FWS@\020S\224\016\330w\030\300A\036\322\307s\036\344\200A<\225\342A}g;@ \036S\335\376\323H,\366\264\201\r\316\251\036\205\225\020"
+	.string	"\002\022\244@\030\025\273\200\026B\250\235\2651\332\337\233H\231R@"
+	.string	"<"
+	.string	"C"
+	.string	"\346\030d\350\276\003'Phx\321cw/\314\t\304C\353\002\342\241\2168wK\223\363E\267\256z\003\034\250\222\322\007\342j\371<\013\263\273\227o\224I\331\354\256\263\364}\270\341m/\260\235\300\276\203]\256l\021/\365d\337\332\335\265\232\342S?tZ5\235\231>\005@\b\207\357\250\030\273\035V?\226\004\3160a;d[\362)\316 \273\"l\310\330\335\2143\225C\333\376\212\263\b\005PS/\036\252\204\024\342\345\312\244Bb=\354.\202\t<HDy\222\273+Rc\210\327\002#:F\351\303v\366\021\013\225\335\221\002\277\305]l~\211C_"
+	.string	"\345K\207>(\036^\257\272\265#\304\215\024\251\233\206}\260N4G\263}<X\007\243\200=\210\260e\227G\002\204\316\305\321\266Kc\300Y\005L\273>Y\246]\026\221\356j\362"
+	.string	"R\r\223\204z\325\003\350\006\333\252\336t\352Yz\312\221\032UOH*\022\306M#\006\025"
+	.ascii	"\357bl\025Z\246\246*\rTd\326-e\242\246\3617-pk\271\314T8H\205"
+	.ascii	"IP0\326t\031u\254\367,\306H({\303\317|\244*g\324\321\257-d"
+	.text
+	.section	.gnu.lto_osdGetMetersToSelectedUnitSymbol.132.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\035\n"
+	.string	"\246RE>0\345(\035\200\277\336\363\2477\236\220\310j\234B\230\235>#%\374{+V\254\"2;\243\227\337b\237\r\254<\202\2671\244\017\207\001\0136\301\345\210\021\n\275\032D\245\264\221\220\275eJ\0012"
+	.string	"2"
+	.string	"5"
+	.string	"\n,3 2\003v\267\223(\017?\245\206\376\351\363\260O\210)5\252\221u\331\031S\223aw\017FQ\225\340\263\273V\3258ro\267-a\333\301\376\f\337.\017\373\f@bC \206\322\232-\023U\236\330\237+[\266\325\252\352O\003\227\327\370\227\200\335U\315\300\3226\032\025\333&\273\343\007\b\223\303\313\\\253*\375AIq\002\340\270VdM\266\001c\205v\322\003\272\273'i\017\3562!\346&\245\005lo\034\006\344\354\246\"\374\227\3078\374\3277w\224\364\252o~\211\013\006y@\222\310\013y\031\036\205\005\370u\242\213\212P\007\032\201\235g\301\237\2067\352H\3377\352d\250\317\225-s\263\026Y\360\220;\354g}\314J\024\341!\2472\304v\020"
+	.ascii	"\3561\332v\257\026k\t\037\266,%@\310L\205\203T\230\004x\260\306"
+	.ascii	"51\005\013\262\206\310\343\256\223\252\206Q\227\276\266<\001"
+	.text
+	.section	.gnu.lto_osdGetSpeedToSelectedUnit.133.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`J\001\025\016"
+	.string	"\366\231]D"
+	.string	"\223\223\016\337\357\364\366>\310\377\221X\037!\264\201\026@\354\204\257s\244\202N\273\334\270\224x:M\255\325\005\302\021\013\002\321\231\307\001PO\004Z\365\235\326"
+	.string	"~\020WO9\206\304\316\036\"\204\354-eJ\001I"
+	.string	"C"
+	.string	"M"
+	.string	"7\361\0230\006-\260 \362FH\324\270P\303cw3\221\017\260\036\341\005X\217\032\342\240G\250\t\362C\217\001V'\033\370\324\033p\246\217\344m\270r<\016\212\354n\307\033e^'\273\353$y\032n\353\266\031\330N`\277D\361\372\324!\016\016;z\240D\371\331*.\025\204}\270Z\302\234\276\216\372-\247\241\246U\323\231\351\207"
+	.string	"@\331\360n\222\261\233\341\373\2617\221\305\3116\214\315\311\243@\016\331\375\340b\305\356\226\270\004{\264\355K\202\240F\016X\240\244J\2754\326t4*b\356\026\226\245\251\035\031\323\327\215\340\362\273\201\211\330\230\335%\211\360\342&\224@rwC\352\n\326\225\300\212\306(}\330\336\276\232\200\355\216\024\370(\236\342\343\317<\332\345%Oz\364_\254\007\232\213\n\n\205\350\024\223O\013\213\266\242\251h\016\036|\266\214\005\002\312J\226\342\371d&\006\274I\320<Y\313\266y2\216Jt\270Z\362\201.F\007\210\351S\377L\007#\210^\n\025\203m\250>\021)\027\257\031\252\230\252\216\216fD\265#s\262\361\020\035"
+	.ascii	"\3571n\026O\330\033\210\334VD\321X\212\3453,\006\030\244\302"
+	.ascii	"\007A\212)\310\260\031<\316\013\334Z63\025\016Ra\0224\2145\256"
+	.ascii	"\211T\213v N\227\214\245P\226\021?9\002\270F\314#\232v\215j\351"
+	.ascii	"\023\312\023"
+	.text
+	.section	.gnu.lto_osdGetSpeedToSelectedUnitSymbol.134.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"%\n"
+	.string	"\026SF=0\345(\035\200\357\037\377\351\373\364~kT\363\031\260\236\177\356\t\n\276?h\333`\342\241\t\375\331,\366\331\300\312#xf\222>\034\006,\330\004\227#F(\364j\204\265\277&do\231R4"
+	.string	"2"
+	.string	"6"
+	.string	"\254\024\002\213GG\214\300\356v2\345\341\247\324\320/}\336\365\b\2615"
+	.string	"5\252.7\343i*\354\256\301(\252\022tv\327\212\032E\356\355\266!l3\330\347\002\337.\357\372\024@\022ky\231\264f\303D\225(\366\347\356\256\345\312\266ZU\375Y0\003\031\337\222\331M\325\f\254l\233Y\261M\2627np 9<,\266JwLR\234\0014\254\r\331\223]"
+	.string	"\215\310Jz@w\267$\275\301]\036\300"
+	.string	"8i\001\333\030\177\0015\273\247\007\337\345\257\f_\345\2335Fz\3247\177\304\005\366p@\021\310\373x\026\236\004\005\370u\240\212\211O\347\t\201\035'\301\337\205\027\352D\337\027\35260\323\347\312\2259\332L\206&\017\271\273~\025\007-F\303\222\207\234\312\017\007\017"
+	.ascii	"\3571\210\210w\214\r\204\017[\226\022 d\246\302A*L\002<XS\327"
+	.ascii	"\3505D\036w\235T5\214\272\364\265\345\t"
+	.text
+	.section	.gnu.lto_osdGetVarioToSelectedUnitSymbol.135.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\035\n"
+	.string	"\326\222E<0\345(\035\200\357;}\217[\214\250\324\324\001\235\032\313>!g\353\2241\262]&\016\373\367\362[\354\263\201\225G\360\314$}8\fX\260\t.G\214P\350\325\bk\177M\310\3362\2453"
+	.string	"3"
+	.string	"4"
+	.string	"\253\003\024\220\215\026\001\273\333\311\222\207\237RC\337\364y\330!\304\024\027\325\310\272\344\214\250\231\260\273\005\243\250:\340\331]\253j\364\270\267\333~\260\275`\237\013$\356\333\345a\2375!0\257\330Ik\266LTIb\177\256l\331V\253\252?\th^\306\277dvW5\002;\333bNl\227l\216\031\032J\016/s\005\266U\332s\222\342\244m\\\333\261#\253\020\212\315LZ@w\327$\255\301]\032\260\314\240t\200\355\213\257\200\233]\224\203\257\362\030\206o\362\315\031$\275\352\233\037\376t\300Q\310\003y\025^\304\004\370u!\n\tP\367\021\201]\007\301\237\205'\352F\337'\3528\262\323\347\312\226\271"
+	.string	")\031\212<\344\016\373Y)"
+	.string	"4\r?\036r*9\002\020"
+	.ascii	"\3571\210\210w\214\r\204\017[\226\022 d\246\302A*L\002<X\343"
+	.ascii	"\232\230\202\005YC\344q\327IU\303\250K_[\236"
+	.text
+	.section	.gnu.lto_osdElementAdjustmentRange.136.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\r\001}\r"
+	.string	"\366\331]E\020\221\223\016\270\320#\316X\205\321\200\033\3061\310\357\316\335\310\247TV\376\036L(\214\370\340z\f\332'\375-\262\242D\221\355\r&\255\033"
+	.string	""
+	.string	"*FR\371.q\211\233\016\036\245\215\317zDM\032![\312\224\002J"
+	.string	"F"
+	.string	"J"
+	.string	"\226\343\t\\\267\260\017\270n\231d\343(\200a;\006'\0302*x\354n\246\"N:\324$\371O\335\343}\335a\207+4pSc\"\300\007\003\017x"
+	.string	"\361\342\251g\206\257\224\331y\260\273N\357\343p[\267\035\3016\004\373\027\002k5\331G\375\330\343}\301tj\372\037"
+	.string	"t\334\370N\263cwCN\217UY3H<\376\366\2372\210\355\330\"`m\366\237\351\024#\307nTp\313\r\260\247}\232\237 \035\345r\221]\023\216\214\335hb\023\354\001\226p\026\026Bj\354\256\003\177\205hedf\304-\337\345\272\225\352A\275d\216?\322\016my\357\372\026\253\022\371\331h\240\241n\271.\325\256\346&\205\r\230\304q'm\256B\336\273T\343\352\203\252\244\235\035\273\324\020\366\341\356\006VYPB\202\302\225`Z\350#\202\035\203N8\026\221\026\322&h)*\334\226\211V>\241\f4\342\262\223\021o\024\264Q\306\262m\243\f$\356\341\252\311\330\352\244z\321\022\024\311\353\245Gq\027)\bfvc\356}\260\030\224\0046H\313{&\221\t\024"
+	.ascii	"/\371\337\331\230\261\007\2429\307\333]\331\262vh!u;:6 d-\002"
+	.ascii	"\024b5Q\214\261o]\003\273p\315\243\210\345\251+\342Z\236J\310"
+	.ascii	")\205\332\003"
+	.text
+	.section	.gnu.lto_osdAltitudeIsAvailable.137.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`S\001=\016"
+	.string	"F\033`C\020\2176\035\233S@e7\013\311M\004\201\\\347\323\267\355c!}\205Q\363\352d_\270;\371\017\337~\347\022\215S/ \371u\247x#"
+	.string	"\020U\372$\024\373^\274\204\300\256\311\240@^\232\220\275\245L)N"
+	.string	"I"
+	.string	"I"
+	.ascii	"\263\244\032\231D\200\031\2276p]\032AF\304]\200\021\217\305\001"
+	.ascii	"\023\023\240\020,s\206\331bxw\031W;\337\332`0:\241B\237wy\341"
+	.ascii	"\021\373Ft\001|\237\210\231"
+	.string	"s\376t%\371<\252\326\306\234\323\032\372*\334\325m7\260\235\300\376\206\032\256\220H\371\254g\207\236n\311~\234K\262\017\336\227\233\356K\325r\325\321\352U\3651\001-'* LN,\212p\226\244Zf\212\034\321\341\340o\272\332\"\376\207\237\214\231\2728EsUL!\350!s]\036\3540^\030\232\252\344\226\342\306%aTr\177\372E\217Q\351\312\265\202D\036M\331G9*\202\257\301\233M\372[u\251\233\311 \352h\352:\347\364vK~W}\225\303I\212\217\266\260\245\230\357YVJX\032\317U\366\004\n\372\320\265\001\033G\243@\013\321t\\\334\307\002-D\323a\231C\203\003\361\3206\232\004\315\301\003n\313< h6\031\007\207\3134\006x\373\3208\031\310\266q2,\234\217sI\326\230q\002(.Vl\201\307%\261\275\213\351\254\307\227\275v\027\033\235P \013q/{\025\240\027\235\033"
+	.string	"\3571\302\210w\332\r\342D\2401S\t\202ApU\344\210\024\231\001a@\n\026\343\032"
+	.ascii	"\020\276S`\327\304\377&0\362 G\023\342P\205\022\225\263\242\350"
+	.ascii	"\017\025\\\270\373\264\032\347\252b\324<\275]\245\f"
+	.text
+	.section	.gnu.lto_osdElementAltitude.138.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`c\001\245\r"
+	.string	"\246\030ZD\020\221\223\016\340E7\342\327e\240 \266"
+	.string	"\214T-\326M\350 %\222\364\315\035\362\326\323~X\005\243Q\353?U1]\265\310R\361OW\013"
+	.string	"("
+	.string	"D\240\002P\372\001 \323\025\200\334Q\215\240\275\267\224)\005E"
+	.string	"@"
+	.string	"H"
+	.ascii	"\207\036\3312\n\250,Id\304\314\205\325\215\335\305\324\303G\207"
+	.ascii	"Os\344?u\315\306\221\016\001p+\177\327\312\365!\210\201\261\361"
+	.ascii	"\301\245<\020\023\210\355\251'\006\256\224\331\241`w\235\033"
+	.ascii	"\247\341\216\267\315\261-b\277E\244\324\016\366\337\356\256\365"
+	.ascii	"d\277\3735\232\206\232VMg\246\037\340\203C\006\356\251\027\273"
+	.ascii	"\246V\216eA\026!<l?\355\223x\211\321\273\223\013\330=\305x\331"
+	.ascii	"Um\274\271\016\255:H<\274> \006\207\006P5\\\362\225\311\265\273"
+	.ascii	"\t|\227\316\203\353\303\241\177\022\017S9,.-\035J\266\322\205"
+	.ascii	"\212I\304\323\244Fm-B~\363;J&\346Em!^\033\230\200\221\2222\216"
+	.ascii	"iK\230\220\337\256G1c\206UR\222\255\n\242O\346\311:Y\207GBB\242"
+	.ascii	"O\346\311:\331\002\007!\r\373\2240\360`#\240\020\026r\300\032"
+	.ascii	"\204\f\204\2114\r\204y\250\366o\365\344\213\306\006\026\212\226"
+	.ascii	" \214(W@\345\260\254Z\272\215\n\nO\2418\272\326I\242\177\242"
+	.ascii	"\002\t\001\224o\022\003  \260\002\031Js\357\030s<\310p\233aU"
+	.ascii	"\344f\374c\275\230`C\304\200\264P\\.J\260\020!\234W!p\340\274"
+	.ascii	"\241\035,dM0B\007\213\355\343U\275Wf\353] \030\033\232\353\224"
+	.ascii	"\361\345\330&\213x4\206\272\007"
+	.text
+	.section	.gnu.lto_osdElementAngleRollPitch.139.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\302\002\305\025"
+	.string	"\026h\215J\300\322Q:R!\034)\220\214j\204-\330\245$t!\350\313\322e\237\320\277L8\0268|5\334\217\031:/\373KX<n1\nF\376\"\261\333\355\n\202\320\350S(\2460S\002\225I\032\006+X\001\337\022B\b\331r\247\024{"
+	.string	"m"
+	.string	"z"
+	.string	"@@h\324\n|\371E>4\360%\342C\362"
+	.ascii	"\304\207\276\331=\006p\2508\006+pvFU\265V\330\222\370\355%9\212"
+	.ascii	"!\335y\363O\364\222\327\303\275<\021\241\343s\222\242\344\310"
+	.ascii	"\361p\222\"\307g\216\035.R\027\324\017U\253\247\243&>'\236\335"
+	.ascii	"\f{NW\275\236/E\3619\361\264z6\264\004\352\207\352D\2377\275"
+	.ascii	"\334\234\343\203Z\253'\257\247s\257n\373\203\355\025{\336\b_"
+	.ascii	"\221\022ES63\210\355\332a\304\220\265V\007\376\013\231\215<\361"
+	.ascii	"\320\247\021\037~7\200P\0022T3\2036\0207\367g\237\326Z\253\027"
+	.ascii	"\310\246\323#t\272\365\241_\204N\263\350\364\212N\227\3414I\247"
+	.ascii	"G:-\322\351\220N\323\235\336\235\236s\372$\255\021T\275'!\325"
+	.ascii	"\212\023\024R\237B&\024,\333\237\366[\334\305\355C4'\2515>(q"
+	.ascii	"\201<ik\337\264\333\361\355\310\226{c[\020\313]q\022w\374\322"
+	.ascii	"\313\0257\001\017\035\213\334\f\232n\270/]U\315\fzu7\211\345"
+	.ascii	"\322\275\211\242$\033:\246\334\f\322p\267\305r\245\330\243f\270"
+	.ascii	"\034\207\214\335G\315Y\343\007T\b:wdM\232vC\334\362\030\261/"
+	.ascii	"Iyv$\227\037\005\031\375\350\305\027h\363<\232\370p\356\227\246"
+	.ascii	"~!\236\357i\367g\223\307\210\001\226)Pq\245\310\026\250\270b"
+	.ascii	"\256\230\2535:\226b\233\201\231\321f\030f,2[\r\006\363\322B\203"
+	.ascii	"\305dl\260\224\002\256e\230\311\300fj5\031\030\013XO+\031`\""
+	.ascii	"\355\b\215%,\322\207\212\247\232\315Y\300\fw\334\325\262\366"
+	.ascii	"\3007E8\020T\253\356<\t\244\256\001\002{\002\205y\236i\365Y\234"
+	.ascii	"\355\ng\3220\245\b\004\221[\222\345\376DR40\303\327jo^\364/\004"
+	.ascii	"\035;\306\375\t\361\0027 p\202\031)4\017\377\374\037\033G\330"
+	.ascii	"\033\210Y\006\032\356\255\004\260wD\314\323\026\032h\013\376"
+	.ascii	"l\016j\366\002-\224\257.\220\201\205\030\3731\034,\324\ru\367"
+	.ascii	"\210\227\031\244\n\230 \203sKt\376%\272c\246PH\343^\225\204\\"
+	.ascii	"\243t=\256\250\361/\302%\202\031Z\342\264R;\354.g\034d/X\266"
+	.ascii	"\267\032\363\203m\336)\243#\342M\322\304\350\266.\002\201\n\013"
+	.ascii	"\300pO\345j\\b\017"
+	.text
+	.section	.gnu.lto_osdElementAntiGravity.140.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\315\t"
+	.string	"&\222C<@\305(\035\2406\325\335\337\277\276/{\216\016I\341\2056\265>\215\2342|0\244\025sV;\b\210\337\307\250\036M\343$\f\351*\242\234\032\200\2111\"\003\2039\272Fk\311\3362\2450"
+	.string	"3"
+	.string	"1"
+	.string	"\233\364\370\367)\365\363\237\372@(\202\237\332\306\345Dp\255\006d\304\322\324\230B\302\247\256\031\"I\365\222\260\273\326P\324\270\263\333V\260\335\261- \273\246X\201ee*\"\030\333W\373$/\371\216\2528\301\356\251\245\332\0357\336h\317<^cy\246\275\300\362\314\237\3352\270X\2603\302\201qB`w\003\0370\227J\232\302r\331`\002\240\2440gjKL\350\303\313\243\274V,\222\004\355\021T\331a\177\356\356Z\236\354\243\376\251\352_2 \001\304\247\304\002\243\020\007\342>\334\305\036\2167\nq \356\303-8x\335\026z`"
+	.string	"m\036\221\267q\016\334Ap\242m\324u\242\r3\356_+,\013I\232\232NiGx\372\320\363\001\020"
+	.string	"\357b\310\f\rF\360\020@'\024\205\367\022\252}\340Uu\257\264\260\336"
+	.ascii	"\226\213\265\315j\212\270\3131\233\244\201\251="
+	.text
+	.section	.gnu.lto_osdElementArtificialHorizon.141.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\305\f\035F"
+	.ascii	"Z}\024\03390\350\312p\341@\261\032\203\254\205\\\300\333\342"
+	.ascii	"\0370P\214\235\212\037\311\204\b\265\264z6`\\\365\034\2000>\306"
+	.ascii	"g\314\346Ch\244nJz(\212\021\261\204\354\275\267\224I\006\253"
+	.ascii	"\001u\001\257\001w\256\356\376\207\026)\241\302\362\206\206|"
+	.ascii	"e\256G(5%\2610\036\035\024h/(\020\261\211H\205\361( @'\211\315"
+	.ascii	"C(\214G\367x\366\177}6\360I^3O\231\321\317\210]\242\304\347\271"
+	.ascii	"\236]\344\0269\236%b\227\210\315\272\256\310\"\273\310\243\352"
+	.ascii	"\347\334\316\373\026y\347\310\271\342\021\321l\232\001a\244s"
+	.ascii	"\276\345\353\034\371*\267\336\211\247f\033\303u]5\030\217\026"
+	.ascii	"8\367\220P\255\203\353\343\3044\013\031\256\353\236\203\243["
+	.ascii	"\301x\336\375\233\303Y>\216\222W\255+\027O~\326u/l\303\214Gw"
+	.ascii	"\357Y\351Q\343\257\322\243\273\334\265\304\325deB\241I\246\315"
+	.ascii	"N\342\272\256\312\366\262G.C?\367\276P\275|\027\327\226V\026"
+	.ascii	"\326\225U\025\325TR*\n\tu\3642\252)z6/\367\352\230\001;Ok\217"
+	.ascii	"\364\3041y\327\231\352Q\341\363A\270\346\231\301\317\221\336"
+	.ascii	"\001\3451\027\233o\225\271\326\331\300\360\217\246\017\302\225"
+	.ascii	"9\263\242\220q#\303Yc\216u%\346V\247\327 \\\230\023\f\r\034\030"
+	.ascii	"\256:\267\306\234\013\004}a*@G\267\360!\364\206\223\02696\237"
+	.ascii	"J^\271\324\tvwzY\341\250/-rvG\236j\223(d>\bW\345\304\320\311"
+	.ascii	"\020\360\177T\030\252\213\\\335\217W\253\273\327 \234\335\373"
+	.ascii	"\332\260Q\035\323\"Gw\265\315\357_h\340\3508\205\212\233;z6\270"
+	.ascii	"C$%\031\327\344\314b\264\205\322\3650\371\224\362N\306\255\235"
+	.ascii	"\005\326u}\337\371-\216\215Y\035[\327u\331-N\356\013\340\273"
+	.ascii	"\307\264\273@v"
+	.string	"\2210\002\335\202\3146\021:m\265UA&\2325^\\\264\323\276\212Oba\001\322\256\213Kz\241\314[\327\325\002\244G\2121\203\006\215\364(\332\026\"i\350\263\223\204{\0361\017\325x\361<\033\217\273\374\034\351\365\016I\273\233\f\237$6\356\264\2735^\330\250\373sv\202\234\2705\330\370 #\356\323\331\t6\337\031\372\237\332\024\367\306\025\r1\256+\233\205\275\340\023\345\330\2139\272f;\370n;\322\243\357\343\237\302Fwp\342\250\361\342\356\336\0327\336\356'P\361s\264\315e7\305\r}O\224\251\274&T\336\022*/\t\225\227\354q\376\021\337\373\212PyC\250\274 T\336\017c*o\007\225\227\203\312\273\341u\276\032~\347\233A\345\235\240\362JPy#<\360\013\341\200_\345\373|\305T\336\260\224\367A\312\353 \345m\240\3622Hy\027\244\274\nR\336\004*/X\312\213 \345=\200\3445"
+	.ascii	"\305\373\305\274\005\216\274\004\216\274\003T^\001P\274\001\230"
+	.ascii	"\027\300\221\327\353\310\333\245\362r\251\274[)\257\226\312\233"
+	.ascii	"\225\362b\251\274W)\257\225\312[\245\362R\251\274S)oR\345\225"
+	.ascii	"Ry\243T^\244\221\027J\345=\252\274F\225WUyS#/\252\362\236)o\247"
+	.ascii	"\274\234\362^E\232a\024(q\327\263\270\256Q\026=\255\213P\300"
+	.ascii	"27\364\007\376\200\177\237\177\357\257\363\007V*1\023?fq\021"
+	.ascii	"\036+\256\236:\344S\304\241\225\315\325IB>\213ms\334\0051\221"
+	.ascii	"]U\343\255\203+\373\202~`\216\243M|\222\332\317\221\036\025\252"
+	.ascii	"\344\207\026\320W\005\212\024\210\226\320o\273\313m\3135\002"
+	.ascii	"\356\266\273K\022\231\271l&\310[W6\fG\227\331\270\311\322\315"
+	.ascii	"\271\204\263\224\223.\345\244GEX\t\272\315q\350\020}?7j\"\344"
+	.ascii	"\363\307L\234\332\352/\376\203\031\255\336Z\262\261\0323\321"
+	.ascii	"\352\017\372\002\250\306\213<\240\356\3170\311 \253A\334au\326"
+	.ascii	"\312\270\"\231\361\023Vw\210\004\330\241\257Z-<\226\242'MRG\322"
+	.ascii	"\016\255\236qD\310\207(\252\361\272\323\026\277Gn\207j\310\306"
+	.ascii	"[d\335q\254Q0^o+\326\267\304'\310\306\235\256G\305\257\021\324"
+	.ascii	"\203\213\365Xkm\361\373c\336Y\265\226'\222\005\300\260\327\364"
+	.ascii	"M\037B\214\030\341vX\325V\335\205m\212T]\325\347'f\233.\261\246"
+	.ascii	"\352\377\035\225\263+\\{t\2479.\215]\340\261\361\366^\315eg\314"
+	.ascii	"\251SG,\203\f'\375\245\307\356\220\3547\216\037\036\023\331^"
+	.ascii	"\314\226(\343\273\225\245G\223`Y\n=\335\301\2413fh\251\236R\033"
+	.ascii	"og\314\241\033\216X\006)\236gs\220\362;\245G\265Tw!\262\243Z"
+	.ascii	"\255\004\325H\0247dq!\357\322\013%$KP}\341K\234\f}\354\367]\305"
+	.ascii	"\332\236K\314\303t5\264\2617\3642\023\361\253\320\f\034\332x"
+	.ascii	"\313\375\340\357;RL\323M\333\037\213=B\277\031\373\354\3539\323"
+	.ascii	"MI\254"
+	.string	"\303D\230\b\352\033\230\252m\f\313C,\215\207\220\033g\312\037hggh9\274\200\230\tI;\217\334\310{\234G\016!=V\030\271qf\364\341\003\255\205\221\033g\252YZ\217 \247\2729\304\322\204\3740;3\363afCG\032\232\362G\217\033g\312\034A\322\224b\003\026\r\210Y\020\245\0204\264 J\344\236\332\233\313\222]Y9\031\252\365\332\356\227Y\322\335\345\025\266\262\314\222\314;\021\3556%\"\252\361\"\244\256\306[\265\323V\212nISIPe\177\220O\322\271\256\353\312\245\354\024}@WA\310G\021o\2111X3\350\260\036\321\273K\274\245\027\276\333\026hk&\373\240\303\034t\203~\320g\336\2559h\365\013\3235h\n\221\0264\003\005\235\240\027\364\317o`z\242\025\264\227 Sqm\031\206\247\220\031Y\312\022\304\345\030%\351\321\004}\277/q\0204X\277R\233\342z\262\364@#\350"
+	.string	"\237\230wS'KO\364\201.B\330GQ\033\335\332\035\303\r\t[\206\302Q\226e\316,\365\364\322\243'\372\207~j\262\313\324\004\244sB\207G\253\361v\252\257\212\"VY'\373\252\364\241\222\320\020\372m\377\274Gj\240\203\360\tBh\003\215\\\353\363W%\353\212D{\320ce\242'Lh\t]\326\377tb}5\211&P\270\214\363E\240Et\001v\362\001M\240\027\004\222\365"
+	.string	"0\201d}B\3472|\230\211\233\210\370\t\320\225\2006\321\004\n\231\207\001Z"
+	.ascii	"\273\221X\2521\212\331#I\217\006\350\277\325y\265\210\006\320"
+	.ascii	"g\246Y\376*\355j\257N3\225\350.\246\313\324\246\250\354\022\375"
+	.ascii	"A\347\200\366\250a(\005\221c\206fdD$M\222\346`\002\031)\263\252"
+	.ascii	"\003\021\2001TH\223$\303\034Zd\376\207\243\237S\360.k\266\311"
+	.ascii	"p\f\030\222\243\026\023\211G\r\211/ra\314\307\031XQ\022\005\231"
+	.ascii	"\356\341L\227L7e\316\326\242\302\017\3015\034\245q5\230j8\210"
+	.ascii	"K2\237\020\rvh\203\302f9H\305\214\263=>\234B\320,\214(\350\013"
+	.ascii	"\324\300*H\200\b\001\377v>\333\314\036\315\030\364\375\006>\330"
+	.ascii	"\264\035\207\276\206\257\200\206)\030\030h\305t\006%\\\224\227"
+	.ascii	"\b\301i\027\335\210\r\0372\030\352\002\016\3637\266\341Y\032"
+	.ascii	"\r\232\250\366\006\334I\214$@Jhw%\321\007IcA\034\330\335\320"
+	.ascii	"InYr\301\323_\205\3350\353k3\360\320\002\355\013Cf_s_a6\310\373"
+	.ascii	"\242\213\f|\225R\334\326\276\374~\001\260j\304#l;\032N\f\013"
+	.ascii	".\234oY\225\337S\303\177U"
+	.string	"\002\261H\323\232s\031\212U\001E6,\273-z1\347\244\261\274\340\350\224R\003Jt}\2470k\236)\332\211\337|\021\251\025\353\335\017i\316>\023Uz\253#\036\372&\026\204\360\016\275\214\362A\372\246\016\220"
+	.string	"\212"
+	.ascii	"\3474-\365\031bE\003\355q\021Wm\003\323]\324\0357\032\256\354"
+	.ascii	"\370\b\220sM\334,\320qZ\rN\030\025\3714\240\216SO\2504\321\346"
+	.ascii	"H\f_\335_\202\272\222\376\034\002p\251\210\221 \246\270\377\354"
+	.ascii	"/:\306\312\207\203y\020\233\326\214\312\016\264\244'RyhJ\217"
+	.ascii	"k\242h\036\272]\324\206\370P\3716\270\350\3443\232\301sMz\257"
+	.ascii	"*c\240b\b\252\036\\d\f@D\325\306\234,b\2031\226\005-R\021\355"
+	.ascii	"\343\342\030(\306\300g\342{\376\211L\026\355\210\r\213^\273:"
+	.ascii	"c\372\021\321\2356l\217h\252\361\306\271\204\034\033J\347h\262"
+	.ascii	"b\201\225b4\266.\250\001"
+	.text
+	.section	.gnu.lto_osdElementAverageCellVoltage.142.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`Z\001\365\016"
+	.string	"\226\235gE\360\222(\035j\017}\273dIzq2LU\321\245L\277\354#=\317\266\213NvrvD\323\254\242W$\320@\233\262\352\034\347\330\0025\316\300f\034\3511\231C\356\321\327\001\316k\274\373\032\001\371d\023)S\nP"
+	.string	"M"
+	.string	"X"
+	.string	"3\037\273\233\340\321\016\270\307\002\332\323\276\213\277@\375\345\362"
+	.ascii	"\273\255Y\315.\fd\020\367h\330K\266G\356$\333\243Qv\017\001\037"
+	.ascii	"6\325\300\205\003#\343fw=Eq\324\023\345\177\346\" +\365\354H"
+	.ascii	"\330]'\310\212\271\365\266\r\330\236`\177G\245\225<"
+	.string	"x\315\033 82\225\246lX*\365\204}mw\327\332\262\377\372=\217\335\235\226\356h\351mK\307-\255\305\264j\351\324\364\001\214\344\b\301:\r\217]\021a\316\312\242\315\212\307~\373\237\261\307\206\035\006\352\261\016\337\230=\210\034W\240\025\013U\20676\035\220\302\306;\215\372U\013\353\270ql\235jz\0234\341\312F\225\241U\375\032\0346\224\310\370-A\300\037#\331\251\375]\310\203\252+%<\030\3454Z\270\335}\340\317\300\220\201S\361\350\273l\217\251\020H\204\256\327\265\323\317`\206\274dh\221\264\003\026}F\f\024|B\243OG\201D\372D\261cQ\350\304\242\362\245|\244\317dt*y*(')\236\310t\362B\004\\\322\360\231<\226R\311\344y`{m\265\305\ta\311^Te\222\334\264\030\257\251p@fwu\320\002\267\212\200\340\261\243\266\311I\036\264\266#4\345\005\337\264\243\001\030"
+	.ascii	"/\371\337\331\230\261G}kg\333\223\215\025\336\302* \210:\022"
+	.ascii	"\351\303\234n\206\323\352\006W6|\265\205\t[2\226\255\275\330"
+	.ascii	"\177\\c\322p0`\0314\221\247^\001'yqM2"
+	.text
+	.section	.gnu.lto_osdElementCompassBar.143.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`J\001}\016"
+	.string	"\306\334cD\360\222(\0352\3132\335\025\227\216\235G\210\2213\3150\002\230\252\305\030\355\201\352\371.A\222\216\274\255\007\341y\013\221/\225g\262@\250&\332\314\240\370FT)\"\342x\037\037\240\\ \246\350\023\2627\2212\245M"
+	.string	"J"
+	.string	"S"
+	.string	"1!K\003g@pl?\355\227\270\t\323_-'\331m\355\220\261\013\363\330\263\035\032\366N<\334. \036\332d\363 \340\262'\023\022\337K\314\217\335\345\364\303MO\223\377\023\337|\253\323Ss\260\273\316o\305\341\326\333V`\333\304~\216\366\205\253P9\r\327\3562@\361\024\031|\230C\207\274\374w\350{\361\360\032\203\260dD\274P\031\263a\247T\017\366\263\335]k\313\376\353\027\321\322\233\226\326b:\3024\314\322\231\2465\323\231\351\217"
+	.string	"\300\361b\365\0327v7\004'\333\022\036\203e;\f\f\0236\230\226x\250iG\307\013\252\357\342s\240fW\365\317g\361\026\024\262\n\237\370\357\023\017\243zT!R\031s\246\220$\003|AT\265QR\362_\246\t\\\364\344T\325\277\f\021y\201xM\2051\252\021)\203\276\242\273\215\232%Q\027\352V:\315\240\022RI\324\205\272\225\016\305\002\311\343D*)!\0164\"q%\b\354i\350F\\\311\363F\034\007\266\317V[\336|\260hP\232\262\177\022\375\031\242\223\216ks\226x8\300\325\003\225\261\231M\033\260d\200\030\310\315\037\304\250\232\332\020\"\344?s:\2504\030"
+	.ascii	"\357b\310\304\373q4\270\270F\035\005\255\360\232e\267\235\273"
+	.ascii	"X\353\333Z&\325J]\327\355C\0365\004\020Q\312\251\210O\204\340"
+	.ascii	"`\306\267\315\360\007\030s\t\266YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_osdElementCraftName.144.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`8\003=\030"
+	.string	"&m\234G\300VQ:\345\2021\232\257\200\023\271XHz\n6R\223\305`q\017\265\261j\273I\304i4\340\226o\267\305>\336\373]^${]\334\245\371_(\213\222\245\344\215\017\b\266'"
+	.string	"\264\276\027g\264}B\310\336R\246\024\211"
+	.string	"z"
+	.string	"\215"
+	.string	";\025\0370g\r.L\346\344Ep\204\360\322\274\267\276\313\3604\337\245cv\227\002+\246\214\202\017\0325!c\346\234\256\265a\001\217\274\373\323\330C\360\223qS\032\363o\364\224\355&{\310\200(H\350`\334)P\210f\330\210\362#\232~:`\\\306\r\202\264\304\272\325\342\205\"\0367~\264B\243\n}C\030O\305\007MM\304\234\312\213\030\261\345\002\207\355FW\240\333L\025\3040\347\264\332nA\267\352\266u\266m\354\315\0204\233!G\322\361u\227\206\235\320\333.\375\023{\031CO\234\222|4\312\346\315tqO\214\346\021o\r\273\365\335O\303\222j"
+	.ascii	"\237zF\252W\252VIu\352S\207R\rF\365\027\325r\325\361\275{U\255"
+	.ascii	"\252~\r\313\013\222\333\231\220\346t\021EfJ\221I9\336\273}\236"
+	.ascii	"\177\004\344Ab\3579\370\f\232o\221\363\241k\232\223\007\341\322"
+	.ascii	"\025\302\313\005\361+\333W\373?^\024{\033\356\206\251Ay\303\235"
+	.ascii	"\244\b\347\2346~\022\207\016\241N\305w\t\356\201\033;\002*\327"
+	.ascii	"\366\360Ao\373v\001me\216+7Z\251A\351\306\255\2311E\325\240\220"
+	.ascii	"t8"
+	.string	"\305\220\213\273\221\353\236\250\267%\304\227\3404\310\315IS2BA.\211\356\217.\205\206\226z\354\224/EM\321\001\224f\355\233\227\336\346\2702\003MNVvq\376-(\371\271\2222\316\367\r\321\323B\323'\333\236\360\"8\r\262\3149-\3309'2\"A\2269\0039\007}#\201\007E\211\227\316\213\304\353\203\b\036\230\253D\016\b\035\327\315\016\217KB\002\303L\274v\\(`\260\035\327\212\347s\243\237\205\2302R|v\226$\374\276t\307\310\332]\240\236\317W\022\321S\223C\220\0033\263\253\005\260;\263\312\264Z\rCQz\354\260\200\2133\370$[+m)\003}\327\333B\323\247\3079\347\374\026w\007\037k[\033\240\n\223\227\237\031\252\365\225H\364(\310\371)l_\276UmT\252A\205\013nj\377\263c\246Qf\005A\250Q(\304\f2\bA$\"##\025&\351`\202Ase\035\021"
+	.string	"\312\242Q\226\315\017\372\225\027-"
+	.string	"|\236\306\2402\r->\371H\210\354\275\237\241\340/4\327\223\203\200F\3607\250\032"
+	.ascii	"\0011Xr\247\367s\331xUu\204\203\207\334\020\023\211\353!\f\354"
+	.ascii	"\345A\367\352\303F\231\235\241\234A\312y\222\200\221Jc\231\245"
+	.ascii	"\301\"\326\207gR\216\251k{o\201\271\034\302Z\273$,&\232\365\237"
+	.ascii	"-#G\210\260qB\312@\024\177\214\235\267\320Q\304<j"
+	.text
+	.section	.gnu.lto_osdElementCrashFlipArrow.145.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\253\t\205-"
+	.string	"JL\304\020E`^R\007s\3271\265\023\324\345j\016\374\300\005[\225\313i\217\234o+\032_\320M^\332E:<\250*GgF,\207\bC\311\360\232\271\264\215<\2031\275\024\207\307>bv\036\262'[\333{\357\235RJ\001\374"
+	.string	"\337"
+	.string	"\365"
+	.string	"j\030&m\245;\255\241\255\306\2764\026\243\306l\013\023\243u\025\253\266\362\242\357\215\3332\366\230\261\311\271\367\036h\225\025\264\255\036\245\355\314M\245\317\254\372\t\243\203\367\022\251\373r/\232\022+\265\2552Z\017\327V\333\026\256\255\262\025s\224\230u\225\t\314\262l\251\351\271\367\"\337H[\2651"
+	.string	""
+	.string	"\243\"\261\210h8$\024\n\006\001\001\177~\276\036\257eW5}\267\342f\231x\\Le\033\317:"
+	.string	""
+	.string	"#\263)^$\026Ia\342DeK|8$\024K\342BHA\226I\310\r*\035t$\314\201:\215\027\222\036\363\002\342@0\377Q\322\364\337\017\367\235\365z\370p^\233\306\353l\314\353\313\331-\2441/\036\276\366\230:Z\315\321iJ"
+	.ascii	"\315\0208@&Vj\004\346\206\303\307\314\362\0072\265\322\243{o"
+	.ascii	"\253\265w1\227\356,\323\275\227\235\213y\243\371\330\314\276"
+	.ascii	"23\004\346\226B\312\177'\2675\325*\340[\255\223\224\321(P8,\267"
+	.ascii	"c\177\001\317\256e\227\376\361\233\317V\237\336\322\377\351\257"
+	.ascii	"\"\332\213\223\222\\\027\250\002a\\\376\033J\223M\331\323\337"
+	.ascii	"\370\315e\253O\257\213k\277\277*Fk\312\222I\264\026\247\002a"
+	.ascii	"\314O\235\005\352(w\357]\260\326XPp\213\265\312)\244\274\271"
+	.ascii	"Z\345\226Z[\355\357\257\346\232\272\347\225\3371\243-\375\235"
+	.ascii	"\314\235\336'\302\334:#W\347\245~v\017P\235\223\220T\347\243"
+	.ascii	"\326Y@[i>\032W\347b\2475\023Y\347\"\326\231\210u\036\262\316"
+	.ascii	"C\254\263\220u\026b\235\203\254s\020\353\f\264:\003W\347\237"
+	.ascii	"\325\371\267:\373T\347\236\352\314S\235[\325\231U\235\327\324"
+	.ascii	"Y}\347\364\235\377\235\375\235\033\001P\0211f\273\221\271\327"
+	.ascii	"\306\335\236\033\027\357\373*\250\333\357\177>\345\2425\266\364"
+	.ascii	";&\376\357\3237-=\310\367=\030\362Ff\253\017\222\177\357\344"
+	.ascii	"\003\275\244\303\016:w|\342/\341X\372\035\353kk\314\275u\357"
+	.ascii	"[5\275w\2705\310;\311\032\302\312{\340\023\n\307\374\240\321"
+	.ascii	"@h\357\305Z\300}\246\343\"H"
+	.string	"\2300am\225\367\275\347\b\332\275J\336;\333:\251i\214\265m\\\331Or\253\300~\2179\362\335\266q=\352=\241n\272\215\353\372G\317\276\365\325d\272\314\005n1\316\260\301\233k\303\332\352\372M\247\t\247\356\353\312\357\234}'\017\327\312\242*\322\377\326\312\236n|\342w\271X\325/\001\235\023:\263\007\020\336\\\352\367\227<dq\313W\256\357dO\373\211o\312\307`k\026\263\026\277\213\331\370\305Gz\177\323j\262\364\273T}\247\367\216,\033MR.\256\376>'Q3\250\033\226\333\371\2757OQPSMQQTU\274\247(\250\251\246\023N-P\250\350\261\354\264\304\242\305\324\223\324S\324\223\b\023,\250\220S(HH!\235\252X \227\216L\245\342\251\n\331\202\212\252\n\351C\273\352\364>\021n\355\310\342\256~i\364.\nMEm\364\031EO\001l\255\356\031@\215\005\317\"\372$\230\032"
+	.string	"8\030\\9\374$X\232\221\235!E9\r|\206>\331\354#T\306\306\206\030\307\241N\370\311&\037\243+d=\212\336(\335{\211~\357{UI\327\206\333\356\275C6\035\356\b}\262\211\247N\315B\25324\367aN\360\223\315;B\272$\277\"d<\204\322\204\210\023\364\311&\035\033\204N\231\340;\243\335\264r\317\215h\"\020\306\275bm\325@\230\235+n\320r+\332nc\005\305A+\006cm\025\350\223\315h\335\263'\245\315F\020\361\325*\321:A3lm\200\336\t\246\323W\225Q:(\334\021\370\277\177$P\2675\355{\340\027\325\232\301\275\367\347'\200\307\250a@\344\020T\210DD\244 )H\322\001\300\002\031\2312n\021"
+	.string	"\2555\320\324\310LA\322\001_\234\337\361\021\007a\276\"RY \\\333\237E\355\r\375'\335\212\313\276o\375\244[\0015\0242\221jM\321\036r\264]"
+	.ascii	"\026\020\360\357\320\030_\222\302e!c\303\330\002?\325\002\362"
+	.ascii	"E\321\321\343K\246\254\315\035I\270kj$\300\177\275W\360\317\222"
+	.ascii	"\037\300\267bS|\343\251u\263\366h\265\350$&c\237\314\273\233"
+	.ascii	"J\233\242\021 n\004\207\206@O@H\022]g\202p\240\340P<|\2548d\305"
+	.ascii	"\337\254\254}\342\310f\257E\223\265\202\3143\243\216D\020\375"
+	.ascii	"\231\252\367\306A\300s&\\9LG\205\352\230\245\225\301<Z\370X<"
+	.ascii	">o\006\251{\211\371c\024\354\211\305\2160w\242\342U\226i\320"
+	.ascii	"\001\273\217\rJ\372\363{Q\227\036O\301$r\315\375\233\317L\363"
+	.ascii	"6\037\t\231 H \305\\I\322\003iLP\347\030\33576\375),\005}\274"
+	.ascii	"\030]\330\265|@\022;\002\367|\305\333$\362\256\217!\235J\222"
+	.ascii	"z\256u\022pL\254\301\216Q`P\302Ec7/\373'-]\346\243\370\302B\321"
+	.ascii	"HLH\023ff\371O\201\324Fw#\242$(\226\311\377EH\360\316hx\336)"
+	.ascii	"z\325j\fn\327\212Hz:\201\321\341}2\r<\262RUg\007\007\305\301"
+	.ascii	"7\2376\231\376\001"
+	.text
+	.section	.gnu.lto_osdElementCrosshairs.146.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\030\001]\013"
+	.string	"\266\223JC \251*\035(\376 [\252\311\020(D\177\325\257e\375:\234\223\321R!\313|J\030"
+	.string	"\340\005\324\031f\021\036,I\262-\325\b+ \006\001\004\020d\001O\346$\037\310>\037$\"\305$\215\020\262eJ\0014"
+	.string	"3"
+	.string	":"
+	.string	"\3369\227\317t\347\274;t\347<\332\017 B\366\304y\225\210\f\230\260\273\337<\371x\035\375\267|!\245:]/\024\273kM\251H\356y\333\022\2669\366W\002\337vw=Y\366\311\277S\365\246\352\251jU\3651\f(0\325\033@\330\035\251UX\031\227@\005c\373j\237\345\257\361\244\351\r\273,\007\007vK\2155\001\253\005.\t\005<N@gg\025\243\221\021N\352|\001\037\244L\313/u\347\036Z3o<@\311\333\335\t\037\200\330\341\245\234\363M\335\271\317\316*\346\"QZ\263\313\223N\023;\243\020\b\002?\340\305\236\215h\024\002A\340\007\254\270\020\205_\b\303\002\364yD\321\267\211p\230\001\212\337(\f\305\017S\356\267\235,{\024\030\310P\023\304V\2401\021l\264\231\001\016\205\315\331\t\034"
+	.ascii	"\357b\310\214\027T4\\tp\021\020\f \002\362@``\004\270\b\b\006"
+	.ascii	"\020\001R\201\271\340\" \030 \202\bi\202:oT;\230\312Z3\241\035"
+	.ascii	"\030p\t\241YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_osdElementCurrentDraw.147.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\345\f"
+	.string	"\366\331ZB q[8\034Dv\357t\361\342\242\240\013\341\003\217N\336\020`c\n\327"
+	.string	"\206f:\247\302&\2725\232\251uL\207\333\016\204K\365$\001@\232\027\304\037)\322\251\212#\261\2101@#\0225!R\246\024E"
+	.string	"D"
+	.string	"H"
+	.ascii	"O\373)n\372~\022\271\200]\222\312\213]Qc\rv\313\342\t\\na\037"
+	.ascii	"p\271\345\317V)\340aA\020"
+	.string	"L\245\017',\273\233\251\211\177\317\317\277\3119\302\021\350yQ\330]g8\032\271\365\266\023\330\256`\277C\240\324\022\366\253\335]+\311\376\351\307\216\272\257*]iZ5\235\232~G\200\222\020\243\247\324\330\0251\336\330\224\205r\342\250\337\376M\214\261\305\253\370\216\342\360\035\331\203(\231JVv\227\301-G\300n!\250\002\376\300\220\017]\355\boo\261!i\354\256\004\237\305\2073@R\272\345\213(\307)\224\243\177\362\253\352A\024\242\034\355\0317\214\3135U\003\242\210\364zAF\312\b\262\204r\364\225\266\247!\037^\252+-1R\"\005\331b\356d<\016\032d6\236\007\031\214\346\301\3514\220\215\203]\356l\274\220\217\266i\0314\013\036\217\313>\037\234-\353t^\2669`\016D\353\262\020\216\3532\214\270\257VI\306Zl\244B*2\200<\211T\325\257\270\013M\001\311.\370\320\003\003',p\022"
+	.ascii	"/\371\337\331\220\261\207akq\373\315`l\252ylXXY\203K\032#\214"
+	.ascii	"i\311\340\232\230\206+\001s\320n\236z\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_osdElementDebug.148.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`l\001\215\r"
+	.string	"\006\232ZC\020\223\222\016\363\027\264H!\341\001\\\321k\226!<$\202\217\200\373\265\276D\004\251Ra\315\363\250a\177\rBt\200\020\030ldQ"
+	.string	""
+	.string	"BJ\"h\233s\022f\367H\303\373\020\2509\262\311\336D\312\224\002D"
+	.string	"A"
+	.string	"I"
+	.string	"O\373+\336\262\275t\362"
+	.string	"\273\243\031\230\335\316\262\025\377\334\235"
+	.string	"\374\213\027"
+	.string	"\377\274\331<\n\204\330\220\203\026\025*.=v\367\322\023\337\236\233\177\026\2578Q\350II\330]''\032q\353m'\260m\301>M\347\376|\023\370w\2054%r\244\210A\311\032\273\013\245\232\260?\355\356ZG\366K\377fJW\232\216\231\2464\r3\3754=eZ5\235\231>"
+	.string	"\016\013I\364\035:vE\324"
+	.string	"Y\231\027\303\262\261\035!\333\033\016\363!gv\367\201_C\303\307\300\n\351\004\376UZ\225(\215\rNc\006\245\021\236B\3532b<\375\213\352t\227\277\300\310\033\007\374S\375\r\024\327TK%\210\335\371\213,\356.\004\277\305]x\360I\177\326L2\026\tY\200\240\302\004\n\003({:Z\t\t\366\3018`\027D\264\354\"\031\301\360\271< \355\352\034p\326\001\003]%Y\006\2726\335~Z\0359\372\370!\203\242 \314\311\324I\241F}w\033\036\005+\273)\347\260\230\022\302\300\3160\222\347<-\t\r\034"
+	.string	";\316\275\344\177gc\306\236\205\346\026zF2\325H\351\232\360\032\343\300\016`\006l\327*9"
+	.ascii	"\036W\231\001\333\305J\022\200\307W\206\300v\275\222\351+1C\325"
+	.ascii	"\205\005\314\271\004\333\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_osdElementDisarmed.149.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\234"
+	.string	"\325\n"
+	.string	"f\024K@0M\234\016\240\302y\2572\263Y\035@=x\210\213u=,\326i\203\243{;\266\217\006\016\366\033=\030\024\375\024\341\357\353{JC\201\345\002\204\\\305\035\250-o@c\304\313\257 hw\3332\2458"
+	.string	"8"
+	.string	"6"
+	.string	"\226\022\030\352\200bw\2618\341\334\255\250\234\177\360\026\336\327\335\272\036<Z\036\251\017'.>\220%\021Y\360\016^\031|\037U\310\307\356Z\275\317\301-o\033\200m\213\375\215\363\246_\252\372\020\f\f\r\276\227\360\260+Z\255X\224\004q!b\373j?\303K\334M\n\236\261K\"q\332\r)\246\\\227\016/\231\227\3275\346\2459\333\004\307\202\355\002s\306\203\277Bp\030\001R\225\377\311|\234\321\032\032}\256\341\033\020\370\025\234\240\243\367.\375\316\274|\f\020AD\212\221GWv\330i\224`\337\332\335u$\331\252\016\034M\226\3110\031\304\227\312\306\321d\231\f\223\t \260i\230\246\300\200\fv\331lX\245\303\232\201l\203q4m\203E\302\275\n\b(O\374X\227\312h\037\330\364\236\255\330\235\202*u\212\236\004\021"
+	.string	"\357b\310\f\rF4&\200N(\033\357%T\253 \360\212\020"
+	.ascii	"L8\026\025\336\301\224K\260\315j\212\270\3131\233\244\201\251"
+	.ascii	"="
+	.text
+	.section	.gnu.lto_osdElementDisplayName.150.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`8\003E\030"
+	.string	"\306\254\233H\300\026U:Psl\264\017\0307\346\003\272K\336\0053N\326\231\363np5$\320KlW\004o\303\r\255\243\347\367~u\025\003\023\214\004C\262\256P\026%K\311\036\252\nc{B\006a\236\376\331\321'\204\354-wJ\001\207"
+	.string	"{"
+	.string	"\214"
+	.ascii	"\027P\353\013\244\"\265\356j\\3\236z\367Tx:~&<u\313F\"p\242\272"
+	.ascii	" \340\212b=\276\324Z"
+	.string	"U\013\303\001>ww([\037\305\220\316-\311\226\177\335K\262\231\353\343\202!\241\026\027\347>Q2D\203\321\344=\230\fi\2608\235\313\203(\tj\026\233\023p7b\274wBN\331\342;\262xi6\360\031\351r(+\\\314\224\n\031\262\353.\203f/)E\n\265VK\331L\3506\335\366\315\366\215\275\025\002D;\376\355\324\254\021\362\262S\177\304\376\006\r\013\016\243\037\031\264w/\2715$\272*\304\373\302N=\367\317\240\2504\200P:\206J\237\244\264\211J\227B\351\221J\213S:\234\322t\245\347y\367Ji)\245O#\223\3436;\226`\255*\202a\252\023j4\343\274\333\337\371\275\035\347\321:\217\301\253P}\n\033\216\211\257\326\235\203SG\030O\025\314\237l_\332\327q\\\3539\023\001\\b@_\370\221\022c\255\365\3067\302\220a\274\231\bO\3055\020#7@\322\2655l\220\227\205\253"
+	.string	"\266.\317\245;\245\304\200r\347\322\274\262x\211\001\211h\374\\\320\255\005\271\334\017\361\256\300dR\207\023\311\251)\372\220\3006D\356{\2476hH\277}\242\005\347\233\226\2213k\343\254\344e\236\353*\340\373I\331\255\371\227P\0044\245\344\234\360\333\201g\005&\223l\373\301\201\344\330\330j\255\022l\235\377\370\200\240J\255\260\033\037\017:\027\215c\323C\"\304jg\005b\265\301C\017K\025B\207\303\216\n\207\247Ge\203\300,\021+\036\025\t\026\213Gu\332\375\\\367\243"
+	.string	"\303\304\311\317\276\206\214\341\223\334s\242v7\310'\364\217<\370\320\330\016\330\266\304\354i\001\354\306\254\\rZ\0134.\277\034\025qk\026\223hj\251\254\344\240"
+	.string	"\317}\326Zk\270\2653\bQ\233Z\231(Y\250"
+	.ascii	"\321L\353\037\201\360I`\363K\310\264\204k\332y\024\003\216+n"
+	.ascii	"i\017T\343%\203F\355\270\033C\250Q(\305\2142\31004\"##\025&\351"
+	.ascii	"p\202\231\271:\017\021 B\233Q\226\315\177\372\203\213\003\200"
+	.ascii	"9\317`\220\r\215\276\037y\244/\307Vr(\370\205\226\nd\260h\013"
+	.ascii	"\fW\263Az\265q\314,\271\350\r\261\270\273\242\345\337\003\223"
+	.ascii	"n\266\020\351\364\"\f\363r\253{up\200\2549\222\263\0325*\r(\374"
+	.ascii	"T\002\230*\215%\226\006\213X\017\257\251|W\271\350\350\005\246"
+	.ascii	"R\205i\215\"\260\231h\376?\257\250\034\037\206\325\026\025\273"
+	.ascii	"\265\361\001\323\335\246\256H\004\325"
+	.text
+	.section	.gnu.lto_osdElementRateProfileName.151.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`Y\003%\031"
+	.string	"\226.\241H\300VQ:\371'\301\313\306Yp\037\211\335\035HM{\2629\256n\231\351s\3022\303\240\037D0e\361Y\264S\0270G\236\300<\203\224\330\300\327$\be[V\230B]\334\202\214\375\372\035\374\320\266O\310\336D\356\224\002\217"
+	.string	"\201"
+	.string	"\223"
+	.string	"Cnd\373n\305mj\325\361\264\244V\036\216q\304O\363\356\242\237\342\001\320O\333l.\002X\324[\003\243&\234\221\246Z+lwX<\310\273\251\264]\f\351\004\027%m\376\217\216\032s\267\213\tr\374"
+	.string	"=\004C\0302\256D\360\302T\343H=\222\372\230\361\tn\221$'\253\034\016\224`\024\204\307\221XHP\002}\305\031G\201\n\272(\215\371\024\0314@W\214\242\361G\227>9\036)\303\t\265V\3131\367s\247n\233\310\366\003{G\004\273\241\021\237\032?\362\244\024>\221sf\362\343\247?\333\377\b*#\004hG\376l\336M\256\356\tGQ\220W\207\375\372\356w\265\250\264M(]C\245Y+\275\242\3224\241\364\f\225VM\351\324\224F\201\322\342{7]\351)\245\301\225^)\375\001,*[rgRRk\214\037\231*e.\365x\357\366y>\022\221\027\261\275w\363\372S\377b\310\250L\227Zy\013>\355@\374D"
+	.string	"^e\373\322~8\237+\274\t\315gb\341\202\270\202~\252\226"
+	.string	"\217]"
+	.ascii	"\211Z\033\203\006\3711\265\bz\366fqQ\013Z\301\371\346\212\373"
+	.ascii	"\342iJ\302\371v\344O\026\215c\252\314\325\325\350\334\347\350"
+	.ascii	"i\351\221O\031\256T\203\200\245\326\032\301\346\360%\035\304"
+	.ascii	"Z\353\003%(<\340\f\245\240\237s!dYJr\244O A?\247M\202\341\244"
+	.ascii	"\004z%]k\307D\310\217\006\367vC\244\333\331\325\371\267\222\230"
+	.ascii	"\0276P\226\321\335\017\275,=\362\311>\022\0252\221h\300G\320"
+	.ascii	"\317\262\207\006\301\200v\242D,'F\"\326!\004m\006+!\363\220\003"
+	.ascii	"\003\241C\20310\340\231\211\230\016\354\304l\246\003S\361\352"
+	.ascii	"\217~\027>!);\313#$\322C\271A\260\265t}\354/\335\177\262\241"
+	.ascii	"\366\032*0\024\246fYkC\267fe\024\326R\020:\342\264\273\021\256"
+	.ascii	"\316\241\226\371\3329\242\354\363\335\301Zk\245\253\373\rm\355"
+	.ascii	"k\227\tL\213\240\325\372OB\324\016\3704\372\371\361KjW\0132\301"
+	.ascii	"\371fV\2654\373\026@x\344\317\255\235\331\025\023D\250q\034\244"
+	.ascii	"\210RH12\"\024\320T\240B\007`\002\0319\244\036\021\340M#R{\006"
+	.ascii	"\017\310O#\330\007\206\034\324\322!\305M\222\370 3\331\202\211"
+	.ascii	"R\325\321X\322*7\330\252\003K\026\006\370\253-KZr\221\027[\363"
+	.ascii	"\305\265\016\261]V\004\356\024:\030t\030\250\316\031J\024\017"
+	.ascii	"\211$\230\006q\251\326\372\0246\337#\305\t\241\203\364V\205\311"
+	.ascii	"\240f\230&\215\234\370\374\326\312Y*o\202T\271\204\035\364\330"
+	.ascii	"m_h\256\337i3O($\360L^\032\255\345\223BF+\306EJ\243\006"
+	.text
+	.section	.gnu.lto_osdElementPidProfileName.152.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`Z\003\025\031"
+	.string	"\246\356\240G\300VQ:y-\360M$8\001\342a\242\251\321\252\353\321\327\017\230\215\310\324\027\332\016\320W\032`O\3421d\247&8\006\270X\024\203\224\330\300\327$\be[\314\206\330\022|\001P5\225\246\233(\372\204\354M\244L)\217"
+	.string	"\177"
+	.string	"\223"
+	.ascii	"F~$v\\\213\343\314\351\203\367dN\235\003;\b\037\255\273\216|"
+	.ascii	"\f\037@>:f{\031\340b\312 \344p\314\224\224\231s\266\366\207\303"
+	.ascii	"\177\272[j\354!(\343\267)\215\371\317=E\253\311\036*\350ATt\360"
+	.ascii	"\003g\324\3202!\314\227\034W\022R)\344\306\343\267I\226\234V"
+	.ascii	"\265\331G\341\b\021 Wr\241\237\026}\303\033O}\f\3000\221\371"
+	.ascii	"\225\0328>\035\032I\264\347\256C\265 U\260\302\234\323J\253\021"
+	.ascii	"\3354\267\215d[\202\275&\002\273R\311P\216/\371\322\n\037\311"
+	.ascii	"=/=\355\321\177\355\211\216\232\360\212\2004\312\326\311tmP<"
+	.ascii	"\222\214\274>l\326q\277N\216T\343\200\352\033\251\266Y\365J\252"
+	.ascii	"\001\200\352\032\251VE5MT\247>"
+	.string	"u\370\335-W\035U\375\255zU}\0026^d\324\316s\232\223F\324\231i%6\005\371\356\366u\276\022\222'\211}\267\363I4\037\343\2263\0023\247\256\301\243#\204\217\t\276\253l_\355\007=_\270\024\230\037\005C\206\260\205|Tm\001 8\001\232Z[\003\007=\215f\023\b\255\314\341\246\366\3132\353\305\r\227\025\004\345d\326\003\322(M\242\221\301\022\327\366#\343\276\307\256\213\220Bm8\323Ok\313\234s\202\355\341O>\204sN\tNT\200Xp[!\037\343\266\27045\271\322\243\215#(Evi\006\217\351\363Ju\326v\221\320\323\374\255l\007\311\006\264k\363o\246\247\030:R\346\221\273!v\\\204\024\312>\023\026<!\222\237^B>\006<\007-\342\001,\305\tW\217\313\204\353\303\b\330\253u\202\007DOK\204\017\254\365\340\200_(\\>\255\024\257\227OK\245\233\317\3750za\254"
+	.string	"m\320Q(O\345\376\276\234\225;d\277\351\376\224\016?\254\233\201\333\230\233\265Y\034\2717\253Ul\326\302\221S\021\334\016pm\006\273D\326FZ\312C\307\375\233sN\271\266\357\310\234e\355\362\314\2740Z\255?e\304\017\202\333a\362\361414\273\332/\312\254W\263\252\005\260\1771$H\243\234\2635\273O\263D\250a\034\244\210RH12\"\025\320T\240B\007\220\002\0319:\017\021\340M#R{\0067\362c#\335\007\207\034t\325im'\231|\304\363@!\240\202:\264\324k\t\030\024\357\007*\013"
+	.ascii	"<\325\365%\2009\363\025\037\024\251{\035j\277H\021\274SHa\320"
+	.ascii	"i\240$\357H\242MH\204\321Af\302X\217\006\017\370\212\032%~C%"
+	.ascii	"\254\3266,\210m\322\234\211\306\352\007\331K\347M0+\221\360\255"
+	.ascii	"\212\334\366\205f\374S\033|\342!\3213\232r\217\352O\305hM4\212"
+	.ascii	"\224K\r"
+	.text
+	.section	.gnu.lto_osdElementOsdProfileName.153.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\013\004\375\034"
+	.string	"f5\272H\240\330M:\203\3023\336S\255'\315\350T.P\376\274\f}\301\272nPjd\020\206\227o\320\272\227Z\352\377^\356\323\037=\324\316\307G\306\343:\360\n\263\343\304\276\242\034S/e\036e\006t\304n\215\020\262\211\334)\005\243"
+	.string	"\226"
+	.string	"\260"
+	.string	"\2160Aw!\214\327^u\341%+HV\253\320\301\251'\330\237\366\201\034K\367`\214\343\324:Uv\244V\341\003?(O-|\200\361\264<\200\361\324:{\213"
+	.string	"\031uIB\026\020_\227\230Z\353mu\370\346\242\360\036\247\356%9RqiS\347\323~NK/Iq\2414\221\202\322!v/\336\034\257n\234\212\273\365\305\244\306\311'\002a\371\250\272\227\214)^\353\b\244\236p|\313\033\247\211\r\310\220\200y\024\0339\304"
+	.string	"5v\374\256\365\331\344\264\233\223\264Pk\365\3749=\335\265\333\276\262\255\301\0267*\210\346\177\247>\321x\272\013T\025\346\363\357\334\367\240vs\350\234\375\016\3402\373\362\2351\315\241k\323.\312\315\377rv\307\316\312\214\355v\311\026\356\346R%\311\252`\336){\347\301_\347\302;\007\207N\337\220\3236t\272F\234\246\241\3233\344\264\215N\327v\232\266\323\3458M\212\323\343\273nJ\247Eqzwz\356\364\013\330\204\261r:\031.\265\326\030\232\3251\032\306\343]\277\320\376\226\357\305\365 \272w1x}\252\247\001\314\002\273P\236\366\210\277\226m\001\0326\314\377h\333\303\333%\223[\256H\305w6.\271:;\2630\276\263\257\253\262\034t\251\214|\334Kqe\341\3151$\356$\250B\023!\005W\230\f\361"
+	.string	"\227\214{\257S\261\250*eaLs\270P\272`\221\211\0260\277\337z\022\017\275\377>\224=\f\013l\020!\346\177\356\351Y\304\221$\315\\\251\265R\360\217t\030\301\003\264\2121F\210\232R\026d\232C\002deTv\251\374\377\030\351U\241\355\224\203\306\335\023\\Xxs\214mCx\221  `\255\365\307\366\213\023\021R"
+	.string	"\254\225\367c\342`C\006\256\324\312\243 \344Cp\276\325\251\003NJ \204\341\003\007\222\350.p(\2142\340V\020\245\310\035\261\230!=\344\203\324\302\bW\204[\201\023B\201\224\273\031\021\231(\272\r\035!\335|x\234c\201;\272\265\310\345\216n6!\323\265\376\031\303\037cL\273+R\216\037\273E\021g\3516)\215\276X\t%\035\240\001\240\027\233\255\331\033\2726;\245\324l\207(-V\310\2452\231\205\356,\375\321\334\364\340\305Zk\035\227\352\fF\234\335\3315\223\322\203\242Y_,\205\322\001\240\2374\236\376\327\205\2664+*\361\235\331\266\2663\373^\017\234\265\355~y\222T\226\265-P\025$0\313\265\003O\250q\030\244\214C\0061eF&\220\031M\322\006`\002\221Av\035\021"
+	.string	"\276\033\342,\233\001W\313O$(\201l\036\001\366\333\2702\177\344\021\272\374\300\341g\367kf\305S\312b\033k\ra\213\201M\347ozX2\375\366[(P\316\256\351\036T\272\267\203\302\237\212\227\033rv\224kAu}2\342q\325\272\030\222\2376\353\356\223\005l\203@\366"
+	.ascii	"E\f!\260<\257G.%\315\250\"\224K}\304\242\027\017{+\370GH\363"
+	.ascii	"\214ZUMZ\227\253\265\333\336\364\365i\306m\320O$\332\021aR\204"
+	.ascii	"X\252\217x$\344\022c\tSc\nR\020E\036\363\007"
+	.text
+	.section	.gnu.lto_osdElementFlymode.154.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\253\005\305\032"
+	.string	"fn\250G\220\234M:\200B{\213  \256\246\025\310\240#\021\006\214\372c\r\302\224\265\002\314\272z\030/t\355\236\024\t$\345@\362\243\177\267l\334\353\n&\374\253\025q\335\f\324Bk\216\343\330\233,\032\331F\b\331DJ\231\002\226"
+	.string	"\177"
+	.string	"\236"
+	.string	"L\234\226\013\306\372\324\2525\346U\353o\301\027\214K\377\333\237p\351\270\001\302\245w\372\333\024\210\252<\007ZjLE\221Sk\3055\220uZ\237[\217\215\247F\322f\243\030R\260\331\351+J\350\332Y\317\307[\037\243[\317\351\203m<=\260\270F\202U\361"
+	.ascii	"\213\216T\355`\332L\307\221\252\034<\212\013Vu5\305!\225\"}Q"
+	.ascii	"\fn\226U\220mP\001\231\02686\037\024\370CE\244\267]\3134|O\314"
+	.ascii	"\242\204Z\353\271\347\263\332\003\330\177\007\374/\361\323\004"
+	.ascii	"\001g\2269\\{\322!\363\352\227!Po\327\216`O\306\240\230\316\307"
+	.ascii	"\272e\270\r\324\347\251\253\247m\262NX|\207\234\251\005oo\351"
+	.ascii	"\267E\270t\273\351\314\222\344J\006\337\371\177<\356\255\177"
+	.ascii	"\301\332Z?\363\211\230?\304|!\346\0071\037h\271vo\315'\233O\003"
+	.ascii	"\371\263\346\217 _l~\330|\332|\260\371\335|f\376\032\020Pd\215"
+	.ascii	"\325\316\210S+\325\235:\365\213n)B\376_\376w\311\006bs\223,7"
+	.ascii	"_P\315\253\201m(\227\206e\3026O0\r\256Pi\221DJ\230\350hp\364"
+	.ascii	"\250B\023\203\241\\J\303\3206\317/\246\030\025\"\263!$;"
+	.string	"\224\303\316\2318\343\227\\\271\024\344\002\266yz\271\262\006\b\226($\344?\241\rSc\343F\350\025\241\\\332X\272\315\263\313\335\350\340a\321\336\202\262A\b\312\242\374\270\0051\230(*#\240\215\367\267Vt\007\304j\225\332\236\211Q\352A\371\237@\301\333{QT\363\376+\355\224\0275\261Z+\204\257\024\021;\002bC`\204K\271\315\357pDAC\216\236\303\221\207\034}\321Q\207\f\364\023r\036\220\350+\344,d\240\247\200d\341\210\336\b\351\202\021\025O\202\001S\223\n\235\222.\205.\251\004\323\016\247\342\304\b%\034\211%&\034\003\003\337\255\320-\341\232v\273%\034\371\253\013\326\326\232e\335\371\222\321O>o\222\312\245d\031\331\346I\346F\006\242\\JcCk\363\034S+3\223\246\247\267\302v\366\303\377\007\020\274\275\331\233\257\247\346\331\306\220\312\245#\232\261\315S\fP\330\224-<.B\261c"
+	.string	"\340\004\033\"\374\223F\360\366\002i\250!p\202\b82A\n\212\n\222\244\003\020\003\021\031\352\034\021\240\230T\312\220\026\244\330:\007C\375\240\177\210\307s\221\257\243\2256&\232\363\221D\255\355\230#\261\243\342\314VY\324?*\3248\3079\370\031\033'Lj\367XX\333\266[N\\$ Y \026\347c4\320\256\006\355*@\326@\\9\005\223\324\001d\203X\034\376\003\343J\360E\261\204R\n(\025\254\241\241\216B\026%=7$\0066\264r\310\224\205\235\372G[\026\265\362\035hf\377\013\370C;g\234\221\3047\003\361O\224\371\201\370\001\355kA\306A\026\354\023"
+	.ascii	"\234\020\250'\215\020U\r"
+	.text
+	.section	.gnu.lto_osdElementGForce.155.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`5\001]\016"
+	.string	"\246\\cD"
+	.string	"\257(\035\237\210\373\003`sQ\241\035\030fa\340X\312\005\231\345\3340\315\001yc\022\244\363z\211\377\r\235\300-\3730\242\350c\313w\351\177.\302\204\3269\216\206ys\304\220\002\237\202\261\022\2647\2212\245M"
+	.string	"K"
+	.string	"O"
+	.string	"\233\340\320\013\264CO\366\264\377\341 \274\267T\276\261\273j\201b\327\345a\017\355\320\256\017\210\207\332\003\304C{\266\013\002\022\266\244`\306D*&\306\356n\232\341\336\323\363\017s\316\327Rzj8\330]\347\327\242\272\365\2669l\207\330\017\021\360\212\302Z\321\241\202)olW)\325\305~\266\273k]\331o\375\234\277n-\246#LC\230\316\262\264j:5\375\216"
+	.string	"\0160\325YT\354R\270\261\331\032H\243\341\257\337\376a\334\261]\027\341\375\025\341\253\332O\260\231\201\301\330\r\f\374\023&%\005X/*\3610*\247\365\022\327\024\352Q\036Nw\212\250i\246way\201\2429\345\215U5\275\214\324\f"
+	.string	"\231j\213\272\370O\325\263\242%;\366\013\326VvM\034\327\324\2436\234\036s\022\216\371/\206`\231\374w\350[&>\016\t\201|t|B \037\035\035\0164\352\036\220D\r\203>\244\224\023N\304\231p\"!R\267\235\224\214\2106\320\210\264}\f\270C\341F[J\327\215\266\216k\237\255\2568\030,\324\230\364\344\215\314F<&r\200\265\213\3727\242\241\032 \260A\\\376\263'e\222\303H\311bw\003\027"
+	.ascii	"/\371\337\331\230\261\027\2415 \352\211\302\013\244n\247\306"
+	.ascii	"\206\272]!0\313\241Z\257\320\035\262\260\202/\353\tR\217T \213"
+	.ascii	"kb\032\256\004\314A\273y\352\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_osdElementGpsFlightDistance.156.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\032\001\275\r"
+	.string	"fY\\E"
+	.string	"\261&\035@\216\213\320\037\360\276\"*]U\360\013\0032\203\370\347\321\333KL\001u"
+	.string	"BA\320\260\3326R/\034\203UK\021dH\022\210"
+	.string	"\353\377\177\334\216\346d\335&\261\203\206\030\202q\224\304\275\211\224)\005H"
+	.string	"D"
+	.string	"I"
+	.ascii	"/\020\017-\262u\016tX\316\301\215\f\323\n\036\273\213\351\210"
+	.ascii	"\213\016-M\221\377\324=\235\307\035\002\360^n]/W"
+	.string	"\213A\314\f\027\001^\311\n\311\221\301\361\324\323\203G\312\374\220\260\273\316\316k\271\343mO\260\035\301~)'\235\032\230Q\256\354\217K\025a\337\332\335\265\316\330\231\276\216\372\243\246\255L\337c\300\304\213\226\177\240\261\013b\265\263*\030\243\004\210\355\247\375\023G!:j\345\004vgv`\354~\037\177\256C\177\017\211\207W\273\020|\026\240\013\"'\232\225\330\340\244\243\0065\312U\336\354\310\tay2\252\275i\310w\266\224;\211.F\2456\277\364\251_5ln\224\262\207\365\b\342\365R\247\t\206\364\024W\021\362i\274A%\337\035\372*\361\360z\227\316F\262\021\370\341\214$\224\202\242\235h\0304\n\025B\033\206bRr\202e\240\020F\"\342-\203\006\302R\266\r\204\201|{\031\034\325HIp@~\234\343\306\211\377\356\242D\301i\227\345]v\261<X`k\026\022\230\224\263m\362\026\034\002\330\330\033"
+	.ascii	"/\371\337\331\220i\033\214\fl\200\201\205\372\332^6\364\230\262"
+	.ascii	"M\352\022\234\330q\262+\352X,\261\026\007R\bu\025\032\256\330"
+	.ascii	"E\301l\256Q\213\f\300u\261\253Y\215\036w9f\223-\342\321\030\324"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_osdElementGpsHomeDirection.157.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`<\0035\027"
+	.string	"f\252\224I\260XQ:\300\305\2144\306,\377G<2F\246\230M?\b\344\247\357\256\250\327\376\250M\032c\335\210o\373S6\266n\231R\236\325\254\b\020Is9\023\370\034\270\206\"\332\235\377h"
+	.string	"\314h9\030\215\266O\310\336D\356\224\002{"
+	.string	"u"
+	.string	"\203"
+	.ascii	"\265\"\370\264\202\361\323&<\313\366\245\375\031\247Q\273\317"
+	.ascii	"\303\003\324\232\244\305G\255\277\033\337\214\237\376]\206~\216"
+	.ascii	"o\321O\327l(\003\214\252-\301\323\023]\020K\255\365\265.^\273"
+	.ascii	"Hg\270\262\346\277\351\252\035\317v\221\232\370\\\361L<\214\341"
+	.ascii	"\031\2056\265V\026/'7<\220\302H\211\030\336Q(\023\265\342\311"
+	.ascii	"\233.A\360pR\212\rj\255\226;\036\322=\3366\221\355\034{w\001"
+	.ascii	"\373\032\372u\255\245\356\004\3567\216#\310_\262\006\231\374"
+	.ascii	"\356\323\227\355K\364\2560\235\270\311)\373g\223\313\302~X7\311"
+	.ascii	"^i\327\201w\353\276\037\200(\r#J\277\210\322\254Qz%J\253Vz\244"
+	.ascii	"\322\342\224\246SzR\351pJo(-W\3723\256$!\220.\"J\255#\246\266"
+	.ascii	"T\250\371\003\306\201\267\377\363\235j\334F\355\300\016\257H"
+	.ascii	"\365\037f<a\221R\003\033\326XA\005*"
+	.string	"\2676\213\033nk%\227\243\03089e\272\342\3524t.]\232\340\221\f\234'<\310\316\203=\233\302\201T`\300\244\326\232\363\364\037\026\374\245O_\320\321\241\237s\037T\362\355\206{]\227\033\217\367\330\341\351\351\241\237\273w\372\364\365\2660Y\210\321\210\030\341\2620\214\312\245\001\235\344d\026\373:\276\003\026\373\371\241\237rO\242wE\352/v)\2406\307]\373\246\217H\200Mr2\213\003@\027\r\303)\3420\024\223\305\204b<>E\263\327PP\217\354\005\243\025\275p\nxF\024\243\2758\314f\264\027\353W\037\326M\262\252\005\n\250\333\342\354%>3\231\317(\201\331\005JA)\237x\223a6S\023\365\262\022\224\234\230\344\223\225(\025t~F\375\"@\006zU\216\260\302!=.R\276\271Z\277\210\320\254\246\347o\260\262\2332\356j\303\240\256\313\315\301\211l\030?\004\303\203q\311\003\375T\255"
+	.ascii	"%\037\001\331Z\033B\004\371\335\030A\250A<\304\214RF\261\221"
+	.ascii	"\221\tR\322\246\003\200\202\231\261\344\006\021\260E\243\261"
+	.ascii	"\245u\0077\321G\024\366\341FRKk5s\367\375`jEG\254\347~\r\236"
+	.ascii	"\230\327\342B\267:G\025\205\370\314I\371a)\324\2449\350\032\362"
+	.ascii	"\235\264~\255\025\223\262\204\\:q\003\242\0053\213\233m\264\375"
+	.ascii	"^\223\211o\336\230\ru\004\367\034(k\374\002\200\353\001\366\230"
+	.ascii	"\232\324u\264l\213oN\242\212\030\337\246O\354k\315\371\0178\317"
+	.ascii	"\356\244/\020W\367\244\027\0325"
+	.text
+	.section	.gnu.lto_osdElementGpsHomeDistance.158.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\210\001u\016"
+	.string	"&\332^D"
+	.string	"\257(\035\200\3520\222\305\200n\320\323p\220]\276\246\242]\260\252\217dN\0132\nR\3009oN\254\366\225\002\302\374\362\316\332\355\230\007VU"
+	.string	"\250B\004Tw\204\364\237\201\260WWo~d\354\275\245L)I"
+	.string	"E"
+	.string	"L"
+	.string	"\207\331\007\304C\223l\027\007P\266\364ac\001\025\342\265\273\232v8\351\360i\222\374\267\256\221\352J\207"
+	.string	":\225\277L\345\372\022\240\2742\b\350N\036\007\206R\361\326\223Bw\312\314X\260\273\316T\227r\307\333\366\330\376\260\377\n/*S\306lW)u\203\375\267\273k]\2613\3159\353\3174\0355\r5\3752\375"
+	.string	"\004ZTH\271*\266{!\026co\340\t\227\r\333O\373\036\376\201t\226\3119vW`4\273\256\216;\331\241]/\020\003\331\356*\360E\200\036d-&\321\263*\001\203e\312\230\252\\`P<\215\314\324\346\"\344S~Z\362\n\032\226\006\2159G\337z\226\"\206\305I\302\254\357\210W\216:Q\252\323a\016B\344\267X\002I>u\350\223\304\303\3531\254d\002#\320\366\331F\266\f\203x\210F\240\355\263\215l\f\034\2108\r$\322\340\243\201\204D\232\007\002s\020\266\2206\342\270\220\266\341\332s\250\2711\351\t\332\204\262&\252ge\342\24533\272\fT\317j\206\343!\321'1!\304"
+	.string	"\213_\022\017;X^\230,\362\021%\001# \300\002\2211\343\001\3371dh\034y\333"
+	.ascii	"\357\206Z\312\276\373\023\\\204`\020A\226\2734\3642\"b`\322\311"
+	.ascii	"\343M\016\341i\373\022\273\365\fk0\276V\b\244vp\205-\032\265"
+	.ascii	"\\\323\222\275\263fX\315p\364\364\345X\223m\361h\f~\017"
+	.text
+	.section	.gnu.lto_osdElementGpsLatitude.159.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\205\n"
+	.string	"\366\223IB0\251(\035\310xA\375N\322\313++T\340\244;#\335\260&\003\013\367\351\030\023\312\027j\330z4\202=p\325\345\207\222\362z\3746\2204\0240\ft9\344\223N\246\332\331\335\350\3366n\273eJ\0014"
+	.string	"4"
+	.string	"9"
+	.string	"\235\314\245\303Gd\227\231?d\227\366l\230\004\311~\237\007"
+	.string	"L\024X\330]-\262\334\273z\376\013\\\003\246\276+\006cw\255`Ju\307\333\346\330\376\330\347\0041;\3744\252\330\277\354\356:\256\354\273\376KT\253\252\237ATh\251\2362a\027%va_\322A\200\215\355\253\375\001'\340\335u\272\303\356\n\326`7\3548z\320\024%\361\263\315q\006\"_\020\022\252`\265N\331\245F\215;\236`S\n6w\004\037\027\254\335\2650\360\003\235\337\2724\210I\017^\372\246\354\362\221\241%\202"
+	.string	"\027J\003\245\321\334\246hb\f\362t\245\321\334\246hflt\2346\nil\032\210\324i\236\ts\036\223\244\2258\216\244m\302\375e\343\312\232\025\t/T\034q\203>z'7\204L\243\r\232\001\017"
+	.ascii	"\357b\310\304\023p4\340\202^\232\020mL,\265&\bc^\"\325fx\007"
+	.ascii	"S.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_osdElementGpsLongitude.160.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\205\n"
+	.string	"\366\223IB \251*\035\310\260\304p$\321\024\340\370\202\021P\376\327\342\221\204@\245\205{\311\016\332\220\216\262\303@\004[\023\306\300\016\222\362"
+	.string	"\323^\250\006"
+	.string	"f\021\024tg\022\030'\314\337\331 \254\250q\243-S\n4"
+	.string	"4"
+	.string	"9"
+	.string	"\233\313\245\303Kd\227\227Cd\227\366l\330D\311~\235\b\254\023\006\027vW\213\003\356]=\377\007\216\001O\337\325\222\261\273V\360\204\272\343mklw\354k\0021;\3744\006\260_\331\335uL\331o\375\225\250VU?\213\2009@\035\200k\027%\226a_\022\002+c\373j\277\300\rxo\225\376\260\233\252\360`7\3348z\320\025&\361\263\335q\327\310\033\210|,T\253Rv\251\021c\217/\330\224\202\315]\001\b\206jw/\020<A\347\257.\035B\322\203\227>)\273|l 0\001C\313\244\001\243\320\334&hZ\354\341t\243\320\334&hjpt\234\026\372ll\232G\324i\034\ns\037S\244\2158N\244e\302}ec\312\030\001\026^\246Hb\007}\364Rn\t\231F\3333\003\017"
+	.ascii	"\357b\310\304\023p4\340\202^\232\020mL,\265&\bc^\"\325fx\007"
+	.ascii	"S.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_osdElementGpsSats.161.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`U\001\215\016"
+	.string	"\206[aD"
+	.string	"\223\223\016\273\207\352MZ\254T\177\364\377\317h\352\332\330\357[\210\f\244\353\205\250\330\227[\224YK\352\304\020\2419\311\002\250\2208\002\240\221\032\252\352&\224 \206\232\023\006D.\267\003!\276\021K\366\2262\245K"
+	.string	"I"
+	.string	"P"
+	.string	"%.\301\036\335:\201\353\021\273\200\353\321%;\007\t\207\355\024\314X\305\244\340\261\273\231\316\274\364\b5K~\007\305\343}\335c\310's\210\311\\\001|(h`wo\342\331\341;evPv\327\351}\251\373\272\355\006\266\031\330_\005\321$\227\274\367\350\273\\\217W\t55H\260L\031\304n\235RE\330\207\273\273V\225}\326\217\301t\3244\314\264f\372!\003v\340H=\204\216]\017A~,N\2241B\304\366\323\376\352%Jg\275<\300\256*'\306n+\366\204\273\3300r\243\205\210\302\207\306\346\345z\214\352Q\205\372\0271@\\\341,R\260\335=\361U|\205\212\266m\327\243\352\225\252\261\321\243\203#\211\251\315r!\357\031j\227j\356\272Z\270\311A\245\017\333\241\337p\330.\352\304?q\024\032|\233\007^I"
+	.string	"\322@\032\b\353X3!\265\210\266\320\206aKY!q\231\210E%\224i#Rf\3621\227a\033e-\0347\312DZ\246\303U\225=3\037pLz\212$\t\265\300\347\246q\275u\030\016\016\320\354\302\334{\200\301,@\360\030\325\206\020!\357\031.\b\355\034\036"
+	.ascii	"/\371\337\331\220\261\227bk\270\215\023\273\342dZ\003\312\202"
+	.ascii	"VQ\017\227\261\255l\177m\334\307\210\005\003\303\221\376\006"
+	.ascii	"\033@aB]\005-\260\007\305\262\016\230\265\017\340\272\330\325"
+	.ascii	"\254F\007w\t\030\330\324}CM\336\256R\006"
+	.text
+	.section	.gnu.lto_osdElementGpsSpeed.162.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\313\001}\020"
+	.string	"\326\337mF\340\264&\035\310\313|\366\024\340\021\343\177\354\255H\366\214j \312\350`\211\2528\314\262\275\210>\312\246\215s\030\204\361Z\212\325\320\275\3429\270O)\016>\2219\325\310\217d\002c\304\n.@\333&m\357-eJ\001X"
+	.string	"S"
+	.string	"]"
+	.string	"~\213\273h]&\363"
+	.ascii	"\2739?\202vg(\243\264C\317N \036j\027\020\017\335\262\201\034"
+	.ascii	"\030\261.\007B7j~\212\354\356\246:o\035>\315\226?J!u1\327!\316"
+	.ascii	"_)\206s%\211\301\236\311\356\376\305\323&\366\312\034\245\354"
+	.ascii	"\256\263\213\335\334\361\266/\330\206`'\203\207\252\337\301#"
+	.ascii	"\273\246\242j\210f\262\310\244\264W\"\362\335u\001\220\016\212"
+	.ascii	"\241\227\272\354\331+5\205\375\267\273k\315\261/\373\001h\332"
+	.ascii	"\244\351\222\246\265\230\036i:\3024\204\351\367\322\252\351\314"
+	.ascii	"\364I\006\f!q\363\023DvK\024\035\331!\230C\205\311\366\323\001"
+	.ascii	"\017b%\017\034\036, \330\351\221\211\207#%\311\f\244\2466\206"
+	.ascii	"\f\371.\252\tL]\017B-i\270\215\032P\363\207'\337S\223\275\341"
+	.ascii	"@\034\264\335E\361e|F\007\225T*^H\217\347\356\272\324\\T-\340"
+	.ascii	"\343\003\226Fl\253\036\203\323va(>\214\373|\360{\016\315\322"
+	.ascii	"\002\375\226\030V\235V\032\234T'md\325\t+\346\205s\341@p*+\254"
+	.ascii	"\325\366\302\222r\331T0\254\355\244\304\253\020\034\314\026\263"
+	.ascii	"Z\301l\246\331\314\337j\216\363\2254i\260 R\223jjc\333$\235\025"
+	.ascii	"C3\372rI\246Fu\220[G\374\354B\021\022\354\354\322\274\223\240"
+	.ascii	"\321<P`O\240\220\357\374\326\204+\004$ \240\202\231\300\3166"
+	.ascii	"\247\374\177\033A{j\306\366<\2332\262\033\203F\001$X\207\210"
+	.ascii	"\342\006\213\247\304;\330\263\355\026Ea\354*\226\333\210\360"
+	.ascii	"-1~<q\311l\036\354f\345\326.o\260'\261/\354?7\346\006\333\274"
+	.ascii	"S\202\2270\340C\271q\367\266\226\352\001"
+	.text
+	.section	.gnu.lto_osdElementHorizonSidebars.163.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\304\003M\027"
+	.string	"\366\352\220F\320\026Q:\224\241\254\225b\026\265\260MtV\b:\351Vo\003\234\264\355\216\243\300\245\270"
+	.string	"X\375f\373\367&7\344\260\272\020\032:\340\213\007\\\205\001\270\276\336\230b\304\317c\206\352\243\252\305\177\321'\204\220$S\n}"
+	.string	"m"
+	.string	"~"
+	.string	"\321\036\202\200,y\022c4\340\257\tD\376\006x&\265u\266\216a\0312\347n|\212\3616\344#F\035\253,\221\277\352\234\002\375\211\214\002\375U\326:Yu\2103\004@\210\344\324\b\2121\266\216\242\241=\235\353\245\314\237\367\224\325<&\200\2232\363\347\211b\214&\235\016\336\202\004\241SK\217\305\b\337>.\200\373\251)\311\2413\302\0312\21016?\350\354\270\240\333fh\253\240\365J\0017\233\214\034-w\277.\306\331\177\242\325\315\3627\335om\214sv"
+	.string	"\367\270\253gU\231\205\311l\352\331\227\314\242\236u\311\354)\263-\317\262d\326\364\354JfK\231%=;\312\254JfE\317\206\231\0053\373=\353e\366\231\315\314\232\200Q\374\210\b\261c\022Jb\024\261\213\022\217|?V\270\307\255u\265\317\f\323\220\271\247A\034w\002\366b\214\321\353\001\257\036sU\022\333\r\034[\315:<\372J\351+\241c \351%\037$\225\217\256r"
+	.string	"@8\266\032\017\321\301\0278 \030\271Q\242\334 \240\367\360\001\336\322\274\322\037: \347\263\202\017-\344\030\370\035|X\003\307V\303`\034\337e\230\344~\357\336\221\367\177\343\330j\271;"
+	.string	"\240\234)\264\334\265\205\371FL\024cTP\333p\240A\244\302_}\003\372\363\355c\317E\213\036\001\033\034V\202\f\314\306\202\213\306U\301\005a\002\354\325\2620\023\201\246%\241\006\326\222\021\320\327\005WM\313\346\365\252i\221t\321\277\365\001O\t\241'\264\327Z\317\200-\005#\2311\245\260\301E\t\372\241\345\356\345*\230\253@\307\300\324a\214\244P\1779+g\n\255\b\n\212P\216\3062\313]Nw9k\3101\260\345\247\207R\206\264\374"
+	.ascii	"\023\323Y\316\022b\272y\334\340\005\016\n\214\357'J\032z\314"
+	.ascii	"\337$o@x\253\247\211\236&\034r(E\250Q4\303\030SH\005\024\314"
+	.ascii	"L\220\0248\215\001\240\002\231\251\261\033\021\200\245Sl,Mb:"
+	.ascii	"7\315\377s\336:\r\244W\213|\224]\356`\020\326BV\257c\201\321"
+	.ascii	"\023\344\006\0345\3045\rX\260\334F\260\373\215\246ODUM\024S\213"
+	.ascii	"\024\271\267\236\035\337d\2128cJmX\313\226hD\214A\277\003\302"
+	.ascii	"L\3306\007U=IS\365\352(\301H\201\3453'\276\276\275\230\002e\363"
+	.ascii	"B\266\t+`9\321(\326\021\277F\371.\377\362J\330mz5W\365ly+B;\374"
+	.ascii	"Wh=\213pK^\336\372\003"
+	.text
+	.section	.gnu.lto_osdElementLinkQuality.164.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\037\002E\023"
+	.string	"\026\345\201I\300\322Q:*\026\274\323<\254"
+	.string	"\020\235PI\260\240\263\256\227S$DW\026G\031\202\r &\361\246!U\321[\211\002^j\313\303WO\n\377\277\3116\263\303d\212\002\325\374q\360\201JmI\313\372B\215\020\262\211\334)\005l"
+	.string	"b"
+	.string	"p"
+	.string	"\027\252y\200]\037&\243\335\334\211O\304O\347>\002~\212\027"
+	.string	"~zf3\021\300Y\332\002$\0379DN\273\273\322\021\237=\004\347\247r\346\207)\250\361F{\030\246\354.\310\215\347 \207O\325\315\366\225\354.\216\374D\236\353\207\240\207\306\006\325\355\346\033Y\n\201\343\273K\235[M\3120ew-\307\333\316-\336\266\314\366\003[\252\004\037?}\031\360\363\212\001hHE\007\033\331\263s4\2518\373\337\356\256\325\307\276\320\257J]w\213\240t8\245\301)=\247\3647\245\365\223\226*}\221\021\0211v\376a\307\256\206^\217U\232G&\256\373\355\177\347\020;w\027\263\353h\276\343~\235\220zM\273\271\004\237f ~\212\310K\373,\336b\026+$?A5\340g\250(!QA\005q$`\200\212\373yj2\232\352c\324T\325\315H\261\25315\245J\024\366>\235\n&\331V\200\334I\240\352\2473\207\355DM\366,U\3659?"
+	.string	"H\233\325\222\037\245*\017\310\203RM\362t,\201\370RR\245\266\353E~\364\247\264\227\030{\224\364/\360\332\262\273q#\237\354\023\375\305\313\0172LF\006vQ`\3022\0013\310\\0,\027\"\274\304\270 \270\304`\252\320,\224\230,\246\365j\301\264V\\b\260U\214\213\345\265b\315\304V($\206Yh\315\254d0\330\314*$\267\377\026\b\205\222\215\326B\305\231d\3441M\324i\300\002#\257\350K\251\250:\366"
+	.string	"\t\252y|\350G*\006~vm\037%\2106\007\007\354\t\024Jr\224f\273\302e\304R6v\267\201_\324\022' `\202Ad\326\003\217\374/\033R\373;k[O\312cZ\327\247-\251\021\254hC=\023\3520\036\032\373\264"
+	.string	""
+	.string	"\016I\310\021\033\223[t\324\302\350\264\213\b\031\270\355"
+	.ascii	"\234\260\260\325\013\f\304\212\244\205\335\231\273x\354\364\203"
+	.ascii	"\335rM\344\345+c\202x\017Px\271u\343\207\2431\234="
+	.text
+	.section	.gnu.lto_osdElementLogStatus.165.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`9\0015\016"
+	.string	"\346Z`E\020\257&\035\240\030\"9X\021\n\260\356\006\213\214W\222\252}\0060\264\332\341;"
+	.string	"\003\244\202\305\375\265\221t\236\336i\257\241\332\030$\0236+\002"
+	.string	"\210H\215\245 jAM\026\350\035\322\360\326J,![\312\224\002M"
+	.string	"F"
+	.string	"P"
+	.string	"f\021\340d\275\004+\016\032``\354\256\246\035>:vE\315\221\377\227g|\240w,S\371\245\001\252<r\300\223\350\261\273\035\260\224\032\017\320\314\274\350\200\246\350Ai\371\376\362\334"
+	.string	"\22227\016v\327\371\201)\367\346\2667\333\f\354\203\0013\254\222zv\350\245\256\330\217\273\273\326\223}\325\237i:f:3}\216\247\205%\345\036Z\273(\255\030\313\272L|\340\330~\332\027q\227\321U%\347\330=\255\220\331\r?\374\221\375rx\017\366+{\007\366\313#\007\377\354a\362\204\227\300\320I\261\273\013|\030\320\b\001\024\313/\277\004\373\025\265Aj\025Be\222-\243p\001\201\212\2722\342\251!\215\264?]\376K}\213\324\t\026\351\250\032\032\031u\006\354\032\201\204\212R\326x\223\035\027a\266\205\013\371\357\372\230T\036\260\025\210\033o \"\022\020\367\341(p!\022D\235\006\032\021\371h[H\244\201\bpW\201\013i$]\027\3228\341>\256\236\234\221r\3012Q\022\006 3\265\037@\310\177\216\352]\034\271q\257\260\207\217\tA\200\3325\375\023\311L\n\f\330\033\227\001\032"
+	.string	"/\371\337\331\220\261\007x\326p\033\331f\005\241\255\232\001\005\027#Cjt\025\213\220c\205\245\352F0\336\252\006"
+	.ascii	"\t\263\232\260\031\354\0330\340\022B\263\232\002\334\221\235"
+	.ascii	"M~\205\271\252\246{B\201\002"
+	.text
+	.section	.gnu.lto_osdElementMahDrawn.166.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"\375\t"
+	.string	"v\223F<0\305*\035\200\267\017\323#W\002\235\212\201JKa\006\215\345\341\307\f\032?\0305!D\260\0261\303\203,\026\206\031\236\206\202Bj\026\323\023\025\335\016\332\361A\322\367\021!A[\246\0242"
+	.string	"3"
+	.string	"7"
+	.string	"\347\\~\323\235\303\274\240;g\321n1\340\330\361S\233\261L\002\354\3567?.^E\377#\317\220\255\361\352E\354\256\225l\271\356y\333\n\266!\354\013\004\243N\017\373\227\335]\317\227}\332\317M\265\252\372\336F\306\342:\b\200\335\216\233\200\265q)2\215\355\253\375\331E\304\323P'\330}\255\240\354\226\035w0\001\013\260\335\325I\021f\345\300`W\214\364\244\023X\016_\262\241*\273\373\340\223\2340\016`!\347|TwNg\206\226\322\233;\26534\364\344gCl\200M5G\273\f\006qB\037N\347\031\3441\235H\340\b\264"
+	.string	"%B\246\360#\211&F\037\250d\372<\b\016/\300\322w\n\303\322\247)\367\227\235/gb7[j\252<\240\336]\353>_\376\204\"\r"
+	.ascii	"/\371\337\331\220\261Gak\303\031\221\312:\257\026\3363\226\034"
+	.ascii	"\214\272\204\325\254F\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_osdElementMainBatteryUsage.167.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`-\005-!"
+	.string	"\206~\326E\220\234M:I\204\346\220\305gC\375\223pW\310K\031!\023\326\236\301jg\223W\224c\343\304nx\340gB\261U\013\246\226a]"
+	.string	"^\005`\372*\211E\013\344\2055\270\215j\311\"\203\335\032!\204\020)S\n\300"
+	.string	"\253"
+	.string	"\301"
+	.string	"\256\331X\276\225;\027\215\317\252\251l\256\202_\302\346\234\030\312\213\267\020\202\204\334\2015>w\223FV\320L\330\234@\006\027-\301\276\332\257r+\271k\331x\2009\257\370\200\231\023\350\300\016\312\213\006\3366^,O4^t\316\2563\340\306\204\212\020\3342\325\225g\316\251\264E\\{\b\274G\315}V\222\243\030\256\346|\322B\350K\202\207\327\203\372,\211H\025\220\227mx"
+	.string	"\to]Oj\302\303J\311P\3745a\022\324\233\n+\004\277\276\334\353J\325\323\351Hc\362\343\242\217\207A=\251\3606\347\254\365n\350\336\353\242\017\t\036^\357\307\225\2640\347\264\362zU7\355\266\241\330\326`\213\005\002\273_Sd6q/(\3129\245&\370\\\336\005\347g]\264\212%=\357\242\2774^\324%\205\374\340\350\321\212\3222\033\250\323\365\331_ \246\007\016\357\225\235\340Z\377\201\003\357\244s\335\267Pm\200\246F\272\226\373\210T\017 \325F\245Z@\250\266\221\352\242\231\232\210T\017\221\352"
+	.string	"\245\032"
+	.string	"\251\026\"\325A\241\032hT\377\214\352Z\250\246\211\352\231\250.C5\031\252\307P-\206\3520T\257\250\326P}\0056*^\252\236\0056\347\216\262>s\215\030F\311\265\374\300\237\353k\337~\026\337K\213\203\307\221'\230&Cy\361\277\362\256B\033`\277sr\264"
+	.ascii	"V\307\246\310\316"
+	.string	"\bm\221\221P\\\237^\016\231'U\302\275\362\321~\357u\004D\310\224m\251\221\322=~\331\035\034\201\366k\235\262\322m0k\216\236]\037\357L\243\017v\202\311\206\345\303\030/\032a\211ux\020\306\004\177Ln\212\207r\316\371,\033\343\305\240\245\360\253\243G\013h\223l\372\2636\210\020\343y@{\223Z(\327\366\266?\373\235\031\332\326V\321\354\302fK\333O\221\325\216`,w\266Hc\273):0_\312\035\255~t\244h\211{\333w}\350k\027\306\340\341\212;\336\t\327\272\023\033w\227\334\375\332-\321i\231\207\324&QB\317\033w\f2D\267P\326\335K\307\311`ab\206\370\364\204sR\321\344\304!\005\356\351\303\212\013-\204H\243x\360\024\303\005\256\005\216\005\256D\212\247&%\027K&Z(\241pzRzP\300M/pNJ1\232\232\234\224j\300\250\357\325\0214k\242Vg\327\331"
+	.string	"\204%\0265g\300R\370\335\231\351\340\360"
+	.ascii	"KL\300\026\255\321\352\330\316\211n\0054\270\201\265\021}\275"
+	.ascii	"\314\201\326@\234\242\345\360\033\263\031\331\302U\256\317\263"
+	.ascii	"\327\030\211\366\304\026\232\032c\322\022\255\220/\tXn\207\033"
+	.ascii	"\021?\004\342\210\261\031\332(?1r}&\367\210\tv\345(\325\317\321"
+	.ascii	"\212v\310\360\331\222#\245{\3029\347\034\327g\rs9\3164\022\340"
+	.ascii	"\235!\333\034\325\231F\244\245\262\033\374h\023\254\320\033$"
+	.ascii	"xvB\220\326\007\033\301d\204E\300\210\025\200\rY\2501$\346\214"
+	.ascii	"3\304)R2\201D3\323f\fP\0021\310\352\350\001\021\240\255T7LZw"
+	.ascii	"W\341s\2148\334\216oB\357\031\370H\314lP\005\037T\235wk\230\352"
+	.ascii	"2\"\016|\"H\364\207\320\346\251\036\335\360\247\006Ua<C4\316"
+	.ascii	"\023\255\222\376\213m\245\0177\254\033S@V\314d\025\360\3278\307"
+	.ascii	"\376mr*\204h\025+;_\007\270\023\376F&\020vw\033\336\354\247V"
+	.ascii	"[\\\353\317l\375\372x\200@Q\\\316\205\257[\274k\267\f_\020\004"
+	.ascii	"\354\0045wv\301\004\205\270\224L\231Z5G\017\270qB\016lV\300\345"
+	.ascii	" ;?H\321\0319\321\350\273\300w\304&\311\026\365\365T\332\007"
+	.ascii	"\332R\215l\231M\320T\2074"
+	.text
+	.section	.gnu.lto_osdElementMainBatteryVoltage.168.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\261\0025\024"
+	.string	"\226g\207H\320\360(\035\336\360\024\375\370\342\351_:%\352\272\200>A\251\003\361\343\r\366\273\300^nh\333\003\021h\333_\2656\253?\315>W#\004\220Vh/\271q"
+	.string	"OW\220!\2242\323\314\250FI]\321\377\244\221\275\245L)q"
+	.string	"e"
+	.string	"v"
+	.string	"'l\357\301\360I3\257A\007\221\322\2159'\201K'\b/C\342\325~\211\233\260\235'\346"
+	.ascii	"\346\264Y\022\232\3237\342\221\360\322\276\267\300\313\360,\360"
+	.ascii	"\3226\333\206\200\f\363\206\200(i\346'i\316\371Z\020\267]\306"
+	.ascii	"U\233o*9\355x\267\313\232G\024\257\346\253\342\311\304\2209\347"
+	.ascii	"}\256\033x9US\311\234\323\272\343\321\334\340m7\260mb\353R:\017"
+	.ascii	"9\375\371\253\373\231\0358\375\371\244\266\354E\277\373F\240"
+	.ascii	"\234\243\242\334\336l\337M\267g?\3169\247\327\306>\317\337z\317"
+	.ascii	"\315\222\352\225T\253\242\372#\252=\244:%\325\250\250>Eu\b\252"
+	.ascii	"MR\rF\265\\u\214\352\215j]\365\007\264\214X\320\\\247\305\234"
+	.ascii	"\034~:f\221\034\322y\317o\377>N\331\276\007\251}\220nDN\177B"
+	.ascii	"\250\005\301\341\301\235\366\272\235\024gm\270`O\007I7\224\323"
+	.ascii	"\237\3169o\273=\223\321E\300\357\342b \371\314\220Q%\233\326"
+	.ascii	"\017\232\321Z7>\fx\251G;\034+\225k\303b\372\235i_>\310X\345+"
+	.ascii	"`\3029\247\002\037\350\301J\030\342\322\217\001/\301U\341\360"
+	.ascii	"\304\225\273?\025\342J\03299P\273\254\375\222nG\336D\240\356"
+	.ascii	".X#\206\271\f\234\fs\245\270HR\\aL\005\245\306\"3\2710\213\325"
+	.ascii	"j(\024T&\303Hh5\227XK\214%v\222B\223\275\\VPZ^\260\031\355E\002"
+	.ascii	"b\231\205\330\354U\223\311f\257\224o>\316\265\361IDM\021ns\362"
+	.ascii	"/\356\261\0372\034@\bu\fD.W\252]\301P}x,\330#\241\"\006P0Dq\027"
+	.ascii	"\021\n\334\314\251\373NB\250[ r\231Z{\302\211~\3478;\354\315"
+	.ascii	"\007\216\332- \300\202\231)\352\001Q\304x\311\377dCb\217q\255"
+	.ascii	"Q\033\341\267\005\343,,&\343\346\3418\t\343\020\216b_\307{Lv"
+	.ascii	"\357\271\253\\\020\224N%@\232\323W\271n\321(\t\326\275\256\327"
+	.ascii	"\226\205m9\025SP[\357\205\025Q\337X>\004\013^\017Oj\303\254|"
+	.ascii	"!\362\212J\350\022\r\370Xn\360\275\255\025z"
+	.text
+	.section	.gnu.lto_osdElementMotorDiagnostics.169.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\364\003\315\033"
+	.string	"\2065\267H\260TN:\330C\303_\037^\372\322\004G\030\002r0_\327\264;\307$\022{\207\267\020\203\337;>X\377>\2577\243\342j8\337\260\341\225\203\306\2372\324?\002\034\031\211\326~\260\310\031\365\363H\307F\310&D\312\224\002\243"
+	.string	"\226"
+	.string	"\236"
+	.string	"\241\016\310\300A\356\276\024::\337d\022\231T\221\361 \233\323\307\363\320\016\354\253}\036\357\221\373\225\212\317\314I\003\213\327\234>\005V0>\264\3577\362\341\370\032\371\3209;\212"
+	.ascii	"\244\251k\020\326BI\213l\316i\333\032\036\377;\350\273E\315}"
+	.ascii	"\024e\b\256\346\374\003;\266x=\335GPDb\242\372\022\027O`O\331"
+	.ascii	"\330\327\265\256,z;\025s8]6=t\3515\035\004\021\214\021\261\022"
+	.ascii	"\323C\002o\230\250x\264\336\221\356\265\036BYm\361zNW1\302\234"
+	.ascii	"\323\312\353\275\270g\267\355d\233\202\r\302\004N!sv\177 i\202"
+	.ascii	"\365\344H\313v+\f\251\267~Q;\210\204\236\227\263{\205J\206\330"
+	.ascii	"nu\266O\247\013e\277'\252l\314K\303\336\371\325O\340\276;\007"
+	.ascii	"\347YwM\252oD\265\215T\327\200j\232\231zF\252"
+	.string	"\001\210j\031\251\216\031\3250R\375\"\252iR\355\022\252g\241z\004\325\"\250\226\253\016A5\270\352\005\325\272\352\0338\225\027\323\322\213WI\231\223\351\227e\212\205_7\356\373\263\356\343Z\246\331?\216\225{\226\301t\216|\263'\241\252\306\346\204\361\001!\314\372FD\334\006D\3718\371p\253\360\246\314\026\206\266.\373\262O\322Q[\332.\230\322\026\f/\202{\340\203I\3200N\251\220\017]\266f\343j\334\257\370\t9\333'\341\330\351\317\342\216\013BQ\332b\243\343\r&y\256\013\256\\\233C\007=O\\p>\255\316\341\312\005\265\\\270\227\273\3069g\217\317\365.\017\376\324C\203\360\361\221\017\303\205\340\344k\027\024\362\263;{\372\352>)\311\201<\210\273\374)\003\231K\317{\350\233K>\374>\206\324\020\253'#\375\275\351\206\025\030\340B\005A\0371\02444t\342\002\216\350Vt\023\202\021\375\263"
+	.ascii	"W4\004$\004T\002\bD\b\334\3156\024\344#d\373!\302\331\026\020"
+	.ascii	"\360\315\004\020\221\255\350v#\262\321|\363\240X[\234\031\025"
+	.ascii	"\0211\243"
+	.string	"\335\331\031n7\001l\266fop\326fUI\315\366Hu]\2712\322\337\270P\326\250\260'\245.\271\263!\302\226\224\272\224\347\265ea\333\265\245Y\024XIf\226f\257\264\005G\355\n\026\364\274\231\2650c\267\272\203s\316)&xmw\226F\313j+)\306N\177r\241V\374&}#\037\nDQ\221\331\230\005 s$f7HqY]\031\351Os\324X\322\022D\2501 \343\020C\b9$\201\0043\301\210\251\306\240\002\031\262\243\003\021\240EDC\224\354\0067\350\357(\333ij!\004^\034KqM\364I\002%5\273\222|\201T-\016v\026l\252\362R\016\025`\234p\367\341G{\361=gK0\250/\351\313\327\030\013s\345O\347d\360\t~\216m\374\030\227\013\360\254PN\t\020L%\272(S!\201\330g\"\306\207R\3646]d>\303\352\031\200\003A)\025\206\003\250\005\2614q*"
+	.ascii	"\233\347F\366\273c\322\034<-\276\n\023\263\322"
+	.text
+	.section	.gnu.lto_osdElementNumericalHeading.170.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`'\001\035\016"
+	.string	"\346\033bE"
+	.string	"\221(\035\373\0052r\326,&u\241\350(\314\017\323\177<\002WM9;\377?\221"
+	.string	"\020z\037\342G\r a\241b\366\253\006\231\210\377\254\375\337-k\303\334\263\305\303Js\236d\257)P#\204l\"eJ\001K"
+	.string	"J"
+	.string	"O"
+	.ascii	"\321\016\270\307\221\354i?\305U\200o\241\034\300\256jG\314\256"
+	.ascii	"\253\343\016\367h\327E\264G\356\001\264G\2036\216\001 \326\324"
+	.ascii	"@\246\004\n\246cw;%q\360\t\372\177\371&\\1=\267\b"
+	.string	"\273\353\fWR\267\336\366\001\333\022\354\267\004o11\003E+%kl\227)u\204\375lw\327\252\262\337\372\271\277\356MK\307\230\316\262\264j:5\375\017\221\0330\251\273\330\330\025QC\263\261(\343\304_\277\375\277\030\304v}\005\370\227\207oj\037\202F\206\225cw\025<\207Q\312\231\303\2140\024X\261P\264\307\250\233\226j\246\235\220\334\324\366|\362\241j\214\301B#\366AMN\335\364<P=>N@\273\246j\260\223\213\212\275\277(\351\254\354\320]l\340\314\354\356\003\330[\210|\326\243?\223|\370\350\233h\217\327\0061X\300\371p\266\222Q\b\344\3614l\233?$\245\223\221'\3628x\031@\245\257\033\205<\242\356C*u$\006\374u\360H\335\311\367\221:\020\327>[UmXj\304RT\305\002r\323L\317\3421\023\020\254vO\017)p'\b\t\354\n\026\362\241GPj\262}!\026"
+	.ascii	"/\371\337\331\230\261\027\241\265kh\347R\327EC\240\332\206@C"
+	.ascii	"p\227\240-:\216\024\361\205\020\346%\222m\206?\\c\322p0`\031"
+	.ascii	"4\221\247^\001'yqM2"
+	.text
+	.section	.gnu.lto_osdElementNumericalVario.171.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\222\002u\024"
+	.string	"\326f\207H\320\016)\035Z\362\0019\271\260\027;J\321\244N\323\242\021\231?\223\203\030\304\317&\250Z\201\264\263?\376\321~\275\341\304\345\224\366G*\312\266\361\001\256\330*t]\313\332\350\026\007\n\223\215\372PE\217\032!{o)\223\fr"
+	.string	"m"
+	.string	"p"
+	.ascii	"\017\021;\320\314\003t\353\236\214\272C\020\005\001/5<\307\274"
+	.ascii	"\004?`^jL\225\251@M\313\026 \371\324\210\234\272{\305\035\036"
+	.ascii	";\370M\031yc\372o\004e\303\311\016~#\034nr\377>\313}F\004MG/"
+	.ascii	"T\270Z\344\270\355\330,\254\324\360\230\302\325,\253p4\321\243"
+	.ascii	"\273?\364\265\301\321v\277\221\356\326\265\341n\256\250\253\352"
+	.ascii	"\005U}\240\272=\001{[\2127hG\206\022\r\313TC\331\362N\365\261"
+	.ascii	"\273[Y\247z\240_\365\360\272q\241k\212WA\271\372\305\325\031"
+	.ascii	"W\345\256F^\335]\275\200\017&Z\n\021H xE\330\267^\214V\222%x"
+	.ascii	"\036\376B\017\372\220\246\204db\347\232U\374$\361z\032\200\227"
+	.ascii	"\252@$\366P\306C\026\366m\356~\224xN\335\341\307\245\212\200"
+	.ascii	"_\325\363\0026\215,\323\343\300h2\232\274\323\215\037?P\364\264"
+	.ascii	"\201\023\374c\233\021\217|\262\301)\216\254A\304CQ\313\360\361"
+	.ascii	"\006\177\2516c\266\275)y\0279\262\256c\202\374\241k\354;\346"
+	.ascii	"2\310\272\265\034m{\252/:\211\tz\035UY\221\372\225y\271,\342"
+	.ascii	"!7\333\336\267\273e\2542\363\274;C,h\026\206\242\326\343\374"
+	.ascii	"'\036\f\250\215wM\325\n\260\256\027\313A\013\206\225\002\302"
+	.ascii	"\\ \264`X)\337\247(!\260\227\226\026K\213B\313D\002\314\265j"
+	.ascii	"Qa\261\254P^\260U\210\001u\271\264^\253\027\227\353\265J\205"
+	.ascii	"\375\330\254S\024\217\217\322\214i\n\362.\351\365\023\223Ir\226"
+	.ascii	"|@^2\365&^J\b\340\350c\346e\007\216\013\215\360\243\030\260\273"
+	.ascii	"\031\350\215NL@\235\231y)\231$\247\305\023\320l{\212Ts\373\360"
+	.ascii	"\001X\025\253\242\264\366\0010 \200\202\0212\255\003\377\374"
+	.ascii	"\037\033C{\360\346\226l\364\223r\006\303~\221\004\203\210\301"
+	.ascii	",\211\316\233\265\203\tY\031\211K\271\250\270\007Y\203/\241$"
+	.ascii	"\336C\235\n4F\245\301\f\256\"G$2\0030\260A)L\210c\253\026\276"
+	.ascii	"\275a\312c\\\264\340S\224aI\004\222\fl\344m\323\244 \243\023"
+	.ascii	"+\303\2039,\207\273+\\\365{\333\365\364"
+	.text
+	.section	.gnu.lto_osdElementPidRateProfile.172.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"u\013"
+	.string	"\366\026P> O\234\016C\017 \bD\233V\006\021\230'\222\030B\302k\232T\001\301|\213\242&\"\3026\343\f\241\304v\037\220?\002\001\001#>5"
+	.string	"2\366\365\302\322\300\212b\024@\217\2156\2212\245="
+	.string	"9"
+	.string	"?"
+	.string	"\347\330%\3010\261\033b\306\036\217\016/\261\036\037\357\260\036\335\331."
+	.string	"\\X\017\301\n\026!\022/v7S\016\357\236\235\377\020\207|\"\357y1\330]\347'\032\335z\333\005l/\260\337 )P\037\365\354\320K\335`\277\332\335\265\222\354\203\177\244J_\232\2664\0353]iZ5\235\231\276\206$F\211\321\301\323.\206\224\214EE\024\246\210\355\247\375\017\007\321\035\354\004\377L d\t\037a![\354\256\002_D\204\214\200\322\356\276\303\243\337\261\036/\205\200\224G\265*\215[\245\367\240\201\362TU\f\224\341\223)_S\037\232\341\311\224\257\264\271\n\371\357\032\340\204)\276L\260\313\304\272l\251p\034\215\226\321&h\016.\334\226i0\0172\231e\303e\225\001\336(h\233\214\263m\233,\022\356\253U\222!&\025(\217~\274\221\252\226>\374\311b\240\264\013\372\247=@\t\016\330\0200\031\021"
+	.ascii	"/\371\337\331\220\261\027ak\300\031\221j}\001\263W\004\253\001"
+	.ascii	"1\200oS\246\377\224-\003\230p\t\241YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_osdElementPidsPitch.173.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\315\013"
+	.string	"vVQB"
+	.string	"Q5\035\260\242\217\013\232\252R\353<\271\035\322\351\220V\335\355\207G\225a%\317\355\357,!0\271 \210\303\023\344v\030\200\326/R\031\255P\261\020\241E\350\3644\335^B\364&\"d\271\321\226)\005;"
+	.string	";"
+	.string	"A"
+	.string	"\273)\227\212]\021cL\366i\361\027\3543\373\006\366i\317~\301Qa?"
+	.string	",\\\026X3vW\223\033\356]=\377!N\001O\337ur`w\255\340\tu\313\333\006\261M\300\276&\276\b\373\274|\214\0162<d(\351\313\026?\225\032\354Kvw-S\366\303\177J\324R\252U\325\237\\h\270P\017a\354^x\325\330\326\\\261\252\330\276\332\377p\020\336C\322-\001&\371\331fp\024\021t\364O\204:\035#\t\373\224R]\204&$\214\200\2661/\321\300\300\270\273\003>m\317Y\\\266\273\002HL\200P\200\203j\204}\252\234,\020\303E|\304\310W\271\023\351\301\317V\200 \201dbN\246\013}6\317\346`\323,\3508\355\323\331x4\016\250\3232\036\346\036l -\304q \255\"\356e\312\224U\213VIR\260EU^|\nM\310\270k:\270\311L\001Dl\316\246\007\375\021\023"
+	.ascii	"/\371\337\331\220\261\315\373\306\211\213\\j\334\"\302>\242\034"
+	.ascii	"$\314x\251\0331\366\246\317\004Q\206jT{\003\020\\lhVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_osdElementPidsRoll.174.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\265\013"
+	.string	"v\226P@ O\225\016\004\371Q\030@(\200\335M\\\322\036\361d\005`F\300JA\370\323\300\254\035\210\340P;\220q\035\201\376\231\260B"
+	.string	"j\020NRh\233 ,T*q\224K\177\360\212K\0327\3322\245;"
+	.string	":"
+	.string	"A"
+	.string	"\273(\027+v\305\213/\332\247\305W\262O\355\032\331\247?\373\305\306\205\005\005\270`\030Z1vw\223\036\376]?\377\254KB\023x\215$\330]kh:\335\362\266?l\033\260\237\t~(\373\274<\f\0203`\034H\032\263EPe\007\373\220\335]K\224\375\325?!j)\325\252\352G*\261\f\247\263\\\273\032b2\3665Y\250&\266\257\366C\\\304\367\325\350\224%\t\332v\360\024\023t\364Q\2008\034\343(\373\224R[\254NP\260\204\266-7\361"
+	.string	"\301\270\273\005>\355\316[\235\266\273\004JT\220p\340CJ\224}\252\234\255p\303G\234\204\310O\331\013\351\303\317V\260\200\001$\342\r\306\003y\270\016\007\201\3134\360\272\315\303\321t\266\315\307\3330\035\356\"p\237\r\324u\237m\"\356%\312\022\025\354E\222\026LQ\225\027\257\"\003`\334-=\324h\245\001\001\354\r\247\017\355\021\023"
+	.ascii	"/\371\337\331\220\261\315\373\306\211\213\\j\334\"\302>\242\034"
+	.ascii	"$\314x\251\0331\366\246\317\004Q\206jT{\003\020\\lhVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_osdElementPidsYaw.175.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\365\013"
+	.string	"v\226QA"
+	.string	"Q5\035\333\372q\273TA\315G\210\027\266{\372\226\224bl\331L\357\345'\317\355\357,!0\271 \210\303\023\314\3540\240\005"
+	.string	"\200\"\346iy\021\2347@\323\355u\240\223\233\210\220\345F[\246\024<"
+	.string	":"
+	.string	"B"
+	.string	"\273)\032/v\305\213/\331\247\305{`\237\331;\260O{v\r\020\f\373\021\220\221#C\353\306\356j\022\304\275\253\347\177u\nx\372\256\223\005\273k\005O\250[\3366"
+	.string	"\333\b\354s\002\276\b\373\274\274\215\220E\242CI_\266\370\251\374`_\262\273k\231\262\257\372\247D-\245ZU\375\311\207\207\020\365\325kW\303\013\307\272&\f\021\025\333W\373%n\302\273\212tK&\371\331\346\274\005\005\035}\026\241N\310H\302>\245\324\031\252\025\025\006\200\254\253\200\240`\334\335\003\237\266\347)\270lw\r\264,LH\020\"\034\3351\260O\225\263\005r\370\211\243\030\371\241;\221\036\374\fn\300\300\201d\342\r\246\013}6\317\026a\313<\3508\355\323\321x\264\r\250\3230\"\346$l -\304q \255\"\356e\312\224\021\033\\%y\301\026Uy\361.2\001\306]\323AMf* \300\336lz\320#\001\025"
+	.ascii	"/\371\337\331\220\261\315\374\306\211\213\\j\\#\302F\242\034"
+	.ascii	"(\3140\275\233d\254\305\230j\237\261\245L\250X\252Q\355\r@p\261"
+	.ascii	"\241YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_osdElementPower.176.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\215\013"
+	.string	"v\327Q?\020Q\225\016+X\230\234\215\025\005\206\254\"\277t\016\022\320\270([\343\bR\rJ\305M\b\021\254e\325\024\346\355\204\"\350F,"
+	.string	""
+	.string	"J\005\235\213%\030\217\225\351\007\325\300\265\215l\"eJ\001?"
+	.string	";"
+	.string	"@"
+	.ascii	"\252\320"
+	.string	")\273\247\216\025\273a\305\025\310\243\303\007\300\036!\007\200=\272\263a\f\270\260\336\305\005\006\322j\306\356f\n\342\335\263\363o\342\021\260\344=\037\016v\327\t\226L\267\336\366\001\333\r\354?\by\360\032O\2446\260F\352\331\241\227\372\301\376\265\273k=\331W\375\222+\215e:f\372\312\264j:3\375\r\001\036R\230\316\361b7C\213\306\262\"\013\021\023\333O\373$^\242{\216\360\225\205\354\330]\006>\n\t\034\002\250\335}\210G?\204=b\032QY\205\206\273\005vi\324\3127B\365z)&\343K\215\262\345T\325\223j\210\262eI\332\235-\017\246>F\207G\332\\\205\206\260\271$\210\017k,\034\310\243u\264\t\032f\303m\231\207\223\351d\232\017\227Y\nx\243\240}2\320\266}\262I\270\277VO\216\2448\260D:2%\243><\007\006\001j\367;\230\201|\013\024\330\032-\017\332\300\027\017"
+	.ascii	"/\371\337\331\220\261\367`k\342,K\265>>\330\343\224\251\307\264"
+	.ascii	"\367\246m\017\006\\BhVS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_osdElementRcChannels.177.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\003\004\r\035"
+	.string	"&v\275H\220\232Q:\200\247\017\007\320\024\277\222]u\270B{\272\330\345\002\177\244e\237\271\030\353n3\267\304\247\356z\260\3216K\2667\243\034\201\357I\222`\024\001`\222\336\026)\006F=\200"
+	.string	"\026\240\364\374l5B\310\336r'\031\251"
+	.string	"\240"
+	.string	"\256"
+	.ascii	"S=\352\375}8&\241\342!\303\317\371a\217\337\335E\022\036\225"
+	.ascii	"\200\335;\244p\313?\314\247\314\277r,\347\245||\300\275Np\266"
+	.ascii	"\356\035Z`\013\346-\017_\200\2745O\200\274\345\2239\316\201\245"
+	.ascii	"\233\333p\374\361\250\304\356\275\265~\302\365ux&\351\371\222"
+	.ascii	"\264\265\351\311?\361\016\204ftl\212\276\334\313\032\300\313"
+	.ascii	"J\022\232\217W54\031\275nu\032\304\247\243$\200*Gn\215\274V\b"
+	.ascii	"Pu\302\320|K\025\001\227\245(3\237\022\355[}\2020\213\310\246"
+	.ascii	"\350;rZ\212\270\3672\355\371\230\316\346\231\271\b3\257`\256"
+	.ascii	"=\001^\204n\017\276\204\267|\037\344-\255\355\223\232/&X\244"
+	.ascii	"\222\350\030\363PG\033\350e\245i\213\333\211\331\347Y\347\236"
+	.ascii	"\017\317<\237:\323.\365\013x\325Yf)\233\226rYR&K\312\326R\256"
+	.ascii	"$\345\266\224i\245|\003\177\n\033\"\204\351WZ\367\016\031\263"
+	.ascii	"s\273,\327\224\033\377\254\277\352\037\376S\314\277\342c]\213"
+	.ascii	"gY@\234\216A\023f\361]\316\033\221d\301\243\024\260{\211\214"
+	.ascii	"0o1\220'@~\013\337\212gT\347r\276\212\301\3742\335\377\020;."
+	.ascii	"\001\273\367\2060o\031\324_\313\211<\013\t\326\024\345,\240="
+	.ascii	"\375\255{\221\330\275W\302\334\245\220p\373\255c\235P\320cF\221"
+	.ascii	"\202\276\307o\363t\354\332u\216\017\320w}\307\217g\253\374:\203"
+	.ascii	"!k3\257`A\337\353\351z\177\235\343\356\332M\305\273\223D\307"
+	.ascii	"x\374L\213\016\37427\363\002F\f\372^\f\362\266\273B\033\2567"
+	.ascii	"\355k\335L\003,V\361\356\034\312\234\2501\265\201,\203|\033\021"
+	.ascii	"\321(\321:8~\224\021\241\003\363\214\217\001R\020\274W\211C\230"
+	.ascii	"\213\tb\233\r\372\236\215\276\325\355O\250\005\305\325MF\257"
+	.ascii	"*\335@\036\372\027\236v!\304\242\3037\316Ed\336{9\360\003,\364"
+	.ascii	"\003\241\002\035\001\t\325\032:h\034\021\325 \207\216\273\025"
+	.ascii	"\355\250\270[\021R-9\350\002\356(\207\215\310\206\3036C\bw\253"
+	.ascii	"\345\030\002\"\252"
+	.string	"\005\031\341j\027\026\360\255\310fT;\272\335\214j\263a\322\333\211Q iB\007,\251u\314?\243H\346\023\352o\316(Z\360\304\3270a\031\261\260\262\201\\\222\261>\335n(\205\313:\210\254/Et\243D\353\274\336{/Y\341\262\366Q\001\274\222C-R\275\327I\210\033\177\260):\306\r(\210`\331f\013h\3463\313\b\006\274\3161\255\315>\331e\037\016O\333&\373;&::\306\262\266\035J\250A e\024T\20685\201H@Rb\314\030`\002!S;\017\021\300\275D\305\031\266\003\017\365\217\231\227\312o\312\200\310\223\013H\021g\2214\265s0\233\327\024a?\354\224\200\307~e\365\261\245\222\306#\250\217^\257\031Q\323\f\206\317J\024\325m\375\200#\035n\252z\221<\213\305\324\341\256\325tV c\bu\213(\002\032\353Y\365\033\323x5\315\312p\310\361\324\360\345\374c\230\367#["
+	.ascii	"!\266N3\354m\007\264\300\233dM\031v1\007\n\314\213l\300\206\321"
+	.ascii	"\211M\2030\363\202\210\270\307\305\332'}^\340\373\003"
+	.text
+	.section	.gnu.lto_osdElementRemainingTimeEstimate.178.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`o\003\035\031"
+	.string	"\306/\246H\260XQ:\360\252\245\025\236\036\376\260\035\002c\217\235\372a\303\2419xD\240\230\264'|\260n\362:\316\334\342\224\025W\202Vnn\0131N\034\330zA\376\322\376r`5\277\351\240\013L64U\277\355\023\2627\2212\311\214"
+	.string	"\203"
+	.string	"\232"
+	.string	"\363\357\255j\227\367!\265+\265x5\252\1771\206i\007\254\265.\370\334\007\343\247Mx\336}\220\013\251}\347b@\253\342z/\232\324\312\203-l\374\\\336_\364s<"
+	.string	"\372\271\265\335-\003\206\252\220\003\246 D\2760\265\326X\343x\355\"\235asm\377\336QeN\350\342\214\323\311\312\221\241M\255U\225\033\3420\225\233\361\016\025"
+	.string	"\227\276\260r\270\360U\264\243|\357\034#wc\026)\324Z\227\313\234\321w\374\356\256\330\335\021\273]#;{\335\347\312x\370\345\347\236\207~r\337\344\330\271\372\235\362\375\214\220@\033\007W\305\273)f\374\322\325\275\364\203L\323\255\205vy7\356\243\335\207\265o\354~\367\007\270\357\373\272\322\327Ey[#/\215\310\313\022ygD\336\225\310\253\032yS\"/j\362\216\224W\244\274\264yg\363\206\223\267C^n\336\027\b"
+	.string	"D\206\321\223p\251\265(8\2466M'<\356\373\225vOd_\304\007C\307\244D\302\370\243\025\337\217\013\331\343F\241|\270\371\024\237\210\335@\207E\207\222\221(\323\325\335\335\305IGo\n\216\237\030\312P\221\217P"
+	.ascii	"\237\310\235xH\200T+\371\022\304Hn\270\331\r!\202_\256\315\320"
+	.ascii	"\2228\023\240U\226Z+\204\375\222\016%j\220"
+	.string	"t.\350'\355\006\272+bv6\016\036\351\t\330\244\373h\366\333D\217\n\216\237v\227\376sJ\252\361sJ\262Qw'\004\203O\270Zm\b\302\236}\362\307\215\203\333\035v+!\201\334\335'*\263\233\363$:c\2558\b\373#G\022\213\203\023\001\007\207.\f\026\001\006\243\262YOP\016\217O\217\214\306\362a\241C\263\200\242\302l\024w\207\001P\220\217l&S!\3139\001\364\023\363\351\321\231\305vh@1\0065\373\263BF\213\005\375\374\320b*\236\355\275\037F\222\217&[\337\304\032\246\351\375\005\332\352]\f\031\310)\007Z\215\332\275\232\246\351\321\017\fQ\031V\277\232\251\220Ufz\325\254>)\3456\323\006\2604\252WM\300K\252U}\022\270g\272\024\r{\335n\340\300/9\320\317T\377\211\026\032c\243\232\200\227\261_\344\001: \220\002\241\251\252\016O!\371\313\377hC\260mF\362H"
+	.string	"\243\0220\212\366\202\261\351\342\314\230\270(\007\221\240@w\360\252@\325.\021f6b\034\203(\352\035\321\337(\276\035"
+	.ascii	"x\373\233\234\261\005\206\322c\272\377\321\274\200\363\263\225"
+	.ascii	"\241%\310D'}\204\374\205px\250\323\217\327\3246\264\327\004\312"
+	.ascii	"\226\306\026q1\252\202\263\330\332\032\347r\020\027\322\251Q"
+	.ascii	"\"\234\367\346e*\001Gr\232\\\\\273\247\022\346\3735Z\001\005"
+	.text
+	.section	.gnu.lto_osdElementRssi.179.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`w\001\215\017"
+	.string	"\306\336jF\340\262(\035\222\016\f\031L\017l\266\024B\324\023\020UQ6\025\200\024\002_.A\215A\313\275\316\235\372\255\236*\346\f_+d\275ur\304\0303L\201\2148\035\b\0372\250\2700\273\271\223\354[#do)S\nT"
+	.string	"P"
+	.string	"W"
+	.string	"\366S\\\205\352/)\037\260+\303\211\261\373\215x\344\363\350\357\006\264\307\317\th\217V\331;\b@\354\n\302\315\214\327\f\317\356r:\342\252CM\225\277\225\200\274\330\352P\3045@L\005\206\354\356e\236\260X+s+\331]\247\027[\271\343mW\260M\301\276\215'rZ\272\262\277U\352\314>\334\335\265\312\354\277\374\242\320c\356-\2465\230\2160\raZa:5}"
+	.string	"\007P\274X9\r\316n\210\036\037\233\023e\224x\314o\3772\026\331\337aT\217A\371z\373\345\271\241\241c\367k\360\350\b\237G\001\371\f/ox\213\017\231cw%\370,4\234\022\264\220x\364S\264GMA/\233F\375\254\006\006\324Y\356\356JUf\035\250\312\302\301C\246\206J\3660\324\220~GH\025j\234q\375\360\215\333FKU\2056.\023\255\354\3615\365\257\037\254\354\361'm\017]\336\273*\214K&=\020\031\211h\246\256\263@\352P\333\346\021IwbR:\2258\224.\220:\024gb\302p\342F\251\216#Q`T\207R\212;A\241R\234\350\333\303U\231\013\270`\331Q\353\034E\003\201\261\324dH7\205\201\\lrX\3322HFu\360\2578\315hA\313\256\353^\351\343\232\300\300\316`\312{\016\t\033"
+	.string	"/\371\337\3318jo\031&6\030\313R\255\273\231\205\247\313~\214q\213-\004\036\016:\344\222\346.\251l\210j\004\bN5\003\3542\354P\001\323p%`\016\332\315S\257"
+	.ascii	"'\b\030\260\250r\333U\364"
+	.text
+	.section	.gnu.lto_osdElementRtcTime.180.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\305\b"
+	.string	"V\021?9@\345\2501\340]\365\371G\027\322\314\346\221K\366fi(#O\312\007XC\302\007\"\373\"\037\372\034\374\345\022(H\326Qt\206\f\343]\226@\316\307,\006Z\243lR\246\024-"
+	.string	"-"
+	.string	"."
+	.string	"\222c\002\215e\2716\346@\343]\210\005f\003%\300\377,~\2303\344j\227\270\243Zu\206\233\206\377\205\252\025\313\215n\253\3206\324\266%\215\255\326\236\035!\254\245\201\307\301r\n\354\357\210\r\370K\256\204x\332\032\266\0361\tg\017\345\201\277\365\242\362\177\237~8\226\375\\\240q\3556\001\255jBF\354\332R\370\344\002\272\374g\250M*,\026@\376\333eY\2434\226\216\002.\230"
+	.string	"/\005c\355\327\301\350\321:\363\377\001\247\322$\315\321\334T\004\332N\245I\232\243\351"
+	.string	"\261iY)\342\201\224\211L[\006B\250&1M\331I\323L\231\347\2733\217\255vD"
+	.string	"\274R\021\243\033\350\030\t"
+	.ascii	"\357b\310\214\247U4\004\027\342\300\224K\260\315j\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_osdElementStickOverlay.181.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\212\n}8"
+	.string	":g8\026>@\244N\007\333\200Ry\027i\201\332{\253hA\217\312\360\307\216\227\325~p\222\f,6\306M\025 FF\177\300\"\021\\\br\027\323\245Hc"
+	.ascii	"\304\245\262\377_QW\332D\312\235RJ\001\\\001.\001[\001\255\327"
+	.ascii	"\275\327\315\327*\363\033n8\214\004\274\n2fpI\016\265\335p\377"
+	.ascii	"1\322\357*]\365:\f*!S\333v\233i4\275\246\331t\233\356c$\337\020"
+	.ascii	"\261=\"\210azfR\307u\235\243\373[\321i:\317\331j\314z\205[\233"
+	.ascii	"\215n\020\213\227\332V*m\247{\346,]\343,\f\262\311rA}\020\301"
+	.ascii	"\331xg\275>W3+\203{\210\353\212\227\325\226#\250\355\314=\246"
+	.ascii	"\3118\373\316G3\255k\224A\177\353\212\247\305Zj[\306\353\247"
+	.ascii	"\333Vm\247\333\226\331\311,h\300\217\025\r\302`\0334o\321\272"
+	.ascii	"\256\313\237b\255Ebc\247x\315I\357\354%eR\211)\t\211tT\215\327"
+	.ascii	"\246\357N\356\276NPw\250\346g\357\r\255\227\224t\235L\261\344"
+	.ascii	"\b\217\264\036\267'\351S\036(\207\335'\347J\235\266\244\231R"
+	.ascii	"U\217\233\223\2249\265\305\215\212'I\201k\322\310\024)\260\317"
+	.ascii	"\257\365\2701I#T\331\242E\315\221\244\300-\351\343\224\332z\334"
+	.ascii	"\224\364\026\26787\336\224\271\032\nJ\276AS\343\243$p\310\267"
+	.ascii	"\247\33398%\235\246X\210o\022%\337~\244OE\256\2605\234\366\266"
+	.ascii	"\2675\377\376k\033\025\324\033\2238\007\327\244\335\230a]Wv\266"
+	.ascii	"7\270\346\246fn\024\314\254\203\371\310%-\204\217\234D\351Gy"
+	.ascii	"\307\375\35794\200\326\\\221\375\373\377SD\3208\357\253\313\365"
+	.ascii	"\376\226\317\367\325]~\177\303\351\020?\004\375@\001\325\276"
+	.ascii	"\n\034#A\376\243<\243\351t}\212\2725`8\254\345\324P\327u\225"
+	.ascii	"\300\035\350t\273Qeh\245-\267\217\333\226\371v\313a\02792wi\376"
+	.ascii	"\210\031O\315?\312\334Iqt\352\360Ga\376\340e\23574^\263\206>"
+	.ascii	"\323\214\341\202\205\n\255\327L\241\367\232\273\232\257\231\331"
+	.ascii	"w\335\023ZM\363\203\326kv\320\200\315\\\355\327\274\264\316["
+	.ascii	"\327Y\313:7\270\316Y\327\031\313:3P\235\257\256\263\325u^`\235"
+	.ascii	"\025X\347*\2433\225uN`\235\247\214\316R\3279\352:CYg\004\326"
+	.ascii	"\371\300u6p\235\013\\g\002\326y\200u\026p\235\003\\\347'\353"
+	.ascii	"\f\340:;]\347&\353\314t\235\227\254\263\322:'\257\263\222uN\272"
+	.ascii	"\316\310\353\214d\235\217\327Y\265"
+	.string	"\316F\353|\257\263\265\316i\352\374\251\263\247\316\r\242\355\262\024!\002\327t\374\254k\221G\215V<\026\020K\003v\373u\343u\237\351V\323\001\b\f\374\001\305D\003v\022\325'\324\212\262\300_\370\347\023\242\025\235u_\"\022\r\020\025\370\353\245\2560\361.\315\0371\201\267\360\037(\242\r\2355\237!\363\210.D\302\212n]\327\230\210M\250Dz\002\305Eq\333\022\370\346\373s\267\325\002~\300\017@\024\340\005|C\027U\264\2403u]\327$p\037v \026\334\302\2057\233\213\3336\300w\234\272B0w)\334\233+\311\2172W\327\270O\037\203_\364\037\365\351\273\257\323\277:\302D\245\217r3}\024>VAz\275\r\343\335\247\227\337V\210\363\344\345\001&\355\351\345{}\377\265\211<A?\016\264r\270\b\371Q>\002:~x\253\310\304m\266\323u]W\244\217~x\247<\3019\336v\024\300\364"
+	.string	"\234\036"
+	.string	"\363\233\336i\371M\177\013\227\236\211\260\273~\351\243\242u\374\236rjQO\234\314\251u\232\353m\241@PZ\321\310\227Ec\200\244O*}\262\013\233\371J\310O\352z\244G~s=\322#\350b\032U\0355$\367\243\202\275|[\350\220\021\232?k\256\350N\002\2159b\225\216l\016\274\367\217?\341\231\277\300\274\331X\n\372h\254\376\021\301e\276\372\267\360)g\377\276\367A\027\323\020\334\256\267\037\025\025\034\364\224\013f\315\243\311\2328x\244dM\034f\351WX\331\030\230\216%\033`bb0h|\275\260\001\243L\254\331#l\254I\243i\005\213\261&\331X\216/\243\221\277\266\310\312\304\300n\200\331"
+	.ascii	"{!\203\254\271\024\013\203qc\3715F\266\334\202\342&\016\260\261"
+	.ascii	"eY\2639\266D\342\245\365Ga\244]\037e\205\207j\263\273K^\370\007"
+	.ascii	"\337\206\264\223\243\244\360m8\030\006\352\227\264\360\016\276"
+	.ascii	"-\204\2305\0211\355\325\270\007\233\331i\347Hv$\351\326u-\253"
+	.ascii	"\363\263\350P\2323\370\006\277\245\365[\030\236\371Z\237:z\312"
+	.ascii	"e}\203\327\302\372,\254\277\216"
+	.string	"\236a\256\236\301w\224p\020tQ\355\346\265\372\253\357\247\234\232\206\267ze\036\341\235'\340\202O\366\331\325\360^\370\314\242\340\027\274\355S:[;\220V*p \275\341\225\016\355\252\337@\365Uo\013\2338\221!T\177\233\324\361\001\003\230\3401\274\027R\2711\253\225\177\016\244\215\317\354\024\343$\343\315\226\340\273\257\253\326\270Gc\243a\372\306\277\211\224~\315\201w\352\323g\177\036\222\372\251\377@K\374\351,\303d_\363\037\0328xy\263y\335\266R\337\210u{\022\001\227\242\276\202\007O\353\340h\276F\335\001\003\365\024\376\003?\364\342Y\363uhG$\254\032A\035\370\200\272\25010\004\r\223\310\314\004#\"B\322\2449\240\002\221!+z\0210\245u\216\210\246\205\315\023M\232\271\361\246\375\357\253\276\205+\320\017\225\334RB\222\211\331ly\244n&\257D\310\240\220~\231\212\342\345\006P\226\344\rG"
+	.string	")Y\342\306C\206\322\207\327\203\311\215\304\222\201\357\313|{\026-v\206\254\253ss\031>n\257\357\211\223\023`\362\377\013\024\034\260B\001yyN%0\2015\246\320\035T\346?\3027\3644\302\234`\364\016\273N\2751\364\240\340\317\306\267\354\202\201X[\271\037S\356V\212<\356Y$\371\032\245\320\274\270\f\027\350\177\033\215\036ZIsk\204\232\274ec!7\326\357\f\305\267\364\226\270\271B[\332\260.\321\375oF;\215?r\033\213K2\373\373j\275Q\235\030J1\032\300@\311v\337\233{\242"
+	.ascii	"\032\250\354\0049\262W&\260>\003`a\022\0177\376\016\247\322/"
+	.ascii	"\201\013\237C\021a\226\312\225\323E\314!?l\016\t'\032ZF\253\202"
+	.ascii	"\331\311$\201_\005-\222YM>@p\327e\020\203F`O\327\230\0068~\016"
+	.ascii	"oz\n\206\265m\305\360ax\315\b\302\223\025:(^\350\277\376\020"
+	.ascii	"\030\022\021\026\034X\272'\025\305\256\327\274\324y\364\n\016"
+	.ascii	"\r\013\234\316\330\276\225\325e\263\351(t\356\214\300\270\304"
+	.ascii	"n^\374h\214\020D\032A\266\301~&9\037vt5"
+	.text
+	.section	.gnu.lto_osdElementThrottlePosition.182.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"m\n"
+	.string	"6\224I@ \3078\035\007On@Dn"
+	.string	"\354\026\002'\021\271#^\376\363\002 \273\211\004\230\177`\313\231\217\032\333\215\262\325\321F\027\252O\001"
+	.string	"\003\020\204Vr\223\3774G+\215A\227\301\337H\204l\231R4"
+	.string	"5"
+	.string	"9"
+	.string	"\336p\327\\~a\273\306]a\273f\321N\3200\262\243\305\353u\002\260`w\273ir\361*\372_9\206D\215\327\213\306\356ZIT\352\236\267-a;\303\276C.G\235%\366\263\335]O\225}\327\277e\3529\325\252\352s\f\n\004\244n\340\300.I\314\301\3024\002(\031\333W\373*o\211w\215\236\260\253j0`\267\334\004k:\331\301\231.(\354\217\207\236t\304\311\240\267\210(\202\335\305\360Y\300\357aur\315\037m\327\346\304\270>unN\017H\032\363E\3550DO~j\fX)\260\322\034\035\366Th:\232\355\342\016'\024\205<\220\367\341mx\302\257\013}8@]\007\f;\016\204?\020\017\354D\337\007v\231r\237\355T\031\303j\301H\263d\004\325\231\335\005\266\227\017\340M\2546\016"
+	.ascii	"/\371\337\331\220\261Gak\303\031\221j\235\022\0266\215}\001\373"
+	.ascii	"\006\f\270\204\320\254\246\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_osdElementTimer.183.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\205\n"
+	.string	"\246\024J?0\213\270pC\371\375F\3665\257\347\306Sx\273\\\226\267\035\234\206,g\242"
+	.string	"\327\327o\361\267k\267\001\320^bP9*g\203\252 LT\206\340p\276\235H\031\206@\221\233\277\275dK\231R6"
+	.string	"5"
+	.string	":"
+	.string	"\"\306\230\354\227\305G`\277\262C`\277\f\332\027$H6\324L\030E*\r\273\253)\200\203O\320?\202WF\245\360I\301\330]\347\250d\272\365\266-lk\354k\001a\352\211}kw\327z\262\237\3721+miZ5\235\231~\366\002\021H%\246Sh\260KZq\330\n\327\203\001\026\333O\373\007\216\002\237\372\374a\3674:\330\r\256\020ih\273\273J$\307\211\321\322\312\310\r\001KU\315\005\026\030\230\204r\345k\352E\035\fr\005_\266\273\027~\002/$\013\360\313\377`\277\256\227  \203\201\024(W\266\030\236\316\306m\234\215\342M\346\363t6n\343l\032\034_\247u:68m\343}Z\206\302\335\307\346i\236\256\3634\213\270\267VO\316@\021\330\200\001\244![R\365\362\313-\265=\270\374(\016"
+	.string	"\357b\310\304\363q\264\340A\007Q\032\020\351RB\303\232\n"
+	.ascii	"g\002N0\353\022V\263\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_osdElementWarnings.184.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\242\032\345p"
+	.ascii	"\252\274T*K \216\333\031\003\267\261qB^df \342%t\200Vb\257(W"
+	.ascii	"\034\034L\361+\262\317\320\261`\301\341L\267D\016\304\\\037l"
+	.ascii	"4S3sp\020\030\231\244\365\216\230\324\303\244_6\313\276\025e"
+	.ascii	"\355\356$\243%+\267\310\235RJ\001\213\002\\\002\236\002\316F"
+	.ascii	"Ig\022F\347\021?\316EEge\321YD\321\231\b\351<Tt\016Qt\006\321"
+	.string	":\177h\235= \235\205\212\316\035\212\316\034\220\316AG\347\r\255\263\206\3269C\353\214\301\350|\241u\006j\235\223\255\363O\353\214l\235\217Fgc\353\\l\235\333\326\231\330:\263E\347\265\350<,:\177\353\354\255s\267\031\324\235\234\233/k\330>\016\334\273\244\332\302\313\267\342E\233\256\211\316z\307u\177\341\026\323w\314GF\322v\\\214+d3s{\337\027\t\363\261\301p\207\241\213\340ie\215\n:\332^\275\345z\216\217_&\360[3\225j\341\272\204f\307Q\320/\331\333\027\204\260\346-\360}\341N\364\312+\332^\225\303v\346vk/\315\236V\320\030\336\227\312\2342\357\013\267\304Km\257\f\327Al\257mk`{\345&s\035!\260\227\313iM4ln\360}\337\246\257\302?\336\354\027P.\236Z\260X\341\244\202\231\002E\023\323\222\322\211$\023H\313\243\022F$F\024)E\020\r\205"
+	.ascii	"\361\301\203P\007\016A\0334d\300p\001\006P\362\007y4\026[\"\273"
+	.ascii	"\016\337\233\334\\\375\"\003\250>|\334E\037\252?!\261\240\205"
+	.ascii	"\035gQ"
+	.string	"\307W\f\002\272\323 \035W\2615\310\\\023\233\323'&\307S\314Y\023\373s\024s\374\274\311\f\316M\312\304f\317\227\330\254q%\f\374\334\244'\324\254\211\245\361$\b\240h11|\032\363\222!\256U\265\364\232\030\032GRA\317\227D\013\374\334\244GdL\360\022d\306\270\021 \211;;\037q'\306\213\246\240\204~J\021\304\031gda\232\310\bf\347TC=#\233\366\220\227\020\335'\346v7u\020\335'\366\266&\326\346\037\352\272\270\207:\251\013!0\325\322\201-\352\034\330\324<\210\205\366\201\333\220\245\327\304\260\270\206,W<\003\b\215\2018\303\006t0\214\033\365\214\254O_p\222Ei\030C\"\330\022\265'>\201x-8\220\224NJ1\363\037\342\2143\262(\215\204\322G(O\334h\245\330A\321\232\230\023o\213\316\310\312\2328\fj\203F'\311L\315\006\307\2610g\313\3028}\035\252"
+	.ascii	"\033\204\202\344\023\266\302q\f\314\207\303\244@3\202\335'\226"
+	.ascii	"6\fZ\242\366<\216}\371\367\211\2010T\276\357\333s\355I\306\274"
+	.ascii	"\334\2113\336\367e"
+	.string	"\177\216\2215\307h\346a\223\231\t\2319|\b0\236J\206o9\030>\303\017\363.<\006\240W\352\013\202@\337fj\205T\240\207\346\321S#\204\202\242u%\347t\362\245\366\222\177\347\347\236w\272\221\330\237O~;\315\354\374\274\226\032\2414\217\0300^?X\017\330lj{\220B\215\304\312\3512j\202\203yX\021\366\366\216\304_\343\366lA\376yi3\3565\362\221kr\177;\376\370\310\367@\030Vf\374\343wXa\361\225\332\370\355l\001N\307A\202\240y\345\n\333k\361Y\275\342C\271\203]\232:\304\254w\266\331\364R\2224j+\221\337\361I\210\342\246t3\013\333\356\021\037\353\333og\b\335\327n\232Y\270\261\360V3\332\214\262\275\022\277\305\324\364P\313\272\274\332\002\rf\375\361\r\340\036\247\331\2127\205\003\342C#`\211\274\013v\013\306\n!\373PFb\331\357\263\026\211%\362\354'\301"
+	.ascii	"\355,\2674\271x?\211|\207\351 3m\\0(1C"
+	.string	"]\327\367\251\22137\245\3156\357\347\372\315e\212\327s5\243\340\205\255\312\360\241z=|\255\"\347n\276\261\314QR\336\317\341\367_\233\026\276\257\256V\253\205\317Y\354\177\002rr\276\234\017\017\371\211f\266A\345\375\374\357\2726)|_\317\305\376)T\001\371\345\365\363\016Pa\265Z\355*\266\337\177\b\030V\346\345U\245\306\253j\337\367}\342.\323fppc\351\225\257vx?{\345\336\301\366\332/C\r\216\024\257\313\253\314\301\231\177\f\340\375\304\372a\233.U>\r\316l\300\001\336O!\337s\335X\354\316\360Q\003\275\236\213\031\316\313\037\312\334_\255V\t\371\2510\033\235\273I\322\271\303z\332\255\225\325t\315D\200\234\035\350\270f\254\376\322,\244\351\232w \235u\024\235\257\212\3169\220\3168\200\234\255\200\234\253.8\013\220t\246*:\337h\235m\264\316SH\347\032Eg\032Ig\251\242s"
+	.string	"\255sT\353<\003\351\f@\321YF\353\034\243u\206\201t~\001\344\f\325:\273h\235\237\220\316-\212\316,Z\347\025\255\263\023\322Y\005\2203\023\3109E\321\031E\353\334\324:3!\235\227\222\316JI\347\023E\347$\244\263\t\2443\222\321yit>2:\227\370\t\317d\233S\236QA\356\210\371)\376\325\346\334\214KW\206\371\315&\315"
+	.ascii	";w\214\3673\3057\033\017\246\3236%P$Q<\322\204\261)\324@\217"
+	.ascii	"k\201P\316\250\311N\214\2135\3237\205\241cz Q\3019\227\314\221"
+	.ascii	"\231\326\331R\226\275.\305\rA\022-=3\252\207j\244\326GG\342\241"
+	.ascii	"\374'\336\353\310\251a\367\004\207s\363Z\366\251\277\271g\320"
+	.ascii	"\270i\322\260\275*}\233\3607\335\341\314.\033\267\215\367\363"
+	.ascii	"\304\367\333\226\274@\260\021I?Iy\036\347\n\337\263H)u\335\270"
+	.ascii	"oZg7Y\366j\002l\004\023\337sM\002\257\220\216\231\227\351O\026"
+	.ascii	"\2579\021\017\345\002F\030Z~\001LB\260\nw]\234r&"
+	.string	"p\016\031\020\315\017\272\311'i\362m\347k\3151\245V\262\354\025\311\031\035\2224B\312P\350f\026eJ\364\320\226\352|2\364T\210\030\f1A\273\243\204\204\020\017e\t\360\034}\337\265\227q0\350\004\217\0335\036\245\217~\371\3037\316.%~\304\037\275\220\036g\bF_\342\212\033\247\005\377\034\004wN\347a\027\320\323\\;\275\347\367\276_U\334\212\313\002\036W\217\367\323\325\303\366j\364-\370\207W\364#\226\034\352\356\211\341\307.\325\251\270}Z\364\312~\346h.\241[mrq\261\275\026}\213\351U0\032G\n\002\003:` \2242\334\273\212en\2025\303\274\237\312\357\277\267'H]\354\330}\020\361?\302\005\"\276Y\240\303SE\216\007\"#\321w\335[\023\276%p\310\344\t=i&9\302\240u\366\273\354u\250l\350\231\321=\352\022W\241W\207\020\377\037,\t\361\215fO\204\017\350p"
+	.string	"\261\202\370\256\233R\337\315o\214^\320\007\327\240*\310\311\272\212\365\360\037~\035\023\266\201/\251j=\003\017\017$z\206\212\347\344\r\306\2254\307\2164h\235H\226\275\n\201\371\005C\220DB\317\214\236\221N\273\274\312|\362e\331\320\341\377\214\203\016\337gz\217\364L\227\006\016\305\346<\226\303#\355\364\224\241\006~=\327\327\301\243\366\225\301\257\271\373\374+:\247\227\247\353\340Q\003\303\340\344\033\276\353\274\253\331\201\222\225\367u\366\263\371\244uB\260dnFiJ\361~\262\322\371\\\036tuH\322\357}_\026\334\205\256\223&\232\221\025,\025\260\275\006}q\332E@\267\320"
+	.ascii	"\237\356\323\2046\2534\323\322\330^7"
+	.string	"|\021\257kP\303CE\277H\371\\x(ws\2346\026\204\t\234\244LR&)\223\224J#[Y\375\230R\302P\"\331F\016\252\033>\256\256p\364\220\342\201\344\002x\324\360\341#*"
+	.string	"\345"
+	.ascii	"WVH\256Q\203\307\024\215\250\0327\212<\300U\016%\215\034QVJ#"
+	.ascii	"\027\340\203\312*\352\307\016eU\016*\253\037\036\340\312JI\325"
+	.ascii	"\243"
+	.string	"\007\217\"\023Y\201\022\312\033R9~DY\031Y\007\225\325\224\362F\217(\036RG\2561\025\325CiE\0255e\344\255\022\317\f0m1p$HVS\021#YYF\204|\330\032\022\204\310\002+\326\221 GzL\240\205u\344H\220\004\220[?\260\262\032\360q\244\b\226\226\026\022!?D\026\302\264u\244\bV\026\026\021,\004\024\3302\322T\244\201 YMB\264\266\232\230\210\330\310\003XZMG\214\030\321j:\302u\365\360}*<\243\353\275\206\357\373\276/~\r\317\262W\035Q\035\317\354\002\206jl#$\204\272\372_\363\340J\205\0327@\0279\206\315yl\216\357:9\035@\331\003+|\002\001\316\262W\034_\005\3073\245U\352\024K\032g\213\207\262\325W}\021\264\207\272t\217\366T\\h\0257-\215\355\325\352\001\270R\365\315B\034B>\257\347\342\343\2305LX\270YX\001\376\347\216"
+	.string	"O\034#\301\304\t\226\025\017\345\317\240IL\345\376z\210\245z\022Q\250\276\357\322X\216\235s\314\351\206R\337\350#\345\331\346K\205\r'\035L\275\215&L\246\036\210t\317\006h\226\275\326\370\261\032\317\224\356\221\022\245{\372\2304\036\311\307\215\322x6o\212\327s\271\321\337\222i\212\207r\017\261\035vT\353\036b\245\276\303>\311+q\265lq\271pa{\225\372\236\373c;b\232\240\200\"\2006\200\357\2728i\372\203/zo\232\242>\354\2353>\352\277\336k\306\003\221\332y.\227\004W\332:\373n\331+"
+	.string	"\205"
+	.ascii	"<Sj\347\207\260\214\033\246\356\302\203T3.K2\\\306#Mh+\323\""
+	.ascii	"\304\245\205Q\212A\035\204\3611\004\365\300x lu\360\304-{}\021"
+	.ascii	"\370\342\231l\200TVS\365\340\202\023K\326\201\357\271n\373\344"
+	.ascii	"\344\300\365"
+	.string	"\222\205z\007\236=\254\314\3478\035\267\315\365\342\276\275\261\275B=\021\r\214\237\231\227\262.\257\216\225 \006/\311\305\237\337\323\273\200\363\346\351\201\260\215q\323\034;\"a\331k\013\276\026\317d\033#\275\340F/j\342\241\354=\001+\344\177:Ff\006\016\211\305\022\213\357\272\276-|gP4\256\345\n5i\234~\005\032=\247\007\302\006&\005\267\004\271\326\331i\313^U\234\240\"\201\376\250a<\343\024ddDDDD\222$Ic\361\005\204\030\246\324Y\035\021\3000\247,:\222\230T2\034I.P\315\325\277\026\234\323\3275_=Y\216\305\252\317\207\261a\022v\225V\352\367/jm\r\227\241\020f\345\212\350\371B\274}\220\307Yr\373\211\001\305\315A*\235\251d~\203\376\276{Bz\257B\316}\360th\fQ!Y\231Xht+w\233\340\362J\275%\266\274O\017@x\201\201\317\244\260\327\205"
+	.string	"\037\264]7\371\256\372A}#D\330g(Nu\023Yw\251F\fs\320&\331\210K\347\210\247\346\3206i\335Z??I_+\210I\334\343w\256\346\036{\304\375I\245\277\353\375\313pod\315;\310\334 <yv\325\017\352;\324'\376K|*\237\362\245\316?5\320\340\331\013q\235\342\0238\337N5\313\227\215\252\037\244\276\250\316\240\376\371\377N5\330HR\261\223\364\303\361b\266{\200\254x6qu\227\357\252\037\324\327 \027\375W\371\241:!\234f\315\255"
+	.string	"6j\r\216&!\310\r\374d\243\236\363\177\275\206u\374I\f,\277\212\372\ty!; \226\344\030_N\215\221\032@\026\311\227\034\214\327/\323\332VbrT\226\345\344L[\255KW\352\0023H;Z\bi6\030\034\n\214\246j]J}\031T\326\227\327a\341\0019\037\204\013F\211\354\034\331\\\f\361\216\331\244\023C\001V\037~\335\304r\210l9\234\023\330\313&+\006\356\007\227\210"
+	.string	"\257u\306/\323\375\2229Oyt\330%\2707\250"
+	.string	"\330\325P\252c\316\024\366\333\240\2406\200\355\363\\w\017f\230\305OEE\376Uck8\t\tj\001\274l3v\261s\3130\234\251d\340+\277\335\201\253\257\373[\271\241\034\371\204h\n\304\177\217\266\376\233fsB0+\220\221_lb\3443_(\204\215T\315\024\2076\356\251\034xY\b\275\214h\306\204\347d\314\005\327C2 \265\005\270\0234Y\254\314\235~|R|z\242\357\224#$\200\247\365\244\350 Q\030H@H\356n\234\b\244\f\004a\326\344\211\200\314\200@\260\235x\t\205\203\301\303\260\033@aH%\220\210\f\r\222m\353\255!\361\333\251\215\224+ \277k\306\220\005\315r\301\374\223W\026\221\221\314\333\246\254\262w\3529ze~\275i\230<\255NI\035\337G"
+	.string	"]- \367\211\334\344\021Uy\037p(\234\336\300\"-:\325\315\001\177\200L\211\250W\037*\364\003K\203Ms\304\033=\327:\366\351\345\017\353\374\374h\245~\324\375a\360\376\256\362\365\026\256\300\240H\340\307\352\331"
+	.ascii	"\200\206B\320XC\206%$T,\034\005tw\206<\241\"\355\007\264\350"
+	.ascii	"\t<\207\272\3236\fS\002\335\222\274\225\261's\210Q\211\rj.\246"
+	.ascii	"N%\252\372\334\251\360\360+D\203\346\200\033\005l\250d\266\201"
+	.ascii	"\34440\201!\026\272\0164G\301\033\327\034\346l\321B$\214\022"
+	.ascii	"\342\306R\242Z\213C\263\032\377Fo,]\3752z\202\304\3053:\310\322"
+	.ascii	"\024!\314q\272y!\251>\244ut*\326\300\201\033zMLM7\317&\376\374"
+	.ascii	"\340c\035\263\331i1T\223\022!\211\260P\363\346\346D\362\330\231"
+	.ascii	"\343\275\006\016\016\245F\367\226\321\3605[G\033\0332\210\335"
+	.ascii	"\021\300\355\301\026\373cWS\001"
+	.text
+	.section	.gnu.lto_osdElementDisplayOrder.185.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"+\001"
+	.ascii	"\002\004\005\006%\007\t\n\013\f\b\017\020\021\022\023\024\025"
+	.ascii	"\026\031\032\033\034\035 !\"),+-2&'.014568"
+	.text
+	.section	.gnu.lto_osdElementDrawFunction.186.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\004\004-\025"
+	.string	"\266\345\215E`^N:\3619\2617\361\361\350\261\342o>\247\237\013\307\230\272\335q\234\222\343\224\034\3523\370^\270\342\231\312\347"
+	.string	"H{\276\032?\347\023\267\202\361!\216\017q\234oa\177_k\036t\231\250f9\341\210d\"\001~"
+	.string	"\202"
+	.string	"x"
+	.string	"\367\254R\210\321W\027\255\202\214\036\336\264j!\252\017v\325.H5z\327R\fS]\274l5\003\260\321\213\324@\243\237n[\272\201\252\233\334\216I5\272)y\344P\325\302\253\254J\301Fo\\\357F\017\357\\\355\320u\227\251\007b\337\353\322}\300\321\350e\326\245\034\215u\355R&\035]\274w5\304\216Fo3\025\361#\242\017\235<:\310\350\346i\2755\215\306\254s}\350L:O!\264B\253\254\001\262\264Oy,\322\322\250\225K\005li\337\334\327"
+	.string	".\re\227\004\272\264oy,\340\245\177\226.5`\033\3122\353\001\261\026Z\246Q\217\365\317\326U\004$\332\311\326\245\tJ\364\225\265\253G&\372g\355\024\234\350\242\275\253\013P\264\257\371\305 E?\331f\003\025\355d\361\034\fm\240\364\301\212\026\332\274\n\201E_]\262\032\241E7\221\035\221\\\364\357\226\245\022^4\3245\253\023`4V\347\363>g\276\356v\277{z?\377s@o\036\357\201\236\307F\356\301Y\254\305>\370\007\003\341 \274\305B\230\213\2070\021.\302F\370\b\023w1\022\366\342$\254\204\2270\023n\302_\354\204\301\370\tCY\3420\020\035Ft4ne\2158;J\013-\262Ji,\213LyJ\013m[\020\225~\227u\023\252\322E\233\254C\276$\221\225F-\\\005p\245\237,\034\226\016\347\224\022\021\265\002V\001m"
+	.ascii	"\243f\020\203=+*\251\252\336\324\220\330SB:\203B\340\260\207"
+	.ascii	"\006\203\303^\321y\373{\261\177\371\330\301<\314\305|\314\311"
+	.ascii	"^v\263\237\235\314\313\334\314\317\034\355iG\3634W\3635g\363"
+	.ascii	"6W\373\332\335\234\355\307\2779\234\307\271\234#\337v\267\317"
+	.ascii	"9\235\277\275\316\223\207\273\362q\267\363;\307\363<\227\373"
+	.ascii	"\334\227\247\273\236\357\te\250!|\" \026\267?\333\001P\203\204"
+	.ascii	"\342\214\001\020\020bi\017\365\031\250 .{\350\357\004\b\216z"
+	.ascii	"\235\374x\241\235\263\264c\363\243`k\352\0304\023\333\243\"\204"
+	.ascii	"eb\372\023U\357\300\353\360\344\251wa\256\314\367\252e\307\251"
+	.ascii	"Q+\221 *\036\001a\003/M\023\245:f\340\030\304pBA\001R\025h\360"
+	.ascii	"\312'R\205\346\231\001"
+	.text
+	.section	.gnu.lto_osdElementStaticInputs.187.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375 \370\365\006"
+	.string	"2M16Pm\222\016\260\246\214\201\300\f\t\267t\326<\313v{\nS\330\271\332\360\371v7\230\262+\2469a\251\r@fA#\212\210O\334\200\337iH\331\320h\255\021\"S\330\365\351Ps6\333\307sa\327\303\305\340\260e\321\323i\300\"G\333\342\006s\006qi\361\223eZ\274tY\316\312\210\240\304w\241\0075\276Tf\3460\343\037\346D\244\242\247\222L\212\026\2264\251H8~\320_~\370\376"
+	.string	"\001\324\217\210a&\006\312Hf\247Y\023\320\352\277\035\365"
+	.string	"\315-L\210L\004+\027\243\020\225\314.f:`\265\242*`\265\202\033\345\372\270[\220*\214N)\244R\250\017 !3\177\244\222\251\303\376\005\277\301o\021\b"
+	.ascii	"\357b\310\f\r\214\034\025 \253\200\352\232\177\350\020\306tM"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_osdElementAltitudeInputs.188.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\005\013"
+	.string	"\006\225MD\020\3118\035\007x\216`&\341\234\255\273\263\237\315\336\360\311\t\3725\020\210\350\236|\200k@\251\352\016\355Qcw\237\302o\020T\\\353\203"
+	.string	""
+	.string	"H-\002\"\234\031[\371\357CkQ\026\364\263\237\264-\245L\001;"
+	.string	"="
+	.string	"5"
+	.string	"*\241i65B\323\214_4\324\311\033^A\016\274 \214\244\250SC\256(O\212\230\007-\017$jr\020\270$\350"
+	.string	"]\025y\332\315ht\367w$W\372L\377o\374\267\370\025\"s\257\r\234\t(*\372R\320\235\022\303\320\0212\0060\377K\377\346?\357\177\201QR\001%\347n\026\330\202\356\322s\317\246\331\377+"
+	.string	"\rPz\310abZU\\p\245\nT\350.\271N\033\273f\177\357[\035\227\265\201*\205\004\006N\370$\232\262\003\214"
+	.string	"\f\265\026\236\331\037\034Y\035\2253\\N,\376\245\270\334\372uvw\237Y\377\367\333\367\314\373\r^G\n\315\203> I\324y]H\327\361\001~\234(\344\341q\240\021\310}8\377D\272\021G\372\276\021\267)['\263\276\273i\2501\253\3763wL|\232/\305\311-\336x\302A*\203)\017"
+	.ascii	"\3571\316\020\331u\245\0176\fe\027\314`\r1@\b\02055.\276\020"
+	.ascii	"^\271\006\242\211\211\023\363d\215V\355\001"
+	.text
+	.section	.gnu.lto_osdElementAverageCellVoltageInputs.189.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\225\007"
+	.string	"2\01765Pm\323\001\203\213d\247`\220\212\231\335\332\233\035m\366D\213;W\251\373\244\021\234kG\224.\237\265\001\310,hD\021\361\327\013Q\327\223n\332\261vo\271S\n\324\204u\2429\233\013\363L\324\3440-4\\\325\364t\030\250\311\261\256\271\311\270z\230\254\211U\22551\337\336Q%N?\276F}\267\302\301\221/\320\276 \340\275\253\364\321\315\3766\250\027\366\343\252\205m\350\030\241/3(!\024/\031\355N\214D{\"I4lg6\306\266B\333\340 \273G\204u\267B4\262\373i\254\001\270\264\355s\274#\263\246 \301\205\006T2:\220\224\335oJ\027\260\\\306\007X.\025\343\332\241\346\377\343\t\235\211\210\007\332\016/\b\273k\350\201B\267\3366\201\355\002\333\033\001\b"
+	.ascii	"\357b\310\f\rF\030\b\367\271\206\307a\361\017\035\302\230\256"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_osdElementCurrentDrawInputs.190.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\245\007"
+	.string	"\242\01775Pm\323\001\263\226&\204\006(#\331\255\321m\331\356\237Qc\256P\251\373\244\021\374\036\035Q\272|\326\006 \263\240\021E\304_/D]O\272i3\204l\271S\n\025\225m\2445\031,\343P\025\365@18`\326\344l\032\252\251\271\260\231\271\330\202\240\256\231Y\3265-\340^\256\202\244N\235v|\225zo\245\213\241\245hGH\304\177\327\251\243\234\rrQ3\354\313\335]+\310v\264\324\350G\227\223\212\213\217\230\354Z\204*K\022\211l\330\326l\213m\215\366\001\202v\217\t\353.FI\310.\2101&\340\221m\277\343!\315\333\002E\367!H\ty (\273\340\234> =\222\027\220\036\251\306\267\307\315\377\307\025\274\221\360\363p\217"
+	.string	"\t\273\353\370y>\267\336v\201m\003\333\034\001\007"
+	.ascii	"\357b\310\304\323}\264\022L u\215~\350\020\321t\315'"
+	.text
+	.section	.gnu.lto_osdElementDisarmedInputs.191.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\275\b"
+	.string	"&\321=7P\215\322\001\263\006\330\\\346R\327\242\315\021\224\336\322{\360K\366\360\356=\375[}\375\336\022\262\222\246D\344\200\030$Q\004D\374\2763j\017Ae+\032do\271S\n."
+	.string	"0"
+	.string	"*"
+	.string	"\005)\037&\017\224\335of>\200]\306\013`\227\312\272\350P\344\277u\006\226\313\344\204\032\035\002(\354\256\341\t\225\272\365\266\rl\037\330v\005\022s\002Bq\327\310\356\304KeI\244\b\206\355\220}\261\255\320FH\b}\003d\335\255(\t\331\3754\326\004\\\332\3663\256\021\262hA\202\224\n'\300\256Q\rM\252\3229\336\001\362/\334}\340O\227\376\007\273\274ZT$\370\262\277\021T\013\373queG\350hh\215\320\017Z\346u\2429\233\316\363dZ\006\2215<t\333\364t\034\264\311\341\272\271\301x\213\310\270\351m\0337/\337^W\326\fIK\216\252\372\326-\246\225\007\n"
+	.ascii	"\3571r\026\332\025\2231L,R\305\217P\341\271\206Wb\361\017\035"
+	.ascii	"\302\230\256I\006"
+	.text
+	.section	.gnu.lto_osdElementFlymodeInputs.192.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\345\013"
+	.string	"fXT@\020q\224\016\303\303"
+	.string	"@-\313E\356q\344P\240\301\200\226{@\fH\201\373r\005%\n\332^\377\033P\236\005\223o\201m\005"
+	.string	""
+	.string	"E\212 eE0\264\002\211\347-\2276\354\227\374\275I\222)\005E"
+	.string	":"
+	.string	"A"
+	.string	"\271A\206\212L\023HA,\273\266\265\b\217"
+	.string	"5\304\240\302\310\244\200\215\026\245\224\032\231\246\353\303\003\236]e\001\317\356\035\0342\206j\227\260\005\003\305\311\305V\"2V\026dfq+1q\357\266\007\332\"h=\022\255\253\314\314\036\245-6s\354\345X\313\261\226\303V\216}\307\272c+\207\375\261Xa\335\241\241a\001\203O)2/\244P\371\302\255"
+	.string	"\321\026\324b\332\036\333\004\n@&1\241\317\027\325\035\377\376\030\245\f"
+	.string	"\\\026\257\272\273G\n\t\212\204\251\376\025\007\0320\347\265\020:\350\355\007\235P\270\250>\336\245\0336\341\023Y\375\241\0224\364fWk\317\316\327x\3200\302Tk\022\3419\004\035\354\303\251\272\t\321>\"X\007\213\2005x\240e\227\b\307A\347\332x\264+D\323l\004\363\\\237,\363\\\030S\272\312\243d\3761:\251\227g,\177\277\334cF"
+	.string	"\353\226\0238\221\240*\267:\260\335`\350\255\362\027\342\204\024\017"
+	.string	"\357b\310\304\243\243h>4\364\246\b\203a_Et\032\034_\240\214f\270"
+	.ascii	"\312\032\352\222\3105\361\324!\316\353\232d"
+	.text
+	.section	.gnu.lto_osdElementMahDrawnInputs.193.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\255\007"
+	.string	"b\21765PO\323\001\203\233\232\301\245jU\275\232\003\247\320@\nG\035\\Y\214k\244\0216>M\306v\306F\372\334\214-@ \"\263\271G\0226\234\317U[\333r\247\024\025\225q\2447\032,\353P\025\365@18`\326\354p\032\252\271\271\260\251\301\330\202\240\256\231Y\3265/\340^\256\206\244N\235z|\225z\257\245\213\241\245hGH\304\177\327\311\243\234\rrQ1\354\313\325\220\355h\251\321\2170*!\026/\tw+B\226=\211H4lk\366\305\266F\373"
+	.string	"A\273\307\204u\367\002ed\027\3148\023\360\310\266\317\361\016\315\333\002E\007\"X1\361@Rv\3019}@z$/ =\322\214o\217\233\377\217+x&\"\337\207{\004H\330]\307\357\003\272\365\266\013l\033\330\336\b\b"
+	.ascii	"\357b\310\304\323}\264\022L \256\211qX\220\207\016\021M\327|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_osdElementMainBatteryVoltageInputs.194.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\235\t"
+	.string	"\026SC9@\305(\035\005\323}6\323\007\272\275\337p\205"
+	.string	"V\205\341\030\034\211X\343\3421o\353\2653\262\366\3218z\032\262\"\274y\nz\221\031\210X'\346\356\321\204\032\331;I\231\0026"
+	.string	"1"
+	.string	"/"
+	.string	"#$\227\032,N,\203"
+	.string	"+)\027\200]O\333dA\226\021&A\226\361\037YJ-9\263$\035L^\237jeJ\2750\354\256U\265b\245\237\266\017l#\3309\020P\r\257\376\325\n\325\231\321\30404\362\305\262\233\361\301V%\242\200\330&\331\031\333W;A\201\224$\025\376.\007\354d\327\343\230\023\220\321\266S$\003\034|\206\b\244S2\375\017]\0270\224~\316\3533\025;\351\347\213\332\035\205\246*\277\320\201\272\311\366Lz\017;\341\276e[\215\271:\273:\006\240m\364\201\366t\272Qh\003m\022\333CD\307i\241\017\004H\363\210:\255\24317\261\211\264\021\307\211\264\214\267\t\367-\3147\247\243\234\035\023\377g\207-\251\r\370\030\r"
+	.string	"\357b\310\304\263\240h\340\017]\t\204@0\200oTF"
+	.ascii	"\252\006]\310Kd\006\017\035\354\230\332I\006"
+	.text
+	.section	.gnu.lto_osdElementRssiInputs.195.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\245\007"
+	.string	"bO65Pm\323\001\223\210\342\206@"
+	.string	"\bj\253\372\025Qt\375\214\032s\245R\367I#8\327\216(]>k\003\220Y\320\210\"\342\257\027\242\256'\335\264c\266m\271S\n\324\204q\2447\232\013\353L\324\3440-4\\\325\354p\030\250\271\261\256\251\301\270z\230\254\211U\2255/\337^\256\206\244J\234z|\225\372.\205\213\241-\321\276 \342\275\253\344\321\315\376\266\250\026\366\345j\310v\264\224\321\2170\341\007\305Apw\"D\331\221(\004\303vf_lk\264\r\016\262sDXw+D@v\277\2143"
+	.string	"\217l\373\032\337\310\254)Hp\240\201\023\223\316\243d\367\233\322\005*\217\344\003*\217\364\342\332\243\346\277\343\t\035H\342}\266G\013\302\356:z\037\320\255\267M`\273\300vF\b"
+	.ascii	"\357b\310\304\323}\264\022L \256\211qX\220\207\016\021M\327|"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_osdElementThrottlePositionInputs.196.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\255\007"
+	.string	"\242O76@o\323\001Cqv\020\241\005T\367\031e\210\3736\300\027\214\231\342\025\201\337\032\3411&:\372:\272\331\205\313\n#|\b\305\212P\260\332\202\217\036\366\357-wJ\001\025\225u\2429\033,\363P\025\005A5<`\326\364t\034\252\311\271\260\271\031\260\025A]3\263\254kf\276}\\\035E\235:\375\370\032\365^K\007K\306@\033\223\200\007]\247\217r\366\307A\335\260\037ww\255#\333\3201B_\022hX`\234D\262{QZY\024i\322a[\2633\266\025\332\b\t\332C&\254\273\031*%\273\237\306\032\200K\333\376\307A4o\f\024\235\250\200\245\302\033I\331\375\346t\201\313e|\300\345R9\276\035n\376E\276\340\221N@!\356\020\243\260\273\206\240\220\350\326\3336\260}`\333#\007"
+	.ascii	"\357b\310\304\323}\264\022L u\215~\350\020\321t\315'"
+	.text
+	.section	.gnu.lto_osdElementTimerInputs.197.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\323\002\305\026"
+	.string	"\226\354\227F\260\030U:A2\276\217\tB\203i\303\"\246k\363\241\234\266\377\322\025\334q\333\352\247V\264\344\243\006\333\326\345\377\231\276\213\265\305\375\025!\360\347\364\307yIxA\361\230\344\2208n\r\022\254\332\333\311\337\233\310\235R\205"
+	.string	"{"
+	.string	"\203"
+	.string	"\263\373\304^u\365\264\036 N\005\3613\200\364G\331\353M=\n-@\030Wj\035\031|\372\301J\373\001\204\331s\324xk\3459!R\353\330\300\r\304O\333\376\215\343\230\331F\303\211\332M\002\340\212\234OK\255c\nu\002\3643\374"
+	.string	"\372\271:\267\371\fW\332\3701\271\240,\272\035\355S\024\324$\274\357\030t\202z\350v/\276\266\023\224"
+	.ascii	"\317o\006iw[)\262Pk\265\324\355nnz\333\036l_\260WA\021|\374\207"
+	.ascii	"\b\237\306\247W#\344u\237\376"
+	.string	"\b\372i\332\002;@5\367\217\312\335=\216g\223A\303\254\334\003:Tz\344\206j2h\2176\2719\3667\030\fn\361\306\260-}\272\317mz\216\037\206J\277|\274K\2424I\224\036\215\244EQZ$JS\221\364\244\322\341J\357JK*}\00113\252\270\370\224`\255,\202]\352\223\tT\343\343\357si\317|\035\367\271\264\343<\002r\256\375\001\204\274\216.\352\2664\177g\206\\P\026\323c\324\264_\321\211\334\026\302\371\363s\001z\022n\216\221\243h\022x\236\037\017\222\335\034\037\361\177\026\022%\257\247\366\212\370@\026\242 D\311/C?\245\256.\370\020\333Bb\255\264\363l[\350\357U\340NO\355\325\005\237/{\337\031\364nr\310\246\313\320p_\3262\207\023\2326\\\030)T\222\340\206l\266\211\007\211\245$\3303\007\242\222\231R\353-.\025k\005\233\257\r4\255\025,F\242\365R\271"
+	.ascii	"\260T\260U\350\031\007/\030\215\212\245\"\241\372\020\342\325"
+	.ascii	"J\321\254@\260R3\256W\312\001\002\267J\250\\)X\253\345J\225\306"
+	.ascii	"\332\303\2721l\372\311\b'\334\306\313\250\311\b\226\245*z\227"
+	.ascii	"Q\003,\214\374H\377\264\270\214\2266\205\355\323\242jk3iE{Z\021"
+	.ascii	"\024\034/f\264\244=\256\213\270\243}n\250\366%gR\343\3230\207"
+	.ascii	"\016\362\272\016\364S\334G\331\301)-]\321N+8\033\2471 P\0021"
+	.ascii	"\f\326n\317\030\016-^\036M\354Bx\031\246;8\253B\201=\320\201"
+	.ascii	"R\017VN _4g\314U\n\304\032\t\242\035\212\366\006\037\345\342"
+	.ascii	"w\354\333,\271\270+Lt\342\310\263\334J\021\200!c^\255j\212\013"
+	.ascii	"\031\025bRxO\303\370\342c\206K\330\360\252\035\003\260\020=@"
+	.ascii	"4\275\237\234mw\220\346\005xL\374$\324\216\260\204\223H\310\267"
+	.ascii	"\313\324\023"
+	.text
+	.section	.gnu.lto_osdElementInputsFunction.198.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"m\b"
+	.string	"$\rC\001"
+	.string	""
+	.string	","
+	.string	"\005\001\212\001\202\200\200\374\342\203\354\276\024\003\177}"
+	.string	"\005\001\006\025\0012\370\347\276\\\177{\035\270\347\276|\177y\026\370\346\276\\\177w\017\270\346\276^\177u\f\370\345\276t\177s\013\230\345>\177q\t\370\344\276p\270\344\276Z\177o\007\370\337\276t\177m\006\230\337>\005\370\336\006\025\001\002\336\276~\177k\370\335\276p\177i"
+	.string	"?\202\210\200\360\001g3\323\0014\322\001\321\001\320\001\317\001\316\001\315\001\314\001\313\001\312\0015\311\001\310\001\307\001\306\001\305\001\304\001\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/osd_elements.c"
+	.string	"\032"
+	.string	"\337\036\"\030DKA\b\0232\202\314l\022\007\262"
+	.ascii	"\243@\2760\205\260\003\016\323\b\3345\003V\220\031\030\020d\001"
+	.ascii	"F\201|\301(\220/\030\005\362\2759J\235\271\r\240\b"
+	.text
+	.section	.gnu.lto_osdElementRefresh.199.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`4\002m\t"
+	.string	"b\r0. {\335\257(\365\212R\257(\365V\3154\217\177\030"
+	.string	"\030"
+	.string	"\030@\341H\005\020\004\020\004\020\b"
+	.ascii	"\252\231B\037\316p\372\027\342ewo\332\001\262$K\232<\2112\245"
+	.ascii	"\312\225,[\272|\t3\246\314\2314k\332\274\2113\247\316\235<{\372"
+	.ascii	"\374\t4\250\320\241E\215\036E\232T\351R\246M\235>\205\032U\352"
+	.ascii	"T\252U\255^\305\232U\353V\256]\273^\277\202\r+v\214\243\346\233"
+	.ascii	"\321j\001=\001\242\201\037\216\240\240g\320\313\035 \374\022"
+	.ascii	"\026\210\266048<@DHL\374hX\024\025\026\027\030\273\214\036\257"
+	.ascii	"o\006\300\2441wk+\302;\322\341\201\373\b\001\331h[\241\356\326"
+	.ascii	"&+\223\321t\0019 @#!\3161I I\356X\302\\\316\206\230A\36230.\207"
+	.ascii	"\3031'r\322u`\026\\\f'\316\002\333\024,\311\341\316\371lS\330"
+	.ascii	"A\200Q%-{0\211\305\006\305%,\223\334\006.\347\332\2418\211\301"
+	.ascii	" \2142r6\006\355\232\327m/\374c\333Ma\360\266\202y\222\333\006"
+	.ascii	"\274\334\203P\227\304\341\003u\313\245\261U\004"
+	.text
+	.section	.gnu.lto_osdAddActiveElement.200.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"\245\013"
+	.string	"6\226O?0O\233\016h\200\207\231\017\220q\025\252H\037e\264\005~\300Lw\320\r\360\304,/B\351m\343V\360\337\373\367\263>O\265\207\245 F\\\353!\\\363\247\346&\202=\367\321F\332\336R\246\024<"
+	.string	";"
+	.string	"="
+	.string	"\003\246Go6\214\002\025\226\273\2248h\240\210\261\273\226~\370v\250\271\371\024\246\362>\356P\262\341\032\340\353 ew\337\361\264\360\2152)\314\356:\275/\303\035o\233\201\355\213\375\005\001\036\354\303\335]\353\206}\216\237\202i\250i\315tV\007^\\\320p\221\024\273\030J36$\202\210\230\330~\332\037q\022\3339(\270\332\355\320\342c\227TqE\362H9\201\351\021>)b"
+	.string	"\251jC\330\344=\250\224N9\247\252^\205\306\210\355\371\211\b\027\0056v\217\f\001\210\335.A\211\233\220\340\207x\264\026\312{\217~hzL\375G\307\n\031 \242,\331\244Qj\240\316\205]\234\213\262\306\242\201:\027vq\256\006\017\264\314\352l2\230\245\371h\226\305\2003\317\365\261@Y\366\261&$\321u\303\325\b\213\020\221\216 \024\220\224\332\031M\3363T.\325\023&\250\016<\\t\001\025"
+	.ascii	"\357b\314\204&|\223\265\n\003w\300X\241Z\005\"\020\367G\260\262"
+	.ascii	",\310\020n{\261o\233\366\r\030p\t\201XM\001\356\0220\340P\223"
+	.ascii	"\267\253\224\001"
+	.text
+	.section	.gnu.lto_osdAnalyzeActiveElements.201.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`J\003e\026"
+	.string	"\366h\217J\300\020)\035\342\212\002\210\r\312\370\344\331\374\323\305\310\275.\032d\377\344\372#\027z\374\257\222@?f\247\202\360\257\331\351_\t\276\215\360=\356\003\320D\356\207\261m\205\303\266\335\tC\277`\346\250x\237+j\377\267\275\211\224I\006{"
+	.string	"v"
+	.string	"x"
+	.ascii	"\227\321\317\361\001\350\347a\253\333\215:\351S?J!\337\211\033"
+	.ascii	"\265\326Zw\330\222\217\344\367\305\272\273Z\254\327\244\315\272"
+	.ascii	"=\321]?\340\356\256\221\r9:o]\006\216\316H\b\034\r\314\032/d"
+	.ascii	"\325\024\003\372F\003G4?'i\370u\0169;\237\254\223Z+\357\234f"
+	.ascii	"x\217$RL6b\300\232Qv\343\341w\242\263\rp\206\231uRk]\376\001"
+	.ascii	"s\276\260\357.\210\3355\331\355\224\275\333_\206\356\217\216"
+	.ascii	"B\206B.G?q\303\030$N\243{\0237\242"
+	.string	"\355\201\266B\f\377\367\271\217\241\237,\0218h\360\b\247x\\\356\222;\356\340\356aJ,\202\266{vA\350\207\337y\336\261y\233y\371\274\037p\200h4\203X\016\365\023Yo\312\253\3524\213\037>\374\356\205{ra/\361\"\335\207\264Y\217\254\300\327\323\225\224\360F\255d\311\347\022h}\316\002\tF\005(\024\205~r\277i\370TU\344q\331SA?\305\331\301e>\361'\177\fJUQ}\342i\333\354\251\214I\312\0132\3563\240\273\r\0340Ri\241\241\250|\335\301\225\241\357\007FP=\266Z\017\346\247\320]\225\225>R\tt\352\365n;\030\300\027\006-\371\205Oj\211\371\324\312\373o\237\342*\"\354\201>\227\245\245\205~\356\272\334\370\277e%\252\245*\251\232,\337\025\223\034\314\213\315\305&\301\226\002!w\253\275\260\250\270\324Vp\271\232I\310\336&\330p5\230\333\rW\203\221\365\335\263"
+	.string	"\210S%\305\353\231u\325V\204\024E\226\004\024}\b;\206bB\255\0162}\234\215}\242{ \225#\234X\035\334\223\257YM\220\336\221\322\236m\363\032\377\307Zk}u\3604:\033\244E\236\256\250jxf\270\354\031w\367\223|9x\\\302\374\005\202V\255\275\002\373\026w\021A\250AX\005\211@\004d\204\302\241\300\202$\017\220\002!*:\017\020@\250lR\220\007\217\240\230\371\231\026y\212B\035\205\334\250\002x@\356\013IzA\277\341\214#3Y\227f\365p6\301X8\t\326\231\2571\223J\230<\302\271Cf\237\007\001@\033\310\260\261\017\304\303\323T\250\203WYq"
+	.ascii	"a-!\246\264\320R@\354f\036\250\2212\264V\252\342I\2053\355x\353"
+	.ascii	"\241\200P\303\016\005\334\202\201\n\343\263\224?\360\273>\345"
+	.ascii	"\303*"
+	.text
+	.section	.gnu.lto_osdHashText.202.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`m\001M\017"
+	.string	"\346\235hD"
+	.string	"\221(\035{m\362\032\363\"\"\314\026\235\372\304\316\r\342\007\235\013\177\353\312\336\315\377O7\233\265o_m:3\262\227\251e\3400\245\bC\322\177/W0\260\031S&g\021\020\325\215K\303\204\220\275\245L)U"
+	.string	"P"
+	.string	"V"
+	.string	"Oy\t\217\275\b\241\317)\001\370\215\\2\346\f\267\003/\200]\306o`\227\213\342\250\336e\\\365\374\254Tj1\201%\2271\013\235|\b"
+	.string	"\206\242G\314\013\313[\327\017\004i\f\221\372\276u\b-H/\023\230\272f\016\346\234V\023x\272\261\333\346l7\260\257\022\266&\363\360\327\262\2077&\3252\252cT\357\252\365\254\373"
+	.string	"\020px\221:\211\305\234'/\032\323E\262\2008\353\267=~\313\032\237\345}\236\346I3@\223\2279C\005\227f\240\251\3327\361\023\236\207$\0370\247JE\2129C\016sh\227\016\265\035&\367\201\013\f\032c_\205\323i\036|\022\354RnV\"\275>\r\2378\347\234qW\266\265\tB\335\303\342j\3660\"\021\331\356\306U\230Q\006\335\335\313\325]\327\250\306G_^pl3\273\201\242\264\"\032\001\322\327\256\264\204\300\335\225\035\226\250G\207\230\027\257*!\335GH\354\\\340:\321 \035]g\204\023\341*p\022&t\233m\204\302\207\310\006\302\351\266\016\003\336X\3408[g\263\341l\232p~Uv\214\331~\277\375\212\r$\\>\013\222\2732\001\224h5+\340\004\302P\215\024#\305u\017\313\366{\353G9\241L6\263\216\252-\266\237\003\033"
+	.ascii	"\3571\272\020\255\350Q$\254t\322JC\332\003D\327\002\265\2208"
+	.ascii	"\246u\245\254\376e\006\314\243\240\211\0269\020Wf\224\351\th"
+	.ascii	"\376`@\241\232O\235\203vHI\230S\341\3416=Us@=b\022\346\023"
+	.text
+	.section	.gnu.lto_osdDrawSingleElement.203.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`>\023]X"
+	.string	"z\222\300 N RR\352k\264=\346\273\346\364\360\361\346\250\310\b?b\312\020T\256\007\370\346\207\205#\215\276\3536\222\377v\300g|\201\020\f.X\305`5\002\020\001\210\tp"
+	.string	"\224\023f=w\213\210\024>;\023\245\233\311kcjD\263MdJ)\005\367\001\301\001\377\001\327\371\205\316~\235[\004\246,k]\330\220\312\377\242\306vM\321\260x\2779\262\256\322\335\326\335v\277u\307u\313u\3175\220\271\231\031\b\367Z7\333\255}hg\377\320t<\234+^6\251"
+	.string	"\362,J\nA\271\"p\214K\316\004\270\276\002\244\343\236\232\365b\333\005)\362m\217e\325>\b\366\257\350\366\216\372\006\345\205\343\366\202\226\035m\n\315f\261A(R\210=\226=R\320V\232\rH\267I]6\251\306R\r\241B\216\020\004\373\347lQ\225\037ETjl\227\020\232\324c\276\350\0373\020\274\336j\305\316a\255\272$\023pgnf\243\001\3514\026Z\207e\227zr,\253v\304G\301\376\261Z\367\250\375\013\366\216\332?ff\0315\200\360\n\204EuD\f\344\fF6>\226UCz&\275\366P\n!\024'\202\200~|zxvL\350\344\340\334\020m\206\302\232 P\375\335\367\225\233\252\207\224\240`Q\2464\005"
+	.string	"BeG\246\243"
+	.string	"\216}\265L\251\022/\264>\261C\320-\022\002\317\330y\307\263K\264D\"\355\262\243\016\016\204f\346?d>dP\274\347\322\b\203\004\353\274#\331\035\016\031\343\245\313\216O\234\247\246k\013\363L\211\327X\357\224\035\235\344\035mp\023i\255se\274!\343\210T\306\224u\331q\314s\232\2109\316\335\371\202\363\322y\307&\327\310\213\024\260.;\"\361\033%\261\363\2163\330\\\2333\306g\347\035\217\334\031X|Gz\330yG#M\327"
+	.ascii	"\b\273J\3315`_\036,;&oQ\336\361\313\201\300\244%\350V\224)U\342"
+	.ascii	"\225\326j\221\376]\027{?\230\271Af\335\236.([C$\226\337"
+	.string	"\353B\271\205H\017\021K\302\f\221W\3767H\343-bY\266\351\332\271\220V\356\300$\226e\331\267\220^\315D\315\354\01703\013\314:R\001HL\265X\314\242En\3637\237\363\r<3\003\016xoq\221\361\251\030\347sr4\231b\3430F\f\316\037\021\377f\251\215(v\020`\240\304\267\001M\033\276\315\267\030c_\025S\177)\362y)b\370\335\327\332I\205\266\264e~}\327\302\217Zc\035\335emj\355\314X\226\265\301\314-t\236\004-\327:\371\360\232\210\t*\270`\207\332?\3417\265vgi\234\005\253+\312]\325\232w\200{K\017\261r;\341\f6\330@\355_\315+0\226\254\362i\367\367\223\032|\021\326\300\\\371\031\006\376\375\340_;cR}\340\033\265\3727M\026\232\034\377\363\2613\366\021uQM\372\034\317nLZ1\253\320Z\236\202,\313\342\340\306\322Y8\340v\322?\366"
+	.string	"\004\357\255\376q\203\360>cs\376\377m\3745\333\251I\357\217\243\265\345\314\352\263\362)'}\177\323\365O\256u\256}i\366U\371\224Y\315\312?\214\271\177:\235N\371\227\314]\245yG\223\216~kfj\271\346\245\236kV\022:\347\350\264\356\006Z\255;\351:#\300\316\007t\\\263\001\035\327\214\343:\337\270\3166\256s\r\2413\215\353<\343:\313\270\3161\256s\001Bg\244\353\f\343:\037\t\235\215\256\363\013\241\263\013\2413\001B\347\026\354\314\002\307y\305\320y"
+	.string	"vVq\343,\300\3209"
+	.string	"v.\":\023\261\363\020\3219\305u\026\272\316(\256\363\t\241s\220\320\031H\350\374\303\316>\354\334#t\346\261q\336\021:\233\260q\326\271\3169Bg\234\353|#t&^g\033\241\363\220\235\205\354\\3t\016\016\235\201\327Y\275\316\277\241\363\r8\236\213\231U\004U\274\005\255\022\3224\357\272n\256TA\001\236\207I\256\236\n\312j\025t\342OV,\343\252\245\245\366O\200\007Ni\232\365\2522\257\\\335\\\243\3322|\321\006\204t\223\005\b\312|\035i\267\265kHl\213yEvs\035\"t\203\301\271Ud)\206\350\231\222\f\035\264d\244\311\252\257n\026o\304\232Z2gGR\bf\255\300\242\333\376e[\030%\332Q+\257\2453\361a?\350|"
+	.string	"\357M\326\240F\234\206'b\264\315,\t\222"
+	.ascii	"\376\0064\215\310\035\230\\\316\207\361\213F\340\337J\333\016"
+	.ascii	"1\274\237\231^\307\373\314}\311I\367\256\236\212\307\230Th\300"
+	.ascii	"\3710v\342\213vB\362`t\326\0305\002\317\005\2452\375_\265I\361"
+	.ascii	"#PmE\317\301\334\310\212\344\322\260.Q\227\250\375cz\340\263"
+	.ascii	"\315Ir\375e[\022\031\212h\320>\315\2427EDEC\302V2\242\307\321"
+	.ascii	"r\221&}\212\036\034\361\303\206\236\207\221\237x\024/\364)\236"
+	.ascii	"y\035[m\360\336\032z\366.?:\255OV22\265\177)\276&\371\363B@\217"
+	.ascii	"\"\350O|\027\341B\212\255\023e\343{\201+\350Ue\313\345\214\201"
+	.ascii	"L\2768m\226\036\350\211f\226\\\253\330A.\030\201\276\275@]EW"
+	.ascii	"[\303P\351\177\336\006\007\307*\366N\235_\271\325\317w\034\264"
+	.ascii	"\301(\267\020\021~\030w?\023<\346X\315/}\376\241\25478\325\212"
+	.ascii	"\343\354\324\347\333L{\327uhfL\202=\377D\330\246iV&\032\t\210"
+	.ascii	"WV\320(\231K\364\374p\n[T\211\226V\305\363K;\317S\327:\277\363"
+	.ascii	"DZ\\Y\262\372\032\2106\361J\337bt\336\304\253b\214}\322U\n\022"
+	.ascii	"\016\346\225J\363\2559\254\020c\331+\033fZ\211\365l\335aE\363"
+	.ascii	"\336Z\321\324\376\351\374\360\311\366T\242\315\275\330\231='"
+	.ascii	"P\375\260\350\332\324b1K\"\334\032l \005EA\320)\352\307T\b>J"
+	.ascii	"\350!U\343CIj\352\007\n>z\004y\360\370!\302\005\2320U\202\017"
+	.ascii	"\247\023\324'\247\251\036w*\n\212\202b\b'\240 \325\343\001\022"
+	.ascii	"\244\240nx\004\030RS>\234\236\234Np\002\201\004)($\037=BxB\032"
+	.ascii	"!J\n\t\306\020C\241\340\024\2054\005\005\025\2054T\253\352_r"
+	.ascii	"?A:\233N\035o\322M\327\3014H(M\247\332w}\300\001\317IUo\305R"
+	.ascii	"m\227e\225,\320m\367^\025\237^\226e\331\241\275\365\227W\242"
+	.ascii	"\220\031\323\344\206\305,\032\306\211\021`0p\263\223&\365\304"
+	.ascii	"\276x\261{\026\177ye\331%/\001\267:\251\001\217\367\364\313+"
+	.ascii	"I\270\334u\340Vw\226\214\340\206\230\215\277\021DL\0202J\177"
+	.ascii	"\303\306\367\330\227\022)d\374\214\257A\343k|+=\215\377\245\311"
+	.ascii	"RZ\315\370\216\361\005\274\214\357\254(;>\006\322\027\360<\264"
+	.ascii	"\276\270\030\373\200b-\022B;\036\351\033\312\332\335\225\237"
+	.ascii	"\001\242\b$\002\247\247%\013\322G\271]9\363)\302e\206\242\310"
+	.ascii	"_\374\321\303h\3610\214\376\310\353\212\304:\270\247\323\371"
+	.ascii	"\234\221\213\177\361-F\256\210\023\205{:\343\\|\367\271\301I"
+	.ascii	"\241eO N\020\360\336\004\2568\364\341\215\200?\032\353\301\310"
+	.ascii	"\330\220\240\026\037\325\026\233m-\376\267\204\303S\242\245\361"
+	.ascii	"\264\335C\002\3654\325PAN\215N\237\246\347\313\203\343\r`ae\375"
+	.ascii	"'\234\331Z\025\026\237\200[\363,m\305\357x\037\302\330\347]\027"
+	.ascii	"L\"H\031\357\255\025?\344u\203\234t\017\211\247\344\247\351\007"
+	.ascii	"H"
+	.string	"{\"F\341\222\2401\007\360\241\023\202\346\003\267d\r\314\003\336u*\364\202H\203,\341\275\325\364\016f\311\024\357\250\006\2603=34\323\003-y\350!\211.\320+?cu\204\026$x\274I3\007I\343fz9\340"
+	.string	"\264\322\324S2\243:|\312\372\317\346SJ\331\357\331|*\231\215\265G&o\007\347.G\307\027\221oF\347M\007\321\001\201w\250\2210\244\024shFDD$I\222\fcq\005\304\030%\035\274\016\0210\255CL\021\211,\354\304\222F\206\017\225\364\277\350\317l\007\023<\305\350u\207xK\345\036\3123E\341\310B\030\253JD\275S\230\351MjV%\021\222\275\324\200\203\326\004ub)\0302G#\336X\251\345\305\032B\212\021\366\267\001\250\204\266\346\331\222\255\251\347`!>G\344\005r\334G\351YE1\210\214~\323\273"
+	.string	"J\227<W\232\250\232s%C\312b\3050\333lX\337e\210?\356\253\262\023g1\232L\025\276\204LN\356\020\370\002\315d4>N"
+	.ascii	"\024[^\030\316\227hh|`\373sK\213\263\374x\206\242\353\203q\371"
+	.ascii	"?\273\374^9\356\254\006\257R\213\375a\356;\373@\354/\262\334"
+	.ascii	"X\n3\"\2445\254\210\254\206\b'\357[\013d}X\036\007\374@\023V"
+	.ascii	"\363\032k\247\301\251\341L\021\034\212\205\201\361\022\032\007"
+	.ascii	"\302\201\374\005\242\330\237\3070W\202P\240W\256\201[4\223\276"
+	.ascii	"p;\237\246\300\302r_\333\003\032\234\273\222_\240\365\266\027"
+	.ascii	"\201\345,\204n\035\250\261n"
+	.string	"\264\227kL],*\225\322\353\206\212\t\003\310\272\3509\333}\343\202\237\255\361t\346\240\216Q\2304#[q\376r\305\314\r-\005\217(~>\036\275\201\367\007\364S\356?\001\207\t_\247\257I\210\267\215V6p`aP\251\204I\262t6<E=\220\327\330?\222\016\335R\370w\303\013\262#bE\226\341xMzfo\004\001`\324\177L\341-\316\206\224\212\232p'\024\020\310\250\202Y\234+\320\207wB\320\302\374\232\374|\345F\342\275I\225L\361\326a\231\275\200S#\247\245\210\200\205\260X\251\007\220\377\313\335|`\324N\351@\224E\263\221y-gr\001w\254\365b\276\234_\335;\226\006AjEyP\230\266p\244\006*$GR\251\310J\234Y\334\262\036\242 \022\016R\231\260z-\"\363\363\272\013h\274\310\214\376*\306\310i+\3216\375Tk,\260Q\2607\004\246\035p\232\025\350\247\032\023"
+	.string	";s\360\367\024\305\305m:\260QD\213(L6\036OJ\371\033\001\240\205R\313\3242\275\030\206S\0309]\231R\230\275\021g\033\306\331\343\2663\"\312v\002\031\t\t\252`\235\337\350c\240{\215\256\346\030\032\263\"\371aT&J\020P\350Xb\213t]G\311\316Q\212\365\243\352B_/|=H6\2557\007\245\253\207!\261\260\232\205\203\351I\013&\267\024\260Uu\346\317z\206\252o"
+	.ascii	"\370\306\303\2418d\026-\201\363\250\356\r\311\327\207\005u\017"
+	.ascii	"\377\202T3B\020m\r8\016\1777a\373\362\351\233\207\374\001"
+	.text
+	.section	.gnu.lto_osdElementIsDue.204.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\330\005\245\""
+	.string	"\272@\b\016F\200\236M:\033i\322\240\304]\307!\224!X\222\177\232\030|\260\r\210\013\177_n\265\366]\351Y\237q\333d\201\367\023O/\323G\222\265#Fj\303N\262\211\002+\341b\230\2436]\212\206Z#\204\020\"\245L\001\315"
+	.string	"\264"
+	.string	"\334"
+	.ascii	"\373\305\262^2\366\312O+02)\265\326T\306\237n\271\377\323\237"
+	.ascii	"\376'\371\337\255\265\362\264\\3N\253\265\b\235\b\350\226J{3"
+	.ascii	"\267$\267\310\334\362\315\253E\343]\253\225\2270\265"
+	.string	"r9\270\003t\313\377\217 \341\351@\334\r\033z PM\031f\361S+\227\256\221,p\323\032\r=\315\222l\006~mlz^\350Z\232\221\252\213\236\"<\252\266\266\301\342\322\224j\255\350\226I\021\241H\375\340\223\\\220G\254\317\226I\025\311\333\016&Q\351\324\220M2\301\2322?lS8\310#!I\340\2247H\333\024\024\024\251*nr\201\325X\217tJH\336\330\030\251\263]{\240L\252\212\371\274Pk=GM\361\330\007\355\177\261\377%\376\262H|\\\026\343\303fH\037hr\253\3002\007\212\377\374O\261`\273\nP\023\376\327\330-\274\035\003K\343\247\326J\341k\265\264\370.\331\362K/x\243\266\374\366\314-\271+\200\221M\331\312\365\366vm9\006\226\006\013\034-gA>\376\\Bn\254\177\373x<\036\337W\377\371I'\037\251\371\006L~\201\345\332=Z\255\335\\\363q\347\033\235?"
+	.string	"\345\337\316\027\200\362\213\232\037\300\344\0235\037\200\311\037j\276\315\344\013\235\037t\362\323\223_;\371\264\346\243\315?O\276\331\374\322\344\223\347\367\371\334\374Ub$\305\035:zl\225\231Zw\034\001\3255\245\230&\377\003\373\306\303\026\2711\272\031\352\005\223\265%\324\266n;\303\263`\207-\363\260FPl\326\b\365\216e\035\231\031\221\234A\275o>\254\232\235V\032\236\220\233\260:VZcA]\366\370\262\304\252\312O\306\213\013\021\023\204i"
+	.string	"\201\227+<]{\332\220!\265\201\306\361I\373\250\221z\275\226\214b\314\363d\370\345$\304\242\031Q+\2361\2236\1775\325\017%\305\262\261N\302\254u\037\241\265\331\265\316\031\207D\264ig7X\264\t\204\341"
+	.string	"T\240O\2562\016\317\222\226\206\231\353\002}\036\022\205|\374\355\030\022h\255\225\302Wl\305\2240q\342\204\271\245\331\026\262\304\220]\366\016\317\312}\0313\327d\343\370\3408\023\362\221\227LX%\214\\.\333\275wP\354\227\335\372\b\363\322\255@\316V0w\361\200\327[\372\351\230|\275\236o\227s\032\301\353-\211\3701\361\232\232d\354\204z\274\337\022\371\335\003\247\037\023\257\307\203\301C\261\302\311\247cZJ\321\323\355\232\234t\017\220\356\213\301k\322\375|\276&]\312\025\334\276:\223k\266\\\256\331>\361\232\355\032\251\272\f\301\324\222\320@TV\264\200\351]\240it\243\376\205`\013O\326Zk\332Xg\224\301\262\311`\231\326`q\235\343\307uR\333\262\200\220\r\313Zc}\327\b\353\013\221\326W\003\232\305m@\036 \225[S"
+	.string	"{3\205H+2\t\202\n8\300\266\006\320\001\272\250\177\240\025\f\274Q\002Zi\3306\376\255\263v|\337%\317\240A\203\271eQ\323\210D\035`\303\316\361\260D^r\342\020\365~\r5"
+	.string	"\016\001a\250!D\303\224b\n\221\004#\301hAR\303\030\260\002\231\241\252:\020`U\"3I\013\007\250g\352\215\331G4H\031s\201[\004P\247\207L \200\250\305\337\206\235\224I0\033\326\342\254\"\215\274\320\005N\177\366Hb\314\213\360\261=y\372s\374l$\005\215p\356\327\322l$\005\034\351\274Q \314\\R\277#o\006\346b\375'8\311r\207\035\b\354\016\375N\037\266D\344\201\303\201\235\031\035\230\221\241\305R\234:j"
+	.string	"\253\330\037T\324r\0244mD\356{\364\357\300\251\3652\267JX\307\017\361\355@\260]\003\275\270\317\026\350\311\264\022\337\b[i\005\227\270'j\213\024\374\213A\324$\302:r\342"
+	.ascii	" \326\245\373\353\263E\256,\0135"
+	.text
+	.section	.gnu.lto_osdDrawScheduledElements.205.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\017\t\0356"
+	.ascii	"\352`p\025A@\346Q\007\360\303e\272q2S\301)\"Ac4\345\1776g\n\346"
+	.ascii	"\212X\327]d\037?J\335\323\324\026\344\272k\260)\350\334\253?"
+	.ascii	"#v\007\277\366\314y\303\302yn\244\225V,\b\331{'\231R@\0016\001"
+	.ascii	"K\001\355m\035\3542I\317\323\354A\252P\343\350\345lu\340m\247"
+	.ascii	"\350\034\335Ao=\330\335,\356\236P\341\365\265*\267.))s&'\002"
+	.ascii	"[=\314\353j=Xc\206>\251f\370y\313\304:\356\3663G{=\355\207\037"
+	.ascii	"s\006\333\243&g+\204\206\360\363\266\255\236\344z\373s\244\353"
+	.ascii	"m\277\335|\002`e\253\n\324\253\026[\241\234\263\323G\351c\277"
+	.ascii	"\263Vo\344\277\216\204<:\032\213\304\2410\b4\372\371\334\226"
+	.ascii	"}\374\266[9\022k\034c%<1\022\312\224\212\037\331I\247\\\241\370"
+	.ascii	"\be*\346\306\246\242\357\211\212(\313\327t\314\211l\006\2642"
+	.ascii	"1\267\2232a_\215\214\033'\223V\361\220\t\313d']\202\205@\261"
+	.ascii	"j\236\024\017\262\r\364\326\fr2\251\0226i\210\225\250\333I\223"
+	.ascii	"`\240\235\024\211\223I\223`#\337\323\327\364\210\377\310\244"
+	.ascii	"GX\2468o\262\223za\337\317\210\273D.-\226)\347\034\344\312\302"
+	.ascii	"-\333\240:\327E\344\302b\223\346<\321\343q\216\267\270\2620{"
+	.ascii	"\365_\035*\235\237\257\251\230\277\267y+\266D\356\314\320\327"
+	.ascii	"\224\212c\337S\316\271q\224k\352\235\344\335\276\325\335\321"
+	.ascii	"n\037\237_'\353\355\211\367\372\350\361\377\273\212\262\252\317"
+	.ascii	"\016^\227\374\345\2341\264\323\271\034\027\r#\006\216\341z\213"
+	.ascii	"\337\343\274U\323\326\307\320\337\345Q3\303\266\277\322\263l"
+	.ascii	"Z\213\256\360\336\013\237c\376r\206bh\207\343q\240X\037\213r"
+	.ascii	"=\032\345z\353\357g\034\0024\215^\025\355\355\n\357\025\3602"
+	.ascii	";\363\037\326m}\342a\027:r\375`\335\017<\315=)\304\255\300\327"
+	.ascii	"\334\021\260\270\017\270\232\273\001_\343\335\344l\274\231\n"
+	.ascii	",)=\356\001A\334IB"
+	.string	"\334H,n\244\247\361>\3622\336G!n\243\020wQ\210\233\310\342\036\262\270\205C\334A!n\340\3436z\334\277 n\237\303y\273,\356\326\335\274Y!\356\027\342\306A\334\016A\004\233\230;6\252\334\343Y\363\220\275D\271\256}\273\342k\334\331\270\303\271\247qws/\343@\354\353\366v2.\227\303\335tp\355ZW=S\323\376\346m<\016n\351\207*G\257\006\033&\223\2255\017!\336\251Z\317\n\315\370\255\301\301f\257\374w\252rge0\320\264_\323$\203\240Q\351\\\230i?\343F\025uB\235[\361\3631\001\277\345g\034\350\204:\247u\035*=\353~w\353pB\311%)\203\274H\233\"3\257g\"\"\304;\177\257\270\007\360\033\260EV\200\356\350\024\374\201\017 Hk\221\201\007\276\202w9g\271\324\321C32\006\313\002\334\375jy\271`\217\002\337\315\232<\337\312/\b\311\320\341"
+	.string	"\244\353\234o\372\001]\315GI\006\"\004vU\363\177\371\004]\325\326\202zn\364C+\b\260\201o\277\3735{\277`\217\032}\220\323\004\353\255\\\007\263\306\251\003\364\271+\271\315\376|\237\364[J\217\224"
+	.string	"\232\364H\337\2305\3720w?\202\346\204\375\036\254q\353\300\275\315\024-\315}\340\310\337r\340\310\017n\271jA~\323cE\256\233\357\303\332\035\257\025\031\342\345>XW\271?<P|\b\315\373T9"
+	.ascii	"\350u\214\317\013\246\b\275\202\351\361=\033\232\203\007\354"
+	.ascii	"Q\020\357sbiWx\017c0S\354\330i\235\351\372~\370%\346\016\024"
+	.ascii	"\037\352\356\020~\207\231!/g\250\205\356vz\336\210\nyv\034\217"
+	.ascii	"\004[\342\204{\302\365\326\367\305\256\353X\025-\215\351\333"
+	.ascii	"_\nR\275>9\035\024\027\362\354\374N\005\213\026-\\o\231^G[ \263"
+	.ascii	"7\343\377\027\370M#\202r)\345t\232b.\227\314(\001<\2242\246\244"
+	.ascii	"\332\245\322)\305\356\200jvpR\345X\376\246\274\251\224r\262N"
+	.ascii	"\267ac\303\016\250\246\fe\323\210J\205r)\225\3029\245l6sD\r\235"
+	.ascii	"M\246\211*(\0337\250\244:\310\240b\022;*\002\225sJ\271T\332P"
+	.ascii	"\306\220A\305t\232\222\202Z:E5\251\234\",5\363\206\262\351\344"
+	.ascii	"d2\233NA\353\225?]\375\363\r\322\2075\0058GK\337z\301x\313\217"
+	.ascii	"\357I\367\370\376\307\031\270}I\221X\313\217\277\364\336\346"
+	.ascii	"?<\261%r\262\bt\241\225\035}X\027\247\030\037|{\350{\353\350"
+	.ascii	"\215\317\201\016\007\301\321d\373X\277K^&\330\243/\023\327[\343"
+	.ascii	"#\020\363\272\302{\316\346\234\3631\351"
+	.string	"\036\375\203\367\253\267\201\332\372<\361\306\340:\2741e\306\017\253r\273_'\030\253\252\005k\323\004\212\237>\314\254\225\005*>\301V=Z\260k\"\234\367\036.\372\207\370\305o\341\262\252\303'\372\362\274\341\\\341\017_\200\242,\262\340\013\337\3370O\364Fq6D#4\034\n\276[\244m\317P\232\003\334~\222\312[\005{\264\211o`\352\f\351a\275Uw\036\257'\240b\234{u\372e\321\260\300\273\001\200\253\250A\034\305\230c\206\021\021\031\tJF\323\f\007\200\002\021!\254z\020P\307f\222\0242\034\221)T\037\304x%\377\355{\307\325*\301\004%$\202\201d\266\331\265\254r\004\016\201\323e\306^\365\225\030\247\220\371\231\026*O\265\242\234\021-\254y\302\315_\323\301\022\336\320\343\333\200\255\002\f\340M#\177\265\355I\024\025\236F\202+q\357d\362HD\335\022\002\302\310y\327F#\356\343fJ"
+	.string	"6\214p\210\023\311\243\370\265"
+	.string	"\341HR/#\024\322\r<d\220R!\033V\303\237\037\037l\300E\335l\201J0|\376"
+	.string	"\314l\001ZD\231\001\325t\025\306"
+	.string	"\244F=P\326\301\013\303\026Dj\222p\033F\257\234Z\301\231\302\214\265\207\205DRAS>c-\272\373@\316M\b[j\322\276&X\244$\021\0366\372\271`\210\374\301\004\n\305C\210\223:\021|9&[q|\257F\330s\303m\361\025f\202\264\277\327\203\330\254\335G\035s8\337~\216\320\330j\001i\316\250\025C\210\226\274\312\366R\341d\202\177V\030\266i\344\2479\360!\320"
+	.ascii	"\364<:\360k\370\201a\272>:\220\005l\023W\373\365\343\203\230"
+	.ascii	"\324\005Ew\355f@\n\005.)w\227\227\021\3238\023\322\340E;8\033"
+	.ascii	"\226\252\027\022f\336\037"
+	.text
+	.section	.gnu.lto_osdDrawActiveElements.206.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\250\n\215:"
+	.ascii	"\332d4\026AP\244N\007\001\003\275\006\227\351\2564\336\263<\276"
+	.ascii	"=&\230\234\025\315\025v\350c\312W~ 4\032"
+	.string	"\022>G\215\204\350 \247ah\274\366l\370\325\322X\005\3641\027\2450b\261\270\324\204\354\275SJ)N\0017\001Y\001[\320+\306\362e\201r\237\341V\223\346A\337\261\333^~dg\376t\020\321t\224\231e }\206\377\r\336\240\031\334\275\227\005\302\314\266\372=\327u\314r\005\013m\323\005Y\322\202^\260!\337\232\n3Y\351uB\357\030\353\305&\007n\360^\250\204V\371\004\263C{L\333d\206\244Fw\013\355\310\006b\253Ki;s\303u\\\333rD\372\350\336\264<6\367B\233\270\211\330*C[im\225\330Ik\253\3342\373i\250\332%@\206\20497x\357E~\025f\303F\234\241Sh\263\361\333.2\":\262\306\"\361h\270\252\351{\313]l\212iuQ:\344\002c\353;ag)\206A\177wm\027\305\215\250\214\2515\221\253\365q\312\230Y\263i\037\0014\246\357\204=I\235"
+	.ascii	"\035\021\323j\232\270Q\001\2251']\2342v\326\304V:\351\243\264"
+	.ascii	"\300\2350\263\264\201\035\264\276n\013[\363a\252d\007\255\357"
+	.ascii	"(\306L#\230\315Y\262\036\305\272\322\245{o\253i\204\2776\202"
+	.ascii	"G1\256T\t\214\255\331u\255\240-\314\351\351\222\376t)o\217"
+	.string	"y\024\333J\023\244\235\021v]\373\227\330\322}\350\341\336\313\336\024\033kFj\346\356\300\314J\346b^V\304{\357\005n<WOD,Yk\253\303/\312q\357\265\235\254\025,X\254\255\256\337sk\036GO\334R\375'\267\325\252\376\220\240\236\013\365\207nxnfq\3164\017\206\3175\001\375\323W\365\230\205\206\234@{\310\312\364\376HkV\342t\201Yza\232\344\3143jx7\271\243V\342\366\226\257\305\013>\216\220\350\032B\2062\231c\377O^\360\3758\312\364\331\362A\314\375\246\361\254\270\261p\322\206w\323\306\332j\277\220\350\2327\247\322\013\271\310\227\032je\216\332\341\335\\\360\016\356\334l!\374\333z-f\350\322\377\311\334\275\344\352C\343Ocf\235\235Xg\016m\246Y\003\262\211\350\f\241\345\272\0374\231n\246\246k^`\240\3234\027xg\002E\347\001\357,\200\350\034\300\350\254\364\316"
+	.string	"X\347$\2433\022\353|dt6b\235\213\214\316G\2423\021\321y\210\350\314\276\263\261\350\\,:\023\207\316\303w^\207\316\352\3209\3555\315Ot\366\241sw8!h\211g\216,\311\357\201^\260BBwO\275\323\322k\272\323t\233\351\246\353\325Uf6\314\254\335R\307o6\255\016F\375\336\344x\360\216\026\037\321?\221t\333u\227\335\345%a\035I\377\177q\037\211\300\0025\001\225\205\315\364D\337uz\330\1772\321\240b\323\017\301\034\361\227\267uz\357\275\306\177\366\203\265\3007}\323\211\346i+)\356e\204\311\232\201\243\326\2429\227U\003>\314'|\253}2P\273\367b"
+	.string	"\364e\253i\025.\232g\360_\220\023\017a\221}\356>\327z\274& \207-\366\333-Jg\271\207\316lYh\370\006\257\317\f\216\220U;\243z_\002\225^\270\2662\267U\232\260]\353\361t\200\317\275\227\001\237@A\306\277\212\316!tF\360aXs\336*\241\373L\007\266\\"
+	.ascii	"\250\335\253\004l@m\026n\265\264\\Z.k\333\245\365\342V\376\366"
+	.ascii	"\272^\213\031\370\203gn\337\3320Cwx\177\201`U\224\304\177r7q"
+	.ascii	"\017\024#G\237\326\306\255\034\036\312S\313\030@x\352@x\016?"
+	.ascii	"\f\364L\017\341;\332#\332\240\360\t\303\244\333\262\354k\277"
+	.ascii	"!\255\230\017\037\326V\207>\356(8'e\370O.>\361\207\004\371\272"
+	.ascii	"\217\t\020\"\274\233\"\326V\213\337~|N&\321{L\350i\331P\020\371"
+	.ascii	"\256\263&\247\364\302T\002 32\353?"
+	.string	"\351\364\360\275\020\247\350<\001\314\203B\322\207\024\026\020$U\325\324T\025T\001\251\216\302\272\201\305\342\252*I\025\305\"\371\203\204R\222\352\306\217\244\232t\0215%\325\002\213*\352\352\n\b\024\021\326U\225\212\254\033>~$\245B\344HV\035\031\212B\022\213*j*\312G\224\215\034\311*$\225\324\215)$\324U\022I\001\001W\375\210\272BbUU]!Y\250\262?\215\273\256\373H \262,L;#\t\315)qB;\031\257\350\355)\177\311\032\336MFT\220\300\267u\023p\013\201\247\021\025|s\262i\370\030\321@\204\316\001\317\315\347X\334\312\200@orN\356\364L\\-\363N\357\022\376u\275V\n\257bU$\372\347K\340\240~\252x\n\240\206@-\020-\313K@*'\352\207\320\251,\262kd\224\b\371\234\036\377\r\374\227\201\017\360>\245\f\035\245\017\360\315,\344R^<)}Q\316\317"
+	.ascii	"\274\205\265\356n\246\234\272\246\321?\277\332\300#\277\355\332"
+	.ascii	"\206W\226\272.\r^\364G\237\364HZ\260%\346k1\322'\2119\224\266"
+	.ascii	"\254\335\2368A\372\2465\243?R\342\316\266\254\341\22411z\013"
+	.ascii	"|r\307/\372\366c\026RrK\346K\332\262\036\214\372}\271w\253\204"
+	.ascii	"+i\2338\361y\342cm\224\236\023\355\033l\225]\354\305\0237\226"
+	.ascii	"\263\265\325\200\322\250q(\306\030BL\315\210\210H\232\244\320"
+	.ascii	"\030p\002\021!+\353\021p\261cjFLR\030\346;\301\022\034^}I\324"
+	.ascii	"\030\321r~\f=\026\261~+PV\374L\362\305\366\246\002\3727\300\304"
+	.ascii	"-a\030\367\032L\355\312\030MV\273[\310T\310\234\327H\347boWU"
+	.ascii	")\231K\322O\033\250\344\354\357%\222y/\211\201\230\317e\301\202"
+	.ascii	"\374 \310\244A\354\307\316\270B; \222\350\357\n\265f+\344\256"
+	.ascii	"\270\302\205h\216-n\032\017\245I\216rr\353\2747i\024Y\013\366"
+	.ascii	"\207\256\333\355.\201\273\246\303\241\r:\322\277\235\201\fU\246"
+	.ascii	"\266\272\\\352\230\361&\205h\253=-\376GK\0011\016-\313\324@\211"
+	.ascii	"\331\374\225\221\337\331\233\254}\300\377tb\231\243g\223\233"
+	.ascii	"x\306\311\3011w\006\332#\312\001'@\321um\311\337H\325VTeg\204"
+	.ascii	"\227\376o\277\301\252\231f\337o\202\313g\202\026\245\235\312"
+	.ascii	"\006\346\331\340l\001\360\030\372\340\326,\261\277\243G\361\331"
+	.ascii	"Dh\321\231\245V\0202w\271&H\324\206@\3440\254d^\310\363X>\210"
+	.ascii	"\2255\345\005\224,\023\221:.\337\361\340n\221fe^#\314\303\210"
+	.ascii	"\242\261\377\243\344\252q\025\264U\320V\036\335;\264{Hp\231\217"
+	.ascii	"\263b.\246\265\301\340\236Y\022\204\323\3008\322\201\351\374"
+	.ascii	"\271\351\003\350\023\244\204\352c\bs\265yXe\377\232\027Q\034"
+	.ascii	"\300\230\214\006\363\323f[\256(>\n\330\364\271\001$\365\2058"
+	.ascii	"D\260)\217\226&\377\034D\311\214\r\324\325@FY)\327\216\215\234"
+	.ascii	"b\362\2337\270\3605\034\016\007\036\002\200Z\363cc\370y\3013"
+	.ascii	"\221\373S \243\006"
+	.text
+	.section	.gnu.lto_osdResetAlarms.207.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"\r\007"
+	.string	"\322\31513`m3\006\300\3752\322\t\2110tM\355p\036\377\021g#\276s\364\376\333N\"~\321\341'/,\251\365\222\204t\b,\256$\241\323\262\257z\345\2262\245\315`.\316\206\322P\021T\303\303U\311\r\204\203Ff\254Kb\fZIP\226\344T\225%/\334-\035~\006\266\225\256\003/:\275"
+	.string	"\367dR\260E\314a\004\240\277\343Y\213<2Q\2038\226\002{\236\216569\266\025\026\317\263\t\233J\207\001\265\226\323\036\364h-\375\177\341\247\205\b\"\024\016\207J~\215\026\226w\321$\324\326\227fm\2129\320\013:F\031$\243\377\022~8\363\313j\207X`z4?"
+	.string	"\206\377}\323\263\341B\267=h\273\320v\013\b"
+	.ascii	"\357b\314\304{}\264\204`n\264\313\370\227q\301\245[\264\363\t"
+	.text
+	.section	.gnu.lto_osdUpdateAlarms.208.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\005\023\005O"
+	.string	"J\203\234\034L0\316Z\351\207\252\036\200\224\r\256\350W\017\261\035\037\204\fj1\316+\216\347\033\037\341\035\022T\307\201\023p,-B\202\376\004\263\346z\357\310\033\265"
+	.ascii	"z\021\b#H\30695\322X\220i8\335\2224\211i\021\2545\331r\357\224"
+	.ascii	"R\n\256\001\211\001\300\001\316AFg \353\374c\235}\254s\217u\346"
+	.ascii	"Q\235wRg\035\3259\307:\343Xg\243uV\255\263M\235\323\324\031M"
+	.ascii	"\235\037uv\324\271\301\\nK\220\n\324:\256\315\275A\236o\356a"
+	.ascii	"*\030\327T\272\373\272\377\272\247t\3371\367\0367_W\351\246\225"
+	.ascii	"\366[\373\017\f\275LX\260]yro^\013c\247?\336B\266\257\007z\255"
+	.ascii	"\300`\023\341I\n#\225\036?\274\260\225\220xo\336\007c\247\314"
+	.ascii	"\235\307\255\307:\235N\341A'[`\007c\247\335x\254\303]\327vk\337"
+	.ascii	"E\3207\355\366\004k\330~$\336{\247:\345*c\247\310>\332N\321\026"
+	.ascii	"\262\235\362\312\234B\3471\271Gk\212K>7\367\336\253_\302\336"
+	.ascii	"h^\363\220\257\035\005\365\344\204lbZRJB:2*\":\016\t\005\001"
+	.ascii	"\375\370\364\360\354\350\344\340\030U\233\242\357+\267\212\365"
+	.ascii	"\004\250El\314\037\232\217\216R\261\240\236\3349\304,\r\2224"
+	.ascii	"\300v\362s\344\237\025oB\245\216lQ;z\331\300L\313\235\3419S\363"
+	.ascii	"\316\227\232v\256\224\304\326\002\024$i"
+	.string	"u\215D'\305\217\350\346\334\250(\204&\212s\342G\364\370&\007\245\277\2345A\245\006\003Eh=&>\244$\r\256\205\2028h\240\267\246\233\377\250X>\035\006\327=Dntn\352\234H\322\2164\017\006(r\247\210\021\327\311\271\240qP\344\2273\"NrgC\334\350\244\252XH\322\230m\227d\236\2565\232\203\266\326\337\2036\206\"\357\275\215\327n\206&\346\256b\335{\331\313\320\322\232/4\263\377`\346$3\320\206N\273\3639+^\213\001\013\263\363 \334\232\234\331\005\f\357\262\234(\207)\316\027/>\317\347s\261\223\326\3708L.I\243\241\361\225U\206\240\352\237\220<\2221\241\313\324t'\255}\365S\303\245\232\230?\251ZK\322x\357%\301=\330\2043\224\001\004`;\265\237\325\354\233\023\f\363'\017\272\371Q\371o\343\364\377m\354m\031s\026\230Y\200\3162\200\361\3361\021\334XZ\220"
+	.ascii	"n\270N\331\200\003R\356\003l\247\351g@\274\013\363'\01393\002"
+	.ascii	"\nx\227\375\367\237\023\266C0\315\203\326?\353\373\f\231\024"
+	.ascii	"1\177\362\217\3673\327\320\362.\363G\216\275\017\346qf\007\270"
+	.ascii	"\274\313\372\217\202i\316\234\211b\357\2039O\314\277\215\271"
+	.ascii	"\373-\213\220\t\370\2230\363h*\315;\272\257\371\253\377\232\275"
+	.ascii	"Rg\034\251s\227u\346R\235\265\372\2569Ki\235iX\347\031\326Y\206"
+	.ascii	"uNZ\347\030\326\031\206\352\374Buv\221:\267H\235Y\3448cY\347"
+	.ascii	"\025\326Y\205uNa\235Q\244\316'Pg\023\252s\t\353L\302:\217\260"
+	.ascii	"\316\"\254s\b\353\f\302:\177\260\316\036\254s\007\324\231\203"
+	.ascii	"\352|\205:[Y\347*\353L\205:O\241\316R\250\363\006\353\254\001"
+	.ascii	"u\316`\2351X\347\013\250s\024\352\fe\235\237Pg'\324\031\211:"
+	.ascii	"7\251\316L8\316K\326Y\311:'Yg$\353|\224:\033\245\316E\326\231"
+	.ascii	"\250\2474\037\255\363\220u\026\262\001h\\\250\352I\034\325k\370"
+	.ascii	"*\346\324SI\375\324\253|K\"\033\236\252\2452\374\206W\3034\201"
+	.ascii	"\323\340IZ\371\031\306\004axK\026\271]\370\247\307\360\366\314"
+	.ascii	"R-\352/@=UG}\223\275qz\250W\r\313\324\204-Q\362\364E\210\202"
+	.ascii	"\251\362\235\236\310\317N\013\331\021\261~#\374\240\016\350\333"
+	.ascii	"\370\353\271\240\250p\031\363\354\036v\307s=;\331\021\344\357"
+	.ascii	"\370\347S\272R\301mz\344\253\203drL\337\364\275\\4z=\323#\371"
+	.ascii	"\331U![\344\340K\317\274j\260n\340]\366\245\365K\002 \326=\227"
+	.ascii	"\213\rf\275^\353\331% \343G\300B\220\271w\214\004\363\332\346"
+	.ascii	"F\326%Ud\260x\021\257\357f\243\211\3151s\202>\bg\306\371\243"
+	.ascii	"DdH\232Nz%&\233\005I(a\023\214\024\t`\276\370|\033;\317T\267"
+	.ascii	"^w\2204'\027\237\251>\276\031w\017\222\232\013)\323G\217\364"
+	.ascii	"i \232\237\035}V\263\213S\360\271\350D\t\017\332+\024k\364.f"
+	.ascii	"\317\320\315\201\254PD\260\2339\005+\007k\2235.\316vj\364!\020"
+	.ascii	"{g\311\342\370\306k\343\027\357%[\3648\236}\311t2_\256P\270\341"
+	.ascii	"x\355`\215\262F\261\235\026}\002M\3039f\230?u\210|\314\305\374"
+	.ascii	"\336\260N\332\241'j\263T\363\373\034z%aa\216\320+\276Q|>\025"
+	.ascii	";i\203^\350\221\334\244tq\272\t\372\254\346"
+	.string	" \316\267\361\n\202\005z\033{\210P\316\274\322\255v\336e@Y\214?\277\202\n\213\317g'\255\317\3770\023\321\370\274\362J\241\332\363g\314\334\333I\313\363=\237\236Y\252U5\"\031\236\317j\006\006^[]\\_\351V\027\327\027\272\325\305U@\227W\215\0335p\270\372\353F\215g-+\035_8\266\272\266nl1\320\200\216\034W8\270jt]iy\351\270\262b\342\034\020ly]}\345\310\341u\245\223\027\326\237\204\tX;t&\206\275X\024\215_>\331b\317x\032\237\016\376\330\213\315\370,@\300\271\"iv\201P2\336G\262\350\257\372|&_\006S\361M\362\001\350+\024\314I\314\243\340)\006\013\311\"\247\361&-\214\217\361\351\232\245\032\23350~\001@>\247\340\217\260\026\347\364\342]\270\032Wa\375a\266\002\001b;}\361+\020\231j\006o\\\220`\326\305{\005q4)\270x\b"
+	.ascii	"\371\346\356z\362\006\351\232\314\264\316\367\222m\361:(\264"
+	.ascii	"\370&ts\246.\0346{e\2644\213\357Bd\361VK\375\200\305z\033{eF"
+	.ascii	"\270\3475\363*d]\363.\303\372\376\223\023r8\366>\224V\204\001"
+	.ascii	"\243\370T\361+\230^\016U\274r\2610)\005\027C\024\237\302\204"
+	.ascii	"B\024\237\325TDj4G\314^\231\356%{\342QB\2665\312\211G\201\330"
+	.ascii	"GYo\342m\354\031\226x\023C\234\204,%\236GSq\316\210\004\026\037"
+	.ascii	"\241K'\355\210'\301\f\004\034\361\3126\"\376\317\375z\236\317"
+	.ascii	".!^D\233%\263\217/\304+\331\024\026\201\370\275\344Q\017\331"
+	.ascii	"I\373\341A\274\312W\345xw\037^\271\246P\320C\235\323e\320\341"
+	.ascii	"=<\322\217;-K5\261\020@\350\360Y\315\025\234D\034\336\352m\354"
+	.ascii	"u\271z\016\337\027x\0240\243\007W\217\001\361\216\307\210\025"
+	.ascii	"\320_\034\226\343\267q\353\365\224\024!\036\317h\317\361\225"
+	.ascii	"o\326w{e\306\234\205\356F\357\275w\350\333\224\317\343[\257\263"
+	.ascii	"\020\353\002\201u\250QD\006\22133#\"\"I\n\222\264\006\261\005"
+	.ascii	"\204\030\345\2343;\021\360(CN9\024\310)(J:\357\361\371\342\276"
+	.ascii	"\326\272\265\026FN`\217T\211*\331\361\344\324\257\375\020I\213"
+	.ascii	"\315\020\031\"\334\204|\213\333\320\270S\225\037\321\241\313"
+	.ascii	"\020\032\350?\374\016\032\346\266\303}o\t\225\257\234\340K\241"
+	.ascii	"D\360\214#\343[\023X\333D\313A\013\364\376\240[b]\001\017\303"
+	.ascii	"\\\030tx\235\225o\337\bo\002\0322\345\031\270\302\361^\374\242"
+	.ascii	"U\036\354**\252Z\037\204\327\315\336\2129"
+	.string	"\340M\222r\202m\301\330\bPg{\307=\267\025\351\245\034A\375\372\003,\270E\377t\003\177oZBf\340\324)%\013X\03356-\032!\311\002\326\017\314\023b\034\020\274\322\364>\f\003N`\\4\256\003\240\331x\n\034\273\304\375\207\337G?:\006\321\356{MD\234\030\"\327\345'+qB\036\001\262&\303u\314l\355\332N\270\037\242G\303\213\003\221(\b\fH\004\373B\200\242\254\213\322\363\260\315JO\005z#x\357\373\364\200 &\317\247\264\20190\352\310\366Je "
+	.ascii	"\200\306\216\203\340O\262?\n\340P\262\302&U@\2506\213{\221\210"
+	.ascii	"\264\245'\334\f\001\b"
+	.string	"\260=7\020fj[\237\t3\3531T\227\027=\np\321\020\307\256\013\025\370G\207\335\202\204\327#w\245F?o\322\3116d\341\226q\235\003\025\t\261\276\242@f\333\026\350\365\355\232\240\004\033\f\202\013q\033\n\236\202\366\301=:\272\005mk\354%%\271\334\262\333\2727[H\346\372\360\370\317 \243]\025\320vI\325\322\b\026)\025>A\2134\361j\244\377\034\271m\317ir\335\302^\026F\b\300e\307`I\276_\367\205,\032\314\340\254I\210g\f\342$\332\017o\345](1\321\207\241\275C\222N%*\314\361\260\013D\211S}\022\205\2126\t\311\273\352\321\260\3716U\206!W\tI\211\341\023|\364;\351>\202t?['\016\237E=\210R\340%y8\367\223\371%a\364\024\252\226Z\256\204\312Y_\246)&.\271\3729\263\211[\350\324\307@\250\251\242\n KT\217\233z\366\330q\353\376"
+	.string	"E\376\354\217\007C\020R_t!kzF\nd\204&\344m\333\353=\311\017\314s\365\006\231@\203\"\226\004A\004z\326\350@\240\026q(\270K\224\n\332\305gc\343\253\363"
+	.string	"M0D\002\353\244\337\365]\242\273"
+	.ascii	"e\326\317\333\245\fw\222\243B\203=&w\257\016\022\210\275d\347"
+	.ascii	")2\024\210\033\227\374\001"
+	.text
+	.section	.gnu.lto_osdElementIsActive.209.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\222\001=\020"
+	.string	"\346_oE\360\360$\035:F\206AL\327\016\345\256\2053\376\3035dV[\245\311\231\003*\367\371\2171\202\035\301y\270\r 7\330Q\265\355\366L\264\203\207\305a\241\231\345Y1a\3655\243\366\253\fN\021ido)S\n]"
+	.string	"V"
+	.string	"]"
+	.string	"\005."
+	.ascii	"{\204\017\200=&0y17\300\002L\016\004. \232\"\035\273\236\246"
+	.ascii	"\035\274\340\320\273cr\307\"\324\344|\230c!\335\314\277\247M"
+	.ascii	"\027\2231\204\316!d\0204\242'\244\223\201\372\0315\201t3\251"
+	.ascii	"\377n@\311\005\321\f\244N\347\211B\331]gM\207s\243n\233\263}"
+	.ascii	"b\237Ey\022\303\311\203u\307\316.\364\243\234\216\037\272!L+"
+	.ascii	"L\247\246"
+	.string	"\377\221\"pn0\344<\251i\367\346\305caD&\020\037\272}\317\377\206F\2768\373\013?\256\0228v\275\003\2176\311\036o\277\330 \2663\355\233x\320\313\205*\370c\227\203\323\212]\217\304$\331c\021R)\354QU\244'C+_\207\273\273\361\037\301\240fJ\340(\351\305\314\206\230|\345\221\206\235\026Py\214\322\324\025\021\r\231\334\341k\352iz\264\362E\341)T\331\356*\360Q\274h\202\357\363h\226K\276\346\321w\301\036\257\377\036s\224\236\200\230Z\371R\0316>$U\036\333\203\t*oa\331R\333\312\206rJ\t\253\205eKm+\233\003\b,\225\306\242\362 \245\245\254XZ\211\210U\022\266\225\326\242R\2554\020o\257;\376\211g7\\*\214\226\242\317a\377\376\361\343\n2Z\322\237\303bT\243\2644\346\003\246<\006P\003f\032I\244ml\033\252j\203'\377\350H#\276\217\003\034"
+	.ascii	"\3571\256\020-Y\035I\332\266\252=u\204x0B\222\207\374\300\n\242"
+	.ascii	"-xAb\236\270\360y\261a\036\005M\264\310\221\230\001uaL]H\234"
+	.ascii	"\"\263g\270\270\024P-TA]S\315\365\024\322T$^\327$\003"
+	.text
+	.section	.gnu.lto_osdElementsNeedAccelerometer.210.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\216\001\375\f"
+	.string	"\346\225O@\020O5\035\203U\b\267VT,"
+	.string	"!t\310\253\323W\371\215\320n\361\034\326\220I\213\335\276b$\254\361\321\375#\212'\263\n"
+	.string	""
+	.string	""
+	.string	"\b\200+1\374\220D\020\3105\202\341\027\243\265\275\267\2242\005="
+	.string	";"
+	.string	">"
+	.string	"`\306\033\224\323\313\2322\362r\327\215\t%Lx\276N\257\024\205\220\325\231\022\244nB\032#`\237\267\234\361qb\244\273\265\244\373\371\274]\353@w\177=_\005\375C\377_\370/\371\325\024\244\f(\217\273\037\354\226G\277\306f\321\377\375\265\373\371\275\374>~\317{}\004"
+	.string	"\261\302\202\236Xt\203V0\032%Ot\370\257\371\261\0270\2409\247 \007\220\006\206S\207\204\213\356\230*D! \222\016v\367\344\0213\304\013M\035\354A%\217\256\312-\272\273\310\242\020\272\fQ\205%\216\325\260\335\335\361\271\251\214\215\bS\210P\341\355\213\317eu0\377\007\020V=\312\232\n\247L0\031\213V\321\030h\b\024`\266\314\262 A%\243\\0\331\004\300\267\006\332%\313l\333%\303\300V\026}\255\001\272Q\242\223?\377/\216l\230\363\311\027k'\306fW\362\222\004\344\207\265\"\007. "
+	.ascii	"\003\031)\363\2371\344\f\215p\fb\222\"2\366\334[\364\016\260"
+	.ascii	",\331\323c#\367\272`}\027\330\230\330\324\334@\n\271\313ZY]\277"
+	.ascii	"\240\fN\330\225\366\256\2123nh\f\305\237\310M\006\246<\314#\226"
+	.ascii	"G\332\373#\316\3301\210r2[dv;\314\262\361\312S\024\232\336\004"
+	.ascii	"X\006"
+	.text
+	.section	.gnu.lto_osdElementDisarmed.part.0.292.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"5\013"
+	.string	"V\025MA \307*\035"
+	.string	"\213"
+	.string	"\372"
+	.string	"\263"
+	.string	"\002'"
+	.string	"\244\331\017\357\273\201;A)\253W\323Z\340\013\245\305\326\360\330\025\354\\\207&\\\0316D\214\207\240\312"
+	.string	"\242\246\023\344:v\261\020\351\374\333\371\321&{\247\0248"
+	.string	"9"
+	.string	"9"
+	.string	"\002l\247l\335K\332\276L\332\272\016kU\020\265\233In\301\356\202\257\324\345\344\351\364H\377\270k\\0\325\351\006\226\362\211p/3\261\273\376T\356z\333!\333\022\366A\001 \226\335\223]\203m\251\007"
+	.string	"\330\276}\\\312\346p<\347\313\324o\250N\271(/\317i\277v\033\371\033\352\007\2732\005\006vK\317\253=\337\253\313+`^\277'`^\355\007w\211_+\344`\203\214\363.3\260\250\312v\310s#\337\356F\370\004HD\374\227W\037\205y\235\364!\226 \200m5w\223\316L\275{\273\273\2462\233N\317\227\377\353\214\005\026U\\`PdX\2104\031\217>\343\251\024\222B\217P\203c\024\301R\307\006\t\034\231F\360\263`\361#4\201'Q4\201\234{Ke\376\030\254 X\321\022SJg\2667\363\003^\200\324@\333m\005\023"
+	.ascii	"/\371\337m\b\315\334\316\262\206\333\036\034fHSa\003\362\300"
+	.ascii	"\210\273\242\240q\002\t\246s\366a\260\260s\005\340\344\305\274"
+	.ascii	"\323\322\364\023\312\030"
+	.text
+	.section	.gnu.lto_osdElementGpsSats.part.0.294.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\351\001\r\021"
+	.string	"\326!rE\360\356&\035\322\256\247e\250\347\274\230\305\320\035\345\023\345\371\340r\244\226\353\203\036\376\t\030\265#o\330\210\347\363<\267\2067\370\031w\332C<\227q\270,1\341\215\244ET\260v\231\344'\326\255\021\2627\2212\245Z"
+	.string	"]"
+	.string	"_"
+	.ascii	"\333\262\342L\373#~3;\216\354\002v]\\\374\354~\033\207\336\350"
+	.ascii	"\016\375\035#\036v'\020\017\355\213\260mb\017\375\213\331\025"
+	.ascii	"\317\354\241\323\205=Q\200\302Fe\207hw\275C\205\371\354\232\333"
+	.ascii	"\314\257\261\234\\\237\363\254\261dx\016\370\306-\330]w\032n"
+	.ascii	"x\333\034\266;\354l\020\333\252\213\335\245K\377~RLw\\\232\213"
+	.ascii	"\351\b\3230\2467\230V\230N\230>\200\224Q\031\355b82\332\017\020"
+	.ascii	"\b\204\355\357\230d[\016/\036\204l\210\326\302\227\300v\211I"
+	.ascii	"N_L\013G\323S\264\202h\367\363~\227\\\307*\231\240\020\273k\272"
+	.ascii	"\237c"
+	.string	"b\233L\316\374gr\034\331\351\013v\204\237x\375\204x\3703\262xXR\022\247\235\336G\345\005\312\307M\254|8=O\213\033\250\321,\240\236V\243\272\351U^\274\347\251\252\247\001\225\256\021\257\251\367\241\325\244\344\221\355\326KH\350v\227\303\3479\t\020\177\346\320\024\\\371\332\241\357\212\207W\216F&\250\350\006%\217R_\254\333\003f\241R,\324\001\226\n\265B\255P\001<!\205\301y\225\212\215\210\264\\\255\220\226\007+\366\362D@>\\\336\n\026\363R\031~Uh\301\274\221\327\013\346\231l\347\325\305$\230\rB(\232b\375\266\273\253\372b\273@n\032\265S\003\031\267\212x\235\247p\200 f\227\366\332\203\216\306@\303\356\200\220\257y\333\016z\342$ `\202a\256\254\003j/\034\363\377\254S\031\342d\302A\242q\013\314\323,\247\231\271n\307\202(\356+)\311l\370\037^\213\346\205\211\b\364\303"
+	.ascii	"#\312a\376pAOB\364\030\315\214d\210\013\234\230@\337\002\361"
+	.ascii	"\322\251\034~\300J\004\240\373\334\350\330\235\327\2061"
+	.text
+	.section	.gnu.lto_osdGetTimerValue.part.0.295.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\364\001=\021"
+	.string	"6\337lG\360\320&\035\220\311b\267\017\212s\b\302\360\230\216?e,\354\334\200\272\261`\007"
+	.string	"\273~\024<\331B\037\032C\266\261\f\2431|[f_I\337\215\310\303\324\211m\202\034\322N/\013\251P\207$_\276\351\275\267\224)\005Z"
+	.string	"Y"
+	.string	"U"
+	.string	"q\304\312-\370\321<\231m?\304E\260\334r\340\302\022\223"
+	.string	"\007\303\013O\2169\277\355Q\344 \362\021\336\200|\\\ro=\302U\331\362]\217\n\363d\016\001x2_\270@(\005\216\001^\013\004\211u\200\275v\205\361^\252\005.=J\346\234\036]\270=n\373\201m\022[!\004\352\177(\315F4g\254\210h\316\242\212\233\377\374:W\373\376\317w\374\022>\253\367\250\350\201o\306\310\236\343\373\230D\342<\254\367\250\020\2303\346=\02087B\r\276\321\375\234\225_3Ig\365oEd\003\203G\257\376[\361\307\234\031j"
+	.string	"\315\371\225\036]\032=\332,\233\364?mH\bh\327\306v\210\324}\355\244\017;A-:\344?D~u\255/3\257\2378\212\223\317\301\250\024=\354\321OY\01340t\314\260h\221\t\333+\033#\332\224\315\331T\360\370\332O\243qC\206Kw\350\332x\345\341\334\032[\252\243TC\251\336\250\326\030\235\312D\325ES\252[\233F:\025\nw\342(p\021$t\250\r\345\304\344\264\231R\3356\202\300\250\n\\jS\241P\251\215d[\017\2775\026\360\002\302\322\320\356\306\205\261\035W\367\325Ba.\211k\263\342,Z&\216\223$A{u\341\022\363"
+	.ascii	"\003\250}2A\017\333}\214\331k]\3362 p\002\031\263\363Y\361\242"
+	.ascii	"\301\225\026[\234\363\021\365\001-\340\264\214\310\202\023\213"
+	.ascii	"\251\267\021q\344\026\313\223\270=\303t\033_,\216#\341\226#\270"
+	.ascii	"\037\022\342\360\265\314\320\b \272\355Da\230#\\\346\024v\330"
+	.ascii	"\021\347C1\f\030f6\006\336\256>\217\2121\232hL\320 \356O1\326"
+	.ascii	"\2640\340\314\312&n\302\211\r0\233\307\305\224\327\335xm\300"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_osdElementPidProfileName.part.0.302.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`L\001E\016"
+	.string	"f\034`C\020\217(\035A\0353@\004\024\200\034\262\036\024hi\246\037\004\324t9\027\237Mdi\255\350\2127\213\r\333O\323(\367\362g\203\354S"
+	.string	"@DE#\324r':\247\320`\005y\341\314\363\356o{K\231RI"
+	.string	"O"
+	.string	"I"
+	.ascii	".\273\335\306\2417\342\241\273\023\310\034\306\017\310\034\332"
+	.ascii	"Oa\333d\303\274k\255\312\233\r\223\301aO\013\\!DP^\354nv\250"
+	.ascii	"%\276]\363m>\267:]\377zr\253"
+	.string	"\017O\001\177\232\007\273\353\b\342\206\267\315a\333\201}\226\261\030K\002\2668\361\225\337\276\277\362\023\237\2059*\246\247h\270\263\241\333\225\352\345\253\370+\216\262=E\343;\262\357\320r\221\304\354v\t\016\315 \036v\336\375\227\311\346p\234\371\316tW)\243\333\021\2253\355\253\270\311vW\351\001vY0\002o\001\211\273\313\341\263h\b\371&\016\375R\346\020\352\306D\301SU\337\222\"Ae\314\327\324\213\300B2\346\230v\006R\236\273\302\030\030\212\027\224\236RK\254\357o\225e\3034|\367\277\227\326\227NM\177\223#<\"v=\004\0061\320\001!\202\004\r\350\032\177<\244\017\017-\244]\320:(\220D\231\007hB(\373\214H\231\247\200E\030\264Q\366!\022\2152\216\355\374[e9\302\\\274\204(\312\252Zb\033@\252\376\344.\237\003\255\335\3249-\246\032 \260+\200\362\234;)=\331\266\020\034"
+	.ascii	"/\371\265\333\243^\033\017k\317\0343\203M\205&\317\240\001y`"
+	.ascii	"\204+F\026\255\200\245\202!u\263\324V\304:\203\260a\334r\220"
+	.ascii	"\213\3051\032\315\220\260^N\221\fbw\306\002\356\022\227y1O\276"
+	.ascii	"\266\340\001"
+	.text
+	.section	.gnu.lto_osdElementRateProfileName.part.0.303.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`M\001M\016"
+	.string	"v\\`C"
+	.string	"\257(\035\373\360iF\250\""
+	.string	"\004\275\035\222\344\355\030#\2520\363\367!\f\320BT^\320\370\267\321\220\rO\340'\237:\361\221\337"
+	.string	"\201"
+	.string	"\210\371\003\3012\2209\357u\022\021U\327\315b\354o{K\231RI"
+	.string	"O"
+	.string	"I"
+	.string	"1\273\035\307\2419\342\241\273\017\330\034\306\013\330\034\332?a\333d\317\274k\255\312\233=\243\321aO\013\\0\222\025\330\356f\207J\342\3335\337\346s\253\323\365\257'\267\002\361\f\360\307y\260\273\216!nx\333\036\266\035\330\177\t1\232\035\001U\230\270\313o\337w\271\212\237\302\235\026\323Y6\354\341\320\355J\365\362[|\024_\331\316\262\361-\331{h\271^\254\330\355\022\034\232A<\364\274\373/\223\335\3518\363\235\351)%\215nKT\316\264\357:\312\366\224\322\001\354\262Z\004\207\021\211\273\353\341\277l\b\371%\016\375\322\346\020*\006\212\202\247\252\036&%\002\2251_SOR3\2221\307\2645\220\362\334\025\302\\\260\220A\351)\365\304\372\376VY6L\303w\377{i}\351\324\3641\322\244"
+	.string	"\315\356\207\0261\360\021a\002\004\t\021t\216?\035\244\020\020-\244a\320>*\220D\031\b\210B(\373\214HY\007\001\2132h\243,D$\032e\035\333\371\267\312r\2541\221\031Q\224U\365\304vF\252^\3451\237\003\255\335\3249-\246\032 \260-\200\362\234=)=\331\276\020\034"
+	.ascii	"/\371\265\333\243^\033\017k\317\0343\203M\205&\317\240\001y`"
+	.ascii	"\204+F\026\255\200\245\202!u\263\324V\304:\203\260a\334r\220"
+	.ascii	"\213\3051\032\315\220\260^N\221\fbw\306\002\356\022\227y1O\276"
+	.ascii	"\266\340\001"
+	.text
+	.section	.gnu.lto_osdElementDisplayName.part.0.307.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\301\001U\020"
+	.string	"\366\035kH\340\222*\035@\t\006\323\205\b\224\223\260x\252\037TO\332\354\306\240\204\271\237\327(\b\246E\324\003\216V`X\fv\211\331\3701\354\212W\210\244\204\275\004\031\203\0079:\007\304q8\314\204\001l\252\236\303i\321&{\247\024O"
+	.string	"S"
+	.string	"W"
+	.ascii	"\017\260;\323\325\330"
+	.string	"\255#\247\036\371N]O\300s\372}\200\347\324\276\f\333-[\367J[\230E[\027jY\327\202\332\215\211\231\335\356\202\247\323\305\305O\351\211\376+\346\372\274\355\362\025Kq)\340\336\347\301\356\372Sq\323\333&\261\255\301\226\b\002\236\375\013\243n\267:\r\237\307\270\303\307\375\346\317\260i\275&\304\"\226\2721\230\315\267\361gN#\276&\344+\333\237\240\325rtv\253\310\251\031|\247\"o\365\233M\306\\\214\335\005M\337\326\262A K\371\332\272\f+TW\006\263\224\366k\217\021/\303\n\266E\334\306\210owI|\034\022*\377\305\251\317\362\234\312\251`\314\365\210Y\221;r\276xz\367v\316l*-_\377S96\200\331E\261\363cYP\034\030\307]\302n\254\342\355\212J\223}Z\344t`v\313REl\257\254\022\2524\231\003\032\034\216\335n\005O\003\216@\241\244\302I\206\222\t&\030$@"
+	.ascii	"`\017\243\016&\024TH\002I(\005L\377\2304R\245\240J\247\022\210"
+	.ascii	"\322\t\007U\b\242L\033N )\245\002G\006\034\206(\245\300\2240"
+	.ascii	"L\201\240\317\231?\03799Vf\t\3179_l\203\310\337~\303t@\307\256"
+	.ascii	"\313_\037>\027\013\t\354S(\377\262\250e\272\002' @\002\204\234"
+	.ascii	"\273\016\354f\270\362?\333\310\312Z\325\f\026P\3603\244A\330"
+	.ascii	" \317#\2141FV\340U:\212e\360Zi\213\305\022\257^M@%\207\307a7"
+	.ascii	"\2477V\327E\213\257\212\340\341\3101\003Ss\333U\036\031\245/"
+	.ascii	"\242\245\323r\330\200\355\b\240\367\331\321Aw^\033\306"
+	.text
+	.section	.gnu.lto_osdElementCraftName.part.0.310.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\277\001U\020"
+	.string	"\266\035jH\340\222*\035@\224\226\217\340\204\246S\357\025\206\336\351\321\237}\301\001\016O\376\023\360"
+	.string	"\324\275<\200\243\025\030\026\203]b6~\f\273\342\025\242:L/\030hg\320\2203#\216CS\005\001`S\231*\230\rm\262wJ\001O"
+	.string	"R"
+	.string	"W"
+	.string	""
+	.string	"vg>h\354\326\221S\217x\247\256\037\3409\365.\300sj\277f\273e\347\274\322\026f\321\316\001\265\254KA\r\205\210\231\334\356\202\247s\305\305O\331\211\376+\346\372\274\355\362\025+q\031\340\335\247\301\356\3323q\323\333&\261m\301\226\007\002\247\235}\223\021\247\305\3522|\235\021\307\307\375\346\307\260i\275F\344\020K\335\030\314\346\333\3703\247\021_#\372\312\366#h5\230\037\273U\344\324\013\274\323P\267\372\315\024F\033\337\364m-\373\373,\345k\3532,P]\031\314R\332\207\361\030\3612\254\007.\333\036^\343\203\267\273$\376\r\b\225\017s\352\263<\247r&\030o\270\210Y\221;r\276xv\357v\316l*-_\377S9\202:vI\354"
+	.ascii	"\331\024\364\206\305q\227\260\031V\351\366D\245\311>*r\344^\344"
+	.ascii	"\226\245\212\330^Y\005Ti2\0064\270\035\271\335\n\006~\020\241"
+	.ascii	"D\302I\005\b%&\016>k\030e0\241\240B\022HB!`\372\307\244\221*"
+	.ascii	"\005U:\2258\224N0\250B\020e\272p\002I)\0258*\340\260C)\005\246"
+	.ascii	"\204a\n\374\336\355\234\331\323\t\302ce\206\360\234\363\305v"
+	.ascii	"\210\374\3558L\006z\354\272\374\265\301s\231\200\300>\205\362"
+	.ascii	"/\207Zf( @\002\204\330\0357Lf\270\362?\333\220\335\346V\304\032"
+	.ascii	"\264=\230\031\3222l\220\347\021\306\030#/\360:\035\3652x\255"
+	.ascii	"\214\305b\211W\257M\200\222\243\307a\232S6\326\353\242\212/E"
+	.ascii	"\360t\344\274\201\251\271\355\226\217\206\200\035\232\276\310"
+	.ascii	"K'\311a\002\226\"\200\336g\215\016\337y\255\032\003"
+	.text
+	.section	.gnu.lto_osdElementLinkQuality.part.0.322.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\224\001%\020"
+	.string	"\006`mE\360\260(\035\373\nX\3110\\\344\3036\266\361\031\272\b\363s@f\021r\223\307\t\311\364\307\221z\025\266\236\302\365\277\365\340\325\265\324\177#\3602\271\234\251\366`\232\322\275 Qc%?\303}\246\244\221M\244L)U"
+	.string	"U"
+	.string	"Z"
+	.ascii	"\037q\030\326cN\316\261\313\202\243b\027\fyt\b\367h\360\006\266"
+	.ascii	"G\356\005\266G\373\"l\257l\234\203-\0333\313\306\351\310\260"
+	.ascii	"-\00665`3\235\335\355\036\325\303Y\327\324X\376\227\322\272\236"
+	.ascii	"\346\371\245\254<\t\\\363<\330]s\033\356x\333#\266#\330\311\005"
+	.ascii	"\334\301\337\023\323\333g\356\270\245\265-\2551\235Z\372\001"
+	.ascii	"\322\005\344"
+	.string	"\305\256\206\220\306v\210+>|\346\366gV>\215?\263\325eT\366p\201\033\213}\346\317\243O\342%X\227Q}\277\375\352\330\2049\273\240\202G7\340\036\007\2443\017\256\036s\322\001\256J\314\231v\026\270\335\035\361O\230\220\374\227G\377D7`\242n\272\311ZZ\300v4\215\252\263\027\f\327\234\203J\214\027\231\214\013pm\007a\270\203a\327\205@U\323\277@\240d\350T\325(\343\225sM=l\307\225\241\001\244]\362\362\337Uk\\VnP\264\225*\263j\327VYlO:\026-\370\b}l\252\024\251\004taB\005\023I\202\b\345\t\3608$\202J\231F\245Q\311\210D\204\362:\023\tT\352B'T'r\300\236\311\350\324\245<\357\324}\256\255\262x\303%\304\215KQ\254\2522\333\034\271\251g\334,\266\233x\n\022\220\226\335\327?\020\367\202\220\300\016\215\362\237=`\332\262M\341(\002\037"
+	.ascii	"/\371\337m\\.s\020\304\334\326Z\031\256\031\322\246A\320V\270"
+	.ascii	"\230\321_\202\213\253(\202\220\001y`\204+\006\006\255\200\272"
+	.ascii	"@\245\342\036u]\351\004\214\2112.\034\356EB\352\234}\030,\354"
+	.ascii	"\\\0018\361\\F\307\274\363\3322\006"
+	.text
+	.section	.gnu.lto_osdElementLogStatus.part.0.323.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\200\001\345\016"
+	.string	"\346\234cE\020\221\223\016\030\202\022\202#,Y\201\2157/>\377H\320\002\360\247}wV\340\353\244s.\357|C\244\367)l4/C\036\320$\351\212\020"
+	.string	""
+	.string	"\006\275\312/\204\235=R\272\277y\206\366>M\032\331[\312\224\002N"
+	.string	"K"
+	.string	"Q"
+	.ascii	"\327\243}\023\266O6\316?\231}1\312\306\001\321\260\234\002\233"
+	.ascii	"\017.)v\354n\366\250!\216z\204\232\027\312\357\224x:\217{\314"
+	.ascii	"\316\2039\004\340\301\\\005x-0dw_\363\334\340\2452?~uJv\327"
+	.string	"\230\207\273s\333&\266\035\330\247\021\032c\275\016WW6L\307\230\2060\255\377\376\324\364\003$+tb\227CN\217\005\021c\220\260}\3735'\373\363q\346\277\323iL \337vxq\246}\024\237A\235\306\364\002\273\253\034/v\277\221G\217`\217\376~\340z\304n \266\271\336:\013-\201\314\256\352\335\206\251\026\210\330\022R\362\235CT\312\331\236\360\025\027\260\335e\340\253\310 \362E<\372\246\353Q\225\204%\243\304\fK\346X\237\273\313\251\306\330\306p]?\242\205\243%y\030K\333B)\337]\323\006k\306MJ\271\fF\001i\240\350\006\032\bv\254\205J+*\233h\243\260\235\240\224F\231JJ\004Q\246\221JY\b\201G\0256R\2662\032\221\262\217\355<\\]\331\303\322q\303\242)k\204\372\026\177\3530\036\230`*\022\221\307\350\342\"\252\347#m\b'\371\016\352o\260j\300\001I\340\001\037"
+	.ascii	"/\371\265\3333_\033\\\263\327\260\306\005\031\201\314`3\310\204"
+	.ascii	"\0328\314q\0051v\001\t\276p\003hj\3616X\007\210\202a\256p4\265"
+	.ascii	"\330h\234@\202\351\234}\030,\354\\\2018\361\236\032\345\252)"
+	.ascii	"C\235\016\332zB\031\003"
+	.text
+	.section	.gnu.lto_osdElementAntiGravity.part.0.324.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\315\n"
+	.string	"\366\324I; \261\322\001\300BH\n(X\370\202\022\017\205\367\005p\345\201\353\220~.\007*\357\020\3021\361F\211\225R\024\304z\005 8]\334\303\016\344\272\263\032\364\017\214\026Z\264\311\336)\0057"
+	.string	"7"
+	.string	"7"
+	.string	"\266\312\316\2754Y\230I;\007j\355\212!e\304\003g\263\273\340+-9y:=\322\377\355"
+	.string	"\257\330\352\324\023\013\371\024\270\327y\330]\177\"w\275\355\221m\007\373\013\001\037;\335\222T\030\024\333\267\177S\331\237\217\347|\251\272-\005*\027\004\3469\355\257\274F\336\226z\300\356,\367\262[\206^\035\372^]\236\200\363\372}\200\363j_\305\001\b6\3068\377\362A\213\256lg\034\267\361\355n\203\337\302\241\341\237\274\372)\316\353\244\n\262\230\233\032k\356&\245\231z\367vwMg6\235\236/\377\327)K\320\355\006\216\200\240\035\223D#\312\024\226B\213P\202b\024AS\305D\t$\235FPT`\361\"<\201(Q<\201\237{Kg\376jdfX\264\303\224R\232m\317<\313]J\0064\273\256\277\304\3175\n\023"
+	.ascii	"/\371\337m\b\315\334\316\262\206\333\036\034fHSa\003\362\300"
+	.ascii	"\210\273\242\240q\002\t\246s\366a\260\260s\005\340\344\305\274"
+	.ascii	"\323\322\364\023\312\030"
+	.text
+	.section	.gnu.lto_osdAddActiveElement.part.0.337.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`T\001\345\r"
+	.string	"\226\331YC\020\261$\035\200\247\345\025\200\"\331\363\254w2\034[:f\231\322\304 \266\362c\232\274;.\027\353\377k\023\006vQ\213%\202\255\216\t\003"
+	.string	"\240\bE\242\006\212\261\026Z\242,\035\0169\215\020\262\267\224)\005C"
+	.string	"H"
+	.string	"F"
+	.string	"\207\005\316A\035\276\013\240\016\355\223\260\315\3317\217\244mq\310\276\351\260\260)\006N\036XJ\246\335\305\0165\346\241k\276\220\377\231wD\243\224+\200\221\206g\200\277*\301\356\332\332p\303\333>`[\201}\232\353\022\203c*a\332\n\361\303\266_z\212\023\233tDR\206JD\r\316\f\323n\304\016\035\255\373\344(<\241{q\335\237\341\354\353r\346#\367\016\345\305\035\2658\323\276\211\237\b\275Cqg\027\004\r\233\335\brh\020+,9\251+.\262\361{P\327\324_\350\260\222'\3734\257\361\360e\274\221\344E\207>\211>F\007c\204\213J\236Ra\254\357o\365\305\246\322\357\361W\230N\230\276\225\335\007\207]\f\247\033\373\001\272\b\241\202\263\311\013~\340\341\250\034\342\001\225\214dZ\026![\320"
+	.ascii	"\264a#\"\f4,\344\003\302<\003\274I\310>X\311\266}\260\353o\365"
+	.ascii	"\305\235\034\0315TtE\025\306\366S\333\024\336\302\001\001\322"
+	.ascii	"\356\"\360Y\334F\304\22794\004M\243T\237V\245\" `\202Q\254\252"
+	.ascii	"\007\352^x\344\177\331\310\212\271\350\230\023\210\335\273\224"
+	.ascii	"<\213\031'\024\357\005\"`\352\354Vo\304\002\333!\372a~8\302$"
+	.ascii	"H@\b\337\025\263\366\357C\263\201\351=\003\257;#\367H\350\334"
+	.ascii	"\235\305`\323\002X{19\365\351\327\2061"
+	.text
+	.section	.gnu.lto_osdElementGpsFlightDistance.part.0.344.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\005\f"
+	.string	"\226\330R> O\225\016#M\324\002\300\334\300*dBE&.\222\213\200\033\315\027\331\037\210\3708\200\330\n\3240FYKkIY6$H"
+	.string	"\030"
+	.string	"(%\b5y\200\211!Y\242\202\222F\366\2262\245?"
+	.string	"?"
+	.string	"B"
+	.string	"\004\254\307\353\003\254G\373\035l\177l\325\277\324\226\334\331*I\204\005UH\230 m\254\330]\354Q5\274\273&\354|\317\004\272^\343\351\231(<\005\034>\020\354\256\257\nw\274m\213\355\212\375MvL\307\177?\204i\325tj\372W\246\016\234\330\225\260\352X\f\261\304\006\333\267\257\361\261#\021g\376\373<\303#\371vB\311\231\366=\034\243{\206\347\001vO\035#v\277\311\243'\327\243\277\007\n\262\335\340!\036\\\273k\361A@\320\374\013\217\365\030\025\202\221\252z\021\244\026\241\024\337\254k\352G\034D\271\262\377\341\033\233\177a\007\\\336{\3649\353\361j]H\251XX\b\345*\025e\205\207\253\247\035M\246e\231\354\341\013\205\353h2-\313d\t\026p\033\246\301(\320\260\013\207\303(\005\274m2\016\326\3316\016\0269\\=\031\222\201\003EHE\326\303\335]U\224m"
+	.string	"i\0257\207\245\032\325f\200\311{60\n\024"
+	.ascii	"\3571\376\026\016oE\023p\021\275\006\027B\234\230\031  \n\206"
+	.ascii	"\271\302\021\331b\243q\002\t\246s\366a\260\260s\005\340\304s"
+	.ascii	"\031\035\363\316k\313\030"
+	.text
+	.section	.gnu.lto_osdElementGpsHomeDistance.part.0.345.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\215\013"
+	.string	"\306\226N= O\225\016C\017\260\030(`\302G\336\005\2673^@\227^?\033\002.\375\344b\267\332,\306*\252q\035\001\313\206\004\t"
+	.string	"\002\b\004d\336\200\264\244\032%\364Y\230\232X\262\267\224)\005:"
+	.string	"="
+	.string	":"
+	.string	"\217\366C\330\366\330\032\377>\254\310\235\255!\231\260\237\212\212\n\241U\213\335\305\036\325\303\273k\302\316\367F\237\353UOo\204\341\t\340\320q`w}e\270\343m[lW\354#\b\351\324\364\035i*\260a\327\302\006\214\345\020S\200\260}\373*\217\r\2018\363\237\347\251\216\344\333\013\"g\332\027qT\367T\347\221]\322\213\023\273\337\344\321\223\353\321\337\005X\217\327\003X\001\266\033\274\004\204kw->\211\b\232\177\352X\217P\037\250k\352C1\374\021_m\376\311\017\270\274\367\350s\326\343\325\200\311\204\013\r\240\334H-Y\341\341*\311\216i\370\357W\030\034M\246e\231\314\341\013\205\343h2-\313d\t\026p\033\246\301(\320\260\313\206\303(\003\2749\3106\030g\3336\030\344p\225\344G\007\024,@*\301\252Z\262\235\221\221{\205\225\n\325f\200\311{&@A?\001\025"
+	.ascii	"\3571\320\026.lE\303C\017\207\031\330Tp\2270)*<@\024\fs\205\003"
+	.ascii	"\260\305F\343\004\022L\347\354\303`a\347\n\300\211\3472:\346"
+	.ascii	"\235\327\2261"
+	.text
+	.section	.gnu.lto_osdElementAltitude.part.0.347.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"\315\n"
+	.string	"fUJ> kj:\370\022H\205%\240\002\274 \223\3747k\b\203\202\036\334\2007\223\314,\343\300~c,\243\031\022%\323[#`\0010"
+	.string	"\200\0256\304w\206dE\303\317\317L\177\332\026\273I\231R7"
+	.string	"9"
+	.string	"6"
+	.string	"\023lsl\325\303\007\013\262g\253 \237\375&\022:\034@q\330\335\354Q\035\334\273\246\345\371`\350\273\376\364\004C\n\236\023\267.\215\3355\266\340\216\267M\261=\261\237\021\030\242]\004+\017\333 b\210`\373\366O\034\373\361p\346C\316M\033H\270\t@\316\264O\341%\357\246\315%vG\031.\354\206\221GG\260G\207\257p<b\247p<\332\017\372\331\336^\241"
+	.string	"\266\273\024\037e\200\363!<\372\033\307\243*D\251\223+_iw\004\362\340\365\0264|Hy\364K%Y\255[\253#\333J\353\303?5\375+E\001\032\214\266i\027\355rE\322i0\332\246]\264\215"
+	.string	"\035\227a,"
+	.string	"\266\254\222\3512\211\205\271\001Z&\323p\\&{\334Z\035\031\333\300 \325Q\217U\225d;\"\257\252\266E@\036\364\305'\022"
+	.ascii	"\3571\214\026\356gE\303C?p\030\007\220\007F\270b\220kQ\3208\201"
+	.ascii	"\004\3239\3730X\330\271\002p\342\271\214\216y\347\265e\f"
+	.text
+	.section	.gnu.lto_osdElementNumericalVario.part.0.351.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`S\003=\031"
+	.string	"\366\360\247H\300\226M:$2\246\362\013\265n\216\215\023'\365\034\003H\274\023\250\320Ty\363\232\023\242\356f\274.c\356[\277\3160\373W\313V\212\352\227\017\370\023Q\352\213\377v\246h\356\230\2607\214"
+	.string	"\326S\fYB\310&R\246\024\216"
+	.string	"\221"
+	.string	"\217"
+	.ascii	"\271\336t\001&-e1i\315\331\203p\351\033\321\252\357\335^d\350"
+	.ascii	"@o\2768\262\252\375!'\202{\221\241\013\230\023\311\013\325\234"
+	.ascii	"\275\b\227\216 ^\272w\002\340\245\370\001\340\245\375%\3337;"
+	.ascii	"\313{;\346\221qv\226\003+f\256\302U\020\243'\2559g\354ru\034"
+	.ascii	"w\371\255\2028\177\307\313]>\352\272\343\305\370\247;\036\214"
+	.ascii	"\357\007\243\222\003\313\f\217\350KpC\n\214[][\360\212Ti\016"
+	.ascii	"\206\031\346\234\026e\334\341m\217\260m\263w(\352\230P\355\n"
+	.ascii	"\325b\250\016C5\030\252\245\250\376^uo\250VP}\032\345q\241\306"
+	.ascii	"\234.\266\300L\034\322J\351G~\250\277\352\227\372g\337Or$\376"
+	.ascii	"\324\255\374\252\272\235\n\310"
+	.string	"5E\275\311;\372\2223\301\235\n\350\363\305<\213\036WRZ@\210\2275\337\007\200RJ\202|\244$\350\265\202\351\n\323\006\021\312~]\336\207\272\371G\036\345\327\223\221'\276\223)\334\334\336\224u\247?\371eD\350\2333\346ZYz\302\004\004\203xI\341\006\367&\241\232\357q\351\017\201\2273\353\"\362Z\231\275Q\030\327\306\374\352\273\256U\360\244\023\022\256\270\237\322i\305\200\033.\003':!\256r;\001w\301]0EgE\244[\376V\356\247h\324&QB\277\373\366\001\022%\033\237\372\330\335\240\262\006\002we\023\326\017')E\372\305\001T\327\226\215\372\335nM\321\346\374\325\375\246\030\205Q\241[\226Q\233\206B\277\373\336\352\006\266(\321\310\"\332\234n\222\027\3747\027\311v\251g\336\373\001\204j\031Q\375\n\003\226\301f\023$\300lf\023$\300d\260\231\3318\366\340\350\344\310h?\2661\005"
+	.string	"\235\232\211\035!\034\236\032\355G6\332h\263"
+	.ascii	"5[\216\006\321\247\207\303\230\"\347D\030Zf\343\363\3033\356"
+	.ascii	"\214:c\211\231O-\306C\313\331\211\311l>1\233\005\256\365\214"
+	.ascii	"\266\330O\255f\213\351\277\271HQ?\013\245 Y*\226\310+7\311\272"
+	.ascii	"\346\362 \260\300\316\013\226\272\313\203\300\327\266\260\021"
+	.ascii	"\250\\qc\232\034\253C\203\035s\352\276\363 \352f\016l\234\017"
+	.ascii	"\372\235\277Ics\266C<\312\2168\347\264\340C\231\211p; \240\002"
+	.ascii	"\241\262\332\006s8N\363\373\333(\224\226\013\247\305\0204R\274"
+	.ascii	"8O\203Xu\213b\212}\207\341\3123X\022\254\021)\005\374c\250Y\240"
+	.ascii	"K\374=!\352:\276W\024&\233\024\205\314\200\233h\233\203<\360"
+	.ascii	"\nI\270\307\261\310\rsuN\323\362-0\021wL\264b\0212\007&\356B"
+	.ascii	"&\332\341\261\017\312=Q\367\240\325U\3061\221:b/\031\310\343"
+	.ascii	"e'y\266\013m\2117\342\342\233l\2226\314\257\245x"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\033\037\r]"
+	.string	"j\230\204\037U\200\216\345\244\003?\207\351\376[\356~\367\235O^\212y(\027\373\324\"sG\371\304\026\027\325\375?T5\005\271\230\237y\236\211t\"\333gO7\223\252"
+	.ascii	"\374V\315\334\212\355r\216b\273\034\207\324\"i\234\232\202\340"
+	.ascii	"\350\350\352L\367\264v\370\240&\260\231\034\271\223\f\322\001"
+	.ascii	"\344\001\367\001\265\255/\305\326\365j\255\357\242\3265\255i"
+	.ascii	"\375\024h]\237\316N\366\243\217\372\350j\254=\3720f][\224\235"
+	.ascii	"\207I\326\257\031\353Z$\366/3\254oSyt\035Z\270a\361\304\301\372"
+	.ascii	"7\312\256\305\372\366\257>TE{\262w\256z}\313\354\352\332\323"
+	.ascii	"B\177\270\243+\017W\277\304\210\216\256h\216Gq\260h8*\321\034"
+	.ascii	"\240\205\022\371\255\376\214\272NG\376\205\326\2177V,\253?\205"
+	.ascii	"\325\273f\243\377T\243_t\325o\262\352\347T\365S\032\375\0263"
+	.ascii	"\372JT}\343T\337GF\237\210\205>\223T\177\246F\325\231c\2551\241"
+	.ascii	"*\211\264\216x\252.r7\366\221\234\372$\232\372\276\030\375%\246"
+	.ascii	"z\222\330\230Y\371R\277G\251\317\002c\301\314\027\375\227\244"
+	.ascii	"\276\023R\237\247\272\350\257\324\026\007r\3247Q\215\336f\026"
+	.ascii	"\235\315d\361\265\025\375\037\242\3730\207\3721\305\3652Ul\227"
+	.ascii	"\320&\315\240\375\002\201C\305\343@\375\021\333\364\323\337\361"
+	.ascii	"Y\245)\300\r\022\307{\372G<\275l)\372B\213\025\3037u\264\217"
+	.ascii	"\263\363\034&\361X\313\243\b\307\352\303\376\n\024\275mU\330"
+	.ascii	"/\236\350\253\320\271W\260?d\242\027\256\346\364Q\340T\021\346"
+	.ascii	"M_Xmz\201\324\232\232b\226\350\323\320\364[f\372@"
+	.string	"2\313\303\214\3310s\202d\016\240\303\364\257\352_\326\314\364`\307\314\016\226\354$\372T\265\002\037\270\263\217\350\313\250.\375\030-}\030\025x3\226\372[\251'\246\312\305L\021}\035+\244\224\276\314\331\377U\224\376\211\007\377]\313\274\340\363\371|?\351\225\253#ZP\300\373z\325*\357\376l\352\355a\356\256\316\367\373\301$\355\366.\r\230\363r\271\\\256\320\233VwwdCCm4'J\300= \tx\347\003\202C0\3767+7R$\020p\006#\206\037\311\007\336%\271\311\347;!\371\300\037$I<0\207S$%z`\f\304s\020\352\020I<p\210\361\r\340@)A\342\201u\311\337\005\354F\033\211\007\276\221\244\207\204u\347\003\374\363\001\356=\300\273\363\034\265\342\r\347;\035D\316\336\300.\354\300\275\016\2743\366\034`\035*t\200u\347\377\243\006\003y\242\003\254\373m\217\217\366\370\347\260\327"
+	.string	"\003\034F\370J\016\013p\211\210\002\274CEX\227\"\300!\350\001|\345\006\376O\267\2013$\037@NQ\247j\340\f\277\213\244\201\365T\r\274\373}\265R^\210t"
+	.ascii	"0\003\246\216\251\272\016\247\272\372d\364\263X\350\337\220\352"
+	.ascii	"*\214\352\303\035\373gP\375\264\264\217\366\324/3\366q8u=\321"
+	.ascii	"\324U'F\327 S\037l\251\253\t\245\25680\272\336\274\350j\223\324"
+	.ascii	"G\"\365\177\270\350\nl\321\265\345\250\353\213QW\230\242\256"
+	.ascii	"1,\272\312\254\350JC\324\225e\250k\211b\327\025\025]U\204\272"
+	.ascii	"\242\004\365\227@"
+	.string	"\375\271\237\276\234O?HO?\216\247\377\226\242\257\206\366\335v\372=\210\375\260a_\211\242\237\024\366[8\321\357\322\351\353\b\366\271L\364w\334\007\343\333\345Ps\3726\216\263e\346M\277F\005\2621\263Rm\372V\265\246_Ub\317L\232\3751SQ\034%\305l\247\312\364i\324\230'U\230\365a\362\252\262\210\352K\237\005\022\375\240\021][p\351\253\264\324\034\023\330'\262\364E\254\364ST\372\300\021\021]s\324\232\322\353v\366O\224\376\211\372\353\272UO\372\301\352\373\230\271\354\212\234\353}\223\353\243\304\365]\004\351]\302\365Y\274\365\306\001\351\033\325\037\314\013\267\336 \001\037\030\377\201'\007.\303n\361\006\342\253\221\030\225\001\306\357z\302\252\352n1\217x\005tH\261-r\2678J+%\346\303E\036\027\251\305\272\364\006\324\336H7ki\2638\2032\003z\001\322\276\306\376\224\246\213\305\030\320#"
+	.ascii	"\026U\343O\351\322b1\017=\210\251\0274\0021\251\342N\231\365"
+	.ascii	",Z\316\211\316}\340\316\254\376\264X6\370g\r\343\326`\223\177"
+	.ascii	"M\306q\345N{\305\f4\355\025\377\264\262b\336\271S\276\372|\276"
+	.ascii	"\223\013\267\212uh\025\367\252\370J\032\034\242\211\306\f>\025"
+	.ascii	"\367\226\212\037\244|\b\f9\271\013\203\316\203\320\241\324\343"
+	.ascii	"F\351\037\334\2212\367# \364U(\207\210\013{\320\363fp\325\234"
+	.ascii	"\005\217\362\r\324\344\b\275h'\375\205@\257\363G\304\364\273"
+	.ascii	"$\267d+\337\033{az\213=\362\n\351\317\223\"\301TH?\200\234\325"
+	.ascii	"W\n\351od\374\221B!\375\352X\016YNH\257\341\0139dB\372JL\261"
+	.ascii	"sRB\372\021-\034O$\244\377\220\211\311\353.\366\310$\234\257"
+	.ascii	"\3068\271\247\021\316\367\212\311(\021\316\277(\353,\345H\351"
+	.ascii	"kXP\0270\004\364\003\250@\201\002Ay\221\021f)\027*\337\341\305"
+	.ascii	"\217\251\023\355\2219\240\177\224Z\017\331\223\224\347\027\036"
+	.ascii	"UY\013\244\377p2\207\"\242\374w\030\361\230\335g\217,\202\236"
+	.ascii	"\225\304f \023@\037\001\260K\305\205\351\357\226\244\365\373"
+	.ascii	"\213=\362\206\363\354C\255x\032\220\302]\270G\002\\\256\336\016"
+	.ascii	"c\261\226\220z\256\264\307\345r9\367\245=\362\323\243=r\b\246"
+	.ascii	"=r\257h\217\254K\205\277M\027\n\212\331xxXN\334\224{E\233\262"
+	.ascii	"\330'\336\241+\326\211M\212\353\304!\210\266\211uC\032\230\032"
+	.ascii	"d\300&B\f\212\030\360Q\341\005l\362\032\223t\331\272\320\005"
+	.ascii	"\334Sq\201\005l\022d\001\363~$\250\t\253#~d\233^R\300u\n\270"
+	.ascii	"\016\233@\364 \177P|0K\310\354m\303\036d^Z\364 \357P\027\017"
+	.ascii	"\362O\244\007y\203\337\203\334\373\201\234\036<\336\004\213\030"
+	.ascii	"\227\3536l@\362\013$y2\266\310\364x\233]{\351\371\375\3526\333"
+	.ascii	"\244\242\"s\232\333p\357D\267a^\322\310#\362~!\311\020c\bq\247"
+	.ascii	"$\3425\"\240\032I&sS\331 \247\341\237D\247a\223\037O\303\272"
+	.ascii	"\244\314g8\304g\270gu\031.\221\341\033c\2242\274;_Xg\034\361"
+	.ascii	"\027\022\177\341\222\226\273\334\205{o\341\022\340[x\227\036"
+	.ascii	"\310O\262\034\b\3340+&\024W\371\n\377\247\302O\177?/\202O\374"
+	.ascii	"\311\030x\351.=\312\177G\341\023}?\341\020\342\316\335\307\272"
+	.ascii	"\344}\374$\337\307\274\344\316\3552\310\030\205\324\tw\271K\016"
+	.ascii	"Aw\347\201\262\200n\\\270s\274\301\306\255\334\341\206K\251\323"
+	.ascii	"\3308\356Um\034\237\370\n\267A\330d\203p\311\002\3317\252}\003"
+	.ascii	"\302On\333\272\361}.\\76\231r\343\336)Del[\033\357P\341\256\325"
+	.ascii	"+6\257\341\245v\215K\376\"\360D\327\252\355\232\324\252\261\356"
+	.ascii	"TKC\33344\326\355\017.Y\037\373\203C<\255\017\263\2625\343\331"
+	.ascii	"\2622.\002\333\224\337Y\262\016B)~;\266d\334\3331>:\306;\342"
+	.ascii	"/\204\255\030\353\214\013\266a|e\324\206\261\311\2143m\030\323"
+	.ascii	"\202\361\225J.y\375Z%\353\322/\376o\2756\311!\274\312nP\324v"
+	.ascii	"k\271\230\247<\005$|\347\231\226\353hS\0160\r\313\305%%\316,"
+	.ascii	"I)\033\273u!\001\266\327\037\245"
+	.string	"\243\341n]8\341\034\356\026\233@\374\316G*\215\204\337w\214\205r\353\313\230.\342Q\354\026\007\202\005\250\002Q\214\006\365\2342F$I\nSh\fR\013\020\220\206ah\241\351\022`\3220\314\303$2\004\n\b1$\020\241|\227\320\365\213b\234\245\345\263\200q\363\250\315\001\004w;I\270\221\201\2661\304\327\275\023{L@#\"\365C\321kp\334\367\365\353\327\023\177\020L\220\021`g\342[0#Y\017\200\245\234{\3749\263\372\212\034kiG'\032\344\377\303\343C\200\021\245\252d\354+\002\035\315\214\241\334\214\337\033{r$z\027:\203\360\b\336\036K\357\346#W(\306\312\f\006\2607z\205\256\326 \\\311\220\013i|\253\341$4J\241\310\215\004\215"
+	.string	"\3166\n\307Ba\2213\347\374\2040`n\247,\271\220]\004HI\356+\356#\020\322ed\341p\006\327\3476\267\277A\221\370[`g[^\022\002\365\354\024\002\303?\266\016h\320[Eh\001\016)/\035\356\266\347(\301!\257\302\256\224c\256\023]\30242O+s\033]\344\303w,\327W%\360\210~\feb\354\241\314\223\261#\326~8\237\271\264\024\340\200_\017D@\330q`\231\352"
+	.string	"1\023\2139kxt\311\265\370\3019d\320\034u\222\207\017{\255\307:'D\227F:>3(V\003d\374\237\206\306 \315M\225\253\201D\033\360\373fA\376\233\233\356\254\034\245B\275?\034\330\b.\340\300*\227O`\205\212!\276\250\202\212\204\f\302\355%\024\025\230a;\035\257C\3539IP\313I\313\375\311\331\b\202T\316\221\031\343\017\016&YR\237\247\323\005\244 ,\362\215}\201Ha\301\273\221\270\352#\263(\034\0357\333\324\210\\BV\031\201\345\342\370\025\270\320\350\377`\224\233\223k\261g\027[j,ON\250`Tg\271\302\325>+\2608\357\033h\003\311\333F$V\264\356\247a\266i\257\240\241\335#\231\024\252@/H\360e\226\231\240\3703D_"
+	.string	"\232\025\t\002\265\325\362Bs(2\321<(%\200\031W^\n{\235{\322(R>w(\032\350^cV5\025\351\354b\221f\3636\343O\037\275\333\362\323\256\347j\177\365\313W\230\277\366\366\355\306W[\374\233\375Qo\337n\371\224\323\177\300\372\230\211Z\316\023\270\276-\206\344N\334\275\262\210\261\031\b\245\367\302G\035\232^\340\317+\324\356\251@8\005\r5\007\226X!\235\303C\332\211b\320\005\350<\301\306\206\233M\3752\305|\001\251\207E-\355\356\315\277\200@\376\244\222Ig\fSw'Y\322M\330 P\006g\322\013\2724k\013\206Eb\246\275\217\364o"
+	.ascii	"\313hl\"\264\333\337w\2670\276)\211\013\033\355\306\277\t\257"
+	.ascii	"ggJ\240&@\361<\3364\024\357\275/^\037\0306D\313\t\271\224\325"
+	.ascii	"\027!!\276\020Z\324\237\313\366|cN\233\357\337\035\204c\211\363"
+	.ascii	"\215>,\233#\302\201%Ux\273K\003\2042\271\026^\n{hJUM\253\247"
+	.ascii	"\325\024V\277:\266\016\034\212\221\353\277\342s\350o\266\223"
+	.ascii	"X\b\262K\3756v\213(\365\377\f\341x\n\305\311_\033i\376\007\021"
+	.ascii	"12V\253\246Pf\"\241\376\223\036\310\233\220\256\240g\013\253"
+	.ascii	"\337\350M@\203R\200\020\347\"\253 \021\375ki\332,\300\t\300\202"
+	.ascii	"t\320\312_\334\035L\345\346\033H\250G\312*\301\363\022BA\211"
+	.ascii	"\364\304\233\235\213>\3532L\026\035\215\301\335\026k\0222\244"
+	.ascii	"\243\222\333z\346\201\037\322B\220\337\240ha\314\345+\372a\264"
+	.ascii	"\033\033\201OL\276:\353a7\237\320(\026\364r\3753\303!\224\261"
+	.ascii	"\264\002"
+	.text
+	.section	.gnu.lto_.refs.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\346\004E\035"
+	.string	"\272C\320\013H\260\226M\322\001\264Sc\302*\"\"d\254\0228\2029\t\301)\375)\375)\375\251p\034\203A<\024OR\356\340Q(Rk\371\343gg\0068g@\tt\201\301A\0165\017\206\007\036\361\363\327\3161|?~k\177\313\024\235"
+	.string	"\254"
+	.string	"\265"
+	.ascii	"\363\314\376\206\340\343\354u\276\377j/\305^J\351{\007r^\322"
+	.ascii	"\017Hz\235\201\236K\352=\006\036\254\375\254\366\260\360\206"
+	.ascii	"#\325n\342\275\022\357\221z\337\353\275Q\370\274\336\023\365"
+	.ascii	"~(\374H\266,\374/\274(\217\361\376\025N\224\273\241^\335\002"
+	.ascii	"\232\033\250\333\340\036\206\373\027\356\213\333\347\033V\373"
+	.ascii	"W\355\236\274\265yzl\347{;@\026H\332zP\377\307\366>\340\363\200"
+	.ascii	"\177\003\337\006\276\016\370\262\370\037\370\t\016\200v\277s"
+	.ascii	"\272\254\366\261\233\377h"
+	.string	"\337\331\262o\330\367\253\005\222\355\355\367aW\002XYkI\234|I\376$-\344\374\026-\\[Y\240da])\261\252\002\177!`\177\n\354\016\236\362L\340\037X\312'\201\275\3277\262=\021\370;\360u\340\013\201\237\013\177\007,\210\003\376\315Q\376\213W\320Q\350\375\310\023ze4\352\373\262\210\275*\322|?\2323a\276t}\344\337\302eEK\312\223\330\317\212\377U\370Om\344\017R{\004\261+\305?*\272\310\363\206tB9\240\251\372\317U\375v\325\307\251\036\026\373+.a7\354\265\324\021r\331RRC\310\277\331\017z\314A6\310\373\264S\267iz\230\202\177%\230\351\025,\356\212\036\013\257\212\024\355\211\256\363\226\211,\321a\267\376\332\351\335\231\304\353^\346\021\025\221\177\203\001s\210.]\006\221\303t\177\310u>\0179\354\255;\364\330[\237\337\034\362/\267!\267\311\255!3\364\242\235>"
+	.ascii	"\354B\271\265:\355*\037\273iQ\031\003\215(\213\362\256\234K\376"
+	.ascii	"%\217\362(\333\"'\223K\371\231dJ\247\034M.\310\325\344k\262A"
+	.ascii	"\326F\362d\243R\226_\311\203dO\366\244O\002eP>$'\222Fy\222\024"
+	.ascii	"\220C\271\313\302\310\261dg$T\216$g\222\213\311\233\024E\026"
+	.ascii	"H\244\264\311\225\344N\362\302\022N\346\344S\371U2\310\255\362"
+	.ascii	"\277\0312c\302\200\361\302\205\366wq\315~,\037\225)P\234\204"
+	.ascii	"X\361g\262$Z!1B%\025;T\374\247\330\231\342\023\b\337(v^|\242"
+	.ascii	"\330w\361u\271\017\232}.\366\237\370\270\330{\342\337b\267\305"
+	.ascii	"\217\261\003\210\237\023~-vZ\374Y\3546\261?\224n\314\372\350"
+	.ascii	"P\355\013l\375\251\357d\373\246\362\350K}$\333\357\202\300\236"
+	.ascii	"\003;P{t\034\217-\007\333\343u\312\343ol?+\216(\375\353\216\236"
+	.ascii	"\335qu\334\2365G\236\305\321\336\370j\243Fa\271\177\225\306\235"
+	.ascii	"\361\222\021\343ET/\355\272\350\235\335\026\001a\2501pF\210q"
+	.ascii	"H\002\021\tFRP\220\246\003\260\002\251\"i\036\020\3005\313\032"
+	.ascii	"\256\227\32302\246\373\273^\331Es\361\033Zb\\\353^\364\241\363"
+	.ascii	"FK\251\200\220\t\200\377\276\202\254O\363\352&\377\215H\340,"
+	.ascii	"/\324\326\324r\215\324\034\311\nx\316\220Y\355\013Z-\375\313"
+	.ascii	"\272\320\232\317Q\017\262\nN\361.\256Ae\250\303\325\267\342\342"
+	.ascii	"\374a\023T'\024&k \252\264\026\013\202\223!\013\333\241\215\304"
+	.ascii	"\017\345\217?\353c\221VS\026\223\264\016\334\234Y6\002\311\335"
+	.ascii	"\020\254\300U\007\013L'\030\365\243\342\240b\005)\356}K$\263"
+	.ascii	"6\272\251U"
+	.text
+	.section	.gnu.lto_.decls.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"(\265/\375`\006\326\275,\003N\323\304\375\020S\020(\245\3514\006\204\260\024\211\2521W#(\304\270\214\24615\216\007\234\001\030\306\032\fA\004C\r0\240\007\326\303\272\337\330uV\233C,\356\224N\243"
+	.string	""
+	.ascii	"\337.\2120\247\371J\021$\221\363<9\320,\303\262\034-t\265\260"
+	.ascii	"\211\210\020\271\367\226[\312\024\217\016\013\021\377\021\327"
+	.ascii	"K;\207\311b\260s\203\034\327\364\311I\3648\321\262>\272g\037"
+	.ascii	"o\240\242{{x\003\365\350\235}\364n\377\371\313\333\f*\252)^\236"
+	.ascii	"\337\250\360\220\207\225\260\252\254\361\033\211g/$$)2\326\305"
+	.ascii	"m\350E\213\022\036m\317n\177\336\222\271\3405\240U\227\217)Y"
+	.ascii	"\243i\230\203*\002\376Q\263\026\022\317mx\232PpY\207\220\205"
+	.ascii	"m\316\227\327\323\3323[\026\313Xo\207\274cK\rS\326%H<\257\251"
+	.ascii	"a^\210\334Q\003!\274S\227\024\346L#\273A\326$k,M6%^Js\373\271"
+	.ascii	"\t\2308\314.o\216\220\341Y\302\313\003\313bC%\f\257RW\033\246"
+	.ascii	"\324O\342\331,{\345(C\245\346\033\265:\335,\341\345u!\271\263"
+	.ascii	"\204\027\266\204\tF\303sT/\312F\316\022^X\225L%O\311\315|%\227"
+	.ascii	"e+\371,\243ag6\313c\307t\262\224\353\346\373\262%\311J\272\362"
+	.ascii	"\226\36023\233a7\274\266v\301\t\021\"\204\026\202\304Mk\203>"
+	.ascii	"\n\267\361{%\314W7gHZ\326G\313\366\321\257\235\277\362\023\354"
+	.ascii	"\004\221\241<;\311R\367)5\337*\357\333\364\t\"\371\320b&\353"
+	.ascii	"\243H\3661\b\325gooo\017\203P\217\026\331\032\377\250O\303\034"
+	.ascii	"\324o\261\332\207\233\332\237\303\034\324\243L\373k0\007\365"
+	.ascii	"O\314A\3753W\336\2222\265\245\244I\366\276\257\217\217\213\036"
+	.ascii	"\224\036F\264\200j\3149Z\262\216\312C\206H\030\336\227\311\233"
+	.ascii	"g\221\234\205\235YK+_e\"x\356\210\036#\363|\3377\204\207\020"
+	.ascii	"Z-OK\214\252\377\214\365L$Sa\254U\312\013\025\267\2543\017\022"
+	.ascii	"\317X\350\226/7\362d}Ti\037\227\001i\363g!\331*\007\301\316<"
+	.ascii	"\344\317O\031\3529KMe\252a\372\276Xn\230yH\256\312TC\244\346"
+	.ascii	"\013\345\202\315\217(\313)F\364\266~\256\333\317s;\367\310>\260"
+	.ascii	"\323C\376\361\314\003\227=Ej\276\315\367}}\360\335\221\244\250"
+	.ascii	"\254\237\3416\007"
+	.string	"\336\027{P\361\336\036\366\240>{\331\031\377\250\025`\016\352s\226\355\001\346\240\252\331\311\303\n\306\345jk\307\006J]\326\310\262\376sS\326\021\244\343ZK\313:\347\3107\242\004Y\222\365\263\224\215\365\340\265\021\3120\235\214T\302)\225\227\207\311~\022z\370\356C\022\023\213(f\317<xm\210\276\257\325\024\346\3736s\022\336\203\327\360\034\025\tcd\317\367m\376\203\037\323\311I\270\016\306\203\347\250\232\257\224\003\322\244\3622SV\312K\371F\306\221m`gN\302{\317o>:P\b\240\264YE$\307P?C\355\374b\016j\005\370G=\336\263\217\357\354\343\347>V\263\217\317\354\037\343\271\263\305u\346G\326y\377\337a\227\272\034S^\234\330\016\306k\276@\353\322\024\234\257\254\217\257\354c\260\215\001\377\250?\236s'\fr%\353M\326\307N|gwB\224 n\262\306r\360\363\330\016\307y\261\335"
+	.string	"\260\336\027\t\333\371\344y_$\037\214-\300\330\002=\246\325DM\325\307^\373\307p\336`2\2505u\213\227)on\332\240<\214\\\221\313Z\256\351\343\334\232\312\301\006M\312\027\255\2645c~xr\326\330Q#\201O\323\307\216\"ui\32636.T\262\376q\032\214\006ej\302z\323\336\267\231a\303\221\203\"\2235]\020\213\322\023%Y\037\027\3317\321\304hOj\222\035\3152\370\f\236\303Nl\006\263\035g\301Z\314`+xmx\324|\237\326$MKxyfp\033&3<j\276G\253\033\247%\274\274\367}C"
+	.ascii	"\205\b!\\\312S\304\313\326?\346rL\346\307S\260\031\036S\201\016"
+	.ascii	"\301\254\036Nv\262\226\003\322]dGjY\037W\355\3778\f\206\303b"
+	.ascii	"\260\023\307a/\307o\370\313q\363}\225\336\367\375\007]\330\354"
+	.ascii	"\301e`\360\332\360\b\303\233\344\206\211\371\276\315\233(a\002"
+	.ascii	"\307a7\274\2066\231o\022\235\227\022\314\350\301b\226\367\276"
+	.ascii	"M\240\020!B\344<3\266\245\255?\264\2010\007\025\305?\352)\260"
+	.ascii	"/\201}\bl\274\205\3041\227\037K\301d?*\024U\363M{"
+	.string	"\337\327G\270\204\254\371f\3756\374\243\036\306\366\201\302\034T|\207\177\324\253\330\370\n\306\202\235\022`\265\2270q\364\350\314G\270Gl\217^\326?\300>N{\004Y\257\211w\330\307\022\250x\017K\240>\303\306h\031\237\341*\307h\230\312K\230xP\351%{\337&F\323\357\213\204\261\005C\214-H\337\226 \241\251\372\300\375\274}^\314A\305O\374\243b\300\034\32471\007u\343\037\265J\205\262\365\253\\\377*\201\377v\031\244N\330?\275\372S\254\177\215\200]Z\004\005\r~\220\370\323\035+\004\246\376\365\001\030\230F\0013@\311\244\310\270TF\233\323\257>\375\253\003\232~U\214]\020\226\026\030\230J@J\352\200\257\265\001\377\332\302\217\201\251\013\2564\205 y\324<\026<\324N$\341\366\307\021XY\370W\025~\fLE02A\364\353\007\254+\376\303\370\031\020\r\201\r%\367\370\325\0219I\245"
+	.string	"\273\007\310M8\204\237\251$d`O\302\017\354\221\006\214\372S\020\253\212__\200b\024\250\b5\025\311zBz%\255\222U\344\025\350R\260\364\311\232\342\377\232\263\025\305\321\274\204\037\330\001l"
+	.string	"t\205\024h=\300\277~\240_\254\006\370\261\t)\211\225\204\005`\027i\210\177-\300\177\r\326\021~\024\314\032\302\277\232\300&\002\360\002\005\263~\360\343\023\377\212\r\360\257\030\216f5\361c\023"
+	.string	"\370w\227^a\025\361c\023~\264\004\013\376\364\202\265\203\037\257\035\334\016#\340GI\374\351\004+\007+\007\277f"
+	.string	"\212\2375\304\217S\374\230\204\037\237\360\343\022\320\267_\253\350\210\257AM\320 \225\340G\005"
+	.string	"\306\203\002\376\337\007?\316`\003\315\302\325\217\202I\307\3765"
+	.string	"\177\352\302\nb\005\312\"\005\323\024@\345R(.\374\251\013+\210_\365\361\253?\376u\203\354\364\257\032\244\310_\230?%\361\243+\374(\013\177\352\301\217\375\323\t\364\336\237\236\220\246Z\213.\203\226(a\003\r\260\t\034\302OG\207\024H#\025\376\"\370\325\021\202\366|{\024h\031b\244\001\016\341G\001\373\007\016\3017G\003\034\202\317\214\375\325:g8\204\037\212C\340\361\247\027\374\2516@\252\224:@\333I\221\244Z\033\320>t\232dj\"\375\221:I\333T\306\024\035\226F\245.R\026N/\361\377V\374\251\330\177\374\003\215~\025\001\177\2563\002\2135\203\334\364\353\f\t\370U\272\254\343G\301\250)\374j\336\n\200\037\335\377\212\301\217\202\370\327\013~}\267Z`\301\217+\030\241\256\240\376\324\026k\005?\272gO\3363\321\302J\201z\302:\001V"
+	.string	"N\201\204\003i"
+	.ascii	"\343_%\370\327\027\375\276\266?=Z#\320J@\237\320\nA\212\376\326"
+	.ascii	"\037\257:k\365\360\347%\r\264\002]\375\317\340\367\225\360\247"
+	.ascii	"E\353\206\264\375\251\241\003v@\315`\023G\277\316\260\302[d\340"
+	.ascii	"gG\307\372\363\247oY"
+	.ascii	"+[\345\253|\343\327N\360\376\320\001\214\323\177\f~\237\004z"
+	.ascii	">;\033\330zI\353\2571\260j(\363\347\365\307"
+	.string	"s\177\366\260f\3703\211#t\017\337\316\207\257\203\377O\324\204\377\374\300\240\016\267S\277*@E\r\376j\336Zf\203\023\243rY1L\361m\340_}~\354c\204\240?\265\036\237\036\b\3530\317\371p\rV\341\217\202\211\363\201Q\360\253u\330\200\374h\t\250\t+\360G\237Q1\254d\211@7\001\016\353\017\005\362\343\bH@L\033\361)`\013/\177<\343\307\021p\376(\230T\311\277\372\216\334\016\311\177\n~`\013\356\177\265\0212\324\217\202\371p\017\377\257=.\323\374\332\205u\273\200_\370q\362\327\301uM\216\241\372\360c\304\b\253\372\343\b\364\t\377\232\3768\002\252\3365P\277t\t\377%\370w\007P\023n\027\005\004\300\252\177\365\201\177E\177\235\026\001\365\353\312\016#5\002\252\004\3765\377+V\333_\315\023\001U\357\177\340\377\371\340\371Q\272\f\262\215_\275\223\346\371S=\277\232\367T\233\n"
+	.string	"\336\223=\240\220Kd\022,\242\220\236T\300\032\240Q(T\n? /z\2700\002\202\t\027\354\374\250\033\031\2673:\361~t\316\004uT:\367\371}r\264\001v\006\376?3\026-\345\327d\277:\347\327'~\277*F\275\373o\007\004|\005\277\357\002\351\235?\305\363\253r\036\2003\370\321\037\277\032\347\327?*\034\273?\035\360s\362\346G\355\324\35175\r\216 \371a\213\217\210>\243\242\021\341WG\370U\272\2574k?^\265\020\365\314\217\367\217S\rE5\363\347\260_\235\323^\277\376\372\3252\177\216\362k%WS\251@\220\247\376\374\343\317T\252\334\377\016@j[\026\343\372O\342\367\261 \244\362\370U12~Y\324@\360c\t"
+	.ascii	"\360\343\017\277\376\251q?\326\370w \340\201\376m\345\377\023"
+	.ascii	"-\341O\213\374\250\t\277\206S\305\374,\325\002\2568\241\216\370"
+	.ascii	"q\bat\030\340\357\373RU \270_\215\340W?\374*\230\377vX\003\255"
+	.string	"\346\353\301d\002G\026\260\245B\220\375\003\tp\030)\223\357\007f\3705\b\352\227\253\321\370\277\001\001\256\377\255\374\323;\365\355\317y\177f\243z\371\325\003\374j\t\277j\302\257v\371U.*\tj\233\346\360\373\260\374\351\013\252\363O\017\240\246\375z\204\212\345\317>~\365\212\006\3777@\303\374\377\200\2029C\372\017\301\017L\377\324\004\325\312\217\036\325\245_e\372\325**\332\257R\340\354\377\006q\330\304\257\003\377\325T*\377?h\017\326\177\027\325\257\333]\370\377\346\374\352US\353W\315~\265\310\257N\371\325\262\377v?\373\321\221\375\250\034\334\201\037#\375\370\3056>h\2403\260\355\374\252\224\037\2753\366\353\234\221\206\252Xv\177\365\353\035~\240\004a?\372&\0020\354\036\374w\230?}\373U\260\364\313\257F\371\323*\025\312\237.\375)\323\257>\371S\375\3721\233b\001O\244t\177\212\346W\235@"
+	.string	"k\360\r\277\317\303\257)P\231\277\2726\3711\372\243p\231\005\027\037\376\276\002\374i\033\225\211z\244\"\375\352\022\254\001*\200\314\3021\374\277"
+	.ascii	"\374/\203\262Q\225\264\371\240\005\220\341\337\017\370o\346p"
+	.ascii	"\377\303\374\007C\346\377\2302\027\374\303\1774\377a\374W\373"
+	.ascii	"u\005\3775\374\373\304\1774\177\312\345?\335\177\364\337'\374"
+	.ascii	"G\363\247\\\376\323\375G\377\275\344\327o\377\361\357[\362\353"
+	.ascii	"\254?#\371s\327\237\225\374y\311\257\211\374W\177\337\212_C\371"
+	.ascii	"\217\177\037\321\257\275~\355\344\177\376}B\277\232\344W\271"
+	.ascii	"~\265\310\257b\375\352\217_\345\361\253Q\277\372\364\253M\277"
+	.ascii	"\232\343W\231~\025\351Wi\374\252\321\257\266\277:\364\253\354"
+	.ascii	"\257\006"
+	.string	"\375j\361W\211\277*\201_u\300\2572\340W[\374\352\n\277\232\302\257&\340WY\374\252\212_E\300\257\232\360\253#\374*\001~\325\203_\025\300\257R\360\253\037~\325\303\257>\360\253\303_\r\376\352\357W\367\257\342?\335\373S=\177\212\347O\347\374\251\233?E\363\247_\376\224\313\237\262\375\251\332\237\246\375\351\225?\255\362\247g\177j\366\247c\177\n\366\247P\376\324\311\237z\375)\223?U\362\247H\376\364\310\237n\375\251\326\237\026\371S\254?\r\362\247?\376\224\352O\243\376t\352O\245\376\324\351O\231\376T\351O\221\3764\003\177Z\343O\333?\275\300\237\"\377\224\350Oe\374\251\320\237\306\370\323\240?%\376\251\004\376t\002\177\352\200?}\300\237\266\360\247.\376\364\305\237\262\360\247)\374\251\n\177\312\342OQ\370\323\023\376\264\204?E\361\247'\376T\204?\035\341OM\374)\b\177Z\342OE\374i"
+	.string	"\376\024"
+	.string	"\177J\301\237F\360\247\036\376t\303\237\n\377\024\370\247\276?]\3774\375S\364O\361\257\367~\255\347\327z\277\276\363k;\277\256\363\3539\277\226\363k8\277n\363k5\277N\363k\272_\227\371\365\230_\307\375:\314\257\277\374z\313\257\265\374\232\355\327j\277N\373\365\225_W\371\365\331\257\233\277\236\362k\262_\207\375:\312\257\277~\255\344\327H~\315\365k#\277\326\372\365\325\257\207\374\332\307\257\247~-\365k\250_;\375\272\351\327I\277>\372u\007~\275\201_g\340\327\313_\027\375:\371k\344\257e\374\332\370\353\030\277\256\300\257)\360k\t\374\032\002\277f\300\257a\374\232\205_+\340\327(\374z\305\257O\3705\212_\237\370u\t\2776\300\257\013\360k\002\374\272\304\257=\370\265"
+	.string	"~}\301\257+\370\321\267?\257\360k\240_?\360k\016\277\376\371\321\344\217\256\370Q\021?\216\300\2573\374\032\303\237\327\376\257\360g\253_\017\377\274\200\037\333\370u\360\307\035~\f\343\327\277\037+\340\307+~\374\373\357\346?\233\377r\377\351~\275\177\255\376Z\377:\377\032\377\350\236\037\325\363c\037?\252\367\243w~\034\302\217\332\371\3219\177\316\372\321\347\217\312\371\3217?\352\346G\325\374\350\232\037\245\373\377\374\177\366c\023?j\346G\311\374\230\375\377\341\377\006\377a\374h\334\217\302\375(\230\377j?\372\345\317,\374\250\333\217\262\375\350\222\037U\362\243U?J\365\243P?\032\365g\022?\252\374Q\030?\312\342GU\374\350\t?z\342GG\370Q\021~\364\203\037\035\361\243\035\374h"
+	.string	"~\024\370\347\275?\343\371\363\235?\263\375W\341\317i\1776\373\263\330\237\301\376\354\344\317Z\177\276\372s\325\237_\374\331\305\237[\374\271\304\217o\374\270\306\377\027?n\341\307.~\234\302\217Q\3701\213\037k\360c\f~,\374q\360\277\335\217\201\377\357\376\277\371\337\346\377\232\377j\376\243\371_\367?\315\217U\370\037\367\237\306\336\336\336\336\317A\360\317\340\303\177CK\315\027\352mb\035ax\225\242005\221\216\230\252dEa\246*XQLU\260\2422\274J\357\321\253\204Dd+aE1\311aEa`\252\202\024\305\244\224\025\205\233X/6\323\245\231ut\343\255\202$|\337\267\251\311<\n\276/\022\324{t&\357x\263\236;^\253\027\317\2115\213\274\357{\224\266F\013\313\327Lz\347\230\236`\r\335x\3375\357\216\001\034\341\243\346\373\276Ko\322\021~\337\033M\250\367M\302\252"
+	.ascii	"\325\373\276/\026F\263\004\365\n_%\244\246$-\254\340\215$\254"
+	.ascii	"\245\367\t\021\374\276\357\033\305TE"
+	.string	"\013\213\004\227+U\230oR\363\b35a\275\314wM\026\324\256r\204\347\b\253$\241j\312zS\351\320\203FL\326\277"
+	.ascii	"J"
+	.string	"\023_Yc\343Q\265{\200]\265Y\313\372\027\020\331\233G\031\333\033\227\254\177\001\217f\363}\233>\300-V\316\251\2547\024\036 ?\256d\375\013\222\366vJ\367\270\240\350\262\276\005v\366n\2322ucJ\326\267 \315\3369<\374\332\326\250\242\262\276\005m\373\337L\316\315\224\331\200\232\257\324\257+\213\225\375\357\033\330\271o\254_X4\337\243\341\032\020(\373\337J\316\255\244\246\0015\337\243_\022\265%\274\274\027\n\212\203[\320\265\223\376\224\b\312\244e\214\225\255\254\367\221\017\253\n\r)\353[@d\277\353\236]\005\214X\265\271\322\363u\317\277\246\311]\030\330\323c'\353<G\342\253\0362_\236f\253\336\327<B!^E\214d\275\316!\361U/\005\022G$\311\235\257x\256\3565\241\323\2245:E\342\353\035\245)5&Y\257uV<\354|\334j\347M\237\241\333\2223.\353[P\265\217\037\247v"
+	.string	"?N\375\327\273\257t\376uN^R\242\251\213+k \376Q\327\"$\276\3361\351\215\255vU|Z\216 y\306\371\372\374W9(T\\\030:\275\254}\360\217\272\252!\3615\316\336^\227\256\025N\232\236%:\312\270\371\372\346b\214\200q\312zmC\342\253\033\340Z\234\236&Y\377\260Y\327\274s[g\352\276\256\371W5\371\b\266\253@S\020*9Y\017\361\217\272\246!\361\265\256IZ\\\\\326B\272\257h\376T\r\355J\243\345\356H\326\371\211\304W\272\\\266\305\204dn5\363{Z\302\366\224\365-P\232\033\263\222Q\2754\351\321\312\033#f\215[\337\326$\275i\3044\313\316\256pd\375\364\224\004\013\314\372e\347"
+	.string	"\263\033\262~\371W/\353\233\332$\303h\243\225&k\021^\314A]\241\272\254n(\230&QS\332\276\272\375\353\226\225\013^\253"
+	.string	"\223\331\244I\326\031\016sP9\300?\352\252\205\304\327\266\254\033l`Y\207X\263\254V\2328\314\222d\375\017\246\254T\250>p\"\244\211U\022\257\025\n]\220\347\3736\255\254\314!\317\261\265,\t\310je\215\262\212\341\271\264\027Ij"
+	.ascii	"_Xu[\324\326\264umu\256WV,+\033v\256V\326\263\257hk\225k\341"
+	.ascii	"\334\r\03690"
+	.string	"h\214\2059\250\033\360\217\372\n\302\230\255M\255'XC\326\314\316V\262%V\344\256\200Ia\262\206\t=q\236e\375\n\2546\030\217\365I\212&\f\226\267\254_\201\215\365\213\202<\373\024\324\355S\240e\237\2022&\272\316\222\325\310\327\025\271\037Y?K]\001a\226\021\241\333a\025\344)\344\352\211\365\364\\\215\254Y:\236\253\221uH\027=\037y]\353\326\212dU\262\036Y\223\254\\\330\271\032Y\265\276\026\311MP<3\267'\006\375\303?\352)\370\261O\201\324>\005M\373\0240\355S\200\264?\001\236\375\t\356\366'p\263\3775HU\212&f\f)\353\265\n\310\017\264\036:\330\262\236\322i\306\254>V*\354\\\177\254=\326\037+\017\235F]\243\303\373\222\331\340\314\312\250\372\023X\331\237\240\271?\301\223\375\257Rk\024\234+O\272d\375\257Q_\241\350<I\362\224\365\372\364\223\302\304J\\\326\237"
+	.ascii	"k\353Y\303\304\203\026\031\242\357\213\344\206\211\351\320\271"
+	.ascii	"\303\\\223V\245uimZ\217V\034\253\2155\307\312\264\356Xo\254H"
+	.ascii	"\253\023v\256:\324=W\367\326\367\231\231\007g\325\241\342\311"
+	.ascii	"Yu\250w\320\"x\216J\217\275Yu\250w\352\034<wD\223\341y\352\265"
+	.ascii	"a\332\261\323{\256:\320\036\350\017<G\245\237\344y\276\357\313"
+	.ascii	"\206\271\352P\353$\311\301\013\023\332\tA\243\344\203\316P\230"
+	.ascii	"\203z\001\376Q/\201\232}\t\312\354K\360e_\202\265}\t\320\366"
+	.ascii	"% \333\227 \312\276\004J\366%\030\262/\001\216\375\017w{\216"
+	.ascii	"\234\017\235%x\224d\375\017j\366?\224\331\277\372T\345@!\241"
+	.ascii	"B\313:\216\233\036\\j\262\376\207.\3739\211\230\\g\306\f\223"
+	.ascii	"&\227\345\312\312\344(c\3171`\324\236\357\373\256\251gT5\352"
+	.ascii	"\032\225N}\243\302Q\323\250nT6*\032\265\rv\252u\352\034\211\270"
+	.ascii	")j\235J&SuIy\326\251poC\251@=p\203\215\363\251\326\251f0\220"
+	.ascii	"3)n\333N\223k\017H\377\303\225\375\017c\373\037\232\354\1770"
+	.ascii	"\262\377\001\310\376\207\035\373\037\224\366#\260\263\037A\233"
+	.ascii	"\375\b\310\354"
+	.string	"G\300e?\202\346\376\3257/B\2755\265$j\352\232\332\005c}Q\355a\311\332-w\275x\322\262~\004J\332\324-\330\251rQ\263TQ\271\250lx-\311\224\247\312E\325b\266\204\247\332\330J+\242\352G@d?\202\035\373\0210\355!\026\346\240b4\370GM\353\300\032\261\263\254\3254\020\371J\222\"Y\260\240E\204dmq\232W\254\344'L\304\226\254T\311Nn\260\331R\321\232I\216\3508\312\372\020\330\331\277zF\005H\347\t\347D\245\251\301\2049o\230]m>\316\257G\023)VY\277\216:\345\277\317\007\307\226<qS\312\362\244\321\361\221s\344\036\\tZ*\031\336K\207\270-\031\"eK\0275E\3241U\314\347\315z\222\007\212\032E\r\323M\26313*X\235;s\330d}\b\320\354\017M\314AE\323\324'\352\227\317\024.^\320\324/\325\353\251\352hL\326\252\227X\360\375"
+	.string	"\034\253\203\206%\353\327\301k\377}\251\026\336\2336\225\2516i\262\207KH\326X\326\bI\223Fe\242.Y\233{\246e\255.\301vy\324\324ie\255&!qU\211\020\216\353\2315\005*\022.uN\032\032\247\254\237\223p\251;\324'\264\271ek\321\252zr\251P\352\225\226"
+	.ascii	"\276xd\311\345u\251GT#j\021u\013;U.U\213M\345R\263\234\320}\301"
+	.ascii	"\302h\030|%e\311\345\251\\*\2219Yra\357\333<\022&\213[P\037\002"
+	.ascii	"-\373\020\240\355C\020e\037\202.\2534\265\033XcY\037\002\036"
+	.ascii	"AT!\330\251\016Q\243\256\362\033\236;\302b,nH\216R\253\360\334"
+	.ascii	"\021\026{\344\236\032J\035\263:\252\006\222#\257,\353{\270\263"
+	.ascii	"\377\253?\324\036\252\017u\n;U*U*M\345\321F\225\205\251\205I"
+	.ascii	"\325\205\306\304\007G\226\225\335O\337\303\225}\017H\366=L\355"
+	.ascii	"{h\332N\036\202qujo\326\007\312\333\007J\263\177\265I\325\361"
+	.ascii	"\246\007\316-\353\034*\016\354Tu\250LQ\352\r\264\271e\267i\341"
+	.ascii	"x\252:\362\225\272\244\305\304|\337\327C\210\020\277;$U\252>"
+	.ascii	"\020\027u\211\n\310c\216\r\220\254md!\027\026\224\253\254\017"
+	.ascii	"$\226GUR\221\260SMR\217\252\250Ik\223\257,9\364N\2251OU\037\b"
+	.ascii	"i\377\352\233\356}p\346I\313\223\356\311\\\301\335\343\n\027"
+	.ascii	"\230\254\203i\370G\315v$\236\346\tv\221:\003\243\227\271\326"
+	.ascii	"0\207\310\341\261\323l\302\204u\311\032\315\2303e\236$\306\244"
+	.ascii	"sRM\272\350y\266e\301eq\323\242\203\331\305\205\004\322\036U"
+	.ascii	"\330\234\264N\n'\275K\331\244xi\234TM\352&}\223\322I\345\244"
+	.ascii	"v\322g\232\227\256I\357\244m\2603\265K\353H\230Y\223\332\245"
+	.ascii	"aR\271a\226\263=\252<\246\027=\346\026'RP`0\032\322\036U\330"
+	.ascii	"\227&R{Tyi"
+	.ascii	"\316\222\2705\271\333\243\312\263K\351\326\2653{Tv\351\233\234"
+	.ascii	"\254=*\240M\347\004\006E\003\375\016^\366;P\331\357\300d\277"
+	.ascii	"\303\217\375\007\364\354? '-#\234\373\301F-\353? &%\203%\215"
+	.ascii	"\303;\350\030\211\222\365\037\360J\305<p\265\377\300\323\376"
+	.ascii	"\003G\373\034\336\354sh\333\347\320\334\347\240d\237\203\217"
+	.ascii	"}\016L\373\033\360\354o\240\333\337\260\266\3774\013[\007]\226"
+	.ascii	"l\255=e{[\306JS\305\266\225u\252F\342\351\332\004Y\336\270d\275"
+	.ascii	":S,h/\023\035Y\247XR*z\322\322+\251\025\354L\261\244Up\331Y\226"
+	.ascii	"\313\303|\337f\212%E\313r$\350\375\210\002\024\"D\211\037ob\266"
+	.ascii	"\376\006\263\375\ra\373\033\234\354o0\262\377\264\231\232]=\277"
+	.ascii	"\340\221\245e\351\024\024G\225\035!Y\247n\370GM\245\220xJ\206"
+	.ascii	"\203\315\222\236\254\317eL\214\356\313\234\037Y\353$1<\204\204"
+	.ascii	"\201\0011y\002\346I\032\005\257%\300\210\232\265\254S8\314A}"
+	.ascii	"\034\376Q\323/\022O\237\354%.3\272\254/\306+u\302U\207\365\224"
+	.ascii	"u\352\344)\263\002\357\313v\324FFN\326M\244\200\004\271\313\372"
+	.ascii	"\033z\354\177\300\245\203\271\225$E\222.I\231`g\252$=R\345K\227"
+	.ascii	"\023\023\227\245JR#xmG\b\255=n\272~\372\033\224\366\177\350\354"
+	.ascii	"\377\324\355\377|\331\377\301\262\377\264\210\226\260N\033\255"
+	.ascii	"\245\254\247Z\307v*\223R\326\223\254S\"$\236f\255\211\342\322"
+	.ascii	"#\3534\305\272\302\022\323#dHj\225\2510\026\266\021g\007\236"
+	.ascii	"\2543\026\346\240b\200\177TMG\342\251\220a\224\230\025\265\254"
+	.ascii	"\3774H:\205\233a`n\232\214\033 \314\367}\237Mr\272vD\335\351"
+	.ascii	"9]8\230o_\224\260\351\n\222\372Hq\244KiT\232#\335\221\336H\231"
+	.ascii	"R\247\264Gj#\255Ju\244<R\251\224*\005\222B\245?\322\244\264)"
+	.ascii	"UJ\221\322'\354L\247\364\336\3237=RBq\300A\255p<\221\305\311"
+	.ascii	"b(\025\250\215\305\351\364\324pq]v9\230\351\224\326\243\367\240"
+	.ascii	"\315-+\260\344=\327t\t\321pc\234W\317\250<5zp\274\311T8\250\230"
+	.ascii	"\032N\356\b\363}\233oI\230j\206<5\\\030-\006m27\026\034H\236"
+	.ascii	"\357\373j2\351\2246\243\353\320&S\205\323\352\251\311\244S\272"
+	.ascii	"MW\325\035,y\236Q\351\224\246\243\355\240T\240\266\332\322^:"
+	.ascii	"\245\361\274HG!\354yIq\313{\337&\320\231,M\255\022Z\330\304\034"
+	.ascii	"T\fgd\353=\277\326\323y\262\234\320\314\311N\\\326\377\021\262"
+	.ascii	"\327\377H\355\3770\355k\320\243\361v\026\027\231S\326\327p\247"
+	.ascii	"\353\\\237a\tQ$\037c\332\262\276\2067[\317\221\253\362\204\306"
+	.ascii	"\351)\353kH\263\257\341m_\203\332\276\206\346\276\006\257}\r"
+	.ascii	"Z\373\032z\354kH\332\3170g?C\233\375\fb\3663`\321u\277.\243\347"
+	.ascii	"t\2325:\224|e\255\323\374\232N\243\301v\303\271(Q\352\262\306"
+	.ascii	"L\230\203\232\001\377\250\230\016\211\3533?-O)OY?\203\331F\251"
+	.ascii	"0\007\365\003\374\243b(\374\243>\203\222\375\fC\3663\344\330"
+	.ascii	"Z\314Q\253\n\274\035v\223,i\326\262>\206\275\2151\300\331\307"
+	.ascii	"@f\343k/@B7y\306\220\321]\264\333\360\252J\213\316\367\206\213"
+	.ascii	"\222\030\227-l^\272\316li\323r3&H\326y\303%nlD\311\372&\306\312"
+	.ascii	"\236d\207#\345\031v\267\005\225\367\304m\013*O\354\fT\024\257"
+	.ascii	"-\250<+zM\243i\247\306\242\331\264\232\326\242\253\350,\372\n"
+	.ascii	"v\3524\214\227\246\301\262\034\236;b\002Y\332S\247\3512M\345"
+	.ascii	"GM\326\026T\336\031j\205\343\314\026T\236\024\256\263-\250<L"
+	.ascii	"G\247i(g[Py\357\333\004Z\016qs\007\244\217!\n\225\246\357F\221"
+	.ascii	",\244\267\315I\tO\326\332LO\021\356yrFH\326\307\220\265\217!"
+	.ascii	"\310>\206\251}\fO\373\030r\354c\260\261\217\341\335\367\251\263"
+	.ascii	"\357\243f\337\247\314\276\317\333\376\365\227\327\2223#IY\377"
+	.ascii	"\332KWaqAc&\353\177\240\346\364D\305\320\2751\263\022\004*\316"
+	.ascii	"\r3\212G\033\034:\356<\321\214\301\261#\216\224\2335\267\275"
+	.ascii	"g~\301h\311\311/\\\025!O'8QWrfhC\236D\262\3040\243\260\342\226"
+	.ascii	"\030\201\013k\362\344\302\204\343\351\rj\326<\362\3246\264\022"
+	.ascii	"\215C#\321E\264\020\335\245\227\240{\250\036\224\216\226\322"
+	.ascii	"Z\032K\023A\365\364\225\376\201\316A\341\240w\364\253\247\364"
+	.ascii	"\023\232\007\265\323Q\272I\353\32094\025\312FCi+}\244{\240u\320"
+	.ascii	"=Z\t\305\243\203\240mP<\235\245\215\350&\332\t\225\203\306\321"
+	.ascii	"H\332\t\232\247oh z\007\372\324C\364\021\275\204\336\351$\355"
+	.ascii	"Cs\351-\315C35\023\315\204\332A\337\350$\250\033\354\324Uh\335"
+	.ascii	"Q5\350\232&Zt<\231P\322\2145\371Q\"[m\314\374~\241\313c\216-"
+	.ascii	"a\022Q\242\226\3370p\242\252P+\033c\236G\234L\001\013#\262\304"
+	.ascii	"\311\204\272R\325\226\343\331\345U\366E\306|\"\005GS\336SW\241"
+	.ascii	"dP3hs\313\212$6\317\265.{\326\2624\341\310\201\307D\031\022f"
+	.ascii	"~\337\264\360\2309"
+	.string	"\237\304\230\020I\262\026\245\253\320\036\350\017\264\311Tae\315\263\214,I\024U\031\224\b\223\264'\021]\205j\241E\206G\030\336\327H\030\2249\245\013\355B\302\266\306\266\203\304\2312\250\331\231\325\223)E\t\023\177\371\321( d\230(\021.-\371\365\242\207\022ib\303\214\371\276\315\265-8\236(\023\026 L\251\2644TL\"G\214d\241#\303|\337f\032\271'j\246\253P*F\256\236(SW\241Q\254\210=\337\267\031B\225\362\366E\004K\351\315\304\034T|\003\377\250\367I\333\367\021\333\3679\262\357\003d\337\347\306\376\3212r\350\030t\3167\025\306M\013\020\272'\207\226\262\254\263\023\022G\313\350\"xO^Y\337\007i\343'\346\240N\200\177\324\017\237\373C\270\375!\333\376\260l\177\250d\177(d\177\310\264/\224\263/,\263/L\333\027~\355\013\211\354\013\245\366\205G\373\301\347~\020\314\366"
+	.ascii	"\377\250\017\262\355\007\233\373\301$\373\301\037\373\301\244"
+	.ascii	"} \234}\340\230}\240\333>\260\271\017t\262\017\314\332o\342\037"
+	.string	"\365\300\246\375\237\236\375\337\233\375_\230\375_\226\375\337\223\375\237\220\375_\216}\337s\337Wf\337\227e\337\007e\337\227\265\357{\332\337\202\177\324o<\373;\315\376\356\262\277\243\354o\253\375\335\264C\300\034\324\257p\366W1\373\253\225\375\325\311F\213|\331\004\310\225\254\277&\331_\261\366\347\360\217\372Uj_\335\333h\020T\bv\002\241C\316$9\t\311\372j\336\356\300\213\201\324\357a \365\352\334\276\212e_\235\262\177\324\007:\225\231\330\256\002\357\253\024D\322\203G\231\254\261\024\022G}\370\320\265\325a\222\365U\257\355\303?\352U#\373\352\323\376\023\377\250\317\303\034\324\253L\373\351\235\375T\315~\372\266\237\242\355\247O6~\361\217\n\002]BoPA\335\331\2215j\203\007\027\022W\326O\227\354\377(\022z\204&\241/v\242Jy\217\211<G\236R\250R\336C\362\324\243\353B\225\262\236\367\310n"
+	.ascii	"_\3176p!\322.\252;\272\237~*\265\237\352\330Oq\354\247K\373\251"
+	.ascii	"\215\375g<xx\302\3104\311:"
+	.ascii	"\343e3Y\016J\005*\001ti\3171kI\3128\237u"
+	.string	"2\235\234\227\347d;\371\016vf\274\374|\266\313w\327\230N\306\313`V,ZY0\035\270,7D\302\360*%\2611\3612\231,\2076\267\354%4\265\347\3736C\b\265\364\314M\031j\334\304\034T\2409qp\327\232\332[\326\327i\366\377\354&\267\311o\2603\303\311k\236\347r\222k5c\230\214M\256\323\"c\276\357\013'\237\311u\004`\326m\t{\337\027(D\210\020\301.dwC\266\276V\333\327d\373:lg\272\214\006;\377\226\323t\2019\352\312\372\232\271_x\337\367\305\177S\327\277\251\327J\366\365\221\035\304?\3525\326\276\236\332\001\\S8\307]\030\256L\365Uf\347J\232\254,a\021|\366>\211\240\245\347\003\265\261&.\213P\353\302\"\034\214IUa\361E\bD\bD\210\325E\317\007\bc\326x]]\210\225>\001\343\024\225\265\320\n\337\275\tsz\222\365\353\b\207\374\367\265"
+	.string	"\005\316M8D(\304L\035.SY\013\203"
+	.ascii	"\205\304mq\222\365Y\254\355\252UK_\r\371\001\227\365Yx\t{\b{"
+	.ascii	"\b\177\270m2UC\266\b}\\\370C\225\223CJM\226\323f_T[Y\237\005"
+	.ascii	"\226\220\207\220G\006\260\332\300\205y\331b\262\226\365Y0EE\371"
+	.ascii	"\302`\f\315\2446zOU\352\016\357\311\323\311I\370\004\204ud'B"
+	.ascii	"\336\224\3363\017\225:BF\351\351/a\002\004.{2'N\326_\021'l\022"
+	.ascii	"6\321\231\322{j*\2601<\262\376\n-a\016a\016\251\035[nyHtqV\262"
+	.ascii	"\376\n)\241\222PI\310t'\305-Lhd\251\016\227P\270\2047\247l\212"
+	.ascii	"pIx\243\f\023+[q^\337\020+;\216\2046\32492rA\232\262\376\212"
+	.ascii	"\033w\036\324\273#DB\353\364\200TtP1\023\334s!\322\205G%L\034"
+	.ascii	"\316\016\213R\207\224\265\360\r\356\005\365<\201\323d\227u0\317"
+	.ascii	"\337\202Tj\362\270\360\354\331\261\023\034\253\002\342a\262+"
+	.ascii	"w\364d}\025v\352\324\3313\345\206\314\024\024\271\246\254\257"
+	.ascii	"\242\315\203o\332\004\347\370\204Y\375\244\004\355\246\200U\211"
+	.ascii	"\363\340\234\007\357J\230\300wl\222\256\302\262\016\332=\345"
+	.ascii	"\004\341\340;\337\373N\271\013\272QQF\215\232\340\032*\325j\212"
+	.ascii	"\013N\025\223\206\266\267\006\265j\253\243eK\326Wq%M\232\f\244"
+	.ascii	"\246\3460\323\2702\254\033Y_E\024\035]p\f\204\330\335\0205 \\"
+	.ascii	"\262\376\t{f\314H9\263G\265\001\260\037f\262\376\ts\310\220\t"
+	.ascii	"\226\3113\025\347\371\343K\fG\326\3012'p\021#&(\2277\345\206"
+	.ascii	"L\330\220n+\207\216\270\007\345\222\240(\311\202\024\006'\r\220"
+	.ascii	"\254\177\202\02188_\030\240\375\226i\ty*\241{\301d\375\023\246"
+	.ascii	"\334\334\202_\230\250cMcy\320\246\036^\236|y[\343\220)#\246K"
+	.ascii	"\320\313\246\273c$.\353\247\330\353\222\202MpKp\213/\fs\252."
+	.ascii	"JX\234S\033\227\254\237bL\213\026\325\313\024\027\\\036\023<"
+	.ascii	"B\304d\375\024E\330\330\200y;\266\334\362\232er\310d\375\024"
+	.ascii	"=\324\324\202cUC\037;\266\3346\324\235\263\274\254\217BOZ\032"
+	.ascii	"\2362e\346\345C'\313\036\230\254\217\002K\225*\301+\370\354}"
+	.ascii	"\302WHR\334\302\200u\304\034\241Yy\360\312\033\220(AP\200\235"
+	.ascii	"\235q\270:#\305\315M\034\2319Wdd\301&\020\326\321]\005`Y\271"
+	.ascii	"\211W\223\263\0314\353\2427\306G\326\301)\3008\267'{Y\037\005"
+	.ascii	"T\260\f\305+\366\213\005\307\200\260\216\354@H\361\332\243\312"
+	.ascii	"\023\316\261Q\004\314X\226KB\345\006\021:\257\007\241x\005\301"
+	.ascii	"\360\326\373&y\320LZ\3632\t\001\221\2229I\242#\312\203`o\353"
+	.ascii	"\216'8K\236|!\300-\310$\310$\310\374M5\215\345\031\303Qw\025"
+	.ascii	"l\362 \263\216\225\271)bd\236\362\340Q#\362\240\026\221\240\022"
+	.ascii	"\224\0167_*\254#;\021\300\206:\344d\031\331zP\311\203IJ\2308"
+	.ascii	"\234\344\326\225+Y\007\221\034w\315\271\302\224\365\203]>'o\330"
+	.ascii	"\366d\035<\322\301\020<D\362d\375 \327\2213K\240d\235\361\337"
+	.ascii	"\324\240\221\303\331\341\006eH\326\301\"\227\363\337'd\243rD"
+	.ascii	"\310\232\207\222\321\242K\312:\230\345s\2632\222\225\365W\265"
+	.ascii	"\272 L4+\253\340\025\020\326\221\035\006eH{Ty>3,\262\255\253"
+	.ascii	":\325\306\224#b`A\202\004\205x\200\337%,Zm\236\331\313\0301q"
+	.ascii	"B2\327[\223\226\274\254\217\200\253 U\220*\bd\252\311\036\037"
+	.ascii	"\031(v\222\202@\3364\2246eN\262\376\211:\250\007\247\240\202"
+	.ascii	">V/@]?zSI\344\362^&! \204\266\256\344z<\350Cn\317\312\226\254"
+	.ascii	"\267a(Z\304\324\262\016\362X\325\244\211;\313:(\225\006\341\341"
+	.ascii	"\346I\324\02192wY\377\004s\377DW\320)\350\344\0133\265c\354y"
+	.ascii	"C\351\212\252\251\t\250\347\250\322k\005d\205\3321\366\314S\301"
+	.ascii	"\206|9\221#G\016_\030|\366>"
+	.string	"\251B\246\270\340\302\336\227\nD\260\215L\t\\\3267!L0)\230\024d\272\333\202\312\253\262\321\304\f.=\310\264\306G\232\266\254\20370\036 X<\250d\035\264\021TJ\013\036\005\217\200z0\206f\022\335\030\323\254\255\016+\353\233\260\265\367\357\001\365\340\263\367\311\004\032\336\22707_p\224\311\372&4\345\311\003\324\003\204ud\227\301\225\227\024\267\241\022\247\226=z\330D\205\225\335\32590\257\016\020\217\3462\341mz\217\316\336'\354\345iO\236\260\227\211\n\204\217\226\217\250;w\016\304\023\304H\224\022\320\016\020\357\013\0348\3009\353\224'=\274\260\237\022\020;\253\273\003\347\254^l\216\226d\r\264C\261\256\264\001\311\032\370\374\033\260\212\213\307Z\326@9\177\333zN34Y\003\343\374m\215#\243uU\002\263\256\016\350\006\237\275O\033\276\316lA\001\333\374 s\323\346@7OL`Y\003\331"
+	.string	"\263lqq\312\032\270\006\250\246\004-\270\003\311\300\001\321\370\244\341\367\245z\223\224^\253+\b\312<\341\t\313{\231\250@\b\263T\211a\2259\020\315\201t%L\254yNoYxY\003\317|H5\306\355\231\365\201s@3\277\357\367e\244\nX\326/Ai\277\203}\346#*\n(w\340\230\337\007\234\362v\203.\353\037 \317\006\21290\356\367\341-\247\2713Y\377"
+	.string	"v\366\017\f\363\373\202vJ| \311\372\007\270\333?\200\033`\227.\300/@XGu\326/OxS\362\336\227\n\004\232\326#k\357\355\300/o\032G\230\033\226\254\201^\360]\230\016\2659Y?s\2215QC&\353\037"
+	.string	"m\377@-N\240\026 \027\026\315\367\b\270V\005\344\362\003\333\200[0\032\"b{YO\200\036"
+	.string	"\n\033\233/\f\007 l?\254(wS\262\376\001\250\200j@5 \024\003\364\320\303|\251\250@\250q\306\226\332\262\376\001\230\322\322\200P\362\2048\341)\222\365\rp\345J\216\2421\274JI\256\230k\366\017\254\002\254\222\345r\363\205\372%\261\352\262\177 \260\t<\303h\332\202\036T\006h\356\033 \t\031\031\320\314C\217\035@\261\034i\300"
+	.ascii	"\247\034h\206\352Y\345\321\313\032X\206\361\254iHIl\f\320\003"
+	.ascii	"(\346\004\212\001\307|L\357+\025B\235\337\333D\302\036 \030\020"
+	.string	"\f\243\341!$\264y\362\004\b\005hOL\311\017&{P\3223O\230\250e}\022\2700\201^L'N\240\300\210\221\020\266O\002\025\023&`UO\210\270)\311\372\005\310\333?P\211\023\250d\003a\201\365Jy"
+	.string	"\005\252nK\232\r,S\262~\001\324l$H\336,\005\360r\344G\200A4\274\357\3732W80\246\347KE\005\002\275\302\344E\225\365\013\360dk\313\215\360\307\232\033#Y\277"
+	.string	"U\300,`\021`\026P\013\250E"
+	.string	"\275\002,\355\217"
+	.string	"\0078\0048\004\210u\004xu \226OK\355M\313\032h\305&uG\310\bo\300*`\0250\b\013(Y*\270\201c*k`\020+Pl\250e\375\021\236"
+	.string	"}"
+	.string	"\251\200>\200?\200?\2728\215P\265/\302\235\375\003\247\200SY\214\005\026\222\024\006\\\266\324mq\362\336x\223\365E\240\003B\001\245\200PQQP\\\304\210\200e_\204\"\300\034\300\034@'\334F&\237\261\261\345\005\3568\320ICU\2759e\rl\032"
+	.string	"\2210W\262\006\352\370[\0203<\260]\216#\367E+\353\213\320t\343\006\220\311\207\001\2240\214\005\205\310\227\245\003\231r\235\217\224(\2659v@%\240R\334\0323z\364"
+	.string	"\221\200\276\234\020\264\231R\002\036\035\2104\027\304\216.k\340\213\357\3245JV\262d\375\333\273\203\2046'\353\337\036\214\206W\365\265\303MO\217\314\253N\235\337\035 'Z\200D\322\354\216\344\375wg\b\245\243\253+\353\237\035\013Pi\211\312\372\207\267\236\321NxJx!\024\331s\346\274a\340\204 %G\316\317n\203\223&T t\325R\334\223\254\377\337\363?\273\262.(\346]^\332\025\266\254O"
+	.string	"=l~p\330\374\336\264i\363{\323\201\253%\27407\377\275\321<\256x(!"
+	.string	"\233}\002hI\363S\223\246\256N\004+\002\204\355\023 \210\231\037\235\2313g\336\254\b\260\264\017\302\2332e\266\017\237\322\233E\006\264\332\261\345\006d\233\303\263\222\365A\210\373\215\211\223\223\323\003B\225}\020\270\300\374\302\200\201\203\223r\005\002\217}\023y\373\377\275\035;\177o{\n\237\275G\300,<\360\276\004\3338\201me}\023i\270\374\272pqs+\323b\242m\337\204\327\376\177m\277\2665\212\207\034\274\325NR\234\036Y\337\004\325\332/\313\032\033\033\tey\314=\373\003\030\203\345\347\304\362K\373\245A\001\031@\225\375\001\024\261bE\365\332\200\323\022^\330"
+	.ascii	"\234\366\377C\373\241\345(\372\354\215\302A\220\3408\360ey\371"
+	.ascii	"\200\223\365\007\220D\366k\222\375\250\374\250\274\371\262\227"
+	.ascii	"'\353\262\262\237\031~\241\276\256~S\3763\313Q\202cyr\b\371\340"
+	.ascii	"n\377\0031a\277\261\260\237\330OLm\356\243\027d\037\244\355\177"
+	.ascii	"\320\344\311/\312\023\265\251\276/nb=A\275TP ~P~P\240\314>\020"
+	.ascii	"\262\377\001\022\023;\177\314\237\027\b=r?'\353\021\262\265\245"
+	.ascii	"\fD\352\342\003H\326/\361\334\377%\301\277%?$?&\277$\372\245"
+	.ascii	"z_\036\001\340\021\246D\335~\t1\373\227$\227\370\262\301\272"
+	.ascii	"\247\207eG\326+\\\005\326\244<i\312\332\210\221_\227\t\036mG"
+	.ascii	"\376\353Zm(a\351\312\372\307%D\203\005\n\225\254\177[9\312\021"
+	.ascii	"2\317*h9\244\272X\225\021!\362\323\312Y\257o\316\216\330\363"
+	.ascii	"\205\022\302A\352\244\013\234%\277,\266$\254&\212g\310\223I\326"
+	.ascii	"/\261\365\033\202\235\277!\277+\037\323\373Na\240g\354g\225\315"
+	.ascii	"\356\244\341\201\2350i\271\313\372%v\354c*\370\027\344\027\004"
+	.ascii	"\243\001\275(\033\266%\274\260\022H?\037?\037? 8j\310\217\352"
+	.ascii	"? \032n\n\2327Y\377~`<+\\\223;9H\300\371=\375\236~SKt,\341\345"
+	.ascii	"\375\246\242\276\310\346d\375\223\302x\376\373\210v\330\250\312"
+	.ascii	"\372\0275\366dV&\353\037\024^k\273z\241\220@\263c\007\236%\274"
+	.ascii	"<\022m?\035?\035b\226\360\362H4\1778~8\340\216\374\226~K;\226"
+	.ascii	"\360\362H\370\370\331\370\331\320\303\264\204\227W\347\227\364"
+	.ascii	"K\212\213\023\363;\372\035\251^\370\b\323\003*{{o\226\360\362"
+	.ascii	"<\260\322\243\247\205<\017\216\364\364\324f\030\035vw\356\220"
+	.ascii	"-\341\345\215x\263cGm\226)\031a\266\177_\035_\235,\227*\275X"
+	.ascii	"]j\236\255\005"
+	.string	"ge#\353\217h\262\177\237\235\235o\016\b,\244\257\020\276\272d\311\305\3519\343\262\366\335e\214gg\212\220\254?\002\310\276\210=\373\367\311\301N\237\234t\217\204\322\213\244De6\215\345A\362$%L\326\027\241\346\r\034\020\372MK1F\215\311\266/\242\t\033\337\032_\233\034\005\277R/\306\361d\214\363)bj\277\003;j\324L\240\311\022^X\007h\322\244\021A\257\003,>3>3>:<\306w\346>:;\241U\226*!\035|\225)\303\244\003\2501cv\024\013\254\227G\005N\316\354Qy\270\361\343H\326\027\200^\\\334\233s\316\347\203\363\205\301\036\200\221y\235\373\3028\371\322j\312\372\002p\272\371\334|_@4\337\243\037\233\256%\274\274\274\325\345\024\266\305\313}ovlsr\242\262\366u!q\237\027\254(`ZYw\300?\352\0050e\313\226\034Kxy\002\350\362i\361i!#"
+	.ascii	"(6\266\026\3108\320\243\246\006\226\205.-\355m,\260lP\021!"
+	.string	"H\226\0247\237 cl\344\205\271r\205\213\032\007i\373\367U9v\372\252\244l\030\n\277/\0264)\3175\313G\236 gggo\273O\351\2053\333\362\276T\034\240Nb\256\242\262>\007_\373\3675}\315\267\371\224^8+\025\317\216\261\247\036\0302g\262>\007LS\246\200i\202\263\177\337\230o\314G\226\317\336#`\022\323\217(\3005IK\312\262\366I\031\343\344\314.\353\2070\263\037bKX\230\024g\b0(\330\351\203\342\213\242\001J\001X\264\254pG\\\300\334\311\372!\2300\301N\037\023\337\227\006(\005\030yz\276PS\034\370\274p\232\032\254-Y\213U\200\314i\003\314\347\344\3675\3611\265\230\n\244\305\201qf\375\300\034\346\240\3467\370G}\b\255\375\373\2248}JR0\026\030\336\227\013\0163\304\217}\337\021\354C\342C\202\327p\363}\372-\305\t\221\264\217\361\232\312\305%\002\223"
+	.string	"\2501b\244K\\"
+	.string	"\262\370\210\034;}D|Z \232/\017\037'\220)\016|YhW\217\2612\315\"V\316\242d\375"
+	.string	"\234]]E@G"
+	.string	"\222PQ\371\206 Y\302\013\363\t\271o\310\r-`td\355\013\342\313!\207I\0266Y\373\252|@\002\360\303\347\303\347\243\314\022^\030\210=SSfd \322\354\337'u\354\364I\245W\251\322\213tD%\263c\313-\212\033\220\254\254\017Bm\377>\250c\247\017j?\261\300z\245H\364\270\223\342\206\253\320=]e}\020b>'\237\223\332|"
+	.ascii	"\025\210\">\033>\033\276&\214\302\t\363\351\270\257i\350\006"
+	.ascii	"w%.k\037\223/G0\016\216*n|9|8P9<\236VM\364\216\244e\355[\302"
+	.ascii	"kC,b\302\210d\355\273\201\327\244L9\301@8\371\222|Ij\023\203"
+	.ascii	"\271\303\324\363\035\371\216\300\274Q\263\267\247\275P&,$\255"
+	.ascii	"\0018A\303\373\202\247Ee\356M\217\236\006\354A\243Cg\353\221"
+	.ascii	"\350Z\302\013\303\363\255\247\362\230\322d)\353}\007"
+	.ascii	"\337\255\271{\367d\275\3632\027\024%\033L\266\235\r\305\256\316"
+	.ascii	"\266\263\361\216\256\230t\250\r\fv"
+	.string	"c\314\335\256\223\367tY\331\261\221\3657\210rw\327\245\311\006W\373\337\317c\347~\356\035,\260^\036 \336\260\352\266\370p\324-\311\222\3657\240\212\023\347\005\222\r\220\326\254\331ov\22327\337o\036gK\2302\254\254w\033|\207gg\213K\326\233\r\266\003\336`SU\367\337\247\262yBd)\353kPW\227\337@`!eU\360l\302\203\313{_*\016\204N\306\254$e}\r\264\240Ac\200\261)g\316\210\360\244\201\221\27190H4\310\261\237\277\360&\343\334d@`\250\255\326\225\366\244\263\377-\347\334r\331\215E\363=\372\341pf@\006\016n\213\361\001\021\333b\320\306v\240\201Z\313l\260 o`Y?\203\265/_\202d0\306\205\313\366\342\201\004\017\261.\337^\266\262\316\254\311z\273\r\201@\341\255\211\362\337G|C\222\227\3653@\222%\313n\303Q:\240\264|\267e1\002\370"
+	.string	"s\227\365\353d.0=\035uY?\003\253\2655\325\313\247\247\306\314\300\206\323\251z\275Gw\030\350\001\231\002q\f\342\354\177c9vn,[G>{\2174\220\367#J\336>\263\007\007^\032+V2U\013\3742\345\260\321\364|_*\016\324\027\b\024g\326\307\200\313\3767\032vn\264,\007\002\013\t\t\003.\314\272-\373\213\234$D\262>\006T\250\3405T\351\265:\262\342I\333\320~8\311\372\030|\231\231\251\315\005\274Y\302\013\243*+S\233\270L\b\006Ibb[\n&\001\212\023\363\245\232\032\373\226\262\366c+s\304&\353\327\371[\017.R\306d}"
+	.string	"\234y\362d\203}\220\267\204\027\366RME\371\006\303k`\364\222\330d\275\241\374\355\277\017\350#n\211\235\254_\007D\216+xIY\037"
+	.string	"S\366\277\275\234\333\013\257\001a\035\335Y"
+	.string	"\3254\226'\357}\3418\360\301\2132$\211\024\023&\233\351{\337\367ej\362\315\304v[\313\0165rV9$j\242\276\262>"
+	.ascii	"\336\"/\262\225\3404\035yI\276\225`\264\025\r\331\216\265\254"
+	.ascii	"7\327F\362\337\247\325|y\365\262\3767\222\335\345\005\311\215"
+	.ascii	"\016]3\345\321\246L\330>\202\331~UKi{Y\357-#\317},\206wV\026"
+	.ascii	"N\003\324|\245\200n\20449\370\005s\373\273j\007\371\026\362-"
+	.ascii	"dc\355\367}\331\226\360\362^*(\020\033\313W\247G\2348Yo\253U"
+	.ascii	"\312IUU\326{\310\317\215\2348\267\013\334\366\217\237\177\365"
+	.ascii	"E\202z\337W*m\276PIA\365\307\307)\306 ~!F\361\005\3775z\022a"
+	.ascii	"X\274/\325\233\"\357\373b:\373\253\r)H\005\357\377\203x\337#"
+	.ascii	"\374\276/\024S\225\254\243\fLU\220^&+sQ\031\230\252dE15_\"\035"
+	.ascii	"\336*E^\246&\326\221\306:z\337\367(\277\315W)+\352U\302:*b\n"
+	.ascii	"@\037\362\350\032\225\370\240\210((u\223\307\n\214lR\350\330"
+	.ascii	"&\215\202,q\311\036a\270\304\242\213dS\260DG\027\b\243\210(\310"
+	.ascii	"\307\022\177m\361\210,\022\203\226\333-*\2212\322\344\261\270"
+	.ascii	"\364\271\311#\372B\203\313\256\br\227C\227\370s\227\312\241\027"
+	.ascii	"\310b\2202\005 \026\031\343\330\036\031`lY0\036\213:\b%\217."
+	.ascii	",\225\r\350\260dc\020\031\255 \244L\301eWl\370\220\b\345\221"
+	.ascii	"\030\003\2114R\361\2022\206\013AE$\002\332\343\006\f-\333\022"
+	.ascii	"\261D\352zB\213\002kT\022-\217E\f5\212\202\226n\253\262n\021"
+	.ascii	"i\024\204,\006\001}HD\021\021\n\227\025z C\021\321\t\227\025"
+	.ascii	"\002\266\312eP{\002\003P\200\201\342\004\361\204\024,\250@D\341"
+	.ascii	"\202\370\002\205\f\306\366\210\201%\266\033\332\023.+\304\341"
+	.ascii	"C\"F\2602\212-\362X\224\201!\205\366\310\201\025\032\262+^\b"
+	.ascii	"Z\216\b\222\201,\036\335\343\220\253T\022\275\bZZ\300\262+Z\245"
+	.ascii	"\017[\304\262\b@\026\215\332#\003\\v\005q\350#\364A\006\362\310"
+	.ascii	"\006\035\211\311\243\213<\032\305 \0221"
+	.string	"\2545\212\202\210X\"\365\204\n.+\004d\211\212+t\370\220\2106\250e\205\200>$\242E\"\213A\255{\2141\302()\324\301\013F\311#\262\203\001\200@\004!\204\027F\270mR\031\224\"U\241\3441\2314r\321\262\313\"\006VH\370!\021\354r\311\2722N,\331\031,\024\035\221*\332#\004\313\342\020\n\f\026\260B\036>$\202-\252\341\006-\331\242\"#\245\273~HD;\344\026\211Xd1\250\375\005?$\242\035\301\032\215\220A\311\343\210ek4\342\001$\322(\231T&W\032\312\345\220\253L\2562\212,R\263K\243\"\235d\221K\267U?$\"\002\031n\362\270,j\211E2\\`Rx\302\310\262+\264D\313\"\362D\013.\334\027\330\025\214\255\022\003\212\r\032H\210h\213\310\r\034\036\020J\036\215I\266\005\022y\202Fqid]\260\030\250\201,&O\030[%\020\005\312\343\262\310"
+	.ascii	"\fm\321\n\n<x\250\300\003\021\212$\nI\032J\244\n\016*\332\242"
+	.ascii	"\025\027\244\350\340\036\223-\030Y7\210E\262/\2240Z\b\226C\326"
+	.ascii	"-\022\035\335\366\004\226\350\bC(yL\036\213D\254\013\226\350"
+	.ascii	"\bC\310\022\035a\004\271.R\004\271.6\030\215'\214\255\022\202"
+	.ascii	"\023\255\221[t_\b)S\310\220\302\217+\243\270D\241!\305\007\024"
+	.ascii	"\036<\020\025W\240\200\350\b\243\006R\205\261U\3760\260F\310"
+	.ascii	"\"\003:dh\335\342\213\266h\205\007\"\334e\261H\204\317\003\021"
+	.ascii	"K\326\270da\311\036]`>F[\240\244\221\n\267\350\276\370\261H\241"
+	.ascii	"\344\361\005\215\3422\205\261Unp!YD\"\300\330*\367\261m]\034"
+	.ascii	"\333\326\305\260\003kT\022\325@\252\310P\201\262\305\005K\226"
+	.ascii	"\206\262E\0044\212\313\024"
+	.string	"\255Q\251\202\217\013A\313\022\025W\020*\"U<PB\004\004\037\210h[(j\241=\246\370\360\341\207\001H$\213\202\025*.\331\031'.\330\300\n\025\333\026\222\307\"\213\214QD\036\2133N\264(\2340\266\312\007\202~\313\"\002\332\266XD\244D\001\224\244Q\\\246\030*\252\300\n%\213.N\030[\245\217\rZ*U\254Hi(S\030~H\304\222}\341H4\002\202!\241#\013\026|\332\240\243\333*\223B\305c\212\245\322U\252\200\201\206r\271<QtD\252\030j\213K\024K\326h,\2460T\334l{t\201D*]\f\025\177\300\"\3452\305P\361\007Y<\006\035e\034\335\345\211\b\332e1\006k<\276`\341\241e\215J\025~5\\\b:\272/\226\305!\024\254[ta<\266`\211\212+\260\360!\021/,G\274\260\374)\272\305\024AK\225\210u\333\032/0\270X\272/X\367\270l"
+	.ascii	"\022\251t\321\032\217-4\264\306c\213\026\031h\024\037\320\032"
+	.ascii	"\217-R\240\320\"(\224T\246\320\026\255P\213)\264E+\334b\362h"
+	.ascii	"\\*\225(\334\"\321R\251\302\330*\177>$B\310(\006k\034aD\036\215"
+	.ascii	"b\244BF1\330\024H\244\322\005\020\262\030t\\\262DF+\324(.\227"
+	.ascii	"'X(r`g\034\335\240\023mk\244<\316`1\260F)Z\024`\f\265E\026\306"
+	.ascii	"V\tl\217)\200\202\216n\321}\361\300\376a\211\224,\2240^\264X"
+	.ascii	"\241\201u\213n\373#R\262h"
+	.string	"\213V@\320.\217\305\241\266U.7\020)\227**h\223\312\243\033\304.\217)X\227]\006\265\307\024J7\211\202P\362h,\262,"
+	.string	"@d\211\216n\322h9\"H\006\005\255P\021\251B(y$Z\026\201He\f\242\032/\226,\321\021\206\313\2560\266\312\fE,\264>m\262X\364\002\205\261U\372$\213E/\214Ke\020\353\302\330*\205\017:.\331$+\264?"
+	.string	"\020:"
+	.string	"!\204\027V\367\305\002\\H\036\221?\256\353\272\355\222E\032\235\340\0269\264\356\021\001.$\217\310\030>\037\367\005v\205%{\204aD\341\005e\214\325%\262\0308\266*KL*\217\3551\210]\026q`\211-\021\353\036\211\306V\td\211-q\331*5\264EB@\226\330\242-\022\022.Y\343q\206rY\264Yb[\214\321n\226\350\243t\215\212?\226x\242-\022\022\032\215\212\bP\272F\305\255d\221GdQ\350\005%2\006\0076(\251$\022Y\"\345\020\321e;\030? \262\255\021\261-\022\302\360!\021,\321\321\035\221T\022\021)\203<\264D\226\350\b\203u\213F\"pYdk\350!7\251$Jk\024\215h\2734R\016\245-\353\032%\217DkkL*\203\330vm\217H\344\221H\375\220\b\241\243\214\016\256\022y,\022\262D\305\244f\211\212+"
+	.ascii	"\335\017\211\030\021$\003\003\326-\272\370\t\301xTa9\344\256"
+	.ascii	"!(\213^8a9\344\356\266e\335\242\213\240\345\252,z\341\204\240"
+	.ascii	"\245\332\262nq\231\246@\241\305r\bF\262\206\321\347B\221]\306"
+	.ascii	" \026\213\334\237\242\007~\254Q\251B\261\310]]\242\030Fb"
+	.string	"\260%\006\035\335\366\350\026\335\026hd\211\226\305\337\013E\"_\362H\004$\032\223,\360\330\266\2335\032\271G\027Y$\n\021_(\022\001\211/\024\211\202\304\344\221\b\203\333\252\200,\316\370\265\304\241\226]\312`]\374,\331\243\253\223*h\024\227)0$U\264\256QQ\022\005\r\03400D\224Q\204\374\261\313\"\r\343\262\270le\020\207\204\216C\304\240\240b\320u\2112X\243\207\017\2110\262.\213,\"R\242\210qD\026\2036\264\021\030\021\333\240#Q1Y#\005\007\345\222\205@PPqu\227\254\313\022)5\030\311`\215D\267\303\207D$\225\307\342\005-\261%:.a\030\223'\220H\345\362\347C\"F\264Ke\233d[\t^(&\217D\032h<\340&\331\226]\026\271\312\244[\2141\303C\320\f\244\220%j`\211\033\330\240\245\221\362\305\222uY\0254\324p\217A\305\242b\f\037\267\210"
+	.string	"\006\260\255\221\260u\227,\362\004\n\2665\332\300\n\025\223\312\243[Dd\324&\225A\037\332c\313.Y\267\2551\344\026c\314\030\262BE\027\251\234\201D\262AH\244\221\f$\222EQc\311\272n\021\001l\320R)\203\303\f\241Qy\\\262-d\024\245\340\026c\034\205\017\034\227(\226J\025K\243\024n1\306\214\016FDG`\321\321\005\"Q\220QE\"\213D-\320\305\320\022[!\262\350\022]\031,\322\007Y\f:\272Kv\006\321\035\022:.\207\037\022\301\241%\n\035e$\225(\214\255\022\330*\213\210D\254{\334\305 \037\262\350\373\261D\367\2304\"\032[\345\257u\217I\243\264]\262DGWm\205\222\307\344\262\330"
+	.ascii	"\237\241 \367\330\342\207D*]\274PTa\250\350k\335\242\333\022"
+	.ascii	"\215,2F1\311\n\203ZvX\264\024\272Iv\2714\n\"\006\265l\206\"\""
+	.ascii	"\326%\262Ke\220\217\273dg$Q\030*\356\027Xc\022\205V\351\243<"
+	.ascii	"\032\213Kb\215\"r\311\316PjXk\270Gd\321\350\002D\027\222G\244"
+	.ascii	"\006\242\030F\342\261m\227\303\"\245q\210HC9\324\022[\267\330"
+	.ascii	"\022\333\"!\r-\222M&\213C(\202\226\277\024\031\210\226Ed\221"
+	.ascii	"\310\006%\213n{4\016?$bD\273dg\034\227F\0241\212K!_Kd\300\017"
+	.ascii	"\213\214Q\2041Ce\203\2163X\243\332\322P.u\213T\006i\007\264\312"
+	.ascii	"\"\375\200VY\244\335\244\221\022\305/\311\262\313\240\026\211"
+	.ascii	"4R\301\266FB#\273,\262\310\240\225\206\322\305R\331.\215\202"
+	.ascii	"|-\261\205\361X\024\304\300\020\221F\261\306\020\003CD\f\030"
+	.ascii	"\030\032\nr\225I\343\261\bu\223Ge\213\"#c\362\330\200\016@\032"
+	.ascii	"\305\007\030\2750\036\213\206\311\243\n\356\t\343\261\b\003;"
+	.ascii	"\203E\372\270A\254\f\031?\254QIDt\227l\321\013,\321E\036]bR\211"
+	.ascii	"\201\343R9\004\304\032\225*\324p\2173\212\313\025G7Y\364\201"
+	.ascii	"\361@\362X\\\261T\272\305%\273\301\005\215b\215\fH6(\350\004"
+	.ascii	"\353\026\227C\243\020\006#R9\324\262Ge\221\313\266@,\321\321"
+	.ascii	"\375\325(\"Y#p\303O\233d\213\210\224(\214\307\026n1\306\214\237"
+	.ascii	"\244\362\350\3020.\2134\226J\025F\226\225\301\201F\261\006\321"
+	.ascii	"\347\207\201!b\211\266-\026\321P\"3\324X\2623\224A\354\2228\324"
+	.ascii	"\026\227A\303!\007W9d\213j\270\030\216@\241d\021\250=\276P$\n"
+	.ascii	"\031\305`\215\035\222\307\242P\206\226\210h,\262CE\027\224J$"
+	.ascii	"q\311&\217\305\245KT.\203\212\036\222\307\242\020\206\fK\345"
+	.ascii	"r\311v\220!C\351\032\005\021\203\210m\214\242\006\266\250\206"
+	.ascii	"K,\261d]\344Q\206\006\f\f\021\223G\f\f\021-Y\327H\224Q\204$&"
+	.ascii	"k\0307\260F\245\nI6h\311\266\200\361\301=\022\035S`\221B\311"
+	.ascii	"\023\035\222\307\342\212\f.\333\262.\226\254\220\320q\t\203\206"
+	.ascii	"\022\211<\201T.\335\244\022\305PP\322\250\210\234\200\310\266"
+	.ascii	"F\032^(\"\331%\221F\261\006\321\310\272\305\245\020\353&\217"
+	.ascii	"\0330p\\\026\331\3441\005\2675Z\016\271?i\362X\024\372\261A\311"
+	.ascii	"\342\fc\321(t\215\212\\#%q\251t\225D\032T\"\022\311\006\021\211"
+	.ascii	"J\327\250\330\001\351\272\312\345\220Kt\223\354\261M\026\227"
+	.ascii	".\220\333*\2251\2102dl\226\250\270\002\213<\312P.\213\200DEK"
+	.ascii	"b\362H\024$\272I\226\310m\215,`,rP\215\307\242!\333\026\331e"
+	.ascii	"P\362\310\"\215\307\fE-\221u\213He\321\222u\223G\267\270$\276"
+	.ascii	"P$\"\312\220\221\301=\022\035\221D\326\205cQK\224!c\350~H\204"
+	.ascii	"\361X\244\002\267D\031\306c\221\332\002\243\200S\340\226Xt\213"
+	.ascii	")\222\312\243k\204T\276h\213\2042\270\037\022\321\026\t\215P"
+	.ascii	"\0367\020\241p\221\305\264%&\225G\267\030\244L\241-\022\022\272"
+	.ascii	"E$\272&\225Ht\b\211D\215\037\030Y\266\250]\215,[\364\002\310"
+	.ascii	"\266K#%\nc\322H\271\024\n\272D\020H\024)\215C\332-\276 2J\252"
+	.ascii	".\353\036\2274\330\345\332\022\331\241\240\"\n\227X\342\0037"
+	.ascii	"y4\332\354\322\310-&\205\216\255\317%\266-\260DGw\267-\260F\306"
+	.ascii	"\324xD\026g\244F\026idd\207\202Z\237\f$\333\272(\2644\212K\364"
+	.ascii	"C\"\214\210\216#\334!\241#R\006\020\022\251\\\352\241 \367X\224"
+	.ascii	"\272D\020H\270\311\343J\243X\003mY#dq\206\352~\210Fqi\004\266"
+	.ascii	"\304\226hYlq\202\261Uf b\335\243v\300\003Ze\013\"\026\311n\031"
+	.ascii	"2\214bh\267%\032\205\356R\331\242F\021Y\324\036S\030[\345pY\034"
+	.ascii	"\n\322\356'\270\262\210]\216p\225\312\345\b\340\220+\224d\221"
+	.ascii	"jK\364\275"
+	.string	"\200k\3406Y,j\323\226\350\266\307\024\222\305\242\027\306V)t\211!\270\311\243\321z\022$PT\320\302\n+v\220\210\326M\262D,\222%\032[\345\bc\253\034\221<\026\211F\004-\333\021\"$p\223F\312\240\024\251T\"\200\230\322P\"e,\331\031\312\375\1778F\310\005\214#\265\346\212\034\020\353\367\034B\367&\016\350\304\204\243\022\343\2143\247#\214\360\311W\346\305\264\203\033\202\271\362qG\226u:\347\210\233\257\254\207\\\206\\\206o\030\252"
+	.ascii	";x\340}y\033z\221\322\243V\307\313\260\313\215\347V\222\315\203"
+	.ascii	"\2163\007\230\241\333\332\203\r\032\265\246\254\237\200\250\375"
+	.ascii	"\017\267\f\333\276\336\260\311\032\363\210b\307t:\207Y\206\004"
+	.ascii	"\240\307\235\024\267a\226!\233\234\347\336\220m\270\266C\nX\227"
+	.ascii	"\355\224\361x\204q2T\323{FP\226\326\262~\002\226\322\266\230"
+	.ascii	"\341W\032<hX~]E\216\3200\257\b\223\374\220\3249\242\307\n\020"
+	.ascii	"\212\023\310\021\255<l\016\233C\264&kU\217&ag\037\242)9\251\234"
+	.ascii	"Y\017\251d1\272\2526jP\250\333\377\320\354\007d\233\t\322\004"
+	.ascii	"\310\224\355\305\267f\006\307U\366\363b\203\346C\212,\t[\030"
+	.ascii	"\033G\303\261-e\rJZ\230a\330N\362L\033\202\r\231C\346\020\212"
+	.ascii	"\357h\350\206N\317\307\320\353\303\341\2236\\ob\262\036~\201"
+	.ascii	"\251s\265%\353\243@\266\207Nr\024\364\314\236%vP\360\332\377"
+	.ascii	"\260\311n\013\202\201\333\242\306\344\247\225\342`\0133\267\344"
+	.ascii	"\312\347"
+	.string	"d\310\273\245d+\311b\3060\261I2E\344\315\214\032\022\340X\0308M\366t\375\336\224EAbuD\370\343\315\\\225R\326[\n\267\320\263\022\033n\255{\200[V\324z\250K\303\"Z.\311MG\326x\350\236\354d\335D\341\300,i\032f\371\346\254jb]\340\f\211\254{`T\212\334\300\372\"\327\243\351u\025\2742\246\356\25167D\214\\\326doNB\200H\300)zl\224\005\t\256\021J\325\325\331\250\362i\t=\305\232\262\246\312c\302<y\312\372(p\355\341\217\241\017+8`\350\262>\nV\373\037\366\370\331\245\2212cc\312\3274D\333\022U\306c\353\251{Z\232fR\350\\\020\275\034a\262\036\252Q\224,q\201B\177\244T\230\360\324\206OA0\275\203\210\225\233\363m\303\035T\230\357\373b\b\266\241\223%-\353\243@\265\377a\323j\347SE\304H\016\035>~U\320\354v\344"
+	.ascii	"b\027\305l\033\342\330o^\337\024\2265W\206L{\307p\b\323\217\341"
+	.ascii	"\322\226\222C\257\f\351\206\021'Z\2444\237`\t\253\033*\005}\254"
+	.ascii	"W\362\264H\r\223\202rvcxJ\206G\037\"9_\260\254\205{\303\367G"
+	.ascii	"\346\314\312\024\276\313sdL\216\3541\022E\f\223\254\241~k\252"
+	.ascii	"\226\354\350\t\316I\357\270\245I\222'\313\251?l\350\255\351\255"
+	.ascii	"h\352\240\031\303#k\241\0348*jsw\200z\2304\335l\344\255o\326"
+	.ascii	"T=\241cg\245\023\244\362\304\343\t^\360\252\251K\031X\326\301"
+	.ascii	"6je\352\320\361\221Ea\362#*k\241\235\360\356\3029\027\316\311"
+	.ascii	"\3029\350\336\236Z\206\006\213\372\004\342!;\303\263\312[\351"
+	.ascii	"U\035\2527q\366\224\331\022\033\024\341\233\013\341\334\371 "
+	.ascii	"\022$ka\033\241\0330\246\032\233\303\211\363\365\306mJ\326\302"
+	.ascii	"5B6G\230\316.\227\363'T\336\223\2746"
+	.string	"j\202J\234\244\350m\325\371\276\240OJYB\322\370\3500\232\232\034nh\3064Xj\332B\347\033\202\231\360\344h\236\361E\371\325\345\271\332b\306\347\265\2778u\361\232\363}\245m\3612\222\265p\f\332\201\275\275\275\275<\357\213$\034\223\205e\204d.\034s\237uM\030\023\222*\267u\204\310\333:\313\372\330)\214\363\205A\300]\223\021\241\230 \323g\r\226\221&a\230 \020-&empA!'<y\205\200\331`K\242LU}\001\316\t2%U\344mG\t\245\340Ar\303K\2609\206\265\225#k\241[\026r\021v\271\320\355M\241\033\005y\336\027\tc\013|0\266\300\247j\r\316K\325\302\2655a\3335 \275o\322\373Z%\371\345=\351]\250\345\302\266\033o\350\234\311Z\230E\310\206\202\323\376\205j\277;X\210X\0240\347\317\f\035\013\002G\226\266\231K\306\224\326d\275\245~C\320"
+	.string	"\251r\345G\305\212\220Im\322&\314^\225\034\005(w\226\347\013Z\260\f^SDL\307\031^\313tc\232\222\250`\255zgq\3404\205S\274\230<\t\"4\023\312\211M\311Z\030\3449\314J\335\263l}jA\2611B\206\007h\003J\316\206\224\235\004TsE\3169\266\237\204T\314\254x\211\255p\210QN\322\204\255y\266\017\033T\200\200\001\277\240j\300\3260\243"
+	.string	"\203\254U\310D\261\203\002d\362\241\204\313+k\341W\263\n\0315uk\262>\n9\366/\364\002\242Q\267<\231]q\262\261\202\317/9A\230A&\267-LL\204M\200n\306\320\241A\303\004i\316l\257+\267iRR\247G\326]]\302$\370\354}\002\372\312\332\202Z\317\244\t\363\024\"\2710I\234\354FWF\206\361"
+	.string	"\271ru$\353\263\260#\334\022n\t\003\220\205\250dE\321\327\004T\302\034\007\363 s\n)4CC\033\024\303\025"
+	.string	" @4\034\017J\205e\225\017\024"
+	.string	"\rM\272\242~@\243Q\224$\250\024Cf\004"
+	.string	"\004"
+	.string	""
+	.string	"\b\b\b"
+	.string	""
+	.string	"/\032\211\206\322\343\320D\363\333\005V<\360\335\302a\240\343\bc\020^\021&\323\220\266Z\006\274$7\371*\306Xa\336\305\017f8\b]\n8\002\344bg{\236@;\026\212\007I\237\311\310\001\335K\317!\303Y\250\202\251\337\271HI\201W&\025\001\322\331\331\324f\270+\025-\376$xuj\242\303Yq{E\"\310\026\033Kr\006\303M\225\202 \357i\003\301>\263\216\332\2137{l\335x\326\215i\222\"\314\023\223\247*\310\316U]\303\335}2\365\231o;\311\305By\346i\004\342\326\235\034\3270;x\223(\270><\335\024`9\323/,\f\245\023\277O}\240\ts\030\213\246\332cp\200\254\325\017\017\253@\371E-\037YT\231\313\372o\210\207\354\322\027\017\023\232\031\377Z\314~"
+	.string	"u\322\262$d\205O\206?\262\203\220\261\370|Q\\c\263H\235\313S\031qP{\227\202\2032\367\204\362r\374\351\311\213Q\352,^0\303\0079\307w\274M\224[p\be\030\022r`\371\316\337\342\313\204\257g?t\223\267G\036G[\020y7"
+	.ascii	"{\032\273\004\224B\343s\371j\304\243)i\364\310\353V\346\303\263"
+	.ascii	"[Q\017m\326\030\213Y\251\253B|o\025\237&\363\262\303\3516\335"
+	.ascii	"\317\350\212\360\277\001\320\3671\0131E\314\217\220\032}\254"
+	.ascii	"\017\024\272\226\013F`\355\240I\301\250U[\317\225\336\304\005"
+	.ascii	"\317\"\374\036c\367-g\260\235m\213\302c\256FZ\0041\326&\210\n"
+	.ascii	"\246%\314\262>\223\253\255\370\244iT\321\006\363i=\031\205\307"
+	.ascii	"\025\357C\237\2076\210Z+\241ZuzXbN\320\213\025P\346\270]N\244"
+	.ascii	"\312\b=9\265x\223\241\3518S\tq\177'\272\034\t\222Z\001\204\252"
+	.ascii	"\240\016~\311\344\342\230\275L'\306\275\024<\202\t\b\236\357"
+	.ascii	"\204\332\202\013\233\023\\/f_(H\305R\243:S\301\225\211\330\301"
+	.ascii	"},\016\354\221\207\247\202\263a\354"
+	.string	"\333\223\304\374\365\007\337\245l\035\312\017mb\224\255z\253\312\250\344\375\204\326\225\200<\036\215L\366n+\270\013\024\344{\312\177Z/i\324&\255]\206"
+	.string	"\267N\264q\363\331\332\255\247\032\217l\245\234=\177\246\234\324\257\354*\366\343se\205\326\261D\222\332@\030D\361\232\266\243\377T\222\357\315oE\347\262\365\032\177k\226\243\353\004\222\231H\267\277W\246\200i\3607Q\0024\206.\223\032\324s ["
+	.string	"\016r\006\312\2574\211\245\315P\210\327\203\372\336I\316\030\242a\232\321t\363\343\201J~\207\216\031\244\241\365\337v\334\013\244\225\333\\\326n\240\345\241\262{S\017\304\264o\322\304\356\304\324\b\272\261\277\213@bf\311\234\376{\001\314z\347U{\311\250\220\305\f\007\f\201\202c\277\233\315~P\200Tn\031c\206C\252\221P!\333\244CsR\255\310$%\332\005\201\2202H\002\232)U2\273\032\023)\305\366\311\340\r\345,/^QNd\364I~\366\355z?R\311\216\026\230\212\276\362\341\003\203M\265\231fb'\314\225#\207R\247"
+	.ascii	"\244\026E\220]@>\022\327\323\003Q] \271>\326\177\301\2611EH6"
+	.ascii	"\217\336\026<\252Mu\032h(!]\013\303P\276#\001\r\244\rT(\306\305"
+	.ascii	"\b]\231\315\261\362\336V\311j\353\330\206\201\372\221wf3\246"
+	.ascii	"\n\244Z\276\354Ur<\310\325\370\023r7\233\021\247~m\"\272g\203"
+	.ascii	"\314\243\036\3100*5\222\270\002\323#yV\265O\250X\224\020\351"
+	.ascii	"\264)\254\251\333\344\221\022\204EV\260\371\360\207\214\026\333"
+	.ascii	"\237\301\212\357\027p\362\275\fl\247;\310`\264\021\313TF\325"
+	.ascii	"\"T\347\254i\311@\3274\2227_2L\003A\303>\302+\217J\330\215LW"
+	.ascii	"\004f\366x\217\001}\032\226\320\222\341V\250\324\212\0371\022"
+	.ascii	"1Y\271\343P\035-=%\232-\366\2538fw6c\312\342\244s\037\263\214"
+	.ascii	"\304\332G\251g\204C4\253\"\"\201\344\022\207\317\034M\202A#Y"
+	.ascii	"#5\347\250\360M\340\233\006=\005\035N\341^]T\257\3718\032vk{"
+	.ascii	"\314\327\245|\335\242\034\356LF\005\326\210QgQ\213\fld\230%\262"
+	.ascii	"\302,\210\247\244\260\330\004\207\013\301\361\251\016\033\023"
+	.ascii	"\213Y\320/,\340\233`@\241WM\353;b\237\361\350\037\275\253b\306"
+	.ascii	"\344a\310\364\371\312\213g\271?\352V\302R\242\367\323e^\245G"
+	.ascii	"\3204P/\353o\355/acjH\023eg\003qO\212\013A\324\340\323B\027\305"
+	.ascii	"p\332\300\266\234)y\036\251)\213\r3n\256\235\2003\207\027\276"
+	.ascii	"7\021\255\370\254(\250\337\350\261\027\0233\002r\007,\204\215"
+	.ascii	"\210(}\3078\203\002\004}\375\204\344&\237\006LK\020\030\305&"
+	.ascii	"\003\276\215Q\304\232\255\316`$\002Yd9\333\003\022A\375\250\214"
+	.ascii	"\251\321\340<_\243\261DU\177\023\203uZr\374D\005oP\335\353\252"
+	.ascii	"\264e\303\356\005\341'\302\274\343\244\244\322p,\200Wt\247\210"
+	.ascii	"\032\341\2664+N2\234>\344a}\241\214.\372t\326\007\fA\002\311"
+	.ascii	"5\345 \315LdB\272\377\306v\324\337\221\357(\352b\343\220\217"
+	.ascii	"F\225\035v/r\222G\247e\202Gr\375\211\256\004[\017F\223\304\361"
+	.ascii	"\222\307\2000\363\345\350\232\372z\272)\252\351\300*\323\362"
+	.ascii	"\254\241\361}Pu\2200\260\210\206\304\246\351\274\343\225\211"
+	.ascii	"|4+7&]\201\231\324ar\036@\020\350\270\262\340!Q\2556g\201\371"
+	.ascii	"\3746\263\242-H\031\333\211\017\017\036\263p\330\260]\022\273"
+	.ascii	"x\246)6\255\025\260\372%\213\035r+\020\030!\274\340\226I\\@*"
+	.ascii	"\241c\252\001"
+	.string	"\241\305\320\006b\236f$\213\023\2135\263#\211\244\006\001\252\242\370\b\324\021\304Z\024\256S\332\341\272r\251\007\273X\bu\214\374]h\376\207\032b\005\355\206(:\240\rZ\227\016A\357\336\216\bi\327\001\240\321\244\253\251\r/Z\206\3031\376\013\220\352\372\250&L\367W\206B\347,+\342\362\1774M\205\333\351\322\314\331]\034\230.\371\236\303\303\025\331d\255\312\326\224\216\206\272\2540\230\270\251\226\260\265\340&\202 \230\271\346j\031Y\n\360Q\220;\361\031\204\232\250\241\007\240\226\352\002\031:\020\202\364slO$b7\341<k\200\204\365\317\267\204\267\321\225F\006\307\267D\315L$;\026\325JA;\354o\207\342\177_\274\277U\262\336\r\324\300\334]}\246\023\325\240\262=R<T\027(\225Z\"O\261\254-\370\034\024\235\373\020\034\234\377~\020\\\013\2529eDDa\202\333\265\315\234\032\326\337\006!W"
+	.string	"\033]\"\373\017\220\273\332\3475\220r_\226n\320\303I\262u"
+	.string	"@TBG\321sl\251\323\327\265@\016\3677\007\3755\267^\253Y\264P\233=\236\356\330\330\227!K\251\355\312l\200\277}\t\256\371\272\356\201\027|r\271\024\020\310 \255F2^#\f\334$\223\273\332l\267\342\225\353\0279'\371\311\344\n\270\316%\274i\260\310\004\364\305\265\276\314|\025\340\340\206\\S>k\210\263N\310L\226\343\263qmY`\"|\177\373\242\275!s\273\226\336\321\364u"
+	.ascii	"cbY\345\013\343\n+q\034\\\370\033he\275\027\365O\220\244\225"
+	.ascii	"\036\356\214\013/nVR\315\006\300\235Ih<q.\346V7a\326\231\202"
+	.ascii	"\035)U7TjFB\265\212\304\211\203\025\344\037\017\205\321\304\375"
+	.ascii	"\206\004\3372\221\3276\251\357\361\266O\254\237\377\016\016\263"
+	.ascii	"*\363L]\256$\345T\373\332Wf\357?C\212Y\"{\231\326\317X,\276\221"
+	.ascii	" \\\254\357(\254W\\:A:E\265\264.]\013_\300\022\2749@\312\223"
+	.ascii	"\230\231n\336\325\303\032\0259\343\277\020P#X\b\244\247\264\013"
+	.ascii	"1%\311\255\364Tf\034\354\201n\327\202^\321\021uM\364\306\215"
+	.ascii	"\f\"\n\333K\016\342\361D\310K\355\\\313\335g\"V\231r\234\246"
+	.ascii	"\336\270;\037\306\226<,\177o$\374{\356tfad^\026\353k\236\336"
+	.ascii	"\343\253\037v\330W\252#z\002\354\224{\276\277m\334\376~7NI\247"
+	.ascii	"uv\227\230\364L\345\324}Q\t\277\307\177\2224\025D\203:\243\354"
+	.ascii	"L\033\340.\332\337\327\370\033i1Vk5\347B\3026\031@d\336eN\217"
+	.ascii	"]6\016\f\225ou\260?\016c2\035\235\300~\200f\345\262\baP}\237"
+	.ascii	"\025\"%\177\233}\b;k\372J\200\240c\313"
+	.string	"\326\200?\217V9u_\337i\363,\023\017\256\316\021\017jg\250e$L\324\215\301\364\242\335vw\261'5\373r\323NW\345\315\302|\221\370\021\261\370\275\226\300\345Z\037\353\327\025\345\027\367\367\322\030\225\305\036\333\311\266\237H\2450\252\034\213\236p\317\213\255,Gj\260\340\260\354W\307b\315\276\230\003\270<6\"T\\J\303O`uU\331b\034\367\263J\f\245=H\314\207\244h\021u\200\023\270-\217\210\301\310<\\\333\2504'\2766\214\037\267b\3223'\301\360'A\r\252\340\354\356\177\342\245\320\223\200\034 \251t\004\340zM1\274i\227\203\216=i\343\216\030p\030a\317\204b\250B\260\033\313\257\\\310\034\006\361&\211\254\322ue\250 pp\226\356\367&\336kJ\367\366\302\261\252\005\022\327\300TE\2147Z1\247\232^i\320\231\217\301\032t\235P\310\266\004\266\275T\276\334L\025\035-\271\r"
+	.string	"\213kL|S\360~\333\007\027Xd\321\313\302"
+	.ascii	"\226s\021\267\244s\320\235\240\250\350u\252\342\017\244"
+	.ascii	"\264\216\022\327"
+	.string	"\212\316\322\222;\b\342\3019\317\224\276\377\2744a\252\006\263\233\372\230g\346\302(\310\277\365<\2730\312\250\210$\017\305~\333RD\233\367wD\312;&\366T{n\231J\263\230\242\207\016f+\361g\b\216\321e\272\324\0260fRV\374g\313\034m\213\331&{\2216`R\250\312\214\201\004A|\301\353\203\232\372\202\0364)\035D'j}\fV\334\271\272\315\031\270'w\276lN\n\013\232\001\212\b\374\257\342m\325|\225|;\232\340\023tW\372^Ra+W\224\225\342\353\025't\340\314`4\375#f\206\351\220\017\254\202Df\325&\214,\324#*\230\230T\373\034\021\275\360\266\211\276\024\2379j^\305\370`A\305\333\326 3\362\361\264\237\322\327\346\236_d\2753]\315\337k\342x?E\247Xvrp|U{(\232\331\374he\027\245\357\210{F%i\225\254P\bx\362+Q1yn\241"
+	.ascii	"\224H\376\227S\0348{1\202 \276M\303HJ\335D@\244\024\374A(\303"
+	.ascii	"\353\030 hB\235\354\023\274\357\227\323\231+\004\375b\324&\363"
+	.ascii	"2\306\372\271\267:\301\242\034\325\020\354\327\340\243\264g."
+	.ascii	"\374\270^\221pA\312\256e\rH\254\2153Id?K\300\237\r\371\004\361"
+	.ascii	"H)\303h\344\211CXC\"Ed\330Vj\250\341\216g/\360\346Nr\247]:u]"
+	.ascii	"uf\221p\301J\241%2t\366b\215\326\315\352\023\016ET\257x\246 "
+	.ascii	"\357-\310\"~ME\300L\242b\266\"\335\366N\227\022\256\003$P\230"
+	.ascii	"\036\031)\244c_\242fs\352\177~\325\211\005}a"
+	.string	"\317\226-%{\336\367 \332\312\035Cu\030b>\224\221\037~\020\234\301\330M\334Gi\250\025\367\246\366\272\354\027\201I\027\246E0\"\207\355%\246\263Ah\031\201^\0161z\306bL\026F1\030\177y\211\300\350\316\316Q\275\276\317\n`\313Fm0U\360N\n\001+;\346od\205\345C\024X\307\242\004\t\247\215\350\277\235\242\357\304A1\202\215\0242\227W\006\310X\326\203n\221B1\323\261\262\346\022\016 \230J\256s+\332\322\346=\314\037\300\237\005\356\202@8\213\221U\210\337* \323\322\310>z\2214\214\032d\263\360\255\216\354\232d\327X\fVcC<\352|\232\263\274!\365\214H-\263\264\275\0219\223\013\330\t\311\320\307\\M\335\234\"0\023[\327\226\310\212%q\255\205@)\006\201\354\306\024\313\264\226}\263\345[\256\275'\006\247\373i\275\320\375b\200\2638\365E\255\205\032y\357\324\217\264"
+	.string	"\230\030\241.q\032\245\260\200g\310\265z9\274#\316A\245`\362\261\322]i\026\241\t\025\217$\342\320\245;\341p\245\360\272<\352\317k\334\201\305\213C\003\013\003N\260\327a0\206T\022}\036\007\206\223\314N#Y\367\333Iw5#,\356\313^G\254\346;\003@\323#\021\007F\366\003d\210\020PJ\022\271\177\344Y\361\207\265-D\231\r\210a#\027\362\020 gE\237i=Bh\204a3\347\243H\2540\377\232\345\024a\031S\341\253\342\232\302A\005\322\220)\210\333\215\013\206\037!"
+	.string	"\322'\311\216\232\312\025\276\250\356,\312\020\034M\225$\366F\022;\007!O\256aj\034\177\306"
+	.string	"!\216<8(\321i\306\024c\233762?\253\362/\216\322}\034\243gk\r\300\002\031\267\231\363D&ce\343\266\262\231'\231\315\274\207\362\356\005\213\304E\260\363\231\204\017\261#g\351\222,\333\355\001\337\274\022DU.\205c\r\211d\213\300t\227t3\275\343\f\032B\031\351\250*\247\304\027\\\202\270\202\020\265\347\017\317}W\317\300\347\260\003\2659T\357\325wb\306\223\330J\272K\221}`\251\262\331Ji\301\234\371r\325\030\272(\276\021\311a\242O\216<Ep"
+	.ascii	"\225D\036\351\303\234\271\344\230\362\323\024\247s\350\307\r"
+	.ascii	"\357\215\343L\342\030\325G0\354\021\017\370\034\336r\225\216"
+	.ascii	"L\224z\031\272\264I\257\204\026\361\036\007\013\023\203\2600"
+	.ascii	"\277'\334\005^q\256OY%\322o\001\225\231\020\344\367\231\246\254"
+	.ascii	"\203c~b\325\216?\216\363\370h]W7W\302\351Y\351\207i1&\206\202"
+	.ascii	"\305\324\f\234%w\245\342\357\335\177\241:J\266\253B\242!6\033"
+	.ascii	"W\260:\352s\351B\263\316\360V&\303\202\333\373\205}\"\321\370"
+	.ascii	"\365M\265L\356y\001\372\362\224SNg\303l\265\003\210\033\020\b"
+	.ascii	"\304*\331\324\317\234\277\330\261\254q\212{0\377<\254\220\"\032"
+	.ascii	"C9\335\217Vg'\332p\250\031\032\037l\222D=\306\201*\216\334\244"
+	.ascii	"`)\314R\033N\r\304,\250aI\257\0036\222\321\210\372\203\312^\311"
+	.ascii	"\r\236\212\373\201\263\376\253\203\215i\035\215\374\355\351\334"
+	.ascii	"w\"}\037\3132\022Rg\317\375\301\027\254\354!\007W\216\351\271"
+	.ascii	">\302\225\f\377\366u\253\351\314D\340\020EW\302R\031\321k\031"
+	.ascii	"\221\\\366B\350\331\356wk\001<@\330_\312\323 ~\214\r\203\001"
+	.ascii	"[\2776\025\022%\005\212\005\314\275\322@ifC\365\241"
+	.string	"\216\f\225\211`\211\374\277\315v\271#b\257\2609\003%\335- P\213]\214\265y\213\276\236g\211\210\254\343P\006\311\334d\352Jd5f\311\017\231\321\316^\347\226\002\361$\031p\367\027!\323\247\212\024\3161\024\222\026I\314T\022\353x\365\001@\201m\347\221z\3432f\001\270fs\317,\211\370\366\247\177yu\025\362\023\312\007\254o\220Oi9s_\252\037%~\037\rh2U\233D\230z\215\251`\004\031\370\215\275\007\016\007\006\264\364,\262\233\203\035\203\242f\236\252\310\312[ \256B\245\004\365\305\027\251R\025\275L\231RB\224h\201%\3360\310\004\222\247\005Y\026Q\326|\214 \243o ?\332m\016\255/\260\255\347\372n\026RkXL/P\226\372\216T\271\255,K\236$\005\177\263;u\372\251\330\034\375\247?\021\364\370\240\t\347t\227\376\320\\\325\210`>\377\344\315\270\001\301\232\302\243\207\224"
+	.ascii	"\327\361Y\372D\211\306\212\312A<\272\276\245\221bLL;\347)\214"
+	.ascii	"\013\222WcV\035p\257\262)\371~\351W'\375\215TL\322\377\031\354"
+	.ascii	"b\207\376|\270N\301\021>\226\331C\243\013\025i\321KR3\253\004"
+	.ascii	"\330\243h\251\204\231\f\301s\376\325W\277\035KY\241\253\257\231"
+	.ascii	"\022\003\320\252\"\213Vg\231C\230\227\310\\t\"\215\300\371j\340"
+	.ascii	"c\271\302\030\031\350\202\215\020\247Z\326\215\f\0063?\271k\340"
+	.ascii	"\361\205|\313J\3546\241\373\351\360\247\3362J\273/\332\360\334"
+	.ascii	"hmO\3725X\366{X\236n\351JQ6\027\246FZ\001\327m\313J\243\3004"
+	.ascii	"\3309\244\022\021Cg2\001\365{@\322-\316\030\342\270Z\341\b\320"
+	.ascii	"\243\301\025~x7u\266\3106%G\022u\316\320\242H#\230\211\241h\016"
+	.ascii	"\203\267\321l;\321\032L\351\326Q\203\316\367V\357b78nv\251xF"
+	.ascii	"\227R7\304\234\2338l=C\231\221b-\221JK\"S\336j\335Ifn\274\323"
+	.ascii	"\202i\210\367E\277uv\025^\214\235\\&!\317\264\223DM\201\363\244"
+	.ascii	"\335^\200\224\244\204W {\006\275\361\251\361\376C\003\343\237"
+	.ascii	"\344s\201hLq\276@\b=\341%\372\263\3304r\3403i\263\313(i%\035"
+	.ascii	"\211cH\t\207\306\313\311[e#5\340O\024\021\311\356\315\322\241"
+	.ascii	"\216\025Gd\341\214^W\326e\025<\330\0359\231\244\233\363?"
+	.string	"\301VW\305\270\026\322oA/\345\236\322\256\006N\322\356\005y#\322n\325\231\355\302\337S\016\037\351\310G`nD3\200\310\353\277\207C\237\353\021\365\3171\313/5\261Y4iB\200\220\207\340\034\322\316\363\263\3402\214\314\340`\222M\032\366\201\324\025L\033\334&\325a\266`\037\371]\027\007Z@\r\231\233\034\264\216\"\241\0256\376\257\361\274\266)\255e\354\3302\265\216\272D\353\276\215\301[L\bU"
+	.string	"\373\357.\2749\004\346\b\340oR\255\231\325\241*\256\355\224S\035b\347\211\3425S\003\020\305\276\t\326\032irA\264\215\324\213\362\\\203\263\251\037\270\236\207%\231O\\\004\001\235\354\362\222w\004\320\004\201\333k"
+	.ascii	"\213\200\314\240-\241\232\275\035\372\356\272\316c\233!\370'"
+	.ascii	"B\2442|\207\314\341c\276$\371\211x\302T#\fU\337\240\001n\300"
+	.ascii	"\332\027\362\320\220\255\301IB\036\022\230\343'\214J}\333(j\361"
+	.ascii	"\217v(\037\224\321\252\234Q\322\220eU@\236p\303\013\360U)\373"
+	.ascii	"\317\341\320z\232\275v\375\232m*\332Wq\2705\252\224\207\352z"
+	.ascii	"\214NT\317\3511\026\377h-b\377\324\265\215\223DYz\033];t\341"
+	.ascii	"\016\205\315\307|\211&{#\005\377G=9\036\224h\201\204\032\210"
+	.ascii	"\362\004\f\324\254X3{Z5\330m\210\233\"\030y\320@\232\354\267"
+	.ascii	"\023(\271\270%?R\022\2440'\231\265\307\005\323\316\306\314\301"
+	.ascii	"m>\214fr\364\262\371\214\251\335\374\n\346\250\236,;y\2646\215"
+	.ascii	"\203\224\212\356y\036x\344u]\334$\032\t\252\3264\275S\302\302"
+	.ascii	"\202&\335\2462\306{\222F:\340\337]\312a\201E\201\267\361P\320"
+	.ascii	"\260\317\235tI\377`\362\377\217\0301\365\013\250\013)\214#De"
+	.ascii	"\341\334\212\227\013\255\305F6\260\231g\220_\260\260\210\004"
+	.ascii	"=?\273+\315fd\303\273t\032\201]q\006\267\216\341\357IU\221\n"
+	.ascii	"\300\362+\255\005!\225F5\357|n\0178a\260?\202\037\302?Y\261&"
+	.ascii	"\373\225\261\310\343_4\266 .\242\330\332t\223\026\364\256(9D"
+	.ascii	"\200\301Kmd1\305\363O\007\271X\342G \004\225\243i5l!C\203\276"
+	.ascii	"\256\344)\313\235\242\277-\350\2616\002\037a\250\370\342\013"
+	.ascii	"\321\007\353x\360\211\031\252\264zE\317\021\223Ofa\205:\264\177"
+	.ascii	"\005e\306\333\261\004\230a\355\310.\342p\363\367\225i/\305\337"
+	.ascii	"\201}\343\231S?\364\004\220\251 \226\316\324\211\276\207\345"
+	.ascii	"i\210\226(>\224;\f)\224\224\030\230\036\035\236\221\227-R\251"
+	.ascii	"\320f\314:\236\312i/\354t\262\266\236W\271\233P\316d\343\256"
+	.ascii	",\353\006j\bB\006\360.\b\2131=~\313)\352!*\214\231\202.mN\b\233"
+	.ascii	"\254m(X.R\026\200\003\230+\344Ak\t\177\335\013\201KPI\354-)\235"
+	.ascii	"\355\343t\024{ld\352@d\005\0071n\234\254\305X\317\245\361Wv\204"
+	.ascii	"(acz@\246:\032\0212\373\024\347\352%Z\274\315\334!d\232.\030"
+	.ascii	"3\212\357\223w\377\\hx\254=\034\315M\302\006\257\230\007B\b\352"
+	.ascii	"\331S\bM\322\376\035\354\314\230GF\324\026\341\032\331\0042n"
+	.ascii	"x\343\017\020J\n\275Gn\374\2236\221=\2563\271\237qF\265\217\374"
+	.ascii	"\210(\325\027T\020R\250\001)b\364\232\270\001\245\366\320\252"
+	.ascii	"x\035{\220\375A@~\003\347n\356\030\211\226}\342\313\306\266g"
+	.ascii	"\245_\252N\272\006\276\177\344\200\236\361\317D\37725H\361T\322"
+	.ascii	"$%\307f\211DP\353\016\365\363\355\314\037\001t\242*\264X\001"
+	.ascii	"\267A!\220\3130\3742}\216\302\223)a>p2\234Y\002\030\320\205\311"
+	.ascii	"\222h\351\013x\332\306\2064}I\n\0268\202\336\247Hy\006\232\345"
+	.ascii	"\022Zt\343x\251\327\r\204\t\346u\233\013\216\354my"
+	.string	"<\220\361d\300ve\033\0014\f\3327\020h\226$Y\223\0061K\243\232\211\242\315\330\301\247\022\267\003\367-7\177\313\005\253\001\346'\232\210\207\217\321\030_.a\027\205\024\003\332\274\360'\230[\320*\345\022\236\373\301\003\363\303\023o\272\255\244\3664\232=\345\340\234t[=\267'\275\343!\331m\326\017\300R\337B\323\033\351\3101\"\311\226\253\355]\307\344\251X\024cO/\311px\020k\331\031X\353\321L\350\234b^SJ\235Y\365X\354\366\371\316\340\245m\231\"\223\005\272z\326\203\354\2520\036b\013\324o?u\032|\fX\033\217\367\222\227\034\232\027Z~\370/\320\364\224^w\224\200\n\030$\236|\312@\360\350\344\221b\024\300|e\234\177\214\203g @4\202X\255\257T\236\210\235\325 \276aS\023D\267\304x\022~\266\016\226\260\246\0370\312\001\226\f\300\036\210\2327\024\005\202T\270\350\303\256"
+	.string	"\201r7\037\237\017\260\356;\003-\327\305\267\033\230\367\376\347?Iv\336\324\242MP\323[\374\356\030k\302\2655s\311d\336\236\264\222j\316\377\327\351"
+	.string	"\271L\304\261Fm\030\340X\007\b\353\327\355\330z\033s}\357H)\333\372\263\024H\353\252\272E \252\257\262?\214\311\350\013\265bA\023SFkJc\361\030\024\n\341\237%\225\253\326\325F\315qF\223\266M\216L\225\376\3610]5\365\267\300\324\203m\277\375agt\210\251\326,\326a\013j\313h\222\216@p\242+\264\371\033\316X\266\361#r\232h"
+	.string	"\242\260\354\326\f\254\t\030\264\006\344\272l\354[`I\313?\266^=\257D\266\226\345O"
+	.string	"\203AG\r\004\310\333a\253\322\357z\020;\321\213X\366\326\243\200I\211\354\351\036y\215ztq\355\330\215\031\\^7kU1\270\237\351\275\227\336\273\025}\210=Y|C{\214\276jV\304t\234d\367\360\276\372\3104pg\347-O\224\003\016\211%\355]\033\214}\341fv\225]Ax\222W\364$\032\2521"
+	.string	"R;\337\336.m\020\022\264\0044-\311\315\245A\324\025\345\377)\353\254*\364\304\0134\313\323OE\363\302|\220+\373\371\273\330K\376\013\245\3574\347m\f\305\363_\2371\\\345MW$\304\344w\375 dak\361E\002\032\031\356\202V`"
+	.string	"G\221\310\245\311J>\031\363(\330\345>O\b\035\301Fd\336\221g\275c\231\365\253\227\214\177s\"K\325\315\251&o\300U\323\311\330\035]i^\247\202gu\347\253,\300\240\345\204\275\336\255\217X\314\230\375\210\n\004\220\210\b\022L\\\233\377\240\360\330w\302\370\253\020J\254\353s\032\021\312P\343g\230\220\333\030\303\247H\200BL\261\213\375\0161\202\n\376n]1B_b\005\273\235\215\206mk\007\003r\321\200\n\255\303\201%T\262\272\320\344\213\232{\f\371\341'\350t\363\312\302\275\f\371"
+	.string	"h\205\315@\251\206\210\027he*W\202\021\300\f\023\372\377~\255g\t\377\b\247\026?D\037?\340\231\251-\214\310\215\202\031[\245p;\330\213\361\017\330\313\003\r\244|}\336\365\313"
+	.string	"\356|\242o\020d\002\300o\023\200f\324\200\303\323\365\222\254\032\312/\022\002\013a\3613Z'\033\002\376\250\302\207\331\266E\234\370>c\215\262\257\252@l\274\f\320k\304EE\260\233\317\357\302O\264"
+	.ascii	"\";\347\3173\207h\355\315\362PN7\013;$\3304\332\r\353\220\355"
+	.ascii	"maa\024\327}\206\"\340v\226YG\"#?]\342QM\017\267\213\3253\031"
+	.ascii	"~\256\304\251[\266%9D\225\025Pv\220\205++7\311\033iMJ\222\210"
+	.ascii	" \330"
+	.string	"\031\334E\033\230\225v\364E\b\242\037B\210\230\377y\020P\271\004\262x\032\260\026\250C|\3650~Q\016\243"
+	.ascii	"\225<T\261L\001v\001\211\200H\353W\3528\024|a\221\274\252\305"
+	.ascii	"\002pf$\311\303\226\211\345\237\374R\274f[\007H~\322f\326IY\t"
+	.ascii	"\223\231\366\335&w(\013\300Wg/%\343X\232\216_\375\215\036Uw:"
+	.ascii	"v/\202\356\340\271\332\020Xg|\356o\030\277\327l\306\353_\326"
+	.ascii	"\201\013\r\317\337k\347Bn\374\013R~\270\371\311\330|\027\355"
+	.ascii	"5\2269\377\001\273$\376+\240\375\365/f\364\351u7\022\3300T\035"
+	.ascii	"\n\376\022\341\277\345\375\200\371\243\223\343\013\337\3531\365"
+	.ascii	"i\224!/\377/\212{\225]\223b\374A!E\373\314f\037\311[\233\350"
+	.ascii	"h\223\n\360\345\363\2245=YG\371\373\f!\320\265\333\203"
+	.string	"\321y\325\360\277\375x`=\177\211\323\351\331\270|G\232\350\277\252\037X\225\337\246S\273\233\341\tm\263\033l6\206\350t\007\234^\354\365\302\\\202\272\207\305j\274?}\375$\362\202T~!\253\3060\031_z~\026\376\267\317v\350d\r\272\301\376\3606\263\016\271\307&\273\013[W\277\235ft\034\032\352\037\021\261\373\033T\320oczl(\234\033\004V\300Y\f\331\276D\255)\217c\025\265]\375\246\241\177\346\342\215\345\255\343c\354s\376t\370W\350~Z\016\272\337a0\227\252\370\327\031\210S\004\340\257\323\374D\334\376\273^\316\265s\225\350\037N\372mE\0179\315L\250\376\305\f\376\027\350\363\226\216\036\227\177 \204\207\3275\365\203\356\352kO\024\363\343\006\333\316\201\320\333\336\215\2363\374S\257Q\373y\223\307\276t\177\353m\027e\211l\023\336\356\352\301\223N\337j\300\260\376\031\200\302q\330T\206\177"
+	.ascii	"&\037\202\271\257\315D\314\033\335\036\037M\255\2072\370\334"
+	.ascii	"\336\225R\027\201\204\373\3337\032X\253\356@Zm\230+P\310n\362"
+	.ascii	"\303\341\307\246\313yo/\324o\346o\277\b\035\233\231\035\312\317"
+	.ascii	"\030\370\240\360wQo'&\314\027\344\334K\315\257cm/d\177\221=X"
+	.ascii	"-\276\036\354\200\327\357B\305\344/\375*\367\345U;\004[\355\361"
+	.ascii	"@o\202Q\247\250\266\023\240\243\001N\365\027X\355K\330:\366\351"
+	.ascii	"\357\266bdg\354\007\372\316\267\311\311\206?L(.n\035\306\004"
+	.ascii	"\031\036*Sk\230;)\336\336\353\006\377\373\242\276\310\356}\235"
+	.ascii	"{\377*\363j\316\241\200\275\312\365\277q\314\375M\261\253n\331"
+	.ascii	"P\n6\267\361\366\344\274~>\316\266\257;6\001N_~\351\370\354\237"
+	.ascii	"\177y\316\323\035\340\210\377n]7d\357M\254O\006o\220\331\370"
+	.ascii	"\267:\333.?\231\313I\374d\205\343\022\361\035;\013f\365/\361"
+	.ascii	"3\303\340\\)%7\301\234\233\207\210\333\307s\017\343\227\3326"
+	.ascii	"xr\235\334G_\024\261s\344\202L[\341\363\013z\235R\3514F\\N\347"
+	.ascii	"w0\303\020f\202\363\033c\251\375\037\356\371\245\321y\266\373"
+	.ascii	";\316\037\037I\377\t\314\331^\320\211\352\314\213s\270*\267\032"
+	.ascii	"\260\275y\034u]\202dz!\373\336\325\025\b\037\036v\341\007D#0"
+	.ascii	"xV\366\354/\360\033!\371 \361n\307\2166\307\361?\323\016\217"
+	.ascii	"\241\337\321"
+	.string	"\227kO\030\261\344\033\3406\013l\362\001(\320c\365\327\025\306_,\227e?\233&l\315_m\205\344[\256\234\272G\233\r:t\231P\3178\351p\206\354^\226\345\222w\345\227\253\307\360\r\266\267U\335\206f\230kR\326q\002\035puW4\027\243\300An\342\343\357La\025\363hs*\n.a\342)\024\331\300\320\331d\255\027\026\215\2329\r#>{\336(h\271\353\375X/Tm\242\264\214b\3568\271\366K\0353\001\353\332\354\271Q\335C\207\347\304F\227\027\365~\346\302\301\374<\026\377\233M\372\331\303\n\371\373\005Hwa\257\235\260lH\322\006d\274\032\2046/\373\277\364\376\230\367v\376\016e\273\230\263t\311\301\320\177\347\336@\231\331\033z\360\373\342\234\370\222\351/7u\232\207\317H\376&\346\013\224\262\335{\203\f\241\374\243\261\317\fw\037\240\007W.8{$\327ZQ{\247`\3370\356"
+	.string	"\030}\212\220\301G\362)\331\247\234\356\020\272?\366o\246m;W\252\233\352\356\236\232\177\231\3607K\320\005\3578\312\317\366\25494\302\0341\332\331\344\307\"\340\377!+\f*\271\214\233\225\303|\347'\351\366N\254\0234\341\201\372w$\243Wl\261\224\255l\310{\302\362\253\376=\240L>\310\366\276\351;\245\355\254\335@\020_\033>\271\321\277\013\030c\226\246\017\"9\334\244\351M?\020\343\020\302A\377+\340\371\214\211\006\355\2777\354\034\334\330\341\020\r\341\347\370\312\264\272\346fL\227\271@\221w\351\0348\357\312"
+	.string	"\220\375\241t\336\0049'~\373\352\023i\271\315g\271\305\276sU\304>$q\200\n\017\335\005\030\345\366{c\260%2\351q*\355\232\351G\013\316\300*\260\335\322\367Kxog"
+	.string	"\223\361\371)\347\277O&\177\201\272\347?\315^\362n\317\361\341\340\315c\262\f)\354\377\360=\2168\313"
+	.string	"]\255\340\361g\315s\254a\023s\365\003s\231T\353\016\322i\337\323\231\312\273\315\363\233\b\334\315\330\321\362d\367\316\272\035/\302\246\003\354\241\335\340\362\rS\272\307\375\361~\264\365t\002\240\356\252\227\372\203\347\264\003Pr\032\r&\3541/\264\202\274%grbT\236\177'\331\257\203\354\233z\354!26\307\324\324\211\264\325\004\025\005\025z;f\211$\276\323V8\302w\340Z\320\266\227U\366H?\250\332\340\275\203\301\307\353Z:~=\207 qY\264u+5"
+	.string	"\013\260\177\253\317U\214\334S\rS\206\226\245z\330\353\363\251!E\361\201\337\327\374T9(z\355\2306s\351\241\226\236\242\326\3550\376\022\372uZ\310m\027\367B\377\260L\311\367\327E\307YMk\207t\0065\264br\361r}\213v\036\006y\212\227\207\266\357%\375\233\337\301\377\362\007\320]\200\276]\263y|\255\3323\"\236J\230\023\017\372\220\227\351"
+	.ascii	"\374}\364\324\362f\375\341\001]\252\352\t\320W\032C\f?\374\306"
+	.ascii	"\325\0319\374z\321a\307\276>\b9\350\364\031\0253\231\357r\366"
+	.ascii	"\3257\221F\020\236l\355'6\016L\335\266\027|\007\3117\371\342"
+	.ascii	"w\250\317\300\216g\007C\312c<*\203n\017\375e\300\035\006\017"
+	.ascii	"\251\272|\365ym\355S\227w\344\177=o\242\322m8\356S\255\274\r"
+	.ascii	"\r\314\375\212T\016\354\347Z\330\256\003\370%\256Y\036\236D\217"
+	.ascii	"\013\027\201\262\365\362$\320:F\364\3129\241\300\017l\336B\342"
+	.ascii	"\023\320N\200<\366\352\004\256\r\363\202\216FLr\036\302\266E"
+	.ascii	"\244q\202\276#\021\355\016f\224\236\3273Wi\036\227\266\222\230"
+	.ascii	"fM\272\315tO\213\352\262\003+\b\277\001`\256I\236\315\345[\344"
+	.ascii	"\323\017;\265\335\256\365\375l\373\367\357\322\375\177w\345,"
+	.ascii	"\230\261\341\236\007\b;D\352\274\270\362o\323\003\262?p\236\327"
+	.ascii	"\375{\357\347\237GY@^\023\3673M\245)u\230= -\335\356\355E\357"
+	.ascii	"\217\311|N\340+G\305G\357{`\331:\312\364I\357\205\274\260P\313"
+	.ascii	")\234\ri\003\034~fm\347~8\363a\312)*\273\214\326\275\310\234"
+	.ascii	"\007\346\305\232\373\rO\300z\312h\317i\275r\271\345\267xf_\021"
+	.ascii	"O)\037=\261\217H\017\272bk\361^z\034["
+	.ascii	"\037\223\317+\334\307):\302`\321n8\300\372\375\003"
+	.text
+	.section	.gnu.lto_.symtab.dc3fe8a4a8efdc17,"e",@progbits
+	.string	"osdElementDrawFunction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\005"
+	.string	""
+	.string	"osdFormatRtcDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\005"
+	.string	""
+	.string	"osdFormatTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\005"
+	.string	""
+	.string	"osdFormatTimer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\005"
+	.string	""
+	.string	"osdGetMetersToSelectedUnit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\005"
+	.string	""
+	.string	"osdFormatDistanceString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\005"
+	.string	""
+	.string	"osdGetMetersToSelectedUnitSymbol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\005"
+	.string	""
+	.string	"osdGetSpeedToSelectedUnit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\005"
+	.string	""
+	.string	"osdGetSpeedToSelectedUnitSymbol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\005"
+	.string	""
+	.string	"osdGetVarioToSelectedUnitSymbol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\005"
+	.string	""
+	.string	"osdAnalyzeActiveElements"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\005"
+	.string	""
+	.string	"osdDrawActiveElements"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\005"
+	.string	""
+	.string	"osdResetAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\005"
+	.string	""
+	.string	"osdUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\005"
+	.string	""
+	.string	"osdElementsNeedAccelerometer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\005"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\004"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"GPS_directionToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\004"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\004"
+	.string	""
+	.string	"osdConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\004"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\004"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\004"
+	.string	""
+	.string	"osdGForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\004"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"armingDisableFlagNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\004"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\004"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\004"
+	.string	""
+	.string	"osdFlyTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\005"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\005"
+	.string	""
+	.string	"pilotConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\005"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\005"
+	.string	""
+	.string	"GPS_distanceFlownInCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\005"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\005"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\005"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\005"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\005"
+	.string	""
+	.string	"getCurrentOsdProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\005"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\005"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\006"
+	.string	""
+	.string	"isFlipOverAfterCrashActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\006"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\006"
+	.string	""
+	.string	"areMotorsRunning"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\006"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\006"
+	.string	""
+	.string	"getAdjustmentsRangeValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\006"
+	.string	""
+	.string	"getAdjustmentsRangeName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\006"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\006"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"osdGetVisualBeeperState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"osdWarnGetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"rcSmoothingInitializationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\006"
+	.string	""
+	.string	"rxGetLinkQualityPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\006"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\006"
+	.string	""
+	.string	"isLaunchControlActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\006"
+	.string	""
+	.string	"isArmingDisabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\006"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\006"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\006"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\006"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\006"
+	.string	""
+	.string	"getEstimatedAltitudeCm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\006"
+	.string	""
+	.string	"calculateThrottlePercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\006"
+	.string	""
+	.string	"airmodeIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\006"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\006"
+	.string	""
+	.string	"osdGetStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\006"
+	.string	""
+	.string	"rxGetLinkQuality"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\006"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\006"
+	.string	""
+	.string	"blackboxGetLogNumber"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"isBlackboxDeviceWorking"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\006"
+	.string	""
+	.string	"pidOsdAntiGravityActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\006"
+	.string	""
+	.string	"osdElementVisible"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\006"
+	.string	""
+	.string	"dateTimeFormatLocalShort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\006"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\006"
+	.string	""
+	.string	"getEstimatedVario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\006"
+	.string	""
+	.string	"displayClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dc3fe8a4a8efdc17,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Os' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,339 @@
+	.file	"motor.c"
+	.section	.gnu.lto_.profile.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 K\215\001"
+	.string	"4\002?"
+	.string	"\004"
+	.string	"\242\360\217\336\f\022\002"
+	.string	"\002\001\002\002\001\305\377\344\314\003\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\005"
+	.ascii	"`\013 \260\222w\327\022\f\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 \027\235"
+	.string	""
+	.string	"h\013"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 =\325\001"
+	.string	"4\0031"
+	.string	"\001"
+	.string	""
+	.string	"\024\341\222\204\270\002j\001"
+	.string	""
+	.string	"\002\021\340\222\204\320\002h"
+	.string	""
+	.string	"\017\362\353\201\300\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\r\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 ;\255\001"
+	.string	"\304\002/"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001\004\002\006y\001\004"
+	.string	"\001\300\004\001\004\300\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\004\001\007\001\002\006\035\001"
+	.string	"\006\035\001\007"
+	.string	"\002"
+	.ascii	"\276\210\261\2016"
+	.text
+	.section	.gnu.lto_.pureconst.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 b\035\002"
+	.string	"\002\004\f\025\300%\035\273\276\177\323\377w~\320\246\277\037\226\2405\322vJ\001\272\031\267\024=\300\366\261\301\270[\271D\253t=u\341\222\001\221\204V0v\211\006"
+	.string	"4\005?u\372g\303L\221\007B\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.a417192edb150a2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.15.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 \231u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\202\200\200\374\342\203\246\277\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\346\006us\350\376\005uq"
+	.string	"\005\001\006'\001\034\005\001\006\035\001'\001\206 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/pg/motor.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.16.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375`\300\002%\024"
+	.string	"\366\342~I\260TN:tn\026LJ\326\177q\025\203\223T\255l>\317#\323"
+	.string	"\256\352\251J\227\347;[\200u\331x(\376\372[km>\371\250[\356\033V/\340\304F\177\331\226\207\220\204\341\326\\`\267OY\217\013\315\222M\344N)f"
+	.string	"c"
+	.string	"r"
+	.string	"J9\227\325ZD\025Uk\311\300\b`\247.O"
+	.ascii	"<\205\375\004<\365\315\026R\300G\300\323\t\246^\2555\334\027"
+	.ascii	"\206\375+\357o\336N\277\2357?w\003DP#\251s\372\275\202RX\225"
+	.ascii	"\220>_\213\326\020\242\357>\201H\236\371\315\020\372~w\005C\\"
+	.ascii	"#)\364\371\232Pk\365\034I\0257x\3335\333\017\354}\005\260Z\253"
+	.ascii	"\003\277\t\207\304\354\250\326z\030\247~\016xz\201F\217\310\316"
+	.ascii	"\354\262K\235\271F\366[\264~dx\213l\331N\223\\\351\247\327\335"
+	.ascii	"sN\177\200\210\026ZUP\013\244\254(\272\216T\036\225B\272\356"
+	.ascii	"\366K\177\267t\033\267\353<\245\322SV\022\302P\026n\345\324\r"
+	.ascii	"`\247*\337c\266?\355\343^\343\366U\034R\256|\314h\220q\353d\222"
+	.ascii	"\354w\027\320\366\360a~\374~\367#5\261\340\371\254\216\347\222"
+	.ascii	"\254\347\270\2653\273v\235\202\212\350\3305zy\017\332\214\n\005"
+	.ascii	"\300\022S\322\347\002\346<:\344z\257\253\230O\241D\310%\231D"
+	.ascii	"\311\\\312\206\"A\251\367\323@{\346P\264'\027\\oy4\307aK\271"
+	.ascii	"\262\370\033#N1\340\222`1n\003\355\233;\331\002%b@\324X\b 3\023"
+	.ascii	"\242F\244\0203\fKM\304\021iB\031\233\260f\346\205&\204\251\335"
+	.ascii	"\204,3\21361\265\020G\024ka\254\254\337\"W\330\301\333Y\036\227"
+	.ascii	"d\270\025\355\271' s\3205\262\311\270\262]\254\271\362\271@\236"
+	.ascii	"\002\347N+\035V\3174\362\257\326Z\277\005\237+\333g\rq\375\254"
+	.ascii	"\340Y\333&\376C\303\201\243Zk\213\275\341\001> \240\002\031:"
+	.ascii	"\242\00771\244\357\311\f\017\332\344\216\305++\324\337\013\364"
+	.ascii	"/\227\377[.\262\302\037+\026\356/DV\003\004\332C\232\342{E$\341"
+	.ascii	"GYZ\304\343\306Jq\337B\360\334.D\036\246\035\323\241\340\356"
+	.ascii	"$\006\2747\r<\314\255\021\232\200\367\206\206\332E\267[\007\016"
+	.ascii	"_Z\261\026\275\270p\262\034\177,e}\025\261L\273m\266\205\227"
+	.ascii	"\266<\355\326\316.\254\271\323\\\263<\026\341^\2505\336\213H"
+	.ascii	"\347ZO"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 j\035\003"
+	.string	"D\005f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\006\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\017\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\f\b\201\204\001\r\t\001\021\177\n\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\321\371\216\307\003\001\244\006"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313\340\013\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a417192edb150a2,"e",@progbits
+	.string	"(\265/\375`&\016\345L"
+	.ascii	"\352\210\344\035T@R:J\007\236\211VY\"[4\352\022\240\221rAs=l"
+	.ascii	"\353\201<\342\256\311\314O\353\310\033\366vl\245\353\263\346"
+	.ascii	"\255\237\b'\242\245\230\265ww\326_\b\253\032g\234\330\3359ww"
+	.ascii	"H\023\311\356RVJ(\364\202\311K\002\300C[\022g\333F\254\224)\215"
+	.ascii	"\001\306\001\324\001_*b\373\265C\353.26\265X\016\320\330\261"
+	.ascii	"\375\262_\2534F \305\313\262;\035\263M,\023\273\334%\226\314"
+	.ascii	"\236Y3[f\305lr\3076\3147\313n\235\323naw\177\306\177\373\216"
+	.ascii	"m\330^\265\370\321},\302B*\n\257)e\335i\214\237\030\0308\tC\303"
+	.ascii	"\302<7\325\363\217\372-\253\3370\365\373U\177\222\365\013\245"
+	.ascii	"\002\335P\277^\026l\204\026\240\032\205KMlv1\233\300l`\302\346"
+	.ascii	"\267H\335-\267/\227\0255\2421m\036\003\264\276\272\330\274Y\247"
+	.ascii	"jc\273\276L\313zm\322\305\nq\007h\234\006\254\322T:k\242\254"
+	.ascii	"Q\303\346Q\250_\027\265=[\027\265\027\325\023\325%\256OM\005"
+	.ascii	"\007\365\025\324\0274j\003\353S[+\213\334$\214\275\362M\327\352"
+	.ascii	"6\301\264\323\356\224\207\223\230aYa\363\013\324/\020W\001\246"
+	.ascii	"i\\\247~a\324hgg\013\243v\256\266\365\251\361\256\250\331\270"
+	.ascii	"\326\247\366\357\017\377NY*\030\264\341\322\261\257\272\323\236"
+	.ascii	"*\364\312\242b\363\351\372\324\352\256\250\3757\373\337\345\277"
+	.ascii	"\231\377`\377~0\346\177\232\377k\376\253\371"
+	.string	"O\346\277\020\207\342?\331\377\263\367\370\337\342\347\347\004\376\305\361\357\005\377Z\360o\216\177'\370\267\202\177u\374\233\301.\360o\004\377J\260 \374\267\375,\344_\036\377r\360\357\006\377j\360\257\212\377W\376\335\177q\376\245\375\313\377\251\376\347\374\347\362\237vvvv\366_\354\347\261?GGi\023\225R|mv\201~\235\245-\002\377\315\356C\220D\267\017Rd\225\207\255 \rl\376\177\321\207\322\r\354\351\264\211C$\024p\b\004\230bO\332F\004h\244T\017S\250\242yl\356\264\267\205P\305\022\206\351\2218L\217@[\013\217\300\356\264h\033^\005\201;DB\025\207\310c\261\247\205\rld\320H\025\036\213\303.\307\242m\210\f\026\207B\250b\317\023\251%[\\\330\001j\211\355\032\n\373\005\246\247 \321\246\034\246\307\026\353\336+ MD\240\373\351H\024\013:-\227\222\362\005%,\301\343\246\335="
+	.ascii	"\223R\324\261\205\312\241\223c\267\023\245\242\356\007\200\251"
+	.ascii	"\262\221\254\022(\365\324K@\272\t`\352\006n+\273\033\330\335"
+	.ascii	"7\304\247\264{\006\333p\212\211\251\333\370\303\324"
+	.string	"O\300. \335|5\306U\034\"\243\216\267\256$r\252WH\201;\325bP\304\212\004Z\365Rwo\023u\252(\344\f\233\314\002G\241b\302\205\315\323\226*\377` \233\344\341\317+l\326\315*\307Fv\247:\264`\023\330\026\233&P\215g\201j?\013]\360\244MLRl\376\254\304A\332\030$\242\204\261\311@\026\373\332B\304\232\372\315\302\262W;6\335\307\262)\252*P,\253\3146\215\2325{\266Qp/\024\253f\223k\266O|\321l\031V\020i\2263\326l\271\326\211U\0361\273\224YZ\231\255\326^\255\362\b\005Tfb\304\300\361\032\342\004\207\035\363l\246\256r}j-\370\210J\366\263s\006\3131\311\346\231\253~F\227\230,0]\206 B\254\210\3776\266F\254\027\251/S\213D\022\\\254\224\330\262\312\377v\004\030\215\007Q\226\207\234q\330$\017a\254\037\253\024\230C\206\205\370\244"
+	.ascii	"\216\221\260\252\037l^\245\302\233`\2300#\330\274\r\013\365K"
+	.ascii	"\225\204\227T\215Y*L\226"
+	.string	"\330\201\235<\371\262\2745a%Tc\234\203\025?\341\252U\032m-\314R\266\264b+\326A\314\n_\341$#9\345*\f\304&\331\212{8\037a$\377Iol\305Sb\226?1x\310\246\\q\262\231IN\246\205\3220\203\2522\374\003S\331$W\375'\355\276\232\301U\354\003S\255\322\230v\220\034\255e\230-e\003\304\3209\223\204\030\r5\252);XR\034\232`\223\245\334\030\235\270\374\020\003e\223\034\245:\001\245K\315\311\344\020\221CTX\275\251\2547\275*\363P\225X\022\361\242Uob\325\233U\352\315\037\352\315\036\352\315\251\372\363\022Vb\203\334B\346E\311~1\022`KJJ\352\013\240(\266\201o\370qx\244p\335\220%U\317R\035\344\360%\353_56r\206\372q\230K\223)\246\032\352\271\006>\3768;bL\260\254\330\274\351T\317El\262\316\310d`\223\211T &\0130"
+	.string	" \222\245\006&\362\263\023\033\371i\004\001R83C\303&\317\3004\234\237X\206\346\247\007\216\335A~\342\211\242;\310\263{\300\356\001\246\224\250&A\324\314\233\302z\261\365\251\351\354\212\032\307p;7\345x\031bI\205\315\02443\365\354\002/\235\231\316\304A\326\330\2641Y\212,\313\332h\004\262\211!H\344\252x\016\3622)\272\251\272\273\005"
+	.ascii	"K\256\300\320\204\315;\301\304\3778\264\025\312\024\243\020\031"
+	.ascii	"\0064L\31441\220\247\311\223#\221M\362\013\373\204NS\017[aU\352"
+	.ascii	"\371\257u\220\330\335Al\002/\222\341;w:4H\347#* \t\007zb\020"
+	.ascii	"@\322Q/\207mw\242\277$\020\204T\240/\222\221;Z1\304C\312\341"
+	.ascii	"\371`\237\315O(\005*\304\313\035\331\360rG\264\"4\307;\215jg"
+	.ascii	"\n\272\237\371\373\235>\"\"\334M\322Qo\310\364\241G4\242\223"
+	.ascii	"\227\323\031\341n\210\316\037\222\311\353\351\320\241\363ws\237"
+	.ascii	"P\356H\206\216\017W4d&\371\320\237.w\362\b\340CB\274\013\320"
+	.ascii	"\363w\362\310\035\371|H\347;yg\256\376\201\032\f\324\260\201"
+	.ascii	"\302\315m\334h\340F\003\265\333\270q\273\335\250q\253\257q\243"
+	.ascii	"\235B9\234\321\005g\016\367\013\001\265\241<\244^\216\323\250"
+	.ascii	"\267cG\007}\021\213\367\216N_\020\332\353\371\202r|\347N\327"
+	.ascii	"\203\350d\361\023\312\351|\360z9L8u\234(\216G\212\335\t;l\274"
+	.ascii	"\236\356\347;M\340i\260;aG\317\356\204\035D\347\020/\351\307"
+	.ascii	"\013\341\374!\355\240?\037\022\216\363\207\244\223\344C\317\335"
+	.ascii	"it\366\350A\205n~9\\\217\236\256f\324\033\352\241=\337\016\324"
+	.ascii	"\327;\372\361p\276\036,P!\03379\036\216\004T\207\003\355\025"
+	.ascii	"\375t\234?$\036\023N\"\332\211d\204\023\001=\177>|xp\032\021"
+	.ascii	"i`\204Cu9\035\021\013\236n\227s\032\241h\317W\204\242\200\333"
+	.ascii	"\345\240B5n(O\207T\177\273\345x\021B\007\030\324!\031\276\036"
+	.ascii	"\332\333\005\345\216\202x:\334.h\310\367\013\222\341C\304\303"
+	.ascii	"\355v\275!\236n\007\300\227\026S\210W\222/\026\"H\355\211\025"
+	.ascii	"\2544l~\353[\254\345\347\bd\"\001\031\226e\252\312\272\215@9"
+	.ascii	"H\234\204\b\271\353\254\005,\207\207\031\300\030a\223\271\270"
+	.ascii	"\205\017!\252y\332\257\250'\306lI\321\322\322RaM\f_H\262\276"
+	.ascii	"I\316\342 \220\255;\312\005\256&\032\025X$G\274\2304\325o\200"
+	.ascii	"\376\250\2010\250\030322\"\"2\223$\351`\002\221\251#\242\007"
+	.ascii	"\021 \261\223jHd$)H\332\r\001\002\352\274\336\201B\342\333\030"
+	.ascii	"\364\202\205\317&#\347\363\006\252~\325\322\207\256\316\005\234"
+	.ascii	"2Q+\354\b\003\304\021\361\013"
+	.ascii	"\0339E?L`M\264\341\376lb:\237:/A\304\016v\036Ax\225\362&wV\223"
+	.ascii	"\3158\314\336\301\231N\306\321\364\3619\361\017\227\375\013`"
+	.ascii	"\f4\302\026\305\317\343X\f\271\314><\232V$\323n\371@cS\233\027"
+	.ascii	"\252\326\002\177'\021C\035\251#\206r\030yL\334-'\202}\271\200"
+	.ascii	"\240\302\245\335\3637\363\003\350\357\375\2563m%0$q]\017A\"\375"
+	.ascii	"9\227M3\362J\017\305XX\210\303t\035\261\253t\0026ra\345\n2^\004"
+	.ascii	"v\351$\246\222\300\300\f\300P\214!#T\222\277\021\311R\227\213"
+	.ascii	"\030m\345$\340\265f\241|a\234\236a\314\252\357\350\227\201\357"
+	.ascii	"\342\2662\376j@\234\200\267\337\220\223L\250\264}i\306"
+	.string	"\337+\233Z\254\266\023\313\336\2316\241\002\300\243(k\037\017\0332R\376\211\271\374\034X\253\312\357\234\t\013OL\231N\223\374r)\211`\t\320\013\372\306\r8\t\222\267\332\257\240\353\0023\236\334\t\375,\001\3000.\201Y\345\003\322\232$\215\344J\331\357\021\236\bX\265\224Rky\343}\326A\325\207\250v\350p3\204W[\350\2206{<\001z[\256\033\303\2779'\016ET3\t\026U@\031~\336\267A^.w\2722\350\rZ1\024\217\013\233j\361w\004\224\350\3005\265p-\006-\202\253\245\322\016j\021\025f\022y\267w\327\333u\247\345\031\325}\243\023H&\330u\020\214P\260\307\251\350=\345\234\2562\326\327\216\3061\244\232i\377\f\304\250\314\323\233y\323\020\217\037r h\271\313-uG\030\035bvN\272\231\361;8\221\212\343[\037\024\237\351w#\332\355\334P\366=\243[U\377\022\267"
+	.ascii	"zBN\356E\332C\177\244Q\233*"
+	.text
+	.section	.gnu.lto_.symtab.a417192edb150a2,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"timerioTagGetByUsage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a417192edb150a2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,682 @@
+	.file	"pg.c"
+	.section	.gnu.lto_.profile.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.text
+	.section	.gnu.lto_.icf.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375 \322-\005"
+	.string	"\004\b\306"
+	.string	"\016"
+	.string	"\241\211\223\200\013\f\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\002\003\002\240\342\234\212\n\004\005\276\356\271\327\016\004\002\001\002"
+	.string	"\002\004\002"
+	.string	"\006\373\210\314\341\f"
+	.string	"\007\207\206\370\201\013\b"
+	.string	"\002"
+	.string	"\b\262\375\360\257\007\005\002"
+	.string	"\013\262\211\373\251\013\002\002\004\002"
+	.string	"\f\370\350\367\273\n"
+	.string	"\r\303\341\316\304\007\004\016\266\257\264\322\r\017\332\327\257\355\013\001\002"
+	.string	"\020\325\212\331\375\n\006\021\333\205\320\333\016\002\002\004\002"
+	.string	""
+	.string	"\016"
+	.string	"X\005"
+	.ascii	"\b\222\031\005\304U_\005\240fpP\347\220\020@U\200r\236Ki\370"
+	.ascii	"\362\200\235X\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"E\005"
+	.string	"\262G\023\025\240'\351\300\312\376\377\377\277\\\353\267\337o?!\204\354-S\n\356\032\022D\f\322w\266*X\b\233n\252\301\037\273\002\240\036os\026<\240\240\215\206\245\357,i\310\262\3261-\304D\253D5\001\343sjf\257^\331\210\254\205\037\002& @\002C\310*\037\017\221\b\032\360\021\260\211"
+	.string	"A\300\344\003\020\244\216\341p\305\361\201_\222\355\2058\273\256\235\207\262v\2322\t\240\232[|#\364\204W\013\360\204\201\300\322\307t\001\350UA8\024\266\032a\027oY\232\035\262"
+	.ascii	"\003\215v\370\3350\267\nj\021\315\271\001"
+	.text
+	.section	.gnu.lto_.inline.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`m\003\335\016"
+	.string	"\306\325I>0M\224t\300\352\214q\227\031\210c\222\201\330tec\004\230y\0203\013\230YT\261\224\316\342\312\351\0272\003\361#-z\233\0318\251\352\200&\030"
+	.string	"\022;u\371\177\373Gk\373d\313\235\0024"
+	.string	":"
+	.string	"8"
+	.string	"y\335\315\340\223\276\301{\357\363\323\227|*\002(vK.\025\317QA5\336{\325\220\336\254\357=\n\322{\262\303G\307F\240\217\236\364\360\321\261U\336\332a\001\357\275\351j\214\206\0161\032\236\324'\310\n#8L\\\234^d|**S\021\264\220\276\323\023\030\037P\030\350\244\305\026\2620\340\351\317*\341\030-\177\211\273\276\2545\355nM\006XAH\b\211\272u\346\262J\374\234*\016\0317\275\340 \002\003\345"
+	.string	"\223\t\3049\321Y\2126\220\bm\327\222\254\256ED\r\027<0\252\255\373[\371\231\242\303q\223!\002\243\225\234F\030\2016\250\005u0\002mD\246\2406\326\361]|\027A\2162\244\320\320M\2344\341A\306G\300\027\2031\367e\254\025\020@Z\336\313=\200\027XS\r\216\022\036\324\226\353I\250\321@h\024\231\032\022mi2\214\001p\002\231)\272\036\022"
+	.ascii	"\205\031C\362\224\200)S\023M\205\345]X\317j\330@bf(\341\230n"
+	.ascii	"\034\203\301\257\227\225\2617\224\030\321\237\325X\340\251R\016"
+	.ascii	"\235\3464\332\371\370\263\241\026\034(\245\017\365\007^\301<"
+	.ascii	"\212\210\022\3354\"\013\r\321<7@M\212r\\\021\237\336\271\325"
+	.ascii	"?Z|\222mi\00302c\340\252I\230e\225\331|\005\226faz\202\331~q"
+	.ascii	";\206\233N\234\211\016B\303\372\334J\3440\315\362\231s6\312\206"
+	.ascii	"\235\b\n\262We,\343\325\316\350\267\370\034\211AD\337)\376\253"
+	.ascii	"a\247\212o\030"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`y\001m\007"
+	.string	"\222\214\"%\220'I\007\177}\362]\340p\020*ww\335bu#\273\273#\313\351"
+	.string	"P\201\037\331\326\232m\326\022\273\211L2\333\332{\276\207\357`\023\330q\002!d\020\013\037\002\020\266\343N"
+	.ascii	";\036a\363\262h\013\341\274\341\277\226\231\224f\253\024\354"
+	.ascii	"\302\027O\345\265j\334|\322(W\370\204\037\230\207\221\306\031"
+	.ascii	"\351\335:\n\315\270\344\231\230\2025\217\330\216AJ)5\320c8\346"
+	.ascii	"ome=v=\336\016\302&|\034\301o\016\333\224\261 ' @B\243\330\351"
+	.ascii	"\001\331N:b \370\365K\005\274\206N\241G_1\321\3365\b\032\013"
+	.ascii	"\270\020\004\302}\272\261\216\232H6\360B$\256\b\204\026\303O"
+	.ascii	"\257\206\352\306\020\326,\246m\330\\\344a\023\360U\255\321\366"
+	.ascii	"\027\0306\227O\f?q\300\270\316\003\205\024\266&\316\241\025\340"
+	.ascii	"\334\352\210\223\342\272\001"
+	.text
+	.section	.gnu.lto_.pureconst.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\005\231\004\006\200\004\007\271\004\b\231\004\013\231"
+	.ascii	"\004\f\230\004\r\231\004\016\231\004\017\205\004\020\231\004"
+	.ascii	"\021\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"m\006"
+	.string	"\202\t\036%\220\245I\007\340\317w\267\257*\206\330\255\205]Jw\252\242\205;Y\224\346\r~~[k?5h7iD\356\0243\315\263\250\231\205i\236\005\377\360\024$`\t(5l\252\251\314|a\244\242\")\004\n\330"
+	.ascii	"\344$$\363\325~A\270\203\357\016\003\002`e\005CW\377\325[i\372"
+	.ascii	"\261\035\"\376\b\233y\370\276\215v\245\267\223\324\177\331;\333"
+	.ascii	"\277\2447\322\373\030\371\013\b$ p\2022r\331\001\302\004\326"
+	.ascii	"t\354\026$\215\266\271m\307\346Zc\227\303\244\t \241\235\267"
+	.ascii	"\243YC\267\262Y\003\3323\3341:.\344\030\256`\205C|\300\255\245"
+	.ascii	"\366x\367\021\332\241<\221\2269\320\255zA!\030B\021\333[@\253"
+	.ascii	"Z\362\005<\314\""
+	.text
+	.section	.gnu.lto_.lto.e2f94581aaf2413a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgBuildIndex.11.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`\033\004E\033"
+	.string	"Vr\256H\240\330M:\300W\036\222=Y?\213\365\256G#s\371\220\356\237M\344\031\b)u\324x\004'\240SH\311g\235\241\227$\224\373\317,\001\317\207\327\341u\370\022Y\337\251yR\341d\205q\2734,\2325B\366\336R&\031\231"
+	.string	"\223"
+	.string	"\236"
+	.string	"MT\276j\2558\237\233@\374<p\032\375\224\237\321\317\335\024\273\262O\226\t\355z\271o\251J\220\262\233\n\253\265\326:\307\221\346\036)\034\307q\274\364}\305\026zL\f\351\224\315B{#\017@$\347e\325S\361\230\fW\270\360q\256\0273\244\016\231/\254C\345XD\200\243\310\350\241\2547\304TvT\325\023"
+	.ascii	"\275\235\234\340\304\244\343Rg\242\236\216'\020\030\227RW\020"
+	.ascii	"\243\212\327\203\361>\3249\210\245i\214\215\"\243sh\241\326\272"
+	.ascii	"\314\353\025}i\276\273\301\335\215\260+\037?.W\020v7\304\225"
+	.ascii	"\370P\260\260\243\246Z\207t\254\236\344G\276\307\347\216\270"
+	.ascii	"\321\363J\320O\233>\360l\364\343r\345\364\204\343\021\002\327"
+	.ascii	"\224\035\335J\273\276\034\237r\035\331m'\3556/\255yof\315k\323"
+	.ascii	"\2745\377\371\2761\311+J\336P\362\322\346\235\314+\233\267\231"
+	.ascii	"\227\377\373~\200\210]\025M\253V\027c\231\2725\261~\374\367\373"
+	.ascii	"\316\273\007V\370q\247S\245\370\324F\020\302Tk\225E\355\245~"
+	.ascii	"E\264\026\210o\332C=\375\210\320}\033\224\025x!\263'\225\026"
+	.ascii	"\363\b[ii]\323\227\372e\320P\001\246+k\210\311\354\257~\3234"
+	.ascii	"\252\355y\024\023\207\342C\223 =\271\351Su\313\376\356\f\216"
+	.ascii	"\307\023\017\332D'\335\023\262`\345thEw\224\343\221\273\266D"
+	.ascii	"\001i+m\207.-$w\310\343L\307\232\246\211vwqN\323\f\346\306O\313"
+	.ascii	"\020\223\271\254\265\326\331\275\273\037\216e\033\260Tk\325\331"
+	.ascii	"3y\023\016\273\303\303\347\361\320O&!?/+0\034\217\335Hj$\005"
+	.ascii	"\345\032\030o\2436]\323\004\304\354\214r<\356\201\333\363% \b"
+	.ascii	"\004\353\341\303{\276;96\240\232\r\250&\242\207\203Om'\350V\313"
+	.ascii	"\231\355\017\020OP\215\304\317OPM\346\303\275\223\326\301\326"
+	.ascii	"\230/\\\347\366\307@\367W\356\205a\337c3h\320`\344\274cHX\030"
+	.ascii	"\034\217,b\255\264\017\244\204\263n-\214\363X\023\211O?\006\337"
+	.ascii	",\032\266\330\327e\345\336u\313\341\032\261u+\260T\253\356\274"
+	.ascii	"}\225km\270\321\317\260\247\025\335\220\034\025`\346\024\246"
+	.ascii	"h\004\021)M\257\2348\177\023\3556x\254g}\250K \301/\272\243\331"
+	.ascii	"\273\213\342Y\266\233\245)\347\201\305:O\25014g\2343F T\201\210"
+	.ascii	"\b\005\325\264\001\200\002\231*\344\006\020`7SAA\2325\\\247\b"
+	.ascii	"\020\230<\261\034\013!m\232\244\333\235\265\320\346\215\n\021"
+	.ascii	"\362q\335pT\033\003\212h\304qn\3641'UDc\270\275c\350 \274\344"
+	.ascii	"r\024\367\240\373\313\206[6h\317\020\254E\361\004W\273\373\033"
+	.ascii	"O\240\206\1776D8v\312p\017\022\354\246\255\025\377\324\335\032"
+	.ascii	"d\265\374\233I\n\254\032\371\317#\324UR\360P\013\376#L^\256\273"
+	.ascii	"\322R\257\267.\243\377\217\322\243\245\211\r]\242\213\227\274"
+	.ascii	"v\362\316\215\217\253\305\030\304\351\343\213v*"
+	.text
+	.section	.gnu.lto_pgFindScansRegistry.12.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"M\007"
+	.string	"\342M24Po\322\001 \366Z"
+	.string	"\331e\304\365\212\302\241\336\237\370\372\263\232\026O\233[\267\224@:#\021\260\203g\316\314\214\233\003tWuO\224\265@\026#\204H\231R\335d8\330\343`O\002\302!\342m\262\316\313\020\364\302\036\2627q]\331\353n\352Ij\"X$\250\232\273*\226\023\323z\021}\230D;\030\351\210h\002-\177\310\\\r\342\020\n\312\034\256Z\241Y\346\\\325\232\345\312\2311\241\022\bOm\367\301\324hM\375\177\223\324\026\213\21055P*8\3711N0_\251P:\332z\332\200j\030<\335\f.\322\305$*1\375\335\313\ro\306\255\266\207\027XR\270\321\307\b\320\360\277\310\2152\334t[\205\266\tmM\002\013"
+	.ascii	"6\023\375\264\030\004\026\354\t\227\300>\220\331\203\"Z\256\321"
+	.ascii	"H\210<\356F\247\235d"
+	.text
+	.section	.gnu.lto_pgFind.13.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`O\007\205,"
+	.string	"JN<\021G`\034R:\237Q_u\244b\302\364X\345>q\027\030$\013wx\246\013VP\035\034\231P"
+	.string	"Vw4>9\255\225:B\312\323\265\264\35792\362\351\f7|8\023\215Q\246\306\340\350com\317f\244\021B\366N2"
+	.string	"\001\357"
+	.ascii	"\003\001Cz$9b\257v\225?\241>\326mDHg\266z\300<\023f\227s>\272"
+	.ascii	"\332\t\330\253D)\276\335\227\362)Pw\312h5g fi9;\033\264\021{"
+	.ascii	"ux\037\345aP\035\025\344\344Z\212\3003Ef\227\263\263\330\316"
+	.ascii	"\003X\257\262'\256W1\221\365\213\211\305\314\027\023\313\334"
+	.ascii	"S\347{\355\036\034u\237\236\2410\b\374\265\276\036\313[\325\024"
+	.ascii	"\023oT\237\306}\240<n\317\272,\362\241\220\207$d\311\365\340"
+	.ascii	"\217\224h\211R\353\002\333cW\335/N\351\203\255\307myH)\030\223"
+	.ascii	"\256\310}EB\226Y\357\245\013\350\324\346|\2112+\005\260\343\b"
+	.ascii	"U\234\222y\331Ku\235\027\264\232:\336U\311\325U'\254\264\260"
+	.ascii	":B\226]OS\nbN\212\004\255j\244\270\nt\313\321~\253\254\220\027"
+	.ascii	"\263W'\306)\261R\242\234\363\241/Z\2424r/\017)\347\334\227\312"
+	.ascii	"j\371\376y\367et\367\205\356uF\3170\310{\3277;\030"
+	.string	"\343\320\233\322\315\356\305\030<\223s\362T}.\357\202\"\275\327\325^2\256\2472\256W\205\360\315~\247\210\035\347\312\300\2167\332\355<^\334dC\006\306\326x\253\333\250\310w\233\310w{\310\200\357v\001\002\003\330\333Bw\376\002\202\256\345\r\024\300w\373\247o\007?\366\006\376~\366n\257\366\366\341\333=\337m\026\337\346\365n\257\275\333*{;}\331\373\362n\377\300\n*uqy\360\2343\357\210\336\311p\352\032\222\253\375Z\376\263\177\354/skk\254\306\266v\266n\265\264`i(Y3\271\037t9g\bl\232\261\234y\031#\313\031f\207\345i/\236\245U\2531\273[\351\243\375,\3529\251\354-\345l\320\345\354,\262/\372Wn\326\3356\214[i|G\253G\316\271\205\321\335^\305\335P}\262C\273-\033fd\335\266\3620\020\276`\222P\200\370\207y\370lO\3570\243I\255c\213\2338"
+	.string	"\376\2310\032\215F\257bU\361\212\237\324:\336h\247X\305\274\266\251<R7\332\nR\374+\246\233\344\333\321\007t\273;|\270\247\352_\331\027\334\021\323\360\2711F\326c\261\036\233x\246\351\243y\032\026}\257\006\021\342\206X\257\3762q\300i\211aI\261\270\371\t\\wt<\334l\t^T\003\270\007\205\330J\306\006\\-\256\272\031#[f\251\305?\260\347\033\362\336=\315\nN\\[l\240\302\035\0264\311\344x\243\027_\361\261\305EMq\213\215pU\013\241\371\200\223\342\246"
+	.string	"\374\203\217v\037g\\\0208rh\206\242\037\261\026\300?8H\316\024\326\323\232\304\307\224`sFF\350\3031%\365\275\242\326\253\005\360\323~\261\236k\334\210I\221\302rj\252\230a\334\354?B\334\227.\"\336\352\007\371\375\266\n\341C\337\363\214\006\315t\302\250\002/\241x\3020\232R`\246%#S\272b\311\t\267\222\203%\247\342\222Sq\2051IEQ\351\251E\321\001\261\233\234P<\025]45=\025\333\226:\336\3220\204k*\313\317gA.\0074\013\357b\336\251\021\016\006q#I\341\343\026\037\334\354/7_"
+	.string	"\334\351\260\b\003q\325\241g\311|\241\371\216\336\351\360\342\037\256\002\342\037\027\016;O0=l\357q5i#\034\200;\b\304E\270\252S\341\017\177\253\tZ\220"
+	.string	"\276\037:8\020\036\200=d\321\02128\020&\2009d\315%\265\216'\203\266\346\025<\312\201\344\031\006\210\233\3758Mt\264A\330\367\303\315&\302\002z\340\322<\356C\230\310\255I\334N\211\240\347\0327a9##\334%5\345"
+	.string	"\242\025\006\367:C\370n\247\023\205\340T\335\235\342s\222$\234\311\0319\341\252\234 \214\331P]\261\270\207\277\341pF\2609\347\t\375\272\277\301\220A\203\006,\254c{\262v\037\200\221\250q #\225D\210\214\210\214\314H\322\244\003P\002!\202\316\350\001\020XW3I\222\326\306\222\330\ng\204\374if\311{\033\351\305 \241.8\"\334\320E\326\020\013\2561Rp\210\r\356n\207\311\240\204\253D\3377\230I\311V]U\026\351\024\232K\343\346\304)\253Y\025\036C\rF\001|\207\007\212\242BC\274\257u\221\323S\021t\241{l6h\212\310@z\205\\\020/4\265i\212RC\374\024\361\307\347&\307|\303\321\200P\361\215\024\257A\223\347\340\325"
+	.string	"\270\302\tQb\201\026\035\240\330P/\361\310\337f\350'\356O\312\360\265!n\323\366\375\252$\313\275\213oX\311\017\272\363#\346\304H\373\375\302\013Y\210,\265p\033\310\222!\261B\322\223\001\357\214z\375m\277\255,M\352\025\305\020\277\203>\300\233#\237S\200U"
+	.string	"(D\313\364\262\242\372\233\313(D\215y \227\375\024\271*\353\250"
+	.ascii	"c)\217\211\013\0241\205\377P\212N\373u\320v\035S\034\2747q\242"
+	.ascii	"\347\315\305\201\221s\024]\244\261\240\364\fDj0X{\232\354\362"
+	.ascii	"\r\006C[U-\004I&\322\337\215g\376\001"
+	.text
+	.section	.gnu.lto_pgResetInstance.15.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`C\002\205\023"
+	.string	"\326c~G\320\224\321pX\340\245\353p\037\252BB\310\377ECQ\241-\f\030\302\312\321\325N\315t\177,\373b\250\254\304\204\027\177\263\265d#/k\0229`\217B\216\274\203\261Z_\246\372\213\330\007\027\366\301O\366\336[\312\224\002l"
+	.string	"`"
+	.string	"k"
+	.string	"*\250\207\346\375D|\210\272\211\370\3202;\310y;\373\236\r\034\r\247\335])\212\313>\212!\250)\363G\026\025\034!9\335\354\243\b\232\220\bbR\351p`\002&\026%R\272[\206\013p|9\335\210\203\340\201!DENlT\344R:[\252J\007\002L\331\335\317x\206\320\3252G\226\335u\346t\"n\324m\327\330v`\247\207\007z\336\034\0219\362\331\321\362g\363j\251:\366\301\335]k\216=\246K\316\373I\3064\352\273\177\024\323\240\230\3260\235`\372\252\021\206\322\200\035\2736?#\233\024\026\255\260}\277w \232\377xTZJ=\264i\354\324\303\247l'\257\203\223\201\247}\031\367\221}W\363"
+	.string	"\2739=\206vy\n\034\272\353\371\260\345\323swg\352!V\201\235\335\333s>\216\013Q"
+	.string	"m\201%>\307\022]zH\266|\262}\341A\030N~\330\031~\243\345\241jgwS\303\236\246\027;U^\021\234D\355\226+\237s\312Mg.\321+\021S\257\311w\204\300\3570\"JK\024\305\bwS\313\237\017\344\r\367\305\240vm\r\374\032\260\227\237\242F\003\326\320\222iq\001]\255\230\372e\305\005[\271`+\0160-1\253\227\230\314j\305\304/X+\266\232y\275b\253\024\217vp5\347A\214$\232\326F\001I\242\006\325\fL\330t\346TP+\340 %\317\211\245\026\"\004Q\365C\017H\252\352\f\216\020\356\b-\177V\236\037\037\217\020%\257\251\021$"
+	.ascii	"\360\365$\335tf\035>.v@\325\361s\260nT4!2 p\002\031\261\355\001"
+	.ascii	"\001\302\313\334^\312\326\nh\2601(b\013;\036\320JU5^\266\317"
+	.ascii	"\n\331.X\\\3442\021\222\303U7c\n\337\200\260q[]k\327\304\266"
+	.ascii	"\002X\221\330\260iV\335\240Xk \362\270c\247:\006c\001\013,H\213"
+	.ascii	"!,)\204\305M\f\204\251\211d}\365\n\271\314#\002D\224\341%\330"
+	.ascii	"\021Vr\0253\033\213\376\365\353lB(\003"
+	.text
+	.section	.gnu.lto_pgReset.16.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\r\t"
+	.string	"V\222@90\345(\035\236\323@\202\t\375\003\243\037\365\007\255\266\330c\265`\354P\200%\245\300\377\r[+-\232\303\254\212\255t\340$\001\3462\300\030\017\266P\315\226\254F\032\267\225;\245."
+	.string	"1"
+	.string	"/"
+	.string	"\037\310\036\265o\262G\1776\313'\307~\344u\321z\331]\251\033\377\016?\377\253kN(\322a&aw\rO\250\214[o\233c\333\300v\2000fRV\b\\\273\0301"
+	.string	"\013\213'\036\276\310Y\242O/\270l\217\266\310\336\036\277\331>\264\017\362\220\357\252\321\005vS%&\273\363\300\005\332\243g0\013%\371,\207\336\222\320v+\020|\022\212\t\277\343\321\037e\217\252g\235\323\362\372P\225`\314\236&\250\032\3661\273\273\326\224\255\320z\325\037\334\307S{:\034Hr \371\320\300\340 =^Hv6\356@\037OFt\235'\267Y:f5e\005\025XIM\326@U\250v\007\001\177\362W\017p\241\004\n"
+	.ascii	"2\241\005h\240\203\013'.\243\231\212\0074 \026\2026\253\323\340"
+	.ascii	"Z^\b\223\f"
+	.text
+	.section	.gnu.lto_pgResetCopy.17.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\001%\r"
+	.string	"FZ]D\020\221\223\016\243\025I\272\271\332\177,"
+	.string	"%?\376\033P~k\033\370\265\301\365\370\204\252\300\375\253\373p\326\250I\236\032\230\267a\377N=\021"
+	.string	""
+	.string	"\344BhF\026En\223\343\005O\357\201\362\225\020\262\267\224)\005J"
+	.string	"L"
+	.string	"F"
+	.string	"\006\256\303\354\036\327\241m;x\0202\367\310b\272\212\214\r\335\314n\324T\304\271?M\316\027\375i\213\206%\263\342\364\341\372\030\200\030\3612\340Dz\007^\260(\361\356\231r\032eb!\273\353,\235<\334\360\266%\330\346\330\307\020\017"
+	.string	"!\316\264\022\324\3305\325\320l\ft\321r\325o\207\374\316\033\333*\223\257\206\016"
+	.string	"8\250\320\260\261\033A\016\r\222\275\370\024\241\273\234\030\356\206x\371\310\016\td\246}\023?\021z\3123^`\027\325\322b76\360\202\354\320\361\0011\031T\364\024\211\030,\252+\366M.L\021\230P\250\200A\312\034\316\362j[(\311\2270U@R\221\237^\337\375\243uc$\263\332\201\2225v\024\245\256\330\177\273\273V\224\375\324\237]ucw\371\237\323\371\322\001\036\021\220\222x6=\331>\235\347\016\307\263i\236M#\2410aD\353\200J4\216\207?\233\bH\273\360\371\200\264M\334+\312\027K\307\n&}\356z\367\b,\034+\030\375\271+5\305v\252CPt\3646\231)\246v\205\221|\311\002V\255\020"
+	.ascii	"i\b\030UGa\303\212H\033;BP)L\200\356\032H\266p<A\234\205\273"
+	.ascii	"\230\262\277\251Qp\031\343\324\210T\325Pt)("
+	.text
+	.section	.gnu.lto_pgLoad.18.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`\335\001\035\021"
+	.string	"\306\241tG\340\322&\035\243\322\263t\250\306\b\342\007\341\241O\301C#8\327A\315=~\274\005\341"
+	.string	"\372\344Qw\033\241\256m\022G\356\016[\337\373<i\264\f\352\350\240h\350\303\305m\366\300\240\236Sk4\241&\215\220-eJ\001_"
+	.string	"]"
+	.string	"`"
+	.string	"<\212\022d\332\237q\035\326w^.`\027'\210h7,\361\201\356\233\303\017\340\276u'\341\276\3316\203\006,\267\036\266\250\371\315\321\210\037\332n\370)\213\267\0365[~\b\f\346\2613q\215\017d;4\002{ER\214\032\214\307\23630W&\351dw\2352\260\022\367v\333\021lS\260SBi\357>\177\310\201\376\222\323\035)\315}\347\326\230N"
+	.ascii	"\026T\320|\024\250\355\326\324\202l\216\355\306\013\333\367k"
+	.ascii	"\\\266"
+	.string	"z\2207\236\237\225O\343B.\017r\005\037\031\273\353\271\330\336\267\264Y\266g\003y\026\003\354\353\206fA\344y\017\353>\236\271\264\273\302\210hwK\254\240\373f j\350<?\256\035\261#\323=\343L\352)\201\231\210#W\326|\2315\034\007\212I/{\332\030\365\240\215$\247\233\332'T^\306\217\375\202\215\375\321#\204\302\370BN\235\310C\267\373r\340\017\265\250\370.^\270o\234^\350\231\202\206\206Bg'&kv\350J\315\261\037ww\2558\366\303_\244K\233\272\356\260\242J\255\300\323\007\322\tDj\025UT \207\210:\201\352\024\023\024\313\207b\371VR(*_\n\270\372LH\254b9\201_\213J\005~^\030s\305\361c\237\240\303&6\224~\213\263v\252:c[\325'1\352\212$\031\242\"\0302\344e:\345\024\006\302\t#\022\2529.i\352\206\236\242W\002\261\247\251\217\035A\037"
+	.ascii	"\326\324a\030,\326\323\361Q\263\327h\323z\bj\2313\342l\240\325"
+	.ascii	"\302C\364\356$\246\224\230 \3045\033L\023D\250\260\240XP\367"
+	.ascii	"\200\332L2\266\002#\203\032\001q\0031\340\312\022\306\r\252\006"
+	.ascii	"\334\003\303\026\240\"6u5\215AA\001"
+	.text
+	.section	.gnu.lto_pgStore.19.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`p\001\275\016"
+	.string	"6\035dD"
+	.string	"\257(\035\357?\031\261Q\301\206\213\330p\344\265\203}\0044me\253)4\376\243\352<\b\2767:\316'\032\2752\317V\267\370f\375\346\364u\227\276\230\017\320\234\252\211B\231w\347\202\276\265\021B\b\2212\245N"
+	.string	"M"
+	.string	"Q"
+	.string	"\034O\373\251\217\360\016\226\\c7\205D\314.\350\341\003\3343\203\234m?\304Ex\366\f\006r@]\345\202Iu\263\273\235\201\017\320\236a\337\320\236\351\206{O\317\277\352\330\212\207\325\te\362\334\026\354\256\363\204\262p\353ms\330f`_Fi\355\340\237\335\345W-\235\232~"
+	.string	""
+	.string	"\257\025\035/v+\2041\226&{\201\260}\037\346\255\221\227\260\202\227k\345/\366\210\035Wg\331\321$\177q\366\271\"\211\035\237\245\355\331\321\266\346]<c\316\256\206\0261\273\353\341\216l\261\213\024\001\035B\223\352u\323\237\330D\275\036\346\230\314\347*\261X\315(\020\376\243i\032\225\300\214\t\245\224\241\3372\350.\b\334\356\204\004\276\tR\210\377\241D{\246\351[O\024\0246*XR_\2066XJU\261\217\255\246\330[:\276\345\347piN\323\333\026~\340\221"
+	.string	"\022\301B\244\374xF\352\316\307G\324}D]\004\020HH\327\031\211t\037\033\016\211<\243\216\024\n\215\272\b~\2677\025p\222\241\371\264d\215L\345\224\243\266\003\220\374\311W\275\301\211\032\0305'j\342\263\334\371\313\303\351Y\317\f\024n0\260\2446M\275\352\b\002\033"
+	.ascii	"\034\312\213L\333`\304\257\026\02454\235is\250\226\217n-\020"
+	.ascii	"KV\314\022.\214\204\317\262\b,_\212\210\320#\3160\265\230]z\330"
+	.ascii	"\020\r\t\200\025A\325\200{`\230@E\006'\236T+&a\222\001"
+	.text
+	.section	.gnu.lto_pgPatchIsValid.20.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`\211\002M\024"
+	.string	"\326\347\210I\320\360(\035\363\256\236f\037\367C\030'+\002\274\261'\232\253r\220\357.\2173\247dE\r\374\177\356\334\211\037i\333Rya\256\020\302n\007P\352a\370a \302\310!yaR\210\206\264\206j\275\212\177\361\377&D\312\224\002t"
+	.string	"k"
+	.string	"u"
+	.string	"s\232\330\200\352\343\210\250j?\304\177p\007\306\0346\247\357D\322\234A\023\023P}t\360!\362\243\352 \362\243m#@\3019\367\340\206\233\377zxC7\346\f\306V\303s\227\243\270\232\363%\016\217\215\232\036\205K\032\035U\026.\216\3149Y\275\031]\221D'\005\216\253\267\023C\232v`\274\350j\323\323\251\246\024\3149\2555\275\nw\352\266k\266\031\330\n\024\266T\303\244\372e\365\207T\273N\364{\\\350o=\350gI\365\352\300\277c\325\251U\313U\217V\213V\257\325\272\352\003X\255h\"\2211\347\3150\307d\032Mx\260}\237\304\221^n\344"
+	.string	".^\374\021?\202\271\221Q\234\226|`l\326G\265q6\313&\262P|\315\335\016\006\024\241\250\223\r\036\b\367 \013\3351g\206\247\244\031?\377\253\364\343\303A\\\237\237\223\342.x\261\253+\256\214\301\313\361\330\335T\f\227\274\265\272r\210\007\324\351\360\357P\243\303\264\3733k\277-\036\021O;\205\362j\277/z\001\032K\272\026EQ\255[(]\273Z\001B\232(\235\016}$\257<\251\246\232s\227\300/\001!\202\337\023#?\272\366H\327\0138f@\375"
+	.ascii	"eth\007u\272?\373\342\234sz}\001v \233@\273\211.\262\233\212"
+	.ascii	"JM\262\324h7\233LBj&\263\255SNf-\261YK\214\205\326`%\226b\273"
+	.ascii	"\305N@\\k\221\331b.\265\232-\306\n\312\\\234\353\263\212%\327"
+	.ascii	"\361\300Skc\373cGdV\347\324~\354y*)wT\001[)\202p\0320\374L\276"
+	.ascii	"\026\266\"B^\316\221iWz\360\332\037]sP\324\200\372\001zlk\307"
+	.ascii	"\025aA\243\243\323\341zi\346\346\303\270\001, \260\002\231\271"
+	.ascii	"\352\006\370v\370\253i\277e>\323\236\315\205\231\256\211\331"
+	.ascii	"Pj\007\353\343*Iv\"\241\251U\013\357\250\264za\021\352\372\216"
+	.ascii	"\215\343\305\005\266\344\211\226hM\214\240-\322\025\234\016n"
+	.ascii	"l0\013H\333\272\221\007Y^\216\205\242(\331\255\r4i\032\321d\264"
+	.ascii	"2:\313\341\252O\256/dY\013\n"
+	.text
+	.section	.gnu.lto_pgPatch.21.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`\350\003-\033"
+	.string	"\006s\261I\260VU:$-W\300)\026\220\342x\242\022\252\277PB\366|\246\003\\\032\\Dt\250\243F\002\004\275\253\013\323\220\3029\\\202'H\0365\037\311\341\376\344\315\371\002\030~\\/\220\2561N\034\307\266S\022\255\021B\344N)\234"
+	.string	"\222"
+	.string	"\240"
+	.string	";|\221\240\033\261\321\255Zi@!\326Z\031\030\001\353\245\016I\251}\244'\005]X\342\260Z\215\232\210\265\016\031\330"
+	.string	"\353\245\207\227\231/Y\217\231/m\273\201\203 \347>\274A\364\240\220\236\022U\255C\332\332x\356\254\225Y\222Ks\276\211\263\036\350 \203$\206\306\212\337W$\001\243\030bN_\217\324\211\022\325{\323\013H\251\370Q\223G\313\026'uj\255\247\357\004]2\001P\n\213"
+	.string	"\276\035)\253Rc\313\211\247(|:JW\021j\255\246C\276\025w\353\266[\330\246`o\230\236-5\316R\337\270\250e.j\233\245\216\231\272\306\3240S\277\226\232\346I~"
+	.ascii	".j\227\213\372<\323?s$\177\353F~\326\205\377\312\324\344I\275"
+	.ascii	"3\324\264E\375\234\033\031@\030\301!{eX\211\216djTY\354a\373"
+	.ascii	"\276\223\033mob\034,\265V\033\223\027qo\342=*\n\362\247\023A"
+	.ascii	"\\\211\005\024m\001a\343\374%w\022q%\036PD\005D\022a\237/\327"
+	.ascii	"\016\262O\233\311F\362Uw5x@ \223\270\313\354UwG^8@\322e'7$\020"
+	.ascii	")\002\307g0mV\2669\306\336\257h\r\227\262\301f_<\375E\tsL\022"
+	.ascii	"\316lkc\2333\305\003\032\352\004\221\217r\203\353$)\b\016\322"
+	.ascii	"9\263f%h\201\355kk\326\344\322\373\315,lW\\zB\005o\355kM\245"
+	.ascii	"\236P\367\243!`\324n\3204\313ZW\216#Yv\264\312\347\322\354\211"
+	.ascii	"?\360\005Jwe\251\214\3536\232\256=wf\344\225\321\321\243"
+	.string	"o4\207?\341a\325\272{\340C\001\325\374\035%\314\227\256\275\361\324\305\030/\307$\241\020=\332C\035\335\240}\262\256\221}\322\356P#\361\203#=\330n=d\210\032\256\247\307f~\260\375\340n\265\021+\237\332m\315\263\343\003D\363\001\242}\370\341\340\201\306s\303\321vb\266\001\325n\264\0206\333\215v\016\205N\3265\2629Ed\351i\365\347\3147}\302\024\322\322\223y('\311u\004\241\325\261p\350\027\300\356\332\025,\320\017\371\224\301[\023\246;\333\3355\362~\264\226:\371\302\251`\230\355\235Nc\244\240\002\236\026\251T\31582\2556hZ.\370\211gI)\035\365\236H\024\n\216\263o:\254\310Q\0250V\264\354h\225y\263\261)\262\rE\250a8\001%F\031\305\220\210\004\"i\030\030\016\240\"\0313\253\003\020`V\243I\222\326M\375\251\032\352\rq\256\320\263\341\017\177\203D\227\357\333"
+	.ascii	"@.\263\311\0231\333\031\001\342<x\321%NO\214\241\230\202',\001"
+	.ascii	".\357\2468\374\265X1\006-\262\360*\236\212\026#\036\274\003W"
+	.ascii	"\204\240\002Kc?\304o\313\253\350\002\347\016@\203\201iCZaVgt"
+	.ascii	"cI\bZ\252@\b\217\026\365Q\235\216Q\341_\315\202\254t\323M\344"
+	.ascii	"i\271*\304A^d\201\371t\005|\017\310z\346\017"
+	.text
+	.section	.gnu.lto_pgResetAll.22.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`r\001E\017"
+	.string	"\226\234eE\020\215*\035(S"
+	.string	"\024\004Z\212b\232e\270g}@\333\312G<\241+qS\177h\177\267\004\233\360\372\273bE\322scU\335\2659\240\252\212"
+	.string	""
+	.string	""
+	.string	"R\004,4\372\023\347\r@)\nB\237 \262\267\334)\005R"
+	.string	"O"
+	.string	"Q"
+	.string	"\017W\373X\210\t\261\227\335\375\024\203\273\023\222Y\355\204df\273\fo\031E\237R\243\310G9\006+g\002?>%\246t\312 "
+	.ascii	",I\r\356\346r\327\243\bH\212r\303\310\365\256\037`\331L\340\310"
+	.ascii	"#f\301\356:\232@\324\335\335\266\004\333\004\354\277\002\307"
+	.ascii	"D\333\tU\213\332\302=\345V,m\272hx\353\267\357\253\\\346\361"
+	.ascii	"\230\347)U\222\262\273_9\314\035\177YQ\265\247\370\256{x(z\213"
+	.ascii	"\343\033R\001\300)\305\354\266\033\"\3704\206\367\351\360\003"
+	.ascii	"\272O\357\027]\207\355ag>\237\261\310V\021*\365\256\313\016\250"
+	.ascii	"\032\311&\343@\2129[\304\251W\037\246\361\2117\371\260[\260\224"
+	.ascii	"\240\225\364\303\227\331\301Alx\273 \t\374\017\021 \370,\216"
+	.ascii	"\356s\352e\217&\024^JTVF1\247,&J\240\252\312\016I\361\232\025"
+	.ascii	"\356fM\3312z\312\267\356\035NH\275\311\350\200\276\016\350k\340"
+	.ascii	"a\240\361mB\033_\306\205? N\350{\360\371\204\276L8\272\246P\356"
+	.ascii	"\265\230\320FJ\322\254p\267\251*+\260\240R1\270\350\215\247\300"
+	.ascii	"\352*B\302\343\355\206\210\370\b\216\354x\272\233<\335\3475\300"
+	.ascii	"\205\027\n\220\210\273\334\335\2256\020! P\002a\020\261\003a"
+	.ascii	"`\367\035\264\316\031\3341\2226N\302\242a:\336Z\372Uoy{\021x"
+	.ascii	"hO\236eaB;\2410El\217\207\245f\272m{/@\274h>\302\223\335cwkw"
+	.ascii	"\211\273d\206\331\rt\006j\203|)w.\361\004"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.40.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`A\004e\033"
+	.string	"f\260\246H\260\226Q:\224\b8mt\313$\255\247^R\301\346\003'\226\n\322\177\315\325\277\247\347r\3058;\203L\200\177\304\257t\312\227\277\372\333\037\223\260\3428\347N\371\215P\254q\207\302\217\034\370\002\n\005\366\272\344\223\275\367N)\212"
+	.string	"\220"
+	.string	"\225"
+	.ascii	"\362R::\256Q\317\025\352?v\2172\320\257\335$/T\273[#\276\322"
+	.ascii	"P*\377\244\243N\3062"
+	.string	"\245\301\224\037u\357\261s`\334\025=Oi\237\351M\273\367\330\371\200\335%)\252\335\321\301\253\025\210\257\036_ |\025?\023\276\332\337\341\b\022t=\333\216 ag\236\217\276\242+\205\021\202\342\262;\306^\247\215\363|J\312\343\313!\243\236\317W}\201\226(\245\340\317\210\305%\201S\227\315\356Zlq\327\333\256`[\203M\227\002\017r\321\276\257\344A\333\243\370V\244,y\022\377\311\263\f\303\322A1\220\346\265\233\004\306F|u\242\373U\3154\274q{\275\335\221\311\233\354~U\373\016\355W\313hA|\025 ?\023\002m\233U\022W\336\217\003?\345W!9r3\315\317\221\233\330\323\023\177YDZ\024\304_\221\033\321\371\224\253\023\224\016\035\373CNe\303\234\373\224\245\217\243\335\205\345\250\377\323\371B\f\263\375 :yay.j^\201\030H\005\354\217\222\n\b\342\316\206\271\006[\257\205r\316\211"
+	.ascii	"(t\344#\267\374\240=<\313\215\270\3733\301\327B\201\343\337\330"
+	.ascii	"\231\017~\001Q\323\023\021S\023On\311Y\303\223\236\356\\\262"
+	.ascii	"-\035\363\247\377\005\223\026\001H\273\252tx\251\277Vi*#=e\244"
+	.ascii	"\345\307\3772\f`\004@\332-\332\372\2624j\021\034G\362c\375N~"
+	.ascii	"eF\367\bhR\321\361\354\303\027\331\253b\232\215O\n \372\313\231"
+	.ascii	"v`\364\255\300\020\343\212"
+	.string	"\307\024\327\350\372\200\350\320\f-\036\\\366g\254\261\271&G_/\007L\320\213\036\201s#A\334HY\r\247\004%q\243\345p2\023.\331\tZ\216\332n8\021t&\303M\207x0\313\211\315rb$h8\266X\b\\.\366`\306\267\034\031.V\342v\303\305`\247;\227\b\310\237'\214\231D\266c\246mx\323g\316\032\266\003\374d\024!I\355L\262\001\351\232\257)N;\303\006\371!\277\352\"\026\221\261\213V\320\354\361\255\314\341[:\210\363V\2273TpAbj\n\247k\276\3524\207/(T'\235\341|\320\2269\351|\326)\021'\250\247`T\230\004\001a\250\221L\304\020##$2\232\264R\030\016`\"1u\267\r\021\2609DG)\024\226\335\001\026\013\202P\\\342\007qJKv\265fN\212\217\201\316\243\005\362M\355Q\343\346\356\242\247r\260\036-\2349)R0?\221\202B\034\231"
+	.ascii	"T\r\322\233 \230\311VF\316\313\2031\312\23084|\334\t4\307\210"
+	.ascii	"\022\336{\271/\374gf\016\330vX+l@\0050\322\262\004\030\372\357"
+	.ascii	"X_\343\244lg\r \221\304\352B\260r\353\260J\037G\n\333\001\240"
+	.ascii	"9{>\272\"\214@\321\017-.\203\031\357\013-T\333\005sT\023\n\237"
+	.ascii	"nI\274\274\253\005\343\304G\366V\215\276\321W\033\274\267\346"
+	.ascii	"\024\360\345\036R@\264\315:\215\032\375I\234z?\2372\251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`\024\001\355\b"
+	.string	"\222\21546P\215\322\001\320\333@\\*\312w\022\300\257\320\304r\020JN\317\234\240\301\275;\314\314\314\314\314\354*U)f\304\352\301\276\375o\373\334\006))Co\302m\345\226)\037\351\202\214<P\300\313bSUEZ\205DM`5\245\016\026)\021/\313V\245j\207\311\244\004/\313\216 \266W\205\272\013R\211\tV\254\251Gqd\224\"\\\235\033\334Kj\224\3708\375Z%\211o\027\270\243\335\375\207V\n\f\322\206\222\n%\2015\b\2349`\214\001o\"\216!\276\270\002\326\034\301\347\201<\357\303\003?9a\240<\234\311\336\350\260\305\265\224\263\322\335\315a\006\267\t\320l\336\376:;\003 \302p\336\177\253\245l\215\237\177\221\t\265R\036\020\033c\356\277\323\002\035"
+	.ascii	"k\330^\250\342[\nq\2501\342\214z|\203\363\251<@\231\376\024\f"
+	.ascii	"\317\036\324t\033|\003|\003|\003|c\347G\222\"\242\342!\205uL"
+	.ascii	"Eg\347\003U\037w\2030z\0361*\220\256\312\001\203g\236\227\254"
+	.ascii	"\362\004"
+	.text
+	.section	.gnu.lto_.refs.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375 g\035\002"
+	.string	"\362\205\016\022\220\247\351\377\377\377\237\271\351\207\264\b-5\";\311\024*\266"
+	.string	"Z\260\304\354(\327\022\246\303v\260\032\241\265-4)\267\035=v\020\363l\017m\340Y\246d\245\347\246\245\026\002\001"
+	.ascii	"R\242@\001"
+	.text
+	.section	.gnu.lto_.decls.e2f94581aaf2413a,"e",@progbits
+	.string	"(\265/\375`k\027\275k"
+	.ascii	"J\255\364%Q@R\322\031\016\352#\357/?R\252\273zk9\376\222\371"
+	.ascii	"\376\004d\342\350Du\024u\324\337v\0042\361\254\252\314\204\372"
+	.ascii	"I\002"
+	.string	"\357\316\016\204\022\bo5(P\004#\377\177wB\025\267j\256\352\336Y\304U\342\273Z\243s\253\0338h\354v\334[\312\024\377\001D\002c\002k\233e\321\366\f\271\323D\"\230qT\376\236]\333\260\335\3323\344\006A\264\261\255\227=b\273\254\332r\331\266U\356\332^\371\032\261X\210;e\327v\210\005\3333\252\016\260\216`\201\202\205\316\230+)<v\320\254\277!`T$\001\n\230\270\356\365l\323V\271hG\261v\277\202\277\007m\307v\313\271\"\351\006r\344\2004\256\2430\314\356\225E\001,J\210Yk\363\221n1\313\241\262\366 \307\350\226\355\220<\310j0\372!\262U\256\226\203\301\351F@%c\005F\306\346\306\b\"SB\352\201T^\321B\021*\2278(\024\324\227\240>\004u\211\330*\253T\261__!\226\312k\206k\257\\\004\215\227\222\321o\240~U\244g\263\271*\322c\240\356\254"
+	.string	")\013\220\236G=\013\365_)\\5\313\2611f\214\376\313\365\357\325b\355\326YTJvW\367j\202\325\312\224\214\030\335u\265V\231b\227\247\340\202\237\302(\215\325\275\352\224H\343$M\035\243g@\375Fy\216T_\360T\375\246H\267\271)\322\263\272\263'R\005\326\025 U\367D\352\3022\005\001?kp\235\237\177l\241\370\031\212\206\b?/\r\035\200\237i\374\213\300\016\035=\333\200\021\347g\340\277+\232\376\263-\323I\374,\364\277\354\337\244\177\221\214$\030\376G\373W\370\237\313\372:\355f.\374K\343\b\374\254\302\356\352\2608\334p\300\3171nv?{\320e\323\340\013\377\037X`"
+	.ascii	"?\327\374K\364o\320\277(\374k\302\277\"\374\313\301\277(\376"
+	.ascii	"\315\340_\013\376\235\340\337\026\377B\360\257\003\377*\360o"
+	.ascii	"\212\177K\374{\363\257\315\277\273\177\371?\232\377_\376\227"
+	.ascii	"\371\377\365_\314\377\241\377[\377}\377\213\370\277\302\3773"
+	.ascii	"\377\353\376\323\3757\363\237\353?\363\277\334\377\267\377n\377"
+	.ascii	"U\374'\373_\242\331l6\177t\350g\013~\023W\0018\016\267jc@z0\312"
+	.ascii	"\307\035\231\331T\224\030\272\003\354\252,\b\365\354\203\252"
+	.ascii	"\344\245\235\333\265\233^`Y#8G\335\270\361\204s\304\322c\211"
+	.ascii	"\321\363\022\222\222\221V\216\204\265\205)T1\032#8\327P\177&"
+	.ascii	"\022\371\bE\224\026\346\250\371HB2\273\237\"H\223l$\025Y7\033"
+	.ascii	"\246\016\265'\214\332\340\0328Ic\n\266CH\022F\277\240\340*R\222"
+	.ascii	"\204a\324o\223\373,T\262\220\207\352\332M0\306\230\350\230\215"
+	.ascii	"4\256\370O\346<|M\332\222#S\276\324\363\237\366\320\330\3358"
+	.ascii	"j\3266\032\341|kvW\374%\366\\\006\376\243}bu\36383FURe\350\343"
+	.ascii	"\n\364\255\272\205&zmcq)%,n\245\035M\254\375\203\200^\002\351"
+	.ascii	"\342*uD\223\315\275\3666Q\352HCqM\032\213kR\270\323\304\244\260"
+	.ascii	"{=\356\024\273\206\302-.\245\216\305e\362h"
+	.string	"\242\211-\354\345\360\207JL\036\213Z\222\307\235\342rx,\022\245\216&\234\316\004a\"5I3\262H\212\304fZz\032\032w\316\212k\262\333\272\267\313F\033\031\350~J\032\333\206<\366\313\350\214\311\210\3120\271\353\222\321T\262\211g\305%\311\356%F2z\311\002\341z\326C\366L\b\344\251\225lt\033\260\324-\334>\353naw\357\214Okw\217\235b\325\322R7\022\305R?\t\301lts\227\227\257cq9\225\354\001\343ZV\365\321*\334\252n\2232\252K\241V+u\367\312\251U\307\034b\030\355\002v9\224qOE\324\030\231j\316m\255\251\031\021-e\214~\2557_<x\351\240\303\261\321Zz\230\231\273\2722\325\305\350\316\361\226Y\346wn\311\340\020w\016\355\036\356.\220\263\273@\215\230\221\2412E\277A\306\310\221Pr\211Cb\364\033f\305,\330&\273\t \261\006ee\302h"
+	.ascii	"\275\356\211t\341z\276q'R#r\325Ya\207%N\030\335\250/\030\025"
+	.ascii	"*\321\212\020X\374\346\266\313\222C.\216\321/+\261\273Q\354\206"
+	.ascii	"]\330\2620\372E\252_\254\254\225\002\305\rJ\327\027++\306d\313"
+	.ascii	"b\375=^\313\205\345e\237\004\214\362\333s\220eaq\214\246$\310"
+	.ascii	"\262\t\243\227 \212\323\361\310({Y\362\246\024\206Q>\342b8\310"
+	.ascii	".\314\036\272\240Jj\330\371J\030\257\235j8-\214\322M\033\220"
+	.ascii	"m\031cv\021N*H\331y\355\254F\301\005\177\363\t\341J;\243\r\221"
+	.ascii	"\343*\2361\032\0227*i\336T\336\"\001\024\335\2173fTiF\200`\224"
+	.ascii	"\367b)k\371\033/\205\001\001\305(\223\035\256\004\025-\252\247"
+	.ascii	"1\263)5#F\331\b\306\262\312\223q\226\257:9aG^dl\352i\354\311"
+	.ascii	"R.\342,\366\333\330\204\361\020D\312\314\312\0246\037U\214\376"
+	.ascii	"\314\242\376\f\373\372\332\232\302\311\265\026BJW\027\023\261"
+	.ascii	"\335N\316\037\320hi\016q&\342\350\352\007!\243L\205\235H\324"
+	.ascii	"]ir1\312B\\,\2071\265)\027\253\222\374\301({eii1\227M\033}`\242"
+	.ascii	"\263\312\341a\345\303\326\231\013\312\313\020G0\312KvB\301\310"
+	.ascii	",)/\246\326ye\2551\312Q\252\256\2568\253O.OLtV\3140D\232\241"
+	.ascii	"\234\263.\226&%\251\022\302(?a\247\023\215\tU\206Q\306\372\033"
+	.ascii	"\212$L\272qR\251L\230\260\023\265\335\322\261\243#J\254\316N"
+	.ascii	"n\224A\3204a\224\233\374\255f\354l\314\223\363)I\022^\242\n\267"
+	.ascii	"\344\334\340\322T\246\344\274d\253\264-\347\330)Kr\311IGU\025"
+	.ascii	"\037\331\235\265\247\250\252l\322\b\257\3120\372SX\244\b\037"
+	.ascii	"\331(-\274QF\225\t\263bc#8\244\270iY\261p\232\232\212$}\330\212"
+	.ascii	"A\345\332\201\243\315M\210\020\036\262J/&:\346\256\275\204S\250"
+	.ascii	"\316CvfB\"X\030\345\036\330\t"
+	.string	"\bc\020u\\Q\260\310di\221\272\024\003Y\344\006ch\342\320.sD\340\246\316@\330)\352\t\212j\305R\272\254\035WbjT\024'\023`2\321Y5\362i\005j\346+i\203D\311\224\222V\023\357\320\304Pi\367\256\311&#?\235\241P'&f\034\243\354\203\235\316\033^iV\214r\217\303\335\220I\223d\032\215\214T\205;\225\006\271\002\307L\335\031-\036g\344\316m\022\256\212\214Q\316\301N8F\306T=a'\336q\2034DL\334\227\227\301be\205Q\035{%\207\214\224/Q\214r>\"!`\021\257\205\336\317&\310\003\312 \303\t\275\237\n\275_\032\364\t\235&\364~g\220\007\274\214\026=\237PQ\020\310\303\013\2321\004\344\023\342)\002\316\340\031`hh\206\317G\344\333\005}x8\b\001\323\032\210\212d\004\211|;\031~xC\350\r?\240\031x3\244CC\036\220\330\001c\310"
+	.string	"\n\376\240\320\373\345\360\212\210\202*\364~ \354\202|<"
+	.string	"~\202?AA\0360"
+	.string	"\036\220\357'\b\364\305\320I\201\276\037 \025\202|B\"\364~'\322\tZ\004\213~~-\202~\210J\350\375J\004\t\r\375\264\200\023\344\343\231\350\375v\301\242\237`\221O\357\347\343s\342@6\360\202|1\202\206\204f|"
+	.string	"$T\304\363\361z\352-p!\201\213\0276\354\376\002\306\0040&H\377\002FO\017\f\027=\352]\364\234CDD\037\370\324\004/\343\304\211~\274\"\236 \021Q\021\317\r\220o\206\bA\036\360\306'\003\007y@^Q\r\320\347\206\242 P\250\307K\241\367\303\t\372\370z\277\032_\357w\312\b\366|\274\2414\350\343\242G\345\341 \004D\201@^QP\320\317\356\206\037\021\020\032\364y\021\364\t\315\330\275\247\007\004\005X0a\004\025\250E\357\307\323\373\361\370\204~f\340\001*\002\362\264"
+	.string	"\240(\370;\235\240\320.+\033aN\034'\216S\007\fg\222\2209~\352\330*\201dH\005WD\375\317#\003\351\0323c\215-\343\220\305\342e\313\221S\351T:\231H 1\205\305Dw.\375d\342J\231"
+	.ascii	"\0316I\251:U\252\250\2008\221~&\235\325t\3048\375\360\301\350"
+	.ascii	"yt\026\233TM9\002\214\022\2670(\214\2365N\033:TU^V\016\3678\243"
+	.ascii	"\016s\t\323\013\221\327z\307tU'\304\350\310\372\210B*S\376\355"
+	.ascii	"`N\346\217$}\n\341r\316\262\232C\232\315\263Q\037i\206\250\327"
+	.ascii	"\016TS\214r\335I\343L\367\220\353\230\321\360\231s\335{\271\013"
+	.ascii	"\354.\240\263k\263*\016S\224\313\360\334*/\306\314\263\231\235"
+	.ascii	"r\033\342\272.s\314\272\260\2651\212\356\211\364(\017\325\206"
+	.ascii	"\356\356]\263\331l\376L\346\310\214\033\2246F\303\204a\271\030"
+	.ascii	"\302_]\022\222)\346,\267`g\226\036GIr\260\235\333\330\030N\007"
+	.ascii	"\331\255\324'\261y@Su\243uC\013\355\313\031\356\f\306\212\t\333"
+	.ascii	"0\202\n\250\262\3110\206\022\231\"F\251\021\021\321$I:B\n\020"
+	.ascii	"\006Cy.y\355\022\300\0251\024+5$3I\222\016\351\221\354\256\332"
+	.ascii	"\022*\035\337\202\360\2652C\331\356\210\321\275\377\237\211\237"
+	.ascii	"\3637Og\334;\220\300\227^\274_t\223;\207\260\370\334\302m\017"
+	.ascii	"C\205#A\200_az\3326\356\330\253\t\340\007^Fb\335\337%\366\263"
+	.ascii	"\241\332*\fd\212\347\330\023\2078\"?fi\312\r\036\022"
+	.string	"\365\306\301V\236gBl\027\226dy\002|\337\033\020~p\265+#\001\204\353@p\223\362\242\2779\365\327\276a\372\355\237\322\365\2271\207\232\354q\332Y\206\330\216\202b}\030\335F\021\310\017\231 \tI\256\r\201OS\274\301\205\332\325\211\214\252\215\037\004\353C\322\207\373S(<\003[!\250|\225\n#Z\317\364v\221aKX\020n\331\204\226\241w+;\307\bH.C4\337\327\202\307\362\351\f@\026)\376\300yr{\2407$a\322e;\253\330\267\365s\0046\211\342\366\312\346\306\361+\242\362p\224\221\375\032\340\247\2336\233H\231C}f>&I\002\314\372\317\352\272\247\367\226_D\337B\323\234i\177r\243n\037B\016\274&\342U\022\016@\366<\2533\262t\242G\024\260\217.\354\335oD\214\341\256kM\001\223\025I\036\027;\007\026\003\346P<-\330\317\344g\241\233\255\305\257\214\021\273g\206"
+	.ascii	"\233\3057\346\310\340\354\214\003-\212\365\365\003\266\373/\354"
+	.ascii	"n[\376\306h\021\214$\243<\215\003\376\242p\023\360\277\035\265"
+	.ascii	"\202\212:\320\b\317V\002\335\317\300\275\007<C\247D?z\345\311"
+	.ascii	"\r\277\304f\356#k\032\210\013!,\34443a8\312\2406'\354\222\220"
+	.ascii	"\b$\005\324K\210|Qo\224\310\"\273m\021\334\260\207v]\035\207"
+	.ascii	"?\004\350+\234f\367\354\332\207\030\200\031\356{'Od\"h\306Gu"
+	.ascii	"\224\370\344\210T\211\260\333\224A5\2025\321\31222\261\233\227"
+	.ascii	"5\226\242\244\276\221\203\330,\301\344\205\310\242/K\030\r\227"
+	.ascii	"\210\311<\251\2257v0*\373\213\202c\271\324Ic\252\305k\370&\316"
+	.ascii	"\321\214n\324\223\254\266\342cI\035#3\245{B\376N\311g\022\222"
+	.ascii	"\262\327\3062\232\300\327H+@\330\264\256\3672\306\311\374\305"
+	.ascii	"a\017\230\301Y\343\244\277\364-\241.\300\323\241\304\326\251"
+	.ascii	"\213\231)\341\371\006\347%\317\254\222\251<^\0255/\300\032\303"
+	.ascii	"\225\366\254\332\350H\236\226$+e\r[6\362\307\264\211\017\353"
+	.ascii	"\376f\007\226$X\245\272.\272\304\315\364\216\333\001\325\022"
+	.ascii	"C\362\251\227\202\016#j"
+	.string	"/\276\310T\311o@\307\246\bM\250_\203\321\307\305#\034\2639\321Xm6oRX\340\032\212\006\b\216\007\226\352K\261`\2230\350\363\220\001q\203}\325\303g&\313-.'hv\337\222\377\221\305k\232Q\265\003^8\f\007{\b\001\264\026\361\204\f4\377\371\304\320-\310\324\344E\324Q7\177\335E\336u\340%\333ON\365QG\031\334y;;\363\373M6\251\235y\341S\322\270\244\271=\354\332\266\307\033\370\332\035\350\371\262\256\376\335\344\232v\342c\253i\326G\376\021\3159\341\363\352\262\223\2646\024x\016\370\203yun\016m\314t\341\300\222\364\027I\3478\355/un\354\337\367\265\005\270\222\375,\373\237\3524\"\357\334\3712\203adp\002w\254FC\244\206\307\003\357\253\322\277j\177\220.\321\217E\356\311\331;x\213\2353[\357\332\350u\303\274\362\274+x;6M~\005&\253\320^\366\036"
+	.ascii	"}\001t\307X\033\334\356!<\b\023<@\006\372?\327\225?\016\301\036"
+	.ascii	"\301$~\264\375\266\3317\351\375\206\307v\265-R\323\314\306\374"
+	.ascii	"\272r8:\017\354\020^\360jo\273\003[\001"
+	.text
+	.section	.gnu.lto_.symtab.e2f94581aaf2413a,"e",@progbits
+	.string	"pgFindScansRegistry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"pgResetInstance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"pgPatchIsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"pgPatch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e2f94581aaf2413a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,362 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 w\275\001"
+	.string	"t\002k"
+	.string	"\004"
+	.string	"\334\200\361\203\n(\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\001\001\215\332\260\263\003\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"@\bp\017t\006\214\260\313j\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375  \275"
+	.string	""
+	.string	"h\024"
+	.string	"\001"
+	.string	"\001\001\002\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	")\202_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 =\305\001"
+	.string	"\364\0021"
+	.string	"\001"
+	.string	""
+	.string	"\034\200\200\200\240\002h\001"
+	.string	""
+	.string	"\002\031\200\200\200\220\003f"
+	.string	""
+	.string	"\360\002f\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N"
+	.string	""
+	.string	"\002"
+	.string	"YB\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 K\035\002"
+	.string	"\244\0035"
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\004\003'\001\206\by"
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	"\001\002\006w\001\001\006w\001\177\004\177"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\tAETR1234"
+	.string	"\002"
+	.string	"\340i\312"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_.pureconst.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 v}\002"
+	.string	"\022\304\r\030\300%\215\001\273\336d\372\357\377\337w\372\377\362\257\357\207W\222\275\244L)D9\271\246\214\3342(s\0050\n\005\334\341>>\356\235\311\025\324\216\235%e\222\332-\002\b"
+	.ascii	"\244`Ze.\316\213c\016\257r\241\246\225`\264\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.7eb9636187f6ea64,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.29.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 \227]\004"
+	.string	"\304\007j"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\377\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\307\006us\345\005uq"
+	.string	"\005\001\006'\0010\005\001\006\035\001'\001\230\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/pg/rx.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.30.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375`\264\002=\016"
+	.string	"\026\030[D\340\226*\035\004\341\373#M\314cC\337\322\230\371\261\020\347 \201@\030\236"
+	.string	"\222@0?\001"
+	.string	"c\237E\0306\331\324q\200Y\240v\305aJ\013\204\221CA\240\361H\347\214\330*\273\362\021\340D\006\t\332;\245B"
+	.string	"E"
+	.string	"N"
+	.string	"\317\361Zy[\353\005vi,-\273\347\0033"
+	.string	"\357\371\274\201\357\036\370\315w\317\245\355\244\003\023\340C\226\242\333\335\260\326xyZ\372\327\361\2149s\235\002\260\260\273\246\346,\306]o\273\201m\220]C\001,\256\362+\370\354\026\357A\232\302=\016\016\n\013|U\360w\270`Q\334\r\277\365\335\243+\267\031\265\334\213\356\354\323E+\r\373\230\335]W\232}\333O;\325\206L\205\263\333\205\261\213\2627\357\007\016\215\355S;7=au9Xu\205\376\002\342O\310\005\"\236\0130\342MH|I\211+I\271m\342I\276\023w!\t\360\020\035\311\3672\372\021\025\002\322\213lJ'\022\344\266\351Ch\212\003!\00709\275\005\224!\236Ec\344\236\317V\361\025\225]\002\006I\210"
+	.string	"\341C\210\f\0272%\023\n\224\210a5\202\036}VcXJ\205(\223\350\024\216FU\370\331XL\221\306p\205(\216\241\346\334c\266\322\254A\310\355U_8\001\245\365\347u\033\016\340vc79\2001\007\236{v\007\0174) "
+	.string	"\203\221\261`\007RC\353\312\300\006\241\f\f\256\340\316\225\025\\ \2120\024t\217\341\036\026\033\270J\002Yqa\0040{\201\324\2330$\270\023\006\363b\006\227E +.\214"
+	.string	"\027F\240/*\2560\b\203\211\313z\300<\017\313\\\346}"
+	.ascii	"\315:%\362\360\242\365d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 k%\003"
+	.string	"T\005g"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\036\177\007\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\035\b\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\032\t\201\204\001\033\n\001\037\177\013\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004\200\200\200\200\004\001\244\013"
+	.string	"\004"
+	.ascii	"F\020\002\2275\313`\f\201\202\002"
+	.text
+	.section	.gnu.lto_.refs.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7eb9636187f6ea64,"e",@progbits
+	.string	"(\265/\375`\210\022\215Z"
+	.ascii	"\312\234`\"S@\020+J\007\352Ru6\240\334\330\267\206\3114K\261"
+	.ascii	"\020?\035!5\343s\024\323\007\372\023w\211\357\250\220z\032\332"
+	.ascii	"%\212,=\032\224\275\"74p\243?\002\366\035TuP\345\023\003\300"
+	.ascii	"\240?\300\246eu\347\205\2230\017\017\302\2327\245m{\322\244L"
+	.ascii	"\001\313\001\035\002 \002\r\260\221e\263pV)\003\004Vt\300\254"
+	.ascii	"\266k\261B\310\272\221\210\035\273\221\337\033\376\275\372\031"
+	.ascii	"\210\301Fx\307b\325Z\331=\262\250P\220YQ\332\351\n\353F\2628"
+	.ascii	"b![AI\324\027\005\346gX\252\254\227\004\355\205\224z\016.V\007"
+	.ascii	"]\242\006e\f\b\0366w\314v\356\177\255\254\325\b\032\224\024\262"
+	.ascii	"\265\004\360B\246\213\315\332\354X?CR?\373Q?\013\326\233\312"
+	.ascii	"\032f\252\340\365\202\0236o\232\2517\257\324\2333\324\233Q\365"
+	.ascii	"\346\260^\346\247^V\247^\006\247^\366U/#S/\323R/\233\241^F\244"
+	.ascii	"^&\254\3478\365\354U\213v\004m\333\254\233M\252\3307\3375\253"
+	.ascii	"\374L\210l$3\001\264\005\2071\365\253\202&\033\033[\025\264\263"
+	.ascii	"Ve\236R\213\330X\217\320l\232M\036\255\016M\264k\234\200L\261"
+	.ascii	"y>RM\350\261=\242\235\203\324\024\200\352\212eS_l\262\316\330"
+	.ascii	"&\365\233B\275V\b\365\\\034\324\233\261Q\257\224Q\277\\\022\264"
+	.ascii	"\305\262Y6\211b\265\234\201\030\227\005\263\264U7\222h(\020\225"
+	.ascii	"@bl\276E\375\342\360\021\306\216q\021\365\213\202\266c\213\202"
+	.ascii	"v\256\007[\022\264\024aK\202v\344\222\240\325\035A\373W\004\020"
+	.ascii	"\377\022\360\257\320\277%\376=\361\257\001\377\036\360\357\212"
+	.ascii	"\177k\377\006\375\253\342_\004\376\035\372w\200\177C\374\213"
+	.ascii	"\342_#\022\377\212\370\257\005\305\317%\374\233\364\257\322\277"
+	.ascii	"\037\374\313\373\367\374w\367\257\007\377\366\366\306\2778\376"
+	.ascii	"\315-\t\377\213~V\363\357\b\377\246\377\202\360\257\357\337\007"
+	.ascii	"\376\277\371\227\305\2771\376\205\361\357\002\377*\360o\002\377"
+	.ascii	"\205\376\247\371/\033\033\033\033\373\367\277\251\300\037\302"
+	.ascii	"\202F\304dG\365\2165Q\333Hc\260\207\3056\352a\013S\020\207\306"
+	.ascii	"(bR\030eDL\032\243:i\354\242\036\n\241|\f\033\312\250\223\306"
+	.ascii	";\235,F\025\021\223\305(b\3228\265?\210x\252D\2659Rim\2208l "
+	.ascii	"OSB\250\"%\021Y\354e\367j\361h\250\002\272\247\212PKa\221\345"
+	.ascii	"rR\002"
+	.string	"q\352\",.\262\273M<9Q\025{\250$V\025\273\253\234\222\372\tF\020\251l%\253\f&\231\352\037<\272\001x\352\016n+\273;\330\3355\250)d\267\221\"\342\361\351\251[\352\350\251\247\202]<\272YK\016W\0241IU\264ua%\217\335\003\031\334c/\215P5\031\304\322?\272{\363\324c\324\020<R8\312\f\013\221\017\0276\317Q~>.\030\256\352\240{(\264\204\310\0205lr\r\f\345\\\305O\270\nF\261[\310UD=t\013\211v\t\330%\300\254BE\003\027\232\371\231X\375`\305v\246\201\210\r\230=N\234\250\250C1[V3\240 B\252\360\224\204\315\237\2330\221\021\177\024\221F\265\251-#\026\233K\216j\3057n\226l~\006V\277\312\035\352,\345\3049.\351\250)\223C\330\361\212\253\207\343\0302~lz\300\034\263\264\026K\206<\326\262\250|\200\2319\263^Sx"
+	.string	"\263\262\343u\f#\346\217\031\2604`^\276"
+	.string	"Z\316Yz\371mb\\~\346\301(\260\221\237X\212Y\340\027\270\007\267\300I\030\006v\201O`%L\344\037,\003Oq\f\f\204\213\034\204\221\260\020^\201U`*\036\302Q\f\305E\370\b\247\300>\230\310&\331\b\013\317N<<#\273\2071\360,\326\231\255.\213\025h\267~\333\237\365\263u\\\3461s\264\261\221\r\304\301$W\216\335\375\005\323\303\226+{\026\353\213\362\016\032\260\254\337\306\307\213\255\317\372\3512\206\007\035\300\324\371\332\302el\031g\316\025\344b\205\b\026\265\023\233\023\216_j\354\034m\200\026k\225R\016T\321\nO-4\021\302~\302\254\244"
+	.ascii	"C\023$\321\207.\261(D\370\334\211\316\223\r\314\247\n\b\247\257"
+	.ascii	"?Sl\276\372\310\223\207\231PP\324M\345\204\317\024\211,\305\356"
+	.ascii	"|\223|\207\231\230F\335\302?\\\r%\225@\245\3634\344\311\234\372"
+	.ascii	"\245\262\214<\177\331$#\231\007\031Q\252\2054\240\204\013j*\201"
+	.ascii	"\031\224\252~\303\246\035\244\020\316\2333_\365k\325\305b\256"
+	.ascii	"\350,\307\3141\303h\244\250\001#\303a\254\344\300a\035\270\315"
+	.ascii	"*\245\212z\370%\fL\t\207sX\254e\034\256\303tX\016\277\341%\317"
+	.ascii	"\331$\303\3414g0\314\365#\033\034.\023\207H\217\225\254\"Ef\327"
+	.ascii	"\353\234p\"Rpe\007\214\r\273\331$\267\371\021\262\r{\361\232"
+	.ascii	"UJ![H\220\027\260@U&X\f\341i\263<B[\263C\210.\310\030\362\260"
+	.ascii	"\311\312\232T\2214;\256\2766\311j\352\236)]b\257\023\224\303"
+	.ascii	"\022*+\365\265(\3655\031*\237\251n\300X\3702\326\327\220\324"
+	.ascii	"\327\212\324\327\204\324\327N\250\257\355\020\023&\211F\317W"
+	.ascii	"\030f\343\365\303\211\315\327\202\225Wp\341.\354\345\377@T\205"
+	.ascii	"\013\206-?\365\274\205\301\0225[l\232{24\326:o\371?p\032\032"
+	.ascii	"\216Oz\352\031\213\263\376\017!\226N\266`\241S\317Zf[czV`\223"
+	.ascii	"\223\225\007\355K\005\b\026\276\264p\204\315s\362g\0346K\204"
+	.ascii	"1@}\330\034\332\0214\306b;g\t\372*\003v\205M!Z\227z\266\201\247"
+	.ascii	"\234\251\234\n_Ud\007\331-\312<`a-%\265\242\016\361\263\334r"
+	.ascii	"\303\371\352v\204\372\304\007)QG\"\233\337\303V\377?"
+	.string	"\324n\310\252b\264\262\"\223j\303U\303\022\363H\306\006/6\223\\\205\205B\305\245\036\332\013\225\177Z\013\241\272[\310\f\331PNB\264\235\355\320\312\266\200\356\377\004\007\335A7G=\025\n\030\341\221\247\350\317\224\335Cc\020\002c\324\320X\204\2304vp\350$h\004\325\306 1\331m\324\303a\320F\261\003Oj\321\204\272hBs7\316\024\305\375\210t\374|5\206\226N`\252#\203\033\021\360I-v\277\\\217)\250\207\304\263\364&\004\274\365v\277Yo\367\223%\001w\275S\211v\212\300K\3154=Q\235\016W\323\361\363\345L\024\370\223\351\316\336\216\247\204\253\351\316\224\311\314\235i\355\350m\367k1\244\003\005\246\274\335y\303\350\271[O\202\033\273\237\210\347x\350\331;w\3650d, cFS\3553h\274\240\361\202\366\0314l6\0322l\3652l2\024\227\2243\201O\032q\337\357D]"
+	.string	"}>\324EP\312\204#\r\221\336v<\244\236\257F\023\n\342\207[\312\2413\364\324\361r\370\320\237\356lB\225p<\364L\215\232N\245\037\223\r$%\\\022\210S\307C\3213\207\357\326\343\245"
+	.string	"\336j;\234\006>\336m\307\244\364;2\002\236\351\211\352z<\0347 .\275-1\241\300\017\316_\032\200\320\251\204\313\201"
+	.ascii	"\242g\216\036/\207\352xK\263\036o\251~\220;\223rM\270\245J\224"
+	.ascii	"\326P\302\345\350\371x@\234\222\357\207\236\300^\0059\264Dz\236"
+	.ascii	"\350\356\264q*\355z\021,\341j\344\370!\211\320)\371\222\322\023"
+	.ascii	"M\322\340\004\346\"8u\276\013P\036\356\250\307\003\336d\330j"
+	.ascii	"\356L\231nMh"
+	.ascii	"\220\322\331\353\341\222r\267&&\334\255\t\267D\224\242>\024="
+	.ascii	"I\320\200g\212\204\344\01322\201\204\344\0032\345\004HyM\270"
+	.ascii	"\333\216\t\307\251\0032\375z\274\022\347O\007\360v\346\340\001"
+	.ascii	"q9x\350\251;\201\372\2009\034\322\315\007d\302\335v=^\022\320"
+	.ascii	"\347[Jo9\364H\347\343\241\347\357\206\364S\272\235K8\024\351"
+	.ascii	"\226C\323\033/MQ\023:\336\r\310\3531\r\001o3\200=\036S\3556["
+	.ascii	"\215\024\033`0A\315\265hB]\354~.z<\334\222\213\034\232\272h!"
+	.ascii	"\002\230\342\220n:&\034\216\033\003JMhJ\024H,\316\225\261>\200"
+	.ascii	"\256\220\f\247\354\331\303b\233\245\203\034y=1\342\t\353\226"
+	.ascii	"Z1T\206J\217'\177\316b\034V\274\262\204M\356\303~\002\201]\250"
+	.ascii	"qD\306\024##\"#\"2\222$\351Q\005\3040\350 +\036\022\200T1\230"
+	.ascii	"9\310\206f\232,\373\377\006\022\017\340\212\304>0\364\333\331"
+	.ascii	"\271FV\\\305\231Yd~\354f\313`T\232\337@\0343\346\013z\002'\037"
+	.ascii	"\340\365]\027\257\231\270i\260\223\254\240cZ\021\253\243\210"
+	.ascii	"\202\312\213\266\273\246\341\2763\332\205\315$\216e\257\326\312"
+	.ascii	"\303\243#\245\267m\373\261\232\333K\n\370\277\267\230F\037R\340"
+	.ascii	"F\203bx\215\357lN\003\276;\246\332\032+\341\031j\\@\303\3660"
+	.ascii	"\200\022i\271T\353R~\346\237V=p\004\210\205\273|\375\025H\007"
+	.ascii	"0\334\350\001Q\221\221\246\006+-\306\034\354\325\360\034\206"
+	.ascii	"j\035\341\331 \265I\204\353\037B\240\006\256\237\024\f2\034\036"
+	.ascii	"}\250\263\243\020\005\027i\r\2434\334\022\327t\212L\260/\234"
+	.ascii	"\305\272\265\021\245\t\333C\207\320\204\251xz\264\361'\231F\347"
+	.ascii	"<2P\250\022\026C\273\343\345\253\333{p\311\225\272b\326\317C"
+	.ascii	"=\200N7\007\203\353\216g\002\275:\0040\311;\316\261<8} \216\231"
+	.ascii	"\271\274\233Y\350\004T\306\020FI\353\257\f\350\250\377\271t\024"
+	.ascii	"f\305s\016LT\026\325\251\020S34X\231\36045\314@\253\r{\3716\360"
+	.ascii	"\205\027\271\262\311(\020\263D:\323\235$\r\204U\350\266w[\007"
+	.ascii	"\001\261\225`\024`a\346\263@\026\260r?\256+*0\020\334\211I\032"
+	.ascii	"\325%\261\216\017}\214\224$O9\323i<@\207\215\323\n\367\360W\247"
+	.ascii	"`H\372X\327@\374\347\354jI\246\255\252\277>\2349\254S\327\225"
+	.ascii	" \216Y\021\330@rl\204X\242\244\2149Sy>\342S\213at\275\367'\360"
+	.ascii	"5@\021\314u\030n\246\274\320\026\002$\277\023WV\216^\244\274"
+	.ascii	"t\002\251\271\006\331vO\301\232*\304\343\217\035\327\252\"\244"
+	.ascii	"\252\244\357f\231\300\256dz\207\332K\013\234r6B\322>2]\370\313"
+	.ascii	"Q6\021\226h-\373\325\225\f\226\351\274\303p\211\f\nKnf\325%o"
+	.ascii	"\373\035\300\217\241N\t\"\031\334\335\007\307\246\353\364K\023"
+	.ascii	"\3753\247\251\240_\032r\237\2120\310\342\344\001\210\340arQ\216"
+	.ascii	"c}\322p\f\216\313\203\275s\324A\300\201,;\212\311|]M\370\313"
+	.ascii	"n\322r\362v7pK\035\336\035x\033\330\017\025\202\273\034\b\337"
+	.ascii	"5\371\326/\236\370\013Y\313gXCH5!C\021\271\207x\310\177Zk\311"
+	.ascii	"\006\377\256u\367\226k\201\"\030\303\316\201\251\357\336]\n\004"
+	.ascii	"k_\r\206\337\364\375\255=\021N\261\353\006\036<\335\032\032\245"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symtab.7eb9636187f6ea64,"e",@progbits
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"rxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7eb9636187f6ea64,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,282 @@
+	.file	"sdcard.c"
+	.section	.gnu.lto_.profile.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 ;\215\001"
+	.string	"\204\002/"
+	.string	"\004"
+	.string	"\262\313\333\366\n\n\002"
+	.string	"\002\001\002\002\001\002\003\002\001\001\353\253\315\356\b\002\240\342\234\212\n\003\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\273\2226\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 2m\001"
+	.string	"D\002&"
+	.string	"\001"
+	.string	""
+	.string	"\b\200\200\200\300\003e\001"
+	.string	""
+	.string	"\002\005\002d"
+	.string	""
+	.string	"\013\200\200\200\240\002e\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	".\241n\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 K\305\001"
+	.string	"t\002?"
+	.string	"\001"
+	.string	"\001\270\006"
+	.string	"\001\002\004"
+	.string	"\002"
+	.string	""
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\b\030"
+	.string	"\001"
+	.string	" \b\b\002\005"
+	.string	"\300"
+	.string	"  \003\030"
+	.string	""
+	.string	"\006"
+	.ascii	"73\200\274;\255 \312\032\260e\003X"
+	.text
+	.section	.gnu.lto_.lto.d7f85786e1c789b8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sdcardConfig_Registry.12.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 \232u\004"
+	.string	"\364\007i"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\334\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\364\006us\314\006uq"
+	.string	"\005\001\006'\001\f\005\001\006\035\001'\001\377#?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/pg/sdcard.c"
+	.string	"\004"
+	.ascii	"\236\n\013f\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_sdcardConfig.13.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"\005\n"
+	.string	"\226\022E= \345*\035\300\313\314B\034\262`t\006p\271s~\006\213<b\336\335\311\037\025\256?\006m\303,\317uD\017\206\252\305c\033\002H\311T\343\346tH\n\201\302V\332\025\304\217\374\275S\n1"
+	.string	"2"
+	.string	"5"
+	.string	"\367\\\276S\357}7\250\367L\3324\b\031\003+\256\033\200\335\005\351\307\311O\322?\311\005^0\326g\200\303\356z\276`\0347\275\355\004\333\036\373\020\001\255\271\263K\326\244\036\3667\273\273\2462\373\266\177~\264\303\205\353\340v7v\272\205\361Zh\034\333\237\366k\037!o[\275`W\366\302\262[2X\341\013\263XM\254v\351)\342\214\321\375\344\366\304Q<\264T\265Q\277\245\036@D\256\252v\305MT\337\3566\370%\026\027\0043\273\373\331=\177U\357Q\027\231X\255&\242\221\204I\f\253\303Oh\004\205!\024(:\201\246\021\250\004\206#\n\374\034X<E\214 \205(\216 \247\334o\226\312\274\t\311\005\310\265(\206\351I\325\036]\205\264\240\021\020"
+	.ascii	"2\241\211/0\\\300\224J\0322\356D\032y\3108\240\030\274\034\251"
+	.ascii	"4\016\325(\006C.\3016\253)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\r\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005\f\007\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\b\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\n\t\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\003\001\002\002\002\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d7f85786e1c789b8,"e",@progbits
+	.string	"(\265/\375`\025\013\255>"
+	.string	"*s\b\031CP\246U\007\372\016\264\372\316\313\354\375\306o\274\336\331\335\326\177f\241q\217a\377\247%\353&\350\211\002\"H3`\262\371\016*`\344\034$\340\224@"
+	.ascii	"\021\361q5\256]z)\007\262\b8\345;\333\312\224\002[\001x\001\204"
+	.ascii	"\001\353\373\237,K\343h\266\234\231F\251q7\036mr\31026\375\377"
+	.ascii	"v\2612NF\300\355\277+\016\330\377\333\030\272w\335\027\242\\"
+	.ascii	"\315\3378\031\004\310\377\256!\003\302Pu\2501\364\377\352\236"
+	.ascii	"\236\236\236\216\326\024\3359\033\260:Z"
+	.string	"\222 @\204\220_\331\315\234\216C\375\254\333\275\370\227^\3038\377\371\377\342n\307\037geN\254\222;\261\355]\271\243\336\304&\371\216\334\356f_\343l\034\252\3636\257\344i\310,.\274\266\033s\215\257\272\216m\032\271]\344\034\331\372\343\354\b\024\274\266/\267\212\254\363&\266=\344\216\312N\336\304z\030\027\343\320\004>\246/D\365\315\030\346\303\376_%\034U\0135\021^\233Bn\1776\323\361\243\032\227\333\023\260^\365\004l\343l\301\233\330\005\336\304\256\336\245\333\271xX\202\233\213\345|\261\377wI\351\375\2414\202\327~\275\211\315\316\304vw\036;\335\335\246\273\353t\267Zw\217\351\356\264\356&K\352\366>\335\376\324\355\025\272\235B\267K\350v\b\335\036\241\333't\273\005W\352v\007\335\376\300\245\272;\327\215{\335\036\325\355\030\272}\327\335m\335\215\326\335{\272\333Ow\367\351n>\335\035\326\335"
+	.ascii	"\272\333\254\273o\325j\265\332\335U\2721\256\033\351C\353\033"
+	.ascii	"8i\307\265AHW>\264\224\355\301T59G\274B]\220\303IZk\343\"\303"
+	.ascii	"kc77\356f\377\270\374\177-\243\367\227\310\244v#w\247n\234\337"
+	.ascii	"\274Aw\257\377"
+	.string	"\n\024\375\023\tc\313T\312\216[x\355\356\005\337\335\355Y\376\215K\377\376\322}z\031]h\032s\351\375\"\005\376i\344\335\327\213\271:\037\377\373\376I/\346\013\367u.\335\327i\314}\322i\374\177\2319W\354ht\367\351\305t\237N\346\322'\337\370\317c\221\234t2]:Nf\316}\036\231n\322\213\271\324\025\226D\212c--\314\245\270\311\317Rr\035\227\271\250\373:_\372\357bW\277l\360\317\345\\J\217@<\r2\232\205<st\372\373\377\006\224\310/\347'\243n\025\347\177\025$\325+3\030\337\350/\361\250\321\b\327c]\375\037\370\367_\371o\364\217\376\277\361\377\217\226\\\357\277\220\234\013\246T\3767u\312\3472\252\271\372\307b|\3220\335\347\227s\247f\314\023\354o\274F\007{\251\3272?\215`\036\353\377}-\2031y\f\372sf$f\316\226\243\037\035\256\217\24234\274:\237"
+	.ascii	"_a\214@\360\272G\207\264\305\346\307K\233\334>v\206l\032\326"
+	.ascii	"\275s5\237\343u<*\366\241\215\331\364\005#\307\277\230A\243\307"
+	.ascii	"\363\270\035\307\343R\277\343i\036u\250\2539\234\3668.\247\003"
+	.ascii	"P\260\023\254\0043\301O\034\212\227\340"
+	.string	"!\215s`\035\255\373\202\227\340\036\270\351Q%\035\302\366L\225\330\270\220\001\222[\263\372\017\002\244+\302\013\240)>\202\2238\024#i\335\373/\206\241{\207\004\023\301F<\332|_kE\240\256.\003O\270Aj\322-\326\310\227\2003o\2225\274b\257\243&\0203\033\\\234\016\305Er[\0265\211\372Ow#\005\200\303\344+K\356\333\224\334\267#[\031\317t\b\032\221\334\267\255\334\267\036\031\373\300?\034\n\001\003i\314\303\313\332\350\370\376\213\233,*#\006\257}\323\221\333!\260\267j\325!\260}\273\312\030Ss\343C\271\033/\361\216\347\03464\274\203\f\276s\206\205l\3139gb\02789\023\213m\340\033\330\355FR\332\222\006\311\330\237\334\370\252\004\223:cx]\275\335\260\030\3318\331\215\204\315\242\200)\245\271\261\021\037\273\221\004H\241\224\001\023\315\215\337h\254\312\026\004\257^\315Wx\r\004"
+	.ascii	"C\320\020\361j\267\037rDNeQ\200FuQ!\274\272\"_\324N\365DN\315"
+	.ascii	"\340\374?:UI\321\377Q\311\235\201;\203u\313W\0243\354\332\230"
+	.ascii	",\267\324\233X\2343\261\036g\327n\210\211]6\337\027\013\200\366"
+	.ascii	"f\372\005Kn\007\344\201\332\247=\3656o\376\315O\231\026\325\320"
+	.ascii	"7\233Nxm\013\255\b[{[\003Jz\004\267'6\250\\\360\332m\276\326"
+	.ascii	"\335H\0013\204V\036\226\252\332\"q\306\211)\246bSU\370\t\231"
+	.ascii	"zA\030\001\202-\360\320\2108\225T\234\n\376\204F\301\237\360"
+	.ascii	"FU"
+	.string	"\374\005[\027lqJj\227[\032@\342J$\266C\237\217w4Ch\325[\207E\341\315\327\006\177@\027\274#_K\204\261\006\255\200\305^K<\352\341\324OX\0017\344Q\365\326\031\303\"\021\370kM4uo*\b\242\330\022[\023?!\201\356\001\207m\260\375\345\316 EAJ\203\214\243\326\260\301\302\006\013lk\330\260\333m\220\332\345\226\332\335\212MU\240\255\204\355\020\252he5\204\n\320N\265>+\022I\255\317\252j%N\375\200-\202V\036\004\360\252>\264D\030,\333\366\2001Z\037\373\343\241\300\025\247~<\024V\300\243\037\017E\261\327\272hO\b\201T=\234\257-\016\333\030\301\021\305^[l?\f\030\266\300\026\300b\260\365\215\340U\371p\305)\r\305 \020\306Q\357v\036\026\244(\021\"\367*\370\206\274\236\217\b\365\023B\005\201\274*\250\336\220\bU\201\200\2136\030\344Qy\340U\371"
+	.string	"`\361\266\365\n\"\255#\266be\016\326\032e\017ET\332\241\230\212\363\321\345\376\277\262\322\374\262)\301\350\373\220%\221\346v-\356\205\032\343p\250\027\302Rt`^\243"
+	.ascii	"-\262%\227\204\233\222-R\306\360\n\366&\217\216z\362\3101\313"
+	.ascii	"\355aYx\351\305\217\222\331G\b\346\272RG\013\357\b\343\203\261"
+	.ascii	"\226\340.\214\304\243\315\334'\321\030\232\342%8\210\223\221"
+	.ascii	"6\301Qp\200\270\250\2018\206\2203FdFDdF\232\244\003p\002\021"
+	.ascii	"\262*\356\021\240\245c\204L\333\324i\f\3479\331%rdX)U\233\370"
+	.ascii	"\225@\246\003@\032\3320\354/\340S4\346\225\020\301\273\"\367"
+	.ascii	"Q\331^\272s\277!\303\352\364\262A\tIr\363\033\fm\240\372\033"
+	.ascii	"@ac\022]^\340::+\342\212>\201\301\343\bL\0057\362\177\033\346"
+	.ascii	"\313Wd9`\353\302nr:,\3121\353\017(\020o\335\264\347/\300q\247"
+	.ascii	"\330m\357@\316#\272N\0160'\302.\030\034P\356\255\223\271\r\313"
+	.ascii	"I\312\304\361\347R\267\242(`f{\363_\201\016\021\037\265$\221"
+	.ascii	"\020\005\0175\3121\210\001 \344RJ\231\255\323I\364\244\307\253"
+	.ascii	"\353\205\374\267\211\240\370ov5U\231B\200*\250\354\344\233\031"
+	.ascii	"g\226\361\022\240Y\260\360\274\254\210N\312\372\343\016\313\b"
+	.ascii	"6\243\177\202\177\031\211{=$7\210=\205\201\275\303@\002\3626"
+	.ascii	"\263\377N~\226D\327\013\256i\374\n\322\325I\2060G\267K\250\211"
+	.ascii	"\331\235\034\223\034\245|8\036\224@\252\226\226Z\313\235}\255"
+	.ascii	"j\215v\023\177\360\030\346\177\030\210}F\220\035\212^\207\250"
+	.ascii	"U\r\212d\206\374MJvy\360m|\244\307\306\326C\214\367\356\013 "
+	.ascii	"ic\237v&K\333\177\332\313\217\237?\002\352\204D\302MO\201OV\021"
+	.ascii	"\032\363\212\260\330 @>\305R\241\334\256\210\376\221\210\366"
+	.ascii	"\330\315"
+	.string	"\353\335Y\035\r\037\373\314v"
+	.ascii	"#\235gL\025"
+	.text
+	.section	.gnu.lto_.symtab.d7f85786e1c789b8,"e",@progbits
+	.string	"pgResetFn_sdcardConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"sdcardConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"sdcardConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"sdcardConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d7f85786e1c789b8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,183 @@
+	.file	"vcd.c"
+	.section	.gnu.lto_.profile.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375  \345"
+	.string	""
+	.string	"\260\024"
+	.string	"\003"
+	.string	"\371\361\340\313\r\001\240\342\234\212\n\002\240\342\234\212\n"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.9705be63ead7d89f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.12.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \211\005\004"
+	.string	"$\007["
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\236\332\013yw\250\306\005yu"
+	.string	"\005\001\006'\001\003\005\001\006\035\001\001\202\0048sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/pg/vcd.c"
+	.string	"\004"
+	.string	"A\b\354\345\206g\222<"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\f"
+	.string	"\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\t\001\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\n\002\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\002\002"
+	.text
+	.section	.gnu.lto_.decls.9705be63ead7d89f,"e",@progbits
+	.string	"(\265/\375`/\006\005&"
+	.string	"JF0\017D\200\252Mc3\255\255x{{f\302\376\332-\035\307\307h\3742\037\201\374\013\276GO\325\230\241\236/v\r\004\327H\304\266\306 \370U\f\227\223\022\313O\213\364\203-(QY\016\371!o\032\231\035\273\311\224\002\305"
+	.string	"\341"
+	.string	"\347"
+	.string	"C\265x\004\tV%\235\263>\226g\261\207\216\312\214d\221RI7\260\376\025\333CA`G\264\034\225\274\025\273\342\200\022"
+	.string	"\036]z\350\250\244o\305~z)\377\"q\257\325\275\267"
+	.string	"\212#\240=\225<\225W\361\277>\305\017$\270F5\345v\335{\377\025a\353\336\341\277l\177\356\035\332\376\005\377\002\362\211\217#ZJ\322\004\254\313\236T\032\375V\276+\347G\261\017\345^\267r\206Vz\261\334{mDbd\316\242T\322\351\223J\373[Y\364[\351jm\363\261\r\310\366\037\333}l\353\261m\264\355\307\3661\311v\230\3554\333h\266\217\354z\373\003\354\013\260o\3335\333E\333\365x<\036m\207\260o\302\016\022\021\304\247\031\227^C\260si7{\236Z\232\344\336\037F\016\260\251\002V4\336\233.\031X2\302\323\246LG\231\007\317\321\2264H\236J\376\216\220\026\216\242\212!vN\374\231\315\212\356E`\323\232\200Is\035\2422D|"
+	.string	"\261\376\226\365k\310\261n\316x\034\313\372W\326\037\332\267\271\233\023\225\376\306_s2\007\r\323\233\326\"\200\262P\251\244\247\254\257T\326\216\307+\225F-\322\223\312\232T:\312\272g\355\247\t\013\252\202\006M,\354\305Z\013\030[i\200\312&\r\214\252J\336\314\317\234\230\340hR\233Q '\201\374T\322:\353'(\177|\202\322#,\322o\245\202\337J_\214KL\271\022l\301V\006[\336\345^\354!\333\223/@\300*\351\t\326\347\302\201\210\032\260J\222\367\230\362Z|0;d0\352U\223-g.\264H\250XUE\275:\242J\257\f\n`5\214\306{\357\214\032\243\3128\261b\325\027\256U\325\312O\357\265eXE4K\272.\261\256@\254k\016[WT\026'\342j\213\223U\305\330QI\327,\233\342\036\217+]\257,\356Ie\355{\254\357\344\347\362\277\234x\256zqRR*"
+	.string	"YPd\3300\336\031;\034\020\205\221)\341\252\3441\265\272\367\342\204\206p\336\234\031c}\2572O\343E\207\214\330\2348\237\303D\315\275\354\234\232\207u\311\371\030\343\353<\355cZH\327\252\213\361\214\314\316\335\370\262\027?\246U\341IY\237\007:\240\373\371\236\363\371\237\023o<\035\037\314\303X}\354\306\2639\234\217\t\271\320\025g\t\267dC\343\272\202\003\211,\343:\b\252Zl\3602;\2737E\273\236\007SA \006\033Zd(){\026\235:\240\311\363I\025\225\250y>=\001uP\326\204\211\236S\037\002x"
+	.string	"j(\246^\320\300\240)lB\201@a\023\321\356w\"\003j\236D\277\247\212\232\247)\f:u\275`\021\252\373\365\202A\277^\260\006\205\366~fT\211\352&\344\254\211\302w\222\347i\ny<'\241\251 pG\242:\n\350\317wBH\210\006k\316\3450("
+	.ascii	"\301A\203\3351\361vRM\275`\323\317\347d\242"
+	.string	"i'<\233\230n<\363\327\363E9\t\361\314\363\004\371\003\372\320\235y\nY\250\353\005\231\214\204NP;rJ\210\236\276\236\351AgF\371\236\200\302\016\274\235\324\355F\315\252\30523\025\225\264\253\r\0335\313\265{\207b_\276eF\307\0161k\327\241O\254\303\232\365\364RU\320rp\204U\204\217\236J\322\300\331\232\274\210a\004\214\365\003i\250\201,\306\fSFD\206F\002\031\205Q\241\003P\002!c\354l\003\021\260\251r\306h\322Lk\333\310\364\322A\321\336$E\006\372\270\032!\360\256O\244!\246\\dR\r\374\311\312c\021Q\251U\352\252\215Cs\346\002udz/W(\025)~.\3010R\355\210\247\201\342:\252\r-\026\310R\037\001\256N\244]s\226&\022)C\263\343\f%\320A\032b@\302\325O\324j\245\271E\232x\237\026\n;\013\200\341\020\272\367=0c\300\376\033\246\b~"
+	.ascii	"\366\234b\030\001P\007\214\207\253\2038\242\275\220a[\377\n\277"
+	.ascii	"\303\0049\321-\220$\216\\mA\033 g4s\244\224?'\n/\353D\354\341"
+	.ascii	"\013\207G\201Im\224\305\341\274\335\004/\346Fd\242@i\255\276"
+	.ascii	"\fX1d\036\326\202\334\0036\032\331\240\221\226\314\352\350[O"
+	.ascii	"\333\352\307\325\037"
+	.text
+	.section	.gnu.lto_.symtab.9705be63ead7d89f,"e",@progbits
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"vcdProfile_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9705be63ead7d89f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
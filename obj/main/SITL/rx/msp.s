@@ -0,0 +1,266 @@
+	.file	"msp.c"
+	.section	.gnu.lto_.profile.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 b\275\002"
+	.string	"\304\004V"
+	.string	"\006"
+	.string	"\332\205\333\362\001\002\002"
+	.string	"\002\001\001\240\342\234\212\n\002\237\275\226\271\002\004\002\003\352\263\360\321\b\004\376\314\317\334\f\b\002\003\002\003\002"
+	.string	"\002\001\002\002\002\005\277\257\241\307\t\b\002\004\002\005\002"
+	.string	"\002\005\002\006\002\005\002\007\002\005"
+	.string	"\003"
+	.ascii	"w\202\t\362\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 6\025\001"
+	.string	"\230*"
+	.string	"\004"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\003\002\001\003\004\002\001\005\001"
+	.string	"\005"
+	.string	"@\025\034\024\r\227\0303\203\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 \306\305\003"
+	.string	"\202\306\024\036\240'\351\317\371\244\300\263\370\027w-\276\273Q<\033\002\377\377\367A\341\377\023\261do\271S\377\367\256\n^\025\373\266\356l>\215\307%\013\242\020\372\007\216S,\2102\030\177u\213Dr@\275a`\024\316\305{\025\340S\357G5\263m53\323<\216\b\016"
+	.ascii	"7C\2030.AW\304\322p5\220\224\013\030\215\352$V\261^\005v\223"
+	.ascii	"\036\313e5[\203\001\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 6}\001"
+	.string	"d\002*"
+	.string	"\004"
+	.string	"\002\001\001\f"
+	.string	"\002\n\177\002\b\002\001\001"
+	.string	""
+	.string	"\002\005\004\002\001\001\017\177\002\003\177\002\t\005\013\177\002\005"
+	.string	"\002"
+	.ascii	"\0035\334\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\004\231\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 \274e\003"
+	.string	"\342\004\017\030\2405\351\017.\357\274\252:\352\377\377\377\337P\3646#t\315\332\266R\246\317\303SupH\277\217\307jv`\262\352\233\344\323\307\322\n\233\001\220\224\246Qv\232\362\242\374\211k\247\225\023"
+	.ascii	"H\t\300TN\213\035h\f\246D\227\223\255\262\377\312\202RV\251*"
+	.ascii	"\361\025\201T\001vs\201\272\252\205og\314f;`Y\030\264\001"
+	.text
+	.section	.gnu.lto_.lto.3ab70a235a1579c6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxMspReadRawRC.20.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"}\t"
+	.string	"\346\022C90\305*\035\210\343\302@\364dy\346"
+	.string	"\253VJ\ro\354\326\020\016\240E\371cd\221\241\256[R\016\230S\260c\004~0Q\213\346h\022`\343\301\305 \301]\355\336[\246\0242"
+	.string	"3"
+	.string	"."
+	.string	"\357\350\354\351\347\252\330\210\250`\263\335oZ~\231\\\352\013&\227\020\343\336\325\363\017r\f\214d\305:]\003\032v\327\272bY\334\360\2661\266\027l\323\002\227\330.E-\300\226H\231\206\355\316\256\330\216jk\024\272\277\"n\331\024"
+	.string	"\227F\325\276\307?\272\177\022'\330m\315Fv\277\004#P.\375Ql\373\034\001\224\335e\360a\017\201\3603.M*\351W\227~ir\031\241\200L\341\341U4\224\326\354\357\244\360\302~\\\330\262\255\216\177\375\032\325\227\225\215!\316C'z8\016\347\340\001}\270Pic\332\006\334\311\214H\240i\332f\350\303\001\315\316F\232\031\003\213F\236mr\"\3216+\337>.l\031\036\240`\312\266'\036\363\002\f"
+	.ascii	"<\241\005(\306\013/J\020\224k\370p\026/\307\204\006s\005*\034"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_rxMspFrameReceive.21.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375`\250\002}\024"
+	.string	"\246\246\204H\320\356*\035Z!A:\0327\324\003\207\n1\231Af\343\230j\215g\321D7R\254M\256\222\374\207Uc\356\033MpT\236\357\306\233\255\313+\270\302\013\256e\207\234i\340E\337`t\301\303\037/\235\321\b\"\233\310\235Rq"
+	.string	"l"
+	.string	"l"
+	.string	"\273\267\237\240\335\035\211\007\214\237\336=D\374\034\017@\3744\314f!`\246a\364\322C\332]\224V\020\375\361pw\207\n{I\234c\250\022\346\363\356\241sy\211\303\366\3423\223\242\tg\346s\234\371\030\226f1\031\256B\002\205\320$\t(\364\236K\030\233L\20682\327\367<DGV\364c\223\271,!\330]\313\232m\302\235q\3339\266\017\330\222Czc\357\\\244\211\205$\240\365fw\\\367sl\234\3477\335w\213\357\3353\224\016/\255*-U\372\036\020^|\001\200vc\20206\305\024\322p\337\337\363\021\311\330\265i\261\341 \374\236\236\207\302\365Q\220\373\001ww\344\323\006\306Oy\262-w\377"
+	.ascii	";\217\207\234\261k\203\"hwIL`\374\024\t/\355\347\276\003\273"
+	.ascii	"\256\345\036\001\037\365\346SM;T\177r\344Sal\333\244S\257\343"
+	.ascii	"\235\210 \223\036\356\356\206.\360\251\035z\242\021\321jB\265"
+	.ascii	"\275r\240\027\210\321\356\232\370\">\202\345\343>\375\300%_s"
+	.ascii	"\211\237rE\315EL\006\355\207`y\2158\277E\017C\023S\016U=\255"
+	.ascii	"\203\274M\210W\251\247\345\310"
+	.string	"d\320S\2579\035^\221/FL\006U}D3\233\006\251\257\254^\254\004\016RV\253\023\006(\032)\252\223\326\202i\224\022\025\227\n\305\322B\255R'*\024J\313\205*\0011K%\245\205Za\261Z\250\323n\2577\243v/\2001\225\371O\211~\211\023\245|\234\033\250T\342\347y\227\270\035\244\243\230\f\226\364\306'\232\271\241\372\033M*~\334C\242\250\362\002\357'\212\272\241\247\231 \255F\366\022m\267.D\002C\316\303\321\324\033\0075 \220\002\23122\017\242\300\002\217\360\250\035\007\230U\245\255n\025\0016;\242\360D\265\032;\346\001\022\253%,q\342t\240\334\313\212\346-A\233=F\322\002\202X\016\231i\250q\323\306xi\b\264\204vk9,Q\252\006t\203\341\202v\022 \221P\205\0330\2406~:l\320\204\300\262\245\005\327\223\200y\341\306\204$\224\215V\233\341u\260\241\321\364\004x"
+	.ascii	"P6]\364\t"
+	.text
+	.section	.gnu.lto_rxMspFrameStatus.22.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\005\013"
+	.string	"F\325M? O\225\016\303\322@R\240&\003\340\207K\024\211,\304f\004"
+	.string	"'X\241\226\374\024\307\270\206\276\272YL\371^N2\370\242\234_ m\t\004\320*H\213\305\353"
+	.string	"\215T\n@\350\223M\244L)<"
+	.string	"8"
+	.string	";"
+	.string	"\366\016\302T\017b\240:\\\354\202\233r\270\367L\323\363I\317\032\260\302\324\267\272f\bZ'V\222\317\224M>6\254x\354i\341;eB*\273\353L}\027\356x\333\016l+\260\177 NM_S\026\312\243@\270\253\na,\212h\302\203\355\333\036\331\022\333\231\366C<ct\215\t\027\260\353RAb\027L`\003\221G\203\237h\217\221\017\320\036m{\001\203Q\231\2768\336\0217<@\260\310\022->4\250E\332U\002G\212S\276\260\277q\021\"\277\203?\240|\352\321\007i\217\327\307\236\030*\300Z\031\254R\2066HJ}\331\317vw\255\256\230\316\322E\300h2\335\346\003!\304\005\360\205\322\361h\266\020\267m2\026\315v\341<\033\205\2009\035\f\267u\034\016\267I\300\275\272\f1\251P#\364\367\264\307\016 \303\007\215\364=-\225\202\272RRS\016"
+	.string	"o\b8\252\343,\026\n\035vHe\b,\266\025\177@\020\211\020\265\206"
+	.ascii	"\271\214\276I\005#U94\227\332\003"
+	.text
+	.section	.gnu.lto_rxMspInit.23.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375`\315"
+	.string	"\005\013"
+	.string	"\266\323JC\020\251j:\307u\304J \004\232\004\357\212\024{\301>\013.b\256\263\330\316;\f\301"
+	.string	"\026\304\201(4\227\226\317\272dP\0364\222\260"
+	.string	",\006\b\245$\fQ1\0073\020Q\2102.!\267\261\021\331)\0052"
+	.string	"6"
+	.string	"<"
+	.string	"\3357\247\327p\337\2727p\337l\332\020\236\252\354Y\350\b\002\331\356zZ\312\315W\323\277\201cN\224\351\365b\261\273\256'*uk\267\275\261]a\177#vj\252\032\212}\313\356\256\265\225\375\364\257\027\256\301\203\007\007\273$3\t\013\333\030"
+	.string	"\260\375\214\355\232\226&H\274\332\037p\002\346\013\204|aw\325Z\260\233Nx\023\n>(\372:U`\007Dl\367\364\323\016\337\022\237B]\247\352%&'9\333\343\tHL"
+	.string	"\227\214\341#\316\026\375\300\250\333]\n\237\005\362\241\211\255\224\270o\230\023\227\200\b\247:\013_\331)5\276\020,A\242\f\322\250\360\0019@\342\005i\354\354\341\204\310\320#\215\036\b\354\204\236g$=\216\203\305\3207z\245(\216^&\335[V[\031\343\005;i\"v\307\023\361=\024"
+	.ascii	"2\241[/0.$@\020\250T#\030\2412\225p\251\200&\225\331\323k\237"
+	.ascii	"\331\245\006\273\342\032\305\n\343\201j\340\n\230\033\240\242"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 {\235\002"
+	.string	"\202\304\020\035\260%\351\270%\216\035\210\020\210d\002\315\006Ub\030\212`\340!\204\220co\255\265MR\377\227m\f\331\375\227m\2062\020,T\n%\\'\274A\212\016\361\027\315\004,\217\037H\314\320\266\007\323\375\037\001\004"
+	.ascii	"]\217G\0021 \3034\265*\003"
+	.text
+	.section	.gnu.lto_.refs.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	"\001\003\003"
+	.string	"\003\004\001\001\005"
+	.string	"\001\001\t"
+	.string	"\001\003\r"
+	.string	"\002\005\002"
+	.string	"\003"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3ab70a235a1579c6,"e",@progbits
+	.string	"(\265/\375`\212\025\rc"
+	.ascii	"*\244\\$S@\220J\352i\0018\335H\262\246\021\213\353V\203>-\370"
+	.ascii	"R\223\346\232\212T\316e\341\017\235\205'\231\f\322\221\032\210"
+	.ascii	"\361\030qX\271\273G\242\006`\255\244l {\347\220\007\034\364g"
+	.ascii	"\326\334\037\310\f\343\254\322\327sK\333;\205[\250\325P\311\335"
+	.ascii	"\366N)\005\t\002,\0021\002e^A*O\007\251\334Wn\332?j"
+	.string	"\210\254\313\315\344\362\224\366\240\2565\233Z\372\244\001E\310\232\232\216\327\030\227\033i\334jZ9i\3104\031\361\264\305\264X\032\025\205i\351\f7e&\214W\217\006\203\246c\365\\\363\206\374\202\206\023\306t\005\271\205\033\355l\307m\t\305\323\346\322]\032\013D{A\213W_\305\301m\211\333\032O\271\377r\203P\373\255A\250\\\246\315\332K\314H\304,\354\313\023\354\311S\016\336\236\376Q\033\013\031\016\233\020)#\236\362\007\267\214lG\311\005\306k\214\233\214\371\201\023\335\245\363O\300\315\312Js\362\224\313\264\0303\337\240Q\276\304(\021\263\301C\027\247\265\246\332\344\310\031\030<\305\352\260\256\201\371\201zL\025\260\367\2241\270\254\342\362\210\033\242\177\324\022T@\3604s8\375\370\322Ru\304X\3035\245+\327\004l*\313\323\356\362\226\322^\334]\035\205\0378\301:\307\257\372ovW\372o\354>`\247\373"
+	.string	"\334\025\026\214N\324\224\203.ss\365\226\253uqk\362\224{\213\271\233m\325Z\275\374?\376\377\007\234X\031\030\030O\373\252\2354\226\210~\302\r\245\263\030gl~\363\277\311\343E\332h9\361\264\247=\250n\300\345vr\316\325\237`\277\334\"T\364\355\255E\250\276l\017j\002\375\243\366\f:n\032~\324$T\363yv\224K\260\266<\365\221\201\271\233t\225\b\024Ic\371Y\377M\237{\254\302U\345)7\333\203z\373G\305\301\334\271>\201\271q\034:\345\036fT\004\253\314\350\215\002\314\354\001\3530\243\037\230Y\3532{\032\346\276\301\334M\314\275\304\334G\346.\201\271I`f0\314\314\306\334<\314,\205\231\263\230Y\213\271\205\314\r"
+	.ascii	"3\277`f/\314\335\201\271}\230\273\207\231\277\230y\n3{1\363\026"
+	.ascii	"3W13\0203\21713\356\355\355\355\215\271M0\2477\230{\250\002^"
+	.ascii	"\\\314\2658\026\277\301\307\334\006\017\363,\276\305\311\374"
+	.ascii	"\313\313\032\313\315\234\213\273\212Gao\376\037O4\261\001\005"
+	.ascii	"\037}\346\306D\201Y\347\304\257\270\230Uaf\016\305\267~\320\300"
+	.ascii	"\364%\226\226\216\031\372\254\253\263\230\210\255\355`\326\321"
+	.ascii	" E\327\364\253(@\224\220-a\300\302\354\021\365\366\302\r\256"
+	.ascii	"\003\252\317v\212=\257\264\205\211\351-\270\220\306|\022\001"
+	.ascii	"\223,3?\322Z\375\034\"AU\030\251>\333A\377}\254az\0163\227\322"
+	.ascii	"g\375\204\372\"\233\211#\3147\037@\f\240;\210(\261X\220r.\354"
+	.ascii	"\242\237\223r\331\267\316@\370\317\312Q\275=\215\361\324\263"
+	.ascii	"t\354Z\005H\271\362\345i.\007\345r.\311\345\334\324\345\034\324"
+	.ascii	"e\365\314u\2534G\031\220\026<eU\355\262\nvYu^V\207\\V{\\V\223"
+	.ascii	"\227\325\343e\234\333e\\\231\313\2700\227qd\227q\316\3138#\227"
+	.ascii	"q"
+	.string	";.\343\376r\332v9E\273\234\206]N\257.\320\n^\244\261\200\334H\233)=Ey\312i\223k\302\2775\220\312\251\013\227S\024nP\252tKp\271)\242\\F\221\\\316Bu\\v\267\313a\\.?\301.\243\371\223\313kh\330q\234\220\363\203\006\026\030\2328M_j\312n\364\027\030/\260\021\261\261\226j\255y\275\271\222=\211S\"d\311\022O\275\006\320MS\031\222\031\236\262'\271\334d\234\251\333Z\013mN\2712\260|X\001\353,@\210\230A\323m\242\252\370\221\305,u)\302\354M.\303\235\034\351K\376\3441\234\206\317h,g\352\032\330\215\256\304@M\2353\265\233\027Q\253\344\335\302\352\241\245o\030\322V\256\364\227\214.+@\300\334Ov\246\016\323cR,%o\236b\244\260\366\337\344\256b\3269S\227\3513\264\311|\245-TD\374\340Be\f\315\177\023\210\001\034\262\264g\025"
+	.ascii	"R\366\246\213\246\350\037\365\315\177\247\b3m\351\366F\246\331"
+	.ascii	"\360\244\371\b\"\346\345v\232V\323X\275\206\271\317\264\031N"
+	.ascii	"\257\226\357\374or@\2159\002h7L(\022E\242M\267\245\024\241\202"
+	.ascii	"p\324\230\365\220\301\304h\023\247y\032\327\331\022O\321\031"
+	.ascii	"\375\245\"\231\264y\302Wp|5)Cs\321%,t\251\273\272\3715r3\276"
+	.ascii	"\222\315\006\370~A\037}\364xkhA\225\030=\236m\341\301\326\003"
+	.ascii	"5\022\320\004\007\033\324\210\026w\264lA\223\346T6\310t\204\271"
+	.ascii	"a\271[o\335 \177\001\253\2516%\237L6\300\327\353\262\227q3\354"
+	.ascii	"g\330\3178\033\013\232_\003\207\b\333T\033\232\207J\0061\373"
+	.ascii	"\032v6\376\305&\t\023O\035\215\253\321\261bR3\246&\315M\222 "
+	.ascii	"aL\257\261\303\305\215\t\354\026\271\314\316\254\2761\371\377"
+	.ascii	"6p\315O*\351p\343\272\203\23094\332\b0s\372(3\007\255\377F,\264"
+	.ascii	"\266K\345e\354\301!\236\371\371\177\224*J \245<J\351@:\245\276"
+	.ascii	"xl\241\350\223|\251\"\322\371\357\363\307c\221\305\362}\220\316"
+	.ascii	"W~\f3e\177S\252\370\307\345\373\374\361\215!\220G)%\322iT\372"
+	.ascii	" \235R\312wJ}\317\037\215\311\031\307O\372\274S\212\355\235K"
+	.ascii	"e\017\322\271T\"\235RC\232\307\f)0\033N4 \310\326\202<\376\223"
+	.ascii	"S\2241\331\363D6\227\217\366\337YK\237D\340?j\231D3\352\350)"
+	.ascii	"J\317'\245(\306e\007\340\2444\265\374\343\023\211d\371\217D\311"
+	.ascii	"\350\235L\024\233\317'\322\317\342\217\250\247\261\364/\200\323"
+	.ascii	"\177\261\377\371\377\305\377\317%\243\232\377<z\220L'\247\177"
+	.ascii	"( \247\217*~-\375{\026\230)J\244sj\251"
+	.string	"\373z\342d\276\214f\261\231\217&\225\274\316\242\325\323\370\377&s\231\312\033c\332\234\314\362+,\210\247cr]PY\234x\312\2715\227;\213)\346I\365\205\371L\222E\310\0204L+*\260a\006I\243\223\301\213\271\203G\016\312\324\f\"\316\202\022\265\265\256\212\241\214\351S?\324\230Y2\266\226B\233'\0224\346\177\323\271\305\354\362*\016\306\257\370\323\273\270\030\367\3623\017\343i\376\305\2518\233Oq+\276\346\\\\\315\301\034\315k\360\255\357w\301\315\232\344[{\253\220\317\372\003\262\330\351\t\n\221.\003\260B((\314\200\310\356p\317\307\256\277\265\350\262\t\024\016\240HA\314q\n\025%T\224P9\205\n\235N\005\n\335e\024:\264-\n\n\2070\204;\302]\221\217\350\007\\Adq\202<\244\036\213\013\016\255>\304\365(8dAt\3043\302Y\207|,\273&\001w?_\210v\227+\342\275"
+	.ascii	"\372vE\303\243 \220O\273\nWv\350\347\203\261ky\302\035\322\220"
+	.ascii	"mCX\203\302\001t\326#^\017\247e\327\244\237\257\307\016\371\220"
+	.ascii	"p?\037\322\r\241\267\032\365\210<\244\313#\\q\304K\372\001}-"
+	.ascii	"\357\b\030d\327\366wA\217\375 \\W\266he\261\036\025\375&@\342"
+	.ascii	"\255H\n\022u\030:\002\032\275X\333\336\004\353\0200\003\326\307"
+	.ascii	"\003\372\371z\253p\270#\2629;\342\220\267#\362\220x\204,\220"
+	.ascii	"eW\017j\273\n\211\210\2009>\001"
+	.string	"\020\021\001\333a\257"
+	.string	"\241\217\310\333\025\ra\254C\3550\370\363}X\203#\264\2735\311\327\362\222|\354:D"
+	.ascii	"\013l{<\242\035\260\035\362vE?\237Q\013\004\"\tw=\026h\b\350"
+	.ascii	"c\327\340\216(x\264\333\365X\341\316'"
+	.string	"\024\262\001\f\371v\255\3577\344\320\nyD\273\241!\017\306\356\201#\"+\344i\331h\004\221\005\006W\226D\013\004\262$r\210n\332\035\316\032\034\341E\007B\033\350\260\353\220/\t\310\272 \262G<\037\273\n{\332\337\020\270BgmyBF\302\225%Z\205\210,\207\016\277\026\"\360\204\206x\253P\217\315a[\027\035\332]\212\334\257\205p\330cy\330\326\305\217p\267\266\274v\203\025\311\327\376\206BD\266\347\327bE\342\261-\204\302\265\007d]\364\330\036^\313cq\264\376~<\243^\316\021\020H\301\016\327\356P\350\332\237oxY\247[\021\202\003\r*\270\275\021A!\022\t\"K\342\347\343!\221\350\261B\022#~r\240G\264Lm\354\b\016gcE\3454\363\324\311\t\275\001\201\nSmJ8\024c<i\331`\364\206\216\325\0137Py\212>\241\312\233 m\316(Q%\232\214!\006-[\306"
+	.string	"]Q\371@k8\227\316\022\255-\201\265\250\221@\210\0243\"\"\"\"\"I\222\244\003a\005\3040\350\244*\036\022`d9W9\311\2044I\n\245\375\330\016\005\271\320\202|g}\007\202\\\216\342w e\326\251Pq\037#Vk\222\f'@\t\0039\254W\246\351\025\033M\336\031* Uu\0044q\2132\344}\016Y\247a\221\254\337Q\201`7s\212\355\365\216j\200q\001\305@\247j\252\230\007X\376\236\r]6\2232\f\032zM\234\245}i\267wB\2534\201\020\360\362\nl\302\006x~\226\221t9?M\200\322~t#\0220>Y\352\237\345\007\353\220\0206u>\305\253\217\331\352\222\335\272 1\031}\345\211\316V\002\001\322\357\020\3501m\276\355J\317\n,YH\260\205\032\202\350S\233W\2676\237\354\305gA\034\n9\b~"
+	.string	"=\255\200:\026\3052\350\314p \2133{\214\202\261l\265\\|l\275\373z\223\342A9^\fl\330\225\364\367\353\310{_\2540\002E\250\345\037 \313\276\330\371V\034\237\357H\033J\237\203\320Fqx\327\263\203"
+	.string	"x,;\"\354\2731\326kb\247;j1&\363\016q2\346\353\364X\354oMq.\351\307\232\310O\317\261\324R/\021M>\315R6Zy\246\b\377\377)\226\005\324_\206$\221\tnv\001\343\001\361\234\274\241c\021G.jV\321D$\271\324\324:\336`\301H\261.x\324\022\273UM\221V\227\213\263\320\313W:j\021\007dH\003\353\310b\377\376\236=r\323B\205\221ghe\t\260{aD{\366\355p"
+	.string	"T<\210uT\364P\317\351\224\250x\306\324[\217\2341\324I\343\210\017 \263%Q\025\312\352\236D#z\244\356#\255\316^\024$\246\344|e\323\242Jj\301\362\254\201\310\326\260\027+\247Sd\375n[Hq1F@\265\003\265\rT9\201\025\337u\024\326\261'\323\254\320\232\254gY\265\220\264_p\277\351\206E\032\263\fO?<\300\206T2^\370=\307\267\037\r\r\262405\366\223+\002\202\342Q\244\244\324$\311\177\2037\310\223n\242\263\301\003\262r?`\212f2vF\313\316\242^\\\034b\205\372\357H\276\fV\323\375V:\205u\325Z0\207\231\305\371)h\235\2015\235(\330Vh\177\225\234\346p\033\262\024!\3039\201\276\235\275$\274\003\354b>\342'\026p\024X\234\r\001J\306\f\344^n\253\240\302[\b\367\235\250"
+	.ascii	"H\236\3141\211\377\275\021Rt\361w0@\255R\245K\210\034_\004'p"
+	.ascii	"\020R+\364\234\033\027\323\031\331b\356\206i\217\034_\004\267"
+	.ascii	"\363\274\030\216\320\233\221\224;\271\213B!\\\366\272\230\325"
+	.ascii	"\035j\332\\\300\307\230\335\271\227\331\b#^\257\f,\322\203\340"
+	.ascii	"\334\270,\030\3340~\t\304\301\311\327l\365\347E:\342\237U\021"
+	.ascii	"Y\371\270M\037\0324\320\221\3601\016{)\304Yt\315\356sw9\376\271"
+	.ascii	"e\212\354.\306\307\220\001\217\002\2372k\361#\3603\340\032>\324"
+	.ascii	"9\031^\377\340}\374\3507\343\342_\367\357\215\277\263\353\032"
+	.ascii	"\261P\234\003\004\3567\254\002"
+	.text
+	.section	.gnu.lto_.symtab.3ab70a235a1579c6,"e",@progbits
+	.string	"rxMspFrameReceive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3ab70a235a1579c6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2110 @@
+	.file	"rx.c"
+	.section	.gnu.lto_.profile.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\013"
+	.string	"6"
+	.string	"G"
+	.text
+	.section	.gnu.lto_.icf.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\311\003\315\025"
+	.string	"d\034\275\004"
+	.string	"S"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\317\253\250\341\002"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\212\215\226\271\004\n\002\002\002\004\002\005\002\006\007\002\007\002"
+	.string	"\002"
+	.string	"\007\240\342\234\212\n\b\t\352\263\360\321\b\n\350\373\222\243\013\004\002"
+	.string	"\002\b\013\201\303\362\317\t\b\t\002\n\002\f\r\016\017\020\231\212\366\300\001\013\002"
+	.string	"\002\004\022\242\264\360\361\003\b\002\f\002\f\f\002\f\023\024\211\373\302\306\005,\002\r\005\002\016\006\002\017\002\020\005\002\016\025\026\242\302\263\302\013\031\032\033\217\224\332\351\013\020\017\002\017\034\035\036\037 !\231\233\302\213\016\002\"#\323\331\354\253\b"
+	.string	"$%\256\334\323\366\007\004&\337\260\247\342\003\016"
+	.string	"\002\021'()*\211\276\343\032+\260\303\363\371\007,-\264\370\341\227\005.\374\327\362\373\r@\002\022\002\n\023\002\n\024\002\n\002\025\002\002\026/1\350\300\306\254\005\00223\274\205\242\255\006"
+	.string	"45\265\372\210\203\b6\377\245\346\313\017\b\r\002\r78\365\273\261\345\005\027\002\030\002\0309\202\245\236\333\006:\274\201\267\213\007;\205\326\204\336\017\020"
+	.string	"\002"
+	.string	"<=>?\260\317\323\347\f&\002\031\002\031"
+	.string	"\032"
+	.string	"\032@ABCDEFG\324\351\375\343\005\032\r\002\rHI\323\343\357\213\016\006\007\002\007J\312\267\354h\002K\275\250\276\313\004"
+	.string	"\002\033\002\004L\304\264\335\245\016M\002\002\002N\223\335\346zO\311\327\306\335\013\002P\347\273\234\355\f\002Q\325\244\200\334\003\004"
+	.string	"\002"
+	.string	"R\313\331\347\361\004\nS\342\201\222\246\004T\260\233\213\233\tUV\321\265\255\355\007W\240\342\234\212\n"
+	.string	"\200\203\250AI\202PP7\013T\030v\003\200\002*\232b\007\021PeDE\nR\250\323\001\177\204\300wg\317l\221\217\221\361N\374\345\242\204\336\220\324f/*R\262\022.t\\Q\334S\325\007zbF\222\336\322e\245\330\351\225\326\335\373\245\n\354H\206\252\337\312L$\220\273\354e5\336y\340\265J\024\004\376\262\244$\345\365ws\331\240+\017\250\261D|6\377\252a\007L\304\2157\215$\321\277b\214\225\023{s\201\233C\314p\3232@\243B\346\344\256"
+	.ascii	"\301`\374\331@\224z\312\373\261d\225\037\377\315\313\325\211"
+	.ascii	"\252\346\205d\373\335\214\306\207w%\303\200]\314\354/^|\337\231"
+	.ascii	"\272\324\373'\271\025\375\002\332#\346\177\n\303<O~\375\220w"
+	.ascii	"K\337\202W\212\321\177\013\001`J\311Fs\326R\326\270\376x\230"
+	.ascii	"\344\036\364\253f\376\355\312\375h#\201;"
+	.text
+	.section	.gnu.lto_.ipa_sra.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"m\006"
+	.string	"\222\310\030\036Pe\025:03333\025\030c\240\377@\355\271k"
+	.string	"\321\375\222\034\275\346\026Ar\247\024N\2029 0\003"
+	.ascii	"j4E\241\t\372\363\036}w\226\363F\243WF\353\215\331\313Z\2662"
+	.ascii	")s\242\222\b\304\321\230\341/vB\035Q\3560'\r\365\322$\275\352"
+	.ascii	"\322RTUa\245\301\336\bNV\275\017/\b2 `\002Ix\035j\201\266\366"
+	.ascii	"\251\317!%\244a\022*6B~\210\306\276$\315\021\332\213A2\350Eg"
+	.ascii	"\013\003/\030\222\210\327\354P;\214\254\266\307\025\221\007\355"
+	.ascii	"\272#2\004+\301\3344\260\322\331lJ\243]F\\\301\322$L\277\004"
+	.ascii	"\232Q\313\205\027\336$\366\206\321C\252\210\270\360\3644\037"
+	.ascii	"\256\006(\247\001n+\212\033"
+	.text
+	.section	.gnu.lto_.inline.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\217\007\335\033"
+	.string	"\346\344\205J\260TN:\364v\312\034s\026(\035\364\020\304D\262\205i\265\230&]\271\255|\274\215\356\373\326\fc\355G\300\003w\226\200\031\206\233)4olA\023\b3C\212\262t!\247\257\222c\223\261q\310$\263'\033D\023\262\267\224)e"
+	.string	"q"
+	.string	"w"
+	.ascii	"\366\266\204\275\265\331\336\226|[\362mI\324\262#\351\311\027"
+	.ascii	"o\305\237\254\247i\256i\376\177\3035\375s{\326U\2460)'\362\263"
+	.ascii	"]\237\367^\004\375\327]/\335{\005\034\264\265\305\2757\350\257"
+	.ascii	"o\236\246b\304Ccx\372g\304C]\316\375\306\365\275\367\206\377"
+	.ascii	"\256v\245\351\357\245\177\336\3254M\177\263\177\301E\027\001"
+	.ascii	"/\360\317\370\346\311?\217\225\247\372\250\206\260X\374\212\210"
+	.ascii	"!\035\3531?\371\323Z\274\025G\324*\242\336U\037\303q\3154\006"
+	.ascii	"\345\252\034\3521\215}\311\330\377\265\346'\256\265\212\377\325"
+	.ascii	"'\005g\bk\275\342\340Y\327UD\275\250\231\227c\315\365\323T\231"
+	.ascii	"\225r\006\226,0\312\223/C\027\273SO\245$Ufz\232G\004\013\322"
+	.ascii	"\314i7O\360\366'[\002CP\037W\313\277\323<\212\232|\f\b{\322e"
+	.ascii	"\025\340\024~\030\360\346\231\253^\367\336\022\335\302\001\025"
+	.ascii	"\363\t\022p\"@\300\325\007\314\2646\317\236\252dL\006\020FQt"
+	.ascii	"\224\"0&\377\275\301Q\232\222\215RiJ\006\340\fh\277\371\257\253"
+	.ascii	"S\367^\232\206\271\202\376\216\0045\361\007\356bm\276{\357\354"
+	.ascii	"7\023\255k-\241&\\\266\372\337@\363\371\274k#^JBd\002\377\017"
+	.ascii	"^\204\316\251\304n\357\205F\224\230\224\361!@|\3102=\324\254"
+	.ascii	"\0162\272\352"
+	.string	";\007\241+IZK\343s^\332\311Q\022\330\370\r[1\320-\235\023\315{Q#\b\3165\004\211WK\2468\345\3304\037\310)\264i\237\267\357\206\317\206\203_\270)^\314\365\327\017+$4'\203l\r\355\255\031\212o\375\303?\310@P\341\255}XG\217\246\034\004n\001'\346\272\345\025j\200\240\250Q5cd\304d$%I\n\035`\002\031\251\251\272\003\022\340\004]\003\2311\310\020#\315\004\023I\220\240\234\36405]n\017aE\233Y\\\360\227+\361]\352\237F\302\264\352cg\217\374\241\r\245\250pD8*\016\2432\211JM\230\257\337\303`E\364\261a\rAR\t\364\177\241\331U\bX\301\255G\362~c\314\230\033v&|>\244\312\237\214\277|\005\274 e\020IM\305\n\220\255\034_\234q\025\341\376\362\204\005v\017c@_\377;\317\203\305O\215^O\332d\n\215.t\334\202\244\235"
+	.ascii	"A\001\237V\311\207\252\bV\342p5\205\327\223\273D\222\323\371"
+	.ascii	"\241\2608\366\322\352\205\352\305PYo\220 (\322$\034U\252\225"
+	.ascii	"6\022{]\306\007\344\303\332\323\001aO\224\017E\262\363\016\366"
+	.ascii	"W\204\226\237\202@\345\346\n\332\375\022wo\320\027\375\256\312"
+	.ascii	"\240^\204\020.\326.O\351\315\3209A\204\034G\223m:\276Q\273'u"
+	.ascii	"\262\032+\031`\256v19\200\334M\314\2611}[\342\237KE\301\236M"
+	.ascii	"\350\3637!\023\307\264l\366\027L\331\252Z\373\243\256\023\bA"
+	.ascii	"\313\214\026\346\232[\032\252\234\262\270\361\340\025\216\002"
+	.ascii	"t\324\205d>\342S\036\222\376N\350\206\027\033\310+\226\366i|"
+	.ascii	"Xg=\\\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\252\003\025\020"
+	.string	"\266VI:0Q\222t %\325\r=\211@M=\326\264\323\365!rxP\320hH\356\024\201C\032\026\207[\006\364\343\\r\373\300V\177\277E\277\265\322\274\321\377\370N{\255%\226\020)S5"
+	.string	"8"
+	.string	"="
+	.string	"\347b\225\227\250z\017L\t\246\344\312I\345\244|\301s,\016\313\324\032Ug\252\016\377S\027K\327\3640d/O\331\250\002\351\351\233>\331&\262\227\310GV)\002sD~\003?\233\020\212DG\232T\024\362\320\200I\203\234\301\265>\250YS\263J\250\017\340\347\003\004\204\267\"b\021\343\261X\355g\242\233\2151H\030,\027!\322\244\216\fcZk\255PY2B\004\341\037\274\203o\360\f:\254\303H\213\205\214e\030\3130F\031lM\024A\023\016\336\320\321B\005{\222\326v\240`\354\304\246\277\200\n6\331\244\322*\215\303\313\001?\210\377\360{\370\016\034\236\r\257\301\006k0\303cx\350\302c\341NMB=\017\262\025(\024\036X=\265\246\022\364\b\220|\024Bz\321\204\333\261\033\321&\025\240'@Bt\rc\250\3018\316\030\t\211R\254l\006`\002!Vc=\022"
+	.ascii	"\322\202\314Y\351PI\220\202\024j\331;+ c>\237\344Q\345(\f\360"
+	.ascii	"\251\223\255\257@\214g\317>\\\201\231\001\263\226\252\277^\310"
+	.ascii	"\267C/\251\376\b\300\322f#\316\214\202O\224\354v\"\270z\346\243"
+	.ascii	"v\2548\203\233BH\027\316\266\357\351\277'\335)\013\224\352\345"
+	.ascii	"\226g#1T\352\r\225\317\351\351\320\203\217\267\221lR\341\026"
+	.ascii	"\004\037'\206y\027\251\225\311~\211\223f\033\262\021\357Q\341"
+	.ascii	"\"\210lV\272N\354O\233O~vD*a\262\364\251\222b|\232.m\320\206"
+	.ascii	"\230\341\314\3640J\274\352\327T\256\265\2060\377\224<\343\255"
+	.ascii	";\202\217\250\026\030m\240\2212<\002\343\377\030\327b-\306\357"
+	.ascii	"(\345P\371\205\r\3255\001"
+	.text
+	.section	.gnu.lto_.pureconst.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \200\035\003"
+	.string	"\002\310\027\034P\205Cc\207Yq\366tUU\205af\246\267\b$\022\267\260\224\221\254\377\020\210\354\036\200wr\223Wr\222\217<\221\207<\220\177\334\343\035\347\370\3065\266\214c\374\342\262\270*\036\305\233\310$\266\210C\334\341\rg\370\302\025\236\220!\374\340\006Y\301\t.]\003\227\300\026\260\251\207R* "
+	.text
+	.section	.gnu.lto_.ipa_modref.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`V\002\215\n"
+	.string	"r\216((p\213\226\003\220\375\377\377\377\377\177U)\030\210\224\022:\220l]#\333b\374\355\006\343#\3312E\324B4!{'\231\002J\236\214\312\341\305\365<\235g\347-\264\202B\235\220\320#\024B\037\024\263\343\3546\357u\3440\303f\032\256\261t\003\300=>\2343\323<\257\277X\254Q\334\265\313<3\025Ei\302\020\"\317\310N2\2300\317\313N\362\224l9\"\250<+C\003:\331-<D\005$\210n\263\340i\211\341\001\322nzN;\312Sa7\031rD\203\324\377jJO\352}\346\201\017\205\032\002U\2501U\344\320\bi*i\r`\002\031DV\036\021\220\231S\312\030i\232V\016)"
+	.string	"\216"
+	.ascii	"`\275\257PI\204\304\311\026*\025\345_\276\302\326h)y\030\235"
+	.ascii	"\004[\2258\377n\325:\224\007\035\204\223x+b\342J\274a\200\212"
+	.ascii	"\013\202\342\202\333O\351,A\3065*\0255\\\037\2202 t\323\022\253"
+	.ascii	"\326\262\223r\350jV\217F\026\336\2640\322\2339\272\033\347\356"
+	.ascii	"\315\375\222\303\344?\276\215@\231\354\361\276\2476\225\031|"
+	.ascii	"Sj\372 \016\033\221O1\006\331\225*\316\203\026\004\323\307{\310"
+	.ascii	"\270\353MG\346\200E\331R\325\260\236g\373r\371"
+	.text
+	.section	.gnu.lto_.lto.3d03625a83eb736c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.81.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \226E\004"
+	.string	"\244\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\376\241\033\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\344\030us\355\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001\004,?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"_\304\202Yt\212\"o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.82.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`}\001u\017"
+	.string	"\206\335hF\360\222(\035\022\366C\234!\276\345\224v?v\330\233\352\325\211\247bA\355\245\353\327\325\353\2119\275#\337\255\325\003E\226>\263t\250j\353\006\266\362\260\314\bA\366:\256ml\365zEL\355\266J\b\331[\356\224\002R"
+	.string	"Q"
+	.string	"W"
+	.string	"\335A\266O\227l\034\017\301\375\313\307J\214\307\356z:\302\3622\274e,}J\215%?\346#\340\r\325\312\364)\003\320`B\bXm\220\013X2\264\303\036YV\250(_Z\256\207\035\001(S\255Z\036\271\007\273\353\250Z}\270\267\333\376l;\260\337\"\234\273~\356\257[>Zct\214\321\357p@\324\020\331\261\333\241v\2634SF\211\277n?\364a+\316\242\364\227g:\223\207N\026\343\220cwI>\335\240\373, \337\261\375h?\305U\224\356R9\201\335\326\217\331n\250\300#\335\247\303\207l\237\001\240,%b\300lt\030"
+	.string	"l\304Pp5O\331\354\013w\221b\240fw\031\3702\022\006\021\220\304\247\257\262}\036"
+	.string	"u\234b\315Q9U}\352\304Mc\273F}\312\004*\326,\365z\330\345\r\030c\345\307)\326TY2\264\027U\027;4Em\321`X3k\313\016\240\217P@\021B\"\223\017J\310\003a\302'\024\362H0!}!>)!}\036\351\363B \017\005\357\344\033y% \026U\370|\236\005\221\350\363:\341^[~\314\273\027,\232\223\242\246\272\230\233\241\034U\233Hr\251,\266g6\251w\275l4\304\036\227\273\273\322\t.\225\243\031\002\035"
+	.ascii	"3\003\3769\204i@\272\266,b,\201\225\221Y\242\203a\320\216\245"
+	.ascii	"\236\360\264GDka\314\024\0023P\227q_\205TKh]\354U\021\250*\034"
+	.ascii	"\334Y\325X\263\022\035\334\213\033\"\312^\250j\274\237D:\327"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.86.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\264\007i"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\307\362\023\032\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\305\031us\350\314\030uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001\022+?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.string	"^D\200I^\212\"d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.87.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\366\001M\022"
+	.string	"&\243|H\320\322(\035\222%\332\311n\013F\"\026\300\255\273\213\336z\313\203\354\333\335Y\340\261\351\310\0060\347\017\327\341\337\266\235/z\363\362J(\n\257\"\276\340\nW\027\370\030\321\007\022D$em{\306\225\t\266\032\331\233H\231Rh"
+	.string	"b"
+	.string	"j"
+	.string	"'\221\217\206\331:\256\373\231\027\312\241\t5\3159\303\025a\001\377t\267T\330A\031\277U\230\037\364\023\\\257f\2539\370-\211\0368)\033\355[\221\201\343\343\274\353\215M\246\022u\202\347\261\303\277\217A\021\b!)\333\354K\231\270!\023\261e\320=\357\npE5\033\317\025|0\347\264\326l\034\356\323m\353\330^\261\325$Z\340G\317\221\327\307\036y\356GE5\370\335-?u\274\372[\365\256ZU\375\024*\207#\301\320\2349\275 \363(\316(\361\335\355\353|^\213\273\200}g\243S\215\316iH\310\303\2169'\312\243\035\234\036\r|\027\261}\265\017t\026\260\347hJ\002\314\331\016'\306\234\272\024\237\234\036\255\373"
+	.ascii	"\371x\n\030pE6\037\300\265['\002\320\023\323\336\027\367\246"
+	.ascii	"M\033V0}\353\003a\207i\227c\246@\034\327\256\360\0272\b~\346"
+	.ascii	"\234\r\374\241\013\257\003J#\036}\032\371\030\215j<\276q\t \355"
+	.ascii	"\242\366\333\333\244\320\333\206\324\335\275\r\n\271\272\037"
+	.ascii	"\f\332\220\230\366\234r\271\337\363\336\242\002W\203\006$\323"
+	.ascii	"\336\"iH\n\261{\263u\262\253\277\"\254`X-\226\230\027\026K%\201"
+	.ascii	"\345\005F\365\212Y\251Zf\\%vQ\231q\2053\256\220\265RM\b]\\\257"
+	.ascii	"P\205\304-\n/\256\320B\253\345\nEt\261\257O\320ODAG\261\225\201"
+	.ascii	"{3\270\024Gv\227\024\345rol$\345\206;I\273\245\231\002\321o\316"
+	.ascii	"9\345\336\254\237\311e\244*\321\310m\274\214\004\367\306^p\271"
+	.ascii	"#\033\" @\002\204\030\026\017a`\357\035\232\033'\313\312\342"
+	.ascii	"\276Q\0205\312\244\301\206\360\013\350kLz\f-\370\252\235\265"
+	.ascii	"\335\377Va\343\231ZRh\016\250%\344Vw,l\320\315n\fPen;\233\260"
+	.ascii	"f?\035\3552XDv@\364\220\365}#\353v.C\006"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.88.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`r\001U\017"
+	.string	"\306\334gG\340\262(\035\220\2418\bL\347Pd"
+	.string	"\325|\217\321\326\306\237[)\341;(\272\201\345F\037\r\025\220\271Q,\326\323T#\021\271\026\260\241\300\022\34681\236\353\310-T\370Z\340\360\020\226qb\272\222X\262\267\334)\005Q"
+	.string	"P"
+	.string	"U"
+	.string	"\333\247M\266\316\301\023{\030\212\017\260\036\273\353\251\t\313K\360\226\321\364)5\232|\232\213\274\304R\253\323\247\f@\223!!`\345A6`\331\320\376zT\255PQ\302\264\\\377\372'\305\215\324\252\345\321\023aw\035S+\021\367v\333\237m\b\366g\002w\375\362\341\035\357\272\017\340#p\204.>3vA\324~,\316\244\261\342\341\355\203\376\013\306c\230\036z\306\235Bp1\330\213\216\335\035\371\364\003\3563\201<\210\355G\3733\177a\272+\345"
+	.string	"\201]\tU\262]\220\201E\270O\2037\260}r\017\t\321\307\345\356\256\364\202G\355\364c\203\245\304\301_9\375\360`a\201\2125\017\220ixM\027s\323\303\236\234\243l\366\206\307P\270\335u\340\313\350\300\001A\216\212O?e\373\374\353\nbnZ\354\250\304\232*\313\206\006\243\352b\203\247\250-\232\fKfm\331\035\027\242\237\210&\214H%\241\223\021HB\205\320h\004\242PR\372\n\330\204\244\364y\245\317\033\211@\026<\223\017\203G\022b\322\205\320\347e \221>\017\004\334k\213\346\\\315\016\034\025EMu\261\247\206vZ\232\271\342\310\243\252\376z\2673\323QN-\243\324\253\312\263-\352]a\216\225\035"
+	.ascii	"2\003\376\031\343\206\306\341\364\367s\267\346C\024\203\t_f,"
+	.ascii	"p\r\245\2100\225\307\215\265\027\346\242.\350\2762\tLT\246=\235"
+	.ascii	"\331U\006\250\312\034\264\263JX\263:\035\264\213\303\"\312^\250"
+	.ascii	"j\274\237D:\327|\002"
+	.text
+	.section	.gnu.lto_nullReadRawRC.89.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\365\007"
+	.string	"\342\01677@o\323\001\230.,u\332\2550u\243\201j\202\372\005\314\277\016cXj1\366\032\311,\310-\022\372z\242\252\006\231\253Ow\344\305\265a\220\333l\030\313\254\233\020\231R\021\033\307e\020\232f\3632\357a\003}<\216\302\341\223\001\326<\237\214\237\214\334'\003EMNDO\307\235\304&\243\327u2bs\037^\004\027\224\310\236!\245N\366\253\245L\266b$\227\003\226\335\214\031\231m\261V>l\2036f\273R[a\001\374I\3059+z\331HP\265_r\023\360\323\342\002\273&\030\225\335\211\340\202\315-\317\215m_\344#\240C\235\035$\200S\bFJ\314\356\214\234\017\\\267\364\235\353\026\305\361\360\032\372Gy\005\34213*\205\256\232\206\335\265\216J\0327u\333\006\266\031l\223\004\f"
+	.ascii	"2\003\202\341\243\302^\025\220kx\227E\3531\241\301\\\201\n\007"
+	.ascii	"w\215T+&a\222\001"
+	.text
+	.section	.gnu.lto_nullFrameStatus.90.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \366\335\006"
+	.string	"\222\31516@o\222\016\230\265@x\266\022\\\321\0312M\200\370\r\352\nf\232 \220\331\315\201\271\033Jt<\267\233\346Z\213\316\240\345\021o\021\347\033\227\211\223\215\335l#2\005\230\326\321\0360\320G\013I8\210\240\300\036\216\b>\021|\241O\007\364<0\342q6g\020\030|Z\226\301w\305\354f\025PP\025\037I\216\342\370f23\2476\336]\032,\b*\231\246\030\230\\\251R@\376\376\243\277~\347\276\"\035\031\225d\242\003\231\033-(\2311a\003M\253c\t\254V\232n\254V\377\013\f\243\267F\017S\200\305\311\205\311Kf|TG\267\272\355\266\244\231\220\017\227\322\211T\007\320\220\231\273\322\t\243S\375\017~\205?#\006"
+	.ascii	"2\003\202\341\243\302^\025\360v\031c\272&\031"
+	.text
+	.section	.gnu.lto_nullProcessFrame.91.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \370\365\006"
+	.string	"\362\31526@o\222\016\230\276D\030\006n\034.D\030\262\025`~\201\265\303\233\033\005\221\335\034\230\273\241\302F\323\377\272\216\260\342\311O\023\t\370V\t\334t\201\355\257iBd\n \314\2039\200D!l$\321P\202\002\177:%\370J\360\215B\036\321\373\300\210\327\331L\202"
+	.string	"\301\207\221H\360\035\263Nu\263\253\200\302U|<5\267\361\005\310\314\334\251\276=\254^\\8(\231\250\030\230\\Y'\036\177\177\323\007\374\255}A\032b\252\310D\0072U,&\231\221\263\201\246\326\261\004W-M7W\255\177\205\005\323Yc\007*c\221rA\362\222\031\237\343h\326\226\335\216\364\340\243Ee\245$uj\3130d\346\r#\225\321]\177\204?\341\327\b\005"
+	.ascii	"T\b\203\347\220\254\202\343.s^\327$\003"
+	.text
+	.section	.gnu.lto_rxInit.93.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\354\017\315I"
+	.string	"\032{H\033?@\242N\007\363\246Q\227\335Lw\377\267)\331u\224\\\334\335L\375\353\347\342\265\362\214\303\356\353\230/s\2301\342D]9\026\202pv\301\t(\265\211\211\253\235V\034EE\2037\331{\313\224R\243\001\205\001\250\001\203\324\330H\265P\034\310\246y\363>\3673\356{\356c\334\251~\376\327\3103R\334\320\304q\214\300U\300"
+	.string	"\366\276\035\315/jl\004\2316\007Q\272\030\307T,7\257\235\257\214\353\301\276\327\303\215\321\270e{z\210qL\035\340:\273|\037\236\327\t\360\352,v;^7\362\256\221\316.c\247\025\351\226vi\273]#\333\247^\007;\265\3314\235\324\370\f\002\337\033i\226\263\035\300u\266\351K\255\263\253+\265\3166\020\227vV\333\342\2324\216c$\213\204\273\3738\265J\354e\f\221\345-\306q\274\225\333\230LfT'\371J\365>\312\2607\251\246\244"
+	.string	"DA=951-1\225\222\220\226GJ\243$\262\210\310=\266\354\232\037n\377$\203w\203|g_\336\324s*\275\272\237:JX\341\336\350I\031\243@\247.\265&\341\314\350\326\005b\213M\272J\320l\372"
+	.ascii	"\326,\266\330\304\005\315\244+\204F\262<~\347\366QT\240s\016"
+	.ascii	"%\306\237\234\344\274)\216\357\355\231\304h\371%1xY\236y\224"
+	.ascii	"p\347WR.Q\240s\256\224\204\305\221\256\254\3159+\277\\\263\226"
+	.ascii	"@C\\\320\254\312\n\001pH\242\333y\025\234\331\332\037Q\201\262"
+	.ascii	"\271\362(\301\316\261\370\336H\031\243@\331\334\250*\211\024"
+	.ascii	"4k\2626\341\314\324\276\210(\r\316\f\355\335\243\013\2321!\373"
+	.ascii	"\226\035C\236\211\375\352Q\240N<\257KF\264<\225g\316\025\013"
+	.ascii	"\021P\220\317\371\227\235\205\375\037%\304q\334\377<\203zWy\367"
+	.ascii	"\237\350n\024\335J\253\317n\230\316\r\301u\205\334l\317\317S"
+	.ascii	"\3111wO\360F\nK\214\353\341\023P\233\217\331\311\016u\005\037"
+	.ascii	"\304\345\306\261\263A\273\242\013\272\200A\203\206\326\3316\033"
+	.ascii	"!9#7\005\373\252Q\003\372\343\227d\373\034\366%\325\271A\262"
+	.ascii	"\3138\216\331\314\204\262\r\250j)Z\t\007\313\264\231\"jDk\034"
+	.ascii	"\257\231\tUkD\"zn\026\274C\306\361\370\021:f7g&t\311\253\221"
+	.ascii	"s\327\376\0349y,\2279u\330\034M\343\237_\377\314\204\036\tt\346"
+	.ascii	"/W,\016\312\232\243\356\241\355\346\340m<4\021\306q\334\240}"
+	.ascii	"\215\263\001\321\356\346l\213\030\301\266\217h\235%\362\202\027"
+	.ascii	"\227\b\366\325\345\025!u9G;G\353Y\305\235\241\363\033[\351\233"
+	.ascii	"\032\273\211\266\033E\212\367\247g\026UDFDg\376\352\246\206}"
+	.ascii	"\216v\273\323\233]`\347)\335$D\200\370\220\374\356\340}\336\034"
+	.ascii	"\374\214\367\206\243o\256\243o\013G\337\007|\317;\313\307xc9"
+	.ascii	"\325\373\252\3756\220\374\266J~\027h\277\t(\277\007(\277\005"
+	.ascii	"(\277\003$\277\253\332\357f\373Me\364=E\364-\225\374\006\220"
+	.ascii	"\374\216j\277\241\334\357'\367\333)\371\335\224\374fr\277\227"
+	.ascii	"\334of\362[)\371\235\324~#\265\337K\344\367\221\373\255t\277"
+	.ascii	"\215\330\357d\3217\262\350\273\210\350\233\310\375v\217\337\307"
+	.ascii	"\366\273e\277Y\366{e\2773\373\375\354\267\227\320\222\2565i;"
+	.ascii	"\224\003\336\243e\346\245\354cpJ\231\231\263\"\331!-O\312J\371"
+	.ascii	"\311\3202'\345\226I\237\033\262CM\\\3552;\237\177\025*m\214\211"
+	.ascii	"F\364\230r\024)/s\236\336\315q~\243\237\017\003\346Ud\325\276"
+	.ascii	"xA\312\357W\370\347\341\372\r\364\\^\305,e\267\274-\263\327\261"
+	.ascii	"\342\201\b\331\316\226r\264_\306\366({\335\025v\277\203\336\355"
+	.ascii	"e\314\020]\\\223:\231n\370\312cy\t\021\275\031\331B(u\266\337"
+	.ascii	"\312_y\r\275U\370+\254u\366(;\236_\341\331\031D3\215\302\314"
+	.ascii	"\321\376$\013\2315D\342\312\007rY\367\201\334\335Z\337\326eD"
+	.ascii	"\205\t\330WW%e\266 \366S\244(\263\273I2\312\\\371\025\241<1\312"
+	.ascii	"\236W8M.\tDDJf\027\323\214\223\331\347\334\233\244\371\263\314"
+	.ascii	"\321>\032*I\344lh\224\345W\271\254\331\264W\331\247\376w\305"
+	.ascii	"\355\356\350\200_e\022\371\007\237\035\244\032\3146U\005\355"
+	.ascii	"\323`2!pYY\336\023\320\2739L\244-\312\310\314\322\031[\013\373"
+	.ascii	"j;\370n\370\f>\362\376,\312\004\240r\002\303\362W\023e\267O\322"
+	.ascii	"u\344\240\377\310#\201\223\300K`44:n&\202\325\376\fv\362fnv;"
+	.ascii	"\267Jl#7\315`\032\r\361([\"O\034fk\373\207<\021\230\r\n,EJ\353"
+	.ascii	"\354\021o\315\242\357h\373\203\274\220\035\355n\rG\3416\270\255"
+	.ascii	"u\226\365\262&.\321\n\214\305\2120\313\213\301o\316\264\275*"
+	.ascii	"\027\270\213\325\227\377\202\303|\314do\320S\t,\007\317\021\250"
+	.ascii	"\022\307`\036\rC\213\207\327\326\013\0330\264n\264`QcF\212\025"
+	.ascii	"^[+\\<u\245x\025)\276E\016\031]:\330\030\336+\264xxm\361\360"
+	.ascii	"\332\242\021\243k\306\326\n\257\033[ZJ]\303F\013\257-\0345jx"
+	.ascii	"m"
+	.string	"!\251`\236\247\364\b\266@\260\034\326\0062\237\035yp[\207l I\017\331\241\r\331*w\310>\226\310![\345\007\212e\276p\307\027\"\344\220\177O\341\024\254\316\013\344\r\031J\317\330\032\201\\`\357\367\350!\220\375\317W\271\274A\271i\211\037\220]\372x^@\367\357\274\340\353\367\367\002\002\266j^6!\276\377\274oO\227'\021\252\325\306\356\027\316+\347\3759 7\003\344\376\363'\355:\343\030L\200\200\354cq\252r\200\214`\f\261\231\253\262\323y9q\2329At\217\\\363\265\323\366\267y7\257\235\367\316\213\347\305\223\227'.\221*\316\251\262\n=\277\206\313UC\225\263\262\024Z\243\233N%\323\250h\234\325\305\304\f\357\322?3\"B\333\342\232\037\335\233\321\340T\200e\302\322\244|\375\026\276|\336\237\335\202-\220\021Q,\177\365 .~\244Z\264S\231\211\303\223\361\340\346MYy9\004"
+	.string	"%\"gC\245,\307bb\255q\034\307QXYD\366;_\013\231\031|)P9\332\216F\306\351Cv:4-M r\226\224\205\037\323\265d\347O@YY*;\261!;\264Fe"
+	.ascii	"\371x\b\225\243\262\277\207?\3452AEJ'"
+	.string	"\205\312H/\203\214Ob\374)\177x9w\312OM\331\351\2003\345\246\374t\210\224\231\006\235\216N\357\321.e\020\371\r\215\255=\005\201A\250a<\343\224D3##\"I\n\2224\006\241\005\304\020\007\331\231\007\021@\245c\020\031I\223\016_\303\277\200}\241\305e\242\315;\275\2036$7F\324\303Q\215\352a%\t\326Q\247\017\311j\037y\007\235\3052\204F\036\036M\363\031\212z\353\0055\036\212W\002\367P\002\353.\367}\313\216\266(\310\234%\351\022\233\310\354\234&\202\361\333\005\260\177@\237\326-\303\240\022\263\352\205\271\b+\350N\234*\333\272x\205\344\307\202$\334+\030\027\0324'\027\350\331\377\307?=vTddN\245\341\231\304W\022\004qC\304\221\257\n\242p\372\3301-V\216L\006\334,\334V6A0\304\264\f~n\tnb\345\337\252G\300\220\375vs\\\344a \235\033\253\205"
+	.ascii	"\234\334\274*\315r\206\300\202\032\214\370\351b>\304\361\207"
+	.ascii	"(g\211\326\337q\241\331"
+	.string	"MI\215\230\3745\320\311\220\252H\305T\203#\016\243Q]\223\026o?UU\341\262\311\370\351| \333\312}\303\225R\301\204\240\346\027\210\244\364m\017\020\304+\255\335}\326\206\206,\021\341C\241z^2\"\357eb\271W\321HA\352\b[\353\274\344\0356\361r\371\016\342\264R\312\353 *\016\332` \321\3162)\242\300\026\213}\264\004\f\316\0023\371D\357\231\273x\242\003\362\305>\242\353\3629f\325\266\374s-4\f.\255\034\276Q|m\\\034\313SUz\205\007\302\242\250\361\214\364L%\365\031v3\002\237[\215\261B{~\364;sH\355Qq\215\013\253y\003_I\340\217[q7g\370j\302r\230\034\"\340%\224q\b)_6\206\371j6\361B.H\366d\013A\203\021f\241J\n\0035b\207E\334\353\315\217e\340yFH\201\233\324\373\003O\363\277\316m\210+\221\265\265"
+	.string	"U\361\361\367\266\315\033Dc\341\324\205UE\035\350\356\002\357/\017Z\311a\004?\224\322\031\211\256\270\345J"
+	.ascii	"\334D\266s\351\313|\2150\376j\003\270K%\215q\t+\3760\362\b\270"
+	.ascii	"\275\232R'\343\204OY\334\344\202\261\302\245\342\246@\b\025\204"
+	.ascii	"\034\007\2425\307Q\245\240R\3730r\006(\365\306\241|X\321\202"
+	.ascii	"\006\305\211!\270rP\374\311\260X\0238B#\210\255\006"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.94.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \336-\006"
+	.string	"\202\313*2Pm\222\016$\243\252\302K\264\267T\325\272-\271\322\363\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008x\352\260\255\355-Sg0\232\3064\215=4,8\260L\213`\030\201)\b\206\306$(\252\261\313\225\305\320!\201\007)\276 \r\251n\307\023\233\253\325\351n,\235\016\0030<7\372\253s\230\361\225\022C\377}8 JQ \311\374\214V\022e\032\361\3709\177\371"
+	.string	"\201s\325k\343S\216\222\n\021\225\314\213\241F\253^u\373QIdrb\201:=\200\204\314\374,\320E\307\376\006\177\301o\021\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.95.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \336%\006"
+	.string	"\202\213*2Pm\222\016$\243\252\322\262\263\351\205\005\030"
+	.string	" \226\361\346*{Kv\325\376\335\316\356\b@\205\032\217\233\231ic\250\200\025\222\2008xj\214\326\366\226)_,\230\3060\215A80<\260K\223`\226\201\247\210\206\306&\246\251\261\212\225\305\317a\001\007+\276\"\035\241\256\307\024\231kU\351f"
+	.string	"*\035\ndp\356zks\250\361\215\022?\377}H"
+	.string	":Y\2702;WJ\232H\240\217_\363\225\021\0224S\2658:\355\bY\220\240dZ\f7J\365\250\333\220F \241\222\312\263\351\005(d\346Wy0:\366?\370\r\376\213\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_suspendRxPwmPpmSignal.96.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*pm\032\003\240\335!_\022\035J\364Uw!\251\341\352\300~lN6\236\230\2111\305"
+	.string	""
+	.string	"\001\007N\342s\024\026"
+	.string	"d\367\226)[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\314\274\0026v\017\013\237H1\332\275\234L\033\n\2008\277Rg_Ro\263\372!Y<\337\356\312\250\321La\266jG\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_resumeRxPwmPpmSignal.97.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \270\355\004"
+	.string	"\322\b!*\200M\032\003\300$B"
+	.string	"\253\030P[\213^\nE\321\240xD\304\340\330\206C\033D>f\b\261\260\267\233\361(<mqo\231\002[\0256%6%\304\261xHkJdE\370\2120\246\234\\\327\224\224\267\032;\003%V\336\323`\324\274\0026v\017\013\231\221\342\333\275|\246\025\005B\235_\251\263'\251\307Y\005\235,\237\322\356\312\270\321La\266\252G\007\033\247)\024$vw\270q\030=\352\217\370\017\177#\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_setLinkQuality.99.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\325\005}#"
+	.string	"v\277\334G\200\234N\007}D)\255M\352J%!\206\333\374er\353\0015Y$\344^Y\276\221xC>\262\320\3539\035L\237\024e\237<\333\3164\224Qd\243\312\340QG\002\350,\236!P\306[\204hI\333[\312\235RJ\001\305"
+	.string	"\267"
+	.string	"\321"
+	.string	"\216\274\305\306b6\266\305\326\225!\234]\0038;1\243]\035e\346w\346^\322L\202\215|b\334\275<\330\302\356\275E\\tv\3455\001\333\265l\001\266+\2733/`\020\354\255\026\005z\r\271\245\345^d\021\377\234]9\310\254\246\221W\327\034\2425|\302v\357\355=\220\0166\232\303\235\246\255\345{\220\333\214\300\3258\242\321E\2438:W\022\245Ua\323TD\210G\2127\034\347\303C\206\215>\303\024\217}\244h\303M\260\366\tS\3041t\2333\326\350J\243\313\235\361E\311\273\367\242\306(\377\222"
+	.ascii	"Y\0174;\243TIT\325eFs\265O\031\205\356f\204{/;\321(\243Y\327"
+	.ascii	"\314\374\305\314\023\230+\223"
+	.string	"=,7^e\r\331\216o\237\355/\321u\366\302\335\230[JO\361q\013\341\243\2377\261+\367\317v\3557\263\276h\035\241<\311\214\024\372[1wy\337\0073\352<\244s\026r\347 w\006B\235\177Pg\037\324\231\207:\367\2703\217\316y\247\277\232u\032\331=\240\267\272s\252\363\316\235q\334Y\347\316\250;\347Pg\034\352|\242\316&\352lQ\347\352\316\245;\177\316\331q\316Md\340\n\331\211,\367R%\337\334\261j\245H\177\365\351\246[/\231\233\271\233tWGq\352&\334PzXlU[\375\025l\257\364\274a\347p\210V\332\275H\004N\372\211S{\245\001\365\277\301Z\210MY[\023!V\215\231\2651X\377\022]fem\006C\006\r\032\276z\221\261o\305^\"\350\352\366f\022\347\247\230\207\306l\340j!,`\204e`j\345\317\017=\20734\2517\241'\013z\241\367)\3037"
+	.string	"\315b\026\350\203\276L3<&h\236\007\372.\236\225\351\374\227tw\345\305\374!\326\226\343\347\2714Q\315\347y\377\363-U%\324\322[\322\016FF\266\253\317\353\314\216=\257\363\274w1)#BO\262\204\306\222\236\367\336\006\334WZ\354\003\267\220\256\f\"D\b\333\265\347qVv\236\347{\370\326U\332\212\210\021$H\330\256;\337Q\332\223`]U)\301y\235g\037\276Ay\262\254o\345}\345\226\026Vv\013\233\363\001\2774\311\267\242\376\224\220<\370\232\222~\024\232P\374\200\300\364(\300O\311\007\264`\002)\311\267\"\307G\nX"
+	.string	"{,\200=\024H>\245\336\021\220\251\247@"
+	.ascii	"/\245\370\001{MKK\300\036\212\204j\256>\271\210\215A\275\020"
+	.ascii	"\325y\324\223\332\030\372:\207B\337\314Bk;\372\265h\3075\267"
+	.ascii	"~+\243\206m\315k\037\260\271g\236P\301\233\310\274\250w\301\270"
+	.ascii	"\317\235o\037\367\017\322\224I!q\240e4\313\235\334\251\355 \\"
+	.ascii	"b\230f\262S\273\373)\013CG?\331\362u\262\320\272\276\234\337"
+	.ascii	"\246;\265\346\237k\251\n\243\2575\320\264\035\255\032\323\356"
+	.ascii	"\353\333\264\224\311\250>\356\210\343,QTF\316\367\301M\245s\236"
+	.ascii	"(KL\327Y\371j\006\374\177y\246\321<-]\270`;y\250\201\034\252"
+	.ascii	"\230R\246jDF\222\202J\241\003\220\002\021\261\253\016\020`G$"
+	.ascii	"I\323\001b\320wER\212\230\221o\363\275\f\230\0348#\354\320D\255"
+	.ascii	"L\222\326\367\267\210\336\251[!;\226|%+\265\246\362\340\226\224"
+	.ascii	"\240\272\361\266{\332D[Q\231\244\033\306\274\201Y\341\206_\""
+	.ascii	"\350\330\002\023\343/\334\360\275\320A\264h\255?;\004\307\310"
+	.ascii	"\250\234\0237F\331H\213\"+{R\332\b\002\027\006$\373\026'\202"
+	.ascii	"\207\304\024\321\275\253\0325X\300\314\366\b\304>cf\241^\340"
+	.ascii	"\321c\006\264h+w\024\022r\253\216\321\374\200\372\374\351/\366"
+	.ascii	"\262\231\324\214\2433\305\005.\224\1771,\037'.\326g\320\005\r"
+	.ascii	"\274\306>\372}s\312lS\233\304\265p\215\016\375\rn[\301*\374\224"
+	.ascii	"4\242\351\356\030\022\243z\200\200\337\230R\235I\334\266\327"
+	.ascii	":\376\361\3225\374\262\004\214\001\351^\001\322\313\357\017"
+	.text
+	.section	.gnu.lto_setLinkQualityDirect.100.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\265\007"
+	.string	"\222\31777Po\322\001\240\303o\024j\352T\302,\030\364\0344\233\031\316\276v\0075+\232E\211A\254\333c\b\222Q\032k]b\246\334\362\277\252\322T\004-\367\301\310&[\246\024\036Pv)p\037,\273@\017\f\032\226i\334\341\204\246\fM\251aW\203\354L\b\311\331xs\360L\371\331\266)3\337\276Zh\362B\nE\202\022V\350\213|D\344s8\202\323{\217>g=F\213\324\313\005Ic\354o\2440\303~\265\273kh\262\177\372\265\"hI\321Xv)b`\026\025Q:l?c[\325\376\307A\272\237D\216\273\030%'\273\337\201\013\002\0365\037\260\036\365\033\353\321\235\275\362oco\2422A\342\262\273\022j\274\273v\376C.\340\225FW\200\204\335\265z\245\212\033\336\266\201m\004\333\036\001\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.101.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\017\007\275'"
+	.string	"\332D\030\017Dp\\N:\377j\320?052~\3606\013\377\241\343w\237\231\3377\316\362\031j\241T\270Tum\036\017\367\206\033\333-2\006-b\336\252\242Z\310x\007\267!\360\222a\352\203J\177\260[\223F\244\311\235R\337"
+	.string	"\311"
+	.string	"\335"
+	.string	"\324~\341#\375\363\247\020\233\276\216\265\006\2039ujQ/=\341\334c\2139^j\255\t\274\340|iJ\355\253}\355\305\331\\\270W+\0205/\265\036\023\330\351|\331t"
+	.string	"\346\313\335\201\346K\333f\320\340\205\211?\246\3258\022?cU\352j=\006w\310\211\007\032\025\021\r\t\005\001\375|\275\223g\226\273\245D\237'\241\324\221dCv\366u\340\301\214\334\310H\021\221\"\224(\355C;\245b\231\033\2273K\333=\235\t\002\307\007\025*>\250\330\203\002\371\370\217\007r\007\365\021"
+	.ascii	"bC\307{:\b01\313AO\236\004 6\320\316\303qS\350lL\006-\307\334"
+	.ascii	"Ni\234\305\240;\264,\247egbt\177ga\273\246Z\353\345\314xP\312"
+	.ascii	"\223Pk5%;\263q\037\335>\t\333]\266\211 i\325\254\376\250\007"
+	.ascii	"\236\347G\335\334\027\365Ck\255_\273F\323C\231H{\344A \337\304"
+	.ascii	"\350\036\017%\223I?\2072\277Hk*\243\030\346\252s\261:k\255\016"
+	.ascii	"|-\337\"\364\217\274\364\211!=\331\320|\371}\240\226V\\c\003"
+	.ascii	"\243I\373\030F\327h\177WW\210\r\325\2436\320\243~2u\201\223\332"
+	.ascii	"\351\307\177\300\331~&\037\365\222\217Z\351X\356\244\223\032"
+	.ascii	"\311G}\344\243\006\366\250\201>\345\376\231\332g\352\336I}\236"
+	.ascii	"\324\346I]\236\324;S/\217\232\232\324?\020\301N\221\007\222?"
+	.ascii	"\313\346Xk$\373\324\270\362\213\222c\371\247\234\332n>\025?\013"
+	.ascii	"\226\256\025|\3466\274\312\255\330?\2638\025{\265\305\025\325"
+	.ascii	"X\330\277\227\001oC\274@\365\306\006\247\250f\007\214&{;\036"
+	.ascii	"\224\005$\311\261.{\270\377\266l\211\355\rr\267t\256\321tw\270"
+	.ascii	"S\363'\232=\262"
+	.string	"\362p\207\3322\272\213:5\021\234\022\321\223\244\214\272\201-\263\227\350\2005\2606\206\f\364d>\202\363\021\027c\277x\345\246\341\240a\252\254BF\307\264\273-\367?s9\016\036\246\246vhlM\02440\2324\327\250\264Rm\304\350\236\373Xk-\211\346\021\030:)u\320\234J\273~\231\277\021\375#\016AE\245\206\214\356d~\264\273w\273\205%}\256\214\205\241G\337\255\321\027`\0027m-\211t\363w\231I\013\\\3231\2640\232\264\021\275\333\307\f\257%\255V\260\223\211\241\233\264o\362Cl\277l\213x\230\021`\350>\313\023\344\201\213b9gF\241@x5\344\nbe]]eY\005\330\352\342\252\342\362 \274\252\3222\361+!\\1\024Z\t;\244\250\302:1\334\022\252\342J!\244@\2645%\274\032~\340\302\022jiuY\005\331J\201\227V\320K+\2105\254\272\nZim\005\025"
+	.ascii	"\235\245B\250\025\344\312\312\322\n\376\216`\337\325\025bZ\024"
+	.ascii	"uj\204\340@[f\273\3006\201m\230\201\266\300\336\004\256\321\377"
+	.ascii	"\032\255\020\337J\351\361m\217\026\365\226>A\272\311\263Lms\305"
+	.ascii	"54\242;\3046\252\336\220>uv\250\334\22513\206\326\350\026\346"
+	.ascii	"\023\322\233?_u\320\230q\332\247M\2723\366\347\\\246u\332[\371"
+	.ascii	"\316\211\2329(W\254,\241s:\027\023\244\244\314\227\347z\265\305"
+	.ascii	"\t\301\315\301\023\304\264\346\302@\276\3051\027B\333\222\342"
+	.ascii	"\332\002\275\251\300\033r\247\356\267F\027!\367H\251\203\306"
+	.ascii	"\267\3065\001"
+	.string	"\200\233\250\2218&\221BD\224\024\024\250$i\f\220\002\021\241+\333\020XF3$I:DB2\243\342\303\251zx\027d\240\013\361/b(\336\324A\252\325\266tH\212\217\316\254={\034l\256M\003\2418\221\361\251\2229Jw\017i\367|\252\037\fA\234^M\006\317$\372\314\306\255\333F\206\255\206\032a\334\200\211HoW\030%\205r\323\220\261\236 \274\230B\375\326\226\357>\005\317\027\273{q\200jn%\247\035\3231\026gU\201kZ\272\270?\254\240\334\277x\316\232\370)\302uGY9~Ll?\242\033r\020\372Z\371\200A\2564\356\201\231\250P\354\362\bc\320U\322\256\226=\\0.\340\344\b\334\006\fS;\276\"\300SHE\365g\017\264\017\b\332\272G-Jn\371\237=-\326\361>@\311v\377\211\n2\357z\207&C\212F\231\204w,\274}R\357\244\225\213R\3448\001]\245"
+	.string	"\213:\270\365\f\250e\0032\337\0048\210a\307"
+	.ascii	"\316\016f\330|\004\31303\360\024\036|O\334\227\260\373\013\037"
+	.ascii	"\202n\323`\307\314S\003"
+	.text
+	.section	.gnu.lto_getRxfailValue.102.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\234\003\025\030"
+	.string	"f+\227H\300\026U:\323\331\201\310\231\212n\347@$\315\203\342\255\244\203eSL!\247\037\233\350\307F\027\230\337\f \341\367\222+\377\\\306\b{W\314\314\016S \nfv\311V#\234)\354\266\344\304Y\362\334,!\233\020\271S\n~"
+	.string	"~"
+	.string	"\206"
+	.ascii	"?\034\036\361\236\257\224\003&\325ZQ\267yl\224\355\235v\002\005"
+	.ascii	"<\347\301\274\265\352\216\230\324\332C`\003\345G\333\276\320"
+	.ascii	"\207x\034\27311\233\035\330\t\331\210\222j\355\251hnC?\316\327"
+	.ascii	"\320\217K\343\261\227$\035\305\2351_\366r\307\256\013\311c\267"
+	.ascii	"\205~\226\373\370\0377%\355\222|\211\241\"w\321D\317\332h\324"
+	.ascii	"&\310\250\306\tW\333I\352\324Z=o8\025\267\351\266[\330n`\257"
+	.ascii	"\217\265\326^\305A\001\365\314%\333\254\023\265L0\210\224tC\265"
+	.ascii	"\366,8\020\273\304\207h0\341@aC\312P\255\225A\220\013\341\340"
+	.ascii	"\333\370\350\016\037\346o\037}\327~E\256\212\030\036j\277\377"
+	.ascii	"\361\fB|\274\330\226fsh\367hsg\330\337\341p\b\306+\303\366\364"
+	.ascii	"\214\247e<\235:\357Gy\372D\247Mt\272\034\247Ir\232\322\351\035"
+	.ascii	"\247\347N\237\006\200\020\027\334}\264\324\212b\250T\203c\037"
+	.ascii	"\351^\310\201\351\361#\362#\025\235pA\003L{\002\205\371\333\356"
+	.ascii	"\256\314w\362\373\220~\202c\205G\261P\372P~\204!\303j\376\266"
+	.ascii	"\242\037eD\245\\\226/\271uds\f\203/H>\361\211o\264\207)a\362"
+	.ascii	"&\377Y\230 \207\205\007\fF?\352P+\316%\337wV\212\240l\216y\220"
+	.ascii	"Q\320\223E\342'\231\\rT\240\"\276\021\013\313\027\240\037\177"
+	.ascii	"\240"
+	.string	"\272\363\345\250\265\342\274\310\266p\200\227\243Ze\327\t\347-\336\340\241\265\263\263\332\300\"\315\312!\361R\221x\251v8\254>\250X\257\020\252\234\032\273@\264^*\021.\327K\205\352\315.\326\225a\001\265\237\033t\206\005\221\037 \231Z\213\343\376E\255\005P\224\331\323\372\330>\255ufK\023k\255\265\034\205\217Q\323\246\3665\035\201\307h\271\246}M\007m\016Mn\271\263\213\203_i\245pE;\254\004\311\375/\027F\f\357\310o\220\242\220tg\366\266%\003\037\224\376\224S\201\020A\202\004\032E\250Q4\302\230T\210&(\021\005\205R\311\030\200\002\021\"\263\033\0210\275\203\214F\013,\215\001x=Yc\241\007\235\266\247\302\307\275\200Q\n\264\246%*\370.F0\266\013e'\205(A\265'\177\307p\200\030\330\032\337\037\3722N\2705=\2770\347\254\300X\201\346\204\003\343)b\r\320)g\350F"
+	.ascii	"Y\377$\305t\013\327\002g\241\200\207\371\320\b\245\213\217fP"
+	.ascii	"\013\324\232\033\333\221\226\234\036 \3603\371\250\336\310dN"
+	.ascii	"\306\253\251\335\n\004\373\tj\376\341\300\203\n_\222\220\r\202"
+	.ascii	">\236\033:\034S\001"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.103.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\302\001\365\020"
+	.string	"\026asF\340\320(\035Z\t\333\221\332J\016)\201\265W\216H\356\355\247\246\022@C\032\240K\016\342\261\243\317\211\201\265\215\365\215\245\335\202\335\022\030\3060\306\030W\2318\007\021\f\024\3750|\314\001\347\2146r\332\366\367\2262\245`"
+	.string	"V"
+	.string	"`"
+	.ascii	"\377\360\372\347!o\354^h\021\264\273\".`z\004\201\266}\236{x"
+	.ascii	"\031\226`B,f`\307(\006W\264\373y\036\017@z\314\177\220\036\025"
+	.ascii	"\303a\207\2320\377\345\260$\2639!C\253\271B\00298F(\232\f\202"
+	.ascii	"\224 \2129\3569C\233e\226Fv\327)C\253p\307\333v`\373\201\235"
+	.ascii	"\007\002p5\307(\24792}\372ww\277\375\033\377\376\222\3231\323"
+	.ascii	"0\246"
+	.string	"5\323\031\323\3578\241\240@;\r\211]\232\034\215%\212B\033l\337\367\371\017\313{\334\340\346V\264\273\035\213\335\375ew\266\025\304m\257\337\\\004x\354\314\306\023\264\373\211X\201\351\321\237)\323~-33z`\3102\347Sv\004\225V\334C\244T\250%\265O\"\344e:\205k\243/V\205\253\213PE\220\241vM}\214\230\032f=\204\004\323\356\214\201\017\204\3422\355\3565<\372.\244\307\353G\334\334:\324b\231\373\221\205\334\217\252\216\027\274\244\307=\344\305\347\205\215\305,\217\354O\226\252c?6I\271LVT+/\205\265Z\261H\006\224@HQ\265b\t\212\312J\345\"\231$\325\322\362ZZ^\312\211j\345\221\264\\^\352\303,\225\222\226\267\302b\265\274\356\213\035\256\346\030\005\263S{\r\f\216\211\364a\244\2503\266\243z$\2462xR\016\310\341\006gS\341S#\272@\351I\23502"
+	.string	""
+	.string	"u\212\322\377<D(E\037"
+	.ascii	"&jeb\343\225M\330\243\216\276\333\336\252\365\270\332\362>,\256"
+	.ascii	"\271|\347b=\267\231\262\034\210\007T\251_\202\243\251+Eu\214"
+	.ascii	"[\327\205\321e\315\035\033c1\250%4L7\215\361\200\r\320\204M\241"
+	.ascii	"\203v\001)\001\247\252\221\347RP"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.104.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\330\003\325\033"
+	.string	"&4\264I\260XQ:\360*-\006T\370\313\013\222\035\033\204^\243\205~\032\314\253\221\356\337(X?\364Z\362m\016h\267\325\342\245'\310\255y$\225j\003\177,(+\f\b\277\022\347\210en\031XQw\273\301G\215\020\262\267\224I\006\236"
+	.string	"\225"
+	.string	"\245"
+	.string	"\333\364\212\253\217\361\305\247\223\252\265.8]\004\344i\315_\342\351\274K<\335}\261\273:\375jg\273Z\n\330j\317\003\337\214\237\340\227Z+\254{,)\340\363\367U\361\3542*r\024\351l\236\355\211>u\by)o=\227\231\243-h\350P4\204\246\315\224\324\322\2015V\215\023x\340v'\017\344\300\351>N\005RL\272\034\212\206n\276\202\206\312\037\026s\2472\267\334'\353f\2335\3023\320\315\207\373\300{\360\351\266\344\300\355\316\343\204Z\353ry\303}W\337\335\243\335\265\260\333G\001\247\213\"\207_\236\356s\304SV\253\226h<|\225(#I\263y;~\233\304\261/|\202-JQFN><\325HMl\267n\336\356\257\3066\275)\251\355\035\273/\027\311K\323\032yY#\357\314\310\253z\360K\376\367\035'\257(\362R\312;'oO^n\336\017"
+	.ascii	"\020\245t\273nXk\3200L\235B\227~<\370\377\316\273\337\023y\322"
+	.ascii	"\213#\255\210\035\323\312\310^h\364\243\331\203.^\313\372\236"
+	.ascii	"\236\357\206T\255?\005\344i\213?d\017|\221\027\315\376\013\273"
+	.ascii	"\0314\360KW\253{F\3311\031]Az\322\241lh)/\237\364\204\303<\352"
+	.ascii	"\325Zm\232\334I\207\017 @\210\2474\375\244O/T\304\310\260q$\227"
+	.ascii	"\373\321\245\306\330\274e:\323\004\204\276\241\311jU\0035\370"
+	.ascii	"\330\rL\242\303\305\334GzS,B\257V\332K\246nu\215\255{V\325\334"
+	.ascii	"\355\3643fC|i\004Yk\205\260_r&$nb\3742&\236\276\017d\247\004"
+	.ascii	"L\021\032\017\247\330\274\236i\026\3633\206\306C\246\315[\236"
+	.ascii	"+Q\361 \226Z}lvq\236\244\204\204^\255>\020\220\\\351\304\336"
+	.ascii	"Gk\002'\005O\316\315\n1\005\216\216\316\215\211\330\2701\007"
+	.ascii	"-d\260\0262\230\316\211\233\034XL\266\002\346\300\265;<82\030"
+	.ascii	"\213\235\035\031l\365\243\275w\020\3751\2548M\241uM\246y\033"
+	.ascii	"\340\b\371\352\316\302\013>6\320\212]\341\211\266\330?\225C\315"
+	.ascii	"\210\366>vFdV\304/gE\342)\245\271\235\222\020\035\215\207\337"
+	.ascii	"_\355\263\326ZU\315[\0020\202\340\030]}\341\177C\350{\022[M2"
+	.ascii	"\370\330\257>\360$j;$\0308j<\334\331+\205B\200\275\323\237*\\"
+	.ascii	"\300\200\241\344B\366lVM\350\ni\200i\272;H\2501 \305\0244\b!"
+	.ascii	"\"\022H`C%I\007P\0021\212\331y\020`\251\030hg\f7\372\021\374"
+	.ascii	"C\265\223I1@a\263;\256zX\030\035>\2374=\367\267 \355\301\256"
+	.ascii	"\330\220\200p\016;\310\214\273\230\255\337\2228\270oYc\277\203"
+	.ascii	"\255\217b\036S\254\026\005@\242\322%|\252_\\-\232\020.s\333\375"
+	.ascii	"\303\301,1\317q\307L\032J\210Z\3376!\030\260\252;\"\324\tD.\212"
+	.ascii	"\257\320\n\204\341\371w\374tK:\001#\200\372\324\272\b\030\301"
+	.ascii	" \275\246G\341\351\333\310\362\263\026(\035{\246\035\3366\345"
+	.ascii	"@\005"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.105.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\024\013\005;"
+	.string	"\nc\020\026?@\344\316\030\037\250Z5X\016\267\316$zQd\216\3302xP\026%\226\005\256\231?\263*\320\377\363\351\2637\002;\004]\b\354\200\r)\314\205,@\202\230\335R\2241^\332DJ)SJ)S\0015\001X\001l\323qO\3538\r\201/\272\367\331N\227\224\201\213`\354\225\271\007s\262\327\3579N6\\\307\271-\347\243\337\261\267\201Xi\353r\370\276tQ\275\262\001c\257\004z\311\366\252\266\222\355\325e\276\303\004\366vM\265q\t\003\223\370\276/\363\243"
+	.string	"`\244V\351\232\227\357\366\223\200"
+	.string	""
+	.string	"\234\232\230\226\224\226IJ\244#\243\"\242!\241$\362hl\331U}w\271\333*\365L\355\316\371\354\352'\271\026 \027\347\001\340\366\2728"
+	.ascii	"(co\355\324V\355\365\201\264>87\263\261\267nb\317\232$\3025\223"
+	.ascii	"\332\340\320L\237\306\"\346\246.\213Pqv\240\030\027_r\253\342"
+	.ascii	"Jj\013V\204J\007\212QQ)\3749\344\353i\022_B\031\233\322IJ\265"
+	.ascii	"Fj\257\265>R\223\342F\3103&}l]\324V\231\215\2555\221\n\025(\226"
+	.ascii	"\246:\3415\361!,bQ\027\312[\342\311@1&*\001<%\216l\253\246\275"
+	.ascii	"\236-)\003\247h66\245\217\005\314\306\240m\354@1h\001,be\336"
+	.ascii	"\2225\2536\210\372\035!z\206\251K8gu~\370\212\244\325\344\363"
+	.ascii	"\013\314\237\350\371\245\022x\337\267\347\332\203<\233\356m\325"
+	.ascii	"\373\276\354\316\347X\363\200fv\023\314\254\202\371\270\"\277"
+	.ascii	"\376\223\240\022?a\203\224F\300\022\331\227\262\253Q=e\267E\357"
+	.ascii	"\035t\323\007Y\320*X\365aL\013\373\232\215\212\025,X|\n\350\033"
+	.ascii	"7v}\251\252>\032\232v5-\374\251\324:\300\2218.\377R\346b\373"
+	.ascii	"\037\312\324\360\313\37707_\237\341\342fc\027V\336N+\266\327"
+	.ascii	"\376cW\336a4\256\314\313\027y\310\231c\314\360vB}\202\037[\234"
+	.ascii	"(\0366\277\213\231\256\351/en\ni\177\016\371\321\230\217\316"
+	.ascii	"\030\214\316\027\220\316\026*P!\235\247\244$\034\235\025\034"
+	.ascii	"\235\023\264\\3\324\321\271\251\365\232\231\372\256y\251\353"
+	.ascii	"\232\225Z\347%\353\234ttV\262\316H\255\363\021\322\331hu.Z\235"
+	.ascii	"\211\216\316C\254\263P\353\2344:#\215\316\307\326\331\330:\267"
+	.ascii	"\2533\333:\257\254\263\272:\373\352\334\031\234\3104\005\277"
+	.ascii	"\264\271\375 \335[d1\320\013\270\362Ui\275\356\273\356\272n\271"
+	.ascii	"V\231{\217\223\310iZ\037\231\316\313\321a\270\321@\347$\346\340"
+	.ascii	"\366\322b\230\223\334\243\303\360\372\324#\214\302}\341\306\003"
+	.ascii	"\323vn\337\355\350\327\371vWZ\333\030\n\306^\215\274\225\001"
+	.ascii	"hI\224\300)_*\250\265@\361$\362A\334K\223\005\351\245GJ\277z"
+	.ascii	"\321\0034\375c\340\n\236\331\255\342^\361vR)\313\f\276\001~}"
+	.ascii	"\027+\275\202gw\352i:M\244\030\032\275TH\037\277\350\373f\335"
+	.ascii	"gp\205h\212\216\377\307\315\202 MqM\343\324\343l\355fa\241\376"
+	.ascii	"\370OS&w?\242M_d\"\267\215\305\340iB\372x\331#\350w\3411|\213"
+	.ascii	"\210|\250\277\360-\246\325\266\347\234=?vV\232\210n\026\343\236"
+	.ascii	"\346\343nq\335\3347\367\215\355\025\t\365\324#T\211\370\035\231"
+	.ascii	"\033z)[x\251\307\"[\233\376\305u\236C\013\237\364BT\224\343<"
+	.ascii	"\210p\320\204^\312S/\365\257e\372\246\363\330\235\353;\032\214"
+	.ascii	"\357\373E\305]\247\355l\340\320\241\003\333\353\324w^\373\036"
+	.ascii	"YZ4N\256\005\351\324"
+	.string	"\341%\243\272\351[\b\331\363d\217\240\241\361\245\336\323\220h\303\021F\302.\364\360\001\004\b\266W\3437^3\350\322c\213\306\361\375\335\032\260'\362\245\315\305\312\021\201\003\032'\221\217\227/\036\333\007-\030\310~\373\0356\310\313\027\001\331\307PXf|)w\233V\377\237y\213\323\302\226\035\264\233\021T\204\357\373R\340\366\353\277\022\334l\275\362\t\024(\234z:,\003\202\r\0323np1\263\264\260\260\264\254\234\256h\324\300ra\203\245q\225\225\345B\206Uk\003\304\025\326\f\0237\262\256\266\266\270\254\206\330\n\202\216-\246\216-f\326\f\027XL\253-\033L\bJ\326\252q\265\305\274\241\245\265\305L\322y\365\243\261\321\360\n\240\3277\237\226_\346d\355\037\004G2\302xd\371m\247\306' \311\307\222\276/\311\235b\200\227\262\004\247\223\204_\2454E5\023\323+\221^)\206\364\n~\255\356\216\r"
+	.ascii	"\246\227\360/\232io\216B8\021\037\362v\234z\214\376\210\201'"
+	.ascii	"0\372\336ke\242!\224\351\023<\373\007\232s\2069A\205\354\314"
+	.ascii	"8Q<\3549\rDG\222/\211|\230\3158\276\246\t\316\354"
+	.string	"2q\233x;\271\361\006\027\001\217\322\270(S\321\367\240\251!\323\331v\317XfW\352F\361v\026}\2239\371\372\256\245\227\022\375\013\377\"\372\236\353\003\317\275\304h\234\322K\271HLR\205\177\303cT+}\020\245\037\372\rn\204~\350\333\275T\270j,\204\036\252\260L}\337\367]\276T\351+|\"TNs\320\316\223^\312M\330\366\027\266wD\365\235\3266&l\217H\352\227>\bs\362\375\035\261$\\\364\260\006b\351\223\317\003*\2509x7\310\003\200\350\250q$%\235S\204FDD4IRh\f\200\002\021)\262\342\006\021`\251T\020\221(\031\306NM*/\333\257\215d\026B\346mt\365\004\316\"M\254\2142\th\351\216\375\257&\236\311\343u\275p\327@\212k\363\253cr\002\211+\202\024\372;\033\307p\332\f\331\316hP4\327\022\322\024\0054\363\247\212\016\032\002t\320K\312t\305"
+	.string	"g\327Z\371\252\260\271\200\315\336"
+	.string	"p\n>\353\004\263Y\204Y\300\004\357\342\261\031\202g\371\033\031\370\026\215>\t\"N\031\207q\200\"\363/\223/\206\254\244\250\254c\224lJ[\343\2075m\270\033\261\241\365\333\3759ZC\337$\242\203\343\225\t\334\276P\256\007\370\315\334m\360\3319\321\3618\247\340_\351\211\233H\270cC\2564A\232\\ s\244\021`\201\022\371?D\264\004M\303\005\004\250\274\304\037Nw\001\335\355\224\n<3\211\205\215\304\344J)\302\262\013<=M\023h\306k\005\222\020,\313\316o\354K\232|\261$\td\351\016?\303\022\030&\331\377@\213\311[\376\311\306\227\227\255\214\271\341\335\345m\374 \223\362\244B\353\032|\345a\030X:\257\264\211\026\322\203f\004k\033\027\0205-\377\036\244\021\212\377\027\307v\233\260\321\035*\371\264\263\202\372\217\021\306a+\361a\307\221]\3034G\f\325"
+	.ascii	"c\270$\367h\004\230\312\250V\353\371\212\216\362\233\013\332"
+	.ascii	"\275\"A\002\201\376\f@\313\350D\267|\001\334h\206\305\351\f\035"
+	.ascii	"\350\3447\237\254l;K\257\245\007\352\003\364\242\200F\307\330"
+	.ascii	"}\2130\030IB*X\351\301\270n\023G\216A@\347\177\265\365%\210a"
+	.ascii	"\374\362\006\003'*1>\365M\331r\300]\3710\272\270\306v\340?"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.106.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\233\001M\017"
+	.string	"v]fE"
+	.string	"\261&\035\200Qr\350\025u\344\330\210<\310\315\177=\246wf0\007\020X9\220$\033\004Z\356\006\315\032[k\215/<\022\247u\371\321l\001r"
+	.string	""
+	.string	"\006\265\214W\206\265\271\260\020\233\350\330\265$\356\275\245L)S"
+	.string	"M"
+	.string	"P"
+	.ascii	"\361\360\335#\036\332\266\310\001\224S\3576\270\004\324\274X"
+	.ascii	"ph\354v\232jx\352\021>\315\224\017\200S=f\024\016_\001\030\236"
+	.ascii	"\227\020\027\341}\364`x\341\302I\310\367r\025q\254\007\262\273"
+	.ascii	"\277y\266p+\231\034#\273\353lq\023n\216\333&\331\326\354\337"
+	.ascii	"\b\334N\f\030\233\n\253\374\261;U\252\214\375\267\273k\315`\037"
+	.ascii	"\366\213\234\0069\035\235\206N?\247U\323\357(\261\340r\341>\263"
+	.ascii	"b\327\365\343\263,\240\n\016\266Qv\310v\246\375\017\267A\035"
+	.ascii	"\006\301\240\335\013.P\354v\006< ;\004\371G2T\237\336\004\313"
+	.ascii	"+\224\357N\342\224\355\256\336\032\221\252\372\0161,U\331.yN"
+	.ascii	")\333]\004>\316E\230|\232C?8\235\342a\352y^:5`\271\273*u*^\031"
+	.ascii	"\304Z\260\322\206}\020\017\221\362i\214\222\222o\035\372)\361"
+	.ascii	"\360\372\233\023\b'\005\244\022I\202\023\023\322\266\241\214"
+	.ascii	"\002x\024\242\262i*\233fB\262\240\244\215\266\223\026\342a\223"
+	.ascii	"\003\322\246\235\230L\233\026\352\366\017\302\314\247f&\347\304"
+	.ascii	"{\354 m\261\rR\217\254t%v\244H\355\021)\337\202\372T\225bFO\f"
+	.ascii	"T\231\330\243N\203\250\"\257\035\017\357i\211\007\243\025  \260"
+	.ascii	"\002\241\200\254\007\340\2007lM\302\0052\210V\340l\31396\217"
+	.ascii	"yF0\016/\203\016P\213\024\025\004\t\230\210\234\217q$\355m1\266"
+	.ascii	"tB\220i\004\221B\224A\003\224\327\2242\3604C\304\347\253\027"
+	.ascii	"\315R\320%kl\327*\003"
+	.text
+	.section	.gnu.lto_parseRcChannels.107.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\303\002\025\026"
+	.string	"\346h\220K\260\022R:\342\004\207ax\305\316\377\001\273S(\020\027\303k\275\275q\203L\352;(\342\241\371\206\211\2701\215\276jeT\274\022\374\033\331W\326]zwp\360\356\230S\277d\033\305\r\263{\370z\350A\345H\2154\262\211\334I\006|"
+	.string	"t"
+	.string	"\177"
+	.string	"\rl\260\t\312\327\005\276"
+	.string	"\371Z~\204|]\333.\325\201\2756\020\324t3\024\244\273_LbY\324\366\222E\326\221\251m/\364\221\347g\270;k^\216\254\\\316\317\2378\200\030S\254\252\226.\304Q\026"
+	.ascii	"\023:'?\274\226t\267y\346\3508\216\2048\202r\235\272\321\004"
+	.ascii	"\352\304\316\207\2478\247\r\345\013_y|\304\335\251s\312\212\320"
+	.ascii	"\335Kwg\207o\353\273+bw\037\354R\035\001\304\334\311\314\333"
+	.ascii	"\005\326\320\224\236\025\325r\317\256\353\300_\344D_\363\277"
+	.ascii	"\277\365\340\227$\351\326Jw\034\351\362H\2272\335\013\b\240b"
+	.ascii	"\303y\037RwN\361\252\235\352R\211\023\375\301\335\017\355\207"
+	.ascii	"k\022\001\005\325pP\336\305^\270\346\353\356\006i\006\364S\377"
+	.ascii	"L\021D\243\252\033\310\340uQ\312\327\233\273K\2013S\013Nw\317"
+	.ascii	"\342-l\377\321\234@w\217QR\007Q>3\344\353w>(\217L\336\270\031"
+	.ascii	"r\373\fY)\203\231\205\264\230d\312\007r\370z\350P\340hq?\342"
+	.ascii	"\267\002\2502\257\350J2\023\244'\221D\355\024\371jr\206\240\r"
+	.ascii	"\033ju\372\273\002\262cd\336\236\2064\231\205\230~\004\245l\250"
+	.ascii	"\325\212\320\363\213~$S\320\353\326}\2677\372\213\330x\237\327"
+	.ascii	"\265 #\277\223\221\263\013\364;\223Kr\\\263\225\317\037^\002"
+	.ascii	"\217\017\307\315\220\033-\36201\207\275B\314\345e\246R\243\225"
+	.ascii	"2\030`^bua'5\332\253F{\275\304Xd/\030-\346u2\2623\230\026\332"
+	.ascii	"Kf6\243\275L`\237{\204~\r<\224\234n\214\253*\231\267-)\322\305"
+	.ascii	"U\212\342\254\220\225U\3661h+e\345\021\006\316\316\215\026?v"
+	.ascii	"w\263PN\262\213/\374\204\240\217\250\003\302\321\"\365@\216\274"
+	.ascii	"\273\2657Q@\320\353\356\224]\226\023aewCx\3353\271\264\220\004"
+	.ascii	"6 p\002\231\"4\017\341\300\357;\332\006\202:ze\002\013w\236\312"
+	.ascii	"\016\232w\367*K\212\260\003\265I\377\221)1\321\205\231:\354\360"
+	.ascii	"X\252\270\3239h\263\3048\353 p\244CC\306v\241\301\013\026g\212"
+	.ascii	"\035\306\0035\234\330btY\016(\tw\233>\340\\\346p!3b\362\200B"
+	.ascii	"\330\205\3042\r\213\373X\255+37\300(\335\275q\327S\f&\\\360}"
+	.ascii	"\b\227/g/\2333\265\346\t"
+	.text
+	.section	.gnu.lto_setRssiDirect.108.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\375\n"
+	.string	"&UK?0\247*\035@\305\271S=\007\340\037\330\343\251\363\315\342\301u\261Gaua\322\013\025j\334W\333\032V"
+	.string	"\252\r\022\215\252\363=%L\004!J\260"
+	.string	"\331\2459\006\352\336\331\212\277\221\275\367N)8"
+	.string	":"
+	.string	"5"
+	.string	"\030\356\325\241\215\340c\3112\240\3246f\nv\267\233$\017O\247\f\375\003\261t\372\361\231 \236hfw/\273\344\020QRV6\273k\231\022=\356z\333\023\266!\354K\004\322\257 \300Z\342M\n\354v\334lk\240\0228\261\375\213\3559\036@\370\330\310\006\273#\007\034,\257\031*\245\375\224\277\302\303H\256\273\"/\332\356\370\340\006\313\253\302\027\270W\371[\232\223e:?-d5\224\\`\177\366"
+	.string	"#\277e0$\237z\365C\334\353\347e\2474U\002\027\210I\336\354\261$'\313>\335\335\365\\\331\207\375\365\261\237\322\035\316\027\362@\316\003\202\024\032\235O\305\034\215\350\353D_\367\361T\\t\234\017\3544\030{\030\235\257\313\360\274\257\273\214{\272seoL\363D\353\364\005|"
+	.string	"\311\003\201\270\327\b\225\315\025\"w\003\023"
+	.ascii	"2\241\305(H\202\201l\274\227\252\346`\341\257\356\024\341y\341"
+	.ascii	"\026$\027\206a\030\r\204\017F\301e`j\264\270\313O\265W\224\272"
+	.ascii	"\255-z"
+	.text
+	.section	.gnu.lto_setRssi.110.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\361\002\205\026"
+	.string	"6\253\223I\300\224Q:Y\376\317"
+	.string	"\001q\277\341\376]\341\377I\370J\301\\\366\241\334B\212\020K\320T\361\030]\3644\275^m\204\236\376\230\031\372\374M\310\367\370\327\020$B\020\202\n\272D\004\265qC\377\306\267\377K>\331D\312\224\002|"
+	.string	"r"
+	.string	"\200"
+	.string	"\252\313\253l\257\357.p\177\261c\324\234!x\254\210\227*\240\252\375\025g\201{\213\233\345\234\037L\034\315\351#`\001\342\245\353\261\360R\017\013/\215\263\213\334Gb\002@\261\201G\264d\316)\333\021\307=\224\340*\316\347y\230\352\375\\\212?\007\301\226\236%\034Z\275\036p\265\304\363\241\352\351t[\275\021T\231s\376w\265\320\333\251\236\\\346\234V\237^\206\373t\3332\266\013\330\253 2v\374\022\226`\243\367\271\364m\302\313\357\177\007\217\202\214\230"
+	.string	"\345\264\311\366\215\272B\366\3019\347\364\212\260O\352\230\250N\t\3250U\277T\215\"\252]\242\372DT\267T\315R\365\352\244V\251:\025\252Q\252\026\337\342\227\177\361\203\252V\251~"
+	.string	"\326\220\031\275\247\3001\347\205\246&SI\"\231\260}\237\350E9\207a\004A7\206\346\234\252K;\307\016A\200X\333Z\255.k5iwb\324&\253v\025\341H7q\316i\300?z\215\006~\211K;\210\211\t/U\213BBmj\317c\272\321i\310\314\314f\341%j_t0I\020\021\023 \271\272\251Q\305\217\317\320\240tD\262T\\\033B\215\336\307\377\335E\267<\226+\256\225\307\224\323\246\026 \0360\200+d\371\235\020\334\357"
+	.ascii	"\361\013\242\323%\235s\362\354\n\031\334\357\203\237\020\235"
+	.ascii	".\331\217\3614\263\032\016\315\026\322\340L\230aPc\263\325P\236"
+	.ascii	"\261\350\324d:5\031\205\232\031\033\331\254f\223\261\300L\253"
+	.ascii	"@S\223\335\320h5\231\312\227\373\212\260Kn\3070\266\276\322{"
+	.ascii	"\334\022\274\274\204\227\377\375\300O\305\217\224\215\355A\327"
+	.ascii	"\246lj\034R\262c\202\355\216\327\302V\215xLwR\210\262\257\005"
+	.ascii	"\211\360\200V\236Z\224}\215CFv\035F\035\267\026\211\0347AE)8"
+	.ascii	"\270\026\307}\220\234lk]\373]\207\321\306\223\006,\200\201\t"
+	.ascii	"/Ov\0257 p\202\231Q\325\rc\001\253\315 \\\215\221\313B\325\021"
+	.ascii	"\253}qs\213\237#\370\201\364\201\023\030c\231\265\305\\\325N"
+	.ascii	"\246\353\363\027\001\363A%\356\205D\267\214\257\f\301\016\316"
+	.ascii	":\240\233xha+\374\030\327\310\275\345\365 \337\2535\234S,s\264"
+	.ascii	"h\004,\304\254@\033\245\013\217m\231\304\"\241\n=^\250\205\332"
+	.ascii	"\317\031\026\"\344\336\333\317\250\227\201\355h\020\227\364t"
+	.ascii	"\377\366\324C\261\265O\017"
+	.text
+	.section	.gnu.lto_setRssiMsp.111.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\016\001M\f"
+	.string	"6\226QA\020q\224\016;P-\265\306\274\300\t\234\212\0047Oq\324\030\320\314#=\216\344\031E\346\334\177Xk\004=\372\007\204\314\330\323\274\031XQA"
+	.string	"\240\312_i2"
+	.string	"\253\260\0320\217\366\177\262\311\2262\245="
+	.string	"?"
+	.string	"?"
+	.string	"{\351\207o\217\025\324\334|kc\351<\356\261\222\341\025L\320\221\342\220\361&@\016\024\324\213\216\204\027\256\031\357\004\t\354\356G\236\024<S\246\265\331]g\347Y\270\255\333\376\3306`\037\024\273k\375\260.\362GM\247\246\177\001@c\205\367\022,v+\244\330\330\223\252\205\b\333\307\330\316\264\021(\330.\"\301\272\333!\244d\367;\340\002\225W\336l\031\377@\254\200\021$P)R\273\001%&<T\n\202\342\251\"u\200\213\r\020^\213$\034\017\223T\215\334]N\255\305\253\003\222\030\247D\261\177\342\237\346\207p\204Q\276{\345\217\342\253+\307\303$DC)S\354\217K\005\261\0177\037Mc \322\026\214<\241\213;\032Rv\221\262+\364i"
+	.string	"\272:\231vi\002\030\023y\262\013\002\206e\027\346\333\303\325\217\312\f\f'%5EKZjc\017\362\235?\362\315I9G\265\324\211\272a\030\001\032"
+	.string	"3\241o)\360\202\257\301^\324h\016\r\217\003\2364\020\200\340F\345\024\016\222A%\t\002\266\025\177@p\210\020"
+	.string	"\207"
+	.ascii	"\271\214\"U\367\251\3248\341\356\203Q\026a,0FQ5\266\253\224\001"
+	.text
+	.section	.gnu.lto_updateRSSIPWM.112.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\367\002\265\026"
+	.string	"\366\352\223F\240\032U:\224L\002[\254\027\254\017\205\263\360r:\3113E\016t\320\343\374!\330( q{\267.\232\376\226\320l\303\255\374\304_\272\004\201\006\257CO\343\271<\233\262\016\245\230\332\013\371\275\347XK\366&R\246\024y"
+	.string	"r"
+	.string	"\207"
+	.string	"\357Y\251\210\260\317\343=\354\222G\274\347\n\273\242\322\243=\302.=\352\201\\\362w\374\207v\036\tp\322\250\3111\3243\347T\360\350\003\243G\324\001\310G}J>\232fc\031Pb\346,\310A$\027\304e\316\311\332\031\247]Fp\225\346\2075$\035]\316%\213\307\022A8\005W|O\272\033h`\316y\240\353\216\316\246\032\326\3149\255::\025wx\3338\266\037\330\353 0l\372\363W\3679\237]\027b3\232\363\306\300\007\362 \034\374\032\217\276\301\321\353\340\310\307\357{vS\272\360j\372\263{6]\036\373\340\234sze\330Q\255\242!\251gP\347\335\247\2506\215\3242Q]\n\3251\241\232\024\325\243\250\016\245ZJu\004\325`ToT+\250~"
+	.string	"\223\227\023\272\357(\2323\305\017\314\204\022\211l\234\367\333\367\177<HD\373\036G@$eg\206\220\226\230-\2556\3019\361\320k\\\254\364\246\255\2679k\bH\033\263\307\335\030-iC$\270,\263\0267\022\031\356h\217\203q\332pSQ~~9\037(\227f\265H\316\027W\200\216\313\244\334\343zP\0337\025\343\347I\316\247s\316\234]\036\333Hp7\370\260rS/\2661\334\310\020\270\025vW|f/B\242"
+	.string	"\2259g\003\177\310\211d\320\320j\311G\324\236\252\020\255\256\273+\303\340\002\356\260\222u"
+	.ascii	"\321z\261<\300^/\230\213\300\215L&\341\025\342Ch\327j\026c\315"
+	.ascii	"b,\0177\255\027\313\025\223\261V)\303>\330\304X `\260\030\253"
+	.ascii	"\324\253\035\234+\303D\321\021(\265\265I\231\365\227\234\t\204"
+	.ascii	"\b\023&\310G\034.\300\370\274\210\313c\225\320\027\336\322\034"
+	.ascii	"\205P\027\237\242\366\264;z\nr\346I\256\204\202_\303\026.\\\220"
+	.ascii	"\2173\373\240\203F\\l\361iaZ\231=\320\023\354\212|L\001\342S"
+	.ascii	"p\325\232\326\212\333\022\376J\253\n9 p\002\231\271\234\007y"
+	.ascii	"\2632&\036\321D\327u\026\303\032\367~\254y\013k;\341\276\352"
+	.ascii	"\021\0161\207_\320\016*\236\221d]\233\252\03124L\262\251\214"
+	.ascii	";\214Sj\025hq\207}.\026\356}\227{\034\035K\025\263Hxr\334ml\333"
+	.ascii	"\245\227\332\317\300\017k\215qR\236L\214=\245\307\227-\313\210"
+	.ascii	"\227h\017\003,\202m\021I\203\036u#(o\344\227\360\204\371\035"
+	.ascii	"\214\3622\344s\030\203+[n\273\202\036"
+	.text
+	.section	.gnu.lto_updateRSSI.114.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`M\001\235\r"
+	.string	"\226\330YD"
+	.string	"\261&\035\253\210\267\357K#\351\003\331\270\317\275\353\371E3#r\304I\005aP\037u(\241\220e\037\304\022\320\350\204!\3473\362\303\336'\f\003@aPU\263]\212\034b\r<\272\215D>\331{\313\224\002E"
+	.string	"F"
+	.string	"G"
+	.string	"\377\260\036\215\331\252\237<\254"
+	.string	"\323\205\t54vW\276\016\307\036\341S\314\207-+p6.{\274T\016Os\004-\250n\343T\376\264\024\013\244t\363\342\301Ix\3121\262\273\326\215\263p[\267\275\300\266\264/\"\326\343\237\007\006\026\246\025\222v\366I\323\307\301\376\353\272\256\206\237\213\375\231?\252\372\034\001@\310\340\216\302\331\255\320\331\330Tt\021\242c\373j\177\304e\260\317Dp\307\356\206\230\026\273\247\003&p=\206\034\304z\204\001\"\375\346\333\254dR\332\313\374\232\317\230T\2469/\335\224^<\224\257\002\276\300,\013\n?\205U\227~t\2265e\200\261\177\302\266j@\214\225\335\354\032t[\003!)z\303>\211\227\030\371\037\f\001E\277=\372(\001\"\005\037\020I\002\223\222\317\234#\017"
+	.string	"{DN\246<\231\262\204\204\001Hz\246H\212|8\344\3403\245I(4e\347D:\334\347B\363SX\315H\221\236\346\233\270G2\315\201\261\243v\003\320{\231o\363\002+\030\360R\373A\036"
+	.ascii	"2\241w)\340=NX\240\223\352\263\013\272,\265\"\220\227\247\304"
+	.ascii	"\301\325\315\ft\215%@\\@\311S\316@\025F\324\310\342(^*\263\030"
+	.ascii	"gXA\33120\352\022\026\261\032=\356f\237Db5\331\251\233 \337."
+	.ascii	"+O"
+	.text
+	.section	.gnu.lto_getRssi.115.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\022\001]\f"
+	.string	"\266\327R?0\217\222\016'\254\346Z\226 \273 \023L'~4\243\360\360\361\223\355Y\016\306\3537\346\260%\177\277=\037\240\322\307\340\357\332fD\004I('\030\264[\033\216\322\310k\244\021B\366\336I\246\024C"
+	.string	"9"
+	.string	"?"
+	.string	"\233\214\230\342\231\320\320\326\244\235j\016\356`R\016\007\004\354\204cCK\212\210\0301j\025"
+	.string	"\007\200~\351\r\350w\f\34689\265[\254@\005\314\346\371\2348\241\0041\306\246\3473\301\275\333\036h[\240\365K~5\t\364\363\005dp\301rk\265N\376Bk\027\257\3226K\271\254\306e'\227\315\300\254\344\262\221\313B.\013\237}/\353\\\366\317ff\255A\261D\370\030\006F\214\022\002\365\330\266\027(1b\006\240G\360?tg,\235\334\372\016o\367g\020\016\301\251W\n\022\022\002\375\334%\n\371\377\255\310b\374\274SfT\304\036\026D1\242 \250_\254\215\324+~\265H\322\236\335t\224\\U\311U1\020\371\030\2516\227\203\252c\243V\003\220\253z`YW5i\230]\274\nu\002\330;\325\234\2723\024\323\243k\016Od\025:Q\346\223\364\314\007\270\310b>Lb3B\272\007\013\227\022\266\320\342\203\026\033\030"
+	.ascii	"2\241\207)0F\nu\374\300\2530\031\b\207\005\022\301H(X\311\344"
+	.ascii	"CB6\224\t\nL\022\300pY\3134B\306\027\213[\331>T\255\27006\037"
+	.ascii	"\263\230\005#\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_getRssiPercent.116.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`v\001\235\016"
+	.string	"f\\bC"
+	.string	"\221(\035\320\243J\307\307\313\243\212\236b\235O7\364\347\216\242?|.z\325\362\027#\264\256m\277)\361\247\246*\333\334\237\030\013"
+	.string	"\020\364\250\357i`q\277\0344\266F\373\337\366l\226\020\262I\222)\005Q"
+	.string	"F"
+	.string	"T"
+	.ascii	"\021\303\327#\306\200,<\264u]\3020\024\223\350\003\026\032!b"
+	.ascii	"\214\235a\213\322v\206nS\332\256\007\020\244\364\004\340\002"
+	.ascii	"*\007\001\021*X/;b\214y\357\340\223\363T{\204\027\250`j\264\\"
+	.ascii	"("
+	.string	"\347\246 \306\330l\2712\270w\333\002m\007\264\031\022\351\226a]\322\f\263\033\346\314\005K\f\017X*\2776\246\312sh\235\305\267\264ZV\004\263!\230\005\301\354g\313z`\266\003\263\034\230\355\236\335hY\r\314r\317n\315jY6{6\237\365\207\007\304\313e\230\230\030+\031\007N\001\001\205\347#6`+\274\341\206K,v\344\373t\250\304\230\n\341\274\323\235;\347^}P\345\327\315\273[\363M}\302/$\365\253#\022I3\324\\\263\262\235;\234\261\222\311\276\335\254\031\303\032\301.%\\\214*\t\352\230MH\250_\2065)\005\035\211\234\230\274\023\2237\241\204\304\304\033\231*x\"\037-Q \231<\013\245\222\311\353b)g\361-\332\005\244\256j^\003\311\312\330>\267\205f\300~\313\240A\272\225\317\342\312Q\025\335g\315\204.\272W0@\357<t\355\305J\203\212\373\034\344\371\347\001p\004\034"
+	.ascii	"2C\237\220\300\376\033\020\332\020\322j\270\363\225\330e\006"
+	.ascii	"i\226[a2\020.\013$\202\234P0\223\311\207\204l:s?\230$\200\341"
+	.ascii	"\262\022z\204\214/\026]l\337U\026\272\206?\236\211SP\221\303"
+	.ascii	"]6\265\223\f"
+	.text
+	.section	.gnu.lto_getRssiDbm.117.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \340M\006"
+	.string	"\242\313+3@o\222\016\230>\252\236l\200\2757f\252\003\366\207\274\267lVn\240\350\377\266\331\003B+( \241\243\252\b\\\353\007`\223\006v\375\316C\345f\367\226)k2\033\252m\250&\001\341\020\3214\024E\313\020<M<P\255b\232\250\206\311\262\b:4\360\340\347K\322\222\352~l\301\271^\225.\007\240\322\241"
+	.string	"\207\347F\237Y\207\035\337K\"\350\277\017\007BP\260\206N25F-\251\"\245\200\374\235\307\254\260\320\271*\270\260V\020DD\030&,\231YC\217V\275\352v\244\r\237\220\350\302\254^"
+	.string	"Cf~\027\266\321\261\177\302\177\360g\004\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_setRssiDbm.119.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\315\n"
+	.string	"V\025J;0M\225\016\2412f\r\321\360\214\365:~w\3327M\323>\336E<\001\2715\021\320\032z\360$\032\274Y\204\002\265\003\t\203\362X(\256I\316\336\350\032\340\326\226D\262\267\224)\0058"
+	.string	":"
+	.string	"5"
+	.string	"\004\254Co\366\211w\032v"
+	.string	")\025\372\200bw\243f\370\366\247\271\371"
+	.string	"\270\316\237%\341\352\340>\017\262\2737=\037p\240\314\n\312\356:E\\\204\033\336\266\001\333\023\373\222\351[\016\022#\356 D\354B\270H\261#`\210\r\266\337\260\255i\237\303;l\3578f\354Z0\021\255C\310\005T\207\357\217\352\320\231\266d\262\275\344\300\272[\201\204\332\355\n8\225:C\026\251z\265\234J\2002e\377t\017\034\177\344L\313\213\016}\255:\274\336\364\207\242`A\232\340\311\013\273\373\244b\260\377V/\330\231\256^\372\337\273__\230\013\246]Y\205\321\022T\020h,\0072Y\206\005\360%\262\301\342\006\213\n2\025M\274`Y\214<|-\300`\261\301ua\261\321yN\361\350\347=FVj_\f\362\"\337t\nH;~\032\023"
+	.ascii	"2\003\302\260\305\302\036!\b\334\001cH\3252x\201\275\"6\314\037"
+	.ascii	"\026t!\347\313l1\205!\246\324hq\227\233jo(\314[[\312"
+	.text
+	.section	.gnu.lto_setRssiDbmDirect.120.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\365\n"
+	.string	"\026\325K@ \211L:(\276\301\244\2441\002\f4!t\353\nP;\210$i\215e\372\ng\013!i\027\200\020\036\343i\007\374\304\331@\244\006\n\240\315%\2127\252\306\013%ji\344\023 \024\311\336{\247\0248"
+	.string	":"
+	.string	"6"
+	.string	"\r\221W\207v\204\217\003\226\301\200J#Amw\273)\340\341\351\224\241/\021K\247\035\237\024\361D-\273{\330\245JDI\t\311\354\256eJ\344\270\353mO\330\206\260\357\020>\204\342`&\236\301\203\335\215\333\204mP\027\024\260\375\211\355)\355\037\370+\3748\262\302n\200\332%\362j\371\002\367J_\341^-\245\375\020\021\336E\362\334\005\360\242\355\216\027\007rwKs\266L\347\247&\006\001%%\330\217\035\301\310'`0$\237z\365C\334\353\347a\247\264\225\314\346a\2227{,\311\331\262Ow\262\354\273\376\372\361\247T\006\234\315\027\362@\316\243\241\350\200`E\006\347#\361\006#\372:\321\327}:\026\236n\363\201\035\246b\357\202\363u\030\236\367u\223qOw\262\2341\315\023\255\323\227]\001\311\003\201\270W\211\325\314\366\021\021"
+	.ascii	"3\241\251h`\374\252\035\226Q\325\021\254\366\325\311\"|,\334"
+	.ascii	"\332.\214h\232\325\2460\304\224\032-\356\362S\355\025\245nk\213"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_rxGetLinkQuality.121.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \356}\006"
+	.string	"\202L-2pM\322\001\240\f\247:\004\256\bm\305)pa\006\037\205x\321\200j#\304n;f}\314La\021\252\"\202\036lA\200!d\2509\266\354/eJ\001\236\244\312s\225\347\036\032\026\034\334\364\"\234\004\231\202`xN\202\242\236{\342^3\251\006\226b\354\213<B\337\303\023\226\374\365\346[\234\267T\201\f+3;V\251\034\366\001V3\266\323\251\003&\026\3307'\273\027Y\312\2264\222\017\333\027\373\3615\007\271\030F\024V\025i6*FPv\243#x\201\363\226\207\2347\3558|B\377!W\300l\262\013\253\236\001\t\273\353\2740\214[o\033\301\366\201m\215\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_rxGetLinkQualityPercent.122.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\225\f"
+	.string	"FXUA o\224\016(3 \r\002qFR\241a@\t\223K\025\242A\346\300#\312\0031\262\304`r\336\332>!\331\377\350\t_\366\330\350\006@\002\220&!\002\325\210\217O\311\245\331v\371?\331{K\231RC"
+	.string	"@"
+	.string	"A"
+	.ascii	"\323\263\004|\200|\324g\344\343fx\366\b"
+	.string	"W3\377\036\247\224`\bQ\301u\332#E\343\020@\247\361\205\232\r\013.0]\tnN\214\240\356q\305\350H\252\025\2029\247\225\3532ny\333\tl\027\260/!$\0256\375lO\323\345\260\017\347n\330VW\254\256V-\243:F5\204\352]\265\252\372\0010%\251\356!(\346\234\360\275\230#\261\304\006\333#\333\342w\374\303\310\031\307\264i\234\016\r\250\020-f\366\201\357;)\315\271\031\200\033\367'\016$\375\274\013\367'\026\272\273G\235\374\343 Y\003\020H>\352~\304\325$2=\354/\371\275t\370 )\251\211}\020\367.?e\b!=\367\350\207\344\343W\023\366tD\230%\302,\007\037\005 \313\203\205\254N\306\327\203\005\230\025\341\2720\313\342\315C(W\267\262\325b\330\256v\263-\t\306\213\332\f>zN\356\256\2467\271\360\211\200q+K`\305I\204\304)d\244Hq\200\230\360f\027"
+	.ascii	"G\023\020\206\025\330p\251\246\204\240\256\202\301;\264\210\255"
+	.ascii	"\242\335\210=\206\323`\361\020\222A3X\020b\027\374am\027\306"
+	.ascii	"|\230\355\203\261l\\+\177\212\337\324\220\032\227\202\002"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.123.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \373\345\006"
+	.string	"\222\r15@o\222\016\230N\022\005"
+	.string	"\223 ^\033\222\220 \223\221\203\206wKmMYk\233=\240\256Q\022\210\330\031\3075 \274@\356r\017k])\274\007\213hBd\nw8\236\b=\021F<4@\300N\234\200\034\315\224\204C\204\024\024\025a&\313:\321\356\340r\030\177EO*\201\314T\270&\315,.H\337\027\237V\254\357~\246\276\346\006J\256V\372\314j\256\343\013\220\231\271\023\375\355\346\b^\\B%\251dn\224b\262\345\255\204\374\240\317\334QG@W\233\214\313\332\214D4R`23XP\203\251\257U3\3659\217Vm\325-I\031PH,X\310j\013X\310\314\033\026\342\350\256\177\302\217\360\177\004\007"
+	.string	"\004\013\330\210!\005\205"
+	.ascii	"\343\232\222\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_isRssiConfigured.124.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375 \363\245\006"
+	.string	"\222\f.4Pm\222\016\244\024\241b\271\244\334QUM\361\020Lc \313\350\252\327\263o\377n\331qF"
+	.string	"*\324xv\246M\033C\005\254\220\204\026\266\006\035\326\376&2\005c.\232\3474\317A80<8\314\223p\227\201\251\210\206\347&(\3529\013\226E\021b\201\007?\337L\245\210XP\310\247\244zd.\307\024\233V\253\323\335T:\025\003.<-{\254\3230\343KI\024\375ml\355R\004H*\256\226J2C\331I\212L \035?\347-#$p\256\212m\204\bF$\320\207I&\346P\243U[u;\352\302H)\263\256N\033\200Bf\336\254\313\242c\377\203\337\340\307\b\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.163.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\365\003\375\031"
+	.string	"&\356\244H\260XQ:\260W\3347\371\205\342t<yll\334\tOFA\345\231Q\232NQ\246\203\276\266\024\373\345\323\374\270\342#\214\376(\033\242\3716\343\247g\"w\n\013\007\207\355\032"
+	.string	"\002t\033_{\345\301\315\366\311&r\247\024\214"
+	.string	"\230"
+	.string	"\210"
+	.string	",\274\265\342\210\212Rk\t\341\324\tZ\2476\220\355:=r3n\226L<\236m\277\310\215"
+	.string	"\031\307`(\227[\020\244\b\321S\260\3262v:\340/\361t\336\200x\272<\216;K\244\341\316\026\316\237E\275\240\263\326\205\024\321\311\305\257\2507\343\324\246\326\352\352\r\3150|eQ\242r\365v\241\003\034Vb\b\350\351\346\2066U\244\210\004\364v!\202\245\034f\376\3734\352\t\315Y\340-\226\205Z\253\237#o"
+	.string	"\267-d[g\257\226\025\211B\001y\223S\371\031\375\243\244@H\f\021\224\024\024)\214\")A\027\"\273\250\t+\231\216xQ\334\023V\262d:\n\240d\024e$Xu\345\003\233{\266\305PN\207\004\245\027;\336\225\234e\337\177r(\266\313\343\201\276\025y%8\216 \275\004S\034h\021\t\371%\b\243\"m;\320>\344\230&\352'\271\371K\376\263\253\311\355O?\023V\326#\236\323\231"
+	.string	"\375\351g@\325R\177\324\024\344H\031\007eK\211#L\270\275da\323\343\301\251\303iG\230"
+	.string	"\3642\255Zu\024|,\227\372\340\37385\210\020\324\017\261\3072\205$7\257|2\232r\341\372\252|\356\254z\315\327E\2106\211\022\363Es?\005i\377*\035W\300]\237\355\035\361\373$\2470\272Ye\002\323\246\336\204h\313f\363E\337\t\334\222CJ\267AQ\266odZL\225W\221j\203\323\377N"
+	.ascii	"\270\345\206T\320<3\327\347m=\254\273d\327L\2135\323\264f:\244"
+	.ascii	"\231^\327\364tM\237f\222\025\254j\205qe\025\326\321"
+	.string	"\271\261\361\2145\025\264qfbV\213\315r\016X\347\204\317\211\235\034\332\210\001'Gf\343\331\221ix\361\340\320h2\235\031\313\263\233\025\265\330\212Z\214\266#\353\211\315j\266\330\215\001\217>8\265\230\212q\254\305\\\266\347w\311b\215\035\"\335\377\256\241\306\216\206+\256\221mqm!\267B,\\\222O\201\241\013\033Cc\177\b\341R\305\020X7\311\366\205{\301\300\345]2l\340\300A<\r\3671H\252!\206rb#\210\256\317\036\304]\0322NSv\207g\361\020N\250\221,\303\020b\004!\221\031\td\202\246u\240\002\031;\323\006\021\240-\224F4M\215\232\365\016LP;\020;\243\036vgR\254bC[\234\377dN\362\344\3132\306_\357\033\020D\034\326#j\254\313\315\314\027\261\n.\226}\236Q\270\234\037\036S\301\302\023\240\"zZ\374\335\241\227$\t2\2775\336\003q\257t\202c5"
+	.ascii	"_>\214\b\216!2lD\211&\177Jh\236\317\006\305/\022\200\303\330"
+	.ascii	"\037\204y\262@\245\256\341\260\353\214\346\304\377L\bD\261\362"
+	.ascii	"J\353\31556\312z\2005a\336\342\352\020\307S1\245\243\001"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.172.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\316\002\235\025"
+	.string	"\246\347\213I\320\224M:\224H\225\304\340\"\252\r\362F\245\221a\300\333l\342bg\025\360\317\275\023A\016\244\266\356\330\034G7\274\257\265\314!\240\305\253`\033\314\2320\006\271\032\253\324\017{,$A\360@\335T\223\366-!do\271S\n{"
+	.string	"k"
+	.string	"x"
+	.ascii	"vy\331\031\262m\227\027\036\307\236C\022\022\220d\003jRRkN<]"
+	.ascii	"\016\217]\025\202\037\235+Ob~\317U$l@B\013\007\257\373\\\262"
+	.ascii	"\351\360\021\004\252V\341\237\244\325\210NQj?\223\245\326\272"
+	.ascii	"\252I\220s\0168\302\300{\217\241\242\311\202\203\007\320\252"
+	.ascii	"\346#w\032\270IQ@\251\315\346\312\324\206\"\327]\006\325|\244"
+	.ascii	"L\371\t\bSk\365e\266{u\333H\266E[\022\t\364\272\027\230\232!"
+	.ascii	"\342\206\002\211L\366\344\342\274'\237u\217lK\253\250tH\245A"
+	.ascii	"*\375Mi:\245'\225\336)-\237\373\2572\223\\\004\270\325*\324k"
+	.ascii	"R3\320\030!l\337\276n\307^\331<\366\312+\237\3339\023l\346jm"
+	.ascii	"\310+\355+}\211\347L0\253j5\"\022Uk\016\301\251\t\204\247,_\371"
+	.ascii	"N\347U\276S\373'\002>ztq\246\373\035w:d\320\215`\223\342\335"
+	.ascii	"\020\362\324\233\213\233\373\375\322.G\324a\314\260Z\255=\320"
+	.ascii	"\241H&{\336K\030I\2464\354\342l\323|\273\rvC|\344\022\373,\336"
+	.ascii	"\202\246\306\306\346;\335u\261I\231("
+	.string	"\222\353\2578\024\354\306\345\372Ne\022\332\221\027\331q\330\367\225\373\0136\032\273 N\267\231\354\331\217}~\2127\305\374\017~\360\222\247\235\372\257\357\001\257\004\255\233\232\230\034\234\3268B`\0010\253Eg\024uF\021\247f\346Fd\215/\261E\305.\007\255Q\314q\271Fq\365Y\367\310\327=l\222\244\364\364\002\374c\237j\203l\253\3260\262\235\251\302\0342\247\371\300\r\3677d\300\215\261\375\340)\260\231\300#E\332\013\030\310\323,\235lT\236\221\331\366\340\210J\310BpqJ\2060\021\272\251\250k\364}K\343\275oQv\036j\374\334f\0071\"; \300\"\2512;2R\fG&\370\001\335\3076\261p?H\036\215\301\216\215\341D\300\263\265&\2102\036#\210\210\207\025,\231h$\033n\036\335\376\360\026\333\225\213\231\274\225\267C#\\`\023L\203C\037\355\227?$\001\377IvJv\2573"
+	.ascii	"\333\316s\222\026o\033oF\027\330\ryf\204\033\263\330\035\346"
+	.ascii	"@\274\334\311\331\331]\033!](\300\342^\\\300\0200h\350\276Jj"
+	.ascii	"\212\205\203\254\355N"
+	.text
+	.section	.gnu.lto_setRssi.part.0.176.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\271\001\r\020"
+	.string	"&^gE"
+	.string	"\261&\035LtE\242\252\231\376\216\307\200\013\223V?Gv\026\316\022\346C~\233\034\374\201\034\323-\321\266\326B\217\246\023\247\r\226\274\265Jw\255\257]\202P\374\r\2609\256~\337\2708\027\205h\262\267\224)\005P"
+	.string	"V"
+	.string	"S"
+	.string	"?q\024\250\317t\216\273.19\273\037\202G\033\310\036\003\234"
+	.ascii	"\366\230\017\301\036\355\233\260}Z\031e\327\370'b\013\310\260"
+	.ascii	"dh\341\330]\355QC\034uM\210\362\323[I]\357zz+\034\236\002\016"
+	.ascii	"=Hv\327Y"
+	.string	"\207;\336\266\002\333\013\354d\020\276\317\342.l\217\271\327\370- \264\354\220\330]\317\343\215M\227mN\366A\206\345\305\335\246\003\331\253^#t\274\022d\334\375\024'\337e\217\355\323\234\336:I\007\253\362\360y4T\361\025\250\267N\374\261\013\202\306\201\354Q\004z\254\371\357\364\231.\277]\255\254i\007:\177!\301\207y\364\210\224\367\036}\022fR\312{\252\"\0304\345k\352]\177\220R\002G\345\245\312\035\251/Vx\270\312\262=\322\020K+\226\316\177\377\263l\371\310\330\335\260#\307\272D\235\230\337\034\307\0034\\\370>\266;\220T\203\024K{<\315\325\001\"\256\004d!\212B\033W2a\"\256\004\024ad2m\037\016\215\240l\032\312\246M\030\201L\264\320f\322FB\\\242 \332\264\n\245\322\246\345\341*\313$*M\261\252\276\330\206\352\357<F\347\303\030\024\na\217\367l\250B\375\r\225\031"
+	.ascii	"2\3655\207A\312vU\367\374) `\20216j\007\2012\210\224\f\214\256"
+	.ascii	"\221\241\301\274\244y\343Vd\017\235\255\213(\0173\016\367M\203"
+	.ascii	"X\f2g\3565\260\345\325Y\331Lc>b\270 2>\017\260YI\032'f\254v\253"
+	.ascii	"\214\310\024\361\026>I=~hv.\3548^\362\344\354\3546S\266\r\200"
+	.ascii	"i\257\004K|;O\bc"
+	.text
+	.section	.gnu.lto_setRssiMsp.part.0.178.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\375\n"
+	.string	"\226\225J<0M\225\016C\210\323\026C|\030\310\214\226]\222M6G\264\235\033?\241\rv\204>[\2131\304\253\241\007\303\260\252\203\203\271k\360"
+	.string	":\247\366\316\030\213\312\314 Pc\333[\312\224\0028"
+	.string	"7"
+	.string	"9"
+	.string	"\276h<\332?\331\356\214\314\331$\356QX\213\013\030B\034X\273\213=\352\204s\327\204\234\177\357\216\216\344\271>H\r\236\025\207\024\003v\327\r\007w\274\355\211\355"
+	.string	"\366\r\004\216i\b\323\n\323\371\324\177GB\220\204\330\025}\255\225\020AX\260}\373^\307\276.k>e\311\244s\024\347\336\212F\326\264%\023\356(\216u7B\206\017\273\236\200\3076\002L\276\203\252\254\025I\005R\217U}\r\337\220\371\025\234`\313w\217\376\306x\274\211\256D\036"
+	.string	"#U\365\fZ\240\374|M\205\2108}\241\023\237\374RMVx\270Zr\227m+\240\331\b,\250d\036\246D6\032\266\321\260\314\345"
+	.string	"\006\243h\033\026\2018\323T4LA\226i\330e;\017WKn\254\036\250>\nR5\331\206\352w\270\007J\305ba<\352\210+\003\024"
+	.string	"[+0\036\270\201!\005\002\006\271\004V\003\001*8@\024\fs\205\003\247\305\276\302\211W\331jN\3736\363vZ"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.179.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\353\0015\021"
+	.string	"\226\237nF\360\262&\035\222\374\207\202\026!\370N\256\324r\351\301\203\026\021V`vM\367E\301"
+	.string	"\201\035\340\270r\332\2641\362\336v<\177H\016-\330\230,\362\343\324Lp\340gJXT\357&B\032\002k\252\266H6\2212\245W"
+	.string	"Z"
+	.string	"\\"
+	.string	"\036J\310vc\t\036] \3648\372\200\355Q{\310\366\310=\336\204m\027\fV\3316\036\253Y\221\233\0160;\263\335\355\036\225\346\252k\232Q\345\203\224D\256\327\352Z\272^\031\256\001^-m\264\273\317yRx\2612\005<\202\224v\327!\r\367v\333\013l+\260\323\024\032\323\031\323\027%\214\324c\367BP\217\215\2110lXXe\324\212\325\274\256\323#;1\333\326\216\330f\261\212I\202F3\342\206l\366x\234\373+\276csf\271\216I`>$v\227c\271\217\302\305\3171g\3738.\217\265\244i_6\214<:\323~\212\253P=\326b\321nW\3314\205Y\370\260\302Q\203F+yXUS\021\0350?\256\251\252\337\271\201\0206\025`xD\2602\310\\\332\017\276\274+u\304\322\225\375\026w\321\342\2030x\222w=\372'\333\343\225\004\346s\303\341%\203zB1\213\340\361"
+	.string	"\220\214\237U\372H\235\261\306k\2532\366\226\326b:v@:}\250\224.\005~\037\350\021@ap\372P%)\251S\030F\360"
+	.ascii	"\330#\255\204\335J\330\245P\r\276\316\013Q:R\210A\b\247\260K"
+	.ascii	"\001\301\260\343l\347\265U\031\347\374\023\200v\374\274(+F\272"
+	.ascii	"\\\322t\306\336\346\313\376\302;\231\230l\217%0\237Y\016}\356"
+	.ascii	"\356Ju\306\236\301\363\023- p\202\031#+\017V\216\301(\211\241"
+	.ascii	"|h;m,\312\206\255@k\214\310\2026\026sm\344N\301\tX\327<\366\226"
+	.ascii	"\3700>\275\026\212d\013\033\237\324Z\311\004\n\367Z`\323\210"
+	.ascii	"\3020?\334P\n\302 \240\035\346\360<&\2463\030\323.\255\255\262"
+	.ascii	"\"\335\035\272|Nk\241-e\305\300H{\005piO9\267^\213\307"
+	.text
+	.section	.gnu.lto_setRssiDbm.part.0.182.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\361\002\005\026"
+	.string	"\026\351\213I\260\324Q:y\251\351\350x>\300\002:\247\3711\025\330\316\217\221\311\017H\254\214\370\321\004-\007\330{\313\243<u\235(0\377\306;,O\316\027l\344_\361\022kM[\215(\330\034\245;\352\211\226\273\267V\362\311&R\246\024r"
+	.string	"t"
+	.string	"r"
+	.string	"\rfM\b\225K\203j_\305W\350^$\343\325\234#|\214\342\345\200\007\b/\301\237\204\227-\257\236\310,-4\037\312\3357qr\274j\263\264\350>\224\363\316\311\323k\232\323g\340\322)\342\245\375\024\266ir\254\263\201\334Wb\242\364\214\360\216\212\3149\307\313%q\335WA\235\277\341\313\352\360\341jrP\3452\347\264\b\342\226\267}\300\266\002{3\004.\225\272%\252Y\242z%\252\305U\253V\035\252\324r\325`\250\336U\353\211\376\013\320\235\024\2419q\246\216\314\036\351t\342Jwa"
+	.ascii	"<\016>\025\3339\224\367\b\365\240\202\346\364\215\2277\372\332"
+	.ascii	"\367\221\276d\267\214;\013\277\305\203\035#\024s\316\326\245"
+	.ascii	"RRN\234A\252\247\236\221(\334\223r\341\324 \244\007\025\205@"
+	.ascii	"\304\335\367\321\370Gn\331\276\021\315\213d4\254\275\r\317n\306"
+	.ascii	"i\020\220\020\213\205\227\253}\231\320Q\255\030\256\256j\365"
+	.ascii	"\207M\320N\247,7\374\222\035\363\0302q\316\231\300w:\214\231"
+	.ascii	"\017ti\n4Zx)w\345\264\013\356y?\377\305\233r>\220+"
+	.string	"\324\3647\227~-\274\334\375\322\245\007\021Cz:_\335\037\335\301\356\t\211\367\253\321)\335\037/xp\256\217\035\252KD5,T\277VM\262\3523\334K,F\316d7\234\r&\234\341^b\020j\023\026\320``n.\313Vfn\343\314m\264@\213\325F\331\rf\\9\261\355\302\3546b\260\331n\243~}\354R\263;\357\356\217\355\022\035\021jGgP\364\204t#\265%{\220\265\260e\355`\232\262\371\2756\007\311\276Vy\360~\260[F\350Z\222\2258x:\005\016\256kO\212\230\210\330\360\264\366\206\f\326\303FkMvLAx?\326\326\370\215\324j\305\r@\250a8\310\020\022\2202$\"\201T\322B\215\001`\002!U\331\r\020hXUk\314\002\341{2g\337\255?\340\004\023\370 E\310U\265<\034\311\03747\2166\247ws\031\351\304\373G\225\254q\267\275\276\240\017\351\204\376\027"
+	.ascii	"\035\255\222\316}6\317\\\365\246\260\205\225&\321\221\303/:$"
+	.ascii	"W\263\025\305i\257\0242\352\345T\305\024\262Q\305t\201E\300i"
+	.ascii	"\204\253\375\310&\225#Z\206\327\323+\244\351\336\214k^`\246>"
+	.ascii	"+\303;\330\017"
+	.text
+	.section	.gnu.lto_rxGetLinkQualityPercent.part.0.183.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\235\t"
+	.string	"&\323A:@\305(\035\365\245k\324\272\210=\357\033\237il\007\314\220\320\330\005\004\274\261\313\277\201\326l\262\301\335q\230"
+	.string	"ht\252\212\342b\354Zk0~\356\035\200\031\370\237\354\235dJ\0013"
+	.string	"2"
+	.string	"."
+	.string	"\246\223\0011\3024\303\002\037d\206iMf\370\017w~\276\256\366\313\230"
+	.string	"\036+-\247\024\311'Hi8\r\374.\r1\306b6\\\350\266\fm\027Z'\004Y\370\354{\331\277l>kLrp\\1f\304\b\304\016\2102\322\372%j3\355\250\315\030\222\210\332%\f\004\205j[\267\354\032\265\333\\\224H\233VH17%\3438\337n\024\351\323\377\242\352\244\372y\233\n\324%6\351j\221~@\351\223a\r\312\f}\253"
+	.string	"P\2252\226g\365\317/~\325>\365tB\234\026\3424\t\b\207\b\315\303}\264\216\246\333\304\003\247Ul\033\247e\332\246_\374\252\231\357\360\030m\341\025J\267\370Ym\377w\004\001\003Y\226K\020"
+	.ascii	"O6\2045\020\032\325\310X\231\007\242\302\003D\3010W\270\307L"
+	.ascii	"\0208\003\350<q\263\271\360\\PM\371-\247_[\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`1\b\335\036"
+	.string	"\226q\262=P\346M:W1j\345\310 a\001_\351\205\371}\255Y\034\257W\254;z\266\221)\354\221\023\024\377\255\277\352\377\377\377\277\262\250y\013\003l\371\206\367\021\275K'\317A?\315\266\335[\246\237"
+	.string	"\235"
+	.string	"\243"
+	.string	"\f\207:\250P\243\331\r\245q@3\276&\343l\266\336\030W\302\300p\276h^C]\334O\213\343a\301Y\354\n\306b\353Uq5[o\212\247\241\350C\242'N\250.\227\313=\023\375F\264\004{\221h>CG<\217\255W\304\371\204x[\203\377\261F5}z \372\217\350\207\276#Z\257\207\t\035,\360\231u\365>\366\177\202\007\254e/\035\016}\275\r}9\r\3758\3405\315\264\263\337\275\367f\350\303E\361\215\321\035\373\210\250\231V\347\357\277\315\213\337(\016\231 \f\375A\364\177"
+	.ascii	"\b\001?d\273\372\235\262\3649a\351\367q\3657]\351k\262\322\347"
+	.ascii	"\333\352\357U\351c\242\311\376\245M|\366-Q\255>%\363z8\253\317"
+	.ascii	"\210\362\345*\315I*|"
+	.string	"N\341+V\n[\211\302[\026\312\205'\375;\352\204\303\2320\230e\302]\354\222\376$%}ITUvR\222~$\212u\264H\372yG\372xF\372uE\372tD\372\213\350\220\276\"*\204M\033\344{\3545\320\006\017\035\220\376\334\375\321\177CZ\371h\236C{\030-\017&\333\301c:\330K\216f9\024Gs\234\033\024ltw\270\266\206\304\032ur\004-\264A\227#\326\002J\016\220\006m\314\023\021k\201\223\017\200\241\235=\216X\007\3301G\"c\2267$\326\251\317\021+\260\214\215\225\356\330\240\206\365\212\177\027\016\252\362\031\007Uy\217\353\032\242\344\227\360\007\264c\026k\223\tL\200\260\262\222\271\317\314\222\355o\002\252\230\346\2570\375%\230\346\373\2459\213\254Yl\254\231\213\227\376'\261f-a\315[\300\232\273\272\364=\361\275\367G\260d.\315\\\374\365@^w\343-/d\377'XJ\222"
+	.ascii	"A\366\300\272\201<R<\237I\326\022\007\232Tw\243\r\336V\203x\377"
+	.ascii	"SY\215\201\311lf\310\354\220}\237\312v|G\202\354\224Yp>\225\r"
+	.ascii	"}\355'4\231\217_\253\004L\246@\347\013\222\325\261r\031KxD\306"
+	.ascii	"K\201U\275\372\235\261r\030gU\375\200eL\335\366\352\312HUU$\036"
+	.ascii	"]\261\"\225u\305\272\003\r\377\370\336P\272"
+	.string	"]\261\016\225\003N\256r\372\362\356>W\254A4<\265d\003T\362\365\272\330\360\230\022\222\313s\270\"\200\344\231\231\251\303\025\337\250*\017\006\225\317E\013\024)\250\3012\241T\r\2521\247\021;3\211R5J\215i\247\200\214\250Q\020\305B)\032I\031I%\255\001\260\002\251\251\2426\021\240\020e\025\"\"$\201\004\022\b\025u\276\204\320{\327m-\260$\364I3q\246\373\2406\344I\221js8-\346#J\252\361\226s\277\250\b\215J\342\335\317\347\265_\2344\274\270\"dr\364x\222\344!\336y=\221\200J%&J\203\243T\312\300\317\244\bp\316\026\337\227R9\246\307\373\365\340\360\273q\344\002\202\336\240\035,\276\020:\304\325u\225q\"P\200z\300\302\276\376\036\016\221\212H\237\023\256\004\314}\005\303\252a\033\204\020\352n1\221F\025aa\340\006a\316\324\331\247\352\360\306\345\357\341\256)A"
+	.string	"M\364\323D\021"
+	.ascii	"4\364P>\356\204\332\fx\217\245\277>\214rz)\262#?\001\3371\036"
+	.ascii	"k\245\201\216\221\227\236\342\265\221L\021\247\023\246\225\027"
+	.ascii	"\017\201)\017\236v\213\312\352\344\265\325m\001a\3418\200\250"
+	.ascii	"\017\345\374\230\301\354(\260\265\021g\335o^\232\201L\005"
+	.text
+	.section	.gnu.lto_.refs.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`*\002\225\020"
+	.string	"\306kt<"
+	.string	"\215J\322\001n\f\220Yq\312\r\376\377\377\377\377\377\377\377\377\377\377\377\337\324\240"
+	.string	""
+	.string	"@\346x#U+\020\302>j\230gXp\212\005\226o\177[\212\350\332\320\242\326Jb#[\246`"
+	.string	"a"
+	.string	"d"
+	.string	"\330\033\234\256q=\306\346W\332\033\270z\252\353\247\316\227\264\037]]\242\323?\236\276\361<\007\177\203\217\271\274\326\351\027N\217\335S8\375\332\274\325}rk\272/\333W\256\277\340\3476"
+	.string	"k\n|\f>\314\214yg\264\277\\zf\311\257\230O\342'\274\002\347\262\276a?\201o]_\370d\362\217\024\360G\360C\236\016q\365\016|N\252oD\275\263\362.v\356\345\\\354\232\3145\261o\261gb\327b\217\261g\261\303\330_\354"
+	.ascii	"\322E\035\240o"
+	.string	"\247\216)\365h\321)\246\216\231\336\262\370,M\272\276FW\344\223Q\177Y)r+\3539\221\022yF\3245\321WB\035\213x\030\361V\350\037\250\367S\210\303=\276c\270c{\223u\215F\307lt\215\243[8>\333\370K\343\f\354bc\344\360\"\267.\362\274\310\004\357\353\363p\325\255\230\277\370]\215`rQ=\320\333\271@/7\201~\211\326\367\020\377\016\034&\3627h\300\372\031\340?\222\352\213\304|\021\230\017\022\277\343\352\031\252\027\240z\224\352O\2527]\235\024\237\227\244%/\274\346\037rK\013\257B)\364\207\232\220\022\372;5BB\350=\375\240\016\336Y\326\3401\350\026\366\017\353\202w\305\352)>?\361\351!\320\2038\222\367p\235\263\"\351Z\352+]\207\215+\270l*\221*D\217\364\320#\017Z\244C,\362\234Czw\310k\260\337P=\263G\267\374\321\343 \2352\310c\177\034\030"
+	.ascii	"D\003[,h\265\r\216_QR\002/\025\360\230L\300\3561\3218fQ\340/"
+	.ascii	"sb\017\026V\n#\334\300\336R\313ZVL\231kZ\333\022\215\265\021"
+	.ascii	"l\271\2555\2363\273\321\267N4"
+	.text
+	.section	.gnu.lto_.decls.3d03625a83eb736c,"e",@progbits
+	.string	"(\265/\375`\301^\335\204\001\312\177N\213Q\0200\204\2554\006\301GKU?\317\022Q\034\345\364\346\bx\362\256\253\271%\241u\370\320\311,%Z\304\242\"Ut\242\275]\205\f\005\216\263\n<\177\221\366\213\323\340!\266m\301_\314X\217C3\032kb\001\205\270\375\214\030\211\210\354\275\267\224R\246q\007\300\b\372\b8\353\372\234\035\334\236\023\257\005\035'\321\241Bck\2025\206\333s\376X\t\204\232\305\351\340\2416\f\303\"U\003\353\273\253\006\f!\336]\306\b\361\222\226@2\203cw\027\214\23211c\316\004A\301\351\355\271"
+	.string	"t\023\274g\356\235\025\003\316\302"
+	.ascii	"\356\275/aS\335\330\336\312\273\013\210\306\315)\013\340\275"
+	.ascii	"\273^\326\020b\245>\277?\210\252\t\276\302Y\330\fo\341\037X\b"
+	.ascii	".\202\261\360\020\214\206\3230\021\254\003#\3018\260\026>\202"
+	.ascii	"\203`#x\007.\303\\\230\f\367\300@0\030>\303^\230\007\356\302"
+	.ascii	"ax\f\373\3009\360\327]b1lul\003\337h\272\204Ow\356J\337\355r"
+	.ascii	"\347\bo\337\0374\205\245\336\306\b\261\013+X\f\317\3005t\362"
+	.ascii	"\336\\jc_\252\334\360^\3349(\200{+/!n\201\005P\357\017\202\361"
+	.ascii	"$\bGa)'\200{+\t"
+	.string	"1\013:B\314d\307\367\337\273\313\245\220\260\320\013^\036\324\030\2324\177cAX\306\235\273wV\f(\302\004\360\336a\261\273\346\266\335;/\b\030\371\002h\344\357\316\351\344\275s\244\271Z\376{\367\203 \002\026\273[\356\234\216\222rK\005\215\231\261:\333[\371\301\317\007\331\206\017*;\024t\336\327\347\004q%\3751\215\343\032s!\330\027\240d\2051\306`\215_\b:\246\321sNY)7\223\275\367\216\006O\344\342\260Fo\317\371sJ\372s-\375)\226\376\344J\1772\341\030\232F]\027\020\254o\246Io\342\2457\243\2447\207\2447{\2447\261\322\233S\351M\250\364\246Rz=\230^\367\245\327Q\322\353\263\364\272+\275\206\221^\357\224\347\366\234\317d\322g\275\364\031J\372s}\316[\346\232\271\313\237;\270w.\036S\f,\254\237\227\244)\330\367\347|\341\3759\237\323\322g\037)\207,\225\202"
+	.string	"LI\260\222\036+\3233\331\221>\n\206Jo\0050\375\035^\372>)\351\001\257\317\371\253$\335p{\316\017\332\325\345\262\030c\374\260\246c\321\265\304\303\372\327G\372\377b\271W\356\362f\271U\256ro\345\336\373\"X\271s:J<\233)\257/\004\b\"\334,W\312\235\313\3121t\311\016-\200{+\177>\370`GK\310\336\013\247\376\345J\177\241\322;\345R\271K"
+	.string	"\\\271\203 \302\263R\222mdo\345N\016!\032a\032\254\177\227\322_"
+	.string	"\234\267\360\002\340\374\t\322\377\306\001`GI#\212+\312\205\303\211\341\003K\030\254\241\374\334 \321\321\305\t\353\253H\037By\333t\226xv\023\323\337\330\336\312\377\367\355>\271\313\353\344.\371er\335\216\225{/\367\336\277H\376\240_'\267\311m\313\312(\273\211i\313\002\266\3109\341\030\334[\371\301\317\00784\232\344Hs\352G \335p}N}{\316wH\357\332Mr\227\036\\\266_\265\213\344\346\222r+\367V\356`\2605nJ\260~"
+	.string	"\322_%\327\331\332\"\374L\177=8sa\341\365\340<N\361\3559y\256\317\371\337#\377M\273F<\310O0\2626\223\275\225\030\322\246)oF\260\276\362\372\234\351\3559\361\326\331L\270Y\367\353\202e \\\005\245\001\377\322-\231\303\023d\025^\bP\202\235_\233\311C~l\253\227\037\037=\310RDp\271\ft\345\201\220V\373\357\206\031\030\347.'@\337\237\371\262\336\275q\202\216\272!\310\371/\013\375\237\355\034\3768+\333\231 \200\226\316o\2128\333i\346\237\367\3070r\035\224\351\223\201.\267\346lX\215\317o\236\371\257\b\177\246\373\340\027\234\315\f\3741S\316\2029\\;\272\343\374\246\371\237\355"
+	.string	"7N\200\214\345\277\n\370M\002\007\372\365\005~\274\"W\251"
+	.string	"\t\376\333\374Z\320\312\327\005\223\322\346\271{\200\243\254z\357v\300\356\315\254\361_\271\377r\327\202\334\342\277g\262\034\225\377R\231{\005\277)\343\307\037\310Sn\n\2746\364_\272\033\002}\344\317+\374\330\003)\177>\361\337\265\270\037?@D\216\362g\267\377r\335\f\260d \307\325\201\342\002W!\303\275\3757\314C\370\365\325\177\271\f\324"
+	.ascii	"\021\362\362?\234\002~\274\200\213\201[\200?+\3117~2\220\344"
+	.ascii	"\002\370\365\b\376<\001$M,\220\217\3747\005<B\316"
+	.string	"\257\215\256\004\260\t\331,\337\300\023\200\361\337\033\231\310\331\264\213\037\023\363\330\217S\240\313b?6s\001\243\nW\004\377u!\003\371\361\261 \007\277\351\345\307\\WA\315L\301\217G\220}\374\331\213\313\177;\360\337\257\037\357].\003a-\177\356\361?\203\n\374\267\312\217\3750\336\217\037\202o\370\315\264\037\247\271\360\373\233\354\2173`\226\374q\n\270L\377&\013\327\004\377m\300\237Y\370\257\227/<\376|\324\365_\016\376k\227\271\376\213\200?\273\260\343\277n\377E\373\357\331\177\331\376\274\365\337&\177\326\372\361\330\217\203\344\254\rx\003\231\003\177\356\200\016\374\001\001\270r\216\f\224q\374\267\351\277j\306\372o\n\376{\314W\377=\301\177\223\377e\372/\322\177\001\360\347\0337p\377w\305_\266\300\177\303\330\270\005\376\353\202\332\177\017\376\377\374'\300\177\331\377\031\310e\253?S\035\004\277y\201\377n\271!\240"
+	.string	"\346 \377Z\304\345\260\206\233\277F"
+	.string	"\334\317\337,\361\377\312\177+\3773\370\317\201\327}\370\353\002P"
+	.string	"F~\221\374\337\344\277\223\377l\347\300\177\270\243\277\326\360g\020\177\016\341\317!\376\034\364\347\003\374\371\303\237A\370\363\b?^"
+	.ascii	"\324\2371\370\363\007\177\356\360\343\234?\273\370\317\363\237"
+	.ascii	"L\177~\372s\322\237G\360\347\343\237\211\376\\\374\263\007\376"
+	.ascii	"\234\201?\257\360g\024\177N\341\317\024\370\263\210?\227\360"
+	.ascii	"\347\004\374\031\001\177>\377\254\177\254\365g\374\347\377\030"
+	.ascii	"\352\307\204?V\363\3433?^\3721\t~l\346\307\202?\006\3741\230"
+	.ascii	"\037\373\375\230\313\217\367~\234\367c-?\256\373\261\225\037"
+	.ascii	"\313\375X\312\217\327\037\277\375\330\355\307k?\006\301\217\325"
+	.ascii	"~\234\366c\264\037\233\375\270\354\307B~\374\365c\257\037\363"
+	.ascii	"\3701\327\217\267~\214\343\3077~\\\343\3073~\034\365\343\246"
+	.ascii	"\037\237\340\307%\3701\322\217\217?\026\301\217\211~\\\3741\361"
+	.ascii	"\307B?\336\300\2173\360\343\025~\214\342\307\027\370q\n?.\361"
+	.ascii	"c\n\374x\304\217Q\370\361\t?~\300\217\033\360\343\005\374\230"
+	.ascii	"\204\037\217\360\343\017?6\300\217?\3701\207\037\017\340\307"
+	.ascii	"\034\374X\303\2173\3748\347\307\372\277\307\377\256\370\257\372"
+	.ascii	"_\274\377:\371/\327\177\273\376\233\343\2776~\214\377k\201\377"
+	.ascii	"J\340\277(\374\027\356?\335\177(?\376\177\325\3747\360\277b\376"
+	.ascii	"\273\366\3370\377\375\373\357\227\377\346\375w\313\177C\360_"
+	.ascii	"\273\377l\377\245\373/\367_\205\377b\371\357\225\377(\376k\345"
+	.ascii	"\277s\377\215\362\337'\377\025\373/\220\377\376\370o\330\177"
+	.ascii	"\301\376\313\343\277Y\377\325\361\337\253\377\336\370\257\325"
+	.ascii	"\177\235\376\253\201\377\246\360\337\022\377%\361\337\007\374"
+	.ascii	"\327\001\377\353\376G\371\017\367\337\310\377\034\377\263\374"
+	.ascii	"7@aaa\341\257\303"
+	.ascii	"\344\347\221\372!\300\201L\034\262\266\214\016\252h\001\031<"
+	.ascii	"\323b\013\r\353\363\354X\323lk\272\355\334\373*\263\244\246\332"
+	.ascii	"l\300\326\234\264\260N\222D/\317\263\344\343\254\021\204\017"
+	.ascii	"kP\311\365\022\205\302S\326\340\231\221~\2070\375\265\332R\253"
+	.ascii	"\335\271\313\263\231\362\336\306\302\0349\202\3356\244\005\331"
+	.ascii	"\351R\344\277\204\271\210N\273\300\336<\256\030\240\226s\247"
+	.ascii	"E\314\227N\373\205\273Y\027@\340\215K\f\353\357,9;\323^\033\366"
+	.ascii	"\336N;\211\fY\f\300\235\037A\202h\"\247\016*>\254\263m5UvM\004"
+	.ascii	"\210\032\024\f\254\365\220\337\320\205\371\230\"3\277\266\242"
+	.ascii	"\354\221\t\271\251b*\263w\362\376\272\310\300\372;Q\351\365\217"
+	.ascii	"\253\305\226Z\354\266\231H\241v\\\001\356)e\207\357<\245\277"
+	.ascii	"\267\355\374u\330]\352\260\254\005\205\275DE\202\231\226\225"
+	.ascii	"\016y\007\024/8\260\276\316\232\364\327_w\251\277\260\033U\007"
+	.ascii	"ik$Xr\206\254L\217\036\332\353<{o\246\275s\3408\317\254Mq\370"
+	.ascii	"/x\355e\342\r\001\322\244o\307\016\335u\367\336\333j+\211\001"
+	.ascii	"\221\205\212\017k\220\353\272+\207\355\353\215\311\306W\221+"
+	.ascii	"-\252\340\300\241\265X4\311\272\326\312\273!\346J\307\377a\006"
+	.ascii	"i/\250\321\221CgK\336\340\037&\253\242\253\261\204\006\r}\205"
+	.ascii	"\367\336{\fm\322U\004p[\315\340\360\353\033\327W8NMY\021\254"
+	.ascii	"u\rm\343\377\020g\r\nM\026mC[\225\361\2602\226\357t\364\b\241"
+	.ascii	"\346\260F\223\222\3223x6\323\236\324\330\320I\315\305\022\031"
+	.ascii	"\3273TT\241\362T\365\177\370\201\267\026jU\232JJ\013\234\033"
+	.ascii	"\235\f,~\313\251[\005\307\314\223\273B\254\257C#\275v\322-\256"
+	.ascii	"\237\376\244\243\322\275\267\222rK\375\250\305\361a\rn++\016"
+	.ascii	"\346\022&\276\245\206q\035\365?)\201ZK\254/\250_\354Q\315}\351"
+	.ascii	"\027\032jJ\017\r\013\224\323I\357J\273\270Kl\002\277\306\314"
+	.ascii	"\300\3729e\322\377\036\377\347^\232\332{W\231\312=\305\204s\376"
+	.ascii	"\367\327\274\227\303\237s\363\r\300\177\275\367\002\220\312\315"
+	.ascii	"d7d\357}\311\244dpKW\033\266y\267w\323\226\022\004\266\250\232"
+	.ascii	"\266j<-\267\2500<-\267\266R\023\020%\fS{K\351i\2717\206\246&"
+	.ascii	"\245\021YTO\313\245\215\341i\271\2516\013<\252\273\225[J\273"
+	.ascii	")kc\330M{i/\263\2506<5mQ=-\227\2500<-\267\250\366rk\363\354\246"
+	.ascii	"\245)\027M{\n\303^n\211\331\313,*\236\247e\026\325\323r+\355"
+	.ascii	"\376p\361\247FF\335\220\036E.\325S\323\216\021\205\2654\305s"
+	.ascii	"\367\244\314\332}{_&N{j\337\355\035\200\275\261\262\246\372\226"
+	.ascii	"j\334(Lw1\230\234,e]\345\336\033(\212iG\326n\272S\272\373\356"
+	.ascii	"iH\326\336C\230\212v\324\336{\207\240\244\274\333>\356\235\022"
+	.ascii	"\027\326\206\341\2647\006[\271w\324\336Jw\337\355\275\225\366"
+	.ascii	"\336\350\024\226r\357\033<OcQQ{[\375Dm,\2458\247\2751\023\277"
+	.ascii	"(TO\313\035YAqm\313\261\335B\251t\237`d\355\261\335\2675\225"
+	.ascii	".\225\3266\214\275\367\rL\307\250d\214\321Mf:\374\336\260~\316"
+	.ascii	"\221T/\375x2\007\210\365s\302\322L\230\013\357\362rz\357\235"
+	.ascii	"\235*\202:\242`\375\234\2544i\357\275\357\345N\364r\3473\232"
+	.ascii	"\233\325\334eV\223\321\230O{S\201 \243\302\352`C\343Ki\r\326"
+	.ascii	"\317\221J3\232\324\t\347\214\007C)#`Tssn:\312\224y>\363g3y0\313"
+	.ascii	"\205 \247\215mI\017\353\353u}N\237\333sf\301\240\3472)\341\\"
+	.ascii	"\f\037Xg\b\374]\346\300\034\205C\326\2562@\220;3V\203{[u0\177"
+	.ascii	"\bJ)u\021s\227YL\376\222\237\366\322\026\b21S\035\216\203\205"
+	.ascii	"K\231\301\312,\306\337\3572\377\345\274\341\323\336U\034\324"
+	.ascii	"\250\370\260\006\367\224U\207\023Rj\356\260>\216Y\372g0_\304"
+	.ascii	"\250X\215\301\332\313\317\n\\\220\324\300\3728`\351\257\033\227"
+	.ascii	"\303\351\f\367\266rdl\357\335\227\367\016\247\323\244\334a'\227"
+	.ascii	"5<$\203{\357\377\331/w\271\313\334\227\371\256\225\037|\3603"
+	.ascii	"D\323:s:\365q\242\322\343(\245\277I\223\376Y/\317<\353\201\206"
+	.ascii	"6|Q7\304\005\336\026.\030vD\260\316w\312\246\027qh\352\260\376"
+	.ascii	"\215_\372$\333\241=\330\252\224X\377\246.\245\303Y\242\001e\013"
+	.ascii	"\326\277\241\242\274\211\222\303m\006\226\037/j\352\354\256d"
+	.ascii	"+\331J\225\271\264\031<\302\224\303\2704e/`\235\247d*\317rYJ"
+	.ascii	"\226\013!k\357\245,\267\243f\357\245\235{9\270\227\003]d\207"
+	.ascii	"X\223S\377\006.\375s\\\216\202\365\266\325\206u\206\373A\263"
+	.ascii	"\370\366\372\260\376\3152\3753\224\374\304\310\025\004\rk'J'"
+	.ascii	"{\357\037\233/W\212\210a\375\233\257\364!\324r\022\235&\236\335"
+	.ascii	"\264\243\316-#\261c\222\227\344\266\334$\277\335ev\313J~\t\363"
+	.ascii	"\362Z\271\267\023>\266\234$\257M\245Kvt\001t\313A\362\220\035"
+	.ascii	"}\200\201n\271,\037\311\312\261\364\005\223\026\300\275\367\251"
+	.ascii	"\344*\357\t\216\376\215Vz\367\3659\177\323B\231\327\206Y7\224"
+	.ascii	",\025*\007\323\333\364\031\301\241\221D\f\r\254os%\027\311hw"
+	.ascii	"\231\323\262\331\331\225\261\264LDIL\biJd\204\203\246\2223\031"
+	.ascii	"\205\247\276\215Yz\033\257\36469\322\333Xe2\254F\013\227 X\337"
+	.ascii	"\006F\026b\263\224\376yL\317f+,\fK\f{I!D\214\017 d\362\217\301"
+	.ascii	"00'S\300\204a\235\301\376{\227\277n\333\232\217%\030\254\361"
+	.ascii	"\276>g\366\nz\366q\022\236y\301\004\353\235\036\231\207\026C"
+	.ascii	"\204\213\314V\336\221\273\360\031\350\007\204\013\207\3145lR"
+	.ascii	"\356\f\371\002q0\301\372\3033\251V^\237\363L\2648\344\234\341"
+	.ascii	"c:\313\312:Z\260\262B"
+	.string	"\202u\326\301\344f\351\310`;\273\201u\306\021\364\234\203\001`\\E\260\316\031kK\332\334\016&W\371\206\315\331\335R\240R\271\367\376\311\021\003\224\362\3126r\025\030/JJX?D\f\037cn0\300\304\274\b\003\314U\371\251K\f\320\317\005\2201(\026?\306^\3103\262\214L#\327\310T\331\352.sU\226z\236\272xMU9\352\266\351,)\367\324\nZ@\006\321\345\337\2138\036\255s{\316\017\337\322\017\215\244\037\206\245\037n\245\037\306H?\\J\237\n\246O\367\322?\267x\301vu\004\353_\277\274\204\305\244-\330r\324a\276.\037\201\270\f\026\266\201\345`Hp\232\032:\355\201\001f&\\\230Y\344\215\t\263\023^\223\233\262\322]\346%,\3458\rV\363\037e^\302f0\232\2746\2256a\273\342\202\301x\335\273,\230\216\004\247\251a\213\275/\300\274\204\3770 \tNS\303\030,t"
+	.ascii	"\032\311Kx\314\316{8\234\250\234\355\255\374\261\241\373\273"
+	.ascii	"\233\222Ag\345\3659I\270=\347 >\243\0036\366\227\205\365S+\351"
+	.ascii	"\340\023,\270\363\227\203\007\026\254\237*S2\251X\372t+}:#\305"
+	.ascii	"a\252\334\301XR\210\365S\245\364\250\240\027\374\305\017g\355"
+	.ascii	".M!\236\027?\033+PrO]\216\375\356\234\016a\326\022\254/\210\373"
+	.ascii	"\376\017/\034\226%\037}\237\242\323\345n.\206\024\274g#\246\307"
+	.ascii	"V\030\326G\221\244zy:To~pv\307yxK\312\204\311_\024"
+	.ascii	"\326x\013\306w\030\357x\013\326r\020D8N\023\336\242\367^\272"
+	.ascii	"\227\003\235{90\345~,)9\365\321\263"
+	.string	"\364\202\331I\034\2303\254\217\366\240\273mg\r\026i\336\260>z\225\036\245J\177|\305\212v\003\204+\304\372w\211\255\340*pY\364d\314\035Wi\303\331\031\334\234\t|\021\2065\216\303r\377\207\032\313\t\224\223\034\025\237\275(@\345\231\026\304\f\021\254\377\337%\236\202\245(\367\317\0353enc}t\247\027\274s\377\207\346\2162_\3400\276QRF\rK\311\341\007\0200P\236\230J\260\024Y\302\032\277a'w\211\237\\'\311\332\313\275\2259y\211F\035\034\326\277\034\316\235\302\302\302\302\313\341\374q\023\267\253\314B[\223D\t^b&7k\357\246\275\367\005\227\305_\024\032\2541\033n\273K \274d\214\027\023\025\326?\007S\024\354}\201\316[Xx\201\316i\260\f\356'+\016\3502\r\031\033X\377\350\322\321\247\243N \210\200\266\350\241\367\206\004m\221\345L r\345\005k\224\305u\254\352\244"
+	.string	"b}\224\tm\372\2076d]K3\254\277\301\217\364\007HB\203\212\nkT)W9\367\222\32499\t\177\026\376\303\033$rNyX\177\203\256\364T\363s\315?\274<b\334\341a\375\r\262\322\377L\363\017q\304\204\321\370\302\372\033\\\245\337`F`\3409x\223l\251\273D\206\031\302A\234\266(f^\314\374\034\374\273=\360"
+	.ascii	"\257\260>\311\234e\376\017\3154S\204P\225\021\214\322\232\"U"
+	.ascii	"L\302U&\370\367w\212\371I\367\221<\035\2009S\216\340\235\001"
+	.ascii	"\374)F\253\317F\017\254\3170;P\326\372\300\270"
+	.string	"t\351r~\371)S\272\351\201\305\027\303\313\317/\177;g\204o/`}\372]\341\343;\271,\311Kk\220\241\271\340\222\353\276\314\025\252\301\372\032H\261\273\335\251w\223l\251\f\312\264\360\220\f\022v\311\262\363~\352\035\216MM\327\027\254O-'\036\216\f\255A\270\023\357\334\022\344G\214\032^\004\323\376\230\316\273\314\007&F\0305\207+\203\202\326\004\353k\240\344\312\225\223\356tc\n\034\323=\320\034\361\303\372\244;\263\234\261\221\265\006\353\023K\261k\t\025\254\257\201\216\364\032XU\251\242\275.\217\222)\257nlo+\0167Z\232\260\001Q#'\247\275~\322\362\376\324\224\b|q\267\214\213;\247<`\215\214P'\217\007\324\013)?\247\3540\225\205=I\222s\006f\317\206\220'ON\270\233dK\005\355\360\303r\266\267\025\007\03454xGN(?\341\004\331\356\220t\375\037\236vRj\320`}"
+	.string	"4\235ll\347\333M\262\2452\244\005r\0212\270\267\025\007\233&\033br4\371\371v9TH\027\245\037X\237n\227\313j\203\263\201\365\311\344r7z\310x\303\372\\r\2714\215\233\232\036\326g\333\345\262\330\355\320q\271\027\342\322\352\354\224\374\2270+\321i\034xv\323\236\221\363\314\02225\254\237\001\222\264\237ki\247Y\n'\233\036;\324"
+	.ascii	"\356)\254\0167ht\270`\202\365\251v*O$\347\221\323H\006:\322\377"
+	.ascii	"D;\321\364\033\n<{w\321E\331SV\035n\006\273\336\344\260\276\006"
+	.ascii	"5\351/\332=\237~\3228k\234Vwy>\235fAL{\311\t\210\270-9ZAp\204"
+	.ascii	"\301\232\b\272\304\205\357\n\326\327\020&\3755b\343\274\372\202"
+	.ascii	"u\3360\342%D\326\271u\357\274 @D\013 \216\363F\006LO(\030\361"
+	.ascii	"\023;\271\316\260{g\305\263\233\240\f\002\356\275\177\221\234"
+	.ascii	"b\247\216\276 g\3319\344\024r\0029\307N\262\273<\305\316\035"
+	.ascii	"?k\234VA\247\330\231\243\013\340\016\231\264%5x\264\215\203\311"
+	.ascii	"\200\351\t\005$\177'\330\371\343.\317\260\377(\367\031vv\235"
+	.ascii	"_\367\316J\271\253n\236\004\")\003\364A\316\030\275\276\253S"
+	.ascii	"\377\347\327"
+	.string	"\351\303\211\262G \326\247\227U\215,,\260\276\006\270\364?y\334\345\331#\025<\213K\203\365\005\017\246\312\327\016'\3515\264\245\327\200vj\245{\2008\354\260\276\006\262\364\032\304\322k\360J\257aGz\rW\3515\320H\377\363\352\274\261\304B\306\356\006\316\253\203\301\204\3655T\245Xy}N\016\267\347<\253\316\031\347\013\377p\247H\024\036oX_\003T\372S\306\377\241\005\276\264\274a\255\357\345\316s\352'\325?\304Y\304\306\242\260\276\006\026\351\317\030\247\324?\324\351\003\342\266\206\3651X\223\376\214z+$c\003\353\023F\352\204A\030\017lp@\321quB\375\204\361\237/\256^\226#A\341\0323X\347\334\236\363t\021\364\023\312n\016P\rk\234\333s\036\203'\351\351t:\231e\303\275Q\2638>\254\301\277\2657\034F\316\246\263\311\324J;\033\273\031r'\345\017li\311\324\302Y}i8"
+	.string	"m\224\225\235\301\372\030\3348\367\271M(+i/"
+	.ascii	"\267\225\025\207\233\245\235\343\016\353c\340\"%$4\325\f\367"
+	.ascii	"\206\033\273\263\332\253\302\372@\204f\0323\215\251F\017\255"
+	.ascii	"\t \324\037\223\236\232\271.TgG\260>P\2303gL"
+	.string	"\255\337\251\032:T\364\n\255\260>\020\027\323\214\031 *c\306\230\202>Z\342\250\252\344\3503\311\334\024\334@\033\331\030\254\315\300\\\247\003cKJ\016\240\2660\200N\306\216\244\007\022\362\305\316\004s\333\322\035%\215\361\343\r\310Gz \034\351;\\\263\213\235\351\247\225\364f\262\227d\004]\211\333\035\016$\225\376\207\220\213\231gZ\271m\033\226xvS\224\327\340^\236)\227\301\356\256\232\242\300\217\034\177[\362L)w.\335c\350[\224\016<<3\312\335Sc\0060e\355G.\375\317\222\3647\265\230Z4\013\024\366RU\bfA\206RI\300\b\261\376O\231\211\305\304b\326\211P\205\312\244\273Y\227\303\2257V\003k3\013\3362uu\245J\351\377\320\246\214\013l\b\326\377\341\221V\2113\255\230\271\370\331J\377\203E%\316\224++\374\231\221\376\007\352I\234)\305\354\351\002B(P\314(\\ek"
+	.ascii	"M\270\233Q\320*9(6\276\244\277\300.}{\323c\312\374\332\242@Q"
+	.ascii	"b\375\013\242\230JL%\246[\2313\213\022\037\326`.S;\"\306\344"
+	.ascii	"\246\333p\360\312I \326\346\222\\epP\313\023\254/h\242G\226\024"
+	.ascii	"\331j3\331\254\364\242\b\311pzL\316\254\316\\b\253\254>2}X\377"
+	.ascii	"\002ej\256\231k[.\340:r\304TK\353\326\370\260\316\204\240\211"
+	.ascii	"\355!\271\251v\201\224\231f\246i//\204cOMxMX\337\0024&\232\211"
+	.ascii	"\246\275\032\360\346\005p[aq\320\205X\262\226zff7m\013SS\214"
+	.ascii	"<\254o\301\333\220!f\031\n>i-\370\371\b,\013B\266\003\006\326"
+	.ascii	"\267\300,\375\315\260\2734\303L!(d\355\031\034\216\254\221\021"
+	.ascii	"\356\234e\241\0034\307n\n\371\315\037&\0203\bFkp\371q\005k'|"
+	.ascii	"\203gK\254M\261\240\233c7oY\326\210a\335s{\316\f\373\372\234"
+	.ascii	"Xy{\316[P\225\376\346\227\371\225\273\304\244\361\362\322^)\210"
+	.ascii	"\343\303:\003\303d\317\207\214\311\303\344!G\205\006\251\002"
+	.ascii	"h\005\353\373\300\231\\&\327m\343\260\227\226:(\323R\242\303"
+	.ascii	"\334\322aj\231Yf\226\251u\003-\323\203hwH\2606\265|\300\322\373"
+	.ascii	"\300Ho^]\023\207\211\203l\315\207)\275K\370\355\2326L\031\346"
+	.ascii	"\r\016z3"
+	.ascii	"\031\201\3467\246&}\206\300\3647i\2302\314\032\031\214gik\017"
+	.ascii	"\207\240\365\001f\350K\237!\213)\365\203 \202)\303\234q\347\356"
+	.ascii	"v\332+\306\320\272dp2\365)\263"
+	.string	"jC\323\336N{E\026\232\035 \325\315\252\266-\230\301,}\006\036\246\223\371\302t2\243L\0307\243\314\026f\013\023\n\r\315\230M\226+{Z\246\213\233PN\312\270\300am>\335\271\341\017)\\\242d\270J\237\301E\241\311Th6\231M\3466\267\271\204\312\320\352b\013S\302\3727\225n.\351\030\221\003<\323C\230\276\347K\272f\rY\217\0253:\215\031\215fpP\243a\200\331\331X\332E\027D\306\231\273\324h\3144)=O\322\367\244\375\351\300?-H\346Z0\327}\221\335652+\036X\207\t\243\307\2249\003\251p\260|Aq\021s=F\213\365}\351a\255\001o\333\377\241\316\232R\220=-\377\207\303@\3014iX\277\207,}\017W\372\345\313\235\373\331Jc6\250i\365\320H\257\373\256\366\363\313]w*m\262\303\n`\217R\372\233\273\316\353\275\253\271p\271s \320&LW"
+	.ascii	"\003\323\337;w^\343]\255\247\227\353P\330KU\035\240\341\245\277"
+	.ascii	"\271\356\334\262\305,\256\002\267,ZK\026mGG\247\355\356\236\022"
+	.ascii	"<\247h\355P9cb\253\273\266\033\022\322\231\335\300\372\202\271"
+	.ascii	"\356\377PH\356k\020\353W\300\225\036\303`\372\353+w\251\257d"
+	.ascii	"\036\034\322\342\226\b\352\310\202\3651\350U\251B\005%\375\265"
+	.ascii	"\234\226\313:n6m\256\263\261\275\255:\344\004)"
+	.string	"\302\306\204\36510I\177=e\312\235\273I\266\224M\213*0#\203{[\351\240\327\204\341\363\201\3651p\245\307Z\256\216\213\303[\256rK%@\213\017\353\214*=\336r5\034\034\336\362\263\225\304\200@S\342\303\032\304\260\237<1S\342\261k\322D\277]\252\275\227pl\210\333b\343\002F\223\232~\253\013A\230\026c|X\237\007-\3755\223\337\245f\242\003:*{D2\301\032q\214-\022\nB\210#\243!\323\007i$\256-\213L\016\r\177T82\032\032\376\244/\362@\2044\256-\373A-\"\035\207\220\306\017+\213\364\301\202\343\021\t\211L\"Q\027\222kQ\233D\242*\210\352Q\253+\322\221^\213\206\326\226=_\344\341\2105\372\220\264fh\215H\022Gl\211\244u\2104\022%\320\032\221$r\330\344:d4:u^\364\201]\325\026\214k\261\025bK\260\306\343\321htjx\221\207\017"
+	.ascii	"(\252G#\021\231\202\n \0230@B\005\021%\b\2310\"\205\022B\"N\b"
+	.ascii	"\241 \201\341E\036>\f\025\325c\n\"\322\004\226\204\272\"\265"
+	.ascii	"DU\005\317\213<\260E-\321\b\003\233\r4Xq\224\024\021\200\366"
+	.ascii	"E\036\210\216>\020\035\r!\221n\220*\260\311\n\021\035\341\264"
+	.ascii	"BH\242#\023It\224\213Z\"\244z<U\022\030Y\315\262\352Z,\022\321"
+	.string	"\025G\311!\275\266G\271\250\"\211\214G\"ZTY$\215L\032\333!\225E\277\n\021\035y\310Y\261\266\254\221H=\301AQ]\221\214,{\2025\362\360\030\245\340!\2621\262,\021\252\256I\025j\004*`aH-\022\221\264\346\244\t\360\200\034\262IA\004y0\262\354*\324&\333\233\234\240 \017\252\221\261\025RW\236\021\020\340\201\035\376\220\200A\307\b\211\315!<\030!\261&\032\202\007vxcdY\021<\26099\354\t\225]\211G;+V\242\361hLB\"jh\207\324\3258\202U\215\220Xu\315`td\302\310\005\023>\352ZB\322\372C\2044\262$\222\326\236\016\330\025V\020\217\352\210$b\tUEZ\320\032\221$\222\326\223]\221\216\307\022:\270\271\240E\252C\253j\242\002\255*\201\244U\003\243\024\305\364\004\341\301(E\321\b\211Mm\202<\030\245(\2628:\254Q\212\021F\226\315"
+	.ascii	"\202\007\243\024E\226\307(\305\b\243\024#0\260+\030Y\366\304"
+	.ascii	"\021[\242e\211\307\236#\266\204\315\021[\002\003jd\331\023\255"
+	.ascii	"\312\352\f\2559Gc\213\\\341D\021\251\036\261Hl\006V=\036\031"
+	.ascii	"\021Q$\23582\262\300\346\260+\264%"
+	.string	"\264I\252\005\222V\236\242\272\032\221F\240\236 B\032\211-qD\322\372\323\301\nE\244\332\022\217HCG\342P\007\023\354\021\311D\321x$\266\200$1\264\366\024\215G\"\006NHZ}\314\027y BJ\241\026?\024\217F\244\024j1Yb\250\026\223%\220$X\022Ik\005E\265\005\243:\244\236HZyV\244\244\261\005b\221\032\001\226MV\340HD\022\031Q\024\221%\264Cj\253\0269\350\300G\007\204\207v%\036yP\221\216D\f\034\215D\025I'Z\225\310\247E\"%E\350\270@<1\264\232+\210\353Z\002\007\254J\204$\226\300\026\211\352\n\204L\266\304\025\351\304\212\343\321\021q\003#\313\256\332\206\330\022G\f\255g\211\f\230 \201\002\305\t\265%\026\217\220r\216G$$\317\361\210\204\334\021q\342xDB\346\260\001`\205\220'\264*\253\236 :\332\340C\306UE\252D\351C\030\341"
+	.string	"#\220\220\204\236\004\005\200P"
+	.ascii	"\210\363$( (H\001#\004\245\037!(\257h\215G\"\322\005X@\032\217"
+	.ascii	"=m+Dl\217\352\b\325\310\330\336\260\253\332\266j\005\206V\236"
+	.ascii	"\027\021\251P\213C)\210$ `\004\021B\b\001B\220\n'L(\301\307H"
+	.ascii	"m\331\025(v\326\325\004\235\353\264/\362\240\342\0032id\224\034"
+	.ascii	"\322\300\302e\205V\265=\032O\bj\217n\324\226\330\262f\253\n\251"
+	.ascii	"C+R\022E+\304\256\240\032\031\333t%\026\r\351\266M\252PTY@\032"
+	.ascii	"\217)+\204L\032[c\021\231\024\201L\032\215\200T\241\"\211\244"
+	.ascii	"d\n\264HB-&\215\316$\265\210$\201D\334i_\344\201U\213I#\240#"
+	.ascii	"\265EQD\252(+4\244s\244\266(\332\225\330\262C\225\bI\\MU\350"
+	.ascii	"f\310H\224\254\200ZL\032\r[!\020B\024y`\217\311\265E&\207\204"
+	.ascii	"\206\326\017C*2\030\021\242-\"2\036U\360\270\220<\352\024\021"
+	.ascii	"\031\213v\212!\216\304\265ER\221C\365\330\266\311\265\250\025"
+	.ascii	"*\206(\"\211)\212D\265\330\343B\362xSDd,\022*\206h\215F\306#"
+	.ascii	"N1\204ZL\032\t\025\325\242\241\326\350\002\273\323\n\331\250"
+	.ascii	"G+T\320\300\t\0248&xZ$\322\020\216\332\022O\024\261\352\252B"
+	.ascii	"=\221\264\346\254\255\t\344\t\304\2268\302\005\342\211\"Q=1\264"
+	.ascii	"\336\254\255\211\n\220'\260H-\261E1\264\356\254\255\211\236c"
+	.ascii	"2\031\001!\023y\202jD\\O`Yu(\271\232\030Zy\210-q\304\r\261%\216"
+	.ascii	"\030\262BjKlQ\250F\306\026\211t\"i\345A\211\216\222V\233#\242"
+	.ascii	"\321\320j\256j\321\330Br=*\252I\353\221h\\U\026C\222z<B\032\241"
+	.ascii	"\342H,\262Q\213\306uU[H\n!\215\033Z!\224\210\250B\322(D\204t"
+	.ascii	"<\372\301\320\252\254\272\026\221\306\024B-\221\0252BZ[\026\324"
+	.ascii	"#V\003\216z$\016\331\264\253\332\002\3228\264\026\215F&\322h"
+	.ascii	"\224\2620\244\026\r%\021\215\322\035\366Hl\001\2314\266\304c"
+	.ascii	"\362hU[$\211\241\365\002VUW\"u\204z$B\226`D\024\321\302\221\212"
+	.ascii	"\n\212\307d\021\253\256E*\250-\261\005c;T\202ZL\226X\215\304"
+	.ascii	"\037\244"
+	.string	"qHe\221\204\222\210FBI\353\315\220P\022\022Q(\211h\264\303\256\311uU}\316VeU\250H\336\250G+Z\f@*T$[\244!\rXc\022Q\210\b)\205Zl\221\216\220\306\013\324\243\025\255\220\332\202\261%\266`\\\325b\006k\262\035\"\252\020J\266HD!\"\244\261\250M&\215X\241\241\365\247\2304\256\352\221\220\212\243\243\220jD\\U\b\r\255\254\220\221eW\240\242Q\2505\"\221r@8&\255\354N\313\022U\b\025\221\210)\204X\244\024\254N{\244\266\254VU\020\331\243\221xB\322\n\324\n\221\320\"\215H\250ZL\032\351\366E=O\036\251\353\2076\231\\?\334$\021\2152+DdT\201L\212P\211\220\304\023G\025\211$\026\211HZ-h\205F\bj\221F\244\364AA\"6\254`\001\t\244C\036\222\326\017I\353\007\244\221h\364ahe?x\250"
+	.string	"i4\312\377\321/\\\372\270\320^`/\247\336\216\023-\251=?&T\211\266\004\353\202\366\001\341\373\261\003\353\033'\036i\006\271\240|8YqVx@\261\322\242\004\353\273;T\317\313"
+	.string	"U\264\200\f\352\345a\031\313+<\362\360N/oOzl\321K\303#A6\332\226,e\376I\271\n\202\3659P\322bj\331\231Q\232\t\213\f,:\263\t\275\202b9\232\345h\026\214f\311\205\205\347\021\275%\247\025\2553\210e\317E\025-h\312\275)y\315e46/\304\260\n#\207>\241\\N\234\264P\321v\251\026\0174MS\264\227\r\257\035R\316)b\212\224\t\213[\216\t\354\202\004k\364\t\372\004\205\033\356\251\300\ruJ(\224\243g\030\250*.\033\310\244mm\350\233\030z\003\006\2171L\216\276\241M\232\334\254\334\260F\335\256\217*J>\260\376\206\270\024]\222\273\362n\370q\331\360\226\376(\033\221\032\200V\\\260F\257N\270\2221E\251D\223\214Q@\036\232\265\243I4\031!\241\334X\231\332\371v5\243\212\013\r\r=2\306"
+	.ascii	"U\224p\021b\344\350\0219\247/d\360\260F\323\320\"`\351\217\236"
+	.ascii	"\3516\002\264\200\021\005\025\202\nA\211\334\251@\0010yq\242"
+	.ascii	"2\210\222\035%\202\226-\267\\\\A\313\320!\303$0\264\212(}\320"
+	.ascii	"\005\276m\250J\1774H\256\273\241K\242fn\314\254\303\022f\347"
+	.ascii	"\004k\024\f\005C\201\f\225t\274\344\025\002\3768\nD+\355\370"
+	.ascii	"\365\220\303\2025\032\226\353\360\b\177\230\331\340/\375\321"
+	.ascii	"/=\346B\221\211\201\346C+]%\276%\230\227fa\263T\"&\252\307\371"
+	.ascii	"E\343\005\246\331\343q\212A\311\226\316\n\273\262\026\037xU\n"
+	.ascii	"\271\316A5\247$\202Xc#J_@\260V\352\374\210\341\003\207\226)\344"
+	.ascii	"\246\020\214\214\222\254\223.g\201+3\323\221S\267\277\273\027"
+	.ascii	"9t\227\336\327Z\031\024\207\326\252\013\223%\b\226\276Z#[\342"
+	.ascii	"a-%\005\226u\343\204\353\313\352\202\201\265\f\031\250\325\031"
+	.ascii	"\bt\306Q+\264\006\225\332\030*h\r\224\306\215%D\2328\271]UZT"
+	.ascii	"\241/d%Sfd\354m \207\306@c\240T\257`\t+\004\253\031\034P*t\312"
+	.ascii	"H\330\325\025:\205J\235ff[\362~\222\220\345\300\372\0338I\177"
+	.ascii	"4J\277\355\baBB\207\302\3203\240\320\200H\275H3a\244I\023\324"
+	.ascii	"u\224\025\013&kX\2439\272\321\240O\371K\272\225\224\333*KI\f"
+	.ascii	"\tk\274\004\206\315\250\303\001\344\202T*\306\020\203\312(44"
+	.ascii	"3\244I\206\003\303"
+	.string	"\025@@@<\036\023\n\327Q=\023\300\203\312\254\245i\036\007\231bffDD\222\202\224\223\354\034a(\003^\022\374\246\nY*iD\2545\333d\3466\303iRvI4\334\264v\020\331\264\306Pj\004\263\230\277h\002#\236\251\3224\272nb#\203\274\325\023\bu\343\224\315*\032\227\335\302\375\300\367\236\254\3173\314b\026\312|\024\372\216\203\030Aj\306!\306\233\364\273\240\273\310:\177\033x#\021^\034\321\fil\226\306vF\2329\306\300dT\304\f\004\230\337\223\327\223\364\301\007\002\230\356\202\273\356E.j{E\035I\004\021\267\034M?qyH\307G\373.\210\274\311\244p\265\224\273\024:B\274o-)\323\374:F\177~?\375\304_\314\372a\346V\313\272\273W!uzl\0325Z\355O>6]\214Z\353\001(&)\243\023\252,\202\234\356\276\027\006\n\004\211\226`\026\022gs\213\363 "
+	.string	"\213\225\260\025\246\271\201\242^+?H\257\266+z\362*\304\316\346\201\200\305\tDs\242\237\302\242\347z\324\357\251)\322\246\300\210\214\204I\310\313Ss\325\024/a#\373\255Ho\352\373\324n\207V\031\377\\\233\356\303\264\224\224\223\270xaT\022\251\372\202W\244\233\320=\310\364K<\001R"
+	.string	"\bSY\367\224-\024?\316&\245\235\270pP\253\220\373Kh\234\310\007\016IV~\005/\274\204\340\020m\270\317z\016O\"!\241\027`ne\211JN#\276(n\251\255\b\034\032md\317\227\250\226&=\221\344\231f\346@\371\btz\246\325\271\226'wZ\256\001\023\324\256\205(f\204\207\334\261\345<\006\302\301f\306\200\035\225\351\017\\\033u3\247\333n\250v\320Pq\355\315\331\240\370\036\352\206\351Uz\357n\374\371\354yo\2106/\260\344\236\334\231\321 \nJ."
+	.string	"86\255\336\362\t\254\203K\">e\213L\360\177\311\304\201l\372\374\264\360\033:Ay\"\330\204\002+\312\303+b\214\303\352PV#\223<\263\222\200l\347\345\350v^\325!\373M\207,\027\206\rd\222\213*\007+)\245\006\262\251\316\310emr\003\203\362\221\342\327\201\260\301a?{4\273s\377k;Y\23740\320oSO\330\204,"
+	.string	"\203\347\313eb\274\311q\026\330\2248#\365H\3567\367\314zr\271nI\245,e\312\224\243\2710H6\270\322C_\024\252T\241\301\311\361-2F\035W7\217\315|\226\002\364\305q\325\301\264\025\341o\235^O\371\341e\370\342\026\337\211\200vx_\005\272*\f1J\007\223\023\326"
+	.string	"k\332S\2152`t\023\250\377\273\337ei\253\317&c]I\320Z\316\245\345\\\300bgW\206(\013\221z\025iHq\317HCe\016Qe\003\242!d\3538\347\253f\227\270F\r\353\247\320;\261pX\023\325&\344\3341]\367\265\3302]\256`%$\t\2405I\243\201O\327\021o\206L*R\327'o\022T\356\256\020\007Y\313\031f\345\324\375\f+\300\306\205d\177\375\300\177\216\240K\b:&\0246\240;\314\234ctX\346\275d\200f .VJ\bZ\024\352\256\331\334|1\277\t79\034\254G\350\216\277\325oB\037q[\013;\307\254Pyn\357\204\251.?9R\"/F\330LX\262\363H1\202\036"
+	.string	"\276\243\302(6R/\344C|\377\337\3115\232h\325\352\3467rg\272\243\243H\226\352\222m_\363W\360h\305<\267l\231.\032\254\210\263K\326\310\005\231\035@9\270\270\262\346\"\021>\251v\345\0251P*\004)8\025\343\222h\355\376\315\226\246\236\007|\231\321{\021\234I\353L\342\3554\337\354\300\263:\275\324\325\254\\\021\243|\023\020+\213>~n\002q\324e_\264K\210\340\342\237G\b\212\221\305\261\314\327?\343\311\211\326g\263\321"
+	.string	"\255f"
+	.ascii	"\265h\231ra\313"
+	.string	"@\024\007i \211\001\035\301(+\266,<\332\255Q\341%\330\352 G\224\361k/`H\3435\222/\f\376\330P>\016\231\235\257\326m(\331\213\"\241\316\031M\216\f\202\n\346\357;;\274|P\n@Q\376\220\327\271\332\370\007\205\323\334\276I\224\233e,\251\326\25503&\272i;u\007i\033#\202r`nrZ\324\013\032\214%X@k\363\004\345N\212\372\314\026\006\3336s_\016`\226/9\256\224\241\367\300'=\353\243\335\255\356\362Da\2262-\225\216\345\222\2243\203\361&\372\241\235\r\203\312*x\364L>\356i.\246\257kg\302\357\236\237\215\220C\253\350\021\367.\265\022\303\326\005W\347\341\rX\231\b"
+	.ascii	"\024\317\177mT\317\n\027xmtNs\234h $\322\365\372\013w\0348'\313"
+	.ascii	"\020\324\321K\366\202K\326\305\022\315\311\340\342\206]e\312"
+	.ascii	"W\334\220\226\006\302\n\360[\0238j\021\377\201\273\0366\276\321"
+	.ascii	"\266\355\001.r\253\354\210\227b\n\0309\253]\004\301\326^XI\376"
+	.ascii	"\223\242_\025\300|\356\270a\211\020\334\177\210\234O\312\001"
+	.ascii	"\2526\370K\001\301\272\261t\026p\016\031-\001q\372x>\264\242"
+	.ascii	"\325\263EF\206\212A\035\217\004]Gu\245\241n\341\226\302\232Z"
+	.ascii	"\300e\315\362\341\300\013S\251j\347\r\007W\024\034c\344q@6E\006"
+	.ascii	"\017\237\232YV\322\315\222\332,\341\242\322\250\351Y*"
+	.string	"\205\001\214B\324\023v\034\276\373=\204\211\204\263i{*\253`\352\252U\245Q\374\354^so\211\013\335V\177\r\r3\230!\313fs\216\013C\335\037,\021\221E\263:\334v\266\022\3037Q\273\373F\024\364\3426\276\3254\322o\024\276\217h\353\250-\033e\305F!\024\246b\271\003\371\327It7\f26V\314^+\302\224\026\255S\007\237\260:\241\315'\3544\246\246v\371\025\223\220L\374\"\317M:\266\276\f\201\267\216\334\327V;\227\020n\265y\006\234\205{\2152\0060e\365\251a\212\311\032C\265\230\303\365B6'\200,y\031I_\232\203\200\030k7\300\373\206QN\361\301J\006BN\227\325&\246J\330\227\237\340\203\335\231\347\b\fz\361\b\316a\330\001\006f#\240\364\221\033:\215@\032\253<\203\340\022\031,\266\025|Ih\003\343\334\231\245\324\363\251}\023sS\024\203\031i\305\370^\376\361"
+	.string	"T~\201\325\037:;\237\t\337\240\206\232\315:\351}\320\223;8F\370\306)q\232\275D\022\260jf\275\377<\255\341\254\354\305B\375\032\256:\210\223\211\032w>\271\240E\220PY8H\342\307H\210Z\036"
+	.string	"F\242\305\315\273\353\205\332\202\305y&F\331\340\346\325\235\330\211\r\341\303\253\245\232\230\236\371o\256e\370\266\337\332s\020\210R\036\270ba#\n\b3\307\343\300/\323\325\367\204|I\340i\342\005r1p\264\230|Ab\346\002\253S-\234\242\343(\300\347\335\221\251L\030C\262\031t\030\376\267\377\333:\224v\325\377B\376\2770\207\207\266^\3028\n\2063\370rP\234\347\203\231\347\301A\267\224\311|\242\301p}\242\337\337\301\365w\267\004\213\326\003"
+	.string	"\r\031\327d|k\306G\333\341\007\242\331\3035\277\314\316\331x%\273"
+	.ascii	"\t1\271\b}\356\023\324v1\033O\224\023\321\2753\232(\322s\363"
+	.ascii	"\022\005\351\311M\2352\337l\226\f%\315\0378\\\307`a\216\0310"
+	.ascii	"\251S\034\016cq\224d\205\002\224\363\300\025\203(W\30127\361"
+	.ascii	"\335V\262$\226\372\0336\bP\340\215\220\336b\013\204\332\210\332"
+	.ascii	",\271\035f\365\270k-\220v\306\210\370\335\267\377\322Q\242\270"
+	.ascii	"\310\340u\206<\001\240n\337H\215\313\340\320\267\272\0138\233"
+	.ascii	"\200\237,\003\233\266v\216\257\340\312L\034\242\227\373\337s"
+	.ascii	"'\035`\373\254;\321\211\005\242\022\202Q\254\307\005\216\270"
+	.ascii	"P\220\227\177\b\304\027\004\273\235\034\021\177\227\242\315}"
+	.ascii	"\300\033\264-\277\2258G7\223\007n-\013\276aA\330l\266\204\206"
+	.ascii	"IsAS\255\254\362\222\270F\245\035 \021Ft\336\336o8\332?\260\230"
+	.ascii	"'\001\240\342c*\031G\345F,\274"
+	.string	"\333\376\342}\017q\2701t4o\025\0021'\366A\245*\272~\200\327\3727[\305\237b\324\005p\363\023\300C\017\222\233\002\355\230\272\220\240K\373}\315X\320`\270W\276V\021e\302 \363\310\030\342\177\005\337\241.\005x|X\205P\322\377\032R\366|`\031\250\352\301\023y\343n\215P\314$\036w\342%S\374\3640\001\t<\300\212QbMpE\371NL\236\353\016\277\300LE1\024\250\251\201\345\244)x\340\355Q\365\3244\t$\206,\350\017\347\367\001\216\234lV\017\f\244\236\214\341E\225]\036\304\b\017\316\r\234>\230T\325\354\030\213QDe\235R\2122 KWeg\327\243\254*\351N\375\334^\\\207\235\325\205#\003\320>sD?\321K\202\235\200\222\004^\241\254\3370\177\323a*N\277\273\r\222P\210\370m\271X\0210\t\003\313g\255/[\312\232b\347&\220\232\224\022\265{4\207E"
+	.ascii	"\fj\243Z\001\301}*\031\026\246 \361\334f\310\300\nvF\007\364"
+	.ascii	"\306G\024\001\030sW\220\017\365\210\216\227@\367p\210Az\351\004"
+	.ascii	"9\3047\302\352\003\324\177F\034\351y-D\017#\007\346L\261\371"
+	.ascii	"\300\005\200\265\354\321\321\236N\005\322\257\203\327\220\341"
+	.ascii	"\252\241\260\242\377"
+	.string	"\262/J&q\326J\347\r]\236\320F\277\024\204h\274\347\246\353t\333CS?\365/\0370\214\360z\023+\230\260\005\312\016\032\177\340\325\351\213\374\202\362_gt\213\304%\027RD\232R,\370\276\212\022<_\3502\177\340\345\267bQ\266r%\022\002K\304\0012F\016\263\027\352\023P\030\337\020Z|\231\247\200\235D\250\277|\031b\025\363\314\266\251\206\220z\036S\321dr\031\023\336[\035\260v\030\246\366QfxSwU\312\367r\254\354d\364M\330\227a\263\325\023\303\262\367*\b\006>\302\252h\310\036Z5\254U\\,\253f\215\254\027\030\202\351\273o{\370\024\376\232)\325+\243\212\276\234\n\365\r\034Y5LQp\001H\207\261s\201\021\303\354[\334\031~\200\002JN\362\206\030\b-H\266\013\335\212\356\250Z\271\2402\245\340\354u\373\356\252KzY\263%\027\260]L\373J\274\0239\234,\305\256"
+	.ascii	"}\3625!|\t\351\031\306\233\3529\253K\265c\313\031\22526DG\371"
+	.ascii	"#1\304\365P\"\0167tJ\001\004B\256\300\201\315\205O\344\351\200"
+	.ascii	"\013l\216w\203]6Yp\332\013yV\231\224\361\304\343\253\020u\332"
+	.ascii	"\202\252\271\033\217sW\317e\177\\\311\032\326\234\361\003\n\300"
+	.ascii	"\204w\327\300e-P\334\013C\021\203\005v\201\016\372wH\355|B\360"
+	.ascii	"\250\277{\350Z\024\371\306\214\177\331\270'\3067r\256S\3059K"
+	.ascii	"\363\2240\f\352t\314\301H\030\362\025g\216\235&\346\371\320>"
+	.ascii	"_}\310\344\243\3564\350h\337\203\023\334Q\301\347\t\351e\220"
+	.ascii	"\333\304\217B\372\037,\357,\254+Ymw}\346; X\233\fOh\313{FeYs"
+	.ascii	"\337K1)\247\025\024\367\273\3760\371\301?\357E\fx\204\323\310"
+	.ascii	"x\225\331\355\204\360\b\034\3320\244?\n\217\361\304\277a\362"
+	.ascii	"#\260\247\213\177\211I\307\210\367\243@\206\030\031\002J\337"
+	.ascii	"\221\340T\312\272%:\263\347\021jgr\272\215\306\357\242L\207s"
+	.ascii	"\326\004\177P\345$\240+\321\033Y\344'"
+	.string	"\370'O\022\333O\333Z\034O\214\307\tr\237\270\222}\276\321\1772c\361\203\377l$}S\344\307\3253\260\037\220\355)P\204\373F\254 \330%\264\331$\333\373\212\257\343{q\353\367\234U\246[\272\332\033\370WU/\251\235\205\227}\224b\226v\276\236\271\315\356\003*\232\311\355_\030\334w\274n\337"
+	.string	"\362\376b\307\b\375\203\230\315%\3231\034k\324\220\200\374\022]\t\342Q0N\033\237Y\206\213\354\007\275\270\365\312\335S\277\224\372\344\343>1\232C\367\261\213\347\223\2049\303\326\314\370\274\352\347\034:\236\334s\034\216\353ca\363\271\232\205_\267?"
+	.ascii	"\347U\3762\353%\274\332A\304\020Q\337p{,\224_\225\303\245\265"
+	.ascii	"F\266m\254\372RLs\213\215\247\036\376\024\316\2754s\341=~5\220"
+	.ascii	"S\346n\024\370G\3752\b\236\267\365\333Z\256\333\373\"\362x\307"
+	.ascii	"\376A\270\323:\2479nt\345{6\363\252X\007;\027\027\333\315]S\227"
+	.ascii	"BlS\266\007R\026\360,\271\261\017\226\325\022\372\305x\234Al"
+	.ascii	"B\341\267O\374V\377M\356|_\272}\006\024r\337\336\024\270.+<\217"
+	.ascii	"\3725\021\344\372\312j\220\233\276\215\342\177u\344O\376\357"
+	.ascii	"\267\202\257\255\215<\177#\320\003\377\203\034\340\026>\247\n"
+	.ascii	"\377\236\247t\020\342F\2573\200\276\253\356\r\301\221\302\355"
+	.ascii	"\374{8\336@\273\255i!\007\376\2248\224\020>\227\356\022{\036"
+	.ascii	"h'V\346\260\277\025\177>\303\301\354?\372\235.9b\370\025\212"
+	.ascii	"\273uq\371\305\325\307\333\277\307\007\262\220\213\002<l\334"
+	.ascii	"\264\313[|>\270\215\336\205\245R\311\356?\371\273x\304\255V\323"
+	.ascii	"et\254+3\252+"
+	.text
+	.section	.gnu.lto_.symtab.3d03625a83eb736c,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"rxRuntimeState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"suspendRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"resumeRxPwmPpmSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"setLinkQualityDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"linkQualitySource"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"setRssiMsp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"getRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"getRssiPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"getRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"setRssiDbm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"setRssiDbmDirect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"rxGetLinkQuality"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"rxGetLinkQualityPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"isRssiConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"rxChannelRangeConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3d03625a83eb736c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1473 @@
+	.file	"srxl2.c"
+	.section	.gnu.lto_.profile.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`x\002\255\017"
+	.string	"&\326TF\020\2176\215\001\300\272\271\340\343v\002L\370\245\300j4k\356Z\001\033\003\346\341\b\310`\310\372\177,z\361\023U\004"
+	.string	"*\200"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"E*\35395\200j\377\377\377\337~\377\277\333\250\211\210\320&Ir\223E"
+	.string	"@"
+	.string	"B"
+	.ascii	"\251\231\013^\366>\226\240\244E\325ikg\323\327[\205H\220\301"
+	.ascii	"i#\\dP\261\315\3475\266o5\200\212\261!\343\024\244bFhfb\242\305"
+	.ascii	"\013\214\272\300Xh\271\256\347\363i}\352LhDR\254\017\353:\020"
+	.ascii	"!P\347\355\274\332\207`\201\006\020\242\345\2250N\224\037\316"
+	.ascii	"\234\303\303\301\351\337\233o\357p_TXV\325CI\324\311\203Nw\307"
+	.ascii	"\275s\037\371R\241\001G\2434$\3122\0047\337|\276\275i\353!\203"
+	.ascii	"\006Y\246\004\n\027\217\016\216\371\354\356\n\254\212LA\331\330"
+	.ascii	"\367\362\276\232T\007"
+	.string	"\224\306i_\272AXq\ba\022E\254\2203%R\255\357\342\342\365\317\365\032\342XD0\240\214\346\3233]\022\230\032\007\242\326\370\270\373\370x\335JTfP\0300cdBT \002\366\365\270c:'\214D`\020\300\332z\354\344\303J\212\217\t\254 a\001`\334\33686\3268mZT\032\2344\370hp\320\340+\nN\250\201\245\300133b\n\nRIcP\002cd%\017\022\300\364\n(\305\242[\332j\375\317c\205\f\363\320\307\341\306\351\b\207\025BY\002\246Cc\330\007\322\224\335B\267\016$\235\236\266\363\244]\2006\216\362\357=\233\0160\321\256\252\266z&\027\222\\\243JW\342\261\223\332\222Y\357\274Vg\023\245l[P&\314<\376}[\274Y\334a=\023\307\273\203\035\352ae\345\254`\0136Y\207x\274\354\242\201R\006\351\234\372\314.\221\327\324\314@\376\350\300\3553\226E\376~"
+	.ascii	"\275\204\bw\353"
+	.text
+	.section	.gnu.lto_.ipa_sra.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\035\001\r\007"
+	.string	"\002\t\031\035\200\267\031\0167!\0232\001\034\003\221\"\2640\374\333\026Q\345\0232\322K\315\356-S\n\356\032$\313\363\274`;H\002\344\200&\204\017\266\200\207"
+	.string	"TC%CQ^\374\"\025\242]\3425\353\022M\to\204\236\016\373\fB\\\276v\2275=\357\365*M`\317\200\016\265V\3161\265\247\350\005D\327\3061\0019 p\002\021\203v\003\356P]9f\006po\324Zv\303\332\205\030G\316\334\001\355\204\306N\262\333Y\226g;s.\2676#\030\356\322eoZ\247g\3708\312\003\\\007\271\027\3224\354\001#z\270\260`e\314l\201q\225\01669}\265P\220\341\350"
+	.ascii	"\355(\217\333\300\300\202D\203/\r\032\267\241\\\007u\r\026\001"
+	.ascii	"\323b,D\b\374\024)&\030\305\371\365a\225\304\024s\b"
+	.text
+	.section	.gnu.lto_.inline.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`~\005%\030"
+	.string	"f rI\320\322(\035\264\027\302\363\316P\007V\245\030\026\025U\307H\357n\212)6\027\375?A\224\322\035\261\033\227M\201 \360Cj\317@{&\001_<@\352\341\013>a\244o\252S7\220\202\247\002\267\207\366\277u?id'\231\002S"
+	.string	"a"
+	.string	"c"
+	.string	"\242AQ\345\205\036\205\335M\261I\r\244\021H\032\234\036\013'\243R\323\267\333\263\347\3334\224\237\355\331U}\033\351y\365\2559\223O3\273+\273m\222\253\325j\362\335\356\276\\B\375~\370\335\335\317\316]\345h\310F\355\266\346\036dEC\212\020\033\346oB\252*\363l\227qy\361\271Y\016o\263\273$\237\205\2237D29&\373\301\205v?\033F\276k\202\253\326(\355\020lKk\005\024\037\355\021\354YQ\336\362b\364c\346"
+	.string	"\266\224S\306\021\013P\212\007\004M\216j\325:i\212$!\"\306E\354\376\251\301\301\207\313,\033\024%n\336V\023\224S\006\003A8=++\213xS\245*SgxJ\003*\362)\270\004\313Q7\372\264L`\347\306\213\234Y\364\301\006\250"
+	.string	"\220\020+x\304V!\006\305\025IAQ\342\246g\273\344Z\273\352\255'\237\031\340\340\272Q\247\342*\323\306I]\216\230\035\261Q\007\020\023\002\f\263=\337n\303\344\311/+\211U\362&(\252\035\206\271\207v\027\300\253\344\037\314\356\266\\\013\275\023Ybw]\246\335\036\312\031\356KR\262\3552\315\351\333\364D,ZtV6\312\205n\212v\f>\177\350;\024\t\003\003\016\017\013|"
+	.string	"\024\365\302g\233<(%F\013\255\271uN\260\354\270\207e4\216x\306\330\235a\204\221\013\314#\343\213O\207\323\035\200\214\250\021E\246\314\210\315H\n\n\222a\fP\0021\204\312\314\003\022"
+	.string	"\205%\311Zf\206f$\250 %\256\327f\374HBa0k\261\372\223\331\030\005r.\240'\277\335)!\241\302^\354\203\343m!\323:6\302\002\234W\r\t\363\333\003\223\335~\267\331\326\220\021s\217%"
+	.string	"\266\036\202?\376\177\312(,\001\022B\330\021\245%\335\005\202B\003\214"
+	.string	""
+	.ascii	"L\257\235]\343\200\031\351\375&\331HoE\333o\255R[B\332\302YA"
+	.ascii	"\250\335\326\224t:\313yc\201\364\240J\026S\013\177\033`\372\344"
+	.ascii	"\354p\226}l\361\034\355\350\037\253\340\300~p\304\220\013\300"
+	.ascii	"F\344\027\256\305\303\006\tbJ\322h\233\317\006\354\230V\335N"
+	.ascii	"\267T!8#=\207\244\026\304N{,\260f\271\"\225Tj\241\350\2513\354"
+	.ascii	"\304s\276\341\202Z\220C\350\367bc\031P\306\0217\233\367%\311"
+	.ascii	"\311\342\nM*\253Ln\347\267;\345\236\372\236\232\n\213M\025\007"
+	.ascii	"\245\300\352b~\bv8\336\276o\310\265\266\305c\017R\215\240\312"
+	.ascii	"\205\232$\243\235k\031\350\256\224h\323}{\251_\221\203G\237F"
+	.ascii	"3a\210\002]1"
+	.text
+	.section	.gnu.lto_.jmpfuncs.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`t\005\225\022"
+	.string	"\346YM9@m\222t\306\301\202\362\264\226\307|e\372\007\242\303\310n\302_\303s\0214\207\321\351\312\032\006\020\025\321Di\024\344\272\002>SD6\324\344\361\353ah\350\023A\204\310$\003:"
+	.string	";"
+	.string	"@"
+	.string	"\001z\004H\301D\024L\364aXUN\231^"
+	.string	"\311J>\006\357\373\313\260:\037(hZ$"
+	.ascii	"\336W\225\341*3\347)u\363\275xz\254l\276\021&(7z\351\313\034"
+	.ascii	".\b\001\351\305\321\263d\314\3417\334\007q\207\252\243>E^)\036"
+	.ascii	"\260:\224j\272\323\273\370NXc\215!\f!-\227\226;#{\270L\255\375"
+	.ascii	"]XM-\265IbU\261i"
+	.string	"\255\265\333\224\001  \023\332\240)\223\371,\254\362\226\260\351e\224\025\226\202\351\020b\366\301>\020\314\241\325o\367@\323\373\0325PJ$\2215\326\320\323?}\001\006-\326Z;1\264\322\315\212\320Zk\0341K\254$W\231\311\244\227\030<]\203\t\312\323\t\306S~\250x\372\205O_T\244\305\243\016\232$DQD\341\273\322\324\347\270\\\216\"\307\341MU \362!7\026qk1\264*,*\254zt\301\275/\200\203\2501\275TRB\263%\205Bkp\")fT\017\022\200c9\006\322\224R\206\251C)-m\354w\351u\224G\b\325Z\237'\017\216 \025\212R\201\273\361S\364.\377\366\321N)\364\240\225{\317IT\375\tD-l\322\035\\'Q\2036gad\273\362,5\320~P\330\247o}\202\r}\331\na\373\n\345E\022\363~}\250X\032B\270\007Q\352T\202V\221\251P7"
+	.ascii	"\347\035\016\267\031\241\026\202\352f\340\034\316D\325:\323\375"
+	.ascii	"\n\001X\347\246\n\262\343G\001\342\265\233\n\024\036\364\313"
+	.ascii	"\212C\013\200\035\352\370\356/\277\254\250G\r/S\216\320*\232"
+	.ascii	"-\206\374\013|\257TL\005Bx\2041vGc\220W\346\273\254\3039\\\342"
+	.ascii	"\325\350\315+p\233\206\217f\226P\b\216\324\031u\027\00333-\366"
+	.ascii	"\376\234I\2701xQ\337p\033U\275\021fH\350\004\240#\313b\266\206"
+	.ascii	"\362)nV\304Ihf\330\307t\001\245\212\206Bj\361@w\rH\200\005LC"
+	.ascii	"ee\364\036\275c"
+	.text
+	.section	.gnu.lto_.pureconst.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375 G\365\001"
+	.string	"r\204\016\026\240\2531\374\234\363\377?\374\007\307}n\236\317\327\357\325=(\227\001\2434F\027\232=3\3476\227\271\313\250\234\311\211\334\343\\\243q\213\223\270\303\025n\301\r\270\352\336\272\273)"
+	.text
+	.section	.gnu.lto_.ipa_modref.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\276\001%\f"
+	.string	"\306\223=6@\305(\303\001`}<>.\214K57\033\272\230\230\033\326\223^`\032\206\231q\353\365\177\002\374\313m\321N\322\372\220\360Y\276\371\030\212#\2450\330\345\260D\312\024'"
+	.string	"-"
+	.string	"4"
+	.ascii	"k\325\346\334"
+	.string	"\225K\264\277E#U\340zZ\177\257\345ZT.\n\005<\255r\253\023T\016\352\374\224\177j\255\331}C\002\316MQK$\323\214s\033\213\026\357D\206\230\353//\327\304\312\261\316Q\371\250%\250j[\251\266\247\271\347_y\225\327\001v\312;]\013\355\241v\301\245\234\200|\274'\251\300Im%(gQ\00685\341G\200\370\300Tn\322pR\333jd{\332\027ID\rZ*/\221c\312I\305\260ME\003{2\017GGf\371\301\341\371\326\n\3127\032\236\201\235\254<\353\324(\317\350\305m2\277\270\242\314\213\321\n\200S9\030\246\266\207z\357=\017b\327E@\25011b\006\032\013\303\240$\245\016P\0021\312\325\036\020`Fc\2331\0024\221\341\211\006`\024\350\343\016\305\f\364\n}\231\207\"\300\321\317\270U_x\345\242\007\326\247*\336\337\001\230\2412\264\b\371\"\346\023\362\22738\332\322"
+	.ascii	"D\260i\200\347v\221\004\032k\032\235a\357&!+@\316\223i\324\223"
+	.ascii	"\363\037\235<J\206\256t\312:.CL9e\220\333\335\264\251\"\264\222"
+	.ascii	"I\327\031\343\272^1*\"\301\362\235>\240 (\003"
+	.text
+	.section	.gnu.lto_.lto.701a6387fbcb8810,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_readBufferPtr.33.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\303\346\241\013y\275\001,"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\350\037w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_processBufferPtr.34.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\002\177}"
+	.string	"\005\001\254\001"
+	.string	"{\274\001\273\001"
+	.string	"\005\0018\200\200\200\374\342\203\347\321\013y\275\001-"
+	.string	""
+	.string	""
+	.string	"\212\001\202\200\200\250%w\276\001"
+	.string	""
+	.string	"\013/root/repo"
+	.string	"\026./src/main/rx/srxl2.c"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.44.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\177\002\315\024"
+	.string	"\206'\213I\300\324QcTJ\362\303\220\031\242\034\020\241\236\315\342\035\312\330R\032\021\\\234k\340O\310\240\200S\353\274\022UK\333\016\320\235\0050"
+	.string	"\254\262\203E\201\311D :\001\2521z\006\313H.\221\234\024-\321\267\255\334R\312\224\002u"
+	.string	"p"
+	.string	"y"
+	.ascii	"s\332Oz\257v\037\316\007\334;$\225\343\336\222\201\021\210\017"
+	.string	"]\036\305>\024_\300>\264m\226\0075\333^\022\365\234wbg\311\352\336\322E]\334v\033V:m\376\355\226\"M\t\231b\322\005=\254(=GdK\247S\023PA-11\253\030tZY\230tN-]\256\n\220q\004\351\277O\036]\316\234,\227{\257'\251Kq\263n;\204m\007\366\214\n\264\303\217Hn^\331\236\335F\215xo\356\345/\311h\342\275\367F\017\351K\330\207\247/~b\354z>\334\f\332\345mR\236}\032\f\006\203\246C\366}\277X\247Yu\332\326\351Z\247i\235>\201\024\340\216\005\217\244S\345\355\t6\271\300P\007\214+\375\366m\327\374\237O\374\3624jW\2729p+\357m,\302\221du\257\217\202\207^@\325\n\217\202\371e_\370\017\203_\017\307\242'\262\n\267C\226!D\0022\343\336\213\263\341?\016~\235G\305\313l\361\235\376\364\362\037\214Y\217\261\017!"
+	.ascii	"\r\331\365\250\256\363\373q#\244<WZ$7\257\334\340*\226\322J\277"
+	.ascii	"\363\223s\2467\301|#\307d\346\311\207\276\214}H\251\006 \243"
+	.ascii	"]O\350\007\n\005\222\352\223)R[\304\314<\351Jo6r\224\304\207"
+	.ascii	"R^\3605\366\0011\232lFC\213\215\342\030\363\020\023\373`\r[a"
+	.ascii	"\031a3\322\\6\243K\006\"f\306\005\033i\256\225\024\317hb\243"
+	.ascii	"\213\304l6\272N\312\373z\351\320m\326.8\232\343\233zo\213\026"
+	.ascii	"*\245z\357\275Ve\266\356(\373\032\377\301\030 \"\355\b\022f\323"
+	.ascii	"\n\240\016\275\231E\355\t\007\236\254\302I\301(\310L\n@(\300"
+	.ascii	"U\254]\341>D%\226\332\263\367\340ai\030D\212\211\357\324\266"
+	.ascii	"\020+ `\002\221\300(\363c\204\036\f,\330^\225\021\333HX\305\255"
+	.ascii	"\234X-\215\265\346\236\214\240\304;\330\340\335\203\263\236\216"
+	.ascii	"\207\013lP\001!\270\027J#0\206\3555\201\261P\265\024\263\022"
+	.ascii	"z\363c\245\310?o\213\317\330\245\004\313Q\355\315\026\304\306"
+	.ascii	"\233\001\226-\304>c5g\026\270\020\336k\336\344P\227\213|\005"
+	.ascii	"\207\2431\274="
+	.text
+	.section	.gnu.lto_srxl2ProcessChannelData.45.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`S\005\035#"
+	.string	"\326?\341J\200\030R:\345\232\004\r\017\326`\335\350\013\344pn\224U\227\244g#[Qb\221\324g\253\230\213\037\306\372-[l\213\320\352\310\215VrD\225\f\3025$\31679'8\356\223\037\340\336M\351\301P\361\203\315\022B\b\331;\311\312"
+	.string	"\300"
+	.string	"\321"
+	.string	"\335\335\325\342\331\350tK.\315px\326\265\206\337Zb\211N\254\223kM-\347f\203\247\r\304>\325\241\267\351\242"
+	.ascii	"\200\\\3242\022\341\267\373G~5<\326\213\007\310y\212mI\316\315"
+	.ascii	"\007\235\200}\332\315\347\250O\331\337\250O{\330\335\345M\252"
+	.ascii	"|.)G\25629g\036\356\321\270;|\213\273\261\253\232\242\370\016"
+	.ascii	"\373\327\352\211T\022\337\242kS\f 7s\262\201NXS\033\273\363;"
+	.ascii	"!N5.\216\307S\324o\316c8;\363E\307S\324\331\335\272\002\351x"
+	.ascii	"\202\272j\243<\242\272\234\263\361\2463\216\342\2243\216\321"
+	.ascii	"\035\034Td\330(\213h\002+;\270\334\371\233T2\335\273\002\345"
+	.ascii	"\234\373\"\225O\357\232w\367Vw\377\272\323\234\304>\306\301\377"
+	.ascii	":\372\344G\226c\232\335\215)'\030/\333\247\036\233\320z\026\357"
+	.ascii	"Zw\017}\314\307\346\\\374\3513\021B\301\372x\241>=N\263\322\314"
+	.ascii	"`\301\270m\335M\342\305\313\356O\240ZSk<\325\275\336\336\351"
+	.ascii	"\336\374\r\370\034\354\335\363\2607\317\216\316\275\3368\307"
+	.ascii	"\372\005|\353\235{\327\273\246\275\335\342n\343\330\333\267\333"
+	.ascii	"m\366v{eo\253\353\355t\275\215\252\267\361z\373\252\267\217\340"
+	.ascii	"RL\255)\017\240\344\034\243\215-\227\245c\314\203\375a\277\327"
+	.ascii	"\277\365w)\271X\030\003]\021@..\331\202\344\3344b\237\202-q\241"
+	.ascii	"!z\222\376W\267^+\276\316\250\250\345\234\205\330\247\367\\w"
+	.ascii	"v\033}.\024\206H\\\250OUL@\013\326\375\215Z\203}\360\3030\311"
+	.ascii	"\030\253R\334\303\203\035<\305,\230^\214l(\346\301\227\354\230"
+	.ascii	"\346\300\315\341\356\n\027\324#Q|\261_*i\246\254\210\211\330"
+	.ascii	"\t\245Iy\313p4\r?T\275\341Y:<]\200\266\203\261\031\232\"\353"
+	.ascii	"oT\001X\007\0131\305\214UL\354\257\\2P+^\336\203\332\177\276"
+	.ascii	"\314C\337G\203\b\272G\006\251OS\2631Vazd\\Y\251x\331\344\030"
+	.ascii	"\233\320\322R\005\3434KL\372(\307\316oXR\326\204\211\004\222"
+	.ascii	"O\244\320\234\213/B\335\341\356\021$\356\221=$G\023&6n\273x\207"
+	.ascii	"\373\036\241\230n[\007\270k[cy\223\251\r\216\203\273K\364\356"
+	.ascii	"\221\027_/\"G2\024\016J'\212\260Q\260\207\204\n\177\276!\240"
+	.ascii	"\357CQ0\bl\203\025|H= Q\316(\330\353\340\023\366\204A>\244\""
+	.ascii	"\341oE\b%\240MO\330\263p\344\373\375z)\206\332\036\202 \341H"
+	.ascii	"\t\030\344)\001y\277\242\036\022o\b\030\344A\030\320I*|@\236"
+	.ascii	"0)\t\310k\233\371x\252\303h\224\301\300L-^\366\305~\253z\246"
+	.ascii	"\271\351\360\235g\313<\201\260;8\207\223\027{\213\366\354r\363"
+	.ascii	"\301\257z\342`up\rNv/\2519,E\303\213\326\226\342]Cs\016\267X"
+	.ascii	"\207o\332\021\252\007\267X\005\263\355\210\303}0G\303\"\n\250"
+	.ascii	"\222\310\220`\256F44\302\366[\250Oq8=KF\261X\3057|c\025SOQW\314"
+	.ascii	"\342\033\205\254\030=\273zZ\022\233s\376\tb\250Q$\306\220R\210"
+	.ascii	"\031\032\021\021!\005-\264\001p\002\0212d\035\021p\311SF\232"
+	.ascii	"\264\031\344\026\367\363\202\253K\022\262D\005B\225|>\002gET"
+	.ascii	"h\351O\031\nIVo>dc\306-C\246\262\316\300\236\021\354K\331\312"
+	.ascii	"\020,\220\326HB\235\360vu\334\024\037\032::\262\357\217\201\337"
+	.ascii	"\354\016\331\350\330|\330\007'W\371Cy\200\022](W:\333\245}\304"
+	.ascii	"b|\271}\003>\301Q\331\fEgB\fv\325\356DMV\n\321\031\363YI\311"
+	.ascii	"\217\001Hf\207`Dm\262i\030j5\270\341\251\",N\035\2167\363\305"
+	.ascii	"\002vh\0213\260\324\207\355)z\312\343\325~\3608\016\270/6\231"
+	.ascii	"\006\323\265!\300\250NDpy\217M>AH\334\350\016g\257,\240\311>"
+	.ascii	"55\226\254\006"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.46.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\225\002\235\024"
+	.string	"V(\214I\3000'\035\376#\374\022)\264\323~nk\377\273\037j\320T\2718l\302\020w\362\320.;\204\212\327\313WM\233V\213\377\233\270\312\364\343\225G\221l\310R\026\2251\337Ga\263E\020,\b\006\035u\315\026Bh\267\275S\ny"
+	.string	"o"
+	.string	"v"
+	.string	"(~t;P\303?v\177d8\355\222\tl`|5\371\220\360u<H\370j\333%\fn\306\235\024\272yP\007^R\326.\031\243A\307]\f\253\213N\234O\002\313\247J\311\227\2738\352<|\371\002\037\240\312*%\237\316\253MM\0302\024E\364\362\361\250+\347\324u\340\367\"\007\346\333\271Bb\370\320x\371\311\301\247\233S<\331]\317\236\317\303=\336\366\316\366\211=\223\002\341\351\213\236\227\243{\322S\264\370E\246\301\314\367^}\230\360\365t\204\207\352w\264C3\2036\231\233\024\310>\r\006\203Z\246?\366\311\337\343H\367\353\300_\f\247k\235\246uz\326\351\303n8Y5Ll\354\336\004q,U}\032q\244\337\276\355\233_\272\303G\222\031\327HT\252\332\271\332%G^\355`\244d\206\001"
+	.string	"vW\202@0\247\375\037\212\032\222\252\024\310\237\362]\234\310h{\240\374([\215\273\271\377\\={\313\013a\264\273\"\177\262m\365\377l\333j\024Z\234%W\244\243g7s\330F\271\0235\341\311\372\035\001]?.\364\227\316\204\233\251\250\204\257b\311d\002\353\"z?\030\224\002\371E'\255P\316\330\315\033\266W\256$3\356\356\032\370+^.\214E\257\3641\341\353\244\265\\\322\002*8\201)\017\\dhuf\223\331\"\314ZVl.\030 \314\324`\265Y\212lf!4\nI\t\313L-&6S\213\271\254\310Zb(\265\230\030\211"
+	.ascii	"\323^f\265\230\215F\253\305:\310\275k\351O\323Y\2666h]\321P\235"
+	.ascii	"\317\342w\355\356\212\001\246\007\025\251-aB\2459_\352\263i*"
+	.ascii	"\374\230\036\264R\233\202l\276\347\005=54\347z\220P\244\225\206"
+	.ascii	"\300\023*lJ\350f\320oq\030\220*7\267\002( \220\002\031\301\334"
+	.ascii	"\001\241\206\356\314\300$\335j\302\272\277WL\336\013\224\362"
+	.ascii	"\325I4\373$\204\224x\340?v\261b\230\270cTg\322\207\201\267\221"
+	.ascii	"\266Vw-\207\266\370V>\372 \036\b\007j\261\252\221j.|d\207\221"
+	.ascii	"\222\227\251\2115;\314\0014\304o9\333CD\334\257\314f\236S\212"
+	.ascii	"\265\007"
+	.text
+	.section	.gnu.lto_srxl2ProcessPacket.47.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\257\001\335\017"
+	.string	"\006\236iD"
+	.string	"\261h8\253\351<\216;}K\037\270\016D\245\215\003\235\025r|\337\204\305\004\277>\250\026\360\237\360\261\226a\220U\033\343\fz\213\f\220T\206\252\272\211\367\035\326Zr\355'\207\344d!\r{\354\275\245L)V"
+	.string	"O"
+	.string	"W"
+	.ascii	"3`\354\212\f\034\342\235\263"
+	.string	"x\220\356\234\367\002\3359\333\036ip2\352\342\b\326]l\250\304\324v\305O]\216:\267i\242\374\324\271\b4ak\345\333a\036\242\302\021\233\315\264V\256+U\007\362\262!\321i\245h\002 \331]g\330\372pw\267M\301\366\003;=\002^\211s>Jw\356z\002'\007\214C\216\266\230Jm\261\257\3438\346\260\272l\247;N{\027\377\356\260;\267\364=om\355\006\302l\2275\352X\031\027\303\204\355\333>\331\036\333*n80`W1\017\0132\355\243x\212\323a('\260\353\n3\317\232\233\255\223\234\332\242Q>\354\350\007\253\206l\245)_\346\002h\310R\231\363\227\315K\206j\213O\343\273\370\213\332\313\262\260\360[\230\346%8\202\356\2343\\\025\332\313W\330\246iN\210\335\324E\330\246e\270\n<,\253\334a[\303U\220\274\335\225\003?V:\t\240\322\2474\001$\n\225LN$\230\300"
+	.ascii	" \250\302\007t\241s\211\310\b\006\023H\372L\340g\022\372\210"
+	.ascii	"\276\022\220\364\211\030\360(\003\b\374J\243\021\370y\304\375"
+	.ascii	"\266\352r7\033ej\322Gu(\020\233\247\207\371\226\203\243\035M"
+	.ascii	"\355\240\251*?\346&\3318\217\354\324B(\037z\372\301\272!K\t\""
+	.ascii	" p\002\241`\325\r,\n\355N\206[J@\021\272\360\301(/\263$k)\311"
+	.ascii	"\214\225<\344I\267}0DK\363\313\031\210(\352\265\243\201\364\354"
+	.ascii	"\212\374\031\030x2\032\275\360\350\017\036\316\274\037\207ga"
+	.ascii	"\2061\200!\036Q\343\317xm\017\307:\367\221\001"
+	.text
+	.section	.gnu.lto_srxl2Process.48.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\302\002\025\026"
+	.string	"&h\220K\240VN:\304\367\312^\237\177\233\2478\247\316B\341R\265\357\302`=\376\241o\254JVU\313 p\016\214\250\327\266\177\310\241>4jKY\350\302\321\343\214\374\002\277\302S\220^\013c\205-$\245@L\274\203\225\220M\266\334I\006z"
+	.string	"r"
+	.string	"\200"
+	.string	"<(\251{\201\017x\001y\221\201W\261\027\311\033\260\027\031\307\214\344@\337\375S\221\216\311\353\336+k\244\343N\216V\254Mq|"
+	.string	"g\356\344\201v\037Q\222f\330\232\200\267\342+v\352jK\220+\035\354$\242\242M\332%qq\264{\255*F1\314\3309T\035tM-\201\235B\264cgPm\271\367^xZt\nQ:\312\334{\231\232\347\321\031\345\314<\304\314\022\230iWLo\362\341+qM\207\336\274\310\327\261\027\337\027\236\201\211\246\257\035\020\0352\003s\264{\314\357\341p8\344\3461\377\367\247<x\206Y\312\244Hy\254\224\255H\271V\312\264)_@\001&D(\024\271\327h\350\344^\211T2\036\374\231\177!\303\230\201\277\201{\360\207\274RdQ\t\025]\367\002].r\004\362\342"
+	.string	"z\312|\033_\302\375G\342\004\356\r\267\362\001E\266\255z\032b\236\340\252\245\032>\221|i\371U\267*7\320\320\2334\366\242\210\345\344\245\004F\320\251G\355\036\217]\273i\330\036{\345\210\356\t\207S\225\347\312\232\252\271\021\237\324\261|\266\317\245\305\035\036\345\201\274\267E\fY\373NZ\277 \035\376\335\275\027/-\355\017\302-!\312\204\231g\327Q\276\370\230i\317Q\243 \213m\376\024\202\274\367\306\340\030\201\303\222\245\344\323/I\277\007\245m\002\b\332mv\303S\336\314\312"
+	.ascii	"\264\333\3546C\303\261\271\345\360d\350\261\305\270\204\201p"
+	.ascii	"\323c\333\221\365\330d963\034Yi\333\221\301\034\340\232\b\232"
+	.ascii	"Mv\253\325l2\030\360\276\336\346\261\fP\007\325{\357%YhJ3W\260"
+	.ascii	"@or\355\\\203^Tn\354\036\217\013\331\341\202b\013\311v\217\377"
+	.ascii	"ca\215\200\327d\205\216M\266\313\231/`\2407a\375\024,\210:\307"
+	.ascii	"| ;&\363\314\177h\b6 `\002\231A\325\003rh\rb\210\034\021l\005"
+	.ascii	"\223T\327\333Q\303-\243\262\226e\256\261\233\333\201\025:7\332"
+	.ascii	"\021\337\222\215\362b\017\332\225>Q\3502\205\203Q\361\007\241"
+	.ascii	"H6x\3610\205\211\2761B\307\225\362Cx\032\354ea\2633\266h]\355"
+	.ascii	"\317\275\206\b\237=\336\324.c\003\023\262\214\034Q\373\304Bs"
+	.ascii	"\322\360\306\205\023\"oQ\021s\004\321\336h|\302v\207\313\236"
+	.ascii	"W\360v\005="
+	.text
+	.section	.gnu.lto_srxl2DataReceive.49.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`r\002\245\023"
+	.string	"Fc{G\300VQ:$v\356/2\216\367\021\bi\246,\002\341\216\372\342\243M\343\337T'\376\3556\007\325\022if\353\361\237\357\227\363\214\363\362\373Y\006\204\240\3426\215\340(T\261\r\251\031d\250Y\030g\334H\333{\313\235Rd"
+	.string	"^"
+	.string	"l"
+	.ascii	"\036\204\366m\374\306\3537\022\226\273.t?\273\270\005f\361.\003"
+	.ascii	"\234\300\274\204W\231\227~\331F\307\331\266$\243\007\216\216"
+	.ascii	"\244\335\3754\306_\2372*|\371\245\227\004>\273\031\r\366)/\370"
+	.ascii	"\350f\264\025\217%Ph7P\001\320dqew\317sx\202v\003a\351ew\rg\264"
+	.ascii	"\024w\351\266;\330n`\303\236+\337\261\314\214\364g\346\245\002"
+	.ascii	"\315\216rpg\023\264Y\"\340g\327\003*X\b\311\024f\343`Pu\354\307"
+	.ascii	"\335]k\315\376\355O\211\320^\204.M\350\031\241e\204\216\021Z"
+	.ascii	"%4\214\320\037\240r\033\212\240\333E\261s\262B2\310\f\333G\261"
+	.ascii	"\255\270\347x=\347%\027\260[K\372\274K\343\0025\243\032\227\336"
+	.ascii	"O\323\037r\"\247\n00\363R\022\025%!\305\024L!\022\251\210\006"
+	.ascii	"\222F\335Q3*\204\301\023\364\237\003AY\210\211\231\227Q\035$"
+	.ascii	"\311\311\301\335\341\356\302Tu|\324T\315\300\243\344\0066\261"
+	.ascii	"\215\341>(o\367\205\213\377cD\312\333\251Q\323\315\357\271\217"
+	.ascii	"\032\177\307\252\325J%\021\022&91\270\363\325\337q\036\033\002"
+	.ascii	")WJCl\255\\\252T+\305Ae\262\252\205\201\007\233\026\315g\323"
+	.ascii	"\372@\310\244>|\252\026\315\327R\300\254\020\253\326\347b\261"
+	.ascii	"Z\037\nn\037Wk'\034B1\225\305\251D\271\243fI=\275\211\026\262"
+	.ascii	"\241\222J\"#&Sm\273~\344\304b\333\335\0076\204\007I@`\363\204"
+	.ascii	"\033\241\340\355\256\313\245\001\333gG):u\002\341<\211\301\235"
+	.ascii	"\213\250); \240\002\231\241\353\001shM\004>\361\312\276\026\363"
+	.ascii	"\201\222=2\033\255\366et\271.\213a\225\233\200\035\325'Z~\323"
+	.ascii	"=\243\267\204\365)\205\210\270s\311\030\245\356E\026\016s\250"
+	.ascii	"\264\340\005\254\313\177\300,c\003&]\rh(p\353\005\013;\363\337"
+	.ascii	"\371\213\313\213\023\0257\030\302\031\017\364\220\202\365\332"
+	.ascii	"(\223%\211;\342\370\321\034\004\325L\361\275`b\212\370\022\303"
+	.ascii	"#\210\313\0053\201\263q\221cmy\333\325\365"
+	.text
+	.section	.gnu.lto_srxl2Idle.50.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\270\003\275\026"
+	.string	"\246$\211J\260TR\007x\364@A\345\275\300\213l2\333\203 Q\351\017r\b5C\325\032\005X]z\204\21039s\362Kk+o\223\365\300&\254\314\3307Gp~\371A\313\232\332\323qg\345o%{\344\3747\221\315\356\275eJ)\005r"
+	.string	"j"
+	.string	"v"
+	.string	"P\343R\212\335\345\330\362\354R\361\021\357K\023D\237\244\255\3777\335\210y\330\004\366*\311\261z\363,\227/04\275\261\t\f\301K\210\313\272\"\265b\210\243@\350j"
+	.ascii	"!%\251X\352\323\344XQ~P\240'i\207\252\300\nGV,\345\320\265|)"
+	.ascii	"\0014\304~\222\346j\312\377\363\013n\017iOw\371\362\377\333h"
+	.ascii	"\n\304\033\343\335%\332]\225]\237\n#\215l?\201D \317\240\325"
+	.ascii	"ppH\036\333]\214|D?]\365]\f\226Q\026\263|\305\376\377\233\357"
+	.ascii	"\006\222]\006\234\312u\222]\3761\214\234\024\356-\006\235f\224"
+	.ascii	"\307e\035\222Gv\002F=\242\237\016\251\273v\217n\355\273]\256"
+	.ascii	"\357E\273\335[z/\351\275c\367V\357\365\356m\356e\024Va\265u\345"
+	.ascii	"\240\351\377\247K\311\0078Fww\205w\314X\206\377\337\200\211u"
+	.ascii	"<X\b0\315(\fy\003$\346:\311\222\204\321K\246%.t\270\356\332\352"
+	.ascii	"\313B\2761\201BL\314\023z\004@\357\312\3144\243\325e9\260\240"
+	.ascii	"z\374\266L?\037\217\364]\002r\227\206m\320^\377$\030,\327\330"
+	.ascii	"\231\r\340\375?\367l$\2172^\221\203L\303\266\334\333\032\033"
+	.ascii	"\033\222G\367Q\210\026\227\016\307'\220\202N\001;\323\262\240"
+	.ascii	"\302\316\231c\356\234\346M\215\f\315\2349s\314\026\001[\263@"
+	.ascii	"s\232\027j\265\323\214\035=\327\367\242\2150\002\n\347=\313J"
+	.ascii	"\2545\266\b\372\212&\245c\2353\003\214\244\364\003\304+\322\313"
+	.ascii	"\020I\\0\337U\331dC*#E\234\204D\233\noHd\210S\320%e!\342\345"
+	.ascii	"\273 6\3310j\266\302\003\362#\203P\013\r\302=\261\260\217\036"
+	.ascii	"<4\b\253\320\240\002\275\334\207\262\311\246\302\373\017T\250"
+	.ascii	"aD\306\030c3\201\310d\246)\344\220\002\031\241+\017\020P63BZ"
+	.ascii	"\315\001S\254\b\255\303\246\353\200\201TT=\343z\220 R\302\365"
+	.ascii	"\364\276lV\207\304\352\247\325N\232\0243\366\245\036_s\272$\323"
+	.ascii	"]|v1\266-\323]\364\371\002A\350AT\005\261*\007\363\361Z\0207"
+	.ascii	"5\\\3454F\275<\206fqkbQu\350\247\363(\033g(\331p\036s\367\373"
+	.ascii	"x\222\301\204\002\177\nK\237Bq\bn\370\346\022\310\bN\270'$w\321"
+	.ascii	"\367\337\214\3500\370se\333\246\030\366&9\003 \233)\346\264\236"
+	.ascii	"m\026\302|\nh\264f\263\275\367\007"
+	.text
+	.section	.gnu.lto_srxl2FrameStatus.51.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\302\016\365C"
+	.ascii	"\212q\\\031D@\236R\007\363\373|\027\3336\303\205\212:\331\327"
+	.ascii	"\203w\241\267{}e\256\3235\212\r|\213\324\341F\203AGyk\264\270"
+	.ascii	"h\0136\200\221'\374\\"
+	.string	")\300\314\336|\227<\213\200\377e\355\032!{\357-eJ\001\177\001d\001\212\001{/\227%\357\345\177\356\237\356\267\373\273\177\235\177\326e/\315\3423Z\314r\005\213\204\"\227>0Z\260\177\325,\357\341\035\235\225,`\336\356\253\270\313.\343\353\034.3\235\347Y\226\341.\377\033\273o\371Sy\254\313\376t\316\342\334\026\333\245\255\005>\370\353O\331\3729\032K^\327Y:%\246P\256\300\277\316\240\370\357\222\253\265\373\313=\224\255\217R\343}\346\271\b\033-\363|=\340\003\212\377\372\365\225\360\277\305\007\202\377uw\177j\260\345\316\277\"\321q\024#\013\303\026\316\363\325i\037y\347#\035\031\025\021\r\t)\203\200~|zx\222;H\371h,\306\360\353n\355\364\217\241\334\252\033=\250\364\371Hr\177$\367D\033\025Y5\321PR\n\266D\0139y\245;\300:G\373g\242N\\\243\272/%k:("
+	.string	"\332\016\265\007RK\323?>=I\230D\221h\236\244\024L\210N\216\375\016\322m\n\342*\201h\371\263\257sH\301\236I\364\207>\272Ffdz\374\231\250\231;\300\f\2216\317$Z\246\215G\351\330\027\317D\311\334\245y\236\037\373\001\230D\247:\326N\036fS\022\006#\321\242U\030\271}+;J\301\336\327\307\273nS\340\026B\245\0166\250,\365\322\333\005\"\273\333&\245_\256\201\355[\331c_\213I\273\264\216\241\346yv\r\225\356xOzw\275\343\356*\334w.\004\363\220y\371\177\356\376\367o\346[\356\177\032:/\227\3004\242\373\263\3716\0302HI\301\377\276;\004\031C\"\355\356\001\204~\350r'\215\351\355u\355\247\3731\355\235\325\032N\337M%"
+	.string	"\367\3058\201\344\007\300OpN'\362\271;\366\221\265N\225Z\300v\037AB?\324\221\332.{^\373\351N\210\346\007\347n\252\277\txom\304K\274\236\211\342<\2379\360\317\263q\242\250\366\357\336\273\315l-\312\234N|\275}#\243\333\233\352Y\360\357\024T\326x\3519\356?\346\311d\241\240\242\202\377\375\035S\275X\247\357\204\375\277<\030\247\277\232W\255\320\017\375\327\177\005\374o\223\232\240\231\234 \227Nt\277v\351Mu\377\235\230\230\b\350\273\210\273\254\335C\254\275\203\254\235C\254}\203\254]*\326\256!CT\254\335\302{y\207\212\265C\220\265?h\020k\177R kOp@\326\336\364s\357K\246\217\362/"
+	.ascii	"\200\322\323\275'\305\332\221b\355GG\355F\261\366\242X;\321Q"
+	.ascii	"\373P\254](\326\256<j\017\212\265\003\305\332\177b\355>\261\366"
+	.ascii	"\236X;\217Q{2\326\276s\324\216<j\227\217\332\217F\355\306X{1"
+	.ascii	"\326\036\307\332\341\242\366\027\326\356\306\3327\254\375?8\b"
+	.ascii	"4\003\222V\266\323\\g\035\211u\346\373\301\317^n\b\373\263\030"
+	.ascii	"\371\331;{h8\345\202\363\372\313\340\217O\021m\366\313\355\003"
+	.ascii	"H\210F\350\3233\204\310 \262\354\332\263\277\232\367\205g\007"
+	.ascii	"q\263P8\033L\3137\341\345\346\331\337\226\207\007f\326\025\247"
+	.ascii	"lP\260*\bO\275\374\350I\252\231:\251+\222;\376\0024D\272!\211"
+	.ascii	"\343\001\373\004r\236q\370\364\236v\202\235\275\334O\373\265"
+	.ascii	"\350\261\346\221\250\235\001\330?k\020b\035\302\244\306\361H"
+	.ascii	"\036\310\375\272!\203\255\360\240\356\024\320Dpr\232sm\351K\207"
+	.ascii	"\274\337l\033\353\324m\215 rS=\366\232\277\tC\355\002lR\250\250"
+	.ascii	"!\240\217\333\335\351\346|\323\017\205\332K^\032\252\305\\8\234"
+	.ascii	"3\316\031\007\377{\334\237\375\002_[C#\035D2\371\303\274q?\332"
+	.ascii	"\027}\303\351\326\025\306\035S\267\326\251R\031^\340\321\371"
+	.ascii	"\004n\332\217\375\0371p\314\304\341\313\263\260\2336\321`\030"
+	.ascii	"b\274\213\333\302~.\357\302\365\005\276\305\325\265u}9\241\024"
+	.ascii	"\267q:\247\271t\227S\312\322\253\371\204\n\025\340\177\343\375"
+	.ascii	"b\373\f\247s\306M}\1776z~\341\372\252\013\310\356\266\305&\f"
+	.ascii	"of\235?l^\210\212\202\377\205\267\261O\357\001\377\261/\242p"
+	.ascii	"\357\251\017\267odX\342Mu\363\016\365\324"
+	.string	"\207\376\257\261(\261[\2037\325\r\375\347\270UB\1779\033\007\2208\376\202zN\240\377\033\377+\316\363\363\315\3761\300\377\272\206\316brm\001\316\002A\225U\013-\247+,++,\252\"\025M\024\024\264\256\252\230\314&\225\254\365\242\231U\305\204e`]\355*-\024Z \252\254Zh]5?\314`&\235\n\301\323\213\031\314,\247\031L\247\253\026(\254\234\250\230YN\b\204\034\013F\025\323I\013\013\213\351$_\271~\027\361\307\276\361lL\216\243\f\333]#\245\r`\213\271;\200\235\374\021\267\307\265\273\2206\365\310+\355\f\273\203\033\273\260\036\363<?\217\262cC\007\336-Ze\203\355nP\322~\267/\177EQ0\323V\332b\333G\322xZ\013\001!\316\2633\370_\244\275\307\322\030N\207<\323\254\201\363u^\276>t\215\356\214\333\276\252\0254\205U\320T\243\366\024\0339GuG\373\247l"
+	.string	"\215\250\030\031\006\350k\213\026m\252o0<\017lS\342\360\345u\330\036\212\366rw\330_\345z\241hom\031k\341k1o\210\242h\345\262K\236i\037\330Sk\360\210\234\020\355\237\256\261\033\212\033\332[\2137\304\201\357\310\331\206\315Ah/\367\206\375V\340\204\366\326f\031|-\306*\264\251\210\377f\344\256*8\027\350\326\304\256P\360\235p\322n\260\247\374"
+	.string	"\303zt\261\355\301\037\277\334\312\375S\2774AiA{k\261\326&\271?B\345\246\372\273I\371\003R\260\233py?L;i\213I\361\241\235i\330R@{\2715\354\277KB\004ho-]\220\373I0\323V\260\247\364\344\204\365\350\212"
+	.string	"'d\017\350\201\317\031D3\020\002\201%\250a0\006\225CfFDDd\246\240 \351\321\005\204\030\346\240\335\006\021"
+	.string	"-t\312\321hSPH\233\001\n\320T@\336\364\370\t\221\315\347=\200\227\n3j\260\272\243\r\221s9tp \224\321'\227\252\001\322\020\275\250\260\302\242o[\362*\352\037\247\2330\342\341\027\032d\221|8]\004-\300\227A\252F\367h(NqQe\3127\024zo\2658\211\314s\030x\270f\240;\321\273\343(T\356\356\006\251\022\355\343\350+Q\221k\3409\224\266\341l\274\347\210\260\031WU\224\226\205\371U$\313'\005\262\254RVG\310\200;\327\262\026\261\236\210P#\342V\013\273\210\007d\276(z%\347\205w\004Q\340}\324"
+	.string	"N\261Z\372\243\306v\213\211+Uo\357\234\3236\r\343\242\300\377E\210\342"
+	.ascii	"D\006\302\003\021\242'\363\243\023\346V\005ALV^\2476D\210`\032"
+	.ascii	"\022\226\177H\206\372@\025R\356Bs\322d\032\336f\260\265\267\020"
+	.ascii	"i9\204\177>B\330\376=\"p\247\b\252\312\271\327-\254lyN}\306\371"
+	.ascii	"\212\351\241\316\243UV\223\024\025\322\331rL\312/\212'\332\310"
+	.ascii	"\336\245U\306\317\355\f\230\353v^\355\256\301f\344\373e\254u"
+	.ascii	"\313M\250\0202\035\221\312\\q\"\376{\200`v\254t\\\245o\260n\372"
+	.ascii	"\023\274\250\004\267"
+	.string	"\361\376\263\027\200\026\016\n\315\2033T\034"
+	.ascii	"\fc\241\277\201\3031\202 \307\ri\320IR\262\250\306\221\3451\351"
+	.ascii	"\016\237>\013|\207C\\\022@\032\321\303\273\304\242n\244\r\035"
+	.ascii	"\331\221\302_\340\177\304:\211\374\205\241*\242\222\332\r\036"
+	.ascii	"j6\343\271\312\245\246G\262*\247\251!\216\247 J3\005B\215\275"
+	.ascii	"n\240\330\016\371\220\233d\266\255\333\362M*\215I\215\237\313"
+	.ascii	"!\202$\016\214\346\371x{\223\326\264,\340\244\206)s\322Frl\212"
+	.ascii	";\357\220\365\203\321j\240\206fe\033p\336\364Ee\246m\266\333"
+	.ascii	"|\204sl\250N@`\371\244\305\361\016\r\b\022\0367\232\013\310\263"
+	.ascii	"\326\372\017"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.52.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`G\002\315\023"
+	.string	"\266\345\206J\320\360(\035Bi\037@H\245#(`\005\360\002m\371n\233\332{\266\250\2203`\277D\222?-\357?\026Z\355\337o\327\245\274T\257Ri\017u%v\020\\\241\203\334\202\353'?"
+	.string	"l\226\263NUX\261\376\203l\"wJ\001t"
+	.string	"g"
+	.string	"s"
+	.ascii	"\325\327TTk\231\300&\251S\227/\031OS'\031Om;\205A\315\266\227"
+	.ascii	"9\274\017\017I:\241\035\265\226\2555q\333G*\356\264\371\253\336"
+	.ascii	"\355c\252\346T<\340\364BG\t\217gG\366"
+	.string	"8LQ$p3#\204H\217F4\251Q\342\006\331\233\231+\026\360\215x\022\351\345D\226\f%\335\205\237\035z4s~\250\324Z=w\275\017\367\307m\267\330v`\317\\\3668\035B\247A\35049N\257\036\274U\007\376#\235\246tz\351\364\244\323\007\320\340w#b\207\306\332(+o\030U\225\250Q\317\203\277}\242\232\250\013}\310&\035s\025\336#\036\277Z+\031c\223\247\323\256\371B\223~\371\240\332\203\032X3e\355Ehr\372Ap\352\005\251S\2268\247\375\237\003\325\016\334\360\221\032\300\033\216\245$rW+ \207\256\307\334]rOt\003<=<\335\320\211\234\021\313\256\312&x\027/r\261\256\343WK\313x:wk\242|l\202shr\332\026`\363;\325\236\tI\351\311)\267\267C\221\030\256\330\305\361\311\370\245 d\232\231P\366Y\274\305\211\257c\331\313\374\356e<\375\376P\344\334"
+	.ascii	"\331\340\346\320.ssq\354\357p8\034z}\001\256\200\362\202\271"
+	.ascii	"\320Z1\031\f&s\r\210\221\305\366Ec\241Ax\301\\h\261\f\017df\""
+	.ascii	"v\241\244\\\220\231\301\264df\255\230\013\013\254\345\232\301"
+	.ascii	"\264P\002X\206\3415k\321d\262Y\213,q_\337m\243Up\233\023k\255"
+	.ascii	"u$\231\266\204\t\363;\357\336\024 \341R\320\305\361w\2762\206"
+	.ascii	",\001\203@6\204\256jA\366C1\350\356\021\017\037\0200t?qe\\\355"
+	.ascii	"\205\037\021\006( \240\002\221\032\365\3270\2100\340\336\031"
+	.ascii	"\032\307\003m\305/\377q\254\334\206n\324LZ\342\354\366q\205X"
+	.ascii	"\320\3200+\025Q\360\254\302\226\207\306\030\276\177;\207\231"
+	.ascii	"\004i\223^\213\270A\f\206K\366);G\020(\230F\214\253\243\342\260"
+	.ascii	"\031!\343J\363 \023q\337\201\221K\005+\n"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.53.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\275\f"
+	.string	"\206\231ZC"
+	.string	"\221(\035;\253\351\256V\246\017\201\017o\216\033\2613\013\304\315\367\001\206\310\275\304\202\236\020\264\372\325\007\252\265\026\311\312\337b&f.\335\001\004\232\354}\206\033\3243y5\023\017\b\254\201\374\275\267\224)\005H"
+	.string	"C"
+	.string	"E"
+	.string	">\211\227(\331\224\321E\303\346\205\003J\214\314n\304<\376\001\377\362\002\340\237\206\270\351N\323\344oT\247\273k\345\352\016tp\261\322\241B\271\217\026\b\031g=UT\251LMgw\235)\252\r\367\273\355\006\266\031\330\027\tix\230\377=\376\316\351|\351_\004V\255\222\024\273\031fl,\214\307\342\305\366m\227l\216m\227v\210\202\322aJ\356\261\250\030.\t2\355\257n\242\364h\362"
+	.string	"\273,2*v#\002\027\270\376\034/\333\001\232\016\006=\371)T'\312\215\\A\243\345A\265\305O\257\021X/RY\303v\350'D\327nj\201\037s\241\302\265\273\027\361\347\233\300\277\353Y7\320\002\305\210\325I\316\330\361\224\332b\337\355\356ZYl\230\326\270$\021\007#\231\246y$|6\331\3103\202\220\205@#\315\302\003\322\326\341\017H\310\bi#\301H\033\246\201<!\354\263\221` \003,\242\220m\330H$\3320N\334;\345\3700c\225\276\t\246\252\330Nu\347DQ\016@Buj\203&\344S\002\020"
+	.ascii	"p\b\b\303h&\232\255W\364a\205\252\255L\261\376\022\236/n\001"
+	.ascii	"\346\202\017\030!P\341\340. \325`\213\3204\006\005\005"
+	.text
+	.section	.gnu.lto_srxl2RxWriteData.54.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\272\001\215\020"
+	.string	"F\240nE\360\3204\035\263'=(\0051\3569\020\232e\265\215\345\264\362\033P}\350G\241\347\004\021}\246\242=\026\025J\036\n\324\031\226\201)O'N\304'\301\013\220\267\336o\365\337\221D2Z\240%f\335h\023)S\nV"
+	.string	"Q"
+	.string	"c"
+	.ascii	"&\276\353X\345\321n\007\030>\273+\342\220\354\021\304z\332'\361"
+	.ascii	"\022\337s|\343\001vmT\370\354\206\"6\220=:\374\200\3531\373v"
+	.ascii	"=\372\263m<\274\331\367\200H\235\320\261\273\234~\370\367\374"
+	.ascii	"\374\357|\004\322\310<1\006\273\353\004i4\334z\333\005l\213\330"
+	.ascii	"i\022\267\352\362\320\353\265a(\006\252f&Wv(\223\352\301\276"
+	.ascii	"\265\273k\265\331\236\363\233\256\363{h\272\224\2455,M\272\322"
+	.ascii	"\243\230\316\2604v\245\257\230\2161mYi\325tf\372\037\004\204"
+	.ascii	"d\304\274\330\315\260\332\261@\361'\204\355\333\347\261\265k"
+	.ascii	"\2663|!D(RE>\233\236\347\rF\f\255PB$\025\rR@\322kE\246&\035}"
+	.ascii	"\231\306\324@\325`\352\247\360R>h\340\370.\327\343A\034'\022"
+	.ascii	"\022\230\024/\300T\2030p\210j\322K\217\0221\263]\226F\275\207"
+	.ascii	"Z\nah\206\226\251&Ep\273\302J\036T\005A\251\214\257\251\252J"
+	.ascii	"\025\235r\345\013\001,(*\332\275t\023,\237\214$P\201\361\\8\030"
+	.ascii	"\217c\241\320\255p'\236\0137\362\341\026\013(\036\367\322\322"
+	.ascii	"\342qZ\270\267Vml\222\003\350\2443.\251\257\272\213\003>\216"
+	.ascii	"\035\224\224lZ\322\007D=\251\"\001\251\251\251E\007\340f\367"
+	.ascii	"t\320g\361\237\b>\316\243%ty\260\363\tJ\036\364\246\232~\347"
+	.ascii	"\001# p\202\021\261\355\001\362\320\356\016\214\241\205\346\353"
+	.ascii	"t\017\216i\237\333\200\025\023\2521\223\255e~q\251\214/\230 "
+	.ascii	"\216\022$\231-\023kb\214\016\362\231\274\333\246\f\243\214\365"
+	.ascii	"\300f\212`\203\305\f\310\214^&gH\364\253\271\260\205\220\223"
+	.ascii	")\020./\332G\006"
+	.text
+	.section	.gnu.lto_srxl2RxInit.55.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\204\007\235+"
+	.string	"\032M\f\021F`\336Q:\333\327\232.\312\333\rC\031\203\377ht\332\234\263\334x\227\270\003_Am`\365\215\373\220\326\313\243\321\261V\037\334\212\312\034\007\0163\216\017C\306-\340\3549&\326\301?"
+	.string	"!7\265V\3627!{'\031\373"
+	.string	"\354"
+	.string	"\004\001PR:c\227\026;#\324\247\357f\352\213\275\331\274\356\036\273\201f\3442O\r\235v8\234\313\231L\357\202\343\367\264\314G\024\177\320\200Ax\332\030\324\247?\364.s<\205\254\355>\330\303\230\256\324\361"
+	.ascii	"9+\3712&\347\245\204^\240>\355\345\t\340\247\352\005\340\247"
+	.ascii	"\023*0\365\372%W\220w\201\025\305\340r^\002/\223\376\035]\276"
+	.ascii	"Q\273\336\327\013\002\342\355tj\016\247\350\265k\277\351\276"
+	.ascii	"\334P\007\242\0174`qH\246\266\336\323z\220\226\024\251\"\026"
+	.ascii	"\b\215\200$[s4)\"\250\200\264*IxY\337eaY]\002$SWW\321\244\256"
+	.ascii	"\320_\363\t\244H!m\356N[\307(\205*=\314z\307\"\312#{\233\362"
+	.ascii	"&\224M\321\303e\265\365\216<\320\fE8TQG\242E\275\204\374\276"
+	.ascii	"\354\366\f\033fZ\331Q\310mn(\347\334\326x\234z\003x\367!t7\211"
+	.ascii	"n\354'o\306*\253\206\304\212\3531\3614\366\346\212r\256(\177"
+	.ascii	"\373g\216\346D\377I\247Xao\\\021\307\210\247Y\334L\0135\347'"
+	.ascii	"\013\3752(\\\250Ot\3347\277 -N\234\322\311>\323\233l\235\361"
+	.ascii	">\270)\226\355\250\2631\331\236,\237\2439\347\214\336\344\223"
+	.ascii	"0\320}p/\325\347\t\245E\264\317\2669\237\bww\214\207!*\300\225"
+	.ascii	"s\276\320\007s3\030\375'O\333F\221\275\361i\277\b?\375R\032\321"
+	.ascii	"\002ss\262\317{\355(\217\\\335\233\354^6Y\337\2263\265\276J\272"
+	.ascii	"\037\264\355\006\277\217\275\021|\371\033\270\362\037\320\266"
+	.ascii	"}\275wy\007\235\354\r\264\263\315\003\262\275\343\331\326\361"
+	.ascii	"l\253;\333Xg;Um\243\252\355\253\332\266\252\355C\300TK\270;:"
+	.ascii	"\352\344\034\344\351'\267I\311t\235\354\357\362\217=g\321n/\375"
+	.ascii	"2\262\244\347[\362\274Y\303\267-\321>\315X\243\326\037\353\017"
+	.ascii	"\374\324\212]\260\275{\277\036q\356)\177\245\302\300\337\313"
+	.ascii	":d\265R\237\347\351\355^\257\326,{#\276\2732\031\3536\025\271"
+	.ascii	"s\335\3223\264\036I/\317\212\223\027t\177we\356n\262\237t\236"
+	.ascii	"\251\272\343\300\207\342T\346\324\343\300A7\352\355h\222\307"
+	.ascii	"\2417\265z\213\323\335$\206rd\211\332-\360\275/\230l\335k\362"
+	.ascii	"{\356u\240%\212V\230\022(\r\227/\271\233<>\033\203\005\337\300"
+	.ascii	"\b\356\001\345\223\271\366d\371t\004\333\313\257Mp\367\352d\205"
+	.ascii	"boDp\205\266\302\332<\335\246\356\265k\365\212\3005\345vV*D\234"
+	.ascii	"iV\326+\f\326,o[\303\260\234l\214U\253\026\r\275\341l\034\234"
+	.ascii	"g\214Uf\340:<\215\310\n\235/\267\337O\340n\017\207sB\307$\r\316"
+	.ascii	"\355hE\013\324rv\272\321M\2038\233\020j\316\331B\377l\204\b\002"
+	.ascii	"j9\246\374\004F\227a\024\343(\270AI\030D\332%\035\005\215\224"
+	.ascii	"\220\202\271\"%\"%\023E5\214\224\216n\224X\022\366d\030\3058"
+	.ascii	"\nnX\022\252\rCh\002\215%a\022pI\b<2\"\252\001\204!L\002\n\025"
+	.ascii	"\350 R\221\020\250\024\f\n\201\274e\376U\322H^YE1\275\006\267"
+	.ascii	"\216ZS\f\356\257\330\347\273=\344t\211>\313\343\274\333\340\276"
+	.ascii	"X\006\213w/ \315\342\220\275\233"
+	.string	"\264R\201\004\363\345\206z5\255\202n\262?\\\303\273\373\202\271f\251\254\220\341\332\234a[\033~\272\273*\220\3158\244\356\266\225\262\307\225jXgxgxG\317\205\032\363a\036\254^\335E\3158\330\356\341\3330\316\336\250\336\273D\313jC\274M\375\017\373\340\266F\0335\3543t\016\237\303'~j\0019\366\345\326\264\022\025p\361\260\305\265h\241\204\253\017\337\016\244\0301\255\254J}\003\244\013\250\371\017]pE1\273\337mT\027t{7j\006\306\367\314g\200\214\250a0\303\030T\210\206F\224&I!\035p\002\221\261#z\021`\2713\251$I\n\305\006\253\331$\305MN\205s\322!\230t\016\3726\305n\257\316\374\206 \344\304\264*X\200Wh\030\342\326{PdrQ\203D\027:\317\023\300:N\245\020:\207\217\261nu\350U[\305\353\357Z\r\032D\036\310h\274UmO\312\233&\234\244"
+	.string	"_\017N\310\025\233\225\312\2672S\300Q\007\221\233\253O\017\b\377E\317\242S\233\224\3603U\020\255h=\231\211\245\005r\303\260\307\260~\271V\241\242g\241\304\253\203\377%I\205a\006E\340\306\241CR\323\025\200a\201\262\301\352\2568m\334}\362\036\261\034"
+	.ascii	"\373}Wb\207\037\311\365/\251\361\252e\246\213X\204\362\230\341"
+	.ascii	"\235\016\337,`\356\025\262\223\260b\324!Xr\335\346\216\370,6"
+	.ascii	"M\310e\201\002\275\316H|hN\271\374\240Xs\350\266U\232\351?\202"
+	.ascii	"\217g\001\373\237\037F\205\356\210\204\036f\013\263\231;#Ka\250"
+	.ascii	"V\306l/\035\206\366\230Ja$mM\371\325\037\004!y\325\217\n"
+	.text
+	.section	.gnu.lto_srxl2RxIsActive.56.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\302\314.4Pm\222\016$\243\252\214\222\256[\027"
+	.string	"\310\340\230\320EM\253\306\322xn[\273\333\363\233 ]7\200\342\271\231E\202\200\241k\005\310\225(8vk\355o\"Sk0\231\006N\265y\234\352=0(8<M\265y\230\201)\210\205\352EPT\365.Z\026I\210\004!\274\276\236J\021\261\"\222\253\037\005\361\334\322\022\035W\254\323\355T:\025\001*Bn{\r\344\020\343KI$\375nt\356R\0026JY'\266\314\321v\222%\323\b\307\377\371\313\231\203\317V5\215\221@\207\205(\304$S{\230Q\253\316\272\365h\302\205\211`\031\250\316\202\220\231;,\243\350\330\337\340/\370/\002\t"
+	.ascii	"2\001#8\343\216#D\250@\\\023SF\220%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_srxl2TelemetryRequested.57.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375 \343U\006"
+	.string	"\322\013,3Pm\222\016$\223\203\310\250\272d]"
+	.string	" \003ea\024\255F\273\305@\231\375\273\235\335\241L\225\200\341\354\314\024\222\240\3239#\344J\024\254\035\247Y\262e\nc,\227\007\215\3134\215k\021\016\f\020\r\3432\315R0%\321\340\332\004E\2716]Y\026Bf\340a\237/HC\252\3131\305\006\373*\335\r@%d\002\030\036\034\375\325A\226\361\255$\013\3758\262\001\321\210\325g\222\t\032\245d\211D\322\361s~\372\222\300\271\352\265\001\"\360\020U\210\240d^\215i\264*V\267\037]\370\274\223gu\212\001\n\2319>\353\242\263\376\b\377\301o\021\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_srxl2InitializeFrame.58.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`*\001\215\f"
+	.string	"\246VQ= 1T:`%\224HN\247\344\361JW\347\342:G\212\274V\354fA\207~\303P\006\375\217\3558!\226 \030R\346\372\001\t"
+	.string	"Y\022\"s\350\nj\360\374\217l\314\020K6\3312\245="
+	.string	">"
+	.string	"C"
+	.ascii	"\001v"
+	.string	"Q-\030\273\243\001_\266O\217\037\240}n\027\240}:\264w|L\255\005\204\210\022\213\307\356r\322\303\303k\350\277\304\001\210\247\321\025\242`w\255\342\351\302-o\273\200m\214}\031\001&$L\220\244T\237\276H\373\204\2400\321\0203\220\364\303\036G*9\330\317vw-Q\366W\177&\325\252\352G$!T\247\233^\354Z\370\200\355k\306\370\020\261}\265?\342$\302\257D\017\032&Z\211\355\002\330D\337\341vi\231\2649\r\364\24217z\274*\310\221}\027 E\007\213\267\350\\\022|\266*w\r\007_a\343*>\224\324.\351\242\237\342,\217\273\217^\374|?\001n\273\213\300\017\240\217\201\364&s\340A\310\373\270\220\307A\350h<\334\306\373\270L\305]\004\216\307\201\272\316\343\"\343>[\211\362\206\003\303\213$)x\242*\t\\\252|)\346\372\214\216\257\262\006\324\213\240\366yi\311\261!\036"
+	.ascii	"2\241]h`x\370\"\226\201a\267\243\231\017\201\346&\030\320\017"
+	.ascii	"\020\214\247l\350\021\332\360l\365\231\256\312\006\254\273\004"
+	.ascii	"I@\030%8@\273\241\340\226R\242B\203\331\330\001,c\305\301\250"
+	.ascii	"KX\315j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_srxl2FinalizeFrame.59.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"m\013"
+	.string	"v\226PB\020q\224\016\210x\377\177\263j\001\3441\226\366\317\"\246\nze\334\236\367\341\344\313z\350\237\366\023\364\230\351\017\fBm\374\211\260g=\001(\025\001\240LtK\004E\217',\204u\357\332\317m\245L);"
+	.string	";"
+	.string	">"
+	.string	"\273'\027\253\335\020\305&\227G\207\027\301\036/\017\301\036\355\3316\036\206X\222\021\252\n,p\354n\246 \356==\377(\216\001K\337\323\002`w\235`)\303\255\267]b\373\304\276\200~"
+	.string	"!\017\372-6\254\\\255\t\372\331\341\227\372\301~ew\327z\262\237\372\243\2465\323\231\351g4\022\244\013\245[\230\261Kz\345XV\204!\"c\373i\337\304OxOE\370G\252v\001\003\026\223\207\346\311\203\252\035S\3361\260k\252\206B\207Q\276\334\221Q\355O\002\255\254dx`I\320\317\230|\370\025\235\206\306\256(\305Ul>\352\321\016\272<\370\350w\330cT\007\240\016\201Z\333\244(\bq]\026\3422\006\237\003\0132\215\353\262\315\210\267\006\036.\003m\033\227e\302}e\365\344"
+	.string	"\0340\270Z\"\035\331\347`\376\213\2538>\312\003:\035\354\221\200\206\032%n\210\362e\220L\r\017"
+	.ascii	"2\241\265h`\3610\002,\305\034\326\356`\302\250>$\265CS+\\\324"
+	.ascii	"\322\004p]\354jV\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2Bind.60.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`8\001\315\f"
+	.string	"V\327TD\360\222&\351H\345\013\016.\236~\2205\371z\372\026\021\2779\2718\024\364\212\017\\\370\034\003[\236 \373\251\250\202\302V-\316w0;\266,y\006\236o\303\021a\0328\035\005\373\021B\t\315,j\244\021\222d>"
+	.string	"?"
+	.string	"C"
+	.string	"\035\262\323\311\330@e\206Pp\354\001\316\361\322\227u\274\026`\035+js|*%\001\231\032\036jzd&\006M,\372\211\372\334\235\2154\372\2050\310\314\276\215$\342\302\333\032h\233\240\275\0133\323\254\364\023\235c\351\3331d\r\326Q\005F\207\017\324\313K\265\247\321\203$\332\253\314\314\302\230\366\275\036"
+	.string	""
+	.string	"\347\202\364\207\033\231 R@\262\2136(6}\373\\E\272\212W\2106\271\234\001oEp\363\243\343"
+	.string	"G\205\017\246\221\002\3023`\033\341\030o;\206\261M&\301\363\272\307:\016;0\343\370\374\342d\256\302\005\272Eg,\314\342\022\027\260Z\224k\262\226\264\030\346B-9rx\254<\223\036\024R@\023\252~H\026\\h\321BX\213\206\245\200<(\330G\013a$#\315TN4,C\226i\230\310)\257\022\306\224s\023\244{\201\033\352Re\2160\331\364(\232\227\352\310\273\256\f\353\323\034\313\200\322\3266p\360\002\034"
+	.ascii	"2CO\025\330x<\264+\002\270\016T10\0063\327{\212\235\274Q\200"
+	.ascii	"\270\261\305i\214\331\310\030C\3000h\003\b\342j/h\007H\f\256"
+	.ascii	"\021P9~T u\031\375\325e\001[\300e^\264\223\f"
+	.text
+	.section	.gnu.lto_srxl2ReadRawRC.part.0.80.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`_\001\305\016"
+	.string	"\226\235dC"
+	.string	"\221(\035\333\031\376\377\17739\234\027<\353\035\305\\\362\037\227\031\365x]\323g\214b\217TGc\324GBo\020\377K\315\3772\377k@P\357\274\037\033\200\362\b\377z8\025$\255\265M\366&R\246\024P"
+	.string	"P"
+	.string	"O"
+	.string	"\333\202q\331\355\024\374\031A\374s\027\355\2378\261l\373%n\002\345Tv),\315J\007\222\027\314n\267\375m\234"
+	.ascii	"\374\313\017\200\177\032\342\251kf)?KP0\\\017{\3462CF\t\312\206"
+	.ascii	"'\3073\355cw\0359\334\357"
+	.string	"\266\033\330v`\377%\351\030\323\032LC-\375\264t\366\327\2570\235o\371\017\300@\202\230\335\223X\314\202x.V\354\303N\366\306F\331\033\277\374\313\034\217S\267'/m\216\007\352*,|cU1R\026h\276\345t\026\323\201n5\260\254i?\305;\324YL\027\260\001Q\363\265\252\241z\013.\345\253\370 \360O\323\233xx\232\n\365+\022y\277\300L\237~5B\2251\253f\372h\220\324\260Ag\001\022w30\360W\\\b\371*\177\276\t\376\245\036\366\273D\240\030\311X\252\313\232=[m\3311\255\211\351L\f%\t\017B>\"Qg\202G\363!uH\021>!\020IT\001B\211\013`O\007'\244\304\211l%n\023\201:\241\315\303\211l\035\005<\242\360\3416\322h\304m\033\333\371l\265\345\303\316\221\031\325\250\211m\215\372cDU\252.\333\032\214\247`\324\214~\365\001\336/\240\246\001\033"
+	.ascii	"\33774\031C!\326P\206\020\201\251\220\314\f\374\245\002\001\344"
+	.ascii	"\201\021\256\030|\261\001\221,\224\036\342\334\f\303Uc\001\335"
+	.ascii	"\254\202\344\274\223\235\366\240\335\257\204\300\275\233\303"
+	.ascii	"\204g\330H\r\244y\364\265\005\017"
+	.text
+	.section	.gnu.lto_srxl2ProcessFrame.part.0.83.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`>\002E\022"
+	.string	"\026\340rI\360\320&\035\022\r\t\231\"\013&\021\236\221G\204\361#$\342\255\006\2453\3107~G\250\353\311\354\307\034j\200\265fO\333L&\361)\217\366\204K\251\241\036\3704\374\312\030\017\322\353\254\222\207\357\365\234~H\032\331d\357\224\002W"
+	.string	"c"
+	.string	"^"
+	.ascii	"\257V\320\275\272\354d>\215I\257\276\314gdg\301\301;)w\205\002"
+	.ascii	"P\220\314\320n)\362\352\004\335\253\367\002\334\353v\002\334"
+	.ascii	"\253I\033\350\345\356\b\304"
+	.string	"\017\n\316\320\356~\364\345\344\351\334H\177v\372\234O\332\312\210\317\001\337F#\273\353\216\304]o\373d\373\201=k\001=)xl:\221n\331\233\331t\222\271\365\022&Ee\267\304\271U`\370\345\235\2240+\rNV\004\346\227\003\017\333\213\212\035A\257\277\371N\t\242\273\370\013\233d\330uL}x\254\330]\022\314\323/I\037\3479&\321\2207\344mJ\274\231\200\335\226\023<t\332o\361\032\331mJ\f\224+\3425t0\b\026\346i\366>\320\231\375\031\247\021^H\245\270WJ?\350\244G\351\341\373\\F\210_\263\n\004)\202\230 \226\031\023&\263\310\177\213\363{\036\003\203\367\232W$\3634\022\356u'&\007\213\214P\315,\232\324\305t\373\266\273k\332b\177L\323nz\216\246\337}!\002\260\354\246\024\021-\212\032\316P\002\303\225\353c\211a(\252\016\200\256\224+\002\030\256\\\254\027\204\330\b"
+	.ascii	"&\262\250U%\223\206\330\330\372b\343\307Z\245\302O5\266\276\022"
+	.ascii	"\210\305\r\340\370\271Dq\374H\266\347GLh\007SJ]\034\302\341\030"
+	.ascii	"\345\364\030\022\002\231\223^\3477P\013`vMN\363m\374G\202_{\365"
+	.ascii	"\004\024\312\256\0207 \200\002\221B\363\3334\3200\377\303\342"
+	.ascii	"(\024y\017q(\320\201\377\323Vim\311r\335\235\222\320\034\032"
+	.ascii	"E\336\261)\306!\311\253\332\334\372\215\224k\317D\3710\033A\212"
+	.ascii	"\016]d mJ\242\205\373c\372\023\337`\366\002:\\\307\035\331'\224"
+	.ascii	"\340\021\215\035\226\2654*\335\272h\002\202\206C|]}\206\226\270"
+	.ascii	"\316\233f\344\300\231\376\262\355\214\002VK9\217\247\013\323"
+	.ascii	"\344\0230\036"
+	.text
+	.section	.gnu.lto_srxl2ProcessControlData.part.0.84.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\266\001\375\017"
+	.string	"V\\fG\360\260(\035\350&\373\371\362\2109\336:\003^"
+	.string	""
+	.string	"\200@\310\300]=\205]\367\212\221\352\342v'g\331\"\343\206\366'Q\311\357\261\037Y`qp\242\bY-\234\353+\314d\210vD\235\330]\232\005i\334V\356\224\002L"
+	.string	"T"
+	.string	"T"
+	.string	"\366W\374e\365\330\311\t\354\262\300h\261;6\370\264\307\366\351\361\007\264\317\355\006\264O\213v\317\307\335\303T>\324\320\330]Na\027\257\362#\372\254\353e\2273vff\262\020+\227\005\376\001\211\354\256\267\021\367\274\355\007\266)\330\322#\277\315\325\276}\033\321\277\271\314\241\034\034\2244\016\352\233\342\342X\271iE\330F!\342iRN\300\032\267\345Z\3715\016}z\024\262:Mj[\024 \331\214\204\214\335\361\343\323\0206\225\227\2111\321\030\023\321\200\3550S\202\301\345a\304\307ND\343\212p\3712R\355o\203<\b;xyP\226\247J\325b*f))P\344\r\035\367l.\353\332\327.\370\274\354"
+	.ascii	"tvxX\322\206\324\026\353\347\263\273ke\261/\363\353\224\226\207"
+	.ascii	"\371\017R\020C\200\211\335\326\215\032\373\232.N\260\360\311"
+	.ascii	"\305'\321_/0\025\356\3639\001]\330I \371\300\320\364\221B#\023"
+	.ascii	"L\251oza\027Z\360JJ\241\tUA\005v\200\336H\347a\320L\002\031\221"
+	.ascii	"\250\300\023\247\0029S\251+\341H\340\211\003A\340O\203\007r\341"
+	.ascii	"\367\201\\\310\266\274\b\007E\261\252\266\330\016 \365\027\264"
+	.ascii	"\217\333\245\f\035/x8\244j, p\202\031\253\351\001FT\033 -\024"
+	.ascii	"\225L@\303\275\216\233k\320[\207\260&@\211\001\003\230/\264\210"
+	.ascii	"\316\260\033G2\001\330P\313\001\206u\220<\310l\370\255\270\315"
+	.ascii	"\261\335B\267\\\232\022D\224\220\b\232\361&#\024\203\203\306"
+	.ascii	"\360\271\231\031\333l%\202D>H\366\016w\255HZ>;\267Z\376\273\360"
+	.ascii	"\030"
+	.text
+	.section	.gnu.lto_srxl2ProcessHandshake.part.0.85.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`;\002\035\023"
+	.string	"fc|H\340P%\035X6\263\203xA5Y\211\210\334\342\234\243.!\241\022\r\346(Y\327B\243H\321C\360\263\234\021\033\312\244\317!\242\222\372vf\026\323P\032\203\030\026C>Q\031-\b\232\304\325\313L\335\310\244\355M\366N)e"
+	.string	"g"
+	.string	"d"
+	.ascii	"O\272\022\3545\234\017\3305\2221\265;.8\365Hw\352\361\007\352"
+	.ascii	"i\367\002\365\324\242}\343\343\356i>=N\267\335\365\246\207\213"
+	.ascii	"\247\334\224U\364c\247\207z\002,\0254\254"
+	.string	"N\3144\234\223\262\231\320'\307\200\347\306\001d\266\303\005\310\352\251q\250K\f3\035)\t\274\266Pv\327\335\206\273u\333+\266\035\330R([D\251@\240\260\311\211h\232\243\037\33369\201\231&\344EJ4\237\253\335\321;\275\355w\372\264o\337I\364M\034\312\037\266\247\032I\362T\303\355\320\270A\037:\252\032O\272\323&\361L7\006\202\371M\3768\265I\274\004\354L7\"\261qc\341\007[\322m\027\210\344\324\n\256@.\277$\276\206\0232n\020\220/\355S\265\2429i\366c\352\234!\223\215\035\231e\233\345,&\235\0215\242&\247?\365\025\240\217\344\t/\362\262S\377\245\236\316\0302,\033\346R1\335\356N\003?\305\005\227\217t:_SO\345\224\022\022A\244T\313\221;\344\244y\326s\273\273\236FvK\232\253\322\263J\313/\375\367\030\251\022@\264\373\263CG \314\347\362j\221\371\\"
+	.ascii	"\200/\031\327\314\013\f\273\020l\371@\227j\226\022\023\n6\341"
+	.ascii	"\313\263\t=\231\227/\306c\t_^\t\002\273f\300\320\263\340r\205"
+	.ascii	"\336\207my\224\234\251C=\226~2\330vv0\367\224\352\2778\214\224"
+	.ascii	"\007**XR7\034\234\001\031\022b\017\241r\323\216\260\"/\263\b"
+	.ascii	"\317\214\331oq\027\025$|_\235TQ9\206\346m\0250 p\002\031Ih\007"
+	.ascii	"`dE\001,\005\202\356\336\013\331\266\024\247Z\212b\267\204s\264"
+	.ascii	"x\034\211\037d\372oi\360\326\"\236\022\221]N\2543\326:<uds\246"
+	.ascii	"\013\3306`\230\007]\202.q\251\033\013\357\030\212@\201\362\270"
+	.ascii	"\212A\252\270\247SS\263\312\265eQ0;Z\262\270\210&\222\357\016"
+	.ascii	"\367Y\0016\222\344\334\213\3704\030\367.<\006"
+	.text
+	.section	.gnu.lto_srxl2Process.part.0.86.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\353\0015\022"
+	.string	"\306\341wH\320\224M:$\031M\300/\225\276\t\025\243\202X\314\276\322X\"P/\330\237\317u\345\243X\323\300\204\367\034\205\306\342\273\265\305\265t\004X\210l\244 =\346>\2123\352\\\001\2248\030\207@i\320\353\221\211%\233\310\235R_"
+	.string	"_"
+	.string	"c"
+	.string	"kcj\332\035\037|\232\201\367\351\361)\335\247\367\002\335\247\375\031\266e4\317\354\"\037\205\3669xJ %\331\335\357Sa|\366\311\251\354f\376I\r\347Sr+K7\261\226\342\3125\370\371\201\002\245\266\303\245H\275 \362\333%OMGJ\002\357T-\273k\317\347V\335v\006\333\022lI!\332\235[\265\331*\351\371\361\347:i\235\322\222\223>"
+	.ascii	"\003\037\215\335\023M\230,\320|\212\361\244\333O\222\3717\257"
+	.ascii	"\220d?\262\361\202\234qi\264#y\365\351\337\270\321\354G6\336"
+	.ascii	"6y<&V\030\331\035\035|:\202\367)@Z\312\217\262\027\335$\030\267"
+	.ascii	"\207f)\355\327\270\215\331\213n>`\003r\211\021HNUm\230\013\362"
+	.ascii	"\342T\b@$\024\307\376\016\032\005B\273{\321\306\360'\r,\336p"
+	.ascii	"'\016*Bv\227\245iD\007\177(\246\032D\364\361\231\256#\306\002"
+	.ascii	"A]\361\200R\242\342\352+}\251\345\017\031\204k\372\256\356S\247"
+	.ascii	"\304#9\262\211O\244-\363\222\027\257\277\375\266\036\037Q:\212"
+	.ascii	"#5\310\001`8\341C\013\306\212\211\2011,0@\013\306\202\301\264"
+	.ascii	"d\\\260\231\230\205\232\020\305\240\312JLMH\363\325\204\337\214"
+	.ascii	"\213%\363\201!\315\247r\300\257\020\255\360\203\275^\341\267"
+	.ascii	"zK\216\352X\247w\227\316\207z\017\227\n/\362\342K\3679m@d \321"
+	.ascii	"K\247)\251\026\234\006)\021\261\300\261\352\302\372\023\211?"
+	.ascii	"Q\252A\266EtS=\030\r\331\t+ `\2021\007\251\007\325\t\2009\033"
+	.ascii	"\211\320!\024\313\316Up\350Y\323\200\332Yd(\2671\301\310\302"
+	.ascii	"\200\274s\224\343\"\n]\216r\300\343d\347\033L6U\236}\020\275"
+	.ascii	"a\306p\342\310\320\032\255\bvr\007m\226\205\002\206\"\343\n$"
+	.ascii	"\251\323>\264/0:\257,+\224\227\\\325\036\006\206\320\361\271"
+	.ascii	"\327\2061"
+	.text
+	.section	.gnu.lto_.symbol_nodes.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\247\005%\030"
+	.string	"f\244\212G\200\336M\007\211\260\356\316F \203\226\202?\266\363\022\257b\032\373\226[(nMX\340,\376\371\250\355\325\206M\354\3020\270\350\371b(\006%R\331N4\321D'n\344\305\260l\215hyU,\037\007\373~\207$S\nw"
+	.string	"u"
+	.string	"x"
+	.ascii	"'\236\311\232\020\"K\030 \337\220x\240\035\361lf\321\353\345"
+	.ascii	"\264\265\266F\304\027\331\0209\020A\351\207\3473\353\353\272"
+	.ascii	"\256\036^\311\002\023\220~;,\270\034\024\220\033\236\271X\r\277"
+	.ascii	"t^\024\275P2<\227Y\026b\030\272\360\223\364G\326\302I\262\260"
+	.ascii	"\002\002\322S\n<\222\205\023\200$\364Hg\3564\215\340#/\212~u"
+	.ascii	"1?3\031V\003\270\367^\b\217d\231\271T\022\350s\226\026>\223\365"
+	.ascii	"}\326\362\317X\202<W\001\362l\374\361<\346\343\271\330\343Y\345"
+	.ascii	"\361\f\266\356\370\006\253\216w\220\343\371k\305\361\fn<\207"
+	.ascii	"\331x\026\353{/3\257\306\363\225\246\361"
+	.string	"Rv\306GY\246\037)\343\241l\214\177\202\361N/\330\n\351\202\251\220:`a\322\254\276\311\336\026\272\313\342\200\232\025\237dU\274\221M\261\253zF\263T\037\264S8\024O\024\335Wa_\214\270\234O5\243Y\302\006\213'\347\346Q\t\347UK87\321\036\037/\213\335\\g\\h7\037\237\272\365x\247=n\252\355\306.WD\214n\336\307. \004\355\210zt\363N\033\b\t\321\f\351\346\2556\233)\233\222\025\344qs\330F`P/\333\216Wu\257%Y\215\300\035ob\221\315\033m\273\305\215\230\254\001\004\334Gdz\2316\233I\351\332\"b\017\\\026qC\336C\334\017\352\347\017\242~\356\223\372y\231\022;}\nr\035\265\003\220\031\302\004\330\363\034b\333\274\024\307\232zn\036\235zn\2456P\231&X\301\323\251~\324\376EI\243v\354R\254\210V\360t\035b\273\2233m\202\247\347\250-"
+	.string	"N\034#L\247\227*\360d\265a\332\023\336)\244E&\334\361\274T\227x\356\003\356\274\207\272\235w\321G\347\235\323\2719&m\250\241\f\203\350\022IIAJ\212\031\003\240\002!*\253\016\021\220\220'\2251\201\224\310P\2420\0350\316\330\356\234\223\333\306\216\273Zku\277\375\305;&\351\274}=\256\025\270>\2316\273\316\303\335\232G\342\212\032\307\321M\034\"\224\334I)\341\272D\205\002?\200\275("
+	.ascii	"\242jVq.\002=%\025\302O\353\b\343\347\200~Z\2607\205\025\343"
+	.ascii	"\036\361\202;\236\224\331\207\271/\257\2709\210=\216j\253WX9"
+	.ascii	"Q\326\3402\330\033\342\215\006\343\242\2472\320 \r\3261\230\220"
+	.ascii	"~\267\375j\327l\b^\314\356#\t\312\034\f\261\271\363o\235\224"
+	.ascii	"\347\350\030\306\330;1\371tt\366S\264\251\266\242\032Vf\0037"
+	.ascii	"\341q\232\n\0171\033\2278\345\026Q\200\001G\007\335\301\372\003"
+	.text
+	.section	.gnu.lto_.refs.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\001\001\245\n"
+	.string	"\206]M4pI\222t\374\377\273\024\364\204\203\236BUUUUUUU\237\001S\017\350\374\377\037\331o\377\247\215\355\177\373\255\005\320\244Y\333\bi\326\022b\t!d\313\0249"
+	.string	"="
+	.string	"@"
+	.string	"\213\232\311\356\362\031\371\255u\226}\241O\326\005[\251\272\022u\230\375\221\357P\317\254\234A\375\255\374\251\356V\356P_V\276\250\336X9C}K}\241O\371\250\275\375\346{!\337\326I\345\245\265j\001h\326:R\237O\035\320N\362\311\231!\177\270\3160\031\311\025\244\3279@\336h\235\321\n _\300\256\232>\320\215\275J\237\330\327\355H/\327\025\223\247\367\351\276m\317\377\200\365\035\300~\203\330g\360\376\005\361\025\260\236"
+	.string	"v\004\261\037xo\340\341\013\304'\020{\005\354\024\017]\"\366\n\354\024\347'\361\237\367\r\357#\357\035\311\303\364\r\373\007\354\314\363\r\370\013\025\277\232+\372\202\224\"_\315\347D\336\211\224@\027\362\200\336w\245S\336CD\364\030\361\223\330\035`o8gx=\262\310\237#w\223|i\344\215\2223I_N/\245\020\314[p\177\205\247Oa\202\204\b\020\002\n"
+	.ascii	"g\314\b\020\f\204\200\270\231'\316\346\205\033*h\320r!\034\265"
+	.ascii	"\343UV\210\002"
+	.text
+	.section	.gnu.lto_.decls.701a6387fbcb8810,"e",@progbits
+	.string	"(\265/\375`\341S%]\001\312D\316}T \316,\225t\272o\314\020-\214\375\356\207\017\326e\035l\207\235\351c\274\255q\216\254a\2379\265\fu\231}J\201\033u\006)\036+\202\227\231\021*3\246P\201z\314oLAJI%\273\034\bCF\363"
+	.string	"\345X\306\005RU\345#\214v\267M\366\226;\005\303\006\306\007\005\bj8\340\320\277\206\362\362\241\207\226\3258\264\250\237\327\357>\254\260\312Y\001\006\210^\007\351\257\026\322>\272G\2075\217\006\353\0374\331@:\277\273z\307\205\2209?5\220\316\321\\\325\314\nCQ\313\222j\253/\n\207\306\241},\300\374`\300\337Q@\372\252i|Xa\225S\245\"\207\336\222\006\3226\250\233\017\0232\273"
+	.string	"z\335\310\272\302\201\003\007!\016\0348p\340\240#\207Gg\345\202}\365\201+\222\006\335\017\024\350n\265\016\037 G\274-\255\255\253\276\361\203\207\203G\\\333\327\247\326\272=\333\312i9#{j\323\f.j\360;\f~g\301o\243A2zF\fK\327\342\311\237\232\214\307Hn\371\002\243m\307p\263\343F\315T\220\266\375\302jI\221Z\321\366{\324\355\177N\331\305\346L\262\355\233\fW\265\013*\0363\2727\177<\252\250t\262H\301A\265xS\271\371\304\331z2\365?\207&\343\232|L1\221\241\273R\325\366=\003S\240@\267Y\350\240\351\301\025\244\355\273\t\237&{\205\n\237\253(e\222Oo\025Mxr^\222s\276"
+	.ascii	"\257\255\341Q\265\375^;\375\317\251R\334\356\306\332\251\233"
+	.ascii	"\202\300P\351!\257\222!m\216\264\375O\223\315\324\031\231\205"
+	.ascii	"h\032+Wr\333S4\370\224\016\237\276a\r(\320\355\200\002\275\351"
+	.ascii	"\353\025ez\314\350ssi\250x\023\245-\335\243lhr\003\332\346\224"
+	.ascii	"\217\276\275lBfd\316\310\237\006\002\207\r\255mG\301\247\033"
+	.ascii	"\334\372\367G7\270?]S\347#\f\t\222\266?U\203\301\017r\006\325"
+	.ascii	"\2164h\200[b\202\030A\203\367\301\255jL\333S4<\352\204~\251\310"
+	.ascii	"#\006\234\302\364(\036\rC\313T3+\034\305N\210"
+	.string	"^\316^\364h\036MR<j\346\364\f\275\273\345\300A\250g\013\021;\275k\313-\032t\377F\201\356\251\032\246b\350\030\232\334@\311\234\202\241h\317yB\346\264\234\351~\350VZSY\333\3231|\272\341\376\374\375\375\375\321\r\367\264\b\266\024\350R;\re^\230\274.mO}\340\377\324\013\245\243IZw\212\314\371\351\t]\243u\324\n\355R\221\307\ft\375\320\3139\237\001\277\207:\312F\253\3700!3\223N\227\017\2517\276\234\263\006\016\034\350\020\255\234\343Z:'\364ce\313\220\252\266\247+\360\031p%\354\247qt\013\345B\223T\3564\013}B\327N\221\031\352)\347|\020\340\250\233O\315\031\307\3301g\344\351\233\007 P9\252\205\272]\340\2243\216\033>:\3168y\303\2273\222\203\020\007\016\235\331\256\270\260=\b\360O\261\3749:\\\332\3248\266}\007\3605\200_\001L\201\006\335?"
+	.string	"\3774\312i\225\237\246Q5\352v\202\234\237r\316\031J,}Y\222\264\245R\350\024\232\304\200\266\335\003\020^\231\316~z\342\220\305y\323\366\036\340S*\307\300\225A8\020>\305\340\322?\212\301\245P<\234F\001\272VX\310\274\226s\376\351\001[\202\314m\237\244@\367?X\210\006\335J\201\3561.3\r\272o\243@W\003\032t\177z\266\241\307M\030\247\261\266J\350\022\332\244B\265\330\312k9#+"
+	.string	"\225\\\351ZkK\2334-\243\310\323&\224\311="
+	.string	"\341<OyI\316H\332\304\346\334D\351"
+	.string	"|(\035@\t\007\326\204v\355\033\037I\203.\246@\227\255\266\240 *\331\006]J3\n\342m\264\005P\035F\2444U\fi(Tn\374\025\303\330K\324\032\335U^\340\247\033t\240\305\363\227\016\350\021\177\213\370\373\003\177\033!\361w\t\376\016A\\\233"
+	.string	"\311_\213\374}\002\261\277\342[\341\177YE\301\220\277\016\217\1775\2065\210c\370\357N5\022B\201\277\215\025\354\357\t\374\224\310K\2008\205\377\002\333\317\376\245\033j|\331\336\337'j\220\277\311\324\235\n\344\247%\374\264\001?-\326\021\200\240\022\370\361\267\007;\177\333\277\006\377F\201\217\372\365\323\005\374\024X{\374t\303O\177\376\316B\300O1\374\264\003\335\300\353\215\205"
+	.string	"\320\265\376\360\177\003\002\374\277\240B\200\216\370)\217V\243\201\277\024Sy\374wks\353\177\333\005\026\376#\240Dc\t\373\333F\315\361\323\003tpA[\326{\376\262\001\177sU\034\033\264\216\013\1779\302\315\332*\0067\376*B\213\236\225\306\337+j\326\337H\252\r\r=W\253\250\221F\351\325\032\177]!\306\303_&\033j\005\336\311\264R}Qv\241\337\266i\253WN\235\242Z\375\225\307\305\321\371\036\200\337r\371{\256V\375U\003T\377\273\374w\273\226\377x\227\243{\336\357\216\346\033\350\3618\006\177\331\344o\266\332\342o!u\352\177\334\337\301\013\342|\376\322\310\337S\252\324\337h5\352\247B\376\256B\203\374\364x\001\017(A\177)\343?\337\006\025\212\305O\263\376\272\342\247[\177\233"
+	.string	"\243*\340\357\023*\376\372\301\323OoP\256#\340\377\b^\242:\201\350\272\001\3762\352\357+\225\351\247MT\305O[\360S%?EB\313\376\317\3755\377\365\204\237\"\273\255\207\324\245\2372\375\035\244P\325\204\237\242\275\354\177\006\1779T\341\277^S\375]\365W\245\377\345_\002\377z\376\225\370\327\022\376z\342\257&\376J\202\277z\340\257\033\370\353\005\376\332\200\277\202\360\327\005\374u\303_3\370\253\206\277f\370k\317_\361_\313\277\326\277\375\376\356\373\273\315\337{\177\253\371\333\314\337d\376\026\363w\227\277\355\376\246\373;\356\357,\177\207\375\215\345\357*\177\267\375\r\345o*\177\247\375\235\344o#\177\023\371[\307\337=\376\366\372\273\353\357\254\277\265\376\206\361\267\325\337U\177C\375\275\342o\247\277\231\376f\301\337+\370{\204\277\227\376\006\341\357"
+	.string	"\374\267\373\351\331\377\262\237\366\370\251\327\337&\374\224\353\247,\376o\360\323\016\376N\361\377\356?\231\277\225\376>\177\n\202\237J\340\357\341\337(\370\373\304OA\374m\376]\364\377\350\377\005\377\207\377K\374m\342\177\206\377m\377\371\376\016\376}\202\277A\374\375\200\277\035\360S\343\337\r\370;\204\277\013\360\267"
+	.ascii	"\376\316\340o\f\376\276\340\247l?M\373)\332O\315~\212\374)\221"
+	.ascii	"\237\016\371\357\346\247_?\345\361\323\035?\355\372\351\324O"
+	.ascii	"\245~\n\365\323\363\247\036\374\324\303\377\276\377j\376\247"
+	.ascii	"\371\257\367\037\315\177\263\377\310\377N\377\267\374\327\360"
+	.ascii	"\367\367\367\367\357\220\360\363\304\371!0\025XBTY\213\311mE"
+	.ascii	"\316\275V\246\355\n*\255k\313\203\233\223\264cf\201d\242P-\266"
+	.ascii	"\3621\217\341\262\302iLf\271E\316\231\252\301\307+\030i\332\332"
+	.ascii	"2l\246\366\260\264=\205\214\311X1\300\036j/\220m\377\243\006"
+	.ascii	"\3776\f\255bf\346n\314\227\244\375B\253\220\200\314L:NZ\244\336"
+	.ascii	"\370\262\225U\002\376#\006#\255S\034\f-$\217\013\027@\266\274"
+	.ascii	"\310\031\300\b\226#mO\327\216\370\351\345\214\264r\027\260\263"
+	.ascii	"r\025\211\315R\221\307\034*No\364r\316r\325\b\234#\027Kg\347"
+	.ascii	"l\027\232\264r\267"
+	.ascii	"Zl\234\335\202\245I\022%:\226~\321\240\033D\201\256\305\"\264"
+	.ascii	"\203\225f\314\251\355\177\252\340\203`\245\224\321k\263\311V"
+	.ascii	"\253iG\374\304\to\n\231c[\2679\261;\323f\235X(5\355\230\303\302"
+	.ascii	"\351N\357\255\315F\271vfX\020\341\263p\266\212\265b\335\354\025"
+	.ascii	"\373F\223\266\355\226JG\3312)\330\305\331\321\307\376\207\312"
+	.ascii	"\217\023\374\037&\370?E\260}b\327h\362[,\333\221?:;\342\336\324"
+	.ascii	"\264\375\017\020|\372-\267\005\364[\356\177x\340\337\252\331"
+	.ascii	"40\2613\247\266hUuV\340\264\375O\0163\213\244I{f\231\274\243"
+	.ascii	"l\231\224&U\314\207\251B\316;\230\234\331%U\214\322a!\363\013"
+	.ascii	"\340\023\263>+>\353\204FF\356\332\373\370a\352\263\207\357\203"
+	.ascii	"\006\377V\211X\231\026\267\306&\261d\226\314\216\365\2212fwT"
+	.ascii	"\220\330#\331\212N\254\255\021\252v|\223\244\355}\346\360\177"
+	.ascii	"K\304\016\261aV\210\025\263G\232\264E,\220\333 }v\213f\2134\235"
+	.ascii	"\365Q\315\254p\322\351\256&\301\334\034\261\274\370l\021\373"
+	.ascii	"\003\355\214\036\217<[\304\366\210\200\0276Zc9#\205~\302\264"
+	.ascii	"Y\323\342c\357#\004\363P\240{\237,|\237*l\277h\332\023\037o\332"
+	.ascii	"\276\247\r~\017\030\374\036+\370=K\360ow\330.\270\253;4m\255"
+	.ascii	"\016\313E\223\266\353\271g\307\253m\255\251\355R\3169\323\303"
+	.ascii	"]\340\341\356o\267z\005W\220 Z9\252L\020A\343\303\342\220\301"
+	.ascii	"\246\227\374k\373\333\033Vk\313-\013\217\2666\013\t\244\202\325"
+	.ascii	"\005\255\355{\206P8qw\035\305\205\314\261\243\272ta\203\205\357"
+	.ascii	"H\341T\361;^q\343ALrJT\226<\275\216\362\302E\306O\341\274\365"
+	.ascii	"\241\331m\321\243p\334\340t\324\034u\033s\304\302\203\322\246"
+	.ascii	"\372Y\0305\216\215\262UvF\345\263VV\206\245a_\3247\326FuS\341"
+	.ascii	"\330\032\226\312b\325?{e\263ua\235\254\224eac\330'\333d\231,"
+	.ascii	"\224maU\324>\273\202&\355T]s\352W\367\336\310\234;\n\214\026"
+	.ascii	"\n\247\215\272\305\251\311\337\303]=\023\345\030&\3131g\244\235"
+	.ascii	"\252h\252\032\237\232\363\216&\3078yc\250\033\025\275/qzd\246"
+	.ascii	"\034\313\3243R\340\376\216\252\223\323\3538\177G\321\315\301"
+	.ascii	"\241\362\327Qrf\252\022)R\3075-xG\017zkv\252n\241n(\335\027\005"
+	.ascii	"\226\234\261\362&\312O\341\330\251\312&3\241\371`\310\2202}|"
+	.ascii	"9#k\r\037Ws$\330\367T\341\332\343\204\377\232\346U\315\tr\006"
+	.ascii	"\240\330_U\232\2665\206\207\3274\031L\201sk{\0368\370<f\360y"
+	.ascii	"\264\340\363P\301\347\001\303\325\214\235\301\305KH\333\363x"
+	.ascii	"\341\363\264\300\337\351\303\337\231\303\337q\303\337q\202\277"
+	.ascii	"\223\004\177\247\b\376\016\020\374\035.\374\235\027\370:}\370"
+	.ascii	":u\370:I|\235#\370:?\360up\340\353T\341\347\360\341\347\234\301"
+	.ascii	"\317\211\303\317A\342\016h\320}\216\016\374\234(|\214\006\037"
+	.ascii	"\277\341c%\370Yh\320=\326\201\217a\340c'|>(l\224)K\033\224'\257"
+	.ascii	"l\177\223\3255\352\206n\345\220\351K\266\265\265\231\006\335"
+	.ascii	"\352\304\303\353\223,=\364\332\n\240\252m\220\361\223\225(Kj"
+	.ascii	"ZE3\343\344I^\253\220\233\033;\223\353\271\352\202\003\315\254"
+	.ascii	"\"{\354\016\206\212\312\244\226\325%\265\tMV\344+YMR\225@U$\006"
+	.ascii	"\272~\350\235\035\241n>L\024\262\223]\220Z\344\367P\221\325\b"
+	.ascii	"X\303\3518\025Y\221\324\261\212<v\240\013\210^\316\271\307\215"
+	.ascii	"\025\222"
+	.string	"\036:\366z4\350\372\370\250\211\nr\244\355\201o\360\201j\360\201g\360\307T1\267\266\343\322\302\211\310\220\031O\324 i[\217H&yO|m\017\254\202\317\200\037T\216`5\214&\253\220W \224\217\276!\205\324 I\275\235/^\3020\271\366@(\030x\206\377\352\243~\345\034]L\271\202\334i\303\301\026\243\007\217\261\036ddm\2179S\\\212Dye]\031:\244\300\355\350\302\362\342C\256m\345\352&*\230\330h{ \020|\272\266Ug\324,\237+\n\371I\210\337_u\324\034\025\007M\326\255W\0305F\225Q\267*\025uC\353\260(\260\244\214\336V\255\252/(\035\026\004\306\310\350\345\2349\bq\340\240\002\255;8l\261\252\rJ\207\005\242J_V\245\321j\224n\r\304\333\033\255z\203&kV\232\206\2373^\262\323\265\325\206\333\trN\3139g\350\301{C\202\265\245O<\274\326\200"
+	.ascii	"\220\035I\332\036\370\205\017\334\201\017\304\302\037h\320\005"
+	.ascii	"V\027\325\212&\205\352U\376\241uNUZm\017\274\302-\310T\350\376"
+	.ascii	"\217\n\335\003[\340\0033\376k\013!3~\\\346\246\252\024Z\\\222"
+	.ascii	"\246\266U*\252B5\341\021EG\333\312b\355\013\220\2643m\177\307"
+	.ascii	"\340\32377\324\215\322aA I\223\372T\231\252S]Q\233j\246\311\252"
+	.ascii	"\342"
+	.string	"\355\327p:N\263\251*\372\257\325h\035\026\210%P\326\370\326@\350+;\266a;V\025\375\346\001LX\020\341\313\031\271&*\317\205\217\375\355\202\277F\203n\016\005\272\267\r\377.\301\277b\370\327\013\377n\341\r\275\267\306\007\357\314\f\323\232\253A\362\243\007\226\266i\204\312\261\243\332\214\266\27700\231\2226\373\260\302*\307\005\332\017=\264'8\216\324\317I\216#\365C\373\222\222\245\227V\244\307\252\354\300\372\354\367\320\326V\354\250\222.<di\271\017+\254r`8I5Y\022; K\246\264\232\317\023\205\374\324e\343\270v\243\256\331:\312\224\235VZ]\323Q\267\212<\002\237t\205u\024\225V\253fV\370\tZ\215/}\246\3074\232\306\353\274\326\3530\r\246\357ZL\333u\2316\323^\232\fMv]sy\317u\027\272\244\256\337\032\013\245[\313M/4\030\202\314\223\343\313\031\351s\026\204\nI"
+	.ascii	"\373\322\f\276t\024\350\276\234\303\177\313mY3;S\306\022\021"
+	.ascii	"\223\f\213k-\267\314\356+\256\355"
+	.string	"\313)\370\245\023\270\276\362\323\206jM\030%pG\260[W\341)\362\302\205\220\266/\277\334\312-\374\222\006~)\205o\341\340\3335\370\357(\207R\036\303\316\356\350~x\342(\261\323\321\366\326\f\276\235\303\267n\3706\255\323\220?9a\324\334Xk{\253\004\337\n\301\247k\322\3102\025V\254|\265\275\225\321\244\313\362\255c\222\2350y\227\375\200Q\361\262\243m/\241n\376\250\310\301\265\375^\316\016\226\037]smo\245\360\353\033|$\005\272G\032\211\021L\303\253\351\256\355+\230#F\340\b\231\343{\0339^O\335\0132\271\355k\026\214\254X?\310V\020\031\262\263\243\305\334\221\266G\244\316\224[\037\227\266\257O\360\033\253\201t\r\352\246\"\3330\213@\002p\0075\305\314\024/N\246\264\275P\233\025+w\213\320\026\023\032\b`1c\243U\313\330X\231\213\373\335re\344\374 ka\244\355\325b}"
+	.ascii	"\333\354\350\"\326\366f\261f\324vP\021k{\261\264\331\217\217"
+	.ascii	"2I\240\332\336+\277{\3321dK\333\013\327jKpT\321\322\366\2765"
+	.ascii	"\2267ma\242\254T'>\300\224\231%\377\344u\243g\331\305\007\254"
+	.ascii	"\362\344\306xtT]\t\323\366\353\326j=\302P\265\2702r\350\330\260"
+	.ascii	"Yk{\24106\266;\245\213\213\357\317\216\307\225\362;\305\315\233"
+	.ascii	"\033Qmo\024\352&-G\\_\333\013\345|"
+	.string	"\032#\023r\"\373UBv\237T;\236\314t\226]"
+	.string	"\243$\371\033\343\313PX\033|\246\362\270\274\220\277O~\235x"
+	.string	"\302\357\206<\2348i{\325N}\250q\002\325\366\027\355\246\37599C\316H\211\323\366\031\276\340{\266\200\033}:\374\332\376\232}\325\201\031i\333\364p\3676i\252*Fn\264\275e\317\223b\366\245\305d\256\313\316\251\355]\342S\205\005\333\226\266\317\300\005\337$9Upxq\265=\020J\230\254c\333g\270\202\004\311\005\243jyYW\200Pd\300\221\321\366\031\326\302\302\256\221\013J\322\274I\242\363T\003\r\216\"\277F\200D\3100\201\265\275b\207\333r\222\254\321\366\0229\234\215\0360\242\264\275C\016\367\206\255\311\227\266\367x8\340\226\271\256\034\\?\376\037\027Lh\253\202\341\303\332p\200\264\267\267\033\344\027\314\206\215\371\361\245\355\005\342c\3064\004\214\035\223\243f\357\215\222\266\317`c\353\227\307\326\375\262^rv\352"
+	.string	"\3514&Cim\260d[5j\334\036\277_\207{\261\225\226\333~o\303\217\224\0236Nm\357\216_\257?\007(\006\314\226\263\266\317\360\002_\256\337\256?\247\314\202a\246H\333g\240\302\377\325\361\347\360|\311\315\245i\373\f,\3601\270\311\312\2728\216<Y\334\220Sn\374\342"
+	.ascii	"\352Ya[\322\366j\001\223sqgZ\355\316\271\360\353\023S\243F\235"
+	.ascii	"\032\032bdQt.\\\\\032BV\254\362\360\333\323\222\0363~i\360pS"
+	.ascii	"\345F"
+	.string	"\333\373\342\312\320q\261\027FL\306\215\221\245j\013\2204\326F\2247-\027Fs\301\341eCL\333ku\257\376\347\364\374\365\375\245]\331\272*\305dM\022\203\333\225\222\272T\364,\273\270O\322\250\221\343\313\031kC\331\327U\205\244\272-\316\\\371\363k{\247x\232fP\361\322\366\030\300\3601t]\026\227\305\205\302[\244\336\306v\3449\255i{\2410\324\270*\256\212\353Ds\316\031\013\002C\242\0343\026\326\206>\036\313\274i{\f+\342<\316u\352\234s>\002\263\f\031\323[\263GF\243\351\327\211\317\311\\\225\266\337\273L\377sJ\200)\323\245\355\177\231n>\332P\003\007-\003g8\365a)\377,\223\033/\2024A\343\347\347\001\210\324\333X\024\246/gm\037\244\305\215\233\262\217\204\013Cp\340\247.pom\373\206\210u\265h\373 6\374\227m\332\3301$lY\257\265\254+c9gI"
+	.ascii	"O\r$me\332>\250\f\377\345^\271\206\306\251l4\277\260\312@X\231"
+	.ascii	"^\320\361\356\256T\023\266\344G\016J\025\034i^\252iR\215\254"
+	.ascii	"=\261j[\342\225h\376\347\344\360\200\323\346\252DS\352!A\342"
+	.ascii	"\305\316f\t\235\211\341(\363\352\032\236\2551k\306\004\3550c"
+	.ascii	"\246\325,\205\374\324\325\344\030\344\202\f\231\2628\030\f\230"
+	.ascii	"R\f\316S5\302\274\024\343fg\003M\326\035~\351\205\226vv\255\266"
+	.ascii	"v\341\r\237\266\332\225+\351\344\312.\227\013\227\262\013fb\233"
+	.ascii	"\312\251\203\322k3\367\262\013\022\224\277!\027\236\340_\020"
+	.ascii	"\303qq%\224\036f\256\227+ I\332\376\302V';\251\344\355\255\304"
+	.ascii	"\202s\322G\017\216\262({\345\225\227X,\230[Z\225\266%\334\363"
+	.ascii	"\366\342l\361\301\311pS\302\245\355/\270\300\247MhY\245\nm\002"
+	.ascii	"t\352\342\327\326\226d\017;)\2438)\251LyI\245k\274\2502\327\266"
+	.ascii	"\224\362\344I\t\245\007\025\017\231\232\330\036\333K(9\307\031"
+	.ascii	"6d\264-\327\256\032\215\2661 .\370@ex\311\2222\rg\2658\037*V"
+	.ascii	"\306\252\320^\246\265\227\025\325\215\266e\223\362lG\f\217${"
+	.ascii	"gf>>\300\264\314@V\256\n\303\346\310Nu\310W\030e\377s.P\"\303"
+	.ascii	"\257\214\211\217\027;>\274\026{!G\243\355\201x\340\227c\264L"
+	.ascii	"\222\244\034\263c\262\205O\313\261[\"\251\222\243\305^\333\003"
+	.ascii	"\311\300/\305hi\304\210\216\323\034\220\023\246\177\224\272]"
+	.ascii	"\037\345\321GI\244\034\362\222\310O\227\247\270\277\362G\371"
+	.ascii	"\243\f\303L\324+\nk\203N\222=*eB^\206\361\260\b\303\353\002\303"
+	.ascii	"A\272\374\254\300\312 MM\322\260\3209\232\345\317Vgjvm\201\234"
+	.ascii	"f\371\241\362\225\223!W\332\336\302\035\276\2056\374\227=z\364"
+	.ascii	"\232k\2253\205&\247\247\206O\305\320\322\313k\203E\346+\235\256"
+	.ascii	"8d\002n\341\b\216\222\013G\331u\367^v\325\025\021\002\245m\216"
+	.ascii	"\034\245\016\f\244\232\333z\251\243I\217\332\217(Nm\277W\177"
+	.ascii	"$\321\302\242\355-\354\300\2670\205e\224Z2\312,\004\344L\221"
+	.ascii	"[.\2542\226\325\206rF9\243\314\"\201I'\f\253\264\3612\253\335"
+	.ascii	"\374\214$i[\322(k\374\317\3411\223\352\333R\243\3042\302#\313"
+	.ascii	"\361\350\363%\216\324\225\n~\370\025\302\340\227W\264\204Q\302"
+	.ascii	"\240n\024\231]\334.3Ro|l~tik\373\nZ\360)u\273VVli\370/\245\222"
+	.ascii	"\245TYe\301\352\002hR\364\262\025V\002|x\314%\303\224T/\253\376"
+	.ascii	"r\252lA\361\332G\214\323\234W[\017<\274\244\272co:\334\264\325"
+	.ascii	"A\322\240K\277(\320}\0052\f\005E\005\0306\347f\311\027~\371D"
+	.ascii	"\313\025+l\033j\205\251\240A\321\2530\003\237\3326\367\224\214"
+	.ascii	"\226N\311\322\211\242\271V9,\354\246\350"
+	.string	"e\253,\t\300gO\332d\264}\005(|\373GK\246d\311D\313Xd\276\362AK\366\341SZ\346\336\372Q\033'i\343X6\024\231]\354te\361\222\200S\370\202O-\233\333\327g\337\220)\225l\271\351\265=\2058$\320,\257\355\255-2-\347\254\341gK\2341\250\266_[\276\274iK\347\263\303\"\331\025E/i\365\354\232\rdn\325\334\256\371-\032\233\346\251\262\371\261m\265\265q\036n\325\374\334\020\302\204\325\226\036i\320\305@\201\356)D\301\267g\354\335-\336-^\227\341\234\263\2175\2517\276\214e\265\341\024\222\340\377\364\375\337\334d\225s~Q\"\263\225\023\317\375\351iI\351\206\277\207VJ\200\377\366'\341D\346''_r\316t\r\026K6ei\220K\272\234\237\270\230(\300u\365\304E\003*\215\353\252\002T\032Wfz\022\302T\301*s1A\245\345\\\341\351\211\t\304V\256"
+	.ascii	"\225\226\257\262\212\272+\232\221\\L\371i+W\310O\271I\003\250"
+	.ascii	"'\256+\250\264\246\253\nPi\\W9\215+S\310OMVQO\331\252BN\343B"
+	.ascii	"\223\323\266\256(@\245m]A\245q\255Q2\251\256\0301\324\276\370"
+	.ascii	"\220\242nPO\271\212J\253\311\212\002\035\024r+\217\311\231\256"
+	.ascii	"\255\310V\231.g\002\344\254\265e5\246\211\006ms\242\253r\222"
+	.ascii	"\322\264E\2219g\rTN][\371\211\216\211f:\250\"[9\027qB\221\251"
+	.ascii	"r\316\371\003&$]\366A\351\230vh\345\026+r\006@F\346L\2253\023"
+	.ascii	"\315t9g\246\2343\320J\013\231\263\r\nPG*\252\234\003&R\260h\001"
+	.ascii	"\013\032\316\241\340yd\2020\221\204\347N\211$$\242\234s(\254"
+	.ascii	"\305 \n\"\0134\202X\002\005\321)4\201\304\211\241p(\f\"\231#"
+	.ascii	"\214\346y\202\bFJ&\214\026\212\247\b#%\023F\340\207\017\030)"
+	.ascii	"\2310\356\024\r\205F\027H\f\315$\242\317\005\216\242\003Q\221"
+	.ascii	"H\310<\203EIJC\347)$\"\032\n\301\003Q\221\310\302Qt81\024\026"
+	.ascii	"O#\007f"
+	.string	"\221\322\021\321P\310A\321\250\304\001\206\243#\245\341\2208\004\236C\246\n\204\306{B\022\021\222\211tO\"\263(\004\321s\024\035\214(\316 \222yb\030\034\241#4\032G\234\246\021h\002\261\210\342$\016\201FA\363\310\236\306!\221\250T\301I44\024\236GB%\023CC=\"\234&\211k\244$\202\317Qt0\221\204'"
+	.ascii	"\316!\343\007L$\341\211G\220\ba$\026\211\204H9EC\241\b9C\241"
+	.ascii	"\005L\025\b\217\202\302S8\fq\301\370\243\323A\207\236S8\f\261"
+	.ascii	"4b\247\304\321\221\222\321\005%\242\211$<)\024\t\217\202 8\215"
+	.ascii	"\301#!\036 \021\026Na1\004K#\212\314\021\026\212B\234\302\241"
+	.ascii	"\322\315\220A\006\363\f\236\306\262h\236\306\340\006\214J&*\004"
+	.ascii	"]\240\263T\024\302\247\202\220O\007\035\316b0\251\303\b#\202"
+	.ascii	"\316#%\2439\342(h\202xt\202\3474\006\217.\350\024O\021I\024\222"
+	.ascii	"\220\202\247\321D\022\2260\217\212B\234\306\340Q\205\342)b\251"
+	.ascii	"(DQ\320,\366\22481\024\236\247\020\3118\f\026\317 \363\250(D"
+	.ascii	"\216O\360\f\202\240p\"a\321\034\232'\360?\b"
+	.string	"a\001!|X\002\376\303\003:x@\007\367\037\036\340\301\303\003B\360\200\037\202\207j\016Y\340\2029DBh4\026\315SX4aG\004\321h\030\242h(\024\341B\221P\251\236FS)\005f\021X\204\315\244\023J\024\r\205&\3609\364A\bEB\245\023\366<\212\016FJ&\220\202f\3614r0$\"!\021\2112(\032\232\3258d\244d\302x\213gR=-\020\205\031N(\236&\222yd\236\031,\224`\fn`H\024\236DC%#\036s(\004\206$#\2221\351D\205%\263h\030\302<\203\305%\242\211\022\210\202G&0\234'\222\214J&\214>\306\241\023B\243!q\204\245\242NR\020\211\250X&\025\231\025\226\314\243$%\020FGA\024:f\221\260X4S\020\207\206B\r\316!\340\211`\t\242p\350\204\322Q\222P\205\3234\232\305\242\241\320\304\320\0314\016!)\025\317\022\314$c"
+	.string	"x\314\243 \221\316Y4S\f\205D\305\"!R9\024\"\341\022\210L\024DKA$\374c<\n\2468\"&\025\315s\030\202\250\230\301h\232\305\023&\b\363\350\304\260\002H\301\021R$\031Y(:\"\2420\232E\024%\3143\230Bx\022U\300,\"n\240(\f\n\r\205D\246Qih)\2104\264T\334\031ZR\n\016-\005\221~\214Eb\261h\006\235\246\321\310\210\270c&\235pV\320`dD<\225\21020\n\227\202C'\224L\230E\247R\322P\230\301L:\341\0342S\b\317`\na\321,\272\240H<\211\202FC\304S)8tb(Dq\022\211H\306!\242\242P\021QX4\223\206\214\222\216\206\206\210\212\306!\241\321X\324P$\034:\205C\245\236\323\0304\032*R\n\232\030\372)\n\022\217N\b&\001Q\234\020\222@T$\002\232@\324"
+	.ascii	"Q\221\350\022\213\347\220\250\241(\304\tGIf\021X4\f\"!\021\211"
+	.ascii	"\200#`\370\240\324\0360@\251\226`\fn\340\n\215\306\2425\232F"
+	.ascii	"#Q\003;&\224H\230%\004Q\030\213\206A\0222\024\2050\225R \034"
+	.ascii	"*a\223\250\250D4\372\024\2050\211\204)L\020C\242\360\f\016\205"
+	.ascii	"\247\321,\002:\341\024\026\211\302b\022.2\317\"1)I\211D\221R"
+	.ascii	"\320D\017\321h(\264\347Qt\340\300X4S\b\213EESh$<\207f\221P\307"
+	.ascii	"8\304\003\202\263H\024a\036\231\b\226Hq\315!\263\210\270\201"
+	.ascii	"\263HL\3221\213\210H\326\034\352\300Y$&\365\030\207D\341\231"
+	.ascii	"D\004\232gpD\221R\320\0046U $a\252@H\002\237\270(h\222P\344)"
+	.ascii	"\n\232$\234C\0360\340H\030,Q4\215\214\224DX:yR\bM\"s\204\220"
+	.ascii	"N\360\f\202X*\372\024O\021!\202J \n\2328:\n\216`\036\025\ty\316"
+	.ascii	"\243\350\260T\004\n\236A\020&R\260h\224s\016\351\230I'\224\020"
+	.ascii	"\301\b\022<E\263H\230\202X\024\261T<\n\n\213\246\221\3029T\""
+	.ascii	"\216\300c\236\301\021(\214f\321\310\034\261T\354)\236\"\206\026"
+	.ascii	"\b\236A\020&\004G\024\005\315\021D\305\235\342)\302\302\320\002"
+	.ascii	"F\2453x\222 *\376\024O\021@\306!\363\f\236$L$\3419T\032\261T"
+	.ascii	"\2440\264\200\321h\022\021\213\"\210\212\024\202g\020\304\221"
+	.ascii	"9\034\006Q\020\355"
+	.string	"\234C!x8\207B%l\244$\302R\261<\207B\r\212\314\341\t\241q\250\30434\217\252\211\024,Z@\347D\0350\220\340\301\321R\221\304\316Qt0\232I'\234C\027\234\230d\02698\211\304\"\007;(\316\023C\363\350\026\025\t\333L:\241\204N\321,\n\232(\3569\364\341\034\n\225\200\367\340a\004\r>\300\201\013`\242\016\036\034-\025\215\034,\0259\030\n\203H\034\020\025\215\034t\b2!X\254\247Y\002Q0\351\036\021\211\"\f\225\377\201Ih\027\235/}\\\326\220]\032vM\212\2146@$\007\216\3755IU\322-\262\260\362\332\002\217x8\020I\330\332\226-m{\200F\200E\260\200\311}i\013\024\253pV\366\324\366\032\316\340\037H\344\232\001c\243[3$\357\002S\336\224\343]\203\206\025'.\354\212as#L\310\232\03547\334b\200\3311>\352\260\374\001\203\3307_H\330"
+	.string	"\331R\232\305\340\322\364\343\326=\341kR\303\207\016\340\227\037fl\276J1\\\362\266\f\001\3628\260G\232\031:\262\332\002w"
+	.string	"\275\220\034\241\220i{\232\374\035\236\330\231*em\201\\\300\256\257#\233\225\347]\317\212\257\b_\031\035\367\t\260J\311\033\036[e\226\217\231XZ]\216.\266\032_]8pT\"OX*n\\\267\246\2532\036Z\255\206\331\360\350\246\262\306\274^P\371j\013\214\001\214\001\254\221\303\344c\306N\310\033_\306\212\261\341\007\3168\260\006\020\253L\017\2708\032??X\366r\264\265\275\006'\030(\343\266\250\213\003\326\246\305\377\234!\270\037|m\257a\t\376\2010,\233(\271\277\027\264L\316\027$\177uW\266M%\033Cw\304\352R\3211;\310\246\\\224]l\017\266(3\252\356\224~KK\"\251J(,2\027/`\213\260\277\277\030]\300)*Sp\330`"
+	.string	"\245\322\272\246\2241CJ\035\341\244\201\372:\367\302Li\213\274\200\205\244j\005\230\324\232*\262\266?P\3055B\263b\274\330q8\240\0232\315gNL\2301m\257a\f\377\300\246\022K\243IFU\361;\220\351\2571\252\f`\346\001C%\315W\333\033\347\376\035\230/\034`\376`+\347&`\376\361\313\271\351\207\322\001P:"
+	.ascii	"\233\244+\f\312\265\327 \206\357\033\017\277~\315\204\007\324"
+	.ascii	"\217\266\367\366]>\234\005\307V\221\353\246$\362\2036\305\264"
+	.ascii	"\342\266\241pk\230\202\264\275\206\034\370\277l\312*\026vN\250"
+	.ascii	"\264E\203\346\256\241\024\220Ng\360\364\260\026:3[j~\327\374"
+	.ascii	"\301P\003\247\355Ms\231z\310l\221\261U\261\263%{M\332^C\213\273"
+	.ascii	"\273\233G) \235\312\220\321\343Q&\004\f\3577\017ngK\007\013>"
+	.ascii	"7dN\346\232\021\302yI\2212z9cm\310\341\362E\n\2232\277f\252\030"
+	.ascii	"\360l\315\030&!4_\276\\1\224MG\237\025M"
+	.ascii	"\303E\026\025\346W\f\036\2209\257\027m/\230\313\244B\314oK\b"
+	.ascii	"\f\027.\267Nh\213)\315\007pLl\264z~\310\020\302b\356\267\356"
+	.ascii	"zi3\345\026\306\313\245\223\2232\005\306\210W\034-y]l\206\033"
+	.ascii	"\250\3231\264bH0\206\030'\225R\312\324\314\320$i\f\303\025@ "
+	.ascii	"H@\"\222\n\347\311=\023\200\003\314\013FA\324c\212\261\231\221"
+	.ascii	"$I\262\327n\035\211y\"&\373}\330\312\242\260\217\320\211\357"
+	.ascii	"!h\b\317\364\255P\220\217-\204D\016\024\374h\311P\346\203Un|"
+	.ascii	"\001C\360\321_\024iW\0077R\374\307\003"
+	.string	"`\004\".x0\355!\304\245\344\216~\227\235/M\202\310l\322\362.q\366\330\360`v\0239\336\2318\346;`i.\013\307\rEHM1\"\354\301\245\260R\021\371\264\202`PO\304\313\345@\340\300\207\r\"\004E\241\005\264BC\341\363\025\373\252\336\322\270@Rq\326\305(~\276\003\263s\334c\200\2634\346\034\371*\017)8\022?R\345#\346\247/\333z@j\322\227\223n\247\373\341G\322\016D&\216\350%\235\274\347\034\235U\3063\350\3040\177\271r\220\325V\374\310P\241\353\377\376\321\350Ti3\257\0068\037\232\001\2229\017\330\317u\277\267\025\355>\323\300w\340\004J,\0252\231\255\221\200\340\334\311\300\323\371\215W\033VG\252\317\217,BoG\327\320\b\216\0378\224\361&i\235\316\t2\323#i\245\t\221\255\001\305\254\376l\307j\rCv\270lc5\032(@Z\276-\3416\f\\\020"
+	.string	"\220\276\026\3435\340i\355l\331\233\366\\\316\027\377\353\fF\244\375\205B\265\236\373\332\377\003\336$*\233\335-\t1\337Jy\017\275\235\267\252RT\214\377\366\243\206\370\30785\354\2326\323\306\233\2730\b\374(\331)\2166\356\035=H\031_\022\363\324UU\321\307*\215\034\273)~?\320JL\035\313F\230\263'\331\264\371\224r]\310\253\354\300\2515\261,\233H\362\375fz\302\366b\220\371\247\"\225\236\372Dk\306\260\232$\302U\221Y\254W\220\211\202Y\036D\351\222b\246\237\025\275\266\340\377\336&\200\301\277\242"
+	.string	"\365\0305\026\001q\342\324\346\265e\224m\251\311\216\003\341a\331\375Z\365\023\372\327\231c\345\224\335\367\260D\377:\004'@SG9<\366\261\341B\313D\216\021\357\366\2511RX|05\254\341\013\332\361\202\346\037\302_\033r\241\356\022\243\f\240\337rp'\263\277\033\021\210\232\036rk\252\261\305\353\213'I'2\262_4z#\207\254+\371\272\376\313_\213\215\273\241\255\r\257~\333\222\t\350\276\242i\214\304\222\316Y\367\221\006Ab'\001\207c\275\317\251\"E\034\016Y\223\335\360A\013\004X\306\303\302\003\2350\306\335ho\255\213@\341=\316\372-5\300pCYw\346\300\372h\020\345\210\344n\005\036\250\267\322r\250[O\327\272\224\305\322\345\342\333\274\026A\326"
+	.string	"'\032\23544:\006\334\217-\203\202\2035\361\330\"\300\301\006\276w\036O\\;\343\205L\353t\226\251\262;\306\016\027"
+	.string	"orPl7\004\254\3106\025\307\353X\322\332\"uA\234nV\017\035\004\006\340s\002\216h5Z*J\022-]\351\263B\200`\357\272n0z\222U\334\334\236/Ui7G\276I\246J\252)\235T\372\237q6-\030-GT\364\261\341xk\220\237R\244\340\333\365Y%[ES\304\220\244u\346!\322KU\323\310\336\020\031f\220\020\334]\351m\027a\237\243\204\0039\001\242%\005\373\210\016<\211\255O\266G\312\025\216%_\376I\037\213Q\343#\261\203\233\274\343\203\203\325*\350\323t\276\306fqO\021\350\230fI\tI-Y#\3037zj\322\3711\260\0318\001\032>\026W\366\004@\306\313i1 _"
+	.string	"\350\017\005]-\235\353\373o\234\207Z\302>\304m\f\tWXmn\037\330\232\364\001\311\264A\374\177\325\tU\265\215\221\006e0`!X\023\347\221\007F,\221\360\323\244\232V\206\266\027\030'_3\351\007/\243M\252\351)\226\304\212\251s5 \204\310\263\260M\204\032R}\n\205\355f\233\b\212F\375\332\217Z\211A\021\205%\202\220F\327\347+\303h\3424\306\204\304\372\260\n3\336\261\005\370\326\212\n\305\245\fQx\210\214\311{\002\3775\035_\022\372\017\013N\317\303Z\313g\201\212\273\007\231"
+	.string	"\207c\311R\203\265\323&RL\312\363|j\007\031z\331\214\231\321\223i\024\366_G\344\231l\266\210\017\201\372\027\266\325:N\301\302Ha\032\027\013f\265JV\001E\253\030Y\277*8)\033^\313\347\204\r\342\344f@\007\344?\246Bb\242@\256\363\272\207\341e9\334\0075\311\006\322i16\330\347A\334\0212]\205\272FQ\374\377H\370\270\263\ry\355\2339\301a\342\224\204\330\260\316\216=\257\017U\226Y\265\267\370l\003\244i\033\272Dl\311\206:\251\252\210.\025\"\023\346\220}\251\333\022\201\350\300\242\250\004@\307`\231\262\023\366\005"
+	.string	"\303<\024\247\267\356K\032\213Rgww\350\314\nJ\313\227/q\006\306`eY\204,S\b*P6\252=\313\227gP\311P\255\310\236m\271\261m\354^O\272\332n\3419`\205e\017\321\371.\3208\342y\320\177\031\211\310$\236\026kn\300epO\200\016\237\2037,\027\254\302\373\361L\367o\354\216s\346\347r\006\224\t4\236\177j>!k\332Q\210\337\341s\224\317\270\263\303\241\251\363\300\347>\2109\003q-\2512L\232\0266\212\247-Wt\004\244\006\266-^\233H\324~\326\027[\364\344\2017\026]\344\212\300c)$\"R\"\216\356\321[g\335\0036\366\254\270^\rKTg"
+	.string	"\025\222\t\007\023\350\202 \351\217l\201e\362\337\026\350<Y\374Kh;\263\256\325\333!A\203\331g\255\fN\177\261\331Z,\332\016_\300\001\"\216g\313\251\331~\251AJ\341\347\245\3101j@\002&c\360\021\3779\013b\317\273\311\377\2601\365\343 m\021\211G\021\243q\b.\265\371\217\331\242\322V\333\317\031\352V%\306\315mU\356*@|\026\253{F*a\351\001\301,7\262\230\241\320\353\350T\206q\213\364\326\"\022\334\276\241\215a,t\244\323\033mN\257bz\002\234\270\255\333\340\270\375\373_\317\024\241\352\271\257^W\004\022\304\327\260\261\b\245ZFWZ#\312\273\377-\241\317\257`\272|\232\276\354\330U\017\202\316\200`_\277U9\371\372\367)\023\006\233>V=\223\340\003$=(H\023vj`\240Iopd\035\204(V~\220<u\n^\267'\350\323J\236"
+	.ascii	"\267\366\326Ec\361uBCz%\2159\035 p\326\265\002T\027gW\3014\251"
+	.ascii	"\214\035\314\243\236\3209\333S\332]\200U\\\304\260\361\320Q\002"
+	.ascii	"U\233\353Cz\325\255\341\221R\207\216\202qi,0\204\202V\245\322"
+	.ascii	"\264\343d\004l\346\205\301\346\023\r\377\265\352K\222\006T\264"
+	.ascii	"?.\330\253\032\224g\231W\302\321)\2047A\023\364%\360\025\351"
+	.ascii	"\303\204\024\253\277\363?\331\013\b\002\002<H\335cj\b\210\002"
+	.ascii	"\227\021\025L\362\247R%\266;\262 \262\3347\233\377\fY5I\310;"
+	.ascii	"\"\343\303\307\231\007\322\350\346\036\356N\302\323\t\227\222"
+	.ascii	";g\351C\rB\007]\305\207\005;n\224\352\335\327z\350\264\037\232"
+	.ascii	"\310\225Y\0053"
+	.string	"\320\306\226\327&\r{\2256f+\3756\345\310b\340\377\377\247H\034\257:\206\3009\337I\212\025\252\202\354=.\022z^AD\025\1771\364GlC\350\264\260\274\032\221\233\216T\200-\365OiR!\247\251\022\025D\376\246`\262%\377\363\373\2431\227\257ka\234\3041\307\332-u"
+	.string	"\311\222\374O\035{\007!\214T`N\231\020BO9\205\004R\343\022\202\017\021j\016hky\225\272g\2617\375\274k\211\314h\r\231\016\302"
+	.string	"\376:\317\267\017\003\202\305\263jA\224\314h\245\245\227\251G=\327\001\006\232\030\310\274W\245\013_\301\223$^\005s\225^kk\030g\r\035sTAlK\374\227\355\240~\357BZ\341\257\326\261\332\375\240TT=1\317\016\006iN u\307\r\351\261pc[\363^C]}h\263\371\375L\255\016\305qe\225\241\222\036\321\256\236\"\300\325\374\303<\251A\243\344\321T\303]\223\217$\177\254\231\212&Y:\230;\345\333"
+	.string	"\212r1$\026\322\240B\327=z\363\236\370\202\006%B\325j9D\205F!\034\250\324\262\352:\344\277\347\357\351l\227.\316\024|\245#m\313\276)\337\271\273\026\006(M\355\331dJw\034\344\255\272q\201<\177r\351\263.\256>\007t\020^\375\343ZX\001\347=\340gn\320\003\346&\203\037w\234'\200\341n\2324\353t\240\272\364\023\032~\243\366\232Rb"
+	.string	"\264\303{\205G\016\350\333?\273\312iZ\006D\304,S6\214\346\371\3464\350p(\"l\313al\233\272Zew}\223q\206\030\267yN\r\304i\262\033\n/M\240=~\037+\360q\351\364\034\0273kM\352\330"
+	.string	"\235\355w!\231+\331i\317.\356\304D\177\022\035)F\240L\263\252\322\177\006zm\240\300\376\024\202@\343\024\236$`\231U.\205\346\312H{\346\266`2\\\037\033-o\213\356\351\300\370\2073\366\016O\214XOya\374\fK\270\024\212d\035\340\260)q<\260(\363\321\347\333\3509\225\270j$\270\247X\215\203\035Y\211\275j\021\356\332\225"
+	.string	"Ont\202rJh\212\251\375\230%\023\355VyZ\2618\317\021\245\364\315\261W\243(\222c\002ofv\375\232\207\222\261\323\256[\302?r\272\324(\274Y\365\251\r\365x\242\002&rs0\307!\265\007\003PB\311O+\347\264\234?\255\337\212\276\326$\347\020\255\001\274\377'\037\037\006\016}\221\\\333M3\324\242\337\320xg\345\332\t\355\332A<w"
+	.string	"\035\257<\202\261\266\331\231\371\2379<;\302\276\013\210{Ar\223{O\213n\024\265\333\252\353\332\020GY^\211iW\321n)\305,\243=\261\275\277\374\f\364N"
+	.string	"\365\203\304?\272\017t\017K\366\002\3643\3069L\357Th;\321\350\330\327\366u\255\271\326\217\360\2060jA\217\367\026\357;\255k1\305:S\367\303:\335xRK?y/\223\215]\257\347\"B&By\316a\235\262<t\321Do\275\332\303\265\335\017I\352\023}\247\3345p\234y\321\365\001\275\326\230\247h]8~k\210]\021W\264m\371\016\346\346_\301zl[\277a\271B\337\350\360)'\0372\367h\330\232\002\334n\237[\ba\344\276\ta\037\007\276-\360\236y\336\265\350\2705?\342\310\2228\376\346\216\215\335\314\037&\302\347@\037\013\360\n\355\272\335~m8\214a\263fv\205\313|\226\035YC~\274\320\025\006\315_\017z\250\355T\363\204\220\256\3229V\313\312\234\321\300S\234\r\217\363\276?\352\016\036^\314\r\252^\333n\331\237\254\t\037?38\246\320\033kk\204\177\001\177"
+	.string	"\324K\234\270\031S_"
+	.ascii	"\356\320\354\026Nq1\321\352\037c{\276\323\333/\330@\253k\272"
+	.ascii	"\177\326W\320\276^\030\221\361L\007u\236\314\277\025\205%\361"
+	.ascii	"\373\004\336\032<\217\315\203\316\314\300\003\267\317\007\372"
+	.ascii	"\317^\272W\231}m\321\265\221\036\322.\351\277\257:{\364\277\241"
+	.ascii	"t\247\343\254\364\306>}^\366I\274qv\335\314_Ac[\336\364Y\263"
+	.ascii	"\316\"\320/\373\3130\330\373\233\311\220\377m\031\272|\220\203"
+	.ascii	"\3077\317\036\370?\332xL\271\365\204X\276\025{\255R\376\241\377"
+	.ascii	"\345\354\313\001\013\250V\355~$\364\trS}\306\352\374 \272\025"
+	.ascii	"\035g\222\216\365\363\031\347\272@\236\323\261W\n<\271d\036\213"
+	.ascii	"\353\370\341\373\356\n"
+	.text
+	.section	.gnu.lto_.symtab.701a6387fbcb8810,"e",@progbits
+	.string	"readBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"processBufferPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\002"
+	.string	""
+	.string	"readBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"globalResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"srxl2ProcessChannelData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"srxl2ProcessControlData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"srxl2RxWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"srxl2ProcessHandshake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"srxl2ProcessPacket"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"srxl2Process"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"srxl2RxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"srxl2RxIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"srxl2TelemetryRequested"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"srxl2InitializeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"srxl2FinalizeFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"srxl2Bind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\003"
+	.string	""
+	.string	"rssiSource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"microsISR"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"setRssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"setRssiDirect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.701a6387fbcb8810,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
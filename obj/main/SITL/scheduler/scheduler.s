@@ -0,0 +1,1101 @@
+	.file	"scheduler.c"
+	.section	.gnu.lto_.profile.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001#"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`V\002\315\r"
+	.string	"\346QE<\020\263\322\001\033\345\007@WF'd\306\330\206\203&\207a\376\362\346\315\204\334\275\325S=\232M\307\252\252\252\252\252\252rUUU\256:V\325\254\252j\265\204\004q\243M$\331;\311\0355"
+	.string	"7"
+	.string	"4"
+	.string	"\025\253\330\005{=\263\034\310\206\367\304\262q5\277\216.\023\212\t\374)\tK\355\350j=\275e\222\232\232\307\255\215'\313\361\317\237\237\257\027F\361\232\230\244I%\002\006\005\004\003 \021\b\367c\243\t\004"
+	.string	"\210\354-\275\035{%\025_\331V\206\347\244D\202\237\366\227\272e\214\177\030\3726P!\241\246\262\231\227N\344\363\337\007?\311R')\035\032\f\013\367\367\247\261\034\013\023\205\266/\030\252\333h2\316\351\203&\341\227\306\002\263C\020?\276~\f\275>t\361\375\372\276x\276\370\033\3217\263\213\221\203\363\017G\032\362my\177\373\366\277\250\231_\236\236<yF5\017d\307A\032\371\264\250 \370\253\025\\\355\241\301\030\227_\313\241\202%\255\225H\303\025Y\001L\250q\301`\310\224\311PX\330\332\001P\002b\252\250<\021"
+	.string	"9h\244\032\2324\205\2351\0133\302-Y\246X\243\035\031,\307\343q\237!\344ld\003\251\034\360\334~\200\377(\376\247\333\335a\034"
+	.ascii	"'\337\363\035\t\375i\256=J0\005\240OL=8\331G\020\022\324,\r\302"
+	.ascii	"H\\j\325ZP\241\364|e9en\330\r\n\n\260\327TbF\257\323\323)Q{\342"
+	.ascii	"\252\f9E\227\271\265(\262\245\267m\0169d1\256\263\304$\367{\023"
+	.ascii	",\272o\004\311Y\020\017\202\260\243\374\371\317\263\244BE\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375 \334\245\003"
+	.string	"R\204\r\027\260\2511\f\3030\f\3030\330\222,\032Y\204A\266\206\241\275\245L)\352\356J\321B\373\274ss2\277\254l\311\036\306Y\234\304o\203\260\301\001\273k\225\275\210S\032"
+	.ascii	"\\ cfF\350\205qs\020\004\006\246\251\234kY?a\255\017\203\321"
+	.ascii	"\244\326\352Z\227E\234\005`\244bo\315aRvp\006\200\305,d\250\f"
+	.ascii	"\226y\217\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\027\005\275\024"
+	.string	"\026\234bE\360\222(\215\001\330\317\213\306\003\340\264/s\226\352r\330\2660\024\321C\203\032\031\207\332q\270g\271\207\027\342\203\231\bBr\274\261M\f\301\013=#\024#u\214\224w\215\207\257\rM\211\370\215$\002\273m)e\nE"
+	.string	"S"
+	.string	"R"
+	.string	"'\247\215D4\244\022\254U\200\177R\0201\026\214;\351\210\030\013\266=\362\371\357\357y\0174\025c\034\231\363\353g\307\371uY\227}L\333\372&\351\272\2264\2264\306\030\337\376&\232\347\331\251+\306\b?\300p\013%E\211\360\341\002\2361;\033)\016\325\214KW\271\364&\304\030Q\01753&A\272\222\r HY\362\023&?\272\362\203\322\001\374(\313\260\365\262i\225\334!\001\343@\003\005F\020\027\036\240\267\\\224z+i{\024\3711$[n\334\254@\301\340\255\253=\353\337Y\324\352*F\n\333(/\343B\234\312\0317Z\351Y\350\214\2444Bv\204x\207"
+	.string	"|$\314a\361\262iu\036`r\001u\253#F\f&51\026l\301\236\266D\214UC\301\002:\355M\234i=\237tJ~m]$\036Q*\347~Sn./J\235\"C??\360\345\005\370\020\266\306\302\213 *\243\277\021\364C\216\026-\251b\004\273\036X\270\260Ck\tM\250f`\264\rd\244}\351\360\272\3218&\265a\363\342\201\344\002\177i\t\274\321\236\210y\271\336\315\252h2"
+	.string	"\221\311\227\"\306\206\031\333)\001y\250!A\306\b\t\221\244I\2410\034\220\002\231\231\241\353\022 \345-\245\2442\016\311\004\"\301\204\311HARI\007t\236\350\025\310.~\300<\357\270\314\307m\030\\\211}1\316W\214\373\316\311\2250-\251\250\004`6\340\031\260\"\246\316g7\310\337\031Z\247\206\375r:fi9\266"
+	.ascii	",\263\035G\312\367\242\305\027\020 \317\200\215\371G\2160\201"
+	.ascii	"\226\371B\256\271t\3206\240\f\233\027\177\016F\023\216\325\245"
+	.ascii	"M]\247\354h\372L}\256\3434\032\276\201\202\215N\367oP\035\320"
+	.ascii	"M\245\"\206\323\356\3023\301TxB\212\001\375k\366\336\302\272"
+	.ascii	"\361l\001X\033\013\202\366\222\357\357#,]\022\321\037\275\327"
+	.ascii	"}%\263\234\245\"\177\253\346D\026\370\230\021\220b(\230\267\305"
+	.ascii	"\222\0329\266T\3343\261B\007\214\344\260\0205;\325\374\026\276"
+	.ascii	"g\274\241r*G\347\330\237\013\373G*d\002?z\234O,\251\027\016\026"
+	.ascii	"\330\205q\204\021^\024\2257\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`d\001\245\007"
+	.string	"\242\312\")\200+H:\235\0045#\214\3751q\220\013\200+\205$\250\024\020\304 L"
+	.string	"\246R\303m\032Hl\253\243\233\255\311'M\312\024;\367%\347 \330C\007\227\250\260x\002\351;/\207\256\006\306\260\026\276/%\246\360\322Zk\274T&AAH\f\032._\360\004\177e\275\325[\310\016\004P\264\326\024jL~\220\034\344\006\3133\272\022h2D\210{\250>#\330\343\243\310G\225c4E3E\374\240\210z\200O\253L\017!o\356E+ `\"b\314\352\306\r\216\\{\302i\262p\b\003k\303\267\f7G\357\322\355nC\364v\002\030\0218\201_&0l\266\273\246Z\373$\\n\263 -P8\3256q\005{\0246\370\360\331\026\217\313\261\b\314\271"
+	.ascii	"\341>\032\310\231\336|\\W[ \207\353\343\036\326\020+l(\025V\270"
+	.ascii	"}K\364\324=\305\035\002"
+	.text
+	.section	.gnu.lto_.pureconst.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375 G\345\001"
+	.string	"r\004\016\025\220-te4\377\377\177\252\177\032\020\235&\260\236\036A\220\263\003\227\232\323\224ft\241\371|9\263\271\314]n2\221yL\343+&\361\r[\302\f\356\023\270\246\230Y\025"
+	.text
+	.section	.gnu.lto_.ipa_modref.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\027\002E\n"
+	.string	"\222M(*\200\267\031\016\006C%\022\023\177\021\325\204ij\211\201!\023!\257u\267\276\375\375\016k\275\321=\204\213\210\206\201OM\204H\231\002S\023\365\200L\316\324\00321\267\261\314\312LG\035\307\214\304\333-\244\247\374Y\361PgS\242!v\333;WI\243|\216\222\311w5ca\262rdhE \370&\371\323f\007)M\244\b\363\361\361\271\347|\261\312\006\036H\345RiP\026\224\003\237\320\233\340\304\201\002\234\220)\001\277\242NE"
+	.ascii	"\205gT\0361kY\345P\023a\177\266rV>[\276&\370>\004N\250!U\245"
+	.ascii	"\256\0264\225\345P\202A\250\254n\021p-R\026\315\202\242\202\032"
+	.ascii	"\326\356\n\356\364\001\2723gHP\032i8\345u\b\037\031\037\013\321"
+	.ascii	"\206G\244\217\206,\365\335\277\241\250!\203\302\214\370u\003"
+	.ascii	"\004\256\005\032\221\031z\264OV]\366\353&\332\311\314\274\237"
+	.ascii	"\300\371\213\300 F\362P~\304\313\002\\\375P[/\2116\315K\223\215"
+	.ascii	"\207\032*\206_\330\315\264\020\215]\203\301\252\024K\"\330\243"
+	.ascii	"3\tM\216\226\237\314s\234\253\230\"\213v\235\003\247\326\340"
+	.ascii	"\347\242\002\377f\337\013\242\232;\361\302\252\307\270.X\372"
+	.text
+	.section	.gnu.lto_.lto.7763efdc9f87246c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_queueClear.25.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"%\b"
+	.string	"rO77@o\323\001XP\226\344\331`\244;\371\0060\202\210H\350\300\201\b\020\321!\244\277\"\r\231\f?\036\n\376o\312\217\242@\303\230\263@\026\230k1>`\273\377\226)\005\246:W\305\360I\250\024(\317tX@h\230\324\345\231\035\002[\017\3255#,\353\232\233n\257Y\030:\350\3706X\341Yq\3043q\356\223\236b\026\177d\b\227\\\222\217\361\303#\221\331\364d\251\367\270]$\3477y\207\t\210v\267s\376\311Q>\376\350\321\022\230\236{\3641\371hOP\3509\253\267\361Y@\315\3564\205 \3665\013Cv\224\034/\003-\273\031\247\231\375\342\212\210\355o\234\3311\357D{\022\306\205\212iw'\fyv\315\374\227<\200\003iW"
+	.string	"\203\335\265r \215\033\336v\201\355i\033&\016"
+	.ascii	"i\3317c\032\376\206\213\246\025p\0070\013*3\244\332B\\9\343\302"
+	.ascii	"H\026,~\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_queueContains.26.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\211\001\325\017"
+	.string	"\246\036kE\360\262&\0350\343gHs\264\201'6\333\344\212\237\031%N\241\345\233\271~\025|n\346.7\341\375\213\357\257\021\265\227\037\255Hrzkl\006\236\021\332\245\031\234+\024\027f(\352\367w\367>\304\222\275\245L)X"
+	.string	"Q"
+	.string	"Y"
+	.string	"\037\200=f\017\200=2(\255\274\275C1s\0235\035b\b\331\3554=a\001\207\335\035s;\026\241\346\346\267\034\033\341`d8V\306\034\232C\bA\247E\212\021\356\005*\3177D\342`R\357z\336\360a\365\350\341h\236#\223\335u\306p\037\356\321mo\266\035\330\377\002\367v~\314ix\357VMg\246\237\225VH\020\002?\2733\257\"\273#\002\255\270w\373\235\3572\311\207q\236\325=\013e-\036\262\317\013\001dwI\036]\312\036\r\300\333+\233d;\323\276\213\353\254\276\303r"
+	.string	"\273-\035\033\273\235\002/\310\036\335\005\016\302\036S\013\024\325\270\344\353pw7&\270\352H\317\002\304\020\f\tV\276\222\306\210\026\016\2506\306\364\232\362\212^\222\210ms\370\f\226lw\037\3702\376\251|\234G\253\254\344c\036\375\025\275\353\br|\206"
+	.string	"\271\344K\211~\360\364\250\332\330]K6\340\221\343\306\332\262\003(TZP\235\244@\233JR\247\013*\024N\025L*-\003\352\004\203fJ\251\264\222\003F\321pJi)(()\215\324\355\265\345\277\270\004\242\022\337O\3647\354\256O \022\361\375\350\277a\020\252M\\\224\245\002S\033\223n\340H\325G\222\\U\306\266F\320\361\236\327\260\220\217\343\r\016\n\036"
+	.ascii	"i\355\233\202\341\257j\356\2500\221F\214j1\204q\2776\244\002"
+	.ascii	"V\bmK\n\302\033\023\305\363\202\302<\n\232h\211O\314\212\242"
+	.ascii	"\013).281V5\334s1\316](\021\252P\256\251\363\236m\237Z\332T\257"
+	.ascii	"\275\204\371\004"
+	.text
+	.section	.gnu.lto_queueAdd.27.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\232\005\265\""
+	.string	"\346\275\330I\200\030R:{@\275\b\224\371\020\206\243C\202\244|\331\3627-`[\220d\250\f\270\375\225@\207DX\305\035\336\340\231\261-|Tj\275\333\207\204\212\374\232\351\316\350k\310y?A\340\345\244o\252\324>\233\221F\b\221;\311\304"
+	.string	"\270"
+	.string	"\310"
+	.ascii	"g\021\363z\3242\0331\257\314l-\363\223\3272\372\026\360\276{"
+	.ascii	"\217YM\356U6`\007\352QV~@zT}\200\364\350\003\bF|t%\025\323\247"
+	.ascii	"\252\224\276\334\356U\376\332\207\215\r\312\001~*\317k\037}\267"
+	.ascii	"\352r*\216\227\242g\367\354\021\037\351;\265\246bS\311\256:="
+	.ascii	"\236\244\256\353 \205%Y\206\307S\3619\034\352y\241\314\006\323"
+	.ascii	"\325\232\240Nk\305&\346\315(\213{\222\324y9\322\236\3230hQ\254"
+	.ascii	"\032?O\013ZY?zN\302\263\273\226gg\336\302p\032\332Vk\274w.0N"
+	.ascii	"\241q\265&\3439\340\312\224\227s]gHS\321Z\034\206{/[\242\323"
+	.ascii	"\323\031\300\231\337\200\231%0\243\013\002\177\0045\264\252^"
+	.ascii	"\037\331,}\213\360\252\"\264f\230\277\344L\330\214\017\204\205"
+	.ascii	"\270\314\236\310e\351\321\367\271n\263\226\256\214ZP"
+	.string	"I\366\215Y\031\264\215$K\203\374\342>2\201\034\034k\371\306\346ag\337\267\376\032\266\314\273\330ywZ^q\226u\247\345\034\316\262\232Z\306\245\226\323\3232\212Z>Q\313m-\333\323\362\013\364v\030\213SV\275Ey\231\336\316\3344\224L\310\303~\261[f%\277\311\253\021\002\034n\311,\260\207\361\231\274~\031=\311\227\\t%{X\2722&\357\275O\302\377\342w\335\253\350J\330\354\200Py\235,D5I\272\335{w\2162\004\365\350\201\375/\303!A\373\306h\247}\24549\375F;M#56\274\302!\003s#wv\267\335\362\232\"\264f\250\2008\373fl[\354s\264\037\365^a\004\276\024\027%\272;\2141\310V\222}\273\325\nVQR\017L-\211G9\263\375\346-\222\2454\313|q\205\304%\230\361\202\310\353#\177\371\fk:\226c\350\313~\3467\254\025\227c\375\243\224\200"
+	.string	"\267.Hd\326\332\254\322F\362Zu\342t\267\365v\356k\030\276~_\313y\357\275(\203\373\032\247O$\352lh\f2s\034\241\234\215\274\351\232\036\362b\373\360'@\365\336;\201\357\344d@| G\371DPPz\364\246\221\304\360b\324\"\353\265.]b\335H\016@@\366\004Q\017\213\223}x\206~P\264\030\361c\302\207\350\227\002\250'\350\3473D\364\343\321a!\025?C?\026BBC?V&\275\217l\355\313\322\3467\254%\227c\271\233\375\\\327\260\026d9\266\276\354<^3\206\244\016\202\355\216\350l\272\333x;\337\355\254\b\255\231[3f\023j\335\265M\277\371\035\2543\257-`\026\253H\227\f\235\272k>q\273\316Y\333\313\211c\336kS\220\26224\326t\033\320"
+	.ascii	"[\016\211\212\221\242\317\342Zm]3\207\350\261'r\205"
+	.string	"\035\303Fb\276\226\0257\\P<\013P\001\025\026]\333/\f\236\323\271>\321\f\215\301\253\255\340\241\"23\207_\001^\340r4Mm4\013\321\206zFK\323\306\005s\250q4\344\bsHfF$\020\221\304\031\016p\002\021*\263n\021\2601dFR\220\333\001h\370\351\204\310\361\353\276\305\216\350\021e\227\035<</\344!\336\021?\221\216Nz\3267B$\2324\025(G\307F%\243q\317S 7\333\337h|B\022H\254^\343q\311\f\256\220y@\363\357%\372\202\262,\252\021\312\274W[4z\211\264h\210\377\n\t\353\315\312b\2108?\341%:\242\363RE0\032.C\326\001\024\335_\327\371;\266\230L5\373\263\021;0\315\351\n2\327Dd\365N\305\226X\242\315-\001\331)\016@|\2203T\0233\207l\r4k\223n\2227\262\317\215\327\001m1\033\322\271\351\245\372\247\274\345{"
+	.string	"\212'\252;G\3429"
+	.string	"\240"
+	.ascii	"8\311e]\332\337!l5.\002\266R\233pO\232\236~R\206\255\361\373"
+	.ascii	"Ep\241\006"
+	.text
+	.section	.gnu.lto_queueRemove.28.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\311\002\035\026"
+	.string	"\246\252\222J\260\324Q:XS\024\251\243E\362\210\256(\332\\6\025=5\\\317\376S_#\213\333\211\273\303T\242\334{\242\365\257\277\037\006\207\242r\340\201\373\017\372\017:\227\032\003\256\241\307\220\350\235\344\234Br\306Us\030id\023\271S\n}"
+	.string	"w"
+	.string	"\177"
+	.string	"5\233\264=\247}\023g\252\275\211\366W\255\274%\251ZK\027\033\030O]^E<\035\017@<="
+	.ascii	"S\263\355\345Q\320\213\200?)\212\324Z\302\266\203S\036\226\267"
+	.ascii	"8mg\2114\334i\363og\235\354~\200v\270)*\t\235R%\037E9\200\273"
+	.ascii	"\f\017C\031&\022\036Nv\025\302u\372\301 w>s\357\373\234\302\201"
+	.ascii	"\313\001\334\t}\262fj\255\236\272\035\206{\274\355 \333\t\354"
+	.ascii	"I$*\376\213\371I\247\2460\233\327\235\372\263]\2620\202\210\351"
+	.ascii	"E\317\274Z\253\036N\300]#\273\274M\0045\252\220\274<\373\365"
+	.ascii	"\246\037\305\323&\256\235&w\272\344\275\273E\247G:\315\332i1"
+	.ascii	"\234\246\341t\270\323\273\323sN?%\246,\022deF\255AWH*\r\372\002"
+	.ascii	"\304{\267_\372>\223>\212;\325\336sp\274]\030\177\275' \265V\226"
+	.ascii	"S\303\214\247\003\302\333\001\017:\350'\031\202\251L\245\023"
+	.ascii	"\362\362\271%\273r\204\234tY;\256\215\2433\257s\f\207\334\336"
+	.ascii	"\354O\361\004\320\221s)Z\201\243\250q\347\017\337\005\217\313"
+	.ascii	"Q\255\365:\333\262?\321dt\234\266`-\r\352\204Z\336ZqY7rD\343"
+	.ascii	"]%\206K\367?r\"p\363\312\273\341\376'Ik\347\356\212I6\020\311"
+	.ascii	"\205\300\t\200\032\032\022\256\221Q\366+\353\355\360\231Fl\373"
+	.ascii	"\301W\320\306Z\253\002?77\023gF\263\023\272\346Ef\223\303\343"
+	.ascii	"\300&B\315\f&\341\206F\007V#\233\301^\b86\301F\006\333\211\305"
+	.ascii	"d0\262\254_\236\177\342\f\254\252~Q\242o\023\357{\003\253\030"
+	.ascii	"\277\250\360\267\211&&\353\231\236\305}`\255\221I$\372\332\345"
+	.ascii	"1Y\356\262]K\356\002\031>\323\210a\220\273\262CC\317\274zXk\255"
+	.ascii	"b\313]\373\332\373\256\022\234,\206x1h\270\256m-\320m\224\200"
+	.ascii	"Zr\347\002\331%\353S\0052 `\202!\346\214\007i\373\246\032\376"
+	.ascii	"\332\334\2310\246\241\305*\322\301\025\2273#Vd\"^}lL\375&\221"
+	.ascii	"E.\360f\261m^\221\312q6\201l\342\222\320B6\260a-\026\260\300"
+	.ascii	"&w\b;\216Y\177\242\363\206\267\024\275\002)\353\200\222\374n"
+	.ascii	"\353\023X\024\200\3268+e+'b,\016\356\267\214\312\033\265@V\035"
+	.ascii	"\2679[\254O\320B\210@<\367j\361\023"
+	.text
+	.section	.gnu.lto_queueFirst.29.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\005\b"
+	.string	"\002\21767Po\322\001 \352y=/\314\234^\031\037\303\374T08\371\350EP\275:P\335\032\312\367\270QD8\315H\360\252\252\032m\320\366\337\n&f\257F\020B6\221;\245\3264\335\346\300Y\330\030\264\215\204hPx\220Z\267\221\032\002s\021['%8\256\223\230\271\267VK\252\003 \r\035|\304\313v\027\301\017\271\b\3077=z\242\323Q\214\344\302q2\270\017\362i\023\337d\n\243\340\277G\337\250\3531\222ZT)\020\\\331\363\003\025\303\276\265Z\262\r\255\026\206\242\"p\262k\261z\331\224x\332\260\355\2611~\307=<\366\002\246\306\b\013\261T\220\250v\247\364<\300\365\230=s=j\306\275C\317\377\307\255\324\305\312'\372\034b\t\273k\370\211F\267\336v\201mi\273$\r"
+	.ascii	"i\331'c\232\372\f\267\254\224\030\333I\363N\214\025 e\213k\342"
+	.ascii	"n\004\326Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_queueNext.30.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\335\b"
+	.string	"\226\020<6@\217\322\001\320\023\345\017\237\366\271\366\206\240:\230\330\2144h\003\301\033hJc\266!J\353Gi<f\266yQ\024U\037sj-.SyC\235n\204\333J\231R*"
+	.string	","
+	.string	","
+	.string	"\030\252\227\335\b\035/\200\375i\036\200\375\251\307\271'\347\177\344\031\027\216\225\3164zf\013\273\353\354L\247[o\033\3016\264\035\023/;\216R;\354gVQ\266\323/\323\231\351c\231K\245"
+	.string	"e7\343\005\263)o\005b[do\374\220\213\210\314\r\304\217SVr\005\251?\203B!\354\357)\300*\265D[]\013)_N\3705\365\027\033\245\223<\272\345\247\\aV\276\373\363\315\302\376\256\004,\032\244\f\3268[\007\002\324\320q\320>P\342\201!\002j\333\007r\016\354\231\350l\220\302\343\331\340&\356\025\365\324\200\244%\213\237p\232\335U\360M\256\372\370\001\017"
+	.ascii	"i\331'c1\345\315hE\371\263\320\234\220\034(C`1K\211\255Q\214"
+	.ascii	"\2700\316\016#Z\260L\\+&a\222\001"
+	.text
+	.section	.gnu.lto_taskSystemLoad.31.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"M\013"
+	.string	"&\024KB \2138\035\270cp\244@x\032\240RC\251^`\222V\320\242\201\244W#\001i\303\t\322\221\031B\274\230\001\031k\332 \347\240\203\023\300\271\206\237"
+	.string	"=\300>\332S|\003\f\201\317\246=\2046\331;\2456"
+	.string	"6"
+	.string	":"
+	.string	"\336p2\301\336\264\npR\355\256F\021\\\274E\247\350c\226\f4rn\0258\225\030?\026ew\377\340S\300\350\231\023\263\354\256'h$p\327\333\336\260\235a_#\007\354[\273\273\246\"{N\037\203\030a\260(w\007\254:,\252^X0\261\375i\277\301\035\210/\001p\266\033*Y\330%/\214\361\360J9\305\365j}\342z\265\350\257X\206\n\243\224U\202\030\203R\225\272\351\247,T\216Rsw9\324\341u\nb\322\360\231\034\354Cx\204\320W\340\222\315<\350\325\337\\\257\247YH\002\311@g\256l\2223i\240\007\327]:4\030\356\373\302-\302[\345\343F\302\020Nd\0035\314\345\243\323\266\017\324*\025\366H\270O\323x\336\247M\310\275\265Td\016\022\252C=\366\273\313\237p\n\235\227\311\\\001\030"
+	.string	"i\3317c\232\215\032\006,\200m\n\313$\303N\230\020"
+	.ascii	"\320\201\313\200\316\003C8\020\210\255\270\006\252!\342B\030"
+	.ascii	"\002$\230w\t\200XM\001\356\0220`Q\345\266\253\350\001"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.36.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`A\001u\f"
+	.string	"\306\226QA\020Q\234\016\013\212\234\240\006@\331\267x\304H\252\276\343\331\344*\013\242\312\243\335\256\021\321\004\350\251Y\304^\302\3257\305,\350\f\204\004"
+	.string	""
+	.string	"\326R'\244\235\303\211@"
+	.string	"\002H\340\017\242H\233H\231R<"
+	.string	";"
+	.string	"@"
+	.string	"\001vG/>vC\003>p=:\274\305z\274.\300z\364g\317xH\332\237@h8\325\330]L?\374{~\376I|\002\212>O\016\006\273\353\004E\034n\275m\002\266\027\330\007\t:A\271 \351"
+	.string	"\312\022;\374\244z\260_\355\356ZG\366=\376+\323V\246c\246\253Lk\2463\323\257"
+	.string	"\240\021\243\300\310\356\206\022\033+\022Q!(\266\237\366E|\304w\017\317\003\316\274Ed\001\246\342\rb\251V\372\f7B*4\252\tL!$\251\366\346)Pp\251\223TH\307\325\266\360\223w\355\256\002\377\304\306\261\220J\0360\365\0227\341\371%c\350\344\301G\277c=>\234\204\315A\266y\r4\231\206\311*\316.\235F\301\213\240a2\016\266e l\260\254\343`\227\001\346*h\035v\201\343:\214\022\356\253\325\221\037\214\210\2004dKm\355\250J\306W<\252\3651!*\002\023\214\216J\035\036"
+	.ascii	"i\331'cz\200\032\206\263*\320\006\005\f\002\026\320.\300\002"
+	.ascii	"\255\221\202\2106\260\007\216\001!\300\024\270,\b\036\200;\270"
+	.ascii	"\354\210\201\232\270\2335&\300nP\206YT{\r\020\\lhVS\300]^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_getTaskInfo.37.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\200\006%!"
+	.string	"v{\320Ep\336M:s\300\006=(\244\0338\214\357\035t|\210\373\026\003\251\221\311\240\253\211\312\025z\346\2335?\031\350+t\345\304\240\270:\320\234\241\216\bBK\252\216$^\327\237!\246\033\235\331\302\017b\t!R\312\024\264"
+	.string	"\256"
+	.string	"\305"
+	.string	"[\266^\216\265[\016!H\222#Yj\255[\3665\373y\254\345r\265\244\254a\375E \022&\213\202%/\341X\377\271\344\236\377y\270Z\322\035\243\261"
+	.ascii	"j\355js`.\371\241\271\374o\226\rKW\254\306\203jU\022\026\246"
+	.ascii	"\326\341\20230\227L\332\001\345\222\343\006(\227|\372\277\355"
+	.ascii	"0X\267L\fG\331\236Z\353\256\227\\\300\216\303=\311\351\226\344"
+	.ascii	"\330\234~\311\226\201odl\304\237\215-\211~Z[\277\036\223Q\270"
+	.ascii	"v\034#\204]aB\364\313\032{\314\314\314\371\323\342\336\263e1"
+	.ascii	"_zl\304\037\327rNB\255\365\354\373\001\367\271\375\177\343?\205"
+	.ascii	"\277|\022g\306\366\272Qo[\221\315\311b>/\261df\230\337\264\035"
+	.ascii	"C\302\004\024\257\017\252\\\322\250\367lwG\333\021#i\275Vg\214"
+	.ascii	"\330\355\36503\214\212\276\377'\026\rm*\326Z\037|Y0Q\337\257"
+	.ascii	"%\257B\212\327'U.\271-\343\313\314\027\204\307\201\376a\217\333"
+	.ascii	"\353_\2477j\232\274\273~!~\022\311G:\032\371F;\266\013`\211\373"
+	.ascii	"\242\025\333%\n\342\353H\376\220\311?M\276\220\311\0172\371\246"
+	.ascii	"\311\317\231\3742\307's\374\261\3447\311\347\221\277\007\370"
+	.ascii	"\355\214\227\260\331\206\325G ?\325\r\231\006e\211\273\377~\273"
+	.ascii	",\361{\266fi\177\212e\367\244\3021\r[=\251\260)\017\272\204\247"
+	.ascii	"l\035\220\215\354\177\302\302U\261\251\260w\252\230\202\265V"
+	.ascii	";h\202\340\033\331\347\230\234\270\261\177\013\333VU\206a\351"
+	.ascii	"T-\315A\021\024\307>\201r\272\377\f+gC\036\016\013\247\303\256"
+	.ascii	"Xk\326\032\252T|\323}\302\305\001\343\376=\254\233\247v\363\301"
+	.ascii	"\375\303\266y\332\005\331\240J\3015\334\347\0338qbI\375\203\330"
+	.ascii	"4Sf\255\325\351\213fD\b\242/\032d\253\004\204\323c#\3029)\333"
+	.ascii	"\353g\223\361\250\233\016+\330\242\336B\352\242\256\260\346["
+	.ascii	"f\315\\\355\373u\021's2\345\222Hm`\316\020\336Xk\255\344\322"
+	.ascii	"\026\365Q/\025\"f\264\216\364\274\030\351\nRRL\225\302\205\211"
+	.ascii	"\"\303\324\025\024\214\362(\223U\024\213\030(\242V\240W;\027"
+	.ascii	"RP-v\250\325\325\216\351\300\251^DY\355`PQY\355\316!o\273\353"
+	.ascii	"\353e/\254!1C#\277S\345\236\255\206\265\"fh\275;U&\365\326\377"
+	.ascii	"o\300\342\206\327\275\353\226\260\220\243\345a\302\\Gs\300@\320"
+	.ascii	"\035\377\320\265\016\316m\310\t\377\236\372\317\023\366\361\324"
+	.ascii	"\024\344\036\350R\220y\f\265\216\347\006vB\341\255\336\n\365"
+	.ascii	"\331\004\242\260\216T\330\224\003]\302!\324:`[\\\320\024"
+	.string	"\276\021\307\007\267W+\315\016\352\002nZ\200zU\230\227\n\235\330\006\312\304\325l]Z\033X\316\312\002R\003[?\251\260A\261\017\272\240\310'\327:)lqbe\007v\25018\244\230\203\212FDf\n\223Jc\360\002\021\241Z\035\021\0209g\224\262I\226\331\264\006\3126\323\364\277\343\2424T\205\320\231H\035\200|\027\272\341|BR\302\234\013\351\017\370P\013$\001S\r:\314\352\274\230\216\316\003\277\267\343\001x\3175\325FiP\205\236&q12\237\351\031\007\025Ft}b\007\207=\b\315E\330\301\212\037\333\202\265\313\n\364JQl\343\326\374\333#Gs\377\002\245z\206\3439\224\333\332\220\206.H\241\016d!\244\355]\314\203\025oN\315\307\214X\r\215\264\226\332`\260C\320XQ\320\237\233\222AH\360\347o\216J\003V>\234\223\021\3779$\234l~\027Nm@\032=\0225!o7\213"
+	.ascii	"v\365\342A\020 \235\022u\264\363i\030\357\366\231U\3525\303?"
+	.text
+	.section	.gnu.lto_rescheduleTask.38.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\217\001\365\017"
+	.string	"\006\336kH\340\320(\035:\037o\252\374O\243w9@\327K\350'\265\037X*\320F\b?c\222I+a\266Z\032\302\313^\273\316D\214:V6-PK`\030\215\320\r\023\346\245|E_F\250\307\023\255\204\267\177#{\223\275S\nU"
+	.string	"P"
+	.string	"["
+	.string	"\247\036\357\250\247\334\005\324S\243l\237\2175\373\030\214\226X\320\356z\223\346\250W\312M\211\362;\020\021\253\225z}9\345h\261p\036\273\233Ar\241\227O\356\200\313E\007\216\326\212\353\230\201\220q\234\313\r-\225\224\035\310\356Z\262Z.ww\333\240m\021\373<\001\353)cO\351\356\260\273~\374\351o\376\213F\265\031\351\304.\207\233\215\225\321\036\021\207\335\376\313\217\301\314\342\353\262\327`\213\341S\333]\004\247\016\361s\354\321\351G\266\345x\201\306 t\352K\373%n\002\365\033\025\213vcP\354\354\216\t\254 \024\324%\241<\313B=}\316\357\242y\370x\235\335\374\230\301\362\243\2227\323Y\347c\017ia\003\324rcE\336jl\265\035\032\240"
+	.string	"\314\210\327\213\225\264I\236\032\263\017\\\225t\332()\362,s3u\033\226K6\347\214\007\\\245~\022\200\241y\321V\322f\217)9g\354s\273\033\021 \310S(\226@\007\246\020\024\277\007)\237\t"
+	.string	"\223\b\311i\344\244\272D\022?\n(\246oB\351\344\231\200#%^I<y$\003\016+|\242w\022\206\2427\032\367\334N\031\037\347!\035\032\262\225\251\252\335\264\277\257\2200{\200H\354\356\002\333\030\256\002\024\305\374\004\355n\203\024\327!\361C<\037"
+	.ascii	"i\3317c:\233lD\336b\325\366n1\355\330l\205\241;\025je\200\037"
+	.ascii	"\244\020B\343@\n\241\256\016mI\f\313\232\013n\235\255\325\026"
+	.ascii	"V\341\231\324u\252 4(\004\227\025\250\321\302]Rt\300\"\224[\271"
+	.ascii	"\021\fGcP{"
+	.text
+	.section	.gnu.lto_setTaskEnabled.39.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"\335\013"
+	.string	"f\327Q?0O\224\016\307`\317\313w\324e%xB\034\215\020Q\270\024\210\367\223\300\226\303\333^\244\254\355c[\005m\271\252\316\335f\355.\245\266\034\fg\022\352\314B\255\316H\265{\264O6\331R\246\024="
+	.string	"A"
+	.string	"="
+	.string	"\360\002\342-o6\213{ \366\037!\334\207\213\335\305\364\303\267C\315\315\277,\022TG:\214\244\256\036O\f\335\tRv\367\035\317\013\235)\363\262\354\256\023\325i\270\255\333\276\330f`\277A\351\314\3643"
+	.string	"l@\201\235\330\315\360\275\330\225\005\242a\373\366=\354\311'\2665\355\004\n\266{\242\002o\261\3320\261 r\313O\373\033\027\261\235cd\311n\007\022%v\275\003F\020\271E9\201x+\311\305(\345\356\256Z\024U3#T\2342\304\251WU]\301\245\002\244B\030\\\210\001\037E\250\327\007\032)8\020S~\266GJ\365`_\277\357\373\254*\373\336\177i:\236\343\207\231\326\f\233\214\223\301t\262ks\221\360\301\200\2425\025-\343\2046\031\004\315\007\353D\300L\3004\332\007\253\030\260\207B\246a \217G\303&\336^Uv\300aUR\023\2041\243B\265C\025\362(\277\343\026\013J\362\245Q\035\024"
+	.ascii	"i\3317\323\342\235!\013\216\002w\300\330T\265\f\016\241X\221"
+	.ascii	"`\226\301\2723\245\240\031\330p\215!\205\273\005\252i\340\004"
+	.ascii	"\001\003\0365\262?\2242"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.40.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`X\001\305\016"
+	.string	"\266\032bF\360\320&\035P]%<XI1\034f\300\313\275\251\177^\233\371\315\341\347\227\355\216\306\374\2500wzi\007!\311Ep5\022\013_\206\254UxX\034\006\317\274\\p \231\304 \302\262i\030\r\255%{o\271S\nM"
+	.string	"J"
+	.string	"Q"
+	.string	">=v7\013\371\200y\031\037`^*\316\271O\031\025r>\314'\005\236\032\322\324Y\210!\273[\352*\300\030\201\307\305\252\363p\215\b\\]\013S\247\212\037%v\214x\317\341L'\003!V\262\273\206\253\216\303\215\335\266\002\333#\366w\002458Z9T\220\310f\301@\275\261\037Wm<\r-\357\375jh\250\320\307L\336\r\222\327\256\206W\321\332\2201vl\277\330%\333\020\336s1i7\204\214\027\273,\003>0\272\264\355\2378\212\027s\221\225\323a8\031.\004(N\321\264y)\025\373X\fyw\345\374\230\220"
+	.string	"@j\204Z3T\220H;\300\300\300#B\370\0177\342\373L\330F\273{\235\226y9\225\344=\305[-\276\216WX\340W\227>\313\274\274b$\200\206hb\340\313B\"\276\r\2527\026p\227\251\032'\tP6\023\225\351\223H\n\325`\345\004\265\340\264e\016\030\230\244d\247\324\226\211\024\260\366"
+	.string	"\225\312T4-\225\225X\373\270j\343\203\370hD\237\233/\372<)\365='\351\370>\350T\2503\352\222\030\225\231@\034H\220-\341+6\002A\273K\242\342\256\037"
+	.ascii	"i\355C\3024\200f\317am\261m\3378\212\300q\311\r\323ch\0308\017"
+	.ascii	"^\201\273z\020\016\267h!I\213%\241\214\243\250\366\216\312\021"
+	.ascii	"X\224\267\t\3115\234k\002\273j\274\233\tW\374d\023\341r\340\234"
+	.ascii	"P&\254\264\217FPP"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.41.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"RO87@o\323\001xY\306\213\223\224A\332"
+	.string	"\371\351\342\033\006bY\302\320\3456\325\177\215\3671K\2014\302\352\232\035\357\013JF\004n\2328\260\302\243\351\336\f\246\255\355\235RV\215\310<\225^[\275\266\271AP\324\351\261\266\211}(6i\201iG\263\260\217\2045A\253\264\270f\205\244Z\225\035\003g\027\226&\267,\323$\347\333S\033K\017-\247Q\3140\214\276\311\277\220?b\f\020|\367\312\007\001\274\332\250\254\314t\214`\215\375\211`\364\260Om,\331\367~H\r\230\\\030Xv7jh\366T\245\220\330>\3076\204\266\302\002w/D\360\230\027\317\264\373!8!\340\2259\033\346\037\310\036%D\343Dfwe\3748w\310\371/\271@G\022\035n\032v\327\260#q\334\361\266\017l;\330\026\t\t"
+	.ascii	"i\3317c\372\365\206i0\255\2700\206\007\233Kj2\270\313\213v\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.42.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`j\0015\016"
+	.string	"vY^E"
+	.string	"\221(\035\360\246\362m\342\360\377\221\002\311-\377c\337\3214\035\320\003r\342}fZ%N\300\320\231\373@\365TE\b\nboT\tn\271\t\364\256\365]\353\226w\200\325\252y\347\216\336i\302~\333{o\231RH"
+	.string	"E"
+	.string	"M"
+	.string	"\267\231\321\300\212\355\356\006K\234\364)#T\222\377\232{\274\257\364\331y\271\004\3712D\221\335\325>\f\032?\276\227\303\230\340$\343\003\310g\212!0\0226^s\335\360\271\250r\032\354\256\325\373:\334\234\333\346l\217\330g\0055L*\263U%\205(\373qw\3270\306>\315\037U\375\217"
+	.string	"'\030\203\331.\207Y\217}\311\030&4\333W\373)\256\202t\232\221=\273#\\0vU\n\274\240s)\362\220y\031?`^\232d\337\270*\265\001\177\341\311\341\212\241\334\205\353\304mn\207\336B\363\320\212u\323\256p\026]gwG|\326\005\225\002)\031\226y\371\241\241\343+\276b\361elaE\357]\372+\363\362P\256Z(@\264\350\3543\336\351\005!\312\004>\232\021\032\200\231\261\n%\016N:\222\224i\356#\002IP)\001E\340\272m\202\t\t\312\306\211\272\355\203\300!\n \321\226\022\n\2116M\265\217\013c\036\204x\265@\227\t@#\264!\230\350=GXJ\311p\334H\210\262\200\217f\204\007`x\254Z&\225\351\315\016\230\210x\022\036"
+	.string	"i\3317c\032\375\fkm\305\262\340%T\324\266M\3146\241\340\252i,"
+	.string	"\303"
+	.string	"\224"
+	.string	"x"
+	.ascii	"\305H]<)J4uF\233\275A-\203\242\344\ru<\316\206\200Q\227\260\210"
+	.ascii	"\325h\340\2164\325\344W\230\255\264_CPP"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.43.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\225\f"
+	.string	"\246\226TC\020Q\225\016\360h?\266\261\003\332\247_\002\377"
+	.string	"\214E\373\244\030\200\370\212\033T\344\020\020\341d\300v\343\355\343 \301\377\300`\320\276T\235"
+	.string	"\210\024\b\350:\b\220N\320t\026\274\325\033\354o{\357\275S\n?"
+	.string	"?"
+	.string	"E"
+	.string	"\273\233I\020\357^\351\224\261\363)\036\213\367\245^9N1\037\206\271\331\335\013qV8.\347\001\260E\007\314\307\232\032XG\311M<j\370V1R<\273\353\350}\034n\312m\217lw\3543\b\237\273\273\226\036\366?\376W"
+	.string	",`\013V\354n8\271\261/\252b\304\305\366\243}\022/\321\375\003e\313\356\207\222\221\335\020\201\023TN7\327\324\323y\001\365\324\235\r\343\241k/B\222!\304$\017qj\356\024\357\235\372\247zz\351\210aBC\025O\\1\031#4@\001\320\006\210\013V\214\305\0245`\036\346\2146\205\n\361\236\245L]\204\007\276\244l9sT\275\034"
+	.string	"\316"
+	.string	"y\301\2121;LE\331\262\003\241\006$\356c\252\006q6\021\204SH\364"
+	.string	"\304e\021F\237R\006\332\270\214c\300\232\004\321\226\2314m\313.\341~\256\364\260\003\222\227J\256\252l\271Tm\322EJ\004:\266-\034\205\226q\355\256\202\023\017\231\340\031"
+	.ascii	"i\3317c\272\211l\250h5\243\005\273\037\0225q\300\f\265\315\340"
+	.ascii	"\300PH\006\204\026\201\300@\335\037\252y\334\n\005H.\326\022"
+	.ascii	"\253)\302]Rt\300\"\224[\271\021\fGcP{"
+	.text
+	.section	.gnu.lto_schedulerInit.44.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\341"
+	.string	"%\f"
+	.string	"\346\225PA\020O&\035\300\2549\300\350a\300\r\330U\360\362\347\345Od\322s\203\2752bBz\003\210y\020@dw\030"
+	.string	"\201\3539H\362\006#\350Uu\271 "
+	.string	"\301\324\r\004\207&\f\316\204rd\377\275S\n7"
+	.string	"?"
+	.string	"?"
+	.string	"\234\223\256\"\025!rw\271W\233cs\257\347\334\261c/M\373V\314\302j\266\273\035-\275\363\331\361\237z\306\b\362|B\f\354\256\347\b\302p\323\333\026`\273\263\377\t\250\0164Y\005\352\361\257\331\374\362!4\376\311\0236\363\343\253\277\331^\013\210`!\362\2058kv\371\231t\203\375\307R\222\r\001\320\"\224\241\344\202\256(\367B-\306\302\252\213\203\355\373\037\256\n\265\021MF\201zH4\360\253\242X\263\310}\021\037a\024\376\311\025\277\374\332^\253\006\226\007\215\371\321\235b\213\374 \336\272l\230v\305\325Y\026\377\364j\3602?^6\025&3?\372\252O\002\366$\341\367 \303\340s\340a:\b\025\212\245\363BL'\t`0\302\027v\022@0\354\270R\374c)\311\007`\300D\3721\307<\371\023\b&\013{\300]\t:L\273K\240\304M(X@\241l\3367S\237\004\031"
+	.ascii	"i\331'c\372\220\032\216\333\2051\223l\006\002\003',\361\302\332"
+	.ascii	"H\203E\220o\320\031Z\034\0211m\201;\330 \fQQS\242mSa\273&\202"
+	.ascii	"\017A\020*\360\313\025\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_schedulerOptimizeRate.45.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\375\t"
+	.string	"\346\222D< \345*\035\340\021?\265x\"\262\b$\022t\301\3023LR\221I\007\022\212C\020+\203\233\305\316\330,\026(*\345\214"
+	.string	"R\030%<0\23790\210\210(\343\366Z\267O\366\226)\0051"
+	.string	"1"
+	.string	"3"
+	.string	"\373\330\200\225Hmw9\311q\360S*\350g<\032Vx\372\324\270$\bS\363`w\017rm\205*\325\214gw\255\2540\343\336n\373\301v\203mZ\376\\\351\262\017\373U\325\337\036n\255\305\201\266\2131\n\330\223\255\344\303\3667\266Um\205\005\3600\223\301_D\230\311\256\230\340\216\3007\203\366\312\305\216[\270"
+	.string	"XP2\345K_|\210g\276\207-,\323\263\276\371\226a\276i6P:\316)_\252\273{\2226aTN\222\021\305%EE\245\001l\361\244\362\345]\351\003\321]\204D\241\322\310\0330\210\363u\023\025\021\235\004\210\304Q\204>\"\016\364\2218\016\202\275Q\367q%\317\373\270\215\270\237+]V\331)\210\215\253\021e\270g\230\313V\020"
+	.ascii	"i\331\207\324\364\307\262\302ejK\260E\252\312EEA\215K\t!\270"
+	.ascii	"&Nd\002)\251\311\300]\002\006,\252\334v\025="
+	.text
+	.section	.gnu.lto_scheduler.47.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\245\033=\177"
+	.ascii	"\332\321 .I \320\322\031\016\277J>\327\217\240N>f\205\033\001"
+	.ascii	"{\201\351\023\356\03137yql\032f\331A8\233\210\333\347\321p\331"
+	.ascii	"\256\307\222b\223\002"
+	.string	"?\026\327N\3356\364r\274\265\373\342^\233C\226\214,\255\305\343DE\215H\231d\320\002\177\002\341\002K^\242%\357\320\222w)\304\373a\311+\264\344UU^\245\312\033\244\344\005Ry\177T\336\344\222\327\347\003/R\210\367\250\3445\252\274\255\362\262\222\367\347\022\325Ct\212\333\224\246S\267\216-\366\260\3029\316\200\302\r\377;\177\236_\360\377\373\375~7\377\232?\206\177\372\327\375b\376\273\037\357B\273\337\275\341^\217\0167\020\332\331\343y\341\006\345\331r\372Z\256_[l\200[\223\274\263\225\354\"K\352\211\271\031\223\254sB\252\333\331\2403\277\303A\301\325{\243\301W77MR\355\006\355\351\354\001\377\252\276>Y_\202\241\233\035\3020\311\034\366s\374\222\034\032\003\226d_\234\276\215\221\245Jt\016N\337\252j\356XX\327\365M\337v\036>&D\316\324\325\3606W\267a\241\332\322\354\331\254\351"
+	.string	"\217M\224\344\025\r\337\363\340i\226\261x\260\033\204\3462\354\006\255\222\247\331\017_\242o\353\272\006\375\314^o\203b\310\322\302KS\266Jv\203~\004\272\013\177\341cN\346y\033T\346f\232\307\333r\372\252[\313\210\230!\2743\371\243\223\261\305\001\315\337-q\352\252[\307Z\340\225\231;\324"
+	.ascii	"\206\3335/\206\211q\205\326\255Oh\344\261\231;\244\240.\371\""
+	.ascii	"d\035\227\223\327r\375j2\0077#\371\343~\356t\315O\271\234\274"
+	.ascii	"\352V2\031y\207s\207\353Z\247\342\307e\221\374qy#\344\217\374"
+	.ascii	"\"\344\217\333\334\035|]\333z@)`c\016\327u\215j-\333\264\311"
+	.ascii	"n\336D\t\022ONM#D0-)%!\035\2050\002QD4\264\374 \244*\203\200"
+	.ascii	"~\222>\310\243\261\271\271\317;\237-v\335D\2113'\221\207\307"
+	.ascii	"O\203g\362\314\260\223\321\207\204\261.\217CV\306\370b\017\341"
+	.ascii	"\f\347\223\302M.|\2041\205\221\b\243\022\235\361\004\323\\\340"
+	.ascii	"\224\227\246W\n\374S\034\262\026\302p\022\322\275\344~\204\202"
+	.ascii	"\321\211\005\016\021\324dl\007\243\037e\376\272\034\304\343\220"
+	.ascii	"q\201\363\306E(\234\310\247\306\020\333\023\267/\215)\be0|\034"
+	.ascii	"27\243\321X\227\260\307\221\265\361\207\023\214NqdTX\310\247"
+	.ascii	"\006\333\023\271\253q\310\242F'9k\2544\026\245\235\231\3638d"
+	.ascii	"[\214PsRP{\034\331\024\016\342{\2123u.\034(\250\314\311?q\310"
+	.ascii	"\324\256\227\306\311\247,O\240\3671\316\330\2132&T\006f\344-"
+	.ascii	"\200;\234\315\237\342\310\324\030I\244\314bXY\224\037\217_wv"
+	.ascii	"t\360\312\242\334hL\021\3453\023*#\301h\204"
+	.string	"\303\225:os\026+\373\342\276\336S\340\245\231Cd{\002=\373\324X\327u9\254\354\311\367\304w\371\313\356\201v\221\334\004z?js\302\013x\344\004~\361\236\033\327u]\223\\xL\306c\227\322?3x\251\265\223V\023v\007\352j\375g\324)\366\264\276\f\3470c\204Q:h\233\371\313\262\306\247\245{/e\212\307\2435\320\304\t\230\236\361Q\372\320\026Sqcc\331\335\320m\354\013n\320\314\356~\034\036\235'\034\264\2717\350\036\363\214:\233\351\270I\323\205\367\331\274DT\372\026\245\233z\361\"\262\315\332`\260\255\344\272~\271X~\2160\303\215\375[\026Z\037\305\220A\234\262\234\fvl\307\226\362\027\327^\325\207Di\036#\246v\263\026\322?\353?\2778yq5\350\233\365\301\024\277\207\275r\354\236\006}4\273C\204z\361\342\255\230q\2521\266t\221\337\201<\366\333|\b\206+]x\344"
+	.ascii	"~\361\236v\243vg\330-\335\333\205\372\"\223\344\272\256/\366"
+	.ascii	"\211W\344\261\177\373q\035\350\321\003\371\243U\373X1\224\233"
+	.ascii	"A\305\367{\316\303\252\331\277\255\217\335\343\207\355\036\362"
+	.ascii	"\307\357\235O\030{\213\316\345\361\342\305=\342\335\t\202\360"
+	.ascii	"\303\230\315^\240\300A$tv\327n\235\223[\272{\027h6\234\260\215"
+	.ascii	"e\267MK\026)\226+lV\252"
+	.string	"\024\361\236JT\210\367k\237\302\274\227\242\344\275\232\222\367i*\357\241*\357\321T\336G\001\301\373\263\"\336\233}\372=\224O\277'Sy/\366\277\357\303\356\367\375\363\323\357\275.\346\333\004\342\025\341\206_&\277\363\335z\236\257\226\222\367\212y\255.\370E\3625\337\r\224\274\032\034\357\313\274\233\257\221O\277E>\375Z\360\272o\005\257\373Rp1_\"\027\363\035\362\030\276B~\367\r2\304\013\204\210w\002\"^\t\210x# \342\375\241\362\372Py!Py{\250\274\017\250\274\016\250\274\r(yy\250\274\f\250\274;T^\035*o\016\225\027\207\312{c\210w\201\346\265\241\362\326Py\025P\362\322P\362\316Pye(y\023Pya\250\274/T^\004T^\027*\357\001*\257\001*o\001B\274-\226\274\004,yY,y\243\226\274+\226\274\003,y\241T^\025*o\n%/\n\225W\200%o"
+	.string	"K^"
+	.string	"\204xO\250\274&T\336\022*/\t\225\367I\345uRy\233T\336\021J^\021*/\223\312\273\244\362*\251\274I*/R\363\0365o\b%\257\221\312\013B\345-\n~z\210z\360X\021\321R\002\232\2037=}\004\364\021\013\242qba\n\322\017\274Q\033:w\243\366,\263\324\322\303A-N\224\032\313^\316\217R\356\324C9z1D\272W\257\361\250\310O!\2257C'k\013Z\254\202f\321Xvo\334p\261\350\343\031\032\304$\257\016\201\315b\224\r+:j\200\206\352\025k=\300\031\031'\0352\212^\373\002\016`\314\220~\023\350\372\006\217\214\316\206\302\t\030\031\020\267\322\277\322b\013\325\002\274\255`\027\b\325k\270@\374\251h\2506\246h\001ZE+\025\242\350\024jP\364\337\270M\275\2564\263\005\030"
+	.string	"\314\235\223\316\035\2343\204\r\246a\213mk\230\243Hg4\255\262B\245\215\364\253<\332\247\222&G\024\312\215\016:\200X\377\265\316\300\016\360pb\330!\346\306\256\365\341\234\327\260\300E\351\2340\004\266\025\2654zf\3610\017\021Y\207\240g'"
+	.string	"<"
+	.ascii	":\200\023\r@\231\023\255\232)\312\335q\375\354%\036\346\021S"
+	.ascii	"%\347(rH\034j\251X\303\200\002 4\354b\035\243\357iXG\245\017"
+	.ascii	"xc\0303=\210P\023S+\177v\21161g\245D\033\365\244AI\264p\345\251"
+	.ascii	"\233\232D#\3218\365\210~\352\244\302'\2343\356M\355\304\302\225"
+	.ascii	"\246\376\240\033TD\217\220\262\nM/\"\372\303\227!\342\224\251"
+	.ascii	"\277<\354\316R'5S#\005\237Q\245\245NJ|\302\035\277j\220I\255"
+	.ascii	"\324\177*:y\221\275Ti\031\222\3243\314\f\345\240\314F\352?\333"
+	.ascii	"\350\367\204s\"\365\347\374S\032\326\300qvWR[\233\265\345Q?\216"
+	.ascii	"\271p\227%M\267\346\026~Xs\013\362\307\243>\356\025\312A\367"
+	.ascii	"\f_[\233\017Q\036\242?\265\013D\301F\315\354Ev\210v\"\241\273"
+	.ascii	"\026D\033u\217\001S,jf\203h\246D\033\274\245\250c\354\r\"\n\025"
+	.ascii	"\351C\351\020\320\320!j\267D\276\362\241&\352c\337\262\205z\250"
+	.ascii	"\221\324<\343>\364R\313\216\017\255\232\t\"N\205z\267\211\002"
+	.ascii	"K"
+	.string	"\271B\374\031\005\177.\244\332B\312V\373\210\006L1\250\177Z\331J}\317\026\200:\210\255\351\005\250\317\007\230lf\377\264O_\n\\\245*\331\004\230\t\312M\323X\220\341\213\332\322=\027\322\247\317\006\206\327\270|\372r~b\257\016\342\224\343v`\373SJ!\221\215e\027\270\002\253I\271XN\033ALS\216\t\362Gd\237\357\354\226\245-J7U\341\213\023\262\240\226.'\031\355\317\273\016770\275\237\177\t\362l.\304\f\0270=\344~\t2H\213\235\305\001:\366\240\335\233/\336\023\206\237\3548\366\307\270\265\240\025\270\303\237\226n\013\202\345\371\\J\363"
+	.string	"\313c\253\026\322b$\\H?\313\301\nf\022*\255(\253\253$I\256\246\222\220 \221\272\301\304\272\322\200\271@\322\320\221+*,f\007H)\f\330\352\212j\312J\211\216\252)&\007S!\264l0\265\224L1A\310\241\005\002\323J\255\312\222\3222f\005a&\241\002\242e\305\304\302R2\245\"\221\372"
+	.string	"\213\251e\305\343\b\226\224\222\035\314$TZH\244\230\0220\217Pei)\271bR.\321\242\302\272\242\302\3721E\225D\312j\t\216#L\255)&\022f\326RVU\226\024\220\r\254\250\264\250\244\266\224;\265\002\213\211D\311\021&\007SYQVTRI\242\246\260\262\242V<\355U\007L\254(\255\253+\254\250\240:\257\267\347=\271f\021\216W;M\300`f/\220*F\200\030\031\246%}\321!\260\304\004\035]=\t\372GO\240\3673sR\250\262\356*\260\270x\370\265\256^%\"h\t\342~4\222\216\240\221\004\237pNgKY\275\037}\314\2236\025\241\323\272\270A\231\364V\213\3201\306<\rIh\264\252\244\"\223\276\236\033\303\200\261\203\350\243\317\266\032\202\366\001\326P \350\243\235\264\036]\366@3\320=\372X\350@7\320\017\264R\037\003\355@\217(|*\362\350\006z\254\351\205G\323"
+	.string	"\234z5i'\f\364q\320\206\035-V\305\364\247\243q\364\216F\252\311\321[\255\243\221\022qt\216\026Q\370T\024\353&8\332\347lPn\252\3257z\253\373F\033\200\266\002\f\326\352]\2407F\225\257\356\032\353\247\221u\201\3669\323\352\027\376sh)(ax\302G\302Fc\265\323F\267\232:\335\305U8\207\205<5z\261jU\240et\2156\n>\243W\255"
+	.string	"\215\236\321W\335T\370\214\233A\243\227\022\237-8\023\233^f\224\350\353\322\326H\205`\2122\232\331\327\322'\274\021\214\037a\"\332]\031\363P\005\365w\2756\031\035t\346\2078E\254Z\375\374\344\240H\232\006\037\231'a\002\255\247\351e\355\203\321\t\364_4\263a\264O_a\325\372\242?xc\ng7\310MO\030*\336=\265t\267\251H\177J\023\221n6\033\211\013\036\273\300f/\337a<L\2404\317\316\220?\036\317\372\344\240\b\020\242\271\350\003\032\201\301f\032Zs\315E\377@\275\246\364\001}\201\0332`\212\006t\235f\032\262\2006`\371\217\001\233iR\232kk\310\037\013h:.sQ:\350\233SK\227\013,o\304\263\374\b\246\231"
+	.string	"d\325F,8\242\031\026\241\300\314\\\364\025\264\330\032G\f\351\347}\007`\0300= \206\236H\213Ao\304\350N\\W\235\2749a\232D\260h^b\001T\b&\312\304\242\202\246\240\305X\204\221\346%#>\362N"
+	.string	"\323c2\322kT\"\322C\376f\227\353\013\317\361\313\"\225#\305\001K\377\315\210\026m\301\033\017v7\264\350c\202$\250\"\3410\320\241$\204\206FD$I\222\fkB\n\020\206\243\201 \270\324\007\022`5A'!C\250HFA\223\244\324\034\3462\323A.\225}\201\335\260g\317!\206\227\326\227\302\"N\216\364\247hQv\3014S\032\373\314\267\311!\375\311\252\361\023GB\260L\331\223\355\346\304\330m\267\"\022\236\364\217\021\001\005B\032x\314\317R,\023\333{\314 Yk\303\351.r|J\346\bw[:m\017\321\227\246\276Q\362\323\226(\317\201\220Q\336\306Pp\317\201h\241\274\304\261\224\306pMs$\221a\233"
+	.string	"\241B\332\215\227\342DCjH\336\003\317\2246)\245@\213\225NIha\221\3010\303\030\013\nJF\200\364F\f\322\340\316H\0314\204\2222}X\320(\313\376h\223\203L\021\300\263\263\203)c)\306\377%\223V\026\237\366"
+	.string	"\315\006\036\305*~\024\270.\340N\353y\263\024\330\030gn%:;\316HX\373\333\242\364t\037\257[Yg\350\334\3405g\247\310\016\335?\222.P{\226\243\217:;$\003\b\352\021gA\r\025\274\021\320\353\002\024-_\274\027\036y\367F\0160\256\330\021b\205\210z#TtcQ\236\201\277{\311t\366phf\032\017/\220\261G\027t\270\315];\221#\"Q\020_\305{/\036\356\3540\307j.6\202I\334\211\307A]\234\231\251=\310\n\037DB\365\335\263\310\304\253\270\226zG\304\351\330\377\252E\220\303\263"
+	.string	"@\275\243\234\331&n8\302\240\005\223\201\213\240`\251\347\375>\241gCa\027H\360\254''\370\226\255\347\035\224+U+\357\365F3\334di_:\270T\203%D.n8\367rj\300s\270\247C\344/\331*\226^\272[\026\006\222M\345\240Z\315\203\274\243\332\360\354\222\241"
+	.string	"\026\365\376L\255"
+	.ascii	"\311\377N\0061\270<\f\224\350\246\375A\361\002\200'3Q\0176\210"
+	.ascii	"\203\031\033N\035\027\307\301\031\022\266\360\027\024\003u\213"
+	.ascii	"\302\032\250\013\221\342\251\367\334OW\331\364X"
+	.string	"\346\323Hl\224s}HJ\003\263\236\202#z\315\265x\354\364)@)\274q|\274a\202\216\264\3318&\2153\013\376a\037Bx\267\016\2654\200_\220\bg\337w\004\267\234\371\216\006\361=SVoZ\272R\304\301\036\235\3325\353&77N\305l\200\021\023\276\240\177\307\365\223l4J\311\276[\235\2634\262\021\306\207p*\305\314,A\315\t\226qa6\243\344K)IG{\226\245\351\365\201\270\023\251\213&0\305\333}\306\231-\314g\267\005`\0041\210\313\261\301\325\266\214\256\222\344\034x\202H7f\215(\353\316\017\266\214\317\261\205\254\300\243~\256\335-\n\336\024e\264\243Lc\325\230`\365G\363\251B\212\243PXu\250K)\007\220-a*\\\343\n>\r\224P-E\324\374\212t't\035\372^#x5\264\373\021\007\001\027!M\310s\303\332\311F\2038\352\322\336\201$h\027\322@\336\314\214"
+	.ascii	"\342Va\213\001\r\001\252U7s\237s\306\3434\357O4\b+\226\327\315"
+	.ascii	"\017%x\3233\253A~\333\276l\320\034q2Q\275\020\031+\231,A\204"
+	.ascii	"\023\256T'\351\321\366V\326\220\310\241\370\356a\270\201\337"
+	.ascii	"A\331\326\302@\004\204DFn3\240\247\234\300\335k\025\211U\rQ\020"
+	.ascii	"(\036\027T\"R2\355\223E\023\352$\272\347\312\376*\211\275\362"
+	.ascii	"\017\313\253\311\374\t\020\306oU|\321 \211\273\364\222\326<\231"
+	.ascii	"iM\3056s\324D+;\242\221\277%\243/\2551\2104\226\025p+\355\325"
+	.ascii	"=\n\224\035r\311\346\243=\"\363'9<\316\334\331%\340\331\364\001"
+	.ascii	"\322\207\333\204\016\fA\033\205\227Qq\313\013\312\017\271\370"
+	.ascii	"4\227\221x\210\340\342\306\317\024\377z\370\021\374O\360:\\a"
+	.ascii	"(\007\202K\355#(\267\034\024\313"
+	.ascii	"\213\350\355@i7\225\342\f\341_k\016@\b\261\254\343\214\027 \006"
+	.ascii	"\223\fWi\242&\001\036\ba\216b\340]\030\317\351\330\030\317(\005"
+	.ascii	"\255\241\024\303\2425p\376\331|\254\325\331\351\354p\362n\332"
+	.ascii	"\216N\224\275TT\023\322)\200h\001\224\246\275^KZ"
+	.text
+	.section	.gnu.lto_rescheduleTask.part.0.54.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\007\003\245\023"
+	.string	"\206\341uJ\320\322(\035\222\230n\332$x\330{#\334\004x\252\262\002\300\276H\310H\304\316\331\326P:\t\352\3419\002\300\361\301\006\204mo\341\214\212\335c\225\003\274\340\250\344\250\b\f@\332G\313\030\305\030\032E\320a*\233%d\357\224\002Z"
+	.string	"d"
+	.string	"]"
+	.string	"\346o\\\274si3Sj\177\305Y\300~\343b\221\335\021I\271\335\023\301?'"
+	.string	"\377\241>\300\364\317\273"
+	.ascii	"\323?\373*l\2333\303\354\245\237%\3665\243\230\032\220\335\025"
+	.ascii	"\377U\022\207\275R\017\346\313h\031^_;\225\321:\234\216\334;"
+	.ascii	"\235\354\256A\017\367w\333&\266#\330\325\025\017\362\205\034"
+	.ascii	".\351x\016\303\227\361\037\207>==\006B\355r\017\300\234i\224"
+	.ascii	"\206\215a\240\257\314~C\020$\036\272\335m\360\235\267\360q7\363"
+	.ascii	"\266\027%p\256\314\314\305_\300n{}af\"2\244\035:\224\023\334"
+	.ascii	"\261C\034\352\343\230~\315\241\355\353\344\264\320\005\033\373"
+	.ascii	"p\340\237kN\013\317\t\370/4\245?\003\265\326\377\034%\310\204"
+	.ascii	"Q\314\020\377\3507^\276\215-\224\364\262\322\364\357\365\270"
+	.ascii	"\033@\341#"
+	.string	"\305L\214\356h\255q\365\356m\245\261?j\357\271\273\376\374\351o\367O#\n@\354r\330\tY\021_\317\211\337~\237?\367\017\375E?\321\257\363\223}\177\306\211\374\032\267Qt!3\210\306\220\222.\251\024*!\205z+\006*e\312e*GR\325r\260\032[$\013\302\213\305\022\300\252\022\222E\341\302\2125AU\212,\255\324\212\250\"K\261\244\200\307\n,Rt\215#)\206\367\266\322\370\265\203\266\036G\261\372\342Zk\215m\257\332*\317\261\002@\307\356\232\37080\214\276\315\013\367\207H\232!y\255^%Q\202\371\361Bw\246\001E\250\221P\246\220\"\024\314\004\222\206\342\264p\200\002\031\232<\007\022 w9\212\331\344Yna\375m\353\201\231>\"\230\201o\nE\244\021\023\207\214py\261=\022\362I\213p\313\361[\220y%\353\226}\203\236\221\246\013\237\f\361\362\367\024\037'\007\005S\003\177\240"
+	.ascii	"\0253\333_\311\312B\344\311A\346\271_\236\307\264\03084)`\307"
+	.ascii	"\317Ba\371\374\035\0213K*%H$\005\233?\034\347\030\376\316QZ\311"
+	.ascii	"\303|\236\217\317%\201f\035\032\315\032[\020$_\027m\370rx\n"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.55.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\271\002\335\025"
+	.string	"\226(\216H\3000\2511\370\277\243\020\213C\312\366\372\250\005 \367w\306z\357!\343\024\230\326E\346o\216\035T7\215F\216\263\331\2551\022P\025\001\342\355=\t\202 q\23076\016a\25418\222\207"
+	.string	"\373\006\301J\333\266\224R\246\024}"
+	.string	"u"
+	.string	"u"
+	.string	"\267\366G\330\366\005\375\263g\274\024\272'r\325\020o\334{i\267\224\303\177\217\301^\243\255t\312~\376\211\027\t\001\203\024\302<\026\002{\r\2134\200nv\376\252\004^X\201\020\351\371\201\232\tk\346X?\200D\344]\004u\352\210\326T\r\232i')\304y\225\tqN\353\007\326\006\031\035\302\231:\342\303\002\303\243>m\2042s\006\270\354\345\340\336\353\307\360\334\263\333\016\262\375\300\236K\001]W\203\245\362p\250\337\276\317\364%?\3123(\337\237z\023\244\2747A\277\351N\277?\365~i\20212+\207\326\275\345\201[\237\2240\342}\242\317\236\315\\\347\225\\b\342{\222\313\313\013\254\323.1\371=\311\005\344[W$\252\026\300n=\347K\337\221^jy\205A\317i\277\304\217~Gzq\354^\240&\251{K\004\267N"
+	.ascii	"\273-\360\217\361\266\336c\f\226\332\330e\254t@\016\016\213\342"
+	.ascii	")z\376\220'\244\244\214\267\2246\350\240s\"\322\347\252\322\241"
+	.ascii	"\251z'B\244m\013\237\302\235I\350\336\313\340\304\245V\374\241"
+	.ascii	"[\347Z\346\311[\277e\274\235\364d\206\230Y4\375\234\332\302\372"
+	.ascii	"\241th\001\177\031O\273rl(\305\230\231\\\223\016Me\257\227\006"
+	.ascii	"\331\343\364h\247\355\225\376j\247\251\235\236/\377\317<\f\364"
+	.ascii	"\334\013,\006\270]\215WQn*\022j,\267\027\n\004\334\256\306\033"
+	.ascii	"m#\321\335Tz(7\n\266\035\215%\245\266B\263\351v4\222\020\347"
+	.ascii	"*\334t4^.\247\243\315l\317\3730\023;W1T&\026\341\246\311)\353"
+	.ascii	"\t\006`Zj\327l\363\244;\240\212W3\024\306\250\210\307\350E\207"
+	.ascii	"\336\215#}\221}\373\212\035\354\336\253\300\257\342\341\374\241"
+	.ascii	"\336x;\322WRQ\304\221\212\013\300\017#\035zVJ\251V\013+:i7 P"
+	.ascii	"\002!\311\352\016\355\366{.n\203\361\027\342\314Dln8L\022\366"
+	.ascii	"T\350\023.|l#\325\001\273\031[I\230M\244x\333\345\3440\370\334"
+	.ascii	"\221O\363\234_\203p>\352\f\241\037\b\270\274\020O\236\033\341"
+	.ascii	"\211\321k\005\274\301\330\333\257&\bcp\n\371\275\b\304\306\213"
+	.ascii	"\230\264\200w-v\274\262y\262>\263-\260\234\267/k\220\367\275"
+	.ascii	"~8,\020\302\341\251\206\326\036\360\270Oy\370\033\254\235y"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.part.0.56.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`H\001\005\f"
+	.string	"\226\224LD \213*\035\240\250\204"
+	.string	"0t\022\213\357\233b\212`\251\211M\200\022\234`\3437\f\231\344\346\213\202\2004\036\272\365\337H\024\034\326\351\325\013"
+	.string	"(\013(\242I\034\020\332\001\230S<\352\323\310\0015\262\311\336)\0055"
+	.string	"8"
+	.string	":"
+	.string	"\325>\002\333\247\225I\233\303\313\327\236f\300dv\333]\360\225\0228y:;\322\277\354\027\025\253\344\364\201\205\362\031\361\256\302\261\273\266\244\334\365\2665lk\354S\b\025L\006n\367$\207\333"
+	.string	"\325v\300\366\355\313N\366\367y\316\227\247\307L]\271\254\225\347\264\237\340\n\310\307L\276\354\n\270P\333-/^\215ay\255\370\204\367\332\035\343=\016=\002\204\007\337\002\r0_\344\331\341i\"\n\215m\2227\030%^\273\273\301\3403\222_\340\325#\245y\325\253_\362^!R\030n\035P37\251\313\264\353\226\266\354\227\377\003\235\016\320\270\031y\346dD\017\b\251\343\371\340\214`\310g\023\0029\342\bf,\034\212xDp\024\206\"\370\275[\332\262\007\200\f(\2322\245\324e\177n\241\202m\300\006\030\350\265\t\022nwp\007\" \300\202!\034u\251\366\205\211\215\3544\f\331Sqh\206\301\335\007\333\335\233\313\211\307\301d\235\020\341\304\216\353!\tq\361\340P\333\340&\332a^\327\026\245\221\323Z\034-\235\311\231u"
+	.ascii	";y\317,\240\275p9\325\351\327\2561"
+	.text
+	.section	.gnu.lto_schedulerResetTaskMaxExecutionTime.part.0.57.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\225\n"
+	.string	"\006SE< \345*\035 w\022Y\214\nH\031\001\270\027\1778\030\f\236;\037\204\022\220X\006Y}\206CW\321,A\345\336\234\356@"
+	.string	"B\021\b@l\036\364\214\261\253+\267\340\266A\366\336;\2451"
+	.string	"4"
+	.string	"3"
+	.string	"\257G\261\235\362\260h\333>\276\366\264\032\307\254fw\275\327ir\361SR\321_\2614>/\273\\\261>.\007N\003\034v\327\033\220\273\336\036\373\f\001\001\226\244\302\234<v\373))_\346.\226\372\210\222\017\253\nIx\265\224\366U\276\"~DY`\267d\346ewTx\365\302\346\325\340\004\334+=\207{\355\002\273\036\237\226\021\372\260\023\367\212 C\343\267|v\362a.\231\344W\257\276\211{\375\254,6"
+	.string	"\"*y\223\323\345IOw\266\354)}\312i\030\331\355\270\005!\b\212\360C\342\f\352\200\242\212RH$\001\n\275\213\211\217\205\007\002C\257s\340\017C\004z\244\357\003\275\316\266<\335\331rD-F57<\347ty\304\331\337]F\005\257\r\030"
+	.string	"hm\321Y\326p+\337\230lb\242\005\025&E\205\007\210\202a\256peM`=:\n\301x\236tO\323E\265\323\271\240M\227\235\013"
+	.ascii	"'\236\313\350\230w\254\264:\346\340"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\241\002\035\016"
+	.string	"$\024\235\003"
+	.string	""
+	.string	""
+	.string	"\0026\177$\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\020%\200\204\001"
+	.string	""
+	.string	"\003\0028\177&2\030\0029\177'\002\031\177(\272\200\202\002\030\025\005\025)\005\026*\002\032\177+\252\333\3426\002\033\177,\305\245\376\322"
+	.string	"\034\177-7\177.\002\035\177/\036\1770\037\1771\005\0222\005\0213\0244\201"
+	.string	"\002$\1775\005 6\005!7\"8#9\002%\177:&\177;'\177<\377\377\377\377\003(\177=\002)\177>\023?\200\003\002*\177@\002+\177A,\177B-\177C\005\027D/\177E\252\331\227\0010\177F\037"
+	.string	""
+	.string	"\200\200\200\0011\177G3\177H\003\005$\003\n%\227\356\322\027\001\304\013\003\013%\363\235\316\032\001\344\006\003\f\013\312\345\311\310\002\001\242\006\003\f\n\267\232\266\267\001\001\202\006\003\031"
+	.string	"\340\236\212\256\001\001B\003\032\f\002\001\302\001\003\036\002\321\360\372\250\037\004 $\004\001D\003 \n\004\001\242\001\003#&$\003#&\235\332\250\031\001\204\033\003#&\334\222\302\f\001\204\253\001\344\253\001\004#\264\321\270\231\001\001\225\032\004#\325\352\353\264\031\001\265\272\001"
+	.string	"7 \220\002\231\272\262\003g\b\002n\345\223\350r\273ee\213%<|\036\363\326\302qe\270\365p\001\004GZ\372.\205AX\252\r\310\272Pa\313\206\364\3207\366\217\220H\237\035\236>\"=B\234\233\b<\306TJ\306\3303\246y\220\016\303\211\264\263A\335\240\215\r\322c\373\207\024\001\272\207\264."
+	.ascii	"\237c\310\323cEW\221\301\244\t\247\307@\037\003\203\277\005\244"
+	.ascii	"=\b\201\222v\200i\352Z\006"
+	.text
+	.section	.gnu.lto_.refs.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\235\b"
+	.string	"\246\026;/pEI:\n\353\f\251\2127\342\221\003"
+	.string	"(P\300\003"
+	.string	""
+	.string	""
+	.string	" L)8\016\003\372\326,2\213Zk\315\332\366\377\332\337,!\233\220\275e\n+"
+	.string	"-"
+	.string	"0"
+	.string	"\235\311\333\221\027\260\226\264>e\217\362\216\344\315\344c~\333\f{\265o\356\270\261\365c\275y\013UW\330\021\373a/\366\324\375B\004\370\016\376\003\237\301\3176\036As\233~I\217\321\027:\242^\220\256\236\216N\257\363\200Z\261\005\360\313/ksc\377\360\036\267\323\276i\001\n\225\237\260\016\345GX\177\330\257K\302d\274\024\341V\255\227w\260VX\203Zz+\245\364\205\177\275\340N\254\244[\360)\370\022|\t\037\302\207\004\337\207\312\327\241\375"
+	.string	"O\037\300\363o8}\r\347\317\310\037\203\365/\330oq\371+\240>\005\364OD}\211\350\217\230z\303\364\fR_\220>\r"
+	.ascii	"q\023P\260\302,\r\03517j\032\247\031\203\f\266I_\247\226\b\213"
+	.ascii	"1D\301\245b\333\031\302\300e\001"
+	.text
+	.section	.gnu.lto_.decls.7763efdc9f87246c,"e",@progbits
+	.string	"(\265/\375`\225%\r\240"
+	.string	"z\366\3445N \222\312I\007Z<\343\213\f\303\370(\207\027\361\275`\315\326\216|cs1\373\372\025\250\210\303\303\222\316\214\217\316<\372\305"
+	.string	"\025\341m\237\031\357Z@S\007\252\352\002"
+	.string	""
+	.string	""
+	.string	"`,f\023o\326\262\026\221fD\003\301\356\377%\233'[\312\024\261\002i\003d\003\314)\322!\274\244xq\252o\2618Q\2263\003\345\321)G9\206.T\344t\312z\315y\f\347\254\307xB\310\313z\351\275P\314)\210\230S\370\260A\201\342\362K\337B\250|\307P\242\037]k\\e\200\252(\001\013s\342\346\3471&\343:K\365cy\317\356m\216\370\355\221\363\034\323\351\317t\347\272\353\t\335Kv\3575\200\210\214-z\247\323\327a\350\177\340\r\266'{IT\243V\252\f\307q\374<\301r\227"
+	.ascii	"\306\355\321\254I\206\205\005\266\354\364]\245\236O\374\270\217"
+	.ascii	"O\374\316x\324\363\235\372\202K\374\230\b>\303O\025\214\346\314"
+	.ascii	"\306f\356\003\325\274\315\006\323\203\306EN=\253\370\331\276"
+	.ascii	">V\361;\223Q\215\270\304\257\231\304\217\307\360\032?\317\306"
+	.ascii	"dnQQ[\235$j\235\236\241*\017?g\373\235\251\250("
+	.string	"X\211z\036\242\236\247\324\353P_\304\240\036\004\225\315\230\013?Wp\227\363\026n\036\210l^\347\275\315\"!(\"b\344:\275\006\352\177\347\013\200\2720NB=\257\370\025\361\212\337[E\301%~i3\216K\374\336\344\022?\225I\374\226\322\204\376~\026\325]\313E$\304@\205\356\177\337\317}8?\017\251?\373\374\314,\347\347\2373?\307y\003\377\243\034}\363\363\035\233o\360\333\034~\266\362\364\267K?\033\327\274\304o\223\212\030\307\334\332_~\256A.\310\345g)\367\371\355\fz\276\036\364[\037\342~\350>\030\340\\h\n\376\363\375l\301\177=?k\360\363\177\316\340g\240\237a\374\034\364s\214\237\205*\370\331\376\214\301\317\277\237e\374\354B\202\377{&(z\004\277-\341\347\006T\254`\340D\277}S\363_\305\201~[\364\363\333\240\337o\177l\354\030\372{\316\317f\322\374\234\312\360\337\200\035"
+	.ascii	"\370\033\216\372\367\0334\267\003\377f\373\031\315\317m?{\371"
+	.ascii	"Y\354g+?S\371y\312\317\353\317\301\237\245\374\f\345\347\257"
+	.ascii	"\237\177\370\331\205\237\227\374\214\344\347\255\237\213\374"
+	.ascii	"\234\365\363\220\237\257~\366\361s\325\317S?K\375\034\365\363"
+	.ascii	"\375y\307\317;\374\374\364\363\360g\246\237o\370y\351g\033~\246"
+	.ascii	"\341\347\030~\246\361\037\205\377v~\336\340g\026\377\321\374"
+	.ascii	"\257\373\371\304\177\033?\017\360\237\314\317(\374\\\364\277"
+	.ascii	"\313\317&\374\317\373/\3673\t?\207\360\363\007?{\360s\007\377"
+	.ascii	"O\370y\306\317\034\374\034\301\317\020\374\234\342g\024?#\360"
+	.ascii	"\363\001?\037\375\f\300\317F\377k\374<\342\377\b\377\335\376"
+	.ascii	"\017\320\327\327\327\367\377\250\277\017\332o\",\316\245\322"
+	.ascii	"\210\312\271TR9\273\212\360\021*:4J0Q\257\"|\244B\336+\253#P"
+	.ascii	"I\2438\252\346\362\272\271\227\317x\334d\002\367\036Y&\335@e"
+	.ascii	"\261ZT\334U\024\030\250%7\357\275&\254\242\274\226\027\031G\025"
+	.ascii	"\266\2747,*\307\265\242\340\330\214\273_\034wTr\344\376\340q"
+	.ascii	"/\001V\367\036\371\306\335{\217\367\336\237\344\221\346\275F"
+	.ascii	"\214\250\230VV\367j\035Y\335#\3071<\356\355\263;5%\225\323k\211"
+	.ascii	"4\246\213\223y\247\232Gf^7]I\325y,\273?\346\250Le\0209b\370\331"
+	.ascii	"bZ\353\310\354\036\201\226\274\321b14\006\312c\331\004\303\317"
+	.ascii	"\006\323\\\"4\357\021(-:\307\267w\223I"
+	.string	"\026O\261\332\313\016r\236\240\351\364)Rm\264\247f\313!\013EDMZ\247\r\005\322\315Ar\226\247\013\307\031\332\263\212k>\235\252\0305<:M\240\265\254\037[\\\240Ai\314\370\314\230\355\261\033&\2224e\315*!G\275N{K\025'F\260\350\251g\2621<i\355\305\320\f\356\334\261kVi-\235\245\255\364\225\036\242\2514\226\016k\261&\343g\217\265\020d-\205\313\254\351\301\030\343\267f^\200\227\265\2667\306rl\334e\255\355\261)\203\223\306\307P\216;\363\200l/m\214\343\316\230i%Ot\202\261\236\302zD\366^\2567L6c\274\206\313\260\220\227\265v\004d\363\221%z\224Z6C{\260\354\311S&\212\336\317\230\031\2573(\035D\327\205cv\332`AE\354\254\2511S\233\264\223\376j&\374\354'\255\344i\363^0\314\347F\346\225\246\2270\224\bxo\227\032\244'\\\226"
+	.string	"\232\2545\261{\233GBZ\372\3544\201\322\333)*\333#]*T$\231/d@\270\371\311\231\023\353Z\236(j\022\261R\222\204\313'\314\2303d\247o\256\277\2174\222V\256p\352\222\235\002\361\322\b\322{+\350\213\233\036)\235\222(\242\225*\315P\365\350\364\255\3657\221\316\352\244\320r"
+	.ascii	"\216\362\004K\236N\017w\271\304/(\312$~-\004\351=\204\304/\251"
+	.ascii	"\325\274ghx\230\264u\n@\007Y1t\207.J\fH+\205\312\340\212@\266"
+	.ascii	"\262\223\355L#b\247\323\306:\372m5\251\322\326\351m\020\365L"
+	.ascii	"\326\306nDPF\027)\365\205Y\366\306\314\302\007\247\005-\r\363"
+	.ascii	"\357\037m\325\307\366\301z:\252\253\232\212\367\364U\363h)\356"
+	.ascii	"\353\333P\215\354)~v\217\237\361p\236\0375\357E6\3030T\fS\fC"
+	.ascii	"\211\220\315\253\374y\206\311Z\333\273\203%km/M\367`5\354f\233"
+	.ascii	"j\352\324\323\213\0040\272\007\277\361\034\321\261y\261\200\332"
+	.ascii	"lq\"\311\341=\216\323j^ @\317!\262\326\366\274\200I\263\3438"
+	.ascii	"<\332\2205\177\326r\306P\350S\r\223u\017n\303nd\360H\002\247"
+	.ascii	"\244\262D\357m~\2025\\\206\bit\221K\2640\323\324\270\214-K\252"
+	.ascii	"^\226\200\211\336{\317Y\272\007\177y\232-K^\037QB\304hC\247m"
+	.ascii	"k\357\336{\364\300\320U\234\253\251\005\322\367\232\352s\325"
+	.ascii	"\320\366\354\024\215\ta\022\004pL\236*C:e:\\\347\\\004\317\271"
+	.ascii	"dEP\260,\242\210\357^\250\"\346\024\001g\023\322\252\333kb\366"
+	.ascii	"\346\265&\252S\273\3056\371y7[v\242\265)472\365?\360\335~\226"
+	.ascii	"\3546\313\017\004\256q-\351\n\033\373\201?^\350\266\230R\324"
+	.ascii	"\0039\021\023;\021\204\351\325$\b\020\227z\033\306\326\212\265"
+	.ascii	"\302\004:\252/\370l?*T,\224\037\324\346\370\304\206\302Pe\325"
+	.ascii	"\275\2312\245\357\364\004}\375X\232\251\221\362\264RX\217\233"
+	.ascii	"\027\253(O\r\370\004\003\263P\240_\321T\016\022\262\265 n\241"
+	.ascii	"|\341\ry\003\354j\322\304~\001\3571\016\005q\200j\244\366\270"
+	.ascii	"Y'\267_\\&\210kM\0242\2402I\022\273\344\251%\252\026\306\345"
+	.ascii	"\303*\271]\3226'\304\\\247\326\253\277\244A\202@\361\272l\226"
+	.ascii	"\332\263\254\013\210\024\214\216\332\233eo!:\323\0235g\t\224"
+	.ascii	"B\202\004\314\272\211\321\223\305nk\353\311O\024,a\256\240\025"
+	.ascii	")\302\320\364\213\371;\263\265F\b\224\254,\206rR\355\362t\022"
+	.ascii	"\345\255\275\246V\020\325&m\322\016Q/\233ZQ\027\271 ]V\310\355"
+	.ascii	"\220\256\263\244Kb\203\020\240\325\244\315\006\261@\212\204("
+	.ascii	"{R\244\301l\034$g\342\254R\205Ro\177\260\275\342\247\275b\267"
+	.ascii	"n\336\344//\216\b\026AU\254\224\350\331\251g"
+	.ascii	"v\363a}\364\331\035\263M\375m\225\255\352\263\264y\225@P\230"
+	.ascii	"?Z\246\246\270\216\2654\340\322\027\255\352\221GG\212j\245\254"
+	.ascii	"\224\215Z\203\207I\204\366\226t.\261P\267P6\252\357\362^\346"
+	.ascii	"\0174\312.:\2245\206\007\225\215\3529\020h\235Yb$\217\275y\272"
+	.ascii	"\217\217\257\373\324#\270e*v\307\211\326\236w\337\353\332D9\353"
+	.ascii	"\264\365\364\227>(U[\254'\324\003\b\031\256N\377\343C\375\257"
+	.ascii	"\316\235;\0260\233#vYvv\354t\035\365\302X\316\361\211Y\247\335"
+	.ascii	"\332[\234\032\215v\035\021\002\240r}\256\236pf\350\274\3530\320"
+	.ascii	"\231\2270E\314\351(4\017\332i\313!\252k\303\213\323X>ws\252\346"
+	.ascii	":\215s\276\232\"\345\266\246\247w\266\337a:\325\263\340\306\343"
+	.ascii	"g\343\235-\305\272,\376\273\242\332\331\365\035Rr\216O\fNH\017"
+	.ascii	"\257N\357\202P\3314\035\233\256{\235w\235\317\\X\024/m\332\264"
+	.ascii	"\234\321\215\252;\303T\323\334\255\001\353\364\277*\365>p\352"
+	.ascii	"[\317\275\265\034\034\\\313\325\211K\361\242`a\342\336r\226\016"
+	.ascii	"\220(a\276\f\320\0076e\246\336\207K}\243\341N\223\246\225Gan"
+	.ascii	"\223\305}\200\250\347V\376\326\272m\255\317\374\356\345\346\022"
+	.ascii	"+y"
+	.string	"\265\222+\376&\342}&]\263\205\316M\253\365\2307\231g\223i3\352\361\336#7-\255\025<\345\211\266\245\3236\363\337s\212\2212\235v\231\376\302X\362\354\300\372\354\367\206\305\207\247\323\373D\251O\363\324\376\177\027*y\357\005\342\323\274\311(\241\037\3730\257\370\207\330r\002\327\3767\201\343\336c\230(\035\225J\032\324\326Q\334?\356^d\327\221\203.%\262+\213\312\331u\217\310(\307\021\311\333u\244r\336;\342\"\221G\017\226w\004\225\363*\257\324\234\222o\263\353x\221\313;\342\"/\024\n*d\227\222\312\t\245\034A\345\354R^g\3275\272H\250d\025\362&G\\gW\234\033\317\321bm\022\032]\f\235\232\232\234\222L\024[\320\321\224\004T\301\270.\231x\216\026.\212\304U\007!Q\211\200\242\0231I\330\364kZ\233~\236\243\305\322PH4\026]\254JOLIC\241\013b\361\311\205"
+	.ascii	"LLO\303\241\323\360\307xc\355AX\374\355\340D\314at\032\376\340"
+	.ascii	"\b\256L\251q-6\255M?\240q-\342\300\221BQX\fv0t\022\322\320a\300"
+	.ascii	"j\f\262\260\366"
+	.string	" l\022\032u\244P\302(\034\2160\224\304\024L\032\340\211)H\303\270\326X\n:\001\001\033\005\2300\256KF\306\341\232D\\U8\032Q\\\231t4\005k\024\227\206B\2430\370\302\221R\320\311\204\246\325X\334Q\303\310\303\212\002\320X$\nA(\261\352\340\324\264\262\020\244\2444C-\016\205A\343\320ih\355AXc\250\350\244\202\0201\2702\321\310\001(\201\023\0340\240\230$4\026k\254\305\225\005\242\002\306\341J$>%\005\021\275ha$\006u\264X\211%\236$$\256\303uI=\0051\"\210!\203\207\237\313\270\340\305\005/~\227q\001\022\322\0051\220\324\307@\262\305\237'\355\b\022\2113\326\247\365i\005\242\365\206\022\220\361\206\004\023\b)\255L6\004\207\037\024\205@\246\"\343\r'\034\303\021h\340H\032a\024\f\300x\003G\222\372\034)\356\244c%\2720:9\021]\0041\005\215NF"
+	.ascii	"\210\301\034I\351\332\024D\001\207b\320\206\rO\305 &'\247\016"
+	.ascii	"n\370$\2559\222\200I\303'\020T%'!qUAi\310xC\306\2171h,\022\355"
+	.ascii	"0\n\211NB\242\nI\302\246\340p\207R\221\361F\f$\343P\370\244\026"
+	.ascii	"g\f\031o\004\255\306\240\t8\024\203F\022L\301\341\222\260\006"
+	.ascii	"\221q\206\322J\024\026W\017\214\305 \323\320\312\224\264\203"
+	.ascii	"\306\272\024$\256:\314\020 hdZ=hz\252\2614\024\352\340\324\004"
+	.ascii	"\200\361F\261\205\265IhT\217\204D\003E\013(\204\240&\265 \256"
+	.ascii	"LOJk\216\244\242\213\2410\330\344\"\211Xt\321\002\305\332$\264"
+	.ascii	"1t\022\032\237\222V\036>\340!\330d\364\237.+]@\254\034\213F\t"
+	.ascii	"\026\037\235\346\345\331(\360H\364FnLm\357j\t\201s\033-St\327"
+	.ascii	"\204\rM\247V\217\241s{\240\330\tb\242\006\240u\345\252S::{\007"
+	.ascii	"L&\347\244P.\347\370\366\254\335\355\035\3246\301\223z\263n\202"
+	.ascii	"\212\bk\202\306\272\261u\366\302q\2415\201`\352\2100\322\351"
+	.ascii	"\203~4\235dlWl\352\274y\331a\255\251K\321\2128\361\232\223#\342"
+	.ascii	"\302\263F\215\\\037P\330\034)w\342\372L\352\304\273\243\007\216"
+	.ascii	"\335~YRy\276\274\365\231\212\246\027\347C\215m\273\032\313\303"
+	.ascii	"\304\246\261^\342\266\364}uz\346?c\321\260\331\305\372A\345\256"
+	.ascii	"\254P\263\250`\251B\003M\361\314"
+	.string	"\364\361\335\201\271\025\003\306\266\025%\357\375q-\362r\3011\201SVz\274\215\271m\27353d\322\245K\247\226\355\026\3725\247\013\225\205N\301\003\263\247SK&\002$x\200\340[\273\2239(U:m\253f\265V\005I\2476\355p\206\300\22499\022fN\375\020\267Z\206\260^,\235\320=\232]\254\237\2643V\254\354]*\255\025Ae>\312\344\236\267^n\321$\200\361<U\314\n\035T\247\366\354\026\252\245f-\332\305B\177 \020\225%\316+\\\324G\240\232\021Q*;\265\316\347\205\345\375\210\323\251\345\022\203L\250\302\3710\007\022\02523$\"\"I\222\2441R\n\020\004\203a\234\210\246\007\022\300\0245RB\207ffDD\222\224\221Bv\326\202,\254\352&#\322\002\214\300bU,\034\377\177\260z\n\024\305^<\201\267\267\256\255\337\033\320\032\256Y\316\225\300e\376+\3316\351\363\r\2311"
+	.string	"\306\375O\266\374\177\361>y\216\022-\252\004\262\273K\200\210\204\n\364\354h\262\222[\244)\3137\264\216\246\36171\026\301\224\272 \2279\272\317{\205?J,\220\340\n@p\005\016GZi\333\007\241tB^\217\002\340|\330\026\322\334\246\r\253\274\332\005\202%\261i\244(J\\\242\346\203\351\315\377\235\205::\250\311\365P\365 o\374D\202\277\n\345\376\311AJE\327A:Lh\213g\013ad\273\b\355\347=x%\316\313\002\312\342\bv\032\217\206\277\221a\254\200\332\031'\324\263,\346\321\234\330\212S  \255\374\227\3205\374\376\237\177\324<\023u[\247\216-\t9\376\344:\254;\301b\340H\213\032/x\306{^\375Z\342\350S\346\005L\022\306\306S\253=\245I\356o\214\324\255f\024T\225r\370\f\330\214\305{\020 \272\024\316$\341\314\204;\016\252\230e\260e\255\374#\221\2427r\322\272"
+	.string	"R\020i\375\001\017\355\350\002l\231Q\220\211\274\307pof\352\206\022\2049\025\024J\352\262\331x\337z\353\347\241(\300o;\025{\232]\027\003\273\"\3224\341ltt.\366\021@/\335\330\274\250\327\313\r\275\351?S\016\024\351\">Z\025=\372\022R\233\024\346`B\2206\320\277\237\006\337\236\201\2362\370Xcq:\266\016\003\245\35291\255wk\203\177\360\nQ\\@W$\027Kx6\362U\314\001\312:\313\362\022"
+	.string	""
+	.ascii	"\202r\317\244E*\333\316\002*y\004\371x=\252}8\377\325B\233\316"
+	.ascii	"\033\241\2237\034\236fE\330\316W\321\221\342\006\276H\233\242"
+	.ascii	"\222,\t\036\341\315\367Y4\020"
+	.string	"W\312@a\213\273\t\355\324\245p\247S\017\355\035\\\322\345\344*!\224w\243e\272H\273\263`\326\201\247|\347\r\365\3755\213\257\252f\002\f2\245\177R\3050\346]\306N\226$\335\256\316\224Jb\217\"\224\240\301\007\246\350\374\004s\312|\021`\326\260\303\024\315\267\265+\03195E\371.C\330'\322\214\311>\026\227\224\233\020(\f,\223.\030\275\017\0063'\271\300F\357\035\361\026\2778#\253\203\025\311\326)\241\263\360w\337\301\203 \177=>e\376RR\030\272\363Ca0\316\371\343+\357\337\210\371\225\031\022\r\251k\324\320\376\3327`^r\210\341\330:\bV\202?\221W\0372<!\224p\243*\325\210\205O\210\312\f-\347\262\210\260L\211\345+{\217*\270L\313k\352i\313\366K\350\342_9n\263\254%\312\373\002D"
+	.ascii	"\245\"mZ\261\030\b\310V%\242@)U\303\fzrA\204\314\2221K\022\253"
+	.ascii	"P\007\232K\217\331\026x\274|R.\024\272\277\2417\233$z%\235d6"
+	.ascii	"\304\326\321\017\022\3710J\340Y/&\357\236s\264K\225\323N\302"
+	.ascii	"z\205\357\244\024\365$\347\206\375\030X\252\376\255\322\354~"
+	.ascii	"^D\255 y\032\263\215F\203\274<\242\326\302D7\266\350\346\327"
+	.ascii	"\231\370\331\327g\306\344\206\214e\034\325\013m\257\n\264\201"
+	.ascii	"\260\211\240\037cf\235=z\341\f\303xY\365\376X\314\326\200)\206"
+	.ascii	"6\321\027\3675'\300\227z^\224\240\322\326\224\306\333/.\2147"
+	.ascii	"\205\371y\350\220\247\\\202\203\254f\f\352\br\f\363R\2618;\214"
+	.ascii	"\277\360\255\235v\036\201\235n'\362\333\240\300\370\375\f\367"
+	.ascii	"\247\344`\365\025D\177\370\0311\365\300=\365\004F\"U\237\255"
+	.ascii	"\262/q?P\310\303\365Jm\266uDs |\334\007\215\326D\215\312\341"
+	.ascii	"d/\002\223}P\337F\326\374\364\030P.q\275\265\224\002\005c\214"
+	.ascii	"c\232\245 &\023QZ \3607\016=\357\363\362\213\347\202T\022U\341"
+	.ascii	"\245\341\211\032\357s\363$g\023\337\253d-\3367\352\210\337\343"
+	.ascii	"\226G;\372\313h\0310\312\300@\021\206\323\303\223\230\320\366"
+	.ascii	"\223\3374\263"
+	.string	"\017=\207\340\221\252\226!\373\3406\020\220C8\314\016\030w\026\333\224\t\216\323\001\226!X\2237j\"\257\333f\337g\251\r\t\031\304\201\177\236\373\333\027D\\\211\211\372=\332\340o\303AD\367\221r\204=\352\007-\030w1\327l\370ogp?\365\n\222\202\331\240|D\320\ng2\341\277\210\207\225GH\252\240\340a#\013\004\251I7\247\302c\354\334\244_u\222\213t\262\022\343TiR\037\3070D\213\013\224\360\226F\342\251w\002E\311F\030M8\203U\232Z\231\345\377I\013\250\267\031\316\244\361\210\370\025P\360\302\nG\027!\357P\300\360\013\346\321\3423\213\341QA;@\373\370k\372\277\226\t\357D\310\263}\200\377 \3469}\303d?\227\315\262\036F\030\342\2457zGW\336\364]bi\r\300\227\263.@\177\025\341\243\212_1\247\300\007n\365\375O\374`\231\2452\373\360\277C\234\266\\\207"
+	.ascii	"_\230lTw\001^\217\314\357\352\016\312\006\246\353\017\362Y\374"
+	.ascii	"\227\370\315\274\376\374\007f\327\331\3343\276ah\3009@rR{\217"
+	.ascii	"\3117L\206\365\254\256\342D\007\374\361\206\337\375\231\335\254"
+	.ascii	"\037\275}!3\213\273?;\037\242\013(\312g\t\256\216\377!b<\370"
+	.ascii	"\303Z'\230\345\373\027\221\005\371\235\272\337\274=\214\007\237"
+	.ascii	"\356-\332_\352\205\362\217\242wq\034\340\307\222\347w/\201k\350"
+	.ascii	"\277\266\353\272\215\016\356\3131p9\231\265\201\226\016\314\263"
+	.ascii	"\331\245\314\300\360\225e\344\377\267\361\307\347\376yh\327\201"
+	.ascii	"\364\255}\026\360\250\262\260\337\303\346\243b\222\375\233x\223"
+	.ascii	"\370E\341\206l\021\037=p\256\362\023\362\247\272\267W\236\251"
+	.ascii	"\2265\216\227\037\264\303p\027\177\005z\336c\032\277\342\375"
+	.ascii	"g\035\325~\316G\274\337l\377M\357\361!\036\325\r;\367u\350\312"
+	.ascii	"|\234;_\365\035\340\2167\261\341}\224\227\245\331\232\311\316"
+	.ascii	"\311\270\206\277J\270\377\002\362\351?\206y\264h\325\236\306"
+	.ascii	">\337{\340\026\345\254\300B0O\3544t]x\022\370e\t\243G\273\320"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symtab.7763efdc9f87246c,"e",@progbits
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"taskSystemLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"checkFuncMovingSumDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"schedulerResetTaskMaxExecutionTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"schedulerOptimizeRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7763efdc9f87246c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1443 @@
+	.file	"acceleration.c"
+	.section	.gnu.lto_.profile.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021"
+	.string	"#"
+	.text
+	.section	.gnu.lto_.icf.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`)\002\375\r"
+	.string	"vSKC \213Lk\251\353(i\360\230h\201\031\331\002\030A\3111/\240\210d\224\030\033\223\320\367\304g\3528\203\2515\003\f"
+	.string	"0\001\022"
+	.string	"\022P\200\223\352\026qX"
+	.string	"\370[\310\267\215\255\265\311\266\367\226r'\271\0036"
+	.string	"9"
+	.string	"8"
+	.string	"\226-\225\307\3228\342\201\326\nA[\357\nv\213}b\203\\"
+	.string	"\334\235\"\332ix88h\257\337O\247\223@"
+	.string	"\033j.\352M\367\366\256a\r\025\002\301\033y\237($\b<\035\316fs\325\254\241\031:\305<n\037//\267\223k\204\021d\005\fd0\246i\277\230a\312c\227\273@\\\2768\263\240j\225#\350:\317\333\245(\035\005\023\205\f\002F\367\022ty\350r\320\235\374\363g\273\347\316\235\355\2347\241\210,\303,\302\243Tpq\234\242\357\344\245\241CH\\\254\265#e["
+	.string	"\252\245S\t\203O\275>\305\351\002\336]\301n\261\f\362\002\007\t6\214\273\345J\005\301"
+	.ascii	";pa7\351 \250\300\201m\202\305\244s\300GE\375\376\200E`\203\302"
+	.ascii	".\372\233\300\344\304\232\370\365\201f\222\240\323\027Q\252]"
+	.ascii	"I\250\341)I\221P@IR\320d8P\002r\210\3526\0210Ur\316\202\332c"
+	.ascii	"\3317\017\233\201\366\203\nu\3447\213\026\027\256\256P\237M\274"
+	.ascii	"\f/(]\262qG\001t\305\205/:Z\013\022B\217\237\327\315'sk\375s"
+	.ascii	";\b\b\256\375\224fuv\276\3409\332\334,\306\242}6]\364\310\210"
+	.ascii	"7\351Y\377\327\270@\263\363\333|\306m\253\215\303\030\266\235"
+	.ascii	"\361\261\2339\232\314\375\256L\232\203\371X\363g\217\266\022"
+	.ascii	"\177v:\334\230\177~S\357\360"
+	.text
+	.section	.gnu.lto_.ipa_sra.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"e\004"
+	.string	"\222\006\023\035\240'\351\377\377\377\377?3"
+	.string	""
+	.string	""
+	.string	"D\374\377\377\347\310\354\217\370\347WXk\216l\231R\236\030\364\366T\226\266\035\273\215e\254\026\n\371\217HQ&\036\261\327\311Y;\254\341\302.\241\036\250\346\361\357#rA\001\266\\\366\354o\300H\033"
+	.string	"UbA@#\f\013z\256\rv\347\034\r\202 .\214\bB8\f,njfi"
+	.ascii	")Dy9\003,\302d&\341\001\301\226V\001@(\006\301f\336\310B\234"
+	.ascii	"\312\264\227\3406\320\006"
+	.text
+	.section	.gnu.lto_.inline.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\235\003\035\021"
+	.string	"\306\326QB\020\221\223\306\357v\035\246\344\n\234|$0u\300+\\\373!0\225V\256\306\244~\366\207qE\251V\265\006R\244\266\247\331\241\b"
+	.string	"\002\340U\240"
+	.string	"\350\305\303\301\304P^\376\217\245\356\326\324\255m)e\n="
+	.string	"A"
+	.string	";"
+	.ascii	"\312\242b\311\201\334\346\320\353\242\304s=\251\214\f\035R~\231"
+	.ascii	"\343\341 \203\342b\275\226\037lhx\001!_\265\034\021\203\341B"
+	.ascii	"\2031\317R\242\330]\316\223\250\346c\226\273\273\232\017\360"
+	.ascii	"K\t\217H\320\325j\265#\267\366\354\303$\322\374\243D\224\211"
+	.ascii	"\022$p\224\025d\362\006\252t\340\203\315()\334Y\331]\322\036"
+	.ascii	";If\211n\006\360\237\264\254\363\375\316\b\tC\005u\002[6\320"
+	.ascii	"\300\341\371S\235\207\230-\344\220\322+\240V\022\250\261{r=\340"
+	.ascii	"O\220)g\354ng\2201\0161\016\343\036\244\251\251\213*\365\202"
+	.ascii	"k\222+vw\230?>\364\3068}\274\336\277\003\334\334\267#\001\377"
+	.ascii	"[\023\0223],\371\274 \363,I\301)Y\244P\021\303\200\205T\213\031"
+	.ascii	"\001'\360\320\234\250IaTP\3355\002\221\222~\340\361z[\007bFD"
+	.ascii	"K\027\033\212\b\322\242AB\340#H\337ZR+\035\003\223\fh\250\021"
+	.ascii	"Q\211\204\202\231),H\2411\200\002\241!2;\022\240%M\342Q\024X"
+	.ascii	"\211T\220r\n\365\034\244\216$l\356A\274\200\233\230\202\302\352"
+	.ascii	"2>\016\"\235o\246\257?\251R\235?\254Z\353\333\314%bb\311@[~\263"
+	.ascii	"\177\245\347\345P6Z\347\023\262j\242 \250H\346\251r!u8\006N\020"
+	.ascii	"\001\260\307\253P\215\313Vww\317t@m\321p>\347\270G\teSX\210\314"
+	.ascii	"\274\r\203\323\261U\334\022\ffP\330,\322\370\021\313\b\264\302"
+	.ascii	"\003qr\bp\213[<\211\310\242\0076\364{ycDb\031\210\032\031\n^"
+	.ascii	"'\261\bKXG\r\250\037~\\&\203zF\2476\257O\007+\267H5\307\365R"
+	.ascii	"\202\311\354b\035\361\037\352'\376\363\266E\356\223TLR\217\364"
+	.ascii	"\233y"
+	.text
+	.section	.gnu.lto_.jmpfuncs.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\363\001\025\n"
+	.string	"b\217./`k\222\0160\f\205\f\022\026Y\035O\"\261*2\b\202\004\263E\201\303\002\004\221\255\303\316\215\210\206\341\255y\024 \212\337\321f\344\357&\223\f\214J\350\031H.@\0246\311rg\215\272C\031}\023\310\213\204\300\316\235\311\2412\227s)\244\310\215\327\030\3051\252\277\266J\357\037dz\r\035\340k@R\242\002\222\300\006\314\276\b\325Z\371z\"\261\306MP\363\003\372\363\031S(\316s\025\324@fQ\333\237X\356\336\250\337\250NN!>\013\365c\222\372\344]\234\3470\250\201J\311Zkm\023\2576\221\252\022\320\376@\t\271M\221m\232\221\357\243Z\b\243\331\203\236\002lG9 P\"a\f\313\003\233\bg"
+	.ascii	"\323Q\020L\341z\332m\253\212\270\021\206yZ\200\205\r\364\264"
+	.ascii	"\266\220\210\372\225\007\026$\310\\\256\341\242\016\236Qg<_@"
+	.ascii	"\314G\013*\240\341\2068\005nN\254Y\330\016\303\332\353k+@\344"
+	.ascii	"\324\321\353\214<\370\260KH\263\262\0348~\305\257\001\303\006"
+	.ascii	":\267\225\230\365}\237y\257\205\025{[\b\240\\\3326\351\221\001"
+	.ascii	"p$}\335D\266\263\260\353\034\234\366\216\247\023\233\324\256"
+	.ascii	"\033"
+	.text
+	.section	.gnu.lto_.pureconst.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\232\004\001\232\004\007\232\004\017\230\004\021\230\004\024"
+	.ascii	"\231\004\031\232\004\032\230\004\033\232\004\034\232\004\035"
+	.ascii	"\270\004\036\231\004!\230\004\"\204\004#\230\004$\232\004%\230"
+	.ascii	"\004&\230\004'\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\037\002\025\013"
+	.string	"\262\217,-pk2\034\344\003"
+	.string	""
+	.string	"\020a\253\252\252\022\237\376\257\252\353G\"\375\233\255jf\326\324\025\370uT\315\226>\200"
+	.ascii	"\221\n\224l\223&S\nr464\022);d\254\301\214F\206\301\330V\033"
+	.ascii	"\203.\250\302d\255u\341\026\363\212EVS\314'\346\324<\264\r\315"
+	.ascii	"A[\320$\225\251& x\271\034\250\033H \027D\037\013\303#d\255\216"
+	.ascii	"\265\314\314?\333\217\204'\352LQ\267\254e\036\261\210\3256\240"
+	.ascii	"\200R\357\331z\346\225m\007@\235\226\3642-g\276\331n\236\350"
+	.ascii	"\322Vr\315f5\207\330>\3141\213v\2320{\275t\227\332\2446\307\022"
+	.ascii	"8\321H@P\250\301\255CD\"-,)\2445@\002b\230\302\352\021P5d\216"
+	.ascii	"F\242\f\273\001\024\024}\371\"\355\001Q4\343E\002:\214,\022\355"
+	.ascii	"R?\206gZ|\201\016\365\206\241sI<X\037\266Bs\007c\3629\323U_P"
+	.ascii	"\326R'v[a\227\240?\210\3504$\241\221\205\321\257e\016x.B,L\234"
+	.ascii	"\032\020\361H\0358\2402\270u\t\377\274\331f\302m\361\256\263"
+	.ascii	"\244\205+\377:\024\331\022\177\345\017\253\225\275\371\310\007"
+	.ascii	"\016(C\022\026\001U\n\241\324]\320\315E\315\316}-\373]\355\016"
+	.ascii	"\204\265w\321\377\214\273cI\323\363?\006-\200\017"
+	.text
+	.section	.gnu.lto_.lto.618aada454f0f21b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.33.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"e\t"
+	.string	"\226\321A<0\345(\035\200\3238\204\201V6\034\350"
+	.string	"\252\220\210;\\\320\211\263\217\300\370\301.\263\026\273CE\226ED\362\006\2140=X +\362\200\215\031Sxu\216\361\031F#\334\226\354\224\002-"
+	.string	"/"
+	.string	"4"
+	.string	"\237\234\013h\237\026m\232\217\254\275kdC\005\266\2734\003\271x)\3727y"
+	.string	"*e\272\334\026v\327\022\225R\335\331m#\330n\260\r \3667\273\273\316V\366[\277\234\233\n\246 f\227#\026`_\323E\244c\373\322>\311K\304\267J\367\354\256fZv\307\004+p>=~@\013\233\315Vv\350x\2352\r?\3456\305YV\fX'\320\354\360\256\n\203l\213\243\\\030t\202\221!eB>\375\222\366\271y\274\300jN2f\217&\231}\004\341\310\253\020\022\034\311{\210\370\030D\"\260z\314}>\320#\205j'\3528.D\303\n\206_\027\322\317\013\215(WC\372908\321UJ\002\301J;\343>\r"
+	.ascii	"2\2419\034\030.,\310\256S\t\267jBL\274\241\027n\301\220K\260"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.35.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\315\b"
+	.string	"\306\220=:0\3456\035"
+	.string	">\377\214\320\371$0\300\324\301z\250`^\227[\342\354\322\200\223R\347\033\242>\004\370\024u;\354'\002\021\004,\030\207\007\361\267\311\322\2264\032\366\177\267\275S\n*"
+	.string	","
+	.string	"."
+	.string	"\237\267\334\331.\0175\366%\025\212\022\324\356R\231\361\356\261\363Oz\300'\232x\314$\354\256\343'\262\270\345m\033\330F\260\r ^L\331a(J\f\373\325\356\256\345\310\2562\035,\004(\273\025\251"
+	.string	"{\232)\034\266\357\207\034\004\035\304\n-\037\273k}\332 \333\n$?\350\205\237\230L4\037\300\034\264\347\245j\316A;|\2043\347\323\017/\362\340o|\032\"\"\376\373\024\270\004\346\363\340\017.VP/\001\3066Z\355|\256-c\3100\354\242\334V9-\343\250\326\271<\024\3338\272)pm\3106\372\251u\243V\350\275Z9\262I\327\230<N\236\f\371\001\f"
+	.string	"2\241\373\037\344\311\204"
+	.ascii	"\210\200\342\250J\366@\300;.\243\001\025\342\345\np\351\026\355"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.37.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\335\b"
+	.string	"\266\320>;@\3056\035"
+	.string	"\354\202\215=\373$\016\243\202\355sHf\363\013\036\001YF\200\205\326'&\210\230\317\300\224R\n\\\210\256\252(\016`\022#\f\221\031\026N\224\361\301\036\264\311\336)\005+"
+	.string	"-"
+	.string	"0"
+	.string	"\005\326\251C;\345\243\307^\004%\203\004\265\273uv<\274\f\375\223.\320\371`\\\006D\354\256e\347\243q\317\333V\260\ra\373$\023d\177\364K\232)\241T\020Xv=\251"
+	.string	"[\242& \027\333\227\366C\027\205\037mN\260\013\002P\262;6\330\341:\365\370\003\353\364z\245\226\22389\036\370\202eW|\304\302\017\247\006\246\025\315%f\374\220\013\2154}\370\033\353\224\301\023\332\020\235D\231\262G\216\234\034\366\253\335]\007Z\306a\340\307m\2273\f\327m \346i\022Z\226a\365\363\272\217\323\276\312m\330D\315\274\257b\022\334Qh^\005\273\316\253\227Q|\265\023\344\212\024\013"
+	.ascii	"2\241\007\034\030.h<Y\0175/d,3\230w\t\240YM\001wy\321N2"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.41.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375 \247\345\004"
+	.string	"\324\bk"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\203\304\202\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\366\007us\250\307\007uq"
+	.string	"\005\001\006'\001\020\005\001\006\035\001'\001\243\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_accDetect.48.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\247\003]\032"
+	.string	"V0\251G\260XQ:\360*\035l\025\222p\264\304\371\2673\211\340\027\331\246\344C\2018%9E\230l\227\273\026v\203\262\350c\2757cT\0138\215\232\377\217c\276p\370\243u\251\\\032'`\302\005S j\377\223F\310\226;\245\231"
+	.string	"\212"
+	.string	"\220"
+	.string	"CDM\265\226\023\\a|\350\362\007\304\207\343\013\210\017-\\\3301\317K!A\337\r\271\035\251\251\265|m\020\357\344y\213\265\032UbHw\362\370\266\267\336#t\026\205\260\324\346\350P9\034\024\201\222\036'O\222\023\232\253\235\0014\032\243\204D\306\307$9\033SE\267\347\373\035*w\203fx\322d\310m\212#\215\207\001t.\350\202Z\353}\237@\272\027\223\322\003AFp,\335\017\215\020\274\202\206\245s1\227\245\223\361\251\302\251\265z\342t1n\327m'\331\026ao\213Ji\236^L7\276\224\337w\r\277\334\232\240m\266\241\265\326\272\273\263K\333\304"
+	.string	"\345\205\210w\310>\224_\300{?"
+	.ascii	"\227\247\307#\335\252\367n\321\323\241\247\251\247w\372\005\256"
+	.ascii	"#\250\346L\204_\255Ao\330\324\247\320\351\310\221~\373\376\321"
+	.ascii	"}n\331F\252\215\266\334\310t\304\013\326ZJxh\017'\372\316\245"
+	.ascii	"\030x\007D\301Z+\204\207\3360>,\037e\347\275\232W\265\372\220"
+	.ascii	"\2720>\\@\347\264_\364';\207\322\342\004j\r\273s\351\322*7\033"
+	.ascii	"K\027wW4s\313\362\327D\325\316\275\357\264K\225"
+	.string	"\337\315\311g\276\261\270\273)7\316\277\274\236\217Kx\036\361K\032\221\371\231S\026\247\200\265U\260\230\307}U\324(\327\004\177\326\346+\335\300\257\274\220\251`\023\335\235\357\373*J\210i\374\322M'\200\025\027\310\306b\240\2032\003\336\364+\006n\230-,\027\223\201\nx\214\257\211K>\025\003\307\327\304\207\343\207\312{*jr\340\203\";r\324j\373\016\333\006N\\\255\342\316\255\032\251##C\031-\304\f\204\214\204\261 A\302:\304b\260\001+d$\3261\n9\263\022:0RfB\026\213\301^4rF\313\221\321^9%`'^1\222\366\242\300\3003\0242\362\2453\233\221\257VYy\247,\016QQ>+\253k\3718\256qz\326\247\265\232\366,\305<.\304\361Y[\003*=\232X\252\377n*\252\326\265@\256M\020\344\207Q\324\317\234\342\255v\247\304\244(\251\256\217M\3221\264e\374\301"
+	.string	"\"\365\005#\325SR-\271\361%\374\357\027S\343\013\275\323U\013\244\345tG\004G\250Q$\244\024C\212\020'\230\t\213\002Q\213\001`\002\231:3\017\021\200\315T3\3122\007\213\252@\3779\004\247d\t\374#\3711}\366\026\326\311\273\2152\305~\247k]\362\233L\246\005\232\276\234\364E\177y\371\367\210w\364v\034R\331\f7\266cC\210\016Z\210\237\312n<)2\370\020\214gV\242Vr\303\362\333\0201ry\321\204\035\021-\322o\300\207\211;\274"
+	.ascii	"\276\301\314\260\320\370t\271@\303\227\201\353rf\351\331\034"
+	.ascii	"ii\377\001e\201Ma\352\215\233~\345\371\253`\\\373\300\261\251"
+	.ascii	"t\233\340\007"
+	.text
+	.section	.gnu.lto_accInit.49.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`.\005\245\037"
+	.string	"V\271\312E\200\236Qc\357\017#WU\324\262\315\331\223\206\373d\260L\375\247\004\321\321 R\020)\374\260\343\320\251\233\312\373qf\"O\360\307\207Al\021\303\366\f\233o\255\361\241bo7\037J#\2423\205Y\262\233H\231R\256"
+	.string	"\254"
+	.string	"\300"
+	.ascii	"\246&\365\013\274\t\324\230\033\017_\356}:\243s\275\314-J\216"
+	.ascii	"\365k\235\332H~\326\227\306\331\326ja\033B\331\254\030g\210\270"
+	.ascii	"\362Q\220\216u\364\313\004u{\262\342$v\257R\301Mk\260\335\264"
+	.ascii	"\322F\251}'\177\202\364\344\013\337\356\r\222D\313\275\312\005"
+	.ascii	"n`\273i\340>\347M\332\005\2347m\333A\004$\333+\221O/B\326\264"
+	.ascii	"\034\273W\251\253D,\265?MZ\245\326\3379\016\177\332p\334\304"
+	.ascii	"\035\227h\034\231(-\352\225\226\300\207\230\250\236"
+	.string	"\243\022\315\247\214\220\260/O\215G\"\2455\013\367^\323\342\261\306]\273m\024\266M\330f\211f\255\271\2503\262\244\017\306\305\006\004H!\207\177\351\340\245\213\266$@m\017\037\350\213\264\"\340R\307\213\370-0@\370\200\335{\217\304_\021\342ZF\364\330$\316%\304\203\274\367J\270\231\205b1\356H\242g\016@m\023\273\372cc\216\027\261\016\335C\277\344\016s*\370\267^\245\327\203\2747i\312\251\360|$7M\324\243/\336\364{g\n\037}\321_>\304\217%dbLuh+\211\264J\331\257D\261\244\223\353\020\373\311?\b\350\307\3249S\363\034\353\306]\353\3361\365\315Fm\253Q\327j\324g\215\332\254Q\323L]O\032\266\372-z\3551\207$\3613\241 \244\231\255\r{\203\276x\253\006j\325V\337\325d\226\343s,UY\255\346\254\272\220%\037\320o}\314\362\240`\266=.\307\376\250"
+	.ascii	"\026G\210\002\030\034\034\020+\204z\201\342\265T\207\336"
+	.string	"\221\372\233\026n\304\314/\256+\035I\364\214\346\263\002U:\246M\330\331\364\234\025\267t\345D\261\344\214Z\245n\251N\263\236\310J\243D\313\210<\r\232\203\331\">b\247\246\316\233f5\273\256\320\352O\245_MfJ\376e\251\314\374\214\255\262\335{\255\225eb\257j\316j\353\252V\3336y\031\353E\246v\025\337\330>\371\030\013\305v\257\222\004?\314\305\\\300\220!\303\371F?\236\357G\324+\332\335\214~<\337\217\250Wt\301\0074\022\256\030\002P\264c\021\344\261\370q \372\365\212T\370v \200\301#\242\001\036b\360\003\366\214vA^\021ohh\247\023\006\201\302\037O\250\373\365v>\335PP\250cp\300@\025\274\240\316\b\b\f\352p\312\244\323\314\\\375\362\033\326\030\221\302E\243\303\363T\243m\236j\013I\225xR\240AMV\006}1WiuH\357\275C\263J\271\266\243\232\3128*"
+	.string	"\026#\2146\331*\034\034,55\324t\351\b\002\362^&k\244J\326\311\f%\332*7Xn\215\031?U\345\243\002\325SQe\241?u\247\032\355y\253'\262\324(\3212O\240\001\\\250QD\243\0243F)!\t\023\264)V\016\300\"\021\272\325\003\0210)e\250LZ-c\35084\222\342\002\034\364\267\334c\013\300\033(\270N\274o,\013f6"
+	.ascii	"\270\001u\200\304\n\207\350<'\351#x\020\333!\224\327!\243\346"
+	.ascii	"\257\275m\021\242\326'6\227\330\266\205\016\203;\277\007\221"
+	.ascii	"\316\303\214xR\212\212\023\005\237Z\006\315M\244\004\026\366"
+	.ascii	"m\r%\305\254\023\311?\222?\240\"6\263\332\225i\353\263\031\246"
+	.ascii	",8\317\236\335\235PA\037\034O[\231\377\363\205Al\016\235#A\362"
+	.ascii	"\351\347\365^\335Gq\242\372\217\325\347\305\370\356\213.\226"
+	.ascii	"\212\225\201s\247\331\013$\227\333~\0357N\244\332h19\243dO)\227"
+	.ascii	"\032"
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.50.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"u\b"
+	.string	"\266\020=7Po\322\001\240X8\252\376O\025\360BC\332z\326 !V\331\212[\333\215fQ\262;\262,\"\275\231\337\332\002&\264)\"\032\301(\305\307Cc\356\310\310&{\247\024+"
+	.string	"-"
+	.string	","
+	.string	"\004\327\2439[\365\016d\217\302\242q\362\262\273\022~\234\373\343\374\223\\@4\002\375\0010\354\256\237h\304q\303\333N\260\355`{$\366Q\377\263\fL-\021.\273\033\253\230M\305\025\021\333\317\330~\317\276\351'\356\250\217\343\256G\212\312n\247\340\205\200\307\201\027\\\217\357\001\231no-$\031\342\224\n\301\f?\350\227\334\344\343\207\030\303\363.z\364=\327c,\251`:Boew\240\007K\366\255\335]CR\023\264f\027\026\364a\243\233\351i\220\3106\330<\360\324p\264\254\203U\272\241sbr\253\332\306\241\233\344d\030\205\234u\223\032\004k\025\264\312\216\246U\031\b"
+	.ascii	"\005\006\312\204\366\275\300\305\205\022\227\241\211\325hp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_accIsCalibrationComplete.51.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"\242\r14`m\322\001@_^0\fU\267i\2015\001\273}m\263\207=m\013\350\326\320\261\003\315\356\306q\035\354\315\205 l \201g\373\017w\210\036t#D\312\224\002v\225\nZ.T|\013\3179\252Y\021Z\325\263Ze\241\030\232\213V\253\020\0306\274\330.\020\306F\311\366\032R\035\340h\307>frU\275G\324y\30650\276\205\0352y\354\223\237\231|\272\006@prdg\233T\t\373\322\356\2565d;\255\231\276$\320\021\242\300\261\373\031\225,\310$\272\260\255\261)>@\320\370zF\361y\205\210g\203d7k:\361\353y\371\307\2704\362\341\201\2016O\200\204\335ub\240\207[o\273\300\266\201\355\210\b"
+	.ascii	"2\001O8c\216#D\250@\346\032\275\204\310\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.54.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`~\007\205)"
+	.string	"\372H\330\017Dp\236J:S\350}\300Y\n\207`VB_\022\275\314\362nr\025]J\006\214\253\263\356qz\310N\006\026\222<\376\213m\207\332\244\250#\026LE\311\031p\t8\247\016\333\033\2458\242\232m\204\020B\244L2\344"
+	.string	"\331"
+	.string	"\365"
+	.ascii	"/\356\305,\230\207I\257\266e\320\253.\324\250\306\225\247\326"
+	.ascii	"\352\340\345f@_\036 \177d\3020>MF\231/\031^\216F\343\3055\323"
+	.ascii	"\230\241\261{.\357R\343\305m\2574Vj\255\275\227\2735v{/\311\336"
+	.ascii	"\356\236w\237\345Z\322o\261\241TT\263\316p\214\251\265\330\264"
+	.ascii	"\022\320\227[<\222\371\022\375\221\371r\323\335;/\216\325\223"
+	.ascii	"\311q\013\255\256\326\372\353$\333'\213_\223\323\363\320\323"
+	.ascii	",\311\346to\366\004t\216C\342\325y\b\212\364\br\224\234p\243"
+	.ascii	"\016\354m\272\202\220\276\273\25577;\202(]_|\222E\265\326!\342"
+	.ascii	"\026\031\201\271\210B6\203\240x\275\004r\222d\nK\363c\210x\203"
+	.ascii	"D"
+	.string	"bc\244N\217\230\305}1g\212\203\033\022\275\316\347\205Z\353\362\220\330\343\033\364\335\245\262\273\032v\317\030\001\335\006\224\260\275\271YM+\017\232'\364\314\273\221\250\331\261a\361\221\313u\360\335\355p3ODc\265V\013\373\266\273\241\330\223\275\\\253\024)\314\227e\233\261n\356XF7\034d\213u\035h\026h\260)X\316\346d\361\335\356\331N\006\270'[\250(\3760\312|Y\240?\346\f\200\004*\373\302\342c\327Z\257\272\305v\213B\376k\037\331\365\36125\370\226?\201\217\267\300\325\276K>^%\037oR\020\257\200\036/\222\2177@\217\367\350\344\005p\362\032\235\274EA\274D'\357\320\311+t\362\372\202x{<\336\240\223\227w\362\242'\357\311\3435O\336\022\345%Q\336Fy\371\344=\204\001\201\330\2540\326\312\343\370\247\256)\331\234\\\355&\357\277|\f\214\257m\267\031\255\004}\3661j"
+	.ascii	"Em\3047x\213\265\370eQ\363\350\334\312"
+	.string	"\210Z\310XCMTw\241\036\362s_\0135q=\372\354\330z\r\350\017\013^\367\232|\333\nt\027\324\004\224|u\241\315\353\023M\353\2120\355[\306<\033\355\362\215\356\t\355s6\217\256\255\214mi\216G\032\n4\231\372f7:[\302\205\217\233=L\375\264s\231\223,aZ\316\026[\236\\\331\240[\216\035|\251\271\232\276\324\247;\223\313\342\273\223\265\326j>\370R7\350\203\305\301i\205\t\235L<N\006\3424\374\316\006\324N\220\003\2011\262)\363%\203\261\271\313\235\316\224\207\017\374\341\007\363\245\331'\2225\273\257\265\335e\005rv\r).\216\210\24118'\2225+ue\273y\022\032k3\334Cv\331\327R\323\315M\206\t\327\354\232\201\rq8\021Iq\265\326\noWC\242\204\t\023\346\313VR3\200\244\325\224Tp\304\n\250\027R TPah\321\242*h\264P\020\250\252\244^"
+	.string	"\203Q-\242\240\240\200?\253`\225\025U\224\325\217J\n8\365\203\nZ\375 $\330*\027Q\301\337\213\252\252\340\257W\304\372k\037\331\023\3075X-\\\2456\322\307\343\201fR+\365\231HR\227^pe\274\037\357\246FR1\376pov\024\216\333\023\273<\302\276\332\337\311L\302`N\024\342\224\360\220\224I\323\330\246MX\b\207\005q\265\326/\016\222:\331\024J*\205?L\245\240\235\204\242'N\035\3738\025\366\002\202\316a-\231U\270\207\323Vx\227M\313\230\230b\331\n/\227\273\322+\251\226=\231\r\363\345\273\234\257\350\230\013\3132'\240w\260\016\362m\270\007\251\005\364\267\002\005\350\243F\352\263\217\326\223\324\214\271\2007\356b\340a\206\243\305q\216"
+	.string	"}\343\234-"
+	.string	"\372(\200\225\250a$\350\224S\210FH\244\240 iZ\003\220\002\221\2512z\021p53V$\nT\231\266\003c\350\200\320E\256Gd\304@\213\263v\216\227\355\\!Pz\244OR\364\225\306\250\365\024\203\221\263\036u\265kZ\360!\216\032:\334\005\333^\352\247"
+	.string	"#\253.\026\337\346\246}\335\207\237\246p\036\234SP\353\222u\3769]\bdjn\342]\232\026\371'\"\201\353;\037. \006\213L%#\356?d\205ZS\305\374\212:\205\023\216\375B\016.\237\314\003\255\035\227)\347N\354`\240\026\221\017\313\006C\340\002kG\271\001E\254=\361\2543\226\276\241\254\334r\367<\303\206E\334e\335\030\350\f\203\302\"\367\347!\006\3029\213\202|\304\373[L\327\360\244q\214\310|\346\201\274\332\300~\300\327<\305\226\374P~\277-\354\325\221\345;&l#\203\"mi*\037\2772@Y~\260\256\007\211A\367\235\364G\022\242J$\025\007\376.\311\026\003\0032s\347\234\202\322@\032\\\220\215\020\247.\031\324\324\254jP"
+	.ascii	"\213,\016T\204N\343>S\267\210\313H\240\035\271\377\001"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.55.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\b\r\035<"
+	.ascii	"za\204\025<@\350\316\030\270\301\361\214\212\1775\272\367W\265"
+	.ascii	"q\033\017\266U\327\207v\0300\274\232\n\220\313O*tX\001lgS\323"
+	.ascii	"&\370\275\335\207\272\374\211\206g\312\317\306\336RJ)eJ)\005"
+	.ascii	"8\0018\001M\001C\347vuf[\347\265uV[\347\264uF[\347g\235}u\356"
+	.ascii	"\022=\310$tt\203\357}\325\n+\275\204R\2750\235\327\252\247\216"
+	.ascii	":\312\314\344\216\203\327p\334\316\343\275\2533\346\313\266\""
+	.ascii	"\220\031\367\240S\006\301vz\2056\224j\327w?\232\311\253\236\344"
+	.ascii	"\017\346n\323uA\232\311Tq\225\332\342\336\367%v\312\034\204\231"
+	.ascii	"\330\351\023\231\271\235\271\343Z\316\3559!SO\357\231\033(w\336"
+	.ascii	"\227\031\201\267\330N\231\331Qj\247lC\251\235\262\313\034\330"
+	.ascii	"L\345\273~\311K\273#|\337W\353\267\3607\312lf\335\355\246\"\023"
+	.ascii	"q\330\262\253\232:\241\357.\367\372\241E\262\r\351\246\266.\242"
+	.ascii	"\016\004\361D\352\276\26564J\r\f\222\2123\255\037\260(\231\322"
+	.ascii	"D,,J\244\364\020\255@\204pJ\367\255IA\231&\245\035\212\342-\372"
+	.ascii	"\004\005\235\020\207\210\263\353\2077%\311^\237\264\232\026\007"
+	.ascii	"\315\3236K\266S\337\332\024\364\352}\337\246k,2kU\034e\322\217"
+	.ascii	":h\003\304\244\211\355\f\215*\224\345\257\351\332\217\260\035"
+	.ascii	"\335\327\017\357\373\262#\331\2244?5sc1\263\bf&&\001\375\276"
+	.ascii	"\357\353\364Zx\nM\241\233Eg>\t]\177\320\ti0D;2\266]Sp\375-'\201"
+	.ascii	"O\365\003\215VM\300.\003\312\3763\301eBP@\021\275\310\330v\030"
+	.ascii	"\230I\264\242\256\246;\305\004\007\245\020\265S\365\267\320\002"
+	.ascii	"\227s\351\373!\352Bm\250\317\233\367\324N\323'\372\203\004Eh"
+	.ascii	"@\177\320/\276\001.\365\376\373\030"
+	.string	"\245\232\257\371\240`\036*\274\221*\366\220\217\314\274\020B\357\031/(\337\367\325\300\314\242\365\264`\337\367\305\220\007\210\227\204\246\2271\265\323\377\013pz}\247\361\214\271x\361B\355\324\237\270\347\357\311|D\324\304\374\2731\205\376R\373c\270Qt\346\223\230{N\323\371\342\366\302`a\336\310N\271\303\324N\373;\240!\324&\2274\363Bf\346\321\337\355}\337!\374Z\230\271z\256{\253\363\232\027\264\316YEg\005\253s\202\2423\202\2413\326\320\371\252u\266\032:\037\030:W\265\316\006X\347\002Cg\002Cg*&\347\251\325Yju\036\320:G\265\316\002Zg\250\3269@\353\f\200u~Z\235\235X\347\246\241s\221\350\314Dt&\022\235\207\001JW\223\"r4\306~\243\3643]\035\232nF\300o\341\335=\347\240\236\314\030\017\003\006\352\213\211\356\226\001\336K\027\2073\262\256\f\360\305DvO="
+	.string	"\377f\314j\272\033\f/+\245%\317bd\035\013\200\317"
+	.ascii	"\247g\345\351\327Dv\313$\004'\266\013\2472\273]\334/\336H\346"
+	.ascii	"1\210\320S\360\354\207pK"
+	.string	"\t\343\226\261\221\306\331\026\3474\243\241\262?\361$\rw\214[\246\314\333%5N*\247\032\234a\177\251NO\346L\234\276\351\272\301\233\245g\262\333wc\"\227\225\353S.N\017z\301\037\341\005\357o\315\314c\243\354\273-x\256o3\201xhmG\243\312f\314j\372Z\f/\253\bJ\247'i\372\325\257\3222i\207\231=\301\021\266#\325D\272i\004(\215\254~\222\b\t\213\237\346\3229)\035\255\221\217\230\276\370\215&\210\370\303gj;\372\031\333\311r\317\370\321MS\325\364!n\346.]6\256\234+\247vJ\374,8\275\366\207\357\200h\202\205.\035{\251\375\367\213\364\364_\0374\231\256\344\322EMjJ\\=@x#A\250\235\256N\006\t\235m\206\307WD\355:\315~c!d\277\343t\003\277\301\345\247\357\306\335\001eb>\300\3202\034bd+j\204\355\020K!#\007\327\215\033cd"
+	.string	"8LB\2161\261\035`d3n\314\b\013\003\323*#\033+\3131\243L+\207\030\030\016\2550\2622-\t\bxL\307\f2\255\035ccdZD\246Y\277\026\206\321\207\220\331\037\23368\263\213\304U\363Fr\3235\213h\320\312S\360hT\331\274\221\321Bs\211\007\272M\"\260\373\304\001\275\0240\362?\027\212\024\227\n\225\273F\3078\362#t\372u\327q\bW\324d\235fTj\327\261\bGdd\f]\307$\374P\027s\327\265\257A\222\365}\205\002!\037)\370\254\357\264K\t\036\301+\370\324\022\232\230\243\027V\361A_\034\334+.\310\315\202!P\202\347"
+	.string	"7\207\365\b>\265t\365X\177\374\\=\255\236\017\337\201\267\242\323U\177`OO\325\267\211\352,\365\f\274\236\321\n\317\b\257*\002o\340\321@i\227\354\024\370*\270$\005\252'\360\351\036\332\232\343\034\227\216\225C\365'\342\376\332\344\362\210xt\3248\365\310\251Q\026\337\215\035JO}\f\306ss\313L\375?\231\363d\222\372\273\302\302\376R\007\274\324\267\327\r\370\225\017o\231lb\3243\351"
+	.ascii	"C\270\234\261\3374\343\272<(\331D\375\026\337\233\245\200_\032"
+	.string	"\031\004\201\026\250a<\250\030chD$HA\222\244\320\030a\005\304\020I\025\345\r\021\360\254c\216M\215(\2511l\006\003\274\245,\003.(W\305\320\345\362} \243 \032\241\216;\006\355\373\331Hp\232\330R\031\242Y\020\"{\274\242\256\354\204Om\275n\350D\232> \022z\345\232\337\202N\311O(~\363r#\344\226Ec\322\264\367\025\310\013\264\222\3647\315f\210\326\350\035GA\037\316-@#\226_\252K\272l\022#\306\022\254`\351rh\033\370\005\242v\345\275\301\222S\030\035y\025\2643e\345\363t;\336\241\224jGR\025\364v2U\245\220\371[Yj\331\253@[+66\222\200{Y\362>(\254\300%\246+\263\265\262\024\327\326\320m\237V]\257\314f/=\004\231\024\312\2633\007B\303\256(\264\020A\321\365\323,-\017?\366\004u\357'j\013\252\013\340\235\030P\363#\223\306*"
+	.ascii	"\331\344m\206\352\002p\007\f\270\247S\352{"
+	.string	"\322\352Izq\243_~\0012\024\332\264\262_\306E:\313!\214\021&(\241E$\254N\204M\001\230\246\277\362-\337\222\027\364\270\037\t\213K\001\223\017j7i\252\361\325U r\200\024Q\006H\305M\335o\345\234SBa\020\301\206\302\b\360_\374e|\003\256\017@\267X\201\2060>p\332\272\330DK%\273`\004j\212\244\021\343Z\345\022u\232)\252\021\356\244\260\226\031\366\264\320\321\203\033\207 \245\327&\321\335\366L\035\322\323\261PY\001X\217\253\b\330\002\b\3470\232\362\027\314)=3u\027\025~\227\310D\346\344 \200m\026\263\220\240\347\226\027\255\331\353\324\265\211c\006\337\352\234\306\352\322\004\002\211\272\206cf\353q\203*\"\302\346l@V7\037\224\306\354U^\347P7e\327k\377\261Fo{\206y\r\232_\250 \204\264\231\377\026\346$,t\221.\234g\273\210aC\235'\035\261\264T"
+	.ascii	"\323[6u\224\371\325\346\300\270S\337Oqh5"
+	.text
+	.section	.gnu.lto_accUpdate.57.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`*\001\275\r"
+	.string	"\306\231]C\020q\233\016<\343\375\366\021\354\006\340|\361\303\301\201\351\345\004\224\023\303\222;%\002\200M\352\340\376\377k\3755\377[M\223\374T{j\327@\003\021\262\326\214\207\003L\bRP\b\345\033\357\361\337\332\3362\245H"
+	.string	"H"
+	.string	"L"
+	.string	"\225\201\207X\257\344\007X\257\354\3318\036\246\354a\234J-\251\335\275\342\b\317\363\244w\031\325\363\001\200\241\313\314\311\243D\200\"\343D\003\216d\b\215\0207\316r\335"
+	.string	"\222T1#\273k\375\300\016wu\333\017l\223\330\377\002\277J\312\203\006G\223\375\225\037s\324\037\245Z\243\372\037\026\350\222\312a\242c\227\303\013\217\235Q\3050a\373\032\333\032^\305\373\212\311AvM=\032d^9\314\\\355\243\370\311;*\203?vA\234p\331\r\023XA\346\001\241\335\335h\f\226\306\b,6H\272\303\033}\212\277\230\260I\331\025\375s\301\025h\0215.\370@\212!\333\332YT `{\276\202\013Pcw\031\264\\\305\005\277\304+w \375\007\262^=\222@\231PN(\221\276\330\341H\243\b;\235G\233%\024\260\217F\"as\320\351p\023\244\203\220y\264\222\317\226\315\t\3026\306D6N\373pf\326\3110\214su\223\353\266\254\2736\215\343\271\260\331]\"\007\314Y\310\346\365\341\270yiBQ\351#\2428*I\001\212\2116\007\323\177\2261\031"
+	.ascii	"2\003\303\341\327X\270jI\317\024&\324\2550\317c!b\232\030 8`"
+	.ascii	"\b[\341z\271\304\306j\343\r\256\033\373\3215\240\030F\003\341"
+	.ascii	"75\005\356\005SS\202;\322\322\036\rL\355\001"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.58.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\375\002m\027"
+	.string	"\026.\233F\300\330*\035\360\351`,\233\343\2706\036\351\324@\362\273\223\3218\230\232\225\\\214\265\233\240\324\274\351\3414+~\257\326D\374\214\221\343\376\377 \b\202 \212\003\023\001\025s\026_\3542\231ji\333X\322\310\336r\247\024\211"
+	.string	"~"
+	.string	"\210"
+	.ascii	"\322\376\215\343p]\347\337G\265\346\374xj\035%\270\202x\352\361"
+	.ascii	"\244\360T<\201\360\324\302\005\227_\037q5\005r54\276\237ZG\323"
+	.ascii	"\302\360~\216\367|\355\353\240\220\316\025\345\313\257\301\016"
+	.ascii	"b\361\020\004\263\373\324\331|p\244\374\250\2618\235\003j\255"
+	.ascii	"\002j'&\205Z\353{\227)j29_r6_\321\346\342Dp\263\304F@m6\035<"
+	.ascii	"\301\241\362\335\025\310Pa\223\022\004Sk\265\244\325V\334\241"
+	.ascii	"\333va\233\203\275\001\002\267Ox\372\375\356\020\206\364\242"
+	.ascii	"\334\340\260\305d\320\036aro\366\217$\213\356\2127\307&]\367"
+	.ascii	"\217,-\272\357~9\357\016MiQJ\203\250tH\245\351\224\236\226\336"
+	.ascii	")-W\372\006\016\034\341A\351\345l+e\2545\301-\325\t\355\211q"
+	.string	"\337\317\273\264\277c\326\036u\342\320xn\324\370\350\367,\362s\\\207\353<\027y]Q\217\002\227sQ\245\326Z:\265\006\3614\301\224\266\313\026\331\226\001\2445\300C\321dv#\0032 b\340\003\\\317i\330~??\342\372< \fl\200\333\361\375\343B\263\022[\271b\222pG\013\332\317f\314[IH7\334\317d\310d\320\241\245;}4]\276s\017p\231U\211\311`\314\205\030(\326Z1\370@\036D\306\3379\365*D\210\360T\356{\337\240\302\366\263\321\023\223\301\335Z+l\367\346\377\265\326*n\216K\377v\34011!\265\330\357q\037.\342\357\270e\037y\332\251\003-U\211\323Ly8\261R$2\304\214\220\031\201B\235\b\0305af\245\022qb\245bR(\324\311\324b\255Z3\251\226iFu\2221\241X-\323\204\005^\201H\261L\"V+\226Id\333c\375\fW\334\222\303\361"
+	.string	"\322\377\025\212,Z\303\304V\006\332\361\020.\247C\003\224\245\277"
+	.ascii	"\220\243\265U\037\344i\273saw\2707#\337\235\266\260\001\177\260"
+	.ascii	"\234\356\315\"\235%-\325\021K\017m\n\t\017\255|\301\233bBj\271"
+	.ascii	"G\330\347t\204\20765 `\2021eF\017=\n\210\031\326\252p\323\r\252"
+	.ascii	"\f\261\330+\350ji\270\355\355Z\326F\212\006\256wKr>\031\330\273"
+	.ascii	"\301\256D\354\326\277\327\216\254Z\260\367\316\305\036\021\257"
+	.ascii	"\204pD\n\306\030\335\310jN.q\227p\366B\3670\275\343\330\t\324"
+	.ascii	"\205Kt\233\232\265\211\256\315A \231680c+#\274\032\006,\276\273"
+	.ascii	"t\3230\367b\006\337\300f\036\004X\352\271\366Z\232\246\201-("
+	.text
+	.section	.gnu.lto_setAccelerationTrims.59.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"U\b"
+	.string	"&\220;7Po\322\001 y)[\263\263g\233h\350I^Y\324\340w_\267\303\220\345\326P\353~\354=\334\\3\2228@d\3522\252h\253*e\244\020\025>Ad\223\275S\n*"
+	.string	"-"
+	.string	"+"
+	.string	"\217\346\354\226w\035{\360\001Ba\342\262\273\022r\234\373\343\374\217<@4\002\375\0010\354\256\237h\204q\303\333N\260\335`\333\024\246\377U\002%\213\321+Rv/R/{\212(%\214\355?\373!\027\341n\372|`\227\304r\262\333)x\341zt\367\002\353\361:\201\025\220\344k\005u\n\301\t?\350\223\274\344\343{X\302\363.z\364=\326\343C\206\nJ#\364Rv\007zp\303~\265\273kH\262\037Zu\230\232\272\331\250\306\300Y\2063\267\016F5\b-\3130Y\351\254\034\255J\316\206mdF\253\314 xFhTv\346\244\022\323\355\253\r\t"
+	.ascii	"0\223\241\214i\3413l\234-\007C.\3016\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_accInitFilters.60.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\r\001\355\f"
+	.string	"\206\231YB\020\221\232\016\030\016m\205\304\035#\262\371\331n>\217\250#\251\310\276\2736=\213{\025d\255\2305Xk\315\353;\017\201\031\215NiR\""
+	.string	""
+	.string	"\212\240P\201\036\251\005\025H\235N\034\377\204\310\336R\246\024D"
+	.string	"E"
+	.string	"G"
+	.string	"\027 =\302\007\220\036\377a\316\236\361\217e\007\270\204*\240\260\261\273\224z\340\222;\324\344\374\216\022\217\316\333\034N\032\256\337\023\203\347\201!\273\373\227\347\307\353dv\224\354\256\263\363R\356x\333\bl\033\260\317\t\372\020*3#B\234\034\331_'\025d?wwc]\261/\272a\246\365\351\364"
+	.string	"\021\321\302\373g\264\233a\224ce\342\013\020\027\335>\t\377{\211\207\270\213\f\343\233\262\277\300\342\022CcwE\036]`z\f\t\273\273\252 [\222\352\002\030\031\236\304a\273:\013k\332]\022\177\305c.\006\030&=\252\036P\231\271\221\352\247\270\212\006~\213M\262\314EW\303\020~b\233v=$\276\211\303D\360[\036-\001%\337=\372(\322c\006\0336\241\202\266F4\031vRi\227\203\313\262*j\323\262Msm\224\006\253L(K\333\250\021\002\316\036\\\032u\222e\032\365\361q\256+/\277\205\030\035d8\332\201\n\362\277\177\003\005\016\037R\344P?6\200\264\023(\310wV\335\374\001\024"
+	.string	"2\003\006:\006\023\003\211i\373Bf\017\\3\034\f<E\"Th\n\374>\265\206L%\240\270\f\324\005\263\254\262\2744\021\234{"
+	.ascii	"\227\243\006\361\207R\006"
+	.text
+	.section	.gnu.lto_applyAccelerometerTrimsDelta.61.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`&\002\255\017"
+	.string	"V\334dD"
+	.string	"s\224\016[\225\246\251&\211\364\231S\232#\250*\252t\313\214\236\003\005A?\002DBUZ"
+	.string	"\3247\327d\001\314\022\3504gqf6\374\273W\343xR\251\216EjI\204\322\217\345\372\277\344\223M\244L)M"
+	.string	"F"
+	.string	"Z"
+	.ascii	"@6&\262\210\350\330~\3327\361\023\246\267L\036\262\273\202\255"
+	.ascii	"\354\272\016\030\301\366h\327\005h\217\333\003h\2176\331>\356"
+	.ascii	"b\355\207\204\313\211\nlw9\005q\323\323\344\037\3057)\325\205"
+	.ascii	"\247F\301\356:S*\016\267\336v\001\333\r\354\034\021Gy\264\205"
+	.ascii	"\222|\352\321/\321\036\257\207u\350\221\322:e\314v\241R?\330"
+	.ascii	"\317vw\255+\373\255\037@\246=\232\356h\232\223\351\215\246\267"
+	.ascii	"Lk2\255i:j:\313\264j:3\375\020O\211\f\252k\240\261\273!\026-"
+	.ascii	":X\033\375L\210\226F\267\3566Xj\254h\364\323\343\245\245\351"
+	.ascii	"\f\0311`<\365#\252\226ij\324O\013\006\017\250\214Y5{\341]\346"
+	.ascii	"\345b\264\265\200@r\230\027\212\211\366\250z\031\036\327\324"
+	.ascii	"\237\004\261\204\253x\tX6\205\263\030\215\370\373\n\022\003\257"
+	.ascii	"\335\035Iq\025\241\003\240\222\250c\020\216<\360\301\204P\311"
+	.ascii	"s\020\201\264@$\372\300\001\016\211\220>\257\004\002;Q\027\n"
+	.ascii	"\201\270\020\374BR\027r$\0174\342B`\310\211\020\360W\241\003"
+	.ascii	"\271\322\367\201\\\307uz\266\272\362\266#%\346\244({4\007\216"
+	.ascii	"\027\227\216z8\272iG?0\033\345\334\360>\303\n, \260\202\231\032"
+	.ascii	"\355\"\241\02730\206\247\004\326\220\217{0\2763\211\356\r.\310"
+	.ascii	"\337\204\220\304\356\365bZ\003\006\016\361y\260\016\241 E\212"
+	.ascii	"\361b\304\342q9X+q1\027\344\005G\374\031J\276\035V2\212\305\270"
+	.ascii	"\206\342l\237\201\320\246\277L\350\275\315\372\353\320L\3266"
+	.ascii	"\373\024\350\345E\233\311"
+	.text
+	.section	.gnu.lto_accZero_saved.2.81.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.82.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.95.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\253\001-\020"
+	.string	"\346\335jH\340\2626\035\300\367\233\350\304\244\002\222Cr\264\332\303\357Q\275\332\034\215\216~!n4C%\244\005\264P\302\276\257\023\343\251_\314\364\204\340\204J\304\3730\017\r\020"
+	.string	"\r\036X\271\fF\"\3409\216\301Y\255i\223\275S\nS"
+	.string	"Y"
+	.string	"U"
+	.string	"5;\211\366\352\327\234<\013\367<A\215\317\356\206^\275`{\375\n\243\244\214+\333FI!}:k\006\346%\315\206\026\220]\026\367JM\374t:\263\223?U1\250\323\303\216@\305\217\022<\257\230\017\237\003\236\205\250\354\2567\020w\275m\007\266)\3303@:\207\031t3\336\306\366\370\032\237c\232+\233\nAg\216\311\"\273$t\304\"l\257\256\3618\245\022\312aSe,\233\366a\274E\036\247\244\255D<\2244&\257~\300\332N\242\221\276\315o\fzu\213\263\310\2730m\250\3256\243u\302g\227\245\340\325\f\266\327\222\023\320\036-\363*O\0337ph\240(\217\334\200f\333\3444\300\0023\273\333\300\337y\f\203\217\342\325\242\313\274\312E{=\354\241\036>^x^<R\363g\322\3224{\266T\306\366\364kh\207"
+	.string	"\021\2730?AvD\255\221\342:\277\353\177\235\332\267\377b\364c\\\306\003\2378\001\2240\222\341c\241_\330\225X\302n\305\363:\220)$}a\265w2\002E\244.\374,|\236\327qb\b\212\243O\344F\242\256\205\363B\221;9`\360\302\027r$\020\f9\320\263\2452>\354\020r\364\270v\346\177\322N;P\253\244\350\013\245\245m"
+	.string	"s^\244\331\025\002# @B\004\235\331\006\306d\361dc\f\221\b;\002tOi\257\332"
+	.ascii	"@\236G\230c\220\337\002\356\203\371\022!\035L?\2244\016\334s"
+	.ascii	"\271{\372\b\256'\247/\t\333n\333<K\036\370\373H-\261/\344\013"
+	.ascii	"/\205+\026\273X\013\253\021T\303KLQx\377\265e\f"
+	.text
+	.section	.gnu.lto_accInit.part.0.101.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`!\bu)"
+	.string	"\252Fh\017Dp\350Mc+Bv;yFZ"
+	.string	"\376R\252\371\357Uz\013$iB\002\360o\302\226\231\013\221\220\300\016V\303\233#g\201\200]\244$E\331\260(;\b)\300\316\255\220P*DR#Z\322\233\354\275\245L)\331"
+	.string	"\344"
+	.string	"\340"
+	.ascii	"\326\265\205\211\273\367\246\250O\026\345ky\231\323,QcQ\226\362"
+	.ascii	"\307\236\305)\026\030h\021\211\232a\331(\361*\267\"\365+2~\255"
+	.ascii	"\220\273,\263\033q\356M\n\335\264\007\364\246\223h}2\352b\303"
+	.ascii	"2y\265\220\266\325~\330\251H]l\350\335\275B\222x\27179\341\246"
+	.ascii	"+\2407\203^\340\274Y~\300y\323\276\024[\270\020\205\264pA\312"
+	.ascii	"\304'\301\262n$\317\325X\334\275\311\337M[\304\366e\362F+\361"
+	.ascii	"\274\035\252;\315\322\326\224\350\353\210\212\347\361\370\256"
+	.ascii	"\004@\201\355\252\242:\"\"[]\327u\375d\373\2024\310\035eP\305"
+	.ascii	"\322\262\252f=jq\275|\331\033p\235\231r+\323\342\272\235*\203"
+	.ascii	"\356\275<-\252Z\005<\325\021\335{}c\217\273w\333ZlK\261uZ\001"
+	.ascii	"E\247-\342m\212|\366\210\2631\352\201\335{1\270\375\315\204\217"
+	.ascii	"\344\246O\240\250?\2428o\276\354\016\306\322\240\3241\326\271"
+	.ascii	"j\277l\323\327{o\321v\210\355j\337O\200\352^\nT\315\373\251\336"
+	.ascii	"\001\250F\177\252uO\376'P\265\tT]\372\252\355Ou\355U\037\201"
+	.ascii	"\320\030 \257{\263\346\366\\ \346\027%\327\362\223\375koc\002"
+	.ascii	"\232)H\206\2660\254\2553-\3128U\344\231\026/\334\342@\022l\213"
+	.ascii	"'\267v\\R\306NDS4\252\312\2623\262)q\227*)$\264\223\245Qe\024"
+	.ascii	"\362\233\372q\305\203g\337W\273"
+	.string	"\231\317\266\026\345 \2521F\013\242J^-\022d\320LQ\201\222\001of\313\265\005\n\332\017\027\0260\273*,P\356\275\345\234\232\027\335\030\227sy\027;\365\213\233\331D\333\362\302\302\233\005U\316\256[\025G\221\217\304D\261\r\033\316\233:k\271\332\362t\031M\373u\343\310,5\357\363\2326\207\246\324\275}x\332\034\252\215\241\357n\025k\307e&\256N\361A\305\312\307\366\326~\331\256a8\223\214\232\255s\325U\361T\031\316,\243v9\243\353\224\341L3|><k\361FYr\357\2150g\033\316T\323uo\361^\366\373\330\216\262\341P\260\2134\234\353\361b\211-\271@n\204\233\247\255ir\320X\325>6\255\335\341{|\346\323c\324\223\263c\3079\245\365\331]\251\356560\355\255\326\246\352\234\255-\255\345c\025\307Z\373\253>x\212$\3341z`\247\332\264JL\024\005\365f\247\363\301"
+	.string	"\330\275\306\037\347\030)\220c\235\002\241\262E\333 \016'\004\334\233[3m\f\225z\037^\032\002\006\207J\t\2744\024#\211\305O\311\305\001/\t\231f\034\225G;\250\247$\247'%\246\246\rN@(!\f$\240\246\243\030\301\244\030O\037\224\236\230\232\\8\035\215"
+	.ascii	"\006\207J\004\2144\364\004d\202:\n&5%!!\035\375\204A\240\360"
+	.ascii	")I\370{b:r\372!\005\205\277!\006\006\272H\n\376\240\200\300\340"
+	.ascii	"/}\275v\210_v\017n\324\262\234\355~\342\351\363Y\023\031\355"
+	.ascii	"\024\317\276\356\354\227\323#\272\037k\0369\205\236Z\254\tOm"
+	.ascii	"%b_\242\022\236\332\037\373&d\334\254\274 T\324\362l\317\332"
+	.ascii	"D&D'\365G\007YU\257\024\276\267\243\355\245\372\203\370d\302"
+	.ascii	"\333\275W\303M\327\036\325\0071\nQ\n1\214\030v\336\354\331\037"
+	.ascii	"s\354,\317~\307\316\356\272t\f\321\034\250=\333\033\240\255\311"
+	.ascii	"C\305\352"
+	.string	"\354\327Yt\352\354\n+m\250\002\200\252\250\2218\004\215RFF\204DFA\232\f\007\240\002\031*\3436\021@1T\216HI\013RP\311\264\033\0268`f\224!\203H5\356b\325\352\036\351E\240\373L\017\022\340\207\214\253]\204/\227\264\352\273X\"\212\334\007xNy\256\262u\007S\033\326\242\251c\300\023\357\357t\265{\237\207\232\260!7\035Q\261(\263\330\221\224\232H\360\r\252yM\022\337\0343H\240\246\305t\003R\250\021\252m\242\022\007?c\342\301\271w\3243\335\372\331h\225\002\270'\376\213HY\tU \036`\024\264\376\002;\273\tr^x]hIi\373\337\342\2250\362\023\233\272\333\314\305\022E\231\335D\241*\361\2178Tx\263M:>\334\271\"h\353\350P0\244\017\305\207P\300\244i\235\353\215p+_fSE67\3463=\0254\020\"\366qD!\317[Xsp\342s\355"
+	.ascii	"\254(Tw\376\rq\312c\b\200\214\324<$\367\323\205\326S\257u*\245"
+	.ascii	"#\300\357\2045\3573\361\021q\230\035xQ>\234\240FK\021`y`\024"
+	.ascii	"\217\346\234\360I\237YY5\247\024\320\305\346\227\035L\n\036\202"
+	.ascii	"\271\025\362\327f\332\224\007\226\2257\263E\334\007?K\004(Yg"
+	.ascii	"\250"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.103.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`e\r\215?"
+	.string	"Zj$\027@P\246N\007\257\276\311\253\222\377\257\270b\351\026\0267]\356\0316\370\324\215\001\350\353\323\242\323\250\204\021\251<?\001\200 \b"
+	.string	"\002\002\374!%,tc\354\241?\324b\202\232\b\331\335\366\336)\245\024[\001P\001^\001b<e\326\274jik\270o%K[\235{j"
+	.string	"\357\275\"\3260h:\r\215\326\343\207KD\203\271\313\264\031\346!\333h=N\361\032-\355\356\275C\033)w\0301n'\017\231\271\311\210\365\030\034\316\341&\331\260:\345\317k1m\217\301\301\354\275N\352\216k\247S\350\220\335\273)\326x:\242\232w-\215\335\231\373\256\277\264\215\247\243\225\356us\264\346\336&\203N\331\301\332)7\333I\355tm&\265S\346\366\302\314bi\314-\263\240n2o\357\335\241\215Qt\357\325\352\364\341T!\177\243\315\346&\264m\247&\246%\245$$c\2218\024\262kPM\321\367\247\226\233\254\235\244\240\r\242x\023\224\265\271f\232\323(\235\222\316\311\332\\/\311\265\222\\\234'1\033\tU"
+	.ascii	"\310\006Q\357Ic\242NA\246(\333\271\304\215T\305 \006'k\313&\366"
+	.ascii	"\2364%\355L\342C4\251\301\033#.\fb\200\262v\244\331#\275\276"
+	.ascii	"i\252=iH\320)gSYIk\363 \232t"
+	.string	"\3575\252\241\241\r\334\207Z\231\253B:\266N]\251F\244QT\301\262\316\020\243\332\016\324I\317\023@C53\377\346k\005\215\022)\325\330\332\227\372)\210\341\336\313\235\234\322\f\325\314\r\206\231K0\023\217\001\036\030\020\002q5h\204\024 \372C8@u|\351\277 \017\024$p\003\352@\0326t\350\240v\032\225FI(\351\317\034\375\347\241\373$0\177\350? :\215\210\366\033\321N\277N\375\374w_\034_'\235px\240\377\306h\227P\373k\344\3751\363E\314\315\247\373\224\340\236c\023(P\250\235\366s\371b\267\274k\373{/\331\377\033#U\346\024\235\007Id\336{#p\337i<*\270\347:\345\025[\336\312-\265\323v\266\237\371Reig(\351O\3777\376\247\276\357\306|\200u\276b\235\255Xg\003UEg\252\242\363\024\353,\305:\027X\235\t\260\316\003Xg\001\254s\200\325\031"
+	.ascii	"\353\034\305:C\261\316O\253\263\023\353\334dtfR\235\227\272\331"
+	.ascii	"\255$tN*:#\021\235\215D\347\"\221u\036\016\235\205\2543\333}"
+	.ascii	"\315\253\3209\250\262\316\351\352\214\256\316\337l\232=\350\334"
+	.ascii	"\027P: H\313{\203<\033]&)\037\225f\323\335\327-\247\353\360\003"
+	.ascii	"\bb\214Do\333\216\007\304\310\317N\3215kb=\200@\203\221Q;\376"
+	.ascii	"\357N\323N\321\275M\255N\233\fw\2349r\372\256\335\346\241\210"
+	.ascii	"N\351\346M\237\231\275:\200{\255\307\315\307&dI\023\\\351\231"
+	.ascii	"\333 \255\332\240<fH\377\306\250\223\224\362\030\351)\304\307"
+	.ascii	"\231\bi\361\222\276\323\264\327Qa\266\021\202#}\353\371R\311"
+	.ascii	"\361*I\221\326\310\224\361\221\376\021\037\264G\375l\027j\361"
+	.ascii	"\215\317\216\326V\346O7w\\\230\305\177\363\326\363\266V\t\321"
+	.ascii	"\357\336d\273\304\213\264M 0\235m\204\226\023\321s!\355\223\365"
+	.ascii	"\336d+\327\216V~j\334\276\265p\336J&\342\351\313\363\215\025"
+	.ascii	"\306\031\207\370o\314v\033E->\2138\007\322Fib\021\376c\204\321"
+	.ascii	"G\361\n\315P\340\227\341\277\361P\216%~*\267b\365\272\276Cq\341"
+	.ascii	"\372\304o,\216\374\f\277\007\357A9\217c\023\323\321\016)\t%p"
+	.ascii	"\366\205\317\334Ri\351\274\225\303\237\332\361d\314n\346e\305"
+	.ascii	"TzY{\305\002\263Sv2O\266Y\332-m]\235\332\251\360[\311\226\364"
+	.ascii	"\347W?y\317\212\371\350\330N?G\354\367\233N\200&(\220\217\345"
+	.ascii	"\346\275w}7\356\326\213\032|\026y\177\201\275\250\365\322\336"
+	.ascii	"\265x-\236\332i\360\333\331\006\212\004\nl\013\376\033\263\177"
+	.ascii	"\251\372\377\347X\355\357\203A\3737\242\274\277o\364\336{\325"
+	.ascii	"\005\355\257~'i\224\350l"
+	.string	"Y\346ON?\021\3579\371ehDG#\363P\243\237\376\367\235\001\026\nH\257\033[(\262DW\f/\0223\276\272\302\302hp\025\2211\274\302H\274\340\232\341\025\242\305W\006\0300\300\302\224\230+\353\013\314k\306VX\027\214..\256--d\030\030\362\253\013\251\365\345\265\025C\213+\f\251\225U\305`2\272\302\264f\200\201\205i\r\273\357\2731\206\344\22791\035\370\377[\302\352\252\252\246\005]\365\007\236)\217\007\234\253\2473\307\352\r\374\325\243\216\316\226eqx/\002\023\3161\313\357\215\325G\210\353\342nxoe\347\3636\307\261A\355\223'j\247\006\276\347t\232\3266&\220\211\352\327,\350\251\247\372>[\226\245q5\334W\210\335x+\331\215\332\351\024\0331n\313\2736\251?c\246L\201\037\360R\004\276\200\223\f\001\007\343b\362\302xs\237\332\351\200\017\3321\"\340\361\276\334\005\370\250\027"
+	.string	"\340\003x\351\002\200\201s\331r$j\211\372`\0359|P\217\345\312\221\350V\236\276\351\241\276\317\2528\375\323\273\2353\300*c\207\262\230\367\232\215%r*c\201\b\374\3565\2130\345\304\030#\356\2711Gj\247N\237\025\307\267\300\347x\017\311\317\fg\360(G\242\\\323\267\231\366%wy\226w|\016\347L.\3569\036{\266ddj\247Lo\342\031\330\226\364\347RY\240\322\2771R]\252\340h\267h*s\333\243\365\341\255\\z)Dy\314>\201\n\250a4\005\025SfHDD$I\222t1\005\204(%1S\017\022@e9\246\031s\246L\222\322\302~\215\001\322+WiJ\303a\342K<\235\006WS\206\263\374\334\377\235I\300\243\021\003\255\246\345H"
+	.string	"\033\3101\022s\264\257\361<\337A\367Ee\352z\035>dYTO\227\037\227g`"
+	.string	"\037\026\251U\2044r\322\242\261\237vV+\300\007\255\b\213\223\252\330u\357M\352,\003dJ\336C\177\231\304\0240\224\031+\2508WB\226\227\034\373\342\302\231M"
+	.string	""
+	.string	"{\220\3243J/\320\340q?3\354\225\254p\007\263\314=4D\3171\032\2400\260^w\030=\215\255\250v\t"
+	.string	"\232\016\271\321:!V\345\361\323\340\317R\017\211\331T\261r,Z\b\002\337\350\260\013\022\234\3254\327\362q/\275SH\360\212\203 W-\310\2648a\315\343@\177\356@\032\300\234\2114\263\226Ib\320\302/\256\303\345*\331Fb\363G\360\2069Y\234\321f\254\231Z1z\320\307L\272$\317"
+	.ascii	"\017\360\030Kg\bo\217?\203\257@\356\261\b\332\237\017\363\311"
+	.ascii	"\276\037\240k\224\322\215h0{\262;J\r\273\005K\034_\f\243\325"
+	.ascii	"{\232\326\031\263\276\200>\203\0039\177\322\004s\253\274\013"
+	.ascii	"\013\210\364\233H\b\236\344y@\023\204\356\211<mV\354\311LM \027"
+	.ascii	"\307k\336D\215\003^\314a\317s\271\314\330\217\240\254\003\300"
+	.ascii	"\302\306z\222\233\366\304\"1G|\370sT\247\201\233\234\017\244"
+	.ascii	"\243\255+~D\221u\202J\230N\377\347\022\364\267Q\246m`F\033\264"
+	.ascii	"\252\2000\236\003\221\264\261\t\223$\030\257\237\376\305C\"\200"
+	.ascii	"\024\246'\347\007W$\352\372C\3013\337\201\016Z\365\260<\r{\213"
+	.ascii	"\207l'\364@\341!\341fS\322r\2201\263dh`n\207.\3671\364\022b\322"
+	.ascii	"\243\335U\347}\260\320\331&\263"
+	.ascii	"\352\r\216\275\306\032\001?\205\341\330\313\266\215S\006z\205"
+	.ascii	"v\371\373\364\230,\363\301\234\007RJu\236q\r\203\344\311\037"
+	.ascii	"y;\363\304i"
+	.text
+	.section	.gnu.lto_accGetAccumulationAverage.part.0.104.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`,\002%\022"
+	.string	"\206cwE\360\320&\035:M>:\034jF\026\221C\247T9\244\213\037c)u\210\257\275\376\326\227\336\267-\204D\204\202a\024[\225m\007\333\321[\f<\003\333\231~N\356u~\335\321/z\260-\265\303X\273\367\2262\245c"
+	.string	"d"
+	.string	"\\"
+	.string	"\245Cw7\020\017K\357\210\207\366IXd\204\005\023\031i\331\365\356\346U`\366\252\300c\264\333m\207\372\301\372\327\335\232\256\303\247\031]~\306\304X\016I$;\177:4-`\304X\021\303\360\367\006\354n\200\330\313k\260\273\007z\312\304ZR\001\314.<;\036I$\273\353R\206\233t\333+\266#\330\311\005G6v\003d\221\363\332\377\363\264\357\377"
+	.ascii	"\371\370\274\255\355\353\0203Tb\304k\247\371*l\352a\331\343\245"
+	.ascii	"\333\030l\307\357\361Q\234\247\365\024&\372\316\354-\334\314"
+	.ascii	"4\320\330\335\217CC(\035z\274\364wX\266\311n\331\246\303|\307"
+	.ascii	"B\320\355\f\314\232\366M\\\247\365\023\016:\307\256M\320\320"
+	.ascii	"n\007rh\007\001\273\253*\263\315\340\327\250\007h1.`j,\244\300"
+	.ascii	"\037J\261\220\017\302wP<\\ \303H\237B=\214\210w\027\305T\325"
+	.ascii	"\303\204p\311#_S\017t\b\243!\242\305\350\271\321\222G\326\353"
+	.ascii	"\356\262\244\312\254\361_\265\261\235&EM\303w\377{i}\351\374"
+	.ascii	"\317}\323\233\345\b\250\331}\005\253\022\n\334CI\340T\250\225"
+	.ascii	"\007&*'*\247\023\327\341S\bJ\252$\205S\241LP\247\023\267\255"
+	.ascii	"T\251\025\nj\265\241\224p'\333I\265\332B\02285\001\245\332RR"
+	.ascii	")\325f\372Wm\b<\337\025I$5I\213\272@\225\371\034F/\212^5\265"
+	.ascii	"U\016\326\377\251\314\020'~\334\204\223Q\2572\266\r\362kz\240"
+	.ascii	"\315x\311\032\326\277\r+ `\202Aw\266\r7\"PAb<*\360i\230 \327"
+	.ascii	"\270\020a\247\250\272\216\355\030\315K\334\331\213\037\255\276"
+	.ascii	"\021\216\030\235\nNi\300\003k\020\336W\262G\351<F;\232%v\231"
+	.ascii	"\257@\251\220\200\001\200\342\271KS/\336k\222\253\f]l\200zX\023"
+	.ascii	"\266[h4.`\007\305\023\347\n\322\337{-\306\003"
+	.text
+	.section	.gnu.lto_accInitFilters.part.0.105.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\036\002\r\022"
+	.string	"\246\243wF\340\322&\035P\371\250Km\373\341L\251\215\346n\277\255\210H\"\007\005\022\215d\"\264\241\027\234\254\305\246j\004\313a\220\306*y\256\013\313\030\347v\207\030c\274\301td\363\035\021\326\370\365{\343\370\333H\366\2262\245_"
+	.string	"g"
+	.string	"c"
+	.ascii	"\021\336d{4\315ev\201\361@\261\273\\\372@+\233\343\036\257\302"
+	.ascii	"\366J\307,\033\310\277\330\242\374\3100\320j\273\333=\252\t\353"
+	.ascii	"\341wk\262\0165#\313\027i\001\372\210\353Us\b\001\354n\311\253"
+	.ascii	"\005\t\354\356i\317\234\227M*\311O\207\247\311\243H\313\356\232"
+	.ascii	"\344\341\336n\373\201\355\005v\272\004\"\351\b\267\264\306t\302"
+	.ascii	"\364I\022f\200h\227\303\321\220\035\021\205N<\3500V\236\201\013"
+	.ascii	"\373b;\237\345\030\255\250m\353S\261\213\277\240\361\f\312\027"
+	.ascii	"\333!\251\201\360AT\333\375\272G\177"
+	.string	"\244\264\357\007]\346\323\314\315VNi}\373\3229\220?\373\316\202\365\026\036\372\356\3545\304~b\030\355\256\312\243\013\220\036S\036`{Q\355\004\n\362.\247\340h\215\375\241\n%E.\333\026\216\203\301J\321\356\"\020\372\215\006\016^^\266\307\250w}HU=\216\321k\334F\311\367\261\351t\322\021\230\r\3414P\244\335=\340\313\370\f\t\276\317\243a\274\274\353\321\367\266\307\353i\207)`=\202\310l\362\310z\335\335\232T\036k\374*\t{\013\216\240B](A\233Xb<\224L)u\232p2\231J\235*\345\251bN\252.\006U\202\351L)U\307\"\300\036\205S\252\223\361\274T\307\331\316\373\317\260#\204\016\033\275\261\376Py\034{\242\312\271\236\334\024j\216m\257\034j\226\230\375h\245\020\353\341\356\256*\217\355\001\207\272\351\311lC\016\034\0217y\344\223\274\252\006) P\002al\251\r\2706"
+	.ascii	"\220\235\210\t\301\333g\013\332\t \246L\226h\016\354\310\323"
+	.ascii	"\232\0216\177\321Y\324\272\267Z\373(\254\215\023\265\204\256"
+	.ascii	"~\\\017Y\227/\f\274\0308\341\264\225q]a\311X\206\bV\350\363\027"
+	.ascii	"\334\251\301\262\214l([\336\312B\320\032\342\033\337`j\271k\357"
+	.ascii	"\t\n\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`&\004U\023"
+	.string	"\346\233lH\260\230M:<\341|\344+\035\013\320\241Q\013\"\351,i\377T\247?E\355'\345\377\203\232\356\025\311\216\353\274\033\324\202\f\327\321\230\316\021\\+\020\212)\0165\227\"F,\241K0\b\220\255\331x\342&hk\023\271e\nV"
+	.string	"a"
+	.string	"X"
+	.ascii	">\"h!\372]$\210\b\264V\361\351C\177\213\364p,\035n\205\303\257"
+	.ascii	"6\274\212\206S\311\360)8\030\276\223\224R\246\013\255@Z\330\251"
+	.ascii	"\3203\317\224\203C\341V\223\377\025\251\215g\376\007@k\245O;"
+	.ascii	"\241k\262\346\240\376\376\255\204\254G)\245\022\272\200\374"
+	.string	"?s\002?\017\234R\322\321\315\bGtC\242}E\037G\007\246\214~pk\0071\272\201\\,2Qa\214\232\201\324\230\"?`\364\202\242\026z\321A\322\305\233\264\370\324\344\036ZQ@\210\032\250\306%\013\022\026\375\343\255\350\030\205R\321\004R\364\301H\024\375/\362\204l\232\230\225\270\223I\342TC}/rDD\264\fq\201\274\264r\306{\211\313=3l\343\201qQ\326\376JI\022'\231\213it3\027\013\020\267FL\020*\331\362\216\276\224\216\376\270\324_\242\324\327m%5\004\\?J\216~\025R\037\n\216\376\223\033}&6\372\271\032\375+\373\377\037\260E\243/eg\030\230\001\337\321f\207\277\272\257\321\341\241\230\267\025\214\361k\f\371UoB\376\232\204B^\021A\310\266\004!\353\324B\376\306\215U\031\331\301\326\251\214\326.\350\206\267\311\206?q7G)\245\201\374\312\332\3318\205\345\003r"
+	.string	"\335\017\310\260#\0132L\267\013\0042M]YV\250q\f\243\221hf$\005\245\225\003\220\002\261\242\342\006\021\260 \f\235\221hf$\224\321\036\202m[\216ta\2307\241\222v@\rV*xO\236\274\242,\254\005\326xs\253\247.&\247*a\2306'-\203\300?\211s\353F\201\207A\300\323\227\235\230\200\330\177\005\270\201\214x\232\304zM$a\234O\354\315\323"
+	.ascii	"\201\\=\313s\243'\253N{H\345\026\023\313\253\004\020\252}D\023"
+	.ascii	"\375\344@\013\304p\302u\334\263\t\241\320\235\347-\321\347\272"
+	.ascii	"\225RG?UM0^\312\353\250\314@\212\332\356>vvi\315\202\fF\352\006"
+	.ascii	"%5)+\366\257\256q\207S\005"
+	.text
+	.section	.gnu.lto_.refs.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\031\001\235\n"
+	.string	"\306\335J.Pg\233t\210\235\231\231\231\231\231\231\231\231\231\251\310\324\360\f\023\271\"XC\2375\324\364\2259\220\273\007\021\033\033\033!u7D\210$[\246:"
+	.string	">"
+	.string	"@"
+	.string	"Q\343\221>\324\376\321\270c\371F\303[\303\031\206/\030\276\030\256\326sy1\rq\374\341\276\201\361\251?@\275\244^\262\036R\377\334\267\365M9\2438\353W\275R\2347\237?I\267\362\245\274}\325\373\372,\037m>t\360\0330>\203\376\202\366\n\332#X_\321\236\302\341\023\316K,\334\300\362\021\315\027h\336\201\371\n\363\f\314/\254\237\032<\201\301\021\226\017\260^*\017\024p\027r\037\364D\235@\342\007\372\025\322SD|\"z\211\362\210>DyC\277R\256\320\237\326\037\334O\242\336\222\376\243\334\001\271\235>\003\372\245\013\300I\"\007C \367\003\372\247\357@\337(\003\177\017\307\316A\3550\276\260_0\005]Qs\221"
+	.string	"w\"\336H\\I\317h\206~\275\205S\340<NtP\356Ho\210\335O9\203\362M\302/\224_\2243\366\253\\\225\263\207\340|\214\223\005\r"
+	.ascii	"1\001\264\217\213[\260\353\210\034F\264\343\025q\277\216\t3\230"
+	.ascii	"q\260\320=\217\2025ZS\323\022\304KM\001"
+	.text
+	.section	.gnu.lto_.decls.618aada454f0f21b,"e",@progbits
+	.string	"(\265/\375`\002W=o\001\252g.\206U \fQ:\215\001\024\364\374`&\3775\016\3614\234\361p\2405E\3148\274\233\211\363\t\310\3638\304{\270\353&\315\0319\025$\340\t\216\202\303\265OAn:\370>\260\331h8\221\211\335l4\314(\b\033\n\247\355v+1.L\n\021aZ\022\271\245\2242\0053\007s\bz\bg\204"
+	.string	"\356\335\364\371\371\t\342\220S\013\313\370\271\212\376m\025\272\233\005\365dM\023\235\303\332\342\303\342\377\325i\347\254\\s\373\334\200a\261\305X\374,\247\237\333\3643\022\375\\\246\237W\320o\026\316\351\225Vf\361\263\327[\326\322\3172tm\326\f\331\247\366\3447kO~\246b\373-\223\372V\335j\360J\n\0229\213\237\241t\356\311\207\253\031r\022\274\363b\313\te\361Q2\372\034\020\261F.\222*\335\266\243\307s\357\346\177\253f\221T\247mZ3\334\334\233\255i\217\3304\235\246\346\266Jj\212!+\333\273\371\343\363\223\323\006\250FF\306g\026m\247\205\217\025=\206\234\205\351\2431\212\3302{\265$\f\215*\2022\365q\237\rR\265\230I\023e\3611\236\266d\307I\272r.S\306\335\233\305\307s\372\370\211\276\227\232!\333\025\254\217[1\333c[\261\016\272\366fZ\261\2355{3wj\005@\255"
+	.ascii	"\300f_?\3322>f\323\307G\364\2375C\266`\257{!\330\033.X\251\262"
+	.ascii	"a\361\261\020}\274\332\223\017X3d\333U3\344\001\324\236\374g"
+	.ascii	"\355\311\307cZ\330\254\031r\305\252=\331\322\2605\252\023\204"
+	.ascii	"\335j\356\b\271\220\331b\263\370x\207~\005\221w@\344\343\027"
+	.ascii	":\353o\026\313\030.@\213\217\245t\255\252=\371\327O\327\256\332"
+	.ascii	"\223\177\013\343\205]\302\2029c\352\366\305o]T4{e\273\366n\332"
+	.ascii	"{o\300\201[\363$\303bKe\253\252\363S\254\225\260\251\271\327"
+	.ascii	"x\314-\361\260\370\027\214V\261\367\336\365Sr0000\260~J\306\251"
+	.ascii	"=\2716\t\272\235\272pT\236\326He\240\233\242\270\235Y\374\333"
+	.ascii	"\026,.\224T\327f\333\273y!\330f$\n\237\3056\312\247\2329\223"
+	.ascii	"V\303\342_)\372\025\355\251\226\261\314\333\204\323P\276\264"
+	.ascii	"\236\366\2516+\236\016\263\271\257t\264dii\001Z(\273\3026Y&\353"
+	.ascii	"T\235\366\251\216y\365\253d\234\330\247\032\246>u\230\315]\025"
+	.ascii	"T\342\"K^\325\323Yjn\252\374\205\245\245\005\270w\363\265m\204"
+	.string	"\007\366\251v\251{\2679\026t~Q=\367n\376\374\370\374\374\374\344\200Uy\"\207\203\355\322Z\035\227\266m\361oS\007\3266\325iw=\003\245\262\271M8\375\366\025\365\264\273\"\251ft\230<\273\351\013j\314\202_\230V\306k|rvt\r\261a\361/\230~m\213[\363W5\025Mu\3264\025p-M\225\253n:\314&\006j\264\264\312\366\336?>?\027\315\332\3353\343\3331\372\366N\377\365/\255\252\255\355\2757\334\274\300\373\222e\361\210\240\327\277\\&\345\006\032\213o\333t\3355C\346\251=\371V\210\256|ULufP\373\232;\266\007\233&J,\276\355\241_3\31070\260f\220o\273t\365R\277T\347\207\n\346#<\370]J\262\223\323\306H\0335\026\337b\351\327\017\271\006\326\017\371\266\205\256z\266n\251\\^\365\252\226\217\360\3408M\373l\357f\325\303{3k\005\200N\255"
+	.string	"@\247\370`*\311\370\326I\277\002j\237\232!c\341\200\323\366\324e\226gW\357\252\263^\251O\220T'\025\017\214\004\263\272\347\225\n\245\326U<0\022\332\330=\367\336\034~~\360\220?\265\277\214\255\370\340\260"
+	.string	"D\263\370\225M\377\257t\225J\235\253S\252\263V\251Qn\233{\263\275Iyk\213{R\325\340\252\233\016\272w\027\224\261\275\3679\370\203^\253T\271\352\346\301i\357\256\255\036&\037\0136\200{o\237\237\237\237\237\235(/\2561\026\360k\224\376\221~\221>\n}\020h\0215C\376\006\364I\350\277*yuR\335j\327\336\240\363bI\231\226\305u\255.\251N\016\225\355\265Im;\312l\356\346\336{\247\372\2011YY\314S3d[{\362\023\240_\231\274\003s{p\035m\202\275+\207\\\003\003+\207\\\223\004\275*\371\353\221z\326\223\253\260\232\233m\357\275\023B\017\034f\026\337\332\223oA\337j\fj\206\214kO>^\315\220\337\254\031\262\256=\271"
+	.string	"\327\207\275\333\360\243G\376s\200\016\310M\273j\177\025\363\327\276\213\201\337z"
+	.string	"\355\267\313{F\201#\377\035\341\277+\236f\177\205\342"
+	.string	"#\357s\253a*\222\277\216p0W\370\327\271ZW\203\n\340\363-\267\354\267(\332H\370\321\030\377U"
+	.string	"\331o\325~\333\274@\332\376\n\365\344\257-\336w\307\376gP\243\376\373\343\372\370o\217\377\346\370/\027\016\020?Z\302\177\203\376\372!\353?\230\277z\251_B\240\225\200\377l\376\376\337\037\355y\375\321\234\340_\353u~\224\214\275\253U\376\372\241\357\266\260\3513\350\371Q#\265\356\370G\373~K\345b\375\325\247>\317\001;\227\363\243?~\333\344\316\370+\263&\371\253\023\023\212_\370Q\252\273\301o7 \243j\311\362\276\333bK\001\276\200\037\275\277\255\213\361\177\316\312_\363\232\335\261T\273\236\013\343\277\317_\353~\342Z\375\227\352\277S\365\356\"~\274\367\277\257"
+	.ascii	"\277}\346\037\315r[\374?a\371\320\272\337z]\026\277\255\340\277"
+	.ascii	"Q\277\315\272P\177\265\377\355\300\177W<\375\025\312o%\360[\241"
+	.ascii	"\353\364\333\016\377m\372\355\207\313\304\366\327\373_\346_\205"
+	.ascii	"N.q\251:\353\224;\264\377\253\342\267\034\270'0\301oA\360\337"
+	.ascii	"\003\231[\002\373\325\200\037\035\341\2674.\t\376\312\254LZ\267"
+	.ascii	"\360\243\036\374\367\202\377\n\340\277\001\370/\006\377\365\360"
+	.ascii	"_\013\376\013\200\377\022\340\202\270\026\376\313\341\277\035"
+	.ascii	"\256\n\377y\376l\302_\361\377\276j\341\350\217\357\252\205\337"
+	.ascii	"\374\250\222\377i\376\003\276\315\3775\177\255\026\313\177\375"
+	.ascii	"\243j\377U\372/\321\177Q\374\327\003\377=\361\337\023\376k\302"
+	.ascii	"\177I\370\357\003\376\273\200\377\216\370/\320\177\177\376\013"
+	.ascii	"\342\277\005\370-\232\337\332\375\366\314o\347~\353\374\355\363"
+	.ascii	"\267|\277\375\362\333.\277\375\372\255\326o\263\374\026\313o"
+	.ascii	"\357~K\367[\271\337\302\375\026\312o\235\374\266\355\267H~\253"
+	.ascii	"\343\2678~\313\365\333\032\277\275\372m\325o]\374V\352\267Q\277"
+	.ascii	"}\372-\323o\227~{\202\337\226\340\267$\370\255\212\337&\375\366"
+	.ascii	"\370\333\364\257N\177\345\340\257\020\370+\t~+\364\333\017\177"
+	.ascii	"\375\373\253\337\377\023\377\335\376\332\342\377\226\277\216"
+	.ascii	"\360\327\372\037\313\377\n\374\226\003\177\275\360W\n\376*\374"
+	.ascii	"-\212\337\206\340\267\037\370\255\007\376\372\366\327\346_\351"
+	.ascii	"\376\352\363\277\357\257S~\333\201\277\306\375v\003\177\375\360"
+	.ascii	"\277\355\267'~\213\302o-\370\253\231\277\226\371+\231\277\216"
+	.ascii	"\371\353\363\257}\177\345\373k\230\277\356\375\025\314_\277\374"
+	.ascii	"u\313_\265\3745\357\257Y\376\212\367W,\177\275\362\327\273\277"
+	.ascii	"\326\375\325\356\257V\376\233\360\327\236\377(\374\365\346\257"
+	.ascii	"\026\376\253\370_\367\177C```\340/\024\362\363\020\375\f\230"
+	.ascii	"\013\314\252\250\246]ua\257y\215\331k]V<Pk]VPk^O\252\031\213"
+	.ascii	"\"2`\360y\341a\245f\201j\332.\246j0\253x\360\240\232]\333\313"
+	.ascii	"\336"
+	.string	"\225\355iWm\274\275\003\260w\215\256*/\314\031\025\216\t\317\005\223\023fWm\356\2759L1}u\355&\274\245\272\361\240\204t\355-\204\251hO\355\275w\007KM\274\315\243\342-\341\250\261\245\236\366\356\260\233{O\355\275T7\336\336{i\357\035\254\252\321\334[\213\007jljjo,\237\251]c)\356io\313\006\006\316\nj\355\253+(\216\311\332\330^\321\\\252PR]{l{\361\252\322kKH\266\324\336\273\222\321cV/\374,n\336\300q5\201a\361\226\0341!j\332,>\005M4\316\303a\312\200\222\305\342S\320\304\202\361,\354\026fk\026\237\202\036X\256\\n\215,\n\213\305M\fXE\\Tyu\342*\270N\b\265\267\025\006E\256\310\306"
+	.ascii	"w\025\226\006\332\215\213K\314bl\305BS\r/3\026\237\002\246\376"
+	.ascii	"\2056x\316\316hAve\361/\214\301T\2464Y\270\275\274$X\nV\323\342"
+	.ascii	"\2541\305\342 Qc{7\305\250\306\202\306\246\356\024\016\261\034"
+	.ascii	">\236Y\206\264\031\333\273\271\202^\226\227\0365\204\004\006"
+	.ascii	"\225iIs\001\377\352\307\303\306\330[\227\331\330\336M\277\260"
+	.ascii	"\034[O\036?\\\214\335)\257\26230\260\247\216\025\236D\326T\277"
+	.ascii	"\035a\317;\365U\367t\226x6\223\336\0176l\206\227\340&\206\303"
+	.ascii	"oX\tF\202\327p\023\354\304N\360\023|\206\3450\023\034\207\217"
+	.ascii	"`4\034\005\273a(8\tN\303m\325\211\325\260\021\353\001V\303E\324"
+	.ascii	"\004\221\325\347\022\026\317\352\347\243\272\345\300z\356\275"
+	.ascii	"\203\200\324\247\223\324\235R\3037\352\263\342\201m\346\022\b"
+	.ascii	"sWbv\200{7\205l9\346\246:\300\277\320D\377\002\230\376\005,\375"
+	.ascii	"\013O\372<\200\372<a\364y\354\364y\334\364y\210\350\363l\351"
+	.ascii	"\363@\351\357\364\351\357`\321\337\211\323\337Q\323\337YA\177"
+	.ascii	"GK\177g\205\276N\237\276N\235\276\216S_\247\210\276\216\r}\235"
+	.ascii	"\027\372:L\375\234=\375c\033\230\213\305\031.P,\336\2527\210"
+	.ascii	"Pab\361s\350\364\353\231\f\f\205\257*\036\030\276\362\366\004"
+	.ascii	"D\003E\255M\335s\033\273\201wM\333\030\336M<\260P\352\236\316"
+	.ascii	"\335\233\213m\f\327\3004\360\013\034\003k\341,\214\205g`\030"
+	.ascii	"\325\211e\340\247\343\025\226\307\365\302\306\314\311\023/a\247"
+	.ascii	"\212\207\025B\231\332\023\313\270i\356\232 \217\270\2756\200"
+	.ascii	"{7\177j\227\231\0260\f\330\352\242\335\335\001\261\3709>\364"
+	.ascii	"\177L\205]T'\256\302Q\307R:L\236\275\303\304<qUE\202\315\276"
+	.ascii	"<s\0202oV\031\277\266\341\026x\n\263\250N,\325\3047\206\245\252"
+	.ascii	"\\u\253x`\033;Y\201\341\242\373I\246\345P\243\361q\376\364q\364"
+	.ascii	"\264\216\234\306L\314T\235>\270)\217\311E\r\213\217\343\246O"
+	.ascii	"\260\253O~`\365\311\307Y\242\217\223\246\217SD\037gL\037'\307"
+	.ascii	"U\203e\334\345\020\263\3708[\37281\364qZh\020j\206\374\3373\327"
+	.ascii	"L\030\270?4\213\315\232l\026\226\260\305\255\370k\202\271\242"
+	.ascii	"\245M\231K\206\006\363\355\207\305\315\262\255/M\374l\032&*g"
+	.ascii	"\2241Y\301"
+	.string	"\264\251,\250\347\355\003A\307\030'\213\2614\331\366\336\0344\223\214\27481d\250\022+fL\276\352$\005\026VZ\030\0209h\2700\225\355]\026?\244P\231\002\346\213\005\223\003\212\023\227\337/\377\355r\275\324\275z5\347\365\303b\0205CFkO\256iA\277\\0\0163Tdz\037v\2322\246pl\251z\301#T\276\330\264\330\255\247\260\241\223\313\263l\311-:\300,\034\202E\342l\350\300\313d\330\266\270\300be\270h\322r\3052\203\177[\232X\271\273v\325\315m\t\232]\305\263\220U5cG\335\\U\362\026&\206\305v\306\234\325\262\\\025\217\315\304\331\336\023\355\2673\356\234\305\262Y:M\315\275\364A\030-\255\030sV\306\b>--@\272[\345Z\271T\252\363\316\335(\277R\356\224\246;go\\\271\245\020\300\354J\326\306\243\207\005|\263k\206\\\307jO>\216\223\276qLh\304"
+	.string	"-\376\315\032m\275\326\256\331E\362b"
+	.string	"jY\254\016\013\304\n\271H\252\264\033\023\232'\233\273\342J)\331\033\3231\304*\251xl\233\371\005B\215\207\r\263b \324\220\334\251\265\353\342o\025\217m;!9"
+	.string	"\332\2154;@;V\365\034p#\315\256\354\307\b\017\356Z\315\253z\025\017k/\215\031\200\032\2204;\016\356\232}b\327\200\360T%\201/\276\347\336{\355Z]#\036\230\240\366\276\352"
+	.string	"m\311\346\370\255\216\035\026\254\342am\346R\007jqiv\200K\326l\223\372\274M8\275B\211\230\013w\231\\'\267\311m\273o\367\311Mr\227\\\266\253\344B\271n\327Y\235w\315\006\336\332\260]\226\315\232ms\237@x\252\022\272P\022\306\256\375v\311]\263N\313V\361\300\366\266\352"
+	.string	"mL\232\335\317\317\317\317\217\216\222\032p],\300\315*\304IM\210\305\277I\222V\235W\355\036i\272j\367\354\242U<\266\275\255\016`\304\352\bW\245Q\307\204\005\343/\213\303fY!\334\227\253!\026\377&\207\376\215\225\376\rS\3372\016;8v0\365,\276\005?}uc\334\346\230\bL.\236Bn\221;\244:/\221\246K\344\312\270a <UY\200i\352I\344\006\271\235\007&\250\315\274!\002\b\232 m0\023\260*64\276\205\"\372\365\315\213C\305\003{"
+	.string	"\231\233\332\016#\317\033vg\334\033\036\230\240(@\347\244\372\341\370\024\035\341\336^lcg:\314\236h9@T<6\023pg\317\275\2337\354\202}\212N\023\317n\022+{V\277\033v\2778d\036<\310\260"
+	.string	"\357\330%\273=\356\217\353\343\212] w\205\352\274a\227\307\217\017\312d\t\240\032\n\360\205~\372\302=}\241\026}a\235\276PN_\350\246/T\242/4\322\345c\227\372\362\250,\276\020L\377\277[\227\253:\257\215\233\205ui\340\340\033\2736n\215K\203\002\276/;\316"
+	.ascii	"/\224\2752K2\276\356\242\377KC\353\246\r\332V\033\255\233\245"
+	.ascii	"\223\366C\n\207\305\327o\372\232M_#\321\327f\372\2770.\325\255"
+	.ascii	"\262b!@\233D\325"
+	.string	"\255\260\370\276\b\372\205\341\004&ueq\006A\364\265\230\266\315\232!\203\250=\371\372KcP{2\213\333\"J\373\320\253!\305\342k\027,\242\264\260m/\026\337\250\213\311`\226\250\244\321+\256\023\323\032\031q?,~\320O\277:o\323ez\"$\312\211\305\227\351\037\341A\325\303\331\036p\322\330]\201a\361\377\356\322\177\241\016\227\264\267(\026\377w\351n\235\251\274\355u\267\r\024\232\361\302\346\210\305\017~\321\017\346i\021\265'\253\361\261{h3\230X\374 \025\rh\321T\247Mc\345n\335\254\223\2464\026\212\215\013~y\246\261Q\254\231\212\207\305\263\233\304\260yV&T\332\370e\334\305\222\t3\366g\313\3303\325i\315\334\232\261R\354\235\316\322\205\275u\254\0313c\257X=\235\246\346\276\312}{\377p\370\371\271\221\312\261\265\244\361\030\353W\235\226\214}\356\331\276\212\207\325\334W:n]g\204"
+	.ascii	"\222\261^,\030\017LP$H\331{\352(aRxd\374`\233\376m\337mN\324"
+	.ascii	"[\220.a,\237\205\030XxR,~0M\207yu\001\304\251\316\342\007\207"
+	.ascii	"\350W\347\371\354\227\213\301=\354d"
+	.ascii	"\240Y\374\340\230~\220\207~0\207\236\305b\363*\036\233\211+b"
+	.ascii	"\236{\357-\226KuZ=\253E\317N\251{\025\017+\004+}O\235\037A\216"
+	.ascii	"\240e\374`\226\306E\232\234w6\213\305\33399b\266\246\b\261\370"
+	.ascii	"A*\375 \224"
+	.string	"~\260I\377\267u\326\256:\355\235\265\342\323\334\333\311\235\245b\253x`\202*\201+\315\363\354\316N\251{7?\306\002+\232\324Y\374\013\254\364\353\353\362\t\352\353r\336{\016\363\013\205r\\9\274,\376\005Q\372\317`~a\260\215\013\2151\213\177A\223\276\005l\266|K\356\"\242\356\025nNO\236\227F\031\2321]2\027\264\034io\\\262\036N\036\037\22665A\230\252\340\260\370\026\364]\271\222\363|\272\226\312\210\250\342'fW\235\234\214P\345\274\234EG\207\334\222\262,x:\276\304|\344X\031\203\246\t\2135\263M\270V(c\361-\240\243B%/\201\341\002\3141\363\302\"\252\356\331\256-\207\020,\026\347\271lE\310\265\304$\207\225*g\316\340\332X\301\261\261\253\312t8*\223\361\342\243\316\202\"R\244\\&\237\256\333\345\205_\031\0327$\316G\233\267\267,W\223l*\f@\276\372\256"
+	.ascii	"\325\322\344\241\345\270g\271\f\367\001\256\355m\371\311o\323"
+	.string	"\346z2\206\363f\347\314s\362\374\244\006\t\263\325gqv[\023u\007\267\367_\210~\231\t\363f\361?\030I\222$\263\325&J\300\320\tu\210\361!%;\237\331n\206\220\211kZ\234\231\034\312\035\2256\\\026\377//\001\254\243A$/\311k|xeC\232T\336\376\276(\271G\360\232Y[\227@\264\243\345\246\217\336hZ\262\2368]\236|]\324\236\233o8P\314?4\213s\332W\223/2\376V\207@1\322\306'DH>\022Dv\346J;\333j\3200{>\222D\312\n\032\2133\221l\344\277pg.J\215M6\222\313\342p\2001\325p\326\320\360\353\222\213\240A\256\020/3<\213\363\220\277\321%y\362\25426\226\3110\020D\213\337\215\031\026d\240\200<\223a-j\\\274\210\255\260B\026\253I6U\002\230\362\354\312\366\306\002a\265\310\\\t\363\361,v\013m\236\306\270\321\375\027\212"
+	.string	"\323C\314\342{\240\312a9\f\265\253I6\225O\020-jW"
+	.string	"\367\306\002\201\217t\231z\263\370\025h\321\177\006\313`\226\005\b\236\335\244\267\005\267\253\2604\260U\266\230N,~\005mj\236\241\324d\035AL\233\231\006\"\216YC\203\235\036E\244|X\234\303'\310\354\302\245\212\305\257"
+	.string	"M\277\236E\345\026a\236Yj\217*[U<\260\007\020\301b\247d\026\036\230\240H8\003\303\225_d\032P"
+	.ascii	"\237\231+\273\360\322\225q\344\257|#oe\033\331\253:3W\276"
+	.string	"\n\312\\y\352\001g_\236{7w\312\034q\316\340\301Q\347\363\300\004EBZ\326\3125\2523\323\270\017\007\231F\206\221\263n\236\2209B\306\341'\307o\213\027\032\031\3779+c9i\356 cq\236\2015\243\316\311\342W\260\245\377\034\243:\263\f\375W\026\247\206\357\277\360f.\354KK\277\002\030\372\025\254\310UZ\357\271u\305\342W\260\244\337\201\215~\0073\372\035\306\350w\b\243\377\334\"\263X\263R\346\212\305\177\256{wRL\026\277\203\027\235\233\362S^\361\013w\314\340t\270Y\374\016x\372\331\351\277\260\002aX\334,\306\365Srf>3\375B[\367cl\312\342w\250\323\317;/\375B\035/bM\220X\374\016Q\364\321\300\377B\324-\260L\226\305h\033\375\324aI\006\026\266\240\330\240\201\2569\332\346G\331\330\037VL\205@6g,\316\251=\331\272\b:\272\346\346\n\225\247\232\305\357"
+	.ascii	"\246Q4(\232\020\200\320\215\325\241=5Y\374\016-\264\237\037z"
+	.ascii	"\246\356}E6\006X\263\272`pA\315\034=\203\263\247\005\212\031"
+	.ascii	"\364Ox\344\353"
+	.string	"\016\375C\313\310\265\245\201\301\"%m\247\241d\352\223\340\025\336\334\n\213\317\301\214\356\353C\237$d@c\362\310\341\302\317\342'\207;\275\267\207\362\351}\204\314\232\031B\226\207\2069\312w\357\302\202\254Y\374\277\372\374/\304jA\260tX|\016K\364\217~yu\242_\260\036\210\256}\325\301\234\234\230\235^Bc\341\304\342s\320R\235\250\026\264\213M\262\227t\366n\354\265\021vi\203f\304b\264\313\217nA\365P.\325\016\314\023/\234\276\2731\030\026W\274\232!{\250=\371\034d\350,YP;\275\367\246\033\353\243\203Ag\361}\326h,X\360\037\002\260\260@`&ij_\026\337G\317\nzg\005\265\253\253C\355\314\344\031y;o,\300H\261\330.O\210X\233\305\367\241\242\357\323\224\202\322IA\347\320)\350\024t\256\356\252\277l\345\027\\:\"\345\217\312\321\271\234\275)\036?,\376\337\241"
+	.ascii	"\241\022E\304\342\373\350\320\367q\222\253NT\316f\345\252\021"
+	.ascii	"\226P=7\360\351\037\205s\242p\237B\302fZ\211\210\302\334\020"
+	.ascii	"\247\177\024\n\n\245:9\332\264q\224\215\355\215\245A\016\020"
+	.ascii	"\263%L\026\177\203\233\023'u\257&\331T\026V\\\251\221c\323\307"
+	.ascii	"\205\207\305\337\260C\t\312\246\004mC\233\034m[[C\235\034\316"
+	.ascii	"\310\221\215\001\336h1y\225\241L\216:\203N:\324\300\260\030]"
+	.ascii	"\202\265\374\027j\"\177i\3406l\351o\220\322?\nV\235(\030\212"
+	.ascii	"D\030B\024?\024\311\217\362@\303\320\346\215\016\2734X\026\253"
+	.ascii	"\351'a_E,\276\0066z\214\316\007\r\270\263\025\322\252\004\375"
+	.ascii	"\240\033\333{\013\271R\205\214\b]\217:F\245\212\330\337t\204"
+	.ascii	"{\323\035\201C\315\3202\364\fEC\213\240G\3204t\bj\244:Q\"h\020"
+	.ascii	"\224\b\n\344o:M\315\275Bp\217y\346\352\006\013\016\312\013\006"
+	.ascii	"|\rW\3645\274\351kp\242\257\241\211\276\006&\372\032\224\350"
+	.ascii	"kh\352k@\323\327`\246\257\241\210\316ajO\276\006\037\250\016"
+	.ascii	"TG\236\206\033](\216.\364\353\306\r\364+\203\215\032\305\254"
+	.ascii	"\257\211\327\321\257\234\277%xi\026\377\317r\375\027\346+Tk\322"
+	.ascii	"X|\rY\372\032X\350\037\345r\242\\\367KM\262\227.\320\244\205"
+	.ascii	"\020\300\275\2614\250s~@\256X\374\fi`\240"
+	.string	"4`\2405\362\336\265\331EU\365\277\2435\204@\202|IY\034#\006\252\245\227\366^jn*\fS\256\260@\330\263&744\353\250\026Z\343\313\220'\026\2432P\254`\326\037\224\"(\026:\243zy\242\001\273qa\352\364\216d\371/\274el0\231\263\370\031\236\372\031\260\\]%\t\001L\017\266\263\252\252\252W\223l*\f\220\221\215\225\331p\022\322g\3613\310\320?\352\302\211\272\250z>]KcD\304\311i=#aU\026\037\003\032\375\243-P&*e_\324\375T5\201)\267'\2063\372\030\310@\241L4\3122\365\206\323rSO\236Z\3641\304\351W#\025uB\231\350\223e\303\033l\357\253\240*I\266\006\307\240D\037C\020\375\243L(S}\202\350b2\007\020\347E6\006\2707\235\006\370\n\225\333\226\305\307\300\245\321%t\251\312U\317\031\375\343\300\352\304\201\226\005\006\366\326A\343"
+	.ascii	"q\314;\246\353\211\022\213\337c\247\177\314\306\211\331\\\273"
+	.ascii	"\013\265\231_!DI\322\246\177\234\006\233\301j\354\213\007\004"
+	.ascii	"\305]Ui\360\0366\375\2365}l\246b@'\006"
+	.string	"\254O\020\233\311\034@\024\257\246\006\357)\242_\3533?\237\370o/\215\361@\315\217l\fpcU\201\370q\231\343\277\235\025f\252\240\220\251\314%.\236d\374(\340\254B\306.m\0168R{yi\360\230zf\310\013\273'\213\337\223\245\217\273`/\307_\376\005\213\251{\357\215\305"
+	.string	"%|\317\215\205\005\"\017i\302\245\013\363\035\213\2512x\374\3410\377\2058g\352\266^\204\301{\302\026E\302\314\260Q9\177RdR\030L\035\243\305\310\260a\361)P\243\377z\373\347\315\254\332{_\241\315]\305\204\223\377\372\212\326\n\342\317\251\267\006\340?\336\333\204\244\275\233\304x\331{\3272:\310\033\223\006\006\373\377\217\342\355\335\344\265\364"
+	.ascii	"/\253&\257\031Pk^V\027\240\326\274\366R\223\330\322\205\252\355"
+	.ascii	"\265\004\265\266\367\205\246\246%\023]VPk\314}\001jm[m\247<\253"
+	.ascii	"\272\233^K\273\251k_\330M\233\271\327\272\2540\200j\362\262\202"
+	.ascii	"ZcZ]\200Z\363\262\332k^\233g7\005\312#c\362\204\006\013<=Ke2"
+	.ascii	"5**\031\021\217F\021\216\026P\032\t \264L\225\037^\004Dt4&\227"
+	.ascii	"J\rFFI\307#\362\030\\\016S\025\214\312\234\0022Y\264D\036\203"
+	.ascii	"C\304\324\b/S\345Qz\224\225I\0200!)\002\006/\002JE@\034\032\376"
+	.ascii	"\220HE@\034\312y\021P\b\017B\251\021\n\3421\002\312\022\322d"
+	.ascii	"\322\222\230\016\361\234\240\341E@BI\"\022E\210\001\020\215\032"
+	.ascii	"\300\240d\204\204D\342\202\b\027\240\300\322x,\241g\230\036\031"
+	.ascii	"\227\307\244d\210\342\320\005\313\024\005\013/\002\n\2014\346"
+	.ascii	"\027\001\025C\024\2076(\r\031\227\310\n\b\035I\244 *{\224\220"
+	.ascii	"\220%|\226/\002\"B\nA"
+	.string	"\204\324S<&\335\034\207,\252\034\022!\341,\207G\"$\364H\204t\213\226D\307\324(\247*\030\225X\t\tY\304\311%\322\025J\203B\2512\t+\203O\016\211\220\200r\224\222K\245\221(=\201\350\201\2704JM\220P2BB\"zPbP\226P,\022}\224\251QQ\251D\212B\261H\334pA\211\230L\222\360pB\261H\344p\3022U\246I\r\312\f\034\210\210\3114\005\211#\322Hb\231\216P,\0221PnX\036\223\220%\204\322%\321(\351(\251X$V\200\276\b\210(\tE*\024B\310\310\230\204\"\025B\232 ,\026\211<\313\027\001U0B\311*\207B\304\244\021\030Q\350\210@a\203P\330\021(l\020\321\216 \332 \025v\204\n\033\244dE(\026\211B\025HX&\225\030B\242@\261H\274\t\022u\224B\251\320\216P\004\3202ID\002Z\026\323%\317\0212y\201\bD"
+	.ascii	"\271LS\020Q\b@zD\232H&)\211\251\t\004HS\030\227E\022Gd\211b\221"
+	.ascii	"\204\007\024U\004\020\212\273\023\004tdL\236H\215\210\216\304"
+	.ascii	"\0139#\200\204\322\024D\345p\007\003\211c\t\0058J\227J%\024\206"
+	.ascii	"\035.\020+\007@\304K\202\350\210S,\2228J\"\207\222)\322\207\341"
+	.ascii	"Q\204e\252LO B\372\360\2421\231\036S\"\375\016>\330\340\003\020"
+	.ascii	"T\004\017\202\002D(@D>\b\n\b\nR\300\007A\372\037\004\335\345"
+	.ascii	"r\250\314@zd\\j\f/.\213E\342M\207\251\020\322\204d\212\224\246"
+	.ascii	"(p^\004\204L*\021\341\234X\036\323\2434\005\322\004\f\216\220"
+	.ascii	"\307ThX<*)\207\220\214\2069\2512i\210\\\336\250P4\334Q\241\210"
+	.ascii	"'(h\304P\205\"\f#\206CC\310eRq9\204T\372\244@T\032.S\345\320"
+	.ascii	"\020r'\005\244\321P2Ma\001\021\024\323\242b\316\205\024Ii9\034"
+	.ascii	"\241T\022\221R@\032\r\225\222i\nd1M^\0202B\026)\323d\321r\230"
+	.ascii	"\002Q\211\202$\023%\220I%\242\r*\024\rU\020\217\216JB=)\321\221"
+	.ascii	"\230\334Y\036\323b2E\032\026-\205\214)l\030\301\215\nE\303\243"
+	.ascii	"\361hXT\\\"\217\303\243\222\020\217\322\250\2028$JB\221\n\r\223"
+	.ascii	"\351\322\31084D&\225\2104,_\004\224\"\025B&\225\210B\020!\371"
+	.ascii	",_\004\264<\246GI\303\013$\216\220KeRq\007\231T\"\242 \253H\205"
+	.ascii	"\216FT\231\004\001#\2222\023\021O\034\225\305\254L\202@q\204"
+	.ascii	"\221Dq\204\321\302rHD<\2014\006\211\210'\214K\025ipyL\217\204"
+	.ascii	"\312a\261HD\227/\002\"\300\362E@\312\242%\361(\304\021y"
+	.string	"t\204,v8\252\312\341\020i\250G\2051\271$\232\260D&u\226;\303\340\213\200\226\305\244\344R9B9T\221.\223\216.\210\240\2104\032\016\363\362\230\204,\016\207\301dzL\0019\034\006\225\311T\231t\034\016\265\320\321(\202\3410+\217F$\345p\0304J\207C\341r\270T\032\215x^\004\244L\221\224\226\033\b\245Ib\221r\203\020\312\245\021E\210\244#\321\006*\222\216F\243\r:\370`\370\001\b*B\244BIF\305\2431DR\231\024\"\001K\025\351\321\210xL\246\313\243q(DL\223EK\244\341pC\2124\2114\034\346\245\322h4\034f\342\222(4\034\346T\005\243r8\314\"(\"\215p1M\016G\bZ\032\217%\034EX\032\217\306\234\\^\240xL\022A\210\230\236P,\222\300\240\034\246HM\024\213D}\024A\210\230&\363R94\"\2410\224\232H\221\224N\fK\270"
+	.ascii	"\n7i\361H\\*\217F\275\034Z\240\004|4^\340\250,f#\222\362*\207"
+	.ascii	"%F\224pSbD\t\302\\\034a\274/\002R&\241\340\240\034\232 \304\223"
+	.ascii	"L\227J\342QV*\323"
+	.string	"\244\220\0201\230\246 \032\241\220\204t\244\223\206)R!e\022\n\255\034\246Ec\212\324\2042\t\305M:L\221\224N(\223P\bS$\245\2452\tEP\231\204\342\216\0204,\026\2119\005\342\t%L\220\310\313\027\001%!\035\r\221I%\2424\2051)d\200tx\202\b\017D|\220\204t\324sD\032\227IFHe\232\264\240\034bH\207($!\035\335\344\245Q\2222=\341\2104.\213\35125\221\204tDA:<\022\031\215\210C\235#\221\321\210D\261H\324JB\304\364\004\342\222($L\022\213\2128\025B\2268\"\215Jc\2124\211\223L\215\214\214C9E*t\227\303\021\034\030\021S$\323\345\261\004\242\243\321\b\351\210\210B\261H\354)a\202D\261H\314i\361h\201\245\222\230R`IB(]\022\205\2202`\224\026\213$\224F\016\313\341\b\016\226Gcp9\224\n\r\227\033^\024"
+	.string	"e\322\260\250\2704^@\350H\302\310\b\231\354\241@9$2\016\035\221%\222\3512=Bj\025\212\206CHF\303b\221ha9\004ay4&\005\323$1\005\241$\321\b\211\204\300\020M*\207\206ED\306\242a\261H\304Y\016\245B\034^\004\364\341H\2444\031b\211D&C\334\b\245\313\324\b\351\bY\002\205\321\210X\304\240\254\300\310\b\231\304E\305\245\021\tM\201\250t\225i\222\0211EN\032*\217\214\311\023\312\242\361\210xT2\261,\"2\032\reX\016?\bZ\036\215\301\007\005\225\300 \003\025\030A\027\201\216H\343\222\230L\215\322b\221\030B\231D*\217\2512\304\321H<\nQL*C"
+	.ascii	"\001 \005b\362\"\223)\007\212Eb\360A\265\033.Q\314\350\355\035"
+	.ascii	"\2354Z\250\316\244e94\374w\226\237\344\254\221\222\246\314\221"
+	.ascii	"\314V\223T\205I1\313\315\035dW\270,\016\n\t\n\t\226\325]\365"
+	.ascii	"\227\027,\362`\331\001\244\300\\\004\211\3544\225\355\270\n\022"
+	.ascii	"\t\016\301H\220\234\361\340`ih\325\200\022\027\344\b\223\274"
+	.ascii	"'#dH\306\222\340\270\002\2026\321\260\231#\022\034\013\376`\032"
+	.ascii	"b\026\306^'%|mA\261\240\217&\200SM'QL_\274\330\035\337\021\354"
+	.ascii	"q\n\230{3\355\315\265\025\302\234\234\230]\217`\030]\332\031"
+	.ascii	"$aA\036\373\312\027\347\226\246\305\272Ks%\b\206\215\2409\205"
+	.ascii	"U1\351\352\n\346\350qc\257M\360\306\2039p\334\034ikr\341\370"
+	.ascii	"\332\021VF\266\225\315lD\311\013z\341'\032J\314\334M\211\021"
+	.ascii	"w\344\316\342c0\204\006\215 W\255\362\013\301\264\245\245\005"
+	.ascii	"\270\261`\200\br\005\267\2440\343\300\004\267\20250\f*Q\200\030"
+	.ascii	"1\363\005\316\342cpC\377A\255L\206\327\302\240a\2235\027\\\002"
+	.ascii	"\246f\003\013m\333)\"fI\221\031Y\214I\221=6\031\250]\223,\260"
+	.ascii	"/\213\203/\2020\036\214\361`\f\033\214q\003\0033\332\026g\306"
+	.ascii	"A\253\240UU\363\"\033+SCE\205>\205AhrS\202S\301)\324\256\356"
+	.ascii	"\252\016\214\220]PD\377A\251\372\3143\234\324\270\005[\240_;"
+	.ascii	"^\272rHE\251\260T\345G\024\252\365\024cD/\bu\221\244\231\235"
+	.ascii	"5\203+\354Z8\001\f>a=)$\314&\213\233gTT=\272\232\320.T\350\236"
+	.ascii	"D\261\270y\266wS'\023YaE\0343\347\341\262g\224Yp\251\013\306"
+	.ascii	"\003t\332\nn\\g\306i\252/\007f4:xj\201<r\233\314\306I\024*:\333"
+	.ascii	"l\"Sf\212\2245h\r\b\370I\345P\203\305\240\t\334Rc\361\227g\276"
+	.ascii	"/\031\315\345\202\263\227\222l\252\340[\235\232*\300\r\205\005"
+	.ascii	"\342\006I\013$Y\312<\243y\006\034\341\301\371\312\210paZ\234"
+	.ascii	"\317\\\007\353N\356i\361\363_6\363\013-\004\311\261V\304\342"
+	.ascii	"_\200\245\277A\022\031VV\026g2V\b\237\324\030\213\263\337\247"
+	.ascii	"`u\001\334\221\307\\\371\322\302dq\026\223\373\252\363u\371\371"
+	.ascii	"\346\216\216\\\205\351\250C\202sjH.\346\030\020t\f1D4B\233f8"
+	.ascii	"s\025@ PP\034\223K\266Qw\023\300C\013\214\304q\036H\235SffDD"
+	.string	"\222\202\242\024\n\323\001\226\026\222\266lYP\212FH-C\257\332\244$\333\210\024\235W\n\327g\210\022\203N&\023r\300\364\33526\032\202C\220\315\021\273N.\334\007\374>#9\351\237c\245\nT\r\t\020F\tD\r)gE?\036RLC_\324#\310 \227\024\206&\"\255\370\372\371M\247it\320\244\n\025\356 \336B\350!\305\032\324f\224\301\035\257\355\227\302p\371\374\367AS\302b\031\371\030B\013a\215qq1=@\263\006\357\003\266\252\346\31532[\334\346Jq\206\\\354\031\324\035\322@H\215\257m}\272\024\256\340\3229\033\271\255U\317IZ\237l\361\270\353\356\251T\316$*\031\024\016\003\331?1\2321\201\223E\245\204\265Y\374$\317a\233d\246\237E\276\r\221\335M\342\271l\371\221):\304\b\262\t\363\230/wg\352/\200K\2203_LZ\n\300@\265;\2201\301\241\006\247"
+	.string	"pj\347>\032\221\265\214a\240^\205\342\177\337I\271\033b\210ZM8$M\242)\307\204\275zb\004\3465\210\240=a4\340u\025@Yn\266\032\276\360"
+	.ascii	"t}\031\033\2259\351\343\373\256\364d\334U\242\222)\345\007\372"
+	.ascii	"7\232\222\026\341p _fF\356\263bD\302\213\035\213\211MD\270\215"
+	.ascii	"v9>\360g\302\255\324l\027W\256g\236\0219YB\275\341\337\256e\337"
+	.ascii	"\312\352t>e\243\"Too@/\225#\272\245\233\250h\217\331?\342\341"
+	.ascii	"\335q\332\322v>\220\206\372\311\261\356\036E\037\233\340kbs\205"
+	.ascii	"s\377\247\025\314\202\007\007\261?\022$\\\232)\220r\3502\006"
+	.ascii	"\326\243\006\222m\256\022C\324\375\221j$\253\347\224\227YbB\003"
+	.ascii	"\214\004\201\b9\324\037B\201K\205\243A}\026J\377\233\315\241"
+	.ascii	"]\013\301&\n\227@a\376Sf\277\220:\303\310G5W\277!\267m\245\333"
+	.ascii	"?\022,M\371\311\222\002;\r\023\005\027\3134K\367?\026p\224\334"
+	.ascii	"K5\007\332"
+	.string	"\233\364~\333\353\241<\nV\331-\200*\313\325,x\330\373pK\216y\023$\315\377b/OR\017\360!X\365o\\S\257\366\336\3237\273g\272\306\217\3129\203\203&5\270T\341\2015\004\275\006\336\203\345UO@\005\313$>\263\232\2510\204\266y\222\244,\300\3507\207Au1\310$\327\311\234)\324B|\373b\371A\b\345\002\234b\t\263(I(\376\203\221!6\241\303\274Z:;\343^d8\265R\204AeoW\212{qeL>\362v\352\036\200\301\204\361\f?\032J<[\272m\2139S`\\\007\003\247\317\205\366\232\206\020\033\213\030U\013\301\300\0345\374\217\n\261\034\315\020K=\236\233Gl\255\"#I_\371\335\234\003<\303\255\003\362\327\177&z\3422x\337\303l\270\201Y\236\334e\376\370\3241\342\235\035\370\354Rou<\353+\266\341#n\204\304ch@=\200l;\r\217wr\361"
+	.string	"\347t\035\033\353\363_\351\202\006\252M\246\222_\026\241\310\370\233\027Ql\210)\265\024 \325\262?/\\\372Po\220\340\030\324\347\024O\366\276\246|\376\332\"\360~\3765\2414\330\204'\177\225\261o\347\023\244\345\031\230\022\004+\nm\036\016&>\374\242\374\035\2065\341\371\216\034\b\007d\301\343\177\027h\"\202\206B\307\217v\026\344\002p\2606+\342S4\205\312\232!>/\321\352\275D\016\036\351\235kL\344@%>\364\354\303 k\212T\247\324\346\253E}\221\033\033\016\006\212\274\242\241\322\261\241\224\346o\1770\244\322U[\030\356\371\tg\303a.\344\217\336\256\211\307\267\020\363\371Y\230\216\242\302J\301\3549\002*\2608C3\237\327\330P\004W\304K\322\017>;\030\246[#\035\201`\353\"\002\205\b\275\b2;\340\325\213\320,P\356I\\"
+	.string	"#\210\022\313\312\251\341Z\220,=\nu\271aO\336v<\311\372ZD\360 \373[2\311\343\231\353x\354\254\020eP\255\bb\006\253\343\223\255z\247r\005\017>)\200\002\321\274W\321\354\323s\031\016Y$O\217Ux\342\306\314\237\377, \227\230\216&\223\353\202\217\237\222|\222\321\243j\241\326c e\024f\212.4\241\376\351\317\241U\305tv\032W\3276Y\006\037l\365\353vn\256\327\242-~m\016\304m\204\201-\205g\036>K\275\261E\332\016\342\036\240=_G!d\b\277\250D\323j\017\024\005\251}\\\362\223N\331>\332\361\025\351\3268\336\027Cho\020@\2563\310\335\225\206\360\335/L\002&\n\371\234<$\320\017iK\2456\312\321\016%\005\250\310"
+	.string	"\264x>\357w\304\326\371ss\325C\334 A\272P\234\271E\223\214^\007T\027\344\024\352\243\230\321\267x\364\326pk\0264\"\221{\"Ltx'\203\031\240P]\247\353s\\M\263/\375T\022\365\342\225B6\371H\016\213~\031\027\004j\267K\352\251$M\240"
+	.ascii	"4^\231\016\0341\355\210\271\300\343x3A\360v\3051\3212\247\336"
+	.ascii	"\310\344\240"
+	.ascii	"\003\030u\364k\247\317\277\034 \332Dj\257\254\007v\244-\254W"
+	.ascii	"\254(\220Q\260P\242\361j\221\346\253@\225#\235\346\001\031\267"
+	.ascii	"D\201F&\217\376\203\315:\247\325\210}h\0010\254h#\233\265Xx\305"
+	.ascii	"\220"
+	.string	"D\312\256U\026\\\212\216EN\334\276\3156\243\300\274\"l\215:\236\220\277\256\367\006\356\267\021d\021]c\212|\023\241&\244\265\326\224\322\032\037\251\023:\247|=8\255y\304]\b\366\231[\225=\224\001\226\030P\327(\363\r\241\211\273N\325\303\026\320_\023\364\310\350\374\017v\037\017\227\320\266k\006r\217$P\234o\026Fn`PZ1h\371\217'\247v{\036\313\344\212\004\322,!\311\261\032\261\266k:A|\265\230\236Fq\222>\346`\3446\246\232v\333\370\031+\246w\357\210\346\225\222\2769\342\304)B5Q\243\340Q~\201\323\035\036\370\214\025\204\037\274\352\030\\gU\200\026\021D\360\311\204\344\276\326\t*zK\306] \037\307\267\334\266H\243\031y\022b9\224\277~\340I\263;i\372\246\024\250\222\233\313M\273\263NG\204\327\006E\b\362\320\362S<!\213\177\211n\t/\213 \363\250\236\202"
+	.string	"\177\247\376\317w\276\306\032dP\246,\254\003jW\035\276\345\220\n\031\3320'U\276\244\2015D\261\254\237\003\361\nI*\f\347"
+	.string	"f9;\324cZYQ\022b\035*\304\0010\021\2238%\325\2353\350\230r\364=\342\250\240\372\350\177[Y'\200f\251\020\270\275\023\335FMA\222`\fx\037\270 \264\307\247%\323\007\023\305\363F\324\303qJ\207;\225\301\036\2129\036\333\267.\261\351d\314\326\304\303i\226^\206\253\347i\357\3749R\236j\250\363\230h\261\305\246\333\344\260\\B\326V\347\243\315\3676\375!\316\023\024\207\036\245l\005\244\033\225\177\242I\263\360I\303\355\303\246S\340W\350%\337\373\222f\314p\021\217\275\275\213\370\266\342U\325gT\234\261\355n}\227\346(\205\351\273"
+	.string	"\3458%\273\003A\rp\236a\300i<\2374\037tB\270 \233\311\335?o\233\242l\244i],XyHF\316\334\002\325[\321<\205\005\375\271\353=t\370\363\246\202\250`\231\303\321r\366\037,iq\240Q\211W++\311\227\214\373)\325\026\247\230\0314\341\216L\377\b\013\351\002b\346\342!\353\363\331\225\370b\315]\374o\211m\037\203\022d\225\325\3619\016C)\266)g&\3119\362\206\341\ns\317\237\326\265n\316}\364}\032\rrDy \352\335\245{+\322\235Y0\274\372\232\210$\261>\254no\217/\022\374\036\201\327\234\344\376\347\232Ys\224\377zfJ\347\313K\001\260\315\276\264h\215\366\225\"u\271\f\341\376\241\203\007O\007\251\376\342Oy\270\366\336\241\354S\361\\#a\343\264\320*\314\303\234*\3300\035\267\335\250\206m\016'~\247,"
+	.string	"'{\205\300\275\353\007t\0031d\036\344\003\024\031\026\024\305\213\216D\370S\005\374\313ZY#v\202\223\363^\343\207\261\016\324\034G2|\300\374\274\313(\230\3340\200\177v\303\323\2224Q\251\236\"A\346\\\355%\263l\351\377\002\267 \313\235+\341\332\f\352\275\263\223\\\004\037\201Fa\033>\2408 s\244\234Z\227\nY/\023HH<\013]p\217\216izs\236\250\277\323\004\346\035\267\334\344\334\021u\035\274\006\372\233\254%\216\305\242g\321\241\262\033\376N2\360u:&\301\351\200\206\240zC\201A\262\272\033\253\324pO\210\344\324\333\234\354\b\274L\202H\f\024\212v\201\264*)\223\200\227\217\f\017"
+	.ascii	"\306\324Z\260\254\364q\030qDS\035A9\220\300\202z\256\007\257"
+	.ascii	"1R\021\032&\250\306Sh\210\367s\355\260\314t;\027\362\250Kj>\335"
+	.ascii	"\300Vd\313\230\353\341jqYvu\356$\253\025\b\321\254\245\365\025"
+	.ascii	"\250\020#\306\214\327LI\003\355\221\031c1x\204e\002\346\373<"
+	.ascii	"\345\262\237\237\347\326\013\320\332"
+	.string	"\021\315\b>\350c\324\003\331l\310\210`\226\214P\317;a>4rD@\2555`\fSr\317U\336J\350p\336\265/\242\335\227a\234\365g%Z\003\0078\246\306A\004\207N\r\033\317\346\033S!\026\337C\324^\317\\\317RwN]\001\223n\230/\200CU\212'+{\017\f\312\204&\313\017\"\312\312h#\305\321?\3757\316:+HD\367\2507Ek\211\367\354iw\201\210\215\261w\016\t\037\206\260\261\177\234\246\245\351\212dC\335\365*\364j\025O\232F\252\234\224\030$w.R7\253\244\305\017\261\256\355adr>\263\356\035w\377\006\321\274\301\210\217E\357\234\364vS\035L\341\031g\277\347\371?9\\\235\244\177t\203`\317\201\330\237\312^\233\335T\277BzE\007\316<\321l\305\204\214\274y}\027\017\243_\271\373\217\026(\216\376\276\013g\350\001\214\301\271FC\230K\034\t\345\222\234\350\353"
+	.string	"\272@Sl5\266%\340\275\006A\n\303\357\263\323\251\230\024j\260\210\207\004\332)\016 \342.\312\375\352\3601w\373\262EX\357\274F\330\032\277\276r\020\376*!n\317mZ%{\\\277\023\313o\301w*|s\330\330\300\305\204\255b\032\336\004/\031q\336\273\023zy9\3455\006\373\220\310\305\333V\340\201\177C\313y\274\313\306\316L\177!y\237\251\217\003\334\351\"\257\324\006n\375\017\354\327LN,\355\267\232\t\311\023\252\030\330\021\227C.\331\324\376SM/\261\237\353\277l\360\330\354>\2045W\324\324\312\375\230\023\036I\205\213X\375f\214\373\305:\304\340=\326-\020\311\222\275\334\030\305{\f\353\264\236\233\210&\321\351\332I"
+	.string	"2\327\355s\307\260\024\366\035\314\374\033\351o\022\262\207\2700\f\314q*\331f\367\032\353O\372\\\210\246\025Y\354\222\210\255<\376\210\373\220\367P\263=\254\207\340\232\336\355\264@\356+\352_G\366\bs\373@\371\025\225>V\274\321#|!~?eZ\341\325\230#Z\313#<h\271\202\337J\215tf\031\024\036\353p\252zV\241\177\313\362(~\332\351XI\267\203\343\353\247\321\257\022\013\364\271\240\333\350\260@\312\013\201\313C\374\b\266m\260\247+}\351\256A\225\354\240\343\177E\323q\037\376#\336k\372\276\256\315\330\306\324\262\004\346,\333\223\210\033>\237\244lho\220\270\235\254[$\360}\365\214\264N\233,\232=g\263\240'\373\332\261/\276;*\330\360\276\371\330\237\371\300\275<"
+	.ascii	"\373\331\367'\307\016]\226\201\347\324\301\256"
+	.text
+	.section	.gnu.lto_.symtab.618aada454f0f21b,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"accGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"applyAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"accelerometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.618aada454f0f21b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
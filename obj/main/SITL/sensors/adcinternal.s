@@ -0,0 +1,162 @@
+	.file	"adcinternal.c"
+	.section	.gnu.lto_.profile.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\356\346\366\357\t"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	"\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\001"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\334\034c\003m"
+	.text
+	.section	.gnu.lto_.jmpfuncs.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \021m"
+	.string	""
+	.string	"8\005"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getVrefMv.3.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \332-\006"
+	.string	"\202\213+2pM\322\001\240\213@!\f\220\273\337P\206l\027l\013`w\030\330\327\315\036Go\247\354\206\031H\022\374\377_\225\303>L\"\300\030\205d\023\262wJ\001\246$\205\311\301\312\342*T\302\244\021\276\350\252\250\2562-(\005\243J\006~\f\025T\313{P\243\271g\233\001\222\313V\340\300\036\354\211Y\254\302\276\263\273k\266\261\027\0242B\360\261\033\221\202\262\"\017\b\206\355\213\035\371\032\337\270X\256y!\321:J <Nv\247\002\\\240\375Y\017h\177\230\305\345\227\364\317q'\203\302$\243\301|A\b\273\353\225\321L\334\354\266\017l\253\355\206\007"
+	.ascii	"2\003\356\231\301\300\341\3175/\013A\206\273bj'\031"
+	.text
+	.section	.gnu.lto_.symbol_nodes.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003\177"
+	.string	"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"(\265/\375`\342\001\305\022"
+	.string	"\226\345\204J\340\2608\0350\301\037p\303\345\023\031\344G\323>&\224\325$%8sL/\240j\265\277>\001\337cW\260Q\364\311\32788JLu\365q\035E\304\006t\200\247\030A\372\245\342\254\364Y\317\205\tF@\307\177\240 \3547)\003g"
+	.string	"k"
+	.string	"o"
+	.ascii	"4\347O\343\262\360\227\324K\273\210\246U\231\330a\257\037\301"
+	.ascii	"\357O\376\265O\373_\377s\224\261\373\207\030Y\031I\376.\006\310"
+	.ascii	"\307\252\317\353\337x^\364\2306\2159?\237\235T\366\225[\333\302"
+	.ascii	"\316\313\376\203\226]Zs\016\373\3373:\231\371A\306\026J\231\233"
+	.ascii	"d\346\035fnf^\301\314[\255V\2531\363\0073\233\314\033H\250\371"
+	.ascii	"\317Z\236\312\334{\212\376\343\371M\374\2759\372\210\232\335"
+	.ascii	"\025c\330{\226\336\257X~<k\037--\217X=\233\242\325\263\0275?"
+	.ascii	"\276\266\035g\267\343iz5\027-m*\232#\233\242\246\354D\013\026"
+	.ascii	" v<\013\031\023\313\021\315\336\363?\177\363\274^\206\374\261"
+	.ascii	"\263\374\021[\272\307E"
+	.string	"cq\245\020\317\276\377\017\220\256\230\363#\315\006\334;\314\013L\332D\307o\363?A\200\231\234\027\314\026\352\3339\215C\352\031\267N\247,\022\357\365\330fn\240\320\331B\243.\300mM\200c\t\0357\211\003\325jM\342\270\004_\230\375&\374uL\352\230\233\273X\376\367 \272/]\035\\\213\272E\230\0074\250C\2309t\020{\334\327\032\032\335\b\025\342\313\026:\253\374\242\371\373\322\363:\244\001\f\302+\0250,\265V\253\260$\2405\301\364\265T)\r\035\177\037\203\017\b\017\032t\250\021\f(\252\020l\251R(\n(%V\270b\251@VI\225B\311PB\205\254\322\310\307\006\007\025\3000B\013L\001\300\250T\b\252\300\224\216KL\nL'\0348\370\344Dr\"\341\370\344\364}'\323\327\261\351\00317\211\266\341\276\301\351\233\336i\222\273\\\300\234*\215\025\0206\356\022\023\021\235/0\0305\002\030"
+	.string	"\270\0208j\207\214\351\354\364u\313f\235\2011\024d)\215@IQ3\322"
+	.ascii	"E\005\201g!Z\343hkXj\r\247` \251i\214\320CE-\331\241\273\227"
+	.ascii	"\302\346\2466\256=W\314t\306['\031"
+	.text
+	.section	.gnu.lto_.symtab.63dc0ebe3d20b4f4,"e",@progbits
+	.string	"getVrefMv"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.63dc0ebe3d20b4f4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
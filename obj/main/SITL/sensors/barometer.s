@@ -0,0 +1,802 @@
+	.file	"barometer.c"
+	.section	.gnu.lto_.profile.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\017"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\013\001U\t"
+	.string	"\004\f\377\001"
+	.string	"\035"
+	.string	"\245\357\300\317\017\026\002"
+	.string	"\002\001\002\002"
+	.string	"\001\367\255\350\337\016\n\002\003\002\003\002\004\002\004\002\003\002\005\352\263\360\321\b\003\004\240\342\234\212\n\005\205\320\323\240\004\016\003\002\006\006\007\b\t\274\205\242\255\006"
+	.string	"\n\267\335\335\337\n"
+	.string	"\013\200\333\377\224\002\f\r\265\372\210\203\b\016\350\300\306\254\005\002\017\347\327\360\252\007F\002"
+	.string	"\002"
+	.string	"\002\007\002\007\002\b\002\t\n\002\013\002\002\013\002\f\n\r\002\013\003\016\002\016\002"
+	.string	"\002\017\004\002\002\013\021\253\327\227\253\013\023\024\025\026\027\030\214\323\306\336\004\022\002\002\017\031\032\371\364\264\234\013\026\002\003\002\003\033\364\201\355\242\016\034\035\364\302\210\333\007\036\240\342\234\212\n"
+	.ascii	"1 \200\002BS\345\001\002\002m\\\340\220\262p\031\001\2443\340"
+	.ascii	"\333\235\013\025\343\203\200\231\f\2422\266\276\243\261X\304"
+	.ascii	"\307\273W\032\377\202\361p\027\034\2620ga\363\202Ew)l\262{\242"
+	.ascii	"k~\004\346\223\204\223\232m\234$,(6\375\n\255]\\\030s\0276&\023"
+	.ascii	"\341\2059\340\276\003\271~\274\345/\202\2050\234\322\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375 o}\002"
+	.string	"D\003c"
+	.string	"\013"
+	.string	"\001\001\001\003"
+	.string	"\002\005\003"
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\001\n\002"
+	.string	"\020"
+	.string	"\007\013"
+	.string	"\003\r\001\016"
+	.string	"\003\017"
+	.string	"\001\030"
+	.string	""
+	.string	""
+	.string	"\032"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"6\205\244$\200\276T\255\"\225\2207o\370YO\345\332\213u\033h\003"
+	.text
+	.section	.gnu.lto_.inline.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`$\001\005\b"
+	.ascii	"\362K+1pM\322\030\220\373\207F\240)\202\362\313gp\343\375B\303"
+	.ascii	"#\367LJ\346RNCh\273\221\371\337\247\177\372W\345\337\317\207"
+	.ascii	"\366!G\331\337[\312\235\002?\215\036\021\233\005M\236\214hp$"
+	.ascii	"|\360;\030\261\035\374\250:\023\f\371\372\364\023\302\021Q\330"
+	.ascii	"Ra\353\237\332\016\352/\265\213\306\030K26\030\022\r\232\254"
+	.ascii	"H\361p\256&\220.\211Qv\304\2506$\340\260\273\017\257\007\354"
+	.ascii	"\240\"\344_\311\365z=\335\360\\\240\024\334\036PL\356\356\002"
+	.ascii	"|&;H>&\006/!\252\016\305\364:)\235\236J\220\335\205\362WF-vW"
+	.ascii	"z\350\264\004& \340\002\2411\356\262\001\204\006\361\241f\004"
+	.ascii	"u\334!\220\312\020\373\331\277\230\017\034\343r\263j\\\204\f"
+	.ascii	"\315CR\302r\367\303Y\033\222\201\362.\303\255\001\002y\216`]"
+	.ascii	"\316\221\024A\033-\200\307P\253\313\2225V`\312u\266\343\252\t"
+	.ascii	"\264\206\246\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\235\005"
+	.string	"r\211 ,pGI\007\220\352\003@ a\250\023\037"
+	.string	"@@}\320bX\202J.D1\bA\270Qs/r\355\201\377\r\375\331\031\333'D\312\024O\024\210\300\260P@=\246\265\006\002\212\032\250\224}_\002hF\263\371\262J9\251\213\007\244\001\313\005*\351b\037\324Zk\316C\277\210(\376\201tG\237l\342\021\037\357\261F\345\243\307\350YH\256\303qr\310\311)\017(\253&\253x\243\253\021\331[\344\317L\b\022"
+	.ascii	"F\271@*\n\\<\b\f%\203JPt]-\315\b\233\2343)\231\244\3144\004S"
+	.ascii	"\360\343p\235.?\205\306\314\324+*B\026\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\232\004\001\230\004\005\230\004\t\200\004\n\200\004\013\204"
+	.ascii	"\004\r\230\004\016\204\004\017\230\004\030\230\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\305\005"
+	.string	"\022\t\032\"\260\245\225\003\fd\2510\201%I\216\3030P\355\001\273\315n\357n\233\2027i\r\027\367\366\222\235d\n\372\241\320\331\354\240\221\204\363t\026\330QOj\027\360\004\370P\204z0\270\347\025\376e\232\222\202\344\300@\3245\317\305\206NzJ\273\350\031\275V\225\22751^\316\371\314(\0328-E\347\272\320\223@0\0277\020\" p\002)\245<\205@p\271VD\300\241T7W\030\001\004\3579\274\345Z\021x\244\223\021lB\200\003\214\225-"
+	.ascii	"\245d\315\006\2711\210\033\037\226\255ur\211\330^\n\335&\020"
+	.ascii	"\303\325H^\360\370\376,\261\304u\301\225W(\305\034\002"
+	.text
+	.section	.gnu.lto_.lto.fc09261fd60d6d4a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.18.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375 \243\305\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\202\200\200\374\342\203\276\234\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\316\007us\250\345\006uq"
+	.string	"\005\001\006'\001\016\005\001\006\035\001'\001\246 ?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_barometerConfig.19.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\252\001\205\f"
+	.string	"F\025QD\020o\225\016\234\270D\256@\362?O\373r\3342\232\b\032\237\023\221\212\236\277\310\357\210\021j\2547\204YM\300\"\200 \266o\257\373\342"
+	.string	"h\004\324\341\016\"\016\364\300\365\n\273\206U\2124\236\377O\202\310N)9"
+	.string	"="
+	.string	"A"
+	.string	",\025!vK\021k,\357\\>\343\275\263\234\303{g\322^\361\321"
+	.string	"\343f2m\273\373q\023N\236\222\3763\374rR\221N+&\273kzR9\270\271\333\016\261Mb\323\222\032\024,\350\240P\341\235?\362\336\t@AX\275Z\224\350i\227$\312I\260O\331\3355\307\262\017\373iF\2072q\3608wS\247\213\245u\",`l\237\332\177\035\003y\330\350\033\273\001\234\227\250\255\323\3269\211\332\351\362|\004\213\033\210\333\006.\253\335\\\376\374\303\330zq\360\036\306"
+	.string	"\251\024\253W\305\004\202w\210`\272(\263\213<[\274)\272\3106\3302\037=;\301c\243ewG\374\035O\001\020x\242a\216&\254\241\372\001\303\r\201O\fA\021T\305\017\344\331|>N(~\032\020\203\007j\370\205@0\3740\345\236\262\034\313"
+	.string	"\036\320J\034\203\001GQc\346\354\366\346'\352\005\263zv\" "
+	.string	"\203\221\321m\205\252\">^iF\203\260\221\201D1\227\007\305\030/GGx\340\017t\033\362\261#3\177j7\021\b\212\217\f\247\315Kj\207\267\343\037\312\326\247'\001\347\032\020\333L\347}"
+	.ascii	"\315<%\340\360\242\365d"
+	.text
+	.section	.gnu.lto_baroPreInit.26.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375 \304M\005"
+	.string	"\222\t$-pU\323\001"
+	.string	"\345^?\273\020\224\242^\254\026c/,u\310\206m\3360r\352wx^4\377\377\375\313)\373\317P\017Bn\355\3362\005\237\242\031\255H\311)1\230NI\253H\271rH\024O\223rd\270|\304\311\226\224\223\241\255\027j\007\b\214\374\333\365\240\345\337@C\355\177\005\216'\321uO\272\200\356\b6\231\377\013\275\376\237\3350\275\\E\302\001t7\303\313\326}\365\273\232%`\331\265o\260\350\356?,\243\354\341\376G\374W\374o\004\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_baroDetect.27.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"\365\007"
+	.string	"r\01776`m\322\001\300\215\326\220;C&\366f\314R\002\201\335x\300\266\020\364\214\020\302\017\332\355\261XH\255\255\035\342a\223\0053\254\233\215\323\231\330\300\021d\320n{\247\024\2216H\2068/\t\317\274\0262\021\321\343\334\331\314\030\212\0379/\007H\247\244\240H!\350\341\372\300\316\244p\243\261\204\210\023\206\244\234\020S-\236U\315\211\354*j\316d\377\262\273kW\262\217\372\357\256\261\221Z10\331\035\265\260\254\312C9\331\306l\214mW?\202\0355\341\200]\216\024\216\365Wpi\315>\310C\260\213P<\263[\3728\331\255\007\336X\177\256'\250\376\254\017T\177\266\315A\300\234\275z\214n:]\224\244v+t\035\317\3362_\200T\361\006\220\260\273n\030\244\214\333\335\266\306\266\202m\222\f"
+	.ascii	"A3\240\314\200`\330\250\260]\205#\327\224\213\211\030\204\317"
+	.ascii	"\324(\270,ij\342\275\212\023"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.28.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375 \375\335\006"
+	.string	"2\315/3pk\322\001\220\024\030\3121\210D\344\314\203\361\b\350\231\263\303\367X\b\325\266\241\241cl;\365\213\347k\263*V\256\375\311\251\375\f\027Y\370\023B\244L)\256L^\3034\213{\224\005\006\237\203\227\006\331\205\201ba\225\007\331d\300\256\241=\206q\3561I\334\253H\225\240\243\036\373\231\352\252\372\017\311s\214gd\374\221\0354\371\353\224\257\251N]\003 :Y\262#'U\302\376\264*\262\235\326L\177\022\340\360P\370\330\005\225F\266\203\"Y\330\336\330\022\037 ll=R\200^1\372h\210\354F\246\023\267\236\226\377\213O \033!W\210\363\004H\330]\347\025z\270\365\266\013l\033\330\216\b\t"
+	.ascii	"2\001#8c\216#D\250@\\\023\037#\362\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.29.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"u\b"
+	.string	"\346\320=7Po\322\001 \361\245\233\252_\t\230j\f\235\213\226~\r\343s\232V\313rk(\331\035Y\026q\3335\277\225X\324mD\255X\301()\017\221bv\315\310&{\247\024,"
+	.string	"."
+	.string	"-"
+	.string	"/\270\036\315\331.\3578\366'\037\025&\251\335\225p\343\334\037\347\177\344\002\244\222\350\017`aw\375H\245\213\033\336v\202\355\006\333 \001\320d\377\364?\213 \325\342\240\262k\261zYTL\361\260}\214\355\367\354\207\\\204\373)\344\270\233\261\202\262\333)8\023\3608p\203\353\361\005\264JL\267\267\026\232\254Q\241F\220\302\017\372$/\t\371\035\236"
+	.string	"\275\223\036}\320\365\030M,*\214\321[\331\235\350A\r\373\326\356\256\003\017\263j\022\021S\263MN\006b\360P\355\203\325\215\306\301\262\003g\231:?\263C+\266\221[\245\233gn\322\243a\035\231\325Mf\020L!f\225\037\032\007"
+	.ascii	"2\241}/pq\241\304ehb5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.31.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`#\002\345\022"
+	.string	"fc\177H\3200'\035\300\020\366\256\254o\302\336\303\336\312\003\361\274\220\003\210\362\246\017\013\350W?%\267&\337\016~)?\266\027GZ\2011\025xb\304c8\214\354U\370e\302S\016\374'x,\313\020B\240\351&\266\221\275\345N)j"
+	.string	"d"
+	.string	"m"
+	.ascii	"\265~\260z\252\265\232\370\344uj\3337q\243\031\333\346\030\204"
+	.ascii	"\203eX\302I\221Uk\225\211<\244;\235\037\320\235n\210\333\336"
+	.ascii	"\321\271\322\346\323\274Kq\222!\3426\234N\222\253\026;b\270\233"
+	.ascii	"\031\242C$b\220s"
+	.string	"\347;Ir1vb\270\333\f\231\001\342\306\223.sp6R\272Pj\255\226\"N\303\355\272\355\b\266Sl\371 \022\307M\316\346JG\341(\177\310\025\f%/\236\372\206\352N\277U@S\271#\0165\262\207=\322\310\375\261?\353\372\304\216\364\303^\226\236\037\357\355\244%\225>\310\201\242\034\217\020\323\326\030\253N\217\255*E]\210\370\370)WJ9\355\031?\311\037\266GG\211\334\306\212K\320\224eTr\352\005\362H6\003\bAZWOt\177|\032\035\220\266\344\037B0pX\310\327\356\346\330a'WE\311\306Mj\371I\356\356\350\330urMa\225\200\255\355\013o\262\025\240\252\265*\360\227\316D\363\207Nm\341\373\272\323\032\320V\356\210g\356\317\303\316W\361\025a\314\313Kw\352\"\221\243\b\353DbNj\367\307&\177-\001 +\245\252\233\3242\202\177_\0332\036K\215\2017\301\2056s"
+	.string	"#\343\325@ \324ZXf^\003\017\244\020\206\036\230\022\343\325\004x\345\004\364`<\332\007\316Td!\370\2055/\224\325Zf4\331\n\030\312N\f\370s\361@\031\314\367\201\262\217\261~}\374\236\027\023\266O\372\210Hc;\347\032\245fm\272"
+	.string	"\362'\036\365\215P\325Zs\021\312-\022\344\305\330\336C\317\b\036W\267\245\t% P\242!\350\366\221\003\316\234"
+	.ascii	"wW\354e+\324\352z\213\352\013i\343\024\r/`\002\370\013\237V "
+	.ascii	"`H\222\017\341.\031b\370\006\211\342@\006\034!\237L:\264\216"
+	.ascii	"qs\340.\024\2767\\C\201c\271\022\334\3407{\020(\t\007\025+\263"
+	.ascii	"\342\315Q^#\342\313\036cJ\321\241"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.32.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\251\002-\025"
+	.string	"\266g\214J\300\322Q:R\224\337Ur\\ef\237\354XG\304\234\004\372|vz\253\232\212\324s\350\256`\207j\372<\321\237\356\372\202\035\025\314\216u\214m$\013\305x\300'\007\266\320\203\334\020\256\203\257\"r\312\243\325\333>\331D\356\224\002w"
+	.string	"k"
+	.string	"x"
+	.string	"a\221.\206R\255U\305\016\346\203\2730@\355\361\200H\260\3236p\240\346D\027\274\265\002\177(\325\032T\361J\353\324\266\217\342)j\274\013\203\"~"
+	.string	"~\254p\216\250j\r\316\006\374D<\r/\023O7\304w\017w\356\374\037=\034z\272\362\375x\017u\276!\001`\016\035\222_/<\341\301\003\344G\2379\277\2339Y\nj\255\236\276\237\207\233\336v\003\3337{F\005@\306\231i\336w\352\233I<\375R"
+	.ascii	"\352\001\252\330\261\231Wv\2207\327\307~X\267\3076y\360\226="
+	.ascii	"\370\227\274\350\217\235\350"
+	.string	"\207\275nt\273X\323\255\235f\261\246\305\235\246;\035\356\364\356\364\334\351\243\\\250RM=\330Q+\207+\"\025\212.\225\270\321\305I\347\3325\376\221Gl\033\271\251\305\353\320B\372)\"UkM9u\205+\333\251\203\256\270\267p\033\272V\023]\327\222M\215p]Q2N\354\354\332\306p\032:\224\036\265V\004~\322\225h>\320\251gj5\361\2246\371\204\300flm\227\227y\337\356\234\n\202\252\222\352-/\\\237\303\210\376\213\303\200\261\221\244xJ\205\220\206\206\234\204\017\b\265\353\343\327\316ea\341\2437\255\f\333\271\245\323\r\234\"\005\376}\355\f\242\001x\363\026w\341&?4c\313\215A\216f\274\305\\n/-\2641\002\004\335x+\211\241\345\310\tc9\203\303\215\245\f,w\233!\027\214126\232\204\230k+\345\230\033mdIc\231\341J\022w\033q\263\333\013\3156\253\225\270\331\212"
+	.ascii	"\2232c9\313\221d9\033\t\326o\217\037\025D\264)\037\031\261\001"
+	.ascii	"'i\276\326\2659\266M\226\344\303\n(\233\275\261kq\2602\314\250"
+	.ascii	"\332i\255lML\260\266\025\363']\313\211U\265T\262b1 \240\"\031"
+	.ascii	"C;TF\222,]A+(mk\315C\026\b\021\242\263\262\354\345\f\343\333"
+	.ascii	"\023\007\n\365\r_\214\305\t\204\272F\007(Ky\331\262|\270Bj1\315"
+	.ascii	"\231cr\316\326j\223\302\020\034\237\355\205\271\335\001\371G"
+	.ascii	"\225e7\353\221\340*>\306\250-\237\306\002n\246\216\225\007\210"
+	.ascii	"\325\032\302\205\201\307\233\215\351\235\f\024\3055c\323\350"
+	.ascii	"\024\r\356\001"
+	.text
+	.section	.gnu.lto_isBaroReady.33.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375 \352}\006"
+	.string	"BL-3Pm\222\016$!#\202\242\2324\263a@\201\242\226\361\346*{Kv\325\376\335\016\2736B\251\203\367\346\230\231!r\272H\345\276\300L\035\032\323,\3312\005c,o\332L\031\367.\013\215z\216\322LT\3230\\2\r\363\250f\031\3305L\257m\234{\255re\231\b\031\301\207=|;:\252.\306\016\034\254U\351r"
+	.string	"*!\023\230\370\340\311_\036d\024_J2\321\217#3\030U\304$\023tR\222!\322G\306\337\371\312\b\t\235\253^\026\240^p@x\220d^\215U\264*V\267\033\245h\200\214X!O1@!3G+$\321Y\377\202\377\340\217\b\b"
+	.ascii	"2\003\316:#f\b\3055\361/\002/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_baroUpdate.34.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\314\f\0055"
+	.ascii	"\312V8\023E`\336\316\030\373\377=\360\216#\300)|\334\021\257"
+	.ascii	"\377g\247\330;\302\340\374O\306<\354*T\"\304\244\330\302J\324"
+	.ascii	"q\206;\323d\024\033\370\013\037K(\320m\352-qB\"\216&\370\307"
+	.ascii	"hi\311\226R\312\224R\n\032\001\013\001,\0015Bgc\320\271\330:"
+	.ascii	"\023\207\316C\241\263p\350\034\024:\267Ag\266u^Wg\225u\376\325"
+	.ascii	"\331U\347\236\260cuE\004\334\373JM\321\274x\253\224\037\r\355"
+	.ascii	"wgnf\206\301\255\306\304\206\276\b*M\005\225\270\271\205y\337"
+	.ascii	"\265\004\275\262P\260Wn\264.\002\203]u\315\311d\335\226@%1\363"
+	.ascii	"\276kC@\215d{U;\207\355\365\277\332m\3441\007\007\300\215M\215"
+	.ascii	"\261H\034\n\203-\273\252\357.7\321"
+	.string	"\336\334\222\251\324\310\005jA\216c\235\323yScb\216\003\240\235\300E\025\3267`N\267Q\0178\321b\326eS:\324\244\031\326[\336\324\225\327\030\313\246\264\274h\201L\006q\030T6\205\303\205N\326\301 .\252\253nU\240\274\251+\025\350}_\"\023\312\331V\353\013bwb\270\250\310z\335\312\221\325\\SXO\3540\032\026\0352\235X\325F\277\212`\253\316F\r\263IE^\351\332k\265\366(&\223{;\341}_\366%\223\2529\331\314-\305\314\017\230\211\200\001\257\304\314\025:\357B\222\031C_Q\036\365\336\367up\327x\0314l\330\300\366\272\376\032\225>\241K>\345~k\035!xJ\036\310\321\260\250s\375f\035\267\235\212U\205\233\356gD\311q\317y\340\024\356\270\006\003\205;J\207`{e_\276Q\\\200\274;\230\373\t3K\203\357\253\324[\314\314R?\276Obta\336\367="
+	.string	"\004\345i\234\250\357aO\375gf\005\335\204\203\215\223{I3\361\300=\326+\177"
+	.ascii	"\001b9\306\377\277\241\322t\222n\013\341b\304\b\266W\377\265"
+	.ascii	"\271\345\331>\226[x\337$\330~\023l\\\232\034\220\271\215\364"
+	.ascii	"\021\022\334c\\\242\310{\331+w\021\333k\377z\246\345\357j\311"
+	.ascii	"\247\314kL\255\276\337dn\365}\337\227\277\007\263\004\242\006"
+	.ascii	"\rm\016\n:\003\261\316?\254\263O\321\271\207u\346):\357\250\316"
+	.ascii	"\003\206\316\002\214\316\001\212\316:\252s\322\350\214,:\037"
+	.ascii	"\213\3169Dg\234\241\363\215\320\331f\350\034>\334.\356\261\234"
+	.ascii	"o\375\340\376\256\030\214\211\361\3505\007s\277\202\376\345N"
+	.ascii	"\267\313m\272_\336K\367\013\307\351\225\300\274\351\212%{(\217"
+	.ascii	"]8\277\312\301=\241\017\320\354\276\330\3348\017\nH\247\357p"
+	.ascii	"\0356\177\363\036\310\\\313E\353q\346P\3528\263l\276\365z\263"
+	.ascii	"\322E:\263\232:,\2776c\215\337p+\2572~\315\017\257\341T\3164"
+	.ascii	"~k\325F\245\213t7\212\305'\n\342RN\303g\024_h\205\244\212GM]"
+	.ascii	"\206\307p(\242k\346N\027\222\336\244<:\023\361\327\3504\332\305"
+	.ascii	"\2713D9WB3\374f_\017\247i\224\006\234\201\302\037\236\365\031"
+	.ascii	"\300?\341\267Uh\244tq\356N\370\315v-i\031!\301or\231\276>\004"
+	.ascii	"\321\260\270\366\233\214\202\r~s\261uir@&\300G\341HFi@oL\373"
+	.ascii	"\301\347\360\3540.\032"
+	.string	"\017\030eR\332~[\325\007\327\305\271),\373\022\336\003\331M\353=W\215\200\027\245\217^\027\366\205U`\240\264\336z&5\303\367\343\275\326Z(\374\350\275\357R/\263(\0138\261\254\317\020v4\005F*Nt`ad\224\"I\310EBHF-\214T\034!\22501\224\204t\224\264\302(ih\305\211\022*\206\212\220\222\206\204~\370\210\205\021\322P\213\243#\244!\342\332R\177\017\356(OD\242\357\2649\351\261\301\273xB\203\255^\277`;\rM\272J\370\240\217b\346\240\257\311\252\302[z\246\237N\247b\220@\337\300\355\\5\002^\247\364q+@/\264\272{B\217?B^\205\312\317\267\360r\007\225\306\307\343\\.\352\315Q\266\347}\244\364|\353e\367\274\342Y\340P8\3508\334\316\363\274\355|\353U\367\207\363\205\257,\247\331z\3007\227\273\r\370vH\335\363\ng\355\020\354\022V\216\n"
+	.string	"\271\266\250\031\276\035;\251\337\215"
+	.ascii	"'G\202\202\307\331\224\311#\002\276\265\212>\241\001~\355\277"
+	.ascii	",\307D\360\234G\276\216\f7\312{\031\340\201\236^\211\223\257"
+	.ascii	"\363?\303\323\\\251\340\37369`G\363\".\263\206[U\305\366\232"
+	.ascii	"\374~\003\203\022\361\247{\303\305\302b{E~\353\027\367w\314\362"
+	.ascii	"!gf\307\027z\305=\257r\236\331\325\362 n\327\021H\201\004\250"
+	.ascii	"q<\347\0344$\"\222"
+	.string	"$)d\032\003\001\006\204\020\347\234q\003\021\320(\305\034r\250\306\226\332\f\222\202\003\272\225(\344\352\376\023Z ]C2\304!\027\265\354**\335f\332\324\257Q\205\207\035\274\210s\2513\306o\021\016q\306\006h\207\2173(:\022nO#\251\f\220e\231n\222\024(.\345$\031\306\261\361\274\333?\267\210:\327\206,o\333kX\230\364kQ\364\340iA\351\003'\n\276\300\375\250=\262\021\332\r\013\031\306\244\027\243\361\bY9f\274\2118!\277v3\3536S\203\231\306\356\225M\270\020\020\341\313\200\017\376/\351*\005\341T\"\037\023\001\306Qi_\252\241\2503\3428\350\365\337\247\2629\017\374$t\307\253h\260#,\223e\337\016\034\254\311\336]u'\037\213\\\n.\007.]8p\370\202\223\202\357\007\200H\300\363f\312\003\224\240\207Sa\372\001\021\032H\361\027\350\307\035\227\334\212bml\264n\321"
+	.ascii	"\273\214\036\314\205)\"\331u\342{.\322-\344S\242\3307s\322\355"
+	.ascii	"\202\321\231^\344\034\303x\361W\236\343|v\020F\341\373X\331,"
+	.ascii	"\002p\242\326\356y1\357\256\225\035\035\330\0036\350&\376\301"
+	.ascii	"ek\013\354FP\307\374\340\207\f\330\017\224V\031\272?#\224\206"
+	.ascii	"\"D\272\027}\2164/\212\"\276\351i\357\343\342\234\361\t|\227"
+	.ascii	"\322p\337I\334\201\200\035\020v[\0325\322y\256C6 n\243:@\256"
+	.ascii	"\0027\022\200+\204)\345\024\352\3600\272]\006hc\367\n\362T\316"
+	.ascii	"\222\301-\322\307\006\315\265.\267\216\375\202A\203J\252\372"
+	.ascii	"\222S\372\3726\313_\214pa\312\264\331\263@k\234i\004y\017\346"
+	.ascii	"9\205a\324"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.35.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`Q\004-\034"
+	.string	"\306t\265I\240\232M:\304S\021NG\025\203\004bIf\365\214\2766\023\340\027\\\324\364\342C/\320\216/%\344\215c\243\360\214s\256\316j\360\34298\215'\301\260\001\017<x\r\244J$d\300\243\232\241I\321\350'vo\"\245L\001\231"
+	.string	"\222"
+	.string	"\244"
+	.ascii	"\223\037N~\207|n\376\022\030rR\345\303\230Z\241\302\316\324\256"
+	.ascii	"\231\244\306\376v\377\375\376\330\254\177\274\210\305z\253\350"
+	.ascii	"2\356\374E\374\343\316\375G|\257>\356\217\024\231N\210Bfl\005"
+	.ascii	"k\255\007v\336&\356\374\362\330\036#N\206X0|t\006\360I\213L\255"
+	.ascii	"\365V\333\031\335\031n\017\335\331/\226\334\0316\223\337\275"
+	.ascii	"\332\220\353\213J\317\307\2643\305\2066\276\024\333\241\201 "
+	.ascii	"\02212\237S8\203\242\321\333\253e\023>\036s\214A\255\365\334"
+	.ascii	"\363\241\330\323\375o\341\277\202?\314\021;\271w\212\327o\207"
+	.ascii	",\221\243\\\207\016t\3476\002\025_V\013\303L\220\253{\n\211\026"
+	.ascii	"\365^\355\016\020\034U\300X\361rb3\377\006Y-\244\257\214{H\342"
+	.ascii	"\355\355\374&\321\235E\275Y\313VS:\242|\254h\342\260\037\213"
+	.ascii	"\307=\365oX[\352?\337H\344\027\021\355o_\233\374\241\030_\210"
+	.ascii	"\362i\224\037D\371@\224\377C\3713\312\367\241\374\036\312\347"
+	.ascii	"\231\374\035\221\257C\3719\223/\233|\234\030\377\206\362G\312"
+	.ascii	"\267\241\374\032\312\027)?\326|\332\374\031_'\373\344\001\204"
+	.ascii	"\b\021\350NY\217.\274X\375p\272\326D\275%\025o\3112!"
+	.string	"%L\230@w\3424\375z\262\342\246k\315]h<\366O\241\002\335\336M\327\234\236\244n\330\306f4eUM\177kk\255l\323!\226\222\352\207\277\265Y^\\-\316\210\375[\270\300\333\253\351\032\211f\372\267v\252HS\255_\020\026\326\345Tk\323\200X\213\035\202\225U\264cM\201ep\3666m\032\260\334\021\366\264mw\330\001\200e\024\217\303\316\335\275Oi\216a\201\031\304Z\235\022|\215\354\021\r_\031;\277\001\207\243\001!\222\2266,}h\240\333\341\034\214?\262\355rK\271$\335\016\307\341\246\264\323)\201\310)\335@ \341\222nG;\245\233M\300u!r\273\333\222N\267\273\215XM\033\326\2262\352ZS\363\316\205\024\275\214z\226`e~\363\300j\3112\263\204!\023\206\233\220\200\262\021~\250\257\220\262-V\266\367E\250\207\232\301hBA\355\323\264n\2552\n\250g\035\324\001~\200Z"
+	.string	"\232\222\212\367\305\323?]"
+	.string	"H\324\263\006\200\205W\202E\327WO\373\360tN\367\364\226U;\315\323TJ\031\324\351\035\322\307J!\257\242\350\364*\211!\353\234n4e\260\301B!\305Zk\202N\250A(\345\020r\210\031\223I\0234\255\264\030\220\002\031A\3329\021@\265s\220LAn\007\322\245/ir*\206\275\004\234??\263\232\020\276\316#\237S\032Ha\027\254vZ\"\324BU\227u\020\004\326\311\264\227\225\n\330\204"
+	.ascii	"H6\310\216-v\327\330\320\230\241\320\373\375\236\223\017\037"
+	.ascii	"\331%\343\313x0\022{\345oDD\2070\320d\006Y\267*c\300\261O\310"
+	.ascii	"\313i\fP\202\215\247\236\321\030P'\205`\261^V\256\223\013\"\032"
+	.ascii	"N.\2119E*%\3529\202s\372\3362\264\214\231\301\257\242\fE\274"
+	.ascii	"\223A(0\3636\254q\254?"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.36.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\030\003\355\025"
+	.string	"f\347\210I\320\360(\035\336\255N%\220\214\226\256\246\2107\274]+_j9Sx`f\005\013\\C\237w\257q0\205\257iR\301\252\033}$\332\f\302\254\017\304\021^D,b\3567\016v\001\204\317{\267\310\013\375o\215l\222\244L\001n"
+	.string	"i"
+	.string	"v"
+	.ascii	"^}\255\332uj\327b\270\226_\207\273\376\256w\327j\"\300\267\024"
+	.ascii	"3\316ya\3241\203\362\b\204\256\332\3322\215\335\244A\036\246"
+	.ascii	"\252h\262\001>\3159g\357\2404*"
+	.string	"\303/\215U\177t\305\353\325\250\304\3210\2052\347d\365p\364a\201\234\027\030\\=]\030[\342@C\177t+\364r\273)\2249\247\227\327\273Q\213j;\201m\003\366-\004n\241\321D\225\362'L@8\023*\004\301\345\345El\215\210\202\332\353\377\003w9\271\035-A\215$\352\367\272\363\311i\t\005\202\261\356\270&\263\312Si\225\021U\352[2\242z|\270\035\355\240\334\376gk8\257c\177]\"\256I\304ul\327\260]\277v=\"\327\"r\035\"\327 r\355\222\353\217]{\354\272\3655\353\033Q;\036\220\273H\347\234\033\362\020\270\013\001[\027\251\020\223\221\006\035\256\333\013\030\254\362@nB\3415v\221\376R\340\346\364\3118\006us\342\b|\334u\335\361x\374\343!\322\316F\353\036\027oj\314\330\371\264\216ByN\254\267J\276:\353\372\257~\240\352\341K.\225v>\251\253d*>u"
+	.ascii	"J\362\342\325f\207\033(\321\003\325\234\272\003\326!\005\256"
+	.ascii	"XwT\006n\221\331h34\230\232"
+	.string	"m\205ev\263\325n1\264\333,\306e\005f\326b\273\315d\003\\\213@\263\315fj5\333\254\025\204\323\353\330A\206 \3569\371z\214\231\247$\236\023\311\225\306QS\304\330I\\\304.I\fA\371v\005\216\245\r\341\177\232\"Z[hR\n\002\025\025\242\361\351\206~\340\345\004\377\037\354\257\263\234`\322m\016\026\023`_\035\275\236\"\032{|#F\nD>\002\003\267\243\215\216\b\231\310\003\004H\250q<\306\024Q\312Q\345\024)\303\001\220\002\021\272\252\016\020hHD\031\016c\334\2222\214\203LC\224\236+f\326dbj&\r\317\262\355>K\271L\271\314%m\275\334#B\344[\00574\"\255T\231yN&\346\245\004\212\303:\340\271v\372S\217\213=\304\244\214#\227\242\336\034\321\036b\211\232\376\245\343?\325n\354W\r\272\275\310\361\361\016\346\3261\204\t\353\231\\\037\003\377\214\272\203\025C%"
+	.ascii	"\244>|bY\363~\3106G\367W\332 \324\302\275\037\201j"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\260\001\315\n"
+	.string	"$\017\254\002"
+	.string	""
+	.string	""
+	.string	"\002\023\177%\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\037\177&\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005*'\200\204\001"
+	.string	""
+	.string	"\003\005+(,\022\002 \177)(*\036+),\032\177-\272\200\033\177.\034\177/\005\0240\002\035\1771!\1772\002\"\1773\005%4 "
+	.string	""
+	.string	""
+	.string	"\005&5\005'6\016\032\201"
+	.string	"\005\025\027\026\030\0317\0178\201"
+	.string	"\002#\1779\027:\002$\177;\030<\0050=\005\022>\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\020?\001-\177@\377\037"
+	.string	""
+	.string	"\200\200\200\002"
+	.string	""
+	.string	""
+	.string	"\001/\177A.\177B\003\001\037\320\360\372\250\001\001\304\006\003\005\001\342\001\003\017\005\355\335\2737\001\202\032\004\017\250\325\252\325"
+	.string	"\001\325\006\225\n\265\013\325\016\225\022\265\023\004\017\225\026\003\030!\344\006\003\030 \304\007\017\003\032!\244\n"
+	.ascii	"/ \340\002!\252z\276Afckh\024\243\221\227L0\202\021|\2025Ic2"
+	.ascii	"(\327\203{\360\317I0\226\037l\007n\206\373\320H~n\031\360\347"
+	.ascii	"kv8cB\306<\311m\214\333\330\216\241)MB\207\357\005\t9Db\030\246"
+	.ascii	"\263\276\240g\024\f\2703f,cd\304\332\002\364!\0358e\214o\264"
+	.ascii	"\327\031\003"
+	.text
+	.section	.gnu.lto_.refs.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\205\007"
+	.string	"\246\0248+@k\224\016\3030\f\3030\f\3030\f\303\3112\266\275\272\356Z9\004\023c\212q\210\377\264b\355\357\322Q#\001\377\355\377\266e\n,"
+	.string	")"
+	.string	"/"
+	.ascii	"\315\324\027\367\225\206T\3563@\037\275mG\227\234\376\200\276"
+	.ascii	"\001}\344<\004\365\346i\363\334`ph\371\007\273\303tf\351\305"
+	.ascii	"\353|1\002\371\007\211\033\344O\\'H| ?\313\307\\\217$~\345?\327"
+	.ascii	"\253\304\251\374\311u)qH~\313w\270\336H<\312w\334\007\355\200"
+	.ascii	"\3503\362/\246n1\365\n\352)\246>Q\275\204\364\021\256C\270\376"
+	.ascii	"\220\357`\365\206\367\f\326/d\257T\257\220=\201zJ\205S(\034!"
+	.ascii	"\217\002\370P\262,\311z\326z\244\375\325\372\313\336\302\276"
+	.ascii	"\272\372\003\353\315{\006;\342x\222_\220\235z?\345K\3273\357"
+	.ascii	"\027\353\033\004\004\001I\375\323\0172)\017@=\001"
+	.text
+	.section	.gnu.lto_.decls.fc09261fd60d6d4a,"e",@progbits
+	.string	"(\265/\375`\252(\265\271"
+	.string	"\372)\031AZ0\f%\244t\r\341\270\340\277\342\234jp\002"
+	.string	"i5\256*\216?\325\256\342\247\t"
+	.string	"\314(\226"
+	.string	"V\016\206^[\357\364j\277\207\247a\352\317Z\353\275?\003j\251?\034\024"
+	.ascii	"\300\207\376*\346\253\215\371\204]\345C\211%\316\312b\307\265"
+	.ascii	"`\373k\223P\303-\264\265\371\275\267L\001a\003\030\004\032\004"
+	.ascii	"-\202\212\204\341\320\221dq\303d\313\021c\275\025\251\256\350"
+	.ascii	"fe\361\333\265d\362X#\023Y\225z\337\035r>\035r\177E\326cT\026"
+	.ascii	"\244\022\352}=\376\265X\2157efb\365\356df\334\320k\006\001\325"
+	.string	"\322\252^\241\276\260\002\\\365*\301\330T\357\033\356\357\266V\322ouI\301\016\330\333\n\246z\333\255\331t\363WZ\205w\233\036;\016\222\231\233m\205\245hU\357\255Gp\n]\377Jn\247/\344\372k\350\275\346BN\351\304\314>\026ll\305\233\0326\035\222\261\251\257z\233\255\366Z\247y\2635\232\035d\263\335\234\215\335\033z\2727\334\\\371ad\222\273\257Y\370\357'\007\214\024\213\262\325gZ\355\312h\362\224T\257\031\240\235+e\274\274\324\373*\205\337N\240\240=\263hi1.cX\272X\271B\366d\313\0260m\326e:\205\016\323c\232L\2475Z\227\365Y7[L\223\275\275\364\227Wf\316\310\234\3633\350\222\005,\254\305\274(av\223\036\233\363\2151W\\\316n\322N\247\006\034!\323[-\246\2534\225v\356\360`\353\3133g\3467\370\207\376\020\033\264\230\346\322b\031\2169\337\260\021"
+	.string	"*\257\030dn93="
+	.string	"y\310Iy\001\263\006\350\276\321\360\237\215!\327\323c\370\375\004\277\215\340\267\017\374\206\302@\355\002k \001\356\200\002\317\nFVhS\357\211\370=\214\001\t\270\243\264\224nr\350)\357\257~\362\033#33k\017\270'L\352}\005\360\233C\316\306\3055\207\334!\200\177\032C\256\2025\206\\/\351\256nZ\320^\017\261\301m\261+o\345\314\364\271Ld9\200\324\373\005\340\377LNAW\336\340>\370mA\256\343\332\202\334+\276\023\2551\344\376N\322[\026\330d\3222\177\345\314\264\340\303dzAU\357\231\215!\207\373B\256\323\202~\033\366_\002\177\037\317*\b\033|p\016\374\307@\001~\373\344\357\024\177\017\251\021\250\036T\b\374\215\374;\377\375\201>\3617\360\357\337\337 \370\033\305\337*\376\036\376M\374\333"
+	.string	"\177\247\177\0131\004\377\376P\037\320\245:\240\3366\272 "
+	.string	"\377\201\376\316\375\317P\033\360\200\337ZMu\214\332\001\007[\364W\0040`\351\267\033H\370\315oqT\016\376# \367[\245\373[\027\357\337\222\340\177\n\377\301\374\027\363\337\353\277\363\377\230\377d\376\207\371\217\366?\355\177\331\315n\341\267\031\370k\005\177\035\300_-\370\253"
+	.ascii	"\376J\301_\203\376\232\341\257\032\252\001\352\315_'\370+\206"
+	.ascii	"\272\200\377?\377\035\361W\021\177\035\372+\207\277\032\340\257"
+	.ascii	"\033\376V\373;\355o\264\277\317\3766\373\273\354\357/\177w\371"
+	.ascii	"{\313\337c\177[\371;\354\357*\177G\371\373\353o\257\277\271\376"
+	.ascii	"F\362\267\326\337D\376\306\372\373\307\337<\376V\376]\365\267"
+	.ascii	"\215\277\227\177\367\374\355\363w\375\377\366\177\355?\t\377"
+	.ascii	"\315\374]\374\373\306\337#\370\273\306\337O\377\247\374\355\364"
+	.ascii	"7\215\277e\374\275\364\277\315\177\024\376n\361w\362o\026\177"
+	.ascii	"\257\370\033\351o\n\376\376\371\033\377\255\373\333\376\207\373"
+	.ascii	"\237\346?\211\377g\376\253\375\337\372?\342?\227\377<qqqq\377"
+	.ascii	"\245\372u\026\370-\340\021XU\214&\\C\376\2359#\245\212\036H)"
+	.ascii	"!\245\232\222M\251\\D\002)ZPf\251b\262\231\263\205\214D\026A"
+	.ascii	"Xf\013\311fV\312H)(ufJ\0253r\231-dd6jH\"\245\224\222M\243\222"
+	.ascii	"\205dSJ)7\245\362OF\032\225-\220Yi!7\245\320\344\346R\351'\331"
+	.ascii	"\\*%\233RP\215\226d[S\022\263\234\232\322K\222\310\f\343\005"
+	.ascii	"\224Q\371\343L2\227\031-\347\376Z\221\225\005\310\031j\251D3"
+	.ascii	"65\330\321\t\343(\305\270\354\240\027\307\251eF:\223Y\313\234"
+	.ascii	"\263\216'\362\013\r\212Lg\266jg\221\n*'\255\310\271\202\0279"
+	.ascii	"\027;;s\316\305\234\263N\t\305\314\271\306O\362\352\305\213\234"
+	.ascii	"\235\200^d\250b\330\212\234\353\027\0310\245dsj9\024\326\244"
+	.ascii	"y\225Y0\213}\225\321\244\224\270Y\\\222\223\330\360\225\222\214"
+	.ascii	"5\031\370\267%\210\321Y\323\262Tl\321\201\207\315\331Q+i\306"
+	.ascii	"\355l\n\211\305s\334\030\242&\256\256\260\307\333\266\343\270"
+	.ascii	"\245\004\252\337zpr\226R\341j\313F\277\035a\363\264E\213d\221"
+	.ascii	"\326\330M{\254+\274\306\331l\217uY\3412\034\223\227\313\355\311"
+	.ascii	"\036k\215~\353\240\315\322\214\033\035`f\306\234\233c\346\222"
+	.ascii	"\336v\260p\301\025\353}\316\370\254k\265\255\246\251k\252\232"
+	.ascii	"\212\246\252P\331*\233\352\326\315\332\246.\275\336\2508\016"
+	.ascii	"\324J\206d\021\322\246f5[\316\312\251\366\254mj\221*\246\230"
+	.ascii	"c\265T{F\355 \273\262\372Q\253\250\270\\\001\t\262\305\212G\227"
+	.ascii	"\247\223\332\246bUy\326(\251Z\225\305\013\220\253\352cLK5\241"
+	.ascii	"ME\253g\236jO\017V\251\353\211\021\240k\246\252\2251Sz\255a\202"
+	.ascii	"\315\224\341q\302\245\2061\355\265\314\316\232\025oP\352\255"
+	.ascii	"d\354\0278\035\3061<\\Wb\306\306\274\337j\020\030A\324\0309\253"
+	.ascii	"iI\232\232\374\300`\252Y7k\230\232\344\365\204J\344@\3140\325"
+	.ascii	"H\335R\322\215y\206\251\\\265\254\235N?\031\251\006\367\364\340"
+	.ascii	"\241\233\214\255\260\226\273(T/e\256\234\365KM\241\233\265\354"
+	.ascii	"\265\254*\251_=E\0139\353x\273*\253O*X\017\222\231\227rgr\366"
+	.ascii	"\020\344\301\203NR\016\033E|\273T\262nV/\225\313X\335\322N'f"
+	.ascii	"^\352\211\262<[r\363R\305\352\225\f\307d\bV\322\236X\214\207"
+	.ascii	"\025\253\334\375M\324\026-<-\252`\211\301R\263\344\320prZ\241"
+	.ascii	"\201\177,\207!\004\211K\322\315T+\357\321\205)I\275\277a\201"
+	.ascii	"\177\223\361\357\033\256`\025J\235\322\316/\020\274\250=s\316"
+	.ascii	"UjX7+X\245\362\313\314\371\253\307\300\266\234y\002y\350\t\202"
+	.ascii	"\205$\311\023\337\"H'dUJ\215\222yx\324l\\\311:\303\277_\360/"
+	.ascii	"\227\332\244:\351f\375\252^\257B\252\326\201\2309K\371\252Kj"
+	.ascii	"3\3031)\302\r\025\352We\266XO\221\231c\350\004\271:[\002\362"
+	.ascii	"\340AG\205\202\022\036\271\373{\325db\237\222S\336\2307X\234"
+	.ascii	"\314~t\325$:dJ\310j\365\376Z\341\337(\374\353\204\177c\340\337"
+	.ascii	"cE\342\343D\212K\213\r>b\321\340\316\226\fn\240.\370V\f\337B"
+	.ascii	"\301?K\360\255\021\254aHS\355\301\324C\222,iP\341[\0230\006V"
+	.ascii	"F\325A\265\343\"\371f\2218\007U\315R\023\2465\365J\325l\225\315"
+	.ascii	"L\225Z\205\303g\262\3017\314,h\360k\031>\230\025|\247S\323\021"
+	.ascii	"%pl\352mb\342!\325\243\007\215W\246\253\355\344\234!\003\214"
+	.ascii	"\036H\352\275\232:\343?N\316\232\245\035lf\310\350\26423\267"
+	.ascii	"z\233UF]:3g\240vb4\036\241\340\277*)Q89q\325\373\252\214\321"
+	.ascii	"\313\234\277zdxi\325\250\267&\325\027\335\f\2520\326v\034\225"
+	.ascii	"\272"
+	.ascii	"p\tr\356\240\\\307\305uP\256\2260\364\352\242\001=\250\216\324"
+	.ascii	"k\373B,.\322VZ\t7\251\235;< \362\2452/\322\026\231\247\013\343"
+	.ascii	"2Qq{>\271O\267\305\0214\023.\216{\343B]\247[\343\332\350\346"
+	.ascii	"}\272/~\215\367x\237nr\214O\032$N\232~.\362f\270\324h\334\246"
+	.ascii	"n^\246\257\313tc\334\031:S\320\220!\342\026\344\201g\315\f\315"
+	.ascii	"\204\334\f\031=R\230Ul"
+	.string	"\365\336%\235S\023\027\2448e7\257\022V\243\025\326\346ft\260\360\230z\303\337Y\203\2773\346\272\300a\2366\274\200\301\337\371\202\277\223\005\177G\f\177\207\n\376\357\212\213\324\334\222\306\313E\022\003C\226t\204\202k\207\276\220\263p6\356\346\037\307\347\b\230\216(]\370v\205\3778\030\340\361%J\275\327\266\271}\343\022\344\352E\022|\313\306\252\360\343\364\240\001y\262\344\004|\353\026%.\315S\275\266\r\257\330\251\342\220c\203\n\016\023\352\275m\373\355Zs\3315\035\310\031)\2028\270\266zm\032\253\346v\215e\313v\215\006\313\234\215v\215\317[\316F\237\356\r\335\033\356\221\251 Pr\367;R\230\247m\350\026\215\216\227\261\247\222z\277\323\302\314\030\253\326oC_\262\032|\235/\370vL\333\264\264+)xh\013\255\177%\207\206f\271\310\234\272-+_TWg\366Ll\251c\003\f\030k\206\346"
+	.ascii	"Z\260v \231\230\345\220\270v\030\251\367:,\312\336M[\326j6\231"
+	.ascii	"\263\022\2073\314\212\003\211\022\265'\276%k\373\305~\261L\027"
+	.ascii	"\2101\235\370m\231\2724m\227\252\254]y)\207E\321\351\003\217"
+	.ascii	"\220#^\307-\370\026K[-W\354\026\033%c\003#\313\034+\3709Rpm\033"
+	.ascii	"56\326b\335\225c\344\260P\302\262\342\226s\226\017\027\356\314"
+	.ascii	"\231\325\016,&f\255\324+]\223(_\317{\354B\241\315\212e\"S\304"
+	.ascii	"\031\304FX\230\375\n\001C\021&\021\333\2241\365>G\tO\231b\253"
+	.ascii	"\340\034\324\244l\323r\3331\022\366\204\202\245r[\305\222\361"
+	.ascii	"\300j6\225\253\004\313I\207\033\276}\3226J\323Fi*\035\262\321"
+	.ascii	"xAX\032~7\225\234\023'\366+\204b\3164\230mZZD H\312\276p\204"
+	.ascii	"`M%\2051\231\326k\202+O\253clI\230m\336z5[O\026\220\260\255z"
+	.ascii	"\355\022\313\344\246\t\214\251&\226\211\355\312\t\223r\002\232"
+	.ascii	"\2670i/\222OP\\F\3164I\222\304r\341\2343\220\230\023\252\003"
+	.ascii	"\017\326\325\216\024\256\346\226\353&\205, P\352=\316\221#6\313"
+	.ascii	"\"\251G\017Z$s^\032\302\301l\323r\303\261\302\307a\322jZ\255"
+	.ascii	"f\003\312E4CM\3166-7\234\244\023\262,\221_\301E%\206\322\002"
+	.ascii	"\356\311\006\037\233\005\tb\261\016\200c\310-\226e\272D`\\)R"
+	.ascii	"\257\025\322b9a\3152\032\365\332+\313T\307\232hG\f\005[\037V"
+	.ascii	"\311\376h6\r\375\344l\323\322\312J\346\207c-|Le\255\224,\217"
+	.ascii	"_\271\371+\033\2276<\201\345\017\307.\360uO\251K\331*"
+	.string	"\374\223\217eVxf'\247\016X\354k\006\031\253\343\266\252\026\271\024q\332\034V^e\220rP\261\235!\223\315\370\224\001\211A\243\336\251&\343\211{\372\2521\206\355\222\247~aA\306\304\013\352\335\264P\366F\b\314\\\314\305X:}\340Qc\326%\243^k\303\003Q`X\270\360uF0\324\375\311\310\034NW\037\272\326\350f\b\331\270\244!\354\331\246\345f\235x\256\nB\224I|`\333\324\301\322\3009c\263\361U\357uS3\340r\302\220!Y\272\260Jv\251\341:\257PV\240\205\224gV*?\\\227\204o\223\354\213[\030\2670\254\262\235rqm\303\323\262M\313-;);\3746\306\255\262\337|\220(Aa\353\267\334\230\254(\026a\370\257\177.\033\2259\347\245\033fV\036wr}\323\335\341\347i\333\005\370\177\263\005\026\310\271Xf\231\006\007\351n\270\001\364\310\227\342\024@a0\310\333\205"
+	.string	"\030\31412\342\365\206\251\257\204\020\361W\244\200\024\304\237\317H\001\032\210\330\211\340 \205\020JD4\352\375|B\302!QH(\004@\341\211\024\370\323\231\340\241F7\035\376\200\275\033\023\351\317'4\312\235HyGB?\340\321\021\260WA\006\037\350\371\210 "
+	.string	"\200\212 p\304\004iP\250(x\241\367#\352\374LT\341\315p\267\223\356~E\301\233_Q\320\236H\213~\250Q\016\025\201oxU\004\201\275+L\203\226\b\375\025\371\214x:\"tH\274=t\250\273pW\024\004\301#\344\235\350]\025\302t\350+B5p\001\003\020D(\n\336\020\303\221\020hB\210\006\005@\364#\002\205\024@\211\210\251/5\212"
+	.string	"\206#4\035\252 \261;\"\222\360\271\271\021\001b\250\373\t\020BDF>b\t\224\bx\201\"b\t\224\b\007MyD\301\r\344\350\fQ\243\236\212\024%\361A\321\257\267\203\246\300\021?\240/\345\tK\370\214x#\206\276\240\264\207\246(\b9\251\357'\002*\034A\003"
+	.string	""
+	.string	"`\203\t\214x)\220\004T\030d!\004\b\025D<T\003G\027\2002"
+	.string	"\221\002%\372\211\220\376P\241\220\330\253`\367\233@\212\016Q\r\024\005\203\320\035\232\362R\022?\351Ew$\002\360\336\217\347#B/\360\201\n\243`\220W\301{>!\372C\213\3605\020\241"
+	.string	"\021\034\244\320\235\203\0160\350"
+	.string	"\203\3349\350`h\250\003\021C\370\"\206\354\020\210!\t!\232\032\371&"
+	.string	"4\334\345\322\237"
+	.string	"\221\200\021\023\240)\317\210\3303\342\365p\322\341\316\027$a\002\005a'\302\b$t\320\336\217\227\016\177>\234\3562 \302\375\371F\370\r{9_ph\207\273\021!D\320\031\021B\004\234\\/\204\317\376\004\210!\021E\341\023\022\005\rw\027\370\021\242\351\220w\224\323\241(xF$\210\301#L\334\341\341\016\204!\261\204\016\272C\203*H\030\022K\340\350P\240DCb\211\334\216\b\375\371J\034\001{<)\021\253\340\031\241D\273 \021\247i\032\314"
+	.string	"\217\220\227\016q\220\270#\342\241B\2350\035\241\367#N E)\020$\356R\264(\207\002%\262\251Q\004\200B\336\007:THLyB4x\204\222\200\n\211#\fw(P\020p\322]\210\f\322\237Og\004\004~\260\273I\177\202"
+	.string	"\007\006Q\241P\n\004\n\205t\204F\275\024\303]\221\317\304\0178\302\002\032T\221\016\211%|~\303\336\316\027\034\242=\037\n\224\310g8D\205DD\274]/\204\357\007\025\362B@$\344\235\340Iw\034\350\322\037\021\330\333\241F\301#\336\320\202\211\240\321\016\035\372\200\277\236t'b(\375\371\210\330\bE\2613\321\333\351\244\273\"\036\t@\237\356CC#4l"
+	.ascii	"\003\024\300=\020B4E\217\204\206B\340\360\207\016\205~>\336\221"
+	.ascii	"PO8\024\0021\200\"^\272\353\001\321\035P\310+\261s&S\007\354"
+	.ascii	"\306\223\031\314,'Zg\315+D\327\304\215\312\022\023\":,\243V\\"
+	.ascii	"\227\305\212r\026\213\324\213\002s+F\214\036K&\023~\242\346t"
+	.ascii	"\241\344\366\006\217$Ni\270lT\217&\025\272\356\326\216\221\211"
+	.ascii	"JY\023\211U^&\037UC\216\334\252\03338\032`\2144\225\\\023R\233"
+	.ascii	"(U\313VM\255%\361Q/\326\217u\211d\020\213\n!+J\334\t\277D^%\n"
+	.ascii	"\355\251\252\336\233"
+	.ascii	"\365*\247\262\004\255\207\021\253\337 VWH\253ifvZ\026\327\016"
+	.ascii	"\200C\313\332\020\267\234\204\352P\244\003G\227\253_!]rq^`RU"
+	.ascii	"\372\004*F\240\324{\177\374\002\371qtb\302p\351\252\367=E|{\374"
+	.ascii	"\3720AFZ\326\033\217\037ggG\027/kk\360y\316\340\347\2709n\025"
+	.ascii	"\320\262\210\346\002%E\265,\035ri\317\031*\\\035\277U\025h\362"
+	.ascii	"\243\310\263d\352N\265\032\320O\316Sl\300\354\021\211\313G\333"
+	.ascii	"\347o\261\233\366y\243l\322)\313\370P\005\352C\216\212\351\331"
+	.ascii	"V\357\222\211\324\031\305\234i\251\367<8\360{\353\"\357\n\256"
+	.ascii	"2B\002\203d\250b\301@\211\322\034R\b\215\314\310\214$I\032\003"
+	.ascii	"B\n\020\004Ci\"(\352\035\022\2004E\216:\310\314\210\210H\222"
+	.ascii	"\202\224\322\236\001\215(t\202\036\227l\222\351\222\324^\005"
+	.ascii	"\023&\314=\254\030\312\305=\253\227\241\276U\023PK*\273\302\360"
+	.ascii	"B\234\343B>\235\231\224\362\255\273!,\020\373\312\321\317\246"
+	.ascii	"~6\311LF\n\363\3621\243I\371\236'\333\007\340\323%}\264\003\235"
+	.ascii	"\332{\271\350"
+	.string	"!\001\024C\0167\321\262\f\275z_EF\353\003\210\234\375\374P7\351\314Y\004`\205s\201\343\236\215\221 \030a\261h\246\222r\246\005H\331r\007\350\215\007\031\275\302\327\311\245TC\342\n\232^Y\355<u#\363\322\226\3556\373[\247\024\037\274\004\320F\017\346\344\272!\321^\224\032L[\262\273\205K+\263]jT\247\324!*^\005\366Z\353F_3\320(\364\0243\310\344\300\340\204\020\2068\213K\031!\321C\241\231,jM\320\\\275\272\020\272\231\004%\006A`\033yHhgp_\375\305\347W?X\336,f4\331C\216`?\252~17\351\306\013\306\200\322\013\242ia\027\240\325\025K\322[\321l\225\024{\261J\006\216\235\006\264\004t\2738\243p\202\202hP\310[\250\240\214\235\362J\205c\232l\2758\023d\255r\253\034\234\270\200\264`\301\020k\264\376V\304\337*\271\342\253\237(\316\262"
+	.string	"TS\334gJ\325_f\275\0368\353P\261'\247\0220\223oF\303\266\207c}2#\254\322!]\353q'\253\240\224z\345\244\332G\256E\006\335Sk\226\034\326\223]K-\322w<\251\230\373PG\230\253\260u\"\363|\b\272\031\302\364N4\2062\275\253\366\327<\227\002UtD\357W\\\343+\216\342\377s\361NM\254\207\354\327n\0130\363\036&m\364\355T\022z\\\n\320\217\276\032~\235\372\342\320\303E\317\345!\352\0239\325\361hi\203L\362\270\217\3265\356\367|Z\217\203C\027\240\200\f\335\253\331)y)\001\033D\312\025\210oE\2654\253\201\370\241cM\243\353z\364\213\253`%\027\247\276\361\b\372\352C\004\200\230\265\236\241\017(\tme"
+	.ascii	"Ln\266\013\220\317\210\366q\261~;v\261\244\346"
+	.string	"\265j\013\215:ECv\235\332\031\371\323\370\235R$\202g\005\220\002\340:\356\256\317\270n\361\253\247\343n\275e\366\372\210y\377y*\377c;\310\304\202\323Z\241\200\270#\227?\251\353l\360k\374\"= \224\333\n\244[M\201\315\225\335\236u\355\337\025A\266lyd\220\177\302\255\n5\274B.\362_~\370~o#9h\375\246\013\363\022C\035\240\270@t\217h?nP\271\233\253K\001\311\267\224\201x\276\231RT\324\332M8\251\0270\245\201\211O\274\016Ol\220\242YW\271\0372\201\325\331\r\265\334f\376\226\007\2465\217\021\f\347\224\013\376%\250@a\360h\001\237\216\277\331\r\224!D^\275*\002\274\rYSYo\270\321\203\255\2125\242\222\240\377\250\207\220\001\2044\346\002\271T\301\030z:,\360\255\f\243~\224\226j\354\3355 \353\301G+\33307\013\016\370\374\303\0320\r\312\240\355\262"
+	.string	"\020 8\234\270\302\311\376\023>\303\253)\377\t\337!\264\277Q\315<\265\2119#Xs_s\234\373\227\325,\002\301M\b{\007D\304:\267)\342u\233\242%8\021\241c\017\220\270\243\211\244\300W\317\260]\340\304\206\001<\035k~\230y\223T\242?\304\314#\316\037\"\027m\036\227\361\345\277PO~\214*\357s\256\217\200S\320\033\312\352G\013Oz\223\320d\355\003l\367\034\243\225\310\253\372\231\033\275<M\314I\344\272\007\203I\272\025\270<\230{\337e!\363\277l\265\372\273\013D\333\310\352\366\350\375h\355Z\017\251\004\212\363"
+	.string	"\036l0\223*\216\251\275;#\302\b\322\205\365\243BG.\240D\266\341/\303'\217ZT\"!\222\215\256s\327\227^5\331L\251\250%h\272r\306tH\007K\321w\353\331\376F\313\204+\0274`U\266\224U\201\324\256S\250}\240?5\236a\244\225\020{\343y\214\304\270\266K\331\311&\314\017\304hY@\006\224\037\320\244\207[z\341\220\266\362A%D|\244\336\252,\265\230Q0`\226\204\313\374\246M\3720\2646$x\211\365\352S7^C\326\017 \3204\202\330R\362"
+	.string	"!\177[b\200n\265\nO{An\211\232\037j\242'1\"\260*\201\013H7)\351\222\276\251\227\337\364\344\265\306\314P\0219\251!'|L\017\331\224\022\3277\314=x\243\006\270\323\217\024\302J\020\\\"<;\033\241\322\300\026\225\321\016\364\302\033\261\325}\\d\034\344\243\321\001 \311r\277'\253o'\353O\022\344\032\\\200\271.\247Rp\022|u\036\277\300\224\325m\357\027\356\024\240\364f\300\235?D\337-\243j7\217\204\370\326JP\230\254\225\273 {\r\342\352\277448e\034\022\253\226\270\256\202O\261a\217\350\202\231\311\264\211\241\034:f\3154\225,\304\211\2019\337\3122MX\206\272\252\200;\020\330\312\2214Ns\365\220B\261\273\033f'\255Ny`\276\210\r\263h},(\270\325\346\370\311\353\317q\210B"
+	.ascii	"\316\026\307B\213\022\343E\204\343\002\020\264\340&M\364\313"
+	.ascii	"MC\364\fG\333O\350\246eD\374Z\206\357\376\3175\272\217\222HF"
+	.ascii	"\371\377Vb\343\374\252+v\254@u"
+	.string	"'\241\232\374m\013\314\023\242aT\344\212\"S\037(\300GC\334\b\266\217\\XVu\210%\330\355\240]\314\355\303m\241?\376\361\024\025\013p\255\271\021\020<\256\227\354\033\331\260\240\357\036Qh\361\275\306V<m\342I\001\024BD\323\235\343\270\t\240M\243dy \363\300\344\361\026\366\276\340-\\9\240x\204.\246\207\350$\347\032\311\243\307\357z\266\357\310/\350\355@\035h\276gb\236\r]U6a\237\027\353\274\377,9\320\274\r~\363\035{\277\261\227\226\270C?\004\237\3006\234\337\246\377\300\223\005\336\227\177\237u\3733\375\246)N\311\257R\357\021\372I\307w\224g\"\307hmLLP\273\347:\354\214\274g>\033\371M\2511?\003\317\371\345\267\266\203\003b\234A\262n\334\247\376b^\331\276=X\275\237\247\367w\336=\265\336\333|\306\341\306a\326\316\005\331V\215\354\031\334Y\037\033M\020\363"
+	.ascii	"6\357YI\317\b\377\360\\\270\315v\337\016\347.\003g\374\2345\271"
+	.ascii	"/\337p\255\270\335\345\333\226{\311fj\325\223u!sh\177[\001"
+	.text
+	.section	.gnu.lto_.symtab.fc09261fd60d6d4a,"e",@progbits
+	.string	"pgResetFn_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"barometerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"pow_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fc09261fd60d6d4a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1621 @@
+	.file	"battery.c"
+	.section	.gnu.lto_.profile.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`2\002\305\016"
+	.string	"4\023&\003"
+	.string	","
+	.string	"\254\372\361\363\002\024\002"
+	.string	"\002\001\002\003\002\004\005\002\004\002"
+	.string	""
+	.string	"\002\004\001\240\342\234\212\n\002\003\004\314\346\255\372\005*\002\006\002\007\002\006\002\006\005\002\005\005\002\005\005\240\342\234\212\n\006\007\b\t\246\300\251\343\t\002\n\013\306\374\305\326"
+	.string	"\002\006\002\001\f\r\324\275\321\305\013\016\002\b\002\001\007\002\t\002\n\020\235\361\320\201\tD\001\002"
+	.string	"\001"
+	.string	"\021\023\313\322\375\213\007"
+	.string	"\024\354\206\342\366\025\026\027\234\236\237\233\f\004\002\013\002\f\030\361\220\342\261\005\031\243\330\276\362\016\026"
+	.string	"\r\002\001\032\033\220\372\271\340\r\016\r\002\001\002\016\002\017\020\002\021\034\352\263\360\321\b\036\365\237\256\307\n\002\037\373\310\241\374\006\f\020\002\021\006\002\001 \336\253\202\201\b\016\002\003\002\002\002!\314\344\207\235\n\"\355\241\206\304\017\002#\250\267\374\351\002$\300\253\277\314\017\007%\205\246\225\244\001&\317\356\361\267\004'\350\300\306\254\005(\307\266\257\307\n"
+	.string	"\002"
+	.string	")\367\345\303\353\007*\207\312\266\244\016\002+\320\374\270\356\001,\325\241\220\227-\326\327\255\312\n.\355\220\274\212\006/\240\342\234\212\n"
+	.ascii	"T\250\201-A\204\030j\323\254\001P\002SCf\036\021`\311c\307\311"
+	.ascii	"\262o\250v\262\016tGH#\031\377\362\314\264\3172\356z\306B%\322"
+	.ascii	"\250:\344\234 H\303\322\347\347l\240\337\026E\245\233\024I\n"
+	.ascii	"\300\013\345~F\030\204PqqN%\246:\277\335\026#i;\025\221\3315"
+	.ascii	"Y\240$\220w\361\243\f\027V<w\031\346\341h\264c\215Vr\323\021"
+	.ascii	"G\340L\333!\211\206\241`\36488\314\376\257\340\275n\300\037\202"
+	.ascii	"\361/)\n\263\347A\320\346\001_\275\0201C\250\224\350\273\212"
+	.ascii	"\347\271\342\t\363\371\250c\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \312\315\003"
+	.string	"b\205\021\035\220G\303\001\377\377\377\377\377\377\377\233\370\370\370\370\370\3700\240\302Js5\034\330Dd\n.c\027\253\330\304\"\366\260\206-,a\007\202\031"
+	.string	"lu\270\324\334\266\224\242\205\366Yg\233e\226)\233LD\327\346d#\025"
+	.ascii	"F\205\371Y\200\363.OK+\026gN\340\027\254`\016$\233\312$\305\002"
+	.ascii	"@\321\242\304\325\214\210y7(#9S`\303\312\340\22706\200\005"
+	.text
+	.section	.gnu.lto_.inline.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\367\003\335\r"
+	.string	"v\320>; \005)\035\001\342\202\356\013\\\372f$\260t\227\353M\235t t\340\020\b\332\353\305jw"
+	.string	"\260\373\244\2740\340\220 \201\254\215\346\340?\314\325\223\030\021&\016\202\360E\032\221\222\244."
+	.string	"/"
+	.string	"/"
+	.string	"\235m\332oW\264\362\346\363\200\247:\261\032\325\307\250.\265V\211\2079\265\232\364\377;[T\362\345*Kjo\242\316^\2562d\207\314\345\004!9.\253$\241\331N\366E\325\302b\232\021\b6{\013I\273`u\004&f\003\2424\245\326b\201l\260\377'\203\332+.\354\237\007\366\266T\277\200E\016I\316\366\367\231\3323\003@VB)le\347\034vH-\316\177R\200\030\223\325\203\033\272\223\302@\340\002\210\352rV\b\261\277Np\336\320\310\300\020\367\302\202TA\241\334\307\023\"\262\232J\200G\377\357Y\342\244<\377\034\241\374\023t\304W\346\237\035\243\246\376)2\204u\366V\250QM\204d\252V[\233\001\200\002\0311\263\016\022@49\304QFAc\fT&\246&~\036\216o\"\216e\253"
+	.string	"\222\260\314\213w\226-\367A\220\006\224\032\302\036\330m \334\364E\023\234\tQ\310\203A\335\264A\305\217\221\031\2215\211{\236\233\f*\305\243\354\226\007\342A:\304\235\331\026\376\022\322\030\346\207\312\314\331\0063\361\302{I\030\303T\027\252<C\344\366\336\333\242"
+	.string	"3l\202\372\026f8\360\303\357\3112\b\336\t\f\031{"
+	.ascii	"\371\311\336-)\001\030\036\313\223h\332h\232\364,\276L\245\263"
+	.ascii	"l\013\322y\225\016\3673'e\2003\245\276\020h\rW0=\314\017[\324"
+	.ascii	"\312\345\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`7\001m\007"
+	.string	"\222\215&(\220\0332\034\271\377S\235\303\355n\"?e\307\334\035\344\334\352\037\005,\332\266m[\236\377??\251\331\313\222\r\367\2262\005\177\306;\217\361\027o\361\025O\361\023/\361\021?\304?pw\247\312\224%\037~\207o\370\031\226\205\032\253M\356F>\240\326Z+\031\231\302^\001*BS\377\023\376\340\r\276\371\202'\230\327_f\b\t\302\347\334XU\214\317\"\237U\356\321\246\251\213,\207e\272\243\212\236$\307\252b(\360\001\212B\025%T\021O\330\261\332\007X1e\211|\341:\001# \220\242\262\242\033:p\274\262\005\0232@\313\202\323q\225<O3=\022k~=E\246\b\026\205\032\254\301\243\031-\310\026\374\357n\201E\200\023"
+	.ascii	"\201\370\3237T\341\311B\356\210\365Q\346\207\376;5\366(\233\r"
+	.ascii	"\345\030M \\\030\367\302\r\001"
+	.text
+	.section	.gnu.lto_.pureconst.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 YM\002"
+	.string	"\222E\021\032\220\2730\006\177y\363\377\331\377_"
+	.string	"m\333\266m\313koi\303\331[\277L\006\376p\2077\234\341\013Wx\302\021~p\203+8\202\033\270\300\003nr\222G\016\371\343\216\221\3061nq\305%NW\200\252\202\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"\325\005"
+	.string	"\342\206\025\036\240\247\205\003\377\377\377\377\377\377\3773\377\377\374nBMDd\264\357O\255w\304\355oR\246;\032\212\362\205\361\026\213\362\234S\222\306\370Qh\276N\327~\020\007c`!)o_\016^p\237\254\234\255\316U\256\002\200T>\t\235\211\366\324\211\312Q\347)\262\231\2172 "
+	.string	"\003\021\252s\246\214\020\337C\017\326H7\200\341\316\354\310c"
+	.string	"\323\001|\033\254\334\302\\0\204\307\265\215\230\221\274\203t\234t\213\260\206\231\3430\252\210\030"
+	.ascii	"\033x\025\360p\235Yu\026\035\347\310\202?\226\231\255'~y\022"
+	.ascii	"l$C\263\226\352\004\244\353\202\026\300\220\257\254[\260\342"
+	.ascii	"\310C+\250\033"
+	.text
+	.section	.gnu.lto_.lto.fa435e80068b919a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.45.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \242\315\004"
+	.string	"\264\bk"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\301\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\376\006us\250\326\006uq"
+	.string	"\005\001\006'\001$\005\001\006\035\001'\001\213\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\004"
+	.string	"\237\n\013&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.47.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \252=\004"
+	.string	"\264\006\235"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\n\036\005\001\006'\001\232\003\001\005\001\006\177\177'}\001\002\005\001\006{\035\001\344'\001\254\002\336\312\256\003?\202\210\200\320\002yw\311\001u\310\001s\307\001q\306\001o\305\001m\304\001k\303\001i\302\001g\301\001e\300\001c\274\001a\277\001_\276\001]\273\001[\275\001Y\274\001W\273\001U\273\001"
+	.string	"\f"
+	.string	"`\b\230\013\216\250\330"
+	.string	"\315\200\334\3131\241\332\343)\021\\\2212\364"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.48.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\357\002\255\024"
+	.string	"\346d\204H\260\326M:\342\3563\347(\315<\217\340\206\017\177\347nZG\033\243O\360\337\316\221\355\227\250\250Q\013\300\254m\323\300\2334;\347\362\263;\260\203R\n7z\361\345M\362\311\230?\235r\366o4\336i\310\244\355\275\245\224)m"
+	.string	"h"
+	.string	"u"
+	.ascii	"\327\375U\207\356@e\"q\225\356\026QR\335\274\231\313|*_\324e"
+	.ascii	"\252\214J`\252<\370/Q\036R\253S\227P\217\255\356\2061\f\005\365"
+	.ascii	"5e\344\005\257"
+	.string	"\td\\\205:\233\276T\350\0242\2612\006*j\223F\0341\220\204\272\024\312\321%\313\205\222\025\035.\306\024a\021\265\350r\273\257\007\335\375\ru(\364\237\376\017\361\277\301\317\013\002\3350\034\252\206\270\232\3306\212\316\b\213z\254#\246r\001\247$\271\205\362\337G\235<|\335\271\232\353\016\345\361sMRyY\320j\250\362\0324U*; 2*\3321\335v\312\317\303-\277\3705vw\237\217\376\271\377\342\376%\3673\356\245\334\307\270g\336\357\356u@\216\321\226\023\004L\272OL\351\352\236\244\242\261\362\007B\300&\b66?\302'\314\221UH\312#(\020\t_w\327\\1\253\334\254\270\346\352\315\\\346\321*\365qsM:\005\034\234\251rY\326\260ZZ!\rLI\275\202\205\251^\316\250a\002<\355z;\245\225\305\"\272\254\3624J\347\353\276ix}R\250\234\f:\253\241\316\3240\377\r;"
+	.string	"l\364J\260\355-\373\307:\254\206oyR\352\341\330\366\017\251\207:4\f\261\037\237\0135\240\330l\006\242\207\345=4\"f\261Zm\207\007F\233\311h@1\032\f\310g\347\007\3263\243\301h\016\\\366!6\203\325d\262\031l\205w\323\330|\364\tZ\275\033\343\256`?V\005\225\346\017\336"
+	.ascii	"\227V\303\277\274\370\343\231#F^\314B\205\305\305\364\2323Z$"
+	.ascii	"K\362\004s(\221!\222UnWKL\221\377\313(\026\270\023\200\324\335"
+	.ascii	"\f\256A49 \240\002\031)\234\007CC\363L\214{\210\361~x\033q\273"
+	.ascii	"sd\313\350\235\034\307X\016\234\220\017\340\036\352M\334n:1\253"
+	.ascii	"\254=\212\321dt\315]\330F\254\261\365\366\224\372\202\001x\341"
+	.ascii	"L\2048\317\271\353\037\036\363\244=\030\214\333\035\007w\367"
+	.ascii	"\233T\342sC\001\347\305h?\013\030Q\300\330/\270!\362]\337x\355"
+	.ascii	"\3400\\\033\210\363\224\360K\372$B)N#\013\0059\336\033\211\213"
+	.ascii	"\241\021\340\036"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.49.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`@\001-\r"
+	.string	"\326\227VC\020o\234\0169j\321F\023\022\373"
+	.string	"#.\b\3128\017\264\207J7\235\374|,\377:\313\f?\206\025u\342\037\325\327}c\030\016\241k\003\256\200\nT\004\004"
+	.string	"\220\253\305\b\204$\225\2269\"\332d\313\224\002D"
+	.string	"@"
+	.string	"E"
+	.string	"\237\317,\262I\036j,E\345!!$\306\356jr\303E\237\227T\221\257\033.>\320\3734"
+	.string	"\343z\307/\020\254\221\017\264pI*a\004V\"\034,\240I*\345\300\356Z?\260\302\215\335\266\002\333\030\373\033\001\020@\372\357\323\007a\237R\036\344\232\201\305\201\3728\215t\264C\222J\225}9\216\243\211e\312V\265\3042\017-0/v'\2142V\234*:\330\276\377q\220\320=\254,N\273\233}\332!;\013%\351\371%n9\021=\235\361\225\310j\205D\341\247P\353\267\246\026\307j\b\361M\230\244\262\353\035\365\177\260O\035\260\021T!Jv\367r\022>\252\242\261\0246\334K\307\023\214\210&%%=\261\037^\304\307g9\336d@\034\307\343\321,\320:n\353:\234N\3530\3204\3206\\\247e\nxs\300\3414\317\266qZ\026\216~\255L\031\301\007q$I\376\210\377\332\335\235\024\f'\036\240u\341\002\240\225o\230\375\240\323\177\026\320\002\305\036"
+	.ascii	"3\241\233)\006\340\005\017r\201\354\300aS\r\017H\261T\342\340"
+	.ascii	"\312g\006\272\306\022 .\350\307S9\024\335\3511s1\263\215d6\026"
+	.ascii	"Rm\327\0055\240L\27441\3169\230\302_\016i\032s\252Q\340D\347"
+	.ascii	"\226'"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.52.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\376\f\365>"
+	.string	"\032g\250\026@@\344J\007\353V^4\320\321cpr\356\303\030\317\323 $\204\201X\322\234\200\205\354VlR\037\205#E}\b\354\200\035\260\003\344|BAx-\225Pw\302\b\371\300\200 B\266\334;\245\224\002Y\001:\001a\001\316\251\352\374\251\263\277s\203P:\345H\351i\333\"\215\202\3328\352^[\207\351&\323\235\327\275\327)\363\\r\017\352\350C\354X\346\316\354\260m\353\244\216zT\362\270\317|\233352\334eX\252\265\266m\357\032oG\317\361\023A\033\334\301\234\004\323a\270\3558\371\205m\272\216r\217\236\343\006N-\316\271\246\343\376\322\320\366\322\243\353\270\217\t\254\256\035\273\212lus\fZ\345\006\307V\231zy[M;\351\266\312\334\2039\331\352M2\313\234\247\353\326\332\266\023\304\264[l\333V\352\2454\333\002\002"
+	.string	"X*%!\035\031)\213\210\206\222B\310\343z\325\364\235\345N0\327\330\034\363\321\002\340:@\240\030\\\272\224ks"
+	.string	"K\266\224\251)P\354\212+Y\351$+HT\252\370\021\025\274)n\304\266\346\312t\311\226F\271\2115\361\242\025\253\004\263m\017\0242\266&\032J\243\016\323\364\351@1\264tY\204\255y\346\311&(dLZ\210\t_7\271\211-q\344\212\005\205\f\255\217fnbe\276\3121\375\252\311\2610O\213\306~\244Lm\333\266\036\230\177\372$'\355N\007\2129S\002N\277#-\327.d\354\313}\305j\333\226\2759F\326<\240\231\233\217\231\251\230\223v\002\334w\235~\351\007\f\ns\373\362F\216z\247\277\177L\306\251\177\372\033mh\230\214\215\006\267\266\250.\370\027Q@\022-\030\270\340\211\300\b\212c:\200\016\365\322\177\362\324G\375"
+	.ascii	"%\205%:\216\211c\333\202Uq\303i\300\023(R\244\270\255F}\225!"
+	.ascii	"\264\365XE\373\2558\266m[\305\355\246\337\260\340\266\322*\273"
+	.ascii	"\330\332\272\255N}\353\265\0022?\177\240\235\206\217\034'\337"
+	.ascii	"P\327_\300YZ\364\017\314\001\261\262\261\261qPC\335~\377\016"
+	.ascii	"s~u_\257\201\301m\205c\310\360n\312\270\255\366'\005\303\374"
+	.ascii	")\363\362F\346\272/\377's\247\355\2531\253\316\037\220\316\036"
+	.ascii	"Vg\255\016\323\334au\346p\2357\254\316Y\327Y\303\352\234au\306"
+	.ascii	"Z\2351\\\347\013\327\331\302\352\\\241\3114SX\235'\\g\t\253\363"
+	.ascii	"\325u\266Z\235\253:\2579\302\352Lu\235!\\\347\251\353\034u\235"
+	.ascii	"\027\254\316O\253\263S\352\334t`u^Z\235\t\364^\363\362\350\254"
+	.ascii	"ttNR\235\221T\347\243\353lt\235\225\327\271\350:\023]\347!\325"
+	.ascii	"9\271:\013\251\316H\325\371\270:\257\253\363\275\316\352\rdY"
+	.ascii	"\006\350\270\230\217\261U\330+l[\333m\025\311\307\006N\321\210"
+	.ascii	"H\026\226\213\235\362\207\336\350\357\337\233\017\021\242\374"
+	.ascii	"\251\350\232?\320\242g\007\342AV\260[X.,\227\333\352\017j\"\022"
+	.ascii	"\375\320\027\375\355\213\3630\023\376\203\350\333\316\020\232"
+	.ascii	"\374!\377J~\313\265\203\2645qeD\t\\\350\231Y:\326\213w\223\231"
+	.ascii	"\300\336\0077\275\320^\0274L\306\306\206\272\313o\0222\234\333"
+	.ascii	"2\364O\356\271\3043BG\270D'\362\300/_\310\322\375\200\204\022"
+	.ascii	"5\354^\272\310\377\360\354\3142A\031\220\277&\252\211+;\002\352"
+	.ascii	"&\342\362\217\317#\316\017\2231\371O\2437\263<\241W;\256\017"
+	.ascii	"uf'\ng\375\003\357|\230\214\r\372\376\372\005\346\2049\325\277"
+	.ascii	"\351O\275\372\027OX\027&\321~\372\244\337|\235f\0214\363\007"
+	.ascii	"\212\374\347Nl\305,\016ZZ\267U\036p\215MD&\3027\263\343?9\304"
+	.ascii	"\375\347\212\326a\376\320\207!\364\374"
+	.string	"\257\321\2738;\215G\304\3675\021\275`\334:I#b\026\025\371\213\031B\267U\251\352\317\f\003\237$\n\376E\370\252g\300'l\221\352\t|\204/\320\027\206\005\302S}3\031\363xD\027\022Bx\0273\005J\340\373L\247r`\024\277\n\357\276\314\314\f\336\247_\372\027Q?\357]3fl\271Ps\254pv\361@\007\327\026\016\034,ZHuq\331\350\252\261\325%U#\006\013\032R.\270\272\244\036,\261\215\033[\\R8l\330\340\222J\326y\365\253\361\210&q\274\376K\300?\237\231\0378\230/\336\327D\364\360JOQ\302h\341\235\326{\370\216\266_\261cv\351\360Z\034>\353;lx\016#\334\013t\203\206\317\212\262\n\237\223\323\360m\227\364s<\216e\242\274b\347\342p,Z\023\366\311\223\213\364I[\220^M#\214+k\266\2463N\200\316\272G\337\"j\350\226\225\246u\364\352\333\034"
+	.ascii	"\316\326X\262 \277\006\027W\334+k\342 \234b\326\245\002\330F"
+	.ascii	"\321\327\274\314\243\264\\30\002gQq\371O\366\244\006\335x}\034"
+	.ascii	"\004t\"\ta\320\031\234\232h\205J\377\364\003\002\3500\351\325"
+	.ascii	"\260\376\352_D\341\f6\206\307\262\360\030\276\327\344\241\373"
+	.ascii	"\203\007\351\237|\341\255\376E\364\217\204\253y\332\2051|\201"
+	.ascii	"\022\217,\274\025 \036\227\360'N,|\343\265\203=#R\374\020\032"
+	.ascii	"\321\351\nK\303<\024\276\302\204\277z\n\022~\302\bw:\232\004"
+	.ascii	"\253\277\"\303*\234\211/\261\372.\323N~J\2348\351\240\036\005"
+	.ascii	"\215\236<e\303\270\375\b\320\004\037\372f\206\246\350\237\254"
+	.ascii	"\224\247'a\245 \211\262YT\364\032\354\254\313\314N\361\201\030"
+	.ascii	"\250\221 &\221S\252FD\222\244 Y\016!\005\204(\350$L\017\022@"
+	.ascii	"E=\n[GLN*\313\376\033s\250\375\007\303\021a\355\256\313K\362"
+	.ascii	"WY\t\212J\"\204\2708Qp\357~\207\035\370^KtQy\267)?\003\344\276"
+	.ascii	"\272\3273\f\2702A\006\365\"LV\361\346\201IA\344\031\020\013s"
+	.ascii	"Y/\b\356\257\227\"\013\300\270n\252\227\t\257l\344\036\351R\373"
+	.ascii	"G\032G\217Rp\213[\354\215\350tH\376\001\253\243&`vF\336\301&"
+	.ascii	"%u\302\333h\022\023\367;\232R\250=\376\207!\236l_O\021S\r]\362"
+	.ascii	"#\022/\001n\201c\002\237\"\226\353X`\306\001\375\271!\274e\001"
+	.ascii	"\004\364\2502\013\234\353\252\242\214\"\026\004*\323\334\360"
+	.ascii	"c\257\200p~-+\013\325\367\236\246\036\\\2575\002\257\251mom\021"
+	.ascii	"N\305\216X\334\350S\375\334\376\037\023\f\341k\002-K\370\351"
+	.ascii	"9]\332Mj]3\215V\342<`1\342o>V\324\265\316\302T\346\002Y{\024"
+	.ascii	"\214\231\254\232'\332\355\374}$\201et\266\274\315\334\t.\345"
+	.ascii	"\205}\330\336Q5|kd\373\211\316\207A~,\275+VN3\324\245\322Ltp"
+	.ascii	"\230Z\021\266\t\020\b\341\371\fM<\r/\216\177+\253\005\221\r\201"
+	.ascii	"\322\023\205\266\263\203\327\022\244p\016\306r\334\006\370-t"
+	.ascii	"\226\001\234K\t\270:Kq\237\031\373\305\213\265\370\254\027\334"
+	.ascii	"\0048E\206\212f;.\211I\204\b\027\257\020\340\006\242\020\272"
+	.ascii	"\355(1\361\230.\004\324\346u\004\006\255;\370\277\240\2366\t"
+	.ascii	"\267\353\373g\271\352\201\267*Dj\237XZ\002\025\357\330C\207\302"
+	.ascii	"\021\274\237\247\f\354M\233&{~x\2249\310n\025><\203Z\253\"\307"
+	.ascii	"=\036*\340w\377\330\336m\237A\301\370}\204\177\243\007aT\246"
+	.ascii	"\244fn\t\267\267\2638\276\331\360`\360\001G\250zH!\216\373\204"
+	.ascii	"\313\305\214H_\037\307_\r\305*_*\013\352\251\026Aa\026w!\252"
+	.ascii	"\340]"
+	.ascii	"^\240\352\356\225\004\3508\212\317\350\317>WdX\007\301\231\210"
+	.ascii	"\364y\250\001"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.53.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\203\007\305#"
+	.string	"\246\375\326J\220TR:\01694/o#\204\001/\236$\326)D\370\3570h\"pw\017\326\t\306#\343\0343\220\363\233\030"
+	.string	"\310\263ip,\"\301\b\002"
+	.string	"f\244b6\325\"\271\325\020\266_p\313\252\252\210\365\355\177\333'd\023)e\n\276"
+	.string	"\254"
+	.string	"\310"
+	.string	"9\224\217\253\374[\345\243'\377\254\374j\362\315\312o\223\317\315_\0021C\316\f\024I\323\251%\227\324\254*e0'{\r\2717\326\313\303\332x\035k\253\261\365\367\360\353\266\262\356O\277\332&]\244h\213\262\342\027[\232\246\301n\261O\353\353\361v\272\034\356\206\236\325l~\372\242D8\343\021j}\275++\346\355\252VW\205\202s\270\335\2422\3017s"
+	.ascii	"\025\261,\313\204\352\204\371\233\212a\334\256\005\260E\205d"
+	.ascii	"\024%:\001`\215\270\332\312\204\352Jw\374\300f\357(e\366t-\207"
+	.ascii	"8Fq\247(\346\216\304\363%M\323\305\242\2722\031%J\323\364l<\216"
+	.ascii	"\330\277\354\277\300\377\t~\364\027_\030[o!)\351\334\312\215"
+	.ascii	"\216M\321\3425\344\345w\307\372l\230Aq\333vgm\3307\b\203\020"
+	.ascii	"\341\343\373c\331\264R\025`_\036W\273-\206s\353\331\230\026\225"
+	.ascii	"h\355\327\177\265.\021\244F\232B\255\025\033S\001=\037\270\313"
+	.ascii	"\27786\007\206/\214+\ty\215[\277\302s\353\366\0035-\310!/\377"
+	.ascii	"$\221;\353_3m\026\177\345\017\241\374\240\312\007B\371>(\237"
+	.ascii	"\307\344\357\230|\035\224\0174\3719\225\217S\3717'\337\006\345"
+	.ascii	"\327\240|\232\312\377U\376\314\311\227\251\374\030\223\017S\371"
+	.ascii	"/&\337\207\362{\225\317\253\374\335\311\327\241\374\276~A\203"
+	.ascii	"\342kt\214K\217\335\t\251\202\366\372\211\231f\2642\354\365\217"
+	.ascii	"\22023bC\235\235\365m\202[\261\306\266V\201\232\327\273u'{\262"
+	.ascii	"s\327\274\006\246Im\351z\247`\315\226\350z\2736@\325\225\n\253"
+	.ascii	"\033^A\r\324(\226b\027\\\347:\2507\271&\215\343\223\037`;r\370"
+	.ascii	"_\300\200\327\230\353\036bC\375{d\2214\350\340\300\301\271\025"
+	.ascii	"\327ul\215\353\3114M\315\316\372\r+G\222(\336r\264k\337\332&"
+	.ascii	"LJ\213\310\313\237\215>\3302\b\2674\215*\360-\262F\"H\2300\341"
+	.ascii	"\334z\366\222\275\3602\273.\221%;\242PTtn5{u\240!\271\273\267"
+	.ascii	"\330\3457Z\345\321-M\323\002\337!+\206\024\277 \324\224!\311"
+	.ascii	"iCpI\250\244$<\302\371\221\020\007&$''\243\n\301&&a\323\022R"
+	.ascii	"Sp)\311H)x\304\324\024\024\322\271"
+	.string	"P\003\022S\320I(d\n\352\222\3035\267Yt\355M)f6l\342W\307\236\310\364\361p\221\247\177\22438\nu\002\306\266\326\333i\235^,\036\356\364\017\032\222\323\245N\243D\300\270\200\354N\211\202\007l\003\366\217\222\304\016l\313R\227\323>%Q\274\205-\247u4\226\\dg+\244\344\302\262\264\375\246b\030qC\215\263g{\3238\r\304b\3237\007v\355\212\r\024\237\036\242\351\232\366\351\365\252\351\036*4]\307\332\270\220\003\254\220\224\270\375\372e\246c\372\3276d2=\243\226&\323K\206\006\3231Q\020\024\301\364~\275\b\200\233\250a@&\221DC\")HJ\222a\r\340\002\031\241\251:\021\020\245\203\n\241Xh\243}\003\013'%\030\2172R\277\007\222\256#\036/\227\301\242\272ua0Y\225\311\275\341R\361\313\310\334S\343\220D;c\233\230\317<\225\347\371\034Bw\027TAc~"
+	.string	"7\003\271tU\276\231^L\215S\200i\026\342Tl\220x\020\333\223G\352\242\246\002\316\337\364\362\025\031#\200\261\357\304m\241\020\372\262\276\316\375j\372=\003O\246yDTJ<\375^\277\202Q\215\204=-\346\3415\036\337\240\006\240\204\356mU|\277\212h\021>\260\251 \224\354\271\265\007\343@\320\024\327\240p\3141x}N\f\b\277\216E\231\254)\334\002\343\207\327\177\347\327\342\372\373\321ld_Y\3433VQh\301=\234\346\365\264\204\263\262#\221(\275su\t\225\n\205\360\""
+	.ascii	"\232\027p\215I-\363m1,RZ\212\027-\272O\347\r\001_\3445/AnX\016"
+	.ascii	"l3X.\007\344\330\315\302\260#\253\001"
+	.text
+	.section	.gnu.lto_batteryUpdateLVC.54.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\366\003\335\031"
+	.string	"\206.\244H\300VQ:4\017d\0133\320\0203\3705cJ+K\255@dh:n\213\345\324\033V\274.\206l;S\374\263o\307lP3\336\370o p\372\346MQ,\310\242\353\035\343\357F\360\314\221:c\322\b!{\023\271S\n\213"
+	.string	"\202"
+	.string	"\227"
+	.string	"\316\261\305\317\213\266/\355\023\275h\347F:\016ku\241T\244V\035\004?"
+	.ascii	"?\021<E?\275\317\320O\357\330Y\256\213Q?!\031>I^j\255\252\205"
+	.ascii	"\361\235\243B\360\243\323[\271\343\1775a\3156\342\250\004\341"
+	.ascii	"W\343\002\305\212\203@6N\250\220\237\217\244)>E\033-\200\215"
+	.ascii	"\204\364\274\0067'?\001l4/\325\364\342\212h\353\221\353tb\205"
+	.ascii	"\207\240\326\372\035\227%l3)\277\232Z\253e\315\206\342\026o\033"
+	.ascii	"\207\355\n\366:\005S\356\027\224\344\213\nYk\035\261\2133\224"
+	.ascii	"\267\350\227\003\322\256G\202\261\335\341>Z`\255=\021\374\036"
+	.ascii	"O\372\340\017}\332"
+	.string	"\365\222\257}\372/\372\371\225\200\313\335\212\214x\344\223\255\233\311\305\331\367\352\006\331\237t\212J\317\334\350\227Yiq\245Q\237t\370I\203\237\364\367IS*=\247\2647\245\327\223\226+\375\001\013r7\026B3v\212\256\232x\nS\231\246\221\032>\217\037\345\\g\006\270+7\242O\007\337q\001G4\232\266@\231\331\324~]|\306\314\225\331\231\375\321\275\0336)J0|\344f\362\311M:Ls\347\317\356\313\277\305\025\271\267\343\023\031\270\363\326\333\001\031\321\305E\271\r\265)\234\211\315\022\361\307I\016.2k[\370\222N\222\0138\242[\021\213_F\217\310\016P1\022FY\312\301\305\301\321\017%\3632\272+\301 Y\301p%\031Xk\215\340\0179\221\f\0326l\240\237\273O\022\272\227H\230\310y\213\223\277\241rG\244*\007\362 7\376\220W,\026}\366@\003\003\321\212\311T8/\227\353\265\""
+	.string	"\263a\271Z\025b8\254q\224\255"
+	.string	"xE#bd\305b7\034T\260\361\005\303a\301T8\255\033\227j5\302T4\006\374\n\301\032U\261\327kT\211:\236{u\203("
+	.string	"1\361\354\fu+U\256C\310SMK(\356\024\033\005T\244`\251i\341ir\324\212{\332-\\\324\322]N\213#\025\334p\031\210\241\351H\355\267\340\026\350B\263A\327Qn$\364[\003Xh\271\331\322\375\302\b\231\3423\306\272Z+\2708{NCO\237@S\033K\250\021\300\220S\320\t\n\032\212\023$%\315\001p\002\031)\274:\021p-4\210Ha\266\031\371\214\2377\"PI\353i{\312\260\264)\352\235\bq\2612\212p\0178\367\321}\250\310i\227E\304m\266\374\205\310\246r\320uC#^h\350\365\342\"i2\3146k\373{.\3114\300)\210@\261\230\300\265\0319!\026\206\264\024X\022*~\210\237G,6\264\003\371\242\340%\301C\272\346\004\336D5\222\217"
+	.string	""
+	.ascii	"$u\\\310\034r\214\004\271r0\304\246\324H\376\301\030vu\311\273"
+	.ascii	"\253\260\211eE\246\345qd\231#\030\250"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.55.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\230\002-\022"
+	.string	"& sG\320\322(\035R\303\244\022Pi\\i\210\032/K\345?g\017\f\224\252\356\254,\0011I1\\\366\003\276\372\303\003\260\307\027@O\350\037ec\300Xh\253\007h\211\007\024\210\206\200\335\231\021\250\036T\375\311&\204H\231R^"
+	.string	"Z"
+	.string	"]"
+	.ascii	"\337\273\223\354\262\211n\003\261\261\306\347\205g\307\356\202"
+	.ascii	"\372\341\256\203\214\276\350u\234\246\313\217%#\331\254\345 "
+	.ascii	"#\243O"
+	.string	"\b\206\003'2\002F&c,\351\0203s/\300\354\2054\273\220\235Kr\261\324\332G\204`f8\221\335=\316\023\303\f\226\031Kv\327)\233\305\334\244\333\326\261\315\300N\227*G\241\372vc\013|\333u(\3706\357\314Z\311\313\336\371+\336\273k\214\3350Q{\345\315\266\301Ri\366\271U\032\3739w\344\322\034\227VMg\246O\022\360\202F\203\333n\206\233\217\r\352~n\236s\373'\374Z\002\005\256\347\260|+\"\366\324\310\310\261k3\360\316\007\002''\336\273X\203\250\204\016Oi>\213G%\340\241hg($\355\222)/\213\372\332\177\243\201D\020L[l\333\356v,\236*\200\332W\274\207\305\267qx:y\357T\217cH\346\225\267<\2474?\305K\315\037\250\253H\341I}\212\241\334\335\026U\232o\301\273\242\354\330\210e\017\333\001\247\024*\205*\251\204\017\302S\251\225\nM\253\320\301"
+	.ascii	"\233H*\254\302V\253\204\002\262V*V*d\201)TI\0054\255X I\001\253"
+	.ascii	"&\204+\260\245R\255@\222\355u\2451\316? \030A/\205\2018\006\247"
+	.ascii	"Cft\027E!\273\373)\315Q9}\210\235\031\020\016\024\341\207S\004"
+	.ascii	"\033\210x\324b\336\304\363}\336\302DB8 \320\002\251!\363\263"
+	.ascii	"d\221\263\355o\262\237{\333\367n,\256p\344\346u\3672e\241-\334"
+	.ascii	"^\2755\3541\b\305\225/[\371V\215\270\360\255\273\360`\375\222"
+	.ascii	"/\372s\233U\244\313\200\354Y\246\322\356e#\233\371\250\332M,"
+	.ascii	"5\024=\036Q\203\006r\202\244\025\311n\321r\\4ap/\2702\234\263"
+	.ascii	"\002\023\334\202\033\355\205\241\020z\273\321h\365\325\243]\207"
+	.ascii	"\217\3452"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.56.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\b\001\305\f"
+	.string	"\266\327UC\020Q\234\016<\003\272\350\020\034"
+	.string	"\336"
+	.string	"\005G^5\"\202\376Vd\001b;e\bXR\243O\3264\330\327J\352`\003\223=)\315dd\342V\021`r\021\2149\326pt\342\350\n\300\276\033m\262wJ\001@"
+	.string	"A"
+	.string	"D"
+	.string	"\340;$x\262\273\341D\310\256H\300\003\260\323\313\001X\247\325-\326\251A\373\305E\017{\224\213\n 3v\267\316\016\007/A\377\036\237\204\244\320\345\205`w-CR\351\236\267-\300\366\001\373\032\002\034\366\224\306n\272\257\237n\353\035\177E\261\214\264H@\262{!EcG\252\"\304M\377\311\276\350\227\370\307\ttI\205\030\300L\240oio\241\004U\"\262+bN]"
+	.string	";}\305\366\245\375\021'\021\024FF(\264k^\306\007\037u\023 \037\204\033l\362\341\251\277Y\247\326\374\307k\214\032\"2\210d\312\024YM\273\303\301\030'<\260\210X\322\376@\220\017-W\260\030G3d\213!99\330\257vw=\003\033\215\344h\244\307@\353l\013>\217\326u\237l\303Y&B\247}\337\206S\275\216\363<\232W=\333\246S\263\316\253\231"
+	.string	"\346\034h]\3758\256\253\025q_\355\344\260\002\222Q4G\306f\212\354\036?\206kZ\023\233\030\220\032"
+	.string	"2\241=i`\\ \210\003\22755\036Sc\202\024\320\256O\324E\252\025 \034HA\263\3415\005C\327@/\356\226\320"
+	.ascii	"\374h\302\302E\035^A\004\234\242A\254N\203ky!L2"
+	.text
+	.section	.gnu.lto_getLowVoltageCutoff.57.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \365\315\006"
+	.string	"\362\314/4pM\322\001\250\207\341`\335C\b\"\204$r\372l\327n\332O\350\372\255!-\351\221\311)\273\224%5\246\255\327\351\205\262\301\243\f\033\003\2244\262\311\336)\005\266P\030i]W\265"
+	.string	"\247\214\363bMxa\250\032\240ENH\0258:X\022^1J8\325\275\363\330\037\230\264\2739\365=^\037|\214?c\260v\372\347c\321\237\301\306A\330U\323\\\205}h\235\307n\003\023$\n&\273\022\037\224\035y\"\031\2663\366\344o\234#\343\214\240^t"
+	.string	"JR\"@Nv+t\275@\364'= \372s\026\317\3362\377\035\2074B>\224\243y\253$\354\256\033\345tnw\333\007\266\021lS\004\b"
+	.ascii	"2\003\336::V\b\3055\261\032!\264\020\231\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryState.58.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203@\324\030a1\304\020\035\262\037J\310\0133}\265B4\213z\017'\331\215\251\036\2417\245\303I`\216B\236\213U\213\3365\331[\312\224\002\316\\6P\242(\314\202\233\340\2334\322\3444\f\230\006\227\201\223\273\030\3709H\320Q\357AW\211{\005\245Z>\372`\037\344\261\3625\274\341\344\2557\237\023\275\245\006P|2dGO\352\205}\266\n\262\235N-\2600Q \331\225\b\245lI\023\331\260\335\261+~\307=:\256X\314\270\004\",\210\020\224\335\350,'\210\336\330\007\2427\305x\365\254\374\177\234q\214\234X\227\347\t\220\260\273N\353\232\270\365\266\017l#\330\256\b\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getVoltageState.59.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`m\322\001@\203"
+	.string	"gR\233\342\362\251\325aUu\004\f\"\325\302\n\330\032\352=\234d7\320UBoK\020\025\340\024\205<\027\253\026\370n\311\336R\246\024\306X4p\262\254\213\302\253 Ue\246\352e\026.\f\017\003\253g)0\3250\301gQ\024|R\334+(\265\342Q\007\373\036\217\227\177a\315&\217\335\371\233\350.\025@\302\223!;vR)\354\267U\220\355t*AFI\002\310\356't\262$N\004\3036\307\226\374\215sp|\265h\221\005@|\036>Lv\343\253| \272k\027\210\356\264\342\327\363\362\337\361\2461\022\202e\235'\005aw\235X\026q\353m\033\330>\260=\021\b"
+	.ascii	"2\003\316:#f\b\3055\3616\002g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_getConsumptionState.60.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \366\265\006"
+	.string	"\362L/3pM\322\001\240l\302H\177\001\300/\316\222p\006\216\021\336$\212`\375\255!m{82j\227\262\244f!\365\271\na\031\335sc\030\005\203\310\336R\246\024\326`8P\242\250\314\202\233\340\2336\322\3446\f\231\006\247\201\223\303\030\3709H\320Q\357Ag\211{\247^@\372`_\344\261\3627\314\351\344\2557\277\023\275\245\006P\2002d\307O*\206}\266za;\235Z\020r\242\200\262+\021ZY\223F\302a\333c[|\217\177x\\\261\250q\tDX@\214\250\354Fw9A\364\306>\020\275i\306\253g\345\037\344\254\243$\305\272>O\200\204\335uZ\327\304\255\267}`\033\301vE\b"
+	.ascii	"2\003\3020\021\341j\327\304\333\b\234\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_batteryStateStrings.61.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \357u\006"
+	.string	"\204\013\216"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\310\332\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'2\206\b{\by\276\003\005\001'?\206\bwu\301\002\005\001'I\206\bsq\304'R\206\bom\306\001"
+	.string	"?\202\210\200(k3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005INIT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\fNOT PRESENT"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\b"
+	.ascii	"H \r\002\006\204\203\214\001\341<\363hP\371\r\240\b"
+	.text
+	.section	.gnu.lto_getBatteryStateString.62.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"=\t"
+	.string	"\306\321@9@\217\322\001{M\202\216[\234\342\021{\214\0066\374\312\357{\217l\374\004\b\250QS\365F\363\232\020\033\354QR\023j\035\005B\306(@\210\231i\"\217\213\326\310&{\247\024/"
+	.string	"/"
+	.string	"0"
+	.string	"*\r\212\007\206K\266[\251\353\005\266\317\315\003\266O\311\361\322c\311\177\353\332L\212\013*U\361\250a\330]GTJu\313\333F\260\255`\033&\266\243\245\214\216\332\200\nKC\313n\306LfW&\354\303'y\035}\304"
+	.string	"\0271\331\356r\237\366\310\346>o\223l\316\017\271\b\311%\202\332\021\177}\264\263>\355\205\266\220|\353\t/\261\030\330Kn\002\372,K\210\342Q\237\276h\373\214\362\365\007\256\027\210\206)\316\354z\212r\303\276\266r\025\366p&\276.\f;\016\024\374<\020\324\201\024\364\320\371P\317\007RN\201\275\210\356\243\241\347}\224\253\246k+WR\032\230\344\311\266)~\002\261\331\265X\360]\001\f"
+	.ascii	"2\241\365/\260Z\302#\235\2333q\216\324}\256\341DL8\250B\027T"
+	.ascii	"8\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_batteryInit.63.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\301\003\265\027"
+	.string	"\026\347\216I\260RRc\367Y\207\177\314\365\274\235\254\342 c\235\236t6\204\006J\365\315f\377UD\357\003\r\251\303W\026\331\232\017k\232\025S\344\177h\207+\351nl\273\223\325\357N:\\)?A\3518\031~\023d\322\344\336[\246\024v"
+	.string	"x"
+	.string	"}"
+	.string	"`.y\354Z]_}\001'\346 \273\\\236\356\375\220,r\213'\324\220\355\323\214\332\\g\372\271w:\302\031\"\357\275\265\322\347\350e\3664\313\212\3725\353)\r\366.\223i\262\025+*\r\222\370\271!@\360\306\016"
+	.ascii	"\222b\201S\232\027\336\204\301\343\230\006E\2744G\302p\254h\301"
+	.ascii	"\237\251\340\006i\202$\b\254U\246r\357uM\203 \356\331m\373l'"
+	.ascii	"\260\315Y'\266L\001\270\321:\2622\205G\341\240\034\264@\372\213"
+	.ascii	"\265]\376\364R\202u\357M\361m\374F\005?\350\247al6\343\261\306"
+	.ascii	"\235bn3\262\341U\214\365g\234F\214\314\314\214\375)3\272\372"
+	.ascii	"\322\207;\032\336\331cD\3728\353\307\270\f\034\006\235\316\376"
+	.ascii	"<\215UG\346w\326O\272\322\316\017r\006^}\372\323\347\331\237"
+	.ascii	"'B_:H_\276\232\264\231~\265\354\261_&\223\311B\350\020Z\204\026"
+	.ascii	"\241.P#\261\235=\242/x\027\036\201q\254\246\327\304*\275*f\036"
+	.ascii	"\2506*D\223H\210\304\342\257\354\315~n\316\335\271&#D\251b\257"
+	.ascii	"\212\371\210C\tEy\r\366eI\223\017`\r[z\217\005\263{\201)~\325"
+	.ascii	"\213\f\032\254\254\330\237/e\303-0\245\002\365H\337\3012\273"
+	.ascii	"\327\367\324\317q\035\017 \260\260\330\237v\004\t\365\251+\321"
+	.ascii	"\250\b,{\366[\254=!\266\241\360r7\033\033\030\0135]\016\247\253"
+	.ascii	"\271\351j52045[NWC1`\334\205[\256f\203\303\345j4&\337K\236\013"
+	.ascii	"?\243\362*\372\312\237\337uS\226\342\304\220\217P\225\260*\250"
+	.ascii	"B\334\353\004r\016$\0054u\022\361\221\265\003\321\335\371\362"
+	.ascii	"\205\230k\366\243=\366\247kz=p z\020\333\\\345\210)\344\275\275"
+	.ascii	"\353\320v\200u\314\347@\320\025?j)\033&O\266\320\242\254k\241"
+	.ascii	"\001Z\250QD\313\0243UAJZPJ\007\260\002\021\301)\017\0210\275"
+	.ascii	"\224lJ\265\264\006\002\216\274\276hITq\374\033|\006.\332\202"
+	.ascii	")\360\361hN\203<\236@\250P\206\016\362RQT\004\226A\231\247\356"
+	.ascii	".1\200$I\370\307K\013\026\021h9\320\037\2324@/\223\237!*\233"
+	.ascii	"\032\222d\254b\237;D\356\027\003H\204\342V(\224\007\322\365\326"
+	.ascii	"wuj7\344Q\251_\316\223^N\f\037\347AXL\n<z\026\254\240\250\353"
+	.ascii	"\270\203\177x\342\025Z\306\260pz\241\210\371\342\233\016\026"
+	.ascii	"\256\302\235\215\200\026U\273\303\367\260\301\364\300\270=\007"
+	.ascii	"\310\247}\355\272I]\320|\247\n"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.64.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`!\006%&"
+	.string	"jC\324\016DphQ:\223\247\004\353\201D\213s\bH.\024\032A\322P@c\233\031\262\2470\252\274\373\251\265\375y\365\200}o\327n\177\223@\n\262(507nM\332\034i\006f\214\b_t\375\337\b\331\204l\231d\327"
+	.string	"\316"
+	.string	"\337"
+	.ascii	"b\310\342\007\324\313\215$a\361J\245\030\013\303\005\341&k@o"
+	.ascii	"\362\267\234\013\216\027y\206$\017\226{o\355&3\016\346\332\315"
+	.ascii	"\2561\363\233\371\\\357J\357\245\203g\367b\2759soQ\002G@o&\235"
+	.ascii	"\200\275Y~\200\275\311)\363\330\213J\356\311l\r\277 \357\275"
+	.ascii	"\267\232\344\351m5\332\f=\255Y\326N\371'\356w\333\211\253\335"
+	.ascii	"\250\242\320\306\310\270\262\314N\334\201B\216&I\211\022\322"
+	.ascii	"g\371\200\f\r\241\327\211\232*\t\374xB<\230a\333\023\367u\017"
+	.ascii	"N\214\177\260\200P\335<V\024\025\024M\352\311\036-\300\212\032"
+	.ascii	"R\226\024\374\024\271\312\260\200T\275\226\025\236\220UER\302"
+	.ascii	"\322Vhx\347_\357\035R\301\356\023w\357\345&J\0019\00383\357a"
+	.ascii	"f\036\263\271\025]U\002\352Q=\007\r\023u5\252\002\352\271\274"
+	.ascii	"\203\224\252=W\206`P\202Os5%\234N\234\2603$y\262\324)\255-sJ"
+	.ascii	"\244~\361gV\240\367\002O\344\227\271\031\024\374&7Y\305\212\025"
+	.ascii	"\226\305R\237\31068\311\243\260\376X\317\031\257\253Z\2638g_"
+	.ascii	"[t\341#\354B\314\027\36319~\023\326\275\350\023_\330\233\257"
+	.ascii	"Z\252 \255\272\246\200\235d.\006\273f1\277&\223\311$\327#\314"
+	.ascii	"\266Y\301\275\234\013\034\354\214t6\013\2505\037\335\3537\252"
+	.ascii	"5\323j\315\263Z3j\233\317Z\263\2455\233\263\346\022m\256gs\333"
+	.ascii	"\346'=\020\031\362\217\f=\367\376H\036\272G3\215\326\275\374"
+	.ascii	"`7\2732\237\371E\376\227\203\341\032X\215\034\001I\245\007b3"
+	.ascii	"\350\2757\003\377\317\001\245L\370"
+	.string	"Mnr\352$\325J\265\354M\263\032A\t*K\003\354\244\235\325\254\363\232\"l\374\240L\266\254\266\261.}\032\364\321\323)\2269\255\222^\351\023\313j\273\256\204\365\367\005n\246\0049kX\244j\300\250\345\027\310\016\203\255\264\253OD\252\007\363k\031\277\216\3019\267\031\267\216\266\017\237\364\013\001\025\005}T\2317p(2Ny\234\337x\221d\277F\304yv\220a1\355\374\316\361\360\030\206;VU\365\036\232x\344\323in\342\355!\007\312\275\222\303\017\373=\330\233#\256X\221\313\301\215|\357\357V\250\222K\241\254\310\205\274W\327A\355\352\251\0231\363\207\277\001\201\336+\274\300os7!D\220 ao\326z\202\351)\3632\252k\236X\241b\025\fC\2517#\206\317\351\326\264cb\332\345\016\364\234|K\276\022>]\317\205\013\021\272\031>\337\216\007\303W\324;\241c\212a\302\327\244\343\361\234r"
+	.ascii	"8\247t\203\247\363\371\226Z\334z\274"
+	.string	"]\257I\327\2735\305Xb\272\345x\275\233R\002\336\321\320\361n\276\335\216w\253\025\201//\016X\203\345\275\367\332,\364\254\362S!T)\221\244\247\372+\322\301\033\027\370e\0328\253m\314d\361\252s\306\375\032\321\261\3267Y\024V\345(\204\363\177\375<\302\242\034i5\213\033\205p\233\230\034\037g\204\323\352\2160?d\310\210\033\245.Pi\025\255iV\232\244O\344\244aE\003\210\r\023\375\t\354Y\025T\356\341\224\230\023\312\245K^\234u\202\225AeS6\246\316k\254\255\005j\213AY\005;\311f\265\265\034\004\025\006\354}\250\201\030\310\034c\206dH&I\322\024:p\002\221\251\243\362\020h(\243I\222\306\2156\036^\311\243\357\022M\022b\227\0343#B\276`\235\021Z!H)\227h:e\376\311\235\342\360DP\033h\264\203\334\225a4\334f\205\27767\355J\275\220\316f7\323-\317"
+	.string	"\363 U\320T\242\376\364X\340\364I\220\"\307HC\235\301\r\335\\\275\362\310t!\031Ed`\245\216\204+\212%\316G\333\365fj\261\302h\335\211\363\353\263\025/X\311*xvjs\301\216E\310\207\243\007\313\337\330\273i\242i.:\363\352\003\\k\331\321\327f\247KOXB\210\351"
+	.ascii	"\031:\350\007I\373~\021\020\322\017\017\r\220\206\252\024\357"
+	.ascii	"\034Q\202\203'\022\372l)\346f\241\251\223w\265\252\364\325\342"
+	.ascii	"`7C\243fF~\340\0231\345\007\362OTDvAL\334\334\027\352\362\334"
+	.ascii	"\005J\313(\006\203\275\213\265C/oa\364\201\357\313Q\177+\312"
+	.ascii	"F\r"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.65.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"U\013"
+	.string	"\366UN?0O\233\016D\200\327\251\202a@!\221\n\007\204~\351\r\\C-*\253\225\025\354\036\201\2206\3626a\2333+\367>s\033\354\1770\324\252\032M\357\230\211\203n\022\223\247}$K\366\2262\245:"
+	.string	"="
+	.string	":"
+	.string	"\033&^\354.U\271"
+	.string	"\351\021>\200\364\250\033\236\035jf\276\344\002C\214\214\270\016t8]\270R\272\rVv\367\037O\216.\224)\271\354\256\223\353,\334\361\266\027\330N`_Apw\327\252\301\326{w>\3758a\201!\205\204o\227\302(\306\206\304\023 \356\375v\346\177xr\317\337\004\2520`\202\210\207\026\273k\340\321\007\246G_\304Gd\366\007E\034<.\322!\320\031i[\020\362\\\252*\350\251\332\341\221\256\031\220\025[\216\330\306\016\342\231v7\004>\211\227\210\340{<\372\243\221\347\036}\r\351\361*\331@\001\303\323rd\213B\251\035\366\003W\345"
+	.string	"\243a"
+	.string	"\300\032\313\347\252:\035L\206\302.\013\343T\030\305i\200\331P\232\013\243,\004l=\250.\252cY\0275\021i\207\232\272q\361!\375}\355\334v\265\002\252\034\266U)\031T\204h\032\n\022"
+	.string	"seY\203m0bf\202\007G\006\254\340\006[\260\013\205\035\3352\031r\231\025T\274\217\teQ\333"
+	.ascii	"\327\240Q\370\f5d\273J\031"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.66.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`q\004\265\035"
+	.string	"\206x\301H\260TN:y\023\236\211\177\341\317\006b\fZ(B\036\3066r\205\216\366\024`<\2356\3741,U\200\225\357\271\301!\270\351\344\335\266x\275\2007\273\235\275.}\207r\023G\222\343\026\207Z\034\232z\307\023\2737\221;\245\250"
+	.string	"\233"
+	.string	"\263"
+	.string	"L\226\302j=\221f\245\212\315 U\337\372\263.\355{\325\306\214\374\306\273l\233\227\236\303,*\310\250\034\350s\331\366\340q0}KI\254@D)0\240\003\3613\3466\364S\236\206~\332K\266\355S\332L\276\226m\317j\022\253U\315\253*\313\254\326\340\201O#\020?\255`\001\223\233\036\214q\202VaEuQ\2515\210\333\2517\235\316pe\223_{\020\326\260\222&\365\033q\232\342\263\345\227\342\341\355G\302\366\203\222\313ui\3427\206"
+	.string	"j\255\327\272,\361{\222\262\366\240\326j)\365Cq\327n\033\204\355\";\374\005_\377\261\363\251>\355\301\310\210~\006\355\271.`*\314\006P\326ZG\354\302p\023\375v\340z\002%\253\330\347\361\036M>\225?\360\344\245x\364\363[\233Zr\266\302I\246\331\301'\2710\354\207u_\330CB\337\272\203\2504\320\263\356\037*\355#J\367\210\322<Tz\207J\353P\351\034*\215C\245oj\3226\242t\215(M#J\317Pi\031*\035C\245a\250\364\255&\375\"J\273\324\244mT\272eJ\263Li\221J\327\2464\235\322sJ\207Tz\247\264\f\245\037"
+	.ascii	"\310*\337\230\375!{\331\333>\nM\302\225\350\304$/\373\2602\240"
+	.ascii	"m]vB\211B\233p$JF~\244\202\205\013\027\350\247m\023\320 ;\003"
+	.ascii	"\316\234\035\0320e\214\253\211\027\332\201\343l\316Z\216R<v\023"
+	.ascii	"\241-\213\263\367z\210E\025\224\321DG\024\226m\331\360k\\\"."
+	.ascii	"]\226\375\210\244\266\342~4\253m\017\221(4\260\357\360\r\252"
+	.ascii	"V\247\241\271ty\310\306\253p\345\316\375h\365$\323\274\033n\216"
+	.ascii	"\222\321\314\030>$\203Xke\340\007\271\020\r\0338p\240\237\273"
+	.ascii	"\037R\006\fZ\271\257a\005l4{x%\032\264=@\027\316\035L\267\300"
+	.ascii	"I\255P\f\374.\"B*J\312\361pG=\036\257\247\333QJ2\322\345B\344"
+	.ascii	" \300\354<\344\222\216v:\337\216\202\214uDJ\276]RR\256\003\016"
+	.ascii	"\311\327C:\332!\341\216\214r<\234\316\207\204#\362q/\304\316"
+	.ascii	"\207K\352\365|8[\320\351\341\367\205\1776c\n\261\\9c\021\016"
+	.ascii	"\255\210)?\344}\374gK\330\376\331k\375&Z\264\020s\332\247\220"
+	.ascii	"\302\254\020\031\320\302\024\271\317\002\355\273z\326g\303/\236"
+	.ascii	"\255\331\2365\3205b\355,\217\316\306\354\3166\2702^\335\366f"
+	.ascii	"u\026\3275Z\331\354M\2043\021\263YIV\006t\"@i\266f\013|\215W"
+	.ascii	"3\353\2624\253\003e\264\222\331\231\230\275\255\314~\274\nQ\250"
+	.ascii	"A #\221AJ)g\"\231\321\264\260\325\200\002\031#+\017\020XfE\311"
+	.ascii	"p\303cE*3\366\213\312s\226\322\306}\2363G\205\332X#b\001\270"
+	.ascii	"*,\254\343m\306\3741h\204\"\222/\032#\205x\351u>\027\361\356"
+	.ascii	"\377/r\f\r\235\362\017\300\271\305\331<~,D8<I!\233_\nsX\027\r"
+	.ascii	"P\233\r\317\212\320N\260\t\245\223\236\0348\250Lz\ti\201\315"
+	.ascii	"\032\264\025\345LF\003\006\242\331\322\223t\360\214\302\357z"
+	.ascii	"\200\320\211\257\373\324\206\2620\332\325\203z\256;\376H\tx4"
+	.ascii	"Z\":*\252;\237\330YRD\276\177j"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.67.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"\035\t"
+	.string	"&Q?7@\255\322\001\364F\254uf\215Jx:\270\377\272\210\366\177\231\202\335\006Y\371^1-T\273wE\240EP\343]\354\031J\213\206"
+	.string	"!sUP\244\355U\373do\231R."
+	.string	"."
+	.string	"1"
+	.string	"*\362)\230\335\275\352\0250\034]N<J\203\331KD ,\311\201\323\005x\3255\"\374T)\230\335\265\202\241\304\275\335v\202\355\003\333\037\001Z\263[\237F\n\373r#\312\276\372[\201\013$\004\333=\325J6\266u`\330\276\305\"[\366Vj\317\341a\332\030\331\335\031+.\272\214\001\001\260U\354\213\243\247h3Wth\362\250\321\b))\315\266\367\214\007\200\335\022\202\277:\013\302\267\370\346\017H\017~\363A\223o\217\024\223\214\204E\n\336\\>\035\307\343\311h\246\327q^\207\343\315\316B\206an:o^\b\3145p\272\351\341\270nZZ\244\313\215(+\274b\244\370\311\212\332\234\203\036t\r"
+	.string	"3\241\305/\306\326Pq\330\233\250\266@\n\212\270\355\206"
+	.ascii	"]\303\t\230\340/\343\022\227\313\224B\355\001"
+	.text
+	.section	.gnu.lto_isBatteryVoltageConfigured.68.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"\"\01635Pm\323\001'\243&f\2508\274\261\264(P\004O\017O1Y;\364\037,\031\021\013\nF\203\225\036\356\31513C\224\323\375^A@\232\t\035\016\332D\312\224\002\316\\0\213\272.\214\002\214V\0255T\204\232\005\f\003\314X\021^,\256\032(\013^Ue\301J\247]Z\375\250\016h\272\331\217\323Uu\022q>6;\234#\006\354N \370\033\017=\370\030\177\206\300\362\334\237\217M\177WKIH\313\221\335m\251\025\366\245\325\217\355\264f\372\222"
+	.string	"\310HD\310ng\204\262\"\317\003d{cWlp\260q\366\356\242s\220\tGt\262\333A\265x\366\314\374k\374u\244\220p\036\211'@\302\356:9\017\305\255\267M`\273\300vF\t"
+	.ascii	"2\241c\037\030\302\004;T\241\270&>F\344%D\016w\316\324\316'"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.69.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\025\007"
+	.string	"\262\21514Po\322\001 \306\370\031k\261\265\202a\007\006G\200\225WS\372\343P\334\2325\326{F\226\221\275\241v\246\252\252\030\253\375\317=\321P5| \262\211\224)\005\326`8\217\272\256L\203\263^em(\313m\0342\017N\363,\2071p\005A=wU\325s\227\270\227VEV\004\220N\330\216\370\b\f\330\335\005_\344Q\302\347x3\247\223\307\336\374\216\n\204\2002\263\343'\025\303\276\264*\262\235N=XA\201%\273\025Y\313\2364\223\016\333\036\373\342{\374\303c\230q\303b\032\245P\220\260\354F7\360\202\351-O0\275\251\306\341\023\372\007\271\244\222\215\260\320\347\t\300\260\273N,tq\353m'\330V\260\235\021\t"
+	.ascii	"\002\013\255\262\030\207\"\036\031\002r\r\277\215\030Y\210<\334"
+	.ascii	"\025S;\311"
+	.text
+	.section	.gnu.lto_getLegacyBatteryVoltage.70.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\255\b"
+	.string	"6\221<5@\217\322\001\235bP\335\3152p\355\323\f\321\220\351\346'\373\0231\263\032\271\377#\326Y[\210\301\353\244&\374\f\243Ki\020@\034T\301\226N\253\335\233H\231R,"
+	.string	"+"
+	.string	","
+	.string	"\260DEB\265\354rQ\340\004\360/?"
+	.string	"\3774\343\333s\363\037\362\327\321\261\224L\240\347\205aw\235%\223\305\255\267\235`[\301v*\034(\025\303\276\265z\262\235\206\232\2664\255\232\316L\377r\260R\331R\273\024\235jS\236\t\207\355\217\215\361?\016\362\361\226\234FE\357>\201\251\252\026\312\350B\224\235\257\251'\255\034q\222\r`w\027\374\221s\232\277\361g\tO\276\364\347{\340\337\265`E$\224\235\035\336d&\262\253\323\3214D-\3034\316\245E\216\203\346!n2-f\f\214A\\Y\354`X\0261\334\336Z=AE\b\251\310\226\302"
+	.string	"UK\037j\344\021\f"
+	.ascii	"2\241\347\037\230g\002BE\027\004\207f\214Cu\265k\342\372\b\235"
+	.ascii	"\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.71.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\322\21525Po\322\001 ;\263\022\241f\241\203\002\001\253LB\247j\320_\242\3606BP\353\335#\262\214\213\njg\252\316\020IJ\3775\355\250\030\2508\243\336M\312\224\002\356l>q\252*\216\303\243\"\244<\023\365<\017\034\210\327\211\324\333\034\030FL\361U\020\306\227\331\366\227U\222\025\001S\221m\211\233X\001\273\273\340\227|\233\360=\356\374\001\345\263;\037\244\002$X\226\354\355J\335\260\177Y%\331N\247\016h\\h\037\245\354b\224Zv\305\241|\330\016\331\031?\344\"![\032\n\354\322\200XT\234\260\354n\217\340\006\230\273|\001\346N9n=-\377#o\020\215T2\355z\0020\354\2563\3232n\275\355\004\333\n\266;\002\t"
+	.ascii	"\004\013\315\262\030\207\"\236\031\002r\r\357\215pY\b2\334\025"
+	.ascii	"S;\311"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.72.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375 \352\205\006"
+	.string	"2\314-4`M\222\016@\003*%4!.U#\224c,9\346\322\256\263k<\326\266\215\265\311\240m\030\245z\203\215(\"\372\300]u\001\312I\312j`\244!\262e\ng.\033J\262,\314\303\253\250\251\322H\325\323@`\"^\206\252\336\305\340IB\242\2365M\324\263l\331\321\035x\334\347;R\222\353\202\336p\260Y\243\313\th\204n`\303\203\241\3370t\035_\200t\034?\216\216\300\003\244\265\"\224\231\021ZI\224\350\004\344\357\274\345\005\206\316W\301\004\226\202\020\202AQ\242\222\271=\367\321\253x\335\212\324\341ca\222iXQ\240!3\307L\323\350\256\177\302\257\360_\004\b"
+	.ascii	"2\003\3020\021\341j\327\304\302\210\274\204\310\341\316\231\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_getBatteryAverageCellVoltage.73.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"5\t"
+	.string	"\366Q?6P\215\322\001'\223\203\310\250\272\244(\236\b\004\"\343\337\312T3\214hw\304\333\206,zk\240\225\215O\373\352\264\252\352\271\202\177j,0\263\240yYB6\2212\2450"
+	.string	"-"
+	.string	"."
+	.string	"\022\244\021F\343\3024\222\262\373\305\200\017d\207y\201\354PW\367\236\236\177\2173\270N(\250\324\350\251-\354\256\023\225\252\270\365\266\021l'\330\277\004\337(\025\303>\266\252\262\235\3264\r5\215ai\325tf\372\026\200\025I\352\247\223]\212\227\312\232\300\222\f\333\"\373\342s\274Cd\017\023V\305\356\272H\307o\331\301\343\321\003\226\3055\365\246\025o\017\361,\273\253\340\203\374\203\360[\207\356By\324\241\037\312\016\257\004\254\017R\276\354\336d\"8\016\b\244i\210\035\267u\037N\027?\035\215'n\270.f\n\274=p\270\b\3326.^\276=\266\252\322\324\200\244%C\3250M\205\372\211\215R\276\002\016"
+	.ascii	"2\241\037(0\366\005d'YN\025\337\232,g,oe\346P\265\342\302\030"
+	.ascii	"\003\263\235\005\313\303\265b\022&\031"
+	.text
+	.section	.gnu.lto_isAmperageConfigured.74.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"M\007"
+	.string	"\202\31635Pm\323\001$\243\264h\212j\225]\267\2600\323`a)&K\206\353F\333\006\261\221\263\2661\303G\235=\210\231)\322\370Z\257 FK\024H~jD\356\224\002\276T\260X]\227e\001\312hIL%!\206\301\322"
+	.string	"/Q\302\n\305\226C\025\341eY\021R\235\366h\225\243:\240\351f_NW\325\t\244\371\330\374p\016\t\260;\201\340o\374\003\341c\\r\004\366>/\371\330t\351J\021\371h/dw\333\323\n\373\321\356\256\225c\373Y\337\363\243\200\213\021\356\263cw\023*\331\020\311\303c;cS68\3108{\327\331\bdt4 \222\335\016\252\305\263\277\314\277\306\025\266\t29\211\277I\302\356\372M\216\342\326\333&\260]`\333\023\b"
+	.ascii	"2\241g\037\230\302\004;T\241\3245z\t\221\303\2353\265\363\t"
+	.text
+	.section	.gnu.lto_getAmperage.75.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\035\007"
+	.string	"\002N24`m\322\001\300\016\340l\310\223\351\002_3\350\342\323=#\227S\206\001M\032\352\275CMv\003]%\364.\241\340$\205e\356U\271V\354\262\326do)S\n\306X4q\262\254K\003\254\"Ue\246\nf\034.\017\020\023+h)0\0051EhQT\204\224m\357V?\326\n\246\036\333\021\377\270\002v7\301\367\370&\341c\374Y\263\311g\177\376F\372K\025\350\300rdo\235\324\013\373n\365c;\235\352D\241\223\210\354V\214Nv\344\205\204lsl\212\257\361\r\216\257\205\tL3\020eP\200\230\354.\254\234@\372s\037\220\376\024\364\353y\371\3478\203'+\311\264\316\023@aw\235\231fq\353m\037\330F\260\r\n\b"
+	.string	"\003\013\275\262\030\005\205"
+	.ascii	"]\303q#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.76.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"5\007"
+	.string	"\022\01635Pm\323\001$\243\252\022\261\270\362\272\031_D\354\005\026\331\206zu\217}\362\332\374\323\247-\271BA\3313\203$\212d\277\275\002\324J\212\013*Xo\"eJ\001\316\\6\261\3020\214\003\274\242ui\252\013j\0360\0200\023/x1\260\025QE\210YV\204T\267\227VCV\213\246\037\333\022'\311\002vW\301\037y7\341s\374y\303\311o\177>g\372K\025\020\321rdw\236\324\f\373\322j\310v:u@d\301\035t\262{1Z\331\224g\"\262\335\261)\377\343 \035g\f\024\032w\320\341QQ\242\262\273\320\362\202\351O:\301\364\247\032\317\236\231\377\2207|@(\033\347y\002,\354\256s\3430n\275m\004\333\t\2667\002\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.77.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"-\007"
+	.string	"\022\31625`m\322\001@\203\300!e\200.\320\3254\372jf\375T\262\327\r\003\2324\324{\207\232\354\006\272J\350]B\301I\n\313\334\253r\255`\267\371\215l\"eJ\001\326`8\221\272\256L\003\264bem(\013n\0342\017P\023-\210)p\005AExUU\204\026n/\255\206\254\227LA\266#>\202\001\354n\202/rN\302\027\375\231\323\311k\177~g\372K\r\030e\331\331\334'5\303\276\264\032\262\235N\025\360\020m\257\350v/\272\224=y&\034\266=\266\305\3778\210\307\330\302D\266\031t\214(HPv\027^N0\375I\037\230\376T\343\330\023\363\037r\006\220E\211\266}\236\025\205\335uj\033\306\255\267}`\033\301\366F\b"
+	.string	"\004\013\315\262\030\005\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.131.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\362\002%\026"
+	.string	"6\351\215J\300\020)\035\342\250\302%\223X\323)\\\343\306\202\231\265i6s\264P(\227\316\246\331\325\250]\257\023M\343\215\272\376\272\221\235x\207\335\332\355\234\234:DQ\024mAhn\332G\243\330\261\037\331G\315u\006#\204l\"wJ\001u"
+	.string	"z"
+	.string	"w"
+	.string	"\017\362X\336<\242++\017\017\347\227\036O\375\021F\022[x\004vM;N\265\326\325\251\025\210\247\"n<\333~\210\373\340l\244\257\324\341yS\007\230\241^\255\225<\035\371"
+	.ascii	"\360\364;\bx\272\034\216\373\267\223\342\374\260\365\201\210"
+	.ascii	"\232\212\241i\371\027\266\210>ch0|?ht\337H\255\365A\23724\271"
+	.ascii	"9\005\234\206\255Z\253\305\f7x\333%\266g\366\"\b\323\036\341"
+	.ascii	"tG8"
+	.string	"-\202\323a8\r\206\323T\234\376\302\351\005\247'\235\376G\001\326\206Z-LI\325\033\232\302\303\201>yUW\256\214j\321\3138SW\266mc\316\321\316\251wj\342\346\225V\256\302\313w\024U\344\323\253\272rE\342%X\274b\240\324\271\020J\325\320x\352\325Z\222\247.\305\203\330_\rI=\177\350D\366h\333\205| \206\315,\027\362\bCi\\\037\350\346\225\304g\361\026\016\036\230\230\200\247\341>\207\214\037\272\273\340~\367!7\247\374-\335\357\234\276\337\206$\301\344\230\273\373\341\3309\331\020\256\344\022k\325\221\370*\236\364\362yN\r;9\001O\347\006X\241\004\3653k\255-\2739v\n\370U\365\b\315\320\315(\373'\216\"\305\347\261\204\330|\314\251\037\003O\277\013n$A\325\270\314\251\2719^\372\325\305\261U\341\364\030\006Fa\321Pj\256\030\251\"\213\305d\257\020\243\314`\023\\\257\022"
+	.ascii	"~\261l3X\255\346\212@\322f2\232\n\214F\252\244\270b\344kF#Y\""
+	.ascii	"\226Q\200\315\310\232L6#G\333\363_]\034\317\0357V\243g\236\351"
+	.ascii	"\252\225\261\255\332\007\37536.^\270l\316\373\357\363\330qA\033"
+	.ascii	"9\244\357\3300\335TO]\255.\t:\326c=wO\342\202\333\261k\264[\n"
+	.ascii	"W\\\021#\006_j \326\032= `\002!ve\033Ac<`E\034\022Ve\354A\273"
+	.ascii	"\372-\234\001\263@\360L\20704v5n]\241-@j\370h gw4v\306\237\361"
+	.ascii	"$\354h\236\302\323\333\364-\221\307#\034\207\355e\304\205X \345"
+	.ascii	"\230\232x\025\304\202\266\326\216\376\2628\022\262\261\266\270"
+	.ascii	"\211\374\266@\306\323\347\222\230k\351\314\276\245\356\362]\r"
+	.ascii	"\210l\003\302\027\006\343\004\202Y\222\201j\317\235\352\375\035"
+	.ascii	"\215!]X\277\240\n\372\274\361h\353\tj\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`\275\005E\025"
+	.string	"\346 }I\240\230Q:\300\017\253\374\310\373\3228\205\227]Pl\236\226\206\370<@\r\333\376\344\251y\222\202\016P\253w\035\\\250\224&\032\323T\327H\3475\322\365\370\021\355\177\373g?\021\034}~\213\303\225~\t\332K\377O\210\3342\005e"
+	.string	"k"
+	.string	"h"
+	.ascii	"eP\007\001\365\317O\373P\237\016\322`\003\201\257R\376p|\275"
+	.ascii	"\243\275O\341\235\212\016+\221]\343\350\231t5Z\035\016\317\236"
+	.ascii	"^\031\224k\216\001\037\217G2\270\316Q\036\004;\267*\317\244c"
+	.ascii	"+\271\016X\320\240y4'A\311\365vS\376\337\223\t\347V\326\341\260"
+	.ascii	">\375\375K\331X\262\326Zo\272G\377\273\236\002$\372\306\255\265"
+	.ascii	"\3766#\372VVDN\371\307HZRz\201\024B\247\374\213\226\212\214\226"
+	.ascii	"\216\224\216\222\210\220`\354|\317\031 x\312\017\375(\036\372"
+	.ascii	"P:\364\237p\350;\331\320o\242"
+	.string	"\241\317$C\177\t\206\276\222\013\375$\026\372\305\n}$\224B\377\350\204\366I\350\037\211\320\217\202p\255r\350X\307\007}(Z@\201\203\026\022\002\n2^\343R\2521Z<t2^\342N\366\203FS\026O\306[\334s\327\251\312\311*7\303\006\214\004\316}\225V\21708\222\003\020\367\326\204u\003Gr\354E\334C\325Zq$\273\350k9\352o1\352si\321\317\022\366\267\212\372]X\364\257\210\372WV\364\261\250\350gI\321\257B\321\227:\321\227b\242?U\242O%\027\356\372(#fj\306\306\302\327x\210Vc\333\222d\215w\313\206\306\302\255\261\003\\c\\\316\001$*\253\307\344\232\023h2\215\217\3114\304\037\263v\025\004\007\220\311\257b\220\311\257S\310d\227q\357\245\206\230!\2072\331h\007\320\344\230o\306\261\337\214a'p\366e\312\210\216\340\214]D\335\214\005\024\027\006\246\210\220\036"
+	.string	"\206\025\003^\250A\bE\322\251I\f\n\nY\016\360\002\031\243M\007\021\320\230e\204\020!\"\241\004\264\202\036\240)\"<\342d\013E'\2377\353\207J\236E\270d\370\237\327\005\330\375<\226\007\001\265\"\005eS\236\214_\336\333\033K\n\017T\315\366G\265 \225 J%\005A\023\277\032hr!\214\262@\354\354MH\177\233_\262\013\312\246%\214\274\bv3\233\252\036\241:\320zO\366\b\365A\t\230`W\020\327\3221\005\300\261\\u]\007^6\t\276\036\f\023\330ba1\300\031\336\21413L\332\212\346R"
+	.ascii	"u\013;4\267\211A\354\234\231 \275\333S\005"
+	.text
+	.section	.gnu.lto_.refs.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`t\001\365\013"
+	.string	"&\037N1P\211\223\306\310\202z\033\311033333\203\210\231\231\231\301\204\370A<\360\n\274\016\374\267!\233\356X[[C\352n\335O,\331\264\333\226)\005;"
+	.string	"?"
+	.string	"A"
+	.string	"\233\361(\206R\213\265\024\267\023\216J\334B\254\233\245\232\265=\232QzY[\271\235\254l\351\263:\216:\224~:,b\322^\322\262\244P\322G\332'\355J\253\222\246\323WHOA\030i/\236\255X)\234\235X#\230:0\350\206mf\305\260\265\254\225h)\267\021\245kUO\036\234(\225H\026\242\224I\026R\372Dt\251S\251\203<|\224\246u\346Br\310\307n\254\325\270\355\224D\013\255\017u\316\263\016g\323\355\261\035\032"
+	.string	"\304\313\2109\217\274l\271\262\247\243\254\025(LP\252\004\311\032\201\251\020\"\352\203gu\340\254\r\330\312 Z\027\334&X\021\254\033J5\224f\244\rZ\034\306}\027\251\202bo\036\330\023S\342\"\f\024\330\225\020\004~\330\005\255\212\324q:$!\321\262h\025\333,\333\032)u\332"
+	.string	"\307\267a\033\232j\332\331\332yaP\212"
+	.string	"e\355\226f\035\032M\355\002,8\t\032"
+	.string	" D\352P\330\352\261\263x\342\305\200\bp&\245\261\247\253\315\361TnI\030\032Fd\241"
+	.ascii	"k\353\021\356y\222\265Aa\266\002n\t\370V\214\232\210\244\217"
+	.ascii	"\20651e\206\370\250`4\261\"\232K`\320"
+	.text
+	.section	.gnu.lto_.decls.fa435e80068b919a,"e",@progbits
+	.string	"(\265/\375`Z<\215\364"
+	.string	"\332i9PU \fQ9\351,9\277\263\270\007G\244\340\030\223]P\345UU\025E\027\376h\255\240\020_\035_C\334\273\373\2435\254\347\206\357\315 \265\002\231\006:Nl\213]\344,\277\211Y~V\002\351\267\224\205\032\002\246\201\211\330l\270\376\017^\232C\354G\332\354&r\247+\004\363\004<\005KJD\251\022 \314\306\255\324K\f%\211\030]\343\034+\367H\r1\347'\023h\016`\036`\216\224[\005J\\\221{\344\352q=\240\214\013\340\032\033\214+g\341\036\037\225+g\241\331\331M.\342S\202\276\r\311*\037\322\225S\254]\\.\315\274Y\372\350v\271\204\327\360ni\243{\330/:7\322-\354\244\253\345J{y\257\374\016^,\307\321\234\215r\3169\177W\355\3529M"
+	.string	"\361\003\354\345ur\243\324\030E\363S;\305\016\311U\253Qs\2662\204\266\271]\265\227\254\244+g\241\336\n\001(\274r\212)\271\273x\033d\341@p\t\021\270\253V\263\214f'\020\016\367\376\234\367\362\006\336#5\314hn\232\300\273r\n\3717\350\240\2277\311U\353P\224\263\025\215"
+	.string	"\byb\025X\230sT\003\034\rV\276\246\260\037\007\300\375\274\032\212\005P\331\326\253?\326\253X\353U\245\365\035\270\276\371\246\\*4zRP\334\340\246\220](\227\351\212\r\260\306\357\033\353}r\373\256\364\372\375\267\311\335;N{\346i\316Q\032\225\231\002\2238\020E\233\013\242\370\206Zq\027\255\030\f\256$\360\3722\271y\277xw\311\214\321\305\30393\357\315\240\346\336\f\210u;\230\322\"\376\375[\177\225\254\037\334 \353\257\327z6\272k\344J?\334\272_\271;w\"3\232\243\335\305\245M\332\370\327\306\372\373\241\250\036\036\336\017\305\337\247\365\346j(\266\034\n\326\353\005\255\367\323Y\017x5\024\237b\275)\274\032\2127z\321\256\324\303\235~\203\016\256.\323rY\316Q\033\232.c]\f\033\377\001+"
+	.string	"\366r\007\277`\375\365P\274\207\327C\361\275b\020\344\277d\267\314\203\212\264\364\314l9G-\330DS`\322j\374\350\325P\\/\206b\226\256\3617\225\r\335\326\177S\314e\305]\335!Sn3\277\032\305\366\264\3064MJ+\376\252\213{\266\376\352\nrY\013\tth\260\003\340W\203\376\353\342\277NG4\023\200@\223\211\t0\375m\302\322\tJ\026\350\013\274\203_\005\301\337\033\034J\203"
+	.string	"#\204\f*8\211_\335\352$\016(\360_\256\277\221\376~\361\267\321\337E\177\347\277W\3607\n\376F\341o\231_U\201\005\201\347\t\253\343_\r\241\333\377\304_]\300Ev\3626\277J\004\365\243K\320A\254\004\031\016?t^\206\241\026\372\320\310\013\340\357?\r\030\372\270\366O\217\360I\352\036Vyy\376^q\016~\225"
+	.string	"\177\343\220\240c\376k\365\230_\275\177{\030\301\1771p\312\340S\300\277\013 \202\277\021\320!`\361\201\343\374?\300\377\016\377\360\253\370\377\226\377\336\377\205\377%\376\347\362\037\313\177-\377\r\377\253\376\357\362\337\342\377\303\377\276\374'\374\357\372?\313\177\371\376K\371\337w\013~\265\355\357\227\277e\376\216\371{\375\033\377]\374\033\346o\032\017\3747\360o\365\357\356\016\374\277\371\261\207\2779\360\267\212\2771\3607\005\376&\341o\007\374\035\302\337\r\370\273\304\337\033\374M\342\357\004\374\255\301\337\006\370;"
+	.ascii	"\177s\370[\303\3377\177\327\374\267\311\177\351\376;\367\337"
+	.ascii	"\270\377\016\371\257\333\177\331\376\273\366\337\351\177\323"
+	.ascii	"\376{\366\337\262\377\002\371\257\330\177\301\376{\364\337\036"
+	.ascii	"\377\375\372\357\216\377v\375\027\307\177m\374\027\353\277\317"
+	.ascii	"\377Z\375\227\352\277Q\377\205\372\357\323\177\235\376\313\364"
+	.ascii	"_\245\377&\375\367\305\177\231\377\315\377U\301\177S\360\337"
+	.ascii	"\026\3775\301\177\333\377*\377[\202\377\n\375W\204\377r\340\277"
+	.ascii	"\307\377\376\374\327\347\277!\376\233\200\377\366\374\257\373"
+	.ascii	"\257\006\3763\371/\373\337\235\377\032\377\253\363_\021\374\027"
+	.ascii	"\004\377\355\300\1777\360_\f\374\327\002\377\265\371/\005\376"
+	.ascii	"\253\370o\b\377K\370/\b\377e\300\177K\374W\001\3775\300\177\013"
+	.ascii	"\360_\002\374\227\303\177q\376\273\341\2773\377\225\371/\314"
+	.ascii	"\377\262\377>\377\357\376cpxxx\370\307\310\370c\376\376\017B"
+	.ascii	"\0024T\253\013\371\2313\364\305M\t\006 \214\217i \235U7\261\241"
+	.ascii	"3d\"\023\245J\251R*\225\240\002\256\344\252@\340%4V\030\243R"
+	.ascii	"gp\020\203\222\325\031\352\224\fT\022\2203'Q\033!z\2043\032;"
+	.ascii	"\033j&\320\356\352E\343\313,\243\242\222\226a1l\260\200\321\350"
+	.ascii	"\252"
+	.string	"\203\202z\306L\237\236\2320\217\306\n\317h\312\313Iu\352\035'\032e-1h\316\316\0204_@\324\212\270\230\230\256\332M\313N1/\236x\224\025\346\214$\004\346\362\367\004G\343\307\030\255JJ\375\267f\234\263\350\314\332\322\353\312\337\225\252IW\r'/\003\013\360\225\007\340#\006\023\317H}a\244\036\035 \347\033}:5]\270P\217R,s\3660\330t\202P\257\304\270\004i\254\036\305\3018\273\232\215\017\203\266\036\206\006Sef\230\246\232\325l\027]\t\273ty\276\270 b\370\245gX\330[\272\017g\266\314\214Q\3020\272\016Y\277\202e\271\322\316r\217\200\310\314%\210/$!\210][`)<\261`i\302\022\206\315\017\276\t\211{>\274\326\243\365J\233\252\237\024\2330M|J\200o\301+m\301n\222\"3c\230\350\321\214\206\370K\226\300_i\007\366\336}\312\2319U\",\352\f\241"
+	.string	",O\266&\353[JOyS\2216\225\376\273\316\274\f\354 \352\351l\202\370\273\312\373\357Ufr\207\232\262:\300,\215?\330\315\3770:u9\n\351\326\376\213\231\331\3149\307 Fs\263h\346\227x/\210\237\346\252w"
+	.string	"Y-!\347\345\026\256+k\2178&U\343\374\353\345l\204\265|"
+	.ascii	"\326\223\021\226\024\322\024+/\215\274\226\026\232\031k\2114"
+	.ascii	"\315\331B62Z\216\360\314\026\220\246\371)\273\330{\2729\212\265"
+	.ascii	"\314F\317l!\033e&\006HFXOHS\346\223\005\244)\326S\236b\345\233"
+	.ascii	"l\304l&\031\345\246\205<\305\n\314\323\347\323\r\322\364\371"
+	.ascii	"\2044\305\262\272Q\220\f\261<\021reQ\271+ \031\345&\246*f\363"
+	.ascii	"F\017)\372\314~9_\266\243\334\034@\316U\317\246\037S\352\312"
+	.ascii	"\025\3515\025\ra>o4\347\314\201\251(\353\231\215\364\220|<s\366"
+	.ascii	"Q\364\223\231J,\243z\031\307\325[jU\345\245\243\234/`\312yy\263"
+	.ascii	"^\316y\231s~iVEs\236q\203\004eb\312\331\211\303\224\253\226s"
+	.ascii	"G97[\024\271'\244i\3263gnm\n\315/\242\313\013\315~X\315u\272"
+	.ascii	"D\313K\202+\364\t\312J\343hM\021L\307\213\271\306k\330\327\226"
+	.ascii	"a\343\250\333\214%[\215\363`\236\b\322`s\202\023\363\225\003"
+	.ascii	"kJ\245\324|2wE|\0346\376\313\322\332+`-SRk[\362\242\031\234a"
+	.ascii	"M\202L~\245\315\244\221\340\334\344\234\305\004->Y\225\364\335"
+	.ascii	"\037\021#`tJ\222 \211y\263\213\2625\266[\2413\234WS\272_i\323"
+	.ascii	"u\035\210\234c\230\370\322\023\254*\314\315f\b#8\352\021\214"
+	.ascii	", \215_\224Z_\204\261\312\365\\M^Sn\342\262\3125\\K)\361\210"
+	.ascii	"\001"
+	.ascii	"\270\022\031\302\006\023\325k:5>\007jpeg-\255\201\311\031\013"
+	.ascii	"\t\224\255\247-}\301\001X\305Ha\316\331\255\333\372\355J\233"
+	.ascii	"\255\327\336B.\021l\005\250B\322\212g\210\322\365D \353\211]"
+	.ascii	"kG\033\355J_\327i8\354\2268\262V\024^^W<q\206Y\220\342\213\253"
+	.ascii	"i^\220.{\\?s\036\262&\rr\321\322\370\346\253\201\314\017\310"
+	.ascii	"X\032tOG\343\367\330\337a-\326>f\2369\033\021\257$1\0256n\020"
+	.ascii	"\027C\3616\311y\203a-,N<~\370\270~P\032K|\364\260!\223qCG\264"
+	.ascii	"\ff\316\360GT\343\206\366\327\233G\253\220\233G\211g\316\314"
+	.ascii	"\346a\263%g\246\315\275\031\334\233\001\006\222\245\202[\021"
+	.ascii	"\237\030\345\265\203\205\323i\326\370\275\243u\334g\336P\003"
+	.ascii	"\245&6\243q\343\350\034W\312\241\273\256\025\256\242\247\306"
+	.ascii	"'2\255*\310\371r(\336\303\303\313\241\330[9o.\f\305\2463jc\242"
+	.ascii	"K\013Hc\365b\270\301!l\356\352\206\215;E+\253\206\206Z\024\264"
+	.ascii	"gcu\215+\355\254\266z_]\275\367\\\225\022hV\323xyk\366\231e5"
+	.ascii	"\325\305+vA\373\314T)!u\320\025\027\261\336zl\267\036\017Y\217"
+	.ascii	"\311f|X\215\350\336\312\246\016\202&\313\223\"\261v\266\324L"
+	.ascii	"\220\2550\255\356\024ZFG]iK5T\226\352\246n\252h\315U\210\224"
+	.ascii	"\212\203\030\027O"
+	.string	"\215B_\326\262\246r\244\372i\006\216\006\032hP\314\241\246e\270\342c\256\365\370\271\036G\201h\247\303\030E\363t\206\231\002\334\n\215\217\227\326c\346z\361^\310\216d\261\005<\334\212\340a\0333}Y\264\2401\251[S\352z\366\222\034QC\250\266\360\035a\333\024W\226\222\336#\323\222\343(\211\332\304F\306` [\343\272:l\247\005\252\366 \214;r\344\330\356\272e\247\216\fI\350N\207\311n\032\264\212\221B\233<'\030N5\"D\360\034\316si\005D\222\025\236X\301\034\301[\3021\207\345\250\240C\310\032\343\270\231\303>\2763\037\030.C\025\033\033~\313\360\205u\326\245p\346L\313^\020\267\343\267\2137\250\246g\206\333\360\234\266h\251\202\206\206\327\364\252\030i%LPP\324\216\327\232\2228\311\215\361\264\245k\221(a^\215\261\024\177-\371\253\322\030\247]\274u\n\265cJwv\206\311"
+	.string	"\253\030\021\243\271A\244\317\216,H\020\0064\373\314\304V\300\334w\265\005\006\206\311\376\204\034.S"
+	.string	"rL\326N\364\234\f\342\261\254h\221\036\036\303b*\364\355\221\331\301\034\016\202\325\205\365Z\222 W{Q>|4a\026(\037\227\031R\343cX\362\340\321\204\016\220\253bDl\312\362l\r\212\227\027\206v\260\007VD\255aW\005C\205c(\221\254HT\352\252ea\231\022\327C\207\216&t+\232m\001B\253\266\276\205s\334\233h\021\337\033\364\307\024\223\0278\216s\2549\370\366l4\306\\\275\344\"9\343\032r\001\351\371\3046\026"
+	.string	"\330g&\323\245T\244\245ul\203\306\215\n\330 \316:\214\2579\255,,7\253'>#\031\3730\2025\004\327h\253b\233\240!\033\026**l\205\363T\241\354y\001\212\251\202ME\366h\034[\235\320\310\325ac\\\325E>"
+	.string	"#\213\234\264\b\305G\215\027mRRx\ng\214\331U\244g\b\342\345h\347\361TL\227\243\300\267\216#\021\245\313+\307\372\0308\006\216*\2661s\230\025\346\354\004\201\267\264\004\211\202\243\260\214,SO.\030\212\307\206\020#\215o\341h\375\315\341\372\343&n\366^\n)r\271\351\fA#\247\344\311h\312\223\253\177OpSNQf\216\221\b\213\322\024J\371\001\330\0303\2750\373\236$\311[\177\313"
+	.string	"U+S\004\245\020\252Y\256\036\327\003\300\362"
+	.string	"s\256\250\201eQ"
+	.string	"\217TC\\t\365\2347\331\b\256\020p\016\037\251X\220\360\022V\302I\330\005~\201a\\)>R\265\034g\017\037\251\203P"
+	.ascii	"q4\260\271B&D\352\006\003\236J\207\"\244\024fU\230\330\350Jq"
+	.ascii	"\321q\2429E\352\026\274\274z\316h\216!C\304\312\r0\016\032\320"
+	.ascii	"Xi\342GU\304?^\342<$\272%\330X=|qJ\335\2718\343r\245j\227uPl"
+	.ascii	"\316\3602v9\262\312\326\337\200\255\277\301\261\252\205\253\023"
+	.string	"@\032xY\353o\256\326\3378\327\337@\255\277QZ\177sdE\r\234*\271\202\027x\325\232\217\311\322\rsU\247\250Ul\200\310\335x\243b\201\034yo\215\261\224\276S\001\312\024\245\306\317\253\r\255\361U(\304\267\303+S\215U\277\365\310\346\312\207\030\032pWT\215\257\372\375\352\221\373v\202C.\204\215[H\316\325>\031\274#\200gL\352\256\362\251uj\223\024\316\034\303DX\f\023\027\331\216\306Q\230\271\263:\261\306j\236\272\202\272\367\303\300\320-\361U\325\255W\365b\270\366v\374h\334*\223\253x?\314KY\323\250Mn\275z\247.\371aT.K\350\222\224\254@J\215\261\306j\222\365\310f\354\003L\2244*j\222_Er\333\232\007\tz\211\312\371\327\270\346b(\252Gr\256\332\265\nlww\215il\250\350\350\314\222\246\320\3318\315\315\251qcP\032\034F\334\252p\201\203S\343v"
+	.string	"\022\243awB\342ZZta\3065\0268d\210z6X\214\312\202U\205caPEK\334\334\3244\277/*\030+=\b\317\316\330\330T\260|\224Qh\362\325\004\270\036\221rB\326\265\266\246\246\301\230\370J\3621\003\211U\343\327@M\247j\332\337\026'N\374\364\f\321\320\324\264\0139\257\305\375\001\206\020\023\254K;\022\323\205vT\003\312jf\246\236\245\310\032\270<\373\306\221\247\024\316.\336W\217\254%\270\265\254\254\t\r\237\202Ub1c5dh\001\002\004H\377\265QQQv\310\327\37047\304\304:\230\322\243A\372\361C\005\2031"
+	.string	"\341S\260\252\020F\007UX\006\273j2P\236\304\2024\351\321\243\203\244x2\277> {zbU\370\"\310\f\234\t\262^\365\272*T\365R\277\272o]6\327\267\035o\2003:\326\317L\255\277\335W\334\261\243\377\256\035T\260Jl\220\351)\356\260\253\253\tCx\023\263Y\0361\345\004\327\337\261\253n]\251\272\245\342\270\320\244\200\022\016\300\334\254\n\321\207MwP\225k\346\317K//\352D\"b\226\247\245\245\332\270\220\263\220\267\256\031\255%\272\245\r\037j\335\022\\a\033\026VU\021\fK\235\330\217\347S\265J\221s\226\342\004MK2\325e\203F=14?\2551\by4&[\230cK4\002)\024\024$\264s\301\006\034\f\005\355\020[\243\b7,\320\n\345\321\306\002V\247\275Q\022\001\265\255P\362G\003\033\376#b\004\004\224\022`\223D\255\221\355\271\271`\203\005\024#\234\300"
+	.ascii	"d$j\223\307\0236\214\330\351\t\022J\222\300\002\035{\204\222"
+	.ascii	"&\360\034M\330\361\360\243d\223=\026\360\030\331\f\240\030\341"
+	.ascii	"\004\006\013\255\261U\352\214\330\351\341\3419\241\254\371\217"
+	.ascii	"\210\021B\307\r\305\377\210\030\241L\262,\216I\236\013Z\035e"
+	.ascii	"\t\312#\020\3201\250\330bH\b\305\205vh\204\317\020\206\035$\021"
+	.ascii	"\t-\253\224A\3664Q\2513\323\352 }\206\210H\237!\365\247\365A"
+	.ascii	"\262@E\366\004G%V*\331$\017\217\361\245\305\220\320\016N\266"
+	.ascii	"C\352"
+	.string	"iZ$[\345\321\207\315\200\016\017\213\3649\002\031_xX%\021\336a\225/7\266F\236V\307gHD\215\316P\020\253\201\226U\262\031\360\031\362P\202\205\226\365\2219\241<f`q\242\003\206\r-v\214>\354\006\013<l\222Hy\274@\031\2244\002\235Pz8\032\203\330\f\374G\204\022H(\331\356\360 \215AAB(v\22207$D\360\260;G\026IVE\2534^@\321\036\221\022\220Qb\360A\036\223\255\n\r\"\264\254\217M\005Z\326\007\303\177D\354\350 \211\222#vz\004\240\3641\002\221\340\203<\006%\21527\354\216\t\304\377\210\030\301\003t$Z\301\301\207h\005\313\003sB\007\022\"\332\244qH\204\022\311\016\005\t\241\3409\232\320\032W\234\300\266F \242\035 \343\016\001fD \302\261"
+	.string	"C\216\be\t\254\017\322\370\323*\215@\0324\234\300!HE\006\024'T\200m\215<C\033\270\371\3161\311\"Y\237\365%<P\200\007\037\240\360\362\017@ \001\002\211\342?"
+	.ascii	"!'\007\004\017r\326{\220\243\266:5\355\f\253\203b\204\023*\332"
+	.ascii	"\2673\254Nk"
+	.string	"lU\264?>G\240\236\031V\207\345\021*!\311\016\261\354\212\231\377\210\250Y[%\333\032+\300\372\030\223\354P\220\261\246\325\331\200\003\244\t\214\311\021~N\004\255I\343\317\016~\371\217\b\245N\315\312\003t\354A\022\305\334(uzz\204Z\"\024'\230@\b\350\002\017\013\264\302\210d_\206bZ\035\345\006\330\240c\273\262AG\r\264Ic\253\204\371\217\207\013\r\261\311\021\255\220Pr\204\214R\307\347\330\203\024B\301\210<\006]0A\213d\225lr\250\025Br\330a\001D\303\352\\`u2\260;I\"!\025I\266eKh\221l2I\264s\241E{\3341\016\031Q\330\264F\021N`\225D4@BB\"\350\020\225m\222\005:\201\202U\022e@\262;I\326\204\241 \"%Rh\247\203\362\250d\223l\253l\361S\323\352x\220\263\262>\306\026H\210\005\020\020\273\003\004D\324\203\241E\022\t\241"
+	.ascii	"\002bQ\210\300\356$\205z4\260\240\341\021:&Y\023z\206*\320\032"
+	.ascii	"W\034i|\220Gd\322\310\001\013Z\235\017Z\344\221\350\34599(0\330"
+	.ascii	"\200\005\"\260\356\210h\221d\333\326\270b\2042)\244D\262\312"
+	.ascii	"\021\310\2431h\304NR9BD\007 "
+	.string	"\343\316\261=&Q$\205H@\n\035[c\222h\204\326\270\202\305\206\323\240A\254Q\"\311\336\363\304\032q+\230\224\312\\c\342\325\343\320l\314Y=\316\006\016\315\257+\356\007\334\230\233\223\225(E\224\"R\005:@\332t\345$R\021g\340 K\351r\006q\nKpJJ\257\020\265\331\2226uBt\336+7\t\234\234\232\335J|\">\021\243\022`\227&\245\220(\343\304\250:\342\321\224+{\215\211P\2573l;k\322\230\030\343u/wxYW\257\303QsdLx\254?\261\251\036\321\230\2619\2278\255\311\314\230#lkz\263\361{\332Xb\232\233\311\177f1\226\354\b\355\212\034)a2u9\304\351\016\006\016\231%\261%z\304$\"R\030\232\326Q\343\023\267\210/\260\r\253(W\215q\344rN<R\345\216\034mqa\244\363\364\345\244\361\211F<H\300e\207R^c\"3\347\304\242"
+	.string	"\020\251\233k\374B\\\0223\032\022\026b\376\361\341\265\313\021\005\225\327\030\206,\347\270\213\r_\334\240\027\027\274%\005\027hS\215\217\267\320T\361\320\322\222slH\234\272\253\321\325X&\013.\224\351[[\322\206\013\177\214\005\0236\017\022\3001Q\273\321\030\304\325P$\342A|%\206\n\255\213\236\223(\033\r\\\02347\301\277b\027+jsVT0\031\257h\021\027\201Q\352]\334\2170\300\276\266*zJ\215\245H\301Un\323\212\211\261\"Q\360\n\263S\006\210\037S9\256b\324\346lk\214\247t\337\371fD\351\353\276kx\212\322Ol\232\264\224\272\240\334#E)\027\206o~\320B%N\222\032;9E\2432rVm2\032\343&\270\211z&\002\r\031\357\341=\365\f&7I\334e"
+	.string	"\\\001O\255\205Ia\323\353&+\221)\024\030y\330\n\005\001\205c\250S\203\304y\242\355\234BN\031\032\031M\222\2441\023\025@ PL&\033\017\250\251\017\023\300Q\250S\272\226e)Q\316\214\210HR\220TJ\323\0016)\335\354\022,\220;\256s\217\342.\261\223\f\355\200B3C\005<\252\232\030\211\336\344HZV\020\337w\375w#6\341.\301\357\366"
+	.ascii	"\355\313\371\312n\001\254xt\364+V\311dRD\375\257z\226\270\340"
+	.ascii	"\024\336\305\300\350Y\357\344\310\304\256\240\204\352!B\341\036"
+	.ascii	"Vy\210\\\213\007X\311_\240\355\022<\220\317\rd|\255\210\2567"
+	.ascii	"\372\314D\306#\303\372\204d\022Vyq8\225\370\201\3003\243\370"
+	.ascii	"\253\266\037%\322\t\360}\377\246F\325\200\365\251p\030!\227\253"
+	.ascii	"9h\341w\020n\237\324`\320\251s~N\3223\213D\330\302\271\005\315"
+	.ascii	"1\001e\353\357\307)\351\276\220tl\316v\363/\260\357\367#y\344"
+	.ascii	"\247\332\371)K13\330\341\233K\330\253V^!x\204\f!z\252\024\321"
+	.ascii	"\032\026\302V\316\"o\322\202\007\306bf\331\352\336\332I\2055"
+	.ascii	"\370i\277\257-\005$e\372\335p\037\325\033\332\215\r&\364\244"
+	.ascii	"\354\202!\303~\373j\325\322\202\317,\345R\177\253\b\226qK\302"
+	.ascii	"a\004\347\212S\262;\\'\257\205F\203\234\217\\xa\234\306\341n"
+	.ascii	"\357\331P\340\212\306\007\373\221;/C\003\260\b\b8\366\316\342"
+	.ascii	"\335oew:MB\376\376\023\373\322Gs\026\3663\254^\256\f-\026\257"
+	.ascii	"\361D(\3110f=\306<9\312\262\363v\032\265?\332\214,!p\346l"
+	.string	"\200\030\001\317\207\031~N\035\230\221-\303B\365\231\026\202N\220\220\242(-\250\227Sn<G\270\025\261\023\327\374\234)\233UZ$\313y\231\033\2425\333\205t\200\020k2(\251\303N\253Q\345\223>1n\223F5gf\\(\204\324\261\tf\315\206J8\227\216\200\303\3314\217\244G>\310@(\343\207\355\261\320\n\r3\321\221\344l\321'Q\217\200\237#\362=b%\360\004\214\250CKu~\0308\343O\327M\236X-t\304\270\037S\301\376,\321P@\230\353\351\367\027\307\367Z\300f\373\361WC3:\355\264\355\215\t^8W\321\274I\214{\270\363*\261\317?}\036S\032\212&\0200\341{\363:d\252~\314\306\353T\320v\260\035\f\351\206\266\f\336\"\274<\f\003{\225k\243\365.7\031\265\002h>;]\314\316c:u\bN\257.SF;\271\366\026\331\306cb\244\331,\257\n\316\320\232"
+	.ascii	"1>6d\030\303\247\351\346[\316g\211\242z\351\310\372\261j\324"
+	.ascii	"\004\362n{\027\220BKn\217$a\fr\350\316\206;HL\216\235@8\216\317"
+	.ascii	"\241\370\021C\271\256a\b\240\177\363F\r0\227\177\353\001x\361"
+	.ascii	"\260\375\340C\277\204\326\022\334uY`M\210\013\235\n\320\366\201"
+	.ascii	"r8'\341q\311\251n\277\310p\035@\3430\354U|+\375\346\230\356*"
+	.ascii	"\333\276\315\360\2229\366\352\226\027\371\031\355\2577\236\t"
+	.ascii	"\314\b\341\300\313\357\243\267\202\"\330\203\275d\315\034k#\321"
+	.ascii	"\336q\326\263\030\240\302\237\3260\333\264\226N&\301\276\263"
+	.ascii	"0z>\320d\201>\206|\370\224"
+	.string	"\313\316s"
+	.ascii	"\r\300\356!\314@f\233\363`&\315X3\305\234\343\345\304\303\337"
+	.ascii	"\201\224\036?\032\364\354\244X\232\037\001\220\304\230&v\"\222"
+	.ascii	"\311\222x\227\220\f\001\r\335\351\326<\211\234\320\271E\025\267"
+	.ascii	"*\274k\237\217q\261]\247\321\265\231\016\005\251\224\364\235"
+	.ascii	"J]O\375\203\342\224\005\354\206P\324"
+	.string	"\216\240[1\352W\355\265\366\226=\005\270l\210E0}yB\022\360\250\013\370\375\"\035\303\205\234_\207q\207\225\223S\005{C;,Y\034tB\024k\020\330\334\267\363\200\255F\260\221\262@\265F\354\034\314\271-\013G\271\023\336J\310\027\225\200\266]\321\2023G_\254\255ob\357%\274\312\306\314G:Q\016V\231K\316H*\302:\033\030\364\276\016\371\305\024\001\016\240\335=\265\363\366\307\357T\235\251\2007\227'\250\313\231\275=\f-fy\262r:\330\213\232u\203Rl0\215\027\340m\373<\231H\330f\326Q\301\027\306\330\260\005F\273\267\227\226.\327\346\343\r\344\225\246\b\362t\354c\272,\264 \2677q\365C\r\220P\3671\362\007{\343X.^p\344T\036\224\030{,\301\202m\263\260|\347|\277\336%Zm\016\b\336`_\260\\\035^#Rs\314c5\373}}U\210\350U\202a\240\371"
+	.ascii	"\343\200A\006$\001\311\351\026\250\b8+^\013\215\023\245:+\275"
+	.ascii	"q\262\344WU1\247x\336\377`\345w\233\316\325\3408s\203\263\272"
+	.ascii	"\305\234\221L\n\265\006\335\310\002\033[\236\r\267\277\320\344"
+	.ascii	"\275\316\234l-|\276ne,|0\006\316o\337\001\342\377\244\373\274"
+	.ascii	"\324\300\211\227\321\316\016\342+\244\024\237U\t\034\263\351"
+	.ascii	"\032\031&\320\262\025\230\022\rz\270l\255\362\033\314|i\305A"
+	.ascii	"1\305\270\302\351+\016E\f\030\230\227\237\225\363J\335\017\332"
+	.ascii	"]"
+	.string	">\032\036\3772\260\255\334\222s\267\335\b\246!\002\246\344\005\373=^\274@n%\362$\277F\232\213k\232\221,RH3y\262h{bqR8\200>\212\240\234t\253\371x\222<.q\357S7\357\254\314{\235>\342\305e\353\336\361\225J'\260\247\317\224Z\316\tsz/G>\222\306\264<\251\023\224\331{\213\236{\251\302\200\300\333\362\227\303\2311\377\331(\265\221,\336\2627\254e\335\223Zi\270V<\031t\340\344H\234\331\nuL\263\261\006\266\224#\324O\275\263\266\2361\304\037> \376\357\022$adqpT\226\347D\226\376\370\205v\237'\034\032\206\033\330\222\322\034\260\222H\204Z88\017\233b.\210\251\024\301\260\225\r=!\274o\201\351Y\024o\344\264\233!|m\332&=\320 u\271\220\237t0HFtI@\370\242\"\f \244\204\355\n\3404\205WY\3234\317\365\227\272>\354\304"
+	.string	"\252\247\324\035\177\246\b\340B\337\312\357\331:?\217VH\361\rO<\357\352L\022bQ\265*a\323\305\311\265\371M\374LB\001\231\032\bW\235^4\177w\017&\027\003r6\221\034YNK\270\370\034Dwi\273\266\022\327\353\334,\214|i\260U\213\301@xaP\272Pr\340\341\t\036B<\247\027t\212\277V\342h;\214\272\323k\333\372\352?D\321\257a\212}\324\024\275\037\211W\344\252i\327\267\333\245\304\373h\230\240\300 n\2254\r\252\223q\312'\n\270\256z$?\317Vz\312\213\325\233\307@\310a\246\244;/\224\016\372\312Q8\234\320\363\211O\243\222\327P\2247Yy\234\343N\250\373F]\204\267bHwS\206"
+	.string	"\304\375\367&b/\276`\001\016\344\262\251P\343(\303^O0b\307\004C\201f\367,\333\376\034\343@%\345\355Y\361D\313\357\200.\f\254\262A\226\303,s\231N\200\324#\023\022\t\206\013\006\367\345\301\210\220\274\261x\332\252\034B\370\320X\016\024\247\026m\2616\203\355\212\334\235\021\346-\317O\034\256n\2126\346\034G\337\227\325#?\356\326\307M\222\371\31114\211\377\277\236\347\302\237\252\277\001c\357\301\256\330I\243\177\317\274\212\267;E\234\2149U\353\215Z\200\t\004\360\267\262\202(G\0241Ii\250t\254F*\273\362\035\302q\260\355\274\006\347 %\302\233>\214\225\265\343\2069\271!B\267\020\335\334DD\033\332\300\260\255_\340^O\320\030P\250\377\354\334\345t;\2510k\351\205s\3723\032\321!3TU\324Z\353\206\273\265\337 \314\304/]8\343\276\334B\221\013\351\\\225W\252"
+	.ascii	"5\234\t^\364o\3777\252\327\364\313\017\024#\013\243\n|Q\274\205"
+	.ascii	"q\234\003;\311\300\361v\247\027\bZ.QDg\3749Q\376\227>1\324`\026"
+	.ascii	"R\020b\343\371Af#\344\3671\334$\351tz\\\017\005]*\377\216\353"
+	.ascii	"\371\264\357\340\331\\\301\346\222$\333\347R\200\377\013"
+	.string	"\32122\345s\240\te^\326\357\303\320\023\307\034\237\240\2158\376(M\325rV\205?\221D\f\315\003m\335\341\215Uld\207T|\272\025\3151\264c\365JO\351\323\001GM\003\265S`\335\234-\216\177.\230\330\205\302j\2229\247/B\035\267.\234\366\200\351\215\230\266\177\2700\027~\373\367\317\006/uy=\353\251\255\025\210\255\346\232\224>M\320\221\3728/\360i\314^\372\253\343\274*\017\240\367-^\rt?u\027\332z\032\217|\037,\377\201\360bvZ\330\032\007)Ni\343\310\221q\303\315Z\357\030}\332\350\0217&\fr`\335~a\016h\274\315\373Q\253\230\205\034\313\216\203\265j\217\245\234\264\374\304\326\224\325F\205\343\302\220&3~g\3117\243\277,&\r\272\324\374\255\241\203\201\212[\210<\344\232\240e\276\346> \277i\246\327p\376\027F\216?\002\230AO#\267\"<v}\r\342"
+	.ascii	"\001OU\231-t~;\324\377\230\311d%\336\rnF\373\337\357\037\326"
+	.ascii	"\257\244\267\277\007\344\364\006~\245\2736\217^\2710\312\364"
+	.ascii	"\236\347G\257\241\350\307t\377\345p\214z\255\344\347?\242\265"
+	.ascii	"\\\374\023\360\023\r\217\324b\205\r\013\354\030$\274g]*\317\225"
+	.ascii	"\2761\334#\3505\332w\352\232\356%\355\020=\020/\314\274W\263"
+	.ascii	"W|s\376Y\332\031\fK\031i\\\004\277\250\267wt\223\276X\366z{)"
+	.ascii	"\354 \302\353\370'\260C\240^K\017\332\314\363{\313{*W\273\327"
+	.ascii	"\3431;\212\335\306\346\355\326I\302\342\215\255\321n$\370\017"
+	.ascii	"$l\365\340\306b\027!\033\363\377:=\365\031\376\016Bn\3768\360"
+	.ascii	"5\321\237\016\032\266\201\217\321\326\364\270\264\025\374}^\223"
+	.ascii	"\272:\320\021\3311\330\331\217\374G\242M\030\232\001\233\364"
+	.ascii	"\331\237\270%\245O\274\0342n\374\376\321\337\t\tG\2407 N\266"
+	.ascii	"/\n/R\253\337\372h\001\357kq&\311w\275\343i\001\340\277\311\033"
+	.ascii	"\025Fs)t\275\367\363\361f\353PQ\370S\340\356\n"
+	.text
+	.section	.gnu.lto_.symtab.fa435e80068b919a,"e",@progbits
+	.string	"batteryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"batteryWarningVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"getLowVoltageCutoff"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"getVoltageState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"getConsumptionState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"isBatteryVoltageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"getLegacyBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"batteryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"flightStatsAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"changePidProfileFromCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fa435e80068b919a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
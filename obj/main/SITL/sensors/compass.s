@@ -0,0 +1,588 @@
+	.file	"compass.c"
+	.section	.gnu.lto_.profile.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\006"
+	.text
+	.section	.gnu.lto_.icf.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"u\005"
+	.string	"d\007\030\001"
+	.string	"\020"
+	.string	"\322\266\272\274\b\022\002"
+	.string	"\002\001\002\002\002\001"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\267\335\335\337\n"
+	.string	"\003\315\344\253\361\017\002\002\003\002\004\004\240\342\234\212\n\005\240\224\254\300\003\006\006\326\201\355\364\007>\002\005\002\006\002\002\002\007\b\002\006\002"
+	.string	"\002"
+	.string	"\002\t\002\t\002\n\002\n\013"
+	.string	"\n\002\n\007\b\n\352\263\360\321\b\013\f\r\016\017\203\325\356\324\t\020\240\342\234\212\n"
+	.string	"\030"
+	.string	";E\300]Jc/\262\251c\037\323\362\345c\347\302n\001\254\360\225a\b\026\274"
+	.string	"\370\371"
+	.string	"\026"
+	.ascii	"w9\307\336\224Z\347\255\035-\323\f\bPa\345\256\002\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 :m\001"
+	.string	"\004\002."
+	.string	"\006"
+	.string	"\001\001"
+	.string	"\001\001"
+	.string	"\001\002\002"
+	.string	"\020"
+	.string	"\007\003\003"
+	.string	"\003\005"
+	.string	"\003\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"@\021\337Ez\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\275\004"
+	.string	"\"\307\027\"\240'\351\bmY\302\030\253\226ZJ\004\30320\332:\245\236UU\227\021\263\177\366!\004id\313\235\002\177!\371\305Y9`\f!O\004Y\203\271\310\023A?V\213\006\376\255s\264\215r\202\340\245\217\352\027m\233-\301\263_\234\373\005\211s\335\340\027\031m\001\244m\233\342\332\226\360j;\004\026"
+	.string	"8\007q\025\306\331\341\243\261FR\310\221\n\320Q\210\271\002]\002\236T\307@\013\260\216\243\310Q\345\302M\344A\031meWg~*\323,\346\371\264\253"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 \372%\004"
+	.string	"\262\206\026!\220)\351\237\337\315\256\b"
+	.string	"\376\237\337r\276\305\236\206\217\337\314\207\351\213G[2\205\374n{\313$\003<\240\210\241Eh\231\243\226\n\t\305\202\247\276<\345'wB\030\215\007O\031\007G2d\t\312\300\275\233\225+9\342\242\233\373\346:Q-qK\223\\\002\270\213\352y\264\004\020"
+	.string	"\240\210\234et\fP0!P\364\021\262\302\324\0357\032qh\007\303\347S\foZ\200vi\212\343\235\344m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\200\004\002\200\004\003\230\004\005\204\004\006"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 u\205\002"
+	.string	"\002D\016\032\260'\035\f+]\350\241\220$\005a\266\034R\265\220i\006\272\232\330\336M\312\024'\312!\301\317\243\334(\007n\333r\242\205iN'\263\213\016\r6\347w\242|x-\374\027\b"
+	.string	"6\0030\263\023h\030\316U\025q].x\031y"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.3256221e7bdb6b8f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.34.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 \241\265\004"
+	.string	"t\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\276\356\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\374\006us\250\324\006uq"
+	.string	"\005\001\006'\001\030\005\001\006\035\001'\001\250\300"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321 \212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_compassConfig.35.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`\246\001e\r"
+	.string	"\206\327VC"
+	.string	"S\234\016\300swO`c|r\256\253h\361F\231\222\003!\250,\247\354\261\306\206\277\251t\241\357\261\204\034\252\300+|\rr\203\330\325\244\273\214\347\020\t\013B\370\240\327\025\200D\322\203\216|\033\332;\245@"
+	.string	"A"
+	.string	"E"
+	.ascii	"/\276\207\230N`W\344!\262K&0\002\313/\223\327\324_\226\027\250"
+	.ascii	"\277\374\331?6\036\004\264@\260\312\335\305\350\212\177\237\237"
+	.ascii	"\177\030\277\204(\360\023@\203\335\365\fQ$nz\333\006l{\354\311"
+	.ascii	" \325\316\360\030\236ew\025\370+\r\0334,Z\374\362M\365W\204\020"
+	.ascii	"\342\t\025\312i\266l\022\234T\205\375\312\356\256\251h?\344\247"
+	.ascii	"s\372\031\017\2202\310\206\306\356\210V\312\226\\#.0\266?\355"
+	.ascii	"\253\036\277\261:\031A\037I\231\2242ng\027\361@\223\021\345\241"
+	.ascii	"\333\360 \210H\271Vm\321kh\232\313\212U\006\230\365&\251\007"
+	.ascii	"~j\217\266\371\320\230\024\037(h\177\006\207Lh_8\253\373\305"
+	.ascii	"9]`\"GX\342^\"\315\002is0\300Y\247\353@\245\321\226a\035\267"
+	.ascii	"u\244P\207\2214\320\b\313\270\016\353p\274\225B\034\206a\333"
+	.ascii	"8\fC\356+KE?@Qr\242\035\374\035\267%\234\344\203\3621~\252=\341"
+	.ascii	":>`\217\221\302q\244N\312\n\001\" \260\202\2219\3633e\221e\017"
+	.ascii	",\255E\013\364F\035Y7\246\016\330\371\335\315\375\335\315\341"
+	.ascii	";\304!B)\317\230&!+\247\001\022]\302\001\355.zD=\342\b\316\264"
+	.ascii	"\032*\3302\355\220\307\220\330&<e\006\333|S\302\016/ZA\006"
+	.text
+	.section	.gnu.lto_compassPreInit.38.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 \302\035\005"
+	.string	"r\211\")\200k:\300T\200\233\246\310!\213\006u\300\310^-"
+	.string	"\376o/\373\367\364\266.\2425C\230\n|\253\t\262\020\021\b\355\235R\246\244Z'\314\232\224\254t\326\253\252\362BL\226\244h\225R\344\211UT&\346\244\022\362\366\261\033(\342\302\3664\030\037\366\001\033;\033>\027M\364\3556\276\316f\002\026\211\355C\316\354\315\275\310\236\202aT8\273+#\344\331a\346\177r\301\306i\207\217aw\r7\316q\307\333&\330.\330>\004\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_compassDetect.39.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\225\007"
+	.string	"\242\21656Po\322\001 v/.\250p\250\013\323\204\316@\274\307\277Z\352\255\336\361\303\"\310\205\263\351\265\315\364\201M\b\252:n!|y\231\320\031\215u\356-\243\335\366N)!L^\230\304g\242\n\240\220\021\317\226\207\322\ntM+\322lRL\322\210}\252+Z\031\215\236\002O\220\314bh\316,v\352~\243\f.\036\206]E\356y\330\337\354\356\372\225lw\016\222\223\f\304\314\356\250\206f_`\313\210\355\333\326\354\216\355W+b\026\234\263\177r\223v\024\213\013\354\226L,\273U\301\t\234C\327\023P\207\234\017P\207\266\315\320\240y{\005\031=D$C\345\264[\343\373\370v\267\371O\371\201\211K\007\314\nIt\007\360\260\273v\032\244\215\373\3356\202m\007\333%\001\n"
+	.ascii	"2\003\202\341\243\302f\025P\270\f\b\n\301e`$\001*\314\353\232"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_compassInit.40.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"BM05Pm\222\016d\\E\226\230Z1!\033m\240\2054\350\337\362\253\254\312IuC\273\035m\324\235\255;\3707\233Y\3048+\274&m\201\021\013~\206\334\020!2\005S\225\030/\233LE\301hUQ\203\211P\303p\311@\312\212\260Bp\265\301X\260\241\252,H\321\260^\223-\330\363<\351w\006\357P\220I\003Yf*\\QG\017w\243\323\020\034\327O\247\313\231t\252G\235\b#\243\370\3300Wz\315\343\336\305\027 \237\305\277Vtl$\013\245LP\251$G&\021\216\277\363\224\021\022:_\3252P5F\022![\246\006_F\257\272\353\n\204\"\352\002,\231\271\373\204&\372\353_\360\037\374Y\t"
+	.ascii	"2\003\302\360\030aF\035\302qM\314\212\300D\210\034\356\334m\213"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_compassIsHealthy.41.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`e\001\215\f"
+	.string	"\366\226P? o\224\016\307\034"
+	.string	"A\007\004P\314\231\324\007\204E\262\227\220\361\232\031\037@\215(\005j\214\"~\262cf0\322\0323\301T!\001\200"
+	.string	"\364db\264\177j\374\204\tbNu\310\336[\312\224\002?"
+	.string	";"
+	.string	"A"
+	.string	"\317:6n\201EFH\212\335,j\205\213\016\237\323\024\371\023\346\235\3206\022v\035N\370\203\220N\202a\244\006\300\0368\312\356>\303S\003\273\310\2340\273\353$a\022\356\351\266=\266+\366=\002\376\205?;"
+	.ascii	"\345I\177>\b\376]'%FF\271\331\331\225\312a\337\255\226l\247\241"
+	.ascii	"\246]\2465\323\231\351O\003\"\210X\200bwc[\261!\336\b\006\333"
+	.ascii	"![\342\003\bB\026\005OKz\016\377`\355\"\036>\007\351p\203\200"
+	.ascii	"\177\252\027\321\273\324\244`\340!\326\"\310\307\362\221\032"
+	.ascii	"\237\273{\251V\340\252#>L`\244\n\3133k\023\022\273\253\300\246"
+	.ascii	"\276\341#\240cw\023h\270\207\025\326\\,+\343\341P\232hU\224\325"
+	.ascii	"\331X\261\303 \303\211\232\312\212\027\002\246<\233*6\240\250"
+	.ascii	"*J\262\275[-9_\345\351,w\252a\033*e\244\027v\n\365\031-F\271"
+	.ascii	"\001\200\312\0015\333\275\002! \320\002\031\n\356\006\013\031"
+	.ascii	"z\306\031\336\313\"\007\034\307\204\361\b\274\244\006+\353\336"
+	.ascii	"\314\225\336\353-I]*\243q\273\344\224k\324\250\001v\334\263\201"
+	.ascii	".\030m\006\341\371\341\313-J\005E\036\274\217y\234\244b\240\033"
+	.ascii	"\005\247\267k\225\001"
+	.text
+	.section	.gnu.lto_compassUpdate.42.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`&\017e@"
+	.string	"\352h\004\027AP\346\316\030\377S\027M\375\253\277\217\366\206\330V\265\325\260\273\023\f\346N\001\247\261\253Z\213\265\251\\u\004\fH@p\035\250\004\n\300#\":\177M6\233DDG4\024\215D\204H)eJ)\005]\001>\001i\001\374\254\263\257\316\255\001)\314\231\020e\3367\307a\237\327\314*U\322|\335W\272\363\272\255\264\352\357\356-s\367=\215%\337\2617\302\271=?\277-zX\374\342\270\243\334xV\030\220\b\246\203\310\347\207f\370\276\357U\257\334\200\330\253zd\346v\346\266k*nW\231\301\305\367]\243\302\345}\243\005\230"
+	.ascii	"\261\327\247V\262\275\252]\304\366\312\3542\307\351(\364m?g\331"
+	.ascii	"\225<\357\373b}\222#\245#\177\253\321fuu\233iI)\t\351HiTD4\264"
+	.ascii	"L\n!\203\200\216\306\"\261eW\365\335\345n\263\002\020\312q\232"
+	.ascii	"\2015S]/M\351\223\342Jt\235\324\327\026\336\b\347\254\235\321"
+	.ascii	"5\222\232\254S\017\264\371Q\233\205\344L\256\225qm\024\267\007"
+	.ascii	"\347EoM\364\266\347\346C\035&\327K%\352\023\023\035v\236\254"
+	.ascii	"\203\272P\221F\026I\363 \"\r\244&\207\250\007\364\202\370\021"
+	.ascii	"\311\231\2206\266Yz]\341-n\316\332\231\220.\252Oht\020Q\237\356"
+	.ascii	"\032\212\211\0164'B\265m\326\332\031\220fU\253\2641<\220fe\252"
+	.ascii	"\362\f\333\233\276k\372\252&\337\367E\232\221\251\007\334\206"
+	.ascii	"\231\230\253Kx\3647^[\r\3769\315x\264\267Y\357\373\262;\315\316"
+	.string	"\232\233\232\331?0s\004\346\240f|`\330\177r\2611\260\352\237\310s3\346{\230\331B\023b \222Q\277\357:\312\316\226\365\237\\,|\255\377B\277j\252\267Q\240\251\276\357\344\025\216\371\236VU\002M\365Z\337C\006\377\232ib~\310\377b\370O9\345\f\035F\013\t\005\323\203\0338t\350\340\244\343\377\377\200M\3030?\234\353@&\003@\377\306\353*@-t\3220?\374\177\337\027\354\331\310;\332^H4A\273\264T\304\b\022$\242\375\207\302h\372\276a\355\334\362|4B\366`\314\\\242\263\230 \276\357\253\200\033K\373mq\303\365\312\\(\274\235\275r\243`{\355\377'Y\350\252\204\371!sT\314\377\311\334\375\376\021f\255\f\027$t\225n\007F\347\006D\347\005\315\327l\325W\232\253:\257y@[i\246b\235\005\024\235\247\212\316RE\347(\3269@\321\031\212u~b\235\235Zg"
+	.ascii	"\254s\023\353\274l\235\231X\347\245\326Y\351\350\234ttFj\235"
+	.ascii	"\217Zg%\353l\324:\027\265\316D\255\363\020\353\234l\235\205Z"
+	.ascii	"gd\353\034\304:\003\265\316G\243\263\321\350\\d\235\211\255s"
+	.ascii	"ktf\213\316+\321Ym=\200l\257E\277\252A#\372$H\236C/\364D\311"
+	.ascii	"\037b[SK\026\360\"iD\204~-3(E\276\020\017\342hA\177|\344ws\016"
+	.ascii	"\350\203\336\3754\r\1770\251\240\356\303{\270lRS\240\247j\223"
+	.ascii	"\372\016?\323BB\335\354\370\353\2232tR\244\361O\340p\343\\\""
+	.ascii	"\356\222\377\036\204A\377|nC\277\321|\332\215c\331/\252a\304"
+	.ascii	"\b\226\001\021\003\372'\037\335\214\022~u+^\365\200\001\357H"
+	.ascii	"\3748\340%|;\t#\247\231&V\203F\331\013\267m\210\030>'\035\342"
+	.ascii	";\031\323\311\307\\\265&\017s1\227\215c\270mm\355\023_\265\323"
+	.ascii	"$\224\363\227\377\022@\017\265\n\374i?\350)\250G\032\306d\345"
+	.ascii	"\232\017s\351\026\351=\256\0321O\353q\331\216\240\357\373\272"
+	.ascii	"O7\211\261"
+	.string	"\3356\275\256\"\023\224R\247\215\016\236\333N\337\231!\303}{c{\3755\201tC8\372\276o\261\211m@D\223W\250v\023\313~\2036\3549n\0347\034\273J\334%\336Nw\t\333+\373+ \240\036 D\001\276~G;\016\034\255\2517\356\0237\312\323\202_\177\220O\331\237>\354.V\375\005\317^\006\204\277P\221\002m\243\246n\035\320\324\245\322m\334;\004S6j$\020\323hIM\321\360\004\n\336N\006\n\2543C\366`Wx\001_)`\230P\277\230\\*Rxh\261\202\313\313\313\305V\020o\031\370\3722\301BE\327\026\326\227W\327\327\n\256/\254\025)L\250\300\332\362\372\3022\320\304],\270\274\260Ztuya\035\243a\335\357\037a\020b\314\204\275\0303!pf\027\315\025\342w\3358\004\001\315\210=\330Ra\322\205_\013\221\256\332\312\352\035\212\222\325_\300\323L\023\360a\230"
+	.string	"|\320\301\270l\313\251\027\360\352\232\262?\320\226\372\251gZ\323\234\022\365P/\365IW\232i\001>*\220\331\201\200\256Z\177\371\022\340;\260M\372\364P\337e\177\334\\\312|0\355\342\252)\230ry\372\356k\254\036r>\351\237Qz\313]O=\343\344\251\203T\250\314\360k\341\362\252\253\252\336\241\364Q\325g\370\266\033\203\307\225NY\374\260\274p\0224\002@\330\364"
+	.ascii	"\372\370\366\232^\350\371\246h\371zL\252i\236\25365\305S\372"
+	.ascii	"\345\267\035\031\276&\341\201\367}\211\376\311\364J\337L\362"
+	.ascii	"\306,=\223a\224\t\001z\347\252-\200VYz\b.\234\333\361\237S\235"
+	.ascii	"\326r\212\322\367^S\331i\243Gj\346}\337\241\177r\367\362\217"
+	.ascii	" \2234\017{\006\233\364^yd\220\336\301'=\2141m\232sb\311\031"
+	.ascii	",\222\035\207\202\364\277f\215\320\321;i\302D\371E\177d\364\312"
+	.ascii	"9%rF\336\346pon\336\034\2016\250q4%\0313D2\"\222$\251\2441\241"
+	.ascii	"\005\204\030\346\034<\017\0210!C\216!\252MRi\f\223 \027Z\352"
+	.ascii	"\230D\205)\004\316\253\260\236\bk\267\323\310{\030\335W\222f"
+	.ascii	"<\353\324}tx\214\331U\200\210\344\262\237\332\216t0\221Pc\003"
+	.ascii	"/\2553\264\013\323\210\026\316\315\321\237\3457\202T'\343\253"
+	.ascii	"\324\313\236\013\246\237\272\013\250\206\320\\\\\303bD\016\205"
+	.ascii	"R$\272\261\366\360\003x\313\002~\263\302W"
+	.string	"(GD\230Q\236\311\363\251\374w\331\330N\035\301k\226\262\013u\246\204s\330)\215\374\2136\370\017s\375\223\303r\310\343\036\213\276b4\001\375.Y\025z*\017\003\022\367\030\016\320\352\347\220u\216\261u\276#\345''\374\372\241\322^\035\344\200v\260\277\324:C\031\276gS\203\231$\221\030bJOk\001\026N\343\353A\035\210\001=3\223\331\007\322\r6\214\003\227\234\340\357\301\031\236\n\n\204\3739\024D\215\354Q\240^\005\323\026\177\230eD\266.8\356\232j\3009\247T\227\340\271\363b\314\344\261\331\350\243\001\341=\350\302rK\255\r\302gw\323;2(t\263\020B\314A\bn0\267\353\261\206\361\225%\217\222\260\2024\270\333\001\3272\204&\274\267\035c\301\022Y\004\016\313f\214\204=\020\013e\\\250\226\217c\265\230\300\227!\224f\273\320\307\2136\260B\366\234\030\217\3126\020gU\356\334{\207"
+	.string	"\344\340!\024rE#\007\305\334I\f\374\254\026ME\\}\240G\271\236"
+	.ascii	"p\211@\235\362I\355j\027\316\242\323\210+0\020D\311\244\2372"
+	.ascii	"\321^`+E\231\331\374\303\310\260B\224$ \2435\343\220\316h\334"
+	.ascii	"\213L^G\234~p\005\314H\031\221l\213\n\240L\030\252h[]_*\333{"
+	.ascii	"\364\236?D\225&/\370\177<W\356\234\257\036\375\023\215\270\n"
+	.ascii	"\301\366J\215\365\253\271*Q\265"
+	.ascii	"I\2359\007\301\364\273\364oD\274*\202\300y\371g>*~\2627\275B"
+	.ascii	"F5\027\215\b\261\230Q\036\261ss\264\032\300h\t\r\\[F\027\310"
+	.ascii	"o%'\362\314\r^\243Q\366\b\246\3663\345\351\024\374$\260\023'"
+	.ascii	"T"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\035\007"
+	.string	"t\n\235\001"
+	.string	""
+	.string	""
+	.string	"\002#\177\032\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002&\177\033\200'\177\034(\177\035\005\036\020\201\204)\177\036\200*\177\037\001\005\035\023\005$\025\200\003\005/  "
+	.string	""
+	.string	""
+	.string	"\0050!\037\"1#2$%%\200\003\005\"&\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005 '\001+\177(\377\037"
+	.string	""
+	.string	"\200\200\200\0013\177).\177*-\177+\003"
+	.string	"\021d\003\006\024\330\307\302+\001\344\006\003\006\023\250\270\275\324"
+	.string	"\001\304\007\003\006\022\200\200\200 \001\204g\004\006\200\200\200\200\001\001U"
+	.string	"\031"
+	.string	"kk\030\240\036"
+	.ascii	"\034>@4\277\224`\t\206\313/\256\006\203\340|\346\006r+*\267\231"
+	.ascii	"\234\005\266\231\253a@_`\007\f\027\344`\203\240\001=\300\037"
+	.ascii	"0\\ \303e\347\030"
+	.text
+	.section	.gnu.lto_.refs.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375 \267\r\004"
+	.string	"rK\037#\200K\322\032L\005\217L\310\204L\310\204"
+	.string	"\257l\036\340\205pc\333\023\033\333\326\b\331\204tG\"\267\224)[\200%\203\2347R\255\321<\2039\306R-\232Z\321L\301\324\tf\211;b\031\342\352C\332\341n\270\312\220\216\334\013W\025\322\t7\302\343\003\245\0324\265\200\251\004\367@\252\002K\205(?\316&d\323Y\005\235\\=\216\315a\r\331B\001\"\223\373\334u\223\263\256N\375\""
+	.text
+	.section	.gnu.lto_.decls.3256221e7bdb6b8f,"e",@progbits
+	.string	"(\265/\375`\201&\r\263"
+	.string	"*\"\001@X0\nQI\035\0248\017fo\334\240\"[\361\017SK\025\372\313\374\337P\231\306\252KYt=\025\016\207TPv\266\362\201;\317l\033\260S\351\310Jt|\363\317\374\317a\250\250\347\022\206\250i[\025\233$\0022\t\317\322*\222\354*A4$\220\352Ur7)SJ\001\202\003\362\003\371\003?\345\321\262\333\345\326\374\031\016\375\252\247j\017\3622\372\366\354\334"
+	.ascii	"qj\262%\275\236\257\327K=T\253}s\202\217\322\245\no\013\333\\"
+	.ascii	"\031\370F\373a\264\005\337\217\265\031W\177\273\377\205\013\032"
+	.ascii	"\264\033V\316\277\377\264c\241\232d.\023n\027B\207gw\347ss\n"
+	.ascii	"\370%\377\222Ek\255\013\235\334\024\277B&\351U<\323+\375\362"
+	.ascii	"\235>\305\263\370\246_\361-\034\372K\016\246=\214\343y\3619\240"
+	.ascii	"\315\271j\213V\030\026\2772\306\203,\271\230G\001g&\213\026\237"
+	.ascii	"\363(\263\203/1u9?\333\207\374\222\023\36180e\352\270p\350\360"
+	.ascii	"K^\347s@\3443\267\340\200\313\f1\274\234\237\276\002\216I\331"
+	.ascii	"\316}\245\005\362\366\266\365\366\311G:\364\221\274L{\0360\231"
+	.ascii	"\223s\026\335#\371\230\223\361(\326\375\302\222r\335\2519\245"
+	.ascii	"\267]L\311\2263\237\335\214C=O\2317\227\007L>s"
+	.string	"S\b-Sp=;==F1\033d\360mk\003\267\223q!J\337\023\233\220$\177\375\310O\373\030\213\244-E\231\277m\235\260\357X$\356\357\202\373\345p\177\033\336\201\342~0\314\203c\313\315\231\023\316\220\261\302\375/\360\006\277\304N\305\2538\024\203[i\016\035\332\"\207\344\260\234\2378\027\352\315\306\216\277\375\031\267cH=\3171\244\355w\270\313\274B*\305\202\r4E\363\353\r\303y\024\207z\324\325\306<\355\313\255.\352H\374\315\243X\037\234\201R\227s\266\320\323s}|\t\362%\275Pl\224\360\200\374m'\202\333\233\270\023g\342Pw\363%\375\317\234\313\204\264\251\211)A\363\265$\216\006\354\345\334L\323\3129\267\002\272\177\332\335\234\315\321.\240\310\271)C'Y\005z\207\227s\336\351\351\351\351\301IrVu\251\271\355J\334B\270\207\2707\200;\0038C\b\334\035\340\3664G\363f\236"
+	.string	"\350\242\210W\214\277N\346e\016\265\340g\355G\\\254{\311g~\272\035\026\222\323\337\317"
+	.string	"K\020\227;4\020\203 \347\274<\267\220z\221\237v#:i\023\363\231q:\300Q\343\353\257\255\301H\274B\212\201WHS\2354\307+"
+	.string	"\351v0\017\303`\227K\315\\\226\363\223\002\316\023\212\251\306\337~z\205\024\273N\332\355> \320p\335\215\326\335R\376\001v\335o\201\003\272?\203\356\357\340\033\300A\267\267\350v\0174t\367\230\027\335\216\242\333\253\272\035\253+\350\356\013\016\201\336\351v\013\234\335\241\333\272h\0214\335vE\267\023\340\031\220v[\025\t\350\356\333m\221\355\335\226\250\333m\272\235\246\273\255t\273\257\333s\272\275\327\3557\335\216\323\355\300?\300\006\335\216\273\375v{Mwo\371\005T\350\266A\335\377\353~\234\356\007v\277M\367\343\356\257\351\376\233\356\247\360~\327\375\275\356O_\203\356\316\351\276\007\350\376\016\335\177A\367\363t?\002\272?\202\356\177\322\355L\272\235\255\333\327\272]\255\333\317\272\335\254\333\213t;\221n\177v{W\267suw\b\335n\243\273\217t;"
+	.ascii	"\272=\253\333at;V\2677\240\333\007\320\355W\335\036\200nwv{\263"
+	.ascii	"\333gt;U\267Ou{\214n\227\352vf\267Gu\373\005\335\236\241\273"
+	.ascii	"A\350\366\b\272]\247\273\303\272\333\202\356v\353n\234\227\227"
+	.ascii	"\227\327\3759\272}\032\2721\304\b\321\23432\347\354k\242z\346"
+	.ascii	"\034#g\251\305\304\2243s\207)S!\327R\344\374eY\2208-\307\254"
+	.ascii	"\232?kF\306\264\262\212'\322\265"
+	.string	"\362\025g\023\036C\n\311KwX\313\311\205]\026\324f9\031\236\234\2372\2005ih\032&V;\324b\331\0314\313\333cL\335o\241\302d\376m\032\247\032\355P[\303^\361<3\322\271l\335h\303\313ML\r8-\250\224J\177\255\r\240\0309#\3179\334\030\013\217u\322(\237y\314&\t\225&%J\243\207\264\370\312S\322\234\341{B\232\211\332\252\032-\262\032SLp\267\225\021}(\026J9\252\3668\251\246\250\033S<7b\252 y\305\370g\217\310\223\257\244\224\2231\312h\202\307\244\212&\315\234\254\013\013e\233\354\223}aa\330\026\016\265Q_\243-\223e\321;k6\352}|\230\335\331\217U\332\024^\202\324\375\027\213\004W\026f\243~\353H\230\215z\"\357\345\002\322\362&1{\0366\352\265\320\336\004\033\365@~H\023h\224Ua\227. -\363%\223b\225\304\213\346\n\310T\023"
+	.string	"\3344{\005\235\324\2560\301\314\330\025\225U\262I5I\256\330Y\261\313\266IV+\n\2220W6pZ+\242\260E\221\003X\302\216&4\3766N\342\366\231\301bv,\231\362\204\277\355P\233|0e6\371al6C\222\367\002\317&'\211Y\2739\217\005\213\272\345\337?C\003\345\005\f'ie\034\372f\232\216\207\006\327\323\337\376\362d\376\006\025.c\310\364\217i\312dR\177\305\370\350\234\342\206\204a\274\007C#9\305\351\004\334\276\033\270}\316\273\327\002$\312\310\337\366A\341\272\357\342\320\267\373\262\035\273\037{2'\037\226:\2737{:\2172s\262\222\316L\235\033i;c\227\336(\257\345\347~\313sq\350\323\365\323=\364\225"
+	.ascii	"\221\024r\276*\243E\367l\377\366\224r\311w=\360,\364\364\374"
+	.ascii	"\226l\310@\342\213\345\2638\364\265\374\025\271\267\342Q\346"
+	.ascii	"3?\001\317\232w=\360\264|"
+	.string	"\364\343. -?`\323R\207\225d\261\225\220\336\366)Y\251r\223\244\306ee\312S\251\201\301\214\262\235\301\335S\332Yl\241p\373\202\333\241=\367R\232\016\007\024( u\270S,\270S*\270\025\360\366K\376\211G\313>\300\321Ay8\207\376\333\273\335\267?\363\271'\\\352vz\200<\270\300\2008\301\367\207\222\354\355\357\267=\023\207\276\223o\222on\350d,\351\241\206M\370zI\332i\031\356t\f\257}\022\207\276\222G\262\363\314\371\210\222?\362j\027\220\226 \252\306\324)\371\263\037\017\255\273\036;==\276\032I\202d\245\267S)\2654+\265D+\363\3541aN\321\201\366e\277,J\231\356o\247O\270S%\334)\022w\017\017woK\2217\202C\346\024\363\212+\322{\202\273\247\344\205\270\034\2301Ic\370\305>\210C\377\331wH3\217\345\374\274\261I\25075\236\024\307y\322\356\375"
+	.ascii	"\333\361\036(\202\364\260\302'8\364\277\276\353\353\177\274\027"
+	.ascii	"P\371\314H\0064e\321\362\362)7\244(\367zu?\327\367\370)\032$"
+	.ascii	"X\236|\374\355^\n\334\327\016\367\225\303\337\364\n\251\001\\"
+	.ascii	"'\305`\t\356\213\246\263C\207;\261d-\371\253#\307o\t\226\220"
+	.ascii	"\0277\372sd\331\344\034\226s\276p\323\214\353\"\373\373Y\377"
+	.ascii	"%<\216\376\254\307\262Q~\326\3159\351N\001\320\235\202\336\022"
+	.ascii	"\035I\"\351\355K\206\337\352\257\236\214D\227W6p\\\222\031\332"
+	.ascii	"_\350\333\370\032\3359\347\233\2637\2740b\270\277\274\223\246"
+	.ascii	"\013\225(X\316kc+\r\214F\225\215\330\033\221#P"
+	.ascii	"\037\345k_\365\314V\003\322\344\334\004\212\326W}\214wF/aZ\301"
+	.ascii	"\273q\253,\234\225\034\322\337;u\251\034\332nWF\003\223\2500"
+	.ascii	"sK\302\035\002o\267\3642\373J%\251\262\341\374\3337\310\250n"
+	.ascii	"\032\037\264\312\224V\031\3346_^\334\027\357\202''g\253(Hl\244"
+	.ascii	"\320\274X\211\303\355'\270\205\322\226\316\241\026\312}\262K"
+	.ascii	"fv\201\200\026T\032,\226RJ\330"
+	.string	"\337\353\364T&\255Tq\262\004\267\207\331Y/b[\354\027-e\354\231\256(\177f\357\302\262\330.W\351\346\253\302\243ixbW\311\222\271\262t\233n\213\313t\223\356\212\313\302\241W\311\346\265\345b\353z\347*Y0v\214G\261\"\020\206\245\016\307\013\030YT\316\265v='F\227\342.\035zU\224]\025\037\346\242\370\241u\251\362\204g\241\347\306n\312\225\251\364v_\024Wy\344y\343\356\357E\3621\243\334P\370\300\335\027\351\320\233\304_\274\326\310\364\334\217I\226\025\017\3346N3\230J\235\f8*\3346L\3346N\330\206\261x\016\255\300\212y\034f\314\210\374m\233%n\257 \265yy^A\3326H\270\177g\274\330\273\261'^\340\356\346\344\336\226\220\306\340\f<\256\223\332,v\213\235\353\246\301\371Bruf\207\333j\t!+\312\331\337k\257\264\305\342\306C\213i\016\267\255b\255t\323"
+	.string	"\257\3540\023B\005\267\245\322;\313\363\"\365\327N\301)~L*\250\221\2216\303N\351\266p6\212\225\343\300\007\362\314\204\371k\245\330\270\266r6\232\255\\\006\315\234\223V\016\247L\316I\034w\n\334)\270_V<\240\351\355_\022\334W\274Bz\343:\351K\375\264}\373\301\265\325\005\371\333?0\334\266\211\333'O|n'#\3552\200\375\270p\273\317\2651\361\270\233\317Xh\325\300\375s\241\004j\331<.\002H\313\234\254\221\200\255\265\237\022w\315\335\232C\355\332\273\350-svB"
+	.string	"\017G\276ui\203\303m\217\270M\203Z5kusYN>u\330\022\362\324\3205Np\327$\301\355\326\352\314\241\366\314\347v\232H\273\fA\326\270\330\360rn\242\241\247F$j\353\006\031\2315s\246\003\316\224\352n|\260\351\020\263em\315\200aK\352\304X\005\227d\341I\025)b\211|0c\315\267Tz\001\345o\327,\207\f\261D\242p\234_Q\272\210lqY-\225\361\362\262O\214\254"
+	.string	"c\355F\033\236\272\225\275\004i\373t\023S\344\355\257\r\263b\026\2449%Y1\013$\r\342\244\353\211\255\242Qq\303\371\302\202u"
+	.string	"\313\f\022\330\227\031'Zi/\244\273\263\b\001\363\366\327\236\360\033\003K\206\241\363\341\303v5@\312\2156\257\314\244\342\241\241\361\324\365\325_\332v\365\342z\354\200F\301msX\035mw\364\016\313\205s\316\256\326\205\311\344\3017\240\224\226Lh\313\205\003\365\222\004\316n}\217\2541tv\313j\3618R\246\374'\346\021\244!\177-\017\267\241\213F\321\221\341\356\357Ns\262)\347\374\324{\346&$\233\324{\356<\3357n\275"
+	.string	"9w\367\204 \347$\023//\230K-9\225!w/\232\263\322\211\214\200\323I\351\214Z\21693R\271\003I\241);\221\313\261\234)d\245\022\371\241\231),\307\262SF\021\347\344\371\351Dfe3S\310\312\234\314\260T:\235\226cI'\n\3131\247S\036s\346\234\254L6%)s\023\205<\346\354\222\307\232N9\313\261\246\323r\314\231\345iI8\304\236\332\274l\344p\032Kef\301D\225l\312\211.\237\315|%g/K\221\233\n\2203U\263\351J2\312\221 EY \035I6\375\311\204d\325\314\312\350\262G3\347\036HB\231)\003\3443\232K\360(\262\006U^J\221s"
+	.string	"\230rFz\016&\210\306U\bB\004@Fa\321\b\003\204\020\02210\202\004>C\022\023\234 A\\\213B"
+	.string	"*z\240\226\020\036u\212D\343z\364Q\201\216\206\206E\242\217\361x\344#\301\320\320Q\261XT\364\255\301\224\204\"\243\320ZT\364\221\020\252CwU\217D*Qz\302\250\310\003"
+	.string	"V#\237 #\235a\361\350g\354\035\2036k\260\030d\324+\006\031Y\2415\250\250\016\245X\375"
+	.string	"\361xO\030\025\r\257q5\262@\252\017H=\036\335\241z\364\2651\030d\264\341\306(\024\032\336\023\306\365H\fRC\004=H`B\210\301\006\023B\340\317\206\"\021\004#\"UD\016\221\272\036O\214\020\214\340r\3300$\364\260\246-\264a\030,\036\031}\206$\bp\f\022\016Q@]\205\353\261F]\205@F\0278!\264\016\t\325\017\216 r~\353P]\325\0177\252Q\004`\260H\201U=\252!\202\214&\350!\321\250\026\325 \334\031hp\201\006\033\230\360\365\006\034`\300\001\006io\300\301\317\017\007\032\374\340\326\340\307\222 \fASB\375\320\303 !\221]\203\307\013\250D\304\025\257-\264\022\213 Vb\221x\215\253\b\303\342\021\005\200\204j\210 !\b\021"
+	.string	"\tU\343m\241\rFu\b\250(\374@g-\222\370cp\250\206\360\300P8bhH\350\201\002q5\241\336\365\030$\032\215@B\375\020\004!\302\b?uX\024\256\307\"\021\257A\013\200\270E\242\b\305\3430%\032\035\3551\350\201\003\210\237\007\016 h\322!\007\242=\032\341s4\252%\210F \013\307 \b9Fu=\n\211R\237ZB84\302\221\021\021>\n\342c\360\303\361h\304O\r\252F'D\034\217F\320\370J\250@\307\243\021\251\032\004\256B\253\220("
+	.ascii	"D~\f\006\215H\350\230 \032W!\bk\221\021\030"
+	.string	"$\024A\\ML`-\202(\022\205\025\030**\222@\260w\f\226P?\004\t\211\360\261\347\341\203\007AB\242\364\303\220\270\252\305\265\2050\254-\264\241\210\210\250hx\200\243 \005\017\210\212\326\343\321P\347\030\f\"\222(\026y\300)\022\207\206*PQ%*\006\021\207\2047\252QH\002\220Q(d\243\032\235X\217G#\200\307\243j\004\002\022\006\207\034\2108kp\203\265H<\362\251Cb\t\025\bX<\016\203D\243c0HH\364[\203AB\021ED_\220P\304jtd4\252k\221h\263\222P\201,\264\320\006\f]d\244\032}\326\242\"\243\317\017H]\325!#\242\"\017\305\"\342*4\216 \016\t\207\021\034\00504Td\274B\303\225h\324#Ax\302\036\325\243!a\211\364(x$\"\032E\034\207D\"a\361\304\207U(\2108D\242\302\032\324\340g-\022}\375\363\343!\303\005B\250"
+	.ascii	"\036n8\036\205FDEC\237\243\261\350XT\217>E\242\220\310gh<\372"
+	.ascii	"l\270@\202\320h\213\214\252\006\202\204D\276\247\355\272fRXV"
+	.ascii	"A\254\325\017\312\2202mbW\307M\031\2661^\200|\330\213}\205=\303"
+	.ascii	"~\312'\306$\265\004\363\341C\232\262\330\276\354\225\031\214"
+	.ascii	"\024F\376\204\253h\220\274\022\256\327\2430\233k\201v\177p)\215"
+	.ascii	"\375\310\361\227G\363\270>\332*s\325\021-\232+:\035l=\372\372"
+	.ascii	"\370\371\270[{\376\275\\\235\366\326v\246\352\232\340\303s\233"
+	.ascii	"\352\272&\334\255\271\250\227\017\2606\265/X\256\326w\335\261"
+	.ascii	"/\250\225\277\r\214\312\312\272:v\232\026\313\032\0276/\0335"
+	.ascii	"(dq7G_\035\316\265E\006\227\277\027G\247\225I"
+	.ascii	"zC\342s=+0[\334"
+	.string	"\260\272\261l\227\017\311-v\270\244\320A\341\345\314\344\271`V\230\324x\340\206\352\033\343B\335+[\305\237\231\331\264rX\262\3245\311K&\317O\310\n!R\236F\337\253\27668t\3509\257\256*\311\277\267F_+\346[\222:\347\265\352\246\251\341\2621\366\243\t\367\005x\b\224\223\323\337\333\354\271\271\245.\177\003\203\033\2502\261D\307\002\2352J\251\021\231\221$I:b\n\020\204\302Y\036\2101>\022@\025E\215*\310\206F\222$\2054\007_\234{J\335 bd\037&\302z\3547\033P\031\023\354BYz\337\353VG\t\226;8g{a\320i\t^\342&\323\310\366\260\310\253\024v\314\214N\202\035\241\202\345\177\250\326\365\341r6FZ\362sxD\273\020&NW,\220(\\R\017\017nV\016\020F\b\347\006\2571F\340X\360?2Dx\031\346X\371j\300\307p\260\207\320\017\016\306q"
+	.string	"\262\013\206\215aRR\335>\311\nd\354I\004m+\235w\255\355\272\312HR\312\212C\374\007-m]\212b\347@+\241\372\230\373\244\357\244\354\226\316\035P1\333\002\265\035E\006m\315\262\217\353\352\277\232D\202LE\246\230\307\035\021u\241\244\032\211;L\0353\234$N\245\200Ym3>\362.\271BY\344\3262\013\304,\177T\210\233\301\t'\331{\350\250=&YzW'\026\354\376_(\022\025\241<\313^\227`\337\365\b\244\243!v#\3720?\215\357R\341\342yM'\224~q\316\030\241A\016\001r\314\266\254\006S\340o"
+	.string	"\320\233k\356`\265\305ja\003\205?Yi"
+	.string	"\221\270-O\351lpE-\033\003jv\245+\252=\222\230\346/R\007\030\233\323K!;m\027\007-IoNRg\331\327)\374\321Hl\271/-\324\314\202\220\366\241u\220D\3178D\276WU\213\352 \312\263L\025:\024\335#\233\353:\317\362Y\202\327N\023\201\322\250\236\263\234@o\004\211,\233SN\227\326\311\260\377Q\300\256b\300nx),\210\302!?\224\033\262\243\246eB\337\217\265\030\261*\324\373j\350\225\200\221r\251\312\033\306\215\223\333\025\022\241o\231\001\232\0326\272\223\272\213\255\036\347\314=\246*\215\253\373\316Y"
+	.string	"\213\374a\310/\213\214\262\n\027\232-\214\256\b0R\370I`x\263rb{\f`Y\253\373i\006G\273\2535re\002\352\326\277M\007\016@P\231\212x:\256$\231{\256\2726I\022q\017\326\025O\007\024\271u8\t\213z\222!l\300\255\270\342\357J\302\031\035\302\261uZ\356\224\312%\373T\375\243\253\244\224\214Xg\226\263w\f:\023hf5m\340*\275\237<d\371\271\326\346\221,\321\275\246\360\243\360\016\n\312Q\030\002\024\342\004\020\232\031["
+	.ascii	"\351\310Z\355\030\3024\313\2414\277v7Hr\025R\027EI\032/\026<"
+	.ascii	"\300\231\330\362\376Do35P\327\300>\335b?\242\f\f\255\252\211"
+	.ascii	"#\366\026\226p\242\377\305<|\352\t\305T\331\"\321\027:\371 \322"
+	.ascii	"\346D\310\202\253\315g\230\003\013j]\247\261DAn>\024\ri\034w"
+	.ascii	"\240\312\304y]M1Uf[P\267@"
+	.string	"geA\202H\030K\206\345W\b\240adI\310\036my\347\341\347\203\301\322N@\f\211\334\342vD\212E\t8K\374\320\3569\265\226\204\325\333\322i\2144\237\201\223\327\240}.\342\220\332\271\217\366\306\303!*\360H\225\244K\261'\233\n\031\352KZN3\230\027a\213\264\001\331\016\313F\340'+\317\302\\\321\034\307\312\342/\024\017D$\255\236@\305\032\330\360\271\0326\030\310\311G\030\200\224\250\232x\003\206\267\t\362\347c?\362\375X4yaQ\376\260\255c<\334\336\263\236Gt6\357V\361x\344\245\036\362\332\375-\021\227,\242\001`\026]\301\031#\001Jn\327\337D\t\037Y\005D\017\376\002\f;\320\340\307#zD\002^&q\2259\037D?\343\205\330\250IZi>\275?\0067\220\343\037C\021\230\301\302q\361\341:\324\b~i! \363A\371\035\275\301\354u\224\232\331R \212\330Y\235"
+	.string	"\201\372X\031WB\347\327\232Q\2176$m\316\020\257\266A\232\2123r\317\230\224\356\357@H@\235\250D\333oG[\020=\034\"\023`\304\3718W@C\262\317\025\024zp\320d\205\0220\305\242g\310\276"
+	.string	"\243m'1\311o\005\341#hP\275aF\245PU\207i\370C\276\027f\007\242\316\202\234.\326h\300\377\035\232\255\344\036\177\357\031\340\036\363\301v\212<\311\373\230\240\377\372\016Y\"\216k/\253\2656\003y'\352`\316>\354\265\322\350\241\343\006\352\244i\236P\n\024\220\376i\200_lF\266\375w\021\360@V\224.\262\205\272\\\025<\322\301\331Q\020M\206WU\332+V\313\320]\344*\210<R\315\367\266\211\005"
+	.string	"tWp\312\017l\226\334\2654\300X\262g\\+\326\377\270v\231\026\2645w\272\320!T=d\274\013S\343L\200\312\320\320\236e\232i\301\351;\233M\220\253\275\3247\333\027\310\263r\0367_m\365W8\027\001\272\036L[\345\301\001\345@\"Z\216ln\\l\356\270\022\321\327\"Q\032\206\002>\301\226\351H+!C\221\202\n;Qi\231e\246\373\r!\262\032(K\376X6G\030\224\204\002\220\002r\206I\251\220\335\250\023)@\001\207:\325h\343Vf\304\366"
+	.string	"\340T\247C\030\325\016\003D\021\031~\031\202A\331\340,\032\322\270\274\030D\342\361\220<\024-\230\360\341\002\226\031\354\347\372}1OfF}\332k\267\332\210J\315\\@\206\037\311\201\270\340sL\301\341\375\036f\310\245H\261\231b#g\250O\355,\214p\301\177\3745\002\215x\301\272iZ\310\352\275L\254 T$n\216Hlb\347\336\024UE\r\334'\301\306 \364\b\307D\245\304D\271\034J\2076L\277\320e_\te\r\267\312^}\347\025\250\343$\021\310\314Y(\\\005\376\202\330\314\350\234\007\320\363k\376Oi\204\317\275=\377]\257\236=\217S\332\306\226\276G\343\256\362"
+	.string	"\264\017\254\375\346I\271\353\035\353\017\007\371{\004>\0379\3722\340\375\204;\300\024\341oi\220\260-\331\021\300\313\013\217\313L\275'\346\304\020w\376\241\321\374{\215\232S\234R\357C\302\033\362\255"
+	.ascii	"\272)\362,\315%'\311\325\206c\203\002\330\n"
+	.text
+	.section	.gnu.lto_.symtab.3256221e7bdb6b8f,"e",@progbits
+	.string	"pgResetFn_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"compassConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3256221e7bdb6b8f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,872 @@
+	.file	"current.c"
+	.section	.gnu.lto_.profile.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\235\006"
+	.string	"d\tB\001"
+	.string	"\026"
+	.string	"\326\214\251\333\n\n\002"
+	.string	"\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\246\201\307\205\t\006\002\003\267\235\363\261\017\002\002\003\002\004\004\006\007\250\335\362\322\004\004\002"
+	.string	"\002\005\b\260\355\222\212\002\022\005\003\002\003\002\006\002\007\013\233\346\244\226\006"
+	.string	"\f\242\233\362\205\b\020\002\b\002\t\006\n\002\013"
+	.string	"\002\013\r\016\270\272\250\266\013\017\215\232\327\322\003\030\020\315\232\225\331\016\021\022\340\207\245\357\f\023\262\235\221\362\004\024\025\026\253\327\227\253\013\027\231\366\331l\030\367\343\320\264\b"
+	.string	"\031"
+	.string	")\"\324\334\017\2615\355s\350\203\001+\004\332(\f\317\276\304\241\221\235\f\b\260\312kb:\354\326\316\324"
+	.ascii	"{@\310\340bfg\236\322\330\243\304\007\224\375\313\rvy\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375 d\365\001"
+	.string	"\024\002X"
+	.string	"\t"
+	.string	"\001\001\002\003"
+	.string	"\001\001\007\001\001\b"
+	.string	"\001\013\f\004\001\016\017\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\013"
+	.ascii	"6\t\026j .\207\254\n\353\214\241\022cf`\232w\250\f~\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`E\001\255\t"
+	.string	"B\01722`k\323\030\300\203\205\301\217\241a\b\b\213\017\016\002\037\r\035\251nV\247&\240\213\253u\223\300\224\001\257\002"
+	.ascii	"g\251\037\007\342\020m\374~k[J\231\002o]\360G}\304\235\216\222"
+	.ascii	"\013\r\031\007\305\222\243\343\001\202\340W}\276\212\222\030"
+	.ascii	"\233\b\215\376&\277+5>\235\t\367\304\362\022-2*p\312\355\007"
+	.ascii	"\300,\2322a\210!\263\361\221,\020\360\357v\031\265\253vW\272"
+	.ascii	"\251\344\354n\001\224\210\217\024(\345\206\225H\312\r\335Z1X"
+	.ascii	"R\330]\313s\216h\271\351`<\022M5\035\214\207\372a\351\240\037"
+	.ascii	"\217\277\276u\231\334\326eIs\327\242|EP\211\335\035X/\335\335"
+	.ascii	"\325\214\316\023\362\330#\0373\275\330\335\367\220\363 . `\002"
+	.ascii	"!D\326\016\013\032o[py\025\3720\032\020S\330\332\256\210\222"
+	.ascii	"a\215\357f\322-\333c_\304\352\355\300x\023r\236\360\2700\260"
+	.ascii	"\b \2464\211\300\267\375\310\345\313\025f\237\003\213#;\346:"
+	.ascii	"\025`\321\324\bNbD\007\267?[\327\020\220XV\240\033^\374\341\255"
+	.ascii	"`\277T\321\316\356N\333pj\230B\302hUsn"
+	.text
+	.section	.gnu.lto_.jmpfuncs.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"\005\005"
+	.string	"R\210\033&\2205I\007\227/\216\330\263\217\325\027\375\252\177\265\037K\241\231\325\335\336\217-\365\002\333Z7{\370\237\250Md\222\001$\257\177\326\366\f=\345\253$\314\3521\275\243\177[k9\207\302\200Y\300e\006\250\222'\356\220\177\334\271X\232\024\300\016\201\b\364\220\212(\032h<\017\003Q\273\033\365\215\352tj\0207h&MF\246\266\227\236\004n\001\024"
+	.string	"\"F\326\025\006\323\235\202v@`\200\t\324)q\231\303L\313\031\016g\020J\r.\207|"
+	.ascii	"\027\361\031\005.\036%\030V\205\2542d\001\334"
+	.text
+	.section	.gnu.lto_.pureconst.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\002\232\004\003\230\004\007\230\004\b\232\004\013\230"
+	.ascii	"\004\f\232\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"\325\004"
+	.string	"\222\006\025\037\220+\303\001\377\277\242\372\377\217\375_\235\276\353\246qR\256\353\272v\376P\331\337\265\277eJ\001b2\232K@}\210\303\324d+\231G\346\220\315\307\320\223\036\001\006K\301\261ml\372@\306v\013\220\343\274\330H\227k\352\242\350\256\342\304V\355\315\022Lz%\036"
+	.string	" \013\311\030\254\241!\300\0216\001@\034\036&@\\\315\013\260\213E+b\366~\300\210\341\002 \\\024\024\236\020\024h\222D\303Zp\322\262e\265\004\n\253\200"
+	.string	">=0j\022\304m\t\376\022\310"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.846daf7dce8d2b23,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterSourceNames.23.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375 \344\025\006"
+	.string	"\244\n\217"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\257\001}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'1\270\257\005}\276\003\005\001'6\206\b{\by\301\002\005\001'?\b}\304'D\206\bw\bu\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004ESC"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"gH\315\323\216\253\266\346\231\007\310\334g\326\001j\277\001"
+	.ascii	"\024\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.26.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\315\b"
+	.string	"FP<8@o\323\001XPvq\300\214\307\230\t\247\032!\031\233\320\004R\\\025gh\275\224}\315\016\365oWH\032\350\3540\214\016d\177\344\216\r\201]\3215W\372\264\355\336)\005)"
+	.string	","
+	.string	"-"
+	.string	"\237\366\354\230\207\340\236\004\2740A\355.\225\033\367\036=\377!\007\020\215@\217\233\206\335u\024\2152ny\333\007\266\027\354_\001~\351\217U\345\002S\200\262\213\221\232\331\323\\\351\270l?\332\3778\210\367\322\347\002\273_K\312n\250\340\004\353\323\341\t\252O\353\003U,$\317K6\036&\024\302m\211\217LX\273\313\340\213PT\004\200\034\237\376\247\372\234*&\222L(\246\354\020\024\245\206}\315\356\256\345\3475\353\262\3164\306\351\264\254V\017F\271\272qZ\306Q\r\342\241C\261\312Q\216\201\267\210\254\322n\333*\275\302\275f\345g\207\227SHZp?\t\017"
+	.ascii	"2\241c\034\030\027\006\\\003\016\242`1(\306Q\224h*l\310\004V"
+	.ascii	"0\357\022@\263\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.31.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375 \241\275\004"
+	.string	"\224\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\201\027\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\334\030us\347\007uq"
+	.string	"\005\001\006'\001\004\005\001\006\035\001'\001\200\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"\236\n\013f\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.33.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375 &\025\001"
+	.string	"\320\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.37.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375 \223U\004"
+	.string	"\304\007\\"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\356\241\033\007yw\250\366\006yu"
+	.string	"\005\001\006'\001\004\005\001\006\035\001\001\201\0028sq\301\001o\300\001m\277\001k\276\001i\275\001g\274\001e\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.string	"B\b\354\345\006\320$d"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.41.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\235\013"
+	.string	"\026\226N>\020Q\225\016+8\264,\302\313\232\241f\354\340g!\230\001`\316\357\316\004\364\204B\t\267\223\333\320\200>0\222+\025A`\261[Q\004\262\b\342\220\234 \374D\005\317:\332\032\333&R\246\024;"
+	.string	"6"
+	.string	"?"
+	.string	"\371\364%\022\226\213\0024v1\2046\266\025Y l\177b\217\035\343\240i\257\3220R\325\330]L=\334\363\364\370\027\361\310G\372<9\024\354\256\363#e\270\365\266)\266+\366-\004w\213G\345?\035\354:L\273\336?\037\365\324\346\177x4\205.\377=\372\335\343\321\356T\310\177N\023\251\226H?6\bJ\355`\377Z-\331\232\216\232\2764\255\231\016\341\f\033\002&\377E%pA?V\365\352\033\f\t\355z\224K/b\001\312\320\251\252\006D2\256\251\037\335\260\263\2534\310n\b\201O\342%\"d4\232\307\343\365\300\213\025!P^\206\216$\200\316,\234\215\306q\235\f\353\270\255\333h\035\266\311`$`\031\327a\226\001\336&h\034\306\3316\016\233\200\336\257\325\322\002\025-OA\026\220Q\177z\212\013\344\304Q0hp\2718x\020 \275:\007\030#\300\004a\026"
+	.ascii	"3\241\005)\360+z\027\310\004\f\004\311\240{i\226\005\3420\225"
+	.ascii	"\211\244\222q\003W\246\233\313\232R\255\0050B\\\345\343\232\310"
+	.ascii	"6\004\3752\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.42.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\345\b"
+	.string	"\266\220>90%\2511\200\003\250\311W2\263\204\241\020e\365^?.k+Z\214\006@\024F\332\245\344\017\331wr\255\275\3050\307 \r\252<\276\251\353\261\020S\350\226\261&\367\226)\005*"
+	.string	","
+	.string	"0"
+	.string	"\004\035\313\206m\216[\"\267kd\303\005\373?\263\020\207\216a\355\025{R\252\223c"
+	.string	"\304\377\306\224j\345fn\233\320\366\241-N\326\376\277\031\253\325\266\016\032\005\233\237#\026\340/)S\262\265ul\215\342\224\320*\246z\376\017\230\230\377\re\020\260DpA\307Rs\250L\343\363\213\313cRs\262\340\226d\027\223\301\315\177\207\232\305-\0305\211e3J\321)\313\272\324\261\334V30"
+	.string	"\250\030k[\247\230\201\264\001`\004\007\202(F\023\340\007\262\030h\350\003\2128\317#\205\346\347u\237\210\373\246\250\002t1C\3367?\007\355F\2347\301\256\363\346\326\272\265g\254Jx\274\002\f"
+	.string	"2\241\343/0.\f\270\003\214\333\224$3\225\200"
+	.ascii	"\363.\001\020\253)\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.43.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`M\002\025\021"
+	.string	"&\337lE\360\322$\0352\343\363\374\253]QC\330{g&O\266\217\206\367g:\374\263\327\205\306b\276:p\033\217\215\n\302[\024l<\2260\321\3348\255"
+	.string	"\037\213\n\364\214U\321y\203\251\"77k\203\265\266\367\2262\245W"
+	.string	"R"
+	.string	"_"
+	.string	"\033\033\261\b\352\320\261\207\304C\324\r\304C\267\354\034\217\355\354\203X\324\004\355\330\335LA\274\365\b\237f\313?\225\354\356}\016\240s\305<\342\034n\320\220\357\346\372\024\344\020\335\bp\321\274\220\243\017J\367yrp\315d\236Jv\327\331\271l\356\323m\257\330^`\347+$\376\211\377d\360y\016\315z\311w\207\376K<\274\202\330 \301zd\262\311\216\305\244\276\354\277\335]\253\216\375\236?\300K\307\227\206\232~\231\326Lg\246O E\342H\204i\267C\223\2175\2022D\244l?\355\227\270\211\326{`^`Wg\b\306\006!\272\034#\325\227\023\374$>\255"
+	.string	"\204\203&{\330\237q\032'>\217%\240\344;\224x\370\024\376,\301<\250\332\023\036\203\302_l\r\222\234r\027\253\221\244\303\026\252\003l\224`\251\266\366\025\271d\341*R\244\246F \361\270\332*G\021ta\005d\207\007&\036jQ\247\303,\007\332P\273\033\234\346\242\261@\257T.-\032\307\275\2542\026\267\261Z4V\326\242\222\302\222\2558V\246B\340\r\203\306e.\333\306e\251\330\376\255\352\330\001\314HFgbT\275\210(B}\371B\177z"
+	.string	"\207\351A\265\375\032\037z@\302\300\267\361\033\020\"\230\230\304\303\274\205:\035POE5?d\262\351\0170 \260\002\021\241\264\003C\241\213\213\341\021\352\336\315\314\226+\2263\003\033"
+	.ascii	"\303.\215\223\214\347\267\240\024\336*\342K\b&\352\201%M\256"
+	.ascii	"\024\213\355\034$$\203\207\341\254\207?0\017\n\300@\345\305\031"
+	.ascii	"\276!\026[\302\204\375\244\3707\302\267B\226\r\204Q\222\256-"
+	.ascii	"\330S\304\220\337\335`\326\035V\263\030m\\Mqg\0213\246\024\013"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.45.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\325\006"
+	.string	"r\r02`M\323\001\300.\205\203\254\373"
+	.string	"3\004\250\3114\340\341\n\004\347\n%\326\261\204\217\035\320\354E\360\327N\tR\206\004K\262"
+	.string	"[\242\363\216\272{H\231R\216 \313$Ax\211^\005\251j\222\2527)$,\274\bV\017*0\305 \301g\241(\370\036m\257\032\204\222\r\243\020vr\340\376p*\277\3065\213 \333\305<\372\033\347\270\370\027wn\260\362\361\316\267\234;\333\341!\037\235\035 [\204b\266\206\245V\330\007X\325\330\372\220\204@&\273\023)(\2739\017\f\333\177|\331#\327\262\375FDbs\262\273O-~=/\377\031\027\210\031\354\031p\260\273\316\230\241\270\365\266\rlWlg\001\b"
+	.ascii	"3\001g8\203\004\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.46.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\036\004\335\033"
+	.string	"\3662\262J\240\230Q:\301\352\365R`\342F\222'\001\206\257\200_\214=\204\025p\002z\367\035\316'C?@N\336\336\370_'LQ;Pf)\345\207\261\032-\360\r\270\366\205A\377\222f\274\220\f\305\245\021\367\352\231m\204\020\"wJ\001\227"
+	.string	"\216"
+	.string	"\243"
+	.string	"<<\256\024\364$\343$\271\\\264\203l\227\213\324\305F\272\2050u\027\003*G\207\320\201\005\\\\\221\260\324n\360"
+	.ascii	"w\240\020\354V\240r@\325\n\\\340\b\254\213>\265\237\343G\270"
+	.ascii	"\377nn\325\n\203\210\217Z\353\002+`]4\360\001\343\305\3602\343"
+	.ascii	"E\343\354)\007\372\352\203XJ\004\257\324Zc;\343\270\217b\270"
+	.ascii	"\024\347\223\023Z\274\336\320GW\217\305\305\025\017I0\355\350"
+	.ascii	"\276\364\316\320@\255\365\301S\023=\035\245\344\204Z\253)\257"
+	.ascii	"\227\342&o\273\307\266i\207\017\002b\270\205G\365\245+6\225\260"
+	.ascii	"\362\207;\365\260j\335A\360\233\336#\204O\343\242}Jz^9^\374:"
+	.ascii	"Pbu\343\227\243W6PG\267\310~XW\206mH\352\032\222\032FR\323\374"
+	.ascii	"\367\023X\352\031\222Z\346Kw\314\221~\001\327\361\303\034\370"
+	.ascii	"\007X\352\327\221n\327R\267\226\232\265\324\344R\217#\265\270"
+	.ascii	"\324"
+	.string	"\341R\357RS\221\3727//\222\304\242j=q\245\245J\211@j|\351\366\223|\246%?\261\206P\260x\314\340M\325Z\023\\tN\254$W\222\243\2433^\224\331+\235\036\251\360\021\035\375\242n,$\255\r\222T5n\221\317\364\326T\224U\230\340\016W\300\272\326\204\3152rCP\344<\252\231\245\313Z\361\310ID>!wfo\230\2348b\226\224r\032\211;.\271\205\303\241:\f\0217\302\216`\325/\027n\314^\312I\324\340~\032w\303\265\t\2368\\\353\332\335[\331\030r\032\351\350\225\270E\017W\206\220\303\354\213\026Yh\255uh/4\006XX\013+;\242\354(\026\323\265=<\310\255\300\223Z+\004\377\307\201\310f4\332\370\265\322\234\311,\2304\033\017O\206\027\240\322\304\251\225f\211a\347\207BPy\201&\3024\313\032\b\223f\207\346S\223\211&\005\232)\333\001\322`\332d\""
+	.ascii	"x\306\300\374\241\325j#f1[\255\264\375"
+	.string	"\320l\261\237\036\231OlV\263\305\030\334\270\004\242\325bfY\326b.\300\334\303\007_\201\212T\325Tnu\266\301y\224\333\313\007%G\307f7\370\242N$5\353\304N/_\023Z\205G\005[\231\255Y\261\351$\3229\375G\205I\252Z\302\325\225\322\256\326\334\001\232\205\355O\243\327\322l\315\3239E`[\373Z\362\310i\244S\262\206/qQ\250Q(E\225Q\b\ndF\202\314\322\302\214\001p\002\2212\253\016\020pFCI\306b[\326Z\211=M*\210\345M\260\202\307\020\206\021 q\371\263y\031Y\223\377\006uu\373P\267*>\250\277\035\351\254f\221(\270\3075\253\310\311I\255\032\205i\215\263\315\r\305\231\247\203\241\\\207\bT\003/cj2C\026\372\220G#\346LS\201Ax\304(I6\f\3706\002\220\205A\2246\245_x)\036\023q;:\314\215+@\224\362\222\345\332\001\312/"
+	.ascii	"\331\2248\305O\304V\256\342]\325+\264\251\n\201NP,\272cM\031"
+	.ascii	"'>\267\235\360\007"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.47.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\005\013"
+	.string	"F\024JA0\307(\035\220\313\313!\3373n\316\237\344\357\325^\374\354\352:\004\254\220\201r\306\215\251X\206B\204h\r{\036\342\177\320\312\206g\b*\002N\r\300h#z\207\201\004\311\005\360\345\223\310m\367N)4"
+	.string	"6"
+	.string	":"
+	.string	"\226\320N=\376!;\325\356\220\235\032\264\035|L\355\001\234\220\260 \354n\235)\007/A\377/W\bO\245\313\004\214\335\265\fO&\367\274\355\b\333\024\366E\002+\321$c\366X\222\023\305\276fw\327\023e_\3745RZJ\351k\013+\f,\f\354\226\304\"\354\213\"P\331\330\276\264\337r\027\360\"\351\r\273(\005\007v\307\211\003<\025v*@N\006Wk%v<\200\306j\301\247\375\371\f\013\244\343\244T\244\354t&\b\037\370\3432\237\266\273\025>\314cD\276\352\324!#\371\360\324\037e\247\237\034W\201\036\027\342>\324['\004\342<O\264\325\317\353>\020\367U\220g\343S7\357\253\035\bw\036\234WC]\347\325\315\270\327\354D9\203\345e\232#\226\323\336\336\222\r\270\023\370.`\346x\025"
+	.ascii	"2\241Q/0<\250^\320\206\260\007\017&\233\n\201\020\260<\310\r"
+	.ascii	"\336q\024\035La\243\224\364j\202=\0251\244\272\273`\324%\254"
+	.ascii	"f5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_currentMeterRead.48.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\252\003M\030"
+	.string	"F\252\226H\260\222NcX{{f\233JnWZI\254\004"
+	.string	"\260\211\332\204Cp<\304A\346$\177\203eq\n\241m{\013\310\330\t\206\311d\022\370\273\241\346F\222\031\352\211\341\262\005O\357|\204\220\207\307\033\244\311\336[n)S\n}"
+	.string	"y"
+	.string	"\206"
+	.string	"\326\304\363\324\376\322\231~o\312\361\355\336 -\252{\211'fp\336\"xIyK~@y\353\237}vb\321\275q\253'j\355\336\233\253+\376\373i\226\226\254\364\347\027_\"\243\030F\343G\347\347\245NQ\214-)\231\007\n_\366\204\240\326$\bHx\362`$\204F\036ZI\005\303\255\022\001~@\220%_Be/\236\212\370\331\241\324\214p\3575\r\376"
+	.string	"\335\267\333\026\332n`W\253M@z<\213\340\320\253V\242\221\347\224\257\177\202\341\004$\214\214\207\016\261\211;\264\022\331\257\307\343\361\350:d[j\234I=RR\337J\352\263\2446-\265\375\323_\337\364\237\300\221\320\326~\254\370\270w\304\261\355zY\253\026\266\357\317\270\321\346PN\3206Lac\343\242.us(\0270z1\\\272\367\342n\355\033\033wKq\266)\361N\277?\341\234\344\336\241\266\334\371\017\373\016\n+,,\345-\275\261\312\333\007\323l5\271z\212<8A\304\2074yK9R5\024\257\343]-\276\221+\270\320\007]\312\333\221j\237\314\224\204\267\227oYx\016\036\004\243/\034\007\206\223\261[\255[\025"
+	.ascii	"T\246t\302<\213\232\305\374\306\325Yq.\304\330\232\254{\025\017"
+	.ascii	"@\021\325\207\235o\204S\336V\256`\332\215\336p\033\274\363\336"
+	.ascii	"\233\342\327\370\024\007\337\350\3262=\372`\257\2745+\231\211"
+	.ascii	"\244!S\276]\315N\306f\340Q\353Pjfv>\237\007]\216\306\327\243"
+	.ascii	"\231\331\321\344fx129\235\217&\207b\300\275\016;_\256\246\327"
+	.ascii	"\363\345pD\340\311[\274\n\022\032\033\032\260\356\220\367\336"
+	.ascii	"{\276\034\315Ve%\351~f\"a\255\251-\370\245\f\363\262#\237\242"
+	.ascii	"\341\222\032\220\036\337\265\3034e\036\240\265\332*\022\350\203"
+	.ascii	"&\253\216\323\322\204\256\312Jd\252\342Iz\304\240UA\276TX\034"
+	.ascii	"\312\307\304p\365B\216\272z\212\330z\260\363\230\220\342\300"
+	.ascii	"\001O\250q,\344\f\223\346F&hJ\n\222t\220\002\221\301b\007\021"
+	.ascii	"`\27163\263\205\225cb\302==\266\2742L\327\340$\274\\\352\216"
+	.ascii	"\224yAs\310\320\266\320\033\344Pz\013I\317\221x\202F\377n\275"
+	.ascii	"l\356\221\350\246P\336\300\374v\215\340p*6\021%\372_\211\006"
+	.ascii	"\253h}IKN1QVz\253\374\212\004\265\364\356\240G\246\026;P0\322"
+	.ascii	"\343\250E\365\302s;\027\360N\030\316\n\005in\241\036\005\226"
+	.ascii	"\251\361W0\362\260\261\004\202\220.\316\307o\227H\200\035\177"
+	.ascii	"\201Rj\362j\240Lr\253\342\364\374^\252\216\206I\314\250\001"
+	.text
+	.section	.gnu.lto_currentMeterRead.part.0.59.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\360\001u\020"
+	.string	"F]gG"
+	.string	"\261&\035 \023\354\271\"\\\261f\353>\030\220\001\277\226c\224\336/\370P\310\375\310o?\375<f7\017[\221\276\206\206m\300\230\246&\233v\302\034\252j\373\250(Cq\304-\360\244X\326\005\204"
+	.string	"\251\265M\344N)O"
+	.string	"R"
+	.string	"Q"
+	.string	"\001vW\200lv\307\004\237F\240}z|H\350S;H\350\323\376\n\333\251\024\213\366\215\217-\373\031\235\017.\035\273\313}\352\211\213W\231\211\376\353!\257\016\327\307\016R\023c\203\006\204\210K\001\317D\017v\327\332\210{\336\266\003\333\013l\271!\341\213\307N\207\371"
+	.string	"k\245\262\273'\3733\247\2617\227\034f\002,\025+\026\273\273\225\250\337\"\345\277\274\331\276L\352.\023\031aU$D>\2551w!\336eb\217]\0239\n\264O\003\331f)?\246\016\203\0320n\210\024Ki\377\345-\3610\250\007,T\350SwNr<f\f\217\341i\273\313\300\2779N\006\237\365i\322'\177\362\205>\257\217]\372\250\364\254^Z*\031$\225\305\232=[]\261E\322\372\361\227\"\351k\"(\037\253]\224 \240-1oP\\\346\267\357\303\270Mx\2303\0349\001\027<\tv\246\2164=\0321\225:\020<\215\270\020\374\302R\027r%\217\204\304\215\300\220\033)\340OC\007r\246\357\003\271\355\257CH\361\263\343G\245\036\254\252,\266U\302y\244\017\205\357x\rb\256p\035\013\\\317g\r\325\017\234\032\227\026\311iLp\341\361\3503<"
+	.string	"-28t~1 \220\002\021\263\343\006"
+	.ascii	"\nPs\017\022\201tC\3723\246`x\234\330`\255\301\341T\201\006\314"
+	.ascii	"^nj\243t\216\002\202gkN\246\300\006\017C\270\033B\210<0\302\037"
+	.ascii	"\203\214\212\022\b+aJ'nS\320v\327\275,A\243T\366d\212\275\332"
+	.ascii	"\377H\372c\350f(\302\220\307\313\235\244\325nc\312\032\003\200"
+	.ascii	"\366F2\033dZz\302\033\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\025\001U\b"
+	.string	"d\013\021\002"
+	.string	""
+	.string	""
+	.string	"\002;\177\036\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005,\022\201\204\001\032\177\037\272\200\202)\177 \005(\020\0054!\033\016\200\003\002*\177\"+\177#5$6%\002-\177&.\177'\"(\002/\177)0\177*\377\377\377\377\003%+\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005#,!-setdata"
+	.string	""
+	.string	"\005\037.\034/\0350\0311\0302\0273\0013\1774\037"
+	.string	""
+	.string	"\200\200\200\0012\17751\1776\003\003\033$\003\003\032\304\001\003\003\031\344\001\003\013\033$\003\017"
+	.string	"\323\243\362\362"
+	.string	"\001\342\007"
+	.ascii	"% \260\002)2v\030\332\032\272\032$o\030X\017? l\271\0242\t\343"
+	.ascii	"\260\021\2010\2603\3462\006\316\370\031\357JH\354\024\270qlY"
+	.ascii	"\013\341\334O\034p\376(H\200\026\217H\201\207.\374\033\274\266"
+	.ascii	"\r\346m\360\302\2633\300\033\276k\350FM0\236"
+	.text
+	.section	.gnu.lto_.refs.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375 \2335\003"
+	.string	"\242\b\026\032\200\265I\00730\00330\0033P\304\343\343\267\265\247\337\324\255I\333D\246\024\016fXa\004\263,M\031\202\3268\364\224V\351\312\344\b&\300{x\227UY\223\027%5\357\311\200\341\017\331\204\026\241-\016%JMi\034W{]\314\342\314\021z\315\030k}\235\032\020\003"
+	.ascii	"\237\020\254\317@0\033\3142"
+	.text
+	.section	.gnu.lto_.decls.846daf7dce8d2b23,"e",@progbits
+	.string	"(\265/\375`\366'\305\257"
+	.ascii	"\252\025!=Z0JIH\351\256\224\020\0201\371\342\36007Xc\244\265"
+	.ascii	"\256xx:7\3013\343\270\211\b\212s\023\214\337V\263\226\003\257"
+	.ascii	"\266\025\3012\f\223\357y\265\346\250`\3428\207w\372\256\331\241"
+	.ascii	"*^\264\0252j\025i\232&)t\225\315\026\264\305e\227\220\224ZT\242"
+	.ascii	"\333F\332\336[\2461\003\316\003\335\003Bd&\352\302\226lf\315"
+	.ascii	"\234\221M\346\327\240\203\232\243\233\255\326Kc\266h\216lf[9"
+	.ascii	"#\177D`1/\224 \301\340\326co8\013\220\273\302\317\025\361o\034"
+	.ascii	"\374K\006\377Z\301\277O\234j\013\236\245T\031*@\234\244\352R"
+	.ascii	"C\261\331\221\244\336_!\256Ju\330\311\312\342\027\312\021\311"
+	.ascii	"c\2054\274\210\2058{B\234\267h\360-\030|K\2063\200\253\r\247"
+	.ascii	"\343\274\341\372\315\316\260\341n\316\302\356\013v\335\027\344"
+	.ascii	"\264\b\021&\317{\033\206o\223\340\017l\r|\333\002\037LM\257\351"
+	.ascii	"$\210f\363F\323\314\347\204\310\214\254XpSl\022~\2038m\\\\\203"
+	.ascii	"8_\333\260Oo8\353\330\026\374:\005\177\215\t"
+	.string	">\2637\234\257W\330\247\331\033\316Nk1\235\364\320-\\\203\016n\223\240\344\256\234\221=<q\270\342\274\251\367u\n\277=\234\035\327\036\316\327!\376\320\032N\017=H\032PW\365z\301\020\266\005\tV/\332\017\326\262a\324\341\206\277\301\223+]R\314\332\211Y\263\320_\273\234\234\253\304\264r\316]\232K\237u\262\315z\213\210\237\233\203\231\345\204\357{\f~o\301\177k\261MOGd\206\234-@\252|\351\302\322O\372\313z\021\261\024+!\314\306\322Q\372\212\365\"\346\300\260\n\222\245\313:\331XZ\354=\326dC\021?\271 X\274\254\316\373eo8w\272\013[\371\3319\2659K\326\373>\342\267\223)\027\353%Xk%\001\303l*\235\354\260\006{3\351\256_d\316`9\347o\360\003\275\303ZJ\177up\312\271\n\007\005P\276\230\2744s\316\"~D\350(\3218\262<\357\213\360M\300\177"
+	.string	"\276\002p#\333\253\223\327\322\312w\223v\362\234!2+s\316=\375cK\322\217z\017\204\337P>\2010\347\016\256\203=\220s\316\272\276\226\363\025\177\350\r\347m\r\347\221\275\341\304\255\341\354\225\375\275\242\036\340\347V\216\345=\277\325\360\260^\300\313:\004&\f\376:\342\024\374V\007.\004oA\307\224\277G\374<\315\337\007\370\333"
+	.ascii	"m\177\277\375-\201:\200z\301\337p\352\207\2779\374\r\246\n\340"
+	.ascii	"\257\273\032\200\352\241\002\377;<\fS\355\360[\020\374]\345\357"
+	.ascii	"\261\377\366\267V\177'\371{\311\337\\\177+\371\333\310\337H\376"
+	.ascii	"\336\372\273\253Z\360\367\361\357\"\177\023\251\025\374\367\371"
+	.ascii	"\255\221\377\\\376\233\375\357R\317\376F\363W\016\177\375\371"
+	.ascii	"\353\206\277J\360\327\f\177\365\371\257\373m\230\277\366\374"
+	.ascii	"\r\367w\363o\346\337k\177\247\375\375\345o.\177\223\375\375\344"
+	.ascii	"\357&\177\253\370\333\351o\246\277Y\374-\202\277C\360\367\007"
+	.ascii	"\376\366\300\337*\374\r\374\373\350o\243\277{\377K\370o\345\357"
+	.ascii	"\r\374\255\201\2773\3607\007\177w\360\367\t\177c\340?\332\337"
+	.ascii	"%\374m\201\377\312\277S\374M\201\277'\360\267\b\377\341\374\335"
+	.ascii	"\200\377$\374\315\200\277\023\360\267\007\177\223\370\033\001"
+	.ascii	"\177c\360\377\313\177/\377\263\374O\361?\001\377\317\376\357"
+	.ascii	"\342\342\342\342\376[\364\353\230\374\035\236\004#8,I\371\240"
+	.ascii	"\201\006Me\342\234b\354\rmk\307\351\310\2140n\257\314\\\332\221"
+	.ascii	"!9B\314\306V\333:\310oh[\272!A\340\270p\341\265\r31\230J\006"
+	.ascii	"L-s\346\334\310c\0241\033\211!\376\272\366Z\246\252-\325\334"
+	.ascii	"\252\227\372\345u\371e\035\203\223r\346p\003i4\206\320Y\322\302"
+	.ascii	"\2237\265\3271?\263\223sW\316\271\303\031\326\364\341\245\336"
+	.ascii	"\332BM\336+\345\031\246z\357V\305\374\317\321\261B*-\305\324"
+	.ascii	"\264,2iL\320r\342\334\222h\2517Y\303\364\226\223K\023\035i`\360"
+	.ascii	"\261\024\374\327\377\314Bb\316\031F\016\231\211J;\347\337\357"
+	.ascii	"\\w\210\237\247m\017\340\377\3159\304\br\026J\331b\203\215\210"
+	.ascii	"\to|\310\271e\316\303\252$\007T\025\207URM\312\252\2344\034\222"
+	.ascii	"\224\201\230\253\222\232\2249g\310\303a\022\212c\316\320\244"
+	.ascii	"\314\305\314\"\255\330\031Y\225\224\207\307\234!\017\263\360"
+	.ascii	"C\323\260\252\330\244\024\02634)\253\212YY\225}\362PHt\032fb"
+	.ascii	"\206\254\254J\223\225\307\242O\223\362XlRV\371\350+NVN`D\331"
+	.ascii	"\332\361\324TM\303\374\002jJH\364Y6!\217y-\347\006[\312\304\001"
+	.ascii	"\344<u$\256\t\245zLi\371B\251\212\360\330\034\240\224\254\216"
+	.ascii	"y\270l:r\314\371\210\322\212\f\305A\022r\231\177\3642\351j*?"
+	.ascii	"-\345\\\001T\316I\235\2279\347\244\234\263\2168\205\314\331\206"
+	.ascii	"O\223\026\024T\316\306\037\250<\225D\266\224s\00533VlRZ\035\201"
+	.ascii	"\310\242(\2652\0232\251\265\362Z\025\021+\223\274\362\323\032"
+	.ascii	"\254U\214\241f\347FL\324[\275H\235\261\034Sdp\371\261e\342\f"
+	.ascii	"1\013\274\345\272\251!\025\305M\313;Y\265T\261\223H\201\035l"
+	.ascii	"L\034W\004K\031\032\331;Y\311jY\256)\013\215|(3\216\350\267-"
+	.ascii	"\311\266z\261T\341Yf9#\374\302\327i\215\211\205icFJ\275\365J"
+	.ascii	"m\341\002\216I\275\327\311P*k\025\333\224\205U\031(\321zCkf\""
+	.ascii	"qD\230\005\3108\2212#\345bfM\264\300\352\327\305\202\234d\220"
+	.ascii	"m\272\250\324)\235\254`5\nX\016\027\325\326\322y\177V\301?\221"
+	.ascii	"\370\347\022\3743\210W\205\2223\223\365\303H\275?ox!\257\\$\025"
+	.ascii	"#d\2368\341iS\242\306\243\336&\265\253\223\325IeR\2219+\231\\"
+	.ascii	"\355f\221c\230)\271\304I]R\221\354\204>y\250\304\245%B\204.\256"
+	.ascii	"\b\0131\347}.\016~\256\211\237K\263\005\002\017\313\302\272\224"
+	.ascii	"$Q\301htR\357k\022$}\244`\027\343k\313F\275\265H5\322I\016\365"
+	.ascii	"\210\032\037J\305z\237+\203E\220ss8;.\2569\234U\013\350\225\210"
+	.ascii	"\206\223hDf\260\020\260\256\226\324kk\026\007\235\0222\035<\352"
+	.ascii	"\220\334p\210T\325S\305r\001\244\n\251A:Y\261\252\2177\231\372"
+	.ascii	"\243\nY\305\322YA\265\220Q\253\360\310G\360\355\234\303\202\377"
+	.ascii	"\332\243\346\270e\270l\2251\243\332m\227\313\371\350E\013\250"
+	.ascii	"B\201a\0025U\027\3043\235\246\335z\351\303\001]p\3141k\307$+"
+	.ascii	"clf\315e\030\237\254$\306\205\026\233\013\255\006\364\327c\255"
+	.ascii	"\2526\252\216J\243Z\325\033UF5\326\032\225\252N\325\253\212\243"
+	.ascii	"\356\2503*\217*\325\311\232\243\026_a\324\030\365)\204%k\314"
+	.ascii	"\232\243\n+\323n\210\314\305\235\025$\233Y\263\315[\253\355l"
+	.ascii	"\3169\336h\225i3\255\226\224\206\003\"\304\270\232\033.\263\231"
+	.ascii	"m\275\340\246\341\316,\342\006D$Y[\253\355\222\2209J\227\305"
+	.ascii	"\2549\352\213v\333\005\327\276\271\330\257x\255aq\301Ws5\266"
+	.ascii	"\371\203$\267\351\n\241\323cj\314\213\267\333\346{\266\342\204"
+	.ascii	"\315\250\327\256\261mvbP5\305\332\270Y\"B^H\205\27119\243d\331"
+	.ascii	"\324(\265\355\005\0328b\215\344\n\027\22503\277\031\313\314i"
+	.ascii	"\272f^\230dj\320\222\240\331A3d\t\246\266\271\200\3241"
+	.string	"6Y\261g~\333\266s\314y\230c\343\004\325l\263.0\221\301#H\016\331\033$3\352\355&@\267l\367\252MT\021#\370vL\333\265\244]\263c~\362\205\"\276\241m\245d\244\326Xa;\246\356\216 xH\255/\273\024\001\334\024\"\365\336\252\265\032\n9#3t!\352\250W\003\240\333\026\316\255,T/,\333\246\3314\273\374\311IiB0rD\033\321B\236\304\210\253\367;\026\270\266]\"\273v\242\242\260\216_\276\354"
+	.ascii	"\3439c\314>\312\234\235Y4\2631\fQbpg;,Y\300\244\t+\273\345Rf"
+	.ascii	"\233\244\260\204\201\207\030+\314\031B88\352\265[\254\231e\301"
+	.ascii	"j\261Yx\260\274n\303\274,Y\b\243P\306\007.f\263i\201C\253w\f"
+	.ascii	"\251\214r$M\275\347\201\201\257X+\235\264b\266\n\227\r+fU\243"
+	.ascii	"\205\214\346\006\316\\x\341\274\337y\001[0K%\247\354I\314\324"
+	.ascii	"\024\f>\322\204 \251\267J\321u\021\207S\242X8\2642\247\257\021"
+	.ascii	"\260Qq\325k\225xi\307\f\210\0343P\332\260\352\275U\3766\331e"
+	.ascii	"\352\323\r#\232zwP@\267Pj\026\330\331Y\362\311\223\332\245\372"
+	.ascii	"\344"
+	.string	"\241\225\223\2613SKRV\370\315\325\326\305\355T'\255\013\333\004H)\013\227\024\200\311\330\324\210\032EF\016Ro\027r\250\023\222\031\303\245\336\357\320\300\357.\035\226\312\205*6\036\326G\0220V\366\330e\206\211\304\002\261Ezi\364\311\303+M&\323\"\261;\224X&v\211\335\262Gl\022\313\325I\213\304\376\270\305as\374\307\"\261Wez\3300\221\"\345su\274\255\203R\023\004\234\234!b\215t\322\026\371\217-b\261\254V/\215\310\fC\307J\2324\031M\016\"x\324\264\260v\343\324\312\332UA\366XS\257\035\2423J\235\261h\023\244\223V\bv\333\"{\363\266-@\254\326\340\353\264\341\353,\261\355\201\325\2308\276t\301\327a\001_G\f_\207\n\276\016\024|\235&T\366\250\354\302\346\213=\266Z\025\343\345I\211\013\327\020\255\341\264Fk\303\336\370sz\226\214\361\b#\202ok\224"
+	.string	"\004LX\275\327\322\270\225\372s\352Y\226\026T\020|+\303\316\370svkC\246\350\\\341\333\030\271\260865\352\2650\360\222\016\r\020\030p\\\321q\243\336[\030\277\205j6[D!\347\341\007\342\340\336\352\265Q\226x[\264/\262-rp\314Yh\213=pr\026\366t_\320}\301]b\225E\345\274\327)b\236\326p\366\030\320\355\223\316\027\026\230O\332\254\223u\372Y\223\337\320\232\326(F\324\202\177\313\224\264L\265\213\tX,\351\245'\207\351zc\304f\233-\013\234\335h\275"
+	.string	"c\312\313\016oY\344\274\340\242\226\353\265J\375\205\305\214\222!\365Za\303\021ACs\246^\233\324pX\031C\210\022\2031N\234\312\3642\366\206\326\304G\312<iS\3571d8pj\222\347\206\371jK\213\207\310\222/%7n:Y\335\264ZC\311Q\030\230\212Y\304f\316f#.\034\2321?X\300\315fmS\253\242\205\246\346U\006\205\r\233\332\346G\213\326\033Z\223'm8\205\255\272\275\266i*\331\030\244\277\3162G\250\230\260\324\274\223UM5\203\3001\307\370@di\fh\312KS\240)o\350\b\251\002_\017\230\006K\240CHEB\276^\t`\020\251\304\004EEH>\337\317\247K\203\316\016\374\200+\322\237O\247\202\207\026\335\024\r\032\241F\247\257\307{"
+	.string	"O\0205\342\225\020\034\212@\217\t\030\352\211!4\005\376\216\216\220\202\025X\340!\030t^\312\033J\321\340\356\004\n\023EGFh\0050X\341\350wB"
+	.string	"\351Q\t\242#\rB>\244\021R4\250\343SQ\323\\0\210\350h'\r\362\021\035\345|DGvEJ\344C\213N\364\003\275\340\r\006Q\340\320\020O\267\302\321O\350\002\323#;\204\372\210zE<\335\020\032D\272BhPw`\020\321\021\t\036 o\205\320]\001\230\006{D\350\t\004\240\340\202\334W\220(1T\324CJ\201\003:\364#\201\b)\005t(\347\004\n\023\032V\004Q\240\n\364\004\243\024\022\244=_\004N\2400\241!E\203\0312 \221\002yG$\206x\350\t\024\\\250\007D}(\021>\007\036 \300\203\017<\240\373\007 d"
+	.string	"B\006\347?"
+	.string	"\001\b\b\004\017\200\360="
+	.string	"\262i\372\223J\220~\005\t\025%|?#\243\237\220\005\034\350`\020Pz\244\023\314\001\321\264\2507B\312\023\241'4\304\343A\203\206\"\340\223\242\003Z\304\023\n\346R4\250B\305\357<\201\302\304\004_A\"\030D\324S\341\373y\200\347\353\031\001\240\003\251\017\r\242\300\243\364\347\343 \244B\021\017\032\004"
+	.string	"4H\002T\b\210\364K\001\200\025\322\236\020\357\210\227BO\312\023\341\002h\020\211\247\350\367\023!(\027L\201h\221\211\023h\020I\002\037*\004DM82B\n\372~B\035\202\275 \nD\323\340\n+vi\220\007@\030%\342\245E?\025\212\212P\241\242\"$\025\032R\037\322\357DQ\021zb\005 \232\246<\021P!\340O\305\006\025x\206~= j\202\212\243\t\244\274\024z<D\276\236\017\310\303\300\004i\320\007\251\257\207\244+\342\t\365\322\036\360\004\3607\202\357\327Ky@$\024)/\005\025(H\203A\2734\210\246\274\t\354\202AE<\244\024\330\273@\005\351Wx\370\357\b\005\226H\177?`\t\235\021r\202A&H"
+	.ascii	"\242)J\202\005&\2140\232\362\322\024\276\016\360\200(V\360\214"
+	.string	"x\322 \r6H}=\335\201\200N|\260@\t\017\300B$R\037\n\004\"\t\225\b\002\177A\037\032,\341\353\361\214J\b\001\203%Ht@\211x@\364\310\210\207\205\224I\252\022uv\257~u\261:\023s&\273@~\261H\300\261d\243\336\313\343\376P\302\"\313\370\343\372p\343\206\005\321\n\017\2155\245\223\333\243\301\232\254\266\270\352\275;\372\353\214B\252a\366P\341\377Z\325*:YY\214j\252\2327m\315\0335*\013\2473\"\334\212;\232\3610q\003dIG-\263qqp\304\310q\243v\313'q?p\324.RQ\244\270\356\224E\333m]\221\342uoX2.Mo?\256\215[#\223\211\2026\345\326\370\257\3245\332\"\nW\274|\361\2507Do8s4f\004\025\211\250\325\373;\243\210\002\234\020\027`\352\2751\200~e\004\300\212\026\262zu\027\306-\332\240\332\321\342\026\2259W|"
+	.string	"a\326\033\367\253\024w\243\354\230\235\234\004%G\351\304\270\2709\322\314M\306\020:^.\274\302\334\026\277Q\277/4\350\340m[I\306\b\353\275P\277OF/X\230.\356\223\221\035J%\365\276G\210\217"
+	.ascii	"(4\212\305z\257\323\333~\244\355)M\275\267\351Z\214d\232=.\323"
+	.ascii	"\277X\211Q\252\367\016/\213N\376\354.}\207\205i\312\331\033\374"
+	.ascii	"\021\364\317\316\233\364+\304\222cG\325\032Le\314\r\2553\370"
+	.ascii	";2n\334X\270\037\234\233\210\321\301\344)k\222\366\002\234[8"
+	.ascii	"\261K\265V\243G\r\203(\250\242\3118H\342\024C\246HdD4I\222\016"
+	.ascii	"\022\n\020\204\203Y&\310)>\022\240\024=\f*\307\230\241\021\021"
+	.ascii	"\021\221\024$e\2452\214\001Ec\340\224y\216\220#\332\310\203\210"
+	.ascii	"\210\373O~\355\243v,<8\035\200\264m"
+	.ascii	"G\362^\212\3536\323.q\031\247\203\362\261P _\220\n\234\225\344"
+	.ascii	";\2511@Y_\325\377\243\004&\376\355\227@\311\236\273}\256\375"
+	.ascii	"A\300J\370\344;\233\343\346\353\266+p\277\263\314\370\032\257"
+	.ascii	"9\001\323\300\323J\025\007IE\031\022\246\235\304\027\t\005\016"
+	.ascii	"'/\344M6\034`\377sm\361\322z\273Li\264\214\003\033\t\323\227"
+	.ascii	"\225\022\363f\305G\202Uw/\211\202\235\251\254\032\351\205Uv\366"
+	.ascii	"\276\2073f\2706\223\345=~\270\325\203\305\246kd\rO\336)\347\220"
+	.ascii	"\017?/b0U5\031\001-\257\001\275\263\232\373\256\007*\320\317"
+	.ascii	"4\317\032\205YcI$\234-(L\032\r%\3341bd\242\322r#\2405~\273u["
+	.ascii	"\341\225S\013\231U\266\016\320\237\330PH\034w\007\342\270e:\247"
+	.ascii	".\367\203\366\200F\316\263&z8Ck\020\025b\237\2159\261\032G\210"
+	.ascii	"\314g&\023\356\034]k\021%6\357\325A\017\022%e\201\305\221\270"
+	.ascii	"\326b\351\203v\260\026\354\351\333\342\016\373f\025u?{\205"
+	.string	"\302\264\351\334\226\323[\025\f4q\364\321\003\276Nlt\rl\261\260\350R\221B\261D\021\"\351\243\t\n\r\037\034X$5|\3513N,t t'\3559b\323\3372\323\242\360\235WH\006\317\367xP\303\317\241]\321Ng\271P\355K\033\032\321\274\236\227\0346\035:s\2451-\017x\361+\373{g\327\321\333\317\204\f\224\232\2613\031\311\320\237'&\206\320Vc\254t\321\023\b)\f\204\036\312\b\216\006\313\032\363f\242\264rb\271[*\nO\013L\217\221#\363L\0243h\317g\365\275I\325\317\033\366\030\246J5\262tw\002\001z(E\263\310p=\"\307\301NDNh\262\355\030x\267\350\212\276(\025\303\301EN\335C\035\374%\b\2021\305\342\230O\322[\026\357\214\030\023L\227\337W6\300\253\002x\017\r\302? )h\221\376\252\204\345\217}\374t.\200\031\301\306\235\202\356\f\255{\214"
+	.string	":\260\312\331\252*\220\223\262x\224\313\022!\200\335*i\245>\246\345\006]\037\220\347'"
+	.string	"RU_3\335@\032\243\360\307\013"
+	.ascii	"\374\373\230\037\201\314bC&\226\"\263\200#\303\342\273\360\324"
+	.ascii	"\023\367\275PQR\230!\202\030Dz1g7\031\240_\371[\326I\3164\305"
+	.ascii	"M~\275n\211\202I\302\336\206\007A]\367\344\226/\205\3556n0\316"
+	.ascii	"(\024\325\023\371\357M\216g\362_\017\245\214\205\367\316]\351"
+	.ascii	"\210\245\313*\305i,M\020\371\302\255t\260\026\177\315\267\254"
+	.ascii	"y\263\275\330"
+	.string	"M0\372*\213\251\210q\224\322\236D\357\212*/ij\203SU\271\302\2328\004\244\345\235\352\256\2275\234\310a\375;W\304\320l\006\350\325'\r\304\227<\362>\300L\366\251\204\006I!\336;a\2343\357\331\261\334)\270C\006M\263rZ)\220\3502\030y:\274\374~\353x[]ei'\300\037\345@\221S\030\334E\205\006K\314\357\337\304\363t8\2201{\341\250\234<tSv\203 %Wa\321\263\037\204$\372\352(\177\362:\025,\264>X\246\3079\255\203xh\221\017d\337\300\203dJ\0254Q\222\b\205\001R\340\204*\031V\rY\300\002T\266\272\354\324\003\273=\261\213\226\300\347\356\352\331`N\f\223\177\006\222\260\246\220\344\320.aI\240\217\234\253\2261\202-D\300\t\006gUeN\267\246!~0\355,m\314=\222U\304\t\232\274\210\234h\374\"Qk\252\f\fj\314\024{h\3673"
+	.string	"\350\236r\361\"w\373\361\037^\021y]\244D\241\2761}H\001\220\350\244\377\340\322\006\312\0018v\325H\244\230\251\257\026\200\315\3112\372GM \347\230\203\223$\310\232!e\367\234V[\312/~47p\221g\316\311:|g5\2222\027\313^\313L\330a\034l7\263O\331=\177\221\036\277\266\3760J\342\327i\202"
+	.string	"\202\232x\267U)\244%\323'\013i\254\n\236\262t|\272<;\304r\201g\336=\217\211h\034\346\230\317\031\373'\"3\346dHK\210\312\245\240\020h\302+\225z(\375/\374\016\3261CM\367\"{\376\213_G\302\314\373\357\022D\n\220\365\272/\b&\306\342\"Ntc\b\252\001\274\026\024f\177W"
+	.string	"!\344\336\033b\340R\333\301O\035p\353\345\367$\212x\202P\243\212qZ:`131\372\350\336\231\030\323\316\301\213\232\307\310|&-gd\201R\240\033o]\320\216\034\330\022\335\232X@\354'^\0065\214\353\226TR_Ia8\311\013Y u\264/\333p\223\314"
+	.string	"\342\214\351\252\343\341\260w\002\374u\ni\020\0251\024\313\370\005$&\"\370\241$\235# \346-\352E\224\340\03763\333\215\021\n\266\rJ\257X\377\006\216I\037P\310\370\3105\221\021\236\003\013\t4P\025\230\365\253\252\364\013)#:I\231\005\255\024f\305\310s\246p\200\235O\206V\370\355\331\264\3120\252\007\237\227I\345\025#\321T0F\315\230\034\303\322\213\3124N%IF/\212\257\003\030&zC)?\016}\323\340a\210z\312\001x\277:\f3&\201\210\371\217~\272\\\336o\2637\272\227\344\2628\261s\204xP/\257d\211\344d+"
+	.ascii	"`2`\342\220\220\324\271z2\226q\253\361_\216\370D\307\360JQ\271"
+	.ascii	"\355p\372%\032\220\221\223S\220E\204\035\253\307\372[\\\024\036"
+	.ascii	"\315'\016\231\221\274\\,\301\342\310\255;E\372%\347\244\357K"
+	.ascii	"\340+\3469\216M\360r\327\320\275\017\206\020\273\236\205\305"
+	.ascii	"\2736OI\347\256\276;\270\305/\234\365$\272\n0\307}\304\324&v"
+	.ascii	"\301\3735\270\355h\211\370\376\323E\323I\030\336\213+\254&\217"
+	.ascii	"\2712\366\2430\023\314\333\233\177\030\236\313\373\234\263\301"
+	.ascii	"\333\304}\016\024lv.\323\207\354S\363r\221\266J\335\226F\262"
+	.ascii	"\253\320z\345\255\363+\035\375\341\346\177z\300\271\373\344?"
+	.ascii	"\247\267\016\336\030\373\266\364L\035F\227\303\353\024\256d'"
+	.ascii	"\217\261\017\317\303_\017\177\273\037c*\030r\034\214\207\273"
+	.ascii	"\2518M[}\317\211V"
+	.text
+	.section	.gnu.lto_.symtab.846daf7dce8d2b23,"e",@progbits
+	.string	"currentMeterVirtualState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"currentSensorADCConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"currentMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.846daf7dce8d2b23,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2554 @@
+	.file	"gyro.c"
+	.section	.gnu.lto_.profile.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\r"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037"
+	.string	"="
+	.string	">"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\341\006U\032"
+	.string	"\026\240zK\260TRc\2244u\271\270FJ\2256\356\310\321\035\250n6]\262\203\032\nX\016^`\250\f5\366\375\374\330i\021\366\037\364\037\364~vvvvf\234\322\300\023a\b\260\002Ox\215\264\2176\336lK\310\226M\244\224Rn\"2["
+	.string	"c"
+	.string	"k"
+	.ascii	"\377~\f?\037v\362\377\276^\031\221r[Z\345\376\370\333^.E\022"
+	.ascii	"\303\277/r\317H\345\214`\344\266\027"
+	.string	"e\347\251\310\241\030_:\353\353\347g\374\373\230\316\001\224\204\204\257\325i\325\217P\034Q]P\307\326\377\366\3653L\324dC\345\272X\177\327\353]\312-#\033\231\nS\363\216H|\232fV\002\334\334?\271\326-p\303,\225}\330\246\335\235!PIRP\366\315\232\271o~\177\024\367o\355\346_^B=\216\f\335J^Mnr\332i5\277\344\372,e\020!5G\347\354\342\001\\<\276\354\274QS<\300Z\251\225nQ\231\3709k\214SD\tH\303\317\345\370) \035U\262\035\372$\323\b*\362\211\240\217`\370\212 \034\206\203\342\230^\366\357\347\267siy\340\240\301\371\213\362\237\277=?\336\376\366\333\255\3556\022\261\036\032\234\301\240V\321\2070H\306\002\026\333m?\036\006qR\n*\216\261;1\224\240d\302\201\346 \250c\314\017\240\211\003\006\256c^\324X\025\270\277\277K\210\265s\203\300"
+	.ascii	"\001\347\315[2uDuA\235\021\326*\345IE\340\347\\_g\343S\316o\027"
+	.ascii	"\242\276nx\3208\201\250e\032\3253\374\200\225\\`%y\350pyD>(\016"
+	.ascii	"\273\207\347s\202\021\311)\235\020\220\r\032\304\363-\260\024"
+	.ascii	"\250\f\213\f\247\312-\216\272Z\032b\270\244\315z\352\335\\\260"
+	.ascii	"P\201\202\211S~\357y\321t-\221%\256l\020\231p\322\bM\215\025"
+	.ascii	"\022\364\003\200\272\250\301=)\021)I\222\024\322\001\200\202"
+	.ascii	"Rd\3426\022\240SB\026gH)\031\"E)H\275\n\315\001\277\245\315\220"
+	.ascii	"\3220Ne\200X\245D\300\274Y>\005~2\021B\240Q\006\311\327#N\332"
+	.ascii	"\235\252\321kp\324\353\031s\250s\n\020\033\241\335\001o\r\335"
+	.ascii	"\205\201Cf\316\344 \267;\\2\224\224CIu1\234#\223\251\330\257"
+	.ascii	"\266/4\352\306\270\364\261\375z\241\3274\322\216G\203lM\177\237"
+	.ascii	",\336o\324\331dloJ0iP\3127\235\237\255,\234&\337\3754\376\t:"
+	.ascii	"l\364\257\r\032N\361\020A\213\355\365\025\342\226\032&\003\007"
+	.ascii	"iG@\033\362=\226\345\372\177\351\247\300n\0038O\255\026\205\003"
+	.ascii	"\253Ge\271dT\321m\013\270\240CCfb)\256Q\200\252\300\277\321/"
+	.ascii	"\325\330\307\370\270h\365\037\326\222d3\351\253\342\324g\003"
+	.ascii	"\003\223\307\360\224{\227k\2622\3250\t\340\235\352\025\310\030"
+	.ascii	"\236\360\035[\032\203y\235i\323_n\354ru\b`>\nlY\271\027\267\n"
+	.ascii	"\3315\025\203\007\363v\024\265\032\344\344<q9OI8f\0277\244\324"
+	.ascii	"SGg\232TZ\256#\021\334'y\273\3431\335+3\032\222~\277N#d\013\223"
+	.ascii	"s\035\306\201\377\246\270\025l\021\025\227\024\033#A\200\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`G\001M\007"
+	.string	"BI\033\037`\305\226\0030\f\024\004A\020,\376P\004\336Xy1\227\013.\261:\367e{\354\270\245\224)/"
+	.ascii	"\200?v\034u\242\036\352 v\237\356\331\235\315a7\313|\307\354"
+	.ascii	"\302\273\245\223DM\342@E\213[\345\2372\351\222}\365H\207\364"
+	.ascii	"Gwt\353'\t46\306\036\027\033\025\211\212\023\214\210_\251=\036"
+	.ascii	":\2302\024\b\323\336\36655\001B\250\261\255eS[X\366\f\300\002"
+	.ascii	"*\"z\022\300\307H\305\325L\206\366\377\r\271\221\367*\367B\223"
+	.ascii	"\206R\367\357\017\245\374\320;\\Ck\247\367'*\270\0171\335\360"
+	.ascii	"t\212\205X{\222\365lCa\0377\213\201&\341\2161S\261E\334^t\224"
+	.ascii	"|g\333\317>\b\203L\254\214P\246\275N\301\321\321\216\206<u\215"
+	.ascii	"\026\017cmB\nc\201s@\007\323\327\257\0251\b\204\007\005"
+	.text
+	.section	.gnu.lto_.inline.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\340\013%*"
+	.string	"\346\271\275G\260\230\321p\301\301d+\314\240\243W\022\201uV\342P\314\025u\253\021i\376\365\tz\200\256'.\t\253\341&?u\277n\200V<\344\247\364\275\331\342\2149\227#\276\320\362\237\300\376\202^\030\243h\213\330\335hK)S\235"
+	.string	"\257"
+	.string	"\247"
+	.string	"Z$d\324\331\335\376?\277\217\346,\321\311\263\216\263\204VM\021n\232b\r\310\377gd\304\213\337 \305qw\2430OqU\017\304g\260\252|\025b0\335<\331\005\274\006T\376\365\277\361\331\335"
+	.ascii	"\366\177\200\325\353U\267H\272l\251Q~\246\006|\rH`\024Z\032\335"
+	.ascii	"]C\202\303t\363z\016\203\021\214\272\332%\301\250+\233\277Z\252"
+	.ascii	"\273e\373s\216\215\272\333\346\343m\273\2737\376\271\005v\363"
+	.ascii	"rrK\325\335\243\271\3567\307T\335\275\340\3171\260\273\021\354"
+	.ascii	"\257:\376\321\3358\277\354eU\005\376!\006r\204\265Ub\374\317"
+	.ascii	"\263JDy\232F\236\335)\237I\354\025\226\237\324\243\034\207\374"
+	.ascii	"\212\027\301ER\210\251\241[\214D\261\362\372u\313B\t\312\bm\344"
+	.ascii	"\357\360\2153\353\213\205\337h\311C\013\204\022\343\004*\261"
+	.ascii	"@\252\236\206`\270M\315\315\357\346\367\032P\346W\001#y\333V"
+	.ascii	"=\005I\022u\354{\n\222\224\303\337\263\320fmmi\305N\363\303T"
+	.ascii	"a\342\377\227f\314\266\242|i\322lRf^\232b\2774G\224/\315\227"
+	.ascii	"f\320Z\t\255\226\304\227\333/\177\343\313\227\271\025Z\t\237"
+	.ascii	"\274\256\375[\351\033\377\023\335\315\373]:\2539\253\327\262"
+	.ascii	"\006b3\321\267{\366\334\371\277\347~\250\363\277\3041R7\317\365"
+	.ascii	"\330\007\310\210J\344\217[\027U?\204\245\310\315w\240B\333s\302"
+	.ascii	"d\212\201/ E\262O\006\355\222\254)9\366\244\314\227\354\357\330"
+	.ascii	"b\367\267\267\277zj\323h_\b\267\355>\026c\376\232\256\337\306"
+	.ascii	"L\363\006\343\220?#\207|\331x\362g$\025_6\"\361g\344\311\227"
+	.ascii	"\255\252\223\366\354\356w\235\354\322\242\245\261g\211\376\372"
+	.ascii	"\351\270r\004\347\n\002\254\030b_\2640B\342\213\027\2038"
+	.string	"\007\223\r-\005.\232\027G\354\315\333v\211\212\227\036\"\n\025)\216\002\377\315\017\246\267\336\313\251\312\2141\035f6\216|t\231p\020\270}\315\310\1770\237\224\007\350\001\307\335\201\303\006\0362\354\032hH\335mb\257\305\024\234z\225\2533\350E\361\301\251\327\"\036\343\317\356\2768\230\202S\3451$u\367\316\336Jw\037\370\205\240\026\024#V\"\245\004G\223=:Ps\351\346\275^\201\264\361\260\273G\336\374\215l\002\325\224eG,\242>\273\273\322\350\263D\347(\250\246,\tN\341>\031B\253\0365>\363\023\304\001'?\266z\225\240\202\247\222`a)\230!\366=\301\342\244F\377y\r\310\377\371\245\303\241\335\321\335\t\356\303\263\377\267\r\201\t\250A1S\210\244d$)HR\350\221\004\204!\306\034\344z\022\340T5\007Zg\020\242\231\200\302D\345\224\241\3122\006_\r\214}V\313Rm\261\246\373"
+	.ascii	"Kd\345\372\022}\020\353\301\234v\033\236\3218\021|\034\311X\226"
+	.ascii	"\312\374\327\330\t\366\312A\210Z#s\273\210\f\n\227H\314\257\252"
+	.ascii	"\3438\214RP&\2225xU\033N.i\306\241\265Hr\271\223\246\371\213"
+	.ascii	";Yk\016%>Y\247\216$\230A\334\325\"\364\017L\321j\324\365\034"
+	.ascii	"W4\266"
+	.string	"9I9\021\276%\343\237P\256\256\221\305\025>\035\345Z\317\311\023\254\357\264\032\250\305\315\360\023\002o\216\245\361\366\bY\f\370\351\210\330\034\005\036H\\,\372\023]\fv\333m\300\365\376[\244\320;\252F\340\355\037\202\273P4\r\217\270Xi\0333\224\271\006\366\026\370+\254\340\021\237\244\315\310\210\362\020\350n\247\247\207v\303UM\363\323\030\207n\331\261\214\311\276\001\375\361\331\244s\271\235pj\356\\\341\276\300vXF\2477F\347Gz\304\362\030\007\nl7;S\347\304\201\251eQaR\350\360\202\334\221\237%\330\350\031\34372b\026N8\334\232}^e\032\322\321\350WHY\367'H0\310\201\270\201\370\251\307$\235WF\016%\307s\262kR\003a\302\262\"\265\312\316l=VI\346\361\211;\037&\f{\"On\316\277\231\310\006\367\364\036 4\216\340\200\257\257q\003F\205Q(\025~!\006\301"
+	.string	"\357\202\200#B\357G\r\324\207\304\370,\264fI\tsX\t\037\205\336\2453/\205\216\352\337_j\005N\356,|\211\206In\273\221\"\033\227\025\322\371}\340G\356\311\n\217\30677\023\322\345I)\255[~\357\372Sp-\315\006\3427\335\325\306"
+	.ascii	"\250O\331\242\"\002\204\342\f\340'\002\224n)\020\345\265\226"
+	.ascii	"h\315\037\241m\3301\362\332%\240P\210\225\320;\231\025(\312\006"
+	.ascii	"\032\274\265\230\350\025sl\311\206t\013\346Ta\235\200?\361\247"
+	.ascii	"\276\375\037?K\\\016/\r^zg8\344?\031\002a\224b\215\317UN\314"
+	.ascii	"8f~\313pd\003f\034\201K!\177\030>\314,1\020\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`>\007\025\022"
+	.string	"\226\024C8@\305(\035\3030\354t\215\253\342\336uu\206\331\t{!\245];C\372\230\243\243\306\345\007>\201\276\016\274\353\353\355\200\352\242I\264\307\235k+~\264\215\004\373\357\235R\n."
+	.string	"5"
+	.string	"6"
+	.string	"1\363\304<5\3665m\272\255^;S\342\237y1'0"
+	.ascii	"{"
+	.string	"\305\233L;U\342\335\355\220\253!\347\026\266\003\227Ol\355\347\263\333i\005\niYN\223\370\367$\376\230\202\365Zo\302\326\036\004\260\301\tB\224\370\355r=/\253\205\232\256\353:\367'\030/\316\323\302\366+8\007\361\313\200*oS\005\3359vH\013E\214\376\340\207\226$YR\322\363x\350O\343\234\371\261\002b\346\333\232\037_\3279k=m\247}\300\034\332\006\313\325n^j\242O\310P\201T\005\027\236\001\335\272ux8 \366\30464\332\214\026\203s\321\232P\025\217\003E\324K\317\007MaK\351o-\220*$Er\244\242\007?\377mR\333Q&j+\201\360\276\200\207\250QI\247jFS\320\312\034`\002\221bE\345\001\022\200\022A\b$:\020\222\316\0303TBJ\213\312(*H:,/\315G\r\006m\251\251[ZW8\227V\003\310\332Fh\232|\245\334\214!\n\210\350\343\326\201"
+	.ascii	"K8S\336\037\033\3368\270\200#\365\013Z\233H\255\241m!\340l\017"
+	.ascii	"\t:\316\251\220\004\272\314\205\023\n\\l\031\216\2526u\353\217"
+	.ascii	"^\227\261z\206\341\206\350eN\342f\205\365\201\330r\025\366C\360"
+	.ascii	"'wc\232D2Sc\033\020\001 \274@u|\005\023\272\001#\003\331\361"
+	.ascii	"\224\n\b\025[\246J<\202\016KI\206=\022\202\204\227\3173\267\274"
+	.ascii	"\300\263B\303\2453:\265\2042@B2e\371\007\330\221\020\224:\204"
+	.ascii	"T\223n\005v\253\350\003\207DCT\020\0234\235\353\202\024\350\314"
+	.ascii	"h\007@e\232\352Y\371m/'\243}\002\333\346\023\006o\r{\022\261"
+	.ascii	"drpgf\354b<+\227\225\323\371u\343B\315\245x\225\373{\003\220"
+	.ascii	"\273\315)\205\023x}\233\245\222\212\206}\030\013\362L\377\374"
+	.ascii	"\026\217\226H\006<r(\253\324o\305\337\003="
+	.text
+	.section	.gnu.lto_.pureconst.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 }%\003"
+	.string	"\322\007\030\035@U\322\001\350\352\232\024\227s\f\3030\300\377\317\361|k\274\344\217b\367c\243\261!\356\267\364\"\335\321\024\315\320\004]}\246\347v.\347\333\\\315\314\\\314\274\\Yn\345R\346\344EM\311+2!\337c:\276\306\307\370\026\237\342S\342\"\356\3413|\205\217p\007Wp\003\027\360\031ef\246"
+	.text
+	.section	.gnu.lto_.ipa_modref.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\272\003\345\020"
+	.string	"\246\227D5`I\233\341\220a\212`\310\300c\315\324\227K\302\0311\2200\f\303 n\242E\b!\032\215\035\004\252\266T+\225\352\373Z\023S\323U\354(5\335\276\376[\312\0241"
+	.string	"0"
+	.string	";"
+	.string	"|\312)\355t\266jE\316\361r\354N[\253\205\271k\255\346\257\261b\356\264\347\213\177\256\024\363/.\232G\216\031\346lH\331S9\343\002\177\274\250\020\2555\326\234-\265__\205h\227\352Z4\311\207\316\251l\300\277\327\\W\312\245\362^\001OR\235R6&\204\362i\321\f\225C\355sR>\351\001\325#y\032\271\346\224%\370\367\bX\372\3451*f\243zZ\006\206\213`\242|bF\374\362\216\224G:!\235\022\255\243\007\336)\2170P\300A\225\273[c1\242h(\004\270$\r[f6T\342# \036~\346b\345)\207\362\364l&=\312\037upx>xK9\241B\007"
+	.ascii	".6\200\226P>\024\0270\032\b\371\367\276\265\246\202\246W\036"
+	.ascii	"\2011`\nf\002"
+	.string	"\200\206\250A\271\204\306hA*[\233\001`\002\221bV\036\022@\227=\244UmAA\353\261w4\022\321\312\262\270\231\360rnj\267Bw\333CJn\240M\375\022\210\377\021?\357\215=\313\271g\226F\026\021z\001/\232.\376\340\r\025\206\243+u|\300\004\034{\"\265\016\223\254<bn\244&\355<c\226-\201\324%\310&\3001\335\331\204\377\302\263\322\373e\"\f\037\252,\233\210\204\306\216\320\355t@\377\031\317\240\315bh[\fE\217\205]\235\204\230\315s\367Fs\311\301\307\r\3258\341\321C\300J\341)\013\211MT\363Z^\264\220\264\343\220\026l\017\206\232[\317\267\313\345G@\037e\3355\264\201\257\320\332\241\005\200\310\256x5\346\330\032=\362.\230\317\201\203b,\326LA5,\232+\177L\374\202\317\221\344\201\245G\301Y\206\254{\233\027\262\3513\325S\275\023\037&2/k\002\305Pi"
+	.ascii	"\026\312\240G\300\t"
+	.text
+	.section	.gnu.lto_.lto.def7cb563b4d1bc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxGyroCaptureSample.14.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\214\006]\037"
+	.string	"\3465\276G\220\332Q\007P.n\225\007\020\356\336i\tX\347Q\241\231\0221\007/\244z\236\214z\276\260@\232\340\207\030\207f\267jO\350g\177su\236"
+	.string	"0\b5\367\002\bz\231\022\363\016\350\200\231\303>>\352r\313-SJ)\240"
+	.string	"\235"
+	.string	"\261"
+	.ascii	"\325\371\246t\006\360\316\366\235M\352\\\251sI\235\351;\377;"
+	.ascii	"\273;w\221\002\027I2@b\367\2668\331\\+\345\327\017f\356\0313"
+	.ascii	"\022\352G\347Nq\365\320\26537\221\326\002\366\021\252w\356\325"
+	.ascii	"\261\206\311\275H#^`\273dd\337j\227\266{j\227\fd\016\323H\254"
+	.ascii	";\013Z\t\273\222\367\336\334\363h`\327\222\276\003\271o\210Q"
+	.ascii	"]\313\003VeC\242\214\2465\"\212\031q\312\237\026\270\242\022"
+	.ascii	"cF\f\322\333\225\034_z\253\235\005\221\312\335lp\357e\037\022"
+	.ascii	"_4\233\315\314\034\230Y\002sm\022RI\315dg\227\3207\215`i\216"
+	.ascii	"\377^\274\032\226\222\036\222u\363\252\377\377{Q]\005y\251\221"
+	.ascii	"\360\216\370\377\026\330\020or\346\312\215\347\247\332\257\304"
+	.ascii	"56\345j\230\231\251\273\236\354\275\027\0017W\027\371\300\355"
+	.ascii	"\243K\006\321\344=l\252]\366\367X\221\274\322:J\371\311\214\214"
+	.ascii	"\362\337\301\334\177\236\347\311\257\203\271\221\335\003\372"
+	.ascii	"\330-\200:\023Q\347!\353,d:\007Ug \353\374c:\373Tg\234u\276\231"
+	.ascii	"\316\266\352\334c\235yL\347\235\352\254c\235sL\347Zu\246Yg\034"
+	.ascii	"\323y\026\377+\212UY\341<3\027u\027\035\216\371AsAzc\225\254"
+	.ascii	"{/\002\016\321[\"0\300\272\367&\350\222YBk\231@3RIb\351,\024"
+	.ascii	"\352\354q\376\273\204m|\374\346\231+\\\250=\234}\200\251\217"
+	.ascii	"bn+@\"\030\332\0077T\355\362\346\177\305(UVD\017\340{\253!\b"
+	.ascii	").\021\266y\322\364\211\236]H#\330bA-\257\322~\030\317V%I\233"
+	.ascii	"o\237ve\350)<+\345"
+	.string	"iA\256l\034\237*\263\206\216\362d\303\202b\342\200\222e\206\311\310r|\321\337\301}6\201Z_\211+\254|\372\365\333\213\nHpC;\371*\337\310\3131\035t\016\216z\276\023LV\347\340\310d\017\006x\276\022\277\021\273\245\244\236\357\004S\222\211\236\022\210\245]\b\245\234\210\017\273\246\334\222\217D\316@\021\367F\360|\271_\257\347\313\315\220\267\351m \365Az\357\275u\350\231\223|\306\316e\354*\375\241\267P\303\210\220\303x\221$\272h\021\364B@Ae\200\336\251x\376\030y\325\020\351\215bY*R\270\320\347\177p>c\270w*\226\335<\250\303u9r)\217\362{\332\376\366\357\325c\013\322\363NE1<\217\246\327\250AzcXV\232dY3X\335y\036\235\2352V\347\177E.9FMfLRL\0300\265\317\241\325\306(-\200\201\250AP\005\rcdd$\214\244$\205i\f"
+	.string	"\003\021\241\251:\021\360 3\322\021\234!\252\321\001\347"
+	.string	"\201\320\224\323Z\264\035\227^\212\274\251 u\254*q\036'\025\330\345\262J\234n\221{\302\347\335\207\207$\025-\347T\302\367\237\035B\fB|\253:\215<"
+	.string	"q\210\207+\r\310}q\347\304\233\216!C$pp\tN\347\0176\310\247f\221"
+	.ascii	"Y\275O\372\026\341Z0\021r\326\345\2363\3038\210\027\016&\250"
+	.ascii	"J\345<\"\244\263#\024\bqV\354:\222\370\327\263K^|\302D\307\371"
+	.ascii	"(\360xxa\240\252!sM\364`\352\037t\257\201\t#\024&\270\322\230"
+	.ascii	"\274\212\201\344\244j\274\362\027GY\004\b\\\223\303>\037j\034"
+	.ascii	"\205\260O%\316\335\227\326\257\243#:G\006\251\245\277\f\035\001"
+	.ascii	"u\037\344\310BiB'\234\003w\257\351*\343\250\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.66.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 \237\205\004"
+	.string	"\364\007k"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\203\344\322\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\335\006us\366\005uq"
+	.string	"\005\001\006'\001(\005\001\006\035\001'\001\212\3408om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.string	"\005"
+	.ascii	"@\020\342\251\260`\026\235\242\310\033@\021"
+	.text
+	.section	.gnu.lto_pgResetFn_gyroConfig.67.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\270\003m\021"
+	.string	"\206\233hI\320TQ:\215\007K\204A\242\224.\200g\224\265\332\272[l\264\002c8\232\313o\276\346\304(\375J\370T\275a\026\236,\220\fBtW\236>!\031\\\b\267x \340F\200BY\n+\032\207/s\212i\255\221X\262S\nK"
+	.string	"R"
+	.string	"Z"
+	.string	"8^\200\266O\355\313\036\243\365\033\227\013\330\215\355\350\331\235\241\030A\351\236g'\360\335+}\300w\317-;\350\263\026{Z\217\022\264\272\273a\307\342\255\323\226\177\0317\305\310\270NI\rv\3274Ff\346\356n\373\200m\005\366(Cn\271\215j\3615`\330\316\016\304wL3B5\301\313\317&O+\003\300\204\316\333\315\317\026q\034\263\264\273\013\374\031#H\234"
+	.string	"\271\270\347\273|\367Vjl/\231\355\205\346\354\231\213v+\354\217\266\213\331\277\371\251\001\362D\035B)\262k\"W\264>^\267+|\310\254\321N^\026\036t\222\220\"\366\222\375\302\215\224&\033\032\347\351\2631\034\350\224\243+'\222\323p!\270\272\341A~p?ns8\020\023\204\335X\356\343\347v\242\316\243d\200b\310K\226\272\016\022\222\"&\252\347\200\021\325\325k&\034\242\357xx\217\251\344<\317\035\252U\007\226\250\002\300\250\024q4U!9\212$+E\206\254\025KK\210\032\3110\245\200\305\017\2511\f!\212c\b\316\366\243\355b\024l|^:\030\025\352*A\030\236\3635\016\2163U\350T\327\007ob\222j:g\t\302k\t\322\344\034\271\035\341Khr:\333\204'\2517\002H\2501(\212\304H\244\202\362M:"
+	.string	"\003\021!\2336\021P\\\251DE\342\301\272\r\030\204\232\203\351\226\336\030R\361\340hG\024\311\034\352(,c\205H\357\321\316\255\260\215\210\n(\310\027\351@\231\260\201\360\t\n\271\257\311|k\247\206\361_\2735#P\271\204\304\2252\370\277f}l\350\273\025\\\224\350s\372\322\006\255 \351\346\233B\t\240I\025\277\320\225#\213\274\336\250\301\r\331\233\260@\r"
+	.ascii	"\232\331\n2\377\3428j"
+	.text
+	.section	.gnu.lto_gyroSensorBus.68.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"M\013"
+	.string	"\206UN@ O\234\0160\221\001\f\030\227)\341\214r\204\016\242io\364 \024\351\253\211\033qL\220\312\266x\f\355\341S\1777PU\177\013\017\\\001\030\327\222\220V!3\342\002\2558\004\217\246\333\336R\246\024;"
+	.string	";"
+	.string	"="
+	.string	"\337)\324\243\344\001\250G\355p\317\241\246\307\177\307!\210\020-\270\356s\250q\205\b4\260\320\230t H1q\200\361\216\347\250\013e\002p\260\273N\256#\335\361\266\037\330>`?A\034\352\361J $\303\226'\373\373\244n\330\207\253%\333i\250\351\314\364\343d\205\211\201\212\335\013\247\031\353\"\246\370`\273cW\276\210\217\350\330#\340\363H\225\310\203\350C\306\356g9\036gg\376\021\341'<k^\342\222\354\356\002\017\013\023\032\200ph\324#\324\277\3400ly\202P72Q\3040mP-\375\031u\315\021\217\220P\216\330'\361/\3639\\\201\223\347\036\375\266T.L\303X\031ve\233Kfm2\0204\226\005\313\254\312"
+	.string	"_\022.\230E\341\2720\253\372\366p\265\344JDm\321\024x\225H\372\242\031"
+	.string	"\331\335\316\245\216lC-\260)\310\276\t\314$\021"
+	.ascii	"\031\023\372\252\360\200yo)\213`&\2121\335\276\261PX\365D\021"
+	.ascii	"!\202\207\035.t\r\237\306\342\371!\210qW\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_gyroSensorBusByDevice.69.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"5\013"
+	.string	"v\224MC\020\307L:\340\254\240Lo-z\335\333\004\234SI\222\256\303\235q\311\032\364\323\316\024Q\201\226\336\355Q4\342=\306\340\233_\327\274\016"
+	.string	"H"
+	.string	"A\205\210\323\352\240+\r \252\226a\263$,\"d\357\224\0029"
+	.string	"9"
+	.string	":"
+	.string	"\347\0332\0077_\310\034\254)W\375\253T\345\257\376i\334\n\300\314\222\327\317\003\300\f\3001]\037\002\313\202\225\347Ncf\213R\315gwMa\246\354\006o;\303v\205}\211\246\376\227 ;\200\021\263;\362\300\301\032"
+	.string	"\007\330l\247\354\320v\245\266\307\"u\034\312u\027E\201\200\335\223\302\023\233\203\266\375\333]RV9\2345Y\370\262\275v\275\335St\f\265]\326a\366\370\027SD\315.CN\032\035\201\336\356^\034|\215U\177X\265\365U\232y*\fH\352Q\031ZMNx\272\004.\332\300>W\264\322\354\177[g\366q?\r\344X\226B\033\"\320Ht\n\r\352\214\244H\207X\222cY\n\225bi\304A\022Ad)v\036<~\204H\021d\034I1<\367ufJ}\030\022gg\202\3608iZ\bZrW\250\276\216\024\021"
+	.ascii	"\021\013\270\016\303\203=\300.\241\312\215\314\tI\005H\325\272"
+	.ascii	"\243\032\244\356Zb_\320,\352\302\b\227\031\221*\306F\251j\240"
+	.ascii	"\271\024\024"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.70.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"]\013"
+	.string	"\206\325NA\020o\234\016`!\211\222%:\r\225A\230\252\205\322y\233O"
+	.string	"N\352\230\036'\030PG\216w\365\255\3017\313f\030"
+	.string	"\352\336\340C"
+	.string	""
+	.string	""
+	.string	"\201j\244\312\003\374XT`\321\016\270o\254do)S\n;"
+	.string	"<"
+	.string	"="
+	.string	"\337-\324\343\344\001\250G\3458\350P\023\344\377\343\320\203G\013\256\013\035f\\!\002\215\023\031\224N\004-&\016*\376\361$u\243L"
+	.string	"\016v\327\311u\030w\274\355\007\266\017\330O\020\036\352\361J`D\303\226'\373\013\245n\330\207\253%\333i\250\351\314\364cE\303\304`\305.\206\323\213E\021Mt\260\375\261+\377\303=>\006\t\370<\214\n\007\211\013!.v?\313\001\036go\036\022\341#<s\036\342\232\354\356\002\020\013\023\032\210th\324#\324\247\3402ly\202P72K\2600mP-\375\031u\315\022\220\221Q\226\330\007\361/\363;\\\301\223\347\036\375\306\\.L\323X\031ve\235Lfu6\0208\026\006\313\254\313"
+	.string	"_\0222\230E\341\2720\253\372\366p\265\344\212D\215\321\024x\025I:\243\031\020\331\335\316\245\222lC-\260\251\310\276\b\r%\021"
+	.ascii	"\031\023\372\252\360\200yo)\213`&\2121\335\276\261PX\365D\021"
+	.ascii	"!\202\207\035.t\r\237\306\342\371!\210qW\254jt\212\246\366"
+	.text
+	.section	.gnu.lto_gyroDetectSensor.73.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\320\001M\021"
+	.string	"favH\340\264\2501$J\"\331\342 \214\256\350\316\340\341\222HZ\257\257\350J\214\224i\374\2109\234\355\f\367\310\271F\2509y\244\314\031\314\nF\206<\270\204\243\242\003\304\211a+>-A<\234\r\230W\271k[\312-eJ\001b"
+	.string	"^"
+	.string	"d"
+	.ascii	"\307}\246u\232\226\017\270\267\346\263\343\336\222\201\023\204"
+	.ascii	"^]\276\200}\r\235\200}\265m\224\224\226]/m/\237\t\0222\034#\367"
+	.ascii	"\226 mq\327=:]\376"
+	.string	"k\356\021\331\001\221\263\327=\024\247\036\312\r$8\001\263\321\013\0203\342\346\272O\227Yl\316O\302\275\327\223\234\235\270\353mW\260=\301\236\r\002\2465\373\271\373\363\264\365t=\315?\355\364E)3h+^\224\240?\312\373\022\224\344\376T\0360\236\373\355\3736\236\363u\026\345\264V\257\341\f16\032\356\336\273\362s,z\365m~\263:\016\2134\226w\206a\306\007N\301\253!\204^I^\313\026\331\246%\213\001\223;\332\270p0\247\0355\237;17\332\214\n\317d\376%\353\347L\247y\322\243\036\032?#}Y\210\355\306\202R\030\333.k\251h\263\033'\022\217\346\251\237Cy\230'-\275\356\241\"21\216\f\031\351\313~\016\325\002\322^9\2160t\357}\240#\002D\004 \267W\277\205^\306\256\207L\001\233Av\031\233\024\306\276w\357\275\001'\261\304\342 \226(\214TP\035R\241\311^"
+	.string	"`\323I(\262\250\200*1T\245N*0\205*\255\200&Q\005\236\034p\370\341$\202!\302P\004E\266]\302Nk~\020\231\035Zr\226\275\356\026t|d:\246\317\262\037u\261])\tFc\3665\330\217V*\356\200d<\261\031\344\217\332\033\316\303B`\353Q\362\037"
+	.string	"5\203o\036\363\312ja\217\211\220\211"
+	.ascii	"\301\301a\026#Zc\216Iz\202\216\236\303\231\245y\n\215\211\227"
+	.ascii	"D\001#_P\305eLW!\340\272Z\321\324\"\034\036\241\017!\341d\n\003"
+	.ascii	"5c9(\f\206-@E\264\352\246)\205\202\002"
+	.text
+	.section	.gnu.lto_gyroInitSensor.74.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\333\005\235\036"
+	.string	"\3462\264I\220\332M:\003b\336\ny}"
+	.string	"4\210\336'r8\222\301\356\203\b"
+	.string	"p\212\263\355\200\261\303)\316T\370\346\326\376';\244fm;\271(\202!\243"
+	.string	""
+	.string	"\2001&\320\024S\fxM'\332\233\253\306\356nM\032!D\312$\003\226"
+	.string	"\231"
+	.string	"\250"
+	.string	"f\363\312d\274e\311K\222\274c\363\366\310\313\315{\234{\t\207^*\252j\255Q\\S\263H)Cv\367\265\335e!\214\0017\0258\305\344\340\274\373\250K\321\007c\034@\255JW\254j\0252\330\034\363\344\n\237+O\232\017P\236\\\272\313u!S\225\ty\032b2\254\265\352\372\307\351Krl\246{\036j\235D\276\227E\262\024\233\3422^\311\023\024\201MiA!*z\003\201\312\\S\025'\032QP\263LB\255u\371$\262\361\225}w\177v\367\301n\271 WLRNE6M\214\326Y4\366n\206[i\250\032\261\316\257\356\261?4\366\343p\252(\036:\2300\312\223\335\265#XD\356\335\017\207\342\302"
+	.ascii	"\323.\210?\021a\326Zw\234\204\030\201\333\n\022\243<9\212\235"
+	.ascii	"_\277\037(\337\334\037\242\002\264$\316\244\204Y+pg?\365%&\366"
+	.ascii	"AN.O\017\377\354)O\276}\214l\035I\005\177\\\334\025\002q/\355"
+	.ascii	"\276\213\305\"q[i\367\302?\367\340\037\300\306{S\343\3055\257"
+	.ascii	"\r\215\3676\343\265\231\274\265\346\245\231\274\263\346\rF\n"
+	.ascii	"\302\004\334\364LH\013\252\001\333zq\2755$`\373t\374\f\345a\006"
+	.ascii	"\327\245\227\0346=\356E\223\272\300\316/.26}k\322\205\030\274"
+	.ascii	"\371\270\030\272d\333:\230\207\241?(\020\352\304?\251\023\325"
+	.ascii	"\371\225\303\263\256\265m\b%\302?o\215#\364\305\347\200\027\b"
+	.ascii	"L6Z\327\212\234\313\026Z\277\n\214\331\263n\254\2411#\317\322"
+	.ascii	"bv\004\241.PAY\357R$\307\242PX\222\374\n\225\222u-,\0131\210"
+	.ascii	"\303d\227\275;\201\002\377\\\234\240\366\355\336\n\013`\205_"
+	.ascii	"Y8\251S\366\317\"*=>w/|\n\206\007(R\234\370\331\361\224\035h"
+	.ascii	"\313\243\263\343\275@\241\353\361v\275\237\236\236\356'\205\t"
+	.ascii	"\037\035\017\257\247\323!\260\273\025=<]\213\335\216\247\253"
+	.ascii	"\t\177\037k+-\351%$v\375\032h\254\2754\3435h\024\207\317i!W\306"
+	.ascii	")6\366\034\226\025\261k\354\245\323\244r\227\336\340!\232"
+	.string	"\204\200\205r\2670\260\2473O\363\002GY>\026{S\225\246\253\356\245\335e \006.\327\316\360h\207\r\256\310\225}\263\033\227\232\257\271\330\251\0215*O\216\031F=\325\272{\342\326\352\373\221\271\241\226\331\212z\252H5\247\206\024\304c8\216\206\006\177\250QH\305\2204EB\013\213\nRh\f\240\002\221\261*:\021 \261SJU0\265\240\240P\350G\0250\243\241-\005\371l\333\272&0\212\362\231hg\004\205\207\351.<\216VY\305\370\304Pyr<!\303\200\204\b]\223C\350\031+\021\206\236<\t\360[\210t\270\335\022\214\233\275\020\220\366\366\020\240\351\022Z\210\322c0\331\372\026\205\013\351\203\242\002\"\346\353\201\324\005\032\210\365\ti\256\005\360\251\317\021\024\273\243f\313#\"\362\365\177F^A \220yS\312`\024\333\031!,\035\001J\361`\263\020\300\034\303\221\345\267\315\203\224\253\024Gd"
+	.ascii	"\230\260\345\367,\254\267\362\024\tT\024\243\320\032X\370\342"
+	.ascii	"\317\252\377\266\035\035\336\377\027JE}\275\033\202)\337\240"
+	.ascii	"\303\310k\334v\203\002\216\\\237\214\364\3769\251\264X\037\266"
+	.ascii	"_k5\331\327\002N*x~\300\370\252\022\024\325\362\233\017Qt\266"
+	.ascii	"\371\003"
+	.text
+	.section	.gnu.lto_gyroPreInit.75.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 \277\035\005"
+	.string	"B\211\"*pm:\240{\375\f\360\020\221u\025\r\232\032.g`\001y{u\320)[\372\266\021\252\n\377p\267D'\001\025\021\322{\247\024\256\250I%\013Y\351\254\227U\345\325P8dE\253\244\b\236\017\213J\310\234TN^\366\330\031\262\250\331\236\006#\306>`cg\303\002G\024\371v-_iC\001\320\306\366'c\366\350\236f\377\251P<\244\335\2251s\354\020\363\337\371`\343&\207\202\304\356\032n\334\345\216\267}\260\215\260\315\b\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_gyroInit.76.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\206\023mO"
+	.string	"*|\220\033CP\334N\007\253\256\303\300\313\204\304g^\033\202\214I\272"
+	.ascii	"Q\360M\n\n\004\363&.\274\016\355_\020d\271\324|.<*\371\212\212"
+	.ascii	"\006hA\211\243\302\235\324-x\013\336\202\267\240\0179i{\357\235"
+	.ascii	"dJ\001\241\001\223\001\253\001\271\223>7\322\347>\372\334Fm\356"
+	.ascii	"\"77\221\233{\250\315-\364\271\203\332\334@m\356\2376\267O\233"
+	.ascii	"{\371\271{\330\334\3126w\222\315\315\323\271\221m\356#\233\333"
+	.ascii	"\355\334\355\232\233\375\334\353\347\376\317\235?\267gp:$O o"
+	.ascii	"B^p\016&\2532\302~l\230\267\356v7Q\017\201\337\023\310\321\231"
+	.ascii	"\270_\270\\\277\031\026\306\247\034\f\303\311\265\033Fw\262\005"
+	.ascii	"\f\200\321\257\317\265\221\371\333\263\211E\021\206\347\270\236"
+	.ascii	"\315_\327\312\302\272\262\252\242\232\222\212\202zrjbZRJB:2*"
+	.ascii	"\"\032\022\n\002\372\361Y\366(\223<\310\243\333\262\353\347\267"
+	.ascii	"\035\314\265\032\250\3011f\317\263\3148\226\2312\371J\317\255"
+	.ascii	"\354\274\312.S\325}\311Sk\026\234\2739\376W\246\267\022\221)"
+	.ascii	"qz\311R]<\212\213Cq\311O[\264d\247\225+O\214\314\377\312\272"
+	.ascii	"\254?mu\342P\311MLSi^\362a:\347\344\026\323\316\246\256$\027"
+	.ascii	"\227\223\344\246d\244\250\037\031\271\t\322\316\244x\321\233"
+	.ascii	"\222L\024\035\212\"\311BAG\3342\020\\Y\222\374c\004\256\254-"
+	.ascii	"\373\370_\231\220\275\274|z\317s}\202\202+\013\222\225Pig@<\371"
+	.ascii	"W\006d}\202+\373\221y`\200\221\213\"=\316W8\306A\271\305\264"
+	.ascii	"3\037~\354\021\267DnxG<\255\314\307\273h\336\2623\222fby\345"
+	.ascii	"1C\363_\263\236gt,\315d\254Di\324\n=\316\263\r3f\316n\002\030"
+	.ascii	"\206;;\315\316\274\267\274\373\211\272[A7\320Ty~b\017\326\354"
+	.ascii	"w\006\313a\n\0260`\320:\233\371\234\207\353\263\357\315F\007"
+	.ascii	"^m\\\037\211\206\270\370\214^\017:\370\035\347aC\360:\213\377"
+	.ascii	"n\036bt\032\241mO\3649\021&tu\265\316\032\230*\342\271\234\227"
+	.ascii	"\002\006\tS8O9=\367|\347\016\317C\341\270\202\205\212\210\201"
+	.ascii	"\236\373\202 \037\372\206\033\030\005\235\207f\274\211\321\017"
+	.ascii	",\337q\303s\033s\\\323^\330\206na,\200Pk\215\013\372`\033\272"
+	.ascii	"\202zDEuK\340!0\026`<\364\247\007\344\327\206n_\354\203\246\r"
+	.ascii	"]@\275\326\231\332\275\3663m\350\006\3060\f\346\317w\246\326"
+	.ascii	"\331\316N\230l\272\004\206\273\275Lw\033\272?\r\217mp\031<\007"
+	.ascii	"c\255\260\217\334\330y\025\362\263R\304\2474\366\267m\027\343"
+	.ascii	"c\336\013\0300\360)\272\235\337i`\243\360IALt\273./F\f\313U\357"
+	.ascii	"cJ\265\264n\0272}x\250f\307f'\351[\276KL\023\257\253{\265\355"
+	.ascii	"Y\234\316\253\035Is\350\320\241u\326e\303\223\202\350J\234\317"
+	.ascii	"\275\367\020\255\277\007*\033\031\271Nw\177pj\210#\f\313 \320"
+	.ascii	"^\305\255\210hG\342l\223(\221\335\351l{\211\326Y\377$\322\265"
+	.ascii	"\247t\032\226\253\335s\314\374\320n\377j\265*\247\177\255\373"
+	.ascii	"sw!so!sku\356\254cn\254\317}u\314m\365\271\253\334\334T\235{"
+	.ascii	"\352sKu\356\250\316\r\325\271\237:\267\323\347nrs3u\356\245\317"
+	.ascii	"\255\324\001|^u\257\366\350\221\336g<\231\271\332\324W\021\347"
+	.ascii	"-\306aD\232\252\344\271\"\252Spj!\306S\f\254\013\002\310\224"
+	.ascii	"\325\334\350c\310\031=\213x\314bvs\003\006l\251h\n\\\364>L']"
+	.ascii	"S\207\025\r3!JD?\364\3129Q^\265L\007\345e\363\352\023\242\317"
+	.ascii	"tl\246/\221\334\344U\363\300\356\027\232\341^6\347\033t\226\311"
+	.ascii	"\320{ \233iX\222\320{P\276\320\373PkT\2331s\bR\320wC\310o^Mm"
+	.ascii	"0\fg%H\202\336\235\304_\026\343\260\243\\\304\355\310Kl\364\320"
+	.ascii	"\266\r1\235\024\304\260\316c\202\366\245\b\350\277\250\204@\037"
+	.ascii	"\304\244\361\246\0313\377\336|\020=4C\375\007\210+\377\247\255"
+	.ascii	"\020\206\3511\344\3256\361+Z\366\314\204\036\332~\325\372\274"
+	.ascii	"\037R\331d2W\276\317\267\201\316\024\023\204\022\324\363ove\206"
+	.ascii	"\215:7@\017\355\274\346\313\3675T\302\367\253V\371\313o\361\232"
+	.ascii	"13W=\314\217W\333\223%\247\365<[\345J\333S*\304\207\216+\207"
+	.ascii	"(\337m,\263L>\263_\265<\237\374\301\363.\035\343b\017\362\235"
+	.ascii	"\332\bF%\367\240\322\r \307h;t\030y\343\262;\221\257\354\213"
+	.ascii	"\243<\276\231;\017\375\252u\377\370\336\324\301\364\304\214\303"
+	.ascii	"}\227nN4\256V\253\215\311\207\266\357\324:i\344\250!\314\312"
+	.ascii	">\227o\274I\036\313\240\317uoe\033\357\333\001+\203e\f8\333\271"
+	.ascii	"Fv\276L\232\274O\236\310\345\346\033w\204\3410wv\026\3133\336"
+	.ascii	"(o\364\215{\343^\351K%\273\263}e_=\"@\213\020 D\2508\352\017"
+	.ascii	"\001R|\271\020\301\265\342+\305\n\024!Vp\241 \321\341\004\327"
+	.ascii	"\207\257\025\\\001\222:\205\212\020_\\,R\244\370\342J\316\205"
+	.ascii	"\371\n\377Z\233`BHg\227\345q\334\343\334\301\233F:\273\245\343"
+	.ascii	"yVg}'\b{f\2570\f\303Z\017\315\3351\252/"
+	.string	"\330\225\0321~\314\007\313z\035\257XS\216\227m\353\314H\331+\266|\262\245\232\2617X?\326v\313\277\221\003\337\331v[_\343e\233z\032X\357p\261a\264\305`]\275\207\237q\365\026b7\213\361\313x\305\226\236\371\262U}X\224\371\360+VM\252\031\263s\362\260\372\356\267\231\357\264\2352\333\311\214o\r\033\357\330\030\226\227,/\266]\225\342\313\326D\307\352\335G\\\030\235^U\365\300A\265\345[U\211\210T_u\030\007N\224\npq\312p\353\247\254\304\334\261\215UI\025\266!\214J\025\360{\343\204*j0\352\221wY\206H\363\032i \340_\232h\365M\0254\202SP\357\341\351\235\036\252\353\237\272\336\351\275\031\006M\327\253\210\373\242iR\017\355\f\245\345\b\262\240=\237\266\\\353mt7}\237\361Zj\353l&\357\275f9\336\035;Z\246oz6\260\331\250\367\252\371\225\274\227\355"
+	.string	"\031\246o\317b\276\350t\351\307\254Z\277\324F=t\35590kM\250_SB\313a\274\234\314\335\313\346u`\224\336\311\260q-\247\233\267\247\244\377F*\241\230\\\367\276=0$=\362\016\013\340S\032\013\310>\315^\246]\270h\241\013\362\n\311\356l\327\362Gf\207\0314NH\357\201\032\201\244\250\2010\006\221cfFD\244 I*\351\241\005\204 \306\034\263s\021\3000\246 cT\232\302B\007\231d\300\337,\231\354\272\242\2475\334{\333\251\026\240N\364s\247\b$rj\007\333P\272\004\204\223\350R!\006\330\265C\021\321\t\345\345\210'[\016-\362\036M\371\315\310\020]\302\bc\230\036YAh\346\"\003\005}\ts?\373j\370\035\206}\261\235\"\213\260\217\324\350F)\237\032\215BB\334T\225.\216L\206\320n\364\023\036\r\t\316U\263\020\266\325(\304\320\nG"
+	.ascii	"\272^|\242\276\351(\321ow}\250\264\177g\361\246\351\252\334\034"
+	.ascii	"\241\316GP$\201\346\006\315\223]\031;\233\310\305\3038\273E\016"
+	.ascii	"%\322\344\261\253D\346\3377\311S\346Q)\366\312\253AH,IA\373\t"
+	.ascii	"{"
+	.string	"\325+\0251R\303H\n)\020H~E\276\024\2249\350 \"V\222\272]\326\274\313\3142\314\252\325\351\371\013\354@\354\241\324\320\235\032do\362\326>\325`\205H\357^\231C\364k\002$\303\300Q&\035\207\221\367C\020v\313\003\332\373\241\274\021!\345\262\212NU\274\210\230"
+	.ascii	"\224\226#.S<\226\240\030\021\246\033P\035:6\324\234\361\224\022"
+	.ascii	"\006<\362n\007\220\246.\261iMK\317\001M\220\020\007\033\376v"
+	.ascii	"\304\347\375\035x\027Z\313:\020\377\333wn\362\317\346\333\274"
+	.ascii	"\0133n\370\035u\021 \\Jk\254>%\325*>\363\311\305\221@\t\204\002"
+	.ascii	"\210\312\254.\371\264\t\305\231"
+	.string	"vw,\265\220w\021\336\253\276\241^g\267\302}\256,\217\335^M\340\227\206A4Ch?v\334\320\221\221\006k\312g\346\314e\335\272\263\352\231a[\372\303\244\001J}\212\213H\177\252\326\006\361|F\206\313\311\334\225\313\021\300\234F5N\306\n\030\377\027\204]DP\224\033\375,\036\317X\356\345^\017u\207\300\261\376\"BLCG\264\360#.y\236\276\024\366\f\343?@\305\272\031\333\225\210;\337\370\r\362\362\360\r\325\224\221\213\f\303\245\240\267\310\021\272q@\331\f\306\342\376\356J\232h\224v\311d\210mP{#\216\316M\211\003\202)\264>@Q\237\305\002\t\3200\266\221\216\300\021\334Z\216R\204\346\006\2721\221\301\204\320\261\251\221\b\210\313]\331\253(Cp\006\325\f\374)Z\302P\221\016gE\3359K\254\222VA\251\177%&?\271\366\332;\035\350\251\273\b\241\351\033\214%\351F\255\210%"
+	.ascii	"k\324\376\274\236\247\017\311\327L\340\337\034oXXk@\313\325\t"
+	.ascii	"\3707\307\rW\271\366b\220\226\036'r\234A\222lxAY \007\256\211"
+	.ascii	"\203\311\337\216\217\237\301\317\316\267b(\343&\206\334\025$"
+	.ascii	"\337b\005W8BM\304\210\020\002\336\033\232\211`W\021\307\232\355"
+	.ascii	"\277MS\217'\0352\235\210T{\264\033\252\361\245\003/\f\254c?\207"
+	.ascii	"56\373\017"
+	.text
+	.section	.gnu.lto_getGyroDetectionFlags.77.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 \365\275\006"
+	.string	"\362L/3`m\322\001\300\216\013\024P\344.\3213\t\230\262\313\353\321\304\036\f\003\2324k-"
+	.string	"\350XL]\030\017A\360\004\023JA\035\001\241\333\366\234F\273I\231R\316`\334\34304\370\034\334h`\3334,8\264\314\203\rC`\367\240y\r\302\271\327,\326^G\251\227IA\366AnE?\303\234N\236:\363;\322Y*@\305\224\227m}R/\354SVG\266\323\251\001\037\023\325C%\273\024\327\311\2160\021\r\333\036\333\342s\274\303\343\250\0201\211\0166H$BLv\255v\371\200tF\271\200t\246\030\217\317\350\337\343\t\240\320EU\237g\005aw\235T%\272\365\266\013l\033\330\266\b\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_dynLpfFilterInit.81.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\217\002\r\022"
+	.string	"F^nH\340\320(\035^\233\230?\232\006d\316\23123\2653m)!8\365G\305\377\261\200\021\310\006\206\212B\034\330\r_\355\327\315\276\036\245U([\266\274M\253\2101\306h\230\300\316\201\201\002\375@\037\3620\247\022B\b\331;\245\\"
+	.string	"T"
+	.string	"X"
+	.string	"~\207Ov\017\001\224E-\220\251)\264\237\335\r)\210\237\016~^\307\321y\362\271\017-:,\022u\020\301\267\301\003i\311t_\b\350\023\303P\303\303J\353\034J"
+	.string	"r\345\rx\261\301\\\240T"
+	.string	"\231\302\035\330\335\217\370T!Us~!\273\353\311\"Wn"
+	.ascii	"\267\315b;\201=i\001\364\244\244\211x\2555\007\365\350\235F\240"
+	.ascii	"\341Y\315\033\266)\274\304\b\356\256\030\370$>\253\340\307\274"
+	.ascii	"\263\005\323<\353\235o\362\336\2356(k\200f\251Y\355\031\325\244"
+	.ascii	"/\373\264\326\032d\352b\177\232\316\351\371\351{x\360\250 \337"
+	.ascii	"\252\355j\250"
+	.string	"8\366\326\271\ba\007\263E\355\347\304\177\263\303\241\243\257\223<\037\347+H~\214EFF\274w&\245\215\314'5\253os\t,7\324\f\262\355\305\006\303\321\227\217\302O\361\f\260u\325\374\233\033\360\336\251\300v\355\323l\367\200\273\250w\370]\033+a\353Z\005 \256\325\314a\233\3444\242\211\031\026}\210%\023)\034K\342X2\032\303\022\221\020I(*\215\341G\001\213\023F\245\320D\024Ka\307L\352\334R\027\203;\266[\212\252Lg\204\036\214\036d\b\2271\306\240\364\244\314\001\232Q\377\305a\204D\243\221\367\356\243\321Rc\331H\315\312\355\356\202\364e\273\216\203\222\205\314\347s\016\216\254&\346\005= \260\002\031\261\243\007\263B?K\f\327\343\0348\2341\303\t\r?\235\236\306|)7N1\nX\365\363{\333\034Z\374\312\322q\357\315\223\367\310\230\262E\331\272\222!\304\371\270\r\267Xx("
+	.ascii	"2\b\312\252\n:\321 \"\177\205\227\020\243\344\355\210S\323o\002"
+	.ascii	"\311*\256\327\2476Y\\\005Y\320\202\260\333\270Z(\356\001\357"
+	.ascii	"\203\t3\321&\262eD\2709\f>A\325\036\26552\214\227wm^`\215M\350"
+	.ascii	"e"
+	.text
+	.section	.gnu.lto_gyroInitLowpassFilterLpf.82.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\007\b--"
+	.string	"JOt\021G`\\N:_P\247J\351~\253\376\023J|\244V\201\004:\245\r\020\323~\313\b\277\024\305LUM\355\313\275\360gwA\350\346\025\210\030~\303IJ\305\t\300\365\022'I\344\235?\310\377}\037f-!\204\220\275\223\f\375"
+	.string	"\357"
+	.ascii	"\013\001\371F\233\277\202\314\034\255\032\234\234[\021-\373\037"
+	.ascii	"\225\n\213\347\257\374\031iK0y9\267\026\232Whn>m\031&-\002\333"
+	.ascii	"\325P\253\315h\277\035ayjFO\373\001\373\344L\343\241\274\350"
+	.ascii	"4g\2629n9\267G\275\200}*\274\377Q[8$\366i\377v_\355M\214_kg\373"
+	.ascii	"r.\253\342\226s>j\004\354\323\341\201\324\247\350\177\324\247"
+	.ascii	"\335\306\356\273\267fYh\td+\n\234\234s\022\366\341k|\264}\357"
+	.ascii	"`\343yv\200?\037\273\252)\212\257\261\177<O\216\273\243\343\300"
+	.ascii	"U\211\313Q#\\C\312\276t\374\207\n\025\020\021\351\272q}D=\276"
+	.ascii	"\300\316\256J[\316\266Y\306\321+\373\002\373\212c\253\211T\344"
+	.ascii	"M\321\341\230\2560t\230s\006z\311\270\350\337\276\264C\207\\"
+	.ascii	"\322\253\306q\326\317KK\005:s\376xYW\030\276\253R\316\271o\322"
+	.ascii	"\353\353\035|\367\031t\367\261{]\n\327y\346DC\2612\314\207\307"
+	.ascii	"K\347g\3163.\030+\305\364Q\337\261'\313\313fZ&\003\323\t\372"
+	.ascii	"n\b\316\313Mf\004^\272\373\356\007f\006N\316\307\213\021)e2\313"
+	.ascii	"\273\274\334f\004O\201\360\337~33n\346\264n\235\356\366x\261"
+	.ascii	"\262\373\370\371|\306i\314\243\273h\370\366/p\266\367\200C\371"
+	.ascii	"\207\336"
+	.string	"|\013\235\312;\350k?\320\235o\237ky\013\217\345\335s\267w\020x\233'\275\275\343\273\r\364\335\376\255\267}\277\333lz{\365\335V}\267\323\3656\312\336\306\354\355\273\336\376\001\001V\230tP\226A\360\2316\323x\316\311si\026!w\376Z~\266\277\371S\371\261\374n_\273\317\005\315\315\nF\270\322\236\245\277\245\201Z\332\351\005d\2165a\260O\357\245|\312\253\274\355o\rt+\n\363\230|/\265\245\020\024V~\305x,Vh\337\362\020;\306\272`4\026+)X\200`\026\004@7&%iC\357Nqs\004\222\350\221Y\333\320Y\323\t\360\322\304\n\3407\317\300\265\363\314\371C\305\312\016\302(\216\301\204\033\302(\016f\211\341m\325\301\272\317\247X\331\351\036\356\343](\223$\335\273}5\031\b\324i np\001\026\327\203\271V;\334O\323\201\f\234\325\356\366\321\024\017\230\265\007b\210\343"
+	.string	"\213K\3624\210\271\272_\250C\030\037\333\2200\355\264\356^\367\007\020\006\352r\306z\262_\306D\210[\207\326/\252O\203tb]\2226~\256\020\306\270{\004\211\373\344"
+	.string	"<\224\201\217=\2041\016f\205\275A\346a\265\035\231\003\217,\347\226\360|\202\321\312\031\253\350b!|\257 \211d]\034\304\f\223C\346a\003O\310\316\244\006\341[\006\271$\353>\273\273\304\347\230\330\234\263\203~\334\345\232\372hO\233\350t\237tR\237>\335\003S\243d\r\353>\373_\336J\001\305\247\026Lh\324\322\025\324\324\324\204"
+	.ascii	"T\304*\250\247\245b\221i\212\205\024\024OU\361\311j\305\025\207"
+	.ascii	"\253\246(\242\325\n\"\325R\200\252\nj\324\023\223\023\352\002"
+	.ascii	"\303\211)\250\2248uU\205VIA\025\321nB\222\242\272rJ*RI\025\243"
+	.ascii	"\210\305\244\250'&\025IMT\305$$\001-5E\244J\252\222\222\242J"
+	.ascii	"\002\266\371hV\302\302Y\375.J\307K\007\345\001\016qj\3673\272"
+	.ascii	"\217\317\216\017\036\342 \246\231\034R\314\350\3720\306<?\214"
+	.ascii	"@\220W\353I\310\3152\016\201pbB\003\036 \356\301;\177\363\037"
+	.ascii	"\006\372\340\037V\341\266\352`\335\343\315>\234\005\007\233\222"
+	.ascii	"5 V.\215F\236l\376\267\3734\317\310\371ae\003\355\330\"\234\332"
+	.ascii	"\255F\027b\256\243\013\361=r=:)]\276\004\027\342\"\034\304\034"
+	.ascii	"kC\212\335\001\230\305\335F%F&\367\311\356\313I\021\300\330\344"
+	.ascii	"{F'\r\352\342LM@\262\302\367\212\212{\360\212\217,r\340\035F"
+	.ascii	"M\261\212/\304)\016\200\226\250a0\305\020S\b\325\310\210$IRh"
+	.ascii	"\f\220\002\221\251*\333\021`-T\214h\302$\205Rc\207\201\364G\203"
+	.ascii	"EE\237\372G=\271\256\260M\236\247zM+\372\3249\302)\027P\037#"
+	.ascii	"\004k\202d\235D*\240\026l/\253\262\301e\264\334#\330D8 \205\206"
+	.ascii	"y\352\253\340\370\t\320Z\3071\003\251G\213X\323;D\202\254\257"
+	.ascii	"\f\255|F\262p\202\036b\221R\217\270\213\t\031]\266\377\243\252"
+	.ascii	"O%\223\367zT\f\341.\251\377\025\220s\341\205\361'\337\312\026"
+	.ascii	"\364\325\215\3316\324\247Bt\205\217\037\273=@0\354\007\357%\366"
+	.ascii	"\270\021\b\202R\251e\273\031=P.D\376\r\223\001\305[\220\241\360"
+	.ascii	"\235\"\347\277\tP\026\026\355\220\013\033\021\374\267\330\003"
+	.ascii	"\211\335\232\370\2118(\013 \361D\343\351\032i\212o\341\276(f"
+	.ascii	"T\346\035U\372\262\374x\027\023D`\356\013\031F\205\257\025\307"
+	.ascii	"/\273=\226\332\233\344'\005\\\341\006\323i\206\266\336b\225\b"
+	.ascii	"\273\fP\332\264\324\033\345\t\020VU\327kd\360%\302#\317lxn\302"
+	.ascii	"\372\n\245\rD\217\3276\206\354(\336>\377\023:g\325\227\"\332"
+	.ascii	"\034\177\212\001\006\314{\177"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.84.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\351\004E "
+	.string	"\306;\320H\200ZN:[\204*hhAF\206\b\305nuGo\355\223\215\217'A\204\2016\222\270\256\206%\266\376k\277\241\324\033\276\353Z\211\310[l\307\013\216C\332e\212\016\201\302\275WF\343\245\362\017o\033\252\204\220\275\345N2\270"
+	.string	"\261"
+	.string	"\303"
+	.string	"\226\177\374\222\2443Q\002r2\336\342-\230\265\346\225\346^\243\202[\256p\336\002\325\353\334\230\215l\036\234\267L)\363\275\236\204\351_Kl\357\355\221\226\274\327\310\200\021\234\267\002\256+o\351u\312[fb\036\343\363t\233 t!\207L\322\334{w\035\204\373\325x>)\323oN\263\264\265)\023\337\264"
+	.string	"\366j\305\325F,6\375\246\np`6\244g\001 RT7St\245\221\361!E\365\262&`3;s\263\027\320b#G\325E\t!\036LH-N\021\307\353\255\350D;W|\252@\367\336\223\235B\025\203\224\232\026\356\275L\211E\2513\316\2319\214\231O0W\257?[\301\337\272\345\242\026\364\304\026\345m\200\343\226\032q\nH\333\230\215A\332W\314\357 \333W\r\356\037\314?\037;\373\234\224{N\312<G\236u'\345\035\235\227\235s\376\365\347n\374qO\236\317\033\312\346I\2714)[\223r-)wI\231\226\224?"
+	.ascii	"WDL\361[X\356\215j[s\263\330(C\216\374\307\376\344_\366\312|"
+	.ascii	"\346"
+	.string	"C\341\233\361-\311h\277R\3674\260\272\322\330\202\316'eH[7+\256\344\035q\261#\371d|k\302\224\3640\276\023\nUjFn\307\200\200\306k\303\264\332J&\375k\t\347>\270\326\245\203-\211\337\204o\017@O\335\304?m\373\270\256\035\340\3105E\310V\302\204\004,\274\334\225?\271\275Q%\346\250\206\234\272\367\336\262\257\270D\023V\237\033\"]ZC(\375\264s\245\271\376i(\376\257\354Fq\004C\373\335M\315\f\251\322\216k\332\225\315\360,\370\245\362\247\337Q\252\304\004\325\304\316\202V\327>}\263\322\022\343,k\242\216\265\247u\355;^\301uO\347\266d\265\r\333\034,\r\017a\367\025\363\264\256Q\034\2558Q5\234k\236\306\261\312B3l\263\323\004\302z\\\250\3245\355\"D\022\244m|$\007\275\212\320Ie\247O\366\235\331Y\231\035I\276N\f\031\300\272\027x\"3\321\321x"
+	.ascii	"\326\356\275\021\370R\002\277\242\030C5Dy\364+B\202\241\364A"
+	.ascii	"\211\310\210\207\004\203\347\313\260#c\203\n\025\275#\244\013"
+	.ascii	"8\031\033X\020\035\365\214L&j\320\363)\255\330\375|\275\237\021"
+	.ascii	"\357\2673*\032r\261#\362\375v\r\006p\357\005\317\267;\352\365"
+	.ascii	"|\273\233\021\370\376\001\366\317\b\243$\013\260\2037}\3057-"
+	.ascii	"S\247\255V\251\340gC1\370\331\024\310\353\271\340g\3534\317\221"
+	.ascii	"\013\213p\007\001\372c(s\272l\333f3k\340@O\344z\251\272\211\371"
+	.ascii	"_\\\344\326\210\314l\364\265\016\020\260\356\275\023n\231=\\"
+	.ascii	"\r\304\201[/f\2378\005\344\240s\021:\267\224}\263W$Uc\216t\337"
+	.ascii	"{\233\314\276\242\265m3\213 AO\314\351[\250QD\305\004F\021\244"
+	.ascii	"\224\314\244\221&I\007`\002!SWv\021\360\255344\311\355\215\\"
+	.ascii	"\320#L\253x\032x4\034yu\355z\\\2677B\r\362w\321\333t\027\321"
+	.ascii	"\334\003z\252\016zE\232\277-K\203+\3050@\3630\312\340\226\020"
+	.ascii	"\204\326~\271\ts\200K\016\356:+\312\360\f#\325\341\216K9\be\355"
+	.ascii	"\321\266\362\004x.\364\366M\333\221\334\315\213\306\353\017'"
+	.ascii	"\017\215rg\257\234\021;\273ipB\n\204\036\326\2103Vl.\001\216"
+	.ascii	"\215\277\227\023\353\331(m\200Ao\300s\024\233\001BJH\306F\305"
+	.ascii	"5\363\330\026\360\177\271\230\217\021\021\311\344\366\322=\006"
+	.ascii	"\246|am\202\251\n\250\312Q\266F\375\001"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.85.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\351\004M "
+	.string	"\306{\320H\220VN:\306t\003\2172\220&Z$\217C\262\034{X+&\016\3431\fJ~\351w\201\272\016\022#0\272?o\376u\017\3668&\0202\blB\301+\2609\275;\232`\367q\334!2\367\250\024)\261\204\020\271S\n\271"
+	.string	"\260"
+	.string	"\303"
+	.string	"\245\177\374\021\244#I\362q2\326\342N\250\365\366\025W\253Q\301KW8_\372\220\307\331\331F\271\007\347KSj\377\353E\226\016\246\344\262\326\036mi\265\032\031\030\301\371R\300{\346Kz\034\363\245\227l/<O\225\t\202\327\226!\222\270Z\253o\203xO\032\357\223.\235\346\324\231%\271t\311\327Y\b;y\3255\206Xd:\r)\300\201\332\220\236\005\200LU]\227\302\253\314\027\037SU7\311\004pjb\256\366\002Ul\344 {R\\\304\207A\321\262\246\210\343\344\256\350D\227W|\"}j\2557;\215*\n)\325Y\250\265\232\022\213Sw\315m\213\331>a\223_\001_[\341\013yi\242\026\364\304\026\346\313"
+	.ascii	"G.*D\252&:g\033\205t\261\354\257\020\016\254\206\367\207\335"
+	.ascii	"s\262\233\347\244\3369\251u^v\367N\352\034\234\237\3357\007\373"
+	.ascii	"y7\3766O\273O\032j\335Im\352\250K\0355iR\257IMM\352\017\2601"
+	.ascii	"\262\244x\256'\265J\315\231\251ne\223\256\227\375d\177\332\177"
+	.ascii	"v\322\276}4_\315\2734\263\275N\325\323\310\362*\003\367s29;\022"
+	.ascii	"\262\273\352\"\253#>\3662\337\314\273$KH\027\363\225P\260\022"
+	.ascii	"\023\367\222\314\247\311Xm\350\256\270\310\220\016\246TS/|\363"
+	.ascii	"\322\001\207\344'\361\356\001>O\313\344\236"
+	.string	"-\3676Kn\200c\027\032\024\\\t\023\022\250\f\361\246\234\311\313\033Vf\204Z\312\250j\255\325\\,\233lP$\017\315\020\257\255!\332\276\355&)o{6\312\017\232\273(\216\\\350~wi\230aU\333m\226.)7\\\023^\311\354\331o\023\2531G-ck\302\262\267<\273\273\332\032\263\233\031\251#\271\263\275\005\036\247\330\354\316\362\254h\315\r\317<,\216\007\324.\226u\266\267(\216R\234h\031\363Vgk\256\264\306\f\317\344,\001\261\036\0072{K\261@\021\021\3229\277\314?\217\002tB\311\331\233\335\247\266\006fG\021\260\023A\006\262jm:\321\026:\333\020\200\267Zk\004\337IA\242\030Ad\b\323(Ht\004#\351C\222P\321\320\021\214!`\206\034\031\033T\250\370\031\035]\260\221\261\201\205\220\321\257Hg\241\006?`\322\n_\020\370\013\026\r\005}EDA.|B\300\240\257\301"
+	.ascii	"\377^\f\001}F\277\037\320\26736}\177\204\3753\272\310\2715\255"
+	.ascii	"\220f\261\274\333\322\341l\271e*\370\271Q\f~.\005r\362\\\360"
+	.ascii	"sqV\347\330\365\004j\007\001\372c0o\326\334rukk\340@O4Y\253\226"
+	.ascii	"\311\376\026\027\2747\242\355\242\277u\200\220Uk\235\360\322"
+	.ascii	"\366p- \016\274\314\242\333\023\251\232\374\363+@\247\025s\257"
+	.ascii	"v\222\210\225\034\231\335Z+\223n\261(\271\345\332\"H\320\023"
+	.ascii	"o6[\250QD\305\004F\021\244\224\314\244\221&I\007`\002!SWv\021"
+	.ascii	"\360\255344\311\355\215\\\320#L\253x\032x4\034yu\355z\\\2677"
+	.ascii	"B\r\362w\321\333t\027\321\334\003z\252\016zE\232\277-K\203+\305"
+	.ascii	"0@\3630\312\340\226\020\204\326~\271\ts\200K\016\356:+\312\360"
+	.ascii	"\f#\325\341\216K9\be\355\321\266\362\004x.\364\366M\333\221\334"
+	.ascii	"\315\213\306\353\017'\017\215rg\257\234\021;\273ipB\n\204\036"
+	.ascii	"\326\2103Vl.\001\216\215\277\227\023\353\331(m\200Ao\300s\024"
+	.ascii	"\233\001BJH\306F\3055\363\330\026\360\177\271\230\217\021\021"
+	.ascii	"\311\344\366\322=\006\246|am\202\251\n\250\312Q\266F\375\001"
+	.text
+	.section	.gnu.lto_gyroInitFilters.87.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\354\002=\023"
+	.string	"\226\243{G\340\362f8\2228j\356;\027\241\016\204\347F\321\361\266 /^\267P\351\236\013\0040\037r\337\273Wz\020\332\t?/\177p\024$\025n\273\243\3214d!\236\341\271\t\033dB[7f\024\357\036\"d\357-eJ\001b"
+	.string	"["
+	.string	"o"
+	.ascii	"P\313\344\321X\361\361\267\177\"\263|\241\017\311>\202\370\326"
+	.ascii	"\366\353\024\004\003\310nN\345\236\013\250\356\275\016\340\273"
+	.ascii	"\227\207}\367,\263}<\007\264\001\202\220v\214\234v\027T\024\227"
+	.ascii	"\275\323\224\371)\226U\3156{W\342\332\262\345t)\273{\242'\217"
+	.ascii	"\215\226\231b\331]g\315F\342\366n{\201\355\004\266\276\004+@"
+	.ascii	"\2739\b\374\026w\261\301Wq\317\342M\276v\317\277\371\356\301"
+	.ascii	"T\301m\007n\304\311(;GK\375\261\337\355\356Z}l\330\307\333D\323"
+	.ascii	"\257L\2734\335\312t\211\246I2\315\322\364H\246W\232Vu\351\224"
+	.ascii	"\246\277L{\232\356\272\264j:3}\001\255\023=l\027Z\332\035\021"
+	.ascii	"\025\023~C\211\245\004R\254tD\017T\270\215\032+\375X\334\240"
+	.ascii	"p\237\252\324@JU\026>cFF\n7z\372\351{F%\227'\305\360\264\345"
+	.ascii	"&\344itej\247*\267ab\3625\247\350\350\314\252\235\314\221f^\250"
+	.ascii	"\266\334~\340\364=CM;E:\375\311\335\235\251\3728\374\256\027"
+	.ascii	"\212x\344\344\020\333\031~\024\252\214\256\024nMO\246yQ\030\037"
+	.ascii	"0\270\210\342\213M\207P\203\213\3130+a\314\203\f(\306B\261&F"
+	.ascii	"\004kf^h@\230\230\b\256\fph\023\023\0039\204a\fd\345p\336\255"
+	.ascii	"\372\030\345\210\210\b\275\272t\236\222\022\246&\312\243\nb\202"
+	.ascii	"\tGiFI\233A\203\020\212\211\2463\237dK_j;p\351\353\301\227t\270"
+	.ascii	"J\264\005\3419p\224<\235\344\210\222\250\035AB\b\235\231\245"
+	.ascii	"$\0016 \340\002\0311\262\003\230QH\215'q\212{A\n%RX\355q\217"
+	.ascii	"\355\220\354s\240\013\013\312\353!\f\321\327\0054\023\234\340"
+	.ascii	"[-\tA\241\221q\273\207\245\311\325\206\345\361\220\342 L3n\001"
+	.ascii	"+>\236\033,b\025\203\231\215\256\263\216\230..\244\3120\270u"
+	.ascii	"5\007\336\320s\017\371\021N\210\266,2\035C\316\331\017\t\363"
+	.ascii	"]\326\265\005\314\204\003\226+\267]B\017"
+	.text
+	.section	.gnu.lto_isGyroSensorCalibrationComplete.88.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\035\t"
+	.string	"f\021@80\221\322\001 \264L(\275\244N:n\253\271\330Tm\241F&N\231{\257o{\375#v\240]\333\354\361e\203\021\026JP0\247\331\2658x\221\274\013\377J6\331;\2450"
+	.string	"0"
+	.string	"/"
+	.string	"\266\315\340\200r\n\344\241\302\201X\tq\305\350\354v\022\236<\365\227\362\357\362\t\326\254\366\202\251\376"
+	.string	"\"v\327\357\005\033\271\341m'\330n\260]\023\217\002& \260\317rvEj;;\023i*\266Q\366\307\366{\366Y\336\202z\354\004\032\330\226\354Cf\267[\260\202\347\321\335\013\270G\317\t\270\3074\226\347e\246\220\215]\017\243\341\331m=\274pl\030\240\244<\372'\356\3610t\023[\275\232\335\251\036,\261\277\355\356\032\222x{\354\207\3609t\326\022I\"\300#\321\244\035\025\262\322YK\244*K\026\024\027rD\253\024\035xb\220\250\314\230\223\312O\267\367\006\021V\220e\337\304\035n\220\243q\005\f"
+	.ascii	"X\211\"34\030q\r\307\2622\343b>\306t\325\263\214\313(<\215\207"
+	.ascii	"\352\020\306tM2"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.89.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375` \002\345\020"
+	.string	"f\036kF\360\222(\035\242w\327\210\320\371\376\274\247\370\361\032^c\2217\005sl\313\2306\255\301=0,~\337V\033\233]\032\017\255b\244\201\360\353\341s\003\347\262\350#\323\265@?\203zs\214\242\336\037\250\221\275\211\224)\005W"
+	.string	"R"
+	.string	"["
+	.string	"~\320\242\345\3149=\217\266\212\355yT{\305\366\230d\301\212M\004XN;\032\3006\250hr\346\004\273\365p\323e\334VM~\b\353t\331iy\334\032\032\333c\356\340\223\205+V\313\227%%\005\274h BX\337*\007\232sZW\254\f7w\333\"\333\tlU\005\272\232\"\007R\372\303\276\211\237\240\340\303\270\224\242_\245\310\307\357c\256\2405\203\271\2404\264\301O\327e\177\3030\344\341\355`[\335\331\324\334\246\226VG\253\327j]\365A"
+	.string	"\204h\301\272\254\306\234\030\302\036\323F\274\021a\373\340\307f\306g\036S\271L:Rl\027I\271q%\016\325\315\007:\364\027\"\0049@\217nc2\340\303\234)\006.>\223\340\303<\372\304\363\344\243\334\203\027!qC\346e&\206\322\320Gq\203N\352\343/\332\013gk|\026\256}pf\250\n\177\205k\037\232\313o@>\236\306v\215\2445\313\231\363\364\227Z\016\215x$\013\243\256D\362J(\242R\207bRr\322\205H\245n\244\200\275\t\"RW\301\363H\035\210\3726\267\250\313i(\261u@F\3008\250l6\356\356\005\333\273\006\241\366\333d"
+	.string	"\265!D\320\257\024\364\355\311\227\305u\3018\267\235\230C\247\305<\272\214\030%\334>\366\273\0020 \240\002\0213\252\007p\222(\254D\210_\034\027\242iyg%c\216\335\035\267\232\3518\016\332\255#\324a\230\305y0\003;$\340MB\022\034v\311d\023D\322\245+\207\005\362\326%\\\370\270^\205\350"
+	.ascii	"3\253\332\002\242v|\233\360\275\361\270\256`1\260,C\2342s\201"
+	.ascii	"\231\013o\357$t\221!\260\033\322\256\253\245s\267s\315\023"
+	.text
+	.section	.gnu.lto_gyroStartCalibration.94.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`O\005\355\035"
+	.string	"\306r\265J\260\324Q:x\206\215\265\036Q\230\236\331S\036K\200W\324\262\326*\236B\367G\002O\260\005\030\024L.\032\257\\\377\213\343\237\203\242\025Z\335\034-sTo\332.?\200\006\005o\235"
+	.string	"\323d\fR\364\177\371\266\021\022\273eJ\001\235"
+	.string	"\221"
+	.string	"\246"
+	.string	"8@/\"\354!\333\374\270\246\355]\033\247A\321\203D6\357\372\n\"\251U\270\300\tb\037]do]8\243\332\340\330\"q~\325ZqT\306\213N3g\262XI\2160\272E~\371\240\200\213\323\3504\340\315+&`\213\235\021\220\305\3008\301\342\261_1\2558O"
+	.string	"\212I\305\226)N\342"
+	.ascii	"\275|YT\277\024\037a8T\277*\333/\tV\273\261\005\365\341\267\304"
+	.ascii	"o\304\302\240\230\200\266\037\322R\363\347\203\r\250\265>\352"
+	.ascii	"\273\364C\332-\037\324Z\275J\277\023w\355\266\227\330\316\331"
+	.ascii	"\343\201G[4\205Q'\037?\375@<\325\177\020\371O\006\332\355\225"
+	.ascii	"v\344\307\323\0034T\034m\361[k5\242&\")\265Y\2222\352\202B\005"
+	.ascii	"i\273\330B\337R'\373\260Jc\324\224k\232r=S\256ev\035\263k\030"
+	.ascii	"r}\033\327\266]\327\3125\255\\\233\345z\266k\331\256c\344\272"
+	.ascii	"\034\327\344\203?\375\372\001\004\234>("
+	.string	"<pp\321,a5Q\364R\235\214Dj\330\376T\217\223\376\262\252\3508q\350;lb\311zj\n\326Z/\374\320\026q)\0073T\206\322\320RJR\016_\316\233@\210\371K\316D\302\004\n\024\310\2173\364'\r\251\030*\343*\246\333\212\204\2411\224d\222\004\345\333\242o\024\206\236\304\227\023]\341I,\304jEr\340\0379\222\013\0302\354\2252\220\037o\364\304#\370a=5EIm\215\240\226\025\251\340\037Z\303\255t\fl\270\021\016EN\004\310\365\345u\264E\013!\242x\032\251\223o\337!m\324\003Q\013i\273\370Cw\270\220\235\233\031C\363<HO\315\224Z\253\003 \257\362\361\237>Z\367\363C~\264\321\017\217`\210\365\325\024%\025A;\235\320\016\317\203\016\304N\216O\220\016\210\227\023\352\361t\021z:\033\3630\330\361\206|p=\336\256\027\324\323\303\005\351v\200p<\274\036\216\001"
+	.string	"\357B\364\360pB\273\035\017g\n\217NcX\202\215\027\\\256\034Q\037\215:\235\210\334\022\004\026/\244\024\270\244c8\253Q/\235\233\256,\271\223Fk&\235QZ\316\257p\2312:S\362\030\225\22546\345\n\267R\245\244\237\222\235\326p*:\0066\\kJ.6\344\344\351\016\307:\315s)Q|r?$\375\371\005r\255(k\350\225\316\315\023\0167'\303\2179\200Z\210YTYhhMo\250A4\306\021C23\"R\220$Ic\240\002\231!\243n\021"
+	.string	"\255UL\235\264)Ls\263T\357\340\331.\360B\223\361\275\305\207\231\340\355c\033\271\230*\201\216\245\267\261\"\243o\267"
+	.ascii	"\272x\3071\242\343\365f\242\256y\214uKV\017\233>\005\005\"Y\236"
+	.ascii	"\346\032p\332d\347\302!\316\371\352\377\375\177\316\322\031\\"
+	.ascii	"CLLKM\004\005\242PzxX\227,-\266\313\006|p\263U\272\2656\250\224"
+	.ascii	" @\030ht\374>]\263\030\343\350Y\243aQ@J\216\017+o\023\336\221"
+	.ascii	"\t\001z\301\033\213Z\022\323\t\026@\303@ [=\343\233G\256L+\342"
+	.ascii	"\337\225\2307\204\030N-G\026\201\006\367\256\205J\002\024\370"
+	.ascii	"\244\342/\007\223\227c\330\215p,\320\354\\\004s\025\026\305\337"
+	.ascii	"M\017\221\177'\246=|3\272\032"
+	.text
+	.section	.gnu.lto_isFirstArmingGyroCalibrationRunning.95.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"\025\n"
+	.string	"fSD90\345(\035\336@G\236\003Gh\226(\004\306\351%\201\262T\177\202\367\344\307.\324\266O\260?P\007@0{L\265\254\n\n\270\340\324\016\242\264@\021t\035jd\023)S\n4"
+	.string	"5"
+	.string	"1"
+	.string	"a\246\033\357\036/\315\316\307t\0244X-\037\350=\006\\\374\312\200%\212T\rX\2726\273\373\325\363\004\22221\235\335u~\240\305\215\335\366\202\355\002\373\002\001WM\007\306([v\350\245\252\354_\253)\333\351\230iM\037\323\240\250\200g\255\354\242Z"
+	.string	"\366$\226|\330\026\331\031#$\210\334=\344@\r\254*L$.\273\001XT\225\177\2754%\362\304\244\315I\344\277\324\233d\220\324{\356\256\247\252\262\335a\327d\031I)\345\213}\220\207t\276\207'B\371\357\321\017a\217\001\366p\264-\324\220q\233\306\201>\\\006r`x\310<\033\227q\b\254A|\266,B\323\266,\023\3565\345\274\f\236zp\325\223\355\250\233\221\222\254\032\365\246"
+	.string	"\243l\005\022"
+	.string	"K\b\230P\307\353C\231\251\302"
+	.ascii	"c\240ZA\210\230wC\320\256\211p\bJ~\030`,\013\327\036V\370T5d"
+	.ascii	"\345\216\226\034[[\312"
+	.text
+	.section	.gnu.lto_performGyroCalibration.96.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\242\016\275I"
+	.string	"\352|\220\033:0\244N\007\300\f\361\246g0\246(%\3438-\336D\203H\013A!H\353\272\007Y\353\227z\354\256\322\036\334~__\017N\371Q\201cp\331\356z\317 \204\204\354n)\245\024\255\001\207\001\251\001\324Bxb\314MC=\314&R\027#\003\271\363\024\006\2712\353k\351\234o}"
+	.string	"\331D\322X\332i<C\372\016;E\r\005rc#\330\203L\326\201\\@\360\220\214y\bs\223N o\240&\266\033\3569\334qZ\316m@\326\323-[\333K\"\365\262<\266m\013\241W\216\261\354\365*\331R\354_\277)\322n\230\002u\021^\333\266\315^\231\21307{]\233\316L\301\302\355>$\375l\245\203\240p\26537\233\336\273\315\247\244\241\332\026\256\361N\333\366E`\007\313^\271\257\251\330^\227-\305\366\312\227\331\021\300Y\033\345\322\273\222\006'\262m\333\255\227\343\357d_s\224\337\006`UE5%\025\005\365|r:55\231LK%\273&\337/7s-\332"
+	.ascii	"\254\352\272\252\216\214S\331M\307\220\361)\305i\235\037\235"
+	.ascii	"K%\237b\222\022\332\266\225z\224\322\353\013[\230\206\002\323"
+	.ascii	"\317\344\204A.\226\332Y\006\220\264\355\246s\376\244\364B\361"
+	.ascii	"\226x\210\327N'\366M\260\217\215$/ln\335\224\244\020\270&\330"
+	.ascii	"\212Sj\322)\215\243]#j\361f\262k\017\017\314\273\221\263\247"
+	.ascii	"\355\246Y\234\2518\335\222\274j\333\326n\212\305\231\020xa\273"
+	.ascii	"\322\313\344\003\267\304)T\202\336\022\265\335\264\315\225\311"
+	.ascii	"\006\223\036\t[qz%iu\026\205Ls-\315\331\316\323\b\024\247`zN"
+	.ascii	"{\22354_\251t2Y\341,R\213s\355,\3314)\215Ps\315\314\277\3474"
+	.ascii	"\f\275,\214\274\260\205iWz\265m\313\256\266\306\326\034\240\231"
+	.ascii	"[\220\231k0;\355\bjU\006\231\331\0230s\213N\304\203Ysm\333f`"
+	.ascii	"\276i\032\321\275\303\232\273y\335x\365\016]\276\273g\305H\247"
+	.ascii	"\204\355\265\371\250\203x\221l'\221\314a\362\343X\303#x-P\026"
+	.ascii	"\2738\032t\310\314'q\206\327\200\341\261>\303+\013\241\255\221"
+	.ascii	"\3366\275\bb\331\266\355\005\356BmH\004\t\023&\330^1|\303\001"
+	.ascii	"\303\227\365X,8m\326\303N\370\254g\375\240\331I\275\312\025~"
+	.ascii	"\302w\332%<\374\325\212)\002\265 \025\314\302\205\267\232\013"
+	.ascii	"\266\327\n\337x\232\301\232!\272\036d\260\376\023c\331\266f\027"
+	.ascii	"\270\375\\>\031\334t\275\366\235\236\301\366\212\340{\260\031"
+	.ascii	"\2301\024\310m\217\257\314\253\337\266m\364?\216\271O\352\017"
+	.ascii	"\307\334]\266\026\350\306\017\207\342\235\277\236\316'"
+	.string	"\236\316&\236\316%\336\231\304;\217\200r\026\361\316!\236\316 \236\316^O\347\017\357\354\341\235;@9wE9sx\347\r\357\254\341\351\234\341\351\214\341\002\323\231\013\312\271\302;O\350\276n\t]\330\254\365\316YOg\254wF\320|\335W\r\330l\365\316U\357L\365t\236zr\226r:G1\235\241\230\316\317\246\363\023\323\331\311tvb:71\235\233\357\314l:399/\233\234\225L\316,\323ye:'\233\316\317tv&\347^\361\177\034\231\351a\371\305\2766J\265R\033h%\254\353\302n\300>|\270\311h\221\356\260\021\305Z\017\277\b\220\376\026\003\033\201\370\020^\377\341A\3346\036\347p^\036\376\303\240\356\360\036\272\276C\037\376r/\336\245\353\273O\037b\201\344\364q\215\310`\276\005JI\201\333\325#\324\262(\362\221\206\2720M\037\307O\r\255\262\034\376\306\037\"C-y\026h\325"
+	.ascii	"\"\3378\307r\345\250\0309|#6\003?C\276\026\270\245\371\315\377"
+	.ascii	"0\177\211\314o~\243=Jx\346+\0135\226\243\025:\346\3071\022V\302"
+	.ascii	"\257QG\271\277F3\237\304\304\244\345V.\265\003#;\025\257r\243"
+	.ascii	"|\245\367\354\214]>\323\003\260\223v\251\313\265\230\334&l\253"
+	.ascii	"-\237\275\302\305\354\243\315\344\267G\272\234j$\254\362[\r\373"
+	.ascii	"\324\327\220p\323\361}r\243x\253\335(l\257\312\357)\365\217\244"
+	.ascii	"\2662\257\016\260\204\246P\371q\f\241\255~\215*r\364\207\301"
+	.ascii	"Y)\227\212\267\232\326w\236\236\272\023\311Q \263\217\262\037"
+	.ascii	"\3271\330\r\216\321\246\303`\356d\3037\235"
+	.string	"f`\246P\244\333\036\037\227'\237\275r\263\2349\023\037M\276\344\326i1z\332=\223\305\350h\006\346\330g\337\370@\252UY\337\315\322\2704\317\313\256\036\225Z\243\344\373\257\337hn\377\311_\375\240=z{\251-\270\245\253\267K\277a\274\3245\367\337\202`\b+\361 \026\245{\247`\322\325\243\362\3576\252\241$\302\365\343\230!y0\213\361\255#\335;\005q\r\351\312Y\335\241\346\211\214\204\340\375\314W\314\035\343\255\306Wf\037e\356F>\234j\214n\235\205\ff\372\361\236\331Z\244\240_\371\206X\rD\302r\344\020B\306\222\3610b#\231\243\207\330\016\262\260\261\0350~\210\361\020bc\354\006\217\0366D\b\371\021\346#\214\210\230\212+0&\343\320\022\033;\242c\213lL\214\354G\030\331\326\017\0366|l\341\030#\333\322\022\300b@\302\306\266\204\210\211\215m5\373\312\372\341\330\253\354\245\\"
+	.ascii	"T}!\341\325\233\272\r\245\304R}\325G@s\223\202\371 \224\322\201"
+	.ascii	"9\301\2537E\365I\250\221\362\332\312\205wC\001\t\202\016b\204"
+	.ascii	",\224\272kbX\325\200\235z\277\364\367T\255\002\252v\003V\352"
+	.ascii	"\247>\200\237\2646\025\316\f]\204\036\362V\223\372\336\303E\372"
+	.ascii	"Q*\034l\324\217\3755\302\36188\240\210\240\212\240\212\330^\243"
+	.ascii	"~\003\365Q^\233O5\224\021\313\fu\004\205\324\200\220m\002<\212"
+	.ascii	"\0028\365\244Q|\373\265\267A\201\364{\303`\356\207\342\373MK"
+	.ascii	"}\03435B]\370o\364&\021\332\352;R'\243\262\332\352/|\317i\260"
+	.ascii	"?D@n\3111\215 (\250\307\3636<\030\201\357\336-\330\273r\004\030"
+	.ascii	"\271\336\371P\317\352A+#\3557Dn\372\332\226?T\253\217\314\332"
+	.ascii	"\266,\301\363\271~\200\0374\273\247\177>\013\t\n\351k\240\222"
+	.ascii	"\362\236\236\265\243&\222\304\367\264\024\t\356\3518\350\357"
+	.ascii	"\220\363]\315\233\247\271w\n\320\\98j\215\234\276\351\235\337"
+	.ascii	"h|\276\336\251\304!u\361o1\316\343\211\3772\361%\376\204\241"
+	.ascii	"\235\031\023$\276\304\210'!\342G\030\362\227\327\221\021\361"
+	.ascii	"mH\307\203-\310(\346\336u\2350\036\232\222g\3608\262q\333#d:"
+	.ascii	"\201\204\362\236\234!~\016J\311\200\334\325{B\354u\215\226\201"
+	.ascii	"(\250q(\005\031c\206FDD$I\222\f\007a\005\304 &%3\017\021`\261"
+	.ascii	"C\216\221\244Ikn\274\251\213I/8P\337\231\244RU]9\256\t7\316u"
+	.ascii	"\252\t\030\342\013\251nL93\264\302\371\273_\206G39D\"\355(=\333"
+	.ascii	"\232\254\321\352H\335\270\263\302n\235+\007\f\245G\257E0\367"
+	.ascii	"!\213\217h1v\370\222\365\030\016D5\346\375\002\276\316\032m\201"
+	.ascii	"\024\377(\322\240\222\261\027ZV\376\371\217\336o\275\202\013"
+	.ascii	"\276\226P\322\024\342\267\243\243\255\377\302\376\227b\344\303"
+	.ascii	"n@\360r\232Q\274H\222\034\2009\030\231\022\213Mo~\251\373P\241"
+	.ascii	"\321\271\026\311?I\336\"J\317@x.f}r\352\363\212\221a\004y\231"
+	.ascii	"\243\330\2670,\327x\206\366\327\202.\237/\035*{\006\313\227"
+	.string	"L\377\371\200\201O\220<n%\352i2\203\021\372l;\211\310\305\250\362\274V*\246A"
+	.string	"\001\261p\275\312\fY\351\233I\322}\306\002A\344\003\254\370I\332\025\035g(\232\236N\006\367y\225^\370\303g\343j\334\351\372\204|\363}\n\262)\357\257\212s\f\006>9\367\035\310\320\005M\331\325\261\343\024`y\036+\221W%g\036*\301G\022\315\332\330\351\262e\277mb(\336k\247\271CJ}\245\202\272sA\332|\243;%\\s\212e\232>\247)\bX\312R\214\324g.q\230\317\365\302\257^\212s\276\317d\214\b'\021\036\262p\202\f\350\302E:\251\352.\274\017CnW\224\325h\375\250\3664a\322g9\005\"O\271\367\032\006\\\300\027\340\007\362\363rw\225\0352\236\221\356\270(\013\306\266\302\355\235\241\316\024'L\343\374fQ\243\342\007_\323}\276\241!\324\316K\353\305\305y\251\343\001-\007rG\022\303#z\024\t0A*\216\311]\236\251\201\266*\261\270q\032\213\302\021\205"
+	.string	"\340\021<c\0207t\243|H\335_,`\377l\202\243\214(TBF\037\331\0073"
+	.string	"5eyP\301`:"
+	.ascii	",\036\310_\254\341\323\225\335\fQ\013V\352\276\323LF\357a\b\344"
+	.ascii	"\340l\340\365\256\372\0342\260'\201\207\177\360\336\301\224J"
+	.ascii	"\243\274\3642\207\232:\217\n"
+	.text
+	.section	.gnu.lto_handleOverflow.97.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`Z\003}\027"
+	.string	"V+\227I\300XM:\3609\315\300\201`\032\027\261\261h\323\020\200\346\261\262\310\362\367G\272\275w\343\227<5t\2675\323\311G\244E\024Y\271\"\322rv\267\271\337\024-\263\t;()"
+	.string	"\024\251OJ\007@\333T\210\020\262\267\334I\006\200"
+	.string	"w"
+	.string	"\205"
+	.string	"\245\210wPO'\266\033\f+\335\255\340u\035|\257\273\373\271{\035\277\271NDb_\272[\024\031u\2277\233\340{\265\271L\367J/\240{]\327n\225\231\022\375bp[\341\363\203\251\273Cvq\327?\257\253\224\247k\357\351\274\374\320^\377<\035\317@\213 \241wOR\b\315f-1)H\223M\006@\363\2416\335\375\035\237&h\2619=\235\356\336\371C\013\372\276|wO\354\356\205]\336\t\263\032\261\325p!\213\373\272\273\301\036\310\203\250\3661^w\3540\377\363\272\357\320\275\236OE\226l\265\033\021l6\355\226\261\311C\273\247\315\266\335nnL\235{:\321\017\363\362\013\326\271\037\235\353\321\271\035\235[\351\\J\3472\235;\351\334\007\b\321\005\b\005\355S\244t\0035m\351\244z4\343\345\277\373}\217\373\330\005\267\347<6\247\226\303\321\263\013\276\376;\026\334\335\364F\024+6\222"
+	.ascii	"\241\021\273\222/!\261\217\261(Q\354^?\316\251\345r\bm\331\335"
+	.ascii	"\325\343U\307\036\237\313\215\034\tR\212F\351\310\027\251{\355"
+	.ascii	"\262\234V^Q\256|.7/\2628\004/\214R4J8\312WQC\222\343hv\367\213"
+	.ascii	"yhAf\266\320#'\233Zv2\363\221fL\260]\360\242\305\325(u\367\203"
+	.ascii	"]\f'\222\032\360\342u\310\344\0205\244,G0\334\251\310\272{kd"
+	.ascii	"\335\260\003g\220gQ\233\001GT\245Z\341jT\251F\024\001\261\305"
+	.ascii	"\023\241%\262\304\b \306\r\027H\361\003\004\031\326\004Q\225"
+	.ascii	"\222\320Z\211$\351\001uZ\024\316H\366`\bY\344\310Z\211\254p\225"
+	.ascii	"\342Q\205(\222\025\342\024\330\221\203H\206\255q$C\260\204\235"
+	.ascii	"6\333>-MI0\216}0\234\344\275\226\260\324n,\270\354~y<\264\323"
+	.ascii	"\355sg\262C\241B\205\356uD-\307\204\245\343\231\321y\272\030"
+	.ascii	"f\001$\343u\005J\223\023\307\360\314\222O\227\217a\370\304\367"
+	.ascii	"\361? \220\002\031\242\253\016\204Y\260\244\330\263\361\312\026"
+	.ascii	"m\327\273Od\031\264\033V\241\00176\304w\037\247\305\353\363a"
+	.ascii	"\221\340g\302\345\331\344A5c\343`\326B\025\355\034,O\t\254\270"
+	.ascii	"\f\030\245\2625\204\tm\273P\333\326\316\2342$VTF\243P\f\204\330"
+	.ascii	"\256I\311o\361G\277\230N\302\236\003\013XC\211#l\353.\213*\004"
+	.ascii	"\350\017\207\016\213\363}Xk\030\216\301\204\223\311\020\\r~B"
+	.ascii	")\326\017\202\363(\302c\224\rt\243\350\364v\2752"
+	.text
+	.section	.gnu.lto_checkForYawSpin.100.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\233\003\305\031"
+	.string	"\226-\243H\260\230Qc\361\331p1\317\342\353\rz\224!\206sfd\301\327\370=\320\335;\301\333\231\231\nN\351\346v\314\202\341W\003\213BF\274Y\312G\005\3049\375\201\276U=1k\215Q^\3143\277h\273\355\275\267\334R\246\024\207"
+	.string	"\205"
+	.string	"\223"
+	.string	"\326\017\310[\333\204m\336\336\264}j\237\350<\333\213N\270\274w\006\222\322\275>\006N@\336\316<F\274\r/@\274\265\315\256\"\203\342\3464\350\r\361"
+	.string	"\243\356\275\254j\343\266\227\344(\332\260R\233\257\312\345\274\034k\310\003#\017\025]\030\355P{'+^\2043\367^3\207\202\206\037zEVf\260x\361\032*\3201i\261\312\341\302\230'\032S\336;M\221\273Q:\326\334{M{r,n\325m\353l\267\354\272\"8\252\305>\220\007\261\361\203\374\022A\337#B\274}}\357\001\270\004u0\\\350\320.\266\357F\353\217\375\360\326\032vI\275\"\251aH\352\227\221\332\034\251U\007\336\345HM\212\324\343\213~k\251\251\245~"
+	.string	"\003U~P>z;*\024\337U\321e\313u\262K8\016\374\355\373<~d\342?\034a\227t\037\007\372F?\333\315}\256\271\251 \035\321\275\367\306\377\331\364\315{\340\314\340|7HEC\312\211h\301\003\265\254\036~M\252j\326\017\331\211\362\217|\211\223\n"
+	.string	"\335{!\034h\013W\202!&\312\275\327\001\222'\311\240a\303\006\361\226\336F\304[U%\261C\222ZJ\372\221W\270{u\020\220\265\254t\310\216\320\215v\361X\311*Ce'x\2409\234\251\003y/\316\201\277\364\"-?\350\326\256\363\024o\307z\2433\310\331\022\324\361\212\016\244%\250d\251\022\25557\005\244\343Q\"Y\236d\204\365G\310\221@\314vMQX~\243G\347Tm#\276z\370I\t\016As\302^5VL\006\203\311\\\003\316Z\253B\355\244\235\025b\257\021\026nZ8"
+	.ascii	"h\030N\330\353B-v\316f6.\030\273hd3\034\020,\332LF\213\2354V"
+	.ascii	"\354\325\202\261\\3\032\213\206\200e#\316\031\253&\223\315X\246"
+	.ascii	"O\3475:\365V\332\ne\255p\021\322\361|\310\247\022;\246!,\243"
+	.ascii	"O\214K\020W\324G\005\224\247+P0uUe\262\360L\275T[a\352\217\036"
+	.ascii	"\352x\022\314\301c$t{\2237\235\230@\201\276\207\202x\373R#\354"
+	.ascii	"\222\244\314\304\033\002\022\353\217\315K\250\201H\204\fB\312"
+	.ascii	"\005\022\311\204Y\020C:`\002\231\2713\017\021\320-D7\211\226"
+	.ascii	"\315G\227%\317@\315\204\301u\216H\340\214\b\213&\242\312\370"
+	.ascii	"{\252\213\361\016_\013\303\034\310\240\302\032]\321\024X\357"
+	.ascii	"\227\330>\001\267\035D \371Ws1\037\247]\212{&+\017\r1\303\027"
+	.ascii	"\222\034'\247W\352\204\236\300%Y\t\030s\377\271\025i\036\325"
+	.ascii	"l\026\224\003\313^NE\002hq\244\246.\005u\326\275\326\363\367"
+	.ascii	"@0\343\326\335`N\271\021s\367$\246\377\307\246p\325\366\217\300"
+	.ascii	"\310\361\205\315\024}\030o\335\245\364f\236%\253\001"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.101.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375` \002%\023"
+	.string	"F\343~I\240\326Q:\304\272\006!\007\313\034fp\3567A\207\026\277\266\267\025\274!o\232\370\f\026D\223\237\007\347\246}\253\227\361J\355]=\032\373XOq\313`\032\256$\303\370i\223\\\221\276Rp\016*\340\365\206%d\023\271S\ni"
+	.string	"]"
+	.string	"s"
+	.string	"\273\240\013\330=\202r\332\355=\260\313\352\323\275\263\204\237\253\017\b?\035\263\215\024\020ZY\f\3577\304\264dw[\272\342\261\207\023T\031\363e\017Sn\270\317\025\356 \310B\324\302\266r\023\002_\250\236\252X\267\232T\360\245\b\312\004\353F\003Y\242R\0209\357\222\304m\204\224\242\314\356Z\332n%n\361\266mlC\260\345,\273{\026\237~P\370y=\357\r\236\306\\Q\322n&G\273G\223\252\302\276\216\3438Z\217lQZ\345\273\037E\224\026C\351pJ+(-U\372+\016n\320\244\226xS*\244\267D\243\223\3651s\270\360\225\356\003z\317z\033uE\272\335e}\332@6\353\363,\333\227\366uO\212=H`M\250\"O\0205\211B\"5u\2375\374\251f\301\317\347\rw\342\320\222\333\255\341\340\261\361M\370\251\242\367\335\345\005\020\335k\334\306y\323\317\201\234\215"
+	.ascii	"\277\343PT-I\"\237\224D\031\251\177B\325\0161\206\324$\023\003"
+	.ascii	"\220R}U\215`TS\231}\032!\030\374l3b\244\202El8\353\\\306\016"
+	.ascii	"\202\237\355\341L=\253\335\225\260\304\343\"\220\013/\027\314"
+	.ascii	"'\207&\30580\256\227\b\235\026\354\345\202\371\344\300Z>;7=-"
+	.ascii	"\234\027\254\005c\300\256\0179\257\026\b\227\353\325b\365f\007"
+	.ascii	"W\217,3S\332\301\335\3350\201\024u\002\005y\233\025\b\251\314"
+	.ascii	"\241\212\372\246\241'\025\316\303\302\312\327\361\035\0270\314"
+	.ascii	"\310\333f\302\317PO\225kB\332\371\210R\217 \263E\242\250M\223"
+	.ascii	"A\336fPe\377\001c\026+ \220\002\2311\353\001\230E\021\212\247"
+	.ascii	"e8\313\367n0d\347\337\254P\024|\372\026\"0\317>P\b\306q\265\006"
+	.ascii	"3\255\316!\213\2210\tm\263\211\310\032?Jz$\013\255\253\203\301"
+	.ascii	"s\201\252C\\`\023\337\020g\300:\202\206\nPg\374\346\033d?\360"
+	.ascii	"\307<\3435\020\270\371\234\006\330H\357\334W<\243\0160\n"
+	.text
+	.section	.gnu.lto_filterGyro.102.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\264\003u\026"
+	.string	"&\250\215J\260\020V:p\213\361\204\024\347\347\027\005QY\370\233\303\323\366\227\207iO\r\225\235\360t\270\261\324\270\216\324\220c\260a!\225;\343\022wwO\260\377C\372\017\032\355_6!\270\315zR-\374\227\376\017-\313\226\264\275\345N2p"
+	.string	"o"
+	.string	"\201"
+	.string	"\255\327\335'\355\205\373z}\360J\273/-\025\355'\224\244#dw\213\274.\202\326\253\200\177\260^\351;X\257\177\355n\027\306\205\300&\031\332i\232\321\3352\326\260|*\374\322\271{\245<w\373\362\004\351\323G\344\275\322Xw\303|:\364\300\344\361\345LJ\344s\276\360\037?C+(\237\317gy\322\335;{\276\013_\326w\327fw\031\354r\214\267\023i\002"
+	.ascii	"\273;A\323\235r\373\r\257ks3\337{\335\337\260^7\370\303\003H"
+	.ascii	"\"\177\301)\234y\305\334\335<f\241]!o\2769h\027\304\203#\006"
+	.ascii	";\323w\343K_\027\317m}n\311sY\237[\347\\\372\271<\347\316\317"
+	.ascii	"}\b\367\354\020;\210\335=W5:E\235\032:\323\277\364\271\373\335"
+	.ascii	"w\330\017\367\305\264E\332O\347\240\224D\022F]\211U\312\213\017"
+	.ascii	"\336b\345\036\200,Z\\VA\370\n\025%\317\214\2221f\361V\346H\241"
+	.ascii	"+\001\242H\271\224\312O\254\230\030\253X\\RE\270\211\022\225"
+	.ascii	"gFG0\246\274\3141\022#X.\202\212\266<\204\2555\305<+J\302\346"
+	.ascii	"\006O\3363\214U\200t\230\267{\020\024\024\030\273\373\275\"\355"
+	.ascii	"QF\230K\325L\242&\227Q=\f\022\376\301\326\202:\363\020\350\027"
+	.ascii	"T\302\231W1\177\332\"\201\331n/\rP\026\334p:\230V\256"
+	.string	"6\241\205\256\313H\314\214\255\306\202\243\325\304\324^Xn8\035\214,\207\273\345dh9\231L\255\305&s\301\345d#\003\3666C\303\311jn7\234\354%\354s\020\322Q\210\220I$\016\347T\026Z\327\221A\230\217S\344.\3461p\027_\306\360Xa\3228\355\356\246[\340.\006a\251\237\241\225\323/g^\255\007\277\330b\210\203\273\240\201\031\217%\026\212~\301\f\034\334\342-\331#L\250Q8\242 t\206\202\021\232 II3\006\360\002\231\261i\007\020XD3C\222\0162\026\350\016\346$t\333\202\336\024\177I\355|=\306\346\035{\304\376BP\330?\254\237\002Q\312\025\036\260\271\2176\0038\372\245\036\330\\\007\003\333\264\352/Q`\033\366\213HC\\ \2404C\237)\365\233\351L\255W\255\212{\223\340\271\025 \355\260\264y\002\221!\302\300p\252B\273\177\330\007p\365\361!\267\367\270e=\022"
+	.ascii	"0\"\"\240\265\003\033xm!\210\352&\343\251"
+	.text
+	.section	.gnu.lto_filterGyroDebug.103.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`7\006\035!"
+	.string	"\346\271\314H\200XN:\177\221\262\200O\325T\006\343\345\320\016\352/F(J\352EV\327\323\303\374\002N\3157\376\261\235\305\201\3413\333U\311\312\355\036%\331\020\264\344!\360\346\374\\\023\345\253\316L\345\307\374\317\2675K\b!R&\031\264"
+	.string	"\242"
+	.string	"\305"
+	.string	"H\366\312\365\211m\232Y\315.\344\253+\302\356\347\356\273\366a\353\373y\257\177\025\017\266kf5\023\352\332\212\253\265&\370\271\016v?\t<"
+	.string	"\372\323\374\016\372\363\276-\356zyX\262F\310\202\032+Sk\005\366\217\355\233a\337\036\027\357\353\361v)z\232\315\305}Z\201\353,U\246t[\"\305t\237\231\323\026\225\303l\320\304=\037S8\316\373\355\230\252\372\356mQU?\"QT\234\3368\n\365\202\317\0327M\004\310)4n\244\236\314"
+	.string	"Wxt\271\362\034C\312\211\373ag'f]s;\246p\234\323\n\265\326\345\243\324\324\267\346\273\213ew/\354\242h?\273\317\006Dm\217\316\304\305\256\326\372`\257\344K\220\366X?7)\030D\177r\177\354\355\313\310u\277\261,\n\f\263\257"
+	.ascii	"\\\t}\253P\27691\335\356\307N\246\264\307\332%!\377\370s/D\177"
+	.ascii	"\276\257\374\016\222%\322\213\312\310u]ke\352\276\332\rc\342"
+	.ascii	"\327\356\261\013\364\373\361\351\271\330\227\347`_\235\346\315"
+	.ascii	"1yq\316{\223\362\332\234\2745)\257\357\344\355\241\274\274\223"
+	.ascii	"w\207\362\246'/\332\274\247\311k6o3/\237\367\005z\006T\331NY"
+	.ascii	"\2553\352\316T+\247Z\326\305~\260\363\356w\037\275\376\021\203"
+	.ascii	"bB2L\261\310\321\264.W<Ba\t\306\327\351\332\326\277x\351u\220"
+	.ascii	"\326VO\363zw\355\323\205K\221\353po\274\242\327\3356\354\266"
+	.ascii	"\354:\310\310\334\027\001\346\351\264\027\355\236\036\262zj\246"
+	.ascii	"\335g!JX\036\261X\370\331\022\303\3332P\270\222vzv\264\241\341"
+	.ascii	"U6\354\330\320n\245\025\322\353+=\247\020AHJ\371Q\316\354\263"
+	.ascii	"S4Pi\0060O\357r\350\200\376h6Z\303\312\251\231P\364of\242l\332"
+	.ascii	"\001\017\207\362\341'\271\306\323?\310-\265\263\257\332\t\221"
+	.ascii	"\203\345\233\\\r\304\206\030\342\037\207\320\237\251\226\243"
+	.ascii	"\234\221\353D<\215\350lA\273#\216Vt\326\302\350O\222\265\326"
+	.ascii	"c\271@\003$0\bY\020\016Y$\355\210\301\025F\346\0361(qb)X4DJQ"
+	.ascii	"\"H\242H8d\221\004$\016\205D\023HD\240\211\240\321\022\360hH"
+	.ascii	"\00420\260\302\023HC`\n\241p\b\364\205\325\277v\017\256\013\r"
+	.ascii	"\211\233\2133v\223\257\257\226\007\307\003\352\206\343\004\327"
+	.ascii	"\351\030\013"
+	.string	"\256\323\037\243\204sb:\263\326Z{\n\256\323@\215\246C\351F\206l\342\272\3755Cm\232\200b\020~\361\341f\311OM\310\346\230\227\303MD\022\330\210\3239\315s\366\303i\264j\327WBo\322\334t\220\f,\244\027\325O\333\364\326\364\357\f\212\tK3\305\"O\313:]\361\310\223$\347l:\2452\344d\306\324t\220\326\234O\373z\003}\250a0\303\234s\246\202\031\t\"IZH\007\340\002\221!\252m\021 -c\210\271\231\331n\002\024\265\375\273\265$(4QV\303\370\254\"%\316\371LV\250oD\016t\244\334aZ4\345\356\036\205\367\326|\"\253\317t\251\237\t\225\2341\340P\003\374\f\023Sz\243'\f\001(\250\0033\335bIf\232G\177\302\207-'\r\202\300\032\005\215\327\346\200\340F\340\220\205\215\362\036{\\5q5\235x\262\241G[\316ZD\213\304\205\376\005]7?\320{"
+	.ascii	"^\007\273\232\350O\006R&\272\r6\330(\376\312\n\016c\261\322\362"
+	.ascii	"\2011\340w2\001w<\205\232\341\013\n\037s](H\025D\374\3162\214"
+	.ascii	"S\241E\205Gx\241W_q\310\275\023\267\356\307\0275\260\212\004"
+	.ascii	"!-\310\032l0\\{-\277\"\222\343\004\032,K\205\351\236\351k\206"
+	.ascii	"T"
+	.text
+	.section	.gnu.lto_gyroUpdate.104.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\016,\355\203"
+	.string	"\252\307\260+E\020@ng\f\375\234T\267\251,\200\306\374\210!%\213\224\234\035o"
+	.ascii	"\276o\372Y\374\036Tw\240\220&\026)\007\216.\212\353\235f\266"
+	.ascii	"\313\030\301\rCQ\344\fY\017U]&n\300\\Y\303x\311N2\245\224\002"
+	.ascii	"\217\002m\002\321\002\213\203\330{\203\330k#\355\255A\354\245"
+	.ascii	"Q\354\235\361\2752\2767\306\367b\021{\257\212\275V\337[\365\275"
+	.ascii	"T\337;E\354\225\"\366\302H{_\244\275.\206\275Qio\213\357e\361"
+	.ascii	"\275+\276W\305\367B}\357\323\367\246\370^\024\337\353\364\275"
+	.ascii	"'\276\327\304\367\226\370\336\246\357%\361\275L\337\273\364\275"
+	.ascii	"J\337;\342{E|o\210\357M\372^\020\337\373\341{=|o\207\357E\372"
+	.ascii	"\336\243\3575\372\336\342\367\022\277w\370\275\377\275\351\367"
+	.ascii	"\372\367v\332\313<g*\006:?n\352\250\361?\315\325J\341\340\332"
+	.ascii	"\367xc\330\216w\271\271|g\267zPb\315\325\354"
+	.string	"\310\251F'\216\212\177q\024\345\370\241\325\301\b\314\363\346\003t]W7\354t\302\315\005\321\347\315\322\311.\263\3416O\270\271~v7\230\214[\327\025\211\177\367\311.\022\377\020iw\271w9\216\345T\236\203\262F\353\272\246\206\316\2726\255V\252\310\017\305KC\376\224G\f\371W\335\005\304\315\345\352T'\215\024g\242u]\261\334m\235\323&oV\253\274M\037Y=\226\r\217\035:r\340\270a\243\006\215\0312b`]YUQMI\301x\341\"\252\005\213\025*\240\236R\240p:a\242D\023\t\246%\245\021\"B$\201\370\340\241\003\322\221Q\2218\374\324[]&j\031\221\231\201\3616\211Z\351\2255\266)\354#M*Lc\334\021v\026Q\353\313\331\"\356\301a\213x\3310\255!\247\244\\\326\220T\232\307 \357\030\\\243\250u\344\3009\322)Au\020-Ya\201\214\333$j\0349\004\352\0339"
+	.string	"j\0335\242\201M\343\006\236q\203\r-\003\220c"
+	.string	"B\033\213\017_\361\231\241\255\370\270\212o\257\251\366\360\324\036\031ZJ\017\303\320\223\247_<\331\305\363\256\243\354\270\205\335\234f!\207W\310\211\323*\352\030\252\016N?\245\210\3165\n9v\222\213\353\023j\330\204\2324]\002\216\233\340\3204\211(3EY\350\2457Vz\023\323#\302\260\2100`:\004Q\353\214\311I\351Tr\357\n\367)c\246K4\260\005.\033\304\2321j\303\244\262h\372!\232l\017\035\210Zkgi\214\304eK\037\031\231)\313\322E\025f\312\320\2328\034\353W\261v\246\205\323>eZR\2505\334U\314\304\332\245D92C\016\223\326u\345\2652-i\023\265\326u\335&3;\343\r\200wS\277\335\335\261\373\302Ob>\370\221\203"
+	.string	"\303\\\272}"
+	.string	"\004\347\301\225ml\035\374\310=X\265\227.j\311\016Q$\347\322[Z\313\221\0339R\243\365\n*\034\365\225\024\316\216VfFQ\270\241+k`V;\343\245n\203\264\225\272\035\322(\234\240\346\\\327U\232L\225c+\203\207\245\330\324\276\350Rz\254\243\020\335\275X\330\310\016k\260^y\365\206\374D\301\241\023\016*zw\037Z\261`\"\034\020\375\037\034^\352\206\366\351\004U\327p!\243\322 &\364C"
+	.string	" @\206\374\036%#\344\336\236:\361\320\230\031d\001\034h\237\254\007\005td;h\324\235\365"
+	.ascii	"\347\302\272\260\212o\330g\217\034\273\007\260\rF\033\n0\340"
+	.ascii	"\321j\271\256+\264\235\r-\375\004\361\302\2720u\345\n\0312\235"
+	.ascii	"s\271b\006\254\220\037@\261\316aY\316\006\341?!QP9;\204\375 "
+	.ascii	" \261\\W\261\033\374~\230\316Y\016K\225\361\213K\312\315\215"
+	.ascii	"hn2\rD\212\353\032\306\207\373(X\026\303\277\026\020!2,r\244"
+	.ascii	"\231l\271n\255\260O\314\301\226\363\230\327\006\373\300\232p"
+	.ascii	"\233\353\272\372\236\345\275\346\223gY\017?\311\254]\364\226"
+	.ascii	"\357,\240\342\272\202qr\031\005wY\353\314\221Y\327"
+	.string	"U\212\355,'\213\313\265lm\256RPQz\321.\323\341:[\313b\026\tW3\031\327\220\237\275\001\247\241\244\034ZX\027\3566\221\355\312u]\301\326\333v\207\275\034\247\016\016\035\3171s\233\243^n;\352e5\266\343e\261\243^F\036\365r\330\3672\330\367\362\372\275\352\367~\031\365B\371\336\022\276\367\311\367\222\360\275N\206\275M\322\336\021\206\275\"\244\275!\020{\231\024{\275\276\267\353{A\370\336\017\276w\311\367*\371\336$\337\353\001\261\267\203b/\007\337\313\365\275\033|/\222\357\325\340{\267\2767\203\357=B\3545R\354-\362\275\030|/\221\357\275\340{-\370\336\n\276\227\202\357\235\200\330+A\2617\202\357\205\340{\037\370\336!\304^\007\212\275B\276\267\201\357\r\362\275\f\020{\217\305\336\005\276W\201\357M\340{\215\304^\004\212\275\007|\257\001\337[\300\367\022@\354\005B\354\035\200\330+"
+	.string	"\2617\200\264\367\007\261W\253\330\353\343{\263\276\267\307\367\362 \366\356(\366\352\370^"
+	.string	"\2767\307w@<5\241\212UJeJ*%\035\003\342\342\216-j\200T,E\246`\351Zx\344\274E\003\264(d!\200\017*\022L\204\003\"\001V(R\021\200\241B\203\004\005\002\024"
+	.string	"\324\217\300\037\336\2049\203 \n,\365E\360I\313\006@\037\256\225\345\243\207\363\360\254\032\376\374z\364\241\241\217\017\217\024m\177P\354\340\333\323\341;"
+	.string	"\320\221\303q8"
+	.ascii	"z\362\340\311\241\227g\344?;G\346\303\303\341\324\346\347\304"
+	.ascii	"\r\247\363\264\233#'\316\r\023kJ\330p8o\234n\350\216\234\347"
+	.ascii	"ml4\325h\326\360&L<&\354!A\303\347\344f8\r\0313b8\226\313H\003"
+	.ascii	"\207&\306\231\027\\h\001\213\251\215\335\226\256\274\214\232"
+	.ascii	"\346\003J\206\311\bY\371\2257E\245,\302\321U\276\253\246\240"
+	.ascii	"b\0312\231\225CQ\371\224Wy\t\177\333g;]\314\221\t=\f\225\267"
+	.ascii	"\023p\216\271O\216\372\322\310\177nG\346\3732\345"
+	.string	"\034e*\271rg\360\326\320\216m\204\224\263\255Yy\027\265d\232\224\bW\256\237\361\013\377\2639\205!`\370\0265-k\351Y\\\213\272B\026u\313\226!\177\223\036\031!_AM\343?5WA\365\302{K\307r\344\274\245_\201\341\374\307G\202\352 Jr\345.\361\326\360\205\363\027\263-\266\027\336\204\371t2\346\272/j@\270\322\255,\357\265\322z\305N\234\240\023\226\365\330y\363*v\322\234\212\013\227\342\302g0\357\340>x\r\243\334\b\235\r\216t1/\245\352\326L\246\272\r\371\243\334\317\346\004&\345\250\232\233\016\026\306Wc\215Bn6\241\372\326\203\306\250V\264\352\030\265\214\324\027,}Q\034\314C\013*\334`\207\250\336UaP\341\004\373\220\016\306\353\326\260\205\033\241\353C\252\032\256\026~\301\222P\020\215\361\230\233\360\210\205\027\"4h\205\263P\341O\276\002\312\225\\\205?\021\002\212\006\336"
+	.ascii	"\225\302C\370\22379\001\241\177jH!\210\302\375\374\364qr\024"
+	.ascii	"'\274\204;\231p%?\341O\204|f\340\3333\321\344!\274\20479e\320"
+	.ascii	"\223\007O\023\"8\022zyv\366\311\233\256k\030\013&'\341T\3211"
+	.ascii	"3K.\302\231\374Dt,\251\344#|\311\237\b\351\354\263\357,\237\307"
+	.ascii	"\276\273S\362\276\303\234\263O&\204\3121\362!h\234#G\353F8\023"
+	.ascii	"\002\342\205\360$"
+	.ascii	"\027\341M\3167\373\344;1\034\371\016\352\f\341|\207n\237Ym\214"
+	.ascii	"7\330\034\257\232I\316\211\226\207\004\215\352\024]I\303\306"
+	.ascii	"\271Az\316\271CZ.\256\316\331YlK\303\346\315\006\3514ovH\303"
+	.ascii	"\241is~s\346\0056\2746\323e\352\310\300Rlk\210 Xx\013^\\M\212"
+	.ascii	"\244^C\266\222p9\300D\311VWW\bG<\354\221\253%]N\220`yu-\361R"
+	.ascii	"\262\345\205\245\204\253H\022\254#]^XW&v\311\007[]XL\226,\351"
+	.ascii	"\302Bj\206\261\267\255\021\230-}a\216\324r%\322\337\252\030\351"
+	.ascii	"<\226D>\230\017\263z_\2016\257\231l\363\206\374\034\346\274\246"
+	.ascii	"Pp}\270r\221\300\364`8\376`~PU\351/\234f\271\222\305\234\341"
+	.ascii	"8\223S\r\317X\022\271t\023\021E-\020\230+\367\351b\331\306\253"
+	.ascii	";q\006\363\347\033K\"U\347\365\313Kp\325y\314\f\024\377r'\347"
+	.ascii	"\230\240\260.\034\364^\276\n\025\273@q\376\303\234{\342$x\t^"
+	.ascii	"\302n,\211L\356\223\367\226\237f\344\347sy\342\274\247%\313!"
+	.ascii	"\365\215\004g'\023\n\242_a\237\305\307\362*\030\277pP\337\336"
+	.ascii	"\206\374N\234\357\370\321\230\213\340\334{\270r\371\207\2675"
+	.ascii	"I\241\211K\r\352A\343\261_\202un{6O\016\315r\207+\367\247\360"
+	.ascii	"\b_\212\276\314\312\bQxO2I9\035?\232\333\370r\233\257B\025\f"
+	.ascii	"\216\2422}b98\216\0331\001\251\272\305qn\303,\314\020\305%\345"
+	.ascii	"px\024\026\301\373\314\223yEQ\335D\360*&\332\rW.\253T\206!Hy"
+	.ascii	")*\225\342~\224\037S\253\234\240Z\2612\344\017\301'`\006\202"
+	.ascii	"\233\233\302\334\2046\230\370#?\314\313\231ty\201\340J\274\353"
+	.ascii	"\003_\342 \024.\"\374@Q\016\202\211\226$q\017\\\t\242C\206\222"
+	.ascii	"\244\204\006\t\n\344A\r\032\035x4\220\003\357\200\213\203\r|"
+	.ascii	"\313\271\220\270\006\276\001 \364\017\222???}4\310\300\217\370"
+	.ascii	"V\037\237\0312\330\333#\203"
+	.string	"\236#3\\\271)\033V#\303H\212GM\313J\357\024q#\336\304\207A\021\"^\201c\340M\207\306\310\\\340\0268\021\267\372K\355\354\323\335@S\274c\017B\323:\027\270\273\001L\237\373\354\300ezgl\277ejw\354\275e:\307\002\357@&\036\005>\201W\340(\242i\234eZwd\302e\n\207\002o'3\215a\237\034\bM\235F\366\203\246n\216\274\007M\351&p\016\004\214\341\312e\342\255!\fX\0224\327D\340\022@\020\301\003>\304!\210S\223\346\00140\030\371\357\314\221\371^\030r\325\326\202\225\003-\230\021\342\0164 $\2103\340\r\214a\341-H\0300F\376K\231G\346K\227\fT\215\241:\372\027\345\002~T`\201\004\334\350\n\254y\351\222@2\215\313\026\343T\030)\004<K\212v\200#`\300\001\0058\001n@\212%\275\222B\001fi\231\221\377R+G\346KQ "
+	.string	"F\333\235\333\213\203\202\250\002\2115\315Y\206HD$IR\250\fk\322\f\b1\214IiU=\022@\362`\214\205I\322Y\314d\024$\205\225\366\016\323\241\270s\013\332o>\310\233\033B5`\245u\363\032^\307\341\031\243\206`fJ\351\f\201\305$`\357\361N\364\363j#\325#P\031vq\222|\350kz<\324\362P\205\032U\262!\234\b!.s\322\027\206M\213\347\360\204\237\322\016@\257\375\t\251|\206\257\2166!g\233\374bG\341v\213\336\201v\3114fy-\177\253IV\3060\021\201\231\363\271\261\265\234\264\346\374\251\272\350\275\232\204{W\032\320(w\300v\205K\332\\\1775\323\333\005\3420f\300\037\265\216]\211j\243wF\377"
+	.string	"\377\355\276\\4FX\336\210*ZTw\016\303\230\363(\240\254\342\351H\324X8z\247\2130/\315\tc)\026<\235\"\232f"
+	.string	"i\215d\211]\266\305U\364\020\201\341\350JW\320\356\314\244;\300\br\2316Fcqo\026\311\005\260\217\217\211l"
+	.string	"EuY\371CG\214t\350\013}\212\225\360G=%\271\2564\327\234\030\342:H\026\025\301Q-\243[P\357\t;\256\022}\277\020B\336#%\226\006\276\354\267iCA\213J\272\373\246^\302\307\\\021\240\347\327;\"\230\320\\A\272\013g\027D\330\277\226\224mE[\256i\224\255rHP\347+\034\f\221F\020\327$\251Q3\351C\352H\034|N!(T\302\016N\352\322\322\235\374\020c\344*\275\357\300E\261\263eWs0\353'?[\260\206h\232\321\203\251e"
+	.string	"qz\034]\344\3268\317\240\215\002\206q\212r\233\037P,\"\224\215"
+	.ascii	"^\363\342\3559\016X\312\246\341\320F}\243\352\037JW\210\332\244"
+	.ascii	"\261\236\033\261Q\034T\353\221-\365X\255zy46\001\226\375\331"
+	.ascii	"V\316\322\222J]\256\031{\017/7\265\306^\022\025\355\tKy\354\247"
+	.ascii	"\211g\373\267u'\366\317\212T\325Kh\304\005\254\277e;TnJ\234\345"
+	.ascii	" Y\337\335wu\007[\376\005s\1775@\370|\226\f\"\225\271\337L\302"
+	.ascii	"p\033\203U\353\"\201\024\226\303\267tyx$\207\230uDS\231\217B"
+	.ascii	"g\310.\243l\366u\f\277u\b\266\370\263\025n\250\275\035A\346\032"
+	.ascii	"\377\022\037w\331n\3777K\201\035\320O\216\223\206\033wn\343\261"
+	.ascii	"\277NB\346Zf\266\321\371\214PCHu\361\351X\267\311\234\233\352"
+	.ascii	"\001\325\302\216(e\212\256\243n\274\304\324\2069\306\033y\200"
+	.ascii	"\033\272=\217\300!\322\263\250\315\026\304B\342\357#:\240\267"
+	.ascii	">\342\365\214\266yCr\235\027\353\001?\256\312\222L\326S0\210"
+	.ascii	"\\Ie\013\274\252f\237\372\037*&\346\302\212\223\260\230\\y\203"
+	.ascii	"y#f\235\314\232\377\205u3B\0320\013\206a\217\0274\020P\343M\202"
+	.ascii	"6\007y\2611\255\365\352\0204[\252\234A\216?G\333\370\305`%\004"
+	.ascii	"i\216)@\357\263\244\013\307\246\263\361\300\324\3313\316\227"
+	.ascii	"#B\362\b\354\357\344k\3778&\256\210:\212\375\352\"\364\234K="
+	.ascii	"\256a\316f\2335F\030\340a,\022S\325\201\225\245uf|\256\212\240"
+	.ascii	"\216';a\370qH\200\356h\347\031\206\030\315\337\231?w\266\341"
+	.ascii	"\2543\277\315\222\376\232\267\237\243\200\272\210\020\367K68"
+	.ascii	"\356\016 X\035\352\013\032\362\n\244\034\333h\200\254|\2335\n"
+	.ascii	"\300\325\260\240\336P%\362\356\376\243\220\270\357\036-\365\030"
+	.ascii	"\256\311?=\263*\354!\213Prw%:\222\256l\360\356E\265\227<T>\004"
+	.ascii	"\204f9\037\024\021\263y_\371\345U\374\363\300\252\023\266S\210"
+	.ascii	"kED\026yR\323d\373F\214h\222\221\315{\233\367\351i\373\341s\321"
+	.ascii	"\331[\261GISH^\017\344\216\362\233\353u\355\330u\371\246+a\312"
+	.ascii	"a#\031c\203\302\352\254\212\275P\271-F3\376:T\354\217>\236\007"
+	.ascii	"X\001\222X\207@\232UA\260\272\377\205\302\031\031\223\353\312"
+	.ascii	"!\235p\0177B\034\274\257(\2448\313\214\310%\bF\026\023\200IH"
+	.ascii	"bZ\244K\356\323;\306\252v\366\233\377\021Y\026nk&.\3001\366X"
+	.ascii	"\243]\357G\223\247\2675R\371\343\247\006fp\256&^r\347\341ja3"
+	.ascii	"\233\241\200\233l\235\340\224{\214\321\354q\037}\272\241\306"
+	.ascii	"r\330\345\315\204#\004\004\305z\306$\312\252\277\354\362\316"
+	.ascii	"\211\004G\313\236\361\257\240l\266\t\267\202\016\035\2007dQ\""
+	.ascii	"C\363\237\360\275V\323"
+	.string	"\214\261\240\031\006\274\204\244va\210\2003\300\374[\177\222V\024\265/ \360g.\261>("
+	.string	"\250\366\206\320\265u9\224\034\364I\236\034\335\027\274p\212\366\266\257\303\217P\240b\370\341\2357)\217]\222g\247\270\226\343'\302Ku\305\300"
+	.ascii	"\304\356#\274\004\267\021\r\b\032q\035\226,H\245\201p\247\265"
+	.ascii	"\352v\275\263v9)\372\\\211\334(\251\242B\366\275i^\230k\025\206"
+	.ascii	"\2359\006:\037R& \005\023\344\221\325J\365\230\bM\320\236\366"
+	.ascii	"9M2\037\326\323  \220z\353\215D[\215P#` \360\262\377EAMn<\352"
+	.ascii	"\300\313\376\027\00559&\215\001aP\025\375\005\215\ff3M\276\016"
+	.ascii	"\312\030\304\323\345\272\223i\245\035m\300\002dx\270\302r\235"
+	.ascii	"=\214.\004|\200\313$\274I\215\310\373\234.\222\n\3670\335\375"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.105.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\260\003e\032"
+	.string	"\206\262\253I\260XQ:\360\341\362\006\217#p`\351\300u\001\037\213F\231\350\032_\016\303D\342\001\340\016l\0076jN\270\305\225F35\351\207\330\270\236\220\343\361m\006\347\005\360w\b\310\017\005\224\225\324\265}\261\"D\b\331[\356\224\002\223"
+	.string	"\215"
+	.string	"\226"
+	.ascii	"\265\356hN}a<M0\245\255c\237lKi\237\350?t^\344\337\007\324Z\003"
+	.ascii	"\210\244\326\035\0047\030O\275;\201\360t<*<\235@A\307\262\357"
+	.ascii	"r?2\301\037[\017K\255\273\324\336\360~\356n*[\331G1\244s\245"
+	.ascii	"\314\207\271\355|\374,\350\"\357\032\250\350\214\020e\241\001"
+	.ascii	"\024\364p\n\250M\t>\036Iw\270\370\024k|\237<t?\332\022\221\233"
+	.ascii	"\213o\200\233m&\250\265\036\310\245\317\215&\245XSk\265\354\271"
+	.ascii	"\001\335/\267}\303v\b{g\004\362=\247\276\225\302\323\357\201"
+	.ascii	"\\\001\220\322\024\031?\202f\262\311\336\355\310\305\331\227"
+	.ascii	"\265\326\035o\r{\346F\267\314\213~\224\245c\216t\003\370\321"
+	.ascii	"}\n\245a\244\364\213(=\212\322b(\035\206\322\224JOK/\225\226"
+	.ascii	"S\372\006\034<\241I\341\005\203viW\177\232\266\324(4I\307\221"
+	.ascii	"\376\243\337\350k\177\310\254Hu\342tK\210\206z\276\317\247#\007"
+	.ascii	"s\301\030L\265V\017\343w>\317\247S?\310\205\350\334h\305+P=\213"
+	.ascii	"(A\030L\001\0062"
+	.string	"\3101\271\017\035p\b\013\314\372JN\030\270 '\344\373\307\245\307J\270ta\232\214\213\332\227}\255\307\274\235\204\342\216\373\323\212;{\266.2\033\356\f\227\032\323L6\225\270\222\201\026\374\244'\021\241Z\255\302S\272\367=C\013\335/K\322L6\355\316\271rev{5\0364\331\344\357\334\003Pl]\314:\022\233\261\326Z\301\377\035\330\362\205Nm\302\345\nO\345\236\367\fVtG\262\024\275\326Zwq4\377\2160\252\302#\265\330/r#\016\372B~Y)\261\226\n\325\214u`\271Z\034pnX.\026,'\246bm \301B\300\262Q\301X)0\334\274Z8\252\0239\256\234\325J\205\362*\302\013\266\302&\025\203\275b7\254X\352\246\245r\245V\260X*\302\001\277P\260`)\234\327\013\226:\355\352\247\270\343\226 \016\0370\374eaL\314\272f\266\264qq\376\220\277\344\2029l@Is"
+	.string	"\353c\243$j\355\017 \344{\266\206gw..\016\312y\247/tJCW\302\305\371\244\2333KuK\363\323\372@\370i\245\215O\372\340\247\235\331\002=\034K5\0314\240\202&\001D\25018\344\004N!cJd\202\031M\222\264\001\220\002\031\262b\007\020xW\222\244\320\030|\243\346j\252\247D<\3364\343+\023\r\232\341\236\240w\037\0051\204\225\262\205\343\b\213\341\324\210e\352\230\005\277O\316c/\377v"
+	.ascii	"\004\201\366%\250\310j\021g\001\323S\272V\025\177\027\375\221"
+	.ascii	"%+~\372\274\004\006>\212\302\023\316\203\310$\374E\215\376g\347"
+	.ascii	"\305\245\263\032\272C\355>{\210\320<@QvG\362\215\007\335\254"
+	.ascii	"\362ZA6\342\t\353\271()\263u/p^}+7h\250"
+	.text
+	.section	.gnu.lto_gyroReadSensorTemperature.106.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\255\f"
+	.string	"v\026TC\020Q\225\016\360\030"
+	.string	"\330\025\365\007\311\363\361\253\367\377\277o\352\363DC\024\tW\271\320\307Z#K\b\016\n\033\035`dB\006f"
+	.string	"@U\001 \240\254\220\327\034\0269\026\2466\216\243\343\270b$\233\354\235R>"
+	.string	"@"
+	.string	"@"
+	.string	"\273\333\211\274\302\275\316S\270W:\342\3417:C\377\253/p\235j\"R\374\366\341t\243\220\\\314BH\320v`\206\002\361\325\347\006\3623gG\202\335\365\024\221\243\273\336\266\002\333\b\354w\002\256t\372\\\245\004\207\321O\261\335\016\265\034+\2532H\330\276m\217=\261=\247\375\324Ux\256\302\360\221\335\221\006c\327\203\305\006<^I6\204m\037\305Sx\034\026\b\215\"\001\330\t\r\256\032\001\177Q\262\276\302\263\224\273{\021\306\247\376\313\204C\026\242\342\234\241H1\250A\356\324A\213\006h\336\260=\341-0\200\335\371\312B\205\266\273\230\327\323\n\246\031&R\343\254\331*qR\021\366\267\245\245\237\007r4\f>\234\271x\337\205\007\035\370y G\003v\034\b\r6]\346\003\273\013"
+	.string	"{\0224_G\301\363\276n\242\332oKK\225\016\030\351\307-B\001eIYi\006S\314\3066\231g\375\025\001\204\2669\213\360\2602\032"
+	.ascii	"X\211\"\023/\302h\241\217]\204@\300\3060\024\312\344-\2038Me"
+	.ascii	"c:\300\030c\210!;\f\206\204\244\320\320\210\025\324\260\002/"
+	.ascii	"\"\273&\nM4B\251\020I\r\003\244n[\325\350\024M\355\001"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.107.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\272\007\375 "
+	.string	"\306\365\275H\240\326Uc\326\243\370QV\3419\002\352\215\301\033\244\005\352\007J\034\206\3438]\323\320\217\22029\022d\364T\211%_x\2509n\253\260\024aJ\336\003\276\200/\340\027\370\361\243 ^\003_\260&\033G\276\377\367\2262\245\253"
+	.string	"\234"
+	.string	"\254"
+	.string	"G\240\206\233\022-wt\335+d\360\3237\364\247\200{\032\330\317J\364\031\330O[\307N\177\232\251wl\256\037\213\227\3002I\342\251\313\275\027gc|\347\266\032-\235\311\320\030\3544m\335\361\023\314\270\n\016yn\323\262Q{q\332\013\245\213\232\266\370\254E\362\bn\b\205\252\314\\2\261\201\"(\"\006=\366'\302 $\211\n\213EP:\032e\t\004K\021q\350\347\212\233\346\f\213\252,\333\360\307\\\220\205C\350P\257&\206#\252e\0014\033\372\300"
+	.ascii	"\334{_$\0342k,\302\275\32758$\3362\267\037\300\266\003;\306!"
+	.ascii	"Dw\251\254q\357\275\r"
+	.string	"\361\207\320\342\025\336\343\275\035\370\251b\354\003y\220\236/\303\037~\365\301\037\354\347\355\314\230\225\024\324S\307\330G\237j\215\354\233\327\302\260\315j\231\263\332fV\327\316j\232Y\235\236\3253\263ZvV\243fu\265\325?@\263\303\n\3612\256\356M1&\314\305:\207\320\270\324O\3653\375N7\355+\253lKI)\177*\206d\274\322\305\347a\247PO'\032\247 \275\307\221:\347\3417\235h\334J}\246\235\037\201\277@B\f\313\244\202\237\256\325\376\322}\350<H.\240\005\2343\031\371\355H\007Lf\375*\267\222\273`c\003\373i\277\202^@\363\336\"\bw\372\225~\022\215S\222\272\232\352\030k\345j\212\003dV\204\361\312\3139S\037\365,\033\232\326\315\245\344\276\274\262\370\250C\311\300\240\030|`\324\372SF0X?\226\307I\252\262r\230\326\310;\030j5 \251\214\250_|(\353\216\2653"
+	.string	"e\336\2376\320h\335{\037\374D\355\241nn1Z%-\275\311\255\200\035pp\234\356"
+	.string	"'\362\037\ta\361\324\257[%\376\222ju\304Gr%5.Q\021\177i.\364^\236\017\371\006`?\037\276\336/gWaf]\203\236/\004\017\367\363\365~9\273\037.gC\006\034\234\316\367\3035(\340\236\207\235\017\007\242\327\363\341\322c\317\217\216`\365X\037_\310o\332jUq\245\317|\005\275dl\315V;a\013h\213\017\025\205\245a\256\246X\253\375\250)\224\276\251(~\324\0234\032Mi]\r*\315{\025\315^YKPI\375Q\227\200d\274\362\223\253)\312\244T\325'\351\233\332CU\257mfKZw1I\363>e\263O\206\351 \225\344\267\243\036\262\364\013\323\226\027.\271\232b\212:]\013\3227\317\3425\213Y#'\237!\255{\027\322\2747\315\354\003\200\250\250\261H\306\030\033\231\221\224\221\244\322\001"
+	.string	"\003\221\231Z\035\022\240#A\212\363\\\211\314\004\205\265\377\006\030\360\"\006I\273d\260\232\205V:\227'S\344\373\006N\343p\004.\307\364,\027\005X\215>\334\357\346\342\232\f@\034\244\332\225>\"\251\020\351\022S\213\304\036\376\216i,\017%\250\272V\370\337\301\3055\031\2008H\265+}\037\344iSD$z\226W}64\371\320\027kq~\036\030\n\374\003\203\345\022\267D\020\310\241^0\247yR$\372\367\243a\031*\275b\302\266f%\317\"\300\226\307,[v{\027\210\335"
+	.string	"\331\265\347\257\250\343\221\251\f\335sb\006\307U\202h\212\346\337\223)8Ha&\375\2176\213\351-\216\360Z\213\217\334\377\234*\027\335\036\365D\276\022\r\226\347\246\n/M\241\366\211\020L\303\"g\022cL\215d\b\352!T\206K"
+	.ascii	"2kZ\340\215\235\301C?\364\331'\036\266\003\341\307u\246\351>"
+	.ascii	"~\2718\226\006\346\326{\333\265x\277\200a\364\223_\002-\301\302"
+	.ascii	"\035\343\002\313\302?"
+	.text
+	.section	.gnu.lto_gyroGetTemperature.108.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001\300\216\013\024\314\221\273D\317\344\332\t\026\306\320\0255\007\003D\210\265\026"
+	.string	"t,\246.\214\207 6\240R\b\330Kw\250\317\361\023\331_\312\224\002\276X\334\32304\370\034\314``\3134,8\264\313\203\315R`\367\200y\r\302\271\327$k\257\240T\003J#\354\177\334\212~\2065\233|u\346o\242\263T\201\n*/\333\232R/\354\003\254\202l\247S)\036\023\237\207Jv)\256\223\035a!\032\2669\266\344o\234\203\343X\351P\323\201\b\211\004\210\311\356\266\201S\242\263<At\246\030\217\317\350\277\343\n\235\320Uy\246g@\302\356:+\317\347\326\333F\260]\261m\021\b"
+	.ascii	"2\003\316:#h\b\3055\2617\"g!\362pWL\355$\003"
+	.text
+	.section	.gnu.lto_gyroRateDps.109.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`S\001\r\017"
+	.string	"\226\335fE"
+	.string	"\261&\035{j\202\366\001\366;\022!\201H\353\r\346\344\305A]YFV\316\222\326\023\252\007\332\371\370\304\030\201)\016A\314\200\326Zk\377\371}\255\003\fV\034*D1\023\001\236\223\036\354]\353\311\336R\246\024U"
+	.string	"K"
+	.string	"Y"
+	.string	"\035N"
+	.string	"z\034A\333~\211\233X\231\205\240\304k\221r~Lhj\354\256F\340\242\3541_ {\324\021g\035j\262\374\313\334A\311K\214\317\325:L\271B\005\037tR\006\270F\240hG\304\214\313<O\\$\231"
+	.string	"\032\354\256\363s\241\334\361\266\037\330\356\260\177\023\321\233H\376{\364E\262\307+\251\005\307\313\230\rk\245\256\330\207\253*\016\035\366\203\262t\026\323Q\323P\323\n\323\251\351\007\020\305\274P\376\362b\267C\314\306\302\2108/\266W6\207\355L\3730\217Y\035\346\034\207vC\220\270\331\335\252W\250\347\341\340b\204\302kls\036\026\273\302YX"
+	.string	"\255\340J\327\351yuz\236\026\030/c\020\352Jf\013\032; \364\246,U\200\214\031\037\222\374\261\237\342*L\376\313'T\376C)\210\217\007[u\024\266!\261\354\356\002;u\232\013\006zv\027d\346'B\374\327\003]JC\t\332\344\261q\033PZ\307m\235\352\324i\252T)D3q\235\346q\300\033\206\023\247e\3306N\343\200\355\341\252\212?\\\324\020\272\327\260|\270\244#t\fzv\275\177\231\236\330\016\351\310\323\021G\r\351Mnx\031\263(\241\332\022&d\377\242\216H\264\345\031"
+	.ascii	"9\013\r0\221\002\314\231\304w\254\330\332\n\373\312\332=(\226"
+	.ascii	"\375\354\222\r\323\f0\253\205\031\300g\314\235\332e\233\221\202"
+	.ascii	"\320c6\027qa\324\2325\032\302vO\306\bh\002\220\022h\325MS\n\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_gyroOverflowDetected.110.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016$\243\232\232bqH\324\335:\nd\267\326\334\360\237\177|\303\376\335^=:B\351\027\377\354\314\024\003\221(\336\302\303H\002\236\032\267H\266L\001c.\356m\036\332\364\334\244\311LM\003\341\020\3210oj\027\203\235D\346\265\t\347^\263XY6Bv\360a\024_\220\206P\227\343\r\007[U\272\234\200J\310\0060>x\275\345A\226\361\005H6\372qd\005)$\242z\214d\202\256\225D\221J:\376\316[VX\350L\325\332"
+	.string	"\021\230\\\026\"*\231Vc\032\245\212\324\355G\033*<N\252\220\247(\300\220\231c\025\022u\326\037\341O\370/\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroYawSpinDetected.111.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375 \347u\006"
+	.string	"\022\f-3Pm\222\016$\243*J\024\253\233u\001C*@e\274\246\326\366\323\217o\330\277\333\253GG(\375\342\237\235\231b \022\305[x\030I\300S\343\026\311\226)_,\356i\036\032\365\034\225\301P-\003\341\020\321.\217j\026\203\235\004\346\265\t\347^\253\\Y&Bv\340a\024\337\220\212T\327c\315\006ku\272\233\200N\310\0062<X\372\253\203l\343\013\220L\364\343\310\nN.B\035\2212?\245\2244\231H>~\316WVX\340\\\365\352\370\020\2204,FP2\257\3068Z\025\253[\2206T\214J,P\247(\300\220\231\243\005\nu\326\037\341O\3701\002\b"
+	.ascii	"2\003\316:#h\b\3055\2610\"/!r\270s\246v>\001"
+	.text
+	.section	.gnu.lto_gyroAbsRateDps.112.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\235\t"
+	.string	"\326\022C90\257\322\001$\031T\233v\342J\345\222\233R\3402\226\224\006\343\247\017\360\203\262\213\250zi\374\210P\213=\277{\031\221hS2\320\333C\332\223\264@\225\3503\262\311\226)\0053"
+	.string	"1"
+	.string	"1"
+	.string	"(\247>\254\225\352\303\202a1\263\355\206S\340\234\356R?\320]\306\215\247\256)\377$_`\311h\256\227\352\n\240\260\273V\327\013v\307\3336\260\r\262\257\t\\TkT\277\343\310\244\300.C\331\275\270\315\254\213\254y\330F\331\033\333\252\366E>\202z\350\025\007\354f\204\250\354.\310\007\232K\017g\333\3778H\266\304OL\353\300\354n\202\355}\366@\300\261\273\b%7\001\375\216KG\234\364\256K\377\324]>vbj+\275\331\241J\243\206}nc\314\362\341\037`iB\304y\024\362>\n\206\t~\036h\"\201\323T\0225\314\321\007\316P\201=\007\3227!<\357\233\233p\317m\214\311\350Y\305\nk\224\361\255\226G\215\177i\331\002\r"
+	.ascii	"2\241\031h`DC5\021\274 \334\230MK\\\023M&\032\247\006\351\300"
+	.ascii	"\004\001'\214T+&a\222\001"
+	.text
+	.section	.gnu.lto_gyroReadRegister.113.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`#\001\225\r"
+	.string	"V\031\\D"
+	.string	"\2216\035;\036\n@\234~\275\021,\bj\310`\t\222Q\370\037C\337\270\024z*\3557"
+	.string	"N7D\343\377+\333\231;\024\251\022\3777\013\375\335\372\277\253\365Ba\200\037@N\237\027\253\n\017\372dK\231RI"
+	.string	"D"
+	.string	"I"
+	.string	"\266\375\001Bb\257\200I\350EGj\303\211\210\325.\230\251\206{\217\232\236\177\230G\020.\251\320\2435\222\211Y\201\3720\\\343\007\3523\301\361\225D"
+	.string	"\037T\036\036>Q\276Q\346\305`w\235\244O\345\266n\273\201m\216\375\224qu\305\216\351\313\351\315M\277\376\345\317L\177\203\200\252\202\312C\304\330\275PCcSX(:\330\276\177z\b:h\216Kj\265\273\030\310\306Nbc\366\213\013\220\314\233<\353n\tub\027T\340\004\033\267\002\"\033\247\224\241d\332\335\005\267.E\261\275\321\003\"\035\371\312\353\245v7!O\332\350a~\013$\03032fL4\024\225\305-8\320\244\350\275\215\352\303\0078\251N4*X\224\344\f\247^\177RC\224568Je\261\037\036\215S\007!\235O\b\005\314\035\217\215\003y\262\216\333\272\021\255\313F>\017D\262\016\327e\036\006\274E\320\270L\302\266q\031\006\212\036WW\234(m@\211\017\202\316v\305\310\254. \037\236\204\306\321\262+:\351\241=\037\361\351hyh\b\001\031"
+	.string	"\306\221B\373x\226\033\271e\302"
+	.ascii	"fLe\nC\221\2414c\003x\335T\r^w\305\f\213\2700V\334\330\016jT"
+	.ascii	"\t{)c!(\002\306\201a>\243U\317\3336{\313\\C\221\240\240"
+	.text
+	.section	.gnu.lto_dynThrottle.114.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\315\t"
+	.string	"\366\021@7@\217\322\001\233U\306\334\001\2706\326W\270\246=K!\030s\026~\242\273moo\03373\t=\250\221\261!\245c\370\231O\003-\301KJ|\nj\033![\312\224\0020"
+	.string	"-"
+	.string	"/"
+	.string	"\337\006\007\001K\304B\265\262\273\231\346\002\330\257\370"
+	.string	"\354\227j\334{z\376SgP\235TF\244\317\363\262\260\273\316\021\t\343\326\3336\260\235`\177\023\216O\353\323\371\3641\221\225\372\211\311\356E\310\262\255\213\244\303\266gg\362(\203\006\330-\001\031\331]\004\037`~\331\366O\017\361l0\006\211\222j\360\251\252+\221\007x\323\312\324Z+\204aK\305.\250\340\232\212\255.\275\364\032SD\037\241\f\355\357\223\232a?\256\226\260\243\376\353\031\235\210\256\323\266\207\016c\316F\333(\0342n\3238O\207\313<\020\r\022\031g\343\262\315\200\265\211\316\226u\232\266e\231o\037WK\230j@\032\372\242bzQ\215\032\025"
+	.ascii	"2\241e(\360\376\243\242\020n*\013p5\025\245\030a\024\027\"\250"
+	.ascii	"\274D\265B\225\030\\\3355\346X\256\341\"\023X[\257\340\301\222"
+	.ascii	"(\313\006\2402\232\332\371\004"
+	.text
+	.section	.gnu.lto_dynLpfGyroUpdate.115.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\252\007}*"
+	.string	"\212J\020\020E`^N:+\327b\316M\3400mj\275\267\003\342\350\036\035\227!\316\032X?h_\236tdG\254\206M\364\363\0260\335,\005\233\004\023\350\336`\302R7*}\254\301\216\233\037\215l\354o\333\b!\204\310\235d\350"
+	.string	"\332"
+	.string	"\361"
+	.ascii	"M3t\367^\b\353Q\376\227\233\341x\031\027\273\356\275\027\343"
+	.ascii	"\223\261\217\307n\374j\335\363\240k\212\241\273W\214x\224\027"
+	.ascii	"\2548\230}G\333\307\314\267\314\357r0\344\303x\215y\367\232\001"
+	.ascii	"c\273\3676\261\322zTx\243\364\350y\242\364(3\222y\356b]\027\251"
+	.ascii	"\t\006\313"
+	.string	"\254\317\275\267\330NV\356\237b\347`#/\024\374\001}=\336\252\246\350\331\026\311W\237\316e\330\032eV\216\013\035\261A\365\251\211V\327\177\266\353@%Z\\\367q\025\261\275\241\327\017\"\226w\006\025\244a\331u\330Dk\353\252\372\224\3665O\363\214\035%Z[O\203\034\005f%\321\256\354y.q\245\001\3626?\206\234Fl\226\310\235L\207m\265\017\333\374@r\n\357\275\367r\333#\313\312Z\365\351\336\313V\231\245u\036:\363E03\006f\265\003\027a\306\205O\322\313\312\336\261\355\356'\351N\346eL\240H\221\"=j\373dG\275\230o\276\354\2757G\367\222\241\322\267\n\2628\035\326\216\371kg\203\342G\341(\243\275\322\230\036}\237`\302\325mU\331;f1\253\237\267\227\314?o3i\272e\246[&\336\362\222\322\317\316\b\f|\354<\274e\341\303\376\244\001\027sFz\230\363Q\220\345"
+	.ascii	"\267l\324\263\\\304\263L\204Z\006\340\263<t\313\301[\026\272"
+	.ascii	"e`\317\362\217g9\b\265\354S-\363T\313\353-\253\267\234\256\226"
+	.ascii	"\321\324\362\251Z\356\324\262E-\337\311\310NN\353]\232\367\372"
+	.ascii	"\270\373s\337\3201T.\346\017\363\237\375c?\231\257v^4\nM\267"
+	.ascii	"*`\370i\354\013\303m[\232g(\254e|\264\263\032\226\215\233_\020"
+	.ascii	"\220\\>\007\t\346\324u4n\250\257\f\"\264\bZ\250\231%L\260W\006"
+	.ascii	"[x\3259x\330B\375\264kX\2025\333^\371\230\222\245&\213\324I\202"
+	.ascii	"\006\330\b\272\325\222^\277\006v\252'I\307\025\376\346\302z\357"
+	.ascii	"e\300ws\270\f\0338pH\217\376\372F\230r_aiP\257y\033\017\r\034"
+	.ascii	"\360\337\316\006\004?\312Q\0261b\304\271-=z\345\235a\007\265"
+	.ascii	"\nw\002i\200\316\320^2\361P\251\257\337\204LN\032(\022F_\037"
+	.ascii	"\355g\037&\234:n^\371\250r\276\307\334\270\220\311\341\365\260"
+	.ascii	"\033"
+	.string	".\351\266v7\257\237\334\243\366\332\250\032V\240\246N[\355\243\235\236\215\366\261\002\235)qZ\330\022c\352\246V\333\210\235\324Lm\351,5\257\335\022\273\333\222U\254\326\016\245\r\312\333\345\bww\201t\334[U@\330K\235\266%uR\013\373f\001S.l@\235T\024\322\031F)\013+V\034\251hD\365\214/\250\250\216R-\250V\216r:J\335`Q\234\222:N\3050N\025c\270\200\202Q\214\222\232*:\t\340\243\f\243T\221\352x\224*\372\304\252~\336f\342\345\347A\245\371V\325VB\275\344\253\235\030\3673\320|\002\0074\022\322\17787g\313 R\033\340\223\344\262\262Em\324\001\234 \237$\003\261`\036\020RJ\207\377\361c\027\300\250\337\347\302\312\247\250C0\353\324\205Eab\351\362\353%\333\036\361W\373\205(\375\314\371\210\037\320=\370@\"=y\210\210\312v\260\371\324\034\300\035"
+	.string	"m\2039W\367\340+KN\317\036\360r\303\363.;:6^/\331\027\247*5\032\227\022\177\324=\232~\3246\313\323"
+	.string	"\001\373\2622\375\250\225\372\310\fl-\311\225\300\006{\250\231\221V\220W\354\225\314\237sQ\024G\311\214\304r:H-/c\300\037.\207\f\200\241\250q0\306\fSJ\221\210\210$IRh\f\240\002\221\031\253z\021\2401T53i\332\016\374D\245\217\005\037\307!\261C\250C\f\271\302\216\023\026\311\360n\332u2\247\236\346o\022\222\353\307\016\261\301\200\214\226\363K\276&\237\r\200H"
+	.string	"\200\221\346\t\250\332\237\036\005}\363\317\301\016\374\336\307\264\236\307\007\371$\253QO\277\275\264y|\207^\r\244Q\344H\364{\334\033\205\343\f\3518\276\365\374G!nC\300\271\032A\301/\276"
+	.ascii	"Q2l\274F\t\205\304\324\364\361\333\234\2417\241\237\372C\006"
+	.ascii	"\330\324Q\237b\203~\347\360\320y\357\237\2561\030\200\215\017"
+	.ascii	"U\020\262O\343\314%\003\3320\237\356e\322G\221%\2168\205Q94W"
+	.ascii	"\034D\033P\361Z\020&\221\020\311H\246\351\265\232i\314\024\037"
+	.ascii	"\2773\030\310Ks\231S\205\345\2248\fmV\3736J\n@4\371\bg\342u\021"
+	.ascii	"\033pn\217\f\354p\314:\034\007\n\324\f$\330\252H\016\2554^\020"
+	.ascii	"\237\371q\374\366\236'\210\340\223\375\253k\032\250m\210\202"
+	.ascii	"W\nt9\277\320\255n\305\353g\021\262\030\274\331\203\035\205\006"
+	.ascii	"\271\203\022\026\204\254v\212\332\260\273;\0377\177"
+	.text
+	.section	.gnu.lto_gyroUpdateSensor.part.0.186.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`f\005\245\034"
+	.string	"\3660\255G\220\234M:"
+	.string	"\n\005\233b\004b\013\233\367\n\200e~\374\025\023\300\245\013\3333\221\214\013*i\017y\214\375e"
+	.string	"\361V)\341\026C\002"
+	.string	" \202kp\271\344\315\365\306\006<\201V\224^\031\272\025\255YB\b![\246\024\216"
+	.string	"\221"
+	.string	"\245"
+	.string	"9\326 %\235\313\213\304W\205\243\326Z[\177k\311\256\325\274\373s\351ZJAg\245!\345]\373G\236\305t-\245\367\324j\025\366\244\326\363\301C/ \037\372<\220\370\220\374\217\370\320~\021\333K6\331O\263J\231\311&\013\202Qw\020\264|P]e\265\326\333C\332\343L\017A\272\"\223\277{\270\274)\033\007iS6NA\006Ua5lSO \220\030\0172\337\372\316\230r\332\365\2718Z\250\265\232\244\272\307\333\006a\273\203\035\016\t\017\227~\353\031\260r\374\330\364\232\366\267\364\312T<X\251\225][\377\344\254}f\353\236\332\232\207\266\336\231\255m\344Z\207\\\347\220\353\332\270\246\221\353\031\271&\311\3658\256Er\035\222k\220\\\323q\275?\377\017"
+	.string	"\277p\354T\325\032\365{Su\204=!K<\024a\311\272\003\273\323\214\032\212\200d\335O3j\344\242\304g\344J\354\002\2547x\3049\215\224\325\247\263\201\355$\273\b:M\032c\326\2170S\312j=o\017\375\256'A:\227\207\002\236\275H\264\321\034W\230\247mc\373\303\321\024!0\317\224"
+	.string	"|6z)3\t\221,\035j\246\fY\016\255Q\0352c\304\344\320h\355^\356\003\363eo0\361!\215\315\214r\331\"F\322\221\316\262`\271B\212t|p+UHT\360Q)\211L\221\212X&\022\"\275\220J\261\227\002\020\217bT\300\004+\201|a\027\357\fH)\r\261\234\240\330\353c!\3363z\227\257\362a\037\363\321[Ji"
+	.ascii	"/1\3144\355\317\301\275D\234\311\004{\304\235\220\250\340+\361"
+	.ascii	"&%\221Yk%b\362\342\310\007\362\320W\022\003>QDs)\204\313%\231"
+	.ascii	"\270\351r8\335\212#\335m\005\212\022*neNw\023\022`\034\213\243"
+	.ascii	"\334\255\005\016\227\273\325\016Vje\013M\324\311\364`\255\265"
+	.ascii	"\206\006\326\207\376P\373\002\206m\332\235\221\204\255\345\355"
+	.ascii	"\207\212pxT=\324'\201\f7Pq\376\273\n\321F{\250\027\352\206\323"
+	.ascii	"~\245\021\333\001\022\330\035\312Cm\r\033\366<S\320\001\203\356"
+	.ascii	"\354\277AA\2721\"jS\n\361Pq\214G\365\262\0246_\255\365<\233\303"
+	.ascii	"\327x8\230OM\371&\346\016\035\257d\224\341Q\321?\b\257J\013\245"
+	.ascii	"W\001g\250a8\345\240SB\"\"R\222\302$\035\200\002\031\"\254m\021"
+	.ascii	"@\2652\306\320\024\215\250\220\2151I\342H\201\341\337\250\234"
+	.ascii	"x\350\265\3049\265\t\351\304\250\377\363\220\276<\270\376\024"
+	.ascii	"0\352@\367\211\025m\226\357\223\300\305\231B\330N\034\375\350"
+	.ascii	"\022\243^\034-i.\3735e\326p\fF[TU\224\003E\302\021O\332\337\216"
+	.ascii	"\350ew\333\221\214\243\013\270\226\306>\245\242['\020\352\316"
+	.ascii	"X$\373\025\353\035n[\373\027F\203\215f\251\016\301O~\310\220"
+	.ascii	"\264\2350\204\210\247@\307d5\223\r\310\3401\314\317\330~\203"
+	.ascii	"X5\215I\277\271p\305\330\034\202ve\223\361Y\227\375\300\323\366"
+	.ascii	"\225\220\215?R\177\245\201\352\034\314\224\"\f\032\350\205\360"
+	.ascii	"a\326\316X\227\036\210H&\205\\5\2776\377\274\347\007"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.part.0.191.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`H\002\215\020"
+	.string	"\366\334eE\360\260(\035\032\307\235|\013\231F<\bQ\024IL\3226\271\263m8T\226\375\t\235?\016\354\337?ZC{\005~;\252V\220\205\202\b\213g\340\031\23048\336u\322S\270\207j\365\322\305\t\226\220\275\245L)S"
+	.string	"T"
+	.string	"R"
+	.string	">\375\203\261@\260\355\017\020\024\237\006\254P0\026phQ\0211c\367\353\036\365\302O\337\"\324\344N~\262Z\250o\034\210\303\002D\t\031\254\226\204\307\b\207\235\326*\025@K\005;v\367\262\347J+%\223\343\034\007\332]s&\334\234\3336\261\215\300NWNG\247!L+L'L\237K\227\317\212]\226Z\215\265\020i4\270\003\245\372<1p)\254\224Fb&\366\262\252\317S\342h17\261\031\376\b\231\020\005jT\314\002\300v\367\036\376\225\016\343\255\305\305\346ewK\320\227\231\354\216\215bw\036\337\301\037 \246\237>w\027\245\372\262M\262]/\273\001\326\003\f\037b\320\\\250\222\206?s\3504$\007nf\026\375\204'"
+	.string	"\266\253R \363\231\006~\206G\223N\362\254\223\355\361\372\331=6\264\210U\220\301\244\262f\302\266\351E\262\326\343\361i#\365e\345\016W]v\016\371x\243\322HG\032y\244\022\021RW\022b \352BF\244\356C\300\236\211\310\250s\340y\243\256s\270\352\362e\347\210P\243\243\032\224\322\024\353\341\246/'\364<5\301UWlU\250W\271\221\312ZT\250.\024\317\317\241\333|\026=E\315H\352\0035 \220\002\021DE\017j$\306\256\204'\216\264\301a\234\204@w\313\354p\030N\335\253\035\206,\314\r\004;\376x\233\003;\261m-\324\265^\255/\302\306B\217\224\001\301Lt\016\363\303\275\252\2000\351\270\037\342\032\204\225\r5a\\\312O=\020"
+	.ascii	"%\320\300*\222\271)\231\366E\223\236\025d\034\271\3375\364\202"
+	.ascii	"\331\177\325z\3330\3175P?\033\365\351\345\326k\337\030"
+	.text
+	.section	.gnu.lto_gyroGetAccumulationAverage.part.0.198.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\236\0025\024"
+	.string	"\026\246\201H\320\322(\035R\207\"X\353I\317?\304\320\304GbMH\233\254\252\270\237\305\262\275\362@V8\373\\\252\004\r\372j\214\311?\203\025V\003f\017\030V|\200\334\"U\\\366\b\nd\221\345\267\357of)\315\222\275\345N)l"
+	.string	"l"
+	.string	"e"
+	.string	"6AB\273\241\311\247\033\224>\035\336\200\367Y\372\210\367i\377\205QR`4\224\224\230e\017of\005v\263\016;F\273\341\367\251)\254\227\341\255Q\366)5z2?~\250\271|\222Tp\22797\034'\210zj!.\345\200\335\rP\213\221\017v\367\272\307\231\332KT"
+	.string	",@<\216\334#\251\354\256K\"n\322m\267\330\266`\307\234+\356\363\377\374CW\373\376\220N\bf\222\230pk4\241\230\334\334J\333-\007\f\034\237\377\370@6\365\300\236\273\216o\203\007\226\363{jxw\263#Q\264\273\025J8\237\307\237\361\235\330ih\370\322\354=\364\330\215(\332\rK>\r\241\364I\"\243\217\203\331&;f\233>\343C\030\202pih\326h?\306sb\227a\240\213\354\006\326KU\233m\007\277zz`\347\306C\246\306A\013\374\335\313A\276\n\337@\336'\003\037F*u\352e\\\310[\207\027U\3652-`\342\221\257Q\257\373\244\335n\300\020\361\fy\211G\326\353\356\272D\265Y\275\177w\327jc;\232\344i\364|\370\313\031\2553:~\350\276I\356p\004\324\354\316\216\204l\211\251\013\256\324\206\223tQ"
+	.string	"U\251\t\257\025\250\002[,\256\023(\341\002\250"
+	.ascii	"\\9\265\300\226\b+V\352u\302\300\242bA\241N#F\235\260Z\034V>"
+	.ascii	"W\213\345Z\201\256o\225:\251>T\313\365\235$0+\003\330\372^,V"
+	.ascii	"\3533\375\2536\004\244/\363H$\265\312\213\302L\265\341.\002\344"
+	.ascii	"\266cV\223[5a\375\245\332<o^\311M\267\350\351u\306\344\327\210"
+	.ascii	"B\347GL\f\0228 \200\002\0313\255\003|*\250h1\330%\3609L\300k"
+	.ascii	"\\\320\360\240X\027\214\245A\242\"\020\3269\232\367\2703\027"
+	.ascii	"?[\355#\370Q/\215\275\023Dj\356\216\225\260\325\206\311\265F"
+	.ascii	"\301\335,b&v\005\343%\254\3374\f\270\354n9\373\264\b$\246\017"
+	.ascii	"\306\300\f<\341(`\006&\363\332\245!\2137\206wu\246\213\265P\034"
+	.ascii	"V\303\366\036\232\030\027\336A\361\304\271\005\351\337{\355\303"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\261\n\345#"
+	.string	"\346y\316?P\246\316p\377\352\377bz\235V\352\345\243\341_\\\033\320\017\\v\233vgwd\323\212\335\326\361\373\016D\372\373\377\337\271\005\004\340G\360>\276\207\021\006\020\355\005\3565\230\241\300h\023\271e\n\271"
+	.string	"\270"
+	.string	"\301"
+	.string	"\247\333\321o\243\243\257\346\314\321Os\342H\200\246l7\372p\247\215^5T\025\036P@\327\253\3363\315\032}<P4z\331N\253\t\250Z&w6\243_G\306*A\2331\272x\302\330\025\252\352\201\350\213~\236\323E\177y\266\350\335Z.Af\304X\364\363\316\025\375\246\212\276\243M\333\322\377\251\231\242\337hQ\364\337\234\212N\364\345N\023}6\347\226\350\003\236$\034\240\234\216h \242\317<C("
+	.string	"\261 \202\324\207\276\235\323\303\355:\334\r\312)\207\327\355\272\265\341\002\372_\230\252j:\206\233\315\246#\r\375\273Smc\373\373\257#\333`\232\246i\206>\232\363?\321KeYz\307\222\275^Xz\217\\\351\375\262\322\213\344\254\027\254Jo\030\225\336$Sz\305\244\364vE\351U\241\364r=\3513r\322\177d\326\2336\351+b\322_\264\244\217h\323-\353'\332o-\331\333\320?\bV\217\254\032V2\260ZX\355H\360]\273v\354o\250\222~!\261>\241$\375Aa}A`\375@H\372\200\276\372\177N\257\276\237\363\b\025\332\325\357\263k\237\317\271\\\375=\247\nakj\323\007\350\231\246\351V\367\365\030\351\3239\213\364\375\210\364\373\206\364\371N!?\024\004\211B\270! \022~D\360\201"
+	.ascii	"\325b\200\026\352\321\237\313\352\357aY@yt\374\024\024\376\355"
+	.ascii	"\003\271\371\001\036\237X\250\356\376\201Q\3078=\255\032\330"
+	.ascii	"Y\235\303q\342\342\272\347]\240\035,\217\343\3043\224; L\230"
+	.ascii	"\336\363\216\f\003n\003,\362b~"
+	.string	"y\344*\346\02604\266\346zG.2\027\200\333\036\327\361\216Ld\356\035\371\216\214\264\356\351\344\250\361\275\357\310\003\224\214E\"\035\2562t\3073\300\304e\340\320\fi\255)XT\n\327]5n\357\353xMLLL\\\177\267\304C\345\356\233%V\202\253Kb\"s\357&\211\205\314=\227h\313\264\333%1qi\f\016\347\214,T\236\316\310\273\356\373pI\273r\271\"cx\233\"#\255\t\227\201k\266, \250\245\227L\331\033gR\356\246uY#\3639\217c\343\352\3678.\302\355\3315\246Vv\273\307\361\256r\236\206\227\271A\274\273\261q\215\210\364\2769@0\026\202Z{\002~\211rW!8\374;@\201\027P\335\347\225\021\303e\210\344\275\223\\\002cj`B$\257\031&\333\372E\251\006\207\306\334\262n\026\245\220\325\2072\007\334\025s\207\202\356\016\035\017\311Uo\006\220\333\204\344*uW"
+	.ascii	"\222\225\222J\352\360m\325}[\232\246OH\256\332s\212\212\205o"
+	.ascii	"\273hK4=\250)\316R\223QR|\225\314c\224\342\252\344^\317\f\216"
+	.ascii	"\237Q\212\215*\361\257(\305Eu\243\230\370\307\024\305\303\267"
+	.ascii	"\245(FJ\006\223\242Xk\003\200\252\250A\034\312a\214DD\024$M!"
+	.ascii	"\315\001\320\002\241!\032u\021\200\024\007\031C\206\210H \022"
+	.ascii	"L\225\364\301)\2343\346\036\016\377\243\031\026\234\253\264\335"
+	.ascii	")Vs\002\304{F\241\221\312c"
+	.string	"\264Y\245'Jx.\317N\222!Y\341U\247f\3409?\360\273\315\0130O\356\024\256\276s,\b\226b\201^3\324\260\320\351\336\021#a_~\343\036/\273\030\230\033\003\2257I\235\205\274pu\333\273\217\2012\350\232\336\376\235\347\363/\214nHyc\003:\257\233\311\252\007\026\374\265e\3776\231\337=\353\267\235\375l\262\377\2553\360\304\335\240\001\311\275\372 \34022\031r\311\372\362\251^9q\177\201\033\0336\025\333\225\221\204\201\234\347\204p\357\364\224-j\374%\002\330\360\2342\372\351e\236^$w\300i\035\201\345\375<\214_.\245\227\214Z\330\016X\206\017\363<+\226\256%\207\271\371S+\326,\361\300\022\235\030\311\245:\367\233\246\231[^\205]\232\347-\355\0374d\337\367\217a\312\027c+\220\324\201\333\373\333%_'\240@h\2563{\314\206\370|\260\320\020/\212\332_\225\204\203\342D3"
+	.ascii	"\377"
+	.text
+	.section	.gnu.lto_.refs.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\023\005]\034"
+	.string	"\006\177\256G\260\030Q\322\001\260\204\262\366\214\221\221\023 \262\261\nDq\036(>\204>\002\375qB\223\236\364\234\376\224\376\224\376\224\376\224\376\0247i\251\027q\267\324\0345\271G\030\235*#\373\267-\002\370\037\342\201\377\204\375m\313\024\222"
+	.string	"\222"
+	.string	"\221"
+	.string	"3]\207u\335\245\353\252\356S]\177\335\233\272/u\235\353\276\335"
+	.ascii	"^\236\275\336\311\372L\354c^\016\363r\327\373\227\227\263\336"
+	.ascii	")YK\262\316\305\236i\311\274a/\177\275g\305\244+\357+\314\233"
+	.ascii	"\366~\006\313_/\322\313\225+[\250a\371\257\327Y/\245Y\257\257"
+	.ascii	"^\256z\371\351\345\245<]R\273V\275\245\352\253U>I\365\234\252"
+	.ascii	"\251\323\256So\241\372\352\364\250\367\334\373\276MoV\251\273"
+	.ascii	"\344\257H]\305\365\024\327O\\7q\235\313o^\324\233^\002@\265\277"
+	.ascii	"\331\372O|\037\370=\331yj\177\240\326wj}@\355\241\355il=\200"
+	.ascii	"\355g<\371,\346\235\255\313l?\303\223\317\300\\\346@\207\311"
+	.ascii	"\207\325\372+\337e\353-Zg\355\364\225NG\305\376\264\323\237N"
+	.ascii	"7\345\364RN\347rj@\350\230\274\225\253\362Q\231\005P\3276No\270"
+	.ascii	"\023\346\031\323&\347`\316\305\274\265k\270I\361\023N\223\243"
+	.ascii	"r\001\375\031\264\277\345\367\274\327\311\307y_"
+	.string	"\313\247\311\272,v\346\263\3248]\277\351\372\200\256\013\350z\327\365:/\364\272\202\370?\360}^\347\211\277\003_\347u[|\234\3707\360m\340\327\304\217\360a\314i`\036\340\365Y\374\356}\354u\231\3701\361a\361_1o\301wy]\005?\365\372\t\376\203_\202\251`)\227v\202\336\321\272,v\231w\354/\361Y\260/\337\004\233\264\177V\277\370$\270\017\367Lb>\223%J\220\0349b\344\365\213\020\031\"\344\007\374}\034\035\301\374\034\265\037\007\202\276\221\215\236\370\307\350\371\213x\362\213b>T\373\005\331\205j=\237\033e\346\004n\002/\267y_#\3530\2261\262\376\212}\252\364\034\351\313-A5\027#$\204^\325\017\034\224\024\363\2545 ]\242\031tH\324\001\304\207\201\377\"\352\253\370)\242\016\235v\005u\227[7\335\236\013Z\250t\211\004\365\016\t\372\002\001\352\375q\353\345\241\343}s"
+	.string	"}q\334\276F5d\240\276E=_\030/\\\264`\261BE\n\024'L\224 1BD\b\020\037<t\340\260!~5d\300pA\326k\241\002\205-Z\262`\271b\245\n\225)R\242@y\342\244\t\023%Ib\021!A\200\034\365\330\241\003\312\3727`\354\247!c'\306\313\207\002w\250At\204\210\024\221`DF\302HZPh\003\220\0021\262R\035\021\020cI\226\375;L$\002\235d\246\200\250\303X\326+e\235H70,\355I\031\361\305=\224\236\220\354%\r\001 #\346%\376\345b\250q\374Z2\n\022S\022\347\nZ \027\305\253\237\200a}\"Q\320\353\215\232p \250\350\023\210\205\316\n2BU"
+	.ascii	"\254]\"\326\001\272\032\322\250xjD%\262?\220\351$\3049t\037U"
+	.ascii	"\370\003G>\255'\270s\255\374\031[;\245\245\263@%\325\031\341"
+	.ascii	"F\253\332v\345\327'\313J\337\332\221\177\261\316\356\330g\322"
+	.ascii	"\026\367\353\035\034\321a\335~\227\301\036?\f\017\367\207\377"
+	.ascii	"\333\232x?\302$\376\036\t6\b5\205uJ$\262\266\250"
+	.text
+	.section	.gnu.lto_.decls.def7cb563b4d1bc,"e",@progbits
+	.string	"(\265/\375`\370\177U\001\002j8\277\263R\0200\204\2554\006\375\262oG\370\341\347G$\"\022t\325\374\345\214\302\355&\256\0361\360\321\377\332b|\bD\347\006\023\t0$\016\323\360\225$H\033\376\026\306\201\004N\231Z\036\035\363\221S\206\n<\316\271\253\234\373FOe\325\304\226{o)\245L\001\225\t9\013\203\013w\315\375\273\204\027\360\246\301L\226y\003\357\231_\276\333\367\236\345\336K>7\360\212\271z9\352\336J.\\\201w\314\226\346\336\033-\355.?(5\235P\267&\360v\271`>(5\235\320&\346\252\005\336)\267\316\332\241e>5\315\275\367\345\261\374\241&D.\261-\007\364lZ\036\364\332\213\276e\356\236e\212\270f\256.-\367\331\336K\035\025L\237\016\264\233\257\351\364\255\bT\247\260\260\260\320\212@\257\251\350k)\372\272\354\206\261pg\273\\\316\354"
+	.ascii	"\274\371Z\211\276\261<\350\027\214\266tk\272\331\013\356\222"
+	.ascii	"\004\007\226\233\257\211h\274{\207\206\231Q\232\272\371\272\207"
+	.ascii	"\276\236\241\237\026\352\247g\264\007\226\007}J\247\353\350\324"
+	.ascii	"*\033R\266n\236\363\200\306H\303\021\346\346\247L\375\377b\271"
+	.ascii	"r\226y\263\334+Y.\225\013g\355\320Nx\223\273Yn\334\355\312YZ"
+	.ascii	"\356$\233\030Sxs\200{o\017#F\344le\361]\241\371\251\022\375\264"
+	.ascii	"\207\266\322\203\2010e5n~j\245o\227ld\\m\267\312X\363\355\272"
+	.ascii	"Y\346m\273k\317\313=bD\217\332\244\007\230\0134?\225\241\237"
+	.ascii	"\276\320O\223\364Q>}\024O[,6}\247\314\364\305:\242\217\366\320"
+	.ascii	"\030\215\241\363\266<\350uB\306\204\002Cx\363O5\372\226y\313"
+	.ascii	"\310l\224\364\365\265\215\231\370\340l7{\217\355\275?\340\214"
+	.ascii	"m\221\321t\363]r\305\376\253:\3121k\254\304\302T4gWa"
+	.string	"77\261a2\3666\343\346\237g\364\177\313\274`\227\311r\367\334\274\020\022\267\344\346\237y\372\177g\373\257Z%kM\324n\376\351\246\177\232\351<u\365\353\365_\253K\343v]\254\0166@\352\324\\\335\314\245\253\f\321br\363\317/\315C\256i\337r\340h\033\303Q\226\305g\207\034\227\223\037[|z,\221\273q6k\207f\271\342\2624\367\336:\316\226\243\356-'\326\266\367\376\177\211\\!\327\310=r\267n\221\213\344\002\271C,\363\006\271Y\277Z\327\307\263]^\033vy\203\\\254\263\345,-w\221t\314\026\263\005p\357ms\325\326\224\267!\377\234\241/\226\345\200\206\260<\350O&\375S\251\237\013\365\363\240~\016\324\317h\364s\237~n\352\3472:[\036\324>\361\371\275\342A\247\256\226\033m\357\255\203\333\342\\\f\336\374\254E\243d,\017z\356+\303\006\242x\314\034W\252<\244L\334x"
+	.ascii	"\241\272@gI\003\312\307\315\377"
+	.string	"\235\272R\366\351\211r\351\346\033\325\203s$\211\240\332\315\317m\332G\017\006\227\027)\256\275\227>`\240\232\326I\333\217#nV\2144\307\220!\\\336\331\260\373\355[\227\034b\n\017\360\373\230\301S\243\345\267o[x\364\205q\225\375\366\215\313\017\035n_\242\270\234\250\201\215\311m\301\375\366\355J\2212\203\315\275\227\366\r\313\220\346\336\313\177\360['S,[N\322\316V\372\202\344\277J\353g\013\255\232\353ta\3305V\320\022^\245\233t]\334\027\026\315}\272\373\306\260\1776\315\205\272L\267\311\016Z\300\273d\2316\3206o\317X\276\337\345\336K{\357\177\360\373\374&>\260\201v\317\262\341%W\312\324\022\034\373}\362lZ\024\247\246\331o\337\360l\035^\266\351\027?\256\232{\357\333\270\337'\214M\313Q\356\354%\246'\256\275\227\267\313\337:\271\r\264PlZ\232\204\265\233^Di\202\243\362\360\276"
+	.ascii	"\367^\216\350\0311b\304\210\021*\332"
+	.string	"\017,P\b\310\317U\372.-\007T\204\345A\237\231\364\261\027}\f\247\217\315\364q\022\335c9\240\307[\372\370J\037\277\320\277|\3727\213\376=\323\277D\364/\016\375\013\245o\005\265\210<}\033\247C\260\034P\233\305\316Y\246\007K\267u,\337\226\022\325\315\267k\032\005{[\017\250-,\264\036\320[1}\253\245\337f9\240\267R\372v\226\003\372\022\350\035\313\203\276i9\240wA[*\266\212e^`\327n\342\203\343$\263=\266\367R\007\207\260\t\241\340\315\377\321\267\027\240\266\320^\200\236\002\372\017\320\366\314F\261\314\r,\332\355\023k\366S\271\334\313\275\227:\227\310\2324(7\037\004}+\345\035\262\366\007\347\321\267\033\240\270\260\320n\200\376\352\035\313\001\275\226\007\005a9\240 ,\017\352\201\345\200\376\226\354\267bvl\003\334\364\204\265\321\366^f\320KV\246\214\335\374\245\345\200j\313\203\376\357"
+	.string	"\r\364O\r\360c\235))X\n\347O3\3703\2145\177^\032\334\200\025\272\177W!\013\006\306\350@%\203\256D\317\n\037\374T8\211?=\363_\205\337?\325\373\261\016\032\305\207{4\273\034\r\313\217\031\020\206\315\302\230\002D\365\341t)\363\252\247sRw\272\233\363\341\025\374\251\222\377\342\374W\375o\007B\360\337\235\034\271\233?\355\372\361\214|\346\267B\367\017\3035\261\325\206?\345\340\307p\330D6Sv\001Kp\377\362\336\217\221\020\300L,\213\r\374V\b\303\310b<p\025r\231\377\2529\n\177\252\303\n\331\344Z\317?|\304\217\";`_\020\301\262\270\202\030\002h\322\217\225y\314o\361\177\001ad1\303\313\201\377VP\206\2458qh"
+	.string	"\336\200\031\360\236\254\367_<5\267\340G\221\t\360\222\303\374\366\004v\305[\310`\376\213\207\017\020\364\347\365\307\226\313\237]\330\222\213~\234\265\374\377\263O\314.\024|\224W\324\375\271\004t (\346\024\314\3757\351\277M\377U\376\367\305o\205\246\300X\250,\344\201\236\234\345\317lr9\356R\235\205?M\177\034\225\3250\025\375\2476~\254s5\366I\f\033\343\032d\266?W\371\337\002VK\255~\034\225\325~\254\363A*\305\340\2770\242\376\013\346-`)\352\237B\375\230"
+	.ascii	"9\355\205x(\243\331c\fd\246\275\371\005\177\372\363\202\222\004"
+	.ascii	"x\177\306\300\177\t\245X\244\337\372\3749\005\261\354\344\350"
+	.ascii	"\267\017\370\0060r"
+	.string	"\224\267\200\211\350\376L\302\362\267\031\370\255\007\331\311\237O(\373\255\006~\213\342\267\035\310d\277E\376y\354\267I\277\365\300oS\360[\023\330\006\344\024\304r\330\377\016|\203\334\344\317`\357\340G\215\374\270\004Zf\362\177-\253\027\020{\270\006\327\360\243)\024y\376S\016\374\370\001y\311o\223v\305\005\372o\337\217\227\"\260@V2\201?'\271\311_\030\315^?\036\313]X\007\356\311\\?fj\202\231(\261\350[\260Pe\376k&#\371\361W\004\3764\350\307B\236\242\370\257\b\376\233\201\353\341\277\037\b\262KXC&\362g\023C\356\317oo\374\367\310\237\205\374\271\001[\377e\362\347 \377\365\300\177/\360_\025w\311Mq\001\261\b\013\365_\013nY\006\362g\037\277\375\361\341\t\370\321\036\177\326\372o\006\376<\342\267EY\377\345\271\033r\217\337\322\300\0248\317\217\326\320\361_\024\277]\222sX"
+	.ascii	"\353\274\005\334\303\346OI\3701\232o\374\227\205\337\002\376"
+	.ascii	"\367\351\277.|-\253\377\220m\374\327\371\323\004\374\326\376"
+	.ascii	"\357\373O\370?\360\267\352o"
+	.string	"\365\377\301\377k~{\377\377\241\277\265\371_\370[\f\377\375~\233\177\233\376G\363\333\377\366\346\267\347\177\301\377i~\213\257\346?\232\3259\006?*\201?\007\340\317\002\370s\006\177\306\340\317"
+	.ascii	"\370\363\005\177\006\361\347\020y\203\214\341\317=\177\366\220"
+	.ascii	"k\374\337\3715\005\376K\345\252\375V\354"
+	.string	"f\371/[\246au\351\376\253\345\277\\\376kw\353\346~\\A\236\361\277\347\277\007\376\253p\r\376o\340\345 ~4\360\3172\376L\365g\251?;\375\231\351\317\373\317&\3703\213?\033\375y\350\317*\376\234\342\317\033\370s\006\376\254\302\237Q\370\363\211?;\340\317\007\370\263\001\376\314\301\2377\3703\001~\f\370c\277\0377\177<\346\307a~\374\345\307x?\346\362\343\272\037\317\375X\356\307V?\206\373\361\333\217\333~\274\366c*?V\373\261\324\217\245\374x\371\343\262\037\223\375\270\311\217\231\374X\311\217\277~\334\365c$?.\362c!?\016\362\343\036?\326\361c\034?\246\361\343\251\037;\3758\306\217\231~\254\364c\024\374\330\004?f\361\343\243\037#\177L\202\037\027\375\230\350\307B?\026\301\2177\360\343\f\374x\205\037S\340\307\020\370q\003~\314\200\037+\340\307\t\370\361\007?>\300\217K\374\330"
+	.ascii	"?\346\340\307\"~\254\301\217\005\360c\017?\356\371\257\336o\237"
+	.ascii	"\374w\355\307\025\374\327\354\277\037\376\333\344\2674~\373\200"
+	.ascii	"\037o\370\261\206\337\346\374w\352\267'\370-\213\037\363\374"
+	.ascii	"V\350\307:?\306\371q\372c\364\307\371\307\366\277\204\277-\372"
+	.ascii	"\257\340\177\325\374w\347\2779\277\205\361\337\n\376\253`\203"
+	.ascii	"\374\366\307\377\265\377\342\375G\373\337\302\177\001\377\233"
+	.ascii	"\346\277h\376\373\367_\277\3776\377\273\367\3371\377\025\363"
+	.ascii	"\337\274\377\206\371\217\342\277_\376\353\345\277]\376\013\345"
+	.ascii	"\277e\377u\362_\262\377\216\375W\354\277a\377\245\372m\324o\237"
+	.ascii	"~\033\343\267.~\313\364?\205\337j\370m\206\337\356\374V\347\377"
+	.ascii	"\330\177 \377\351\376\217(,,,\374y\366_\001\t\277\006\b\020o"
+	.ascii	"B\364\217\302\260L\024\006\nu\315vR\316\230\254+\016\3240\204"
+	.ascii	"dM\236\216B\375\250\023\032\003m\262ub\252d\335l\302\347\350"
+	.ascii	"\023\n\006\327#\360fkg9\240\037,\017\372\236'}cF\013\327\214"
+	.ascii	"\233\177\324\305-\023uqR\251n^es\200{j\212\203\367lt\211\005"
+	.ascii	"\337\220\271?%4\351\326\210\341U\225\207\356\223\360\314\030"
+	.ascii	"\033Z7\277\303\025\275f\360v\005\256\301\262\344\346S\315\215"
+	.ascii	"\222\306Z\227\233\337\201\312\362FJ\212\b\326\362L\214\032\227"
+	.ascii	"\2774Y\352\216L\230\0254W/-\203\262\321\364\347'\346\307\032"
+	.ascii	"\023"
+	.string	"\337O\277\377\354\263v\226\315Va\311Br\363iy\320k\303\347'_\366\201F\312\353\314\331<\233f\366n\\q\335|\356\235e\316\244PI\272\371\035\230\350\377$sF]Y3be\314)\306\205\035\344L\003\345\034\227S/[\r\242\341A\311\013s\275f\210\321]\374\005$j\b\230\223\rM\021+`_\274`\260a\305T\345\346\3372\317v\342=\341\332{\357\334\210\361\253\202v\363;t\351\377\274\343\2225e\214\310\315\267fp6-\347\334\033k\220k\357%\227\323\212M\263v[\020\030[\323\234;\353N-\247\335\331\345\334r\322Y\346\311\345\304\362S\356\314\362|E\004/\301\346\330\333m\022r\235\\N\267\333d\343\343\033\004\344r\306a'\024I\026\337  \227\223y\266Y\273\255\275g\204\350R\362\r\002\356\275m\304\350\342\246v\262}\322\001\207~\207\031\372\035\236\364;\274\320\357\240\324\257"
+	.ascii	"\215~\005a\364\177\246\375l\373\317(\247\224\223\315\242p`\316"
+	.ascii	"\250\334\274v\222\271\023Bx\363+\230\242o\313\362\360\230r\257"
+	.ascii	"\3129\3052O*\247\032\225+\006\217%\245F\336\370\006Q)x\201i\320"
+	.ascii	"\374\n\224\372D\363\371\231v\343\344\324\345w\263-\264<\3509"
+	.ascii	"\250\321v\271-\007\264g\237\235PV\\]\225\231\375\204b\261v\207"
+	.ascii	"\034\031Q\300n\334|>\361\371i&\002\021\037a7c\313\203\376\347"
+	.ascii	"\362t\222\356\331\360\221\303I&\0038\343\214\255\354.s\344l\320"
+	.ascii	" B\226q\344\220\352\0025\006\344?\305\3160\2474`\326nn\262\354"
+	.ascii	"\261$N\312\315\347\020F\337\216y\235X\347\021k\267\225\267\260"
+	.ascii	"i\221\261\266\244a\331\246\214\251\201q\250q\235Wi\\x\212e\313"
+	.ascii	"\301{\357@\343:\301N&'\222\263\353\\r*9\223\234_'\227e\236^\347"
+	.ascii	"\216\237<\254\233\235U\030\225\246\215S\207\265\273\022\001\314"
+	.ascii	"I\263\354\364:g`\034\251\220\267\2751\300\275\227\026+\fokC6"
+	.ascii	"\202\311\264h\351\272\371\034\306\364\377\223\3109\3042\317\""
+	.ascii	"g\326\317\255\034\345\316\336C\366\232g\221\263\007\036\263v"
+	.ascii	"[9L\257\211~\365\261Q\241\371\326\314\307\031\344\024r\002\261"
+	.ascii	"\314s\353W\313\326\345\234{c\225\341:\267\316\037\266\016\203"
+	.ascii	"\021/1u#\216e?\004u>\007*}\0161\3649\274\320\337\360\247\277"
+	.ascii	"\341\214\376\206.:\307\362\240\337\260\246\317\033'\016\313\354"
+	.ascii	"9s\334)E\345\270\371\033\230:\005\333\366\240/\264=\3507<\321"
+	.ascii	"\337\020\246\277\341K\177C\021\375\r=\3647\330\320\337 \245\377"
+	.ascii	"\263\352\244\302\222\353b\345\346s*\373aUa\273\371\033\224z\352"
+	.ascii	"gT6s>\341'S\024\370\322\324\224:\241,\363\214\312e~\245\344\275"
+	.ascii	"\2453\n\317\310d\250Dp\302W6\3273\"5\362co\r\3151\346\302<\351"
+	.ascii	"\270\371<M-\345|q\272\300fZ\201\\/2\337\251\004x"
+	.string	"\2768\227\256^\003\370\312\346\300N\247\023\306\331d\231\347\213\223\351\230\nW-\215\350\021@\033\327R\347\363D\321\347\371\322\347A\242O\245?7\363\231Sy\261\350\234\\\265\335|&a\030T\352\353\272\371<A\364\017\200\346\357l\370\311T\005Nx1\324\374\n~2\245\245h=5\307\3742a\026\314kr\341\271-3\017\3464\317\2009p0\367\235\215\351\254\203.\257t\307\235\\\333M>\217\226\266X\226\003\272\301\362\240\347\301\241\3173C\237\007J\237\307\205\276\206B}\r\202\032\333Y\016\250\b\226\007\275\0063Z\203\206;\355\305\206iL\211w3Y\031\206\202\237L\231\240E\206\317p\224\253\307\304\353\013\260.c\311]\262\227\f&\337\345\274\214\227\355\362\225\034&\303e\272\274%\217\311Y\262\230\374%[\311q\231K\236\313Z\262\234ef\275{w<\205e\274\307l\307\333\022c\375\300[M\252\276"
+	.string	"\001\2279\232\360}\001\002\236\3351gcz\322\001\223,;\033\030\207\234%\203\235\360\222+\225\242Ee\214\016\274\265+\313\206"
+	.string	"\261\252/@@\023\037d=\314\003;Y\273\253\235t&D\223\345\335\002#S\205\340bJ\225\302C\202\301\262\036\026\303cx\331f\202V\331U\326\241\325\201\222\267/@\300\253\246\227\247\3447\031!\304\274\276"
+	.string	"\001\335~\f\226\365p\023[\247\345dK\256\3125Bp1\245F\341\035!\313zW\314\325\303O\246J\300\033k\356\275\365\362\216\254\206"
+	.ascii	"%^_\200\200jV\270F\225\007bY_\200\200R\324\344&<0\214\225\365"
+	.ascii	"p\017\354\003O\rc\351a!\230\t~2\245FAAkf=\234\206\003?(5\355"
+	.ascii	"]\025\202I\325\027 `N\"c\206\027\023\331\315&ar\222\344\346k"
+	.ascii	"\330b\263"
+	.ascii	"\314\334\226\251\344\266\\%\257Y;\264\275\251:hR\345\025\006"
+	.ascii	"hq\320)q\3119\257\351\265\351U)\271\371\032b\350gH\243\237!O"
+	.ascii	"\3474\035\037A\224_n~\0069\315#\003\301K\256\022\224\242\232"
+	.ascii	"Q2Z\226b\231\231\371%f\016\222\305Bp1e\001%\250&3\237\275\356"
+	.ascii	"\203R\323V\366\360\240K\r\221\033Y\312V\026\036:?\203\016}[\366"
+	.ascii	"\345\301\332mA\300k\312\022\254Is\357e\026\313[\331\353\203R"
+	.ascii	"S\005\344\2504\225\374J\216\272w\026\032\027\223\260%\"\254\035"
+	.ascii	"\332\211\266\261\346\336\313,\226\233\374J\316\322\316^:\002"
+	.ascii	"\326\334{\277e\261\234\304C\216r\271\247P!C\202$\001\314O2\224"
+	.ascii	"<\226\227\271,;\311f\231\3142\263X\016;\245D\001\024\324\220"
+	.ascii	"\277#\247\277\343\246\277\223\246\277\363D\177\007L\177\247K"
+	.ascii	"\177G\210\376\016\217\256$3wR7\177'J\377\317G2\022\313\314\\"
+	.ascii	"y\210\220\\$se#\271\210\2062z\204r\200xm\214_\0244_\247\212\376"
+	.ascii	"s\221L\304\206\220L\007a&\222\207\344\224!y\362q\363u\224\350"
+	.ascii	"\353\034\321\327\t\242\257\203\245\377\334\343\031\310\363\017"
+	.ascii	"\021t8\323`\320\275\2709ke\037\317?r\326\316?\020\200\265\267"
+	.ascii	"2\377\320\031\334[\251cm\006\326f\220\303\264\220\250\241\371"
+	.ascii	":8t\306\362y\356\301\264\365Tu\363\006\226\007\275\316\f}\035"
+	.ascii	"\251\234\343\250d\257G \216|cHS\217\353\346|#i\314\2240|V\231"
+	.ascii	"\306\fU\211U\032\231:\253\031*\230\261542\236g\340\277\035@\214"
+	.ascii	"<9\271\262b\273\222\247l\022\301\0341}\313\314R9j)\320l\013\324"
+	.ascii	"s\224\223\025\333\303Kss"
+	.string	"\216\221\237\376\253\232K*\211)?\341\311\321\021\336pR\317|\341\262\345d\353~t\255\211\335\374\034#\232\260\0073\227\232\334\374?\273\260\314\374\002\013\242\345\027x03\245\271\361\301\335l\030\201n9\377\231)/EE5\233n\316Jj\335\f\253,7\037\207P\3779\3112\263rOD\217\257\252\233\377\227\367\177\365\006\371bF\315\315\177\336\307\205S\233i\343f\302t\217\352\316\354\346\343\220\321k\260\340\355\241\364Bu\363q\364\364q\260\350\343\274\001\3361d5\244\334|\034)\177\030\215e\3424\230\355\230\211\321\322\340)x-gi\271\251R\2753ip\033\356\333[\323\334{\367\214\030a\245\304\021\362\241\331\013n\222\341\342\303g\260\237e\342\276\343>\354\206\347\200\fr\365a:|W\205\232I\002\343\347a\304\b\233\247\037:\222t\336\303f,\0237q\231<L\306\332]-wU\316\224\036`\374"
+	.ascii	"\233\370\013\016\363A\251\351\004\2701Mme\b\234\0204\037'L\377"
+	.ascii	"\230\314\030\030l_a\364\260\030\fVWvp7\037\347\210\326\273\215"
+	.ascii	"\352b\242\273\3718?\364-\363e0\230\357e\"u4\310n>\016\226>\216"
+	.ascii	"\r}\034\253;\\\207\271X;\264\023[\366\232{\357.\030\3172\361"
+	.ascii	"\035\266\273\303o\226\315\332]\2110g\246\231\203\344K\214\f\315"
+	.ascii	"\307\201\2413\223%\246\026\274\005k\33188{:\256$\271\3717\205"
+	.ascii	"\3727\200\3727~\372?\226\303Y,\023\317a,\267oX\215\n\236\303"
+	.ascii	"Vp\334\007\245&\024v\250\301s\370\315\262\345$-\267\224\r\222"
+	.ascii	".0~\200{/{F\214H}\2749\031\202\346\337\244\351\037\307\341+6"
+	.ascii	"\232\252\f.O,W^\214`8\314f#\306i\357\335\374\0333\375\2330\375"
+	.ascii	"\233.\375\233-\375\233\034\232\n\256\302\314*\003\273\3717UT"
+	.ascii	"n\234\264\335\226\003\372\033\027\332.-\007\264\307\362\240_"
+	.ascii	"\256\321\267\203\202\315\356M\333\240\013\0327c'xi\231\277\202"
+	.ascii	"\237\b\301\222$\344\346\333\374\351\026{\357m\177\005M\177\005"
+	.ascii	"\275\315\235~\323\362\240x\354\307a\266\314\326\331\264\n\356"
+	.ascii	"\311\333\315\267\301\242Q\313\203\336f\212"
+	.string	"\266\333\362\240Ktd\350`6\335|\233%\372\007\030\202\215\340'SZ-\b\221&\376\302J,\023'\301Gp\022\214\004{Y;\264\255\224\021\342\357I\030X\317\b\0345@A\032h\346\302]:1\214\274 \002\310UF\037\203\034\021\\\344VE\031B\205H\024}\f^@p\020\213\207F\r\214\233\217AK\003\261\201\265\226kY\356n>\206\030:K-\324V\375\323W\363\364\325+\372j\024|#\323\320\362\343\310\315W\311\364U$\372\252\225\3064t\354\216\304\255\335|\325\205\276\016\324\327g4\316\266\034\320L\305\362\240\266\rKE\235P\346\302\2247\343\250g3,\034\254\244\241\205\r\252\314:\311X\372z\302NbqZh7c\247\213a\340\030\307N\270\351&>\370\315\022v\312{+\255\315 \307\332\f\316+F\224P\320|=F\377\370\205\b\234@0J`7\377\330E \334\224=\0347\377"
+	.ascii	"dn\323\332\241\235\030\323\322\334{y\237\230\335\245\265\273"
+	.ascii	"\332\331KPb@\211\322\324\334\302e\357\316\250\021\325T\323\022"
+	.ascii	"\370\225\344z\341'S\024P\202\312\273z\326\016-/\311kZ'vw\231"
+	.ascii	"\223\224ao\037e\356\227\222\273\f\301\305\224\032\003\312\023"
+	.ascii	"\224\263\353\225\263\264\263\267\026\214+\205y\275\254\035Z\226"
+	.ascii	"#l\342\244[x\007\361\322\025\304JW\315Es\375\360\306\312Y\213"
+	.ascii	"\321x\201?\350n\276\210,\255'\342\311\313\357E\203\351\301JB"
+	.ascii	"\223N=\025\312\001\336\033}[\206|\271\006\203\201\320\305\231"
+	.ascii	")\312\377\252\007b\210\034\271\371\033\224\231\273\266\233\323"
+	.ascii	"w)\\\317VZ\332;\204\360\b>\t\252\001\334M9D\004\001\341Q\327"
+	.ascii	"\345\372\256\016-\214\322\226\245\267\\s\371\3254\314\027:\263"
+	.ascii	"\233\277\201\022\255\353\256\265\374\352\211C\306\230$7\177\003"
+	.ascii	".\375k\272_\275\331\252\333\302w\3637\030\242\277\201\226\234"
+	.ascii	"\334\215\346\336W\"0\b\361!\346\212\214\2666\035\327\2437\031"
+	.ascii	"\224\247&f\216)Ks\345:\016G\307\216327k8\006,\321}\271Y[9\216"
+	.ascii	"\335\222\006\324\315\372\3556\213\374(\243q\263vKy\250\r\376"
+	.ascii	"\235\205\367\354N\314\356\346o\240\2342E\257\365\350M\206\307"
+	.ascii	"\243\211c\205\354.\260\312\365\032[\356\221g#\310\315\232\312"
+	.ascii	"\331\326\236\344\021\321\300OK\321Rt\332\226M\220\034`\2424\332"
+	.ascii	"u\332\236\016\030\341\024\253\2335S\0030\313/\365\2315\333R>"
+	.ascii	"\\b\266\200i\246Z\016\034P\256\317t\314\236\346\002o\326f\250"
+	.ascii	"\016\026\030N\326\334\254\237\234M\316\254JS\2037%Jt\2315\333"
+	.ascii	"R=_J1u8ayN0\310\256\313\324~$\341r\263n\242\307\324\035IR~\214"
+	.ascii	"\211\245\031k#4\322\266\246nJ\207\235Y}yF\3504\030 \035\216%"
+	.ascii	"`L\312\330\201)q\213c\373\323\323K2\225\2630\26507_\203.$H\364"
+	.ascii	"W\017V\322\231\002T=\361ya\302\302\027L^\327_\267\211y\240M\325"
+	.ascii	"\335\254\273.\230>\27657k.\002\244\321F\264\221<c\303\340\323"
+	.ascii	"\036\230\215##f\352\346\023\200L\013\321B4\221\036\254$4\030"
+	.ascii	"h<\211Q\003\210\306\251\257i\3105\221\3439\001\223w\233[\244"
+	.ascii	"\006\325\334|\002T\351_\007\321A\256\324\t;{k\241\265\355\251"
+	.ascii	"+\016P\004N\t\274\371\004P\352\333&6Us\335\224\252\321?|\224"
+	.ascii	"\266\362H\007Y\22498\260\311q\346\007\226\233}\244\3120`\262"
+	.ascii	"\334\374\020\177\372v\f\206\216"
+	.string	"A\246\251\237\3064\2454\225\265\333\202\300\022.\370M;\215\211\321\241e\350\033\326\356jg/\255\0016\315\264\016\035\225\307Ck\351,\215\245s\350\035\272\207ej\035\272J\353\320PzM\035?1f\215\235\254a\274\314\007\245\246\023\312\366\232\332\206\306a\231\372\306\365\r<\250\257\262\024\260\345)L\225\207\0218|^\362p\240\371\327W\272\3062H\337\315\232\306U\r:\246\233\037\342\212\376\365\f\313\324V{\372\017\314M\260\314\177\325\006\313\020-6\375\020fzJ\177i\352\330r\363C\214\351\207"
+	.ascii	"\323\017\321\245"
+	.string	"\037\242\210~\210 \372\3271\264\323y6\347\267E;Y6<-OJ7?\204\226\326K\332\205~\361\253:am@\246\334\374\0208\3645\323\177U\205!\\\246\334\234\355\257\240Zy\255\364\253\227\016\t\027\324\315\017AC_o\235\364\2539yG\322\236\334\374\020Q\372i\341\224B?\0337\247\204\332E\210\275\001\006\035k<p\244\202O\t\377t0]\223\177\274P\270&\315\315\317\263\034P\034\313\203\3360>O\005m\266\3045\235\334\374\001\220A\203&\005\304\222\326\214\233\301eH\232\247\200{w\354\314\013\024\035\037_\352w7\326\336\\i\035\026\262f\335\032/\312\264\357\251\037\033SL\027+7\263\225)\2236Ax\301b\244i\003\005\265\324f\346i\323\262\245<\242\344A\335\234\356Y6\fc\314\320\275\225\351\351\245c.\326\336\333\305n\221\207\205GSw)\202VC\314\32316\255\314\017\013\323"
+	.string	"\220\204\t\223J\235\200\241\257\252l\016\314\272u\t\264\273\371\003\300\361\345\013\006.|X\255\211\244\355\346\017\300E\332%\355\222\342\251\"\\Q\303\245\225t3\302\322\273\247x \210!\303\352\346\377Y\271\211iQ\263eK\312\345vjky+\233\003<\003\246o\013\227/\2624Rn\276"
+	.string	"\302\350?\255K\353l\235\210\255T\202\020\343+\233\003t\233\233C\227W\356\212Z3\307\b\037\223\326\315\027"
+	.string	"Y\\\\*\367\035\033\030\260d\351q\235\211\335\234\312\331:\263.bk\250\376\253x\216\t%\312\315\027\200\226\376S8\270_\261S\232\251\244\245\271\2476\007\027\300\213\267\267\253\327\263\263\267V\035\227\032\375\247m\267\314\264\355\352\341\246\275\251B\020\363\312\340nm\r\375J\203\241\306\031'\202En~\006X\250PI\245\376\322.34H\236\324\323\315\317\340\013\r-U\263hR\035wa\202Q\344\322\264\247j{Y\b\031\25317\377\017;9UY\331q\3633\330\241\315\314R)ToZ\017\256G_\224\247RN.\315\301\302\233\377\227\236\235iWW\224\244g)\224\034*V\252j\344\254\335Ia\272\371 \b\365\237.\231\351\362\364\353\301\332U\031T=\005\231\262X\370\272\266\334|\020m\372\270\311\342+|u\306\003\262\252\247b\251XJf\247\364\233\022\231f:\226\006\306\360\322\345\346\203"
+	.string	"\323\0071D\377i\223\264\t\031\b+&L,\233]n\251\004d\225\315\201\201x\241DI\023/4__\251\024\207\276\273\2629\300\037VpXn>\006e\322\256\264\013]\006\352\274\335a\240E?5bS$)\022\324\306\t[)\003\001V\224\030\250\351[\324\006J\204HZ\344vj\037Au\274\225\315\001f./\002\247\212\2406l\370\254\240\266n>\006IR!\251\020\017g\356T\034|ol7\037\203-\255k\245A4\354\2757W\312\026\204J\323\246I\241Y`\020 :\333\353\356G\n$\375aF\252\371d\211\240X\032\035\251\017|$mG\021\277\233\217\001\025\017\036i\017\273\247\370r\210\270g\306,aK\261\236\366\b\223\345\213H"
+	.string	"\004\365\237\352\320a\331zv\022\037\b&f\0018\223^\245W)\016u\377U\345\354\260Q(\003Gz\203\354G\031\333\215\324\306\315]\031.j\200_JY|\334\374"
+	.string	"\340U\2454\252R\253TF*#\265\262{\352\017\203\033\337\t#\307\026\270t\306S+\2341PB\220\334\374\277\257u\305\301X\202\246\037"
+	.ascii	" P\351\024T*\245A\324\243R\251\333)%\217TF\226jE\214\f\220\233"
+	.ascii	"S\251\256/\255\247\233\037\200'\375\013\306\274Hc\274H\235\320"
+	.ascii	"\275\355\022Kjj_M\211hjJ\235\276\243\\\243\204\361\324)\275\222"
+	.ascii	"\304\353JN\020%t\2047\377\2029\375\013\314\364\261\223M\231R"
+	.ascii	"&\354d\227[j\203\02339\016P\270\345 \214\233\177A\217t\247;U"
+	.ascii	"\372\252*\233K\225O\225\356\226_\236\225\233\323$4Mc\321\361"
+	.ascii	"\026\346\324BC\206\355\346_\340\244\177\224\360\226\211\022\242"
+	.ascii	"5\354\224\335\233\rJ\214\346\336W\034\240]k\230\2327\377\003"
+	.ascii	"\232\300@t\320N\361y\360\225\3057(xtp\213\n\312\314\315\250\032"
+	.ascii	"\020\b\345\356\276\374WQ?7\260-7\377C\235\376\3214L4\315\t\345"
+	.ascii	"\347\322\366\001\306\265\367\025\0078]aQ\224n\376\207\270\277"
+	.ascii	"?\313\206\341\205\f<@\300\275\3458"
+	.string	"\310k\314\200\021r\363?\364\365\241K\374\245o\t\034X\326\2313Z\252>@\2311\203\346}\335\204i\226\ts\363\001 (F\fZ&K\026\231\243e\270\2243\304\334\214\216\261i\377U\021\310\341e\201\271\273C\363\256l\226X\t\343\206\2069\232w\323\244\374#\273\031\305C\301h\245\351\321@\301\240_\334|l)\271n\006q\360\205\361r\263p\222\2540;\267\2719\324\316\356,\225\360\206p\355}%\"\207P\217ns9j\307\206!\312\340\01727\243t\350\226\377\352\215\214\036\200l\350\026TK\227\221\250\032V\376\304\366\224\352\356Z\231(3\2037\003\300L\313\311]2k\266\245>tM]\2118\255\304\\\210\361z{C\343\320\240J\336\256\034\215{\"\246P\360f\024\216\212X\216\271\233Q+\277\222\303\254h0\331\264\354\344\353\n\210\215*U\320\266\017\260\260\035m\273\031;\"E\343ft\r"
+	.ascii	"Nf7C\247\330\275\367\276\332Ig|\334\224jG\247$\371\245\371\272"
+	.ascii	"\031\225\202\246\251g_]\264\244\241h1\2540e9\247\334\314\232"
+	.ascii	"\234"
+	.string	"\335\2142s\031e\326\r4Q\376\253\351\214\300:?4\nz\026d\b\230W\223%\017+wP\316\035*\016(h\264\334|\013\002\2358A\227\351\217\276%p\377;\272\274KrD\355\346[\300$#;\005\355\224V\323\222k6\021\023\303N=;\251O\204&\026\bi\322$\215\322\002\033\372G\2310\301N\036\244lxdM\013\232\364\217*\261LT\311)x\302VV\205`\302\027\330\325\205~\245V\274P\257\243_9cW\232\2017\377\357\024\374\257\016\257\f\001\274\371\036\304 Ab\323D@\240k\r\227\235\376Q#L\324\210M\303\260m\222\217\256\301f\234>*\304\242D\230(\021\313\206\367\336\261\205\362\360Zrp\017i\372\326\262\241?\272e\231\350\326\225\262T{+\257@dQ\3460\t\361\326\230\370\360\201\002\371\316\336[i\357\035:P\036|S\"N1,\267\346\321\037{wUz\373\346{"
+	.ascii	"\242\217\342@s\034\325q\035h\226\336{'-\267T\017\335\325\225"
+	.ascii	"\2104p-N\356f4\253\017nM\022\212\245\374\303\342\303By\364)\301"
+	.ascii	"\260\334(?\034k\002\321\035\266\231\311\230\206L\335|\017T\372"
+	.ascii	"\277\375\375\321\255\234\332{W\235\313=\245t\203\376\366\366"
+	.ascii	"\264V\304"
+	.string	"\217c\261\025\300\377\374\217\240\002{\273\200\303\332{[?\375\305\246\304\001b\237v{/e%A \213j)\253F\323Y\026U\206\246\263\254\235\264t$)\303\324\316Jj:\333;\303\322R\322\t,\252\2463\345\316\320t\266\2516\323\035\225\335\313\254\244\275\204\2653\354\245\255\334gXT \232\226\262\250\232\316\224T\031\232\316\262\250\366Y\326\336\331K\312)\030K{*\303>\313:\263\317\260\250v\232\316\260\250\232\316\262\364l^\214 |4\330\260\214\350\260O\232\226v\024T\016\345\324\216]\323\022k\347\355m\321\\\354\251m\267\267"
+	.ascii	"\366\316\2015\225\247\254a\333\224\354\242\224\250(\261\354r"
+	.ascii	"\357\355\001JI\013k/\331%\331m\327\224\004k\357$JB\033j\357\275"
+	.string	"\021\220\264\264\333B\254]\222\217\034\373\311\305\336\026\354\345\336P{'\331m\267\367N\332{\247S9\226{\337\330i\342\202\202\332\373\252\007j\347Hrs\261\367E\023\323F\325t\246\205\345\343&\345\214k\277X&\331\246'\254\315\265\363\262\246\364Y\322\223\375\264\367\266}\232\213J\006\337\315K\233\266\035i3\320+\265\215+\353\357\346\367`\321(\r\030\203i\256n~\317\023\275\314Q\203'\225\206\352\226\211R\2412\250B0\251\272\342 \305\222\006\312\352f\264\n\235\222\246I\215\233\337\023\246\337\243D\377\250\224T\030\222\306\"\b\244\361\350f\007\347B$V\242b29$&\207\326\023+Q1icD\364\243&\221Gc\261\004\243\005\220\305\013V\024$\004\031\003\360\302\t@k\022y4\002\240\021\222\310\342\021\t\220TX\223\304\241\243\237!\342\017\006;\030H\340P\302\n\025\340pdD\304S\301\205H"
+	.ascii	"\035\211E)J\204 \0263\260\341H\\\207HX\261\002i!\344\321\n+V"
+	.ascii	"\240\264\270b=\001t"
+	.string	"$\002\031\211I\024+V\240\r\027\"\221\001\362\247\230D\026\223\304$\n\027\220\304\026\216\353\320\021\320*\364\203\374\260\016\211\033\326\241\024Dd\361\304\032\304\341B$J\024\025;\240\027\"\201\034\032\"\376\b%\211D%X\024\035\205\222E\306T\005q\035\312I\244\261\350\347T\2214\026\217C\350\005\222\353\216\261H4!Y4\242\200S\302\n\025H\026\215(\360\034K`\001\304\205Hl\260&\211,$W\024B$V\027\210*\206#V\027\210*r.D\342g\270\022\025\223\306\243c\211\037\025\030$W\024\030\220\214\212H\320I^\210D\220Q\211 #\236\037\343\221MrE\256\307\0239\f2\272I\016\215AF\2471\310\b\013%\203\214\353\020\272\276PDf$\243\242\237|L\032a\2405\005Z\221G\031\231\036\351x\034\006\031\221\300A:\362\230\260\016%\223EG\241\026\214H@6\3075\211,\006\255,"
+	.string	"\021W\026v\220)F\310A\032\235X\223D\026l\222\253\t\0328\360\264@\\YH\032\217\212H"
+	.string	""
+	.string	"\362x\204$\256)"
+	.string	"\255\304\016\030\202\214E\243\361\210\205\022\220\305\001`p!\022\027 \201V \235\344p\210\374)\022\021\215H@\303\244PPqHE\007d\261\305\bA\306b\220\tC\304\243\023+\362h\303\t\027\220\304\024\220\305\026#h\244\216\006\023\222k\020\207d\321\210\302z\\!\005\244\b \217\"\300aEb\240\250\205\243\b\340X\020D<\256+F\030:\":\372\371\031!\271\232PtD\n\312\300\303\232\\\207\214\210\212H@\026A\354x@\"y$\032\221X\223D #\f"
+	.string	"\255\311#1\211\002I\324@\220\261Ht\034!\211<\026U\2000\201\350X\244\342\270\032U\300\343\341\274\020\211\240\243\024+P\t\240\241\342Q\212\025\250(\0055\350(\305zB\307\204\217\320O\262H\205\022Nl(ah\350\310\250\243\302\250\002=E#\n;\377!1dDT\324\240\350\210d\002\006\034$\035c\321\b\005\013\"\007\216E%\350"
+	.string	"\255;-\024\345\b\345\264 \032\213)\2507\031\222E#\n*\214*`D\002\332\031\032KH\256\310\225\205 \243\r\377)\036W\343\032\244\217"
+	.string	"\020\f"
+	.string	"B\b-\322\207\260"
+	.string	"\017\026\340\001\372\020\026\340\343\263"
+	.string	"\020|\364A\360\301\311d6\201D<\036G Z\223H$\024\037|l\326!\020\n. \211-\250\370\301\260\016W\240\242\024\216\253\321\272\246\270\321\220\034\"1\260\022\025\223z\035\"\203\210C%$\211EC*N\344\220\303\272\242\230\374!\242\306\243\343q]Q\224\002\021W\241<T$&s\213\025\310\210\202\r\022h52*:\002\345$/D\342\247\003\344\020\305z<J\032\231\320\242(\205\013?\304\241\024"
+	.string	"@\256CFDDd\232\274\020\211\025+P\220QO\362B$\222\306\225hh\250\350\230\205~\222E\243\223\005\021\t\037\r3\260 \036\361\bDEI\344\321\217\016\332b\0052\026O\344Q\004\212FH4\210\330\202\021\371\203\"\217\"\360c\2428\302\217\211\"\2065M\032W\"5\231|\220\261h,\022\211V\026\220\353\320\017\322\217\016r\230\201\350\b\211\223\306!\021F\016W\254@Id\232B\n(\200\206\212\206D(\n\026\253qH\204\036\211+\360\217\rrH\200\344\205H \205\222D\"\"\213\034\016\215T\360\264(\036\223\304\024\222E\307\234\244\3160\275\020\211\344\317\3211\2114\201\034\266X\223GD\031\\\370)\032\032\016\321\244\361\250\350g8L\217\253\221E\321p\230\"\217+\362\3108\034j c\321\205\341\020E\016ScQ\021Y\034Z\207C59L\"\213C;\027\"\201\\\215\220\222\006"
+	.string	"Z\217D!\244\001J \223\305\024%\216\214A\006hqd,\016\031"
+	.string	"\001 \fA\b\241E\211\025\350h\350\307X,qD\036\225P@\262\305j\034\"\032\217k\322X\034\002\021\327\243P\322h8\354\260b=\032\r\207h\022Y\034\032\016Qb\222\b4\034\242G\242\320O^_(\"\207C\324\205\237\242\241\234,\032QH\026\215E\016\306\022\200\210\353\021=&W\3701\036\225@L\022O"
+	.ascii	"\021W\026\212\216H&x0\226\200s!\022\305d\213\365\270\016\001"
+	.ascii	"\031\211'\024\223-V\236\244Q\305E\016\177V\026\\\370!\246\030"
+	.ascii	"\032\"\222PL\266X3\024\223-\326\234D\016\213F(T\254'V#\244\026"
+	.ascii	"\206(\254\200\302f\3751\022\223HcQ'\207\026@!\033\213+\030\221"
+	.ascii	"?h\321\b\211\221C\022L\240`C\202\t\024T\364\307D\021_\210\004"
+	.ascii	"\362(\005r\230\002\320\316qM\"\211D(\022\271\036\201\200\210"
+	.ascii	"\351\272\2028\204\342\310\210H\037\rW\254@\310\243\024\0329\\"
+	.ascii	"\177\212+\326\023\310\243\0246\353p5Bj\001y\224B]\215\220\222"
+	.ascii	"\310\243\024)\362(\005.:\256\035\320)\362\250\250\270b=\256\240"
+	.ascii	"\201\005\221\005\f\353\361(I<\256FDk\322&y!\022GFD\303\242#R"
+	.ascii	"\320\317\017\261\004\362\270\256(\036\201\n\260\016Y\360\340"
+	.ascii	"\003\017@82\"\3421\026\025\223GCE\310\365\210\0019\334\260\016"
+	.ascii	"\217\214\210l\320\344\320\021rea=qdD\244a\035\032\203\212C\304"
+	.ascii	"a\2161\25084\302:|\341\004\n\254I\"\013H@\304\225\005b\222\b"
+	.ascii	"\244\2520\032\272Qa44|A\310\005\023\007\320\2004*:\2368\256@"
+	.ascii	"\305\025\305\023GFD:\311a\020\261\205\242b\032Dl\241\230l!\201"
+	.ascii	"\244\021\205##\"\034c"
+	.string	"Q1\371\263&\213\216+ =\254\303\234\023V\254'\206\212\212\"0<\221hrh\342"
+	.string	"+Q1iTTT\201\344\032t$&s\326!\342\017\362LU\220pb\004\235D\016W\254'\212\216HA\352\212\365\004\n\026\304\343\206!\034\016\311\fG\303\n\024\035\221\202x\222.X\344\320fM\022\223\310sM\022\223(|\222F99>><&n8\034\223+\354$\221Cm\302X\002\322\220\221\321\b\025\344$/D\242\204\261\210\210\250\350\007"
+	.string	"&\220.r\bD<\"A1E\216\007)\256O\212k\"\305\365!^\023\304\353\323\342\232hq}\220\256\t#\322\211\022t\222\027\262\340EF\353\261D\262\250\350X\302\006YlA\034\006\035\245X\201\206\30759TTQ\001r\030TTa,\272i!i\\\211\326\025E)\200 *2\256@\303\037#\022R\205\321\320p=\022Y"
+	.ascii	"\035\211BG\244\212\241PPQ\bgE\036\r\213\2226/\b\351\274 \264"
+	.ascii	"\343\343cb\370\202\320\006\023C\025*\212\222G?I\025E\310\036"
+	.ascii	"\026D\244arE\252PQ\244\303\242hH\305q]a\001\027~V\241\037\234"
+	.ascii	"\f\253\021Rrh\002\211$\032\261(\032\322\200t\\W\024\375\254\307"
+	.ascii	"\f)\320P\221\020r"
+	.string	"=\n%\207\306\242\021r\310\202\210\244\341\350\204\261\250\230$\036S\024\207\210$\024\035\221\202:\274 4lA$\032\026\035\221\202\206*\214\206\206F$ \2365\310H<\352$\207!$\215\305\2434i\\\177\216\253\321P(\tTd\321\201\0046\311!\b>Ic\361H\337\307\207\004\020\030P\301\004\375C\242\350\210\024T\002y,B\032Wd\tc\221HT\342\347\210,A\302\303\013BCc\221h(\364\223,2\016\215H@;\377UB'\234A85~k\230\254\331\324\0208uP\025\324JJ\302\3100A)\243\206\006\215\032x\r:D\300\322\2067#P\005\224+K\363D\005T\323\334\275E\217y\257\264\250\331r\363;h\242U?-6E\t\332\315\357\240\210\376\325>U\312I\357\213O\345K\255\322([Nx\214]\211j\242_(!_\02473\350\340\215\220\375d\253L\031\364Kg\251\352"
+	.ascii	"\207\376U2\251\222\n\205\226\344lL\352\204\203\214\207\337\315"
+	.ascii	"zz\350W_V\007P\372W\363NA\233:\263\301\270.]T0}\006\030\203r"
+	.ascii	"\022\207w\025\214\372EL\220+s\252\027\035,\177<\332n>\007a\264"
+	.ascii	"zw\n\336\021\032I\303\201\026\375\253v\032\214\024&c\320\270"
+	.ascii	"\220I\353\254\226^[t3g\207\032<-Z\322\350P\261\361x\253\323\203"
+	.ascii	"\350\016\270,h\350\324M\207e\212\220\271Si\267\305\312\337\315"
+	.ascii	"\252\234*\247\306\235\220d\343\256l\016\314\211\233\233\032\227"
+	.ascii	"#\255av\345j\234\323\221*<\340T85V\224(\201S\2558\371+\234\021"
+	.ascii	"c\251\255$Y\262\251o'\323\217/5dn>\007=\264\312\246\262\341\340"
+	.ascii	"\240IS\241\242V\331JmT\225\315\251U\260\031S\331V\223\233?BO"
+	.ascii	"\3372\325)\251T\004\370\236~\250\241@\230l1A\223V\006\007\313"
+	.ascii	"*,\b\032\032\207\325\364\371Ua\306ie\331\201\271YU\315\324(B"
+	.ascii	"P+^gW\243\250MJ8\271\233U(#\322\364\257>\321gY\312\235\213&\313"
+	.ascii	"<\035\304k\313\016':-\337\365\t~)\263\323\241\322C\352\013\331"
+	.ascii	"\255\273Q\366fel\355K\tV(v\341l\220\300]\361\205"
+	.string	"]:#X\374\340n^n\270b\022\005f\323\320\032L\202S\230,s\232\215-\255%m\330\307\226\262PI\223\316\032\327\337Z\022\2503N\256\212\225\257)qbg\316x\245dfd\202{]\250\r5\b\036\232.#FT$v\252\004\221\254\2751\300}5C\304\257\036\271\212\004\215b#\246\266\3341\002L\377j\021T\006\232\254\027K\"\372\013\306\013\267#7\343\033\026\n\206\222-U\210.\213A\0050\353\205\244,H\324 *\020*V\244\344\256\207\233>\277+p?\362[Y\330\330\362\346\345\271$\314\2231Z\232\310\031\231\30057\253<T\036j\017>\021\004\253T\254\253=p\r\2338\030jV`d,o\314\270\371#\214\350_\335\201\231`\300\223\332\343Ru\2509\310\264\375\221\335\274D\303\020\005\315\355\005\016\034\270\246\320LS\275\241\332\300\241dCr\363\005\323\241\227\246^\241Ygj`"
+	.string	"\227I\230``T\032\372N\n\340Z\225jU\003\r\210\231\271\233U\031\252\f\235&$}\313\243\262\273\371#j\250T*\225>\353\262\023\263E\210\006\337\323\315\037\221\244>\251O\252T\017V\322\231\020i\316\204\201\205`O\215\223\032uU*]\002\206\001s\263\n\225\336P\361\232\354\334\312\250/\324\027\252S\225\033\266:\346\235\n\343\252\223\375\"\243\303\314\315j\323\327\364 \f-mq\252RU\252L\326lK\331+(\"o`{_\211P\201\354\031\201S\227\2562\331(\351s[\336\254*}MK\034\341\216\002\344\320\204\232P\335Y\270N+\200v\\\n\257\356\275\2343\2705(\005\220\021\030\250\007\241\314\365\230}\t#x=\270\233_"
+	.string	"o\326j\364\337\025\003\223\263*@\f>>\235\346\203\230\231W\230v\001\310d\202\346:\r\233\031%\\G\364_`\224A\032\177\332\317,\313\312\355L\262\343\002{\242\373r\232\277$s~h\366\366t\323\006\020\nH\231,*!f\256\233\330\257\352H\225\016\205D^0\311\313\323d\216\227\366\216#h\030~\262\202K\242\311\3501\351\336\026.s7\211O\250t\304\016\226\005K\n\263 \f\264\034\347\030sjlh\033"
+	.string	"s\025"
+	.string	"0@D\036\223\211\266a\356"
+	.string	"\024"
+	.string	"\017X\302\224p@\241\316\2240\251\024C3 \003"
+	.string	"HH\b@"
+	.ascii	"\272\177*\270\305\211\307\005\031\270\343=L\3228\3302\216\356"
+	.ascii	"l\037E8rn\240\016bTE6\235OEtt\313O\335\357F\226\206t\207\305"
+	.ascii	"\317\306\240B60^\022\337"
+	.string	",\246\356\323Z\363\207i\213\222^\020\354TsG\262]ll\243\364H\350\025\232\026\331\002\365\357\035\360\247\240\013!\276\376\324;\265\274\313\0305v\035v\241\214iq\013\032g\213\032bTn\333F\300b\252cc\216W[N\027fk\276E\360\263\323\264\246\025\266\344p\220\037M\321\316\245\247\342\304\020 \nI\314\250\220\346\373d\342&/PC\205\326\nm\360\003\0221\254L\262m\355\216\200\322\0377>\"\204\325\003\212Q\353\276\016\354S\23785\332\240z\301\351\304<\366\303\360\356K \260\241[\312\310\327\t\306\257\225&*CK\203\233F\262\035\002\375\374@G\263\306/\222\245C\244g\305P\373\222\271\205/\214K\322\001\354\231\332M.\354\001\314\271\256\223\322\373\234\200\016\217\361X\251\023\244I?\342\377\023\363\270Qz\254\261T\020\340\006[A\277\271\253\366DL<c\343\f\323\307u\250\251O\005\311"
+	.ascii	"\257a\2205W\237\022\220\340\013\226k\247\027m\355\215&MC\317"
+	.ascii	"$M\231\316\177\27219^%j\242f\235\276\234.\326W\246\272\212\030"
+	.ascii	"\304\362K\036\233\224\327m\257\"\210\236<\260E\261;\312/\350"
+	.ascii	"\202\202\364\222M\024\f\rY&\t\360\001\253\2323w\334c\321\344"
+	.ascii	"\177D8\355\234Rx\367+\366\373O\231g\344\306A\216\0026\005J\352"
+	.ascii	"[\r\320"
+	.string	"\2003\362\306\235\230\360\t\364\030\324Fb\300Zx \227X\b\020 \0168\365\r\276\202a\327S\205ZdX\333\324\207R\230\337\023\003aF\206\223b\341#\240'\025\226\275\nC\233\205\026\224\036\271"
+	.ascii	"\236\317\271\273\034\301\310D\317\332N\375p\344I\372\017~\234"
+	.ascii	"9Y\206I%\260\253!\2335Vfvj\226\307\317\035(x\234\373\271\332"
+	.ascii	"d\203\377P\242\202\230'\214\233\225]\235sNcH\350\226\214\024"
+	.ascii	"\352Lwz\3034l\2366\333S;\313(t\344GN\030Kl@Z\212S\240\265|\340"
+	.ascii	"M\204\225\347\301CV\374Vp`\251X\255x\317f\323m\261m9"
+	.string	"\301\201\016\222\347N\374\355\004\025\252  T \253\346\3561\212yo\030^%\352\360=e\016/\322\360b\336Nd\345b\023\b6n)\364\027\231'p\207LN0\277A+\263\276\353mp\222I\004E\370\350\315-\n\216(Hr\316\374oyNt\353JZ\n]O\322f\255\200\363{\2634\313\251\021%\344\2167A\032\337a\036\345`'\234\357xS\211\205I#\020\312\032g\200\327v\022\264V\311Fq\027\021\017\032\333\276P\004h\316\005#\013j\267\205W\221\035QP\331,4h\2515\360\327\260z\tB\317\236\261\262\256\273\257\300S\366$u\0248\242\223\263\313\216\202\276\032\265c%\214\317k\257\200\253\216\034\327\215\n\226#\203C\272Pb!\357,\020\241\365%\202A\205~\0048\025\356_f\222\261\300N\266\226\3618\004\244k\211\227\030\"\225\265W\307\3162\261\0326~\303\246\334\001\276*\331T"
+	.string	"Z\236\350\357\210\254\\\fz\206}\224)(\343\036\f\034\313\221\320\310\034\345D\207\2554]\003&\342\344fq\247\005m\020A\027\0017"
+	.string	"\021\032\233>\b\343\021\353\362+!B\217\374W:\312w\177y\266^\314\364\204\257\314\200\3048\352\210\314$6\274\362?=m\210*\025\253"
+	.ascii	"b\210\306}\270$\255\302\022fu^\2574b\305\376,\tiG\365T\250\260"
+	.ascii	"\373\005\234\303\305\355q\002\215d\275\026\034\267\223\304\352"
+	.ascii	"G\371\351\353A\037 \006\340\r\321\033\204\317\376F8[%\021\031"
+	.ascii	"\026R3\205W\311\264u\271\224\244o\374N+8+{}Kv\270m\277_\024\233"
+	.ascii	"\327Bi\265\200\252\275\025<3\f\244\255\215\243\037\240\037\312"
+	.ascii	"\243\215\303\035\034!\374\\XB\270\257\032\224a7i[\177\023\203"
+	.ascii	"\277y3#\324\205z4\355\353\031\375\013\302\345\346\346o}:\362"
+	.ascii	"{W\277\223j\005\320\353\330\231dr\366]\231\346\033\002\371\346"
+	.ascii	"B\271,\225\035\222\230]\243nqo\327NX\340G\326\256R\326\263\265"
+	.ascii	"\310\310\253\026\336\306\364\207\033\0265]\335\346\310\252\037"
+	.ascii	"\031B\240@YruJ\001\306FGQ\272\346\035?\354s\243\237\300\177\363"
+	.ascii	"%\354\242\243\257\334]-YI\367)\364\367\2568T\264\371\272\360"
+	.ascii	"S\232\271\376GQ\034\273\\\235\230\302*\313\2662s\365\337\307"
+	.ascii	"\\\3122x\310\224\320I\0309\354\262\032d\003\371B*\032\336\304"
+	.ascii	"\240\037\257bO\033\376\345\232\025\354\035\350\256\035\310}G"
+	.ascii	"\016:\277\265\230\022\232\033\210k<\026\343\266`\332\250"
+	.string	"e\004r\220)(\355\342\235a\n\346\356>\326\361\343\272\022\370\335\322)\1772\320\027O\305\252\203\302\250\036\242\362\240-\254Q\335\202B\347W\367\350\306\306\023\210\364\370\226\255\310\366m\325\222S\364\325,\212\267\331O\027\311\241\213\272Jk\027\333\327\247D\2733[\007\346P\244\205W\324\031\265\245\367 (E7\230f\333f*6\3014\220\371t\213\212\2158\266.u\202\204\036O\232G\004\227m\006\345d\343\033z\373\343`\300\377\313g\034\321\351'\312\324\373\371{R\013\004_z\257\261?T\035\341\fhM\341\226\271\222f0r\240\206\332&u\373\221\265\277;!\036O\002\\\031&\243j>F\214:\036P\320\177\314\025\270c\240[w\347B\213\375\372\344&A\002\255\311\346b/\270Z\243\306\367\025\327\326\367:\270\336U\300\r\341\300\271\224\0060\316\260\301\017\363\272jl\356l-\3267\365\n\024\021\210\320"
+	.string	"b\021\266<\273s\333n\234\366,\036$<\367,Q\023>\007R\371~h0\266\235\366\002k6\r\017\263W\2151\316\361\357\217rg6\022\277\376\300\346\3533\234\324\337w]\306\372\304\362\263y"
+	.ascii	"A\"o#\352\221\346\362\214\200'A\245 .\356\311\304p\333\211\336"
+	.ascii	"u\236\222\013}hV'\224\3462,\206$4\016\370\327\213p\271\367\r"
+	.ascii	"\352?|l7\351\267*\2720\254F@\031\0163\221\250\213\224G~\n\"\214"
+	.ascii	"V\222W2\246\331\315\362O\030B\205K\013\220\275G*\222\b\255\034"
+	.ascii	"&\366\227\023\005\005\254K\002\351 \025\224\021y\257\016\370"
+	.ascii	"\267\217lqff3Hz\346\2208\343\354\361i\324\033\326p\263\306M*"
+	.ascii	"u6\304\247\245-%\374W\315m\216\242\2527\205+Jj\016\366\007\316"
+	.ascii	"^\272\207\232Y\212\017r\257hCU\236<'\032\234\356$\0038\270\226"
+	.ascii	"\311'\267\016\353`K\354f\334\245\261\bPV8>\262\224Rc\"\033\367"
+	.ascii	"\317\325\3173\320/\373\207\024\217e\265%\304\304<\277B\312,U"
+	.ascii	"L\226\262,d\017A\244R\034|q\222\317\304\276\317\370\007\337\262"
+	.string	"\232\3607\304\375\222\217\\,\313\220RQ\257\013j\\\252\235\f\256m\362\223\245\265\320; \207R@\211\375\343OF\222jll\272\003S\314\344\260\246\235=Lg;-bJ3\032\241\232Cin\345\254h\005\004\220\347\212J>\230\3257\240\352\356\276Y>\352T\201\266\354\006\t7\335\245\341\212\270\307\240/\335\344lA\026 X\312\342\256\013\214D\2048x\021\330\344\200Oh\327\363\357%Hn]\356\365\n\r\361\3561fR\202\035\035\356\026)O\bQtS\323C\251\005\241\004G^H\222\006\340\336dH{\376\340L\37338rvw\232}\t\0162\301Hu\244\024']\024\rByj`\354o'\254\251\325\033\361e\017Y\2161d\016@\337\2111\003\246\227\352\266\277\261\3402@\373\2175\256n\331n1\024\350i\\3MN\224M\"R\243\300\320\026\376P.\224\346\026\266\324\301\023=\257\214\317"
+	.string	"\1775\016\032\013,p\244?\0278\314@\3235&\021H]\245\027\346\202\217\237\226\030E\220\240\0364 \371\037\223\376\234\204\255\244"
+	.string	"\232;\315\232eNL\313\263`\302\327\211\240\372\r-\246'[\366\327\374\304:\030\027\177\f\260wm\2140\272\215\005Vn'\214F\274\225{\321\r\364H\314\274\234&\237\305\2720]=e1w\256\236\005?A\273\004\354f^\236\023t\360\226&\02145`/\2423}\333)zm\303\353d!vx\b\031\267=\024-\230\321\316n\242\207\275kmL<\332\233=t\301\021\024\006\260:\351\355\252\313\374\201I\272H0\336\303c"
+	.string	",b\350u\023\2307\2654.(E\237\210\253\f"
+	.string	"s~\344\234\020\266\033K\244v'\243e\360\315\3604\336+#2\017\221\223m\336]\354=\345\346\332;T\250\314&\324gI\371\226\300\375R\360\237G\361a\266vM\240\013\306Q\222la\325\020]\250\231\263e`\324\246Fb["
+	.ascii	"\223\320\306\fB\224\245\276\346\210N\253w\257\351\353\326\312"
+	.ascii	"\016\350]\234;\301zCgD><pq=\243\306\246BG\261\f\030\020%\376"
+	.ascii	"\355\262\366\246\272\f"
+	.string	"M\022\005)\001\351\234\260=\3444\272\223,\241K\034Wd\033\036z\351\356\277Iz\271I\313\253E\030\305\2045,\233\255\234u\\\373D\020>\032\202@\265D"
+	.string	"\031\330\0047\234\214\305\005[)\274\b(\352\347\200w\201\033:@\250\324\356N\016\031i\341/B.\356Z\030\201Gd\370ne<g\3072\025\324S\003\336\363\016\035\267S\246ij\032\273\253\373\367'\331\337\305\231,zd+-\242\025?2\277\341\340\314Q8\341\273\210\303\336\002U\302hl\274\227\"!\003\032.v3!\300\206\030\355L@_\001z\2769\203I(\222]I sH`\tKW\177\205\372\257$P\304& \251b\362\270b\274r\263"
+	.string	"W\036\325\001C\237\\{'<Q6&\223O\375H\357\377HZ\205\220\220\251\271\243\032\271\036\303)<u\b\374\253\243\224\377D\335\207=%\342\345\006\230\232q8\250\f\016\330\026|\226V\306\036l\273\326\273\271\002\025\3566HSU\300q\306\227G\301 \227\272Zx\247\355\242\027\220\352\317\340\354\200\001\370\344W\344\301\276I\351\345\310\021\262j \344\352\\\226\334X\002\374\235P\251\354\021"
+	.string	"\250\215^&d\364!A6\322\251^ y\3145\266b0e\354A\324\336\006g{#\376\007\212\203\310\207B\204\r\206\3338\2651\371a7\030\333\310\320\302\341a\333\332\032\232\255H?ap|\037\373\324+\"\nB\016@}\261p"
+	.string	"\347\232\334\031\376w0.\373\0345d\332.,dJ[\0306^Q\257G\340\2002\321\030\202\206\227\b\036\264\340)8\277RD\320Y\3370?s\215\374\323\030\266<\315\332\3519\331L`\243zmI#a\223\004\226\261&\202&\241\230S\206 \313\251\243a\227\\\213M\034(\335\217\231\216-m\224i\316\343\216+\350\210\243)R\230\201rwCh\217\250\365\375\372\021\242iZ\311+\203\013\3625i@\225y"
+	.string	"H\323m\224\022B\204\025\035{`ED\252j\216K\032\337\024jP\021\031LP\337\264\227\016$e\021':\326\373\366\363\342\230\234/\275PK\212\351\264\240\375\356k\2763\\\016\303i\267u:\t\305\207\246\t\212iK@\235\t\374\222\301\200y\032\247\260\234w,\302\264\272\016\307>\243\026\310\335\242__!lx1\200\201\201-\220\340*4\217\345\023\212Y\312%\021V\223y|\\\007\3655\342\303\233\243P\312\20665\023\373\350\216\021\262I\240F\023,\031W\237\013=\246I\212\230\346\034\353\\gu7j\361L\246V\0349\230D4!\302\322Sg\311\325\027\361$j\370\310xQ\030n\003\013\212\353J\203\0200\251\tf\302.\310\240c~\206X\264\302\344O\037\233\246\036,\225%\232Dm\030\2377^]\023\315\233\226#?\307"
+	.string	"\372s\245"
+	.ascii	"\321\362\022\260\334l\370\274CO\rcj\237e\005\222\217\006\223"
+	.ascii	"\357)Px.\307\306%z+\b9T\213\217\370VhXa\214\214Ar>\022%\020x"
+	.ascii	"\001p\312\020\277\004\246\020\224\243\332\006D\211Z]\224v\227"
+	.ascii	"\256\307*\025y7\267{\250\304ku4\300\nU\230\254\340\036\023\270"
+	.ascii	"\301Zl\373K\277~(\304[Z\312$\316\253)\0255c\036\304\210\317\261"
+	.ascii	"\223\216\f\215\345$h\\\360\307,\260\370\324M\305~\220\341[{,"
+	.ascii	"\241\360/\001\023\006#\246:\\\241\303\267p3K\340|v\376\001> "
+	.ascii	"\037tL\r8\017\264 *&\257\035\3403qLc\203J\331!)\237uj\377\257"
+	.ascii	"K=>\242\f\324\236K\177\201^\261M\022Y\021\305.\203\362\"}\357"
+	.ascii	"\236\036\001II\340\216T\344\350QR./ \322Z\003[\027\216\306\346"
+	.ascii	"\337\212\347\300\tp\313r_\017&1C\227\212\355\270\355Y\2135\035"
+	.ascii	"\223)\3253T\2563C8\257\276-iM\177\227\340"
+	.string	"\265\241T-a\363\264\214:\334IpM\377\020\207\217\324x\006M\"\351i\2242\324}Y`\\\037\200\341\035cV.\254\367]v9\006\367\001e`\264\221\230\207\025\2654\213\f1%\316+r\364q\374v\303b@p\2614\036O\330\366\200\367\254s\272\315\274/_\275\230\033\356\256g!<\365\240\346\273f\372\314Y\230\263\353lFEk\222!D\025\177\202h\311f\203z0]\303s\267\367_\353\021 %\177}fg\247\2403\272\034o\311\277\034\226\005\237\207\270Q\326\331<z\030\013\300\320(\222\335\367\202\201(\232Q\223\332L\273\372ig\275F\233\246H0\337\364,T2\204\022\374\216\354yt\020`U\3011\025\311\312nF\034K\007\300\217\r\230V\323|\364\035\003v\006j\321\313\223f\264R\317E\265n\312\016\361\202\n\346\231\247y\376\223T\241\006\346\260\356\335\025\272\227Pz\023\374\203\304\3427"
+	.string	"\020\235\255\303\221J\\\224\225\256{\336I\177iG\227\021\217\nf\213\270\325\356\2764"
+	.string	"\021BhW\3736@$f#\236\360Y%{\b=\247\253?\306(E\351\323\242\001\216\204\021\025{\253\225\002!@\220y\177\003\347\331\333\377\213<\356|uL\240\317\026\347LA\215\025\345VC\032iV\230j3\264\364/\021P\027\336\355\007\013\307\031\260\020\027\234\230\n{y\224\216)\311\362\020\021\213If/\253}%\346\273\204\264@_\342st"
+	.string	"\331pW\342\221\304\360+\005\360\337\ta\214\243^\371T+u^\255\343\256PVK\326\244\327\341\200lr\006\3068H\320\240\237\217jL\351(\002d}\216p\006\244\302\0343\177\302\301T\314LA\\\256\217\376a\300>\314C/3e\300\363%$\253\332k\202\263\2368\\C\035S\353\350i\204\351\230+\242\330\240\210\311\\\032\337\253\035L\030X}_\265\350\373\300\253\355\240\267\347\2447'\016\317\3277`>\235\003R\037\277\007\240\211\005h\343\224\206`#\307W\177\221\035\367\303\200\337\270\347\207\377V\037\203\323\373z\302m\227\2758\265N\0040\326\346\350\"P\032\204\335\376\330\312\255\321\236\234\276\323\242ON\033\322\007\022&@\316F\206\327"
+	.ascii	"\230\335iZ\261?it\224c\035U\2131d\273\301\252\017\020\215/\253"
+	.ascii	"\275\254j\346\024\374\235\332\005\206\207n\350^\245\326\242\321"
+	.ascii	"\377\356\362\023\355W\275}\2700\361\304\321\266\272\226\035\336"
+	.ascii	"FE?\304\355\221\331\315\362\314a\230}\364\242U\360\221\304\205"
+	.ascii	"\007\030\300x\202\273\360\032A\363-|B}\203\007\036\250\362:\203"
+	.ascii	"\027F\340\324\262\247<|z6\351X\247!\373O0oS\344\022y\261\302"
+	.ascii	"\207\027\266J\262Y\0346Ssc\2527y\232\210\3562\021\276\001\300"
+	.ascii	"\271\262\322}\215wH\353u\357\216\200\360T\275\327'\334\013B?"
+	.ascii	"\373\353\263\377]\317S[\262\313\035\217\f\317!\177\035\365\244"
+	.ascii	"\336x\001\275\177,\216I\332#\353C+P\236\2239\177\005\223\317"
+	.ascii	"\346\367W\221\333\354\372\033\373\246)\302w\341\316~\371c\222"
+	.ascii	"\225\240\231\375\354\037\274S\315\371KV\026\275\267`\230c\250"
+	.ascii	"\216\370\314\216=\263\266\177\221m\321\305\377\347?\035\275\007"
+	.ascii	"9\337\3534\003\372\221\210\241>\277\341\354\200\366KFuV\023<"
+	.ascii	"J\264\317\005\247\033P\356\2229f\363!\304tx\332Ozo\t\345\bDv"
+	.ascii	"\340\341X\230\021\377u\272{0\354\037\"\376x\217\0239c2\331\371"
+	.ascii	"e\363\216P\276e\331\330\352\335\254^\355\375\022w\023\245\275"
+	.ascii	"o\261\232\246\315$\333\020\357\277T]\327"
+	.ascii	"p\007\222\035Iy\237\341\261\330V;I\271\222)\342\020\313z)U\007"
+	.ascii	"\202\350=\375\362n\257k\276e\341\360\ruF\300\363\323\271k\365"
+	.ascii	"kr\027\335\250F<\024\235m\270~/\032\204\321\205h\317=\377{\365"
+	.ascii	"\250nV\214w\277\347\2037\213\306\215\020u\241\307_\343_\\\322"
+	.ascii	"9\204\305\307\220\356\375\300yf\3171\347\207\321IG=J\317M\244"
+	.ascii	"?\245\177n3\377\2546\201\365t\347\026p\234|\234\266\347`\331"
+	.ascii	"\257\345\3034\276\001\207C!\033\270\303\251\274!\353\223\317"
+	.ascii	"r\210\277q\220\017\2577\314\335\027\335\241\266\215\006\317\214"
+	.ascii	"\373\302\324R\002L\267\365\267\270`8\363\233T%\243\2419\357\244"
+	.ascii	"\271\245\344\257\200\255\2100\237\325\243\\\337\032\332K\336"
+	.ascii	"\322\333\256\013'\007\236,FdC\330\t\257_\243[\373\350\363\316"
+	.ascii	"'\240yO\227\037\301\343\335p%\327\021G\341\013\364+5\276\371"
+	.ascii	"\177\333\357v\363\244)\217\0335\234\372\266\347w6\366X\366\221"
+	.ascii	"\375?\317n\315{d\263a\020#\376\366\274\350\327\363\326\257\233"
+	.ascii	"\216\2659_\230\361\376J\006;\315\310/j\f6\367y\3613\236[\337"
+	.ascii	"\237\007\246\354\3149\227\221]\201\007\003\005\247n\313 \370"
+	.ascii	"\017\035\344\3009\203\317BLk\316hGOM^\262\327\037Q\016y\362\210"
+	.ascii	";\027T\350W6\272\325d/D\006w\334\013\342\307\231G\200{\272}\344"
+	.ascii	"\313\025\257\353\203\211,\261\350k\344\274y\030\037z\267>\220"
+	.ascii	"M\330\361\316\273\016\030\304\036L\357q~u:a\2051\006SFy\301F"
+	.ascii	"n\212}a\337?\303B\177\302\372\327\255\324w\377\017"
+	.text
+	.section	.gnu.lto_.symtab.def7cb563b4d1bc,"e",@progbits
+	.string	"pgResetFn_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"firstArmingCalibrationWasStarted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"gyroSensorBusByDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"getGyroDetectionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\003"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"isGyroSensorCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"isFirstArmingGyroCalibrationRunning"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"gyroGetAccumulationAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"gyroReadSensorTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\003"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\003"
+	.string	""
+	.string	"gyroOverflowDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"gyroYawSpinDetected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\003"
+	.string	""
+	.string	"gyroAbsRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"gyroReadRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"dynThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"dynLpfGyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"gyroConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"blackboxGyroCapture"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\003"
+	.string	""
+	.string	"gyroDeviceConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\004"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"buildRotationMatrixFromAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\004"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\004"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\004"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\004"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\004"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\004"
+	.string	""
+	.string	"getArmingDisableFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\004"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\004"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\004"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\004"
+	.string	""
+	.string	"alignSensorViaMatrix"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\004"
+	.string	""
+	.string	"alignSensorViaRotation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\004"
+	.string	""
+	.string	"mpuGyroReadRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\004"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\004"
+	.string	""
+	.string	"pt1FilterUpdateCutoff"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.def7cb563b4d1bc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,562 @@
+	.file	"initialisation.c"
+	.section	.gnu.lto_.profile.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 0m\001"
+	.string	"d\002$"
+	.string	"\004"
+	.string	"\304\225\207\302\002"
+	.string	"\001\314\324\377\306\r\004\002"
+	.string	"\002\001\002\002\002\003\005\247\243\326\333\005\006\247\243\326\333\005"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 \"\325"
+	.string	""
+	.string	"\220\026"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271A6\200\005"
+	.text
+	.section	.gnu.lto_.inline.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 \210\255\002"
+	.string	"\264\003|"
+	.string	"\002"
+	.string	""
+	.string	"\006\200\200\200\200\002h\001\201\200\200\200~d\002"
+	.string	""
+	.string	"\001\n"
+	.string	"\017\217\205\327\317\b\224\334\236\252\003d\003\f"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\220N\002\013\220N"
+	.string	"\002\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"O\004L\204\f\001d\262\032J\312\020\233\f\337|\032\246\360\033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 _U\002"
+	.string	"\244\003S"
+	.string	"\002"
+	.string	"\001"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\377\377\377\017"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"<\005\f8\250\344\254\007.\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 .\r\001"
+	.string	"\270\""
+	.string	"\002"
+	.string	"\001\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	",A\200\2027\200\005"
+	.text
+	.section	.gnu.lto_.lto.581f0ca6296998b2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsPreInit.35.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 \372e\006"
+	.string	"\022\213*3pi\323\001h\251\201\246\203\f\276\252\203`\361\030\301\330\335LH`\021\"\214\031\307\222\253\376\356LE\324\377\377\376]\270\025\363f7@\030\262o\315\312-S\227 9#\025\325\210\211\"\025e\204\225\316*\247\ne\2142P\242\025B\225O\315D!5'\205\317\326\313\232S\321\r\360\265\231"
+	.string	"X\b~\177\200\300[\354\021\256\273\330\3727\353q\302\277\214f\355w \016\022\256\333\340\302\242;\347a\341\377>\257~\211\t\301#\242\240\201\242\273!+l\265\257\372.\303:\260\314\332\327\270t\367\037\226\035\354y\377S\376[\376#\004\r"
+	.string	"3\001;8\243\306W\240\035\300\f\224"
+	.ascii	"\207\321l\314\205|\025l\277\214\033.\307\242\235d"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.36.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375`K\001\345\016"
+	.string	"6\\fF\360\2226\035x\205\\\337\035\bVo7\267*\272\003b4@U\330/!\2460)\3365k\356\024\361h\366{z3a\243\006O\330j\267w\360\313\022%\202}}x\230\203\262!ZI\247;k\361\266~\322\244L)T"
+	.string	"M"
+	.string	"P"
+	.string	"\240\247D\222q5O&#x\244\016<s\202\3173\233(p\2618\362\2629;00\204\314\271\332\266\304\305c\253\242\177\325\261\026$z\220\345xL\304\0273\320\312\021\004@i\302\004\234P\220W]?\224%U\215\301\234\323J\226!\356\354\266#\330^`\177E4$}\335\204N\013\307.\312\027=\332\216\200pa\223cR\035kj\203-zR\333\263T\310\270Z\245\035\355UI\027e\037\233\033c?uk\230zW\255\252>\310\033\201\370x\355\217\325<\275\206LV\246#\305S\277}\333.\276\312\001\317l\n\025^v\264\356.\002\230\035\333\302g\\\370\314i:\361o.\003C\206\224\024\3173]P\315\216\031\r-\032c\206\205-\312v"
+	.string	"\375\332\"NO\232\304d\225\333t\2379\347\211_\363\027\034\374\023\317\274\342\351\311g\276\347y\366\335\362\306\025\033\270P\304\205\\\003\357\363\240\"bQ\311\310\353\302\020\330u\bua7\3526\360\363\300\021\007n\243.\264\262\211>p+)`\217\205\373\266\320\363\276\r\264\"\035\233\033\243-\013\013\031W\213\264%\023\320\335\323\374\206\003\305\231\223t\322~p\033\020\006\340\320x\r\t\023PP<\001\031"
+	.ascii	"2\241y)\360\372\037/2\001l\006\002\006\376\232\374\r\355K\265"
+	.ascii	"\026\300\030\022\3110@0\215\215\256\304\301\216\365\fQ\260\236"
+	.ascii	"\364\3054\342\302x5c7QD\203\212\030\356\262U\215N\321\324\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"5\005"
+	.string	"4\007_\001"
+	.string	""
+	.string	""
+	.string	"\002#\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002$\177\f\005)\r "
+	.string	""
+	.string	""
+	.string	"\005.\016-\005\"\017\201\204\005!\020\001'\177\021\377\037"
+	.string	""
+	.string	"\200\200\200\001&\177\022%\177\023,\177\024+\177\025*\177\026(\177\027\003"
+	.string	"\t$\003"
+	.string	"\bD\003"
+	.string	"\007d\003\001\r$\003\001\f\320\360\372\250\001\001\204\001\003\001\244\001\003\001\n\204\006"
+	.string	"\025"
+	.string	"W\207\226\264\262\002\203\200AZ\203X\254a\200z"
+	.string	"p"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.string	"\351p\251\207\005\303\345\307\032\027\205\310\340\260J\213"
+	.ascii	"\r\227\235c"
+	.text
+	.section	.gnu.lto_.refs.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\003"
+	.string	""
+	.string	"\003\006"
+	.string	"\002\004\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.581f0ca6296998b2,"e",@progbits
+	.string	"(\265/\375`\204 \035\224"
+	.ascii	"j\35384R@NR\352]\315&\343Y\246%\347W~6\236\007s\031\005\362\322"
+	.ascii	"\335\331q[\325Y\035\276\242{\001\357\033X\021\212q\346&a\013"
+	.ascii	"3\032a\264\215i&\234\271\272\231?Z\f\233>\0164/\026G\223\236"
+	.ascii	"\341\366\227\002\345\016\271{\026q(\273\355\226I\246\362\002"
+	.ascii	"-\0032\003?\365oz'\307\021>\324/\275Rs\n\025\3243\235m\301xX"
+	.ascii	"NJ\027\250?\372\030\032\200\236\035T\331\342\366\246b.P8\357"
+	.ascii	"\207\360\365\213\235\303\373\032\324'\274\006X\017\033\337\264"
+	.ascii	"\2768\326L?\215\257\201\255\034^\352@'us\355M\235\001^\241\233"
+	.ascii	"\361\305D;\346\320\316`\016\255\263F\264\263C\264\263@\224\334"
+	.ascii	"?\212\275\\\354\247\310\321\270\223\32211\374\223\362\027u\354"
+	.ascii	"\371,\214L\245\307\022\231\323\277x\244\366\n\016\b\372\254\263"
+	.ascii	"J\332\331!\355\371N{f\323\021d&\372\207^\bx$\243\013\307\263"
+	.ascii	".\006h]\034YR{\3263U?\237\005\266~\213\017\372\026\270\313\273"
+	.ascii	"\200\257_\035X\313\276\305\257\300U\202N\352f\232\360dIi\200"
+	.ascii	"\234\234 \216\351\\\264e=#i\377=\375N\034\022\324\264b<\353O"
+	.ascii	"\247\035k\375\316\242z&\326\303\212{\240ob\3533\361\336\027\016"
+	.ascii	"\320\312F\220\240\226\365\227\323\376V\264\377\024\355_\325\376"
+	.ascii	"D4\226\352\320\017\225\352\227\ni\307{:C\261h\026\307\275y\r"
+	.ascii	"]\321+\323po0>\350\350"
+	.string	"\252\317\3427w\235\017.\026\2637\326\336[\203\f\326\031\322\363Y\254\206\263\3144\333\272\300x\326\035g\301m@;\256\350\325\263l0@\260\254/\304\264\025c\331{\307\254\310\341\344G\227\366:\027sw \366\241\304\n\311\224v,\325,\024\333pQ1\021\\\345\245\002\300\334\220\202\027}\226\n\216\016\203j\002\362\254c#\355\030\313]\250\244,N+\311R\025\013\211\326\023aX\031\225\021'g\302\352\217\2628\257#.\206\257_\230\312\311\2238\t\334\361\027\230\213\005\201{\227\t\251\356\275\245`(\370\fO\301O\260\031\276b2\034\005[q\031^\342\230\tn\342,uo\347\336\333\261\226\273\320\035wa-\\\206\305\\L\003\213\275\313j\004\300\264\363\252\272\333{\347\340\344\300D\253\317\265\f\254\233\320/\3057m\003%h\307c~bk\177\360\034\355\033\2647\240]\001\355\007h/@;\216\366\033\355"
+	.string	"h\232+\276iY\233\026\027\021:\346\262i\241Q\352\236\311U'Ay\317\376\353\366\232\005\333\264\276\215m\332\004\360M\353\216\263\334\261\020\214\305!?\205\244\373koj\215\314\226+@A\236u*\276i5\266i\335\377g\3668/\200;>\301\375\003\370\033\231\f\356\370\303\333\270c6"
+	.ascii	"\334\337\335]\203\273o\350qw\004\3343\231\332\327x\353\236\307"
+	.ascii	"\334\237\306\375\203\356\377\342\376\332\035\353\271\343<w\214"
+	.ascii	"\347\216\357\334q\235;\206s\307n\356\270\315\035\257\271c4w\234"
+	.ascii	"\200;\246\342\216\247\270\343"
+	.string	"2w|\346\216\303\334\361\216;\246\300\035\203pw,w\307q\367(\356\236\367\366\366\366\3341\215{\233\344>\200\222w<2\213,\365\326%.'\007w9\321\233k\331\0329*\013\225\216\fC\236\302\326,\345Y*\267\310H7\362\250\244\362\213<\343\250\205c6E\357\006\310\311\201\021z\232\301\324l\216\f\205\2559*\343h\312/\340k\224\272\217\202Il4E\357rT\226\346)\223\2668\275\004\212I\216\226u\240\363\205\033,\304\252\324\234\362\323\013\214\350\225\311\235vr\242\035.D\201s\267l\303\337\330()IYl\3325\232v=E\347\031\031FV:{\313L\231\006\266\346\031y)\317\310.>\t\024\2708\234\234\340T\225\220\254%\232\005\342\3642{6'\345\030\330\232e\344\350\226\221y\233\321\244\307\021\335\302\317\233\264\256\267\264k-m\224\217\2605#e\250\343\257\f\004\226\221\262P.\322"
+	.ascii	"\364\034A\003/\016+#e\0270S;\232\242899?'\353\020\250\226u\215"
+	.ascii	"\244\335sQ&\222\361\f\313\243\372\310\242i:\362P~\302\260\265"
+	.ascii	"\330o\317\272\026\322\256\235\332\177\\\264\377\346\264\377\256"
+	.ascii	"\344\240\031\257\251V\020)\331\005g\267\2442\271\231d&\306D\343"
+	.ascii	"\375\013\323\030\3477D\373\357\207\366\237\016\355?'\355?&\355"
+	.ascii	"?\030\177g\307#K\372[\021\203\235\206\232FE\325\371\333\371\233"
+	.ascii	"\006\242(!\317\266z\332[\273\227\203\213q\361\314\333\242\366"
+	.ascii	"q\017\367=\352\306\202<\233?\334\273=\235\333\013o\317\276\333"
+	.ascii	"\177\226\177\363w\373\266\030\347\273\261{71V \210\261\002\276"
+	.ascii	"&:\232EZ\326[*\332\353\036\313\213\335\021\216-X\326p\033\225"
+	.ascii	"\264\273g\327^\r{5\233@\317zK\246\275\255j\247b\033\0334\263"
+	.ascii	"\271'GL\352\326Z\334\213U\243`-%R\300\302\314\210\214\275\026"
+	.ascii	"\224'\017\345\253|\331G\371)\177}*\177\366d/\005[\337\354\231"
+	.ascii	"\3707y'\376\022,)\373\257#\237\344\f{\ry\255`\336\233\006\026"
+	.ascii	"\252\267\272z-|\215^p\305&\3647{\257\357\302W\034\030`M\371\240"
+	.ascii	"\363\341\315\336\372I\202L\352.\372EA\351\252w{Ss\332\351\031"
+	.ascii	"\232\035\016\353q\370\246\r\2664\264\267F\332[\246v\237\026\355"
+	.ascii	"\2764\215\263D\273\317\210\346\200oZ$2zVz\\\262\264\373\242t"
+	.ascii	"\004>&\375E\236\013[7\274\021\307E\236\210\373\232\324M\375\250"
+	.ascii	".G\212<\353>$\355xC\233\367\366\360\206\326}+4M\225\305\323/"
+	.ascii	"\344\261\260\325\200\317\312\314\255\215\305&\231=I\315i\307"
+	.ascii	"\006\264x\017\033\320:\233\246}\r\337\0041`\206\2324\344\364"
+	.ascii	"@\230$y[z\326%\230\3616\360\365K\004\226\331\034\035\226\303"
+	.ascii	"\327(\315v\026q\241\305\356\371E\017}\033\262E\024\307\345\211"
+	.ascii	"\266\244Y\301h\231\b\324\003\240!\031\257\364c-\316\b\313\005"
+	.ascii	"\2315{;\271Q\245]\301r\025\004A\201.\212\bi\251\303hA'\315\336"
+	.ascii	"M,b\270\303hez<\236\352u\274\217\207\341{|\324\277\360O\277\343"
+	.ascii	"\253^\352o\374\324\347x\034\377\003[\037*A\332\361\360\362\032"
+	.ascii	"\336\332E8;6\207\231,&,Q\360\264g;\234\357\3562\235\347\275\233"
+	.ascii	"gT\277\251&\333\016,\231\016\347:l\315u\231\016S7\263\215\222"
+	.ascii	"\203F\037x\331UDjOt\246{\230%\033^\244K\326\234\236\365L\347"
+	.ascii	"\236\347\036\354\223\240\200\217\310\246S\317\372\272\204\236"
+	.ascii	"\345X'\273\"\036p\216\255\031.\247\375\326f\006\303\252t\325"
+	.ascii	"\230+ 6\212\260\334\034[\263[\256\202\263\265\231?\264\031KJ"
+	.ascii	"w3hW\204\340\001ac\313mST\200@\252\236\254\332\200;\252\232\204"
+	.ascii	"\236u\230'\355\331J\276\342Y\315\335\325\362\232\336{\3430\243"
+	.ascii	"+\350\335\216F9\260z].\216\274\316\363\232\257J\017)$r\332\375"
+	.ascii	"\335\333\335\204\356\275\217|\324\r\005\212q\354\303\230\203"
+	.ascii	"\273\f\316x\001wg\335!\350\331\273\371&\325\242\253\304\232K"
+	.ascii	"\236\300v\337uo\347\224\211\301\324\3109\215\361\344\232n\246"
+	.ascii	"S\212Y\003\335S\346\223k\357\232\355t2EHw\315\223k\033m\027\252"
+	.ascii	"\030\341M\2352\267S\272k\266s7\023x:\247FO\256\246Q\315\223k"
+	.ascii	"j\264\271\246\233f;\233P\026\316\r\255\331\\S\271\315%5\242y"
+	.ascii	"rI\215\236"
+	.ascii	"\\S\035\030\007\213\037sGn\322\247'\230\310\323\271\211\206\230"
+	.ascii	"\232P\232\353\223*\335k{\343\257\240\r]`o&)t\255\031\003W\201"
+	.ascii	"\256D@`M)\246\016\0015I\267\363\372\354!\335\273\007\020\212"
+	.ascii	"=4\001\223z\3359\360\225\351\304\264\205\202\366&`ho&\336\327"
+	.ascii	"\2757s\357\375\2032Q\367V\242yR\r\r\355\035\305\031\332L\314"
+	.ascii	"\261\240\275\377\213\255j\364\344j\222\n\307\272\270\250\366"
+	.ascii	"\n*\023S\355\265)Ts1\211l!:Me\2044\367lF\213i\222\305\310\331"
+	.ascii	"\225\316T\332$1X\305\250\272*y\261b&D*\346\330\232\305\362Y~"
+	.ascii	"\352\355\324\322\213\333;\372\200\314\226\253\247\035\317\232"
+	.ascii	"\245`\243J\366\254\277\300\240\035{-\311VS<*&\331\352jKY\226"
+	.ascii	"\222\243\344'\330\232\241d'\236\253y\314\231\241\344&Y\211\006"
+	.ascii	"\240'\253u\227\255P2Y\266\232\242\242\253\372nT\323\232/\254"
+	.ascii	"\277\324\320\376\022\325\376\362B\373\213\220v`\236\366+\266"
+	.ascii	"i\3335`\f9,\206L\253\013\323\215H.\222\277\262\221\354\225\273"
+	.ascii	"\362VN\222\2712\222|\004[3\330\253y\366\221\1778\216W\227\262"
+	.ascii	"\270/\260\337{\2676\007\025\251\244\f\226\233\271\007\363%\207"
+	.ascii	"\r\251$+tfTx?\027\205\312\b\027(EZ\244P3\330\353\211\305\275"
+	.ascii	"\225+?Wv\006\366y\277\305\311\2234\260\f$S\345\244\222\262\321"
+	.ascii	"\326\021+\0346\017I\203\032\261\223\312Z9K\306+\212R3cy\316\212"
+	.ascii	"\261\013\312C\362l\026\222\247t\271\321|\326\353\362\225\214"
+	.ascii	"\026\225\232\223|\225\255\246\210\246\352\274I"
+	.string	"\016\202s\2201s\334\320\016d\322>j\031\266i\253\276-+F\327\263\016\204j\252\274\003[3\217\374\364\2743\223Gv\346\025F?,rM\321\257\3618\302Q\364\270\305\"q\201b\221\370\203q\207\"^`\034E\007\003|\220\305\240\322]\256\340&i\224<\356\214c\214\335\347\343\276J\025%\002`\337\242\373\272<\310w\231A\2157\360\032\217#\334$\211\240\027\215I\367\350\236\320>\001\b\b@T\320\302\317+\260 \002\013\"h\275\002\013\204B\013@\b\265\203\020\346\267\346u\223K\022\312a\233\302\345\311oO\006\310$Q\203\237\233\\\276\304\244\373\343\343\216\300\276\216\242\203\003!2\374\334\227\330\263,\366\020\213\300W94\376\2240\341\212\030\216 Q\002\306-\036\211\257\362h\324\357P\204\021\354\321H\342\250,\266\306\037eV\016C\350\214\200\t\2413\002\330\026u\214\331QtP.\335\024\306$\317"
+	.ascii	"\312!\b4I\367U\022}\332\237\233\202\330Sb\371\343\243\227C\255"
+	.ascii	"\034\212P.w`\334\241\373\243b\004\345r\007\370K\341\362(\227"
+	.ascii	";\355\220\307=\032w|\220E\231w\251U\020{\\\236\341\317R\277\357"
+	.ascii	"\373#\202L\222\370*\365\317r\310Ct\223\277\344K\242x\\n\360\272"
+	.ascii	"\034\364 \221\032\f}\300\237\345\360uO\264\216\242\003\002\312"
+	.ascii	"\341\t\243\211#2D\322}]\237\032\367G\305\253\\\356\314\034\225"
+	.ascii	"\305\241\361G\351\026\215)\\\236\031\245\322M\362\360\020\207"
+	.ascii	"E\035#\215\233$\262\300\223$\242x\207\025\374\336\343\022Y\034"
+	.ascii	"\272=?>De\215\211\237\236\241\2534\"\217\301w\bB\330\343\246"
+	.ascii	"\030\232(\302\024\221n\314;<A\034\001i\374\235 \276\303dO\261"
+	.ascii	"\205!2I\334\221Q\016\333w\250#\301{4.\265\353c|\177\220\310\017"
+	.ascii	"^\367D\222\370\006\335\036bQ\351\013!\"\203\237\211\020\"2\320"
+	.ascii	"\257r\230\302\025\001L\341\212(\301\0021\231\241G\346\346u\024"
+	.ascii	"\035\b\250Y\016?@&U\234\260yU\300\312!\214\322\347\276\304\267"
+	.ascii	"\204\360\375\t\352(\225\304\037\026\220=A\241\320F'\346&\371"
+	.ascii	"\222\240y\225C\255s\334@E\317\317O\006\001\004_\024\035Lx8\""
+	.ascii	"}|\220\305\002\034\371\343&=\274Hd\322\003\214\216\212W\016y"
+	.ascii	"\210\313\025\214;A\027\nC$@B\b\034\350b\207#\322\370\022\225"
+	.ascii	"\306\036\242\3615\036\215\036\224I\244\362\350*=\034\215D\037"
+	.ascii	"\017\305\244\322C\007\006\"\330y\341\316\353\354\274\220\370"
+	.ascii	":\304\027\266\360:-\274P\305\353\034U\210H\272o\217q\003\024"
+	.ascii	"\305\027y\234\221\341\371\f*+\252%\372L\013\213\326x\226"
+	.string	"\212\025ST\024%MJC\352\222!\004\203hM\372$\364\"W\261\233\256\240>\213\324\246\301\234\320\323\221\347\265#2p4=\313BYhn\373ZRb\203 )\"\345Y\227!\022\022b\211>0\325~h\034t/|\260C\316\022\325\031\271j\275\215\366\254(\017\017\215m\301\266\310mD\252@\t\202\2230\271<\311\264\263\233}f\330\001\245\253\336\211\300\266\002\217]\341\3543\330Cj\f\353Y\326\311\006\371\272\210\232\272\330 \326\205\22710\037r9L\306J\333\320\223\005za\322\262\202{\226m\262x;\240YHX\346\020=\275\274\206#\315V\206,)e-3\236VUyy\302\261*P\202\004\205\204\264\305\004\202\254\250\"\321PI\322\224BF\231\031\031\031i\222tb\n\020\206#r\230\365\264\007\022`4APR\347\314\214\244 )J\245=\003c0\205$\"\250\356\262\211_\213\031/I"
+	.string	"\274\336E\244\205\331\200\331\350\374w\027\f\207\211\230\234a\b\315D\032viDbL\335\b\031\241P\023\177\331\347\360r\223\322YI\354\335\031\003k\343\211\007\316\007[\374l\357\177h$k\\\244\020\022\234\177\004Q^&\005\253\224,-FtKL\323\363\\K6P\341`k,z\344\006\262\20562\035\"_&s\357\tq\236!\315V\350\204J\346_\215`:+\306%\3336\245\270\221\251bb\351\211Vg$ G\276\250\021\235\230\216\001\241\013\260\002X\231L_F\021{\255\233\311\336dY]H\013\017+\210\001.\321\251\225{\247d\003\270\260mK\227"
+	.string	"\362~\016\016\221\303\343\325\004\232\377nQR\bC\276\215_o\315\034%\020c\301{\032R\005\036\210\213q9GZW\020\275\003E\277\037Y\273\217\002\340\360\034\001\273\035b\013cX'\002\b\227s\b\205\323^\177\203\312\231\023\276\271\314V\033\335\370bmBO\231_W\225B\264rN\364\261\330\272\275\327\320(em!\320\211\\\342s\347\f_Y\375W\253\033m;-\347\326\b\241\237\327\226\207\240\033VN\3426\342\001\267B\344\307z\t\326\304\030\212\254\372_O\215\031pIP\003!\n\263\006#\t\254S\330'\256\350$"
+	.ascii	"}\2707T\363\017\035\365(\346\375k\241\271;u\2545\343R\026\230"
+	.ascii	"\220\316\262@2\350w\223\016\362y\303\243\255l\tc\316\340\206"
+	.ascii	"_\021\355\\\344\271\347\3303\362\226\034\341\336TD(\246\022X"
+	.ascii	"K\310\253\202z\214U\335\345\333\024\024^ \355!\343~\267K\303"
+	.ascii	"w\020*\027*\206\303+\\=h\313\355Nq\013\262k\227\177\317\230\031"
+	.ascii	"\233\374/Z\034\r\b\320\307\251s\234\204+R\264\222\024\003\222"
+	.ascii	"\232\254C\360\273\347 -\t\027\346G\255\351\270C\002\311T\036"
+	.ascii	"\332!<:\206[}|\233\b\3668\022\300\276`i\357\256V\373\257R\016"
+	.ascii	"Ir\214P\234\244\207h\2478\322\353R\301\251\265\f\337\372\216"
+	.ascii	"p\350 30b*\301\273\306[\210\024\001\370\214\017j!\013\342\351"
+	.ascii	"\230\354\2222\210\324zPy\244\210;\323\036\002\363\fQ\3200\215"
+	.ascii	"\302_\222\027\204"
+	.ascii	"G\3016\031`\327\360\264T\341\370\234\301'\247\303f\374\2151!"
+	.ascii	"H/]\0075\n=cKF \333n\r!N\346\025\252\233\216\377\324/\253U$\367"
+	.ascii	"\213\277&!\001\247\210\302\345\tOh\371\232 J\352yi\341\260\345"
+	.ascii	"\005l\330Bx\021\371\345\310S<\004!vEl\214\026\325\342\230\344"
+	.ascii	"^\353^\301!\245\3270X\311\027t\365\336\2002F\022n\331\026\310"
+	.ascii	"\363\"Q*\304\2242\256\200dc,z#\272[R\244\272 U\003}a\340\017"
+	.ascii	"\027\"5\177\224s\360a\251\312[\033\340\243\330$\327\373Ib3\362"
+	.ascii	"\200\331\\U=Y\377\253o\320\037\207\334f\004d\032\224\350\212"
+	.ascii	"\030`((\375Q\332l\253X.\3564\037\201z\320\260\232\232\321yPu"
+	.ascii	"\035\003CL\023\007\205)\246m\255G2r\n\\\321S\257x#\310\024.\243"
+	.ascii	"\020HqIR\354\217\332\236\216\242\266n`\206\264\335\227(>\241"
+	.ascii	"?8\200(c`\2724s\236\321!o\263\356\303\316e\301\355\031>\257\365"
+	.ascii	"\200\344\013\261\365\315\363\324`\330BlSDcG\003\034g\256\260"
+	.ascii	"\200\342\303\204\251\375\227\037\345\210\344\230\375\374\233"
+	.ascii	"[\004\372\345\241\223P\033\332\017\006\362'2S\256\331c\031\222"
+	.ascii	"\3546\034\262\345\026\017\237\212\r/9t\364\231\272\227H\237\204"
+	.ascii	"\306\204\022\027\023\374\203\313\365\300\265\027\262\303\303"
+	.ascii	"\376w\373\275\025\200\220\223\345\226b%C\021\035\002\243\214"
+	.ascii	"\324\0351+7(\237*\357\021\217Rk\354|\372\025\177W\006]\370\017"
+	.ascii	"3"
+	.string	"\260u\243\307\275\276\232\006T\203\326!\335#\333\372\344\274DS\027\226/:f\027\226M2\345\303\311\300\025\007\335\320\017\270\335C\202\203fM<\225\220\324\201\rb\245'O\323V\bEO\026\310\031\223%\240\307\321\006\3377r\256\255\367D\020\353:\340\316\322\027\335L#w\3509\363T\\!\222\207\306\307\341\035\216t\002I\344\327\327|a\316\200P\332\\\250\334\372J\177e\203H\356\234V\314n\210\321\303\241\223\375\331\216\004\027\372!%\343\223\260\351\325kq\200:$\241\361\256c\235]\303\353hfF\376\260\267p\311\333\212\362\223G\f9\301\211\327\237\2012\243\344iQ\264\361\221i\220R\327\271\273\242\\\n\2626*\004$7jll\375(\330\214\202*\272\f\340\265\321\036c\311d\274\230.\026\005N\354\330\203\235\030\232\307\233\301\210\335\001j=8\001\243\323P^9\275\370\300\337X\f,\001\367\365]"
+	.ascii	"A\311\207\020\363\032dK\324\252\377-u\027\240\303\b\223\236\016"
+	.ascii	"\236E\030\341\276\001\257D\313\377\036b\035U\276\345\314\367"
+	.ascii	"\035\337s]_)X<\036\307sn\273M\244\013\331\013\316\206\347m\351"
+	.ascii	"\312\347D\203\273\327=\346\352\247\337N\246\373\343\365\004?"
+	.ascii	"dk\005"
+	.text
+	.section	.gnu.lto_.symtab.581f0ca6296998b2,"e",@progbits
+	.string	"sensorsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"requestedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"baroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"compassPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"gyroPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.581f0ca6296998b2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,791 @@
+	.file	"voltage.c"
+	.section	.gnu.lto_.profile.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 \354E\005"
+	.string	"D\b\340"
+	.string	"\025"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\241\355\342\223\n\004\001\002\001\007\333\326\241\250\n\b\207\216\227\262\004\002\002\004\002\005\n\274\205\242\255\006"
+	.string	"\013\f\357\313\212\236\006\r\016\244\310\245\335\004\017\314\251\277\367\n\020\224\265\361\317\013\021\022\023\242\302\263\302\013\024\025\225\254\310\321\004"
+	.string	"\r"
+	.ascii	"A\211\245\356\272\230\366\203ju\206\274X\320\245j\bE\230\262"
+	.ascii	"S\002\362\274\377\na\271\2016\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 k-\002"
+	.string	"\204\002_"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006"
+	.string	"\001\007\002\001\b"
+	.string	"\001\001\n"
+	.string	"\001\013"
+	.string	"\001\f\001\r\016\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\f"
+	.string	"\270"
+	.ascii	" \240\3120p\242\247q\250\032q\352\025\020\007\006S\231\366\022"
+	.ascii	"\334\006\332"
+	.text
+	.section	.gnu.lto_.inline.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`E\001\025\007"
+	.ascii	"\262\313\"(\220'I\007\227\352U\305=,\337\276P\003\235\347f\310"
+	.ascii	"u\313G\326h\273\353\302f\306=\022\266\265\326\b!\244\221-w\n"
+	.ascii	"\3174\367\371\244_u\325@\037\032\214E\0078\376\325k\270\325\204"
+	.ascii	"\037\271\003\264\2120~\212.\032\f\2065bQ\022\344\357\307g\232"
+	.ascii	"\345\3144\247`\001\322G\003t\310\314\200\325\377\231\365\340"
+	.ascii	"\257\024]'\244\220\231\013\237\030~\020\264=>\352\031\366t/k"
+	.ascii	"f&\372DU\177\324\373\276\004\266\326Zz\345\n\004% \260\"\261"
+	.ascii	"\232\036Z\t\002H\321\220\b\320\212J\266\260\356\024yrD2'R\214"
+	.ascii	".\320|s7\304\206\356p\r\240x\265\327,\254\033B\252\245\210\267"
+	.ascii	"F\343\202\320\333\025-\302\331\207}9\261\t\371n\355\234\t\\O"
+	.ascii	";\033]7\314\326P!_\035Z\001\206"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"}\005"
+	.string	"\342\311 *pi\222\016F}*\305\213\327\257W\032\003\n\n\300\003\320\370.\326)\262\240\252\006\252hm\375\333\331\177z\373[#m\023\231d$\257\177\326\324S8\032\251\307\224\353\273H\006\271Xk>\250\222G\356\013\2570%3P\222r\330"
+	.string	"\242\001z\310I\024I\020<\317"
+	.string	"\244v;\352\035\325)P\203l\203&G8\241\302\017\b\020\320\013^lF\250\227dd\223zM\357\361eH\305,\226\252z\351\2718\021\021"
+	.ascii	"G\220\003\332\270\242f\0028A\263\235\234\357\300]'0y\202\341"
+	.ascii	"\241\242\300\305C\260 \r\021\34020M\345\312\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\007"
+	.ascii	"\232\004\b\270\004\n\200\004\013\200\004\f\232\004\r\232\004"
+	.ascii	"\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"\265\003"
+	.string	"\322D\017\030\260'\035\200$y\r\311\270B\252\026\350j8\322\210\261m\223&M\312\024#\211r\004?[U\"\333\002X\030\256r\370\216\250U\350\335\371[\317\271Q\256\232\312>cO6\234\030=O\027"
+	.string	" $f\031L\254\030\210i\007\006\203A\300\001\313J\220\257\202T\016\240\275Y"
+	.string	"-\002\0063<$J\210\236\022\354J\027(\003;;v\016\326e\3662\362"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.fd3483459144d713,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterSourceNames.23.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 \234}\004"
+	.string	"\024\bU"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\264\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'1\370\257\005}\276'6\206\b{\by\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.string	"U\245\366iu\200\332o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_voltageMeterReset.26.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\205\b"
+	.string	"f\320;6@\223\032\003\030oj/0\364\026\323J$\324\036\212\236\311\2532\327\f\265\t\326^@\371\215vp\333\036\3354\\\006\004\206\252^\345\317\337\177\003\357d\254$R\246\024)"
+	.string	","
+	.string	","
+	.string	"\231e\275\366\305\337\352n}d\270`\377g\354\260g\350\325&q"
+	.string	"*e2\004h\370_\210Jm\270\321m\021\332.\264u\t\252\326,\033\312,\246\305\200\346\327\210\325\374%S@:m\r[\213x\3043\253\344\201_\265r\362\177\nM\340X\366sAf\3111A-\267\023vI\030\226\020\223\262\266\302&$\316\177\206\272\304\342B`\345aY\2272K\211\242\002\2339\301X\373\231`\344h\275\371\377\306\2346\322B\262 \217\366\360\031El\024\263\343\266N\244uS\004\361\tM\020\327M\317A7\t\215\233\243m\343f\347\2737\217\252:\310\274N\021\243\016\013"
+	.string	"2\241!\034\030.XIQ\362)\262!cY\301\274K"
+	.ascii	"\315j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.28.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\035\t"
+	.string	"\306Q@80\221\322\001#T\234\207\207\033(f\022GX\235\213\334\305\361\373\240\262Cg\250\326p\363Jk\003F\316\345e\263a`\240\020\205\330\255Y)%\340A\233\263\3266\221;\245/"
+	.string	"0"
+	.string	"."
+	.string	"-P\207l\245R\263\033N\207\017\340\\z\016\300\271\324\217\177\217\237\377\222k\".\032\220\225z\3548\354\256#\310j\335z\333\007\266\025l\313\004Q\243/;.0\0043\273\0333\233}\221,!\266Q\366\307\266F{\201\001\365\030\206u\327%[\331\r\023\214\340\271\264\355\217\234\004\345O \204\005\3168\n\205\001lw\033L~\342\371 \227\2568\305\203\227\376I\037\003rD\275j-\253\033U\234\331a*\252\207}m\365e;Z\037\373\003\027\333C\211$=\nm\020\"S\004g1\275\216\363J\2337K$\221\304\034u\336\f\r\230\233\330\272i\342\270n~\302\275\266\372\262\026\250T\303~\312\007\202\201v\013"
+	.ascii	"D\023Z'\306\345#\251\232Pl\202u^h/\241\272&RbA\240:D4]\363\t"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.32.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 \241\265\004"
+	.string	"t\bj"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\374\241\037\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\357\030us\250\374\007uq"
+	.string	"\005\001\006'\001\003\005\001\006\035\001'\001\202\002?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	"\237\n\013&\321)\212\274\001\024\001"
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.33.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`'\001\225\r"
+	.string	"\346\031\\C\020\221\223\016|\272\260/\360P\251\004\221v\360j\2663\310\327"
+	.string	".\306\256\367\003\203\t\005\3758\351/\302Z\214:\030\330 \230\\)\306PUU\272r\335n<\004\223\241\202\1778\274\332q\251\265\275\245L)G"
+	.string	"H"
+	.string	"H"
+	.string	"3\356\241\354\277\034\032R7v\367\322\020\376\241w\303\334\036\241\346\346kBX~"
+	.string	"\005\206\353H\217\220\263\273"
+	.string	":\f\220\223\246n$\241\b\223\353[\236\340\204\006\327\231<5!\273\353\344\272\016w\346\2663\333\f\354k\001\273%+\035\353\022W\250d\376\263\237\272\347\267x\363h\227\270\211\355\237YX$\016\226\352\333Qcw;\217^`=r\3407i\177\304Il_\271@ \300\222|\033T\354z\n\374a=\332\373\200\314\243u\001\231Gov\273PQ\252\243\020\201O\371\211\n\022\362\005\306n\206s\217\276\312\202\210\237\342S\310<\"x1\201(\345\312Q\257O\275A\213\223\030\316F)W\252\212\262=R\352iwI\326\223\375\225?\376\273\363\351k<<\2740"
+	.string	"\023\241\203>\"\317H\023\205,\177@@\016<\243\007\330\204K\3130M\004\322.Q\310\003\341\372d\332\005R\300X\004Pv\2150,\2736\336^Of\271\225\342\203KIG\034\025e\215\013\375\270\312H\223mw\236\252R\022\363\305 I\034\207\273\001\031"
+	.ascii	"2\003\376\031\322\340E?\256\304\212S\267q\272\b\316$s!\314b\\"
+	.ascii	"3\346G\224(.\013\241=U-\007rV\035\313\332\002MX%\020\0277D\224"
+	.ascii	"\rv\332\333s\300\237\224;\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.36.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`&\001\325\f"
+	.string	"VWUB"
+	.string	"Q5\035\200\302\320\262;:\030\250ZUp\204\b\352\246\t\037\375\0212\304\034\002\030A?x\342\267p\003\n\325\230\217\221 \231h\342n\b"
+	.string	""
+	.string	"(\221\336fth\313\362;\325\352\313\301O\233\354\235R@"
+	.string	"@"
+	.string	"G"
+	.string	"\037G\354IW\006\262\334]\216\212\2606\301W\215N\320w}\242p\214^5\313\356\006\b1h\226SX\232\232\211\324\351a\237\0350d\036\2630\365)Y\260\273\236\246\020uo\267\375\300v\001\373\245%\bi\216PJW\3668\232swG\246*\373\342\375\255A\253\264q\361\330\3250\"\2621j\007\353\342\355\307\376\362a\246\274\0328"
+	.string	"^\024M\266%\231\221\342\307\356xy5f\362z\212A\233F,\0207d\314\2700s\\\333\335\325|\362\266\347-@\225\016\037X\254"
+	.string	"\020\002\344\204}\320fwW\001\252p\020A`\033s\331\007n(=\274v7\001\212\247\220\340\227x5\205\n\363\246W\337\302\366\372\330\t\220j\004\235{\223\3418\320\204 t\023\270\317\353\276\017\347\343>\035\215\207\333x\037\227\031\340.\002\307\343B]\347q\224qOU\2563x\321\n\371 \321\222+]Y\201\013\372\213\266Jb~\366\323\223-\332N\017\273\200\220\033"
+	.string	"2\003\006j\214\250\303\213\232j\212\212"
+	.ascii	"\001sLx`0@\004\021B4\201\2513e\315fx0\213\201\271s\271\24732"
+	.ascii	"U;&%\343\345\212 3\334N`\264\253\302\357\231uPD^\327|\002"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.37.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\r\001m\f"
+	.string	"f\226RC"
+	.string	"q\234\016@\300d\274\341\244P\222\222\233\351\360v n\3110\312PL\022\034\330_\fO\362\277Tp.)\212\233 >J\tUUA\301H\377\230\227l\022\216)\035\321A7\335\212J\035\271\355\336)\005<"
+	.string	";"
+	.string	"E"
+	.string	"\330n\206\026+v\313"
+	.string	"\006p\275\232|\304z\245<\304z\365h\313x\311a_\212A\241dcw3\272\341\343\347\350\237t\214\364p>9\n\354\256'\351\261p\323\333>\261}\261\217!\032\354SvwM?\366G\177\275\350\247tz\322\351_\225\032.,\250\335\n\253\324\236\252\251\203\355Wl\317\362\"\306\2176$ ;\201ta\300\365\352\362\372\264\017\342!\306\213\"8&\225\207\024(&\305L\252\017\2476\346'\272\353&\304\214\b\f\320\306z\245/\310\031V\360\022\035\026J\t\260\r\341$\276\217\020\212@\351#\030\370\240W\207\r\346\311\007\326\353)\026J\335\020u\346\312.9\223\006 'r\007<4\234\347i\t.\033\002\255\303\233\205\303h\242\346s\220\205\340\027z\\\230y\031\255\31360\314,%\376\026p`&~\037\230U\312=e\351\307\006P\247\016\225\340I\355\355,(\r\356*:,\032"
+	.ascii	"\2263\241\214\351\3043\f\267\352\030h\003/\002M\240\273i\310"
+	.ascii	"\362\0069M\2572\226]\250\306\215\320\\f\235\373\226\265\331\312"
+	.ascii	"\360\2265\027\336b\230\027\204\337\324\024\270\027LM\001wy\321"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.38.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\237\001\235\017"
+	.string	"\246\035gE\360\222(\035R\027\256\224\306\342\035+\240{\035 \325*jW#\237\034\321/P\030`\327\252\361X\372\350\377z\032\271\302*i\001\364\353\027\340A\3406\021\332\236\367F4\272\212\2707t\n9b-\331[\312\224\002R"
+	.string	"N"
+	.string	"V"
+	.string	"-d\337\315nL\344\321\006:\217\367\370d\337x\214\304^\346CE\246cw9\035a\230\247G\250y\3629$2\037\220\342\363Z\250G\370\331\335\220V\n\374\344JK\225\020\005\313\365\257\027\210\371\274\026\313\223C\262\273N\257\365\341\336n\333\202\355\003v:&\276\211Gw\032\362\336\243]\332\220\367|\330\337a\326Rc)JUa\354\230*swQ\326\027\373\256{\203\351\b\323\020\246U\323\231\351\203\204\200\230\301\345\330\365\360\365\330Z\214\021s\327\355\303\256\302\177\331\363\230`\301\351.SgOp\002v\004\t"
+	.string	"\322\264\273\324\230\2119\370>\034\366\004\ny/\352'EQV5\355\"\334Y\355\246\b@=\313F\225\237SU\357\202usM\275\312\017\273\302Y\200:\273+\006~\315W\204D\243\217\266\307\253\002\227\232\035\257T~\366$\310-c\023\271Os\001\301g\002%whD4\002\241`\3508p%RW:\021\225\270\223\022\220\t\027\"\225\270\021\001\3562\210H\034J\327\2218O,u}\221yg\026\242\226R\225\243\302\270\201\215\376\246-\226\310\303\370\246+\276i\333\024\326\362\321\320X%\217C\350"
+	.ascii	"\031\325\177\361\340\263\323 \300\333\306\366\030# P\202B\207"
+	.ascii	"\332\001b\300\317\030P\003\341i1\024%\236\270\212\035\227 \030"
+	.ascii	"\002!\t\007\357h7\247\307\372J\346\234\245%S\003\364d\207\335"
+	.ascii	"]r\2550\3162\256\334\360`\305:\327\374\203jd\326\216Ie\334WD"
+	.ascii	"fh\225\205e\355(\017\"\235K<\001"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.39.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 \302E\005"
+	.string	"\262I$-pU\323\001\032\345^?\003~\r\035p\277k\260T\025\216\021\023\250\221Q\333\251_\247b\233PU\261Z\034e\332\037\334%\344\026\355-S\266\250\253Qe\2209\221\225\316\212]Ub\217*\"-Z%u\360\224\\TfsR9}\337\350!(\261b\177\033\214\031{\005\377\357\350\331\320 @Z\210\376\313@\300G\203\020\307\366N\326\354\322~\233/\250c\371"
+	.string	"\374\227Q\263\332B\315\273\236-p\335\266\220\300\370o\310u\230u\\\333\t\333\n\333\216\007"
+	.ascii	"3\003\316\231\021\340\313\3512\376e\\p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.40.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 \302=\005"
+	.string	"r\211#+pm:\240{\375l\201#.\300\232\350@S\303\325\201\375\330\274\250\355\224\255\314\331\335\375\377\316\253\234y{\361T\336\217ho\231\002\277*\271\2602\307\214p\245\263b\2622\326\260\036|\321\312U\341\023\")gsR\246\276\336\350\031$q\362\177\033\214\227\177\001\035\275\037\0226\243D\250\273r2\265("
+	.string	"\322\374_\352\332O\332/\323\353\371P:\245\356\346\210Ym\241\366]\316\016\270n[(Pt\367!\327Y\366q\377\037\376#\3763\002\b"
+	.ascii	"3\003\316\231\021\340\313]\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.41.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\265\n"
+	.string	"f\324JB \347(\035\220\305\021\264o"
+	.string	"\300\024"
+	.string	"\007\t\016\256\317\311N\210\353\001D\303\256\260\001\373aU\274\250i\274?:>\201\030[\356\221\333\020\200,@)\265\"\n\3421\f\0069\213\2418\177\260#\331)\0056"
+	.string	"6"
+	.string	"8"
+	.string	"o\231x\333M\0250\260KRxbs\352\321NpR\265\207\305R\002\320v\327\333`>~\216\376]O8\241N>\0214v\327\363\204j\271\267\333\216\260\335\261/\021,\265\006\213\200\036\230\261}\377\365rt"
+	.string	"\356\230\261v\267;\265Gvw\372\316\3666\355\323\274f<Iz`X\224\227\n\006y\007\356t\363\006\356\324s\332\025\026c\365\004\250,\306z\310\275\364\310a\341\202jw/|\001%\"?\346\324'q\247/?eVZ\251\326\2544k6i\232\333\213\375\203\335\\\354\223\377\244\343\212&\313P\260\033\340'~\033\n\340\347\001\022q\200U\254\240\316\037\316\367\341\021C*\211\027\2025\f}\241\027\002\361\200\274\017\030z\034\bW\221\017\364\304ZA\257#Kw\275S[1XP\332L\376\200\277t\017"
+	.ascii	"\2473\241L\2130\334GX\023\023\260\243&\t\2510t\r\237\320\304"
+	.ascii	"\0034\032*\334\006s\277T<p\347\026\355|\002"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.42.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\235\t"
+	.string	"\206RC< \005)\035`\305\330q\004\034T\017A\260\320&\272ui"
+	.string	"\034\326X\253$J(\232\353Wl\267\254V\202@\256\321\310$\240P\360\270\255\t\367\032\202 \240\317bHZe3\262S\n0"
+	.string	"0"
+	.string	"1"
+	.string	"W\330>=O\330>-\3325\257\253\275K"
+	.string	"\220\230\316\356R\355\344\342\245\350\377\365\001T\352\343R@bw-Q\251\221[\273m\006\333\020\366\r\0023\0219\273\"3"
+	.string	"+3aT|\226\217\244WW\300X\273\313}\332$\233\373<g\373\322~\353+\342]\245\037\354\252hd\273\325\301\r\236O\327\254\217\266\217\336xlT\260\332\335\007\037\346\321\341\243|\372\245\355\363\343eJH\253\244\205c\2223\273\236\244fb?`w\327\232\312\276\353\227\023\201$_\027v\024\004\016}:\013P\210\341qP\360\363@Q\007R\321\005(\203\206>\220~\026\354it\037\r=\357\243\\5\375\365\211\224l\307\306\244\235\374\226\1774\370\227y\023\023\r"
+	.string	"s\311\"\3236\030\351#"
+	.ascii	"\211\t\330Q\223\204T\030\326e\036S\241\001\025\255Y]\001\327"
+	.ascii	"\362B\230d"
+	.text
+	.section	.gnu.lto_voltageMeterRead.44.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`+\001\325\r"
+	.string	"6\332^E"
+	.string	"\223\223\016S-;&e\223\315Mi\351\333y'\342\254Y\241\351*\366;\343\004r!\305\317\330\266\336\276\366\243\bVu+\371T!\0304\350\256\252j\360\252\277\247S!\245R\262\205f2N\"\331{\357\224\002K"
+	.string	"E"
+	.string	"L"
+	.string	"\233\235\3435f\337\302\343`\343cwi\204\371\366)#\334|\323\013\004\021\245N\034\313\347\277\213\240L\251\023\347ri\271<J\005\035*\304"
+	.string	"\256E\216\340\230\300q\323a\007N\004a\310\203\3355\034q \356\352\266#\330n`\237\013:{3g\310\330\276o\363/\345,l"
+	.string	"\306F\347\355\356\365i\247\330\327\347/\333\260\276f{I\345\"\273/:\324\372t\265\016\355{\237\331N\263b"
+	.string	"\273%h\304\330\255\f\274\300\372D\360\221\352S\236@\365\351\325\347\277\303\024\036\274\316\343\021\202;PF\017\034\022\262\2021\332\0304\300\217,#\313U\214\272\233\030I\016\360\225\352\361%\231\232\035\251\033-\020\210]E0\222\354\313\335]\307\027\373\245?\236\346\277\225 \247\023qb&\326\250\373a'\032\006\302<S\302\t\264\t\t6\241\004T!\313@?Z\366A\301>\024\345\244\304CM\264\017%9\340\314\002\246QP\226i\364\252\241\233\016aD\375\221\023\212\242\031I/\376\317\024\016c\352@\255xV\375\263\347.2\0011\273\353\300?m\270\340\243P\t\030"
+	.string	"2\003\302p\323\204\365\t\250\364;\236\306\342GM\202T\034\313\306"
+	.ascii	"h\260PR\213\272\030g\257\271\314Fh`1\334\013\354oj\n\334\013"
+	.ascii	"\246\246\214\273\031\314\244y)\215A\355\001"
+	.text
+	.section	.gnu.lto__reset_template_126.0.45.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.54.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\324\001]\020"
+	.string	"f\235hG\360\262&\035\242\203*r\r\313\b\027\316R\302\251\031\325\327\376\244\336\235aX"
+	.string	"\330\022[\313\356\3417D\336zDSQ\363M\352\210\362\216\320\246\204A\315\200\225\377\210\266\"\257\325x<wh\033H\325\026\311&r\247\024Q"
+	.string	"S"
+	.string	"T"
+	.string	"\255\031\317\256\270\340\323\nB\237\026/`\373\f=\300\366i\377\205m\325\213C\333\307\305\025\373\235\032\020\257!\273\333}\252\314\303\253\324B\037v\223\"->1\230\017\327\217/\001\302\361\211\301\214\270,\2716\022aw\035\"q\317\333\206`\273\201-)\004\037U\256\343\0033\326\211\335U\261\277\363\230\315y\345:& \363\303\252\331]nE\3720T>\314\234\355\347\250\376b\221\023vU\"\301\247\025\3471\302\277X,\332U\321\303 \364i@\343,\345E\325oR\003\304\025\361b)\355\333\334\025\376&u"
+	.ascii	"\273\001\237\332\303\005\310G\223n\303\023\321\314"
+	.string	"\034|\264O\3432\024\022\032!\017x^\243\344\317|~\314`\222w\3716\016\333\347\365\343\245\f\023<X6\256\225\f\222\032c\325\256\255\266\354MZ/\376r\223\376\b\202\031\tk7D\320lSL\031\213\347\374\366\375\031\001\030J\022\364P\236i\232t\342\241\214P\032\276\016\335\t\374N)\336\251K)\215L\035\t<u'\005\374m\360\300\016\365}`\307][m\331\260K@!\022\371\261\322\026\253j\214m\255\360\035\032\304\302ux\"\031P\213\034=\252\"\031\220\013\227/\034\207g\362\343\337\3600\362gR[- \220\002\231\033\225\007\344$\206\233\004A\334\220\002\030S0\312'F3\006\243\023\353m\030`\307\214:\343s\343\025\206P\332\007b\314\221\201lm\237\265\222\247#\354\030t\223(\302\307\024t\356f\027\023\264\267\312\213L\211\327\360\037H=\206h\206&\fi\274\364$-\3546S\026\032"
+	.ascii	"\264w\364$-=\301\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\007\001\315\007"
+	.string	"\264\n\003\002"
+	.string	""
+	.string	""
+	.string	"\002!\177\021\201\200\200\200\002\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\005-\022\200\204\001"
+	.string	""
+	.string	"\003\0026\177\023\200\200\200\200\004\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\033\013\201"
+	.string	"\002\032\177\024\272\200\002\034\177\025$\177\026%\177\027&\177\030\0051\031\002'\177\032(\177\033)\177\034*\177\035,\177\036\005+\037\005  \205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\035!\036\"\031#\030$\027%\0010\177&\377\037"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001/\177'.\177(\003\b$\003\b\027\304\001\003\b\344\001\003\016\002\340\236\212\256\001\001B"
+	.string	"\037"
+	.string	"z\233\311\333\016R\2632\f\352\341\003\206\376\013\331\226`\270\374\300h 7\220\033Kn\004\315x`\r\016\320\016|\016|n\347\347\264~^\030k"
+	.ascii	"zL\365\0072p\0079;_\340\365\310\021.\fN3*|DQh\203\211\007"
+	.text
+	.section	.gnu.lto_.refs.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375 E)\002"
+	.string	"A"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\002\002"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\001\005\002\003\002"
+	.string	"\002\006\001\003\001"
+	.string	"\001\003\002"
+	.string	"\002\007"
+	.string	"\003\001"
+	.string	""
+	.string	"\003\003"
+	.string	"\003\b\002\003\001"
+	.string	""
+	.string	"\t\002"
+	.string	"\002\003\007"
+	.string	"\003\020\002\021\002\022\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.fd3483459144d713,"e",@progbits
+	.string	"(\265/\375`\251\"\235\233"
+	.string	":\371"
+	.string	"7R0PJJ\007\376\276\252\333\031\263\221\251\2639\031\261\271'\020E.DD\244\251\231\27192!M\315\335\315\334%}\336\345\261L\303\276cO\017\311\344k\025\f\314\321\224\001T\005\245\216\317#\217]\226\373\207\352\006b\373\310\272B\210\b\265\321\032\331[\246\333\002h\003~\003gH\360\257\017|\271;\205?\265n0\020^\007\001\233M\267i\351\207\306\353y\363\344\215\336\035~\177"
+	.string	"v_\177"
+	.ascii	"\336~\301 \232C\232\017?P\034Q@\356\354z\252@\031qZuz\237d\\"
+	.ascii	"uY\365v\f\237i4M\327\322\256k1\3571M\3466L\217\371\374rv~\251"
+	.ascii	"k8hfV\240f\243\013\357\001\t\272\256\343z\316'\t\315R\017\254"
+	.ascii	"\331\350\302\313\031*4b\304\210Ke\005\355\211\325\236\263"
+	.string	"]\246\315\274\347Z\216G\t\3559\265\021\360\351F\340\207\206\244)\f\013\337\342\300\016t\020\020hc\340\367\033\374N\203\377\256\341!\260r\313\230\227U\377~s\273\313\031N\350\206\256\252\242\305\305\252mB9I\370\320\246l\370\020\220\365\230O\023PV:\255=s\206~\351\265\006\323\322f\353\2627\2266SvX\2635\225\036\273\3203\034#\214m\2323\224\210\255\317Z\315G\t\3155t\256\300@\355\341\t\215\030\221##\016M\f\253iB%\304I\241\262\352{\t~\203q\271\231ON\316iQ\236\020\374D\177gi\260Fk-7\3630C\316i;~\232\274\310h\202\227s~wii\243\365\226\253\320\234\257\344\234G\214\020\312y\362\203\353\t\250\276\227\3700\340\273\300j\021\377\255\203\200<(\340w\200\273J[ii\210\026{G;\354\277&h\206\346\f\375\261F\370\244aV\375\005\370\377\225\027"
+	.ascii	"\226%x\007\374\016\001\274}}\035\002x\034l\233\003\020\250\203"
+	.ascii	"\200 :\b\370\367\224\277\241\264WC\357r\2063_\311K\350\206Vf"
+	.ascii	"\221\201Y\265\245\364\327\033\332Q\376\200\004\277I\260\354\225"
+	.ascii	"snh\004\316\234\233\032\372\263\227s\323O7\002\335\b\250]WYb"
+	.ascii	"@\365\026\037\332A@\334\034\200+8\374\326\304\337\023\374}\342"
+	.ascii	"\357\022\376\253\277E\022\264\377\316o\277\216\363\337\234\347"
+	.ascii	"\374\367\247\367\376m\233\277\273\374\335\367\346\3575\276\277"
+	.ascii	"C\374\375\264\3677\235\336\377\020<\274\303o\353\026\370\317"
+	.ascii	"o\315\374\377\362\237\315\355:\277\255\341o7\177\347\005\371"
+	.ascii	"\233\311\337N\376\336\372[\353\357\347\337K\376n\362\367\023"
+	.ascii	"\036\177#\371;I\233\3772u\212\223\200\177K\367\377\214\335\201"
+	.ascii	"\277-\373\033\313\337l\376^\363\267\335\337\277\377\372\370\033"
+	.ascii	"\315\337l\177{\371\333\354o*\177\203\375\375\365w\224\277\273"
+	.ascii	"\376\226\361\267\321\337\312\277\233\376"
+	.string	"\216\341\357\027\376~\3617\013\1773\375\275\364\267\322\337,\376^\361\267\t\177\217\360\267\007\377\305\376O\377\267\375O\373\233\203\2775\370;\203\277/\370\217\367w\005\177\017\375\277\373o\367\377\355\277\333\177\350\177\006\376\257\375\007\352\353\353\353\373/\322\017\354\362w0\nn8\231sK\275\240\366\360\254\027\267#f\332n\335,Z\020#6\254j\301\3300\254\345F\r0lW\206\222,\226\315\256\211\365\230\202\233\252Z\\\254\310\276\264\030\2404\215\336\0251|\374\244-\227\333-\026\315v\301\371y\002\334\233if\336 \001\205\302\241\307g\325\343\036\370x\211o\307,Y\231\325\322M\013\302\364\246\271\331\024\241cE\326\266\225\345V\313\321\360d\017;o\322\\\275Y\365k\354\231\252\325&\310\2153\263\036B\276\346\240\374\224\204u\341\262\252\324b\261Lz\274\314\300\245J\034~\333\037\230\233\2309\347\032?hf:\361"
+	.string	"\373\327-\342\357\351\333\t\344\373\377"
+	.string	"\243\234\223|\\j0\023\263\246\035\007\221\377\267\234\225VI\f\254\246\224VT\313\250UN*\223$70\263Ur\031\315yCV*\223)\234y\3032\232\2472\2140S\235\241V\311\254t\346\rY\231\233@,\225VS\313h\323\324\206e\324j*G\2552PV61gPf\346\206\034\265\262\313Q\347\024\3202\352\234ZF\255|4\215\345\033)S{\\Wx\375c\251\3144\242\252\232\230@oK\2503\313\345\334W\23623\201\234\253\234L\271&\252>sz\243\341D\326\344lh\316\271C\224\323\2253+\337\226Z\316\234\265\234Z\344\250\b\222\320\267L\244\337\222@\252\362\214\247\234\t\210\3129\331\371-\347\234\3149\3430\253\2409\353"
+	.string	"Z>\243\242rn\nE\345\252d\226\247\234\355\225\271\263\251e\364\312I\224\245J\364\231c@\223\375\314rVL\034MN\3113\322\340\347\224\215;\253JU79\250\252,\261\"\265V,\025!hN\3728\315A\355\341ef\223D\216\025\267\032[UU\250\350t\371"
+	.ascii	"\323\212\266\233u\016\220sE\210Z\323\252DD\267Q\016@f\023\372"
+	.ascii	"\323_zS\274Xu\212\005\273Gj\324\305\260\352q\240\246H\261_\266"
+	.ascii	"\256\214\313\026\236\224(^IG\334\332X\025\n\017W\224.rV=\320"
+	.ascii	"\r_\002%I\236K\220X'\266\313>i\251\345\262Ln\265l\2237\227\335"
+	.ascii	"\272\312\262\3215\214&\371\201\325\003\305\260P\007\001"
+	.string	"/P\t>\020\013\037\230\343i\261\3242j\\[\254\332\004\363$\302\3416%\232\2627\230\266\311\251\307\372m\b\006^|S7{N\031egul\360\324\254\351<\237$Pv\202\203zv_\356<\"K\304\032\261Wv\210\365a\217X \226\207\375a\255l\021\033\304\"\261Bl\022\333\303fYgK-\226\325q\273\303V\021Y\032*\350\222\233Z,\013e\231S>eP\253\204\321y>7\347\036zO\276~\323yI\273\b\2240\311\314\320s\375\326\314\267.\327\261\341\2621\226=\007\314bB\220\003j\226\234\202Y,K\2053\366V\307\006\257\275,\226}\352<\234,g\035\233\021B#0\034\r'M\026P\255\263\203\200\n\374\314\340\377\322\360\177T\360\177I\360\1777\360\177O5\254\215\2367\2522bv5\332\254TG\251\t\262e\325\253Rlg\330\250\226Z\032W\301\2349\2323\264\3476\341"
+	.ascii	"c&\002\370\323\"\200W\267\360U!\370j\023_u\302'\310\340_/\370"
+	.ascii	"W\302\360\003B8G\201\3631\355\331\022%L\336\332/\333\315\324"
+	.ascii	"\037r9\260\254z\277\334\354X\246\310\031\221\302\317\362,\327"
+	.ascii	"K\203e\251\016\033\"\203M\304\016V\025\031\032]~\275\374p\275"
+	.ascii	"\031\243\301\252W\313E\263\361\003\317\f\215\313U\202\204\006"
+	.ascii	"U\332\032(h\234\356\226\336BG\243n\317\254\t\226'=I+-\275V\256"
+	.ascii	"\331o\251\246\265M}\336\306\354\300\303\202s\344\215\024\225"
+	.ascii	"%\033\203\3564\227eR\254\372[\366\337+Wz\311xF\330\345H\273d"
+	.ascii	"w\f\312\r!G~r\262\3505\211\022\375\212\335\263.O{Vm!\2362\370"
+	.ascii	"7\254/\025*\006\314A\355q\365(\243P\271Q\273\320\276``7\006\\"
+	.ascii	"\0176\022X\215\226\221\035Rp\367\215\001\374\357\327W\020 \233"
+	.ascii	";(\017\017\257\226^\257\033\245\201r\276\";\353\341\362\243\315"
+	.ascii	"\225(^*\344<\200N\364\306\234\0167w\306o\216\226\336\031\267"
+	.ascii	"\353.\233\371\006\t\270<\3136\335\312\262\352\023\234\24682j"
+	.ascii	"t\370\355Uu{\234\361afzu\203l\271M\211\234\227\207\327"
+	.string	"\334t\311\305\272Y\375\326\004\312J,x\323\260\273\344Zi]\256\353\3446\271J.\223\273\325\322\273\344\n\371\325qw\\\b\354.\271?\312\374\250\201b\205\nH\255:\235\007\247e\007R\320$\271\317\226\336\254\013\335\254;\344\"\351\267&4\327\330)\263\223r\327aD\317\235\030\271\035@$G|\310\240Xi\254z\215\3404\251\326`\224\021i\351-\262\206+\213\336\351v\274\024\271\022\303\337\211\342\3578\271@\360\230)\2176%\370;H\360w\204\340\357\374\300\337\311\201\277s\003\377\267\307\345\361\213~Q\323vyt\236\205\0033\303\211\211\255\210\346"
+	.ascii	"\2744\\\252\333\374s~\272\316\204\214-\361/\216\020\212\270\215"
+	.ascii	"YU\355\243\001\257\215\337\033\177\216]\313zFY\365;N\370w\352"
+	.ascii	"\326\370s|\344\222H\247\350\341_\346X\237\232\034V\275R\370I"
+	.ascii	"\207.\204\016\017,>vX\365W\352\2774\272\257\241*\344\254t"
+	.string	"\241\217\257\215U{\232\003\260\261\020\375F\355\264u\231~\225\341\337e_\031\322+\343.\273\214\217*\022\277\275\034u\\[\370.\255\216V\b\233\246\t\017(7\006N\f0z4X\025\312#%e\304y\237\362T\310\331\353\007-\337\255Y\365*\2572\307\361A\355qm\021\022\346\211U\257\323\354\353\273MlO\254fG\225\263\233\374m\262\252\001\232\255zs\347\361\360\241yB\373\370\370\342\244\317\236\261\031\250\224\221\323\323\263\323\266\362DG\313S\315\f\227\274\267\324\346Y\261\016\234\331\006\b%oM\022\035\236\250\206|\265i3\206\357\371\233Q\247\007\303\310\335\235]3\206\016j\217+\347\n\rD\316\250\271]\203\213\300\205\tbU\233\306B;\355k\bY\016\025\256\253\263S\234\251@\201\332\303\003\356\341\210\272\373\232\333\351/\214V\222\234\214\345\344,\035\316>Wg\252D\340\304\345\250\323*sKg\317"
+	.ascii	"\321\302\253r\306\f\217\025\0307\224mvN\313\221.s]\246#\367D"
+	.ascii	"\223\244\363~Wl\316\230\321\211\271\030K\24633\347f\276pH\240"
+	.ascii	"\366\270~t\244\275=\307\334\222\301"
+	.string	"ki\366-\315\206\001\346\334P\247\02437\231\"l\230\0361\272\2555jW\263\001oQ\"\211(4\"\217C+\022\323\360\210(\0342\036\231\206\004\030\016\231\210\304\"\021\007i\004d\241hl\201,\022qX\004\327\241\212\\\217J\253\022\220(\fr\320s\\\225\202!\034\221<@Z\221\306\342\322\022\323\221\200\027K\305\"\020/\202F#\212\004\220oQ\"ii(i\211\303\021\221i\207\310\302\376\216F<H#b\322\322\217\230\264t[ \223\210\353\020\270\272 <\252\307\343jDB\n\342\274X*\036\251F\344\322EZ\211I\302a\020\007i=2\251G\353\021\347F\243\244\245\022=/\214\310\2430i\035\301\350\200\245 \b)<(\"\213R\240\320i\244\225(\\\241T,B\n\026`,\"\213  \005\205Th\240B\003%\025\001 \205D\017\220\202\034Z\034W#\213u\204\242\024(L@\256I"
+	.string	"8P\002i\f.\225@\n\256#\f\300\301\201\022&\036 \032.)\255H#\244Q\220\021q\003\344z\\GHZ\002\361#\241q%\256I\370\021\230h\300\304\211\026p~\202\002\007(p"
+	.string	"\370\023\024\020\021Q`\202\b\337\004\321E\036\203V#$\017\200V#\244q\025\016\227\204\310!\223R"
+	.string	"E)P\250\020Z\207\301\243c\3160\350\302\205\020\351\270\032\337\242\304\321(I\310\202Xl!H\024*\001\300\202"
+	.string	"H\342z\\\215K\310\"\261\303\221\213a\317j\004\300j\024\300zdd*\252@\022W\243\221\351\b\200\027H\341Qp)\270\342\007\031\314\300\204\365\310\324sD\032\327!\212\242\365\310\024"
+	.ascii	"q=2\256\",)1\035\211\305#\017G\341\361\370\242\205\317p\270\036"
+	.ascii	"\r\207L,8 \211L\305\242\341p-za\\\221\310`\006\353\221\261\310"
+	.ascii	"\"\310E\017RQh\\E`\261\364\0012\270B\330\223D\024\022\215\301"
+	.ascii	"\023\004@\032\235\300\031\006\217\204H\241\261\310X\334\200X"
+	.ascii	"\024\"\203F\246\024\310\340\n\027\003 \215|\336bX,f`\364c\301"
+	.ascii	"\242\210d*2\201\205\342\020\350h\344\203\231t\220\377\200|\213"
+	.ascii	"\022C\304\242\222R\361\250\200\027\227V\343\020\262X4\016\355"
+	.ascii	"\254\320G#\"\344\322\316\361\007<\032\255\310 REQ\n\024\306\025"
+	.ascii	"\271\202 \300\006?H"
+	.string	"#\023DH\242\220\t\237\210\250\bD\t!p\200\217J\f\035\215\305#q=\016\021\205A\245\241#\343q\250\204\007\244\325\270\"\207B\026\304\022\326\244 rXt\261\301\030lq\244&\303\304\345\271\231b\325V\333\311\342\322\274\353\363\242\206I\2437\346\315e\303a\322\304\325w\371\304\240\270)\362d\367\320\274}\365\021\321\263]\362\017\206\327\235\234\233\017)\3305\267\362\242\250h\210L\211\301\323\222T\3234\327\206\315N\\\0256\251U\177\331\374W\315]\323P\036,`\250\b\261\252\210\016\002\376\262\020\375\246Q\201\260\221Zrg\247\343G\020\031V\375\265\213b\031RdjU\253E\364;\255\300\b\220.\253\266\375\206i\273h.\031\236\234\004\313R8fjh\230xy\331\024\2613\005jJ\re~\321\374\322= \301\351\270\266\3104Y\365\236\3715\323\004\243e:w\315\3749:L\202D\235p\3417"
+	.string	"\206cj\312\252W\356t\327\242\233ag\325\033w4\236f\034\036\326%\323v\005\347d\325\013w\305\264\364kw\314}\264\304\220\256)\301\227\241\277\006\274o\2775\37499Zz\004\261\"\342\366\347\340\210\221\331\361\004\202\337\303CM\355\262\005\202\277\250R\351,\211\002\031B\006\321\310\310\214$I:2\n\020\006\243a \251i\017\022"
+	.string	"\025-\3202\307\320\314\310H\222\244\264\354\031M\004,`\252)\210t\027;"
+	.string	"\325\350\330\017\200K\n\325\310dPi;H\372Z&\351H\356\314@\016\346F\013\267I\272\264\2764\3012\240\246\355)\377=\240\364\227\233\261q\204\034G\247\252\231\244r?\244\037\254i(c$\352\241\034BC{2\331u\337y\232\222\020\305@\001\212"
+	.ascii	"\257P\275\rr\341.2\222\340\331\272k\007pe\207\210b\006\237d\345"
+	.ascii	"\314\243eH\022\301\216\211+\n;\2765\321\004\325I\t\363b\033\207"
+	.ascii	"\247\263\344\352Sw\035\351F+\032\262\363\274\244\311\005\250"
+	.ascii	"\373Y\350\215\326\346\002\265F\301M\332\312+\021h\005a\032\324"
+	.ascii	"\f\317\332\215\324\216\342\006\251ek+b\034\202\036\317\257g\313"
+	.ascii	"\315~\006\203\036B\340\300\330m\030\213\030 \337/@\025\216`\314"
+	.ascii	">\264O=\234\023\252\334\353\005\363`\340\017s@\227\223$\262\225"
+	.ascii	"\020\025\314+\001\004\374W\225\241\204V\237\234+\356\260!\035"
+	.ascii	"\355\323\"/m\313DA\200\350\235\305\3332%\255\340W\317\306&\223"
+	.ascii	"%\303\2636\362\3407nH\267\265K\247\261<\221,FO\262c\327\345\362"
+	.ascii	"\003\223\332\004\311u\221\307\267v\243\207\r\002\244G\207\007"
+	.ascii	"\206\302\213+v\177\274,\263}i\333Sy\213\251\354r\315k>\305\260"
+	.ascii	"\271\254\222l\b\2206!\255J\270kd,H\335\006\220\0320\254>9\271"
+	.ascii	"?+\001wlg\"\326B\350=\036\214\316\304\r\367xk]\243\301\2745\237"
+	.ascii	"\243d\216\270\323=a\264\272<\033\002u\2470\013\020@\3471\312"
+	.ascii	"\007\t\016\021v$\235|\362"
+	.string	"O)\331w26??\376l'J-n\354\373QnB1'i!\027P5'\371w\024r\361R\352Yk\036\037\034T\035\262\373\022\201\025\007\354_\370Q\033\027\200\024\350d\366\230\361\006i\203\376nX\205\362\017q"
+	.string	"9\322-\260\375\007\331\327\200\372j3\334\334\262W\227\t\342\373f\221\314\027\216c\0039\240\235\327\234\323`\246A\244\307&_\322G\301T\375V\236\230\202\237Q\246\201\"+t\361'f4\373\331\356\247\275\004c\354\354~\203\237c\262\210\251S\251\264\026m\017\023mW\022C\207o\253tf\361\267X\323\205`\220\3344*+\322\255\261\310\245y\311\276s\277\263B\017\272\305\252-j"
+	.string	"-\017\334As\006\027"
+	.string	"\220\250G\343>LJ1\037\026\354W\006\216\364\302\270?@\030\300\346\342\024\021\213\272ss\202\331\254\226\207\030\204\225<\313\264e\305\212\243\247\267F\360S\265\333H\370`q\313\331'R\252\177j=4fP/\337z\2501\2031\371\262\026\312\376\233C\177\205\334o0nH\261\327\306\274\003\277]\256\376\003\342\241\372\232\023\236Ug\242)\360\225\274\340\322\304R5\305-\272-ke\225\225\323\373i:'\333\226\364\225\3373\211]\002\264\353\357\352`\023x\260B\021\232\202"
+	.string	"%\363r}NGy\367\304^\"\252\304\226\314\226\272\315"
+	.string	"\355\325\033;S?\364GD\371\316K\200\246e\335\211\3370\240\314]\3715\025O\305}P"
+	.string	"6\355\352\025~\202\247Fa\254\\+r\202\361$4\217+q\020\2118B\303U\274\320\271*\030\360\262\373\031>2\024\250\007Z>\376\037f\017\210\333\314x\211\n\255\334\276\203j|\262\362\013\276C\357X\200\346~\177\201S\226\252\317G\247\302\204Y]\222\303\332-\267{\016\245]\322\256\021\374N6N*\2048Zkq%)X\033MH\241\034\035\343\224`\322\200\021.%\346b\266\342R\205\224\302a\272\260\314\333\2450\232\032Z\321\241\rCA`\340\357Q@;\343\300\202\346\2021\270\347c\026\320a\340\375\207\227\252~\336\335\266\335\354\316N..\321\231\373\207\005.&M\244\b\265mT\330\231A\222&\312\0075\235\013\355\025\326\f\335\366\001x1\006y\354\341\307\004\250'\211\317\210\371\032:\217x\021\273=\t\351Ud\227\232%\262\n\337\263D;\337\343\342!"
+	.string	"\245\023\2554\224\245\336L\350\005\005\276\b\211\221\310\3113\314\204\031\212E\267\307\3335,\004\332\202[RPV\266\022\232\032\327j\230\005P\203\031\037\356\300\250B\225\342\204Y%\230\221<\200\237\366\037\266\235\322\002\345\220.41\341=h\024&\272\244\237*H1\346HX\222\311\021\235_m,U\266\351t\304\256^p\245UD\273B\252\035fy\207\251x\345c\034\035\361\031\363\322\301\214\252\225/g\250\002\344\003\346\307\340\003\211\344\210\305\016[\240\316;`\0342\251\f\306\b\001D\271\212\022\323iD\323\200\004\335\260\003\247\225\336\b\t\3025\362\222\305`\305b\351\240\341\253\214\221\302\326XF\210\262{\0325\363\204H\365\nG\233\356\224\314k\376\2678\327\337\243|\264^\222@\237r\365\316|m\336YDj}\217\252\233%\332wJl\305\342\267\002\236H\356\302\237C\016\001e"
+	.ascii	"\374\276\033N\331\346\321.xX-\237M\366\334\302_\304e\371\033"
+	.ascii	"\323\204\3173\f\007\211\373X\217\315\007\347\2019 \377\244b6"
+	.ascii	"\374\334\367\370\334O\261-\230\360\217\227<\"q\306\2741\034\025"
+	.ascii	"^\334\237LfV2FYY\260\234*o,\234\343)\343:\336H|\316Z\353\276"
+	.ascii	"\301\235\333\323\256x\027\351\255"
+	.text
+	.section	.gnu.lto_.symtab.fd3483459144d713,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"voltageSensorADCConfig_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"voltageMeterSourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"pt1FilterGain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fd3483459144d713,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2559 @@
+	.file	"target.c"
+	.section	.gnu.lto_.profile.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\341\002\205\022"
+	.string	"D\033\325\003"
+	.string	"L"
+	.string	"\226\342\223\316\016"
+	.string	"\001\327\346\357\377\002"
+	.string	"\002\336\327\276\377\017\002\002"
+	.string	"\002\001\003\206\242\247\246\013\004\337\313\242\204\n\005\202\321\322\374\007\004\002\003\006\240\342\234\212\n\007\b\232\246\323\206\017\t\n\226\234\261\244\006"
+	.string	"\013\242\302\263\302\013\f\256\234\262\364\013"
+	.string	"\r\016\017\374\355\374\304\013\020\002\002\002\003\002\004\002\005\020\021\222\221\202%\b\002"
+	.string	"\002\006\002\007\002\001\022\023\342\246\207\300\013\022\002\b\t\002\t\024\352\263\360\321\b\027\310\373\201\350\r\002\030\234\362\341N"
+	.string	"\031\032\251\306\315\231\b"
+	.string	"\033\360\324\237\235\007\002\002\n\002\n\034\035\036\037 !\247\333\250\364"
+	.string	"\"\324\240\313\347\002\006\002\013#\351\241\340($\301\325\215\205\016"
+	.string	"%\274\205\242\255\006"
+	.string	"&\225\221\315\200\006"
+	.string	"'\210\377\206\247\006"
+	.string	"(\271\303\275\241\r\n\002\f\002\r\r\002\r)\230\336\335\312\001*\272\302\257\305\007@\002\016\002\017\002\016\002\016\017\002\020\002\020\021\002\021+,/0\315\343\301\244\01312\263\330\307\3133\261\213\233\205\b\n\013\002\013456\264\251\257\307\f789\367\267\311\301\004"
+	.string	":;\222\321\201\352\t\b\t\002\t<\211\307\340\277\f\002=\314\345\244\232\005"
+	.string	">\362\357\204\233\017"
+	.string	"?\202\220\306\317\004\020@\333\217\352\217\004\006AB\313\322\375\213\007"
+	.string	"C\310\342\324\f\003DE\303\272\266\211\013\002F\317\253\250\341\002"
+	.string	"G\351\361\317\236\016\004H\227\227\247\303\tI\211\363\232\360\007\002\002\022\002\022J\260\355\347\231\f\004\002\023K\324\226\242\363\f"
+	.string	"L\202\275\352\302\f"
+	.string	"MNP\240\342\234\212\n"
+	.string	"G\250\3014\244\210b\214M\022\251\202\226\003p\202R6\266\r\021"
+	.ascii	"YF\306$\220JS\234\264\006\261\364\305\230\212\206j\345dSqH\254"
+	.ascii	"Y\307P\344t\023\335$|\364\343,\344\342\376*G\037\244\324\rlU"
+	.ascii	"\214\fw-u\266t\037\016\215\221\036*\304,\306)\306\203\375\333"
+	.ascii	"z\322\322L\007|\3223\330\303]N/U\016 \3764\277\323\312\325\020"
+	.ascii	"\334\026e9.q\"\343\232\\\362Hso\354\207z\364_\201\325\205\374"
+	.ascii	"~\263Y\267\351\f\273$Zv\3000\313)&[\037\367\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`%\001}\007"
+	.ascii	"\262H\031\026\240DK:o\316\315\214\344\207YA\003\230\353+\002"
+	.ascii	"4\"\267L\001\017p\001\316\362\006t\200\025UM]\031\352\324M\024"
+	.ascii	"l\230\245\262gk\327)\216\355\353\022w%\215D$C\023\364\361t\276"
+	.ascii	"s6,\203\341\375\302\263\220\254p\312D\302\310\220\207\343\356"
+	.ascii	"\214\305D\364P\270x-\002\0374Z\235\361c\271\346k\004? P\002\221"
+	.ascii	"\256\330\001\f\031p\206h\006p\"$AM\244\270|\b\r!|\353\3416tR"
+	.ascii	"\370J0\221\002n\300\206mI\305\003\334\266\226d\004\f\226[R\335"
+	.ascii	"\254\325\220\277\241+\273\367\002[\377\272\332E\0378\0243p\001"
+	.ascii	"\n\027V4\204\bV\3445\271\345nYR\366\027\347\026\024hp\230\266"
+	.ascii	"\033bV\201\007\2725\212\022\367\300F\024\231\013\342\206\261"
+	.ascii	"\360:\f\005c\b\".IZblL,F\f6\302(\356\020"
+	.text
+	.section	.gnu.lto_.inline.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\344\n\305\037"
+	.string	"Fc~I\260\326M:\225_ -\016\b\262\373\211\345\232Q\215b5\277n\243\322\347\221\354\240\006@\231\341\253G\316\213\021\275;\245\027\277\2415\263\013\177J\017\021<\315\r\256'\370\371g<4\212\023\027h%k&C\"F\332\336R\246^"
+	.string	"i"
+	.string	"l"
+	.string	"\274\266Y\264\333a\241<%\234\307\2314\374\317\033\013Y\362\361$\3462XmNu7\200\207\013.\270\377\262m\332 \312)\361rx\211(\227Dv\360\365\321e\334?\032'u78\253\361\353.\372\237\377\345\227\245\277\341\363\231d\357\337\351\356\362\237\377]x\277\237\344\354\356\246?\203\243"
+	.string	"\t\037k# \347\017\034\327\335\256\033(\260CN\234\351\323\335\262\317\374,\363\366\204\367\337\230\352\tI\b\034\301W=<\255r\002?\357\356\315\334\255h!\364\002\311P\n\025\034UHB\327]"
+	.string	"L\322\314\306\365\345c\035+?\346\372X\177\231\367\261\216u\254\\z\177\215k\023\351\231\033\017\331Z\302t\036_9]\025\273\035\226\030gQ<\207\247q\354\337w\246\247g\233\245\201!\263\360.\277f\276\205w\251\313/l\316\324\345\252\250\302[\250\360\261\342(\354\027FOMxMtAP\261"
+	.string	"(\256\210~R\304\t\022\036\001\202Qw\257\374\201\203\375Xi\254\244\313\002Z\371q\270\006\320\226\223\2051\177\312\035Z\317\022\027\3048uw\213\250`_\033`c\021i\022\004\017\361\203\030+9i(1E}7<\004\224\003\351\233a\365\304\244\345\037n\263vY\304:|\303\250\374\021at\330\210Q\211\013\357a\277KG,z\204UE\216\\\314\336!gU\"\306\307\017\372\301\343\003;\207\rt\251\315\224Q\036\321\342\177'\231\322\025\341\315\230\004O\250(\035A^\327@?\272\223\306I\0310\260SO\223\024\310S=MR\337k\032\310\310\004\200\346\250q\301R$R\232$\0316\003`\002\031!\262\252\007\022\300\023-\006\264\024BH)\"\022L\334\210\2142\323\2465<\037b\212(3\024\322\247"
+	.string	"\372\023\257\274\346\036\227Q\366\002\017\311F\333\032\222#\375\345\023w7}\220\206\024;\260\214\224\201\360d\220D\356\330\033#$\245H\220 \265\031\300\272\205le;L\005\314Z\357\330\221t\266\220T\fI\325I\260g(Z26\031y\210\377,L\267\244wE^\307w\305-"
+	.string	"@\204L\341\314\316\211\264p\037I\004\022O5et\344\303_\361\177O\204W\327\017\035\246x]@&\027m\277B\236\311\240\215\207\023\243\341\372U\337\215\351|\346\002\315)\314W\363YD\270\003xI\033\020\0068 \355\241\253\023\f\322:\270W\211\215\372\"Y\2465\260\216\237\226\206f\332\025\340\2445U*\221\2119\341-w\024\205\036.\200\266naAG\246\357p\021\221\035\215\250E(#<\355\357\243\203tl\301.HV\372\345\317n/\301\2578;\237\3439\251\361\373ViY\b\007\0038Y\303V\204\334\022J\252\016X)(h!\377 \026]W!\204b\362B&\210Q\004prL\277\\\371\200\262\215D\333\252iv\001'b\223\230\005,\253\231"
+	.string	"\306zP\232L\317\262dA\351\037[\204\006"
+	.string	"\006\234\304\200]k\003\031AB\216\251\272\330\266\311tE\r\235K\314\243<\267Wy\274\"\317\367d\226\262#I\346\001\344\007\001p"
+	.ascii	"\250\352\013\bL*\335\343\205\271\007\321\335Wy\213\024\362C\351"
+	.ascii	"\374\n\217\302\342\256\025\375\224wp\267e\f\357\346g\0317[D~"
+	.ascii	"3\306\221p\036o*\353\341c&Q\370\240\2571\242\256D\344e\325|\337"
+	.ascii	"\377n\352\023\376l\232\266\211\355Z\026\0079\275\341$3\247#\261"
+	.ascii	"\305\020\243\260i\375\221\016\362;Xp7\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`0\020E0"
+	.string	":B(\016C\220.5\007\024&I}\335\002\037\002\001\0051\020\236\001\352gd!0I\006 \365\214\272\364uod4ibdP ;\003BW\374\341l\316\343a\331\321F\026\361~!i\251\306=\335.\260h\313\224R\303"
+	.string	"\323"
+	.string	"\322"
+	.ascii	"GG\236\200\373\013\376P\352\351x>Z\273\211\242\324\323\311d\027"
+	.ascii	"\343?\245\236\376\344"
+	.string	"\243\316\244J=o|\224\273RO\026\037\3651\3769\260\324\363\301G\243\321h\355\236\263p\377zZ\377\373\337\373\f\347\315\206\373\346\264\324\263\301Gs\336R\317\003\037\335\272\021\024\031hK\243y\356\302\375\f\357\351w\267P\017\ry\257\341^f\237\372\027w/\376\3363\034<\345\272\007t\0319Y\2308\325j\200~\230qZ\367F\243\365\200\360\337\235\035\212s\207\342\336;\377\006\246}\003\343I\336%\252\227H\324\323?\017\242o\364\335\356]w\200\005\225\350s\321g!\367\017\352\336\272\237\310\027|\246\356m\241\351\203\356\002\037\335\275\241\2733`\370\343\356\307k5wq[4\036\356\342\336\263\347\332\265\205\276\251;\205\t\022r\354\251\347f\345\243[\324\367\177-T\253\325j\236\267\255>\365\334\222|t\203z\177\367\b\335/>\233\220\317\203\216\366\334y\202\240'\252\227\266\002\325\223\262\311\343[5n{"
+	.ascii	"\007\216\247\020\"\304\351\351\337!\343\201x\272\325\241\\\344"
+	.ascii	"\2707\007H=)\223 \334oq\206\324\223\376\3605\356j\234\311\323"
+	.ascii	"x\2077v\276\221\244H!R\317o\363Q\007E\352\371"
+	.string	"a>\272u\213\231\"f\212\221\031\032\262g$\365|*2\013\376\331=+\341\336{\013\303\323n\331\347%\334+=\255h\242z)7\251\347\033I\362O\301=\307yv\302\375\326m\344`\234A\205\242&9\332R\264\261Ww\345\3132]S\3048\274\356\"4\022\016\332\235\t^l5\241;\322\264\341\315\022\301\253\243\356,\3300\353e\233\354\335!\2266\351+_\237\ro\b\222Y\266\n\313\212\314\032a\310(\341BDL\212\n\326H\230\366(\322\200i\221Xv\257\200\366\274p\2746\004/\266\361Bfe\016\265\233zrG>\372*bq\352\311\371\370\350\307P\004\261\371\350\266\265\347o\327\2737\235z\006}\371(\027\204\344\243\233\3533\203\023\fL4R\030\377\026\263e\247\236[\240.a\355\266\246I\024Iu6\361]\364y\301\347\022\337\037\334\335\267(\"\250\356'\022!\232\300g'w\247N\335"
+	.string	"\346"
+	.ascii	"\230\363\r\342]M\037\\\036\272\233\251\273;\004\035\216\342\223"
+	.ascii	"\326\f\233XWV\022\350\213g5\304\253\221\204\032\305)\023\203"
+	.ascii	"3\003\335y\341-A|\273\034KJ/\333\324\240;\357\326\030Al\257H"
+	.ascii	"k\316H+{U\205\230\214\241\005\342\032$\236\272\001\226\256\356"
+	.ascii	"b1\030*l\223gC)\313\204\311+k\243\004\263\256\354\210\250\230"
+	.ascii	"\225J\262\236\347U\335\220Lq\361\214J\001\276Z\242I%\324\036"
+	.ascii	"6I\362\211|a\324\236y\313\333B(\234\r5\f\0063\305\321D\225\326"
+	.ascii	"5K\035%\325\3205\301P\346\222\221dl\024A-#+\363\002L\t\246\004"
+	.ascii	"\343\200\341B\2075\212Y\263\025#\216)k\212\243h\324]\370\202"
+	.ascii	"\301`\370\336\300\267\264S#`X\023\203fI\324\036&1\276\026_,L"
+	.ascii	"\306\220\2053\013U\324]xg6\201\027\250\321H\247\f\315\310\210"
+	.ascii	"HA\222\202d8\301\004\2040*\241\204=\022"
+	.string	"\240\201Y\f\203I\3168\345\b1\210\211\fI\222\224\221Jc\364\006\204\311\356P4}\002\017iZ/\331\200A\234,;\327\322&k\f@V\304Z\211\226/\355P =F\337\236A\245X\034\232)\360\255!d\351\r_\242\223\360\372\320o\013\210\2177\025\f\025\031D|\2655\225\231\246\205CC\264+\205\036\264]\265\276!b.\230\304\221D\257\314\035L\"\020\2270+\326@s[8\373\223q\3613 >%\270\002}\340\325\343\373\260\031\337\262\201z\311\245\263>p6ZA\316\347\243[\202\\\334r\347\260bY\324\3506\0261\276\364\351s,\3472bN\202u\017v\020\344\213\271\037\216\250M\f\307\341\330\233\200\303\017O\351\264\207av\201@\361\026,M\327\276\364\210\372\212O\026\3747\002\245\364\276\273\013\232\230\223\002\310#=\205\246\321z\262a'Sw\235\247\365\236\027\357 \225\031xx18"
+	.string	"\267Su\353|R\027\0379T)\024n\367;\320\t\236\246\342S\324\272\236k\247\245\310\363\225+\330\001\312\3443\241\236\220\361Niy\"<\302\036N\370P\210\006\032wr\241\331wD\313\234.\267:\n[\216F\024\322)\211\270TP\021\236L\224b\340\321\251a\364\314\024H\320\241k'&\302\271j\325S\217\210.~Di\210\257\212^\366\026\230Y\006Dd\331y\275\351b\"%@\250F^\325[\222\330\n]`w\233\253\227q\n4z\267:\343\003\375\241\350.\f\320"
+	.string	"\372n\340j8\316M\0018\367\\\205\007\300\375\200~\375\270\310\241uW\267!\205\312\325\037g\272@\003\327\310Q\363\355E\266l\034\265Ad)\333\302\271,\034[\331\220dPy\363#a\330\367BLm\033\313\243\032|\202s\233"
+	.ascii	"\224\370\262\\\256\203\031a\254\232\3227\242\323\247a;\024\351"
+	.ascii	"\006\241\312\2617x(\252\247\231\372\035\213d\332\230\007\375"
+	.ascii	"\370C\366\002\214\250\n\244C_\232:\255\234F=N|MjO\001\031\301"
+	.ascii	"}\003\232y@\025{%\364\004\216\354\335\352N\fy\224\350\001\b\232"
+	.ascii	"V\314\f.=?\253a\007J\305\306_W\2009\243_\214<I\026\001\216\365"
+	.ascii	"?\266BD\344?\020\376]\276\244Mt\212L\020\323\003"
+	.text
+	.section	.gnu.lto_.pureconst.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \221\315\003"
+	.string	"\022I\035#Pee8\0317\263R\304#\220\230\215\231\231\231\241Z~\205\274\005\204\263-\016U\350WJ}\002\350\330v,\213]QS\255\245X\324=\375LW\351\222~\243+Z\013\275\201\356\347z\016\350\\\316\335\\\315\315\\\314\231\345V.\205\235\020@\362\213\260\020b\017b\016n\r\226q\027\367\272\nf\211\213\270\207k\340V\270\204;\270\274_\301/\360s\027\347\\+"
+	.text
+	.section	.gnu.lto_.ipa_modref.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\320\002]\013"
+	.string	"\022\317+-`o\226\0030\f\303p\330\207 \b\202 \b\202\340\032\314\315\223\375-\343\005\3555+\250\272)\020\320\247\017\222\272\320n~\232\b\331I\246\232\224H\262y\331\345\210\310B\3241\226\203\350\366\241\325R[r\333\352\363\331\274L\036\353\340P7\326i\230\201q\261E\305\244\253\034\351I\332\215\236\243\235\350):S\262\244s\262<Wv\241gh\215JmBb\325\216zU^\304\016\361\240C\303R\036\303\202\bO\301\004\017\344\250\326\323\332\201\236\2407\350\374\371\002\316\023\345\021\f\354\365&\020"
+	.ascii	"\340\311<O\217\246\345\214\030u\327\263\363\234\302\311%^\250"
+	.ascii	"a\301\204\246\251\221a\337\200\202\241\242\343\006\021@\241C"
+	.ascii	"\324\231\244()lm\0066\016F\250\205\215J\277\211\263\033\214:"
+	.ascii	"\226Q\001}\352]\340\246\2621!\316\343')\366\351n\222\342\311"
+	.ascii	"o\241x\273\034\222\257\221\202\231\231\3624\"\004\006\275\f\327"
+	.ascii	"9\213b\211\236\022\027\265\232\227\271\355$ p/\020\266\366px"
+	.ascii	"W\314]\234\t\340\371\363\273\311\272\204Dn\375@\220~\357\320"
+	.ascii	"\236\351Z\305\200sL\027\r\301\036\331\327\275\353X\2567\372\264"
+	.ascii	":\334\211\305D\t\302\266dp\310\322e\216\320\265`\f}\263\274\023"
+	.ascii	"\366\225\343\353\213\036\372\003V\341\352al\312\272a\377\343"
+	.ascii	"\345%\003"
+	.text
+	.section	.gnu.lto_.lto.8812338fc493b5af,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_lockMainPID.72.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"-\007"
+	.string	"BN23PO\323\001 :Mp\326\200%\030\206\210\216F\r\360\307\332\3425\206\210\226\0045\377\215\r)\203eml\201"
+	.string	"\"V\360\306k\202u\205\035B\366\2262\245\326L\007\t\006\b\320\332(T\031\0136,d\030\240\246\342\300I2\345\260\251\240EQ\025\304l{\267\352Q\225:*\341(?\362\222\013`\267\363\350o'\341\370\036\177~\270\362\361\317\277\240?\033\"\"\037U\245\t\315\354-K\335\260\357V=\366\323\352\0062\256\342\262[\361\322\262)\357\344c\033\2631>\310C0\033\305m\035\33250(LXv\027J\027\200\376\334\003\240?\3458\366\304\374\213\334}\\\254D-{F\005\273\353\214\232\305\255\267M`{\262\375\t\t"
+	.ascii	"{\311'cz\366\206}\017\026\272\206\357F\f-D&\356\212\251\235d"
+	.text
+	.section	.gnu.lto_sendMotorUpdate.73.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\225\007"
+	.string	"2\31636Po\322\001 [\236(O\240\211`\264\"\021\362Z\345\td\252\226\226^\206Y\202\030\211\037\004bH\031\255w\265\001\3245c\372\301\3645\f\032<\006\355&eJ\001\356P\b\n\007\t\020\363,X\034\f:0p\032`\307\272 E\340\352\301cA\254\252,\250\341\366\230\325\220\001J\367\321\ngR\340N\231>\372\3105\260\"rR\005q]\323\337G\347\262\200\335\317\243\017\362\220\b_\364g\211,\037\377\374l\372\263'(\362\321Ir\322Y\350fs[\252\206}\314j\310\326\215\350*\245]\214\027\227\355\236\211\207\355k\254\331,\3478\366\244\216\213R\313\356B\335\270\366\324\374\177<\023A\333\023\240`w\235\021\224q\353molS\266K\002\f"
+	.ascii	"{\3117c\332\371\206\217Lc\300\021\200\361\036\225\241k8Y\b\343"
+	.ascii	"e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updateState.74.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`4\020%O"
+	.string	"\232\212\034\036Q0\224\272I\007\322a\310\340\273\305\3471\323\256\326\224\332e\023\271\213\307\035\002{\f\003t\247\314Q~]\301\306\211\325\337h\f\f"
+	.ascii	"\001\204K\270\253\017lG\3373\364\346@\305\310n\004\364{\201U"
+	.ascii	"B\277\247-\001\t\265yA\276h\315\022iR\312\024\270\001\235\001"
+	.ascii	"\351\001&\337\004\345\023Q~\217\362\207L\276\020\345\227\240"
+	.ascii	"\374 \3127M>\220\311\247\224\377C\371<\312\337Q\276\216\362K"
+	.ascii	"\312')?G\371\r\304g\312\337\247^\021ck;p\t\323k\305j\345\210"
+	.ascii	"D\235C\232\211Y:\273j\273k\273\305]4\273j\366\207y\274c\336\277"
+	.ascii	"_ v\355\313v\372\303\271rV\355Kg\2058M;\343\234\035l\020_Q\002"
+	.ascii	"\022\303\260-\373\351\312\371\3760\347:\354\250\260vd`\352\270"
+	.ascii	"\325Z\223v\035|\343l\332)\232Q\221\225P\265\002\203\366E\204"
+	.ascii	"\207\355\241\203\365\301\250\310\252X\263\206\240\271\025+\330"
+	.ascii	"-Y\224[\242r\207=\203\332\262\007u\031b\201\372s\3602+\3215\304"
+	.ascii	"b\204\273\001\016\233\275\263\2655\254\r?\275\007[\366\025U\354"
+	.ascii	"\f\303\226\374=\370\351\222\273=\263cKvJ\303\2469W\215\224+E"
+	.ascii	"\270\214X@vKn\025Z\242\022\315\007[\201X<*?\242[\255\305\006"
+	.ascii	"\212R\271\272U\254a\206`a\013\243\261\344q\354\226\377\r[\342"
+	.ascii	"\271b \354P\255]\330\030k-\332\270o\267\344\213{\242\\r\267D"
+	.ascii	"\345\222?\377;[\354\252;\026&\230fO\255\325\327,\354\271\364"
+	.ascii	"\207\267\323\225d\256\371\374\376dQ-\375!\333\027[\264\270\226"
+	.ascii	"\247{`\213\026\n\273{\261Ekku[B\004\271\\ \260P\310\025\325Z"
+	.ascii	"i\026\220\311\\\214`\237\026\202\262\256r,\366P\231\355\030\254"
+	.ascii	"\0248w\003\2131,n\213V\n\3339\034W{\260\004eY\345\200\216\b\252"
+	.ascii	"-\3312\225\254\037\263\356\201Z\353Y\230\245\265\007\332\377"
+	.ascii	"f\376\327\277D[p\026\211\323\314\256\326\252#\226\317I\346g\231"
+	.ascii	"\323\f\257\3604S\236\235\304s\206\263\035\002\366\025\347\006"
+	.ascii	"l\252\363h=\244\021je\266\310\376\302-\236\277q\272\221W"
+	.string	"xc\271d\247\021\276\035\202}\223\332\325j\225\343k\304\324\236\b\274@(\227$[\367FN\234X\025\037\277f\024\323\322\355\345\271\336V2\226f\305G\374o\026N\253\326z\031V\265V\301\350\316\365\002\207?>\236\273{\201n\337\266\275\343\343\353u\246\037\274\302\037\345\222\3343\276l\361\350m#\\z\200nU||\013\376\205P\300+\344\321\354E\306\030\347\366k\252\253\340-[2\013v\302\032\373_\200\001\257\360K\266C\310|\305\271]5\325_\374q{\3717W\273\313o\362\243\230|'\223\337d\362\231L>\224\036\377I\217\317\301\252\355\235\364\370Mz|&=\376\006Kg\277\324\343/\351\361\225z|%&\370I&_\203]\333'!\342#!\342\037\351\361\215\364\370\031\364\370Ez|\"&_\210\311\017b\362\201\230\374\037&_\002\223\357c\213\373\036+\266\033\301\242\331\363\350\361w\364\370\f"
+	.string	"\361\027\240|\035\224\257"
+	.string	"\345\347\240\374\004(\037\211\362q\f\361o\f\361\021\030\342\037 \304\367Q\376\221\020\337\006\345\327\020\342\323\240|\003\204\370\005P\276Q\t\376\f\223/\303\344\3070\371\004\230|\030\224?"
+	.string	"\345\277\240\374\"\223/"
+	.string	"\345\007@\371.(\037"
+	.string	"\223\337\202\362YP\376\212 \276\n\223\237\302\344\2430\371'\002\335&\270\365\343#\002\235k\013\206I-\027\"\320\220\235]Y\371\252\277\003\307c\236\036}@\223[\322~kd10\300\005\264o\204\323\312Q\373\300\244\220`pq\324H5\332\306\030\251u\343B\0035z\335\030\3204\304H\355\235\026\316\f\350\275S\307\250\013h\033\301>G\354%\305m\330\262\030\314ye\363\0305\311UB\327\220\230"
+	.string	"\023\3201ZF\3178\341D\201\005\356J\342:UP\241\\r\206\220\226\001\244cH\320\004\344\361\321\022\300h\037\2759\f\3200^\364"
+	.string	"\255\303S\324/\272p)\362\372\321@\004\350\037\275f\001\264"
+	.ascii	".:\200\326\341\001\240]h\221Bb\313\002@\035+]C\242Y\220\026\322"
+	.ascii	"\242\203\364\032Yt\213!\340\352\334\220%O\261X\177\023+\232E"
+	.ascii	"\353\332\200c~X\244\220\2620W\327\2126\251\340\342\314||\242"
+	.ascii	"Qt\212V\321\377\311\345\364R\024\344\023xK\351d\341\374\362\245"
+	.ascii	"\\RE\363\266\230:\005P\243\350\025\2769\365\2117E\374\326lxk"
+	.ascii	"j'\023\335\324{\003Q\233\3505\321P\367X\213I\270\302K\016\301"
+	.ascii	"\211\260Q\032\210\251\254PG\351eS\242\205\202\272\204\331A6\330"
+	.ascii	"J\025\323N\025\267!\321l\252RAi\246>\003\363\354\361\270\327"
+	.ascii	"\241\244\r\245\327\206\315\311\340U,\263\246\006\356\247io\033"
+	.ascii	"`Z\025\037\215Dd\031\202\r\260JK\375\177x\375\323\2724\3001\273"
+	.ascii	"\3465\243\001k\360\024\251\034]\265Z\351\370O0\034\302\031f\311"
+	.ascii	"\024l\2736\317\264\305\231\255\03512bd{\371\233\377\f\243"
+	.string	"G\253\250bf,\216\256\313\356\321\254\003\360\353\007\307W\272>\372\262\305\277\262\313\252\3000$\366\226\2303?\344\214Xh\357C\271p\270\236`)\330\372\354\361t\341\205\023\f\254\\r\003or\004\325$*\211\311\327\344\304\304\344\244\304Bi\t\252)\247\373\340\351)I)\tT\323\016**\211\024\247\246R\212SS\222%&'QP\222\226\236\200\230\234\\\220\024\005ei\311.\352I\224\276\322\321\004C\200\\\340\213Zb\362\224\024\345kr\222\304\344Sz\202\362\035\025\335)\312\322\223/\312\311\351\311G\213U\233\253\335\345\017T\365\217\351\212*]C\342\362\2253ec?Rr\265nq`\325\354\272\241\341\343}\360\2261\332\024\037\0378\316\224\236\251\270)>S|\312\251$\246\216\274\302\363\032\2609VM\365\035}8\347\224\263\266\035\2553\263SF\254\252\237\303y\025\324\205\003\003\255C\263\026'\266"
+	.ascii	"\033\031M\370\266@\243X\3035G\007\267\241#|[\243\243\214\t_C"
+	.ascii	"\342\362\332\313\211+\350\222x_\314\334)\271\206u\322T\226my"
+	.ascii	"^\210b:$A\326\240\005\335\224_\243r\251\251\374\nt\331\337P\335"
+	.ascii	"\310m\204o9\272G+\320M\007\330\303\257qt\216&\333\246\304p\002"
+	.ascii	"\333\02503\243\032\244N\240\0278\346I#u\211\006d\3228z\201X\032"
+	.ascii	"fj\27755n\034t\223~\342\2449h2\211&\275$\310!\333\240\2274\223"
+	.ascii	"\336\245\336\240I:\301>J\255\244\227t.\315\217\323\234W4(u\214"
+	.ascii	"\337\222\235WJz\205\330\030x\364\304\3554\350\244\336$\255A/"
+	.ascii	"V\332\031p\f\222N\322\333\026\354\263D\312#\215\304H\037i\035"
+	.ascii	"Z\260O\307!\202\204\272\347\2242\2036\322$\036\240\fD\272Hg\320"
+	.ascii	"\313\266$V\232\033\340\327o\207\2256n\272\"M\244\225\260\330"
+	.ascii	"9\214\211R\236X`A\271d\221NQG\254J\355gp\311\316)\273Zk\016\""
+	.ascii	"\235\202\030-C\242\330\363d\341\222S\356\221\362F+\031\033\002"
+	.ascii	"\201>\240ot\201(\250a$d\221c\210FDD4I\ni\ra\005\204(\346\250"
+	.ascii	"3\036\021P\261b\f\215\320$)d\332\f\333b\214'\367\337e\312\244"
+	.ascii	"\342*\371U\332\224{\275\313\243\320\270b"
+	.string	"T\323\373\363:\335*\341\220\310^\336\321\002\347\334\005\335C\303x\271\273\377\352jx6\216\036\245\027\323\330\204@\020\357U\211\310\036_~\214\217\312\003i-\267j9\247 \207\344\021\361O\022\310o\366\234\004\032\315\335\211\035\346\214P\001\370)\033\033\261\2364\321\256:\rY\030E\302\003\003"
+	.ascii	"\re\355\024f\206\303\226]{S\206\200k\350\035\335\177\347\224"
+	.ascii	"\\\374\253\237,XM\213+\335\217\262\013\b\232X\020\264\264\242"
+	.ascii	"\340eF~D@\r\"Ij\357Vb[Hr\255=(\211\006\246\223\036\317J\323\302"
+	.ascii	"w\320[\344\03497\347f\347\177\274#\022\2769,z$\206\322\332\361"
+	.ascii	"\326\360\321\366S\275`X\271\363\270\177\300`\320\263L\300\003"
+	.ascii	"\r\237\003zaH\267\337\200\267\200\354\260\317\256\302\370c\016"
+	.ascii	"\330\322\031\002\bq]\224H \335f\nN\033<;Y\213e\360\244\036\234"
+	.ascii	"\304dY\346\201i>\350"
+	.string	"5\206\310\243\036\233\3423/\263\004P\036\363\314\220D\344\213\266\370\2053M\013d\345\350\226\337.z7$A'\201\350\n\356\327\274P^9\316ia\323\f\212/F\342\227\250^\035\207D\200\237P\224\306\270\275\031\021\263\377\371\272\204\322\232\343\3445\232\373\222\002\204\347\323\360\243\261\377\262\177&|\277M\347\315\f\030\013\201Y\227\027@i+\036Kt\261%\342\312\303[W3h\321\024\373W\243\251\245\260-\0374'3\202\325\013\204G%g\341\026\f\007\307\230\366#*Jo\253,f\266\253v\327\224\273\244\036\350\214\246\361t\224\247\307\251\013\374o\"\376&K\036\332(H]\222\211\260\030\332\013\213d#\201\202\202'\"\377J\025\275*@\370yt\212\346&G\2023\341sG\270O\373>+%\263'zo\377\304\235\032d\327\223\315o\362\232M\360v_D\366\214{0\212\034u\212\2314!\305S7\201"
+	.ascii	"\325\346\220&\257\366_>w\360B\340F\"<\264_\361Ut\b1\335a`\204"
+	.ascii	"2\245\310\373\324"
+	.text
+	.section	.gnu.lto_udpThread.75.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\027\002\365\022"
+	.string	"6\342}I\300\224Nc\330\366@:\354\333\t%>\337\230\360\225\037\021\333\274jo\241$#\001\237\220\017\257\230?\243\351\314\266\256\222 \022\312\214\313?v\025\b\304\2336\034\r\202M\240r\003\352\271D\263\377V5\311l\357-\267\224)\005h"
+	.string	"f"
+	.string	"g"
+	.ascii	"f\213\235\320\210\352\306h"
+	.string	"\310\275\346h\363\005\300[\361\004\300\333\312\302\240m\265=\004\355'Vj\363\351\326\n)\245\362\366\260\244\274\341\235\232(m(X\366\334\002\b\342\371g\022\324s\361\2230$\344\342Q:>_=\221x\270J\034\255\347=A\214,^\020\245\222\3474\234p\3575\315\225;7\311m\247\260]\301\246\f\002#H\320\347\302J\363\321\323\272\272\251\267*Uu&\325\272\263\315\033}\235\030\222\341\252\263\177\336!\245>\311\205#9*\230Rr\334\233\263e\344\366l\023\214\237\277m\363yv\331\346m\330~\332I\274\351\210G\273\252\253{o\203[C\020oO>z\"[}\300\275:\"\035\367\232\017<\212\267\237q\0326\333\352@>5t\313\377w\357\275\240J\024\324\013k\001\364E\337A\276\232\354\"\243\317\271d\t\253\207C\200\343\007\353\253;\3775\351G\367$V\035\316\355\004\206\365\205\242\006\217\nG\2118"
+	.ascii	"5\220\277\200\307\271\241\300\027\235\211T0\245\364%\0200$\t"
+	.ascii	"\336\276\3507j\342\2755\317\371GG\022\341\003\335z\246F\237\273"
+	.ascii	"\365k\001FA\211\305\310Nb0\331\354\003\213L\254f\022s\030\r\026"
+	.ascii	"\373\354\222\202\201\305\302\312H\223y\230\301hc\314\013\fft"
+	.ascii	"\231\315\214)'&ed\263\221F\222\263\321u_u\343C\374\230\322\272"
+	.ascii	"\252\25166@}\250\025\333\301{dp\204[\rb\t\225\005\0338\320\245"
+	.ascii	"\"=\\\275\t\205ug\032\360\225\202\020\337\351O4>\220;\264\264"
+	.ascii	"\324zfi\005* p\002\031:\353\001{\371\023\264\213,c\242\261\260"
+	.ascii	"Q\217\326\330\260]$\372\262)\035B\236\027n-B\263\202[_Y7\370"
+	.ascii	"\256\364\344b\016\204~\220r\336\300=\346\023A\253P\241uB\215"
+	.ascii	".\035m\304qeD\024\035\220\355\005\220\254Q\373\334\306pkd\223"
+	.ascii	"\001\302\301\034\261\230\274\276\232\t3^\227!\003"
+	.text
+	.section	.gnu.lto_tcpThread.76.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\\\001\335\016"
+	.string	"\206\231`G"
+	.string	"\221(\035\020iK+\311\263\355\215Z\271\322\375\020\333+\216I\3637/\033Y\365\375{\004\364\313\363\233\265\375\231\2460\004B\024\331\0264\262"
+	.string	"\265\3231\245\336\311\177.x\r\355\021\355\035\210X\364\333~\262\367\226)\005H"
+	.string	"K"
+	.string	"N"
+	.ascii	"\324\341\013l\237\236\203l\237\321\204\345\226>e\334\222\037"
+	.ascii	"c\214\250A\003\232>eG\325\202\342\003TI\020mV\363\231\257\007"
+	.ascii	"\020\265R\305\313\343g>\322\202\241p\320\200/\337\016\203Z\253"
+	.ascii	"w\005\272\334\333mW\260\355\300~\211\373\225\t\354\bqf\250h\262"
+	.ascii	"C\323F\022\366A0\264\231#\313\336\365\001\254\353&\346="
+	.string	"l\324\332R\313\251\262Y\223\302v\311\376\354el\363\001\265\262dd\324\032&0\365|\236\305cJ\266\215\201\020\306\245\363\352\300\301\305M\255a1\227l\262l\217\rt\244\226f\377\365\027,\376\t\233\214\366\253O\177\264}>\306\0260\327\207\323\326\244\274\260\022 \326\222\305\027\r\025\030\345I\b\317z\306a7Z\"j\365\202Z-'U\353i\304\316\240\362\001B\226\212&\317\2655\254\004\026\021\021\241t!\"\256\363,\224\244\204>\001\334\307\211\244C$\020J\036D\240_g\342q\037E\031q'4\344\251P\222\020\223R:\217~$\222G?a}d\321c\340\221\003gv\212(\203\254\037\223`#8\214\t\006}R\360lPp\200\013\255\3506% p\002\221Z\346\001{\362\205\206\327c\226]\030oMj\265\213<\025\300]Q-A\307'\270\303\336\256B\212L\343\b\"\300\035\276[\022\237\nv"
+	.string	"\006\fp\316\347`\214X8\017.S\0216\207\246K\316&i1"
+	.ascii	"\277\205c\021\204\364I\344P\312\257\013?\001"
+	.text
+	.section	.gnu.lto_systemInit.77.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`{\005]\037"
+	.string	"&\366\304I\200\334M:}^?i*#\372\036\276\215\262RhU\300W4\314\030{\361\211\t\020i\334\347\320\247\025\376\306d\340\303$&\376l\377\323>\007\250\225t\023\024!\211C[!b}\264\362\213.\244\255@e!\232H\333;\311\244"
+	.string	"\257"
+	.string	"\266"
+	.string	"\315\372.\316\352~M\305=\272\177|v\016\366\266\375\366\375\355#(*RaqQ\300\242\252To\332\250\3558\306u\260\277\373\037\266N?\311\277\362\301\232\254\364U\225aZ\302\242\252\252B\037\033W~\274}"
+	.string	"\371\261\366"
+	.ascii	"\344\307\316\335f\316n\251\177\362c\312\311\231\252\2528\254"
+	.ascii	"\365|[N\211C\2165|s\377k\320w[\347\\\r\251\262\272e\343\374K"
+	.ascii	"\325\215\251K\366\b\324\tJ\335Z\343\232\2056[\242\364\004\177"
+	.ascii	"5\314\203\310\207\2770\202Q\367\342\\PU\265\357\032\234\361\326"
+	.ascii	"yw\267\350\356\262\356\321\0261\306\373\261\237\275\226,\034"
+	.ascii	"\214\356\327\213{\334\264\370\215\2300Qj@\327\303\207\236\263"
+	.ascii	"\366\207}W\310\212J\240\006\2445B\320\212\277\0038\212`\234%"
+	.ascii	"\364c\024L\312~7\255\t\334~\b\362\354\253\030\021Oe\004\t##\262"
+	.ascii	"\204\t\2743EM{3^b\352\217\310\276\330\245\034\365\201tN\247#"
+	.ascii	"?\216V\266\024I\003u\3374\317\355CI\352\036\372\223]O\370\250"
+	.ascii	"T\002!\004}\354^\3429\265g\305\037\3665\316=\373&O\245\252B}"
+	.ascii	"\355/9\223^\037\310\307vz\272_?\366\237\310\217C\357^\321\342"
+	.ascii	"~m\001j\250\240\025\245\260\257\003QTyx\277\376`\036b\025\037"
+	.ascii	"|\366\2529H\243\004\376H;\364\016\023"
+	.string	"\366\223\330\244\325\310\302\373\325\007\363\020\221\264S\330\327\021\356\016>\3735\331\252g\013G\t<VP\216\254\203\215\020\264\"\356\n\275\303~\274\311\3142\217\004dT\025\3705g\225\300\323\b\372x\366h\262\360\314\213Y\313G\026\ns\220\314u\277\356`\036\242WW\027\227\022\253\375a_\231\262\334U\002Y\354\020s\2647Z\034\033\276\022\263\035f`\030\\\334\317f\257L$\033\021\223\207`\036&#\311_y\230\207\0302\334\2576\314C\264j\247\244\210}\221>3\274t\331P\002O\240\251W\001HN\350\251\002={h.\355\021h\033\322\002\3234\225\230v)n 4\214\270\245NELO n\351\216i\007\324\016\314\006f\003S\302\003\0076\364TBy$\232ti\201&\036\217\b\250\025\240<\024=oJ:\036\321\231\346\220\232\234ng\232;\321\f\006\3324\315t\307\324\301\304\322\231\366V\364J"
+	.ascii	"HO\024\267\316$\022\321!\004.=\223\320\\\212c\332\345\226p:\264"
+	.ascii	"\2073o\315k:Q\\\312\343\2418\035V=\356Q\204\246\205\302Q]\341"
+	.ascii	"\376G$\371<Ev\347\027\031\306%zi\245l\\m\331\256\334\027\327"
+	.ascii	"\305\307\310lx\345\374\340+I\223\3611?{\1777k\25014\311\244d"
+	.ascii	"3\242\240\214$\205\351\260\002\021\"\262\016\020(f\252L\223\302"
+	.ascii	"pX\331\312Xu\316\334\177\034h\312\247&\212\005\246\251\324\336"
+	.ascii	"\312\b\030\203\b2\2046\017\230\317\242Kc\215I\016\360\250\313"
+	.ascii	"\260\034\370e\227\344N\354\034\352\245&]\037\214\273\232A\363"
+	.ascii	"h\204\315\375\017V+'\250\263\350gVl\300iy\201\217\376\347\233"
+	.ascii	".\255\005D\327k8{\226\217t\300\211^#\037\317\316\242p\t\365\f"
+	.ascii	"1%u\313\234+\346\206m\354y\306\335\374L\226\304\312,\364Pqh\241"
+	.ascii	"\227\216\214\321b9\270I\236\245\030\030|\215\270\347\327\253"
+	.ascii	"Z\237`<\006tW\352\263\200\022\033Bu\235\200\261 \300\035M|\320"
+	.ascii	"\341\377\304La\311(\004\017\202\032\303]\231\031\240j"
+	.text
+	.section	.gnu.lto_systemReset.78.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"%\n"
+	.string	"\346\022E: \223\322\001\2375Bc\220\202@\244+\2470\021{I]1\326a\324\022l\350Xk\327\231J\020f\323\327\220\ti\342\242>\211\204\221<}\230\005\037IA\326Yc\237-S\n3"
+	.string	"3"
+	.string	"4"
+	.string	"3\230\363"
+	.string	"\325\n\222\373\251:3g\305\366E\036\355\235\317R\352o|>h\270Z+\225(\037\277\243\357\r9\324Z\275\261\020\221[\336v\201\355\006\373\013\001A.7\216\3159\264\376Lh+\\&\303\f\237\032\001\036\024\341\323vm\354c\376\313M9\226\036\033L\276\354\331k\345\211}\200*M\354\257\367\353\013l-\243}\355\213sZi\200\223\221\214\326\267\350.mT\212\324q\332m<\325j\325}^\316\222\233,f\304gu>\315kX\276\212[\337>\366\351\177\335\347l\t>\020\275\320\213\250hyb\350\nO\003N\225 L\017\022T\364T J\244\027+T\213\246\300\220\226H\3760<\220\212\337\007RQ\3107\301&\334\236\240\030m8\033L\276\034\022"
+	.ascii	"{\345\363X\033l\263c\t\226\002?\320\030U\b\2676\315b[\036\366"
+	.ascii	"\201\325\224r\252\243V\203\347\322.\214\272\202%/C`\006\240"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.79.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\355\013"
+	.string	"\366VSA\020S\224\016H\272PA\004\262"
+	.string	"\346\037\024\ft\206\035\217A\006\247\345<\032\306a\326\201\307\217\267k6BZI<\323\330\rN\211\252bb\"TLp~Y\210v0\244\257\211q\333\347\266[\246\024="
+	.string	"@"
+	.string	"B"
+	.ascii	"g]\304\273\f\017"
+	.string	"\276\354\2520\321\261\373-\260\264<j\016\340z\244<\344z\264g\233\374k\261/\031q\032i\355\256\204,\356]=\337Zq\260\273VT\252\304\ro[\200m\n\366=\001\2571\262\025\234\006g\006\217$\213\210\006\007\036\355\016%=\312\237\361N\352\003\342\003\0044\331\237I\341\n\373\224\335]\303\225\255jU\365/\bP\234r\f\340\261K\342$\310\366\210;^`l_\355\356T0\261\255\214\376\306\025\207\005\205\006X\252\024\031\365=\327\241\215\001\323\204x\311m|&\bt=\036\306U\f\225\310\t?t\371#'\t\371.\254!\323\243\036\375\354z\2140HZ?>\350\211-\352.\260\315\f\230\266\241\323\264\007\032\247\233\334\224\340\311f\307\225\270\013\004\246\250\304\351\270I\032\315\r\343\317&\002\007\302\004\331M\320\206u\222C\b\313\344g\343\344FcM47\331i\332&1\266]\361\035@\023\334\001\022"
+	.ascii	"zei\233\311\2355\3473\002\004.\240]\252\260l\355\224\305\342"
+	.ascii	"<\254\006\013+\345IGm\001\317\245\003P]\354\"V\243\361\002{"
+	.text
+	.section	.gnu.lto_timerInit.80.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"\342\21405`O\322\030\024H"
+	.string	" \001V^\213\364T\016\340\276\353\332\223!\1773\006\201?\303\354UD\016\261\311V1\370@\327\275\021,\247Q\007\244O_\b\021\262\267L\001C\bg\365\331HH\312S\315\b\202;\260\001b\363\020'5!93~*\216'vdE\204\005[\024\224\214\323\262d\324h\253\322\276\220\203h\333x\034\003\270u\305\342\023T\345b\005\2350\004<\342\201N\237\241\3414\333\215R\266\216\207\275\206\271W\362*\355\013\375C Q\027\230]\220\031\231\335\246\021\312\257\232\257\177Q\355d\265e\344\203%fw\3433\321K\335\265\252H\0072\020\246.\200aww\031(D\177\372\033\374\013\277H\n"
+	.ascii	"{\3117c:\363\206\271\241?y\256\347BN\026\354x\031\002\\\272E"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_timerStart.81.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \305-\005"
+	.string	"2I\"*pm:(Y8\b\013\350\202\\^h\bk\260:\260\037\233O\311\211\231@$\204\232N\t\364\341\234\361Q\025\336\215q\357\224\002\276*\204\342\220P\r[LK\323G\303r\3505#ZQ\316 \330T-\313\246N\341^~\224DN\354\220\213\022c\037\260\362\263c\001<\210\264[)\215\366\023\360hl\177\362f\207\036\202\373\316\205\302\021\355\256\312\314\267\307\315\377\346\203\316\343\036\005\206\335u\354<\313-o\233`\273\262\315\b\t"
+	.ascii	"{\3117\323\342\234\031\001\276\3345\234,\204\3612\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_failureMode.82.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"E\t"
+	.string	"\346\021B;0\345(\035\200s\374\fP\345\350E\374\262\222\233R\303\305\033h$\266\217\235\270~\026s(\3240\303\271\207\310vg4_\366\352:`\360\"\005\225\037\304Tc\316Z\262\367\336)\005-"
+	.string	"2"
+	.string	"/"
+	.string	"\247\376l\230\207\257}ldcefw\253\024\261\214\337\247\214\237\217\340\372\374\270\334Z\256GMhw\035Y-\217\233\336v\310\266\310v,\224#F\305\022\264\017\373\3434 \371\213\314nG"
+	.string	""
+	.string	";\243\262\022\216\355G\373&?\371\016\313p\300.\bK\313nx\340\2729\365\274\243\235\316\017h\001\276\004\375)\301\317\335])A\333Z\214\362\341SR\002\257\335\325Y\026\233UB\301\251}\201\021\317\362Q\276\311\\f\032Re\207\252(C\354\007\336J\004\236\317\347\363\300\225\272\005\316KI\230F\020\016\035\256\324\235\246I \205\006\021CEq\021\336\bU'L\243S%y\025\025\344qG\301y\025\325u^\345\330\266&\013"
+	.ascii	"~\311\005\346d\344* [\356], VS\202{q;m\266\f\334\270Bq\002"
+	.text
+	.section	.gnu.lto_indicateFailure.83.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"m\n"
+	.string	"\266\323JB \307*\035\220\340yb\f\262a&"
+	.string	"\033\303>\007]|\212\021\200\251R\020"
+	.string	"\363\206A\202M#\364h"
+	.string	"$\025X+l\200\021R@9\363\215\342\003'\026\345~L+\340\241Z(\200mk\204\354\235R3"
+	.string	"5"
+	.string	"9"
+	.string	"Us\256{\003\346\334v\006\3149\217\366\202\227\260}\201\030\312\200\007\273[i\313\307\317\321?\200oH\027\3533\003\332]O\322\245r\323\333v\260m\262\215 \333\356\256\351\313\276\354\237\333B\003\005\031\004vS\"@\330\032G\213\331>\307\366,} \301lw=\226\320\234\363\247}\227\277\214\227\221x\263\273b`\266[z\034\252\372\351\f\246\276\260\212 \030VN\271\337\226\276\274\341\240VBM\234\231\223>\300\005\250\024`\273\255\223+M\013\004q\316\026\031\231'=i\fj'\224e\227\254IY\354\007N\030=t\235N\347\343\033\201\032$\217n\"\004I]\210\3123\221\272\n\213P\367\205+S\311\273\210\020Q+\220B\364\276\324\027r\276\021x\332,\372\204:08\252\370\201\204\236XQ%\357TEa\013"
+	.ascii	"\3369\312^\222\310\330\013?k\202\263;\256\241\2550^P\345\b\250"
+	.ascii	"\333\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_nanos64_real.84.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\227\001\035\017"
+	.string	"F]eD"
+	.string	"\221(\035\230I\3777Q\2374\177\277\037\203:i#b\354\221\321\353\235\301\210\355;t\2441$\361_\3750\312\332Wo-~\264\376\2628[\355\0233\253\247\302\327W^\243\203\262}\333'\204\354-eJ\001Q"
+	.string	"J"
+	.string	"R"
+	.ascii	"~\314\033\330[P\377N_\257\2259\361z\221\355\266\b<\272\343\036"
+	.ascii	"\277\036\177\304I\240\234\362\370VR4\230\226\013&n\354~\235\277"
+	.ascii	"wh\217\334\003h\217\332\341\251g\312\177\354\221\005\305\013"
+	.ascii	"\026\212\352\2711\330]'\013%\345\326\333\036"
+	.string	"`\333\200\235\007\002v\211B\236\345\216\f-\0342\013\252\262?U\352\006\373pw\327\252b;\355\201\351\016Ls`z\243i\rLg`\232\323\364\006\323\032LGMC\230V\230NM\037\200\b\206\023\227\b\007\263\335\223Y\216\225\021[|\370\367\333\2500'\337\303\243?\243<\353\321\037i\217\233&x\301\242\252jz\317\0055\252\302(y\f\004\365c\006\214\305k\204\210\331\265\202\n\273+\001\251\252\367XLr\346kj\332\360dv\204\307B\334\356\"\270~pXq\225\200\255rf.\357\362\330\210c\025x%S\232$\344\001\204\006\"\235\351SB\0321u\022@#\241\216\204T\352B@,\232\360!u&\221\210\324m\276=\\U\361(\310JM|\202\273\032\026\310\\r\346\216z\364^\f\216j\332\321\230\302\003\261\321\214r4\272Q\017\027*@)4\372\025/N3\233r\272\321\210\t\371/\017\036"
+	.ascii	"{\311'c\232\211\f\213&\373\260dI\365\206\320\306j \205c6B\301"
+	.ascii	"\254 ?\260\034\020\210\260m&\321y\013+\301\202\360\262\020D;"
+	.ascii	"=c\033z\254\263\371\373-\001\2720*\214-I5\016\356\226j\2018)"
+	.ascii	"\246k\222\001"
+	.text
+	.section	.gnu.lto_micros64_real.85.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\304\001-\020"
+	.string	"\006\037lE\360\260(\035\350|Jh\206\t\263\016\314{0[\352\031I\357y\206\373>F\355\021\214\226C\214\035\344\334\2371\363\361)\252\257\026\013\374\fI>\013\236\b\250\005\202\252\227\243\321\n\327\362\266\366\177\311'{K\231RV"
+	.string	"Q"
+	.string	"["
+	.ascii	"\367~{\305\217Yt\363\023+\367T\276\035\f\210E\215\213\331.\314"
+	.ascii	"\201Gs\333\343\027\200O\342%V\314\022\300\353 \243\351\310(\344"
+	.ascii	"\350\330\3658{\007\321\036\267\177h\217\312\341,O\026\377\261"
+	.ascii	"\303\035Y\nXL\313\363\263`w\235\260\030\231[o\273\200\355\004"
+	.ascii	"v\242\002y\234\307P6\030\202\333)\021\3620\203`\230\355\230M"
+	.ascii	"\320\026\333kI\325`\037\356\356Zil\247M0]\202i\022L\217`Z\004"
+	.ascii	"\323!M\203`z\323\364\007\2465\230\2160\r5\2550\235\232\376G\211"
+	.ascii	"\315\313\314\b\222\033\273/\037\217\355\211;\037\002\272i\b\317"
+	.ascii	"\212\225\257\342:*\276\207G\247P\362\260G\037E{\374\350sj\242"
+	.ascii	"\246j3.0^A\304\005\032\026B\354\274X{\344\373PH\330}\r\200\032"
+	.ascii	"\365\235\215K~V\205\032e\234<\246R%P\343\346\232\2529\272\231"
+	.ascii	"\355\340\261\325\266\273\n\256\247\r=3&n^\371y\013)\256\264\311"
+	.ascii	"\211\244\001\203\022\316\225:i\241\\\334\003\025j\305\231\264"
+	.ascii	"R\270\223\210Y\020R-\316\305b\2658\221\267\207\2534&\025y\251"
+	.ascii	"\213U\340n\206\221\031N~.\251I\337\315x\341\220\331]\033 iIS"
+	.ascii	"\326\331\214TS\222j6:\020\"\335t\244!<!\025\2014\244\002z\310"
+	.ascii	"T-@\372\030\237! p\002\2312\332\003{\362\211M\327\3210\177\332"
+	.ascii	"\327\215\375\335\216V\35308\315\203E\321\257\274;~%$\210i\354"
+	.ascii	"F\346pit\261\25577Qt\344\300\217\207w\"\343N?\306W\315\235\267"
+	.ascii	"m\322\215Q \300\244\223}\262D\003DRL\327#\003"
+	.text
+	.section	.gnu.lto_millis64_real.86.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\304\001%\020"
+	.string	"\306\236kF\340\262(\035P}\001T\317\303g:\335\314\365\365\025'F$\035\330H\315Y\001\351\216\323eP\277\363\317\316\332@j)\204\246\323\0057\230\317\245\233q;0G6\215\245\201\204N#\260j\326\376'\215\354-eJ\001U"
+	.string	"P"
+	.string	"Z"
+	.string	"\336o\263\3702\217bO\301ro\345\333\305\204Z\330\310\230\355\306\034x4\267=~\001\370&~\202\305-\002\274\0173\232N\f\0139?\273\036g\357!\332\343v\020\355Q=\274\345\331\342_v\330\263\263\003&\343\362\004-\330]'Lf\346\326\3336`;\201\235\2518\227\245l0\004\267U&\344a\016\321\300\303cVA]l\317%\225\203}\270\273k\255\261\235>\301\264\t\246K0M\202\351\021L\2134\035\202\351M\323 \230\326`:\3024\324\264\302tj\372 %1\030\232\022\016j\354\302|>\326F\354\t\361\">,X\376\212\353\254\370 \036\255J\311\303\036\375\024\355\021\244\317\261\211\232\252\321\274\274\370\005\022\031n`\030\321\303\2636\311\367\251\240\260\373\""
+	.string	"5\352\273\233\227\374\254\n5\3168\271l\245Z"
+	.string	"G\354\232\252:\272\231\r\3412\326\266\273\n\256\250\016?4(b\257\374\274\345\003*\256\264\t\252\301\003\006%\234Ku\322J\271\270\b\253\024\2133i\251p\250\021\243HP\2658\027\nJ\213\033y{\270Zs\322\221\227\276x\005\356n \231\341\344g\223\236\364\035\215W\017\007(\251Is\247\273!\251\246%\325rt\"F\272)IE|D:\n\251H\007\374\330Y\271\b\351a\200t\323\" p\202\2312\272\003\373\363\311L\327\3050\377\330\327\235\375\256\016\243\260j\035\006\253ytQ\264\225\363\216^\t\031\"\032\273\2219\\\032\266\330v\315M\024\0355\360\343\341\215\310\270\323\277\361us\347j\2334\306(\032`\322\311>Y\322"
+	.ascii	"\211\024\323e\310"
+	.text
+	.section	.gnu.lto_micros64.87.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`f\001}\016"
+	.string	"\266\333_B"
+	.string	"\221(\035\260\271\016&\214E\211\310\212#Tt\b\320\031R1\365\254\336 \362\024\340\230\006t\234a\377+\335\200M\255L\352\033\321\372\317`\005\365K\372\303\021\335S\320)\317\233\240\265\377\223\275\223L)L"
+	.string	"E"
+	.string	"K"
+	.string	"$5J=f\225\234Z\007N\211\212\rW\346\206\300\257\331\306\257^a\026$-\025\330H\234`*0%)2\231[\326\315\0030\277\215\003`~\037\341\222\261T\033\305\216\325j\245LLF\r\203\314,\246LN\334\273\355\201\266\tZ\304N}N\300\303\214\027\324M\355f\302\213h\35523\373U[,\310,\367\363\260\236\207\3558,\347a7\017\253yX\354a\237\303:\207\375\303\242\303\032@\2075c\342A+\223\303k&_\236\313\t\263|D|\03344\307o\356\025-\004\366w\315\255\245@\2750\214\266P(KY0?\354\034\225\373\373W4\327\377\271\2735\024\250\224\f\277"
+	.string	"\030\225\217\267\346\252[\330E\251.Q\f!t\312\257\016a~\376?\304\250P\235\360\325\r\266\026F0\027D\"/\210\207\203\b\r d\244\020\t\243\017R&2\341#\224\201\214F2\217\216\212*\204\2142\222H4\312<[\332\345W\240w\234\216\252\347\240\266\030\265\001\204\213L\r\224-\333\005\257\327\r\r\231'\003\235{:W\320ji\256\317e\254br\2508\217\341\024\216sn-\037"
+	.ascii	"{\311'\323\264\0011\354\274\0269\007\r\033\3162\325\346\347\""
+	.ascii	"\254\fc.#\025\b\001\013\031\273\2255\004\302v\230\205F\024-b"
+	.ascii	"\030!\316\363b\\)\213 \0174\206\024>\027\333X\224\005\3205\247"
+	.ascii	"\017\001.j\005qM\233\204I\006"
+	.text
+	.section	.gnu.lto_millis64.88.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`f\001\215\016"
+	.string	"\266[`B"
+	.string	"s\224\016|\207&"
+	.string	"\266\003p\b\026ZafIc\330GT\177\247G`:\322\314T\243\016f^\373\032\001qV\005}\331\005\341]b\252\n\350\003P!d\243\017\032r\217e\367?id\223$S\nM"
+	.string	"F"
+	.string	"K"
+	.string	"'5K9V\215\234\\\007\r\n\215\r\256\314\016\201_7\315\257f\341\026'\035\025\350H\244d2~\240\254vdv[;\017\310\3744\007\310\374>\302#\343\2506\2131\325K\353\204\"\0313\f2\263xB\245\270w\333\003m\023\264\210\001>uN\340\003*\306tR\333\221\360+\255\261\314\314^\245-\326c\225\333yX\316\303n0\254\346a\265\207\315<l\366\260\017\303b\030\366\017\213\030\326"
+	.string	"68|\230x\320\312\344\360\362\2211\317\306\t\253|D|\03372\307kw\013\027\"\373{\346\346T\230`8F](\224UV\346\227]\223\302\376\376\026\316\365w\216\335\034\n\323*\303/ G\312\307\233s\325.\374bT\227(\206\017\372\344W\1772?\377\036V+R%|U\303\326\202\t\006\027@%\357H\210\203\b\r l\"\022\t!\021\321V2A\344\263\215\204L\266\020\220\202*\220\2046\021\b\024\3328]\032\313\253x\016R\272\251\234{\352b\016DK\004L\217\024\254l\027\274^0\0322K\0066\347l\256\340\245\305\271:\257\261\262\342\221\322|\206O:\256\271\271\037"
+	.ascii	"{\311'\323\264\0011\354\274\0269\007\r\033\3162\325\346\347\""
+	.ascii	"\254\fc.#\025\b\001\013\031\273\2255\004\302v\230\205F\024-b"
+	.ascii	"\030!\316\363b\\)\213 \0174\206\024>\027\333X\224\005\3205\247"
+	.ascii	"\017\001.j\005qM\233\204I\006"
+	.text
+	.section	.gnu.lto_micros.89.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\030\376?s\204m@x\302"
+	.string	"\241\033\351\256\300\330r\202\332\032AF\r\31113\001iM\304'\017~qN\331 \372\335\244\245\221\275\245L)\266L\007\t\006\b\257\272(\300J\365\032\026*\f\317\002\037\336$\231r\270\300WQ\024|Q\334k\247\251\224Q\215\257M\323\2639\311\344\307.m\210\210<v%\250\320\350e\307+\325\302~[\355\330N\267L\337\rpN\342\331\225\370\230\354\210\373\310\260\215\261#_\343\033\030[-bd\220\007\305\246\243d7>\351\001\320];"
+	.string	"t\247\027\267\236\226\177\2167\221\020\020,\273\236\224\202\335ub\331\304\255\267-`{\262\315\t\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_millis.90.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \373\275\006"
+	.string	"\342\314.2pM\322\001\030[\365H\213\034JX\33520\230\331=\200\330r\202\332\032AF\r\31113\001iM\304'\017~qN\331 \372\335\244\245\221\275\245L)\276L\007\t\006\b\257\302(@K\365\032\026,\f\357\002\037\336$\231r\300\300WQ\024|Q\334k\247\251\244\321\215\257M\323\303I\321\344\307.m\210\210<v%\270\330\350e\307+\025\303~[\355\330N\267L\337\rX\274\304\263+\361AY\022\027\262a;cG>\307;2\266Z\324\310 \220\n\316\307\311n|\322\003\240\273v"
+	.string	"\350N3n=-\377\036o#\"&Xv=+\005\273\353\304\262\211[o[\300\366d\233\"\t"
+	.ascii	"{\311'\323\342\2533\216\206\360\\\303\217#\\\026\202\fw\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_microsleep.91.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\266\001\305\020"
+	.string	"F\340qF\3200'\035CJ\246\252\354aKk\362\307\311h\273\243\304\310\037!\022\273)\255\351&&Q\240\351\342\251\207\216m0\330\323\207d\374P\364\225\365AG\201\026\037\252\372V\340\t\320\306\300^\306?;\364\367\336R\246\024]"
+	.string	"X"
+	.string	"_"
+	.ascii	"k+`\256\343P\344\001\342\341{H<4\314\246q\033\316\276('f\310"
+	.ascii	"\306\356r\352\301\232\260\303\3704a~j@\2221\021\321b\207 \"h"
+	.ascii	"\036a\362=\275\231@Z\321^\336\001 \0229*\232K\352\273\017\350"
+	.ascii	"i\3211\021\321h\236\034\tv\3279\243e\2709n\333\202m\022\373Q"
+	.ascii	"\001\266-\226zc\237$F\222\216\265f?\350\377\200\351\030\323"
+	.string	"\020\246\337K\253\246S\323_9\200!Ss\342A\212]\231\251\250U\202+@\374\366\333\177g\225m\273\020\3547\226/\314\214G\321\216\216\323\356\f\201C\033\3508\374\202<\355\377\034\b\366\240\013\366\330\265\361Q\261\001P!d\032\273.\315\270\021=\275\361\310\237\246O'\303%ox\225/\361\216\3251\263OP\362\263\247\253\rIJ/\032\313\267\273\253z\243\266\204w)94{JU}\214\024G\323\235\024\257\251\207\031!\313)\177\350\025\302\013\246\030\251\253D\273\365NE\233v\227D\300\007\236\232\237\032-9\025+\2574a\255Tx6\031Y\320@\001\003\356\305:q\225\274\270\t(%)\234\211k\205\033\021q\213\002\313\305\275Z-\027\247\262\355\265f\330\243\004\345\324\2422\263\274]\033\004N\267\035\2507\376\025E\207\232\213\2505\277\373(F\r\021zZ\362\215^>\342\361\315\"\036F\205F\0308"
+	.string	"H;BI\374\f\252\n'\037"
+	.ascii	"{\311\027\323\360R=\340\273\266va\f\013k\n\346\241\220\202\213"
+	.ascii	"S\003f!\t\026\343lu\031D\272a\327\210\b\263a\023a\210K\030\267"
+	.ascii	"\212A\317\313E\253E4H\351\251pp/\234\242\022\334\033\267?\020"
+	.ascii	"D\204A\007\315^\355|\002"
+	.text
+	.section	.gnu.lto_delayMicroseconds.92.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"5\t"
+	.string	"v\322@90\345(\035\200\213\367$.=\b\"T\323\242\003\326\007\037@\332lx\2021(\264\366\266\341\022\320\226K\316\370\273\216\203\313-\220RU\273\276\301D\035\366\255\375do)S\n."
+	.string	"/"
+	.string	"/"
+	.string	"\027\310\016\337\003\262Co\366\313;\215\275I\307\004\t\200\335\215\232\361\355\271\371\017\371\206c\241\236\031\203\335ur\254\212[o{\300v\201}\007\332\262\357\372\241\246_\2465\323\231\351k\b<\336\342\262K\021\013\2600\230\302\301\261\375\264\377q\220\355\256\bov/J^\273\235\307Qs\330\t\252O=+\226\324\253\352W*\252\213|\304(\376\206!\374\312s\207\276_\331a\352\306\002\352\025\264r\262\202Ie\314\356P\251\030\366\337\356\256\003\245SZ\364AP8H\210\246\321\202\0262E\007\206PC\024i\245\370\351\230\3640\322\242\211D\322\"\247\333\277\325\226A1\260\224\252\234\311\247v\351\224\347\334\221P\224\003\f"
+	.ascii	"{\311'c\232\200\032\006\316\0360\224T\346\300\264\253\300\200"
+	.ascii	"K\b\304j\n\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_delayMicroseconds_real.93.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\035\007"
+	.string	"\362\r24Po\322\001\214~l\252\213\001_xJrR\227\222\020\035\2636\212\326GD\022ce\022\021RF\353\035\227\007A\3150zhT4\025U\327\334\332\336[\246\024\"\211,\310\223\260\200\240\020\253P\003\365\251\"\204\303\347!\202(Q\364t:E\204\250XM\023\0259\332\375\356He\200\331,\334E_\246k'(\322XS\305e\303pW\253]\351:Z\277\377\257#\265\316\354|\004\231WR~\215\230\227o\020%\204\323\326\331\272d\021\313YE7?\207\311\311\257\0254\002\030v,\2201|\016\310\030\326jY\254}\334%\245\f\222\226\377\321y\330rZ\265G\274\301F\227Ss\360\277\211\2156\\\347\266\003m\r\332\202\004\t"
+	.string	"{\311'c\032\366\f\217\263\256`\336%"
+	.ascii	"b5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_delay.94.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\020\001\r\r"
+	.string	"\346\230YC"
+	.string	"\2216\035\273f\026l\273\332V0\323\313wF\305\377\252E\333\360\241\256\232\tW\227i*I-\036\255Mi20\211\363\0251\"\202\240\267\344+\250\300\0364\220\r\300w\006\2178?m\244\355-eJ\001E"
+	.string	"F"
+	.string	"C"
+	.ascii	"\367Z\3661+@/5v\367R\020\206\251=BM\315O\022\r\256\363<\302\352"
+	.ascii	"\203\"\202"
+	.string	"\243\373\300\017S\351\305E\317\f\335\226\260D\312\365\242C\023$\030\\\227\362\254\022\354\256\223\3536\334\324mG\260\215\300\276H\020`vQN6\366\213/F<\364\333\277\310\032\333\273\n\355!\f\337\023\r\026(\206Ei\327+\360\350\003\231G{\231\247}\024O\241\335\205\304\326\356\207\020.v=\003\2762\217\035\037@=\302\013\240\036\255\3312\002*\337\006ww\241\225U\214\223P6\247B\236s\200Q\207\317DaF\237NM\245m\341B\236\253\224\200\n\207oS\217\355yRY\354\177\264\230J\326\025\373.\277\365\320]iZ5\235\232\276\006\300\f\322\211\031\266\311:\2613\222\006\361`\340`A\203+\013\221\200m\262k\202\310f\344\002\301:\227G\2079\024B\260+\343p\260K\343\355u\305\017<|%\272EeQ\005$\2234\331RU\330\002t\243$O\256\364\232\252/'$\266<]9F\001\026"
+	.string	"{\311'\323\260\316&9\253H\236\016n"
+	.ascii	"&\263o\t\333\200,\222j\254(/\211Z\255[\002\321p\245\247\314A"
+	.ascii	"\273p\352\225@\\\334R\245j\031\250\227M\302|\002"
+	.text
+	.section	.gnu.lto_timeval_sub.95.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\263\003}\030"
+	.string	"v\255\233G\260\326M:\025\2348\216\246\345\337p\200\231\347\371\260\344\335\013\303\333\2311\t\360\303\377F\200\357_;{\314\371\377\024\353,\307\235\025\\\177\322\003\343\271s\276\2026{\374\356\243\214\002K\036\372\341\0335i\204\220$S\n\211"
+	.string	"t"
+	.string	"\212"
+	.string	"\205E\331\314r\262\230S\002\262\324\300O6!PQ8E\205\245$\306\235\001\177]\020\326\370\t \2139\247\022\nhHI\340l\335\344\0317\357~\374\022#\322T\216\030w\007J\013\375u\027\266\255\231\034\343\326Zy;\024FV\272\022\262\361$\306H\233y\006\364\3479\006\364\367\023\276\331{\336j\027\003\357*+k\310\b\310\336\221\0373\312y\263\030\243\245\234DF\270L\027\203\030cs\310h\204\373\271\355\203\266\023Z/\026@\371\244\326^<R\353ek\274\263\005\230\312\245q\r;\200i\330"
+	.ascii	"\374\344\3168\312\225\001\2631\231\205\311\354Kfe\231u\311l,"
+	.ascii	"\263-\231e\311,,\263+\231}}\331\320\313\272\236\005\237\3752"
+	.ascii	"\353e\366\231\315\314\232\200Y0qRq\201H\214\"\252L\211A\276\035"
+	.ascii	",Le?\331Q~\353\326SuUaT\265\202R2\242$"
+	.string	"\306\b!\364\255\206\262T\326-\311\234\345\337\020\241\255\225\277\016\273gC\267\204\363\241\263\362\002\033\314C\207\302\353\226r\001-'P<\327\303\273V \315]w\021V\017]\013\36047\022\241\255 \373\200\337\301[G\302\373w\027\020\241\255_\0359\212\256\201\277\367OK\007\003\227U\352\347\177W\371+\302\302\241[\302e\214\021\350Oj\336\317\340t\225\313(:$\344\001\030i\007\343\250%\250oP\370\020\306\030\275\342\007\364\347?\251\311\213\246\240\254\322\356\00289<;\236\313\307f\273\301\301\300\263\023\3728\204{8\200\340\311\261\201\305A\020\301\202\203\n\264\236\034\r\266\233\036\332\316\206\233\0164\034\033\017\r\301\2545\01796ZO\255f\243\301v\321G\252\f\023\017_)\230\222\244\205x\346D\256\362+IFS\n&\254\254m@\231\023\265\255\371,\350\270\306\274\346\206\371\313c\236ZB.\202\300|"
+	.string	"\326\313oE\005J\223\354W5$CK\\\036\273l\346.\377\250\304\356\243,\250\226\377\320y\360\241\245\310\220\241%,\207\275\345\001E\250Q,\346\0302\206\261\022Q\234\2024\215\001\220\242\221+\363\021\240\235T\314D\nKm\354{\356/A\210\032\3101_\337\227Jb\206\221M\263\237\234\321\3254\003\232\274\364\234\222]\371\007\374\206c@\0237+,\246:)\303\322j\226+\217\313/HNO\\\346\245N\274\031\035\177\002(J\300\236\373%\207\241F\210\220R\367n\005I\215I\342l\325}\334\032\255\375\243&\233\331\347Eg\341\370%\261S6\"?o"
+	.string	"\021\230\306v\363^\277\233\254"
+	.ascii	"Zg\223JE\333KZ\267%\370\017"
+	.text
+	.section	.gnu.lto_servoDevInit.101.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`C\001\265\016"
+	.string	"6\233cF\360\262&\035\262\202\245\307\357\271\330\335\364V\354\0357\nf\215'5\326\323\346\240 \0037\210\273ns\225\254\215\300\226\025B\223:\254SB\223\037#\350\3639\247;\365(\016\206\324\215Y\334R\377\031b\311&R\246\024O"
+	.string	"L"
+	.string	"N"
+	.string	"\336\361\360f\037\023\341A\307gw;\035a\356Zxk\t>j\232\240\237\363\f\361\302%\203\251Z\0365P\314\207\033\001T\0354Q\017\017\032\030U*\265\0233\327\267\2363b)\031L5\363\004=\330]\347\213\n\304\275\335v\212\355\021\373,\001\232>\210B\n\231\032\037\322kWf\006dm\304\030&\316\272\375\320o9\344\005\f\300\263V\270\305\001\301b4<\273a\202G;\340\036\037\262\375\264\257\342+\300\263\330p\001\27365vvC\005\356\270G\207'\260=r\037\260=\032t9h\270\324\244r\346\337\333l\224\277\274\002\rl\263\334\005\206\020\034\273+jq\035\223_\342\321\031T\362/\217\276\312\366x\340\246\007*gN\275\276u\004(b.\331+\b*g\252\257\230\037\030\252+;lIQ\217\013\216\325\306>\213ug\032F\025J$"
+	.string	"NH\026J\036\004/\345\033\231B6\021\2110\201DBw\032\235|%\247\256D*A\351L>S'b\300\336\205\321\327\235<\357\353B\341>\347#2v~xP\232\212\272r\bL7\215$\3220\351\303\245\203C\376\270\266\273\253\351\352+[\352\246\367\t\034"
+	.ascii	"\200X{\311\027\323\020\232\253\266v\211\205\274\214\276\253q"
+	.ascii	"\322\022\013\364x\035\306\021\033s`\232\002\233\006aZ\202v[\342"
+	.ascii	"sX\341tq\306\305hV\247\203vqXD\331\253\253f\364\f/(\312\257k"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_motorPwmDevice.102.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \346\205\005"
+	.string	"D\t\254"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\327\005\177}\270\336\267\007\177{\370\335\327\005yw\270\335\247\005us\370\334\207\007qo\270\334\307\005\177m\370\327\267\005qk\270\327\267\tig\330\326\007ec"
+	.string	"\005\001?\202\210\200\310\001a_\303\001]\302\001[\301\001Y\300\001W\277\001U\276\001S\275\001Q\274\001O\273\bMK\304\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/target/SITL.c"
+	.string	"\013"
+	.ascii	"y\311\222\242\232\006\017\202\007\301\203\340A\360 x0\346\203"
+	.ascii	"g\276\212\0018"
+	.text
+	.section	.gnu.lto_pwmGetMotors.103.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \370\315\006"
+	.string	"\362\314/5@o\222\016\230\216R#\201\202]\222A\305*w\351\0344\361\234\001\266\251\376\177\177\312\325T\024pf?\256\376K&\214\256\341\0303\351#J\244\035M,!2\005w\250\204\005\004\005xy\030,\316\005\037\0328\016\260cE@js\005\341\261\340UU\026\324\304\254+=\t\226\311\0245\273#\215\022\267\243\357\t\2545\353\273\330\324\267\0219\212\217\241\3460\276\230\314\314]\351\233\001GUX2-^\\2\345\235x\374\237\327\\\220\206|\006\021D\rR\200\311FEIKf\204\307\016L}\231\nL}.\243\2406\320\255H1\037+(\331(\324\006p\220\231\267lD\352\256\177\301O\375\027\001\b"
+	.ascii	"{\311'\323\342\255\243c\205P\346\032\242\205\310\304]1\265\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_pwmConvertFromExternal.104.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\265\007"
+	.string	"\242\017760q\222\016 \224ZF\0169\034\037,4\235\233ZasyXe\350\325\331\332]eh\323\362}\037\232]\t\305\202:\302\240\nZ\360\tA\035\327\243\265\255\021\"SYE\bs\ba\"-\333,\262\200A\237\205\006\005\206\270e\017\032\266E\021\004&\021A\032E\374\\\217&2-n\243\221\026=\377]\266J\210\032^%\210q\341\203\315\240)\275\324w\244\007=\276Uf\346\020\365\360\375\332\265\255\nhd\"j27R7\031c\275\214\374\334{\376\367\276(M\341\332]lev\300\270dv\007G\200Z\002\357\277&=\341\276\245\352@B:,\"\032+6\231\031\257\022pjU\035\340\324\202\037\345\372\270[\225V%3)\323\211\324\327I\310\314\237\351\304\321a\177\203\037\341'\t\b"
+	.ascii	"|e\301\2319U\260\227\256\321\034\230 \340\304\223j\305$L2"
+	.text
+	.section	.gnu.lto_pwmConvertToExternal.105.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\235\007"
+	.string	"\322\01655PU\322\001 F\247\366\250)*1\3243\210\331\223\004\357\314?\272\331@\267\206X\036b\353M\375\201\264\212\220\273h\255\buu\3724\252\352\244\375\215\020)S\n\030\006\305\005\001_\366D\037\207@\r\017\f\016.\303\"\340\225\271\n\211K\344B\360\302\201,?\013\f\272\354=\350\034\367z\262Z$\315\3605\365\0322\244\334\261\343(\365\303>\265\273k=9\037\377S\00795\0233\273\034;:KS\275\214\330\326\354\001\333\231\366S\256\242=\272\305\002\27301.\273\233`\027\360\312\242l\373'G\321\274e\f\351\370\210\230l\260\340\354FGp\003\317\253|\201\347\225\202|{n\376WN\225\334\330\224L\243'\300\302\356:K&\217[o\033\301\266\202m\222\n"
+	.ascii	"z\345+\203\035E\r\361T`\\F\2314F\007&\b8a\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_pwmDisableMotors.106.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \376\355\006"
+	.string	"\302L06@o\222\016xa\342u\034\336\364u\353\356\217m\216\275\037\253n\344\234\347\200\346\333\315\347v7\025\2058\267\257\371\266\233\273\035\270\364\030!=\2216fM\006!2\005w\252\204\005\004\205\210y\030.\016\026!\0328\017\261sI\304j`+\302sE\314\262\256\2701e\337\006O$\230\026\321\263\370~2?\321\322G`%3\013nIM(\356G\341\025 W\255\360\2022\205\006\"\233\006\311\213\310\245\336\024r\217\343\013\220o\373\327\023\t\345\342\200\222\211\221\212I\025\230\022\362ws\366,5y\244\006\244tq\202\312\314\370:\232\325e\267#\r\320F\241:\315Af\356\264QF\177\375\t\376\352\337\b\t"
+	.string	"{\3117c\361\2063^\307\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmEnableMotors.107.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"]\007"
+	.string	"\202\21537@s\322\0018V\206\325\222\375e}6\363Z\202\023{U\252\367\b\364\226\331\004[\263\314\277\201\334\231\270T\2138\376\266[\222 z\336\241n\257\311\273#d\223\275S\n\3362\005\206\204\005\331q\032\246\326I\b\007\255#\267)!\263"
+	.string	"s\021\234);\216\233\022\253\373ja\311\365\235\023\206\315L\bZ\370\247\226=\361\024\n"
+	.string	"\263\273\006\376\311Q(|\221GWx\336E\217\276\307z<0\221p\230\324\204^\312\256\240\007?\354W\013K6\374I\003E\363 \263;J\335\254Kl\031\261\375\2611\023\024|L_CFW\006\313\205\nj\267J\br\372G\375\227\\\300\024\343\361\262B\002\375]\b\273\353'\"m\334\360\266\007lg\266;\002\t"
+	.ascii	"{\345c\230i\223\331\004p\260\30651/\0023!r\270s\257v>\001"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.108.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"=\013"
+	.string	"\306VO>\020Q\225\016K\225\r)\372\"\304\0350\017>\313k\340\002\204\377\3619\221\002i8\024\267\221EOz\177id\004y\bK\204\036\206\004\221\202s\236i\244\b\266\3068=\215\004m\"eJ\001;"
+	.string	";"
+	.string	"<"
+	.string	"\320\231\266\201J\367\224\005\353\256\006\025\252\335o\342\230\035\272\263Y\377N\213upA2acw\243rx\367\354\374\2178\304+\201\236X\202\335uz%\f\267\336v\001\333\b\3543\b\317\376\375\330\225\206\231\2764\255\232\316+}"
+	.string	"\004R022v/\264p\354\n\262\360`\373\021\333\232\366C\\D\367\317+\f\331m1C\265\273\023W\262C\311\007<\016\257\013x<\333\346\325P\205\232\035\243\027\231^\372\016R\216TLU?\372 \312\226\257\251\037\3218\211\227\330\370(s<y\357\320\367<\016\257X\f\326\215\f\241l\331\037(u\203\375k\325d?\365\232g\202\345\003+h\0204\030\350\013e\201\003\005\rbG\213\300Y:Q\203\261d\342\205\343D\212\304\033\005\215\213\235m\343b\344\333\253\311\017@\254B*2T\333\237\247\330\0048\355\356\001\377\304QH\360Q\207\316\004\017"
+	.ascii	"{\311'c1\347\315(.<\344\215\202a`\374\305\270\256\214\261\250"
+	.ascii	"\366\\\310\215g\026\020*\314\001wy\321N2"
+	.text
+	.section	.gnu.lto_pwmWriteMotorInt.109.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"u\f"
+	.string	"\026\031WA\020s\223\016KG\3708\201xb!\216\334\373a\247\202\213\212L\320\204\317J\205'A]mk\020_\027\201\005\376Q\r7$\301\005\204\215\230 \022jR~\f\203\005A\250\0312\b!+\255\224)\005B"
+	.string	"A"
+	.string	"D"
+	.string	"'\340\256\370\001\356jD[\301\210\366\026\016\316\335\0204l\354n\t\374\250\2535\233\364me'\023=R\\"
+	.string	"\331\335\227%\256\0355\377.\257D*\035\216S\203\3355\212T>\334y\333\007l3\260\017\n\256\024M)zrh\367\226?\363\355OD\243\242o\025\300\261\243Sc\327CI\310\302\350\215\023\266\357\267\370\b\345,,!&\305\356ZW\033\305\266\256\267\354\253\370\n\355\233\006\353\256\b\322\bu\025\020\242\037TV\2111!\035S>\251|\b\005\bKv9\345\377\34208>\213\261\023\274\350\352\237\270\253\313\217\216\200\007)\b\210Lb>eH\346\023"
+	.string	"\351%\344\343\203%{\003a\222\260\237\331\335u\216\260\035\006\327\005\n\032\f\232\341\232\320\331\250ID\036Dp"
+	.string	"\341y\256\222L\343y\235\215\206\363H2\013O\304\200\261\nW\366<\030\226=k\373\334\345T\216\027\230O\202\\\345G\366\206\317\340\004X\331\335\005~\214\313(\361Y\256\336\230\230\270\353\003\022"
+	.string	"{\311'\323\"\f\357,,\332\026J\021\271\231`\034\330"
+	.ascii	" $q\261\r\246\335\305e\f\240!\246p.SMM),\340Z^\b\223\f"
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.110.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \376\345\006"
+	.string	"\302\f06@o\222\016x\215\f\207\321)\257.\236[+AW\241\375H_\274\357:\240\371v\363\271\335ME\013\316\355k\276\355\346n\007.=FHO\244\215Y#\237\020\231\002w*\004\205\203\204\210y\026.\016\026?\f\234\206\330\271\036b%\260\345\340\271\"fYW\334l\331W\202\247tQ\031\275\211/(\363\020\035\001\005\234d&\301\r\251H\304\345(\\\"\344\252\025\336P\246\260\340\303tab\031\271\324o\"\3672\276\230|\245\177=%j\345\323\222Y\221zI\023X\342\361ws\366)\3356R\323\201BA\202\312\314\3704\232\325e\267 \005\320H\242:\215Af\3564\222E\177\375\007\376\352\307\b\t"
+	.string	"{\3117c\361\2063^\307\027\272\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.111.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\256\003U\026"
+	.string	"\346'\211I\300\224Q:\271{\350%\241\212(;\360\352\244ww$\260J\217\353\177\352\264\377\022\312 \233\345~\265Z\213\377\266 \210\261\355\204\027\326\227\031\024Xn\263\b\246A\256_\006\356\335\354\207\313\210\\lf\355\177\322\310\336R\312\024r"
+	.string	"g"
+	.string	"{"
+	.ascii	"\323\027CuT\177\325\235\247\2564\264\206Mu\016\244\255+!\300"
+	.ascii	"gD0\251\273Ut~\024u\276\247\001B\235\242\272B\235\267\375I\264"
+	.ascii	"\327\242M0\2005<L\272{d\026j\323pJ^\333\025\305\273i(\242\320"
+	.ascii	")\021\334\250Pb\361B\310\327\220_\215n\345\te\026/'_\335\255"
+	.ascii	";\2726<\232]\023Kw\177w<\023z\223\376\227\375o\360\3130>\334"
+	.ascii	"\006%\343lw\337\230o\016\"T\326`\003In\201?\355\253u\026\376"
+	.ascii	"23\253;e\335Q\025A\304\373\345\370\366\367n\3138\277\312\346"
+	.ascii	"\233_u\364\256\271o\311}\n\357Qx\177\262{\226\334\257x\257\342"
+	.ascii	"}j\367(\271?\361^\344\275i\367\241\334O\336K\336\363\356W\367"
+	.ascii	"j\340\300\f\243YQ7\211`\223\376\005DXJ\276\025\013\t\t\242\342"
+	.ascii	"U\212U(N\375P A\253\017\nu\242\370t\344\223sb\037\220\017\221"
+	.ascii	"O&\026C6-P\036;B%\337\344\377+\252\343=\006 \375\202\346\300"
+	.ascii	"\260B\352n\006?\212#\003,\026\013u\362\320n\211\344\311Z"
+	.string	"\263\344bf\311\252\023\242\331\340\227\231g\220.\t\267A\005\332#\023\273\333\301\365\206\362\274\\_\350<L\314\274\306\204:\227OG=9\001\262\r\260XK\355\303L|l%\002\205\007-cM\366B\203\325\306\01600\016c\21463\256\274>\363 \243\215\265\331\2146\246z\255\262YpL\023\276\300\376\020$\254\356\316|S\340\212\340\317d\234\253\013%)\270%S\264\264\007R\340\017 \327\215K\340b\033\025m\021X\355\351\021\027\261\033\247\273k\02152\241\305eu\347R\301\302\352\256\305*\"\031)l\364+B\341\224\023Fa\361\311PJ\250a8\306\021\n\204DFd\302\024\244 \307\300\002\221\221\272y\021\020\2653\314\244\300\350\236\001;\225dQ&b\214\337\304dl\302A\2069\241]\023]p\004\230\002`Kt(\275\317\272fA\367\332\203ln\357;U\221\244\221\202\265(Ou\201\222\334"
+	.ascii	"-ma\216N%e\211&\224>\032\256\225\2007BB\361]\343\211\365V\364"
+	.ascii	"zM\245\215\005\302m\371\207\340\031\321\3376\344\227\224\357"
+	.ascii	"1\341\300\365\263\371qT\374`\217\265l\250\310<G\265\263\200\337"
+	.ascii	"]K\201&=v[xU\245\344\325\315\240T"
+	.text
+	.section	.gnu.lto_pwmWriteServo.112.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"\305\t"
+	.string	"\326\223E;0\345(\035\336\363\370\334\260\346\204\210\340~\314!J\214\205D\217\373\347\203\034\n\221\016\333\360,\300~\350\240\364Ql\246A\222\bEsd=\257\035\264\236\310F\341\333\376&[\246\0242"
+	.string	"4"
+	.string	"3"
+	.string	"\031\216\273\036\260\331n\b\362\344\\\372\263c\036\276\366\262\017V\f\300\356\316\030\362\357\372\371?y\007l\251\256\033\205\335\265\202\255\216;\336v\201m\004\373\235\252\352o\246\310ab\273\0345\001K\223+$\266\357\261\035\325~\311M\276\207\226\271\263\333\3422\333]\220E\234\313\317\t4\227\333\0074\227V\265\rD\337a\001\273\007>\312S*\374\221K\237Rz\360\322Oi.\017\312lQ\243\316l\274\304\370\230\020@\2055`\2455;Ti\004\261\277mt\331\017\377\355\260?n\352\\Jbd!/8\bSI\232\024bpXh\230(.\302\033\241\246\2514\232\230$\3574C\037w\024\2347Q]\347MO\270\3376\272\374\300B[E\rk\264\215\361X'\360\332\013"
+	.ascii	"{\311'c\272\201\032\036\234\301\027\343`\332\345\032.\230\205"
+	.ascii	"\202Pa\"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.113.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`_\001%\017"
+	.string	"\026\\fF"
+	.string	"\221(\035\3144^UkZ\024[#:\246>!u\024\307\224\243\222\235*\270i\223\247\315gs\375\243\376\266"
+	.string	"T;PI\373\362\235\fZ\3571\025\016\345A\360\0366\304\277\327\177\234U\264\227hB\b\331R\246\024P"
+	.string	"R"
+	.string	"P"
+	.string	"\005\374u\327l\373$\016\203rJ\300\350\201\305s\241P91\233s\374<>\300v\255;\200\355\332vHi\352r5\345{/\325e\227\341+\017\320\330P\002\344\265\222\035\027\f\330c\327\225\027K\225\373\3149\255\255\027\313\255\335\266\002\333$\366C\004\217\371;\251\346.\363\313\317\374k\265r\352\177|\3078\253\201\201\305\234\256\034\035\363\205\266\002\204m\224\335\261iJ\037\007\264\310`Z<0\200"
+	.string	"\365\231\323=seS\303@\216\207\241.\203\242\236\311Z\265$\350\256y\324\252\217\271\360\2209]f\2629\307!\221\276\345}X\253\362.\267V\025\234\257_\363\024\024\374\017\036\211\372\3265_\334\256\275eC\356wo\314X\311\210\341\244hN\f\021\032d\273/\226?m\273\217=\304\304\r\354\306\306\005Kq\330\243J\367%\307l\004\007\257\213m\265w\232\337##\013#& (D)\205\022\300\322\t\304\024\236<\260tr\032\001OLD$^H4!\024\027\220D\2238\352\030$\342 B\003\b\237\t\f\221JL_(*\031} R\351\023!`\261\002H\372L\242H\372:\343\274\334OE,\246~j\323]Y\177Rv%?\224[;\035"
+	.ascii	"\353\314c\257$\036c\033\214\360\231\300Y/\245\314\326\301\366"
+	.ascii	"\212\321I\027\3663\324:2\227B\212\374\334\330\346\232\021\216"
+	.ascii	"\b#7\001\202\222\340\n\237$a.\t\301\202\360\231\032\205cFh\256"
+	.ascii	"\370\351bSB\323\030\024\024"
+	.text
+	.section	.gnu.lto_adcGetChannel.114.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375 \373\355\006"
+	.string	"\362L05@O\223\016P\260\230g<\216;\365\344\376\366\252\377\004\350$r\034'\034\354\033\267\333[\315\300q\353I\004X70\375\301a\033~\372\003TJ\377\255\375\204\310\024\020\326uQ\016\225\346\312\243\300\220\260\0205\253!\243\264x=P\021\261\312&\242\2473&aeQ\303\260,r\272,7u*\240\305w\237\007=\276\231\204\035\377\"L[R21F1\311\"\255\204\374\333s~\370\276\300`k\t\3050\223\003E%\263#8n*\375w\244$\333\334\353@2&\221\313\305\311Kf\027\001*0Uz\r\230*\301\217r}\334\255I3\"#\021(\364\351\323 d\346\017\024\322\350\260\377\300\177\360o\004\t"
+	.ascii	"{\311'\323\"\030>*\354U\001\271\206#\230`\211\2510\246k\222\001"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.118.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"\205\f"
+	.string	"\206\226VE\360\2624\035\262\bF\207\353\310\265\370q\225\225\324\025\3767\226)\204\243\226\022\313`\254\006'\351\262\337\030\271|\266\353\251I\356\266]m\320 ]\222N\223\263\026=a\332{12D\235\271\260\325f\335\210\224)\005B"
+	.string	">"
+	.string	"C"
+	.string	";`\205\f*F\317\356F5q\323\255J\323\344\207\276\356\026h\346\225\002\032\031'\0333\276\231kE"
+	.string	"\365\003E\200\017\246*\320\323\355\034\347)\363\2352?\"\273\353\364>\021\367u\333\021lC\260?\n\277q\207\226\274w\313o\271n]\217\363\003$R*jth^2\264\301.\265\204}\r\3030\264\332\330O\347\323\377\030\360P#\347<h\354\202\b},\217\265\223\302\366E6\3319\016\236\bi\237\240\250v\277\341b\207\216\n$S\261\013\270\022\3749Om\347\251\271\331\215\271\247\001\024\023\021\334\262Y6\344=c(\355^pH\325/\305\"G\200\037B\250]\256\253\005\0308`\262\207}\235\267pq\016eY\311\003lA\bva$e\343V4\r\243\200B\3322\250\224Th@\302 \033\231\020b\322(\223\340\200$\2264\f\234I)\252\234\230\244D\022\307\022G\230\267\025\215\213\245m\343\242\b\334\253\215E^\364\364jw\327\002\020\025"
+	.ascii	"{\3117\323b\2353pW\200\025\240\272t\265\006H\031\027\256\200"
+	.ascii	"&@\334\257F\001+$\342\026\033\002\264\313(/C\214Kw\263i\251\220"
+	.ascii	"(j\025\024"
+	.text
+	.section	.gnu.lto_FLASH_Lock.119.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\227\001%\020"
+	.string	"\346\034kI\320\262*\035\320\0321i\243\332\023\220=\210\251o\2277\361m\262~U\315\232=\217\230}\r\270q\270Mu\343\310\204\274\260\225\004\031\314\2400(\032\251%5^\211e\344j\314\340\200\274\306\227R\311\"\215\r1\262\211\334)\005V"
+	.string	"Q"
+	.string	"U"
+	.string	"\265\357\370Q\253\210\037\037\265\207\362\244\260\375\220]\266\216\333h\352\001\025\270\227\026>\265VpQ\334u\352\355t\371\3179\200RF\236\202`\356\205\310`\276\036\001\032.'@\006\363\032\344nH<\347\023\204\314eN\220\007\265V\317R6\342\376n\233\202\355\223\375\032\001=2%\276\311\340\276i|_{C\207\371\322\"7\232n\247\213-9s7\264\030\353\226\357{\262s\0036{\330\327\371\212\026\277\306\036X\346\313S\237\345;\375R\0237\034\031\235\331k\376\3306r\356\t\373^\335\031\373\323\336\247\367\323\027Q\020\302'\240\030\311\350\364\265\363X\210\275\274"
+	.ascii	"\212\201\243S\273\304$\306f\247\373\260\244\317\3420N\263\034"
+	.ascii	"8<\006LomT\n\266$\316\301\f\307.\300\334\235\265\3363\276\037"
+	.ascii	"\345{\355/\304\0024\265\276^\372\267\273P\3715\247N\021\305\357"
+	.ascii	"\324\0365\210^\226\334\331\375-VQ\235\220\304q\265\022\206!\207"
+	.ascii	"\214X\013F\242\f!\007\024Kd\222\222\032K\030\"\230 \224FJ\020"
+	.ascii	"8E*\235HL`+DY\241Z\240\212\n%\202\251\025\013$\211<\256\204+"
+	.ascii	"\2605\216+0d\253\337\031\217\304\350v\272\327\272\320\004\323"
+	.ascii	"\2260aO\303\345l<\003\363\265\3130\221lT\b# `\2021d\311\003{"
+	.ascii	"\362\311-V\314\031(\034\\\366\002\273\214\327\275+\021\"\307"
+	.ascii	"|I\300\254Bv\234\2009\362\203[\004\321\034\204\340\274\240E#"
+	.ascii	"\tk\345\217G\274\225\bl\2337\342\315-U\024W\332\n\320\f\267\252"
+	.ascii	"\341\217\343\316\244[\333iAR\243\205P"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.120.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`7\002\345\022"
+	.string	"\366\343}H\340\322&\035R\035\243`\213\377\tt\222\250\316\231\341)\272\266\216u\024oIHa\307&\354\346\"7\270\370CmQ\233=|\260\230x\205\337s8,;\327\205G.\271\fW~\241\350\f\034X\211\022VB\366\336R&\031i"
+	.string	"d"
+	.string	"j"
+	.ascii	"20\360\244G\007\r\013 \335\341Wr\002\3632~\300\274d\022\352\365"
+	.ascii	"cx\355\366u\257\2332\362\276\364?o\020\263!\222\2010\367\242"
+	.ascii	"\004\246\243#u\b\021\027\360\310F\334\366\255\001c\333\005\350"
+	.ascii	"\271\371\004q)\263q\004\234\211%\335}\002c\226o\273\304\231\025"
+	.ascii	"\311\300\233o\207\322\335\2722\320\303\025\300U\025GUQT7%LS\r"
+	.ascii	"aV\332\360pP\316Q==\374\275\327\256\222Wc\\e^]^\275\bI\220\322"
+	.ascii	"\320\321gD\3356\271\2466\2222J\274v\325\257\320\333j.\001\215"
+	.ascii	"\324\007M\364(-u\207\007.U\201wy\325\027\325\223\252\356\252"
+	.ascii	"\336\347*^\036\272N\322\235C\003Fw\210@?\357RC\357(\236\342E"
+	.ascii	"_)\001\033V#\267\035\275\313\274,p\363!\231\271K\232\361P\035"
+	.ascii	"b\343\203\217\\\336\0375\034C.\007\322\021\372\213\325g\334\272"
+	.ascii	"\373\344\322\305v_k\314\313\345\311\364\0139\241\323\024\231"
+	.ascii	"\246\222\317\254\332\215\230\305\251\276E\213\201[7\3542=\320"
+	.ascii	"\2034\350w.\265\325\262\227]\352[\346\345\371\266?H\232\345\240"
+	.ascii	"\031\002\333\034\343\226b\004\341\254T\n\025[-\025+\225bPA\265"
+	.ascii	"\202\212 \242*&\020(8\230\360\261\250VX(\226\017\203\005\324"
+	.ascii	"\205O\205\325\372LJt\225A\305\372XV+\326w\n\373\234\023\377\232"
+	.ascii	"\3779\211QR\017#\030\307<\246i\002\241yb)\264\036K\256\211\274"
+	.ascii	"8\257\357\232\036G\356v<vwwwM\311'^\211\315\212fD\3046\267\270"
+	.ascii	"\311\264\334WSO\024+ \240\202\231\262\333;\363\005\f\213\353"
+	.ascii	"AG\253\256J\203\030\271\301\270c\2600\341\001\332P\336,|\266"
+	.ascii	"\002\005\301\036\313\3021\005\212\314\207zV\221\366Z,\244\374"
+	.ascii	"\t\2230\242\343\330\340(M\234\234h\007\364a\354\013\336E\340"
+	.ascii	"ct\333\255Z\317\273;\304,$\346\365\257&R\214\202\036\326\366"
+	.ascii	"MB~\002"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.121.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\b\003\365\026"
+	.string	"&\352\226G\300\030Q:`1+:\373\240\236PL\244\300g\024\fq\037!\241Q\034:\031\236\241h\n\353\311\216\372v\371j^XpQMP\376\b\262L\341YF;q\004\3010c\\: \263\r\236\273\265Ob\367\336R&\031\200"
+	.string	"t"
+	.string	"\213"
+	.string	"\037\022t\\\212\023\250\365\250\n\223Zq\016V\345}.\316\333\335\375\217\003\t\332\327\005Y\354v\223\204\206\246+S+N\005\376"
+	.string	"\375\224/@?\273\306_\377\274\023\235\262\371\265G\335`\377\270\350^\315i\245\324B\214\321\020\321\351{(\261\020c4T\3649\223\261\004k\255\251\333\nny\300\266\243\026\340F\223\r\3024\031\363\334Y\350\246\202\371D\241\326\272\\\273\r}Q\337\335\241\335E\332e]\024\312Y\212\314\226\324\215\264_\277G\344\260\254\3403\2737\"*h\2525\366\332^\367\"%\366:>wG\344\327>\367\"\375|?w\013[l`hib\274\333\305\301.k#\355^\326>\332\375\322\237:\356\377\226\227\236x'\345\225\223\267%/K\336\017\300Q\232\221@W\253m\207\2462M'<v7h7\265\273\315_\002\332\257V#3\021\230w/$\036\274\331+\370\365\354\023\r\"2\2644\374$\210\217\033\247TG\371`"
+	.ascii	"\2047\013I\0201\315\032\266\251\006\320\364S\2443##\306;J\200"
+	.ascii	"\273O\344ND \260Q\353\354\265\320\233I`\220\303\342&.7&Y\303"
+	.ascii	"\026\212\026\032^\246\200\335n\267;\020\225=\346\272,\371\001"
+	.ascii	"\362t\354}\350\247\354\177\021\212\361u\367i\213\215\314>\307"
+	.ascii	"\222\221)\222\233\271\344\262(i\235\210\215#O\242\363%M\265\326"
+	.ascii	"\233O$\\\353\327\n\375\344\016\213\252a\265x\302\021$!\202.\037"
+	.ascii	"\321fQ?7\020l\300\t\n\026U\263b\365\204#\013t\211<`\217\016x"
+	.ascii	"\302&\304j\024=\354\204cK\0345\210\270\260\241B\006\034\020\013"
+	.ascii	"X>&B\024s\\\255B\2719\0172p\300\260A\345b\265\306\320\245\342"
+	.ascii	"\321\twT9c\217\352\001\270\342\t\326\250r\211\342\250J\341\352"
+	.ascii	"e\355\243\r0Sr\341\311\277\350s\307I\2021\371/J[hwi/\205X\253"
+	.ascii	"\370\032\351\215c\306\225\027\336\244\322!9 \240\242\241\311"
+	.ascii	"\036B\224cJ\024\334\235\317\202\246\211B\373\242\271\343\007"
+	.ascii	"k\362\302\342\311Y\r\033\263\034\372\244D%\266\2150y\266\023"
+	.ascii	"\177\030\2761@VKn+\303}\211\335-\234\363O6\0046\343\007\301\036"
+	.ascii	"\313\302\361\002\305\347\303\237E\305>\213\205\312G\230\344\220"
+	.ascii	"\004\371\021\273\017\223\333\007d8\234\304|3WP\370\334-\224\r"
+	.ascii	"\366\242\261K\246s\027,>\311\320\272\216\0259\337\305f\005\035"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_uartPinConfigure.122.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\265\b"
+	.string	"F\020>;0\3456\035\2003\026\013\310\317\032\325\320\201n\206\375\242Er\376\220Vm@\340=\314T\251\001\332\325\2474m\233\255D\261\253\374\340gp\2153\006\n\305\3209\236\233!q\357\224\002)"
+	.string	"-"
+	.string	"-"
+	.string	"\267\f\3320\257\245M@!\001Y\211\331\335)M\016>\202\376Q\037\bG\241G\001\316\356:\206#\221[\336\366\202\355\t\333\246\222dK\202\325\313\350#\253\335\220"
+	.string	""
+	.string	"6e\265\234dl?\3327\375\004>\205\343\232]\222\013\313nu\360\304n\271\036\341\272\205\375\340\n{I2\246B\245:\244\207\257\370z\225\257\240\264+z\230\201\2118\f\267l\215\215\370\320\r\252S\352C\206\354\032\212\262\304~\300\356\256\003\326\350\347\321\354\323|\266\n\256{\3406\t\213l\243Z\007d`\317&\202\002\2423=\355C3or[v1=\024cn\024\334\2014:\275\256\2433S\003\n"
+	.ascii	"\305,c/Idlc\360\270\300\205-0\344\022l\263\232\002\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_spektrumBind.123.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"\235\b"
+	.string	"6\320=9@s\322\001\030L\200\210\255\274\234\006\177\234\263$\357\253\227\3443\314EZ~F\003\312\2077\271\305Rk\262E\332\022\301\265\3626Ic\313C\372\025\033~\206\223A\244\355\235R*"
+	.string	"-"
+	.string	"."
+	.string	"\307\f\3326\257\253EXA\021y\271\331\335)O\016>\202\376[\017\bS\247G\200\207\335u\fS$\267\274m\005\333\022\266Y\001ReK\201\232\224\324KdvGrp\326\205\305\250xl?\332g\235\005|\213\307\013vU-\230\335\332\340\251\035s\375AvL\273A\026\235\225*k/\032\327\207\004q\026_\357b\"X\355\242\036jh(\207\205c6GG|h\206\327\214+D\236\354z\212\322\304~gw\327\001\276\3508\210\221\211~\031\033\2514 \3420:/b\203j\016}(,&*\346\267\211(\350\233\035\007\032\315\020-\315O\202=\322F\347\347ytz\352>\t"
+	.string	"{\311'c\032\370\f\007\316B\201y\227"
+	.ascii	"\232\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.part.0.171.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\302"
+	.string	"\315\n"
+	.string	"\326\022E= \345*\035\3408\002\277\210\200\327\020\247:\321EQ\270\024\2002\177s\2210\362\345\247Tj\037S\250\240\244\264r\323\003\r`\370\254\f`\"\246\367\205\004 \362 \003\375\021K6\331;\2450"
+	.string	"4"
+	.string	"5"
+	.string	"\2477\261\255zY\264k>\212\354&& \243\026`w\353\351\f\271\370)9\321_}r8:.\007\316m@\273k\317\343\246\267\275`\233\301\376C\273q\033\260\037\024\206\344\262\333\227\251\374\231;\243J\036\214\033{}t\347\324(O\021\257\342\227o\353e`\323\270\001\330]\205SW\357\324\343\013\272S\357\004]&\017\r\313[J\237\311\324\235\236v[\312\333e\325\276r\362GN\215J\311\273N\375\224\305\205\274\313\237\235#S2\323\232+9a\236\334\271\235 \366\364$\234l\244\t\321(\024\242>\317\243\217\003DC\250\206\244\bP\024V\n\tQ\251\216\300S\375 \370\253 \2015\374>\260vl\313\203X\023cN\230m\216\024\270c\272\323\356\022\034"
+	.string	"\177\311\017s\023\213 \266@\314\2010\220\t\030\330Q\371\r5fe\332\002O\0012\227\271WcWg\255\2241\320\342\250UJ\021X\301L\242\352\242sA\233.;\027"
+	.ascii	"N<\220\243\245\351'\2241"
+	.text
+	.section	.gnu.lto_motorPwmDevInit.part.0.179.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`;\003\335\027"
+	.string	"\226j\226I\260RRcr\235\037\3537\301\250\352\373w~\033 8\214\236\007\210_I\333\2002\273\263n^w\221\263J\\VbyZ1 \276\214/\004^\2760\346\317\307\301\337\004,\036\037\337~\311\217k\302\347\254n\331\226[\312\224\002~"
+	.string	"\201"
+	.string	"{"
+	.ascii	")*\275\363\372\374x\244v\212\212\357K7'\27194\244\252\356=\021"
+	.ascii	"\334\272\204\335\332O\352\375\274\304\211>\377\006\234C\034b"
+	.ascii	">Q;O^\367\236\345\255\317\233\220\267\260\227\220\267u\204\307"
+	.ascii	"\217\347]\351\357v\254\224\374\371\224'\210s{\252\217G?b\360"
+	.ascii	"\004=|\034C\270\214B\210\004u\306\004@E\256c\235\366\004\201"
+	.ascii	"\264\306\212:\234\226\234\004a\271\367\032\366\341\006\271m\033"
+	.ascii	"\333\026\354\372\022\367\372|\365\270A\326\212\304\257~\247?"
+	.ascii	"\352/~\264\357\2478\n\037\313\262\253\236\177\252\256\302w+\257"
+	.ascii	"\230\351\2347\270\342C\006\321\353\336K\001v;\033_B2\335g\352"
+	.ascii	"\371O\227:\225e\305)\334xA\\\307I\324\232\302\3754 \254\"jA\200"
+	.ascii	"E\365\016\245\233\331{\203F\023?\341;\224\216\222\\\235\034\241"
+	.ascii	"\003\330-\tuz\023o\2063trkK\337\304{\200{\207^\f`>[vK\177:\256"
+	.ascii	"8\310\223\253 QZ_{\\_\351\216\246-\035\312\303\265\216\025\344"
+	.ascii	"\305\316\217\361\336{k\025\262}\340\257\264\222Y>ll\020\346\320"
+	.ascii	"/\3778\322\236y\013\\\001\005\2665\\\2536r\343\336\273 \353,"
+	.ascii	".\370D\267\256\271\321\363\334\3727\362\366X\247E\245.!\261\013"
+	.ascii	"H\277\\_\201\212\\E\264\n\271\222u"
+	.string	"\310e\004T\345:\264MmG\352\361\347_\351\257\356\207\2249F\204\001\031L\031[K\r\006\027\031\223f\273\321\331^L\035O\304\324\321\360\\L\032\231\032Ll\246V\301&\333\331x\267\006\271\333\356V\0233\r\345\201\204\226\b\345\316\234\311\305\354J[-\246\246\244\345t%\312\3147\0333W\356n\267\\){\035\372T\0270\332\374\021X\"\022\022\357\005\236\307\332j\026`\315\261\236\360\0324V\226\206.n\303|\006N\006\200\235\256\243j\307\034\306\215\311\267\376\202f\376~T\247HJ=\204I\"\200\364k\254B\001H\250\201<\204\220B\306\220\004\"#\001iR\035P\002Q\312\254\035\020X\3118i\rRmrb\367\300\013\n\320\255\004\226v\324\350\211aR\220\370h\364\003h\234\261\323\340\210\223>1.\332Z\316\206\206\177\245\230Y \205\315\231\300\226a\256\234\323 \373\003\r\033ew\265\034B"
+	.ascii	"\034<\374\212:X\222\344 8:\320\247\025#\367~\001K\357\246D\264"
+	.ascii	"\356\3622\243*\263\260\033\004\211*g\373c\266\254\254\367?{\322"
+	.ascii	"\356s\317g\322\001?K\366\263\313\t\006\001\b\244\230\324\377"
+	.ascii	"\346\372\231\200\006"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.part.0.180.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\235\006\r&"
+	.string	"zC\250\016F\200\236\321pe]i6Z\240\207I\302R=\212\026\033p\002\321X\3603\211\203\b\n\206\242\240\3625\222M=+\254\036\264\374\360\bj\r\372\b%2\373V"
+	.string	"h\273\233\347\324\340\302'\226zU\222n\273\367\2262\311\323"
+	.string	"\303"
+	.string	"\340"
+	.string	"\377\372\213\347\335\357\235|\270\217r\260\265}\031\215PCR06xe\031y\200\336,\2768\024(>@\\kX\021\377D=\024\250r\r\022\327\0325)\340\261\311\330\272\022\203n.\016\275\271\304\0238o\242\027p^\370\275\360\305\256\315v\363Lv\367\205\325\252\273lN\344Z\017xU\375\214c\353\272\342n\266\220\253\257\321\320\331i\226\3156u_\273\352\275\366C+S0\310\337\303\254\260J\005Az\220\375\210U\016F\273\n\331d\311,\314*x\341\217\317\331P\221\026P\254\t\2319\033\022\376\007H\r\254\227=WTe\272\256\353\301\246\270\313\326J\322s\345+/\224\205\221r\341\271\352J\2129\300m\263\241u]\367Q:\276;\337]\342\356\001\354\232\304\315\306_\035\003\314\275k\024\202\017\354N\247\272\267\\\270g\275(cY\302\340"
+	.ascii	"\346/\227s\277a\316\367\356\b\022|\340\036\354\217\361e\003\013"
+	.ascii	"\231\230\257{\333\357\244\2312`\335[\273\333\342|w/J\233\242"
+	.ascii	"\232)\236\263\357\275\225_i\261\357\332\022G\346\376\350\274"
+	.ascii	"\3718\3007Q\234\\\037\376\360U\222r\250/\303\355\346\207\237"
+	.ascii	"\262\204\256\253\357@\035\352\223pC\221\202\017|_\370\337\360"
+	.ascii	"\331\360A&F\325=\356\255m\333;\231L&\267\203\3546\257\017\312"
+	.ascii	"\3333\343\3459ywL^[\363\326\232\227\326\274\350\213\337Y\363"
+	.ascii	"\236\315k\376\353[\226\274\335\274\334\274\377)\275\246\370d"
+	.ascii	"\255+\215d\331\352\303\324R$|\240\255M\224!\177X1\320\";\206"
+	.ascii	"\334K\252?\264P\337\245\334n\326\312j\335Y\214k\262\204]\263"
+	.ascii	"\336\302rZ\363h=\207\316\330\215rh\335\307\2608H\252\356}x8K"
+	.ascii	"\026\320\270Q\267\006p\tA}\327!<\200c\030\034\244\017\201\016"
+	.ascii	"%g\202\030C\302\034\327\006\262A\374\343\331,\375k\215:\344b"
+	.ascii	"Y]DP\337\212\333\256ZD\365J\243\"A\233B\260\213\t\304\017{\331"
+	.ascii	"?\376\314\322\301\270~\274\0315I\001.u\t\352+\272\251LT!\243"
+	.ascii	"\t\363\202\374=\371\346\215V\331[;\353\262\373\211qH1M\312g\363"
+	.ascii	"\272~\301\234?\324\371\343\221D\t\270\3265J\314\307`\330w\335"
+	.ascii	"\334\fDDg\021\007>p\326\351\017\314\331\"\202[\020\260\331\273"
+	.ascii	"\036>|1\033B\360\nY\260\273\f[s\002J)\344\236t<\026?[c\260A,"
+	.ascii	"zkOH9^R\203\255\355\236R\245\034\223\016\351\304\202\255\341"
+	.ascii	"R%&\240\264B\232s\241sJ\035\334\234\200n\251RN\ti\307\224\226"
+	.ascii	"@\221\264cj\nq\264\301\bC\007\r$\2046\210\327\333\2443!\224b"
+	.ascii	"\307S\221\313\331r.tFLf\3237I\250\003\b\016F\270\247\334\022"
+	.ascii	"\017\351\t\327\244CJ\201K\3429\341\204\322\335\251\310\361pO"
+	.ascii	"\273\035\017g\333]~\271v\220\035\212j\251\355\227k\020\367\364"
+	.ascii	"\207<C\255\222\201\372.v\273\351\303U>M\013N`\236+\325\006\037"
+	.ascii	"\330\323\351\024\3038\261\\\276[\316\233<\335S4C\005+\002\357"
+	.ascii	"\2528\324\034\347\201;}+>\034cdbR;g\20642\2675\257\250\006\002"
+	.ascii	"\323\372d\316TD(O\255\312C\355\021|\250\201\030\346\0204H)\022"
+	.ascii	"\021Q\320$I\007P\0021\350\214l\003\021P\265T$#3\242JZ\003P\217"
+	.ascii	"\032\324\301\267\314\226\301\242\376a\246 MM\217\353\227+GD\265"
+	.ascii	"\322\325\357a8\230\316\272\345\022A\274\fQ\264\024n\245\244\377"
+	.ascii	"\307}\3758\006Kd\241\321\206\243b\213\322\256'\202\bly\370K\336"
+	.ascii	"\222\215yjnI\241\367\235\344O\244\227\034\021~$\277C,\322\036"
+	.ascii	"$\241\233\035\322\336o4$\322\303\021\311E*%\2136\b\275\270\n"
+	.ascii	"aD\320\364\004>\347\332d\314\370Ix\230\326\231G\0179\367B\355"
+	.ascii	"Tu\231h\024\242\235>\005\362\005 v\257\341\367\2113\223G\201"
+	.ascii	" \334lXp\243}\f\224\326\027\2766f\310\327\230\304\211sUd.\005"
+	.ascii	"\300\246\025\247l\bfU\331k\251\362\300\233_D\344\370\340\370"
+	.ascii	"\206\350\2540\3609\325\031)\255\321\314\354\2748\354al\366s\302"
+	.ascii	"h\004t+\346r\265\034,]\003\346\026\347\022\357\315%\030\373l"
+	.ascii	"Vi"
+	.text
+	.section	.gnu.lto_FLASH_Lock.part.0.181.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"%\n"
+	.string	"\346\322E;@\305\2521\340\245U7\006\377h\241\341\203\371;\264m+\353\246\235\020\030\354QV\273;\367\f7\323\327\315\206\270\355x\367\003\335\356i\205jKp\370\314VF\3367\263[J\231R3"
+	.string	"4"
+	.string	"3"
+	.string	"NqXe\267\374&r\rh)\256\023\001\367\336\372n\206\\\365)\251\312\177\355\231\361\265\372\324\274:.\tN\005\030\356\275\306x\334\335m/\330\376\330\006\020\237\031\003%?\276\363Q\227w\237\363\205\022"
+	.string	"V\373`\311\234\2342Ozzg\314\226\322\247\224\2662"
+	.string	"\273w#7\340\202t*#\366k){\263yw\022;uc[\236\336\0313\206\305\206cM\2159e\2663\362\363\340\005\027\205\277\344&\3668\330\354\336\326\307\013L\253&\274\263M'\371\321\236k\256\354\333~\313p\326P\200\242\317Z\220N\236hI\236)\344\215lX\002AOB\364\331\316\304\203\247\241\343\020\201\340\217\323\371@x\252\bV\204 \261\222B\240Q\375BS\345x\266%0\254\242\265a\021"
+	.ascii	"ze\321\033k\270\215\025\030H\004D\3010W8 &0\316\210E\235\323"
+	.ascii	"i\241\315\224\235\006\200k/\246\234\226\323\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`/\r\335("
+	.string	"f\377\336E`\234J:? \n\233\221\006D\207@&\246#\312\360\027\316\244\273\026\240\211p\325|_A\307\244fYEP\025\301\325I\033\376\"m\370\213\2648\367N\004\271\277<\005Mz\271\3408\0335}\0075\241{\313\024\307"
+	.string	"\303"
+	.string	"\315"
+	.string	"5\336<i\364\337f\364\355d\364\353l\214>\226\223I\214\n\243\177\345E\237\316\272\350\317\265\350[\261I\364\214E_\216\200\024\032Y\203>\234e\360\265\007W#<\312\271bBQ\205SE\277\212M\321w\263\013\316f\223\350\031\212~\233=\321<fMp\020\003<\344\274h\211\233\271\315f\263I\242\231\211}\322\210\353\245fg\212U\315\211h\026\3739\2253D_\214-Pt\372|\312\371\277"
+	.string	"\232L\242f \232\215|\270\224\023\202\327\032B\t\3758\353\241\037\246C\037\214\345p\276\023\351\353\271\241?x\324\027\264\367\347\024\325p\346\231\241\037\210\241\377e\210&\223je\177\377rP\f"
+	.ascii	"EQ\364B\037\320\376\337Q\020b\315D\2264w\2055;\2015+\2254s%i"
+	.ascii	"\336B\322\254u\2449\313H3V\221~\233\257\276\033\257f(\"\315Q"
+	.ascii	"]\315<\2064\367`T\331,\305(W3\323\226\320\211\252\241\277\217"
+	.ascii	"V3\020\316:\031\026\3622g\220>\033\254\376\032\013\244\257\306"
+	.ascii	"\236OI\230\370\252\237\306\252\217\206\253\372g,U\277\360l\322"
+	.ascii	"\224u\361T\177\314\217\367\235>\372\204V\252\377\327\343{\347"
+	.ascii	"\230%0\346\321\367\213\352/-C\365\275<\365\363v\364\273\330!"
+	.ascii	">\274\"\354\324\307\263M}.VG\177K\016\256\302\301TL}-\366\006"
+	.ascii	"O-\361\217S\251\177g9\355g\261\025(\330\270\032'y)\211m\234\214"
+	.ascii	"r\322\331\214\006poh\3773\336\341:T\207\251\033\257L\343eN\277"
+	.ascii	"\030\257\021\2351\320\330s\217\003\256\321*\340\036\371r\212"
+	.ascii	"W\274\254v)\336\2412\257x\207+\337\246\337\312v/\305\213\243"
+	.ascii	"\304Y\231\233\205\205\\D\345\262x\211*\367\\\225\235K\361\346"
+	.ascii	"\250\314G\256W\354\261j\372^\361\356\250|\305\313\223\366\025"
+	.ascii	"/\217\312:\177i\327+\336\2355\3465Z\3156\035\236\273\223j\331"
+	.ascii	"\302s\217\277\323\271\303\224\216xy\275B\274\234\362e\273S\212"
+	.ascii	":\026\342E\252#^#;\342=>\013\361\252\315_R\232\255\326\232\223"
+	.ascii	"Q\232S\265f%(\3157\322\232}\2405?=\351\277q\322\214\343\254\271"
+	.ascii	"\311\254YGYs\016\262\346\035M\232\205\2145{1i\276\n\217;\234"
+	.ascii	"\255C+\373Ro\267\3075\370\345\337\356p\215\271*\216\t&\340mw"
+	.ascii	"\250\\\256\205\312\275\267]$\266L\261*\272\343\275\215\001\241"
+	.ascii	"\024\022\026\317f\247\324\234\240\276\236\355\362V\200O\271G"
+	.ascii	"E\327\002Q\321\005\032*\"\242py\213h\302\035\246o\347#\032C4"
+	.ascii	"$\301A\204\241\013\224\300A\203\353\002\f\362\252X\023B\336\r"
+	.ascii	"\3120\310\353\223\212A\336\242\312<\230F\226vB\344\377\346\322"
+	.ascii	"\262~\207\274\026\204\220\367\030\210\274\307@\241\004K\004\367"
+	.ascii	"\370\345\201cPPP\320\345\2259\bt\217@\227\325\262\323\375\334"
+	.ascii	"#\356\221\303\"\203\374\351\023\\s\273\340\317\335\231\262\362"
+	.ascii	"\272\237\361\346\254Lc\317\324XNJ\\U\242ri\274\304\260\260\274"
+	.ascii	"\003\032/\316\212\243r\017\225\036N\200\347\250a\034\347H%\201"
+	.ascii	"\220$I\n\303\001\320\002\241!\342t\021\300\230\203\214(\"\022"
+	.ascii	"\310\210\004B$=\027V\"!\212f\264>\001\246\251F\301}j\206\t\027"
+	.ascii	"\246|6\261\354\303\206\001j4\244\272\031U\227\"\006h\302GU\005"
+	.ascii	">d0u\313\346\203O\271a\311\035\r\376\255?E\330\033I\241\344\210"
+	.ascii	"\021\217\205n\246\017\277i\215\260\227H.\032\002xv\217\264\275"
+	.ascii	"G\234d\0028\237\302S\351\217\b\317"
+	.string	"!1L\001\201\366=\371\212C\316\301^8\243\276\312\031e\2021\206{*\310\207\210\211\226\211\025\300\023\320\311\006^\357\371\3263-F\367\347\337,\343\006]\b\3441PG\254\3706L\370\330R\024\026w\313!\2375\334(\310\351Z\373\222H\363x\337\327\363~\236\307\373\276\236\367\363<\336\367\365\274\237\347\361\276\257\347\007\364N\206#\205,i(\277\317\r\205\"\032\204\321 r\026\227\217\226a?\232r\037=\335\234\177a\273?\016\351\223\202\356\266F\007\027\250\344\304\326g\204m\257\327\213k\b,\016[\303\\[\215\346\240bWM\246\234\3562\212\276\351\210Q{\340ZX\325DY\272\340\017\"H;\261\304d\207OXHgnV\300j\256\211\031\f\271\177L\252`0p\262\302\256\226cTd;\2403\212\201\262\370eM5\321\244ap\030\215iS\360\243)6\224\001BE\013\244\335\312\n\345\215\274\277"
+	.ascii	"\203\371\030\331\346\335m\316\256\177\3167!*x\350\302\231xIx"
+	.ascii	"T/oO\025"
+	.text
+	.section	.gnu.lto_.refs.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\f\001\345\n"
+	.string	"&\334M6Pm\222\341\007\274\252.h\267\252\252\252\252\252\252\252\252\252\242\340b\247<\372\361&\032\355\030\355\301\016\233\375\177yX\373\215\354\266!\226\020B\b!\233\354\275\245L\001:"
+	.string	"="
+	.string	"C"
+	.string	"\017\002hK\250>1q\210\373\307\304'\367\322\304\035\367\315\304\231[\302\231S\247\324\2507\350\207\016w\216/\346\2463\216\223\271\225\321\251D\233\266\316\241-+{\2273\027\313o\023\375a\364\307E\247\244\036==\262\350\rEgT_\025\234\223\nx\002tRT\302\031y\202WD^R\365*\362\220\307\247\310CU\177\3367\357\333\373>B\236\235\325\233\305\335\342\314\342\f}\021!,|\020\024\376\207\n\337\303\205\337\301\362o\260\374\003\005_ \301K\225\207\246\016I\375\241p\247\302\031e\004\324\317\201\016M\276\231l\240\004\326\r\343\227\305\027\342\2005\203~-\350\274h\006\373e\004c\350\253\352\254z\2417\2173\357[\325\331\263\320^\221\347\273B_\f)\360\265\006N\250\004\33630\002\357e\b<\352\340\020G\307\227c\007\355h\203C\032\334]\236m|5n\320\030\364GP\001\f"
+	.ascii	"\003\032\264\016\227ZV\230\223\363\205\251\001\224pZ\006*&\013"
+	.ascii	"\331\355&\374\201\220\236!\342\301$\003"
+	.text
+	.section	.gnu.lto_.decls.8812338fc493b5af,"e",@progbits
+	.string	"(\265/\375`\017\205\2452\002z\245s\314V LI:\215\001r\255FV7\2261\t\""
+	.ascii	"\202\"\250\002\2160\022\223\021\303\210@@AD@\005TQ\025\001\304"
+	.ascii	"*\273R&t[14\002\031\327\330'r\263\213F\226G!<=\275\310\315na"
+	.ascii	"\220\223n\337\337[\030\304q\214n\n\235\256{\313\275\267\334R"
+	.ascii	"\2468\013\245\f;\r\346\022\022W\301Z~\307\004\206\311\342\305"
+	.ascii	"\322)\315\033\336\202\273\034-Y\346a3\027\216J\303F\"\353\321"
+	.ascii	"u\343\324\3648\221\263\302ta0\036\nIOj\013,$K\037\031cp\025l"
+	.ascii	"\005\273\221\205-1\214$\323\005\nIO\352\022\031\323\022F_\327"
+	.ascii	"\336I2&s\t\205\244'5\t\313\305r\357\344\362'\301\004\263\013"
+	.ascii	"\357\3414f\262+mrtc\271\367\346\213a.u\231/\314\245\f\216\220"
+	.ascii	"\026\030\242f\211\331\314.s\206Yu\341\250\366\206\372\200D\313"
+	.ascii	"o\331\267\367\006\001\204\236\271-4S\030\220\315\252\037O\301"
+	.ascii	"T\260\237\f9YtXy\201\263I\303\347f\215\357\330\240\271\251\t"
+	.ascii	"\202\363N\020\215\223\274<\350\275rw\320\247Z\372i\r\375\364"
+	.ascii	"\205~\272\365\321<}TN\037m\323G\317\364Q%\372(\227>j\245\177"
+	.ascii	"\225\346\222\337\004\214\324\b\203\363Q(\375\233.L\2446\202B"
+	.ascii	"\205\213\2114[\204\035QA\341|4I\377T\243\177\356\351\237c\364"
+	.ascii	"O:m\026]\347mG\030\0268\377\334\242\177\262\351/\357\016\372"
+	.ascii	"\263\211\376yD\377\230\3578\215\237\f\273\203\n\244\243?\234"
+	.ascii	"\361\031\214\346\330\017\367"
+	.string	"m\354W\302\325\336F\330O'\315\336F:\367rp/\0079\tV\020%\232\177\016\321>>\307|\337\271a~bVp\376\251\245{\260\2312l^Wz\340<\006\223\371\377\033\fp\312\244\244\310p\376iC\377\234\322w\337\035\024\213\301wWy-x\314\3214\264$H8\377l\322)\330\327\202\376d\241\177\f\306Ng\217\213\227\244\035\256K\347\226P\224p~>\243\237\227\372>y\2313\225\232\244\276\314a\271\0345\253\266*8?\307\351g+\372\307]\340l\322\254\350\224\3400\027\235-\270,_8?G\321\317I}\257\2744\276\202\261\\\345\335p\226'ur\330Z<q\303\371yK\377\336\rM\301\275\033\372\254C\337\256\273\203>\337\320\367\352\362\240\026\334\035\364\256i\240\223\224j\312\222\242\266\352\375 R\247\366c \230\013G\271\271\352p\237\244\312\020\301\031C\311g\226.\310\340\374\354\244\177"
+	.string	"!W\273pg\267\313H\230\345\336[\211\207\340$\f\016\200\261\332\362\004\237\341&\330\tN\303hW\211\225?\026\303cJL\206\31528BZ\200\b\336\362F\031c\265\305\354\277|J\334u\265\034\244\344\336:A\314V\342 $\334Ym\001\241\007\004\020@"
+	.string	"\341r!#\203LN\376U\376\016\227}\314\017-RKp~V\322\317-4N^\036\024\304\335AqX\017n\303\333\242\303\371f\237\376\217\225\340%W\211\231\364\374"
+	.string	"^\330\310\362\215\t>\202\301Fl\261\332\322\267w\262\007\004\020V4Y\334\326\320\374c\260$ja1\332p\306Hl\230\204L\201\302\371&\232\376\177\225\370+\271{\356\013!,\334p\276\351\304\b.\202F\225f\tgL\004N\347\324a\206\243\017\347\233L\364\315$\372\346\020}\223\207\276YC\337l\322\026$\267|\344\360IQ\325\341\354\003\357\300=r\220\222\033\006\372\245o\352\353\307?\256\022\373\310I\020zL\320R\002\223\265\216{\\\rk\027zj\320\340\214y\370\034k1\340GV\022\234M8\375c\035Y\267\313_\024\032\3168\353\277|\370\006\306\272W{\247\355\275;\350\350\025\235\321\341\214\2570\216\253\364\200sl\235KF\353\b\n\347\343+\032\005{_\017\350\375\373\273\036\320\273/\017\212m\370\034[\355\240OT\311}\266\367\326\001"
+	.string	"\224\2665\234S\\\345\341\310\332\215\0358\377\270\006\226\241\263\244\227F\t\347\3371,\3436\271i9H\311\r\225\222-\251Iq\341s,\343^\301PE\032\370\333\277P\242\334\260\234\242\344vZ\311\224`<\365\221`\002\226q\327n\233\231\354J\235`!\2274\360\024\236\201\2450\325Ub\0318\352\030\006\216\321s\332\201\351\262w\223\321}y\320\303\335\035\364X\251\237zt\3220\001\241\303\371X\211\306\222\345j\311)\332\260w\026^\327\336\311\377\270\t;a\026x\t\267\300L\030\t'a%\214\304.\256\022\277\300F\277U\256\225\367$\367F\332{\223\341\243\253\245\017\306S_\036\231\253\027\006\306S_\235\335\275C\341\016\306S\337\231\233&\203#\244\005\244\324-q\321\325\222\301\021\322\002_[\226>j\360V"
+	.ascii	"\227\2721w)\206\257\357./\034UrG\235`\007\343\251\017\313\333"
+	.ascii	"\375r\341\250\222\036\214\201\361\364\265w\362\007\370o\036~"
+	.ascii	"q\367\256\0263)d\357\254\252\013\312\346\242\260\364\355\235"
+	.ascii	"\004\241\007\204\023\214\206\230\216\236|\274\244\177\325\350"
+	.ascii	"_3\372\307\373o-.\311\305\232\337\277\253\331`\301\242\006\344"
+	.ascii	"\367-\215\337\0065\274\246\340|\375\256\334\02481\\\232\350\337"
+	.ascii	"0\255\341\210\376\257\236\031\2337\272\245\362\226\3715\203\323"
+	.ascii	"6\303H\215\333vb\355\211Q\323\322\037\226x\022 \303\244\343\027"
+	.ascii	"\357\206\251B\274\260\230p\376\255\322\377\275\023S\344/\311"
+	.ascii	"\204\363\025s\365\222\224\250\341|\301\340\031I\027K\234\257"
+	.ascii	"w\265\377\352-\022\005\211\022\347_)=\302\335A\377\373\205\016"
+	.ascii	"\343\271P\362\002\347\377z\371\245[\301\360\200B\203\363\235"
+	.ascii	"\273m\377U\323I\212\037\021\234\257\247\3460/\252\0358\337-\227"
+	.ascii	"\313U~p\341~\273\334\270\237F\311\235\334;\251\203\177\250yB"
+	.ascii	"\206\263\206\313\203\342\273\203\3766\351\337\017P\363\357\357"
+	.ascii	"~\200\376\"\351\377jq\313Ofha\341\374_\357*\257\333O\202\t\037"
+	.ascii	"s\263\267\222\275w\006g\034\021.%\316'\322O\336\035\364D}&/\017"
+	.ascii	"\372+w\007\275lw\312Ujp\251\234\004\023n\026\215\351\340\254"
+	.ascii	"A\262\306\017\347\007\351_\r\320\373w5@/\203\376\b\375\263\313"
+	.ascii	"\203~\005})\227\007\275N\356\331U\202\270h\277e\327\354*Rr\227"
+	.ascii	"\355\235\324\001\322\341\204\n\316OA\003`l\233\360\013\364/\b"
+	.ascii	"T\347\357\357\357\357\202@\257\365\207\313\203\346\273\203^\312"
+	.ascii	"\335A\017wy\320\377\212\375\027\354*\271a&\222\351j\237\355\235"
+	.ascii	"\334\220\202U\301:\303\371\206\341\313\344&\177\303\356\222\223"
+	.ascii	"`\302o\220\266\222\275\2237,\357mt/\0079\367rp\266\0011\"C\363"
+	.ascii	"\261~\362\362\240\372\356\240W)\2209\271\362\334\t$\273\375\347"
+	.ascii	"\326\217\205\347\217\337\264\341\343\307\254Y\223\377\354\361"
+	.ascii	"g%\247\326\237\277N\036\231\353?w\374\270\003\247\216\377*\375"
+	.ascii	"\037\341\001%&\325\002\376\324\347\366\374\227\347\262p&Q\002"
+	.ascii	"\330f\326o\006\263\t'\260~\323&\207\320!\370\257\337\231\343"
+	.ascii	"\307~8~L\202+\346\037\334\0037\357\203v\341?\225{ w\360\347\017"
+	.ascii	"\023\370\237\345nW\347\215\037\357e\036V\177\236\003\2366\376"
+	.ascii	"\354\345?\253\376L\344\317E\376\263\306U\032\001\252\214\346"
+	.ascii	"?id\277\377\234q\227\230S\251\b\030\374\217\323\b\370M\250\223"
+	.ascii	"\352T\260\336)c\203\353A\346\371\257\376:\204\377Y\356\006\303"
+	.ascii	"\005\341\277 n\007y\206\037\307pN\375\037\361"
+	.ascii	"\002\223g\360\247\267\004|q8?Z\306L\321\301)\365\026\314#\372"
+	.ascii	"\345\277\034\316D\356\277\034\314\237S\306o\n\241n\346\211\233"
+	.ascii	"?j\345\177\013q\371G\247\374\267\205\353\302\031C\177\360\337"
+	.ascii	"\016\367\346\2779\377\315\377]\377\213\376\327\374\357\371_\365"
+	.ascii	"\277\351\1775\374\357~\277I\202\274\200\377x\027s\272"
+	.string	"\022`\360\243\\\376[\201\313\302\177[\270.P\3116\272\303\231\214\270h\277\371\265j\307\2469\203\346\251\336o\352\2350~\363\355/\364\345\375g\324\t\365\237?\377E{\372\b\017\3341\257\340O\357\354\310x\371M\261\223h\211\376i\2270vS~\363m\354/\314u\261\371S2.ae.~\354\365\017\230c\317\371S\026N?V~DX\n^\374\330\314LB\364\373\247BO\377T\270\0033y\207?eU\370\361\221\2463\301`\367\3009\374i\b\376\374\367\343\031N\246\037C\235K?\226R\372O\344\217\255\316\026\377\271\301\177&\375\030\007\213\263'j\237\025\374\247\207\377D\372\361\216#\2433\204\037\003)\372\357\230\213w\242\3405\342\016\370\323\fd\016d\017\204\340\3172\374\347\376\237\345n\267\340?/\360\347\f\374x\306\231\202\337<\201\251<Q\360\237\017\300E\316\023\374\270\203\323\204\t\206\357\371\317"
+	.ascii	"\300pZ\300|\373\257\362\354l\241\004\377\335\362\2373\374g\006"
+	.ascii	"V\374\246\025\267\377\004\201\212\337l\323\362\237)\356\333\211"
+	.ascii	"\3427\305N\242\377D\341\277h\355\377\017\376\223\004\377?\360"
+	.ascii	"\026\356\201\377/\250\345|\016\235#\370\315\022&\332\177\n\374"
+	.ascii	"\351\324\237G\360\343\001\234\302\037wp\2328K|\375S\f\374\231"
+	.ascii	"\350\307\0308\203\376\214\342?\331\377#\256\377T\304\237\265"
+	.ascii	"\376\023\350?C\360\237\032\370O\027\376\323\002\3779\201\377"
+	.ascii	"\204\300\177&\340?\013\360\237\037\376\323\303\177\352\377"
+	.string	"\374\237\375\376\\\346\317w\177\366\362g-\177f\373s\223?/\3713\222?\027\371s\220?\227\340\317(\376|\342\317$\376,\303\237E\360g\017\374\231\003\177\326\300\237]\370\363\002\376\234\200?#\340\317&\3749\304\237?\370s\007\277y\365\233S\177\306\3407\235\376\334\341\317<\177\336\3713\316\237m\376\234\1773\315o\242\371\315\276\337\334\373M2\277\271\374\315\273\337\f\363\233v\277\371\3457\347~\263\313or\371\315\267\337\314\362\233V~\263\3557\247\374\246\332o\242\375f\331o\216\375f\330o&\371M#\277I\3447\207\374&\327on\375\246\217\337\324\372\315\254\337\304\361\2336~\263\306oR\375f\214\337\214\372\315\375\233E\277y\202\337,\301o\256\370\315\024\277I\364\233\307\337$\301o\026\177S\3507O\374\246\360\277`\376K\367\377\205\337,\361\337\270\337d\377\373\344\307\373\277J\376\333\302\217\007\360\337"
+	.ascii	"\374\267\203\337\374\371\315\340o\212\3407m~3\375\261\337\217"
+	.ascii	"\367\3763\371\261\336\217\261\374X\371\177\304\217\315~,\366"
+	.ascii	"c&?\006\373\361\221\037\033\371\261\327\217\205\374\030\310\217"
+	.ascii	"w\374"
+	.string	"X\307\217\261~\214\343\307V?\236\361c\252\037K\3758\352\307P?^\372q\321\217O\360\343\031~\234\342\277h~L\364c\022\374X\350\307\302\037\263\377\365\300\217e\370q\007~\314\201\037\307\360c\030~\374\301\217\003\360_\277\377\232\371\257\336\377\341\177\363\376;\346?\225\377-\374\217\373/\331\177\233\374\027\357\277b\376\033\346\277_\376+\367\337\205\377\242\3757\371\337\260\3772\371\037\303\177\227\374\367\205\377\272\360\337\020\376\263\360_\017\376\213\301\177/\370\237\374o\366\337\355\277\317\337\337\337\337\257\003\367[\320\364\007\243\002P\204\3346e\027\212\004e\202\266\241I\024\r\225\202^A\223\240l\250\025\024\013J\005]\202jA\301\3200\324\rUC\263\240b\350\024t\f]C\315\3204\364\tZ\005m\202\226\241d\250\022\215\202:A\225\240gW\211BA\215\374\326\241G|`\211Zs\245\353dC\353\342\373q\345"
+	.string	"(\024\224\bZ$\254k\357\3553\344I\027\220\333\026e\331#\213\323\357\303\005\305'\310\311\226\266\344\241E\307\226\256\275\223yP\177|8\302,\321\246\027\267-\247H\303>\222S\352\302zVc\272\274\316P(\350\025\004\224\210\221\341w\363P(\350\327m\363\361\342\201\346k\357\2449\243\007\324\026\013\344\367\214\321f\217\234F\213\244^\177/\310\340\374\2367\375\0364\375\036$\372=\\\372=M\372\035\314\350w\210\323\357\320D\277\003\022\375\016\\\372\035r\350w\250\322\357"
+	.string	"C\277\203\222>\0074\372\034\342\3649(\3659\034\321\347`\245\317!J\237C\222>\317\236>\017\234Fi\2405\256\262\007\255\322\271qG/\252p>\017\026\235\202}{\320\377\335\036\364<P\364y\300\364yp\350\363\030\351["
+	.string	"F\337\0026}\013\212\350[P\245o\201\221\376\216\031\375\272\313\203~gN\177\211\2728\312\364\243J\350\022\366\2033b\204\016\347\213\274<\350\206\273\203^>\237\243.\242,\301\234P$\332\"*\r\314\005\316IjF\312$\341\374\0356\375\0375B\221\320\243\253DY\240\033IM\224\256\275\367\371w\256\311)\322\2607\026\224.\224\005Zt\256\311)J\356\242\004\220\001\313\362\265\367\356\001\001\004\020n\232\206\334P\323\371;<\364wd\350\3574\2559\331t\206L])q\376\016\013\375\237g~\246\371O4\247\037\276\243\301\304\007\316wyyP"
+	.string	"\334\035\364\354\363\371y&\007I\221\r.\2345\270;(\037\366\2133\362\341cOo5\263dH\026\316f\256\222\314\357\f\347W`F\273\331uu\321r\202\375>Z\352\272\31670\247\224sJ\216\271w\026\027\254\027\347v\343\344\262\234\\~\037\2707\023\376\313Ww\333r\314\275\255\300\344$$\230p\2029\267\334\266\013G\305\200$[N1g\2313\357\\\236a\316\273\223\314\211w\2169\355\256\362\004sz\371Iw~9>\301\234sW\356\302i\355\274\024e\004\r\b\025 B\307\307!\277\202&\372>]\036\264\202\273\203\276\202\"\372\025h\351W0\245_\001\013\375\r{\372\033\3524\210*\032\205\313\203~C\230\376\206 \372?\263\234X\320\232v$\341|Eg\331\242\262\302\371\033\254\364\017"
+	.ascii	"\345\312\231I)\272\005\231\213\266S\3129\305Lv\251-\260\226\252"
+	.ascii	"\234TN+Wy\266\235Q~\252\335\261\343\344\336Hg\333\231v\345R2"
+	.ascii	"\245\363\311\206\227-:\237S\3304\025\022\223\024\316\347\232"
+	.ascii	"\324\233\016.\234\277AJ\177\203\223\276\271;\3505\254\321\327"
+	.ascii	"p\247\257\001N\377\347\331O\264\377|r*\261\237\f\373mk\rg\fw"
+	.ascii	"y\320\002\334\035\364t\342\363\363,+\371\302W\006\347\020\310"
+	.ascii	"~6\371\317\262\323\f\373\311\320\304\314h\016\347\253uyP\236"
+	.ascii	"\273\203\342)>?\311\326Ty\321#y\212\255\312/1\230\340|\rlg\362"
+	.ascii	"d\202\222\331SU8_C\222s\311\231\344\247\222\337,s\202\231zXK"
+	.ascii	"\tK\026\234\337\207\304\347g\022\375\3677\245\007\3169_\277+"
+	.ascii	"\022;\202\245\310\257\362,r\032Q\221\271\312\232\245\371\027"
+	.ascii	"\025\244\b\316\327\340\245\377\323\353\3642\225'r\033y}\020\002"
+	.ascii	"\245AK\377g\220\237C\376\263\353\024b\352\335\220\355(;p\276"
+	.ascii	"g\227\007\365pwP\023\212\317\317 S\242\306\254p\001A\241T\311"
+	.ascii	"\322\201\363\271\225,\333{{\270cl\370\265"
+	.ascii	"\341|\r1t\032\332\217\263\307U\236>~\372\310>N\255\234\242\344"
+	.ascii	"\206B]\364\270QZ\265h\201\346S\253,\212\226\217%\316<L=mW\206"
+	.ascii	"\025D\207\216<\rJ\372?\261N\254\263\250'\271\243|\2040a\373\332"
+	.ascii	"ORB\270\206\255\377\023Gn\273P\376\202\230a\302\371\274\362\371"
+	.ascii	"\211\303\006)\206\222\013g\265\352\264qZ\2518\244$\241\340|\257"
+	.ascii	"\\\036\024\203\273\203\2365|~V\335\224\251+C\202\363\0054L\275"
+	.ascii	"\255\003\026c\307\026\325I\225\261\242@\bY\333\323\377)\343\347"
+	.ascii	"\324\237\323\234R>bD\341\303\371~]\036\364\214\341\363S\206\326"
+	.ascii	"\226\0215\2349\2340N(=\037pc\316\027?\235~:\235Pw\357\275\251"
+	.ascii	"vQ\036\noPL\330\3726\325\023\210\023\352\016}\262\265\305\205"
+	.ascii	"\363\365~\367_\265\261\342\003k\013\316\327\021\243\377{\374"
+	.ascii	"\243\333\350i\357\035u&\367\323\321\r\372\337\337\363^\020?\316"
+	.ascii	"5o\007\377\363\336\017`\223\373H\215\230\275\3675\243\275\324"
+	.ascii	"\214j|\330'\334\336H9\212 \220\003\n)\307\024\262,\007\324\006"
+	.ascii	"dY\216]\204\304U\264\341i\347(B\226\355\275\001\t\251H\205+("
+	.ascii	"d\231\321\336\200,\333P\233E\034\324\335\311\034E\033\351jo\330"
+	.ascii	"H\333h\227]A}@\"\345\200B\226\031Am@\226\345\200\332e9\266\206"
+	.ascii	"\215d\364\344\002i?m\330e9\362v\331\025\224\006d\331\025\024"
+	.ascii	"\262,G\330\255\341b\315\025\030i\304\360\350\273yH\244\375\242"
+	.ascii	"\251\312\350I\003\0342y\265\353\366\276gI\373i\303\355\335\301"
+	.ascii	"\336UWOuFSW\312\021\334\213\2434\243\253\233\334{{h:\302\272"
+	.ascii	"\332HpEw\303!\211\\\355M\344\310\304n\332{\357\022\212\222p\273"
+	.ascii	"\307\205+\312\252\332LI{_\260\223{7\355]t7\334\336\273h\357\235"
+	.ascii	">U%\367\246\241\001\331\325\324\2647UO\323\256"
+	.string	"*ZK\332\033\237\201\221\002\205,\303\272\362YkR\326\265[$\213.\222\351jw\355\272\034O\272\254Hl3\355\275o\031\335\005\005\203\314\223\225\\\013-8\377\347\322\251\244\372Y\345x\202\263\207\324\frJ\013\234Od\366q\262\270pT\271\013\315\331\342tq\225'\362L:\221\251\023\222\253\245\024\003\f\232\257\363\245O\026\330O\206\335\005\231\206\363y\344\363\023\t-\343B\"\301\031\001\177\312\374w\026\231\310m\204U\202\020!RB8w\006\260\236\260\340|\035.}\235,\375g5\317k\364\324\250Ak\3039\247\361yVse\344\b\026\316\035\356\016\232\321\244 \343#\013\316\327\231\221\317<\217]\341\230FRoj||\231\355\203\020\035&\375\3472\317{\1776\223\365R\026}\313?\2341\362\362\240\034\334\035\364\346\371<\227\321bZ\246 \341=\223\371\3632\347\335@\341\353\n\2023\356\272<\350"
+	.ascii	"\356\016j\236\361y\306\303o\\F7\302<\217\371\263\230|\267\236"
+	.ascii	")B\345\b\316\370\354\362\240\004\270;(\026\363y\016cDm\356H\335"
+	.ascii	"3\230\337\344\313v\250\214\270\275>\234\361\325\345A\363\027"
+	.ascii	"\237\347:\265\005\022\315\023\316\001\220{\246\373\363\\\366"
+	.ascii	"\202\375l\252\264\324\334\300\031//\017\032\342\356\2409\316"
+	.ascii	"\347Y\016\307\013\314R\031\316\006\270;\350\237\335\224\331-"
+	.ascii	"\303\365\\\355(\016\216\344\361\031\351\333\233*\204\0334\267"
+	.ascii	"<?.\317p\177\326\222\337n\333\2203J\272p\316[|\236\271\250Zj"
+	.ascii	".\342p\276\177\177w\007\325\260\367\276;\350s\340t\316\362c\036"
+	.ascii	"X/\353\260\002s#Wy\306\362g+\371\n\tL=x\340\374+\227\007\265"
+	.ascii	"\271;hn\363y\256\362\205\364K\202\363zw\320\244\005TGr\217\253"
+	.ascii	"\314=2\233\212\334\037\0241a\273\262\237\236B\310k\036t\262x"
+	.ascii	"\030y\301\3719R\264\217\f\304LvQ\340\350\005\224,%G\271\312\254"
+	.ascii	"\226\3252W&C!\351\311\205\243\246\245ZN\273\226\f\216\220\333"
+	.ascii	"\b\307\bB\316\220A\343\001\004\020r\023-,7t~\216\f\375\234\004"
+	.ascii	"\314\303\205\323\202\300\0204\263$\022\262\034$#\311\340\b\271"
+	.ascii	"\302\225\264%g]aI\306\230\200\270pg*HQ\222\311\262\030\327\327"
+	.ascii	"\222,+\361\200\366\350\201\027\243\357IF\313e\371,7\311N\262"
+	.ascii	"2\233]e&\313cg\023\263>\277\n\362q\244\350\343<\321\307\021\323"
+	.ascii	"\307A\242\217\323\245\217\323C\037\007\207>\316\224\036\341\362"
+	.ascii	"\240_ExqN8\037'\251H6r\225\371H\026\322\225\275\356\272\366N"
+	.ascii	"\346#\231H\366\252\340\316\216\356\313\214\022\306\214\031\232"
+	.ascii	"\177c\246\377\354\225\207\330\254YbcM\036\222\2050\t\302\224"
+	.ascii	"\205\363o\200\350\337\354\320\277\271\241\177C\245\377\274\365"
+	.ascii	"\f\344\330O\206\363\211\013\267\0268\347\037>\317[,\264\230\242"
+	.ascii	"p\376\340\356\240\277\201\322\277I\322\177\326\361\253\314:2"
+	.ascii	"\017\020\311\r\303&H^\336\221s\224Z@\231\301\3716g\364m\310\350"
+	.ascii	"\337T\363\2534\325d,\025\2717\214\022\204\2541a\353\333OO!\344"
+	.ascii	"\034\252\232\2301G8\337\306\211\316V\231\006\312C\f\214F\266"
+	.ascii	"\312\333\b\330rF\220e\306\221\257rU\266\221k\344\033W\231\255"
+	.ascii	"~s\215\371\307g\224\245.\334\331\nK$7/[\345\"\025\206$\311V\231"
+	.ascii	"*K\345\264(\002\243\221\243\266%FXN\276M\225\276\315\f}\033)"
+	.ascii	"\375\0038e(\036x\313,#\307\3100\362\324Uf\251\034\225\263T>\312"
+	.ascii	"Hf\262KU\372\222\306L*\263\310K\246\330\223Fkq&\356\367\311"
+	.string	"R\231)\277\3101J\356\247\024\2700B\343k\357\244\311Ef7d\315\267QzJ\225\334\274l\341\374u\215\376ZF\347&\023\016\013\322\027\316_\355\364W8\375?+]e^\312.rr\357\262\274\224\2232\322n\206\021\032k\r-<Z\344\374u\211\316-p\256\274\255M\301\371\253\227\376\272\245\277b\351\214$\303\356\240^\t\263\304\f\316_i\350\2572\364\327'\375uI\233\311\313\203\242pw\320\257Gi\374n\214\236lQ\203\263\351\367\233gL4DbL\376p\306Z\227\007\025\300\335AM>\237\233}+R\t\271\205\263\007fn\356\231z2\354\235\2467\004K\232\244\222\275\267\216\272\346WD\006\316f\031\237\233f\276\263\346\314\322\031\316:w\0075\363\362\022_\021-8_=\263\304{2\006n\tgs\214JW\306\306\331\362\356\266a\2717\246#1a\3141\345\024\\\0300:W\334\326\320"
+	.ascii	"c\332\241I\360\216\236p\276JWg~I\2279\242\266|\241\313i\212\333"
+	.ascii	"9\350L/\352^\235\0320\234\257\276\351\337\234\223SK\026\231\302"
+	.ascii	"\331\214K\336,\021\321\252\302\371*\233\306\177Y\356\272\272"
+	.ascii	"\230n&\027\363\315\324bn\271J\023\3567\257\230X\352L8s\212I\005"
+	.ascii	"\316\264\362%\036u]ym`\272\252\230k\233\207]\027\231\tg\252\231"
+	.ascii	"k\031\034!\367\007b\246\276\276\320&\"fL9\371\252\231\326\310"
+	.ascii	"\273\203^\005\323Ws\350\253I\332\244\362\337<\223\r\307.\315"
+	.ascii	"\310\017\347\353<\215\267)\345\346\332oB1\243|\315\354a#-\n\316"
+	.ascii	"\267\213\317M)\3371\245TIJ\203\363\365\234\276\311\313\203\366"
+	.ascii	"\230iS\232\214$\301\371\00703\235dp\204\264\300\227\326\023\023"
+	.ascii	"\355*M\245yf*\3151\263\314F\007\026\254\256>\020\356\023\336"
+	.ascii	"\f,h\276\276\241\315&/z,!q\276\226\322\327"
+	.ascii	"Nd\277Y\242\244\347\206\363S5\372\251\236\376M\261k\311V\212"
+	.ascii	"\210\025%\357\226\207\264!\341\b\003q\206\356\350\213\311\222"
+	.ascii	"\243\"#\0328\377\346\022S\t\316\024\\\032/\234M\260\025*nY\005"
+	.ascii	"\347\247K\375\026\207\275\240\220\364\244\276\300R\302\206\333"
+	.ascii	"\336\226\203\244a#a\235\371H\275-G\335;G\230.$\252\245\022%\245"
+	.ascii	"?s\233Fr4\226O~t_0\0309\260e^\324\231?\263\313<z\333\205;\233"
+	.ascii	"\200\334\214\245i\303Dbf\231[f\0173\211\351e\3560"
+	.string	"\265\314+\223\207\311e\0261\205\230G\314\037&\226i\304\304a\0021\255L\037&\0213\2109\304\314a\3360u\230_Wiva.7\247L\252<(4K\263\013\257\371\300LJ\321Jd6\260\230M\0014P\245\252\272(\234\327\252\267\255\371\020\343C\351\353\322\252\264\316\310)\242\023\026\246\203\213\214\2573\276R\221`\302\333\244np\211\341\374uJ'\207Q\214,8\257R\0060\265\214zl\255Qk\f\277e\024\032\021#@\336V\030g\221\2233[f8\257M+\224\2322.\346n\234\200\361\243{Z\235\234\334PS\306\003:c\013G\224\365\305\231\244\236\231\245\305\341\2742\2350\376\253\035\266\3268)\233\243\303B\372\240\306j\3645\351\277\312\325hE\342$Is\357\256\344\221\334\332\007~Lh\250\3726\362\013D\n\247t\205\313\332\342+\022\373\355)\213\254H_Y\374\352\315\230\264\255 8\177"
+	.string	"~z=\332S\243f\335=WE{6K\246\275+}\251r)\206\365\367u\243fBhP\301Y]\223\375.\222;\273\037\0030S\267\250z\252_f\241\212-\277\fAs\325\357n`\230l\345\300Y=s<2?\346\264\340\254\366\335\255\f\027*H\234U\276\273e\t\362#\r\316\327S\367\376\253@FSt`):*B\004\357j\036\236Z\306\n\203)&2h\32224H>\225\314\3252\346\322\032\2245&\352r"
+	.string	"1\276\\\025\363E\275\353\271*\3123\241\006\023^\232\276\215\254\002qC\227\344\211\020\365\356Tv \325\336pV\301\\\r\363\253x\255\217F\023\234/\200>\255\326]\265\373U5\252E\020)8_"
+	.ascii	"et\334\226-\252\027\r1z\366\221[\215[\306\213\030,\271\253^\256"
+	.ascii	"\316\221`\002v\273\251\201\0247E\355\242\306\221\031\323\222"
+	.ascii	"\202\267\354#\322\007\006g\025\216\213\033\025*\252\0263\315"
+	.ascii	"\315.\322\220<\n\303\244+\347J\214\244\263*W\265\\uK\261\222"
+	.ascii	"K\322\340\254fQ\323\316\255\2524,\260\340\2349EY\302Y\275\242"
+	.ascii	"\236I\225\315\255\301Y\265\242*\215\230z\224\341\374\020j\264"
+	.ascii	"\322`\340\254\266\251I8\034},p\276\272\205c+H\324\224\263"
+	.string	"3\225-\267\270I\037$hxI)F\306\223\253lW\327H0\341moZObpV\325T)\232\312\227$QpV\241\250Q~\365.\241\201\306\002\347\013 M\253i\352Y\226\337\025\0348\253h\006\260\201\006G\032\234\257*\265\342\200\024\301\031\337\267\241?i\340(\t\362\305,,Lmr\003\305\002f\372\315\371EQ\315\2566\301nn4\226\274\341\254\222\251eRFH:\3741:^b\330\230\340\254\216a7<)`H8\253b\330\355\356\214\253*\311\245K\224\237\315Z\020\2650a``\352\022\024\251\302\314\221\037\313'\0301\266\252\344\352\222\2771i\222|\0359\242\"A\221+\262\216X-\327\034U[^|]E\242E\205\026\245!\002\030\242\205\374B\324\"7\221\266U\025Z\246F\334\020\325\210\016\t\251\022\271Z$7Q\272\215\301Y\365Rw\334\360\242\322\303Y\035r-X\251E)K"
+	.ascii	"[j\256\376P\243\006\271\310\004@\375\210\033\222\337\346\304"
+	.ascii	"D\251\\W\203\250;\350\274\034\351\300Y\005\242n)\271d!\263\245"
+	.ascii	"\303H\026.\234\237\352h\264\340\303Y-R}\350\027Z]\270\340\254"
+	.ascii	"\032\251=\302\310\322dQ\217\256f\375W\251\036\251Zzo\252\253"
+	.ascii	"\242\274\021\336~\304\r\321\201b\342\242E\345qU\013\205K\203"
+	.ascii	"\206\007\316\327Sw\330"
+	.string	"\\5\245\331\242\356Pu\234kYKs\030\316\004\263\222\264\241\006g\365J\305Z\311\244\220\t\303Y\305\241\346\310A\203DF\231\215*\365F\217\036P\376pVm\250V9VW@\2241\250\324\032@i\350\310pVg\2504\260\330\224!{\310\030\352\324\r_X\336\023\234U\031\252\224\032f\264L\202\363\005P\364\244\302\320\2313\"E\f\316*\224\032\265\224\245\206\004\347{pF7\251N)\026\"GI8\253/\264\23207\240 qv\2412]5V\334\266pV\225\324\245{\326\325\342\t\236\212\324\361\201\224\273\302\371j\222\332\342W\321\2679\026\033\347{@\247U$\225\005\017\264\2755\234\357\301\026\355\201\025\255\377\256\356_\265!C3\232\302\371\036D\321\277^\363\2538F\220l58\337\003'\372\036\210\365\375}\332\257\347\252H\017\215\301$G\325w\023\206&n\t\232k\277\033f\006\307D\237\361"
+	.string	"\306\3355\336\235\336\373\b\311#91\022\336\230\302\366\3726\222\n\304\3326\306\005\243\314\365\336\265\036\t&\274\r\213\330R\r\234\257\315\254^:\312\216\340|\003\214IAA\221\371\257\346<\235\201\022CF\347Y\351x\221\327N\262\275<\271\345=\340\320\345\231\205\031\363\253\246\023\026\013)8?"
+	.string	"e\364\003\36067\247\303\364\200\002\243q\277\334b\214\321`\256\303\264M]Y\206\341\254\351\264\335\177U\257-\361QdWw\257\260p\312\361%\347H\271H\311z\362E{9N\232\230\036v\333\202%w\324\026\027w\335\230N*\262\275\031hpp4p_\021\026^F\264h\321[j\234\177f\3168\275]o\301\321\233\022\227\366\265#LnPp~"
+	.string	"\256\262d\271nWC\362H\256\251ko*\0207\\tH\0358?"
+	.ascii	"1\256\\\271n=WE{h\025\323\221>\034+3sgp~\007c\326\330t\225\274"
+	.ascii	"\264\367\321\b\311\243\272\275\251@p`\353\033\233r]\345\272\215"
+	.ascii	"\004\023\336\006\2015cI\250\374*~\362\246\267\004\347w@\247\257"
+	.ascii	"w\322\370\257\352\034\361[\242\303\371\035X\321\357\200M\377"
+	.ascii	"z\311U\352%Z\rDr\027\331\204\021R\025B\316\224\032?\256D\311"
+	.ascii	"u1\220\3348\357\374\256\370p\326P\256\323n\256\254\212\260\310"
+	.ascii	"\2023\032\225\322\230>\234\337\301\230\376U\303C\270\224\331"
+	.ascii	"-\265\231f\242\305\310\352\226\332\f\037\301`($=\251JdoK3=v\262"
+	.ascii	"ep\264\267\225\215T\t\223WU\237~\242\317\264R7\321N\256R\233"
+	.ascii	"i2\325\r\253\213\336M~\0077\364;p\322\357`I\207\351$F\242\204"
+	.ascii	"\313\r\347s\200&\214\003<}\016\272h\260\203]\274;\266\235.\026"
+	.ascii	"\025\214\247\276\275\251@\240F\354\256\234\322\220 \301~W\303"
+	.ascii	">\302S\323\345\004\311\314\016\234\317A\231\376\365\021}\004"
+	.ascii	"\373\335\344v\272\177]\250B\260yA\267\217\210tu\351\"^=\272N"
+	.ascii	"\030U\250l\021\271.\242\032\201\352Bz\375W\323%N\222\344\320"
+	.ascii	"^z\b\325\234\224!o;w\265\035y\023\202\032\271\2523S\207\3639"
+	.ascii	"\340\241{\350\036\232\353\212W\215e\326\242#\t\016\r\344\232"
+	.ascii	"\013\315Bf5Fo\211\351\025a\323[\372G\323\022#\266\244\233\033"
+	.ascii	"wSr\370@\367\r\025"
+	.string	"&<38\237\003\251\254,\315\203\001B\322t\335\240\3258R\267\343\232\207\f\245\030\025\316Z\207I\206\313\253\206\033\007H6l\350\034\327\260\367>\332\333\312\n\265\221\346\305\367D[]\347\300\241\251\352\372t\340\254\257\250hh\361\341\374\017|\372\206IF\314Y\024\026\234\377\341\213\236\241g\350\032j\362\322*k\256Xh\032\3275\344R\245\270\344\324\007,\372\327Sz\ng\235\310m4\204\203\265\265\017jZ\206\226q\305x(\223\307\204\255OS\371R\344\204\363?\210i'\355\244a\220!@\033T\025\210SY\005U\245a\350\250\035\245\0271\2424\224\336\027 n\030\312\306\251\"\005CL?} \242\177\335\244\233\260Z\005O-4\271X~"
+	.string	"\242\223t\222^\202B\265\334\033\023SR\272^\0323\345\207eC\273(stDK\273\320H\"d\354\266\256\340\2209\235i\241[\234Q\344\262x9\303\371\037\256\326\254\321H?\264,c(Y\300\035]#\265\035Y\362\300\302Y\033\351mz\251\262\326\002g]\244\267\222\027vsz\357!\361\375\320\373\317\203\2140E\376\314\263Sy#m*F\2324g)\216\027Y^\340\374\017/\320\240I\367\302(Y\227\224\234\371\300\371\033\360\365\365\245{G\212\230\260})e\351\373\303\371\033x\321\251\231\324L\272\327"
+	.string	"\264\036g\225\243)3\234\323=\2710\272:\234\257g\342\375W\321-Ni\320\340\374\r\262\220!\223.\303\330\350\302\031\003Cj\017\347o0\005\017/]\242\315P\317\204\001cZ\232x`\216\300\005\301\371\033\244\335\255\3512\013\003\346o\031fg\247f\271\251\250@\334$U=A\303\371\033\030\241\373\202\322\345M\245a#=\001\323%D\177\003\037Z..\235\353\021f\203\035\372\033\\\351.]\322\261k\003\212\t\333\227\231'\345\021\316\337`*\345\222rI\307\bP#'-\311\316\r\347o\340B?u\273\351\333\333\327L\344f\261\306"
+	.string	"!86(\322_\273\030io\243"
+	.string	"\234EfYcX\322\2644\213\251\204"
+	.string	"\013\3446\362\032\341H\021"
+	.string	"\316\350\003"
+	.string	"\317\212\0253\214\223)6ZH\2672\234\017"
+	.string	"\271\2666\363K\317\330\216\312\341qTf\331\267\367\225\020r\220\370\316n\340|"
+	.string	""
+	.string	"\321O\245\334\224m\312\327\356Nz\342\240\224\343Z\002\300J\037"
+	.string	"M\372k\377q"
+	.ascii	"r\200\200Ym\341\3744\355\246Q\322R5\224\356\356\244'u\t+\310"
+	.ascii	"R\203?}\r\360\364/J\2076i\222\242\365\024YCq\220\351aE\371\024"
+	.ascii	"\355\r\357\253\017\347\353\245OV5:\370\222O\316phd\301\355pb"
+	.ascii	"\306\245c\306\316\230\341\234:\221++K\307f\254a(]\264`\340|\r"
+	.ascii	"\332R\261T,\035k\362$l\251\321b\034\221\215\241t\346\034\232"
+	.ascii	"\2270gJ\224\244aA\2726\025\025\210l\343h\211\306\344iX\236R\005"
+	.ascii	"J\f\234\323%9{z\313\036o\3132\326\300\336\276\276\276\322$>\272"
+	.ascii	"p\236b\f\271\201\344i\022\033+fNcc_\240\266\300p\276\006[\251"
+	.ascii	"\221\324\210\335\215\256MU\005\002s\251\022\003\205\3635\300"
+	.ascii	"A\204\310u\2730\2040a\373\272\262\246\013\033"
+	.string	"\316\327`\252\253+\035r\241\240\230\260}m\252/\020\027\016\312\024 B\236\016\321I[Kf9C\260\243\310\332\037\027\327u\353\371\303\361\005bE\353rz\201\3633(\243\377t\353*\323-\023/'7\024\252&v%\004\323/\313\016*r>|\\7\"\034L\330\276z(\215\025]\331\261#\325\272\373io\252\006\220\371\260AC#U\005\354jm\371\224G\\\224\335\306\371\031\234\245X)V\232\225\334N\026x\251j.\262\260\322\254\267\345\"`\226\b\301\371\031(\3217R\0347\256\256f\210\351\264\351 \223\302\371\031\b\321\317\340\206\376S\0336\314%=c;*\0035\342\206|\355}%\204\025\313\f\030kp~\006F\372\351\214\233\326Hk\230K|\366\316\262B\241\24008\243\177\315%h*\225R\245RSS{(\224\020*\0208Mihs8\037\0031\372\030\\\321\177\032\343*\323\030XM"
+	.ascii	"kET!\244`~L\201\341|\f\326\322\243\364)=J\243\236B=\215R\301"
+	.ascii	"\304\316\316R\244\024)u\302\373\312\351\311rSQ\201\2703\272\274"
+	.ascii	"p\245KO\235\322\027`F\350\272\322\027iS\\W\230\022T\316+\310"
+	.ascii	"\\U\312\204\243\334\364\302\222\340\234"
+	.string	"\266H\225\376\253f\023.h\2208\377\251R\352\202\n\333\327\221\231\244\215<\257\260\024y:u\325\350\3039M\272r\\\232\324\315\341\234\262\320k^\314@\n\373\257\336(EM\261\302\371\030\210\351c\340\343/-\372\273n\350\3367y\345\364\264\251\236@\244;\335\327\355\356'.80\200\241\177\201\236\376]rQ5JT\315\r\353\331Ey#\b\021{J\206\360\013\276\370\371]7\275\367.\322\260\217\356\356\272\236\2349s\351\356\336oE_\372G\371P>\234\005B\303F\272c\352\332OO!\374\002.\375\243zW\211\352a,\020\333\310\210\203\265.O;\204_\220U\246\314\025s\367\223\tnB\2444\232\207\346]<\037,b\027$\351_$\027\305\373U\242x\350\\\002\364\204x\340\273\273\273nN\200\204-7\325\023\210{\240\013\023\346\372\341\275\367\356J\225@\222,\3274j\207\332\335\277\004\264\255\305"
+	.string	"q\017I\364\032\372\305D2]\211\021\331{k\270VU\246\264p\276\007/\215zY\263\262P)\203\363=\370\320\250\334\323\223\252\"8\337C\225\376Q\270\243q?\332\005u\232\341O\r\037\3168w\007=\325|\216\302\331l\251\262\f\343\202n\251B\313\321\004\347\267\364\212\316K\035\316\367"
+	.ascii	"\245o\336\215\273\261\034P\262\270P\365u\345\305H\3235ufK\255"
+	.ascii	"\353i\006j\343\302Q1\340\013o\271\343\355\346I\241Yj\271-o\036"
+	.ascii	"\f5Xu77\021\342h\242\r\n\211p\001Q\0304\252C,;T[6\206\226\215"
+	.ascii	"\201HH(Bk\242\204p\030\324\323\006\2110\300\002\021\265\302\266"
+	.ascii	"\215@\313\306@$$\254\200\310\002\242\2608\202\033\024?,\fC@D"
+	.ascii	"\351MX\320\002\201\204*+$l[\266\004\360"
+	.string	"\304Oq\370\203SA+$\212\030\002\"J\3316\310\032\177n\"\004\t\341\020\210h$jYc\221\250[\241\n6\337D\b\343\211cp\004;$\002bM\374\034YcN\t\242\320\330\0369\030\333\366H,\376\234AAv\230\177\212C`\221h4\262@\240\206\240\264\r\n\031\213AhPK\024\032\207P\240 k\f:\201\210\302\024\254\021\035\016\3316\350<\301\262\307\240S(\310\032\333\243\020+\004$\262C\305\034!V(H\263\302\023\305\342\217\r\221\035*\002\005\241%\234\220\226p\202\312\002\201\240\331\2410hH\250M\331cq\370\023\204\262D\341\220(,\022\365Oq8\f\n\241Dv\250\030t\336D\b\021~\200\216\"X#Q\033d\2034\334D\210\016)\212F\023m\221\230\236\370)\016W\030[ \017\020\221\215a\b\210(m\205D\241z\342G8\302\202\226\250\310\n\tG\264\354\221\307\346&B"
+	.string	"\005W"
+	.string	"\221\020\016E\b\321\001\b\024\\\001\2043\034\022\021\211Ebzl\211\206\200Da;\024\022\221"
+	.ascii	"\002s\216-\321Pno\"\004z\004\352\224\b\266&\013\314\200\206c"
+	.ascii	"\211\340"
+	.string	"\220\002l\211\340\221he\215\301\024@\306\240\005p\206C\242\026\204,8\361\023l\217,0eg\020\306"
+	.string	"<\361\023lc"
+	.string	"\022\205,"
+	.string	"u\200\210B\t\334\260F\242\326\030$\322"
+	.ascii	"d,n@(h,Q4\276p$j\203m\fl\211\340"
+	.string	"\013\3541h\234\200N\313V\340\007(\210#\224\342\005\265\210\302\310\306\320\262\025\020J1tsD[!Q\304\r\t\242#p\030D\301\n\t[\233\223\303\021\210X\374aYX\021\034\262@\033\206Xv\270\242\350\b>:\223\020\242=\006\207hKT4\017\020\242%*\236Z8\034\n\205p\3306\b\203\220\360\230\246%\2048\252\025\260\271\211\020\354\211`\020\260h\\Q\342\347'\bB\004\330\023\301\2405\307\204\020\032pN\b\301\n\t\333\366\030\034\352\260\255\361G(\2043\f\262F`\t'\034\213\304 \361\206\002l\033\374\021\002\021\205:6k+$\2120J\2408\242C\313\036Y\030lN\374\024\207)\260\306b\n1\350\264B\242\b!\266=\2568\256@D\366\250\243\202\210\027\210\302 \013'~\212C\233\023?\305\025\326\0256\334D\210\242\020\250=\362\030\215,P{D\201(\240oN\374\024\207\304\f"
+	.string	"-\020C\004V\240\300\316\021\325i\205D\021\0348\214\020\2425\006\207Bd@\203\022D!\221H\004C\212\3410\002\306\"\005\2161\b\245\030\322\240%\212\320 \224\342\205\243\312\016\201\204j+4n@(\305\020\216P\212!\235\234\243\nB)\2064X T4R\240\230\202P\212!\016\354\220\004Q\021\bm\201%\234p\023!T\030E(1\264s$\"q\314Qa\\\207\202B?\306\323\310\002\tQ\024\215C@\254\n#;\034\"R!h\0304\261\262@B\243\221EQ\004\022\205\037\200%\210\206C=\033Z\366\310\032\201\210B\022\3006x\004\n\021\031\333\023\354\320\021\203\033v\030\374Y\205?F \241\320I\024\n\351\023?\254\211\037\025A!\255s\034\006Q\f\213CF\266%\212\3701v8\262\254\261\004\253\002;,A\214\200P0\005\024CA\025"
+	.string	"\r\213&\216\254\321\304\b\266\r\242\020\266?\021`\201\212,\030\205\301\036\242\360\207=\022\001U\004\205\200*\2146@\025DA\240\212\240\220\316\321X4\032Y\036\324\206\035Z\321n\360\020\024Tl\211~"
+	.string	"p\024\252\b\002K\020\221`\201Z\242!\242\260\003;\264\242\005\262(\204m\020\205\320\310\002e`,\266?\301 `\261%\n\002K\020\205&\332bQ\350\b\3741\366"
+	.string	"\025\205Fv\b\03044\004\262BAc\020\360\307x\004\n\217G\243\007 !\260\025\022\211p\332c0\b\bD\024$\001$a\250\302x\324io\"D\006F\266\305!\n_\030\006\205F\366\270A\305\b\0250\244\255\206\022C\034\214\254\220p\004\020\313\341F\003\261(<\032Y\024D\021B)^\330 \224\342\005 \366\207\270\342H\314"
+	.ascii	"{$\312i\217F\"\t\260G\"\234\025\306\226\025b\207\354\210\r\303"
+	.ascii	"\342O\261-\032_h\215\305\241#1h\034\301\241\0041H\242\025J\240"
+	.ascii	"-\2328\252\300\036\211t\332\026\230\036K\004G\024\205\350\021"
+	.ascii	"X"
+	.string	"B\030D,\246\200\202U\3418$z\301\310\266D6\005\rl\033\204A(\305\013,\220\005*\262\300\032\211\206\302`\020\016\013d\207V\214h\217,\021\tX\030\214,P\2608l\213E\022\035\332\023/\b\001\005\241\306`{\\w~\332\237V=A\024\256\300\266\301\366\250\216\370\021\032Y\"[B\277\204\023\fp\002\n*\322\243\240\200\021\0240\002z\024\024\340\343\243\200\023|\364O\3601[\240\261m\2039\255jdO\030\213\033\030\002\"RY \220\210\023\307\340\210\240\237\365\304Oq\205\241bq\005\2420(ts\023!\332cq\bH,\n\t\025\177\202mP\005\241\242q\210e\327V\207XB8\f\002\201\351M\204 \341\bT\301\266DB\033\200(\020\230\032Yb\212\"\020\230\036\215\354\221\210\b\004j \242\360\004\020\210\036\211\302\241#\020\230\022\213\302\243p\310\002\201j\013l\217\302\241\206\233\ba"
+	.ascii	" \326\0304q4@\002Z\025,\221(4\321\016\001\201\035P\260\306! "
+	.ascii	"\020\005\242@\224\235Ax\004\002\321\023?\305\025\326\"\n#{\274"
+	.ascii	"iO\274 \224b\b}\013<A\024\2560\004D\244\336D\210\023D\341p\b"
+	.ascii	"\210\210\003#\213\302\310\306p\024j\240 ,<b\242\020h\004\002"
+	.ascii	"\n\236\370)\036mZ`\360h\263b(\024\n\006\001\211\302\343\332\002"
+	.ascii	"\325\326X\034\272\211\020D\241\b-K\024\266,\361\202\264\005\252"
+	.ascii	"G\324\b\004\024"
+	.string	",\032\331\031\200D\341Q\243\370a\215\2715\026\207\262\021\b(\230O\020\205+\b\245\030J[\240\261\035j\211B\"\265\005\222p\200\242qE\t\365\bD\301\252\360\363\023\324-{\342'8\004\024\002\nZ\205\307\342\320\315\220P\260UW\f\031\201\306\340\220\250\0041\b$\022\022\366\314\260B\205\221\035\262??A\2401\310\022\205C \221\220\020\2036HD\002 \261(l\203-\221\025\032\213@\"!\241\0053\254P\001\\\321\n\177\212C\026\305\315M\204X\300\017;tl\201\254\220\260\005\002\365\017{\004\242h\321\026X\202X\034\036\201\303a\360\347\270\342\b\004n\370a\217D \2126\235\300\n\"(\220o\"D\373Cdl\217\"\034\331\241\025\255\b\307VHB\004\"b\t\003\250 \"\n\207\006(\341\004\340\t(\250\020\201\005\"\032\376\020\205\"\030\217D\" \200\004 \366HD$\002j\324\330\016\335"
+	.string	"\005Yc\216\261\035\002\"\262\300\033 \"\013\f\"\"\301\036\203$p\330c\220\004p\210\350\304O\220\004\320\005\021@\035 \"\013dQ\004\217@\027D"
+	.string	"o\216F\366\2041(\004\324Da\320\304\017\020-\022\331\2410\b\230\222p,\021\034\006\001\323\026\230\002\r\213@\033\242\020\321\260\370\0034\022\375"
+	.string	"m\330!\211`\213\002\230c\f\232\370\311AD$Zc\321\304\021\250\266@\027D"
+	.string	"\327\023?\305!\360l\201%\234\020\024T\004\002\325\"0uA\004\320\246E\361\303\002\025\177\200\332\005\021@\234`\033\004\002\262@\302\024\300u\002+\210\240"
+	.string	"\320\005\021@\335\036\205C\234 \"\022\300#kdYc\020\360\246\005\2623\b\217\250\t@\301! \020e\201\212B\300\263\005\266\306\342\013.\b\245\030\322i\201.\210\310E!n\201)\030Y!a\233s\023!Z\242\241\226\250\b\024J1\024\304\252\300\016\255\030\001dA\304\b\033!ak\266@\030RHAH\330j\343\317\2179d\211\304\240\211\237\224\035\006\177bX[\366\030\024\344\002{\034\022\r\331\244(\016\203\214,\n\027\330\037c1\b\347&>"
+	.ascii	"\261\354\320\021h\223\036\201\354\217\020\005\253\302M\204\020"
+	.ascii	"\341hdQ\b\215@\030\2748\304\032Eh\213E\243\b6\304\024E\240\226"
+	.ascii	"\310\304Q\037\201#4\200\323\n\211\"\332cqH\027G\f\203D#\333\252"
+	.ascii	"\230@qDkdQ\020\213?\034PvH\"x\024\002\245@,\034\2059\2551\330"
+	.ascii	"\306`s\266\300\023|Z\242\220H\267D\021l+4\246\320l\313\016\207"
+	.ascii	"\204\212)\260m\020h\210(\207\035\222\b\216@\201\266@\024Z\242"
+	.ascii	"\220(m\211D\305\237\023\210\235A8\f\n[!Qh\003\304\246-\260\325"
+	.ascii	"\367\361I\341"
+	.string	"C\006Z\250\200\376\t\261\302\b\0211\210\320\262%\214\301V\004\2420($\302\217\361(B\210\r\216,\260B\302\021\354\220D\2208\001c\261-\nm\030\026\213\022"
+	.ascii	"\236\377m\202\250e\260\2326\327\230\234\306u\206\007\004\214"
+	.ascii	"\316\227\0161#[\252\226\034\"i~_?2\235\315\325\021\220/>\324"
+	.ascii	"&vi\306\220=\324%:J\320\314\335i\251Hn\023\336\215\"\0369\013"
+	.ascii	">\"\226\225\264#\210\271\243\tZR\007\032\267\303L)#\013e\302"
+	.ascii	"\211\313b\363\202u\246\0312\263\004L\216L\346Jq\311\335\300\221"
+	.ascii	"\261\334\2109\301 ru\362\345\253\253\033_nh\335`\2513Bb\225\341"
+	.ascii	"l\220\246 M\331P\275\250T\316\216\244\251R\213\364\260\362tg"
+	.ascii	"S#\357\241Lb\322X\330\320P\375\326\257*\035Vlf\244QUH\344\256"
+	.ascii	"Pi\277\272+\035LS\030K\207\220(`6R\350\034W\r,2p\024\035:\030"
+	.ascii	"\177\312\030\351^\231\2303j\2229T_\326\344E\251w\032L\031\264"
+	.ascii	"#\250u\016\373\270\332\321\345\351D\273y\342%D\213\323\331$\347"
+	.ascii	"k\252\355\354\305jv\272\311P\003\325\264n\252\264,7\246)\223"
+	.ascii	"F\030+D\224n\263tu\315\256\bI\306\305y\003\263\300\373K\202T"
+	.ascii	"\331t\322\224Tm\2658s\330\260x\322\302\"i\275\nCE\315\317\206"
+	.ascii	"\305:\003\306\326\023\266\253\f\320\037R\222t\341\374\253\264"
+	.ascii	"9Z\2218A\234\334\340bc\264\205#C\f\225-6Ez\213\231\264\037k6"
+	.ascii	"[W\301IVUa\373C\323P{Z?\326\234F\374\326\224uj\222:|fl<\322\254"
+	.ascii	"jI\240d\351\300\031\255\273\271\212CRE\rM\0256!7\206\254g\326"
+	.ascii	"76*\274 8\243u7Whb\244\270\370P:\0265\360\362\326\275t\354\006"
+	.ascii	"S\2138\275\025I\325\226\026\016\234W2f\n\376\376\376\376\322"
+	.ascii	"\354m\264\222\301\253\231\265\314W2\327I\353\276\220Fh^\305\254"
+	.ascii	"b\326\345+0\372\261\3665\361\250\362\025\357\353\362L\022c&\016"
+	.ascii	"\347u\314\333\264\337\223\2609\234\327\273\267\245n[\260n\200"
+	.ascii	"\260K\242tXuv`2\217\365\310\031.TvX)H\033\223\253\323aT\276\270"
+	.ascii	"\266\252/\231\r\357\360[r\264\322\3551)\225\035\301\231\313\317"
+	.ascii	"e\235\253\240\f\323\0324'\300\201\314\262\312}\235kK\203\034"
+	.ascii	"Iu\301y\205[\343R\254\035I4\326\270\265\013\016\036hjh\2602?"
+	.ascii	"\326\340\314\345\312\225\365\r\313\306\305\337\0179-_\337P\254"
+	.ascii	"\270\260/\234W7\363\313\231U\306\n\027\316k\026,T\326\326\326"
+	.ascii	"*=W\346\2272e\226_\253S\322\325\216\266\257U\350\374\326\354"
+	.ascii	"\341\274R1\303\360\345\361)\301y\235\202\261\312d\274\331\300"
+	.ascii	"ye\303X\252\030\227\031`X]f\266\212p>\210\263U\271*W\265\236"
+	.ascii	"\253\242=\224J\023\026\023<&)wQ"
+	.string	"\276\252\271E\321\323\303y\205r\265/\273\034jp^\323\256&\246c-\016\347\025\355j:Q\304\352~T9\371z\346D\357\365\\\025\345\2350\305\024\266\367\265\221T \260\036\230R\023\020-\306\376\261\325\214\217)l\017\177\021\3434\245\354\253\231\210\035H$\234W\262\263\310\246\314\213\333\030\234\257w~m\2650\302\204\363?@\263\202\255`k\262\b\214F\224\r7d\330\327d[\323\2130\0308\257L\264\335\216j\321\204\363\272\344w\367\007\232\022\354v\345\255\214\f\327\327.\256\025\311\035\333N;PLk\320|i\027I7(#_\221|\375\272\0213f\017\356\210\236\262\346\345e\025\262\026q\313\202\306\013\347u\310\352u\225o[\327\252\316`\301\371\037L\321*\332\320\264\r]\203\230\2559\276f\2559\326-0\235,;\322\376\326\036_\267\276\376\270V\212^(q\376\352c\325\322d\252\260\244\251\261\362"
+	.string	"\263\352\272[y\254;\214\272,Arn%\3230\033K{\325\261b\rYk\2545\326+\036y`4\364\023\213)i7\276^\375)\306p\271\341\274Zi;6&I\220p^m\234\001\211\212\250\224\003OTG\312\013\243H\222\251I\222S\2161VC\334\002\363\025"
+	.string	"@HH$\022\250\3020\346\001\024"
+	.string	"\022j\274\226b<\"la\030DL\031\020"
+	.string	""
+	.string	"\004"
+	.string	"@"
+	.string	"H"
+	.ascii	"\004%\301\301\226\316\r\315\274\252R\332\203\3167\2367R\307y"
+	.ascii	"1\346C6Z\n\325\363\2709\tP|\236\257\017]\271\213\312\027\346"
+	.ascii	"\333\244Z\215\306j|'M\312v\202\346\002\340\fcY`\242\356\nf\337"
+	.ascii	"\326\245j,\341\243\210\234?\303\373|#rMH\362\330sHzE\262h\350"
+	.ascii	"\261f\0319\370\027\213\302qZ\222\365#\247\230\243\033\217f\263"
+	.ascii	"\205\221\263\230\020\344u\263\034II\204\320keapo\rdG\366\301"
+	.ascii	"v\2528\001\374\2479b8\242{\314 lw\310;\032\321\332\016\252q'"
+	.ascii	"\343\206\300\347\210\346L\034\351.\341\245x\362-k\224.\351\227"
+	.ascii	"\035D\ng\247\217\260z\013\0210\350\307o \022\257\356Ab4\370R"
+	.ascii	"\254\025)Z7\347\3236*\223PFk4\232>\206!\323W`WBK\250\360\264"
+	.ascii	"\264<\260\020\007\017\237P\224\f\324&8\213S\273]>=\360~VF\375"
+	.ascii	"\016\255\252\362\223|\320s<\262;\311O\300\376H\377Z2\346\335"
+	.ascii	"XNY\323\ru\327tX\26223~aS\240D\200\237h\205QP\200N\321\251|\226"
+	.ascii	"\333R\327<\177@D\242*\372z\272Y^\220\330$ \374\263\330\331\351"
+	.ascii	"\221\036\244\200\310\324\260E\006\"IKy\276e\375\217\007B(\251"
+	.ascii	"\032\003\036\347]F\023F\275qe\247*\304<\244;\025L\244\274\362"
+	.ascii	"Xc\\7\370\325c\350\177\022\262\365\037\362\302\375\242\322q\271"
+	.ascii	"\007\213\034@\300m\321\335\005\327r\331\002\006\303\375*B\372"
+	.ascii	"\2160\237\002\232a\221u*z\002~g3\013\266\360e\222\253 \2078\036"
+	.ascii	"\374\342\205\200\220G-\343\350\006\035\006h\263\t\207\357^\333"
+	.ascii	"AQP\212\025N^\232\031N\315\223\275w\240]\252gX3\307\034\275\216"
+	.ascii	"\004\367\355.\263\240\322\252\356\225\252Z\311Y#\270\262(\307"
+	.ascii	"$\266\204e(\342\252\307\310n\356\374\274U\0239{)\022\222\023"
+	.ascii	";\277\233\3019\177\2513\260.\024Ql\313x\204\211Cw\3165\260\212"
+	.ascii	"\346\2608\360\312}N5\352\311\350\260\310\334\324|\321\202t\030"
+	.ascii	"3_\211\273\312R\226\204\260\216K\321\267B/\"\302*\217\265d\177"
+	.ascii	"{\212\002\327l+>b)\251\333\250}5\363\364w+\017\f\235\215\316"
+	.ascii	"\331\247`\272\016\b\344\016d .\240\202\277\352\323756\003\373"
+	.ascii	"X5\323\244\317\374\331k\260(\004~\362\313\275\315\022(\371\036"
+	.ascii	"\336df\347Eb:\006\226\301p\301u\356H\360\"\013\217c\214u\225"
+	.ascii	"\017\354\312\214\361\202\004\226xxH\354 j\200]\3045\036\002\305"
+	.ascii	"\376\246\325<\327\fG\f\344\002\306\330\351#8\370\351b.\223\013"
+	.ascii	"\330\255\303\311\253\\\203\217\336DUM\242\240\351/\214@^\376"
+	.ascii	"'\301\316\273\370\r\002\235\363\256\365;\214\300\331cY\311\243"
+	.ascii	"f\031DIUp\231I\204:\035\363\321\026r?4]\034l\211D\236`}\303\207"
+	.ascii	"~/\317\2241\004\236\367\231.F\376n\275\370\231\353\323\324BT"
+	.ascii	"\323\177\255S\242\304\320\261\351\2743\260\206\324\356\226#\005"
+	.ascii	"\027O)\352Tb ?'\\\355(\226\253\264\302\177RC\233\216\301\272"
+	.ascii	"\220C6\274\213\213"
+	.string	"*\221\345\316[h?\0368\335\360bl\215S\215\037C:\r\236\357S@O\276\021\273\353G{\301Y\362\320\013\205\3564 c5\346M5\223\200\335gH)i5u\247N\225\264\036\273\207\304y\177t\360\221\265\207\247T\331&-\343\322J"
+	.ascii	"\366\fNx\362\215\253\001\345\021\223\236a\b\351\374\365v\206"
+	.ascii	"\221\260\005\233\201U\334\200\005B\t\244k?z\b\307C\255\2176O"
+	.ascii	"o\237\212\252\230\350LB\317;t\003I\2354\305\262\345F\250\250"
+	.ascii	"?\214\022S\212=_\301V\252\006\317Gu`\251c\305\361M0\340\307\257"
+	.ascii	"\bZ<&+\243|\374\2640\230X\n\203X\214\213\355\333\364\334{\253"
+	.ascii	"\037\242\243\316\344 N\027\\5T8\266p\323\rv}\241h\314\355\365"
+	.ascii	"\202\033\201\022\302\327\336G\366\244\016\335\215\344#\0033\335"
+	.ascii	"\200}\271\255\3503.\357\2254\314}V*\343\343Y\237\f\030\265\325"
+	.ascii	"\256\350\246^<@c/ g\3303h\006=\372\274\267\b\215\245\313\031"
+	.ascii	"3\356\203\317P0\247/\2106\215\036\347\321\255-\304b;0&)Zm\256"
+	.ascii	"\333\213\375\227\203/hJ\241<\364\352'_S\205\211B\216\016\320"
+	.ascii	"\352\\\207\222\322\375OJK!ox\300\374\370\336\313\313\347\247"
+	.ascii	"R\200,\317\241`\201\211\271\325\030)\261\260\257\256\001\240"
+	.ascii	"< ZQG\242\242\244N\036p\331>9\350\273dZ\203\216"
+	.string	"\320\320\367\036\254i\201\210\214\340\222z\377\342\023B\272-T\302\257\363\361\314\327\355\367\262X\204f\262\036\376\343\322A\204i\t\254\307:q\323eGs4\305N\267 \375\302\3726\266\354\252\247-HQ\217@\224a\252\252N\002\301B\325\017\335\373Gh\034\0078\215t/\266h<\342\226\3473\023\211\231\240\254\300\230N\b\342h\355\213\205\261\225\333\tp]%}\326B\334)Y\345rT\031\021\375\337\257\033@\273n\027\337\037\345IX\242\bG<\021Z;$C\020}\036\313\373P\352\007q\274\264\204\263\2108\303`\027\350\237\213\270\226<\203\311\027\312\306\270'\336)\351\254\224\330\255\227v\355\373\266`\205$\034bq\224\313\266\235\265\264\306\020\266\005\234\346J\002/E\310J\325&\234\363N\031z\005\177\364/\373\334\020\020GpYV \346\274\201\004\273\023\357\344\267\306R[\245\024\0235\033Z\370\306\256\223"
+	.string	">\231\302\234\220\377g\r\253\211\374*\345U\253\323\242\201;w\025oSQ\245\250\035=,3\203p\207\333\322I\352\303\333\001\246\270z#\345\202\301`|\222Z\307\205\340\365\336\375\030\343J\362-\225\302\207vO\037\"\370A\310\r\335\304\202I\232Sg\237\314t\321R\351\001\202A\243Ov\376%\214\207F\271\373a\313\031\341\202\3306\306\326kC\264\230f\352\377\243dt\331|\342\211E\214y\1779\244\255\035N\355\251\201\345\306\\\340\307\241O\340T3a\004T\"\343\223\017\255\214\333\317O\211x-\t"
+	.ascii	"+\332#s\3572\277"
+	.string	"~\263\230F\331[\353\253&h\022\337\030\251\017\251\332\245.`\005&s\021bM\26792\217\221\204\221I\2624@H\336x\200\366\312\b\377\344S\024E\327\243v\304\314\230\332\033TY\253\224\347c\223V.v'\250YMf\031\177\031\304Co\256t\317\216\327\307\304\276p\272,\251\336\007\214|\27410\241 q\245\b\007\230\354Q\335\370\340\217\223\004L\227|\265\326\005B\335&x\302\212\377\342\362\374\315\"\215\310\307\232\272qp\355S\372>H\211/*\310\t\323\234\365\334K\360\205\2114\352\225u\202\366Ix\266\020t\265i\2735\213\355[\tR\301\214z&\216}\206wy\255\371\327\324\263\261z\273\214\300\216\0344\217o\2056\036\017\b\214[\332\224W\351J\217\006\343\371\320K?\363\002i\215\271'q\276\335\207@P\3622\036\023{oiK\030-\326\316\245\017$@\377yS\006(\t\030\364no"
+	.string	"\244\3537\005Z\206T\227\\\377\001\362%S\353[\021\371"
+	.string	"/\352\261\241\002\221\202/\325\211\353\001\242zW\261\221\002\331\016\333\367\r\211\034\352.!x`F\026/>\260#z\333\013ip>2\\]\240\330\214M\021\027\266 \226\344"
+	.string	"\202^\b\321\272\202\337)\002\202<\nd\205\267mpE\216\327\030\302\201\215!o\224\253\004\267\322\307P'\2245mP\324Y\022\201`\262\343=\004\200]\036\2216kMc\326Lf\353\347\016\336A\037\315\361\234\025\177\362\277X\024\227of\024\357\023\362\017\212\307\343\367\037c\"\361\221\222\3405\006\273\315\276ja\225$\212\244\341\020\312\224\362\202#\323\272\330\037\305\023\031A\016\223\205\264\376\021\335b\332\254\263\031G"
+	.string	"\374\\I\342\004\322'\326&\315PG)\367\220\257\213\307\202\216\356\371\372\"\017}\232\220\345ff\036\2244\"\006\271\r\177!9#\t\n\264\001\366\325D\256\267<D\030\373\357P\252\324\227\330\034\254z09\355\345\355x\226_\376Pp\200\020en\372\311\357\363\226\230@\0213i\354\306"
+	.string	"WO>\202y\365\r2\206\347\3346e\206\214M\365\nd\306\304\232\030\236\024\312\205-\205&\267\\\013\201\243Y\357;\177\036\027\316\007x\036\200\351|\252\310\025X\222\034\032})\241%\275g\317u\2157J\017Z\204\277H\220\325}\3471\032\362\177+\333\272\205$\212\363\315A>)~\016\221\367\344\337\246]\254\001.@\353\256%\250\001\314\374^\357>\301~\bu}#o=\312\336p+\034S\242\344\307ih\320\025\261\2159\222)\030\275\200"
+	.string	"p\362\023~\376x\t\013\312\037\301\300\237\207\t\326\203\223ZX\005\371X\363O\345\241J\313\215fIbR@.\003`~\314v\340\310\223o\177*p\275H\325>\300\n\223T\211\356\255\344\337f\242\226\213*\226\256M\025\031\315)("
+	.string	"\326{\206\323\2657;\244\212O2\275\307\216\037\213\230\0178O;\273k\027s"
+	.ascii	"\016\266\360~\004t\214\225\242G\013n\235\347{\017\276{S\324\027"
+	.ascii	"\302c\253\234\n)\330\032\251\3463S>T\232\215\337\032\261Ez\373"
+	.ascii	"\2258i\216\361l\211\243j\310Dh\357\361 \347+`\3532k\274\215+"
+	.ascii	"`3\257\333\240\277\374g\327\377<.\001\033\013l\026\255\366h:"
+	.ascii	"\237\034\026\2423\256\212\307X#cUNu\335\221\036\304\374\223t"
+	.ascii	"\2626m\2022\202\323\007*\201\022\013D\353\262\343ta\275\203\316"
+	.ascii	"\270\265\356w\256\374\037\355\246\351\n\006\377Z\306\321\234"
+	.ascii	"\323\r2\253x\340q\267\316y\261P\365\270<]H,\370\001q\021\303"
+	.ascii	"\340\002D\305\245fh\223\375 ?$(\201\366x$n;Y\233\030U\253\306"
+	.ascii	",t\346\231\377h\001)\203\302\212@\276\"\006\241\242\342K\200"
+	.ascii	"y\036\030\312B\364\001\357PnR\276tr\345\210Vf\302\350\220\272"
+	.ascii	"\023\032;r$F\2768\203\215\256\003\025\342\024\202\261\256C\255"
+	.ascii	"\363~-\to\204\375<dtt\300\253\232\263\031}\2777\301\002\216\336"
+	.ascii	"\035s7\325,Pw\326\216y?\005\264\265]\331\317|<g\302\252!\342"
+	.ascii	"\261\320\373\202R2\337\371\203\003[\323Of\243u\036\311\016\343"
+	.ascii	"p\375\304\b\rt\254\357\032<\240\b@\213\215\265\354\301\304\304"
+	.ascii	"\232B\266+3\373\247\253I\031+\330\375F\017\255\032\273e\323\343"
+	.ascii	"\202 \347W$\336\376>2\245\253\344\366\252\3203\204\037\220\250"
+	.ascii	"\221\364\177\332\023\237\342\bP\363j[\231\321"
+	.string	"Z`\032T\322K\215\332@\220\034\315\350\240\312\345n'=\224,3)A#t\031\204\233|=\2068\024K\356]\bjDUp\356\252\335CXli?\367\025\242\364\254\016?8\260\362\205A\227\0016\2446[{gU&Y\2762\324\310\366\264\372c\003\233lEh\213\306\005-\214\223\274^X\207\254\304^.\330J\351\220Lr\322Xri\200e\321Qy\003>Z"
+	.string	"Y\006\363\213\213\345\305\217\203\353"
+	.string	"Kc\340C-s0\222\273\005\232\247\3229\222\255\026\253\202\327\304$\221\337\033\317\206\365\203\235\3412\246>\273!\f&\303\022\\\263l\306\270\020+\020\233\334\326\221\322\024N\244E\201\020\204\276X\227\036Q\342\254J,\342m\"\271^\211\2677L\277\311\221\241\006\374\033?\362[\021\323=\004'8\313\277p\203\004\261\270&!\350\020\036"
+	.string	"\365\340-F\330\025\236$\233T8\210\331\277\001n\374\226U\374\244+\226\npi>\312\31242,\264\231"
+	.string	"\002\244:\371\356Un\323\206d`"
+	.string	"\034\274*\210\232\022\310\025\256h\026\204Q2\237K\342\030;&X\245\214\222\342 \017j\345\374\234Jo\024\022\332\324X-\211\013\221]\020x\b\204\216M\312o\266\341\032dg\004\020\346A*F\307\001\275\035,\2675\247a\254\300P\346\316pDL\037kT\277"
+	.ascii	"\254\256\374\330\025n\222\273m\331\354$_\213\277\261m~\030bn"
+	.ascii	"\036K\364\342%\233\370\253\021n\037n\032 D\217\220f\235hR\203"
+	.ascii	"\350\216F6\007t\200\270\026\0177Kf\336\202\271\254mY\313\346"
+	.ascii	"\320\312\255C\n[\274\023\221\340\303\246\234\253\272\224\243"
+	.ascii	"\242&\363\262hl\221p\314\367\\d\214\255r\245\033TJ4\246\333\237"
+	.ascii	"9J`\322\200\314\3462\324\222\326G\273O\202\023\305w\307\302\251"
+	.ascii	"\207\277\bz\333<\331Z%8\363-5\232\224\374)\342\"\346}y\234\""
+	.ascii	"F{\240\253\001`\322U\177\3279\004eiJ\207\007\"\341POc\253\365"
+	.ascii	"\251\236\310L\252\001\326!w6\270HJ\370\364*\326\034\245\024e"
+	.ascii	"\241\345\016\277@\254\334"
+	.string	"\311R\260\230\267i\374\344V\253\205@\036\030z5+N\374ia\3403\024Z;i\250j\324LS\f\232\304\306\263\221\344\207T\305M$\270Bn#\033vO0J\226\264.\275\261\006\375Q\307O\227.\"\213\3045\037|\254\352\r\334\255E\033\032\264\217I\244\253\356;\3719bd\361\266\211<\271\363\330\034\375\030E\bu\026\302\272\017y\n*\313\032[\357\201dB\374\336\211\333=zCz \377k(8\332\231\202\374>\356\002\255\331\207\355\317\337\235tLd\371\321\367\335\021\022\356\227W\322A2\300\204\362\264\036\324P\370GLb(d\032a[^\225t\231q\204\373\374\3471\250\314\321\033\303;\353\203\315V\302\217\3020\344\263\037\322\244E\020\247\326!oG\333LVN|\242X\375\036M\376\032\270w\275\256o\205\0327\007y\343\223\364\301\232\005\027\306\261\372\3724[\023\326\003\376#\302K;\262_"
+	.ascii	";Iq\305\0231\267CG+\376w\374\3338kn{\230\223mpf\250/N\256\242"
+	.ascii	"\274M\320$\2035\271H\230\226\267\370y\203\017}\326\347H{H\301"
+	.ascii	"\017\0275\270T,\261\224\345\217@5yR\331\207\316\370x\214Uzy\221"
+	.ascii	"AS\001\317\234p\311\367R\204\f\224:\261\233\332_\007\276\212"
+	.ascii	"ps\271\003\234\264\251\217gM|\240\363{\017:\242Mcy\375\363\333"
+	.ascii	"\200g\301,\351Kx\231\207\315TM\001tZd\372\035\371\354?\344J\201"
+	.ascii	"\205\312^\331'\265\027X\321\366>\001Y\316\233\357\322\3507r\307"
+	.ascii	"\rorp\004s\346\325ZLrs\232\004\265\302\214BFx\037\257q\265\251"
+	.ascii	"O,n5:g%\230\337i\367\301\234.\202\223\264K\255\305_!\357\362"
+	.ascii	"\343\204e\230\266\0330W0i3g\332\314\003\026\206!'\034\016s\r"
+	.ascii	"\321\027\356\230\026=\026\\\243\307\314\02288\346a\311FhL\375"
+	.ascii	"v\353\266\276\2734\250N\034\376\313\242\246y\006\307,>\2030\330"
+	.ascii	"\250.?\265\361%\rdb\032\247\225\332C\363<\271@\306\322\230\375"
+	.ascii	"\3653/\256\250\212\312\f:u\306X:\035\337\366\267\021T\377\301"
+	.ascii	"\373\362\370|YJ&\003\306\\\260\217+6r\353h\370 g\303\na\215\030"
+	.ascii	"\2564>\021?B\352DJ\255\003i?\314b\240\372v/!\335\247bd\030]\f"
+	.ascii	"\026|'k\322\245\201g\211'\335\321\004\330\036\254*\260\n\367"
+	.ascii	"\366'\215\366\005\027#x5\031Lw{\240\357?\312\023\330\3411\250"
+	.ascii	"\211\013\016\361\360\225{\030^Yt\266\310e\336\214\3067\240\365"
+	.ascii	"\226\340@\330\027F\306\360\025\025U\213\224\242+\245\305)\023"
+	.ascii	"\237gKs\3146\001\324\227\025\334zK<\370')`\243\222\346~d\005"
+	.ascii	"w\003PG\210\022+<\033W\b8$o\307\006\022\364\"lS\315\341\275d"
+	.ascii	"\201\030!Zl\307=\334k\351\323]\003\220\330\362\177\272\364\004"
+	.ascii	"\366\360\253\370\242\3535}\346\275Al\032\255\325-\314$\202P\330"
+	.ascii	"\304\206\035\n\022\272\250\b\267\3007)\307zH-\022\230v\311I\243"
+	.ascii	"3\251\221\357E\346_\210\201\272\346\273\374!o\323\f\017\323\037"
+	.ascii	"\236|\305\234\303W\31586\332&)\373_}\037\204\003?\250t\214\373"
+	.ascii	"\267\350s\007\034\363\2203\236\0324C,\277\201\017\304\276\342"
+	.ascii	"\231,\200vPsf[\377`g\347\271\370`\264\247\241&h\367V\312\360"
+	.ascii	"\222|]r\3505\306S\222\337\334?\337\362\277\370\303,\352\265\261"
+	.ascii	"\277\324\230\305I' \304\266\371\247\263\253\306\334\006\345\310"
+	.ascii	"\002rg\0059wV\n\312\201r\177chrh'\303\340\226\036\355\226gC\356"
+	.ascii	"\017\271\204\f\322\363\177\373\261\373CR\306\211\372\021*w0\367"
+	.ascii	"c\233\261UGsT\343\314\276\345\301\017\275\271\263\373\352\351"
+	.ascii	"\200\304\035\"\374\223\365=\362>\325w\327\265=\225\371\254o"
+	.string	"\270\334IL\277M5N\002\2766n\013?:4ef\222\207\351\tj\333\357\262\222\220\333\353H\326\007Z\335\231\377k\266\236\312\207\225\003\247\361\337\343e\247\363\001\376e\330Z\360V\224\374\223\373\366\264\366\307\3427\221}\340\231\202<WJ\322O\251i\0352\276a\334\317\320\277\205\361Q\310\027a\215f\244\367\213H\f\037\373%\3718\024\336J\367\364\210#\034m\307\376)=8\336\337\271p\236j\332\n\370%\237L\264\217\367\212'3L\327\206\313P\234\"\037g\375M\236#\276\002\307\306\316\243n\252\243\353e\226%\366=\306\260\3365\331\267m\013B\242{\273\346\202\270\017\206\227\324|P?$`aCx]A`\017'\2175\355\324x9^\227\003\3427\340\3655Q\243\253\276\323k\n\022\230?\"\207\2041\005\364\225\313\3100\b?\305\005\225\3733\227ox\324\032\223\365\311\346\333\177\261\340\t\240\250\327"
+	.ascii	"h\020@\234\005y\327\315\375\333\200W-\333\253\240\211\232n\n"
+	.ascii	"\032\210\355G\321r\017\337%G\337\016?\214\007\234\b|V\207\341"
+	.ascii	"\007\241\303\324\004~v) \213\273S\233h\257\250\273(\331\033\315"
+	.ascii	"\326ov\201\222;>u\305\3035\343\331\372\374\205\215\277\357n\327"
+	.ascii	"?{p6\274\347D2V\246\324l\220\372\300;\337\222t\b\310\367+\234"
+	.ascii	"\254=\336>\346\213b\026\351\306\373\315~\r_\342\343\017k-\230"
+	.ascii	"\\\222\335\344\261\210uE\212\372\251\274q\316\267\335"
+	.ascii	"X\271\365?\223\377\023\316is\213\346\203\377"
+	.text
+	.section	.gnu.lto_.symtab.8812338fc493b5af,"e",@progbits
+	.string	"motors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"lockMainPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\003"
+	.string	""
+	.string	"sendMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"indicateFailure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\003"
+	.string	""
+	.string	"nanos64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"micros64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"updateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"millis64_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"micros64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"millis64"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"microsleep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.string	"delayMicroseconds_real"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\003"
+	.string	""
+	.string	"timeval_sub"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.string	"servoDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\004"
+	.string	""
+	.string	"motorPwmDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\003"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\004"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\004"
+	.string	""
+	.string	"uartPinConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\004"
+	.string	""
+	.string	"spektrumBind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\004"
+	.string	""
+	.string	"_Min_Stack_Size"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"_estack"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\004"
+	.string	""
+	.string	"timerHardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"eepromData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"fakeAccDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"fakeGyroDev"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"motorUpdateStartNull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\004"
+	.string	""
+	.string	"dyad_shutdown"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"dyad_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\004"
+	.string	""
+	.string	"dyad_setUpdateTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\004"
+	.string	""
+	.string	"dyad_setTickInterval"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"dyad_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\004"
+	.string	""
+	.string	"udpSend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\004"
+	.string	""
+	.string	"pthread_mutex_trylock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"featureIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\004"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\004"
+	.string	""
+	.string	"fseek"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\004"
+	.string	""
+	.string	"ftell"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"rewind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\004"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\004"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\004"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"pthread_create"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\005"
+	.string	""
+	.string	"udpInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"pthread_mutex_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\005"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\005"
+	.string	""
+	.string	"udpRecv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\005"
+	.string	""
+	.string	"pthread_join"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\005"
+	.string	""
+	.string	"pthread_mutex_unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\005"
+	.string	""
+	.string	"imuSetAttitudeQuat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\005"
+	.string	""
+	.string	"fakeGyroSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\005"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\005"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\005"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8812338fc493b5af,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,176 @@
+	.file	"ibus_shared.c"
+	.section	.gnu.lto_.profile.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 %\255"
+	.string	""
+	.string	"h\031"
+	.string	"\001"
+	.string	"\303\370\326\315\t\b\002"
+	.string	""
+	.string	"\002"
+	.ascii	"9\211`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 \031\205"
+	.string	""
+	.string	"@\r"
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002"
+	.ascii	" \223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 z\345\002"
+	.string	"\"\305\021\035\240'\351\237c(\340\223\306\272<\227\343\370\350\352\302BUU\227\200%\032\361{K\231\002\277a\333^;\200l\230\030\016\212\2726D\263\346`s\022\330\266\345\017-\022\b\207\240p\34367\275C\217\204\321"
+	.string	"\374.\004\007"
+	.string	"-\245^\302p\271\226b\270(\323R\354\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\002\001\001\017\177\002"
+	.string	"\177\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 $\325"
+	.string	""
+	.string	"\220\030"
+	.string	"\001"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	":\3427\200\005"
+	.text
+	.section	.gnu.lto_.lto.c95f5bfb443c2fcc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isChecksumOkIa6b.36.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375`X\004m\035"
+	.string	"V\267\276I\260TN:}h\264A5\256-,\275<\245\320\364\n\335\025\273S0W\020\032X\372\202\244\325o\224\263P\377AA\211\366A\263\221\366\363g\217\232\246\235\031\357\275\360\001\2031\376pp)\346\035o\024\265\266\t!D\356\224\002\251"
+	.string	"\240"
+	.string	"\256"
+	.ascii	"\025\350\305\333Gvi;\234\367\031yk\355\005\177\265^)p\2049\355"
+	.ascii	"O\335\307\321\251L\\\246V(\255_\255>\005n@/\332\367\232\361\""
+	.ascii	"=m\274\330\300\301\221\221\356\223\321t\251-;\254\260Z}\265\215"
+	.string	"a\230`0\030|\350\273\303\211tJ\216b\270\023\311\257z\330\343\t+\367\225\305K:\035\360b\305\323I\035*\236\346\030\036\350-qz\341\355\302\232'0\246\274J7\305\220\\j\272\361\302[\n\037\210\201q1\361r3\314\341\364}\327g\022,V_Y<\247ORB\255\3253\005o\305-\273\355\035\2669\330\341\204\\7\315\267n\232\247g\350\264\f\235\216\271\357\207\231M\277\234\352w\t\247\313\331\364lN\313d\323\364\277\233\244\323\343lZ\234\323\241lze\323\223N_\300\r\226\022\251\261\375\362\325\246\340\226\352D\344\222\372\357\337\372\271\276\366\375#\347\362\273\\j\035\235\310\267\374\337\221\270\034rtu;\020[\370\021\326\233\252\265\226'\342ke\275\310\355F\n\320$\0254\313\n\225\r\364\342Nx\363\257>\304\345\261\036\344v!#h\375\321\335\226\024\260\013\364b\314\274\335\252h'\311W\233 "
+	.string	"\235L!\270\350U\027]<]Y}\005\001\346\304\215r\331\302\306X\223i\246w]6c\254\312\346P-cTs\203\301\217\030q\226Igi\226\302\022\024S\314\264\325\331\205\022\326Zk\370\002#\315\006\330\353"
+	.string	"Z\321\365n\026gsvz\351p\330\354\315~\007T\312`\263g\252Y\227\005\260\327\361\310\315\240i\266f\337\365\020\b\314\262\003\256\220$K\274\335(\340\213\306\227\245\355\251\350z\271{\371\030\3715|\023\343\305\227=\222\033\210\201%\367U\244\205\322\f\332\276\334\334(\373\017d\210\201y\241\354rZ'@\016\016\235\276\231M\333\314i"
+	.string	"\262\351\232\007@\027*\272\201\350\261\375\364P[\t \r<8\036\037\372\203\373\020\302\0264\342l zx0\314\334\263\300\307F\304\363s\353p+\362"
+	.string	"T3\"\302\331\204lA6\\-\004\020\217P\255\207\350V[@\300C\"lD5\334\320\020Q\255\364)}\241<I\004\237c\202\2273\273\243\2649\227;3\322\215\n\031|i\321 \027\3122\033C\257\314Vf=\203ft]Vv\202\332`\351z'7f\311\247\334\f\236\306b)l\fC\234%\307\375n\325\025\r\253(\342\216$\214h\255\3655\304]\227\r\221N\033\347\356\036f\347\216Lv@z{\215\344~\037O\250A4c\020D\002e\024\tl\002\022\205\205i\fp\002\021\252\354\001\021\260\251d\270\255,k!R\312\205\247\313\2040\307d\b4\307"
+	.string	"9\366\320\013\217;\374(6\321\r7\331\244\300#\325Pf\233\2215\r\2056\343H\272\203\031kb\343$\210?m\266\035\027G\262\331\307b\027\233T\3300\021\207D\270_\233  M\004A8\335\274\020\207^\013fj\272*\371\231u[\373\312=\327Xh9#\306v\232\372>\277\305\330s\177\340\232\307\212_|"
+	.ascii	"/{\2178\206\017\020\177?\211\312\fVoGq\206+\373H\342\264\341"
+	.ascii	"A\212/\345\245\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002$\177\002\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c95f5bfb443c2fcc,"e",@progbits
+	.string	"(\265/\375`S\003\365\032"
+	.string	"\2266\275L\260\224q:\350\337\n\n\206\201\376\333a\316):\240\211\301>\032\216}\270\335%*.\n\322 Cf\333*\321&\373\226Oz\f\374\363\210q)|\270\343\001\224\371&|h\333\271w"
+	.string	"S\027\225\346\243\305N5\214\237m\322\023\"2\005\230"
+	.string	"\244"
+	.string	"\250"
+	.string	">\023\n\250[l\222\362\244\242m\321\372\202bj\177\035tM\376\265\220M\313\326Dj\241\356f+\345OMQE\034\177V\372y\007\037q\222\n\025Z\273\251\373\266T&xL\021\021G\346\301=\370\3220\322!\344\\e&\335\243\356+\20054Tc\025\307\343\224g\037'\300v\316\305\362LC\362\220i\310_.@\226L\200\374o\363?\301\377\001\377\033\374\227\372\237\344?\323\177\016B\376\263~v\361\337\351?\322\377\244\377\252\377J\376\213\303\341p\370\177\303\377\243_%!\335\227Uy\354\212\026\332\266\210.9\325\264Y\263\205v\253%zv\267k\253h\333jL\313\232}Y\263\274\2556\257\317\265\205\362X\025mY\225\321\266\323\346\235\351"
+	.string	"\264W\265[\226\n\243\227M\321vU[\350\322\224\272\2644\245\202\235\240\274>\321\363\235\351L\020\275k\013\273\271\t\250\323\232n\337\232\n\317\025\374\264\013\236\330\001\317\225ow\037\350\355\212\326\346\005Q\243\265\333h\327\323\275\b\346\r\366\f\016\2321|-\004\324\215\240ow\257\333\344\016v\267\331\335/\251\357v\263\230A\177\275^7\221\201^\007F\345\331\206T\r\207lC\376JL\021\223'L\304\361\314\226\347\226\227\316L|\231\211\235\316\273\356\027H&\230\303\240\250,MDt\303\202\2416\371\0019;\375\020r\030\310\352N"
+	.ascii	"c#\207\023 qd\240\310Bx\310\031\310AX\274f\340\330}2/\b\300\274"
+	.ascii	"`\025e\343T\"\307\327Jnb%\030\037\215*\\\304\361W\370\307\177"
+	.ascii	"\230U\021\226)-\323EG\027-\342x\017\245\370\223}\246\335\215"
+	.ascii	"bu;\335\261\310\237\317+\346\233_\206U\\\363\177\354\226\221"
+	.ascii	"\321-$\234*q\0209[\210\343\177\005\275\nv\331\236\0019\036\330"
+	.ascii	"+\367C\323\225\263\\\254\246\223\325b\262\326\031\3346bvs\345"
+	.ascii	"l\266\233+\246f\263Q\340Y}\200\3050\210\320\340\243\303\211\220"
+	.ascii	"\315z*\340h3\227\321n\263\237Y\210\362\021`\016`:$^\256\263\363"
+	.ascii	"`\347\001y\235\235\327k\007\366*\017{\251r<:\271\037\232\356"
+	.ascii	"\345\257W\005\005\0352X(e8 f\267X\017\216\007\247\373@s\225\270"
+	.ascii	"\345f>\263\332,\347\372\241\305|\\\262\033\316\205S\363\247'"
+	.ascii	"Nr\301\3546o\017\001\270\021%hK\226&Jo~\206:'A\302B\251\036P"
+	.ascii	"\304\221\213\260\021\2766|\344\034\305R_\235\267\257X\203\013"
+	.ascii	"\020%q\234\341\002\244\310\001' @\002c\024\242\344\001\221\b"
+	.ascii	"\367\177p\207,X,\335v\257\360\343\313\245\247\265j\007hcXT\203"
+	.ascii	"]\020i\232\315^\017[\367\207-.\270Z\244\250\266\213\326\035\200"
+	.ascii	"t\224\003\n\243\021<Q Y|\300\016\236\232\002\351\352Im+\263>"
+	.ascii	"mW`\354,\311r\303\332\311\225\035j\315\342\265rP\300\203\204"
+	.ascii	"\230\fC\001"
+	.text
+	.section	.gnu.lto_.symtab.c95f5bfb443c2fcc,"e",@progbits
+	.string	"isChecksumOkIa6b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c95f5bfb443c2fcc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
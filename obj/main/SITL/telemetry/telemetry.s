@@ -0,0 +1,590 @@
+	.file	"telemetry.c"
+	.section	.gnu.lto_.profile.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 i\035\003"
+	.string	"\224\005]"
+	.string	"\f"
+	.string	"\236\352\207\307\t"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\376\262\204\322\007\002\002"
+	.string	"\002"
+	.string	"\004\241\363\344\364\n\002\002\001\002\002\005\006\354\301\314\336\005"
+	.string	"\007\346\273\301\227\n\002\002\003\002\004\b\240\342\234\212\n\t\352\263\360\321\b\n\371\262\376\364\003\013\374\374\321\314\003\f\240\342\234\212\n"
+	.string	"\002"
+	.ascii	"\006j\274\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 D\365\001"
+	.string	"$\0038"
+	.string	"\007"
+	.string	""
+	.string	"\003"
+	.string	"\002\001"
+	.string	"\001\002\001\003"
+	.string	"\002"
+	.string	""
+	.string	"\004\002\001\002\005\002\001"
+	.string	"\002\001\020\002\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\005"
+	.string	"\001\006\001\001\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"\017\025\343f\230\033h\003"
+	.text
+	.section	.gnu.lto_.inline.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375`\270"
+	.string	"u\006"
+	.string	"r\313!&\220'I\007\177\251>\026/\365\256\216\237\246/dc\001b\374\270f$\356\366\375\261"
+	.string	"^D9\024!\273m\"e\n/\212\372\\\230;\206 \201\013)u%\327\200\202\235\234\316M\256R\332\217J\276\0319,0T\002\026\003!\270\203\n\3734q3\025vz02\027F\342*\200~)},84\320\350d\352\267\226\bf5\270si#\342\361\020pS\357\356\f\377\204\371\246^\302\3351\276\317\3058\356\316\376\314\206\033"
+	.string	"\211\013\261+\230\016\027s\224\024\025K\356\311\244\b\354\031\221Y\301X\315\260\262\f\243\237`\004\262\271\203\2336\3002`\306"
+	.ascii	"c\226\252&\226\256\177C\bdP\021\004\226=\025F\267\334\346\"o"
+	.ascii	"bV\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 Y\355\001"
+	.string	"B\304\f\025\260%\351\207%\311\243\035\215B\030\006\307r\303\215\354\266\211L)\0223\343\3110\375\322@\230\331,?:\360f\315\214\237\256\323)\323\3312\2406\225X\004\002"
+	.ascii	"\365i\336\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\230\004\001\200\004\002\230\004\004\205\004\005\200\004\006"
+	.ascii	"\200\004\007\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 _-\002"
+	.string	"\024\003S"
+	.string	"\005"
+	.string	"\002\001\374\007"
+	.string	""
+	.string	"\001"
+	.string	"\004\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\f"
+	.string	"\001\002\005"
+	.string	"\001\020\020\006\001\002\007\001\r"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"Hel\025\r\240\002\343\031\001\204\bJ\333@\033"
+	.text
+	.section	.gnu.lto_.lto.af0143bb773ed8d0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.34.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 \246\265\004"
+	.string	"T\bk"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\276\232\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\324\007us\250\347\006uq"
+	.string	"\005\001\006'\001,\005\001\006\035\001'\001\237\340"
+	.string	"?\202\210\2008om\302\001k\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.string	"B\313\306O\331\005\223x\212\272o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.36.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 x]\003"
+	.string	"\"F\027$\200K\322\0013\260\026\217\2379H\214\304[\034\306m\267\331m\232\315 \023\021\205V"
+	.string	"\003\324}\357\326H\222\001\205\322Q\307\020\316\024\326\030\316\303\231x\2438\027s\030w\032{\034\347\343\006\271E$\177\330\3052\350"
+	.string	"\374\236P\360\273\025*\374*)\255\257/\374\002\214-\300\257\330\026\021\004"
+	.ascii	"5S\200\346\274\254\201\0018"
+	.text
+	.section	.gnu.lto_telemetryInit.37.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 \3075\005"
+	.string	"\"\211\",pU\323\001"
+	.string	"\355W\340\257_7\227/\346\n,U\205c\304A\202\354s\262|?\tl\257\252\216T\003\366\360\201\n\035\337\332\275S\n\236$\310\274d%\031\362\322\006\265\250t\232\017\225\016\266\034r\352eYS#/{\354\fY\324lO\203\261b?\260\261\263ab\277P\341\263;\t"
+	.string	"X\217\240\223\261\375\310\230\r\272w\331o0\022\316\267\273\032-\307\0161\377\232\0236.r8P\354\256\341\306Q\356x\333\b\333j\233\n\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.38.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375`\201\001E\020"
+	.string	"\266\036nG"
+	.string	"\261&\035\363\220\002G\343\314\251\3643l|\033\030L\032\273\251\255\220\345\362\337\330\316\033&\311\246\311\324\230\266\226\351\017\266\034\264\212;z\004\315\245\277\364;\t\232\337-\350\201<\351~\231r\247\310\232%{o\271S\nZ"
+	.string	"U"
+	.string	"]"
+	.ascii	"\266Mz\2602\353\241\f\3540?/\034\237ZCnG\234u:\345F\226\377\330"
+	.ascii	"%\215L\215\017l\235\212@\226O\020\313\245T`C\007\307\bT\221\036"
+	.ascii	"\260\231o\003S\342J\007*>.#P\203\004\360\363\222\361\330\343"
+	.ascii	"\n\350\212Q\213Pku\374\300\r\267v\333\025lK\260\017#\276\254"
+	.ascii	"\265Vo\214"
+	.string	"\275\321\233\350\241\315O\347\303{7\372\001\n\320|p\201\311\261<a\205\315tT\331\3341\361\360\267W~\314\233\037\262>Za\205\221^d5\013>\r\001\024\243\375\232\253X\335\346\304\241ZC\364\344\324\0322p\003\320\347\307=\350\247<\001\372\031\257\226\273\370\213\316'\341\021\323\364M\3643n\210\005N\212\026\2248\303A\321\241\304\024E\373\224\212\377vw[\t8\300\334\220g\321\257w\323\243E\0017\241\366\005\f\361\337w\324b&K\331\226yrl@\254\001X\216\233\031)\361\307\377\t\245\253-\351\205\347\265\343\2123;l\305\025\341\"\035\t\205\022\252\323FP&\257da\202\312K\225l\016\001\311\340\251\272SG\322\2518\224\251t\342B<\023\016\004\201S%\235\307\251R)\217\333\302zY7\306\217=tBgf\212\326R\356\212\254\210\021\265\235\273b{\356\350\363 CY\027\335V\264\217}"
+	.string	"\215\327\216\377"
+	.string	"\215\273\255c\036"
+	.ascii	"i\355\213\231\351S\257}\253\355\235B\373\252+\241L|/\302\252"
+	.ascii	"\302h@O\241\241\025\253\rV-\247\325j@\212j\300\311\004H\346u"
+	.ascii	"\\\206\241b\030\254 (a\310\303Y-\230&21\301\212q\252\031\232"
+	.ascii	"B\277\272\317\250\203\212\002"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.39.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375`~\001}\017"
+	.string	"\346]iF"
+	.string	"\261&\035x|\362t\210\263\247\023\2325 K\326\263IH-\214\243\212\247\205o\022\372$\325S<\355\330Z\007\f8-Vd\325Q\315P\004AQB\035\274u1#D\316pT\016\034\300\263#d\357\275eJ\001U"
+	.string	"Q"
+	.string	"V"
+	.ascii	"\3632\373\200yi\333\n\026\220\\\372\367\241"
+	.string	"\345,\227\225\031\235\335O\203\036^\372\224\021j\3117}\302\032)T0Nx\035.\343\201\227\025\251\016\027*\031\036/\203F\217\207R\030\300\323\020=v\367\257+\213wR\305Dv\327\272\301\343pc\267\r\262\r\301~L\273\273\206+;\252\261\250\236w\375\362\255?Z\255Q\375L\302\f\035\032\006lv[n\330\330\026\022E\b\333$\333c\033~\037A\272k\0249\026\245\212\271\331%\001\342\006\331\245GT\265/\3422\244\267R.`w\265s\263\373\2018Av\351\357\035\001\023\262\020\270hTH\270\302>\232\022\022\310y\261@\351\216>B\226\211c\236VLa\327\3355A\177\314\t\377z\366\342\225\203\322\035\373\373\307<\234\320\272\342r\262\205\227\be\273(\006\376\f\312\205\f\346\322O\231\227\207 R1^dZ*z\303\376L\nY\366c\3356\341\203\302u\0210t%#\237n\013qT\370P"
+	.string	"q\016D\035w\002\300$!\243N\264\231l%\233H\003}FL4\222.\244\205\0240w\262u\232\210\343:\315\363\355\343\302\2255\276\346\n_\363\211\323\242\261Q\2774\377\372\003\034\030\032\033\371\227\246B\026\333\n-\242\002O\001\035"
+	.ascii	"i\355\333\302th\315\302\240\355\240\231f\b%\nq-&\f0\003\004\f"
+	.ascii	"\006\301eV\221\200(2\342\2261\341D\215\025\263\341\225\254\360"
+	.ascii	"\3355\320l\202\303T\fp\245i:\f\026\3452\341*\260d\315{\333U\364"
+	.text
+	.section	.gnu.lto_telemetryCheckState.41.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 \307\025\005"
+	.string	"\"\211!)\200k:\300\234lj\324\\\363F\203:`d\257\026"
+	.string	"\377\267\245\335\260x\377\360\253##\212(c{\004\t\025\337\332\275S\n\236\244\307\274d%\025\362\322\005\225\250t\232\016\225\n\266\030r\352eYS\243n\0379\002$F\354.\203\261b\037\260\221\263ac\277\317\241\263;\t\201\226\023\330`l?2f{\336]\366\236F\342}\273\253\321r\354\020\363\237\371@\333\262C\001bw\r\265\215r\307\3336\330V\333T\t"
+	.ascii	"i\3317\323\342\234\031\002\276\3345<-\204\3612\004\270t\213v"
+	.ascii	">\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.42.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 \374\235\006"
+	.string	"\242\f.2pm\032\003\240}C\255\210\332\207\356\335\226\267\251\324+Z\022zf\250I\201 \262D\354\326\224\034\212\376\335[\020\246\211|\262\334l;H\223[\312\224\002\220\322(\310\r\214\361a\222:e8QB\n2@\3716\232\005\352M\321\341e\006Z5\300\370dU\305']w\003\025\023\321$\332\253\303\232E\353\350\377\333@-\343h\204N\016H~\212\024\224\227\270\221\f\251\255Y\353\rsLw@\364\362W\204\210\374WA\r"
+	.string	"\3540\026\250\330E\016\250\330u\266&\2760n\020k\342#\364\377\265\013O\263Y\333\303\027\313\3231\263$\374/\263<\037\267\271-A[\204\266\237\t"
+	.ascii	"i\331'\323b\242f\340\302\t\230w\t\200XM\001wy\321N2"
+	.text
+	.section	.gnu.lto_telemetryIsSensorEnabled.43.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"E\t"
+	.string	"\366RB:@\305(\035\320\271\027\357\33433i\306!p\fa\305\376\f\360\004\376\007\332'\325\3246\246\217\365\260\304*\313rt\031E\321i\001}\020\304\304\250\354?\260\336\267\273\233\224)\0051"
+	.string	"1"
+	.string	"/"
+	.string	"\227\023\304C\333^` \271t\257#\365\225\253;\031\260\353a\272z\351Y\362?r\030\200\365\241T\026O\214\303\356:Q\252\213[o\373\300v\307\366+\255\037jZ5\235\232>f \244\245A\300n\352{-\013T\001\261M\2625\2663\355\263.Bz\253\302\002\273\032()\273^\202\0252\207\233\027\304\303\247\374|M=\200.\303\332MB\231\335\355\370$/\341\374\217CO\214\362\250C\177\024\017\257\b\036-S~\266wJ\345\260\177\331\335\265n8>\233\306\2012.\332\303\241\330D\331'\213\310D\030\b\342\341\203y6\016\343\030X\223\3106L\244i\033\246\361Lw\324\215IO\366CQ5\352\273\025\250\251\252\030W\207\021\n"
+	.ascii	"i\331'\323\"\f\273\207\263b\2328TMwA\345\252\366\017\035\314"
+	.ascii	"\230\332I\006"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.47.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\245\013"
+	.string	"\246TLB0\211*\035(\304\243\030\301\361+\240d\364\242\315Ix\fU\\o\331\321\036\n3\203z\202\263!\224\261\253x\004\005Xe\324\242b,\326B\330k\001\245\017\243\020\256\021..IN\n\240\266\211\334)\0057"
+	.string	";"
+	.string	"8"
+	.string	"\232R\211mg4&\213/[\251\027\230 2\223Pk\331\235\256\201\213\337\271\211\376\246\025a$O\337\317>G\022\300\247\345\033\245\242\326\352J\200\233\336\366\306\266\205\375\214\257X\3510\322\274\250(\001\264\235\366\313/0\035F\332\312J\376\201\2126q\352M\345\364r\207\311\351\366\206\211\311\177\231;\365\023\210\227SYS\031U\315%qj\212\312\351\0218\023\250\005\361\356\262lS&\303G\023\333\343c~\374>0 k!{\232\313\362n[\335\225=/\273O-\021\020jMU\240P\tP\007\007.\373c\267\257\240\344\313>3\027\034!\017\310\351\300\b\301O\304mx\037\rN\310\243\270\203!\201\241\007\362>^\330\205<\034P\327\001G\035\006\302\237\310\003\273\360\373\300\216\373Vw\345\273\032\220\314\357\334\021\333s\027\306\001\265\032"
+	.ascii	"i\331\267c\3435j\007]\215\f\310\003#\\\207K\226\021Q6\226`\024"
+	.ascii	"L$f\001\034\tv\210\313s\021\013'\223U\207\226%\257rj\325F\234"
+	.ascii	"\013\326DA\235\366`6\036S\316\273\312\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\315\005"
+	.string	"\204\bM\001"
+	.string	""
+	.string	""
+	.string	"\002/\177\016\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 %\177\017\272\200\202\002&\177\020\005.\021'\177\022)\177\023\002*\177\024+\177\025\037\026\201\204\005(\027$\030\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\"\031gistry"
+	.string	""
+	.string	"\005 \032\001-\177\033\377\037"
+	.string	""
+	.string	"\200\200\200\001,\177\034\003"
+	.string	"\r$\003\002\016\240\276\320\347"
+	.string	"\001d\003\002"
+	.string	"\363\243\231\"\001\242\001"
+	.string	"\023"
+	.ascii	".3\f\237\"\343g\3527\202\341\362\273jLrn\314J\3273V\206?j\020"
+	.ascii	"\200`\016\002\350\001~h\325\016@c'K\300\r:\230N"
+	.text
+	.section	.gnu.lto_.refs.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\006"
+	.string	"\001\007"
+	.string	"\b\001"
+	.string	"\003\013\002\b\002\f\002\n"
+	.text
+	.section	.gnu.lto_.decls.af0143bb773ed8d0,"e",@progbits
+	.string	"(\265/\375`\017\036=\214"
+	.ascii	"\232\343x2S0R\312I\007\251yjz\256\246\373c\377\362\272;\277+"
+	.ascii	"sU$,\026\021\260Yw\301\217\220\225U\367\316\226\teo}\360~b\250"
+	.ascii	"d\023\232\226\253vDz:?\030\346\366\252*\254\322\"\210*\253\352"
+	.ascii	"\264\"\266\210\264\262<\357\376\377\361\236\f\262\267L\001\237"
+	.ascii	"\002*\003)\0036\332\031\302\336h5ZPT\026=\n\004\307\220s\207"
+	.ascii	"H;/\257C\244G\223\370\227\r\376-\203\217\272(\265G4\215\224$"
+	.ascii	"8\264XcX\377\300\023\007*\213\225W\3079\363\347\036{\300\245"
+	.ascii	"Y\364\367\006\374\253\304\267n\360-\035\276U\303F\335\346\357"
+	.ascii	"4\255\246\313\\\310Y\200\007\350\244|X\264\327 \275\331\020\245"
+	.ascii	"J+f\016\302yylF,\n$\206\217\327EiP\023\245B\026\013\267\231>"
+	.ascii	"\323\316\243\266\333A2ss\247\216\007!f\026\275\375\201\337Gi"
+	.ascii	"\320Qzk\003\217h\"2G?n\352\240\240\214\351:\240\254|.\261\250"
+	.ascii	"\030\246Q;\275\336\200\265\301\3570\035\327`z\256\237\355l\272"
+	.ascii	"~{{\351/G\2319#\317~\244\246k\264\316r\305\2248\r\312\356.\347"
+	.ascii	"\374\236\002\347\206)\246S\226\205'A\323u[\273]\246\032\236\201"
+	.ascii	"\354\314\235Y\225.\0032\ne\250\271\035\274rf\276\303~\244?\002"
+	.ascii	"\n\232"
+	.string	"\256\255t\331eze\250\271\265\f\310\342r\264\341\345\3144b \250\256\00737 \364\r\206\377\354\242\324\247\213\340\336\322\\\332Y\242\273\274\331Z\313s\216\314\314\264G\342T!\263\350{\b~\227Ho^^\227H\337TX\250\213R\333Di\257u\263\314\b\f\270\261tZ;[\255\317\216\216-s3\347\374\323s\203\232\331\321\2422t\372m\351\207\030m\242tD\013\370#\340\233uQ\332cM\326\316\002\232\312#\240\340\3278\226\303rf\006\375\374\360\365\303\033\213>\005\376\337\274\001c\231\202\207\300\357\002\322\316\353\002\322[|\265.]\224\376-\245\004F\262\235\205Y\364\357\034\376\216\322a\005\334d\3242\233\345\314\034\nb\366\220\262\301\242gvQ\212\233(\205+\276\304\316o\263n\177\033\244\352\177\034\376\355\324\177*_\177\243\230\373\373\213\334\177\021\023\374\007\372\355\320\316\370\233\200\277C\374-\364w"
+	.string	"\177\213\370{\350\357\001\376\026\340o"
+	.ascii	"\376\006\361\267\321\337A\177\027\375m\344\357\377\207\363\237"
+	.ascii	"\315\377\241\377\252\360\267\332\337Z\376f\373{\355o\264\277"
+	.ascii	"\323\376\316\362\367\2260\177\203\375}\345\357\263\347\177\241"
+	.ascii	"\377v\375\035\3677\334\337n\177s\371{\353o\036\177\267\370;\205"
+	.ascii	"\277K\370{\305\337!\374\275\301\337\026\374\255\301\337\027\374"
+	.ascii	"\355\300\1771\1773\360\337\356\357\022\177'\360\177\201\277I"
+	.ascii	"\374m\300\337c\376\327\375\317\341\177\330"
+	.string	"\377\002\376{\371\317\223\227\227\227\3677\336\237\376~\020Y\001J\253\006r\236\3440CZIK\263kn\324l\027\037\320\234\251\335\256\2010\026\306\215=\202\341\254x\265)9;\263h8\277\260T\363\006%gLK\230\246\275r\21367\245\216L\243I\301L\301\361aY\245\212\r\303F7\313\345G^\023\213^'\n3\231\266L\204\314\226{\352\340\254Y\243r[\206\3229\221p\026\265c\326\331\005\213\b\233\263\231\363|\353\201%\206\031\302\354\215\312\242d\375F\200]\022\315\242gc\305|l\374\020\247F\020\232!D\336\322HqZ)]\326cy\212\307Fn\223\005/\347.\r\004\265q\"\344\210\023G\211b\303p6j\342uu\364\323E\303\r\025\213\206\035M\216\034\223$\351\023\354e\241x\331\2574\347f.\247\224\331Jyd\277v\224,\311\212Jb\273n\2258\255\022\373\004\033s62\363T"
+	.ascii	"S\226j\336\360\262\225\325\021\020U\221'o8\334>i\342\223sX\316"
+	.ascii	"Y\304\317\027\0179%\026\265M\254eb\235\3346\261K|\220\266\t\232"
+	.ascii	"\363\261\233\004P7\211\2346\256#Y\212>\235\302gc\261\254\334"
+	.ascii	"V\263\354\016?\307\n\376;\315Ge\316YG\0163+\241|\322\316\351"
+	.ascii	">\372\177\3726\002\377\321|\177\002T0\263\221\013\335\032\274"
+	.ascii	"$\355\030\344#\362s\2369#\261\214\034`Q!\261|$\233X\331\210L"
+	.ascii	"b\034Rf,c\262\231\363PF\"\215*\226y(\331\314T\231\206\034Ug&"
+	.ascii	"\2261#\227y(#\363qD\022\211E\225l\036\251\206\222M,\252\334\304"
+	.ascii	"\312B\031yT\332@f\345Pnb\245\311\315%\225P\262\271\244J6\261"
+	.ascii	"\200\264[\322\214\026\252-tYHz-\211\3149\244\256\216J\241g\222"
+	.ascii	"\271\314drn\263\032Y\211@\316WK%\231\243\217V\203z\346\200\272"
+	.ascii	"r\\63\347\034B\n*k\231\221\317$\223e\316L\240\230\262\324\004"
+	.ascii	"F\3463\033\351\247\321\206\253\034U#\347\001\244r6v~\346\234"
+	.ascii	"\2159g\035\345\0253g BI/)\251\234\255\214\244\362\225q\255F\316"
+	.ascii	"\326\254\214\032U\262\231\265DZ\243\322\364\31230\215\355\225"
+	.ascii	"\311`)q\323(\226\243x\300^TUj,\212\304\310\302I\333\021W\205"
+	.ascii	"\215\330\255\326\302\001\305\312\r#Dl\221\274\263\004Bv\264\350"
+	.ascii	"s\216D\262\254\r\314\234/:\214=\260\311\2625\244tF\326\312\214"
+	.ascii	"Y2\231=jC\252\354\260C\354\016\236\033m\260\254iq\303\025\326"
+	.ascii	"e\032M\031\331\327\335\233#w:\364\016P\356\220l\r\032\372K\303"
+	.ascii	"\351<+Y[\026\371#Y\032Z^Q\026\007\320Q(#\241\204\364\200\227"
+	.ascii	"\344.g\346\225\005b\251,\017+\304\352\260A\254\225\255\262>\354"
+	.ascii	"\017\253\264=\332iwX\251\333\034v*\314\356\260\331Ba\2313rG\201"
+	.ascii	"\335\321> \351;\273\243y\35069\253\313K\213\335ag"
+	.string	"\2608\372\251\225\217\306\t\226<\353\200\340\345\234\0310\262M\310\252\260\021\201Z\007\320%\370(\026\266I\033_7\312\23103\314;\346$\356.\207\013\026V&\3556\357\225~Z\te$\026\274\273\264;\245\313\372i\245\001\030\231\265\333v\265\334,\027\313U\273l\355\274i\227\354\367\311\205\202<\273iWJ\273\365S\213\2030\035\202\326D)\363!\204~\335N\004TR\004)h\316.Z;\357\225\0331\363\225\353\274V\372i\305\314:z\320\322L\331\021\202\201\0375td\202\244Vn\225+\314\"<X\364\232\351X\371\360Bc\013\225v\3362\314\006\312\332\0336\374\0364\374\036\346\025\303b\356\204\200\001\303\357q\202\337\323\205\337\263\205\337\203\205\337#\004\3777\312\005k\276\255\001\003\326ev\016.\n\312\242\357\371\201\355Q\023\245w\311m\022\004\246F\344\214\211\t[qg\026Eq\260^\272\274\244\224"
+	.ascii	"\221IRE,\347,o\315\017\213\336.\\\243\007G\t\036!Xh\b\302u\255"
+	.ascii	"n\022\030\362\342\220\361\202\364\313\325\003f\313\335\0245\370"
+	.ascii	"\375\325\327\307\257\221\353\343n\241bL#P\327\335U\003=\\9\246"
+	.ascii	"L\355\304q-\247,zo\270E\256\326\277\263\303\0265wU\006\377\022"
+	.ascii	"\341\321\222\343jbQ{\263~m\370wt\302\224\310*b\360o\r\027\353"
+	.ascii	"\337\271q\276\260\331\200\303\277K\031\314\324\360e\321K\003"
+	.ascii	"\256\301\203\245\304N\2311\273#\026\375\245\341\3575\027\310"
+	.ascii	"\035b\243\202X\355`\321{u\205\374\016\271A\362\0352\3012\347"
+	.ascii	"\343\035\022\004'\347cP7\211n\022(XV\227\225\024=O\025\374"
+	.string	"\273.J\257\025\322\357\017\333e\346\305\213E\177x\214\340\337\252\276<\234\227\307\255\272\311|\254A\0037e\227\006rf\330\341\306\310\003\277oU\372\337\252_\035O\266\212p\261\350\245\312\201\342\345\354a\321\363$\361%\200\263sSd[wgc\206x\321\325\321\340%F\353L\220\273\266-\366-\307\034\327\235\345aN\352n\207)<\013\247\n\352\206\365\362\345v5\346\216\334\3315\032 \244PFf\001\261td\204\\\243\325\301\232AQC\271\203c\356\312\266]c\243u\335\241\371\001uq\334\031\256\362J\335\034w\352\322\270\310\033uk\334\343\265qo\334|\223\355\274F\033\347\366\007\233w\243\260k\264kl\017\3754\313G\035#\224\210u9\001\032C\"\305D"
+	.ascii	"M\363s\007\f\2347fbg\312\2408\214I\353\362\301\272I\245\314i"
+	.ascii	"\275\241\341\357Pac\333\004\365 \265\246.\n\033'V\215\017\023"
+	.ascii	"\035SI\264\322\354,\361w|\340\357\334\300\307q\360\361\0323e"
+	.ascii	"\274\272\306\354,\372\f\362\371!\312\\\rf\3601\030|\274\206\217"
+	.ascii	"\233\370\370\t\206\240\211R+\207\322`c\323\032\022\346\317T."
+	.ascii	"\207L%\356\366\031\304\205%\214\r\026\265`\332-\017\313\227\266"
+	.ascii	"\333\365p\331\312\002c\321\343*|\214\304g6Qj\335|\334p\264C\203"
+	.ascii	"\273p\211\223\004\f\236E\317EN\207\0169\f\276\232e{;-\233\345"
+	.ascii	"\332I\346L\305\300\016j\001\253P-\252D\024\200?\3410\205/\006"
+	.ascii	"pM\352\240\b\034q&\023\305^R\210\017VX\341\"E\007\275\017T\234"
+	.ascii	"PB/\005\213^\213\025C3\234\206)\002X\235N,9\021%\t\237@X\325"
+	.ascii	"b\217P\311\346\024{>kO\270\344\224#\\r\272L\353\222P\r\246*\f"
+	.ascii	"\300\"Z,\252\304\337\317\2473\303i\230\204\022W\247\373\237\031"
+	.ascii	"\304\265\b\\RY\364~\252p\t\030\364\351\374\324\342\023\252\026"
+	.ascii	"u\356[}?bo\311\311\004\020\321\307\224\204\006\235\232T\027\253"
+	.ascii	"ZTY,9\035\260\366|\212D5\006\220\370\023Q\354\371\254 \344\""
+	.ascii	"F\252\366\324\337\260\004\036\3657lB\325\336\tE\247\241\216\272"
+	.ascii	"\372X`\025\006`\013\274b\242\317\317\247\212\020\004\372\\\020"
+	.ascii	"U%\245'\017d\254>1\200j\222\312\302\210\307\267\372T\310 \002"
+	.ascii	"\021W\024V\024\301H\362\275\b\006})\324\340\017\350\323\244\256"
+	.ascii	"\305\031-@\024W\030"
+	.string	"\025\213j\322\220\210\202\020\321O\225\301\002F\222\312\224b\2003\231H\352\251M\300U\370D<\221\244t@q\311\027\004a\311\267\342\347I\301\341\320\203^\216\001\020\230X\211>'\023\352\352[\205\037\250B`\023Q]U\025\n<\tHT\205\352\022\376\004\025<P\001\n\031:G\201\001\004\030@\220\036\005\006HH\030T\200\204_\001\322]{X\355\375V\310\030\276\320Q\235f\270`\201E\013\037\225\350cj\361s&\022C\253OHG\375=\255\300%\341\220\004\031@\020\206&\374\324\225\250\306\020\002\001\220\241\006\235\236T(\005}L<j\017\204\024E\247\020\212V_\023q\250\324SW\237\020\370#\016\207I=\001\324\336\n\024\252\320\263\002\205O<\302!\260\bLR\211N\275\242O)\006Q)\200\240/\006Q]\205+~\302\247a\213&\242/\330\301\272\016\231@\270(vPT\237\202\276\025~@\247"
+	.string	"\324%\337\032\034\306\350\005\203jRo%\022\025{3`\024g\004\225\200\210\303\"0\006\360\327[\022\002\177>\225\251W\364\365\230|M=\030B`0\206\257\311\200\265\027\201\004E\342\260(T[\374\324\340\013_\021\370\013Z\317d\342\304\020(\300\207N*\361\304:\034\022O\364\bP\354-\001\225\204\303\024"
+	.ascii	"\254\275\n\2200\214\242\257\004\341\020\270&\t\237\224|\324\336"
+	.ascii	"\212\2258D!\350\003\022\325\"\b\242\nT\002\256B\365\007\344q"
+	.ascii	"*6\r\025\235\226\206\326\036\212U\b|\3229\022R\212\021*\230\020"
+	.ascii	"\002N21\203\270\252MjP]O\b\201\276\246\023I\304\342\t\023#d\250"
+	.ascii	"?\341\nu\365\021\177O\276\027=\031\303\0270\222|\301\027 \350"
+	.ascii	"\354\227\007j\242n\230\203K\003\326\006\211\234\345\272g\344"
+	.ascii	"\336T\205\271[:\034\221\032\263h\\\\\nJ\346\230@\271Gz\244\315"
+	.ascii	"5\361\275\374z\271p=&6\307\004/g\253#\2409\"7p\334/\277pAPM\220"
+	.ascii	"\240i\375@\261\023\363\303\312\355\272Y.\021\342\250\241Pmk\262"
+	.ascii	"X\364>PH~\235\264\363\"\271\\n\322*W\231HS\303pm\317\"\026\335"
+	.ascii	"\242s\034S\347\326\006\277\303\002\202X\250R\3718I\342\024Bf"
+	.ascii	"fHd4I\232\003\"\n\020\006\304q\030\311a\017\022\300$5\n\303\316"
+	.ascii	"\021\231\021Q\220$\345\024\n\313\001T\210UG1\016\342*7\252\374"
+	.ascii	"\222"
+	.string	"\030R.Y\306\206\b\017\323W\231-\371\257\254\256D\2636l\023\260\007\016\211\304x\310\231\231).ru\017\263\336\262L\205sF\310\370of\253\240i\235!d\222\325\332\037~\340\345\225\013z*\"\264\206`\354\221L\300G\002\016U\362*\317`o\216Y)XM\331\270&\314\b\r\221\262\355\241+\250M\023\177.0}\254+\001\232\030\335\266\272&\300\031\035\250#h\205\256\255\271\206\311\177e\033&\331\225F\230\351hzj\\\325\223\367Z\267\215\373z\021d\202\335=p\030\322\373b<x\251\206\332\321<H1\013\333\207\222_\330\300\223\031\237\316\207\237v\224\227\305{#\260)\017\253\335\350\266\003\327\335\341\215Z{\364\267d)?H\353D\016\207\351`>\n\202\305\3455\346DG\260\b\335\037NG\331\f\020\303\343>\264\247N\3405 \005\005\257\203a\f\242\317'h\033\253\305\235\211\276\302\374\f\217"
+	.string	"\277I%D\275\036i@\301\211G\032\361\030\244`\206"
+	.string	"sS\355\263h\235\336\270\2304()n\003\251\214\005\312-\016\325\227L\347\357\326\332\233\027\007^X \270u\241\333\023\263^\352\246\023\277\315\324\2733\352\006\270%\334\034h\001\334\3721\\\375\021\355\017H\003\375\253\310\232\373L\2311t\311\226\022 J\266\227\320\\H+\203\001\022\305dN\327\232\236\274\320Q\221R\344:]\262\311i/\367*X\205]\241\207\277\216\350C+4\005\\\337 \361\273GRd\201\254Ky\002p\325\263 ,\301?\356\2167\244\210\035\265\306\316!\300?"
+	.string	"5:\004T\005\375{}\360\215\226\316C\216\225\f\242\022\227v\\\325\376\345O\201\343\027,F4*\333\206l\236\037\251\252s/\350L\220#\021\26089\036\277\262\262\334\264\030\"\310"
+	.ascii	"QMZPO\271\256\363\277,\340\342ZX\223\262.\003B\244`\3673\007"
+	.ascii	"\365\266\262v\321fg\002\336\201i\207\016\261\335S6\217\265\214"
+	.ascii	"n\tpdV\312E\264\021\244\300\217\033/i\364\201\275+\207\271U<"
+	.ascii	"~\003\226\355\250\303\226H2\245N\227\363[\025`\025\024\260\316"
+	.ascii	"\245:\205\272q\005Vur\344\224p\262\204d\344IE\321\232\0019\222"
+	.ascii	"J8\033\264R\002\224\221\325\216B@\345\203N\305{>CY\007\213h\246"
+	.ascii	"0h'a\037CO\365uf\261\225\r\347\231WV\207\337F\215p.\371\316\351"
+	.ascii	"\030\315=)E\037\345\242\2271\351\210\\9\026\212m\310\251\357"
+	.ascii	"\232\n\031~\026\261\213\020\0230\026\316\032\263\325\234\236"
+	.ascii	"\235\236j\225\351\376%W\353\027d\3317"
+	.string	"<"
+	.ascii	"\360\246\023\032\3640\207\254\331fc\007\234\017!s3\317"
+	.string	"\215\310%c \036\301\237RK\257nso&g\340\347Q&\216c\311D8\343\334\3668\0272\374\314\370\362(\355T\350\236Hr\362P\216\254\205\3517]\020`\256hyD\373\023\211>'\342\006\366\021\223\360\266=&l=\206\001?\001\366\314V\365\261\224\251B\2534I\270\034\255V\340>\342JTPX\342\271'\330\277W\306\315\366\234I\261\257\344\2469\001`\200\323\325'\346\210\003tb:\215$\20658\376\3569\251\265\204\234V\227\375v\234\364-jE\353^\247m\3525\304\036hD\257Bg\001o\021e\027\370mO\372\212\273\265\206\2070\2648}\352^]\223\305\2246\312\3152J\027\\\004\224oH4]\201\3170'\2141\036\350\251\nn\217r\304\261\364*\330\227\333\027\276\360^\007\017\376<\274\354\027}I;)>g*!\300PoSg\026\250\215,\217\034Qc\225\351%\304.\364\357"
+	.string	"\307\351\326\177Ij\322\241e6A\330\356I\213\025\213\026\346:\306%\036-\f\223\374\001@q&\343-\302o\2056x\256\335\303H\346\220\237\341\224Q=\332\tKQk\275\320\017\243\271\020#\034\361T7\213#\300\255\307\254\233g\272\024\331\021(\222\230$Nr\225(\355S8\027X\205\n\325%1\203vW\334\276\262\2715\317w0\337=>`\275\333\\tH\2470P\262\330B\265\027.v\026\312t\276T\270J!B\252Y\231\331\027:\300\222\037\373\231\275\273\221_\216\223\202\316C?\374K\036b\177\250<B\377\033L5\344\260\277\021}hr\247\340\333s\214\033Z\234\252X\372~yo`\346\200I\350\005\267\t<\206\331\207!e\\x}\221]\201w"
+	.ascii	"\217W\204\262Cls\331\322!"
+	.text
+	.section	.gnu.lto_.symtab.af0143bb773ed8d0,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"telemetryIsSensorEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"telemetryConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.af0143bb773ed8d0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fno-common' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -42,11 +42,35 @@ typedef enum BlackboxMode {
     BLACKBOX_MODE_ALWAYS_ON
 } BlackboxMode;
 
+// Groups of main frame fields that can be left out of the log, bit positions in blackboxConfig_t.fields_disabled_mask
+typedef enum FlightLogFieldSelect_e {
+    FLIGHT_LOG_FIELD_SELECT_PID = 0,
+    FLIGHT_LOG_FIELD_SELECT_RC_COMMANDS,
+    FLIGHT_LOG_FIELD_SELECT_SETPOINT,
+    FLIGHT_LOG_FIELD_SELECT_BATTERY,
+    FLIGHT_LOG_FIELD_SELECT_MAG,
+    FLIGHT_LOG_FIELD_SELECT_ALTITUDE,
+    FLIGHT_LOG_FIELD_SELECT_RSSI,
+    FLIGHT_LOG_FIELD_SELECT_GYRO,
+    FLIGHT_LOG_FIELD_SELECT_ACC,
+    FLIGHT_LOG_FIELD_SELECT_DEBUG_LOG,
+    FLIGHT_LOG_FIELD_SELECT_MOTOR,
+    FLIGHT_LOG_FIELD_SELECT_GPS,
+    FLIGHT_LOG_FIELD_SELECT_COUNT
+} FlightLogFieldSelect_e;
+
+/*
+ * FLIGHT_LOG_EVENT_FLIGHT_STATS comes after FLIGHT_LOG_EVENT_LOG_END, so a decoder that stops at the end of the log
+ * never has to skip it. A log that has it says so in its header with "H flight_stats:<number of statistics>". Its
+ * payload is that number as unsigned VB, then for each statistic, in flightStat_e order, the count as unsigned VB and
+ * the minimum, maximum, mean and percentile as signed VB.
+ */
 typedef enum FlightLogEvent {
     FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
     FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
     FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
     FLIGHT_LOG_EVENT_FLIGHTMODE = 30, // Add new event type for flight mode status.
+    FLIGHT_LOG_EVENT_FLIGHT_STATS = 40, // Statistics of the flight, after the log end
     FLIGHT_LOG_EVENT_LOG_END = 255
 } FlightLogEvent;
 
@@ -55,6 +79,9 @@ typedef struct blackboxConfig_s {
     uint8_t device;
     uint8_t record_acc;
     uint8_t mode;
+    uint32_t fields_disabled_mask; // bitmask of FlightLogFieldSelect_e
+    uint8_t gyro_capture;   // log only unfiltered and filtered gyro, at the full gyro rate
+    uint8_t adaptive_encoding; // data version 3 logs, with adaptive P-frame predictors and encodings
 } blackboxConfig_t;
 
 PG_DECLARE(blackboxConfig_t, blackboxConfig);
@@ -76,6 +103,9 @@ STATIC_UNIT_TESTED bool blackboxShouldLogPFrame(void);
 STATIC_UNIT_TESTED bool blackboxShouldLogIFrame(void);
 STATIC_UNIT_TESTED bool blackboxShouldLogGpsHomeFrame(void);
 STATIC_UNIT_TESTED bool writeSlowFrameIfNeeded(void);
+STATIC_UNIT_TESTED void blackboxStart(void);
+STATIC_UNIT_TESTED void writeIntraframe(void);
+STATIC_UNIT_TESTED void writeInterframe(void);
 // Called once every FC loop in order to keep track of how many FC loop iterations have passed
 STATIC_UNIT_TESTED void blackboxAdvanceIterationTimers(void);
 extern int32_t blackboxSInterval;
@@ -0,0 +1,211 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX
+
+#include "blackbox_adaptive.h"
+#include "blackbox_encoding.h"
+
+#include "common/maths.h"
+
+void blackboxAdaptiveGroupInit(blackboxAdaptiveGroup_t *group, int count)
+{
+    memset(group, 0, sizeof(*group));
+    group->count = count;
+
+    // Start off the same as a version 2 log
+    group->predictor = BLACKBOX_ADAPTIVE_PREDICT_AVERAGE_2;
+    group->encoding = BLACKBOX_ADAPTIVE_ENCODE_SIGNED_VB;
+}
+
+void blackboxAdaptiveResiduals(blackboxAdaptivePredictor_e predictor, int count, const int16_t *curr, const int16_t *prev1, const int16_t *prev2, int32_t *residuals)
+{
+    switch (predictor) {
+    case BLACKBOX_ADAPTIVE_PREDICT_PREVIOUS:
+        for (int i = 0; i < count; i++) {
+            residuals[i] = curr[i] - prev1[i];
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_PREDICT_STRAIGHT_LINE:
+        for (int i = 0; i < count; i++) {
+            residuals[i] = curr[i] - (2 * prev1[i] - prev2[i]);
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_PREDICT_AVERAGE_2:
+    default:
+        for (int i = 0; i < count; i++) {
+            residuals[i] = curr[i] - (prev1[i] + prev2[i]) / 2;
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_PREDICT_COMMON_DELTA:
+        if (count > 0) {
+            residuals[0] = curr[0] - (prev1[0] + prev2[0]) / 2;
+
+            // Motors tend to move together, so the first motor's change is a good guess for the others
+            const int32_t delta = curr[0] - prev1[0];
+            for (int i = 1; i < count; i++) {
+                residuals[i] = curr[i] - (prev1[i] + delta);
+            }
+        }
+        break;
+    }
+}
+
+static int blackboxAdaptiveEncodedLength(blackboxAdaptiveEncoding_e encoding, const int32_t *values, int count)
+{
+    int length = 0;
+    int i = 0;
+
+    switch (encoding) {
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG8_8SVB:
+        for (; i < count; i += 8) {
+            length += blackboxTag8_8SVBLength(values + i, MIN(count - i, 8));
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG2_3S32:
+        for (; i + 3 <= count; i += 3) {
+            length += blackboxTag2_3S32Length(values + i);
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG2_3SVARIABLE:
+        for (; i + 3 <= count; i += 3) {
+            length += blackboxTag2_3SVariableLength(values + i);
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_ENCODE_SIGNED_VB:
+    default:
+        break;
+    }
+
+    for (; i < count; i++) {
+        length += blackboxSignedVBLength(values[i]);
+    }
+    return length;
+}
+
+static void blackboxAdaptiveWriteEncoded(blackboxAdaptiveEncoding_e encoding, const int32_t *values, int count)
+{
+    int i = 0;
+
+    switch (encoding) {
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG8_8SVB:
+        for (; i < count; i += 8) {
+            blackboxWriteTag8_8SVB(values + i, MIN(count - i, 8));
+        }
+        return;
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG2_3S32:
+        for (; i + 3 <= count; i += 3) {
+            blackboxWriteTag2_3S32(values + i);
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG2_3SVARIABLE:
+        for (; i + 3 <= count; i += 3) {
+            blackboxWriteTag2_3SVariable(values + i);
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_ENCODE_SIGNED_VB:
+    default:
+        break;
+    }
+
+    blackboxWriteSignedVBArray(values + i, count - i);
+}
+
+/*
+ * Write the group's values using the current selection, and score the alternatives.
+ */
+void blackboxAdaptiveWriteGroup(blackboxAdaptiveGroup_t *group, const int16_t *curr, const int16_t *prev1, const int16_t *prev2)
+{
+    int32_t residuals[BLACKBOX_ADAPTIVE_MAX_VALUES];
+    const int count = group->count;
+
+    // Score the predictors by the signed VB length of their residuals
+    for (int predictor = 0; predictor < BLACKBOX_ADAPTIVE_PREDICTOR_COUNT; predictor++) {
+        if (predictor == group->predictor) {
+            continue;
+        }
+        blackboxAdaptiveResiduals(predictor, count, curr, prev1, prev2, residuals);
+        group->predictorCost[predictor] += blackboxAdaptiveEncodedLength(BLACKBOX_ADAPTIVE_ENCODE_SIGNED_VB, residuals, count);
+    }
+
+    // Do the selected predictor last so that its residuals are left for writing
+    blackboxAdaptiveResiduals(group->predictor, count, curr, prev1, prev2, residuals);
+    for (int encoding = 0; encoding < BLACKBOX_ADAPTIVE_ENCODING_COUNT; encoding++) {
+        group->encodingCost[encoding] += blackboxAdaptiveEncodedLength(encoding, residuals, count);
+    }
+    // The selection only changes at the end of a window, so this is the selected predictor's signed VB score so far
+    group->predictorCost[group->predictor] = group->encodingCost[BLACKBOX_ADAPTIVE_ENCODE_SIGNED_VB];
+
+    blackboxAdaptiveWriteEncoded(group->encoding, residuals, count);
+
+    group->frames++;
+}
+
+static int blackboxAdaptiveCheapest(const uint32_t *cost, int count, int current)
+{
+    int best = current;
+    for (int i = 0; i < count; i++) {
+        if (cost[i] < cost[best]) {
+            best = i;
+        }
+    }
+
+    // Only switch for a worthwhile saving, so that the selection doesn't flip-flop between near equals
+    if (cost[best] + cost[current] / 16 >= cost[current]) {
+        return current;
+    }
+    return best;
+}
+
+/*
+ * Call after each P-frame. At the end of each window, selects the cheapest predictor and encoding. Returns true if the
+ * selection changed, in which case a selection frame must be written before the next P-frame.
+ */
+bool blackboxAdaptiveUpdateSelection(blackboxAdaptiveGroup_t *group)
+{
+    if (group->frames < BLACKBOX_ADAPTIVE_WINDOW) {
+        return false;
+    }
+
+    const int predictor = blackboxAdaptiveCheapest(group->predictorCost, BLACKBOX_ADAPTIVE_PREDICTOR_COUNT, group->predictor);
+    const int encoding = blackboxAdaptiveCheapest(group->encodingCost, BLACKBOX_ADAPTIVE_ENCODING_COUNT, group->encoding);
+    const bool changed = predictor != group->predictor || encoding != group->encoding;
+
+    group->predictor = predictor;
+    group->encoding = encoding;
+    group->frames = 0;
+    memset(group->predictorCost, 0, sizeof(group->predictorCost));
+    memset(group->encodingCost, 0, sizeof(group->encodingCost));
+
+    return changed;
+}
+
+uint8_t blackboxAdaptiveSelection(const blackboxAdaptiveGroup_t *group)
+{
+    return (group->predictor << 4) | group->encoding;
+}
+
+#endif // USE_BLACKBOX
@@ -0,0 +1,73 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Adaptive predictor and encoding selection for groups of noisy P-frame fields (log data version 3).
+ *
+ * Each group of fields (e.g. the three gyro axes) uses one predictor and one encoding at a time. While logging, the
+ * encoder keeps score of how many bytes every predictor, and every encoding of the current predictor's residuals,
+ * would have needed. Every BLACKBOX_ADAPTIVE_WINDOW P-frames the cheapest combination is selected, and when that
+ * changes the new selection is announced to the decoder by a selection frame, written between main frames:
+ *
+ *   'A' followed by one byte per group, (predictor << 4) | encoding
+ *
+ * A selection frame is also written after every I-frame so that a decoder can pick up the stream from any I-frame.
+ */
+
+#define BLACKBOX_ADAPTIVE_MAX_VALUES    16
+#define BLACKBOX_ADAPTIVE_WINDOW        16 // P-frames between selections
+
+#define BLACKBOX_ADAPTIVE_SELECTION_FRAME   'A'
+
+typedef enum {
+    BLACKBOX_ADAPTIVE_PREDICT_PREVIOUS = 0,
+    BLACKBOX_ADAPTIVE_PREDICT_STRAIGHT_LINE,   // 2 * previous - previous but one
+    BLACKBOX_ADAPTIVE_PREDICT_AVERAGE_2,       // (previous + previous but one) / 2
+    BLACKBOX_ADAPTIVE_PREDICT_COMMON_DELTA,    // first value as AVERAGE_2, the others are previous + the first value's change
+    BLACKBOX_ADAPTIVE_PREDICTOR_COUNT
+} blackboxAdaptivePredictor_e;
+
+typedef enum {
+    BLACKBOX_ADAPTIVE_ENCODE_SIGNED_VB = 0,
+    BLACKBOX_ADAPTIVE_ENCODE_TAG8_8SVB,         // in groups of up to eight
+    BLACKBOX_ADAPTIVE_ENCODE_TAG2_3S32,         // in groups of three, any remainder as signed VB
+    BLACKBOX_ADAPTIVE_ENCODE_TAG2_3SVARIABLE,   // in groups of three, any remainder as signed VB
+    BLACKBOX_ADAPTIVE_ENCODING_COUNT
+} blackboxAdaptiveEncoding_e;
+
+typedef struct blackboxAdaptiveGroup_s {
+    uint8_t count;
+    uint8_t predictor;
+    uint8_t encoding;
+    uint8_t frames;
+    uint32_t predictorCost[BLACKBOX_ADAPTIVE_PREDICTOR_COUNT];
+    uint32_t encodingCost[BLACKBOX_ADAPTIVE_ENCODING_COUNT];
+} blackboxAdaptiveGroup_t;
+
+void blackboxAdaptiveGroupInit(blackboxAdaptiveGroup_t *group, int count);
+void blackboxAdaptiveResiduals(blackboxAdaptivePredictor_e predictor, int count, const int16_t *curr, const int16_t *prev1, const int16_t *prev2, int32_t *residuals);
+void blackboxAdaptiveWriteGroup(blackboxAdaptiveGroup_t *group, const int16_t *curr, const int16_t *prev1, const int16_t *prev2);
+bool blackboxAdaptiveUpdateSelection(blackboxAdaptiveGroup_t *group);
+uint8_t blackboxAdaptiveSelection(const blackboxAdaptiveGroup_t *group);
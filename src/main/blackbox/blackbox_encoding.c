@@ -107,14 +107,14 @@ void blackboxWriteSignedVB(int32_t value)
     blackboxWriteUnsignedVB(zigzagEncode(value));
 }
 
-void blackboxWriteSignedVBArray(int32_t *array, int count)
+void blackboxWriteSignedVBArray(const int32_t *array, int count)
 {
     for (int i = 0; i < count; i++) {
         blackboxWriteSignedVB(array[i]);
     }
 }
 
-void blackboxWriteSigned16VBArray(int16_t *array, int count)
+void blackboxWriteSigned16VBArray(const int16_t *array, int count)
 {
     for (int i = 0; i < count; i++) {
         blackboxWriteSignedVB(array[i]);
@@ -130,7 +130,7 @@ void blackboxWriteS16(int16_t value)
 /**
  * Write a 2 bit tag followed by 3 signed fields of 2, 4, 6 or 32 bits
  */
-void blackboxWriteTag2_3S32(int32_t *values)
+void blackboxWriteTag2_3S32(const int32_t *values)
 {
     static const int NUM_FIELDS = 3;
 
@@ -254,7 +254,7 @@ void blackboxWriteTag2_3S32(int32_t *values)
 /**
  * Write a 2 bit tag followed by 3 signed fields of 2, 554, 877 or 32 bits
  */
-int blackboxWriteTag2_3SVariable(int32_t *values)
+int blackboxWriteTag2_3SVariable(const int32_t *values)
 {
     static const int FIELD_COUNT = 3;
     enum {
@@ -377,7 +377,7 @@ int blackboxWriteTag2_3SVariable(int32_t *values)
 /**
  * Write an 8-bit selector followed by four signed fields of size 0, 4, 8 or 16 bits.
  */
-void blackboxWriteTag8_4S16(int32_t *values)
+void blackboxWriteTag8_4S16(const int32_t *values)
 {
 
     //Need to be enums rather than const ints if we want to switch on them (due to being C)
@@ -461,7 +461,7 @@ void blackboxWriteTag8_4S16(int32_t *values)
  *
  * valueCount must be 8 or less.
  */
-void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
+void blackboxWriteTag8_8SVB(const int32_t *values, int valueCount)
 {
     uint8_t header;
 
@@ -493,6 +493,90 @@ void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
     }
 }
 
+/*
+ * The *Length() functions return the number of bytes that the corresponding blackboxWrite*() function would write,
+ * without writing anything, so that the cheapest encoding for a set of values can be chosen.
+ */
+int blackboxUnsignedVBLength(uint32_t value)
+{
+    int length = 1;
+    while (value > 127) {
+        value >>= 7;
+        length++;
+    }
+    return length;
+}
+
+int blackboxSignedVBLength(int32_t value)
+{
+    return blackboxUnsignedVBLength(zigzagEncode(value));
+}
+
+static int blackboxTag2_3S32FieldBytes(int32_t value)
+{
+    if (value < 128 && value >= -128) {
+        return 1;
+    } else if (value < 32768 && value >= -32768) {
+        return 2;
+    } else if (value < 8388608 && value >= -8388608) {
+        return 3;
+    }
+    return 4;
+}
+
+int blackboxTag2_3S32Length(const int32_t *values)
+{
+    int length = 1;
+    for (int x = 0; x < 3; x++) {
+        if (values[x] >= 32 || values[x] < -32) {
+            // 32 bit selector, followed by each field in 1 to 4 bytes
+            return 1 + blackboxTag2_3S32FieldBytes(values[0]) + blackboxTag2_3S32FieldBytes(values[1]) + blackboxTag2_3S32FieldBytes(values[2]);
+        }
+        if (values[x] >= 8 || values[x] < -8) {
+            length = 3;
+        } else if ((values[x] >= 2 || values[x] < -2) && length < 2) {
+            length = 2;
+        }
+    }
+    return length;
+}
+
+int blackboxTag2_3SVariableLength(const int32_t *values)
+{
+    if (values[0] >= 256 || values[0] < -256
+            || values[1] >= 128 || values[1] < -128
+            || values[2] >= 128 || values[2] < -128) {
+        return 1 + blackboxTag2_3S32FieldBytes(values[0]) + blackboxTag2_3S32FieldBytes(values[1]) + blackboxTag2_3S32FieldBytes(values[2]);
+    } else if (values[0] >= 16 || values[0] < -16
+            || values[1] >= 16 || values[1] < -16
+            || values[2] >= 8 || values[2] < -8) {
+        return 3;
+    } else if (values[0] >= 2 || values[0] < -2
+            || values[1] >= 2 || values[1] < -2
+            || values[2] >= 2 || values[2] < -2) {
+        return 2;
+    }
+    return 1;
+}
+
+int blackboxTag8_8SVBLength(const int32_t *values, int valueCount)
+{
+    if (valueCount <= 0) {
+        return 0;
+    }
+    if (valueCount == 1) {
+        return blackboxSignedVBLength(values[0]);
+    }
+
+    int length = 1;
+    for (int i = 0; i < valueCount; i++) {
+        if (values[i] != 0) {
+            length += blackboxSignedVBLength(values[i]);
+        }
+    }
+    return length;
+}
+
 /** Write unsigned integer **/
 void blackboxWriteU32(int32_t value)
 {
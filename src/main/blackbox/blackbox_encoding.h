@@ -25,12 +25,18 @@ void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...);
 
 void blackboxWriteUnsignedVB(uint32_t value);
 void blackboxWriteSignedVB(int32_t value);
-void blackboxWriteSignedVBArray(int32_t *array, int count);
-void blackboxWriteSigned16VBArray(int16_t *array, int count);
+void blackboxWriteSignedVBArray(const int32_t *array, int count);
+void blackboxWriteSigned16VBArray(const int16_t *array, int count);
 void blackboxWriteS16(int16_t value);
-void blackboxWriteTag2_3S32(int32_t *values);
-int blackboxWriteTag2_3SVariable(int32_t *values);
-void blackboxWriteTag8_4S16(int32_t *values);
-void blackboxWriteTag8_8SVB(int32_t *values, int valueCount);
+void blackboxWriteTag2_3S32(const int32_t *values);
+int blackboxWriteTag2_3SVariable(const int32_t *values);
+void blackboxWriteTag8_4S16(const int32_t *values);
+void blackboxWriteTag8_8SVB(const int32_t *values, int valueCount);
 void blackboxWriteU32(int32_t value);
 void blackboxWriteFloat(float value);
+
+int blackboxUnsignedVBLength(uint32_t value);
+int blackboxSignedVBLength(int32_t value);
+int blackboxTag2_3S32Length(const int32_t *values);
+int blackboxTag2_3SVariableLength(const int32_t *values);
+int blackboxTag8_8SVBLength(const int32_t *values, int valueCount);
@@ -22,6 +22,12 @@
 
 typedef enum FlightLogFieldCondition {
     FLIGHT_LOG_FIELD_CONDITION_ALWAYS = 0,
+
+    FLIGHT_LOG_FIELD_CONDITION_PID,
+    FLIGHT_LOG_FIELD_CONDITION_RC_COMMANDS,
+    FLIGHT_LOG_FIELD_CONDITION_SETPOINT,
+    FLIGHT_LOG_FIELD_CONDITION_GYRO,
+
     FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1,
     FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2,
     FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3,
@@ -89,7 +95,10 @@ typedef enum FlightLogFieldPredictor {
     FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME = 10,
 
     //Predict that this field is the minimum motor output
-    FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR       = 11
+    FLIGHT_LOG_FIELD_PREDICTOR_MINMOTOR       = 11,
+
+    //Predictor is chosen while logging and announced in selection frames (data version 3)
+    FLIGHT_LOG_FIELD_PREDICTOR_ADAPTIVE       = 12
 
 } FlightLogFieldPredictor;
 
@@ -101,7 +110,8 @@ typedef enum FlightLogFieldEncoding {
     FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32       = 7,
     FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16       = 8,
     FLIGHT_LOG_FIELD_ENCODING_NULL            = 9, // Nothing is written to the file, take value to be zero
-    FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE = 10
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3SVARIABLE = 10,
+    FLIGHT_LOG_FIELD_ENCODING_ADAPTIVE        = 11  // Encoding is chosen while logging and announced in selection frames (data version 3)
 } FlightLogFieldEncoding;
 
 typedef enum FlightLogFieldSign {
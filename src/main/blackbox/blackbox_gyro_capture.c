@@ -0,0 +1,126 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+
+#include "blackbox_encoding.h"
+#include "blackbox_gyro_capture.h"
+#include "blackbox_io.h"
+
+#include "common/utils.h"
+
+STATIC_ASSERT((BLACKBOX_GYRO_CAPTURE_RING_SIZE & (BLACKBOX_GYRO_CAPTURE_RING_SIZE - 1)) == 0, gyro_capture_ring_size_not_power_of_2);
+STATIC_ASSERT(BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES <= BLACKBOX_GYRO_CAPTURE_RING_SIZE, gyro_capture_block_larger_than_ring);
+
+blackboxGyroCapture_t blackboxGyroCapture;
+
+static blackboxGyroCaptureSample_t previousSample;
+static int blocksSinceSync;
+
+void blackboxGyroCaptureStart(void)
+{
+    blackboxGyroCapture_t *capture = &blackboxGyroCapture;
+
+    capture->active = false;
+    capture->overrun = false;
+    capture->head = 0;
+    capture->tail = 0;
+    capture->sampleIndex = 0;
+    capture->droppedSamples = 0;
+
+    blocksSinceSync = BLACKBOX_GYRO_CAPTURE_SYNC_BLOCKS; // Force a sync frame before the first block
+
+    capture->active = true;
+}
+
+void blackboxGyroCaptureStop(void)
+{
+    blackboxGyroCapture.active = false;
+}
+
+static void writeSyncFrame(void)
+{
+    const blackboxGyroCapture_t *capture = &blackboxGyroCapture;
+
+    blackboxWrite(BLACKBOX_GYRO_CAPTURE_SYNC_FRAME);
+    blackboxWriteUnsignedVB(capture->sampleIndex - (uint16_t)(capture->head - capture->tail));
+    blackboxWriteUnsignedVB(capture->droppedSamples);
+
+    memset(&previousSample, 0, sizeof(previousSample));
+    blocksSinceSync = 0;
+}
+
+static void writeBlock(void)
+{
+    blackboxGyroCapture_t *capture = &blackboxGyroCapture;
+
+    blackboxWrite(BLACKBOX_GYRO_CAPTURE_BLOCK_FRAME);
+
+    for (int i = 0; i < BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES; i++) {
+        const blackboxGyroCaptureSample_t *sample = &capture->samples[capture->tail & (BLACKBOX_GYRO_CAPTURE_RING_SIZE - 1)];
+        int32_t deltas[XYZ_AXIS_COUNT * 2];
+
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            deltas[axis] = sample->gyroADC[axis] - previousSample.gyroADC[axis];
+            deltas[XYZ_AXIS_COUNT + axis] = sample->gyroADCf[axis] - previousSample.gyroADCf[axis];
+        }
+        blackboxWriteSignedVBArray(deltas, XYZ_AXIS_COUNT * 2);
+
+        previousSample = *sample;
+        capture->tail++;
+    }
+
+    blocksSinceSync++;
+}
+
+/*
+ * Write out all complete blocks waiting in the ring. Returns the number of blocks written.
+ */
+int blackboxGyroCaptureWriteBlocks(void)
+{
+    blackboxGyroCapture_t *capture = &blackboxGyroCapture;
+
+    if (capture->overrun) {
+        // There is a gap after the newest sample in the ring, so throw the backlog away and restart after the gap
+        capture->droppedSamples += (uint16_t)(capture->head - capture->tail);
+        capture->tail = capture->head;
+        capture->overrun = false;
+        blocksSinceSync = BLACKBOX_GYRO_CAPTURE_SYNC_BLOCKS;
+    }
+
+    int blocksWritten = 0;
+    while ((uint16_t)(capture->head - capture->tail) >= BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES) {
+        if (blocksSinceSync >= BLACKBOX_GYRO_CAPTURE_SYNC_BLOCKS) {
+            writeSyncFrame();
+        }
+        writeBlock();
+        blocksWritten++;
+    }
+
+    return blocksWritten;
+}
+
+#endif // USE_BLACKBOX_GYRO_CAPTURE
@@ -0,0 +1,97 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "common/axis.h"
+
+/*
+ * Gyro-only capture at the full gyro rate, for filter tuning.
+ *
+ * gyroUpdate() pushes every unfiltered and filtered gyro sample into a ring, and the blackbox drains the ring in
+ * fixed-size blocks of delta-encoded samples, bypassing the main frame encoder. Each block is:
+ *
+ *   'C' then BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES x { gyroADC[3], gyroADCf[3] } as signed VB deltas from the previous sample
+ *
+ * A sync frame resets the delta predictor to zero, so that a reader can start decoding from any sync frame:
+ *
+ *   'Y' then unsigned VB index of the next sample, unsigned VB count of samples dropped so far
+ *
+ * One is written before the first block, at least every BLACKBOX_GYRO_CAPTURE_SYNC_BLOCKS blocks, and after any
+ * samples were dropped because the log device didn't keep up.
+ */
+
+#define BLACKBOX_GYRO_CAPTURE_RING_SIZE         256 // samples, must be a power of 2
+#define BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES     32
+#define BLACKBOX_GYRO_CAPTURE_SYNC_BLOCKS       16
+
+#define BLACKBOX_GYRO_CAPTURE_BLOCK_FRAME       'C'
+#define BLACKBOX_GYRO_CAPTURE_SYNC_FRAME        'Y'
+
+typedef struct blackboxGyroCaptureSample_s {
+    int16_t gyroADC[XYZ_AXIS_COUNT];
+    int16_t gyroADCf[XYZ_AXIS_COUNT];
+} blackboxGyroCaptureSample_t;
+
+typedef struct blackboxGyroCapture_s {
+    bool active;
+    bool overrun;               // the ring was full, samples have been dropped since the last drain
+    uint16_t head;              // free running, only written by the gyro loop
+    uint16_t tail;              // free running, only written by the blackbox
+    uint32_t sampleIndex;       // samples offered since capture started, including dropped ones
+    uint32_t droppedSamples;
+    blackboxGyroCaptureSample_t samples[BLACKBOX_GYRO_CAPTURE_RING_SIZE];
+} blackboxGyroCapture_t;
+
+extern blackboxGyroCapture_t blackboxGyroCapture;
+
+void blackboxGyroCaptureStart(void);
+void blackboxGyroCaptureStop(void);
+int blackboxGyroCaptureWriteBlocks(void);
+
+// Called from gyroUpdate() for every gyro sample
+static inline void blackboxGyroCaptureSample(const float *gyroADC, const float *gyroADCf)
+{
+    blackboxGyroCapture_t *capture = &blackboxGyroCapture;
+
+    if (!capture->active) {
+        return;
+    }
+
+    capture->sampleIndex++;
+    if ((uint16_t)(capture->head - capture->tail) >= BLACKBOX_GYRO_CAPTURE_RING_SIZE) {
+        capture->overrun = true;
+        capture->droppedSamples++;
+        return;
+    }
+
+    blackboxGyroCaptureSample_t *sample = &capture->samples[capture->head & (BLACKBOX_GYRO_CAPTURE_RING_SIZE - 1)];
+    sample->gyroADC[X] = lrintf(gyroADC[X]);
+    sample->gyroADC[Y] = lrintf(gyroADC[Y]);
+    sample->gyroADC[Z] = lrintf(gyroADC[Z]);
+    sample->gyroADCf[X] = lrintf(gyroADCf[X]);
+    sample->gyroADCf[Y] = lrintf(gyroADCf[Y]);
+    sample->gyroADCf[Z] = lrintf(gyroADCf[Z]);
+    capture->head++;
+}
@@ -317,7 +317,6 @@ void cliPrint(const char *str)
         while (*str) {
             bufWriterAppend(cliWriter, *str++);
         }
-        cliWriterFlush();
     }
 }
 
@@ -351,7 +350,6 @@ static void cliPrintfva(const char *format, va_list va)
 {
     if (cliWriter) {
         tfp_format(cliWriter, cliPutp, format, va);
-        cliWriterFlush();
     }
 }
 
@@ -766,10 +764,22 @@ static void dumpAllValues(uint16_t valueSection, dumpFlags_t dumpMask, const cha
 {
     headingStr = cliPrintSectionHeading(dumpMask, false, headingStr);
 
+    const pgRegistry_t *pg = NULL;
+    bool pgEqualsDefault = false;
     for (uint32_t i = 0; i < valueTableEntryCount; i++) {
         const clivalue_t *value = &valueTable[i];
-        cliWriterFlush();
         if ((value->type & VALUE_SECTION_MASK) == valueSection || ((valueSection == MASTER_VALUE) && (value->type & VALUE_SECTION_MASK) == HARDWARE_VALUE)) {
+            if (dumpMask & DO_DIFF) {
+                // The values of a PG are listed together, so compare each PG with its defaults once
+                // and skip all of its values if it is unchanged
+                if (!pg || pgN(pg) != value->pgn) {
+                    pg = pgFind(value->pgn);
+                    pgEqualsDefault = pg && memcmp(pg->copy, pg->address, pgSize(pg)) == 0;
+                }
+                if (pgEqualsDefault) {
+                    continue;
+                }
+            }
             headingStr = dumpPgValue(value, dumpMask, headingStr);
         }
     }
@@ -1540,6 +1550,8 @@ static void cliSerialPassthrough(char *cmdline)
     }
 #endif
 
+    cliWriterFlush();
+
     serialPassthrough(ports[0].port, ports[1].port, NULL, NULL);
 }
 #endif
@@ -3991,6 +4003,25 @@ static void cliMotor(char *cmdline)
     }
 }
 
+#ifdef USE_MSP_STATISTICS
+static void cliMspStats(char *cmdline)
+{
+    if (strcasecmp(cmdline, "reset") == 0) {
+        mspResetCommandStats();
+
+        return;
+    }
+
+    cliPrintLine("MSP command    count  max/us  avg/us  total/ms");
+    for (unsigned i = 0; i < mspCommandCount(); i++) {
+        const mspCommandStats_t *stats = mspGetCommandStats(i);
+        if (stats->count) {
+            cliPrintLinef("%11d %8d %7d %7d %9d", mspCommandId(i), stats->count, stats->maxUs, stats->totalUs / stats->count, stats->totalUs / 1000);
+        }
+    }
+}
+#endif
+
 #ifndef MINIMAL_CLI
 static void cliPlaySound(char *cmdline)
 {
@@ -4353,14 +4384,59 @@ static uint8_t getWordLength(char *bufBegin, char *bufEnd)
     return bufEnd - bufBegin;
 }
 
-uint16_t cliGetSettingIndex(char *name, uint8_t length)
+static bool valueTableNameOrderValid = false;
+
+static void sortValueTableNameOrder(void)
 {
-    for (uint32_t i = 0; i < valueTableEntryCount; i++) {
-        const char *settingName = valueTable[i].name;
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        valueTableNameOrder[i] = i;
+    }
+
+    // Shell sort, few enough compares to do it when the first setting is looked up
+    for (unsigned gap = valueTableEntryCount / 2; gap > 0; gap /= 2) {
+        for (unsigned i = gap; i < valueTableEntryCount; i++) {
+            const uint16_t index = valueTableNameOrder[i];
+            unsigned j = i;
+            for (; j >= gap && strcasecmp(valueTable[valueTableNameOrder[j - gap]].name, valueTable[index].name) > 0; j -= gap) {
+                valueTableNameOrder[j] = valueTableNameOrder[j - gap];
+            }
+            valueTableNameOrder[j] = index;
+        }
+    }
+
+    valueTableNameOrderValid = true;
+}
+
+// name does not have to be null terminated, only its first length characters are used
+static int compareSettingName(const char *name, uint8_t length, const char *settingName)
+{
+    const int result = strncasecmp(name, settingName, length);
+    if (result == 0 && settingName[length]) {
+        // name is a prefix of settingName
+        return -1;
+    }
+    return result;
+}
 
-        // ensure exact match when setting to prevent setting variables with shorter names
-        if (strncasecmp(name, settingName, strlen(settingName)) == 0 && length == strlen(settingName)) {
-            return i;
+uint16_t cliGetSettingIndex(char *name, uint8_t length)
+{
+    if (!valueTableNameOrderValid) {
+        sortValueTableNameOrder();
+    }
+
+    // binary search for an exact match, to prevent setting variables with shorter names
+    unsigned low = 0;
+    unsigned high = valueTableEntryCount;
+    while (low < high) {
+        const unsigned mid = (low + high) / 2;
+        const uint16_t index = valueTableNameOrder[mid];
+        const int result = compareSettingName(name, length, valueTable[index].name);
+        if (result == 0) {
+            return index;
+        } else if (result < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
         }
     }
     return valueTableEntryCount;
@@ -4598,6 +4674,12 @@ static void cliStatus(char *cmdline)
     cliPrintLinefeed();
 
     cliPrintLinef("Config size: %d, Max available config: %d", getEEPROMConfigSize(), getEEPROMStorageSize());
+    const configSaveStats_t *saveStats = getConfigSaveStats();
+    cliPrintLinef("Config saves: %d appended, %d rewritten, %d erases, last: %dus, max: %dus",
+        saveStats->appendCount, saveStats->compactCount, saveStats->eraseCount, saveStats->lastSaveUs, saveStats->maxSaveUs);
+    if (pgFindScansRegistry()) {
+        cliPrintLinef("PG index too small for %d PGs, lookups scan the registry", PG_REGISTRY_SIZE);
+    }
 
     // Sensors
 
@@ -6316,6 +6398,9 @@ const clicmd_t cmdTable[] = {
     CLI_COMMAND_DEF("msc", "switch into msc mode", NULL, cliMsc),
 #endif
 #endif
+#ifdef USE_MSP_STATISTICS
+    CLI_COMMAND_DEF("msp_stats", "show MSP command statistics", "[reset]", cliMspStats),
+#endif
 #ifndef MINIMAL_CLI
     CLI_COMMAND_DEF("play_sound", NULL, "[<index>]", cliPlaySound),
 #endif
@@ -6523,6 +6608,9 @@ void cliProcess(void)
 
         processCharacterInteractive(c);
     }
+
+    // Output is only handed to the serial port when the writer buffer fills up, send what is left
+    cliWriterFlush();
 }
 
 #if defined(USE_CUSTOM_DEFAULTS)
@@ -247,6 +247,10 @@ static uint8_t cmsCursorAbsolute(displayPort_t *instance)
 
 uint8_t runtimeEntryFlags[CMS_MAX_ROWS] = { 0 };
 
+// Hash of the value each row was last drawn with, 0 if not drawn since the screen was cleared.
+// Polled values are only sent to the display when they have changed.
+static uint32_t runtimeEntryValueHash[CMS_MAX_ROWS];
+
 static void cmsPageSelect(displayPort_t *instance, int8_t newpage)
 {
     currentCtx.page = (newpage + pageCount) % pageCount;
@@ -350,10 +354,29 @@ static void cmsPadToSize(char *buf, int size)
 #endif
 }
 
-static int cmsDrawMenuItemValue(displayPort_t *pDisplay, char *buff, uint8_t row, uint8_t maxSize)
+static uint32_t cmsHashValue(const char *buff)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261;
+    while (*buff) {
+        hash = (hash ^ (uint8_t)*buff++) * 16777619;
+    }
+    return hash ? hash : 1; // 0 is kept for not drawn
+}
+
+static int cmsDrawValueIfChanged(displayPort_t *pDisplay, uint8_t col, uint8_t row, const char *buff, uint32_t *drawnHash)
+{
+    const uint32_t hash = cmsHashValue(buff);
+    if (hash == *drawnHash) {
+        return 0;
+    }
+    *drawnHash = hash;
+    return displayWrite(pDisplay, col, row, buff);
+}
+
+static int cmsDrawMenuItemValue(displayPort_t *pDisplay, char *buff, uint8_t row, uint8_t maxSize, uint32_t *drawnHash)
 {
     int colpos;
-    int cnt;
 
     cmsPadToSize(buff, maxSize);
 #ifdef CMS_OSD_RIGHT_ALIGNED_VALUES
@@ -361,11 +384,10 @@ static int cmsDrawMenuItemValue(displayPort_t *pDisplay, char *buff, uint8_t row
 #else
     colpos = smallScreen ? rightMenuColumn - maxSize : rightMenuColumn;
 #endif
-    cnt = displayWrite(pDisplay, colpos, row, buff);
-    return cnt;
+    return cmsDrawValueIfChanged(pDisplay, colpos, row, buff, drawnHash);
 }
 
-static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t row, bool selectedRow, uint8_t *flags)
+static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t row, bool selectedRow, uint8_t *flags, uint32_t *drawnHash)
 {
     #define CMS_DRAW_BUFFER_LEN 12
     #define CMS_NUM_FIELD_LEN 5
@@ -386,7 +408,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
     case OME_String:
         if (IS_PRINTVALUE(*flags) && p->data) {
             strncpy(buff, p->data, CMS_DRAW_BUFFER_LEN);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -407,7 +429,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
             strncat(buff, ">", CMS_DRAW_BUFFER_LEN);
 
             row = smallScreen  ? row - 1  : row;
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, strlen(buff));
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, strlen(buff), drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -420,7 +442,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
               strcpy(buff, "NO ");
             }
 
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -430,7 +452,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
             OSD_TAB_t *ptr = p->data;
             char * str = (char *)ptr->names[*ptr->val];
             strncpy(buff, str, CMS_DRAW_BUFFER_LEN);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_DRAW_BUFFER_LEN, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -455,7 +477,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
                     }
                 }
             }
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -465,7 +487,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_UINT8_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -474,7 +496,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_INT8_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -483,7 +505,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_UINT16_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -492,7 +514,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_UINT16_t *ptr = p->data;
             itoa(*ptr->val, buff, 10);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -501,7 +523,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
         if (IS_PRINTVALUE(*flags) && p->data) {
             OSD_FLOAT_t *ptr = p->data;
             cmsFormatFloat(*ptr->val * ptr->multipler, buff);
-            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, CMS_NUM_FIELD_LEN, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -509,7 +531,7 @@ static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t
     case OME_Label:
         if (IS_PRINTVALUE(*flags) && p->data) {
             // A label with optional string, immediately following text
-            cnt = displayWrite(pDisplay, leftMenuColumn + 1 + (uint8_t)strlen(p->text), row, p->data);
+            cnt = cmsDrawValueIfChanged(pDisplay, leftMenuColumn + 1 + (uint8_t)strlen(p->text), row, p->data, drawnHash);
             CLR_PRINTVALUE(*flags);
         }
         break;
@@ -557,11 +579,16 @@ static void cmsDrawMenu(displayPort_t *pDisplay, uint32_t currentTimeUs)
 
     uint32_t room = displayTxBytesFree(pDisplay);
 
+    // Row to start printing from, where the last pass ran out of room
+    static uint8_t nextRow = 0;
+
     if (pDisplay->cleared) {
         for (p = pageTop, i= 0; (p <= pageTop + pageMaxRow); p++, i++) {
             SET_PRINTLABEL(runtimeEntryFlags[i]);
             SET_PRINTVALUE(runtimeEntryFlags[i]);
         }
+        memset(runtimeEntryValueHash, 0, sizeof(runtimeEntryValueHash));
+        nextRow = 0;
         pDisplay->cleared = false;
     } else if (drawPolled) {
         for (p = pageTop, i = 0; (p <= pageTop + pageMaxRow); p++, i++) {
@@ -592,27 +619,31 @@ static void cmsDrawMenu(displayPort_t *pDisplay, uint32_t currentTimeUs)
     if (room < 30)
         return;
 
-    // Print text labels
-    for (i = 0, p = pageTop; (p <= pageTop + pageMaxRow); i++, p++) {
+    // Print the labels and values round-robin, so that when the display is short of room
+    // the rows at the bottom of the page still get their turn.
+    const uint8_t rowCount = pageMaxRow + 1;
+    for (uint8_t n = 0; n < rowCount; n++) {
+        i = (nextRow + n) % rowCount;
+        p = pageTop + i;
+
         if (IS_PRINTLABEL(runtimeEntryFlags[i])) {
             uint8_t coloff = leftMenuColumn;
             coloff += (p->type == OME_Label) ? 0 : 1;
             room -= displayWrite(pDisplay, coloff, top + i * linesPerMenuItem, p->text);
             CLR_PRINTLABEL(runtimeEntryFlags[i]);
-            if (room < 30)
+            if (room < 30) {
+                nextRow = i;
                 return;
+            }
         }
 
-    // Print values
-
-    // XXX Polled values at latter positions in the list may not be
-    // XXX printed if not enough room in the middle of the list.
-
         if (IS_PRINTVALUE(runtimeEntryFlags[i])) {
             bool selectedRow = i == currentCtx.cursorRow;
-            room -= cmsDrawMenuEntry(pDisplay, p, top + i * linesPerMenuItem, selectedRow, &runtimeEntryFlags[i]);
-            if (room < 30)
+            room -= cmsDrawMenuEntry(pDisplay, p, top + i * linesPerMenuItem, selectedRow, &runtimeEntryFlags[i], &runtimeEntryValueHash[i]);
+            if (room < 30) {
+                nextRow = (i + 1) % rowCount;
                 return;
+            }
         }
     }
 }
@@ -1243,6 +1274,8 @@ static void cmsUpdate(uint32_t currentTimeUs)
         }
 
         cmsDrawMenu(pCurrentDisplay, currentTimeUs);
+        // Displays that buffer writes, e.g. MSP, send them now
+        displayDrawScreen(pCurrentDisplay);
 
         if (currentTimeMs > lastCmsHeartBeatMs + 500) {
             // Heart beat for external CMS display device @ 500msec
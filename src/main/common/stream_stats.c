@@ -0,0 +1,69 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#include "common/stream_stats.h"
+
+void streamStatsInit(streamStats_t *stats, uint8_t percent, uint16_t step)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->percent = percent;
+    stats->step = step;
+}
+
+void streamStatsAdd(streamStats_t *stats, int32_t value)
+{
+    if (stats->count == 0) {
+        stats->min = value;
+        stats->max = value;
+        stats->percentile = value;
+    } else {
+        if (value < stats->min) {
+            stats->min = value;
+        }
+        if (value > stats->max) {
+            stats->max = value;
+        }
+        if (stats->percent) {
+            if (value > stats->percentile) {
+                stats->percentile += stats->percent * stats->step;
+                if (stats->percentile > value) {
+                    stats->percentile = value;
+                }
+            } else if (value < stats->percentile) {
+                stats->percentile -= (100 - stats->percent) * stats->step;
+                if (stats->percentile < value) {
+                    stats->percentile = value;
+                }
+            }
+        }
+    }
+    stats->sum += value;
+    stats->count++;
+}
+
+int32_t streamStatsMean(const streamStats_t *stats)
+{
+    return stats->count ? stats->sum / (int32_t)stats->count : 0;
+}
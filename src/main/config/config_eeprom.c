@@ -27,6 +27,7 @@
 #include "build/build_config.h"
 
 #include "common/crc.h"
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "config/config_eeprom.h"
@@ -40,8 +41,10 @@
 
 #include "drivers/flash.h"
 #include "drivers/system.h"
+#include "drivers/time.h"
 
 static uint16_t eepromConfigSize;
+static configSaveStats_t configSaveStats;
 
 typedef enum {
     CR_CLASSICATION_SYSTEM   = 0,
@@ -56,6 +59,7 @@ typedef enum {
 typedef struct {
     uint8_t eepromConfigVersion;
     uint8_t magic_be;           // magic number, should be 0xBE
+    uint16_t generation;        // incremented on every full write, so that no appended record outlives it
 } PG_PACKED configHeader_t;
 
 // Header for each stored PG.
@@ -77,6 +81,18 @@ typedef struct {
 } PG_PACKED configFooter_t;
 // checksum is appended just after footer. It is not included in footer to make checksum calculation consistent
 
+// Saves that only change a few PGs append records for them after the saved copy instead of erasing and rewriting it,
+// until the config area is full. Each appended record is a configRecord_t followed by a CRC, padded to the config
+// streamer's write size. The CRC carries on from the previous record's CRC, or the saved copy's checksum for the
+// first record, so the appended records end at the first one that doesn't match, such as erased storage, a record
+// that was cut short by a power loss or a stale record left behind by an earlier generation.
+typedef uint16_t configAppendedCrc_t;
+
+typedef struct {
+    const uint8_t *p;           // where the next appended record is, or would be written
+    uint16_t crc;               // CRC to carry on from
+} configAppendedIterator_t;
+
 // Used to check the compiler packing at build time.
 typedef struct {
     uint8_t byte;
@@ -249,6 +265,7 @@ void initEEPROM(void)
     STATIC_ASSERT(offsetof(packingTest_t, word) == 1, word_packing_test_failed);
     STATIC_ASSERT(sizeof(packingTest_t) == 5, overall_packing_test_failed);
 
+    STATIC_ASSERT(sizeof(configHeader_t) == 4, header_size_failed);
     STATIC_ASSERT(sizeof(configFooter_t) == 2, footer_size_failed);
     STATIC_ASSERT(sizeof(configRecord_t) == 6, record_size_failed);
 
@@ -281,6 +298,67 @@ bool isEEPROMVersionValid(void)
     return true;
 }
 
+static bool isRecordValid(const configRecord_t *record)
+{
+    return record->size != 0
+        && (const uint8_t *)record + record->size < &__config_end
+        && record->size >= sizeof(*record);
+}
+
+static const uint8_t *alignToWriteSize(const uint8_t *p)
+{
+    const uintptr_t offset = p - &__config_start;
+    return &__config_start + (offset + CONFIG_STREAMER_BUFFER_SIZE - 1) / CONFIG_STREAMER_BUFFER_SIZE * CONFIG_STREAMER_BUFFER_SIZE;
+}
+
+static int appendedRecordSize(int pgSize)
+{
+    const int size = sizeof(configRecord_t) + pgSize + sizeof(configAppendedCrc_t);
+    return (size + CONFIG_STREAMER_BUFFER_SIZE - 1) / CONFIG_STREAMER_BUFFER_SIZE * CONFIG_STREAMER_BUFFER_SIZE;
+}
+
+// Start at the first appended record, this assumes that the saved copy is valid
+static void initAppendedIterator(configAppendedIterator_t *it)
+{
+    const uint8_t *p = &__config_start + sizeof(configHeader_t);
+    while (isRecordValid((const configRecord_t *)p)) {
+        p += ((const configRecord_t *)p)->size;
+    }
+    p += sizeof(configFooter_t);
+
+    memcpy(&it->crc, p, sizeof(it->crc));
+    it->p = alignToWriteSize(p + sizeof(it->crc));
+}
+
+// Returns the next appended record, or NULL at the end of them
+static const configRecord_t *nextAppendedRecord(configAppendedIterator_t *it)
+{
+    const configRecord_t *record = (const configRecord_t *)it->p;
+    if (it->p + sizeof(*record) > &__config_end
+        || !isRecordValid(record)
+        || it->p + record->size + sizeof(configAppendedCrc_t) > &__config_end) {
+        return NULL;
+    }
+
+    const uint16_t crc = crc16_ccitt_update(it->crc, record, record->size);
+    configAppendedCrc_t storedCrc;
+    memcpy(&storedCrc, it->p + record->size, sizeof(storedCrc));
+    if (crc != storedCrc) {
+        return NULL;
+    }
+
+    it->crc = crc;
+    it->p += appendedRecordSize(record->size - sizeof(*record));
+    return record;
+}
+
+static void findAppendedEnd(configAppendedIterator_t *it)
+{
+    initAppendedIterator(it);
+    while (nextAppendedRecord(it)) {
+    }
+}
+
 // Scan the EEPROM config. Returns true if the config is valid.
 bool isEEPROMStructureValid(void)
 {
@@ -320,12 +398,22 @@ bool isEEPROMStructureValid(void)
     // include stored CRC in the CRC calculation
     const uint16_t *storedCrc = (const uint16_t *)p;
     crc = crc16_ccitt_update(crc, storedCrc, sizeof(*storedCrc));
-    p += sizeof(storedCrc);
+    p += sizeof(*storedCrc);
 
     eepromConfigSize = p - &__config_start;
 
     // CRC has the property that if the CRC itself is included in the calculation the resulting CRC will have constant value
-    return crc == CRC_CHECK_VALUE;
+    if (crc != CRC_CHECK_VALUE) {
+        return false;
+    }
+
+    configAppendedIterator_t it;
+    findAppendedEnd(&it);
+    if (it.p > p) {
+        eepromConfigSize = it.p - &__config_start;
+    }
+
+    return true;
 }
 
 uint16_t getEEPROMConfigSize(void)
@@ -333,6 +421,11 @@ uint16_t getEEPROMConfigSize(void)
     return eepromConfigSize;
 }
 
+const configSaveStats_t *getConfigSaveStats(void)
+{
+    return &configSaveStats;
+}
+
 size_t getEEPROMStorageSize(void)
 {
 #if defined(CONFIG_IN_EXTERNAL_FLASH)
@@ -350,19 +443,33 @@ size_t getEEPROMStorageSize(void)
 // find config record for reg + classification (profile info) in EEPROM
 // return NULL when record is not found
 // this function assumes that EEPROM content is valid
-static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification)
+// The search starts at *cursor and wraps around, and on success *cursor is left just after the record found.
+// writeSettingsToEEPROM() stores the records in registry order, so when loading the PGs in registry order the record
+// sought is normally the one at the cursor.
+static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFlags_e classification, const uint8_t **cursor)
 {
-    const uint8_t *p = &__config_start;
-    p += sizeof(configHeader_t);             // skip header
+    const uint8_t *first = &__config_start + sizeof(configHeader_t);   // skip header
+    const uint8_t *p = *cursor;
+    bool wrapped = false;
     while (true) {
         const configRecord_t *record = (const configRecord_t *)p;
-        if (record->size == 0
-            || p + record->size >= &__config_end
-            || record->size < sizeof(*record))
+        if (!isRecordValid(record)) {
+            if (wrapped) {
+                break;
+            }
+            // end of records, carry on from the first one
+            p = first;
+            wrapped = true;
+            continue;
+        }
+        if (wrapped && p >= *cursor) {
             break;
+        }
         if (pgN(reg) == record->pgn
-            && (record->flags & CR_CLASSIFICATION_MASK) == classification)
+            && (record->flags & CR_CLASSIFICATION_MASK) == classification) {
+            *cursor = p + record->size;
             return record;
+        }
         p += record->size;
     }
     // record not found
@@ -370,14 +477,16 @@ static const configRecord_t *findEEPROM(const pgRegistry_t *reg, configRecordFla
 }
 
 // Initialize all PG records from EEPROM.
-// This functions processes all PGs sequentially, scanning EEPROM for each one. This is suboptimal,
-//   but each PG is loaded/initialized exactly once and in defined order.
+// This functions processes all PGs sequentially, so each PG is loaded/initialized exactly once and in defined order.
+// As the records are stored in the same order, this takes a single pass over EEPROM unless PGs were added to or
+//   removed from the firmware since the config was saved, when each missing record costs one more pass.
 bool loadEEPROM(void)
 {
     bool success = true;
+    const uint8_t *cursor = &__config_start + sizeof(configHeader_t);
 
     PG_FOREACH(reg) {
-        const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM);
+        const configRecord_t *rec = findEEPROM(reg, CR_CLASSICATION_SYSTEM, &cursor);
         if (rec) {
             // config from EEPROM is available, use it to initialize PG. pgLoad will handle version mismatch
             if (!pgLoad(reg, rec->pg, rec->size - offsetof(configRecord_t, pg), rec->version)) {
@@ -390,11 +499,115 @@ bool loadEEPROM(void)
         }
     }
 
+    // Then the records appended since, in the order they were saved
+    configAppendedIterator_t it;
+    initAppendedIterator(&it);
+    for (const configRecord_t *rec; (rec = nextAppendedRecord(&it)); ) {
+        const pgRegistry_t *reg = pgFind(rec->pgn);
+        if (reg && (rec->flags & CR_CLASSIFICATION_MASK) == CR_CLASSICATION_SYSTEM) {
+            pgLoad(reg, rec->pg, rec->size - offsetof(configRecord_t, pg), rec->version);
+        }
+    }
+
+    return success;
+}
+
+// Returns the record the PG would be loaded from, which is the last one appended for it if there is one
+// The appended records from appendedStart to appendedEnd must have been checked already.
+static const configRecord_t *findLatestEEPROM(const pgRegistry_t *reg, const uint8_t **cursor, const uint8_t *appendedStart, const uint8_t *appendedEnd)
+{
+    const configRecord_t *latest = findEEPROM(reg, CR_CLASSICATION_SYSTEM, cursor);
+
+    for (const uint8_t *p = appendedStart; p < appendedEnd; ) {
+        const configRecord_t *rec = (const configRecord_t *)p;
+        if (rec->pgn == pgN(reg) && (rec->flags & CR_CLASSIFICATION_MASK) == CR_CLASSICATION_SYSTEM) {
+            latest = rec;
+        }
+        p += appendedRecordSize(rec->size - sizeof(*rec));
+    }
+    return latest;
+}
+
+// PGs are changed through pointers all over the code, so rather than tracking changes a PG counts as changed when it
+// differs from the record it would be loaded from.
+static bool isPgChanged(const pgRegistry_t *reg, const configRecord_t *rec)
+{
+    const uint16_t regSize = pgSize(reg);
+    return !rec
+        || rec->version != pgVersion(reg)
+        || rec->size - offsetof(configRecord_t, pg) != regSize
+        || memcmp(rec->pg, reg->address, regSize) != 0;
+}
+
+// Append records for the changed PGs. Returns false if they don't fit or couldn't be written.
+static bool appendSettingsToEEPROM(void)
+{
+    if (!isEEPROMVersionValid() || !isEEPROMStructureValid()) {
+        return false;
+    }
+
+    configAppendedIterator_t it;
+    initAppendedIterator(&it);
+    const uint8_t *appendedStart = it.p;
+    while (nextAppendedRecord(&it)) {
+    }
+
+    const uint8_t *cursor = &__config_start + sizeof(configHeader_t);
+    int appendSize = 0;
+    PG_FOREACH(reg) {
+        if (isPgChanged(reg, findLatestEEPROM(reg, &cursor, appendedStart, it.p))) {
+            appendSize += appendedRecordSize(pgSize(reg));
+        }
+    }
+    configSaveStats.lastRecordCount = 0;
+    if (appendSize == 0) {
+        // Nothing to do
+        return true;
+    }
+    if (it.p + appendSize > &__config_end || !config_streamer_can_append((uintptr_t)it.p, appendSize)) {
+        return false;
+    }
+
+    config_streamer_t streamer;
+    config_streamer_init(&streamer);
+
+    config_streamer_start(&streamer, (uintptr_t)it.p, &__config_end - it.p);
+
+    cursor = &__config_start + sizeof(configHeader_t);
+    uint16_t crc = it.crc;
+    PG_FOREACH(reg) {
+        if (!isPgChanged(reg, findLatestEEPROM(reg, &cursor, appendedStart, it.p))) {
+            continue;
+        }
+        const uint16_t regSize = pgSize(reg);
+        const configRecord_t record = {
+            .size = sizeof(configRecord_t) + regSize,
+            .pgn = pgN(reg),
+            .version = pgVersion(reg),
+            .flags = CR_CLASSICATION_SYSTEM
+        };
+        config_streamer_write(&streamer, (uint8_t *)&record, sizeof(record));
+        crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
+        config_streamer_write(&streamer, reg->address, regSize);
+        crc = crc16_ccitt_update(crc, reg->address, regSize);
+        const configAppendedCrc_t appendedCrc = crc;
+        config_streamer_write(&streamer, (uint8_t *)&appendedCrc, sizeof(appendedCrc));
+        config_streamer_flush(&streamer);
+
+        configSaveStats.lastRecordCount++;
+    }
+
+    const bool success = config_streamer_finish(&streamer) == 0;
+    configSaveStats.eraseCount += streamer.erases;
+
     return success;
 }
 
 static bool writeSettingsToEEPROM(void)
 {
+    const configHeader_t *previousHeader = (const configHeader_t *)&__config_start;
+    const uint16_t generation = isEEPROMVersionValid() && previousHeader->magic_be == 0xBE ? previousHeader->generation + 1 : 0;
+
     config_streamer_t streamer;
     config_streamer_init(&streamer);
 
@@ -403,6 +616,7 @@ static bool writeSettingsToEEPROM(void)
     configHeader_t header = {
         .eepromConfigVersion =  EEPROM_CONF_VERSION,
         .magic_be =             0xBE,
+        .generation =           generation,
     };
 
     config_streamer_write(&streamer, (uint8_t *)&header, sizeof(header));
@@ -438,17 +652,28 @@ static bool writeSettingsToEEPROM(void)
     config_streamer_flush(&streamer);
 
     const bool success = config_streamer_finish(&streamer) == 0;
+    configSaveStats.eraseCount += streamer.erases;
 
     return success;
 }
 
 void writeConfigToEEPROM(void)
 {
+    const timeUs_t startTimeUs = micros();
     bool success = false;
+
+    // Only write the changed PGs if they fit
+    if (appendSettingsToEEPROM()) {
+        success = true;
+        configSaveStats.appendCount++;
+    }
+
     // write it
     for (int attempt = 0; attempt < 3 && !success; attempt++) {
         if (writeSettingsToEEPROM()) {
             success = true;
+            configSaveStats.compactCount++;
+            configSaveStats.lastRecordCount = PG_REGISTRY_SIZE;
 
 #ifdef CONFIG_IN_EXTERNAL_FLASH
             // copy it back from flash to the in-memory buffer.
@@ -461,6 +686,8 @@ void writeConfigToEEPROM(void)
         }
     }
 
+    configSaveStats.lastSaveUs = micros() - startTimeUs;
+    configSaveStats.maxSaveUs = MAX(configSaveStats.maxSaveUs, configSaveStats.lastSaveUs);
 
     if (success && isEEPROMVersionValid() && isEEPROMStructureValid()) {
         return;
@@ -469,3 +696,67 @@ void writeConfigToEEPROM(void)
     // Flash write failed - just die now
     failureMode(FAILURE_CONFIG_STORE_FAILURE);
 }
+
+// The config snapshot is the PGs in RAM as the records writeSettingsToEEPROM() would write for them, without the
+// header, footer and checksum. It is generated on the fly, so reading it costs no RAM however big the config is.
+static configRecord_t configSnapshotRecord(const pgRegistry_t *reg)
+{
+    const configRecord_t record = {
+        .size = sizeof(configRecord_t) + pgSize(reg),
+        .pgn = pgN(reg),
+        .version = pgVersion(reg),
+        .flags = CR_CLASSICATION_SYSTEM
+    };
+    return record;
+}
+
+uint32_t getConfigSnapshotSize(void)
+{
+    uint32_t size = 0;
+    PG_FOREACH(reg) {
+        size += sizeof(configRecord_t) + pgSize(reg);
+    }
+    return size;
+}
+
+uint16_t getConfigSnapshotCrc(void)
+{
+    uint16_t crc = CRC_START_VALUE;
+    PG_FOREACH(reg) {
+        const configRecord_t record = configSnapshotRecord(reg);
+        crc = crc16_ccitt_update(crc, (uint8_t *)&record, sizeof(record));
+        crc = crc16_ccitt_update(crc, reg->address, pgSize(reg));
+    }
+    return crc;
+}
+
+// Copies up to length bytes of the snapshot from offset on, returns the number of bytes copied
+int readConfigSnapshot(uint32_t offset, uint8_t *buffer, int length)
+{
+    uint32_t recordOffset = 0;
+    int copied = 0;
+    PG_FOREACH(reg) {
+        if (copied == length) {
+            break;
+        }
+        const uint16_t regSize = pgSize(reg);
+        const uint32_t recordEnd = recordOffset + sizeof(configRecord_t) + regSize;
+        if (offset < recordEnd) {
+            const configRecord_t record = configSnapshotRecord(reg);
+            uint32_t skip = offset - recordOffset;
+            int take = MIN((uint32_t)(length - copied), recordEnd - offset);
+            offset += take;
+            if (skip < sizeof(record)) {
+                const int headerTake = MIN((uint32_t)take, sizeof(record) - skip);
+                memcpy(buffer + copied, (uint8_t *)&record + skip, headerTake);
+                copied += headerTake;
+                take -= headerTake;
+                skip = sizeof(record);
+            }
+            memcpy(buffer + copied, reg->address + skip - sizeof(record), take);
+            copied += take;
+        }
+        recordOffset = recordEnd;
+    }
+    return copied;
+}
@@ -23,7 +23,16 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#define EEPROM_CONF_VERSION 172
+#define EEPROM_CONF_VERSION 173
+
+typedef struct configSaveStats_s {
+    uint32_t appendCount;       // saves that only appended the changed PGs, if any, to the config area
+    uint32_t compactCount;      // saves that rewrote the whole config area
+    uint32_t eraseCount;        // flash pages or sectors erased
+    uint32_t lastSaveUs;
+    uint32_t maxSaveUs;
+    uint16_t lastRecordCount;   // PGs written by the last save
+} configSaveStats_t;
 
 bool isEEPROMVersionValid(void);
 bool isEEPROMStructureValid(void);
@@ -31,4 +40,9 @@ bool loadEEPROM(void);
 void writeConfigToEEPROM(void);
 
 uint16_t getEEPROMConfigSize(void);
+const configSaveStats_t *getConfigSaveStats(void);
 size_t getEEPROMStorageSize(void);
+
+uint32_t getConfigSnapshotSize(void);
+uint16_t getConfigSnapshotCrc(void);
+int readConfigSnapshot(uint32_t offset, uint8_t *buffer, int length);
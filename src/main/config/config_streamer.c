@@ -22,6 +22,9 @@
 
 #include "platform.h"
 
+#include "common/maths.h"
+#include "common/utils.h"
+
 #include "drivers/system.h"
 #include "drivers/flash.h"
 
@@ -30,6 +33,9 @@
 #if !defined(CONFIG_IN_FLASH)
 #if defined(CONFIG_IN_RAM) && defined(PERSISTENT)
 PERSISTENT uint8_t eepromData[EEPROM_SIZE];
+#elif defined(CONFIG_IN_FILE)
+// Page aligned like the flash it stands in for, so that every page written is erased first
+uint8_t eepromData[EEPROM_SIZE] __attribute__((aligned(FLASH_PAGE_SIZE)));
 #else
 uint8_t eepromData[EEPROM_SIZE];
 #endif
@@ -80,6 +86,12 @@ uint8_t eepromData[EEPROM_SIZE];
 # endif
 #endif
 
+#if defined(CONFIG_IN_FLASH) && (defined(STM32F4) || defined(STM32F7) || defined(STM32H7))
+// Reaching any page boundary erases the whole sector the config is in, so the config must not cross one, or appending
+// a save past the boundary would erase everything written before it
+STATIC_ASSERT(EEPROM_SIZE <= FLASH_PAGE_SIZE, eeprom_does_not_fit_in_config_sector);
+#endif
+
 void config_streamer_init(config_streamer_t *c)
 {
     memset(c, 0, sizeof(*c));
@@ -388,6 +400,7 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
 
         if (flashAddress % flashSectorSize == 0) {
             flashEraseSector(flashAddress);
+            c->erases++;
         }
 
         flashPageProgramBegin(flashAddress);
@@ -398,16 +411,10 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
 #elif defined(CONFIG_IN_RAM) || defined(CONFIG_IN_SDCARD)
     if (c->address == (uintptr_t)&eepromData[0]) {
         memset(eepromData, 0, sizeof(eepromData));
+        c->erases++;
     }
 
-    uint64_t *dest_addr = (uint64_t *)c->address;
-    uint64_t *src_addr = (uint64_t*)buffer;
-    uint8_t row_index = 4;
-    /* copy the 256 bits flash word */
-    do
-    {
-      *dest_addr++ = *src_addr++;
-    } while (--row_index != 0);
+    memcpy((void *)c->address, buffer, CONFIG_STREAMER_BUFFER_SIZE);
 
 #elif defined(CONFIG_IN_FILE)
 
@@ -416,6 +423,7 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
         if (status != FLASH_COMPLETE) {
             return -1;
         }
+        c->erases++;
     }
     const FLASH_Status status = FLASH_ProgramWord(c->address, *buffer);
     if (status != FLASH_COMPLETE) {
@@ -437,6 +445,7 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
         if (status != HAL_OK) {
             return -1;
         }
+        c->erases++;
     }
 
     // For H7
@@ -458,6 +467,7 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
         if (status != HAL_OK) {
             return -1;
         }
+        c->erases++;
     }
 
     // For F7
@@ -476,6 +486,7 @@ static int write_word(config_streamer_t *c, config_streamer_buffer_align_type_t
         if (status != FLASH_COMPLETE) {
             return -1;
         }
+        c->erases++;
     }
     const FLASH_Status status = FLASH_ProgramWord(c->address, *buffer);
     if (status != FLASH_COMPLETE) {
@@ -515,6 +526,36 @@ int config_streamer_flush(config_streamer_t *c)
     return c-> err;
 }
 
+/*
+ * Returns true if size bytes can be streamed from base without erasing anything in front of it. The rest of the page
+ * that base is in must still be erased, any following pages are erased by the streamer on reaching them.
+ */
+bool config_streamer_can_append(uintptr_t base, int size)
+{
+#if defined(CONFIG_IN_EXTERNAL_FLASH) || defined(CONFIG_IN_SDCARD)
+    // The streamer only writes whole pages or the whole file, starting from the beginning
+    UNUSED(base);
+    UNUSED(size);
+    return false;
+#else
+    if (base % CONFIG_STREAMER_BUFFER_SIZE != 0) {
+        return false;
+    }
+    const uint8_t *p = (const uint8_t *)base;
+#if defined(CONFIG_IN_RAM)
+    const uint8_t *end = p + size;
+#else
+    const uint8_t *end = p + MIN((uintptr_t)size, FLASH_PAGE_SIZE - base % FLASH_PAGE_SIZE);
+#endif
+    for (; p < end; p++) {
+        if (*p != CONFIG_STREAMER_ERASED_VALUE) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
 int config_streamer_finish(config_streamer_t *c)
 {
     if (c->unlocked) {
@@ -37,6 +37,13 @@ typedef uint64_t config_streamer_buffer_align_type_t;
 typedef uint32_t config_streamer_buffer_align_type_t;
 #endif
 
+// Value of the bytes in an erased page, which can be written without erasing first.
+#if defined(CONFIG_IN_RAM) || defined(CONFIG_IN_SDCARD)
+#define CONFIG_STREAMER_ERASED_VALUE 0x00
+#else
+#define CONFIG_STREAMER_ERASED_VALUE 0xFF
+#endif
+
 typedef struct config_streamer_s {
     uintptr_t address;
     int size;
@@ -46,6 +53,7 @@ typedef struct config_streamer_s {
     } buffer;
     int at;
     int err;
+    int erases;     // pages or sectors erased since config_streamer_init()
     bool unlocked;
 } config_streamer_t;
 
@@ -57,3 +65,5 @@ int config_streamer_flush(config_streamer_t *c);
 
 int config_streamer_finish(config_streamer_t *c);
 int config_streamer_status(config_streamer_t *c);
+
+bool config_streamer_can_append(uintptr_t base, int size);
@@ -0,0 +1,97 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_CRC_HW
+
+#if !defined(STM32F7) && !defined(STM32H7)
+#error "USE_CRC_HW needs a CRC unit with a programmable polynomial"
+#endif
+
+#include "build/atomic.h"
+
+#include "common/maths.h"
+
+#include "drivers/nvic.h"
+#include "drivers/rcc.h"
+
+#include "crc.h"
+
+#define CRC_HW_BLOCK_SIZE 64U // bytes fed to the unit with interrupts masked
+
+static bool crcHwInitialised = false;
+
+static uint32_t crcHwPolySizeBits(uint8_t polySize)
+{
+    switch (polySize) {
+    case 7:
+        return CRC_CR_POLYSIZE_0 | CRC_CR_POLYSIZE_1;
+    case 8:
+        return CRC_CR_POLYSIZE_1;
+    case 16:
+        return CRC_CR_POLYSIZE_0;
+    case 32:
+    default:
+        return 0;
+    }
+}
+
+uint32_t crcHwUpdate(uint8_t polySize, uint32_t poly, uint32_t crc, const void *data, uint32_t length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    const uint32_t mask = polySize < 32 ? (1UL << polySize) - 1 : 0xFFFFFFFF;
+
+    if (!crcHwInitialised) {
+#if defined(STM32H7)
+        RCC_ClockCmd(RCC_AHB4(CRC), ENABLE);
+#else
+        RCC_ClockCmd(RCC_AHB1(CRC), ENABLE);
+#endif
+        crcHwInitialised = true;
+    }
+
+    while (length > 0) {
+        const uint32_t blockLength = MIN(length, CRC_HW_BLOCK_SIZE);
+
+        // The unit is shared by all callers, which may be in different interrupt priorities. It is only held for a
+        // block at a time, continuing from the CRC of the block before, so a long buffer doesn't hold interrupts off
+        ATOMIC_BLOCK(NVIC_PRIO_MAX) {
+            CRC->POL = poly;
+            CRC->INIT = crc;
+            CRC->CR = crcHwPolySizeBits(polySize) | CRC_CR_RESET;
+
+            for (uint32_t i = 0; i < blockLength; i++, p++) {
+                *(__IO uint8_t *)&CRC->DR = *p;
+            }
+
+            crc = CRC->DR & mask;
+        }
+
+        length -= blockLength;
+    }
+
+    return crc;
+}
+
+#endif // USE_CRC_HW
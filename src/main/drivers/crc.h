@@ -0,0 +1,34 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Optional use of the CRC unit of the STM32F7 and H7 for the bulk CRC functions in common/crc.c, enabled by
+ * USE_CRC_HW. The unit takes a programmable polynomial of 7, 8, 16 or 32 bits, which covers the MSB first CRCs
+ * used by the serial protocols.
+ *
+ * Short frames are quicker done by table lookup than by setting up the unit.
+ */
+#define CRC_HW_MIN_LENGTH 16
+
+uint32_t crcHwUpdate(uint8_t polySize, uint32_t poly, uint32_t crc, const void *data, uint32_t length);
@@ -31,6 +31,7 @@
 void displayClearScreen(displayPort_t *instance)
 {
     instance->vTable->clearScreen(instance);
+    instance->clearCount++;
     instance->cleared = true;
     instance->cursorRow = -1;
 }
@@ -29,6 +29,7 @@ typedef struct displayPort_s {
     uint8_t cols;
     uint8_t posX;
     uint8_t posY;
+    uint16_t clearCount;    // so that anything drawing incrementally can tell that the screen was cleared under it
 
     // CMS state
     bool useFullscreen;
@@ -61,6 +62,7 @@ typedef struct displayPortProfile_s {
     uint8_t blackBrightness;
     uint8_t whiteBrightness;
     int8_t displayPortSerial;  // serialPortIdentifier_e
+    uint8_t batchWrites;       // MSP displayport only, send the changes in MSP_DP_WRITE_STRINGS frames
 } displayPortProfile_t;
 
 // Note: displayPortProfile_t used as a parameter group for CMS over CRSF (io/displayport_crsf)
@@ -20,12 +20,15 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "drivers/bus_i2c.h"
+#include "drivers/time.h"
 
 #include "display_ug2864hsweg01.h"
 
@@ -173,6 +176,83 @@ static const uint8_t multiWiiFont[][5] = { // Refer to "Times New Roman" Font Da
                 { 0x7A, 0x7E, 0x7E, 0x7E, 0x7A }, //   (131)    - 0x00C8 Vertical Bargraph - 6 (full)
         };
 
+/*
+ * Drawing goes into a framebuffer laid out as the display's RAM, a byte for each column of each 8 pixel high page,
+ * and each page keeps the span of columns that changed. i2c_OLED_flush sends the changed spans a chunk at a time, so
+ * that no call holds up the scheduler for long. It starts a chunk and returns, and the next call, once the bus is free,
+ * collects how it went before starting another.
+ */
+#define SCREEN_PAGE_COUNT (SCREEN_HEIGHT / 8)
+
+static uint8_t framebuffer[SCREEN_PAGE_COUNT][SCREEN_WIDTH];
+static uint8_t dirtyStart[SCREEN_PAGE_COUNT];
+static uint8_t dirtyEnd[SCREEN_PAGE_COUNT];     // exclusive, the page is clean when dirtyStart >= dirtyEnd
+
+// Where the next byte is drawn
+static uint8_t cursorPage;
+static uint8_t cursorColumn;
+
+// Where the display's RAM pointer is, devicePage is -1 if unknown
+static int8_t devicePage = -1;
+static uint8_t deviceColumn;
+
+typedef enum {
+    FLUSH_TRANSFER_NONE,
+    FLUSH_TRANSFER_POINTER,     // moving the display's RAM pointer to flushPage and flushColumn
+    FLUSH_TRANSFER_DATA,        // flushLength bytes of flushPage from flushColumn
+} flushTransfer_e;
+
+// The transfer started by the last i2c_OLED_flush, nothing is taken as sent until it's finished without an error
+static flushTransfer_e flushTransfer;
+static uint8_t flushPage;
+static uint8_t flushColumn;
+static uint8_t flushLength;
+static uint8_t flushBuffer[UG2864_FLUSH_CHUNK_BYTES];  // a copy, as the framebuffer may be drawn into meanwhile
+
+static bool i2c_OLED_bus_busy(busDevice_t *bus, bool *error)
+{
+    const I2CDevice device = bus->busdev_u.i2c.device;
+    return device != I2CINVALID && device < I2CDEV_COUNT && i2cBusy(device, error);
+}
+
+static void i2c_OLED_finish_transfer(bool error)
+{
+    switch (flushTransfer) {
+    case FLUSH_TRANSFER_POINTER:
+        devicePage = error ? -1 : flushPage;
+        deviceColumn = flushColumn;
+        break;
+    case FLUSH_TRANSFER_DATA:
+        if (error) {
+            // The chunk stays dirty, and where the RAM pointer got to isn't known
+            devicePage = -1;
+            break;
+        }
+
+        // Columns drawn into since the chunk was copied stay dirty
+        if (dirtyStart[flushPage] == flushColumn) {
+            uint8_t sent = 0;
+            while (sent < flushLength && framebuffer[flushPage][flushColumn + sent] == flushBuffer[sent]) {
+                sent++;
+            }
+            dirtyStart[flushPage] += sent;
+        }
+
+        devicePage = flushPage;
+        deviceColumn = flushColumn + flushLength;
+        if (deviceColumn >= SCREEN_WIDTH) {
+            // Wrapped onto the next page
+            devicePage = (flushPage + 1) % SCREEN_PAGE_COUNT;
+            deviceColumn = 0;
+        }
+        break;
+    case FLUSH_TRANSFER_NONE:
+        break;
+    }
+
+    flushTransfer = FLUSH_TRANSFER_NONE;
+}
+
 static bool i2c_OLED_send_cmd(busDevice_t *bus, uint8_t command)
 {
     return i2cWrite(bus->busdev_u.i2c.device, bus->busdev_u.i2c.address, 0x80, command);
@@ -180,6 +260,10 @@ static bool i2c_OLED_send_cmd(busDevice_t *bus, uint8_t command)
 
 static bool i2c_OLED_send_cmdarray(busDevice_t *bus, const uint8_t *commands, size_t len)
 {
+    // The display's RAM pointer may move, and a chunk in flight is sent again
+    devicePage = -1;
+    flushTransfer = FLUSH_TRANSFER_NONE;
+
     for (size_t i = 0 ; i < len ; i++) {
         if (!i2c_OLED_send_cmd(bus, commands[i])) {
             return false;
@@ -189,25 +273,40 @@ static bool i2c_OLED_send_cmdarray(busDevice_t *bus, const uint8_t *commands, si
     return true;
 }
 
-static bool i2c_OLED_send_byte(busDevice_t *bus, uint8_t val)
+static void i2c_OLED_draw_byte(uint8_t val)
 {
-    return i2cWrite(bus->busdev_u.i2c.device, bus->busdev_u.i2c.address, 0x40, val);
+    uint8_t *pixels = &framebuffer[cursorPage][cursorColumn];
+    if (*pixels != val) {
+        *pixels = val;
+        if (dirtyStart[cursorPage] >= dirtyEnd[cursorPage]) {
+            dirtyStart[cursorPage] = cursorColumn;
+            dirtyEnd[cursorPage] = cursorColumn + 1;
+        } else if (cursorColumn < dirtyStart[cursorPage]) {
+            dirtyStart[cursorPage] = cursorColumn;
+        } else if (cursorColumn >= dirtyEnd[cursorPage]) {
+            dirtyEnd[cursorPage] = cursorColumn + 1;
+        }
+    }
+
+    // Wrap onto the next page, as the display does in horizontal addressing mode
+    if (++cursorColumn >= SCREEN_WIDTH) {
+        cursorColumn = 0;
+        cursorPage = (cursorPage + 1) % SCREEN_PAGE_COUNT;
+    }
 }
 
 void i2c_OLED_clear_display_quick(busDevice_t *bus)
 {
-    static const uint8_t i2c_OLED_cmd_clear_display_quick[] = {
-        0xb0, // set page address to 0
-        0x40, // Display start line register to 0
-        0,    // Set low col address to 0
-        0x10, // Set high col address to 0
-    };
-
-    i2c_OLED_send_cmdarray(bus, i2c_OLED_cmd_clear_display_quick, ARRAYLEN(i2c_OLED_cmd_clear_display_quick));
+    UNUSED(bus);
 
-    for (uint16_t i = 0; i < 1024; i++) {      // fill the display's RAM with graphic... 128*64 pixel picture
-        i2c_OLED_send_byte(bus, 0x00);  // clear
+    for (int page = 0; page < SCREEN_PAGE_COUNT; page++) {
+        cursorPage = page;
+        cursorColumn = 0;
+        for (int column = 0; column < SCREEN_WIDTH; column++) {
+            i2c_OLED_draw_byte(0x00);
+        }
     }
+    cursorPage = 0;
 }
 
 void i2c_OLED_clear_display(busDevice_t *bus)
@@ -221,7 +320,14 @@ void i2c_OLED_clear_display(busDevice_t *bus)
 
     i2c_OLED_send_cmdarray(bus, i2c_OLED_cmd_clear_display_pre, ARRAYLEN(i2c_OLED_cmd_clear_display_pre));
 
-    i2c_OLED_clear_display_quick(bus);
+    // Nothing is known about the display's RAM, so all of it has to be sent
+    memset(framebuffer, 0, sizeof(framebuffer));
+    for (int page = 0; page < SCREEN_PAGE_COUNT; page++) {
+        dirtyStart[page] = 0;
+        dirtyEnd[page] = SCREEN_WIDTH;
+    }
+    cursorPage = 0;
+    cursorColumn = 0;
 
     static const uint8_t i2c_OLED_cmd_clear_display_post[] = {
         0x81, // Setup CONTRAST CONTROL, following byte is the contrast Value... always a 2 byte instruction
@@ -234,13 +340,10 @@ void i2c_OLED_clear_display(busDevice_t *bus)
 
 void i2c_OLED_set_xy(busDevice_t *bus, uint8_t col, uint8_t row)
 {
-    uint8_t i2c_OLED_cmd_set_xy[] = {
-        0xb0 + row,                                            //set page address
-        0x00 + ((CHARACTER_WIDTH_TOTAL * col) & 0x0f),         //set low col address
-        0x10 + (((CHARACTER_WIDTH_TOTAL * col) >> 4) & 0x0f)   //set high col address
-    };
+    UNUSED(bus);
 
-    i2c_OLED_send_cmdarray(bus, i2c_OLED_cmd_set_xy, ARRAYLEN(i2c_OLED_cmd_set_xy));
+    cursorPage = row % SCREEN_PAGE_COUNT;
+    cursorColumn = MIN(CHARACTER_WIDTH_TOTAL * col, SCREEN_WIDTH - 1);
 }
 
 void i2c_OLED_set_line(busDevice_t *bus, uint8_t row)
@@ -250,14 +353,16 @@ void i2c_OLED_set_line(busDevice_t *bus, uint8_t row)
 
 void i2c_OLED_send_char(busDevice_t *bus, unsigned char ascii)
 {
+    UNUSED(bus);
+
     unsigned char i;
     uint8_t buffer;
     for (i = 0; i < 5; i++) {
         buffer = multiWiiFont[ascii - 32][i];
         buffer ^= CHAR_FORMAT;  // apply
-        i2c_OLED_send_byte(bus, buffer);
+        i2c_OLED_draw_byte(buffer);
     }
-    i2c_OLED_send_byte(bus, CHAR_FORMAT);    // the gap
+    i2c_OLED_draw_byte(CHAR_FORMAT);    // the gap
 }
 
 void i2c_OLED_send_string(busDevice_t *bus, const char *string)
@@ -269,12 +374,76 @@ void i2c_OLED_send_string(busDevice_t *bus, const char *string)
     }
 }
 
+bool i2c_OLED_is_synced(void)
+{
+    for (int page = 0; page < SCREEN_PAGE_COUNT; page++) {
+        if (dirtyStart[page] < dirtyEnd[page]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Collects the chunk started by the last call, then starts the next chunk of the framebuffer that changed, of at most
+ * UG2864_FLUSH_CHUNK_BYTES, if the bus is free. Moving the display's RAM pointer takes a call of its own, but isn't
+ * needed when a chunk carries on from the last one. A chunk that isn't acknowledged stays dirty, to be sent again.
+ * Returns true when the display is up to date.
+ */
+bool i2c_OLED_flush(busDevice_t *bus)
+{
+    // The bus is shared, so the error is that of the last transfer on it, which is ours unless another device has
+    // had the bus since
+    bool error = false;
+    if (i2c_OLED_bus_busy(bus, &error)) {
+        return false;
+    }
+    i2c_OLED_finish_transfer(error);
+
+    int page = 0;
+    while (dirtyStart[page] >= dirtyEnd[page]) {
+        if (++page >= SCREEN_PAGE_COUNT) {
+            return true;
+        }
+    }
+
+    const I2CDevice device = bus->busdev_u.i2c.device;
+    const uint8_t column = dirtyStart[page];
+    if (devicePage != page || deviceColumn != column) {
+        flushBuffer[0] = 0xb0 + page;               // set page address
+        flushBuffer[1] = 0x00 + (column & 0x0f);    // set low col address
+        flushBuffer[2] = 0x10 + (column >> 4);      // set high col address
+        if (i2cWriteBuffer(device, bus->busdev_u.i2c.address, 0x00, 3, flushBuffer)) {
+            flushTransfer = FLUSH_TRANSFER_POINTER;
+            flushPage = page;
+            flushColumn = column;
+        }
+        return false;
+    }
+
+    const uint8_t length = MIN(dirtyEnd[page] - column, UG2864_FLUSH_CHUNK_BYTES);
+    memcpy(flushBuffer, &framebuffer[page][column], length);
+    if (i2cWriteBuffer(device, bus->busdev_u.i2c.address, 0x40, length, flushBuffer)) {
+        flushTransfer = FLUSH_TRANSFER_DATA;
+        flushPage = page;
+        flushColumn = column;
+        flushLength = length;
+    } else {
+        devicePage = -1;
+    }
+    return false;
+}
+
 /**
 * according to http://www.adafruit.com/datasheets/UG-2864HSWEG01.pdf Chapter 4.4 Page 15
 */
 
 bool ug2864hsweg01InitI2C(busDevice_t *bus)
 {
+    // A chunk may still have the bus, the commands below need it
+    for (int i = 0; i < 10 && i2c_OLED_bus_busy(bus, NULL); i++) {
+        delay(1);
+    }
 
     // Set display OFF
     if (!i2c_OLED_send_cmd(bus, 0xAE)) {
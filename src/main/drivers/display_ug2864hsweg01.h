@@ -39,6 +39,9 @@
 #define VERTICAL_BARGRAPH_ZERO_CHARACTER (128 + 32)
 #define VERTICAL_BARGRAPH_CHARACTER_COUNT 7
 
+// Most bytes of the framebuffer sent by each i2c_OLED_flush
+#define UG2864_FLUSH_CHUNK_BYTES 32
+
 bool ug2864hsweg01InitI2C(busDevice_t *bus);
 
 void i2c_OLED_set_xy(busDevice_t *bus, uint8_t col, uint8_t row);
@@ -47,3 +50,5 @@ void i2c_OLED_send_char(busDevice_t *bus, unsigned char ascii);
 void i2c_OLED_send_string(busDevice_t *bus, const char *string);
 void i2c_OLED_clear_display(busDevice_t *bus);
 void i2c_OLED_clear_display_quick(busDevice_t *bus);
+bool i2c_OLED_flush(busDevice_t *bus);
+bool i2c_OLED_is_synced(void);
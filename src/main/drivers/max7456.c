@@ -28,6 +28,9 @@
 
 #include "build/debug.h"
 
+#include "common/maths.h"
+#include "common/utils.h"
+
 #include "pg/max7456.h"
 #include "pg/vcd.h"
 
@@ -36,10 +39,14 @@
 #include "drivers/io.h"
 #include "drivers/light_led.h"
 #include "drivers/max7456.h"
+#include "drivers/max7456_font.h"
 #include "drivers/max7456_symbols.h"
+#include "drivers/max7456_transfer.h"
 #include "drivers/nvic.h"
 #include "drivers/time.h"
 
+#include "scheduler/scheduler.h"
+
 
 // DEBUG_MAX7456_SIGNAL
 #define DEBUG_MAX7456_SIGNAL_MODEREG       0
@@ -101,7 +108,6 @@
 #define STAT_PAL      0x01
 #define STAT_NTSC     0x02
 #define STAT_LOS      0x04
-#define STAT_NVR_BUSY 0x20
 
 #define STAT_IS_PAL(val)  ((val) & STAT_PAL)
 #define STAT_IS_NTSC(val) ((val) & STAT_NTSC)
@@ -120,28 +126,18 @@
 
 #define MAX7456_SIGNAL_CHECK_INTERVAL_MS 1000 // msec
 #define MAX7456_STALL_CHECK_INTERVAL_MS  1000 // msec
+#define MAX7456_FONT_DONE_MS             500  // msec without glyphs to program before the display is enabled again
 
 // DMM special bits
 #define CLEAR_DISPLAY 0x04
 #define CLEAR_DISPLAY_VERT 0x06
 #define INVERT_PIXEL_COLOR 0x08
 
-// Special address for terminating incremental write
-#define END_STRING 0xff
-
 #define MAX7456ADD_READ         0x80
 #define MAX7456ADD_VM0          0x00  //0b0011100// 00 // 00             ,0011100
 #define MAX7456ADD_VM1          0x01
 #define MAX7456ADD_HOS          0x02
 #define MAX7456ADD_VOS          0x03
-#define MAX7456ADD_DMM          0x04
-#define MAX7456ADD_DMAH         0x05
-#define MAX7456ADD_DMAL         0x06
-#define MAX7456ADD_DMDI         0x07
-#define MAX7456ADD_CMM          0x08
-#define MAX7456ADD_CMAH         0x09
-#define MAX7456ADD_CMAL         0x0a
-#define MAX7456ADD_CMDI         0x0b
 #define MAX7456ADD_OSDM         0x0c
 #define MAX7456ADD_RB0          0x10
 #define MAX7456ADD_RB1          0x11
@@ -160,10 +156,6 @@
 #define MAX7456ADD_RB14         0x1e
 #define MAX7456ADD_RB15         0x1f
 #define MAX7456ADD_OSDBL        0x6c
-#define MAX7456ADD_STAT         0xA0
-
-#define NVM_RAM_SIZE            54
-#define WRITE_NVR               0xA0
 
 // Device type
 #define MAX7456_DEVICE_TYPE_MAX 0
@@ -202,7 +194,8 @@ static uint8_t shadowBuffer[VIDEO_BUFFER_CHARS_PAL];
 volatile bool dmaTransactionInProgress = false;
 #endif
 
-static uint8_t spiBuff[MAX_CHARS2UPDATE*6];
+static uint8_t spiBuff[MAX_CHARS2UPDATE * MAX7456_TRANSFER_BYTES_PER_CELL];
+STATIC_ASSERT(sizeof(spiBuff) >= MAX7456_FONT_WRITE_BYTES, max7456_spiBuff_too_small_for_a_glyph);
 
 static uint8_t  videoSignalCfg;
 static uint8_t  videoSignalReg  = OSD_ENABLE; // OSD_ENABLE required to trigger first ReInit
@@ -212,8 +205,11 @@ static uint8_t  hosRegValue; // HOS (Horizontal offset register) value
 static uint8_t  vosRegValue; // VOS (Vertical offset register) value
 
 static bool fontIsLoading       = false;
+static max7456FontQueue_t fontQueue;
+static timeMs_t fontLastWriteMs;
 
 static uint8_t max7456DeviceType;
+static bool max7456DeviceDetected = false;
 
 // previous states initialized outside the valid range to force update on first call
 #define INVALID_PREVIOUS_REGISTER_STATE 255
@@ -477,6 +473,8 @@ bool max7456Init(const max7456Config_t *max7456Config, const vcdProfile_t *pVcdP
 
     __spiBusTransactionEnd(busdev);
 
+    max7456DeviceDetected = true;
+
 #if defined(USE_OVERCLOCK)
     // Determine SPI clock divisor based on config and the device type.
 
@@ -679,22 +677,25 @@ void max7456DrawScreen(void)
 
         max7456ReInitIfRequired(false);
 
-        int buff_len = 0;
-        for (int k = 0; k < MAX_CHARS2UPDATE; k++) {
-            if (screenBuffer[pos] != shadowBuffer[pos]) {
-                spiBuff[buff_len++] = MAX7456ADD_DMAH;
-                spiBuff[buff_len++] = pos >> 8;
-                spiBuff[buff_len++] = MAX7456ADD_DMAL;
-                spiBuff[buff_len++] = pos & 0xff;
-                spiBuff[buff_len++] = MAX7456ADD_DMDI;
-                spiBuff[buff_len++] = screenBuffer[pos];
-                shadowBuffer[pos] = screenBuffer[pos];
-            }
-
-            if (++pos >= maxScreenSize) {
-                pos = 0;
-                break;
-            }
+        static int frameBytes;
+        static int frameChangedCells;
+
+        const int end = MIN(pos + MAX_CHARS2UPDATE, maxScreenSize);
+        int changedCells;
+        const int buff_len = max7456PlanTransfer(spiBuff, screenBuffer, shadowBuffer, pos, end, displayMemoryModeReg, &changedCells);
+
+        frameBytes += buff_len;
+        frameChangedCells += changedCells;
+        DEBUG_SET(DEBUG_MAX7456_TRANSFER, 2, buff_len);
+
+        pos = end;
+        if (pos >= maxScreenSize) {
+            pos = 0;
+            DEBUG_SET(DEBUG_MAX7456_TRANSFER, 0, frameBytes);
+            DEBUG_SET(DEBUG_MAX7456_TRANSFER, 1, frameChangedCells * MAX7456_TRANSFER_BYTES_PER_CELL);
+            DEBUG_SET(DEBUG_MAX7456_TRANSFER, 3, frameChangedCells);
+            frameBytes = 0;
+            frameChangedCells = 0;
         }
 
         if (buff_len) {
@@ -761,38 +762,98 @@ void max7456RefreshAll(void)
     max7456DrawScreenSlow();
 }
 
-void max7456WriteNvm(uint8_t char_address, const uint8_t *font_data)
+/*
+ * Queues a glyph to be programmed into NVM by max7456FontUploadProcess, and enables its task. Returns false if there
+ * is no MAX7456, the queue is full or the address is beyond the device's character memory.
+ */
+bool max7456QueueNvm(uint16_t char_address, const uint8_t *font_data)
 {
-#ifdef MAX7456_DMA_CHANNEL_TX
-    while (dmaTransactionInProgress);
-#endif
+    const uint16_t charCount = (max7456DeviceType == MAX7456_DEVICE_TYPE_AT) ? 512 : 256;
+    if (!max7456DeviceDetected || char_address >= charCount) {
+        return false;
+    }
+    if (!max7456FontQueueAdd(&fontQueue, char_address, font_data)) {
+        return false;
+    }
+    setTaskEnabled(TASK_MAX7456_FONT, true);
+    return true;
+}
 
-    __spiBusTransactionBegin(busdev);
-    // disable display
-    fontIsLoading = true;
-    max7456Send(MAX7456ADD_VM0, 0);
+const max7456FontQueue_t *max7456GetFontQueue(void)
+{
+    return &fontQueue;
+}
+
+// Blocks until the glyph is queued, for callers that can't retry
+void max7456WriteNvm(uint8_t char_address, const uint8_t *font_data)
+{
+    if (!max7456DeviceDetected) {
+        return;
+    }
+    while (!max7456QueueNvm(char_address, font_data)) {
+        max7456FontUploadProcess(micros());
+    }
+}
 
-    max7456Send(MAX7456ADD_CMAH, char_address); // set start address high
+/*
+ * Programs the queued glyphs, a glyph at a time, polling the STAT register until each is done rather than waiting
+ * for it. The display is disabled while the font is changing. The task disables itself once the display is back.
+ */
+void max7456FontUploadProcess(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
 
-    for (int x = 0; x < 54; x++) {
-        max7456Send(MAX7456ADD_CMAL, x); //set start address low
-        max7456Send(MAX7456ADD_CMDI, font_data[x]);
-#ifdef LED0_TOGGLE
-        LED0_TOGGLE;
-#else
-        LED1_TOGGLE;
-#endif
+    if (max7456DmaInProgress()) {
+        return;
     }
 
-    // Transfer 54 bytes from shadow ram to NVM
+    if (fontQueue.nvmBusy) {
+        __spiBusTransactionBegin(busdev);
+        const uint8_t stat = max7456Send(MAX7456ADD_STAT, 0x00);
+        __spiBusTransactionEnd(busdev);
 
-    max7456Send(MAX7456ADD_CMM, WRITE_NVR);
+        max7456FontNvmStatus(&fontQueue, stat);
+        if (fontQueue.nvmBusy) {
+            return;
+        }
+    }
 
-    // Wait until bit 5 in the status register returns to 0 (12ms)
+    const timeMs_t nowMs = millis();
+
+    if (max7456FontQueueIdle(&fontQueue)) {
+        if (fontIsLoading && cmp32(nowMs, fontLastWriteMs) > MAX7456_FONT_DONE_MS) {
+            fontIsLoading = false;
+            max7456ReInit();
+        }
+        if (!fontIsLoading) {
+            setTaskEnabled(TASK_MAX7456_FONT, false);
+        }
+        return;
+    }
 
-    while ((max7456Send(MAX7456ADD_STAT, 0x00) & STAT_NVR_BUSY) != 0x00);
+    if (!fontIsLoading) {
+        fontIsLoading = true;
+        __spiBusTransactionBegin(busdev);
+        // disable display
+        max7456Send(MAX7456ADD_VM0, 0);
+        __spiBusTransactionEnd(busdev);
+    }
 
+    const int buff_len = max7456FontPlanWrite(&fontQueue, spiBuff);
+    fontLastWriteMs = nowMs;
+#ifdef MAX7456_DMA_CHANNEL_TX
+    max7456SendDma(spiBuff, NULL, buff_len);
+#else
+    __spiBusTransactionBegin(busdev);
+    spiTransfer(busdev->busdev_u.spi.instance, spiBuff, NULL, buff_len);
     __spiBusTransactionEnd(busdev);
+#endif
+
+#ifdef LED0_TOGGLE
+    LED0_TOGGLE;
+#else
+    LED1_TOGGLE;
+#endif
 }
 
 #ifdef MAX7456_NRST_PIN
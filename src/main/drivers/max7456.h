@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "common/time.h"
+
 /** PAL or NTSC, value is number of chars total */
 #define VIDEO_BUFFER_CHARS_NTSC   390
 #define VIDEO_BUFFER_CHARS_PAL    480
@@ -37,6 +39,10 @@ void    max7456Invert(bool invert);
 void    max7456Brightness(uint8_t black, uint8_t white);
 void    max7456DrawScreen(void);
 void    max7456WriteNvm(uint8_t char_address, const uint8_t *font_data);
+bool    max7456QueueNvm(uint16_t char_address, const uint8_t *font_data);
+struct max7456FontQueue_s;
+const struct max7456FontQueue_s *max7456GetFontQueue(void);
+void    max7456FontUploadProcess(timeUs_t currentTimeUs);
 uint8_t max7456GetRowsCount(void);
 void    max7456Write(uint8_t x, uint8_t y, const char *buff);
 void    max7456WriteChar(uint8_t x, uint8_t y, uint8_t c);
@@ -0,0 +1,114 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_MAX7456
+
+#include "drivers/max7456_font.h"
+
+/*
+ * Glyphs are programmed one at a time: each of the 54 bytes goes into the shadow RAM with CMAL and CMDI, then CMM
+ * copies it into NVM, which takes about 12ms. Rather than waiting for that, the glyphs are queued and the driver
+ * sends the next one once the STAT register shows the last one is done.
+ */
+
+void max7456FontQueueInit(max7456FontQueue_t *queue)
+{
+    memset(queue, 0, sizeof(*queue));
+}
+
+/*
+ * Queues a glyph to be programmed. Returns false if the queue is full.
+ */
+bool max7456FontQueueAdd(max7456FontQueue_t *queue, uint16_t address, const uint8_t *data)
+{
+    if (queue->count >= MAX7456_FONT_QUEUE_LENGTH) {
+        return false;
+    }
+
+    const int slot = (queue->head + queue->count) % MAX7456_FONT_QUEUE_LENGTH;
+    queue->address[slot] = address;
+    memcpy(queue->data[slot], data, NVM_RAM_SIZE);
+    queue->count++;
+    queue->accepted++;
+
+    return true;
+}
+
+int max7456FontQueueFree(const max7456FontQueue_t *queue)
+{
+    return MAX7456_FONT_QUEUE_LENGTH - queue->count;
+}
+
+bool max7456FontQueueIdle(const max7456FontQueue_t *queue)
+{
+    return queue->count == 0 && !queue->nvmBusy;
+}
+
+/*
+ * Writes the SPI bytes to buff, which must have room for MAX7456_FONT_WRITE_BYTES, that program the next queued glyph,
+ * unless the last one is still being programmed. Returns the number of bytes.
+ */
+int max7456FontPlanWrite(max7456FontQueue_t *queue, uint8_t *buff)
+{
+    if (queue->nvmBusy || queue->count == 0) {
+        return 0;
+    }
+
+    const uint16_t address = queue->address[queue->head];
+    const uint8_t *data = queue->data[queue->head];
+    const uint8_t cmal = (address & 0x100) ? MAX7456_CMAL_CA8 : 0;
+    int length = 0;
+
+    buff[length++] = MAX7456ADD_CMAH;
+    buff[length++] = address & 0xff;
+    for (int i = 0; i < NVM_RAM_SIZE; i++) {
+        buff[length++] = MAX7456ADD_CMAL;
+        buff[length++] = cmal | i;
+        buff[length++] = MAX7456ADD_CMDI;
+        buff[length++] = data[i];
+    }
+    buff[length++] = MAX7456ADD_CMM;
+    buff[length++] = WRITE_NVR;
+
+    queue->head = (queue->head + 1) % MAX7456_FONT_QUEUE_LENGTH;
+    queue->count--;
+    queue->nvmBusy = true;
+
+    return length;
+}
+
+/*
+ * Call with the STAT register while a glyph is being programmed.
+ */
+void max7456FontNvmStatus(max7456FontQueue_t *queue, uint8_t stat)
+{
+    if (queue->nvmBusy && !(stat & STAT_NVR_BUSY)) {
+        queue->nvmBusy = false;
+        queue->written++;
+    }
+}
+
+#endif // USE_MAX7456
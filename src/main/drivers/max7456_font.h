@@ -0,0 +1,62 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Character memory registers
+#define MAX7456ADD_CMM          0x08
+#define MAX7456ADD_CMAH         0x09
+#define MAX7456ADD_CMAL         0x0a
+#define MAX7456ADD_CMDI         0x0b
+#define MAX7456ADD_STAT         0xA0
+
+#define WRITE_NVR               0xA0
+#define STAT_NVR_BUSY           0x20
+
+#define NVM_RAM_SIZE            54
+
+// CMAL bit holding the 9th bit of the character address, AT7456E only
+#define MAX7456_CMAL_CA8        (1 << 6)
+
+// Glyphs that can be waiting to be programmed
+#define MAX7456_FONT_QUEUE_LENGTH   8
+
+// SPI bytes to write a glyph: CMAH, CMAL and CMDI for each byte, and CMM
+#define MAX7456_FONT_WRITE_BYTES    ((2 + NVM_RAM_SIZE * 2) * 2)
+
+typedef struct max7456FontQueue_s {
+    uint8_t data[MAX7456_FONT_QUEUE_LENGTH][NVM_RAM_SIZE];
+    uint16_t address[MAX7456_FONT_QUEUE_LENGTH];
+    uint8_t head;
+    uint8_t count;
+    bool nvmBusy;       // a glyph is being programmed
+    uint16_t accepted;  // glyphs queued since power on
+    uint16_t written;   // glyphs programmed since power on
+} max7456FontQueue_t;
+
+void max7456FontQueueInit(max7456FontQueue_t *queue);
+bool max7456FontQueueAdd(max7456FontQueue_t *queue, uint16_t address, const uint8_t *data);
+int max7456FontQueueFree(const max7456FontQueue_t *queue);
+bool max7456FontQueueIdle(const max7456FontQueue_t *queue);
+int max7456FontPlanWrite(max7456FontQueue_t *queue, uint8_t *buff);
+void max7456FontNvmStatus(max7456FontQueue_t *queue, uint8_t stat);
@@ -0,0 +1,119 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_MAX7456
+
+#include "drivers/max7456_transfer.h"
+
+/*
+ * Each changed cell can be written by addressing it, with DMAH (only when it changes), DMAL and DMDI, or runs of
+ * them in a burst, using auto-increment mode: DMAH, DMAL, DMM to enter it, DMDI for each cell and DMDI with the 0xFF
+ * escape character and DMM to leave it. Each register write is two SPI bytes. A burst can carry a few unchanged cells
+ * to keep going, but 0xFF can't be written in one, as it would end it.
+ */
+#define MAX7456_ADDRESSED_COST      4   // DMAL and DMDI
+#define MAX7456_BURST_OVERHEAD      8   // DMAL, DMM, DMDI 0xFF and DMM
+#define MAX7456_BURST_CELL_COST     2
+#define MAX7456_BURST_MAX_GAP       3   // unchanged cells that are cheaper to send again than to start another burst
+
+typedef struct max7456Plan_s {
+    uint8_t *buff;
+    int length;
+    int dmah;   // as last written, -1 if unknown
+} max7456Plan_t;
+
+static void max7456PlanRegister(max7456Plan_t *plan, uint8_t reg, uint8_t value)
+{
+    plan->buff[plan->length++] = reg;
+    plan->buff[plan->length++] = value;
+}
+
+static void max7456PlanAddress(max7456Plan_t *plan, int pos)
+{
+    if (plan->dmah != pos >> 8) {
+        plan->dmah = pos >> 8;
+        max7456PlanRegister(plan, MAX7456ADD_DMAH, pos >> 8);
+    }
+    max7456PlanRegister(plan, MAX7456ADD_DMAL, pos & 0xff);
+}
+
+/*
+ * Writes the SPI bytes to buff that update the cells from start to end (exclusive) where screen differs from shadow,
+ * which is what the display memory holds, and updates shadow. buff must have room for
+ * MAX7456_TRANSFER_BYTES_PER_CELL bytes per cell. Returns the number of bytes.
+ */
+int max7456PlanTransfer(uint8_t *buff, const uint8_t *screen, uint8_t *shadow, int start, int end, uint8_t dmm, int *changedCells)
+{
+    max7456Plan_t plan = { .buff = buff, .length = 0, .dmah = -1 };
+    int changed = 0;
+
+    int pos = start;
+    while (pos < end) {
+        if (screen[pos] == shadow[pos]) {
+            pos++;
+            continue;
+        }
+
+        // Find the run of cells a burst starting here could cover
+        int runEnd = pos + 1;
+        int runChanged = 1;
+        if (screen[pos] != END_STRING) {
+            for (int i = pos + 1; i < end && i - runEnd <= MAX7456_BURST_MAX_GAP && screen[i] != END_STRING; i++) {
+                if (screen[i] != shadow[i]) {
+                    runEnd = i + 1;
+                    runChanged++;
+                }
+            }
+        }
+        changed += runChanged;
+
+        if (MAX7456_BURST_OVERHEAD + MAX7456_BURST_CELL_COST * (runEnd - pos) < MAX7456_ADDRESSED_COST * runChanged) {
+            max7456PlanAddress(&plan, pos);
+            max7456PlanRegister(&plan, MAX7456ADD_DMM, dmm | MAX7456_DMM_AUTO_INCREMENT);
+            for (int i = pos; i < runEnd; i++) {
+                max7456PlanRegister(&plan, MAX7456ADD_DMDI, screen[i]);
+                shadow[i] = screen[i];
+            }
+            max7456PlanRegister(&plan, MAX7456ADD_DMDI, END_STRING);
+            max7456PlanRegister(&plan, MAX7456ADD_DMM, dmm);
+        } else {
+            for (int i = pos; i < runEnd; i++) {
+                if (screen[i] != shadow[i]) {
+                    max7456PlanAddress(&plan, i);
+                    max7456PlanRegister(&plan, MAX7456ADD_DMDI, screen[i]);
+                    shadow[i] = screen[i];
+                }
+            }
+        }
+        pos = runEnd;
+    }
+
+    if (changedCells) {
+        *changedCells = changed;
+    }
+    return plan.length;
+}
+
+#endif // USE_MAX7456
@@ -126,13 +126,22 @@ void sdcard_init(const sdcardConfig_t *config)
     case SDCARD_MODE_SDIO:
         sdcardVTable = &sdcardSdioVTable;
         break;
+#endif
+#ifdef USE_SDCARD_SIM
+    case SDCARD_MODE_SIM:
+        sdcardVTable = &sdcardSimVTable;
+        break;
 #endif
     default:
         break;
     }
 
     if (sdcardVTable) {
+#ifdef USE_SPI
         sdcardVTable->sdcard_init(config, spiPinConfig(0));
+#else
+        sdcardVTable->sdcard_init(config, NULL);
+#endif
     }
 }
 
@@ -130,3 +130,6 @@ extern sdcardVTable_t sdcardSpiVTable;
 #ifdef USE_SDCARD_SDIO
 extern sdcardVTable_t sdcardSdioVTable;
 #endif
+#ifdef USE_SDCARD_SIM
+extern sdcardVTable_t sdcardSimVTable;
+#endif
@@ -0,0 +1,427 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_SDCARD_SIM
+
+#include "common/time.h"
+#include "common/utils.h"
+
+#include "drivers/time.h"
+
+#include "io/asyncfatfs/fat_standard.h"
+
+#include "pg/bus_spi.h"
+
+#include "sdcard.h"
+#include "sdcard_impl.h"
+#include "sdcard_sim.h"
+
+#ifndef SDCARD_SIM_FILENAME
+#define SDCARD_SIM_FILENAME                 "sdcard.img"
+#endif
+
+// Roughly what a cheap class 4 card manages over SPI
+#ifndef SDCARD_SIM_READ_LATENCY_US
+#define SDCARD_SIM_READ_LATENCY_US          400
+#endif
+#ifndef SDCARD_SIM_WRITE_LATENCY_US
+#define SDCARD_SIM_WRITE_LATENCY_US         1000
+#endif
+#ifndef SDCARD_SIM_MULTI_WRITE_LATENCY_US
+#define SDCARD_SIM_MULTI_WRITE_LATENCY_US   300
+#endif
+#ifndef SDCARD_SIM_STALL_INTERVAL
+#define SDCARD_SIM_STALL_INTERVAL           0
+#endif
+#ifndef SDCARD_SIM_STALL_DURATION_US
+#define SDCARD_SIM_STALL_DURATION_US        100000
+#endif
+
+#define SDCARD_SIM_BLOCK_SIZE               512
+#define MBR_PARTITION_TABLE_OFFSET          446
+
+typedef enum {
+    SDCARD_SIM_STATE_NOT_PRESENT = 0,
+    SDCARD_SIM_STATE_READY,
+    SDCARD_SIM_STATE_READING,
+    SDCARD_SIM_STATE_WRITING
+} sdcardSimState_e;
+
+static sdcardSimConfig_t sdcardSimConfig = {
+    .filename = SDCARD_SIM_FILENAME,
+    .readLatencyUs = SDCARD_SIM_READ_LATENCY_US,
+    .writeLatencyUs = SDCARD_SIM_WRITE_LATENCY_US,
+    .multiWriteLatencyUs = SDCARD_SIM_MULTI_WRITE_LATENCY_US,
+    .stallInterval = SDCARD_SIM_STALL_INTERVAL,
+    .stallDurationUs = SDCARD_SIM_STALL_DURATION_US,
+    .seed = 1,
+};
+
+static struct {
+    FILE *image;
+    sdcardSimState_e state;
+
+    // When the image is a bare volume, it is presented at this block behind a synthetic MBR
+    uint32_t imageStartBlock;
+    uint8_t mbr[SDCARD_SIM_BLOCK_SIZE];
+
+    struct {
+        uint8_t *buffer;
+        uint32_t blockIndex;
+        sdcard_operationCompleteCallback_c callback;
+        uint32_t callbackData;
+        bool failed;
+    } pendingOperation;
+
+    timeUs_t operationStartTime;
+    timeUs_t operationCompleteTime;
+
+    uint32_t multiWriteNextBlock;
+    uint32_t multiWriteBlocksRemain;
+
+    uint32_t randomState;
+
+    sdcardMetadata_t metadata;
+    sdcardSimStats_t stats;
+
+#ifdef SDCARD_PROFILING
+    sdcard_profilerCallback_c profiler;
+#endif
+} sdcardSim;
+
+void sdcardSim_setConfig(const sdcardSimConfig_t *config)
+{
+    sdcardSimConfig = *config;
+}
+
+const sdcardSimConfig_t *sdcardSim_getConfig(void)
+{
+    return &sdcardSimConfig;
+}
+
+const sdcardSimStats_t *sdcardSim_getStats(void)
+{
+    return &sdcardSim.stats;
+}
+
+void sdcardSim_resetStats(void)
+{
+    memset(&sdcardSim.stats, 0, sizeof(sdcardSim.stats));
+}
+
+void sdcardSim_close(void)
+{
+    if (sdcardSim.image) {
+        fclose(sdcardSim.image);
+    }
+    memset(&sdcardSim, 0, sizeof(sdcardSim));
+}
+
+// xorshift32, deterministic for a given seed so that benchmark runs can be compared
+static uint32_t sdcardSim_random(void)
+{
+    uint32_t x = sdcardSim.randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sdcardSim.randomState = x;
+    return x;
+}
+
+static bool sdcardSim_isFatVolume(const uint8_t *sector)
+{
+    const fatVolumeID_t *volume = (const fatVolumeID_t *)sector;
+
+    return (volume->jmpBoot[0] == 0xEB || volume->jmpBoot[0] == 0xE9)
+        && volume->bytesPerSector == SDCARD_SIM_BLOCK_SIZE
+        && volume->sectorsPerCluster != 0
+        && (volume->sectorsPerCluster & (volume->sectorsPerCluster - 1)) == 0
+        && volume->numFATs != 0
+        && sector[510] == FAT_VOLUME_ID_SIGNATURE_1 && sector[511] == FAT_VOLUME_ID_SIGNATURE_2;
+}
+
+static void sdcardSim_buildMbr(const uint8_t *volumeSector, uint32_t volumeBlocks)
+{
+    const fatVolumeID_t *volume = (const fatVolumeID_t *)volumeSector;
+    mbrPartitionEntry_t partition;
+
+    memset(sdcardSim.mbr, 0, sizeof(sdcardSim.mbr));
+    memset(&partition, 0, sizeof(partition));
+
+    // FAT32 volumes have no 16-bit FAT size
+    partition.type = volume->FATSize16 == 0 ? MBR_PARTITION_TYPE_FAT32_LBA : MBR_PARTITION_TYPE_FAT16_LBA;
+    partition.lbaBegin = sdcardSim.imageStartBlock;
+    partition.numSectors = volumeBlocks;
+
+    memcpy(sdcardSim.mbr + MBR_PARTITION_TABLE_OFFSET, &partition, sizeof(partition));
+    sdcardSim.mbr[510] = 0x55;
+    sdcardSim.mbr[511] = 0xAA;
+}
+
+static bool sdcardSim_openImage(void)
+{
+    uint8_t sector[SDCARD_SIM_BLOCK_SIZE];
+
+    sdcardSim.image = fopen(sdcardSimConfig.filename, "r+b");
+    if (!sdcardSim.image) {
+        fprintf(stderr, "[SDCARD] cannot open image '%s'\n", sdcardSimConfig.filename);
+        return false;
+    }
+
+    fseek(sdcardSim.image, 0, SEEK_END);
+    const uint32_t imageBlocks = ftell(sdcardSim.image) / SDCARD_SIM_BLOCK_SIZE;
+    rewind(sdcardSim.image);
+
+    if (imageBlocks == 0 || fread(sector, SDCARD_SIM_BLOCK_SIZE, 1, sdcardSim.image) != 1) {
+        fprintf(stderr, "[SDCARD] image '%s' is empty\n", sdcardSimConfig.filename);
+        fclose(sdcardSim.image);
+        sdcardSim.image = NULL;
+        return false;
+    }
+
+    if (sdcardSim_isFatVolume(sector)) {
+        sdcardSim.imageStartBlock = SDCARD_SIM_PARTITION_START_BLOCK;
+        sdcardSim_buildMbr(sector, imageBlocks);
+    } else {
+        sdcardSim.imageStartBlock = 0;
+    }
+
+    sdcardSim.metadata.numBlocks = sdcardSim.imageStartBlock + imageBlocks;
+    strcpy(sdcardSim.metadata.productName, "SIM");
+    sdcardSim.metadata.productRevisionMajor = 1;
+
+    printf("[SDCARD] loaded '%s', %u blocks%s\n", sdcardSimConfig.filename, imageBlocks,
+        sdcardSim.imageStartBlock ? " (bare volume)" : "");
+
+    return true;
+}
+
+static void sdcardSimPreInit(const sdcardConfig_t *config)
+{
+    UNUSED(config);
+}
+
+static void sdcardSimInit(const sdcardConfig_t *config, const spiPinConfig_t *spiConfig)
+{
+    UNUSED(config);
+    UNUSED(spiConfig);
+
+    sdcardSim_close();
+
+    sdcardSim.randomState = sdcardSimConfig.seed ? sdcardSimConfig.seed : 1;
+
+    if (sdcardSim_openImage()) {
+        sdcardSim.state = SDCARD_SIM_STATE_READY;
+    }
+}
+
+/**
+ * Transfer a block between the caller's buffer and the image. Blocks in front of a bare volume read as the synthetic
+ * MBR followed by zeroes, and may not be written.
+ */
+static bool sdcardSim_transferBlock(uint32_t blockIndex, uint8_t *buffer, bool write)
+{
+    if (blockIndex >= sdcardSim.metadata.numBlocks) {
+        return false;
+    }
+
+    if (blockIndex < sdcardSim.imageStartBlock) {
+        if (write) {
+            return false;
+        }
+        if (blockIndex == 0) {
+            memcpy(buffer, sdcardSim.mbr, SDCARD_SIM_BLOCK_SIZE);
+        } else {
+            memset(buffer, 0, SDCARD_SIM_BLOCK_SIZE);
+        }
+        return true;
+    }
+
+    const long offset = (long)(blockIndex - sdcardSim.imageStartBlock) * SDCARD_SIM_BLOCK_SIZE;
+
+    if (fseek(sdcardSim.image, offset, SEEK_SET) != 0) {
+        return false;
+    }
+
+    if (write) {
+        return fwrite(buffer, SDCARD_SIM_BLOCK_SIZE, 1, sdcardSim.image) == 1;
+    } else {
+        return fread(buffer, SDCARD_SIM_BLOCK_SIZE, 1, sdcardSim.image) == 1;
+    }
+}
+
+static void sdcardSim_startOperation(sdcardSimState_e state, uint32_t blockIndex, uint8_t *buffer,
+    sdcard_operationCompleteCallback_c callback, uint32_t callbackData, uint32_t latencyUs)
+{
+    sdcardSim.state = state;
+    sdcardSim.pendingOperation.buffer = buffer;
+    sdcardSim.pendingOperation.blockIndex = blockIndex;
+    sdcardSim.pendingOperation.callback = callback;
+    sdcardSim.pendingOperation.callbackData = callbackData;
+
+    sdcardSim.operationStartTime = micros();
+    sdcardSim.operationCompleteTime = sdcardSim.operationStartTime + latencyUs;
+    sdcardSim.stats.busyTimeUs += latencyUs;
+}
+
+/**
+ * Call periodically to complete in-progress transfers once their simulated latency has elapsed.
+ *
+ * Returns true if the card is ready to accept commands.
+ */
+static bool sdcardSimPoll(void)
+{
+    if (sdcardSim.state != SDCARD_SIM_STATE_READING && sdcardSim.state != SDCARD_SIM_STATE_WRITING) {
+        return sdcardSim.state == SDCARD_SIM_STATE_READY;
+    }
+
+    const timeUs_t now = micros();
+    if (cmpTimeUs(now, sdcardSim.operationCompleteTime) < 0) {
+        return false;
+    }
+
+    const sdcardBlockOperation_e operation = sdcardSim.state == SDCARD_SIM_STATE_READING ? SDCARD_BLOCK_OPERATION_READ : SDCARD_BLOCK_OPERATION_WRITE;
+    uint8_t *buffer = sdcardSim.pendingOperation.failed ? NULL : sdcardSim.pendingOperation.buffer;
+
+    sdcardSim.state = SDCARD_SIM_STATE_READY;
+
+#ifdef SDCARD_PROFILING
+    if (sdcardSim.profiler) {
+        sdcardSim.profiler(operation, sdcardSim.pendingOperation.blockIndex, now - sdcardSim.operationStartTime);
+    }
+#endif
+
+    if (sdcardSim.pendingOperation.callback) {
+        sdcardSim.pendingOperation.callback(operation, sdcardSim.pendingOperation.blockIndex, buffer, sdcardSim.pendingOperation.callbackData);
+    }
+
+    return sdcardSim.state == SDCARD_SIM_STATE_READY;
+}
+
+static bool sdcardSimReadBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (sdcardSim.state != SDCARD_SIM_STATE_READY) {
+        sdcardSim.stats.busyRejects++;
+        return false;
+    }
+
+    // A read aborts any multi-block write in progress
+    sdcardSim.multiWriteBlocksRemain = 0;
+
+    sdcardSim.pendingOperation.failed = !sdcardSim_transferBlock(blockIndex, buffer, false);
+    sdcardSim.stats.blocksRead++;
+
+    sdcardSim_startOperation(SDCARD_SIM_STATE_READING, blockIndex, buffer, callback, callbackData, sdcardSimConfig.readLatencyUs);
+
+    return true;
+}
+
+static sdcardOperationStatus_e sdcardSimBeginWriteBlocks(uint32_t blockIndex, uint32_t blockCount)
+{
+    if (sdcardSim.state != SDCARD_SIM_STATE_READY) {
+        sdcardSim.stats.busyRejects++;
+        return sdcardSim.state == SDCARD_SIM_STATE_NOT_PRESENT ? SDCARD_OPERATION_FAILURE : SDCARD_OPERATION_BUSY;
+    }
+
+    sdcardSim.multiWriteNextBlock = blockIndex;
+    sdcardSim.multiWriteBlocksRemain = blockCount;
+
+    return SDCARD_OPERATION_SUCCESS;
+}
+
+static sdcardOperationStatus_e sdcardSimWriteBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (sdcardSim.state != SDCARD_SIM_STATE_READY) {
+        sdcardSim.stats.busyRejects++;
+        return sdcardSim.state == SDCARD_SIM_STATE_NOT_PRESENT ? SDCARD_OPERATION_FAILURE : SDCARD_OPERATION_BUSY;
+    }
+
+    uint32_t latencyUs;
+
+    if (sdcardSim.multiWriteBlocksRemain > 0 && blockIndex == sdcardSim.multiWriteNextBlock) {
+        sdcardSim.multiWriteNextBlock++;
+        sdcardSim.multiWriteBlocksRemain--;
+        latencyUs = sdcardSimConfig.multiWriteLatencyUs;
+    } else {
+        sdcardSim.multiWriteBlocksRemain = 0;
+        latencyUs = sdcardSimConfig.writeLatencyUs;
+    }
+
+    // Cheap cards occasionally go away for a long time to do their internal housekeeping
+    if (sdcardSimConfig.stallInterval && sdcardSim_random() % sdcardSimConfig.stallInterval == 0) {
+        latencyUs += sdcardSimConfig.stallDurationUs;
+        sdcardSim.stats.writeStalls++;
+    }
+
+    sdcardSim.pendingOperation.failed = !sdcardSim_transferBlock(blockIndex, buffer, true);
+    sdcardSim.stats.blocksWritten++;
+
+    sdcardSim_startOperation(SDCARD_SIM_STATE_WRITING, blockIndex, buffer, callback, callbackData, latencyUs);
+
+    return SDCARD_OPERATION_IN_PROGRESS;
+}
+
+static bool sdcardSimIsFunctional(void)
+{
+    return sdcardSim.state != SDCARD_SIM_STATE_NOT_PRESENT;
+}
+
+static bool sdcardSimIsInitialized(void)
+{
+    return sdcardSim.state >= SDCARD_SIM_STATE_READY;
+}
+
+static const sdcardMetadata_t* sdcardSimGetMetadata(void)
+{
+    return &sdcardSim.metadata;
+}
+
+#ifdef SDCARD_PROFILING
+
+static void sdcardSimSetProfilerCallback(sdcard_profilerCallback_c callback)
+{
+    sdcardSim.profiler = callback;
+}
+
+#endif
+
+sdcardVTable_t sdcardSimVTable = {
+    sdcardSimPreInit,
+    sdcardSimInit,
+    sdcardSimReadBlock,
+    sdcardSimBeginWriteBlocks,
+    sdcardSimWriteBlock,
+    sdcardSimPoll,
+    sdcardSimIsFunctional,
+    sdcardSimIsInitialized,
+    sdcardSimGetMetadata,
+#ifdef SDCARD_PROFILING
+    sdcardSimSetProfilerCallback,
+#endif
+};
+
+#endif
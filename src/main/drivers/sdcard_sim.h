@@ -0,0 +1,59 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * File backed SD card emulator for SITL and unit tests.
+ *
+ * The image may either be a whole card image (with an MBR) or a bare FAT16/FAT32 volume as produced by
+ * mkfs.fat, in which case a synthetic MBR is presented in front of the volume.
+ */
+
+#define SDCARD_SIM_PARTITION_START_BLOCK    8192 // 4MB aligned, as per the SD association formatter
+
+typedef struct sdcardSimConfig_s {
+    const char *filename;
+    uint32_t readLatencyUs;         // per block
+    uint32_t writeLatencyUs;        // per block, single block writes
+    uint32_t multiWriteLatencyUs;   // per block, within a pre-erased multi-block write
+    uint32_t stallInterval;         // average number of block writes between stalls, 0 to disable
+    uint32_t stallDurationUs;       // additional busy time of a stalled write
+    uint32_t seed;                  // stall pattern seed, so that runs are repeatable
+} sdcardSimConfig_t;
+
+typedef struct sdcardSimStats_s {
+    uint32_t blocksRead;
+    uint32_t blocksWritten;
+    uint32_t writeStalls;
+    uint32_t busyRejects;           // operations refused because the card was still busy
+    uint64_t busyTimeUs;            // total simulated time the card spent busy
+} sdcardSimStats_t;
+
+void sdcardSim_setConfig(const sdcardSimConfig_t *config);
+const sdcardSimConfig_t *sdcardSim_getConfig(void);
+
+const sdcardSimStats_t *sdcardSim_getStats(void);
+void sdcardSim_resetStats(void);
+
+void sdcardSim_close(void);
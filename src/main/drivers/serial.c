@@ -123,3 +123,23 @@ void serialEndWrite(serialPort_t *instance)
     if (instance->vTable->endWrite)
         instance->vTable->endWrite(instance);
 }
+
+/*
+ * Returns the contiguous free space at the head of the TX buffer, and its length in *length, so that data can be
+ * written into it directly. Returns NULL if the port doesn't support this, or there is no free space.
+ * Follow with serialCommitTxBuffer() to send what was written.
+ */
+uint8_t *serialReserveTxBuffer(serialPort_t *instance, uint32_t *length)
+{
+    *length = 0;
+    if (!instance->vTable->reserveTxBuffer) {
+        return NULL;
+    }
+    uint8_t *buffer = instance->vTable->reserveTxBuffer(instance, length);
+    return *length ? buffer : NULL;
+}
+
+void serialCommitTxBuffer(serialPort_t *instance, uint32_t length)
+{
+    instance->vTable->commitTxBuffer(instance, length);
+}
@@ -866,7 +866,9 @@ const struct serialPortVTable escSerialVTable[] = {
         .setBaudRateCb = NULL,
         .writeBuf = NULL,
         .beginWrite = NULL,
-        .endWrite = NULL
+        .endWrite = NULL,
+        .reserveTxBuffer = NULL,
+        .commitTxBuffer = NULL,
     }
 };
 
@@ -644,7 +644,9 @@ static const struct serialPortVTable softSerialVTable = {
     .setBaudRateCb = NULL,
     .writeBuf = NULL,
     .beginWrite = NULL,
-    .endWrite = NULL
+    .endWrite = NULL,
+    .reserveTxBuffer = NULL,
+    .commitTxBuffer = NULL,
 };
 
 #endif
@@ -33,6 +33,7 @@
 
 #include "build/build_config.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "io/serial.h"
@@ -220,6 +221,29 @@ void tcpWrite(serialPort_t *instance, uint8_t ch)
     tcpDataOut(s);
 }
 
+static uint8_t *tcpReserveTxBuffer(serialPort_t *instance, uint32_t *length)
+{
+    // Only the free space up to the end of the buffer is contiguous
+    *length = MIN(instance->txBufferSize - instance->txBufferHead, tcpTotalTxBytesFree(instance));
+
+    return (uint8_t *)&instance->txBuffer[instance->txBufferHead];
+}
+
+static void tcpCommitTxBuffer(serialPort_t *instance, uint32_t length)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    pthread_mutex_lock(&s->txLock);
+
+    if (s->port.txBufferHead + length >= s->port.txBufferSize) {
+        s->port.txBufferHead = 0;
+    } else {
+        s->port.txBufferHead += length;
+    }
+    pthread_mutex_unlock(&s->txLock);
+
+    tcpDataOut(s);
+}
+
 void tcpDataOut(tcpPort_t *instance)
 {
     tcpPort_t *s = (tcpPort_t *)instance;
@@ -271,4 +295,6 @@ static const struct serialPortVTable tcpVTable = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .reserveTxBuffer = tcpReserveTxBuffer,
+        .commitTxBuffer = tcpCommitTxBuffer,
 };
@@ -27,6 +27,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 
@@ -34,6 +35,7 @@
 
 #include "build/build_config.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "drivers/dma.h"
@@ -239,18 +241,8 @@ static uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
-static void uartWrite(serialPort_t *instance, uint8_t ch)
+static void uartStartTx(uartPort_t *s)
 {
-    uartPort_t *s = (uartPort_t *)instance;
-
-    s->port.txBuffer[s->port.txBufferHead] = ch;
-
-    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
-        s->port.txBufferHead = 0;
-    } else {
-        s->port.txBufferHead++;
-    }
-
 #ifdef USE_DMA
     if (s->txDMAResource) {
         uartTryStartTxDMA(s);
@@ -265,6 +257,63 @@ static void uartWrite(serialPort_t *instance, uint8_t ch)
     }
 }
 
+static void uartWrite(serialPort_t *instance, uint8_t ch)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    s->port.txBuffer[s->port.txBufferHead] = ch;
+
+    if (s->port.txBufferHead + 1 >= s->port.txBufferSize) {
+        s->port.txBufferHead = 0;
+    } else {
+        s->port.txBufferHead++;
+    }
+
+    uartStartTx(s);
+}
+
+static uint8_t *uartReserveTxBuffer(serialPort_t *instance, uint32_t *length)
+{
+    // Only the free space up to the end of the buffer is contiguous
+    *length = MIN(instance->txBufferSize - instance->txBufferHead, uartTotalTxBytesFree(instance));
+
+    return (uint8_t *)&instance->txBuffer[instance->txBufferHead];
+}
+
+static void uartCommitTxBuffer(serialPort_t *instance, uint32_t length)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    if (s->port.txBufferHead + length >= s->port.txBufferSize) {
+        s->port.txBufferHead = 0;
+    } else {
+        s->port.txBufferHead += length;
+    }
+
+    uartStartTx(s);
+}
+
+static void uartWriteBuf(serialPort_t *instance, const void *data, int count)
+{
+    const uint8_t *p = data;
+
+    while (count > 0) {
+        uint32_t length;
+        uint8_t *buffer = serialReserveTxBuffer(instance, &length);
+        if (!buffer) {
+            // wait for the transmission to make room, as serialWriteBuf() does
+            continue;
+        }
+
+        length = MIN(length, (uint32_t)count);
+        memcpy(buffer, p, length);
+        uartCommitTxBuffer(instance, length);
+
+        p += length;
+        count -= length;
+    }
+}
+
 const struct serialPortVTable uartVTable[] = {
     {
         .serialWrite = uartWrite,
@@ -276,9 +325,11 @@ const struct serialPortVTable uartVTable[] = {
         .setMode = uartSetMode,
         .setCtrlLineStateCb = NULL,
         .setBaudRateCb = NULL,
-        .writeBuf = NULL,
+        .writeBuf = uartWriteBuf,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .reserveTxBuffer = uartReserveTxBuffer,
+        .commitTxBuffer = uartCommitTxBuffer,
     }
 };
 
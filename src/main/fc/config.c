@@ -676,6 +676,20 @@ bool readEEPROM(void)
     return success;
 }
 
+// For a config changed in RAM without going through the CLI or the MSP setters, e.g. by an MSP config delta
+void validateAndActivateConfig(void)
+{
+    suspendRxPwmPpmSignal();
+
+    featureInit();
+
+    validateAndFixConfig();
+
+    activateConfig();
+
+    resumeRxPwmPpmSignal();
+}
+
 void writeUnmodifiedConfigToEEPROM(void)
 {
     validateAndFixConfig();
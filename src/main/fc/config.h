@@ -72,6 +72,7 @@ bool resetEEPROM(bool useCustomDefaults);
 bool readEEPROM(void);
 void writeEEPROM(void);
 void writeUnmodifiedConfigToEEPROM(void);
+void validateAndActivateConfig(void);
 void ensureEEPROMStructureIsValid(void);
 
 void saveConfigAndNotify(void);
@@ -52,6 +52,7 @@
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
 #include "fc/core.h"
+#include "fc/flight_stats.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -565,6 +566,8 @@ void tryArm(void)
         beeper(BEEPER_ARMING);
 #endif
 
+        flightStatsReset();
+
 #ifdef USE_PERSISTENT_STATS
         statsOnArm();
 #endif
@@ -0,0 +1,61 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#include "common/stream_stats.h"
+
+#include "fc/flight_stats.h"
+#include "fc/runtime_config.h"
+
+static streamStats_t flightStats[FLIGHT_STAT_COUNT];
+
+// Percentile estimated for each statistic, and the step it is estimated in
+static const struct {
+    uint8_t percent;
+    uint16_t step;
+} flightStatsPercentile[FLIGHT_STAT_COUNT] = {
+    [FLIGHT_STAT_CURRENT]   = { 95, 1 },
+    [FLIGHT_STAT_VOLTAGE]   = { 5, 1 },
+    [FLIGHT_STAT_ESC_RPM]   = { 95, 5 },
+    [FLIGHT_STAT_GYRO_RATE] = { 95, 1 },
+};
+
+void flightStatsReset(void)
+{
+    for (int i = 0; i < FLIGHT_STAT_COUNT; i++) {
+        streamStatsInit(&flightStats[i], flightStatsPercentile[i].percent, flightStatsPercentile[i].step);
+    }
+}
+
+void flightStatsAdd(flightStat_e stat, int32_t value)
+{
+    if (ARMING_FLAG(ARMED)) {
+        streamStatsAdd(&flightStats[stat], value);
+    }
+}
+
+const streamStats_t *flightStatsGet(flightStat_e stat)
+{
+    return &flightStats[stat];
+}
@@ -0,0 +1,39 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/stream_stats.h"
+
+/*
+ * Statistics of the flight since arming, added to by the tasks that produce the values, so that the OSD, MSP and
+ * blackbox can read them at any time without having to poll or work through a backlog at disarm.
+ */
+typedef enum {
+    FLIGHT_STAT_CURRENT = 0,    // 0.01A, from the battery task
+    FLIGHT_STAT_VOLTAGE,        // 0.01V, from the battery task
+    FLIGHT_STAT_ESC_RPM,        // combined ESC RPM, from the ESC sensor task
+    FLIGHT_STAT_GYRO_RATE,      // fastest axis in deg/s, from the attitude task
+    FLIGHT_STAT_COUNT
+} flightStat_e;
+
+void flightStatsReset(void);
+void flightStatsAdd(flightStat_e stat, int32_t value);
+const streamStats_t *flightStatsGet(flightStat_e stat);
@@ -104,6 +104,7 @@
 #include "io/displayport_max7456.h"
 #include "io/displayport_msp.h"
 #include "io/displayport_srxl.h"
+#include "io/displayport_virtual.h"
 #include "io/flashfs.h"
 #include "io/gimbal.h"
 #include "io/gps.h"
@@ -758,8 +759,6 @@ void init(void)
         switch(device) {
 
         case OSD_DISPLAYPORT_DEVICE_AUTO:
-            FALLTHROUGH;
-
 #if defined(USE_MAX7456)
         case OSD_DISPLAYPORT_DEVICE_MAX7456:
             // If there is a max7456 chip for the OSD configured and detectd then use it.
@@ -779,6 +778,13 @@ void init(void)
             FALLTHROUGH;
 #endif
 
+#if defined(USE_VIRTUAL_DISPLAYPORT)
+        case OSD_DISPLAYPORT_DEVICE_VIRTUAL:
+            // Only on the host, to run and measure the OSD
+            osdDisplayPort = displayPortVirtualInit(VIRTUAL_DISPLAYPORT_MAX_ROWS, VIRTUAL_DISPLAYPORT_MAX_COLS);
+            break;
+#endif
+
         // Other device cases can be added here
 
         case OSD_DISPLAYPORT_DEVICE_NONE:
@@ -30,12 +30,14 @@
 #include "build/debug.h"
 
 #include "common/axis.h"
+#include "common/maths.h"
 
 #include "pg/pg.h"
 #include "pg/pg_ids.h"
 
 #include "drivers/time.h"
 
+#include "fc/flight_stats.h"
 #include "fc/runtime_config.h"
 
 #include "flight/gps_rescue.h"
@@ -489,6 +491,9 @@ static void imuCalculateEstimatedAttitude(timeUs_t currentTimeUs)
     float gyroAverage[XYZ_AXIS_COUNT];
     gyroGetAccumulationAverage(gyroAverage);
 
+    // Rate of the fastest axis, averaged since the last update
+    flightStatsAdd(FLIGHT_STAT_GYRO_RATE, lrintf(MAX(fabsf(gyroAverage[X]), MAX(fabsf(gyroAverage[Y]), fabsf(gyroAverage[Z])))));
+
     if (accGetAccumulationAverage(accAverage)) {
         useAcc = imuIsAccelerometerHealthy(accAverage);
     }
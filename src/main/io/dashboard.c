@@ -75,7 +75,7 @@
 
 #define MICROSECONDS_IN_A_SECOND (1000 * 1000)
 
-#define DISPLAY_UPDATE_FREQUENCY (MICROSECONDS_IN_A_SECOND / 5)
+#define DISPLAY_UPDATE_FREQUENCY (MICROSECONDS_IN_A_SECOND / 10)
 #define PAGE_CYCLE_FREQUENCY (MICROSECONDS_IN_A_SECOND * 5)
 
 static busDevice_t *bus;
@@ -615,6 +615,11 @@ void dashboardUpdate(timeUs_t currentTimeUs)
 {
     static uint8_t previousArmedState = 0;
 
+    // The page, or the CMS menu, is drawn into the framebuffer, which is sent a chunk per call in between
+    if (dashboardPresent) {
+        i2c_OLED_flush(bus);
+    }
+
 #ifdef USE_CMS
     if (displayIsGrabbed(displayPort)) {
         return;
@@ -33,6 +33,7 @@
 #include "pg/pg_ids.h"
 
 #include "drivers/display.h"
+#include "drivers/time.h"
 
 #include "io/displayport_msp.h"
 
@@ -45,6 +46,27 @@ PG_REGISTER(displayPortProfile_t, displayPortProfileMsp, PG_DISPLAY_PORT_MSP_CON
 
 static displayPort_t mspDisplayPort;
 
+/*
+ * The OSD and CMS redraw the whole screen again and again, but on a 115200 baud link there isn't the bandwidth to send
+ * it all. So writes go to a canvas, and drawScreen sends the receiver only the runs of characters that differ from what
+ * it was sent before, as far as the TX buffer allows; anything left over goes with the next drawScreen.
+ *
+ * As the receiver might have missed something, e.g. goggles turned on after the FC, a row is sent in full every
+ * MSP_DISPLAYPORT_ROW_REFRESH_INTERVAL_US as well.
+ */
+#define MSP_DISPLAYPORT_FRAME_OVERHEAD          6       // MSP v1 header and checksum
+#define MSP_DISPLAYPORT_MAX_BATCH_SIZE          128     // payload of an MSP_DP_WRITE_STRINGS frame
+#define MSP_DISPLAYPORT_ROW_REFRESH_INTERVAL_US 100000
+
+static uint8_t canvas[MSP_DISPLAYPORT_MAX_ROWS][MSP_DISPLAYPORT_MAX_COLS];
+static uint8_t sent[MSP_DISPLAYPORT_MAX_ROWS][MSP_DISPLAYPORT_MAX_COLS];
+static bool receiverCleared;
+static uint8_t refreshRow;
+static timeUs_t lastRowRefreshUs;
+
+static uint8_t batchBuf[MSP_DISPLAYPORT_MAX_BATCH_SIZE];
+static int batchLen;
+
 #ifdef USE_CLI
 extern uint8_t cliMode;
 #endif
@@ -64,7 +86,7 @@ static int output(displayPort_t *displayPort, uint8_t cmd, uint8_t *buf, int len
 
 static int heartbeat(displayPort_t *displayPort)
 {
-    uint8_t subcmd[] = { 0 };
+    uint8_t subcmd[] = { MSP_DP_HEARTBEAT };
 
     // heartbeat is used to:
     // a) ensure display is not released by MW OSD software
@@ -79,22 +101,158 @@ static int grab(displayPort_t *displayPort)
 
 static int release(displayPort_t *displayPort)
 {
-    uint8_t subcmd[] = { 1 };
+    uint8_t subcmd[] = { MSP_DP_RELEASE };
+
+    // The receiver goes back to its own display, so start again from a cleared screen
+    receiverCleared = false;
 
     return output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd));
 }
 
 static int clearScreen(displayPort_t *displayPort)
 {
-    uint8_t subcmd[] = { 2 };
+    UNUSED(displayPort);
 
-    return output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd));
+    memset(canvas, ' ', sizeof(canvas));
+
+    return 0;
+}
+
+static int flushBatch(displayPort_t *displayPort)
+{
+    int ret = 0;
+
+    if (batchLen > 1) {
+        ret = output(displayPort, MSP_DISPLAYPORT, batchBuf, batchLen);
+        if (ret) {
+            // Only runs that went out are known to the receiver, the rest are still different next time
+            for (int i = 1; i < batchLen; i += 4 + batchBuf[i + 3]) {
+                memcpy(&sent[batchBuf[i]][batchBuf[i + 1]], &batchBuf[i + 4], batchBuf[i + 3]);
+            }
+        }
+    }
+    batchLen = 0;
+
+    return ret;
+}
+
+// Send a run of characters from the canvas, returns the bytes it took, zero if there was no room for it or it couldn't
+// be sent. A batched run is only marked as sent once its batch has gone out.
+static int sendRun(displayPort_t *displayPort, uint8_t row, uint8_t col, int len, uint32_t room)
+{
+    int cost;
+
+    if (displayPortProfileMsp()->batchWrites) {
+        if (batchLen + 4 + len > MSP_DISPLAYPORT_MAX_BATCH_SIZE && !flushBatch(displayPort)) {
+            return 0;
+        }
+        cost = 4 + len + (batchLen ? 0 : MSP_DISPLAYPORT_FRAME_OVERHEAD + 1);
+        if ((uint32_t)cost > room) {
+            return 0;
+        }
+
+        if (!batchLen) {
+            batchBuf[batchLen++] = MSP_DP_WRITE_STRINGS;
+        }
+        batchBuf[batchLen++] = row;
+        batchBuf[batchLen++] = col;
+        batchBuf[batchLen++] = 0;
+        batchBuf[batchLen++] = len;
+        memcpy(&batchBuf[batchLen], &canvas[row][col], len);
+        batchLen += len;
+    } else {
+        uint8_t buf[MSP_DISPLAYPORT_MAX_COLS + 4];
+
+        cost = MSP_DISPLAYPORT_FRAME_OVERHEAD + 4 + len;
+        if ((uint32_t)cost > room) {
+            return 0;
+        }
+
+        buf[0] = MSP_DP_WRITE_STRING;
+        buf[1] = row;
+        buf[2] = col;
+        buf[3] = 0;
+        memcpy(&buf[4], &canvas[row][col], len);
+        if (!output(displayPort, MSP_DISPLAYPORT, buf, len + 4)) {
+            return 0;
+        }
+
+        memcpy(&sent[row][col], &canvas[row][col], len);
+    }
+
+    return cost;
 }
 
 static int drawScreen(displayPort_t *displayPort)
 {
-    uint8_t subcmd[] = { 4 };
-    return output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd));
+    uint32_t room = mspSerialTxBytesFree();
+    int written = 0;
+
+    if (!receiverCleared) {
+        uint8_t subcmd[] = { MSP_DP_CLEAR_SCREEN };
+        if (!output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd))) {
+            return 0;
+        }
+        memset(sent, ' ', sizeof(sent));
+        receiverCleared = true;
+        written = MSP_DISPLAYPORT_FRAME_OVERHEAD + 1;
+    }
+
+    // Make one row look changed, so that it's sent in full
+    const timeUs_t currentTimeUs = micros();
+    if (cmpTimeUs(currentTimeUs, lastRowRefreshUs) >= MSP_DISPLAYPORT_ROW_REFRESH_INTERVAL_US) {
+        if (++refreshRow >= displayPort->rows) {
+            refreshRow = 0;
+        }
+        for (int col = 0; col < displayPort->cols; col++) {
+            sent[refreshRow][col] = ~canvas[refreshRow][col];
+        }
+        lastRowRefreshUs = currentTimeUs;
+    }
+
+    // Leave room for the draw command
+    room = room > (uint32_t)written + MSP_DISPLAYPORT_FRAME_OVERHEAD + 1 ? room - written - MSP_DISPLAYPORT_FRAME_OVERHEAD - 1 : 0;
+
+    // Unchanged characters between changes are sent again if that's cheaper than starting another write
+    const int maxGap = displayPortProfileMsp()->batchWrites ? 4 : MSP_DISPLAYPORT_FRAME_OVERHEAD + 4;
+    bool full = false;
+
+    for (int row = 0; row < displayPort->rows && !full; row++) {
+        int col = 0;
+        while (col < displayPort->cols) {
+            if (canvas[row][col] == sent[row][col]) {
+                col++;
+                continue;
+            }
+
+            const int start = col;
+            int end = col + 1;
+            for (col = end; col < displayPort->cols && col - end < maxGap; col++) {
+                if (canvas[row][col] != sent[row][col]) {
+                    end = col + 1;
+                }
+            }
+
+            const int cost = sendRun(displayPort, row, start, end - start, room);
+            if (!cost) {
+                // Out of room, the rest goes next time
+                full = true;
+                break;
+            }
+            room -= cost;
+            written += cost;
+            col = end;
+        }
+    }
+
+    flushBatch(displayPort);
+
+    if (written) {
+        uint8_t subcmd[] = { MSP_DP_DRAW_SCREEN };
+        written += output(displayPort, MSP_DISPLAYPORT, subcmd, sizeof(subcmd));
+    }
+
+    return written;
 }
 
 static int screenSize(const displayPort_t *displayPort)
@@ -104,30 +262,24 @@ static int screenSize(const displayPort_t *displayPort)
 
 static int writeString(displayPort_t *displayPort, uint8_t col, uint8_t row, const char *string)
 {
-#define MSP_OSD_MAX_STRING_LENGTH 30 // FIXME move this
-    uint8_t buf[MSP_OSD_MAX_STRING_LENGTH + 4];
-
-    int len = strlen(string);
-    if (len >= MSP_OSD_MAX_STRING_LENGTH) {
-        len = MSP_OSD_MAX_STRING_LENGTH;
+    if (row >= displayPort->rows) {
+        return 0;
     }
 
-    buf[0] = 3;
-    buf[1] = row;
-    buf[2] = col;
-    buf[3] = 0;
-    memcpy(&buf[4], string, len);
+    for (; *string && col < displayPort->cols; string++, col++) {
+        canvas[row][col] = *string;
+    }
 
-    return output(displayPort, MSP_DISPLAYPORT, buf, len + 4);
+    return 0;
 }
 
 static int writeChar(displayPort_t *displayPort, uint8_t col, uint8_t row, uint8_t c)
 {
-    char buf[2];
+    if (row < displayPort->rows && col < displayPort->cols) {
+        canvas[row][col] = c;
+    }
 
-    buf[0] = c;
-    buf[1] = 0;
-    return writeString(displayPort, col, row, buf); //!!TODO - check if there is a direct MSP command to do this
+    return 0;
 }
 
 static bool isTransferInProgress(const displayPort_t *displayPort)
@@ -144,8 +296,9 @@ static bool isSynced(const displayPort_t *displayPort)
 
 static void resync(displayPort_t *displayPort)
 {
-    displayPort->rows = 13 + displayPortProfileMsp()->rowAdjust; // XXX Will reflect NTSC/PAL in the future
-    displayPort->cols = 30 + displayPortProfileMsp()->colAdjust;
+    displayPort->rows = MSP_DISPLAYPORT_MAX_ROWS + displayPortProfileMsp()->rowAdjust; // XXX Will reflect NTSC/PAL in the future
+    displayPort->cols = MSP_DISPLAYPORT_MAX_COLS + displayPortProfileMsp()->colAdjust;
+    receiverCleared = false;
     drawScreen(displayPort);
 }
 
@@ -173,6 +326,7 @@ static const displayPortVTable_t mspDisplayPortVTable = {
 displayPort_t *displayPortMspInit(void)
 {
     displayInit(&mspDisplayPort, &mspDisplayPortVTable);
+    clearScreen(&mspDisplayPort);
     resync(&mspDisplayPort);
     return &mspDisplayPort;
 }
@@ -23,6 +23,27 @@
 #include "pg/pg.h"
 #include "drivers/display.h"
 
+// MSP_DISPLAYPORT subcommands
+typedef enum {
+    MSP_DP_HEARTBEAT = 0,       // keep the display grabbed
+    MSP_DP_RELEASE = 1,         // release the display after clearing and updating
+    MSP_DP_CLEAR_SCREEN = 2,    // clear the display
+    MSP_DP_WRITE_STRING = 3,    // write a string at given coordinates
+    MSP_DP_DRAW_SCREEN = 4,     // trigger a screen draw
+    MSP_DP_WRITE_STRINGS = 5,   // several strings in one frame
+} displayportMspCommand_e;
+
+/*
+ * MSP_DP_WRITE_STRINGS payload, repeated to the end of the frame:
+ *
+ *   row, col, attribute (0), length, length characters
+ *
+ * Only sent when displayport_msp_batch_writes is on, as older receivers only know MSP_DP_WRITE_STRING.
+ */
+
+#define MSP_DISPLAYPORT_MAX_ROWS    13
+#define MSP_DISPLAYPORT_MAX_COLS    30
+
 PG_DECLARE(displayPortProfile_t, displayPortProfileMsp);
 
 struct displayPort_s;
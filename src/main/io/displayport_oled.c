@@ -48,9 +48,10 @@ static int oledClearScreen(displayPort_t *displayPort)
     return 0;
 }
 
+// A chunk at a time, the dashboard task sends the rest
 static int oledDrawScreen(displayPort_t *displayPort)
 {
-    UNUSED(displayPort);
+    i2c_OLED_flush(displayPort->device);
     return 0;
 }
 
@@ -82,7 +83,7 @@ static bool oledIsTransferInProgress(const displayPort_t *displayPort)
 static bool oledIsSynced(const displayPort_t *displayPort)
 {
     UNUSED(displayPort);
-    return true;
+    return i2c_OLED_is_synced();
 }
 
 static int oledHeartbeat(displayPort_t *displayPort)
@@ -0,0 +1,283 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_VIRTUAL_DISPLAYPORT
+
+#if defined(SIMULATOR_BUILD) || defined(UNIT_TEST)
+#include <stdio.h>
+#endif
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/display.h"
+
+#include "io/displayport_virtual.h"
+
+static displayPort_t virtualDisplayPort;
+
+static char canvas[VIRTUAL_DISPLAYPORT_MAX_ROWS * VIRTUAL_DISPLAYPORT_MAX_COLS];
+static char sent[VIRTUAL_DISPLAYPORT_MAX_ROWS * VIRTUAL_DISPLAYPORT_MAX_COLS];    // as of the last drawScreen
+static displayPortVirtualStats_t stats;
+
+static int virtualGrab(displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return 0;
+}
+
+static int virtualRelease(displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return 0;
+}
+
+static int virtualClearScreen(displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    memset(canvas, ' ', sizeof(canvas));
+    stats.clears++;
+    return 0;
+}
+
+static int virtualDrawScreen(displayPort_t *displayPort)
+{
+    const int size = displayPort->rows * displayPort->cols;
+    int cells = 0;
+
+    for (int i = 0; i < size; i++) {
+        if (canvas[i] != sent[i]) {
+            sent[i] = canvas[i];
+            cells++;
+        }
+    }
+
+    if (cells) {
+        stats.frames++;
+        stats.frameCells += cells;
+        stats.frameBytes += cells * VIRTUAL_DISPLAYPORT_BYTES_PER_CELL;
+        stats.lastFrameCells = cells;
+        stats.lastFrameBytes = cells * VIRTUAL_DISPLAYPORT_BYTES_PER_CELL;
+    }
+    return 0;
+}
+
+static int virtualScreenSize(const displayPort_t *displayPort)
+{
+    return displayPort->rows * displayPort->cols;
+}
+
+static void setCell(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t c)
+{
+    if (x >= displayPort->cols || y >= displayPort->rows) {
+        return;
+    }
+
+    char *cell = &canvas[y * displayPort->cols + x];
+    stats.cellsWritten++;
+    if (*cell != (char)c) {
+        *cell = c;
+        stats.cellsChanged++;
+    }
+}
+
+static int virtualWriteString(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *s)
+{
+    stats.writes++;
+    for (; *s && x < displayPort->cols; s++, x++) {
+        setCell(displayPort, x, y, *s);
+    }
+    return 0;
+}
+
+static int virtualWriteChar(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t c)
+{
+    stats.writes++;
+    setCell(displayPort, x, y, c);
+    return 0;
+}
+
+static bool virtualIsTransferInProgress(const displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return false;
+}
+
+static int virtualHeartbeat(displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return 0;
+}
+
+static void virtualResync(displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+}
+
+static bool virtualIsSynced(const displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return true;
+}
+
+static uint32_t virtualTxBytesFree(const displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return UINT32_MAX;
+}
+
+static const displayPortVTable_t virtualDisplayPortVTable = {
+    .grab = virtualGrab,
+    .release = virtualRelease,
+    .clearScreen = virtualClearScreen,
+    .drawScreen = virtualDrawScreen,
+    .screenSize = virtualScreenSize,
+    .writeString = virtualWriteString,
+    .writeChar = virtualWriteChar,
+    .isTransferInProgress = virtualIsTransferInProgress,
+    .heartbeat = virtualHeartbeat,
+    .resync = virtualResync,
+    .isSynced = virtualIsSynced,
+    .txBytesFree = virtualTxBytesFree
+};
+
+displayPort_t *displayPortVirtualInit(uint8_t rows, uint8_t cols)
+{
+    displayInit(&virtualDisplayPort, &virtualDisplayPortVTable);
+    virtualDisplayPort.rows = MIN(rows, VIRTUAL_DISPLAYPORT_MAX_ROWS);
+    virtualDisplayPort.cols = MIN(cols, VIRTUAL_DISPLAYPORT_MAX_COLS);
+    memset(canvas, ' ', sizeof(canvas));
+    memset(sent, ' ', sizeof(sent));
+    displayPortVirtualResetStats();
+    return &virtualDisplayPort;
+}
+
+// The characters, row by row, rows * cols of them
+char *displayPortVirtualBuffer(void)
+{
+    return canvas;
+}
+
+const displayPortVirtualStats_t *displayPortVirtualStats(void)
+{
+    return &stats;
+}
+
+void displayPortVirtualResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+#if defined(SIMULATOR_BUILD) || defined(UNIT_TEST)
+
+/*
+ * MAX7456 font files (.mcm) are text: a "MAX7456" line, then 64 lines of 8 binary digits for each of the 256
+ * characters, of which the first 54 bytes are the character's 12 x 18 pixels, 2 bits each, MSB first:
+ * 00 black, 10 white, 01 and 11 transparent.
+ */
+#define FONT_CHAR_WIDTH     12
+#define FONT_CHAR_HEIGHT    18
+#define FONT_CHAR_BYTES     54
+#define FONT_CHAR_STRIDE    64
+
+static uint8_t font[256][FONT_CHAR_BYTES];
+static bool fontLoaded;
+
+bool displayPortVirtualLoadFont(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+
+    char line[16];
+    bool ok = fgets(line, sizeof(line), file) && strncmp(line, "MAX7456", 7) == 0;
+
+    for (int i = 0; ok && i < 256 * FONT_CHAR_STRIDE; i++) {
+        ok = fgets(line, sizeof(line), file) != NULL;
+
+        uint8_t value = 0;
+        for (int bit = 0; ok && bit < 8; bit++) {
+            ok = line[bit] == '0' || line[bit] == '1';
+            value = (value << 1) | (line[bit] == '1');
+        }
+        if (ok && i % FONT_CHAR_STRIDE < FONT_CHAR_BYTES) {
+            font[i / FONT_CHAR_STRIDE][i % FONT_CHAR_STRIDE] = value;
+        }
+    }
+    fclose(file);
+
+    fontLoaded = ok;
+    return ok;
+}
+
+static uint8_t fontPixel(uint8_t c, int x, int y)
+{
+    if (!fontLoaded) {
+        // Without a font, anything but a space is a white block
+        const bool border = x == 0 || y == 0 || x == FONT_CHAR_WIDTH - 1 || y == FONT_CHAR_HEIGHT - 1;
+        return (c == ' ' || border) ? 128 : 255;
+    }
+
+    const int pixel = y * FONT_CHAR_WIDTH + x;
+    const int bits = (font[c][pixel / 4] >> (6 - 2 * (pixel % 4))) & 0x03;
+    switch (bits) {
+    case 0:
+        return 0;
+    case 2:
+        return 255;
+    default:
+        return 128; // transparent, shown as grey
+    }
+}
+
+// Write the screen as of the last drawScreen to a binary PGM file
+bool displayPortVirtualWritePgm(const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+
+    const int rows = virtualDisplayPort.rows;
+    const int cols = virtualDisplayPort.cols;
+    fprintf(file, "P5\n%d %d\n255\n", cols * FONT_CHAR_WIDTH, rows * FONT_CHAR_HEIGHT);
+
+    bool ok = true;
+    uint8_t line[VIRTUAL_DISPLAYPORT_MAX_COLS * FONT_CHAR_WIDTH];
+    for (int y = 0; y < rows * FONT_CHAR_HEIGHT; y++) {
+        for (int x = 0; x < cols * FONT_CHAR_WIDTH; x++) {
+            const uint8_t c = sent[(y / FONT_CHAR_HEIGHT) * cols + x / FONT_CHAR_WIDTH];
+            line[x] = fontPixel(c, x % FONT_CHAR_WIDTH, y % FONT_CHAR_HEIGHT);
+        }
+        ok = ok && fwrite(line, 1, cols * FONT_CHAR_WIDTH, file) == (size_t)(cols * FONT_CHAR_WIDTH);
+    }
+
+    return fclose(file) == 0 && ok;
+}
+#endif
+
+#endif // USE_VIRTUAL_DISPLAYPORT
@@ -0,0 +1,56 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "drivers/display.h"
+
+/*
+ * A displayport that renders to a character grid in memory, so that the OSD and CMS can be run and measured on the
+ * host, in SITL and the unit tests. drawScreen counts what a display would have had to be sent, the cells that changed
+ * since the last drawScreen, as if written to a MAX7456 one cell at a time.
+ */
+
+#define VIRTUAL_DISPLAYPORT_MAX_ROWS    16  // PAL
+#define VIRTUAL_DISPLAYPORT_MAX_COLS    30
+
+#define VIRTUAL_DISPLAYPORT_BYTES_PER_CELL  6   // DMAH, DMAL and DMDI writes
+
+typedef struct displayPortVirtualStats_s {
+    uint32_t writes;            // writeString and writeChar calls
+    uint32_t cellsWritten;
+    uint32_t cellsChanged;      // written with a different character
+    uint32_t clears;
+    uint32_t frames;            // drawScreen calls with changes to send
+    uint32_t frameCells;        // changed cells sent by all the frames
+    uint32_t frameBytes;
+    uint32_t lastFrameCells;
+    uint32_t lastFrameBytes;
+} displayPortVirtualStats_t;
+
+displayPort_t *displayPortVirtualInit(uint8_t rows, uint8_t cols);
+char *displayPortVirtualBuffer(void);
+const displayPortVirtualStats_t *displayPortVirtualStats(void);
+void displayPortVirtualResetStats(void);
+
+#if defined(SIMULATOR_BUILD) || defined(UNIT_TEST)
+bool displayPortVirtualLoadFont(const char *path);
+bool displayPortVirtualWritePgm(const char *path);
+#endif
@@ -382,10 +382,7 @@ void rcdeviceReceive(timeUs_t currentTimeUs)
         // if data received done, trigger callback to parse response data, and update rcdevice state
         if (respCtx->recvRespLen == respCtx->expectedRespLen) {
             if (respCtx->protocolVersion == RCDEVICE_PROTOCOL_VERSION_1_0) {
-                uint8_t crc = 0;
-                for (int i = 0; i < respCtx->recvRespLen; i++) {
-                    crc = crc8_dvb_s2(crc, respCtx->recvBuf[i]);
-                }
+                const uint8_t crc = crc8_dvb_s2_update(0, respCtx->recvBuf, respCtx->recvRespLen);
 
                 respCtx->result = (crc == 0) ? RCDEVICE_RESP_SUCCESS : RCDEVICE_RESP_INCORRECT_CRC;
             } else if (respCtx->protocolVersion == RCDEVICE_PROTOCOL_RCSPLIT_VERSION) {
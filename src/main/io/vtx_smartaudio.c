@@ -34,6 +34,7 @@
 #include "cms/cms.h"
 #include "cms/cms_menu_vtx_smartaudio.h"
 
+#include "common/crc.h"
 #include "common/maths.h"
 #include "common/printf.h"
 #include "common/utils.h"
@@ -145,27 +146,9 @@ static uint8_t sa_rbuf[SA_MAX_RCVLEN + 4]; // XXX delete 4 byte guard
 // CRC8 computations
 //
 
-#define POLYGEN 0xd5
-
 static uint8_t CRC8(const uint8_t *data, const int8_t len)
 {
-    uint8_t crc = 0; /* start with 0 so first byte can be 'xored' in */
-    uint8_t currByte;
-
-    for (int i = 0 ; i < len ; i++) {
-        currByte = data[i];
-
-        crc ^= currByte; /* XOR-in the next input byte */
-
-        for (int i = 0; i < 8; i++) {
-            if ((crc & 0x80) != 0) {
-                crc = (uint8_t)((crc << 1) ^ POLYGEN);
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    return crc;
+    return crc8_dvb_s2_update(0, data, len);
 }
 
 
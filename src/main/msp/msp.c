@@ -39,7 +39,7 @@
 #include "common/axis.h"
 #include "common/bitarray.h"
 #include "common/color.h"
-#include "common/huffman.h"
+#include "common/crc.h"
 #include "common/maths.h"
 #include "common/streambuf.h"
 #include "common/utils.h"
@@ -55,12 +55,14 @@
 #include "drivers/flash.h"
 #include "drivers/io.h"
 #include "drivers/max7456.h"
+#include "drivers/max7456_font.h"
 #include "drivers/motor.h"
 #include "drivers/pwm_output.h"
 #include "drivers/sdcard.h"
 #include "drivers/serial.h"
 #include "drivers/serial_escserial.h"
 #include "drivers/system.h"
+#include "drivers/time.h"
 #include "drivers/transponder_ir.h"
 #include "drivers/usb_msc.h"
 #include "drivers/vtx_common.h"
@@ -70,6 +72,7 @@
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
 #include "fc/core.h"
+#include "fc/flight_stats.h"
 #include "fc/rc.h"
 #include "fc/rc_adjustments.h"
 #include "fc/rc_controls.h"
@@ -101,7 +104,9 @@
 #include "io/vtx.h"
 
 #include "msp/msp_box.h"
+#include "msp/msp_dataflash.h"
 #include "msp/msp_protocol.h"
+#include "msp/msp_protocol_v2_betaflight.h"
 #include "msp/msp_serial.h"
 
 #include "osd/osd.h"
@@ -222,8 +227,11 @@ static void mspEscPassthroughFn(serialPort_t *serialPort)
 }
 #endif
 
-static void mspFc4waySerialCommand(sbuf_t *dst, sbuf_t *src, mspPostProcessFnPtr *mspPostProcessFn)
+static mspResult_e mspFc4waySerialCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
+    UNUSED(srcDesc);
+    UNUSED(cmdMSP);
+
     const unsigned int dataSize = sbufBytesRemaining(src);
     if (dataSize == 0) {
         // Legacy format
@@ -266,6 +274,7 @@ static void mspFc4waySerialCommand(sbuf_t *dst, sbuf_t *src, mspPostProcessFnPtr
     default:
         sbufWriteU8(dst, 0);
     }
+    return MSP_RESULT_ACK;
 }
 #endif //USE_SERIAL_4WAY_BLHELI_INTERFACE
 
@@ -402,111 +411,14 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
     }
 }
 
-#ifdef USE_FLASHFS
-enum compressionType_e {
-    NO_COMPRESSION,
-    HUFFMAN
-};
-
-static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat, bool allowCompression)
-{
-    STATIC_ASSERT(MSP_PORT_DATAFLASH_INFO_SIZE >= 16, MSP_PORT_DATAFLASH_INFO_SIZE_invalid);
-
-    uint16_t readLen = size;
-    const int bytesRemainingInBuf = sbufBytesRemaining(dst) - MSP_PORT_DATAFLASH_INFO_SIZE;
-    if (readLen > bytesRemainingInBuf) {
-        readLen = bytesRemainingInBuf;
-    }
-    // size will be lower than that requested if we reach end of volume
-    const uint32_t flashfsSize = flashfsGetSize();
-    if (readLen > flashfsSize - address) {
-        // truncate the request
-        readLen = flashfsSize - address;
-    }
-    sbufWriteU32(dst, address);
-
-    // legacy format does not support compression
-#ifdef USE_HUFFMAN
-    const uint8_t compressionMethod = (!allowCompression || useLegacyFormat) ? NO_COMPRESSION : HUFFMAN;
-#else
-    const uint8_t compressionMethod = NO_COMPRESSION;
-    UNUSED(allowCompression);
-#endif
-
-    if (compressionMethod == NO_COMPRESSION) {
-
-        uint16_t *readLenPtr = (uint16_t *)sbufPtr(dst);
-        if (!useLegacyFormat) {
-            // new format supports variable read lengths
-            sbufWriteU16(dst, readLen);
-            sbufWriteU8(dst, 0); // placeholder for compression format
-        }
-
-        const int bytesRead = flashfsReadAbs(address, sbufPtr(dst), readLen);
-
-        if (!useLegacyFormat) {
-            // update the 'read length' with the actual amount read from flash.
-            *readLenPtr = bytesRead;
-        }
-
-        sbufAdvance(dst, bytesRead);
-
-        if (useLegacyFormat) {
-            // pad the buffer with zeros
-            for (int i = bytesRead; i < size; i++) {
-                sbufWriteU8(dst, 0);
-            }
-        }
-    } else {
-#ifdef USE_HUFFMAN
-        // compress in 256-byte chunks
-        const uint16_t READ_BUFFER_SIZE = 256;
-        uint8_t readBuffer[READ_BUFFER_SIZE];
-
-        huffmanState_t state = {
-            .bytesWritten = 0,
-            .outByte = sbufPtr(dst) + sizeof(uint16_t) + sizeof(uint8_t) + HUFFMAN_INFO_SIZE,
-            .outBufLen = readLen,
-            .outBit = 0x80,
-        };
-        *state.outByte = 0;
-
-        uint16_t bytesReadTotal = 0;
-        // read until output buffer overflows or flash is exhausted
-        while (state.bytesWritten < state.outBufLen && address + bytesReadTotal < flashfsSize) {
-            const int bytesRead = flashfsReadAbs(address + bytesReadTotal, readBuffer,
-                MIN(sizeof(readBuffer), flashfsSize - address - bytesReadTotal));
-
-            const int status = huffmanEncodeBufStreaming(&state, readBuffer, bytesRead, huffmanTable);
-            if (status == -1) {
-                // overflow
-                break;
-            }
-
-            bytesReadTotal += bytesRead;
-        }
-
-        if (state.outBit != 0x80) {
-            ++state.bytesWritten;
-        }
-
-        // header
-        sbufWriteU16(dst, HUFFMAN_INFO_SIZE + state.bytesWritten);
-        sbufWriteU8(dst, compressionMethod);
-        // payload
-        sbufWriteU16(dst, bytesReadTotal);
-        sbufAdvance(dst, state.bytesWritten);
-#endif
-    }
-}
-#endif // USE_FLASHFS
-
 /*
- * Returns true if the command was processd, false otherwise.
+ * Returns MSP_RESULT_ACK if the command was processed, MSP_RESULT_CMD_UNKNOWN otherwise.
  * May set mspPostProcessFunc to a function to be called once the command has been processed
  */
-static bool mspCommonProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+static mspResult_e mspCommonProcessOutCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
+    UNUSED(srcDesc);
+    UNUSED(src);
     UNUSED(mspPostProcessFn);
 
     switch (cmdMSP) {
@@ -625,6 +537,18 @@ static bool mspCommonProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst, mspPostProce
         }
         break;
 
+    case MSP2_BETAFLIGHT_FLIGHT_STATS:
+        sbufWriteU8(dst, FLIGHT_STAT_COUNT);
+        for (int i = 0; i < FLIGHT_STAT_COUNT; i++) {
+            const streamStats_t *stats = flightStatsGet(i);
+            sbufWriteU32(dst, stats->count);
+            sbufWriteU32(dst, stats->min);
+            sbufWriteU32(dst, stats->max);
+            sbufWriteU32(dst, streamStatsMean(stats));
+            sbufWriteU32(dst, stats->percentile);
+        }
+        break;
+
     case MSP_UID:
         sbufWriteU32(dst, U_ID_0);
         sbufWriteU32(dst, U_ID_1);
@@ -877,13 +801,17 @@ static bool mspCommonProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst, mspPostProce
     }
 
     default:
-        return false;
+        return MSP_RESULT_CMD_UNKNOWN;
     }
-    return true;
+    return MSP_RESULT_ACK;
 }
 
-static bool mspProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst)
+static mspResult_e mspProcessOutCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
+    UNUSED(srcDesc);
+    UNUSED(src);
+    UNUSED(mspPostProcessFn);
+
     bool unsupportedCommand = false;
 
     switch (cmdMSP) {
@@ -1765,10 +1693,10 @@ static bool mspProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst)
     default:
         unsupportedCommand = true;
     }
-    return !unsupportedCommand;
+    return unsupportedCommand ? MSP_RESULT_CMD_UNKNOWN : MSP_RESULT_ACK;
 }
 
-static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, uint8_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
 
     switch (cmdMSP) {
@@ -1932,30 +1860,20 @@ static mspResult_e mspFcProcessOutCommandWithArg(mspDescriptor_t srcDesc, uint8_
 }
 
 #ifdef USE_FLASHFS
-static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
+static mspResult_e mspFcDataFlashReadCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
-    const unsigned int dataSize = sbufBytesRemaining(src);
-    const uint32_t readAddress = sbufReadU32(src);
-    uint16_t readLength;
-    bool allowCompression = false;
-    bool useLegacyFormat;
-    if (dataSize >= sizeof(uint32_t) + sizeof(uint16_t)) {
-        readLength = sbufReadU16(src);
-        if (sbufBytesRemaining(src)) {
-            allowCompression = sbufReadU8(src);
-        }
-        useLegacyFormat = false;
-    } else {
-        readLength = 128;
-        useLegacyFormat = true;
-    }
+    UNUSED(cmdMSP);
+    UNUSED(mspPostProcessFn);
 
-    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat, allowCompression);
+    return mspDataflashReadCommand(srcDesc, src, dst);
 }
 #endif
 
-static mspResult_e mspProcessInCommand(mspDescriptor_t srcDesc, uint8_t cmdMSP, sbuf_t *src)
+static mspResult_e mspProcessInCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
+    UNUSED(dst);
+    UNUSED(mspPostProcessFn);
+
     uint32_t i;
     uint8_t value;
     const unsigned int dataSize = sbufBytesRemaining(src);
@@ -3077,8 +2995,9 @@ static mspResult_e mspProcessInCommand(mspDescriptor_t srcDesc, uint8_t cmdMSP,
     return MSP_RESULT_ACK;
 }
 
-static mspResult_e mspCommonProcessInCommand(mspDescriptor_t srcDesc, uint8_t cmdMSP, sbuf_t *src, mspPostProcessFnPtr *mspPostProcessFn)
+static mspResult_e mspCommonProcessInCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
+    UNUSED(dst);
     UNUSED(mspPostProcessFn);
     const unsigned int dataSize = sbufBytesRemaining(src);
     UNUSED(dataSize); // maybe unused due to compiler options
@@ -3290,46 +3209,517 @@ static mspResult_e mspCommonProcessInCommand(mspDescriptor_t srcDesc, uint8_t cm
 #endif // OSD
 
     default:
-        return mspProcessInCommand(srcDesc, cmdMSP, src);
+        return mspProcessInCommand(srcDesc, cmdMSP, src, dst, mspPostProcessFn);
     }
     return MSP_RESULT_ACK;
 }
 
+typedef mspResult_e (*mspCommandFnPtr)(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+
+#define MSP_ANY_SIZE 0xFFFF
+
+typedef struct mspCommand_s {
+    uint16_t cmd;
+    uint16_t minSize;   // payload sizes outside of these are rejected before the handler is called
+    uint16_t maxSize;
+    mspCommandFnPtr fn;
+} mspCommand_t;
+
+static mspResult_e mspFcBatchCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+static mspResult_e mspFcBatchSubscribeCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+static mspResult_e mspFcSubscribeCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+static mspResult_e mspFcConfigSnapshotCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+static mspResult_e mspFcConfigDeltaCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+static mspResult_e mspFcOsdFontWriteCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn);
+
+// Sorted by command ID, looked up by a binary search
+static const mspCommand_t mspCommands[] = {
+    { MSP_API_VERSION, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_FC_VARIANT, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_FC_VERSION, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_BOARD_INFO, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_BUILD_INFO, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_NAME, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_NAME, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_BATTERY_CONFIG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_SET_BATTERY_CONFIG, 7, MSP_ANY_SIZE, mspCommonProcessInCommand },
+    { MSP_MODE_RANGES, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_MODE_RANGE, 5, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_FEATURE_CONFIG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_SET_FEATURE_CONFIG, 4, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_BOARD_ALIGNMENT_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_BOARD_ALIGNMENT_CONFIG, 6, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_CURRENT_METER_CONFIG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_SET_CURRENT_METER_CONFIG, 5, MSP_ANY_SIZE, mspCommonProcessInCommand },
+    { MSP_MIXER_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_MIXER_CONFIG, 1, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_RX_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_RX_CONFIG, 8, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_LED_COLORS, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_LED_COLORS, LED_CONFIGURABLE_COLOR_COUNT * 4, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_LED_STRIP_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_LED_STRIP_CONFIG, 5, 5, mspProcessInCommand },
+    { MSP_RSSI_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_RSSI_CONFIG, 1, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_ADJUSTMENT_RANGES, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_ADJUSTMENT_RANGE, 7, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_CF_SERIAL_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_CF_SERIAL_CONFIG, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_VOLTAGE_METER_CONFIG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_SET_VOLTAGE_METER_CONFIG, 4, MSP_ANY_SIZE, mspCommonProcessInCommand },
+    { MSP_SONAR_ALTITUDE, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_PID_CONTROLLER, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_PID_CONTROLLER, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_ARMING_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_ARMING_CONFIG, 2, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_RX_MAP, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_RX_MAP, RX_MAPPABLE_CHANNEL_COUNT, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_REBOOT, 0, MSP_ANY_SIZE, mspFcProcessOutCommandWithArg },
+    { MSP_DATAFLASH_SUMMARY, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+#ifdef USE_FLASHFS
+    { MSP_DATAFLASH_READ, 4, MSP_ANY_SIZE, mspFcDataFlashReadCommand },
+#endif
+    { MSP_DATAFLASH_ERASE, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_FAILSAFE_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_FAILSAFE_CONFIG, 8, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_RXFAIL_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_RXFAIL_CONFIG, 4, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SDCARD_SUMMARY, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_BLACKBOX_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_BLACKBOX_CONFIG, 3, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_TRANSPONDER_CONFIG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_SET_TRANSPONDER_CONFIG, 1, MSP_ANY_SIZE, mspCommonProcessInCommand },
+    { MSP_OSD_CONFIG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_SET_OSD_CONFIG, 3, MSP_ANY_SIZE, mspCommonProcessInCommand },
+    { MSP_OSD_CHAR_WRITE, 55, MSP_ANY_SIZE, mspCommonProcessInCommand },
+    { MSP_VTX_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_VTX_CONFIG, 2, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_ADVANCED_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_ADVANCED_CONFIG, 6, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_FILTER_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_FILTER_CONFIG, 5, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_PID_ADVANCED, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_PID_ADVANCED, 17, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SENSOR_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_SENSOR_CONFIG, 3, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_CAMERA_CONTROL, 1, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_ARMING_DISABLED, 1, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_STATUS, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_RAW_IMU, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SERVO, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_MOTOR, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_RC, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_RAW_GPS, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_COMP_GPS, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_ATTITUDE, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_ALTITUDE, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_ANALOG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_RC_TUNING, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_PID, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_BOXNAMES, 0, MSP_ANY_SIZE, mspFcProcessOutCommandWithArg },
+    { MSP_PIDNAMES, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_BOXIDS, 0, MSP_ANY_SIZE, mspFcProcessOutCommandWithArg },
+    { MSP_SERVO_CONFIGURATIONS, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_MOTOR_3D_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_RC_DEADBAND, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SENSOR_ALIGNMENT, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_LED_STRIP_MODECOLOR, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_VOLTAGE_METERS, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_CURRENT_METERS, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_BATTERY_STATE, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_MOTOR_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_GPS_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_COMPASS_CONFIG, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_ESC_SENSOR_DATA, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_GPS_RESCUE, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_GPS_RESCUE_PIDS, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_VTXTABLE_BAND, 0, MSP_ANY_SIZE, mspFcProcessOutCommandWithArg },
+    { MSP_VTXTABLE_POWERLEVEL, 0, MSP_ANY_SIZE, mspFcProcessOutCommandWithArg },
+    { MSP_MOTOR_TELEMETRY, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_STATUS_EX, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_UID, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_GPSSVINFO, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_COPY_PROFILE, 3, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_BEEPER_CONFIG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP_SET_BEEPER_CONFIG, 4, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_TX_INFO, 1, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_TX_INFO, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_RAW_RC, 0, MAX_SUPPORTED_RC_CHANNEL_COUNT * 2, mspProcessInCommand },
+    { MSP_SET_RAW_GPS, 14, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_PID, PID_ITEM_COUNT * 3, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_RC_TUNING, 10, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_ACC_CALIBRATION, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_MAG_CALIBRATION, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_RESET_CONF, 0, MSP_ANY_SIZE, mspFcProcessOutCommandWithArg },
+    { MSP_SELECT_SETTING, 1, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_HEADING, 2, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_SERVO_CONFIGURATION, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_MOTOR, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_MOTOR_3D_CONFIG, 6, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_RC_DEADBAND, 5, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_RESET_CURR_PID, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_SENSOR_ALIGNMENT, 3, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_LED_STRIP_MODECOLOR, 3, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_MOTOR_CONFIG, 6, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_GPS_CONFIG, 4, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_COMPASS_CONFIG, 2, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_GPS_RESCUE, 16, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_GPS_RESCUE_PIDS, 14, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_VTXTABLE_BAND, 5, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_VTXTABLE_POWERLEVEL, 4, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_MULTIPLE_MSP, 0, MSP_ANY_SIZE, mspFcProcessOutCommandWithArg },
+    { MSP_MODE_RANGES_EXTRA, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_ACC_TRIM, 4, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_ACC_TRIM, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SERVO_MIX_RULES, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_SERVO_MIX_RULE, 0, MSP_ANY_SIZE, mspProcessInCommand },
+#ifdef USE_SERIAL_4WAY_BLHELI_INTERFACE
+    { MSP_SET_4WAY_IF, 0, MSP_ANY_SIZE, mspFc4waySerialCommand },
+#endif
+    { MSP_SET_RTC, 6, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_RTC, 0, MSP_ANY_SIZE, mspProcessOutCommand },
+    { MSP_SET_BOARD_INFO, 2, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_SET_SIGNATURE, SIGNATURE_LENGTH, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_EEPROM_WRITE, 0, MSP_ANY_SIZE, mspProcessInCommand },
+    { MSP_DEBUG, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP2_BETAFLIGHT_BATCH, 0, MSP_ANY_SIZE, mspFcBatchCommand },
+    { MSP2_BETAFLIGHT_BATCH_SUBSCRIBE, 2, MSP_BATCH_MAX_REQUEST_SIZE + 2, mspFcBatchSubscribeCommand },
+    { MSP2_BETAFLIGHT_SUBSCRIBE, 2, 2 + MSP_MAX_SUBSCRIPTIONS * 4, mspFcSubscribeCommand },
+    { MSP2_BETAFLIGHT_CONFIG_SNAPSHOT, 4, 6, mspFcConfigSnapshotCommand },
+    { MSP2_BETAFLIGHT_CONFIG_DELTA, 2, MSP_ANY_SIZE, mspFcConfigDeltaCommand },
+    { MSP2_BETAFLIGHT_FLIGHT_STATS, 0, MSP_ANY_SIZE, mspCommonProcessOutCommand },
+    { MSP2_BETAFLIGHT_OSD_FONT_WRITE, 0, MSP_ANY_SIZE, mspFcOsdFontWriteCommand },
+};
+
+#ifdef USE_MSP_STATISTICS
+static mspCommandStats_t mspCommandStats[ARRAYLEN(mspCommands)];
+#endif
+
+static const mspCommand_t *mspFindCommand(uint16_t cmdMSP)
+{
+    unsigned low = 0;
+    unsigned high = ARRAYLEN(mspCommands);
+
+    while (low < high) {
+        const unsigned mid = (low + high) / 2;
+        if (mspCommands[mid].cmd < cmdMSP) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < ARRAYLEN(mspCommands) && mspCommands[low].cmd == cmdMSP) {
+        return &mspCommands[low];
+    }
+    return NULL;
+}
+
+// Commands with replies of at most MSP_BATCH_REPLY_MAX_SIZE bytes, the only ones that can be batched or subscribed to
+static const uint16_t mspBatchCommands[] = {
+    MSP_STATUS,
+    MSP_RAW_IMU,
+    MSP_MOTOR,
+    MSP_RC,
+    MSP_RAW_GPS,
+    MSP_COMP_GPS,
+    MSP_ATTITUDE,
+    MSP_ALTITUDE,
+    MSP_ANALOG,
+    MSP_BATTERY_STATE,
+    MSP_SONAR_ALTITUDE,
+    MSP_NAME,
+    MSP_STATUS_EX,
+    MSP_RTC,
+    MSP_DEBUG,
+};
+
+#define MSP_BATCH_REPLY_MAX_SIZE    40 // MSP_STATUS_EX, MSP_RC with MAX_SUPPORTED_RC_CHANNEL_COUNT channels is 36
+#define MSP_BATCH_REPLY_HEADER_SIZE 4
+
+static bool mspIsBatchCommand(uint16_t cmdMSP)
+{
+    for (unsigned i = 0; i < ARRAYLEN(mspBatchCommands); i++) {
+        if (mspBatchCommands[i] == cmdMSP) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool mspBatchRequestIsValid(const sbuf_t *request)
+{
+    sbuf_t src = *request;
+
+    while (sbufBytesRemaining(&src)) {
+        if (sbufBytesRemaining(&src) < 3) {
+            return false;
+        }
+        const uint16_t cmdMSP = sbufReadU16(&src);
+        const int argSize = sbufReadU8(&src);
+        if (!mspIsBatchCommand(cmdMSP) || argSize > sbufBytesRemaining(&src)) {
+            return false;
+        }
+        sbufAdvance(&src, argSize);
+    }
+    return true;
+}
+
+static mspResult_e mspFcBatchCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(cmdMSP);
+    UNUSED(mspPostProcessFn);
+
+    if (!mspBatchRequestIsValid(src)) {
+        return MSP_RESULT_ERROR;
+    }
+
+    while (sbufBytesRemaining(src)) {
+        if (sbufBytesRemaining(dst) < MSP_BATCH_REPLY_HEADER_SIZE + MSP_BATCH_REPLY_MAX_SIZE) {
+            // the client can ask for the rest in a further batch
+            break;
+        }
+
+        const uint16_t batchCmd = sbufReadU16(src);
+        const int argSize = sbufReadU8(src);
+        sbuf_t args;
+        sbufInit(&args, sbufPtr(src), sbufPtr(src) + argSize);
+        sbufAdvance(src, argSize);
+
+        uint8_t *header = sbufPtr(dst);
+        sbufWriteU16(dst, batchCmd);
+        sbufAdvance(dst, 2); // result and reply size, filled in below
+
+        const mspCommand_t *command = mspFindCommand(batchCmd);
+        mspResult_e ret = MSP_RESULT_ERROR;
+        if (command && argSize >= command->minSize && argSize <= command->maxSize) {
+            ret = command->fn(srcDesc, batchCmd, &args, dst, NULL);
+        }
+        if (ret != MSP_RESULT_ACK) {
+            ret = MSP_RESULT_ERROR;
+            dst->ptr = header + MSP_BATCH_REPLY_HEADER_SIZE;
+        }
+        header[2] = ret;
+        header[3] = sbufPtr(dst) - (header + MSP_BATCH_REPLY_HEADER_SIZE);
+    }
+    return MSP_RESULT_ACK;
+}
+
+static mspResult_e mspFcBatchSubscribeCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(cmdMSP);
+    UNUSED(dst);
+    UNUSED(mspPostProcessFn);
+
+    const uint16_t intervalMs = sbufReadU16(src);
+    if (!mspBatchRequestIsValid(src)) {
+        return MSP_RESULT_ERROR;
+    }
+    // fails if not a serial MSP client
+    if (!mspSerialSetBatchRequest(srcDesc, sbufPtr(src), sbufBytesRemaining(src))
+        || !mspSerialSubscribe(srcDesc, MSP2_BETAFLIGHT_BATCH, intervalMs)) {
+        return MSP_RESULT_ERROR;
+    }
+    return MSP_RESULT_ACK;
+}
+
+static mspResult_e mspFcSubscribeCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(cmdMSP);
+    UNUSED(dst);
+    UNUSED(mspPostProcessFn);
+
+    const uint16_t maxBytesPerSecond = sbufReadU16(src);
+    if (sbufBytesRemaining(src) % 4) {
+        return MSP_RESULT_ERROR;
+    }
+    for (uint8_t *entry = sbufPtr(src); entry < src->end; entry += 4) {
+        const uint16_t subscriptionCmd = entry[0] | entry[1] << 8;
+        if (!mspIsBatchCommand(subscriptionCmd) && subscriptionCmd != MSP2_BETAFLIGHT_BATCH) {
+            return MSP_RESULT_ERROR;
+        }
+    }
+
+    if (!mspSerialSetSubscriptionRateLimit(srcDesc, maxBytesPerSecond)) {
+        // not a serial MSP client
+        return MSP_RESULT_ERROR;
+    }
+    while (sbufBytesRemaining(src)) {
+        const uint16_t subscriptionCmd = sbufReadU16(src);
+        const uint16_t intervalMs = sbufReadU16(src);
+        if (!mspSerialSubscribe(srcDesc, subscriptionCmd, intervalMs)) {
+            // no room for another subscription
+            return MSP_RESULT_ERROR;
+        }
+    }
+    return MSP_RESULT_ACK;
+}
+
+#define MSP_CONFIG_SNAPSHOT_REPLY_HEADER_SIZE  10
+#define MSP_CONFIG_DELTA_PATCH_HEADER_SIZE      6
+
+static mspResult_e mspFcConfigSnapshotCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(srcDesc);
+    UNUSED(cmdMSP);
+    UNUSED(mspPostProcessFn);
+
+    const uint32_t offset = sbufReadU32(src);
+    int length = sbufBytesRemaining(dst) - MSP_CONFIG_SNAPSHOT_REPLY_HEADER_SIZE;
+    if (sbufBytesRemaining(src) >= 2) {
+        length = MIN(length, sbufReadU16(src));
+    }
+
+    sbufWriteU32(dst, getConfigSnapshotSize());
+    sbufWriteU16(dst, getConfigSnapshotCrc());
+    sbufWriteU32(dst, offset);
+    sbufAdvance(dst, readConfigSnapshot(offset, sbufPtr(dst), length));
+
+    return MSP_RESULT_ACK;
+}
+
+static bool mspConfigDeltaIsValid(const sbuf_t *request)
+{
+    sbuf_t src = *request;
+
+    while (sbufBytesRemaining(&src)) {
+        if (sbufBytesRemaining(&src) < MSP_CONFIG_DELTA_PATCH_HEADER_SIZE) {
+            return false;
+        }
+        const pgRegistry_t *reg = pgFind(sbufReadU16(&src));
+        const uint8_t version = sbufReadU8(&src);
+        const uint16_t offset = sbufReadU16(&src);
+        const uint8_t size = sbufReadU8(&src);
+        if (!reg || size > sbufBytesRemaining(&src) || !pgPatchIsValid(reg, version, offset, size)) {
+            return false;
+        }
+        sbufAdvance(&src, size);
+    }
+    return true;
+}
+
+// Either all of the patches are applied or, if any of them is invalid, none of them
+static mspResult_e mspFcConfigDeltaCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(srcDesc);
+    UNUSED(cmdMSP);
+    UNUSED(dst);
+    UNUSED(mspPostProcessFn);
+
+    if (ARMING_FLAG(ARMED)) {
+        return MSP_RESULT_ERROR;
+    }
+
+    const uint16_t crc = sbufReadU16(src);
+    if (crc != crc16_ccitt_update(0xFFFF, sbufPtr(src), sbufBytesRemaining(src)) || !mspConfigDeltaIsValid(src)) {
+        return MSP_RESULT_ERROR;
+    }
+
+    while (sbufBytesRemaining(src)) {
+        const pgRegistry_t *reg = pgFind(sbufReadU16(src));
+        const uint8_t version = sbufReadU8(src);
+        const uint16_t offset = sbufReadU16(src);
+        const uint8_t size = sbufReadU8(src);
+        pgPatch(reg, version, offset, sbufPtr(src), size);
+        sbufAdvance(src, size);
+    }
+
+    // The delta is raw PG bytes, so apply the same limits as a config read from the EEPROM
+    validateAndActivateConfig();
+
+    return MSP_RESULT_ACK;
+}
+
+static mspResult_e mspFcOsdFontWriteCommand(mspDescriptor_t srcDesc, int16_t cmdMSP, sbuf_t *src, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(srcDesc);
+    UNUSED(cmdMSP);
+    UNUSED(mspPostProcessFn);
+
+#ifdef USE_MAX7456
+    const int glyphSize = sizeof(uint16_t) + NVM_RAM_SIZE;
+    if (sbufBytesRemaining(src) % glyphSize) {
+        return MSP_RESULT_ERROR;
+    }
+
+    uint8_t accepted = 0;
+    while (!ARMING_FLAG(ARMED) && sbufBytesRemaining(src)) {
+        const uint16_t address = sbufReadU16(src);
+        if (!max7456QueueNvm(address, sbufPtr(src))) {
+            break;
+        }
+        sbufAdvance(src, NVM_RAM_SIZE);
+        accepted++;
+    }
+
+    const max7456FontQueue_t *queue = max7456GetFontQueue();
+    sbufWriteU8(dst, accepted);
+    sbufWriteU8(dst, max7456FontQueueFree(queue));
+    sbufWriteU16(dst, queue->accepted);
+    sbufWriteU16(dst, queue->written);
+    return MSP_RESULT_ACK;
+#else
+    UNUSED(src);
+    UNUSED(dst);
+    return MSP_RESULT_ERROR;
+#endif
+}
+
 /*
  * Returns MSP_RESULT_ACK, MSP_RESULT_ERROR or MSP_RESULT_NO_REPLY
  */
 mspResult_e mspFcProcessCommand(mspDescriptor_t srcDesc, mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
 {
-    int ret = MSP_RESULT_ACK;
+    mspResult_e ret = MSP_RESULT_ERROR;
     sbuf_t *dst = &reply->buf;
     sbuf_t *src = &cmd->buf;
-    const uint8_t cmdMSP = cmd->cmd;
     // initialize reply by default
     reply->cmd = cmd->cmd;
 
-    if (mspCommonProcessOutCommand(cmdMSP, dst, mspPostProcessFn)) {
-        ret = MSP_RESULT_ACK;
-    } else if (mspProcessOutCommand(cmdMSP, dst)) {
-        ret = MSP_RESULT_ACK;
-    } else if ((ret = mspFcProcessOutCommandWithArg(srcDesc, cmdMSP, src, dst, mspPostProcessFn)) != MSP_RESULT_CMD_UNKNOWN) {
-        /* ret */;
-#ifdef USE_SERIAL_4WAY_BLHELI_INTERFACE
-    } else if (cmdMSP == MSP_SET_4WAY_IF) {
-        mspFc4waySerialCommand(dst, src, mspPostProcessFn);
-        ret = MSP_RESULT_ACK;
+    const mspCommand_t *command = mspFindCommand(cmd->cmd);
+    const unsigned dataSize = sbufBytesRemaining(src);
+    if (command && dataSize >= command->minSize && dataSize <= command->maxSize) {
+#ifdef USE_MSP_STATISTICS
+        const timeUs_t startTimeUs = micros();
 #endif
-#ifdef USE_FLASHFS
-    } else if (cmdMSP == MSP_DATAFLASH_READ) {
-        mspFcDataFlashReadCommand(dst, src);
-        ret = MSP_RESULT_ACK;
+        ret = command->fn(srcDesc, command->cmd, src, dst, mspPostProcessFn);
+        if (ret == MSP_RESULT_CMD_UNKNOWN) {
+            // not supported by this build
+            ret = MSP_RESULT_ERROR;
+        }
+#ifdef USE_MSP_STATISTICS
+        const uint32_t durationUs = cmpTimeUs(micros(), startTimeUs);
+        mspCommandStats_t *stats = &mspCommandStats[command - mspCommands];
+        stats->count++;
+        stats->totalUs += durationUs;
+        stats->maxUs = MAX(stats->maxUs, durationUs);
 #endif
-    } else {
-        ret = mspCommonProcessInCommand(srcDesc, cmdMSP, src, mspPostProcessFn);
     }
     reply->result = ret;
     return ret;
 }
 
+#ifdef USE_MSP_STATISTICS
+unsigned mspCommandCount(void)
+{
+    return ARRAYLEN(mspCommands);
+}
+
+uint16_t mspCommandId(unsigned index)
+{
+    return mspCommands[index].cmd;
+}
+
+const mspCommandStats_t *mspGetCommandStats(unsigned index)
+{
+    return &mspCommandStats[index];
+}
+
+void mspResetCommandStats(void)
+{
+    memset(mspCommandStats, 0, sizeof(mspCommandStats));
+}
+#endif
+
 void mspFcProcessReply(mspPacket_t *reply)
 {
     sbuf_t *src = &reply->buf;
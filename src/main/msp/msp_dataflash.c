@@ -0,0 +1,220 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_FLASHFS
+
+#include "common/huffman.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "io/flashfs.h"
+
+#include "msp/msp_protocol.h"
+#include "msp/msp_serial.h"
+
+#include "msp_dataflash.h"
+
+enum compressionType_e {
+    NO_COMPRESSION,
+    HUFFMAN
+};
+
+/*
+ * Reads from address, but not from endAddress onwards. Returns the number of bytes of flash that were consumed by the
+ * reply, which is only zero at the end of the range or of the flash.
+ */
+uint32_t mspDataflashSerializeReadReply(sbuf_t *dst, uint32_t address, uint16_t size, uint32_t endAddress, bool useLegacyFormat, bool allowCompression)
+{
+    STATIC_ASSERT(MSP_PORT_DATAFLASH_INFO_SIZE >= 16, MSP_PORT_DATAFLASH_INFO_SIZE_invalid);
+
+    uint16_t readLen = size;
+    const int bytesRemainingInBuf = sbufBytesRemaining(dst) - MSP_PORT_DATAFLASH_INFO_SIZE;
+    if (readLen > bytesRemainingInBuf) {
+        readLen = bytesRemainingInBuf;
+    }
+    // size will be lower than that requested if we reach end of volume
+    const uint32_t readEnd = MIN(flashfsGetSize(), endAddress);
+    if (address >= readEnd) {
+        readLen = 0;
+    } else if (readLen > readEnd - address) {
+        // truncate the request
+        readLen = readEnd - address;
+    }
+    sbufWriteU32(dst, address);
+
+    // legacy format does not support compression
+#ifdef USE_HUFFMAN
+    const uint8_t compressionMethod = (!allowCompression || useLegacyFormat) ? NO_COMPRESSION : HUFFMAN;
+
+    if (compressionMethod == HUFFMAN && readLen) {
+        // compress in 256-byte chunks
+        const uint16_t READ_BUFFER_SIZE = 256;
+        uint8_t readBuffer[READ_BUFFER_SIZE];
+
+        huffmanState_t state = {
+            .bytesWritten = 0,
+            .outByte = sbufPtr(dst) + sizeof(uint16_t) + sizeof(uint8_t) + HUFFMAN_INFO_SIZE,
+            .outBufLen = readLen,
+            .outBit = 0x80,
+        };
+        *state.outByte = 0;
+
+        uint16_t bytesReadTotal = 0;
+        // read until output buffer overflows or the range is exhausted
+        while (state.bytesWritten < state.outBufLen && address + bytesReadTotal < readEnd) {
+            const int bytesRead = flashfsReadAbs(address + bytesReadTotal, readBuffer,
+                MIN(sizeof(readBuffer), readEnd - address - bytesReadTotal));
+
+            const int status = huffmanEncodeBufStreaming(&state, readBuffer, bytesRead, huffmanTable);
+            if (status == -1) {
+                // overflow
+                break;
+            }
+
+            bytesReadTotal += bytesRead;
+        }
+
+        // If not even the first chunk fitted once compressed, send the data as it is instead
+        if (bytesReadTotal) {
+            if (state.outBit != 0x80) {
+                ++state.bytesWritten;
+            }
+
+            // header
+            sbufWriteU16(dst, HUFFMAN_INFO_SIZE + state.bytesWritten);
+            sbufWriteU8(dst, compressionMethod);
+            // payload
+            sbufWriteU16(dst, bytesReadTotal);
+            sbufAdvance(dst, state.bytesWritten);
+            return bytesReadTotal;
+        }
+    }
+#else
+    UNUSED(allowCompression);
+#endif
+
+    uint16_t *readLenPtr = (uint16_t *)sbufPtr(dst);
+    if (!useLegacyFormat) {
+        // new format supports variable read lengths
+        sbufWriteU16(dst, readLen);
+        sbufWriteU8(dst, NO_COMPRESSION); // placeholder for compression format
+    }
+
+    const int bytesRead = readLen ? flashfsReadAbs(address, sbufPtr(dst), readLen) : 0;
+
+    if (!useLegacyFormat) {
+        // update the 'read length' with the actual amount read from flash.
+        *readLenPtr = bytesRead;
+    }
+
+    sbufAdvance(dst, bytesRead);
+
+    if (useLegacyFormat) {
+        // pad the buffer with zeros
+        for (int i = bytesRead; i < size; i++) {
+            sbufWriteU8(dst, 0);
+        }
+    }
+
+    return bytesRead;
+}
+
+// A streamed read keeps sending MSP_DATAFLASH_READ replies until the requested range is covered. Only one port at a
+// time can stream, a read from another port while it does gets a single reply.
+static struct {
+    mspDescriptor_t descriptor;
+    uint32_t address;
+    uint32_t endAddress;
+    uint16_t frameLength;
+    bool allowCompression;
+} dataflashStream;
+
+static bool mspDataflashStreamNext(mspDescriptor_t srcDesc, mspPacket_t *reply)
+{
+    if (srcDesc != dataflashStream.descriptor || dataflashStream.address >= dataflashStream.endAddress) {
+        return false;
+    }
+
+    const uint32_t bytesConsumed = mspDataflashSerializeReadReply(&reply->buf, dataflashStream.address,
+        dataflashStream.frameLength, dataflashStream.endAddress, false, dataflashStream.allowCompression);
+
+    if (bytesConsumed == 0) {
+        if (dataflashStream.address < flashfsGetSize()) {
+            // no room for any data, leave the client to ask for the rest
+            return false;
+        }
+        // end of flash, the empty reply tells the client the stream is over
+        dataflashStream.endAddress = dataflashStream.address;
+    }
+    dataflashStream.address += bytesConsumed;
+
+    reply->cmd = MSP_DATAFLASH_READ;
+    return true;
+}
+
+mspResult_e mspDataflashReadCommand(mspDescriptor_t srcDesc, sbuf_t *src, sbuf_t *dst)
+{
+    const unsigned int dataSize = sbufBytesRemaining(src);
+    const uint32_t readAddress = sbufReadU32(src);
+    uint16_t readLength;
+    bool allowCompression = false;
+    bool useLegacyFormat;
+    uint32_t streamLength = 0;
+    if (dataSize >= sizeof(uint32_t) + sizeof(uint16_t)) {
+        readLength = sbufReadU16(src);
+        if (sbufBytesRemaining(src)) {
+            allowCompression = sbufReadU8(src);
+        }
+        if (sbufBytesRemaining(src) >= 4) {
+            // total number of bytes to stream, each further reply is pushed as soon as the TX buffer has room for it
+            streamLength = sbufReadU32(src);
+        }
+        useLegacyFormat = false;
+    } else {
+        readLength = 128;
+        useLegacyFormat = true;
+    }
+
+    // A stream in progress on another port keeps the stream state, this read is answered with a single reply
+    if (streamLength && mspSerialIsStreaming(mspDataflashStreamNext)) {
+        streamLength = 0;
+    }
+
+    const uint32_t endAddress = streamLength ? readAddress + streamLength : flashfsGetSize();
+    const uint32_t bytesConsumed = mspDataflashSerializeReadReply(dst, readAddress, readLength, endAddress, useLegacyFormat, allowCompression);
+
+    if (streamLength > bytesConsumed && bytesConsumed > 0) {
+        dataflashStream.descriptor = srcDesc;
+        dataflashStream.address = readAddress + bytesConsumed;
+        dataflashStream.endAddress = endAddress;
+        dataflashStream.frameLength = readLength;
+        dataflashStream.allowCompression = allowCompression;
+
+        mspSerialStartStream(srcDesc, mspDataflashStreamNext);
+    }
+    return MSP_RESULT_ACK;
+}
+
+#endif // USE_FLASHFS
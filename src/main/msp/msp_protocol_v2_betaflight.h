@@ -0,0 +1,91 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// MSPv2 commands, these have 16 bit command IDs and can only be sent in MSPv2 frames
+
+#define MSP2_BETAFLIGHT_BATCH               0x3000  //in/out message     run a list of commands, reply with all of their replies
+#define MSP2_BETAFLIGHT_BATCH_SUBSCRIBE     0x3001  //in message         push the reply to a MSP2_BETAFLIGHT_BATCH request at a fixed rate
+#define MSP2_BETAFLIGHT_SUBSCRIBE           0x3002  //in message         push the replies to commands at fixed rates
+#define MSP2_BETAFLIGHT_CONFIG_SNAPSHOT     0x3003  //in/out message     read a chunk of the binary config snapshot
+#define MSP2_BETAFLIGHT_CONFIG_DELTA        0x3004  //in message         patch the config in RAM
+#define MSP2_BETAFLIGHT_FLIGHT_STATS        0x3005  //out message        statistics of the current or last flight
+#define MSP2_BETAFLIGHT_OSD_FONT_WRITE      0x3006  //in/out message     queue OSD font glyphs, reply with the upload progress
+
+/*
+ * MSP2_BETAFLIGHT_BATCH request, repeated for each command:
+ *   U16 command, U8 argument size, arguments
+ *
+ * Reply, repeated for each command in the order requested:
+ *   U16 command, U8 result (1 = ok, 0xFF = error), U8 reply size, reply
+ *
+ * Only commands that have small replies can be batched, e.g. MSP_STATUS_EX, MSP_ATTITUDE, MSP_ANALOG, MSP_RC.
+ * The reply stops at the first command that doesn't fit into the reply buffer, the client can ask for the rest in a
+ * further batch.
+ *
+ * MSP2_BETAFLIGHT_BATCH_SUBSCRIBE request:
+ *   U16 interval in ms, 0 to unsubscribe, followed by a MSP2_BETAFLIGHT_BATCH request
+ *
+ * The replies are pushed as MSP2_BETAFLIGHT_BATCH replies, without any further requests.
+ *
+ * MSP2_BETAFLIGHT_SUBSCRIBE request:
+ *   U16 maximum bytes per second of pushed replies on this port, 0 for no limit, followed by, for each command:
+ *   U16 command, U16 interval in ms, 0 to unsubscribe
+ *
+ * Any command that can be batched can be subscribed to, as can MSP2_BETAFLIGHT_BATCH itself (using the request of the
+ * last MSP2_BETAFLIGHT_BATCH_SUBSCRIBE). Replies are only pushed while there is room for them in the TX buffer.
+ *
+ * MSP2_BETAFLIGHT_CONFIG_SNAPSHOT request:
+ *   U32 offset, optionally followed by U16 maximum chunk size
+ *
+ * Reply:
+ *   U32 snapshot size, U16 snapshot CRC, U32 offset, chunk
+ *
+ * The snapshot is all of the PGs in RAM, in the layout used to save them, for each PG:
+ *   U16 record size (including this header), U16 pgn, U8 version, U8 flags, PG
+ * The CRC is a CRC16 CCITT, with an initial value of 0xFFFF, of the whole snapshot. A client reads the snapshot chunk
+ * by chunk until it has the snapshot size, and if the CRC of what it has read doesn't match the CRC in the last reply
+ * the config changed while it was reading, so it starts again.
+ *
+ * MSP2_BETAFLIGHT_CONFIG_DELTA request:
+ *   U16 CRC, then for each patch: U16 pgn, U8 version, U16 offset, U8 size, data
+ *
+ * The CRC is a CRC16 CCITT, with an initial value of 0xFFFF, of the patches. Each patch overwrites part of a PG, for
+ * the bytes that differ from the snapshot. A request is applied as a whole, or not at all if armed, if the CRC doesn't
+ * match or if any patch is for an unknown PG, is for a different version or lies outside of the PG. Larger deltas are
+ * sent as several requests. As with the other set commands the changes are kept in RAM until MSP_EEPROM_WRITE.
+ *
+ * MSP2_BETAFLIGHT_FLIGHT_STATS reply:
+ *   U8 number of statistics, then for each (flightStat_e order): U32 count, S32 min, S32 max, S32 mean, S32 percentile
+ *
+ * The statistics are reset on arming and kept after disarming, until the next arm.
+ *
+ * MSP2_BETAFLIGHT_OSD_FONT_WRITE request, repeated for each glyph, or empty to only read the progress:
+ *   U16 character address, 54 bytes of glyph data as for MSP_OSD_CHAR_WRITE
+ *
+ * Reply:
+ *   U8 glyphs accepted from this request, U8 free queue slots, U16 glyphs queued, U16 glyphs programmed
+ *
+ * The glyphs are queued and programmed into the MAX7456 NVM in the background, taking about 12ms each, so a client
+ * sends as many as there are free slots and polls for the rest. Glyphs beyond a full queue, or sent while armed, are
+ * not accepted and have to be sent again. The queued and programmed counts are since power on, the upload is done
+ * when they are equal. The display is disabled while glyphs are being programmed.
+ */
@@ -28,6 +28,7 @@
 
 #include "cli/cli.h"
 
+#include "common/maths.h"
 #include "common/streambuf.h"
 #include "common/utils.h"
 #include "common/crc.h"
@@ -38,11 +39,14 @@
 #include "io/displayport_msp.h"
 
 #include "msp/msp.h"
+#include "msp/msp_protocol_v2_betaflight.h"
 
 #include "msp_serial.h"
 
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
 
+static uint8_t mspSerialOutBuf[MSP_PORT_OUTBUF_SIZE];
+
 static void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort, bool sharedWithTelemetry)
 {
     memset(mspPortToReset, 0, sizeof(mspPort_t));
@@ -298,6 +302,18 @@ static int mspSerialSendFrame(mspPort_t *msp, const uint8_t * hdr, int hdrLen, c
     if (!isSerialTransmitBufferEmpty(msp->port) && ((int)serialTxBytesFree(msp->port) < totalFrameLength))
         return 0;
 
+    // Copy the frame straight into the TX buffer if it fits without wrapping
+    uint32_t txBufferLength;
+    uint8_t *txBuffer = serialReserveTxBuffer(msp->port, &txBufferLength);
+    if (txBuffer && (int)txBufferLength >= totalFrameLength) {
+        memcpy(txBuffer, hdr, hdrLen);
+        memcpy(txBuffer + hdrLen, data, dataLen);
+        memcpy(txBuffer + hdrLen + dataLen, crc, crcLen);
+        serialCommitTxBuffer(msp->port, totalFrameLength);
+
+        return totalFrameLength;
+    }
+
     // Transmit frame
     serialBeginWrite(msp->port);
     serialWriteBuf(msp->port, hdr, hdrLen);
@@ -308,17 +324,18 @@ static int mspSerialSendFrame(mspPort_t *msp, const uint8_t * hdr, int hdrLen, c
     return totalFrameLength;
 }
 
-static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e mspVersion)
+/*
+ * Write the frame header into hdrBuf, returns its length.
+ */
+static int mspSerialEncodeHeader(uint8_t *hdrBuf, const mspPacket_t *packet, int dataLen, mspVersion_e mspVersion)
 {
     static const uint8_t mspMagic[MSP_VERSION_COUNT] = MSP_VERSION_MAGIC_INITIALIZER;
-    const int dataLen = sbufBytesRemaining(&packet->buf);
-    uint8_t hdrBuf[16] = { '$', mspMagic[mspVersion], packet->result == MSP_RESULT_ERROR ? '!' : '>'};
-    uint8_t crcBuf[2];
-    uint8_t checksum;
-    int hdrLen = 3;
-    int crcLen = 0;
+    int hdrLen = 0;
+
+    hdrBuf[hdrLen++] = '$';
+    hdrBuf[hdrLen++] = mspMagic[mspVersion];
+    hdrBuf[hdrLen++] = packet->result == MSP_RESULT_ERROR ? '!' : '>';
 
-    #define V1_CHECKSUM_STARTPOS 3
     if (mspVersion == MSP_V1) {
         mspHeaderV1_t * hdrV1 = (mspHeaderV1_t *)&hdrBuf[hdrLen];
         hdrLen += sizeof(mspHeaderV1_t);
@@ -335,11 +352,6 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
         else {
             hdrV1->size = dataLen;
         }
-
-        // Pre-calculate CRC
-        checksum = mspSerialChecksumBuf(0, hdrBuf + V1_CHECKSUM_STARTPOS, hdrLen - V1_CHECKSUM_STARTPOS);
-        checksum = mspSerialChecksumBuf(checksum, sbufPtr(&packet->buf), dataLen);
-        crcBuf[crcLen++] = checksum;
     }
     else if (mspVersion == MSP_V2_OVER_V1) {
         mspHeaderV1_t * hdrV1 = (mspHeaderV1_t *)&hdrBuf[hdrLen];
@@ -368,17 +380,6 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
         hdrV2->flags = packet->flags;
         hdrV2->cmd = packet->cmd;
         hdrV2->size = dataLen;
-
-        // V2 CRC: only V2 header + data payload
-        checksum = crc8_dvb_s2_update(0, (uint8_t *)hdrV2, sizeof(mspHeaderV2_t));
-        checksum = crc8_dvb_s2_update(checksum, sbufPtr(&packet->buf), dataLen);
-        crcBuf[crcLen++] = checksum;
-
-        // V1 CRC: All headers + data payload + V2 CRC byte
-        checksum = mspSerialChecksumBuf(0, hdrBuf + V1_CHECKSUM_STARTPOS, hdrLen - V1_CHECKSUM_STARTPOS);
-        checksum = mspSerialChecksumBuf(checksum, sbufPtr(&packet->buf), dataLen);
-        checksum = mspSerialChecksumBuf(checksum, crcBuf, crcLen);
-        crcBuf[crcLen++] = checksum;
     }
     else if (mspVersion == MSP_V2_NATIVE) {
         mspHeaderV2_t * hdrV2 = (mspHeaderV2_t *)&hdrBuf[hdrLen];
@@ -387,26 +388,66 @@ static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e msp
         hdrV2->flags = packet->flags;
         hdrV2->cmd = packet->cmd;
         hdrV2->size = dataLen;
-
-        checksum = crc8_dvb_s2_update(0, (uint8_t *)hdrV2, sizeof(mspHeaderV2_t));
-        checksum = crc8_dvb_s2_update(checksum, sbufPtr(&packet->buf), dataLen);
-        crcBuf[crcLen++] = checksum;
     }
     else {
         // Shouldn't get here
         return 0;
     }
 
+    return hdrLen;
+}
+
+/*
+ * Write the frame checksums into crcBuf, returns their length.
+ */
+static int mspSerialEncodeChecksum(uint8_t *crcBuf, const uint8_t *hdrBuf, int hdrLen, const uint8_t *data, int dataLen, mspVersion_e mspVersion)
+{
+    uint8_t checksum;
+    int crcLen = 0;
+
+    #define V1_CHECKSUM_STARTPOS 3
+    if (mspVersion == MSP_V2_OVER_V1 || mspVersion == MSP_V2_NATIVE) {
+        // V2 CRC: only V2 header + data payload
+        const uint8_t *hdrV2 = hdrBuf + 3 + (mspVersion == MSP_V2_OVER_V1 ? sizeof(mspHeaderV1_t) : 0);
+        checksum = crc8_dvb_s2_update(0, hdrV2, sizeof(mspHeaderV2_t));
+        checksum = crc8_dvb_s2_update(checksum, data, dataLen);
+        crcBuf[crcLen++] = checksum;
+    }
+    if (mspVersion == MSP_V1 || mspVersion == MSP_V2_OVER_V1) {
+        // V1 CRC: All headers + data payload + V2 CRC byte
+        checksum = mspSerialChecksumBuf(0, hdrBuf + V1_CHECKSUM_STARTPOS, hdrLen - V1_CHECKSUM_STARTPOS);
+        checksum = mspSerialChecksumBuf(checksum, data, dataLen);
+        checksum = mspSerialChecksumBuf(checksum, crcBuf, crcLen);
+        crcBuf[crcLen++] = checksum;
+    }
+
+    return crcLen;
+}
+
+static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e mspVersion)
+{
+    const int dataLen = sbufBytesRemaining(&packet->buf);
+    uint8_t hdrBuf[16];
+    uint8_t crcBuf[2];
+
+    const int hdrLen = mspSerialEncodeHeader(hdrBuf, packet, dataLen, mspVersion);
+    if (!hdrLen) {
+        return 0;
+    }
+    const int crcLen = mspSerialEncodeChecksum(crcBuf, hdrBuf, hdrLen, sbufPtr(&packet->buf), dataLen, mspVersion);
+
     // Send the frame
     return mspSerialSendFrame(msp, hdrBuf, hdrLen, sbufPtr(&packet->buf), dataLen, crcBuf, crcLen);
 }
 
-static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+/*
+ * Process the command and send the reply, returns the length of the frame sent, zero if there was no reply or it didn't
+ * fit into the TX buffer.
+ */
+static int mspSerialProcessCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn, mspPacket_t *command, mspVersion_e mspVersion, mspPostProcessFnPtr *mspPostProcessFn)
 {
-    static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
-
     mspPacket_t reply = {
-        .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
+        .buf = { .ptr = mspSerialOutBuf, .end = ARRAYEND(mspSerialOutBuf), },
         .cmd = -1,
         .flags = 0,
         .result = 0,
@@ -414,6 +455,17 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     };
     uint8_t *outBufHead = reply.buf.ptr;
 
+    const mspResult_e status = mspProcessCommandFn(msp->descriptor, command, &reply, mspPostProcessFn);
+
+    if (status != MSP_RESULT_NO_REPLY) {
+        sbufSwitchToReader(&reply.buf, outBufHead); // change streambuf direction
+        return mspSerialEncode(msp, &reply, mspVersion);
+    }
+    return 0;
+}
+
+static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
     mspPacket_t command = {
         .buf = { .ptr = msp->inBuf, .end = msp->inBuf + msp->dataSize, },
         .cmd = msp->cmdMSP,
@@ -423,14 +475,169 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     };
 
     mspPostProcessFnPtr mspPostProcessFn = NULL;
-    const mspResult_e status = mspProcessCommandFn(msp->descriptor, &command, &reply, &mspPostProcessFn);
+    mspSerialProcessCommand(msp, mspProcessCommandFn, &command, msp->mspVersion, &mspPostProcessFn);
 
-    if (status != MSP_RESULT_NO_REPLY) {
-        sbufSwitchToReader(&reply.buf, outBufHead); // change streambuf direction
+    return mspPostProcessFn;
+}
+
+#define MSP_STREAM_MIN_FRAME_SIZE   64
+
+/*
+ * Reserve space in the TX buffer for a frame that doesn't need a jumbo header, returns the space for its payload and
+ * sets *hdrLen to the length of its header, or returns NULL if there isn't room for MSP_STREAM_MIN_FRAME_SIZE.
+ */
+static uint8_t *mspSerialReserveFrame(mspPort_t *msp, int *hdrLen, int *maxDataLen)
+{
+    int crcLen;
+    int jumboDataLen;
+
+    switch (msp->mspVersion) {
+    case MSP_V1:
+        *hdrLen = 3 + sizeof(mspHeaderV1_t);
+        crcLen = 1;
+        jumboDataLen = JUMBO_FRAME_SIZE_LIMIT;
+        break;
+    case MSP_V2_OVER_V1:
+        *hdrLen = 3 + sizeof(mspHeaderV1_t) + sizeof(mspHeaderV2_t);
+        crcLen = 2;
+        jumboDataLen = JUMBO_FRAME_SIZE_LIMIT - sizeof(mspHeaderV2_t) - 1;
+        break;
+    case MSP_V2_NATIVE:
+    default:
+        *hdrLen = 3 + sizeof(mspHeaderV2_t);
+        crcLen = 1;
+        jumboDataLen = INT16_MAX;
+        break;
+    }
+
+    uint32_t txBufferLength;
+    uint8_t *txBuffer = serialReserveTxBuffer(msp->port, &txBufferLength);
+    *maxDataLen = MIN((int)txBufferLength - *hdrLen - crcLen, jumboDataLen - 1);
+    if (!txBuffer || *maxDataLen < MSP_STREAM_MIN_FRAME_SIZE) {
+        return NULL;
+    }
+    return txBuffer + *hdrLen;
+}
+
+/*
+ * Send further frames of a streamed reply for as long as they fit into the TX buffer, so that the client does not have
+ * to request (and wait for) each one of them. Any command received from the client ends the stream.
+ *
+ * Where the serial port allows it, the frames are serialised straight into the TX buffer.
+ */
+static void mspSerialProcessStream(mspPort_t *msp)
+{
+    while (msp->streamFn) {
+        mspPacket_t reply = {
+            .cmd = -1,
+            .flags = 0,
+            .result = MSP_RESULT_ACK,
+            .direction = MSP_DIRECTION_REPLY,
+        };
+
+        int hdrLen;
+        int maxDataLen;
+        uint8_t *data = mspSerialReserveFrame(msp, &hdrLen, &maxDataLen);
+        if (data) {
+            sbufInit(&reply.buf, data, data + maxDataLen);
+
+            if (!msp->streamFn(msp->descriptor, &reply)) {
+                msp->streamFn = NULL;
+                return;
+            }
+
+            const int dataLen = sbufPtr(&reply.buf) - data;
+            uint8_t *hdrBuf = data - hdrLen;
+            mspSerialEncodeHeader(hdrBuf, &reply, dataLen, msp->mspVersion);
+            const int crcLen = mspSerialEncodeChecksum(data + dataLen, hdrBuf, hdrLen, data, dataLen, msp->mspVersion);
+            serialCommitTxBuffer(msp->port, hdrLen + dataLen + crcLen);
+            continue;
+        }
+
+        // leave room for the headers and checksums
+        const int payloadFree = (int)serialTxBytesFree(msp->port) - MSP_MAX_HEADER_SIZE - 2;
+        if (payloadFree < MSP_STREAM_MIN_FRAME_SIZE) {
+            return;
+        }
+
+        sbufInit(&reply.buf, mspSerialOutBuf, mspSerialOutBuf + MIN((int)sizeof(mspSerialOutBuf), payloadFree));
+        uint8_t *outBufHead = reply.buf.ptr;
+
+        if (!msp->streamFn(msp->descriptor, &reply)) {
+            msp->streamFn = NULL;
+            return;
+        }
+
+        sbufSwitchToReader(&reply.buf, outBufHead);
         mspSerialEncode(msp, &reply, msp->mspVersion);
     }
+}
 
-    return mspPostProcessFn;
+#define MSP_SUBSCRIPTION_MIN_TX_FREE    32
+#define MSP_SUBSCRIPTION_MAX_BURST_MS   100
+
+/*
+ * Push the replies to the port's subscriptions when they are due. Nothing is serialised while the TX buffer is short of
+ * space, or while the port is over its rate limit, any subscriptions that are due are pushed on a later call.
+ */
+static void mspSerialProcessSubscriptions(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
+    if (!msp->subscriptionCount || msp->streamFn) {
+        return;
+    }
+
+    const timeMs_t currentTimeMs = millis();
+
+    if (msp->subscriptionMaxBytesPerSecond) {
+        // bytes per second * ms is bytes * 1000
+        const int32_t maxBudget = msp->subscriptionMaxBytesPerSecond * MSP_SUBSCRIPTION_MAX_BURST_MS;
+        const timeMs_t elapsedMs = MIN(currentTimeMs - msp->subscriptionBudgetUpdateMs, (timeMs_t)MSP_SUBSCRIPTION_MAX_BURST_MS);
+        const int32_t budget = msp->subscriptionBudget + (int32_t)elapsedMs * msp->subscriptionMaxBytesPerSecond;
+        msp->subscriptionBudget = MIN(budget, maxBudget);
+        msp->subscriptionBudgetUpdateMs = currentTimeMs;
+    }
+
+    for (int i = 0; i < msp->subscriptionCount; i++) {
+        const int index = (msp->nextSubscription + i) % msp->subscriptionCount;
+        mspSubscription_t *subscription = &msp->subscriptions[index];
+
+        const timeMs_t sinceLastPushMs = currentTimeMs - subscription->lastPushMs;
+        if (sinceLastPushMs < subscription->intervalMs) {
+            continue;
+        }
+
+        if ((msp->subscriptionMaxBytesPerSecond && msp->subscriptionBudget <= 0) || serialTxBytesFree(msp->port) < MSP_SUBSCRIPTION_MIN_TX_FREE) {
+            return;
+        }
+
+        mspPacket_t command = {
+            .buf = { .ptr = msp->batchRequest, .end = msp->batchRequest, },
+            .cmd = subscription->cmd,
+            .flags = 0,
+            .result = 0,
+            .direction = MSP_DIRECTION_REQUEST,
+        };
+        if (subscription->cmd == MSP2_BETAFLIGHT_BATCH) {
+            command.buf.end += msp->batchRequestSize;
+        }
+
+        mspPostProcessFnPtr mspPostProcessFn = NULL;
+        const int frameLength = mspSerialProcessCommand(msp, mspProcessCommandFn, &command, msp->subscriptionMspVersion, &mspPostProcessFn);
+        if (!frameLength) {
+            // didn't fit into the TX buffer
+            return;
+        }
+
+        if (sinceLastPushMs < 2 * (timeMs_t)subscription->intervalMs) {
+            // keep to the interval on average
+            subscription->lastPushMs += subscription->intervalMs;
+        } else {
+            // fallen behind, don't try to catch up
+            subscription->lastPushMs = currentTimeMs;
+        }
+        msp->subscriptionBudget -= frameLength * 1000;
+        msp->nextSubscription = (index + 1) % msp->subscriptionCount;
+    }
 }
 
 static void mspEvaluateNonMspData(mspPort_t * mspPort, uint8_t receivedChar)
@@ -523,6 +730,7 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
 
                 if (mspPort->c_state == MSP_COMMAND_RECEIVED) {
                     if (mspPort->packetType == MSP_PACKET_COMMAND) {
+                        mspPort->streamFn = NULL;
                         mspPostProcessFn = mspSerialProcessReceivedCommand(mspPort, mspProcessCommandFn);
                     } else if (mspPort->packetType == MSP_PACKET_REPLY) {
                         mspSerialProcessReceivedReply(mspPort, mspProcessReplyFn);
@@ -540,6 +748,8 @@ void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessComm
         }
         else {
             mspProcessPendingRequest(mspPort);
+            mspSerialProcessStream(mspPort);
+            mspSerialProcessSubscriptions(mspPort, mspProcessCommandFn);
         }
     }
 }
@@ -588,6 +798,107 @@ int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direct
     return ret; // return the number of bytes written
 }
 
+static mspPort_t *mspSerialFindPort(mspDescriptor_t descriptor)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+
+        if (mspPort->port && mspPort->descriptor == descriptor) {
+            return mspPort;
+        }
+    }
+    return NULL; // not a serial MSP client, e.g. MSP over telemetry
+}
+
+bool mspSerialStartStream(mspDescriptor_t descriptor, mspStreamFnPtr streamFn)
+{
+    mspPort_t *mspPort = mspSerialFindPort(descriptor);
+    if (!mspPort) {
+        return false;
+    }
+
+    mspPort->streamFn = streamFn;
+    return true;
+}
+
+// Returns true if a port is sending a stream from streamFn
+bool mspSerialIsStreaming(mspStreamFnPtr streamFn)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        const mspPort_t *mspPort = &mspPorts[portIndex];
+
+        if (mspPort->port && mspPort->streamFn == streamFn) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Push the reply to cmd every intervalMs, without a request. An interval of zero ends the subscription.
+ * Returns false if there is no room for another subscription.
+ */
+bool mspSerialSubscribe(mspDescriptor_t descriptor, uint16_t cmd, uint16_t intervalMs)
+{
+    mspPort_t *mspPort = mspSerialFindPort(descriptor);
+    if (!mspPort) {
+        return false;
+    }
+
+    int index = 0;
+    while (index < mspPort->subscriptionCount && mspPort->subscriptions[index].cmd != cmd) {
+        index++;
+    }
+
+    if (!intervalMs) {
+        if (index < mspPort->subscriptionCount) {
+            mspPort->subscriptionCount--;
+            memmove(&mspPort->subscriptions[index], &mspPort->subscriptions[index + 1], (mspPort->subscriptionCount - index) * sizeof(mspSubscription_t));
+            mspPort->nextSubscription = 0;
+        }
+        return true;
+    }
+
+    if (index == MSP_MAX_SUBSCRIPTIONS) {
+        return false;
+    }
+    if (index == mspPort->subscriptionCount) {
+        mspPort->subscriptionCount++;
+    }
+
+    mspSubscription_t *subscription = &mspPort->subscriptions[index];
+    subscription->cmd = cmd;
+    subscription->intervalMs = intervalMs;
+    subscription->lastPushMs = millis() - intervalMs; // push the first reply straight away
+    // subscriptions are made in MSPv2 frames, as the command IDs don't fit into MSPv1
+    mspPort->subscriptionMspVersion = mspPort->mspVersion;
+    return true;
+}
+
+bool mspSerialSetSubscriptionRateLimit(mspDescriptor_t descriptor, uint16_t maxBytesPerSecond)
+{
+    mspPort_t *mspPort = mspSerialFindPort(descriptor);
+    if (!mspPort) {
+        return false;
+    }
+
+    mspPort->subscriptionMaxBytesPerSecond = maxBytesPerSecond;
+    mspPort->subscriptionBudget = 0;
+    mspPort->subscriptionBudgetUpdateMs = millis();
+    return true;
+}
+
+bool mspSerialSetBatchRequest(mspDescriptor_t descriptor, const uint8_t *request, int requestSize)
+{
+    mspPort_t *mspPort = mspSerialFindPort(descriptor);
+    if (!mspPort || requestSize > MSP_BATCH_MAX_REQUEST_SIZE) {
+        return false;
+    }
+
+    memcpy(mspPort->batchRequest, request, requestSize);
+    mspPort->batchRequestSize = requestSize;
+    return true;
+}
 
 uint32_t mspSerialTxBytesFree(void)
 {
@@ -94,6 +94,15 @@ typedef struct __attribute__((packed)) {
 
 #define MSP_MAX_HEADER_SIZE     9
 
+#define MSP_MAX_SUBSCRIPTIONS       8
+#define MSP_BATCH_MAX_REQUEST_SIZE  48
+
+typedef struct mspSubscription_s {
+    uint16_t cmd;
+    uint16_t intervalMs;
+    timeMs_t lastPushMs;
+} mspSubscription_t;
+
 struct serialPort_s;
 typedef struct mspPort_s {
     struct serialPort_s *port; // null when port unused.
@@ -112,6 +121,16 @@ typedef struct mspPort_s {
     bool sharedWithTelemetry;
     mspDescriptor_t descriptor;
     bool isDisplayPort;
+    mspStreamFnPtr streamFn; // non-NULL while a streamed reply is being sent
+    mspSubscription_t subscriptions[MSP_MAX_SUBSCRIPTIONS]; // replies pushed without a request
+    uint8_t subscriptionCount;
+    uint8_t nextSubscription; // where the next search for a due subscription starts, so that they share a busy link
+    mspVersion_e subscriptionMspVersion;
+    uint16_t subscriptionMaxBytesPerSecond; // zero for no limit
+    int32_t subscriptionBudget; // in bytes * 1000
+    timeMs_t subscriptionBudgetUpdateMs;
+    uint8_t batchRequestSize; // the request for a subscription to MSP2_BETAFLIGHT_BATCH
+    uint8_t batchRequest[MSP_BATCH_MAX_REQUEST_SIZE];
 } mspPort_t;
 
 void mspSerialInit(void);
@@ -122,3 +141,8 @@ void mspSerialReleasePortIfAllocated(struct serialPort_s *serialPort);
 void mspSerialReleaseSharedTelemetryPorts(void);
 int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direction);
 uint32_t mspSerialTxBytesFree(void);
+bool mspSerialStartStream(mspDescriptor_t descriptor, mspStreamFnPtr streamFn);
+bool mspSerialIsStreaming(mspStreamFnPtr streamFn);
+bool mspSerialSubscribe(mspDescriptor_t descriptor, uint16_t cmd, uint16_t intervalMs);
+bool mspSerialSetSubscriptionRateLimit(mspDescriptor_t descriptor, uint16_t maxBytesPerSecond);
+bool mspSerialSetBatchRequest(mspDescriptor_t descriptor, const uint8_t *request, int requestSize);
@@ -58,6 +58,7 @@
 #include "drivers/sdcard.h"
 #include "drivers/time.h"
 
+#include "fc/flight_stats.h"
 #include "fc/rc_controls.h"
 #include "fc/rc_modes.h"
 #include "fc/runtime_config.h"
@@ -153,10 +154,12 @@ const osd_stats_e osdStatsDisplayOrder[OSD_STAT_COUNT] = {
     OSD_STAT_BATTERY,
     OSD_STAT_MIN_RSSI,
     OSD_STAT_MAX_CURRENT,
+    OSD_STAT_P95_CURRENT,
     OSD_STAT_USED_MAH,
     OSD_STAT_BLACKBOX,
     OSD_STAT_BLACKBOX_NUMBER,
     OSD_STAT_MAX_G_FORCE,
+    OSD_STAT_MAX_GYRO_RATE,
     OSD_STAT_MAX_ESC_TEMP,
     OSD_STAT_MAX_ESC_RPM,
     OSD_STAT_MIN_LINK_QUALITY,
@@ -227,10 +230,9 @@ void changeOsdProfileIndex(uint8_t profileIndex)
 
 static void osdDrawElements(timeUs_t currentTimeUs)
 {
-    displayClearScreen(osdDisplayPort);
-
     // Hide OSD when OSDSW mode is active
     if (IS_RC_MODE_ACTIVE(BOXOSD)) {
+        displayClearScreen(osdDisplayPort);
         return;
     }
 
@@ -382,7 +384,6 @@ bool osdInitialized(void)
 
 static void osdResetStats(void)
 {
-    stats.max_current  = 0;
     stats.max_speed    = 0;
     stats.min_voltage  = 5000;
     stats.end_voltage  = 0;
@@ -392,7 +393,6 @@ static void osdResetStats(void)
     stats.armed_time   = 0;
     stats.max_g_force  = 0;
     stats.max_esc_temp = 0;
-    stats.max_esc_rpm  = 0;
     stats.min_link_quality =  (linkQualitySource == LQ_SOURCE_RX_PROTOCOL_CRSF) ? 300 : 99; // CRSF  : percent
     stats.min_rssi_dbm = 0;
 }
@@ -417,11 +417,6 @@ static void osdUpdateStats(void)
         stats.min_voltage = value;
     }
 
-    value = getAmperage() / 100;
-    if (stats.max_current < value) {
-        stats.max_current = value;
-    }
-
     value = getRssiPercent();
     if (stats.min_rssi > value) {
         stats.min_rssi = value;
@@ -465,10 +460,6 @@ static void osdUpdateStats(void)
         if (stats.max_esc_temp < value) {
             stats.max_esc_temp = value;
         }
-        value = calcEscRpm(osdEscDataCombined->rpm);
-        if (stats.max_esc_rpm < value) {
-            stats.max_esc_rpm = value;
-        }
     }
 #endif
 }
@@ -624,12 +615,20 @@ static bool osdDisplayStat(int statistic, uint8_t displayRow)
 
     case OSD_STAT_MAX_CURRENT:
         if (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) {
-            tfp_sprintf(buff, "%d%c", stats.max_current, SYM_AMP);
+            tfp_sprintf(buff, "%d%c", flightStatsGet(FLIGHT_STAT_CURRENT)->max / 100, SYM_AMP);
             osdDisplayStatisticLabel(displayRow, "MAX CURRENT", buff);
             return true;
         }
         break;
 
+    case OSD_STAT_P95_CURRENT:
+        if (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) {
+            tfp_sprintf(buff, "%d%c", flightStatsGet(FLIGHT_STAT_CURRENT)->percentile / 100, SYM_AMP);
+            osdDisplayStatisticLabel(displayRow, "P95 CURRENT", buff);
+            return true;
+        }
+        break;
+
     case OSD_STAT_USED_MAH:
         if (batteryConfig()->currentMeterSource != CURRENT_METER_NONE) {
             tfp_sprintf(buff, "%d%c", getMAhDrawn(), SYM_MAH);
@@ -667,6 +666,11 @@ static bool osdDisplayStat(int statistic, uint8_t displayRow)
         break;
 #endif
 
+    case OSD_STAT_MAX_GYRO_RATE:
+        tfp_sprintf(buff, "%dDPS", flightStatsGet(FLIGHT_STAT_GYRO_RATE)->max);
+        osdDisplayStatisticLabel(displayRow, "MAX GYRO RATE", buff);
+        return true;
+
 #ifdef USE_ESC_SENSOR
     case OSD_STAT_MAX_ESC_TEMP:
         tfp_sprintf(buff, "%d%c", osdConvertTemperatureToSelectedUnit(stats.max_esc_temp), osdGetTemperatureSymbolForSelectedUnit());
@@ -674,7 +678,7 @@ static bool osdDisplayStat(int statistic, uint8_t displayRow)
         return true;
 
     case OSD_STAT_MAX_ESC_RPM:
-        itoa(stats.max_esc_rpm, buff, 10);
+        itoa(flightStatsGet(FLIGHT_STAT_ESC_RPM)->max, buff, 10);
         osdDisplayStatisticLabel(displayRow, "MAX ESC RPM", buff);
         return true;
 #endif
@@ -170,6 +170,8 @@ typedef enum {
     OSD_STAT_TOTAL_TIME,
     OSD_STAT_TOTAL_DIST,
     OSD_STAT_MIN_RSSI_DBM,
+    OSD_STAT_P95_CURRENT,
+    OSD_STAT_MAX_GYRO_RATE,
     OSD_STAT_COUNT // MUST BE LAST
 } osd_stats_e;
 
@@ -227,6 +229,7 @@ typedef enum {
     OSD_DISPLAYPORT_DEVICE_AUTO,
     OSD_DISPLAYPORT_DEVICE_MAX7456,
     OSD_DISPLAYPORT_DEVICE_MSP,
+    OSD_DISPLAYPORT_DEVICE_VIRTUAL,
 } osdDisplayPortDevice_e;
 
 // Make sure the number of warnings do not exceed the available 32bit storage
@@ -280,13 +283,11 @@ typedef struct statistic_s {
     int16_t max_speed;
     int16_t min_voltage; // /100
     uint16_t end_voltage;
-    int16_t max_current; // /10
     uint8_t min_rssi;
     int32_t max_altitude;
     int16_t max_distance;
     float max_g_force;
     int16_t max_esc_temp;
-    int32_t max_esc_rpm;
     uint16_t min_link_quality;
     uint8_t min_rssi_dbm;
 } statistic_t;
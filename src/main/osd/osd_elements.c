@@ -36,6 +36,17 @@
     Add the mapping from the element ID added in the first step to the function
     created in the third step to the osdElementDrawFunction array.
 
+    Elements are only written to the display when their text changes. If the text
+    only depends on a few values, add a function returning them to the
+    osdElementInputsFunction array, so that the element is only formatted when they
+    change. Elements that draw themselves rather than filling in element->buff must
+    use osdElementWriteChar() and osdElementWriteString(), so that what they drew is
+    blanked before they draw again.
+
+    Elements are drawn on every refresh, as time allows. If the element changes slowly,
+    give it a low tier and a refresh interval in the osdElementRefresh array. If it
+    must not miss a refresh, give it the high tier.
+
     If the new element utilizes the accelerometer, add it to the osdElementsNeedAccelerometer() function.
 
     Finally add a CLI parameter for the new element in cli/settings.c.
@@ -111,6 +122,130 @@
 #define AH_SIDEBAR_WIDTH_POS 7
 #define AH_SIDEBAR_HEIGHT_POS 3
 
+#ifdef USE_ACC
+/*
+ * Artificial horizon tables, so that drawing it takes a few lookups per column. The horizon is positioned in steps of
+ * one glyph (AH_SYMBOL_COUNT steps per row), over AH_LADDER_STEPS steps from the top of the element.
+ */
+#define AH_TABLE_DEGREES 91 // 0 to 90, the range of osd_ah_max_pit and osd_ah_max_rol
+#define AH_COLUMNS 4        // either side of the centre
+#define AH_LADDER_STEPS 82
+
+// Steps the horizon rises at each column right of the centre for each whole degree of roll, (degrees * 10 * column) / 64
+static const int8_t ahRollRise[AH_TABLE_DEGREES][AH_COLUMNS] = {
+    {  0,  0,  0,  0 },  // 0
+    {  0,  0,  0,  0 },  // 1
+    {  0,  0,  0,  1 },  // 2
+    {  0,  0,  1,  1 },  // 3
+    {  0,  1,  1,  2 },  // 4
+    {  0,  1,  2,  3 },  // 5
+    {  0,  1,  2,  3 },  // 6
+    {  1,  2,  3,  4 },  // 7
+    {  1,  2,  3,  5 },  // 8
+    {  1,  2,  4,  5 },  // 9
+    {  1,  3,  4,  6 },  // 10
+    {  1,  3,  5,  6 },  // 11
+    {  1,  3,  5,  7 },  // 12
+    {  2,  4,  6,  8 },  // 13
+    {  2,  4,  6,  8 },  // 14
+    {  2,  4,  7,  9 },  // 15
+    {  2,  5,  7, 10 },  // 16
+    {  2,  5,  7, 10 },  // 17
+    {  2,  5,  8, 11 },  // 18
+    {  2,  5,  8, 11 },  // 19
+    {  3,  6,  9, 12 },  // 20
+    {  3,  6,  9, 13 },  // 21
+    {  3,  6, 10, 13 },  // 22
+    {  3,  7, 10, 14 },  // 23
+    {  3,  7, 11, 15 },  // 24
+    {  3,  7, 11, 15 },  // 25
+    {  4,  8, 12, 16 },  // 26
+    {  4,  8, 12, 16 },  // 27
+    {  4,  8, 13, 17 },  // 28
+    {  4,  9, 13, 18 },  // 29
+    {  4,  9, 14, 18 },  // 30
+    {  4,  9, 14, 19 },  // 31
+    {  5, 10, 15, 20 },  // 32
+    {  5, 10, 15, 20 },  // 33
+    {  5, 10, 15, 21 },  // 34
+    {  5, 10, 16, 21 },  // 35
+    {  5, 11, 16, 22 },  // 36
+    {  5, 11, 17, 23 },  // 37
+    {  5, 11, 17, 23 },  // 38
+    {  6, 12, 18, 24 },  // 39
+    {  6, 12, 18, 25 },  // 40
+    {  6, 12, 19, 25 },  // 41
+    {  6, 13, 19, 26 },  // 42
+    {  6, 13, 20, 26 },  // 43
+    {  6, 13, 20, 27 },  // 44
+    {  7, 14, 21, 28 },  // 45
+    {  7, 14, 21, 28 },  // 46
+    {  7, 14, 22, 29 },  // 47
+    {  7, 15, 22, 30 },  // 48
+    {  7, 15, 22, 30 },  // 49
+    {  7, 15, 23, 31 },  // 50
+    {  7, 15, 23, 31 },  // 51
+    {  8, 16, 24, 32 },  // 52
+    {  8, 16, 24, 33 },  // 53
+    {  8, 16, 25, 33 },  // 54
+    {  8, 17, 25, 34 },  // 55
+    {  8, 17, 26, 35 },  // 56
+    {  8, 17, 26, 35 },  // 57
+    {  9, 18, 27, 36 },  // 58
+    {  9, 18, 27, 36 },  // 59
+    {  9, 18, 28, 37 },  // 60
+    {  9, 19, 28, 38 },  // 61
+    {  9, 19, 29, 38 },  // 62
+    {  9, 19, 29, 39 },  // 63
+    { 10, 20, 30, 40 },  // 64
+    { 10, 20, 30, 40 },  // 65
+    { 10, 20, 30, 41 },  // 66
+    { 10, 20, 31, 41 },  // 67
+    { 10, 21, 31, 42 },  // 68
+    { 10, 21, 32, 43 },  // 69
+    { 10, 21, 32, 43 },  // 70
+    { 11, 22, 33, 44 },  // 71
+    { 11, 22, 33, 45 },  // 72
+    { 11, 22, 34, 45 },  // 73
+    { 11, 23, 34, 46 },  // 74
+    { 11, 23, 35, 46 },  // 75
+    { 11, 23, 35, 47 },  // 76
+    { 12, 24, 36, 48 },  // 77
+    { 12, 24, 36, 48 },  // 78
+    { 12, 24, 37, 49 },  // 79
+    { 12, 25, 37, 50 },  // 80
+    { 12, 25, 37, 50 },  // 81
+    { 12, 25, 38, 51 },  // 82
+    { 12, 25, 38, 51 },  // 83
+    { 13, 26, 39, 52 },  // 84
+    { 13, 26, 39, 53 },  // 85
+    { 13, 26, 40, 53 },  // 86
+    { 13, 27, 40, 54 },  // 87
+    { 13, 27, 41, 55 },  // 88
+    { 13, 27, 41, 55 },  // 89
+    { 14, 28, 42, 56 },  // 90
+};
+
+// Row and glyph for each step, (row << 4) | (SYM_AH_BAR9_0 to SYM_AH_BAR9_8 - SYM_AH_BAR9_0)
+static const uint8_t ahLadder[AH_LADDER_STEPS] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x90,
+};
+
+// Steps the horizon drops for each whole degree of pitch, (degrees * 25) / osd_ah_max_pit.
+// Rebuilt when osd_ah_max_pit changes.
+static uint8_t ahPitchDrop[AH_TABLE_DEGREES];
+static uint8_t ahPitchDropMaxPitch = 0;
+#endif
+
 // Stick overlay size
 #define OSD_STICK_OVERLAY_WIDTH 7
 #define OSD_STICK_OVERLAY_HEIGHT 5
@@ -161,6 +296,121 @@ static uint32_t blinkBits[(OSD_ITEM_COUNT + 31) / 32];
 #define IS_BLINK(item) (blinkBits[(item) / 32] & (1 << ((item) % 32)))
 #define BLINK(item) (IS_BLINK(item) && blinkState)
 
+// Rather than clearing the screen and drawing every element on each refresh, only the elements whose text changed are
+// written, and only the cells that an element no longer covers are blanked. Elements that draw themselves record the
+// cells they wrote as spans, which are blanked before they are drawn again.
+#define OSD_REWRITE_INTERVAL_US     1000000 // every element is written again now and then, in case the display lost it
+#define OSD_DRAWN_SPAN_COUNT        80
+
+typedef struct osdElementCache_s {
+    uint32_t signature;     // the element's inputs, or a hash of its text
+    timeUs_t dueUs;         // when the element is next drawn
+    uint8_t x;
+    uint8_t y;
+    uint8_t length;         // of the text written
+    bool valid;
+    bool scheduled;         // dueUs is set
+    bool drawsItself;       // rather than filling in element->buff
+    bool rewrite;           // written again when next drawn, even if unchanged
+} osdElementCache_t;
+
+typedef struct osdSpan_s {
+    uint8_t x;
+    uint8_t y;
+    uint8_t length;
+} osdSpan_t;
+
+typedef struct osdSpanList_s {
+    uint8_t count;
+    bool overflow;
+    osdSpan_t spans[OSD_DRAWN_SPAN_COUNT];
+} osdSpanList_t;
+
+static osdElementCache_t osdElementCache[OSD_ITEM_COUNT];
+static osdSpanList_t osdDrawnSpans[2];
+static osdSpanList_t *osdPreviousSpans = &osdDrawnSpans[0];    // drawn by the last refresh
+static osdSpanList_t *osdCurrentSpans = &osdDrawnSpans[1];     // drawn by this one
+static bool osdRedrawAllPending = true;
+static uint16_t osdDisplayClearCount;
+static timeUs_t osdNextRewriteUs;
+
+// Each refresh draws the elements that are due, high tier ones first. Normal and low tier ones are only drawn while
+// the refresh is within OSD_ELEMENT_DRAW_BUDGET_US, taking turns so that those left over are drawn first next time.
+// A refresh that starts from a clear screen draws them all, so that none are left blank until the next one.
+#define OSD_ELEMENT_DRAW_BUDGET_US  100
+
+typedef enum {
+    OSD_TIER_NORMAL = 0,    // so that elements not in osdElementRefresh are normal tier, drawn on every refresh
+    OSD_TIER_HIGH,          // drawn on every refresh whatever the budget, as are elements that draw themselves
+    OSD_TIER_LOW,
+    OSD_TIER_COUNT
+} osdElementTier_e;
+
+typedef struct osdElementRefresh_s {
+    uint8_t tier;
+    uint16_t intervalMs;    // between draws, 0 for every refresh
+} osdElementRefresh_t;
+
+static unsigned osdTierNext[OSD_TIER_COUNT];    // index in activeOsdElementArray to start from
+
+static void osdRecordSpan(uint8_t x, uint8_t y, uint8_t length)
+{
+    osdSpanList_t *list = osdCurrentSpans;
+    if (list->count) {
+        osdSpan_t *last = &list->spans[list->count - 1];
+        if (last->y == y && last->x + last->length == x) {
+            last->length += length;
+            return;
+        }
+    }
+    if (list->count == OSD_DRAWN_SPAN_COUNT) {
+        list->overflow = true;
+        return;
+    }
+    osdSpan_t *span = &list->spans[list->count++];
+    span->x = x;
+    span->y = y;
+    span->length = length;
+}
+
+static bool osdSpansOverlap(const osdSpanList_t *list, uint8_t x, uint8_t y, uint8_t length)
+{
+    for (unsigned i = 0; i < list->count; i++) {
+        const osdSpan_t *span = &list->spans[i];
+        if (span->y == y && span->x < x + length && x < span->x + span->length) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void osdBlank(displayPort_t *osdDisplayPort, uint8_t x, uint8_t y, int length)
+{
+    char blanks[OSD_ELEMENT_BUFFER_LENGTH];
+    memset(blanks, ' ', sizeof(blanks) - 1);
+    blanks[sizeof(blanks) - 1] = '\0';
+
+    while (length > 0) {
+        const int count = MIN(length, (int)sizeof(blanks) - 1);
+        displayWrite(osdDisplayPort, x, y, blanks + sizeof(blanks) - 1 - count);
+        x += count;
+        length -= count;
+    }
+}
+
+// Elements that draw themselves must use these, rather than writing to the display directly
+static void osdElementWriteChar(const osdElementParms_t *element, uint8_t x, uint8_t y, uint8_t c)
+{
+    displayWriteChar(element->osdDisplayPort, x, y, c);
+    osdRecordSpan(x, y, 1);
+}
+
+static void osdElementWriteString(const osdElementParms_t *element, uint8_t x, uint8_t y, const char *s)
+{
+    displayWrite(element->osdDisplayPort, x, y, s);
+    osdRecordSpan(x, y, strlen(s));
+}
+
 #if defined(USE_ESC_SENSOR) || defined(USE_DSHOT_TELEMETRY)
 typedef int (*getEscRpmOrFreqFnPtr)(int i);
 
@@ -193,7 +443,7 @@ static void renderOsdEscRpmOrFreq(getEscRpmOrFreqFnPtr escFnPtr, osdElementParms
         const int rpm = MIN((*escFnPtr)(i),99999);
         const int len = tfp_sprintf(rpmStr, "%d", rpm);
         rpmStr[len] = '\0';
-        displayWrite(element->osdDisplayPort, x, y + i, rpmStr);
+        osdElementWriteString(element, x, y + i, rpmStr);
     }
     element->drawElement = false;
 }
@@ -327,10 +577,10 @@ static char osdGetTimerSymbol(osd_timer_source_e src)
 {
     switch (src) {
     case OSD_TIMER_SRC_ON:
-        return SYM_ON_M;
+        return (char)SYM_ON_M;
     case OSD_TIMER_SRC_TOTAL_ARMED:
     case OSD_TIMER_SRC_LAST_ARMED:
-        return SYM_FLY_M;
+        return (char)SYM_FLY_M;
     case OSD_TIMER_SRC_ON_OR_ARMED:
         return ARMING_FLAG(ARMED) ? SYM_FLY_M : SYM_ON_M;
     default:
@@ -371,7 +621,7 @@ void osdFormatTimer(char *buff, bool showSymbol, bool usePrecision, int timerInd
 static char osdGetBatterySymbol(int cellVoltage)
 {
     if (getBatteryState() == BATTERY_CRITICAL) {
-        return SYM_MAIN_BATT; // FIXME: currently the BAT- symbol, ideally replace with a battery with exclamation mark
+        return (char)SYM_MAIN_BATT; // FIXME: currently the BAT- symbol, ideally replace with a battery with exclamation mark
     } else {
         // Calculate a symbol offset using cell voltage over full cell voltage range
         const int symOffset = scaleRange(cellVoltage, batteryConfig()->vbatmincellvoltage, batteryConfig()->vbatmaxcellvoltage, 0, 8);
@@ -455,9 +705,9 @@ char osdGetSpeedToSelectedUnitSymbol(void)
 {
     switch (osdConfig()->units) {
     case OSD_UNIT_IMPERIAL:
-        return SYM_MPH;
+        return (char)SYM_MPH;
     default:
-        return SYM_KPH;
+        return (char)SYM_KPH;
     }
 }
 
@@ -465,9 +715,9 @@ char osdGetVarioToSelectedUnitSymbol(void)
 {
     switch (osdConfig()->units) {
     case OSD_UNIT_IMPERIAL:
-        return SYM_FTPS;
+        return (char)SYM_FTPS;
     default:
-        return SYM_MPS;
+        return (char)SYM_MPS;
     }
 }
 
@@ -497,7 +747,7 @@ static void osdElementAdjustmentRange(osdElementParms_t *element)
 }
 #endif // USE_OSD_ADJUSTMENTS
 
-static void osdElementAltitude(osdElementParms_t *element)
+static bool osdAltitudeIsAvailable(void)
 {
     bool haveBaro = false;
     bool haveGps = false;
@@ -507,7 +757,12 @@ static void osdElementAltitude(osdElementParms_t *element)
 #ifdef USE_GPS
     haveGps = sensors(SENSOR_GPS) && STATE(GPS_FIX);
 #endif // USE_GPS
-    if (haveBaro || haveGps) {
+    return haveBaro || haveGps;
+}
+
+static void osdElementAltitude(osdElementParms_t *element)
+{
+    if (osdAltitudeIsAvailable()) {
         osdFormatAltitudeString(element->buff, getEstimatedAltitudeCm());
     } else {
         element->buff[0] = SYM_ALTITUDE;
@@ -534,23 +789,34 @@ static void osdElementAntiGravity(osdElementParms_t *element)
 #ifdef USE_ACC
 static void osdElementArtificialHorizon(osdElementParms_t *element)
 {
-    // Get pitch and roll limits in tenths of degrees
-    const int maxPitch = osdConfig()->ahMaxPitch * 10;
-    const int maxRoll = osdConfig()->ahMaxRoll * 10;
+    // Get pitch and roll limits in whole degrees
+    const int maxPitch = osdConfig()->ahMaxPitch;
+    const int maxRoll = osdConfig()->ahMaxRoll;
     const int ahSign = osdConfig()->ahInvert ? -1 : 1;
-    const int rollAngle = constrain(attitude.values.roll * ahSign, -maxRoll, maxRoll);
-    int pitchAngle = constrain(attitude.values.pitch * ahSign, -maxPitch, maxPitch);
-    // Convert pitchAngle to y compensation value
-    // (maxPitch / 25) divisor matches previous settings of fixed divisor of 8 and fixed max AHI pitch angle of 20.0 degrees
-    if (maxPitch > 0) {
-        pitchAngle = ((pitchAngle * 25) / maxPitch);
+    const int rollAngle = constrain((attitude.values.roll * ahSign) / 10, -maxRoll, maxRoll);
+    const int pitchAngle = constrain((attitude.values.pitch * ahSign) / 10, -maxPitch, maxPitch);
+
+    if (maxPitch != ahPitchDropMaxPitch) {
+        // (maxPitch / 25) divisor matches previous settings of fixed divisor of 8 and fixed max AHI pitch angle of 20.0 degrees
+        for (int i = 1; i <= maxPitch; i++) {
+            ahPitchDrop[i] = (i * 25) / maxPitch;
+        }
+        ahPitchDropMaxPitch = maxPitch;
     }
-    pitchAngle -= 41; // 41 = 4 * AH_SYMBOL_COUNT + 5
+
+    // Step of the horizon at the centre column
+    const int centre = 41 - (pitchAngle < 0 ? -ahPitchDrop[-pitchAngle] : ahPitchDrop[pitchAngle]); // 41 = 4 * AH_SYMBOL_COUNT + 5
+    const int8_t *rise = ahRollRise[ABS(rollAngle)];
 
     for (int x = -4; x <= 4; x++) {
-        const int y = ((-rollAngle * x) / 64) - pitchAngle;
-        if (y >= 0 && y <= 81) {
-            displayWriteChar(element->osdDisplayPort, element->elemPosX + x, element->elemPosY + (y / AH_SYMBOL_COUNT), (SYM_AH_BAR9_0 + (y % AH_SYMBOL_COUNT)));
+        int y = centre;
+        if (x != 0) {
+            // Rolling right raises the horizon right of the centre and lowers it to the left
+            y += ((x < 0) == (rollAngle < 0)) ? -rise[ABS(x) - 1] : rise[ABS(x) - 1];
+        }
+        if (y >= 0 && y < AH_LADDER_STEPS) {
+            const uint8_t step = ahLadder[y];
+            osdElementWriteChar(element, element->elemPosX + x, element->elemPosY + (step >> 4), SYM_AH_BAR9_0 + (step & 0x0f));
         }
     }
 
@@ -839,12 +1105,12 @@ static void osdElementGpsHomeDistance(osdElementParms_t *element)
 
 static void osdElementGpsLatitude(osdElementParms_t *element)
 {
-    osdFormatCoordinate(element->buff, SYM_LAT, gpsSol.llh.lat);
+    osdFormatCoordinate(element->buff, (char)SYM_LAT, gpsSol.llh.lat);
 }
 
 static void osdElementGpsLongitude(osdElementParms_t *element)
 {
-    osdFormatCoordinate(element->buff, SYM_LON, gpsSol.llh.lon);
+    osdFormatCoordinate(element->buff, (char)SYM_LON, gpsSol.llh.lon);
 }
 
 static void osdElementGpsSats(osdElementParms_t *element)
@@ -868,13 +1134,13 @@ static void osdElementHorizonSidebars(osdElementParms_t *element)
     const int8_t hudwidth = AH_SIDEBAR_WIDTH_POS;
     const int8_t hudheight = AH_SIDEBAR_HEIGHT_POS;
     for (int y = -hudheight; y <= hudheight; y++) {
-        displayWriteChar(element->osdDisplayPort, element->elemPosX - hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
-        displayWriteChar(element->osdDisplayPort, element->elemPosX + hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
+        osdElementWriteChar(element, element->elemPosX - hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
+        osdElementWriteChar(element, element->elemPosX + hudwidth, element->elemPosY + y, SYM_AH_DECORATION);
     }
 
     // AH level indicators
-    displayWriteChar(element->osdDisplayPort, element->elemPosX - hudwidth + 1, element->elemPosY, SYM_AH_LEFT);
-    displayWriteChar(element->osdDisplayPort, element->elemPosX + hudwidth - 1, element->elemPosY, SYM_AH_RIGHT);
+    osdElementWriteChar(element, element->elemPosX - hudwidth + 1, element->elemPosY, SYM_AH_LEFT);
+    osdElementWriteChar(element, element->elemPosX + hudwidth - 1, element->elemPosY, SYM_AH_RIGHT);
 
     element->drawElement = false;  // element already drawn
 }
@@ -928,13 +1194,13 @@ static void osdElementMainBatteryUsage(osdElementParms_t *element)
     const uint8_t mAhUsedProgress = ceilf((value / (batteryConfig()->batteryCapacity / MAIN_BATT_USAGE_STEPS)));
 
     // Create empty battery indicator bar
-    element->buff[0] = SYM_PB_START;
+    element->buff[0] = (char)SYM_PB_START;
     for (int i = 1; i <= MAIN_BATT_USAGE_STEPS; i++) {
         element->buff[i] = i <= mAhUsedProgress ? SYM_PB_FULL : SYM_PB_EMPTY;
     }
-    element->buff[MAIN_BATT_USAGE_STEPS + 1] = SYM_PB_CLOSE;
+    element->buff[MAIN_BATT_USAGE_STEPS + 1] = (char)SYM_PB_CLOSE;
     if (mAhUsedProgress > 0 && mAhUsedProgress < MAIN_BATT_USAGE_STEPS) {
-        element->buff[1 + mAhUsedProgress] = SYM_PB_END;
+        element->buff[1 + mAhUsedProgress] = (char)SYM_PB_END;
     }
     element->buff[MAIN_BATT_USAGE_STEPS+2] = '\0';
 }
@@ -959,7 +1225,7 @@ static void osdElementMotorDiagnostics(osdElementParms_t *element)
         if (motorsRunning) {
             element->buff[i] =  0x88 - scaleRange(motor[i], motorOutputLow, motorOutputHigh, 0, 8);
         } else {
-            element->buff[i] =  0x88;
+            element->buff[i] =  (char)0x88;
         }
     }
     element->buff[i] = '\0';
@@ -1032,7 +1298,7 @@ static void osdElementRcChannels(osdElementParms_t *element)
             // Decimal notation can be added when tfp_sprintf supports float among fancy options.
             char fmtbuf[6];
             tfp_sprintf(fmtbuf, "%5d", data);
-            displayWrite(element->osdDisplayPort, xpos, ypos + i, fmtbuf);
+            osdElementWriteString(element, xpos, ypos + i, fmtbuf);
         }
     }
 
@@ -1088,11 +1354,11 @@ static void osdElementStickOverlay(osdElementParms_t *element)
         for (unsigned  y = 0; y < OSD_STICK_OVERLAY_HEIGHT; y++) {
             // draw the axes, vertical and horizonal
             if ((x == ((OSD_STICK_OVERLAY_WIDTH - 1) / 2)) && (y == (OSD_STICK_OVERLAY_HEIGHT - 1) / 2)) {
-                displayWriteChar(element->osdDisplayPort, xpos + x, ypos + y, SYM_STICK_OVERLAY_CENTER);
+                osdElementWriteChar(element, xpos + x, ypos + y, SYM_STICK_OVERLAY_CENTER);
             } else if (x == ((OSD_STICK_OVERLAY_WIDTH - 1) / 2)) {
-                displayWriteChar(element->osdDisplayPort, xpos + x, ypos + y, SYM_STICK_OVERLAY_VERTICAL);
+                osdElementWriteChar(element, xpos + x, ypos + y, SYM_STICK_OVERLAY_VERTICAL);
             } else if (y == ((OSD_STICK_OVERLAY_HEIGHT - 1) / 2)) {
-                displayWriteChar(element->osdDisplayPort, xpos + x, ypos + y, SYM_STICK_OVERLAY_HORIZONTAL);
+                osdElementWriteChar(element, xpos + x, ypos + y, SYM_STICK_OVERLAY_HORIZONTAL);
             }
         }
     }
@@ -1112,7 +1378,7 @@ static void osdElementStickOverlay(osdElementParms_t *element)
     const uint8_t cursorY = OSD_STICK_OVERLAY_VERTICAL_POSITIONS - 1 - scaleRange(constrain(rcData[vertical_channel], PWM_RANGE_MIN, PWM_RANGE_MAX - 1), PWM_RANGE_MIN, PWM_RANGE_MAX, 0, OSD_STICK_OVERLAY_VERTICAL_POSITIONS);
     const char cursor = SYM_STICK_OVERLAY_SPRITE_HIGH + (cursorY % OSD_STICK_OVERLAY_SPRITE_HEIGHT);
 
-    displayWriteChar(element->osdDisplayPort, xpos + cursorX, ypos + cursorY / OSD_STICK_OVERLAY_SPRITE_HEIGHT, cursor);
+    osdElementWriteChar(element, xpos + cursorX, ypos + cursorY / OSD_STICK_OVERLAY_SPRITE_HEIGHT, cursor);
 
     element->drawElement = false;  // element already drawn
 }
@@ -1588,6 +1854,148 @@ const osdElementDrawFn osdElementDrawFunction[OSD_ITEM_COUNT] = {
     [OSD_RC_CHANNELS]             = osdElementRcChannels,
 };
 
+// *************************
+// Element input functions
+// *************************
+
+// An element whose text only depends on a few values can return them, so that it is only drawn when they change
+
+typedef uint32_t (*osdElementInputsFn)(uint8_t item);
+
+static uint32_t osdElementStaticInputs(uint8_t item)
+{
+    // only changed by the config, which is picked up by the next full redraw
+    UNUSED(item);
+    return 0;
+}
+
+static uint32_t osdElementAltitudeInputs(uint8_t item)
+{
+    UNUSED(item);
+    return osdAltitudeIsAvailable() ? (uint32_t)getEstimatedAltitudeCm() : 0x80000000;
+}
+
+static uint32_t osdElementAverageCellVoltageInputs(uint8_t item)
+{
+    UNUSED(item);
+    return getBatteryAverageCellVoltage();
+}
+
+static uint32_t osdElementCurrentDrawInputs(uint8_t item)
+{
+    UNUSED(item);
+    return getAmperage();
+}
+
+static uint32_t osdElementDisarmedInputs(uint8_t item)
+{
+    UNUSED(item);
+    return ARMING_FLAG(ARMED);
+}
+
+static uint32_t osdElementFlymodeInputs(uint8_t item)
+{
+    UNUSED(item);
+    return flightModeFlags | IS_RC_MODE_ACTIVE(BOXACROTRAINER) << 16 | airmodeIsEnabled() << 17;
+}
+
+static uint32_t osdElementMahDrawnInputs(uint8_t item)
+{
+    UNUSED(item);
+    return getMAhDrawn();
+}
+
+static uint32_t osdElementMainBatteryVoltageInputs(uint8_t item)
+{
+    UNUSED(item);
+    return getBatteryVoltage() << 16 | getBatteryAverageCellVoltage();
+}
+
+static uint32_t osdElementRssiInputs(uint8_t item)
+{
+    UNUSED(item);
+    return getRssi();
+}
+
+static uint32_t osdElementThrottlePositionInputs(uint8_t item)
+{
+    UNUSED(item);
+    return calculateThrottlePercent();
+}
+
+static uint32_t osdElementTimerInputs(uint8_t item)
+{
+    const uint16_t timer = osdConfig()->timers[item - OSD_ITEM_TIMER_1];
+    timeUs_t resolutionUs;
+    switch (OSD_TIMER_PRECISION(timer)) {
+    case OSD_TIMER_PREC_HUNDREDTHS:
+        resolutionUs = 10000;
+        break;
+    case OSD_TIMER_PREC_TENTHS:
+        resolutionUs = 100000;
+        break;
+    default:
+        resolutionUs = 1000000;
+        break;
+    }
+    // the symbol can change on arming
+    return osdGetTimerValue(OSD_TIMER_SRC(timer)) / resolutionUs + (ARMING_FLAG(ARMED) ? 0x80000000 : 0);
+}
+
+// The other elements are formatted on every refresh, and only written when their text changes
+static const osdElementInputsFn osdElementInputsFunction[OSD_ITEM_COUNT] = {
+    [OSD_RSSI_VALUE]              = osdElementRssiInputs,
+    [OSD_MAIN_BATT_VOLTAGE]       = osdElementMainBatteryVoltageInputs,
+    [OSD_CROSSHAIRS]              = osdElementStaticInputs,
+    [OSD_ITEM_TIMER_1]            = osdElementTimerInputs,
+    [OSD_ITEM_TIMER_2]            = osdElementTimerInputs,
+    [OSD_FLYMODE]                 = osdElementFlymodeInputs,
+    [OSD_CRAFT_NAME]              = osdElementStaticInputs,
+    [OSD_THROTTLE_POS]            = osdElementThrottlePositionInputs,
+    [OSD_CURRENT_DRAW]            = osdElementCurrentDrawInputs,
+    [OSD_MAH_DRAWN]               = osdElementMahDrawnInputs,
+    [OSD_ALTITUDE]                = osdElementAltitudeInputs,
+    [OSD_AVG_CELL_VOLTAGE]        = osdElementAverageCellVoltageInputs,
+    [OSD_DISARMED]                = osdElementDisarmedInputs,
+    [OSD_DISPLAY_NAME]            = osdElementStaticInputs,
+};
+
+// Elements that don't need drawing on every refresh, or that mustn't miss one
+static const osdElementRefresh_t osdElementRefresh[OSD_ITEM_COUNT] = {
+    [OSD_CROSSHAIRS]              = { OSD_TIER_HIGH, 0 },
+    [OSD_ARTIFICIAL_HORIZON]      = { OSD_TIER_HIGH, 0 },
+    [OSD_HORIZON_SIDEBARS]        = { OSD_TIER_HIGH, 0 },
+    [OSD_WARNINGS]                = { OSD_TIER_HIGH, 0 },
+    [OSD_FLIP_ARROW]              = { OSD_TIER_HIGH, 0 },
+    [OSD_ESC_RPM]                 = { OSD_TIER_HIGH, 0 },
+    [OSD_ESC_RPM_FREQ]            = { OSD_TIER_HIGH, 0 },
+    [OSD_STICK_OVERLAY_LEFT]      = { OSD_TIER_HIGH, 0 },
+    [OSD_STICK_OVERLAY_RIGHT]     = { OSD_TIER_HIGH, 0 },
+    [OSD_RC_CHANNELS]             = { OSD_TIER_HIGH, 0 },
+    [OSD_MAH_DRAWN]               = { OSD_TIER_LOW, 200 },
+    [OSD_MAIN_BATT_USAGE]         = { OSD_TIER_LOW, 200 },
+    [OSD_HOME_DIST]               = { OSD_TIER_LOW, 200 },
+    [OSD_GPS_SATS]                = { OSD_TIER_LOW, 500 },
+    [OSD_GPS_LAT]                 = { OSD_TIER_LOW, 500 },
+    [OSD_GPS_LON]                 = { OSD_TIER_LOW, 500 },
+    [OSD_FLIGHT_DIST]             = { OSD_TIER_LOW, 500 },
+    [OSD_ESC_TMP]                 = { OSD_TIER_LOW, 500 },
+    [OSD_CRAFT_NAME]              = { OSD_TIER_LOW, 1000 },
+    [OSD_DISPLAY_NAME]            = { OSD_TIER_LOW, 1000 },
+    [OSD_VTX_CHANNEL]             = { OSD_TIER_LOW, 1000 },
+    [OSD_ROLL_PIDS]               = { OSD_TIER_LOW, 1000 },
+    [OSD_PITCH_PIDS]              = { OSD_TIER_LOW, 1000 },
+    [OSD_YAW_PIDS]                = { OSD_TIER_LOW, 1000 },
+    [OSD_PIDRATE_PROFILE]         = { OSD_TIER_LOW, 1000 },
+    [OSD_RATE_PROFILE_NAME]       = { OSD_TIER_LOW, 1000 },
+    [OSD_PID_PROFILE_NAME]        = { OSD_TIER_LOW, 1000 },
+    [OSD_PROFILE_NAME]            = { OSD_TIER_LOW, 1000 },
+    [OSD_REMAINING_TIME_ESTIMATE] = { OSD_TIER_LOW, 1000 },
+    [OSD_RTC_DATETIME]            = { OSD_TIER_LOW, 1000 },
+    [OSD_CORE_TEMPERATURE]        = { OSD_TIER_LOW, 1000 },
+    [OSD_LOG_STATUS]              = { OSD_TIER_LOW, 1000 },
+};
+
 static void osdAddActiveElement(osd_items_e element)
 {
     if (VISIBLE(osdConfig()->item_pos[element])) {
@@ -1601,6 +2009,8 @@ static void osdAddActiveElement(osd_items_e element)
 void osdAnalyzeActiveElements(void)
 {
     activeOsdElementCount = 0;
+    osdRedrawAllPending = true;
+    memset(osdTierNext, 0, sizeof(osdTierNext));
 
 #ifdef USE_ACC
     if (sensors(SENSOR_ACC)) {
@@ -1638,14 +2048,46 @@ void osdAnalyzeActiveElements(void)
 #endif
 }
 
+static uint32_t osdHashText(const char *text)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261;
+    while (*text) {
+        hash = (hash ^ (uint8_t)*text++) * 16777619;
+    }
+    return hash;
+}
+
 static bool osdDrawSingleElement(displayPort_t *osdDisplayPort, uint8_t item)
 {
+    osdElementCache_t *cache = &osdElementCache[item];
+
     if (BLINK(item)) {
+        if (cache->valid) {
+            osdBlank(osdDisplayPort, cache->x, cache->y, cache->length);
+            cache->valid = false;
+        }
         return false;
     }
 
     uint8_t elemPosX = OSD_X(osdConfig()->item_pos[item]);
     uint8_t elemPosY = OSD_Y(osdConfig()->item_pos[item]);
+
+    // Unchanged text needs writing again if it moved, or an element that draws itself blanked or overwrote it
+    const bool unchangedNeedsWrite = !cache->valid || cache->rewrite || cache->x != elemPosX || cache->y != elemPosY
+        || osdSpansOverlap(osdPreviousSpans, cache->x, cache->y, cache->length)
+        || osdSpansOverlap(osdCurrentSpans, cache->x, cache->y, cache->length);
+    cache->rewrite = false;
+
+    uint32_t signature = 0;
+    const osdElementInputsFn inputsFn = osdElementInputsFunction[item];
+    if (inputsFn) {
+        signature = inputsFn(item);
+        if (!unchangedNeedsWrite && signature == cache->signature) {
+            return true;
+        }
+    }
+
     char buff[OSD_ELEMENT_BUFFER_LENGTH] = "";
 
     osdElementParms_t element;
@@ -1658,13 +2100,84 @@ static bool osdDrawSingleElement(displayPort_t *osdDisplayPort, uint8_t item)
 
     // Call the element drawing function
     osdElementDrawFunction[item](&element);
-    if (element.drawElement) {
-        displayWrite(osdDisplayPort, elemPosX, elemPosY, buff);
+    if (!element.drawElement) {
+        // the element drew itself, and recorded the cells it drew
+        cache->valid = false;
+        cache->drawsItself = true;
+        return true;
     }
 
+    if (!inputsFn) {
+        signature = osdHashText(buff);
+        if (!unchangedNeedsWrite && signature == cache->signature) {
+            return true;
+        }
+    }
+
+    const uint8_t length = strlen(buff);
+    if (cache->valid) {
+        // blank the cells the element no longer covers
+        if (cache->x != elemPosX || cache->y != elemPosY) {
+            osdBlank(osdDisplayPort, cache->x, cache->y, cache->length);
+        } else if (cache->length > length) {
+            osdBlank(osdDisplayPort, elemPosX + length, elemPosY, cache->length - length);
+        }
+    }
+    displayWrite(osdDisplayPort, elemPosX, elemPosY, buff);
+
+    cache->signature = signature;
+    cache->x = elemPosX;
+    cache->y = elemPosY;
+    cache->length = length;
+    cache->valid = true;
+
     return true;
 }
 
+static bool osdElementIsDue(uint8_t item, timeUs_t currentTimeUs)
+{
+    const osdElementCache_t *cache = &osdElementCache[item];
+
+    // What an element drew itself was blanked, and blinking can't wait
+    if (!cache->scheduled || cache->drawsItself || IS_BLINK(item) || cmpTimeUs(currentTimeUs, cache->dueUs) >= 0) {
+        return true;
+    }
+
+    // Text blanked or overwritten by an element that draws itself must be written again now
+    return cache->valid && (osdSpansOverlap(osdPreviousSpans, cache->x, cache->y, cache->length)
+        || osdSpansOverlap(osdCurrentSpans, cache->x, cache->y, cache->length));
+}
+
+static void osdDrawScheduledElements(displayPort_t *osdDisplayPort, timeUs_t currentTimeUs, bool redrawAll)
+{
+    static const uint8_t tierOrder[] = { OSD_TIER_HIGH, OSD_TIER_NORMAL, OSD_TIER_LOW };
+
+    for (unsigned t = 0; t < ARRAYLEN(tierOrder); t++) {
+        const osdElementTier_e tier = tierOrder[t];
+
+        for (unsigned n = 0; n < activeOsdElementCount; n++) {
+            const unsigned index = (osdTierNext[tier] + n) % activeOsdElementCount;
+            const uint8_t item = activeOsdElementArray[index];
+            osdElementCache_t *cache = &osdElementCache[item];
+
+            const bool mustDraw = osdElementRefresh[item].tier == OSD_TIER_HIGH || cache->drawsItself;
+            if ((mustDraw ? OSD_TIER_HIGH : osdElementRefresh[item].tier) != tier || !osdElementIsDue(item, currentTimeUs)) {
+                continue;
+            }
+
+            if (!mustDraw && !redrawAll && cmpTimeUs(micros(), currentTimeUs) >= OSD_ELEMENT_DRAW_BUDGET_US) {
+                // Out of time, start with this one next time
+                osdTierNext[tier] = index;
+                return;
+            }
+
+            osdDrawSingleElement(osdDisplayPort, item);
+            cache->dueUs = currentTimeUs + osdElementRefresh[item].intervalMs * 1000;
+            cache->scheduled = true;
+        }
+    }
+}
+
 void osdDrawActiveElements(displayPort_t *osdDisplayPort, timeUs_t currentTimeUs)
 {
 #ifdef USE_GPS
@@ -1680,9 +2193,40 @@ void osdDrawActiveElements(displayPort_t *osdDisplayPort, timeUs_t currentTimeUs
 
     blinkState = (currentTimeUs / 200000) % 2;
 
-    for (unsigned i = 0; i < activeOsdElementCount; i++) {
-        osdDrawSingleElement(osdDisplayPort, activeOsdElementArray[i]);
+    // Start again from a clear screen when the elements changed or something else cleared it
+    const bool redrawAll = osdRedrawAllPending || osdPreviousSpans->overflow || osdDisplayPort->clearCount != osdDisplayClearCount;
+    if (redrawAll) {
+        displayClearScreen(osdDisplayPort);
+        memset(osdElementCache, 0, sizeof(osdElementCache));
+        osdPreviousSpans->count = 0;
+        osdPreviousSpans->overflow = false;
+        osdRedrawAllPending = false;
+        osdNextRewriteUs = currentTimeUs + OSD_REWRITE_INTERVAL_US;
+    } else {
+        if (cmp32(currentTimeUs, osdNextRewriteUs) >= 0) {
+            // Make every element due and write it again, within the draw budget, so over several refreshes
+            for (unsigned i = 0; i < OSD_ITEM_COUNT; i++) {
+                osdElementCache[i].scheduled = false;
+                osdElementCache[i].rewrite = true;
+            }
+            osdNextRewriteUs = currentTimeUs + OSD_REWRITE_INTERVAL_US;
+        }
+
+        // the elements that draw themselves draw it all again
+        for (unsigned i = 0; i < osdPreviousSpans->count; i++) {
+            const osdSpan_t *span = &osdPreviousSpans->spans[i];
+            osdBlank(osdDisplayPort, span->x, span->y, span->length);
+        }
     }
+    osdCurrentSpans->count = 0;
+    osdCurrentSpans->overflow = false;
+
+    osdDrawScheduledElements(osdDisplayPort, currentTimeUs, redrawAll);
+
+    osdDisplayClearCount = osdDisplayPort->clearCount;
+    osdSpanList_t *spans = osdPreviousSpans;
+    osdPreviousSpans = osdCurrentSpans;
+    osdCurrentSpans = spans;
 }
 
 void osdResetAlarms(void)
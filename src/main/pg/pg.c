@@ -18,6 +18,7 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 #include <stdint.h>
@@ -28,11 +29,61 @@
 
 #include "pg.h"
 
+// The registry is in the order the linker put it in, so pgFind() sorts an index of it by PGN on first use and then
+// does a binary search. A registry too big for the index is scanned instead, which the CLI status reports. Its size is
+// only known once linked, so this can't be checked at compile time.
+#ifndef PG_INDEX_SIZE
+#define PG_INDEX_SIZE 160
+#endif
+
+static uint16_t pgIndex[PG_INDEX_SIZE];
+static bool pgIndexValid;
+
+static void pgBuildIndex(void)
+{
+    // insertion sort, only done once
+    for (int i = 0; i < PG_REGISTRY_SIZE; i++) {
+        const uint16_t pgn = pgN(&__pg_registry_start[i]);
+        int j = i;
+        for (; j > 0 && pgN(&__pg_registry_start[pgIndex[j - 1]]) > pgn; j--) {
+            pgIndex[j] = pgIndex[j - 1];
+        }
+        pgIndex[j] = i;
+    }
+    pgIndexValid = true;
+}
+
+bool pgFindScansRegistry(void)
+{
+    return PG_REGISTRY_SIZE > PG_INDEX_SIZE;
+}
+
 const pgRegistry_t* pgFind(pgn_t pgn)
 {
-    PG_FOREACH(reg) {
+    if (pgFindScansRegistry()) {
+        PG_FOREACH(reg) {
+            if (pgN(reg) == pgn) {
+                return reg;
+            }
+        }
+        return NULL;
+    }
+
+    if (!pgIndexValid) {
+        pgBuildIndex();
+    }
+
+    int low = 0;
+    int high = PG_REGISTRY_SIZE - 1;
+    while (low <= high) {
+        const int mid = (low + high) / 2;
+        const pgRegistry_t *reg = &__pg_registry_start[pgIndex[mid]];
         if (pgN(reg) == pgn) {
             return reg;
+        } else if (pgN(reg) < pgn) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
         }
     }
     return NULL;
@@ -93,6 +144,21 @@ int pgStore(const pgRegistry_t* reg, void *to, int size)
     return take;
 }
 
+// A patch overwrites part of a PG in RAM, it must be for the PG's version and lie within the PG
+bool pgPatchIsValid(const pgRegistry_t* reg, int version, int offset, int size)
+{
+    return version == pgVersion(reg) && offset >= 0 && size >= 0 && offset + size <= pgSize(reg);
+}
+
+bool pgPatch(const pgRegistry_t* reg, int version, int offset, const void *from, int size)
+{
+    if (!pgPatchIsValid(reg, version, offset, size)) {
+        return false;
+    }
+    memcpy(pgOffset(reg) + offset, from, size);
+    return true;
+}
+
 void pgResetAll(void)
 {
     PG_FOREACH(reg) {
@@ -192,9 +192,12 @@ extern const uint8_t __pg_resetdata_end[];
 #define CONVERT_PARAMETER_TO_PERCENT(param) (0.01f * param)
 
 const pgRegistry_t* pgFind(pgn_t pgn);
+bool pgFindScansRegistry(void); // true if the registry has outgrown PG_INDEX_SIZE
 
 bool pgLoad(const pgRegistry_t* reg, const void *from, int size, int version);
 int pgStore(const pgRegistry_t* reg, void *to, int size);
+bool pgPatchIsValid(const pgRegistry_t* reg, int version, int offset, int size);
+bool pgPatch(const pgRegistry_t* reg, int version, int offset, const void *from, int size);
 void pgResetAll(void);
 void pgResetInstance(const pgRegistry_t *reg, uint8_t *base);
 bool pgResetCopy(void *copy, pgn_t pgn);
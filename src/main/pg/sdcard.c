@@ -63,6 +63,10 @@ void pgResetFn_sdcardConfig(sdcardConfig_t *config)
     }
 #endif
 
+#ifdef USE_SDCARD_SIM
+    config->mode = SDCARD_MODE_SIM;
+#endif
+
 #ifndef USE_DMA_SPEC
 #ifdef USE_SDCARD_SPI
 #if defined(SDCARD_DMA_STREAM_TX_FULL)
@@ -217,11 +217,12 @@ static void crsfCheckRssi(uint32_t currentTimeUs) {
 STATIC_UNIT_TESTED uint8_t crsfFrameCRC(void)
 {
     // CRC includes type and payload
-    uint8_t crc = crc8_dvb_s2(0, crsfFrame.frame.type);
-    for (int ii = 0; ii < crsfFrame.frame.frameLength - CRSF_FRAME_LENGTH_TYPE_CRC; ++ii) {
-        crc = crc8_dvb_s2(crc, crsfFrame.frame.payload[ii]);
+    const uint8_t crc = crc8_dvb_s2(0, crsfFrame.frame.type);
+    const int payloadLength = crsfFrame.frame.frameLength - CRSF_FRAME_LENGTH_TYPE_CRC;
+    if (payloadLength <= 0) {
+        return crc;
     }
-    return crc;
+    return crc8_dvb_s2_update(crc, crsfFrame.frame.payload, payloadLength);
 }
 
 // Receive ISR callback, called back from serial port
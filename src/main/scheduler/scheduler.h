@@ -108,6 +108,9 @@ typedef enum {
 #ifdef USE_OSD
     TASK_OSD,
 #endif
+#ifdef USE_MAX7456
+    TASK_MAX7456_FONT,
+#endif
 #ifdef USE_BST
     TASK_BST_MASTER_PROCESS,
 #endif
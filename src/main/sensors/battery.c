@@ -37,6 +37,7 @@
 
 #include "fc/runtime_config.h"
 #include "fc/config.h"
+#include "fc/flight_stats.h"
 #include "fc/rc_controls.h"
 
 #include "io/beeper.h"
@@ -148,6 +149,8 @@ void batteryUpdateVoltage(timeUs_t currentTimeUs)
         debug[0] = voltageMeter.unfiltered;
         debug[1] = voltageMeter.filtered;
     }
+
+    flightStatsAdd(FLIGHT_STAT_VOLTAGE, voltageMeter.filtered);
 }
 
 static void updateBatteryBeeperAlert(void)
@@ -455,6 +458,8 @@ void batteryUpdateCurrentMeter(timeUs_t currentTimeUs)
             currentMeterReset(&currentMeter);
             break;
     }
+
+    flightStatsAdd(FLIGHT_STAT_CURRENT, currentMeter.amperage);
 }
 
 float calculateVbatPidCompensation(void) {
@@ -35,6 +35,7 @@
 #include "pg/pg_ids.h"
 #include "pg/motor.h"
 
+#include "common/crc.h"
 #include "common/maths.h"
 #include "common/utils.h"
 
@@ -48,6 +49,7 @@
 #include "esc_sensor.h"
 
 #include "fc/config.h"
+#include "fc/flight_stats.h"
 
 #include "flight/mixer.h"
 
@@ -226,26 +228,9 @@ bool escSensorInit(void)
     return escSensorPort != NULL;
 }
 
-static uint8_t updateCrc8(uint8_t crc, uint8_t crc_seed)
-{
-    uint8_t crc_u = crc;
-    crc_u ^= crc_seed;
-
-    for (int i=0; i<8; i++) {
-        crc_u = ( crc_u & 0x80 ) ? 0x7 ^ ( crc_u << 1 ) : ( crc_u << 1 );
-    }
-
-    return (crc_u);
-}
-
 uint8_t calculateCrc8(const uint8_t *Buf, const uint8_t BufLen)
 {
-    uint8_t crc = 0;
-    for (int i = 0; i < BufLen; i++) {
-        crc = updateCrc8(Buf[i], crc);
-    }
-
-    return crc;
+    return crc8_poly_07_update(0, Buf, BufLen);
 }
 
 static uint8_t decodeEscFrame(void)
@@ -335,6 +320,11 @@ void escSensorProcess(timeUs_t currentTimeUs)
                         selectNextMotor();
                         escSensorTriggerState = ESC_SENSOR_TRIGGER_READY;
 
+                        if (escSensorMotor == 0) {
+                            // Every motor has reported since the last round
+                            flightStatsAdd(FLIGHT_STAT_ESC_RPM, calcEscRpm(getEscSensorData(ESC_SENSOR_COMBINED)->rpm));
+                        }
+
                         break;
                     case ESC_SENSOR_FRAME_FAILED:
                         increaseDataAge();
@@ -28,6 +28,8 @@
 
 #include "build/debug.h"
 
+#include "blackbox/blackbox_gyro_capture.h"
+
 #include "common/axis.h"
 #include "common/maths.h"
 #include "common/filter.h"
@@ -1084,6 +1086,10 @@ FAST_CODE void gyroUpdate(timeUs_t currentTimeUs)
         filterGyroDebug();
     }
 
+#ifdef USE_BLACKBOX_GYRO_CAPTURE
+    blackboxGyroCaptureSample(gyro.gyroADC, gyro.gyroADCf);
+#endif
+
 #ifdef USE_GYRO_DATA_ANALYSE
     if (isDynamicFilterActive()) {
         gyroDataAnalyse(&gyro.gyroAnalyseState, gyro.notchFilterDyn, gyro.notchFilterDyn2);
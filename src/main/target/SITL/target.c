@@ -559,13 +559,23 @@ void FLASH_Lock(void) {
 }
 
 FLASH_Status FLASH_ErasePage(uintptr_t Page_Address) {
-    UNUSED(Page_Address);
+    // Erased flash reads back as all ones
+    for (uintptr_t addr = Page_Address; addr < Page_Address + FLASH_PAGE_SIZE; addr++) {
+        if ((addr >= (uintptr_t)eepromData) && (addr < (uintptr_t)ARRAYEND(eepromData))) {
+            *((uint8_t*)addr) = 0xFF;
+        }
+    }
 //    printf("[FLASH_ErasePage]%x\n", Page_Address);
     return FLASH_COMPLETE;
 }
 
 FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t value) {
     if ((addr >= (uintptr_t)eepromData) && (addr < (uintptr_t)ARRAYEND(eepromData))) {
+        if (*((uint32_t*)addr) != 0xFFFFFFFF) {
+            // Like the real thing, a word can only be programmed once after it was erased
+            printf("[FLASH_ProgramWord]%p is not erased!\n", (void*)addr);
+            return FLASH_ERROR_PG;
+        }
         *((uint32_t*)addr) = value;
         printf("[FLASH_ProgramWord]%p = %08x\n", (void*)addr, *((uint32_t*)addr));
     } else {
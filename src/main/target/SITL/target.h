@@ -44,6 +44,7 @@
 #define EEPROM_FILENAME "eeprom.bin"
 #define CONFIG_IN_FILE
 #define EEPROM_SIZE     32768
+#define FLASH_PAGE_SIZE (0x400)
 
 #define U_ID_0 0
 #define U_ID_1 1
@@ -69,6 +70,11 @@
 #define USE_BARO
 #define USE_FAKE_BARO
 
+// file backed sdcard, see drivers/sdcard_sim.h
+#define USE_SDCARD
+#define USE_SDCARD_SIM
+#define SDCARD_SIM_FILENAME "sdcard.img"
+
 #define USABLE_TIMER_CHANNEL_COUNT 0
 
 #define USE_UART1
@@ -90,12 +96,13 @@
 
 #define USE_PARAMETER_GROUPS
 
+#define USE_VIRTUAL_DISPLAYPORT // for the OSD, set osd_displayport_device = VIRTUAL
+
 #undef STACK_CHECK // I think SITL don't need this
 #undef USE_DASHBOARD
 #undef USE_TELEMETRY_LTM
 #undef USE_ADC
 #undef USE_VCP
-#undef USE_OSD
 #undef USE_PPM
 #undef USE_PWM
 #undef USE_SERIAL_RX
@@ -1,5 +1,5 @@
 SITL_TARGETS += $(TARGET)
-FEATURES       += #SDCARD_SPI VCP
+FEATURES       += SDCARD_SIM #SDCARD_SPI VCP
 
 TARGET_SRC = \
             drivers/accgyro/accgyro_fake.c \
@@ -317,6 +317,9 @@
 
 #if (FLASH_SIZE > 256)
 #define USE_AIRMODE_LPF
+#define USE_BLACKBOX_GYRO_CAPTURE
+#define USE_CRC_SLICE_BY_4
+#define USE_MSP_STATISTICS
 #define USE_DASHBOARD
 #define USE_GPS
 #define USE_GPS_NMEA
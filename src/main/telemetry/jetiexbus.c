@@ -33,6 +33,7 @@
 
 #include "common/utils.h"
 #include "common/bitarray.h"
+#include "common/crc.h"
 
 #include "drivers/serial.h"
 #include "drivers/serial_uart.h"
@@ -184,12 +185,7 @@ static uint8_t getNextActiveSensor(uint8_t currentSensor);
 // Jeti Ex Telemetry CRC calculations for a frame
 uint8_t calcCRC8(uint8_t *pt, uint8_t msgLen)
 {
-    uint8_t crc=0;
-    for (uint8_t mlen = 0; mlen < msgLen; mlen++) {
-        crc  ^= pt[mlen];
-        crc = crc ^ (crc << 1) ^ (crc << 2) ^ (0x0e090700 >> ((crc >> 3) & 0x18));
-    }
-    return(crc);
+    return crc8_poly_07_update(0, pt, msgLen);
 }
 
 void enableGpsTelemetry(bool enable)
@@ -0,0 +1,440 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox_adaptive.h"
+    #include "blackbox/blackbox_encoding.h"
+    #include "blackbox/blackbox_io.h"
+
+    #include "common/maths.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOG_BUFFER_SIZE (256 * 1024)
+static uint8_t logBuffer[LOG_BUFFER_SIZE];
+static int logWritePos;
+static int logReadPos;
+
+static void resetLog(void)
+{
+    logWritePos = 0;
+    logReadPos = 0;
+}
+
+static uint8_t readByte(void)
+{
+    EXPECT_LT(logReadPos, logWritePos);
+    return logBuffer[logReadPos++];
+}
+
+static int32_t signExtend(uint32_t value, int bits)
+{
+    return (int32_t)(value << (32 - bits)) >> (32 - bits);
+}
+
+static int32_t readSignedVB(void)
+{
+    uint32_t i = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        const uint8_t c = readByte();
+        i |= (uint32_t)(c & 0x7F) << shift;
+        if (c < 128) {
+            break;
+        }
+    }
+    return (int32_t)((i >> 1) ^ -(int32_t)(i & 1)); // zigzag decode
+}
+
+static void readTag8_8SVB(int32_t *values, int count)
+{
+    if (count == 1) {
+        values[0] = readSignedVB();
+        return;
+    }
+    const uint8_t header = readByte();
+    for (int i = 0; i < count; i++) {
+        values[i] = (header & (1 << i)) ? readSignedVB() : 0;
+    }
+}
+
+// The 32 bit selector of both three value encodings
+static void readTag2_3Bytes(uint8_t selector2, int32_t *values)
+{
+    for (int x = 0; x < 3; x++, selector2 >>= 2) {
+        const int bytes = (selector2 & 0x03) + 1;
+        uint32_t value = 0;
+        for (int b = 0; b < bytes; b++) {
+            value |= (uint32_t)readByte() << (8 * b);
+        }
+        values[x] = signExtend(value, bytes * 8);
+    }
+}
+
+static void readTag2_3S32(int32_t *values)
+{
+    const uint8_t lead = readByte();
+    uint8_t b1, b2;
+
+    switch (lead >> 6) {
+    case 0:
+        values[0] = signExtend((lead >> 4) & 0x03, 2);
+        values[1] = signExtend((lead >> 2) & 0x03, 2);
+        values[2] = signExtend(lead & 0x03, 2);
+        break;
+    case 1:
+        b1 = readByte();
+        values[0] = signExtend(lead & 0x0F, 4);
+        values[1] = signExtend(b1 >> 4, 4);
+        values[2] = signExtend(b1 & 0x0F, 4);
+        break;
+    case 2:
+        b1 = readByte();
+        b2 = readByte();
+        values[0] = signExtend(lead & 0x3F, 6);
+        values[1] = signExtend(b1 & 0x3F, 6);
+        values[2] = signExtend(b2 & 0x3F, 6);
+        break;
+    default:
+        readTag2_3Bytes(lead & 0x3F, values);
+        break;
+    }
+}
+
+static void readTag2_3SVariable(int32_t *values)
+{
+    const uint8_t lead = readByte();
+    uint8_t b1, b2;
+
+    switch (lead >> 6) {
+    case 0:
+        values[0] = signExtend((lead >> 4) & 0x03, 2);
+        values[1] = signExtend((lead >> 2) & 0x03, 2);
+        values[2] = signExtend(lead & 0x03, 2);
+        break;
+    case 1:
+        b1 = readByte();
+        values[0] = signExtend((lead >> 1) & 0x1F, 5);
+        values[1] = signExtend(((lead & 0x01) << 4) | (b1 >> 4), 5);
+        values[2] = signExtend(b1 & 0x0F, 4);
+        break;
+    case 2:
+        b1 = readByte();
+        b2 = readByte();
+        values[0] = signExtend(((lead & 0x3F) << 2) | (b1 >> 6), 8);
+        values[1] = signExtend(((b1 & 0x3F) << 1) | (b2 >> 7), 7);
+        values[2] = signExtend(b2 & 0x7F, 7);
+        break;
+    default:
+        readTag2_3Bytes(lead & 0x3F, values);
+        break;
+    }
+}
+
+static void readResiduals(uint8_t encoding, int32_t *residuals, int count)
+{
+    int i = 0;
+
+    switch (encoding) {
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG8_8SVB:
+        for (; i < count; i += 8) {
+            readTag8_8SVB(residuals + i, MIN(count - i, 8));
+        }
+        return;
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG2_3S32:
+        for (; i + 3 <= count; i += 3) {
+            readTag2_3S32(residuals + i);
+        }
+        break;
+    case BLACKBOX_ADAPTIVE_ENCODE_TAG2_3SVARIABLE:
+        for (; i + 3 <= count; i += 3) {
+            readTag2_3SVariable(residuals + i);
+        }
+        break;
+    }
+    for (; i < count; i++) {
+        residuals[i] = readSignedVB();
+    }
+}
+
+// Reverse of blackboxAdaptiveResiduals()
+static void decodeGroup(uint8_t selection, int count, const int16_t *prev1, const int16_t *prev2, int16_t *curr)
+{
+    int32_t residuals[BLACKBOX_ADAPTIVE_MAX_VALUES];
+    readResiduals(selection & 0x0F, residuals, count);
+
+    for (int i = 0; i < count; i++) {
+        switch (selection >> 4) {
+        case BLACKBOX_ADAPTIVE_PREDICT_PREVIOUS:
+            curr[i] = residuals[i] + prev1[i];
+            break;
+        case BLACKBOX_ADAPTIVE_PREDICT_STRAIGHT_LINE:
+            curr[i] = residuals[i] + 2 * prev1[i] - prev2[i];
+            break;
+        case BLACKBOX_ADAPTIVE_PREDICT_AVERAGE_2:
+            curr[i] = residuals[i] + (prev1[i] + prev2[i]) / 2;
+            break;
+        case BLACKBOX_ADAPTIVE_PREDICT_COMMON_DELTA:
+            if (i == 0) {
+                curr[i] = residuals[i] + (prev1[i] + prev2[i]) / 2;
+            } else {
+                curr[i] = residuals[i] + prev1[i] + (curr[0] - prev1[0]);
+            }
+            break;
+        default:
+            ADD_FAILURE() << "bad predictor " << (selection >> 4);
+            break;
+        }
+    }
+}
+
+/*
+ * Synthetic flight: slow stick movement plus what is left of the motor noise and sensor noise after filtering on the
+ * gyro, throttle changes common to all motors plus a little attitude correction per motor. There is no recorded flight
+ * log in the tree to use instead.
+ */
+#define GYRO_VALUES     3
+#define MOTOR_VALUES    4
+
+static uint32_t noiseState;
+
+static int noise(int amplitude)
+{
+    noiseState = noiseState * 1664525 + 1013904223;
+    return (int)((noiseState >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+static void syntheticGyro(int frame, int16_t *gyro)
+{
+    const float t = frame / 1000.0f; // 1kHz P-frame rate
+    for (int axis = 0; axis < GYRO_VALUES; axis++) {
+        const float stick = 300.0f * sinf(2 * M_PIf * (0.7f + 0.3f * axis) * t);
+        const float motorNoise = 4.0f * sinf(2 * M_PIf * 180.0f * t + axis);
+        gyro[axis] = lrintf(stick + motorNoise) + noise(2);
+    }
+}
+
+static void syntheticMotors(int frame, int16_t *motor)
+{
+    const float t = frame / 1000.0f;
+    const float throttle = 1400.0f + 250.0f * sinf(2 * M_PIf * 0.5f * t) + 40.0f * sinf(2 * M_PIf * 9.0f * t);
+    for (int i = 0; i < MOTOR_VALUES; i++) {
+        const float correction = 15.0f * sinf(2 * M_PIf * 3.0f * t + i * M_PIf / 2);
+        motor[i] = lrintf(throttle + correction) + noise(2);
+    }
+}
+
+typedef void syntheticSource_t(int frame, int16_t *values);
+
+/*
+ * Log `frames` P-frames of the source through one group, the way blackbox.c does, and decode them again. Returns the
+ * number of bytes logged, including selection frames.
+ */
+static int logAndDecode(syntheticSource_t *source, int count, int frames, bool adaptive)
+{
+    blackboxAdaptiveGroup_t group;
+    int16_t history[3][BLACKBOX_ADAPTIVE_MAX_VALUES];
+    int16_t decoded[3][BLACKBOX_ADAPTIVE_MAX_VALUES];
+
+    resetLog();
+    noiseState = 1;
+    blackboxAdaptiveGroupInit(&group, count);
+
+    // The I-frame
+    source(0, history[0]);
+    memcpy(history[1], history[0], sizeof(history[0]));
+    memcpy(decoded[0], history[0], sizeof(history[0]));
+    memcpy(decoded[1], history[0], sizeof(history[0]));
+    uint8_t selection = blackboxAdaptiveSelection(&group);
+
+    for (int frame = 1; frame <= frames; frame++) {
+        // history[0] is current, [1] previous, [2] previous but one
+        memcpy(history[2], history[1], sizeof(history[0]));
+        memcpy(history[1], history[0], sizeof(history[0]));
+        source(frame, history[0]);
+
+        blackboxAdaptiveWriteGroup(&group, history[0], history[1], history[2]);
+        if (adaptive && blackboxAdaptiveUpdateSelection(&group)) {
+            blackboxWrite(BLACKBOX_ADAPTIVE_SELECTION_FRAME);
+            blackboxWrite(blackboxAdaptiveSelection(&group));
+        }
+
+        memcpy(decoded[2], decoded[1], sizeof(decoded[0]));
+        memcpy(decoded[1], decoded[0], sizeof(decoded[0]));
+        decodeGroup(selection, count, decoded[1], decoded[2], decoded[0]);
+        for (int i = 0; i < count; i++) {
+            EXPECT_EQ(history[0][i], decoded[0][i]);
+        }
+        if (logReadPos < logWritePos && logBuffer[logReadPos] == BLACKBOX_ADAPTIVE_SELECTION_FRAME) {
+            logReadPos++;
+            selection = readByte();
+        }
+    }
+    EXPECT_EQ(logWritePos, logReadPos);
+
+    return logWritePos;
+}
+
+TEST(BlackboxAdaptiveTest, InitialSelectionIsVersion2Format)
+{
+    blackboxAdaptiveGroup_t group;
+    blackboxAdaptiveGroupInit(&group, 3);
+
+    EXPECT_EQ((BLACKBOX_ADAPTIVE_PREDICT_AVERAGE_2 << 4) | BLACKBOX_ADAPTIVE_ENCODE_SIGNED_VB, blackboxAdaptiveSelection(&group));
+
+    resetLog();
+    const int16_t curr[3] = { 100, -50, 7 };
+    const int16_t prev1[3] = { 90, -40, 7 };
+    const int16_t prev2[3] = { 80, -30, 1 };
+    blackboxAdaptiveWriteGroup(&group, curr, prev1, prev2);
+
+    // Same bytes as blackboxWriteMainStateArrayUsingAveragePredictor()
+    EXPECT_EQ(15, readSignedVB());
+    EXPECT_EQ(-15, readSignedVB());
+    EXPECT_EQ(3, readSignedVB());
+    EXPECT_EQ(logWritePos, logReadPos);
+}
+
+TEST(BlackboxAdaptiveTest, Residuals)
+{
+    const int16_t curr[4] = { 110, 210, 310, 410 };
+    const int16_t prev1[4] = { 100, 200, 300, 400 };
+    const int16_t prev2[4] = { 90, 190, 290, 395 };
+    int32_t residuals[4];
+
+    blackboxAdaptiveResiduals(BLACKBOX_ADAPTIVE_PREDICT_PREVIOUS, 4, curr, prev1, prev2, residuals);
+    EXPECT_EQ(10, residuals[0]);
+    EXPECT_EQ(10, residuals[3]);
+
+    blackboxAdaptiveResiduals(BLACKBOX_ADAPTIVE_PREDICT_STRAIGHT_LINE, 4, curr, prev1, prev2, residuals);
+    EXPECT_EQ(0, residuals[0]);
+    EXPECT_EQ(5, residuals[3]);
+
+    blackboxAdaptiveResiduals(BLACKBOX_ADAPTIVE_PREDICT_AVERAGE_2, 4, curr, prev1, prev2, residuals);
+    EXPECT_EQ(15, residuals[0]);
+    EXPECT_EQ(13, residuals[3]); // (400 + 395) / 2 == 397
+
+    blackboxAdaptiveResiduals(BLACKBOX_ADAPTIVE_PREDICT_COMMON_DELTA, 4, curr, prev1, prev2, residuals);
+    EXPECT_EQ(15, residuals[0]);
+    EXPECT_EQ(0, residuals[1]);
+    EXPECT_EQ(0, residuals[3]);
+}
+
+TEST(BlackboxAdaptiveTest, SelectionOnlyChangesAtEndOfWindow)
+{
+    blackboxAdaptiveGroup_t group;
+    blackboxAdaptiveGroupInit(&group, 3);
+
+    // A steady ramp is predicted exactly by a straight line
+    int16_t values[BLACKBOX_ADAPTIVE_WINDOW + 2][3];
+    for (int frame = 0; frame < BLACKBOX_ADAPTIVE_WINDOW + 2; frame++) {
+        for (int i = 0; i < 3; i++) {
+            values[frame][i] = 1000 * (i + 1) * frame;
+        }
+    }
+
+    resetLog();
+    for (int frame = 2; frame < BLACKBOX_ADAPTIVE_WINDOW + 2; frame++) {
+        blackboxAdaptiveWriteGroup(&group, values[frame], values[frame - 1], values[frame - 2]);
+        if (frame < BLACKBOX_ADAPTIVE_WINDOW + 1) {
+            EXPECT_FALSE(blackboxAdaptiveUpdateSelection(&group));
+        }
+    }
+    EXPECT_TRUE(blackboxAdaptiveUpdateSelection(&group));
+    EXPECT_EQ(BLACKBOX_ADAPTIVE_PREDICT_STRAIGHT_LINE, group.predictor);
+
+    // Once the window has restarted the new selection stays put
+    EXPECT_FALSE(blackboxAdaptiveUpdateSelection(&group));
+}
+
+TEST(BlackboxAdaptiveTest, GyroRoundTrip)
+{
+    logAndDecode(syntheticGyro, GYRO_VALUES, 2000, true);
+}
+
+TEST(BlackboxAdaptiveTest, MotorRoundTrip)
+{
+    logAndDecode(syntheticMotors, MOTOR_VALUES, 2000, true);
+}
+
+TEST(BlackboxAdaptiveTest, RoundTripOfLargeGroup)
+{
+    static const int count = 12;
+    blackboxAdaptiveGroup_t group;
+    int16_t prev2[count] = { 0 }, prev1[count] = { 0 }, curr[count], decoded[count];
+
+    for (uint8_t encoding = 0; encoding < BLACKBOX_ADAPTIVE_ENCODING_COUNT; encoding++) {
+        blackboxAdaptiveGroupInit(&group, count);
+        group.encoding = encoding;
+        for (int i = 0; i < count; i++) {
+            curr[i] = (i % 3) ? i * 1000 - 4000 : 0;
+        }
+
+        resetLog();
+        blackboxAdaptiveWriteGroup(&group, curr, prev1, prev2);
+        decodeGroup(blackboxAdaptiveSelection(&group), count, prev1, prev2, decoded);
+        for (int i = 0; i < count; i++) {
+            EXPECT_EQ(curr[i], decoded[i]);
+        }
+        EXPECT_EQ(logWritePos, logReadPos);
+    }
+}
+
+TEST(BlackboxAdaptiveTest, SyntheticFlightIsSmallerThanVersion2)
+{
+    const int frames = 10000;
+
+    const int gyroFixed = logAndDecode(syntheticGyro, GYRO_VALUES, frames, false);
+    const int gyroAdaptive = logAndDecode(syntheticGyro, GYRO_VALUES, frames, true);
+    const int motorFixed = logAndDecode(syntheticMotors, MOTOR_VALUES, frames, false);
+    const int motorAdaptive = logAndDecode(syntheticMotors, MOTOR_VALUES, frames, true);
+
+    printf("gyro:  version 2 %d bytes, adaptive %d bytes (%d%%)\n", gyroFixed, gyroAdaptive, 100 * gyroAdaptive / gyroFixed);
+    printf("motor: version 2 %d bytes, adaptive %d bytes (%d%%)\n", motorFixed, motorAdaptive, 100 * motorAdaptive / motorFixed);
+
+    EXPECT_LT(gyroAdaptive, gyroFixed);
+    EXPECT_LT(motorAdaptive, motorFixed);
+}
+
+// STUBS
+extern "C" {
+int32_t blackboxHeaderBudget;
+void blackboxWrite(uint8_t value)
+{
+    EXPECT_LT(logWritePos, LOG_BUFFER_SIZE);
+    logBuffer[logWritePos++] = value;
+}
+int blackboxWriteString(const char *s)
+{
+    const int length = strlen(s);
+    while (*s) {
+        blackboxWrite(*s++);
+    }
+    return length;
+}
+}
@@ -240,6 +240,49 @@ TEST(BlackboxTest, TestWriteTag2_3SVariable_BITS887)
     EXPECT_EQ(0, buf[3]); // ensure next byte has not been written
     buf += 3;
 }
+
+TEST(BlackboxEncodingTest, TestLengthsMatchWrittenBytes)
+{
+    static const int32_t values[] = {
+        0, 1, -1, 7, -8, 63, -64, 64, -65, 127, -128, 8191, -8192, 8192, 32767, -32768, 1000000, INT32_MIN, INT32_MAX
+    };
+    const int count = ARRAYLEN(values);
+
+    for (int i = 0; i < count; i++) {
+        serialTestResetBuffers();
+        blackboxWriteSignedVB(values[i]);
+        EXPECT_EQ(serialWritePos, blackboxSignedVBLength(values[i]));
+
+        serialTestResetBuffers();
+        blackboxWriteUnsignedVB(values[i]);
+        EXPECT_EQ(serialWritePos, blackboxUnsignedVBLength(values[i]));
+    }
+
+    // Every combination of three values for the three value encodings
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < count; j++) {
+            for (int k = 0; k < count; k++) {
+                const int32_t v[3] = { values[i], values[j], values[k] };
+
+                serialTestResetBuffers();
+                blackboxWriteTag2_3S32(v);
+                EXPECT_EQ(serialWritePos, blackboxTag2_3S32Length(v));
+
+                serialTestResetBuffers();
+                blackboxWriteTag2_3SVariable(v);
+                EXPECT_EQ(serialWritePos, blackboxTag2_3SVariableLength(v));
+            }
+        }
+    }
+
+    for (int n = 1; n <= 8; n++) {
+        for (int i = 0; i + n <= count; i++) {
+            serialTestResetBuffers();
+            blackboxWriteTag8_8SVB(values + i, n);
+            EXPECT_EQ(serialWritePos, blackboxTag8_8SVBLength(values + i, n));
+        }
+    }
+}
 // STUBS
 extern "C" {
 PG_REGISTER(blackboxConfig_t, blackboxConfig, PG_BLACKBOX_CONFIG, 0);
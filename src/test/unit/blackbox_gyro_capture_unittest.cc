@@ -0,0 +1,208 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "blackbox/blackbox.h"
+    #include "blackbox/blackbox_gyro_capture.h"
+
+    #include "pg/pg.h"
+    #include "pg/pg_ids.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOG_BUFFER_SIZE 16384
+static uint8_t logBuffer[LOG_BUFFER_SIZE];
+static int logWritePos;
+static int logReadPos;
+
+static void resetLog(void)
+{
+    logWritePos = 0;
+    logReadPos = 0;
+}
+
+static uint32_t readUnsignedVB(void)
+{
+    uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        const uint8_t c = logBuffer[logReadPos++];
+        result |= (uint32_t)(c & 0x7F) << shift;
+        if (c < 128) {
+            break;
+        }
+    }
+    return result;
+}
+
+static int32_t readSignedVB(void)
+{
+    const uint32_t i = readUnsignedVB();
+    return (int32_t)((i >> 1) ^ -(int32_t)(i & 1)); // zigzag decode
+}
+
+static void captureSamples(int count, int firstValue)
+{
+    for (int i = 0; i < count; i++) {
+        const float gyroADC[XYZ_AXIS_COUNT] = { (float)(firstValue + i), (float)-(firstValue + i), 1000.0f };
+        const float gyroADCf[XYZ_AXIS_COUNT] = { (float)(firstValue + i) / 2, 0.0f, -1000.0f };
+        blackboxGyroCaptureSample(gyroADC, gyroADCf);
+    }
+}
+
+// Decode one block and check it against the samples made by captureSamples()
+static void expectBlock(int firstValue)
+{
+    int16_t previous[XYZ_AXIS_COUNT * 2] = { 0 };
+
+    EXPECT_EQ(BLACKBOX_GYRO_CAPTURE_BLOCK_FRAME, logBuffer[logReadPos++]);
+    for (int i = 0; i < BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES; i++) {
+        int16_t sample[XYZ_AXIS_COUNT * 2];
+        for (int j = 0; j < XYZ_AXIS_COUNT * 2; j++) {
+            sample[j] = previous[j] + readSignedVB();
+            previous[j] = sample[j];
+        }
+        const int value = firstValue + i;
+        EXPECT_EQ(value, sample[0]);
+        EXPECT_EQ(-value, sample[1]);
+        EXPECT_EQ(1000, sample[2]);
+        EXPECT_EQ(lrintf((float)value / 2), sample[3]);
+        EXPECT_EQ(0, sample[4]);
+        EXPECT_EQ(-1000, sample[5]);
+    }
+}
+
+TEST(BlackboxGyroCaptureTest, InactiveCaptureIgnoresSamples)
+{
+    resetLog();
+    blackboxGyroCaptureStop();
+
+    captureSamples(BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES * 2, 0);
+
+    EXPECT_EQ(0, blackboxGyroCaptureWriteBlocks());
+    EXPECT_EQ(0, logWritePos);
+}
+
+TEST(BlackboxGyroCaptureTest, OnlyCompleteBlocksAreWritten)
+{
+    resetLog();
+    blackboxGyroCaptureStart();
+
+    captureSamples(BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES - 1, 100);
+    EXPECT_EQ(0, blackboxGyroCaptureWriteBlocks());
+    EXPECT_EQ(0, logWritePos);
+
+    captureSamples(1, 100 + BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES - 1);
+    EXPECT_EQ(1, blackboxGyroCaptureWriteBlocks());
+
+    // the first block is preceded by a sync frame
+    EXPECT_EQ(BLACKBOX_GYRO_CAPTURE_SYNC_FRAME, logBuffer[logReadPos++]);
+    EXPECT_EQ(0, readUnsignedVB());
+    EXPECT_EQ(0, readUnsignedVB());
+    expectBlock(100);
+    EXPECT_EQ(logWritePos, logReadPos);
+}
+
+TEST(BlackboxGyroCaptureTest, BlocksAreDeltaEncoded)
+{
+    resetLog();
+    blackboxGyroCaptureStart();
+
+    captureSamples(BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES, 0);
+    blackboxGyroCaptureWriteBlocks();
+    const int firstBlockBytes = logWritePos;
+
+    captureSamples(BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES, BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES);
+    blackboxGyroCaptureWriteBlocks();
+
+    // slowly changing values take a byte per value after the first sample
+    EXPECT_EQ(1 + BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES * XYZ_AXIS_COUNT * 2, logWritePos - firstBlockBytes);
+}
+
+TEST(BlackboxGyroCaptureTest, SyncFrameIsWrittenPeriodically)
+{
+    resetLog();
+    blackboxGyroCaptureStart();
+
+    int syncFrames = 0;
+    for (int block = 0; block < BLACKBOX_GYRO_CAPTURE_SYNC_BLOCKS * 2; block++) {
+        captureSamples(BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES, block);
+        logReadPos = logWritePos;
+        EXPECT_EQ(1, blackboxGyroCaptureWriteBlocks());
+        if (logBuffer[logReadPos] == BLACKBOX_GYRO_CAPTURE_SYNC_FRAME) {
+            logReadPos++;
+            EXPECT_EQ((uint32_t)(block * BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES), readUnsignedVB());
+            EXPECT_EQ(0, readUnsignedVB());
+            EXPECT_EQ(0, block % BLACKBOX_GYRO_CAPTURE_SYNC_BLOCKS);
+            syncFrames++;
+        }
+    }
+    EXPECT_EQ(2, syncFrames);
+}
+
+TEST(BlackboxGyroCaptureTest, OverrunResyncsAfterGap)
+{
+    resetLog();
+    blackboxGyroCaptureStart();
+
+    const int dropped = 5;
+    captureSamples(BLACKBOX_GYRO_CAPTURE_RING_SIZE + dropped, 0);
+    EXPECT_TRUE(blackboxGyroCapture.overrun);
+    EXPECT_EQ((uint32_t)dropped, blackboxGyroCapture.droppedSamples);
+
+    // the backlog before the gap is discarded, and counted as dropped too
+    EXPECT_EQ(0, blackboxGyroCaptureWriteBlocks());
+    EXPECT_EQ(0, logWritePos);
+    EXPECT_EQ((uint32_t)(BLACKBOX_GYRO_CAPTURE_RING_SIZE + dropped), blackboxGyroCapture.droppedSamples);
+
+    captureSamples(BLACKBOX_GYRO_CAPTURE_BLOCK_SAMPLES, 200);
+    EXPECT_EQ(1, blackboxGyroCaptureWriteBlocks());
+
+    // every sample before the block was either written or counted as dropped
+    EXPECT_EQ(BLACKBOX_GYRO_CAPTURE_SYNC_FRAME, logBuffer[logReadPos++]);
+    EXPECT_EQ((uint32_t)(BLACKBOX_GYRO_CAPTURE_RING_SIZE + dropped), readUnsignedVB());
+    EXPECT_EQ((uint32_t)(BLACKBOX_GYRO_CAPTURE_RING_SIZE + dropped), readUnsignedVB());
+    expectBlock(200);
+    EXPECT_EQ(logWritePos, logReadPos);
+}
+
+// STUBS
+extern "C" {
+int32_t blackboxHeaderBudget;
+void blackboxWrite(uint8_t value)
+{
+    EXPECT_LT(logWritePos, LOG_BUFFER_SIZE);
+    logBuffer[logWritePos++] = value;
+}
+int blackboxWriteString(const char *s)
+{
+    const int length = strlen(s);
+    while (*s) {
+        blackboxWrite(*s++);
+    }
+    return length;
+}
+}
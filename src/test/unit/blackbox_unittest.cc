@@ -51,6 +51,13 @@ extern "C" {
 
     extern int16_t blackboxIInterval;
     extern int16_t blackboxPInterval;
+
+    extern uint32_t serialTxBytesFreeStub;
+    extern int serialBytesWritten;
+    extern serialPortConfig_t *serialPortConfigStub;
+    extern serialPort_t *serialPortStub;
+
+    extern struct pidProfile_s *currentPidProfile;
 }
 
 #include "unittest_macros.h"
@@ -349,10 +356,108 @@ TEST(BlackboxTest, Test_CalculateRates)
 
 }
 
+static int bytesWrittenBy(void (*writeFrame)(void))
+{
+    serialBytesWritten = 0;
+    writeFrame();
+    return serialBytesWritten;
+}
+
+TEST(BlackboxTest, Test_FieldsDisabledMask)
+{
+    static serialPortConfig_t portConfig;
+    static serialPort_t port;
+    static pidProfile_t pidProfile;
+
+    pidProfile.pid[PID_ROLL].D = 30;
+    pidProfile.pid[PID_PITCH].D = 30;
+    pidProfile.pid[PID_YAW].D = 0;
+    currentPidProfile = &pidProfile;
+
+    serialPortConfigStub = &portConfig;
+    serialPortStub = &port;
+    serialTxBytesFreeStub = 1024;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->p_ratio = 32;
+    targetPidLooptime = 1000;
+    blackboxInit();
+
+    // everything enabled
+    blackboxConfigMutable()->fields_disabled_mask = 0;
+    blackboxStart();
+    const int allIntraframeBytes = bytesWrittenBy(writeIntraframe);
+    const int allInterframeBytes = bytesWrittenBy(writeInterframe);
+
+    // only the frame marker, loop iteration and time are left when every group is disabled
+    blackboxConfigMutable()->fields_disabled_mask = (1 << FLIGHT_LOG_FIELD_SELECT_COUNT) - 1;
+    blackboxStart();
+    EXPECT_EQ(3, bytesWrittenBy(writeIntraframe));
+    EXPECT_EQ(2, bytesWrittenBy(writeInterframe));
+
+    // gyro and motors only, as used for filter tuning: 3 gyro axes and 4 motors on top of the above
+    blackboxConfigMutable()->fields_disabled_mask = ((1 << FLIGHT_LOG_FIELD_SELECT_COUNT) - 1)
+        & ~((1 << FLIGHT_LOG_FIELD_SELECT_GYRO) | (1 << FLIGHT_LOG_FIELD_SELECT_MOTOR));
+    blackboxStart();
+    EXPECT_EQ(3 + 3 + 4, bytesWrittenBy(writeIntraframe));
+    EXPECT_EQ(2 + 3 + 4, bytesWrittenBy(writeInterframe));
+    EXPECT_LT(3 + 3 + 4, allIntraframeBytes);
+    EXPECT_LT(2 + 3 + 4, allInterframeBytes);
+
+    // disabling PIDs drops P, I, D (for the two non-zero D terms) and F
+    blackboxConfigMutable()->fields_disabled_mask = 1 << FLIGHT_LOG_FIELD_SELECT_PID;
+    blackboxStart();
+    EXPECT_EQ(allIntraframeBytes - (3 + 3 + 2 + 3), bytesWrittenBy(writeIntraframe));
+
+    blackboxConfigMutable()->fields_disabled_mask = 0;
+    serialTxBytesFreeStub = 0;
+    serialPortStub = NULL;
+    serialPortConfigStub = NULL;
+    currentPidProfile = NULL;
+}
+
+TEST(BlackboxTest, Test_AdaptiveEncodingSelectionFrame)
+{
+    static serialPortConfig_t portConfig;
+    static serialPort_t port;
+    static pidProfile_t pidProfile;
+
+    currentPidProfile = &pidProfile;
+    serialPortConfigStub = &portConfig;
+    serialPortStub = &port;
+    serialTxBytesFreeStub = 1024;
+    blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    blackboxConfigMutable()->p_ratio = 32;
+    targetPidLooptime = 1000;
+    blackboxInit();
+
+    blackboxConfigMutable()->adaptive_encoding = 0;
+    blackboxStart();
+    const int intraframeBytes = bytesWrittenBy(writeIntraframe);
+    const int interframeBytes = bytesWrittenBy(writeInterframe);
+
+    // every I-frame is followed by a selection frame for the gyro, acc, debug and motor groups
+    blackboxConfigMutable()->adaptive_encoding = 1;
+    blackboxStart();
+    EXPECT_EQ(intraframeBytes + 1 + 4, bytesWrittenBy(writeIntraframe));
+
+    // the initial selection is the version 2 encoding, so P-frames are unchanged until the selection changes
+    EXPECT_EQ(interframeBytes, bytesWrittenBy(writeInterframe));
+
+    blackboxConfigMutable()->adaptive_encoding = 0;
+    serialTxBytesFreeStub = 0;
+    serialPortStub = NULL;
+    serialPortConfigStub = NULL;
+    currentPidProfile = NULL;
+}
 
 // STUBS
 extern "C" {
 
+uint32_t serialTxBytesFreeStub = 0;
+int serialBytesWritten = 0;
+serialPortConfig_t *serialPortConfigStub = NULL;
+serialPort_t *serialPortStub = NULL;
+
 PG_REGISTER(flight3DConfig_t, flight3DConfig, PG_MOTOR_3D_CONFIG, 0);
 PG_REGISTER(mixerConfig_t, mixerConfig, PG_MIXER_CONFIG, 0);
 PG_REGISTER(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
@@ -389,14 +494,14 @@ bool IS_RC_MODE_ACTIVE(boxId_e) {return false;}
 bool isModeActivationConditionPresent(boxId_e) {return false;}
 uint32_t millis(void) {return 0;}
 bool sensors(uint32_t) {return false;}
-void serialWrite(serialPort_t *, uint8_t) {}
-uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
+void serialWrite(serialPort_t *, uint8_t) {serialBytesWritten++;}
+uint32_t serialTxBytesFree(const serialPort_t *) {return serialTxBytesFreeStub;}
 bool isSerialTransmitBufferEmpty(const serialPort_t *) {return false;}
 bool featureIsEnabled(uint32_t) {return false;}
 void mspSerialReleasePortIfAllocated(serialPort_t *) {}
-serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return serialPortConfigStub;}
 serialPort_t *findSharedSerialPort(uint16_t , serialPortFunction_e ) {return NULL;}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return NULL;}
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, void *, uint32_t, portMode_e, portOptions_e) {return serialPortStub;}
 void closeSerialPort(serialPort_t *) {}
 portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e ) {return PORTSHARING_UNUSED;}
 failsafePhase_e failsafePhase(void) {return FAILSAFE_IDLE;}
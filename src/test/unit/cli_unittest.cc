@@ -29,6 +29,7 @@ extern "C" {
     #include "cli/cli.h"
     #include "cli/settings.h"
     #include "common/printf.h"
+    #include "config/config_eeprom.h"
     #include "config/feature.h"
     #include "drivers/buf_writer.h"
     #include "drivers/vtx_common.h"
@@ -58,12 +59,18 @@ extern "C" {
     int cliGetSettingIndex(char *name, uint8_t length);
     void *cliGetValuePointer(const clivalue_t *value);
     
+    // Not in name order, like the real table, so that looking settings up relies on the sorted index
     const clivalue_t valueTable[] = {
-        { "array_unit_test",   VAR_INT8  | MODE_ARRAY  | MASTER_VALUE, .config.array.length = 3,      PG_RESERVED_FOR_TESTING_1, 0 },
-        { "str_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, .config.string = { 0, 16, 0 }, PG_RESERVED_FOR_TESTING_1, 0 },
-        { "wos_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, .config.string = { 0, 16, STRING_FLAGS_WRITEONCE }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "wos_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, { .string = { 0, 16, STRING_FLAGS_WRITEONCE } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "str_unit_test",     VAR_UINT8 | MODE_STRING | MASTER_VALUE, { .string = { 0, 16, 0 } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "mid_unit_test",     VAR_UINT8 | MODE_DIRECT | MASTER_VALUE, { .minmaxUnsigned = { 0, 100 } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "array_unit_test",   VAR_INT8  | MODE_ARRAY  | MASTER_VALUE, { .array = { 3 } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "str_unit",          VAR_UINT8 | MODE_DIRECT | MASTER_VALUE, { .minmaxUnsigned = { 0, 100 } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "beta_unit_test",    VAR_UINT8 | MODE_DIRECT | MASTER_VALUE, { .minmaxUnsigned = { 0, 100 } }, PG_RESERVED_FOR_TESTING_1, 0 },
+        { "Alpha_unit_test",   VAR_UINT8 | MODE_DIRECT | MASTER_VALUE, { .minmaxUnsigned = { 0, 100 } }, PG_RESERVED_FOR_TESTING_1, 0 },
     };
     const uint16_t valueTableEntryCount = ARRAYLEN(valueTable);
+    uint16_t valueTableNameOrder[ARRAYLEN(valueTable)];
     const lookupTableEntry_t lookupTables[] = {};
 
 
@@ -119,6 +126,29 @@ TEST(CLIUnittest, TestCliSetArray)
     //EXPECT_EQ(false, false);
 }
 
+TEST(CLIUnittest, TestCliGetSettingIndex)
+{
+    EXPECT_EQ(3, cliGetSettingIndex((char *)"array_unit_test", 15));
+    EXPECT_EQ(1, cliGetSettingIndex((char *)"STR_UNIT_TEST = 1", 13));
+    EXPECT_EQ(0, cliGetSettingIndex((char *)"wos_unit_test", 13));
+    EXPECT_EQ(4, cliGetSettingIndex((char *)"str_unit", 8));
+    EXPECT_EQ(6, cliGetSettingIndex((char *)"alpha_unit_test", 15));
+
+    // every setting is found, and the index is in name order
+    for (unsigned i = 0; i < valueTableEntryCount; i++) {
+        EXPECT_EQ(i, cliGetSettingIndex((char *)valueTable[i].name, strlen(valueTable[i].name)));
+        if (i > 0) {
+            EXPECT_LT(strcasecmp(valueTable[valueTableNameOrder[i - 1]].name, valueTable[valueTableNameOrder[i]].name), 0);
+        }
+    }
+
+    // only exact matches are found
+    EXPECT_EQ(valueTableEntryCount, cliGetSettingIndex((char *)"str_uni", 7));
+    EXPECT_EQ(valueTableEntryCount, cliGetSettingIndex((char *)"str_unit_test_2", 15));
+    EXPECT_EQ(valueTableEntryCount, cliGetSettingIndex((char *)"aaa", 3));
+    EXPECT_EQ(valueTableEntryCount, cliGetSettingIndex((char *)"zzz", 3));
+}
+
 TEST(CLIUnittest, TestCliSetStringNoFlags)
 {
     char *str = (char *)"str_unit_test    =   SAMPLE"; 
@@ -297,6 +327,7 @@ const char * getBatteryStateString(void){ return "_getBatteryStateString_"; }
 uint32_t stackTotalSize(void) { return 0x4000; }
 uint32_t stackHighMem(void) { return 0x80000000; }
 uint16_t getEEPROMConfigSize(void) { return 1024; }
+const configSaveStats_t *getConfigSaveStats(void) { static configSaveStats_t stats; return &stats; }
 
 uint8_t __config_start = 0x00;
 uint8_t __config_end = 0x10;
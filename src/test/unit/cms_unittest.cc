@@ -18,6 +18,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <limits.h>
 
@@ -35,6 +36,8 @@ extern "C" {
     void cmsMenuOpen(void);
     long cmsMenuBack(displayPort_t *pDisplay);
     uint16_t cmsHandleKey(displayPort_t *pDisplay, uint8_t key);
+    void cmsHandler(timeUs_t currentTimeUs);
+    extern int16_t rcData[18];
     extern CMS_Menu *currentMenu;    // Points to top entry of the current page
 }
 
@@ -115,6 +118,155 @@ TEST(CMSUnittest, TestCmsMenuKey)
     uint16_t result = cmsHandleKey(displayPort, KEY_ESC);
     EXPECT_EQ(BUTTON_PAUSE, result);
 }
+
+// A page of polled values, like the RC preview menu
+
+#define TEST_POLLED_ROWS 12
+
+static uint16_t polledValues[TEST_POLLED_ROWS];
+
+static OSD_UINT16_t polledData[TEST_POLLED_ROWS];
+
+#define POLLED_ENTRY(label, n) { label, OME_UINT16, NULL, &polledData[n], DYNAMIC }
+
+static OSD_Entry polledEntries[] = {
+    POLLED_ENTRY("CH1", 0),
+    POLLED_ENTRY("CH2", 1),
+    POLLED_ENTRY("CH3", 2),
+    POLLED_ENTRY("CH4", 3),
+    POLLED_ENTRY("CH5", 4),
+    POLLED_ENTRY("CH6", 5),
+    POLLED_ENTRY("CH7", 6),
+    POLLED_ENTRY("CH8", 7),
+    POLLED_ENTRY("CH9", 8),
+    POLLED_ENTRY("CH10", 9),
+    POLLED_ENTRY("CH11", 10),
+    POLLED_ENTRY("CH12", 11),
+    { NULL, OME_END, NULL, NULL, 0 }
+};
+
+static CMS_Menu polledMenu = {
+#ifdef CMS_MENU_DEBUG
+    .GUARD_text = "POLLED",
+    .GUARD_type = OME_MENU,
+#endif
+    .onEnter = NULL,
+    .onExit = NULL,
+    .checkRedirect = NULL,
+    .entries = polledEntries,
+};
+
+static uint32_t testTimeUs = 0;
+
+// A display that is short of room to send, as MSP or CRSF can be
+static const displayPortVTable_t *virtualVTable;
+static displayPortVTable_t limitedVTable;
+static uint32_t limitedTxBytesFree;
+
+static int limitedWriteString(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *s)
+{
+    virtualVTable->writeString(displayPort, x, y, s);
+    return 6 * strlen(s);
+}
+
+static uint32_t limitedTxBytes(const displayPort_t *displayPort)
+{
+    UNUSED(displayPort);
+    return limitedTxBytesFree;
+}
+
+static displayPort_t *openPolledMenu(uint32_t txBytesFree)
+{
+    for (int i = 0; i < TEST_POLLED_ROWS; i++) {
+        polledValues[i] = 1500;
+        polledData[i] = { &polledValues[i], 0, 2500, 0 };
+    }
+
+    cmsInit();
+    displayPort_t *displayPort = displayPortTestInit();
+    virtualVTable = displayPort->vTable;
+    limitedVTable = *virtualVTable;
+    limitedVTable.writeString = limitedWriteString;
+    limitedVTable.txBytesFree = limitedTxBytes;
+    limitedTxBytesFree = txBytesFree;
+    displayPort->vTable = &limitedVTable;
+    cmsDisplayPortRegister(displayPort);
+
+    for (int i = 0; i < 18; i++) {
+        rcData[i] = 1500; // sticks centred, no keys
+    }
+
+    cmsMenuOpen();
+    cmsMenuChange(displayPort, &polledMenu);
+    return displayPort;
+}
+
+static void runCms(int updates)
+{
+    for (int i = 0; i < updates; i++) {
+        testTimeUs += 50000;
+        cmsHandler(testTimeUs);
+    }
+}
+
+TEST(CMSUnittest, TestPolledValuesOnlySentWhenChanged)
+{
+    displayPort_t *displayPort = openPolledMenu(UINT32_MAX);
+    runCms(2);
+
+    // when
+    displayPortVirtualResetStats();
+    runCms(20); // a second
+    const uint32_t unchangedCells = displayPortVirtualStats()->cellsWritten;
+
+    // then
+    EXPECT_EQ(0, unchangedCells);
+
+    // when
+    polledValues[3] = 1234;
+    runCms(2);
+
+    // then
+    EXPECT_EQ(5, displayPortVirtualStats()->cellsWritten);
+    EXPECT_NE(nullptr, strstr(displayPortVirtualBuffer(), " 1234"));
+
+    // when
+    displayPortVirtualResetStats();
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < TEST_POLLED_ROWS; j++) {
+            polledValues[j] = 1000 + i * 10 + j;
+        }
+        runCms(1);
+    }
+
+    // then every row is redrawn on every update
+    EXPECT_GE(displayPortVirtualStats()->cellsWritten, 20u * TEST_POLLED_ROWS);
+
+    cmsMenuExit(displayPort, (void*)0);
+}
+
+TEST(CMSUnittest, TestEveryPolledRowDrawnWhenShortOfRoom)
+{
+    // given room for two values per update
+    displayPort_t *displayPort = openPolledMenu(61);
+    runCms(2 * TEST_POLLED_ROWS);
+
+    // when every value keeps changing
+    for (int i = 0; i < 2 * TEST_POLLED_ROWS; i++) {
+        for (int j = 0; j < TEST_POLLED_ROWS; j++) {
+            polledValues[j] = 2000 + i;
+        }
+        runCms(1);
+    }
+
+    // then the bottom rows are not starved by the top ones
+    const char *lastRow = strstr(displayPortVirtualBuffer(), "CH12");
+    ASSERT_NE(nullptr, lastRow);
+    EXPECT_EQ(nullptr, strstr(displayPortVirtualBuffer(), "1500"));
+
+    cmsMenuExit(displayPort, (void*)0);
+}
+
 // STUBS
 
 extern "C" {
@@ -139,8 +291,8 @@ uint8_t armingFlags;
 int16_t debug[4];
 int16_t rcData[18];
 void delay(uint32_t) {}
-uint32_t micros(void) { return 0; }
-uint32_t millis(void) { return 0; }
+uint32_t micros(void) { return testTimeUs; }
+uint32_t millis(void) { return testTimeUs / 1000; }
 void saveConfigAndNotify(void) {}
 void stopMotors(void) {}
 void motorShutdown(void) {}
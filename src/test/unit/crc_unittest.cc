@@ -0,0 +1,203 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/crc.h"
+    #include "common/streambuf.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+// The bit at a time implementations that the table driven ones replaced
+
+static uint16_t bitwiseCrc16Ccitt(uint16_t crc, uint8_t a)
+{
+    crc ^= (uint16_t)a << 8;
+    for (int ii = 0; ii < 8; ++ii) {
+        if (crc & 0x8000) {
+            crc = (crc << 1) ^ 0x1021;
+        } else {
+            crc = crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint8_t bitwiseCrc8DvbS2(uint8_t crc, uint8_t a)
+{
+    crc ^= a;
+    for (int ii = 0; ii < 8; ++ii) {
+        if (crc & 0x80) {
+            crc = (crc << 1) ^ 0xD5;
+        } else {
+            crc = crc << 1;
+        }
+    }
+    return crc;
+}
+
+// From sensors/esc_sensor.c
+static uint8_t bitwiseCrc8Poly07(uint8_t crc, uint8_t a)
+{
+    crc ^= a;
+    for (int i = 0; i < 8; i++) {
+        crc = (crc & 0x80) ? 0x7 ^ (crc << 1) : (crc << 1);
+    }
+    return crc;
+}
+
+// From telemetry/jetiexbus.c
+static uint8_t jetiCrc8(uint8_t crc, uint8_t a)
+{
+    crc ^= a;
+    return crc ^ (crc << 1) ^ (crc << 2) ^ (0x0e090700 >> ((crc >> 3) & 0x18));
+}
+
+static uint8_t testData[1024];
+
+static void fillTestData(void)
+{
+    srand(1);
+    for (unsigned i = 0; i < sizeof(testData); i++) {
+        testData[i] = rand();
+    }
+}
+
+TEST(CrcTest, Crc16CcittMatchesBitwiseForEveryCrcAndByte)
+{
+    int mismatches = 0;
+    for (int crc = 0; crc <= 0xFFFF; crc++) {
+        for (int a = 0; a <= 0xFF; a++) {
+            mismatches += bitwiseCrc16Ccitt(crc, a) != crc16_ccitt(crc, a);
+        }
+    }
+    EXPECT_EQ(0, mismatches);
+}
+
+TEST(CrcTest, Crc8MatchesBitwiseForEveryCrcAndByte)
+{
+    int mismatches = 0;
+    for (int crc = 0; crc <= 0xFF; crc++) {
+        for (int a = 0; a <= 0xFF; a++) {
+            mismatches += bitwiseCrc8DvbS2(crc, a) != crc8_dvb_s2(crc, a);
+            mismatches += bitwiseCrc8Poly07(crc, a) != crc8_poly_07(crc, a);
+            mismatches += jetiCrc8(crc, a) != crc8_poly_07(crc, a);
+        }
+    }
+    EXPECT_EQ(0, mismatches);
+}
+
+TEST(CrcTest, BulkUpdateMatchesBitwiseForAnyAlignmentAndLength)
+{
+    fillTestData();
+
+    const uint16_t crcs[] = { 0x0000, 0x1D0F, 0xFFFF, 0xA55A };
+    for (const uint16_t initialCrc : crcs) {
+        for (int offset = 0; offset < 8; offset++) {
+            uint16_t crc16 = initialCrc;
+            uint8_t crc8 = initialCrc;
+            uint8_t crc8Poly07 = initialCrc;
+
+            for (int length = 0; length <= 300; length++) {
+                EXPECT_EQ(crc16, crc16_ccitt_update(initialCrc, testData + offset, length)) << "offset " << offset << " length " << length;
+                EXPECT_EQ(crc8, crc8_dvb_s2_update(initialCrc, testData + offset, length)) << "offset " << offset << " length " << length;
+                EXPECT_EQ(crc8Poly07, crc8_poly_07_update(initialCrc, testData + offset, length)) << "offset " << offset << " length " << length;
+
+                crc16 = bitwiseCrc16Ccitt(crc16, testData[offset + length]);
+                crc8 = bitwiseCrc8DvbS2(crc8, testData[offset + length]);
+                crc8Poly07 = bitwiseCrc8Poly07(crc8Poly07, testData[offset + length]);
+            }
+        }
+    }
+}
+
+TEST(CrcTest, SbufAppend)
+{
+    fillTestData();
+
+    uint8_t buffer[64];
+    sbuf_t sbuf;
+
+    sbuf.ptr = buffer;
+    sbuf.end = buffer + sizeof(buffer);
+    sbufWriteData(&sbuf, testData, 37);
+    crc8_dvb_s2_sbuf_append(&sbuf, buffer + 2);
+    EXPECT_EQ(38, sbuf.ptr - buffer);
+    EXPECT_EQ(crc8_dvb_s2_update(0, testData + 2, 35), buffer[37]);
+    // the CRC of a frame including its CRC is zero
+    EXPECT_EQ(0, crc8_dvb_s2_update(0, buffer + 2, 36));
+
+    sbuf.ptr = buffer;
+    sbufWriteData(&sbuf, testData, 37);
+    crc16_ccitt_sbuf_append(&sbuf, buffer + 3);
+    EXPECT_EQ(39, sbuf.ptr - buffer);
+    const uint16_t crc = crc16_ccitt_update(0, testData + 3, 34);
+    EXPECT_EQ(crc & 0xFF, buffer[37]);
+    EXPECT_EQ(crc >> 8, buffer[38]);
+}
+
+// Not run by default, run the test binary with --gtest_also_run_disabled_tests and the rates are recorded as the
+// bitwiseKBps and sliceBy4KBps properties of the test, in the XML output if --gtest_output=xml is given
+TEST(CrcTest, DISABLED_Benchmark)
+{
+    fillTestData();
+
+    const int iterations = 2000;
+    const int frameLength = 64; // a typical MSP reply
+    uint32_t sum = 0;
+
+    const auto bitwiseStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (unsigned offset = 0; offset + frameLength <= sizeof(testData); offset += frameLength) {
+            uint8_t crc8 = 0;
+            uint16_t crc16 = 0;
+            for (int j = 0; j < frameLength; j++) {
+                crc8 = bitwiseCrc8DvbS2(crc8, testData[offset + j]);
+                crc16 = bitwiseCrc16Ccitt(crc16, testData[offset + j]);
+            }
+            sum += crc8 + crc16;
+        }
+    }
+    const auto bitwiseEnd = std::chrono::steady_clock::now();
+
+    const auto tableStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        for (unsigned offset = 0; offset + frameLength <= sizeof(testData); offset += frameLength) {
+            sum -= crc8_dvb_s2_update(0, testData + offset, frameLength) + crc16_ccitt_update(0, testData + offset, frameLength);
+        }
+    }
+    const auto tableEnd = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(0, sum);
+
+    const double kilobytes = (double)iterations * sizeof(testData) / 1e3;
+    const double bitwiseS = std::chrono::duration<double>(bitwiseEnd - bitwiseStart).count();
+    const double tableS = std::chrono::duration<double>(tableEnd - tableStart).count();
+    RecordProperty("bitwiseKBps", (int)(kilobytes / bitwiseS));
+    RecordProperty("sliceBy4KBps", (int)(kilobytes / tableS));
+}
@@ -0,0 +1,356 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/bus.h"
+    #include "drivers/bus_i2c.h"
+    #include "drivers/display_ug2864hsweg01.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define OLED_ADDRESS 0x3C
+
+// A SSD1306 display RAM in horizontal addressing mode, driven by I2C writes
+typedef struct oledModel_s {
+    uint8_t ram[SCREEN_HEIGHT / 8][SCREEN_WIDTH];
+    uint8_t page;
+    uint8_t column;
+    int commandArgs;    // argument bytes still to come for the last command
+} oledModel_t;
+
+static oledModel_t model;
+static bool i2cBusBusy;         // another device has the bus
+static int transferPolls;       // how many times i2cBusy reports each transfer in progress
+static int busyPolls;           // and how many more for the one in progress
+static bool nackNext;           // the display doesn't acknowledge the next transfer
+static bool transferError;
+static int transfers;
+static int dataBytes;
+static int largestTransfer;
+
+static void modelCommand(uint8_t command)
+{
+    if (model.commandArgs) {
+        model.commandArgs--;
+    } else if (command >= 0xb0 && command <= 0xb7) {
+        model.page = command & 0x07;
+    } else if (command <= 0x0f) {
+        model.column = (model.column & 0xf0) | command;
+    } else if (command >= 0x10 && command <= 0x1f) {
+        model.column = (model.column & 0x0f) | ((command & 0x0f) << 4);
+    } else if (command == 0x20 || command == 0x81 || command == 0x8d || command == 0xa8
+        || command == 0xd3 || command == 0xd4 || command == 0xd9 || command == 0xda || command == 0xdb) {
+        model.commandArgs = 1;
+    }
+}
+
+static void modelData(uint8_t data)
+{
+    model.ram[model.page][model.column] = data;
+    if (++model.column >= SCREEN_WIDTH) {
+        model.column = 0;
+        model.page = (model.page + 1) % (SCREEN_HEIGHT / 8);
+    }
+}
+
+extern "C" {
+    bool i2cWriteBuffer(I2CDevice device, uint8_t addr, uint8_t reg, uint8_t len, uint8_t *data)
+    {
+        EXPECT_EQ(I2CDEV_1, device);
+        EXPECT_EQ(OLED_ADDRESS, addr);
+        if (i2cBusBusy || busyPolls) {
+            return false;
+        }
+        busyPolls = transferPolls;
+        transferError = nackNext;
+        if (nackNext) {
+            nackNext = false;
+            return true;
+        }
+        for (int i = 0; i < len; i++) {
+            if (reg == 0x40) {
+                modelData(data[i]);
+            } else {
+                EXPECT_EQ(0x00, reg);
+                modelCommand(data[i]);
+            }
+        }
+        if (reg == 0x40) {
+            dataBytes += len;
+        }
+        largestTransfer = len > largestTransfer ? len : largestTransfer;
+        transfers++;
+        return true;
+    }
+
+    bool i2cWrite(I2CDevice device, uint8_t addr, uint8_t reg, uint8_t data)
+    {
+        EXPECT_EQ(I2CDEV_1, device);
+        EXPECT_EQ(OLED_ADDRESS, addr);
+        if (i2cBusBusy || busyPolls) {
+            return false;
+        }
+        EXPECT_EQ(0x80, reg);
+        modelCommand(data);
+        return true;
+    }
+
+    // Sent in the background, the transfer finishes after being polled transferPolls times
+    bool i2cBusy(I2CDevice, bool *error)
+    {
+        if (busyPolls) {
+            busyPolls--;
+            return true;
+        }
+        if (error) {
+            *error = transferError;
+        }
+        return i2cBusBusy;
+    }
+
+    void delay(uint32_t)
+    {
+        busyPolls = 0;
+    }
+}
+
+class OledTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        bus.busdev_u.i2c.device = I2CDEV_1;
+        bus.busdev_u.i2c.address = OLED_ADDRESS;
+
+        memset(&model, 0xAA, sizeof(model.ram));
+        model.commandArgs = 0;
+        i2cBusBusy = false;
+        transferPolls = 0;
+        busyPolls = 0;
+        nackNext = false;
+        transferError = false;
+
+        EXPECT_TRUE(ug2864hsweg01InitI2C(&bus));
+        flushAll();
+        resetCounts();
+    }
+
+    void resetCounts() {
+        transfers = 0;
+        dataBytes = 0;
+        largestTransfer = 0;
+    }
+
+    // Calls i2c_OLED_flush as the dashboard task does
+    int flushAll() {
+        int calls = 0;
+        while (!i2c_OLED_flush(&bus)) {
+            calls++;
+            if (calls > 1000) {
+                ADD_FAILURE() << "flush did not finish";
+                break;
+            }
+        }
+        EXPECT_TRUE(i2c_OLED_is_synced());
+        return calls;
+    }
+
+    void expectBlank(int page, int startColumn, int endColumn) {
+        for (int column = startColumn; column < endColumn; column++) {
+            EXPECT_EQ(0, model.ram[page][column]) << "page " << page << " column " << column;
+        }
+    }
+
+    busDevice_t bus;
+};
+
+TEST_F(OledTest, InitClearsWholeDisplay)
+{
+    for (int page = 0; page < SCREEN_HEIGHT / 8; page++) {
+        expectBlank(page, 0, SCREEN_WIDTH);
+    }
+}
+
+TEST_F(OledTest, ClearingSendsTheWholeFramebufferInChunks)
+{
+    i2c_OLED_clear_display(&bus);
+    EXPECT_FALSE(i2c_OLED_is_synced());
+
+    // The RAM pointer is only set for the first page, the rest follow on from it
+    EXPECT_EQ(1 + SCREEN_WIDTH * SCREEN_HEIGHT / 8 / UG2864_FLUSH_CHUNK_BYTES, flushAll());
+    EXPECT_EQ(SCREEN_WIDTH * SCREEN_HEIGHT / 8, dataBytes);
+    EXPECT_EQ(UG2864_FLUSH_CHUNK_BYTES, largestTransfer);
+}
+
+TEST_F(OledTest, OnlyChangedColumnsAreSent)
+{
+    i2c_OLED_set_xy(&bus, 3, 2);
+    i2c_OLED_send_string(&bus, "AB");
+
+    // Nothing is sent until flushed
+    EXPECT_EQ(0, transfers);
+
+    // Setting the RAM pointer, then the data. The gap after the B is blank, as it was
+    EXPECT_EQ(2, flushAll());
+    EXPECT_EQ(2 * CHARACTER_WIDTH_TOTAL - 1, dataBytes);
+
+    const uint8_t a[] = { 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00 };
+    const uint8_t b[] = { 0x7F, 0x49, 0x49, 0x49, 0x36, 0x00 };
+    EXPECT_EQ(0, memcmp(a, &model.ram[2][3 * CHARACTER_WIDTH_TOTAL], sizeof(a)));
+    EXPECT_EQ(0, memcmp(b, &model.ram[2][4 * CHARACTER_WIDTH_TOTAL], sizeof(b)));
+    expectBlank(2, 0, 3 * CHARACTER_WIDTH_TOTAL);
+    expectBlank(2, 5 * CHARACTER_WIDTH_TOTAL, SCREEN_WIDTH);
+    expectBlank(1, 0, SCREEN_WIDTH);
+    expectBlank(3, 0, SCREEN_WIDTH);
+}
+
+TEST_F(OledTest, RedrawingTheSameTextSendsNothing)
+{
+    i2c_OLED_set_line(&bus, 4);
+    i2c_OLED_send_string(&bus, "Battery 16.8V");
+    flushAll();
+    resetCounts();
+
+    i2c_OLED_set_line(&bus, 4);
+    i2c_OLED_send_string(&bus, "Battery 16.8V");
+
+    EXPECT_TRUE(i2c_OLED_is_synced());
+    EXPECT_EQ(0, flushAll());
+    EXPECT_EQ(0, transfers);
+
+    // A changed digit only sends that digit's columns
+    i2c_OLED_set_line(&bus, 4);
+    i2c_OLED_send_string(&bus, "Battery 16.7V");
+    EXPECT_EQ(2, flushAll());
+    EXPECT_GE(FONT_WIDTH, dataBytes);
+}
+
+TEST_F(OledTest, NothingIsSentWhileTheBusIsBusy)
+{
+    i2c_OLED_set_line(&bus, 1);
+    i2c_OLED_send_string(&bus, "RX");
+
+    i2cBusBusy = true;
+    EXPECT_FALSE(i2c_OLED_flush(&bus));
+    EXPECT_EQ(0, transfers);
+
+    i2cBusBusy = false;
+    flushAll();
+    EXPECT_EQ(0x7F, model.ram[1][0]);
+}
+
+TEST_F(OledTest, TextWrapsOntoTheNextPage)
+{
+    i2c_OLED_set_xy(&bus, SCREEN_CHARACTER_COLUMN_COUNT - 1, 5);
+    i2c_OLED_send_string(&bus, "HHH");
+    flushAll();
+
+    const int column = (SCREEN_CHARACTER_COLUMN_COUNT - 1) * CHARACTER_WIDTH_TOTAL;
+    EXPECT_EQ(0x7F, model.ram[5][column]);
+    // The second H has two columns at the end of page 5 and the rest at the start of page 6
+    EXPECT_EQ(0x7F, model.ram[5][column + CHARACTER_WIDTH_TOTAL]);
+    EXPECT_EQ(0x08, model.ram[5][column + CHARACTER_WIDTH_TOTAL + 1]);
+    EXPECT_EQ(0x08, model.ram[6][0]);
+    EXPECT_EQ(0x7F, model.ram[6][2]);
+    // and the third follows it
+    EXPECT_EQ(0x7F, model.ram[6][4]);
+}
+
+TEST_F(OledTest, FlushStartsAChunkAndReturns)
+{
+    transferPolls = 3;
+    i2c_OLED_set_line(&bus, 3);
+    i2c_OLED_send_string(&bus, "GPS");
+
+    // Setting the RAM pointer is left to finish on its own
+    EXPECT_FALSE(i2c_OLED_flush(&bus));
+    EXPECT_EQ(1, transfers);
+    EXPECT_EQ(3, busyPolls);
+
+    // Each call looks at the bus once, and starts nothing until the transfer is done
+    for (int i = 0; i < 3; i++) {
+        EXPECT_FALSE(i2c_OLED_flush(&bus));
+        EXPECT_EQ(1, transfers);
+    }
+
+    // then the data goes
+    EXPECT_FALSE(i2c_OLED_flush(&bus));
+    EXPECT_EQ(2, transfers);
+    flushAll();
+    EXPECT_EQ(2, transfers);
+    EXPECT_EQ(0x7F, model.ram[3][CHARACTER_WIDTH_TOTAL]);
+}
+
+TEST_F(OledTest, ColumnsDrawnDuringTheirChunkAreSentAgain)
+{
+    transferPolls = 3;
+    i2c_OLED_set_line(&bus, 1);
+    i2c_OLED_send_string(&bus, "RX");
+    while (transfers < 2) {
+        i2c_OLED_flush(&bus);
+    }
+
+    // The R is on its way when it's changed to a T
+    i2c_OLED_set_line(&bus, 1);
+    i2c_OLED_send_string(&bus, "T");
+    flushAll();
+
+    const uint8_t t[] = { 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00 };
+    EXPECT_EQ(0, memcmp(t, &model.ram[1][0], sizeof(t)));
+}
+
+TEST_F(OledTest, ChunksNotAcknowledgedAreSentAgain)
+{
+    i2c_OLED_set_line(&bus, 1);
+    i2c_OLED_send_string(&bus, "RX");
+
+    // the RAM pointer, then the data, which isn't acknowledged
+    EXPECT_FALSE(i2c_OLED_flush(&bus));
+    nackNext = true;
+    EXPECT_FALSE(i2c_OLED_flush(&bus));
+    EXPECT_FALSE(i2c_OLED_is_synced());
+    expectBlank(1, 0, SCREEN_WIDTH);
+
+    // Where the RAM pointer is isn't known, so it's set again
+    resetCounts();
+    EXPECT_EQ(2, flushAll());
+    EXPECT_EQ(0x7F, model.ram[1][0]);
+}
+
+TEST_F(OledTest, ReinitialisingWaitsForTheBus)
+{
+    i2c_OLED_set_line(&bus, 0);
+    i2c_OLED_send_string(&bus, "WELCOME");
+
+    // A chunk that takes too long is left to finish
+    transferPolls = 100000;
+    EXPECT_FALSE(i2c_OLED_flush(&bus));
+    EXPECT_TRUE(i2cBusy(I2CDEV_1, NULL));
+    transferPolls = 3;
+
+    EXPECT_TRUE(ug2864hsweg01InitI2C(&bus));
+    flushAll();
+    expectBlank(0, 0, SCREEN_WIDTH);
+}
@@ -0,0 +1,278 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/display.h"
+
+    #include "io/displayport_msp.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_protocol.h"
+    #include "msp/msp_serial.h"
+
+    #include "pg/pg.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define ROWS MSP_DISPLAYPORT_MAX_ROWS
+#define COLS MSP_DISPLAYPORT_MAX_COLS
+
+// A receiver, showing what it was sent when told to draw, which by default only knows MSP_DP_WRITE_STRING
+static struct {
+    char canvas[ROWS][COLS];
+    char screen[ROWS][COLS];
+    int frames;
+    int bytes;
+    int draws;
+    int clears;
+    bool knowsBatchedWrites;
+} receiver;
+
+static uint32_t txBytesFree;
+static bool dropWrites; // as if the port refused the frames carrying characters
+static uint32_t simulationTime;
+
+static void receiverWrite(uint8_t row, uint8_t col, const uint8_t *string, int len)
+{
+    ASSERT_LT(row, ROWS);
+    ASSERT_LE(col + len, COLS);
+    memcpy(&receiver.canvas[row][col], string, len);
+}
+
+static void resetReceiver(void)
+{
+    memset(&receiver, 0, sizeof(receiver));
+    memset(receiver.canvas, ' ', sizeof(receiver.canvas));
+    memset(receiver.screen, ' ', sizeof(receiver.screen));
+}
+
+class DisplayPortMspTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        resetReceiver();
+        txBytesFree = 1024;
+        dropWrites = false;
+        simulationTime = 0;
+        displayPortProfileMspMutable()->batchWrites = false;
+
+        displayPort = displayPortMspInit();
+        memset(expected, ' ', sizeof(expected));
+    }
+
+    void write(uint8_t col, uint8_t row, const char *string) {
+        displayWrite(displayPort, col, row, string);
+        memcpy(&expected[row][col], string, strlen(string));
+    }
+
+    void clear() {
+        displayClearScreen(displayPort);
+        memset(expected, ' ', sizeof(expected));
+    }
+
+    void expectShown() {
+        for (int row = 0; row < ROWS; row++) {
+            EXPECT_EQ(0, memcmp(expected[row], receiver.screen[row], COLS)) << "row " << row;
+        }
+    }
+
+    displayPort_t *displayPort;
+    char expected[ROWS][COLS];
+};
+
+TEST_F(DisplayPortMspTest, OnlyChangesAreSent)
+{
+    write(2, 1, "RSSI 99");
+    write(20, 10, "12.6V");
+    displayDrawScreen(displayPort);
+    expectShown();
+    EXPECT_EQ(1, receiver.clears);
+
+    // Redrawing the same screen sends nothing
+    const int frames = receiver.frames;
+    clear();
+    write(2, 1, "RSSI 99");
+    write(20, 10, "12.6V");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(frames, receiver.frames);
+    expectShown();
+
+    // One write of the changed characters and a draw
+    write(20, 10, "12.5V");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(frames + 2, receiver.frames);
+    expectShown();
+
+    // Cleared characters are blanked
+    clear();
+    write(2, 1, "RSSI 99");
+    displayDrawScreen(displayPort);
+    expectShown();
+    EXPECT_EQ(1, receiver.clears);
+}
+
+TEST_F(DisplayPortMspTest, BatchedWritesUseFewerBytes)
+{
+    int bytes[2];
+
+    for (int batch = 0; batch < 2; batch++) {
+        SetUp();
+        displayPortProfileMspMutable()->batchWrites = batch;
+        receiver.knowsBatchedWrites = batch;
+        displayDrawScreen(displayPort);
+        receiver.bytes = 0;
+
+        srand(1);
+        for (int frame = 0; frame < 100; frame++) {
+            char buf[8];
+            for (int row = 0; row < ROWS; row += 2) {
+                snprintf(buf, sizeof(buf), "%d", rand() % 1000);
+                write(row % 3 * 10, row, buf);
+            }
+            displayDrawScreen(displayPort);
+            expectShown();
+        }
+        bytes[batch] = receiver.bytes;
+    }
+
+    printf("MSP_DP_WRITE_STRING %d bytes, MSP_DP_WRITE_STRINGS %d bytes\n", bytes[0], bytes[1]);
+    EXPECT_LT(bytes[1], bytes[0]);
+}
+
+TEST_F(DisplayPortMspTest, WhatDoesntFitIsSentLater)
+{
+    displayDrawScreen(displayPort);
+
+    for (int row = 0; row < ROWS; row++) {
+        write(0, row, "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123");
+    }
+
+    txBytesFree = 100;
+    for (int i = 0; i < ROWS; i++) {
+        receiver.bytes = 0;
+        displayDrawScreen(displayPort);
+        EXPECT_LE(receiver.bytes, 100);
+    }
+    expectShown();
+}
+
+TEST_F(DisplayPortMspTest, LateReceiverCatchesUp)
+{
+    for (int row = 0; row < ROWS; row++) {
+        write(row, row, "STATIC");
+    }
+    displayDrawScreen(displayPort);
+    expectShown();
+
+    // Turned on after the FC
+    resetReceiver();
+    for (int i = 0; i < ROWS; i++) {
+        simulationTime += 100000;
+        displayDrawScreen(displayPort);
+    }
+    expectShown();
+}
+
+TEST_F(DisplayPortMspTest, ReleaseClearsOnNextDraw)
+{
+    write(0, 0, "MENU");
+    displayDrawScreen(displayPort);
+    displayRelease(displayPort);
+    clear();
+    write(0, 0, "MENU");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(2, receiver.clears);
+    expectShown();
+}
+
+TEST_F(DisplayPortMspTest, WritesThatFailAreSentAgain)
+{
+    for (int batch = 0; batch < 2; batch++) {
+        SetUp();
+        displayPortProfileMspMutable()->batchWrites = batch;
+        receiver.knowsBatchedWrites = batch;
+        displayDrawScreen(displayPort);
+
+        write(2, 1, "RSSI 99");
+        write(20, 10, "12.6V");
+        dropWrites = true;
+        displayDrawScreen(displayPort);
+        EXPECT_EQ(' ', receiver.screen[1][2]);
+
+        dropWrites = false;
+        displayDrawScreen(displayPort);
+        expectShown();
+    }
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) { return simulationTime; }
+
+uint32_t mspSerialTxBytesFree(void) { return txBytesFree; }
+
+int mspSerialPush(uint8_t cmd, uint8_t *data, int datalen, mspDirection_e direction)
+{
+    EXPECT_EQ(MSP_DISPLAYPORT, cmd);
+    EXPECT_EQ(MSP_DIRECTION_REPLY, direction);
+
+    const int frameSize = 6 + datalen;
+    if ((uint32_t)frameSize > txBytesFree) {
+        return 0;
+    }
+    if (dropWrites && (data[0] == MSP_DP_WRITE_STRING || data[0] == MSP_DP_WRITE_STRINGS)) {
+        return 0;
+    }
+    receiver.frames++;
+    receiver.bytes += frameSize;
+
+    switch (data[0]) {
+    case MSP_DP_CLEAR_SCREEN:
+        receiver.clears++;
+        memset(receiver.canvas, ' ', sizeof(receiver.canvas));
+        break;
+    case MSP_DP_WRITE_STRING:
+        receiverWrite(data[1], data[2], &data[4], datalen - 4);
+        break;
+    case MSP_DP_WRITE_STRINGS:
+        EXPECT_TRUE(receiver.knowsBatchedWrites);
+        for (int i = 1; i < datalen; i += 4 + data[i + 3]) {
+            EXPECT_LE(i + 4 + data[i + 3], datalen);
+            receiverWrite(data[i], data[i + 1], &data[i + 4], data[i + 3]);
+        }
+        break;
+    case MSP_DP_DRAW_SCREEN:
+        receiver.draws++;
+        memcpy(receiver.screen, receiver.canvas, sizeof(receiver.screen));
+        break;
+    }
+    return frameSize;
+}
+
+}
@@ -0,0 +1,147 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/display.h"
+
+    #include "io/displayport_virtual.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define FONT_PATH "displayport_virtual_unittest.mcm"
+#define PGM_PATH "displayport_virtual_unittest.pgm"
+
+TEST(DisplayPortVirtualTest, CountsWritesAndFrames)
+{
+    displayPort_t *displayPort = displayPortVirtualInit(16, 30);
+    const displayPortVirtualStats_t *stats = displayPortVirtualStats();
+
+    displayWrite(displayPort, 2, 3, "HELLO");
+    displayWriteChar(displayPort, 29, 15, 'X');
+    // off the screen
+    displayWriteChar(displayPort, 30, 0, 'Y');
+    displayWrite(displayPort, 27, 0, "CLIPPED");
+
+    EXPECT_EQ(0, memcmp("HELLO", displayPortVirtualBuffer() + 3 * 30 + 2, 5));
+    EXPECT_EQ('X', displayPortVirtualBuffer()[15 * 30 + 29]);
+    EXPECT_EQ(0, memcmp("CLI", displayPortVirtualBuffer() + 27, 3));
+    EXPECT_EQ(4u, stats->writes);
+    EXPECT_EQ(9u, stats->cellsWritten);
+    EXPECT_EQ(9u, stats->cellsChanged);
+
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(1u, stats->frames);
+    EXPECT_EQ(9u, stats->lastFrameCells);
+    EXPECT_EQ(9u * VIRTUAL_DISPLAYPORT_BYTES_PER_CELL, stats->lastFrameBytes);
+
+    // Writing the same again changes nothing, and there's nothing to send
+    displayWrite(displayPort, 2, 3, "HELLO");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(14u, stats->cellsWritten);
+    EXPECT_EQ(9u, stats->cellsChanged);
+    EXPECT_EQ(1u, stats->frames);
+
+    // Clearing and writing the same again leaves only the other cells to send
+    displayClearScreen(displayPort);
+    displayWrite(displayPort, 2, 3, "HELLO");
+    displayDrawScreen(displayPort);
+    EXPECT_EQ(1u, stats->clears);
+    EXPECT_EQ(2u, stats->frames);
+    EXPECT_EQ(4u, stats->lastFrameCells);
+    EXPECT_EQ(13u, stats->frameCells);
+}
+
+static void writeFont(void)
+{
+    FILE *file = fopen(FONT_PATH, "w");
+    ASSERT_TRUE(file != NULL);
+
+    fprintf(file, "MAX7456\n");
+    for (int c = 0; c < 256; c++) {
+        for (int i = 0; i < 64; i++) {
+            // 'A' is white, with a black first pixel, everything else is transparent
+            uint8_t value = 0x55;
+            if (c == 'A') {
+                value = i == 0 ? 0x2a : 0xaa;
+            }
+            for (int bit = 7; bit >= 0; bit--) {
+                fputc(value & (1 << bit) ? '1' : '0', file);
+            }
+            fputc('\n', file);
+        }
+    }
+    fclose(file);
+}
+
+TEST(DisplayPortVirtualTest, WritesPgmWithFont)
+{
+    writeFont();
+    EXPECT_TRUE(displayPortVirtualLoadFont(FONT_PATH));
+
+    displayPort_t *displayPort = displayPortVirtualInit(2, 3);
+    displayWrite(displayPort, 1, 1, "A");
+    displayDrawScreen(displayPort);
+    ASSERT_TRUE(displayPortVirtualWritePgm(PGM_PATH));
+
+    FILE *file = fopen(PGM_PATH, "rb");
+    ASSERT_TRUE(file != NULL);
+    int width, height, maxValue;
+    ASSERT_EQ(3, fscanf(file, "P5 %d %d %d", &width, &height, &maxValue));
+    fgetc(file);
+    EXPECT_EQ(36, width);
+    EXPECT_EQ(36, height);
+    EXPECT_EQ(255, maxValue);
+
+    uint8_t pixels[36 * 36];
+    ASSERT_EQ(sizeof(pixels), fread(pixels, 1, sizeof(pixels), file));
+    fclose(file);
+
+    // the top left of 'A'
+    EXPECT_EQ(0, pixels[18 * 36 + 12]);
+    EXPECT_EQ(255, pixels[18 * 36 + 13]);
+    EXPECT_EQ(255, pixels[35 * 36 + 23]);
+    // transparent
+    EXPECT_EQ(128, pixels[0]);
+    EXPECT_EQ(128, pixels[18 * 36 + 24]);
+
+    remove(FONT_PATH);
+    remove(PGM_PATH);
+}
+
+TEST(DisplayPortVirtualTest, RejectsBadFont)
+{
+    FILE *file = fopen(FONT_PATH, "w");
+    ASSERT_TRUE(file != NULL);
+    fprintf(file, "MAX7456\n01010101\n0101x101\n");
+    fclose(file);
+
+    EXPECT_FALSE(displayPortVirtualLoadFont(FONT_PATH));
+    EXPECT_FALSE(displayPortVirtualLoadFont("does_not_exist.mcm"));
+
+    remove(FONT_PATH);
+}
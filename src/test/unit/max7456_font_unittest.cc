@@ -0,0 +1,241 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/max7456_font.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define NVM_WRITE_POLLS 3   // STAT reads that show the NVM busy after each write
+#define STAT_READ_BYTES 2
+
+// A MAX7456 character memory, driven by register writes
+typedef struct max7456Model_s {
+    uint8_t nvm[512][64];
+    uint8_t shadowRam[64];
+    uint16_t cmah;
+    uint8_t cmal;
+    int busyPolls;
+    int nvmWrites;
+} max7456Model_t;
+
+static void modelWrite(max7456Model_t *model, uint8_t reg, uint8_t value)
+{
+    switch (reg) {
+    case MAX7456ADD_CMAH:
+        model->cmah = value;
+        break;
+    case MAX7456ADD_CMAL:
+        model->cmal = value;
+        break;
+    case MAX7456ADD_CMDI:
+        model->shadowRam[model->cmal & 0x3f] = value;
+        break;
+    case MAX7456ADD_CMM:
+        ASSERT_EQ(WRITE_NVR, value);
+        // Writes while the NVM is busy are lost
+        EXPECT_EQ(0, model->busyPolls);
+        memcpy(model->nvm[model->cmah | ((model->cmal & MAX7456_CMAL_CA8) ? 0x100 : 0)], model->shadowRam, NVM_RAM_SIZE);
+        model->busyPolls = NVM_WRITE_POLLS;
+        model->nvmWrites++;
+        break;
+    default:
+        FAIL() << "unexpected register " << (int)reg;
+    }
+}
+
+static void modelTransfer(max7456Model_t *model, const uint8_t *buff, int length)
+{
+    ASSERT_EQ(0, length % 2);
+    for (int i = 0; i < length; i += 2) {
+        modelWrite(model, buff[i], buff[i + 1]);
+    }
+}
+
+static uint8_t modelReadStat(max7456Model_t *model)
+{
+    if (model->busyPolls) {
+        model->busyPolls--;
+        return STAT_NVR_BUSY;
+    }
+    return 0;
+}
+
+class Max7456FontTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        memset(&model, 0, sizeof(model));
+        max7456FontQueueInit(&queue);
+        srand(1);
+    }
+
+    void makeGlyph(uint8_t *glyph) {
+        for (int i = 0; i < NVM_RAM_SIZE; i++) {
+            glyph[i] = rand();
+        }
+    }
+
+    // Runs the font upload as the driver task does, returning the number of SPI bytes
+    int process(void) {
+        int bytes = 0;
+        if (queue.nvmBusy) {
+            bytes += STAT_READ_BYTES;
+            max7456FontNvmStatus(&queue, modelReadStat(&model));
+            if (queue.nvmBusy) {
+                return bytes;
+            }
+        }
+        const int length = max7456FontPlanWrite(&queue, buff);
+        EXPECT_LE(length, MAX7456_FONT_WRITE_BYTES);
+        modelTransfer(&model, buff, length);
+        return bytes + length;
+    }
+
+    max7456Model_t model;
+    max7456FontQueue_t queue;
+    uint8_t buff[MAX7456_FONT_WRITE_BYTES];
+};
+
+TEST_F(Max7456FontTest, NothingSentWhenIdle)
+{
+    EXPECT_TRUE(max7456FontQueueIdle(&queue));
+    EXPECT_EQ(0, process());
+    EXPECT_EQ(0, model.nvmWrites);
+}
+
+TEST_F(Max7456FontTest, GlyphIsProgrammed)
+{
+    uint8_t glyph[NVM_RAM_SIZE];
+    makeGlyph(glyph);
+
+    EXPECT_TRUE(max7456FontQueueAdd(&queue, 0x41, glyph));
+    EXPECT_FALSE(max7456FontQueueIdle(&queue));
+
+    EXPECT_EQ(MAX7456_FONT_WRITE_BYTES, process());
+    EXPECT_EQ(0, memcmp(glyph, model.nvm[0x41], NVM_RAM_SIZE));
+
+    // Busy until the NVM write is done
+    for (int i = 0; i < NVM_WRITE_POLLS; i++) {
+        process();
+        EXPECT_FALSE(max7456FontQueueIdle(&queue));
+    }
+    process();
+    EXPECT_TRUE(max7456FontQueueIdle(&queue));
+    EXPECT_EQ(1, queue.accepted);
+    EXPECT_EQ(1, queue.written);
+}
+
+TEST_F(Max7456FontTest, NextGlyphWaitsForNvm)
+{
+    uint8_t glyph[2][NVM_RAM_SIZE];
+    makeGlyph(glyph[0]);
+    makeGlyph(glyph[1]);
+
+    max7456FontQueueAdd(&queue, 1, glyph[0]);
+    max7456FontQueueAdd(&queue, 2, glyph[1]);
+
+    EXPECT_EQ(MAX7456_FONT_WRITE_BYTES, process());
+    // Only the STAT register is read while the NVM is busy
+    for (int i = 0; i < NVM_WRITE_POLLS; i++) {
+        EXPECT_EQ(STAT_READ_BYTES, process());
+    }
+    EXPECT_EQ(STAT_READ_BYTES + MAX7456_FONT_WRITE_BYTES, process());
+
+    EXPECT_EQ(2, model.nvmWrites);
+    EXPECT_EQ(0, memcmp(glyph[0], model.nvm[1], NVM_RAM_SIZE));
+    EXPECT_EQ(0, memcmp(glyph[1], model.nvm[2], NVM_RAM_SIZE));
+}
+
+TEST_F(Max7456FontTest, FullQueueRejectsGlyphs)
+{
+    uint8_t glyph[NVM_RAM_SIZE];
+    makeGlyph(glyph);
+
+    for (int i = 0; i < MAX7456_FONT_QUEUE_LENGTH; i++) {
+        EXPECT_EQ(MAX7456_FONT_QUEUE_LENGTH - i, max7456FontQueueFree(&queue));
+        EXPECT_TRUE(max7456FontQueueAdd(&queue, i, glyph));
+    }
+    EXPECT_EQ(0, max7456FontQueueFree(&queue));
+    EXPECT_FALSE(max7456FontQueueAdd(&queue, 99, glyph));
+    EXPECT_EQ(MAX7456_FONT_QUEUE_LENGTH, queue.accepted);
+
+    // A slot is free as soon as its glyph is sent, before it is programmed
+    process();
+    EXPECT_EQ(1, max7456FontQueueFree(&queue));
+    EXPECT_TRUE(max7456FontQueueAdd(&queue, 99, glyph));
+}
+
+TEST_F(Max7456FontTest, UpperCharactersUseCa8)
+{
+    uint8_t glyph[2][NVM_RAM_SIZE];
+    makeGlyph(glyph[0]);
+    makeGlyph(glyph[1]);
+
+    max7456FontQueueAdd(&queue, 0x123, glyph[0]);
+    max7456FontQueueAdd(&queue, 0x023, glyph[1]);
+    while (!max7456FontQueueIdle(&queue)) {
+        process();
+    }
+
+    EXPECT_EQ(0, memcmp(glyph[0], model.nvm[0x123], NVM_RAM_SIZE));
+    EXPECT_EQ(0, memcmp(glyph[1], model.nvm[0x023], NVM_RAM_SIZE));
+}
+
+TEST_F(Max7456FontTest, WholeFontUpload)
+{
+    static uint8_t font[256][NVM_RAM_SIZE];
+    for (int i = 0; i < 256; i++) {
+        makeGlyph(font[i]);
+    }
+
+    // As a MSP client would, topping the queue up between task runs, three glyphs a frame
+    int sent = 0;
+    int runs = 0;
+    int bytes = 0;
+    while (sent < 256 || !max7456FontQueueIdle(&queue)) {
+        for (int i = 0; i < 3 && sent < 256; i++) {
+            if (!max7456FontQueueAdd(&queue, sent, font[sent])) {
+                break;
+            }
+            sent++;
+        }
+        bytes += process();
+        runs++;
+    }
+
+    EXPECT_EQ(256, model.nvmWrites);
+    EXPECT_EQ(256, queue.accepted);
+    EXPECT_EQ(256, queue.written);
+    for (int i = 0; i < 256; i++) {
+        EXPECT_EQ(0, memcmp(font[i], model.nvm[i], NVM_RAM_SIZE)) << "glyph " << i;
+    }
+
+    // Every run programs a glyph or polls for the last one to finish, with no runs wasted waiting for the client
+    EXPECT_EQ(256 * (NVM_WRITE_POLLS + 1) + 1, runs);
+    EXPECT_EQ(256 * (MAX7456_FONT_WRITE_BYTES + (NVM_WRITE_POLLS + 1) * STAT_READ_BYTES), bytes);
+}
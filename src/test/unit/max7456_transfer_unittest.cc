@@ -0,0 +1,220 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/max7456_transfer.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SCREEN_SIZE 480 // PAL
+#define DMM_VALUE 0x40  // as set for 16 bit SPI by max7456ReInit
+
+// A MAX7456 display memory, driven by register writes
+typedef struct max7456Model_s {
+    uint8_t memory[512];
+    uint16_t address;
+    uint8_t dmm;
+    int writes;
+} max7456Model_t;
+
+static void modelWrite(max7456Model_t *model, uint8_t reg, uint8_t value)
+{
+    model->writes++;
+    switch (reg) {
+    case MAX7456ADD_DMM:
+        model->dmm = value;
+        break;
+    case MAX7456ADD_DMAH:
+        model->address = (model->address & 0xff) | ((value & 0x01) << 8);
+        break;
+    case MAX7456ADD_DMAL:
+        model->address = (model->address & 0x100) | value;
+        break;
+    case MAX7456ADD_DMDI:
+        if (model->dmm & MAX7456_DMM_AUTO_INCREMENT) {
+            if (value == END_STRING) {
+                // Terminates auto-increment mode without being written
+                model->dmm &= ~MAX7456_DMM_AUTO_INCREMENT;
+                break;
+            }
+            model->memory[model->address] = value;
+            model->address = (model->address + 1) & 0x1ff;
+        } else {
+            model->memory[model->address] = value;
+        }
+        break;
+    default:
+        FAIL() << "unexpected register " << (int)reg;
+    }
+}
+
+static void modelTransfer(max7456Model_t *model, const uint8_t *buff, int length)
+{
+    ASSERT_EQ(0, length % 2);
+    for (int i = 0; i < length; i += 2) {
+        modelWrite(model, buff[i], buff[i + 1]);
+    }
+    // Every burst must leave the display memory mode as it was
+    EXPECT_EQ(DMM_VALUE, model->dmm);
+}
+
+class Max7456TransferTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        memset(&model, 0, sizeof(model));
+        model.dmm = DMM_VALUE;
+        memset(screen, ' ', sizeof(screen));
+        memset(shadow, ' ', sizeof(shadow));
+        memset(model.memory, ' ', sizeof(model.memory));
+    }
+
+    // Draws the screen as max7456DrawScreen does, returning the number of SPI bytes
+    int drawScreen(int charsPerCall) {
+        int bytes = 0;
+        for (int pos = 0; pos < SCREEN_SIZE; pos += charsPerCall) {
+            const int end = pos + charsPerCall < SCREEN_SIZE ? pos + charsPerCall : SCREEN_SIZE;
+            int changed;
+            const int length = max7456PlanTransfer(buff, screen, shadow, pos, end, DMM_VALUE, &changed);
+            EXPECT_LE(length, (end - pos) * MAX7456_TRANSFER_BYTES_PER_CELL);
+            EXPECT_LE(length, changed * MAX7456_TRANSFER_BYTES_PER_CELL);
+            modelTransfer(&model, buff, length);
+            bytes += length;
+        }
+        return bytes;
+    }
+
+    void expectInSync() {
+        EXPECT_EQ(0, memcmp(screen, model.memory, SCREEN_SIZE));
+        EXPECT_EQ(0, memcmp(screen, shadow, SCREEN_SIZE));
+    }
+
+    max7456Model_t model;
+    uint8_t screen[SCREEN_SIZE];
+    uint8_t shadow[SCREEN_SIZE];
+    uint8_t buff[SCREEN_SIZE * MAX7456_TRANSFER_BYTES_PER_CELL];
+};
+
+TEST_F(Max7456TransferTest, NothingSentWhenUnchanged)
+{
+    EXPECT_EQ(0, drawScreen(100));
+    EXPECT_EQ(0, model.writes);
+}
+
+TEST_F(Max7456TransferTest, SingleCellIsAddressed)
+{
+    screen[300] = 'A';
+
+    // DMAH, DMAL, DMDI
+    EXPECT_EQ(6, drawScreen(100));
+    expectInSync();
+}
+
+TEST_F(Max7456TransferTest, StringIsSentInABurst)
+{
+    const char *text = "ALT 123.4M";
+    memcpy(screen + 45, text, strlen(text));
+
+    // DMAH, DMAL, DMM, one DMDI per character, DMDI 0xFF, DMM
+    EXPECT_EQ(2 * (3 + (int)strlen(text) + 2), drawScreen(100));
+    expectInSync();
+}
+
+TEST_F(Max7456TransferTest, BurstContinuesOverShortGaps)
+{
+    memcpy(screen + 200, "ABCDEFGHIJ", 10);
+    drawScreen(100);
+    expectInSync();
+
+    // The unchanged character between the changed ones is sent again rather than starting another burst
+    memcpy(screen + 200, "KLMNEPQRST", 10);
+    EXPECT_EQ(2 * (3 + 10 + 2), drawScreen(100));
+    expectInSync();
+
+    // Two changed characters with one between them are cheaper to address
+    memcpy(screen + 200, "KAMBEPQRST", 10);
+    EXPECT_EQ(2 * (1 + 2 * 2), drawScreen(100));
+    expectInSync();
+}
+
+TEST_F(Max7456TransferTest, EscapeCharacterIsNeverSentInABurst)
+{
+    for (int i = 100; i < 140; i++) {
+        screen[i] = (i % 7 == 0) ? END_STRING : 'A' + i % 26;
+    }
+    drawScreen(100);
+    expectInSync();
+
+    memset(screen, END_STRING, SCREEN_SIZE);
+    drawScreen(100);
+    expectInSync();
+}
+
+TEST_F(Max7456TransferTest, RandomScreensStayInSync)
+{
+    srand(42);
+    for (int frame = 0; frame < 500; frame++) {
+        // Mostly small updates, with the occasional full screen
+        const int updates = (frame % 50 == 0) ? SCREEN_SIZE : rand() % 40;
+        for (int i = 0; i < updates; i++) {
+            const int pos = rand() % SCREEN_SIZE;
+            const int length = 1 + rand() % 8;
+            for (int j = pos; j < pos + length && j < SCREEN_SIZE; j++) {
+                const int r = rand() % 16;
+                screen[j] = r == 0 ? END_STRING : r == 1 ? ' ' : rand();
+            }
+        }
+        drawScreen(1 + rand() % 120);
+        expectInSync();
+    }
+}
+
+TEST_F(Max7456TransferTest, FewerBytesThanAddressingEveryCell)
+{
+    // A typical OSD: a few values of several characters changing each frame
+    static const int positions[] = { 33, 52, 125, 190, 270, 301, 388, 446 };
+
+    srand(7);
+    int planned = 0;
+    int addressed = 0;
+    for (int frame = 0; frame < 100; frame++) {
+        int changed = 0;
+        for (const int pos : positions) {
+            for (int j = 0; j < 6; j++) {
+                const uint8_t c = '0' + rand() % 10;
+                changed += screen[pos + j] != c;
+                screen[pos + j] = c;
+            }
+        }
+        planned += drawScreen(100);
+        addressed += changed * 6;
+        expectInSync();
+    }
+
+    printf("addressed writes %d bytes, planned %d bytes\n", addressed, planned);
+    EXPECT_LT(planned, addressed * 3 / 4);
+}
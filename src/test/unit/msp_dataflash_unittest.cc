@@ -0,0 +1,265 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/streambuf.h"
+
+    #include "io/flashfs.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_dataflash.h"
+    #include "msp/msp_protocol.h"
+    #include "msp/msp_serial.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define FLASH_SIZE 4096
+#define FRAME_LENGTH 200
+
+enum {
+    NO_COMPRESSION,
+    HUFFMAN
+};
+
+static uint8_t flash[FLASH_SIZE];
+static uint32_t flashReadEnd; // one past the highest address read
+
+static struct {
+    mspDescriptor_t descriptor;
+    mspStreamFnPtr streamFn;
+    int starts;
+} stream;
+
+static uint8_t requestBuffer[16];
+static uint8_t replyBuffer[MSP_PORT_OUTBUF_SIZE];
+
+// A read request in the current format, with a stream length when it is non-zero
+static sbuf_t *buildRequest(sbuf_t *src, uint32_t address, uint16_t length, bool allowCompression, uint32_t streamLength)
+{
+    sbufInit(src, requestBuffer, requestBuffer + sizeof(requestBuffer));
+    sbufWriteU32(src, address);
+    sbufWriteU16(src, length);
+    sbufWriteU8(src, allowCompression);
+    if (streamLength) {
+        sbufWriteU32(src, streamLength);
+    }
+    sbufSwitchToReader(src, requestBuffer);
+    return src;
+}
+
+static sbuf_t *initReply(sbuf_t *dst)
+{
+    return sbufInit(dst, replyBuffer, replyBuffer + sizeof(replyBuffer));
+}
+
+static mspPacket_t *initReplyPacket(mspPacket_t *reply)
+{
+    memset(reply, 0, sizeof(*reply));
+    initReply(&reply->buf);
+    return reply;
+}
+
+// Returns the flash bytes the reply in replyBuffer covers, checking that it starts at address
+static uint16_t replyFlashBytes(uint32_t address, uint8_t *compression)
+{
+    sbuf_t reply;
+    sbufInit(&reply, replyBuffer, replyBuffer + sizeof(replyBuffer));
+    EXPECT_EQ(address, sbufReadU32(&reply));
+    const uint16_t length = sbufReadU16(&reply);
+    *compression = sbufReadU8(&reply);
+    return *compression == HUFFMAN ? sbufReadU16(&reply) : length;
+}
+
+class MspDataflashTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        // zeros compress well
+        memset(flash, 0, sizeof(flash));
+        flashReadEnd = 0;
+        memset(&stream, 0, sizeof(stream));
+    }
+
+    void fillIncompressible(void) {
+        srand(1);
+        for (unsigned i = 0; i < sizeof(flash); i++) {
+            flash[i] = 0x80 | (rand() & 0x7f);
+        }
+    }
+};
+
+TEST_F(MspDataflashTest, CompressedReadStopsAtEndAddress)
+{
+    // given
+    sbuf_t dst;
+    initReply(&dst);
+
+    // when
+    const uint32_t consumed = mspDataflashSerializeReadReply(&dst, 1000, FRAME_LENGTH, 1100, false, true);
+
+    // then
+    uint8_t compression;
+    EXPECT_EQ(100u, consumed);
+    EXPECT_EQ(100, replyFlashBytes(1000, &compression));
+    EXPECT_EQ(HUFFMAN, compression);
+    EXPECT_EQ(1100u, flashReadEnd);
+}
+
+TEST_F(MspDataflashTest, UncompressibleDataIsSentUncompressed)
+{
+    // given
+    fillIncompressible();
+    sbuf_t dst;
+    initReply(&dst);
+
+    // when
+    const uint32_t consumed = mspDataflashSerializeReadReply(&dst, 0, FRAME_LENGTH, FLASH_SIZE, false, true);
+
+    // then
+    uint8_t compression;
+    EXPECT_EQ((uint32_t)FRAME_LENGTH, consumed);
+    EXPECT_EQ(FRAME_LENGTH, replyFlashBytes(0, &compression));
+    EXPECT_EQ(NO_COMPRESSION, compression);
+    EXPECT_EQ(0, memcmp(flash, replyBuffer + 7, FRAME_LENGTH));
+}
+
+TEST_F(MspDataflashTest, EndOfFlashGivesEmptyReply)
+{
+    // given
+    sbuf_t dst;
+    initReply(&dst);
+
+    // when
+    const uint32_t consumed = mspDataflashSerializeReadReply(&dst, FLASH_SIZE, FRAME_LENGTH, FLASH_SIZE + 100, false, true);
+
+    // then
+    uint8_t compression;
+    EXPECT_EQ(0u, consumed);
+    EXPECT_EQ(0, replyFlashBytes(FLASH_SIZE, &compression));
+    EXPECT_EQ(0u, flashReadEnd);
+}
+
+TEST_F(MspDataflashTest, StreamCoversRequestedRangeOnly)
+{
+    // given
+    fillIncompressible();
+    sbuf_t src, dst;
+    mspDataflashReadCommand(1, buildRequest(&src, 100, FRAME_LENGTH, true, 1000), initReply(&dst));
+    ASSERT_EQ(1, stream.starts);
+    ASSERT_EQ(1, stream.descriptor);
+
+    uint8_t compression;
+    uint32_t address = 100 + replyFlashBytes(100, &compression);
+
+    // when
+    mspPacket_t reply;
+    while (stream.streamFn(1, initReplyPacket(&reply))) {
+        EXPECT_EQ(MSP_DATAFLASH_READ, reply.cmd);
+        const uint16_t length = replyFlashBytes(address, &compression);
+        ASSERT_GT(length, 0);
+        address += length;
+    }
+
+    // then
+    EXPECT_EQ(1100u, address);
+    EXPECT_EQ(1100u, flashReadEnd);
+}
+
+TEST_F(MspDataflashTest, StreamEndsWithEmptyReplyAtEndOfFlash)
+{
+    // given
+    sbuf_t src, dst;
+    mspDataflashReadCommand(1, buildRequest(&src, FLASH_SIZE - 300, FRAME_LENGTH, false, 1000), initReply(&dst));
+    ASSERT_EQ(1, stream.starts);
+
+    // when
+    mspPacket_t reply;
+    uint8_t compression;
+    ASSERT_TRUE(stream.streamFn(1, initReplyPacket(&reply)));
+    EXPECT_EQ(100, replyFlashBytes(FLASH_SIZE - 100, &compression));
+    ASSERT_TRUE(stream.streamFn(1, initReplyPacket(&reply)));
+    EXPECT_EQ(0, replyFlashBytes(FLASH_SIZE, &compression));
+
+    // then
+    EXPECT_FALSE(stream.streamFn(1, initReplyPacket(&reply)));
+}
+
+TEST_F(MspDataflashTest, SecondPortGetsSingleReplyWhileAnotherStreams)
+{
+    // given
+    sbuf_t src, dst;
+    mspDataflashReadCommand(1, buildRequest(&src, 0, FRAME_LENGTH, false, 1000), initReply(&dst));
+    ASSERT_EQ(1, stream.starts);
+
+    // when
+    mspDataflashReadCommand(2, buildRequest(&src, 2000, FRAME_LENGTH, false, 1000), initReply(&dst));
+
+    // then
+    uint8_t compression;
+    EXPECT_EQ(FRAME_LENGTH, replyFlashBytes(2000, &compression));
+    EXPECT_EQ(1, stream.starts);
+
+    // and the first stream carries on where it was
+    mspPacket_t reply;
+    EXPECT_FALSE(stream.streamFn(2, initReplyPacket(&reply)));
+    ASSERT_TRUE(stream.streamFn(1, initReplyPacket(&reply)));
+    EXPECT_EQ(FRAME_LENGTH, replyFlashBytes(FRAME_LENGTH, &compression));
+}
+
+// STUBS
+
+extern "C" {
+    uint32_t flashfsGetSize(void)
+    {
+        return FLASH_SIZE;
+    }
+
+    int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len)
+    {
+        if (offset >= FLASH_SIZE) {
+            return 0;
+        }
+        len = MIN(len, FLASH_SIZE - offset);
+        memcpy(data, &flash[offset], len);
+        flashReadEnd = MAX(flashReadEnd, offset + len);
+        return len;
+    }
+
+    bool mspSerialStartStream(mspDescriptor_t descriptor, mspStreamFnPtr streamFn)
+    {
+        stream.descriptor = descriptor;
+        stream.streamFn = streamFn;
+        stream.starts++;
+        return true;
+    }
+
+    bool mspSerialIsStreaming(mspStreamFnPtr streamFn)
+    {
+        return stream.streamFn == streamFn;
+    }
+}
@@ -15,6 +15,7 @@
  * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -42,6 +43,7 @@ extern "C" {
 
     #include "fc/config.h"
     #include "fc/core.h"
+    #include "fc/flight_stats.h"
     #include "fc/rc_controls.h"
     #include "fc/rc_modes.h"
     #include "fc/runtime_config.h"
@@ -95,6 +97,7 @@ extern "C" {
     PG_REGISTER(gpsConfig_t, gpsConfig, PG_GPS_CONFIG, 0);
     
     timeUs_t simulationTime = 0;
+    uint32_t simulationRefreshUs;   // how long the refresh appears to have taken so far
     batteryState_e simulationBatteryState;
     uint8_t simulationBatteryCellCount;
     uint16_t simulationBatteryVoltage;
@@ -518,6 +521,60 @@ TEST(OsdTest, TestStatsMetricDistanceUnits)
     displayPortTestBufferSubstring(2, row++, "MIN RSSI          : 25%%");
 }
 
+/*
+ * Tests the statistics taken from the flight statistics engine.
+ */
+TEST(OsdTest, TestStatsFromFlightStats)
+{
+    // given
+    // only the statistics from the engine are enabled
+    const uint32_t enabledStats = osdConfig()->enabled_stats;
+    osdConfigMutable()->enabled_stats = 0;
+    osdStatSetState(OSD_STAT_MAX_CURRENT, true);
+    osdStatSetState(OSD_STAT_P95_CURRENT, true);
+    osdStatSetState(OSD_STAT_MAX_GYRO_RATE, true);
+    batteryConfigMutable()->currentMeterSource = CURRENT_METER_ADC;
+
+    // and
+    // default state values are set
+    setDefaultSimulationState();
+    flightStatsReset();
+
+    // when
+    // the craft is armed
+    doTestArm();
+
+    // and
+    // the producers report these values during flight, a steady 12A with short 50A punch outs
+    for (int i = 0; i < 2000; i++) {
+        flightStatsAdd(FLIGHT_STAT_CURRENT, i % 50 == 0 ? 5000 : 1200);
+        flightStatsAdd(FLIGHT_STAT_GYRO_RATE, i == 1000 ? 1250 : 100);
+    }
+    simulationTime += 1e6;
+    osdRefresh(simulationTime);
+
+    // and
+    // the craft is disarmed
+    DISABLE_ARMING_FLAG(ARMED);
+    osdRefresh(simulationTime);
+
+    // and
+    // values reported after disarming are not recorded
+    flightStatsAdd(FLIGHT_STAT_CURRENT, 9900);
+
+    // then
+    // statistics screen should display the following, centred vertically
+    int row = 6;
+    displayPortTestBufferSubstring(2, row++, "  --- STATS ---");
+    displayPortTestBufferSubstring(2, row++, "MAX CURRENT       : 50%c", SYM_AMP);
+    displayPortTestBufferSubstring(2, row++, "P95 CURRENT       : 12%c", SYM_AMP);
+    displayPortTestBufferSubstring(2, row++, "MAX GYRO RATE     : 1250DPS");
+    EXPECT_EQ(5000, flightStatsGet(FLIGHT_STAT_CURRENT)->max);
+
+    osdConfigMutable()->enabled_stats = enabledStats;
+    batteryConfigMutable()->currentMeterSource = CURRENT_METER_NONE;
+}
+
 /*
  * Tests activation of alarms and element flashing.
  */
@@ -867,6 +924,225 @@ TEST(OsdTest, TestElementAltitude)
 
 }
 
+/*
+ * Tests that the elements are only written when their text changes.
+ */
+TEST(OsdTest, TestElementsOnlyWrittenWhenChanged)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_ALTITUDE] = OSD_POS(23, 7) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->units = OSD_UNIT_METRIC;
+    sensorsSet(SENSOR_GPS);
+
+    osdAnalyzeActiveElements();
+
+    simulationAltitude = 4247;
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    displayPortTestBufferSubstring(23, 7, "%c42.4%c", SYM_ALTITUDE, SYM_M);
+
+    // when
+    testDisplayPortBuffer[7 * UNITTEST_DISPLAYPORT_COLS + 24] = 'X';
+    osdRefresh(simulationTime);
+
+    // then
+    // the altitude is unchanged, so it isn't written again
+    displayPortTestBufferSubstring(23, 7, "%cX2.4%c", SYM_ALTITUDE, SYM_M);
+
+    // when
+    simulationAltitude = 247;
+    osdRefresh(simulationTime);
+
+    // then
+    // the cell that the shorter text no longer covers is blanked
+    displayPortTestBufferSubstring(23, 7, "%c2.4%c ", SYM_ALTITUDE, SYM_M);
+
+    // when
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+
+    // then
+    // the screen was cleared under the OSD, so everything is written again
+    displayPortTestBufferSubstring(23, 7, "%c2.4%c", SYM_ALTITUDE, SYM_M);
+}
+
+TEST(OsdTest, TestLowTierElementsDrawnLessOften)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_MAH_DRAWN] = OSD_POS(1, 11) | OSD_PROFILE_1_FLAG;
+    osdAnalyzeActiveElements();
+    const uint32_t startTime = simulationTime;
+
+    simulationMahDrawn = 100;
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    displayPortTestBufferSubstring(1, 11, " 100%c", SYM_MAH);
+
+    // when
+    simulationMahDrawn = 101;
+    simulationTime += 100000;
+    osdRefresh(simulationTime);
+
+    // then
+    // it isn't due yet
+    displayPortTestBufferSubstring(1, 11, " 100%c", SYM_MAH);
+
+    // when
+    simulationTime += 100000;
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(1, 11, " 101%c", SYM_MAH);
+
+    // the other tests rely on the blink state
+    simulationTime = startTime;
+}
+
+TEST(OsdTest, TestFullRedrawIgnoresDrawBudget)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_ALTITUDE] = OSD_POS(23, 7) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_MAH_DRAWN] = OSD_POS(1, 11) | OSD_PROFILE_1_FLAG;
+    osdAnalyzeActiveElements();
+    const uint32_t startTime = simulationTime;
+
+    simulationAltitude = 100;
+    simulationMahDrawn = 200;
+    // a refresh that is over budget before it draws anything
+    simulationRefreshUs = 1000;
+
+    // when
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+
+    // then
+    // the screen was cleared, so normal and low tier elements are drawn anyway
+    displayPortTestBufferSubstring(23, 7, "%c1.0%c", SYM_ALTITUDE, SYM_M);
+    displayPortTestBufferSubstring(1, 11, " 200%c", SYM_MAH);
+
+    // when
+    simulationAltitude = 200;
+    simulationTime += 100000;
+    osdRefresh(simulationTime);
+
+    // then
+    // but not on the refreshes in between
+    displayPortTestBufferSubstring(23, 7, "%c1.0%c", SYM_ALTITUDE, SYM_M);
+
+    simulationRefreshUs = 0;
+    simulationTime = startTime;
+}
+
+TEST(OsdTest, TestPeriodicRewriteKeepsToDrawBudget)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_ALTITUDE] = OSD_POS(23, 7) | OSD_PROFILE_1_FLAG;
+    osdAnalyzeActiveElements();
+    const uint32_t startTime = simulationTime;
+
+    simulationAltitude = 100;
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    displayPortTestBufferSubstring(23, 7, "%c1.0%c", SYM_ALTITUDE, SYM_M);
+    const uint16_t clearCount = testDisplayPort.clearCount;
+
+    // the display lost a cell
+    testDisplayPortBuffer[7 * UNITTEST_DISPLAYPORT_COLS + 24] = 'X';
+
+    // when
+    // the rewrite is due, but the refresh is over budget before it draws anything
+    simulationTime += 1000000;
+    simulationRefreshUs = 1000;
+    osdRefresh(simulationTime);
+
+    // then
+    // the screen isn't cleared, and the element waits for a refresh with time to spare
+    EXPECT_EQ(clearCount, testDisplayPort.clearCount);
+    displayPortTestBufferSubstring(23, 7, "%cX.0%c", SYM_ALTITUDE, SYM_M);
+
+    // when
+    simulationRefreshUs = 0;
+    simulationTime += 100000;
+    osdRefresh(simulationTime);
+
+    // then
+    // the unchanged element is written again
+    EXPECT_EQ(clearCount, testDisplayPort.clearCount);
+    displayPortTestBufferSubstring(23, 7, "%c1.0%c", SYM_ALTITUDE, SYM_M);
+
+    simulationTime = startTime;
+}
+
+TEST(OsdTest, TestElementsDrawingThemselves)
+{
+    // given
+    osdConfigMutable()->item_pos[OSD_HORIZON_SIDEBARS] = OSD_POS(14, 6) | OSD_PROFILE_1_FLAG;
+    osdAnalyzeActiveElements();
+
+    // when
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(7, 6, "%c%c", SYM_AH_DECORATION, SYM_AH_LEFT);
+    displayPortTestBufferSubstring(20, 6, "%c%c", SYM_AH_RIGHT, SYM_AH_DECORATION);
+
+    // when
+    osdConfigMutable()->item_pos[OSD_HORIZON_SIDEBARS] = 0;
+    osdAnalyzeActiveElements();
+    osdRefresh(simulationTime);
+
+    // then
+    displayPortTestBufferSubstring(7, 6, "  ");
+}
+
+TEST(OsdTest, TestElementArtificialHorizon)
+{
+    // given
+    sensorsSet(SENSOR_ACC);
+    osdConfigMutable()->item_pos[OSD_ARTIFICIAL_HORIZON] = OSD_POS(14, 2) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->ahMaxPitch = 20;
+    osdConfigMutable()->ahMaxRoll = 40;
+    osdAnalyzeActiveElements();
+
+    attitude.values.roll = 0;
+    attitude.values.pitch = 0;
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+
+    for (int roll = -50; roll <= 50; roll += 5) {
+        for (int pitch = -30; pitch <= 30; pitch += 3) {
+            // when
+            attitude.values.roll = roll * 10;
+            attitude.values.pitch = pitch * 10;
+            osdRefresh(simulationTime);
+
+            // then the horizon is where the formula the tables replaced put it
+            const int rollAngle = constrain(roll * 10, -400, 400);
+            const int pitchAngle = (constrain(pitch * 10, -200, 200) * 25) / 200 - 41;
+            for (int x = -4; x <= 4; x++) {
+                const int y = ((-rollAngle * x) / 64) - pitchAngle;
+                for (int row = 0; row < 10; row++) {
+                    const char cell = testDisplayPortBuffer[(2 + row) * UNITTEST_DISPLAYPORT_COLS + 14 + x];
+                    if (y >= 0 && y <= 81 && row == y / 9) {
+                        EXPECT_EQ((char)(SYM_AH_BAR9_0 + y % 9), cell) << "roll " << roll << " pitch " << pitch << " x " << x;
+                    } else {
+                        EXPECT_EQ(' ', cell) << "roll " << roll << " pitch " << pitch << " x " << x << " row " << row;
+                    }
+                }
+            }
+        }
+    }
+
+    attitude.values.roll = 0;
+    attitude.values.pitch = 0;
+    osdConfigMutable()->item_pos[OSD_ARTIFICIAL_HORIZON] = 0;
+    sensorsClear(SENSOR_ACC);
+    osdAnalyzeActiveElements();
+    osdRefresh(simulationTime);
+}
+
 /*
  * Tests the core temperature OSD element.
  */
@@ -1062,6 +1338,61 @@ TEST(OsdTest, TestConvertTemperatureUnits)
     EXPECT_EQ(osdConvertTemperatureToSelectedUnit(41), 106);
 }
 
+/*
+ * Runs the OSD on the virtual displayport for a minute of flight and checks what the frames cost.
+ */
+TEST(OsdTest, TestRenderCost)
+{
+    // given
+    const osdConfig_t savedConfig = *osdConfig();
+    const timeUs_t savedTime = simulationTime;
+
+    osdConfigMutable()->item_pos[OSD_RSSI_VALUE] = OSD_POS(8, 1) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_MAIN_BATT_VOLTAGE] = OSD_POS(12, 1) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_CROSSHAIRS] = OSD_POS(13, 6) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_HORIZON_SIDEBARS] = OSD_POS(14, 6) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_ITEM_TIMER_2] = OSD_POS(22, 1) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_CURRENT_DRAW] = OSD_POS(1, 12) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_MAH_DRAWN] = OSD_POS(1, 11) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_ALTITUDE] = OSD_POS(23, 7) | OSD_PROFILE_1_FLAG;
+    osdConfigMutable()->item_pos[OSD_CRAFT_NAME] = OSD_POS(9, 11) | OSD_PROFILE_1_FLAG;
+    osdAnalyzeActiveElements();
+
+    displayClearScreen(&testDisplayPort);
+    osdRefresh(simulationTime);
+    displayPortVirtualResetStats();
+
+    // when
+    const int ticks = 60 * 60; // osdUpdate runs at 60Hz
+    const auto renderStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < ticks; i++) {
+        simulationTime += 1000000 / 60;
+        simulationAltitude = 1000 + i;
+        simulationBatteryVoltage = 1680 - i / 20;
+        simulationBatteryAmperage = 1000 + (i * 37) % 500;
+        simulationMahDrawn = i / 10;
+
+        osdUpdate(simulationTime);
+    }
+    const auto renderEnd = std::chrono::steady_clock::now();
+
+    // then
+    const displayPortVirtualStats_t *stats = displayPortVirtualStats();
+    ASSERT_GT(stats->frames, 0u);
+    // only what changed is sent, not the whole screen
+    EXPECT_LT(stats->frameCells, stats->frames * 20);
+
+    // what each frame cost, in the XML output if --gtest_output=xml is given
+    const double renderNs = std::chrono::duration<double, std::nano>(renderEnd - renderStart).count();
+    RecordProperty("renderNsPerFrame", (int)(renderNs / stats->frames));
+    RecordProperty("cellsPerFrame", (int)(stats->frameCells / stats->frames));
+    RecordProperty("bytesPerFrame", (int)(stats->frameBytes / stats->frames));
+
+    *osdConfigMutable() = savedConfig;
+    osdAnalyzeActiveElements();
+    simulationTime = savedTime;
+}
+
 // STUBS
 extern "C" {
     bool featureIsEnabled(uint32_t f) { return simulationFeatureFlags & f; }
@@ -1077,7 +1408,7 @@ extern "C" {
     }
 
     uint32_t micros() {
-        return simulationTime;
+        return simulationTime + simulationRefreshUs;
     }
 
     uint32_t millis() {
@@ -21,9 +21,15 @@
 
 #include <limits.h>
 
+#include <chrono>
+
 extern "C" {
     #include <platform.h>
     #include "build/debug.h"
+    #include "common/crc.h"
+    #include "config/config_eeprom.h"
+    #include "drivers/system.h"
+    #include "drivers/time.h"
     #include "pg/pg.h"
     #include "pg/pg_ids.h"
     #include "pg/motor.h"
@@ -35,11 +41,30 @@ extern "C" {
 PG_REGISTER_WITH_RESET_TEMPLATE(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 1);
 
 PG_RESET_TEMPLATE(motorConfig_t, motorConfig,
+    .dev = {.motorPwmRate = 400},
     .minthrottle = 1150,
     .maxthrottle = 1850,
     .mincommand = 1000,
-    .dev = {.motorPwmRate = 400}
 );
+
+// A synthetic registry of several hundred PGs, the size of a fully featured target and then some
+typedef struct benchConfig_s {
+    uint32_t value;
+    uint8_t padding[12];
+} benchConfig_t;
+
+#define BENCH_PGN_BASE 3000
+#define BENCH_PG(id) PG_REGISTER(benchConfig_t, benchConfig ## id, (BENCH_PGN_BASE + (id)), 0);
+#define BENCH_PG_X10(a) BENCH_PG(a ## 0) BENCH_PG(a ## 1) BENCH_PG(a ## 2) BENCH_PG(a ## 3) BENCH_PG(a ## 4) \
+    BENCH_PG(a ## 5) BENCH_PG(a ## 6) BENCH_PG(a ## 7) BENCH_PG(a ## 8) BENCH_PG(a ## 9)
+#define BENCH_PG_X100(a) BENCH_PG_X10(a ## 0) BENCH_PG_X10(a ## 1) BENCH_PG_X10(a ## 2) BENCH_PG_X10(a ## 3) \
+    BENCH_PG_X10(a ## 4) BENCH_PG_X10(a ## 5) BENCH_PG_X10(a ## 6) BENCH_PG_X10(a ## 7) BENCH_PG_X10(a ## 8) \
+    BENCH_PG_X10(a ## 9)
+
+// PGNs 3100 - 3399
+BENCH_PG_X100(1)
+BENCH_PG_X100(2)
+BENCH_PG_X100(3)
 }
 
 
@@ -84,7 +109,377 @@ TEST(ParameterGroupsfTest, Test_pgFind)
     EXPECT_EQ(400, motorConfig3.dev.motorPwmRate);
 }
 
+TEST(ParameterGroupsfTest, Test_pgFindEveryPg)
+{
+    int found = 0;
+    PG_FOREACH(reg) {
+        EXPECT_EQ(reg, pgFind(pgN(reg))) << "pgn " << pgN(reg);
+        found += pgFind(pgN(reg)) == reg;
+    }
+    EXPECT_EQ(PG_REGISTRY_SIZE, found);
+    EXPECT_FALSE(pgFindScansRegistry());
+
+    EXPECT_EQ(nullptr, pgFind(0));
+    EXPECT_EQ(nullptr, pgFind(BENCH_PGN_BASE));
+    EXPECT_EQ(nullptr, pgFind(BENCH_PGN_BASE + 400));
+    EXPECT_EQ(nullptr, pgFind(PGR_PGN_MASK));
+}
+
+// The lookup as it was: a scan of the registry
+static const pgRegistry_t *pgFindByScanning(pgn_t pgn)
+{
+    PG_FOREACH(reg) {
+        if (pgN(reg) == pgn) {
+            return reg;
+        }
+    }
+    return NULL;
+}
+
+// The benchmarks are not run by default, run the test binary with --gtest_also_run_disabled_tests and the times are
+// recorded as properties of the tests, in the XML output if --gtest_output=xml is given
+TEST(ParameterGroupsfTest, DISABLED_Test_pgFindBenchmark)
+{
+    const int iterations = 200;
+    uintptr_t sum = 0;
+
+    const auto scanStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        PG_FOREACH(reg) {
+            sum += (uintptr_t)pgFindByScanning(pgN(reg));
+        }
+    }
+    const auto scanEnd = std::chrono::steady_clock::now();
+
+    const auto findStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        PG_FOREACH(reg) {
+            sum -= (uintptr_t)pgFind(pgN(reg));
+        }
+    }
+    const auto findEnd = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(0, sum);
+
+    const double lookups = (double)iterations * PG_REGISTRY_SIZE;
+    RecordProperty("pgCount", (int)PG_REGISTRY_SIZE);
+    RecordProperty("scanningLookupNs", (int)(std::chrono::duration<double, std::nano>(scanEnd - scanStart).count() / lookups));
+    RecordProperty("pgFindNs", (int)(std::chrono::duration<double, std::nano>(findEnd - findStart).count() / lookups));
+}
+
+static void setBenchConfig(uint32_t seed)
+{
+    PG_FOREACH(reg) {
+        if (pgN(reg) > BENCH_PGN_BASE) {
+            ((benchConfig_t *)reg->address)->value = seed + pgN(reg);
+        }
+    }
+}
+
+static int countBenchConfig(uint32_t seed)
+{
+    int matching = 0;
+    PG_FOREACH(reg) {
+        if (pgN(reg) > BENCH_PGN_BASE && ((benchConfig_t *)reg->address)->value == seed + pgN(reg)) {
+            matching++;
+        }
+    }
+    return matching;
+}
+
+#define EEPROM_HEADER_SIZE 4
+#define EEPROM_RECORD_HEADER_SIZE 6
+
+static uint8_t *eepromRecordWithPgn(pgn_t pgn)
+{
+    uint8_t *p = eepromData + EEPROM_HEADER_SIZE;
+    for (uint16_t size; (size = p[0] | (p[1] << 8)) != 0; p += size) {
+        if ((p[2] | (p[3] << 8)) == pgn) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+TEST(ParameterGroupsfTest, Test_loadEEPROM)
+{
+    setBenchConfig(1000);
+    motorConfigMutable()->minthrottle = 1070;
+    writeConfigToEEPROM();
+
+    pgResetAll();
+    EXPECT_EQ(0, countBenchConfig(1000));
+
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(300, countBenchConfig(1000));
+    EXPECT_EQ(1070, motorConfig()->minthrottle);
+}
+
+TEST(ParameterGroupsfTest, Test_loadEEPROMMissingRecord)
+{
+    setBenchConfig(2000);
+    writeConfigToEEPROM();
+
+    // as if the PG was added to the firmware after the config was saved
+    uint8_t *record = eepromRecordWithPgn(BENCH_PGN_BASE + 250);
+    ASSERT_NE(nullptr, record);
+    record[2] = 0;
+    record[3] = 0;
+
+    EXPECT_FALSE(loadEEPROM());
+    EXPECT_EQ(299, countBenchConfig(2000));
+    EXPECT_EQ(0, benchConfig250_System.value);
+    EXPECT_EQ(2000 + BENCH_PGN_BASE + 251, benchConfig251_System.value);
+}
+
+TEST(ParameterGroupsfTest, Test_loadEEPROMRecordsOutOfOrder)
+{
+    setBenchConfig(3000);
+    writeConfigToEEPROM();
+
+    // swap the first and last records, which are all the same size apart from the motor config
+    uint8_t *first = eepromRecordWithPgn(BENCH_PGN_BASE + 100);
+    uint8_t *last = eepromRecordWithPgn(BENCH_PGN_BASE + 399);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, last);
+    uint8_t swap[EEPROM_RECORD_HEADER_SIZE + sizeof(benchConfig_t)];
+    memcpy(swap, first, sizeof(swap));
+    memcpy(first, last, sizeof(swap));
+    memcpy(last, swap, sizeof(swap));
+
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(300, countBenchConfig(3000));
+}
+
+// The loader as it was: every PG scans the records from the start
+static bool loadEEPROMByScanning(void)
+{
+    bool success = true;
+    PG_FOREACH(reg) {
+        const uint8_t *p = eepromData + EEPROM_HEADER_SIZE;
+        uint16_t size;
+        while ((size = p[0] | (p[1] << 8)) != 0 && (p[2] | (p[3] << 8)) != pgN(reg)) {
+            p += size;
+        }
+        if (size) {
+            pgLoad(reg, p + EEPROM_RECORD_HEADER_SIZE, size - EEPROM_RECORD_HEADER_SIZE, p[4]);
+        } else {
+            pgReset(reg);
+            success = false;
+        }
+    }
+    return success;
+}
+
+TEST(ParameterGroupsfTest, Test_loadEEPROMMatchesScanningLoader)
+{
+    setBenchConfig(4000);
+    writeConfigToEEPROM();
+
+    setBenchConfig(0);
+    EXPECT_TRUE(loadEEPROMByScanning());
+    EXPECT_EQ(300, countBenchConfig(4000));
+
+    setBenchConfig(0);
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(300, countBenchConfig(4000));
+}
+
+TEST(ParameterGroupsfTest, DISABLED_Test_loadEEPROMBenchmark)
+{
+    const int iterations = 200;
+
+    setBenchConfig(4000);
+    writeConfigToEEPROM();
+
+    const auto scanStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        EXPECT_TRUE(loadEEPROMByScanning());
+    }
+    const auto scanEnd = std::chrono::steady_clock::now();
+    EXPECT_EQ(300, countBenchConfig(4000));
+
+    const auto loadStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        EXPECT_TRUE(loadEEPROM());
+    }
+    const auto loadEnd = std::chrono::steady_clock::now();
+    EXPECT_EQ(300, countBenchConfig(4000));
+
+    RecordProperty("pgCount", (int)PG_REGISTRY_SIZE);
+    RecordProperty("scanningLoaderUs", (int)(std::chrono::duration<double, std::micro>(scanEnd - scanStart).count() / iterations));
+    RecordProperty("loadEEPROMUs", (int)(std::chrono::duration<double, std::micro>(loadEnd - loadStart).count() / iterations));
+}
+
+// A record for a benchConfig_t appended after the saved config, with its CRC, which is a multiple of the write size
+#define BENCH_APPENDED_RECORD_SIZE (EEPROM_RECORD_HEADER_SIZE + sizeof(benchConfig_t) + 2)
+
+TEST(ParameterGroupsfTest, Test_saveUnchangedConfig)
+{
+    setBenchConfig(5000);
+    writeConfigToEEPROM();
+    const configSaveStats_t stats = *getConfigSaveStats();
+    const uint16_t configSize = getEEPROMConfigSize();
+
+    // nothing has changed, so nothing is written
+    writeConfigToEEPROM();
+    EXPECT_EQ(stats.appendCount + 1, getConfigSaveStats()->appendCount);
+    EXPECT_EQ(stats.compactCount, getConfigSaveStats()->compactCount);
+    EXPECT_EQ(stats.eraseCount, getConfigSaveStats()->eraseCount);
+    EXPECT_EQ(0, getConfigSaveStats()->lastRecordCount);
+    EXPECT_EQ(configSize, getEEPROMConfigSize());
+}
+
+TEST(ParameterGroupsfTest, Test_saveAppendsChangedPgs)
+{
+    setBenchConfig(6000);
+    writeConfigToEEPROM();
+    const configSaveStats_t stats = *getConfigSaveStats();
+    const uint16_t configSize = getEEPROMConfigSize();
+
+    benchConfig123_System.value = 1;
+    benchConfig321_System.value = 2;
+    writeConfigToEEPROM();
+    EXPECT_EQ(stats.appendCount + 1, getConfigSaveStats()->appendCount);
+    EXPECT_EQ(stats.compactCount, getConfigSaveStats()->compactCount);
+    EXPECT_EQ(stats.eraseCount, getConfigSaveStats()->eraseCount);
+    EXPECT_EQ(2, getConfigSaveStats()->lastRecordCount);
+    EXPECT_EQ(configSize + 2 * BENCH_APPENDED_RECORD_SIZE, getEEPROMConfigSize());
+    EXPECT_TRUE(isEEPROMStructureValid());
+
+    // the appended records override the saved copy
+    pgResetAll();
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(298, countBenchConfig(6000));
+    EXPECT_EQ(1, benchConfig123_System.value);
+    EXPECT_EQ(2, benchConfig321_System.value);
+
+    // and the latest record counts
+    benchConfig123_System.value = 3;
+    writeConfigToEEPROM();
+    EXPECT_EQ(1, getConfigSaveStats()->lastRecordCount);
+    pgResetAll();
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(3, benchConfig123_System.value);
+    EXPECT_EQ(2, benchConfig321_System.value);
+}
+
+TEST(ParameterGroupsfTest, Test_saveCompactsWhenFull)
+{
+    setBenchConfig(7000);
+    writeConfigToEEPROM();
+    const configSaveStats_t stats = *getConfigSaveStats();
+    const uint16_t configSize = getEEPROMConfigSize();
+
+    uint32_t value = 0;
+    while (getConfigSaveStats()->compactCount == stats.compactCount) {
+        benchConfig200_System.value = ++value;
+        writeConfigToEEPROM();
+        ASSERT_LT(value, EEPROM_SIZE / BENCH_APPENDED_RECORD_SIZE);
+    }
+    EXPECT_EQ((EEPROM_SIZE - configSize) / BENCH_APPENDED_RECORD_SIZE + 1, value);
+    EXPECT_EQ(configSize, getEEPROMConfigSize());
+
+    pgResetAll();
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(value, benchConfig200_System.value);
+    EXPECT_EQ(299, countBenchConfig(7000));
+}
+
+TEST(ParameterGroupsfTest, Test_loadEEPROMIgnoresBrokenAppendedRecord)
+{
+    setBenchConfig(8000);
+    writeConfigToEEPROM();
+    const uint16_t configSize = getEEPROMConfigSize();
+
+    benchConfig150_System.value = 1;
+    writeConfigToEEPROM();
+    benchConfig150_System.value = 2;
+    writeConfigToEEPROM();
+    benchConfig151_System.value = 3;
+    writeConfigToEEPROM();
+
+    // as if the power was lost while the second record was written, the records after it don't count either
+    eepromData[configSize + BENCH_APPENDED_RECORD_SIZE + EEPROM_RECORD_HEADER_SIZE] ^= 0x01;
+    EXPECT_TRUE(isEEPROMStructureValid());
+    EXPECT_EQ(configSize + BENCH_APPENDED_RECORD_SIZE, getEEPROMConfigSize());
+
+    pgResetAll();
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(1, benchConfig150_System.value);
+    EXPECT_EQ(8000 + BENCH_PGN_BASE + 151, benchConfig151_System.value);
+
+    // the broken record can't be written over, so the next save rewrites everything
+    const configSaveStats_t stats = *getConfigSaveStats();
+    benchConfig150_System.value = 4;
+    writeConfigToEEPROM();
+    EXPECT_EQ(stats.compactCount + 1, getConfigSaveStats()->compactCount);
+    pgResetAll();
+    EXPECT_TRUE(loadEEPROM());
+    EXPECT_EQ(4, benchConfig150_System.value);
+}
+
+TEST(ParameterGroupsfTest, Test_configSnapshot)
+{
+    setBenchConfig(9000);
+
+    const uint32_t snapshotSize = getConfigSnapshotSize();
+    EXPECT_EQ(PG_REGISTRY_SIZE * EEPROM_RECORD_HEADER_SIZE + 300 * sizeof(benchConfig_t) + sizeof(motorConfig_t), snapshotSize);
+
+    // read it in odd sized chunks, as over MSP
+    static uint8_t snapshot[8192];
+    ASSERT_LT(snapshotSize, sizeof(snapshot));
+    uint32_t offset = 0;
+    for (int length; (length = readConfigSnapshot(offset, snapshot + offset, 37)) > 0; offset += length) {
+        ASSERT_LE(length, 37);
+    }
+    EXPECT_EQ(snapshotSize, offset);
+    EXPECT_EQ(getConfigSnapshotCrc(), crc16_ccitt_update(0xFFFF, snapshot, snapshotSize));
+
+    // the records are in registry order, and hold the PGs in RAM
+    const uint8_t *p = snapshot;
+    PG_FOREACH(reg) {
+        EXPECT_EQ(EEPROM_RECORD_HEADER_SIZE + pgSize(reg), p[0] | (p[1] << 8));
+        EXPECT_EQ(pgN(reg), p[2] | (p[3] << 8));
+        EXPECT_EQ(pgVersion(reg), p[4]);
+        EXPECT_EQ(0, memcmp(p + EEPROM_RECORD_HEADER_SIZE, reg->address, pgSize(reg)));
+        p += EEPROM_RECORD_HEADER_SIZE + pgSize(reg);
+    }
+
+    // the CRC changes with the config
+    benchConfig300_System.value++;
+    EXPECT_NE(crc16_ccitt_update(0xFFFF, snapshot, snapshotSize), getConfigSnapshotCrc());
+}
+
+TEST(ParameterGroupsfTest, Test_pgPatch)
+{
+    pgResetAll();
+    const pgRegistry_t *reg = pgFind(PG_MOTOR_CONFIG);
+    const uint16_t maxthrottle = 1900;
+
+    EXPECT_TRUE(pgPatch(reg, 1, offsetof(motorConfig_t, maxthrottle), &maxthrottle, sizeof(maxthrottle)));
+    EXPECT_EQ(1900, motorConfig()->maxthrottle);
+    EXPECT_EQ(1150, motorConfig()->minthrottle);
+
+    // nothing is changed by a patch for another version, or one that doesn't lie within the PG
+    const uint16_t changed = 2000;
+    EXPECT_FALSE(pgPatch(reg, 0, offsetof(motorConfig_t, maxthrottle), &changed, sizeof(changed)));
+    EXPECT_FALSE(pgPatch(reg, 1, sizeof(motorConfig_t) - 1, &changed, sizeof(changed)));
+    EXPECT_FALSE(pgPatch(reg, 1, -1, &changed, sizeof(changed)));
+    EXPECT_EQ(1900, motorConfig()->maxthrottle);
+    EXPECT_TRUE(pgPatch(reg, 1, sizeof(motorConfig_t), &changed, 0));
+}
+
 // STUBS
 
 extern "C" {
+timeUs_t micros(void)
+{
+    return 0;
+}
+
+void failureMode(failureMode_e mode)
+{
+    FAIL() << "failureMode " << mode;
+}
 }
@@ -115,3 +115,12 @@ typedef struct
 #include "target.h"
 
 #include "target/common_defaults_post.h"
+
+#ifdef CONFIG_IN_RAM
+#ifndef EEPROM_SIZE
+#define EEPROM_SIZE     4096
+#endif
+extern uint8_t eepromData[EEPROM_SIZE];
+#define __config_start (*eepromData)
+#define __config_end (eepromData[EEPROM_SIZE])
+#endif
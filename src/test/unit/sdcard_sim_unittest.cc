@@ -0,0 +1,442 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "drivers/sdcard.h"
+    #include "pg/bus_spi.h"
+
+    #include "drivers/sdcard_impl.h"
+    #include "drivers/sdcard_sim.h"
+
+    #include "io/asyncfatfs/asyncfatfs.h"
+    #include "io/asyncfatfs/fat_standard.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define BLOCK_SIZE 512
+#define TEST_IMAGE "sdcard_sim_unittest.img"
+
+static uint32_t simulatedTimeUs;
+
+static struct {
+    int count;
+    sdcardBlockOperation_e operation;
+    uint32_t blockIndex;
+    uint8_t *buffer;
+} completion;
+
+static void operationComplete(sdcardBlockOperation_e operation, uint32_t blockIndex, uint8_t *buffer, uint32_t callbackData)
+{
+    UNUSED(callbackData);
+    completion.count++;
+    completion.operation = operation;
+    completion.blockIndex = blockIndex;
+    completion.buffer = buffer;
+}
+
+static void writeSector(FILE *f, uint32_t sector, const void *data, size_t size)
+{
+    fseek(f, sector * BLOCK_SIZE, SEEK_SET);
+    fwrite(data, size, 1, f);
+}
+
+/*
+ * Minimal mkfs.fat: a bare volume (no MBR) with two FATs and an empty root directory.
+ */
+static void createFatVolume(uint32_t totalSectors, uint8_t sectorsPerCluster, bool fat32)
+{
+    uint8_t sector[BLOCK_SIZE];
+    fatVolumeID_t *volume = (fatVolumeID_t *)sector;
+
+    FILE *f = fopen(TEST_IMAGE, "w+b");
+    ASSERT_NE(nullptr, f);
+    ASSERT_EQ(0, ftruncate(fileno(f), (off_t)totalSectors * BLOCK_SIZE));
+
+    const uint16_t reservedSectors = fat32 ? 32 : 1;
+    const uint16_t rootEntryCount = fat32 ? 0 : 512;
+    const uint32_t rootDirSectors = rootEntryCount * FAT_DIRECTORY_ENTRY_SIZE / BLOCK_SIZE;
+    const uint32_t clusters = (totalSectors - reservedSectors - rootDirSectors) / sectorsPerCluster;
+    const uint32_t fatSectors = ((clusters + 2) * (fat32 ? 4 : 2) + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    memset(sector, 0, sizeof(sector));
+    volume->jmpBoot[0] = 0xEB;
+    volume->jmpBoot[1] = 0x58;
+    volume->jmpBoot[2] = 0x90;
+    memcpy(volume->oemName, "BFSIM   ", 8);
+    volume->bytesPerSector = BLOCK_SIZE;
+    volume->sectorsPerCluster = sectorsPerCluster;
+    volume->reservedSectorCount = reservedSectors;
+    volume->numFATs = 2;
+    volume->rootEntryCount = rootEntryCount;
+    volume->media = 0xF8;
+    volume->totalSectors32 = totalSectors;
+    if (fat32) {
+        volume->fatDescriptor.fat32.FATSize32 = fatSectors;
+        volume->fatDescriptor.fat32.rootCluster = 2;
+    } else {
+        volume->FATSize16 = fatSectors;
+    }
+    sector[510] = FAT_VOLUME_ID_SIGNATURE_1;
+    sector[511] = FAT_VOLUME_ID_SIGNATURE_2;
+    writeSector(f, 0, sector, sizeof(sector));
+
+    memset(sector, 0, sizeof(sector));
+    if (fat32) {
+        const uint32_t fat[] = { 0x0FFFFFF8, 0x0FFFFFFF, 0x0FFFFFFF }; // cluster 2 holds the root directory
+        memcpy(sector, fat, sizeof(fat));
+    } else {
+        const uint16_t fat[] = { 0xFFF8, 0xFFFF };
+        memcpy(sector, fat, sizeof(fat));
+    }
+    writeSector(f, reservedSectors, sector, sizeof(sector));
+    writeSector(f, reservedSectors + fatSectors, sector, sizeof(sector));
+
+    fclose(f);
+}
+
+static void initCard(const sdcardSimConfig_t *config)
+{
+    sdcardSim_setConfig(config);
+    sdcardSimVTable.sdcard_init(NULL, NULL);
+    sdcardSim_resetStats();
+    memset(&completion, 0, sizeof(completion));
+}
+
+static const sdcardSimConfig_t defaultConfig = {
+    .filename = TEST_IMAGE,
+    .readLatencyUs = 100,
+    .writeLatencyUs = 500,
+    .multiWriteLatencyUs = 200,
+    .stallInterval = 0,
+    .stallDurationUs = 0,
+    .seed = 1,
+};
+
+class SdcardSimTest : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        simulatedTimeUs = 0;
+    }
+    virtual void TearDown() {
+        sdcardSim_close();
+        unlink(TEST_IMAGE);
+    }
+};
+
+TEST_F(SdcardSimTest, MissingImageIsNotFunctional)
+{
+    sdcardSimConfig_t config = defaultConfig;
+    config.filename = "does_not_exist.img";
+    initCard(&config);
+
+    EXPECT_FALSE(sdcardSimVTable.sdcard_isFunctional());
+    EXPECT_FALSE(sdcardSimVTable.sdcard_poll());
+}
+
+TEST_F(SdcardSimTest, BareFat16VolumeGetsSyntheticMbr)
+{
+    uint8_t buffer[BLOCK_SIZE];
+
+    createFatVolume(65536, 4, false);
+    initCard(&defaultConfig);
+
+    ASSERT_TRUE(sdcardSimVTable.sdcard_isFunctional());
+    EXPECT_EQ(SDCARD_SIM_PARTITION_START_BLOCK + 65536, sdcardSimVTable.sdcard_getMetadata()->numBlocks);
+
+    ASSERT_TRUE(sdcardSimVTable.sdcard_readBlock(0, buffer, operationComplete, 0));
+    simulatedTimeUs += defaultConfig.readLatencyUs;
+    EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+
+    mbrPartitionEntry_t partition;
+    memcpy(&partition, buffer + 446, sizeof(partition));
+    EXPECT_EQ(MBR_PARTITION_TYPE_FAT16_LBA, partition.type);
+    EXPECT_EQ(SDCARD_SIM_PARTITION_START_BLOCK, partition.lbaBegin);
+    EXPECT_EQ(65536, partition.numSectors);
+    EXPECT_EQ(0x55, buffer[510]);
+    EXPECT_EQ(0xAA, buffer[511]);
+
+    // and the volume itself starts at the partition
+    ASSERT_TRUE(sdcardSimVTable.sdcard_readBlock(SDCARD_SIM_PARTITION_START_BLOCK, buffer, operationComplete, 0));
+    simulatedTimeUs += defaultConfig.readLatencyUs;
+    EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+    EXPECT_EQ(0, memcmp(((fatVolumeID_t *)buffer)->oemName, "BFSIM   ", 8));
+}
+
+TEST_F(SdcardSimTest, BareFat32VolumeGetsFat32Partition)
+{
+    uint8_t buffer[BLOCK_SIZE];
+
+    createFatVolume(70000, 1, true);
+    initCard(&defaultConfig);
+
+    ASSERT_TRUE(sdcardSimVTable.sdcard_readBlock(0, buffer, operationComplete, 0));
+    simulatedTimeUs += defaultConfig.readLatencyUs;
+    EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+
+    mbrPartitionEntry_t partition;
+    memcpy(&partition, buffer + 446, sizeof(partition));
+    EXPECT_EQ(MBR_PARTITION_TYPE_FAT32_LBA, partition.type);
+}
+
+TEST_F(SdcardSimTest, OperationsCompleteAfterLatency)
+{
+    uint8_t buffer[BLOCK_SIZE];
+
+    createFatVolume(65536, 4, false);
+    initCard(&defaultConfig);
+
+    const uint32_t block = SDCARD_SIM_PARTITION_START_BLOCK + 100;
+    memset(buffer, 0x5A, sizeof(buffer));
+
+    EXPECT_EQ(SDCARD_OPERATION_IN_PROGRESS, sdcardSimVTable.sdcard_writeBlock(block, buffer, operationComplete, 0));
+
+    // busy until the write latency has elapsed
+    simulatedTimeUs += defaultConfig.writeLatencyUs - 1;
+    EXPECT_FALSE(sdcardSimVTable.sdcard_poll());
+    EXPECT_EQ(0, completion.count);
+    EXPECT_EQ(SDCARD_OPERATION_BUSY, sdcardSimVTable.sdcard_writeBlock(block, buffer, operationComplete, 0));
+    EXPECT_FALSE(sdcardSimVTable.sdcard_readBlock(block, buffer, operationComplete, 0));
+    EXPECT_EQ(2, sdcardSim_getStats()->busyRejects);
+
+    simulatedTimeUs += 1;
+    EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+    EXPECT_EQ(1, completion.count);
+    EXPECT_EQ(SDCARD_BLOCK_OPERATION_WRITE, completion.operation);
+    EXPECT_EQ(block, completion.blockIndex);
+    EXPECT_EQ(buffer, completion.buffer);
+
+    memset(buffer, 0, sizeof(buffer));
+    EXPECT_TRUE(sdcardSimVTable.sdcard_readBlock(block, buffer, operationComplete, 0));
+    simulatedTimeUs += defaultConfig.readLatencyUs;
+    EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+    EXPECT_EQ(2, completion.count);
+    EXPECT_EQ(SDCARD_BLOCK_OPERATION_READ, completion.operation);
+    EXPECT_EQ(0x5A, buffer[0]);
+    EXPECT_EQ(0x5A, buffer[BLOCK_SIZE - 1]);
+}
+
+TEST_F(SdcardSimTest, WritesInFrontOfBareVolumeFail)
+{
+    uint8_t buffer[BLOCK_SIZE] = { 0 };
+
+    createFatVolume(65536, 4, false);
+    initCard(&defaultConfig);
+
+    EXPECT_EQ(SDCARD_OPERATION_IN_PROGRESS, sdcardSimVTable.sdcard_writeBlock(0, buffer, operationComplete, 0));
+    simulatedTimeUs += defaultConfig.writeLatencyUs;
+    EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+    EXPECT_EQ(nullptr, completion.buffer);
+}
+
+TEST_F(SdcardSimTest, MultiBlockWriteUsesPreEraseLatency)
+{
+    uint8_t buffer[BLOCK_SIZE] = { 0 };
+
+    createFatVolume(65536, 4, false);
+    initCard(&defaultConfig);
+
+    const uint32_t block = SDCARD_SIM_PARTITION_START_BLOCK + 200;
+    EXPECT_EQ(SDCARD_OPERATION_SUCCESS, sdcardSimVTable.sdcard_beginWriteBlocks(block, 4));
+
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(SDCARD_OPERATION_IN_PROGRESS, sdcardSimVTable.sdcard_writeBlock(block + i, buffer, operationComplete, 0));
+        simulatedTimeUs += defaultConfig.multiWriteLatencyUs;
+        EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+    }
+    EXPECT_EQ(4, completion.count);
+
+    // the run is over, so this one pays the full single block latency
+    EXPECT_EQ(SDCARD_OPERATION_IN_PROGRESS, sdcardSimVTable.sdcard_writeBlock(block + 4, buffer, operationComplete, 0));
+    simulatedTimeUs += defaultConfig.multiWriteLatencyUs;
+    EXPECT_FALSE(sdcardSimVTable.sdcard_poll());
+    simulatedTimeUs += defaultConfig.writeLatencyUs - defaultConfig.multiWriteLatencyUs;
+    EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+
+    EXPECT_EQ(5, sdcardSim_getStats()->blocksWritten);
+    EXPECT_EQ(4 * defaultConfig.multiWriteLatencyUs + defaultConfig.writeLatencyUs, sdcardSim_getStats()->busyTimeUs);
+}
+
+TEST_F(SdcardSimTest, WriteStallsAreRepeatable)
+{
+    uint8_t buffer[BLOCK_SIZE] = { 0 };
+    uint32_t stallPattern[2] = { 0, 0 };
+
+    createFatVolume(65536, 4, false);
+
+    sdcardSimConfig_t config = defaultConfig;
+    config.stallInterval = 4;
+    config.stallDurationUs = 50000;
+    config.seed = 1234;
+
+    for (int run = 0; run < 2; run++) {
+        initCard(&config);
+        for (int i = 0; i < 32; i++) {
+            const uint32_t stallsBefore = sdcardSim_getStats()->writeStalls;
+            EXPECT_EQ(SDCARD_OPERATION_IN_PROGRESS, sdcardSimVTable.sdcard_writeBlock(SDCARD_SIM_PARTITION_START_BLOCK + i, buffer, operationComplete, 0));
+            if (sdcardSim_getStats()->writeStalls != stallsBefore) {
+                stallPattern[run] |= 1 << i;
+            }
+            simulatedTimeUs += config.writeLatencyUs + config.stallDurationUs;
+            EXPECT_TRUE(sdcardSimVTable.sdcard_poll());
+        }
+    }
+
+    EXPECT_NE(0, stallPattern[0]);
+    EXPECT_EQ(stallPattern[0], stallPattern[1]);
+}
+
+static void mountFilesystem(void)
+{
+    afatfs_init();
+    for (int i = 0; i < 1000000 && afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_INITIALIZATION; i++) {
+        afatfs_poll();
+        simulatedTimeUs += 10;
+    }
+}
+
+static void unmountFilesystem(void)
+{
+    for (int i = 0; i < 1000000 && !afatfs_destroy(false); i++) {
+        simulatedTimeUs += 10;
+    }
+}
+
+static afatfsFilePtr_t openedFile;
+
+static void fileOpened(afatfsFilePtr_t file)
+{
+    openedFile = file;
+}
+
+/*
+ * Append a log the way blackbox does, polling the filesystem between writes, and report the throughput the
+ * simulated card allowed.
+ */
+static void benchmarkLogWrite(const sdcardSimConfig_t *config, uint32_t logSize, const char *description)
+{
+    uint8_t chunk[64];
+
+    initCard(config);
+    mountFilesystem();
+    ASSERT_EQ(AFATFS_FILESYSTEM_STATE_READY, afatfs_getFilesystemState());
+
+    openedFile = NULL;
+    ASSERT_TRUE(afatfs_fopen("LOG00001.BFL", "as", fileOpened));
+    for (int i = 0; i < 100000 && !openedFile; i++) {
+        afatfs_poll();
+        simulatedTimeUs += 10;
+    }
+    ASSERT_NE(nullptr, openedFile);
+
+    sdcardSim_resetStats();
+    const uint32_t startUs = simulatedTimeUs;
+    uint32_t written = 0;
+
+    for (int i = 0; written < logSize && i < 10000000; i++) {
+        memset(chunk, written & 0xFF, sizeof(chunk));
+        written += afatfs_fwrite(openedFile, chunk, sizeof(chunk));
+        afatfs_poll();
+        simulatedTimeUs += 10;
+    }
+    EXPECT_EQ(logSize, written);
+
+    ASSERT_TRUE(afatfs_fclose(openedFile, NULL));
+    unmountFilesystem();
+
+    const uint32_t elapsedUs = simulatedTimeUs - startUs;
+    const sdcardSimStats_t *stats = sdcardSim_getStats();
+
+    EXPECT_GE(stats->blocksWritten, logSize / BLOCK_SIZE);
+
+    printf("[ BENCHMARK] %s: %u bytes in %u us (%u KB/s), %u blocks written, %u stalls, %u busy rejects\n",
+        description, written, elapsedUs, (uint32_t)((uint64_t)written * 1000000 / elapsedUs / 1024),
+        stats->blocksWritten, stats->writeStalls, stats->busyRejects);
+}
+
+TEST_F(SdcardSimTest, AfatfsLogWriteFat16)
+{
+    createFatVolume(65536, 4, false);
+
+    benchmarkLogWrite(&defaultConfig, 256 * 1024, "FAT16");
+}
+
+TEST_F(SdcardSimTest, AfatfsLogWriteFat32)
+{
+    createFatVolume(140000, 1, true);
+
+    benchmarkLogWrite(&defaultConfig, 256 * 1024, "FAT32");
+}
+
+TEST_F(SdcardSimTest, AfatfsLogWriteWithStalls)
+{
+    createFatVolume(65536, 4, false);
+
+    sdcardSimConfig_t config = defaultConfig;
+    config.stallInterval = 64;
+    config.stallDurationUs = 100000;
+
+    benchmarkLogWrite(&config, 256 * 1024, "FAT16 with write stalls");
+    EXPECT_GT(sdcardSim_getStats()->writeStalls, 0);
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void)
+{
+    return simulatedTimeUs;
+}
+
+uint32_t millis(void)
+{
+    return simulatedTimeUs / 1000;
+}
+
+bool sdcard_readBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    return sdcardSimVTable.sdcard_readBlock(blockIndex, buffer, callback, callbackData);
+}
+
+sdcardOperationStatus_e sdcard_beginWriteBlocks(uint32_t blockIndex, uint32_t blockCount)
+{
+    return sdcardSimVTable.sdcard_beginWriteBlocks(blockIndex, blockCount);
+}
+
+sdcardOperationStatus_e sdcard_writeBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    return sdcardSimVTable.sdcard_writeBlock(blockIndex, buffer, callback, callbackData);
+}
+
+bool sdcard_poll(void)
+{
+    return sdcardSimVTable.sdcard_poll();
+}
+
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of Cleanflight and Betaflight.
+ *
+ * Cleanflight and Betaflight are free software. You can redistribute
+ * this software and/or modify this software under the terms of the
+ * GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * Cleanflight and Betaflight are distributed in the hope that they
+ * will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.
+ *
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/stream_stats.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+TEST(StreamStatsTest, Empty)
+{
+    streamStats_t stats;
+    streamStatsInit(&stats, 95, 1);
+
+    EXPECT_EQ(0, stats.count);
+    EXPECT_EQ(0, streamStatsMean(&stats));
+}
+
+TEST(StreamStatsTest, MinMaxMean)
+{
+    streamStats_t stats;
+    streamStatsInit(&stats, 0, 0);
+
+    const int32_t values[] = { 12, -40, 7, 300, 1 };
+    for (const int32_t value : values) {
+        streamStatsAdd(&stats, value);
+    }
+
+    EXPECT_EQ(5, stats.count);
+    EXPECT_EQ(-40, stats.min);
+    EXPECT_EQ(300, stats.max);
+    EXPECT_EQ(56, streamStatsMean(&stats));
+    // Not estimated, so left at the first value
+    EXPECT_EQ(12, stats.percentile);
+}
+
+TEST(StreamStatsTest, MeanDoesNotOverflow)
+{
+    streamStats_t stats;
+    streamStatsInit(&stats, 0, 0);
+
+    for (int i = 0; i < 100000; i++) {
+        streamStatsAdd(&stats, 2000000);
+    }
+
+    EXPECT_EQ(2000000, streamStatsMean(&stats));
+}
+
+TEST(StreamStatsTest, PercentileOfUniformValues)
+{
+    streamStats_t p95;
+    streamStats_t p5;
+    streamStatsInit(&p95, 95, 1);
+    streamStatsInit(&p5, 5, 1);
+
+    srand(1);
+    for (int i = 0; i < 100000; i++) {
+        const int32_t value = rand() % 10000;
+        streamStatsAdd(&p95, value);
+        streamStatsAdd(&p5, value);
+    }
+
+    EXPECT_NEAR(9500, p95.percentile, 200);
+    EXPECT_NEAR(500, p5.percentile, 200);
+}
+
+TEST(StreamStatsTest, PercentileIgnoresShortSpikes)
+{
+    streamStats_t stats;
+    streamStatsInit(&stats, 95, 1);
+
+    // A steady 10A with a 2% of the time 40A punch out
+    for (int i = 0; i < 50000; i++) {
+        streamStatsAdd(&stats, i % 50 == 0 ? 4000 : 1000);
+    }
+
+    EXPECT_EQ(4000, stats.max);
+    EXPECT_NEAR(1000, stats.percentile, 100);
+}
+
+TEST(StreamStatsTest, PercentileFollowsAStep)
+{
+    streamStats_t stats;
+    streamStatsInit(&stats, 95, 5);
+
+    for (int i = 0; i < 1000; i++) {
+        streamStatsAdd(&stats, 10000);
+    }
+    EXPECT_EQ(10000, stats.percentile);
+
+    for (int i = 0; i < 1000; i++) {
+        streamStatsAdd(&stats, 30000);
+    }
+    EXPECT_EQ(30000, stats.percentile);
+}
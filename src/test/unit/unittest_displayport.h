@@ -21,6 +21,8 @@
 
 extern "C" {
     #include "drivers/display.h"
+
+    #include "io/displayport_virtual.h"
 }
 
 #include "unittest_macros.h"
@@ -32,100 +34,15 @@ void displayPortTestBufferSubstring(int x, int y, const char * expectedFormat, .
 #define UNITTEST_DISPLAYPORT_COLS 30
 #define UNITTEST_DISPLAYPORT_BUFFER_LEN (UNITTEST_DISPLAYPORT_ROWS * UNITTEST_DISPLAYPORT_COLS)
 
-char testDisplayPortBuffer[UNITTEST_DISPLAYPORT_BUFFER_LEN];
-
-static displayPort_t testDisplayPort;
-
-static int displayPortTestGrab(displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    return 0;
-}
-
-static int displayPortTestRelease(displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    return 0;
-}
-
-static int displayPortTestClearScreen(displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    memset(testDisplayPortBuffer, ' ', UNITTEST_DISPLAYPORT_BUFFER_LEN);
-    return 0;
-}
-
-static int displayPortTestDrawScreen(displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    return 0;
-}
-
-static int displayPortTestScreenSize(const displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    return 0;
-}
-
-static int displayPortTestWriteString(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *s)
-{
-    UNUSED(displayPort);
-    for (unsigned int i = 0; i < strlen(s); i++) {
-        testDisplayPortBuffer[(y * UNITTEST_DISPLAYPORT_COLS) + x + i] = s[i];
-    }
-    return 0;
-}
-
-static int displayPortTestWriteChar(displayPort_t *displayPort, uint8_t x, uint8_t y, uint8_t c)
-{
-    UNUSED(displayPort);
-    testDisplayPortBuffer[(y * UNITTEST_DISPLAYPORT_COLS) + x] = c;
-    return 0;
-}
-
-static bool displayPortTestIsTransferInProgress(const displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    return 0;
-}
-
-static int displayPortTestHeartbeat(displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    return 0;
-}
-
-static void displayPortTestResync(displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-}
-
-static uint32_t displayPortTestTxBytesFree(const displayPort_t *displayPort)
-{
-    UNUSED(displayPort);
-    return 0;
-}
+// The tests draw to the virtual displayport, so that they can also look at what it counted
+static displayPort_t *testDisplayPortInstance = displayPortVirtualInit(UNITTEST_DISPLAYPORT_ROWS, UNITTEST_DISPLAYPORT_COLS);
 
-static const displayPortVTable_t testDisplayPortVTable = {
-    .grab = displayPortTestGrab,
-    .release = displayPortTestRelease,
-    .clearScreen = displayPortTestClearScreen,
-    .drawScreen = displayPortTestDrawScreen,
-    .screenSize = displayPortTestScreenSize,
-    .writeString = displayPortTestWriteString,
-    .writeChar = displayPortTestWriteChar,
-    .isTransferInProgress = displayPortTestIsTransferInProgress,
-    .heartbeat = displayPortTestHeartbeat,
-    .resync = displayPortTestResync,
-    .txBytesFree = displayPortTestTxBytesFree
-};
+#define testDisplayPort (*testDisplayPortInstance)
+#define testDisplayPortBuffer (displayPortVirtualBuffer())
 
 displayPort_t *displayPortTestInit(void)
 {
-    displayInit(&testDisplayPort, &testDisplayPortVTable);
-    testDisplayPort.rows = UNITTEST_DISPLAYPORT_ROWS;
-    testDisplayPort.cols = UNITTEST_DISPLAYPORT_COLS;
-    return &testDisplayPort;
+    return displayPortVirtualInit(UNITTEST_DISPLAYPORT_ROWS, UNITTEST_DISPLAYPORT_COLS);
 }
 
 void displayPortTestPrint(void)